@@ -2,6 +2,101 @@
 #include "fs.h"
 #include "nvme.h"
 
+static void *
+blockaddr(blockno_t blockno) {
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+}
+
+/* Number of sequential streams tracked for read-ahead */
+#define RA_STREAMS 8
+
+/* Read-ahead window bounds (in blocks) */
+#define RA_MIN_WINDOW 4
+#define RA_MAX_WINDOW 64
+
+/* Capacity of dirty block list */
+#define DIRTY_MAX 1024
+
+/* Background write-back starts once this many blocks are dirty
+ * or the oldest dirty block is WB_INTERVAL seconds old */
+#define WB_THRESHOLD (DIRTY_MAX / 2)
+#define WB_INTERVAL  5
+
+/* Maximal number of blocks written by one command */
+#define WB_MAX_RUN 64
+
+/* Maximal number of reads submitted without waiting */
+#define BC_INFLIGHT 8
+
+/* Blocks being read are staged here, so that nobody
+ * sees them in the block cache before the read completes */
+#define BCSTAGE (DISKMAP + DISKSIZE)
+
+/* Number of blocks the cache may keep in memory (64MB by default).
+ * Once there are more of them, least recently used clean blocks
+ * are dropped between requests until BC_LIMIT_LOW are left */
+#ifndef BC_LIMIT
+#define BC_LIMIT 16384
+#endif
+#define BC_LIMIT_LOW (BC_LIMIT - BC_LIMIT / 8)
+
+struct BcStats bc_stats;
+
+void (*bc_suspend)(int slot);
+
+/* Reads in flight, slot i is staged at BCSTAGE + i * RA_MAX_WINDOW * BLKSIZE */
+static struct BcRead {
+    blockno_t r_blockno;
+    blockno_t r_count; /* 0 if slot is free */
+    int r_tag;         /* NVMe command tag */
+    bool r_done;       /* blocks are mapped, slot is not yet reported */
+} reads[BC_INFLIGHT];
+
+/* Clean blocks are mapped read-only, so the first write to a block
+ * faults and adds it to the dirty set.  dirty_map holds membership
+ * and dirty_list holds the blocks in order they were dirtied.
+ * Blocks written back one by one stay in the list until next sync */
+static uint32_t dirty_map[DISKSIZE / BLKSIZE / 32];
+static blockno_t dirty_list[DIRTY_MAX];
+static size_t ndirty;
+static int dirty_since;
+
+/* Blocks holding metadata, they are written through the journal.
+ * nmeta counts dirty ones (maybe more) and commit_time is the time of
+ * the last commit, committed blocks go home at checkpoint */
+static uint32_t meta_map[DISKSIZE / BLKSIZE / 32];
+static size_t nmeta;
+static int commit_time;
+
+/* Replacement uses CLOCK over block numbers.  resident_map holds
+ * blocks mapped by the cache, ref_map is set when a block is used and
+ * cleared when the hand passes it.  Pinned blocks are never evicted.
+ * Resident blocks may still be dropped by the kernel, which is noticed
+ * by the hand.
+ *
+ * Accessed bits can't tell which blocks were used: the kernel sets
+ * PTE_A on every new mapping and clears it only in its own reclaim
+ * clock, which the server can't do.  So use of blocks is noted in
+ * software, in ref_map here and in ra_map for read-ahead. */
+static uint32_t resident_map[DISKSIZE / BLKSIZE / 32];
+static uint32_t ref_map[DISKSIZE / BLKSIZE / 32];
+static uint32_t pin_map[DISKSIZE / BLKSIZE / 32];
+static blockno_t clock_hand;
+
+/* Sequential stream detected by block cache faults.
+ * Fault at ra_end means that reader went past prefetched
+ * blocks, so the window is grown and next part is fetched */
+static struct Readahead {
+    blockno_t ra_start;  /* first block prefetched by last read */
+    blockno_t ra_end;    /* block following last read, 0 if stream is unused */
+    blockno_t ra_window; /* number of blocks to fetch next time */
+    uint64_t ra_used;    /* stream clock for replacement */
+} streams[RA_STREAMS], *ra_last;
+static uint64_t ra_clock;
+/* Prefetched blocks not used yet, see ref_map for why
+ * this is not taken from accessed bits */
+static uint32_t ra_map[DISKSIZE / BLKSIZE / 32];
+
 /* Return the virtual address of this disk block. */
 void *
 diskaddr(blockno_t blockno) {
@@ -14,8 +109,359 @@ diskaddr(blockno_t blockno) {
     return r;
 }
 
+/* Note that count blocks starting with blockno were mapped */
+static void
+note_resident(blockno_t blockno, blockno_t count) {
+    for (blockno_t b = blockno; b < blockno + count; b++) {
+        if (!TSTBIT(resident_map, b)) {
+            SETBIT(resident_map, b);
+            bc_stats.resident++;
+        }
+        SETBIT(ref_map, b);
+    }
+}
+
+static void
+drop_resident(blockno_t blockno) {
+    if (TSTBIT(ra_map, blockno)) {
+        CLRBIT(ra_map, blockno);
+        bc_stats.ra_waste++;
+    }
+    CLRBIT(resident_map, blockno);
+    CLRBIT(ref_map, blockno);
+    bc_stats.resident--;
+}
+
+/* Note use of cached block */
+static void
+mark_used(blockno_t blockno) {
+    SETBIT(ref_map, blockno);
+    if (TSTBIT(ra_map, blockno)) {
+        CLRBIT(ra_map, blockno);
+        bc_stats.ra_hits++;
+    }
+}
+
+static void *
+stageaddr(int slot) {
+    return (void *)(uintptr_t)(BCSTAGE + (uintptr_t)slot * RA_MAX_WINDOW * BLKSIZE);
+}
+
+/* Returns slot of read in flight covering blockno, -1 if none */
+static int
+read_slot(blockno_t blockno) {
+    for (int i = 0; i < BC_INFLIGHT; i++)
+        if (reads[i].r_count && !reads[i].r_done &&
+            blockno - reads[i].r_blockno < reads[i].r_count) return i;
+    return -1;
+}
+
+/* Submit read of count blocks starting at blockno without waiting.
+ * Returns slot of the read, -1 if it can't be submitted now */
+static int
+read_start(blockno_t blockno, blockno_t count) {
+    int slot = 0;
+    while (slot < BC_INFLIGHT && reads[slot].r_count) slot++;
+    if (slot == BC_INFLIGHT) return -1;
+
+    /* The server yields while the device fills staging pages, so they
+     * are pinned to stay at the physical addresses given to it.  Pages
+     * are allocated one by one to be moved to the cache separately. */
+    void *stage = stageaddr(slot);
+    for (blockno_t i = 0; i < count; i++) {
+        if (sys_alloc_dma_region(CURENVID, (char *)stage + i * BLKSIZE, 0, PROT_RW, NULL) < 0) {
+            sys_unmap_region(CURENVID, stage, i * BLKSIZE);
+            return -1;
+        }
+    }
+
+    int tag = nvme_read_async(blockno * BLKSECTS, stage, count * BLKSECTS);
+    if (tag < 0) {
+        sys_unmap_region(CURENVID, stage, count * BLKSIZE);
+        return -1;
+    }
+
+    reads[slot] = (struct BcRead){blockno, count, tag, 0};
+    bc_stats.faults++;
+    bc_stats.async_reads++;
+    if (count > 1) {
+        bc_stats.ra_io++;
+        bc_stats.ra_blocks += count - 1;
+    }
+    return slot;
+}
+
+/* Move blocks of completed read from staging area to the cache */
+static void
+read_finish(int tag, int status) {
+    int slot = 0;
+    while (slot < BC_INFLIGHT && (!reads[slot].r_count || reads[slot].r_done ||
+                                  reads[slot].r_tag != tag)) slot++;
+    if (slot == BC_INFLIGHT)
+        panic("completion of unknown read %d", tag);
+
+    struct BcRead *r = &reads[slot];
+    void *stage = stageaddr(slot), *addr = blockaddr(r->r_blockno);
+    if (status != NVME_OK)
+        panic("bc: reading blocks %08x+%u failed\n", r->r_blockno, r->r_count);
+
+    int res = sys_map_region(CURENVID, stage, CURENVID, addr, r->r_count * BLKSIZE,
+                             PTE_SYSCALL & get_prot(stage) & ~PROT_W);
+    if (res)
+        panic("bc: can't map blocks %08x+%u: %i", r->r_blockno, r->r_count, res);
+    sys_unmap_region(CURENVID, stage, r->r_count * BLKSIZE);
+    note_resident(r->r_blockno, r->r_count);
+    r->r_done = 1;
+}
+
+/* Wait until read in given slot completes */
+static void
+read_wait(int slot) {
+    while (!reads[slot].r_done) {
+        int status, tag = nvme_poll(&status);
+        if (tag >= 0) read_finish(tag, status);
+    }
+}
+
+/* Returns slot of some completed read and frees the slot,
+ * or -1 if no read completed since the last call.
+ * Requests suspended on the slot may be restarted then */
+int
+bc_poll(void) {
+    for (int i = 0; i < BC_INFLIGHT; i++) {
+        if (reads[i].r_done) {
+            reads[i].r_count = 0;
+            reads[i].r_done = 0;
+            return i;
+        }
+    }
+
+    int status, tag = nvme_poll(&status);
+    if (tag < 0) return -1;
+    read_finish(tag, status);
+    return bc_poll();
+}
+
+/* Are there reads that bc_poll() did not report yet? */
+bool
+bc_pending(void) {
+    for (int i = 0; i < BC_INFLIGHT; i++)
+        if (reads[i].r_count) return 1;
+    return 0;
+}
+
+/* Count blocks of last read-ahead that were not used
+ * by the time the stream went on as wasted */
+static void
+ra_account(struct Readahead *s) {
+    for (blockno_t b = s->ra_start; b < s->ra_end; b++) {
+        if (TSTBIT(ra_map, b)) {
+            CLRBIT(ra_map, b);
+            bc_stats.ra_waste++;
+        }
+    }
+    s->ra_start = s->ra_end;
+}
+
+/* Find stream continued by blockno, or replace least recently used one.
+ * Returns number of blocks to read starting with blockno */
+static blockno_t
+ra_window(blockno_t blockno) {
+    struct Readahead *s = NULL;
+    for (struct Readahead *r = streams; r < streams + RA_STREAMS; r++) {
+        if (r->ra_end && r->ra_end == blockno) {
+            s = r;
+            break;
+        }
+        if (!s || r->ra_used < s->ra_used) s = r;
+    }
+
+    s->ra_used = ++ra_clock;
+    ra_account(s);
+    ra_last = s;
+    if (s->ra_end != blockno) {
+        /* Random access, read just the demanded block */
+        s->ra_window = 1;
+        s->ra_start = s->ra_end = blockno + 1;
+        return 1;
+    }
+    s->ra_window = MIN(MAX(s->ra_window * 2, RA_MIN_WINDOW), RA_MAX_WINDOW);
+
+    /* Stop at cached or free blocks and at the end of the disk.
+     * Bitmap is only consulted if it is cached not to fault here */
+    blockno_t count = 1;
+    while (count < s->ra_window) {
+        blockno_t b = blockno + count;
+        if (b >= super->s_nblocks) break;
+        if (is_page_present(diskaddr(b)) || read_slot(b) >= 0) break;
+        if (bitmap && is_page_present(&bitmap[b / 32]) && block_is_free(b)) break;
+        count++;
+    }
+
+    s->ra_start = blockno + 1;
+    s->ra_end = blockno + count;
+    return count;
+}
+
+/* Write count blocks starting at blockno with a single command
+ * and map them read-only again */
+void
+bc_write_blocks(blockno_t blockno, blockno_t count) {
+    void *addr = blockaddr(blockno);
+
+    int res = nvme_write(blockno * BLKSECTS, addr, count * BLKSECTS);
+    if (res != NVME_OK)
+        panic("flush_block of va %p failed: writing\n", addr);
+    res = sys_map_region(CURENVID, addr, CURENVID, addr, count * BLKSIZE,
+                         PTE_SYSCALL & get_prot(addr) & ~PROT_W);
+    if (res)
+        panic("flush_block of va %p failed: clearing PTE_D\n", addr);
+
+    for (blockno_t i = 0; i < count; i++)
+        CLRBIT(dirty_map, blockno + i);
+    bc_stats.wb_io++;
+    bc_stats.wb_blocks += count;
+}
+
+/* Drop blocks that were already written back from dirty_list
+ * and sort the rest so that adjacent blocks can be merged.
+ * A block dirtied again after write back or bc_drop() is listed
+ * twice, so duplicates are dropped too. */
+static void
+dirty_compact(void) {
+    size_t n = 0;
+    for (size_t i = 0; i < ndirty; i++)
+        if (TSTBIT(dirty_map, dirty_list[i])) dirty_list[n++] = dirty_list[i];
+    ndirty = n;
+
+    for (size_t gap = ndirty / 2; gap; gap /= 2) {
+        for (size_t i = gap; i < ndirty; i++) {
+            blockno_t b = dirty_list[i];
+            size_t j = i;
+            for (; j >= gap && dirty_list[j - gap] > b; j -= gap)
+                dirty_list[j] = dirty_list[j - gap];
+            dirty_list[j] = b;
+        }
+    }
+
+    n = 0;
+    for (size_t i = 0; i < ndirty; i++)
+        if (!n || dirty_list[n - 1] != dirty_list[i]) dirty_list[n++] = dirty_list[i];
+    ndirty = n;
+}
+
+/* Account one more dirty metadata block for the next transaction,
+ * writing committed blocks home first if it would not fit in the log */
+static void
+reserve_meta(void) {
+    if (journal_pending() + nmeta >= journal_capacity()) bc_checkpoint();
+    nmeta++;
+}
+
+/* Mark block as holding metadata or not */
+void
+bc_set_meta(blockno_t blockno, bool meta) {
+    if (meta) {
+        if (journal_active() && TSTBIT(dirty_map, blockno) && !TSTBIT(meta_map, blockno))
+            reserve_meta();
+        SETBIT(meta_map, blockno);
+    } else {
+        CLRBIT(meta_map, blockno);
+        journal_forget(blockno);
+    }
+}
+
+/* Metadata writes are deferred until commit when journal is on */
+static bool
+deferred(blockno_t blockno) {
+    return journal_active() && TSTBIT(meta_map, blockno);
+}
+
+static void
+mark_dirty(blockno_t blockno) {
+    if (TSTBIT(dirty_map, blockno)) return;
+
+    if (deferred(blockno)) reserve_meta();
+    if (ndirty == DIRTY_MAX) dirty_compact();
+    if (ndirty == DIRTY_MAX) bc_sync();
+    if (!ndirty) dirty_since = vsys_gettime();
+
+    SETBIT(dirty_map, blockno);
+    dirty_list[ndirty++] = blockno;
+}
+
+/* Make cached block writable and add it to the dirty set */
+static void
+make_dirty(blockno_t blockno) {
+    void *addr = blockaddr(blockno);
+
+    mark_dirty(blockno);
+    mark_used(blockno);
+    int res = sys_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE,
+                             PTE_SYSCALL & (get_prot(addr) | PROT_W));
+    if (res)
+        panic("bc: can't make block %08x writable: %i", blockno, res);
+}
+
+/* Read count blocks starting at blockno into the cache with one command.
+ * Returns number of blocks read, which is less than count only if the
+ * controller refused the transfer and the first block was read alone. */
+static blockno_t
+bc_read(blockno_t blockno, blockno_t count) {
+    void *addr = blockaddr(blockno);
+
+    int res = sys_alloc_region(CURENVID, addr, count * BLKSIZE, PROT_RW);
+    if (res)
+        panic("bc_read: can't alloc memmory! %i", res);
+    /* sys_alloc_region() allocates pages lazily, so addr's corresponding physical address is
+     * zero_page_raw address (see pmap.c). Below nvme_read() will take this physical address and
+     * pass in to NVMe controller as an address to deliver data to. This way zero_page_raw will be
+     * corrupted and simultaneously used as reference for all blocks. To avoid this we need to map
+     * addr not lazily. The simpliest way to do this is to write something on it.
+     * P.S.: Do we have any syscalls to map pages not lazily? Seems that no =( */
+    /* TLDR: lazy allocation doesn't work with NVMe because it uses physical address directly */
+    for (blockno_t i = 0; i < count; i++)
+        *((char *)addr + i * BLKSIZE) = 0;
+
+    res = nvme_read(blockno * BLKSECTS, addr, count * BLKSECTS);
+    if (res != NVME_OK && count > 1) {
+        /* Controller may limit transfer size, retry first block alone */
+        sys_unmap_region(CURENVID, addr + BLKSIZE, (count - 1) * BLKSIZE);
+        count = 1;
+        res = nvme_read(blockno * BLKSECTS, addr, BLKSECTS);
+    }
+    if (res != NVME_OK)
+        panic("bc_read of block %08x failed\n", blockno);
+
+    /* Blocks are in sync with disk now, so clear PTE_D set by the write above.
+     * This lets the kernel drop the pages under memory pressure.
+     * Pages are mapped read-only to catch the first write */
+    res = sys_map_region(CURENVID, addr, CURENVID, addr, count * BLKSIZE,
+                         PTE_SYSCALL & get_prot(addr) & ~PROT_W);
+    if (res)
+        panic("bc_read of block %08x failed: clearing PTE_D\n", blockno);
+    note_resident(blockno, count);
+    return count;
+}
+
+/* Wait for read in flight in given slot, or let
+ * the server suspend the request instead */
+static void
+bc_wait(int slot) {
+    if (bc_suspend) bc_suspend(slot);
+    read_wait(slot);
+}
+
 /* Fault any disk block that is read in to memory by
- * loading it from disk. */
+ * loading it from disk.  Blocks following it are read
+ * in the same command if access looks sequential.
+ *
+ * If the server set bc_suspend, the read is only submitted
+ * and bc_suspend is called instead of waiting for it.
+ *
+ * This is the fallback for code touching DISKMAP directly,
+ * bc_get() loads blocks without the trip through the fault
+ * upcall. */
 static bool
 bc_pgfault(struct UTrapframe *utf) {
     void *addr = (void *)utf->utf_fault_va;
@@ -28,58 +474,337 @@ bc_pgfault(struct UTrapframe *utf) {
     if (super && blockno >= super->s_nblocks)
         panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
 
-    /* Allocate a page in the disk map region, read the contents
-     * of the block from the disk into that page.
-     * Hint: first round addr to page boundary. fs/ide.c has code to read
-     * the disk. */
     addr = ROUNDDOWN(addr, BLKSIZE);
-    int res = sys_alloc_region(CURENVID, addr, BLKSIZE, PROT_RW);
-    if (res)
-        panic("bc_pgfault: can't alloc memmory! %i", res);
-    /* sys_alloc_region() allocates pages lazily, so addr's corresponding physical address is
-     * zero_page_raw address (see pmap.c). Below nvme_read() will take this physical address and
-     * pass in to NVMe controller as an address to deliver data to. This way zero_page_raw will be
-     * corrupted and simultaneously used as reference for all blocks. To avoid this we need to map
-     * addr not lazily. The simpliest way to do this is to write something on it.
-     * P.S.: Do we have any syscalls to map pages not lazily? Seems that no =( */
-    /* TLDR: lazy allocation doesn't work with NVMe because it uses physical address directly */
-    *(char *)addr = 0;
+    if (is_page_present(addr)) {
+        /* First write to a clean block */
+        if (!(utf->utf_err & FEC_W)) return 0;
+        make_dirty(blockno);
+        return 1;
+    }
 
-    res = nvme_read(blockno * BLKSECTS, addr, BLKSECTS);
-    if (res != NVME_OK)
-        panic("bc_pgfault on va %p failed: reading\n", addr);
+    int slot = read_slot(blockno);
+    if (slot >= 0) {
+        bc_wait(slot);
+        return 1;
+    }
+
+    blockno_t count = super ? ra_window(blockno) : 1;
+    if (bc_suspend && (slot = read_start(blockno, count)) >= 0)
+        bc_suspend(slot);
+
+    blockno_t n = bc_read(blockno, count);
+    if (n < count) {
+        ra_last->ra_start = ra_last->ra_end = blockno + n;
+        count = n;
+    }
+
+    bc_stats.faults++;
+    if (count > 1) {
+        bc_stats.ra_io++;
+        bc_stats.ra_blocks += count - 1;
+        for (blockno_t b = blockno + 1; b < blockno + count; b++)
+            SETBIT(ra_map, b);
+    }
+
+    /* Save another fault if the block is about to be written */
+    if (utf->utf_err & FEC_W) make_dirty(blockno);
 
     return 1;
 }
 
+/* Load blocks among count blocks starting with blockno that are
+ * not cached yet, reading adjacent blocks with a single command.
+ * Unlike touching them this needs no page fault upcalls. */
+void
+bc_load(blockno_t blockno, blockno_t count) {
+    for (blockno_t i = 0; i < count;) {
+        blockno_t b = blockno + i;
+        if (is_page_present(blockaddr(b))) {
+            i++;
+            continue;
+        }
+
+        int slot = read_slot(b);
+        if (slot >= 0) {
+            bc_wait(slot);
+            continue;
+        }
+
+        blockno_t n = 1;
+        while (i + n < count && n < RA_MAX_WINDOW && !is_page_present(blockaddr(b + n)) &&
+               read_slot(b + n) < 0) n++;
+
+        if (bc_suspend && (slot = read_start(b, n)) >= 0)
+            bc_suspend(slot);
+
+        n = bc_read(b, n);
+        bc_stats.direct_reads += n;
+        i += n;
+    }
+}
+
+/* Return address of cached block, loading it first if needed.
+ * Flags are:
+ *  BC_WRITE  - the block is going to be modified, make it
+ *              writable and dirty now instead of on first write.
+ *  BC_NOREAD - the block is going to be overwritten as a whole,
+ *              so don't read it from disk.  Implies BC_WRITE.
+ *  BC_META   - the block holds metadata, see bc_set_meta().
+ * Release the block with bc_put() when done with it. */
+void *
+bc_get(blockno_t blockno, int flags) {
+    void *addr = diskaddr(blockno);
+
+    if (flags & BC_META) bc_set_meta(blockno, 1);
+    if (flags & BC_NOREAD) flags |= BC_WRITE;
+
+    if (!is_page_present(addr)) {
+        if ((flags & BC_NOREAD) && read_slot(blockno) < 0) {
+            int res = sys_alloc_region(CURENVID, addr, BLKSIZE, PROT_RW);
+            if (res)
+                panic("bc_get: can't alloc memmory! %i", res);
+            note_resident(blockno, 1);
+            mark_dirty(blockno);
+            return addr;
+        }
+        bc_load(blockno, 1);
+    } else {
+        bc_touch(blockno, 1);
+    }
+
+    if ((flags & BC_WRITE) && !TSTBIT(dirty_map, blockno))
+        make_dirty(blockno);
+    return addr;
+}
+
+/* Release block returned by bc_get().  Blocks are only evicted
+ * between requests, and an evicted block is loaded again by
+ * bc_pgfault() if its address is used later, so this only marks
+ * the block recently used. */
+void
+bc_put(void *blk) {
+    assert(blk >= (void *)DISKMAP && blk < (void *)(DISKMAP + DISKSIZE));
+    mark_used(((uintptr_t)blk - DISKMAP) / BLKSIZE);
+}
+
+/* Note use of count blocks starting with blockno, which is
+ * a hit for each of them that is cached */
+void
+bc_touch(blockno_t blockno, blockno_t count) {
+    for (blockno_t b = blockno; b < blockno + count; b++) {
+        mark_used(b);
+        if (TSTBIT(resident_map, b)) bc_stats.hits++;
+    }
+}
+
+/* Never evict count blocks starting with blockno */
+void
+bc_pin(blockno_t blockno, blockno_t count) {
+    for (blockno_t b = blockno; b < blockno + count; b++)
+        SETBIT(pin_map, b);
+}
+
+/* Let count blocks starting with blockno be evicted again */
+void
+bc_unpin(blockno_t blockno, blockno_t count) {
+    for (blockno_t b = blockno; b < blockno + count; b++)
+        CLRBIT(pin_map, b);
+}
+
+/* Count blocks starting with blockno are not going to be used
+ * soon: clear their reference bits and move the hand to them,
+ * so that they are evicted first */
+void
+bc_cold(blockno_t blockno, blockno_t count) {
+    for (blockno_t b = blockno; b < blockno + count; b++)
+        CLRBIT(ref_map, b);
+    clock_hand = blockno;
+}
+
+/* Next resident block at or after blockno, wrapping around
+ * the end of disk.  Returns 0 if nothing is resident. */
+static blockno_t
+next_resident(blockno_t blockno) {
+    blockno_t nwords = CEILDIV(super->s_nblocks, 32), wi = blockno / 32;
+    uint32_t word = resident_map[wi] & (~0U << (blockno % 32));
+    for (blockno_t n = 0; !word && n < nwords; n++) {
+        wi = (wi + 1) % nwords;
+        word = resident_map[wi];
+    }
+    return word ? wi * 32 + __builtin_ctz(word) : 0;
+}
+
+/* Drop clean blocks not used since the hand passed them last time
+ * until at most 'low' blocks are left.  Called between requests
+ * with BC_LIMIT_LOW once the cache grows past BC_LIMIT.  Dirty blocks are
+ * written back first, except metadata waiting for journal commit.
+ * Gives up after two turns of the hand, which is enough to clear
+ * all reference bits, and syncs if nothing could be evicted. */
+void
+bc_evict(uint64_t low) {
+    for (int pass = 0; pass < 2 && bc_stats.resident > low; pass++) {
+        uint64_t budget = 2 * bc_stats.resident;
+        while (bc_stats.resident > low && budget--) {
+            blockno_t b = next_resident(clock_hand);
+            if (!b) return;
+            clock_hand = b + 1 < super->s_nblocks ? b + 1 : 0;
+
+            void *addr = blockaddr(b);
+            if (!is_page_present(addr)) {
+                /* Dropped by the kernel */
+                drop_resident(b);
+                continue;
+            }
+            if (TSTBIT(pin_map, b)) continue;
+            if (TSTBIT(ref_map, b)) {
+                CLRBIT(ref_map, b);
+                continue;
+            }
+            /* Block mapped by a client through FSREQ_MAP must stay,
+             * or the client would keep a frame the cache no longer uses */
+            if (sys_region_refs(addr, BLKSIZE) > 1) continue;
+            if (TSTBIT(dirty_map, b)) {
+                if (deferred(b)) continue;
+                bc_write_blocks(b, 1);
+            }
+
+            sys_unmap_region(CURENVID, addr, BLKSIZE);
+            drop_resident(b);
+            bc_stats.evictions++;
+        }
+
+        /* Only metadata not home yet is left */
+        if (bc_stats.resident > low) bc_checkpoint();
+    }
+}
+
+/* Forget cached copies of count blocks starting with blockno without
+ * writing them back, so that they are read from disk on next use.
+ * Used for journal log blocks, which are only read by replay, and
+ * by tests to see what is on disk as if the server restarted. */
+void
+bc_drop(blockno_t blockno, blockno_t count) {
+    for (blockno_t b = blockno; b < blockno + count; b++) {
+        CLRBIT(dirty_map, b);
+        sys_unmap_region(CURENVID, blockaddr(b), BLKSIZE);
+        if (TSTBIT(resident_map, b)) drop_resident(b);
+    }
+}
+
 /* Flush the contents of the block containing VA out to disk if
- * necessary, then clear the PTE_D bit using sys_map_region().
+ * it is in the dirty set, then map it read-only clearing PTE_D.
  * If the block is not in the block cache or is not dirty, does
- * nothing.
- * Hint: Use is_page_present(), is_page_dirty(), and ide_write().
- * Hint: Use the PTE_SYSCALL constant when calling sys_map_region().
- * Hint: Don't forget to round addr down. */
+ * nothing. */
 void
 flush_block(void *addr) {
     blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
-    int res;
 
     if (addr < (void *)(uintptr_t)DISKMAP || addr >= (void *)(uintptr_t)(DISKMAP + DISKSIZE))
         panic("flush_block of bad va %p", addr);
     if (blockno && super && blockno >= super->s_nblocks)
         panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
 
-    addr = ROUNDDOWN(addr, BLKSIZE);
-    if (!is_page_present(addr) || !is_page_dirty(addr))
+    if (!TSTBIT(dirty_map, blockno) || deferred(blockno)) return;
+    bc_write_blocks(blockno, 1);
+
+    assert(!is_page_dirty(ROUNDDOWN(addr, BLKSIZE)));
+}
+
+/* Flush dirty blocks among count blocks starting with blockno,
+ * adjacent dirty blocks are written together */
+void
+flush_blocks(blockno_t blockno, blockno_t count) {
+    for (blockno_t i = 0; i < count;) {
+        if (!TSTBIT(dirty_map, blockno + i) || deferred(blockno + i)) {
+            i++;
+            continue;
+        }
+        blockno_t n = 1;
+        while (i + n < count && n < WB_MAX_RUN && TSTBIT(dirty_map, blockno + i + n) &&
+               !deferred(blockno + i + n)) n++;
+        bc_write_blocks(blockno + i, n);
+        i += n;
+    }
+}
+
+/* Write runs of adjacent blocks from sorted list */
+static void
+write_list(blockno_t *list, size_t count) {
+    for (size_t i = 0; i < count;) {
+        size_t n = 1;
+        while (i + n < count && n < WB_MAX_RUN && list[i + n] == list[i] + n) n++;
+        bc_write_blocks(list[i], n);
+        i += n;
+    }
+}
+
+/* Write back every dirty block.  Costs O(dirty)
+ *
+ * With journal on, data blocks are written first, so that committed
+ * metadata never refers to stale data.  Then dirty metadata blocks
+ * are committed as one transaction and left in the cache mapped
+ * read-only, they are written home by bc_checkpoint(). */
+void
+bc_sync(void) {
+    dirty_compact();
+    if (!journal_active()) {
+        write_list(dirty_list, ndirty);
+        ndirty = nmeta = 0;
         return;
-    res = nvme_write(blockno * BLKSECTS, addr, BLKSECTS);
-    if (res != NVME_OK)
-        panic("flush_block of va %p failed: writing\n", addr);
-    res = sys_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE, PTE_SYSCALL & get_prot(addr));
-    if (res)
-        panic("flush_block of va %p failed: clearing PTE_D\n", addr);
+    }
+
+    /* Write data, leaving only metadata in dirty_list */
+    size_t count = 0;
+    for (size_t i = 0; i < ndirty;) {
+        if (TSTBIT(meta_map, dirty_list[i])) {
+            dirty_list[count++] = dirty_list[i++];
+            continue;
+        }
+        size_t n = 1;
+        while (i + n < ndirty && n < WB_MAX_RUN && dirty_list[i + n] == dirty_list[i] + n &&
+               !TSTBIT(meta_map, dirty_list[i + n])) n++;
+        bc_write_blocks(dirty_list[i], n);
+        i += n;
+    }
 
-    assert(!is_page_dirty(addr));
+    ndirty = nmeta = 0;
+    if (!count) return;
+
+    journal_commit(dirty_list, count);
+    for (size_t i = 0; i < count; i++) {
+        void *addr = blockaddr(dirty_list[i]);
+        int res = sys_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE,
+                                 PTE_SYSCALL & get_prot(addr) & ~PROT_W);
+        if (res) panic("bc: can't map committed block %08x: %i", dirty_list[i], res);
+        CLRBIT(dirty_map, dirty_list[i]);
+    }
+    commit_time = vsys_gettime();
+    bc_stats.commits++;
+    bc_stats.logged_blocks += journal_pending();
+}
+
+/* Write back every dirty block and write committed
+ * metadata home, leaving nothing for replay */
+void
+bc_checkpoint(void) {
+    bc_sync();
+    if (!journal_pending()) return;
+    journal_checkpoint();
+    bc_stats.checkpoints++;
+}
+
+/* Called by the server between requests: write back dirty blocks
+ * if there are too many of them or they are dirty for too long,
+ * write committed metadata home once nothing was committed for a
+ * while, and shrink the cache if it grew past BC_LIMIT */
+void
+bc_writeback(void) {
+    int now = vsys_gettime();
+    if (ndirty >= WB_THRESHOLD || (ndirty && now - dirty_since >= WB_INTERVAL))
+        bc_sync();
+    else if (!ndirty && journal_pending() && now - commit_time >= WB_INTERVAL)
+        bc_checkpoint();
+    if (super && bc_stats.resident > BC_LIMIT) bc_evict(BC_LIMIT_LOW);
 }
 
 /* Test that the block cache works, by smashing the superblock and
@@ -99,6 +824,7 @@ check_bc(void) {
 
     /* Clear it out */
     sys_unmap_region(0, diskaddr(1), PAGE_SIZE);
+    drop_resident(1);
     assert(!is_page_present(diskaddr(1)));
 
     /* Read it back in */
@@ -117,6 +843,10 @@ bc_init(void) {
     add_pgfault_handler(bc_pgfault);
     check_bc();
 
+    /* Clean cached blocks can be read again from disk */
+    if (sys_set_cache_region(CURENVID, (void *)DISKMAP, DISKSIZE))
+        panic("bc_init: can't declare block cache region");
+
     /* Cache the super block by reading it once */
     memmove(&super, diskaddr(1), sizeof super);
 }
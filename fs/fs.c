@@ -8,6 +8,27 @@ struct Super *super;
 /* Bitmap blocks mapped in memory */
 uint32_t *bitmap;
 
+/* Number of free blocks in every group of BLKGROUPSIZE blocks,
+ * lets allocator skip full parts of the disk.  Largest free run of
+ * a group (group_run blocks at group_run_start) is found again only
+ * when extent allocation asks for it after the group changed */
+static uint16_t group_free[DISKSIZE / BLKSIZE / BLKGROUPSIZE];
+static uint16_t group_run[DISKSIZE / BLKSIZE / BLKGROUPSIZE];
+static blockno_t group_run_start[DISKSIZE / BLKSIZE / BLKGROUPSIZE];
+static uint32_t group_stale[(DISKSIZE / BLKSIZE / BLKGROUPSIZE + 31) / 32];
+/* Block following the last allocated one */
+static blockno_t alloc_cursor;
+
+/* Number of cached directory lookups */
+#define DCACHE_SIZE 128
+
+/* Recent (directory, name) -> file lookups done by walk_path() */
+static struct Dentry {
+    struct File *d_dir; /* NULL if entry is unused */
+    struct File *d_file;
+    char d_name[MAXNAMELEN];
+} dcache[DCACHE_SIZE];
+
 /****************************************************************
  *                         Super block
  ****************************************************************/
@@ -42,29 +63,157 @@ void
 free_block(blockno_t blockno) {
     /* Blockno zero is the null pointer of block numbers. */
     if (blockno == 0) panic("attempt to free zero block");
+    if (!TSTBIT(bitmap, blockno)) group_free[blockno / BLKGROUPSIZE]++;
     SETBIT(bitmap, blockno);
+    SETBIT(group_stale, blockno / BLKGROUPSIZE);
+    bc_set_meta(blockno, 0);
+    /* Cached contents of free block are of no use */
+    bc_cold(blockno, 1);
+}
+
+/* Free bits of wi'th 64-bit bitmap word,
+ * bits for blocks past the end of disk are masked out */
+static uint64_t
+bitmap_word(blockno_t wi) {
+    uint64_t word = ((uint64_t *)bitmap)[wi];
+    if ((wi + 1) * 64 > super->s_nblocks)
+        word &= (1ULL << (super->s_nblocks % 64)) - 1;
+    return word;
+}
+
+/* Find free block at or after goal wrapping around the end of disk.
+ * Returns 0 if there are no free blocks */
+static blockno_t
+find_free_block(blockno_t goal) {
+    blockno_t nwords = CEILDIV(super->s_nblocks, 64);
+    blockno_t wi = goal / 64;
+
+    /* Word containing goal is visited twice, before
+     * and after wrapping, to check bits below goal */
+    for (blockno_t n = 0; n <= nwords; n++, wi = (wi + 1) % nwords) {
+        /* Skip groups without free blocks */
+        if (!(wi % (BLKGROUPSIZE / 64)) && !group_free[wi * 64 / BLKGROUPSIZE]) {
+            blockno_t skip = MIN(BLKGROUPSIZE / 64, nwords - wi) - 1;
+            n += skip;
+            wi += skip;
+            continue;
+        }
+
+        uint64_t word = bitmap_word(wi);
+        if (!n) word &= ~0ULL << (goal % 64);
+        if (word) return wi * 64 + __builtin_ctzll(word);
+    }
+
+    return 0;
+}
+
+/* Find the largest run of free blocks within group */
+static void
+group_scan(blockno_t group) {
+    blockno_t end = MIN((group + 1) * BLKGROUPSIZE, super->s_nblocks);
+    blockno_t run = 0, best = 0, best_end = 0;
+
+    for (blockno_t wi = group * BLKGROUPSIZE / 64; wi * 64 < end; wi++) {
+        uint64_t word = bitmap_word(wi);
+        if (word == ~0ULL) {
+            run += 64;
+        } else {
+            for (int bit = 0; bit < 64; bit++) {
+                if (word >> bit & 1) {
+                    run++;
+                    continue;
+                }
+                if (run > best) best = run, best_end = wi * 64 + bit;
+                run = 0;
+            }
+        }
+        if (run > best) best = run, best_end = (wi + 1) * 64;
+    }
+
+    group_run[group] = best;
+    group_run_start[group] = best_end - best;
+    CLRBIT(group_stale, group);
+}
+
+/* Find start of free run of at least count blocks in the first group at
+ * or after the one containing goal.  If no group has such a run, the
+ * largest run found is returned, 0 if there are no free blocks */
+static blockno_t
+find_free_group(blockno_t goal, blockno_t count) {
+    blockno_t ngroups = CEILDIV(super->s_nblocks, BLKGROUPSIZE);
+    blockno_t group = goal / BLKGROUPSIZE, best = 0, best_run = 0;
+
+    count = MIN(count, BLKGROUPSIZE);
+    for (blockno_t n = 0; n < ngroups; n++, group = (group + 1) % ngroups) {
+        /* Free count bounds the largest run */
+        if (group_free[group] <= best_run) continue;
+        if (TSTBIT(group_stale, group)) group_scan(group);
+        if (group_run[group] >= count) return group_run_start[group];
+        if (group_run[group] > best_run) {
+            best_run = group_run[group];
+            best = group_run_start[group];
+        }
+    }
+
+    return best;
 }
 
-/* Search the bitmap for a free block and allocate it.  When you
- * allocate a block, immediately flush the changed bitmap block
- * to disk.
+/* Allocate up to count physically contiguous blocks.
+ * Blocks starting at goal are preferred so that consecutive
+ * blocks of a file end up next to each other on disk.
+ * Sets *len to number of blocks allocated.
  *
- * Return block number allocated on success,
- * 0 if we are out of blocks.
+ * Bitmap blocks are not flushed here, see flush_bitmap().
+ *
+ * Returns first allocated block number on success,
+ * 0 if we are out of blocks. */
+blockno_t
+alloc_extent(blockno_t goal, blockno_t count, blockno_t *len) {
+    blockno_t nblocks = super->s_nblocks, start = 0;
+    if (goal >= nblocks) goal = alloc_cursor;
+    if (goal >= nblocks) goal = 0;
+
+    if (TSTBIT(bitmap, goal))
+        start = goal;
+    else if (count > 1)
+        start = find_free_group(goal, count);
+    if (!start && !(start = find_free_block(goal)))
+        return 0;
+
+    blockno_t n = 0;
+    for (; n < count && start + n < nblocks && TSTBIT(bitmap, start + n); n++) {
+        CLRBIT(bitmap, start + n);
+        group_free[(start + n) / BLKGROUPSIZE]--;
+        SETBIT(group_stale, (start + n) / BLKGROUPSIZE);
+    }
+
+    alloc_cursor = start + n;
+    *len = n;
+    return start;
+}
+
+/* Allocate single block close to goal */
+blockno_t
+alloc_block_near(blockno_t goal) {
+    blockno_t len;
+    return alloc_extent(goal, 1, &len);
+}
+
+/* Search the bitmap for a free block and allocate it.
  *
- * Hint: use free_block as an example for manipulating the bitmap. */
+ * Return block number allocated on success,
+ * 0 if we are out of blocks. */
 blockno_t
 alloc_block(void) {
-    /* The bitmap consists of one or more blocks.  A single bitmap block
-     * contains the in-use bits for BLKBITSIZE blocks.  There are
-     * super->s_nblocks blocks in the disk altogether. */
-    for (blockno_t cur_block = 0; cur_block < super->s_nblocks; cur_block++)
-        if (block_is_free(cur_block)) {
-            CLRBIT(bitmap, cur_block);
-            flush_block(&bitmap[cur_block / 32]);
-            return cur_block;
-        }
-    return 0;
+    return alloc_block_near(alloc_cursor);
+}
+
+/* Write modified bitmap blocks to disk. This is done before
+ * metadata referencing newly allocated blocks is flushed
+ * instead of after every single allocation */
+void
+flush_bitmap(void) {
+    flush_blocks(2, CEILDIV(super->s_nblocks, BLKBITSIZE));
 }
 
 /* Validate the file system bitmap.
@@ -94,17 +243,34 @@ check_bitmap(void) {
 void
 fs_init(void) {
     static_assert(sizeof(struct File) == 256, "Unsupported file size");
+    static_assert(offsetof(struct File, f_direct) == 136, "Block pointers moved");
+    static_assert(offsetof(struct File, f_dirindex) == 248, "Directory index moved");
 
     bc_init();
 
-    /* Set "super" to point to the super block. */
-    super = diskaddr(1);
+    /* Set "super" to point to the super block,
+     * which holds root directory node. */
+    super = bc_get(1, BC_META);
     check_super();
+    journal_init();
+
+    /* Set "bitmap" to the beginning of the first bitmap block
+     * and load the whole bitmap at once, it is scanned by allocator. */
+    blockno_t nbitmap = CEILDIV(super->s_nblocks, BLKBITSIZE);
+    bc_load(2, nbitmap);
+    bitmap = bc_get(2, BC_META);
+    for (blockno_t i = 0; i < nbitmap; i++)
+        bc_set_meta(2 + i, 1);
 
-    /* Set "bitmap" to the beginning of the first bitmap block. */
-    bitmap = diskaddr(2);
+    /* Accessed all the time, keep them in memory */
+    bc_pin(1, 1 + nbitmap);
 
     check_bitmap();
+
+    /* Build free block summary, free runs are found on demand */
+    for (blockno_t wi = 0; wi * 64 < super->s_nblocks; wi++)
+        group_free[wi * 64 / BLKGROUPSIZE] += __builtin_popcountll(bitmap_word(wi));
+    memset(group_stale, 0xFF, sizeof(group_stale));
 }
 
 /* Find the disk block number slot for the 'filebno'th block in file 'f'.
@@ -121,11 +287,13 @@ fs_init(void) {
  *  -E_NO_DISK if there's no space on the disk for an indirect block.
  *  -E_INVAL if filebno is out of range (it's >= NDIRECT + NINDIRECT).
  *
+ * Only used for block pointer layout, see file_block_lookup().
+ *
  * Analogy: This is like pgdir_walk for files.
  * Hint: Don't forget to clear any block you allocate. */
 int
 file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc) {
-    if (filebno >= NDIRECT + NINDIRECT)
+    if (filebno >= NDIRECT + NINDIRECT || super->s_features & FS_FEATURE_EXTENTS)
         return -E_INVAL;
 
     if (filebno < NDIRECT)
@@ -136,13 +304,214 @@ file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool a
                 return -E_NOT_FOUND;
 
             blockno_t new_block;
-            if (!(new_block = alloc_block()))
+            if (!(new_block = alloc_block_near(f->f_direct[NDIRECT - 1] + 1)))
                 return -E_NO_DISK;
-            
+
+            void *blk = bc_get(new_block, BC_NOREAD | BC_META);
+            memset(blk, 0, BLKSIZE);
+            bc_put(blk);
             f->f_indirect = new_block;
-            memset(diskaddr(f->f_indirect), 0, BLKSIZE);
         }
-        *ppdiskbno = (blockno_t *)diskaddr(f->f_indirect) + filebno - NDIRECT;
+        *ppdiskbno = (blockno_t *)bc_get(f->f_indirect, BC_META) + filebno - NDIRECT;
+    }
+    return 0;
+}
+
+/* Returns pointer to i'th extent of file f */
+static struct Extent *
+file_extent(struct File *f, uint32_t i) {
+    if (i < NINLINEEXT) return &f->f_extents[i];
+    return (struct Extent *)bc_get(f->f_extblock, BC_META) + (i - NINLINEEXT);
+}
+
+/* Returns index of the first extent of file f
+ * that ends after filebno (binary search) */
+static uint32_t
+file_extent_find(struct File *f, blockno_t filebno) {
+    uint32_t lo = 0, hi = f->f_nextents;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        struct Extent *ext = file_extent(f, mid);
+        if (ext->e_fileblock + ext->e_len <= filebno)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static void
+file_extent_remove(struct File *f, uint32_t i) {
+    for (; i + 1 < f->f_nextents; i++)
+        *file_extent(f, i) = *file_extent(f, i + 1);
+    memset(file_extent(f, --f->f_nextents), 0, sizeof(struct Extent));
+
+    if (f->f_nextents <= NINLINEEXT && f->f_extblock) {
+        free_block(f->f_extblock);
+        f->f_extblock = 0;
+    }
+}
+
+/* Add extent for unallocated file blocks [filebno, filebno + count)
+ * backed by disk blocks starting at diskbno, merging it with
+ * neighbours when they are contiguous on disk */
+static int
+file_extent_insert(struct File *f, blockno_t filebno, blockno_t diskbno, blockno_t count) {
+    uint32_t i = file_extent_find(f, filebno);
+    struct Extent *prev = i ? file_extent(f, i - 1) : NULL;
+    struct Extent *next = i < f->f_nextents ? file_extent(f, i) : NULL;
+    bool join_next = next && next->e_fileblock == filebno + count && next->e_diskblock == diskbno + count;
+
+    if (prev && prev->e_fileblock + prev->e_len == filebno && prev->e_diskblock + prev->e_len == diskbno) {
+        prev->e_len += count;
+        if (join_next) {
+            prev->e_len += next->e_len;
+            file_extent_remove(f, i);
+        }
+        return 0;
+    }
+    if (join_next) {
+        next->e_fileblock = filebno;
+        next->e_diskblock = diskbno;
+        next->e_len += count;
+        return 0;
+    }
+
+    if (f->f_nextents == NINLINEEXT + NBLKEXT) return -E_NO_DISK;
+    if (f->f_nextents == NINLINEEXT) {
+        blockno_t new_block;
+        if (!(new_block = alloc_block()))
+            return -E_NO_DISK;
+
+        void *blk = bc_get(new_block, BC_NOREAD | BC_META);
+        memset(blk, 0, BLKSIZE);
+        bc_put(blk);
+        f->f_extblock = new_block;
+    }
+
+    for (uint32_t j = f->f_nextents; j > i; j--)
+        *file_extent(f, j) = *file_extent(f, j - 1);
+    f->f_nextents++;
+
+    struct Extent *ext = file_extent(f, i);
+    ext->e_fileblock = filebno;
+    ext->e_diskblock = diskbno;
+    ext->e_len = count;
+    return 0;
+}
+
+/* Disk block of filebno'th block of file f with block pointer layout,
+ * unallocated indirect block is reported as unallocated block */
+static int
+file_block_pointer(struct File *f, blockno_t filebno, blockno_t *diskbno) {
+    blockno_t *pdiskbno;
+    int res = file_block_walk(f, filebno, &pdiskbno, 0);
+    if (res == -E_NOT_FOUND) {
+        *diskbno = 0;
+        return 0;
+    }
+    if (res < 0) return res;
+
+    *diskbno = *pdiskbno;
+    return 0;
+}
+
+/* Find disk block backing filebno'th block of file f.
+ * Sets *diskbno to it (or to 0 if the block is not allocated)
+ * and *run to number of file blocks starting from filebno
+ * that are contiguous on disk (or that are all unallocated).
+ *
+ * Returns 0 on success, -E_INVAL if filebno is out of range. */
+int
+file_block_lookup(struct File *f, blockno_t filebno, blockno_t *diskbno, blockno_t *run) {
+    if (super->s_features & FS_FEATURE_EXTENTS) {
+        if (filebno >= MAXEXTFILESIZE / BLKSIZE) return -E_INVAL;
+
+        uint32_t i = file_extent_find(f, filebno);
+        struct Extent *ext = i < f->f_nextents ? file_extent(f, i) : NULL;
+        if (ext && ext->e_fileblock <= filebno) {
+            *diskbno = ext->e_diskblock + (filebno - ext->e_fileblock);
+            *run = ext->e_len - (filebno - ext->e_fileblock);
+        } else {
+            *diskbno = 0;
+            *run = (ext ? ext->e_fileblock : MAXEXTFILESIZE / BLKSIZE) - filebno;
+        }
+        return 0;
+    }
+
+    int res = file_block_pointer(f, filebno, diskbno);
+    if (res < 0) return res;
+
+    blockno_t next;
+    *run = 1;
+    while (!file_block_pointer(f, filebno + *run, &next) && next == (*diskbno ? *diskbno + *run : 0))
+        (*run)++;
+    return 0;
+}
+
+/* Make unallocated file blocks [filebno, filebno + count)
+ * point to disk blocks starting at diskbno */
+static int
+file_set_blocks(struct File *f, blockno_t filebno, blockno_t diskbno, blockno_t count) {
+    if (super->s_features & FS_FEATURE_EXTENTS)
+        return file_extent_insert(f, filebno, diskbno, count);
+
+    for (blockno_t i = 0; i < count; i++) {
+        blockno_t *pdiskbno;
+        int res = file_block_walk(f, filebno + i, &pdiskbno, 1);
+        if (res < 0) return res;
+        *pdiskbno = diskbno + i;
+    }
+    return 0;
+}
+
+/* Set *blk to the address in memory where the run of up to *count
+ * blocks of file 'f' starting at filebno'th is mapped.  Blocks
+ * contiguous on disk are contiguous in block cache too, so the whole
+ * run is accessible through *blk.  An unallocated block is allocated
+ * and returned alone.  Sets *count to the length of the run.
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_NO_DISK if a block needed to be allocated but the disk is full.
+ *  -E_INVAL if filebno is out of range or the file is inline. */
+int
+file_get_blocks(struct File *f, blockno_t filebno, blockno_t *count, char **blk) {
+    blockno_t diskbno, run;
+    bool fresh = 0;
+    if (file_inline(f)) return -E_INVAL;
+
+    int res = file_block_lookup(f, filebno, &diskbno, &run);
+    if (res < 0) return res;
+
+    if (!diskbno) {
+        /* Place block right after the previous block of the file */
+        blockno_t goal = alloc_cursor, prev;
+        if (filebno && !file_block_lookup(f, filebno - 1, &prev, &run) && prev)
+            goal = prev + 1;
+
+        if (!(diskbno = alloc_block_near(goal)))
+            return -E_NO_DISK;
+        if ((res = file_set_blocks(f, filebno, diskbno, 1)) < 0) {
+            free_block(diskbno);
+            return res;
+        }
+        run = 1;
+        fresh = 1;
+    }
+
+    *count = MIN(*count, run);
+    *blk = (char *)diskaddr(diskbno);
+    bc_touch(diskbno, *count);
+
+    /* Directory blocks hold struct File of their entries and are
+     * loaded directly, new ones are cleared by dir_alloc_file() */
+    if (f->f_type == FTYPE_DIR) {
+        if (fresh) {
+            bc_get(diskbno, BC_NOREAD | BC_META);
+            return 0;
+        }
+        bc_load(diskbno, *count);
+        for (blockno_t i = 0; i < *count; i++) bc_set_meta(diskbno + i, 1);
     }
     return 0;
 }
@@ -152,24 +521,103 @@ file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool a
  *
  * Returns 0 on success, < 0 on error.  Errors are:
  *  -E_NO_DISK if a block needed to be allocated but the disk is full.
- *  -E_INVAL if filebno is out of range.
- *
- * Hint: Use file_block_walk and alloc_block. */
+ *  -E_INVAL if filebno is out of range. */
 int
 file_get_block(struct File *f, blockno_t filebno, char **blk) {
-    int errno;
-    blockno_t *pdiskbno;
-    if ((errno = file_block_walk(f, filebno, &pdiskbno, 1)))
-        return errno;
+    blockno_t count = 1;
+    return file_get_blocks(f, filebno, &count, blk);
+}
 
-    if (!*pdiskbno) {
-        blockno_t new_block;
-            if (!(new_block = alloc_block()))
-                return -E_NO_DISK;
+/* Set *file to the directory entry in given slot of dir */
+static int
+dir_slot(struct File *dir, uint32_t slot, struct File **file) {
+    char *blk;
+    int res = file_get_block(dir, slot / BLKFILES, &blk);
+    if (res < 0) return res;
+
+    *file = (struct File *)blk + slot % BLKFILES;
+    return 0;
+}
+
+/* Returns head of hash chain for name in index of dir */
+static uint32_t *
+dir_bucket(struct File *dir, const char *name) {
+    return (uint32_t *)bc_get(dir->f_dirindex, BC_META) + dirindex_hash(name) % DIRINDEX_BUCKETS;
+}
+
+/* Link named entry in given slot of dir into its hash chain */
+static void
+dir_index_add(struct File *dir, struct File *file, uint32_t slot) {
+    if (!dir->f_dirindex) return;
+
+    uint32_t *head = dir_bucket(dir, file->f_name);
+    file->f_hashnext = *head;
+    *head = slot + 1;
+}
+
+/* Unlink entry of dir from its hash chain */
+static int
+dir_index_remove(struct File *dir, struct File *file) {
+    if (!dir->f_dirindex) return 0;
+
+    /* struct File is packed, so track previous entry instead of link pointer */
+    uint32_t *head = dir_bucket(dir, file->f_name);
+    struct File *prev = NULL;
+    for (uint32_t slot = *head; slot;) {
+        struct File *f;
+        int res = dir_slot(dir, slot - 1, &f);
+        if (res < 0) return res;
+
+        if (f == file) {
+            if (prev)
+                prev->f_hashnext = file->f_hashnext;
+            else
+                *head = file->f_hashnext;
+            break;
+        }
+        prev = f;
+        slot = f->f_hashnext;
+    }
+    file->f_hashnext = 0;
+    return 0;
+}
 
-        *pdiskbno = new_block;
+/* Build hash index for directory written without one */
+static int
+dir_build_index(struct File *dir) {
+    /* Read directory in first, so that a request suspended
+     * on a block cache miss is restarted before anything changes.
+     * file_get_blocks() loads directory blocks. */
+    blockno_t nblock = dir->f_size / BLKSIZE;
+    for (blockno_t i = 0; i < nblock;) {
+        blockno_t n = nblock - i;
+        char *blk;
+        int res = file_get_blocks(dir, i, &n, &blk);
+        if (res < 0) return res;
+        i += n;
     }
-    *blk = (char *)diskaddr(*pdiskbno);
+
+    blockno_t index = alloc_block();
+    if (!index) return -E_NO_DISK;
+    void *blk = bc_get(index, BC_NOREAD | BC_META);
+    memset(blk, 0, BLKSIZE);
+    bc_put(blk);
+    dir->f_dirindex = index;
+
+    for (uint32_t slot = 0; slot < dir->f_size / BLKSIZE * BLKFILES; slot++) {
+        struct File *f;
+        int res = dir_slot(dir, slot, &f);
+        if (res < 0) {
+            dir->f_dirindex = 0;
+            free_block(index);
+            return res;
+        }
+
+        f->f_hashnext = 0;
+        if (f->f_name[0]) dir_index_add(dir, f, slot);
+    }
+
+    file_flush(dir);
     return 0;
 }
 
@@ -184,6 +632,20 @@ dir_lookup(struct File *dir, const char *name, struct File **file) {
      * is always a multiple of the file system's block size. */
     assert((dir->f_size % BLKSIZE) == 0);
     blockno_t nblock = dir->f_size / BLKSIZE;
+
+    /* Index only pays off for directories larger than a block,
+     * if it cannot be built fall back to linear search */
+    if (!dir->f_dirindex && nblock > 1) dir_build_index(dir);
+
+    if (dir->f_dirindex) {
+        for (uint32_t slot = *dir_bucket(dir, name); slot; slot = (*file)->f_hashnext) {
+            int res = dir_slot(dir, slot - 1, file);
+            if (res < 0) return res;
+            if (!strcmp((*file)->f_name, name)) return 0;
+        }
+        return -E_NOT_FOUND;
+    }
+
     for (blockno_t i = 0; i < nblock; i++) {
         char *blk;
         int res = file_get_block(dir, i, &blk);
@@ -199,10 +661,11 @@ dir_lookup(struct File *dir, const char *name, struct File **file) {
     return -E_NOT_FOUND;
 }
 
-/* Set *file to point at a free File structure in dir.  The caller is
+/* Set *file to point at a free File structure in dir
+ * and *slot to its position in dir.  The caller is
  * responsible for filling in the File fields. */
 static int
-dir_alloc_file(struct File *dir, struct File **file) {
+dir_alloc_file(struct File *dir, struct File **file, uint32_t *slot) {
     char *blk;
 
     assert((dir->f_size % BLKSIZE) == 0);
@@ -215,6 +678,7 @@ dir_alloc_file(struct File *dir, struct File **file) {
         for (blockno_t j = 0; j < BLKFILES; j++) {
             if (f[j].f_name[0] == '\0') {
                 *file = &f[j];
+                *slot = i * BLKFILES + j;
                 return 0;
             }
         }
@@ -223,10 +687,43 @@ dir_alloc_file(struct File *dir, struct File **file) {
     int res = file_get_block(dir, nblock, &blk);
     if (res < 0) return res;
 
+    /* Block may hold stale data of some removed file */
+    memset(blk, 0, BLKSIZE);
     *file = (struct File *)blk;
+    *slot = nblock * BLKFILES;
     return 0;
 }
 
+static struct Dentry *
+dcache_entry(struct File *dir, const char *name) {
+    return &dcache[(dirindex_hash(name) ^ (uintptr_t)dir / sizeof(struct File)) % DCACHE_SIZE];
+}
+
+/* Forget cached lookup of name in dir */
+static void
+dcache_invalidate(struct File *dir, const char *name) {
+    struct Dentry *d = dcache_entry(dir, name);
+    if (d->d_dir == dir && !strcmp(d->d_name, name)) d->d_dir = NULL;
+}
+
+/* Like dir_lookup(), but consult dentry cache first */
+static int
+dir_lookup_cached(struct File *dir, const char *name, struct File **file) {
+    struct Dentry *d = dcache_entry(dir, name);
+    if (d->d_dir == dir && !strcmp(d->d_name, name)) {
+        *file = d->d_file;
+        return 0;
+    }
+
+    int res = dir_lookup(dir, name, file);
+    if (!res) {
+        d->d_dir = dir;
+        d->d_file = *file;
+        strcpy(d->d_name, name);
+    }
+    return res;
+}
+
 /* Skip over slashes. */
 static const char *
 skip_slash(const char *p) {
@@ -272,7 +769,7 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
         if (dir->f_type != FTYPE_DIR)
             return -E_NOT_FOUND;
 
-        if ((r = dir_lookup(dir, name, &f)) < 0) {
+        if ((r = dir_lookup_cached(dir, name, &f)) < 0) {
             if (r == -E_NOT_FOUND && *path == '\0') {
                 if (pdir)
                     *pdir = dir;
@@ -301,12 +798,15 @@ file_create(const char *path, struct File **pf) {
     char name[MAXNAMELEN];
     int res;
     struct File *dir, *filp;
+    uint32_t slot;
 
     if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
     if (res != -E_NOT_FOUND || dir == 0) return res;
-    if ((res = dir_alloc_file(dir, &filp)) < 0) return res;
+    if ((res = dir_alloc_file(dir, &filp, &slot)) < 0) return res;
 
     strcpy(filp->f_name, name);
+    dir_index_add(dir, filp, slot);
+    dcache_invalidate(dir, name);
     *pf = filp;
     file_flush(dir);
     return 0;
@@ -331,11 +831,18 @@ file_read(struct File *f, void *buf, size_t count, off_t offset) {
 
     count = MIN(count, f->f_size - offset);
 
+    if (file_inline(f)) {
+        memmove(buf, f->f_inline + offset, count);
+        return count;
+    }
+
     for (off_t pos = offset; pos < offset + count;) {
-        int r = file_get_block(f, pos / BLKSIZE, &blk);
+        /* Copy whole run of contiguous blocks at once */
+        blockno_t nblk = CEILDIV(offset + count, BLKSIZE) - pos / BLKSIZE;
+        int r = file_get_blocks(f, pos / BLKSIZE, &nblk, &blk);
         if (r < 0) return r;
 
-        int bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+        int bn = MIN(nblk * BLKSIZE - pos % BLKSIZE, offset + count - pos);
         memmove(buf, blk + pos % BLKSIZE, bn);
         pos += bn;
         buf += bn;
@@ -344,6 +851,38 @@ file_read(struct File *f, void *buf, size_t count, off_t offset) {
     return count;
 }
 
+/* Allocate missing blocks [start, end) of file f
+ * in as few contiguous extents as possible */
+static int
+file_alloc_range(struct File *f, blockno_t start, blockno_t end) {
+    int res;
+
+    for (blockno_t bno = start; bno < end;) {
+        blockno_t diskbno, run;
+        if ((res = file_block_lookup(f, bno, &diskbno, &run)) < 0) return res;
+        run = MIN(run, end - bno);
+        if (diskbno) {
+            bno += run;
+            continue;
+        }
+
+        blockno_t goal = alloc_cursor, prev, len;
+        if (bno && !file_block_lookup(f, bno - 1, &prev, &len) && prev)
+            goal = prev + 1;
+
+        blockno_t first = alloc_extent(goal, run, &len);
+        if (!first) return -E_NO_DISK;
+
+        if ((res = file_set_blocks(f, bno, first, len)) < 0) {
+            while (len--) free_block(first + len);
+            return res;
+        }
+        bno += len;
+    }
+
+    return 0;
+}
+
 /* Write count bytes from buf into f, starting at seek position
  * offset.  This is meant to mimic the standard pwrite function.
  * Extends the file if necessary.
@@ -356,11 +895,19 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset) {
     if (offset + count > f->f_size)
         if ((res = file_set_size(f, offset + count)) < 0) return res;
 
+    if (file_inline(f)) {
+        memmove(f->f_inline + offset, buf, count);
+        return count;
+    }
+
+    if ((res = file_alloc_range(f, offset / BLKSIZE, CEILDIV(offset + count, BLKSIZE))) < 0) return res;
+
     for (off_t pos = offset; pos < offset + count;) {
         char *blk;
-        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+        blockno_t nblk = CEILDIV(offset + count, BLKSIZE) - pos / BLKSIZE;
+        if ((res = file_get_blocks(f, pos / BLKSIZE, &nblk, &blk)) < 0) return res;
 
-        blockno_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+        blockno_t bn = MIN(nblk * BLKSIZE - pos % BLKSIZE, offset + count - pos);
         memmove(blk + pos % BLKSIZE, buf, bn);
         pos += bn;
         buf += bn;
@@ -397,6 +944,27 @@ static void
 file_truncate_blocks(struct File *f, off_t newsize) {
     blockno_t old_nblocks = CEILDIV(f->f_size, BLKSIZE);
     blockno_t new_nblocks = CEILDIV(newsize, BLKSIZE);
+
+    if (file_inline(f)) return;
+
+    if (super->s_features & FS_FEATURE_EXTENTS) {
+        /* Free whole extents from the end, trimming the last one */
+        while (f->f_nextents) {
+            struct Extent *ext = file_extent(f, f->f_nextents - 1);
+            if (ext->e_fileblock + ext->e_len <= new_nblocks) break;
+
+            blockno_t keep = ext->e_fileblock < new_nblocks ? new_nblocks - ext->e_fileblock : 0;
+            for (blockno_t i = keep; i < ext->e_len; i++)
+                free_block(ext->e_diskblock + i);
+            if (keep) {
+                ext->e_len = keep;
+                break;
+            }
+            file_extent_remove(f, f->f_nextents - 1);
+        }
+        return;
+    }
+
     for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
         int res = file_free_block(f, bno);
         if (res < 0) cprintf("warning: file_free_block: %i", res);
@@ -408,12 +976,80 @@ file_truncate_blocks(struct File *f, off_t newsize) {
     }
 }
 
-/* Set the size of file f, truncating or extending as necessary. */
+/* Whether a file of given size would keep its data inline */
+static bool
+fits_inline(struct File *f, off_t size) {
+    return super->s_features & FS_FEATURE_INLINE &&
+           f->f_type == FTYPE_REG && size <= FILE_INLINE_MAX;
+}
+
+/* Whether data of file f is stored in struct File instead of blocks */
+bool
+file_inline(struct File *f) {
+    return fits_inline(f, f->f_size);
+}
+
+/* Move data of inline file f to its first block as it grows to newsize */
+static int
+file_uninline(struct File *f, off_t newsize) {
+    uint8_t data[FILE_INLINE_MAX];
+    off_t size = f->f_size;
+
+    memcpy(data, f->f_inline, size);
+    memset(f->f_inline, 0, sizeof(f->f_inline));
+    f->f_size = newsize;
+    if (!size) return 0;
+
+    char *blk;
+    int res = file_get_block(f, 0, &blk);
+    if (res < 0) {
+        memcpy(f->f_inline, data, size);
+        f->f_size = size;
+        return res;
+    }
+    memcpy(blk, data, size);
+    memset(blk + size, 0, BLKSIZE - size);
+    return 0;
+}
+
+/* Move data of file f from its first block into struct File
+ * and free its blocks as it shrinks to inline newsize */
+static void
+file_make_inline(struct File *f, off_t newsize) {
+    uint8_t data[FILE_INLINE_MAX] = {0};
+    blockno_t diskbno, run;
+
+    if (newsize && !file_block_lookup(f, 0, &diskbno, &run) && diskbno)
+        memcpy(data, diskaddr(diskbno), newsize);
+
+    file_truncate_blocks(f, 0);
+    memcpy(f->f_inline, data, sizeof(data));
+    f->f_size = newsize;
+}
+
+/* Set the size of file f, truncating or extending as necessary.
+ * Data is moved between struct File and blocks when the file
+ * crosses FILE_INLINE_MAX. */
 int
 file_set_size(struct File *f, off_t newsize) {
-    if (f->f_size > newsize)
-        file_truncate_blocks(f, newsize);
-    f->f_size = newsize;
+    bool was_inline = file_inline(f);
+    bool now_inline = fits_inline(f, newsize);
+
+    if (was_inline && !now_inline) {
+        int res = file_uninline(f, newsize);
+        if (res < 0) return res;
+    } else if (now_inline && !was_inline) {
+        file_make_inline(f, newsize);
+    } else if (now_inline) {
+        if (f->f_size > newsize)
+            memset(f->f_inline + newsize, 0, f->f_size - newsize);
+        f->f_size = newsize;
+    } else {
+        if (f->f_size > newsize)
+            file_truncate_blocks(f, newsize);
+        f->f_size = newsize;
+    }
+    flush_bitmap();
     flush_block(f);
     return 0;
 }
@@ -424,23 +1060,69 @@ file_set_size(struct File *f, off_t newsize) {
  * and then check whether that disk block is dirty.  If so, write it out. */
 void
 file_flush(struct File *f) {
-    blockno_t *pdiskbno;
+    blockno_t nblocks = CEILDIV(f->f_size, BLKSIZE), diskbno, run;
 
-    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
-        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
-            pdiskbno == NULL || *pdiskbno == 0)
-            continue;
-        flush_block(diskaddr(*pdiskbno));
+    flush_bitmap();
+    if (file_inline(f)) {
+        flush_block(f);
+        return;
     }
-    if (f->f_indirect)
+
+    for (blockno_t i = 0; i < nblocks; i += run) {
+        if (file_block_lookup(f, i, &diskbno, &run) < 0) break;
+        run = MIN(run, nblocks - i);
+        if (diskbno) flush_blocks(diskbno, run);
+    }
+    if (super->s_features & FS_FEATURE_EXTENTS) {
+        if (f->f_extblock)
+            flush_block(diskaddr(f->f_extblock));
+    } else if (f->f_indirect)
         flush_block(diskaddr(f->f_indirect));
+    if (f->f_type == FTYPE_DIR && f->f_dirindex)
+        flush_block(diskaddr(f->f_dirindex));
     flush_block(f);
 }
 
+/* Remove regular file "path".
+ * Returns 0 on success, < 0 on error. */
+int
+file_remove(const char *path) {
+    struct File *dir, *f;
+    int res;
+
+    if ((res = walk_path(path, &dir, &f, 0)) < 0) return res;
+    if (!dir) return -E_INVAL;
+    if (f->f_type != FTYPE_REG) return -E_NOT_SUPP;
+
+    dcache_invalidate(dir, f->f_name);
+    if ((res = dir_index_remove(dir, f)) < 0) return res;
+
+    file_truncate_blocks(f, 0);
+    memset(f, 0, sizeof(*f));
+    file_flush(dir);
+    return 0;
+}
+
+/* Whether file with given name is linked into hash chain of dir */
+bool
+dir_index_has(struct File *dir, const char *name, struct File *file) {
+    struct File *f;
+    for (uint32_t slot = *dir_bucket(dir, name); slot; slot = f->f_hashnext) {
+        if (dir_slot(dir, slot - 1, &f) < 0) return 0;
+        if (f == file) return 1;
+    }
+    return 0;
+}
+
+/* File found by cached lookup of name in dir, NULL if not cached */
+struct File *
+dcache_cached(struct File *dir, const char *name) {
+    struct Dentry *d = dcache_entry(dir, name);
+    return d->d_dir == dir && !strcmp(d->d_name, name) ? d->d_file : NULL;
+}
+
 /* Sync the entire file system.  A big hammer. */
 void
 fs_sync(void) {
-    for (int i = 1; i < super->s_nblocks; i++) {
-        flush_block(diskaddr(i));
-    }
+    bc_sync();
 }
@@ -11,29 +11,98 @@
 /* Maximum disk size we can handle (3GB) */
 #define DISKSIZE 0xC0000000
 
+/* Number of blocks summarized by one free block counter */
+#define BLKGROUPSIZE 4096
+
 extern struct Super *super; /* superblock */
 extern uint32_t *bitmap;    /* bitmap blocks mapped in memory */
 
+/* Block cache counters */
+struct BcStats {
+    uint64_t faults;        /* blocks read on demand */
+    uint64_t async_reads;   /* reads not waited for */
+    uint64_t ra_io;         /* reads that also fetched following blocks */
+    uint64_t ra_blocks;     /* blocks read ahead */
+    uint64_t ra_hits;       /* read ahead blocks used */
+    uint64_t ra_waste;      /* read ahead blocks not used in time */
+    uint64_t wb_io;         /* write commands */
+    uint64_t wb_blocks;     /* blocks written back */
+    uint64_t commits;       /* journal transactions */
+    uint64_t logged_blocks; /* blocks written to journal */
+    uint64_t checkpoints;   /* journal checkpoints */
+    uint64_t direct_reads;  /* blocks loaded by bc_get() and bc_load() */
+    uint64_t hits;          /* uses of blocks that were cached */
+    uint64_t evictions;     /* blocks dropped to stay within the limit */
+    uint64_t resident;      /* blocks in memory now */
+};
+
+/* Flags of bc_get() */
+#define BC_WRITE  0x1 /* Block is going to be modified */
+#define BC_NOREAD 0x2 /* Block is going to be overwritten, don't read it */
+#define BC_META   0x4 /* Block holds metadata */
+
+extern struct BcStats bc_stats;
+
+/* Set by the server while handling a request that can be restarted.
+ * Called instead of waiting for a read submitted in given slot,
+ * must not return */
+extern void (*bc_suspend)(int slot);
+
 /* bc.c */
 void *diskaddr(blockno_t blockno);
+void *bc_get(blockno_t blockno, int flags);
+void bc_put(void *blk);
+void bc_load(blockno_t blockno, blockno_t count);
+void bc_touch(blockno_t blockno, blockno_t count);
+void bc_pin(blockno_t blockno, blockno_t count);
+void bc_unpin(blockno_t blockno, blockno_t count);
+void bc_cold(blockno_t blockno, blockno_t count);
+void bc_evict(uint64_t low);
+void bc_drop(blockno_t blockno, blockno_t count);
 void flush_block(void *addr);
+void flush_blocks(blockno_t blockno, blockno_t count);
+void bc_write_blocks(blockno_t blockno, blockno_t count);
+void bc_set_meta(blockno_t blockno, bool meta);
+void bc_sync(void);
+void bc_checkpoint(void);
+void bc_writeback(void);
+int bc_poll(void);
+bool bc_pending(void);
+
+/* journal.c */
+void journal_init(void);
+bool journal_active(void);
+size_t journal_capacity(void);
+size_t journal_pending(void);
+void journal_forget(blockno_t blockno);
+void journal_commit(blockno_t *blocks, size_t count);
+void journal_checkpoint(void);
 void bc_init(void);
 
 /* fs.c */
 void fs_init(void);
 int file_get_block(struct File *f, blockno_t file_blockno, char **pblk);
+int file_get_blocks(struct File *f, blockno_t file_blockno, blockno_t *count, char **pblk);
+int file_block_lookup(struct File *f, blockno_t filebno, blockno_t *diskbno, blockno_t *run);
 int file_create(const char *path, struct File **f);
 int file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc);
 int file_open(const char *path, struct File **f);
 ssize_t file_read(struct File *f, void *buf, size_t count, off_t offset);
 ssize_t file_write(struct File *f, const void *buf, size_t count, off_t offset);
 int file_set_size(struct File *f, off_t newsize);
+bool file_inline(struct File *f);
 void file_flush(struct File *f);
 int file_remove(const char *path);
 void fs_sync(void);
 
 bool block_is_free(blockno_t blockno);
 blockno_t alloc_block(void);
+void free_block(blockno_t blockno);
+blockno_t alloc_block_near(blockno_t goal);
+blockno_t alloc_extent(blockno_t goal, blockno_t count, blockno_t *len);
+void flush_bitmap(void);
+bool dir_index_has(struct File *dir, const char *name, struct File *file);
+struct File *dcache_cached(struct File *dir, const char *name);
 
 /* test.c */
 void fs_test(void);
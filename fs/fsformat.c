@@ -41,6 +41,11 @@ struct Dir {
 };
 
 uint32_t nblocks;
+/* Write files with extent-based layout */
+int use_extents;
+int use_journal;
+/* Store small files in struct File */
+int use_inline;
 char *diskmap, *diskpos;
 struct Super *super;
 uint32_t *bitmap;
@@ -106,10 +111,22 @@ opendisk(const char *name) {
     super->s_nblocks = nblocks;
     super->s_root.f_type = FTYPE_DIR;
     strcpy(super->s_root.f_name, "/");
+    if (use_extents)
+        super->s_features |= FS_FEATURE_EXTENTS;
+    if (use_inline)
+        super->s_features |= FS_FEATURE_INLINE;
 
     nbitblocks = (nblocks + BLKBITSIZE - 1) / BLKBITSIZE;
     bitmap = alloc(nbitblocks * BLKSIZE);
     memset(bitmap, 0xFF, nbitblocks * BLKSIZE);
+
+    if (use_journal) {
+        struct JournalHeader *jh = alloc(JOURNAL_BLOCKS * BLKSIZE);
+        jh->j_magic = JOURNAL_MAGIC;
+        super->s_journal = blockof(jh);
+        super->s_journal_len = JOURNAL_BLOCKS;
+        super->s_features |= FS_FEATURE_JOURNAL;
+    }
 }
 
 void
@@ -128,6 +145,16 @@ finishfile(struct File *f, uint32_t start, uint32_t len) {
     int i;
     f->f_size = len;
     len = ROUNDUP(len, BLKSIZE);
+    if (use_extents) {
+        /* Files are written contiguously, so one extent is enough */
+        if (len) {
+            f->f_extents[0].e_fileblock = 0;
+            f->f_extents[0].e_diskblock = start;
+            f->f_extents[0].e_len = len / BLKSIZE;
+            f->f_nextents = 1;
+        }
+        return;
+    }
     for (i = 0; i < len / BLKSIZE && i < NDIRECT; ++i)
         f->f_direct[i] = start + i;
     if (i == NDIRECT) {
@@ -161,6 +188,15 @@ finishdir(struct Dir *d) {
     struct File *start = alloc(size);
     memmove(start, d->ents, size);
     finishfile(d->f, blockof(start), ROUNDUP(size, BLKSIZE));
+
+    /* Hash chains of directory index, slot numbers are stored plus one */
+    uint32_t *index = alloc(BLKSIZE);
+    for (int i = 0; i < d->n; i++) {
+        uint32_t *head = &index[dirindex_hash(start[i].f_name) % DIRINDEX_BUCKETS];
+        start[i].f_hashnext = *head;
+        *head = i + 1;
+    }
+    d->f->f_dirindex = blockof(index);
     free(d->ents);
     d->ents = NULL;
 }
@@ -179,7 +215,7 @@ writefile(struct Dir *dir, const char *name) {
         panic("stat %s: %s", name, strerror(errno));
     if (!S_ISREG(st.st_mode))
         panic("%s is not a regular file", name);
-    if (st.st_size >= MAXFILESIZE)
+    if (st.st_size >= (use_extents ? MAXEXTFILESIZE : MAXFILESIZE))
         panic("%s too large", name);
 
     last = strrchr(name, '/');
@@ -189,6 +225,13 @@ writefile(struct Dir *dir, const char *name) {
         last = name;
 
     f = diradd(dir, FTYPE_REG, last);
+    if (use_inline && st.st_size <= FILE_INLINE_MAX) {
+        memset(f->f_inline, 0, sizeof(f->f_inline));
+        readn(fd, f->f_inline, st.st_size);
+        f->f_size = st.st_size;
+        close(fd);
+        return;
+    }
     start = alloc(st.st_size);
     readn(fd, start, st.st_size);
     finishfile(f, blockof(start), st.st_size);
@@ -197,7 +240,7 @@ writefile(struct Dir *dir, const char *name) {
 
 void
 usage(void) {
-    fprintf(stderr, "Usage: fsformat fs.img NBLOCKS files...\n");
+    fprintf(stderr, "Usage: fsformat [-e] [-j] [-i] fs.img NBLOCKS files...\n");
     exit(2);
 }
 
@@ -209,6 +252,17 @@ main(int argc, char **argv) {
 
     assert(BLKSIZE % sizeof(struct File) == 0);
 
+    for (; argc > 1 && argv[1][0] == '-'; argc--, argv++) {
+        if (!strcmp(argv[1], "-e"))
+            use_extents = 1;
+        else if (!strcmp(argv[1], "-j"))
+            use_journal = 1;
+        else if (!strcmp(argv[1], "-i"))
+            use_inline = 1;
+        else
+            usage();
+    }
+
     if (argc < 3)
         usage();
 
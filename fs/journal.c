@@ -0,0 +1,224 @@
+/* Write-ahead journal for file system metadata.
+ *
+ * Metadata blocks (bitmap, directory blocks holding struct File,
+ * indirect, extent and index blocks) are not written in place as they
+ * change.  bc_sync() commits all metadata blocks that are not home yet
+ * as one transaction written with a single command, and leaves them in
+ * the cache.  Since every transaction holds all metadata missing at
+ * home, replay only needs the latest one, and the two halves of the
+ * log are used in turn.  bc_checkpoint() writes the blocks home once
+ * the log would overflow or nothing changed for a while, and only then
+ * the header at s_journal is advanced past the transaction.
+ *
+ * Flushes order the writes: data before the transaction referring to
+ * it, transaction before home locations, home locations before the
+ * header that makes replay skip them. */
+
+#include "fs.h"
+#include "nvme.h"
+
+static bool journal_on;
+/* Last committed transaction */
+static uint32_t journal_seq;
+
+/* Sorted blocks of the last transaction, which are not home yet.
+ * Blocks freed since the commit are cleared in logged_map only,
+ * nlogged may count them until the next commit. */
+static blockno_t logged[JOURNAL_MAXBLOCKS];
+static size_t nlogged;
+static uint32_t logged_map[DISKSIZE / BLKSIZE / 32];
+
+bool
+journal_active(void) {
+    return journal_on;
+}
+
+/* Number of blocks in each half of the log */
+static blockno_t
+journal_half(void) {
+    return (super->s_journal_len - 1) / 2;
+}
+
+/* First block of the half used by transaction seq */
+static blockno_t
+journal_start(uint32_t seq) {
+    return super->s_journal + 1 + (seq % 2) * journal_half();
+}
+
+/* Maximal number of blocks per transaction */
+size_t
+journal_capacity(void) {
+    return MIN(journal_half() - 1, JOURNAL_MAXBLOCKS);
+}
+
+/* Number of committed blocks not home yet, may count freed ones */
+size_t
+journal_pending(void) {
+    return journal_on ? nlogged : 0;
+}
+
+/* Block was freed, its contents need not reach home */
+void
+journal_forget(blockno_t blockno) {
+    CLRBIT(logged_map, blockno);
+}
+
+/* FNV-1a over home locations and logged blocks following jh */
+static uint32_t
+journal_sum(struct JournalHeader *jh) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (uint32_t i = 0; i < jh->j_nblocks; i++)
+        hash = (hash ^ jh->j_home[i]) * 1099511628211ULL;
+
+    uint64_t *data = (uint64_t *)((char *)jh + BLKSIZE);
+    for (size_t i = 0; i < jh->j_nblocks * BLKSIZE / sizeof(*data); i++)
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+    return hash ^ hash >> 32;
+}
+
+static void
+journal_flush(void) {
+    int res = nvme_flush();
+    if (res != NVME_OK) panic("journal: flush failed: %i", res);
+}
+
+/* Commit sorted list of count changed metadata blocks together with
+ * blocks of the last transaction, which are not home yet.  Blocks are
+ * mapped read-only into the log after the header, so the transaction
+ * is written with one command without copying.  These mappings also
+ * keep the kernel from reclaiming blocks that look clean in page
+ * tables but are not home yet, until the next transaction maps them
+ * again or the checkpoint.  Transaction is never split, callers keep
+ * it within journal_capacity() with journal_pending(). */
+void
+journal_commit(blockno_t *blocks, size_t count) {
+    assert(journal_on && count);
+
+    uint32_t seq = journal_seq + 1;
+    blockno_t log = journal_start(seq);
+    struct JournalHeader *jh = diskaddr(log);
+
+    int res = sys_alloc_region(CURENVID, jh, BLKSIZE, PROT_RW);
+    if (res) panic("journal: can't map header: %i", res);
+
+    /* Merge both sorted lists into the header */
+    size_t n = 0, i = 0, j = 0;
+    while (i < nlogged || j < count) {
+        blockno_t b;
+        if (j == count || (i < nlogged && logged[i] < blocks[j])) {
+            /* Blocks freed since the commit are left out */
+            b = logged[i++];
+            if (!TSTBIT(logged_map, b)) continue;
+        } else {
+            b = blocks[j++];
+            if (i < nlogged && logged[i] == b) i++;
+        }
+        if (n == journal_capacity())
+            panic("journal: transaction does not fit in %zu blocks", journal_capacity());
+        jh->j_home[n++] = b;
+    }
+
+    for (i = 0; i < n; i++) {
+        res = sys_map_region(CURENVID, diskaddr(jh->j_home[i]), CURENVID, diskaddr(log + 1 + i), BLKSIZE, PROT_R);
+        if (res) panic("journal: can't map block %08x: %i", jh->j_home[i], res);
+    }
+
+    jh->j_magic = JOURNAL_MAGIC;
+    jh->j_seq = seq;
+    jh->j_nblocks = n;
+    jh->j_sum = journal_sum(jh);
+
+    journal_flush();
+    res = nvme_write(log * BLKSECTS, jh, (count + 1) * BLKSECTS);
+    if (res != NVME_OK) panic("journal: can't write transaction %u: %i", seq, res);
+    journal_flush();
+    journal_seq = seq;
+
+    for (i = 0; i < n; i++) SETBIT(logged_map, jh->j_home[i]);
+    memcpy(logged, jh->j_home, n * sizeof(blockno_t));
+    nlogged = n;
+
+    /* Previous transaction is superseded */
+    sys_unmap_region(CURENVID, diskaddr(journal_start(seq + 1)), journal_half() * BLKSIZE);
+}
+
+/* Write blocks of the last transaction to their home locations and
+ * record that replay has to skip it.  None of them may be changed
+ * since the commit, so bc_checkpoint() commits first. */
+void
+journal_checkpoint(void) {
+    assert(journal_on);
+    for (size_t i = 0; i < nlogged;) {
+        size_t n = 1;
+        if (!TSTBIT(logged_map, logged[i])) {
+            i++;
+            continue;
+        }
+        while (i + n < nlogged && logged[i + n] == logged[i] + n && TSTBIT(logged_map, logged[i + n])) n++;
+        bc_write_blocks(logged[i], n);
+        i += n;
+    }
+    for (size_t i = 0; i < nlogged; i++) CLRBIT(logged_map, logged[i]);
+    nlogged = 0;
+
+    struct JournalHeader *jh = diskaddr(super->s_journal);
+    /* Old contents are overwritten, so there is no need to read them */
+    int res = sys_alloc_region(CURENVID, jh, BLKSIZE, PROT_RW);
+    if (res) panic("journal: can't map header: %i", res);
+    jh->j_magic = JOURNAL_MAGIC;
+    jh->j_seq = journal_seq;
+    jh->j_nblocks = 0;
+    jh->j_sum = 0;
+
+    journal_flush();
+    res = nvme_write(super->s_journal * BLKSECTS, jh, BLKSECTS);
+    if (res != NVME_OK) panic("journal: can't write header: %i", res);
+    journal_flush();
+
+    /* Nothing in the log is needed until next commit */
+    sys_unmap_region(CURENVID, jh, super->s_journal_len * BLKSIZE);
+}
+
+/* Replay the latest committed transaction unless it was
+ * checkpointed, and start journaling.  Called again by
+ * tests to see what the server would find after a crash. */
+void
+journal_init(void) {
+    if (!(super->s_features & FS_FEATURE_JOURNAL)) return;
+
+    if (super->s_journal < 2 || super->s_journal_len < 4 ||
+        super->s_journal + super->s_journal_len > super->s_nblocks)
+        panic("bad journal location %u+%u", super->s_journal, super->s_journal_len);
+
+    journal_on = 0;
+    for (size_t i = 0; i < nlogged; i++) CLRBIT(logged_map, logged[i]);
+    nlogged = 0;
+    /* Read the log from disk, not through mappings of last commit */
+    bc_drop(super->s_journal, super->s_journal_len);
+    struct JournalHeader *jh = diskaddr(super->s_journal);
+    journal_seq = jh->j_magic == JOURNAL_MAGIC ? jh->j_seq : 0;
+
+    /* Transaction torn by a crash fails the checksum */
+    struct JournalHeader *last = NULL;
+    for (uint32_t half = 0; half < 2; half++) {
+        struct JournalHeader *t = diskaddr(journal_start(half));
+        if (t->j_magic != JOURNAL_MAGIC || t->j_seq <= journal_seq ||
+            t->j_seq % 2 != half || t->j_nblocks > journal_capacity() ||
+            t->j_sum != journal_sum(t)) continue;
+        if (!last || t->j_seq > last->j_seq) last = t;
+    }
+
+    if (last) {
+        for (uint32_t i = 0; i < last->j_nblocks; i++)
+            memmove(diskaddr(last->j_home[i]), (char *)last + (i + 1) * BLKSIZE, BLKSIZE);
+        cprintf("journal: replayed %u blocks of transaction %u\n", last->j_nblocks, last->j_seq);
+        journal_seq = last->j_seq;
+    }
+
+    /* Written in place since journaling is not on yet */
+    bc_sync();
+    bc_drop(super->s_journal, super->s_journal_len);
+
+    journal_on = 1;
+    journal_checkpoint();
+}
@@ -7,10 +7,11 @@ static int nvme_acmd_set_features(struct NvmeController *ctl, int nsid, int fid,
 static int nvme_acmd_create_cq(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, uint64_t prp);
 static int nvme_acmd_create_sq(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, uint64_t prp);
 static int nvme_acmd_identify(struct NvmeController *ctl, int nsid, uint64_t prp1, uint64_t prp2);
-static int nvme_cmd_rw(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc, int nsid, uint64_t slba, int nlb, uint64_t prp1, uint64_t prp2);
+static int nvme_cmd_rw(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc, int nsid, uint64_t slba, int nlb, const void *buf);
 
 /* NVMe Controller structure */
 static struct NvmeController nvme;
+struct NvmeStats nvme_stats;
 
 static int
 nvme_map(struct NvmeController *ctl) {
@@ -34,21 +35,23 @@ nvme_map(struct NvmeController *ctl) {
 /* Allocate memory for NVMe queues and store its virtual address */
 static int
 nvme_alloc_queues(struct NvmeController *ctl) {
+    static_assert(NVME_IO_TAGS == 32, "Command tags should fit 32-bit masks");
+
     ctl->buffer = (void *)NVME_QUEUE_VADDR;
+    ctl->prp_list = (void *)(NVME_QUEUE_VADDR + NVME_QUEUE_BUFFER_SIZE);
 
-    int r = sys_alloc_region(0, ctl->buffer, 4 * PAGE_SIZE, PROT_RW | PROT_CD);
+    /* Queues and PRP list are handed to the device by physical address,
+     * so they should be physically contiguous and must not move */
+    int r = sys_alloc_dma_region(CURENVID, ctl->buffer, NVME_QUEUE_BUFFER_CLASS, PROT_RW | PROT_CD, &ctl->buffer_pa);
     if (r < 0)
         panic("queue alloc failed");
 
-    DEBUG("NVMe page buffer allocated with pages:");
+    r = sys_alloc_dma_region(CURENVID, ctl->prp_list, NVME_PRP_LIST_CLASS, PROT_RW | PROT_CD, &ctl->prp_list_pa);
+    if (r < 0)
+        panic("PRP list alloc failed");
 
-    /* Touch buffer pages so that they does not change their addresses.
-     * They will be already zeroed by the kernel otherwise */
-    for (size_t i = 0; i < 6; i++) {
-        volatile char *page = (volatile char *)ctl->buffer + NVME_PAGE_SIZE * i;
-        *page = 0;
-        DEBUG("    va=%p, pa=%lx", page, get_phys_addr((char *)page));
-    }
+    DEBUG("NVMe page buffer allocated: va=%p, pa=%lx, prp list pa=%lx",
+          ctl->buffer, ctl->buffer_pa, ctl->prp_list_pa);
 
     return NVME_OK;
 }
@@ -600,54 +603,147 @@ nvme_acmd_create_sq(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq,
     return err;
 }
 
+/* Move completions of I/O commands from completion queue to q->done */
+static void
+nvme_reap(struct NvmeController *ctl, struct NvmeQueueAttributes *q) {
+    int stat, tag;
+    while ((tag = nvme_check_completion(ctl, q, &stat, NULL)) >= 0) {
+        if (tag >= NVME_IO_TAGS || !(q->tags & (1U << tag))) {
+            ERROR("unexpected completion of tag %#x", tag);
+            continue;
+        }
+        q->done |= 1U << tag;
+        q->status[tag] = stat;
+    }
+}
+
+/* Wait for I/O command with given tag and release the tag */
+static int
+nvme_wait_tag(struct NvmeController *ctl, struct NvmeQueueAttributes *q, int tag, int timeout) {
+    uint64_t endtsc = read_tsc() + (uint64_t)timeout * tsc_freq;
+
+    do {
+        nvme_reap(ctl, q);
+        if (q->done & (1U << tag)) {
+            q->done &= ~(1U << tag);
+            q->tags &= ~(1U << tag);
+            q->async &= ~(1U << tag);
+            return q->status[tag] ? -NVME_IOCMD_FAILED : NVME_OK;
+        }
+    } while (read_tsc() < endtsc);
+
+    return -NVME_CMD_TIMEOUT;
+}
+
+/* Fill PRP entries describing buffer 'buf' of 'len' bytes.
+ * Buffers spanning more than two pages are described with PRP list
+ * of the command tag, so every page of the buffer should already be
+ * present in memory. */
+static int
+nvme_setup_prp(struct NvmeController *ctl, int tag, const void *buf, size_t len, uint64_t *prp1, uint64_t *prp2) {
+    uintptr_t va = (uintptr_t)buf;
+    uintptr_t next = ROUNDDOWN(va, NVME_PAGE_SIZE) + NVME_PAGE_SIZE;
+    uintptr_t end = va + len;
+    uint64_t *list = ctl->prp_list + tag * (NVME_PAGE_SIZE / sizeof(uint64_t));
+
+    *prp1 = get_phys_addr((void *)va);
+    *prp2 = 0;
+    if (*prp1 == (uint64_t)-1)
+        return -NVME_BAD_ARG;
+    if (end <= next)
+        return NVME_OK;
+
+    size_t npages = (ROUNDUP(end, NVME_PAGE_SIZE) - next) / NVME_PAGE_SIZE;
+    if (npages >= ctl->ci.maxppio)
+        return -NVME_BAD_ARG;
+
+    for (size_t i = 0; i < npages; i++) {
+        uint64_t pa = get_phys_addr((void *)(next + i * NVME_PAGE_SIZE));
+        if (pa == (uint64_t)-1)
+            return -NVME_BAD_ARG;
+        list[i] = pa;
+    }
+
+    *prp2 = npages == 1 ? list[0] : ctl->prp_list_pa + tag * NVME_PAGE_SIZE;
+    return NVME_OK;
+}
+
 /**
- * NVMe submit a read write command.
+ * NVMe submit a read, write or flush command.
  * @param   ioq         io queue
  * @param   opc         op code
- * @param   cid         command id
  * @param   nsid        namespace
  * @param   slba        starting logical block address
  * @param   nlb         number of logical blocks
- * @param   prp1        PRP1 address
- * @param   prp2        PRP2 address
- * @return  0 if ok else errcode != 0.
+ * @param   buf         data buffer
+ * @return  command tag if ok else errcode < 0.
  */
 static int
 nvme_cmd_rw(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc,
-            int nsid, uint64_t slba, int nlb, uint64_t prp1, uint64_t prp2) {
-    /* Create new NvmeCmdRW in ctl->ioq[0].
-     * TIP: Look at the definition of the struct NvmeCmdRW for description of fields.
-     *      Note the 'minus 1' for nlbs.
-     * TIP: Fields common.fuse, common.psdt, mptr, prinfo, fua, lr, dsm, eilbrt, elbat
-     *      and elbatm should remain zeroed. They are not used here.
-     * TIP: Use ioq->sq_tail as cid like it is done in other commands for simplicity. */
-    int cid = ioq->sq_tail;
-    struct NvmeCmdRW * cmd = &ioq->sq[cid].rw;
+            int nsid, uint64_t slba, int nlb, const void *buf) {
+    /* Submission queue slot may only be reused once the command
+     * submitted there before is fetched, which is guaranteed
+     * while fewer than queue size commands are outstanding */
+    uint32_t free = ~ioq->tags;
+    if (!free || (uint32_t)__builtin_popcount(ioq->tags) >= ioq->size - 1)
+        return -NVME_IOCMD_FAILED;
+    int tag = __builtin_ctz(free);
+
+    /* Flush transfers no data */
+    uint64_t prp1 = 0, prp2 = 0;
+    if (opc != NVME_CMD_FLUSH) {
+        int err = nvme_setup_prp(ctl, tag, buf, (size_t)nlb << ctl->nsi.blockshift, &prp1, &prp2);
+        if (err)
+            return err;
+    }
+
+    struct NvmeCmdRW *cmd = &ioq->sq[ioq->sq_tail].rw;
     memset(cmd, 0, sizeof(struct NvmeCmdRW));
     cmd->common.opc = opc;
-    cmd->common.cid = cid;
+    cmd->common.cid = tag;
     cmd->common.nsid = nsid;
     cmd->common.prp[0] = prp1;
     cmd->common.prp[1] = prp2;
-    cmd->slba = slba;
-    cmd->nlb = nlb - 1;
+    if (opc != NVME_CMD_FLUSH) {
+        cmd->slba = slba;
+        cmd->nlb = nlb - 1;
+    }
 
     DEBUG("q = %d, sq = %d - %d, cid = %#x, nsid = %d, lba = %#lx, nb = %#x, prp = %#lx.%#lx (%c)",
-          ioq->id, ioq->sq_head, ioq->sq_tail, cid, nsid, slba, nlb, prp1, prp2,
-          opc == NVME_CMD_READ ? 'R' : 'W');
+          ioq->id, ioq->sq_head, ioq->sq_tail, tag, nsid, slba, nlb, prp1, prp2,
+          opc == NVME_CMD_READ ? 'R' : opc == NVME_CMD_WRITE ? 'W' : 'F');
+
+    ioq->tags |= 1U << tag;
+    int err = nvme_submit_cmd(ctl, ioq);
+    if (err) {
+        ioq->tags &= ~(1U << tag);
+        return err;
+    }
 
-    /* Submit the command and synchronously wait for its completion
-     * TIP: Use nvme_submit_cmd() and nvme_wait_completion(). Don't
-     *      forget to check for potential errors! */
+    if (opc == NVME_CMD_READ) {
+        nvme_stats.reads++;
+        nvme_stats.read_bytes += (uint64_t)nlb << ctl->nsi.blockshift;
+    } else if (opc == NVME_CMD_FLUSH) {
+        nvme_stats.flushes++;
+    } else {
+        nvme_stats.writes++;
+        nvme_stats.write_bytes += (uint64_t)nlb << ctl->nsi.blockshift;
+    }
+    return tag;
+}
+
+/* Submit read or write and synchronously wait for its completion.
+ * Completions of asynchronous commands seen meanwhile are
+ * kept for nvme_poll(). */
+static int
+nvme_rw_sync(struct NvmeController *ctl, int opc, uint64_t secno, size_t nsecs, const void *buf) {
     int IF = read_rflags() & FL_IF;
     if (IF)
         asm volatile("cli");
 
-    int err = -NVME_IOCMD_FAILED;
-    err = nvme_submit_cmd(ctl, ioq);
-
-    if (err == NVME_OK)
-        err = nvme_wait_completion(ctl, ioq, cid, 300);
+    int err = nvme_cmd_rw(ctl, &ctl->ioq[0], opc, ctl->nsi.id, secno, nsecs, buf);
+    if (err >= 0)
+        err = nvme_wait_tag(ctl, &ctl->ioq[0], err, 300);
 
     if (IF)
         asm volatile("sti");
@@ -660,23 +756,59 @@ nvme_write(uint64_t secno, const void *src, size_t nsecs) {
     if (!src)
         return -NVME_BAD_ARG;
 
-    return nvme_cmd_rw(&nvme, &nvme.ioq[0], NVME_CMD_WRITE,
-                       nvme.nsi.id, secno, nsecs, get_phys_addr((void *)src), 0);
+    return nvme_rw_sync(&nvme, NVME_CMD_WRITE, secno, nsecs, src);
 }
 
-
 int
 nvme_read(uint64_t secno, void *dst, size_t nsecs) {
     if (!dst)
         return -NVME_BAD_ARG;
 
-    /* Submit NVME_CMD_READ to ioq[0].
-     * TIP: This is achieved in exactly the same way as the write command.
-     *      Remember that the command takes physical address as an argument
-     *      and 'dst' is a virtual address. */
+    return nvme_rw_sync(&nvme, NVME_CMD_READ, secno, nsecs, dst);
+}
+
+/* Make writes completed so far durable: controller with
+ * volatile write cache may keep them in any order until then */
+int
+nvme_flush(void) {
+    return nvme_rw_sync(&nvme, NVME_CMD_FLUSH, 0, 0, NULL);
+}
+
+/* Submit NVME_CMD_READ without waiting for it.
+ * Returns command tag to be reported by nvme_poll(), < 0 on error. */
+int
+nvme_read_async(uint64_t secno, void *dst, size_t nsecs) {
     if (!dst)
         return -NVME_BAD_ARG;
 
-    return nvme_cmd_rw(&nvme, &nvme.ioq[0], NVME_CMD_READ,
-                       nvme.nsi.id, secno, nsecs, get_phys_addr((void *)dst), 0);
+    int IF = read_rflags() & FL_IF;
+    if (IF)
+        asm volatile("cli");
+
+    int tag = nvme_cmd_rw(&nvme, &nvme.ioq[0], NVME_CMD_READ, nvme.nsi.id, secno, nsecs, dst);
+    if (tag >= 0)
+        nvme.ioq[0].async |= 1U << tag;
+
+    if (IF)
+        asm volatile("sti");
+
+    return tag;
+}
+
+/* Returns tag of some completed asynchronous command and
+ * stores its status in *status, or -1 if none has completed */
+int
+nvme_poll(int *status) {
+    struct NvmeQueueAttributes *q = &nvme.ioq[0];
+
+    nvme_reap(&nvme, q);
+    uint32_t ready = q->done & q->async;
+    if (!ready) return -1;
+
+    int tag = __builtin_ctz(ready);
+    q->done &= ~(1U << tag);
+    q->tags &= ~(1U << tag);
+    q->async &= ~(1U << tag);
+    *status = q->status[tag] ? -NVME_IOCMD_FAILED : NVME_OK;
+    return tag;
 }
@@ -53,6 +53,13 @@
 #define NVME_QUEUE_COUNT 1
 #define NVME_AQSIZE      16
 #define NVME_PAGE_SIZE   4096
+/* Queue buffer holds 4 queues, one page each */
+#define NVME_QUEUE_BUFFER_CLASS 2
+#define NVME_QUEUE_BUFFER_SIZE  (NVME_PAGE_SIZE << NVME_QUEUE_BUFFER_CLASS)
+
+/* One PRP list page per I/O command tag */
+#define NVME_PRP_LIST_CLASS 5
+#define NVME_IO_TAGS        (1 << NVME_PRP_LIST_CLASS)
 
 #define NVME_REG32(reg, offset) (volatile uint32_t *)((uint8_t *)(reg) + offset)
 #define NVME_REG64(reg, offset) (volatile uint64_t *)((uint8_t *)(reg) + offset)
@@ -321,6 +328,14 @@ struct NvmeQueueAttributes {
     uint32_t sq_tail;     /* Submission queue tail */
     uint32_t cq_head;     /* Completion queue head */
     bool cq_phase;        /* Completion queue phase bit */
+
+    /* I/O commands are identified by tags independent from
+     * submission queue slots, so that a command may complete
+     * long after its slot was reused */
+    uint32_t tags;              /* Allocated tags */
+    uint32_t async;             /* Tags of commands nobody waits for */
+    uint32_t done;              /* Completed tags not yet reported */
+    int status[NVME_IO_TAGS];   /* Completion status of done tags */
 };
 
 struct NvmeContollerInfo {
@@ -368,14 +383,33 @@ struct NvmeController {
      * 3rd 4kB boundary is the start of I/O submission queue #1.
      * 4th 4kB boundary is the start of I/O completion queue #1. */
     uint8_t *buffer;
+    physaddr_t buffer_pa;
+
+    /* PRP lists used by I/O commands spanning more than two pages,
+     * one page per command tag */
+    uint64_t *prp_list;
+    physaddr_t prp_list_pa;
 
     struct NvmeQueueAttributes adminq;
     struct NvmeQueueAttributes ioq[NVME_QUEUE_COUNT];
 };
 
+/* I/O command counters */
+struct NvmeStats {
+    uint64_t reads;
+    uint64_t writes;
+    uint64_t read_bytes;
+    uint64_t write_bytes;
+    uint64_t flushes;
+};
+
+extern struct NvmeStats nvme_stats;
 
 int nvme_init(void);
 
 int nvme_write(uint64_t secno, const void *src, size_t nsecs);
 int nvme_read(uint64_t secno, void *dst, size_t nsecs);
+int nvme_flush(void);
+int nvme_read_async(uint64_t secno, void *dst, size_t nsecs);
+int nvme_poll(int *status);
 #endif
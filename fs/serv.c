@@ -26,52 +26,122 @@
  *    MAXOPEN files open concurrently.)  The client uses file IDs to
  *    communicate with the server.  File IDs are a lot like
  *    environment IDs in the kernel.  Use openfile_lookup to translate
- *    file IDs to struct OpenFile. */
+ *    file IDs to struct OpenFile.
+ *
+ * Free entries are kept on a list.  An entry is freed when the last
+ * client closes its Fd with FSREQ_CLOSE.  Clients may also die
+ * without closing.  Such entries are found by the reference counts
+ * of their Fd pages, but only once the free list runs out. */
 
 struct OpenFile {
     uint32_t o_fileid;   /* file id */
-    struct File *o_file; /* mapped descriptor for open file */
+    struct File *o_file; /* mapped descriptor for open file, NULL if free */
     int o_mode;          /* open mode */
     struct Fd *o_fd;     /* Fd page */
+    int o_next;          /* next free entry, -1 at the end */
 };
 
 /* initialize to force into data section */
 struct OpenFile opentab[MAXOPEN] = {
-        {0, 0, 1, 0}};
+        {0, 0, 1, 0, 0}};
+
+/* Head of list of free open file entries */
+static int openfile_freelist = -1;
+
+/* Maximal number of requests in progress at once */
+#define NCONTEXTS 16
+
+/* Virtual address at which to receive page mappings containing client requests,
+ * request page followed by room for data of multi-page read or write per context */
+#define FSREQ_BASE 0x0F000000
+#define FSREQ_SIZE (PAGE_SIZE + FSIPC_MAXDATA)
+
+/* Request in progress.  Requests that only read are suspended when
+ * they miss in the block cache and are restarted from scratch once
+ * the read completes, so that requests of other clients which hit
+ * in the cache are served meanwhile.  See serve_request(). */
+struct Context {
+    union Fsipc *c_ipc; /* request page */
+    size_t c_size;      /* size of received request region */
+    envid_t c_whom;
+    uint32_t c_req;
+    int c_slot; /* block cache read the request waits for */
+    bool c_busy;
+    uint64_t c_start; /* TSC when request was received */
+
+    /* Arguments of restartable request, replies overwrite them */
+    union {
+        struct Fsreq_read read;
+        struct Fsreq_stat stat;
+        struct Fsreq_map map;
+    } c_args;
+};
+
+static struct Context contexts[NCONTEXTS];
+
+/* Context of the request being handled and where to return if it is suspended */
+static struct Context *running;
+static jmp_buf suspend_point;
 
-/* Virtual address at which to receive page mappings containing client requests. */
-union Fsipc *fsreq = (union Fsipc *)0x0FFFF000;
+/* Number of times requests were suspended */
+static uint64_t nsuspended;
+
+/* Per request type counters reported by FSREQ_STATS */
+static struct FsReqStat reqstats[NFSREQ];
 
 void
 serve_init(void) {
     uintptr_t va = FILE_BASE;
     for (size_t i = 0; i < MAXOPEN; i++) {
         opentab[i].o_fileid = i;
+        opentab[i].o_file = NULL;
         opentab[i].o_fd = (struct Fd *)va;
         va += PAGE_SIZE;
     }
+
+    /* Lowest entries are handed out first */
+    for (int i = MAXOPEN - 1; i >= 0; i--) {
+        opentab[i].o_next = openfile_freelist;
+        openfile_freelist = i;
+    }
+
+    for (size_t i = 0; i < NCONTEXTS; i++)
+        contexts[i].c_ipc = (union Fsipc *)(FSREQ_BASE + i * FSREQ_SIZE);
+}
+
+/* Free an open file.  Its Fd page is dropped rather than reused,
+ * so clients still holding the old page never see the next file. */
+static void
+openfile_free(struct OpenFile *o) {
+    USED(sys_unmap_region(0, o->o_fd, PAGE_SIZE));
+    o->o_file = NULL;
+    o->o_next = openfile_freelist;
+    openfile_freelist = o - opentab;
+}
+
+/* Free open files whose clients all exited without closing them,
+ * these are only referenced by the file server itself */
+static void
+openfile_reclaim(void) {
+    for (size_t i = 0; i < MAXOPEN; i++)
+        if (opentab[i].o_file && sys_region_refs(opentab[i].o_fd, PAGE_SIZE) <= 1)
+            openfile_free(&opentab[i]);
 }
 
 /* Allocate an open file. */
 int
 openfile_alloc(struct OpenFile **o) {
+    if (openfile_freelist < 0) openfile_reclaim();
+    if (openfile_freelist < 0) return -E_MAX_OPEN;
 
-    /* Find an available open-file table entry */
-    for (size_t i = 0; i < MAXOPEN; i++) {
-        switch (sys_region_refs(opentab[i].o_fd, PAGE_SIZE)) {
-        case 0: {
-            int res = sys_alloc_region(0, opentab[i].o_fd, PAGE_SIZE, PROT_RW);
-            if (res < 0) return res;
-        }
-        /* fallthrough */
-        case 1:
-            opentab[i].o_fileid += MAXOPEN;
-            *o = &opentab[i];
-            memset(opentab[i].o_fd, 0, PAGE_SIZE);
-            return (*o)->o_fileid;
-        }
-    }
-    return -E_MAX_OPEN;
+    struct OpenFile *of = &opentab[openfile_freelist];
+    int res = sys_alloc_region(0, of->o_fd, PAGE_SIZE, PROT_RW);
+    if (res < 0) return res;
+
+    openfile_freelist = of->o_next;
+    of->o_fileid += MAXOPEN;
+    *o = of;
+    return of->o_fileid;
 }
 
 /* Look up an open file for envid. */
@@ -80,7 +150,7 @@ openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po) {
     struct OpenFile *o;
 
     o = &opentab[fileid % MAXOPEN];
-    if (sys_region_refs(o->o_fd, PAGE_SIZE) <= 1 || o->o_fileid != fileid)
+    if (!o->o_file || o->o_fileid != fileid)
         return -E_INVAL;
     *po = o;
     return 0;
@@ -105,12 +175,6 @@ serve_open(envid_t envid, struct Fsreq_open *req,
     memmove(path, req->req_path, MAXPATHLEN);
     path[MAXPATHLEN - 1] = 0;
 
-    /* Find an open file ID */
-    if ((res = openfile_alloc(&o)) < 0) {
-        if (debug) cprintf("openfile_alloc failed: %i", res);
-        return res;
-    }
-
     /* Open the file */
     if (req->req_omode & O_CREAT) {
         if ((res = file_create(path, &f)) < 0) {
@@ -139,6 +203,13 @@ serve_open(envid_t envid, struct Fsreq_open *req,
         return res;
     }
 
+    /* Find an open file ID.  This comes last, because
+     * suspended request would leak the entry otherwise */
+    if ((res = openfile_alloc(&o)) < 0) {
+        if (debug) cprintf("openfile_alloc failed: %i", res);
+        return res;
+    }
+
     /* Save the file pointer */
     o->o_file = f;
 
@@ -158,6 +229,58 @@ serve_open(envid_t envid, struct Fsreq_open *req,
     return 0;
 }
 
+/* Map file range of req->req_n bytes at block aligned req->req_offset
+ * of req->req_fileid read-only into the calling environment, storing
+ * the start of block cache pages, their size and permissions in
+ * *pg_store, *size_store and *perm_store respectively.  The file data
+ * is never copied: client shares pages with the block cache, so later
+ * writes to the file show through the mapping.  bc_evict() skips
+ * blocks mapped by clients, so the pages stay the cached ones for as
+ * long as the client maps them.  Only the part of range which is
+ * contiguous on disk is mapped, the client repeats the request for
+ * the rest.  Seek position is not changed.
+ *
+ * Returns the number of valid bytes mapped, 0 at end of file,
+ * or < 0 on error. */
+int
+serve_map(envid_t envid, struct Fsreq_map *req,
+          void **pg_store, size_t *size_store, int *perm_store) {
+    struct OpenFile *o;
+    char *blk;
+    int res;
+
+    if (debug) {
+        cprintf("serve_map %08x %08x %08lx %08lx\n", envid, req->req_fileid,
+                (unsigned long)req->req_offset, (unsigned long)req->req_n);
+    }
+
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+        return res;
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE)
+        return -E_INVAL;
+
+    struct File *f = o->o_file;
+    if (req->req_offset >= f->f_size || !req->req_n)
+        return 0;
+
+    /* Inline data has no block to share */
+    if (file_inline(f)) return -E_NOT_SUPP;
+
+    size_t n = MIN(req->req_n, f->f_size - req->req_offset);
+    blockno_t count = CEILDIV(n, BLKSIZE);
+    if ((res = file_get_blocks(f, req->req_offset / BLKSIZE, &count, &blk)) < 0)
+        return res;
+
+    /* Bring whole run into cache, the kernel only maps present pages */
+    for (blockno_t i = 0; i < count; i++)
+        (void)*(volatile char *)(blk + i * BLKSIZE);
+
+    *pg_store = blk;
+    *size_store = count * BLKSIZE;
+    *perm_store = PROT_R;
+    return MIN(n, count * BLKSIZE);
+}
+
 /* Set the size of req->req_fileid to req->req_size bytes, truncating
  * or extending the file as necessary. */
 int
@@ -184,16 +307,29 @@ serve_set_size(envid_t envid, union Fsipc *ipc) {
     return file_set_size(o->o_file, req->req_size);
 }
 
-/* Read at most ipc->read.req_n bytes from the current seek position
+/* Data buffer of read or write request being served, which is either
+ * the part of request page 'buf' of 'size' bytes or pages following it
+ * if the client sent them.  Sets *size to the size of buffer. */
+static char *
+request_data(union Fsipc *ipc, char *buf, size_t *size) {
+    if (running->c_size <= PAGE_SIZE) return buf;
+
+    *size = running->c_size - PAGE_SIZE;
+    return (char *)ipc + PAGE_SIZE;
+}
+
+/* Read at most ipc->read.req_n bytes at ipc->read.req_offset
  * in ipc->read.req_fileid.  Return the bytes read from the file to
- * the caller in ipc->readRet, then update the seek position.  Returns
- * the number of bytes successfully read, or < 0 on error. */
+ * the caller in ipc->readRet, or the data pages of multi-page request.
+ * The seek position is kept by the client.  Returns the number of
+ * bytes successfully read, or < 0 on error. */
 int
 serve_read(envid_t envid, union Fsipc *ipc) {
     struct Fsreq_read *req = &ipc->read;
     struct Fsret_read *ret = &ipc->readRet;
     struct OpenFile *o;
-    int r, cnt;
+    int r;
+    size_t size = sizeof(ret->ret_buf);
 
     if (debug) {
         cprintf("serve_read %08x %08x %08x\n",
@@ -202,31 +338,31 @@ serve_read(envid_t envid, union Fsipc *ipc) {
 
     if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
         return r;
-    if (req->req_n > PAGE_SIZE)
-        req->req_n = PAGE_SIZE;
-    if ((cnt = file_read(o->o_file, ret->ret_buf, req->req_n, o->o_fd->fd_offset)) > 0)
-        o->o_fd->fd_offset += cnt;
-    return cnt;
+    /* Request is overwritten by reply in single page case */
+    off_t offset = req->req_offset;
+    size_t n = req->req_n;
+    char *buf = request_data(ipc, ret->ret_buf, &size);
+    return file_read(o->o_file, buf, MIN(n, size), offset);
 }
 
-/* Write req->req_n bytes from req->req_buf to req_fileid, starting at
- * the current seek position, and update the seek position
- * accordingly.  Extend the file if necessary.  Returns the number of
- * bytes written, or < 0 on error. */
+/* Write req->req_n bytes from req->req_buf, or the data pages of
+ * multi-page request, to req_fileid, starting at req->req_offset.
+ * Extend the file if necessary.  Returns the number of bytes
+ * written, or < 0 on error. */
 int
 serve_write(envid_t envid, union Fsipc *ipc) {
     struct Fsreq_write *req = &ipc->write;
     struct OpenFile *o;
-    int r, cnt;
+    int r;
+    size_t size = sizeof(req->req_buf);
 
     if (debug)
         cprintf("serve_write %08x %08x %08x\n", envid, req->req_fileid, (uint32_t)req->req_n);
 
     if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
         return r;
-    if ((cnt = file_write(o->o_file, req->req_buf, req->req_n, o->o_fd->fd_offset)) > 0)
-        o->o_fd->fd_offset += cnt;
-    return cnt;
+    char *buf = request_data(ipc, req->req_buf, &size);
+    return file_write(o->o_file, buf, MIN(req->req_n, size), req->req_offset);
 }
 
 /* Stat ipc->stat.req_fileid.  Return the file's struct Stat to the
@@ -259,12 +395,105 @@ serve_flush(envid_t envid, union Fsipc *ipc) {
     if (res < 0) return res;
 
     file_flush(o->o_file);
+    /* Metadata only reaches disk with journal commit */
+    if (journal_active()) fs_sync();
     return 0;
 }
 
+/* Write back data of req->req_fileid and release the open file if the
+ * caller is about to drop the last client mapping of its Fd.  Unlike
+ * serve_flush() metadata is left for the next group commit. */
+int
+serve_close(envid_t envid, union Fsipc *ipc) {
+    struct Fsreq_close *req = &ipc->close;
+    if (debug) cprintf("serve_close %08x %08x\n", envid, req->req_fileid);
+
+    struct OpenFile *o;
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+    if (res < 0) return res;
+    file_flush(o->o_file);
+
+    /* Fd page may be shared by other clients, and is
+     * referenced by the server and the caller itself */
+    if (sys_region_refs(o->o_fd, PAGE_SIZE) <= 2)
+        openfile_free(o);
+    return 0;
+}
+
+/* Remove the file req->req_path.  file_remove clears the struct File
+ * in its directory block, so refuse while an open file still points at
+ * it; entries left behind by exited clients are released first. */
+int
+serve_remove(envid_t envid, union Fsipc *ipc) {
+    struct Fsreq_remove *req = &ipc->remove;
+    char path[MAXPATHLEN];
+    struct File *f;
+    int res;
+
+    if (debug) cprintf("serve_remove %08x %s\n", envid, req->req_path);
+
+    /* Copy in the path, making sure it's null-terminated */
+    memmove(path, req->req_path, MAXPATHLEN);
+    path[MAXPATHLEN - 1] = 0;
+
+    if ((res = file_open(path, &f)) < 0) return res;
+    for (int i = 0; i < MAXOPEN; i++) {
+        if (opentab[i].o_file != f) continue;
+        if (sys_region_refs(opentab[i].o_fd, PAGE_SIZE) > 1) return -E_FILE_EXISTS;
+        openfile_free(&opentab[i]);
+    }
+
+    return file_remove(path);
+}
+
 int
 serve_sync(envid_t envid, union Fsipc *req) {
     fs_sync();
+    if (debug)
+        cprintf("bc: %lu resident, %lu hits %lu faults %lu direct, %lu evicted, read-ahead %lu reads %lu blocks, %lu hit %lu wasted, "
+                "write-back %lu writes %lu blocks, %lu commits %lu logged %lu checkpoints, "
+                "%lu async reads %lu suspended\n",
+                (unsigned long)bc_stats.resident, (unsigned long)bc_stats.hits,
+                (unsigned long)bc_stats.faults, (unsigned long)bc_stats.direct_reads,
+                (unsigned long)bc_stats.evictions, (unsigned long)bc_stats.ra_io,
+                (unsigned long)bc_stats.ra_blocks, (unsigned long)bc_stats.ra_hits,
+                (unsigned long)bc_stats.ra_waste, (unsigned long)bc_stats.wb_io,
+                (unsigned long)bc_stats.wb_blocks, (unsigned long)bc_stats.commits,
+                (unsigned long)bc_stats.logged_blocks, (unsigned long)bc_stats.checkpoints,
+                (unsigned long)bc_stats.async_reads,
+                (unsigned long)nsuspended);
+    return 0;
+}
+
+int
+serve_stats(envid_t envid, union Fsipc *ipc) {
+    bool reset = ipc->stats.req_reset;
+    struct Fsret_stats *ret = &ipc->statsRet;
+
+    static_assert(sizeof(struct Fsret_stats) <= PAGE_SIZE, "Fsret_stats does not fit in a page");
+
+    memcpy(ret->ret_req, reqstats, sizeof(reqstats));
+    ret->ret_tsc_freq = tsc_freq;
+    ret->ret_suspended = nsuspended;
+    ret->ret_bc_hits = bc_stats.hits;
+    ret->ret_bc_misses = bc_stats.faults + bc_stats.direct_reads;
+    ret->ret_bc_readahead = bc_stats.ra_blocks;
+    ret->ret_bc_evictions = bc_stats.evictions;
+    ret->ret_bc_resident = bc_stats.resident;
+    ret->ret_disk_reads = nvme_stats.reads;
+    ret->ret_disk_writes = nvme_stats.writes;
+    ret->ret_disk_read_bytes = nvme_stats.read_bytes;
+    ret->ret_disk_write_bytes = nvme_stats.write_bytes;
+
+    if (reset) {
+        /* Number of resident blocks is state rather than a counter */
+        uint64_t resident = bc_stats.resident;
+        memset(&bc_stats, 0, sizeof(bc_stats));
+        bc_stats.resident = resident;
+        memset(&nvme_stats, 0, sizeof(nvme_stats));
+        memset(reqstats, 0, sizeof(reqstats));
+        nsuspended = 0;
+    }
     return 0;
 }
 
@@ -278,23 +507,112 @@ fshandler handlers[] = {
         [FSREQ_FLUSH] = serve_flush,
         [FSREQ_WRITE] = serve_write,
         [FSREQ_SET_SIZE] = serve_set_size,
-        [FSREQ_SYNC] = serve_sync};
+        [FSREQ_REMOVE] = serve_remove,
+        [FSREQ_SYNC] = serve_sync,
+        [FSREQ_CLOSE] = serve_close,
+        [FSREQ_STATS] = serve_stats};
 #define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
 
+/* Called by block cache instead of waiting for a read */
+static void
+suspend_request(int slot) {
+    running->c_slot = slot;
+    bc_suspend = NULL;
+    nsuspended++;
+    longjmp(suspend_point, 1);
+}
+
+/* Requests that change nothing before their last cache miss
+ * and thus may be abandoned midway and run again */
+static bool
+restartable(struct Context *c) {
+    return c->c_req == FSREQ_READ || c->c_req == FSREQ_STAT || c->c_req == FSREQ_MAP ||
+           (c->c_req == FSREQ_OPEN && !(c->c_ipc->open.req_omode & (O_CREAT | O_TRUNC | O_MKDIR)));
+}
+
+/* Account request that is about to be replied to */
+static void
+account_request(struct Context *c, int res) {
+    if (c->c_req >= NFSREQ) return;
+
+    struct FsReqStat *st = &reqstats[c->c_req];
+    uint64_t cycles = read_tsc() - c->c_start;
+
+    st->count++;
+    st->cycles += cycles;
+    if (cycles > st->max_cycles) st->max_cycles = cycles;
+    if (res > 0 && (c->c_req == FSREQ_READ || c->c_req == FSREQ_WRITE || c->c_req == FSREQ_MAP))
+        st->bytes += res;
+
+    int b = 0;
+    while (b < FSSTAT_BUCKETS - 1 && cycles >= 1ULL << (FSSTAT_SHIFT + b)) b++;
+    st->hist[b]++;
+}
+
+/* Run request to completion and reply, or until it is suspended */
+static void
+serve_request(struct Context *c) {
+    void *pg = NULL;
+    size_t size = PAGE_SIZE;
+    int perm = 0, res;
+
+    running = c;
+    c->c_slot = -1;
+    if (setjmp(suspend_point)) return;
+
+    if (restartable(c)) {
+        if (c->c_req != FSREQ_OPEN)
+            memcpy(c->c_ipc, &c->c_args, sizeof(c->c_args));
+        bc_suspend = suspend_request;
+    }
+
+    if (c->c_req == FSREQ_OPEN) {
+        res = serve_open(c->c_whom, &c->c_ipc->open, &pg, &perm);
+    } else if (c->c_req == FSREQ_MAP) {
+        res = serve_map(c->c_whom, &c->c_ipc->map, &pg, &size, &perm);
+    } else if (c->c_req < NHANDLERS && handlers[c->c_req]) {
+        res = handlers[c->c_req](c->c_whom, c->c_ipc);
+    } else {
+        cprintf("Invalid request code %d from %08x\n", c->c_req, c->c_whom);
+        res = -E_INVAL;
+    }
+    bc_suspend = NULL;
+
+    account_request(c, res);
+    ipc_send(c->c_whom, res, pg, size, perm);
+    sys_unmap_region(0, c->c_ipc, c->c_size);
+    c->c_busy = 0;
+}
+
 void
 serve(void) {
-    uint32_t req, whom;
-    int perm, res;
-    void *pg;
-
     while (1) {
-        perm = 0;
-        size_t sz = PAGE_SIZE;
-        req = ipc_recv((int32_t *)&whom, fsreq, &sz, &perm);
+        /* Restart requests whose blocks arrived */
+        for (int slot; (slot = bc_poll()) >= 0;)
+            for (struct Context *c = contexts; c < contexts + NCONTEXTS; c++)
+                if (c->c_busy && c->c_slot == slot) serve_request(c);
+
+        struct Context *c = contexts;
+        while (c < contexts + NCONTEXTS && c->c_busy) c++;
+        if (c == contexts + NCONTEXTS) {
+            /* Every context waits for a read */
+            sys_yield();
+            continue;
+        }
+
+        /* Don't block while reads are in flight, their
+         * completion is only noticed by polling */
+        envid_t whom;
+        int perm = 0;
+        size_t sz = FSREQ_SIZE;
+        int32_t req = bc_pending() ? ipc_try_recv(&whom, c->c_ipc, &sz, &perm) :
+                                     ipc_recv(&whom, c->c_ipc, &sz, &perm);
+        if (req < 0) continue;
+
         if (debug) {
             cprintf("fs req %d from %08x [page %08lx: %s]\n",
-                    req, whom, (unsigned long)get_uvpt_entry(fsreq),
-                    (char *)fsreq);
+                    req, whom, (unsigned long)get_uvpt_entry(c->c_ipc),
+                    (char *)c->c_ipc);
         }
 
         /* All requests must contain an argument page */
@@ -303,17 +621,14 @@ serve(void) {
             continue; /* Just leave it hanging... */
         }
 
-        pg = NULL;
-        if (req == FSREQ_OPEN) {
-            res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
-        } else if (req < NHANDLERS && handlers[req]) {
-            res = handlers[req](whom, fsreq);
-        } else {
-            cprintf("Invalid request code %d from %08x\n", req, whom);
-            res = -E_INVAL;
-        }
-        ipc_send(whom, res, pg, PAGE_SIZE, perm);
-        sys_unmap_region(0, fsreq, PAGE_SIZE);
+        c->c_busy = 1;
+        c->c_start = read_tsc();
+        c->c_size = sz;
+        c->c_whom = whom;
+        c->c_req = req;
+        memcpy(&c->c_args, c->c_ipc, sizeof(c->c_args));
+        serve_request(c);
+        bc_writeback();
     }
 }
 
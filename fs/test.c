@@ -5,6 +5,9 @@
 
 static char *msg = "This is the NEW message of the day!\n\n";
 
+/* Number of blocks in files made by make_test_file() */
+#define TEST_BLOCKS 16
+
 void check_dir(struct File *dir);
 
 static inline void
@@ -14,42 +17,408 @@ check_consistency(void) {
 
 void
 check_dir(struct File *dir) {
-    uint32_t *blk;
+    blockno_t blk, run;
     struct File *files;
 
     blockno_t nblock = dir->f_size / BLKSIZE;
     for (blockno_t i = 0; i < nblock; ++i) {
-        if (file_block_walk(dir, i, &blk, 0) < 0) continue;
+        if (file_block_lookup(dir, i, &blk, &run) < 0 || !blk) continue;
 
-        files = (struct File *)diskaddr(*blk);
+        files = (struct File *)diskaddr(blk);
 
         for (blockno_t j = 0; j < BLKFILES; ++j) {
             struct File *f = &(files[j]);
             if (strcmp(f->f_name, "\0") != 0) {
-                blockno_t *pdiskbno = NULL;
+                blockno_t diskbno;
 
                 cprintf("checking consistency of %s\n", f->f_name);
+                if (file_inline(f)) continue;
 
                 for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
                     if (f->f_type == FTYPE_DIR) {
                         check_dir(f);
                     }
-                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+                    if (file_block_lookup(f, k, &diskbno, &run) < 0 || !diskbno) {
                         continue;
                     }
-                    assert(!block_is_free(*pdiskbno));
+                    assert(!block_is_free(diskbno));
                 }
             }
         }
     }
 }
 
+/* With journal on, flush_block() leaves metadata blocks such as
+ * the directory block holding a struct File dirty until commit.
+ * Commit the one holding addr now and check that the journal did it. */
+static void
+commit_metadata(void *addr) {
+    if (!journal_active() || !is_page_dirty(ROUNDDOWN(addr, BLKSIZE))) return;
+
+    uint64_t commits = bc_stats.commits, logged = bc_stats.logged_blocks;
+    bc_sync();
+    assert(bc_stats.commits > commits && bc_stats.logged_blocks > logged);
+}
+
+#ifdef CONFIG_SELFTEST
+/* Last transaction found in the log on disk */
+static struct JournalHeader *
+last_transaction(blockno_t *log) {
+    blockno_t half = (super->s_journal_len - 1) / 2;
+    struct JournalHeader *last = NULL;
+
+    bc_drop(super->s_journal, super->s_journal_len);
+    for (blockno_t i = 0; i < 2; i++) {
+        struct JournalHeader *jh = diskaddr(super->s_journal + 1 + i * half);
+        if (jh->j_magic == JOURNAL_MAGIC && (!last || jh->j_seq > last->j_seq)) {
+            last = jh;
+            *log = super->s_journal + 1 + i * half;
+        }
+    }
+    assert(last);
+    return last;
+}
+
+/* Commit a metadata block and crash before it is written home,
+ * replay has to bring it there.  Then tear the next transaction
+ * as if the crash happened while writing it, it must not be replayed */
+static void
+check_journal(void) {
+    static const char pattern[] = "journal replay test";
+    blockno_t log = 0;
+
+    if (!journal_active()) return;
+
+    blockno_t b = alloc_block();
+    if (!b) panic("check_journal: %i", -E_NO_DISK);
+
+    /* Clear home location, it may hold the pattern from the last run */
+    char *blk = bc_get(b, BC_NOREAD);
+    memset(blk, 0, BLKSIZE);
+    flush_block(blk);
+
+    blk = bc_get(b, BC_WRITE | BC_META);
+    strcpy(blk, pattern);
+    bc_put(blk);
+    uint64_t checkpoints = bc_stats.checkpoints;
+    bc_sync();
+    assert(bc_stats.checkpoints == checkpoints && journal_pending());
+
+    /* Committed block is in the log, but not home */
+    bc_drop(b, 1);
+    assert(strcmp(diskaddr(b), pattern));
+    bc_drop(b, 1);
+    journal_init();
+    assert(journal_active() && !journal_pending());
+    bc_drop(b, 1);
+    assert(!strcmp(diskaddr(b), pattern));
+    cprintf("journal replay is good\n");
+
+    blk = bc_get(b, BC_WRITE);
+    blk[0] = 'X';
+    bc_put(blk);
+    bc_sync();
+
+    /* Only part of the transaction reached the log */
+    struct JournalHeader *jh = last_transaction(&log);
+    assert(jh->j_nblocks == 1 && jh->j_home[0] == b);
+    blk = diskaddr(log + 1);
+    assert(blk[0] == 'X');
+    blk[0] = pattern[0];
+    flush_block(blk);
+
+    bc_drop(b, 1);
+    journal_init();
+    bc_drop(b, 1);
+    assert(!strcmp(diskaddr(b), pattern));
+
+    free_block(b);
+    bc_checkpoint();
+    cprintf("torn journal transaction is good\n");
+}
+
+static char test_data[TEST_BLOCKS * BLKSIZE];
+
+/* Create file of TEST_BLOCKS blocks with one write, block i
+ * is filled with 'A' + i, and write it back to disk.  The blocks
+ * are allocated together, *first is set to the first of them */
+static struct File *
+make_test_file(const char *path, blockno_t *first) {
+    struct File *f;
+    blockno_t run;
+    int r;
+
+    for (blockno_t i = 0; i < TEST_BLOCKS; i++)
+        memset(test_data + i * BLKSIZE, 'A' + i, BLKSIZE);
+    /* Left behind if the server died during the test */
+    file_remove(path);
+    if ((r = file_create(path, &f)) < 0)
+        panic("file_create %s: %i", path, r);
+    if ((r = file_write(f, test_data, sizeof(test_data), 0)) != sizeof(test_data))
+        panic("file_write %s: %i", path, r);
+    fs_sync();
+
+    assert(!file_block_lookup(f, 0, first, &run) && *first && run == TEST_BLOCKS);
+    return f;
+}
+
+static void
+check_extents(struct File *f, blockno_t first) {
+    bool extents = super->s_features & FS_FEATURE_EXTENTS;
+    blockno_t next, diskbno, run, last;
+    char buf[BLKSIZE];
+    int r;
+
+    /* One write allocates one contiguous range */
+    if (extents) assert(f->f_nextents == 1);
+
+    /* Appended block is placed right after the previous one
+     * (with block pointers indirect block is already there) */
+    memset(buf, 'A' + TEST_BLOCKS, BLKSIZE);
+    if ((r = file_write(f, buf, BLKSIZE, TEST_BLOCKS * BLKSIZE)) != BLKSIZE)
+        panic("file_write: %i", r);
+    assert(!file_block_lookup(f, TEST_BLOCKS, &next, &run) && next);
+    if (extents) assert(f->f_nextents == 1 && next == first + TEST_BLOCKS);
+
+    /* Block past a hole starts another extent */
+    if ((r = file_write(f, buf, BLKSIZE, 3 * TEST_BLOCKS * BLKSIZE)) != BLKSIZE)
+        panic("file_write: %i", r);
+    assert(!file_block_lookup(f, 2 * TEST_BLOCKS, &diskbno, &run) && !diskbno);
+    if (extents) assert(f->f_nextents == 2 && run == TEST_BLOCKS);
+    assert(!file_block_lookup(f, 3 * TEST_BLOCKS, &last, &run) && last);
+
+    for (blockno_t i = 0; i <= TEST_BLOCKS; i++) {
+        if ((r = file_read(f, buf, BLKSIZE, i * BLKSIZE)) != BLKSIZE)
+            panic("file_read: %i", r);
+        assert(buf[0] == 'A' + i && buf[BLKSIZE - 1] == 'A' + i);
+    }
+
+    /* Truncation frees blocks past new end */
+    if ((r = file_set_size(f, TEST_BLOCKS * BLKSIZE)) < 0)
+        panic("file_set_size: %i", r);
+    assert(block_is_free(last) && block_is_free(next));
+    assert(!file_block_lookup(f, 0, &diskbno, &run) && diskbno == first && run == TEST_BLOCKS);
+    if (extents) assert(f->f_nextents == 1);
+    cprintf("extent allocation is good\n");
+}
+
+static void
+check_readahead(struct File *f, blockno_t first) {
+    /* Read the file back from disk as if it was never cached.
+     * Sequential faults fetch growing windows, 1 + 4 + 8 blocks.
+     * Reader notes use of the first 10 blocks as file_get_blocks()
+     * does, so 7 prefetched blocks are used and 3 are wasted */
+    bc_drop(first, TEST_BLOCKS);
+    uint64_t faults = bc_stats.faults, ra_io = bc_stats.ra_io, ra_blocks = bc_stats.ra_blocks;
+    uint64_t ra_hits = bc_stats.ra_hits, ra_waste = bc_stats.ra_waste;
+    for (blockno_t i = 0; i < 13; i++) {
+        char *blk = diskaddr(first + i);
+        assert(blk[0] == 'A' + i && blk[BLKSIZE - 1] == 'A' + i);
+        if (i < 10) bc_touch(first + i, 1);
+    }
+    assert(bc_stats.faults - faults <= 3);
+    assert(bc_stats.ra_io - ra_io >= 2 && bc_stats.ra_blocks - ra_blocks >= 10);
+    assert(bc_stats.ra_hits - ra_hits == 7 && bc_stats.ra_waste == ra_waste);
+
+    /* Random access reads only the demanded block */
+    bc_drop(first, TEST_BLOCKS);
+    assert(bc_stats.ra_waste - ra_waste == 3);
+    faults = bc_stats.faults, ra_blocks = bc_stats.ra_blocks;
+    assert(*(volatile char *)diskaddr(first + 8) == 'A' + 8);
+    assert(*(volatile char *)diskaddr(first + 2) == 'A' + 2);
+    assert(bc_stats.faults - faults == 2 && bc_stats.ra_blocks == ra_blocks);
+    assert(!is_page_present(diskaddr(first + 9)) && !is_page_present(diskaddr(first + 3)));
+    cprintf("read-ahead is good\n");
+}
+
+static jmp_buf suspended;
+static int suspended_slot;
+
+/* Stands for the server's suspend_request() */
+static void
+suspend_test(int slot) {
+    suspended_slot = slot;
+    bc_suspend = NULL;
+    longjmp(suspended, 1);
+}
+
+/* Wait for read in given slot as the server loop does */
+static void
+poll_slot(int slot) {
+    int r;
+    while ((r = bc_poll()) < 0) sys_yield();
+    assert(r == slot);
+}
+
+/* Misses of restartable requests only submit reads, and the
+ * request is run again once bc_poll() reports the read done */
+static void
+check_suspend(struct File *f, blockno_t first) {
+    int slot;
+
+    bc_drop(first, TEST_BLOCKS);
+
+    uint64_t async = bc_stats.async_reads;
+    if (!setjmp(suspended)) {
+        bc_suspend = suspend_test;
+        (void)*(volatile char *)diskaddr(first);
+        panic("cache miss was not suspended");
+    }
+    slot = suspended_slot;
+    assert(bc_stats.async_reads == async + 1);
+    /* Block is staged until the read is reported */
+    assert(!is_page_present(diskaddr(first)) && bc_pending());
+
+    /* Cached blocks are used meanwhile, and another miss
+     * of the same block waits for the same read */
+    assert(!strcmp(f->f_name, "suspend-test"));
+    if (!setjmp(suspended)) {
+        bc_suspend = suspend_test;
+        (void)*(volatile char *)diskaddr(first);
+        panic("cache miss was not suspended");
+    }
+    assert(suspended_slot == slot && bc_stats.async_reads == async + 1);
+
+    /* Restarted request finds the block cached */
+    poll_slot(slot);
+    if (setjmp(suspended)) panic("cache hit was suspended");
+    bc_suspend = suspend_test;
+    assert(*(volatile char *)diskaddr(first) == 'A');
+    bc_suspend = NULL;
+
+    /* Direct loads are suspended the same way */
+    if (!setjmp(suspended)) {
+        bc_suspend = suspend_test;
+        bc_get(first + TEST_BLOCKS - 1, 0);
+        panic("direct load was not suspended");
+    }
+    poll_slot(suspended_slot);
+    assert(*(char *)bc_get(first + TEST_BLOCKS - 1, 0) == 'A' + TEST_BLOCKS - 1);
+    assert(!bc_pending());
+    cprintf("suspended reads are good\n");
+}
+
+/* Eviction passes over pinned, recently used and client mapped
+ * blocks and writes dirty ones back before dropping them */
+static void
+check_eviction(struct File *f, blockno_t first) {
+    blockno_t b = first;
+    char *blk;
+
+    bc_load(b, 5);
+    blk = bc_get(b + 2, BC_WRITE);
+    memset(blk, 'Z', BLKSIZE);
+    bc_put(blk);
+    bc_pin(b, 1);
+    if (sys_map_region(CURENVID, diskaddr(b + 3), CURENVID, UTEMP, BLKSIZE, PROT_R))
+        panic("check_eviction: can't map block %08x", b + 3);
+    bc_cold(b, 5);
+    bc_touch(b + 1, 1);
+
+    /* The hand skips b and b + 1, writes back and drops b + 2,
+     * skips b + 3 and drops b + 4 */
+    uint64_t evictions = bc_stats.evictions, resident = bc_stats.resident;
+    bc_evict(resident - 2);
+    assert(bc_stats.evictions - evictions == 2 && bc_stats.resident == resident - 2);
+    assert(is_page_present(diskaddr(b)) && is_page_present(diskaddr(b + 1)));
+    assert(!is_page_present(diskaddr(b + 2)) && is_page_present(diskaddr(b + 3)));
+    assert(!is_page_present(diskaddr(b + 4)));
+
+    /* Dirty block was not lost */
+    blk = diskaddr(b + 2);
+    assert(blk[0] == 'Z' && blk[BLKSIZE - 1] == 'Z');
+
+    sys_unmap_region(CURENVID, UTEMP, BLKSIZE);
+    bc_unpin(b, 1);
+    cprintf("bounded eviction is good\n");
+}
+
+/* Test that directory index and dentry cache follow
+ * creation and removal of files in root directory */
+static void
+check_dir_index(void) {
+    struct File *dir = &super->s_root, *files[BLKFILES + 1], *f;
+    char path[MAXNAMELEN];
+    int res;
+
+    /* More than a block of entries, so the index is used */
+    for (size_t i = 0; i < BLKFILES + 1; i++) {
+        snprintf(path, sizeof(path), "/dirindex-%zu", i);
+        file_remove(path);
+        if ((res = file_create(path, &files[i])) < 0)
+            panic("file_create %s: %i", path, res);
+    }
+
+    for (size_t i = 0; i < BLKFILES + 1; i++) {
+        snprintf(path, sizeof(path), "/dirindex-%zu", i);
+        assert(!file_open(path, &f) && f == files[i]);
+        assert(dir->f_dirindex && dir_index_has(dir, path + 1, f));
+        assert(dcache_cached(dir, path + 1) == f);
+    }
+
+    /* Removed entries are gone from both, the rest are still found */
+    for (size_t i = 0; i < BLKFILES + 1; i += 2) {
+        snprintf(path, sizeof(path), "/dirindex-%zu", i);
+        if ((res = file_remove(path)) < 0)
+            panic("file_remove %s: %i", path, res);
+        assert(!dcache_cached(dir, path + 1) && !dir_index_has(dir, path + 1, files[i]));
+        assert(file_open(path, &f) == -E_NOT_FOUND);
+    }
+    for (size_t i = 1; i < BLKFILES + 1; i += 2) {
+        snprintf(path, sizeof(path), "/dirindex-%zu", i);
+        assert(!file_open(path, &f) && f == files[i]);
+    }
+
+    /* Freed slot is reused under another name */
+    if ((res = file_create("/dirindex-new", &f)) < 0)
+        panic("file_create: %i", res);
+    assert(f == files[0] && dir_index_has(dir, "dirindex-new", f));
+    assert(file_open("/dirindex-0", &f) == -E_NOT_FOUND);
+
+    file_remove("/dirindex-new");
+    for (size_t i = 1; i < BLKFILES + 1; i += 2) {
+        snprintf(path, sizeof(path), "/dirindex-%zu", i);
+        file_remove(path);
+    }
+    cprintf("directory index is good\n");
+}
+
+/* Checks of cache and allocation features, each
+ * gets a fresh file made by make_test_file() */
+static const struct {
+    const char *path;
+    void (*check)(struct File *f, blockno_t first);
+} feature_checks[] = {
+        {"/extent-test", check_extents},
+        {"/readahead-test", check_readahead},
+        {"/suspend-test", check_suspend},
+        {"/evict-test", check_eviction},
+};
+
+static void
+check_features(void) {
+    blockno_t first;
+    int r;
+
+    check_journal();
+    for (size_t i = 0; i < sizeof(feature_checks) / sizeof(*feature_checks); i++) {
+        struct File *f = make_test_file(feature_checks[i].path, &first);
+        feature_checks[i].check(f, first);
+        if ((r = file_remove(feature_checks[i].path)) < 0)
+            panic("file_remove %s: %i", feature_checks[i].path, r);
+        assert(block_is_free(first));
+    }
+    check_dir_index();
+}
+#endif
+
 void
 fs_test(void) {
     struct File *f;
     int r;
     char *blk;
     uint32_t *bits;
+    blockno_t diskbno, run;
 
     /* Back up bitmap */
     if ((r = sys_alloc_region(0, (void *)PAGE_SIZE, PAGE_SIZE, PROT_RW)) < 0)
@@ -66,6 +435,9 @@ fs_test(void) {
     cprintf("alloc_block is good\n");
     check_consistency();
     cprintf("fs consistency is good\n");
+#ifdef CONFIG_SELFTEST
+    check_features();
+#endif
 
     if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
         panic("file_open /not-found: %i", r);
@@ -75,6 +447,17 @@ fs_test(void) {
         panic("file_open /newmotd: %i", r);
     cprintf("file_open is good\n");
 
+    if (file_inline(f)) {
+        char buf[FILE_INLINE_MAX];
+        if ((r = file_read(f, buf, sizeof(buf), 0)) != strlen(msg) || memcmp(buf, msg, r))
+            panic("file_read of inline file returned wrong data");
+        /* Growing the file moves its data to a block */
+        if ((r = file_set_size(f, BLKSIZE)) < 0)
+            panic("file_set_size: %i", r);
+        assert(!file_inline(f));
+        cprintf("inline file is good\n");
+    }
+
     if ((r = file_get_block(f, 0, &blk)) < 0)
         panic("file_get_block: %i", r);
     if (strcmp(blk, msg) != 0)
@@ -89,19 +472,29 @@ fs_test(void) {
 
     if ((r = file_set_size(f, 0)) < 0)
         panic("file_set_size: %i", r);
-    assert(f->f_direct[0] == 0);
+    assert(file_block_lookup(f, 0, &diskbno, &run) == 0 && !diskbno);
+    commit_metadata(f);
     assert(!is_page_dirty(f));
     cprintf("file_truncate is good\n");
 
     if ((r = file_set_size(f, strlen(msg))) < 0)
         panic("file_set_size 2: %i", r);
+    commit_metadata(f);
     assert(!is_page_dirty(f));
-    if ((r = file_get_block(f, 0, &blk)) < 0)
-        panic("file_get_block 2: %i", r);
-    strcpy(blk, msg);
-    assert(is_page_dirty(blk));
-    file_flush(f);
-    assert(!is_page_dirty(blk));
+    if (file_inline(f)) {
+        if ((r = file_write(f, msg, strlen(msg), 0)) < 0)
+            panic("file_write: %i", r);
+        assert(is_page_dirty(f));
+        file_flush(f);
+    } else {
+        if ((r = file_get_block(f, 0, &blk)) < 0)
+            panic("file_get_block 2: %i", r);
+        strcpy(blk, msg);
+        assert(is_page_dirty(blk));
+        file_flush(f);
+        assert(!is_page_dirty(blk));
+    }
+    commit_metadata(f);
     assert(!is_page_dirty(f));
     cprintf("file rewrite is good\n");
 }
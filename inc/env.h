@@ -52,10 +52,20 @@ struct List {
     struct List *prev, *next;
 };
 
+/* Memory usage of address space, readable by user via UENVS */
+struct MemoryStat {
+    size_t private_bytes; /* Memory mapped exclusively */
+    size_t shared_bytes;  /* Shared and copy-on-write mappings */
+    size_t huge_bytes;    /* Mappings of 2MB and larger */
+    size_t pt_pages;      /* Page table pages (including PML4) */
+    size_t faults;        /* Page faults taken */
+};
+
 struct AddressSpace {
     pml4e_t *pml4;     /* Virtual address of pml4 */
     uintptr_t cr3;     /* Physical address of pml4 */
     struct Page *root; /* root node of address space tree */
+    struct MemoryStat stat;
 };
 
 
@@ -76,8 +86,14 @@ struct Env {
     /* Exception handling */
     void *env_pgfault_upcall; /* Page fault upcall entry point */
 
+    /* Clean pages in [env_cache_start, env_cache_end)
+     * may be dropped by the kernel under memory pressure */
+    uintptr_t env_cache_start;
+    uintptr_t env_cache_end;
+
     /* IPC */
     bool env_ipc_recving;    /* Env is blocked receiving */
+    bool env_ipc_polling;    /* Env receives without blocking */
     uintptr_t env_ipc_dstva; /* VA at which to map received page */
     size_t env_ipc_maxsz;    /* maximal size of received region */
     uint32_t env_ipc_value;  /* Data value sent to us */
@@ -8,6 +8,9 @@
 #include <inc/types.h>
 #include <inc/fs.h>
 
+/* Maximum number of file descriptors a program may hold open concurrently */
+#define MAXFD 32
+
 struct Fd;
 struct Stat;
 struct Dev;
@@ -25,6 +28,7 @@ struct Dev {
 
 struct FdFile {
     int id;
+    uint32_t gen; /* Bumped when file is changed through this fd */
 };
 
 struct Fd {
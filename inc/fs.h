@@ -28,25 +28,65 @@ typedef uint32_t blockno_t;
 
 #define MAXFILESIZE ((NDIRECT + NINDIRECT) * BLKSIZE * 2)
 
-#define SETBIT(v, n) ((v)[(n / 32)] |= 1U << ((n) % 32))
-#define CLRBIT(v, n) ((v)[(n / 32)] &= ~(1U << ((n) % 32)))
-#define TSTBIT(v, n) ((v)[(n / 32)] & (1U << ((n) % 32)))
+/* Run of contiguous disk blocks backing a part of file */
+struct Extent {
+    blockno_t e_fileblock; /* first file block */
+    blockno_t e_diskblock; /* first disk block */
+    uint32_t e_len;        /* number of blocks */
+} __attribute__((packed));
+
+/* Number of extents stored in a File descriptor */
+#define NINLINEEXT 3
+/* Number of extents in an extent block */
+#define NBLKEXT (BLKSIZE / sizeof(struct Extent))
+
+/* Extent-based files are limited only by 32-bit off_t */
+#define MAXEXTFILESIZE (0x7FFFFFFF & ~(BLKSIZE - 1))
+
+#define SETBIT(v, n) ((v)[(n) / 32] |= 1U << ((n) % 32))
+#define CLRBIT(v, n) ((v)[(n) / 32] &= ~(1U << ((n) % 32)))
+#define TSTBIT(v, n) ((v)[(n) / 32] & (1U << ((n) % 32)))
+
+/* Regular files up to this size keep their data in struct File
+ * when FS_FEATURE_INLINE is set in super block.  The data overlays
+ * block pointers and the padding up to the directory index fields,
+ * so struct File stays 256 bytes; must do arithmetic in case we're
+ * compiling fsformat on a 64-bit machine. */
+#define FILE_INLINE_MAX (256 - MAXNAMELEN - 8 - 8)
 
 struct File {
     char f_name[MAXNAMELEN]; /* filename */
     off_t f_size;            /* file size in bytes */
     uint32_t f_type;         /* file type */
 
-    /* Block pointers. */
-    /* A block is allocated iff its value is != 0. */
-    blockno_t f_direct[NDIRECT]; /* direct blocks */
-    blockno_t f_indirect;        /* indirect block */
+    union {
+        /* Block pointers. */
+        /* A block is allocated iff its value is != 0. */
+        struct {
+            blockno_t f_direct[NDIRECT]; /* direct blocks */
+            blockno_t f_indirect;        /* indirect block */
+        };
+        /* Extents sorted by e_fileblock, used
+         * when FS_FEATURE_EXTENTS is set in super block */
+        struct {
+            struct Extent f_extents[NINLINEEXT]; /* first extents */
+            uint32_t f_nextents;                 /* total number of extents */
+            blockno_t f_extblock;                /* block holding the rest of extents */
+        };
+        /* Data of inline file, bytes past f_size are zero */
+        uint8_t f_inline[FILE_INLINE_MAX];
+    };
 
-    /* Pad out to 256 bytes; must do arithmetic in case we're compiling
-     * fsformat on a 64-bit machine. */
-    uint8_t f_pad[256 - MAXNAMELEN - 8 - 4 * NDIRECT - 4];
+    /* Hashed directory index, both are 0 on images without it */
+    blockno_t f_dirindex; /* directory: block of DIRINDEX_BUCKETS chain heads */
+    uint32_t f_hashnext;  /* entry: next entry slot + 1 in hash chain */
 } __attribute__((packed)); /* required only on some 64-bit machines */
 
+/* Number of hash chains in directory index block.
+ * Chain heads are entry slot numbers + 1, where slot is
+ * directory block number * BLKFILES + index in block */
+#define DIRINDEX_BUCKETS (BLKSIZE / sizeof(uint32_t))
+
 /* An inode block contains exactly BLKFILES 'struct File's */
 #define BLKFILES (BLKSIZE / sizeof(struct File))
 
@@ -54,28 +94,100 @@ struct File {
 #define FTYPE_REG 0 /* Regular file */
 #define FTYPE_DIR 1 /* Directory */
 
+/* Hash of file name used by directory index (FNV-1a) */
+static inline uint32_t
+dirindex_hash(const char *name) {
+    uint32_t hash = 2166136261U;
+    while (*name) hash = (hash ^ (uint8_t)*name++) * 16777619U;
+    return hash;
+}
+
 /* File system super-block (both in-memory and on-disk) */
 
 #define FS_MAGIC 0x4A0530AE /* related vaguely to 'J\0S!' */
 
+/* Files are described by extents instead of block pointers */
+#define FS_FEATURE_EXTENTS 0x1
+/* Metadata updates are committed through journal first */
+#define FS_FEATURE_JOURNAL 0x2
+/* Small regular files are stored inline, see FILE_INLINE_MAX */
+#define FS_FEATURE_INLINE 0x4
+
 struct Super {
-    uint32_t s_magic;    /* Magic number: FS_MAGIC */
-    blockno_t s_nblocks; /* Total number of blocks on disk */
-    struct File s_root;  /* Root directory node */
+    uint32_t s_magic;        /* Magic number: FS_MAGIC */
+    blockno_t s_nblocks;     /* Total number of blocks on disk */
+    struct File s_root;      /* Root directory node */
+    uint32_t s_features;     /* FS_FEATURE_* flags */
+    blockno_t s_journal;     /* Journal header block */
+    blockno_t s_journal_len; /* Journal length including header */
+};
+
+#define JOURNAL_MAGIC 0x4A4C4F47 /* 'JLOG' */
+
+/* Default journal length in blocks */
+#define JOURNAL_BLOCKS 128
+
+/* Maximal number of blocks in one transaction */
+#define JOURNAL_MAXBLOCKS ((BLKSIZE - 4 * sizeof(uint32_t)) / sizeof(blockno_t))
+
+/* Journal header.  The one at s_journal has no blocks and records
+ * the last transaction whose blocks were all written home.  Log space
+ * after it is split in two halves used by transactions in turn, each
+ * starts with header followed by copies of logged blocks, j_home[i] is
+ * where i'th copy belongs.  Transaction is committed once it is on disk
+ * with matching j_sum, so it is written with a single command. */
+struct JournalHeader {
+    uint32_t j_magic;
+    uint32_t j_seq;     /* Transaction sequence number */
+    uint32_t j_nblocks; /* Number of logged blocks, 0 if none */
+    uint32_t j_sum;     /* Checksum of j_home and logged blocks */
+    blockno_t j_home[JOURNAL_MAXBLOCKS];
 };
 
 /* Definitions for requests from clients to file system */
+
+/* Read and write requests may be sent as a region holding up to
+ * FSIPC_MAXDATA bytes of data right after the request page, data
+ * is then read into or written from it instead of the request page */
+#define FSIPC_MAXDATA (256 * 1024)
+
 enum {
     FSREQ_OPEN = 1,
     FSREQ_SET_SIZE,
-    /* Read returns a Fsret_read on the request page */
+    /* Read returns a Fsret_read on the request page,
+     * or the data after it for multi-page request */
     FSREQ_READ,
     FSREQ_WRITE,
     /* Stat returns a Fsret_stat on the request page */
     FSREQ_STAT,
     FSREQ_FLUSH,
     FSREQ_REMOVE,
-    FSREQ_SYNC
+    FSREQ_SYNC,
+    /* Map maps block cache pages of file range read-only
+     * and returns number of valid bytes in them */
+    FSREQ_MAP,
+    /* Close flushes the file and frees it on the server
+     * once no other client has its Fd mapped */
+    FSREQ_CLOSE,
+    /* Stats returns a Fsret_stats on the request page */
+    FSREQ_STATS
+};
+
+#define NFSREQ (FSREQ_STATS + 1)
+
+/* Request latency histogram: bucket i counts requests that took
+ * less than 2^(FSSTAT_SHIFT + i) TSC cycles, the last one the rest */
+#define FSSTAT_BUCKETS 24
+#define FSSTAT_SHIFT   10
+
+/* Counters of one request type.  Latency is measured from
+ * receiving the request until replying, suspensions included */
+struct FsReqStat {
+    uint64_t count;
+    uint64_t bytes;  /* data read, written or mapped */
+    uint64_t cycles; /* total latency */
+    uint64_t max_cycles;
+    uint32_t hist[FSSTAT_BUCKETS];
 };
 
 union Fsipc {
@@ -89,6 +201,7 @@ union Fsipc {
     } set_size;
     struct Fsreq_read {
         int req_fileid;
+        off_t req_offset;
         size_t req_n;
     } read;
     struct Fsret_read {
@@ -96,6 +209,7 @@ union Fsipc {
     } readRet;
     struct Fsreq_write {
         int req_fileid;
+        off_t req_offset;
         size_t req_n;
         char req_buf[PAGE_SIZE - (2 * sizeof(size_t))];
     } write;
@@ -110,9 +224,34 @@ union Fsipc {
     struct Fsreq_flush {
         int req_fileid;
     } flush;
+    struct Fsreq_close {
+        int req_fileid;
+    } close;
     struct Fsreq_remove {
         char req_path[MAXPATHLEN];
     } remove;
+    struct Fsreq_map {
+        int req_fileid;
+        off_t req_offset; /* Must be block aligned */
+        size_t req_n;
+    } map;
+    struct Fsreq_stats {
+        int req_reset; /* Zero counters after reporting them */
+    } stats;
+    struct Fsret_stats {
+        struct FsReqStat ret_req[NFSREQ];
+        uint64_t ret_tsc_freq;
+        uint64_t ret_suspended;   /* requests suspended on cache misses */
+        uint64_t ret_bc_hits;     /* uses of cached blocks */
+        uint64_t ret_bc_misses;   /* blocks read on demand */
+        uint64_t ret_bc_readahead;
+        uint64_t ret_bc_evictions;
+        uint64_t ret_bc_resident;
+        uint64_t ret_disk_reads;  /* NVMe read commands */
+        uint64_t ret_disk_writes; /* NVMe write commands */
+        uint64_t ret_disk_read_bytes;
+        uint64_t ret_disk_write_bytes;
+    } statsRet;
 
     /* Ensure Fsipc is one page */
     char _pad[PAGE_SIZE];
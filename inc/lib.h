@@ -95,9 +95,12 @@ int sys_map_region(envid_t src_env, void *src_pg,
                    envid_t dst_env, void *dst_pg, size_t size, int perm);
 int sys_map_physical_region(uintptr_t pa, envid_t dst_env,
                             void *dst_pg, size_t size, int perm);
+int sys_alloc_dma_region(envid_t env, void *pg, int class, int perm, physaddr_t *pa);
+int sys_set_cache_region(envid_t env, void *pg, size_t size);
 int sys_unmap_region(envid_t env, void *pg, size_t size);
 int sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, size_t size, int perm);
 int sys_ipc_recv(void *rcv_pg, size_t size);
+int sys_ipc_try_recv(void *rcv_pg, size_t size);
 int sys_gettime(void);
 
 void *malloc(size_t n);
@@ -106,6 +109,7 @@ void *realloc(void *ptr, size_t newsize);
 void free(void *ptr);
 char* strdup (const char *src);
 
+uint64_t get_cpufreq();
 uint64_t get_ticks();
 void sleep(uint64_t);
 
@@ -125,9 +129,19 @@ sys_exofork(void) {
     return ret;
 }
 
+/* setjmp.S */
+typedef struct JmpBuf {
+    uint64_t jb_rip, jb_rsp, jb_rbp, jb_rbx;
+    uint64_t jb_r12, jb_r13, jb_r14, jb_r15;
+} jmp_buf[1];
+
+int setjmp(jmp_buf env) __attribute__((returns_twice));
+_Noreturn void longjmp(jmp_buf env, int val);
+
 /* ipc.c */
 void ipc_send(envid_t to_env, uint32_t value, void *pg, size_t size, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, size_t *psize, int *perm_store);
+int32_t ipc_try_recv(envid_t *from_env_store, void *pg, size_t *psize, int *perm_store);
 envid_t ipc_find_env(enum EnvType type);
 
 /* fork.c */
@@ -161,6 +175,11 @@ int open(const char *path, int mode);
 int ftruncate(int fd, off_t size);
 int remove(const char *path);
 int sync(void);
+int fsync(int fd);
+int flushall(void);
+int fsstats(struct Fsret_stats *stats, bool reset);
+ssize_t fmap(int fd, off_t offset, void *dstva, size_t n);
+ssize_t read_map(int fd, off_t offset, void **blk);
 
 /* spawn.c */
 envid_t spawn(const char *program, const char **argv);
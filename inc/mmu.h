@@ -145,6 +145,10 @@
 #define EFER_LMA (1ULL << 10)
 #define EFER_NXE (1ULL << 11)
 
+/* CPUID 0x80000001 EDX feature bits */
+#define CPUID_EXT_NX      (1U << 20) /* Execute disable bit */
+#define CPUID_EXT_PAGE1GB (1U << 26) /* 1GB pages */
+
 /* RFLAGS register */
 #define FL_CF        0x00000001 /* Carry Flag */
 #define FL_PF        0x00000004 /* Parity Flag */
@@ -19,6 +19,8 @@ enum {
     SYS_alloc_region,
     SYS_map_region,
     SYS_map_physical_region,
+    SYS_alloc_dma_region,
+    SYS_set_cache_region,
     SYS_unmap_region,
     SYS_region_refs,
     SYS_exofork,
@@ -28,6 +30,7 @@ enum {
     SYS_yield,
     SYS_ipc_try_send,
     SYS_ipc_recv,
+    SYS_ipc_try_recv,
     SYS_gettime,
     SYS_get_cpufreq,
     SYS_poll_kbd,
@@ -101,6 +101,8 @@ env_init(void) {
     /* Allocate envs array with kzalloc_region().
      * Don't forget about rounding.
      * kzalloc_region() only works with current_space != NULL */
+    static_assert(NENV * sizeof(*envs) <= UENVS_SIZE, "envs array does not fit into UENVS");
+
     if (current_space != NULL) {
         envs = kzalloc_region(NENV * sizeof(*envs));
         memset(envs, 0, ROUNDUP(NENV * sizeof(*envs), PAGE_SIZE));
@@ -200,6 +202,10 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
 
     /* Also clear the IPC receiving flag. */
     env->env_ipc_recving = 0;
+    env->env_ipc_polling = 0;
+
+    /* Nothing can be reclaimed until user declares cache region. */
+    env->env_cache_start = env->env_cache_end = 0;
 
     /* Commit the allocation */
     env_free_list = env->env_link;
@@ -262,6 +268,59 @@ bind_functions(struct Env *env, uint8_t *binary, size_t size, uintptr_t image_st
     return 0;
 }
 
+#ifndef CONFIG_KSPACE
+/* Read-only segments of embedded binaries are loaded once into
+ * text_space, each binary into its own slot, and then mapped
+ * into every environment created from that binary */
+#define SHARED_TEXT_SLOTS     64
+#define SHARED_TEXT_SLOT_SIZE (1 * GB)
+
+static struct AddressSpace text_space;
+static uint8_t *shared_text[SHARED_TEXT_SLOTS];
+
+static bool
+segment_is_shareable(struct Proghdr *ph) {
+    return ph->p_type == ELF_PROG_LOAD && !(ph->p_flags & ELF_PROG_FLAG_WRITE) &&
+           !(ph->p_va & CLASS_MASK(0)) && ph->p_filesz <= ph->p_memsz &&
+           ph->p_va + ph->p_memsz <= SHARED_TEXT_SLOT_SIZE;
+}
+
+/* Returns address of slot in text_space holding read-only segments
+ * of binary, loading them on first use, or 0 if there are no free slots */
+static uintptr_t
+shared_text_base(uint8_t *binary) {
+    struct Elf *elf = (void *)binary;
+    size_t i;
+
+    for (i = 0; i < SHARED_TEXT_SLOTS && shared_text[i]; i++)
+        if (shared_text[i] == binary) return (i + 1) * SHARED_TEXT_SLOT_SIZE;
+    if (i == SHARED_TEXT_SLOTS) return 0;
+
+    if (!text_space.pml4 && init_address_space(&text_space) < 0) return 0;
+
+    uintptr_t base = (i + 1) * SHARED_TEXT_SLOT_SIZE;
+    struct AddressSpace *old = switch_address_space(&text_space);
+    struct Proghdr *ph = (void *)(binary + elf->e_phoff);
+    for (size_t j = 0; j < elf->e_phnum; j++, ph++) {
+        if (!segment_is_shareable(ph)) continue;
+
+        uintptr_t va = base + ph->p_va;
+        size_t size = ROUNDUP(ph->p_memsz, PAGE_SIZE);
+        if (map_region(&text_space, va, NULL, 0, size, PROT_RWX | PROT_USER_ | ALLOC_ZERO) < 0) {
+            switch_address_space(old);
+            unmap_region(&text_space, base, SHARED_TEXT_SLOT_SIZE);
+            return 0;
+        }
+        memcpy((void *)va, binary + ph->p_offset, ph->p_filesz);
+        map_region(&text_space, va, &text_space, va, size, (ph->p_flags & 7) | PROT_USER_);
+    }
+    switch_address_space(old);
+
+    shared_text[i] = binary;
+    return base;
+}
+#endif
+
 /* Set up the initial program binary, stack, and processor flags
  * for a user process.
  * This function is ONLY called during kernel initialization,
@@ -326,6 +385,10 @@ load_icode(struct Env *env, uint8_t *binary, size_t size) {
         return -E_INVALID_EXE;
     }
 
+#ifndef CONFIG_KSPACE
+    uintptr_t text_base = shared_text_base(binary);
+#endif
+
     switch_address_space(&env->address_space);
     struct Proghdr * ph = (void *)(binary + elf->e_phoff);
     for (; (uint8_t *)ph < binary + elf->e_phoff + elf->e_phnum * elf->e_phentsize; ph++) {
@@ -337,7 +400,16 @@ load_icode(struct Env *env, uint8_t *binary, size_t size) {
             switch_address_space(&kspace);
             return -E_INVALID_EXE;
         }
-        
+
+#ifndef CONFIG_KSPACE
+        /* Share physical pages of read-only segments,
+         * fall back to private copy if that fails */
+        if (text_base && segment_is_shareable(ph) &&
+            !map_region(current_space, ph->p_va, &text_space, text_base + ph->p_va,
+                        ROUNDUP(ph->p_memsz, PAGE_SIZE), (ph->p_flags & 7) | PROT_USER_ | PROT_SHARE))
+            continue;
+#endif
+
         map_region(current_space, (uintptr_t)ph->p_va, NULL, 0, ROUNDUP(ph->p_memsz, PAGE_SIZE), PROT_RWX | PROT_USER_ | ALLOC_ZERO);
         
         memcpy((void *)ph->p_va, binary + ph->p_offset, ph->p_filesz);
@@ -410,7 +482,8 @@ env_free(struct Env *env) {
         switch_address_space(&kspace);
 
     static_assert(MAX_USER_ADDRESS % HUGE_PAGE_SIZE == 0, "Misaligned MAX_USER_ADDRESS");
-    release_address_space(&env->address_space);
+    /* Memory is returned in background by release_dead_spaces() */
+    defer_release_address_space(&env->address_space);
 #endif
 
     /* Return the environment to the free list */
@@ -532,6 +605,12 @@ env_run(struct Env *env) {
     curenv->env_status = ENV_RUNNING;
     curenv->env_runs++;
 
+    /* Non-blocking receive is over once the env gets the CPU back */
+    if (curenv->env_ipc_polling) {
+        curenv->env_ipc_polling = 0;
+        curenv->env_ipc_recving = 0;
+    }
+
     switch_address_space(&curenv->address_space);
     env_pop_tf(&curenv->env_tf);
 
@@ -159,6 +159,12 @@ i386_init(void) {
 
     //assert(false);
 
+    /* Scratch environment used by the check would
+     * show up in traced environment lists */
+#if defined(CONFIG_SELFTEST) && !defined(CONFIG_KSPACE) && !trace_envs
+    check_memory_features();
+#endif
+
 #ifdef CONFIG_KSPACE
     /* Touch all you want */
     ENV_CREATE_KERNEL_TYPE(prog_test1);
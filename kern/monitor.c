@@ -32,6 +32,10 @@ int mon_frequency(int argc, char **argv, struct Trapframe *tf);
 int mon_memory(int argc, char **argv, struct Trapframe *tf);
 int mon_pagetable(int argc, char **argv, struct Trapframe *tf);
 int mon_virt(int argc, char **argv, struct Trapframe *tf);
+int mon_compact(int argc, char **argv, struct Trapframe *tf);
+int mon_reclaim(int argc, char **argv, struct Trapframe *tf);
+int mon_vmstat(int argc, char **argv, struct Trapframe *tf);
+int mon_ksm(int argc, char **argv, struct Trapframe *tf);
 
 struct Command {
     const char *name;
@@ -51,6 +55,10 @@ static struct Command commands[] = {
         {"memory", "Display allocated memory pages", mon_memory},
         {"pagetable", "Display current page table", mon_pagetable},
         {"virt", "Display virtual memory tree", mon_virt},
+        {"compact", "Compact physical memory: compact [class [count]]", mon_compact},
+        {"reclaim", "Drop clean cache pages: reclaim [count]", mon_reclaim},
+        {"vmstat", "Display virtual memory statistics", mon_vmstat},
+        {"ksm", "Control same-page merging: ksm [on|off|scan [count]]", mon_ksm},
 };
 #define NCOMMANDS (sizeof(commands) / sizeof(commands[0]))
 
@@ -145,6 +153,60 @@ mon_virt(int argc, char **argv, struct Trapframe *tf) {
     return 0;
 }
 
+int
+mon_compact(int argc, char **argv, struct Trapframe *tf) {
+    int class = argc > 1 ? strtol(argv[1], NULL, 0) : MAX_ALLOCATION_CLASS;
+    int count = argc > 2 ? strtol(argv[2], NULL, 0) : 1;
+    if (class <= 0 || class >= MAX_CLASS) {
+        cprintf("Invalid page class %d\n", class);
+        return 0;
+    }
+
+    int done = 0;
+    while (done < count && !compact_memory(class)) done++;
+    cprintf("Freed %d of %d pages of class %d\n", done, count, class);
+    dump_compact_stats();
+    return 0;
+}
+
+int
+mon_reclaim(int argc, char **argv, struct Trapframe *tf) {
+    size_t count = argc > 1 ? strtol(argv[1], NULL, 0) : 256;
+
+    cprintf("Dropped %zu of %zu pages\n", reclaim_pages(count), count);
+    dump_reclaim_stats();
+    dump_release_stats();
+    return 0;
+}
+
+int
+mon_vmstat(int argc, char **argv, struct Trapframe *tf) {
+    dump_lookup_stats();
+    dump_compact_stats();
+    dump_reclaim_stats();
+    dump_release_stats();
+    dump_ksm_stats();
+    return 0;
+}
+
+int
+mon_ksm(int argc, char **argv, struct Trapframe *tf) {
+    if (argc > 1 && !strcmp(argv[1], "on")) {
+        ksm_enabled = 1;
+    } else if (argc > 1 && !strcmp(argv[1], "off")) {
+        ksm_enabled = 0;
+    } else if (argc > 1 && !strcmp(argv[1], "scan")) {
+        size_t count = argc > 2 ? strtol(argv[2], NULL, 0) : 1024;
+        cprintf("Scanned %zu pages\n", ksm_scan(count));
+    } else if (argc > 1) {
+        cprintf("Usage: ksm [on|off|scan [count]]\n");
+        return 0;
+    }
+
+    dump_ksm_stats();
+    return 0;
+}
+
 // LAB 4: Your code here
 int
 mon_dumpcmos(int argc, char **argv, struct Trapframe *tf) {
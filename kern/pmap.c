@@ -38,13 +38,60 @@ struct AddressSpace *current_space;
 struct Page root;
 /* Top address for page pools mappings */
 static uintptr_t metaheaptop;
-
-// TODO Test these properly via cpuid
+/* Physical block being evacuated by compact_memory(),
+ * alloc_page() never returns memory from it */
+static uintptr_t compact_start, compact_end;
+/* Compaction statistics */
+static size_t compact_runs, compact_success, compact_migrated, compact_skipped;
+/* Incremented whenever physical page loses a reference.  Compaction
+ * that failed can't succeed until then, so compact_memory() is not
+ * retried for a class before unref_generation passes compact_failed */
+static size_t unref_generation;
+static size_t compact_failed[MAX_CLASS];
+/* CLOCK hand of page reclaim */
+static size_t reclaim_hand_env;
+static uintptr_t reclaim_hand_va;
+/* Reclaim statistics */
+static size_t reclaim_runs, reclaim_scanned, reclaim_dropped;
+/* Class of virtual tree nodes kept in lookup cache (2MB) */
+#define LOOKUP_CACHE_CLASS 9
+#define LOOKUP_CACHE_SIZE  64
+/* Recently used 2MB slots of all address spaces.  It is not a part
+ * of struct AddressSpace, which users read through UENVS */
+static struct LookupCacheEntry {
+    struct AddressSpace *spc; /* Owner of the slot */
+    uintptr_t va;             /* Address of 2MB slot */
+    struct Page *node;        /* Virtual tree node describing the slot */
+} lookup_cache[LOOKUP_CACHE_SIZE];
+/* Virtual tree walk statistics */
+static size_t lookup_count, lookup_hits, lookup_levels;
+/* Page table pages allocated by alloc_pt() minus ones freed by remove_pt(),
+ * deltas of this counter are charged to address spaces */
+static size_t pt_pages_total;
+/* Address spaces of exited environments being released in background */
+static struct AddressSpace dead_spaces[DEAD_SPACE_COUNT];
+static size_t dead_count;
+/* Deferred release statistics */
+static size_t release_deferred, release_chunks;
+/* Same-page merging is done by idle CPU */
+bool ksm_enabled;
+/* Pages waiting for identical page to be found */
+static struct KsmEntry {
+    uint64_t hash;
+    envid_t envid;
+    uintptr_t va;
+    struct Page *phy;
+} ksm_table[KSM_TABLE_SIZE];
+/* Position of same-page merging scanner */
+static size_t ksm_hand_env;
+static uintptr_t ksm_hand_va;
+/* Same-page merging statistics */
+static size_t ksm_scanned, ksm_merged, ksm_zero, ksm_unmerged;
 
 /* Not-executable bit supported by page tables */
-static bool nx_supported = 1;
+static bool nx_supported;
 /* 1GB pages are supported */
-static bool has_1gb_pages = 1;
+static bool has_1gb_pages;
 
 /* Kernel executable end virtual address */
 extern char end[];
@@ -56,6 +103,10 @@ extern char pfstacktop[], pfstack[];
 #define ALLOC_WEAK 0x20000
 /* Allocate page within [0; BOOT_MEM_SIZE) */
 #define ALLOC_BOOTMEM 0x40000
+/* Mapping is pinned to its physical page (DMA buffers) */
+#define MAP_PINNED 0x80000
+/* Mapping was merged with identical page by ksm_scan() */
+#define MAP_MERGED 0x8000
 
 /* Descriptor pool page size */
 #define POOL_CLASS 1
@@ -69,6 +120,12 @@ extern char pfstacktop[], pfstack[];
 
 #define INIT_DESCR 256
 
+/* Number of pages reclaimed at once when allocation fails */
+#define RECLAIM_BATCH 32
+
+/* Virtual subtrees not larger than 2MB are released in one chunk */
+#define RELEASE_CHUNK_CLASS 9
+
 #define ABSDIFF(x, y) ((x) > (y) ? (x) - (y) : (y) - (x))
 
 #define assert_physical(n) ({ if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 1); assert(((n)->state & NODE_TYPE_MASK) >= PARTIAL_NODE); })
@@ -291,6 +348,7 @@ page_unref(struct Page *page) {
     }
 
     page->refc--;
+    unref_generation++;
 
     /* Try to merge free page with adjacent */
     if (PAGE_IS_FREE(page)) {
@@ -364,14 +422,35 @@ check_virtual_class(struct Page *node, int class) {
     assert(class == MAX_CLASS);
 }
 
+/* Lookup cache entry for 2MB slot of spc containing va */
+static struct LookupCacheEntry *
+lookup_cache_entry(struct AddressSpace *spc, uintptr_t va) {
+    size_t hash = (va >> (CLASS_BASE + LOOKUP_CACHE_CLASS)) ^ (uintptr_t)spc / sizeof(*spc);
+    return &lookup_cache[hash % LOOKUP_CACHE_SIZE];
+}
+
 /* Lookup virtual address space mapping node with given address and class */
 static struct Page *
-page_lookup_virtual(struct Page *node, uintptr_t addr, int class, int alloc) {
+page_lookup_virtual(struct AddressSpace *spc, uintptr_t addr, int class, int alloc) {
     assert(class >= 0);
-    assert_virtual(node);
-
+    assert_virtual(spc->root);
 
+    struct Page *node = spc->root;
     int nclass = MAX_CLASS;
+
+    /* Nodes at LOOKUP_CACHE_CLASS stay at their place in the tree
+     * until they are removed by unmap_page(), and the path from root
+     * to them consists only of intermediate nodes, so the walk
+     * can safely start from cached node */
+    struct LookupCacheEntry *ent = lookup_cache_entry(spc, addr);
+    uintptr_t slot = addr & ~CLASS_MASK(LOOKUP_CACHE_CLASS);
+    if (class <= LOOKUP_CACHE_CLASS && ent->node && ent->spc == spc && ent->va == slot) {
+        node = ent->node;
+        nclass = LOOKUP_CACHE_CLASS;
+        lookup_hits++;
+    }
+    lookup_count++;
+
     while (nclass > class) {
         assert(nclass > 0);
         bool right = addr & CLASS_SIZE(nclass - 1);
@@ -403,6 +482,8 @@ page_lookup_virtual(struct Page *node, uintptr_t addr, int class, int alloc) {
                 page_unref(node->phy);
                 node->phy = NULL;
                 node->state = INTERMEDIATE_NODE;
+                /* Halves of split 2MB mapping are not huge anymore */
+                if (nclass == 9) spc->stat.huge_bytes -= CLASS_SIZE(nclass);
             } else {
                 assert(node->state == INTERMEDIATE_NODE);
                 *next = alloc_descriptor(INTERMEDIATE_NODE);
@@ -412,6 +493,13 @@ page_lookup_virtual(struct Page *node, uintptr_t addr, int class, int alloc) {
         }
         node = *next;
         nclass--;
+        lookup_levels++;
+
+        if (nclass == LOOKUP_CACHE_CLASS) {
+            ent->spc = spc;
+            ent->va = slot;
+            ent->node = node;
+        }
     }
 
     if (node && (alloc == LOOKUP_ALLOC || (alloc == LOOKUP_SPLIT && node->phy)) && trace_memory_more) {
@@ -421,6 +509,29 @@ page_lookup_virtual(struct Page *node, uintptr_t addr, int class, int alloc) {
     return node;
 }
 
+/* Forget cached nodes of slots of spc within [start, end) */
+static void
+lookup_cache_invalidate(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
+    for (size_t i = 0; i < LOOKUP_CACHE_SIZE; i++) {
+        struct LookupCacheEntry *ent = &lookup_cache[i];
+        if (ent->node && ent->spc == spc && ent->va >= start && ent->va <= end - 1) ent->node = NULL;
+    }
+}
+
+/* Forget all cached nodes of spc */
+static void
+lookup_cache_forget(struct AddressSpace *spc) {
+    for (size_t i = 0; i < LOOKUP_CACHE_SIZE; i++)
+        if (lookup_cache[i].spc == spc) lookup_cache[i].node = NULL;
+}
+
+void
+dump_lookup_stats(void) {
+    cprintf("Virtual lookups: %zu, cache hits: %zu\n", lookup_count, lookup_hits);
+    if (lookup_count)
+        cprintf("Average tree walk depth: %zu\n", lookup_levels / lookup_count);
+}
+
 static void
 attach_region(uintptr_t start, uintptr_t end, enum PageState type) {
     if (trace_memory_more)
@@ -448,19 +559,33 @@ attach_region(uintptr_t start, uintptr_t end, enum PageState type) {
     }
 }
 
+/* Add (sign > 0) or subtract (sign < 0) mapping of given class and state
+ * to memory usage counters of address space */
+static void
+account_mapping(struct AddressSpace *spc, int class, int state, int sign) {
+    size_t size = CLASS_SIZE(class) * sign;
+
+    if (state & (PROT_SHARE | PROT_LAZY))
+        spc->stat.shared_bytes += size;
+    else
+        spc->stat.private_bytes += size;
+    if (class >= 9) spc->stat.huge_bytes += size;
+}
+
 static void
-unmap_page_remove(struct Page *node) {
+unmap_page_remove(struct AddressSpace *spc, struct Page *node) {
     if (!node) return;
     assert_virtual(node);
 
     if (node->phy) {
         assert(!node->left && !node->right);
         assert((node->state & NODE_TYPE_MASK) == MAPPING_NODE);
+        account_mapping(spc, node->phy->class, node->state, -1);
         page_unref(node->phy);
     } else {
         assert((node->state & NODE_TYPE_MASK) == INTERMEDIATE_NODE);
-        unmap_page_remove(node->left);
-        unmap_page_remove(node->right);
+        unmap_page_remove(spc, node->left);
+        unmap_page_remove(spc, node->right);
     }
 
     if (node->parent) {
@@ -483,6 +608,7 @@ remove_pt(pte_t *pt, pte_t base, size_t step, uintptr_t i0, uintptr_t i1) {
             pte_t *pt2 = KADDR(PTE_ADDR(pt[i]));
             remove_pt(pt2, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT);
             page_unref(page_lookup(NULL, (uintptr_t)PADDR(pt2), 0, PARTIAL_NODE, 0));
+            pt_pages_total--;
         }
 
         pt[i] = 0;
@@ -691,6 +817,7 @@ alloc_pt(pte_t *dst) {
 #endif
         assert(!page->refc);
         page_ref(page);
+        pt_pages_total++;
         *dst = page2pa(page) | PTE_U | PTE_W | PTE_P;
 
 #ifdef SANITIZE_SHADOW_BASE
@@ -794,7 +921,7 @@ static void
 tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
     if (current_space == spc || !current_space) {
         /* If we need to invalidate a lot of memory, just flush whole cache */
-        if (start - end > 512 * GB)
+        if (end - start > 512 * GB)
             lcr3(rcr3());
         else {
             while (start < end) {
@@ -811,9 +938,13 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
                               spc, addr, addr + (long)CLASS_MASK(class));
     int res;
     assert(!(addr & CLASS_MASK(class)));
+    size_t pt_before = pt_pages_total;
 
-    struct Page *node = page_lookup_virtual(spc->root, addr, class, LOOKUP_ALLOC);
-    if (node) unmap_page_remove(node);
+    struct Page *node = page_lookup_virtual(spc, addr, class, LOOKUP_ALLOC);
+    if (node) unmap_page_remove(spc, node);
+    /* Cached nodes are removed together with their subtree */
+    if (class >= LOOKUP_CACHE_CLASS)
+        lookup_cache_invalidate(spc, addr, addr + CLASS_SIZE(class));
     /* Disallow root node deallocation */
     if (node == spc->root)
         spc->root = alloc_descriptor(INTERMEDIATE_NODE);
@@ -828,7 +959,7 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
         goto finish;
     }
 
-    if (!(spc->pml4[pml4i0] & PTE_P)) return;
+    if (!(spc->pml4[pml4i0] & PTE_P)) goto account;
     pdpe_t *pdp = KADDR(PTE_ADDR(spc->pml4[pml4i0]));
 
     size_t pdpi0 = PDP_INDEX(addr), pdpi1 = PDP_INDEX(end);
@@ -847,7 +978,7 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
     /* If page is not present don't need to do anything */
 
     if (!(pdp[pdpi0] & PTE_P))
-        return;
+        goto account;
     /* otherwise we need to split 1*GB page hw page
      * into smaller 2*MB pages, allocting new page table level */
     else if (pdp[pdpi0] & PTE_PS) {
@@ -883,7 +1014,7 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
      */
 
     if (!(pd[pdi0] & PTE_P))
-        return;
+        goto account;
     else if (pd[pdi0] & PTE_PS) {
         pde_t old = pd[pdi0];
         res = alloc_pt(pd + pdi0);
@@ -909,8 +1040,13 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
 
 finish:
     tlb_invalidate_range(spc, inval_start, inval_end);
+account:
+    /* Splitting huge pages allocates page tables, removal frees them */
+    spc->stat.pt_pages += pt_pages_total - pt_before;
 }
 
+static int insert_page_pt(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags);
+
 static int
 map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags) {
     assert(!(flags & PROT_LAZY) | !(flags & PROT_SHARE));
@@ -925,22 +1061,32 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     if (!(flags & ALLOC_WEAK)) {
         page_ref(page);
         unmap_page(spc, addr, page->class);
-        struct Page *mapping = page_lookup_virtual(spc->root, addr, page->class, LOOKUP_ALLOC);
+        struct Page *mapping = page_lookup_virtual(spc, addr, page->class, LOOKUP_ALLOC);
         if (!mapping) return -E_NO_MEM;
 
         mapping->phy = page;
         mapping->state = (PAGE_PROT(flags) & ~PROT_COMBINE) | MAPPING_NODE;
         list_append((struct List *)page, (struct List *)mapping);
+        account_mapping(spc, page->class, mapping->state, 1);
     }
 
     if (trace_memory) cprintf("<%p> Mapping [%08lX, %08lX] to [%08lX, %08lX] (class=%d flags=%x)\n", spc,
                               page2pa(page), page2pa(page) + (long)CLASS_SIZE(page->class) - 1,
                               addr, addr + (long)CLASS_SIZE(page->class) - 1, page->class, flags);
 
-    /* Insert page into page table */
+    size_t pt_before = pt_pages_total;
+    int res = insert_page_pt(spc, addr, page, flags);
+    spc->stat.pt_pages += pt_pages_total - pt_before;
+    return res;
+}
+
+/* Insert page into page table */
+static int
+insert_page_pt(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags) {
 
     uintptr_t end = addr + CLASS_SIZE(page->class);
-    uintptr_t base = page2pa(page) | prot2pte(flags);
+    /* Newly mapped page counts as recently used for reclaim */
+    uintptr_t base = page2pa(page) | prot2pte(flags) | PTE_A;
     assert(!(page2pa(page) & CLASS_MASK(page->class)));
 
     size_t pml4i0 = PML4_INDEX(addr), pml4i1 = PML4_INDEX(end);
@@ -1056,6 +1202,10 @@ alloc_page(int class, int flags) {
     struct List *li = NULL;
     struct Page *peer = NULL;
 
+    /* Before switching to kspace only memory mapped by the
+     * bootloader is accessible. After that the whole physical memory
+     * is in the direct map, so pools and page tables can be anywhere
+     * (except with KASAN, where only shadow of boot memory is preallocated) */
     if (flags & ALLOC_POOL) flags |= ALLOC_BOOTMEM;
 #ifndef SANITIZE_SHADOW_BASE
     if (current_space) flags &= ~ALLOC_BOOTMEM;
@@ -1068,6 +1218,7 @@ alloc_page(int class, int flags) {
             peer = (struct Page *)li;
             assert(peer->state == ALLOCATABLE_NODE);
             assert_physical(peer);
+            if (page2pa(peer) < compact_end && page2pa(peer) + CLASS_SIZE(pclass) > compact_start) continue;
             if (!(flags & ALLOC_BOOTMEM) || page2pa(peer) + CLASS_SIZE(class) < BOOT_MEM_SIZE) goto found;
         }
     }
@@ -1118,13 +1269,250 @@ found:
     return new;
 }
 
+/* Find address space and virtual address of mapping node
+ * by walking up to the root of its virtual tree */
+static struct AddressSpace *
+mapping_owner(struct Page *node, uintptr_t *va) {
+    assert((node->state & NODE_TYPE_MASK) == MAPPING_NODE);
+
+    uintptr_t addr = 0;
+    for (int class = node->phy->class; node->parent; node = node->parent, class++)
+        if (node->parent->right == node) addr |= CLASS_SIZE(class);
+    *va = addr;
+
+    for (size_t i = 0; i < NENV; i++)
+        if (envs[i].env_status != ENV_FREE && envs[i].address_space.root == node)
+            return &envs[i].address_space;
+    return NULL;
+}
+
+/* Page can be migrated if it is an allocatable leaf
+ * and all of its references are unpinned user mappings.
+ * Drivers look up physical addresses of any of their pages
+ * and hand them to devices, so pages mapped by a driver
+ * environment are never moved. */
+static bool
+page_is_movable(struct Page *page) {
+    if (page->state != ALLOCATABLE_NODE || page->left || page->right) return 0;
+
+    uint32_t nmap = 0;
+    for (struct List *li = page->head.next; li != &page->head; li = li->next, nmap++) {
+        struct Page *map = (struct Page *)li;
+        uintptr_t va;
+        struct AddressSpace *spc = mapping_owner(map, &va);
+        if (map->state & MAP_PINNED || !spc || va >= MAX_USER_ADDRESS) return 0;
+
+        struct Env *env = (void *)((uint8_t *)spc - offsetof(struct Env, address_space));
+        if (env->env_type == ENV_TYPE_FS || env->env_type == ENV_TYPE_VS) return 0;
+    }
+
+    return nmap == page->refc;
+}
+
+/* Number of bytes to be migrated to free the whole
+ * physical subtree or -1 if it contains unmovable memory */
+static ssize_t
+compact_cost(struct Page *node) {
+    if (!node->left || !node->right) {
+        if (!node->refc) return node->state == ALLOCATABLE_NODE ? 0 : -1;
+        return page_is_movable(node) ? (ssize_t)CLASS_SIZE(node->class) : -1;
+    }
+    if (node->refc) return -1;
+
+    ssize_t left = compact_cost(node->left);
+    if (left < 0) return -1;
+    ssize_t right = compact_cost(node->right);
+    return right < 0 ? -1 : left + right;
+}
+
+/* Find block of given class which is the cheapest to evacuate */
+static struct Page *
+compact_find_block(struct Page *node, int class, ssize_t *best) {
+    if (node->class == class) {
+        ssize_t cost = compact_cost(node);
+        return cost > 0 && (*best < 0 || cost < *best) ? (*best = cost, node) : NULL;
+    }
+    if (!node->left || !node->right) return NULL;
+
+    struct Page *right = compact_find_block(node->right, class, best);
+    struct Page *left = compact_find_block(node->left, class, best);
+    return left ? left : right;
+}
+
+static struct Page *
+first_used_page(struct Page *node) {
+    if (!node->left || !node->right) return node->refc ? node : NULL;
+
+    struct Page *res = first_used_page(node->left);
+    return res ? res : first_used_page(node->right);
+}
+
+/* Copy page contents to a new page and redirect every mapping to it.
+ * Old page is freed after the last mapping is moved */
+static int
+migrate_page(struct Page *page) {
+    struct Page *new = alloc_page(page->class, 0);
+    if (!new) return -E_NO_MEM;
+
+    if (trace_memory) cprintf("Migrating page [%08lX, %08lX] to %08lX\n",
+                              page2pa(page), page2pa(page) + (long)CLASS_MASK(page->class), page2pa(new));
+
+    nosan_memcpy(KADDR(page2pa(new)), KADDR(page2pa(page)), CLASS_SIZE(page->class));
+
+    /* NOTE Descriptor of old page might be
+     * released by the last map_page() call */
+    for (uint32_t nmap = page->refc; nmap; nmap--) {
+        struct Page *map = (struct Page *)page->head.next;
+        uintptr_t va;
+        struct AddressSpace *spc = mapping_owner(map, &va);
+        assert(spc);
+
+        /* Merged mappings stay merged for ksm_unmerged accounting */
+        int res = map_page(spc, va, new, map->state & (PROT_ALL | MAP_MERGED));
+        if (res < 0) return res;
+    }
+
+    compact_migrated++;
+    return 0;
+}
+
+/* Create free physical page of given class by migrating
+ * movable user pages out of the cheapest suitable block */
+int
+compact_memory(int class) {
+    assert(class > 0 && class < MAX_CLASS);
+    assert(!compact_end);
+
+    /* Nothing was freed or unmapped since the last failure */
+    if (compact_failed[class] == unref_generation + 1) {
+        compact_skipped++;
+        return -E_NO_MEM;
+    }
+    compact_runs++;
+
+    ssize_t cost = -1;
+    struct Page *block = compact_find_block(&root, class, &cost);
+    if (!block) {
+        compact_failed[class] = unref_generation + 1;
+        return -E_NO_MEM;
+    }
+
+    compact_start = page2pa(block);
+    compact_end = compact_start + CLASS_SIZE(class);
+
+    if (trace_memory) cprintf("Compacting [%08lX, %08lX], %zd bytes to migrate\n",
+                              compact_start, compact_end - 1, cost);
+
+    int res = 0;
+    struct Page *node, *page;
+    while (!res && (node = page_lookup(NULL, compact_start, class, PARTIAL_NODE, 0)) &&
+           (page = first_used_page(node))) {
+        res = page_is_movable(page) ? migrate_page(page) : -E_NO_MEM;
+    }
+
+    compact_start = compact_end = 0;
+    if (!res) compact_success++;
+    else compact_failed[class] = unref_generation + 1;
+    return res;
+}
+
+void
+dump_compact_stats(void) {
+    cprintf("Compaction: %zu runs, %zu succeeded, %zu pages migrated, %zu skipped after failure\n",
+            compact_runs, compact_success, compact_migrated, compact_skipped);
+}
+
+/* Find 4KB page table entry for va. If there is none,
+ * NULL is returned and *step is set to the size of
+ * unmapped or huge mapped region containing va */
+static pte_t *
+lookup_pte(pte_t *pml4, uintptr_t va, size_t *step) {
+    *step = 512 * GB;
+    if (!(pml4[PML4_INDEX(va)] & PTE_P)) return NULL;
+
+    pdpe_t *pdp = KADDR(PTE_ADDR(pml4[PML4_INDEX(va)]));
+    *step = 1 * GB;
+    if (!(pdp[PDP_INDEX(va)] & PTE_P) || pdp[PDP_INDEX(va)] & PTE_PS) return NULL;
+
+    pde_t *pd = KADDR(PTE_ADDR(pdp[PDP_INDEX(va)]));
+    *step = 2 * MB;
+    if (!(pd[PD_INDEX(va)] & PTE_P) || pd[PD_INDEX(va)] & PTE_PS) return NULL;
+
+    pte_t *pt = KADDR(PTE_ADDR(pd[PD_INDEX(va)]));
+    *step = 4 * KB;
+    return pt + PT_INDEX(va);
+}
+
+/* Advance clock hand over cache region of env.
+ * Recently accessed pages get second chance,
+ * unique clean pages are dropped */
+static size_t
+reclaim_env_pages(struct Env *env, size_t count) {
+    struct AddressSpace *spc = &env->address_space;
+    uintptr_t va = MAX(reclaim_hand_va, env->env_cache_start);
+    size_t freed = 0, step;
+
+    while (va < env->env_cache_end && freed < count) {
+        pte_t *pte = lookup_pte(spc->pml4, va, &step);
+        if (pte && *pte & PTE_P) {
+            reclaim_scanned++;
+            if (*pte & PTE_A) {
+                *pte &= ~PTE_A;
+                tlb_invalidate_range(spc, va, va + PAGE_SIZE);
+            } else if (!(*pte & PTE_D)) {
+                struct Page *map = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+                if (map && map->phy && !map->phy->class && PAGE_IS_UNIQ(map->phy) &&
+                    !(map->state & (PROT_LAZY | PROT_SHARE | MAP_PINNED))) {
+                    unmap_page(spc, va, 0);
+                    freed++;
+                }
+            }
+        }
+        va = ROUNDDOWN(va, step) + step;
+    }
+
+    reclaim_hand_va = va;
+    return freed;
+}
+
+/* Free up to count pages by dropping clean pages
+ * from cache regions declared by environments
+ * (see sys_set_cache_region()) */
+size_t
+reclaim_pages(size_t count) {
+    size_t freed = 0;
+    reclaim_runs++;
+
+    /* Two turns of clock hand are enough for
+     * every page to use up its second chance */
+    for (size_t i = 0; i <= 2 * NENV && freed < count; i++) {
+        struct Env *env = &envs[reclaim_hand_env];
+        if (env->env_status != ENV_FREE && env->env_cache_end)
+            freed += reclaim_env_pages(env, count - freed);
+        if (freed < count) {
+            reclaim_hand_env = (reclaim_hand_env + 1) % NENV;
+            reclaim_hand_va = 0;
+        }
+    }
+
+    if (trace_memory) cprintf("Reclaimed %zu of %zu pages\n", freed, count);
+    reclaim_dropped += freed;
+    return freed;
+}
+
+void
+dump_reclaim_stats(void) {
+    cprintf("Reclaim: %zu runs, %zu pages scanned, %zu pages dropped\n",
+            reclaim_runs, reclaim_scanned, reclaim_dropped);
+}
+
 int
 region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size) {
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
     uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
     int res = 0;
     while (start < end) {
-        struct Page *page = page_lookup_virtual(spc->root, start, 0, LOOKUP_PRESERVE);
+        struct Page *page = page_lookup_virtual(spc, start, 0, LOOKUP_PRESERVE);
         if (page && page->phy) {
             res = MAX(res, page->phy->refc + (page->phy->left || page->phy->right));
             start += CLASS_SIZE(page->phy->class);
@@ -1202,6 +1590,15 @@ alloc_composite_page(struct AddressSpace *spc, uintptr_t addr, int class, int fl
     assert(!(addr & CLASS_MASK(class)));
 
     struct Page *page = alloc_page(class, flags);
+    /* Try to restore huge free pages before splitting allocation */
+    if (!page && class >= MAX_ALLOCATION_CLASS && !compact_end && !compact_memory(class))
+        page = alloc_page(class, flags);
+    /* Finish releasing exited address spaces before dropping caches */
+    while (!page && !class && release_dead_spaces(RELEASE_BATCH))
+        page = alloc_page(class, flags);
+    /* Drop clean cache pages when memory is exhausted */
+    if (!page && !class && reclaim_pages(RECLAIM_BATCH))
+        page = alloc_page(class, flags);
     if (page) {
         res = map_page(spc, addr, page, flags);
     } else if (class) {
@@ -1215,6 +1612,25 @@ alloc_composite_page(struct AddressSpace *spc, uintptr_t addr, int class, int fl
     return res;
 }
 
+/* Allocate physically contiguous zeroed page of given class
+ * and map it to address space. Mapping is created as shared and
+ * pinned, so it is never lazily copied and its physical address
+ * stays valid until the page is unmapped. */
+int
+alloc_dma_page(struct AddressSpace *spc, uintptr_t addr, int class, int flags, physaddr_t *pa) {
+    assert(!(flags & (PROT_LAZY | PROT_COMBINE)));
+    assert(!(addr & CLASS_MASK(class)));
+
+    struct Page *page = alloc_page(class, 0);
+    if (!page) return -E_NO_MEM;
+
+    nosan_memset(KADDR(page2pa(page)), 0, CLASS_SIZE(class));
+
+    int res = map_page(spc, addr, page, (flags & PROT_ALL) | PROT_SHARE | MAP_PINNED);
+    if (!res && pa) *pa = page2pa(page);
+    return res;
+}
+
 int
 force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
     int res = -E_FAULT;
@@ -1234,17 +1650,18 @@ force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
 
     /* Lookup page mapping such that it's class it not larger than MAX_ALLOCATION_CLASS */
     struct Page *page;
-    if (!(page = page_lookup_virtual(spc->root, va, maxclass, LOOKUP_SPLIT))) goto fault;
-    if (!(page = page_lookup_virtual(spc->root, va, 0, LOOKUP_PRESERVE))) goto fault;
+    if (!(page = page_lookup_virtual(spc, va, maxclass, LOOKUP_SPLIT))) goto fault;
+    if (!(page = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE))) goto fault;
     if (!(page->state & PROT_LAZY)) goto fault;
 
     va &= ~CLASS_MASK(page->phy->class);
+    if (page->state & MAP_MERGED) ksm_unmerged++;
 
     if (PAGE_IS_UNIQ(page->phy)) {
         /* If we have the only reference to the page and
          * and its mapping to itself we can actually just
          * disable lazy flag and not bother copying */
-        res = map_page(spc, va, page->phy, page->state & ~PROT_LAZY);
+        res = map_page(spc, va, page->phy, page->state & ~(PROT_LAZY | MAP_MERGED));
     } else {
         if (trace_memory) {
             cprintf("<%p> Allocating new page [%08lX, %08lX] flags=%x\n", spc,
@@ -1314,7 +1731,7 @@ do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *ssp
         res = force_alloc_page(sspace, src, MAX_CLASS);
         if (res < 0 || (sspace == dspace && src == dst)) return res;
 
-        struct Page *newv = page_lookup_virtual(sspace->root, src, class, LOOKUP_PRESERVE);
+        struct Page *newv = page_lookup_virtual(sspace, src, class, LOOKUP_PRESERVE);
         check_virtual_class(newv, class);
         assert(newv && newv->phy);
         phy = newv->phy;
@@ -1404,7 +1821,7 @@ do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct Addres
             }
         }
     } else {
-        struct Page *page1 = page_lookup_virtual(sspace->root, src, class, LOOKUP_ALLOC);
+        struct Page *page1 = page_lookup_virtual(sspace, src, class, LOOKUP_ALLOC);
         assert(page1);
         if (page1->phy && page1->phy->class > class) {
             /* We need to split physical page if part of it is remapped */
@@ -1478,6 +1895,419 @@ release_address_space(struct AddressSpace *space) {
     memset(space, 0, sizeof *space);
 }
 
+/* Release one bounded chunk of dead address space.
+ * Mappings are removed first, subtree by subtree,
+ * then user page tables, one 1GB range at a time.
+ * Returns true when space is fully released */
+static bool
+release_chunk(struct AddressSpace *space) {
+    struct Page *node = space->root;
+    uintptr_t va = 0;
+    int class = MAX_CLASS;
+
+    /* Find leftmost subtree small enough to be removed at once */
+    while (!node->phy && class > RELEASE_CHUNK_CLASS) {
+        if (node->left) {
+            node = node->left;
+        } else if (node->right) {
+            node = node->right;
+            va += CLASS_SIZE(class - 1);
+        } else break;
+        class--;
+    }
+
+    /* Page table entries are left dangling here,
+     * this is fine since space is never loaded again */
+    if (node != space->root) {
+        if (trace_memory_more) cprintf("<%p> Releasing [%08lX, %08lX]\n",
+                                       space, va, va + (long)CLASS_MASK(class));
+        unmap_page_remove(space, node);
+        return 0;
+    }
+
+    for (size_t i = 0; i < NUSERPML4; i++) {
+        if (!(space->pml4[i] & PTE_P)) continue;
+        pdpe_t *pdp = KADDR(PTE_ADDR(space->pml4[i]));
+        for (size_t j = 0; j < PDP_ENTRY_COUNT; j++) {
+            if (pdp[j] & PTE_P) {
+                remove_pt(pdp, 0, 1 * GB, j, j + 1);
+                return 0;
+            }
+        }
+        remove_pt(space->pml4, 0, 512 * GB, i, i + 1);
+        return 0;
+    }
+
+    release_address_space(space);
+    return 1;
+}
+
+/* Detach address space of exiting environment and queue it
+ * for incremental release by release_dead_spaces().
+ * Space should not be active at the moment */
+void
+defer_release_address_space(struct AddressSpace *space) {
+    assert(space != current_space);
+
+    /* Queue is full, make room synchronously */
+    if (dead_count == DEAD_SPACE_COUNT) {
+        while (!release_chunk(&dead_spaces[dead_count - 1])) release_chunks++;
+        dead_count--;
+    }
+
+    struct AddressSpace *dead = &dead_spaces[dead_count++];
+    *dead = *space;
+    /* Cached nodes are freed by release_chunk() */
+    lookup_cache_forget(space);
+    memset(space, 0, sizeof *space);
+    release_deferred++;
+}
+
+/* Release at most count chunks of dead address spaces.
+ * Returns number of chunks processed */
+size_t
+release_dead_spaces(size_t count) {
+    size_t done = 0;
+    while (dead_count && done < count) {
+        if (release_chunk(&dead_spaces[dead_count - 1])) dead_count--;
+        done++;
+    }
+    release_chunks += done;
+    return done;
+}
+
+void
+dump_release_stats(void) {
+    cprintf("Deferred release: %zu spaces queued, %zu pending, %zu chunks released\n",
+            release_deferred, dead_count, release_chunks);
+}
+
+/* Find first mapping in subtree of node (of given class, starting at base)
+ * that ends after *va, store its start address to *va */
+static struct Page *
+next_mapping(struct Page *node, int class, uintptr_t base, uintptr_t *va) {
+    if (!node || base + CLASS_MASK(class) < *va) return NULL;
+    if (node->phy) {
+        *va = base;
+        return node;
+    }
+
+    struct Page *res = next_mapping(node->left, class - 1, base, va);
+    if (!res) res = next_mapping(node->right, class - 1, base + CLASS_SIZE(class - 1), va);
+    return res;
+}
+
+static bool
+ksm_env_alive(struct Env *env) {
+    return env->env_type == ENV_TYPE_USER &&
+           (env->env_status == ENV_RUNNABLE || env->env_status == ENV_RUNNING ||
+            env->env_status == ENV_NOT_RUNNABLE);
+}
+
+/* Private anonymous 4KB pages are merge candidates */
+static bool
+ksm_mergeable(struct Env *env, uintptr_t va, struct Page *node) {
+    return !node->phy->class && PAGE_IS_UNIQ(node->phy) && node->phy->state == ALLOCATABLE_NODE &&
+           node->state & PROT_USER_ && !(node->state & (PROT_SHARE | PROT_LAZY | MAP_PINNED)) &&
+           (va < env->env_cache_start || va >= env->env_cache_end);
+}
+
+/* Returns mapping remembered in candidate table entry
+ * if it still maps the same physical page */
+static struct Page *
+ksm_lookup_entry(struct KsmEntry *ent, struct Env **penv) {
+    if (!ent->phy) return NULL;
+
+    struct Env *env = &envs[ENVX(ent->envid)];
+    if (env->env_id != ent->envid || !ksm_env_alive(env)) return NULL;
+
+    struct Page *node = page_lookup_virtual(&env->address_space, ent->va, 0, LOOKUP_PRESERVE);
+    if (!node || node->phy != ent->phy || node->state & (PROT_SHARE | MAP_PINNED)) return NULL;
+
+    *penv = env;
+    return node;
+}
+
+/* Hash page mapped by node and merge it either with
+ * zero page or with identical page found earlier */
+static void
+ksm_merge_one(struct Env *env, uintptr_t va, struct Page *node) {
+    struct Page *phy = node->phy;
+    uint64_t *data = KADDR(page2pa(phy));
+    uint64_t hash = 14695981039346656037ULL, bits = 0;
+
+    ksm_scanned++;
+
+    /* FNV-1a over 64-bit words */
+    for (size_t i = 0; i < PAGE_SIZE / sizeof(*data); i++) {
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+        bits |= data[i];
+    }
+
+    if (!bits) {
+        struct Page *zero = page_lookup(zero_page, page2pa(zero_page), 0, PARTIAL_NODE, 1);
+        if (zero && !map_page(&env->address_space, va, zero, PAGE_PROT(node->state) | PROT_LAZY | MAP_MERGED))
+            ksm_zero++;
+        return;
+    }
+
+    struct KsmEntry *ent = &ksm_table[hash % KSM_TABLE_SIZE];
+    struct Env *cenv;
+    struct Page *cnode;
+    /* Entry left by previous pass over this very page is not a match */
+    bool self = ent->phy == phy || (ent->envid == env->env_id && ent->va == va);
+    if (ent->hash == hash && !self && (cnode = ksm_lookup_entry(ent, &cenv)) &&
+        !memcmp(KADDR(page2pa(ent->phy)), data, PAGE_SIZE)) {
+        /* Both mappings become copy-on-write,
+         * force_alloc_page() splits them on write */
+        if (!(cnode->state & PROT_LAZY) &&
+            map_page(&cenv->address_space, ent->va, ent->phy, PAGE_PROT(cnode->state) | PROT_LAZY | MAP_MERGED) < 0)
+            return;
+        if (!map_page(&env->address_space, va, ent->phy, PAGE_PROT(node->state) | PROT_LAZY | MAP_MERGED))
+            ksm_merged++;
+        return;
+    }
+
+    ent->hash = hash;
+    ent->envid = env->env_id;
+    ent->va = va;
+    ent->phy = phy;
+}
+
+/* Scan up to count mapped pages of user environments
+ * merging identical anonymous pages.
+ * Returns number of pages scanned */
+size_t
+ksm_scan(size_t count) {
+    size_t done = 0;
+
+    while (done < count) {
+        struct Env *env = &envs[ksm_hand_env];
+        struct Page *node = NULL;
+
+        if (ksm_env_alive(env) && ksm_hand_va < MAX_USER_ADDRESS)
+            node = next_mapping(env->address_space.root, MAX_CLASS, 0, &ksm_hand_va);
+
+        if (!node || ksm_hand_va >= MAX_USER_ADDRESS) {
+            ksm_hand_va = 0;
+            ksm_hand_env = (ksm_hand_env + 1) % NENV;
+            /* Stop after full pass */
+            if (!ksm_hand_env) break;
+            continue;
+        }
+
+        uintptr_t va = ksm_hand_va;
+        ksm_hand_va += CLASS_SIZE(node->phy->class);
+        if (ksm_mergeable(env, va, node)) {
+            ksm_merge_one(env, va, node);
+            done++;
+        }
+    }
+
+    return done;
+}
+
+void
+dump_ksm_stats(void) {
+    cprintf("Same-page merging: %s, %zu pages scanned, %zu merged, %zu merged with zero page, %zu unmerged\n",
+            ksm_enabled ? "on" : "off", ksm_scanned, ksm_merged, ksm_zero, ksm_unmerged);
+}
+
+#ifdef CONFIG_SELFTEST
+/* Map page filled with given byte at va of scratch address space */
+static struct Page *
+check_map(struct AddressSpace *spc, uintptr_t va, int fill) {
+    int res = alloc_composite_page(spc, va, 0, PROT_R | PROT_W | PROT_USER_);
+    assert(!res);
+
+    struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+    assert(node && node->phy);
+    nosan_memset(KADDR(page2pa(node->phy)), fill, PAGE_SIZE);
+    return node->phy;
+}
+
+/* Returns physical page mapped at va or NULL */
+static struct Page *
+check_phy(struct AddressSpace *spc, uintptr_t va) {
+    struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+    return node ? node->phy : NULL;
+}
+
+static void
+check_filled(struct Page *page, int fill) {
+    uint8_t *data = KADDR(page2pa(page));
+    for (size_t i = 0; i < PAGE_SIZE; i++)
+        assert(data[i] == fill);
+}
+
+static void
+check_compaction(struct Env *env, uintptr_t va) {
+    struct AddressSpace *spc = &env->address_space;
+    struct Page *page = check_map(spc, va, 0x27);
+    assert(page_is_movable(page));
+
+    /* Drivers hand physical addresses to devices */
+    env->env_type = ENV_TYPE_FS;
+    assert(!page_is_movable(page));
+    env->env_type = ENV_TYPE_USER;
+
+    /* Merged mapping is moved with its flags */
+    assert(!map_page(spc, va, page, PROT_R | PROT_USER_ | PROT_LAZY | MAP_MERGED));
+    physaddr_t old = page2pa(page);
+    assert(!migrate_page(page));
+
+    struct Page *node = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+    assert(node && node->phy && page2pa(node->phy) != old);
+    assert((node->state & (PROT_LAZY | MAP_MERGED)) == (PROT_LAZY | MAP_MERGED));
+    check_filled(node->phy, 0x27);
+
+    /* Scratch page is the only movable memory at this point,
+     * so if its buddy is free the block holding it is the only
+     * candidate for compaction */
+    page = node->phy;
+    struct Page *buddy = page->parent->left == page ? page->parent->right : page->parent->left;
+    if (!buddy->refc && buddy->state == ALLOCATABLE_NODE && !buddy->left && !buddy->right) {
+        old = page2pa(page);
+        assert(!compact_memory(1));
+        page = check_phy(spc, va);
+        assert(page && page2pa(page) != old);
+        check_filled(page, 0x27);
+    }
+
+    /* Failed compaction is not retried until a page is unreferenced */
+    size_t runs = compact_runs;
+    compact_failed[1] = unref_generation + 1;
+    assert(compact_memory(1) && compact_runs == runs);
+    unmap_page(spc, va, 0);
+    assert(compact_failed[1] != unref_generation + 1);
+    check_map(spc, va, 0x27);
+
+    /* Pinned pages never move */
+    assert(!alloc_dma_page(spc, va + PAGE_SIZE, 0, PROT_R | PROT_W | PROT_USER_, NULL));
+    assert(!page_is_movable(check_phy(spc, va + PAGE_SIZE)));
+
+    if (trace_init) cprintf("Memory compaction is correct\n");
+}
+
+static void
+check_reclaim(struct Env *env, uintptr_t va) {
+    struct AddressSpace *spc = &env->address_space;
+    size_t step;
+
+    env->env_cache_start = va;
+    env->env_cache_end = va + 3 * PAGE_SIZE;
+    for (size_t i = 0; i < 3; i++) check_map(spc, va + i * PAGE_SIZE, 0x28);
+
+    /* Newly mapped pages are accessed, second one
+     * is made idle and the third one dirty */
+    pte_t *pte = lookup_pte(spc->pml4, va, &step);
+    assert(pte && *pte & PTE_A);
+    *lookup_pte(spc->pml4, va + PAGE_SIZE, &step) &= ~PTE_A;
+    *lookup_pte(spc->pml4, va + 2 * PAGE_SIZE, &step) |= PTE_D;
+
+    reclaim_hand_env = env - envs;
+    reclaim_hand_va = 0;
+    /* Accessed page gets second chance, idle one is dropped */
+    assert(reclaim_pages(1) == 1);
+    assert(check_phy(spc, va) && !(*pte & PTE_A));
+    assert(!check_phy(spc, va + PAGE_SIZE));
+
+    /* After full turn first page is dropped too, dirty page stays */
+    assert(reclaim_pages(2) == 1);
+    assert(!check_phy(spc, va));
+    assert(check_phy(spc, va + 2 * PAGE_SIZE));
+
+    env->env_cache_start = env->env_cache_end = 0;
+    if (trace_init) cprintf("Page reclaim is correct\n");
+}
+
+static void
+check_lookup_cache(struct AddressSpace *spc, uintptr_t va) {
+    struct LookupCacheEntry *ent = lookup_cache_entry(spc, va);
+    struct Page *page = check_map(spc, va, 0x29);
+    assert(ent->node && ent->spc == spc && ent->va == va);
+
+    /* Lookups below cached slot start from it */
+    size_t hits = lookup_hits;
+    assert(check_phy(spc, va + PAGE_SIZE) == NULL);
+    assert(check_phy(spc, va) == page);
+    assert(lookup_hits == hits + 2);
+
+    /* Removing the slot forgets cached node */
+    unmap_page(spc, va, LOOKUP_CACHE_CLASS);
+    assert(!ent->node);
+    assert(!check_phy(spc, va));
+
+    if (trace_init) cprintf("Virtual lookup cache is correct\n");
+}
+
+static void
+check_ksm(struct Env *env, uintptr_t va) {
+    struct AddressSpace *spc = &env->address_space;
+    size_t merged = ksm_merged, zero = ksm_zero, unmerged = ksm_unmerged;
+
+    check_map(spc, va, 0x34);
+    check_map(spc, va + PAGE_SIZE, 0x34);
+    check_map(spc, va + 2 * PAGE_SIZE, 0);
+    check_map(spc, va + 3 * PAGE_SIZE, 0x35);
+
+    ksm_hand_env = env - envs;
+    ksm_hand_va = 0;
+    ksm_scan(KSM_SCAN_BATCH);
+    assert(ksm_merged == merged + 1 && ksm_zero == zero + 1);
+
+    /* Unique page is not merged with itself on next pass */
+    ksm_hand_env = env - envs;
+    ksm_hand_va = 0;
+    ksm_scan(KSM_SCAN_BATCH);
+    assert(ksm_merged == merged + 1);
+    struct Page *unique = page_lookup_virtual(spc, va + 3 * PAGE_SIZE, 0, LOOKUP_PRESERVE);
+    assert(unique->state & PROT_W && !(unique->state & (PROT_LAZY | MAP_MERGED)));
+
+    /* Identical pages share one copy-on-write page */
+    struct Page *first = page_lookup_virtual(spc, va, 0, LOOKUP_PRESERVE);
+    struct Page *second = page_lookup_virtual(spc, va + PAGE_SIZE, 0, LOOKUP_PRESERVE);
+    assert(first->phy == second->phy);
+    assert((first->state & (PROT_LAZY | MAP_MERGED)) == (PROT_LAZY | MAP_MERGED));
+    assert((second->state & (PROT_LAZY | MAP_MERGED)) == (PROT_LAZY | MAP_MERGED));
+    assert(page2pa(check_phy(spc, va + 2 * PAGE_SIZE)) == page2pa(zero_page));
+
+    /* Write fault splits merged page */
+    assert(!force_alloc_page(spc, va + PAGE_SIZE, 0));
+    assert(ksm_unmerged == unmerged + 1);
+    second = page_lookup_virtual(spc, va + PAGE_SIZE, 0, LOOKUP_PRESERVE);
+    assert(second->phy != check_phy(spc, va));
+    assert(!(second->state & (PROT_LAZY | MAP_MERGED)));
+    check_filled(second->phy, 0x34);
+
+    /* Forget candidates of scratch environment */
+    memset(ksm_table, 0, sizeof(ksm_table));
+    ksm_hand_env = ksm_hand_va = 0;
+    if (trace_init) cprintf("Same-page merging is correct\n");
+}
+
+/* Exercise memory management policies on
+ * a scratch environment before any other
+ * user environment is created */
+void
+check_memory_features(void) {
+    struct Env *env;
+    int res = env_alloc(&env, 0, ENV_TYPE_USER);
+    assert(!res);
+
+    check_compaction(env, (uintptr_t)UTEMP);
+    check_reclaim(env, (uintptr_t)UTEMP + HUGE_PAGE_SIZE);
+    check_lookup_cache(&env->address_space, (uintptr_t)UTEMP + 2 * HUGE_PAGE_SIZE);
+    check_ksm(env, (uintptr_t)UTEMP + 3 * HUGE_PAGE_SIZE);
+
+    env_free(env);
+    while (release_dead_spaces(RELEASE_BATCH))
+        ;
+    /* Keep ids of boot environments the same as without the check */
+    env->env_id = 0;
+}
+#endif
+
 
 /*
  * This function is used for switch address spaces
@@ -1517,6 +2347,9 @@ init_address_space(struct AddressSpace *space) {
     /* Allocate virtual tree root node
      * of type INTERMEDIATE_NODE with alloc_rescriptor() of type */
     space->root = alloc_descriptor(INTERMEDIATE_NODE);
+    lookup_cache_forget(space);
+    memset(&space->stat, 0, sizeof(space->stat));
+    space->stat.pt_pages = 1;
 
     /* Initialize UVPT */
     space->pml4[PML4_INDEX(UVPT)] = space->cr3 | PTE_P | PTE_U;
@@ -1615,6 +2448,21 @@ detect_memory(void) {
     assert(!((uintptr_t)zero_page_raw & (HUGE_PAGE_SIZE - 1)));
 }
 
+/* Query paging features used in page table entries */
+static void
+detect_paging_features(void) {
+    uint32_t maxleaf, edx = 0;
+    cpuid(0x80000000, &maxleaf, NULL, NULL, NULL);
+    if (maxleaf >= 0x80000001)
+        cpuid(0x80000001, NULL, NULL, NULL, &edx);
+
+    nx_supported = !!(edx & CPUID_EXT_NX);
+    has_1gb_pages = !!(edx & CPUID_EXT_PAGE1GB);
+
+    if (trace_init) cprintf("Paging features: NX %s, 1GB pages %s\n",
+                            nx_supported ? "yes" : "no", has_1gb_pages ? "yes" : "no");
+}
+
 static void
 init_allocator(void) {
     static struct Page initial_buffer[INIT_DESCR];
@@ -1761,6 +2609,8 @@ init_memory(void) {
     init_allocator();
     if (trace_init) cprintf("Memory allocator is initialized\n");
 
+    detect_paging_features();
+
     detect_memory();
     check_physical_tree(&root);
     if (trace_init) cprintf("Physical memory tree is correct\n");
@@ -1826,9 +2676,11 @@ init_memory(void) {
     lcr4(CR4_PSE | CR4_PAE | CR4_PCE);
 
     /* Enable NX bit (execution protection) */
-    uint64_t efer = rdmsr(EFER_MSR);
-    efer |= EFER_NXE;
-    wrmsr(EFER_MSR, efer);
+    if (nx_supported) {
+        uint64_t efer = rdmsr(EFER_MSR);
+        efer |= EFER_NXE;
+        wrmsr(EFER_MSR, efer);
+    }
 
     for (size_t i = 0; i < CLASS_SIZE(MAX_ALLOCATION_CLASS); i++)
         assert(!zero_page_raw[i]);
@@ -1919,9 +2771,8 @@ int
 user_mem_check(struct Env *env, const void *va, size_t len, int perm) {
     const void *current = (void *)ROUNDDOWN(va, PAGE_SIZE);
     const void *end = va + len;
-    struct Page *user_root = env->address_space.root;
     while (current < end) {
-        struct Page *page = page_lookup_virtual(user_root, (uintptr_t)current, 0, 0);
+        struct Page *page = page_lookup_virtual(&env->address_space, (uintptr_t)current, 0, 0);
         if (!page->phy || (page->state & PAGE_PROT(perm)) != PAGE_PROT(perm)) {
             user_mem_check_addr = (uintptr_t)(MAX(va, current));
             return -E_FAULT;
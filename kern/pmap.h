@@ -35,6 +35,15 @@ void __nosan_memmove(void *, void *, size_t);
 
 #define MAX_CLASS 48
 
+/* Maximal number of exited address spaces awaiting release */
+#define DEAD_SPACE_COUNT 16
+/* Chunks of dead address spaces released when CPU is idle */
+#define RELEASE_BATCH 64
+/* Pages scanned for merging when CPU is idle */
+#define KSM_SCAN_BATCH 64
+/* Number of merge candidates remembered by ksm_scan() */
+#define KSM_TABLE_SIZE 512
+
 #define POOL_ENTRIES_FOR_SIZE(sz) (((sz)-offsetof(struct PagePool, data)) / sizeof(struct Page))
 
 #define KB 1024LL
@@ -109,15 +118,29 @@ int map_physical_region(struct AddressSpace *dst, uintptr_t dstart, uintptr_t ps
 void unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size);
 void init_memory(void);
 void release_address_space(struct AddressSpace *space);
+void defer_release_address_space(struct AddressSpace *space);
+size_t release_dead_spaces(size_t count);
+size_t ksm_scan(size_t count);
 struct AddressSpace *switch_address_space(struct AddressSpace *space);
 int init_address_space(struct AddressSpace *space);
 int user_mem_check(struct Env *env, const void *va, size_t len, int perm);
 void user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
 int region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size);
+int alloc_dma_page(struct AddressSpace *spc, uintptr_t addr, int class, int flags, physaddr_t *pa);
 int force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass);
+int compact_memory(int class);
+size_t reclaim_pages(size_t count);
 void dump_page_table(pte_t *pml4);
 void dump_memory_lists(void);
+void dump_compact_stats(void);
+void dump_reclaim_stats(void);
+void dump_release_stats(void);
+void dump_ksm_stats(void);
+void dump_lookup_stats(void);
 void dump_virtual_tree(struct Page *node, int class);
+#ifdef CONFIG_SELFTEST
+void check_memory_features(void);
+#endif
 
 void *kzalloc_region(size_t size);
 
@@ -126,6 +149,7 @@ void *mmio_remap_last_region(physaddr_t addr, void *oldva, size_t oldsz, size_t
 
 extern struct AddressSpace kspace;
 extern struct AddressSpace *current_space;
+extern bool ksm_enabled;
 extern struct Page root;
 extern char bootstacktop[], bootstack[];
 extern size_t max_memory_map_addr;
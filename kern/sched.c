@@ -2,6 +2,7 @@
 #include <inc/x86.h>
 #include <kern/env.h>
 #include <kern/monitor.h>
+#include <kern/pmap.h>
 
 
 struct Taskstate cpu_ts;
@@ -26,6 +27,9 @@ sched_yield(void) {
     int start_id = curenv ? ENVX(curenv->env_id) : NENV;
     int cur_id = start_id;
 
+    /* Make some progress releasing exited address spaces */
+    release_dead_spaces(1);
+
     while (1) {
         cur_id = (cur_id + 1) % NENV;
         if (envs[cur_id].env_status == ENV_RUNNABLE ||
@@ -54,10 +58,17 @@ sched_halt(void) {
         if (envs[i].env_status == ENV_RUNNABLE ||
             envs[i].env_status == ENV_RUNNING) break;
     if (i == NENV) {
+        while (release_dead_spaces(RELEASE_BATCH))
+            ;
         cprintf("No runnable environments in the system!\n");
         for (;;) monitor(NULL);
     }
 
+    /* Use idle time to release exited address spaces,
+     * the rest is done on next timer interrupts */
+    release_dead_spaces(RELEASE_BATCH);
+    if (ksm_enabled) ksm_scan(KSM_SCAN_BATCH);
+
     /* Mark that no environment is running on CPU */
     curenv = NULL;
 
@@ -266,6 +266,62 @@ sys_map_physical_region(uintptr_t pa, envid_t envid, uintptr_t va, size_t size,
     return map_physical_region(&env_fs->address_space, va, pa, size, perm | PROT_USER_ | MAP_USER_MMIO);
 }
 
+/* Allocate physically contiguous region of size CLASS_SIZE(class)
+ * and map it at 'va' in envid's address space. The region is zeroed,
+ * shared and pinned, so its physical address never changes and can be
+ * handed to devices for DMA. Caching mode is selected with perm:
+ * write-back by default, PROT_WC for write-combining, PROT_CD for uncached.
+ * Like sys_map_physical_region() this is only meant for userspace drivers.
+ *
+ * Return physical address of the region on success, < 0 on error. Errors are:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *      or the caller doesn't have permission to change envid.
+ *  -E_BAD_ENV if envid is not a driver (ENV_TYPE_FS or ENV_TYPE_VS).
+ *  -E_INVAL if class is larger than MAX_ALLOCATION_CLASS.
+ *  -E_INVAL if va >= MAX_USER_ADDRESS, or va is not aligned on region size.
+ *  -E_INVAL if perm contains invalid flags
+ *     (including PROT_SHARE, PROT_COMBINE or PROT_LAZY).
+ *  -E_NO_MEM if there's no contiguous memory of this size. */
+static int64_t
+sys_alloc_dma_region(envid_t envid, uintptr_t va, int class, int perm) {
+    struct Env *env;
+    if (envid2env(envid, &env, true) || (env->env_type != ENV_TYPE_FS && env->env_type != ENV_TYPE_VS))
+        return -E_BAD_ENV;
+
+    if (class < 0 || class > MAX_ALLOCATION_CLASS || va >= MAX_USER_ADDRESS ||
+        va & CLASS_MASK(class) || MAX_USER_ADDRESS - va < CLASS_SIZE(class) ||
+        perm & ~PROT_ALL || perm & (PROT_SHARE | PROT_COMBINE | PROT_LAZY))
+        return -E_INVAL;
+
+    physaddr_t pa;
+    int res = alloc_dma_page(&env->address_space, va, class, perm | PROT_USER_, &pa);
+    return res < 0 ? res : (int64_t)pa;
+}
+
+/* Declare region of envid's address space as a cache of data
+ * which the environment can fetch again on page fault, like the
+ * block cache of the file system server. Unique clean pages of
+ * this region may be dropped by the kernel under memory pressure.
+ * Zero size removes the region.
+ *
+ * Return 0 on success, < 0 on error. Errors are:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *      or the caller doesn't have permission to change envid.
+ *  -E_INVAL if va or size is not page-aligned,
+ *      or region is not a part of user space. */
+static int
+sys_set_cache_region(envid_t envid, uintptr_t va, size_t size) {
+    struct Env *env;
+    if (envid2env(envid, &env, 1))
+        return -E_BAD_ENV;
+    if (PAGE_OFFSET(va) || PAGE_OFFSET(size) || va >= MAX_USER_ADDRESS || MAX_USER_ADDRESS - va < size)
+        return -E_INVAL;
+
+    env->env_cache_start = va;
+    env->env_cache_end = va + size;
+    return 0;
+}
+
 /* Try to send 'value' to the target env 'envid'.
  * If srcva < MAX_USER_ADDRESS, then also send region currently mapped at 'srcva',
  * so that receiver gets mapping.
@@ -337,6 +393,9 @@ sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, in
     env->env_ipc_value = value;
     env->env_ipc_from = curenv->env_id;
     env->env_status = ENV_RUNNABLE;
+    /* Non-blocking receiver returns -E_IPC_NOT_RECV unless this happens */
+    if (env->env_ipc_polling)
+        env->env_tf.tf_regs.reg_rax = 0;
     return 0;
 }
 
@@ -370,6 +429,30 @@ sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize) {
     return 0;
 }
 
+/* Like sys_ipc_recv(), but don't block.  The environment stays runnable
+ * and gives up the CPU once, any sender running meanwhile may deliver
+ * its message.  Receiving stops as soon as the environment runs again
+ * (see env_run()).
+ *
+ * Returns 0 if a message was received, -E_IPC_NOT_RECV if there was none,
+ * other errors are the same as for sys_ipc_recv(). */
+static int
+sys_ipc_try_recv(uintptr_t dstva, uintptr_t maxsize) {
+    if (PAGE_OFFSET(maxsize) || (dstva < MAX_USER_ADDRESS &&
+        (PAGE_OFFSET(dstva) || maxsize == 0)))
+        return -E_INVAL;
+
+    curenv->env_ipc_recving = 1;
+    curenv->env_ipc_polling = 1;
+    if (dstva < MAX_USER_ADDRESS) {
+        curenv->env_ipc_dstva = dstva;
+        curenv->env_ipc_maxsz = maxsize;
+    }
+    curenv->env_tf.tf_regs.reg_rax = -E_IPC_NOT_RECV;
+    sched_yield();
+    return 0;
+}
+
 /*
  * This function sets trapframe and is unsafe
  * so you need:
@@ -471,10 +554,16 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
             return sys_ipc_try_send((envid_t)a1, (uint32_t)a2, a3,(size_t)a4,(int)a5);
         case SYS_ipc_recv:
             return sys_ipc_recv(a1, a2);
+        case SYS_ipc_try_recv:
+            return sys_ipc_try_recv(a1, a2);
         case SYS_region_refs:
             return sys_region_refs(a1, (size_t)a2, a3, a4);
         case SYS_map_physical_region:
             return sys_map_physical_region(a1, (envid_t)a2, a3, (size_t)a4, (int)a5);
+        case SYS_alloc_dma_region:
+            return sys_alloc_dma_region((envid_t)a1, a2, (int)a3, (int)a4);
+        case SYS_set_cache_region:
+            return sys_set_cache_region((envid_t)a1, a2, (size_t)a3);
         case SYS_env_set_trapframe:
             return sys_env_set_trapframe((envid_t)a1, (struct Trapframe *)a2);
         case SYS_gettime:
@@ -344,6 +344,7 @@ trap(struct Trapframe *tf) {
         in_page_fault = 1;
 
         uintptr_t va = rcr2();
+        current_space->stat.faults++;
 
 #if defined(SANITIZE_USER_SHADOW_BASE) && LAB == 8
         /* NOTE: Hack!
@@ -4,14 +4,52 @@
 
 union Fsipc fsipcbuf __attribute__((aligned(PAGE_SIZE)));
 
+/* Region for multi-page reads and writes: request page
+ * followed by up to FSIPC_MAXDATA bytes of data */
+#define FSIPC_BULK 0xD0100000LL
+
+static union Fsipc *fsipcbulk;
+
+/* Client cache of file data.  Each file descriptor has a window of
+ * FBUF_SIZE bytes at an FBUF_SIZE aligned file offset, placed right
+ * after a request page of its own so that it is filled by a single
+ * multi-page request without copying.  Small reads are served from
+ * the window, which is refilled as a whole on miss, reading ahead.
+ * Small writes are collected in the window until they stop being
+ * contiguous, or until a read, stat, close, fsync() or flushall().
+ *
+ * Windows are private to the environment while struct Fd is shared
+ * with its children.  Writing changes to the server bumps fd_file.gen,
+ * and a window filled under an older generation is dropped, so that
+ * environments sharing a descriptor see each other's flushed writes.
+ * Changes made through other descriptors are only seen on a miss. */
+#define FBUF_SIZE   (16 * BLKSIZE)
+#define FBUF_BASE   0xD0200000LL
+#define FBUF_STRIDE (PAGE_SIZE + FBUF_SIZE)
+
+struct FileBuf {
+    int fb_fileid;    /* file id of cached file, 0 if none */
+    uint32_t fb_gen;  /* fd_file.gen window is valid for */
+    off_t fb_base;    /* file offset of window */
+    size_t fb_valid;  /* bytes of window read from file */
+    size_t fb_dstart; /* dirty part of window, empty if equal */
+    size_t fb_dend;
+};
+
+static struct FileBuf filebufs[MAXFD];
+static bool fbuf_mapped;
+
 /* Send an inter-environment request to the file server, and wait for
- * a reply.  The request body should be in fsipcbuf, and parts of the
- * response may be written back to fsipcbuf.
+ * a reply.  The request body should be in ipc, and parts of the
+ * response may be written back to it.
  * type: request code, passed as the simple integer IPC value.
- * dstva: virtual address at which to receive reply page, 0 if none.
+ * ipc, ipcsize: request region, one page unless data follows request.
+ * dstva: virtual address at which to receive reply region, 0 if none.
+ * size: at most how many bytes to receive at dstva, replaced by
+ *       size of region actually received.
  * Returns result from the file server. */
 static int
-fsipc(unsigned type, void *dstva) {
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
     static envid_t fsenv;
 
     if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
@@ -20,15 +58,35 @@ fsipc(unsigned type, void *dstva) {
 
     if (debug) {
         cprintf("[%08x] fsipc %d %08x\n",
-                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+                thisenv->env_id, type, *(uint32_t *)ipc);
     }
 
-    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+    return ipc_recv(NULL, dstva, size, NULL);
+}
+
+/* Same as fsipc_region() with request in fsipcbuf
+ * and reply of at most one page */
+static int
+fsipc(unsigned type, void *dstva) {
     size_t maxsz = PAGE_SIZE;
-    return ipc_recv(NULL, dstva, &maxsz, NULL);
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+}
+
+/* Returns region for multi-page requests, reserving it on first use.
+ * Pages are allocated lazily, so only the touched part costs memory. */
+static union Fsipc *
+fsipc_bulk(void) {
+    if (!fsipcbulk) {
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+            return NULL;
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+    }
+    return fsipcbulk;
 }
 
 static int devfile_flush(struct Fd *fd);
+static int devfile_sync(struct Fd *fd);
 static ssize_t devfile_read(struct Fd *fd, void *buf, size_t n);
 static ssize_t devfile_write(struct Fd *fd, const void *buf, size_t n);
 static int devfile_stat(struct Fd *fd, struct Stat *stat);
@@ -89,67 +147,84 @@ open(const char *path, int mode) {
 /* Flush the file descriptor.  After this the fileid is invalid.
  *
  * This function is called by fd_close.  fd_close will take care of
- * unmapping the FD page from this environment.  Since the server uses
- * the reference counts on the FD pages to detect which files are
- * open, unmapping it is enough to free up server-side resources.
- * Other than that, we just have to make sure our changes are flushed
- * to disk. */
+ * unmapping the FD page from this environment.  FSREQ_CLOSE makes
+ * the server flush our changes to disk, and free its resources if
+ * no one else has the FD page mapped.  The server still detects
+ * files of environments which exited without closing them by the
+ * reference counts on the FD pages. */
 static int
 devfile_flush(struct Fd *fd) {
-    fsipcbuf.flush.req_fileid = fd->fd_file.id;
-    return fsipc(FSREQ_FLUSH, NULL);
+    int res = devfile_sync(fd);
+    if (fd2num(fd) < MAXFD) {
+        filebufs[fd2num(fd)].fb_fileid = 0;
+        /* Drop block mapped by read_map() */
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+    }
+
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+    return res < 0 ? res : res2;
 }
 
-/* Read at most 'n' bytes from 'fd' at the current position into 'buf'.
+/* Read at most 'n' bytes from 'fd' at 'offset' into 'buf'
+ * bypassing the client cache.  Seek position is not changed.
  *
  * Returns:
  *  The number of bytes successfully read.
  *  < 0 on error. */
 static ssize_t
-devfile_read(struct Fd *fd, void *buf, size_t n) {
-    /* Make an FSREQ_READ request to the file system server after
-     * filling fsipcbuf.read with the request arguments.  The
-     * bytes read will be written back to fsipcbuf by the file
-     * system server. */
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+    /* Make an FSREQ_READ request to the file system server with
+     * the request arguments followed by as many data pages as
+     * needed.  The bytes read will be written to the data pages
+     * by the file system server. */
+    union Fsipc *ipc = fsipc_bulk();
+    if (!ipc) return -E_NO_MEM;
+
     size_t i = 0;
     while (i < n) {
-        size_t read_now = MIN(n - i, PAGE_SIZE);
-        fsipcbuf.read.req_fileid = fd->fd_file.id;
-        fsipcbuf.read.req_n = read_now;
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+        ipc->read.req_fileid = fd->fd_file.id;
+        ipc->read.req_offset = offset + i;
+        ipc->read.req_n = read_now;
 
-        int res = fsipc(FSREQ_READ, NULL);
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
         if (res < 0)
             return res;
         if (res == 0)
             return i;
 
-        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
         i += res;
         buf += res;
     }
     return i;
 }
 
-/* Write at most 'n' bytes from 'buf' to 'fd' at the current seek position.
+/* Write at most 'n' bytes from 'buf' to 'fd' at 'offset' bypassing
+ * the client cache.  Seek position is not changed.
  *
  * Returns:
  *   The number of bytes successfully written.
  *   < 0 on error. */
 static ssize_t
-devfile_write(struct Fd *fd, const void *buf, size_t n) {
-    /* Make an FSREQ_WRITE request to the file system server.  Be
-     * careful: fsipcbuf.write.req_buf is only so large, but
-     * remember that write is always allowed to write *fewer*
-     * bytes than requested, so that multiple IPC requests are
-     * potentially required. */
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+    /* Make an FSREQ_WRITE request to the file system server with
+     * data in pages following the request.  Write is always allowed
+     * to write *fewer* bytes than requested, so that multiple IPC
+     * requests are potentially required. */
+    union Fsipc *ipc = fsipc_bulk();
+    if (!ipc) return -E_NO_MEM;
+
     size_t i = 0;
     while (i < n) {
-        size_t write_now = MIN(n - i, sizeof(fsipcbuf.write.req_buf));
-        memcpy(fsipcbuf.write.req_buf, buf, write_now);
-        fsipcbuf.write.req_fileid = fd->fd_file.id;
-        fsipcbuf.write.req_n = write_now;
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+        ipc->write.req_fileid = fd->fd_file.id;
+        ipc->write.req_offset = offset + i;
+        ipc->write.req_n = write_now;
 
-        int res = fsipc(FSREQ_WRITE, NULL);
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
         if (res < 0)
             return res;
         if (res == 0)
@@ -160,11 +235,181 @@ devfile_write(struct Fd *fd, const void *buf, size_t n) {
     return i;
 }
 
+static union Fsipc *
+fbuf_ipc(struct Fd *fd) {
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+}
+
+static char *
+fbuf_data(struct Fd *fd) {
+    return (char *)fbuf_ipc(fd) + PAGE_SIZE;
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+    if (fd2num(fd) >= MAXFD) return NULL;
+    if (!fbuf_mapped) {
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+            return NULL;
+        fbuf_mapped = 1;
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+    if (fb->fb_fileid != fd->fd_file.id) {
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+
+/* Note that the file was changed through fd */
+static void
+fbuf_changed(struct Fd *fd, struct FileBuf *fb) {
+    fd->fd_file.gen++;
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+    if (res < 0) return res;
+    if ((size_t)res < n) return -E_NO_DISK;
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+    fb->fb_dstart = fb->fb_dend = 0;
+    return 0;
+}
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+    struct FileBuf *fb = fbuf_get(fd);
+    return fb ? fbuf_flush(fd, fb) : 0;
+}
+
+/* Read at most 'n' bytes from 'fd' at the current position into 'buf'.
+ *
+ * Returns:
+ *  The number of bytes successfully read.
+ *  < 0 on error. */
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+    struct FileBuf *fb = fbuf_get(fd);
+    int res;
+
+    /* Large reads gain nothing from the cache */
+    if (!fb || n >= FBUF_SIZE) {
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+        if (cnt > 0) fd->fd_offset += cnt;
+        return cnt;
+    }
+
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+
+    union Fsipc *ipc = fbuf_ipc(fd);
+    size_t i = 0;
+    while (i < n) {
+        off_t pos = fd->fd_offset;
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+            /* Refill the whole window around pos */
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+            fb->fb_valid = 0;
+
+            ipc->read.req_fileid = fd->fd_file.id;
+            ipc->read.req_offset = fb->fb_base;
+            ipc->read.req_n = FBUF_SIZE;
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+            if (res < 0) return i ? (ssize_t)i : res;
+
+            fb->fb_valid = res;
+            if (pos >= fb->fb_base + res) break;
+        }
+
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+        fd->fd_offset = pos + cnt;
+        i += cnt;
+    }
+    return i;
+}
+
+/* Write at most 'n' bytes from 'buf' to 'fd' at the current seek position.
+ *
+ * Returns:
+ *   The number of bytes successfully written.
+ *   < 0 on error. */
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+    struct FileBuf *fb = fbuf_get(fd);
+    int res;
+
+    if (!fb || n >= FBUF_SIZE) {
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+        if (cnt > 0) {
+            fd->fd_offset += cnt;
+            fbuf_changed(fd, fb);
+            if (fb) fb->fb_valid = 0;
+        }
+        return cnt;
+    }
+
+    size_t i = 0;
+    while (i < n) {
+        off_t pos = fd->fd_offset;
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+            fb->fb_valid = 0;
+        }
+
+        size_t off = pos - fb->fb_base;
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+
+        /* Dirty part has to stay contiguous */
+        if (fb->fb_dstart != fb->fb_dend &&
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+        }
+
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+        if (fb->fb_dstart == fb->fb_dend) {
+            fb->fb_dstart = off;
+            fb->fb_dend = off + cnt;
+        } else {
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+        }
+        fd->fd_offset = pos + cnt;
+        i += cnt;
+    }
+    return i;
+}
+
 /* Get file information */
 static int
 devfile_stat(struct Fd *fd, struct Stat *st) {
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+    if (res < 0) return res;
+
     fsipcbuf.stat.req_fileid = fd->fd_file.id;
-    int res = fsipc(FSREQ_STAT, NULL);
+    res = fsipc(FSREQ_STAT, NULL);
     if (res < 0) return res;
 
     strcpy(st->st_name, fsipcbuf.statRet.ret_name);
@@ -177,10 +422,136 @@ devfile_stat(struct Fd *fd, struct Stat *st) {
 /* Truncate or extend an open file to 'size' bytes */
 static int
 devfile_trunc(struct Fd *fd, off_t newsize) {
+    struct FileBuf *fb = fbuf_get(fd);
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+
     fsipcbuf.set_size.req_fileid = fd->fd_file.id;
     fsipcbuf.set_size.req_size = newsize;
 
-    return fsipc(FSREQ_SET_SIZE, NULL);
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+    if (res >= 0) {
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+
+/* Map n bytes of file 'fdnum' starting at 'offset' read-only at
+ * 'dstva', without copying.  The pages are the file server's block
+ * cache pages, which it doesn't evict while they are mapped here,
+ * so later writes to the mapped range show through.  The mapping
+ * follows disk blocks rather than the file: once the range is
+ * truncated its pages may be reused for other data, so map again
+ * after the file shrinks.  Both 'offset' and 'dstva' must be page
+ * aligned.  The seek position is not changed.
+ *
+ * Returns:
+ *   The number of bytes of file data mapped, which is less than
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+    if (res < 0) return res;
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+    if ((res = devfile_sync(fd)) < 0) return res;
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+        fsipcbuf.map.req_offset = offset + i;
+        fsipcbuf.map.req_n = n - i;
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+        if (res < 0) return i ? (ssize_t)i : res;
+        i += res;
+        if ((size_t)res < size) break;
+    }
+    return i;
+}
+
+/* Map the block of file 'fdnum' containing 'offset' read-only and
+ * set *blk to the data at 'offset' in it.  The mapping stays valid
+ * until next read_map() on the same file descriptor or its close.
+ *
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+    if (res < 0) return res;
+    if (offset < 0) return -E_INVAL;
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+    if (n <= offset - base) return n < 0 ? n : 0;
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+    if (res < 0) return res;
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+    if ((res = devfile_sync(fd)) < 0) return res;
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+    return fsipc(FSREQ_FLUSH, NULL);
+}
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+            fd->fd_dev_id != devfile.dev_id) continue;
+
+        int res2 = devfile_sync(fd);
+        if (res2 < 0) res = res2;
+    }
+    return res;
+}
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+    fsipcbuf.stats.req_reset = reset;
+    int res = fsipc(FSREQ_STATS, NULL);
+    if (res < 0) return res;
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+    return 0;
+}
+
+/* Delete a file */
+int
+remove(const char *path) {
+    if (strlen(path) >= MAXPATHLEN)
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+    return fsipc(FSREQ_REMOVE, NULL);
 }
 
 /* Synchronize disk with buffer cache */
@@ -188,6 +559,7 @@ int
 sync(void) {
     /* Ask the file server to update the disk
      * by writing any dirty blocks in the buffer cache. */
+    flushall();
 
     return fsipc(FSREQ_SYNC, NULL);
 }
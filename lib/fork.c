@@ -18,6 +18,9 @@
  */
 envid_t
 fork(void) {
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+
     envid_t envid = sys_exofork();
     if (envid < 0)
         return envid;
@@ -10,6 +10,9 @@
  * If 'perm_store' is nonnull, then store the IPC sender's page permission
  *    in *perm_store (this is nonzero iff a page was successfully
  *    transferred to 'pg').
+ * If 'size' is nonnull, then at most *size bytes are mapped at 'pg'
+ *    (one page otherwise), and the size of mapped region is stored
+ *    back in *size.
  * If the system call fails, then store 0 in *fromenv and *perm (if
  *    they're nonnull) and return the error.
  * Otherwise, return the value sent by the sender
@@ -24,7 +27,7 @@ ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
     if (!pg)
         pg = (void *)MAX_USER_ADDRESS;
 
-    int errno = sys_ipc_recv(pg, PAGE_SIZE);
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
     if (errno) {
         if (from_env_store)
             *from_env_store = 0;
@@ -37,6 +40,9 @@ ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
         if (from_env_store)
             *from_env_store = thisenv->env_ipc_from;
 
+        if (size)
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+
         if (perm_store)
             *perm_store = thisenv->env_ipc_perm;
 
@@ -45,6 +51,37 @@ ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
     return -1;
 }
 
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+    if (errno) {
+        if (from_env_store)
+            *from_env_store = 0;
+
+        if (perm_store)
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+        *from_env_store = thisenv->env_ipc_from;
+
+    if (size)
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+
+    if (perm_store)
+        *perm_store = thisenv->env_ipc_perm;
+
+    return thisenv->env_ipc_value;
+}
+
 /* Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'toenv'.
  * This function keeps trying until it succeeds.
  * It should panic() on any error other than -E_IPC_NOT_RECV.
@@ -100,6 +100,9 @@ spawn(const char *prog, const char **argv) {
         return -E_NOT_EXEC;
     }
 
+    /* Let child see files as written so far */
+    flushall();
+
     /* Create new child environment */
     if ((int)(res = sys_exofork()) < 0) goto error2;
     envid_t child = res;
@@ -117,6 +117,23 @@ sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size,
     return res;
 }
 
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+    if (res < 0) return res;
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+}
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+}
+
 int
 sys_unmap_region(envid_t envid, void *va, size_t size) {
     int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
@@ -160,6 +177,15 @@ sys_ipc_recv(void *dstva, size_t size) {
     return res;
 }
 
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+
 int
 sys_gettime(void) {
     return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
@@ -0,0 +1,21497 @@
+
+obj/fs/fs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 f6 8e 00 00       	call   808f19 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <note_resident>:
+}
+
+/* Note that count blocks starting with blockno were mapped */
+static void
+note_resident(blockno_t blockno, blockno_t count) {
+    for (blockno_t b = blockno; b < blockno + count; b++) {
+  800025:	44 8d 14 37          	lea    (%rdi,%rsi,1),%r10d
+  800029:	44 39 d7             	cmp    %r10d,%edi
+  80002c:	0f 83 82 00 00 00    	jae    8000b4 <note_resident+0x8f>
+note_resident(blockno_t blockno, blockno_t count) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	41 54                	push   %r12
+  800038:	53                   	push   %rbx
+  800039:	89 f9                	mov    %edi,%ecx
+  80003b:	48 a1 90 60 81 00 00 	movabs 0x816090,%rax
+  800042:	00 00 00 
+    for (blockno_t b = blockno; b < blockno + count; b++) {
+  800045:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        if (!TSTBIT(resident_map, b)) {
+  80004b:	49 b9 a0 e1 85 00 00 	movabs $0x85e1a0,%r9
+  800052:	00 00 00 
+  800055:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+            SETBIT(resident_map, b);
+            bc_stats.resident++;
+  80005b:	bb 01 00 00 00       	mov    $0x1,%ebx
+        }
+        SETBIT(ref_map, b);
+  800060:	49 b8 a0 61 84 00 00 	movabs $0x8461a0,%r8
+  800067:	00 00 00 
+  80006a:	eb 0e                	jmp    80007a <note_resident+0x55>
+  80006c:	89 d2                	mov    %edx,%edx
+  80006e:	41 09 34 90          	or     %esi,(%r8,%rdx,4)
+    for (blockno_t b = blockno; b < blockno + count; b++) {
+  800072:	83 c1 01             	add    $0x1,%ecx
+  800075:	44 39 d1             	cmp    %r10d,%ecx
+  800078:	74 26                	je     8000a0 <note_resident+0x7b>
+        if (!TSTBIT(resident_map, b)) {
+  80007a:	89 ca                	mov    %ecx,%edx
+  80007c:	c1 ea 05             	shr    $0x5,%edx
+  80007f:	89 d6                	mov    %edx,%esi
+  800081:	41 8b 3c b1          	mov    (%r9,%rsi,4),%edi
+  800085:	44 89 de             	mov    %r11d,%esi
+  800088:	d3 e6                	shl    %cl,%esi
+  80008a:	85 f7                	test   %esi,%edi
+  80008c:	75 de                	jne    80006c <note_resident+0x47>
+            SETBIT(resident_map, b);
+  80008e:	41 89 d4             	mov    %edx,%r12d
+  800091:	09 f7                	or     %esi,%edi
+  800093:	43 89 3c a1          	mov    %edi,(%r9,%r12,4)
+            bc_stats.resident++;
+  800097:	48 83 c0 01          	add    $0x1,%rax
+  80009b:	41 89 dc             	mov    %ebx,%r12d
+  80009e:	eb cc                	jmp    80006c <note_resident+0x47>
+  8000a0:	45 84 e4             	test   %r12b,%r12b
+  8000a3:	74 0a                	je     8000af <note_resident+0x8a>
+  8000a5:	48 a3 90 60 81 00 00 	movabs %rax,0x816090
+  8000ac:	00 00 00 
+    }
+}
+  8000af:	5b                   	pop    %rbx
+  8000b0:	41 5c                	pop    %r12
+  8000b2:	5d                   	pop    %rbp
+  8000b3:	c3                   	ret
+  8000b4:	c3                   	ret
+
+00000000008000b5 <drop_resident>:
+
+static void
+drop_resident(blockno_t blockno) {
+  8000b5:	89 f9                	mov    %edi,%ecx
+    if (TSTBIT(ra_map, blockno)) {
+  8000b7:	89 f8                	mov    %edi,%eax
+  8000b9:	c1 e8 05             	shr    $0x5,%eax
+  8000bc:	89 c6                	mov    %eax,%esi
+  8000be:	48 ba a0 60 81 00 00 	movabs $0x8160a0,%rdx
+  8000c5:	00 00 00 
+  8000c8:	8b 34 b2             	mov    (%rdx,%rsi,4),%esi
+  8000cb:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000d0:	d3 e2                	shl    %cl,%edx
+  8000d2:	85 d6                	test   %edx,%esi
+  8000d4:	74 24                	je     8000fa <drop_resident+0x45>
+        CLRBIT(ra_map, blockno);
+  8000d6:	89 c1                	mov    %eax,%ecx
+  8000d8:	89 d7                	mov    %edx,%edi
+  8000da:	f7 d7                	not    %edi
+  8000dc:	21 fe                	and    %edi,%esi
+  8000de:	48 bf a0 60 81 00 00 	movabs $0x8160a0,%rdi
+  8000e5:	00 00 00 
+  8000e8:	89 34 8f             	mov    %esi,(%rdi,%rcx,4)
+        bc_stats.ra_waste++;
+  8000eb:	48 b9 20 60 81 00 00 	movabs $0x816020,%rcx
+  8000f2:	00 00 00 
+  8000f5:	48 83 41 28 01       	addq   $0x1,0x28(%rcx)
+    }
+    CLRBIT(resident_map, blockno);
+  8000fa:	f7 d2                	not    %edx
+  8000fc:	48 b9 a0 e1 85 00 00 	movabs $0x85e1a0,%rcx
+  800103:	00 00 00 
+  800106:	89 c0                	mov    %eax,%eax
+  800108:	21 14 81             	and    %edx,(%rcx,%rax,4)
+    CLRBIT(ref_map, blockno);
+  80010b:	48 b9 a0 61 84 00 00 	movabs $0x8461a0,%rcx
+  800112:	00 00 00 
+  800115:	21 14 81             	and    %edx,(%rcx,%rax,4)
+    bc_stats.resident--;
+  800118:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  80011f:	00 00 00 
+  800122:	48 83 68 70 01       	subq   $0x1,0x70(%rax)
+}
+  800127:	c3                   	ret
+
+0000000000800128 <mark_used>:
+
+/* Note use of cached block */
+static void
+mark_used(blockno_t blockno) {
+  800128:	89 f9                	mov    %edi,%ecx
+    SETBIT(ref_map, blockno);
+  80012a:	89 fe                	mov    %edi,%esi
+  80012c:	c1 ee 05             	shr    $0x5,%esi
+  80012f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800134:	d3 e0                	shl    %cl,%eax
+  800136:	48 b9 a0 61 84 00 00 	movabs $0x8461a0,%rcx
+  80013d:	00 00 00 
+  800140:	89 f2                	mov    %esi,%edx
+  800142:	09 04 91             	or     %eax,(%rcx,%rdx,4)
+    if (TSTBIT(ra_map, blockno)) {
+  800145:	48 b9 a0 60 81 00 00 	movabs $0x8160a0,%rcx
+  80014c:	00 00 00 
+  80014f:	8b 14 91             	mov    (%rcx,%rdx,4),%edx
+  800152:	85 d0                	test   %edx,%eax
+  800154:	74 18                	je     80016e <mark_used+0x46>
+        CLRBIT(ra_map, blockno);
+  800156:	89 f6                	mov    %esi,%esi
+  800158:	f7 d0                	not    %eax
+  80015a:	21 d0                	and    %edx,%eax
+  80015c:	89 04 b1             	mov    %eax,(%rcx,%rsi,4)
+        bc_stats.ra_hits++;
+  80015f:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  800166:	00 00 00 
+  800169:	48 83 40 20 01       	addq   $0x1,0x20(%rax)
+    }
+}
+  80016e:	c3                   	ret
+
+000000000080016f <read_slot>:
+}
+
+/* Returns slot of read in flight covering blockno, -1 if none */
+static int
+read_slot(blockno_t blockno) {
+    for (int i = 0; i < BC_INFLIGHT; i++)
+  80016f:	48 b8 e0 71 8a 00 00 	movabs $0x8a71e0,%rax
+  800176:	00 00 00 
+  800179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017e:	eb 0c                	jmp    80018c <read_slot+0x1d>
+  800180:	83 c2 01             	add    $0x1,%edx
+  800183:	48 83 c0 10          	add    $0x10,%rax
+  800187:	83 fa 08             	cmp    $0x8,%edx
+  80018a:	74 1a                	je     8001a6 <read_slot+0x37>
+        if (reads[i].r_count && !reads[i].r_done &&
+  80018c:	8b 48 04             	mov    0x4(%rax),%ecx
+  80018f:	85 c9                	test   %ecx,%ecx
+  800191:	74 ed                	je     800180 <read_slot+0x11>
+  800193:	80 78 0c 00          	cmpb   $0x0,0xc(%rax)
+  800197:	75 e7                	jne    800180 <read_slot+0x11>
+            blockno - reads[i].r_blockno < reads[i].r_count) return i;
+  800199:	41 89 f8             	mov    %edi,%r8d
+  80019c:	44 2b 00             	sub    (%rax),%r8d
+        if (reads[i].r_count && !reads[i].r_done &&
+  80019f:	41 39 c8             	cmp    %ecx,%r8d
+  8001a2:	73 dc                	jae    800180 <read_slot+0x11>
+  8001a4:	eb 05                	jmp    8001ab <read_slot+0x3c>
+    return -1;
+  8001a6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  8001ab:	89 d0                	mov    %edx,%eax
+  8001ad:	c3                   	ret
+
+00000000008001ae <dirty_compact>:
+/* Drop blocks that were already written back from dirty_list
+ * and sort the rest so that adjacent blocks can be merged.
+ * A block dirtied again after write back or bc_drop() is listed
+ * twice, so duplicates are dropped too. */
+static void
+dirty_compact(void) {
+  8001ae:	55                   	push   %rbp
+  8001af:	48 89 e5             	mov    %rsp,%rbp
+  8001b2:	41 54                	push   %r12
+  8001b4:	53                   	push   %rbx
+    size_t n = 0;
+    for (size_t i = 0; i < ndirty; i++)
+  8001b5:	48 b8 c8 e1 88 00 00 	movabs $0x88e1c8,%rax
+  8001bc:	00 00 00 
+  8001bf:	48 8b 18             	mov    (%rax),%rbx
+  8001c2:	48 85 db             	test   %rbx,%rbx
+  8001c5:	0f 84 0a 01 00 00    	je     8002d5 <dirty_compact+0x127>
+  8001cb:	48 b8 e0 e1 88 00 00 	movabs $0x88e1e0,%rax
+  8001d2:	00 00 00 
+  8001d5:	4c 8d 0c 98          	lea    (%rax,%rbx,4),%r9
+    size_t n = 0;
+  8001d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (TSTBIT(dirty_map, dirty_list[i])) dirty_list[n++] = dirty_list[i];
+  8001de:	49 b8 e0 f1 88 00 00 	movabs $0x88f1e0,%r8
+  8001e5:	00 00 00 
+  8001e8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001ed:	49 89 c2             	mov    %rax,%r10
+  8001f0:	eb 09                	jmp    8001fb <dirty_compact+0x4d>
+    for (size_t i = 0; i < ndirty; i++)
+  8001f2:	48 83 c0 04          	add    $0x4,%rax
+  8001f6:	4c 39 c8             	cmp    %r9,%rax
+  8001f9:	74 1d                	je     800218 <dirty_compact+0x6a>
+        if (TSTBIT(dirty_map, dirty_list[i])) dirty_list[n++] = dirty_list[i];
+  8001fb:	8b 08                	mov    (%rax),%ecx
+  8001fd:	89 ce                	mov    %ecx,%esi
+  8001ff:	c1 ee 05             	shr    $0x5,%esi
+  800202:	89 f6                	mov    %esi,%esi
+  800204:	89 fa                	mov    %edi,%edx
+  800206:	d3 e2                	shl    %cl,%edx
+  800208:	41 23 14 b0          	and    (%r8,%rsi,4),%edx
+  80020c:	74 e4                	je     8001f2 <dirty_compact+0x44>
+  80020e:	41 89 0c 9a          	mov    %ecx,(%r10,%rbx,4)
+  800212:	48 8d 5b 01          	lea    0x1(%rbx),%rbx
+  800216:	eb da                	jmp    8001f2 <dirty_compact+0x44>
+    ndirty = n;
+
+    for (size_t gap = ndirty / 2; gap; gap /= 2) {
+  800218:	48 89 df             	mov    %rbx,%rdi
+  80021b:	48 d1 ef             	shr    %rdi
+  80021e:	48 83 fb 01          	cmp    $0x1,%rbx
+  800222:	76 73                	jbe    800297 <dirty_compact+0xe9>
+  800224:	49 bc e0 e1 88 00 00 	movabs $0x88e1e0,%r12
+  80022b:	00 00 00 
+  80022e:	eb 4f                	jmp    80027f <dirty_compact+0xd1>
+        for (size_t i = gap; i < ndirty; i++) {
+            blockno_t b = dirty_list[i];
+            size_t j = i;
+            for (; j >= gap && dirty_list[j - gap] > b; j -= gap)
+                dirty_list[j] = dirty_list[j - gap];
+            dirty_list[j] = b;
+  800230:	47 89 0c 94          	mov    %r9d,(%r12,%r10,4)
+        for (size_t i = gap; i < ndirty; i++) {
+  800234:	49 83 c3 01          	add    $0x1,%r11
+  800238:	48 83 c0 04          	add    $0x4,%rax
+  80023c:	4c 39 db             	cmp    %r11,%rbx
+  80023f:	74 2f                	je     800270 <dirty_compact+0xc2>
+            blockno_t b = dirty_list[i];
+  800241:	44 8b 08             	mov    (%rax),%r9d
+            for (; j >= gap && dirty_list[j - gap] > b; j -= gap)
+  800244:	48 89 c1             	mov    %rax,%rcx
+  800247:	4c 89 da             	mov    %r11,%rdx
+  80024a:	4d 89 da             	mov    %r11,%r10
+  80024d:	49 39 fb             	cmp    %rdi,%r11
+  800250:	72 de                	jb     800230 <dirty_compact+0x82>
+  800252:	49 89 d2             	mov    %rdx,%r10
+  800255:	48 29 fa             	sub    %rdi,%rdx
+  800258:	42 8b 34 01          	mov    (%rcx,%r8,1),%esi
+  80025c:	41 39 f1             	cmp    %esi,%r9d
+  80025f:	73 cf                	jae    800230 <dirty_compact+0x82>
+                dirty_list[j] = dirty_list[j - gap];
+  800261:	89 31                	mov    %esi,(%rcx)
+            for (; j >= gap && dirty_list[j - gap] > b; j -= gap)
+  800263:	4c 01 c1             	add    %r8,%rcx
+  800266:	48 39 fa             	cmp    %rdi,%rdx
+  800269:	73 e7                	jae    800252 <dirty_compact+0xa4>
+  80026b:	49 89 d2             	mov    %rdx,%r10
+  80026e:	eb c0                	jmp    800230 <dirty_compact+0x82>
+    for (size_t gap = ndirty / 2; gap; gap /= 2) {
+  800270:	48 89 f8             	mov    %rdi,%rax
+  800273:	48 d1 e8             	shr    %rax
+  800276:	48 83 ff 01          	cmp    $0x1,%rdi
+  80027a:	76 20                	jbe    80029c <dirty_compact+0xee>
+  80027c:	48 89 c7             	mov    %rax,%rdi
+        for (size_t i = gap; i < ndirty; i++) {
+  80027f:	48 39 df             	cmp    %rbx,%rdi
+  800282:	73 ec                	jae    800270 <dirty_compact+0xc2>
+  800284:	49 8d 04 bc          	lea    (%r12,%rdi,4),%rax
+  800288:	49 89 f8             	mov    %rdi,%r8
+  80028b:	49 f7 d8             	neg    %r8
+  80028e:	49 c1 e0 02          	shl    $0x2,%r8
+  800292:	49 89 fb             	mov    %rdi,%r11
+  800295:	eb aa                	jmp    800241 <dirty_compact+0x93>
+        }
+    }
+
+    n = 0;
+    for (size_t i = 0; i < ndirty; i++)
+  800297:	48 85 db             	test   %rbx,%rbx
+  80029a:	74 39                	je     8002d5 <dirty_compact+0x127>
+  80029c:	48 b8 e0 e1 88 00 00 	movabs $0x88e1e0,%rax
+  8002a3:	00 00 00 
+  8002a6:	48 8d 34 98          	lea    (%rax,%rbx,4),%rsi
+    n = 0;
+  8002aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (!n || dirty_list[n - 1] != dirty_list[i]) dirty_list[n++] = dirty_list[i];
+  8002af:	48 89 c1             	mov    %rax,%rcx
+  8002b2:	eb 12                	jmp    8002c6 <dirty_compact+0x118>
+  8002b4:	8b 10                	mov    (%rax),%edx
+  8002b6:	89 14 99             	mov    %edx,(%rcx,%rbx,4)
+  8002b9:	48 8d 5b 01          	lea    0x1(%rbx),%rbx
+    for (size_t i = 0; i < ndirty; i++)
+  8002bd:	48 83 c0 04          	add    $0x4,%rax
+  8002c1:	48 39 c6             	cmp    %rax,%rsi
+  8002c4:	74 0f                	je     8002d5 <dirty_compact+0x127>
+        if (!n || dirty_list[n - 1] != dirty_list[i]) dirty_list[n++] = dirty_list[i];
+  8002c6:	48 85 db             	test   %rbx,%rbx
+  8002c9:	74 e9                	je     8002b4 <dirty_compact+0x106>
+  8002cb:	8b 38                	mov    (%rax),%edi
+  8002cd:	39 7c 99 fc          	cmp    %edi,-0x4(%rcx,%rbx,4)
+  8002d1:	75 e1                	jne    8002b4 <dirty_compact+0x106>
+  8002d3:	eb e8                	jmp    8002bd <dirty_compact+0x10f>
+    ndirty = n;
+  8002d5:	48 89 d8             	mov    %rbx,%rax
+  8002d8:	48 a3 c8 e1 88 00 00 	movabs %rax,0x88e1c8
+  8002df:	00 00 00 
+}
+  8002e2:	5b                   	pop    %rbx
+  8002e3:	41 5c                	pop    %r12
+  8002e5:	5d                   	pop    %rbp
+  8002e6:	c3                   	ret
+
+00000000008002e7 <read_finish>:
+read_finish(int tag, int status) {
+  8002e7:	55                   	push   %rbp
+  8002e8:	48 89 e5             	mov    %rsp,%rbp
+  8002eb:	41 55                	push   %r13
+  8002ed:	41 54                	push   %r12
+  8002ef:	53                   	push   %rbx
+  8002f0:	48 83 ec 08          	sub    $0x8,%rsp
+    while (slot < BC_INFLIGHT && (!reads[slot].r_count || reads[slot].r_done ||
+  8002f4:	48 b8 e4 71 8a 00 00 	movabs $0x8a71e4,%rax
+  8002fb:	00 00 00 
+    int slot = 0;
+  8002fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800303:	eb 10                	jmp    800315 <read_finish+0x2e>
+                                  reads[slot].r_tag != tag)) slot++;
+  800305:	83 c3 01             	add    $0x1,%ebx
+    while (slot < BC_INFLIGHT && (!reads[slot].r_count || reads[slot].r_done ||
+  800308:	48 83 c0 10          	add    $0x10,%rax
+  80030c:	83 fb 08             	cmp    $0x8,%ebx
+  80030f:	0f 84 f2 00 00 00    	je     800407 <read_finish+0x120>
+  800315:	83 38 00             	cmpl   $0x0,(%rax)
+  800318:	74 eb                	je     800305 <read_finish+0x1e>
+  80031a:	80 78 08 00          	cmpb   $0x0,0x8(%rax)
+  80031e:	75 e5                	jne    800305 <read_finish+0x1e>
+  800320:	39 78 04             	cmp    %edi,0x4(%rax)
+  800323:	75 e0                	jne    800305 <read_finish+0x1e>
+    if (slot == BC_INFLIGHT)
+  800325:	83 fb 08             	cmp    $0x8,%ebx
+  800328:	0f 84 d9 00 00 00    	je     800407 <read_finish+0x120>
+    return (void *)(uintptr_t)(BCSTAGE + (uintptr_t)slot * RA_MAX_WINDOW * BLKSIZE);
+  80032e:	48 63 c3             	movslq %ebx,%rax
+  800331:	4c 8d a0 00 34 00 00 	lea    0x3400(%rax),%r12
+  800338:	49 c1 e4 12          	shl    $0x12,%r12
+    void *stage = stageaddr(slot), *addr = blockaddr(r->r_blockno);
+  80033c:	48 c1 e0 04          	shl    $0x4,%rax
+  800340:	48 ba e0 71 8a 00 00 	movabs $0x8a71e0,%rdx
+  800347:	00 00 00 
+  80034a:	8b 0c 02             	mov    (%rdx,%rax,1),%ecx
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  80034d:	41 89 cd             	mov    %ecx,%r13d
+  800350:	49 81 c5 00 00 01 00 	add    $0x10000,%r13
+  800357:	49 c1 e5 0c          	shl    $0xc,%r13
+    if (status != NVME_OK)
+  80035b:	85 f6                	test   %esi,%esi
+  80035d:	0f 85 d1 00 00 00    	jne    800434 <read_finish+0x14d>
+                             PTE_SYSCALL & get_prot(stage) & ~PROT_W);
+  800363:	4c 89 e7             	mov    %r12,%rdi
+  800366:	48 b8 c6 d0 80 00 00 	movabs $0x80d0c6,%rax
+  80036d:	00 00 00 
+  800370:	ff d0                	call   *%rax
+    int res = sys_map_region(CURENVID, stage, CURENVID, addr, r->r_count * BLKSIZE,
+  800372:	48 63 d3             	movslq %ebx,%rdx
+  800375:	48 c1 e2 04          	shl    $0x4,%rdx
+  800379:	48 b9 e0 71 8a 00 00 	movabs $0x8a71e0,%rcx
+  800380:	00 00 00 
+  800383:	44 8b 44 11 04       	mov    0x4(%rcx,%rdx,1),%r8d
+  800388:	25 05 0e 00 00       	and    $0xe05,%eax
+  80038d:	41 89 c1             	mov    %eax,%r9d
+  800390:	49 c1 e0 0c          	shl    $0xc,%r8
+  800394:	4c 89 e9             	mov    %r13,%rcx
+  800397:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039c:	4c 89 e6             	mov    %r12,%rsi
+  80039f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003a4:	48 b8 74 a2 80 00 00 	movabs $0x80a274,%rax
+  8003ab:	00 00 00 
+  8003ae:	ff d0                	call   *%rax
+    if (res)
+  8003b0:	85 c0                	test   %eax,%eax
+  8003b2:	0f 85 b3 00 00 00    	jne    80046b <read_finish+0x184>
+    sys_unmap_region(CURENVID, stage, r->r_count * BLKSIZE);
+  8003b8:	48 63 db             	movslq %ebx,%rbx
+  8003bb:	48 c1 e3 04          	shl    $0x4,%rbx
+  8003bf:	48 b8 e0 71 8a 00 00 	movabs $0x8a71e0,%rax
+  8003c6:	00 00 00 
+  8003c9:	48 01 c3             	add    %rax,%rbx
+  8003cc:	8b 53 04             	mov    0x4(%rbx),%edx
+  8003cf:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8003d3:	4c 89 e6             	mov    %r12,%rsi
+  8003d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003db:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  8003e2:	00 00 00 
+  8003e5:	ff d0                	call   *%rax
+    note_resident(r->r_blockno, r->r_count);
+  8003e7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8003ea:	8b 3b                	mov    (%rbx),%edi
+  8003ec:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003f3:	00 00 00 
+  8003f6:	ff d0                	call   *%rax
+    r->r_done = 1;
+  8003f8:	c6 43 0c 01          	movb   $0x1,0xc(%rbx)
+}
+  8003fc:	48 83 c4 08          	add    $0x8,%rsp
+  800400:	5b                   	pop    %rbx
+  800401:	41 5c                	pop    %r12
+  800403:	41 5d                	pop    %r13
+  800405:	5d                   	pop    %rbp
+  800406:	c3                   	ret
+        panic("completion of unknown read %d", tag);
+  800407:	89 f9                	mov    %edi,%ecx
+  800409:	48 ba 00 e0 80 00 00 	movabs $0x80e000,%rdx
+  800410:	00 00 00 
+  800413:	be c9 00 00 00       	mov    $0xc9,%esi
+  800418:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  80041f:	00 00 00 
+  800422:	b8 00 00 00 00       	mov    $0x0,%eax
+  800427:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  80042e:	00 00 00 
+  800431:	41 ff d0             	call   *%r8
+        panic("bc: reading blocks %08x+%u failed\n", r->r_blockno, r->r_count);
+  800434:	48 63 c3             	movslq %ebx,%rax
+  800437:	48 c1 e0 04          	shl    $0x4,%rax
+  80043b:	44 8b 44 02 04       	mov    0x4(%rdx,%rax,1),%r8d
+  800440:	48 ba c8 e0 80 00 00 	movabs $0x80e0c8,%rdx
+  800447:	00 00 00 
+  80044a:	be ce 00 00 00       	mov    $0xce,%esi
+  80044f:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  800456:	00 00 00 
+  800459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045e:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  800465:	00 00 00 
+  800468:	41 ff d1             	call   *%r9
+        panic("bc: can't map blocks %08x+%u: %i", r->r_blockno, r->r_count, res);
+  80046b:	48 63 cb             	movslq %ebx,%rcx
+  80046e:	48 c1 e1 04          	shl    $0x4,%rcx
+  800472:	48 ba e0 71 8a 00 00 	movabs $0x8a71e0,%rdx
+  800479:	00 00 00 
+  80047c:	48 01 ca             	add    %rcx,%rdx
+  80047f:	41 89 c1             	mov    %eax,%r9d
+  800482:	44 8b 42 04          	mov    0x4(%rdx),%r8d
+  800486:	8b 0a                	mov    (%rdx),%ecx
+  800488:	48 ba f0 e0 80 00 00 	movabs $0x80e0f0,%rdx
+  80048f:	00 00 00 
+  800492:	be d3 00 00 00       	mov    $0xd3,%esi
+  800497:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  80049e:	00 00 00 
+  8004a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a6:	49 ba e5 8f 80 00 00 	movabs $0x808fe5,%r10
+  8004ad:	00 00 00 
+  8004b0:	41 ff d2             	call   *%r10
+
+00000000008004b3 <bc_wait>:
+}
+
+/* Wait for read in flight in given slot, or let
+ * the server suspend the request instead */
+static void
+bc_wait(int slot) {
+  8004b3:	55                   	push   %rbp
+  8004b4:	48 89 e5             	mov    %rsp,%rbp
+  8004b7:	41 55                	push   %r13
+  8004b9:	41 54                	push   %r12
+  8004bb:	53                   	push   %rbx
+  8004bc:	48 83 ec 18          	sub    $0x18,%rsp
+  8004c0:	89 fb                	mov    %edi,%ebx
+    if (bc_suspend) bc_suspend(slot);
+  8004c2:	48 a1 00 60 81 00 00 	movabs 0x816000,%rax
+  8004c9:	00 00 00 
+  8004cc:	48 85 c0             	test   %rax,%rax
+  8004cf:	74 02                	je     8004d3 <bc_wait+0x20>
+  8004d1:	ff d0                	call   *%rax
+    while (!reads[slot].r_done) {
+  8004d3:	48 63 c3             	movslq %ebx,%rax
+  8004d6:	48 c1 e0 04          	shl    $0x4,%rax
+  8004da:	48 ba e0 71 8a 00 00 	movabs $0x8a71e0,%rdx
+  8004e1:	00 00 00 
+  8004e4:	80 7c 02 0c 00       	cmpb   $0x0,0xc(%rdx,%rax,1)
+  8004e9:	75 3e                	jne    800529 <bc_wait+0x76>
+        int status, tag = nvme_poll(&status);
+  8004eb:	49 bc 90 8e 80 00 00 	movabs $0x808e90,%r12
+  8004f2:	00 00 00 
+        if (tag >= 0) read_finish(tag, status);
+  8004f5:	49 bd e7 02 80 00 00 	movabs $0x8002e7,%r13
+  8004fc:	00 00 00 
+    while (!reads[slot].r_done) {
+  8004ff:	48 63 c3             	movslq %ebx,%rax
+  800502:	48 c1 e0 04          	shl    $0x4,%rax
+  800506:	48 89 d3             	mov    %rdx,%rbx
+  800509:	48 01 c3             	add    %rax,%rbx
+  80050c:	eb 06                	jmp    800514 <bc_wait+0x61>
+  80050e:	80 7b 0c 00          	cmpb   $0x0,0xc(%rbx)
+  800512:	75 15                	jne    800529 <bc_wait+0x76>
+        int status, tag = nvme_poll(&status);
+  800514:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  800518:	41 ff d4             	call   *%r12
+        if (tag >= 0) read_finish(tag, status);
+  80051b:	85 c0                	test   %eax,%eax
+  80051d:	78 ef                	js     80050e <bc_wait+0x5b>
+  80051f:	8b 75 dc             	mov    -0x24(%rbp),%esi
+  800522:	89 c7                	mov    %eax,%edi
+  800524:	41 ff d5             	call   *%r13
+  800527:	eb e5                	jmp    80050e <bc_wait+0x5b>
+    read_wait(slot);
+}
+  800529:	48 83 c4 18          	add    $0x18,%rsp
+  80052d:	5b                   	pop    %rbx
+  80052e:	41 5c                	pop    %r12
+  800530:	41 5d                	pop    %r13
+  800532:	5d                   	pop    %rbp
+  800533:	c3                   	ret
+
+0000000000800534 <deferred>:
+deferred(blockno_t blockno) {
+  800534:	55                   	push   %rbp
+  800535:	48 89 e5             	mov    %rsp,%rbp
+  800538:	53                   	push   %rbx
+  800539:	48 83 ec 08          	sub    $0x8,%rsp
+  80053d:	89 fb                	mov    %edi,%ebx
+    return journal_active() && TSTBIT(meta_map, blockno);
+  80053f:	48 b8 b3 4b 80 00 00 	movabs $0x804bb3,%rax
+  800546:	00 00 00 
+  800549:	ff d0                	call   *%rax
+  80054b:	89 c2                	mov    %eax,%edx
+  80054d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800552:	84 d2                	test   %dl,%dl
+  800554:	74 23                	je     800579 <deferred+0x45>
+  800556:	89 da                	mov    %ebx,%edx
+  800558:	c1 ea 05             	shr    $0x5,%edx
+  80055b:	89 d2                	mov    %edx,%edx
+  80055d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800562:	89 d9                	mov    %ebx,%ecx
+  800564:	d3 e0                	shl    %cl,%eax
+  800566:	48 b9 c0 61 87 00 00 	movabs $0x8761c0,%rcx
+  80056d:	00 00 00 
+  800570:	23 04 91             	and    (%rcx,%rdx,4),%eax
+  800573:	0f 95 c0             	setne  %al
+  800576:	0f b6 c0             	movzbl %al,%eax
+  800579:	83 e0 01             	and    $0x1,%eax
+}
+  80057c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800580:	c9                   	leave
+  800581:	c3                   	ret
+
+0000000000800582 <read_start>:
+read_start(blockno_t blockno, blockno_t count) {
+  800582:	55                   	push   %rbp
+  800583:	48 89 e5             	mov    %rsp,%rbp
+  800586:	41 57                	push   %r15
+  800588:	41 56                	push   %r14
+  80058a:	41 55                	push   %r13
+  80058c:	41 54                	push   %r12
+  80058e:	53                   	push   %rbx
+  80058f:	48 83 ec 18          	sub    $0x18,%rsp
+  800593:	89 7d c8             	mov    %edi,-0x38(%rbp)
+  800596:	89 75 cc             	mov    %esi,-0x34(%rbp)
+    while (slot < BC_INFLIGHT && reads[slot].r_count) slot++;
+  800599:	48 b8 e4 71 8a 00 00 	movabs $0x8a71e4,%rax
+  8005a0:	00 00 00 
+    int slot = 0;
+  8005a3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while (slot < BC_INFLIGHT && reads[slot].r_count) slot++;
+  8005a9:	83 38 00             	cmpl   $0x0,(%rax)
+  8005ac:	74 26                	je     8005d4 <read_start+0x52>
+  8005ae:	41 83 c4 01          	add    $0x1,%r12d
+  8005b2:	48 83 c0 10          	add    $0x10,%rax
+  8005b6:	41 83 fc 08          	cmp    $0x8,%r12d
+  8005ba:	75 ed                	jne    8005a9 <read_start+0x27>
+    if (slot == BC_INFLIGHT) return -1;
+  8005bc:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+}
+  8005c2:	44 89 e0             	mov    %r12d,%eax
+  8005c5:	48 83 c4 18          	add    $0x18,%rsp
+  8005c9:	5b                   	pop    %rbx
+  8005ca:	41 5c                	pop    %r12
+  8005cc:	41 5d                	pop    %r13
+  8005ce:	41 5e                	pop    %r14
+  8005d0:	41 5f                	pop    %r15
+  8005d2:	5d                   	pop    %rbp
+  8005d3:	c3                   	ret
+    if (slot == BC_INFLIGHT) return -1;
+  8005d4:	41 83 fc 08          	cmp    $0x8,%r12d
+  8005d8:	0f 84 1c 01 00 00    	je     8006fa <read_start+0x178>
+    return (void *)(uintptr_t)(BCSTAGE + (uintptr_t)slot * RA_MAX_WINDOW * BLKSIZE);
+  8005de:	4d 63 ec             	movslq %r12d,%r13
+  8005e1:	49 81 c5 00 34 00 00 	add    $0x3400,%r13
+  8005e8:	49 c1 e5 12          	shl    $0x12,%r13
+    for (blockno_t i = 0; i < count; i++) {
+  8005ec:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8005ef:	85 c0                	test   %eax,%eax
+  8005f1:	74 47                	je     80063a <read_start+0xb8>
+  8005f3:	41 89 c6             	mov    %eax,%r14d
+  8005f6:	49 c1 e6 0c          	shl    $0xc,%r14
+  8005fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (sys_alloc_dma_region(CURENVID, (char *)stage + i * BLKSIZE, 0, PROT_RW, NULL) < 0) {
+  8005ff:	49 bf 41 a3 80 00 00 	movabs $0x80a341,%r15
+  800606:	00 00 00 
+  800609:	49 8d 74 1d 00       	lea    0x0(%r13,%rbx,1),%rsi
+  80060e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800614:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800619:	ba 00 00 00 00       	mov    $0x0,%edx
+  80061e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800623:	41 ff d7             	call   *%r15
+  800626:	85 c0                	test   %eax,%eax
+  800628:	0f 88 84 00 00 00    	js     8006b2 <read_start+0x130>
+    for (blockno_t i = 0; i < count; i++) {
+  80062e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800635:	4c 39 f3             	cmp    %r14,%rbx
+  800638:	75 cf                	jne    800609 <read_start+0x87>
+    int tag = nvme_read_async(blockno * BLKSECTS, stage, count * BLKSECTS);
+  80063a:	8b 5d cc             	mov    -0x34(%rbp),%ebx
+  80063d:	48 8d 14 dd 00 00 00 	lea    0x0(,%rbx,8),%rdx
+  800644:	00 
+  800645:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800648:	48 c1 e7 03          	shl    $0x3,%rdi
+  80064c:	4c 89 ee             	mov    %r13,%rsi
+  80064f:	48 b8 d3 8d 80 00 00 	movabs $0x808dd3,%rax
+  800656:	00 00 00 
+  800659:	ff d0                	call   *%rax
+    if (tag < 0) {
+  80065b:	85 c0                	test   %eax,%eax
+  80065d:	78 75                	js     8006d4 <read_start+0x152>
+    reads[slot] = (struct BcRead){blockno, count, tag, 0};
+  80065f:	49 63 cc             	movslq %r12d,%rcx
+  800662:	48 c1 e1 04          	shl    $0x4,%rcx
+  800666:	48 ba e0 71 8a 00 00 	movabs $0x8a71e0,%rdx
+  80066d:	00 00 00 
+  800670:	48 01 ca             	add    %rcx,%rdx
+  800673:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800676:	89 3a                	mov    %edi,(%rdx)
+  800678:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80067b:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  80067e:	89 42 08             	mov    %eax,0x8(%rdx)
+  800681:	c6 42 0c 00          	movb   $0x0,0xc(%rdx)
+    bc_stats.faults++;
+  800685:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  80068c:	00 00 00 
+  80068f:	48 83 00 01          	addq   $0x1,(%rax)
+    bc_stats.async_reads++;
+  800693:	48 83 40 08 01       	addq   $0x1,0x8(%rax)
+    if (count > 1) {
+  800698:	83 f9 01             	cmp    $0x1,%ecx
+  80069b:	0f 86 21 ff ff ff    	jbe    8005c2 <read_start+0x40>
+        bc_stats.ra_io++;
+  8006a1:	48 83 40 10 01       	addq   $0x1,0x10(%rax)
+        bc_stats.ra_blocks += count - 1;
+  8006a6:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8006a9:	48 01 50 18          	add    %rdx,0x18(%rax)
+  8006ad:	e9 10 ff ff ff       	jmp    8005c2 <read_start+0x40>
+            sys_unmap_region(CURENVID, stage, i * BLKSIZE);
+  8006b2:	48 89 da             	mov    %rbx,%rdx
+  8006b5:	4c 89 ee             	mov    %r13,%rsi
+  8006b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006bd:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+            return -1;
+  8006c9:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8006cf:	e9 ee fe ff ff       	jmp    8005c2 <read_start+0x40>
+        sys_unmap_region(CURENVID, stage, count * BLKSIZE);
+  8006d4:	48 89 da             	mov    %rbx,%rdx
+  8006d7:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8006db:	4c 89 ee             	mov    %r13,%rsi
+  8006de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006e3:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  8006ea:	00 00 00 
+  8006ed:	ff d0                	call   *%rax
+        return -1;
+  8006ef:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8006f5:	e9 c8 fe ff ff       	jmp    8005c2 <read_start+0x40>
+    if (slot == BC_INFLIGHT) return -1;
+  8006fa:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  800700:	e9 bd fe ff ff       	jmp    8005c2 <read_start+0x40>
+
+0000000000800705 <bc_read>:
+bc_read(blockno_t blockno, blockno_t count) {
+  800705:	55                   	push   %rbp
+  800706:	48 89 e5             	mov    %rsp,%rbp
+  800709:	41 57                	push   %r15
+  80070b:	41 56                	push   %r14
+  80070d:	41 55                	push   %r13
+  80070f:	41 54                	push   %r12
+  800711:	53                   	push   %rbx
+  800712:	48 83 ec 08          	sub    $0x8,%rsp
+  800716:	41 89 fe             	mov    %edi,%r14d
+  800719:	41 89 f4             	mov    %esi,%r12d
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  80071c:	41 89 fd             	mov    %edi,%r13d
+  80071f:	49 8d 9d 00 00 01 00 	lea    0x10000(%r13),%rbx
+  800726:	48 c1 e3 0c          	shl    $0xc,%rbx
+    int res = sys_alloc_region(CURENVID, addr, count * BLKSIZE, PROT_RW);
+  80072a:	41 89 f7             	mov    %esi,%r15d
+  80072d:	4c 89 fa             	mov    %r15,%rdx
+  800730:	48 c1 e2 0c          	shl    $0xc,%rdx
+  800734:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800739:	48 89 de             	mov    %rbx,%rsi
+  80073c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800741:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  800748:	00 00 00 
+  80074b:	ff d0                	call   *%rax
+    if (res)
+  80074d:	85 c0                	test   %eax,%eax
+  80074f:	0f 85 f4 00 00 00    	jne    800849 <bc_read+0x144>
+    for (blockno_t i = 0; i < count; i++)
+  800755:	45 85 e4             	test   %r12d,%r12d
+  800758:	0f 84 74 01 00 00    	je     8008d2 <bc_read+0x1cd>
+  80075e:	48 89 d8             	mov    %rbx,%rax
+  800761:	44 89 e2             	mov    %r12d,%edx
+  800764:	48 c1 e2 0c          	shl    $0xc,%rdx
+  800768:	48 01 da             	add    %rbx,%rdx
+        *((char *)addr + i * BLKSIZE) = 0;
+  80076b:	c6 00 00             	movb   $0x0,(%rax)
+    for (blockno_t i = 0; i < count; i++)
+  80076e:	48 05 00 10 00 00    	add    $0x1000,%rax
+  800774:	48 39 d0             	cmp    %rdx,%rax
+  800777:	75 f2                	jne    80076b <bc_read+0x66>
+    res = nvme_read(blockno * BLKSECTS, addr, count * BLKSECTS);
+  800779:	49 c1 e5 03          	shl    $0x3,%r13
+  80077d:	4a 8d 14 fd 00 00 00 	lea    0x0(,%r15,8),%rdx
+  800784:	00 
+  800785:	48 89 de             	mov    %rbx,%rsi
+  800788:	4c 89 ef             	mov    %r13,%rdi
+  80078b:	48 b8 6d 8d 80 00 00 	movabs $0x808d6d,%rax
+  800792:	00 00 00 
+  800795:	ff d0                	call   *%rax
+    if (res != NVME_OK && count > 1) {
+  800797:	85 c0                	test   %eax,%eax
+  800799:	74 44                	je     8007df <bc_read+0xda>
+  80079b:	41 83 fc 01          	cmp    $0x1,%r12d
+  80079f:	76 3e                	jbe    8007df <bc_read+0xda>
+        sys_unmap_region(CURENVID, addr + BLKSIZE, (count - 1) * BLKSIZE);
+  8007a1:	41 8d 54 24 ff       	lea    -0x1(%r12),%edx
+  8007a6:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8007aa:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8007b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007b6:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  8007bd:	00 00 00 
+  8007c0:	ff d0                	call   *%rax
+        res = nvme_read(blockno * BLKSECTS, addr, BLKSECTS);
+  8007c2:	ba 08 00 00 00       	mov    $0x8,%edx
+  8007c7:	48 89 de             	mov    %rbx,%rsi
+  8007ca:	4c 89 ef             	mov    %r13,%rdi
+  8007cd:	48 b8 6d 8d 80 00 00 	movabs $0x808d6d,%rax
+  8007d4:	00 00 00 
+  8007d7:	ff d0                	call   *%rax
+        count = 1;
+  8007d9:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    if (res != NVME_OK)
+  8007df:	85 c0                	test   %eax,%eax
+  8007e1:	0f 85 8f 00 00 00    	jne    800876 <bc_read+0x171>
+                         PTE_SYSCALL & get_prot(addr) & ~PROT_W);
+  8007e7:	48 89 df             	mov    %rbx,%rdi
+  8007ea:	48 b8 c6 d0 80 00 00 	movabs $0x80d0c6,%rax
+  8007f1:	00 00 00 
+  8007f4:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, addr, CURENVID, addr, count * BLKSIZE,
+  8007f6:	45 89 e0             	mov    %r12d,%r8d
+  8007f9:	25 05 0e 00 00       	and    $0xe05,%eax
+  8007fe:	41 89 c1             	mov    %eax,%r9d
+  800801:	49 c1 e0 0c          	shl    $0xc,%r8
+  800805:	48 89 d9             	mov    %rbx,%rcx
+  800808:	ba 00 00 00 00       	mov    $0x0,%edx
+  80080d:	48 89 de             	mov    %rbx,%rsi
+  800810:	bf 00 00 00 00       	mov    $0x0,%edi
+  800815:	48 b8 74 a2 80 00 00 	movabs $0x80a274,%rax
+  80081c:	00 00 00 
+  80081f:	ff d0                	call   *%rax
+    if (res)
+  800821:	85 c0                	test   %eax,%eax
+  800823:	75 7f                	jne    8008a4 <bc_read+0x19f>
+    note_resident(blockno, count);
+  800825:	44 89 e6             	mov    %r12d,%esi
+  800828:	44 89 f7             	mov    %r14d,%edi
+  80082b:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800832:	00 00 00 
+  800835:	ff d0                	call   *%rax
+}
+  800837:	44 89 e0             	mov    %r12d,%eax
+  80083a:	48 83 c4 08          	add    $0x8,%rsp
+  80083e:	5b                   	pop    %rbx
+  80083f:	41 5c                	pop    %r12
+  800841:	41 5d                	pop    %r13
+  800843:	41 5e                	pop    %r14
+  800845:	41 5f                	pop    %r15
+  800847:	5d                   	pop    %rbp
+  800848:	c3                   	ret
+        panic("bc_read: can't alloc memmory! %i", res);
+  800849:	89 c1                	mov    %eax,%ecx
+  80084b:	48 ba 18 e1 80 00 00 	movabs $0x80e118,%rdx
+  800852:	00 00 00 
+  800855:	be 9f 01 00 00       	mov    $0x19f,%esi
+  80085a:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  800861:	00 00 00 
+  800864:	b8 00 00 00 00       	mov    $0x0,%eax
+  800869:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  800870:	00 00 00 
+  800873:	41 ff d0             	call   *%r8
+        panic("bc_read of block %08x failed\n", blockno);
+  800876:	44 89 f1             	mov    %r14d,%ecx
+  800879:	48 ba 26 e0 80 00 00 	movabs $0x80e026,%rdx
+  800880:	00 00 00 
+  800883:	be b2 01 00 00       	mov    $0x1b2,%esi
+  800888:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  80088f:	00 00 00 
+  800892:	b8 00 00 00 00       	mov    $0x0,%eax
+  800897:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  80089e:	00 00 00 
+  8008a1:	41 ff d0             	call   *%r8
+        panic("bc_read of block %08x failed: clearing PTE_D\n", blockno);
+  8008a4:	44 89 f1             	mov    %r14d,%ecx
+  8008a7:	48 ba 40 e1 80 00 00 	movabs $0x80e140,%rdx
+  8008ae:	00 00 00 
+  8008b1:	be ba 01 00 00       	mov    $0x1ba,%esi
+  8008b6:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  8008bd:	00 00 00 
+  8008c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c5:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8008cc:	00 00 00 
+  8008cf:	41 ff d0             	call   *%r8
+    res = nvme_read(blockno * BLKSECTS, addr, count * BLKSECTS);
+  8008d2:	4a 8d 3c ed 00 00 00 	lea    0x0(,%r13,8),%rdi
+  8008d9:	00 
+  8008da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008df:	48 89 de             	mov    %rbx,%rsi
+  8008e2:	48 b8 6d 8d 80 00 00 	movabs $0x808d6d,%rax
+  8008e9:	00 00 00 
+  8008ec:	ff d0                	call   *%rax
+    if (res != NVME_OK && count > 1) {
+  8008ee:	e9 ec fe ff ff       	jmp    8007df <bc_read+0xda>
+
+00000000008008f3 <diskaddr>:
+    if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  8008f3:	85 ff                	test   %edi,%edi
+  8008f5:	74 21                	je     800918 <diskaddr+0x25>
+  8008f7:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  8008fe:	00 00 00 
+  800901:	48 85 c0             	test   %rax,%rax
+  800904:	74 05                	je     80090b <diskaddr+0x18>
+  800906:	3b 78 04             	cmp    0x4(%rax),%edi
+  800909:	73 0d                	jae    800918 <diskaddr+0x25>
+    void *r = (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  80090b:	89 f8                	mov    %edi,%eax
+  80090d:	48 05 00 00 01 00    	add    $0x10000,%rax
+  800913:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800917:	c3                   	ret
+diskaddr(blockno_t blockno) {
+  800918:	55                   	push   %rbp
+  800919:	48 89 e5             	mov    %rsp,%rbp
+        panic("bad block number %08x in diskaddr", blockno);
+  80091c:	89 f9                	mov    %edi,%ecx
+  80091e:	48 ba 70 e1 80 00 00 	movabs $0x80e170,%rdx
+  800925:	00 00 00 
+  800928:	be 68 00 00 00       	mov    $0x68,%esi
+  80092d:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  800934:	00 00 00 
+  800937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093c:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  800943:	00 00 00 
+  800946:	41 ff d0             	call   *%r8
+
+0000000000800949 <bc_poll>:
+    for (int i = 0; i < BC_INFLIGHT; i++) {
+  800949:	48 ba ec 71 8a 00 00 	movabs $0x8a71ec,%rdx
+  800950:	00 00 00 
+  800953:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (reads[i].r_done) {
+  800958:	80 3a 00             	cmpb   $0x0,(%rdx)
+  80095b:	75 47                	jne    8009a4 <bc_poll+0x5b>
+    for (int i = 0; i < BC_INFLIGHT; i++) {
+  80095d:	83 c0 01             	add    $0x1,%eax
+  800960:	48 83 c2 10          	add    $0x10,%rdx
+  800964:	83 f8 08             	cmp    $0x8,%eax
+  800967:	75 ef                	jne    800958 <bc_poll+0xf>
+bc_poll(void) {
+  800969:	55                   	push   %rbp
+  80096a:	48 89 e5             	mov    %rsp,%rbp
+  80096d:	48 83 ec 10          	sub    $0x10,%rsp
+    int status, tag = nvme_poll(&status);
+  800971:	48 8d 7d fc          	lea    -0x4(%rbp),%rdi
+  800975:	48 b8 90 8e 80 00 00 	movabs $0x808e90,%rax
+  80097c:	00 00 00 
+  80097f:	ff d0                	call   *%rax
+  800981:	89 c7                	mov    %eax,%edi
+    if (tag < 0) return -1;
+  800983:	85 c0                	test   %eax,%eax
+  800985:	78 3d                	js     8009c4 <bc_poll+0x7b>
+    read_finish(tag, status);
+  800987:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  80098a:	48 b8 e7 02 80 00 00 	movabs $0x8002e7,%rax
+  800991:	00 00 00 
+  800994:	ff d0                	call   *%rax
+    return bc_poll();
+  800996:	48 b8 49 09 80 00 00 	movabs $0x800949,%rax
+  80099d:	00 00 00 
+  8009a0:	ff d0                	call   *%rax
+}
+  8009a2:	c9                   	leave
+  8009a3:	c3                   	ret
+            reads[i].r_count = 0;
+  8009a4:	48 63 c8             	movslq %eax,%rcx
+  8009a7:	48 c1 e1 04          	shl    $0x4,%rcx
+  8009ab:	48 ba e0 71 8a 00 00 	movabs $0x8a71e0,%rdx
+  8009b2:	00 00 00 
+  8009b5:	48 01 ca             	add    %rcx,%rdx
+  8009b8:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%rdx)
+            reads[i].r_done = 0;
+  8009bf:	c6 42 0c 00          	movb   $0x0,0xc(%rdx)
+}
+  8009c3:	c3                   	ret
+    if (tag < 0) return -1;
+  8009c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8009c9:	eb d7                	jmp    8009a2 <bc_poll+0x59>
+
+00000000008009cb <bc_pending>:
+    for (int i = 0; i < BC_INFLIGHT; i++)
+  8009cb:	48 b8 e4 71 8a 00 00 	movabs $0x8a71e4,%rax
+  8009d2:	00 00 00 
+  8009d5:	48 8d 90 80 00 00 00 	lea    0x80(%rax),%rdx
+        if (reads[i].r_count) return 1;
+  8009dc:	83 38 00             	cmpl   $0x0,(%rax)
+  8009df:	75 0f                	jne    8009f0 <bc_pending+0x25>
+    for (int i = 0; i < BC_INFLIGHT; i++)
+  8009e1:	48 83 c0 10          	add    $0x10,%rax
+  8009e5:	48 39 d0             	cmp    %rdx,%rax
+  8009e8:	75 f2                	jne    8009dc <bc_pending+0x11>
+    return 0;
+  8009ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ef:	c3                   	ret
+        if (reads[i].r_count) return 1;
+  8009f0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8009f5:	c3                   	ret
+
+00000000008009f6 <bc_write_blocks>:
+bc_write_blocks(blockno_t blockno, blockno_t count) {
+  8009f6:	55                   	push   %rbp
+  8009f7:	48 89 e5             	mov    %rsp,%rbp
+  8009fa:	41 56                	push   %r14
+  8009fc:	41 55                	push   %r13
+  8009fe:	41 54                	push   %r12
+  800a00:	53                   	push   %rbx
+  800a01:	89 fb                	mov    %edi,%ebx
+  800a03:	41 89 f4             	mov    %esi,%r12d
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  800a06:	89 ff                	mov    %edi,%edi
+  800a08:	4c 8d af 00 00 01 00 	lea    0x10000(%rdi),%r13
+  800a0f:	49 c1 e5 0c          	shl    $0xc,%r13
+    int res = nvme_write(blockno * BLKSECTS, addr, count * BLKSECTS);
+  800a13:	41 89 f6             	mov    %esi,%r14d
+  800a16:	4a 8d 14 f5 00 00 00 	lea    0x0(,%r14,8),%rdx
+  800a1d:	00 
+  800a1e:	48 c1 e7 03          	shl    $0x3,%rdi
+  800a22:	4c 89 ee             	mov    %r13,%rsi
+  800a25:	48 b8 38 8d 80 00 00 	movabs $0x808d38,%rax
+  800a2c:	00 00 00 
+  800a2f:	ff d0                	call   *%rax
+    if (res != NVME_OK)
+  800a31:	85 c0                	test   %eax,%eax
+  800a33:	0f 85 8f 00 00 00    	jne    800ac8 <bc_write_blocks+0xd2>
+                         PTE_SYSCALL & get_prot(addr) & ~PROT_W);
+  800a39:	4c 89 ef             	mov    %r13,%rdi
+  800a3c:	48 b8 c6 d0 80 00 00 	movabs $0x80d0c6,%rax
+  800a43:	00 00 00 
+  800a46:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, addr, CURENVID, addr, count * BLKSIZE,
+  800a48:	25 05 0e 00 00       	and    $0xe05,%eax
+  800a4d:	41 89 c1             	mov    %eax,%r9d
+  800a50:	49 c1 e6 0c          	shl    $0xc,%r14
+  800a54:	4d 89 f0             	mov    %r14,%r8
+  800a57:	4c 89 e9             	mov    %r13,%rcx
+  800a5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a5f:	4c 89 ee             	mov    %r13,%rsi
+  800a62:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a67:	48 b8 74 a2 80 00 00 	movabs $0x80a274,%rax
+  800a6e:	00 00 00 
+  800a71:	ff d0                	call   *%rax
+    if (res)
+  800a73:	85 c0                	test   %eax,%eax
+  800a75:	75 7f                	jne    800af6 <bc_write_blocks+0x100>
+    for (blockno_t i = 0; i < count; i++)
+  800a77:	46 8d 04 23          	lea    (%rbx,%r12,1),%r8d
+        CLRBIT(dirty_map, blockno + i);
+  800a7b:	48 be e0 f1 88 00 00 	movabs $0x88f1e0,%rsi
+  800a82:	00 00 00 
+  800a85:	bf 01 00 00 00       	mov    $0x1,%edi
+    for (blockno_t i = 0; i < count; i++)
+  800a8a:	45 85 e4             	test   %r12d,%r12d
+  800a8d:	74 1a                	je     800aa9 <bc_write_blocks+0xb3>
+        CLRBIT(dirty_map, blockno + i);
+  800a8f:	89 d8                	mov    %ebx,%eax
+  800a91:	c1 e8 05             	shr    $0x5,%eax
+  800a94:	89 c0                	mov    %eax,%eax
+  800a96:	89 fa                	mov    %edi,%edx
+  800a98:	89 d9                	mov    %ebx,%ecx
+  800a9a:	d3 e2                	shl    %cl,%edx
+  800a9c:	f7 d2                	not    %edx
+  800a9e:	21 14 86             	and    %edx,(%rsi,%rax,4)
+    for (blockno_t i = 0; i < count; i++)
+  800aa1:	83 c3 01             	add    $0x1,%ebx
+  800aa4:	41 39 d8             	cmp    %ebx,%r8d
+  800aa7:	75 e6                	jne    800a8f <bc_write_blocks+0x99>
+    bc_stats.wb_io++;
+  800aa9:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  800ab0:	00 00 00 
+  800ab3:	48 83 40 30 01       	addq   $0x1,0x30(%rax)
+    bc_stats.wb_blocks += count;
+  800ab8:	45 89 e4             	mov    %r12d,%r12d
+  800abb:	4c 01 60 38          	add    %r12,0x38(%rax)
+}
+  800abf:	5b                   	pop    %rbx
+  800ac0:	41 5c                	pop    %r12
+  800ac2:	41 5d                	pop    %r13
+  800ac4:	41 5e                	pop    %r14
+  800ac6:	5d                   	pop    %rbp
+  800ac7:	c3                   	ret
+        panic("flush_block of va %p failed: writing\n", addr);
+  800ac8:	4c 89 e9             	mov    %r13,%rcx
+  800acb:	48 ba 98 e1 80 00 00 	movabs $0x80e198,%rdx
+  800ad2:	00 00 00 
+  800ad5:	be 3a 01 00 00       	mov    $0x13a,%esi
+  800ada:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  800ae1:	00 00 00 
+  800ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae9:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  800af0:	00 00 00 
+  800af3:	41 ff d0             	call   *%r8
+        panic("flush_block of va %p failed: clearing PTE_D\n", addr);
+  800af6:	4c 89 e9             	mov    %r13,%rcx
+  800af9:	48 ba c0 e1 80 00 00 	movabs $0x80e1c0,%rdx
+  800b00:	00 00 00 
+  800b03:	be 3e 01 00 00       	mov    $0x13e,%esi
+  800b08:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  800b0f:	00 00 00 
+  800b12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b17:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  800b1e:	00 00 00 
+  800b21:	41 ff d0             	call   *%r8
+
+0000000000800b24 <bc_load>:
+
+/* Load blocks among count blocks starting with blockno that are
+ * not cached yet, reading adjacent blocks with a single command.
+ * Unlike touching them this needs no page fault upcalls. */
+void
+bc_load(blockno_t blockno, blockno_t count) {
+  800b24:	55                   	push   %rbp
+  800b25:	48 89 e5             	mov    %rsp,%rbp
+  800b28:	41 57                	push   %r15
+  800b2a:	41 56                	push   %r14
+  800b2c:	41 55                	push   %r13
+  800b2e:	41 54                	push   %r12
+  800b30:	53                   	push   %rbx
+  800b31:	48 83 ec 18          	sub    $0x18,%rsp
+  800b35:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    for (blockno_t i = 0; i < count;) {
+  800b38:	85 f6                	test   %esi,%esi
+  800b3a:	0f 84 2a 01 00 00    	je     800c6a <bc_load+0x146>
+  800b40:	41 89 f7             	mov    %esi,%r15d
+  800b43:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800b49:	eb 76                	jmp    800bc1 <bc_load+0x9d>
+        blockno_t b = blockno + i;
+        if (is_page_present(blockaddr(b))) {
+            i++;
+  800b4b:	41 83 c5 01          	add    $0x1,%r13d
+            continue;
+  800b4f:	eb 67                	jmp    800bb8 <bc_load+0x94>
+        }
+
+        int slot = read_slot(b);
+        if (slot >= 0) {
+            bc_wait(slot);
+  800b51:	89 c7                	mov    %eax,%edi
+  800b53:	48 b8 b3 04 80 00 00 	movabs $0x8004b3,%rax
+  800b5a:	00 00 00 
+  800b5d:	ff d0                	call   *%rax
+            continue;
+  800b5f:	eb 57                	jmp    800bb8 <bc_load+0x94>
+
+        blockno_t n = 1;
+        while (i + n < count && n < RA_MAX_WINDOW && !is_page_present(blockaddr(b + n)) &&
+               read_slot(b + n) < 0) n++;
+
+        if (bc_suspend && (slot = read_start(b, n)) >= 0)
+  800b61:	48 b8 00 60 81 00 00 	movabs $0x816000,%rax
+  800b68:	00 00 00 
+  800b6b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b6f:	74 23                	je     800b94 <bc_load+0x70>
+  800b71:	89 de                	mov    %ebx,%esi
+  800b73:	44 89 f7             	mov    %r14d,%edi
+  800b76:	48 b8 82 05 80 00 00 	movabs $0x800582,%rax
+  800b7d:	00 00 00 
+  800b80:	ff d0                	call   *%rax
+  800b82:	85 c0                	test   %eax,%eax
+  800b84:	78 0e                	js     800b94 <bc_load+0x70>
+            bc_suspend(slot);
+  800b86:	89 c7                	mov    %eax,%edi
+  800b88:	48 a1 00 60 81 00 00 	movabs 0x816000,%rax
+  800b8f:	00 00 00 
+  800b92:	ff d0                	call   *%rax
+
+        n = bc_read(b, n);
+  800b94:	89 de                	mov    %ebx,%esi
+  800b96:	44 89 f7             	mov    %r14d,%edi
+  800b99:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  800ba0:	00 00 00 
+  800ba3:	ff d0                	call   *%rax
+        bc_stats.direct_reads += n;
+  800ba5:	48 ba 20 60 81 00 00 	movabs $0x816020,%rdx
+  800bac:	00 00 00 
+  800baf:	89 c1                	mov    %eax,%ecx
+  800bb1:	48 01 4a 58          	add    %rcx,0x58(%rdx)
+        i += n;
+  800bb5:	41 01 c5             	add    %eax,%r13d
+    for (blockno_t i = 0; i < count;) {
+  800bb8:	45 39 fd             	cmp    %r15d,%r13d
+  800bbb:	0f 83 a9 00 00 00    	jae    800c6a <bc_load+0x146>
+        blockno_t b = blockno + i;
+  800bc1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800bc4:	46 8d 34 28          	lea    (%rax,%r13,1),%r14d
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  800bc8:	44 89 f7             	mov    %r14d,%edi
+  800bcb:	48 81 c7 00 00 01 00 	add    $0x10000,%rdi
+  800bd2:	48 c1 e7 0c          	shl    $0xc,%rdi
+        if (is_page_present(blockaddr(b))) {
+  800bd6:	48 b8 25 d1 80 00 00 	movabs $0x80d125,%rax
+  800bdd:	00 00 00 
+  800be0:	ff d0                	call   *%rax
+  800be2:	84 c0                	test   %al,%al
+  800be4:	0f 85 61 ff ff ff    	jne    800b4b <bc_load+0x27>
+        int slot = read_slot(b);
+  800bea:	44 89 f7             	mov    %r14d,%edi
+  800bed:	48 b8 6f 01 80 00 00 	movabs $0x80016f,%rax
+  800bf4:	00 00 00 
+  800bf7:	ff d0                	call   *%rax
+        if (slot >= 0) {
+  800bf9:	85 c0                	test   %eax,%eax
+  800bfb:	0f 89 50 ff ff ff    	jns    800b51 <bc_load+0x2d>
+        while (i + n < count && n < RA_MAX_WINDOW && !is_page_present(blockaddr(b + n)) &&
+  800c01:	41 8d 45 01          	lea    0x1(%r13),%eax
+        blockno_t n = 1;
+  800c05:	bb 01 00 00 00       	mov    $0x1,%ebx
+        while (i + n < count && n < RA_MAX_WINDOW && !is_page_present(blockaddr(b + n)) &&
+  800c0a:	44 39 f8             	cmp    %r15d,%eax
+  800c0d:	0f 83 4e ff ff ff    	jae    800b61 <bc_load+0x3d>
+  800c13:	45 8d 24 1e          	lea    (%r14,%rbx,1),%r12d
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  800c17:	44 89 e7             	mov    %r12d,%edi
+  800c1a:	48 81 c7 00 00 01 00 	add    $0x10000,%rdi
+  800c21:	48 c1 e7 0c          	shl    $0xc,%rdi
+        while (i + n < count && n < RA_MAX_WINDOW && !is_page_present(blockaddr(b + n)) &&
+  800c25:	48 b8 25 d1 80 00 00 	movabs $0x80d125,%rax
+  800c2c:	00 00 00 
+  800c2f:	ff d0                	call   *%rax
+  800c31:	84 c0                	test   %al,%al
+  800c33:	0f 85 28 ff ff ff    	jne    800b61 <bc_load+0x3d>
+               read_slot(b + n) < 0) n++;
+  800c39:	44 89 e7             	mov    %r12d,%edi
+  800c3c:	48 b8 6f 01 80 00 00 	movabs $0x80016f,%rax
+  800c43:	00 00 00 
+  800c46:	ff d0                	call   *%rax
+        while (i + n < count && n < RA_MAX_WINDOW && !is_page_present(blockaddr(b + n)) &&
+  800c48:	85 c0                	test   %eax,%eax
+  800c4a:	0f 89 11 ff ff ff    	jns    800b61 <bc_load+0x3d>
+               read_slot(b + n) < 0) n++;
+  800c50:	83 c3 01             	add    $0x1,%ebx
+        while (i + n < count && n < RA_MAX_WINDOW && !is_page_present(blockaddr(b + n)) &&
+  800c53:	42 8d 04 2b          	lea    (%rbx,%r13,1),%eax
+  800c57:	44 39 f8             	cmp    %r15d,%eax
+  800c5a:	0f 83 01 ff ff ff    	jae    800b61 <bc_load+0x3d>
+  800c60:	83 fb 3f             	cmp    $0x3f,%ebx
+  800c63:	76 ae                	jbe    800c13 <bc_load+0xef>
+  800c65:	e9 f7 fe ff ff       	jmp    800b61 <bc_load+0x3d>
+    }
+}
+  800c6a:	48 83 c4 18          	add    $0x18,%rsp
+  800c6e:	5b                   	pop    %rbx
+  800c6f:	41 5c                	pop    %r12
+  800c71:	41 5d                	pop    %r13
+  800c73:	41 5e                	pop    %r14
+  800c75:	41 5f                	pop    %r15
+  800c77:	5d                   	pop    %rbp
+  800c78:	c3                   	ret
+
+0000000000800c79 <bc_put>:
+/* Release block returned by bc_get().  Blocks are only evicted
+ * between requests, and an evicted block is loaded again by
+ * bc_pgfault() if its address is used later, so this only marks
+ * the block recently used. */
+void
+bc_put(void *blk) {
+  800c79:	55                   	push   %rbp
+  800c7a:	48 89 e5             	mov    %rsp,%rbp
+    assert(blk >= (void *)DISKMAP && blk < (void *)(DISKMAP + DISKSIZE));
+  800c7d:	48 81 ef 00 00 00 10 	sub    $0x10000000,%rdi
+  800c84:	b8 ff ff ff bf       	mov    $0xbfffffff,%eax
+  800c89:	48 39 f8             	cmp    %rdi,%rax
+  800c8c:	72 12                	jb     800ca0 <bc_put+0x27>
+    mark_used(((uintptr_t)blk - DISKMAP) / BLKSIZE);
+  800c8e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  800c92:	48 b8 28 01 80 00 00 	movabs $0x800128,%rax
+  800c99:	00 00 00 
+  800c9c:	ff d0                	call   *%rax
+}
+  800c9e:	5d                   	pop    %rbp
+  800c9f:	c3                   	ret
+    assert(blk >= (void *)DISKMAP && blk < (void *)(DISKMAP + DISKSIZE));
+  800ca0:	48 b9 f0 e1 80 00 00 	movabs $0x80e1f0,%rcx
+  800ca7:	00 00 00 
+  800caa:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  800cb1:	00 00 00 
+  800cb4:	be 4a 02 00 00       	mov    $0x24a,%esi
+  800cb9:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  800cc0:	00 00 00 
+  800cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc8:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  800ccf:	00 00 00 
+  800cd2:	41 ff d0             	call   *%r8
+
+0000000000800cd5 <bc_touch>:
+
+/* Note use of count blocks starting with blockno, which is
+ * a hit for each of them that is cached */
+void
+bc_touch(blockno_t blockno, blockno_t count) {
+  800cd5:	55                   	push   %rbp
+  800cd6:	48 89 e5             	mov    %rsp,%rbp
+  800cd9:	41 57                	push   %r15
+  800cdb:	41 56                	push   %r14
+  800cdd:	41 55                	push   %r13
+  800cdf:	41 54                	push   %r12
+  800ce1:	53                   	push   %rbx
+  800ce2:	48 83 ec 08          	sub    $0x8,%rsp
+    for (blockno_t b = blockno; b < blockno + count; b++) {
+  800ce6:	44 8d 24 37          	lea    (%rdi,%rsi,1),%r12d
+  800cea:	44 39 e7             	cmp    %r12d,%edi
+  800ced:	73 4c                	jae    800d3b <bc_touch+0x66>
+  800cef:	89 fb                	mov    %edi,%ebx
+        mark_used(b);
+  800cf1:	49 bf 28 01 80 00 00 	movabs $0x800128,%r15
+  800cf8:	00 00 00 
+        if (TSTBIT(resident_map, b)) bc_stats.hits++;
+  800cfb:	49 be a0 e1 85 00 00 	movabs $0x85e1a0,%r14
+  800d02:	00 00 00 
+  800d05:	49 bd 20 60 81 00 00 	movabs $0x816020,%r13
+  800d0c:	00 00 00 
+  800d0f:	eb 08                	jmp    800d19 <bc_touch+0x44>
+    for (blockno_t b = blockno; b < blockno + count; b++) {
+  800d11:	83 c3 01             	add    $0x1,%ebx
+  800d14:	44 39 e3             	cmp    %r12d,%ebx
+  800d17:	74 22                	je     800d3b <bc_touch+0x66>
+        mark_used(b);
+  800d19:	89 df                	mov    %ebx,%edi
+  800d1b:	41 ff d7             	call   *%r15
+        if (TSTBIT(resident_map, b)) bc_stats.hits++;
+  800d1e:	89 da                	mov    %ebx,%edx
+  800d20:	c1 ea 05             	shr    $0x5,%edx
+  800d23:	89 d2                	mov    %edx,%edx
+  800d25:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d2a:	89 d9                	mov    %ebx,%ecx
+  800d2c:	d3 e0                	shl    %cl,%eax
+  800d2e:	41 23 04 96          	and    (%r14,%rdx,4),%eax
+  800d32:	74 dd                	je     800d11 <bc_touch+0x3c>
+  800d34:	49 83 45 60 01       	addq   $0x1,0x60(%r13)
+  800d39:	eb d6                	jmp    800d11 <bc_touch+0x3c>
+    }
+}
+  800d3b:	48 83 c4 08          	add    $0x8,%rsp
+  800d3f:	5b                   	pop    %rbx
+  800d40:	41 5c                	pop    %r12
+  800d42:	41 5d                	pop    %r13
+  800d44:	41 5e                	pop    %r14
+  800d46:	41 5f                	pop    %r15
+  800d48:	5d                   	pop    %rbp
+  800d49:	c3                   	ret
+
+0000000000800d4a <bc_pin>:
+
+/* Never evict count blocks starting with blockno */
+void
+bc_pin(blockno_t blockno, blockno_t count) {
+  800d4a:	89 f9                	mov    %edi,%ecx
+    for (blockno_t b = blockno; b < blockno + count; b++)
+  800d4c:	01 fe                	add    %edi,%esi
+  800d4e:	39 f7                	cmp    %esi,%edi
+  800d50:	73 26                	jae    800d78 <bc_pin+0x2e>
+        SETBIT(pin_map, b);
+  800d52:	48 ba a0 e1 82 00 00 	movabs $0x82e1a0,%rdx
+  800d59:	00 00 00 
+  800d5c:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  800d62:	89 c8                	mov    %ecx,%eax
+  800d64:	c1 e8 05             	shr    $0x5,%eax
+  800d67:	89 c0                	mov    %eax,%eax
+  800d69:	44 89 c7             	mov    %r8d,%edi
+  800d6c:	d3 e7                	shl    %cl,%edi
+  800d6e:	09 3c 82             	or     %edi,(%rdx,%rax,4)
+    for (blockno_t b = blockno; b < blockno + count; b++)
+  800d71:	83 c1 01             	add    $0x1,%ecx
+  800d74:	39 f1                	cmp    %esi,%ecx
+  800d76:	75 ea                	jne    800d62 <bc_pin+0x18>
+}
+  800d78:	c3                   	ret
+
+0000000000800d79 <bc_unpin>:
+
+/* Let count blocks starting with blockno be evicted again */
+void
+bc_unpin(blockno_t blockno, blockno_t count) {
+  800d79:	89 f9                	mov    %edi,%ecx
+    for (blockno_t b = blockno; b < blockno + count; b++)
+  800d7b:	01 fe                	add    %edi,%esi
+  800d7d:	39 f7                	cmp    %esi,%edi
+  800d7f:	73 28                	jae    800da9 <bc_unpin+0x30>
+        CLRBIT(pin_map, b);
+  800d81:	48 bf a0 e1 82 00 00 	movabs $0x82e1a0,%rdi
+  800d88:	00 00 00 
+  800d8b:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  800d91:	89 c8                	mov    %ecx,%eax
+  800d93:	c1 e8 05             	shr    $0x5,%eax
+  800d96:	89 c0                	mov    %eax,%eax
+  800d98:	44 89 c2             	mov    %r8d,%edx
+  800d9b:	d3 e2                	shl    %cl,%edx
+  800d9d:	f7 d2                	not    %edx
+  800d9f:	21 14 87             	and    %edx,(%rdi,%rax,4)
+    for (blockno_t b = blockno; b < blockno + count; b++)
+  800da2:	83 c1 01             	add    $0x1,%ecx
+  800da5:	39 f1                	cmp    %esi,%ecx
+  800da7:	75 e8                	jne    800d91 <bc_unpin+0x18>
+}
+  800da9:	c3                   	ret
+
+0000000000800daa <bc_cold>:
+
+/* Count blocks starting with blockno are not going to be used
+ * soon: clear their reference bits and move the hand to them,
+ * so that they are evicted first */
+void
+bc_cold(blockno_t blockno, blockno_t count) {
+  800daa:	89 f8                	mov    %edi,%eax
+    for (blockno_t b = blockno; b < blockno + count; b++)
+  800dac:	01 fe                	add    %edi,%esi
+  800dae:	39 f7                	cmp    %esi,%edi
+  800db0:	73 2d                	jae    800ddf <bc_cold+0x35>
+  800db2:	89 f9                	mov    %edi,%ecx
+        CLRBIT(ref_map, b);
+  800db4:	49 b9 a0 61 84 00 00 	movabs $0x8461a0,%r9
+  800dbb:	00 00 00 
+  800dbe:	41 ba 01 00 00 00    	mov    $0x1,%r10d
+  800dc4:	89 ca                	mov    %ecx,%edx
+  800dc6:	c1 ea 05             	shr    $0x5,%edx
+  800dc9:	89 d2                	mov    %edx,%edx
+  800dcb:	45 89 d0             	mov    %r10d,%r8d
+  800dce:	41 d3 e0             	shl    %cl,%r8d
+  800dd1:	41 f7 d0             	not    %r8d
+  800dd4:	45 21 04 91          	and    %r8d,(%r9,%rdx,4)
+    for (blockno_t b = blockno; b < blockno + count; b++)
+  800dd8:	83 c1 01             	add    $0x1,%ecx
+  800ddb:	39 f1                	cmp    %esi,%ecx
+  800ddd:	75 e5                	jne    800dc4 <bc_cold+0x1a>
+    clock_hand = blockno;
+  800ddf:	a3 80 e1 82 00 00 00 	movabs %eax,0x82e180
+  800de6:	00 00 
+}
+  800de8:	c3                   	ret
+
+0000000000800de9 <bc_drop>:
+/* Forget cached copies of count blocks starting with blockno without
+ * writing them back, so that they are read from disk on next use.
+ * Used for journal log blocks, which are only read by replay, and
+ * by tests to see what is on disk as if the server restarted. */
+void
+bc_drop(blockno_t blockno, blockno_t count) {
+  800de9:	55                   	push   %rbp
+  800dea:	48 89 e5             	mov    %rsp,%rbp
+  800ded:	41 57                	push   %r15
+  800def:	41 56                	push   %r14
+  800df1:	41 55                	push   %r13
+  800df3:	41 54                	push   %r12
+  800df5:	53                   	push   %rbx
+  800df6:	48 83 ec 18          	sub    $0x18,%rsp
+    for (blockno_t b = blockno; b < blockno + count; b++) {
+  800dfa:	8d 04 37             	lea    (%rdi,%rsi,1),%eax
+  800dfd:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800e00:	39 c7                	cmp    %eax,%edi
+  800e02:	0f 83 86 00 00 00    	jae    800e8e <bc_drop+0xa5>
+  800e08:	41 89 fc             	mov    %edi,%r12d
+  800e0b:	41 89 fe             	mov    %edi,%r14d
+  800e0e:	49 81 c6 00 00 01 00 	add    $0x10000,%r14
+  800e15:	49 c1 e6 0c          	shl    $0xc,%r14
+        CLRBIT(dirty_map, b);
+  800e19:	49 bf e0 f1 88 00 00 	movabs $0x88f1e0,%r15
+  800e20:	00 00 00 
+  800e23:	eb 13                	jmp    800e38 <bc_drop+0x4f>
+    for (blockno_t b = blockno; b < blockno + count; b++) {
+  800e25:	41 83 c4 01          	add    $0x1,%r12d
+  800e29:	49 81 c6 00 10 00 00 	add    $0x1000,%r14
+  800e30:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800e33:	41 39 c4             	cmp    %eax,%r12d
+  800e36:	74 56                	je     800e8e <bc_drop+0xa5>
+        CLRBIT(dirty_map, b);
+  800e38:	45 89 e5             	mov    %r12d,%r13d
+  800e3b:	41 c1 ed 05          	shr    $0x5,%r13d
+  800e3f:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800e44:	44 89 e1             	mov    %r12d,%ecx
+  800e47:	d3 e3                	shl    %cl,%ebx
+  800e49:	45 89 ed             	mov    %r13d,%r13d
+  800e4c:	89 d8                	mov    %ebx,%eax
+  800e4e:	f7 d0                	not    %eax
+  800e50:	43 21 04 af          	and    %eax,(%r15,%r13,4)
+        sys_unmap_region(CURENVID, blockaddr(b), BLKSIZE);
+  800e54:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e59:	4c 89 f6             	mov    %r14,%rsi
+  800e5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e61:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  800e68:	00 00 00 
+  800e6b:	ff d0                	call   *%rax
+        if (TSTBIT(resident_map, b)) drop_resident(b);
+  800e6d:	48 b8 a0 e1 85 00 00 	movabs $0x85e1a0,%rax
+  800e74:	00 00 00 
+  800e77:	42 23 1c a8          	and    (%rax,%r13,4),%ebx
+  800e7b:	74 a8                	je     800e25 <bc_drop+0x3c>
+  800e7d:	44 89 e7             	mov    %r12d,%edi
+  800e80:	48 b8 b5 00 80 00 00 	movabs $0x8000b5,%rax
+  800e87:	00 00 00 
+  800e8a:	ff d0                	call   *%rax
+  800e8c:	eb 97                	jmp    800e25 <bc_drop+0x3c>
+    }
+}
+  800e8e:	48 83 c4 18          	add    $0x18,%rsp
+  800e92:	5b                   	pop    %rbx
+  800e93:	41 5c                	pop    %r12
+  800e95:	41 5d                	pop    %r13
+  800e97:	41 5e                	pop    %r14
+  800e99:	41 5f                	pop    %r15
+  800e9b:	5d                   	pop    %rbp
+  800e9c:	c3                   	ret
+
+0000000000800e9d <flush_block>:
+/* Flush the contents of the block containing VA out to disk if
+ * it is in the dirty set, then map it read-only clearing PTE_D.
+ * If the block is not in the block cache or is not dirty, does
+ * nothing. */
+void
+flush_block(void *addr) {
+  800e9d:	55                   	push   %rbp
+  800e9e:	48 89 e5             	mov    %rsp,%rbp
+  800ea1:	41 54                	push   %r12
+  800ea3:	53                   	push   %rbx
+  800ea4:	48 89 fb             	mov    %rdi,%rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  800ea7:	48 8d 87 00 00 00 f0 	lea    -0x10000000(%rdi),%rax
+  800eae:	48 89 c1             	mov    %rax,%rcx
+  800eb1:	48 c1 e9 0c          	shr    $0xc,%rcx
+
+    if (addr < (void *)(uintptr_t)DISKMAP || addr >= (void *)(uintptr_t)(DISKMAP + DISKSIZE))
+  800eb5:	ba ff ff ff bf       	mov    $0xbfffffff,%edx
+  800eba:	48 39 c2             	cmp    %rax,%rdx
+  800ebd:	72 41                	jb     800f00 <flush_block+0x63>
+  800ebf:	41 89 cc             	mov    %ecx,%r12d
+        panic("flush_block of bad va %p", addr);
+    if (blockno && super && blockno >= super->s_nblocks)
+  800ec2:	85 c9                	test   %ecx,%ecx
+  800ec4:	74 18                	je     800ede <flush_block+0x41>
+  800ec6:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  800ecd:	00 00 00 
+  800ed0:	48 85 c0             	test   %rax,%rax
+  800ed3:	74 09                	je     800ede <flush_block+0x41>
+  800ed5:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  800ed9:	44 39 c1             	cmp    %r8d,%ecx
+  800edc:	73 50                	jae    800f2e <flush_block+0x91>
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+
+    if (!TSTBIT(dirty_map, blockno) || deferred(blockno)) return;
+  800ede:	89 ca                	mov    %ecx,%edx
+  800ee0:	c1 ea 05             	shr    $0x5,%edx
+  800ee3:	89 d2                	mov    %edx,%edx
+  800ee5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eea:	d3 e0                	shl    %cl,%eax
+  800eec:	48 b9 e0 f1 88 00 00 	movabs $0x88f1e0,%rcx
+  800ef3:	00 00 00 
+  800ef6:	23 04 91             	and    (%rcx,%rdx,4),%eax
+  800ef9:	75 5e                	jne    800f59 <flush_block+0xbc>
+    bc_write_blocks(blockno, 1);
+
+    assert(!is_page_dirty(ROUNDDOWN(addr, BLKSIZE)));
+}
+  800efb:	5b                   	pop    %rbx
+  800efc:	41 5c                	pop    %r12
+  800efe:	5d                   	pop    %rbp
+  800eff:	c3                   	ret
+        panic("flush_block of bad va %p", addr);
+  800f00:	48 89 f9             	mov    %rdi,%rcx
+  800f03:	48 ba 59 e0 80 00 00 	movabs $0x80e059,%rdx
+  800f0a:	00 00 00 
+  800f0d:	be bf 02 00 00       	mov    $0x2bf,%esi
+  800f12:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  800f19:	00 00 00 
+  800f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f21:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  800f28:	00 00 00 
+  800f2b:	41 ff d0             	call   *%r8
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  800f2e:	48 ba 30 e2 80 00 00 	movabs $0x80e230,%rdx
+  800f35:	00 00 00 
+  800f38:	be c1 02 00 00       	mov    $0x2c1,%esi
+  800f3d:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  800f44:	00 00 00 
+  800f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4c:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  800f53:	00 00 00 
+  800f56:	41 ff d1             	call   *%r9
+    if (!TSTBIT(dirty_map, blockno) || deferred(blockno)) return;
+  800f59:	44 89 e7             	mov    %r12d,%edi
+  800f5c:	48 b8 34 05 80 00 00 	movabs $0x800534,%rax
+  800f63:	00 00 00 
+  800f66:	ff d0                	call   *%rax
+  800f68:	84 c0                	test   %al,%al
+  800f6a:	75 8f                	jne    800efb <flush_block+0x5e>
+    bc_write_blocks(blockno, 1);
+  800f6c:	be 01 00 00 00       	mov    $0x1,%esi
+  800f71:	44 89 e7             	mov    %r12d,%edi
+  800f74:	48 b8 f6 09 80 00 00 	movabs $0x8009f6,%rax
+  800f7b:	00 00 00 
+  800f7e:	ff d0                	call   *%rax
+    assert(!is_page_dirty(ROUNDDOWN(addr, BLKSIZE)));
+  800f80:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  800f87:	48 89 df             	mov    %rbx,%rdi
+  800f8a:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  800f91:	00 00 00 
+  800f94:	ff d0                	call   *%rax
+  800f96:	84 c0                	test   %al,%al
+  800f98:	0f 84 5d ff ff ff    	je     800efb <flush_block+0x5e>
+  800f9e:	48 b9 60 e2 80 00 00 	movabs $0x80e260,%rcx
+  800fa5:	00 00 00 
+  800fa8:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  800faf:	00 00 00 
+  800fb2:	be c6 02 00 00       	mov    $0x2c6,%esi
+  800fb7:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  800fbe:	00 00 00 
+  800fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc6:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  800fcd:	00 00 00 
+  800fd0:	41 ff d0             	call   *%r8
+
+0000000000800fd3 <flush_blocks>:
+
+/* Flush dirty blocks among count blocks starting with blockno,
+ * adjacent dirty blocks are written together */
+void
+flush_blocks(blockno_t blockno, blockno_t count) {
+  800fd3:	55                   	push   %rbp
+  800fd4:	48 89 e5             	mov    %rsp,%rbp
+  800fd7:	41 57                	push   %r15
+  800fd9:	41 56                	push   %r14
+  800fdb:	41 55                	push   %r13
+  800fdd:	41 54                	push   %r12
+  800fdf:	53                   	push   %rbx
+  800fe0:	48 83 ec 18          	sub    $0x18,%rsp
+  800fe4:	89 7d c8             	mov    %edi,-0x38(%rbp)
+    for (blockno_t i = 0; i < count;) {
+  800fe7:	85 f6                	test   %esi,%esi
+  800fe9:	0f 84 db 00 00 00    	je     8010ca <flush_blocks+0xf7>
+  800fef:	41 89 f6             	mov    %esi,%r14d
+  800ff2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        if (!TSTBIT(dirty_map, blockno + i) || deferred(blockno + i)) {
+  800ff8:	49 bf e0 f1 88 00 00 	movabs $0x88f1e0,%r15
+  800fff:	00 00 00 
+  801002:	eb 0d                	jmp    801011 <flush_blocks+0x3e>
+            i++;
+  801004:	41 83 c4 01          	add    $0x1,%r12d
+    for (blockno_t i = 0; i < count;) {
+  801008:	45 39 f4             	cmp    %r14d,%r12d
+  80100b:	0f 83 b9 00 00 00    	jae    8010ca <flush_blocks+0xf7>
+        if (!TSTBIT(dirty_map, blockno + i) || deferred(blockno + i)) {
+  801011:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801014:	42 8d 34 20          	lea    (%rax,%r12,1),%esi
+  801018:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80101b:	89 f2                	mov    %esi,%edx
+  80101d:	c1 ea 05             	shr    $0x5,%edx
+  801020:	89 d2                	mov    %edx,%edx
+  801022:	b8 01 00 00 00       	mov    $0x1,%eax
+  801027:	89 f3                	mov    %esi,%ebx
+  801029:	89 f1                	mov    %esi,%ecx
+  80102b:	d3 e0                	shl    %cl,%eax
+  80102d:	41 23 04 97          	and    (%r15,%rdx,4),%eax
+  801031:	74 d1                	je     801004 <flush_blocks+0x31>
+  801033:	89 f7                	mov    %esi,%edi
+  801035:	48 b8 34 05 80 00 00 	movabs $0x800534,%rax
+  80103c:	00 00 00 
+  80103f:	ff d0                	call   *%rax
+  801041:	84 c0                	test   %al,%al
+  801043:	75 bf                	jne    801004 <flush_blocks+0x31>
+            continue;
+        }
+        blockno_t n = 1;
+        while (i + n < count && n < WB_MAX_RUN && TSTBIT(dirty_map, blockno + i + n) &&
+  801045:	41 83 c4 01          	add    $0x1,%r12d
+  801049:	45 39 f4             	cmp    %r14d,%r12d
+  80104c:	73 74                	jae    8010c2 <flush_blocks+0xef>
+  80104e:	83 c3 01             	add    $0x1,%ebx
+  801051:	89 da                	mov    %ebx,%edx
+  801053:	c1 ea 05             	shr    $0x5,%edx
+  801056:	89 d2                	mov    %edx,%edx
+  801058:	b8 01 00 00 00       	mov    $0x1,%eax
+  80105d:	89 d9                	mov    %ebx,%ecx
+  80105f:	d3 e0                	shl    %cl,%eax
+  801061:	41 23 04 97          	and    (%r15,%rdx,4),%eax
+        blockno_t n = 1;
+  801065:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+        while (i + n < count && n < WB_MAX_RUN && TSTBIT(dirty_map, blockno + i + n) &&
+  80106b:	74 3e                	je     8010ab <flush_blocks+0xd8>
+               !deferred(blockno + i + n)) n++;
+  80106d:	89 df                	mov    %ebx,%edi
+  80106f:	48 b8 34 05 80 00 00 	movabs $0x800534,%rax
+  801076:	00 00 00 
+  801079:	ff d0                	call   *%rax
+        while (i + n < count && n < WB_MAX_RUN && TSTBIT(dirty_map, blockno + i + n) &&
+  80107b:	84 c0                	test   %al,%al
+  80107d:	75 2c                	jne    8010ab <flush_blocks+0xd8>
+               !deferred(blockno + i + n)) n++;
+  80107f:	41 83 c5 01          	add    $0x1,%r13d
+        while (i + n < count && n < WB_MAX_RUN && TSTBIT(dirty_map, blockno + i + n) &&
+  801083:	41 83 c4 01          	add    $0x1,%r12d
+  801087:	41 83 fd 3f          	cmp    $0x3f,%r13d
+  80108b:	77 1e                	ja     8010ab <flush_blocks+0xd8>
+  80108d:	45 39 f4             	cmp    %r14d,%r12d
+  801090:	73 19                	jae    8010ab <flush_blocks+0xd8>
+  801092:	83 c3 01             	add    $0x1,%ebx
+  801095:	89 da                	mov    %ebx,%edx
+  801097:	c1 ea 05             	shr    $0x5,%edx
+  80109a:	89 d2                	mov    %edx,%edx
+  80109c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010a1:	89 d9                	mov    %ebx,%ecx
+  8010a3:	d3 e0                	shl    %cl,%eax
+  8010a5:	41 23 04 97          	and    (%r15,%rdx,4),%eax
+  8010a9:	75 c2                	jne    80106d <flush_blocks+0x9a>
+        bc_write_blocks(blockno + i, n);
+  8010ab:	44 89 ee             	mov    %r13d,%esi
+  8010ae:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8010b1:	48 b8 f6 09 80 00 00 	movabs $0x8009f6,%rax
+  8010b8:	00 00 00 
+  8010bb:	ff d0                	call   *%rax
+        i += n;
+  8010bd:	e9 46 ff ff ff       	jmp    801008 <flush_blocks+0x35>
+        blockno_t n = 1;
+  8010c2:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  8010c8:	eb e1                	jmp    8010ab <flush_blocks+0xd8>
+    }
+}
+  8010ca:	48 83 c4 18          	add    $0x18,%rsp
+  8010ce:	5b                   	pop    %rbx
+  8010cf:	41 5c                	pop    %r12
+  8010d1:	41 5d                	pop    %r13
+  8010d3:	41 5e                	pop    %r14
+  8010d5:	41 5f                	pop    %r15
+  8010d7:	5d                   	pop    %rbp
+  8010d8:	c3                   	ret
+
+00000000008010d9 <bc_sync>:
+ * With journal on, data blocks are written first, so that committed
+ * metadata never refers to stale data.  Then dirty metadata blocks
+ * are committed as one transaction and left in the cache mapped
+ * read-only, they are written home by bc_checkpoint(). */
+void
+bc_sync(void) {
+  8010d9:	55                   	push   %rbp
+  8010da:	48 89 e5             	mov    %rsp,%rbp
+  8010dd:	41 57                	push   %r15
+  8010df:	41 56                	push   %r14
+  8010e1:	41 55                	push   %r13
+  8010e3:	41 54                	push   %r12
+  8010e5:	53                   	push   %rbx
+  8010e6:	48 83 ec 08          	sub    $0x8,%rsp
+    dirty_compact();
+  8010ea:	48 b8 ae 01 80 00 00 	movabs $0x8001ae,%rax
+  8010f1:	00 00 00 
+  8010f4:	ff d0                	call   *%rax
+    if (!journal_active()) {
+  8010f6:	48 b8 b3 4b 80 00 00 	movabs $0x804bb3,%rax
+  8010fd:	00 00 00 
+  801100:	ff d0                	call   *%rax
+  801102:	84 c0                	test   %al,%al
+  801104:	74 63                	je     801169 <bc_sync+0x90>
+        return;
+    }
+
+    /* Write data, leaving only metadata in dirty_list */
+    size_t count = 0;
+    for (size_t i = 0; i < ndirty;) {
+  801106:	48 a1 c8 e1 88 00 00 	movabs 0x88e1c8,%rax
+  80110d:	00 00 00 
+  801110:	bb 00 00 00 00       	mov    $0x0,%ebx
+    size_t count = 0;
+  801115:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        if (TSTBIT(meta_map, dirty_list[i])) {
+  80111b:	49 be e0 e1 88 00 00 	movabs $0x88e1e0,%r14
+  801122:	00 00 00 
+  801125:	49 bc c0 61 87 00 00 	movabs $0x8761c0,%r12
+  80112c:	00 00 00 
+            continue;
+        }
+        size_t n = 1;
+        while (i + n < ndirty && n < WB_MAX_RUN && dirty_list[i + n] == dirty_list[i] + n &&
+               !TSTBIT(meta_map, dirty_list[i + n])) n++;
+        bc_write_blocks(dirty_list[i], n);
+  80112f:	49 bf f6 09 80 00 00 	movabs $0x8009f6,%r15
+  801136:	00 00 00 
+    for (size_t i = 0; i < ndirty;) {
+  801139:	48 85 c0             	test   %rax,%rax
+  80113c:	0f 85 2a 01 00 00    	jne    80126c <bc_sync+0x193>
+        i += n;
+    }
+
+    ndirty = nmeta = 0;
+  801142:	48 b8 a8 61 87 00 00 	movabs $0x8761a8,%rax
+  801149:	00 00 00 
+  80114c:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  801153:	48 b8 c8 e1 88 00 00 	movabs $0x88e1c8,%rax
+  80115a:	00 00 00 
+  80115d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    if (!count) return;
+  801164:	e9 38 02 00 00       	jmp    8013a1 <bc_sync+0x2c8>
+        write_list(dirty_list, ndirty);
+  801169:	48 b8 c8 e1 88 00 00 	movabs $0x88e1c8,%rax
+  801170:	00 00 00 
+  801173:	48 8b 18             	mov    (%rax),%rbx
+    for (size_t i = 0; i < count;) {
+  801176:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        while (i + n < count && n < WB_MAX_RUN && list[i + n] == list[i] + n) n++;
+  80117c:	49 bc e0 e1 88 00 00 	movabs $0x88e1e0,%r12
+  801183:	00 00 00 
+        bc_write_blocks(list[i], n);
+  801186:	49 be f6 09 80 00 00 	movabs $0x8009f6,%r14
+  80118d:	00 00 00 
+    for (size_t i = 0; i < count;) {
+  801190:	48 85 db             	test   %rbx,%rbx
+  801193:	75 1c                	jne    8011b1 <bc_sync+0xd8>
+  801195:	e9 71 02 00 00       	jmp    80140b <bc_sync+0x332>
+  80119a:	49 89 d5             	mov    %rdx,%r13
+  80119d:	eb 03                	jmp    8011a2 <bc_sync+0xc9>
+        while (i + n < count && n < WB_MAX_RUN && list[i + n] == list[i] + n) n++;
+  80119f:	49 89 c5             	mov    %rax,%r13
+        bc_write_blocks(list[i], n);
+  8011a2:	44 89 cf             	mov    %r9d,%edi
+  8011a5:	41 ff d6             	call   *%r14
+    for (size_t i = 0; i < count;) {
+  8011a8:	49 39 dd             	cmp    %rbx,%r13
+  8011ab:	0f 83 5a 02 00 00    	jae    80140b <bc_sync+0x332>
+        while (i + n < count && n < WB_MAX_RUN && list[i + n] == list[i] + n) n++;
+  8011b1:	49 8d 55 01          	lea    0x1(%r13),%rdx
+  8011b5:	48 39 da             	cmp    %rbx,%rdx
+  8011b8:	0f 83 2e 02 00 00    	jae    8013ec <bc_sync+0x313>
+  8011be:	47 8b 0c ac          	mov    (%r12,%r13,4),%r9d
+  8011c2:	45 89 c8             	mov    %r9d,%r8d
+  8011c5:	49 8d 45 02          	lea    0x2(%r13),%rax
+        size_t n = 1;
+  8011c9:	be 01 00 00 00       	mov    $0x1,%esi
+        while (i + n < count && n < WB_MAX_RUN && list[i + n] == list[i] + n) n++;
+  8011ce:	4d 29 e8             	sub    %r13,%r8
+  8011d1:	49 83 e8 01          	sub    $0x1,%r8
+  8011d5:	41 8b 3c 94          	mov    (%r12,%rdx,4),%edi
+  8011d9:	49 8d 0c 00          	lea    (%r8,%rax,1),%rcx
+  8011dd:	48 39 cf             	cmp    %rcx,%rdi
+  8011e0:	75 b8                	jne    80119a <bc_sync+0xc1>
+  8011e2:	48 83 c6 01          	add    $0x1,%rsi
+  8011e6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011ea:	48 89 c2             	mov    %rax,%rdx
+  8011ed:	48 39 d8             	cmp    %rbx,%rax
+  8011f0:	73 ad                	jae    80119f <bc_sync+0xc6>
+  8011f2:	48 83 fe 3f          	cmp    $0x3f,%rsi
+  8011f6:	77 a7                	ja     80119f <bc_sync+0xc6>
+  8011f8:	48 89 c8             	mov    %rcx,%rax
+  8011fb:	eb d8                	jmp    8011d5 <bc_sync+0xfc>
+        while (i + n < ndirty && n < WB_MAX_RUN && dirty_list[i + n] == dirty_list[i] + n &&
+  8011fd:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  801201:	48 39 c2             	cmp    %rax,%rdx
+  801204:	0f 83 90 00 00 00    	jae    80129a <bc_sync+0x1c1>
+  80120a:	4d 8d 0c 9e          	lea    (%r14,%rbx,4),%r9
+  80120e:	48 89 d3             	mov    %rdx,%rbx
+        size_t n = 1;
+  801211:	be 01 00 00 00       	mov    $0x1,%esi
+        while (i + n < ndirty && n < WB_MAX_RUN && dirty_list[i + n] == dirty_list[i] + n &&
+  801216:	44 89 c7             	mov    %r8d,%edi
+               !TSTBIT(meta_map, dirty_list[i + n])) n++;
+  801219:	41 ba 01 00 00 00    	mov    $0x1,%r10d
+        while (i + n < ndirty && n < WB_MAX_RUN && dirty_list[i + n] == dirty_list[i] + n &&
+  80121f:	41 8b 0c b1          	mov    (%r9,%rsi,4),%ecx
+  801223:	41 89 cb             	mov    %ecx,%r11d
+  801226:	48 8d 14 37          	lea    (%rdi,%rsi,1),%rdx
+  80122a:	49 39 d3             	cmp    %rdx,%r11
+  80122d:	75 28                	jne    801257 <bc_sync+0x17e>
+               !TSTBIT(meta_map, dirty_list[i + n])) n++;
+  80122f:	41 89 cb             	mov    %ecx,%r11d
+  801232:	41 c1 eb 05          	shr    $0x5,%r11d
+  801236:	45 89 db             	mov    %r11d,%r11d
+  801239:	44 89 d2             	mov    %r10d,%edx
+  80123c:	d3 e2                	shl    %cl,%edx
+  80123e:	43 23 14 9c          	and    (%r12,%r11,4),%edx
+        while (i + n < ndirty && n < WB_MAX_RUN && dirty_list[i + n] == dirty_list[i] + n &&
+  801242:	75 13                	jne    801257 <bc_sync+0x17e>
+               !TSTBIT(meta_map, dirty_list[i + n])) n++;
+  801244:	48 83 c6 01          	add    $0x1,%rsi
+        while (i + n < ndirty && n < WB_MAX_RUN && dirty_list[i + n] == dirty_list[i] + n &&
+  801248:	48 83 c3 01          	add    $0x1,%rbx
+  80124c:	48 83 fe 3f          	cmp    $0x3f,%rsi
+  801250:	77 05                	ja     801257 <bc_sync+0x17e>
+  801252:	48 39 c3             	cmp    %rax,%rbx
+  801255:	72 c8                	jb     80121f <bc_sync+0x146>
+        bc_write_blocks(dirty_list[i], n);
+  801257:	44 89 c7             	mov    %r8d,%edi
+  80125a:	41 ff d7             	call   *%r15
+    for (size_t i = 0; i < ndirty;) {
+  80125d:	48 a1 c8 e1 88 00 00 	movabs 0x88e1c8,%rax
+  801264:	00 00 00 
+  801267:	48 39 c3             	cmp    %rax,%rbx
+  80126a:	73 38                	jae    8012a4 <bc_sync+0x1cb>
+        if (TSTBIT(meta_map, dirty_list[i])) {
+  80126c:	45 8b 04 9e          	mov    (%r14,%rbx,4),%r8d
+  801270:	44 89 c6             	mov    %r8d,%esi
+  801273:	c1 ee 05             	shr    $0x5,%esi
+  801276:	89 f6                	mov    %esi,%esi
+  801278:	ba 01 00 00 00       	mov    $0x1,%edx
+  80127d:	44 89 c1             	mov    %r8d,%ecx
+  801280:	d3 e2                	shl    %cl,%edx
+  801282:	41 23 14 b4          	and    (%r12,%rsi,4),%edx
+  801286:	0f 84 71 ff ff ff    	je     8011fd <bc_sync+0x124>
+            dirty_list[count++] = dirty_list[i++];
+  80128c:	48 83 c3 01          	add    $0x1,%rbx
+  801290:	47 89 04 ae          	mov    %r8d,(%r14,%r13,4)
+  801294:	4d 8d 6d 01          	lea    0x1(%r13),%r13
+            continue;
+  801298:	eb c3                	jmp    80125d <bc_sync+0x184>
+        while (i + n < ndirty && n < WB_MAX_RUN && dirty_list[i + n] == dirty_list[i] + n &&
+  80129a:	48 89 d3             	mov    %rdx,%rbx
+        size_t n = 1;
+  80129d:	be 01 00 00 00       	mov    $0x1,%esi
+  8012a2:	eb b3                	jmp    801257 <bc_sync+0x17e>
+    ndirty = nmeta = 0;
+  8012a4:	48 b8 a8 61 87 00 00 	movabs $0x8761a8,%rax
+  8012ab:	00 00 00 
+  8012ae:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  8012b5:	48 b8 c8 e1 88 00 00 	movabs $0x88e1c8,%rax
+  8012bc:	00 00 00 
+  8012bf:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    if (!count) return;
+  8012c6:	4d 85 ed             	test   %r13,%r13
+  8012c9:	0f 84 d2 00 00 00    	je     8013a1 <bc_sync+0x2c8>
+
+    journal_commit(dirty_list, count);
+  8012cf:	4c 89 ee             	mov    %r13,%rsi
+  8012d2:	48 bf e0 e1 88 00 00 	movabs $0x88e1e0,%rdi
+  8012d9:	00 00 00 
+  8012dc:	48 b8 1f 4c 80 00 00 	movabs $0x804c1f,%rax
+  8012e3:	00 00 00 
+  8012e6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < count; i++) {
+  8012e8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        void *addr = blockaddr(dirty_list[i]);
+  8012ee:	49 bf e0 e1 88 00 00 	movabs $0x88e1e0,%r15
+  8012f5:	00 00 00 
+        int res = sys_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE,
+                                 PTE_SYSCALL & get_prot(addr) & ~PROT_W);
+        if (res) panic("bc: can't map committed block %08x: %i", dirty_list[i], res);
+        CLRBIT(dirty_map, dirty_list[i]);
+  8012f8:	49 be e0 f1 88 00 00 	movabs $0x88f1e0,%r14
+  8012ff:	00 00 00 
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  801302:	43 8b 1c a7          	mov    (%r15,%r12,4),%ebx
+  801306:	48 81 c3 00 00 01 00 	add    $0x10000,%rbx
+  80130d:	48 c1 e3 0c          	shl    $0xc,%rbx
+                                 PTE_SYSCALL & get_prot(addr) & ~PROT_W);
+  801311:	48 89 df             	mov    %rbx,%rdi
+  801314:	48 b8 c6 d0 80 00 00 	movabs $0x80d0c6,%rax
+  80131b:	00 00 00 
+  80131e:	ff d0                	call   *%rax
+        int res = sys_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE,
+  801320:	25 05 0e 00 00       	and    $0xe05,%eax
+  801325:	41 89 c1             	mov    %eax,%r9d
+  801328:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80132e:	48 89 d9             	mov    %rbx,%rcx
+  801331:	ba 00 00 00 00       	mov    $0x0,%edx
+  801336:	48 89 de             	mov    %rbx,%rsi
+  801339:	bf 00 00 00 00       	mov    $0x0,%edi
+  80133e:	48 b8 74 a2 80 00 00 	movabs $0x80a274,%rax
+  801345:	00 00 00 
+  801348:	ff d0                	call   *%rax
+        if (res) panic("bc: can't map committed block %08x: %i", dirty_list[i], res);
+  80134a:	85 c0                	test   %eax,%eax
+  80134c:	75 62                	jne    8013b0 <bc_sync+0x2d7>
+        CLRBIT(dirty_map, dirty_list[i]);
+  80134e:	43 8b 0c a7          	mov    (%r15,%r12,4),%ecx
+  801352:	89 c8                	mov    %ecx,%eax
+  801354:	c1 e8 05             	shr    $0x5,%eax
+  801357:	89 c0                	mov    %eax,%eax
+  801359:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+  80135e:	d3 c2                	rol    %cl,%edx
+  801360:	41 21 14 86          	and    %edx,(%r14,%rax,4)
+    for (size_t i = 0; i < count; i++) {
+  801364:	49 83 c4 01          	add    $0x1,%r12
+  801368:	4d 39 e5             	cmp    %r12,%r13
+  80136b:	75 95                	jne    801302 <bc_sync+0x229>
+    }
+    commit_time = vsys_gettime();
+  80136d:	48 b8 42 d2 80 00 00 	movabs $0x80d242,%rax
+  801374:	00 00 00 
+  801377:	ff d0                	call   *%rax
+  801379:	a3 a0 61 87 00 00 00 	movabs %eax,0x8761a0
+  801380:	00 00 
+    bc_stats.commits++;
+  801382:	48 bb 20 60 81 00 00 	movabs $0x816020,%rbx
+  801389:	00 00 00 
+  80138c:	48 83 43 40 01       	addq   $0x1,0x40(%rbx)
+    bc_stats.logged_blocks += journal_pending();
+  801391:	48 b8 e2 4b 80 00 00 	movabs $0x804be2,%rax
+  801398:	00 00 00 
+  80139b:	ff d0                	call   *%rax
+  80139d:	48 01 43 48          	add    %rax,0x48(%rbx)
+}
+  8013a1:	48 83 c4 08          	add    $0x8,%rsp
+  8013a5:	5b                   	pop    %rbx
+  8013a6:	41 5c                	pop    %r12
+  8013a8:	41 5d                	pop    %r13
+  8013aa:	41 5e                	pop    %r14
+  8013ac:	41 5f                	pop    %r15
+  8013ae:	5d                   	pop    %rbp
+  8013af:	c3                   	ret
+        if (res) panic("bc: can't map committed block %08x: %i", dirty_list[i], res);
+  8013b0:	48 ba e0 e1 88 00 00 	movabs $0x88e1e0,%rdx
+  8013b7:	00 00 00 
+  8013ba:	42 8b 0c a2          	mov    (%rdx,%r12,4),%ecx
+  8013be:	41 89 c0             	mov    %eax,%r8d
+  8013c1:	48 ba 90 e2 80 00 00 	movabs $0x80e290,%rdx
+  8013c8:	00 00 00 
+  8013cb:	be 0a 03 00 00       	mov    $0x30a,%esi
+  8013d0:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  8013d7:	00 00 00 
+  8013da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013df:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  8013e6:	00 00 00 
+  8013e9:	41 ff d1             	call   *%r9
+        bc_write_blocks(list[i], n);
+  8013ec:	48 b8 e0 e1 88 00 00 	movabs $0x88e1e0,%rax
+  8013f3:	00 00 00 
+  8013f6:	42 8b 3c a8          	mov    (%rax,%r13,4),%edi
+  8013fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8013ff:	48 b8 f6 09 80 00 00 	movabs $0x8009f6,%rax
+  801406:	00 00 00 
+  801409:	ff d0                	call   *%rax
+        ndirty = nmeta = 0;
+  80140b:	48 b8 a8 61 87 00 00 	movabs $0x8761a8,%rax
+  801412:	00 00 00 
+  801415:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  80141c:	48 b8 c8 e1 88 00 00 	movabs $0x88e1c8,%rax
+  801423:	00 00 00 
+  801426:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        return;
+  80142d:	e9 6f ff ff ff       	jmp    8013a1 <bc_sync+0x2c8>
+
+0000000000801432 <bc_checkpoint>:
+
+/* Write back every dirty block and write committed
+ * metadata home, leaving nothing for replay */
+void
+bc_checkpoint(void) {
+  801432:	55                   	push   %rbp
+  801433:	48 89 e5             	mov    %rsp,%rbp
+    bc_sync();
+  801436:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  80143d:	00 00 00 
+  801440:	ff d0                	call   *%rax
+    if (!journal_pending()) return;
+  801442:	48 b8 e2 4b 80 00 00 	movabs $0x804be2,%rax
+  801449:	00 00 00 
+  80144c:	ff d0                	call   *%rax
+  80144e:	48 85 c0             	test   %rax,%rax
+  801451:	75 02                	jne    801455 <bc_checkpoint+0x23>
+    journal_checkpoint();
+    bc_stats.checkpoints++;
+}
+  801453:	5d                   	pop    %rbp
+  801454:	c3                   	ret
+    journal_checkpoint();
+  801455:	48 b8 1c 50 80 00 00 	movabs $0x80501c,%rax
+  80145c:	00 00 00 
+  80145f:	ff d0                	call   *%rax
+    bc_stats.checkpoints++;
+  801461:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  801468:	00 00 00 
+  80146b:	48 83 40 50 01       	addq   $0x1,0x50(%rax)
+  801470:	eb e1                	jmp    801453 <bc_checkpoint+0x21>
+
+0000000000801472 <reserve_meta>:
+reserve_meta(void) {
+  801472:	55                   	push   %rbp
+  801473:	48 89 e5             	mov    %rsp,%rbp
+  801476:	53                   	push   %rbx
+  801477:	48 83 ec 08          	sub    $0x8,%rsp
+    if (journal_pending() + nmeta >= journal_capacity()) bc_checkpoint();
+  80147b:	48 b8 e2 4b 80 00 00 	movabs $0x804be2,%rax
+  801482:	00 00 00 
+  801485:	ff d0                	call   *%rax
+  801487:	48 89 c3             	mov    %rax,%rbx
+  80148a:	48 a1 a8 61 87 00 00 	movabs 0x8761a8,%rax
+  801491:	00 00 00 
+  801494:	48 01 c3             	add    %rax,%rbx
+  801497:	48 b8 bd 4b 80 00 00 	movabs $0x804bbd,%rax
+  80149e:	00 00 00 
+  8014a1:	ff d0                	call   *%rax
+  8014a3:	48 39 c3             	cmp    %rax,%rbx
+  8014a6:	73 14                	jae    8014bc <reserve_meta+0x4a>
+    nmeta++;
+  8014a8:	48 b8 a8 61 87 00 00 	movabs $0x8761a8,%rax
+  8014af:	00 00 00 
+  8014b2:	48 83 00 01          	addq   $0x1,(%rax)
+}
+  8014b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ba:	c9                   	leave
+  8014bb:	c3                   	ret
+    if (journal_pending() + nmeta >= journal_capacity()) bc_checkpoint();
+  8014bc:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  8014c3:	00 00 00 
+  8014c6:	ff d0                	call   *%rax
+  8014c8:	eb de                	jmp    8014a8 <reserve_meta+0x36>
+
+00000000008014ca <bc_set_meta>:
+bc_set_meta(blockno_t blockno, bool meta) {
+  8014ca:	55                   	push   %rbp
+  8014cb:	48 89 e5             	mov    %rsp,%rbp
+  8014ce:	53                   	push   %rbx
+  8014cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d3:	89 fb                	mov    %edi,%ebx
+    if (meta) {
+  8014d5:	40 84 f6             	test   %sil,%sil
+  8014d8:	74 73                	je     80154d <bc_set_meta+0x83>
+        if (journal_active() && TSTBIT(dirty_map, blockno) && !TSTBIT(meta_map, blockno))
+  8014da:	48 b8 b3 4b 80 00 00 	movabs $0x804bb3,%rax
+  8014e1:	00 00 00 
+  8014e4:	ff d0                	call   *%rax
+  8014e6:	84 c0                	test   %al,%al
+  8014e8:	74 32                	je     80151c <bc_set_meta+0x52>
+  8014ea:	89 da                	mov    %ebx,%edx
+  8014ec:	c1 ea 05             	shr    $0x5,%edx
+  8014ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014f4:	89 d9                	mov    %ebx,%ecx
+  8014f6:	d3 e0                	shl    %cl,%eax
+  8014f8:	89 d6                	mov    %edx,%esi
+  8014fa:	48 b9 e0 f1 88 00 00 	movabs $0x88f1e0,%rcx
+  801501:	00 00 00 
+  801504:	89 c7                	mov    %eax,%edi
+  801506:	23 3c b1             	and    (%rcx,%rsi,4),%edi
+  801509:	74 11                	je     80151c <bc_set_meta+0x52>
+  80150b:	89 d2                	mov    %edx,%edx
+  80150d:	48 b9 c0 61 87 00 00 	movabs $0x8761c0,%rcx
+  801514:	00 00 00 
+  801517:	23 04 91             	and    (%rcx,%rdx,4),%eax
+  80151a:	74 23                	je     80153f <bc_set_meta+0x75>
+        SETBIT(meta_map, blockno);
+  80151c:	89 d8                	mov    %ebx,%eax
+  80151e:	c1 e8 05             	shr    $0x5,%eax
+  801521:	48 be c0 61 87 00 00 	movabs $0x8761c0,%rsi
+  801528:	00 00 00 
+  80152b:	89 c0                	mov    %eax,%eax
+  80152d:	ba 01 00 00 00       	mov    $0x1,%edx
+  801532:	89 d9                	mov    %ebx,%ecx
+  801534:	d3 e2                	shl    %cl,%edx
+  801536:	09 14 86             	or     %edx,(%rsi,%rax,4)
+}
+  801539:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153d:	c9                   	leave
+  80153e:	c3                   	ret
+            reserve_meta();
+  80153f:	48 b8 72 14 80 00 00 	movabs $0x801472,%rax
+  801546:	00 00 00 
+  801549:	ff d0                	call   *%rax
+  80154b:	eb cf                	jmp    80151c <bc_set_meta+0x52>
+        CLRBIT(meta_map, blockno);
+  80154d:	89 f8                	mov    %edi,%eax
+  80154f:	c1 e8 05             	shr    $0x5,%eax
+  801552:	48 be c0 61 87 00 00 	movabs $0x8761c0,%rsi
+  801559:	00 00 00 
+  80155c:	89 c0                	mov    %eax,%eax
+  80155e:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+  801563:	89 f9                	mov    %edi,%ecx
+  801565:	d3 c2                	rol    %cl,%edx
+  801567:	21 14 86             	and    %edx,(%rsi,%rax,4)
+        journal_forget(blockno);
+  80156a:	48 b8 01 4c 80 00 00 	movabs $0x804c01,%rax
+  801571:	00 00 00 
+  801574:	ff d0                	call   *%rax
+}
+  801576:	eb c1                	jmp    801539 <bc_set_meta+0x6f>
+
+0000000000801578 <mark_dirty>:
+mark_dirty(blockno_t blockno) {
+  801578:	55                   	push   %rbp
+  801579:	48 89 e5             	mov    %rsp,%rbp
+  80157c:	41 55                	push   %r13
+  80157e:	41 54                	push   %r12
+  801580:	53                   	push   %rbx
+  801581:	48 83 ec 08          	sub    $0x8,%rsp
+    if (TSTBIT(dirty_map, blockno)) return;
+  801585:	41 89 fd             	mov    %edi,%r13d
+  801588:	41 c1 ed 05          	shr    $0x5,%r13d
+  80158c:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  801592:	89 f9                	mov    %edi,%ecx
+  801594:	41 d3 e4             	shl    %cl,%r12d
+  801597:	44 89 ea             	mov    %r13d,%edx
+  80159a:	48 b8 e0 f1 88 00 00 	movabs $0x88f1e0,%rax
+  8015a1:	00 00 00 
+  8015a4:	44 89 e6             	mov    %r12d,%esi
+  8015a7:	23 34 90             	and    (%rax,%rdx,4),%esi
+  8015aa:	74 0b                	je     8015b7 <mark_dirty+0x3f>
+}
+  8015ac:	48 83 c4 08          	add    $0x8,%rsp
+  8015b0:	5b                   	pop    %rbx
+  8015b1:	41 5c                	pop    %r12
+  8015b3:	41 5d                	pop    %r13
+  8015b5:	5d                   	pop    %rbp
+  8015b6:	c3                   	ret
+  8015b7:	89 fb                	mov    %edi,%ebx
+    if (deferred(blockno)) reserve_meta();
+  8015b9:	48 b8 34 05 80 00 00 	movabs $0x800534,%rax
+  8015c0:	00 00 00 
+  8015c3:	ff d0                	call   *%rax
+  8015c5:	84 c0                	test   %al,%al
+  8015c7:	75 57                	jne    801620 <mark_dirty+0xa8>
+    if (ndirty == DIRTY_MAX) dirty_compact();
+  8015c9:	48 b8 c8 e1 88 00 00 	movabs $0x88e1c8,%rax
+  8015d0:	00 00 00 
+  8015d3:	48 81 38 00 04 00 00 	cmpq   $0x400,(%rax)
+  8015da:	74 52                	je     80162e <mark_dirty+0xb6>
+    if (!ndirty) dirty_since = vsys_gettime();
+  8015dc:	48 b8 c8 e1 88 00 00 	movabs $0x88e1c8,%rax
+  8015e3:	00 00 00 
+  8015e6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8015ea:	74 6f                	je     80165b <mark_dirty+0xe3>
+    SETBIT(dirty_map, blockno);
+  8015ec:	48 b8 e0 f1 88 00 00 	movabs $0x88f1e0,%rax
+  8015f3:	00 00 00 
+  8015f6:	45 89 ed             	mov    %r13d,%r13d
+  8015f9:	46 09 24 a8          	or     %r12d,(%rax,%r13,4)
+    dirty_list[ndirty++] = blockno;
+  8015fd:	48 ba c8 e1 88 00 00 	movabs $0x88e1c8,%rdx
+  801604:	00 00 00 
+  801607:	48 8b 02             	mov    (%rdx),%rax
+  80160a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80160e:	48 89 0a             	mov    %rcx,(%rdx)
+  801611:	48 ba e0 e1 88 00 00 	movabs $0x88e1e0,%rdx
+  801618:	00 00 00 
+  80161b:	89 1c 82             	mov    %ebx,(%rdx,%rax,4)
+  80161e:	eb 8c                	jmp    8015ac <mark_dirty+0x34>
+    if (deferred(blockno)) reserve_meta();
+  801620:	48 b8 72 14 80 00 00 	movabs $0x801472,%rax
+  801627:	00 00 00 
+  80162a:	ff d0                	call   *%rax
+  80162c:	eb 9b                	jmp    8015c9 <mark_dirty+0x51>
+    if (ndirty == DIRTY_MAX) dirty_compact();
+  80162e:	48 b8 ae 01 80 00 00 	movabs $0x8001ae,%rax
+  801635:	00 00 00 
+  801638:	ff d0                	call   *%rax
+    if (ndirty == DIRTY_MAX) bc_sync();
+  80163a:	48 b8 c8 e1 88 00 00 	movabs $0x88e1c8,%rax
+  801641:	00 00 00 
+  801644:	48 81 38 00 04 00 00 	cmpq   $0x400,(%rax)
+  80164b:	75 8f                	jne    8015dc <mark_dirty+0x64>
+  80164d:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  801654:	00 00 00 
+  801657:	ff d0                	call   *%rax
+  801659:	eb 81                	jmp    8015dc <mark_dirty+0x64>
+    if (!ndirty) dirty_since = vsys_gettime();
+  80165b:	48 b8 42 d2 80 00 00 	movabs $0x80d242,%rax
+  801662:	00 00 00 
+  801665:	ff d0                	call   *%rax
+  801667:	a3 c0 e1 88 00 00 00 	movabs %eax,0x88e1c0
+  80166e:	00 00 
+  801670:	e9 77 ff ff ff       	jmp    8015ec <mark_dirty+0x74>
+
+0000000000801675 <make_dirty>:
+make_dirty(blockno_t blockno) {
+  801675:	55                   	push   %rbp
+  801676:	48 89 e5             	mov    %rsp,%rbp
+  801679:	41 54                	push   %r12
+  80167b:	53                   	push   %rbx
+  80167c:	41 89 fc             	mov    %edi,%r12d
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  80167f:	89 fb                	mov    %edi,%ebx
+  801681:	48 81 c3 00 00 01 00 	add    $0x10000,%rbx
+  801688:	48 c1 e3 0c          	shl    $0xc,%rbx
+    mark_dirty(blockno);
+  80168c:	48 b8 78 15 80 00 00 	movabs $0x801578,%rax
+  801693:	00 00 00 
+  801696:	ff d0                	call   *%rax
+    mark_used(blockno);
+  801698:	44 89 e7             	mov    %r12d,%edi
+  80169b:	48 b8 28 01 80 00 00 	movabs $0x800128,%rax
+  8016a2:	00 00 00 
+  8016a5:	ff d0                	call   *%rax
+                             PTE_SYSCALL & (get_prot(addr) | PROT_W));
+  8016a7:	48 89 df             	mov    %rbx,%rdi
+  8016aa:	48 b8 c6 d0 80 00 00 	movabs $0x80d0c6,%rax
+  8016b1:	00 00 00 
+  8016b4:	ff d0                	call   *%rax
+  8016b6:	25 05 0e 00 00       	and    $0xe05,%eax
+  8016bb:	41 89 c1             	mov    %eax,%r9d
+    int res = sys_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE,
+  8016be:	41 83 c9 02          	or     $0x2,%r9d
+  8016c2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8016c8:	48 89 d9             	mov    %rbx,%rcx
+  8016cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d0:	48 89 de             	mov    %rbx,%rsi
+  8016d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016d8:	48 b8 74 a2 80 00 00 	movabs $0x80a274,%rax
+  8016df:	00 00 00 
+  8016e2:	ff d0                	call   *%rax
+    if (res)
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	75 05                	jne    8016ed <make_dirty+0x78>
+}
+  8016e8:	5b                   	pop    %rbx
+  8016e9:	41 5c                	pop    %r12
+  8016eb:	5d                   	pop    %rbp
+  8016ec:	c3                   	ret
+        panic("bc: can't make block %08x writable: %i", blockno, res);
+  8016ed:	41 89 c0             	mov    %eax,%r8d
+  8016f0:	44 89 e1             	mov    %r12d,%ecx
+  8016f3:	48 ba b8 e2 80 00 00 	movabs $0x80e2b8,%rdx
+  8016fa:	00 00 00 
+  8016fd:	be 93 01 00 00       	mov    $0x193,%esi
+  801702:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  801709:	00 00 00 
+  80170c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801711:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  801718:	00 00 00 
+  80171b:	41 ff d1             	call   *%r9
+
+000000000080171e <bc_pgfault>:
+bc_pgfault(struct UTrapframe *utf) {
+  80171e:	55                   	push   %rbp
+  80171f:	48 89 e5             	mov    %rsp,%rbp
+  801722:	41 57                	push   %r15
+  801724:	41 56                	push   %r14
+  801726:	41 55                	push   %r13
+  801728:	41 54                	push   %r12
+  80172a:	53                   	push   %rbx
+  80172b:	48 83 ec 18          	sub    $0x18,%rsp
+  80172f:	49 89 ff             	mov    %rdi,%r15
+    void *addr = (void *)utf->utf_fault_va;
+  801732:	48 8b 3f             	mov    (%rdi),%rdi
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  801735:	4c 8d a7 00 00 00 f0 	lea    -0x10000000(%rdi),%r12
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  80173c:	b8 ff ff ff bf       	mov    $0xbfffffff,%eax
+  801741:	4c 39 e0             	cmp    %r12,%rax
+  801744:	0f 82 8e 03 00 00    	jb     801ad8 <bc_pgfault+0x3ba>
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  80174a:	49 c1 ec 0c          	shr    $0xc,%r12
+  80174e:	44 89 65 cc          	mov    %r12d,-0x34(%rbp)
+    if (super && blockno >= super->s_nblocks)
+  801752:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  801759:	00 00 00 
+  80175c:	48 85 c0             	test   %rax,%rax
+  80175f:	74 09                	je     80176a <bc_pgfault+0x4c>
+  801761:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  801765:	45 39 c4             	cmp    %r8d,%r12d
+  801768:	73 2a                	jae    801794 <bc_pgfault+0x76>
+    addr = ROUNDDOWN(addr, BLKSIZE);
+  80176a:	48 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%rdi
+    if (is_page_present(addr)) {
+  801771:	48 b8 25 d1 80 00 00 	movabs $0x80d125,%rax
+  801778:	00 00 00 
+  80177b:	ff d0                	call   *%rax
+  80177d:	89 c3                	mov    %eax,%ebx
+  80177f:	84 c0                	test   %al,%al
+  801781:	74 53                	je     8017d6 <bc_pgfault+0xb8>
+        if (!(utf->utf_err & FEC_W)) return 0;
+  801783:	41 f6 47 08 02       	testb  $0x2,0x8(%r15)
+  801788:	75 38                	jne    8017c2 <bc_pgfault+0xa4>
+  80178a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178f:	e9 49 03 00 00       	jmp    801add <bc_pgfault+0x3bf>
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  801794:	44 89 e1             	mov    %r12d,%ecx
+  801797:	48 ba 30 e2 80 00 00 	movabs $0x80e230,%rdx
+  80179e:	00 00 00 
+  8017a1:	be db 01 00 00       	mov    $0x1db,%esi
+  8017a6:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  8017ad:	00 00 00 
+  8017b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b5:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  8017bc:	00 00 00 
+  8017bf:	41 ff d1             	call   *%r9
+        make_dirty(blockno);
+  8017c2:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8017c5:	48 b8 75 16 80 00 00 	movabs $0x801675,%rax
+  8017cc:	00 00 00 
+  8017cf:	ff d0                	call   *%rax
+        return 1;
+  8017d1:	e9 07 03 00 00       	jmp    801add <bc_pgfault+0x3bf>
+    int slot = read_slot(blockno);
+  8017d6:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8017d9:	48 b8 6f 01 80 00 00 	movabs $0x80016f,%rax
+  8017e0:	00 00 00 
+  8017e3:	ff d0                	call   *%rax
+    if (slot >= 0) {
+  8017e5:	85 c0                	test   %eax,%eax
+  8017e7:	79 33                	jns    80181c <bc_pgfault+0xfe>
+    blockno_t count = super ? ra_window(blockno) : 1;
+  8017e9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  8017ef:	48 b8 68 72 8a 00 00 	movabs $0x8a7268,%rax
+  8017f6:	00 00 00 
+  8017f9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8017fd:	0f 84 1d 01 00 00    	je     801920 <bc_pgfault+0x202>
+    struct Readahead *s = NULL;
+  801803:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    for (struct Readahead *r = streams; r < streams + RA_STREAMS; r++) {
+  801809:	48 b8 c0 e0 82 00 00 	movabs $0x82e0c0,%rax
+  801810:	00 00 00 
+  801813:	48 8d 88 c0 00 00 00 	lea    0xc0(%rax),%rcx
+  80181a:	eb 32                	jmp    80184e <bc_pgfault+0x130>
+        bc_wait(slot);
+  80181c:	89 c7                	mov    %eax,%edi
+  80181e:	48 b8 b3 04 80 00 00 	movabs $0x8004b3,%rax
+  801825:	00 00 00 
+  801828:	ff d0                	call   *%rax
+        return 1;
+  80182a:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80182f:	e9 a9 02 00 00       	jmp    801add <bc_pgfault+0x3bf>
+        if (!s || r->ra_used < s->ra_used) s = r;
+  801834:	4d 85 f6             	test   %r14,%r14
+  801837:	74 6c                	je     8018a5 <bc_pgfault+0x187>
+  801839:	49 8b 76 10          	mov    0x10(%r14),%rsi
+  80183d:	48 39 70 10          	cmp    %rsi,0x10(%rax)
+  801841:	4c 0f 42 f0          	cmovb  %rax,%r14
+    for (struct Readahead *r = streams; r < streams + RA_STREAMS; r++) {
+  801845:	48 83 c0 18          	add    $0x18,%rax
+  801849:	48 39 c8             	cmp    %rcx,%rax
+  80184c:	74 0f                	je     80185d <bc_pgfault+0x13f>
+        if (r->ra_end && r->ra_end == blockno) {
+  80184e:	8b 50 04             	mov    0x4(%rax),%edx
+  801851:	85 d2                	test   %edx,%edx
+  801853:	74 df                	je     801834 <bc_pgfault+0x116>
+  801855:	39 55 cc             	cmp    %edx,-0x34(%rbp)
+  801858:	75 da                	jne    801834 <bc_pgfault+0x116>
+  80185a:	49 89 c6             	mov    %rax,%r14
+    s->ra_used = ++ra_clock;
+  80185d:	48 ba a0 e0 82 00 00 	movabs $0x82e0a0,%rdx
+  801864:	00 00 00 
+  801867:	48 8b 02             	mov    (%rdx),%rax
+  80186a:	48 83 c0 01          	add    $0x1,%rax
+  80186e:	48 89 02             	mov    %rax,(%rdx)
+  801871:	49 89 46 10          	mov    %rax,0x10(%r14)
+    for (blockno_t b = s->ra_start; b < s->ra_end; b++) {
+  801875:	41 8b 0e             	mov    (%r14),%ecx
+  801878:	41 8b 46 04          	mov    0x4(%r14),%eax
+  80187c:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  80187f:	39 c1                	cmp    %eax,%ecx
+  801881:	73 67                	jae    8018ea <bc_pgfault+0x1cc>
+  801883:	48 a1 48 60 81 00 00 	movabs 0x816048,%rax
+  80188a:	00 00 00 
+        if (TSTBIT(ra_map, b)) {
+  80188d:	48 bf a0 60 81 00 00 	movabs $0x8160a0,%rdi
+  801894:	00 00 00 
+  801897:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+            bc_stats.ra_waste++;
+  80189d:	41 b9 01 00 00 00    	mov    $0x1,%r9d
+  8018a3:	eb 0f                	jmp    8018b4 <bc_pgfault+0x196>
+  8018a5:	49 89 c6             	mov    %rax,%r14
+  8018a8:	eb 9b                	jmp    801845 <bc_pgfault+0x127>
+    for (blockno_t b = s->ra_start; b < s->ra_end; b++) {
+  8018aa:	83 c1 01             	add    $0x1,%ecx
+  8018ad:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  8018b0:	39 f1                	cmp    %esi,%ecx
+  8018b2:	74 28                	je     8018dc <bc_pgfault+0x1be>
+        if (TSTBIT(ra_map, b)) {
+  8018b4:	89 ce                	mov    %ecx,%esi
+  8018b6:	c1 ee 05             	shr    $0x5,%esi
+  8018b9:	89 f2                	mov    %esi,%edx
+  8018bb:	44 8b 14 97          	mov    (%rdi,%rdx,4),%r10d
+  8018bf:	44 89 c2             	mov    %r8d,%edx
+  8018c2:	d3 e2                	shl    %cl,%edx
+  8018c4:	41 85 d2             	test   %edx,%r10d
+  8018c7:	74 e1                	je     8018aa <bc_pgfault+0x18c>
+            CLRBIT(ra_map, b);
+  8018c9:	89 f6                	mov    %esi,%esi
+  8018cb:	f7 d2                	not    %edx
+  8018cd:	44 21 d2             	and    %r10d,%edx
+  8018d0:	89 14 b7             	mov    %edx,(%rdi,%rsi,4)
+            bc_stats.ra_waste++;
+  8018d3:	48 83 c0 01          	add    $0x1,%rax
+  8018d7:	44 89 cb             	mov    %r9d,%ebx
+  8018da:	eb ce                	jmp    8018aa <bc_pgfault+0x18c>
+  8018dc:	84 db                	test   %bl,%bl
+  8018de:	74 0a                	je     8018ea <bc_pgfault+0x1cc>
+  8018e0:	48 a3 48 60 81 00 00 	movabs %rax,0x816048
+  8018e7:	00 00 00 
+    s->ra_start = s->ra_end;
+  8018ea:	8b 5d c8             	mov    -0x38(%rbp),%ebx
+  8018ed:	41 89 1e             	mov    %ebx,(%r14)
+    ra_last = s;
+  8018f0:	4c 89 f0             	mov    %r14,%rax
+  8018f3:	48 a3 a8 e0 82 00 00 	movabs %rax,0x82e0a8
+  8018fa:	00 00 00 
+    if (s->ra_end != blockno) {
+  8018fd:	41 39 dc             	cmp    %ebx,%r12d
+  801900:	0f 84 f4 00 00 00    	je     8019fa <bc_pgfault+0x2dc>
+        s->ra_window = 1;
+  801906:	41 c7 46 08 01 00 00 	movl   $0x1,0x8(%r14)
+  80190d:	00 
+        s->ra_start = s->ra_end = blockno + 1;
+  80190e:	41 8d 44 24 01       	lea    0x1(%r12),%eax
+  801913:	41 89 46 04          	mov    %eax,0x4(%r14)
+  801917:	41 89 06             	mov    %eax,(%r14)
+        return 1;
+  80191a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    if (bc_suspend && (slot = read_start(blockno, count)) >= 0)
+  801920:	48 b8 00 60 81 00 00 	movabs $0x816000,%rax
+  801927:	00 00 00 
+  80192a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80192e:	74 24                	je     801954 <bc_pgfault+0x236>
+  801930:	44 89 ee             	mov    %r13d,%esi
+  801933:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801936:	48 b8 82 05 80 00 00 	movabs $0x800582,%rax
+  80193d:	00 00 00 
+  801940:	ff d0                	call   *%rax
+  801942:	85 c0                	test   %eax,%eax
+  801944:	78 0e                	js     801954 <bc_pgfault+0x236>
+        bc_suspend(slot);
+  801946:	89 c7                	mov    %eax,%edi
+  801948:	48 a1 00 60 81 00 00 	movabs 0x816000,%rax
+  80194f:	00 00 00 
+  801952:	ff d0                	call   *%rax
+    blockno_t n = bc_read(blockno, count);
+  801954:	44 89 ee             	mov    %r13d,%esi
+  801957:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80195a:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  801961:	00 00 00 
+  801964:	ff d0                	call   *%rax
+  801966:	89 c2                	mov    %eax,%edx
+    if (n < count) {
+  801968:	44 39 e8             	cmp    %r13d,%eax
+  80196b:	73 16                	jae    801983 <bc_pgfault+0x265>
+        ra_last->ra_start = ra_last->ra_end = blockno + n;
+  80196d:	48 a1 a8 e0 82 00 00 	movabs 0x82e0a8,%rax
+  801974:	00 00 00 
+  801977:	42 8d 0c 22          	lea    (%rdx,%r12,1),%ecx
+  80197b:	89 48 04             	mov    %ecx,0x4(%rax)
+  80197e:	89 08                	mov    %ecx,(%rax)
+        count = n;
+  801980:	41 89 d5             	mov    %edx,%r13d
+    bc_stats.faults++;
+  801983:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  80198a:	00 00 00 
+  80198d:	48 83 00 01          	addq   $0x1,(%rax)
+    if (count > 1) {
+  801991:	41 83 fd 01          	cmp    $0x1,%r13d
+  801995:	76 3f                	jbe    8019d6 <bc_pgfault+0x2b8>
+        bc_stats.ra_io++;
+  801997:	48 83 40 10 01       	addq   $0x1,0x10(%rax)
+        bc_stats.ra_blocks += count - 1;
+  80199c:	41 8d 55 ff          	lea    -0x1(%r13),%edx
+  8019a0:	48 01 50 18          	add    %rdx,0x18(%rax)
+        for (blockno_t b = blockno + 1; b < blockno + count; b++)
+  8019a4:	41 8d 4c 24 01       	lea    0x1(%r12),%ecx
+  8019a9:	45 01 e5             	add    %r12d,%r13d
+  8019ac:	44 39 e9             	cmp    %r13d,%ecx
+  8019af:	73 25                	jae    8019d6 <bc_pgfault+0x2b8>
+            SETBIT(ra_map, b);
+  8019b1:	48 ba a0 60 81 00 00 	movabs $0x8160a0,%rdx
+  8019b8:	00 00 00 
+  8019bb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8019c0:	89 c8                	mov    %ecx,%eax
+  8019c2:	c1 e8 05             	shr    $0x5,%eax
+  8019c5:	89 c0                	mov    %eax,%eax
+  8019c7:	89 fe                	mov    %edi,%esi
+  8019c9:	d3 e6                	shl    %cl,%esi
+  8019cb:	09 34 82             	or     %esi,(%rdx,%rax,4)
+        for (blockno_t b = blockno + 1; b < blockno + count; b++)
+  8019ce:	83 c1 01             	add    $0x1,%ecx
+  8019d1:	41 39 cd             	cmp    %ecx,%r13d
+  8019d4:	75 ea                	jne    8019c0 <bc_pgfault+0x2a2>
+    return 1;
+  8019d6:	bb 01 00 00 00       	mov    $0x1,%ebx
+    if (utf->utf_err & FEC_W) make_dirty(blockno);
+  8019db:	41 f6 47 08 02       	testb  $0x2,0x8(%r15)
+  8019e0:	0f 84 f7 00 00 00    	je     801add <bc_pgfault+0x3bf>
+  8019e6:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8019e9:	48 b8 75 16 80 00 00 	movabs $0x801675,%rax
+  8019f0:	00 00 00 
+  8019f3:	ff d0                	call   *%rax
+  8019f5:	e9 e3 00 00 00       	jmp    801add <bc_pgfault+0x3bf>
+    s->ra_window = MIN(MAX(s->ra_window * 2, RA_MIN_WINDOW), RA_MAX_WINDOW);
+  8019fa:	41 d1 66 08          	shll   0x8(%r14)
+  8019fe:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a02:	ba 04 00 00 00       	mov    $0x4,%edx
+  801a07:	39 d0                	cmp    %edx,%eax
+  801a09:	0f 42 c2             	cmovb  %edx,%eax
+  801a0c:	ba 40 00 00 00       	mov    $0x40,%edx
+  801a11:	39 d0                	cmp    %edx,%eax
+  801a13:	0f 47 c2             	cmova  %edx,%eax
+  801a16:	41 89 46 08          	mov    %eax,0x8(%r14)
+    while (count < s->ra_window) {
+  801a1a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801a1d:	83 c0 01             	add    $0x1,%eax
+  801a20:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    s->ra_window = MIN(MAX(s->ra_window * 2, RA_MIN_WINDOW), RA_MAX_WINDOW);
+  801a23:	89 c3                	mov    %eax,%ebx
+    blockno_t count = 1;
+  801a25:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  801a2b:	eb 11                	jmp    801a3e <bc_pgfault+0x320>
+        count++;
+  801a2d:	41 83 c5 01          	add    $0x1,%r13d
+    while (count < s->ra_window) {
+  801a31:	83 c3 01             	add    $0x1,%ebx
+  801a34:	45 3b 6e 08          	cmp    0x8(%r14),%r13d
+  801a38:	0f 83 85 00 00 00    	jae    801ac3 <bc_pgfault+0x3a5>
+        if (b >= super->s_nblocks) break;
+  801a3e:	48 b8 68 72 8a 00 00 	movabs $0x8a7268,%rax
+  801a45:	00 00 00 
+  801a48:	48 8b 00             	mov    (%rax),%rax
+  801a4b:	3b 58 04             	cmp    0x4(%rax),%ebx
+  801a4e:	73 73                	jae    801ac3 <bc_pgfault+0x3a5>
+        if (is_page_present(diskaddr(b)) || read_slot(b) >= 0) break;
+  801a50:	89 df                	mov    %ebx,%edi
+  801a52:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  801a59:	00 00 00 
+  801a5c:	ff d0                	call   *%rax
+  801a5e:	48 89 c7             	mov    %rax,%rdi
+  801a61:	48 b8 25 d1 80 00 00 	movabs $0x80d125,%rax
+  801a68:	00 00 00 
+  801a6b:	ff d0                	call   *%rax
+  801a6d:	84 c0                	test   %al,%al
+  801a6f:	75 52                	jne    801ac3 <bc_pgfault+0x3a5>
+  801a71:	89 df                	mov    %ebx,%edi
+  801a73:	48 b9 6f 01 80 00 00 	movabs $0x80016f,%rcx
+  801a7a:	00 00 00 
+  801a7d:	ff d1                	call   *%rcx
+  801a7f:	85 c0                	test   %eax,%eax
+  801a81:	79 40                	jns    801ac3 <bc_pgfault+0x3a5>
+        if (bitmap && is_page_present(&bitmap[b / 32]) && block_is_free(b)) break;
+  801a83:	48 a1 60 72 8a 00 00 	movabs 0x8a7260,%rax
+  801a8a:	00 00 00 
+  801a8d:	48 85 c0             	test   %rax,%rax
+  801a90:	74 9b                	je     801a2d <bc_pgfault+0x30f>
+  801a92:	89 da                	mov    %ebx,%edx
+  801a94:	c1 ea 05             	shr    $0x5,%edx
+  801a97:	89 d2                	mov    %edx,%edx
+  801a99:	48 8d 3c 90          	lea    (%rax,%rdx,4),%rdi
+  801a9d:	48 b8 25 d1 80 00 00 	movabs $0x80d125,%rax
+  801aa4:	00 00 00 
+  801aa7:	ff d0                	call   *%rax
+  801aa9:	84 c0                	test   %al,%al
+  801aab:	74 80                	je     801a2d <bc_pgfault+0x30f>
+  801aad:	89 df                	mov    %ebx,%edi
+  801aaf:	48 b8 f9 24 80 00 00 	movabs $0x8024f9,%rax
+  801ab6:	00 00 00 
+  801ab9:	ff d0                	call   *%rax
+  801abb:	84 c0                	test   %al,%al
+  801abd:	0f 84 6a ff ff ff    	je     801a2d <bc_pgfault+0x30f>
+    s->ra_start = blockno + 1;
+  801ac3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ac6:	41 89 06             	mov    %eax,(%r14)
+    s->ra_end = blockno + count;
+  801ac9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801acc:	44 01 e8             	add    %r13d,%eax
+  801acf:	41 89 46 04          	mov    %eax,0x4(%r14)
+    return count;
+  801ad3:	e9 48 fe ff ff       	jmp    801920 <bc_pgfault+0x202>
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  801ad8:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801add:	89 d8                	mov    %ebx,%eax
+  801adf:	48 83 c4 18          	add    $0x18,%rsp
+  801ae3:	5b                   	pop    %rbx
+  801ae4:	41 5c                	pop    %r12
+  801ae6:	41 5d                	pop    %r13
+  801ae8:	41 5e                	pop    %r14
+  801aea:	41 5f                	pop    %r15
+  801aec:	5d                   	pop    %rbp
+  801aed:	c3                   	ret
+
+0000000000801aee <bc_get>:
+bc_get(blockno_t blockno, int flags) {
+  801aee:	55                   	push   %rbp
+  801aef:	48 89 e5             	mov    %rsp,%rbp
+  801af2:	41 55                	push   %r13
+  801af4:	41 54                	push   %r12
+  801af6:	53                   	push   %rbx
+  801af7:	48 83 ec 08          	sub    $0x8,%rsp
+  801afb:	89 fb                	mov    %edi,%ebx
+  801afd:	41 89 f4             	mov    %esi,%r12d
+    void *addr = diskaddr(blockno);
+  801b00:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  801b07:	00 00 00 
+  801b0a:	ff d0                	call   *%rax
+  801b0c:	49 89 c5             	mov    %rax,%r13
+    if (flags & BC_META) bc_set_meta(blockno, 1);
+  801b0f:	41 f6 c4 04          	test   $0x4,%r12b
+  801b13:	0f 85 81 00 00 00    	jne    801b9a <bc_get+0xac>
+    if (flags & BC_NOREAD) flags |= BC_WRITE;
+  801b19:	41 f6 c4 02          	test   $0x2,%r12b
+  801b1d:	0f 84 14 01 00 00    	je     801c37 <bc_get+0x149>
+  801b23:	41 83 cc 01          	or     $0x1,%r12d
+    if (!is_page_present(addr)) {
+  801b27:	4c 89 ef             	mov    %r13,%rdi
+  801b2a:	48 b8 25 d1 80 00 00 	movabs $0x80d125,%rax
+  801b31:	00 00 00 
+  801b34:	ff d0                	call   *%rax
+  801b36:	84 c0                	test   %al,%al
+  801b38:	0f 85 10 01 00 00    	jne    801c4e <bc_get+0x160>
+        if ((flags & BC_NOREAD) && read_slot(blockno) < 0) {
+  801b3e:	89 df                	mov    %ebx,%edi
+  801b40:	48 b8 6f 01 80 00 00 	movabs $0x80016f,%rax
+  801b47:	00 00 00 
+  801b4a:	ff d0                	call   *%rax
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	78 62                	js     801bb2 <bc_get+0xc4>
+        bc_load(blockno, 1);
+  801b50:	be 01 00 00 00       	mov    $0x1,%esi
+  801b55:	89 df                	mov    %ebx,%edi
+  801b57:	48 b8 24 0b 80 00 00 	movabs $0x800b24,%rax
+  801b5e:	00 00 00 
+  801b61:	ff d0                	call   *%rax
+    if ((flags & BC_WRITE) && !TSTBIT(dirty_map, blockno))
+  801b63:	41 f6 c4 01          	test   $0x1,%r12b
+  801b67:	74 23                	je     801b8c <bc_get+0x9e>
+  801b69:	89 da                	mov    %ebx,%edx
+  801b6b:	c1 ea 05             	shr    $0x5,%edx
+  801b6e:	89 d2                	mov    %edx,%edx
+  801b70:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b75:	89 d9                	mov    %ebx,%ecx
+  801b77:	d3 e0                	shl    %cl,%eax
+  801b79:	48 b9 e0 f1 88 00 00 	movabs $0x88f1e0,%rcx
+  801b80:	00 00 00 
+  801b83:	23 04 91             	and    (%rcx,%rdx,4),%eax
+  801b86:	0f 84 98 00 00 00    	je     801c24 <bc_get+0x136>
+}
+  801b8c:	4c 89 e8             	mov    %r13,%rax
+  801b8f:	48 83 c4 08          	add    $0x8,%rsp
+  801b93:	5b                   	pop    %rbx
+  801b94:	41 5c                	pop    %r12
+  801b96:	41 5d                	pop    %r13
+  801b98:	5d                   	pop    %rbp
+  801b99:	c3                   	ret
+    if (flags & BC_META) bc_set_meta(blockno, 1);
+  801b9a:	be 01 00 00 00       	mov    $0x1,%esi
+  801b9f:	89 df                	mov    %ebx,%edi
+  801ba1:	48 b8 ca 14 80 00 00 	movabs $0x8014ca,%rax
+  801ba8:	00 00 00 
+  801bab:	ff d0                	call   *%rax
+  801bad:	e9 67 ff ff ff       	jmp    801b19 <bc_get+0x2b>
+            int res = sys_alloc_region(CURENVID, addr, BLKSIZE, PROT_RW);
+  801bb2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801bb7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bbc:	4c 89 ee             	mov    %r13,%rsi
+  801bbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc4:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  801bcb:	00 00 00 
+  801bce:	ff d0                	call   *%rax
+            if (res)
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	75 23                	jne    801bf7 <bc_get+0x109>
+            note_resident(blockno, 1);
+  801bd4:	be 01 00 00 00       	mov    $0x1,%esi
+  801bd9:	89 df                	mov    %ebx,%edi
+  801bdb:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  801be2:	00 00 00 
+  801be5:	ff d0                	call   *%rax
+            mark_dirty(blockno);
+  801be7:	89 df                	mov    %ebx,%edi
+  801be9:	48 b8 78 15 80 00 00 	movabs $0x801578,%rax
+  801bf0:	00 00 00 
+  801bf3:	ff d0                	call   *%rax
+            return addr;
+  801bf5:	eb 95                	jmp    801b8c <bc_get+0x9e>
+                panic("bc_get: can't alloc memmory! %i", res);
+  801bf7:	89 c1                	mov    %eax,%ecx
+  801bf9:	48 ba e0 e2 80 00 00 	movabs $0x80e2e0,%rdx
+  801c00:	00 00 00 
+  801c03:	be 35 02 00 00       	mov    $0x235,%esi
+  801c08:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  801c0f:	00 00 00 
+  801c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c17:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  801c1e:	00 00 00 
+  801c21:	41 ff d0             	call   *%r8
+        make_dirty(blockno);
+  801c24:	89 df                	mov    %ebx,%edi
+  801c26:	48 b8 75 16 80 00 00 	movabs $0x801675,%rax
+  801c2d:	00 00 00 
+  801c30:	ff d0                	call   *%rax
+  801c32:	e9 55 ff ff ff       	jmp    801b8c <bc_get+0x9e>
+    if (!is_page_present(addr)) {
+  801c37:	4c 89 ef             	mov    %r13,%rdi
+  801c3a:	48 b8 25 d1 80 00 00 	movabs $0x80d125,%rax
+  801c41:	00 00 00 
+  801c44:	ff d0                	call   *%rax
+  801c46:	84 c0                	test   %al,%al
+  801c48:	0f 84 02 ff ff ff    	je     801b50 <bc_get+0x62>
+        bc_touch(blockno, 1);
+  801c4e:	be 01 00 00 00       	mov    $0x1,%esi
+  801c53:	89 df                	mov    %ebx,%edi
+  801c55:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+  801c61:	e9 fd fe ff ff       	jmp    801b63 <bc_get+0x75>
+
+0000000000801c66 <bc_evict>:
+bc_evict(uint64_t low) {
+  801c66:	55                   	push   %rbp
+  801c67:	48 89 e5             	mov    %rsp,%rbp
+  801c6a:	41 57                	push   %r15
+  801c6c:	41 56                	push   %r14
+  801c6e:	41 55                	push   %r13
+  801c70:	41 54                	push   %r12
+  801c72:	53                   	push   %rbx
+  801c73:	48 83 ec 28          	sub    $0x28,%rsp
+  801c77:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+            clock_hand = b + 1 < super->s_nblocks ? b + 1 : 0;
+  801c7b:	bb 02 00 00 00       	mov    $0x2,%ebx
+            blockno_t b = next_resident(clock_hand);
+  801c80:	49 bf 80 e1 82 00 00 	movabs $0x82e180,%r15
+  801c87:	00 00 00 
+    for (int pass = 0; pass < 2 && bc_stats.resident > low; pass++) {
+  801c8a:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  801c91:	00 00 00 
+  801c94:	48 8b 40 70          	mov    0x70(%rax),%rax
+  801c98:	48 39 45 c0          	cmp    %rax,-0x40(%rbp)
+  801c9c:	0f 83 09 02 00 00    	jae    801eab <bc_evict+0x245>
+        uint64_t budget = 2 * bc_stats.resident;
+  801ca2:	48 01 c0             	add    %rax,%rax
+        while (bc_stats.resident > low && budget--) {
+  801ca5:	4c 8d 70 ff          	lea    -0x1(%rax),%r14
+  801ca9:	0f 84 e2 01 00 00    	je     801e91 <bc_evict+0x22b>
+    uint32_t word = resident_map[wi] & (~0U << (blockno % 32));
+  801caf:	49 bc a0 e1 85 00 00 	movabs $0x85e1a0,%r12
+  801cb6:	00 00 00 
+            if (!is_page_present(addr)) {
+  801cb9:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+  801cbc:	eb 34                	jmp    801cf2 <bc_evict+0x8c>
+                drop_resident(b);
+  801cbe:	89 df                	mov    %ebx,%edi
+  801cc0:	48 b8 b5 00 80 00 00 	movabs $0x8000b5,%rax
+  801cc7:	00 00 00 
+  801cca:	ff d0                	call   *%rax
+        while (bc_stats.resident > low && budget--) {
+  801ccc:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  801cd3:	00 00 00 
+  801cd6:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  801cda:	48 3b 58 70          	cmp    0x70(%rax),%rbx
+  801cde:	0f 83 bb 01 00 00    	jae    801e9f <bc_evict+0x239>
+  801ce4:	49 83 ee 01          	sub    $0x1,%r14
+  801ce8:	49 83 fe ff          	cmp    $0xffffffffffffffff,%r14
+  801cec:	0f 84 9c 01 00 00    	je     801e8e <bc_evict+0x228>
+            blockno_t b = next_resident(clock_hand);
+  801cf2:	41 8b 0f             	mov    (%r15),%ecx
+    blockno_t nwords = CEILDIV(super->s_nblocks, 32), wi = blockno / 32;
+  801cf5:	48 b8 68 72 8a 00 00 	movabs $0x8a7268,%rax
+  801cfc:	00 00 00 
+  801cff:	48 8b 00             	mov    (%rax),%rax
+  801d02:	8b 78 04             	mov    0x4(%rax),%edi
+  801d05:	41 89 f8             	mov    %edi,%r8d
+  801d08:	49 83 c0 1f          	add    $0x1f,%r8
+  801d0c:	49 c1 e8 05          	shr    $0x5,%r8
+  801d10:	44 89 c6             	mov    %r8d,%esi
+  801d13:	89 c8                	mov    %ecx,%eax
+  801d15:	c1 e8 05             	shr    $0x5,%eax
+    uint32_t word = resident_map[wi] & (~0U << (blockno % 32));
+  801d18:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801d1d:	d3 e2                	shl    %cl,%edx
+  801d1f:	89 c1                	mov    %eax,%ecx
+    for (blockno_t n = 0; !word && n < nwords; n++) {
+  801d21:	41 23 14 8c          	and    (%r12,%rcx,4),%edx
+  801d25:	75 27                	jne    801d4e <bc_evict+0xe8>
+  801d27:	4d 85 c0             	test   %r8,%r8
+  801d2a:	74 22                	je     801d4e <bc_evict+0xe8>
+  801d2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+        wi = (wi + 1) % nwords;
+  801d31:	83 c0 01             	add    $0x1,%eax
+  801d34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d39:	f7 f6                	div    %esi
+  801d3b:	89 d0                	mov    %edx,%eax
+        word = resident_map[wi];
+  801d3d:	89 d2                	mov    %edx,%edx
+  801d3f:	41 8b 14 94          	mov    (%r12,%rdx,4),%edx
+    for (blockno_t n = 0; !word && n < nwords; n++) {
+  801d43:	83 c1 01             	add    $0x1,%ecx
+  801d46:	85 d2                	test   %edx,%edx
+  801d48:	75 04                	jne    801d4e <bc_evict+0xe8>
+  801d4a:	39 f1                	cmp    %esi,%ecx
+  801d4c:	72 e3                	jb     801d31 <bc_evict+0xcb>
+    return word ? wi * 32 + __builtin_ctz(word) : 0;
+  801d4e:	85 d2                	test   %edx,%edx
+  801d50:	0f 84 55 01 00 00    	je     801eab <bc_evict+0x245>
+  801d56:	f3 0f bc d2          	tzcnt  %edx,%edx
+  801d5a:	c1 e0 05             	shl    $0x5,%eax
+            if (!b) return;
+  801d5d:	01 d0                	add    %edx,%eax
+  801d5f:	89 c3                	mov    %eax,%ebx
+  801d61:	0f 84 44 01 00 00    	je     801eab <bc_evict+0x245>
+            clock_hand = b + 1 < super->s_nblocks ? b + 1 : 0;
+  801d67:	8d 40 01             	lea    0x1(%rax),%eax
+  801d6a:	39 f8                	cmp    %edi,%eax
+  801d6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d71:	0f 43 c2             	cmovae %edx,%eax
+  801d74:	41 89 07             	mov    %eax,(%r15)
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  801d77:	89 d8                	mov    %ebx,%eax
+  801d79:	48 05 00 00 01 00    	add    $0x10000,%rax
+  801d7f:	48 c1 e0 0c          	shl    $0xc,%rax
+  801d83:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+            if (!is_page_present(addr)) {
+  801d87:	48 89 c7             	mov    %rax,%rdi
+  801d8a:	48 b8 25 d1 80 00 00 	movabs $0x80d125,%rax
+  801d91:	00 00 00 
+  801d94:	ff d0                	call   *%rax
+  801d96:	84 c0                	test   %al,%al
+  801d98:	0f 84 20 ff ff ff    	je     801cbe <bc_evict+0x58>
+            if (TSTBIT(pin_map, b)) continue;
+  801d9e:	89 df                	mov    %ebx,%edi
+  801da0:	c1 ef 05             	shr    $0x5,%edi
+  801da3:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801da6:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  801dac:	89 d9                	mov    %ebx,%ecx
+  801dae:	41 d3 e5             	shl    %cl,%r13d
+  801db1:	89 fa                	mov    %edi,%edx
+  801db3:	48 b8 a0 e1 82 00 00 	movabs $0x82e1a0,%rax
+  801dba:	00 00 00 
+  801dbd:	44 89 ee             	mov    %r13d,%esi
+  801dc0:	23 34 90             	and    (%rax,%rdx,4),%esi
+  801dc3:	0f 85 03 ff ff ff    	jne    801ccc <bc_evict+0x66>
+            if (TSTBIT(ref_map, b)) {
+  801dc9:	89 f8                	mov    %edi,%eax
+  801dcb:	48 ba a0 61 84 00 00 	movabs $0x8461a0,%rdx
+  801dd2:	00 00 00 
+  801dd5:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  801dd8:	41 85 c5             	test   %eax,%r13d
+  801ddb:	74 1b                	je     801df8 <bc_evict+0x192>
+                CLRBIT(ref_map, b);
+  801ddd:	89 fa                	mov    %edi,%edx
+  801ddf:	41 f7 d5             	not    %r13d
+  801de2:	41 21 c5             	and    %eax,%r13d
+  801de5:	48 b8 a0 61 84 00 00 	movabs $0x8461a0,%rax
+  801dec:	00 00 00 
+  801def:	44 89 2c 90          	mov    %r13d,(%rax,%rdx,4)
+                continue;
+  801df3:	e9 d4 fe ff ff       	jmp    801ccc <bc_evict+0x66>
+            if (sys_region_refs(addr, BLKSIZE) > 1) continue;
+  801df8:	be 00 10 00 00       	mov    $0x1000,%esi
+  801dfd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801e01:	48 b8 af a1 80 00 00 	movabs $0x80a1af,%rax
+  801e08:	00 00 00 
+  801e0b:	ff d0                	call   *%rax
+  801e0d:	83 f8 01             	cmp    $0x1,%eax
+  801e10:	0f 8f b6 fe ff ff    	jg     801ccc <bc_evict+0x66>
+            if (TSTBIT(dirty_map, b)) {
+  801e16:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801e19:	48 ba e0 f1 88 00 00 	movabs $0x88f1e0,%rdx
+  801e20:	00 00 00 
+  801e23:	44 23 2c 82          	and    (%rdx,%rax,4),%r13d
+  801e27:	74 29                	je     801e52 <bc_evict+0x1ec>
+                if (deferred(b)) continue;
+  801e29:	89 df                	mov    %ebx,%edi
+  801e2b:	48 b8 34 05 80 00 00 	movabs $0x800534,%rax
+  801e32:	00 00 00 
+  801e35:	ff d0                	call   *%rax
+  801e37:	84 c0                	test   %al,%al
+  801e39:	0f 85 8d fe ff ff    	jne    801ccc <bc_evict+0x66>
+                bc_write_blocks(b, 1);
+  801e3f:	be 01 00 00 00       	mov    $0x1,%esi
+  801e44:	89 df                	mov    %ebx,%edi
+  801e46:	48 b8 f6 09 80 00 00 	movabs $0x8009f6,%rax
+  801e4d:	00 00 00 
+  801e50:	ff d0                	call   *%rax
+            sys_unmap_region(CURENVID, addr, BLKSIZE);
+  801e52:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e57:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801e5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e60:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  801e67:	00 00 00 
+  801e6a:	ff d0                	call   *%rax
+            drop_resident(b);
+  801e6c:	89 df                	mov    %ebx,%edi
+  801e6e:	48 b8 b5 00 80 00 00 	movabs $0x8000b5,%rax
+  801e75:	00 00 00 
+  801e78:	ff d0                	call   *%rax
+            bc_stats.evictions++;
+  801e7a:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  801e81:	00 00 00 
+  801e84:	48 83 40 68 01       	addq   $0x1,0x68(%rax)
+  801e89:	e9 3e fe ff ff       	jmp    801ccc <bc_evict+0x66>
+  801e8e:	8b 5d b8             	mov    -0x48(%rbp),%ebx
+        if (bc_stats.resident > low) bc_checkpoint();
+  801e91:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  801e98:	00 00 00 
+  801e9b:	ff d0                	call   *%rax
+  801e9d:	eb 03                	jmp    801ea2 <bc_evict+0x23c>
+  801e9f:	8b 5d b8             	mov    -0x48(%rbp),%ebx
+    for (int pass = 0; pass < 2 && bc_stats.resident > low; pass++) {
+  801ea2:	83 eb 01             	sub    $0x1,%ebx
+  801ea5:	0f 85 df fd ff ff    	jne    801c8a <bc_evict+0x24>
+}
+  801eab:	48 83 c4 28          	add    $0x28,%rsp
+  801eaf:	5b                   	pop    %rbx
+  801eb0:	41 5c                	pop    %r12
+  801eb2:	41 5d                	pop    %r13
+  801eb4:	41 5e                	pop    %r14
+  801eb6:	41 5f                	pop    %r15
+  801eb8:	5d                   	pop    %rbp
+  801eb9:	c3                   	ret
+
+0000000000801eba <bc_writeback>:
+/* Called by the server between requests: write back dirty blocks
+ * if there are too many of them or they are dirty for too long,
+ * write committed metadata home once nothing was committed for a
+ * while, and shrink the cache if it grew past BC_LIMIT */
+void
+bc_writeback(void) {
+  801eba:	55                   	push   %rbp
+  801ebb:	48 89 e5             	mov    %rsp,%rbp
+  801ebe:	53                   	push   %rbx
+  801ebf:	48 83 ec 08          	sub    $0x8,%rsp
+    int now = vsys_gettime();
+  801ec3:	48 b8 42 d2 80 00 00 	movabs $0x80d242,%rax
+  801eca:	00 00 00 
+  801ecd:	ff d0                	call   *%rax
+  801ecf:	89 c3                	mov    %eax,%ebx
+    if (ndirty >= WB_THRESHOLD || (ndirty && now - dirty_since >= WB_INTERVAL))
+  801ed1:	48 a1 c8 e1 88 00 00 	movabs 0x88e1c8,%rax
+  801ed8:	00 00 00 
+  801edb:	48 3d ff 01 00 00    	cmp    $0x1ff,%rax
+  801ee1:	77 16                	ja     801ef9 <bc_writeback+0x3f>
+  801ee3:	48 85 c0             	test   %rax,%rax
+  801ee6:	74 47                	je     801f2f <bc_writeback+0x75>
+  801ee8:	48 b8 c0 e1 88 00 00 	movabs $0x88e1c0,%rax
+  801eef:	00 00 00 
+  801ef2:	2b 18                	sub    (%rax),%ebx
+  801ef4:	83 fb 04             	cmp    $0x4,%ebx
+  801ef7:	7e 0c                	jle    801f05 <bc_writeback+0x4b>
+        bc_sync();
+  801ef9:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  801f00:	00 00 00 
+  801f03:	ff d0                	call   *%rax
+    else if (!ndirty && journal_pending() && now - commit_time >= WB_INTERVAL)
+        bc_checkpoint();
+    if (super && bc_stats.resident > BC_LIMIT) bc_evict(BC_LIMIT_LOW);
+  801f05:	48 b8 68 72 8a 00 00 	movabs $0x8a7268,%rax
+  801f0c:	00 00 00 
+  801f0f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801f13:	74 14                	je     801f29 <bc_writeback+0x6f>
+  801f15:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  801f1c:	00 00 00 
+  801f1f:	48 81 78 70 00 40 00 	cmpq   $0x4000,0x70(%rax)
+  801f26:	00 
+  801f27:	77 36                	ja     801f5f <bc_writeback+0xa5>
+}
+  801f29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f2d:	c9                   	leave
+  801f2e:	c3                   	ret
+    else if (!ndirty && journal_pending() && now - commit_time >= WB_INTERVAL)
+  801f2f:	48 b8 e2 4b 80 00 00 	movabs $0x804be2,%rax
+  801f36:	00 00 00 
+  801f39:	ff d0                	call   *%rax
+  801f3b:	48 85 c0             	test   %rax,%rax
+  801f3e:	74 c5                	je     801f05 <bc_writeback+0x4b>
+  801f40:	48 b8 a0 61 87 00 00 	movabs $0x8761a0,%rax
+  801f47:	00 00 00 
+  801f4a:	2b 18                	sub    (%rax),%ebx
+  801f4c:	83 fb 04             	cmp    $0x4,%ebx
+  801f4f:	7e b4                	jle    801f05 <bc_writeback+0x4b>
+        bc_checkpoint();
+  801f51:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  801f58:	00 00 00 
+  801f5b:	ff d0                	call   *%rax
+  801f5d:	eb a6                	jmp    801f05 <bc_writeback+0x4b>
+    if (super && bc_stats.resident > BC_LIMIT) bc_evict(BC_LIMIT_LOW);
+  801f5f:	bf 00 38 00 00       	mov    $0x3800,%edi
+  801f64:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  801f6b:	00 00 00 
+  801f6e:	ff d0                	call   *%rax
+}
+  801f70:	eb b7                	jmp    801f29 <bc_writeback+0x6f>
+
+0000000000801f72 <bc_init>:
+
+    cprintf("block cache is good\n");
+}
+
+void
+bc_init(void) {
+  801f72:	55                   	push   %rbp
+  801f73:	48 89 e5             	mov    %rsp,%rbp
+  801f76:	53                   	push   %rbx
+  801f77:	48 81 ec 38 02 00 00 	sub    $0x238,%rsp
+    struct Super super;
+    add_pgfault_handler(bc_pgfault);
+  801f7e:	48 bf 1e 17 80 00 00 	movabs $0x80171e,%rdi
+  801f85:	00 00 00 
+  801f88:	48 b8 ad ac 80 00 00 	movabs $0x80acad,%rax
+  801f8f:	00 00 00 
+  801f92:	ff d0                	call   *%rax
+    memmove(&backup, diskaddr(1), sizeof backup);
+  801f94:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f99:	48 bb f3 08 80 00 00 	movabs $0x8008f3,%rbx
+  801fa0:	00 00 00 
+  801fa3:	ff d3                	call   *%rbx
+  801fa5:	48 89 c6             	mov    %rax,%rsi
+  801fa8:	ba 14 01 00 00       	mov    $0x114,%edx
+  801fad:	48 8d bd c8 fd ff ff 	lea    -0x238(%rbp),%rdi
+  801fb4:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  801fbb:	00 00 00 
+  801fbe:	ff d0                	call   *%rax
+    strcpy(diskaddr(1), "OOPS!\n");
+  801fc0:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fc5:	ff d3                	call   *%rbx
+  801fc7:	48 89 c7             	mov    %rax,%rdi
+  801fca:	48 be 72 e0 80 00 00 	movabs $0x80e072,%rsi
+  801fd1:	00 00 00 
+  801fd4:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  801fdb:	00 00 00 
+  801fde:	ff d0                	call   *%rax
+    flush_block(diskaddr(1));
+  801fe0:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fe5:	ff d3                	call   *%rbx
+  801fe7:	48 89 c7             	mov    %rax,%rdi
+  801fea:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  801ff1:	00 00 00 
+  801ff4:	ff d0                	call   *%rax
+    assert(is_page_present(diskaddr(1)));
+  801ff6:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ffb:	ff d3                	call   *%rbx
+  801ffd:	48 89 c7             	mov    %rax,%rdi
+  802000:	48 b8 25 d1 80 00 00 	movabs $0x80d125,%rax
+  802007:	00 00 00 
+  80200a:	ff d0                	call   *%rax
+  80200c:	84 c0                	test   %al,%al
+  80200e:	0f 84 65 01 00 00    	je     802179 <bc_init+0x207>
+    assert(!is_page_dirty(diskaddr(1)));
+  802014:	bf 01 00 00 00       	mov    $0x1,%edi
+  802019:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  802020:	00 00 00 
+  802023:	ff d0                	call   *%rax
+  802025:	48 89 c7             	mov    %rax,%rdi
+  802028:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  80202f:	00 00 00 
+  802032:	ff d0                	call   *%rax
+  802034:	84 c0                	test   %al,%al
+  802036:	0f 85 6d 01 00 00    	jne    8021a9 <bc_init+0x237>
+    sys_unmap_region(0, diskaddr(1), PAGE_SIZE);
+  80203c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802041:	48 bb f3 08 80 00 00 	movabs $0x8008f3,%rbx
+  802048:	00 00 00 
+  80204b:	ff d3                	call   *%rbx
+  80204d:	48 89 c6             	mov    %rax,%rsi
+  802050:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80205a:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+    drop_resident(1);
+  802066:	bf 01 00 00 00       	mov    $0x1,%edi
+  80206b:	48 b8 b5 00 80 00 00 	movabs $0x8000b5,%rax
+  802072:	00 00 00 
+  802075:	ff d0                	call   *%rax
+    assert(!is_page_present(diskaddr(1)));
+  802077:	bf 01 00 00 00       	mov    $0x1,%edi
+  80207c:	ff d3                	call   *%rbx
+  80207e:	48 89 c7             	mov    %rax,%rdi
+  802081:	48 b8 25 d1 80 00 00 	movabs $0x80d125,%rax
+  802088:	00 00 00 
+  80208b:	ff d0                	call   *%rax
+  80208d:	84 c0                	test   %al,%al
+  80208f:	0f 85 49 01 00 00    	jne    8021de <bc_init+0x26c>
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  802095:	bf 01 00 00 00       	mov    $0x1,%edi
+  80209a:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  8020a1:	00 00 00 
+  8020a4:	ff d0                	call   *%rax
+  8020a6:	48 89 c7             	mov    %rax,%rdi
+  8020a9:	48 be 72 e0 80 00 00 	movabs $0x80e072,%rsi
+  8020b0:	00 00 00 
+  8020b3:	48 b8 51 9b 80 00 00 	movabs $0x809b51,%rax
+  8020ba:	00 00 00 
+  8020bd:	ff d0                	call   *%rax
+  8020bf:	85 c0                	test   %eax,%eax
+  8020c1:	0f 85 4c 01 00 00    	jne    802213 <bc_init+0x2a1>
+    memmove(diskaddr(1), &backup, sizeof backup);
+  8020c7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020cc:	48 bb f3 08 80 00 00 	movabs $0x8008f3,%rbx
+  8020d3:	00 00 00 
+  8020d6:	ff d3                	call   *%rbx
+  8020d8:	48 89 c7             	mov    %rax,%rdi
+  8020db:	ba 14 01 00 00       	mov    $0x114,%edx
+  8020e0:	48 8d b5 c8 fd ff ff 	lea    -0x238(%rbp),%rsi
+  8020e7:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  8020ee:	00 00 00 
+  8020f1:	ff d0                	call   *%rax
+    flush_block(diskaddr(1));
+  8020f3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020f8:	ff d3                	call   *%rbx
+  8020fa:	48 89 c7             	mov    %rax,%rdi
+  8020fd:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+    cprintf("block cache is good\n");
+  802109:	48 bf b3 e0 80 00 00 	movabs $0x80e0b3,%rdi
+  802110:	00 00 00 
+  802113:	b8 00 00 00 00       	mov    $0x0,%eax
+  802118:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  80211f:	00 00 00 
+  802122:	ff d2                	call   *%rdx
+    check_bc();
+
+    /* Clean cached blocks can be read again from disk */
+    if (sys_set_cache_region(CURENVID, (void *)DISKMAP, DISKSIZE))
+  802124:	ba 00 00 00 c0       	mov    $0xc0000000,%edx
+  802129:	be 00 00 00 10       	mov    $0x10000000,%esi
+  80212e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802133:	48 b8 85 a3 80 00 00 	movabs $0x80a385,%rax
+  80213a:	00 00 00 
+  80213d:	ff d0                	call   *%rax
+  80213f:	85 c0                	test   %eax,%eax
+  802141:	0f 85 01 01 00 00    	jne    802248 <bc_init+0x2d6>
+        panic("bc_init: can't declare block cache region");
+
+    /* Cache the super block by reading it once */
+    memmove(&super, diskaddr(1), sizeof super);
+  802147:	bf 01 00 00 00       	mov    $0x1,%edi
+  80214c:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  802153:	00 00 00 
+  802156:	ff d0                	call   *%rax
+  802158:	48 89 c6             	mov    %rax,%rsi
+  80215b:	ba 14 01 00 00       	mov    $0x114,%edx
+  802160:	48 8d bd dc fe ff ff 	lea    -0x124(%rbp),%rdi
+  802167:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  80216e:	00 00 00 
+  802171:	ff d0                	call   *%rax
+}
+  802173:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802177:	c9                   	leave
+  802178:	c3                   	ret
+    assert(is_page_present(diskaddr(1)));
+  802179:	48 b9 96 e0 80 00 00 	movabs $0x80e096,%rcx
+  802180:	00 00 00 
+  802183:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  80218a:	00 00 00 
+  80218d:	be 36 03 00 00       	mov    $0x336,%esi
+  802192:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  802199:	00 00 00 
+  80219c:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8021a3:	00 00 00 
+  8021a6:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(diskaddr(1)));
+  8021a9:	48 b9 79 e0 80 00 00 	movabs $0x80e079,%rcx
+  8021b0:	00 00 00 
+  8021b3:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  8021ba:	00 00 00 
+  8021bd:	be 37 03 00 00       	mov    $0x337,%esi
+  8021c2:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  8021c9:	00 00 00 
+  8021cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d1:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8021d8:	00 00 00 
+  8021db:	41 ff d0             	call   *%r8
+    assert(!is_page_present(diskaddr(1)));
+  8021de:	48 b9 95 e0 80 00 00 	movabs $0x80e095,%rcx
+  8021e5:	00 00 00 
+  8021e8:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  8021ef:	00 00 00 
+  8021f2:	be 3c 03 00 00       	mov    $0x33c,%esi
+  8021f7:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  8021fe:	00 00 00 
+  802201:	b8 00 00 00 00       	mov    $0x0,%eax
+  802206:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  80220d:	00 00 00 
+  802210:	41 ff d0             	call   *%r8
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  802213:	48 b9 00 e3 80 00 00 	movabs $0x80e300,%rcx
+  80221a:	00 00 00 
+  80221d:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  802224:	00 00 00 
+  802227:	be 3f 03 00 00       	mov    $0x33f,%esi
+  80222c:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  802233:	00 00 00 
+  802236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223b:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  802242:	00 00 00 
+  802245:	41 ff d0             	call   *%r8
+        panic("bc_init: can't declare block cache region");
+  802248:	48 ba 28 e3 80 00 00 	movabs $0x80e328,%rdx
+  80224f:	00 00 00 
+  802252:	be 50 03 00 00       	mov    $0x350,%esi
+  802257:	48 bf 1e e0 80 00 00 	movabs $0x80e01e,%rdi
+  80225e:	00 00 00 
+  802261:	b8 00 00 00 00       	mov    $0x0,%eax
+  802266:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  80226d:	00 00 00 
+  802270:	ff d1                	call   *%rcx
+
+0000000000802272 <bitmap_word>:
+
+/* Free bits of wi'th 64-bit bitmap word,
+ * bits for blocks past the end of disk are masked out */
+static uint64_t
+bitmap_word(blockno_t wi) {
+    uint64_t word = ((uint64_t *)bitmap)[wi];
+  802272:	89 fa                	mov    %edi,%edx
+  802274:	48 a1 60 72 8a 00 00 	movabs 0x8a7260,%rax
+  80227b:	00 00 00 
+  80227e:	48 8b 14 d0          	mov    (%rax,%rdx,8),%rdx
+    if ((wi + 1) * 64 > super->s_nblocks)
+  802282:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  802289:	00 00 00 
+  80228c:	8b 48 04             	mov    0x4(%rax),%ecx
+  80228f:	83 c7 01             	add    $0x1,%edi
+  802292:	c1 e7 06             	shl    $0x6,%edi
+  802295:	39 f9                	cmp    %edi,%ecx
+  802297:	73 10                	jae    8022a9 <bitmap_word+0x37>
+        word &= (1ULL << (super->s_nblocks % 64)) - 1;
+  802299:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8022a0:	48 d3 e0             	shl    %cl,%rax
+  8022a3:	48 f7 d0             	not    %rax
+  8022a6:	48 21 c2             	and    %rax,%rdx
+    return word;
+}
+  8022a9:	48 89 d0             	mov    %rdx,%rax
+  8022ac:	c3                   	ret
+
+00000000008022ad <dcache_entry>:
+
+/* Hash of file name used by directory index (FNV-1a) */
+static inline uint32_t
+dirindex_hash(const char *name) {
+    uint32_t hash = 2166136261U;
+    while (*name) hash = (hash ^ (uint8_t)*name++) * 16777619U;
+  8022ad:	0f b6 06             	movzbl (%rsi),%eax
+  8022b0:	84 c0                	test   %al,%al
+  8022b2:	74 3e                	je     8022f2 <dcache_entry+0x45>
+    uint32_t hash = 2166136261U;
+  8022b4:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+    while (*name) hash = (hash ^ (uint8_t)*name++) * 16777619U;
+  8022b9:	48 83 c6 01          	add    $0x1,%rsi
+  8022bd:	0f b6 c0             	movzbl %al,%eax
+  8022c0:	31 c2                	xor    %eax,%edx
+  8022c2:	69 d2 93 01 00 01    	imul   $0x1000193,%edx,%edx
+  8022c8:	0f b6 06             	movzbl (%rsi),%eax
+  8022cb:	84 c0                	test   %al,%al
+  8022cd:	75 ea                	jne    8022b9 <dcache_entry+0xc>
+    return 0;
+}
+
+static struct Dentry *
+dcache_entry(struct File *dir, const char *name) {
+    return &dcache[(dirindex_hash(name) ^ (uintptr_t)dir / sizeof(struct File)) % DCACHE_SIZE];
+  8022cf:	48 89 f8             	mov    %rdi,%rax
+  8022d2:	48 c1 e8 08          	shr    $0x8,%rax
+  8022d6:	48 31 d0             	xor    %rdx,%rax
+  8022d9:	83 e0 7f             	and    $0x7f,%eax
+  8022dc:	48 8d 04 c0          	lea    (%rax,%rax,8),%rax
+  8022e0:	48 c1 e0 04          	shl    $0x4,%rax
+  8022e4:	48 ba 80 72 8a 00 00 	movabs $0x8a7280,%rdx
+  8022eb:	00 00 00 
+  8022ee:	48 01 d0             	add    %rdx,%rax
+}
+  8022f1:	c3                   	ret
+    uint32_t hash = 2166136261U;
+  8022f2:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+  8022f7:	eb d6                	jmp    8022cf <dcache_entry+0x22>
+
+00000000008022f9 <file_extent>:
+file_extent(struct File *f, uint32_t i) {
+  8022f9:	55                   	push   %rbp
+  8022fa:	48 89 e5             	mov    %rsp,%rbp
+  8022fd:	53                   	push   %rbx
+  8022fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802302:	89 f3                	mov    %esi,%ebx
+    if (i < NINLINEEXT) return &f->f_extents[i];
+  802304:	83 fe 02             	cmp    $0x2,%esi
+  802307:	77 14                	ja     80231d <file_extent+0x24>
+  802309:	89 f3                	mov    %esi,%ebx
+  80230b:	48 8d 04 5b          	lea    (%rbx,%rbx,2),%rax
+  80230f:	48 8d 84 87 88 00 00 	lea    0x88(%rdi,%rax,4),%rax
+  802316:	00 
+}
+  802317:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80231b:	c9                   	leave
+  80231c:	c3                   	ret
+    return (struct Extent *)bc_get(f->f_extblock, BC_META) + (i - NINLINEEXT);
+  80231d:	8b bf b0 00 00 00    	mov    0xb0(%rdi),%edi
+  802323:	be 04 00 00 00       	mov    $0x4,%esi
+  802328:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  80232f:	00 00 00 
+  802332:	ff d0                	call   *%rax
+  802334:	48 89 c2             	mov    %rax,%rdx
+  802337:	8d 43 fd             	lea    -0x3(%rbx),%eax
+  80233a:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+  80233e:	48 8d 04 82          	lea    (%rdx,%rax,4),%rax
+  802342:	eb d3                	jmp    802317 <file_extent+0x1e>
+
+0000000000802344 <file_extent_find>:
+file_extent_find(struct File *f, blockno_t filebno) {
+  802344:	55                   	push   %rbp
+  802345:	48 89 e5             	mov    %rsp,%rbp
+  802348:	41 57                	push   %r15
+  80234a:	41 56                	push   %r14
+  80234c:	41 55                	push   %r13
+  80234e:	41 54                	push   %r12
+  802350:	53                   	push   %rbx
+  802351:	48 83 ec 18          	sub    $0x18,%rsp
+  802355:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    uint32_t lo = 0, hi = f->f_nextents;
+  802359:	44 8b a7 ac 00 00 00 	mov    0xac(%rdi),%r12d
+    while (lo < hi) {
+  802360:	45 85 e4             	test   %r12d,%r12d
+  802363:	74 3d                	je     8023a2 <file_extent_find+0x5e>
+  802365:	41 89 f6             	mov    %esi,%r14d
+    uint32_t lo = 0, hi = f->f_nextents;
+  802368:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        struct Extent *ext = file_extent(f, mid);
+  80236e:	49 bf f9 22 80 00 00 	movabs $0x8022f9,%r15
+  802375:	00 00 00 
+  802378:	eb 08                	jmp    802382 <file_extent_find+0x3e>
+            hi = mid;
+  80237a:	41 89 dc             	mov    %ebx,%r12d
+    while (lo < hi) {
+  80237d:	45 39 e5             	cmp    %r12d,%r13d
+  802380:	73 23                	jae    8023a5 <file_extent_find+0x61>
+        uint32_t mid = (lo + hi) / 2;
+  802382:	43 8d 5c 25 00       	lea    0x0(%r13,%r12,1),%ebx
+  802387:	d1 eb                	shr    %ebx
+        struct Extent *ext = file_extent(f, mid);
+  802389:	89 de                	mov    %ebx,%esi
+  80238b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80238f:	41 ff d7             	call   *%r15
+        if (ext->e_fileblock + ext->e_len <= filebno)
+  802392:	8b 10                	mov    (%rax),%edx
+  802394:	03 50 08             	add    0x8(%rax),%edx
+  802397:	41 39 d6             	cmp    %edx,%r14d
+  80239a:	72 de                	jb     80237a <file_extent_find+0x36>
+            lo = mid + 1;
+  80239c:	44 8d 6b 01          	lea    0x1(%rbx),%r13d
+  8023a0:	eb db                	jmp    80237d <file_extent_find+0x39>
+    uint32_t lo = 0, hi = f->f_nextents;
+  8023a2:	45 89 e5             	mov    %r12d,%r13d
+}
+  8023a5:	44 89 e8             	mov    %r13d,%eax
+  8023a8:	48 83 c4 18          	add    $0x18,%rsp
+  8023ac:	5b                   	pop    %rbx
+  8023ad:	41 5c                	pop    %r12
+  8023af:	41 5d                	pop    %r13
+  8023b1:	41 5e                	pop    %r14
+  8023b3:	41 5f                	pop    %r15
+  8023b5:	5d                   	pop    %rbp
+  8023b6:	c3                   	ret
+
+00000000008023b7 <dir_bucket>:
+dir_bucket(struct File *dir, const char *name) {
+  8023b7:	55                   	push   %rbp
+  8023b8:	48 89 e5             	mov    %rsp,%rbp
+  8023bb:	53                   	push   %rbx
+  8023bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8023c0:	48 89 f3             	mov    %rsi,%rbx
+    return (uint32_t *)bc_get(dir->f_dirindex, BC_META) + dirindex_hash(name) % DIRINDEX_BUCKETS;
+  8023c3:	8b bf f8 00 00 00    	mov    0xf8(%rdi),%edi
+  8023c9:	be 04 00 00 00       	mov    $0x4,%esi
+  8023ce:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  8023d5:	00 00 00 
+  8023d8:	ff d0                	call   *%rax
+    while (*name) hash = (hash ^ (uint8_t)*name++) * 16777619U;
+  8023da:	0f b6 13             	movzbl (%rbx),%edx
+  8023dd:	84 d2                	test   %dl,%dl
+  8023df:	74 2b                	je     80240c <dir_bucket+0x55>
+    uint32_t hash = 2166136261U;
+  8023e1:	b9 c5 9d 1c 81       	mov    $0x811c9dc5,%ecx
+    while (*name) hash = (hash ^ (uint8_t)*name++) * 16777619U;
+  8023e6:	48 83 c3 01          	add    $0x1,%rbx
+  8023ea:	0f b6 d2             	movzbl %dl,%edx
+  8023ed:	31 d1                	xor    %edx,%ecx
+  8023ef:	69 c9 93 01 00 01    	imul   $0x1000193,%ecx,%ecx
+  8023f5:	0f b6 13             	movzbl (%rbx),%edx
+  8023f8:	84 d2                	test   %dl,%dl
+  8023fa:	75 ea                	jne    8023e6 <dir_bucket+0x2f>
+  8023fc:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  802402:	48 8d 04 88          	lea    (%rax,%rcx,4),%rax
+}
+  802406:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80240a:	c9                   	leave
+  80240b:	c3                   	ret
+    uint32_t hash = 2166136261U;
+  80240c:	b9 c5 9d 1c 81       	mov    $0x811c9dc5,%ecx
+  802411:	eb e9                	jmp    8023fc <dir_bucket+0x45>
+
+0000000000802413 <dcache_invalidate>:
+
+/* Forget cached lookup of name in dir */
+static void
+dcache_invalidate(struct File *dir, const char *name) {
+  802413:	55                   	push   %rbp
+  802414:	48 89 e5             	mov    %rsp,%rbp
+  802417:	41 55                	push   %r13
+  802419:	41 54                	push   %r12
+  80241b:	53                   	push   %rbx
+  80241c:	48 83 ec 08          	sub    $0x8,%rsp
+  802420:	48 89 fb             	mov    %rdi,%rbx
+  802423:	49 89 f5             	mov    %rsi,%r13
+    struct Dentry *d = dcache_entry(dir, name);
+  802426:	48 b8 ad 22 80 00 00 	movabs $0x8022ad,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+    if (d->d_dir == dir && !strcmp(d->d_name, name)) d->d_dir = NULL;
+  802432:	48 39 18             	cmp    %rbx,(%rax)
+  802435:	74 0b                	je     802442 <dcache_invalidate+0x2f>
+}
+  802437:	48 83 c4 08          	add    $0x8,%rsp
+  80243b:	5b                   	pop    %rbx
+  80243c:	41 5c                	pop    %r12
+  80243e:	41 5d                	pop    %r13
+  802440:	5d                   	pop    %rbp
+  802441:	c3                   	ret
+  802442:	49 89 c4             	mov    %rax,%r12
+    if (d->d_dir == dir && !strcmp(d->d_name, name)) d->d_dir = NULL;
+  802445:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802449:	4c 89 ee             	mov    %r13,%rsi
+  80244c:	48 b8 51 9b 80 00 00 	movabs $0x809b51,%rax
+  802453:	00 00 00 
+  802456:	ff d0                	call   *%rax
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	75 db                	jne    802437 <dcache_invalidate+0x24>
+  80245c:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  802463:	00 
+}
+  802464:	eb d1                	jmp    802437 <dcache_invalidate+0x24>
+
+0000000000802466 <check_super>:
+check_super(void) {
+  802466:	55                   	push   %rbp
+  802467:	48 89 e5             	mov    %rsp,%rbp
+    if (super->s_magic != FS_MAGIC)
+  80246a:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  802471:	00 00 00 
+  802474:	8b 08                	mov    (%rax),%ecx
+  802476:	81 f9 ae 30 05 4a    	cmp    $0x4a0530ae,%ecx
+  80247c:	75 26                	jne    8024a4 <check_super+0x3e>
+    if (super->s_nblocks > DISKSIZE / BLKSIZE)
+  80247e:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%rax)
+  802485:	77 48                	ja     8024cf <check_super+0x69>
+    cprintf("superblock is good\n");
+  802487:	48 bf 9b e3 80 00 00 	movabs $0x80e39b,%rdi
+  80248e:	00 00 00 
+  802491:	b8 00 00 00 00       	mov    $0x0,%eax
+  802496:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  80249d:	00 00 00 
+  8024a0:	ff d2                	call   *%rdx
+}
+  8024a2:	5d                   	pop    %rbp
+  8024a3:	c3                   	ret
+        panic("bad file system magic number %08x", super->s_magic);
+  8024a4:	48 ba 58 e3 80 00 00 	movabs $0x80e358,%rdx
+  8024ab:	00 00 00 
+  8024ae:	be 28 00 00 00       	mov    $0x28,%esi
+  8024b3:	48 bf 7a e3 80 00 00 	movabs $0x80e37a,%rdi
+  8024ba:	00 00 00 
+  8024bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c2:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8024c9:	00 00 00 
+  8024cc:	41 ff d0             	call   *%r8
+        panic("file system is too large");
+  8024cf:	48 ba 82 e3 80 00 00 	movabs $0x80e382,%rdx
+  8024d6:	00 00 00 
+  8024d9:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8024de:	48 bf 7a e3 80 00 00 	movabs $0x80e37a,%rdi
+  8024e5:	00 00 00 
+  8024e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ed:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  8024f4:	00 00 00 
+  8024f7:	ff d1                	call   *%rcx
+
+00000000008024f9 <block_is_free>:
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  8024f9:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  802500:	00 00 00 
+  802503:	48 85 c0             	test   %rax,%rax
+  802506:	74 2d                	je     802535 <block_is_free+0x3c>
+  802508:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250d:	3b 78 04             	cmp    0x4(%rax),%edi
+  802510:	73 20                	jae    802532 <block_is_free+0x39>
+    if (TSTBIT(bitmap, blockno)) return 1;
+  802512:	89 fe                	mov    %edi,%esi
+  802514:	c1 ee 05             	shr    $0x5,%esi
+  802517:	89 f6                	mov    %esi,%esi
+  802519:	ba 01 00 00 00       	mov    $0x1,%edx
+  80251e:	89 f9                	mov    %edi,%ecx
+  802520:	d3 e2                	shl    %cl,%edx
+  802522:	48 a1 60 72 8a 00 00 	movabs 0x8a7260,%rax
+  802529:	00 00 00 
+  80252c:	23 14 b0             	and    (%rax,%rsi,4),%edx
+  80252f:	0f 95 c2             	setne  %dl
+}
+  802532:	89 d0                	mov    %edx,%eax
+  802534:	c3                   	ret
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  802535:	ba 00 00 00 00       	mov    $0x0,%edx
+  80253a:	eb f6                	jmp    802532 <block_is_free+0x39>
+
+000000000080253c <free_block>:
+free_block(blockno_t blockno) {
+  80253c:	55                   	push   %rbp
+  80253d:	48 89 e5             	mov    %rsp,%rbp
+  802540:	53                   	push   %rbx
+  802541:	48 83 ec 08          	sub    $0x8,%rsp
+    if (blockno == 0) panic("attempt to free zero block");
+  802545:	85 ff                	test   %edi,%edi
+  802547:	0f 84 8c 00 00 00    	je     8025d9 <free_block+0x9d>
+  80254d:	89 fb                	mov    %edi,%ebx
+    if (!TSTBIT(bitmap, blockno)) group_free[blockno / BLKGROUPSIZE]++;
+  80254f:	89 fa                	mov    %edi,%edx
+  802551:	c1 ea 05             	shr    $0x5,%edx
+  802554:	89 d2                	mov    %edx,%edx
+  802556:	48 a1 60 72 8a 00 00 	movabs 0x8a7260,%rax
+  80255d:	00 00 00 
+  802560:	48 8d 34 90          	lea    (%rax,%rdx,4),%rsi
+  802564:	8b 06                	mov    (%rsi),%eax
+  802566:	ba 01 00 00 00       	mov    $0x1,%edx
+  80256b:	89 f9                	mov    %edi,%ecx
+  80256d:	d3 e2                	shl    %cl,%edx
+  80256f:	85 d0                	test   %edx,%eax
+  802571:	75 16                	jne    802589 <free_block+0x4d>
+  802573:	89 f9                	mov    %edi,%ecx
+  802575:	c1 e9 0c             	shr    $0xc,%ecx
+  802578:	48 bf 40 bf 8a 00 00 	movabs $0x8abf40,%rdi
+  80257f:	00 00 00 
+  802582:	89 c9                	mov    %ecx,%ecx
+  802584:	66 83 04 4f 01       	addw   $0x1,(%rdi,%rcx,2)
+    SETBIT(bitmap, blockno);
+  802589:	09 d0                	or     %edx,%eax
+  80258b:	89 06                	mov    %eax,(%rsi)
+    SETBIT(group_stale, blockno / BLKGROUPSIZE);
+  80258d:	89 d8                	mov    %ebx,%eax
+  80258f:	c1 e8 11             	shr    $0x11,%eax
+  802592:	48 be 90 ba 8a 00 00 	movabs $0x8aba90,%rsi
+  802599:	00 00 00 
+  80259c:	89 c0                	mov    %eax,%eax
+  80259e:	89 d9                	mov    %ebx,%ecx
+  8025a0:	c1 e9 0c             	shr    $0xc,%ecx
+  8025a3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8025a8:	d3 e2                	shl    %cl,%edx
+  8025aa:	09 14 86             	or     %edx,(%rsi,%rax,4)
+    bc_set_meta(blockno, 0);
+  8025ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b2:	89 df                	mov    %ebx,%edi
+  8025b4:	48 b8 ca 14 80 00 00 	movabs $0x8014ca,%rax
+  8025bb:	00 00 00 
+  8025be:	ff d0                	call   *%rax
+    bc_cold(blockno, 1);
+  8025c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8025c5:	89 df                	mov    %ebx,%edi
+  8025c7:	48 b8 aa 0d 80 00 00 	movabs $0x800daa,%rax
+  8025ce:	00 00 00 
+  8025d1:	ff d0                	call   *%rax
+}
+  8025d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025d7:	c9                   	leave
+  8025d8:	c3                   	ret
+    if (blockno == 0) panic("attempt to free zero block");
+  8025d9:	48 ba af e3 80 00 00 	movabs $0x80e3af,%rdx
+  8025e0:	00 00 00 
+  8025e3:	be 41 00 00 00       	mov    $0x41,%esi
+  8025e8:	48 bf 7a e3 80 00 00 	movabs $0x80e37a,%rdi
+  8025ef:	00 00 00 
+  8025f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f7:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  8025fe:	00 00 00 
+  802601:	ff d1                	call   *%rcx
+
+0000000000802603 <file_extent_remove>:
+file_extent_remove(struct File *f, uint32_t i) {
+  802603:	55                   	push   %rbp
+  802604:	48 89 e5             	mov    %rsp,%rbp
+  802607:	41 56                	push   %r14
+  802609:	41 55                	push   %r13
+  80260b:	41 54                	push   %r12
+  80260d:	53                   	push   %rbx
+  80260e:	49 89 fd             	mov    %rdi,%r13
+    for (; i + 1 < f->f_nextents; i++)
+  802611:	8d 5e 01             	lea    0x1(%rsi),%ebx
+  802614:	8b b7 ac 00 00 00    	mov    0xac(%rdi),%esi
+  80261a:	39 f3                	cmp    %esi,%ebx
+  80261c:	73 3b                	jae    802659 <file_extent_remove+0x56>
+        *file_extent(f, i) = *file_extent(f, i + 1);
+  80261e:	49 be f9 22 80 00 00 	movabs $0x8022f9,%r14
+  802625:	00 00 00 
+  802628:	89 de                	mov    %ebx,%esi
+  80262a:	4c 89 ef             	mov    %r13,%rdi
+  80262d:	41 ff d6             	call   *%r14
+  802630:	49 89 c4             	mov    %rax,%r12
+  802633:	8d 73 ff             	lea    -0x1(%rbx),%esi
+  802636:	4c 89 ef             	mov    %r13,%rdi
+  802639:	41 ff d6             	call   *%r14
+  80263c:	49 8b 14 24          	mov    (%r12),%rdx
+  802640:	48 89 10             	mov    %rdx,(%rax)
+  802643:	41 8b 54 24 08       	mov    0x8(%r12),%edx
+  802648:	89 50 08             	mov    %edx,0x8(%rax)
+    for (; i + 1 < f->f_nextents; i++)
+  80264b:	41 8b b5 ac 00 00 00 	mov    0xac(%r13),%esi
+  802652:	83 c3 01             	add    $0x1,%ebx
+  802655:	39 f3                	cmp    %esi,%ebx
+  802657:	72 cf                	jb     802628 <file_extent_remove+0x25>
+    memset(file_extent(f, --f->f_nextents), 0, sizeof(struct Extent));
+  802659:	83 ee 01             	sub    $0x1,%esi
+  80265c:	41 89 b5 ac 00 00 00 	mov    %esi,0xac(%r13)
+  802663:	4c 89 ef             	mov    %r13,%rdi
+  802666:	48 b8 f9 22 80 00 00 	movabs $0x8022f9,%rax
+  80266d:	00 00 00 
+  802670:	ff d0                	call   *%rax
+  802672:	48 89 c7             	mov    %rax,%rdi
+  802675:	ba 0c 00 00 00       	mov    $0xc,%edx
+  80267a:	be 00 00 00 00       	mov    $0x0,%esi
+  80267f:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  802686:	00 00 00 
+  802689:	ff d0                	call   *%rax
+    if (f->f_nextents <= NINLINEEXT && f->f_extblock) {
+  80268b:	41 83 bd ac 00 00 00 	cmpl   $0x3,0xac(%r13)
+  802692:	03 
+  802693:	77 0b                	ja     8026a0 <file_extent_remove+0x9d>
+  802695:	41 8b bd b0 00 00 00 	mov    0xb0(%r13),%edi
+  80269c:	85 ff                	test   %edi,%edi
+  80269e:	75 09                	jne    8026a9 <file_extent_remove+0xa6>
+}
+  8026a0:	5b                   	pop    %rbx
+  8026a1:	41 5c                	pop    %r12
+  8026a3:	41 5d                	pop    %r13
+  8026a5:	41 5e                	pop    %r14
+  8026a7:	5d                   	pop    %rbp
+  8026a8:	c3                   	ret
+        free_block(f->f_extblock);
+  8026a9:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  8026b0:	00 00 00 
+  8026b3:	ff d0                	call   *%rax
+        f->f_extblock = 0;
+  8026b5:	41 c7 85 b0 00 00 00 	movl   $0x0,0xb0(%r13)
+  8026bc:	00 00 00 00 
+}
+  8026c0:	eb de                	jmp    8026a0 <file_extent_remove+0x9d>
+
+00000000008026c2 <alloc_extent>:
+alloc_extent(blockno_t goal, blockno_t count, blockno_t *len) {
+  8026c2:	55                   	push   %rbp
+  8026c3:	48 89 e5             	mov    %rsp,%rbp
+  8026c6:	41 57                	push   %r15
+  8026c8:	41 56                	push   %r14
+  8026ca:	41 55                	push   %r13
+  8026cc:	41 54                	push   %r12
+  8026ce:	53                   	push   %rbx
+  8026cf:	48 83 ec 68          	sub    $0x68,%rsp
+  8026d3:	89 f9                	mov    %edi,%ecx
+  8026d5:	89 f7                	mov    %esi,%edi
+  8026d7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    blockno_t nblocks = super->s_nblocks, start = 0;
+  8026db:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  8026e2:	00 00 00 
+  8026e5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8026e9:	8b 40 04             	mov    0x4(%rax),%eax
+  8026ec:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+    if (goal >= nblocks) goal = alloc_cursor;
+  8026ef:	39 c1                	cmp    %eax,%ecx
+  8026f1:	72 2c                	jb     80271f <alloc_extent+0x5d>
+  8026f3:	48 be 80 ba 8a 00 00 	movabs $0x8aba80,%rsi
+  8026fa:	00 00 00 
+  8026fd:	8b 0e                	mov    (%rsi),%ecx
+    if (goal >= nblocks) goal = 0;
+  8026ff:	39 c1                	cmp    %eax,%ecx
+  802701:	72 1c                	jb     80271f <alloc_extent+0x5d>
+    if (TSTBIT(bitmap, goal))
+  802703:	48 b8 60 72 8a 00 00 	movabs $0x8a7260,%rax
+  80270a:	00 00 00 
+  80270d:	4c 8b 00             	mov    (%rax),%r8
+  802710:	41 8b 08             	mov    (%r8),%ecx
+  802713:	83 e1 01             	and    $0x1,%ecx
+  802716:	74 2c                	je     802744 <alloc_extent+0x82>
+    if (goal >= nblocks) goal = 0;
+  802718:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80271d:	eb 2a                	jmp    802749 <alloc_extent+0x87>
+    if (TSTBIT(bitmap, goal))
+  80271f:	48 b8 60 72 8a 00 00 	movabs $0x8a7260,%rax
+  802726:	00 00 00 
+  802729:	4c 8b 00             	mov    (%rax),%r8
+  80272c:	89 ca                	mov    %ecx,%edx
+  80272e:	c1 ea 05             	shr    $0x5,%edx
+  802731:	89 d2                	mov    %edx,%edx
+  802733:	b8 01 00 00 00       	mov    $0x1,%eax
+  802738:	d3 e0                	shl    %cl,%eax
+  80273a:	41 23 04 90          	and    (%r8,%rdx,4),%eax
+  80273e:	0f 85 86 02 00 00    	jne    8029ca <alloc_extent+0x308>
+    else if (count > 1)
+  802744:	83 ff 01             	cmp    $0x1,%edi
+  802747:	77 49                	ja     802792 <alloc_extent+0xd0>
+    blockno_t nwords = CEILDIV(super->s_nblocks, 64);
+  802749:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80274d:	44 8b 68 04          	mov    0x4(%rax),%r13d
+  802751:	49 83 c5 3f          	add    $0x3f,%r13
+  802755:	49 c1 ed 06          	shr    $0x6,%r13
+    blockno_t wi = goal / 64;
+  802759:	89 cb                	mov    %ecx,%ebx
+  80275b:	c1 eb 06             	shr    $0x6,%ebx
+        if (!n) word &= ~0ULL << (goal % 64);
+  80275e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  802765:	48 d3 e0             	shl    %cl,%rax
+  802768:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (blockno_t n = 0; n <= nwords; n++, wi = (wi + 1) % nwords) {
+  80276c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        uint64_t word = bitmap_word(wi);
+  802772:	49 be 72 22 80 00 00 	movabs $0x802272,%r14
+  802779:	00 00 00 
+        if (!(wi % (BLKGROUPSIZE / 64)) && !group_free[wi * 64 / BLKGROUPSIZE]) {
+  80277c:	49 bf 40 bf 8a 00 00 	movabs $0x8abf40,%r15
+  802783:	00 00 00 
+  802786:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80278a:	89 7d b8             	mov    %edi,-0x48(%rbp)
+  80278d:	e9 7a 02 00 00       	jmp    802a0c <alloc_extent+0x34a>
+    blockno_t ngroups = CEILDIV(super->s_nblocks, BLKGROUPSIZE);
+  802792:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  802795:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  80279b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80279f:	41 89 c1             	mov    %eax,%r9d
+    blockno_t group = goal / BLKGROUPSIZE, best = 0, best_run = 0;
+  8027a2:	89 ca                	mov    %ecx,%edx
+  8027a4:	c1 ea 0c             	shr    $0xc,%edx
+    count = MIN(count, BLKGROUPSIZE);
+  8027a7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027ac:	39 f7                	cmp    %esi,%edi
+  8027ae:	0f 46 f7             	cmovbe %edi,%esi
+  8027b1:	89 f3                	mov    %esi,%ebx
+    for (blockno_t n = 0; n < ngroups; n++, group = (group + 1) % ngroups) {
+  8027b3:	85 c0                	test   %eax,%eax
+  8027b5:	74 92                	je     802749 <alloc_extent+0x87>
+    blockno_t group = goal / BLKGROUPSIZE, best = 0, best_run = 0;
+  8027b7:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+    for (blockno_t n = 0; n < ngroups; n++, group = (group + 1) % ngroups) {
+  8027be:	be 00 00 00 00       	mov    $0x0,%esi
+    blockno_t group = goal / BLKGROUPSIZE, best = 0, best_run = 0;
+  8027c3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+        uint64_t word = bitmap_word(wi);
+  8027c9:	4c 89 45 80          	mov    %r8,-0x80(%rbp)
+  8027cd:	89 4d 88             	mov    %ecx,-0x78(%rbp)
+  8027d0:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8027d6:	89 df                	mov    %ebx,%edi
+  8027d8:	e9 8d 01 00 00       	jmp    80296a <alloc_extent+0x2a8>
+    blockno_t end = MIN((group + 1) * BLKGROUPSIZE, super->s_nblocks);
+  8027dd:	44 8d 6a 01          	lea    0x1(%rdx),%r13d
+  8027e1:	41 c1 e5 0c          	shl    $0xc,%r13d
+  8027e5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8027e9:	8b 49 04             	mov    0x4(%rcx),%ecx
+  8027ec:	41 39 cd             	cmp    %ecx,%r13d
+  8027ef:	41 0f 46 cd          	cmovbe %r13d,%ecx
+    for (blockno_t wi = group * BLKGROUPSIZE / 64; wi * 64 < end; wi++) {
+  8027f3:	41 81 ed 00 10 00 00 	sub    $0x1000,%r13d
+  8027fa:	45 89 ef             	mov    %r13d,%r15d
+  8027fd:	41 c1 ef 06          	shr    $0x6,%r15d
+  802801:	41 39 cd             	cmp    %ecx,%r13d
+  802804:	0f 83 fa 00 00 00    	jae    802904 <alloc_extent+0x242>
+    blockno_t run = 0, best = 0, best_end = 0;
+  80280a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802810:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802816:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80281b:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+  80281f:	89 7d a4             	mov    %edi,-0x5c(%rbp)
+  802822:	89 45 a0             	mov    %eax,-0x60(%rbp)
+  802825:	44 89 45 9c          	mov    %r8d,-0x64(%rbp)
+  802829:	44 89 5d 98          	mov    %r11d,-0x68(%rbp)
+  80282d:	89 75 94             	mov    %esi,-0x6c(%rbp)
+  802830:	89 55 90             	mov    %edx,-0x70(%rbp)
+  802833:	44 89 55 8c          	mov    %r10d,-0x74(%rbp)
+  802837:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  80283a:	eb 45                	jmp    802881 <alloc_extent+0x1bf>
+            for (int bit = 0; bit < 64; bit++) {
+  80283c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802841:	eb 12                	jmp    802855 <alloc_extent+0x193>
+                    run++;
+  802843:	83 c3 01             	add    $0x1,%ebx
+                    continue;
+  802846:	eb 05                	jmp    80284d <alloc_extent+0x18b>
+                run = 0;
+  802848:	bb 00 00 00 00       	mov    $0x0,%ebx
+            for (int bit = 0; bit < 64; bit++) {
+  80284d:	83 c2 01             	add    $0x1,%edx
+  802850:	83 fa 40             	cmp    $0x40,%edx
+  802853:	74 44                	je     802899 <alloc_extent+0x1d7>
+                if (word >> bit & 1) {
+  802855:	48 0f a3 d0          	bt     %rdx,%rax
+  802859:	72 e8                	jb     802843 <alloc_extent+0x181>
+                if (run > best) best = run, best_end = wi * 64 + bit;
+  80285b:	41 39 dc             	cmp    %ebx,%r12d
+  80285e:	73 e8                	jae    802848 <alloc_extent+0x186>
+  802860:	46 8d 34 2a          	lea    (%rdx,%r13,1),%r14d
+  802864:	41 89 dc             	mov    %ebx,%r12d
+                run = 0;
+  802867:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80286c:	eb df                	jmp    80284d <alloc_extent+0x18b>
+    for (blockno_t wi = group * BLKGROUPSIZE / 64; wi * 64 < end; wi++) {
+  80286e:	41 83 c7 01          	add    $0x1,%r15d
+  802872:	45 89 fd             	mov    %r15d,%r13d
+  802875:	41 c1 e5 06          	shl    $0x6,%r13d
+  802879:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80287c:	41 39 c5             	cmp    %eax,%r13d
+  80287f:	73 2a                	jae    8028ab <alloc_extent+0x1e9>
+        uint64_t word = bitmap_word(wi);
+  802881:	44 89 ff             	mov    %r15d,%edi
+  802884:	48 b8 72 22 80 00 00 	movabs $0x802272,%rax
+  80288b:	00 00 00 
+  80288e:	ff d0                	call   *%rax
+        if (word == ~0ULL) {
+  802890:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  802894:	75 a6                	jne    80283c <alloc_extent+0x17a>
+            run += 64;
+  802896:	83 c3 40             	add    $0x40,%ebx
+        if (run > best) best = run, best_end = (wi + 1) * 64;
+  802899:	41 39 dc             	cmp    %ebx,%r12d
+  80289c:	73 d0                	jae    80286e <alloc_extent+0x1ac>
+  80289e:	45 8d 77 01          	lea    0x1(%r15),%r14d
+  8028a2:	41 c1 e6 06          	shl    $0x6,%r14d
+  8028a6:	41 89 dc             	mov    %ebx,%r12d
+  8028a9:	eb c3                	jmp    80286e <alloc_extent+0x1ac>
+  8028ab:	44 8b 4d b0          	mov    -0x50(%rbp),%r9d
+  8028af:	8b 7d a4             	mov    -0x5c(%rbp),%edi
+  8028b2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8028b5:	44 8b 45 9c          	mov    -0x64(%rbp),%r8d
+  8028b9:	44 8b 5d 98          	mov    -0x68(%rbp),%r11d
+  8028bd:	8b 75 94             	mov    -0x6c(%rbp),%esi
+  8028c0:	8b 55 90             	mov    -0x70(%rbp),%edx
+  8028c3:	44 8b 55 8c          	mov    -0x74(%rbp),%r10d
+    group_run[group] = best;
+  8028c7:	89 d1                	mov    %edx,%ecx
+  8028c9:	48 bb c0 bd 8a 00 00 	movabs $0x8abdc0,%rbx
+  8028d0:	00 00 00 
+  8028d3:	66 44 89 24 4b       	mov    %r12w,(%rbx,%rcx,2)
+    group_run_start[group] = best_end - best;
+  8028d8:	45 29 e6             	sub    %r12d,%r14d
+  8028db:	48 bb c0 ba 8a 00 00 	movabs $0x8abac0,%rbx
+  8028e2:	00 00 00 
+  8028e5:	44 89 34 8b          	mov    %r14d,(%rbx,%rcx,4)
+    CLRBIT(group_stale, group);
+  8028e9:	89 c0                	mov    %eax,%eax
+  8028eb:	41 f7 d3             	not    %r11d
+  8028ee:	45 21 c3             	and    %r8d,%r11d
+  8028f1:	48 b9 90 ba 8a 00 00 	movabs $0x8aba90,%rcx
+  8028f8:	00 00 00 
+  8028fb:	44 89 1c 81          	mov    %r11d,(%rcx,%rax,4)
+}
+  8028ff:	e9 a4 00 00 00       	jmp    8029a8 <alloc_extent+0x2e6>
+    blockno_t run = 0, best = 0, best_end = 0;
+  802904:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80290a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802910:	eb b5                	jmp    8028c7 <alloc_extent+0x205>
+        if (group_run[group] >= count) return group_run_start[group];
+  802912:	4c 8b 45 80          	mov    -0x80(%rbp),%r8
+  802916:	8b 4d 88             	mov    -0x78(%rbp),%ecx
+  802919:	8b bd 7c ff ff ff    	mov    -0x84(%rbp),%edi
+  80291f:	89 d2                	mov    %edx,%edx
+  802921:	48 b8 c0 ba 8a 00 00 	movabs $0x8abac0,%rax
+  802928:	00 00 00 
+  80292b:	8b 04 90             	mov    (%rax,%rdx,4),%eax
+  80292e:	89 45 c8             	mov    %eax,-0x38(%rbp)
+    if (!start && !(start = find_free_block(goal)))
+  802931:	85 c0                	test   %eax,%eax
+  802933:	0f 85 25 01 00 00    	jne    802a5e <alloc_extent+0x39c>
+  802939:	e9 0b fe ff ff       	jmp    802749 <alloc_extent+0x87>
+            best = group_run_start[group];
+  80293e:	89 d1                	mov    %edx,%ecx
+  802940:	48 bb c0 ba 8a 00 00 	movabs $0x8abac0,%rbx
+  802947:	00 00 00 
+  80294a:	8b 0c 8b             	mov    (%rbx,%rcx,4),%ecx
+  80294d:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+            best_run = group_run[group];
+  802950:	41 89 c2             	mov    %eax,%r10d
+    for (blockno_t n = 0; n < ngroups; n++, group = (group + 1) % ngroups) {
+  802953:	83 c6 01             	add    $0x1,%esi
+  802956:	8d 42 01             	lea    0x1(%rdx),%eax
+  802959:	ba 00 00 00 00       	mov    $0x0,%edx
+  80295e:	41 f7 f1             	div    %r9d
+  802961:	41 39 f1             	cmp    %esi,%r9d
+  802964:	0f 84 d9 01 00 00    	je     802b43 <alloc_extent+0x481>
+        if (group_free[group] <= best_run) continue;
+  80296a:	89 d0                	mov    %edx,%eax
+  80296c:	48 b9 40 bf 8a 00 00 	movabs $0x8abf40,%rcx
+  802973:	00 00 00 
+  802976:	0f b7 04 41          	movzwl (%rcx,%rax,2),%eax
+  80297a:	41 39 c2             	cmp    %eax,%r10d
+  80297d:	73 d4                	jae    802953 <alloc_extent+0x291>
+        if (TSTBIT(group_stale, group)) group_scan(group);
+  80297f:	89 d0                	mov    %edx,%eax
+  802981:	c1 e8 05             	shr    $0x5,%eax
+  802984:	89 c1                	mov    %eax,%ecx
+  802986:	48 bb 90 ba 8a 00 00 	movabs $0x8aba90,%rbx
+  80298d:	00 00 00 
+  802990:	44 8b 04 8b          	mov    (%rbx,%rcx,4),%r8d
+  802994:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  80299a:	89 d1                	mov    %edx,%ecx
+  80299c:	41 d3 e3             	shl    %cl,%r11d
+  80299f:	45 85 d8             	test   %r11d,%r8d
+  8029a2:	0f 85 35 fe ff ff    	jne    8027dd <alloc_extent+0x11b>
+        if (group_run[group] >= count) return group_run_start[group];
+  8029a8:	89 d0                	mov    %edx,%eax
+  8029aa:	48 b9 c0 bd 8a 00 00 	movabs $0x8abdc0,%rcx
+  8029b1:	00 00 00 
+  8029b4:	0f b7 04 41          	movzwl (%rcx,%rax,2),%eax
+  8029b8:	39 f8                	cmp    %edi,%eax
+  8029ba:	0f 83 52 ff ff ff    	jae    802912 <alloc_extent+0x250>
+        if (group_run[group] > best_run) {
+  8029c0:	41 39 c2             	cmp    %eax,%r10d
+  8029c3:	73 8e                	jae    802953 <alloc_extent+0x291>
+  8029c5:	e9 74 ff ff ff       	jmp    80293e <alloc_extent+0x27c>
+    if (!start && !(start = find_free_block(goal)))
+  8029ca:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  8029cd:	85 c9                	test   %ecx,%ecx
+  8029cf:	0f 85 81 00 00 00    	jne    802a56 <alloc_extent+0x394>
+  8029d5:	e9 6f fd ff ff       	jmp    802749 <alloc_extent+0x87>
+        uint64_t word = bitmap_word(wi);
+  8029da:	89 df                	mov    %ebx,%edi
+  8029dc:	41 ff d6             	call   *%r14
+        if (!n) word &= ~0ULL << (goal % 64);
+  8029df:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8029e3:	48 21 c2             	and    %rax,%rdx
+  8029e6:	45 85 e4             	test   %r12d,%r12d
+  8029e9:	48 0f 44 c2          	cmove  %rdx,%rax
+        if (word) return wi * 64 + __builtin_ctzll(word);
+  8029ed:	48 85 c0             	test   %rax,%rax
+  8029f0:	75 4a                	jne    802a3c <alloc_extent+0x37a>
+    for (blockno_t n = 0; n <= nwords; n++, wi = (wi + 1) % nwords) {
+  8029f2:	41 83 c4 01          	add    $0x1,%r12d
+  8029f6:	8d 43 01             	lea    0x1(%rbx),%eax
+  8029f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029fe:	41 f7 f5             	div    %r13d
+  802a01:	89 d3                	mov    %edx,%ebx
+  802a03:	45 39 e5             	cmp    %r12d,%r13d
+  802a06:	0f 82 23 01 00 00    	jb     802b2f <alloc_extent+0x46d>
+        if (!(wi % (BLKGROUPSIZE / 64)) && !group_free[wi * 64 / BLKGROUPSIZE]) {
+  802a0c:	f6 c3 3f             	test   $0x3f,%bl
+  802a0f:	75 c9                	jne    8029da <alloc_extent+0x318>
+  802a11:	89 d8                	mov    %ebx,%eax
+  802a13:	c1 e0 06             	shl    $0x6,%eax
+  802a16:	c1 e8 0c             	shr    $0xc,%eax
+  802a19:	89 c0                	mov    %eax,%eax
+  802a1b:	66 41 83 3c 47 00    	cmpw   $0x0,(%r15,%rax,2)
+  802a21:	75 b7                	jne    8029da <alloc_extent+0x318>
+            blockno_t skip = MIN(BLKGROUPSIZE / 64, nwords - wi) - 1;
+  802a23:	44 89 e8             	mov    %r13d,%eax
+  802a26:	29 d8                	sub    %ebx,%eax
+  802a28:	ba 40 00 00 00       	mov    $0x40,%edx
+  802a2d:	39 d0                	cmp    %edx,%eax
+  802a2f:	0f 47 c2             	cmova  %edx,%eax
+  802a32:	83 e8 01             	sub    $0x1,%eax
+            n += skip;
+  802a35:	41 01 c4             	add    %eax,%r12d
+            wi += skip;
+  802a38:	01 c3                	add    %eax,%ebx
+            continue;
+  802a3a:	eb b6                	jmp    8029f2 <alloc_extent+0x330>
+        if (word) return wi * 64 + __builtin_ctzll(word);
+  802a3c:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  802a40:	8b 7d b8             	mov    -0x48(%rbp),%edi
+  802a43:	f3 48 0f bc c0       	tzcnt  %rax,%rax
+  802a48:	c1 e3 06             	shl    $0x6,%ebx
+    if (!start && !(start = find_free_block(goal)))
+  802a4b:	01 d8                	add    %ebx,%eax
+  802a4d:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  802a50:	0f 84 c7 00 00 00    	je     802b1d <alloc_extent+0x45b>
+    for (; n < count && start + n < nblocks && TSTBIT(bitmap, start + n); n++) {
+  802a56:	85 ff                	test   %edi,%edi
+  802a58:	0f 84 da 00 00 00    	je     802b38 <alloc_extent+0x476>
+  802a5e:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  802a61:	44 8b 7d b4          	mov    -0x4c(%rbp),%r15d
+  802a65:	44 39 fa             	cmp    %r15d,%edx
+  802a68:	0f 83 ce 00 00 00    	jae    802b3c <alloc_extent+0x47a>
+  802a6e:	89 d0                	mov    %edx,%eax
+  802a70:	c1 e8 05             	shr    $0x5,%eax
+  802a73:	89 c0                	mov    %eax,%eax
+  802a75:	4d 8d 0c 80          	lea    (%r8,%rax,4),%r9
+  802a79:	45 8b 29             	mov    (%r9),%r13d
+  802a7c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a81:	89 d1                	mov    %edx,%ecx
+  802a83:	d3 e0                	shl    %cl,%eax
+  802a85:	44 89 ee             	mov    %r13d,%esi
+  802a88:	21 c6                	and    %eax,%esi
+  802a8a:	74 7d                	je     802b09 <alloc_extent+0x447>
+    blockno_t n = 0;
+  802a8c:	be 00 00 00 00       	mov    $0x0,%esi
+        group_free[(start + n) / BLKGROUPSIZE]--;
+  802a91:	49 bb 40 bf 8a 00 00 	movabs $0x8abf40,%r11
+  802a98:	00 00 00 
+        SETBIT(group_stale, (start + n) / BLKGROUPSIZE);
+  802a9b:	49 ba 90 ba 8a 00 00 	movabs $0x8aba90,%r10
+  802aa2:	00 00 00 
+  802aa5:	bb 01 00 00 00       	mov    $0x1,%ebx
+    for (; n < count && start + n < nblocks && TSTBIT(bitmap, start + n); n++) {
+  802aaa:	49 bc 60 72 8a 00 00 	movabs $0x8a7260,%r12
+  802ab1:	00 00 00 
+  802ab4:	45 89 f8             	mov    %r15d,%r8d
+        CLRBIT(bitmap, start + n);
+  802ab7:	f7 d0                	not    %eax
+  802ab9:	44 21 e8             	and    %r13d,%eax
+  802abc:	41 89 01             	mov    %eax,(%r9)
+        group_free[(start + n) / BLKGROUPSIZE]--;
+  802abf:	89 d1                	mov    %edx,%ecx
+  802ac1:	c1 e9 0c             	shr    $0xc,%ecx
+  802ac4:	89 c8                	mov    %ecx,%eax
+  802ac6:	66 41 83 2c 43 01    	subw   $0x1,(%r11,%rax,2)
+        SETBIT(group_stale, (start + n) / BLKGROUPSIZE);
+  802acc:	89 d0                	mov    %edx,%eax
+  802ace:	c1 e8 11             	shr    $0x11,%eax
+  802ad1:	89 c0                	mov    %eax,%eax
+  802ad3:	41 89 df             	mov    %ebx,%r15d
+  802ad6:	41 d3 e7             	shl    %cl,%r15d
+  802ad9:	45 09 3c 82          	or     %r15d,(%r10,%rax,4)
+    for (; n < count && start + n < nblocks && TSTBIT(bitmap, start + n); n++) {
+  802add:	83 c6 01             	add    $0x1,%esi
+  802ae0:	39 fe                	cmp    %edi,%esi
+  802ae2:	73 25                	jae    802b09 <alloc_extent+0x447>
+  802ae4:	83 c2 01             	add    $0x1,%edx
+  802ae7:	44 39 c2             	cmp    %r8d,%edx
+  802aea:	73 1d                	jae    802b09 <alloc_extent+0x447>
+  802aec:	89 d0                	mov    %edx,%eax
+  802aee:	c1 e8 05             	shr    $0x5,%eax
+  802af1:	89 c0                	mov    %eax,%eax
+  802af3:	49 8b 0c 24          	mov    (%r12),%rcx
+  802af7:	4c 8d 0c 81          	lea    (%rcx,%rax,4),%r9
+  802afb:	45 8b 29             	mov    (%r9),%r13d
+  802afe:	89 d8                	mov    %ebx,%eax
+  802b00:	89 d1                	mov    %edx,%ecx
+  802b02:	d3 e0                	shl    %cl,%eax
+  802b04:	41 85 c5             	test   %eax,%r13d
+  802b07:	75 ae                	jne    802ab7 <alloc_extent+0x3f5>
+    alloc_cursor = start + n;
+  802b09:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802b0c:	01 f0                	add    %esi,%eax
+  802b0e:	a3 80 ba 8a 00 00 00 	movabs %eax,0x8aba80
+  802b15:	00 00 
+    *len = n;
+  802b17:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802b1b:	89 30                	mov    %esi,(%rax)
+}
+  802b1d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802b20:	48 83 c4 68          	add    $0x68,%rsp
+  802b24:	5b                   	pop    %rbx
+  802b25:	41 5c                	pop    %r12
+  802b27:	41 5d                	pop    %r13
+  802b29:	41 5e                	pop    %r14
+  802b2b:	41 5f                	pop    %r15
+  802b2d:	5d                   	pop    %rbp
+  802b2e:	c3                   	ret
+        return 0;
+  802b2f:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+  802b36:	eb e5                	jmp    802b1d <alloc_extent+0x45b>
+    blockno_t n = 0;
+  802b38:	89 fe                	mov    %edi,%esi
+  802b3a:	eb cd                	jmp    802b09 <alloc_extent+0x447>
+  802b3c:	be 00 00 00 00       	mov    $0x0,%esi
+  802b41:	eb c6                	jmp    802b09 <alloc_extent+0x447>
+  802b43:	4c 8b 45 80          	mov    -0x80(%rbp),%r8
+  802b47:	8b 4d 88             	mov    -0x78(%rbp),%ecx
+  802b4a:	8b bd 7c ff ff ff    	mov    -0x84(%rbp),%edi
+    if (!start && !(start = find_free_block(goal)))
+  802b50:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  802b54:	0f 85 04 ff ff ff    	jne    802a5e <alloc_extent+0x39c>
+  802b5a:	e9 ea fb ff ff       	jmp    802749 <alloc_extent+0x87>
+
+0000000000802b5f <alloc_block_near>:
+alloc_block_near(blockno_t goal) {
+  802b5f:	55                   	push   %rbp
+  802b60:	48 89 e5             	mov    %rsp,%rbp
+  802b63:	48 83 ec 10          	sub    $0x10,%rsp
+    return alloc_extent(goal, 1, &len);
+  802b67:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+  802b6b:	be 01 00 00 00       	mov    $0x1,%esi
+  802b70:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  802b77:	00 00 00 
+  802b7a:	ff d0                	call   *%rax
+}
+  802b7c:	c9                   	leave
+  802b7d:	c3                   	ret
+
+0000000000802b7e <alloc_block>:
+alloc_block(void) {
+  802b7e:	55                   	push   %rbp
+  802b7f:	48 89 e5             	mov    %rsp,%rbp
+    return alloc_block_near(alloc_cursor);
+  802b82:	48 b8 80 ba 8a 00 00 	movabs $0x8aba80,%rax
+  802b89:	00 00 00 
+  802b8c:	8b 38                	mov    (%rax),%edi
+  802b8e:	48 b8 5f 2b 80 00 00 	movabs $0x802b5f,%rax
+  802b95:	00 00 00 
+  802b98:	ff d0                	call   *%rax
+}
+  802b9a:	5d                   	pop    %rbp
+  802b9b:	c3                   	ret
+
+0000000000802b9c <flush_bitmap>:
+flush_bitmap(void) {
+  802b9c:	55                   	push   %rbp
+  802b9d:	48 89 e5             	mov    %rsp,%rbp
+    flush_blocks(2, CEILDIV(super->s_nblocks, BLKBITSIZE));
+  802ba0:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  802ba7:	00 00 00 
+  802baa:	8b 70 04             	mov    0x4(%rax),%esi
+  802bad:	48 81 c6 ff 7f 00 00 	add    $0x7fff,%rsi
+  802bb4:	48 c1 ee 0f          	shr    $0xf,%rsi
+  802bb8:	bf 02 00 00 00       	mov    $0x2,%edi
+  802bbd:	48 b8 d3 0f 80 00 00 	movabs $0x800fd3,%rax
+  802bc4:	00 00 00 
+  802bc7:	ff d0                	call   *%rax
+}
+  802bc9:	5d                   	pop    %rbp
+  802bca:	c3                   	ret
+
+0000000000802bcb <check_bitmap>:
+check_bitmap(void) {
+  802bcb:	55                   	push   %rbp
+  802bcc:	48 89 e5             	mov    %rsp,%rbp
+  802bcf:	41 55                	push   %r13
+  802bd1:	41 54                	push   %r12
+  802bd3:	53                   	push   %rbx
+  802bd4:	48 83 ec 08          	sub    $0x8,%rsp
+    for (blockno_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  802bd8:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  802bdf:	00 00 00 
+  802be2:	8b 40 04             	mov    0x4(%rax),%eax
+  802be5:	85 c0                	test   %eax,%eax
+  802be7:	74 2a                	je     802c13 <check_bitmap+0x48>
+  802be9:	41 89 c4             	mov    %eax,%r12d
+  802bec:	bb 00 00 00 00       	mov    $0x0,%ebx
+        assert(!block_is_free(2 + i));
+  802bf1:	49 bd f9 24 80 00 00 	movabs $0x8024f9,%r13
+  802bf8:	00 00 00 
+  802bfb:	8d 7b 02             	lea    0x2(%rbx),%edi
+  802bfe:	41 ff d5             	call   *%r13
+  802c01:	84 c0                	test   %al,%al
+  802c03:	75 62                	jne    802c67 <check_bitmap+0x9c>
+    for (blockno_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  802c05:	83 c3 01             	add    $0x1,%ebx
+  802c08:	89 d8                	mov    %ebx,%eax
+  802c0a:	48 c1 e0 0f          	shl    $0xf,%rax
+  802c0e:	4c 39 e0             	cmp    %r12,%rax
+  802c11:	7c e8                	jl     802bfb <check_bitmap+0x30>
+    assert(!block_is_free(1));
+  802c13:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c18:	48 b8 f9 24 80 00 00 	movabs $0x8024f9,%rax
+  802c1f:	00 00 00 
+  802c22:	ff d0                	call   *%rax
+  802c24:	84 c0                	test   %al,%al
+  802c26:	75 74                	jne    802c9c <check_bitmap+0xd1>
+    assert(!block_is_free(0));
+  802c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c2d:	48 b8 f9 24 80 00 00 	movabs $0x8024f9,%rax
+  802c34:	00 00 00 
+  802c37:	ff d0                	call   *%rax
+  802c39:	84 c0                	test   %al,%al
+  802c3b:	0f 85 90 00 00 00    	jne    802cd1 <check_bitmap+0x106>
+    cprintf("bitmap is good\n");
+  802c41:	48 bf 04 e4 80 00 00 	movabs $0x80e404,%rdi
+  802c48:	00 00 00 
+  802c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c50:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  802c57:	00 00 00 
+  802c5a:	ff d2                	call   *%rdx
+}
+  802c5c:	48 83 c4 08          	add    $0x8,%rsp
+  802c60:	5b                   	pop    %rbx
+  802c61:	41 5c                	pop    %r12
+  802c63:	41 5d                	pop    %r13
+  802c65:	5d                   	pop    %rbp
+  802c66:	c3                   	ret
+        assert(!block_is_free(2 + i));
+  802c67:	48 b9 ca e3 80 00 00 	movabs $0x80e3ca,%rcx
+  802c6e:	00 00 00 
+  802c71:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  802c78:	00 00 00 
+  802c7b:	be e4 00 00 00       	mov    $0xe4,%esi
+  802c80:	48 bf 7a e3 80 00 00 	movabs $0x80e37a,%rdi
+  802c87:	00 00 00 
+  802c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8f:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  802c96:	00 00 00 
+  802c99:	41 ff d0             	call   *%r8
+    assert(!block_is_free(1));
+  802c9c:	48 b9 e0 e3 80 00 00 	movabs $0x80e3e0,%rcx
+  802ca3:	00 00 00 
+  802ca6:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  802cad:	00 00 00 
+  802cb0:	be e8 00 00 00       	mov    $0xe8,%esi
+  802cb5:	48 bf 7a e3 80 00 00 	movabs $0x80e37a,%rdi
+  802cbc:	00 00 00 
+  802cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc4:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  802ccb:	00 00 00 
+  802cce:	41 ff d0             	call   *%r8
+    assert(!block_is_free(0));
+  802cd1:	48 b9 f2 e3 80 00 00 	movabs $0x80e3f2,%rcx
+  802cd8:	00 00 00 
+  802cdb:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  802ce2:	00 00 00 
+  802ce5:	be e9 00 00 00       	mov    $0xe9,%esi
+  802cea:	48 bf 7a e3 80 00 00 	movabs $0x80e37a,%rdi
+  802cf1:	00 00 00 
+  802cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf9:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  802d00:	00 00 00 
+  802d03:	41 ff d0             	call   *%r8
+
+0000000000802d06 <fs_init>:
+fs_init(void) {
+  802d06:	55                   	push   %rbp
+  802d07:	48 89 e5             	mov    %rsp,%rbp
+  802d0a:	41 57                	push   %r15
+  802d0c:	41 56                	push   %r14
+  802d0e:	41 55                	push   %r13
+  802d10:	41 54                	push   %r12
+  802d12:	53                   	push   %rbx
+  802d13:	48 83 ec 08          	sub    $0x8,%rsp
+    bc_init();
+  802d17:	48 b8 72 1f 80 00 00 	movabs $0x801f72,%rax
+  802d1e:	00 00 00 
+  802d21:	ff d0                	call   *%rax
+    super = bc_get(1, BC_META);
+  802d23:	be 04 00 00 00       	mov    $0x4,%esi
+  802d28:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d2d:	48 bb ee 1a 80 00 00 	movabs $0x801aee,%rbx
+  802d34:	00 00 00 
+  802d37:	ff d3                	call   *%rbx
+  802d39:	49 bc 68 72 8a 00 00 	movabs $0x8a7268,%r12
+  802d40:	00 00 00 
+  802d43:	49 89 04 24          	mov    %rax,(%r12)
+    check_super();
+  802d47:	48 b8 66 24 80 00 00 	movabs $0x802466,%rax
+  802d4e:	00 00 00 
+  802d51:	ff d0                	call   *%rax
+    journal_init();
+  802d53:	48 b8 c5 52 80 00 00 	movabs $0x8052c5,%rax
+  802d5a:	00 00 00 
+  802d5d:	ff d0                	call   *%rax
+    blockno_t nbitmap = CEILDIV(super->s_nblocks, BLKBITSIZE);
+  802d5f:	49 8b 04 24          	mov    (%r12),%rax
+  802d63:	44 8b 60 04          	mov    0x4(%rax),%r12d
+  802d67:	49 81 c4 ff 7f 00 00 	add    $0x7fff,%r12
+  802d6e:	49 c1 ec 0f          	shr    $0xf,%r12
+  802d72:	44 89 e6             	mov    %r12d,%esi
+    bc_load(2, nbitmap);
+  802d75:	bf 02 00 00 00       	mov    $0x2,%edi
+  802d7a:	48 b8 24 0b 80 00 00 	movabs $0x800b24,%rax
+  802d81:	00 00 00 
+  802d84:	ff d0                	call   *%rax
+    bitmap = bc_get(2, BC_META);
+  802d86:	be 04 00 00 00       	mov    $0x4,%esi
+  802d8b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802d90:	ff d3                	call   *%rbx
+  802d92:	48 a3 60 72 8a 00 00 	movabs %rax,0x8a7260
+  802d99:	00 00 00 
+    for (blockno_t i = 0; i < nbitmap; i++)
+  802d9c:	45 85 e4             	test   %r12d,%r12d
+  802d9f:	74 26                	je     802dc7 <fs_init+0xc1>
+  802da1:	45 8d 74 24 02       	lea    0x2(%r12),%r14d
+  802da6:	bb 02 00 00 00       	mov    $0x2,%ebx
+        bc_set_meta(2 + i, 1);
+  802dab:	49 bd ca 14 80 00 00 	movabs $0x8014ca,%r13
+  802db2:	00 00 00 
+  802db5:	be 01 00 00 00       	mov    $0x1,%esi
+  802dba:	89 df                	mov    %ebx,%edi
+  802dbc:	41 ff d5             	call   *%r13
+    for (blockno_t i = 0; i < nbitmap; i++)
+  802dbf:	83 c3 01             	add    $0x1,%ebx
+  802dc2:	44 39 f3             	cmp    %r14d,%ebx
+  802dc5:	75 ee                	jne    802db5 <fs_init+0xaf>
+    bc_pin(1, 1 + nbitmap);
+  802dc7:	41 8d 74 24 01       	lea    0x1(%r12),%esi
+  802dcc:	bf 01 00 00 00       	mov    $0x1,%edi
+  802dd1:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  802dd8:	00 00 00 
+  802ddb:	ff d0                	call   *%rax
+    check_bitmap();
+  802ddd:	48 b8 cb 2b 80 00 00 	movabs $0x802bcb,%rax
+  802de4:	00 00 00 
+  802de7:	ff d0                	call   *%rax
+    for (blockno_t wi = 0; wi * 64 < super->s_nblocks; wi++)
+  802de9:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  802df0:	00 00 00 
+  802df3:	44 8b 70 04          	mov    0x4(%rax),%r14d
+  802df7:	45 85 f6             	test   %r14d,%r14d
+  802dfa:	74 50                	je     802e4c <fs_init+0x146>
+  802dfc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        group_free[wi * 64 / BLKGROUPSIZE] += __builtin_popcountll(bitmap_word(wi));
+  802e02:	49 bf 72 22 80 00 00 	movabs $0x802272,%r15
+  802e09:	00 00 00 
+  802e0c:	49 bd 40 bf 8a 00 00 	movabs $0x8abf40,%r13
+  802e13:	00 00 00 
+  802e16:	44 89 e3             	mov    %r12d,%ebx
+  802e19:	c1 e3 06             	shl    $0x6,%ebx
+  802e1c:	44 89 e7             	mov    %r12d,%edi
+  802e1f:	41 ff d7             	call   *%r15
+  802e22:	48 89 c7             	mov    %rax,%rdi
+  802e25:	48 b8 80 d4 80 00 00 	movabs $0x80d480,%rax
+  802e2c:	00 00 00 
+  802e2f:	ff d0                	call   *%rax
+  802e31:	89 c2                	mov    %eax,%edx
+  802e33:	89 d8                	mov    %ebx,%eax
+  802e35:	c1 e8 0c             	shr    $0xc,%eax
+  802e38:	89 c0                	mov    %eax,%eax
+  802e3a:	66 41 01 54 45 00    	add    %dx,0x0(%r13,%rax,2)
+    for (blockno_t wi = 0; wi * 64 < super->s_nblocks; wi++)
+  802e40:	41 83 c4 01          	add    $0x1,%r12d
+  802e44:	83 c3 40             	add    $0x40,%ebx
+  802e47:	44 39 f3             	cmp    %r14d,%ebx
+  802e4a:	72 ca                	jb     802e16 <fs_init+0x110>
+    memset(group_stale, 0xFF, sizeof(group_stale));
+  802e4c:	ba 18 00 00 00       	mov    $0x18,%edx
+  802e51:	be ff 00 00 00       	mov    $0xff,%esi
+  802e56:	48 bf 90 ba 8a 00 00 	movabs $0x8aba90,%rdi
+  802e5d:	00 00 00 
+  802e60:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  802e67:	00 00 00 
+  802e6a:	ff d0                	call   *%rax
+}
+  802e6c:	48 83 c4 08          	add    $0x8,%rsp
+  802e70:	5b                   	pop    %rbx
+  802e71:	41 5c                	pop    %r12
+  802e73:	41 5d                	pop    %r13
+  802e75:	41 5e                	pop    %r14
+  802e77:	41 5f                	pop    %r15
+  802e79:	5d                   	pop    %rbp
+  802e7a:	c3                   	ret
+
+0000000000802e7b <file_block_walk>:
+    if (filebno >= NDIRECT + NINDIRECT || super->s_features & FS_FEATURE_EXTENTS)
+  802e7b:	81 fe 09 04 00 00    	cmp    $0x409,%esi
+  802e81:	0f 87 fb 00 00 00    	ja     802f82 <file_block_walk+0x107>
+file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc) {
+  802e87:	55                   	push   %rbp
+  802e88:	48 89 e5             	mov    %rsp,%rbp
+  802e8b:	41 57                	push   %r15
+  802e8d:	41 56                	push   %r14
+  802e8f:	41 55                	push   %r13
+  802e91:	41 54                	push   %r12
+  802e93:	53                   	push   %rbx
+  802e94:	48 83 ec 08          	sub    $0x8,%rsp
+  802e98:	49 89 fc             	mov    %rdi,%r12
+  802e9b:	89 f3                	mov    %esi,%ebx
+  802e9d:	49 89 d5             	mov    %rdx,%r13
+    if (filebno >= NDIRECT + NINDIRECT || super->s_features & FS_FEATURE_EXTENTS)
+  802ea0:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  802ea7:	00 00 00 
+  802eaa:	f6 80 08 01 00 00 01 	testb  $0x1,0x108(%rax)
+  802eb1:	0f 85 d1 00 00 00    	jne    802f88 <file_block_walk+0x10d>
+    if (filebno < NDIRECT)
+  802eb7:	83 fe 09             	cmp    $0x9,%esi
+  802eba:	77 21                	ja     802edd <file_block_walk+0x62>
+        *ppdiskbno = f->f_direct + filebno;
+  802ebc:	89 f3                	mov    %esi,%ebx
+  802ebe:	48 8d 84 9f 88 00 00 	lea    0x88(%rdi,%rbx,4),%rax
+  802ec5:	00 
+  802ec6:	48 89 02             	mov    %rax,(%rdx)
+    return 0;
+  802ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ece:	48 83 c4 08          	add    $0x8,%rsp
+  802ed2:	5b                   	pop    %rbx
+  802ed3:	41 5c                	pop    %r12
+  802ed5:	41 5d                	pop    %r13
+  802ed7:	41 5e                	pop    %r14
+  802ed9:	41 5f                	pop    %r15
+  802edb:	5d                   	pop    %rbp
+  802edc:	c3                   	ret
+        if (!f->f_indirect) {
+  802edd:	83 bf b0 00 00 00 00 	cmpl   $0x0,0xb0(%rdi)
+  802ee4:	75 6e                	jne    802f54 <file_block_walk+0xd9>
+            if (!alloc)
+  802ee6:	84 c9                	test   %cl,%cl
+  802ee8:	0f 84 a4 00 00 00    	je     802f92 <file_block_walk+0x117>
+            if (!(new_block = alloc_block_near(f->f_direct[NDIRECT - 1] + 1)))
+  802eee:	8b 87 ac 00 00 00    	mov    0xac(%rdi),%eax
+  802ef4:	8d 78 01             	lea    0x1(%rax),%edi
+  802ef7:	48 b8 5f 2b 80 00 00 	movabs $0x802b5f,%rax
+  802efe:	00 00 00 
+  802f01:	ff d0                	call   *%rax
+  802f03:	41 89 c6             	mov    %eax,%r14d
+  802f06:	85 c0                	test   %eax,%eax
+  802f08:	0f 84 8e 00 00 00    	je     802f9c <file_block_walk+0x121>
+            void *blk = bc_get(new_block, BC_NOREAD | BC_META);
+  802f0e:	be 06 00 00 00       	mov    $0x6,%esi
+  802f13:	89 c7                	mov    %eax,%edi
+  802f15:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  802f1c:	00 00 00 
+  802f1f:	ff d0                	call   *%rax
+  802f21:	49 89 c7             	mov    %rax,%r15
+            memset(blk, 0, BLKSIZE);
+  802f24:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f29:	be 00 00 00 00       	mov    $0x0,%esi
+  802f2e:	48 89 c7             	mov    %rax,%rdi
+  802f31:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  802f38:	00 00 00 
+  802f3b:	ff d0                	call   *%rax
+            bc_put(blk);
+  802f3d:	4c 89 ff             	mov    %r15,%rdi
+  802f40:	48 b8 79 0c 80 00 00 	movabs $0x800c79,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+            f->f_indirect = new_block;
+  802f4c:	45 89 b4 24 b0 00 00 	mov    %r14d,0xb0(%r12)
+  802f53:	00 
+        *ppdiskbno = (blockno_t *)bc_get(f->f_indirect, BC_META) + filebno - NDIRECT;
+  802f54:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  802f5b:	00 
+  802f5c:	be 04 00 00 00       	mov    $0x4,%esi
+  802f61:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  802f68:	00 00 00 
+  802f6b:	ff d0                	call   *%rax
+  802f6d:	89 db                	mov    %ebx,%ebx
+  802f6f:	48 8d 44 98 d8       	lea    -0x28(%rax,%rbx,4),%rax
+  802f74:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return 0;
+  802f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7d:	e9 4c ff ff ff       	jmp    802ece <file_block_walk+0x53>
+        return -E_INVAL;
+  802f82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802f87:	c3                   	ret
+        return -E_INVAL;
+  802f88:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f8d:	e9 3c ff ff ff       	jmp    802ece <file_block_walk+0x53>
+                return -E_NOT_FOUND;
+  802f92:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f97:	e9 32 ff ff ff       	jmp    802ece <file_block_walk+0x53>
+                return -E_NO_DISK;
+  802f9c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802fa1:	e9 28 ff ff ff       	jmp    802ece <file_block_walk+0x53>
+
+0000000000802fa6 <file_set_blocks>:
+file_set_blocks(struct File *f, blockno_t filebno, blockno_t diskbno, blockno_t count) {
+  802fa6:	55                   	push   %rbp
+  802fa7:	48 89 e5             	mov    %rsp,%rbp
+  802faa:	41 57                	push   %r15
+  802fac:	41 56                	push   %r14
+  802fae:	41 55                	push   %r13
+  802fb0:	41 54                	push   %r12
+  802fb2:	53                   	push   %rbx
+  802fb3:	48 83 ec 28          	sub    $0x28,%rsp
+  802fb7:	49 89 fc             	mov    %rdi,%r12
+  802fba:	41 89 f5             	mov    %esi,%r13d
+  802fbd:	89 55 bc             	mov    %edx,-0x44(%rbp)
+  802fc0:	89 4d b0             	mov    %ecx,-0x50(%rbp)
+    if (super->s_features & FS_FEATURE_EXTENTS)
+  802fc3:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  802fca:	00 00 00 
+  802fcd:	f6 80 08 01 00 00 01 	testb  $0x1,0x108(%rax)
+  802fd4:	75 55                	jne    80302b <file_set_blocks+0x85>
+    for (blockno_t i = 0; i < count; i++) {
+  802fd6:	89 c8                	mov    %ecx,%eax
+  802fd8:	44 8d 3c 31          	lea    (%rcx,%rsi,1),%r15d
+  802fdc:	89 f3                	mov    %esi,%ebx
+        int res = file_block_walk(f, filebno + i, &pdiskbno, 1);
+  802fde:	49 be 7b 2e 80 00 00 	movabs $0x802e7b,%r14
+  802fe5:	00 00 00 
+    for (blockno_t i = 0; i < count; i++) {
+  802fe8:	85 c9                	test   %ecx,%ecx
+  802fea:	74 30                	je     80301c <file_set_blocks+0x76>
+        int res = file_block_walk(f, filebno + i, &pdiskbno, 1);
+  802fec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802ff1:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802ff5:	89 de                	mov    %ebx,%esi
+  802ff7:	4c 89 e7             	mov    %r12,%rdi
+  802ffa:	41 ff d6             	call   *%r14
+        if (res < 0) return res;
+  802ffd:	85 c0                	test   %eax,%eax
+  802fff:	78 1b                	js     80301c <file_set_blocks+0x76>
+        *pdiskbno = diskbno + i;
+  803001:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803004:	44 29 e8             	sub    %r13d,%eax
+  803007:	01 d8                	add    %ebx,%eax
+  803009:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80300d:	89 02                	mov    %eax,(%rdx)
+    for (blockno_t i = 0; i < count; i++) {
+  80300f:	83 c3 01             	add    $0x1,%ebx
+  803012:	44 39 fb             	cmp    %r15d,%ebx
+  803015:	75 d5                	jne    802fec <file_set_blocks+0x46>
+    return 0;
+  803017:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80301c:	48 83 c4 28          	add    $0x28,%rsp
+  803020:	5b                   	pop    %rbx
+  803021:	41 5c                	pop    %r12
+  803023:	41 5d                	pop    %r13
+  803025:	41 5e                	pop    %r14
+  803027:	41 5f                	pop    %r15
+  803029:	5d                   	pop    %rbp
+  80302a:	c3                   	ret
+    uint32_t i = file_extent_find(f, filebno);
+  80302b:	48 b8 44 23 80 00 00 	movabs $0x802344,%rax
+  803032:	00 00 00 
+  803035:	ff d0                	call   *%rax
+  803037:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+    struct Extent *prev = i ? file_extent(f, i - 1) : NULL;
+  80303a:	85 c0                	test   %eax,%eax
+  80303c:	75 67                	jne    8030a5 <file_set_blocks+0xff>
+  80303e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    struct Extent *next = i < f->f_nextents ? file_extent(f, i) : NULL;
+  803043:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803046:	41 3b 84 24 ac 00 00 	cmp    0xac(%r12),%eax
+  80304d:	00 
+  80304e:	0f 83 8d 00 00 00    	jae    8030e1 <file_set_blocks+0x13b>
+  803054:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803057:	4c 89 e7             	mov    %r12,%rdi
+  80305a:	48 b8 f9 22 80 00 00 	movabs $0x8022f9,%rax
+  803061:	00 00 00 
+  803064:	ff d0                	call   *%rax
+  803066:	48 89 c2             	mov    %rax,%rdx
+    bool join_next = next && next->e_fileblock == filebno + count && next->e_diskblock == diskbno + count;
+  803069:	48 85 c0             	test   %rax,%rax
+  80306c:	74 5e                	je     8030cc <file_set_blocks+0x126>
+  80306e:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803071:	44 01 e8             	add    %r13d,%eax
+  803074:	39 02                	cmp    %eax,(%rdx)
+  803076:	75 54                	jne    8030cc <file_set_blocks+0x126>
+  803078:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  80307b:	8b 75 bc             	mov    -0x44(%rbp),%esi
+  80307e:	01 f0                	add    %esi,%eax
+  803080:	39 42 04             	cmp    %eax,0x4(%rdx)
+  803083:	40 0f 94 c6          	sete   %sil
+    if (prev && prev->e_fileblock + prev->e_len == filebno && prev->e_diskblock + prev->e_len == diskbno) {
+  803087:	48 85 db             	test   %rbx,%rbx
+  80308a:	0f 84 f3 00 00 00    	je     803183 <file_set_blocks+0x1dd>
+  803090:	8b 43 08             	mov    0x8(%rbx),%eax
+  803093:	89 c1                	mov    %eax,%ecx
+  803095:	03 0b                	add    (%rbx),%ecx
+  803097:	41 39 cd             	cmp    %ecx,%r13d
+  80309a:	0f 85 e3 00 00 00    	jne    803183 <file_set_blocks+0x1dd>
+  8030a0:	e9 d4 00 00 00       	jmp    803179 <file_set_blocks+0x1d3>
+    struct Extent *prev = i ? file_extent(f, i - 1) : NULL;
+  8030a5:	41 89 c7             	mov    %eax,%r15d
+  8030a8:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8030ab:	4c 89 e7             	mov    %r12,%rdi
+  8030ae:	48 b8 f9 22 80 00 00 	movabs $0x8022f9,%rax
+  8030b5:	00 00 00 
+  8030b8:	ff d0                	call   *%rax
+  8030ba:	48 89 c3             	mov    %rax,%rbx
+    struct Extent *next = i < f->f_nextents ? file_extent(f, i) : NULL;
+  8030bd:	45 3b bc 24 ac 00 00 	cmp    0xac(%r12),%r15d
+  8030c4:	00 
+  8030c5:	72 8d                	jb     803054 <file_set_blocks+0xae>
+  8030c7:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (prev && prev->e_fileblock + prev->e_len == filebno && prev->e_diskblock + prev->e_len == diskbno) {
+  8030cc:	48 85 db             	test   %rbx,%rbx
+  8030cf:	74 10                	je     8030e1 <file_set_blocks+0x13b>
+  8030d1:	8b 43 08             	mov    0x8(%rbx),%eax
+  8030d4:	89 c1                	mov    %eax,%ecx
+  8030d6:	03 0b                	add    (%rbx),%ecx
+  8030d8:	41 39 cd             	cmp    %ecx,%r13d
+  8030db:	0f 84 93 00 00 00    	je     803174 <file_set_blocks+0x1ce>
+    if (f->f_nextents == NINLINEEXT + NBLKEXT) return -E_NO_DISK;
+  8030e1:	41 8b 84 24 ac 00 00 	mov    0xac(%r12),%eax
+  8030e8:	00 
+  8030e9:	3d 58 01 00 00       	cmp    $0x158,%eax
+  8030ee:	0f 84 48 01 00 00    	je     80323c <file_set_blocks+0x296>
+    if (f->f_nextents == NINLINEEXT) {
+  8030f4:	83 f8 03             	cmp    $0x3,%eax
+  8030f7:	0f 84 e2 00 00 00    	je     8031df <file_set_blocks+0x239>
+    for (uint32_t j = f->f_nextents; j > i; j--)
+  8030fd:	41 8b 9c 24 ac 00 00 	mov    0xac(%r12),%ebx
+  803104:	00 
+  803105:	39 5d b4             	cmp    %ebx,-0x4c(%rbp)
+  803108:	73 36                	jae    803140 <file_set_blocks+0x19a>
+        *file_extent(f, j) = *file_extent(f, j - 1);
+  80310a:	49 bf f9 22 80 00 00 	movabs $0x8022f9,%r15
+  803111:	00 00 00 
+  803114:	89 5d b8             	mov    %ebx,-0x48(%rbp)
+  803117:	83 eb 01             	sub    $0x1,%ebx
+  80311a:	89 de                	mov    %ebx,%esi
+  80311c:	4c 89 e7             	mov    %r12,%rdi
+  80311f:	41 ff d7             	call   *%r15
+  803122:	49 89 c6             	mov    %rax,%r14
+  803125:	8b 75 b8             	mov    -0x48(%rbp),%esi
+  803128:	4c 89 e7             	mov    %r12,%rdi
+  80312b:	41 ff d7             	call   *%r15
+  80312e:	49 8b 16             	mov    (%r14),%rdx
+  803131:	48 89 10             	mov    %rdx,(%rax)
+  803134:	41 8b 56 08          	mov    0x8(%r14),%edx
+  803138:	89 50 08             	mov    %edx,0x8(%rax)
+    for (uint32_t j = f->f_nextents; j > i; j--)
+  80313b:	39 5d b4             	cmp    %ebx,-0x4c(%rbp)
+  80313e:	72 d4                	jb     803114 <file_set_blocks+0x16e>
+    f->f_nextents++;
+  803140:	41 83 84 24 ac 00 00 	addl   $0x1,0xac(%r12)
+  803147:	00 01 
+    struct Extent *ext = file_extent(f, i);
+  803149:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  80314c:	4c 89 e7             	mov    %r12,%rdi
+  80314f:	48 b8 f9 22 80 00 00 	movabs $0x8022f9,%rax
+  803156:	00 00 00 
+  803159:	ff d0                	call   *%rax
+    ext->e_fileblock = filebno;
+  80315b:	44 89 28             	mov    %r13d,(%rax)
+    ext->e_diskblock = diskbno;
+  80315e:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  803161:	89 78 04             	mov    %edi,0x4(%rax)
+    ext->e_len = count;
+  803164:	8b 7d b0             	mov    -0x50(%rbp),%edi
+  803167:	89 78 08             	mov    %edi,0x8(%rax)
+    return 0;
+  80316a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316f:	e9 a8 fe ff ff       	jmp    80301c <file_set_blocks+0x76>
+    bool join_next = next && next->e_fileblock == filebno + count && next->e_diskblock == diskbno + count;
+  803174:	be 00 00 00 00       	mov    $0x0,%esi
+    if (prev && prev->e_fileblock + prev->e_len == filebno && prev->e_diskblock + prev->e_len == diskbno) {
+  803179:	89 c1                	mov    %eax,%ecx
+  80317b:	03 4b 04             	add    0x4(%rbx),%ecx
+  80317e:	39 4d bc             	cmp    %ecx,-0x44(%rbp)
+  803181:	74 22                	je     8031a5 <file_set_blocks+0x1ff>
+    if (join_next) {
+  803183:	40 84 f6             	test   %sil,%sil
+  803186:	0f 84 55 ff ff ff    	je     8030e1 <file_set_blocks+0x13b>
+        next->e_fileblock = filebno;
+  80318c:	44 89 2a             	mov    %r13d,(%rdx)
+        next->e_diskblock = diskbno;
+  80318f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803192:	89 42 04             	mov    %eax,0x4(%rdx)
+        next->e_len += count;
+  803195:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803198:	01 42 08             	add    %eax,0x8(%rdx)
+        return 0;
+  80319b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a0:	e9 77 fe ff ff       	jmp    80301c <file_set_blocks+0x76>
+        prev->e_len += count;
+  8031a5:	8b 4d b0             	mov    -0x50(%rbp),%ecx
+  8031a8:	01 c1                	add    %eax,%ecx
+  8031aa:	89 4b 08             	mov    %ecx,0x8(%rbx)
+        return 0;
+  8031ad:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (join_next) {
+  8031b2:	40 84 f6             	test   %sil,%sil
+  8031b5:	0f 84 61 fe ff ff    	je     80301c <file_set_blocks+0x76>
+            prev->e_len += next->e_len;
+  8031bb:	89 c8                	mov    %ecx,%eax
+  8031bd:	03 42 08             	add    0x8(%rdx),%eax
+  8031c0:	89 43 08             	mov    %eax,0x8(%rbx)
+            file_extent_remove(f, i);
+  8031c3:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8031c6:	4c 89 e7             	mov    %r12,%rdi
+  8031c9:	48 b8 03 26 80 00 00 	movabs $0x802603,%rax
+  8031d0:	00 00 00 
+  8031d3:	ff d0                	call   *%rax
+        return 0;
+  8031d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031da:	e9 3d fe ff ff       	jmp    80301c <file_set_blocks+0x76>
+        if (!(new_block = alloc_block()))
+  8031df:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  8031e6:	00 00 00 
+  8031e9:	ff d0                	call   *%rax
+  8031eb:	89 c3                	mov    %eax,%ebx
+  8031ed:	85 c0                	test   %eax,%eax
+  8031ef:	74 55                	je     803246 <file_set_blocks+0x2a0>
+        void *blk = bc_get(new_block, BC_NOREAD | BC_META);
+  8031f1:	be 06 00 00 00       	mov    $0x6,%esi
+  8031f6:	89 c7                	mov    %eax,%edi
+  8031f8:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  8031ff:	00 00 00 
+  803202:	ff d0                	call   *%rax
+  803204:	49 89 c6             	mov    %rax,%r14
+        memset(blk, 0, BLKSIZE);
+  803207:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80320c:	be 00 00 00 00       	mov    $0x0,%esi
+  803211:	48 89 c7             	mov    %rax,%rdi
+  803214:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  80321b:	00 00 00 
+  80321e:	ff d0                	call   *%rax
+        bc_put(blk);
+  803220:	4c 89 f7             	mov    %r14,%rdi
+  803223:	48 b8 79 0c 80 00 00 	movabs $0x800c79,%rax
+  80322a:	00 00 00 
+  80322d:	ff d0                	call   *%rax
+        f->f_extblock = new_block;
+  80322f:	41 89 9c 24 b0 00 00 	mov    %ebx,0xb0(%r12)
+  803236:	00 
+  803237:	e9 c1 fe ff ff       	jmp    8030fd <file_set_blocks+0x157>
+    if (f->f_nextents == NINLINEEXT + NBLKEXT) return -E_NO_DISK;
+  80323c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803241:	e9 d6 fd ff ff       	jmp    80301c <file_set_blocks+0x76>
+            return -E_NO_DISK;
+  803246:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80324b:	e9 cc fd ff ff       	jmp    80301c <file_set_blocks+0x76>
+
+0000000000803250 <file_block_lookup>:
+file_block_lookup(struct File *f, blockno_t filebno, blockno_t *diskbno, blockno_t *run) {
+  803250:	55                   	push   %rbp
+  803251:	48 89 e5             	mov    %rsp,%rbp
+  803254:	41 57                	push   %r15
+  803256:	41 56                	push   %r14
+  803258:	41 55                	push   %r13
+  80325a:	41 54                	push   %r12
+  80325c:	53                   	push   %rbx
+  80325d:	48 83 ec 28          	sub    $0x28,%rsp
+  803261:	49 89 fd             	mov    %rdi,%r13
+  803264:	41 89 f4             	mov    %esi,%r12d
+  803267:	49 89 d6             	mov    %rdx,%r14
+  80326a:	48 89 cb             	mov    %rcx,%rbx
+    if (super->s_features & FS_FEATURE_EXTENTS) {
+  80326d:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  803274:	00 00 00 
+  803277:	8b 80 08 01 00 00    	mov    0x108(%rax),%eax
+  80327d:	83 e0 01             	and    $0x1,%eax
+  803280:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  803283:	0f 84 9a 00 00 00    	je     803323 <file_block_lookup+0xd3>
+        if (filebno >= MAXEXTFILESIZE / BLKSIZE) return -E_INVAL;
+  803289:	81 fe fe ff 07 00    	cmp    $0x7fffe,%esi
+  80328f:	0f 87 d4 00 00 00    	ja     803369 <file_block_lookup+0x119>
+        uint32_t i = file_extent_find(f, filebno);
+  803295:	48 b8 44 23 80 00 00 	movabs $0x802344,%rax
+  80329c:	00 00 00 
+  80329f:	ff d0                	call   *%rax
+        struct Extent *ext = i < f->f_nextents ? file_extent(f, i) : NULL;
+  8032a1:	41 3b 85 ac 00 00 00 	cmp    0xac(%r13),%eax
+  8032a8:	72 25                	jb     8032cf <file_block_lookup+0x7f>
+            *diskbno = 0;
+  8032aa:	41 c7 06 00 00 00 00 	movl   $0x0,(%r14)
+            *run = (ext ? ext->e_fileblock : MAXEXTFILESIZE / BLKSIZE) - filebno;
+  8032b1:	b8 ff ff 07 00       	mov    $0x7ffff,%eax
+  8032b6:	44 29 e0             	sub    %r12d,%eax
+  8032b9:	89 03                	mov    %eax,(%rbx)
+        return 0;
+  8032bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032c0:	48 83 c4 28          	add    $0x28,%rsp
+  8032c4:	5b                   	pop    %rbx
+  8032c5:	41 5c                	pop    %r12
+  8032c7:	41 5d                	pop    %r13
+  8032c9:	41 5e                	pop    %r14
+  8032cb:	41 5f                	pop    %r15
+  8032cd:	5d                   	pop    %rbp
+  8032ce:	c3                   	ret
+        struct Extent *ext = i < f->f_nextents ? file_extent(f, i) : NULL;
+  8032cf:	89 c6                	mov    %eax,%esi
+  8032d1:	4c 89 ef             	mov    %r13,%rdi
+  8032d4:	48 b8 f9 22 80 00 00 	movabs $0x8022f9,%rax
+  8032db:	00 00 00 
+  8032de:	ff d0                	call   *%rax
+        if (ext && ext->e_fileblock <= filebno) {
+  8032e0:	48 85 c0             	test   %rax,%rax
+  8032e3:	74 30                	je     803315 <file_block_lookup+0xc5>
+  8032e5:	8b 10                	mov    (%rax),%edx
+  8032e7:	41 39 d4             	cmp    %edx,%r12d
+  8032ea:	72 1e                	jb     80330a <file_block_lookup+0xba>
+            *diskbno = ext->e_diskblock + (filebno - ext->e_fileblock);
+  8032ec:	44 89 e1             	mov    %r12d,%ecx
+  8032ef:	03 48 04             	add    0x4(%rax),%ecx
+  8032f2:	29 d1                	sub    %edx,%ecx
+  8032f4:	41 89 0e             	mov    %ecx,(%r14)
+            *run = ext->e_len - (filebno - ext->e_fileblock);
+  8032f7:	8b 10                	mov    (%rax),%edx
+  8032f9:	03 50 08             	add    0x8(%rax),%edx
+  8032fc:	89 d0                	mov    %edx,%eax
+  8032fe:	44 29 e0             	sub    %r12d,%eax
+  803301:	89 03                	mov    %eax,(%rbx)
+        return 0;
+  803303:	b8 00 00 00 00       	mov    $0x0,%eax
+            *run = ext->e_len - (filebno - ext->e_fileblock);
+  803308:	eb b6                	jmp    8032c0 <file_block_lookup+0x70>
+            *diskbno = 0;
+  80330a:	41 c7 06 00 00 00 00 	movl   $0x0,(%r14)
+            *run = (ext ? ext->e_fileblock : MAXEXTFILESIZE / BLKSIZE) - filebno;
+  803311:	8b 00                	mov    (%rax),%eax
+  803313:	eb a1                	jmp    8032b6 <file_block_lookup+0x66>
+            *diskbno = 0;
+  803315:	41 c7 06 00 00 00 00 	movl   $0x0,(%r14)
+            *run = (ext ? ext->e_fileblock : MAXEXTFILESIZE / BLKSIZE) - filebno;
+  80331c:	b8 ff ff 07 00       	mov    $0x7ffff,%eax
+  803321:	eb 93                	jmp    8032b6 <file_block_lookup+0x66>
+    int res = file_block_walk(f, filebno, &pdiskbno, 0);
+  803323:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803328:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80332c:	48 b8 7b 2e 80 00 00 	movabs $0x802e7b,%rax
+  803333:	00 00 00 
+  803336:	ff d0                	call   *%rax
+    if (res == -E_NOT_FOUND) {
+  803338:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80333b:	74 40                	je     80337d <file_block_lookup+0x12d>
+    if (res < 0) return res;
+  80333d:	85 c0                	test   %eax,%eax
+  80333f:	0f 88 7b ff ff ff    	js     8032c0 <file_block_lookup+0x70>
+    *diskbno = *pdiskbno;
+  803345:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803349:	8b 00                	mov    (%rax),%eax
+  80334b:	41 89 06             	mov    %eax,(%r14)
+    while (!file_block_pointer(f, filebno + *run, &next) && next == (*diskbno ? *diskbno + *run : 0))
+  80334e:	be 01 00 00 00       	mov    $0x1,%esi
+    int res = file_block_walk(f, filebno, &pdiskbno, 0);
+  803353:	49 bf 7b 2e 80 00 00 	movabs $0x802e7b,%r15
+  80335a:	00 00 00 
+    while (!file_block_pointer(f, filebno + *run, &next) && next == (*diskbno ? *diskbno + *run : 0))
+  80335d:	eb 38                	jmp    803397 <file_block_lookup+0x147>
+    return 0;
+  80335f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803364:	e9 57 ff ff ff       	jmp    8032c0 <file_block_lookup+0x70>
+        if (filebno >= MAXEXTFILESIZE / BLKSIZE) return -E_INVAL;
+  803369:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80336e:	e9 4d ff ff ff       	jmp    8032c0 <file_block_lookup+0x70>
+    return 0;
+  803373:	b8 00 00 00 00       	mov    $0x0,%eax
+  803378:	e9 43 ff ff ff       	jmp    8032c0 <file_block_lookup+0x70>
+  80337d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803380:	eb c9                	jmp    80334b <file_block_lookup+0xfb>
+    while (!file_block_pointer(f, filebno + *run, &next) && next == (*diskbno ? *diskbno + *run : 0))
+  803382:	41 8b 06             	mov    (%r14),%eax
+        *diskbno = 0;
+  803385:	8b 55 bc             	mov    -0x44(%rbp),%edx
+    while (!file_block_pointer(f, filebno + *run, &next) && next == (*diskbno ? *diskbno + *run : 0))
+  803388:	85 c0                	test   %eax,%eax
+  80338a:	74 06                	je     803392 <file_block_lookup+0x142>
+  80338c:	03 03                	add    (%rbx),%eax
+  80338e:	39 d0                	cmp    %edx,%eax
+  803390:	75 cd                	jne    80335f <file_block_lookup+0x10f>
+        (*run)++;
+  803392:	8b 03                	mov    (%rbx),%eax
+  803394:	8d 70 01             	lea    0x1(%rax),%esi
+    *run = 1;
+  803397:	89 33                	mov    %esi,(%rbx)
+    while (!file_block_pointer(f, filebno + *run, &next) && next == (*diskbno ? *diskbno + *run : 0))
+  803399:	44 01 e6             	add    %r12d,%esi
+    int res = file_block_walk(f, filebno, &pdiskbno, 0);
+  80339c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033a1:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8033a5:	4c 89 ef             	mov    %r13,%rdi
+  8033a8:	41 ff d7             	call   *%r15
+    if (res == -E_NOT_FOUND) {
+  8033ab:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8033ae:	74 d2                	je     803382 <file_block_lookup+0x132>
+    if (res < 0) return res;
+  8033b0:	85 c0                	test   %eax,%eax
+  8033b2:	78 bf                	js     803373 <file_block_lookup+0x123>
+    *diskbno = *pdiskbno;
+  8033b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033b8:	8b 10                	mov    (%rax),%edx
+    while (!file_block_pointer(f, filebno + *run, &next) && next == (*diskbno ? *diskbno + *run : 0))
+  8033ba:	41 8b 06             	mov    (%r14),%eax
+  8033bd:	85 c0                	test   %eax,%eax
+  8033bf:	74 cd                	je     80338e <file_block_lookup+0x13e>
+  8033c1:	eb c9                	jmp    80338c <file_block_lookup+0x13c>
+
+00000000008033c3 <file_inline>:
+
+/* Whether a file of given size would keep its data inline */
+static bool
+fits_inline(struct File *f, off_t size) {
+    return super->s_features & FS_FEATURE_INLINE &&
+           f->f_type == FTYPE_REG && size <= FILE_INLINE_MAX;
+  8033c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033c8:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  8033cf:	00 00 00 
+  8033d2:	f6 80 08 01 00 00 04 	testb  $0x4,0x108(%rax)
+  8033d9:	74 19                	je     8033f4 <file_inline+0x31>
+    return super->s_features & FS_FEATURE_INLINE &&
+  8033db:	83 bf 84 00 00 00 00 	cmpl   $0x0,0x84(%rdi)
+  8033e2:	0f 94 c0             	sete   %al
+           f->f_type == FTYPE_REG && size <= FILE_INLINE_MAX;
+  8033e5:	83 bf 80 00 00 00 70 	cmpl   $0x70,0x80(%rdi)
+  8033ec:	0f 9e c2             	setle  %dl
+  8033ef:	0f b6 d2             	movzbl %dl,%edx
+  8033f2:	21 c2                	and    %eax,%edx
+  8033f4:	89 d0                	mov    %edx,%eax
+  8033f6:	83 e0 01             	and    $0x1,%eax
+
+/* Whether data of file f is stored in struct File instead of blocks */
+bool
+file_inline(struct File *f) {
+    return fits_inline(f, f->f_size);
+}
+  8033f9:	c3                   	ret
+
+00000000008033fa <file_get_blocks>:
+file_get_blocks(struct File *f, blockno_t filebno, blockno_t *count, char **blk) {
+  8033fa:	55                   	push   %rbp
+  8033fb:	48 89 e5             	mov    %rsp,%rbp
+  8033fe:	41 57                	push   %r15
+  803400:	41 56                	push   %r14
+  803402:	41 55                	push   %r13
+  803404:	41 54                	push   %r12
+  803406:	53                   	push   %rbx
+  803407:	48 83 ec 28          	sub    $0x28,%rsp
+  80340b:	49 89 fc             	mov    %rdi,%r12
+  80340e:	41 89 f6             	mov    %esi,%r14d
+  803411:	49 89 d5             	mov    %rdx,%r13
+  803414:	48 89 4d b8          	mov    %rcx,-0x48(%rbp)
+    if (file_inline(f)) return -E_INVAL;
+  803418:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  80341f:	00 00 00 
+  803422:	ff d0                	call   *%rax
+  803424:	84 c0                	test   %al,%al
+  803426:	0f 85 80 01 00 00    	jne    8035ac <file_get_blocks+0x1b2>
+    int res = file_block_lookup(f, filebno, &diskbno, &run);
+  80342c:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  803430:	48 8d 55 cc          	lea    -0x34(%rbp),%rdx
+  803434:	44 89 f6             	mov    %r14d,%esi
+  803437:	4c 89 e7             	mov    %r12,%rdi
+  80343a:	48 b8 50 32 80 00 00 	movabs $0x803250,%rax
+  803441:	00 00 00 
+  803444:	ff d0                	call   *%rax
+  803446:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  803448:	85 c0                	test   %eax,%eax
+  80344a:	78 39                	js     803485 <file_get_blocks+0x8b>
+    if (!diskbno) {
+  80344c:	8b 5d cc             	mov    -0x34(%rbp),%ebx
+  80344f:	85 db                	test   %ebx,%ebx
+  803451:	0f 85 69 01 00 00    	jne    8035c0 <file_get_blocks+0x1c6>
+        blockno_t goal = alloc_cursor, prev;
+  803457:	48 b8 80 ba 8a 00 00 	movabs $0x8aba80,%rax
+  80345e:	00 00 00 
+  803461:	8b 18                	mov    (%rax),%ebx
+        if (filebno && !file_block_lookup(f, filebno - 1, &prev, &run) && prev)
+  803463:	45 85 f6             	test   %r14d,%r14d
+  803466:	75 2e                	jne    803496 <file_get_blocks+0x9c>
+        if (!(diskbno = alloc_block_near(goal)))
+  803468:	89 df                	mov    %ebx,%edi
+  80346a:	48 b8 5f 2b 80 00 00 	movabs $0x802b5f,%rax
+  803471:	00 00 00 
+  803474:	ff d0                	call   *%rax
+  803476:	41 89 c7             	mov    %eax,%r15d
+  803479:	89 45 cc             	mov    %eax,-0x34(%rbp)
+            return -E_NO_DISK;
+  80347c:	bb f3 ff ff ff       	mov    $0xfffffff3,%ebx
+        if (!(diskbno = alloc_block_near(goal)))
+  803481:	85 c0                	test   %eax,%eax
+  803483:	75 3d                	jne    8034c2 <file_get_blocks+0xc8>
+}
+  803485:	89 d8                	mov    %ebx,%eax
+  803487:	48 83 c4 28          	add    $0x28,%rsp
+  80348b:	5b                   	pop    %rbx
+  80348c:	41 5c                	pop    %r12
+  80348e:	41 5d                	pop    %r13
+  803490:	41 5e                	pop    %r14
+  803492:	41 5f                	pop    %r15
+  803494:	5d                   	pop    %rbp
+  803495:	c3                   	ret
+        if (filebno && !file_block_lookup(f, filebno - 1, &prev, &run) && prev)
+  803496:	41 8d 76 ff          	lea    -0x1(%r14),%esi
+  80349a:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  80349e:	48 8d 55 c4          	lea    -0x3c(%rbp),%rdx
+  8034a2:	4c 89 e7             	mov    %r12,%rdi
+  8034a5:	48 b8 50 32 80 00 00 	movabs $0x803250,%rax
+  8034ac:	00 00 00 
+  8034af:	ff d0                	call   *%rax
+  8034b1:	85 c0                	test   %eax,%eax
+  8034b3:	75 b3                	jne    803468 <file_get_blocks+0x6e>
+  8034b5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+            goal = prev + 1;
+  8034b8:	8d 50 01             	lea    0x1(%rax),%edx
+  8034bb:	85 c0                	test   %eax,%eax
+  8034bd:	0f 45 da             	cmovne %edx,%ebx
+  8034c0:	eb a6                	jmp    803468 <file_get_blocks+0x6e>
+        if ((res = file_set_blocks(f, filebno, diskbno, 1)) < 0) {
+  8034c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8034c7:	89 c2                	mov    %eax,%edx
+  8034c9:	44 89 f6             	mov    %r14d,%esi
+  8034cc:	4c 89 e7             	mov    %r12,%rdi
+  8034cf:	48 b8 a6 2f 80 00 00 	movabs $0x802fa6,%rax
+  8034d6:	00 00 00 
+  8034d9:	ff d0                	call   *%rax
+  8034db:	89 c3                	mov    %eax,%ebx
+  8034dd:	85 c0                	test   %eax,%eax
+  8034df:	78 6e                	js     80354f <file_get_blocks+0x155>
+    *count = MIN(*count, run);
+  8034e1:	41 8b 45 00          	mov    0x0(%r13),%eax
+  8034e5:	83 f8 00             	cmp    $0x0,%eax
+  8034e8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8034ed:	0f 47 c2             	cmova  %edx,%eax
+  8034f0:	41 89 45 00          	mov    %eax,0x0(%r13)
+    *blk = (char *)diskaddr(diskbno);
+  8034f4:	44 89 ff             	mov    %r15d,%edi
+  8034f7:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  8034fe:	00 00 00 
+  803501:	ff d0                	call   *%rax
+  803503:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803507:	48 89 01             	mov    %rax,(%rcx)
+    bc_touch(diskbno, *count);
+  80350a:	41 8b 75 00          	mov    0x0(%r13),%esi
+  80350e:	44 89 ff             	mov    %r15d,%edi
+  803511:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  803518:	00 00 00 
+  80351b:	ff d0                	call   *%rax
+    return 0;
+  80351d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (f->f_type == FTYPE_DIR) {
+  803522:	41 83 bc 24 84 00 00 	cmpl   $0x1,0x84(%r12)
+  803529:	00 01 
+  80352b:	0f 85 54 ff ff ff    	jne    803485 <file_get_blocks+0x8b>
+            bc_get(diskbno, BC_NOREAD | BC_META);
+  803531:	be 06 00 00 00       	mov    $0x6,%esi
+  803536:	44 89 ff             	mov    %r15d,%edi
+  803539:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  803540:	00 00 00 
+  803543:	ff d0                	call   *%rax
+            return 0;
+  803545:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80354a:	e9 36 ff ff ff       	jmp    803485 <file_get_blocks+0x8b>
+            free_block(diskbno);
+  80354f:	44 89 ff             	mov    %r15d,%edi
+  803552:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  803559:	00 00 00 
+  80355c:	ff d0                	call   *%rax
+            return res;
+  80355e:	e9 22 ff ff ff       	jmp    803485 <file_get_blocks+0x8b>
+        bc_load(diskbno, *count);
+  803563:	41 8b 75 00          	mov    0x0(%r13),%esi
+  803567:	89 df                	mov    %ebx,%edi
+  803569:	48 b8 24 0b 80 00 00 	movabs $0x800b24,%rax
+  803570:	00 00 00 
+  803573:	ff d0                	call   *%rax
+        for (blockno_t i = 0; i < *count; i++) bc_set_meta(diskbno + i, 1);
+  803575:	41 83 7d 00 00       	cmpl   $0x0,0x0(%r13)
+  80357a:	74 3a                	je     8035b6 <file_get_blocks+0x1bc>
+  80357c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803582:	49 be ca 14 80 00 00 	movabs $0x8014ca,%r14
+  803589:	00 00 00 
+  80358c:	42 8d 3c 23          	lea    (%rbx,%r12,1),%edi
+  803590:	be 01 00 00 00       	mov    $0x1,%esi
+  803595:	41 ff d6             	call   *%r14
+  803598:	41 83 c4 01          	add    $0x1,%r12d
+  80359c:	45 3b 65 00          	cmp    0x0(%r13),%r12d
+  8035a0:	72 ea                	jb     80358c <file_get_blocks+0x192>
+    return 0;
+  8035a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035a7:	e9 d9 fe ff ff       	jmp    803485 <file_get_blocks+0x8b>
+    if (file_inline(f)) return -E_INVAL;
+  8035ac:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8035b1:	e9 cf fe ff ff       	jmp    803485 <file_get_blocks+0x8b>
+    return 0;
+  8035b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035bb:	e9 c5 fe ff ff       	jmp    803485 <file_get_blocks+0x8b>
+    *count = MIN(*count, run);
+  8035c0:	41 8b 45 00          	mov    0x0(%r13),%eax
+  8035c4:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8035c7:	39 d0                	cmp    %edx,%eax
+  8035c9:	0f 47 c2             	cmova  %edx,%eax
+  8035cc:	41 89 45 00          	mov    %eax,0x0(%r13)
+    *blk = (char *)diskaddr(diskbno);
+  8035d0:	89 df                	mov    %ebx,%edi
+  8035d2:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  8035d9:	00 00 00 
+  8035dc:	ff d0                	call   *%rax
+  8035de:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8035e2:	48 89 01             	mov    %rax,(%rcx)
+    bc_touch(diskbno, *count);
+  8035e5:	41 8b 75 00          	mov    0x0(%r13),%esi
+  8035e9:	89 df                	mov    %ebx,%edi
+  8035eb:	48 b8 d5 0c 80 00 00 	movabs $0x800cd5,%rax
+  8035f2:	00 00 00 
+  8035f5:	ff d0                	call   *%rax
+    if (f->f_type == FTYPE_DIR) {
+  8035f7:	41 83 bc 24 84 00 00 	cmpl   $0x1,0x84(%r12)
+  8035fe:	00 01 
+  803600:	0f 84 5d ff ff ff    	je     803563 <file_get_blocks+0x169>
+    return 0;
+  803606:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80360b:	e9 75 fe ff ff       	jmp    803485 <file_get_blocks+0x8b>
+
+0000000000803610 <file_get_block>:
+file_get_block(struct File *f, blockno_t filebno, char **blk) {
+  803610:	55                   	push   %rbp
+  803611:	48 89 e5             	mov    %rsp,%rbp
+  803614:	48 83 ec 10          	sub    $0x10,%rsp
+  803618:	48 89 d1             	mov    %rdx,%rcx
+    blockno_t count = 1;
+  80361b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    return file_get_blocks(f, filebno, &count, blk);
+  803622:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+  803626:	48 b8 fa 33 80 00 00 	movabs $0x8033fa,%rax
+  80362d:	00 00 00 
+  803630:	ff d0                	call   *%rax
+}
+  803632:	c9                   	leave
+  803633:	c3                   	ret
+
+0000000000803634 <dir_slot>:
+dir_slot(struct File *dir, uint32_t slot, struct File **file) {
+  803634:	55                   	push   %rbp
+  803635:	48 89 e5             	mov    %rsp,%rbp
+  803638:	41 54                	push   %r12
+  80363a:	53                   	push   %rbx
+  80363b:	48 83 ec 10          	sub    $0x10,%rsp
+  80363f:	89 f3                	mov    %esi,%ebx
+  803641:	49 89 d4             	mov    %rdx,%r12
+    int res = file_get_block(dir, slot / BLKFILES, &blk);
+  803644:	c1 ee 04             	shr    $0x4,%esi
+  803647:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80364b:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  803652:	00 00 00 
+  803655:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803657:	85 c0                	test   %eax,%eax
+  803659:	78 14                	js     80366f <dir_slot+0x3b>
+    *file = (struct File *)blk + slot % BLKFILES;
+  80365b:	83 e3 0f             	and    $0xf,%ebx
+  80365e:	48 c1 e3 08          	shl    $0x8,%rbx
+  803662:	48 03 5d e8          	add    -0x18(%rbp),%rbx
+  803666:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80366a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80366f:	48 83 c4 10          	add    $0x10,%rsp
+  803673:	5b                   	pop    %rbx
+  803674:	41 5c                	pop    %r12
+  803676:	5d                   	pop    %rbp
+  803677:	c3                   	ret
+
+0000000000803678 <file_read>:
+file_read(struct File *f, void *buf, size_t count, off_t offset) {
+  803678:	55                   	push   %rbp
+  803679:	48 89 e5             	mov    %rsp,%rbp
+  80367c:	41 57                	push   %r15
+  80367e:	41 56                	push   %r14
+  803680:	41 55                	push   %r13
+  803682:	41 54                	push   %r12
+  803684:	53                   	push   %rbx
+  803685:	48 83 ec 38          	sub    $0x38,%rsp
+  803689:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80368d:	41 89 cc             	mov    %ecx,%r12d
+    if (offset >= f->f_size)
+  803690:	8b 8f 80 00 00 00    	mov    0x80(%rdi),%ecx
+        return 0;
+  803696:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (offset >= f->f_size)
+  80369b:	44 39 e1             	cmp    %r12d,%ecx
+  80369e:	0f 8e e1 00 00 00    	jle    803785 <file_read+0x10d>
+  8036a4:	49 89 f5             	mov    %rsi,%r13
+    count = MIN(count, f->f_size - offset);
+  8036a7:	44 29 e1             	sub    %r12d,%ecx
+  8036aa:	48 63 c9             	movslq %ecx,%rcx
+  8036ad:	48 39 d1             	cmp    %rdx,%rcx
+  8036b0:	48 0f 46 d1          	cmovbe %rcx,%rdx
+  8036b4:	48 89 d3             	mov    %rdx,%rbx
+  8036b7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (file_inline(f)) {
+  8036bb:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  8036c2:	00 00 00 
+  8036c5:	ff d0                	call   *%rax
+  8036c7:	84 c0                	test   %al,%al
+  8036c9:	0f 85 c5 00 00 00    	jne    803794 <file_read+0x11c>
+    for (off_t pos = offset; pos < offset + count;) {
+  8036cf:	4d 63 f4             	movslq %r12d,%r14
+  8036d2:	4e 8d 3c 33          	lea    (%rbx,%r14,1),%r15
+        blockno_t nblk = CEILDIV(offset + count, BLKSIZE) - pos / BLKSIZE;
+  8036d6:	49 8d 87 ff 0f 00 00 	lea    0xfff(%r15),%rax
+  8036dd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8036e1:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+    for (off_t pos = offset; pos < offset + count;) {
+  8036e4:	4d 39 fe             	cmp    %r15,%r14
+  8036e7:	0f 83 94 00 00 00    	jae    803781 <file_read+0x109>
+        blockno_t nblk = CEILDIV(offset + count, BLKSIZE) - pos / BLKSIZE;
+  8036ed:	41 8d b4 24 ff 0f 00 	lea    0xfff(%r12),%esi
+  8036f4:	00 
+  8036f5:	45 85 e4             	test   %r12d,%r12d
+  8036f8:	41 0f 49 f4          	cmovns %r12d,%esi
+  8036fc:	c1 fe 0c             	sar    $0xc,%esi
+  8036ff:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  803702:	29 f0                	sub    %esi,%eax
+  803704:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+        int r = file_get_blocks(f, pos / BLKSIZE, &nblk, &blk);
+  803707:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  80370b:	48 8d 55 c4          	lea    -0x3c(%rbp),%rdx
+  80370f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803713:	48 b8 fa 33 80 00 00 	movabs $0x8033fa,%rax
+  80371a:	00 00 00 
+  80371d:	ff d0                	call   *%rax
+        if (r < 0) return r;
+  80371f:	85 c0                	test   %eax,%eax
+  803721:	0f 88 97 00 00 00    	js     8037be <file_read+0x146>
+        int bn = MIN(nblk * BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  803727:	44 89 e0             	mov    %r12d,%eax
+  80372a:	c1 f8 1f             	sar    $0x1f,%eax
+  80372d:	c1 e8 14             	shr    $0x14,%eax
+  803730:	41 8d 34 04          	lea    (%r12,%rax,1),%esi
+  803734:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80373a:	29 c6                	sub    %eax,%esi
+  80373c:	8b 5d c4             	mov    -0x3c(%rbp),%ebx
+  80373f:	48 c1 e3 0c          	shl    $0xc,%rbx
+  803743:	48 63 f6             	movslq %esi,%rsi
+  803746:	48 29 f3             	sub    %rsi,%rbx
+  803749:	4c 89 f8             	mov    %r15,%rax
+  80374c:	4c 29 f0             	sub    %r14,%rax
+  80374f:	48 39 c3             	cmp    %rax,%rbx
+  803752:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, blk + pos % BLKSIZE, bn);
+  803756:	4c 63 f3             	movslq %ebx,%r14
+  803759:	48 03 75 c8          	add    -0x38(%rbp),%rsi
+  80375d:	4c 89 f2             	mov    %r14,%rdx
+  803760:	4c 89 ef             	mov    %r13,%rdi
+  803763:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  80376a:	00 00 00 
+  80376d:	ff d0                	call   *%rax
+        pos += bn;
+  80376f:	41 01 dc             	add    %ebx,%r12d
+        buf += bn;
+  803772:	4d 01 f5             	add    %r14,%r13
+    for (off_t pos = offset; pos < offset + count;) {
+  803775:	4d 63 f4             	movslq %r12d,%r14
+  803778:	4d 39 fe             	cmp    %r15,%r14
+  80377b:	0f 82 6c ff ff ff    	jb     8036ed <file_read+0x75>
+    return count;
+  803781:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  803785:	48 83 c4 38          	add    $0x38,%rsp
+  803789:	5b                   	pop    %rbx
+  80378a:	41 5c                	pop    %r12
+  80378c:	41 5d                	pop    %r13
+  80378e:	41 5e                	pop    %r14
+  803790:	41 5f                	pop    %r15
+  803792:	5d                   	pop    %rbp
+  803793:	c3                   	ret
+        memmove(buf, f->f_inline + offset, count);
+  803794:	4d 63 e4             	movslq %r12d,%r12
+  803797:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80379b:	4a 8d b4 20 88 00 00 	lea    0x88(%rax,%r12,1),%rsi
+  8037a2:	00 
+  8037a3:	48 8b 5d a8          	mov    -0x58(%rbp),%rbx
+  8037a7:	48 89 da             	mov    %rbx,%rdx
+  8037aa:	4c 89 ef             	mov    %r13,%rdi
+  8037ad:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  8037b4:	00 00 00 
+  8037b7:	ff d0                	call   *%rax
+        return count;
+  8037b9:	48 89 d8             	mov    %rbx,%rax
+  8037bc:	eb c7                	jmp    803785 <file_read+0x10d>
+        if (r < 0) return r;
+  8037be:	48 98                	cltq
+  8037c0:	eb c3                	jmp    803785 <file_read+0x10d>
+
+00000000008037c2 <file_truncate_blocks>:
+file_truncate_blocks(struct File *f, off_t newsize) {
+  8037c2:	55                   	push   %rbp
+  8037c3:	48 89 e5             	mov    %rsp,%rbp
+  8037c6:	41 57                	push   %r15
+  8037c8:	41 56                	push   %r14
+  8037ca:	41 55                	push   %r13
+  8037cc:	41 54                	push   %r12
+  8037ce:	53                   	push   %rbx
+  8037cf:	48 83 ec 28          	sub    $0x28,%rsp
+  8037d3:	49 89 fd             	mov    %rdi,%r13
+  8037d6:	89 f3                	mov    %esi,%ebx
+    if (file_inline(f)) return;
+  8037d8:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  8037df:	00 00 00 
+  8037e2:	ff d0                	call   *%rax
+  8037e4:	84 c0                	test   %al,%al
+  8037e6:	75 64                	jne    80384c <file_truncate_blocks+0x8a>
+    blockno_t old_nblocks = CEILDIV(f->f_size, BLKSIZE);
+  8037e8:	41 8b 95 80 00 00 00 	mov    0x80(%r13),%edx
+    blockno_t new_nblocks = CEILDIV(newsize, BLKSIZE);
+  8037ef:	48 63 f3             	movslq %ebx,%rsi
+  8037f2:	48 81 c6 ff 0f 00 00 	add    $0xfff,%rsi
+  8037f9:	48 c1 ee 0c          	shr    $0xc,%rsi
+  8037fd:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803801:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    if (super->s_features & FS_FEATURE_EXTENTS) {
+  803804:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  80380b:	00 00 00 
+  80380e:	f6 80 08 01 00 00 01 	testb  $0x1,0x108(%rax)
+  803815:	75 44                	jne    80385b <file_truncate_blocks+0x99>
+    blockno_t old_nblocks = CEILDIV(f->f_size, BLKSIZE);
+  803817:	48 63 c2             	movslq %edx,%rax
+  80381a:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803820:	48 c1 e8 0c          	shr    $0xc,%rax
+  803824:	41 89 c7             	mov    %eax,%r15d
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  803827:	89 f3                	mov    %esi,%ebx
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  803829:	49 be 7b 2e 80 00 00 	movabs $0x802e7b,%r14
+  803830:	00 00 00 
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  803833:	39 c6                	cmp    %eax,%esi
+  803835:	0f 82 0a 01 00 00    	jb     803945 <file_truncate_blocks+0x183>
+    if (new_nblocks <= NDIRECT && f->f_indirect) {
+  80383b:	83 7d b0 0a          	cmpl   $0xa,-0x50(%rbp)
+  80383f:	77 0b                	ja     80384c <file_truncate_blocks+0x8a>
+  803841:	41 8b bd b0 00 00 00 	mov    0xb0(%r13),%edi
+  803848:	85 ff                	test   %edi,%edi
+  80384a:	75 26                	jne    803872 <file_truncate_blocks+0xb0>
+}
+  80384c:	48 83 c4 28          	add    $0x28,%rsp
+  803850:	5b                   	pop    %rbx
+  803851:	41 5c                	pop    %r12
+  803853:	41 5d                	pop    %r13
+  803855:	41 5e                	pop    %r14
+  803857:	41 5f                	pop    %r15
+  803859:	5d                   	pop    %rbp
+  80385a:	c3                   	ret
+        while (f->f_nextents) {
+  80385b:	41 8b b5 ac 00 00 00 	mov    0xac(%r13),%esi
+  803862:	85 f6                	test   %esi,%esi
+  803864:	74 e6                	je     80384c <file_truncate_blocks+0x8a>
+                free_block(ext->e_diskblock + i);
+  803866:	49 be 3c 25 80 00 00 	movabs $0x80253c,%r14
+  80386d:	00 00 00 
+  803870:	eb 67                	jmp    8038d9 <file_truncate_blocks+0x117>
+        free_block(f->f_indirect);
+  803872:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  803879:	00 00 00 
+  80387c:	ff d0                	call   *%rax
+        f->f_indirect = 0;
+  80387e:	41 c7 85 b0 00 00 00 	movl   $0x0,0xb0(%r13)
+  803885:	00 00 00 00 
+  803889:	eb c1                	jmp    80384c <file_truncate_blocks+0x8a>
+            blockno_t keep = ext->e_fileblock < new_nblocks ? new_nblocks - ext->e_fileblock : 0;
+  80388b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+            for (blockno_t i = keep; i < ext->e_len; i++)
+  803891:	85 d2                	test   %edx,%edx
+  803893:	74 1c                	je     8038b1 <file_truncate_blocks+0xef>
+            blockno_t keep = ext->e_fileblock < new_nblocks ? new_nblocks - ext->e_fileblock : 0;
+  803895:	44 89 fb             	mov    %r15d,%ebx
+                free_block(ext->e_diskblock + i);
+  803898:	89 df                	mov    %ebx,%edi
+  80389a:	41 03 7c 24 04       	add    0x4(%r12),%edi
+  80389f:	41 ff d6             	call   *%r14
+            for (blockno_t i = keep; i < ext->e_len; i++)
+  8038a2:	83 c3 01             	add    $0x1,%ebx
+  8038a5:	41 3b 5c 24 08       	cmp    0x8(%r12),%ebx
+  8038aa:	72 ec                	jb     803898 <file_truncate_blocks+0xd6>
+            if (keep) {
+  8038ac:	45 85 ff             	test   %r15d,%r15d
+  8038af:	75 61                	jne    803912 <file_truncate_blocks+0x150>
+            file_extent_remove(f, f->f_nextents - 1);
+  8038b1:	41 8b 85 ac 00 00 00 	mov    0xac(%r13),%eax
+  8038b8:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038bb:	4c 89 ef             	mov    %r13,%rdi
+  8038be:	48 b8 03 26 80 00 00 	movabs $0x802603,%rax
+  8038c5:	00 00 00 
+  8038c8:	ff d0                	call   *%rax
+        while (f->f_nextents) {
+  8038ca:	41 8b b5 ac 00 00 00 	mov    0xac(%r13),%esi
+  8038d1:	85 f6                	test   %esi,%esi
+  8038d3:	0f 84 73 ff ff ff    	je     80384c <file_truncate_blocks+0x8a>
+            struct Extent *ext = file_extent(f, f->f_nextents - 1);
+  8038d9:	83 ee 01             	sub    $0x1,%esi
+  8038dc:	4c 89 ef             	mov    %r13,%rdi
+  8038df:	48 b8 f9 22 80 00 00 	movabs $0x8022f9,%rax
+  8038e6:	00 00 00 
+  8038e9:	ff d0                	call   *%rax
+  8038eb:	49 89 c4             	mov    %rax,%r12
+            if (ext->e_fileblock + ext->e_len <= new_nblocks) break;
+  8038ee:	8b 00                	mov    (%rax),%eax
+  8038f0:	41 8b 54 24 08       	mov    0x8(%r12),%edx
+  8038f5:	8d 0c 10             	lea    (%rax,%rdx,1),%ecx
+  8038f8:	8b 75 bc             	mov    -0x44(%rbp),%esi
+  8038fb:	39 ce                	cmp    %ecx,%esi
+  8038fd:	0f 83 49 ff ff ff    	jae    80384c <file_truncate_blocks+0x8a>
+            blockno_t keep = ext->e_fileblock < new_nblocks ? new_nblocks - ext->e_fileblock : 0;
+  803903:	89 f1                	mov    %esi,%ecx
+  803905:	39 f0                	cmp    %esi,%eax
+  803907:	73 82                	jae    80388b <file_truncate_blocks+0xc9>
+  803909:	29 c1                	sub    %eax,%ecx
+  80390b:	41 89 cf             	mov    %ecx,%r15d
+            for (blockno_t i = keep; i < ext->e_len; i++)
+  80390e:	39 d1                	cmp    %edx,%ecx
+  803910:	72 83                	jb     803895 <file_truncate_blocks+0xd3>
+                ext->e_len = keep;
+  803912:	45 89 7c 24 08       	mov    %r15d,0x8(%r12)
+                break;
+  803917:	e9 30 ff ff ff       	jmp    80384c <file_truncate_blocks+0x8a>
+        if (res < 0) cprintf("warning: file_free_block: %i", res);
+  80391c:	89 c6                	mov    %eax,%esi
+  80391e:	48 bf 14 e4 80 00 00 	movabs $0x80e414,%rdi
+  803925:	00 00 00 
+  803928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392d:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  803934:	00 00 00 
+  803937:	ff d2                	call   *%rdx
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  803939:	83 c3 01             	add    $0x1,%ebx
+  80393c:	44 39 fb             	cmp    %r15d,%ebx
+  80393f:	0f 83 f6 fe ff ff    	jae    80383b <file_truncate_blocks+0x79>
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  803945:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80394a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80394e:	89 de                	mov    %ebx,%esi
+  803950:	4c 89 ef             	mov    %r13,%rdi
+  803953:	41 ff d6             	call   *%r14
+    if (res < 0) return res;
+  803956:	85 c0                	test   %eax,%eax
+  803958:	78 c2                	js     80391c <file_truncate_blocks+0x15a>
+    if (*ptr) {
+  80395a:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  80395e:	41 8b 3c 24          	mov    (%r12),%edi
+  803962:	85 ff                	test   %edi,%edi
+  803964:	74 d3                	je     803939 <file_truncate_blocks+0x177>
+        free_block(*ptr);
+  803966:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  80396d:	00 00 00 
+  803970:	ff d0                	call   *%rax
+        *ptr = 0;
+  803972:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803979:	00 
+  80397a:	eb bd                	jmp    803939 <file_truncate_blocks+0x177>
+
+000000000080397c <file_set_size>:
+
+/* Set the size of file f, truncating or extending as necessary.
+ * Data is moved between struct File and blocks when the file
+ * crosses FILE_INLINE_MAX. */
+int
+file_set_size(struct File *f, off_t newsize) {
+  80397c:	55                   	push   %rbp
+  80397d:	48 89 e5             	mov    %rsp,%rbp
+  803980:	41 57                	push   %r15
+  803982:	41 56                	push   %r14
+  803984:	41 55                	push   %r13
+  803986:	41 54                	push   %r12
+  803988:	53                   	push   %rbx
+  803989:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  803990:	48 89 fb             	mov    %rdi,%rbx
+  803993:	41 89 f4             	mov    %esi,%r12d
+    bool was_inline = file_inline(f);
+  803996:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  80399d:	00 00 00 
+  8039a0:	ff d0                	call   *%rax
+  8039a2:	89 c2                	mov    %eax,%edx
+           f->f_type == FTYPE_REG && size <= FILE_INLINE_MAX;
+  8039a4:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  8039ab:	00 00 00 
+  8039ae:	f6 80 08 01 00 00 04 	testb  $0x4,0x108(%rax)
+  8039b5:	0f 84 0b 02 00 00    	je     803bc6 <file_set_size+0x24a>
+    return super->s_features & FS_FEATURE_INLINE &&
+  8039bb:	83 bb 84 00 00 00 00 	cmpl   $0x0,0x84(%rbx)
+  8039c2:	0f 94 c0             	sete   %al
+           f->f_type == FTYPE_REG && size <= FILE_INLINE_MAX;
+  8039c5:	41 83 fc 70          	cmp    $0x70,%r12d
+  8039c9:	0f 9e c1             	setle  %cl
+    bool now_inline = fits_inline(f, newsize);
+
+    if (was_inline && !now_inline) {
+  8039cc:	20 c8                	and    %cl,%al
+  8039ce:	75 08                	jne    8039d8 <file_set_size+0x5c>
+  8039d0:	84 d2                	test   %dl,%dl
+  8039d2:	0f 85 f2 01 00 00    	jne    803bca <file_set_size+0x24e>
+        int res = file_uninline(f, newsize);
+        if (res < 0) return res;
+    } else if (now_inline && !was_inline) {
+  8039d8:	80 fa 01             	cmp    $0x1,%dl
+  8039db:	0f 84 4f 01 00 00    	je     803b30 <file_set_size+0x1b4>
+  8039e1:	84 c0                	test   %al,%al
+  8039e3:	0f 84 47 01 00 00    	je     803b30 <file_set_size+0x1b4>
+    uint8_t data[FILE_INLINE_MAX] = {0};
+  8039e9:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8039f0:	00 00 00 00 
+  8039f4:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8039fb:	00 00 00 00 
+  8039ff:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  803a06:	00 00 00 00 
+  803a0a:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  803a11:	00 00 00 00 
+  803a15:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  803a1c:	00 
+  803a1d:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  803a24:	00 
+  803a25:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  803a2c:	00 
+  803a2d:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  803a34:	00 
+  803a35:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  803a3c:	00 
+  803a3d:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  803a44:	00 
+  803a45:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803a4c:	00 
+  803a4d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803a54:	00 
+  803a55:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803a5c:	00 
+  803a5d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a64:	00 
+    if (newsize && !file_block_lookup(f, 0, &diskbno, &run) && diskbno)
+  803a65:	45 85 e4             	test   %r12d,%r12d
+  803a68:	75 64                	jne    803ace <file_set_size+0x152>
+    file_truncate_blocks(f, 0);
+  803a6a:	be 00 00 00 00       	mov    $0x0,%esi
+  803a6f:	48 89 df             	mov    %rbx,%rdi
+  803a72:	48 b8 c2 37 80 00 00 	movabs $0x8037c2,%rax
+  803a79:	00 00 00 
+  803a7c:	ff d0                	call   *%rax
+    memcpy(f->f_inline, data, sizeof(data));
+  803a7e:	48 8d bb 88 00 00 00 	lea    0x88(%rbx),%rdi
+  803a85:	ba 70 00 00 00       	mov    $0x70,%edx
+  803a8a:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  803a91:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  803a98:	00 00 00 
+  803a9b:	ff d0                	call   *%rax
+    f->f_size = newsize;
+  803a9d:	44 89 a3 80 00 00 00 	mov    %r12d,0x80(%rbx)
+}
+  803aa4:	e9 9d 00 00 00       	jmp    803b46 <file_set_size+0x1ca>
+        memcpy(f->f_inline, data, size);
+  803aa9:	4c 89 fa             	mov    %r15,%rdx
+  803aac:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  803ab3:	4c 89 f7             	mov    %r14,%rdi
+  803ab6:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  803abd:	00 00 00 
+  803ac0:	ff d0                	call   *%rax
+        f->f_size = size;
+  803ac2:	44 89 ab 80 00 00 00 	mov    %r13d,0x80(%rbx)
+        if (res < 0) return res;
+  803ac9:	e9 99 00 00 00       	jmp    803b67 <file_set_size+0x1eb>
+    if (newsize && !file_block_lookup(f, 0, &diskbno, &run) && diskbno)
+  803ace:	48 8d 8d 58 ff ff ff 	lea    -0xa8(%rbp),%rcx
+  803ad5:	48 8d 95 54 ff ff ff 	lea    -0xac(%rbp),%rdx
+  803adc:	be 00 00 00 00       	mov    $0x0,%esi
+  803ae1:	48 89 df             	mov    %rbx,%rdi
+  803ae4:	48 b8 50 32 80 00 00 	movabs $0x803250,%rax
+  803aeb:	00 00 00 
+  803aee:	ff d0                	call   *%rax
+  803af0:	85 c0                	test   %eax,%eax
+  803af2:	0f 85 72 ff ff ff    	jne    803a6a <file_set_size+0xee>
+  803af8:	8b bd 54 ff ff ff    	mov    -0xac(%rbp),%edi
+  803afe:	85 ff                	test   %edi,%edi
+  803b00:	0f 84 64 ff ff ff    	je     803a6a <file_set_size+0xee>
+        memcpy(data, diskaddr(diskbno), newsize);
+  803b06:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  803b0d:	00 00 00 
+  803b10:	ff d0                	call   *%rax
+  803b12:	48 89 c6             	mov    %rax,%rsi
+  803b15:	49 63 d4             	movslq %r12d,%rdx
+  803b18:	48 8d bd 60 ff ff ff 	lea    -0xa0(%rbp),%rdi
+  803b1f:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  803b26:	00 00 00 
+  803b29:	ff d0                	call   *%rax
+  803b2b:	e9 3a ff ff ff       	jmp    803a6a <file_set_size+0xee>
+        file_make_inline(f, newsize);
+    } else if (now_inline) {
+  803b30:	84 c0                	test   %al,%al
+  803b32:	74 6c                	je     803ba0 <file_set_size+0x224>
+        if (f->f_size > newsize)
+  803b34:	8b 93 80 00 00 00    	mov    0x80(%rbx),%edx
+  803b3a:	44 39 e2             	cmp    %r12d,%edx
+  803b3d:	7f 3d                	jg     803b7c <file_set_size+0x200>
+            memset(f->f_inline + newsize, 0, f->f_size - newsize);
+        f->f_size = newsize;
+  803b3f:	44 89 a3 80 00 00 00 	mov    %r12d,0x80(%rbx)
+    } else {
+        if (f->f_size > newsize)
+            file_truncate_blocks(f, newsize);
+        f->f_size = newsize;
+    }
+    flush_bitmap();
+  803b46:	48 b8 9c 2b 80 00 00 	movabs $0x802b9c,%rax
+  803b4d:	00 00 00 
+  803b50:	ff d0                	call   *%rax
+    flush_block(f);
+  803b52:	48 89 df             	mov    %rbx,%rdi
+  803b55:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  803b5c:	00 00 00 
+  803b5f:	ff d0                	call   *%rax
+    return 0;
+  803b61:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+}
+  803b67:	44 89 e0             	mov    %r12d,%eax
+  803b6a:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+  803b71:	5b                   	pop    %rbx
+  803b72:	41 5c                	pop    %r12
+  803b74:	41 5d                	pop    %r13
+  803b76:	41 5e                	pop    %r14
+  803b78:	41 5f                	pop    %r15
+  803b7a:	5d                   	pop    %rbp
+  803b7b:	c3                   	ret
+            memset(f->f_inline + newsize, 0, f->f_size - newsize);
+  803b7c:	44 29 e2             	sub    %r12d,%edx
+  803b7f:	48 63 d2             	movslq %edx,%rdx
+  803b82:	49 63 c4             	movslq %r12d,%rax
+  803b85:	48 8d bc 03 88 00 00 	lea    0x88(%rbx,%rax,1),%rdi
+  803b8c:	00 
+  803b8d:	be 00 00 00 00       	mov    $0x0,%esi
+  803b92:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  803b99:	00 00 00 
+  803b9c:	ff d0                	call   *%rax
+  803b9e:	eb 9f                	jmp    803b3f <file_set_size+0x1c3>
+        if (f->f_size > newsize)
+  803ba0:	44 39 a3 80 00 00 00 	cmp    %r12d,0x80(%rbx)
+  803ba7:	7f 09                	jg     803bb2 <file_set_size+0x236>
+        f->f_size = newsize;
+  803ba9:	44 89 a3 80 00 00 00 	mov    %r12d,0x80(%rbx)
+  803bb0:	eb 94                	jmp    803b46 <file_set_size+0x1ca>
+            file_truncate_blocks(f, newsize);
+  803bb2:	44 89 e6             	mov    %r12d,%esi
+  803bb5:	48 89 df             	mov    %rbx,%rdi
+  803bb8:	48 b8 c2 37 80 00 00 	movabs $0x8037c2,%rax
+  803bbf:	00 00 00 
+  803bc2:	ff d0                	call   *%rax
+  803bc4:	eb e3                	jmp    803ba9 <file_set_size+0x22d>
+    if (was_inline && !now_inline) {
+  803bc6:	84 d2                	test   %dl,%dl
+  803bc8:	74 d6                	je     803ba0 <file_set_size+0x224>
+    off_t size = f->f_size;
+  803bca:	44 8b ab 80 00 00 00 	mov    0x80(%rbx),%r13d
+    memcpy(data, f->f_inline, size);
+  803bd1:	4d 63 fd             	movslq %r13d,%r15
+  803bd4:	4c 8d b3 88 00 00 00 	lea    0x88(%rbx),%r14
+  803bdb:	4c 89 fa             	mov    %r15,%rdx
+  803bde:	4c 89 f6             	mov    %r14,%rsi
+  803be1:	48 8d bd 60 ff ff ff 	lea    -0xa0(%rbp),%rdi
+  803be8:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  803bef:	00 00 00 
+  803bf2:	ff d0                	call   *%rax
+    memset(f->f_inline, 0, sizeof(f->f_inline));
+  803bf4:	ba 70 00 00 00       	mov    $0x70,%edx
+  803bf9:	be 00 00 00 00       	mov    $0x0,%esi
+  803bfe:	4c 89 f7             	mov    %r14,%rdi
+  803c01:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  803c08:	00 00 00 
+  803c0b:	ff d0                	call   *%rax
+    f->f_size = newsize;
+  803c0d:	44 89 a3 80 00 00 00 	mov    %r12d,0x80(%rbx)
+    if (!size) return 0;
+  803c14:	45 85 ed             	test   %r13d,%r13d
+  803c17:	0f 84 29 ff ff ff    	je     803b46 <file_set_size+0x1ca>
+    int res = file_get_block(f, 0, &blk);
+  803c1d:	48 8d 95 58 ff ff ff 	lea    -0xa8(%rbp),%rdx
+  803c24:	be 00 00 00 00       	mov    $0x0,%esi
+  803c29:	48 89 df             	mov    %rbx,%rdi
+  803c2c:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  803c33:	00 00 00 
+  803c36:	ff d0                	call   *%rax
+  803c38:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  803c3b:	85 c0                	test   %eax,%eax
+  803c3d:	0f 88 66 fe ff ff    	js     803aa9 <file_set_size+0x12d>
+    memcpy(blk, data, size);
+  803c43:	4c 8b a5 58 ff ff ff 	mov    -0xa8(%rbp),%r12
+  803c4a:	4c 89 fa             	mov    %r15,%rdx
+  803c4d:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  803c54:	4c 89 e7             	mov    %r12,%rdi
+  803c57:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  803c5e:	00 00 00 
+  803c61:	ff d0                	call   *%rax
+    memset(blk + size, 0, BLKSIZE - size);
+  803c63:	4d 63 ed             	movslq %r13d,%r13
+  803c66:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c6b:	4c 29 ea             	sub    %r13,%rdx
+  803c6e:	4b 8d 3c 3c          	lea    (%r12,%r15,1),%rdi
+  803c72:	be 00 00 00 00       	mov    $0x0,%esi
+  803c77:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  803c7e:	00 00 00 
+  803c81:	ff d0                	call   *%rax
+    return 0;
+  803c83:	e9 be fe ff ff       	jmp    803b46 <file_set_size+0x1ca>
+
+0000000000803c88 <file_write>:
+file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+  803c88:	55                   	push   %rbp
+  803c89:	48 89 e5             	mov    %rsp,%rbp
+  803c8c:	41 57                	push   %r15
+  803c8e:	41 56                	push   %r14
+  803c90:	41 55                	push   %r13
+  803c92:	41 54                	push   %r12
+  803c94:	53                   	push   %rbx
+  803c95:	48 83 ec 58          	sub    $0x58,%rsp
+  803c99:	49 89 ff             	mov    %rdi,%r15
+  803c9c:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803ca0:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  803ca4:	89 4d a0             	mov    %ecx,-0x60(%rbp)
+    if (offset + count > f->f_size)
+  803ca7:	4c 63 e9             	movslq %ecx,%r13
+  803caa:	49 8d 44 15 00       	lea    0x0(%r13,%rdx,1),%rax
+  803caf:	48 89 c1             	mov    %rax,%rcx
+  803cb2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  803cb6:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  803cbd:	48 39 c8             	cmp    %rcx,%rax
+  803cc0:	72 4c                	jb     803d0e <file_write+0x86>
+    if (file_inline(f)) {
+  803cc2:	4c 89 ff             	mov    %r15,%rdi
+  803cc5:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  803ccc:	00 00 00 
+  803ccf:	ff d0                	call   *%rax
+  803cd1:	84 c0                	test   %al,%al
+  803cd3:	75 57                	jne    803d2c <file_write+0xa4>
+    if ((res = file_alloc_range(f, offset / BLKSIZE, CEILDIV(offset + count, BLKSIZE))) < 0) return res;
+  803cd5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803cd9:	48 8d 90 ff 0f 00 00 	lea    0xfff(%rax),%rdx
+  803ce0:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803ce4:	89 55 9c             	mov    %edx,-0x64(%rbp)
+  803ce7:	8b 4d a0             	mov    -0x60(%rbp),%ecx
+  803cea:	8d 81 ff 0f 00 00    	lea    0xfff(%rcx),%eax
+  803cf0:	85 c9                	test   %ecx,%ecx
+  803cf2:	0f 49 c1             	cmovns %ecx,%eax
+  803cf5:	c1 f8 0c             	sar    $0xc,%eax
+  803cf8:	89 c3                	mov    %eax,%ebx
+    for (blockno_t bno = start; bno < end;) {
+  803cfa:	39 d0                	cmp    %edx,%eax
+  803cfc:	0f 83 88 01 00 00    	jae    803e8a <file_write+0x202>
+        if ((res = file_set_blocks(f, bno, first, len)) < 0) {
+  803d02:	4c 89 6d 90          	mov    %r13,-0x70(%rbp)
+  803d06:	41 89 d5             	mov    %edx,%r13d
+  803d09:	e9 a6 00 00 00       	jmp    803db4 <file_write+0x12c>
+        if ((res = file_set_size(f, offset + count)) < 0) return res;
+  803d0e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  803d11:	8b 4d 88             	mov    -0x78(%rbp),%ecx
+  803d14:	8d 34 08             	lea    (%rax,%rcx,1),%esi
+  803d17:	48 b8 7c 39 80 00 00 	movabs $0x80397c,%rax
+  803d1e:	00 00 00 
+  803d21:	ff d0                	call   *%rax
+  803d23:	48 63 d0             	movslq %eax,%rdx
+  803d26:	85 c0                	test   %eax,%eax
+  803d28:	79 98                	jns    803cc2 <file_write+0x3a>
+  803d2a:	eb 22                	jmp    803d4e <file_write+0xc6>
+        memmove(f->f_inline + offset, buf, count);
+  803d2c:	4b 8d bc 2f 88 00 00 	lea    0x88(%r15,%r13,1),%rdi
+  803d33:	00 
+  803d34:	48 8b 5d 88          	mov    -0x78(%rbp),%rbx
+  803d38:	48 89 da             	mov    %rbx,%rdx
+  803d3b:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  803d3f:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  803d46:	00 00 00 
+  803d49:	ff d0                	call   *%rax
+        return count;
+  803d4b:	48 89 da             	mov    %rbx,%rdx
+}
+  803d4e:	48 89 d0             	mov    %rdx,%rax
+  803d51:	48 83 c4 58          	add    $0x58,%rsp
+  803d55:	5b                   	pop    %rbx
+  803d56:	41 5c                	pop    %r12
+  803d58:	41 5d                	pop    %r13
+  803d5a:	41 5e                	pop    %r14
+  803d5c:	41 5f                	pop    %r15
+  803d5e:	5d                   	pop    %rbp
+  803d5f:	c3                   	ret
+            bno += run;
+  803d60:	44 01 e3             	add    %r12d,%ebx
+            continue;
+  803d63:	eb 46                	jmp    803dab <file_write+0x123>
+        blockno_t first = alloc_extent(goal, run, &len);
+  803d65:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803d69:	44 89 e6             	mov    %r12d,%esi
+  803d6c:	44 89 f7             	mov    %r14d,%edi
+  803d6f:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  803d76:	00 00 00 
+  803d79:	ff d0                	call   *%rax
+  803d7b:	41 89 c4             	mov    %eax,%r12d
+        if (!first) return -E_NO_DISK;
+  803d7e:	85 c0                	test   %eax,%eax
+  803d80:	0f 84 ea 00 00 00    	je     803e70 <file_write+0x1e8>
+        if ((res = file_set_blocks(f, bno, first, len)) < 0) {
+  803d86:	44 8b 75 c8          	mov    -0x38(%rbp),%r14d
+  803d8a:	44 89 f1             	mov    %r14d,%ecx
+  803d8d:	89 c2                	mov    %eax,%edx
+  803d8f:	89 de                	mov    %ebx,%esi
+  803d91:	4c 89 ff             	mov    %r15,%rdi
+  803d94:	48 b8 a6 2f 80 00 00 	movabs $0x802fa6,%rax
+  803d9b:	00 00 00 
+  803d9e:	ff d0                	call   *%rax
+  803da0:	85 c0                	test   %eax,%eax
+  803da2:	0f 88 93 00 00 00    	js     803e3b <file_write+0x1b3>
+        bno += len;
+  803da8:	44 01 f3             	add    %r14d,%ebx
+    for (blockno_t bno = start; bno < end;) {
+  803dab:	44 39 eb             	cmp    %r13d,%ebx
+  803dae:	0f 83 9e 01 00 00    	jae    803f52 <file_write+0x2ca>
+        if ((res = file_block_lookup(f, bno, &diskbno, &run)) < 0) return res;
+  803db4:	48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+  803db8:	48 8d 55 bc          	lea    -0x44(%rbp),%rdx
+  803dbc:	89 de                	mov    %ebx,%esi
+  803dbe:	4c 89 ff             	mov    %r15,%rdi
+  803dc1:	48 b8 50 32 80 00 00 	movabs $0x803250,%rax
+  803dc8:	00 00 00 
+  803dcb:	ff d0                	call   *%rax
+  803dcd:	85 c0                	test   %eax,%eax
+  803dcf:	0f 88 a6 00 00 00    	js     803e7b <file_write+0x1f3>
+        run = MIN(run, end - bno);
+  803dd5:	45 89 ec             	mov    %r13d,%r12d
+  803dd8:	41 29 dc             	sub    %ebx,%r12d
+  803ddb:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803dde:	41 39 c4             	cmp    %eax,%r12d
+  803de1:	44 0f 47 e0          	cmova  %eax,%r12d
+  803de5:	44 89 65 c0          	mov    %r12d,-0x40(%rbp)
+        if (diskbno) {
+  803de9:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  803ded:	0f 85 6d ff ff ff    	jne    803d60 <file_write+0xd8>
+        blockno_t goal = alloc_cursor, prev, len;
+  803df3:	48 b8 80 ba 8a 00 00 	movabs $0x8aba80,%rax
+  803dfa:	00 00 00 
+  803dfd:	44 8b 30             	mov    (%rax),%r14d
+        if (bno && !file_block_lookup(f, bno - 1, &prev, &len) && prev)
+  803e00:	85 db                	test   %ebx,%ebx
+  803e02:	0f 84 5d ff ff ff    	je     803d65 <file_write+0xdd>
+  803e08:	8d 73 ff             	lea    -0x1(%rbx),%esi
+  803e0b:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  803e0f:	48 8d 55 c4          	lea    -0x3c(%rbp),%rdx
+  803e13:	4c 89 ff             	mov    %r15,%rdi
+  803e16:	48 b8 50 32 80 00 00 	movabs $0x803250,%rax
+  803e1d:	00 00 00 
+  803e20:	ff d0                	call   *%rax
+  803e22:	85 c0                	test   %eax,%eax
+  803e24:	0f 85 3b ff ff ff    	jne    803d65 <file_write+0xdd>
+  803e2a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+            goal = prev + 1;
+  803e2d:	8d 50 01             	lea    0x1(%rax),%edx
+  803e30:	85 c0                	test   %eax,%eax
+  803e32:	44 0f 45 f2          	cmovne %edx,%r14d
+  803e36:	e9 2a ff ff ff       	jmp    803d65 <file_write+0xdd>
+            while (len--) free_block(first + len);
+  803e3b:	4c 8b 6d 90          	mov    -0x70(%rbp),%r13
+  803e3f:	41 8d 56 ff          	lea    -0x1(%r14),%edx
+  803e43:	89 55 c8             	mov    %edx,-0x38(%rbp)
+  803e46:	45 85 f6             	test   %r14d,%r14d
+  803e49:	74 34                	je     803e7f <file_write+0x1f7>
+  803e4b:	48 bb 3c 25 80 00 00 	movabs $0x80253c,%rbx
+  803e52:	00 00 00 
+  803e55:	41 89 c6             	mov    %eax,%r14d
+  803e58:	41 8d 3c 14          	lea    (%r12,%rdx,1),%edi
+  803e5c:	ff d3                	call   *%rbx
+  803e5e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803e61:	8d 50 ff             	lea    -0x1(%rax),%edx
+  803e64:	89 55 c8             	mov    %edx,-0x38(%rbp)
+  803e67:	85 c0                	test   %eax,%eax
+  803e69:	75 ed                	jne    803e58 <file_write+0x1d0>
+  803e6b:	44 89 f0             	mov    %r14d,%eax
+  803e6e:	eb 0f                	jmp    803e7f <file_write+0x1f7>
+        if (!first) return -E_NO_DISK;
+  803e70:	4c 8b 6d 90          	mov    -0x70(%rbp),%r13
+  803e74:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803e79:	eb 04                	jmp    803e7f <file_write+0x1f7>
+  803e7b:	4c 8b 6d 90          	mov    -0x70(%rbp),%r13
+    if ((res = file_alloc_range(f, offset / BLKSIZE, CEILDIV(offset + count, BLKSIZE))) < 0) return res;
+  803e7f:	48 63 d0             	movslq %eax,%rdx
+  803e82:	85 c0                	test   %eax,%eax
+  803e84:	0f 88 c4 fe ff ff    	js     803d4e <file_write+0xc6>
+        if ((res = file_get_blocks(f, pos / BLKSIZE, &nblk, &blk)) < 0) return res;
+  803e8a:	49 be fa 33 80 00 00 	movabs $0x8033fa,%r14
+  803e91:	00 00 00 
+        memmove(blk + pos % BLKSIZE, buf, bn);
+  803e94:	49 bc 3b 9e 80 00 00 	movabs $0x809e3b,%r12
+  803e9b:	00 00 00 
+    for (off_t pos = offset; pos < offset + count;) {
+  803e9e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803ea2:	49 39 c5             	cmp    %rax,%r13
+  803ea5:	0f 83 9e 00 00 00    	jae    803f49 <file_write+0x2c1>
+  803eab:	4c 89 eb             	mov    %r13,%rbx
+  803eae:	4c 89 7d 90          	mov    %r15,-0x70(%rbp)
+  803eb2:	4c 8b 6d 80          	mov    -0x80(%rbp),%r13
+  803eb6:	44 8b 7d a0          	mov    -0x60(%rbp),%r15d
+        blockno_t nblk = CEILDIV(offset + count, BLKSIZE) - pos / BLKSIZE;
+  803eba:	41 8d b7 ff 0f 00 00 	lea    0xfff(%r15),%esi
+  803ec1:	45 85 ff             	test   %r15d,%r15d
+  803ec4:	41 0f 49 f7          	cmovns %r15d,%esi
+  803ec8:	c1 fe 0c             	sar    $0xc,%esi
+  803ecb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  803ece:	29 f0                	sub    %esi,%eax
+  803ed0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+        if ((res = file_get_blocks(f, pos / BLKSIZE, &nblk, &blk)) < 0) return res;
+  803ed3:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  803ed7:	48 8d 55 c4          	lea    -0x3c(%rbp),%rdx
+  803edb:	48 8b 7d 90          	mov    -0x70(%rbp),%rdi
+  803edf:	41 ff d6             	call   *%r14
+  803ee2:	85 c0                	test   %eax,%eax
+  803ee4:	78 75                	js     803f5b <file_write+0x2d3>
+        blockno_t bn = MIN(nblk * BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  803ee6:	44 89 f8             	mov    %r15d,%eax
+  803ee9:	c1 f8 1f             	sar    $0x1f,%eax
+  803eec:	c1 e8 14             	shr    $0x14,%eax
+  803eef:	41 8d 3c 07          	lea    (%r15,%rax,1),%edi
+  803ef3:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  803ef9:	29 c7                	sub    %eax,%edi
+  803efb:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803efe:	48 c1 e0 0c          	shl    $0xc,%rax
+  803f02:	48 63 ff             	movslq %edi,%rdi
+  803f05:	48 29 f8             	sub    %rdi,%rax
+  803f08:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803f0c:	48 29 da             	sub    %rbx,%rdx
+  803f0f:	48 39 d0             	cmp    %rdx,%rax
+  803f12:	48 89 d3             	mov    %rdx,%rbx
+  803f15:	48 0f 46 d8          	cmovbe %rax,%rbx
+        memmove(blk + pos % BLKSIZE, buf, bn);
+  803f19:	89 d8                	mov    %ebx,%eax
+  803f1b:	48 03 7d c8          	add    -0x38(%rbp),%rdi
+  803f1f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803f23:	48 89 c2             	mov    %rax,%rdx
+  803f26:	4c 89 ee             	mov    %r13,%rsi
+  803f29:	41 ff d4             	call   *%r12
+        pos += bn;
+  803f2c:	44 01 fb             	add    %r15d,%ebx
+  803f2f:	41 89 df             	mov    %ebx,%r15d
+        buf += bn;
+  803f32:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803f36:	49 01 c5             	add    %rax,%r13
+    for (off_t pos = offset; pos < offset + count;) {
+  803f39:	48 63 db             	movslq %ebx,%rbx
+  803f3c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803f40:	48 39 d3             	cmp    %rdx,%rbx
+  803f43:	0f 82 71 ff ff ff    	jb     803eba <file_write+0x232>
+    return count;
+  803f49:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803f4d:	e9 fc fd ff ff       	jmp    803d4e <file_write+0xc6>
+  803f52:	4c 8b 6d 90          	mov    -0x70(%rbp),%r13
+  803f56:	e9 2f ff ff ff       	jmp    803e8a <file_write+0x202>
+        if ((res = file_get_blocks(f, pos / BLKSIZE, &nblk, &blk)) < 0) return res;
+  803f5b:	48 63 d0             	movslq %eax,%rdx
+  803f5e:	e9 eb fd ff ff       	jmp    803d4e <file_write+0xc6>
+
+0000000000803f63 <file_flush>:
+/* Flush the contents and metadata of file f out to disk.
+ * Loop over all the blocks in file.
+ * Translate the file block number into a disk block number
+ * and then check whether that disk block is dirty.  If so, write it out. */
+void
+file_flush(struct File *f) {
+  803f63:	55                   	push   %rbp
+  803f64:	48 89 e5             	mov    %rsp,%rbp
+  803f67:	41 57                	push   %r15
+  803f69:	41 56                	push   %r14
+  803f6b:	41 55                	push   %r13
+  803f6d:	41 54                	push   %r12
+  803f6f:	53                   	push   %rbx
+  803f70:	48 83 ec 18          	sub    $0x18,%rsp
+  803f74:	49 89 fd             	mov    %rdi,%r13
+    blockno_t nblocks = CEILDIV(f->f_size, BLKSIZE), diskbno, run;
+  803f77:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  803f7e:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  803f84:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f88:	48 89 c3             	mov    %rax,%rbx
+  803f8b:	41 89 c6             	mov    %eax,%r14d
+
+    flush_bitmap();
+  803f8e:	48 b8 9c 2b 80 00 00 	movabs $0x802b9c,%rax
+  803f95:	00 00 00 
+  803f98:	ff d0                	call   *%rax
+    if (file_inline(f)) {
+  803f9a:	4c 89 ef             	mov    %r13,%rdi
+  803f9d:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  803fa4:	00 00 00 
+  803fa7:	ff d0                	call   *%rax
+  803fa9:	84 c0                	test   %al,%al
+  803fab:	75 66                	jne    804013 <file_flush+0xb0>
+        flush_block(f);
+        return;
+    }
+
+    for (blockno_t i = 0; i < nblocks; i += run) {
+  803fad:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        if (file_block_lookup(f, i, &diskbno, &run) < 0) break;
+  803fb3:	49 bf 50 32 80 00 00 	movabs $0x803250,%r15
+  803fba:	00 00 00 
+    for (blockno_t i = 0; i < nblocks; i += run) {
+  803fbd:	85 db                	test   %ebx,%ebx
+  803fbf:	75 6b                	jne    80402c <file_flush+0xc9>
+        run = MIN(run, nblocks - i);
+        if (diskbno) flush_blocks(diskbno, run);
+    }
+    if (super->s_features & FS_FEATURE_EXTENTS) {
+  803fc1:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  803fc8:	00 00 00 
+  803fcb:	f6 80 08 01 00 00 01 	testb  $0x1,0x108(%rax)
+  803fd2:	0f 84 b1 00 00 00    	je     804089 <file_flush+0x126>
+        if (f->f_extblock)
+  803fd8:	41 8b bd b0 00 00 00 	mov    0xb0(%r13),%edi
+  803fdf:	85 ff                	test   %edi,%edi
+  803fe1:	0f 85 82 00 00 00    	jne    804069 <file_flush+0x106>
+            flush_block(diskaddr(f->f_extblock));
+    } else if (f->f_indirect)
+        flush_block(diskaddr(f->f_indirect));
+    if (f->f_type == FTYPE_DIR && f->f_dirindex)
+  803fe7:	41 83 bd 84 00 00 00 	cmpl   $0x1,0x84(%r13)
+  803fee:	01 
+  803fef:	0f 84 c3 00 00 00    	je     8040b8 <file_flush+0x155>
+        flush_block(diskaddr(f->f_dirindex));
+    flush_block(f);
+  803ff5:	4c 89 ef             	mov    %r13,%rdi
+  803ff8:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  803fff:	00 00 00 
+  804002:	ff d0                	call   *%rax
+}
+  804004:	48 83 c4 18          	add    $0x18,%rsp
+  804008:	5b                   	pop    %rbx
+  804009:	41 5c                	pop    %r12
+  80400b:	41 5d                	pop    %r13
+  80400d:	41 5e                	pop    %r14
+  80400f:	41 5f                	pop    %r15
+  804011:	5d                   	pop    %rbp
+  804012:	c3                   	ret
+        flush_block(f);
+  804013:	4c 89 ef             	mov    %r13,%rdi
+  804016:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  80401d:	00 00 00 
+  804020:	ff d0                	call   *%rax
+        return;
+  804022:	eb e0                	jmp    804004 <file_flush+0xa1>
+    for (blockno_t i = 0; i < nblocks; i += run) {
+  804024:	41 01 dc             	add    %ebx,%r12d
+  804027:	45 39 f4             	cmp    %r14d,%r12d
+  80402a:	73 95                	jae    803fc1 <file_flush+0x5e>
+        if (file_block_lookup(f, i, &diskbno, &run) < 0) break;
+  80402c:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  804030:	48 8d 55 cc          	lea    -0x34(%rbp),%rdx
+  804034:	44 89 e6             	mov    %r12d,%esi
+  804037:	4c 89 ef             	mov    %r13,%rdi
+  80403a:	41 ff d7             	call   *%r15
+  80403d:	85 c0                	test   %eax,%eax
+  80403f:	78 80                	js     803fc1 <file_flush+0x5e>
+        run = MIN(run, nblocks - i);
+  804041:	44 89 f3             	mov    %r14d,%ebx
+  804044:	44 29 e3             	sub    %r12d,%ebx
+  804047:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80404a:	39 c3                	cmp    %eax,%ebx
+  80404c:	0f 47 d8             	cmova  %eax,%ebx
+  80404f:	89 5d c8             	mov    %ebx,-0x38(%rbp)
+        if (diskbno) flush_blocks(diskbno, run);
+  804052:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  804055:	85 ff                	test   %edi,%edi
+  804057:	74 cb                	je     804024 <file_flush+0xc1>
+  804059:	89 de                	mov    %ebx,%esi
+  80405b:	48 b8 d3 0f 80 00 00 	movabs $0x800fd3,%rax
+  804062:	00 00 00 
+  804065:	ff d0                	call   *%rax
+  804067:	eb bb                	jmp    804024 <file_flush+0xc1>
+            flush_block(diskaddr(f->f_extblock));
+  804069:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  804070:	00 00 00 
+  804073:	ff d0                	call   *%rax
+  804075:	48 89 c7             	mov    %rax,%rdi
+  804078:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  80407f:	00 00 00 
+  804082:	ff d0                	call   *%rax
+  804084:	e9 5e ff ff ff       	jmp    803fe7 <file_flush+0x84>
+    } else if (f->f_indirect)
+  804089:	41 8b bd b0 00 00 00 	mov    0xb0(%r13),%edi
+  804090:	85 ff                	test   %edi,%edi
+  804092:	0f 84 4f ff ff ff    	je     803fe7 <file_flush+0x84>
+        flush_block(diskaddr(f->f_indirect));
+  804098:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  80409f:	00 00 00 
+  8040a2:	ff d0                	call   *%rax
+  8040a4:	48 89 c7             	mov    %rax,%rdi
+  8040a7:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  8040ae:	00 00 00 
+  8040b1:	ff d0                	call   *%rax
+  8040b3:	e9 2f ff ff ff       	jmp    803fe7 <file_flush+0x84>
+    if (f->f_type == FTYPE_DIR && f->f_dirindex)
+  8040b8:	41 8b bd f8 00 00 00 	mov    0xf8(%r13),%edi
+  8040bf:	85 ff                	test   %edi,%edi
+  8040c1:	0f 84 2e ff ff ff    	je     803ff5 <file_flush+0x92>
+        flush_block(diskaddr(f->f_dirindex));
+  8040c7:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  8040ce:	00 00 00 
+  8040d1:	ff d0                	call   *%rax
+  8040d3:	48 89 c7             	mov    %rax,%rdi
+  8040d6:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  8040dd:	00 00 00 
+  8040e0:	ff d0                	call   *%rax
+  8040e2:	e9 0e ff ff ff       	jmp    803ff5 <file_flush+0x92>
+
+00000000008040e7 <walk_path>:
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
+  8040e7:	55                   	push   %rbp
+  8040e8:	48 89 e5             	mov    %rsp,%rbp
+  8040eb:	41 57                	push   %r15
+  8040ed:	41 56                	push   %r14
+  8040ef:	41 55                	push   %r13
+  8040f1:	41 54                	push   %r12
+  8040f3:	53                   	push   %rbx
+  8040f4:	48 81 ec d8 00 00 00 	sub    $0xd8,%rsp
+  8040fb:	49 89 d4             	mov    %rdx,%r12
+  8040fe:	49 89 cd             	mov    %rcx,%r13
+    while (*p == '/')
+  804101:	80 3f 2f             	cmpb   $0x2f,(%rdi)
+  804104:	75 09                	jne    80410f <walk_path+0x28>
+        p++;
+  804106:	48 83 c7 01          	add    $0x1,%rdi
+    while (*p == '/')
+  80410a:	80 3f 2f             	cmpb   $0x2f,(%rdi)
+  80410d:	74 f7                	je     804106 <walk_path+0x1f>
+    f = &super->s_root;
+  80410f:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  804116:	00 00 00 
+  804119:	48 83 c0 08          	add    $0x8,%rax
+  80411d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+    name[0] = 0;
+  804124:	c6 85 50 ff ff ff 00 	movb   $0x0,-0xb0(%rbp)
+    if (pdir)
+  80412b:	48 85 f6             	test   %rsi,%rsi
+  80412e:	74 07                	je     804137 <walk_path+0x50>
+        *pdir = 0;
+  804130:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *pf = 0;
+  804137:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80413e:	00 
+    dir = 0;
+  80413f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (strcmp(f[j].f_name, name) == 0) {
+  804145:	49 bf 51 9b 80 00 00 	movabs $0x809b51,%r15
+  80414c:	00 00 00 
+  80414f:	48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+  804156:	48 89 fe             	mov    %rdi,%rsi
+  804159:	4c 89 a5 08 ff ff ff 	mov    %r12,-0xf8(%rbp)
+  804160:	4c 89 ad 00 ff ff ff 	mov    %r13,-0x100(%rbp)
+    while (*path != '\0') {
+  804167:	e9 a4 02 00 00       	jmp    804410 <walk_path+0x329>
+        while (*path != '/' && *path != '\0')
+  80416c:	48 89 b5 28 ff ff ff 	mov    %rsi,-0xd8(%rbp)
+        if (path - p >= MAXNAMELEN)
+  804173:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804178:	e9 d7 02 00 00       	jmp    804454 <walk_path+0x36d>
+    if (d->d_dir == dir && !strcmp(d->d_name, name)) {
+  80417d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  804181:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  804188:	41 ff d7             	call   *%r15
+  80418b:	85 c0                	test   %eax,%eax
+  80418d:	0f 85 2f 03 00 00    	jne    8044c2 <walk_path+0x3db>
+        *file = d->d_file;
+  804193:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80419a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80419e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+        return 0;
+  8041a5:	e9 5f 02 00 00       	jmp    804409 <walk_path+0x322>
+    assert((dir->f_size % BLKSIZE) == 0);
+  8041aa:	48 b9 31 e4 80 00 00 	movabs $0x80e431,%rcx
+  8041b1:	00 00 00 
+  8041b4:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  8041bb:	00 00 00 
+  8041be:	be 79 02 00 00       	mov    $0x279,%esi
+  8041c3:	48 bf 7a e3 80 00 00 	movabs $0x80e37a,%rdi
+  8041ca:	00 00 00 
+  8041cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d2:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8041d9:	00 00 00 
+  8041dc:	41 ff d0             	call   *%r8
+    for (blockno_t i = 0; i < nblock;) {
+  8041df:	bb 00 00 00 00       	mov    $0x0,%ebx
+        int res = file_get_blocks(dir, i, &n, &blk);
+  8041e4:	49 bd fa 33 80 00 00 	movabs $0x8033fa,%r13
+  8041eb:	00 00 00 
+  8041ee:	41 89 c4             	mov    %eax,%r12d
+        blockno_t n = nblock - i;
+  8041f1:	44 89 e0             	mov    %r12d,%eax
+  8041f4:	29 d8                	sub    %ebx,%eax
+  8041f6:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+        int res = file_get_blocks(dir, i, &n, &blk);
+  8041fc:	48 8d 8d 40 ff ff ff 	lea    -0xc0(%rbp),%rcx
+  804203:	48 8d 95 3c ff ff ff 	lea    -0xc4(%rbp),%rdx
+  80420a:	89 de                	mov    %ebx,%esi
+  80420c:	4c 89 f7             	mov    %r14,%rdi
+  80420f:	41 ff d5             	call   *%r13
+        if (res < 0) return res;
+  804212:	85 c0                	test   %eax,%eax
+  804214:	0f 88 5f 01 00 00    	js     804379 <walk_path+0x292>
+        i += n;
+  80421a:	89 d8                	mov    %ebx,%eax
+  80421c:	03 85 3c ff ff ff    	add    -0xc4(%rbp),%eax
+  804222:	89 c3                	mov    %eax,%ebx
+    for (blockno_t i = 0; i < nblock;) {
+  804224:	44 39 e0             	cmp    %r12d,%eax
+  804227:	72 c8                	jb     8041f1 <walk_path+0x10a>
+    blockno_t index = alloc_block();
+  804229:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  804230:	00 00 00 
+  804233:	ff d0                	call   *%rax
+  804235:	41 89 c4             	mov    %eax,%r12d
+    if (!index) return -E_NO_DISK;
+  804238:	85 c0                	test   %eax,%eax
+  80423a:	0f 84 39 01 00 00    	je     804379 <walk_path+0x292>
+    void *blk = bc_get(index, BC_NOREAD | BC_META);
+  804240:	be 06 00 00 00       	mov    $0x6,%esi
+  804245:	89 c7                	mov    %eax,%edi
+  804247:	48 b8 ee 1a 80 00 00 	movabs $0x801aee,%rax
+  80424e:	00 00 00 
+  804251:	ff d0                	call   *%rax
+  804253:	48 89 c3             	mov    %rax,%rbx
+    memset(blk, 0, BLKSIZE);
+  804256:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80425b:	be 00 00 00 00       	mov    $0x0,%esi
+  804260:	48 89 c7             	mov    %rax,%rdi
+  804263:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  80426a:	00 00 00 
+  80426d:	ff d0                	call   *%rax
+    bc_put(blk);
+  80426f:	48 89 df             	mov    %rbx,%rdi
+  804272:	48 b8 79 0c 80 00 00 	movabs $0x800c79,%rax
+  804279:	00 00 00 
+  80427c:	ff d0                	call   *%rax
+    dir->f_dirindex = index;
+  80427e:	45 89 a6 f8 00 00 00 	mov    %r12d,0xf8(%r14)
+    for (uint32_t slot = 0; slot < dir->f_size / BLKSIZE * BLKFILES; slot++) {
+  804285:	41 8b 96 80 00 00 00 	mov    0x80(%r14),%edx
+  80428c:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  804292:	85 d2                	test   %edx,%edx
+  804294:	0f 49 c2             	cmovns %edx,%eax
+  804297:	c1 f8 0c             	sar    $0xc,%eax
+  80429a:	48 98                	cltq
+  80429c:	48 c1 e0 04          	shl    $0x4,%rax
+  8042a0:	0f 84 c4 00 00 00    	je     80436a <walk_path+0x283>
+  8042a6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        int res = dir_slot(dir, slot, &f);
+  8042ac:	48 bb 34 36 80 00 00 	movabs $0x803634,%rbx
+  8042b3:	00 00 00 
+    uint32_t *head = dir_bucket(dir, file->f_name);
+  8042b6:	44 89 a5 20 ff ff ff 	mov    %r12d,-0xe0(%rbp)
+  8042bd:	eb 4d                	jmp    80430c <walk_path+0x225>
+            dir->f_dirindex = 0;
+  8042bf:	44 8b a5 20 ff ff ff 	mov    -0xe0(%rbp),%r12d
+  8042c6:	41 c7 86 f8 00 00 00 	movl   $0x0,0xf8(%r14)
+  8042cd:	00 00 00 00 
+            free_block(index);
+  8042d1:	44 89 e7             	mov    %r12d,%edi
+  8042d4:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  8042db:	00 00 00 
+  8042de:	ff d0                	call   *%rax
+            return res;
+  8042e0:	e9 94 00 00 00       	jmp    804379 <walk_path+0x292>
+    for (uint32_t slot = 0; slot < dir->f_size / BLKSIZE * BLKFILES; slot++) {
+  8042e5:	41 83 c5 01          	add    $0x1,%r13d
+  8042e9:	44 89 e9             	mov    %r13d,%ecx
+  8042ec:	41 8b 96 80 00 00 00 	mov    0x80(%r14),%edx
+  8042f3:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  8042f9:	85 d2                	test   %edx,%edx
+  8042fb:	0f 49 c2             	cmovns %edx,%eax
+  8042fe:	c1 f8 0c             	sar    $0xc,%eax
+  804301:	48 98                	cltq
+  804303:	48 c1 e0 04          	shl    $0x4,%rax
+  804307:	48 39 c1             	cmp    %rax,%rcx
+  80430a:	73 5e                	jae    80436a <walk_path+0x283>
+        int res = dir_slot(dir, slot, &f);
+  80430c:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  804313:	44 89 ee             	mov    %r13d,%esi
+  804316:	4c 89 f7             	mov    %r14,%rdi
+  804319:	ff d3                	call   *%rbx
+        if (res < 0) {
+  80431b:	85 c0                	test   %eax,%eax
+  80431d:	78 a0                	js     8042bf <walk_path+0x1d8>
+        f->f_hashnext = 0;
+  80431f:	4c 8b a5 40 ff ff ff 	mov    -0xc0(%rbp),%r12
+  804326:	41 c7 84 24 fc 00 00 	movl   $0x0,0xfc(%r12)
+  80432d:	00 00 00 00 00 
+        if (f->f_name[0]) dir_index_add(dir, f, slot);
+  804332:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  804337:	74 ac                	je     8042e5 <walk_path+0x1fe>
+    if (!dir->f_dirindex) return;
+  804339:	41 83 be f8 00 00 00 	cmpl   $0x0,0xf8(%r14)
+  804340:	00 
+  804341:	74 a2                	je     8042e5 <walk_path+0x1fe>
+    uint32_t *head = dir_bucket(dir, file->f_name);
+  804343:	4c 89 e6             	mov    %r12,%rsi
+  804346:	4c 89 f7             	mov    %r14,%rdi
+  804349:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  804350:	00 00 00 
+  804353:	ff d0                	call   *%rax
+    file->f_hashnext = *head;
+  804355:	8b 10                	mov    (%rax),%edx
+  804357:	41 89 94 24 fc 00 00 	mov    %edx,0xfc(%r12)
+  80435e:	00 
+    *head = slot + 1;
+  80435f:	41 8d 55 01          	lea    0x1(%r13),%edx
+  804363:	89 10                	mov    %edx,(%rax)
+  804365:	e9 7b ff ff ff       	jmp    8042e5 <walk_path+0x1fe>
+    file_flush(dir);
+  80436a:	4c 89 f7             	mov    %r14,%rdi
+  80436d:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  804374:	00 00 00 
+  804377:	ff d0                	call   *%rax
+    if (dir->f_dirindex) {
+  804379:	41 83 be f8 00 00 00 	cmpl   $0x0,0xf8(%r14)
+  804380:	00 
+  804381:	0f 84 8f 01 00 00    	je     804516 <walk_path+0x42f>
+        for (uint32_t slot = *dir_bucket(dir, name); slot; slot = (*file)->f_hashnext) {
+  804387:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  80438e:	4c 89 f7             	mov    %r14,%rdi
+  804391:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  804398:	00 00 00 
+  80439b:	ff d0                	call   *%rax
+  80439d:	8b 00                	mov    (%rax),%eax
+  80439f:	85 c0                	test   %eax,%eax
+  8043a1:	0f 84 aa 02 00 00    	je     804651 <walk_path+0x56a>
+            int res = dir_slot(dir, slot - 1, file);
+  8043a7:	49 bd 34 36 80 00 00 	movabs $0x803634,%r13
+  8043ae:	00 00 00 
+  8043b1:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8043b4:	48 8d 95 48 ff ff ff 	lea    -0xb8(%rbp),%rdx
+  8043bb:	4c 89 f7             	mov    %r14,%rdi
+  8043be:	41 ff d5             	call   *%r13
+            if (res < 0) return res;
+  8043c1:	85 c0                	test   %eax,%eax
+  8043c3:	78 3c                	js     804401 <walk_path+0x31a>
+            if (!strcmp((*file)->f_name, name)) return 0;
+  8043c5:	48 8b 9d 48 ff ff ff 	mov    -0xb8(%rbp),%rbx
+  8043cc:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  8043d3:	48 89 df             	mov    %rbx,%rdi
+  8043d6:	41 ff d7             	call   *%r15
+  8043d9:	85 c0                	test   %eax,%eax
+  8043db:	0f 84 a2 01 00 00    	je     804583 <walk_path+0x49c>
+        for (uint32_t slot = *dir_bucket(dir, name); slot; slot = (*file)->f_hashnext) {
+  8043e1:	8b 83 fc 00 00 00    	mov    0xfc(%rbx),%eax
+  8043e7:	85 c0                	test   %eax,%eax
+  8043e9:	75 c6                	jne    8043b1 <walk_path+0x2ca>
+        return -E_NOT_FOUND;
+  8043eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8043f0:	eb 0f                	jmp    804401 <walk_path+0x31a>
+                *file = &f[j];
+  8043f2:	4c 89 ad 48 ff ff ff 	mov    %r13,-0xb8(%rbp)
+    if (!res) {
+  8043f9:	85 c0                	test   %eax,%eax
+  8043fb:	0f 84 82 01 00 00    	je     804583 <walk_path+0x49c>
+        if ((r = dir_lookup_cached(dir, name, &f)) < 0) {
+  804401:	85 c0                	test   %eax,%eax
+  804403:	0f 88 ab 01 00 00    	js     8045b4 <walk_path+0x4cd>
+    dir = 0;
+  804409:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+    while (*path != '\0') {
+  804410:	0f b6 06             	movzbl (%rsi),%eax
+  804413:	84 c0                	test   %al,%al
+  804415:	0f 84 ee 01 00 00    	je     804609 <walk_path+0x522>
+        dir = f;
+  80441b:	4c 8b b5 48 ff ff ff 	mov    -0xb8(%rbp),%r14
+        while (*path != '/' && *path != '\0')
+  804422:	3c 2f                	cmp    $0x2f,%al
+  804424:	0f 84 42 fd ff ff    	je     80416c <walk_path+0x85>
+  80442a:	48 89 f0             	mov    %rsi,%rax
+            path++;
+  80442d:	48 83 c0 01          	add    $0x1,%rax
+        while (*path != '/' && *path != '\0')
+  804431:	0f b6 10             	movzbl (%rax),%edx
+  804434:	80 fa 2f             	cmp    $0x2f,%dl
+  804437:	74 04                	je     80443d <walk_path+0x356>
+  804439:	84 d2                	test   %dl,%dl
+  80443b:	75 f0                	jne    80442d <walk_path+0x346>
+        if (path - p >= MAXNAMELEN)
+  80443d:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+  804444:	48 29 f0             	sub    %rsi,%rax
+  804447:	48 89 c3             	mov    %rax,%rbx
+  80444a:	48 83 f8 7f          	cmp    $0x7f,%rax
+  80444e:	0f 8f ef 01 00 00    	jg     804643 <walk_path+0x55c>
+        memmove(name, p, path - p);
+  804454:	48 89 da             	mov    %rbx,%rdx
+  804457:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80445e:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  804465:	00 00 00 
+  804468:	ff d0                	call   *%rax
+        name[path - p] = '\0';
+  80446a:	c6 84 1d 50 ff ff ff 	movb   $0x0,-0xb0(%rbp,%rbx,1)
+  804471:	00 
+    while (*p == '/')
+  804472:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804479:	80 38 2f             	cmpb   $0x2f,(%rax)
+  80447c:	75 10                	jne    80448e <walk_path+0x3a7>
+        p++;
+  80447e:	48 83 c0 01          	add    $0x1,%rax
+    while (*p == '/')
+  804482:	80 38 2f             	cmpb   $0x2f,(%rax)
+  804485:	74 f7                	je     80447e <walk_path+0x397>
+  804487:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+        if (dir->f_type != FTYPE_DIR)
+  80448e:	41 83 be 84 00 00 00 	cmpl   $0x1,0x84(%r14)
+  804495:	01 
+  804496:	0f 85 ae 01 00 00    	jne    80464a <walk_path+0x563>
+    struct Dentry *d = dcache_entry(dir, name);
+  80449c:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  8044a3:	4c 89 f7             	mov    %r14,%rdi
+  8044a6:	48 b8 ad 22 80 00 00 	movabs $0x8022ad,%rax
+  8044ad:	00 00 00 
+  8044b0:	ff d0                	call   *%rax
+  8044b2:	48 89 85 18 ff ff ff 	mov    %rax,-0xe8(%rbp)
+    if (d->d_dir == dir && !strcmp(d->d_name, name)) {
+  8044b9:	4c 3b 30             	cmp    (%rax),%r14
+  8044bc:	0f 84 bb fc ff ff    	je     80417d <walk_path+0x96>
+    assert((dir->f_size % BLKSIZE) == 0);
+  8044c2:	41 8b 86 80 00 00 00 	mov    0x80(%r14),%eax
+  8044c9:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8044ce:	0f 85 d6 fc ff ff    	jne    8041aa <walk_path+0xc3>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  8044d4:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8044da:	85 c0                	test   %eax,%eax
+  8044dc:	0f 48 c2             	cmovs  %edx,%eax
+  8044df:	c1 f8 0c             	sar    $0xc,%eax
+  8044e2:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%rbp)
+    if (!dir->f_dirindex && nblock > 1) dir_build_index(dir);
+  8044e8:	41 83 be f8 00 00 00 	cmpl   $0x0,0xf8(%r14)
+  8044ef:	00 
+  8044f0:	75 09                	jne    8044fb <walk_path+0x414>
+  8044f2:	83 f8 01             	cmp    $0x1,%eax
+  8044f5:	0f 87 e4 fc ff ff    	ja     8041df <walk_path+0xf8>
+    if (dir->f_dirindex) {
+  8044fb:	41 83 be f8 00 00 00 	cmpl   $0x0,0xf8(%r14)
+  804502:	00 
+  804503:	0f 85 7e fe ff ff    	jne    804387 <walk_path+0x2a0>
+    for (blockno_t i = 0; i < nblock; i++) {
+  804509:	83 bd 24 ff ff ff 00 	cmpl   $0x0,-0xdc(%rbp)
+  804510:	0f 84 3b 01 00 00    	je     804651 <walk_path+0x56a>
+  804516:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int res = file_get_block(dir, i, &blk);
+  80451c:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  804523:	44 89 e6             	mov    %r12d,%esi
+  804526:	4c 89 f7             	mov    %r14,%rdi
+  804529:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  804530:	00 00 00 
+  804533:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804535:	85 c0                	test   %eax,%eax
+  804537:	0f 88 bc fe ff ff    	js     8043f9 <walk_path+0x312>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  80453d:	4c 8b ad 40 ff ff ff 	mov    -0xc0(%rbp),%r13
+  804544:	49 8d 9d 00 10 00 00 	lea    0x1000(%r13),%rbx
+            if (strcmp(f[j].f_name, name) == 0) {
+  80454b:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  804552:	4c 89 ef             	mov    %r13,%rdi
+  804555:	41 ff d7             	call   *%r15
+  804558:	85 c0                	test   %eax,%eax
+  80455a:	0f 84 92 fe ff ff    	je     8043f2 <walk_path+0x30b>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  804560:	49 81 c5 00 01 00 00 	add    $0x100,%r13
+  804567:	49 39 dd             	cmp    %rbx,%r13
+  80456a:	75 df                	jne    80454b <walk_path+0x464>
+    for (blockno_t i = 0; i < nblock; i++) {
+  80456c:	41 83 c4 01          	add    $0x1,%r12d
+  804570:	44 39 a5 24 ff ff ff 	cmp    %r12d,-0xdc(%rbp)
+  804577:	75 a3                	jne    80451c <walk_path+0x435>
+    return -E_NOT_FOUND;
+  804579:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80457e:	e9 7e fe ff ff       	jmp    804401 <walk_path+0x31a>
+        d->d_dir = dir;
+  804583:	48 8b 8d 18 ff ff ff 	mov    -0xe8(%rbp),%rcx
+  80458a:	4c 89 31             	mov    %r14,(%rcx)
+        d->d_file = *file;
+  80458d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804594:	48 89 41 08          	mov    %rax,0x8(%rcx)
+        strcpy(d->d_name, name);
+  804598:	48 8d 79 10          	lea    0x10(%rcx),%rdi
+  80459c:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  8045a3:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  8045aa:	00 00 00 
+  8045ad:	ff d0                	call   *%rax
+  8045af:	e9 55 fe ff ff       	jmp    804409 <walk_path+0x322>
+            if (r == -E_NOT_FOUND && *path == '\0') {
+  8045b4:	89 c3                	mov    %eax,%ebx
+  8045b6:	48 8b b5 10 ff ff ff 	mov    -0xf0(%rbp),%rsi
+  8045bd:	4c 8b a5 08 ff ff ff 	mov    -0xf8(%rbp),%r12
+  8045c4:	4c 8b ad 00 ff ff ff 	mov    -0x100(%rbp),%r13
+  8045cb:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8045ce:	75 5f                	jne    80462f <walk_path+0x548>
+  8045d0:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8045d7:	80 38 00             	cmpb   $0x0,(%rax)
+  8045da:	75 53                	jne    80462f <walk_path+0x548>
+                if (pdir)
+  8045dc:	48 85 f6             	test   %rsi,%rsi
+  8045df:	74 03                	je     8045e4 <walk_path+0x4fd>
+                    *pdir = dir;
+  8045e1:	4c 89 36             	mov    %r14,(%rsi)
+                if (lastelem)
+  8045e4:	4d 85 ed             	test   %r13,%r13
+  8045e7:	74 16                	je     8045ff <walk_path+0x518>
+                    strcpy(lastelem, name);
+  8045e9:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  8045f0:	4c 89 ef             	mov    %r13,%rdi
+  8045f3:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  8045fa:	00 00 00 
+  8045fd:	ff d0                	call   *%rax
+                *pf = 0;
+  8045ff:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  804606:	00 
+  804607:	eb 26                	jmp    80462f <walk_path+0x548>
+    if (pdir)
+  804609:	48 8b b5 10 ff ff ff 	mov    -0xf0(%rbp),%rsi
+  804610:	4c 8b a5 08 ff ff ff 	mov    -0xf8(%rbp),%r12
+  804617:	48 85 f6             	test   %rsi,%rsi
+  80461a:	74 03                	je     80461f <walk_path+0x538>
+        *pdir = dir;
+  80461c:	4c 89 36             	mov    %r14,(%rsi)
+    *pf = f;
+  80461f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804626:	49 89 04 24          	mov    %rax,(%r12)
+    return 0;
+  80462a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80462f:	89 d8                	mov    %ebx,%eax
+  804631:	48 81 c4 d8 00 00 00 	add    $0xd8,%rsp
+  804638:	5b                   	pop    %rbx
+  804639:	41 5c                	pop    %r12
+  80463b:	41 5d                	pop    %r13
+  80463d:	41 5e                	pop    %r14
+  80463f:	41 5f                	pop    %r15
+  804641:	5d                   	pop    %rbp
+  804642:	c3                   	ret
+            return -E_BAD_PATH;
+  804643:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804648:	eb e5                	jmp    80462f <walk_path+0x548>
+            return -E_NOT_FOUND;
+  80464a:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80464f:	eb de                	jmp    80462f <walk_path+0x548>
+    for (blockno_t i = 0; i < nblock; i++) {
+  804651:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804656:	e9 a6 fd ff ff       	jmp    804401 <walk_path+0x31a>
+
+000000000080465b <file_open>:
+file_open(const char *path, struct File **pf) {
+  80465b:	55                   	push   %rbp
+  80465c:	48 89 e5             	mov    %rsp,%rbp
+  80465f:	48 89 f2             	mov    %rsi,%rdx
+    return walk_path(path, 0, pf, 0);
+  804662:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804667:	be 00 00 00 00       	mov    $0x0,%esi
+  80466c:	48 b8 e7 40 80 00 00 	movabs $0x8040e7,%rax
+  804673:	00 00 00 
+  804676:	ff d0                	call   *%rax
+}
+  804678:	5d                   	pop    %rbp
+  804679:	c3                   	ret
+
+000000000080467a <file_create>:
+file_create(const char *path, struct File **pf) {
+  80467a:	55                   	push   %rbp
+  80467b:	48 89 e5             	mov    %rsp,%rbp
+  80467e:	41 57                	push   %r15
+  804680:	41 56                	push   %r14
+  804682:	41 55                	push   %r13
+  804684:	41 54                	push   %r12
+  804686:	53                   	push   %rbx
+  804687:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  80468e:	48 89 b5 28 ff ff ff 	mov    %rsi,-0xd8(%rbp)
+    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
+  804695:	48 8d 8d 50 ff ff ff 	lea    -0xb0(%rbp),%rcx
+  80469c:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  8046a3:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  8046aa:	48 b8 e7 40 80 00 00 	movabs $0x8040e7,%rax
+  8046b1:	00 00 00 
+  8046b4:	ff d0                	call   *%rax
+  8046b6:	85 c0                	test   %eax,%eax
+  8046b8:	0f 84 cf 01 00 00    	je     80488d <file_create+0x213>
+  8046be:	89 c3                	mov    %eax,%ebx
+    if (res != -E_NOT_FOUND || dir == 0) return res;
+  8046c0:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8046c3:	0f 85 87 01 00 00    	jne    804850 <file_create+0x1d6>
+  8046c9:	4c 8b b5 48 ff ff ff 	mov    -0xb8(%rbp),%r14
+  8046d0:	4d 85 f6             	test   %r14,%r14
+  8046d3:	0f 84 77 01 00 00    	je     804850 <file_create+0x1d6>
+    assert((dir->f_size % BLKSIZE) == 0);
+  8046d9:	41 8b 86 80 00 00 00 	mov    0x80(%r14),%eax
+  8046e0:	89 c3                	mov    %eax,%ebx
+  8046e2:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8046e8:	0f 85 cd 00 00 00    	jne    8047bb <file_create+0x141>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  8046ee:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8046f4:	85 c0                	test   %eax,%eax
+  8046f6:	0f 48 c2             	cmovs  %edx,%eax
+    for (blockno_t i = 0; i < nblock; i++) {
+  8046f9:	c1 f8 0c             	sar    $0xc,%eax
+  8046fc:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%rbp)
+  804702:	74 5b                	je     80475f <file_create+0xe5>
+  804704:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        int res = file_get_block(dir, i, &blk);
+  80470a:	49 bf 10 36 80 00 00 	movabs $0x803610,%r15
+  804711:	00 00 00 
+  804714:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  80471b:	44 89 ee             	mov    %r13d,%esi
+  80471e:	4c 89 f7             	mov    %r14,%rdi
+  804721:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804724:	85 c0                	test   %eax,%eax
+  804726:	0f 88 38 01 00 00    	js     804864 <file_create+0x1ea>
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+  80472c:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  804733:	ba 00 00 00 00       	mov    $0x0,%edx
+            if (f[j].f_name[0] == '\0') {
+  804738:	49 89 c4             	mov    %rax,%r12
+  80473b:	80 38 00             	cmpb   $0x0,(%rax)
+  80473e:	0f 84 ac 00 00 00    	je     8047f0 <file_create+0x176>
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+  804744:	83 c2 01             	add    $0x1,%edx
+  804747:	48 05 00 01 00 00    	add    $0x100,%rax
+  80474d:	83 fa 10             	cmp    $0x10,%edx
+  804750:	75 e6                	jne    804738 <file_create+0xbe>
+    for (blockno_t i = 0; i < nblock; i++) {
+  804752:	41 83 c5 01          	add    $0x1,%r13d
+  804756:	44 39 ad 24 ff ff ff 	cmp    %r13d,-0xdc(%rbp)
+  80475d:	75 b5                	jne    804714 <file_create+0x9a>
+    dir->f_size += BLKSIZE;
+  80475f:	41 81 86 80 00 00 00 	addl   $0x1000,0x80(%r14)
+  804766:	00 10 00 00 
+    int res = file_get_block(dir, nblock, &blk);
+  80476a:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  804771:	44 8b bd 24 ff ff ff 	mov    -0xdc(%rbp),%r15d
+  804778:	44 89 fe             	mov    %r15d,%esi
+  80477b:	4c 89 f7             	mov    %r14,%rdi
+  80477e:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  804785:	00 00 00 
+  804788:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80478a:	85 c0                	test   %eax,%eax
+  80478c:	0f 88 02 01 00 00    	js     804894 <file_create+0x21a>
+    memset(blk, 0, BLKSIZE);
+  804792:	4c 8b a5 38 ff ff ff 	mov    -0xc8(%rbp),%r12
+  804799:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80479e:	be 00 00 00 00       	mov    $0x0,%esi
+  8047a3:	4c 89 e7             	mov    %r12,%rdi
+  8047a6:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  8047ad:	00 00 00 
+  8047b0:	ff d0                	call   *%rax
+    *slot = nblock * BLKFILES;
+  8047b2:	41 c1 e7 04          	shl    $0x4,%r15d
+  8047b6:	45 89 fd             	mov    %r15d,%r13d
+    return 0;
+  8047b9:	eb 3c                	jmp    8047f7 <file_create+0x17d>
+    assert((dir->f_size % BLKSIZE) == 0);
+  8047bb:	48 b9 31 e4 80 00 00 	movabs $0x80e431,%rcx
+  8047c2:	00 00 00 
+  8047c5:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  8047cc:	00 00 00 
+  8047cf:	be 9f 02 00 00       	mov    $0x29f,%esi
+  8047d4:	48 bf 7a e3 80 00 00 	movabs $0x80e37a,%rdi
+  8047db:	00 00 00 
+  8047de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e3:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8047ea:	00 00 00 
+  8047ed:	41 ff d0             	call   *%r8
+                *slot = i * BLKFILES + j;
+  8047f0:	41 c1 e5 04          	shl    $0x4,%r13d
+  8047f4:	41 01 d5             	add    %edx,%r13d
+    *file = (struct File *)blk;
+  8047f7:	4c 89 a5 40 ff ff ff 	mov    %r12,-0xc0(%rbp)
+    strcpy(filp->f_name, name);
+  8047fe:	4d 89 e7             	mov    %r12,%r15
+  804801:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  804808:	4c 89 e7             	mov    %r12,%rdi
+  80480b:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  804812:	00 00 00 
+  804815:	ff d0                	call   *%rax
+    if (!dir->f_dirindex) return;
+  804817:	41 83 be f8 00 00 00 	cmpl   $0x0,0xf8(%r14)
+  80481e:	00 
+  80481f:	75 47                	jne    804868 <file_create+0x1ee>
+    dcache_invalidate(dir, name);
+  804821:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  804828:	4c 89 f7             	mov    %r14,%rdi
+  80482b:	48 b8 13 24 80 00 00 	movabs $0x802413,%rax
+  804832:	00 00 00 
+  804835:	ff d0                	call   *%rax
+    *pf = filp;
+  804837:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80483e:	4c 89 38             	mov    %r15,(%rax)
+    file_flush(dir);
+  804841:	4c 89 f7             	mov    %r14,%rdi
+  804844:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  80484b:	00 00 00 
+  80484e:	ff d0                	call   *%rax
+}
+  804850:	89 d8                	mov    %ebx,%eax
+  804852:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  804859:	5b                   	pop    %rbx
+  80485a:	41 5c                	pop    %r12
+  80485c:	41 5d                	pop    %r13
+  80485e:	41 5e                	pop    %r14
+  804860:	41 5f                	pop    %r15
+  804862:	5d                   	pop    %rbp
+  804863:	c3                   	ret
+        int res = file_get_block(dir, i, &blk);
+  804864:	89 c3                	mov    %eax,%ebx
+  804866:	eb e8                	jmp    804850 <file_create+0x1d6>
+    uint32_t *head = dir_bucket(dir, file->f_name);
+  804868:	4c 89 e6             	mov    %r12,%rsi
+  80486b:	4c 89 f7             	mov    %r14,%rdi
+  80486e:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  804875:	00 00 00 
+  804878:	ff d0                	call   *%rax
+    file->f_hashnext = *head;
+  80487a:	8b 10                	mov    (%rax),%edx
+  80487c:	41 89 94 24 fc 00 00 	mov    %edx,0xfc(%r12)
+  804883:	00 
+    *head = slot + 1;
+  804884:	41 83 c5 01          	add    $0x1,%r13d
+  804888:	44 89 28             	mov    %r13d,(%rax)
+  80488b:	eb 94                	jmp    804821 <file_create+0x1a7>
+    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
+  80488d:	bb ef ff ff ff       	mov    $0xffffffef,%ebx
+  804892:	eb bc                	jmp    804850 <file_create+0x1d6>
+    if (res < 0) return res;
+  804894:	89 c3                	mov    %eax,%ebx
+  804896:	eb b8                	jmp    804850 <file_create+0x1d6>
+
+0000000000804898 <file_remove>:
+
+/* Remove regular file "path".
+ * Returns 0 on success, < 0 on error. */
+int
+file_remove(const char *path) {
+  804898:	55                   	push   %rbp
+  804899:	48 89 e5             	mov    %rsp,%rbp
+  80489c:	41 57                	push   %r15
+  80489e:	41 56                	push   %r14
+  8048a0:	41 55                	push   %r13
+  8048a2:	41 54                	push   %r12
+  8048a4:	53                   	push   %rbx
+  8048a5:	48 83 ec 28          	sub    $0x28,%rsp
+    struct File *dir, *f;
+    int res;
+
+    if ((res = walk_path(path, &dir, &f, 0)) < 0) return res;
+  8048a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8048ae:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  8048b2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8048b6:	48 b8 e7 40 80 00 00 	movabs $0x8040e7,%rax
+  8048bd:	00 00 00 
+  8048c0:	ff d0                	call   *%rax
+  8048c2:	85 c0                	test   %eax,%eax
+  8048c4:	78 7c                	js     804942 <file_remove+0xaa>
+    if (!dir) return -E_INVAL;
+  8048c6:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8048ca:	48 85 db             	test   %rbx,%rbx
+  8048cd:	0f 84 06 01 00 00    	je     8049d9 <file_remove+0x141>
+    if (f->f_type != FTYPE_REG) return -E_NOT_SUPP;
+  8048d3:	4c 8b 65 c0          	mov    -0x40(%rbp),%r12
+  8048d7:	41 83 bc 24 84 00 00 	cmpl   $0x0,0x84(%r12)
+  8048de:	00 00 
+  8048e0:	0f 85 fd 00 00 00    	jne    8049e3 <file_remove+0x14b>
+
+    dcache_invalidate(dir, f->f_name);
+  8048e6:	4c 89 e6             	mov    %r12,%rsi
+  8048e9:	48 89 df             	mov    %rbx,%rdi
+  8048ec:	48 b8 13 24 80 00 00 	movabs $0x802413,%rax
+  8048f3:	00 00 00 
+  8048f6:	ff d0                	call   *%rax
+    if (!dir->f_dirindex) return 0;
+  8048f8:	83 bb f8 00 00 00 00 	cmpl   $0x0,0xf8(%rbx)
+  8048ff:	75 50                	jne    804951 <file_remove+0xb9>
+    if ((res = dir_index_remove(dir, f)) < 0) return res;
+
+    file_truncate_blocks(f, 0);
+  804901:	be 00 00 00 00       	mov    $0x0,%esi
+  804906:	4c 89 e7             	mov    %r12,%rdi
+  804909:	48 b8 c2 37 80 00 00 	movabs $0x8037c2,%rax
+  804910:	00 00 00 
+  804913:	ff d0                	call   *%rax
+    memset(f, 0, sizeof(*f));
+  804915:	ba 00 01 00 00       	mov    $0x100,%edx
+  80491a:	be 00 00 00 00       	mov    $0x0,%esi
+  80491f:	4c 89 e7             	mov    %r12,%rdi
+  804922:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  804929:	00 00 00 
+  80492c:	ff d0                	call   *%rax
+    file_flush(dir);
+  80492e:	48 89 df             	mov    %rbx,%rdi
+  804931:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  804938:	00 00 00 
+  80493b:	ff d0                	call   *%rax
+    return 0;
+  80493d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804942:	48 83 c4 28          	add    $0x28,%rsp
+  804946:	5b                   	pop    %rbx
+  804947:	41 5c                	pop    %r12
+  804949:	41 5d                	pop    %r13
+  80494b:	41 5e                	pop    %r14
+  80494d:	41 5f                	pop    %r15
+  80494f:	5d                   	pop    %rbp
+  804950:	c3                   	ret
+    uint32_t *head = dir_bucket(dir, file->f_name);
+  804951:	4c 89 e6             	mov    %r12,%rsi
+  804954:	48 89 df             	mov    %rbx,%rdi
+  804957:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  80495e:	00 00 00 
+  804961:	ff d0                	call   *%rax
+  804963:	49 89 c7             	mov    %rax,%r15
+    for (uint32_t slot = *head; slot;) {
+  804966:	8b 30                	mov    (%rax),%esi
+  804968:	85 f6                	test   %esi,%esi
+  80496a:	74 39                	je     8049a5 <file_remove+0x10d>
+    struct File *prev = NULL;
+  80496c:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        int res = dir_slot(dir, slot - 1, &f);
+  804972:	49 bd 34 36 80 00 00 	movabs $0x803634,%r13
+  804979:	00 00 00 
+  80497c:	eb 03                	jmp    804981 <file_remove+0xe9>
+        prev = f;
+  80497e:	49 89 c6             	mov    %rax,%r14
+        int res = dir_slot(dir, slot - 1, &f);
+  804981:	83 ee 01             	sub    $0x1,%esi
+  804984:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804988:	48 89 df             	mov    %rbx,%rdi
+  80498b:	41 ff d5             	call   *%r13
+        if (res < 0) return res;
+  80498e:	85 c0                	test   %eax,%eax
+  804990:	78 b0                	js     804942 <file_remove+0xaa>
+        if (f == file) {
+  804992:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804996:	49 39 c4             	cmp    %rax,%r12
+  804999:	74 1b                	je     8049b6 <file_remove+0x11e>
+        slot = f->f_hashnext;
+  80499b:	8b b0 fc 00 00 00    	mov    0xfc(%rax),%esi
+    for (uint32_t slot = *head; slot;) {
+  8049a1:	85 f6                	test   %esi,%esi
+  8049a3:	75 d9                	jne    80497e <file_remove+0xe6>
+    file->f_hashnext = 0;
+  8049a5:	41 c7 84 24 fc 00 00 	movl   $0x0,0xfc(%r12)
+  8049ac:	00 00 00 00 00 
+    return 0;
+  8049b1:	e9 4b ff ff ff       	jmp    804901 <file_remove+0x69>
+            if (prev)
+  8049b6:	4d 85 f6             	test   %r14,%r14
+  8049b9:	74 11                	je     8049cc <file_remove+0x134>
+                prev->f_hashnext = file->f_hashnext;
+  8049bb:	41 8b 84 24 fc 00 00 	mov    0xfc(%r12),%eax
+  8049c2:	00 
+  8049c3:	41 89 86 fc 00 00 00 	mov    %eax,0xfc(%r14)
+  8049ca:	eb d9                	jmp    8049a5 <file_remove+0x10d>
+                *head = file->f_hashnext;
+  8049cc:	41 8b 84 24 fc 00 00 	mov    0xfc(%r12),%eax
+  8049d3:	00 
+  8049d4:	41 89 07             	mov    %eax,(%r15)
+  8049d7:	eb cc                	jmp    8049a5 <file_remove+0x10d>
+    if (!dir) return -E_INVAL;
+  8049d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8049de:	e9 5f ff ff ff       	jmp    804942 <file_remove+0xaa>
+    if (f->f_type != FTYPE_REG) return -E_NOT_SUPP;
+  8049e3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8049e8:	e9 55 ff ff ff       	jmp    804942 <file_remove+0xaa>
+
+00000000008049ed <dir_index_has>:
+
+/* Whether file with given name is linked into hash chain of dir */
+bool
+dir_index_has(struct File *dir, const char *name, struct File *file) {
+  8049ed:	55                   	push   %rbp
+  8049ee:	48 89 e5             	mov    %rsp,%rbp
+  8049f1:	41 55                	push   %r13
+  8049f3:	41 54                	push   %r12
+  8049f5:	53                   	push   %rbx
+  8049f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8049fa:	48 89 fb             	mov    %rdi,%rbx
+  8049fd:	49 89 d4             	mov    %rdx,%r12
+    struct File *f;
+    for (uint32_t slot = *dir_bucket(dir, name); slot; slot = f->f_hashnext) {
+  804a00:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  804a07:	00 00 00 
+  804a0a:	ff d0                	call   *%rax
+  804a0c:	8b 30                	mov    (%rax),%esi
+  804a0e:	85 f6                	test   %esi,%esi
+  804a10:	74 35                	je     804a47 <dir_index_has+0x5a>
+        if (dir_slot(dir, slot - 1, &f) < 0) return 0;
+  804a12:	49 bd 34 36 80 00 00 	movabs $0x803634,%r13
+  804a19:	00 00 00 
+  804a1c:	83 ee 01             	sub    $0x1,%esi
+  804a1f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804a23:	48 89 df             	mov    %rbx,%rdi
+  804a26:	41 ff d5             	call   *%r13
+  804a29:	85 c0                	test   %eax,%eax
+  804a2b:	78 21                	js     804a4e <dir_index_has+0x61>
+        if (f == file) return 1;
+  804a2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a31:	4c 39 e0             	cmp    %r12,%rax
+  804a34:	74 28                	je     804a5e <dir_index_has+0x71>
+    for (uint32_t slot = *dir_bucket(dir, name); slot; slot = f->f_hashnext) {
+  804a36:	8b b0 fc 00 00 00    	mov    0xfc(%rax),%esi
+  804a3c:	85 f6                	test   %esi,%esi
+  804a3e:	75 dc                	jne    804a1c <dir_index_has+0x2f>
+    }
+    return 0;
+  804a40:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a45:	eb 0c                	jmp    804a53 <dir_index_has+0x66>
+  804a47:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a4c:	eb 05                	jmp    804a53 <dir_index_has+0x66>
+        if (dir_slot(dir, slot - 1, &f) < 0) return 0;
+  804a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a53:	48 83 c4 18          	add    $0x18,%rsp
+  804a57:	5b                   	pop    %rbx
+  804a58:	41 5c                	pop    %r12
+  804a5a:	41 5d                	pop    %r13
+  804a5c:	5d                   	pop    %rbp
+  804a5d:	c3                   	ret
+        if (f == file) return 1;
+  804a5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a63:	eb ee                	jmp    804a53 <dir_index_has+0x66>
+
+0000000000804a65 <dcache_cached>:
+
+/* File found by cached lookup of name in dir, NULL if not cached */
+struct File *
+dcache_cached(struct File *dir, const char *name) {
+  804a65:	55                   	push   %rbp
+  804a66:	48 89 e5             	mov    %rsp,%rbp
+  804a69:	41 55                	push   %r13
+  804a6b:	41 54                	push   %r12
+  804a6d:	53                   	push   %rbx
+  804a6e:	48 83 ec 08          	sub    $0x8,%rsp
+  804a72:	48 89 fb             	mov    %rdi,%rbx
+  804a75:	49 89 f5             	mov    %rsi,%r13
+    struct Dentry *d = dcache_entry(dir, name);
+  804a78:	48 b8 ad 22 80 00 00 	movabs $0x8022ad,%rax
+  804a7f:	00 00 00 
+  804a82:	ff d0                	call   *%rax
+  804a84:	49 89 c4             	mov    %rax,%r12
+    return d->d_dir == dir && !strcmp(d->d_name, name) ? d->d_file : NULL;
+  804a87:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a8c:	49 39 1c 24          	cmp    %rbx,(%r12)
+  804a90:	74 0b                	je     804a9d <dcache_cached+0x38>
+}
+  804a92:	48 83 c4 08          	add    $0x8,%rsp
+  804a96:	5b                   	pop    %rbx
+  804a97:	41 5c                	pop    %r12
+  804a99:	41 5d                	pop    %r13
+  804a9b:	5d                   	pop    %rbp
+  804a9c:	c3                   	ret
+    return d->d_dir == dir && !strcmp(d->d_name, name) ? d->d_file : NULL;
+  804a9d:	49 8d 7c 24 10       	lea    0x10(%r12),%rdi
+  804aa2:	4c 89 ee             	mov    %r13,%rsi
+  804aa5:	48 b8 51 9b 80 00 00 	movabs $0x809b51,%rax
+  804aac:	00 00 00 
+  804aaf:	ff d0                	call   *%rax
+  804ab1:	89 c2                	mov    %eax,%edx
+  804ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ab8:	85 d2                	test   %edx,%edx
+  804aba:	75 d6                	jne    804a92 <dcache_cached+0x2d>
+  804abc:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  804ac1:	eb cf                	jmp    804a92 <dcache_cached+0x2d>
+
+0000000000804ac3 <fs_sync>:
+
+/* Sync the entire file system.  A big hammer. */
+void
+fs_sync(void) {
+  804ac3:	55                   	push   %rbp
+  804ac4:	48 89 e5             	mov    %rsp,%rbp
+    bc_sync();
+  804ac7:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  804ace:	00 00 00 
+  804ad1:	ff d0                	call   *%rax
+}
+  804ad3:	5d                   	pop    %rbp
+  804ad4:	c3                   	ret
+
+0000000000804ad5 <journal_start>:
+}
+
+/* First block of the half used by transaction seq */
+static blockno_t
+journal_start(uint32_t seq) {
+    return super->s_journal + 1 + (seq % 2) * journal_half();
+  804ad5:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  804adc:	00 00 00 
+    return (super->s_journal_len - 1) / 2;
+  804adf:	8b 88 10 01 00 00    	mov    0x110(%rax),%ecx
+  804ae5:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804ae8:	d1 ea                	shr    %edx
+    return super->s_journal + 1 + (seq % 2) * journal_half();
+  804aea:	83 e7 01             	and    $0x1,%edi
+  804aed:	0f af d7             	imul   %edi,%edx
+  804af0:	8b 80 0c 01 00 00    	mov    0x10c(%rax),%eax
+  804af6:	8d 44 02 01          	lea    0x1(%rdx,%rax,1),%eax
+}
+  804afa:	c3                   	ret
+
+0000000000804afb <journal_sum>:
+
+/* FNV-1a over home locations and logged blocks following jh */
+static uint32_t
+journal_sum(struct JournalHeader *jh) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (uint32_t i = 0; i < jh->j_nblocks; i++)
+  804afb:	8b 77 08             	mov    0x8(%rdi),%esi
+    uint64_t hash = 14695981039346656037ULL;
+  804afe:	48 ba 25 23 22 84 e4 	movabs $0xcbf29ce484222325,%rdx
+  804b05:	9c f2 cb 
+    for (uint32_t i = 0; i < jh->j_nblocks; i++)
+  804b08:	85 f6                	test   %esi,%esi
+  804b0a:	74 5a                	je     804b66 <journal_sum+0x6b>
+  804b0c:	48 89 f8             	mov    %rdi,%rax
+  804b0f:	89 f2                	mov    %esi,%edx
+  804b11:	4c 8d 0c 97          	lea    (%rdi,%rdx,4),%r9
+    uint64_t hash = 14695981039346656037ULL;
+  804b15:	48 ba 25 23 22 84 e4 	movabs $0xcbf29ce484222325,%rdx
+  804b1c:	9c f2 cb 
+        hash = (hash ^ jh->j_home[i]) * 1099511628211ULL;
+  804b1f:	49 b8 b3 01 00 00 00 	movabs $0x100000001b3,%r8
+  804b26:	01 00 00 
+  804b29:	8b 48 10             	mov    0x10(%rax),%ecx
+  804b2c:	48 31 ca             	xor    %rcx,%rdx
+  804b2f:	49 0f af d0          	imul   %r8,%rdx
+    for (uint32_t i = 0; i < jh->j_nblocks; i++)
+  804b33:	48 83 c0 04          	add    $0x4,%rax
+  804b37:	49 39 c1             	cmp    %rax,%r9
+  804b3a:	75 ed                	jne    804b29 <journal_sum+0x2e>
+
+    uint64_t *data = (uint64_t *)((char *)jh + BLKSIZE);
+    for (size_t i = 0; i < jh->j_nblocks * BLKSIZE / sizeof(*data); i++)
+  804b3c:	89 f1                	mov    %esi,%ecx
+  804b3e:	48 c1 e1 09          	shl    $0x9,%rcx
+  804b42:	b8 00 00 00 00       	mov    $0x0,%eax
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+  804b47:	48 be b3 01 00 00 00 	movabs $0x100000001b3,%rsi
+  804b4e:	01 00 00 
+  804b51:	48 33 94 c7 00 10 00 	xor    0x1000(%rdi,%rax,8),%rdx
+  804b58:	00 
+  804b59:	48 0f af d6          	imul   %rsi,%rdx
+    for (size_t i = 0; i < jh->j_nblocks * BLKSIZE / sizeof(*data); i++)
+  804b5d:	48 83 c0 01          	add    $0x1,%rax
+  804b61:	48 39 c8             	cmp    %rcx,%rax
+  804b64:	72 eb                	jb     804b51 <journal_sum+0x56>
+    return hash ^ hash >> 32;
+  804b66:	48 89 d0             	mov    %rdx,%rax
+  804b69:	48 c1 e8 20          	shr    $0x20,%rax
+  804b6d:	31 d0                	xor    %edx,%eax
+}
+  804b6f:	c3                   	ret
+
+0000000000804b70 <journal_flush>:
+
+static void
+journal_flush(void) {
+  804b70:	55                   	push   %rbp
+  804b71:	48 89 e5             	mov    %rsp,%rbp
+    int res = nvme_flush();
+  804b74:	48 b8 a2 8d 80 00 00 	movabs $0x808da2,%rax
+  804b7b:	00 00 00 
+  804b7e:	ff d0                	call   *%rax
+    if (res != NVME_OK) panic("journal: flush failed: %i", res);
+  804b80:	85 c0                	test   %eax,%eax
+  804b82:	75 02                	jne    804b86 <journal_flush+0x16>
+}
+  804b84:	5d                   	pop    %rbp
+  804b85:	c3                   	ret
+    if (res != NVME_OK) panic("journal: flush failed: %i", res);
+  804b86:	89 c1                	mov    %eax,%ecx
+  804b88:	48 ba 4e e4 80 00 00 	movabs $0x80e44e,%rdx
+  804b8f:	00 00 00 
+  804b92:	be 52 00 00 00       	mov    $0x52,%esi
+  804b97:	48 bf 68 e4 80 00 00 	movabs $0x80e468,%rdi
+  804b9e:	00 00 00 
+  804ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ba6:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  804bad:	00 00 00 
+  804bb0:	41 ff d0             	call   *%r8
+
+0000000000804bb3 <journal_active>:
+}
+  804bb3:	a0 d4 50 8c 00 00 00 	movabs 0x8c50d4,%al
+  804bba:	00 00 
+  804bbc:	c3                   	ret
+
+0000000000804bbd <journal_capacity>:
+    return (super->s_journal_len - 1) / 2;
+  804bbd:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  804bc4:	00 00 00 
+  804bc7:	8b 80 10 01 00 00    	mov    0x110(%rax),%eax
+  804bcd:	83 e8 01             	sub    $0x1,%eax
+  804bd0:	d1 e8                	shr    %eax
+    return MIN(journal_half() - 1, JOURNAL_MAXBLOCKS);
+  804bd2:	8d 40 ff             	lea    -0x1(%rax),%eax
+  804bd5:	ba fc 03 00 00       	mov    $0x3fc,%edx
+  804bda:	48 39 d0             	cmp    %rdx,%rax
+  804bdd:	48 0f 47 c2          	cmova  %rdx,%rax
+}
+  804be1:	c3                   	ret
+
+0000000000804be2 <journal_pending>:
+    return journal_on ? nlogged : 0;
+  804be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804be7:	48 ba d4 50 8c 00 00 	movabs $0x8c50d4,%rdx
+  804bee:	00 00 00 
+  804bf1:	80 3a 00             	cmpb   $0x0,(%rdx)
+  804bf4:	74 0a                	je     804c00 <journal_pending+0x1e>
+  804bf6:	48 a1 c0 40 8c 00 00 	movabs 0x8c40c0,%rax
+  804bfd:	00 00 00 
+}
+  804c00:	c3                   	ret
+
+0000000000804c01 <journal_forget>:
+journal_forget(blockno_t blockno) {
+  804c01:	89 f9                	mov    %edi,%ecx
+    CLRBIT(logged_map, blockno);
+  804c03:	89 f8                	mov    %edi,%eax
+  804c05:	c1 e8 05             	shr    $0x5,%eax
+  804c08:	48 be c0 c0 8a 00 00 	movabs $0x8ac0c0,%rsi
+  804c0f:	00 00 00 
+  804c12:	89 c0                	mov    %eax,%eax
+  804c14:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+  804c19:	d3 c2                	rol    %cl,%edx
+  804c1b:	21 14 86             	and    %edx,(%rsi,%rax,4)
+}
+  804c1e:	c3                   	ret
+
+0000000000804c1f <journal_commit>:
+ * keep the kernel from reclaiming blocks that look clean in page
+ * tables but are not home yet, until the next transaction maps them
+ * again or the checkpoint.  Transaction is never split, callers keep
+ * it within journal_capacity() with journal_pending(). */
+void
+journal_commit(blockno_t *blocks, size_t count) {
+  804c1f:	55                   	push   %rbp
+  804c20:	48 89 e5             	mov    %rsp,%rbp
+  804c23:	41 57                	push   %r15
+  804c25:	41 56                	push   %r14
+  804c27:	41 55                	push   %r13
+  804c29:	41 54                	push   %r12
+  804c2b:	53                   	push   %rbx
+  804c2c:	48 83 ec 38          	sub    $0x38,%rsp
+  804c30:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804c34:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    assert(journal_on && count);
+  804c38:	a0 d4 50 8c 00 00 00 	movabs 0x8c50d4,%al
+  804c3f:	00 00 
+  804c41:	3c 01                	cmp    $0x1,%al
+  804c43:	75 7f                	jne    804cc4 <journal_commit+0xa5>
+  804c45:	48 85 f6             	test   %rsi,%rsi
+  804c48:	74 7a                	je     804cc4 <journal_commit+0xa5>
+
+    uint32_t seq = journal_seq + 1;
+  804c4a:	a1 d0 50 8c 00 00 00 	movabs 0x8c50d0,%eax
+  804c51:	00 00 
+  804c53:	89 45 ac             	mov    %eax,-0x54(%rbp)
+  804c56:	83 c0 01             	add    $0x1,%eax
+  804c59:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+    blockno_t log = journal_start(seq);
+  804c5c:	89 c7                	mov    %eax,%edi
+  804c5e:	48 b8 d5 4a 80 00 00 	movabs $0x804ad5,%rax
+  804c65:	00 00 00 
+  804c68:	ff d0                	call   *%rax
+  804c6a:	89 45 b0             	mov    %eax,-0x50(%rbp)
+    struct JournalHeader *jh = diskaddr(log);
+  804c6d:	89 c7                	mov    %eax,%edi
+  804c6f:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  804c76:	00 00 00 
+  804c79:	ff d0                	call   *%rax
+  804c7b:	49 89 c6             	mov    %rax,%r14
+
+    int res = sys_alloc_region(CURENVID, jh, BLKSIZE, PROT_RW);
+  804c7e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804c83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c88:	48 89 c6             	mov    %rax,%rsi
+  804c8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c90:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  804c97:	00 00 00 
+  804c9a:	ff d0                	call   *%rax
+    if (res) panic("journal: can't map header: %i", res);
+  804c9c:	85 c0                	test   %eax,%eax
+  804c9e:	75 59                	jne    804cf9 <journal_commit+0xda>
+
+    /* Merge both sorted lists into the header */
+    size_t n = 0, i = 0, j = 0;
+    while (i < nlogged || j < count) {
+  804ca0:	48 a1 c0 40 8c 00 00 	movabs 0x8c40c0,%rax
+  804ca7:	00 00 00 
+  804caa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    size_t n = 0, i = 0, j = 0;
+  804cae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804cb3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804cb9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  804cbf:	e9 c9 00 00 00       	jmp    804d8d <journal_commit+0x16e>
+    assert(journal_on && count);
+  804cc4:	48 b9 75 e4 80 00 00 	movabs $0x80e475,%rcx
+  804ccb:	00 00 00 
+  804cce:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  804cd5:	00 00 00 
+  804cd8:	be 5f 00 00 00       	mov    $0x5f,%esi
+  804cdd:	48 bf 68 e4 80 00 00 	movabs $0x80e468,%rdi
+  804ce4:	00 00 00 
+  804ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cec:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  804cf3:	00 00 00 
+  804cf6:	41 ff d0             	call   *%r8
+    if (res) panic("journal: can't map header: %i", res);
+  804cf9:	89 c1                	mov    %eax,%ecx
+  804cfb:	48 ba 89 e4 80 00 00 	movabs $0x80e489,%rdx
+  804d02:	00 00 00 
+  804d05:	be 66 00 00 00       	mov    $0x66,%esi
+  804d0a:	48 bf 68 e4 80 00 00 	movabs $0x80e468,%rdi
+  804d11:	00 00 00 
+  804d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d19:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  804d20:	00 00 00 
+  804d23:	41 ff d0             	call   *%r8
+        blockno_t b;
+        if (j == count || (i < nlogged && logged[i] < blocks[j])) {
+            /* Blocks freed since the commit are left out */
+            b = logged[i++];
+  804d26:	49 8d 74 24 01       	lea    0x1(%r12),%rsi
+  804d2b:	48 b8 e0 40 8c 00 00 	movabs $0x8c40e0,%rax
+  804d32:	00 00 00 
+  804d35:	46 8b 2c a0          	mov    (%rax,%r12,4),%r13d
+            if (!TSTBIT(logged_map, b)) continue;
+  804d39:	44 89 ea             	mov    %r13d,%edx
+  804d3c:	c1 ea 05             	shr    $0x5,%edx
+  804d3f:	89 d2                	mov    %edx,%edx
+  804d41:	b8 01 00 00 00       	mov    $0x1,%eax
+  804d46:	44 89 e9             	mov    %r13d,%ecx
+  804d49:	d3 e0                	shl    %cl,%eax
+  804d4b:	48 b9 c0 c0 8a 00 00 	movabs $0x8ac0c0,%rcx
+  804d52:	00 00 00 
+  804d55:	23 04 91             	and    (%rcx,%rdx,4),%eax
+  804d58:	0f 84 a1 00 00 00    	je     804dff <journal_commit+0x1e0>
+            b = logged[i++];
+  804d5e:	49 89 f4             	mov    %rsi,%r12
+        } else {
+            b = blocks[j++];
+            if (i < nlogged && logged[i] == b) i++;
+        }
+        if (n == journal_capacity())
+  804d61:	48 b8 bd 4b 80 00 00 	movabs $0x804bbd,%rax
+  804d68:	00 00 00 
+  804d6b:	ff d0                	call   *%rax
+  804d6d:	4c 39 f8             	cmp    %r15,%rax
+  804d70:	74 5f                	je     804dd1 <journal_commit+0x1b2>
+            panic("journal: transaction does not fit in %zu blocks", journal_capacity());
+        jh->j_home[n++] = b;
+  804d72:	47 89 6c be 10       	mov    %r13d,0x10(%r14,%r15,4)
+  804d77:	4d 8d 7f 01          	lea    0x1(%r15),%r15
+    while (i < nlogged || j < count) {
+  804d7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d7f:	48 39 c3             	cmp    %rax,%rbx
+  804d82:	72 09                	jb     804d8d <journal_commit+0x16e>
+  804d84:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d88:	49 39 c4             	cmp    %rax,%r12
+  804d8b:	73 7a                	jae    804e07 <journal_commit+0x1e8>
+        if (j == count || (i < nlogged && logged[i] < blocks[j])) {
+  804d8d:	48 39 5d c8          	cmp    %rbx,-0x38(%rbp)
+  804d91:	74 93                	je     804d26 <journal_commit+0x107>
+  804d93:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d97:	49 39 c4             	cmp    %rax,%r12
+  804d9a:	0f 83 6b 02 00 00    	jae    80500b <journal_commit+0x3ec>
+  804da0:	48 b8 e0 40 8c 00 00 	movabs $0x8c40e0,%rax
+  804da7:	00 00 00 
+  804daa:	42 8b 04 a0          	mov    (%rax,%r12,4),%eax
+  804dae:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  804db2:	44 8b 2c 9e          	mov    (%rsi,%rbx,4),%r13d
+  804db6:	44 39 e8             	cmp    %r13d,%eax
+  804db9:	0f 82 67 ff ff ff    	jb     804d26 <journal_commit+0x107>
+            b = blocks[j++];
+  804dbf:	48 83 c3 01          	add    $0x1,%rbx
+            if (i < nlogged && logged[i] == b) i++;
+  804dc3:	44 39 e8             	cmp    %r13d,%eax
+  804dc6:	0f 94 c0             	sete   %al
+  804dc9:	0f b6 c0             	movzbl %al,%eax
+  804dcc:	49 01 c4             	add    %rax,%r12
+  804dcf:	eb 90                	jmp    804d61 <journal_commit+0x142>
+            panic("journal: transaction does not fit in %zu blocks", journal_capacity());
+  804dd1:	4c 89 f9             	mov    %r15,%rcx
+  804dd4:	48 ba d0 e4 80 00 00 	movabs $0x80e4d0,%rdx
+  804ddb:	00 00 00 
+  804dde:	be 75 00 00 00       	mov    $0x75,%esi
+  804de3:	48 bf 68 e4 80 00 00 	movabs $0x80e468,%rdi
+  804dea:	00 00 00 
+  804ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  804df2:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  804df9:	00 00 00 
+  804dfc:	41 ff d0             	call   *%r8
+            b = logged[i++];
+  804dff:	49 89 f4             	mov    %rsi,%r12
+  804e02:	e9 74 ff ff ff       	jmp    804d7b <journal_commit+0x15c>
+    }
+
+    for (i = 0; i < n; i++) {
+  804e07:	4d 85 ff             	test   %r15,%r15
+  804e0a:	74 63                	je     804e6f <journal_commit+0x250>
+  804e0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        res = sys_map_region(CURENVID, diskaddr(jh->j_home[i]), CURENVID, diskaddr(log + 1 + i), BLKSIZE, PROT_R);
+  804e11:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  804e14:	44 8d 60 01          	lea    0x1(%rax),%r12d
+  804e18:	49 bd f3 08 80 00 00 	movabs $0x8008f3,%r13
+  804e1f:	00 00 00 
+  804e22:	41 8d 3c 1c          	lea    (%r12,%rbx,1),%edi
+  804e26:	41 ff d5             	call   *%r13
+  804e29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804e2d:	41 8b 7c 9e 10       	mov    0x10(%r14,%rbx,4),%edi
+  804e32:	41 ff d5             	call   *%r13
+  804e35:	48 89 c6             	mov    %rax,%rsi
+  804e38:	41 b9 04 00 00 00    	mov    $0x4,%r9d
+  804e3e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804e44:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804e48:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e52:	48 b8 74 a2 80 00 00 	movabs $0x80a274,%rax
+  804e59:	00 00 00 
+  804e5c:	ff d0                	call   *%rax
+        if (res) panic("journal: can't map block %08x: %i", jh->j_home[i], res);
+  804e5e:	85 c0                	test   %eax,%eax
+  804e60:	0f 85 41 01 00 00    	jne    804fa7 <journal_commit+0x388>
+    for (i = 0; i < n; i++) {
+  804e66:	48 83 c3 01          	add    $0x1,%rbx
+  804e6a:	49 39 df             	cmp    %rbx,%r15
+  804e6d:	75 b3                	jne    804e22 <journal_commit+0x203>
+    }
+
+    jh->j_magic = JOURNAL_MAGIC;
+  804e6f:	41 c7 06 47 4f 4c 4a 	movl   $0x4a4c4f47,(%r14)
+    jh->j_seq = seq;
+  804e76:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  804e79:	41 89 46 04          	mov    %eax,0x4(%r14)
+    jh->j_nblocks = n;
+  804e7d:	45 89 7e 08          	mov    %r15d,0x8(%r14)
+    jh->j_sum = journal_sum(jh);
+  804e81:	4c 89 f7             	mov    %r14,%rdi
+  804e84:	48 b8 fb 4a 80 00 00 	movabs $0x804afb,%rax
+  804e8b:	00 00 00 
+  804e8e:	ff d0                	call   *%rax
+  804e90:	41 89 46 0c          	mov    %eax,0xc(%r14)
+
+    journal_flush();
+  804e94:	48 b8 70 4b 80 00 00 	movabs $0x804b70,%rax
+  804e9b:	00 00 00 
+  804e9e:	ff d0                	call   *%rax
+    res = nvme_write(log * BLKSECTS, jh, (count + 1) * BLKSECTS);
+  804ea0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ea4:	48 8d 14 c5 08 00 00 	lea    0x8(,%rax,8),%rdx
+  804eab:	00 
+  804eac:	8b 7d b0             	mov    -0x50(%rbp),%edi
+  804eaf:	48 c1 e7 03          	shl    $0x3,%rdi
+  804eb3:	4c 89 f6             	mov    %r14,%rsi
+  804eb6:	48 b8 38 8d 80 00 00 	movabs $0x808d38,%rax
+  804ebd:	00 00 00 
+  804ec0:	ff d0                	call   *%rax
+    if (res != NVME_OK) panic("journal: can't write transaction %u: %i", seq, res);
+  804ec2:	85 c0                	test   %eax,%eax
+  804ec4:	0f 85 10 01 00 00    	jne    804fda <journal_commit+0x3bb>
+    journal_flush();
+  804eca:	48 b8 70 4b 80 00 00 	movabs $0x804b70,%rax
+  804ed1:	00 00 00 
+  804ed4:	ff d0                	call   *%rax
+    journal_seq = seq;
+  804ed6:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  804ed9:	a3 d0 50 8c 00 00 00 	movabs %eax,0x8c50d0
+  804ee0:	00 00 
+
+    for (i = 0; i < n; i++) SETBIT(logged_map, jh->j_home[i]);
+  804ee2:	4d 85 ff             	test   %r15,%r15
+  804ee5:	74 30                	je     804f17 <journal_commit+0x2f8>
+  804ee7:	ba 00 00 00 00       	mov    $0x0,%edx
+  804eec:	48 be c0 c0 8a 00 00 	movabs $0x8ac0c0,%rsi
+  804ef3:	00 00 00 
+  804ef6:	bf 01 00 00 00       	mov    $0x1,%edi
+  804efb:	41 8b 4c 96 10       	mov    0x10(%r14,%rdx,4),%ecx
+  804f00:	89 c8                	mov    %ecx,%eax
+  804f02:	c1 e8 05             	shr    $0x5,%eax
+  804f05:	89 c0                	mov    %eax,%eax
+  804f07:	89 fb                	mov    %edi,%ebx
+  804f09:	d3 e3                	shl    %cl,%ebx
+  804f0b:	09 1c 86             	or     %ebx,(%rsi,%rax,4)
+  804f0e:	48 83 c2 01          	add    $0x1,%rdx
+  804f12:	49 39 d7             	cmp    %rdx,%r15
+  804f15:	75 e4                	jne    804efb <journal_commit+0x2dc>
+    memcpy(logged, jh->j_home, n * sizeof(blockno_t));
+  804f17:	4a 8d 14 bd 00 00 00 	lea    0x0(,%r15,4),%rdx
+  804f1e:	00 
+  804f1f:	49 8d 76 10          	lea    0x10(%r14),%rsi
+  804f23:	48 bf e0 40 8c 00 00 	movabs $0x8c40e0,%rdi
+  804f2a:	00 00 00 
+  804f2d:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  804f34:	00 00 00 
+  804f37:	ff d0                	call   *%rax
+    nlogged = n;
+  804f39:	4c 89 f8             	mov    %r15,%rax
+  804f3c:	48 a3 c0 40 8c 00 00 	movabs %rax,0x8c40c0
+  804f43:	00 00 00 
+    return (super->s_journal_len - 1) / 2;
+  804f46:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  804f4d:	00 00 00 
+  804f50:	8b 98 10 01 00 00    	mov    0x110(%rax),%ebx
+  804f56:	83 eb 01             	sub    $0x1,%ebx
+  804f59:	d1 eb                	shr    %ebx
+
+    /* Previous transaction is superseded */
+    sys_unmap_region(CURENVID, diskaddr(journal_start(seq + 1)), journal_half() * BLKSIZE);
+  804f5b:	89 db                	mov    %ebx,%ebx
+  804f5d:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804f61:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  804f64:	83 c7 02             	add    $0x2,%edi
+  804f67:	48 b8 d5 4a 80 00 00 	movabs $0x804ad5,%rax
+  804f6e:	00 00 00 
+  804f71:	ff d0                	call   *%rax
+  804f73:	89 c7                	mov    %eax,%edi
+  804f75:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  804f7c:	00 00 00 
+  804f7f:	ff d0                	call   *%rax
+  804f81:	48 89 c6             	mov    %rax,%rsi
+  804f84:	48 89 da             	mov    %rbx,%rdx
+  804f87:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f8c:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  804f93:	00 00 00 
+  804f96:	ff d0                	call   *%rax
+}
+  804f98:	48 83 c4 38          	add    $0x38,%rsp
+  804f9c:	5b                   	pop    %rbx
+  804f9d:	41 5c                	pop    %r12
+  804f9f:	41 5d                	pop    %r13
+  804fa1:	41 5e                	pop    %r14
+  804fa3:	41 5f                	pop    %r15
+  804fa5:	5d                   	pop    %rbp
+  804fa6:	c3                   	ret
+        if (res) panic("journal: can't map block %08x: %i", jh->j_home[i], res);
+  804fa7:	41 8b 4c 9e 10       	mov    0x10(%r14,%rbx,4),%ecx
+  804fac:	41 89 c0             	mov    %eax,%r8d
+  804faf:	48 ba 00 e5 80 00 00 	movabs $0x80e500,%rdx
+  804fb6:	00 00 00 
+  804fb9:	be 7b 00 00 00       	mov    $0x7b,%esi
+  804fbe:	48 bf 68 e4 80 00 00 	movabs $0x80e468,%rdi
+  804fc5:	00 00 00 
+  804fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fcd:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  804fd4:	00 00 00 
+  804fd7:	41 ff d1             	call   *%r9
+    if (res != NVME_OK) panic("journal: can't write transaction %u: %i", seq, res);
+  804fda:	41 89 c0             	mov    %eax,%r8d
+  804fdd:	8b 4d b4             	mov    -0x4c(%rbp),%ecx
+  804fe0:	48 ba 28 e5 80 00 00 	movabs $0x80e528,%rdx
+  804fe7:	00 00 00 
+  804fea:	be 85 00 00 00       	mov    $0x85,%esi
+  804fef:	48 bf 68 e4 80 00 00 	movabs $0x80e468,%rdi
+  804ff6:	00 00 00 
+  804ff9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ffe:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  805005:	00 00 00 
+  805008:	41 ff d1             	call   *%r9
+            b = blocks[j++];
+  80500b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80500f:	44 8b 2c 98          	mov    (%rax,%rbx,4),%r13d
+  805013:	48 8d 5b 01          	lea    0x1(%rbx),%rbx
+  805017:	e9 45 fd ff ff       	jmp    804d61 <journal_commit+0x142>
+
+000000000080501c <journal_checkpoint>:
+
+/* Write blocks of the last transaction to their home locations and
+ * record that replay has to skip it.  None of them may be changed
+ * since the commit, so bc_checkpoint() commits first. */
+void
+journal_checkpoint(void) {
+  80501c:	55                   	push   %rbp
+  80501d:	48 89 e5             	mov    %rsp,%rbp
+  805020:	41 56                	push   %r14
+  805022:	41 55                	push   %r13
+  805024:	41 54                	push   %r12
+  805026:	53                   	push   %rbx
+    assert(journal_on);
+  805027:	48 b8 d4 50 8c 00 00 	movabs $0x8c50d4,%rax
+  80502e:	00 00 00 
+  805031:	80 38 00             	cmpb   $0x0,(%rax)
+  805034:	74 3b                	je     805071 <journal_checkpoint+0x55>
+    for (size_t i = 0; i < nlogged;) {
+  805036:	48 a1 c0 40 8c 00 00 	movabs 0x8c40c0,%rax
+  80503d:	00 00 00 
+  805040:	bb 00 00 00 00       	mov    $0x0,%ebx
+        size_t n = 1;
+        if (!TSTBIT(logged_map, logged[i])) {
+  805045:	49 bd e0 40 8c 00 00 	movabs $0x8c40e0,%r13
+  80504c:	00 00 00 
+  80504f:	49 bc c0 c0 8a 00 00 	movabs $0x8ac0c0,%r12
+  805056:	00 00 00 
+            i++;
+            continue;
+        }
+        while (i + n < nlogged && logged[i + n] == logged[i] + n && TSTBIT(logged_map, logged[i + n])) n++;
+        bc_write_blocks(logged[i], n);
+  805059:	49 be f6 09 80 00 00 	movabs $0x8009f6,%r14
+  805060:	00 00 00 
+    for (size_t i = 0; i < nlogged;) {
+  805063:	48 85 c0             	test   %rax,%rax
+  805066:	0f 85 a4 00 00 00    	jne    805110 <journal_checkpoint+0xf4>
+  80506c:	e9 0f 01 00 00       	jmp    805180 <journal_checkpoint+0x164>
+    assert(journal_on);
+  805071:	48 b9 a7 e4 80 00 00 	movabs $0x80e4a7,%rcx
+  805078:	00 00 00 
+  80507b:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  805082:	00 00 00 
+  805085:	be 96 00 00 00       	mov    $0x96,%esi
+  80508a:	48 bf 68 e4 80 00 00 	movabs $0x80e468,%rdi
+  805091:	00 00 00 
+  805094:	b8 00 00 00 00       	mov    $0x0,%eax
+  805099:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8050a0:	00 00 00 
+  8050a3:	41 ff d0             	call   *%r8
+        while (i + n < nlogged && logged[i + n] == logged[i] + n && TSTBIT(logged_map, logged[i + n])) n++;
+  8050a6:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  8050aa:	48 39 c2             	cmp    %rax,%rdx
+  8050ad:	0f 83 84 00 00 00    	jae    805137 <journal_checkpoint+0x11b>
+  8050b3:	4d 8d 4c 9d 00       	lea    0x0(%r13,%rbx,4),%r9
+  8050b8:	48 89 d3             	mov    %rdx,%rbx
+        size_t n = 1;
+  8050bb:	be 01 00 00 00       	mov    $0x1,%esi
+        while (i + n < nlogged && logged[i + n] == logged[i] + n && TSTBIT(logged_map, logged[i + n])) n++;
+  8050c0:	44 89 c7             	mov    %r8d,%edi
+  8050c3:	41 ba 01 00 00 00    	mov    $0x1,%r10d
+  8050c9:	41 8b 0c b1          	mov    (%r9,%rsi,4),%ecx
+  8050cd:	41 89 cb             	mov    %ecx,%r11d
+  8050d0:	48 8d 14 37          	lea    (%rdi,%rsi,1),%rdx
+  8050d4:	49 39 d3             	cmp    %rdx,%r11
+  8050d7:	75 22                	jne    8050fb <journal_checkpoint+0xdf>
+  8050d9:	41 89 cb             	mov    %ecx,%r11d
+  8050dc:	41 c1 eb 05          	shr    $0x5,%r11d
+  8050e0:	45 89 db             	mov    %r11d,%r11d
+  8050e3:	44 89 d2             	mov    %r10d,%edx
+  8050e6:	d3 e2                	shl    %cl,%edx
+  8050e8:	43 23 14 9c          	and    (%r12,%r11,4),%edx
+  8050ec:	74 0d                	je     8050fb <journal_checkpoint+0xdf>
+  8050ee:	48 83 c6 01          	add    $0x1,%rsi
+  8050f2:	48 83 c3 01          	add    $0x1,%rbx
+  8050f6:	48 39 c3             	cmp    %rax,%rbx
+  8050f9:	72 ce                	jb     8050c9 <journal_checkpoint+0xad>
+        bc_write_blocks(logged[i], n);
+  8050fb:	44 89 c7             	mov    %r8d,%edi
+  8050fe:	41 ff d6             	call   *%r14
+    for (size_t i = 0; i < nlogged;) {
+  805101:	48 a1 c0 40 8c 00 00 	movabs 0x8c40c0,%rax
+  805108:	00 00 00 
+  80510b:	48 39 c3             	cmp    %rax,%rbx
+  80510e:	73 31                	jae    805141 <journal_checkpoint+0x125>
+        if (!TSTBIT(logged_map, logged[i])) {
+  805110:	45 8b 44 9d 00       	mov    0x0(%r13,%rbx,4),%r8d
+  805115:	44 89 c6             	mov    %r8d,%esi
+  805118:	c1 ee 05             	shr    $0x5,%esi
+  80511b:	89 f6                	mov    %esi,%esi
+  80511d:	ba 01 00 00 00       	mov    $0x1,%edx
+  805122:	44 89 c1             	mov    %r8d,%ecx
+  805125:	d3 e2                	shl    %cl,%edx
+  805127:	41 23 14 b4          	and    (%r12,%rsi,4),%edx
+  80512b:	0f 85 75 ff ff ff    	jne    8050a6 <journal_checkpoint+0x8a>
+            i++;
+  805131:	48 83 c3 01          	add    $0x1,%rbx
+            continue;
+  805135:	eb ca                	jmp    805101 <journal_checkpoint+0xe5>
+        while (i + n < nlogged && logged[i + n] == logged[i] + n && TSTBIT(logged_map, logged[i + n])) n++;
+  805137:	48 89 d3             	mov    %rdx,%rbx
+        size_t n = 1;
+  80513a:	be 01 00 00 00       	mov    $0x1,%esi
+  80513f:	eb ba                	jmp    8050fb <journal_checkpoint+0xdf>
+        i += n;
+    }
+    for (size_t i = 0; i < nlogged; i++) CLRBIT(logged_map, logged[i]);
+  805141:	48 85 c0             	test   %rax,%rax
+  805144:	74 3a                	je     805180 <journal_checkpoint+0x164>
+  805146:	48 ba e0 40 8c 00 00 	movabs $0x8c40e0,%rdx
+  80514d:	00 00 00 
+  805150:	4c 8d 04 82          	lea    (%rdx,%rax,4),%r8
+  805154:	48 be c0 c0 8a 00 00 	movabs $0x8ac0c0,%rsi
+  80515b:	00 00 00 
+  80515e:	bf 01 00 00 00       	mov    $0x1,%edi
+  805163:	8b 0a                	mov    (%rdx),%ecx
+  805165:	89 c8                	mov    %ecx,%eax
+  805167:	c1 e8 05             	shr    $0x5,%eax
+  80516a:	89 c0                	mov    %eax,%eax
+  80516c:	89 fb                	mov    %edi,%ebx
+  80516e:	d3 e3                	shl    %cl,%ebx
+  805170:	89 d9                	mov    %ebx,%ecx
+  805172:	f7 d1                	not    %ecx
+  805174:	21 0c 86             	and    %ecx,(%rsi,%rax,4)
+  805177:	48 83 c2 04          	add    $0x4,%rdx
+  80517b:	4c 39 c2             	cmp    %r8,%rdx
+  80517e:	75 e3                	jne    805163 <journal_checkpoint+0x147>
+    nlogged = 0;
+  805180:	48 b8 c0 40 8c 00 00 	movabs $0x8c40c0,%rax
+  805187:	00 00 00 
+  80518a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+
+    struct JournalHeader *jh = diskaddr(super->s_journal);
+  805191:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  805198:	00 00 00 
+  80519b:	8b b8 0c 01 00 00    	mov    0x10c(%rax),%edi
+  8051a1:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  8051a8:	00 00 00 
+  8051ab:	ff d0                	call   *%rax
+  8051ad:	48 89 c3             	mov    %rax,%rbx
+    /* Old contents are overwritten, so there is no need to read them */
+    int res = sys_alloc_region(CURENVID, jh, BLKSIZE, PROT_RW);
+  8051b0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8051b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8051ba:	48 89 c6             	mov    %rax,%rsi
+  8051bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051c2:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  8051c9:	00 00 00 
+  8051cc:	ff d0                	call   *%rax
+    if (res) panic("journal: can't map header: %i", res);
+  8051ce:	85 c0                	test   %eax,%eax
+  8051d0:	0f 85 95 00 00 00    	jne    80526b <journal_checkpoint+0x24f>
+    jh->j_magic = JOURNAL_MAGIC;
+  8051d6:	c7 03 47 4f 4c 4a    	movl   $0x4a4c4f47,(%rbx)
+    jh->j_seq = journal_seq;
+  8051dc:	a1 d0 50 8c 00 00 00 	movabs 0x8c50d0,%eax
+  8051e3:	00 00 
+  8051e5:	89 43 04             	mov    %eax,0x4(%rbx)
+    jh->j_nblocks = 0;
+  8051e8:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%rbx)
+    jh->j_sum = 0;
+  8051ef:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%rbx)
+
+    journal_flush();
+  8051f6:	48 b8 70 4b 80 00 00 	movabs $0x804b70,%rax
+  8051fd:	00 00 00 
+  805200:	ff d0                	call   *%rax
+    res = nvme_write(super->s_journal * BLKSECTS, jh, BLKSECTS);
+  805202:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  805209:	00 00 00 
+  80520c:	8b b8 0c 01 00 00    	mov    0x10c(%rax),%edi
+  805212:	48 c1 e7 03          	shl    $0x3,%rdi
+  805216:	ba 08 00 00 00       	mov    $0x8,%edx
+  80521b:	48 89 de             	mov    %rbx,%rsi
+  80521e:	48 b8 38 8d 80 00 00 	movabs $0x808d38,%rax
+  805225:	00 00 00 
+  805228:	ff d0                	call   *%rax
+    if (res != NVME_OK) panic("journal: can't write header: %i", res);
+  80522a:	85 c0                	test   %eax,%eax
+  80522c:	75 6a                	jne    805298 <journal_checkpoint+0x27c>
+    journal_flush();
+  80522e:	48 b8 70 4b 80 00 00 	movabs $0x804b70,%rax
+  805235:	00 00 00 
+  805238:	ff d0                	call   *%rax
+
+    /* Nothing in the log is needed until next commit */
+    sys_unmap_region(CURENVID, jh, super->s_journal_len * BLKSIZE);
+  80523a:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  805241:	00 00 00 
+  805244:	8b 90 10 01 00 00    	mov    0x110(%rax),%edx
+  80524a:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80524e:	48 89 de             	mov    %rbx,%rsi
+  805251:	bf 00 00 00 00       	mov    $0x0,%edi
+  805256:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  80525d:	00 00 00 
+  805260:	ff d0                	call   *%rax
+}
+  805262:	5b                   	pop    %rbx
+  805263:	41 5c                	pop    %r12
+  805265:	41 5d                	pop    %r13
+  805267:	41 5e                	pop    %r14
+  805269:	5d                   	pop    %rbp
+  80526a:	c3                   	ret
+    if (res) panic("journal: can't map header: %i", res);
+  80526b:	89 c1                	mov    %eax,%ecx
+  80526d:	48 ba 89 e4 80 00 00 	movabs $0x80e489,%rdx
+  805274:	00 00 00 
+  805277:	be a7 00 00 00       	mov    $0xa7,%esi
+  80527c:	48 bf 68 e4 80 00 00 	movabs $0x80e468,%rdi
+  805283:	00 00 00 
+  805286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80528b:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  805292:	00 00 00 
+  805295:	41 ff d0             	call   *%r8
+    if (res != NVME_OK) panic("journal: can't write header: %i", res);
+  805298:	89 c1                	mov    %eax,%ecx
+  80529a:	48 ba 50 e5 80 00 00 	movabs $0x80e550,%rdx
+  8052a1:	00 00 00 
+  8052a4:	be af 00 00 00       	mov    $0xaf,%esi
+  8052a9:	48 bf 68 e4 80 00 00 	movabs $0x80e468,%rdi
+  8052b0:	00 00 00 
+  8052b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052b8:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8052bf:	00 00 00 
+  8052c2:	41 ff d0             	call   *%r8
+
+00000000008052c5 <journal_init>:
+/* Replay the latest committed transaction unless it was
+ * checkpointed, and start journaling.  Called again by
+ * tests to see what the server would find after a crash. */
+void
+journal_init(void) {
+    if (!(super->s_features & FS_FEATURE_JOURNAL)) return;
+  8052c5:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  8052cc:	00 00 00 
+  8052cf:	f6 80 08 01 00 00 02 	testb  $0x2,0x108(%rax)
+  8052d6:	0f 84 a7 02 00 00    	je     805583 <journal_init+0x2be>
+journal_init(void) {
+  8052dc:	55                   	push   %rbp
+  8052dd:	48 89 e5             	mov    %rsp,%rbp
+  8052e0:	41 57                	push   %r15
+  8052e2:	41 56                	push   %r14
+  8052e4:	41 55                	push   %r13
+  8052e6:	41 54                	push   %r12
+  8052e8:	53                   	push   %rbx
+  8052e9:	48 83 ec 18          	sub    $0x18,%rsp
+
+    if (super->s_journal < 2 || super->s_journal_len < 4 ||
+  8052ed:	44 8b 88 0c 01 00 00 	mov    0x10c(%rax),%r9d
+  8052f4:	41 83 f9 01          	cmp    $0x1,%r9d
+  8052f8:	0f 86 ed 00 00 00    	jbe    8053eb <journal_init+0x126>
+  8052fe:	44 8b 90 10 01 00 00 	mov    0x110(%rax),%r10d
+  805305:	41 83 fa 03          	cmp    $0x3,%r10d
+  805309:	0f 86 dc 00 00 00    	jbe    8053eb <journal_init+0x126>
+        super->s_journal + super->s_journal_len > super->s_nblocks)
+  80530f:	43 8d 14 11          	lea    (%r9,%r10,1),%edx
+    if (super->s_journal < 2 || super->s_journal_len < 4 ||
+  805313:	39 50 04             	cmp    %edx,0x4(%rax)
+  805316:	0f 82 cf 00 00 00    	jb     8053eb <journal_init+0x126>
+        panic("bad journal location %u+%u", super->s_journal, super->s_journal_len);
+
+    journal_on = 0;
+  80531c:	48 b8 d4 50 8c 00 00 	movabs $0x8c50d4,%rax
+  805323:	00 00 00 
+  805326:	c6 00 00             	movb   $0x0,(%rax)
+    for (size_t i = 0; i < nlogged; i++) CLRBIT(logged_map, logged[i]);
+  805329:	48 a1 c0 40 8c 00 00 	movabs 0x8c40c0,%rax
+  805330:	00 00 00 
+  805333:	48 85 c0             	test   %rax,%rax
+  805336:	74 3a                	je     805372 <journal_init+0xad>
+  805338:	48 ba e0 40 8c 00 00 	movabs $0x8c40e0,%rdx
+  80533f:	00 00 00 
+  805342:	4c 8d 04 82          	lea    (%rdx,%rax,4),%r8
+  805346:	48 be c0 c0 8a 00 00 	movabs $0x8ac0c0,%rsi
+  80534d:	00 00 00 
+  805350:	bf 01 00 00 00       	mov    $0x1,%edi
+  805355:	8b 0a                	mov    (%rdx),%ecx
+  805357:	89 c8                	mov    %ecx,%eax
+  805359:	c1 e8 05             	shr    $0x5,%eax
+  80535c:	89 c0                	mov    %eax,%eax
+  80535e:	89 fb                	mov    %edi,%ebx
+  805360:	d3 e3                	shl    %cl,%ebx
+  805362:	89 d9                	mov    %ebx,%ecx
+  805364:	f7 d1                	not    %ecx
+  805366:	21 0c 86             	and    %ecx,(%rsi,%rax,4)
+  805369:	48 83 c2 04          	add    $0x4,%rdx
+  80536d:	4c 39 c2             	cmp    %r8,%rdx
+  805370:	75 e3                	jne    805355 <journal_init+0x90>
+    nlogged = 0;
+  805372:	48 b8 c0 40 8c 00 00 	movabs $0x8c40c0,%rax
+  805379:	00 00 00 
+  80537c:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    /* Read the log from disk, not through mappings of last commit */
+    bc_drop(super->s_journal, super->s_journal_len);
+  805383:	44 89 d6             	mov    %r10d,%esi
+  805386:	44 89 cf             	mov    %r9d,%edi
+  805389:	48 b8 e9 0d 80 00 00 	movabs $0x800de9,%rax
+  805390:	00 00 00 
+  805393:	ff d0                	call   *%rax
+    struct JournalHeader *jh = diskaddr(super->s_journal);
+  805395:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  80539c:	00 00 00 
+  80539f:	8b b8 0c 01 00 00    	mov    0x10c(%rax),%edi
+  8053a5:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  8053ac:	00 00 00 
+  8053af:	ff d0                	call   *%rax
+  8053b1:	48 89 c2             	mov    %rax,%rdx
+    journal_seq = jh->j_magic == JOURNAL_MAGIC ? jh->j_seq : 0;
+  8053b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053b9:	81 3a 47 4f 4c 4a    	cmpl   $0x4a4c4f47,(%rdx)
+  8053bf:	74 5f                	je     805420 <journal_init+0x15b>
+  8053c1:	a3 d0 50 8c 00 00 00 	movabs %eax,0x8c50d0
+  8053c8:	00 00 
+
+    /* Transaction torn by a crash fails the checksum */
+    struct JournalHeader *last = NULL;
+    for (uint32_t half = 0; half < 2; half++) {
+  8053ca:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    struct JournalHeader *last = NULL;
+  8053d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+        struct JournalHeader *t = diskaddr(journal_start(half));
+  8053d5:	49 bf d5 4a 80 00 00 	movabs $0x804ad5,%r15
+  8053dc:	00 00 00 
+  8053df:	49 be f3 08 80 00 00 	movabs $0x8008f3,%r14
+  8053e6:	00 00 00 
+  8053e9:	eb 47                	jmp    805432 <journal_init+0x16d>
+        panic("bad journal location %u+%u", super->s_journal, super->s_journal_len);
+  8053eb:	44 8b 80 10 01 00 00 	mov    0x110(%rax),%r8d
+  8053f2:	44 89 c9             	mov    %r9d,%ecx
+  8053f5:	48 ba b2 e4 80 00 00 	movabs $0x80e4b2,%rdx
+  8053fc:	00 00 00 
+  8053ff:	be bf 00 00 00       	mov    $0xbf,%esi
+  805404:	48 bf 68 e4 80 00 00 	movabs $0x80e468,%rdi
+  80540b:	00 00 00 
+  80540e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805413:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80541a:	00 00 00 
+  80541d:	41 ff d1             	call   *%r9
+    journal_seq = jh->j_magic == JOURNAL_MAGIC ? jh->j_seq : 0;
+  805420:	8b 42 04             	mov    0x4(%rdx),%eax
+  805423:	eb 9c                	jmp    8053c1 <journal_init+0xfc>
+        if (t->j_magic != JOURNAL_MAGIC || t->j_seq <= journal_seq ||
+            t->j_seq % 2 != half || t->j_nblocks > journal_capacity() ||
+            t->j_sum != journal_sum(t)) continue;
+        if (!last || t->j_seq > last->j_seq) last = t;
+  805425:	4c 89 e3             	mov    %r12,%rbx
+    for (uint32_t half = 0; half < 2; half++) {
+  805428:	41 83 c5 01          	add    $0x1,%r13d
+  80542c:	41 83 fd 02          	cmp    $0x2,%r13d
+  805430:	74 7b                	je     8054ad <journal_init+0x1e8>
+        struct JournalHeader *t = diskaddr(journal_start(half));
+  805432:	44 89 ef             	mov    %r13d,%edi
+  805435:	41 ff d7             	call   *%r15
+  805438:	89 c7                	mov    %eax,%edi
+  80543a:	41 ff d6             	call   *%r14
+  80543d:	49 89 c4             	mov    %rax,%r12
+        if (t->j_magic != JOURNAL_MAGIC || t->j_seq <= journal_seq ||
+  805440:	81 38 47 4f 4c 4a    	cmpl   $0x4a4c4f47,(%rax)
+  805446:	75 e0                	jne    805428 <journal_init+0x163>
+  805448:	8b 40 04             	mov    0x4(%rax),%eax
+  80544b:	48 be d0 50 8c 00 00 	movabs $0x8c50d0,%rsi
+  805452:	00 00 00 
+  805455:	39 06                	cmp    %eax,(%rsi)
+  805457:	73 cf                	jae    805428 <journal_init+0x163>
+            t->j_seq % 2 != half || t->j_nblocks > journal_capacity() ||
+  805459:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80545c:	83 e0 01             	and    $0x1,%eax
+        if (t->j_magic != JOURNAL_MAGIC || t->j_seq <= journal_seq ||
+  80545f:	44 39 e8             	cmp    %r13d,%eax
+  805462:	75 c4                	jne    805428 <journal_init+0x163>
+            t->j_seq % 2 != half || t->j_nblocks > journal_capacity() ||
+  805464:	48 b8 bd 4b 80 00 00 	movabs $0x804bbd,%rax
+  80546b:	00 00 00 
+  80546e:	ff d0                	call   *%rax
+  805470:	48 89 c2             	mov    %rax,%rdx
+  805473:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  805478:	48 39 c2             	cmp    %rax,%rdx
+  80547b:	72 ab                	jb     805428 <journal_init+0x163>
+            t->j_sum != journal_sum(t)) continue;
+  80547d:	41 8b 74 24 0c       	mov    0xc(%r12),%esi
+  805482:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805485:	4c 89 e7             	mov    %r12,%rdi
+  805488:	48 b8 fb 4a 80 00 00 	movabs $0x804afb,%rax
+  80548f:	00 00 00 
+  805492:	ff d0                	call   *%rax
+            t->j_seq % 2 != half || t->j_nblocks > journal_capacity() ||
+  805494:	39 45 c8             	cmp    %eax,-0x38(%rbp)
+  805497:	75 8f                	jne    805428 <journal_init+0x163>
+        if (!last || t->j_seq > last->j_seq) last = t;
+  805499:	48 85 db             	test   %rbx,%rbx
+  80549c:	74 87                	je     805425 <journal_init+0x160>
+  80549e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8054a1:	39 43 04             	cmp    %eax,0x4(%rbx)
+  8054a4:	49 0f 42 dc          	cmovb  %r12,%rbx
+  8054a8:	e9 7b ff ff ff       	jmp    805428 <journal_init+0x163>
+    }
+
+    if (last) {
+  8054ad:	48 85 db             	test   %rbx,%rbx
+  8054b0:	74 7b                	je     80552d <journal_init+0x268>
+        for (uint32_t i = 0; i < last->j_nblocks; i++)
+  8054b2:	8b 73 08             	mov    0x8(%rbx),%esi
+  8054b5:	85 f6                	test   %esi,%esi
+  8054b7:	74 4a                	je     805503 <journal_init+0x23e>
+  8054b9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+            memmove(diskaddr(last->j_home[i]), (char *)last + (i + 1) * BLKSIZE, BLKSIZE);
+  8054bf:	49 bf f3 08 80 00 00 	movabs $0x8008f3,%r15
+  8054c6:	00 00 00 
+  8054c9:	49 be 3b 9e 80 00 00 	movabs $0x809e3b,%r14
+  8054d0:	00 00 00 
+  8054d3:	44 89 e8             	mov    %r13d,%eax
+  8054d6:	41 83 c5 01          	add    $0x1,%r13d
+  8054da:	45 89 ec             	mov    %r13d,%r12d
+  8054dd:	49 c1 e4 0c          	shl    $0xc,%r12
+  8054e1:	49 01 dc             	add    %rbx,%r12
+  8054e4:	89 c0                	mov    %eax,%eax
+  8054e6:	8b 7c 83 10          	mov    0x10(%rbx,%rax,4),%edi
+  8054ea:	41 ff d7             	call   *%r15
+  8054ed:	48 89 c7             	mov    %rax,%rdi
+  8054f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8054f5:	4c 89 e6             	mov    %r12,%rsi
+  8054f8:	41 ff d6             	call   *%r14
+        for (uint32_t i = 0; i < last->j_nblocks; i++)
+  8054fb:	8b 73 08             	mov    0x8(%rbx),%esi
+  8054fe:	41 39 f5             	cmp    %esi,%r13d
+  805501:	72 d0                	jb     8054d3 <journal_init+0x20e>
+        cprintf("journal: replayed %u blocks of transaction %u\n", last->j_nblocks, last->j_seq);
+  805503:	8b 53 04             	mov    0x4(%rbx),%edx
+  805506:	48 bf 70 e5 80 00 00 	movabs $0x80e570,%rdi
+  80550d:	00 00 00 
+  805510:	b8 00 00 00 00       	mov    $0x0,%eax
+  805515:	48 b9 35 91 80 00 00 	movabs $0x809135,%rcx
+  80551c:	00 00 00 
+  80551f:	ff d1                	call   *%rcx
+        journal_seq = last->j_seq;
+  805521:	8b 43 04             	mov    0x4(%rbx),%eax
+  805524:	a3 d0 50 8c 00 00 00 	movabs %eax,0x8c50d0
+  80552b:	00 00 
+    }
+
+    /* Written in place since journaling is not on yet */
+    bc_sync();
+  80552d:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  805534:	00 00 00 
+  805537:	ff d0                	call   *%rax
+    bc_drop(super->s_journal, super->s_journal_len);
+  805539:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  805540:	00 00 00 
+  805543:	8b b0 10 01 00 00    	mov    0x110(%rax),%esi
+  805549:	8b b8 0c 01 00 00    	mov    0x10c(%rax),%edi
+  80554f:	48 b8 e9 0d 80 00 00 	movabs $0x800de9,%rax
+  805556:	00 00 00 
+  805559:	ff d0                	call   *%rax
+
+    journal_on = 1;
+  80555b:	48 b8 d4 50 8c 00 00 	movabs $0x8c50d4,%rax
+  805562:	00 00 00 
+  805565:	c6 00 01             	movb   $0x1,(%rax)
+    journal_checkpoint();
+  805568:	48 b8 1c 50 80 00 00 	movabs $0x80501c,%rax
+  80556f:	00 00 00 
+  805572:	ff d0                	call   *%rax
+}
+  805574:	48 83 c4 18          	add    $0x18,%rsp
+  805578:	5b                   	pop    %rbx
+  805579:	41 5c                	pop    %r12
+  80557b:	41 5d                	pop    %r13
+  80557d:	41 5e                	pop    %r14
+  80557f:	41 5f                	pop    %r15
+  805581:	5d                   	pop    %rbp
+  805582:	c3                   	ret
+  805583:	c3                   	ret
+
+0000000000805584 <openfile_free>:
+}
+
+/* Free an open file.  Its Fd page is dropped rather than reused,
+ * so clients still holding the old page never see the next file. */
+static void
+openfile_free(struct OpenFile *o) {
+  805584:	55                   	push   %rbp
+  805585:	48 89 e5             	mov    %rsp,%rbp
+  805588:	53                   	push   %rbx
+  805589:	48 83 ec 08          	sub    $0x8,%rsp
+  80558d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, o->o_fd, PAGE_SIZE));
+  805590:	48 8b 77 18          	mov    0x18(%rdi),%rsi
+  805594:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805599:	bf 00 00 00 00       	mov    $0x0,%edi
+  80559e:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  8055a5:	00 00 00 
+  8055a8:	ff d0                	call   *%rax
+    o->o_file = NULL;
+  8055aa:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8055b1:	00 
+    o->o_next = openfile_freelist;
+  8055b2:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  8055b9:	00 00 00 
+  8055bc:	8b 10                	mov    (%rax),%edx
+  8055be:	89 53 20             	mov    %edx,0x20(%rbx)
+    openfile_freelist = o - opentab;
+  8055c1:	48 ba 80 00 81 00 00 	movabs $0x810080,%rdx
+  8055c8:	00 00 00 
+  8055cb:	48 29 d3             	sub    %rdx,%rbx
+  8055ce:	48 c1 fb 03          	sar    $0x3,%rbx
+  8055d2:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  8055d9:	cc cc cc 
+  8055dc:	48 0f af da          	imul   %rdx,%rbx
+  8055e0:	89 18                	mov    %ebx,(%rax)
+}
+  8055e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055e6:	c9                   	leave
+  8055e7:	c3                   	ret
+
+00000000008055e8 <serve_sync>:
+
+    return file_remove(path);
+}
+
+int
+serve_sync(envid_t envid, union Fsipc *req) {
+  8055e8:	55                   	push   %rbp
+  8055e9:	48 89 e5             	mov    %rsp,%rbp
+    fs_sync();
+  8055ec:	48 b8 c3 4a 80 00 00 	movabs $0x804ac3,%rax
+  8055f3:	00 00 00 
+  8055f6:	ff d0                	call   *%rax
+                (unsigned long)bc_stats.wb_blocks, (unsigned long)bc_stats.commits,
+                (unsigned long)bc_stats.logged_blocks, (unsigned long)bc_stats.checkpoints,
+                (unsigned long)bc_stats.async_reads,
+                (unsigned long)nsuspended);
+    return 0;
+}
+  8055f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055fd:	5d                   	pop    %rbp
+  8055fe:	c3                   	ret
+
+00000000008055ff <serve_remove>:
+serve_remove(envid_t envid, union Fsipc *ipc) {
+  8055ff:	55                   	push   %rbp
+  805600:	48 89 e5             	mov    %rsp,%rbp
+  805603:	41 57                	push   %r15
+  805605:	41 56                	push   %r14
+  805607:	41 55                	push   %r13
+  805609:	41 54                	push   %r12
+  80560b:	53                   	push   %rbx
+  80560c:	48 81 ec 18 04 00 00 	sub    $0x418,%rsp
+    memmove(path, req->req_path, MAXPATHLEN);
+  805613:	ba 00 04 00 00       	mov    $0x400,%edx
+  805618:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  80561f:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  805626:	00 00 00 
+  805629:	ff d0                	call   *%rax
+    path[MAXPATHLEN - 1] = 0;
+  80562b:	c6 45 cf 00          	movb   $0x0,-0x31(%rbp)
+    if ((res = file_open(path, &f)) < 0) return res;
+  80562f:	48 8d b5 c8 fb ff ff 	lea    -0x438(%rbp),%rsi
+  805636:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  80563d:	48 b8 5b 46 80 00 00 	movabs $0x80465b,%rax
+  805644:	00 00 00 
+  805647:	ff d0                	call   *%rax
+  805649:	85 c0                	test   %eax,%eax
+  80564b:	78 70                	js     8056bd <serve_remove+0xbe>
+  80564d:	48 bb 80 00 81 00 00 	movabs $0x810080,%rbx
+  805654:	00 00 00 
+  805657:	4c 8d ab 00 50 00 00 	lea    0x5000(%rbx),%r13
+        if (sys_region_refs(opentab[i].o_fd, PAGE_SIZE) > 1) return -E_FILE_EXISTS;
+  80565e:	49 be af a1 80 00 00 	movabs $0x80a1af,%r14
+  805665:	00 00 00 
+        openfile_free(&opentab[i]);
+  805668:	49 bf 84 55 80 00 00 	movabs $0x805584,%r15
+  80566f:	00 00 00 
+  805672:	eb 09                	jmp    80567d <serve_remove+0x7e>
+    for (int i = 0; i < MAXOPEN; i++) {
+  805674:	48 83 c3 28          	add    $0x28,%rbx
+  805678:	4c 39 eb             	cmp    %r13,%rbx
+  80567b:	74 26                	je     8056a3 <serve_remove+0xa4>
+        if (opentab[i].o_file != f) continue;
+  80567d:	48 8b 85 c8 fb ff ff 	mov    -0x438(%rbp),%rax
+  805684:	48 39 43 08          	cmp    %rax,0x8(%rbx)
+  805688:	75 ea                	jne    805674 <serve_remove+0x75>
+        if (sys_region_refs(opentab[i].o_fd, PAGE_SIZE) > 1) return -E_FILE_EXISTS;
+  80568a:	48 8b 7b 18          	mov    0x18(%rbx),%rdi
+  80568e:	be 00 10 00 00       	mov    $0x1000,%esi
+  805693:	41 ff d6             	call   *%r14
+  805696:	83 f8 01             	cmp    $0x1,%eax
+  805699:	7f 1d                	jg     8056b8 <serve_remove+0xb9>
+        openfile_free(&opentab[i]);
+  80569b:	48 89 df             	mov    %rbx,%rdi
+  80569e:	41 ff d7             	call   *%r15
+  8056a1:	eb d1                	jmp    805674 <serve_remove+0x75>
+    return file_remove(path);
+  8056a3:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  8056aa:	48 b8 98 48 80 00 00 	movabs $0x804898,%rax
+  8056b1:	00 00 00 
+  8056b4:	ff d0                	call   *%rax
+  8056b6:	eb 05                	jmp    8056bd <serve_remove+0xbe>
+        if (sys_region_refs(opentab[i].o_fd, PAGE_SIZE) > 1) return -E_FILE_EXISTS;
+  8056b8:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+}
+  8056bd:	48 81 c4 18 04 00 00 	add    $0x418,%rsp
+  8056c4:	5b                   	pop    %rbx
+  8056c5:	41 5c                	pop    %r12
+  8056c7:	41 5d                	pop    %r13
+  8056c9:	41 5e                	pop    %r14
+  8056cb:	41 5f                	pop    %r15
+  8056cd:	5d                   	pop    %rbp
+  8056ce:	c3                   	ret
+
+00000000008056cf <serve_stats>:
+
+int
+serve_stats(envid_t envid, union Fsipc *ipc) {
+  8056cf:	55                   	push   %rbp
+  8056d0:	48 89 e5             	mov    %rsp,%rbp
+  8056d3:	41 55                	push   %r13
+  8056d5:	41 54                	push   %r12
+  8056d7:	53                   	push   %rbx
+  8056d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8056dc:	48 89 f3             	mov    %rsi,%rbx
+    bool reset = ipc->stats.req_reset;
+  8056df:	44 8b 26             	mov    (%rsi),%r12d
+    struct Fsret_stats *ret = &ipc->statsRet;
+
+    static_assert(sizeof(struct Fsret_stats) <= PAGE_SIZE, "Fsret_stats does not fit in a page");
+
+    memcpy(ret->ret_req, reqstats, sizeof(reqstats));
+  8056e2:	ba 00 06 00 00       	mov    $0x600,%edx
+  8056e7:	48 be e0 50 8c 00 00 	movabs $0x8c50e0,%rsi
+  8056ee:	00 00 00 
+  8056f1:	48 89 df             	mov    %rbx,%rdi
+  8056f4:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  8056fb:	00 00 00 
+  8056fe:	ff d0                	call   *%rax
+    ret->ret_tsc_freq = tsc_freq;
+  805700:	48 a1 80 50 81 00 00 	movabs 0x815080,%rax
+  805707:	00 00 00 
+  80570a:	48 89 83 00 06 00 00 	mov    %rax,0x600(%rbx)
+    ret->ret_suspended = nsuspended;
+  805711:	48 a1 e0 56 8c 00 00 	movabs 0x8c56e0,%rax
+  805718:	00 00 00 
+  80571b:	48 89 83 08 06 00 00 	mov    %rax,0x608(%rbx)
+    ret->ret_bc_hits = bc_stats.hits;
+  805722:	48 b8 20 60 81 00 00 	movabs $0x816020,%rax
+  805729:	00 00 00 
+  80572c:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  805730:	48 89 93 10 06 00 00 	mov    %rdx,0x610(%rbx)
+    ret->ret_bc_misses = bc_stats.faults + bc_stats.direct_reads;
+  805737:	48 8b 50 58          	mov    0x58(%rax),%rdx
+  80573b:	48 03 10             	add    (%rax),%rdx
+  80573e:	48 89 93 18 06 00 00 	mov    %rdx,0x618(%rbx)
+    ret->ret_bc_readahead = bc_stats.ra_blocks;
+  805745:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  805749:	48 89 93 20 06 00 00 	mov    %rdx,0x620(%rbx)
+    ret->ret_bc_evictions = bc_stats.evictions;
+  805750:	48 8b 50 68          	mov    0x68(%rax),%rdx
+  805754:	48 89 93 28 06 00 00 	mov    %rdx,0x628(%rbx)
+    ret->ret_bc_resident = bc_stats.resident;
+  80575b:	4c 8b 68 70          	mov    0x70(%rax),%r13
+  80575f:	4c 89 ab 30 06 00 00 	mov    %r13,0x630(%rbx)
+    ret->ret_disk_reads = nvme_stats.reads;
+  805766:	48 b8 40 60 8c 00 00 	movabs $0x8c6040,%rax
+  80576d:	00 00 00 
+  805770:	48 8b 10             	mov    (%rax),%rdx
+  805773:	48 89 93 38 06 00 00 	mov    %rdx,0x638(%rbx)
+    ret->ret_disk_writes = nvme_stats.writes;
+  80577a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80577e:	48 89 93 40 06 00 00 	mov    %rdx,0x640(%rbx)
+    ret->ret_disk_read_bytes = nvme_stats.read_bytes;
+  805785:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805789:	48 89 93 48 06 00 00 	mov    %rdx,0x648(%rbx)
+    ret->ret_disk_write_bytes = nvme_stats.write_bytes;
+  805790:	48 8b 40 18          	mov    0x18(%rax),%rax
+  805794:	48 89 83 50 06 00 00 	mov    %rax,0x650(%rbx)
+
+    if (reset) {
+  80579b:	45 85 e4             	test   %r12d,%r12d
+  80579e:	75 10                	jne    8057b0 <serve_stats+0xe1>
+        memset(&nvme_stats, 0, sizeof(nvme_stats));
+        memset(reqstats, 0, sizeof(reqstats));
+        nsuspended = 0;
+    }
+    return 0;
+}
+  8057a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057a5:	48 83 c4 08          	add    $0x8,%rsp
+  8057a9:	5b                   	pop    %rbx
+  8057aa:	41 5c                	pop    %r12
+  8057ac:	41 5d                	pop    %r13
+  8057ae:	5d                   	pop    %rbp
+  8057af:	c3                   	ret
+        memset(&bc_stats, 0, sizeof(bc_stats));
+  8057b0:	ba 78 00 00 00       	mov    $0x78,%edx
+  8057b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8057ba:	49 bc 20 60 81 00 00 	movabs $0x816020,%r12
+  8057c1:	00 00 00 
+  8057c4:	4c 89 e7             	mov    %r12,%rdi
+  8057c7:	48 bb 8d 9d 80 00 00 	movabs $0x809d8d,%rbx
+  8057ce:	00 00 00 
+  8057d1:	ff d3                	call   *%rbx
+        bc_stats.resident = resident;
+  8057d3:	4d 89 6c 24 70       	mov    %r13,0x70(%r12)
+        memset(&nvme_stats, 0, sizeof(nvme_stats));
+  8057d8:	ba 28 00 00 00       	mov    $0x28,%edx
+  8057dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8057e2:	48 bf 40 60 8c 00 00 	movabs $0x8c6040,%rdi
+  8057e9:	00 00 00 
+  8057ec:	ff d3                	call   *%rbx
+        memset(reqstats, 0, sizeof(reqstats));
+  8057ee:	ba 00 06 00 00       	mov    $0x600,%edx
+  8057f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8057f8:	48 bf e0 50 8c 00 00 	movabs $0x8c50e0,%rdi
+  8057ff:	00 00 00 
+  805802:	ff d3                	call   *%rbx
+        nsuspended = 0;
+  805804:	48 b8 e0 56 8c 00 00 	movabs $0x8c56e0,%rax
+  80580b:	00 00 00 
+  80580e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  805815:	eb 89                	jmp    8057a0 <serve_stats+0xd1>
+
+0000000000805817 <suspend_request>:
+        [FSREQ_STATS] = serve_stats};
+#define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
+
+/* Called by block cache instead of waiting for a read */
+static void
+suspend_request(int slot) {
+  805817:	55                   	push   %rbp
+  805818:	48 89 e5             	mov    %rsp,%rbp
+    running->c_slot = slot;
+  80581b:	48 a1 40 57 8c 00 00 	movabs 0x8c5740,%rax
+  805822:	00 00 00 
+  805825:	89 78 18             	mov    %edi,0x18(%rax)
+    bc_suspend = NULL;
+  805828:	48 b8 00 60 81 00 00 	movabs $0x816000,%rax
+  80582f:	00 00 00 
+  805832:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    nsuspended++;
+  805839:	48 b8 e0 56 8c 00 00 	movabs $0x8c56e0,%rax
+  805840:	00 00 00 
+  805843:	48 83 00 01          	addq   $0x1,(%rax)
+    longjmp(suspend_point, 1);
+  805847:	be 01 00 00 00       	mov    $0x1,%esi
+  80584c:	48 bf 00 57 8c 00 00 	movabs $0x8c5700,%rdi
+  805853:	00 00 00 
+  805856:	48 b8 1b af 80 00 00 	movabs $0x80af1b,%rax
+  80585d:	00 00 00 
+  805860:	ff d0                	call   *%rax
+
+0000000000805862 <serve_init>:
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  805862:	48 b8 80 00 81 00 00 	movabs $0x810080,%rax
+  805869:	00 00 00 
+  80586c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    uintptr_t va = FILE_BASE;
+  805871:	48 ba 00 00 00 00 02 	movabs $0x200000000,%rdx
+  805878:	00 00 00 
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  80587b:	48 be 00 00 20 00 02 	movabs $0x200200000,%rsi
+  805882:	00 00 00 
+        opentab[i].o_fileid = i;
+  805885:	89 08                	mov    %ecx,(%rax)
+        opentab[i].o_file = NULL;
+  805887:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+  80588e:	00 
+        opentab[i].o_fd = (struct Fd *)va;
+  80588f:	48 89 50 18          	mov    %rdx,0x18(%rax)
+        va += PAGE_SIZE;
+  805893:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  80589a:	48 83 c1 01          	add    $0x1,%rcx
+  80589e:	48 83 c0 28          	add    $0x28,%rax
+  8058a2:	48 39 f2             	cmp    %rsi,%rdx
+  8058a5:	75 de                	jne    805885 <serve_init+0x23>
+  8058a7:	a1 60 00 81 00 00 00 	movabs 0x810060,%eax
+  8058ae:	00 00 
+  8058b0:	48 b9 78 50 81 00 00 	movabs $0x815078,%rcx
+  8058b7:	00 00 00 
+    for (int i = MAXOPEN - 1; i >= 0; i--) {
+  8058ba:	ba ff 01 00 00       	mov    $0x1ff,%edx
+  8058bf:	eb 02                	jmp    8058c3 <serve_init+0x61>
+  8058c1:	89 f2                	mov    %esi,%edx
+        opentab[i].o_next = openfile_freelist;
+  8058c3:	89 01                	mov    %eax,(%rcx)
+    for (int i = MAXOPEN - 1; i >= 0; i--) {
+  8058c5:	8d 72 ff             	lea    -0x1(%rdx),%esi
+  8058c8:	48 83 e9 28          	sub    $0x28,%rcx
+        openfile_freelist = i;
+  8058cc:	89 d0                	mov    %edx,%eax
+    for (int i = MAXOPEN - 1; i >= 0; i--) {
+  8058ce:	85 d2                	test   %edx,%edx
+  8058d0:	75 ef                	jne    8058c1 <serve_init+0x5f>
+  8058d2:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  8058d9:	00 00 00 
+  8058dc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  8058e2:	48 ba 60 57 8c 00 00 	movabs $0x8c5760,%rdx
+  8058e9:	00 00 00 
+  8058ec:	b8 00 00 00 0f       	mov    $0xf000000,%eax
+        contexts[i].c_ipc = (union Fsipc *)(FSREQ_BASE + i * FSREQ_SIZE);
+  8058f1:	48 89 02             	mov    %rax,(%rdx)
+    for (size_t i = 0; i < NCONTEXTS; i++)
+  8058f4:	48 05 00 10 04 00    	add    $0x41000,%rax
+  8058fa:	48 83 c2 38          	add    $0x38,%rdx
+  8058fe:	48 3d 00 00 41 0f    	cmp    $0xf410000,%rax
+  805904:	75 eb                	jne    8058f1 <serve_init+0x8f>
+}
+  805906:	c3                   	ret
+
+0000000000805907 <openfile_alloc>:
+openfile_alloc(struct OpenFile **o) {
+  805907:	55                   	push   %rbp
+  805908:	48 89 e5             	mov    %rsp,%rbp
+  80590b:	41 57                	push   %r15
+  80590d:	41 56                	push   %r14
+  80590f:	41 55                	push   %r13
+  805911:	41 54                	push   %r12
+  805913:	53                   	push   %rbx
+  805914:	48 83 ec 18          	sub    $0x18,%rsp
+  805918:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    if (openfile_freelist < 0) openfile_reclaim();
+  80591c:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  805923:	00 00 00 
+  805926:	8b 18                	mov    (%rax),%ebx
+  805928:	85 db                	test   %ebx,%ebx
+  80592a:	0f 88 8a 00 00 00    	js     8059ba <openfile_alloc+0xb3>
+    int res = sys_alloc_region(0, of->o_fd, PAGE_SIZE, PROT_RW);
+  805930:	48 63 c3             	movslq %ebx,%rax
+  805933:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  805937:	48 b8 80 00 81 00 00 	movabs $0x810080,%rax
+  80593e:	00 00 00 
+  805941:	48 8b 74 d0 18       	mov    0x18(%rax,%rdx,8),%rsi
+  805946:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80594b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805950:	bf 00 00 00 00       	mov    $0x0,%edi
+  805955:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  80595c:	00 00 00 
+  80595f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805961:	85 c0                	test   %eax,%eax
+  805963:	78 46                	js     8059ab <openfile_alloc+0xa4>
+    openfile_freelist = of->o_next;
+  805965:	48 be 80 00 81 00 00 	movabs $0x810080,%rsi
+  80596c:	00 00 00 
+  80596f:	48 63 d3             	movslq %ebx,%rdx
+  805972:	48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+  805979:	00 
+  80597a:	48 8d 04 11          	lea    (%rcx,%rdx,1),%rax
+  80597e:	8b 44 c6 20          	mov    0x20(%rsi,%rax,8),%eax
+  805982:	a3 60 00 81 00 00 00 	movabs %eax,0x810060
+  805989:	00 00 
+    of->o_fileid += MAXOPEN;
+  80598b:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  80598f:	8b 04 fe             	mov    (%rsi,%rdi,8),%eax
+  805992:	05 00 02 00 00       	add    $0x200,%eax
+  805997:	89 04 fe             	mov    %eax,(%rsi,%rdi,8)
+    struct OpenFile *of = &opentab[openfile_freelist];
+  80599a:	48 8d 04 fe          	lea    (%rsi,%rdi,8),%rax
+  80599e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8059a2:	48 89 07             	mov    %rax,(%rdi)
+    return of->o_fileid;
+  8059a5:	48 01 d1             	add    %rdx,%rcx
+  8059a8:	8b 04 ce             	mov    (%rsi,%rcx,8),%eax
+}
+  8059ab:	48 83 c4 18          	add    $0x18,%rsp
+  8059af:	5b                   	pop    %rbx
+  8059b0:	41 5c                	pop    %r12
+  8059b2:	41 5d                	pop    %r13
+  8059b4:	41 5e                	pop    %r14
+  8059b6:	41 5f                	pop    %r15
+  8059b8:	5d                   	pop    %rbp
+  8059b9:	c3                   	ret
+  8059ba:	48 bb 80 00 81 00 00 	movabs $0x810080,%rbx
+  8059c1:	00 00 00 
+  8059c4:	4c 8d ab 00 50 00 00 	lea    0x5000(%rbx),%r13
+        if (opentab[i].o_file && sys_region_refs(opentab[i].o_fd, PAGE_SIZE) <= 1)
+  8059cb:	49 be af a1 80 00 00 	movabs $0x80a1af,%r14
+  8059d2:	00 00 00 
+            openfile_free(&opentab[i]);
+  8059d5:	49 bf 84 55 80 00 00 	movabs $0x805584,%r15
+  8059dc:	00 00 00 
+  8059df:	eb 0f                	jmp    8059f0 <openfile_alloc+0xe9>
+  8059e1:	48 89 df             	mov    %rbx,%rdi
+  8059e4:	41 ff d7             	call   *%r15
+    for (size_t i = 0; i < MAXOPEN; i++)
+  8059e7:	48 83 c3 28          	add    $0x28,%rbx
+  8059eb:	4c 39 eb             	cmp    %r13,%rbx
+  8059ee:	74 1a                	je     805a0a <openfile_alloc+0x103>
+        if (opentab[i].o_file && sys_region_refs(opentab[i].o_fd, PAGE_SIZE) <= 1)
+  8059f0:	48 83 7b 08 00       	cmpq   $0x0,0x8(%rbx)
+  8059f5:	74 f0                	je     8059e7 <openfile_alloc+0xe0>
+  8059f7:	48 8b 7b 18          	mov    0x18(%rbx),%rdi
+  8059fb:	be 00 10 00 00       	mov    $0x1000,%esi
+  805a00:	41 ff d6             	call   *%r14
+  805a03:	83 f8 01             	cmp    $0x1,%eax
+  805a06:	7f df                	jg     8059e7 <openfile_alloc+0xe0>
+  805a08:	eb d7                	jmp    8059e1 <openfile_alloc+0xda>
+    if (openfile_freelist < 0) return -E_MAX_OPEN;
+  805a0a:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  805a11:	00 00 00 
+  805a14:	8b 18                	mov    (%rax),%ebx
+  805a16:	85 db                	test   %ebx,%ebx
+  805a18:	0f 89 12 ff ff ff    	jns    805930 <openfile_alloc+0x29>
+  805a1e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+  805a23:	eb 86                	jmp    8059ab <openfile_alloc+0xa4>
+
+0000000000805a25 <openfile_lookup>:
+    o = &opentab[fileid % MAXOPEN];
+  805a25:	89 f0                	mov    %esi,%eax
+  805a27:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805a2c:	89 c7                	mov    %eax,%edi
+  805a2e:	48 8d 0c bd 00 00 00 	lea    0x0(,%rdi,4),%rcx
+  805a35:	00 
+  805a36:	4c 8d 0c 39          	lea    (%rcx,%rdi,1),%r9
+  805a3a:	49 b8 80 00 81 00 00 	movabs $0x810080,%r8
+  805a41:	00 00 00 
+  805a44:	4f 8d 0c c8          	lea    (%r8,%r9,8),%r9
+    if (!o->o_file || o->o_fileid != fileid)
+  805a48:	48 01 f9             	add    %rdi,%rcx
+  805a4b:	49 83 7c c8 08 00    	cmpq   $0x0,0x8(%r8,%rcx,8)
+  805a51:	74 0f                	je     805a62 <openfile_lookup+0x3d>
+  805a53:	41 39 34 c8          	cmp    %esi,(%r8,%rcx,8)
+  805a57:	75 0f                	jne    805a68 <openfile_lookup+0x43>
+    *po = o;
+  805a59:	4c 89 0a             	mov    %r9,(%rdx)
+    return 0;
+  805a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a61:	c3                   	ret
+        return -E_INVAL;
+  805a62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805a67:	c3                   	ret
+  805a68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  805a6d:	c3                   	ret
+
+0000000000805a6e <serve_set_size>:
+serve_set_size(envid_t envid, union Fsipc *ipc) {
+  805a6e:	55                   	push   %rbp
+  805a6f:	48 89 e5             	mov    %rsp,%rbp
+  805a72:	53                   	push   %rbx
+  805a73:	48 83 ec 18          	sub    $0x18,%rsp
+  805a77:	48 89 f3             	mov    %rsi,%rbx
+    if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805a7a:	8b 36                	mov    (%rsi),%esi
+  805a7c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805a80:	48 b8 25 5a 80 00 00 	movabs $0x805a25,%rax
+  805a87:	00 00 00 
+  805a8a:	ff d0                	call   *%rax
+  805a8c:	85 c0                	test   %eax,%eax
+  805a8e:	78 17                	js     805aa7 <serve_set_size+0x39>
+    return file_set_size(o->o_file, req->req_size);
+  805a90:	8b 73 04             	mov    0x4(%rbx),%esi
+  805a93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a97:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  805a9b:	48 b8 7c 39 80 00 00 	movabs $0x80397c,%rax
+  805aa2:	00 00 00 
+  805aa5:	ff d0                	call   *%rax
+}
+  805aa7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805aab:	c9                   	leave
+  805aac:	c3                   	ret
+
+0000000000805aad <serve_read>:
+serve_read(envid_t envid, union Fsipc *ipc) {
+  805aad:	55                   	push   %rbp
+  805aae:	48 89 e5             	mov    %rsp,%rbp
+  805ab1:	53                   	push   %rbx
+  805ab2:	48 83 ec 18          	sub    $0x18,%rsp
+  805ab6:	48 89 f3             	mov    %rsi,%rbx
+    if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805ab9:	8b 36                	mov    (%rsi),%esi
+  805abb:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805abf:	48 b8 25 5a 80 00 00 	movabs $0x805a25,%rax
+  805ac6:	00 00 00 
+  805ac9:	ff d0                	call   *%rax
+  805acb:	85 c0                	test   %eax,%eax
+  805acd:	78 56                	js     805b25 <serve_read+0x78>
+    off_t offset = req->req_offset;
+  805acf:	44 8b 43 04          	mov    0x4(%rbx),%r8d
+    size_t n = req->req_n;
+  805ad3:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+    if (running->c_size <= PAGE_SIZE) return buf;
+  805ad7:	48 a1 40 57 8c 00 00 	movabs 0x8c5740,%rax
+  805ade:	00 00 00 
+  805ae1:	48 8b 48 08          	mov    0x8(%rax),%rcx
+    *size = running->c_size - PAGE_SIZE;
+  805ae5:	48 8d 81 00 f0 ff ff 	lea    -0x1000(%rcx),%rax
+    return (char *)ipc + PAGE_SIZE;
+  805aec:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    char *buf = request_data(ipc, ret->ret_buf, &size);
+  805af3:	48 81 f9 00 10 00 00 	cmp    $0x1000,%rcx
+  805afa:	48 0f 46 f3          	cmovbe %rbx,%rsi
+  805afe:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  805b03:	48 0f 46 c1          	cmovbe %rcx,%rax
+    return file_read(o->o_file, buf, MIN(n, size), offset);
+  805b07:	48 39 c2             	cmp    %rax,%rdx
+  805b0a:	48 0f 47 d0          	cmova  %rax,%rdx
+  805b0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b12:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  805b16:	44 89 c1             	mov    %r8d,%ecx
+  805b19:	48 b8 78 36 80 00 00 	movabs $0x803678,%rax
+  805b20:	00 00 00 
+  805b23:	ff d0                	call   *%rax
+}
+  805b25:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805b29:	c9                   	leave
+  805b2a:	c3                   	ret
+
+0000000000805b2b <serve_write>:
+serve_write(envid_t envid, union Fsipc *ipc) {
+  805b2b:	55                   	push   %rbp
+  805b2c:	48 89 e5             	mov    %rsp,%rbp
+  805b2f:	53                   	push   %rbx
+  805b30:	48 83 ec 18          	sub    $0x18,%rsp
+  805b34:	48 89 f3             	mov    %rsi,%rbx
+    if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805b37:	8b 36                	mov    (%rsi),%esi
+  805b39:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805b3d:	48 b8 25 5a 80 00 00 	movabs $0x805a25,%rax
+  805b44:	00 00 00 
+  805b47:	ff d0                	call   *%rax
+  805b49:	85 c0                	test   %eax,%eax
+  805b4b:	78 46                	js     805b93 <serve_write+0x68>
+    if (running->c_size <= PAGE_SIZE) return buf;
+  805b4d:	48 a1 40 57 8c 00 00 	movabs 0x8c5740,%rax
+  805b54:	00 00 00 
+  805b57:	48 8b 40 08          	mov    0x8(%rax),%rax
+    *size = running->c_size - PAGE_SIZE;
+  805b5b:	48 8d 90 00 f0 ff ff 	lea    -0x1000(%rax),%rdx
+    return (char *)ipc + PAGE_SIZE;
+  805b62:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+    if (running->c_size <= PAGE_SIZE) return buf;
+  805b69:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805b6f:	76 28                	jbe    805b99 <serve_write+0x6e>
+    return file_write(o->o_file, buf, MIN(req->req_n, size), req->req_offset);
+  805b71:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  805b74:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  805b78:	48 39 c2             	cmp    %rax,%rdx
+  805b7b:	48 0f 47 d0          	cmova  %rax,%rdx
+  805b7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b83:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  805b87:	48 b8 88 3c 80 00 00 	movabs $0x803c88,%rax
+  805b8e:	00 00 00 
+  805b91:	ff d0                	call   *%rax
+}
+  805b93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805b97:	c9                   	leave
+  805b98:	c3                   	ret
+    char *buf = request_data(ipc, req->req_buf, &size);
+  805b99:	48 8d 73 10          	lea    0x10(%rbx),%rsi
+    size_t size = sizeof(req->req_buf);
+  805b9d:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  805ba2:	eb cd                	jmp    805b71 <serve_write+0x46>
+
+0000000000805ba4 <serve_stat>:
+serve_stat(envid_t envid, union Fsipc *ipc) {
+  805ba4:	55                   	push   %rbp
+  805ba5:	48 89 e5             	mov    %rsp,%rbp
+  805ba8:	41 54                	push   %r12
+  805baa:	53                   	push   %rbx
+  805bab:	48 83 ec 10          	sub    $0x10,%rsp
+  805baf:	48 89 f3             	mov    %rsi,%rbx
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  805bb2:	8b 36                	mov    (%rsi),%esi
+  805bb4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805bb8:	48 b8 25 5a 80 00 00 	movabs $0x805a25,%rax
+  805bbf:	00 00 00 
+  805bc2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805bc4:	85 c0                	test   %eax,%eax
+  805bc6:	78 46                	js     805c0e <serve_stat+0x6a>
+    strcpy(ret->ret_name, o->o_file->f_name);
+  805bc8:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  805bcc:	49 8b 74 24 08       	mov    0x8(%r12),%rsi
+  805bd1:	48 89 df             	mov    %rbx,%rdi
+  805bd4:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  805bdb:	00 00 00 
+  805bde:	ff d0                	call   *%rax
+    ret->ret_size = o->o_file->f_size;
+  805be0:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  805be5:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  805beb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  805bf1:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  805bf6:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%rax)
+  805bfd:	0f 94 c0             	sete   %al
+  805c00:	0f b6 c0             	movzbl %al,%eax
+  805c03:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  805c09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c0e:	48 83 c4 10          	add    $0x10,%rsp
+  805c12:	5b                   	pop    %rbx
+  805c13:	41 5c                	pop    %r12
+  805c15:	5d                   	pop    %rbp
+  805c16:	c3                   	ret
+
+0000000000805c17 <serve_flush>:
+serve_flush(envid_t envid, union Fsipc *ipc) {
+  805c17:	55                   	push   %rbp
+  805c18:	48 89 e5             	mov    %rsp,%rbp
+  805c1b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  805c1f:	8b 36                	mov    (%rsi),%esi
+  805c21:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  805c25:	48 b8 25 5a 80 00 00 	movabs $0x805a25,%rax
+  805c2c:	00 00 00 
+  805c2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805c31:	85 c0                	test   %eax,%eax
+  805c33:	78 2b                	js     805c60 <serve_flush+0x49>
+    file_flush(o->o_file);
+  805c35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805c39:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  805c3d:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  805c44:	00 00 00 
+  805c47:	ff d0                	call   *%rax
+    if (journal_active()) fs_sync();
+  805c49:	48 b8 b3 4b 80 00 00 	movabs $0x804bb3,%rax
+  805c50:	00 00 00 
+  805c53:	ff d0                	call   *%rax
+  805c55:	89 c2                	mov    %eax,%edx
+    return 0;
+  805c57:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (journal_active()) fs_sync();
+  805c5c:	84 d2                	test   %dl,%dl
+  805c5e:	75 02                	jne    805c62 <serve_flush+0x4b>
+}
+  805c60:	c9                   	leave
+  805c61:	c3                   	ret
+    if (journal_active()) fs_sync();
+  805c62:	48 b8 c3 4a 80 00 00 	movabs $0x804ac3,%rax
+  805c69:	00 00 00 
+  805c6c:	ff d0                	call   *%rax
+    return 0;
+  805c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c73:	eb eb                	jmp    805c60 <serve_flush+0x49>
+
+0000000000805c75 <serve_close>:
+serve_close(envid_t envid, union Fsipc *ipc) {
+  805c75:	55                   	push   %rbp
+  805c76:	48 89 e5             	mov    %rsp,%rbp
+  805c79:	53                   	push   %rbx
+  805c7a:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  805c7e:	8b 36                	mov    (%rsi),%esi
+  805c80:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805c84:	48 b8 25 5a 80 00 00 	movabs $0x805a25,%rax
+  805c8b:	00 00 00 
+  805c8e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805c90:	85 c0                	test   %eax,%eax
+  805c92:	78 35                	js     805cc9 <serve_close+0x54>
+    file_flush(o->o_file);
+  805c94:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+  805c98:	48 8b 7b 08          	mov    0x8(%rbx),%rdi
+  805c9c:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  805ca3:	00 00 00 
+  805ca6:	ff d0                	call   *%rax
+    if (sys_region_refs(o->o_fd, PAGE_SIZE) <= 2)
+  805ca8:	48 8b 7b 18          	mov    0x18(%rbx),%rdi
+  805cac:	be 00 10 00 00       	mov    $0x1000,%esi
+  805cb1:	48 b8 af a1 80 00 00 	movabs $0x80a1af,%rax
+  805cb8:	00 00 00 
+  805cbb:	ff d0                	call   *%rax
+  805cbd:	89 c2                	mov    %eax,%edx
+    return 0;
+  805cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (sys_region_refs(o->o_fd, PAGE_SIZE) <= 2)
+  805cc4:	83 fa 02             	cmp    $0x2,%edx
+  805cc7:	7e 06                	jle    805ccf <serve_close+0x5a>
+}
+  805cc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805ccd:	c9                   	leave
+  805cce:	c3                   	ret
+        openfile_free(o);
+  805ccf:	48 89 df             	mov    %rbx,%rdi
+  805cd2:	48 b8 84 55 80 00 00 	movabs $0x805584,%rax
+  805cd9:	00 00 00 
+  805cdc:	ff d0                	call   *%rax
+    return 0;
+  805cde:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ce3:	eb e4                	jmp    805cc9 <serve_close+0x54>
+
+0000000000805ce5 <serve_open>:
+           void **pg_store, int *perm_store) {
+  805ce5:	55                   	push   %rbp
+  805ce6:	48 89 e5             	mov    %rsp,%rbp
+  805ce9:	41 55                	push   %r13
+  805ceb:	41 54                	push   %r12
+  805ced:	53                   	push   %rbx
+  805cee:	48 81 ec 18 04 00 00 	sub    $0x418,%rsp
+  805cf5:	48 89 f3             	mov    %rsi,%rbx
+  805cf8:	49 89 d5             	mov    %rdx,%r13
+  805cfb:	49 89 cc             	mov    %rcx,%r12
+    memmove(path, req->req_path, MAXPATHLEN);
+  805cfe:	ba 00 04 00 00       	mov    $0x400,%edx
+  805d03:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  805d0a:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  805d11:	00 00 00 
+  805d14:	ff d0                	call   *%rax
+    path[MAXPATHLEN - 1] = 0;
+  805d16:	c6 45 df 00          	movb   $0x0,-0x21(%rbp)
+    if (req->req_omode & O_CREAT) {
+  805d1a:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%rbx)
+  805d21:	74 34                	je     805d57 <serve_open+0x72>
+        if ((res = file_create(path, &f)) < 0) {
+  805d23:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  805d2a:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  805d31:	48 b8 7a 46 80 00 00 	movabs $0x80467a,%rax
+  805d38:	00 00 00 
+  805d3b:	ff d0                	call   *%rax
+  805d3d:	85 c0                	test   %eax,%eax
+  805d3f:	79 38                	jns    805d79 <serve_open+0x94>
+            if (!(req->req_omode & O_EXCL) && res == -E_FILE_EXISTS)
+  805d41:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%rbx)
+  805d48:	0f 85 e1 00 00 00    	jne    805e2f <serve_open+0x14a>
+  805d4e:	83 f8 ef             	cmp    $0xffffffef,%eax
+  805d51:	0f 85 d8 00 00 00    	jne    805e2f <serve_open+0x14a>
+        if ((res = file_open(path, &f)) < 0) {
+  805d57:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  805d5e:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  805d65:	48 b8 5b 46 80 00 00 	movabs $0x80465b,%rax
+  805d6c:	00 00 00 
+  805d6f:	ff d0                	call   *%rax
+  805d71:	85 c0                	test   %eax,%eax
+  805d73:	0f 88 b6 00 00 00    	js     805e2f <serve_open+0x14a>
+    if (req->req_omode & O_TRUNC) {
+  805d79:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%rbx)
+  805d80:	74 20                	je     805da2 <serve_open+0xbd>
+        if ((res = file_set_size(f, 0)) < 0) {
+  805d82:	be 00 00 00 00       	mov    $0x0,%esi
+  805d87:	48 8b bd d8 fb ff ff 	mov    -0x428(%rbp),%rdi
+  805d8e:	48 b8 7c 39 80 00 00 	movabs $0x80397c,%rax
+  805d95:	00 00 00 
+  805d98:	ff d0                	call   *%rax
+  805d9a:	85 c0                	test   %eax,%eax
+  805d9c:	0f 88 8d 00 00 00    	js     805e2f <serve_open+0x14a>
+    if ((res = file_open(path, &f)) < 0) {
+  805da2:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  805da9:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  805db0:	48 b8 5b 46 80 00 00 	movabs $0x80465b,%rax
+  805db7:	00 00 00 
+  805dba:	ff d0                	call   *%rax
+  805dbc:	85 c0                	test   %eax,%eax
+  805dbe:	78 6f                	js     805e2f <serve_open+0x14a>
+    if ((res = openfile_alloc(&o)) < 0) {
+  805dc0:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  805dc7:	48 b8 07 59 80 00 00 	movabs $0x805907,%rax
+  805dce:	00 00 00 
+  805dd1:	ff d0                	call   *%rax
+  805dd3:	85 c0                	test   %eax,%eax
+  805dd5:	78 58                	js     805e2f <serve_open+0x14a>
+    o->o_file = f;
+  805dd7:	48 8b 95 d0 fb ff ff 	mov    -0x430(%rbp),%rdx
+  805dde:	48 8b 85 d8 fb ff ff 	mov    -0x428(%rbp),%rax
+  805de5:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    o->o_fd->fd_file.id = o->o_fileid;
+  805de9:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  805ded:	8b 0a                	mov    (%rdx),%ecx
+  805def:	89 48 0c             	mov    %ecx,0xc(%rax)
+    o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  805df2:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  805df6:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  805dfc:	83 e0 03             	and    $0x3,%eax
+  805dff:	89 41 08             	mov    %eax,0x8(%rcx)
+    o->o_fd->fd_dev_id = devfile.dev_id;
+  805e02:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  805e06:	a1 a0 50 81 00 00 00 	movabs 0x8150a0,%eax
+  805e0d:	00 00 
+  805e0f:	89 01                	mov    %eax,(%rcx)
+    o->o_mode = req->req_omode;
+  805e11:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  805e17:	89 42 10             	mov    %eax,0x10(%rdx)
+    *pg_store = o->o_fd;
+  805e1a:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  805e1e:	49 89 45 00          	mov    %rax,0x0(%r13)
+    *perm_store = PROT_RW | PROT_SHARE;
+  805e22:	41 c7 04 24 46 00 00 	movl   $0x46,(%r12)
+  805e29:	00 
+    return 0;
+  805e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e2f:	48 81 c4 18 04 00 00 	add    $0x418,%rsp
+  805e36:	5b                   	pop    %rbx
+  805e37:	41 5c                	pop    %r12
+  805e39:	41 5d                	pop    %r13
+  805e3b:	5d                   	pop    %rbp
+  805e3c:	c3                   	ret
+
+0000000000805e3d <serve_map>:
+          void **pg_store, size_t *size_store, int *perm_store) {
+  805e3d:	55                   	push   %rbp
+  805e3e:	48 89 e5             	mov    %rsp,%rbp
+  805e41:	41 57                	push   %r15
+  805e43:	41 56                	push   %r14
+  805e45:	41 55                	push   %r13
+  805e47:	41 54                	push   %r12
+  805e49:	53                   	push   %rbx
+  805e4a:	48 83 ec 28          	sub    $0x28,%rsp
+  805e4e:	48 89 f3             	mov    %rsi,%rbx
+  805e51:	49 89 d6             	mov    %rdx,%r14
+  805e54:	49 89 cd             	mov    %rcx,%r13
+  805e57:	4d 89 c4             	mov    %r8,%r12
+    if ((res = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805e5a:	8b 36                	mov    (%rsi),%esi
+  805e5c:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  805e60:	48 b8 25 5a 80 00 00 	movabs $0x805a25,%rax
+  805e67:	00 00 00 
+  805e6a:	ff d0                	call   *%rax
+  805e6c:	85 c0                	test   %eax,%eax
+  805e6e:	78 30                	js     805ea0 <serve_map+0x63>
+    if (req->req_offset < 0 || req->req_offset % BLKSIZE)
+  805e70:	8b 53 04             	mov    0x4(%rbx),%edx
+  805e73:	85 d2                	test   %edx,%edx
+  805e75:	0f 88 e6 00 00 00    	js     805f61 <serve_map+0x124>
+  805e7b:	89 d0                	mov    %edx,%eax
+  805e7d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  805e82:	0f 85 e3 00 00 00    	jne    805f6b <serve_map+0x12e>
+    struct File *f = o->o_file;
+  805e88:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  805e8c:	4c 8b 79 08          	mov    0x8(%rcx),%r15
+    if (req->req_offset >= f->f_size || !req->req_n)
+  805e90:	41 3b 97 80 00 00 00 	cmp    0x80(%r15),%edx
+  805e97:	7d 07                	jge    805ea0 <serve_map+0x63>
+  805e99:	48 83 7b 08 00       	cmpq   $0x0,0x8(%rbx)
+  805e9e:	75 0f                	jne    805eaf <serve_map+0x72>
+}
+  805ea0:	48 83 c4 28          	add    $0x28,%rsp
+  805ea4:	5b                   	pop    %rbx
+  805ea5:	41 5c                	pop    %r12
+  805ea7:	41 5d                	pop    %r13
+  805ea9:	41 5e                	pop    %r14
+  805eab:	41 5f                	pop    %r15
+  805ead:	5d                   	pop    %rbp
+  805eae:	c3                   	ret
+    if (file_inline(f)) return -E_NOT_SUPP;
+  805eaf:	4c 89 ff             	mov    %r15,%rdi
+  805eb2:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  805eb9:	00 00 00 
+  805ebc:	ff d0                	call   *%rax
+  805ebe:	84 c0                	test   %al,%al
+  805ec0:	0f 85 af 00 00 00    	jne    805f75 <serve_map+0x138>
+    size_t n = MIN(req->req_n, f->f_size - req->req_offset);
+  805ec6:	8b 53 04             	mov    0x4(%rbx),%edx
+  805ec9:	41 8b 87 80 00 00 00 	mov    0x80(%r15),%eax
+  805ed0:	29 d0                	sub    %edx,%eax
+  805ed2:	48 98                	cltq
+  805ed4:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  805ed8:	48 39 c8             	cmp    %rcx,%rax
+  805edb:	48 89 cb             	mov    %rcx,%rbx
+  805ede:	48 0f 46 d8          	cmovbe %rax,%rbx
+    blockno_t count = CEILDIV(n, BLKSIZE);
+  805ee2:	48 8d 83 ff 0f 00 00 	lea    0xfff(%rbx),%rax
+  805ee9:	48 c1 e8 0c          	shr    $0xc,%rax
+  805eed:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    if ((res = file_get_blocks(f, req->req_offset / BLKSIZE, &count, &blk)) < 0)
+  805ef0:	8d b2 ff 0f 00 00    	lea    0xfff(%rdx),%esi
+  805ef6:	85 d2                	test   %edx,%edx
+  805ef8:	0f 49 f2             	cmovns %edx,%esi
+  805efb:	c1 fe 0c             	sar    $0xc,%esi
+  805efe:	48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+  805f02:	48 8d 55 bc          	lea    -0x44(%rbp),%rdx
+  805f06:	4c 89 ff             	mov    %r15,%rdi
+  805f09:	48 b8 fa 33 80 00 00 	movabs $0x8033fa,%rax
+  805f10:	00 00 00 
+  805f13:	ff d0                	call   *%rax
+  805f15:	85 c0                	test   %eax,%eax
+  805f17:	78 87                	js     805ea0 <serve_map+0x63>
+    for (blockno_t i = 0; i < count; i++)
+  805f19:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805f1c:	85 c0                	test   %eax,%eax
+  805f1e:	74 1c                	je     805f3c <serve_map+0xff>
+  805f20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805f24:	89 c1                	mov    %eax,%ecx
+  805f26:	48 c1 e1 0c          	shl    $0xc,%rcx
+  805f2a:	48 01 d1             	add    %rdx,%rcx
+        (void)*(volatile char *)(blk + i * BLKSIZE);
+  805f2d:	0f b6 32             	movzbl (%rdx),%esi
+    for (blockno_t i = 0; i < count; i++)
+  805f30:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  805f37:	48 39 ca             	cmp    %rcx,%rdx
+  805f3a:	75 f1                	jne    805f2d <serve_map+0xf0>
+    *pg_store = blk;
+  805f3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805f40:	49 89 16             	mov    %rdx,(%r14)
+    *size_store = count * BLKSIZE;
+  805f43:	89 c0                	mov    %eax,%eax
+  805f45:	48 c1 e0 0c          	shl    $0xc,%rax
+  805f49:	49 89 45 00          	mov    %rax,0x0(%r13)
+    *perm_store = PROT_R;
+  805f4d:	41 c7 04 24 04 00 00 	movl   $0x4,(%r12)
+  805f54:	00 
+    return MIN(n, count * BLKSIZE);
+  805f55:	48 39 d8             	cmp    %rbx,%rax
+  805f58:	48 0f 47 c3          	cmova  %rbx,%rax
+  805f5c:	e9 3f ff ff ff       	jmp    805ea0 <serve_map+0x63>
+        return -E_INVAL;
+  805f61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805f66:	e9 35 ff ff ff       	jmp    805ea0 <serve_map+0x63>
+  805f6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805f70:	e9 2b ff ff ff       	jmp    805ea0 <serve_map+0x63>
+    if (file_inline(f)) return -E_NOT_SUPP;
+  805f75:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805f7a:	e9 21 ff ff ff       	jmp    805ea0 <serve_map+0x63>
+
+0000000000805f7f <serve_request>:
+    st->hist[b]++;
+}
+
+/* Run request to completion and reply, or until it is suspended */
+static void
+serve_request(struct Context *c) {
+  805f7f:	55                   	push   %rbp
+  805f80:	48 89 e5             	mov    %rsp,%rbp
+  805f83:	53                   	push   %rbx
+  805f84:	48 83 ec 38          	sub    $0x38,%rsp
+  805f88:	48 89 f8             	mov    %rdi,%rax
+    void *pg = NULL;
+  805f8b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805f92:	00 
+    size_t size = PAGE_SIZE;
+  805f93:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  805f9a:	00 
+    int perm = 0, res;
+  805f9b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+
+    running = c;
+  805fa2:	48 a3 40 57 8c 00 00 	movabs %rax,0x8c5740
+  805fa9:	00 00 00 
+    c->c_slot = -1;
+  805fac:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805fb0:	c7 47 18 ff ff ff ff 	movl   $0xffffffff,0x18(%rdi)
+    if (setjmp(suspend_point)) return;
+  805fb7:	48 bf 00 57 8c 00 00 	movabs $0x8c5700,%rdi
+  805fbe:	00 00 00 
+  805fc1:	48 b8 f0 ae 80 00 00 	movabs $0x80aef0,%rax
+  805fc8:	00 00 00 
+  805fcb:	ff d0                	call   *%rax
+  805fcd:	85 c0                	test   %eax,%eax
+  805fcf:	0f 85 39 02 00 00    	jne    80620e <serve_request+0x28f>
+  805fd5:	89 c3                	mov    %eax,%ebx
+    return c->c_req == FSREQ_READ || c->c_req == FSREQ_STAT || c->c_req == FSREQ_MAP ||
+  805fd7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805fdb:	8b 40 14             	mov    0x14(%rax),%eax
+  805fde:	8d 50 fd             	lea    -0x3(%rax),%edx
+  805fe1:	f7 c2 fd ff ff ff    	test   $0xfffffffd,%edx
+  805fe7:	74 05                	je     805fee <serve_request+0x6f>
+  805fe9:	83 f8 09             	cmp    $0x9,%eax
+  805fec:	75 68                	jne    806056 <serve_request+0xd7>
+
+    if (restartable(c)) {
+        if (c->c_req != FSREQ_OPEN)
+  805fee:	83 f8 01             	cmp    $0x1,%eax
+  805ff1:	0f 85 a3 00 00 00    	jne    80609a <serve_request+0x11b>
+            memcpy(c->c_ipc, &c->c_args, sizeof(c->c_args));
+        bc_suspend = suspend_request;
+  805ff7:	48 b8 17 58 80 00 00 	movabs $0x805817,%rax
+  805ffe:	00 00 00 
+  806001:	48 a3 00 60 81 00 00 	movabs %rax,0x816000
+  806008:	00 00 00 
+    }
+
+    if (c->c_req == FSREQ_OPEN) {
+  80600b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80600f:	8b 70 14             	mov    0x14(%rax),%esi
+  806012:	83 fe 01             	cmp    $0x1,%esi
+  806015:	74 60                	je     806077 <serve_request+0xf8>
+        res = serve_open(c->c_whom, &c->c_ipc->open, &pg, &perm);
+    } else if (c->c_req == FSREQ_MAP) {
+  806017:	83 fe 09             	cmp    $0x9,%esi
+  80601a:	0f 84 9b 00 00 00    	je     8060bb <serve_request+0x13c>
+        res = serve_map(c->c_whom, &c->c_ipc->map, &pg, &size, &perm);
+    } else if (c->c_req < NHANDLERS && handlers[c->c_req]) {
+  806020:	83 fe 0b             	cmp    $0xb,%esi
+  806023:	0f 87 b9 00 00 00    	ja     8060e2 <serve_request+0x163>
+  806029:	89 f0                	mov    %esi,%eax
+  80602b:	48 ba 00 00 81 00 00 	movabs $0x810000,%rdx
+  806032:	00 00 00 
+  806035:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  806039:	48 85 c0             	test   %rax,%rax
+  80603c:	0f 84 a0 00 00 00    	je     8060e2 <serve_request+0x163>
+        res = handlers[c->c_req](c->c_whom, c->c_ipc);
+  806042:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  806046:	48 8b 37             	mov    (%rdi),%rsi
+  806049:	8b 7f 10             	mov    0x10(%rdi),%edi
+  80604c:	ff d0                	call   *%rax
+  80604e:	41 89 c1             	mov    %eax,%r9d
+  806051:	e9 b4 00 00 00       	jmp    80610a <serve_request+0x18b>
+    return c->c_req == FSREQ_READ || c->c_req == FSREQ_STAT || c->c_req == FSREQ_MAP ||
+  806056:	83 f8 01             	cmp    $0x1,%eax
+  806059:	74 09                	je     806064 <serve_request+0xe5>
+    if (c->c_req == FSREQ_OPEN) {
+  80605b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80605f:	8b 70 14             	mov    0x14(%rax),%esi
+  806062:	eb bc                	jmp    806020 <serve_request+0xa1>
+           (c->c_req == FSREQ_OPEN && !(c->c_ipc->open.req_omode & (O_CREAT | O_TRUNC | O_MKDIR)));
+  806064:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806068:	48 8b 00             	mov    (%rax),%rax
+    if (restartable(c)) {
+  80606b:	f7 80 00 04 00 00 00 	testl  $0xb00,0x400(%rax)
+  806072:	0b 00 00 
+  806075:	74 80                	je     805ff7 <serve_request+0x78>
+        res = serve_open(c->c_whom, &c->c_ipc->open, &pg, &perm);
+  806077:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80607b:	48 8b 30             	mov    (%rax),%rsi
+  80607e:	8b 78 10             	mov    0x10(%rax),%edi
+  806081:	48 8d 4d dc          	lea    -0x24(%rbp),%rcx
+  806085:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  806089:	48 b8 e5 5c 80 00 00 	movabs $0x805ce5,%rax
+  806090:	00 00 00 
+  806093:	ff d0                	call   *%rax
+  806095:	41 89 c1             	mov    %eax,%r9d
+  806098:	eb 70                	jmp    80610a <serve_request+0x18b>
+            memcpy(c->c_ipc, &c->c_args, sizeof(c->c_args));
+  80609a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80609e:	48 8d 70 28          	lea    0x28(%rax),%rsi
+  8060a2:	48 8b 38             	mov    (%rax),%rdi
+  8060a5:	ba 10 00 00 00       	mov    $0x10,%edx
+  8060aa:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  8060b1:	00 00 00 
+  8060b4:	ff d0                	call   *%rax
+  8060b6:	e9 3c ff ff ff       	jmp    805ff7 <serve_request+0x78>
+        res = serve_map(c->c_whom, &c->c_ipc->map, &pg, &size, &perm);
+  8060bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8060bf:	48 8b 30             	mov    (%rax),%rsi
+  8060c2:	8b 78 10             	mov    0x10(%rax),%edi
+  8060c5:	4c 8d 45 dc          	lea    -0x24(%rbp),%r8
+  8060c9:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+  8060cd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8060d1:	48 b8 3d 5e 80 00 00 	movabs $0x805e3d,%rax
+  8060d8:	00 00 00 
+  8060db:	ff d0                	call   *%rax
+  8060dd:	41 89 c1             	mov    %eax,%r9d
+  8060e0:	eb 28                	jmp    80610a <serve_request+0x18b>
+    } else {
+        cprintf("Invalid request code %d from %08x\n", c->c_req, c->c_whom);
+  8060e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8060e6:	8b 50 10             	mov    0x10(%rax),%edx
+  8060e9:	48 bf a0 e5 80 00 00 	movabs $0x80e5a0,%rdi
+  8060f0:	00 00 00 
+  8060f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060f8:	48 b9 35 91 80 00 00 	movabs $0x809135,%rcx
+  8060ff:	00 00 00 
+  806102:	ff d1                	call   *%rcx
+        res = -E_INVAL;
+  806104:	41 b9 fd ff ff ff    	mov    $0xfffffffd,%r9d
+    }
+    bc_suspend = NULL;
+  80610a:	48 b8 00 60 81 00 00 	movabs $0x816000,%rax
+  806111:	00 00 00 
+  806114:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    if (c->c_req >= NFSREQ) return;
+  80611b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80611f:	8b 7e 14             	mov    0x14(%rsi),%edi
+  806122:	83 ff 0b             	cmp    $0xb,%edi
+  806125:	0f 87 a5 00 00 00    	ja     8061d0 <serve_request+0x251>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80612b:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80612d:	48 c1 e2 20          	shl    $0x20,%rdx
+  806131:	89 c0                	mov    %eax,%eax
+  806133:	48 09 c2             	or     %rax,%rdx
+    uint64_t cycles = read_tsc() - c->c_start;
+  806136:	48 2b 56 20          	sub    0x20(%rsi),%rdx
+    st->count++;
+  80613a:	89 f9                	mov    %edi,%ecx
+  80613c:	48 c1 e1 07          	shl    $0x7,%rcx
+  806140:	48 b8 e0 50 8c 00 00 	movabs $0x8c50e0,%rax
+  806147:	00 00 00 
+  80614a:	48 01 c8             	add    %rcx,%rax
+  80614d:	48 83 00 01          	addq   $0x1,(%rax)
+    st->cycles += cycles;
+  806151:	48 01 50 10          	add    %rdx,0x10(%rax)
+    if (cycles > st->max_cycles) st->max_cycles = cycles;
+  806155:	48 39 50 18          	cmp    %rdx,0x18(%rax)
+  806159:	73 12                	jae    80616d <serve_request+0x1ee>
+  80615b:	48 89 c8             	mov    %rcx,%rax
+  80615e:	48 b9 e0 50 8c 00 00 	movabs $0x8c50e0,%rcx
+  806165:	00 00 00 
+  806168:	48 89 54 01 18       	mov    %rdx,0x18(%rcx,%rax,1)
+    if (res > 0 && (c->c_req == FSREQ_READ || c->c_req == FSREQ_WRITE || c->c_req == FSREQ_MAP))
+  80616d:	45 85 c9             	test   %r9d,%r9d
+  806170:	7e 1c                	jle    80618e <serve_request+0x20f>
+  806172:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806176:	8b 40 14             	mov    0x14(%rax),%eax
+  806179:	8d 48 fd             	lea    -0x3(%rax),%ecx
+  80617c:	83 f9 01             	cmp    $0x1,%ecx
+  80617f:	0f 86 8f 00 00 00    	jbe    806214 <serve_request+0x295>
+  806185:	83 f8 09             	cmp    $0x9,%eax
+  806188:	0f 84 86 00 00 00    	je     806214 <serve_request+0x295>
+    while (b < FSSTAT_BUCKETS - 1 && cycles >= 1ULL << (FSSTAT_SHIFT + b)) b++;
+  80618e:	48 81 fa ff 03 00 00 	cmp    $0x3ff,%rdx
+  806195:	76 1d                	jbe    8061b4 <serve_request+0x235>
+  806197:	be 01 00 00 00       	mov    $0x1,%esi
+  80619c:	89 d9                	mov    %ebx,%ecx
+  80619e:	83 c3 01             	add    $0x1,%ebx
+  8061a1:	83 fb 17             	cmp    $0x17,%ebx
+  8061a4:	74 0e                	je     8061b4 <serve_request+0x235>
+  8061a6:	83 c1 0b             	add    $0xb,%ecx
+  8061a9:	48 89 f0             	mov    %rsi,%rax
+  8061ac:	48 d3 e0             	shl    %cl,%rax
+  8061af:	48 39 c2             	cmp    %rax,%rdx
+  8061b2:	73 e8                	jae    80619c <serve_request+0x21d>
+    st->hist[b]++;
+  8061b4:	48 ba e0 50 8c 00 00 	movabs $0x8c50e0,%rdx
+  8061bb:	00 00 00 
+  8061be:	48 63 db             	movslq %ebx,%rbx
+  8061c1:	89 f8                	mov    %edi,%eax
+  8061c3:	48 c1 e0 05          	shl    $0x5,%rax
+  8061c7:	48 8d 44 03 08       	lea    0x8(%rbx,%rax,1),%rax
+  8061cc:	83 04 82 01          	addl   $0x1,(%rdx,%rax,4)
+
+    account_request(c, res);
+    ipc_send(c->c_whom, res, pg, size, perm);
+  8061d0:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8061d4:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8061d7:	44 8b 45 dc          	mov    -0x24(%rbp),%r8d
+  8061db:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8061df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8061e3:	44 89 ce             	mov    %r9d,%esi
+  8061e6:	48 b8 f1 b0 80 00 00 	movabs $0x80b0f1,%rax
+  8061ed:	00 00 00 
+  8061f0:	ff d0                	call   *%rax
+    sys_unmap_region(0, c->c_ipc, c->c_size);
+  8061f2:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8061f6:	48 8b 33             	mov    (%rbx),%rsi
+  8061f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061fe:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  806205:	00 00 00 
+  806208:	ff d0                	call   *%rax
+    c->c_busy = 0;
+  80620a:	c6 43 1c 00          	movb   $0x0,0x1c(%rbx)
+}
+  80620e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806212:	c9                   	leave
+  806213:	c3                   	ret
+        st->bytes += res;
+  806214:	48 b9 e0 50 8c 00 00 	movabs $0x8c50e0,%rcx
+  80621b:	00 00 00 
+  80621e:	89 f8                	mov    %edi,%eax
+  806220:	48 c1 e0 07          	shl    $0x7,%rax
+  806224:	49 63 f1             	movslq %r9d,%rsi
+  806227:	48 01 74 01 08       	add    %rsi,0x8(%rcx,%rax,1)
+  80622c:	e9 5d ff ff ff       	jmp    80618e <serve_request+0x20f>
+
+0000000000806231 <serve>:
+
+void
+serve(void) {
+  806231:	55                   	push   %rbp
+  806232:	48 89 e5             	mov    %rsp,%rbp
+  806235:	41 57                	push   %r15
+  806237:	41 56                	push   %r14
+  806239:	41 55                	push   %r13
+  80623b:	41 54                	push   %r12
+  80623d:	53                   	push   %rbx
+  80623e:	48 83 ec 18          	sub    $0x18,%rsp
+    while (1) {
+        /* Restart requests whose blocks arrived */
+        for (int slot; (slot = bc_poll()) >= 0;)
+            for (struct Context *c = contexts; c < contexts + NCONTEXTS; c++)
+                if (c->c_busy && c->c_slot == slot) serve_request(c);
+  806242:	49 be 7f 5f 80 00 00 	movabs $0x805f7f,%r14
+  806249:	00 00 00 
+            for (struct Context *c = contexts; c < contexts + NCONTEXTS; c++)
+  80624c:	49 bc e0 5a 8c 00 00 	movabs $0x8c5ae0,%r12
+  806253:	00 00 00 
+  806256:	eb 42                	jmp    80629a <serve+0x69>
+  806258:	48 83 c3 38          	add    $0x38,%rbx
+  80625c:	4c 39 e3             	cmp    %r12,%rbx
+  80625f:	74 43                	je     8062a4 <serve+0x73>
+                if (c->c_busy && c->c_slot == slot) serve_request(c);
+  806261:	80 7b 1c 00          	cmpb   $0x0,0x1c(%rbx)
+  806265:	74 f1                	je     806258 <serve+0x27>
+  806267:	44 39 6b 18          	cmp    %r13d,0x18(%rbx)
+  80626b:	75 eb                	jne    806258 <serve+0x27>
+  80626d:	48 89 df             	mov    %rbx,%rdi
+  806270:	41 ff d6             	call   *%r14
+  806273:	eb e3                	jmp    806258 <serve+0x27>
+
+        struct Context *c = contexts;
+  806275:	48 bb 60 57 8c 00 00 	movabs $0x8c5760,%rbx
+  80627c:	00 00 00 
+        while (c < contexts + NCONTEXTS && c->c_busy) c++;
+  80627f:	80 7b 1c 00          	cmpb   $0x0,0x1c(%rbx)
+  806283:	74 35                	je     8062ba <serve+0x89>
+  806285:	48 83 c3 38          	add    $0x38,%rbx
+  806289:	4c 39 e3             	cmp    %r12,%rbx
+  80628c:	75 f1                	jne    80627f <serve+0x4e>
+        if (c == contexts + NCONTEXTS) {
+            /* Every context waits for a read */
+            sys_yield();
+  80628e:	48 b8 7e a1 80 00 00 	movabs $0x80a17e,%rax
+  806295:	00 00 00 
+  806298:	ff d0                	call   *%rax
+        for (int slot; (slot = bc_poll()) >= 0;)
+  80629a:	49 bf 49 09 80 00 00 	movabs $0x800949,%r15
+  8062a1:	00 00 00 
+  8062a4:	41 ff d7             	call   *%r15
+  8062a7:	41 89 c5             	mov    %eax,%r13d
+  8062aa:	85 c0                	test   %eax,%eax
+  8062ac:	78 c7                	js     806275 <serve+0x44>
+            for (struct Context *c = contexts; c < contexts + NCONTEXTS; c++)
+  8062ae:	48 bb 60 57 8c 00 00 	movabs $0x8c5760,%rbx
+  8062b5:	00 00 00 
+  8062b8:	eb a7                	jmp    806261 <serve+0x30>
+        if (c == contexts + NCONTEXTS) {
+  8062ba:	4c 39 e3             	cmp    %r12,%rbx
+  8062bd:	74 cf                	je     80628e <serve+0x5d>
+        }
+
+        /* Don't block while reads are in flight, their
+         * completion is only noticed by polling */
+        envid_t whom;
+        int perm = 0;
+  8062bf:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+        size_t sz = FSREQ_SIZE;
+  8062c6:	48 c7 45 c8 00 10 04 	movq   $0x41000,-0x38(%rbp)
+  8062cd:	00 
+        int32_t req = bc_pending() ? ipc_try_recv(&whom, c->c_ipc, &sz, &perm) :
+  8062ce:	48 b8 cb 09 80 00 00 	movabs $0x8009cb,%rax
+  8062d5:	00 00 00 
+  8062d8:	ff d0                	call   *%rax
+  8062da:	84 c0                	test   %al,%al
+  8062dc:	74 7a                	je     806358 <serve+0x127>
+  8062de:	48 8b 33             	mov    (%rbx),%rsi
+  8062e1:	48 8d 4d c4          	lea    -0x3c(%rbp),%rcx
+  8062e5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8062e9:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8062ed:	48 b8 19 b0 80 00 00 	movabs $0x80b019,%rax
+  8062f4:	00 00 00 
+  8062f7:	ff d0                	call   *%rax
+  8062f9:	89 c1                	mov    %eax,%ecx
+                                     ipc_recv(&whom, c->c_ipc, &sz, &perm);
+        if (req < 0) continue;
+  8062fb:	85 c9                	test   %ecx,%ecx
+  8062fd:	78 9b                	js     80629a <serve+0x69>
+                    req, whom, (unsigned long)get_uvpt_entry(c->c_ipc),
+                    (char *)c->c_ipc);
+        }
+
+        /* All requests must contain an argument page */
+        if (!(perm & PROT_R)) {
+  8062ff:	f6 45 c4 04          	testb  $0x4,-0x3c(%rbp)
+  806303:	74 72                	je     806377 <serve+0x146>
+            cprintf("Invalid request from %08x: no argument page\n", whom);
+            continue; /* Just leave it hanging... */
+        }
+
+        c->c_busy = 1;
+  806305:	c6 43 1c 01          	movb   $0x1,0x1c(%rbx)
+    asm volatile("rdtsc"
+  806309:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80630b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80630f:	89 c0                	mov    %eax,%eax
+  806311:	48 09 c2             	or     %rax,%rdx
+  806314:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+        c->c_start = read_tsc();
+        c->c_size = sz;
+  806318:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80631c:	48 89 43 08          	mov    %rax,0x8(%rbx)
+        c->c_whom = whom;
+  806320:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  806323:	89 43 10             	mov    %eax,0x10(%rbx)
+        c->c_req = req;
+  806326:	89 4b 14             	mov    %ecx,0x14(%rbx)
+        memcpy(&c->c_args, c->c_ipc, sizeof(c->c_args));
+  806329:	48 8b 33             	mov    (%rbx),%rsi
+  80632c:	48 8d 7b 28          	lea    0x28(%rbx),%rdi
+  806330:	ba 10 00 00 00       	mov    $0x10,%edx
+  806335:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  80633c:	00 00 00 
+  80633f:	ff d0                	call   *%rax
+        serve_request(c);
+  806341:	48 89 df             	mov    %rbx,%rdi
+  806344:	41 ff d6             	call   *%r14
+        bc_writeback();
+  806347:	48 b8 ba 1e 80 00 00 	movabs $0x801eba,%rax
+  80634e:	00 00 00 
+  806351:	ff d0                	call   *%rax
+  806353:	e9 42 ff ff ff       	jmp    80629a <serve+0x69>
+                                     ipc_recv(&whom, c->c_ipc, &sz, &perm);
+  806358:	48 8b 33             	mov    (%rbx),%rsi
+  80635b:	48 8d 4d c4          	lea    -0x3c(%rbp),%rcx
+  80635f:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  806363:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  806367:	48 b8 41 af 80 00 00 	movabs $0x80af41,%rax
+  80636e:	00 00 00 
+  806371:	ff d0                	call   *%rax
+  806373:	89 c1                	mov    %eax,%ecx
+  806375:	eb 84                	jmp    8062fb <serve+0xca>
+            cprintf("Invalid request from %08x: no argument page\n", whom);
+  806377:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  80637a:	48 bf c8 e5 80 00 00 	movabs $0x80e5c8,%rdi
+  806381:	00 00 00 
+  806384:	b8 00 00 00 00       	mov    $0x0,%eax
+  806389:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  806390:	00 00 00 
+  806393:	ff d2                	call   *%rdx
+            continue; /* Just leave it hanging... */
+  806395:	e9 00 ff ff ff       	jmp    80629a <serve+0x69>
+
+000000000080639a <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  80639a:	55                   	push   %rbp
+  80639b:	48 89 e5             	mov    %rsp,%rbp
+  80639e:	41 54                	push   %r12
+  8063a0:	53                   	push   %rbx
+  8063a1:	48 89 f3             	mov    %rsi,%rbx
+    static_assert(sizeof(struct File) == 256, "Unsupported file size");
+    binaryname = "fs";
+  8063a4:	48 b8 f5 e5 80 00 00 	movabs $0x80e5f5,%rax
+  8063ab:	00 00 00 
+  8063ae:	48 a3 88 50 81 00 00 	movabs %rax,0x815088
+  8063b5:	00 00 00 
+    cprintf("FS is running\n");
+  8063b8:	48 bf f8 e5 80 00 00 	movabs $0x80e5f8,%rdi
+  8063bf:	00 00 00 
+  8063c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063c7:	49 bc 35 91 80 00 00 	movabs $0x809135,%r12
+  8063ce:	00 00 00 
+  8063d1:	41 ff d4             	call   *%r12
+
+    pci_init(argv);
+  8063d4:	48 89 df             	mov    %rbx,%rdi
+  8063d7:	48 b8 93 7c 80 00 00 	movabs $0x807c93,%rax
+  8063de:	00 00 00 
+  8063e1:	ff d0                	call   *%rax
+    nvme_init();
+  8063e3:	48 b8 7b 83 80 00 00 	movabs $0x80837b,%rax
+  8063ea:	00 00 00 
+  8063ed:	ff d0                	call   *%rax
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  8063ef:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  8063f4:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  8063f9:	66 ef                	out    %ax,(%dx)
+
+    /* Check that we are able to do I/O */
+    outw(0x8A00, 0x8A00);
+    cprintf("FS can do I/O\n");
+  8063fb:	48 bf 07 e6 80 00 00 	movabs $0x80e607,%rdi
+  806402:	00 00 00 
+  806405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80640a:	41 ff d4             	call   *%r12
+
+    serve_init();
+  80640d:	48 b8 62 58 80 00 00 	movabs $0x805862,%rax
+  806414:	00 00 00 
+  806417:	ff d0                	call   *%rax
+    fs_init();
+  806419:	48 b8 06 2d 80 00 00 	movabs $0x802d06,%rax
+  806420:	00 00 00 
+  806423:	ff d0                	call   *%rax
+    fs_test();
+  806425:	48 b8 a8 66 80 00 00 	movabs $0x8066a8,%rax
+  80642c:	00 00 00 
+  80642f:	ff d0                	call   *%rax
+    serve();
+  806431:	48 b8 31 62 80 00 00 	movabs $0x806231,%rax
+  806438:	00 00 00 
+  80643b:	ff d0                	call   *%rax
+
+000000000080643d <commit_metadata>:
+
+/* With journal on, flush_block() leaves metadata blocks such as
+ * the directory block holding a struct File dirty until commit.
+ * Commit the one holding addr now and check that the journal did it. */
+static void
+commit_metadata(void *addr) {
+  80643d:	55                   	push   %rbp
+  80643e:	48 89 e5             	mov    %rsp,%rbp
+  806441:	41 55                	push   %r13
+  806443:	41 54                	push   %r12
+  806445:	53                   	push   %rbx
+  806446:	48 83 ec 08          	sub    $0x8,%rsp
+  80644a:	48 89 fb             	mov    %rdi,%rbx
+    if (!journal_active() || !is_page_dirty(ROUNDDOWN(addr, BLKSIZE))) return;
+  80644d:	48 b8 b3 4b 80 00 00 	movabs $0x804bb3,%rax
+  806454:	00 00 00 
+  806457:	ff d0                	call   *%rax
+  806459:	84 c0                	test   %al,%al
+  80645b:	75 0b                	jne    806468 <commit_metadata+0x2b>
+
+    uint64_t commits = bc_stats.commits, logged = bc_stats.logged_blocks;
+    bc_sync();
+    assert(bc_stats.commits > commits && bc_stats.logged_blocks > logged);
+}
+  80645d:	48 83 c4 08          	add    $0x8,%rsp
+  806461:	5b                   	pop    %rbx
+  806462:	41 5c                	pop    %r12
+  806464:	41 5d                	pop    %r13
+  806466:	5d                   	pop    %rbp
+  806467:	c3                   	ret
+    if (!journal_active() || !is_page_dirty(ROUNDDOWN(addr, BLKSIZE))) return;
+  806468:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80646f:	48 89 df             	mov    %rbx,%rdi
+  806472:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  806479:	00 00 00 
+  80647c:	ff d0                	call   *%rax
+  80647e:	84 c0                	test   %al,%al
+  806480:	74 db                	je     80645d <commit_metadata+0x20>
+    uint64_t commits = bc_stats.commits, logged = bc_stats.logged_blocks;
+  806482:	48 bb 20 60 81 00 00 	movabs $0x816020,%rbx
+  806489:	00 00 00 
+  80648c:	4c 8b 6b 40          	mov    0x40(%rbx),%r13
+  806490:	4c 8b 63 48          	mov    0x48(%rbx),%r12
+    bc_sync();
+  806494:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  80649b:	00 00 00 
+  80649e:	ff d0                	call   *%rax
+    assert(bc_stats.commits > commits && bc_stats.logged_blocks > logged);
+  8064a0:	4c 3b 6b 40          	cmp    0x40(%rbx),%r13
+  8064a4:	73 06                	jae    8064ac <commit_metadata+0x6f>
+  8064a6:	4c 3b 63 48          	cmp    0x48(%rbx),%r12
+  8064aa:	72 b1                	jb     80645d <commit_metadata+0x20>
+  8064ac:	48 b9 18 e6 80 00 00 	movabs $0x80e618,%rcx
+  8064b3:	00 00 00 
+  8064b6:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  8064bd:	00 00 00 
+  8064c0:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8064c5:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  8064cc:	00 00 00 
+  8064cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064d4:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8064db:	00 00 00 
+  8064de:	41 ff d0             	call   *%r8
+
+00000000008064e1 <check_dir>:
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  8064e1:	8b 8f 80 00 00 00    	mov    0x80(%rdi),%ecx
+  8064e7:	8d 81 ff 0f 00 00    	lea    0xfff(%rcx),%eax
+  8064ed:	85 c9                	test   %ecx,%ecx
+  8064ef:	0f 49 c1             	cmovns %ecx,%eax
+    for (blockno_t i = 0; i < nblock; ++i) {
+  8064f2:	c1 f8 0c             	sar    $0xc,%eax
+  8064f5:	0f 84 ac 01 00 00    	je     8066a7 <check_dir+0x1c6>
+check_dir(struct File *dir) {
+  8064fb:	55                   	push   %rbp
+  8064fc:	48 89 e5             	mov    %rsp,%rbp
+  8064ff:	41 57                	push   %r15
+  806501:	41 56                	push   %r14
+  806503:	41 55                	push   %r13
+  806505:	41 54                	push   %r12
+  806507:	53                   	push   %rbx
+  806508:	48 83 ec 28          	sub    $0x28,%rsp
+    for (blockno_t i = 0; i < nblock; ++i) {
+  80650c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        if (file_block_lookup(dir, i, &blk, &run) < 0 || !blk) continue;
+  806512:	49 bf 50 32 80 00 00 	movabs $0x803250,%r15
+  806519:	00 00 00 
+                    assert(!block_is_free(diskbno));
+  80651c:	41 89 c6             	mov    %eax,%r14d
+  80651f:	49 89 fc             	mov    %rdi,%r12
+  806522:	e9 2b 01 00 00       	jmp    806652 <check_dir+0x171>
+                        check_dir(f);
+  806527:	4c 89 e7             	mov    %r12,%rdi
+  80652a:	48 b8 e1 64 80 00 00 	movabs $0x8064e1,%rax
+  806531:	00 00 00 
+  806534:	ff d0                	call   *%rax
+  806536:	eb 26                	jmp    80655e <check_dir+0x7d>
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  806538:	41 83 c5 01          	add    $0x1,%r13d
+  80653c:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  806543:	00 
+  806544:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  80654a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80654e:	41 39 c5             	cmp    %eax,%r13d
+  806551:	73 6c                	jae    8065bf <check_dir+0xde>
+                    if (f->f_type == FTYPE_DIR) {
+  806553:	41 83 bc 24 84 00 00 	cmpl   $0x1,0x84(%r12)
+  80655a:	00 01 
+  80655c:	74 c9                	je     806527 <check_dir+0x46>
+                    if (file_block_lookup(f, k, &diskbno, &run) < 0 || !diskbno) {
+  80655e:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  806562:	48 8d 55 c4          	lea    -0x3c(%rbp),%rdx
+  806566:	44 89 ee             	mov    %r13d,%esi
+  806569:	4c 89 e7             	mov    %r12,%rdi
+  80656c:	41 ff d7             	call   *%r15
+  80656f:	85 c0                	test   %eax,%eax
+  806571:	78 c5                	js     806538 <check_dir+0x57>
+  806573:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  806576:	85 ff                	test   %edi,%edi
+  806578:	74 be                	je     806538 <check_dir+0x57>
+                    assert(!block_is_free(diskbno));
+  80657a:	48 b8 f9 24 80 00 00 	movabs $0x8024f9,%rax
+  806581:	00 00 00 
+  806584:	ff d0                	call   *%rax
+  806586:	84 c0                	test   %al,%al
+  806588:	74 ae                	je     806538 <check_dir+0x57>
+  80658a:	48 b9 57 e7 80 00 00 	movabs $0x80e757,%rcx
+  806591:	00 00 00 
+  806594:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  80659b:	00 00 00 
+  80659e:	be 2c 00 00 00       	mov    $0x2c,%esi
+  8065a3:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  8065aa:	00 00 00 
+  8065ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065b2:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8065b9:	00 00 00 
+  8065bc:	41 ff d0             	call   *%r8
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  8065bf:	48 81 c3 00 01 00 00 	add    $0x100,%rbx
+  8065c6:	49 39 de             	cmp    %rbx,%r14
+  8065c9:	74 72                	je     80663d <check_dir+0x15c>
+            struct File *f = &(files[j]);
+  8065cb:	49 89 dc             	mov    %rbx,%r12
+            if (strcmp(f->f_name, "\0") != 0) {
+  8065ce:	48 be 3a e9 80 00 00 	movabs $0x80e93a,%rsi
+  8065d5:	00 00 00 
+  8065d8:	48 89 df             	mov    %rbx,%rdi
+  8065db:	48 b8 51 9b 80 00 00 	movabs $0x809b51,%rax
+  8065e2:	00 00 00 
+  8065e5:	ff d0                	call   *%rax
+  8065e7:	85 c0                	test   %eax,%eax
+  8065e9:	74 d4                	je     8065bf <check_dir+0xde>
+                cprintf("checking consistency of %s\n", f->f_name);
+  8065eb:	48 89 de             	mov    %rbx,%rsi
+  8065ee:	48 bf 3b e7 80 00 00 	movabs $0x80e73b,%rdi
+  8065f5:	00 00 00 
+  8065f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065fd:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  806604:	00 00 00 
+  806607:	ff d2                	call   *%rdx
+                if (file_inline(f)) continue;
+  806609:	48 89 df             	mov    %rbx,%rdi
+  80660c:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  806613:	00 00 00 
+  806616:	ff d0                	call   *%rax
+  806618:	84 c0                	test   %al,%al
+  80661a:	75 a3                	jne    8065bf <check_dir+0xde>
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  80661c:	48 63 83 80 00 00 00 	movslq 0x80(%rbx),%rax
+  806623:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  806629:	48 c1 e8 0c          	shr    $0xc,%rax
+  80662d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  806633:	85 c0                	test   %eax,%eax
+  806635:	0f 85 18 ff ff ff    	jne    806553 <check_dir+0x72>
+  80663b:	eb 82                	jmp    8065bf <check_dir+0xde>
+  80663d:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  806641:	4c 8b 65 b0          	mov    -0x50(%rbp),%r12
+  806645:	44 8b 75 b8          	mov    -0x48(%rbp),%r14d
+    for (blockno_t i = 0; i < nblock; ++i) {
+  806649:	41 83 c5 01          	add    $0x1,%r13d
+  80664d:	45 39 ee             	cmp    %r13d,%r14d
+  806650:	74 46                	je     806698 <check_dir+0x1b7>
+        if (file_block_lookup(dir, i, &blk, &run) < 0 || !blk) continue;
+  806652:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  806656:	48 8d 55 cc          	lea    -0x34(%rbp),%rdx
+  80665a:	44 89 ee             	mov    %r13d,%esi
+  80665d:	4c 89 e7             	mov    %r12,%rdi
+  806660:	41 ff d7             	call   *%r15
+  806663:	85 c0                	test   %eax,%eax
+  806665:	78 e2                	js     806649 <check_dir+0x168>
+  806667:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80666a:	85 ff                	test   %edi,%edi
+  80666c:	74 db                	je     806649 <check_dir+0x168>
+        files = (struct File *)diskaddr(blk);
+  80666e:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  806675:	00 00 00 
+  806678:	ff d0                	call   *%rax
+  80667a:	48 89 c3             	mov    %rax,%rbx
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  80667d:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+            if (strcmp(f->f_name, "\0") != 0) {
+  806684:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  806688:	4c 89 65 b0          	mov    %r12,-0x50(%rbp)
+  80668c:	44 89 75 b8          	mov    %r14d,-0x48(%rbp)
+  806690:	49 89 c6             	mov    %rax,%r14
+  806693:	e9 33 ff ff ff       	jmp    8065cb <check_dir+0xea>
+}
+  806698:	48 83 c4 28          	add    $0x28,%rsp
+  80669c:	5b                   	pop    %rbx
+  80669d:	41 5c                	pop    %r12
+  80669f:	41 5d                	pop    %r13
+  8066a1:	41 5e                	pop    %r14
+  8066a3:	41 5f                	pop    %r15
+  8066a5:	5d                   	pop    %rbp
+  8066a6:	c3                   	ret
+  8066a7:	c3                   	ret
+
+00000000008066a8 <fs_test>:
+    check_dir_index();
+}
+#endif
+
+void
+fs_test(void) {
+  8066a8:	55                   	push   %rbp
+  8066a9:	48 89 e5             	mov    %rsp,%rbp
+  8066ac:	53                   	push   %rbx
+  8066ad:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+    char *blk;
+    uint32_t *bits;
+    blockno_t diskbno, run;
+
+    /* Back up bitmap */
+    if ((r = sys_alloc_region(0, (void *)PAGE_SIZE, PAGE_SIZE, PROT_RW)) < 0)
+  8066b4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8066b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8066be:	be 00 10 00 00       	mov    $0x1000,%esi
+  8066c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8066c8:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  8066cf:	00 00 00 
+  8066d2:	ff d0                	call   *%rax
+  8066d4:	85 c0                	test   %eax,%eax
+  8066d6:	0f 88 53 04 00 00    	js     806b2f <fs_test+0x487>
+        panic("sys_page_alloc: %i", r);
+    bits = (uint32_t *)PAGE_SIZE;
+    memmove(bits, bitmap, PAGE_SIZE);
+  8066dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8066e1:	48 b8 60 72 8a 00 00 	movabs $0x8a7260,%rax
+  8066e8:	00 00 00 
+  8066eb:	48 8b 30             	mov    (%rax),%rsi
+  8066ee:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8066f3:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  8066fa:	00 00 00 
+  8066fd:	ff d0                	call   *%rax
+    /* Allocate block */
+    if (!(r = alloc_block()))
+  8066ff:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  806706:	00 00 00 
+  806709:	ff d0                	call   *%rax
+  80670b:	89 c1                	mov    %eax,%ecx
+  80670d:	85 c0                	test   %eax,%eax
+  80670f:	0f 84 47 04 00 00    	je     806b5c <fs_test+0x4b4>
+        panic("alloc_block: %i", -E_NO_DISK);
+    /* Check that block was free */
+    assert(TSTBIT(bits, r));
+  806715:	8d 50 1f             	lea    0x1f(%rax),%edx
+  806718:	0f 49 d0             	cmovns %eax,%edx
+  80671b:	c1 fa 05             	sar    $0x5,%edx
+  80671e:	48 63 d2             	movslq %edx,%rdx
+  806721:	b8 01 00 00 00       	mov    $0x1,%eax
+  806726:	d3 e0                	shl    %cl,%eax
+  806728:	89 c1                	mov    %eax,%ecx
+  80672a:	23 04 95 00 10 00 00 	and    0x1000(,%rdx,4),%eax
+  806731:	0f 84 55 04 00 00    	je     806b8c <fs_test+0x4e4>
+    /* And is not free any more */
+    assert(!TSTBIT(bitmap, r));
+  806737:	48 a1 60 72 8a 00 00 	movabs 0x8a7260,%rax
+  80673e:	00 00 00 
+  806741:	23 0c 90             	and    (%rax,%rdx,4),%ecx
+  806744:	0f 85 72 04 00 00    	jne    806bbc <fs_test+0x514>
+    cprintf("alloc_block is good\n");
+  80674a:	48 bf b5 e7 80 00 00 	movabs $0x80e7b5,%rdi
+  806751:	00 00 00 
+  806754:	b8 00 00 00 00       	mov    $0x0,%eax
+  806759:	48 bb 35 91 80 00 00 	movabs $0x809135,%rbx
+  806760:	00 00 00 
+  806763:	ff d3                	call   *%rbx
+    check_dir(&super->s_root);
+  806765:	48 a1 68 72 8a 00 00 	movabs 0x8a7268,%rax
+  80676c:	00 00 00 
+  80676f:	48 8d 78 08          	lea    0x8(%rax),%rdi
+  806773:	48 b8 e1 64 80 00 00 	movabs $0x8064e1,%rax
+  80677a:	00 00 00 
+  80677d:	ff d0                	call   *%rax
+    check_consistency();
+    cprintf("fs consistency is good\n");
+  80677f:	48 bf ca e7 80 00 00 	movabs $0x80e7ca,%rdi
+  806786:	00 00 00 
+  806789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80678e:	ff d3                	call   *%rbx
+#ifdef CONFIG_SELFTEST
+    check_features();
+#endif
+
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  806790:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  806794:	48 bf e2 e7 80 00 00 	movabs $0x80e7e2,%rdi
+  80679b:	00 00 00 
+  80679e:	48 b8 5b 46 80 00 00 	movabs $0x80465b,%rax
+  8067a5:	00 00 00 
+  8067a8:	ff d0                	call   *%rax
+  8067aa:	85 c0                	test   %eax,%eax
+  8067ac:	0f 88 3f 04 00 00    	js     806bf1 <fs_test+0x549>
+        panic("file_open /not-found: %i", r);
+    else if (r == 0)
+  8067b2:	0f 84 6f 04 00 00    	je     806c27 <fs_test+0x57f>
+        panic("file_open /not-found succeeded!");
+    if ((r = file_open("/newmotd", &f)) < 0)
+  8067b8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8067bc:	48 bf 06 e8 80 00 00 	movabs $0x80e806,%rdi
+  8067c3:	00 00 00 
+  8067c6:	48 b8 5b 46 80 00 00 	movabs $0x80465b,%rax
+  8067cd:	00 00 00 
+  8067d0:	ff d0                	call   *%rax
+  8067d2:	85 c0                	test   %eax,%eax
+  8067d4:	0f 88 72 04 00 00    	js     806c4c <fs_test+0x5a4>
+        panic("file_open /newmotd: %i", r);
+    cprintf("file_open is good\n");
+  8067da:	48 bf 26 e8 80 00 00 	movabs $0x80e826,%rdi
+  8067e1:	00 00 00 
+  8067e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067e9:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  8067f0:	00 00 00 
+  8067f3:	ff d2                	call   *%rdx
+
+    if (file_inline(f)) {
+  8067f5:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8067f9:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  806800:	00 00 00 
+  806803:	ff d0                	call   *%rax
+  806805:	84 c0                	test   %al,%al
+  806807:	0f 84 bb 00 00 00    	je     8068c8 <fs_test+0x220>
+        char buf[FILE_INLINE_MAX];
+        if ((r = file_read(f, buf, sizeof(buf), 0)) != strlen(msg) || memcmp(buf, msg, r))
+  80680d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806812:	ba 70 00 00 00       	mov    $0x70,%edx
+  806817:	48 8d b5 68 ff ff ff 	lea    -0x98(%rbp),%rsi
+  80681e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806822:	48 b8 78 36 80 00 00 	movabs $0x803678,%rax
+  806829:	00 00 00 
+  80682c:	ff d0                	call   *%rax
+  80682e:	48 63 d8             	movslq %eax,%rbx
+  806831:	48 bf 78 e6 80 00 00 	movabs $0x80e678,%rdi
+  806838:	00 00 00 
+  80683b:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  806842:	00 00 00 
+  806845:	ff d0                	call   *%rax
+  806847:	48 39 c3             	cmp    %rax,%rbx
+  80684a:	0f 85 29 04 00 00    	jne    806c79 <fs_test+0x5d1>
+  806850:	48 89 da             	mov    %rbx,%rdx
+  806853:	48 be 78 e6 80 00 00 	movabs $0x80e678,%rsi
+  80685a:	00 00 00 
+  80685d:	48 8d bd 68 ff ff ff 	lea    -0x98(%rbp),%rdi
+  806864:	48 b8 5a 9f 80 00 00 	movabs $0x809f5a,%rax
+  80686b:	00 00 00 
+  80686e:	ff d0                	call   *%rax
+  806870:	85 c0                	test   %eax,%eax
+  806872:	0f 85 01 04 00 00    	jne    806c79 <fs_test+0x5d1>
+            panic("file_read of inline file returned wrong data");
+        /* Growing the file moves its data to a block */
+        if ((r = file_set_size(f, BLKSIZE)) < 0)
+  806878:	be 00 10 00 00       	mov    $0x1000,%esi
+  80687d:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806881:	48 b8 7c 39 80 00 00 	movabs $0x80397c,%rax
+  806888:	00 00 00 
+  80688b:	ff d0                	call   *%rax
+  80688d:	85 c0                	test   %eax,%eax
+  80688f:	0f 88 0e 04 00 00    	js     806ca3 <fs_test+0x5fb>
+            panic("file_set_size: %i", r);
+        assert(!file_inline(f));
+  806895:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806899:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  8068a0:	00 00 00 
+  8068a3:	ff d0                	call   *%rax
+  8068a5:	84 c0                	test   %al,%al
+  8068a7:	0f 85 23 04 00 00    	jne    806cd0 <fs_test+0x628>
+        cprintf("inline file is good\n");
+  8068ad:	48 bf 5b e8 80 00 00 	movabs $0x80e85b,%rdi
+  8068b4:	00 00 00 
+  8068b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068bc:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  8068c3:	00 00 00 
+  8068c6:	ff d2                	call   *%rdx
+    }
+
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  8068c8:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8068cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8068d1:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8068d5:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  8068dc:	00 00 00 
+  8068df:	ff d0                	call   *%rax
+  8068e1:	85 c0                	test   %eax,%eax
+  8068e3:	0f 88 1c 04 00 00    	js     806d05 <fs_test+0x65d>
+        panic("file_get_block: %i", r);
+    if (strcmp(blk, msg) != 0)
+  8068e9:	48 be 78 e6 80 00 00 	movabs $0x80e678,%rsi
+  8068f0:	00 00 00 
+  8068f3:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8068f7:	48 b8 51 9b 80 00 00 	movabs $0x809b51,%rax
+  8068fe:	00 00 00 
+  806901:	ff d0                	call   *%rax
+  806903:	85 c0                	test   %eax,%eax
+  806905:	0f 85 27 04 00 00    	jne    806d32 <fs_test+0x68a>
+        panic("file_get_block returned wrong data");
+    cprintf("file_get_block is good\n");
+  80690b:	48 bf 83 e8 80 00 00 	movabs $0x80e883,%rdi
+  806912:	00 00 00 
+  806915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80691a:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  806921:	00 00 00 
+  806924:	ff d2                	call   *%rdx
+
+    *(volatile char *)blk = *(volatile char *)blk;
+  806926:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80692a:	0f b6 10             	movzbl (%rax),%edx
+  80692d:	88 10                	mov    %dl,(%rax)
+    assert(is_page_dirty(blk));
+  80692f:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806933:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  80693a:	00 00 00 
+  80693d:	ff d0                	call   *%rax
+  80693f:	84 c0                	test   %al,%al
+  806941:	0f 84 15 04 00 00    	je     806d5c <fs_test+0x6b4>
+    file_flush(f);
+  806947:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80694b:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  806952:	00 00 00 
+  806955:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  806957:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80695b:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  806962:	00 00 00 
+  806965:	ff d0                	call   *%rax
+  806967:	84 c0                	test   %al,%al
+  806969:	0f 85 1d 04 00 00    	jne    806d8c <fs_test+0x6e4>
+    cprintf("file_flush is good\n");
+  80696f:	48 bf af e8 80 00 00 	movabs $0x80e8af,%rdi
+  806976:	00 00 00 
+  806979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80697e:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  806985:	00 00 00 
+  806988:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, 0)) < 0)
+  80698a:	be 00 00 00 00       	mov    $0x0,%esi
+  80698f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806993:	48 b8 7c 39 80 00 00 	movabs $0x80397c,%rax
+  80699a:	00 00 00 
+  80699d:	ff d0                	call   *%rax
+  80699f:	85 c0                	test   %eax,%eax
+  8069a1:	0f 88 1a 04 00 00    	js     806dc1 <fs_test+0x719>
+        panic("file_set_size: %i", r);
+    assert(file_block_lookup(f, 0, &diskbno, &run) == 0 && !diskbno);
+  8069a7:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8069ab:	48 8d 55 dc          	lea    -0x24(%rbp),%rdx
+  8069af:	be 00 00 00 00       	mov    $0x0,%esi
+  8069b4:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8069b8:	48 b8 50 32 80 00 00 	movabs $0x803250,%rax
+  8069bf:	00 00 00 
+  8069c2:	ff d0                	call   *%rax
+  8069c4:	0b 45 dc             	or     -0x24(%rbp),%eax
+  8069c7:	0f 85 21 04 00 00    	jne    806dee <fs_test+0x746>
+    commit_metadata(f);
+  8069cd:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8069d1:	48 b8 3d 64 80 00 00 	movabs $0x80643d,%rax
+  8069d8:	00 00 00 
+  8069db:	ff d0                	call   *%rax
+    assert(!is_page_dirty(f));
+  8069dd:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8069e1:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  8069e8:	00 00 00 
+  8069eb:	ff d0                	call   *%rax
+  8069ed:	84 c0                	test   %al,%al
+  8069ef:	0f 85 2e 04 00 00    	jne    806e23 <fs_test+0x77b>
+    cprintf("file_truncate is good\n");
+  8069f5:	48 bf d5 e8 80 00 00 	movabs $0x80e8d5,%rdi
+  8069fc:	00 00 00 
+  8069ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a04:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  806a0b:	00 00 00 
+  806a0e:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, strlen(msg))) < 0)
+  806a10:	48 bf 78 e6 80 00 00 	movabs $0x80e678,%rdi
+  806a17:	00 00 00 
+  806a1a:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  806a21:	00 00 00 
+  806a24:	ff d0                	call   *%rax
+  806a26:	89 c6                	mov    %eax,%esi
+  806a28:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806a2c:	48 b8 7c 39 80 00 00 	movabs $0x80397c,%rax
+  806a33:	00 00 00 
+  806a36:	ff d0                	call   *%rax
+  806a38:	85 c0                	test   %eax,%eax
+  806a3a:	0f 88 18 04 00 00    	js     806e58 <fs_test+0x7b0>
+        panic("file_set_size 2: %i", r);
+    commit_metadata(f);
+  806a40:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806a44:	48 b8 3d 64 80 00 00 	movabs $0x80643d,%rax
+  806a4b:	00 00 00 
+  806a4e:	ff d0                	call   *%rax
+    assert(!is_page_dirty(f));
+  806a50:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806a54:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  806a5b:	00 00 00 
+  806a5e:	ff d0                	call   *%rax
+  806a60:	84 c0                	test   %al,%al
+  806a62:	0f 85 1d 04 00 00    	jne    806e85 <fs_test+0x7dd>
+    if (file_inline(f)) {
+  806a68:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806a6c:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  806a73:	00 00 00 
+  806a76:	ff d0                	call   *%rax
+  806a78:	84 c0                	test   %al,%al
+  806a7a:	0f 84 95 04 00 00    	je     806f15 <fs_test+0x86d>
+        if ((r = file_write(f, msg, strlen(msg), 0)) < 0)
+  806a80:	48 bb 78 e6 80 00 00 	movabs $0x80e678,%rbx
+  806a87:	00 00 00 
+  806a8a:	48 89 df             	mov    %rbx,%rdi
+  806a8d:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  806a94:	00 00 00 
+  806a97:	ff d0                	call   *%rax
+  806a99:	48 89 c2             	mov    %rax,%rdx
+  806a9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806aa1:	48 89 de             	mov    %rbx,%rsi
+  806aa4:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806aa8:	48 b8 88 3c 80 00 00 	movabs $0x803c88,%rax
+  806aaf:	00 00 00 
+  806ab2:	ff d0                	call   *%rax
+  806ab4:	89 c1                	mov    %eax,%ecx
+  806ab6:	85 c0                	test   %eax,%eax
+  806ab8:	0f 88 fc 03 00 00    	js     806eba <fs_test+0x812>
+            panic("file_write: %i", r);
+        assert(is_page_dirty(f));
+  806abe:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806ac2:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  806ac9:	00 00 00 
+  806acc:	ff d0                	call   *%rax
+  806ace:	84 c0                	test   %al,%al
+  806ad0:	0f 84 0f 04 00 00    	je     806ee5 <fs_test+0x83d>
+        file_flush(f);
+  806ad6:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806ada:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  806ae1:	00 00 00 
+  806ae4:	ff d0                	call   *%rax
+        strcpy(blk, msg);
+        assert(is_page_dirty(blk));
+        file_flush(f);
+        assert(!is_page_dirty(blk));
+    }
+    commit_metadata(f);
+  806ae6:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806aea:	48 b8 3d 64 80 00 00 	movabs $0x80643d,%rax
+  806af1:	00 00 00 
+  806af4:	ff d0                	call   *%rax
+    assert(!is_page_dirty(f));
+  806af6:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806afa:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  806b01:	00 00 00 
+  806b04:	ff d0                	call   *%rax
+  806b06:	84 c0                	test   %al,%al
+  806b08:	0f 85 14 05 00 00    	jne    807022 <fs_test+0x97a>
+    cprintf("file rewrite is good\n");
+  806b0e:	48 bf 24 e9 80 00 00 	movabs $0x80e924,%rdi
+  806b15:	00 00 00 
+  806b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b1d:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  806b24:	00 00 00 
+  806b27:	ff d2                	call   *%rdx
+}
+  806b29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806b2d:	c9                   	leave
+  806b2e:	c3                   	ret
+        panic("sys_page_alloc: %i", r);
+  806b2f:	89 c1                	mov    %eax,%ecx
+  806b31:	48 ba 6f e7 80 00 00 	movabs $0x80e76f,%rdx
+  806b38:	00 00 00 
+  806b3b:	be a9 01 00 00       	mov    $0x1a9,%esi
+  806b40:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806b47:	00 00 00 
+  806b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b4f:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806b56:	00 00 00 
+  806b59:	41 ff d0             	call   *%r8
+        panic("alloc_block: %i", -E_NO_DISK);
+  806b5c:	b9 f3 ff ff ff       	mov    $0xfffffff3,%ecx
+  806b61:	48 ba 82 e7 80 00 00 	movabs $0x80e782,%rdx
+  806b68:	00 00 00 
+  806b6b:	be ae 01 00 00       	mov    $0x1ae,%esi
+  806b70:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806b77:	00 00 00 
+  806b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b7f:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806b86:	00 00 00 
+  806b89:	41 ff d0             	call   *%r8
+    assert(TSTBIT(bits, r));
+  806b8c:	48 b9 92 e7 80 00 00 	movabs $0x80e792,%rcx
+  806b93:	00 00 00 
+  806b96:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  806b9d:	00 00 00 
+  806ba0:	be b0 01 00 00       	mov    $0x1b0,%esi
+  806ba5:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806bac:	00 00 00 
+  806baf:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806bb6:	00 00 00 
+  806bb9:	41 ff d0             	call   *%r8
+    assert(!TSTBIT(bitmap, r));
+  806bbc:	48 b9 a2 e7 80 00 00 	movabs $0x80e7a2,%rcx
+  806bc3:	00 00 00 
+  806bc6:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  806bcd:	00 00 00 
+  806bd0:	be b2 01 00 00       	mov    $0x1b2,%esi
+  806bd5:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806bdc:	00 00 00 
+  806bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  806be4:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806beb:	00 00 00 
+  806bee:	41 ff d0             	call   *%r8
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  806bf1:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  806bf4:	0f 84 be fb ff ff    	je     8067b8 <fs_test+0x110>
+        panic("file_open /not-found: %i", r);
+  806bfa:	89 c1                	mov    %eax,%ecx
+  806bfc:	48 ba ed e7 80 00 00 	movabs $0x80e7ed,%rdx
+  806c03:	00 00 00 
+  806c06:	be bb 01 00 00       	mov    $0x1bb,%esi
+  806c0b:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806c12:	00 00 00 
+  806c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c1a:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806c21:	00 00 00 
+  806c24:	41 ff d0             	call   *%r8
+        panic("file_open /not-found succeeded!");
+  806c27:	48 ba 58 e6 80 00 00 	movabs $0x80e658,%rdx
+  806c2e:	00 00 00 
+  806c31:	be bd 01 00 00       	mov    $0x1bd,%esi
+  806c36:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806c3d:	00 00 00 
+  806c40:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  806c47:	00 00 00 
+  806c4a:	ff d1                	call   *%rcx
+        panic("file_open /newmotd: %i", r);
+  806c4c:	89 c1                	mov    %eax,%ecx
+  806c4e:	48 ba 0f e8 80 00 00 	movabs $0x80e80f,%rdx
+  806c55:	00 00 00 
+  806c58:	be bf 01 00 00       	mov    $0x1bf,%esi
+  806c5d:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806c64:	00 00 00 
+  806c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c6c:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806c73:	00 00 00 
+  806c76:	41 ff d0             	call   *%r8
+            panic("file_read of inline file returned wrong data");
+  806c79:	48 ba a0 e6 80 00 00 	movabs $0x80e6a0,%rdx
+  806c80:	00 00 00 
+  806c83:	be c5 01 00 00       	mov    $0x1c5,%esi
+  806c88:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806c8f:	00 00 00 
+  806c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c97:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  806c9e:	00 00 00 
+  806ca1:	ff d1                	call   *%rcx
+            panic("file_set_size: %i", r);
+  806ca3:	89 c1                	mov    %eax,%ecx
+  806ca5:	48 ba 39 e8 80 00 00 	movabs $0x80e839,%rdx
+  806cac:	00 00 00 
+  806caf:	be c8 01 00 00       	mov    $0x1c8,%esi
+  806cb4:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806cbb:	00 00 00 
+  806cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cc3:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806cca:	00 00 00 
+  806ccd:	41 ff d0             	call   *%r8
+        assert(!file_inline(f));
+  806cd0:	48 b9 4b e8 80 00 00 	movabs $0x80e84b,%rcx
+  806cd7:	00 00 00 
+  806cda:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  806ce1:	00 00 00 
+  806ce4:	be c9 01 00 00       	mov    $0x1c9,%esi
+  806ce9:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806cf0:	00 00 00 
+  806cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cf8:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806cff:	00 00 00 
+  806d02:	41 ff d0             	call   *%r8
+        panic("file_get_block: %i", r);
+  806d05:	89 c1                	mov    %eax,%ecx
+  806d07:	48 ba 70 e8 80 00 00 	movabs $0x80e870,%rdx
+  806d0e:	00 00 00 
+  806d11:	be ce 01 00 00       	mov    $0x1ce,%esi
+  806d16:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806d1d:	00 00 00 
+  806d20:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d25:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806d2c:	00 00 00 
+  806d2f:	41 ff d0             	call   *%r8
+        panic("file_get_block returned wrong data");
+  806d32:	48 ba d0 e6 80 00 00 	movabs $0x80e6d0,%rdx
+  806d39:	00 00 00 
+  806d3c:	be d0 01 00 00       	mov    $0x1d0,%esi
+  806d41:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806d48:	00 00 00 
+  806d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d50:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  806d57:	00 00 00 
+  806d5a:	ff d1                	call   *%rcx
+    assert(is_page_dirty(blk));
+  806d5c:	48 b9 9c e8 80 00 00 	movabs $0x80e89c,%rcx
+  806d63:	00 00 00 
+  806d66:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  806d6d:	00 00 00 
+  806d70:	be d4 01 00 00       	mov    $0x1d4,%esi
+  806d75:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806d7c:	00 00 00 
+  806d7f:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806d86:	00 00 00 
+  806d89:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  806d8c:	48 b9 9b e8 80 00 00 	movabs $0x80e89b,%rcx
+  806d93:	00 00 00 
+  806d96:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  806d9d:	00 00 00 
+  806da0:	be d6 01 00 00       	mov    $0x1d6,%esi
+  806da5:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806dac:	00 00 00 
+  806daf:	b8 00 00 00 00       	mov    $0x0,%eax
+  806db4:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806dbb:	00 00 00 
+  806dbe:	41 ff d0             	call   *%r8
+        panic("file_set_size: %i", r);
+  806dc1:	89 c1                	mov    %eax,%ecx
+  806dc3:	48 ba 39 e8 80 00 00 	movabs $0x80e839,%rdx
+  806dca:	00 00 00 
+  806dcd:	be da 01 00 00       	mov    $0x1da,%esi
+  806dd2:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806dd9:	00 00 00 
+  806ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  806de1:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806de8:	00 00 00 
+  806deb:	41 ff d0             	call   *%r8
+    assert(file_block_lookup(f, 0, &diskbno, &run) == 0 && !diskbno);
+  806dee:	48 b9 f8 e6 80 00 00 	movabs $0x80e6f8,%rcx
+  806df5:	00 00 00 
+  806df8:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  806dff:	00 00 00 
+  806e02:	be db 01 00 00       	mov    $0x1db,%esi
+  806e07:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806e0e:	00 00 00 
+  806e11:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e16:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806e1d:	00 00 00 
+  806e20:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  806e23:	48 b9 c3 e8 80 00 00 	movabs $0x80e8c3,%rcx
+  806e2a:	00 00 00 
+  806e2d:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  806e34:	00 00 00 
+  806e37:	be dd 01 00 00       	mov    $0x1dd,%esi
+  806e3c:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806e43:	00 00 00 
+  806e46:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e4b:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806e52:	00 00 00 
+  806e55:	41 ff d0             	call   *%r8
+        panic("file_set_size 2: %i", r);
+  806e58:	89 c1                	mov    %eax,%ecx
+  806e5a:	48 ba ec e8 80 00 00 	movabs $0x80e8ec,%rdx
+  806e61:	00 00 00 
+  806e64:	be e1 01 00 00       	mov    $0x1e1,%esi
+  806e69:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806e70:	00 00 00 
+  806e73:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e78:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806e7f:	00 00 00 
+  806e82:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  806e85:	48 b9 c3 e8 80 00 00 	movabs $0x80e8c3,%rcx
+  806e8c:	00 00 00 
+  806e8f:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  806e96:	00 00 00 
+  806e99:	be e3 01 00 00       	mov    $0x1e3,%esi
+  806e9e:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806ea5:	00 00 00 
+  806ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ead:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806eb4:	00 00 00 
+  806eb7:	41 ff d0             	call   *%r8
+            panic("file_write: %i", r);
+  806eba:	48 ba 00 e9 80 00 00 	movabs $0x80e900,%rdx
+  806ec1:	00 00 00 
+  806ec4:	be e6 01 00 00       	mov    $0x1e6,%esi
+  806ec9:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806ed0:	00 00 00 
+  806ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ed8:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806edf:	00 00 00 
+  806ee2:	41 ff d0             	call   *%r8
+        assert(is_page_dirty(f));
+  806ee5:	48 b9 c4 e8 80 00 00 	movabs $0x80e8c4,%rcx
+  806eec:	00 00 00 
+  806eef:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  806ef6:	00 00 00 
+  806ef9:	be e7 01 00 00       	mov    $0x1e7,%esi
+  806efe:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806f05:	00 00 00 
+  806f08:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806f0f:	00 00 00 
+  806f12:	41 ff d0             	call   *%r8
+        if ((r = file_get_block(f, 0, &blk)) < 0)
+  806f15:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806f19:	be 00 00 00 00       	mov    $0x0,%esi
+  806f1e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806f22:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  806f29:	00 00 00 
+  806f2c:	ff d0                	call   *%rax
+  806f2e:	85 c0                	test   %eax,%eax
+  806f30:	0f 88 8f 00 00 00    	js     806fc5 <fs_test+0x91d>
+        strcpy(blk, msg);
+  806f36:	48 be 78 e6 80 00 00 	movabs $0x80e678,%rsi
+  806f3d:	00 00 00 
+  806f40:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806f44:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  806f4b:	00 00 00 
+  806f4e:	ff d0                	call   *%rax
+        assert(is_page_dirty(blk));
+  806f50:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806f54:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  806f5b:	00 00 00 
+  806f5e:	ff d0                	call   *%rax
+  806f60:	84 c0                	test   %al,%al
+  806f62:	0f 84 8a 00 00 00    	je     806ff2 <fs_test+0x94a>
+        file_flush(f);
+  806f68:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806f6c:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  806f73:	00 00 00 
+  806f76:	ff d0                	call   *%rax
+        assert(!is_page_dirty(blk));
+  806f78:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806f7c:	48 b8 0c d1 80 00 00 	movabs $0x80d10c,%rax
+  806f83:	00 00 00 
+  806f86:	ff d0                	call   *%rax
+  806f88:	84 c0                	test   %al,%al
+  806f8a:	0f 84 56 fb ff ff    	je     806ae6 <fs_test+0x43e>
+  806f90:	48 b9 9b e8 80 00 00 	movabs $0x80e89b,%rcx
+  806f97:	00 00 00 
+  806f9a:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  806fa1:	00 00 00 
+  806fa4:	be ef 01 00 00       	mov    $0x1ef,%esi
+  806fa9:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806fb0:	00 00 00 
+  806fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  806fb8:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806fbf:	00 00 00 
+  806fc2:	41 ff d0             	call   *%r8
+            panic("file_get_block 2: %i", r);
+  806fc5:	89 c1                	mov    %eax,%ecx
+  806fc7:	48 ba 0f e9 80 00 00 	movabs $0x80e90f,%rdx
+  806fce:	00 00 00 
+  806fd1:	be eb 01 00 00       	mov    $0x1eb,%esi
+  806fd6:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  806fdd:	00 00 00 
+  806fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+  806fe5:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  806fec:	00 00 00 
+  806fef:	41 ff d0             	call   *%r8
+        assert(is_page_dirty(blk));
+  806ff2:	48 b9 9c e8 80 00 00 	movabs $0x80e89c,%rcx
+  806ff9:	00 00 00 
+  806ffc:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  807003:	00 00 00 
+  807006:	be ed 01 00 00       	mov    $0x1ed,%esi
+  80700b:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  807012:	00 00 00 
+  807015:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  80701c:	00 00 00 
+  80701f:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  807022:	48 b9 c3 e8 80 00 00 	movabs $0x80e8c3,%rcx
+  807029:	00 00 00 
+  80702c:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  807033:	00 00 00 
+  807036:	be f2 01 00 00       	mov    $0x1f2,%esi
+  80703b:	48 bf 31 e7 80 00 00 	movabs $0x80e731,%rdi
+  807042:	00 00 00 
+  807045:	b8 00 00 00 00       	mov    $0x0,%eax
+  80704a:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  807051:	00 00 00 
+  807054:	41 ff d0             	call   *%r8
+
+0000000000807057 <pci_iop_read_dword>:
+
+__attribute__((always_inline)) static inline void
+pci_iop_select_address(struct PciDevice *pcid, uint8_t reg) {
+    /* Assemble address of requested port. */
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+                       ((uint32_t)pcid->bus << 16) |
+  807057:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  80705b:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  80705e:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  807062:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  807065:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  807067:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+  80706d:	09 f0                	or     %esi,%eax
+  80706f:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  807073:	c1 e2 08             	shl    $0x8,%edx
+  807076:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  807078:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  80707d:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  807082:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  807083:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  807088:	ed                   	in     (%dx),%eax
+static inline uint32_t
+pci_iop_read_dword(struct PciDevice *pcid, uint8_t reg) {
+    pci_iop_select_address(pcid, reg);
+    /* Read 32-bit value from the selected PCI address */
+    return inl(PCI_PORT_DATA);
+}
+  807089:	c3                   	ret
+
+000000000080708a <pci_iop_write_dword>:
+
+static inline void
+pci_iop_write_dword(struct PciDevice *pcid, uint8_t reg, uint32_t value) {
+  80708a:	89 d1                	mov    %edx,%ecx
+                       ((uint32_t)pcid->bus << 16) |
+  80708c:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  807090:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  807093:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  807097:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  80709a:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  80709c:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+  8070a2:	09 f0                	or     %esi,%eax
+  8070a4:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  8070a8:	c1 e2 08             	shl    $0x8,%edx
+  8070ab:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  8070ad:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  8070b2:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  8070b7:	ef                   	out    %eax,(%dx)
+  8070b8:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  8070bd:	89 c8                	mov    %ecx,%eax
+  8070bf:	ef                   	out    %eax,(%dx)
+    pci_iop_select_address(pcid, reg);
+    /* Write 32-bit value to the selected PCI address */
+    outl(PCI_PORT_DATA, value);
+}
+  8070c0:	c3                   	ret
+
+00000000008070c1 <pci_ecam_read_word>:
+}
+
+static inline volatile void *
+pci_ecam_addr(struct PciDevice *pcid, uint8_t reg) {
+    return (volatile void *)(ecam_base_addr +
+                             ((pcid->bus & 0xFF) << 20) +
+  8070c1:	0f b6 57 10          	movzbl 0x10(%rdi),%edx
+  8070c5:	c1 e2 14             	shl    $0x14,%edx
+  8070c8:	48 63 d2             	movslq %edx,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+                             ((pcid->function & 0x7) << 12) +
+                             (reg & 0xFFF));
+  8070cb:	81 e6 fe 00 00 00    	and    $0xfe,%esi
+                             ((pcid->function & 0x7) << 12) +
+  8070d1:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  8070d4:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  8070d8:	c1 e0 0f             	shl    $0xf,%eax
+  8070db:	25 00 80 0f 00       	and    $0xf8000,%eax
+                             ((pcid->function & 0x7) << 12) +
+  8070e0:	48 01 c2             	add    %rax,%rdx
+  8070e3:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  8070e7:	c1 e0 0c             	shl    $0xc,%eax
+  8070ea:	25 00 70 00 00       	and    $0x7000,%eax
+  8070ef:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  8070f2:	48 a1 b0 5c 8c 00 00 	movabs 0x8c5cb0,%rax
+  8070f9:	00 00 00 
+  8070fc:	48 01 c2             	add    %rax,%rdx
+    return *(volatile uint32_t *)pci_ecam_addr(pcid, reg & 0xffc);
+}
+
+static inline uint16_t
+pci_ecam_read_word(struct PciDevice *pcid, uint8_t reg) {
+    return *(volatile uint16_t *)pci_ecam_addr(pcid, reg & 0xffe);
+  8070ff:	0f b7 02             	movzwl (%rdx),%eax
+}
+  807102:	c3                   	ret
+
+0000000000807103 <parse_hex>:
+    return -1;
+}
+
+static unsigned long
+parse_hex(char **str) {
+    unsigned long x = 0;
+  807103:	b8 00 00 00 00       	mov    $0x0,%eax
+  807108:	eb 14                	jmp    80711e <parse_hex+0x1b>
+        return 10 + c - 'a';
+  80710a:	8d 56 a9             	lea    -0x57(%rsi),%edx
+    for (;; (*str)++) {
+        int d = to_hexdigit(**str);
+        if (d < 0)
+            return x;
+
+        x = (x << 4) + d;
+  80710d:	48 c1 e0 04          	shl    $0x4,%rax
+  807111:	48 63 d2             	movslq %edx,%rdx
+  807114:	48 01 d0             	add    %rdx,%rax
+    for (;; (*str)++) {
+  807117:	48 83 c1 01          	add    $0x1,%rcx
+  80711b:	48 89 0f             	mov    %rcx,(%rdi)
+        int d = to_hexdigit(**str);
+  80711e:	48 8b 0f             	mov    (%rdi),%rcx
+  807121:	0f be 31             	movsbl (%rcx),%esi
+    if (c - '0' <= 9)
+  807124:	8d 56 d0             	lea    -0x30(%rsi),%edx
+  807127:	83 fa 09             	cmp    $0x9,%edx
+  80712a:	76 e1                	jbe    80710d <parse_hex+0xa>
+    if (c - 'a' <= 'f' - 'a')
+  80712c:	8d 56 9f             	lea    -0x61(%rsi),%edx
+  80712f:	83 fa 05             	cmp    $0x5,%edx
+  807132:	76 d6                	jbe    80710a <parse_hex+0x7>
+    if (c - 'A' <= 'F' - 'A')
+  807134:	8d 56 bf             	lea    -0x41(%rsi),%edx
+  807137:	83 fa 05             	cmp    $0x5,%edx
+  80713a:	77 05                	ja     807141 <parse_hex+0x3e>
+        return 10 + c - 'A';
+  80713c:	8d 56 c9             	lea    -0x37(%rsi),%edx
+  80713f:	eb cc                	jmp    80710d <parse_hex+0xa>
+    }
+}
+  807141:	c3                   	ret
+
+0000000000807142 <pci_ecam_read_byte>:
+                             ((pcid->bus & 0xFF) << 20) +
+  807142:	0f b6 57 10          	movzbl 0x10(%rdi),%edx
+  807146:	c1 e2 14             	shl    $0x14,%edx
+  807149:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  80714c:	40 0f b6 f6          	movzbl %sil,%esi
+                             ((pcid->function & 0x7) << 12) +
+  807150:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  807153:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  807157:	c1 e0 0f             	shl    $0xf,%eax
+  80715a:	25 00 80 0f 00       	and    $0xf8000,%eax
+                             ((pcid->function & 0x7) << 12) +
+  80715f:	48 01 c2             	add    %rax,%rdx
+  807162:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  807166:	c1 e0 0c             	shl    $0xc,%eax
+  807169:	25 00 70 00 00       	and    $0x7000,%eax
+  80716e:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  807171:	48 a1 b0 5c 8c 00 00 	movabs 0x8c5cb0,%rax
+  807178:	00 00 00 
+  80717b:	48 01 c2             	add    %rax,%rdx
+    return *(volatile uint8_t *)pci_ecam_addr(pcid, reg);
+  80717e:	0f b6 02             	movzbl (%rdx),%eax
+}
+  807181:	c3                   	ret
+
+0000000000807182 <pci_ecam_write_byte>:
+pci_ecam_write_byte(struct PciDevice *pcid, uint8_t reg, uint8_t value) {
+  807182:	48 89 f8             	mov    %rdi,%rax
+  807185:	89 d7                	mov    %edx,%edi
+                             ((pcid->bus & 0xFF) << 20) +
+  807187:	0f b6 50 10          	movzbl 0x10(%rax),%edx
+  80718b:	c1 e2 14             	shl    $0x14,%edx
+  80718e:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  807191:	40 0f b6 f6          	movzbl %sil,%esi
+                             ((pcid->function & 0x7) << 12) +
+  807195:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  807198:	0f b6 48 11          	movzbl 0x11(%rax),%ecx
+  80719c:	c1 e1 0f             	shl    $0xf,%ecx
+  80719f:	81 e1 00 80 0f 00    	and    $0xf8000,%ecx
+                             ((pcid->function & 0x7) << 12) +
+  8071a5:	48 01 ca             	add    %rcx,%rdx
+  8071a8:	0f b6 40 12          	movzbl 0x12(%rax),%eax
+  8071ac:	c1 e0 0c             	shl    $0xc,%eax
+  8071af:	25 00 70 00 00       	and    $0x7000,%eax
+  8071b4:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  8071b7:	48 a1 b0 5c 8c 00 00 	movabs 0x8c5cb0,%rax
+  8071be:	00 00 00 
+  8071c1:	48 01 c2             	add    %rax,%rdx
+    *(volatile uint8_t *)pci_ecam_addr(pcid, reg) = value;
+  8071c4:	40 88 3a             	mov    %dil,(%rdx)
+}
+  8071c7:	c3                   	ret
+
+00000000008071c8 <pci_ecam_write_dword>:
+pci_ecam_write_dword(struct PciDevice *pcid, uint8_t reg, uint32_t value) {
+  8071c8:	48 89 f8             	mov    %rdi,%rax
+  8071cb:	89 d7                	mov    %edx,%edi
+                             ((pcid->bus & 0xFF) << 20) +
+  8071cd:	0f b6 50 10          	movzbl 0x10(%rax),%edx
+  8071d1:	c1 e2 14             	shl    $0x14,%edx
+  8071d4:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  8071d7:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+                             ((pcid->function & 0x7) << 12) +
+  8071dd:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  8071e0:	0f b6 48 11          	movzbl 0x11(%rax),%ecx
+  8071e4:	c1 e1 0f             	shl    $0xf,%ecx
+  8071e7:	81 e1 00 80 0f 00    	and    $0xf8000,%ecx
+                             ((pcid->function & 0x7) << 12) +
+  8071ed:	48 01 ca             	add    %rcx,%rdx
+  8071f0:	0f b6 40 12          	movzbl 0x12(%rax),%eax
+  8071f4:	c1 e0 0c             	shl    $0xc,%eax
+  8071f7:	25 00 70 00 00       	and    $0x7000,%eax
+  8071fc:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  8071ff:	48 a1 b0 5c 8c 00 00 	movabs 0x8c5cb0,%rax
+  807206:	00 00 00 
+  807209:	48 01 c2             	add    %rax,%rdx
+    *(volatile uint32_t *)pci_ecam_addr(pcid, reg & 0xffc) = value;
+  80720c:	89 3a                	mov    %edi,(%rdx)
+}
+  80720e:	c3                   	ret
+
+000000000080720f <pci_ecam_write_word>:
+pci_ecam_write_word(struct PciDevice *pcid, uint8_t reg, uint16_t value) {
+  80720f:	48 89 f8             	mov    %rdi,%rax
+  807212:	89 d7                	mov    %edx,%edi
+                             ((pcid->bus & 0xFF) << 20) +
+  807214:	0f b6 50 10          	movzbl 0x10(%rax),%edx
+  807218:	c1 e2 14             	shl    $0x14,%edx
+  80721b:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  80721e:	81 e6 fe 00 00 00    	and    $0xfe,%esi
+                             ((pcid->function & 0x7) << 12) +
+  807224:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  807227:	0f b6 48 11          	movzbl 0x11(%rax),%ecx
+  80722b:	c1 e1 0f             	shl    $0xf,%ecx
+  80722e:	81 e1 00 80 0f 00    	and    $0xf8000,%ecx
+                             ((pcid->function & 0x7) << 12) +
+  807234:	48 01 ca             	add    %rcx,%rdx
+  807237:	0f b6 40 12          	movzbl 0x12(%rax),%eax
+  80723b:	c1 e0 0c             	shl    $0xc,%eax
+  80723e:	25 00 70 00 00       	and    $0x7000,%eax
+  807243:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  807246:	48 a1 b0 5c 8c 00 00 	movabs 0x8c5cb0,%rax
+  80724d:	00 00 00 
+  807250:	48 01 c2             	add    %rax,%rdx
+    *(volatile uint16_t *)pci_ecam_addr(pcid, reg & 0xffe) = value;
+  807253:	66 89 3a             	mov    %di,(%rdx)
+}
+  807256:	c3                   	ret
+
+0000000000807257 <pci_ecam_read_dword>:
+                             ((pcid->bus & 0xFF) << 20) +
+  807257:	0f b6 57 10          	movzbl 0x10(%rdi),%edx
+  80725b:	c1 e2 14             	shl    $0x14,%edx
+  80725e:	48 63 d2             	movslq %edx,%rdx
+                             (reg & 0xFFF));
+  807261:	81 e6 fc 00 00 00    	and    $0xfc,%esi
+                             ((pcid->function & 0x7) << 12) +
+  807267:	48 01 f2             	add    %rsi,%rdx
+                             ((pcid->device & 0x1F) << 15) +
+  80726a:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  80726e:	c1 e0 0f             	shl    $0xf,%eax
+  807271:	25 00 80 0f 00       	and    $0xf8000,%eax
+                             ((pcid->function & 0x7) << 12) +
+  807276:	48 01 c2             	add    %rax,%rdx
+  807279:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  80727d:	c1 e0 0c             	shl    $0xc,%eax
+  807280:	25 00 70 00 00       	and    $0x7000,%eax
+  807285:	48 01 c2             	add    %rax,%rdx
+    return (volatile void *)(ecam_base_addr +
+  807288:	48 a1 b0 5c 8c 00 00 	movabs 0x8c5cb0,%rax
+  80728f:	00 00 00 
+  807292:	48 01 c2             	add    %rax,%rdx
+    return *(volatile uint32_t *)pci_ecam_addr(pcid, reg & 0xffc);
+  807295:	8b 02                	mov    (%rdx),%eax
+}
+  807297:	c3                   	ret
+
+0000000000807298 <pci_iop_read_word>:
+pci_iop_read_word(struct PciDevice *pcid, uint8_t reg) {
+  807298:	89 f1                	mov    %esi,%ecx
+                       ((uint32_t)pcid->bus << 16) |
+  80729a:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  80729e:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  8072a1:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  8072a5:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  8072a8:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  8072aa:	89 f2                	mov    %esi,%edx
+  8072ac:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+  8072b2:	09 d0                	or     %edx,%eax
+  8072b4:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  8072b8:	c1 e2 08             	shl    $0x8,%edx
+  8072bb:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  8072bd:	0d 00 00 00 80       	or     $0x80000000,%eax
+  8072c2:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  8072c7:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  8072c8:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  8072cd:	ed                   	in     (%dx),%eax
+    return pci_iop_read_dword(pcid, reg) >> ((reg & 0x2) * 8);
+  8072ce:	83 e1 02             	and    $0x2,%ecx
+  8072d1:	c1 e1 03             	shl    $0x3,%ecx
+  8072d4:	d3 e8                	shr    %cl,%eax
+}
+  8072d6:	c3                   	ret
+
+00000000008072d7 <pci_iop_read_byte>:
+pci_iop_read_byte(struct PciDevice *pcid, uint8_t reg) {
+  8072d7:	89 f1                	mov    %esi,%ecx
+                       ((uint32_t)pcid->bus << 16) |
+  8072d9:	0f b6 47 10          	movzbl 0x10(%rdi),%eax
+  8072dd:	c1 e0 10             	shl    $0x10,%eax
+                       ((uint32_t)pcid->device << 11) |
+  8072e0:	0f b6 57 11          	movzbl 0x11(%rdi),%edx
+  8072e4:	c1 e2 0b             	shl    $0xb,%edx
+                       ((uint32_t)pcid->bus << 16) |
+  8072e7:	09 d0                	or     %edx,%eax
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  8072e9:	89 f2                	mov    %esi,%edx
+  8072eb:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+  8072f1:	09 d0                	or     %edx,%eax
+  8072f3:	0f b6 57 12          	movzbl 0x12(%rdi),%edx
+  8072f7:	c1 e2 08             	shl    $0x8,%edx
+  8072fa:	09 d0                	or     %edx,%eax
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  8072fc:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  807301:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  807306:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  807307:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  80730c:	ed                   	in     (%dx),%eax
+    return pci_iop_read_dword(pcid, reg) >> ((reg & 0x3) * 8);
+  80730d:	83 e1 03             	and    $0x3,%ecx
+  807310:	c1 e1 03             	shl    $0x3,%ecx
+  807313:	d3 e8                	shr    %cl,%eax
+}
+  807315:	c3                   	ret
+
+0000000000807316 <pci_iop_write_byte>:
+pci_iop_write_byte(struct PciDevice *pcid, uint8_t reg, uint8_t value) {
+  807316:	89 f1                	mov    %esi,%ecx
+  807318:	41 89 d0             	mov    %edx,%r8d
+                       ((uint32_t)pcid->bus << 16) |
+  80731b:	0f b6 77 10          	movzbl 0x10(%rdi),%esi
+  80731f:	c1 e6 10             	shl    $0x10,%esi
+                       ((uint32_t)pcid->device << 11) |
+  807322:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  807326:	c1 e0 0b             	shl    $0xb,%eax
+                       ((uint32_t)pcid->bus << 16) |
+  807329:	09 c6                	or     %eax,%esi
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  80732b:	89 c8                	mov    %ecx,%eax
+  80732d:	25 fc 00 00 00       	and    $0xfc,%eax
+  807332:	09 c6                	or     %eax,%esi
+  807334:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  807338:	c1 e0 08             	shl    $0x8,%eax
+  80733b:	09 c6                	or     %eax,%esi
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  80733d:	81 ce 00 00 00 80    	or     $0x80000000,%esi
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  807343:	41 b9 f8 0c 00 00    	mov    $0xcf8,%r9d
+  807349:	89 f0                	mov    %esi,%eax
+  80734b:	44 89 ca             	mov    %r9d,%edx
+  80734e:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  80734f:	bf fc 0c 00 00       	mov    $0xcfc,%edi
+  807354:	89 fa                	mov    %edi,%edx
+  807356:	ed                   	in     (%dx),%eax
+  807357:	41 89 c2             	mov    %eax,%r10d
+    uint8_t shift = ((reg & 0x3) * 8);
+  80735a:	83 e1 03             	and    $0x3,%ecx
+  80735d:	c1 e1 03             	shl    $0x3,%ecx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  807360:	89 f0                	mov    %esi,%eax
+  807362:	44 89 ca             	mov    %r9d,%edx
+  807365:	ef                   	out    %eax,(%dx)
+    uint32_t old_value = pci_iop_read_dword(pcid, reg) & ~(0xFF << shift);
+  807366:	b8 ff 00 00 00       	mov    $0xff,%eax
+  80736b:	d3 e0                	shl    %cl,%eax
+  80736d:	f7 d0                	not    %eax
+  80736f:	44 21 d0             	and    %r10d,%eax
+    uint32_t new_value = value << shift;
+  807372:	45 0f b6 c0          	movzbl %r8b,%r8d
+  807376:	41 d3 e0             	shl    %cl,%r8d
+    pci_iop_write_dword(pcid, reg, new_value | old_value);
+  807379:	44 09 c0             	or     %r8d,%eax
+  80737c:	89 fa                	mov    %edi,%edx
+  80737e:	ef                   	out    %eax,(%dx)
+}
+  80737f:	c3                   	ret
+
+0000000000807380 <pci_iop_write_word>:
+pci_iop_write_word(struct PciDevice *pcid, uint8_t reg, uint16_t value) {
+  807380:	89 f1                	mov    %esi,%ecx
+  807382:	41 89 d0             	mov    %edx,%r8d
+                       ((uint32_t)pcid->bus << 16) |
+  807385:	0f b6 77 10          	movzbl 0x10(%rdi),%esi
+  807389:	c1 e6 10             	shl    $0x10,%esi
+                       ((uint32_t)pcid->device << 11) |
+  80738c:	0f b6 47 11          	movzbl 0x11(%rdi),%eax
+  807390:	c1 e0 0b             	shl    $0xb,%eax
+                       ((uint32_t)pcid->bus << 16) |
+  807393:	09 c6                	or     %eax,%esi
+                       ((uint32_t)pcid->function << 8) | (reg & 0xFC);
+  807395:	89 c8                	mov    %ecx,%eax
+  807397:	25 fc 00 00 00       	and    $0xfc,%eax
+  80739c:	09 c6                	or     %eax,%esi
+  80739e:	0f b6 47 12          	movzbl 0x12(%rdi),%eax
+  8073a2:	c1 e0 08             	shl    $0x8,%eax
+  8073a5:	09 c6                	or     %eax,%esi
+    uint32_t address = PCI_PORT_ENABLE_BIT |
+  8073a7:	81 ce 00 00 00 80    	or     $0x80000000,%esi
+  8073ad:	41 b9 f8 0c 00 00    	mov    $0xcf8,%r9d
+  8073b3:	89 f0                	mov    %esi,%eax
+  8073b5:	44 89 ca             	mov    %r9d,%edx
+  8073b8:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  8073b9:	bf fc 0c 00 00       	mov    $0xcfc,%edi
+  8073be:	89 fa                	mov    %edi,%edx
+  8073c0:	ed                   	in     (%dx),%eax
+  8073c1:	41 89 c2             	mov    %eax,%r10d
+    uint8_t shift = ((reg & 0x2) * 8);
+  8073c4:	83 e1 02             	and    $0x2,%ecx
+  8073c7:	c1 e1 03             	shl    $0x3,%ecx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  8073ca:	89 f0                	mov    %esi,%eax
+  8073cc:	44 89 ca             	mov    %r9d,%edx
+  8073cf:	ef                   	out    %eax,(%dx)
+    uint32_t old_value = pci_iop_read_dword(pcid, reg) & ~(0xFFFF << shift);
+  8073d0:	b8 ff ff 00 00       	mov    $0xffff,%eax
+  8073d5:	d3 e0                	shl    %cl,%eax
+  8073d7:	f7 d0                	not    %eax
+  8073d9:	44 21 d0             	and    %r10d,%eax
+    uint32_t new_value = value << shift;
+  8073dc:	45 0f b7 c0          	movzwl %r8w,%r8d
+  8073e0:	41 d3 e0             	shl    %cl,%r8d
+    pci_iop_write_dword(pcid, reg, new_value | old_value);
+  8073e3:	44 09 c0             	or     %r8d,%eax
+  8073e6:	89 fa                	mov    %edi,%edx
+  8073e8:	ef                   	out    %eax,(%dx)
+}
+  8073e9:	c3                   	ret
+
+00000000008073ea <init_pci_device>:
+init_pci_device(uint8_t bus, uint8_t device, uint8_t function) {
+  8073ea:	55                   	push   %rbp
+  8073eb:	48 89 e5             	mov    %rsp,%rbp
+  8073ee:	41 57                	push   %r15
+  8073f0:	41 56                	push   %r14
+  8073f2:	41 55                	push   %r13
+  8073f4:	41 54                	push   %r12
+  8073f6:	53                   	push   %rbx
+  8073f7:	48 83 ec 78          	sub    $0x78,%rsp
+  8073fb:	41 89 ff             	mov    %edi,%r15d
+    struct PciDevice tmp_dev = {.bus = bus, .device = device, .function = function};
+  8073fe:	48 8d bd 78 ff ff ff 	lea    -0x88(%rbp),%rdi
+  807405:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80740a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80740f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  807412:	44 88 7d 88          	mov    %r15b,-0x78(%rbp)
+  807416:	89 b5 6c ff ff ff    	mov    %esi,-0x94(%rbp)
+  80741c:	40 88 75 89          	mov    %sil,-0x77(%rbp)
+  807420:	89 95 60 ff ff ff    	mov    %edx,-0xa0(%rbp)
+  807426:	88 55 8a             	mov    %dl,-0x76(%rbp)
+    uint16_t vendor_id = pcie_io.read16(&tmp_dev, PCI_REG_VENDOR_ID);
+  807429:	be 00 00 00 00       	mov    $0x0,%esi
+  80742e:	48 8d bd 78 ff ff ff 	lea    -0x88(%rbp),%rdi
+  807435:	48 a1 88 5c 8c 00 00 	movabs 0x8c5c88,%rax
+  80743c:	00 00 00 
+  80743f:	ff d0                	call   *%rax
+    if (vendor_id == PCI_DEVICE_VENDOR_NONE)
+  807441:	66 83 f8 ff          	cmp    $0xffff,%ax
+  807445:	0f 84 b6 02 00 00    	je     807701 <init_pci_device+0x317>
+    if (pcidev_cnt >= PCI_MAX_DEVICES)
+  80744b:	a1 e0 5a 8c 00 00 00 	movabs 0x8c5ae0,%eax
+  807452:	00 00 
+  807454:	83 f8 09             	cmp    $0x9,%eax
+  807457:	0f 8f bc 02 00 00    	jg     807719 <init_pci_device+0x32f>
+    return &pci_device_buffer[pcidev_cnt++];
+  80745d:	89 c1                	mov    %eax,%ecx
+  80745f:	8d 40 01             	lea    0x1(%rax),%eax
+  807462:	a3 e0 5a 8c 00 00 00 	movabs %eax,0x8c5ae0
+  807469:	00 00 
+  80746b:	89 8d 68 ff ff ff    	mov    %ecx,-0x98(%rbp)
+  807471:	4c 63 e1             	movslq %ecx,%r12
+  807474:	4b 8d 1c a4          	lea    (%r12,%r12,4),%rbx
+  807478:	48 01 db             	add    %rbx,%rbx
+  80747b:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  80747f:	49 bd c0 5c 8c 00 00 	movabs $0x8c5cc0,%r13
+  807486:	00 00 00 
+  807489:	4d 8d 74 c5 00       	lea    0x0(%r13,%rax,8),%r14
+    memset(pcid, 0, sizeof(*pcid));
+  80748e:	ba 58 00 00 00       	mov    $0x58,%edx
+  807493:	be 00 00 00 00       	mov    $0x0,%esi
+  807498:	4c 89 f7             	mov    %r14,%rdi
+  80749b:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  8074a2:	00 00 00 
+  8074a5:	ff d0                	call   *%rax
+    pcid->bus = bus;
+  8074a7:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8074ab:	45 88 7c c5 10       	mov    %r15b,0x10(%r13,%rax,8)
+    pcid->device = device;
+  8074b0:	0f b6 bd 6c ff ff ff 	movzbl -0x94(%rbp),%edi
+  8074b7:	41 88 7c c5 11       	mov    %dil,0x11(%r13,%rax,8)
+    pcid->function = function;
+  8074bc:	0f b6 bd 60 ff ff ff 	movzbl -0xa0(%rbp),%edi
+  8074c3:	41 88 7c c5 12       	mov    %dil,0x12(%r13,%rax,8)
+    pcid->vendor_id = pcie_io.read16(pcid, PCI_REG_VENDOR_ID);
+  8074c8:	49 bf 80 5c 8c 00 00 	movabs $0x8c5c80,%r15
+  8074cf:	00 00 00 
+  8074d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8074d7:	4c 89 f7             	mov    %r14,%rdi
+  8074da:	41 ff 57 08          	call   *0x8(%r15)
+  8074de:	89 c2                	mov    %eax,%edx
+  8074e0:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8074e4:	66 41 89 54 c5 14    	mov    %dx,0x14(%r13,%rax,8)
+    pcid->device_id = pcie_io.read16(pcid, PCI_REG_DEVICE_ID);
+  8074ea:	be 02 00 00 00       	mov    $0x2,%esi
+  8074ef:	4c 89 f7             	mov    %r14,%rdi
+  8074f2:	41 ff 57 08          	call   *0x8(%r15)
+  8074f6:	89 c2                	mov    %eax,%edx
+  8074f8:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8074fc:	66 41 89 54 c5 16    	mov    %dx,0x16(%r13,%rax,8)
+    pcid->subvendor_id = pcie_io.read16(pcid, PCI_REG_SUB_VENDOR_ID);
+  807502:	be 2c 00 00 00       	mov    $0x2c,%esi
+  807507:	4c 89 f7             	mov    %r14,%rdi
+  80750a:	41 ff 57 08          	call   *0x8(%r15)
+  80750e:	89 c2                	mov    %eax,%edx
+  807510:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  807514:	66 41 89 54 c5 18    	mov    %dx,0x18(%r13,%rax,8)
+    pcid->subdevice_id = pcie_io.read16(pcid, PCI_REG_SUB_DEVICE_ID);
+  80751a:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80751f:	4c 89 f7             	mov    %r14,%rdi
+  807522:	41 ff 57 08          	call   *0x8(%r15)
+  807526:	89 c2                	mov    %eax,%edx
+  807528:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  80752c:	66 41 89 54 c5 1a    	mov    %dx,0x1a(%r13,%rax,8)
+    pcid->revision_id = pcie_io.read8(pcid, PCI_REG_REVISION_ID);
+  807532:	be 08 00 00 00       	mov    $0x8,%esi
+  807537:	4c 89 f7             	mov    %r14,%rdi
+  80753a:	41 ff 57 10          	call   *0x10(%r15)
+  80753e:	89 c2                	mov    %eax,%edx
+  807540:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  807544:	41 88 54 c5 1c       	mov    %dl,0x1c(%r13,%rax,8)
+    pcid->class = pcie_io.read8(pcid, PCI_REG_CLASS);
+  807549:	be 0b 00 00 00       	mov    $0xb,%esi
+  80754e:	4c 89 f7             	mov    %r14,%rdi
+  807551:	41 ff 57 10          	call   *0x10(%r15)
+  807555:	89 c2                	mov    %eax,%edx
+  807557:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  80755b:	41 88 54 c5 1d       	mov    %dl,0x1d(%r13,%rax,8)
+    pcid->subclass = pcie_io.read8(pcid, PCI_REG_SUBCLASS);
+  807560:	be 0a 00 00 00       	mov    $0xa,%esi
+  807565:	4c 89 f7             	mov    %r14,%rdi
+  807568:	41 ff 57 10          	call   *0x10(%r15)
+  80756c:	89 c2                	mov    %eax,%edx
+  80756e:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  807572:	41 88 54 c5 1e       	mov    %dl,0x1e(%r13,%rax,8)
+    pcid->interface = pcie_io.read8(pcid, PCI_REG_PROG_IF);
+  807577:	be 09 00 00 00       	mov    $0x9,%esi
+  80757c:	4c 89 f7             	mov    %r14,%rdi
+  80757f:	41 ff 57 10          	call   *0x10(%r15)
+  807583:	89 c2                	mov    %eax,%edx
+  807585:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  807589:	41 88 54 c5 1f       	mov    %dl,0x1f(%r13,%rax,8)
+    pcid->header_type = pcie_io.read8(pcid, PCI_REG_HEADER_TYPE);
+  80758e:	be 0e 00 00 00       	mov    $0xe,%esi
+  807593:	4c 89 f7             	mov    %r14,%rdi
+  807596:	41 ff 57 10          	call   *0x10(%r15)
+  80759a:	89 c2                	mov    %eax,%edx
+  80759c:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8075a0:	41 88 54 c5 20       	mov    %dl,0x20(%r13,%rax,8)
+    pcid->interrupt_pin = pcie_io.read8(pcid, PCI_REG_INTERRUPT_PIN);
+  8075a5:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8075aa:	4c 89 f7             	mov    %r14,%rdi
+  8075ad:	41 ff 57 10          	call   *0x10(%r15)
+  8075b1:	89 c2                	mov    %eax,%edx
+  8075b3:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8075b7:	41 88 54 c5 54       	mov    %dl,0x54(%r13,%rax,8)
+    pcid->interrupt_line = pcie_io.read8(pcid, PCI_REG_INTERRUPT_LINE);
+  8075bc:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8075c1:	4c 89 f7             	mov    %r14,%rdi
+  8075c4:	41 ff 57 10          	call   *0x10(%r15)
+  8075c8:	89 c2                	mov    %eax,%edx
+  8075ca:	4a 8d 04 23          	lea    (%rbx,%r12,1),%rax
+  8075ce:	41 88 54 c5 55       	mov    %dl,0x55(%r13,%rax,8)
+    pcid->interrupt_no = 0;
+  8075d3:	41 c6 44 c5 56 00    	movb   $0x0,0x56(%r13,%rax,8)
+    for (uint8_t i = 0; i < PCI_BAR_COUNT; i++) {
+  8075d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        pcid->bars[i].port_mapped = (bar & PCI_BAR_TYPE_PORT) != 0;
+  8075de:	4d 89 ec             	mov    %r13,%r12
+  8075e1:	48 63 85 68 ff ff ff 	movslq -0x98(%rbp),%rax
+  8075e8:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8075ec:	4c 8d 3c 50          	lea    (%rax,%rdx,2),%r15
+  8075f0:	e9 ae 00 00 00       	jmp    8076a3 <init_pci_device+0x2b9>
+            pcid->bars[i].base_address = bar & PCI_BAR_MEMORY_MASK;
+  8075f5:	49 63 d5             	movslq %r13d,%rdx
+  8075f8:	49 8d 74 17 04       	lea    0x4(%r15,%rdx,1),%rsi
+  8075fd:	89 c2                	mov    %eax,%edx
+  8075ff:	83 e2 f0             	and    $0xfffffff0,%edx
+  807602:	41 89 54 f4 08       	mov    %edx,0x8(%r12,%rsi,8)
+            pcid->bars[i].address_is_64bits = (bar & PCI_BAR_BITS64) != 0;
+  807607:	89 c1                	mov    %eax,%ecx
+  807609:	c1 e9 02             	shr    $0x2,%ecx
+  80760c:	83 e1 01             	and    $0x1,%ecx
+  80760f:	01 c9                	add    %ecx,%ecx
+  807611:	41 0f b6 54 f4 04    	movzbl 0x4(%r12,%rsi,8),%edx
+  807617:	83 e2 f9             	and    $0xfffffff9,%edx
+            pcid->bars[i].prefetchable = (bar & PCI_BAR_PREFETCHABLE) != 0;
+  80761a:	c1 e8 03             	shr    $0x3,%eax
+  80761d:	83 e0 01             	and    $0x1,%eax
+  807620:	c1 e0 02             	shl    $0x2,%eax
+  807623:	09 ca                	or     %ecx,%edx
+  807625:	09 d0                	or     %edx,%eax
+  807627:	41 88 44 f4 04       	mov    %al,0x4(%r12,%rsi,8)
+            if (pcid->bars[i].address_is_64bits) {
+  80762c:	a8 02                	test   $0x2,%al
+  80762e:	74 6b                	je     80769b <init_pci_device+0x2b1>
+                pcid->bars[i + 1].address_is_64bits = 1;
+  807630:	41 8d 45 01          	lea    0x1(%r13),%eax
+  807634:	48 98                	cltq
+  807636:	49 8d 7c 07 04       	lea    0x4(%r15,%rax,1),%rdi
+  80763b:	48 89 bd 60 ff ff ff 	mov    %rdi,-0xa0(%rbp)
+  807642:	41 80 4c fc 04 02    	orb    $0x2,0x4(%r12,%rdi,8)
+                pcid->bars[i + 1].base_address = pcie_io.read32(pcid, PCI_REG_BAR0 + ((i + 1) * sizeof(uint32_t)));
+  807648:	0f b6 b5 6c ff ff ff 	movzbl -0x94(%rbp),%esi
+  80764f:	83 c6 04             	add    $0x4,%esi
+  807652:	40 0f b6 f6          	movzbl %sil,%esi
+  807656:	4c 89 f7             	mov    %r14,%rdi
+  807659:	48 b8 80 5c 8c 00 00 	movabs $0x8c5c80,%rax
+  807660:	00 00 00 
+  807663:	ff 10                	call   *(%rax)
+  807665:	48 8b bd 60 ff ff ff 	mov    -0xa0(%rbp),%rdi
+  80766c:	41 89 44 fc 08       	mov    %eax,0x8(%r12,%rdi,8)
+                pcid->bars[i + 1].prefetchable = pcid->bars[i].prefetchable;
+  807671:	4d 63 ed             	movslq %r13d,%r13
+  807674:	4b 8d 44 2f 04       	lea    0x4(%r15,%r13,1),%rax
+  807679:	41 0f b6 54 c4 04    	movzbl 0x4(%r12,%rax,8),%edx
+  80767f:	83 e2 04             	and    $0x4,%edx
+  807682:	41 0f b6 44 fc 04    	movzbl 0x4(%r12,%rdi,8),%eax
+  807688:	88 85 6c ff ff ff    	mov    %al,-0x94(%rbp)
+  80768e:	83 e0 fb             	and    $0xfffffffb,%eax
+  807691:	09 d0                	or     %edx,%eax
+  807693:	41 88 44 fc 04       	mov    %al,0x4(%r12,%rdi,8)
+                i++;
+  807698:	83 c3 01             	add    $0x1,%ebx
+    for (uint8_t i = 0; i < PCI_BAR_COUNT; i++) {
+  80769b:	83 c3 01             	add    $0x1,%ebx
+  80769e:	80 fb 05             	cmp    $0x5,%bl
+  8076a1:	77 64                	ja     807707 <init_pci_device+0x31d>
+        uint32_t bar = pcie_io.read32(pcid, PCI_REG_BAR0 + (i * sizeof(uint32_t)));
+  8076a3:	8d 04 9d 10 00 00 00 	lea    0x10(,%rbx,4),%eax
+  8076aa:	88 85 6c ff ff ff    	mov    %al,-0x94(%rbp)
+  8076b0:	0f b6 f0             	movzbl %al,%esi
+  8076b3:	4c 89 f7             	mov    %r14,%rdi
+  8076b6:	48 b8 80 5c 8c 00 00 	movabs $0x8c5c80,%rax
+  8076bd:	00 00 00 
+  8076c0:	ff 10                	call   *(%rax)
+        pcid->bars[i].port_mapped = (bar & PCI_BAR_TYPE_PORT) != 0;
+  8076c2:	44 0f b6 eb          	movzbl %bl,%r13d
+  8076c6:	0f b6 d3             	movzbl %bl,%edx
+  8076c9:	4a 8d 4c 3a 04       	lea    0x4(%rdx,%r15,1),%rcx
+  8076ce:	89 c6                	mov    %eax,%esi
+  8076d0:	83 e6 01             	and    $0x1,%esi
+  8076d3:	40 0f 95 c7          	setne  %dil
+  8076d7:	41 0f b6 54 cc 04    	movzbl 0x4(%r12,%rcx,8),%edx
+  8076dd:	83 e2 fe             	and    $0xfffffffe,%edx
+  8076e0:	09 fa                	or     %edi,%edx
+  8076e2:	41 88 54 cc 04       	mov    %dl,0x4(%r12,%rcx,8)
+        if (pcid->bars[i].port_mapped) {
+  8076e7:	85 f6                	test   %esi,%esi
+  8076e9:	0f 84 06 ff ff ff    	je     8075f5 <init_pci_device+0x20b>
+            pcid->bars[i].base_address = bar & PCI_BAR_PORT_MASK;
+  8076ef:	4d 63 ed             	movslq %r13d,%r13
+  8076f2:	4b 8d 54 2f 04       	lea    0x4(%r15,%r13,1),%rdx
+  8076f7:	83 e0 fc             	and    $0xfffffffc,%eax
+  8076fa:	41 89 44 d4 08       	mov    %eax,0x8(%r12,%rdx,8)
+  8076ff:	eb 9a                	jmp    80769b <init_pci_device+0x2b1>
+        return NULL;
+  807701:	41 be 00 00 00 00    	mov    $0x0,%r14d
+}
+  807707:	4c 89 f0             	mov    %r14,%rax
+  80770a:	48 83 c4 78          	add    $0x78,%rsp
+  80770e:	5b                   	pop    %rbx
+  80770f:	41 5c                	pop    %r12
+  807711:	41 5d                	pop    %r13
+  807713:	41 5e                	pop    %r14
+  807715:	41 5f                	pop    %r15
+  807717:	5d                   	pop    %rbp
+  807718:	c3                   	ret
+        return NULL;
+  807719:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80771f:	eb e6                	jmp    807707 <init_pci_device+0x31d>
+
+0000000000807721 <pci_check_busses>:
+pci_check_busses(uint8_t bus, struct PciDevice *parent) {
+  807721:	55                   	push   %rbp
+  807722:	48 89 e5             	mov    %rsp,%rbp
+  807725:	41 57                	push   %r15
+  807727:	41 56                	push   %r14
+  807729:	41 55                	push   %r13
+  80772b:	41 54                	push   %r12
+  80772d:	53                   	push   %rbx
+  80772e:	48 83 ec 18          	sub    $0x18,%rsp
+  807732:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  807736:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        struct PciDevice *pcid = init_pci_device(bus, device, 0);
+  80773c:	40 0f b6 c7          	movzbl %dil,%eax
+  807740:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  807743:	49 bf ea 73 80 00 00 	movabs $0x8073ea,%r15
+  80774a:	00 00 00 
+    pcid->next = pci_device_list;
+  80774d:	49 be 30 60 8c 00 00 	movabs $0x8c6030,%r14
+  807754:	00 00 00 
+  807757:	eb 40                	jmp    807799 <pci_check_busses+0x78>
+  807759:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  80775f:	eb 1b                	jmp    80777c <pci_check_busses+0x5b>
+    pcid->parent = parent;
+  807761:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  807765:	48 89 08             	mov    %rcx,(%rax)
+    pcid->next = pci_device_list;
+  807768:	49 8b 16             	mov    (%r14),%rdx
+  80776b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pci_device_list = pcid;
+  80776f:	49 89 06             	mov    %rax,(%r14)
+            for (uint8_t func = 1; func < PCI_NUM_FUNCTIONS; func++) {
+  807772:	41 83 c5 01          	add    $0x1,%r13d
+  807776:	41 83 fd 08          	cmp    $0x8,%r13d
+  80777a:	74 4e                	je     8077ca <pci_check_busses+0xa9>
+                struct PciDevice *func_dev = init_pci_device(bus, device, func);
+  80777c:	44 89 ea             	mov    %r13d,%edx
+  80777f:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  807782:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  807785:	41 ff d7             	call   *%r15
+                if (!func_dev)
+  807788:	48 85 c0             	test   %rax,%rax
+  80778b:	75 d4                	jne    807761 <pci_check_busses+0x40>
+  80778d:	eb e3                	jmp    807772 <pci_check_busses+0x51>
+    for (uint8_t device = 0; device < PCI_NUM_DEVICES; device++) {
+  80778f:	41 83 c4 01          	add    $0x1,%r12d
+  807793:	41 83 fc 20          	cmp    $0x20,%r12d
+  807797:	74 6b                	je     807804 <pci_check_busses+0xe3>
+        struct PciDevice *pcid = init_pci_device(bus, device, 0);
+  807799:	44 89 65 c8          	mov    %r12d,-0x38(%rbp)
+  80779d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8077a2:	44 89 e6             	mov    %r12d,%esi
+  8077a5:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8077a8:	41 ff d7             	call   *%r15
+  8077ab:	48 89 c3             	mov    %rax,%rbx
+        if (!pcid)
+  8077ae:	48 85 c0             	test   %rax,%rax
+  8077b1:	74 dc                	je     80778f <pci_check_busses+0x6e>
+    pcid->parent = parent;
+  8077b3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8077b7:	48 89 03             	mov    %rax,(%rbx)
+    pcid->next = pci_device_list;
+  8077ba:	49 8b 06             	mov    (%r14),%rax
+  8077bd:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    pci_device_list = pcid;
+  8077c1:	49 89 1e             	mov    %rbx,(%r14)
+        if (pcid->header_type & PCI_HEADER_TYPE_MULTIFUNC) {
+  8077c4:	80 7b 20 00          	cmpb   $0x0,0x20(%rbx)
+  8077c8:	78 8f                	js     807759 <pci_check_busses+0x38>
+        if (pcid->class == PCI_CLASS_BRIDGE && pcid->subclass == PCI_SUBCLASS_BRIDGE_PCI) {
+  8077ca:	8b 43 1c             	mov    0x1c(%rbx),%eax
+  8077cd:	25 00 ff ff 00       	and    $0xffff00,%eax
+  8077d2:	3d 00 06 04 00       	cmp    $0x40600,%eax
+  8077d7:	75 b6                	jne    80778f <pci_check_busses+0x6e>
+            uint16_t baread2 = pcie_io.read16(pcid, PCI_REG_BAR2);
+  8077d9:	be 18 00 00 00       	mov    $0x18,%esi
+  8077de:	48 89 df             	mov    %rbx,%rdi
+  8077e1:	48 a1 88 5c 8c 00 00 	movabs 0x8c5c88,%rax
+  8077e8:	00 00 00 
+  8077eb:	ff d0                	call   *%rax
+            uint16_t secondary_bus = (baread2 & ~0x00FF) >> 8;
+  8077ed:	0f b7 f8             	movzwl %ax,%edi
+  8077f0:	c1 ff 08             	sar    $0x8,%edi
+            pci_check_busses(secondary_bus, pcid);
+  8077f3:	48 89 de             	mov    %rbx,%rsi
+  8077f6:	48 b8 21 77 80 00 00 	movabs $0x807721,%rax
+  8077fd:	00 00 00 
+  807800:	ff d0                	call   *%rax
+  807802:	eb 8b                	jmp    80778f <pci_check_busses+0x6e>
+}
+  807804:	48 83 c4 18          	add    $0x18,%rsp
+  807808:	5b                   	pop    %rbx
+  807809:	41 5c                	pop    %r12
+  80780b:	41 5d                	pop    %r13
+  80780d:	41 5e                	pop    %r14
+  80780f:	41 5f                	pop    %r15
+  807811:	5d                   	pop    %rbp
+  807812:	c3                   	ret
+
+0000000000807813 <find_pci_dev>:
+    for (int i = 0; i != PCI_MAX_DEVICES; i++) {
+  807813:	48 b8 dd 5c 8c 00 00 	movabs $0x8c5cdd,%rax
+  80781a:	00 00 00 
+  80781d:	ba 00 00 00 00       	mov    $0x0,%edx
+  807822:	eb 0c                	jmp    807830 <find_pci_dev+0x1d>
+  807824:	83 c2 01             	add    $0x1,%edx
+  807827:	48 83 c0 58          	add    $0x58,%rax
+  80782b:	83 fa 0a             	cmp    $0xa,%edx
+  80782e:	74 29                	je     807859 <find_pci_dev+0x46>
+        if (pci_device_buffer[i].class == class &&
+  807830:	0f b6 08             	movzbl (%rax),%ecx
+  807833:	39 f9                	cmp    %edi,%ecx
+  807835:	75 ed                	jne    807824 <find_pci_dev+0x11>
+            pci_device_buffer[i].subclass == sub) {
+  807837:	0f b6 48 01          	movzbl 0x1(%rax),%ecx
+        if (pci_device_buffer[i].class == class &&
+  80783b:	39 f1                	cmp    %esi,%ecx
+  80783d:	75 e5                	jne    807824 <find_pci_dev+0x11>
+            return &pci_device_buffer[i];
+  80783f:	48 63 d2             	movslq %edx,%rdx
+  807842:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+  807846:	48 8d 14 42          	lea    (%rdx,%rax,2),%rdx
+  80784a:	48 b8 c0 5c 8c 00 00 	movabs $0x8c5cc0,%rax
+  807851:	00 00 00 
+  807854:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+  807858:	c3                   	ret
+    return 0;
+  807859:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80785e:	c3                   	ret
+
+000000000080785f <get_bar_size>:
+get_bar_size(struct PciDevice *pcid, uint32_t barno) {
+  80785f:	55                   	push   %rbp
+  807860:	48 89 e5             	mov    %rsp,%rbp
+  807863:	41 57                	push   %r15
+  807865:	41 56                	push   %r14
+  807867:	41 55                	push   %r13
+  807869:	41 54                	push   %r12
+  80786b:	53                   	push   %rbx
+  80786c:	48 83 ec 08          	sub    $0x8,%rsp
+    if (pcid == NULL || barno >= PCI_BAR_COUNT)
+  807870:	48 85 ff             	test   %rdi,%rdi
+  807873:	74 5e                	je     8078d3 <get_bar_size+0x74>
+  807875:	49 89 fc             	mov    %rdi,%r12
+  807878:	83 fe 05             	cmp    $0x5,%esi
+  80787b:	77 56                	ja     8078d3 <get_bar_size+0x74>
+    uint32_t tmp = pcid->bars[barno].base_address;
+  80787d:	89 f0                	mov    %esi,%eax
+  80787f:	44 8b 6c c7 28       	mov    0x28(%rdi,%rax,8),%r13d
+    pcie_io.write32(pcid, PCI_REG_BAR0 + 4 * barno, 0xFFFFFFFF);
+  807884:	8d 34 b5 10 00 00 00 	lea    0x10(,%rsi,4),%esi
+  80788b:	40 0f b6 de          	movzbl %sil,%ebx
+  80788f:	49 bf 80 5c 8c 00 00 	movabs $0x8c5c80,%r15
+  807896:	00 00 00 
+  807899:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80789e:	89 de                	mov    %ebx,%esi
+  8078a0:	41 ff 57 18          	call   *0x18(%r15)
+    uint32_t outv = pcie_io.read32(pcid, PCI_REG_BAR0 + 4 * barno) & PCI_BAR_MEMORY_MASK;
+  8078a4:	89 de                	mov    %ebx,%esi
+  8078a6:	4c 89 e7             	mov    %r12,%rdi
+  8078a9:	41 ff 17             	call   *(%r15)
+  8078ac:	83 e0 f0             	and    $0xfffffff0,%eax
+  8078af:	41 89 c6             	mov    %eax,%r14d
+    uint32_t size = ~outv + 1;
+  8078b2:	41 f7 de             	neg    %r14d
+    pcie_io.write32(pcid, PCI_REG_BAR0 + 4 * barno, tmp);
+  8078b5:	44 89 ea             	mov    %r13d,%edx
+  8078b8:	89 de                	mov    %ebx,%esi
+  8078ba:	4c 89 e7             	mov    %r12,%rdi
+  8078bd:	41 ff 57 18          	call   *0x18(%r15)
+}
+  8078c1:	44 89 f0             	mov    %r14d,%eax
+  8078c4:	48 83 c4 08          	add    $0x8,%rsp
+  8078c8:	5b                   	pop    %rbx
+  8078c9:	41 5c                	pop    %r12
+  8078cb:	41 5d                	pop    %r13
+  8078cd:	41 5e                	pop    %r14
+  8078cf:	41 5f                	pop    %r15
+  8078d1:	5d                   	pop    %rbp
+  8078d2:	c3                   	ret
+        return 0;
+  8078d3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8078d9:	eb e6                	jmp    8078c1 <get_bar_size+0x62>
+
+00000000008078db <get_bar_address>:
+get_bar_address(struct PciDevice *pcid, uint32_t barno) {
+  8078db:	55                   	push   %rbp
+  8078dc:	48 89 e5             	mov    %rsp,%rbp
+  8078df:	53                   	push   %rbx
+  8078e0:	48 83 ec 08          	sub    $0x8,%rsp
+    if (pcid == NULL || barno >= PCI_BAR_COUNT)
+  8078e4:	48 85 ff             	test   %rdi,%rdi
+  8078e7:	74 28                	je     807911 <get_bar_address+0x36>
+  8078e9:	83 fe 05             	cmp    $0x5,%esi
+  8078ec:	77 23                	ja     807911 <get_bar_address+0x36>
+    uintptr_t base_addr = pcid->bars[0].base_address;
+  8078ee:	8b 5f 28             	mov    0x28(%rdi),%ebx
+    if (pcid->bars[0].address_is_64bits)
+  8078f1:	f6 47 24 02          	testb  $0x2,0x24(%rdi)
+  8078f5:	74 1f                	je     807916 <get_bar_address+0x3b>
+        base_addr |= (uint64_t)(pcie_io.read32(pcid, PCI_REG_BAR0 + 4)) << 32;
+  8078f7:	be 14 00 00 00       	mov    $0x14,%esi
+  8078fc:	48 a1 80 5c 8c 00 00 	movabs 0x8c5c80,%rax
+  807903:	00 00 00 
+  807906:	ff d0                	call   *%rax
+  807908:	48 c1 e0 20          	shl    $0x20,%rax
+  80790c:	48 09 c3             	or     %rax,%rbx
+  80790f:	eb 05                	jmp    807916 <get_bar_address+0x3b>
+        return 0;
+  807911:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  807916:	48 89 d8             	mov    %rbx,%rax
+  807919:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80791d:	c9                   	leave
+  80791e:	c3                   	ret
+
+000000000080791f <parse_argv>:
+invalid:
+    panic("Invalid ecam= format");
+}
+
+void
+parse_argv(char **argv) {
+  80791f:	55                   	push   %rbp
+  807920:	48 89 e5             	mov    %rsp,%rbp
+  807923:	41 57                	push   %r15
+  807925:	41 56                	push   %r14
+  807927:	41 55                	push   %r13
+  807929:	41 54                	push   %r12
+  80792b:	53                   	push   %rbx
+  80792c:	48 83 ec 38          	sub    $0x38,%rsp
+    ecam_base_addr = (volatile uint8_t *)ECAM_VADDR;
+  807930:	48 b8 00 00 00 00 70 	movabs $0x7000000000,%rax
+  807937:	00 00 00 
+  80793a:	48 a3 b0 5c 8c 00 00 	movabs %rax,0x8c5cb0
+  807941:	00 00 00 
+     *   ecam=<base address>:<segment group>:<start bus>:<end bus>
+     * with all values being hex numbers. So we need to parse them
+     * and map physical memory regions accordingly.
+     */
+
+    if (argv)
+  807944:	48 85 ff             	test   %rdi,%rdi
+  807947:	0f 84 78 02 00 00    	je     807bc5 <parse_argv+0x2a6>
+        for (argv++; *argv; argv++) {
+  80794d:	48 8d 5f 08          	lea    0x8(%rdi),%rbx
+  807951:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  807955:	48 85 ff             	test   %rdi,%rdi
+  807958:	0f 84 67 02 00 00    	je     807bc5 <parse_argv+0x2a6>
+    char *vaddr = (char *)ecam_base_addr;
+  80795e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+            if (!strncmp(*argv, "ecam=", 5)) {
+  807962:	49 bf 74 9b 80 00 00 	movabs $0x809b74,%r15
+  807969:	00 00 00 
+  80796c:	e9 84 00 00 00       	jmp    8079f5 <parse_argv+0xd6>
+    panic("Invalid ecam= format");
+  807971:	48 ba 42 e9 80 00 00 	movabs $0x80e942,%rdx
+  807978:	00 00 00 
+  80797b:	be aa 01 00 00       	mov    $0x1aa,%esi
+  807980:	48 bf 57 e9 80 00 00 	movabs $0x80e957,%rdi
+  807987:	00 00 00 
+  80798a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80798f:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  807996:	00 00 00 
+  807999:	ff d1                	call   *%rcx
+
+                int my_envid = sys_getenvid();
+                uintptr_t size = PCI_ECAM_MEMSIZE * (ecam->end_bus - ecam->start_bus) * PCI_NUM_DEVICES * PCI_NUM_FUNCTIONS;
+                int r = sys_map_physical_region(ecam->paddr, my_envid , ecam->vaddr, size, PROT_RW | PROT_CD);
+                if (r < 0)
+                    panic("sys_map_physical_region(): %i", r);
+  80799b:	89 c1                	mov    %eax,%ecx
+  80799d:	48 ba 60 e9 80 00 00 	movabs $0x80e960,%rdx
+  8079a4:	00 00 00 
+  8079a7:	be c8 01 00 00       	mov    $0x1c8,%esi
+  8079ac:	48 bf 57 e9 80 00 00 	movabs $0x80e957,%rdi
+  8079b3:	00 00 00 
+  8079b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8079bb:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8079c2:	00 00 00 
+  8079c5:	41 ff d0             	call   *%r8
+
+                vaddr += size;
+            } else if (!strncmp(*argv, "tscfreq=", 8)) {
+  8079c8:	48 8b 3b             	mov    (%rbx),%rdi
+  8079cb:	ba 08 00 00 00       	mov    $0x8,%edx
+  8079d0:	48 be 7e e9 80 00 00 	movabs $0x80e97e,%rsi
+  8079d7:	00 00 00 
+  8079da:	41 ff d7             	call   *%r15
+  8079dd:	85 c0                	test   %eax,%eax
+  8079df:	0f 84 a1 01 00 00    	je     807b86 <parse_argv+0x267>
+        for (argv++; *argv; argv++) {
+  8079e5:	48 83 c3 08          	add    $0x8,%rbx
+  8079e9:	48 8b 3b             	mov    (%rbx),%rdi
+  8079ec:	48 85 ff             	test   %rdi,%rdi
+  8079ef:	0f 84 d0 01 00 00    	je     807bc5 <parse_argv+0x2a6>
+            if (!strncmp(*argv, "ecam=", 5)) {
+  8079f5:	ba 05 00 00 00       	mov    $0x5,%edx
+  8079fa:	48 be 3c e9 80 00 00 	movabs $0x80e93c,%rsi
+  807a01:	00 00 00 
+  807a04:	41 ff d7             	call   *%r15
+  807a07:	85 c0                	test   %eax,%eax
+  807a09:	75 bd                	jne    8079c8 <parse_argv+0xa9>
+                segments[segment_count++] = parse_ecam(*argv);
+  807a0b:	4c 8b 2b             	mov    (%rbx),%r13
+  807a0e:	48 b8 e8 5a 8c 00 00 	movabs $0x8c5ae8,%rax
+  807a15:	00 00 00 
+  807a18:	4c 8b 20             	mov    (%rax),%r12
+  807a1b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  807a20:	48 89 10             	mov    %rdx,(%rax)
+    str += strlen("ecam=");
+  807a23:	48 bf 3c e9 80 00 00 	movabs $0x80e93c,%rdi
+  807a2a:	00 00 00 
+  807a2d:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  807a34:	00 00 00 
+  807a37:	ff d0                	call   *%rax
+  807a39:	49 01 c5             	add    %rax,%r13
+  807a3c:	4c 89 6d c8          	mov    %r13,-0x38(%rbp)
+    seg.paddr = parse_hex(&str);
+  807a40:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  807a44:	48 b8 03 71 80 00 00 	movabs $0x807103,%rax
+  807a4b:	00 00 00 
+  807a4e:	ff d0                	call   *%rax
+  807a50:	49 89 c6             	mov    %rax,%r14
+    if (*str++ != ':')
+  807a53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807a57:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  807a5b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  807a5f:	80 38 3a             	cmpb   $0x3a,(%rax)
+  807a62:	0f 85 09 ff ff ff    	jne    807971 <parse_argv+0x52>
+    seg.segment = parse_hex(&str);
+  807a68:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  807a6c:	48 b8 03 71 80 00 00 	movabs $0x807103,%rax
+  807a73:	00 00 00 
+  807a76:	ff d0                	call   *%rax
+  807a78:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    if (*str++ != ':')
+  807a7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807a80:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  807a84:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  807a88:	80 38 3a             	cmpb   $0x3a,(%rax)
+  807a8b:	0f 85 e0 fe ff ff    	jne    807971 <parse_argv+0x52>
+    seg.start_bus = parse_hex(&str);
+  807a91:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  807a95:	48 b8 03 71 80 00 00 	movabs $0x807103,%rax
+  807a9c:	00 00 00 
+  807a9f:	ff d0                	call   *%rax
+  807aa1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (*str++ != ':')
+  807aa5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807aa9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  807aad:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  807ab1:	80 38 3a             	cmpb   $0x3a,(%rax)
+  807ab4:	0f 85 b7 fe ff ff    	jne    807971 <parse_argv+0x52>
+    seg.end_bus = parse_hex(&str);
+  807aba:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  807abe:	48 b8 03 71 80 00 00 	movabs $0x807103,%rax
+  807ac5:	00 00 00 
+  807ac8:	ff d0                	call   *%rax
+  807aca:	48 89 c1             	mov    %rax,%rcx
+                segments[segment_count++] = parse_ecam(*argv);
+  807acd:	49 bd 00 5b 8c 00 00 	movabs $0x8c5b00,%r13
+  807ad4:	00 00 00 
+  807ad7:	4b 8d 04 24          	lea    (%r12,%r12,1),%rax
+  807adb:	4a 8d 14 20          	lea    (%rax,%r12,1),%rdx
+  807adf:	49 8d 54 d5 00       	lea    0x0(%r13,%rdx,8),%rdx
+  807ae4:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+  807aeb:	4c 89 72 08          	mov    %r14,0x8(%rdx)
+  807aef:	0f b7 75 b0          	movzwl -0x50(%rbp),%esi
+  807af3:	66 89 72 10          	mov    %si,0x10(%rdx)
+  807af7:	0f b6 75 a8          	movzbl -0x58(%rbp),%esi
+  807afb:	40 88 72 12          	mov    %sil,0x12(%rdx)
+  807aff:	4c 01 e0             	add    %r12,%rax
+    seg.end_bus = parse_hex(&str);
+  807b02:	41 88 4c c5 13       	mov    %cl,0x13(%r13,%rax,8)
+                struct ECAMSegment *ecam = &segments[segment_count - 1];
+  807b07:	48 a1 e8 5a 8c 00 00 	movabs 0x8c5ae8,%rax
+  807b0e:	00 00 00 
+  807b11:	4c 8d 60 ff          	lea    -0x1(%rax),%r12
+                ecam->vaddr = vaddr;
+  807b15:	4b 8d 04 24          	lea    (%r12,%r12,1),%rax
+  807b19:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  807b1d:	4c 01 e0             	add    %r12,%rax
+  807b20:	4d 8d 74 c5 00       	lea    0x0(%r13,%rax,8),%r14
+  807b25:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  807b29:	49 89 0e             	mov    %rcx,(%r14)
+                int my_envid = sys_getenvid();
+  807b2c:	48 b8 4d a1 80 00 00 	movabs $0x80a14d,%rax
+  807b33:	00 00 00 
+  807b36:	ff d0                	call   *%rax
+  807b38:	89 c6                	mov    %eax,%esi
+                uintptr_t size = PCI_ECAM_MEMSIZE * (ecam->end_bus - ecam->start_bus) * PCI_NUM_DEVICES * PCI_NUM_FUNCTIONS;
+  807b3a:	41 0f b6 46 13       	movzbl 0x13(%r14),%eax
+  807b3f:	41 0f b6 56 12       	movzbl 0x12(%r14),%edx
+  807b44:	29 d0                	sub    %edx,%eax
+  807b46:	c1 e0 14             	shl    $0x14,%eax
+  807b49:	48 63 c8             	movslq %eax,%rcx
+  807b4c:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+                int r = sys_map_physical_region(ecam->paddr, my_envid , ecam->vaddr, size, PROT_RW | PROT_CD);
+  807b50:	49 8b 16             	mov    (%r14),%rdx
+  807b53:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  807b57:	4c 01 e0             	add    %r12,%rax
+  807b5a:	49 8b 7c c5 08       	mov    0x8(%r13,%rax,8),%rdi
+  807b5f:	41 b8 1e 00 00 00    	mov    $0x1e,%r8d
+  807b65:	48 b8 d9 a2 80 00 00 	movabs $0x80a2d9,%rax
+  807b6c:	00 00 00 
+  807b6f:	ff d0                	call   *%rax
+                if (r < 0)
+  807b71:	85 c0                	test   %eax,%eax
+  807b73:	0f 88 22 fe ff ff    	js     80799b <parse_argv+0x7c>
+                vaddr += size;
+  807b79:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  807b7d:	48 01 4d b8          	add    %rcx,-0x48(%rbp)
+  807b81:	e9 5f fe ff ff       	jmp    8079e5 <parse_argv+0xc6>
+                char *str = *argv;
+  807b86:	4c 8b 23             	mov    (%rbx),%r12
+                str += strlen("tscfreq=");
+  807b89:	48 bf 7e e9 80 00 00 	movabs $0x80e97e,%rdi
+  807b90:	00 00 00 
+  807b93:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  807b9a:	00 00 00 
+  807b9d:	ff d0                	call   *%rax
+  807b9f:	49 01 c4             	add    %rax,%r12
+  807ba2:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+                tsc_freq = parse_hex(&str);
+  807ba6:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  807baa:	48 b8 03 71 80 00 00 	movabs $0x807103,%rax
+  807bb1:	00 00 00 
+  807bb4:	ff d0                	call   *%rax
+  807bb6:	48 a3 80 50 81 00 00 	movabs %rax,0x815080
+  807bbd:	00 00 00 
+                DEBUG("tsc_freq=%ld\n", tsc_freq);
+  807bc0:	e9 20 fe ff ff       	jmp    8079e5 <parse_argv+0xc6>
+            }
+        }
+
+    if (segment_count == 0)
+  807bc5:	48 b8 e8 5a 8c 00 00 	movabs $0x8c5ae8,%rax
+  807bcc:	00 00 00 
+  807bcf:	48 83 38 00          	cmpq   $0x0,(%rax)
+  807bd3:	49 b9 57 70 80 00 00 	movabs $0x807057,%r9
+  807bda:	00 00 00 
+  807bdd:	48 ba 57 72 80 00 00 	movabs $0x807257,%rdx
+  807be4:	00 00 00 
+  807be7:	4c 0f 45 ca          	cmovne %rdx,%r9
+  807beb:	49 b8 98 72 80 00 00 	movabs $0x807298,%r8
+  807bf2:	00 00 00 
+  807bf5:	48 ba c1 70 80 00 00 	movabs $0x8070c1,%rdx
+  807bfc:	00 00 00 
+  807bff:	4c 0f 45 c2          	cmovne %rdx,%r8
+  807c03:	48 bf d7 72 80 00 00 	movabs $0x8072d7,%rdi
+  807c0a:	00 00 00 
+  807c0d:	48 ba 42 71 80 00 00 	movabs $0x807142,%rdx
+  807c14:	00 00 00 
+  807c17:	48 0f 45 fa          	cmovne %rdx,%rdi
+  807c1b:	48 be 8a 70 80 00 00 	movabs $0x80708a,%rsi
+  807c22:	00 00 00 
+  807c25:	48 ba c8 71 80 00 00 	movabs $0x8071c8,%rdx
+  807c2c:	00 00 00 
+  807c2f:	48 0f 45 f2          	cmovne %rdx,%rsi
+  807c33:	48 b9 80 73 80 00 00 	movabs $0x807380,%rcx
+  807c3a:	00 00 00 
+  807c3d:	48 ba 0f 72 80 00 00 	movabs $0x80720f,%rdx
+  807c44:	00 00 00 
+  807c47:	48 0f 45 ca          	cmovne %rdx,%rcx
+  807c4b:	48 ba 16 73 80 00 00 	movabs $0x807316,%rdx
+  807c52:	00 00 00 
+  807c55:	48 b8 82 71 80 00 00 	movabs $0x807182,%rax
+  807c5c:	00 00 00 
+  807c5f:	48 0f 45 d0          	cmovne %rax,%rdx
+        pcie_io.read32 = pci_iop_read_dword;
+  807c63:	48 b8 80 5c 8c 00 00 	movabs $0x8c5c80,%rax
+  807c6a:	00 00 00 
+  807c6d:	4c 89 08             	mov    %r9,(%rax)
+        pcie_io.read16 = pci_iop_read_word;
+  807c70:	4c 89 40 08          	mov    %r8,0x8(%rax)
+        pcie_io.read8 = pci_iop_read_byte;
+  807c74:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        pcie_io.write32 = pci_iop_write_dword;
+  807c78:	48 89 70 18          	mov    %rsi,0x18(%rax)
+        pcie_io.write16 = pci_iop_write_word;
+  807c7c:	48 89 48 20          	mov    %rcx,0x20(%rax)
+        pcie_io.write8 = pci_iop_write_byte;
+  807c80:	48 89 50 28          	mov    %rdx,0x28(%rax)
+        pci_set_iomech(PCIE_IOPL);
+    else
+        pci_set_iomech(PCIE_ECAM);
+}
+  807c84:	48 83 c4 38          	add    $0x38,%rsp
+  807c88:	5b                   	pop    %rbx
+  807c89:	41 5c                	pop    %r12
+  807c8b:	41 5d                	pop    %r13
+  807c8d:	41 5e                	pop    %r14
+  807c8f:	41 5f                	pop    %r15
+  807c91:	5d                   	pop    %rbp
+  807c92:	c3                   	ret
+
+0000000000807c93 <pci_init>:
+
+/*
+ * Initialize PCI bus.
+ */
+void
+pci_init(char **argv) {
+  807c93:	55                   	push   %rbp
+  807c94:	48 89 e5             	mov    %rsp,%rbp
+    parse_argv(argv);
+  807c97:	48 b8 1f 79 80 00 00 	movabs $0x80791f,%rax
+  807c9e:	00 00 00 
+  807ca1:	ff d0                	call   *%rax
+
+    init_class_descriptions();
+
+    /* Scan all busses starting at bus 0. */
+    pci_check_busses(0, NULL);
+  807ca3:	be 00 00 00 00       	mov    $0x0,%esi
+  807ca8:	bf 00 00 00 00       	mov    $0x0,%edi
+  807cad:	48 b8 21 77 80 00 00 	movabs $0x807721,%rax
+  807cb4:	00 00 00 
+  807cb7:	ff d0                	call   *%rax
+}
+  807cb9:	5d                   	pop    %rbp
+  807cba:	c3                   	ret
+
+0000000000807cbb <nvme_wait_completion>:
+ * @param   cid         cid
+ * @param   timeout     timeout in seconds
+ * @return  completion status (0 if ok).
+ */
+static int
+nvme_wait_completion(struct NvmeController *ctl, struct NvmeQueueAttributes *q, int cid, int timeout) {
+  807cbb:	55                   	push   %rbp
+  807cbc:	48 89 e5             	mov    %rsp,%rbp
+  807cbf:	53                   	push   %rbx
+  807cc0:	49 89 fa             	mov    %rdi,%r10
+  807cc3:	41 89 d3             	mov    %edx,%r11d
+    volatile struct NvmeCQE *cqe = &q->cq[q->cq_head];
+  807cc6:	8b 7e 28             	mov    0x28(%rsi),%edi
+  807cc9:	41 89 f8             	mov    %edi,%r8d
+  807ccc:	49 c1 e0 04          	shl    $0x4,%r8
+  807cd0:	4c 03 46 10          	add    0x10(%rsi),%r8
+    if (cqe->p == q->cq_phase)
+  807cd4:	44 0f b6 4e 2c       	movzbl 0x2c(%rsi),%r9d
+                stat = -1;
+            }
+
+            return stat;
+        } else if (endtsc == 0) {
+            endtsc = read_tsc() + (uint64_t)timeout * tsc_freq;
+  807cd9:	48 63 d9             	movslq %ecx,%rbx
+  807cdc:	48 b8 80 50 81 00 00 	movabs $0x815080,%rax
+  807ce3:	00 00 00 
+  807ce6:	48 0f af 18          	imul   (%rax),%rbx
+    uint64_t endtsc = 0;
+  807cea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807cef:	eb 47                	jmp    807d38 <nvme_wait_completion+0x7d>
+        q->cq_head = 0;
+  807cf1:	c7 46 28 00 00 00 00 	movl   $0x0,0x28(%rsi)
+        q->cq_phase = !q->cq_phase;
+  807cf8:	41 83 f1 01          	xor    $0x1,%r9d
+  807cfc:	44 88 4e 2c          	mov    %r9b,0x2c(%rsi)
+  807d00:	eb 5b                	jmp    807d5d <nvme_wait_completion+0xa2>
+        }
+    } while (read_tsc() < endtsc);
+
+    return -NVME_CMD_TIMEOUT;
+  807d02:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  807d07:	eb 05                	jmp    807d0e <nvme_wait_completion+0x53>
+                return NVME_OK;
+  807d09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807d0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  807d12:	c9                   	leave
+  807d13:	c3                   	ret
+        } else if (endtsc == 0) {
+  807d14:	48 85 c9             	test   %rcx,%rcx
+  807d17:	75 0f                	jne    807d28 <nvme_wait_completion+0x6d>
+    asm volatile("rdtsc"
+  807d19:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  807d1b:	48 c1 e2 20          	shl    $0x20,%rdx
+  807d1f:	89 c0                	mov    %eax,%eax
+  807d21:	48 09 c2             	or     %rax,%rdx
+            endtsc = read_tsc() + (uint64_t)timeout * tsc_freq;
+  807d24:	48 8d 0c 1a          	lea    (%rdx,%rbx,1),%rcx
+    asm volatile("rdtsc"
+  807d28:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  807d2a:	48 c1 e2 20          	shl    $0x20,%rdx
+  807d2e:	89 c0                	mov    %eax,%eax
+  807d30:	48 09 c2             	or     %rax,%rdx
+    } while (read_tsc() < endtsc);
+  807d33:	48 39 ca             	cmp    %rcx,%rdx
+  807d36:	73 ca                	jae    807d02 <nvme_wait_completion+0x47>
+    if (cqe->p == q->cq_phase)
+  807d38:	49 8b 40 08          	mov    0x8(%r8),%rax
+  807d3c:	48 c1 e8 30          	shr    $0x30,%rax
+  807d40:	83 e0 01             	and    $0x1,%eax
+  807d43:	44 38 c8             	cmp    %r9b,%al
+  807d46:	74 cc                	je     807d14 <nvme_wait_completion+0x59>
+    *stat = cqe->psf & 0xFFFE;
+  807d48:	41 0f b7 40 0e       	movzwl 0xe(%r8),%eax
+  807d4d:	25 fe ff 00 00       	and    $0xfffe,%eax
+    if (++q->cq_head == q->size) {
+  807d52:	83 c7 01             	add    $0x1,%edi
+  807d55:	89 7e 28             	mov    %edi,0x28(%rsi)
+  807d58:	3b 7e 04             	cmp    0x4(%rsi),%edi
+  807d5b:	74 94                	je     807cf1 <nvme_wait_completion+0x36>
+    *NVME_REG32(ctl->mmio_base_addr, q->cq_doorbell) = q->cq_head;
+  807d5d:	8b 56 1c             	mov    0x1c(%rsi),%edx
+  807d60:	49 03 92 98 00 00 00 	add    0x98(%r10),%rdx
+  807d67:	8b 4e 28             	mov    0x28(%rsi),%ecx
+  807d6a:	89 0a                	mov    %ecx,(%rdx)
+    return cqe->cid;
+  807d6c:	41 0f b7 50 0c       	movzwl 0xc(%r8),%edx
+  807d71:	0f b7 d2             	movzwl %dx,%edx
+            if (ret == cid && stat == 0) {
+  807d74:	85 c0                	test   %eax,%eax
+  807d76:	75 05                	jne    807d7d <nvme_wait_completion+0xc2>
+  807d78:	41 39 d3             	cmp    %edx,%r11d
+  807d7b:	74 8c                	je     807d09 <nvme_wait_completion+0x4e>
+                stat = -1;
+  807d7d:	41 39 d3             	cmp    %edx,%r11d
+  807d80:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  807d85:	0f 45 c2             	cmovne %edx,%eax
+  807d88:	eb 84                	jmp    807d0e <nvme_wait_completion+0x53>
+
+0000000000807d8a <nvme_submit_cmd>:
+
+static int
+nvme_submit_cmd(struct NvmeController *ctl, struct NvmeQueueAttributes *q) {
+    DEBUG("sq_tail = %d, base_addr = %p, drbl = %x",
+          q->sq_tail, ctl->mmio_base_addr, q->sq_doorbell);
+    q->sq_tail = (q->sq_tail + 1) % q->size;
+  807d8a:	8b 46 24             	mov    0x24(%rsi),%eax
+  807d8d:	83 c0 01             	add    $0x1,%eax
+  807d90:	ba 00 00 00 00       	mov    $0x0,%edx
+  807d95:	f7 76 04             	divl   0x4(%rsi)
+  807d98:	89 56 24             	mov    %edx,0x24(%rsi)
+    *NVME_REG32(ctl->mmio_base_addr, q->sq_doorbell) = q->sq_tail;
+  807d9b:	8b 46 18             	mov    0x18(%rsi),%eax
+  807d9e:	48 03 87 98 00 00 00 	add    0x98(%rdi),%rax
+  807da5:	89 10                	mov    %edx,(%rax)
+
+    return NVME_OK;
+}
+  807da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  807dac:	c3                   	ret
+
+0000000000807dad <nvme_acmd_identify>:
+
+static int
+nvme_acmd_identify(struct NvmeController *ctl, int nsid, uint64_t prp1, uint64_t prp2) {
+  807dad:	55                   	push   %rbp
+  807dae:	48 89 e5             	mov    %rsp,%rbp
+  807db1:	41 57                	push   %r15
+  807db3:	41 56                	push   %r14
+  807db5:	41 55                	push   %r13
+  807db7:	41 54                	push   %r12
+  807db9:	53                   	push   %rbx
+  807dba:	48 83 ec 18          	sub    $0x18,%rsp
+  807dbe:	49 89 fc             	mov    %rdi,%r12
+  807dc1:	41 89 f5             	mov    %esi,%r13d
+  807dc4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  807dc8:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    struct NvmeQueueAttributes *adminq = &ctl->adminq;
+  807dcc:	4c 8d bf c0 00 00 00 	lea    0xc0(%rdi),%r15
+    int cid = adminq->sq_tail;
+  807dd3:	44 8b b7 e4 00 00 00 	mov    0xe4(%rdi),%r14d
+    struct NvmeACmdIdentify *cmd = &adminq->sq[cid].identify;
+  807dda:	49 63 de             	movslq %r14d,%rbx
+  807ddd:	48 c1 e3 06          	shl    $0x6,%rbx
+  807de1:	48 03 9f c8 00 00 00 	add    0xc8(%rdi),%rbx
+
+    DEBUG("sq = %d - %d cid = %#x nsid = %d, prp1 = %lx, prp2 = %lx", adminq->sq_head, adminq->sq_tail, cid, nsid, prp1, prp2);
+
+    memset(cmd, 0, sizeof(*cmd));
+  807de8:	ba 40 00 00 00       	mov    $0x40,%edx
+  807ded:	be 00 00 00 00       	mov    $0x0,%esi
+  807df2:	48 89 df             	mov    %rbx,%rdi
+  807df5:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  807dfc:	00 00 00 
+  807dff:	ff d0                	call   *%rax
+    cmd->common.opc = NVME_ACMD_IDENTIFY;
+  807e01:	c6 03 06             	movb   $0x6,(%rbx)
+    cmd->common.cid = cid;
+  807e04:	66 44 89 73 02       	mov    %r14w,0x2(%rbx)
+    cmd->common.nsid = nsid;
+  807e09:	44 89 6b 04          	mov    %r13d,0x4(%rbx)
+    cmd->common.prp[0] = prp1;
+  807e0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807e11:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    cmd->common.prp[1] = prp2;
+  807e15:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  807e19:	48 89 43 20          	mov    %rax,0x20(%rbx)
+    cmd->cns = nsid == 0 ? 1 : 0;
+  807e1d:	45 85 ed             	test   %r13d,%r13d
+  807e20:	0f 94 c0             	sete   %al
+  807e23:	0f b6 c0             	movzbl %al,%eax
+  807e26:	89 43 28             	mov    %eax,0x28(%rbx)
+
+    int err = nvme_submit_cmd(ctl, adminq);
+  807e29:	4c 89 fe             	mov    %r15,%rsi
+  807e2c:	4c 89 e7             	mov    %r12,%rdi
+  807e2f:	48 b8 8a 7d 80 00 00 	movabs $0x807d8a,%rax
+  807e36:	00 00 00 
+  807e39:	ff d0                	call   *%rax
+    if (err)
+  807e3b:	85 c0                	test   %eax,%eax
+  807e3d:	74 0f                	je     807e4e <nvme_acmd_identify+0xa1>
+        return err;
+
+    err = nvme_wait_completion(ctl, adminq, cid, 900);
+    return err;
+}
+  807e3f:	48 83 c4 18          	add    $0x18,%rsp
+  807e43:	5b                   	pop    %rbx
+  807e44:	41 5c                	pop    %r12
+  807e46:	41 5d                	pop    %r13
+  807e48:	41 5e                	pop    %r14
+  807e4a:	41 5f                	pop    %r15
+  807e4c:	5d                   	pop    %rbp
+  807e4d:	c3                   	ret
+    err = nvme_wait_completion(ctl, adminq, cid, 900);
+  807e4e:	b9 84 03 00 00       	mov    $0x384,%ecx
+  807e53:	44 89 f2             	mov    %r14d,%edx
+  807e56:	4c 89 fe             	mov    %r15,%rsi
+  807e59:	4c 89 e7             	mov    %r12,%rdi
+  807e5c:	48 b8 bb 7c 80 00 00 	movabs $0x807cbb,%rax
+  807e63:	00 00 00 
+  807e66:	ff d0                	call   *%rax
+    return err;
+  807e68:	eb d5                	jmp    807e3f <nvme_acmd_identify+0x92>
+
+0000000000807e6a <nvme_cmd_rw>:
+ * @param   buf         data buffer
+ * @return  command tag if ok else errcode < 0.
+ */
+static int
+nvme_cmd_rw(struct NvmeController *ctl, struct NvmeQueueAttributes *ioq, int opc,
+            int nsid, uint64_t slba, int nlb, const void *buf) {
+  807e6a:	55                   	push   %rbp
+  807e6b:	48 89 e5             	mov    %rsp,%rbp
+  807e6e:	41 57                	push   %r15
+  807e70:	41 56                	push   %r14
+  807e72:	41 55                	push   %r13
+  807e74:	41 54                	push   %r12
+  807e76:	53                   	push   %rbx
+  807e77:	48 83 ec 58          	sub    $0x58,%rsp
+  807e7b:	48 89 fb             	mov    %rdi,%rbx
+  807e7e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  807e82:	89 55 c0             	mov    %edx,-0x40(%rbp)
+  807e85:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+  807e88:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  807e8c:	44 89 4d b4          	mov    %r9d,-0x4c(%rbp)
+    /* Submission queue slot may only be reused once the command
+     * submitted there before is fetched, which is guaranteed
+     * while fewer than queue size commands are outstanding */
+    uint32_t free = ~ioq->tags;
+  807e90:	8b 7e 30             	mov    0x30(%rsi),%edi
+    if (!free || (uint32_t)__builtin_popcount(ioq->tags) >= ioq->size - 1)
+  807e93:	41 89 fe             	mov    %edi,%r14d
+  807e96:	41 83 f6 ff          	xor    $0xffffffff,%r14d
+  807e9a:	0f 84 8a 01 00 00    	je     80802a <nvme_cmd_rw+0x1c0>
+  807ea0:	49 89 f5             	mov    %rsi,%r13
+  807ea3:	41 89 d7             	mov    %edx,%r15d
+  807ea6:	45 89 cc             	mov    %r9d,%r12d
+  807ea9:	89 ff                	mov    %edi,%edi
+  807eab:	48 b8 80 d4 80 00 00 	movabs $0x80d480,%rax
+  807eb2:	00 00 00 
+  807eb5:	ff d0                	call   *%rax
+  807eb7:	89 c2                	mov    %eax,%edx
+  807eb9:	41 8b 45 04          	mov    0x4(%r13),%eax
+  807ebd:	83 e8 01             	sub    $0x1,%eax
+  807ec0:	39 c2                	cmp    %eax,%edx
+  807ec2:	0f 83 6d 01 00 00    	jae    808035 <nvme_cmd_rw+0x1cb>
+        return -NVME_IOCMD_FAILED;
+    int tag = __builtin_ctz(free);
+  807ec8:	f3 45 0f bc f6       	tzcnt  %r14d,%r14d
+
+    /* Flush transfers no data */
+    uint64_t prp1 = 0, prp2 = 0;
+    if (opc != NVME_CMD_FLUSH) {
+  807ecd:	45 85 ff             	test   %r15d,%r15d
+  807ed0:	0f 84 85 01 00 00    	je     80805b <nvme_cmd_rw+0x1f1>
+        int err = nvme_setup_prp(ctl, tag, buf, (size_t)nlb << ctl->nsi.blockshift, &prp1, &prp2);
+  807ed6:	49 63 f4             	movslq %r12d,%rsi
+  807ed9:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+    uintptr_t next = ROUNDDOWN(va, NVME_PAGE_SIZE) + NVME_PAGE_SIZE;
+  807edd:	4c 8b 65 10          	mov    0x10(%rbp),%r12
+  807ee1:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+  807ee8:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+        int err = nvme_setup_prp(ctl, tag, buf, (size_t)nlb << ctl->nsi.blockshift, &prp1, &prp2);
+  807eef:	48 89 d8             	mov    %rbx,%rax
+  807ef2:	0f b7 8b 8a 00 00 00 	movzwl 0x8a(%rbx),%ecx
+  807ef9:	48 d3 e6             	shl    %cl,%rsi
+  807efc:	48 89 f3             	mov    %rsi,%rbx
+    uintptr_t end = va + len;
+  807eff:	48 03 5d 10          	add    0x10(%rbp),%rbx
+    uint64_t *list = ctl->prp_list + tag * (NVME_PAGE_SIZE / sizeof(uint64_t));
+  807f03:	4c 8b b8 b0 00 00 00 	mov    0xb0(%rax),%r15
+    *prp1 = get_phys_addr((void *)va);
+  807f0a:	48 8b 7d 10          	mov    0x10(%rbp),%rdi
+  807f0e:	48 b8 a1 cf 80 00 00 	movabs $0x80cfa1,%rax
+  807f15:	00 00 00 
+  807f18:	ff d0                	call   *%rax
+  807f1a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (*prp1 == (uint64_t)-1)
+  807f1e:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  807f22:	0f 84 18 01 00 00    	je     808040 <nvme_cmd_rw+0x1d6>
+    if (end <= next)
+  807f28:	49 39 dc             	cmp    %rbx,%r12
+  807f2b:	0f 83 b1 01 00 00    	jae    8080e2 <nvme_cmd_rw+0x278>
+    size_t npages = (ROUNDUP(end, NVME_PAGE_SIZE) - next) / NVME_PAGE_SIZE;
+  807f31:	48 81 c3 ff 0f 00 00 	add    $0xfff,%rbx
+  807f38:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  807f3f:	4c 29 e3             	sub    %r12,%rbx
+  807f42:	48 89 da             	mov    %rbx,%rdx
+  807f45:	48 c1 ea 0c          	shr    $0xc,%rdx
+    if (npages >= ctl->ci.maxppio)
+  807f49:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807f4d:	0f b7 40 52          	movzwl 0x52(%rax),%eax
+  807f51:	48 39 c2             	cmp    %rax,%rdx
+  807f54:	0f 83 f1 00 00 00    	jae    80804b <nvme_cmd_rw+0x1e1>
+    uint64_t *list = ctl->prp_list + tag * (NVME_PAGE_SIZE / sizeof(uint64_t));
+  807f5a:	49 63 ce             	movslq %r14d,%rcx
+  807f5d:	48 c1 e1 0c          	shl    $0xc,%rcx
+  807f61:	49 8d 04 0f          	lea    (%r15,%rcx,1),%rax
+  807f65:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+    for (size_t i = 0; i < npages; i++) {
+  807f69:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  807f70:	76 55                	jbe    807fc7 <nvme_cmd_rw+0x15d>
+  807f72:	bb 00 00 00 00       	mov    $0x0,%ebx
+        uint64_t pa = get_phys_addr((void *)(next + i * NVME_PAGE_SIZE));
+  807f77:	49 bf a1 cf 80 00 00 	movabs $0x80cfa1,%r15
+  807f7e:	00 00 00 
+  807f81:	48 89 4d 98          	mov    %rcx,-0x68(%rbp)
+  807f85:	44 89 75 b0          	mov    %r14d,-0x50(%rbp)
+  807f89:	49 89 d6             	mov    %rdx,%r14
+  807f8c:	4c 89 6d 90          	mov    %r13,-0x70(%rbp)
+  807f90:	49 89 c5             	mov    %rax,%r13
+  807f93:	4c 89 e7             	mov    %r12,%rdi
+  807f96:	41 ff d7             	call   *%r15
+        if (pa == (uint64_t)-1)
+  807f99:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  807f9d:	0f 84 b0 00 00 00    	je     808053 <nvme_cmd_rw+0x1e9>
+        list[i] = pa;
+  807fa3:	49 89 44 dd 00       	mov    %rax,0x0(%r13,%rbx,8)
+    for (size_t i = 0; i < npages; i++) {
+  807fa8:	48 83 c3 01          	add    $0x1,%rbx
+  807fac:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  807fb3:	4c 39 f3             	cmp    %r14,%rbx
+  807fb6:	72 db                	jb     807f93 <nvme_cmd_rw+0x129>
+  807fb8:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  807fbc:	4c 89 f2             	mov    %r14,%rdx
+  807fbf:	44 8b 75 b0          	mov    -0x50(%rbp),%r14d
+  807fc3:	4c 8b 6d 90          	mov    -0x70(%rbp),%r13
+    *prp2 = npages == 1 ? list[0] : ctl->prp_list_pa + tag * NVME_PAGE_SIZE;
+  807fc7:	48 83 fa 01          	cmp    $0x1,%rdx
+  807fcb:	74 13                	je     807fe0 <nvme_cmd_rw+0x176>
+  807fcd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807fd1:	48 03 88 b8 00 00 00 	add    0xb8(%rax),%rcx
+  807fd8:	49 89 cc             	mov    %rcx,%r12
+  807fdb:	e9 08 01 00 00       	jmp    8080e8 <nvme_cmd_rw+0x27e>
+  807fe0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  807fe4:	4c 8b 20             	mov    (%rax),%r12
+  807fe7:	e9 fc 00 00 00       	jmp    8080e8 <nvme_cmd_rw+0x27e>
+
+    if (opc == NVME_CMD_READ) {
+        nvme_stats.reads++;
+        nvme_stats.read_bytes += (uint64_t)nlb << ctl->nsi.blockshift;
+    } else if (opc == NVME_CMD_FLUSH) {
+        nvme_stats.flushes++;
+  807fec:	48 b8 40 60 8c 00 00 	movabs $0x8c6040,%rax
+  807ff3:	00 00 00 
+  807ff6:	48 83 40 20 01       	addq   $0x1,0x20(%rax)
+  807ffb:	e9 d0 00 00 00       	jmp    8080d0 <nvme_cmd_rw+0x266>
+    } else {
+        nvme_stats.writes++;
+  808000:	48 b8 40 60 8c 00 00 	movabs $0x8c6040,%rax
+  808007:	00 00 00 
+  80800a:	48 83 40 08 01       	addq   $0x1,0x8(%rax)
+        nvme_stats.write_bytes += (uint64_t)nlb << ctl->nsi.blockshift;
+  80800f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  808013:	0f b7 89 8a 00 00 00 	movzwl 0x8a(%rcx),%ecx
+  80801a:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80801e:	48 d3 e2             	shl    %cl,%rdx
+  808021:	48 01 50 18          	add    %rdx,0x18(%rax)
+  808025:	e9 a6 00 00 00       	jmp    8080d0 <nvme_cmd_rw+0x266>
+        return -NVME_IOCMD_FAILED;
+  80802a:	41 be f9 ff ff ff    	mov    $0xfffffff9,%r14d
+  808030:	e9 9b 00 00 00       	jmp    8080d0 <nvme_cmd_rw+0x266>
+  808035:	41 be f9 ff ff ff    	mov    $0xfffffff9,%r14d
+  80803b:	e9 90 00 00 00       	jmp    8080d0 <nvme_cmd_rw+0x266>
+  808040:	41 be ff ff ff ff    	mov    $0xffffffff,%r14d
+  808046:	e9 85 00 00 00       	jmp    8080d0 <nvme_cmd_rw+0x266>
+  80804b:	41 be ff ff ff ff    	mov    $0xffffffff,%r14d
+  808051:	eb 7d                	jmp    8080d0 <nvme_cmd_rw+0x266>
+            return -NVME_BAD_ARG;
+  808053:	41 be ff ff ff ff    	mov    $0xffffffff,%r14d
+  808059:	eb 75                	jmp    8080d0 <nvme_cmd_rw+0x266>
+    struct NvmeCmdRW *cmd = &ioq->sq[ioq->sq_tail].rw;
+  80805b:	41 8b 5d 24          	mov    0x24(%r13),%ebx
+  80805f:	48 c1 e3 06          	shl    $0x6,%rbx
+  808063:	49 03 5d 08          	add    0x8(%r13),%rbx
+    memset(cmd, 0, sizeof(struct NvmeCmdRW));
+  808067:	ba 40 00 00 00       	mov    $0x40,%edx
+  80806c:	be 00 00 00 00       	mov    $0x0,%esi
+  808071:	48 89 df             	mov    %rbx,%rdi
+  808074:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  80807b:	00 00 00 
+  80807e:	ff d0                	call   *%rax
+    cmd->common.opc = opc;
+  808080:	c6 03 00             	movb   $0x0,(%rbx)
+    cmd->common.cid = tag;
+  808083:	66 44 89 73 02       	mov    %r14w,0x2(%rbx)
+    cmd->common.nsid = nsid;
+  808088:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80808b:	89 43 04             	mov    %eax,0x4(%rbx)
+    cmd->common.prp[0] = prp1;
+  80808e:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  808095:	00 
+    cmd->common.prp[1] = prp2;
+  808096:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80809d:	00 
+    ioq->tags |= 1U << tag;
+  80809e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8080a3:	44 89 f1             	mov    %r14d,%ecx
+  8080a6:	d3 e3                	shl    %cl,%ebx
+  8080a8:	41 09 5d 30          	or     %ebx,0x30(%r13)
+    int err = nvme_submit_cmd(ctl, ioq);
+  8080ac:	4c 89 ee             	mov    %r13,%rsi
+  8080af:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8080b3:	48 b8 8a 7d 80 00 00 	movabs $0x807d8a,%rax
+  8080ba:	00 00 00 
+  8080bd:	ff d0                	call   *%rax
+    if (err) {
+  8080bf:	85 c0                	test   %eax,%eax
+  8080c1:	0f 84 25 ff ff ff    	je     807fec <nvme_cmd_rw+0x182>
+        ioq->tags &= ~(1U << tag);
+  8080c7:	f7 d3                	not    %ebx
+  8080c9:	41 21 5d 30          	and    %ebx,0x30(%r13)
+        return err;
+  8080cd:	41 89 c6             	mov    %eax,%r14d
+    }
+    return tag;
+}
+  8080d0:	44 89 f0             	mov    %r14d,%eax
+  8080d3:	48 83 c4 58          	add    $0x58,%rsp
+  8080d7:	5b                   	pop    %rbx
+  8080d8:	41 5c                	pop    %r12
+  8080da:	41 5d                	pop    %r13
+  8080dc:	41 5e                	pop    %r14
+  8080de:	41 5f                	pop    %r15
+  8080e0:	5d                   	pop    %rbp
+  8080e1:	c3                   	ret
+    *prp2 = 0;
+  8080e2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    struct NvmeCmdRW *cmd = &ioq->sq[ioq->sq_tail].rw;
+  8080e8:	41 8b 5d 24          	mov    0x24(%r13),%ebx
+  8080ec:	48 c1 e3 06          	shl    $0x6,%rbx
+  8080f0:	49 03 5d 08          	add    0x8(%r13),%rbx
+    memset(cmd, 0, sizeof(struct NvmeCmdRW));
+  8080f4:	ba 40 00 00 00       	mov    $0x40,%edx
+  8080f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8080fe:	48 89 df             	mov    %rbx,%rdi
+  808101:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  808108:	00 00 00 
+  80810b:	ff d0                	call   *%rax
+    cmd->common.opc = opc;
+  80810d:	0f b6 45 c0          	movzbl -0x40(%rbp),%eax
+  808111:	88 03                	mov    %al,(%rbx)
+    cmd->common.cid = tag;
+  808113:	66 44 89 73 02       	mov    %r14w,0x2(%rbx)
+    cmd->common.nsid = nsid;
+  808118:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80811b:	89 43 04             	mov    %eax,0x4(%rbx)
+    cmd->common.prp[0] = prp1;
+  80811e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  808122:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    cmd->common.prp[1] = prp2;
+  808126:	4c 89 63 20          	mov    %r12,0x20(%rbx)
+        cmd->slba = slba;
+  80812a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80812e:	48 89 43 28          	mov    %rax,0x28(%rbx)
+        cmd->nlb = nlb - 1;
+  808132:	0f b7 45 b4          	movzwl -0x4c(%rbp),%eax
+  808136:	83 e8 01             	sub    $0x1,%eax
+  808139:	66 89 43 30          	mov    %ax,0x30(%rbx)
+    ioq->tags |= 1U << tag;
+  80813d:	bb 01 00 00 00       	mov    $0x1,%ebx
+  808142:	44 89 f1             	mov    %r14d,%ecx
+  808145:	d3 e3                	shl    %cl,%ebx
+  808147:	41 09 5d 30          	or     %ebx,0x30(%r13)
+    int err = nvme_submit_cmd(ctl, ioq);
+  80814b:	4c 89 ee             	mov    %r13,%rsi
+  80814e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  808152:	48 b8 8a 7d 80 00 00 	movabs $0x807d8a,%rax
+  808159:	00 00 00 
+  80815c:	ff d0                	call   *%rax
+    if (err) {
+  80815e:	85 c0                	test   %eax,%eax
+  808160:	0f 85 61 ff ff ff    	jne    8080c7 <nvme_cmd_rw+0x25d>
+    if (opc == NVME_CMD_READ) {
+  808166:	83 7d c0 02          	cmpl   $0x2,-0x40(%rbp)
+  80816a:	0f 85 90 fe ff ff    	jne    808000 <nvme_cmd_rw+0x196>
+        nvme_stats.reads++;
+  808170:	48 b8 40 60 8c 00 00 	movabs $0x8c6040,%rax
+  808177:	00 00 00 
+  80817a:	48 83 00 01          	addq   $0x1,(%rax)
+        nvme_stats.read_bytes += (uint64_t)nlb << ctl->nsi.blockshift;
+  80817e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  808182:	0f b7 89 8a 00 00 00 	movzwl 0x8a(%rcx),%ecx
+  808189:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80818d:	48 d3 e2             	shl    %cl,%rdx
+  808190:	48 01 50 10          	add    %rdx,0x10(%rax)
+  808194:	e9 37 ff ff ff       	jmp    8080d0 <nvme_cmd_rw+0x266>
+
+0000000000808199 <nvme_reap>:
+nvme_reap(struct NvmeController *ctl, struct NvmeQueueAttributes *q) {
+  808199:	48 89 f0             	mov    %rsi,%rax
+        if (tag >= NVME_IO_TAGS || !(q->tags & (1U << tag))) {
+  80819c:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+    volatile struct NvmeCQE *cqe = &q->cq[q->cq_head];
+  8081a2:	8b 70 28             	mov    0x28(%rax),%esi
+  8081a5:	89 f2                	mov    %esi,%edx
+  8081a7:	48 c1 e2 04          	shl    $0x4,%rdx
+  8081ab:	48 03 50 10          	add    0x10(%rax),%rdx
+    if (cqe->p == q->cq_phase)
+  8081af:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  8081b3:	48 c1 e9 30          	shr    $0x30,%rcx
+  8081b7:	83 e1 01             	and    $0x1,%ecx
+  8081ba:	44 0f b6 48 2c       	movzbl 0x2c(%rax),%r9d
+  8081bf:	44 38 c9             	cmp    %r9b,%cl
+  8081c2:	74 5c                	je     808220 <nvme_reap+0x87>
+    *stat = cqe->psf & 0xFFFE;
+  8081c4:	44 0f b7 52 0e       	movzwl 0xe(%rdx),%r10d
+    if (++q->cq_head == q->size) {
+  8081c9:	83 c6 01             	add    $0x1,%esi
+  8081cc:	89 70 28             	mov    %esi,0x28(%rax)
+  8081cf:	3b 70 04             	cmp    0x4(%rax),%esi
+  8081d2:	74 3b                	je     80820f <nvme_reap+0x76>
+    *NVME_REG32(ctl->mmio_base_addr, q->cq_doorbell) = q->cq_head;
+  8081d4:	8b 48 1c             	mov    0x1c(%rax),%ecx
+  8081d7:	48 03 8f 98 00 00 00 	add    0x98(%rdi),%rcx
+  8081de:	8b 70 28             	mov    0x28(%rax),%esi
+  8081e1:	89 31                	mov    %esi,(%rcx)
+    return cqe->cid;
+  8081e3:	0f b7 4a 0c          	movzwl 0xc(%rdx),%ecx
+  8081e7:	0f b7 c9             	movzwl %cx,%ecx
+        if (tag >= NVME_IO_TAGS || !(q->tags & (1U << tag))) {
+  8081ea:	83 f9 1f             	cmp    $0x1f,%ecx
+  8081ed:	7f b3                	jg     8081a2 <nvme_reap+0x9>
+  8081ef:	44 89 c2             	mov    %r8d,%edx
+  8081f2:	d3 e2                	shl    %cl,%edx
+  8081f4:	89 d6                	mov    %edx,%esi
+  8081f6:	23 70 30             	and    0x30(%rax),%esi
+  8081f9:	74 a7                	je     8081a2 <nvme_reap+0x9>
+        q->done |= 1U << tag;
+  8081fb:	09 50 38             	or     %edx,0x38(%rax)
+        q->status[tag] = stat;
+  8081fe:	48 63 c9             	movslq %ecx,%rcx
+    *stat = cqe->psf & 0xFFFE;
+  808201:	41 81 e2 fe ff 00 00 	and    $0xfffe,%r10d
+  808208:	44 89 54 88 3c       	mov    %r10d,0x3c(%rax,%rcx,4)
+  80820d:	eb 93                	jmp    8081a2 <nvme_reap+0x9>
+        q->cq_head = 0;
+  80820f:	c7 40 28 00 00 00 00 	movl   $0x0,0x28(%rax)
+        q->cq_phase = !q->cq_phase;
+  808216:	41 83 f1 01          	xor    $0x1,%r9d
+  80821a:	44 88 48 2c          	mov    %r9b,0x2c(%rax)
+  80821e:	eb b4                	jmp    8081d4 <nvme_reap+0x3b>
+}
+  808220:	c3                   	ret
+
+0000000000808221 <nvme_rw_sync>:
+
+/* Submit read or write and synchronously wait for its completion.
+ * Completions of asynchronous commands seen meanwhile are
+ * kept for nvme_poll(). */
+static int
+nvme_rw_sync(struct NvmeController *ctl, int opc, uint64_t secno, size_t nsecs, const void *buf) {
+  808221:	55                   	push   %rbp
+  808222:	48 89 e5             	mov    %rsp,%rbp
+  808225:	41 57                	push   %r15
+  808227:	41 56                	push   %r14
+  808229:	41 55                	push   %r13
+  80822b:	41 54                	push   %r12
+  80822d:	53                   	push   %rbx
+  80822e:	48 83 ec 18          	sub    $0x18,%rsp
+  808232:	48 89 fb             	mov    %rdi,%rbx
+  808235:	89 f0                	mov    %esi,%eax
+  808237:	48 89 d6             	mov    %rdx,%rsi
+    asm volatile("pushfq; popq %0"
+  80823a:	9c                   	pushf
+  80823b:	5a                   	pop    %rdx
+    int IF = read_rflags() & FL_IF;
+    if (IF)
+  80823c:	89 d7                	mov    %edx,%edi
+  80823e:	81 e7 00 02 00 00    	and    $0x200,%edi
+  808244:	89 7d c8             	mov    %edi,-0x38(%rbp)
+  808247:	0f 84 87 00 00 00    	je     8082d4 <nvme_rw_sync+0xb3>
+        asm volatile("cli");
+  80824d:	fa                   	cli
+
+    int err = nvme_cmd_rw(ctl, &ctl->ioq[0], opc, ctl->nsi.id, secno, nsecs, buf);
+  80824e:	4c 8d b3 80 01 00 00 	lea    0x180(%rbx),%r14
+  808255:	0f b7 53 70          	movzwl 0x70(%rbx),%edx
+  808259:	48 83 ec 08          	sub    $0x8,%rsp
+  80825d:	41 50                	push   %r8
+  80825f:	41 89 c9             	mov    %ecx,%r9d
+  808262:	49 89 f0             	mov    %rsi,%r8
+  808265:	89 d1                	mov    %edx,%ecx
+  808267:	89 c2                	mov    %eax,%edx
+  808269:	4c 89 f6             	mov    %r14,%rsi
+  80826c:	48 89 df             	mov    %rbx,%rdi
+  80826f:	48 b8 6a 7e 80 00 00 	movabs $0x807e6a,%rax
+  808276:	00 00 00 
+  808279:	ff d0                	call   *%rax
+  80827b:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    if (err >= 0)
+  80827e:	48 83 c4 10          	add    $0x10,%rsp
+  808282:	85 c0                	test   %eax,%eax
+  808284:	0f 89 86 00 00 00    	jns    808310 <nvme_rw_sync+0xef>
+        err = nvme_wait_tag(ctl, &ctl->ioq[0], err, 300);
+
+    if (IF)
+        asm volatile("sti");
+  80828a:	fb                   	sti
+
+    return err;
+}
+  80828b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80828e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  808292:	5b                   	pop    %rbx
+  808293:	41 5c                	pop    %r12
+  808295:	41 5d                	pop    %r13
+  808297:	41 5e                	pop    %r14
+  808299:	41 5f                	pop    %r15
+  80829b:	5d                   	pop    %rbp
+  80829c:	c3                   	ret
+            q->done &= ~(1U << tag);
+  80829d:	41 f7 d5             	not    %r13d
+  8082a0:	44 21 e8             	and    %r13d,%eax
+  8082a3:	89 83 b8 01 00 00    	mov    %eax,0x1b8(%rbx)
+            q->tags &= ~(1U << tag);
+  8082a9:	44 21 ab b0 01 00 00 	and    %r13d,0x1b0(%rbx)
+            q->async &= ~(1U << tag);
+  8082b0:	44 21 ab b4 01 00 00 	and    %r13d,0x1b4(%rbx)
+            return q->status[tag] ? -NVME_IOCMD_FAILED : NVME_OK;
+  8082b7:	48 63 45 cc          	movslq -0x34(%rbp),%rax
+  8082bb:	8b 84 83 bc 01 00 00 	mov    0x1bc(%rbx,%rax,4),%eax
+  8082c2:	f7 d8                	neg    %eax
+  8082c4:	19 c0                	sbb    %eax,%eax
+  8082c6:	83 e0 f9             	and    $0xfffffff9,%eax
+  8082c9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    if (IF)
+  8082cc:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8082d0:	75 b8                	jne    80828a <nvme_rw_sync+0x69>
+  8082d2:	eb b7                	jmp    80828b <nvme_rw_sync+0x6a>
+    int err = nvme_cmd_rw(ctl, &ctl->ioq[0], opc, ctl->nsi.id, secno, nsecs, buf);
+  8082d4:	4c 8d b3 80 01 00 00 	lea    0x180(%rbx),%r14
+  8082db:	0f b7 53 70          	movzwl 0x70(%rbx),%edx
+  8082df:	48 83 ec 08          	sub    $0x8,%rsp
+  8082e3:	41 50                	push   %r8
+  8082e5:	41 89 c9             	mov    %ecx,%r9d
+  8082e8:	49 89 f0             	mov    %rsi,%r8
+  8082eb:	89 d1                	mov    %edx,%ecx
+  8082ed:	89 c2                	mov    %eax,%edx
+  8082ef:	4c 89 f6             	mov    %r14,%rsi
+  8082f2:	48 89 df             	mov    %rbx,%rdi
+  8082f5:	48 b8 6a 7e 80 00 00 	movabs $0x807e6a,%rax
+  8082fc:	00 00 00 
+  8082ff:	ff d0                	call   *%rax
+  808301:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    if (err >= 0)
+  808304:	48 83 c4 10          	add    $0x10,%rsp
+  808308:	85 c0                	test   %eax,%eax
+  80830a:	0f 88 7b ff ff ff    	js     80828b <nvme_rw_sync+0x6a>
+    asm volatile("rdtsc"
+  808310:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  808312:	48 c1 e2 20          	shl    $0x20,%rdx
+  808316:	89 c0                	mov    %eax,%eax
+  808318:	48 09 c2             	or     %rax,%rdx
+    uint64_t endtsc = read_tsc() + (uint64_t)timeout * tsc_freq;
+  80831b:	48 a1 80 50 81 00 00 	movabs 0x815080,%rax
+  808322:	00 00 00 
+  808325:	48 69 c0 2c 01 00 00 	imul   $0x12c,%rax,%rax
+  80832c:	4c 8d 24 02          	lea    (%rdx,%rax,1),%r12
+        if (q->done & (1U << tag)) {
+  808330:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  808336:	0f b6 4d cc          	movzbl -0x34(%rbp),%ecx
+  80833a:	41 d3 e5             	shl    %cl,%r13d
+        nvme_reap(ctl, q);
+  80833d:	49 bf 99 81 80 00 00 	movabs $0x808199,%r15
+  808344:	00 00 00 
+  808347:	4c 89 f6             	mov    %r14,%rsi
+  80834a:	48 89 df             	mov    %rbx,%rdi
+  80834d:	41 ff d7             	call   *%r15
+        if (q->done & (1U << tag)) {
+  808350:	8b 83 b8 01 00 00    	mov    0x1b8(%rbx),%eax
+  808356:	44 85 e8             	test   %r13d,%eax
+  808359:	0f 85 3e ff ff ff    	jne    80829d <nvme_rw_sync+0x7c>
+    asm volatile("rdtsc"
+  80835f:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  808361:	48 c1 e2 20          	shl    $0x20,%rdx
+  808365:	89 c0                	mov    %eax,%eax
+  808367:	48 09 c2             	or     %rax,%rdx
+    } while (read_tsc() < endtsc);
+  80836a:	4c 39 e2             	cmp    %r12,%rdx
+  80836d:	72 d8                	jb     808347 <nvme_rw_sync+0x126>
+    return -NVME_CMD_TIMEOUT;
+  80836f:	c7 45 cc f7 ff ff ff 	movl   $0xfffffff7,-0x34(%rbp)
+  808376:	e9 51 ff ff ff       	jmp    8082cc <nvme_rw_sync+0xab>
+
+000000000080837b <nvme_init>:
+nvme_init(void) {
+  80837b:	55                   	push   %rbp
+  80837c:	48 89 e5             	mov    %rsp,%rbp
+  80837f:	41 57                	push   %r15
+  808381:	41 56                	push   %r14
+  808383:	41 55                	push   %r13
+  808385:	41 54                	push   %r12
+  808387:	53                   	push   %rbx
+  808388:	48 83 ec 08          	sub    $0x8,%rsp
+    struct PciDevice *pcidevice = find_pci_dev(1, 8);
+  80838c:	be 08 00 00 00       	mov    $0x8,%esi
+  808391:	bf 01 00 00 00       	mov    $0x1,%edi
+  808396:	48 b8 13 78 80 00 00 	movabs $0x807813,%rax
+  80839d:	00 00 00 
+  8083a0:	ff d0                	call   *%rax
+    if (pcidevice == NULL)
+  8083a2:	48 85 c0             	test   %rax,%rax
+  8083a5:	0f 84 cf 04 00 00    	je     80887a <nvme_init+0x4ff>
+  8083ab:	48 89 c7             	mov    %rax,%rdi
+    ctl->pcidev = pcidevice;
+  8083ae:	49 bc 80 60 8c 00 00 	movabs $0x8c6080,%r12
+  8083b5:	00 00 00 
+  8083b8:	49 89 04 24          	mov    %rax,(%r12)
+    ctl->mmio_base_addr = (volatile uint8_t *)NVME_VADDR;
+  8083bc:	48 b8 00 00 00 01 70 	movabs $0x7001000000,%rax
+  8083c3:	00 00 00 
+  8083c6:	49 89 84 24 98 00 00 	mov    %rax,0x98(%r12)
+  8083cd:	00 
+    size_t size = get_bar_size(ctl->pcidev, 0);
+  8083ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8083d3:	48 b8 5f 78 80 00 00 	movabs $0x80785f,%rax
+  8083da:	00 00 00 
+  8083dd:	ff d0                	call   *%rax
+  8083df:	89 c3                	mov    %eax,%ebx
+    int res = sys_map_physical_region(get_bar_address(ctl->pcidev, 0), CURENVID, (void *)ctl->mmio_base_addr, size, PROT_RW | PROT_CD);
+  8083e1:	4d 8b ac 24 98 00 00 	mov    0x98(%r12),%r13
+  8083e8:	00 
+  8083e9:	49 8b 3c 24          	mov    (%r12),%rdi
+  8083ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8083f2:	48 b8 db 78 80 00 00 	movabs $0x8078db,%rax
+  8083f9:	00 00 00 
+  8083fc:	ff d0                	call   *%rax
+  8083fe:	48 89 c7             	mov    %rax,%rdi
+    size = size > NVME_MAX_MAP_MEM ? NVME_MAX_MAP_MEM : size;
+  808401:	b8 00 80 00 00       	mov    $0x8000,%eax
+  808406:	48 39 c3             	cmp    %rax,%rbx
+  808409:	48 0f 46 c3          	cmovbe %rbx,%rax
+  80840d:	48 89 c1             	mov    %rax,%rcx
+    int res = sys_map_physical_region(get_bar_address(ctl->pcidev, 0), CURENVID, (void *)ctl->mmio_base_addr, size, PROT_RW | PROT_CD);
+  808410:	41 b8 1e 00 00 00    	mov    $0x1e,%r8d
+  808416:	4c 89 ea             	mov    %r13,%rdx
+  808419:	be 00 00 00 00       	mov    $0x0,%esi
+  80841e:	48 b8 d9 a2 80 00 00 	movabs $0x80a2d9,%rax
+  808425:	00 00 00 
+  808428:	ff d0                	call   *%rax
+    if (res)
+  80842a:	85 c0                	test   %eax,%eax
+  80842c:	0f 85 dc 08 00 00    	jne    808d0e <nvme_init+0x993>
+    ctl->buffer = (void *)NVME_QUEUE_VADDR;
+  808432:	48 b8 80 60 8c 00 00 	movabs $0x8c6080,%rax
+  808439:	00 00 00 
+  80843c:	48 be 00 00 00 02 70 	movabs $0x7002000000,%rsi
+  808443:	00 00 00 
+  808446:	48 89 b0 a0 00 00 00 	mov    %rsi,0xa0(%rax)
+    ctl->prp_list = (void *)(NVME_QUEUE_VADDR + NVME_QUEUE_BUFFER_SIZE);
+  80844d:	48 b9 00 40 00 02 70 	movabs $0x7002004000,%rcx
+  808454:	00 00 00 
+  808457:	48 89 88 b0 00 00 00 	mov    %rcx,0xb0(%rax)
+    int r = sys_alloc_dma_region(CURENVID, ctl->buffer, NVME_QUEUE_BUFFER_CLASS, PROT_RW | PROT_CD, &ctl->buffer_pa);
+  80845e:	4c 8d 80 a8 00 00 00 	lea    0xa8(%rax),%r8
+  808465:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  80846a:	ba 02 00 00 00       	mov    $0x2,%edx
+  80846f:	bf 00 00 00 00       	mov    $0x0,%edi
+  808474:	48 b8 41 a3 80 00 00 	movabs $0x80a341,%rax
+  80847b:	00 00 00 
+  80847e:	ff d0                	call   *%rax
+    if (r < 0)
+  808480:	85 c0                	test   %eax,%eax
+  808482:	0f 88 1c 04 00 00    	js     8088a4 <nvme_init+0x529>
+    r = sys_alloc_dma_region(CURENVID, ctl->prp_list, NVME_PRP_LIST_CLASS, PROT_RW | PROT_CD, &ctl->prp_list_pa);
+  808488:	49 b8 38 61 8c 00 00 	movabs $0x8c6138,%r8
+  80848f:	00 00 00 
+  808492:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  808497:	ba 05 00 00 00       	mov    $0x5,%edx
+  80849c:	49 8d 40 f8          	lea    -0x8(%r8),%rax
+  8084a0:	48 8b 30             	mov    (%rax),%rsi
+  8084a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8084a8:	48 b8 41 a3 80 00 00 	movabs $0x80a341,%rax
+  8084af:	00 00 00 
+  8084b2:	ff d0                	call   *%rax
+    if (r < 0)
+  8084b4:	85 c0                	test   %eax,%eax
+  8084b6:	0f 88 12 04 00 00    	js     8088ce <nvme_init+0x553>
+    volatile uint8_t *base = ctl->mmio_base_addr;
+  8084bc:	48 b8 18 61 8c 00 00 	movabs $0x8c6118,%rax
+  8084c3:	00 00 00 
+  8084c6:	48 8b 18             	mov    (%rax),%rbx
+    if (!base) {
+  8084c9:	48 85 db             	test   %rbx,%rbx
+  8084cc:	0f 84 26 04 00 00    	je     8088f8 <nvme_init+0x57d>
+    while ((*NVME_REG32(ctl->mmio_base_addr, NVME_REG_CSTS) & NVME_CSTS_RDY) == 0)
+  8084d2:	8b 43 1c             	mov    0x1c(%rbx),%eax
+  8084d5:	48 ba 80 60 8c 00 00 	movabs $0x8c6080,%rdx
+  8084dc:	00 00 00 
+  8084df:	a8 01                	test   $0x1,%al
+  8084e1:	75 10                	jne    8084f3 <nvme_init+0x178>
+        asm volatile("pause");
+  8084e3:	f3 90                	pause
+    while ((*NVME_REG32(ctl->mmio_base_addr, NVME_REG_CSTS) & NVME_CSTS_RDY) == 0)
+  8084e5:	48 8b 82 98 00 00 00 	mov    0x98(%rdx),%rax
+  8084ec:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8084ef:	a8 01                	test   $0x1,%al
+  8084f1:	74 f0                	je     8084e3 <nvme_init+0x168>
+    *NVME_REG32(base, NVME_REG_CC) &= ~NVME_CC_EN;
+  8084f3:	8b 43 14             	mov    0x14(%rbx),%eax
+  8084f6:	83 e0 fe             	and    $0xfffffffe,%eax
+  8084f9:	89 43 14             	mov    %eax,0x14(%rbx)
+    volatile uint8_t *base = ctl->mmio_base_addr;
+  8084fc:	48 a1 18 61 8c 00 00 	movabs 0x8c6118,%rax
+  808503:	00 00 00 
+    union NvmeCapability cap = {.value = *NVME_REG64(base, NVME_REG_CAP)};
+  808506:	48 8b 10             	mov    (%rax),%rdx
+    if (!(cap.css & 1)) {
+  808509:	48 0f ba e2 25       	bt     $0x25,%rdx
+  80850e:	0f 83 ff 03 00 00    	jae    808913 <nvme_init+0x598>
+    ctl->ci.timeout = cap.to;    /* in 500ms units */
+  808514:	48 be 80 60 8c 00 00 	movabs $0x8c6080,%rsi
+  80851b:	00 00 00 
+  80851e:	48 89 d1             	mov    %rdx,%rcx
+  808521:	48 c1 e9 18          	shr    $0x18,%rcx
+  808525:	0f b6 c9             	movzbl %cl,%ecx
+  808528:	66 89 4e 6a          	mov    %cx,0x6a(%rsi)
+    ctl->ci.mpsmin = cap.mpsmin; /* 2 ^ (12 + MPSMIN) */
+  80852c:	48 89 d1             	mov    %rdx,%rcx
+  80852f:	48 c1 e9 30          	shr    $0x30,%rcx
+  808533:	83 e1 0f             	and    $0xf,%ecx
+  808536:	66 89 4e 6c          	mov    %cx,0x6c(%rsi)
+    ctl->ci.mpsmax = cap.mpsmax; /* 2 ^ (12 + MPSMAX) */
+  80853a:	48 89 d7             	mov    %rdx,%rdi
+  80853d:	48 c1 ef 34          	shr    $0x34,%rdi
+  808541:	83 e7 0f             	and    $0xf,%edi
+  808544:	66 89 7e 6e          	mov    %di,0x6e(%rsi)
+    ctl->ci.pageshift = 12 + ctl->ci.mpsmin;
+  808548:	83 c1 0c             	add    $0xc,%ecx
+  80854b:	66 89 4e 50          	mov    %cx,0x50(%rsi)
+    ctl->ci.pagesize = 1 << ctl->ci.pageshift;
+  80854f:	0f b7 f9             	movzwl %cx,%edi
+  808552:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  808558:	41 d3 e0             	shl    %cl,%r8d
+  80855b:	66 44 89 46 4e       	mov    %r8w,0x4e(%rsi)
+    ctl->ci.maxqsize = cap.mqes + 1;
+  808560:	0f b7 ca             	movzwl %dx,%ecx
+  808563:	83 c1 01             	add    $0x1,%ecx
+  808566:	89 4e 64             	mov    %ecx,0x64(%rsi)
+    ctl->ci.dbstride = 4 << cap.dstrd; /* in bytes */
+  808569:	48 89 d1             	mov    %rdx,%rcx
+  80856c:	48 c1 e9 20          	shr    $0x20,%rcx
+  808570:	83 e1 0f             	and    $0xf,%ecx
+  808573:	ba 04 00 00 00       	mov    $0x4,%edx
+  808578:	d3 e2                	shl    %cl,%edx
+  80857a:	66 89 56 68          	mov    %dx,0x68(%rsi)
+    ctl->ci.maxppio = ctl->ci.pagesize / sizeof(uint64_t);
+  80857e:	66 41 c1 e8 03       	shr    $0x3,%r8w
+  808583:	66 44 89 46 52       	mov    %r8w,0x52(%rsi)
+                      ((ctl->ci.pageshift - 12) << NVME_CC_MPS) |
+  808588:	83 ef 0c             	sub    $0xc,%edi
+  80858b:	c1 e7 07             	shl    $0x7,%edi
+                      (4 << NVME_CC_IOCQES) |
+  80858e:	81 cf 60 00 46 00    	or     $0x460060,%edi
+    *NVME_REG32(base, NVME_REG_CC) = new_cc;
+  808594:	89 78 14             	mov    %edi,0x14(%rax)
+    err = nvme_setup_admin_queue(ctl, NVME_QUEUE_SIZE, ctl->buffer, ctl->buffer + NVME_PAGE_SIZE);
+  808597:	48 8b 96 a0 00 00 00 	mov    0xa0(%rsi),%rdx
+    volatile uint8_t *base = ctl->mmio_base_addr;
+  80859e:	4c 8b ae 98 00 00 00 	mov    0x98(%rsi),%r13
+    assert(((uintptr_t)sqbuff & (NVME_PAGE_SIZE - 1)) == 0);
+  8085a5:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  8085ab:	0f 85 8c 03 00 00    	jne    80893d <nvme_init+0x5c2>
+    err = nvme_setup_admin_queue(ctl, NVME_QUEUE_SIZE, ctl->buffer, ctl->buffer + NVME_PAGE_SIZE);
+  8085b1:	4c 8d 82 00 10 00 00 	lea    0x1000(%rdx),%r8
+    assert(((uintptr_t)cqbuff & (NVME_PAGE_SIZE - 1)) == 0);
+  8085b8:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  8085be:	0f 85 ae 03 00 00    	jne    808972 <nvme_init+0x5f7>
+            .cq_doorbell = NVME_CQnHDBL(ctl, 0),
+  8085c4:	49 bc 80 60 8c 00 00 	movabs $0x8c6080,%r12
+  8085cb:	00 00 00 
+  8085ce:	41 0f b7 74 24 68    	movzwl 0x68(%r12),%esi
+  8085d4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    ctl->adminq = (struct NvmeQueueAttributes){
+  8085da:	49 8d bc 24 c0 00 00 	lea    0xc0(%r12),%rdi
+  8085e1:	00 
+  8085e2:	b9 18 00 00 00       	mov    $0x18,%ecx
+  8085e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8085ec:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8085ef:	41 c7 84 24 c4 00 00 	movl   $0x20,0xc4(%r12)
+  8085f6:	00 20 00 00 00 
+  8085fb:	49 89 94 24 c8 00 00 	mov    %rdx,0xc8(%r12)
+  808602:	00 
+  808603:	4d 89 84 24 d0 00 00 	mov    %r8,0xd0(%r12)
+  80860a:	00 
+  80860b:	41 c7 84 24 d8 00 00 	movl   $0x1000,0xd8(%r12)
+  808612:	00 00 10 00 00 
+  808617:	41 89 b4 24 dc 00 00 	mov    %esi,0xdc(%r12)
+  80861e:	00 
+    *NVME_REG32(base, NVME_REG_AQA) = ((NVME_QUEUE_SIZE - 1) << 16) + NVME_QUEUE_SIZE - 1;
+  80861f:	41 c7 45 24 1f 00 1f 	movl   $0x1f001f,0x24(%r13)
+  808626:	00 
+    *NVME_REG64(base, NVME_REG_ASQ) = get_phys_addr(adminq->sq);
+  808627:	49 8b bc 24 c8 00 00 	mov    0xc8(%r12),%rdi
+  80862e:	00 
+  80862f:	49 be a1 cf 80 00 00 	movabs $0x80cfa1,%r14
+  808636:	00 00 00 
+  808639:	41 ff d6             	call   *%r14
+  80863c:	49 89 45 28          	mov    %rax,0x28(%r13)
+    *NVME_REG64(base, NVME_REG_ACQ) = get_phys_addr(adminq->cq);
+  808640:	49 8b bc 24 d0 00 00 	mov    0xd0(%r12),%rdi
+  808647:	00 
+  808648:	41 ff d6             	call   *%r14
+  80864b:	49 89 45 30          	mov    %rax,0x30(%r13)
+    *NVME_REG32(base, NVME_REG_CC) |= NVME_CC_EN;
+  80864f:	8b 43 14             	mov    0x14(%rbx),%eax
+  808652:	83 c8 01             	or     $0x1,%eax
+  808655:	89 43 14             	mov    %eax,0x14(%rbx)
+    while ((*NVME_REG32(ctl->mmio_base_addr, NVME_REG_CSTS) & NVME_CSTS_RDY) == 0)
+  808658:	49 8b 84 24 98 00 00 	mov    0x98(%r12),%rax
+  80865f:	00 
+  808660:	8b 40 1c             	mov    0x1c(%rax),%eax
+  808663:	a8 01                	test   $0x1,%al
+  808665:	75 13                	jne    80867a <nvme_init+0x2ff>
+  808667:	4c 89 e2             	mov    %r12,%rdx
+        asm volatile("pause");
+  80866a:	f3 90                	pause
+    while ((*NVME_REG32(ctl->mmio_base_addr, NVME_REG_CSTS) & NVME_CSTS_RDY) == 0)
+  80866c:	48 8b 82 98 00 00 00 	mov    0x98(%rdx),%rax
+  808673:	8b 40 1c             	mov    0x1c(%rax),%eax
+  808676:	a8 01                	test   $0x1,%al
+  808678:	74 f0                	je     80866a <nvme_init+0x2ef>
+    cprintf("NVMe enabled\n");
+  80867a:	48 bf ed e9 80 00 00 	movabs $0x80e9ed,%rdi
+  808681:	00 00 00 
+  808684:	b8 00 00 00 00       	mov    $0x0,%eax
+  808689:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  808690:	00 00 00 
+  808693:	ff d2                	call   *%rdx
+    uint8_t *buff = ctl->buffer + NVME_PAGE_SIZE * 2;
+  808695:	48 bb 80 60 8c 00 00 	movabs $0x8c6080,%rbx
+  80869c:	00 00 00 
+  80869f:	4c 8b a3 a0 00 00 00 	mov    0xa0(%rbx),%r12
+  8086a6:	49 8d bc 24 00 20 00 	lea    0x2000(%r12),%rdi
+  8086ad:	00 
+    uintptr_t buff_pa = get_phys_addr(buff);
+  8086ae:	48 b8 a1 cf 80 00 00 	movabs $0x80cfa1,%rax
+  8086b5:	00 00 00 
+  8086b8:	ff d0                	call   *%rax
+  8086ba:	48 89 c2             	mov    %rax,%rdx
+    if (nvme_acmd_identify(ctl, 0, buff_pa, 0)) {
+  8086bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8086c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8086c7:	48 89 df             	mov    %rbx,%rdi
+  8086ca:	48 b8 ad 7d 80 00 00 	movabs $0x807dad,%rax
+  8086d1:	00 00 00 
+  8086d4:	ff d0                	call   *%rax
+  8086d6:	85 c0                	test   %eax,%eax
+  8086d8:	0f 85 72 01 00 00    	jne    808850 <nvme_init+0x4d5>
+    ci->nscount = idc->nn;
+  8086de:	41 8b 94 24 04 22 00 	mov    0x2204(%r12),%edx
+  8086e5:	00 
+  8086e6:	66 89 53 54          	mov    %dx,0x54(%rbx)
+    ci->vid = idc->vid;
+  8086ea:	41 0f b7 94 24 00 20 	movzwl 0x2000(%r12),%edx
+  8086f1:	00 00 
+  8086f3:	66 89 53 08          	mov    %dx,0x8(%rbx)
+    memcpy(dst, src, len);
+  8086f7:	ba 28 00 00 00       	mov    $0x28,%edx
+  8086fc:	48 8d 5b 0a          	lea    0xa(%rbx),%rbx
+  808700:	48 89 de             	mov    %rbx,%rsi
+  808703:	48 89 df             	mov    %rbx,%rdi
+  808706:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  80870d:	00 00 00 
+  808710:	ff d0                	call   *%rax
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  808712:	48 8d 43 27          	lea    0x27(%rbx),%rax
+  808716:	80 38 20             	cmpb   $0x20,(%rax)
+  808719:	75 0c                	jne    808727 <nvme_init+0x3ac>
+        dst[i] = 0;
+  80871b:	c6 00 00             	movb   $0x0,(%rax)
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  80871e:	48 83 e8 01          	sub    $0x1,%rax
+  808722:	48 39 c3             	cmp    %rax,%rbx
+  808725:	75 ef                	jne    808716 <nvme_init+0x39b>
+    memcpy(dst, src, len);
+  808727:	ba 14 00 00 00       	mov    $0x14,%edx
+  80872c:	48 bf b2 60 8c 00 00 	movabs $0x8c60b2,%rdi
+  808733:	00 00 00 
+  808736:	48 89 fe             	mov    %rdi,%rsi
+  808739:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  808740:	00 00 00 
+  808743:	ff d0                	call   *%rax
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  808745:	48 b8 c5 60 8c 00 00 	movabs $0x8c60c5,%rax
+  80874c:	00 00 00 
+  80874f:	48 8d 50 ed          	lea    -0x13(%rax),%rdx
+  808753:	80 38 20             	cmpb   $0x20,(%rax)
+  808756:	75 0c                	jne    808764 <nvme_init+0x3e9>
+        dst[i] = 0;
+  808758:	c6 00 00             	movb   $0x0,(%rax)
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  80875b:	48 83 e8 01          	sub    $0x1,%rax
+  80875f:	48 39 d0             	cmp    %rdx,%rax
+  808762:	75 ef                	jne    808753 <nvme_init+0x3d8>
+    memcpy(dst, src, len);
+  808764:	ba 08 00 00 00       	mov    $0x8,%edx
+  808769:	48 bf c6 60 8c 00 00 	movabs $0x8c60c6,%rdi
+  808770:	00 00 00 
+  808773:	48 89 fe             	mov    %rdi,%rsi
+  808776:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  80877d:	00 00 00 
+  808780:	ff d0                	call   *%rax
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  808782:	48 b8 cd 60 8c 00 00 	movabs $0x8c60cd,%rax
+  808789:	00 00 00 
+  80878c:	48 8d 50 f9          	lea    -0x7(%rax),%rdx
+  808790:	80 38 20             	cmpb   $0x20,(%rax)
+  808793:	75 0c                	jne    8087a1 <nvme_init+0x426>
+        dst[i] = 0;
+  808795:	c6 00 00             	movb   $0x0,(%rax)
+    for (size_t i = len - 1; i > 0 && dst[i] == ' '; i--)
+  808798:	48 83 e8 01          	sub    $0x1,%rax
+  80879c:	48 39 c2             	cmp    %rax,%rdx
+  80879f:	75 ef                	jne    808790 <nvme_init+0x415>
+    if (idc->mdts) {
+  8087a1:	41 0f b6 8c 24 4d 20 	movzbl 0x204d(%r12),%ecx
+  8087a8:	00 00 
+  8087aa:	84 c9                	test   %cl,%cl
+  8087ac:	74 26                	je     8087d4 <nvme_init+0x459>
+        int mp = 2 << (idc->mdts - 1);
+  8087ae:	83 e9 01             	sub    $0x1,%ecx
+  8087b1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8087b6:	d3 e0                	shl    %cl,%eax
+        if (ci->maxppio > mp)
+  8087b8:	48 ba 80 60 8c 00 00 	movabs $0x8c6080,%rdx
+  8087bf:	00 00 00 
+  8087c2:	0f b7 52 52          	movzwl 0x52(%rdx),%edx
+  8087c6:	39 d0                	cmp    %edx,%eax
+  8087c8:	7d 0a                	jge    8087d4 <nvme_init+0x459>
+            ci->maxppio = mp;
+  8087ca:	66 a3 d2 60 8c 00 00 	movabs %ax,0x8c60d2
+  8087d1:	00 00 00 
+    int cid = adminq->sq_tail;
+  8087d4:	49 bd 80 60 8c 00 00 	movabs $0x8c6080,%r13
+  8087db:	00 00 00 
+  8087de:	45 8b b5 e4 00 00 00 	mov    0xe4(%r13),%r14d
+    struct NvmeACmdGetFeatures *cmd = &adminq->sq[cid].get_features;
+  8087e5:	4d 63 e6             	movslq %r14d,%r12
+  8087e8:	4c 89 e3             	mov    %r12,%rbx
+  8087eb:	48 c1 e3 06          	shl    $0x6,%rbx
+  8087ef:	49 03 9d c8 00 00 00 	add    0xc8(%r13),%rbx
+    memset(cmd, 0, sizeof(*cmd));
+  8087f6:	ba 40 00 00 00       	mov    $0x40,%edx
+  8087fb:	be 00 00 00 00       	mov    $0x0,%esi
+  808800:	48 89 df             	mov    %rbx,%rdi
+  808803:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  80880a:	00 00 00 
+  80880d:	ff d0                	call   *%rax
+    cmd->common.opc = NVME_ACMD_GET_FEATURES;
+  80880f:	c6 03 0a             	movb   $0xa,(%rbx)
+    cmd->common.cid = cid;
+  808812:	66 44 89 73 02       	mov    %r14w,0x2(%rbx)
+    cmd->common.nsid = nsid;
+  808817:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    cmd->common.prp[0] = prp1;
+  80881e:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  808825:	00 
+    cmd->common.prp[1] = prp2;
+  808826:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80882d:	00 
+    cmd->fid = fid;
+  80882e:	c6 43 28 07          	movb   $0x7,0x28(%rbx)
+    int err = nvme_submit_cmd(ctl, adminq);
+  808832:	49 8d b5 c0 00 00 00 	lea    0xc0(%r13),%rsi
+  808839:	4c 89 ef             	mov    %r13,%rdi
+  80883c:	48 b8 8a 7d 80 00 00 	movabs $0x807d8a,%rax
+  808843:	00 00 00 
+  808846:	ff d0                	call   *%rax
+    if (err)
+  808848:	85 c0                	test   %eax,%eax
+  80884a:	0f 84 57 01 00 00    	je     8089a7 <nvme_init+0x62c>
+        panic("NVMe contoller identification failed\n");
+  808850:	48 ba b0 ea 80 00 00 	movabs $0x80eab0,%rdx
+  808857:	00 00 00 
+  80885a:	be 4c 01 00 00       	mov    $0x14c,%esi
+  80885f:	48 bf 9e e9 80 00 00 	movabs $0x80e99e,%rdi
+  808866:	00 00 00 
+  808869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80886e:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  808875:	00 00 00 
+  808878:	ff d1                	call   *%rcx
+        panic("NVMe device not found\n");
+  80887a:	48 ba 87 e9 80 00 00 	movabs $0x80e987,%rdx
+  808881:	00 00 00 
+  808884:	be 3a 01 00 00       	mov    $0x13a,%esi
+  808889:	48 bf 9e e9 80 00 00 	movabs $0x80e99e,%rdi
+  808890:	00 00 00 
+  808893:	b8 00 00 00 00       	mov    $0x0,%eax
+  808898:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  80889f:	00 00 00 
+  8088a2:	ff d1                	call   *%rcx
+        panic("queue alloc failed");
+  8088a4:	48 ba a8 e9 80 00 00 	movabs $0x80e9a8,%rdx
+  8088ab:	00 00 00 
+  8088ae:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8088b3:	48 bf 9e e9 80 00 00 	movabs $0x80e99e,%rdi
+  8088ba:	00 00 00 
+  8088bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8088c2:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  8088c9:	00 00 00 
+  8088cc:	ff d1                	call   *%rcx
+        panic("PRP list alloc failed");
+  8088ce:	48 ba bb e9 80 00 00 	movabs $0x80e9bb,%rdx
+  8088d5:	00 00 00 
+  8088d8:	be 33 00 00 00       	mov    $0x33,%esi
+  8088dd:	48 bf 9e e9 80 00 00 	movabs $0x80e99e,%rdi
+  8088e4:	00 00 00 
+  8088e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8088ec:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  8088f3:	00 00 00 
+  8088f6:	ff d1                	call   *%rcx
+        cprintf("NVMe device is not mapped!\n");
+  8088f8:	48 bf d1 e9 80 00 00 	movabs $0x80e9d1,%rdi
+  8088ff:	00 00 00 
+  808902:	b8 00 00 00 00       	mov    $0x0,%eax
+  808907:	48 ba 35 91 80 00 00 	movabs $0x809135,%rdx
+  80890e:	00 00 00 
+  808911:	ff d2                	call   *%rdx
+        panic("NVMe device initialization failed\n");
+  808913:	48 ba d8 ea 80 00 00 	movabs $0x80ead8,%rdx
+  80891a:	00 00 00 
+  80891d:	be 48 01 00 00       	mov    $0x148,%esi
+  808922:	48 bf 9e e9 80 00 00 	movabs $0x80e99e,%rdi
+  808929:	00 00 00 
+  80892c:	b8 00 00 00 00       	mov    $0x0,%eax
+  808931:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  808938:	00 00 00 
+  80893b:	ff d1                	call   *%rcx
+    assert(((uintptr_t)sqbuff & (NVME_PAGE_SIZE - 1)) == 0);
+  80893d:	48 b9 00 ea 80 00 00 	movabs $0x80ea00,%rcx
+  808944:	00 00 00 
+  808947:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  80894e:	00 00 00 
+  808951:	be 59 00 00 00       	mov    $0x59,%esi
+  808956:	48 bf 9e e9 80 00 00 	movabs $0x80e99e,%rdi
+  80895d:	00 00 00 
+  808960:	b8 00 00 00 00       	mov    $0x0,%eax
+  808965:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  80896c:	00 00 00 
+  80896f:	41 ff d0             	call   *%r8
+    assert(((uintptr_t)cqbuff & (NVME_PAGE_SIZE - 1)) == 0);
+  808972:	48 b9 30 ea 80 00 00 	movabs $0x80ea30,%rcx
+  808979:	00 00 00 
+  80897c:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  808983:	00 00 00 
+  808986:	be 5a 00 00 00       	mov    $0x5a,%esi
+  80898b:	48 bf 9e e9 80 00 00 	movabs $0x80e99e,%rdi
+  808992:	00 00 00 
+  808995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80899a:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  8089a1:	00 00 00 
+  8089a4:	41 ff d0             	call   *%r8
+    err = nvme_wait_completion(ctl, adminq, cid, 30);
+  8089a7:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  8089ac:	44 89 f2             	mov    %r14d,%edx
+  8089af:	49 8d b5 c0 00 00 00 	lea    0xc0(%r13),%rsi
+  8089b6:	4c 89 ef             	mov    %r13,%rdi
+  8089b9:	48 b8 bb 7c 80 00 00 	movabs $0x807cbb,%rax
+  8089c0:	00 00 00 
+  8089c3:	ff d0                	call   *%rax
+    if (err)
+  8089c5:	85 c0                	test   %eax,%eax
+  8089c7:	0f 85 83 fe ff ff    	jne    808850 <nvme_init+0x4d5>
+    *res = adminq->cq[cid].cs;
+  8089cd:	4c 89 eb             	mov    %r13,%rbx
+  8089d0:	4c 89 e0             	mov    %r12,%rax
+  8089d3:	48 c1 e0 04          	shl    $0x4,%rax
+  8089d7:	49 03 85 d0 00 00 00 	add    0xd0(%r13),%rax
+  8089de:	8b 10                	mov    (%rax),%edx
+    ci->maxqcount = (qnum.nsq < qnum.ncq ? qnum.nsq : qnum.ncq) + 1;
+  8089e0:	89 d0                	mov    %edx,%eax
+  8089e2:	c1 e8 10             	shr    $0x10,%eax
+  8089e5:	66 39 d0             	cmp    %dx,%ax
+  8089e8:	0f 47 c2             	cmova  %edx,%eax
+  8089eb:	0f b7 c0             	movzwl %ax,%eax
+  8089ee:	83 c0 01             	add    $0x1,%eax
+  8089f1:	41 89 45 60          	mov    %eax,0x60(%r13)
+    ci->qcount = MIN(ci->maxqcount, NVME_QUEUE_COUNT);
+  8089f5:	41 c7 45 58 01 00 00 	movl   $0x1,0x58(%r13)
+  8089fc:	00 
+    ci->qsize = MIN(ci->maxqsize, NVME_QUEUE_SIZE);
+  8089fd:	41 8b 45 64          	mov    0x64(%r13),%eax
+  808a01:	ba 20 00 00 00       	mov    $0x20,%edx
+  808a06:	39 d0                	cmp    %edx,%eax
+  808a08:	0f 47 c2             	cmova  %edx,%eax
+  808a0b:	41 89 45 5c          	mov    %eax,0x5c(%r13)
+    uint8_t *buff = ctl->buffer + NVME_PAGE_SIZE * 2;
+  808a0f:	4d 8b a5 a0 00 00 00 	mov    0xa0(%r13),%r12
+  808a16:	49 8d bc 24 00 20 00 	lea    0x2000(%r12),%rdi
+  808a1d:	00 
+    uintptr_t buff_pa = get_phys_addr(buff);
+  808a1e:	48 b8 a1 cf 80 00 00 	movabs $0x80cfa1,%rax
+  808a25:	00 00 00 
+  808a28:	ff d0                	call   *%rax
+  808a2a:	48 89 c2             	mov    %rax,%rdx
+    if (nvme_acmd_identify(ctl, id, buff_pa, 0)) {
+  808a2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  808a32:	be 01 00 00 00       	mov    $0x1,%esi
+  808a37:	4c 89 ef             	mov    %r13,%rdi
+  808a3a:	48 b8 ad 7d 80 00 00 	movabs $0x807dad,%rax
+  808a41:	00 00 00 
+  808a44:	ff d0                	call   *%rax
+  808a46:	85 c0                	test   %eax,%eax
+  808a48:	0f 85 96 02 00 00    	jne    808ce4 <nvme_init+0x969>
+    ns->id = id;
+  808a4e:	66 41 c7 45 70 01 00 	movw   $0x1,0x70(%r13)
+    ns->blockcount = idns->ncap;
+  808a55:	49 8b 84 24 08 20 00 	mov    0x2008(%r12),%rax
+  808a5c:	00 
+  808a5d:	49 89 45 78          	mov    %rax,0x78(%r13)
+    ns->blockshift = idns->lbaf[idns->flbas & 0xF].lbads;
+  808a61:	41 0f b6 94 24 1a 20 	movzbl 0x201a(%r12),%edx
+  808a68:	00 00 
+  808a6a:	83 e2 0f             	and    $0xf,%edx
+  808a6d:	41 0f b6 8c 94 82 20 	movzbl 0x2082(%r12,%rdx,4),%ecx
+  808a74:	00 00 
+  808a76:	0f b6 f1             	movzbl %cl,%esi
+  808a79:	66 41 89 b5 8a 00 00 	mov    %si,0x8a(%r13)
+  808a80:	00 
+    ns->blocksize = 1 << ns->blockshift;
+  808a81:	ba 01 00 00 00       	mov    $0x1,%edx
+  808a86:	89 d7                	mov    %edx,%edi
+  808a88:	d3 e7                	shl    %cl,%edi
+  808a8a:	66 41 89 bd 88 00 00 	mov    %di,0x88(%r13)
+  808a91:	00 
+    ns->bpshift = ctl->ci.pageshift - ns->blockshift;
+  808a92:	41 0f b7 4d 50       	movzwl 0x50(%r13),%ecx
+  808a97:	29 f1                	sub    %esi,%ecx
+  808a99:	66 41 89 8d 8c 00 00 	mov    %cx,0x8c(%r13)
+  808aa0:	00 
+    ns->nbpp = 1 << ns->bpshift;
+  808aa1:	d3 e2                	shl    %cl,%edx
+  808aa3:	66 41 89 95 8e 00 00 	mov    %dx,0x8e(%r13)
+  808aaa:	00 
+    ns->pagecount = ns->blockcount >> ns->bpshift;
+  808aab:	48 d3 e8             	shr    %cl,%rax
+  808aae:	49 89 85 80 00 00 00 	mov    %rax,0x80(%r13)
+    ns->maxbpio = ctl->ci.maxppio << ns->bpshift;
+  808ab5:	41 0f b7 45 52       	movzwl 0x52(%r13),%eax
+  808aba:	d3 e0                	shl    %cl,%eax
+  808abc:	66 41 89 85 90 00 00 	mov    %ax,0x90(%r13)
+  808ac3:	00 
+    uint8_t *sqbuff = ctl->buffer + NVME_PAGE_SIZE * (2 * (qid + 1));
+  808ac4:	49 8b 95 a0 00 00 00 	mov    0xa0(%r13),%rdx
+  808acb:	4c 8d aa 00 20 00 00 	lea    0x2000(%rdx),%r13
+    uint8_t *cqbuff = ctl->buffer + NVME_PAGE_SIZE * (2 * (qid + 1) + 1);
+  808ad2:	48 81 c2 00 30 00 00 	add    $0x3000,%rdx
+            .sq_doorbell = NVME_SQnTDBL(ctl, qid + 1),
+  808ad9:	0f b7 73 68          	movzwl 0x68(%rbx),%esi
+    *ioq = (struct NvmeQueueAttributes){
+  808add:	48 8d bb a0 01 00 00 	lea    0x1a0(%rbx),%rdi
+  808ae4:	b9 14 00 00 00       	mov    $0x14,%ecx
+  808ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+  808aee:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  808af1:	c7 83 80 01 00 00 01 	movl   $0x1,0x180(%rbx)
+  808af8:	00 00 00 
+  808afb:	c7 83 84 01 00 00 20 	movl   $0x20,0x184(%rbx)
+  808b02:	00 00 00 
+  808b05:	4c 89 ab 88 01 00 00 	mov    %r13,0x188(%rbx)
+  808b0c:	48 89 93 90 01 00 00 	mov    %rdx,0x190(%rbx)
+            .sq_doorbell = NVME_SQnTDBL(ctl, qid + 1),
+  808b13:	8d 84 36 00 10 00 00 	lea    0x1000(%rsi,%rsi,1),%eax
+  808b1a:	89 83 98 01 00 00    	mov    %eax,0x198(%rbx)
+            .cq_doorbell = NVME_CQnHDBL(ctl, qid + 1),
+  808b20:	8d 84 76 00 10 00 00 	lea    0x1000(%rsi,%rsi,2),%eax
+  808b27:	89 83 9c 01 00 00    	mov    %eax,0x19c(%rbx)
+    int err = nvme_acmd_create_cq(ctl, ioq, get_phys_addr(cqbuff));
+  808b2d:	48 89 d7             	mov    %rdx,%rdi
+  808b30:	48 b8 a1 cf 80 00 00 	movabs $0x80cfa1,%rax
+  808b37:	00 00 00 
+  808b3a:	ff d0                	call   *%rax
+  808b3c:	49 89 c7             	mov    %rax,%r15
+    int cid = adminq->sq_tail;
+  808b3f:	44 8b b3 e4 00 00 00 	mov    0xe4(%rbx),%r14d
+    struct NvmeACmdCreateCompletionQueue *cmd = &adminq->sq[cid].create_cq;
+  808b46:	4d 63 e6             	movslq %r14d,%r12
+  808b49:	49 c1 e4 06          	shl    $0x6,%r12
+  808b4d:	4c 03 a3 c8 00 00 00 	add    0xc8(%rbx),%r12
+    memset(cmd, 0, sizeof(*cmd));
+  808b54:	ba 40 00 00 00       	mov    $0x40,%edx
+  808b59:	be 00 00 00 00       	mov    $0x0,%esi
+  808b5e:	4c 89 e7             	mov    %r12,%rdi
+  808b61:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  808b68:	00 00 00 
+  808b6b:	ff d0                	call   *%rax
+    cmd->common.opc = NVME_ACMD_CREATE_CQ;
+  808b6d:	41 c6 04 24 05       	movb   $0x5,(%r12)
+    cmd->common.cid = cid;
+  808b72:	66 45 89 74 24 02    	mov    %r14w,0x2(%r12)
+    cmd->common.prp[0] = prp;
+  808b78:	4d 89 7c 24 18       	mov    %r15,0x18(%r12)
+    cmd->pc = 1;
+  808b7d:	41 80 4c 24 2c 01    	orb    $0x1,0x2c(%r12)
+    cmd->qid = ioq->id;
+  808b83:	8b 83 80 01 00 00    	mov    0x180(%rbx),%eax
+  808b89:	66 41 89 44 24 28    	mov    %ax,0x28(%r12)
+    cmd->qsize = ioq->size - 1;
+  808b8f:	0f b7 83 84 01 00 00 	movzwl 0x184(%rbx),%eax
+  808b96:	83 e8 01             	sub    $0x1,%eax
+  808b99:	66 41 89 44 24 2a    	mov    %ax,0x2a(%r12)
+    int err = nvme_submit_cmd(ctl, adminq);
+  808b9f:	48 8d b3 c0 00 00 00 	lea    0xc0(%rbx),%rsi
+  808ba6:	48 89 df             	mov    %rbx,%rdi
+  808ba9:	48 b8 8a 7d 80 00 00 	movabs $0x807d8a,%rax
+  808bb0:	00 00 00 
+  808bb3:	ff d0                	call   *%rax
+    if (err)
+  808bb5:	85 c0                	test   %eax,%eax
+  808bb7:	74 2a                	je     808be3 <nvme_init+0x868>
+        panic("NVMe queue initialization failed\n");
+  808bb9:	48 ba 60 ea 80 00 00 	movabs $0x80ea60,%rdx
+  808bc0:	00 00 00 
+  808bc3:	be 54 01 00 00       	mov    $0x154,%esi
+  808bc8:	48 bf 9e e9 80 00 00 	movabs $0x80e99e,%rdi
+  808bcf:	00 00 00 
+  808bd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  808bd7:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  808bde:	00 00 00 
+  808be1:	ff d1                	call   *%rcx
+    err = nvme_wait_completion(ctl, adminq, cid, 300);
+  808be3:	b9 2c 01 00 00       	mov    $0x12c,%ecx
+  808be8:	44 89 f2             	mov    %r14d,%edx
+  808beb:	48 8d b3 c0 00 00 00 	lea    0xc0(%rbx),%rsi
+  808bf2:	48 89 df             	mov    %rbx,%rdi
+  808bf5:	48 b8 bb 7c 80 00 00 	movabs $0x807cbb,%rax
+  808bfc:	00 00 00 
+  808bff:	ff d0                	call   *%rax
+    if (err) {
+  808c01:	85 c0                	test   %eax,%eax
+  808c03:	75 b4                	jne    808bb9 <nvme_init+0x83e>
+    err = nvme_acmd_create_sq(ctl, ioq, get_phys_addr(sqbuff));
+  808c05:	4c 89 ef             	mov    %r13,%rdi
+  808c08:	48 b8 a1 cf 80 00 00 	movabs $0x80cfa1,%rax
+  808c0f:	00 00 00 
+  808c12:	ff d0                	call   *%rax
+  808c14:	49 89 c6             	mov    %rax,%r14
+    int cid = adminq->sq_tail;
+  808c17:	49 89 dc             	mov    %rbx,%r12
+  808c1a:	44 8b ab e4 00 00 00 	mov    0xe4(%rbx),%r13d
+    struct NvmeACmdCreateSubmissionQueue *cmd = &adminq->sq[cid].create_sq;
+  808c21:	49 63 dd             	movslq %r13d,%rbx
+  808c24:	48 c1 e3 06          	shl    $0x6,%rbx
+  808c28:	49 03 9c 24 c8 00 00 	add    0xc8(%r12),%rbx
+  808c2f:	00 
+    memset(cmd, 0, sizeof(*cmd));
+  808c30:	ba 40 00 00 00       	mov    $0x40,%edx
+  808c35:	be 00 00 00 00       	mov    $0x0,%esi
+  808c3a:	48 89 df             	mov    %rbx,%rdi
+  808c3d:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  808c44:	00 00 00 
+  808c47:	ff d0                	call   *%rax
+    cmd->common.opc = NVME_ACMD_CREATE_SQ;
+  808c49:	c6 03 01             	movb   $0x1,(%rbx)
+    cmd->common.cid = cid;
+  808c4c:	66 44 89 6b 02       	mov    %r13w,0x2(%rbx)
+    cmd->common.prp[0] = prp;
+  808c51:	4c 89 73 18          	mov    %r14,0x18(%rbx)
+    cmd->qprio = 2; // 0=urgent 1=high 2=medium 3=low
+  808c55:	0f b6 43 2c          	movzbl 0x2c(%rbx),%eax
+  808c59:	83 e0 f9             	and    $0xfffffff9,%eax
+  808c5c:	83 c8 05             	or     $0x5,%eax
+  808c5f:	88 43 2c             	mov    %al,0x2c(%rbx)
+    cmd->qid = ioq->id;
+  808c62:	41 8b 84 24 80 01 00 	mov    0x180(%r12),%eax
+  808c69:	00 
+  808c6a:	66 89 43 28          	mov    %ax,0x28(%rbx)
+    cmd->cqid = ioq->id;
+  808c6e:	41 8b 84 24 80 01 00 	mov    0x180(%r12),%eax
+  808c75:	00 
+  808c76:	66 89 43 2e          	mov    %ax,0x2e(%rbx)
+    cmd->qsize = ioq->size - 1;
+  808c7a:	41 0f b7 84 24 84 01 	movzwl 0x184(%r12),%eax
+  808c81:	00 00 
+  808c83:	83 e8 01             	sub    $0x1,%eax
+  808c86:	66 89 43 2a          	mov    %ax,0x2a(%rbx)
+    int err = nvme_submit_cmd(ctl, adminq);
+  808c8a:	49 8d b4 24 c0 00 00 	lea    0xc0(%r12),%rsi
+  808c91:	00 
+  808c92:	4c 89 e7             	mov    %r12,%rdi
+  808c95:	48 b8 8a 7d 80 00 00 	movabs $0x807d8a,%rax
+  808c9c:	00 00 00 
+  808c9f:	ff d0                	call   *%rax
+    if (err)
+  808ca1:	85 c0                	test   %eax,%eax
+  808ca3:	0f 85 10 ff ff ff    	jne    808bb9 <nvme_init+0x83e>
+    err = nvme_wait_completion(ctl, adminq, cid, 30);
+  808ca9:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+  808cae:	44 89 ea             	mov    %r13d,%edx
+  808cb1:	49 8d b4 24 c0 00 00 	lea    0xc0(%r12),%rsi
+  808cb8:	00 
+  808cb9:	4c 89 e7             	mov    %r12,%rdi
+  808cbc:	48 b8 bb 7c 80 00 00 	movabs $0x807cbb,%rax
+  808cc3:	00 00 00 
+  808cc6:	ff d0                	call   *%rax
+    if (err) {
+  808cc8:	85 c0                	test   %eax,%eax
+  808cca:	0f 85 e9 fe ff ff    	jne    808bb9 <nvme_init+0x83e>
+}
+  808cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  808cd5:	48 83 c4 08          	add    $0x8,%rsp
+  808cd9:	5b                   	pop    %rbx
+  808cda:	41 5c                	pop    %r12
+  808cdc:	41 5d                	pop    %r13
+  808cde:	41 5e                	pop    %r14
+  808ce0:	41 5f                	pop    %r15
+  808ce2:	5d                   	pop    %rbp
+  808ce3:	c3                   	ret
+        panic("NVMe namespace identification failed\n");
+  808ce4:	48 ba 88 ea 80 00 00 	movabs $0x80ea88,%rdx
+  808ceb:	00 00 00 
+  808cee:	be 50 01 00 00       	mov    $0x150,%esi
+  808cf3:	48 bf 9e e9 80 00 00 	movabs $0x80e99e,%rdi
+  808cfa:	00 00 00 
+  808cfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  808d02:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  808d09:	00 00 00 
+  808d0c:	ff d1                	call   *%rcx
+        panic("NVMe registers mapping failed\n");
+  808d0e:	48 ba 00 eb 80 00 00 	movabs $0x80eb00,%rdx
+  808d15:	00 00 00 
+  808d18:	be 40 01 00 00       	mov    $0x140,%esi
+  808d1d:	48 bf 9e e9 80 00 00 	movabs $0x80e99e,%rdi
+  808d24:	00 00 00 
+  808d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  808d2c:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  808d33:	00 00 00 
+  808d36:	ff d1                	call   *%rcx
+
+0000000000808d38 <nvme_write>:
+
+int
+nvme_write(uint64_t secno, const void *src, size_t nsecs) {
+    if (!src)
+  808d38:	48 85 f6             	test   %rsi,%rsi
+  808d3b:	74 2a                	je     808d67 <nvme_write+0x2f>
+nvme_write(uint64_t secno, const void *src, size_t nsecs) {
+  808d3d:	55                   	push   %rbp
+  808d3e:	48 89 e5             	mov    %rsp,%rbp
+  808d41:	49 89 f0             	mov    %rsi,%r8
+  808d44:	48 89 d1             	mov    %rdx,%rcx
+        return -NVME_BAD_ARG;
+
+    return nvme_rw_sync(&nvme, NVME_CMD_WRITE, secno, nsecs, src);
+  808d47:	48 89 fa             	mov    %rdi,%rdx
+  808d4a:	be 01 00 00 00       	mov    $0x1,%esi
+  808d4f:	48 bf 80 60 8c 00 00 	movabs $0x8c6080,%rdi
+  808d56:	00 00 00 
+  808d59:	48 b8 21 82 80 00 00 	movabs $0x808221,%rax
+  808d60:	00 00 00 
+  808d63:	ff d0                	call   *%rax
+}
+  808d65:	5d                   	pop    %rbp
+  808d66:	c3                   	ret
+        return -NVME_BAD_ARG;
+  808d67:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  808d6c:	c3                   	ret
+
+0000000000808d6d <nvme_read>:
+
+int
+nvme_read(uint64_t secno, void *dst, size_t nsecs) {
+    if (!dst)
+  808d6d:	48 85 f6             	test   %rsi,%rsi
+  808d70:	74 2a                	je     808d9c <nvme_read+0x2f>
+nvme_read(uint64_t secno, void *dst, size_t nsecs) {
+  808d72:	55                   	push   %rbp
+  808d73:	48 89 e5             	mov    %rsp,%rbp
+  808d76:	49 89 f0             	mov    %rsi,%r8
+  808d79:	48 89 d1             	mov    %rdx,%rcx
+        return -NVME_BAD_ARG;
+
+    return nvme_rw_sync(&nvme, NVME_CMD_READ, secno, nsecs, dst);
+  808d7c:	48 89 fa             	mov    %rdi,%rdx
+  808d7f:	be 02 00 00 00       	mov    $0x2,%esi
+  808d84:	48 bf 80 60 8c 00 00 	movabs $0x8c6080,%rdi
+  808d8b:	00 00 00 
+  808d8e:	48 b8 21 82 80 00 00 	movabs $0x808221,%rax
+  808d95:	00 00 00 
+  808d98:	ff d0                	call   *%rax
+}
+  808d9a:	5d                   	pop    %rbp
+  808d9b:	c3                   	ret
+        return -NVME_BAD_ARG;
+  808d9c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  808da1:	c3                   	ret
+
+0000000000808da2 <nvme_flush>:
+
+/* Make writes completed so far durable: controller with
+ * volatile write cache may keep them in any order until then */
+int
+nvme_flush(void) {
+  808da2:	55                   	push   %rbp
+  808da3:	48 89 e5             	mov    %rsp,%rbp
+    return nvme_rw_sync(&nvme, NVME_CMD_FLUSH, 0, 0, NULL);
+  808da6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808dac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  808db1:	ba 00 00 00 00       	mov    $0x0,%edx
+  808db6:	be 00 00 00 00       	mov    $0x0,%esi
+  808dbb:	48 bf 80 60 8c 00 00 	movabs $0x8c6080,%rdi
+  808dc2:	00 00 00 
+  808dc5:	48 b8 21 82 80 00 00 	movabs $0x808221,%rax
+  808dcc:	00 00 00 
+  808dcf:	ff d0                	call   *%rax
+}
+  808dd1:	5d                   	pop    %rbp
+  808dd2:	c3                   	ret
+
+0000000000808dd3 <nvme_read_async>:
+
+/* Submit NVME_CMD_READ without waiting for it.
+ * Returns command tag to be reported by nvme_poll(), < 0 on error. */
+int
+nvme_read_async(uint64_t secno, void *dst, size_t nsecs) {
+    if (!dst)
+  808dd3:	48 85 f6             	test   %rsi,%rsi
+  808dd6:	74 61                	je     808e39 <nvme_read_async+0x66>
+nvme_read_async(uint64_t secno, void *dst, size_t nsecs) {
+  808dd8:	55                   	push   %rbp
+  808dd9:	48 89 e5             	mov    %rsp,%rbp
+  808ddc:	49 89 f8             	mov    %rdi,%r8
+    asm volatile("pushfq; popq %0"
+  808ddf:	9c                   	pushf
+  808de0:	58                   	pop    %rax
+        return -NVME_BAD_ARG;
+
+    int IF = read_rflags() & FL_IF;
+    if (IF)
+  808de1:	f6 c4 02             	test   $0x2,%ah
+  808de4:	74 59                	je     808e3f <nvme_read_async+0x6c>
+        asm volatile("cli");
+  808de6:	fa                   	cli
+
+    int tag = nvme_cmd_rw(&nvme, &nvme.ioq[0], NVME_CMD_READ, nvme.nsi.id, secno, nsecs, dst);
+  808de7:	48 bf 80 60 8c 00 00 	movabs $0x8c6080,%rdi
+  808dee:	00 00 00 
+  808df1:	0f b7 4f 70          	movzwl 0x70(%rdi),%ecx
+  808df5:	48 83 ec 08          	sub    $0x8,%rsp
+  808df9:	56                   	push   %rsi
+  808dfa:	41 89 d1             	mov    %edx,%r9d
+  808dfd:	ba 02 00 00 00       	mov    $0x2,%edx
+  808e02:	48 8d b7 80 01 00 00 	lea    0x180(%rdi),%rsi
+  808e09:	48 b8 6a 7e 80 00 00 	movabs $0x807e6a,%rax
+  808e10:	00 00 00 
+  808e13:	ff d0                	call   *%rax
+    if (tag >= 0)
+  808e15:	48 83 c4 10          	add    $0x10,%rsp
+  808e19:	85 c0                	test   %eax,%eax
+  808e1b:	78 19                	js     808e36 <nvme_read_async+0x63>
+        nvme.ioq[0].async |= 1U << tag;
+  808e1d:	48 be 80 60 8c 00 00 	movabs $0x8c6080,%rsi
+  808e24:	00 00 00 
+  808e27:	ba 01 00 00 00       	mov    $0x1,%edx
+  808e2c:	89 c1                	mov    %eax,%ecx
+  808e2e:	d3 e2                	shl    %cl,%edx
+  808e30:	09 96 b4 01 00 00    	or     %edx,0x1b4(%rsi)
+
+    if (IF)
+        asm volatile("sti");
+  808e36:	fb                   	sti
+
+    return tag;
+}
+  808e37:	c9                   	leave
+  808e38:	c3                   	ret
+        return -NVME_BAD_ARG;
+  808e39:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  808e3e:	c3                   	ret
+    int tag = nvme_cmd_rw(&nvme, &nvme.ioq[0], NVME_CMD_READ, nvme.nsi.id, secno, nsecs, dst);
+  808e3f:	48 bf 80 60 8c 00 00 	movabs $0x8c6080,%rdi
+  808e46:	00 00 00 
+  808e49:	0f b7 4f 70          	movzwl 0x70(%rdi),%ecx
+  808e4d:	48 83 ec 08          	sub    $0x8,%rsp
+  808e51:	56                   	push   %rsi
+  808e52:	41 89 d1             	mov    %edx,%r9d
+  808e55:	ba 02 00 00 00       	mov    $0x2,%edx
+  808e5a:	48 8d b7 80 01 00 00 	lea    0x180(%rdi),%rsi
+  808e61:	48 b8 6a 7e 80 00 00 	movabs $0x807e6a,%rax
+  808e68:	00 00 00 
+  808e6b:	ff d0                	call   *%rax
+    if (tag >= 0)
+  808e6d:	48 83 c4 10          	add    $0x10,%rsp
+  808e71:	85 c0                	test   %eax,%eax
+  808e73:	78 c2                	js     808e37 <nvme_read_async+0x64>
+        nvme.ioq[0].async |= 1U << tag;
+  808e75:	48 be 80 60 8c 00 00 	movabs $0x8c6080,%rsi
+  808e7c:	00 00 00 
+  808e7f:	ba 01 00 00 00       	mov    $0x1,%edx
+  808e84:	89 c1                	mov    %eax,%ecx
+  808e86:	d3 e2                	shl    %cl,%edx
+  808e88:	09 96 b4 01 00 00    	or     %edx,0x1b4(%rsi)
+    if (IF)
+  808e8e:	eb a7                	jmp    808e37 <nvme_read_async+0x64>
+
+0000000000808e90 <nvme_poll>:
+
+/* Returns tag of some completed asynchronous command and
+ * stores its status in *status, or -1 if none has completed */
+int
+nvme_poll(int *status) {
+  808e90:	55                   	push   %rbp
+  808e91:	48 89 e5             	mov    %rsp,%rbp
+  808e94:	41 54                	push   %r12
+  808e96:	53                   	push   %rbx
+  808e97:	48 89 fb             	mov    %rdi,%rbx
+    struct NvmeQueueAttributes *q = &nvme.ioq[0];
+
+    nvme_reap(&nvme, q);
+  808e9a:	48 be 00 62 8c 00 00 	movabs $0x8c6200,%rsi
+  808ea1:	00 00 00 
+  808ea4:	4c 8d a6 80 fe ff ff 	lea    -0x180(%rsi),%r12
+  808eab:	4c 89 e7             	mov    %r12,%rdi
+  808eae:	48 b8 99 81 80 00 00 	movabs $0x808199,%rax
+  808eb5:	00 00 00 
+  808eb8:	ff d0                	call   *%rax
+    uint32_t ready = q->done & q->async;
+  808eba:	41 8b b4 24 b8 01 00 	mov    0x1b8(%r12),%esi
+  808ec1:	00 
+  808ec2:	41 8b 94 24 b4 01 00 	mov    0x1b4(%r12),%edx
+  808ec9:	00 
+    if (!ready) return -1;
+  808eca:	89 f0                	mov    %esi,%eax
+  808ecc:	21 d0                	and    %edx,%eax
+  808ece:	74 42                	je     808f12 <nvme_poll+0x82>
+
+    int tag = __builtin_ctz(ready);
+  808ed0:	f3 0f bc c0          	tzcnt  %eax,%eax
+    q->done &= ~(1U << tag);
+  808ed4:	bf fe ff ff ff       	mov    $0xfffffffe,%edi
+  808ed9:	89 c1                	mov    %eax,%ecx
+  808edb:	d3 c7                	rol    %cl,%edi
+  808edd:	21 fe                	and    %edi,%esi
+  808edf:	41 89 b4 24 b8 01 00 	mov    %esi,0x1b8(%r12)
+  808ee6:	00 
+    q->tags &= ~(1U << tag);
+  808ee7:	41 21 bc 24 b0 01 00 	and    %edi,0x1b0(%r12)
+  808eee:	00 
+    q->async &= ~(1U << tag);
+  808eef:	21 fa                	and    %edi,%edx
+  808ef1:	41 89 94 24 b4 01 00 	mov    %edx,0x1b4(%r12)
+  808ef8:	00 
+    *status = q->status[tag] ? -NVME_IOCMD_FAILED : NVME_OK;
+  808ef9:	48 63 d0             	movslq %eax,%rdx
+  808efc:	41 8b 8c 94 bc 01 00 	mov    0x1bc(%r12,%rdx,4),%ecx
+  808f03:	00 
+  808f04:	f7 d9                	neg    %ecx
+  808f06:	19 d2                	sbb    %edx,%edx
+  808f08:	83 e2 f9             	and    $0xfffffff9,%edx
+  808f0b:	89 13                	mov    %edx,(%rbx)
+    return tag;
+}
+  808f0d:	5b                   	pop    %rbx
+  808f0e:	41 5c                	pop    %r12
+  808f10:	5d                   	pop    %rbp
+  808f11:	c3                   	ret
+    if (!ready) return -1;
+  808f12:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  808f17:	eb f4                	jmp    808f0d <nvme_poll+0x7d>
+
+0000000000808f19 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  808f19:	55                   	push   %rbp
+  808f1a:	48 89 e5             	mov    %rsp,%rbp
+  808f1d:	41 56                	push   %r14
+  808f1f:	41 55                	push   %r13
+  808f21:	41 54                	push   %r12
+  808f23:	53                   	push   %rbx
+  808f24:	41 89 fd             	mov    %edi,%r13d
+  808f27:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  808f2a:	48 ba 58 51 81 00 00 	movabs $0x815158,%rdx
+  808f31:	00 00 00 
+  808f34:	48 b8 58 51 81 00 00 	movabs $0x815158,%rax
+  808f3b:	00 00 00 
+  808f3e:	48 39 c2             	cmp    %rax,%rdx
+  808f41:	73 17                	jae    808f5a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  808f43:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  808f46:	49 89 c4             	mov    %rax,%r12
+  808f49:	48 83 c3 08          	add    $0x8,%rbx
+  808f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  808f52:	ff 53 f8             	call   *-0x8(%rbx)
+  808f55:	4c 39 e3             	cmp    %r12,%rbx
+  808f58:	72 ef                	jb     808f49 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  808f5a:	48 b8 4d a1 80 00 00 	movabs $0x80a14d,%rax
+  808f61:	00 00 00 
+  808f64:	ff d0                	call   *%rax
+  808f66:	25 ff 03 00 00       	and    $0x3ff,%eax
+  808f6b:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  808f72:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  808f79:	00 00 00 
+  808f7c:	48 01 d0             	add    %rdx,%rax
+  808f7f:	48 a3 c0 62 8c 00 00 	movabs %rax,0x8c62c0
+  808f86:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  808f89:	45 85 ed             	test   %r13d,%r13d
+  808f8c:	7e 0d                	jle    808f9b <libmain+0x82>
+  808f8e:	49 8b 06             	mov    (%r14),%rax
+  808f91:	48 a3 88 50 81 00 00 	movabs %rax,0x815088
+  808f98:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  808f9b:	4c 89 f6             	mov    %r14,%rsi
+  808f9e:	44 89 ef             	mov    %r13d,%edi
+  808fa1:	48 b8 9a 63 80 00 00 	movabs $0x80639a,%rax
+  808fa8:	00 00 00 
+  808fab:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  808fad:	48 b8 c2 8f 80 00 00 	movabs $0x808fc2,%rax
+  808fb4:	00 00 00 
+  808fb7:	ff d0                	call   *%rax
+#endif
+}
+  808fb9:	5b                   	pop    %rbx
+  808fba:	41 5c                	pop    %r12
+  808fbc:	41 5d                	pop    %r13
+  808fbe:	41 5e                	pop    %r14
+  808fc0:	5d                   	pop    %rbp
+  808fc1:	c3                   	ret
+
+0000000000808fc2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  808fc2:	55                   	push   %rbp
+  808fc3:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  808fc6:	48 b8 0a b4 80 00 00 	movabs $0x80b40a,%rax
+  808fcd:	00 00 00 
+  808fd0:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  808fd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  808fd7:	48 b8 e2 a0 80 00 00 	movabs $0x80a0e2,%rax
+  808fde:	00 00 00 
+  808fe1:	ff d0                	call   *%rax
+}
+  808fe3:	5d                   	pop    %rbp
+  808fe4:	c3                   	ret
+
+0000000000808fe5 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  808fe5:	55                   	push   %rbp
+  808fe6:	48 89 e5             	mov    %rsp,%rbp
+  808fe9:	41 56                	push   %r14
+  808feb:	41 55                	push   %r13
+  808fed:	41 54                	push   %r12
+  808fef:	53                   	push   %rbx
+  808ff0:	48 83 ec 50          	sub    $0x50,%rsp
+  808ff4:	49 89 fc             	mov    %rdi,%r12
+  808ff7:	41 89 f5             	mov    %esi,%r13d
+  808ffa:	48 89 d3             	mov    %rdx,%rbx
+  808ffd:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  809001:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  809005:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  809009:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  809010:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  809014:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  809018:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80901c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  809020:	48 b8 88 50 81 00 00 	movabs $0x815088,%rax
+  809027:	00 00 00 
+  80902a:	4c 8b 30             	mov    (%rax),%r14
+  80902d:	48 b8 4d a1 80 00 00 	movabs $0x80a14d,%rax
+  809034:	00 00 00 
+  809037:	ff d0                	call   *%rax
+  809039:	89 c6                	mov    %eax,%esi
+  80903b:	45 89 e8             	mov    %r13d,%r8d
+  80903e:	4c 89 e1             	mov    %r12,%rcx
+  809041:	4c 89 f2             	mov    %r14,%rdx
+  809044:	48 bf 30 eb 80 00 00 	movabs $0x80eb30,%rdi
+  80904b:	00 00 00 
+  80904e:	b8 00 00 00 00       	mov    $0x0,%eax
+  809053:	49 bc 35 91 80 00 00 	movabs $0x809135,%r12
+  80905a:	00 00 00 
+  80905d:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  809060:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  809064:	48 89 df             	mov    %rbx,%rdi
+  809067:	48 b8 d1 90 80 00 00 	movabs $0x8090d1,%rax
+  80906e:	00 00 00 
+  809071:	ff d0                	call   *%rax
+    cprintf("\n");
+  809073:	48 bf 77 e0 80 00 00 	movabs $0x80e077,%rdi
+  80907a:	00 00 00 
+  80907d:	b8 00 00 00 00       	mov    $0x0,%eax
+  809082:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  809085:	cc                   	int3
+  809086:	eb fd                	jmp    809085 <_panic+0xa0>
+
+0000000000809088 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  809088:	55                   	push   %rbp
+  809089:	48 89 e5             	mov    %rsp,%rbp
+  80908c:	53                   	push   %rbx
+  80908d:	48 83 ec 08          	sub    $0x8,%rsp
+  809091:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  809094:	8b 06                	mov    (%rsi),%eax
+  809096:	8d 50 01             	lea    0x1(%rax),%edx
+  809099:	89 16                	mov    %edx,(%rsi)
+  80909b:	48 98                	cltq
+  80909d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8090a2:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8090a8:	74 0a                	je     8090b4 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8090aa:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8090ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8090b2:	c9                   	leave
+  8090b3:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8090b4:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8090b8:	be ff 00 00 00       	mov    $0xff,%esi
+  8090bd:	48 b8 84 a0 80 00 00 	movabs $0x80a084,%rax
+  8090c4:	00 00 00 
+  8090c7:	ff d0                	call   *%rax
+        state->offset = 0;
+  8090c9:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8090cf:	eb d9                	jmp    8090aa <putch+0x22>
+
+00000000008090d1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8090d1:	55                   	push   %rbp
+  8090d2:	48 89 e5             	mov    %rsp,%rbp
+  8090d5:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8090dc:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8090df:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8090e6:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8090eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8090f0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8090f3:	48 89 f1             	mov    %rsi,%rcx
+  8090f6:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8090fd:	48 bf 88 90 80 00 00 	movabs $0x809088,%rdi
+  809104:	00 00 00 
+  809107:	48 b8 85 92 80 00 00 	movabs $0x809285,%rax
+  80910e:	00 00 00 
+  809111:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  809113:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80911a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  809121:	48 b8 84 a0 80 00 00 	movabs $0x80a084,%rax
+  809128:	00 00 00 
+  80912b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80912d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  809133:	c9                   	leave
+  809134:	c3                   	ret
+
+0000000000809135 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  809135:	55                   	push   %rbp
+  809136:	48 89 e5             	mov    %rsp,%rbp
+  809139:	48 83 ec 50          	sub    $0x50,%rsp
+  80913d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  809141:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  809145:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  809149:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80914d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  809151:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  809158:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80915c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809160:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  809164:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  809168:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80916c:	48 b8 d1 90 80 00 00 	movabs $0x8090d1,%rax
+  809173:	00 00 00 
+  809176:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  809178:	c9                   	leave
+  809179:	c3                   	ret
+
+000000000080917a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80917a:	55                   	push   %rbp
+  80917b:	48 89 e5             	mov    %rsp,%rbp
+  80917e:	41 57                	push   %r15
+  809180:	41 56                	push   %r14
+  809182:	41 55                	push   %r13
+  809184:	41 54                	push   %r12
+  809186:	53                   	push   %rbx
+  809187:	48 83 ec 18          	sub    $0x18,%rsp
+  80918b:	49 89 fc             	mov    %rdi,%r12
+  80918e:	49 89 f5             	mov    %rsi,%r13
+  809191:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  809195:	8b 45 10             	mov    0x10(%rbp),%eax
+  809198:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80919b:	41 89 cf             	mov    %ecx,%r15d
+  80919e:	4c 39 fa             	cmp    %r15,%rdx
+  8091a1:	73 5b                	jae    8091fe <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8091a3:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8091a7:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8091ab:	85 db                	test   %ebx,%ebx
+  8091ad:	7e 0e                	jle    8091bd <print_num+0x43>
+            putch(padc, put_arg);
+  8091af:	4c 89 ee             	mov    %r13,%rsi
+  8091b2:	44 89 f7             	mov    %r14d,%edi
+  8091b5:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8091b8:	83 eb 01             	sub    $0x1,%ebx
+  8091bb:	75 f2                	jne    8091af <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8091bd:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8091c1:	48 b9 64 eb 80 00 00 	movabs $0x80eb64,%rcx
+  8091c8:	00 00 00 
+  8091cb:	48 b8 53 eb 80 00 00 	movabs $0x80eb53,%rax
+  8091d2:	00 00 00 
+  8091d5:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8091d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8091dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8091e2:	49 f7 f7             	div    %r15
+  8091e5:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8091e9:	4c 89 ee             	mov    %r13,%rsi
+  8091ec:	41 ff d4             	call   *%r12
+}
+  8091ef:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8091f3:	5b                   	pop    %rbx
+  8091f4:	41 5c                	pop    %r12
+  8091f6:	41 5d                	pop    %r13
+  8091f8:	41 5e                	pop    %r14
+  8091fa:	41 5f                	pop    %r15
+  8091fc:	5d                   	pop    %rbp
+  8091fd:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8091fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809202:	ba 00 00 00 00       	mov    $0x0,%edx
+  809207:	49 f7 f7             	div    %r15
+  80920a:	48 83 ec 08          	sub    $0x8,%rsp
+  80920e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  809212:	52                   	push   %rdx
+  809213:	45 0f be c9          	movsbl %r9b,%r9d
+  809217:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80921b:	48 89 c2             	mov    %rax,%rdx
+  80921e:	48 b8 7a 91 80 00 00 	movabs $0x80917a,%rax
+  809225:	00 00 00 
+  809228:	ff d0                	call   *%rax
+  80922a:	48 83 c4 10          	add    $0x10,%rsp
+  80922e:	eb 8d                	jmp    8091bd <print_num+0x43>
+
+0000000000809230 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  809230:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  809234:	48 8b 06             	mov    (%rsi),%rax
+  809237:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80923b:	73 0a                	jae    809247 <sprintputch+0x17>
+        *state->start++ = ch;
+  80923d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  809241:	48 89 16             	mov    %rdx,(%rsi)
+  809244:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  809247:	c3                   	ret
+
+0000000000809248 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  809248:	55                   	push   %rbp
+  809249:	48 89 e5             	mov    %rsp,%rbp
+  80924c:	48 83 ec 50          	sub    $0x50,%rsp
+  809250:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  809254:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  809258:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80925c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  809263:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  809267:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80926b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80926f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  809273:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  809277:	48 b8 85 92 80 00 00 	movabs $0x809285,%rax
+  80927e:	00 00 00 
+  809281:	ff d0                	call   *%rax
+}
+  809283:	c9                   	leave
+  809284:	c3                   	ret
+
+0000000000809285 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  809285:	55                   	push   %rbp
+  809286:	48 89 e5             	mov    %rsp,%rbp
+  809289:	41 57                	push   %r15
+  80928b:	41 56                	push   %r14
+  80928d:	41 55                	push   %r13
+  80928f:	41 54                	push   %r12
+  809291:	53                   	push   %rbx
+  809292:	48 83 ec 38          	sub    $0x38,%rsp
+  809296:	49 89 fe             	mov    %rdi,%r14
+  809299:	49 89 f5             	mov    %rsi,%r13
+  80929c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80929f:	48 8b 01             	mov    (%rcx),%rax
+  8092a2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8092a6:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8092aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8092ae:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8092b2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8092b6:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8092ba:	0f b6 3b             	movzbl (%rbx),%edi
+  8092bd:	40 80 ff 25          	cmp    $0x25,%dil
+  8092c1:	74 18                	je     8092db <vprintfmt+0x56>
+            if (!ch) return;
+  8092c3:	40 84 ff             	test   %dil,%dil
+  8092c6:	0f 84 04 07 00 00    	je     8099d0 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8092cc:	40 0f b6 ff          	movzbl %dil,%edi
+  8092d0:	4c 89 ee             	mov    %r13,%rsi
+  8092d3:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8092d6:	4c 89 e3             	mov    %r12,%rbx
+  8092d9:	eb db                	jmp    8092b6 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8092db:	be 00 00 00 00       	mov    $0x0,%esi
+  8092e0:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8092e4:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8092e9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8092ef:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8092f6:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8092fa:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8092ff:	41 0f b6 04 24       	movzbl (%r12),%eax
+  809304:	88 45 a0             	mov    %al,-0x60(%rbp)
+  809307:	83 e8 23             	sub    $0x23,%eax
+  80930a:	3c 57                	cmp    $0x57,%al
+  80930c:	0f 87 a4 06 00 00    	ja     8099b6 <vprintfmt+0x731>
+  809312:	0f b6 c0             	movzbl %al,%eax
+  809315:	48 b9 00 ed 80 00 00 	movabs $0x80ed00,%rcx
+  80931c:	00 00 00 
+  80931f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  809322:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  809325:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  809329:	eb cf                	jmp    8092fa <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80932b:	49 89 dc             	mov    %rbx,%r12
+  80932e:	be 01 00 00 00       	mov    $0x1,%esi
+  809333:	eb c5                	jmp    8092fa <vprintfmt+0x75>
+            padc = ch;
+  809335:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  809339:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80933c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80933f:	eb b9                	jmp    8092fa <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  809341:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  809344:	83 f8 2f             	cmp    $0x2f,%eax
+  809347:	77 24                	ja     80936d <vprintfmt+0xe8>
+  809349:	89 c1                	mov    %eax,%ecx
+  80934b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80934f:	83 c0 08             	add    $0x8,%eax
+  809352:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  809355:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  809358:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80935b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80935f:	79 99                	jns    8092fa <vprintfmt+0x75>
+                width = precision;
+  809361:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  809365:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80936b:	eb 8d                	jmp    8092fa <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80936d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  809371:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  809375:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809379:	eb da                	jmp    809355 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80937b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  809380:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  809384:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80938a:	3c 39                	cmp    $0x39,%al
+  80938c:	77 1c                	ja     8093aa <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80938e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  809392:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  809396:	0f b6 c0             	movzbl %al,%eax
+  809399:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80939e:	0f b6 03             	movzbl (%rbx),%eax
+  8093a1:	3c 39                	cmp    $0x39,%al
+  8093a3:	76 e9                	jbe    80938e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8093a5:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8093a8:	eb b1                	jmp    80935b <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8093aa:	49 89 dc             	mov    %rbx,%r12
+  8093ad:	eb ac                	jmp    80935b <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8093af:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8093b2:	85 c9                	test   %ecx,%ecx
+  8093b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8093b9:	0f 49 c1             	cmovns %ecx,%eax
+  8093bc:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8093bf:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8093c2:	e9 33 ff ff ff       	jmp    8092fa <vprintfmt+0x75>
+            lflag++;
+  8093c7:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8093ca:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8093cd:	e9 28 ff ff ff       	jmp    8092fa <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8093d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8093d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8093d8:	77 19                	ja     8093f3 <vprintfmt+0x16e>
+  8093da:	89 c2                	mov    %eax,%edx
+  8093dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8093e0:	83 c0 08             	add    $0x8,%eax
+  8093e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8093e6:	8b 3a                	mov    (%rdx),%edi
+  8093e8:	4c 89 ee             	mov    %r13,%rsi
+  8093eb:	41 ff d6             	call   *%r14
+            break;
+  8093ee:	e9 c3 fe ff ff       	jmp    8092b6 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8093f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8093f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8093fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8093ff:	eb e5                	jmp    8093e6 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  809401:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  809404:	83 f8 2f             	cmp    $0x2f,%eax
+  809407:	77 5a                	ja     809463 <vprintfmt+0x1de>
+  809409:	89 c2                	mov    %eax,%edx
+  80940b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80940f:	83 c0 08             	add    $0x8,%eax
+  809412:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  809415:	8b 02                	mov    (%rdx),%eax
+  809417:	89 c1                	mov    %eax,%ecx
+  809419:	f7 d9                	neg    %ecx
+  80941b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80941e:	83 f9 13             	cmp    $0x13,%ecx
+  809421:	7f 4e                	jg     809471 <vprintfmt+0x1ec>
+  809423:	48 63 c1             	movslq %ecx,%rax
+  809426:	48 ba c0 ef 80 00 00 	movabs $0x80efc0,%rdx
+  80942d:	00 00 00 
+  809430:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  809434:	48 85 c0             	test   %rax,%rax
+  809437:	74 38                	je     809471 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  809439:	48 89 c1             	mov    %rax,%rcx
+  80943c:	48 ba 56 e0 80 00 00 	movabs $0x80e056,%rdx
+  809443:	00 00 00 
+  809446:	4c 89 ee             	mov    %r13,%rsi
+  809449:	4c 89 f7             	mov    %r14,%rdi
+  80944c:	b8 00 00 00 00       	mov    $0x0,%eax
+  809451:	49 b8 48 92 80 00 00 	movabs $0x809248,%r8
+  809458:	00 00 00 
+  80945b:	41 ff d0             	call   *%r8
+  80945e:	e9 53 fe ff ff       	jmp    8092b6 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  809463:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  809467:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80946b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80946f:	eb a4                	jmp    809415 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  809471:	48 ba 7c eb 80 00 00 	movabs $0x80eb7c,%rdx
+  809478:	00 00 00 
+  80947b:	4c 89 ee             	mov    %r13,%rsi
+  80947e:	4c 89 f7             	mov    %r14,%rdi
+  809481:	b8 00 00 00 00       	mov    $0x0,%eax
+  809486:	49 b8 48 92 80 00 00 	movabs $0x809248,%r8
+  80948d:	00 00 00 
+  809490:	41 ff d0             	call   *%r8
+  809493:	e9 1e fe ff ff       	jmp    8092b6 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  809498:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80949b:	83 f8 2f             	cmp    $0x2f,%eax
+  80949e:	77 36                	ja     8094d6 <vprintfmt+0x251>
+  8094a0:	89 c2                	mov    %eax,%edx
+  8094a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8094a6:	83 c0 08             	add    $0x8,%eax
+  8094a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8094ac:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8094af:	48 85 f6             	test   %rsi,%rsi
+  8094b2:	48 b8 75 eb 80 00 00 	movabs $0x80eb75,%rax
+  8094b9:	00 00 00 
+  8094bc:	48 0f 45 c6          	cmovne %rsi,%rax
+  8094c0:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8094c4:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8094c8:	7e 06                	jle    8094d0 <vprintfmt+0x24b>
+  8094ca:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8094ce:	75 14                	jne    8094e4 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8094d0:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8094d4:	eb 5b                	jmp    809531 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8094d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8094da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8094de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8094e2:	eb c8                	jmp    8094ac <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8094e4:	49 63 f7             	movslq %r15d,%rsi
+  8094e7:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8094eb:	48 b8 8a 9a 80 00 00 	movabs $0x809a8a,%rax
+  8094f2:	00 00 00 
+  8094f5:	ff d0                	call   *%rax
+  8094f7:	48 89 c2             	mov    %rax,%rdx
+  8094fa:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8094fd:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8094ff:	8d 70 ff             	lea    -0x1(%rax),%esi
+  809502:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  809505:	85 c0                	test   %eax,%eax
+  809507:	7e c7                	jle    8094d0 <vprintfmt+0x24b>
+  809509:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80950e:	4c 89 ee             	mov    %r13,%rsi
+  809511:	44 89 e7             	mov    %r12d,%edi
+  809514:	41 ff d6             	call   *%r14
+  809517:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80951b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80951e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  809521:	75 eb                	jne    80950e <vprintfmt+0x289>
+  809523:	eb ab                	jmp    8094d0 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  809525:	0f b6 f8             	movzbl %al,%edi
+  809528:	4c 89 ee             	mov    %r13,%rsi
+  80952b:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  80952e:	4c 89 e2             	mov    %r12,%rdx
+  809531:	45 85 ff             	test   %r15d,%r15d
+  809534:	78 06                	js     80953c <vprintfmt+0x2b7>
+  809536:	41 83 ef 01          	sub    $0x1,%r15d
+  80953a:	78 23                	js     80955f <vprintfmt+0x2da>
+  80953c:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  809540:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  809546:	84 c0                	test   %al,%al
+  809548:	74 15                	je     80955f <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80954a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80954e:	74 d5                	je     809525 <vprintfmt+0x2a0>
+  809550:	8d 50 e0             	lea    -0x20(%rax),%edx
+  809553:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  809558:	80 fa 5e             	cmp    $0x5e,%dl
+  80955b:	77 cb                	ja     809528 <vprintfmt+0x2a3>
+  80955d:	eb c6                	jmp    809525 <vprintfmt+0x2a0>
+  80955f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  809562:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  809565:	01 f0                	add    %esi,%eax
+  809567:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  809569:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80956d:	85 c0                	test   %eax,%eax
+  80956f:	0f 8e 41 fd ff ff    	jle    8092b6 <vprintfmt+0x31>
+  809575:	4c 89 ee             	mov    %r13,%rsi
+  809578:	bf 20 00 00 00       	mov    $0x20,%edi
+  80957d:	41 ff d6             	call   *%r14
+  809580:	41 83 ec 01          	sub    $0x1,%r12d
+  809584:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  809588:	75 eb                	jne    809575 <vprintfmt+0x2f0>
+  80958a:	e9 27 fd ff ff       	jmp    8092b6 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80958f:	40 84 f6             	test   %sil,%sil
+  809592:	75 26                	jne    8095ba <vprintfmt+0x335>
+    switch (lflag) {
+  809594:	85 d2                	test   %edx,%edx
+  809596:	74 59                	je     8095f1 <vprintfmt+0x36c>
+  809598:	83 fa 01             	cmp    $0x1,%edx
+  80959b:	74 7b                	je     809618 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80959d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8095a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8095a3:	0f 87 96 00 00 00    	ja     80963f <vprintfmt+0x3ba>
+  8095a9:	89 c2                	mov    %eax,%edx
+  8095ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8095af:	83 c0 08             	add    $0x8,%eax
+  8095b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8095b5:	4c 8b 22             	mov    (%rdx),%r12
+  8095b8:	eb 17                	jmp    8095d1 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8095ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8095bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8095c0:	77 21                	ja     8095e3 <vprintfmt+0x35e>
+  8095c2:	89 c2                	mov    %eax,%edx
+  8095c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8095c8:	83 c0 08             	add    $0x8,%eax
+  8095cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8095ce:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8095d1:	4d 85 e4             	test   %r12,%r12
+  8095d4:	78 7a                	js     809650 <vprintfmt+0x3cb>
+            num = i;
+  8095d6:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8095d9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8095de:	e9 b5 02 00 00       	jmp    809898 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8095e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8095e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8095eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8095ef:	eb dd                	jmp    8095ce <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8095f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8095f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8095f7:	77 11                	ja     80960a <vprintfmt+0x385>
+  8095f9:	89 c2                	mov    %eax,%edx
+  8095fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8095ff:	83 c0 08             	add    $0x8,%eax
+  809602:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  809605:	4c 63 22             	movslq (%rdx),%r12
+  809608:	eb c7                	jmp    8095d1 <vprintfmt+0x34c>
+  80960a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80960e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  809612:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809616:	eb ed                	jmp    809605 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  809618:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80961b:	83 f8 2f             	cmp    $0x2f,%eax
+  80961e:	77 11                	ja     809631 <vprintfmt+0x3ac>
+  809620:	89 c2                	mov    %eax,%edx
+  809622:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  809626:	83 c0 08             	add    $0x8,%eax
+  809629:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80962c:	4c 8b 22             	mov    (%rdx),%r12
+  80962f:	eb a0                	jmp    8095d1 <vprintfmt+0x34c>
+  809631:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  809635:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  809639:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80963d:	eb ed                	jmp    80962c <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  80963f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  809643:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  809647:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80964b:	e9 65 ff ff ff       	jmp    8095b5 <vprintfmt+0x330>
+                putch('-', put_arg);
+  809650:	4c 89 ee             	mov    %r13,%rsi
+  809653:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  809658:	41 ff d6             	call   *%r14
+                i = -i;
+  80965b:	49 f7 dc             	neg    %r12
+  80965e:	e9 73 ff ff ff       	jmp    8095d6 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  809663:	40 84 f6             	test   %sil,%sil
+  809666:	75 32                	jne    80969a <vprintfmt+0x415>
+    switch (lflag) {
+  809668:	85 d2                	test   %edx,%edx
+  80966a:	74 5d                	je     8096c9 <vprintfmt+0x444>
+  80966c:	83 fa 01             	cmp    $0x1,%edx
+  80966f:	0f 84 82 00 00 00    	je     8096f7 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  809675:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  809678:	83 f8 2f             	cmp    $0x2f,%eax
+  80967b:	0f 87 a5 00 00 00    	ja     809726 <vprintfmt+0x4a1>
+  809681:	89 c2                	mov    %eax,%edx
+  809683:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  809687:	83 c0 08             	add    $0x8,%eax
+  80968a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80968d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  809690:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  809695:	e9 fe 01 00 00       	jmp    809898 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80969a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80969d:	83 f8 2f             	cmp    $0x2f,%eax
+  8096a0:	77 19                	ja     8096bb <vprintfmt+0x436>
+  8096a2:	89 c2                	mov    %eax,%edx
+  8096a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8096a8:	83 c0 08             	add    $0x8,%eax
+  8096ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8096ae:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8096b1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8096b6:	e9 dd 01 00 00       	jmp    809898 <vprintfmt+0x613>
+  8096bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8096bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8096c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8096c7:	eb e5                	jmp    8096ae <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8096c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8096cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8096cf:	77 18                	ja     8096e9 <vprintfmt+0x464>
+  8096d1:	89 c2                	mov    %eax,%edx
+  8096d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8096d7:	83 c0 08             	add    $0x8,%eax
+  8096da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8096dd:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8096df:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8096e4:	e9 af 01 00 00       	jmp    809898 <vprintfmt+0x613>
+  8096e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8096ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8096f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8096f5:	eb e6                	jmp    8096dd <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8096f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8096fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8096fd:	77 19                	ja     809718 <vprintfmt+0x493>
+  8096ff:	89 c2                	mov    %eax,%edx
+  809701:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  809705:	83 c0 08             	add    $0x8,%eax
+  809708:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80970b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80970e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  809713:	e9 80 01 00 00       	jmp    809898 <vprintfmt+0x613>
+  809718:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80971c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  809720:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809724:	eb e5                	jmp    80970b <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  809726:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80972a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80972e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809732:	e9 56 ff ff ff       	jmp    80968d <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  809737:	40 84 f6             	test   %sil,%sil
+  80973a:	75 2e                	jne    80976a <vprintfmt+0x4e5>
+    switch (lflag) {
+  80973c:	85 d2                	test   %edx,%edx
+  80973e:	0f 84 b3 00 00 00    	je     8097f7 <vprintfmt+0x572>
+  809744:	83 fa 01             	cmp    $0x1,%edx
+  809747:	0f 84 d3 00 00 00    	je     809820 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  80974d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  809750:	83 f8 2f             	cmp    $0x2f,%eax
+  809753:	0f 87 f1 00 00 00    	ja     80984a <vprintfmt+0x5c5>
+  809759:	89 c2                	mov    %eax,%edx
+  80975b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80975f:	83 c0 08             	add    $0x8,%eax
+  809762:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  809765:	48 8b 02             	mov    (%rdx),%rax
+  809768:	eb 17                	jmp    809781 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  80976a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80976d:	83 f8 2f             	cmp    $0x2f,%eax
+  809770:	77 77                	ja     8097e9 <vprintfmt+0x564>
+  809772:	89 c2                	mov    %eax,%edx
+  809774:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  809778:	83 c0 08             	add    $0x8,%eax
+  80977b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80977e:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  809781:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  809783:	83 f8 07             	cmp    $0x7,%eax
+  809786:	0f 8e cf 00 00 00    	jle    80985b <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  80978c:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  809792:	44 89 e7             	mov    %r12d,%edi
+  809795:	41 c1 e4 03          	shl    $0x3,%r12d
+  809799:	89 d1                	mov    %edx,%ecx
+  80979b:	8d 72 07             	lea    0x7(%rdx),%esi
+  80979e:	85 d2                	test   %edx,%edx
+  8097a0:	0f 48 d6             	cmovs  %esi,%edx
+  8097a3:	c1 fa 03             	sar    $0x3,%edx
+  8097a6:	83 f9 3f             	cmp    $0x3f,%ecx
+  8097a9:	7f e7                	jg     809792 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8097ab:	85 ff                	test   %edi,%edi
+  8097ad:	0f 84 03 fb ff ff    	je     8092b6 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8097b3:	49 63 f4             	movslq %r12d,%rsi
+  8097b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8097bb:	48 f7 f6             	div    %rsi
+  8097be:	49 89 d7             	mov    %rdx,%r15
+  8097c1:	83 c0 30             	add    $0x30,%eax
+  8097c4:	0f be f8             	movsbl %al,%edi
+  8097c7:	4c 89 ee             	mov    %r13,%rsi
+  8097ca:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  8097cd:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  8097d0:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  8097d5:	45 85 e4             	test   %r12d,%r12d
+  8097d8:	41 0f 49 d4          	cmovns %r12d,%edx
+  8097dc:	c1 fa 03             	sar    $0x3,%edx
+  8097df:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  8097e2:	75 cf                	jne    8097b3 <vprintfmt+0x52e>
+  8097e4:	e9 cd fa ff ff       	jmp    8092b6 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8097e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8097ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8097f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8097f5:	eb 87                	jmp    80977e <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  8097f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8097fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8097fd:	77 13                	ja     809812 <vprintfmt+0x58d>
+  8097ff:	89 c2                	mov    %eax,%edx
+  809801:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  809805:	83 c0 08             	add    $0x8,%eax
+  809808:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80980b:	8b 02                	mov    (%rdx),%eax
+  80980d:	e9 6f ff ff ff       	jmp    809781 <vprintfmt+0x4fc>
+  809812:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  809816:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80981a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80981e:	eb eb                	jmp    80980b <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  809820:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  809823:	83 f8 2f             	cmp    $0x2f,%eax
+  809826:	77 14                	ja     80983c <vprintfmt+0x5b7>
+  809828:	89 c2                	mov    %eax,%edx
+  80982a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80982e:	83 c0 08             	add    $0x8,%eax
+  809831:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  809834:	48 8b 02             	mov    (%rdx),%rax
+  809837:	e9 45 ff ff ff       	jmp    809781 <vprintfmt+0x4fc>
+  80983c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  809840:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  809844:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809848:	eb ea                	jmp    809834 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  80984a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80984e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  809852:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809856:	e9 0a ff ff ff       	jmp    809765 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  80985b:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  809861:	e9 4d ff ff ff       	jmp    8097b3 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  809866:	4c 89 ee             	mov    %r13,%rsi
+  809869:	bf 30 00 00 00       	mov    $0x30,%edi
+  80986e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  809871:	4c 89 ee             	mov    %r13,%rsi
+  809874:	bf 78 00 00 00       	mov    $0x78,%edi
+  809879:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80987c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80987f:	83 f8 2f             	cmp    $0x2f,%eax
+  809882:	77 47                	ja     8098cb <vprintfmt+0x646>
+  809884:	89 c2                	mov    %eax,%edx
+  809886:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80988a:	83 c0 08             	add    $0x8,%eax
+  80988d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  809890:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  809893:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  809898:	48 83 ec 08          	sub    $0x8,%rsp
+  80989c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8098a0:	0f 94 c0             	sete   %al
+  8098a3:	0f b6 c0             	movzbl %al,%eax
+  8098a6:	50                   	push   %rax
+  8098a7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8098ac:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8098b0:	4c 89 ee             	mov    %r13,%rsi
+  8098b3:	4c 89 f7             	mov    %r14,%rdi
+  8098b6:	48 b8 7a 91 80 00 00 	movabs $0x80917a,%rax
+  8098bd:	00 00 00 
+  8098c0:	ff d0                	call   *%rax
+            break;
+  8098c2:	48 83 c4 10          	add    $0x10,%rsp
+  8098c6:	e9 eb f9 ff ff       	jmp    8092b6 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8098cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8098cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8098d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8098d7:	eb b7                	jmp    809890 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  8098d9:	40 84 f6             	test   %sil,%sil
+  8098dc:	75 2b                	jne    809909 <vprintfmt+0x684>
+    switch (lflag) {
+  8098de:	85 d2                	test   %edx,%edx
+  8098e0:	74 56                	je     809938 <vprintfmt+0x6b3>
+  8098e2:	83 fa 01             	cmp    $0x1,%edx
+  8098e5:	74 7f                	je     809966 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  8098e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8098ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8098ed:	0f 87 a2 00 00 00    	ja     809995 <vprintfmt+0x710>
+  8098f3:	89 c2                	mov    %eax,%edx
+  8098f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8098f9:	83 c0 08             	add    $0x8,%eax
+  8098fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8098ff:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  809902:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  809907:	eb 8f                	jmp    809898 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  809909:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80990c:	83 f8 2f             	cmp    $0x2f,%eax
+  80990f:	77 19                	ja     80992a <vprintfmt+0x6a5>
+  809911:	89 c2                	mov    %eax,%edx
+  809913:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  809917:	83 c0 08             	add    $0x8,%eax
+  80991a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80991d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  809920:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  809925:	e9 6e ff ff ff       	jmp    809898 <vprintfmt+0x613>
+  80992a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80992e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  809932:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809936:	eb e5                	jmp    80991d <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  809938:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80993b:	83 f8 2f             	cmp    $0x2f,%eax
+  80993e:	77 18                	ja     809958 <vprintfmt+0x6d3>
+  809940:	89 c2                	mov    %eax,%edx
+  809942:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  809946:	83 c0 08             	add    $0x8,%eax
+  809949:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80994c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80994e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  809953:	e9 40 ff ff ff       	jmp    809898 <vprintfmt+0x613>
+  809958:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80995c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  809960:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809964:	eb e6                	jmp    80994c <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  809966:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  809969:	83 f8 2f             	cmp    $0x2f,%eax
+  80996c:	77 19                	ja     809987 <vprintfmt+0x702>
+  80996e:	89 c2                	mov    %eax,%edx
+  809970:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  809974:	83 c0 08             	add    $0x8,%eax
+  809977:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80997a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80997d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  809982:	e9 11 ff ff ff       	jmp    809898 <vprintfmt+0x613>
+  809987:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80998b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80998f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809993:	eb e5                	jmp    80997a <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  809995:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  809999:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80999d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8099a1:	e9 59 ff ff ff       	jmp    8098ff <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8099a6:	4c 89 ee             	mov    %r13,%rsi
+  8099a9:	bf 25 00 00 00       	mov    $0x25,%edi
+  8099ae:	41 ff d6             	call   *%r14
+            break;
+  8099b1:	e9 00 f9 ff ff       	jmp    8092b6 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8099b6:	4c 89 ee             	mov    %r13,%rsi
+  8099b9:	bf 25 00 00 00       	mov    $0x25,%edi
+  8099be:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8099c1:	48 83 eb 01          	sub    $0x1,%rbx
+  8099c5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8099c9:	75 f6                	jne    8099c1 <vprintfmt+0x73c>
+  8099cb:	e9 e6 f8 ff ff       	jmp    8092b6 <vprintfmt+0x31>
+}
+  8099d0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8099d4:	5b                   	pop    %rbx
+  8099d5:	41 5c                	pop    %r12
+  8099d7:	41 5d                	pop    %r13
+  8099d9:	41 5e                	pop    %r14
+  8099db:	41 5f                	pop    %r15
+  8099dd:	5d                   	pop    %rbp
+  8099de:	c3                   	ret
+
+00000000008099df <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8099df:	55                   	push   %rbp
+  8099e0:	48 89 e5             	mov    %rsp,%rbp
+  8099e3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8099e7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8099eb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8099f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8099f4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8099fb:	48 85 ff             	test   %rdi,%rdi
+  8099fe:	74 2b                	je     809a2b <vsnprintf+0x4c>
+  809a00:	48 85 f6             	test   %rsi,%rsi
+  809a03:	74 26                	je     809a2b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  809a05:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  809a09:	48 bf 30 92 80 00 00 	movabs $0x809230,%rdi
+  809a10:	00 00 00 
+  809a13:	48 b8 85 92 80 00 00 	movabs $0x809285,%rax
+  809a1a:	00 00 00 
+  809a1d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  809a1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809a23:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  809a26:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  809a29:	c9                   	leave
+  809a2a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  809a2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  809a30:	eb f7                	jmp    809a29 <vsnprintf+0x4a>
+
+0000000000809a32 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  809a32:	55                   	push   %rbp
+  809a33:	48 89 e5             	mov    %rsp,%rbp
+  809a36:	48 83 ec 50          	sub    $0x50,%rsp
+  809a3a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  809a3e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  809a42:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  809a46:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  809a4d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  809a51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  809a55:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  809a59:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  809a5d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  809a61:	48 b8 df 99 80 00 00 	movabs $0x8099df,%rax
+  809a68:	00 00 00 
+  809a6b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  809a6d:	c9                   	leave
+  809a6e:	c3                   	ret
+
+0000000000809a6f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  809a6f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  809a72:	74 10                	je     809a84 <strlen+0x15>
+    size_t n = 0;
+  809a74:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  809a79:	48 83 c0 01          	add    $0x1,%rax
+  809a7d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  809a81:	75 f6                	jne    809a79 <strlen+0xa>
+  809a83:	c3                   	ret
+    size_t n = 0;
+  809a84:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  809a89:	c3                   	ret
+
+0000000000809a8a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  809a8a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  809a8d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  809a92:	48 85 f6             	test   %rsi,%rsi
+  809a95:	74 11                	je     809aa8 <strnlen+0x1e>
+  809a97:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  809a9b:	74 0c                	je     809aa9 <strnlen+0x1f>
+  809a9d:	48 83 c2 01          	add    $0x1,%rdx
+  809aa1:	48 39 d0             	cmp    %rdx,%rax
+  809aa4:	75 f1                	jne    809a97 <strnlen+0xd>
+  809aa6:	eb 04                	jmp    809aac <strnlen+0x22>
+  809aa8:	c3                   	ret
+  809aa9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  809aac:	c3                   	ret
+
+0000000000809aad <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  809aad:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  809ab0:	ba 00 00 00 00       	mov    $0x0,%edx
+  809ab5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  809ab9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  809abc:	48 83 c2 01          	add    $0x1,%rdx
+  809ac0:	84 c9                	test   %cl,%cl
+  809ac2:	75 f1                	jne    809ab5 <strcpy+0x8>
+        ;
+    return res;
+}
+  809ac4:	c3                   	ret
+
+0000000000809ac5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  809ac5:	55                   	push   %rbp
+  809ac6:	48 89 e5             	mov    %rsp,%rbp
+  809ac9:	41 54                	push   %r12
+  809acb:	53                   	push   %rbx
+  809acc:	48 89 fb             	mov    %rdi,%rbx
+  809acf:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  809ad2:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  809ad9:	00 00 00 
+  809adc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  809ade:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  809ae2:	4c 89 e6             	mov    %r12,%rsi
+  809ae5:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  809aec:	00 00 00 
+  809aef:	ff d0                	call   *%rax
+    return dst;
+}
+  809af1:	48 89 d8             	mov    %rbx,%rax
+  809af4:	5b                   	pop    %rbx
+  809af5:	41 5c                	pop    %r12
+  809af7:	5d                   	pop    %rbp
+  809af8:	c3                   	ret
+
+0000000000809af9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  809af9:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  809afc:	48 85 d2             	test   %rdx,%rdx
+  809aff:	74 1f                	je     809b20 <strncpy+0x27>
+  809b01:	48 01 fa             	add    %rdi,%rdx
+  809b04:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  809b07:	48 83 c1 01          	add    $0x1,%rcx
+  809b0b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  809b0f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  809b13:	41 80 f8 01          	cmp    $0x1,%r8b
+  809b17:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  809b1b:	48 39 ca             	cmp    %rcx,%rdx
+  809b1e:	75 e7                	jne    809b07 <strncpy+0xe>
+    }
+    return ret;
+}
+  809b20:	c3                   	ret
+
+0000000000809b21 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  809b21:	48 89 f8             	mov    %rdi,%rax
+  809b24:	48 85 d2             	test   %rdx,%rdx
+  809b27:	74 24                	je     809b4d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  809b29:	48 83 ea 01          	sub    $0x1,%rdx
+  809b2d:	74 1b                	je     809b4a <strlcpy+0x29>
+  809b2f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  809b33:	0f b6 16             	movzbl (%rsi),%edx
+  809b36:	84 d2                	test   %dl,%dl
+  809b38:	74 10                	je     809b4a <strlcpy+0x29>
+            *dst++ = *src++;
+  809b3a:	48 83 c6 01          	add    $0x1,%rsi
+  809b3e:	48 83 c0 01          	add    $0x1,%rax
+  809b42:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  809b45:	48 39 c8             	cmp    %rcx,%rax
+  809b48:	75 e9                	jne    809b33 <strlcpy+0x12>
+        *dst = '\0';
+  809b4a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  809b4d:	48 29 f8             	sub    %rdi,%rax
+}
+  809b50:	c3                   	ret
+
+0000000000809b51 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  809b51:	0f b6 07             	movzbl (%rdi),%eax
+  809b54:	84 c0                	test   %al,%al
+  809b56:	74 13                	je     809b6b <strcmp+0x1a>
+  809b58:	38 06                	cmp    %al,(%rsi)
+  809b5a:	75 0f                	jne    809b6b <strcmp+0x1a>
+  809b5c:	48 83 c7 01          	add    $0x1,%rdi
+  809b60:	48 83 c6 01          	add    $0x1,%rsi
+  809b64:	0f b6 07             	movzbl (%rdi),%eax
+  809b67:	84 c0                	test   %al,%al
+  809b69:	75 ed                	jne    809b58 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  809b6b:	0f b6 c0             	movzbl %al,%eax
+  809b6e:	0f b6 16             	movzbl (%rsi),%edx
+  809b71:	29 d0                	sub    %edx,%eax
+}
+  809b73:	c3                   	ret
+
+0000000000809b74 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  809b74:	48 85 d2             	test   %rdx,%rdx
+  809b77:	74 1f                	je     809b98 <strncmp+0x24>
+  809b79:	0f b6 07             	movzbl (%rdi),%eax
+  809b7c:	84 c0                	test   %al,%al
+  809b7e:	74 1e                	je     809b9e <strncmp+0x2a>
+  809b80:	3a 06                	cmp    (%rsi),%al
+  809b82:	75 1a                	jne    809b9e <strncmp+0x2a>
+  809b84:	48 83 c7 01          	add    $0x1,%rdi
+  809b88:	48 83 c6 01          	add    $0x1,%rsi
+  809b8c:	48 83 ea 01          	sub    $0x1,%rdx
+  809b90:	75 e7                	jne    809b79 <strncmp+0x5>
+
+    if (!n) return 0;
+  809b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  809b97:	c3                   	ret
+  809b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  809b9d:	c3                   	ret
+  809b9e:	48 85 d2             	test   %rdx,%rdx
+  809ba1:	74 09                	je     809bac <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  809ba3:	0f b6 07             	movzbl (%rdi),%eax
+  809ba6:	0f b6 16             	movzbl (%rsi),%edx
+  809ba9:	29 d0                	sub    %edx,%eax
+  809bab:	c3                   	ret
+    if (!n) return 0;
+  809bac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  809bb1:	c3                   	ret
+
+0000000000809bb2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  809bb2:	0f b6 17             	movzbl (%rdi),%edx
+  809bb5:	84 d2                	test   %dl,%dl
+  809bb7:	74 18                	je     809bd1 <strchr+0x1f>
+        if (*str == c) {
+  809bb9:	0f be d2             	movsbl %dl,%edx
+  809bbc:	39 f2                	cmp    %esi,%edx
+  809bbe:	74 17                	je     809bd7 <strchr+0x25>
+    for (; *str; str++) {
+  809bc0:	48 83 c7 01          	add    $0x1,%rdi
+  809bc4:	0f b6 17             	movzbl (%rdi),%edx
+  809bc7:	84 d2                	test   %dl,%dl
+  809bc9:	75 ee                	jne    809bb9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  809bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  809bd0:	c3                   	ret
+  809bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  809bd6:	c3                   	ret
+  809bd7:	48 89 f8             	mov    %rdi,%rax
+}
+  809bda:	c3                   	ret
+
+0000000000809bdb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  809bdb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  809bde:	0f b6 17             	movzbl (%rdi),%edx
+  809be1:	84 d2                	test   %dl,%dl
+  809be3:	74 13                	je     809bf8 <strfind+0x1d>
+  809be5:	0f be d2             	movsbl %dl,%edx
+  809be8:	39 f2                	cmp    %esi,%edx
+  809bea:	74 0b                	je     809bf7 <strfind+0x1c>
+  809bec:	48 83 c0 01          	add    $0x1,%rax
+  809bf0:	0f b6 10             	movzbl (%rax),%edx
+  809bf3:	84 d2                	test   %dl,%dl
+  809bf5:	75 ee                	jne    809be5 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  809bf7:	c3                   	ret
+  809bf8:	c3                   	ret
+
+0000000000809bf9 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  809bf9:	55                   	push   %rbp
+  809bfa:	48 89 e5             	mov    %rsp,%rbp
+  809bfd:	41 57                	push   %r15
+  809bff:	41 56                	push   %r14
+  809c01:	41 55                	push   %r13
+  809c03:	41 54                	push   %r12
+  809c05:	53                   	push   %rbx
+  809c06:	48 83 ec 08          	sub    $0x8,%rsp
+  809c0a:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  809c0d:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  809c11:	45 84 ed             	test   %r13b,%r13b
+  809c14:	75 12                	jne    809c28 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  809c16:	4c 89 f8             	mov    %r15,%rax
+  809c19:	48 83 c4 08          	add    $0x8,%rsp
+  809c1d:	5b                   	pop    %rbx
+  809c1e:	41 5c                	pop    %r12
+  809c20:	41 5d                	pop    %r13
+  809c22:	41 5e                	pop    %r14
+  809c24:	41 5f                	pop    %r15
+  809c26:	5d                   	pop    %rbp
+  809c27:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  809c28:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  809c2c:	4c 89 e7             	mov    %r12,%rdi
+  809c2f:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  809c36:	00 00 00 
+  809c39:	ff d0                	call   *%rax
+  809c3b:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  809c3e:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  809c42:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  809c46:	49 bf 74 9b 80 00 00 	movabs $0x809b74,%r15
+  809c4d:	00 00 00 
+				if ((sc = *s++) == 0)
+  809c50:	84 c0                	test   %al,%al
+  809c52:	75 14                	jne    809c68 <strstr+0x6f>
+					return NULL;
+  809c54:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  809c5a:	eb ba                	jmp    809c16 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  809c5c:	48 83 c3 01          	add    $0x1,%rbx
+  809c60:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  809c64:	84 c0                	test   %al,%al
+  809c66:	74 1b                	je     809c83 <strstr+0x8a>
+			} while (sc != c);
+  809c68:	41 38 c5             	cmp    %al,%r13b
+  809c6b:	75 ef                	jne    809c5c <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  809c6d:	4c 89 f2             	mov    %r14,%rdx
+  809c70:	4c 89 e6             	mov    %r12,%rsi
+  809c73:	48 89 df             	mov    %rbx,%rdi
+  809c76:	41 ff d7             	call   *%r15
+  809c79:	85 c0                	test   %eax,%eax
+  809c7b:	75 df                	jne    809c5c <strstr+0x63>
+  809c7d:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  809c81:	eb 93                	jmp    809c16 <strstr+0x1d>
+					return NULL;
+  809c83:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  809c89:	eb 8b                	jmp    809c16 <strstr+0x1d>
+
+0000000000809c8b <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  809c8b:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  809c8d:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  809c90:	8d 57 20             	lea    0x20(%rdi),%edx
+  809c93:	83 f9 1a             	cmp    $0x1a,%ecx
+  809c96:	0f 42 c2             	cmovb  %edx,%eax
+}
+  809c99:	c3                   	ret
+
+0000000000809c9a <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  809c9a:	55                   	push   %rbp
+  809c9b:	48 89 e5             	mov    %rsp,%rbp
+  809c9e:	41 57                	push   %r15
+  809ca0:	41 56                	push   %r14
+  809ca2:	41 55                	push   %r13
+  809ca4:	41 54                	push   %r12
+  809ca6:	53                   	push   %rbx
+  809ca7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  809cab:	48 39 f7             	cmp    %rsi,%rdi
+  809cae:	74 49                	je     809cf9 <strcasecmp+0x5f>
+  809cb0:	49 89 fd             	mov    %rdi,%r13
+  809cb3:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  809cb6:	49 bf 8b 9c 80 00 00 	movabs $0x809c8b,%r15
+  809cbd:	00 00 00 
+  809cc0:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  809cc5:	41 0f b6 fe          	movzbl %r14b,%edi
+  809cc9:	41 ff d7             	call   *%r15
+  809ccc:	89 c3                	mov    %eax,%ebx
+  809cce:	49 83 c4 01          	add    $0x1,%r12
+  809cd2:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  809cd8:	41 ff d7             	call   *%r15
+  809cdb:	29 c3                	sub    %eax,%ebx
+  809cdd:	75 09                	jne    809ce8 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  809cdf:	49 83 c5 01          	add    $0x1,%r13
+  809ce3:	45 84 f6             	test   %r14b,%r14b
+  809ce6:	75 d8                	jne    809cc0 <strcasecmp+0x26>
+}
+  809ce8:	89 d8                	mov    %ebx,%eax
+  809cea:	48 83 c4 08          	add    $0x8,%rsp
+  809cee:	5b                   	pop    %rbx
+  809cef:	41 5c                	pop    %r12
+  809cf1:	41 5d                	pop    %r13
+  809cf3:	41 5e                	pop    %r14
+  809cf5:	41 5f                	pop    %r15
+  809cf7:	5d                   	pop    %rbp
+  809cf8:	c3                   	ret
+        return 0;
+  809cf9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  809cfe:	eb e8                	jmp    809ce8 <strcasecmp+0x4e>
+
+0000000000809d00 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  809d00:	55                   	push   %rbp
+  809d01:	48 89 e5             	mov    %rsp,%rbp
+  809d04:	41 57                	push   %r15
+  809d06:	41 56                	push   %r14
+  809d08:	41 55                	push   %r13
+  809d0a:	41 54                	push   %r12
+  809d0c:	53                   	push   %rbx
+  809d0d:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  809d11:	48 85 d2             	test   %rdx,%rdx
+  809d14:	74 4f                	je     809d65 <strncasecmp+0x65>
+  809d16:	49 89 fc             	mov    %rdi,%r12
+  809d19:	49 89 f5             	mov    %rsi,%r13
+  809d1c:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  809d20:	49 be 8b 9c 80 00 00 	movabs $0x809c8b,%r14
+  809d27:	00 00 00 
+  809d2a:	49 83 c4 01          	add    $0x1,%r12
+  809d2e:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  809d34:	41 ff d6             	call   *%r14
+  809d37:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  809d39:	49 83 c5 01          	add    $0x1,%r13
+  809d3d:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  809d42:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  809d45:	29 c3                	sub    %eax,%ebx
+  809d47:	85 c0                	test   %eax,%eax
+  809d49:	74 09                	je     809d54 <strncasecmp+0x54>
+  809d4b:	85 db                	test   %ebx,%ebx
+  809d4d:	75 05                	jne    809d54 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  809d4f:	4d 39 fc             	cmp    %r15,%r12
+  809d52:	75 d6                	jne    809d2a <strncasecmp+0x2a>
+}
+  809d54:	89 d8                	mov    %ebx,%eax
+  809d56:	48 83 c4 08          	add    $0x8,%rsp
+  809d5a:	5b                   	pop    %rbx
+  809d5b:	41 5c                	pop    %r12
+  809d5d:	41 5d                	pop    %r13
+  809d5f:	41 5e                	pop    %r14
+  809d61:	41 5f                	pop    %r15
+  809d63:	5d                   	pop    %rbp
+  809d64:	c3                   	ret
+    int d = 0;
+  809d65:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  809d6a:	eb e8                	jmp    809d54 <strncasecmp+0x54>
+
+0000000000809d6c <toupper>:
+
+int toupper(int c) {
+  809d6c:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  809d6e:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  809d71:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  809d74:	83 f9 1a             	cmp    $0x1a,%ecx
+  809d77:	0f 42 c2             	cmovb  %edx,%eax
+}
+  809d7a:	c3                   	ret
+
+0000000000809d7b <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  809d7b:	83 ff 20             	cmp    $0x20,%edi
+  809d7e:	0f 94 c0             	sete   %al
+  809d81:	0f b6 c0             	movzbl %al,%eax
+}
+  809d84:	c3                   	ret
+
+0000000000809d85 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  809d85:	89 f8                	mov    %edi,%eax
+  809d87:	f7 d8                	neg    %eax
+  809d89:	0f 48 c7             	cmovs  %edi,%eax
+}
+  809d8c:	c3                   	ret
+
+0000000000809d8d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  809d8d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  809d90:	48 89 f8             	mov    %rdi,%rax
+  809d93:	48 f7 d8             	neg    %rax
+  809d96:	83 e0 07             	and    $0x7,%eax
+  809d99:	49 89 d1             	mov    %rdx,%r9
+  809d9c:	49 29 c1             	sub    %rax,%r9
+  809d9f:	78 36                	js     809dd7 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  809da1:	40 0f b6 c6          	movzbl %sil,%eax
+  809da5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  809dac:	01 01 01 
+  809daf:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  809db3:	40 f6 c7 07          	test   $0x7,%dil
+  809db7:	75 38                	jne    809df1 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  809db9:	4c 89 c9             	mov    %r9,%rcx
+  809dbc:	48 c1 f9 03          	sar    $0x3,%rcx
+  809dc0:	74 0c                	je     809dce <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  809dc2:	fc                   	cld
+  809dc3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  809dc6:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  809dca:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  809dce:	4d 85 c9             	test   %r9,%r9
+  809dd1:	75 45                	jne    809e18 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  809dd3:	4c 89 c0             	mov    %r8,%rax
+  809dd6:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  809dd7:	48 85 d2             	test   %rdx,%rdx
+  809dda:	74 f7                	je     809dd3 <memset+0x46>
+  809ddc:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  809ddf:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  809de2:	48 83 c0 01          	add    $0x1,%rax
+  809de6:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  809dea:	48 39 c2             	cmp    %rax,%rdx
+  809ded:	75 f3                	jne    809de2 <memset+0x55>
+  809def:	eb e2                	jmp    809dd3 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  809df1:	40 f6 c7 01          	test   $0x1,%dil
+  809df5:	74 06                	je     809dfd <memset+0x70>
+  809df7:	88 07                	mov    %al,(%rdi)
+  809df9:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  809dfd:	40 f6 c7 02          	test   $0x2,%dil
+  809e01:	74 07                	je     809e0a <memset+0x7d>
+  809e03:	66 89 07             	mov    %ax,(%rdi)
+  809e06:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  809e0a:	40 f6 c7 04          	test   $0x4,%dil
+  809e0e:	74 a9                	je     809db9 <memset+0x2c>
+  809e10:	89 07                	mov    %eax,(%rdi)
+  809e12:	48 83 c7 04          	add    $0x4,%rdi
+  809e16:	eb a1                	jmp    809db9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  809e18:	41 f6 c1 04          	test   $0x4,%r9b
+  809e1c:	74 06                	je     809e24 <memset+0x97>
+  809e1e:	89 07                	mov    %eax,(%rdi)
+  809e20:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  809e24:	41 f6 c1 02          	test   $0x2,%r9b
+  809e28:	74 07                	je     809e31 <memset+0xa4>
+  809e2a:	66 89 07             	mov    %ax,(%rdi)
+  809e2d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  809e31:	41 f6 c1 01          	test   $0x1,%r9b
+  809e35:	74 9c                	je     809dd3 <memset+0x46>
+  809e37:	88 07                	mov    %al,(%rdi)
+  809e39:	eb 98                	jmp    809dd3 <memset+0x46>
+
+0000000000809e3b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  809e3b:	48 89 f8             	mov    %rdi,%rax
+  809e3e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  809e41:	48 39 fe             	cmp    %rdi,%rsi
+  809e44:	73 3b                	jae    809e81 <memmove+0x46>
+  809e46:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  809e4a:	48 39 d7             	cmp    %rdx,%rdi
+  809e4d:	73 32                	jae    809e81 <memmove+0x46>
+        s += n;
+        d += n;
+  809e4f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  809e53:	48 89 d6             	mov    %rdx,%rsi
+  809e56:	48 09 fe             	or     %rdi,%rsi
+  809e59:	48 09 ce             	or     %rcx,%rsi
+  809e5c:	40 f6 c6 07          	test   $0x7,%sil
+  809e60:	75 12                	jne    809e74 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  809e62:	48 83 ef 08          	sub    $0x8,%rdi
+  809e66:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  809e6a:	48 c1 e9 03          	shr    $0x3,%rcx
+  809e6e:	fd                   	std
+  809e6f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  809e72:	fc                   	cld
+  809e73:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  809e74:	48 83 ef 01          	sub    $0x1,%rdi
+  809e78:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  809e7c:	fd                   	std
+  809e7d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  809e7f:	eb f1                	jmp    809e72 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  809e81:	48 89 f2             	mov    %rsi,%rdx
+  809e84:	48 09 c2             	or     %rax,%rdx
+  809e87:	48 09 ca             	or     %rcx,%rdx
+  809e8a:	f6 c2 07             	test   $0x7,%dl
+  809e8d:	75 0c                	jne    809e9b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  809e8f:	48 c1 e9 03          	shr    $0x3,%rcx
+  809e93:	48 89 c7             	mov    %rax,%rdi
+  809e96:	fc                   	cld
+  809e97:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  809e9a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  809e9b:	48 89 c7             	mov    %rax,%rdi
+  809e9e:	fc                   	cld
+  809e9f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  809ea1:	c3                   	ret
+
+0000000000809ea2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  809ea2:	55                   	push   %rbp
+  809ea3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  809ea6:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  809ead:	00 00 00 
+  809eb0:	ff d0                	call   *%rax
+}
+  809eb2:	5d                   	pop    %rbp
+  809eb3:	c3                   	ret
+
+0000000000809eb4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  809eb4:	55                   	push   %rbp
+  809eb5:	48 89 e5             	mov    %rsp,%rbp
+  809eb8:	41 57                	push   %r15
+  809eba:	41 56                	push   %r14
+  809ebc:	41 55                	push   %r13
+  809ebe:	41 54                	push   %r12
+  809ec0:	53                   	push   %rbx
+  809ec1:	48 83 ec 08          	sub    $0x8,%rsp
+  809ec5:	49 89 fe             	mov    %rdi,%r14
+  809ec8:	49 89 f7             	mov    %rsi,%r15
+  809ecb:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  809ece:	48 89 f7             	mov    %rsi,%rdi
+  809ed1:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  809ed8:	00 00 00 
+  809edb:	ff d0                	call   *%rax
+  809edd:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  809ee0:	48 89 de             	mov    %rbx,%rsi
+  809ee3:	4c 89 f7             	mov    %r14,%rdi
+  809ee6:	48 b8 8a 9a 80 00 00 	movabs $0x809a8a,%rax
+  809eed:	00 00 00 
+  809ef0:	ff d0                	call   *%rax
+  809ef2:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  809ef5:	48 39 c3             	cmp    %rax,%rbx
+  809ef8:	74 36                	je     809f30 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  809efa:	48 89 d8             	mov    %rbx,%rax
+  809efd:	4c 29 e8             	sub    %r13,%rax
+  809f00:	49 39 c4             	cmp    %rax,%r12
+  809f03:	73 31                	jae    809f36 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  809f05:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  809f0a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  809f0e:	4c 89 fe             	mov    %r15,%rsi
+  809f11:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  809f18:	00 00 00 
+  809f1b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  809f1d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  809f21:	48 83 c4 08          	add    $0x8,%rsp
+  809f25:	5b                   	pop    %rbx
+  809f26:	41 5c                	pop    %r12
+  809f28:	41 5d                	pop    %r13
+  809f2a:	41 5e                	pop    %r14
+  809f2c:	41 5f                	pop    %r15
+  809f2e:	5d                   	pop    %rbp
+  809f2f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  809f30:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  809f34:	eb eb                	jmp    809f21 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  809f36:	48 83 eb 01          	sub    $0x1,%rbx
+  809f3a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  809f3e:	48 89 da             	mov    %rbx,%rdx
+  809f41:	4c 89 fe             	mov    %r15,%rsi
+  809f44:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  809f4b:	00 00 00 
+  809f4e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  809f50:	49 01 de             	add    %rbx,%r14
+  809f53:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  809f58:	eb c3                	jmp    809f1d <strlcat+0x69>
+
+0000000000809f5a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  809f5a:	48 85 d2             	test   %rdx,%rdx
+  809f5d:	74 2d                	je     809f8c <memcmp+0x32>
+  809f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  809f64:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  809f68:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  809f6d:	44 38 c1             	cmp    %r8b,%cl
+  809f70:	75 0f                	jne    809f81 <memcmp+0x27>
+    while (n-- > 0) {
+  809f72:	48 83 c0 01          	add    $0x1,%rax
+  809f76:	48 39 c2             	cmp    %rax,%rdx
+  809f79:	75 e9                	jne    809f64 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  809f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  809f80:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  809f81:	0f b6 c1             	movzbl %cl,%eax
+  809f84:	45 0f b6 c0          	movzbl %r8b,%r8d
+  809f88:	44 29 c0             	sub    %r8d,%eax
+  809f8b:	c3                   	ret
+    return 0;
+  809f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  809f91:	c3                   	ret
+
+0000000000809f92 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  809f92:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  809f96:	48 39 c7             	cmp    %rax,%rdi
+  809f99:	73 0f                	jae    809faa <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  809f9b:	40 38 37             	cmp    %sil,(%rdi)
+  809f9e:	74 0e                	je     809fae <memfind+0x1c>
+    for (; src < end; src++) {
+  809fa0:	48 83 c7 01          	add    $0x1,%rdi
+  809fa4:	48 39 f8             	cmp    %rdi,%rax
+  809fa7:	75 f2                	jne    809f9b <memfind+0x9>
+  809fa9:	c3                   	ret
+  809faa:	48 89 f8             	mov    %rdi,%rax
+  809fad:	c3                   	ret
+  809fae:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  809fb1:	c3                   	ret
+
+0000000000809fb2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  809fb2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  809fb5:	0f b6 37             	movzbl (%rdi),%esi
+  809fb8:	40 80 fe 20          	cmp    $0x20,%sil
+  809fbc:	74 06                	je     809fc4 <strtol+0x12>
+  809fbe:	40 80 fe 09          	cmp    $0x9,%sil
+  809fc2:	75 13                	jne    809fd7 <strtol+0x25>
+  809fc4:	48 83 c7 01          	add    $0x1,%rdi
+  809fc8:	0f b6 37             	movzbl (%rdi),%esi
+  809fcb:	40 80 fe 20          	cmp    $0x20,%sil
+  809fcf:	74 f3                	je     809fc4 <strtol+0x12>
+  809fd1:	40 80 fe 09          	cmp    $0x9,%sil
+  809fd5:	74 ed                	je     809fc4 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  809fd7:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  809fda:	83 e0 fd             	and    $0xfffffffd,%eax
+  809fdd:	3c 01                	cmp    $0x1,%al
+  809fdf:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  809fe3:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  809fe9:	75 0f                	jne    809ffa <strtol+0x48>
+  809feb:	80 3f 30             	cmpb   $0x30,(%rdi)
+  809fee:	74 14                	je     80a004 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  809ff0:	85 d2                	test   %edx,%edx
+  809ff2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  809ff7:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  809ffa:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  809fff:	4c 63 ca             	movslq %edx,%r9
+  80a002:	eb 36                	jmp    80a03a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80a004:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80a008:	74 0f                	je     80a019 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80a00a:	85 d2                	test   %edx,%edx
+  80a00c:	75 ec                	jne    809ffa <strtol+0x48>
+        s++;
+  80a00e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80a012:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80a017:	eb e1                	jmp    809ffa <strtol+0x48>
+        s += 2;
+  80a019:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80a01d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80a022:	eb d6                	jmp    809ffa <strtol+0x48>
+            dig -= '0';
+  80a024:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80a027:	44 0f b6 c1          	movzbl %cl,%r8d
+  80a02b:	41 39 d0             	cmp    %edx,%r8d
+  80a02e:	7d 21                	jge    80a051 <strtol+0x9f>
+        val = val * base + dig;
+  80a030:	49 0f af c1          	imul   %r9,%rax
+  80a034:	0f b6 c9             	movzbl %cl,%ecx
+  80a037:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80a03a:	48 83 c7 01          	add    $0x1,%rdi
+  80a03e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80a042:	80 f9 39             	cmp    $0x39,%cl
+  80a045:	76 dd                	jbe    80a024 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80a047:	80 f9 7b             	cmp    $0x7b,%cl
+  80a04a:	77 05                	ja     80a051 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80a04c:	83 e9 57             	sub    $0x57,%ecx
+  80a04f:	eb d6                	jmp    80a027 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80a051:	4d 85 d2             	test   %r10,%r10
+  80a054:	74 03                	je     80a059 <strtol+0xa7>
+  80a056:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80a059:	48 89 c2             	mov    %rax,%rdx
+  80a05c:	48 f7 da             	neg    %rdx
+  80a05f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80a063:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80a067:	c3                   	ret
+
+000000000080a068 <atoi>:
+int atoi(const char *str) {
+  80a068:	55                   	push   %rbp
+  80a069:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  80a06c:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a071:	be 00 00 00 00       	mov    $0x0,%esi
+  80a076:	48 b8 b2 9f 80 00 00 	movabs $0x809fb2,%rax
+  80a07d:	00 00 00 
+  80a080:	ff d0                	call   *%rax
+}
+  80a082:	5d                   	pop    %rbp
+  80a083:	c3                   	ret
+
+000000000080a084 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80a084:	55                   	push   %rbp
+  80a085:	48 89 e5             	mov    %rsp,%rbp
+  80a088:	53                   	push   %rbx
+  80a089:	48 89 fa             	mov    %rdi,%rdx
+  80a08c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80a08f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a094:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a099:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a09e:	be 00 00 00 00       	mov    $0x0,%esi
+  80a0a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a0a9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80a0ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a0af:	c9                   	leave
+  80a0b0:	c3                   	ret
+
+000000000080a0b1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80a0b1:	55                   	push   %rbp
+  80a0b2:	48 89 e5             	mov    %rsp,%rbp
+  80a0b5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80a0b6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a0bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a0c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a0c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a0ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a0cf:	be 00 00 00 00       	mov    $0x0,%esi
+  80a0d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a0da:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80a0dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a0e0:	c9                   	leave
+  80a0e1:	c3                   	ret
+
+000000000080a0e2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80a0e2:	55                   	push   %rbp
+  80a0e3:	48 89 e5             	mov    %rsp,%rbp
+  80a0e6:	53                   	push   %rbx
+  80a0e7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80a0eb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80a0ee:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a0f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a0f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a0fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a102:	be 00 00 00 00       	mov    $0x0,%esi
+  80a107:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a10d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80a10f:	48 85 c0             	test   %rax,%rax
+  80a112:	7f 06                	jg     80a11a <sys_env_destroy+0x38>
+}
+  80a114:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a118:	c9                   	leave
+  80a119:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80a11a:	49 89 c0             	mov    %rax,%r8
+  80a11d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80a122:	48 ba 80 f0 80 00 00 	movabs $0x80f080,%rdx
+  80a129:	00 00 00 
+  80a12c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80a131:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a138:	00 00 00 
+  80a13b:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a140:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80a147:	00 00 00 
+  80a14a:	41 ff d1             	call   *%r9
+
+000000000080a14d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80a14d:	55                   	push   %rbp
+  80a14e:	48 89 e5             	mov    %rsp,%rbp
+  80a151:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80a152:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a157:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a15c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a161:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a166:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a16b:	be 00 00 00 00       	mov    $0x0,%esi
+  80a170:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a176:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80a178:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a17c:	c9                   	leave
+  80a17d:	c3                   	ret
+
+000000000080a17e <sys_yield>:
+
+void
+sys_yield(void) {
+  80a17e:	55                   	push   %rbp
+  80a17f:	48 89 e5             	mov    %rsp,%rbp
+  80a182:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80a183:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a188:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a18d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a192:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a197:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a19c:	be 00 00 00 00       	mov    $0x0,%esi
+  80a1a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a1a7:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80a1a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a1ad:	c9                   	leave
+  80a1ae:	c3                   	ret
+
+000000000080a1af <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80a1af:	55                   	push   %rbp
+  80a1b0:	48 89 e5             	mov    %rsp,%rbp
+  80a1b3:	53                   	push   %rbx
+  80a1b4:	48 89 fa             	mov    %rdi,%rdx
+  80a1b7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80a1ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a1bf:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80a1c6:	00 00 00 
+  80a1c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a1ce:	be 00 00 00 00       	mov    $0x0,%esi
+  80a1d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a1d9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80a1db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a1df:	c9                   	leave
+  80a1e0:	c3                   	ret
+
+000000000080a1e1 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80a1e1:	55                   	push   %rbp
+  80a1e2:	48 89 e5             	mov    %rsp,%rbp
+  80a1e5:	53                   	push   %rbx
+  80a1e6:	49 89 f8             	mov    %rdi,%r8
+  80a1e9:	48 89 d3             	mov    %rdx,%rbx
+  80a1ec:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80a1ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a1f4:	4c 89 c2             	mov    %r8,%rdx
+  80a1f7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a1fa:	be 00 00 00 00       	mov    $0x0,%esi
+  80a1ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a205:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80a207:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a20b:	c9                   	leave
+  80a20c:	c3                   	ret
+
+000000000080a20d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80a20d:	55                   	push   %rbp
+  80a20e:	48 89 e5             	mov    %rsp,%rbp
+  80a211:	53                   	push   %rbx
+  80a212:	48 83 ec 08          	sub    $0x8,%rsp
+  80a216:	89 f8                	mov    %edi,%eax
+  80a218:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80a21b:	48 63 f9             	movslq %ecx,%rdi
+  80a21e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80a221:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a226:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a229:	be 00 00 00 00       	mov    $0x0,%esi
+  80a22e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a234:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80a236:	48 85 c0             	test   %rax,%rax
+  80a239:	7f 06                	jg     80a241 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80a23b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a23f:	c9                   	leave
+  80a240:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80a241:	49 89 c0             	mov    %rax,%r8
+  80a244:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80a249:	48 ba 80 f0 80 00 00 	movabs $0x80f080,%rdx
+  80a250:	00 00 00 
+  80a253:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80a258:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a25f:	00 00 00 
+  80a262:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a267:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80a26e:	00 00 00 
+  80a271:	41 ff d1             	call   *%r9
+
+000000000080a274 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80a274:	55                   	push   %rbp
+  80a275:	48 89 e5             	mov    %rsp,%rbp
+  80a278:	53                   	push   %rbx
+  80a279:	48 83 ec 08          	sub    $0x8,%rsp
+  80a27d:	89 f8                	mov    %edi,%eax
+  80a27f:	49 89 f2             	mov    %rsi,%r10
+  80a282:	48 89 cf             	mov    %rcx,%rdi
+  80a285:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80a288:	48 63 da             	movslq %edx,%rbx
+  80a28b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80a28e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a293:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a296:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80a299:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80a29b:	48 85 c0             	test   %rax,%rax
+  80a29e:	7f 06                	jg     80a2a6 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80a2a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a2a4:	c9                   	leave
+  80a2a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80a2a6:	49 89 c0             	mov    %rax,%r8
+  80a2a9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80a2ae:	48 ba 80 f0 80 00 00 	movabs $0x80f080,%rdx
+  80a2b5:	00 00 00 
+  80a2b8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80a2bd:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a2c4:	00 00 00 
+  80a2c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a2cc:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80a2d3:	00 00 00 
+  80a2d6:	41 ff d1             	call   *%r9
+
+000000000080a2d9 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80a2d9:	55                   	push   %rbp
+  80a2da:	48 89 e5             	mov    %rsp,%rbp
+  80a2dd:	53                   	push   %rbx
+  80a2de:	48 83 ec 08          	sub    $0x8,%rsp
+  80a2e2:	49 89 f9             	mov    %rdi,%r9
+  80a2e5:	89 f0                	mov    %esi,%eax
+  80a2e7:	48 89 d3             	mov    %rdx,%rbx
+  80a2ea:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80a2ed:	49 63 f0             	movslq %r8d,%rsi
+  80a2f0:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80a2f3:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a2f8:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a2fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a301:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80a303:	48 85 c0             	test   %rax,%rax
+  80a306:	7f 06                	jg     80a30e <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80a308:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a30c:	c9                   	leave
+  80a30d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80a30e:	49 89 c0             	mov    %rax,%r8
+  80a311:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80a316:	48 ba 80 f0 80 00 00 	movabs $0x80f080,%rdx
+  80a31d:	00 00 00 
+  80a320:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80a325:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a32c:	00 00 00 
+  80a32f:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a334:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80a33b:	00 00 00 
+  80a33e:	41 ff d1             	call   *%r9
+
+000000000080a341 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  80a341:	55                   	push   %rbp
+  80a342:	48 89 e5             	mov    %rsp,%rbp
+  80a345:	53                   	push   %rbx
+  80a346:	89 f8                	mov    %edi,%eax
+  80a348:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80a34b:	48 63 f9             	movslq %ecx,%rdi
+  80a34e:	48 63 da             	movslq %edx,%rbx
+  80a351:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80a354:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a359:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a35c:	be 00 00 00 00       	mov    $0x0,%esi
+  80a361:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a367:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80a369:	89 c2                	mov    %eax,%edx
+  80a36b:	48 85 c0             	test   %rax,%rax
+  80a36e:	78 0d                	js     80a37d <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  80a370:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80a375:	4d 85 c9             	test   %r9,%r9
+  80a378:	74 03                	je     80a37d <sys_alloc_dma_region+0x3c>
+  80a37a:	49 89 01             	mov    %rax,(%r9)
+}
+  80a37d:	89 d0                	mov    %edx,%eax
+  80a37f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a383:	c9                   	leave
+  80a384:	c3                   	ret
+
+000000000080a385 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80a385:	55                   	push   %rbp
+  80a386:	48 89 e5             	mov    %rsp,%rbp
+  80a389:	53                   	push   %rbx
+  80a38a:	48 83 ec 08          	sub    $0x8,%rsp
+  80a38e:	48 89 f1             	mov    %rsi,%rcx
+  80a391:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80a394:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80a397:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a39c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a3a1:	be 00 00 00 00       	mov    $0x0,%esi
+  80a3a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a3ac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80a3ae:	48 85 c0             	test   %rax,%rax
+  80a3b1:	7f 06                	jg     80a3b9 <sys_set_cache_region+0x34>
+}
+  80a3b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a3b7:	c9                   	leave
+  80a3b8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80a3b9:	49 89 c0             	mov    %rax,%r8
+  80a3bc:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80a3c1:	48 ba 80 f0 80 00 00 	movabs $0x80f080,%rdx
+  80a3c8:	00 00 00 
+  80a3cb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80a3d0:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a3d7:	00 00 00 
+  80a3da:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a3df:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80a3e6:	00 00 00 
+  80a3e9:	41 ff d1             	call   *%r9
+
+000000000080a3ec <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80a3ec:	55                   	push   %rbp
+  80a3ed:	48 89 e5             	mov    %rsp,%rbp
+  80a3f0:	53                   	push   %rbx
+  80a3f1:	48 83 ec 08          	sub    $0x8,%rsp
+  80a3f5:	48 89 f1             	mov    %rsi,%rcx
+  80a3f8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80a3fb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80a3fe:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a403:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a408:	be 00 00 00 00       	mov    $0x0,%esi
+  80a40d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a413:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80a415:	48 85 c0             	test   %rax,%rax
+  80a418:	7f 06                	jg     80a420 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80a41a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a41e:	c9                   	leave
+  80a41f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80a420:	49 89 c0             	mov    %rax,%r8
+  80a423:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80a428:	48 ba 80 f0 80 00 00 	movabs $0x80f080,%rdx
+  80a42f:	00 00 00 
+  80a432:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80a437:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a43e:	00 00 00 
+  80a441:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a446:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80a44d:	00 00 00 
+  80a450:	41 ff d1             	call   *%r9
+
+000000000080a453 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80a453:	55                   	push   %rbp
+  80a454:	48 89 e5             	mov    %rsp,%rbp
+  80a457:	53                   	push   %rbx
+  80a458:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80a45c:	48 63 ce             	movslq %esi,%rcx
+  80a45f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80a462:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a467:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a46c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a471:	be 00 00 00 00       	mov    $0x0,%esi
+  80a476:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a47c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80a47e:	48 85 c0             	test   %rax,%rax
+  80a481:	7f 06                	jg     80a489 <sys_env_set_status+0x36>
+}
+  80a483:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a487:	c9                   	leave
+  80a488:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80a489:	49 89 c0             	mov    %rax,%r8
+  80a48c:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80a491:	48 ba 80 f0 80 00 00 	movabs $0x80f080,%rdx
+  80a498:	00 00 00 
+  80a49b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80a4a0:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a4a7:	00 00 00 
+  80a4aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a4af:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80a4b6:	00 00 00 
+  80a4b9:	41 ff d1             	call   *%r9
+
+000000000080a4bc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80a4bc:	55                   	push   %rbp
+  80a4bd:	48 89 e5             	mov    %rsp,%rbp
+  80a4c0:	53                   	push   %rbx
+  80a4c1:	48 83 ec 08          	sub    $0x8,%rsp
+  80a4c5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80a4c8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80a4cb:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a4d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a4d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a4da:	be 00 00 00 00       	mov    $0x0,%esi
+  80a4df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a4e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80a4e7:	48 85 c0             	test   %rax,%rax
+  80a4ea:	7f 06                	jg     80a4f2 <sys_env_set_trapframe+0x36>
+}
+  80a4ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a4f0:	c9                   	leave
+  80a4f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80a4f2:	49 89 c0             	mov    %rax,%r8
+  80a4f5:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80a4fa:	48 ba 80 f0 80 00 00 	movabs $0x80f080,%rdx
+  80a501:	00 00 00 
+  80a504:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80a509:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a510:	00 00 00 
+  80a513:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a518:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80a51f:	00 00 00 
+  80a522:	41 ff d1             	call   *%r9
+
+000000000080a525 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80a525:	55                   	push   %rbp
+  80a526:	48 89 e5             	mov    %rsp,%rbp
+  80a529:	53                   	push   %rbx
+  80a52a:	48 83 ec 08          	sub    $0x8,%rsp
+  80a52e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80a531:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80a534:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a539:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a53e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a543:	be 00 00 00 00       	mov    $0x0,%esi
+  80a548:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a54e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80a550:	48 85 c0             	test   %rax,%rax
+  80a553:	7f 06                	jg     80a55b <sys_env_set_pgfault_upcall+0x36>
+}
+  80a555:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a559:	c9                   	leave
+  80a55a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80a55b:	49 89 c0             	mov    %rax,%r8
+  80a55e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80a563:	48 ba 80 f0 80 00 00 	movabs $0x80f080,%rdx
+  80a56a:	00 00 00 
+  80a56d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80a572:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a579:	00 00 00 
+  80a57c:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a581:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80a588:	00 00 00 
+  80a58b:	41 ff d1             	call   *%r9
+
+000000000080a58e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80a58e:	55                   	push   %rbp
+  80a58f:	48 89 e5             	mov    %rsp,%rbp
+  80a592:	53                   	push   %rbx
+  80a593:	89 f8                	mov    %edi,%eax
+  80a595:	49 89 f1             	mov    %rsi,%r9
+  80a598:	48 89 d3             	mov    %rdx,%rbx
+  80a59b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80a59e:	49 63 f0             	movslq %r8d,%rsi
+  80a5a1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80a5a4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a5a9:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a5ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a5b2:	cd 30                	int    $0x30
+}
+  80a5b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a5b8:	c9                   	leave
+  80a5b9:	c3                   	ret
+
+000000000080a5ba <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80a5ba:	55                   	push   %rbp
+  80a5bb:	48 89 e5             	mov    %rsp,%rbp
+  80a5be:	53                   	push   %rbx
+  80a5bf:	48 83 ec 08          	sub    $0x8,%rsp
+  80a5c3:	48 89 fa             	mov    %rdi,%rdx
+  80a5c6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80a5c9:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a5ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a5d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a5d8:	be 00 00 00 00       	mov    $0x0,%esi
+  80a5dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a5e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80a5e5:	48 85 c0             	test   %rax,%rax
+  80a5e8:	7f 06                	jg     80a5f0 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80a5ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a5ee:	c9                   	leave
+  80a5ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80a5f0:	49 89 c0             	mov    %rax,%r8
+  80a5f3:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80a5f8:	48 ba 80 f0 80 00 00 	movabs $0x80f080,%rdx
+  80a5ff:	00 00 00 
+  80a602:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80a607:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a60e:	00 00 00 
+  80a611:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a616:	49 b9 e5 8f 80 00 00 	movabs $0x808fe5,%r9
+  80a61d:	00 00 00 
+  80a620:	41 ff d1             	call   *%r9
+
+000000000080a623 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  80a623:	55                   	push   %rbp
+  80a624:	48 89 e5             	mov    %rsp,%rbp
+  80a627:	53                   	push   %rbx
+  80a628:	48 89 fa             	mov    %rdi,%rdx
+  80a62b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80a62e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a633:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a638:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a63d:	be 00 00 00 00       	mov    $0x0,%esi
+  80a642:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a648:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80a64a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a64e:	c9                   	leave
+  80a64f:	c3                   	ret
+
+000000000080a650 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80a650:	55                   	push   %rbp
+  80a651:	48 89 e5             	mov    %rsp,%rbp
+  80a654:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80a655:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80a65a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a65f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80a664:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80a669:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80a66e:	be 00 00 00 00       	mov    $0x0,%esi
+  80a673:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80a679:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80a67b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a67f:	c9                   	leave
+  80a680:	c3                   	ret
+
+000000000080a681 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80a681:	48 85 ff             	test   %rdi,%rdi
+  80a684:	0f 84 b6 01 00 00    	je     80a840 <malloc+0x1bf>
+malloc(size_t size) {
+  80a68a:	55                   	push   %rbp
+  80a68b:	48 89 e5             	mov    %rsp,%rbp
+  80a68e:	41 56                	push   %r14
+  80a690:	41 55                	push   %r13
+  80a692:	41 54                	push   %r12
+  80a694:	53                   	push   %rbx
+  80a695:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80a698:	48 b8 e8 62 8c 00 00 	movabs $0x8c62e8,%rax
+  80a69f:	00 00 00 
+  80a6a2:	4c 8b 20             	mov    (%rax),%r12
+  80a6a5:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80a6ac:	0f 87 94 01 00 00    	ja     80a846 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  80a6b2:	48 a1 e0 62 8c 00 00 	movabs 0x8c62e0,%rax
+  80a6b9:	00 00 00 
+  80a6bc:	48 85 c0             	test   %rax,%rax
+  80a6bf:	74 6b                	je     80a72c <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80a6c1:	4d 85 e4             	test   %r12,%r12
+  80a6c4:	74 66                	je     80a72c <malloc+0xab>
+  80a6c6:	48 ba 08 63 8c 00 00 	movabs $0x8c6308,%rdx
+  80a6cd:	00 00 00 
+  80a6d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80a6d5:	eb 0d                	jmp    80a6e4 <malloc+0x63>
+  80a6d7:	48 83 c1 01          	add    $0x1,%rcx
+  80a6db:	48 83 c2 18          	add    $0x18,%rdx
+  80a6df:	49 39 cc             	cmp    %rcx,%r12
+  80a6e2:	74 48                	je     80a72c <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80a6e4:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80a6e9:	74 ec                	je     80a6d7 <malloc+0x56>
+  80a6eb:	48 39 1a             	cmp    %rbx,(%rdx)
+  80a6ee:	72 e7                	jb     80a6d7 <malloc+0x56>
+                real_freep_size--;
+  80a6f0:	48 83 e8 01          	sub    $0x1,%rax
+  80a6f4:	48 a3 e0 62 8c 00 00 	movabs %rax,0x8c62e0
+  80a6fb:	00 00 00 
+                freep[i].is_free = false;
+  80a6fe:	48 ba 00 63 8c 00 00 	movabs $0x8c6300,%rdx
+  80a705:	00 00 00 
+  80a708:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80a70c:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  80a710:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  80a714:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  80a71b:	00 
+                freep[i].size = size;
+  80a71c:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  80a720:	48 01 c8             	add    %rcx,%rax
+  80a723:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80a727:	e9 0b 01 00 00       	jmp    80a837 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  80a72c:	48 a1 90 50 81 00 00 	movabs 0x815090,%rax
+  80a733:	00 00 00 
+  80a736:	48 01 d8             	add    %rbx,%rax
+  80a739:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  80a73f:	76 7c                	jbe    80a7bd <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  80a741:	48 b8 98 50 81 00 00 	movabs $0x815098,%rax
+  80a748:	00 00 00 
+  80a74b:	4c 8b 30             	mov    (%rax),%r14
+  80a74e:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  80a755:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  80a758:	48 b8 90 50 81 00 00 	movabs $0x815090,%rax
+  80a75f:	00 00 00 
+  80a762:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  80a769:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  80a770:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80a776:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80a77a:	48 b8 4d a1 80 00 00 	movabs $0x80a14d,%rax
+  80a781:	00 00 00 
+  80a784:	ff d0                	call   *%rax
+  80a786:	89 c7                	mov    %eax,%edi
+  80a788:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80a78f:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80a796:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80a79d:	00 00 00 
+  80a7a0:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80a7a4:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80a7a9:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  80a7b0:	00 00 00 
+  80a7b3:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80a7b5:	85 c0                	test   %eax,%eax
+  80a7b7:	0f 88 90 00 00 00    	js     80a84d <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80a7bd:	48 b9 98 50 81 00 00 	movabs $0x815098,%rcx
+  80a7c4:	00 00 00 
+  80a7c7:	48 8b 31             	mov    (%rcx),%rsi
+  80a7ca:	48 bf 90 50 81 00 00 	movabs $0x815090,%rdi
+  80a7d1:	00 00 00 
+  80a7d4:	4c 8b 07             	mov    (%rdi),%r8
+  80a7d7:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80a7db:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  80a7e2:	00 00 00 
+  80a7e5:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80a7e9:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80a7ed:	48 b8 00 63 8c 00 00 	movabs $0x8c6300,%rax
+  80a7f4:	00 00 00 
+  80a7f7:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80a7fb:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80a7fe:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  80a802:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80a809:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  80a80a:	48 89 d8             	mov    %rbx,%rax
+  80a80d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80a812:	4c 01 c0             	add    %r8,%rax
+  80a815:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  80a818:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80a81f:	48 01 f3             	add    %rsi,%rbx
+  80a822:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  80a825:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  80a82a:	48 a3 e8 62 8c 00 00 	movabs %rax,0x8c62e8
+  80a831:	00 00 00 
+  80a834:	48 89 d0             	mov    %rdx,%rax
+}
+  80a837:	5b                   	pop    %rbx
+  80a838:	41 5c                	pop    %r12
+  80a83a:	41 5d                	pop    %r13
+  80a83c:	41 5e                	pop    %r14
+  80a83e:	5d                   	pop    %rbp
+  80a83f:	c3                   	ret
+        return NULL;
+  80a840:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80a845:	c3                   	ret
+        return NULL;
+  80a846:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a84b:	eb ea                	jmp    80a837 <malloc+0x1b6>
+            return NULL;
+  80a84d:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a852:	eb e3                	jmp    80a837 <malloc+0x1b6>
+
+000000000080a854 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  80a854:	55                   	push   %rbp
+  80a855:	48 89 e5             	mov    %rsp,%rbp
+  80a858:	53                   	push   %rbx
+  80a859:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  80a85d:	48 89 fb             	mov    %rdi,%rbx
+  80a860:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  80a864:	48 89 df             	mov    %rbx,%rdi
+  80a867:	48 b8 81 a6 80 00 00 	movabs $0x80a681,%rax
+  80a86e:	00 00 00 
+  80a871:	ff d0                	call   *%rax
+  80a873:	48 89 c7             	mov    %rax,%rdi
+  80a876:	48 89 da             	mov    %rbx,%rdx
+  80a879:	be 00 00 00 00       	mov    $0x0,%esi
+  80a87e:	48 b8 8d 9d 80 00 00 	movabs $0x809d8d,%rax
+  80a885:	00 00 00 
+  80a888:	ff d0                	call   *%rax
+}
+  80a88a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a88e:	c9                   	leave
+  80a88f:	c3                   	ret
+
+000000000080a890 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  80a890:	48 a1 e8 62 8c 00 00 	movabs 0x8c62e8,%rax
+  80a897:	00 00 00 
+  80a89a:	48 ba e0 62 8c 00 00 	movabs $0x8c62e0,%rdx
+  80a8a1:	00 00 00 
+  80a8a4:	48 3b 02             	cmp    (%rdx),%rax
+  80a8a7:	74 4d                	je     80a8f6 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  80a8a9:	48 85 c0             	test   %rax,%rax
+  80a8ac:	74 4d                	je     80a8fb <get_allocsize+0x6b>
+  80a8ae:	48 b9 00 63 8c 00 00 	movabs $0x8c6300,%rcx
+  80a8b5:	00 00 00 
+  80a8b8:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80a8bd:	48 3b 39             	cmp    (%rcx),%rdi
+  80a8c0:	74 13                	je     80a8d5 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  80a8c2:	48 83 c2 01          	add    $0x1,%rdx
+  80a8c6:	48 83 c1 18          	add    $0x18,%rcx
+  80a8ca:	48 39 d0             	cmp    %rdx,%rax
+  80a8cd:	75 ee                	jne    80a8bd <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  80a8cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a8d4:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  80a8d5:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80a8d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a8de:	48 be 00 63 8c 00 00 	movabs $0x8c6300,%rsi
+  80a8e5:	00 00 00 
+  80a8e8:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80a8ee:	75 0b                	jne    80a8fb <get_allocsize+0x6b>
+  80a8f0:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  80a8f5:	c3                   	ret
+        return 0;
+  80a8f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80a8fb:	c3                   	ret
+
+000000000080a8fc <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80a8fc:	48 85 ff             	test   %rdi,%rdi
+  80a8ff:	0f 84 01 01 00 00    	je     80aa06 <free+0x10a>
+free(void *ptr) {
+  80a905:	55                   	push   %rbp
+  80a906:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  80a909:	48 b8 e8 62 8c 00 00 	movabs $0x8c62e8,%rax
+  80a910:	00 00 00 
+  80a913:	48 8b 30             	mov    (%rax),%rsi
+  80a916:	48 a1 e0 62 8c 00 00 	movabs 0x8c62e0,%rax
+  80a91d:	00 00 00 
+  80a920:	48 39 c6             	cmp    %rax,%rsi
+  80a923:	74 50                	je     80a975 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  80a925:	48 85 f6             	test   %rsi,%rsi
+  80a928:	74 21                	je     80a94b <free+0x4f>
+  80a92a:	48 b9 00 63 8c 00 00 	movabs $0x8c6300,%rcx
+  80a931:	00 00 00 
+  80a934:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  80a939:	48 3b 39             	cmp    (%rcx),%rdi
+  80a93c:	74 61                	je     80a99f <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  80a93e:	48 83 c2 01          	add    $0x1,%rdx
+  80a942:	48 83 c1 18          	add    $0x18,%rcx
+  80a946:	48 39 d6             	cmp    %rdx,%rsi
+  80a949:	75 ee                	jne    80a939 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  80a94b:	48 ba f0 f0 80 00 00 	movabs $0x80f0f0,%rdx
+  80a952:	00 00 00 
+  80a955:	be 12 01 00 00       	mov    $0x112,%esi
+  80a95a:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a961:	00 00 00 
+  80a964:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a969:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  80a970:	00 00 00 
+  80a973:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  80a975:	48 ba a0 f0 80 00 00 	movabs $0x80f0a0,%rdx
+  80a97c:	00 00 00 
+  80a97f:	be 06 01 00 00       	mov    $0x106,%esi
+  80a984:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a98b:	00 00 00 
+  80a98e:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a993:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  80a99a:	00 00 00 
+  80a99d:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  80a99f:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80a9a3:	48 be 00 63 8c 00 00 	movabs $0x8c6300,%rsi
+  80a9aa:	00 00 00 
+  80a9ad:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80a9b3:	75 27                	jne    80a9dc <free+0xe0>
+            freep[i].is_free = true;
+  80a9b5:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80a9b9:	48 ba 00 63 8c 00 00 	movabs $0x8c6300,%rdx
+  80a9c0:	00 00 00 
+  80a9c3:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  80a9ca:	00 00 
+            real_freep_size++;
+  80a9cc:	48 83 c0 01          	add    $0x1,%rax
+  80a9d0:	48 a3 e0 62 8c 00 00 	movabs %rax,0x8c62e0
+  80a9d7:	00 00 00 
+}
+  80a9da:	5d                   	pop    %rbp
+  80a9db:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  80a9dc:	48 ba c8 f0 80 00 00 	movabs $0x80f0c8,%rdx
+  80a9e3:	00 00 00 
+  80a9e6:	be 0b 01 00 00       	mov    $0x10b,%esi
+  80a9eb:	48 bf 18 f1 80 00 00 	movabs $0x80f118,%rdi
+  80a9f2:	00 00 00 
+  80a9f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  80a9fa:	48 b9 e5 8f 80 00 00 	movabs $0x808fe5,%rcx
+  80aa01:	00 00 00 
+  80aa04:	ff d1                	call   *%rcx
+  80aa06:	c3                   	ret
+
+000000000080aa07 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  80aa07:	55                   	push   %rbp
+  80aa08:	48 89 e5             	mov    %rsp,%rbp
+  80aa0b:	41 55                	push   %r13
+  80aa0d:	41 54                	push   %r12
+  80aa0f:	53                   	push   %rbx
+  80aa10:	48 83 ec 08          	sub    $0x8,%rsp
+  80aa14:	48 89 fb             	mov    %rdi,%rbx
+  80aa17:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  80aa1a:	48 b8 90 a8 80 00 00 	movabs $0x80a890,%rax
+  80aa21:	00 00 00 
+  80aa24:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  80aa26:	49 39 c5             	cmp    %rax,%r13
+  80aa29:	73 0e                	jae    80aa39 <realloc+0x32>
+}
+  80aa2b:	48 89 d8             	mov    %rbx,%rax
+  80aa2e:	48 83 c4 08          	add    $0x8,%rsp
+  80aa32:	5b                   	pop    %rbx
+  80aa33:	41 5c                	pop    %r12
+  80aa35:	41 5d                	pop    %r13
+  80aa37:	5d                   	pop    %rbp
+  80aa38:	c3                   	ret
+  80aa39:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  80aa3c:	4c 89 ef             	mov    %r13,%rdi
+  80aa3f:	48 b8 81 a6 80 00 00 	movabs $0x80a681,%rax
+  80aa46:	00 00 00 
+  80aa49:	ff d0                	call   *%rax
+  80aa4b:	48 89 c7             	mov    %rax,%rdi
+  80aa4e:	4c 89 e2             	mov    %r12,%rdx
+  80aa51:	48 89 de             	mov    %rbx,%rsi
+  80aa54:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  80aa5b:	00 00 00 
+  80aa5e:	ff d0                	call   *%rax
+  80aa60:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  80aa63:	48 89 df             	mov    %rbx,%rdi
+  80aa66:	48 b8 fc a8 80 00 00 	movabs $0x80a8fc,%rax
+  80aa6d:	00 00 00 
+  80aa70:	ff d0                	call   *%rax
+    return newptr;
+  80aa72:	4c 89 e3             	mov    %r12,%rbx
+  80aa75:	eb b4                	jmp    80aa2b <realloc+0x24>
+
+000000000080aa77 <strdup>:
+
+char*
+strdup (const char *src) {
+  80aa77:	55                   	push   %rbp
+  80aa78:	48 89 e5             	mov    %rsp,%rbp
+  80aa7b:	41 54                	push   %r12
+  80aa7d:	53                   	push   %rbx
+  80aa7e:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  80aa81:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  80aa88:	00 00 00 
+  80aa8b:	ff d0                	call   *%rax
+  80aa8d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  80aa91:	4c 89 e7             	mov    %r12,%rdi
+  80aa94:	48 b8 81 a6 80 00 00 	movabs $0x80a681,%rax
+  80aa9b:	00 00 00 
+  80aa9e:	ff d0                	call   *%rax
+  80aaa0:	48 89 c7             	mov    %rax,%rdi
+  80aaa3:	4c 89 e2             	mov    %r12,%rdx
+  80aaa6:	48 89 de             	mov    %rbx,%rsi
+  80aaa9:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  80aab0:	00 00 00 
+  80aab3:	ff d0                	call   *%rax
+}
+  80aab5:	5b                   	pop    %rbx
+  80aab6:	41 5c                	pop    %r12
+  80aab8:	5d                   	pop    %rbp
+  80aab9:	c3                   	ret
+
+000000000080aaba <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  80aaba:	55                   	push   %rbp
+  80aabb:	48 89 e5             	mov    %rsp,%rbp
+  80aabe:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80aabf:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80aac4:	ba 00 00 00 00       	mov    $0x0,%edx
+  80aac9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80aace:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80aad3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80aad8:	be 00 00 00 00       	mov    $0x0,%esi
+  80aadd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80aae3:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  80aae5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80aae9:	c9                   	leave
+  80aaea:	c3                   	ret
+
+000000000080aaeb <get_ticks>:
+
+uint64_t
+get_ticks() {
+  80aaeb:	55                   	push   %rbp
+  80aaec:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  80aaef:	48 b8 00 63 a4 00 00 	movabs $0xa46300,%rax
+  80aaf6:	00 00 00 
+  80aaf9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80aafd:	74 26                	je     80ab25 <get_ticks+0x3a>
+    asm volatile("rdtsc"
+  80aaff:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80ab01:	48 c1 e2 20          	shl    $0x20,%rdx
+  80ab05:	89 c0                	mov    %eax,%eax
+  80ab07:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  80ab0a:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  80ab11:	48 b9 00 63 a4 00 00 	movabs $0xa46300,%rcx
+  80ab18:	00 00 00 
+  80ab1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  80ab20:	48 f7 31             	divq   (%rcx)
+}
+  80ab23:	5d                   	pop    %rbp
+  80ab24:	c3                   	ret
+        freq = get_cpufreq();
+  80ab25:	b8 00 00 00 00       	mov    $0x0,%eax
+  80ab2a:	48 ba ba aa 80 00 00 	movabs $0x80aaba,%rdx
+  80ab31:	00 00 00 
+  80ab34:	ff d2                	call   *%rdx
+  80ab36:	48 a3 00 63 a4 00 00 	movabs %rax,0xa46300
+  80ab3d:	00 00 00 
+  80ab40:	eb bd                	jmp    80aaff <get_ticks+0x14>
+
+000000000080ab42 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  80ab42:	55                   	push   %rbp
+  80ab43:	48 89 e5             	mov    %rsp,%rbp
+  80ab46:	53                   	push   %rbx
+  80ab47:	48 83 ec 08          	sub    $0x8,%rsp
+  80ab4b:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  80ab4e:	48 b8 00 63 a4 00 00 	movabs $0xa46300,%rax
+  80ab55:	00 00 00 
+  80ab58:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80ab5c:	74 50                	je     80abae <sleep+0x6c>
+    asm volatile("rdtsc"
+  80ab5e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80ab60:	48 c1 e2 20          	shl    $0x20,%rdx
+  80ab64:	89 c0                	mov    %eax,%eax
+  80ab66:	48 89 d6             	mov    %rdx,%rsi
+  80ab69:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  80ab6c:	48 b8 00 63 a4 00 00 	movabs $0xa46300,%rax
+  80ab73:	00 00 00 
+  80ab76:	48 0f af 18          	imul   (%rax),%rbx
+  80ab7a:	48 c1 eb 03          	shr    $0x3,%rbx
+  80ab7e:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  80ab85:	9b c4 20 
+  80ab88:	48 89 d8             	mov    %rbx,%rax
+  80ab8b:	48 f7 e2             	mul    %rdx
+  80ab8e:	48 89 d1             	mov    %rdx,%rcx
+  80ab91:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  80ab95:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80ab97:	48 c1 e2 20          	shl    $0x20,%rdx
+  80ab9b:	89 c0                	mov    %eax,%eax
+  80ab9d:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  80aba0:	48 29 f2             	sub    %rsi,%rdx
+  80aba3:	48 39 ca             	cmp    %rcx,%rdx
+  80aba6:	72 ed                	jb     80ab95 <sleep+0x53>
+}
+  80aba8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80abac:	c9                   	leave
+  80abad:	c3                   	ret
+        freq = get_cpufreq();
+  80abae:	b8 00 00 00 00       	mov    $0x0,%eax
+  80abb3:	48 ba ba aa 80 00 00 	movabs $0x80aaba,%rdx
+  80abba:	00 00 00 
+  80abbd:	ff d2                	call   *%rdx
+  80abbf:	48 a3 00 63 a4 00 00 	movabs %rax,0xa46300
+  80abc6:	00 00 00 
+  80abc9:	eb 93                	jmp    80ab5e <sleep+0x1c>
+
+000000000080abcb <poll_kbd>:
+
+int poll_kbd() {
+  80abcb:	55                   	push   %rbp
+  80abcc:	48 89 e5             	mov    %rsp,%rbp
+  80abcf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80abd0:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80abd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  80abda:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80abdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80abe4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80abe9:	be 00 00 00 00       	mov    $0x0,%esi
+  80abee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80abf4:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  80abf6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80abfa:	c9                   	leave
+  80abfb:	c3                   	ret
+
+000000000080abfc <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  80abfc:	55                   	push   %rbp
+  80abfd:	48 89 e5             	mov    %rsp,%rbp
+  80ac00:	53                   	push   %rbx
+  80ac01:	49 89 fa             	mov    %rdi,%r10
+  80ac04:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  80ac06:	44 89 c6             	mov    %r8d,%esi
+  80ac09:	89 cf                	mov    %ecx,%edi
+  80ac0b:	89 d3                	mov    %edx,%ebx
+  80ac0d:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80ac0f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80ac14:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80ac17:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  80ac1b:	cd 30                	int    $0x30
+  80ac1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80ac21:	c9                   	leave
+  80ac22:	c3                   	ret
+
+000000000080ac23 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80ac23:	55                   	push   %rbp
+  80ac24:	48 89 e5             	mov    %rsp,%rbp
+  80ac27:	41 56                	push   %r14
+  80ac29:	41 55                	push   %r13
+  80ac2b:	41 54                	push   %r12
+  80ac2d:	53                   	push   %rbx
+  80ac2e:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80ac31:	48 b8 68 63 a4 00 00 	movabs $0xa46368,%rax
+  80ac38:	00 00 00 
+  80ac3b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80ac3f:	74 27                	je     80ac68 <_handle_vectored_pagefault+0x45>
+  80ac41:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80ac46:	49 bd 20 63 a4 00 00 	movabs $0xa46320,%r13
+  80ac4d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80ac50:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80ac53:	4c 89 e7             	mov    %r12,%rdi
+  80ac56:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80ac5b:	84 c0                	test   %al,%al
+  80ac5d:	75 45                	jne    80aca4 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80ac5f:	48 83 c3 01          	add    $0x1,%rbx
+  80ac63:	49 3b 1e             	cmp    (%r14),%rbx
+  80ac66:	72 eb                	jb     80ac53 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80ac68:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80ac6f:	00 
+  80ac70:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80ac75:	4d 8b 04 24          	mov    (%r12),%r8
+  80ac79:	48 ba 28 f1 80 00 00 	movabs $0x80f128,%rdx
+  80ac80:	00 00 00 
+  80ac83:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80ac88:	48 bf 58 f1 80 00 00 	movabs $0x80f158,%rdi
+  80ac8f:	00 00 00 
+  80ac92:	b8 00 00 00 00       	mov    $0x0,%eax
+  80ac97:	49 ba e5 8f 80 00 00 	movabs $0x808fe5,%r10
+  80ac9e:	00 00 00 
+  80aca1:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80aca4:	5b                   	pop    %rbx
+  80aca5:	41 5c                	pop    %r12
+  80aca7:	41 5d                	pop    %r13
+  80aca9:	41 5e                	pop    %r14
+  80acab:	5d                   	pop    %rbp
+  80acac:	c3                   	ret
+
+000000000080acad <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80acad:	55                   	push   %rbp
+  80acae:	48 89 e5             	mov    %rsp,%rbp
+  80acb1:	41 54                	push   %r12
+  80acb3:	53                   	push   %rbx
+  80acb4:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80acb7:	48 b8 60 63 a4 00 00 	movabs $0xa46360,%rax
+  80acbe:	00 00 00 
+  80acc1:	80 38 00             	cmpb   $0x0,(%rax)
+  80acc4:	74 64                	je     80ad2a <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80acc6:	48 b8 68 63 a4 00 00 	movabs $0xa46368,%rax
+  80accd:	00 00 00 
+  80acd0:	48 8b 10             	mov    (%rax),%rdx
+  80acd3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80acd8:	48 b9 20 63 a4 00 00 	movabs $0xa46320,%rcx
+  80acdf:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80ace2:	48 85 d2             	test   %rdx,%rdx
+  80ace5:	74 1d                	je     80ad04 <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80ace7:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80aceb:	0f 84 ee 00 00 00    	je     80addf <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80acf1:	48 83 c0 01          	add    $0x1,%rax
+  80acf5:	48 39 d0             	cmp    %rdx,%rax
+  80acf8:	75 ed                	jne    80ace7 <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80acfa:	48 83 fa 08          	cmp    $0x8,%rdx
+  80acfe:	0f 84 a9 00 00 00    	je     80adad <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80ad04:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80ad08:	48 a3 68 63 a4 00 00 	movabs %rax,0xa46368
+  80ad0f:	00 00 00 
+  80ad12:	48 b8 20 63 a4 00 00 	movabs $0xa46320,%rax
+  80ad19:	00 00 00 
+  80ad1c:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  80ad20:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  80ad25:	5b                   	pop    %rbx
+  80ad26:	41 5c                	pop    %r12
+  80ad28:	5d                   	pop    %rbp
+  80ad29:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80ad2a:	49 bc 4d a1 80 00 00 	movabs $0x80a14d,%r12
+  80ad31:	00 00 00 
+  80ad34:	41 ff d4             	call   *%r12
+  80ad37:	89 c7                	mov    %eax,%edi
+  80ad39:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80ad3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80ad43:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80ad4a:	00 00 00 
+  80ad4d:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  80ad54:	00 00 00 
+  80ad57:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80ad59:	48 ba 68 63 a4 00 00 	movabs $0xa46368,%rdx
+  80ad60:	00 00 00 
+  80ad63:	48 8b 02             	mov    (%rdx),%rax
+  80ad66:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80ad6a:	48 89 0a             	mov    %rcx,(%rdx)
+  80ad6d:	48 ba 20 63 a4 00 00 	movabs $0xa46320,%rdx
+  80ad74:	00 00 00 
+  80ad77:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80ad7b:	48 b8 60 63 a4 00 00 	movabs $0xa46360,%rax
+  80ad82:	00 00 00 
+  80ad85:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80ad88:	41 ff d4             	call   *%r12
+  80ad8b:	89 c7                	mov    %eax,%edi
+  80ad8d:	48 be a5 ae 80 00 00 	movabs $0x80aea5,%rsi
+  80ad94:	00 00 00 
+  80ad97:	48 b8 25 a5 80 00 00 	movabs $0x80a525,%rax
+  80ad9e:	00 00 00 
+  80ada1:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80ada3:	85 c0                	test   %eax,%eax
+  80ada5:	0f 89 7a ff ff ff    	jns    80ad25 <add_pgfault_handler+0x78>
+  80adab:	eb 05                	jmp    80adb2 <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  80adad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80adb2:	89 c1                	mov    %eax,%ecx
+  80adb4:	48 ba 66 f1 80 00 00 	movabs $0x80f166,%rdx
+  80adbb:	00 00 00 
+  80adbe:	be 3b 00 00 00       	mov    $0x3b,%esi
+  80adc3:	48 bf 58 f1 80 00 00 	movabs $0x80f158,%rdi
+  80adca:	00 00 00 
+  80adcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  80add2:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  80add9:	00 00 00 
+  80addc:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80addf:	b8 00 00 00 00       	mov    $0x0,%eax
+  80ade4:	e9 3c ff ff ff       	jmp    80ad25 <add_pgfault_handler+0x78>
+
+000000000080ade9 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80ade9:	55                   	push   %rbp
+  80adea:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80aded:	48 b8 60 63 a4 00 00 	movabs $0xa46360,%rax
+  80adf4:	00 00 00 
+  80adf7:	80 38 00             	cmpb   $0x0,(%rax)
+  80adfa:	74 33                	je     80ae2f <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80adfc:	48 a1 68 63 a4 00 00 	movabs 0xa46368,%rax
+  80ae03:	00 00 00 
+  80ae06:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80ae0b:	48 ba 20 63 a4 00 00 	movabs $0xa46320,%rdx
+  80ae12:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80ae15:	48 85 c0             	test   %rax,%rax
+  80ae18:	0f 84 85 00 00 00    	je     80aea3 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80ae1e:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80ae22:	74 40                	je     80ae64 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80ae24:	48 83 c1 01          	add    $0x1,%rcx
+  80ae28:	48 39 c1             	cmp    %rax,%rcx
+  80ae2b:	75 f1                	jne    80ae1e <remove_pgfault_handler+0x35>
+  80ae2d:	eb 74                	jmp    80aea3 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80ae2f:	48 b9 7e f1 80 00 00 	movabs $0x80f17e,%rcx
+  80ae36:	00 00 00 
+  80ae39:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  80ae40:	00 00 00 
+  80ae43:	be 41 00 00 00       	mov    $0x41,%esi
+  80ae48:	48 bf 58 f1 80 00 00 	movabs $0x80f158,%rdi
+  80ae4f:	00 00 00 
+  80ae52:	b8 00 00 00 00       	mov    $0x0,%eax
+  80ae57:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  80ae5e:	00 00 00 
+  80ae61:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80ae64:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80ae6b:	00 
+  80ae6c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80ae70:	48 29 ca             	sub    %rcx,%rdx
+  80ae73:	48 b8 20 63 a4 00 00 	movabs $0xa46320,%rax
+  80ae7a:	00 00 00 
+  80ae7d:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80ae81:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80ae86:	48 89 ce             	mov    %rcx,%rsi
+  80ae89:	48 b8 3b 9e 80 00 00 	movabs $0x809e3b,%rax
+  80ae90:	00 00 00 
+  80ae93:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80ae95:	48 b8 68 63 a4 00 00 	movabs $0xa46368,%rax
+  80ae9c:	00 00 00 
+  80ae9f:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80aea3:	5d                   	pop    %rbp
+  80aea4:	c3                   	ret
+
+000000000080aea5 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80aea5:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80aea8:	48 b8 23 ac 80 00 00 	movabs $0x80ac23,%rax
+  80aeaf:	00 00 00 
+    call *%rax
+  80aeb2:	ff d0                	call   *%rax
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    popq %r15
+  80aeb4:	41 5f                	pop    %r15
+    popq %r15
+  80aeb6:	41 5f                	pop    %r15
+    popq %r15
+  80aeb8:	41 5f                	pop    %r15
+    popq %r14
+  80aeba:	41 5e                	pop    %r14
+    popq %r13
+  80aebc:	41 5d                	pop    %r13
+    popq %r12
+  80aebe:	41 5c                	pop    %r12
+    popq %r11
+  80aec0:	41 5b                	pop    %r11
+    popq %r10
+  80aec2:	41 5a                	pop    %r10
+    popq %r9
+  80aec4:	41 59                	pop    %r9
+    popq %r8
+  80aec6:	41 58                	pop    %r8
+    popq %rsi
+  80aec8:	5e                   	pop    %rsi
+    popq %rdi
+  80aec9:	5f                   	pop    %rdi
+    popq %rbp
+  80aeca:	5d                   	pop    %rbp
+    popq %rdx
+  80aecb:	5a                   	pop    %rdx
+    popq %rcx
+  80aecc:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  80aecd:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  80aed2:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  80aed7:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  80aedb:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  80aede:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  80aee3:	5b                   	pop    %rbx
+    popq %rax
+  80aee4:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    pushq 8(%rsp)
+  80aee5:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  80aee9:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    movq 16(%rsp), %rsp
+  80aeea:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80aeef:	c3                   	ret
+
+000000000080aef0 <setjmp>:
+# Only callee-saved registers are preserved.
+
+.text
+.globl setjmp
+setjmp:
+    movq (%rsp), %rax   # return address
+  80aef0:	48 8b 04 24          	mov    (%rsp),%rax
+    movq %rax, 0(%rdi)
+  80aef4:	48 89 07             	mov    %rax,(%rdi)
+    leaq 8(%rsp), %rax  # stack pointer after return
+  80aef7:	48 8d 44 24 08       	lea    0x8(%rsp),%rax
+    movq %rax, 8(%rdi)
+  80aefc:	48 89 47 08          	mov    %rax,0x8(%rdi)
+    movq %rbp, 16(%rdi)
+  80af00:	48 89 6f 10          	mov    %rbp,0x10(%rdi)
+    movq %rbx, 24(%rdi)
+  80af04:	48 89 5f 18          	mov    %rbx,0x18(%rdi)
+    movq %r12, 32(%rdi)
+  80af08:	4c 89 67 20          	mov    %r12,0x20(%rdi)
+    movq %r13, 40(%rdi)
+  80af0c:	4c 89 6f 28          	mov    %r13,0x28(%rdi)
+    movq %r14, 48(%rdi)
+  80af10:	4c 89 77 30          	mov    %r14,0x30(%rdi)
+    movq %r15, 56(%rdi)
+  80af14:	4c 89 7f 38          	mov    %r15,0x38(%rdi)
+    xorl %eax, %eax
+  80af18:	31 c0                	xor    %eax,%eax
+    ret
+  80af1a:	c3                   	ret
+
+000000000080af1b <longjmp>:
+
+.globl longjmp
+longjmp:
+    # setjmp() must appear to return nonzero
+    movl %esi, %eax
+  80af1b:	89 f0                	mov    %esi,%eax
+    testl %eax, %eax
+  80af1d:	85 c0                	test   %eax,%eax
+    jnz 1f
+  80af1f:	75 02                	jne    80af23 <longjmp+0x8>
+    incl %eax
+  80af21:	ff c0                	inc    %eax
+1:
+    movq 8(%rdi), %rsp
+  80af23:	48 8b 67 08          	mov    0x8(%rdi),%rsp
+    movq 16(%rdi), %rbp
+  80af27:	48 8b 6f 10          	mov    0x10(%rdi),%rbp
+    movq 24(%rdi), %rbx
+  80af2b:	48 8b 5f 18          	mov    0x18(%rdi),%rbx
+    movq 32(%rdi), %r12
+  80af2f:	4c 8b 67 20          	mov    0x20(%rdi),%r12
+    movq 40(%rdi), %r13
+  80af33:	4c 8b 6f 28          	mov    0x28(%rdi),%r13
+    movq 48(%rdi), %r14
+  80af37:	4c 8b 77 30          	mov    0x30(%rdi),%r14
+    movq 56(%rdi), %r15
+  80af3b:	4c 8b 7f 38          	mov    0x38(%rdi),%r15
+    jmpq *0(%rdi)
+  80af3f:	ff 27                	jmp    *(%rdi)
+
+000000000080af41 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80af41:	55                   	push   %rbp
+  80af42:	48 89 e5             	mov    %rsp,%rbp
+  80af45:	41 55                	push   %r13
+  80af47:	41 54                	push   %r12
+  80af49:	53                   	push   %rbx
+  80af4a:	48 83 ec 08          	sub    $0x8,%rsp
+  80af4e:	49 89 fc             	mov    %rdi,%r12
+  80af51:	48 89 f7             	mov    %rsi,%rdi
+  80af54:	48 89 d3             	mov    %rdx,%rbx
+  80af57:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80af5a:	48 85 f6             	test   %rsi,%rsi
+  80af5d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80af64:	00 00 00 
+  80af67:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80af6b:	be 00 10 00 00       	mov    $0x1000,%esi
+  80af70:	48 85 d2             	test   %rdx,%rdx
+  80af73:	74 03                	je     80af78 <ipc_recv+0x37>
+  80af75:	48 8b 32             	mov    (%rdx),%rsi
+  80af78:	48 b8 ba a5 80 00 00 	movabs $0x80a5ba,%rax
+  80af7f:	00 00 00 
+  80af82:	ff d0                	call   *%rax
+    if (errno) {
+  80af84:	85 c0                	test   %eax,%eax
+  80af86:	74 1c                	je     80afa4 <ipc_recv+0x63>
+        if (from_env_store)
+  80af88:	4d 85 e4             	test   %r12,%r12
+  80af8b:	74 08                	je     80af95 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80af8d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80af94:	00 
+
+        if (perm_store)
+  80af95:	4d 85 ed             	test   %r13,%r13
+  80af98:	74 74                	je     80b00e <ipc_recv+0xcd>
+            *perm_store = 0;
+  80af9a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80afa1:	00 
+  80afa2:	eb 6a                	jmp    80b00e <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80afa4:	4d 85 e4             	test   %r12,%r12
+  80afa7:	74 14                	je     80afbd <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80afa9:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80afb0:	00 00 00 
+  80afb3:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80afb9:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80afbd:	48 85 db             	test   %rbx,%rbx
+  80afc0:	74 23                	je     80afe5 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80afc2:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80afc9:	00 00 00 
+  80afcc:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80afd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  80afd7:	85 c9                	test   %ecx,%ecx
+  80afd9:	74 07                	je     80afe2 <ipc_recv+0xa1>
+  80afdb:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80afe2:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80afe5:	4d 85 ed             	test   %r13,%r13
+  80afe8:	74 14                	je     80affe <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80afea:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80aff1:	00 00 00 
+  80aff4:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80affa:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  80affe:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80b005:	00 00 00 
+  80b008:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  80b00e:	48 83 c4 08          	add    $0x8,%rsp
+  80b012:	5b                   	pop    %rbx
+  80b013:	41 5c                	pop    %r12
+  80b015:	41 5d                	pop    %r13
+  80b017:	5d                   	pop    %rbp
+  80b018:	c3                   	ret
+
+000000000080b019 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80b019:	55                   	push   %rbp
+  80b01a:	48 89 e5             	mov    %rsp,%rbp
+  80b01d:	41 55                	push   %r13
+  80b01f:	41 54                	push   %r12
+  80b021:	53                   	push   %rbx
+  80b022:	48 83 ec 08          	sub    $0x8,%rsp
+  80b026:	49 89 fc             	mov    %rdi,%r12
+  80b029:	48 89 f7             	mov    %rsi,%rdi
+  80b02c:	48 89 d3             	mov    %rdx,%rbx
+  80b02f:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80b032:	48 85 f6             	test   %rsi,%rsi
+  80b035:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80b03c:	00 00 00 
+  80b03f:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  80b043:	be 00 10 00 00       	mov    $0x1000,%esi
+  80b048:	48 85 d2             	test   %rdx,%rdx
+  80b04b:	74 03                	je     80b050 <ipc_try_recv+0x37>
+  80b04d:	48 8b 32             	mov    (%rdx),%rsi
+  80b050:	48 b8 23 a6 80 00 00 	movabs $0x80a623,%rax
+  80b057:	00 00 00 
+  80b05a:	ff d0                	call   *%rax
+    if (errno) {
+  80b05c:	85 c0                	test   %eax,%eax
+  80b05e:	75 75                	jne    80b0d5 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80b060:	4d 85 e4             	test   %r12,%r12
+  80b063:	74 14                	je     80b079 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  80b065:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80b06c:	00 00 00 
+  80b06f:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80b075:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80b079:	48 85 db             	test   %rbx,%rbx
+  80b07c:	74 23                	je     80b0a1 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80b07e:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80b085:	00 00 00 
+  80b088:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80b08e:	ba 00 00 00 00       	mov    $0x0,%edx
+  80b093:	85 c9                	test   %ecx,%ecx
+  80b095:	74 07                	je     80b09e <ipc_try_recv+0x85>
+  80b097:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80b09e:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80b0a1:	4d 85 ed             	test   %r13,%r13
+  80b0a4:	74 14                	je     80b0ba <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80b0a6:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80b0ad:	00 00 00 
+  80b0b0:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80b0b6:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80b0ba:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80b0c1:	00 00 00 
+  80b0c4:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80b0ca:	48 83 c4 08          	add    $0x8,%rsp
+  80b0ce:	5b                   	pop    %rbx
+  80b0cf:	41 5c                	pop    %r12
+  80b0d1:	41 5d                	pop    %r13
+  80b0d3:	5d                   	pop    %rbp
+  80b0d4:	c3                   	ret
+        if (from_env_store)
+  80b0d5:	4d 85 e4             	test   %r12,%r12
+  80b0d8:	74 08                	je     80b0e2 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80b0da:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80b0e1:	00 
+        if (perm_store)
+  80b0e2:	4d 85 ed             	test   %r13,%r13
+  80b0e5:	74 e3                	je     80b0ca <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80b0e7:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80b0ee:	00 
+  80b0ef:	eb d9                	jmp    80b0ca <ipc_try_recv+0xb1>
+
+000000000080b0f1 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80b0f1:	55                   	push   %rbp
+  80b0f2:	48 89 e5             	mov    %rsp,%rbp
+  80b0f5:	41 57                	push   %r15
+  80b0f7:	41 56                	push   %r14
+  80b0f9:	41 55                	push   %r13
+  80b0fb:	41 54                	push   %r12
+  80b0fd:	53                   	push   %rbx
+  80b0fe:	48 83 ec 18          	sub    $0x18,%rsp
+  80b102:	41 89 fd             	mov    %edi,%r13d
+  80b105:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80b108:	48 89 d3             	mov    %rdx,%rbx
+  80b10b:	49 89 cc             	mov    %rcx,%r12
+  80b10e:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80b112:	48 85 d2             	test   %rdx,%rdx
+  80b115:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80b11c:	00 00 00 
+  80b11f:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80b123:	49 be 8e a5 80 00 00 	movabs $0x80a58e,%r14
+  80b12a:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  80b12d:	49 bf 7e a1 80 00 00 	movabs $0x80a17e,%r15
+  80b134:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80b137:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80b13a:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80b13e:	4c 89 e1             	mov    %r12,%rcx
+  80b141:	48 89 da             	mov    %rbx,%rdx
+  80b144:	44 89 ef             	mov    %r13d,%edi
+  80b147:	41 ff d6             	call   *%r14
+  80b14a:	85 c0                	test   %eax,%eax
+  80b14c:	74 37                	je     80b185 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  80b14e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80b151:	75 05                	jne    80b158 <ipc_send+0x67>
+        sys_yield();
+  80b153:	41 ff d7             	call   *%r15
+  80b156:	eb df                	jmp    80b137 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80b158:	89 c1                	mov    %eax,%ecx
+  80b15a:	48 ba 98 f1 80 00 00 	movabs $0x80f198,%rdx
+  80b161:	00 00 00 
+  80b164:	be 65 00 00 00       	mov    $0x65,%esi
+  80b169:	48 bf b3 f1 80 00 00 	movabs $0x80f1b3,%rdi
+  80b170:	00 00 00 
+  80b173:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b178:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  80b17f:	00 00 00 
+  80b182:	41 ff d0             	call   *%r8
+    }
+}
+  80b185:	48 83 c4 18          	add    $0x18,%rsp
+  80b189:	5b                   	pop    %rbx
+  80b18a:	41 5c                	pop    %r12
+  80b18c:	41 5d                	pop    %r13
+  80b18e:	41 5e                	pop    %r14
+  80b190:	41 5f                	pop    %r15
+  80b192:	5d                   	pop    %rbp
+  80b193:	c3                   	ret
+
+000000000080b194 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80b194:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80b199:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80b1a0:	00 00 00 
+  80b1a3:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80b1aa:	48 01 ca             	add    %rcx,%rdx
+  80b1ad:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80b1b3:	39 fa                	cmp    %edi,%edx
+  80b1b5:	74 12                	je     80b1c9 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80b1b7:	48 83 c0 01          	add    $0x1,%rax
+  80b1bb:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80b1c1:	75 e0                	jne    80b1a3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80b1c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80b1c8:	c3                   	ret
+            return envs[i].env_id;
+  80b1c9:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80b1d0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80b1d7:	00 00 00 
+  80b1da:	48 01 d0             	add    %rdx,%rax
+  80b1dd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80b1e3:	c3                   	ret
+
+000000000080b1e4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80b1e4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80b1eb:	ff ff ff 
+  80b1ee:	48 01 f8             	add    %rdi,%rax
+  80b1f1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80b1f5:	c3                   	ret
+
+000000000080b1f6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80b1f6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80b1fd:	ff ff ff 
+  80b200:	48 01 f8             	add    %rdi,%rax
+  80b203:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80b207:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80b20d:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80b211:	c3                   	ret
+
+000000000080b212 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80b212:	55                   	push   %rbp
+  80b213:	48 89 e5             	mov    %rsp,%rbp
+  80b216:	41 57                	push   %r15
+  80b218:	41 56                	push   %r14
+  80b21a:	41 55                	push   %r13
+  80b21c:	41 54                	push   %r12
+  80b21e:	53                   	push   %rbx
+  80b21f:	48 83 ec 08          	sub    $0x8,%rsp
+  80b223:	49 89 ff             	mov    %rdi,%r15
+  80b226:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80b22b:	49 bd c6 d0 80 00 00 	movabs $0x80d0c6,%r13
+  80b232:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80b235:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80b23b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80b23e:	48 89 df             	mov    %rbx,%rdi
+  80b241:	41 ff d5             	call   *%r13
+  80b244:	83 e0 04             	and    $0x4,%eax
+  80b247:	74 17                	je     80b260 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80b249:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80b250:	4c 39 f3             	cmp    %r14,%rbx
+  80b253:	75 e6                	jne    80b23b <fd_alloc+0x29>
+  80b255:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80b25b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80b260:	4d 89 27             	mov    %r12,(%r15)
+}
+  80b263:	48 83 c4 08          	add    $0x8,%rsp
+  80b267:	5b                   	pop    %rbx
+  80b268:	41 5c                	pop    %r12
+  80b26a:	41 5d                	pop    %r13
+  80b26c:	41 5e                	pop    %r14
+  80b26e:	41 5f                	pop    %r15
+  80b270:	5d                   	pop    %rbp
+  80b271:	c3                   	ret
+
+000000000080b272 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80b272:	83 ff 1f             	cmp    $0x1f,%edi
+  80b275:	77 39                	ja     80b2b0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80b277:	55                   	push   %rbp
+  80b278:	48 89 e5             	mov    %rsp,%rbp
+  80b27b:	41 54                	push   %r12
+  80b27d:	53                   	push   %rbx
+  80b27e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80b281:	48 63 df             	movslq %edi,%rbx
+  80b284:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80b28b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80b28f:	48 89 df             	mov    %rbx,%rdi
+  80b292:	48 b8 c6 d0 80 00 00 	movabs $0x80d0c6,%rax
+  80b299:	00 00 00 
+  80b29c:	ff d0                	call   *%rax
+  80b29e:	a8 04                	test   $0x4,%al
+  80b2a0:	74 14                	je     80b2b6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80b2a2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80b2a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80b2ab:	5b                   	pop    %rbx
+  80b2ac:	41 5c                	pop    %r12
+  80b2ae:	5d                   	pop    %rbp
+  80b2af:	c3                   	ret
+        return -E_INVAL;
+  80b2b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80b2b5:	c3                   	ret
+        return -E_INVAL;
+  80b2b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80b2bb:	eb ee                	jmp    80b2ab <fd_lookup+0x39>
+
+000000000080b2bd <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80b2bd:	55                   	push   %rbp
+  80b2be:	48 89 e5             	mov    %rsp,%rbp
+  80b2c1:	41 54                	push   %r12
+  80b2c3:	53                   	push   %rbx
+  80b2c4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80b2c7:	48 b8 40 f2 80 00 00 	movabs $0x80f240,%rax
+  80b2ce:	00 00 00 
+  80b2d1:	48 bb a0 50 81 00 00 	movabs $0x8150a0,%rbx
+  80b2d8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80b2db:	39 3b                	cmp    %edi,(%rbx)
+  80b2dd:	74 47                	je     80b326 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80b2df:	48 83 c0 08          	add    $0x8,%rax
+  80b2e3:	48 8b 18             	mov    (%rax),%rbx
+  80b2e6:	48 85 db             	test   %rbx,%rbx
+  80b2e9:	75 f0                	jne    80b2db <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80b2eb:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80b2f2:	00 00 00 
+  80b2f5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80b2fb:	89 fa                	mov    %edi,%edx
+  80b2fd:	48 bf c0 f1 80 00 00 	movabs $0x80f1c0,%rdi
+  80b304:	00 00 00 
+  80b307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b30c:	48 b9 35 91 80 00 00 	movabs $0x809135,%rcx
+  80b313:	00 00 00 
+  80b316:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80b318:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80b31d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80b321:	5b                   	pop    %rbx
+  80b322:	41 5c                	pop    %r12
+  80b324:	5d                   	pop    %rbp
+  80b325:	c3                   	ret
+            return 0;
+  80b326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b32b:	eb f0                	jmp    80b31d <dev_lookup+0x60>
+
+000000000080b32d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80b32d:	55                   	push   %rbp
+  80b32e:	48 89 e5             	mov    %rsp,%rbp
+  80b331:	41 55                	push   %r13
+  80b333:	41 54                	push   %r12
+  80b335:	53                   	push   %rbx
+  80b336:	48 83 ec 18          	sub    $0x18,%rsp
+  80b33a:	48 89 fb             	mov    %rdi,%rbx
+  80b33d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80b340:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80b347:	ff ff ff 
+  80b34a:	48 01 df             	add    %rbx,%rdi
+  80b34d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80b351:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80b355:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b35c:	00 00 00 
+  80b35f:	ff d0                	call   *%rax
+  80b361:	41 89 c5             	mov    %eax,%r13d
+  80b364:	85 c0                	test   %eax,%eax
+  80b366:	78 06                	js     80b36e <fd_close+0x41>
+  80b368:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80b36c:	74 1a                	je     80b388 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80b36e:	45 84 e4             	test   %r12b,%r12b
+  80b371:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b376:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80b37a:	44 89 e8             	mov    %r13d,%eax
+  80b37d:	48 83 c4 18          	add    $0x18,%rsp
+  80b381:	5b                   	pop    %rbx
+  80b382:	41 5c                	pop    %r12
+  80b384:	41 5d                	pop    %r13
+  80b386:	5d                   	pop    %rbp
+  80b387:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80b388:	8b 3b                	mov    (%rbx),%edi
+  80b38a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80b38e:	48 b8 bd b2 80 00 00 	movabs $0x80b2bd,%rax
+  80b395:	00 00 00 
+  80b398:	ff d0                	call   *%rax
+  80b39a:	41 89 c5             	mov    %eax,%r13d
+  80b39d:	85 c0                	test   %eax,%eax
+  80b39f:	78 1b                	js     80b3bc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80b3a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80b3a5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80b3a9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80b3af:	48 85 c0             	test   %rax,%rax
+  80b3b2:	74 08                	je     80b3bc <fd_close+0x8f>
+  80b3b4:	48 89 df             	mov    %rbx,%rdi
+  80b3b7:	ff d0                	call   *%rax
+  80b3b9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80b3bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80b3c1:	48 89 de             	mov    %rbx,%rsi
+  80b3c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b3c9:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  80b3d0:	00 00 00 
+  80b3d3:	ff d0                	call   *%rax
+    return res;
+  80b3d5:	eb a3                	jmp    80b37a <fd_close+0x4d>
+
+000000000080b3d7 <close>:
+
+int
+close(int fdnum) {
+  80b3d7:	55                   	push   %rbp
+  80b3d8:	48 89 e5             	mov    %rsp,%rbp
+  80b3db:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80b3df:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80b3e3:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b3ea:	00 00 00 
+  80b3ed:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80b3ef:	85 c0                	test   %eax,%eax
+  80b3f1:	78 15                	js     80b408 <close+0x31>
+
+    return fd_close(fd, 1);
+  80b3f3:	be 01 00 00 00       	mov    $0x1,%esi
+  80b3f8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80b3fc:	48 b8 2d b3 80 00 00 	movabs $0x80b32d,%rax
+  80b403:	00 00 00 
+  80b406:	ff d0                	call   *%rax
+}
+  80b408:	c9                   	leave
+  80b409:	c3                   	ret
+
+000000000080b40a <close_all>:
+
+void
+close_all(void) {
+  80b40a:	55                   	push   %rbp
+  80b40b:	48 89 e5             	mov    %rsp,%rbp
+  80b40e:	41 54                	push   %r12
+  80b410:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80b411:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80b416:	49 bc d7 b3 80 00 00 	movabs $0x80b3d7,%r12
+  80b41d:	00 00 00 
+  80b420:	89 df                	mov    %ebx,%edi
+  80b422:	41 ff d4             	call   *%r12
+  80b425:	83 c3 01             	add    $0x1,%ebx
+  80b428:	83 fb 20             	cmp    $0x20,%ebx
+  80b42b:	75 f3                	jne    80b420 <close_all+0x16>
+}
+  80b42d:	5b                   	pop    %rbx
+  80b42e:	41 5c                	pop    %r12
+  80b430:	5d                   	pop    %rbp
+  80b431:	c3                   	ret
+
+000000000080b432 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80b432:	55                   	push   %rbp
+  80b433:	48 89 e5             	mov    %rsp,%rbp
+  80b436:	41 57                	push   %r15
+  80b438:	41 56                	push   %r14
+  80b43a:	41 55                	push   %r13
+  80b43c:	41 54                	push   %r12
+  80b43e:	53                   	push   %rbx
+  80b43f:	48 83 ec 18          	sub    $0x18,%rsp
+  80b443:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80b446:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80b44a:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b451:	00 00 00 
+  80b454:	ff d0                	call   *%rax
+  80b456:	89 c3                	mov    %eax,%ebx
+  80b458:	85 c0                	test   %eax,%eax
+  80b45a:	0f 88 b8 00 00 00    	js     80b518 <dup+0xe6>
+    close(newfdnum);
+  80b460:	44 89 e7             	mov    %r12d,%edi
+  80b463:	48 b8 d7 b3 80 00 00 	movabs $0x80b3d7,%rax
+  80b46a:	00 00 00 
+  80b46d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80b46f:	4d 63 ec             	movslq %r12d,%r13
+  80b472:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80b479:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80b47d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80b481:	4c 89 ff             	mov    %r15,%rdi
+  80b484:	49 be f6 b1 80 00 00 	movabs $0x80b1f6,%r14
+  80b48b:	00 00 00 
+  80b48e:	41 ff d6             	call   *%r14
+  80b491:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80b494:	4c 89 ef             	mov    %r13,%rdi
+  80b497:	41 ff d6             	call   *%r14
+  80b49a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80b49d:	48 89 df             	mov    %rbx,%rdi
+  80b4a0:	48 b8 c6 d0 80 00 00 	movabs $0x80d0c6,%rax
+  80b4a7:	00 00 00 
+  80b4aa:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80b4ac:	a8 04                	test   $0x4,%al
+  80b4ae:	74 2b                	je     80b4db <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80b4b0:	41 89 c1             	mov    %eax,%r9d
+  80b4b3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80b4b9:	4c 89 f1             	mov    %r14,%rcx
+  80b4bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  80b4c1:	48 89 de             	mov    %rbx,%rsi
+  80b4c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b4c9:	48 b8 74 a2 80 00 00 	movabs $0x80a274,%rax
+  80b4d0:	00 00 00 
+  80b4d3:	ff d0                	call   *%rax
+  80b4d5:	89 c3                	mov    %eax,%ebx
+  80b4d7:	85 c0                	test   %eax,%eax
+  80b4d9:	78 4e                	js     80b529 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80b4db:	4c 89 ff             	mov    %r15,%rdi
+  80b4de:	48 b8 c6 d0 80 00 00 	movabs $0x80d0c6,%rax
+  80b4e5:	00 00 00 
+  80b4e8:	ff d0                	call   *%rax
+  80b4ea:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80b4ed:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80b4f3:	4c 89 e9             	mov    %r13,%rcx
+  80b4f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  80b4fb:	4c 89 fe             	mov    %r15,%rsi
+  80b4fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b503:	48 b8 74 a2 80 00 00 	movabs $0x80a274,%rax
+  80b50a:	00 00 00 
+  80b50d:	ff d0                	call   *%rax
+  80b50f:	89 c3                	mov    %eax,%ebx
+  80b511:	85 c0                	test   %eax,%eax
+  80b513:	78 14                	js     80b529 <dup+0xf7>
+
+    return newfdnum;
+  80b515:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80b518:	89 d8                	mov    %ebx,%eax
+  80b51a:	48 83 c4 18          	add    $0x18,%rsp
+  80b51e:	5b                   	pop    %rbx
+  80b51f:	41 5c                	pop    %r12
+  80b521:	41 5d                	pop    %r13
+  80b523:	41 5e                	pop    %r14
+  80b525:	41 5f                	pop    %r15
+  80b527:	5d                   	pop    %rbp
+  80b528:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80b529:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80b52e:	4c 89 ee             	mov    %r13,%rsi
+  80b531:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b536:	49 bc ec a3 80 00 00 	movabs $0x80a3ec,%r12
+  80b53d:	00 00 00 
+  80b540:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80b543:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80b548:	4c 89 f6             	mov    %r14,%rsi
+  80b54b:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b550:	41 ff d4             	call   *%r12
+    return res;
+  80b553:	eb c3                	jmp    80b518 <dup+0xe6>
+
+000000000080b555 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80b555:	55                   	push   %rbp
+  80b556:	48 89 e5             	mov    %rsp,%rbp
+  80b559:	41 56                	push   %r14
+  80b55b:	41 55                	push   %r13
+  80b55d:	41 54                	push   %r12
+  80b55f:	53                   	push   %rbx
+  80b560:	48 83 ec 10          	sub    $0x10,%rsp
+  80b564:	89 fb                	mov    %edi,%ebx
+  80b566:	49 89 f4             	mov    %rsi,%r12
+  80b569:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80b56c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80b570:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b577:	00 00 00 
+  80b57a:	ff d0                	call   *%rax
+  80b57c:	85 c0                	test   %eax,%eax
+  80b57e:	78 4c                	js     80b5cc <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80b580:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80b584:	41 8b 3e             	mov    (%r14),%edi
+  80b587:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80b58b:	48 b8 bd b2 80 00 00 	movabs $0x80b2bd,%rax
+  80b592:	00 00 00 
+  80b595:	ff d0                	call   *%rax
+  80b597:	85 c0                	test   %eax,%eax
+  80b599:	78 35                	js     80b5d0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80b59b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80b59f:	83 e0 03             	and    $0x3,%eax
+  80b5a2:	83 f8 01             	cmp    $0x1,%eax
+  80b5a5:	74 2d                	je     80b5d4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80b5a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80b5ab:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80b5af:	48 85 c0             	test   %rax,%rax
+  80b5b2:	74 56                	je     80b60a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80b5b4:	4c 89 ea             	mov    %r13,%rdx
+  80b5b7:	4c 89 e6             	mov    %r12,%rsi
+  80b5ba:	4c 89 f7             	mov    %r14,%rdi
+  80b5bd:	ff d0                	call   *%rax
+}
+  80b5bf:	48 83 c4 10          	add    $0x10,%rsp
+  80b5c3:	5b                   	pop    %rbx
+  80b5c4:	41 5c                	pop    %r12
+  80b5c6:	41 5d                	pop    %r13
+  80b5c8:	41 5e                	pop    %r14
+  80b5ca:	5d                   	pop    %rbp
+  80b5cb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80b5cc:	48 98                	cltq
+  80b5ce:	eb ef                	jmp    80b5bf <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80b5d0:	48 98                	cltq
+  80b5d2:	eb eb                	jmp    80b5bf <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80b5d4:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80b5db:	00 00 00 
+  80b5de:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80b5e4:	89 da                	mov    %ebx,%edx
+  80b5e6:	48 bf 01 f2 80 00 00 	movabs $0x80f201,%rdi
+  80b5ed:	00 00 00 
+  80b5f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b5f5:	48 b9 35 91 80 00 00 	movabs $0x809135,%rcx
+  80b5fc:	00 00 00 
+  80b5ff:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80b601:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80b608:	eb b5                	jmp    80b5bf <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80b60a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80b611:	eb ac                	jmp    80b5bf <read+0x6a>
+
+000000000080b613 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80b613:	55                   	push   %rbp
+  80b614:	48 89 e5             	mov    %rsp,%rbp
+  80b617:	41 57                	push   %r15
+  80b619:	41 56                	push   %r14
+  80b61b:	41 55                	push   %r13
+  80b61d:	41 54                	push   %r12
+  80b61f:	53                   	push   %rbx
+  80b620:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80b624:	48 85 d2             	test   %rdx,%rdx
+  80b627:	74 54                	je     80b67d <readn+0x6a>
+  80b629:	41 89 fd             	mov    %edi,%r13d
+  80b62c:	49 89 f6             	mov    %rsi,%r14
+  80b62f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80b632:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80b637:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80b63c:	49 bf 55 b5 80 00 00 	movabs $0x80b555,%r15
+  80b643:	00 00 00 
+  80b646:	4c 89 e2             	mov    %r12,%rdx
+  80b649:	48 29 f2             	sub    %rsi,%rdx
+  80b64c:	4c 01 f6             	add    %r14,%rsi
+  80b64f:	44 89 ef             	mov    %r13d,%edi
+  80b652:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80b655:	85 c0                	test   %eax,%eax
+  80b657:	78 20                	js     80b679 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80b659:	01 c3                	add    %eax,%ebx
+  80b65b:	85 c0                	test   %eax,%eax
+  80b65d:	74 08                	je     80b667 <readn+0x54>
+  80b65f:	48 63 f3             	movslq %ebx,%rsi
+  80b662:	4c 39 e6             	cmp    %r12,%rsi
+  80b665:	72 df                	jb     80b646 <readn+0x33>
+    }
+    return res;
+  80b667:	48 63 c3             	movslq %ebx,%rax
+}
+  80b66a:	48 83 c4 08          	add    $0x8,%rsp
+  80b66e:	5b                   	pop    %rbx
+  80b66f:	41 5c                	pop    %r12
+  80b671:	41 5d                	pop    %r13
+  80b673:	41 5e                	pop    %r14
+  80b675:	41 5f                	pop    %r15
+  80b677:	5d                   	pop    %rbp
+  80b678:	c3                   	ret
+        if (inc < 0) return inc;
+  80b679:	48 98                	cltq
+  80b67b:	eb ed                	jmp    80b66a <readn+0x57>
+    int inc = 1, res = 0;
+  80b67d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80b682:	eb e3                	jmp    80b667 <readn+0x54>
+
+000000000080b684 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80b684:	55                   	push   %rbp
+  80b685:	48 89 e5             	mov    %rsp,%rbp
+  80b688:	41 56                	push   %r14
+  80b68a:	41 55                	push   %r13
+  80b68c:	41 54                	push   %r12
+  80b68e:	53                   	push   %rbx
+  80b68f:	48 83 ec 10          	sub    $0x10,%rsp
+  80b693:	89 fb                	mov    %edi,%ebx
+  80b695:	49 89 f4             	mov    %rsi,%r12
+  80b698:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80b69b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80b69f:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b6a6:	00 00 00 
+  80b6a9:	ff d0                	call   *%rax
+  80b6ab:	85 c0                	test   %eax,%eax
+  80b6ad:	78 47                	js     80b6f6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80b6af:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80b6b3:	41 8b 3e             	mov    (%r14),%edi
+  80b6b6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80b6ba:	48 b8 bd b2 80 00 00 	movabs $0x80b2bd,%rax
+  80b6c1:	00 00 00 
+  80b6c4:	ff d0                	call   *%rax
+  80b6c6:	85 c0                	test   %eax,%eax
+  80b6c8:	78 30                	js     80b6fa <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80b6ca:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80b6cf:	74 2d                	je     80b6fe <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80b6d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80b6d5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80b6d9:	48 85 c0             	test   %rax,%rax
+  80b6dc:	74 56                	je     80b734 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80b6de:	4c 89 ea             	mov    %r13,%rdx
+  80b6e1:	4c 89 e6             	mov    %r12,%rsi
+  80b6e4:	4c 89 f7             	mov    %r14,%rdi
+  80b6e7:	ff d0                	call   *%rax
+}
+  80b6e9:	48 83 c4 10          	add    $0x10,%rsp
+  80b6ed:	5b                   	pop    %rbx
+  80b6ee:	41 5c                	pop    %r12
+  80b6f0:	41 5d                	pop    %r13
+  80b6f2:	41 5e                	pop    %r14
+  80b6f4:	5d                   	pop    %rbp
+  80b6f5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80b6f6:	48 98                	cltq
+  80b6f8:	eb ef                	jmp    80b6e9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80b6fa:	48 98                	cltq
+  80b6fc:	eb eb                	jmp    80b6e9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80b6fe:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80b705:	00 00 00 
+  80b708:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80b70e:	89 da                	mov    %ebx,%edx
+  80b710:	48 bf 1d f2 80 00 00 	movabs $0x80f21d,%rdi
+  80b717:	00 00 00 
+  80b71a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b71f:	48 b9 35 91 80 00 00 	movabs $0x809135,%rcx
+  80b726:	00 00 00 
+  80b729:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80b72b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80b732:	eb b5                	jmp    80b6e9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80b734:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80b73b:	eb ac                	jmp    80b6e9 <write+0x65>
+
+000000000080b73d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80b73d:	55                   	push   %rbp
+  80b73e:	48 89 e5             	mov    %rsp,%rbp
+  80b741:	53                   	push   %rbx
+  80b742:	48 83 ec 18          	sub    $0x18,%rsp
+  80b746:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80b748:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80b74c:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b753:	00 00 00 
+  80b756:	ff d0                	call   *%rax
+  80b758:	85 c0                	test   %eax,%eax
+  80b75a:	78 0c                	js     80b768 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80b75c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80b760:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80b763:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80b768:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80b76c:	c9                   	leave
+  80b76d:	c3                   	ret
+
+000000000080b76e <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80b76e:	55                   	push   %rbp
+  80b76f:	48 89 e5             	mov    %rsp,%rbp
+  80b772:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80b776:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80b77a:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b781:	00 00 00 
+  80b784:	ff d0                	call   *%rax
+  80b786:	85 c0                	test   %eax,%eax
+  80b788:	78 07                	js     80b791 <tell+0x23>
+    return fdes->fd_offset;
+  80b78a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80b78e:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80b791:	c9                   	leave
+  80b792:	c3                   	ret
+
+000000000080b793 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80b793:	55                   	push   %rbp
+  80b794:	48 89 e5             	mov    %rsp,%rbp
+  80b797:	41 55                	push   %r13
+  80b799:	41 54                	push   %r12
+  80b79b:	53                   	push   %rbx
+  80b79c:	48 83 ec 18          	sub    $0x18,%rsp
+  80b7a0:	89 fb                	mov    %edi,%ebx
+  80b7a2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80b7a5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80b7a9:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b7b0:	00 00 00 
+  80b7b3:	ff d0                	call   *%rax
+  80b7b5:	85 c0                	test   %eax,%eax
+  80b7b7:	78 38                	js     80b7f1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80b7b9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80b7bd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80b7c1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80b7c5:	48 b8 bd b2 80 00 00 	movabs $0x80b2bd,%rax
+  80b7cc:	00 00 00 
+  80b7cf:	ff d0                	call   *%rax
+  80b7d1:	85 c0                	test   %eax,%eax
+  80b7d3:	78 1c                	js     80b7f1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80b7d5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80b7da:	74 20                	je     80b7fc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80b7dc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80b7e0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80b7e4:	48 85 c0             	test   %rax,%rax
+  80b7e7:	74 47                	je     80b830 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80b7e9:	44 89 e6             	mov    %r12d,%esi
+  80b7ec:	4c 89 ef             	mov    %r13,%rdi
+  80b7ef:	ff d0                	call   *%rax
+}
+  80b7f1:	48 83 c4 18          	add    $0x18,%rsp
+  80b7f5:	5b                   	pop    %rbx
+  80b7f6:	41 5c                	pop    %r12
+  80b7f8:	41 5d                	pop    %r13
+  80b7fa:	5d                   	pop    %rbp
+  80b7fb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80b7fc:	48 a1 c0 62 8c 00 00 	movabs 0x8c62c0,%rax
+  80b803:	00 00 00 
+  80b806:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80b80c:	89 da                	mov    %ebx,%edx
+  80b80e:	48 bf e0 f1 80 00 00 	movabs $0x80f1e0,%rdi
+  80b815:	00 00 00 
+  80b818:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b81d:	48 b9 35 91 80 00 00 	movabs $0x809135,%rcx
+  80b824:	00 00 00 
+  80b827:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80b829:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80b82e:	eb c1                	jmp    80b7f1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80b830:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80b835:	eb ba                	jmp    80b7f1 <ftruncate+0x5e>
+
+000000000080b837 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80b837:	55                   	push   %rbp
+  80b838:	48 89 e5             	mov    %rsp,%rbp
+  80b83b:	41 54                	push   %r12
+  80b83d:	53                   	push   %rbx
+  80b83e:	48 83 ec 10          	sub    $0x10,%rsp
+  80b842:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80b845:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80b849:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b850:	00 00 00 
+  80b853:	ff d0                	call   *%rax
+  80b855:	85 c0                	test   %eax,%eax
+  80b857:	78 4e                	js     80b8a7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80b859:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80b85d:	41 8b 3c 24          	mov    (%r12),%edi
+  80b861:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80b865:	48 b8 bd b2 80 00 00 	movabs $0x80b2bd,%rax
+  80b86c:	00 00 00 
+  80b86f:	ff d0                	call   *%rax
+  80b871:	85 c0                	test   %eax,%eax
+  80b873:	78 32                	js     80b8a7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80b875:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80b879:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80b87e:	74 30                	je     80b8b0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80b880:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80b883:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80b88a:	00 00 00 
+    stat->st_isdir = 0;
+  80b88d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80b894:	00 00 00 
+    stat->st_dev = dev;
+  80b897:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80b89e:	48 89 de             	mov    %rbx,%rsi
+  80b8a1:	4c 89 e7             	mov    %r12,%rdi
+  80b8a4:	ff 50 28             	call   *0x28(%rax)
+}
+  80b8a7:	48 83 c4 10          	add    $0x10,%rsp
+  80b8ab:	5b                   	pop    %rbx
+  80b8ac:	41 5c                	pop    %r12
+  80b8ae:	5d                   	pop    %rbp
+  80b8af:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80b8b0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80b8b5:	eb f0                	jmp    80b8a7 <fstat+0x70>
+
+000000000080b8b7 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80b8b7:	55                   	push   %rbp
+  80b8b8:	48 89 e5             	mov    %rsp,%rbp
+  80b8bb:	41 54                	push   %r12
+  80b8bd:	53                   	push   %rbx
+  80b8be:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80b8c5:	41 89 fc             	mov    %edi,%r12d
+  80b8c8:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80b8ca:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80b8ce:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b8d5:	00 00 00 
+  80b8d8:	ff d0                	call   *%rax
+  80b8da:	85 c0                	test   %eax,%eax
+  80b8dc:	78 31                	js     80b90f <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  80b8de:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80b8e5:	44 89 e7             	mov    %r12d,%edi
+  80b8e8:	48 b8 37 b8 80 00 00 	movabs $0x80b837,%rax
+  80b8ef:	00 00 00 
+  80b8f2:	ff d0                	call   *%rax
+  80b8f4:	85 c0                	test   %eax,%eax
+  80b8f6:	78 17                	js     80b90f <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  80b8f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80b8fc:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  80b8ff:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80b902:	39 d3                	cmp    %edx,%ebx
+  80b904:	0f 4f da             	cmovg  %edx,%ebx
+  80b907:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80b90a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80b90f:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  80b916:	5b                   	pop    %rbx
+  80b917:	41 5c                	pop    %r12
+  80b919:	5d                   	pop    %rbp
+  80b91a:	c3                   	ret
+
+000000000080b91b <seektoend>:
+{
+  80b91b:	55                   	push   %rbp
+  80b91c:	48 89 e5             	mov    %rsp,%rbp
+  80b91f:	53                   	push   %rbx
+  80b920:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80b927:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80b929:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80b92d:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80b934:	00 00 00 
+  80b937:	ff d0                	call   *%rax
+  80b939:	85 c0                	test   %eax,%eax
+  80b93b:	78 28                	js     80b965 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80b93d:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80b944:	89 df                	mov    %ebx,%edi
+  80b946:	48 b8 37 b8 80 00 00 	movabs $0x80b837,%rax
+  80b94d:	00 00 00 
+  80b950:	ff d0                	call   *%rax
+  80b952:	85 c0                	test   %eax,%eax
+  80b954:	78 0f                	js     80b965 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80b956:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80b959:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80b95d:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80b960:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80b965:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80b969:	c9                   	leave
+  80b96a:	c3                   	ret
+
+000000000080b96b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80b96b:	55                   	push   %rbp
+  80b96c:	48 89 e5             	mov    %rsp,%rbp
+  80b96f:	41 54                	push   %r12
+  80b971:	53                   	push   %rbx
+  80b972:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80b975:	be 00 00 00 00       	mov    $0x0,%esi
+  80b97a:	48 b8 5e c5 80 00 00 	movabs $0x80c55e,%rax
+  80b981:	00 00 00 
+  80b984:	ff d0                	call   *%rax
+  80b986:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80b988:	85 c0                	test   %eax,%eax
+  80b98a:	78 25                	js     80b9b1 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80b98c:	4c 89 e6             	mov    %r12,%rsi
+  80b98f:	89 c7                	mov    %eax,%edi
+  80b991:	48 b8 37 b8 80 00 00 	movabs $0x80b837,%rax
+  80b998:	00 00 00 
+  80b99b:	ff d0                	call   *%rax
+  80b99d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80b9a0:	89 df                	mov    %ebx,%edi
+  80b9a2:	48 b8 d7 b3 80 00 00 	movabs $0x80b3d7,%rax
+  80b9a9:	00 00 00 
+  80b9ac:	ff d0                	call   *%rax
+
+    return res;
+  80b9ae:	44 89 e3             	mov    %r12d,%ebx
+}
+  80b9b1:	89 d8                	mov    %ebx,%eax
+  80b9b3:	5b                   	pop    %rbx
+  80b9b4:	41 5c                	pop    %r12
+  80b9b6:	5d                   	pop    %rbp
+  80b9b7:	c3                   	ret
+
+000000000080b9b8 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  80b9b8:	55                   	push   %rbp
+  80b9b9:	48 89 e5             	mov    %rsp,%rbp
+  80b9bc:	53                   	push   %rbx
+  80b9bd:	48 83 ec 08          	sub    $0x8,%rsp
+  80b9c1:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80b9c4:	48 b8 e4 b1 80 00 00 	movabs $0x80b1e4,%rax
+  80b9cb:	00 00 00 
+  80b9ce:	ff d0                	call   *%rax
+  80b9d0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80b9d4:	0f 87 ea 00 00 00    	ja     80bac4 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  80b9da:	48 b8 04 80 a4 00 00 	movabs $0xa48004,%rax
+  80b9e1:	00 00 00 
+  80b9e4:	80 38 00             	cmpb   $0x0,(%rax)
+  80b9e7:	75 35                	jne    80ba1e <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  80b9e9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80b9ee:	ba 00 00 22 00       	mov    $0x220000,%edx
+  80b9f3:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  80b9f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b9fd:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  80ba04:	00 00 00 
+  80ba07:	ff d0                	call   *%rax
+  80ba09:	85 c0                	test   %eax,%eax
+  80ba0b:	0f 88 ba 00 00 00    	js     80bacb <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80ba11:	48 b8 04 80 a4 00 00 	movabs $0xa48004,%rax
+  80ba18:	00 00 00 
+  80ba1b:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  80ba1e:	48 89 df             	mov    %rbx,%rdi
+  80ba21:	48 b8 e4 b1 80 00 00 	movabs $0x80b1e4,%rax
+  80ba28:	00 00 00 
+  80ba2b:	ff d0                	call   *%rax
+  80ba2d:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  80ba31:	48 ba 20 80 a4 00 00 	movabs $0xa48020,%rdx
+  80ba38:	00 00 00 
+  80ba3b:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80ba3f:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  80ba42:	39 39                	cmp    %edi,(%rcx)
+  80ba44:	74 46                	je     80ba8c <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80ba46:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80ba4a:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  80ba51:	00 
+  80ba52:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80ba59:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  80ba60:	00 
+  80ba61:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80ba68:	00 
+  80ba69:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  80ba70:	00 
+  80ba71:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80ba78:	00 
+  80ba79:	89 39                	mov    %edi,(%rcx)
+  80ba7b:	48 01 c6             	add    %rax,%rsi
+  80ba7e:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  80ba83:	48 89 c8             	mov    %rcx,%rax
+  80ba86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80ba8a:	c9                   	leave
+  80ba8b:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80ba8c:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80ba90:	48 be 20 80 a4 00 00 	movabs $0xa48020,%rsi
+  80ba97:	00 00 00 
+  80ba9a:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80ba9d:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80baa1:	74 e0                	je     80ba83 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80baa3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80baaa:	00 
+  80baab:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80baaf:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  80bab6:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80bab8:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80babb:	48 01 c2             	add    %rax,%rdx
+  80babe:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80bac2:	eb bf                	jmp    80ba83 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80bac4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80bac9:	eb b8                	jmp    80ba83 <fbuf_get+0xcb>
+            return NULL;
+  80bacb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80bad0:	eb b1                	jmp    80ba83 <fbuf_get+0xcb>
+
+000000000080bad2 <fsipc_bulk>:
+fsipc_bulk(void) {
+  80bad2:	55                   	push   %rbp
+  80bad3:	48 89 e5             	mov    %rsp,%rbp
+  80bad6:	53                   	push   %rbx
+  80bad7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  80badb:	48 b8 20 85 a4 00 00 	movabs $0xa48520,%rax
+  80bae2:	00 00 00 
+  80bae5:	48 8b 18             	mov    (%rax),%rbx
+  80bae8:	48 85 db             	test   %rbx,%rbx
+  80baeb:	74 16                	je     80bb03 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  80baed:	48 b8 20 85 a4 00 00 	movabs $0xa48520,%rax
+  80baf4:	00 00 00 
+  80baf7:	48 8b 18             	mov    (%rax),%rbx
+}
+  80bafa:	48 89 d8             	mov    %rbx,%rax
+  80bafd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80bb01:	c9                   	leave
+  80bb02:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  80bb03:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80bb08:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80bb0d:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  80bb12:	bf 00 00 00 00       	mov    $0x0,%edi
+  80bb17:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  80bb1e:	00 00 00 
+  80bb21:	ff d0                	call   *%rax
+  80bb23:	85 c0                	test   %eax,%eax
+  80bb25:	78 d3                	js     80bafa <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  80bb27:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  80bb2c:	48 a3 20 85 a4 00 00 	movabs %rax,0xa48520
+  80bb33:	00 00 00 
+  80bb36:	eb b5                	jmp    80baed <fsipc_bulk+0x1b>
+
+000000000080bb38 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80bb38:	55                   	push   %rbp
+  80bb39:	48 89 e5             	mov    %rsp,%rbp
+  80bb3c:	41 57                	push   %r15
+  80bb3e:	41 56                	push   %r14
+  80bb40:	41 55                	push   %r13
+  80bb42:	41 54                	push   %r12
+  80bb44:	53                   	push   %rbx
+  80bb45:	48 83 ec 08          	sub    $0x8,%rsp
+  80bb49:	41 89 fd             	mov    %edi,%r13d
+  80bb4c:	49 89 f6             	mov    %rsi,%r14
+  80bb4f:	49 89 d7             	mov    %rdx,%r15
+  80bb52:	48 89 cb             	mov    %rcx,%rbx
+  80bb55:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80bb58:	48 b8 00 80 a4 00 00 	movabs $0xa48000,%rax
+  80bb5f:	00 00 00 
+  80bb62:	83 38 00             	cmpl   $0x0,(%rax)
+  80bb65:	74 52                	je     80bbb9 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80bb67:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80bb6d:	4c 89 f9             	mov    %r15,%rcx
+  80bb70:	4c 89 f2             	mov    %r14,%rdx
+  80bb73:	44 89 ee             	mov    %r13d,%esi
+  80bb76:	48 b8 00 80 a4 00 00 	movabs $0xa48000,%rax
+  80bb7d:	00 00 00 
+  80bb80:	8b 38                	mov    (%rax),%edi
+  80bb82:	48 b8 f1 b0 80 00 00 	movabs $0x80b0f1,%rax
+  80bb89:	00 00 00 
+  80bb8c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80bb8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80bb93:	4c 89 e2             	mov    %r12,%rdx
+  80bb96:	48 89 de             	mov    %rbx,%rsi
+  80bb99:	bf 00 00 00 00       	mov    $0x0,%edi
+  80bb9e:	48 b8 41 af 80 00 00 	movabs $0x80af41,%rax
+  80bba5:	00 00 00 
+  80bba8:	ff d0                	call   *%rax
+}
+  80bbaa:	48 83 c4 08          	add    $0x8,%rsp
+  80bbae:	5b                   	pop    %rbx
+  80bbaf:	41 5c                	pop    %r12
+  80bbb1:	41 5d                	pop    %r13
+  80bbb3:	41 5e                	pop    %r14
+  80bbb5:	41 5f                	pop    %r15
+  80bbb7:	5d                   	pop    %rbp
+  80bbb8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80bbb9:	bf 03 00 00 00       	mov    $0x3,%edi
+  80bbbe:	48 b8 94 b1 80 00 00 	movabs $0x80b194,%rax
+  80bbc5:	00 00 00 
+  80bbc8:	ff d0                	call   *%rax
+  80bbca:	a3 00 80 a4 00 00 00 	movabs %eax,0xa48000
+  80bbd1:	00 00 
+  80bbd3:	eb 92                	jmp    80bb67 <fsipc_region+0x2f>
+
+000000000080bbd5 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80bbd5:	55                   	push   %rbp
+  80bbd6:	48 89 e5             	mov    %rsp,%rbp
+  80bbd9:	41 57                	push   %r15
+  80bbdb:	41 56                	push   %r14
+  80bbdd:	41 55                	push   %r13
+  80bbdf:	41 54                	push   %r12
+  80bbe1:	53                   	push   %rbx
+  80bbe2:	48 83 ec 28          	sub    $0x28,%rsp
+  80bbe6:	49 89 ff             	mov    %rdi,%r15
+  80bbe9:	49 89 f6             	mov    %rsi,%r14
+  80bbec:	48 89 d3             	mov    %rdx,%rbx
+  80bbef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80bbf3:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  80bbf6:	48 b8 d2 ba 80 00 00 	movabs $0x80bad2,%rax
+  80bbfd:	00 00 00 
+  80bc00:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  80bc02:	48 85 c0             	test   %rax,%rax
+  80bc05:	0f 84 cc 00 00 00    	je     80bcd7 <devfile_write_direct+0x102>
+  80bc0b:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  80bc0e:	48 85 db             	test   %rbx,%rbx
+  80bc11:	0f 84 ba 00 00 00    	je     80bcd1 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  80bc17:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80bc1d:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80bc24:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  80bc28:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80bc2c:	4c 29 e3             	sub    %r12,%rbx
+  80bc2f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80bc34:	48 39 c3             	cmp    %rax,%rbx
+  80bc37:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80bc3b:	48 89 da             	mov    %rbx,%rdx
+  80bc3e:	4c 89 f6             	mov    %r14,%rsi
+  80bc41:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80bc45:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  80bc4c:	00 00 00 
+  80bc4f:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  80bc51:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80bc55:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  80bc59:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80bc5c:	44 01 e0             	add    %r12d,%eax
+  80bc5f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  80bc63:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80bc67:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80bc6e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80bc75:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80bc7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80bc82:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80bc87:	4c 89 ee             	mov    %r13,%rsi
+  80bc8a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80bc8f:	48 b8 38 bb 80 00 00 	movabs $0x80bb38,%rax
+  80bc96:	00 00 00 
+  80bc99:	ff d0                	call   *%rax
+        if (res < 0)
+  80bc9b:	85 c0                	test   %eax,%eax
+  80bc9d:	78 29                	js     80bcc8 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80bc9f:	74 2b                	je     80bccc <devfile_write_direct+0xf7>
+        i += res;
+  80bca1:	48 98                	cltq
+  80bca3:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  80bca6:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  80bca9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80bcad:	49 39 c4             	cmp    %rax,%r12
+  80bcb0:	0f 82 72 ff ff ff    	jb     80bc28 <devfile_write_direct+0x53>
+    return i;
+  80bcb6:	4c 89 e0             	mov    %r12,%rax
+}
+  80bcb9:	48 83 c4 28          	add    $0x28,%rsp
+  80bcbd:	5b                   	pop    %rbx
+  80bcbe:	41 5c                	pop    %r12
+  80bcc0:	41 5d                	pop    %r13
+  80bcc2:	41 5e                	pop    %r14
+  80bcc4:	41 5f                	pop    %r15
+  80bcc6:	5d                   	pop    %rbp
+  80bcc7:	c3                   	ret
+            return res;
+  80bcc8:	48 98                	cltq
+  80bcca:	eb ed                	jmp    80bcb9 <devfile_write_direct+0xe4>
+            return i;
+  80bccc:	4c 89 e0             	mov    %r12,%rax
+  80bccf:	eb e8                	jmp    80bcb9 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80bcd1:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  80bcd5:	eb df                	jmp    80bcb6 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  80bcd7:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  80bcde:	eb d9                	jmp    80bcb9 <devfile_write_direct+0xe4>
+
+000000000080bce0 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  80bce0:	55                   	push   %rbp
+  80bce1:	48 89 e5             	mov    %rsp,%rbp
+  80bce4:	41 56                	push   %r14
+  80bce6:	41 55                	push   %r13
+  80bce8:	41 54                	push   %r12
+  80bcea:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  80bceb:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  80bcef:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  80bcf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  80bcf8:	4d 39 ee             	cmp    %r13,%r14
+  80bcfb:	0f 84 99 00 00 00    	je     80bd9a <fbuf_flush+0xba>
+  80bd01:	49 89 fc             	mov    %rdi,%r12
+  80bd04:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  80bd07:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  80bd0a:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80bd0e:	48 b8 e4 b1 80 00 00 	movabs $0x80b1e4,%rax
+  80bd15:	00 00 00 
+  80bd18:	ff d0                	call   *%rax
+  80bd1a:	48 89 c2             	mov    %rax,%rdx
+  80bd1d:	48 c1 e2 04          	shl    $0x4,%rdx
+  80bd21:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80bd25:	48 c1 e0 0c          	shl    $0xc,%rax
+  80bd29:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80bd2e:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  80bd31:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80bd35:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80bd3c:	00 
+  80bd3d:	44 89 f1             	mov    %r14d,%ecx
+  80bd40:	4c 89 ea             	mov    %r13,%rdx
+  80bd43:	4c 89 e7             	mov    %r12,%rdi
+  80bd46:	48 b8 d5 bb 80 00 00 	movabs $0x80bbd5,%rax
+  80bd4d:	00 00 00 
+  80bd50:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80bd52:	48 85 c0             	test   %rax,%rax
+  80bd55:	78 43                	js     80bd9a <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80bd57:	4c 39 e8             	cmp    %r13,%rax
+  80bd5a:	72 47                	jb     80bda3 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80bd5c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80bd61:	83 c0 01             	add    $0x1,%eax
+  80bd64:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80bd69:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80bd6c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80bd70:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  80bd74:	72 0f                	jb     80bd85 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  80bd76:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80bd7a:	48 39 c2             	cmp    %rax,%rdx
+  80bd7d:	48 0f 42 d0          	cmovb  %rax,%rdx
+  80bd81:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  80bd85:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80bd8c:	00 
+  80bd8d:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  80bd94:	00 
+    return 0;
+  80bd95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80bd9a:	5b                   	pop    %rbx
+  80bd9b:	41 5c                	pop    %r12
+  80bd9d:	41 5d                	pop    %r13
+  80bd9f:	41 5e                	pop    %r14
+  80bda1:	5d                   	pop    %rbp
+  80bda2:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  80bda3:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80bda8:	eb f0                	jmp    80bd9a <fbuf_flush+0xba>
+
+000000000080bdaa <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80bdaa:	55                   	push   %rbp
+  80bdab:	48 89 e5             	mov    %rsp,%rbp
+  80bdae:	53                   	push   %rbx
+  80bdaf:	48 83 ec 08          	sub    $0x8,%rsp
+  80bdb3:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  80bdb6:	48 b8 b8 b9 80 00 00 	movabs $0x80b9b8,%rax
+  80bdbd:	00 00 00 
+  80bdc0:	ff d0                	call   *%rax
+  80bdc2:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  80bdc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  80bdca:	48 85 f6             	test   %rsi,%rsi
+  80bdcd:	74 0f                	je     80bdde <devfile_sync+0x34>
+  80bdcf:	48 89 df             	mov    %rbx,%rdi
+  80bdd2:	48 b8 e0 bc 80 00 00 	movabs $0x80bce0,%rax
+  80bdd9:	00 00 00 
+  80bddc:	ff d0                	call   *%rax
+}
+  80bdde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80bde2:	c9                   	leave
+  80bde3:	c3                   	ret
+
+000000000080bde4 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80bde4:	55                   	push   %rbp
+  80bde5:	48 89 e5             	mov    %rsp,%rbp
+  80bde8:	48 83 ec 10          	sub    $0x10,%rsp
+  80bdec:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  80bdef:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80bdf6:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  80bdf7:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  80bdfb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80be00:	48 be 00 70 a4 00 00 	movabs $0xa47000,%rsi
+  80be07:	00 00 00 
+  80be0a:	48 b8 38 bb 80 00 00 	movabs $0x80bb38,%rax
+  80be11:	00 00 00 
+  80be14:	ff d0                	call   *%rax
+}
+  80be16:	c9                   	leave
+  80be17:	c3                   	ret
+
+000000000080be18 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80be18:	55                   	push   %rbp
+  80be19:	48 89 e5             	mov    %rsp,%rbp
+  80be1c:	41 54                	push   %r12
+  80be1e:	53                   	push   %rbx
+  80be1f:	48 89 fb             	mov    %rdi,%rbx
+  80be22:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  80be25:	48 b8 aa bd 80 00 00 	movabs $0x80bdaa,%rax
+  80be2c:	00 00 00 
+  80be2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80be31:	85 c0                	test   %eax,%eax
+  80be33:	78 63                	js     80be98 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80be35:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80be38:	a3 00 70 a4 00 00 00 	movabs %eax,0xa47000
+  80be3f:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  80be41:	be 00 00 00 00       	mov    $0x0,%esi
+  80be46:	bf 05 00 00 00       	mov    $0x5,%edi
+  80be4b:	48 b8 e4 bd 80 00 00 	movabs $0x80bde4,%rax
+  80be52:	00 00 00 
+  80be55:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80be57:	85 c0                	test   %eax,%eax
+  80be59:	78 3d                	js     80be98 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80be5b:	48 bb 00 70 a4 00 00 	movabs $0xa47000,%rbx
+  80be62:	00 00 00 
+  80be65:	48 89 de             	mov    %rbx,%rsi
+  80be68:	4c 89 e7             	mov    %r12,%rdi
+  80be6b:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  80be72:	00 00 00 
+  80be75:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80be77:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80be7d:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  80be84:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80be85:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80be8b:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  80be92:	00 
+
+    return 0;
+  80be93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80be98:	5b                   	pop    %rbx
+  80be99:	41 5c                	pop    %r12
+  80be9b:	5d                   	pop    %rbp
+  80be9c:	c3                   	ret
+
+000000000080be9d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80be9d:	55                   	push   %rbp
+  80be9e:	48 89 e5             	mov    %rsp,%rbp
+  80bea1:	41 54                	push   %r12
+  80bea3:	53                   	push   %rbx
+  80bea4:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  80bea7:	48 b8 aa bd 80 00 00 	movabs $0x80bdaa,%rax
+  80beae:	00 00 00 
+  80beb1:	ff d0                	call   *%rax
+  80beb3:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  80beb6:	48 89 df             	mov    %rbx,%rdi
+  80beb9:	48 b8 e4 b1 80 00 00 	movabs $0x80b1e4,%rax
+  80bec0:	00 00 00 
+  80bec3:	ff d0                	call   *%rax
+  80bec5:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80bec9:	76 2e                	jbe    80bef9 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  80becb:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80bece:	a3 00 70 a4 00 00 00 	movabs %eax,0xa47000
+  80bed5:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  80bed7:	be 00 00 00 00       	mov    $0x0,%esi
+  80bedc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80bee1:	48 b8 e4 bd 80 00 00 	movabs $0x80bde4,%rax
+  80bee8:	00 00 00 
+  80beeb:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  80beed:	45 85 e4             	test   %r12d,%r12d
+  80bef0:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  80bef4:	5b                   	pop    %rbx
+  80bef5:	41 5c                	pop    %r12
+  80bef7:	5d                   	pop    %rbp
+  80bef8:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  80bef9:	48 89 df             	mov    %rbx,%rdi
+  80befc:	48 b8 e4 b1 80 00 00 	movabs $0x80b1e4,%rax
+  80bf03:	00 00 00 
+  80bf06:	ff d0                	call   *%rax
+  80bf08:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80bf0c:	48 b8 20 80 a4 00 00 	movabs $0xa48020,%rax
+  80bf13:	00 00 00 
+  80bf16:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  80bf1d:	48 89 df             	mov    %rbx,%rdi
+  80bf20:	48 b8 f6 b1 80 00 00 	movabs $0x80b1f6,%rax
+  80bf27:	00 00 00 
+  80bf2a:	ff d0                	call   *%rax
+  80bf2c:	48 89 c6             	mov    %rax,%rsi
+  80bf2f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80bf34:	bf 00 00 00 00       	mov    $0x0,%edi
+  80bf39:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  80bf40:	00 00 00 
+  80bf43:	ff d0                	call   *%rax
+  80bf45:	eb 84                	jmp    80becb <devfile_flush+0x2e>
+
+000000000080bf47 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80bf47:	55                   	push   %rbp
+  80bf48:	48 89 e5             	mov    %rsp,%rbp
+  80bf4b:	41 55                	push   %r13
+  80bf4d:	41 54                	push   %r12
+  80bf4f:	53                   	push   %rbx
+  80bf50:	48 83 ec 08          	sub    $0x8,%rsp
+  80bf54:	48 89 fb             	mov    %rdi,%rbx
+  80bf57:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  80bf5a:	48 b8 b8 b9 80 00 00 	movabs $0x80b9b8,%rax
+  80bf61:	00 00 00 
+  80bf64:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80bf66:	48 85 c0             	test   %rax,%rax
+  80bf69:	74 51                	je     80bfbc <devfile_trunc+0x75>
+  80bf6b:	49 89 c4             	mov    %rax,%r12
+  80bf6e:	48 89 c6             	mov    %rax,%rsi
+  80bf71:	48 89 df             	mov    %rbx,%rdi
+  80bf74:	48 b8 e0 bc 80 00 00 	movabs $0x80bce0,%rax
+  80bf7b:	00 00 00 
+  80bf7e:	ff d0                	call   *%rax
+  80bf80:	85 c0                	test   %eax,%eax
+  80bf82:	78 2d                	js     80bfb1 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80bf84:	48 b8 00 70 a4 00 00 	movabs $0xa47000,%rax
+  80bf8b:	00 00 00 
+  80bf8e:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80bf91:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80bf93:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  80bf97:	be 00 00 00 00       	mov    $0x0,%esi
+  80bf9c:	bf 02 00 00 00       	mov    $0x2,%edi
+  80bfa1:	48 b8 e4 bd 80 00 00 	movabs $0x80bde4,%rax
+  80bfa8:	00 00 00 
+  80bfab:	ff d0                	call   *%rax
+    if (res >= 0) {
+  80bfad:	85 c0                	test   %eax,%eax
+  80bfaf:	79 3e                	jns    80bfef <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  80bfb1:	48 83 c4 08          	add    $0x8,%rsp
+  80bfb5:	5b                   	pop    %rbx
+  80bfb6:	41 5c                	pop    %r12
+  80bfb8:	41 5d                	pop    %r13
+  80bfba:	5d                   	pop    %rbp
+  80bfbb:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80bfbc:	48 b8 00 70 a4 00 00 	movabs $0xa47000,%rax
+  80bfc3:	00 00 00 
+  80bfc6:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80bfc9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80bfcb:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  80bfcf:	be 00 00 00 00       	mov    $0x0,%esi
+  80bfd4:	bf 02 00 00 00       	mov    $0x2,%edi
+  80bfd9:	48 b8 e4 bd 80 00 00 	movabs $0x80bde4,%rax
+  80bfe0:	00 00 00 
+  80bfe3:	ff d0                	call   *%rax
+    if (res >= 0) {
+  80bfe5:	85 c0                	test   %eax,%eax
+  80bfe7:	78 c8                	js     80bfb1 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  80bfe9:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80bfed:	eb c2                	jmp    80bfb1 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  80bfef:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  80bff2:	8d 51 01             	lea    0x1(%rcx),%edx
+  80bff5:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80bff8:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  80bffd:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80c004:	00 00 
+  80c006:	eb a9                	jmp    80bfb1 <devfile_trunc+0x6a>
+
+000000000080c008 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80c008:	55                   	push   %rbp
+  80c009:	48 89 e5             	mov    %rsp,%rbp
+  80c00c:	41 57                	push   %r15
+  80c00e:	41 56                	push   %r14
+  80c010:	41 55                	push   %r13
+  80c012:	41 54                	push   %r12
+  80c014:	53                   	push   %rbx
+  80c015:	48 83 ec 28          	sub    $0x28,%rsp
+  80c019:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80c01d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80c021:	49 89 d7             	mov    %rdx,%r15
+  80c024:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  80c028:	48 b8 b8 b9 80 00 00 	movabs $0x80b9b8,%rax
+  80c02f:	00 00 00 
+  80c032:	ff d0                	call   *%rax
+  80c034:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  80c037:	48 85 c0             	test   %rax,%rax
+  80c03a:	74 31                	je     80c06d <devfile_write+0x65>
+  80c03c:	4c 89 f8             	mov    %r15,%rax
+  80c03f:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  80c046:	77 25                	ja     80c06d <devfile_write+0x65>
+    size_t i = 0;
+  80c048:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  80c04e:	48 85 c0             	test   %rax,%rax
+  80c051:	0f 85 64 01 00 00    	jne    80c1bb <devfile_write+0x1b3>
+    size_t i = 0;
+  80c057:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  80c05b:	4c 89 f8             	mov    %r15,%rax
+}
+  80c05e:	48 83 c4 28          	add    $0x28,%rsp
+  80c062:	5b                   	pop    %rbx
+  80c063:	41 5c                	pop    %r12
+  80c065:	41 5d                	pop    %r13
+  80c067:	41 5e                	pop    %r14
+  80c069:	41 5f                	pop    %r15
+  80c06b:	5d                   	pop    %rbp
+  80c06c:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80c06d:	48 85 db             	test   %rbx,%rbx
+  80c070:	74 5b                	je     80c0cd <devfile_write+0xc5>
+  80c072:	48 89 de             	mov    %rbx,%rsi
+  80c075:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80c079:	48 b8 e0 bc 80 00 00 	movabs $0x80bce0,%rax
+  80c080:	00 00 00 
+  80c083:	ff d0                	call   *%rax
+  80c085:	85 c0                	test   %eax,%eax
+  80c087:	78 40                	js     80c0c9 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80c089:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80c08d:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  80c090:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80c094:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80c098:	48 b8 d5 bb 80 00 00 	movabs $0x80bbd5,%rax
+  80c09f:	00 00 00 
+  80c0a2:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80c0a4:	48 85 c0             	test   %rax,%rax
+  80c0a7:	7e b5                	jle    80c05e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80c0a9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80c0ad:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  80c0b0:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  80c0b3:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  80c0b6:	8d 51 01             	lea    0x1(%rcx),%edx
+  80c0b9:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80c0bc:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  80c0bf:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80c0c6:	00 
+  80c0c7:	eb 95                	jmp    80c05e <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80c0c9:	48 98                	cltq
+  80c0cb:	eb 91                	jmp    80c05e <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80c0cd:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80c0d1:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  80c0d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80c0d8:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80c0dc:	48 89 df             	mov    %rbx,%rdi
+  80c0df:	48 b8 d5 bb 80 00 00 	movabs $0x80bbd5,%rax
+  80c0e6:	00 00 00 
+  80c0e9:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80c0eb:	48 85 c0             	test   %rax,%rax
+  80c0ee:	0f 8e 6a ff ff ff    	jle    80c05e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80c0f4:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  80c0f7:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80c0fb:	e9 5e ff ff ff       	jmp    80c05e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80c100:	48 98                	cltq
+  80c102:	4d 85 ff             	test   %r15,%r15
+  80c105:	49 0f 45 c7          	cmovne %r15,%rax
+  80c109:	e9 50 ff ff ff       	jmp    80c05e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80c10e:	48 89 de             	mov    %rbx,%rsi
+  80c111:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80c115:	48 b8 e0 bc 80 00 00 	movabs $0x80bce0,%rax
+  80c11c:	00 00 00 
+  80c11f:	ff d0                	call   *%rax
+  80c121:	85 c0                	test   %eax,%eax
+  80c123:	0f 88 2b 01 00 00    	js     80c254 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80c129:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80c12d:	4c 01 f8             	add    %r15,%rax
+  80c130:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80c134:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80c138:	48 b9 e4 b1 80 00 00 	movabs $0x80b1e4,%rcx
+  80c13f:	00 00 00 
+  80c142:	ff d1                	call   *%rcx
+  80c144:	48 89 c2             	mov    %rax,%rdx
+  80c147:	48 c1 e2 04          	shl    $0x4,%rdx
+  80c14b:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80c14f:	48 c1 e0 0c          	shl    $0xc,%rax
+  80c153:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  80c158:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80c15b:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80c162:	00 
+  80c163:	4c 89 ea             	mov    %r13,%rdx
+  80c166:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80c16a:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  80c171:	00 00 00 
+  80c174:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  80c176:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80c17a:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80c17e:	48 39 c2             	cmp    %rax,%rdx
+  80c181:	0f 84 db 00 00 00    	je     80c262 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  80c187:	4c 39 e2             	cmp    %r12,%rdx
+  80c18a:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  80c18e:	4d 01 ec             	add    %r13,%r12
+  80c191:	49 39 c4             	cmp    %rax,%r12
+  80c194:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  80c198:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  80c19c:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  80c1a0:	45 01 ee             	add    %r13d,%r14d
+  80c1a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80c1a7:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  80c1ab:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  80c1ae:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80c1b2:	49 39 c7             	cmp    %rax,%r15
+  80c1b5:	0f 83 a0 fe ff ff    	jae    80c05b <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  80c1bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80c1bf:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  80c1c3:	8b 43 08             	mov    0x8(%rbx),%eax
+  80c1c6:	44 39 f0             	cmp    %r14d,%eax
+  80c1c9:	7f 10                	jg     80c1db <devfile_write+0x1d3>
+  80c1cb:	48 98                	cltq
+  80c1cd:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  80c1d3:	49 63 d6             	movslq %r14d,%rdx
+  80c1d6:	48 39 d0             	cmp    %rdx,%rax
+  80c1d9:	7d 2d                	jge    80c208 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80c1db:	48 89 de             	mov    %rbx,%rsi
+  80c1de:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80c1e2:	48 b8 e0 bc 80 00 00 	movabs $0x80bce0,%rax
+  80c1e9:	00 00 00 
+  80c1ec:	ff d0                	call   *%rax
+  80c1ee:	85 c0                	test   %eax,%eax
+  80c1f0:	0f 88 0a ff ff ff    	js     80c100 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80c1f6:	44 89 f0             	mov    %r14d,%eax
+  80c1f9:	66 b8 00 00          	mov    $0x0,%ax
+  80c1fd:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  80c200:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80c207:	00 
+        size_t off = pos - fb->fb_base;
+  80c208:	45 89 f4             	mov    %r14d,%r12d
+  80c20b:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  80c20f:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  80c212:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  80c216:	4d 29 fd             	sub    %r15,%r13
+  80c219:	b8 00 00 01 00       	mov    $0x10000,%eax
+  80c21e:	4c 29 e0             	sub    %r12,%rax
+  80c221:	49 39 c5             	cmp    %rax,%r13
+  80c224:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  80c228:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80c22c:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80c230:	48 39 c2             	cmp    %rax,%rdx
+  80c233:	0f 84 f0 fe ff ff    	je     80c129 <devfile_write+0x121>
+  80c239:	4c 39 e0             	cmp    %r12,%rax
+  80c23c:	0f 82 cc fe ff ff    	jb     80c10e <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  80c242:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80c246:	48 39 d0             	cmp    %rdx,%rax
+  80c249:	0f 83 da fe ff ff    	jae    80c129 <devfile_write+0x121>
+  80c24f:	e9 ba fe ff ff       	jmp    80c10e <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80c254:	48 98                	cltq
+  80c256:	4d 85 ff             	test   %r15,%r15
+  80c259:	49 0f 45 c7          	cmovne %r15,%rax
+  80c25d:	e9 fc fd ff ff       	jmp    80c05e <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  80c262:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80c266:	4c 89 e2             	mov    %r12,%rdx
+  80c269:	e9 2a ff ff ff       	jmp    80c198 <devfile_write+0x190>
+
+000000000080c26e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80c26e:	55                   	push   %rbp
+  80c26f:	48 89 e5             	mov    %rsp,%rbp
+  80c272:	41 57                	push   %r15
+  80c274:	41 56                	push   %r14
+  80c276:	41 55                	push   %r13
+  80c278:	41 54                	push   %r12
+  80c27a:	53                   	push   %rbx
+  80c27b:	48 83 ec 28          	sub    $0x28,%rsp
+  80c27f:	49 89 ff             	mov    %rdi,%r15
+  80c282:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80c286:	48 89 d3             	mov    %rdx,%rbx
+  80c289:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  80c28d:	48 b8 b8 b9 80 00 00 	movabs $0x80b9b8,%rax
+  80c294:	00 00 00 
+  80c297:	ff d0                	call   *%rax
+  80c299:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  80c29c:	48 85 c0             	test   %rax,%rax
+  80c29f:	74 0d                	je     80c2ae <devfile_read+0x40>
+  80c2a1:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  80c2a8:	0f 86 1a 01 00 00    	jbe    80c3c8 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80c2ae:	4d 85 e4             	test   %r12,%r12
+  80c2b1:	74 1a                	je     80c2cd <devfile_read+0x5f>
+  80c2b3:	4c 89 e6             	mov    %r12,%rsi
+  80c2b6:	4c 89 ff             	mov    %r15,%rdi
+  80c2b9:	48 b8 e0 bc 80 00 00 	movabs $0x80bce0,%rax
+  80c2c0:	00 00 00 
+  80c2c3:	ff d0                	call   *%rax
+  80c2c5:	85 c0                	test   %eax,%eax
+  80c2c7:	0f 88 e8 00 00 00    	js     80c3b5 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  80c2cd:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  80c2d1:	48 b8 d2 ba 80 00 00 	movabs $0x80bad2,%rax
+  80c2d8:	00 00 00 
+  80c2db:	ff d0                	call   *%rax
+  80c2dd:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  80c2e0:	48 85 c0             	test   %rax,%rax
+  80c2e3:	0f 84 69 02 00 00    	je     80c552 <devfile_read+0x2e4>
+    while (i < n) {
+  80c2e9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80c2ee:	0f 84 ce 00 00 00    	je     80c3c2 <devfile_read+0x154>
+    size_t i = 0;
+  80c2f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80c2f9:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80c300:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80c304:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80c308:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  80c30c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80c310:	48 29 da             	sub    %rbx,%rdx
+  80c313:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80c318:	48 39 c2             	cmp    %rax,%rdx
+  80c31b:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  80c31f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80c323:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  80c327:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80c32a:	01 d8                	add    %ebx,%eax
+  80c32c:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  80c330:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  80c334:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  80c33b:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80c342:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80c349:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80c34f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80c354:	4c 89 ee             	mov    %r13,%rsi
+  80c357:	bf 03 00 00 00       	mov    $0x3,%edi
+  80c35c:	48 b8 38 bb 80 00 00 	movabs $0x80bb38,%rax
+  80c363:	00 00 00 
+  80c366:	ff d0                	call   *%rax
+        if (res < 0)
+  80c368:	85 c0                	test   %eax,%eax
+  80c36a:	78 4d                	js     80c3b9 <devfile_read+0x14b>
+        if (res == 0)
+  80c36c:	74 4f                	je     80c3bd <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80c36e:	4c 63 e0             	movslq %eax,%r12
+  80c371:	4c 89 e2             	mov    %r12,%rdx
+  80c374:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80c378:	4c 89 f7             	mov    %r14,%rdi
+  80c37b:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  80c382:	00 00 00 
+  80c385:	ff d0                	call   *%rax
+        i += res;
+  80c387:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  80c38a:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  80c38d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80c391:	48 39 c3             	cmp    %rax,%rbx
+  80c394:	0f 82 72 ff ff ff    	jb     80c30c <devfile_read+0x9e>
+    return i;
+  80c39a:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80c39d:	48 85 c0             	test   %rax,%rax
+  80c3a0:	7e 04                	jle    80c3a6 <devfile_read+0x138>
+  80c3a2:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  80c3a6:	48 83 c4 28          	add    $0x28,%rsp
+  80c3aa:	5b                   	pop    %rbx
+  80c3ab:	41 5c                	pop    %r12
+  80c3ad:	41 5d                	pop    %r13
+  80c3af:	41 5e                	pop    %r14
+  80c3b1:	41 5f                	pop    %r15
+  80c3b3:	5d                   	pop    %rbp
+  80c3b4:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80c3b5:	48 98                	cltq
+  80c3b7:	eb ed                	jmp    80c3a6 <devfile_read+0x138>
+            return res;
+  80c3b9:	48 98                	cltq
+  80c3bb:	eb e9                	jmp    80c3a6 <devfile_read+0x138>
+            return i;
+  80c3bd:	48 89 d8             	mov    %rbx,%rax
+  80c3c0:	eb db                	jmp    80c39d <devfile_read+0x12f>
+    size_t i = 0;
+  80c3c2:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80c3c6:	eb d2                	jmp    80c39a <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80c3c8:	48 89 c6             	mov    %rax,%rsi
+  80c3cb:	4c 89 ff             	mov    %r15,%rdi
+  80c3ce:	48 b8 e0 bc 80 00 00 	movabs $0x80bce0,%rax
+  80c3d5:	00 00 00 
+  80c3d8:	ff d0                	call   *%rax
+  80c3da:	85 c0                	test   %eax,%eax
+  80c3dc:	78 40                	js     80c41e <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80c3de:	4c 89 ff             	mov    %r15,%rdi
+  80c3e1:	48 b8 e4 b1 80 00 00 	movabs $0x80b1e4,%rax
+  80c3e8:	00 00 00 
+  80c3eb:	ff d0                	call   *%rax
+  80c3ed:	48 89 c2             	mov    %rax,%rdx
+  80c3f0:	48 c1 e2 04          	shl    $0x4,%rdx
+  80c3f4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80c3f8:	48 c1 e0 0c          	shl    $0xc,%rax
+  80c3fc:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80c401:	48 01 d0             	add    %rdx,%rax
+  80c404:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80c408:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80c40d:	0f 84 33 01 00 00    	je     80c546 <devfile_read+0x2d8>
+    size_t i = 0;
+  80c413:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80c419:	e9 f5 00 00 00       	jmp    80c513 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80c41e:	48 98                	cltq
+  80c420:	eb 84                	jmp    80c3a6 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80c422:	44 89 e8             	mov    %r13d,%eax
+  80c425:	66 b8 00 00          	mov    $0x0,%ax
+  80c429:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  80c42e:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80c435:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  80c437:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80c43b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80c43f:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  80c441:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80c446:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80c449:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  80c450:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  80c451:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80c457:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80c45c:	ba 00 10 01 00       	mov    $0x11000,%edx
+  80c461:	bf 03 00 00 00       	mov    $0x3,%edi
+  80c466:	48 b8 38 bb 80 00 00 	movabs $0x80bb38,%rax
+  80c46d:	00 00 00 
+  80c470:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  80c472:	85 c0                	test   %eax,%eax
+  80c474:	0f 88 be 00 00 00    	js     80c538 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80c47a:	48 63 d0             	movslq %eax,%rdx
+  80c47d:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  80c482:	41 03 44 24 08       	add    0x8(%r12),%eax
+  80c487:	44 39 e8             	cmp    %r13d,%eax
+  80c48a:	0f 8e ba 00 00 00    	jle    80c54a <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80c490:	49 63 c5             	movslq %r13d,%rax
+  80c493:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  80c498:	48 29 c3             	sub    %rax,%rbx
+  80c49b:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80c4a0:	48 01 c3             	add    %rax,%rbx
+  80c4a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80c4a7:	4c 29 f0             	sub    %r14,%rax
+  80c4aa:	48 39 c3             	cmp    %rax,%rbx
+  80c4ad:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80c4b1:	4c 89 ff             	mov    %r15,%rdi
+  80c4b4:	48 b9 e4 b1 80 00 00 	movabs $0x80b1e4,%rcx
+  80c4bb:	00 00 00 
+  80c4be:	ff d1                	call   *%rcx
+  80c4c0:	48 89 c2             	mov    %rax,%rdx
+  80c4c3:	48 c1 e2 04          	shl    $0x4,%rdx
+  80c4c7:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80c4cb:	48 c1 e0 0c          	shl    $0xc,%rax
+  80c4cf:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  80c4d4:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  80c4d7:	44 89 ea             	mov    %r13d,%edx
+  80c4da:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  80c4df:	48 63 d2             	movslq %edx,%rdx
+  80c4e2:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80c4e9:	00 
+  80c4ea:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80c4ee:	4c 01 f7             	add    %r14,%rdi
+  80c4f1:	48 89 da             	mov    %rbx,%rdx
+  80c4f4:	48 b9 a2 9e 80 00 00 	movabs $0x809ea2,%rcx
+  80c4fb:	00 00 00 
+  80c4fe:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80c500:	41 01 dd             	add    %ebx,%r13d
+  80c503:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  80c507:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80c50a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80c50e:	49 39 c6             	cmp    %rax,%r14
+  80c511:	73 37                	jae    80c54a <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  80c513:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  80c517:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80c51c:	44 39 e8             	cmp    %r13d,%eax
+  80c51f:	0f 8f fd fe ff ff    	jg     80c422 <devfile_read+0x1b4>
+  80c525:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80c52a:	44 39 e8             	cmp    %r13d,%eax
+  80c52d:	0f 8f 5d ff ff ff    	jg     80c490 <devfile_read+0x222>
+  80c533:	e9 ea fe ff ff       	jmp    80c422 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80c538:	48 98                	cltq
+  80c53a:	4d 85 f6             	test   %r14,%r14
+  80c53d:	49 0f 45 c6          	cmovne %r14,%rax
+  80c541:	e9 60 fe ff ff       	jmp    80c3a6 <devfile_read+0x138>
+    size_t i = 0;
+  80c546:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80c54a:	4c 89 f0             	mov    %r14,%rax
+  80c54d:	e9 54 fe ff ff       	jmp    80c3a6 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80c552:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80c559:	e9 48 fe ff ff       	jmp    80c3a6 <devfile_read+0x138>
+
+000000000080c55e <open>:
+open(const char *path, int mode) {
+  80c55e:	55                   	push   %rbp
+  80c55f:	48 89 e5             	mov    %rsp,%rbp
+  80c562:	41 55                	push   %r13
+  80c564:	41 54                	push   %r12
+  80c566:	53                   	push   %rbx
+  80c567:	48 83 ec 18          	sub    $0x18,%rsp
+  80c56b:	49 89 fc             	mov    %rdi,%r12
+  80c56e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80c571:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  80c578:	00 00 00 
+  80c57b:	ff d0                	call   *%rax
+  80c57d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80c583:	0f 87 8a 00 00 00    	ja     80c613 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80c589:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80c58d:	48 b8 12 b2 80 00 00 	movabs $0x80b212,%rax
+  80c594:	00 00 00 
+  80c597:	ff d0                	call   *%rax
+  80c599:	89 c3                	mov    %eax,%ebx
+  80c59b:	85 c0                	test   %eax,%eax
+  80c59d:	78 50                	js     80c5ef <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80c59f:	4c 89 e6             	mov    %r12,%rsi
+  80c5a2:	48 bb 00 70 a4 00 00 	movabs $0xa47000,%rbx
+  80c5a9:	00 00 00 
+  80c5ac:	48 89 df             	mov    %rbx,%rdi
+  80c5af:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  80c5b6:	00 00 00 
+  80c5b9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80c5bb:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80c5c2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80c5c6:	bf 01 00 00 00       	mov    $0x1,%edi
+  80c5cb:	48 b8 e4 bd 80 00 00 	movabs $0x80bde4,%rax
+  80c5d2:	00 00 00 
+  80c5d5:	ff d0                	call   *%rax
+  80c5d7:	89 c3                	mov    %eax,%ebx
+  80c5d9:	85 c0                	test   %eax,%eax
+  80c5db:	78 1f                	js     80c5fc <open+0x9e>
+    return fd2num(fd);
+  80c5dd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80c5e1:	48 b8 e4 b1 80 00 00 	movabs $0x80b1e4,%rax
+  80c5e8:	00 00 00 
+  80c5eb:	ff d0                	call   *%rax
+  80c5ed:	89 c3                	mov    %eax,%ebx
+}
+  80c5ef:	89 d8                	mov    %ebx,%eax
+  80c5f1:	48 83 c4 18          	add    $0x18,%rsp
+  80c5f5:	5b                   	pop    %rbx
+  80c5f6:	41 5c                	pop    %r12
+  80c5f8:	41 5d                	pop    %r13
+  80c5fa:	5d                   	pop    %rbp
+  80c5fb:	c3                   	ret
+        fd_close(fd, 0);
+  80c5fc:	be 00 00 00 00       	mov    $0x0,%esi
+  80c601:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80c605:	48 b8 2d b3 80 00 00 	movabs $0x80b32d,%rax
+  80c60c:	00 00 00 
+  80c60f:	ff d0                	call   *%rax
+        return res;
+  80c611:	eb dc                	jmp    80c5ef <open+0x91>
+        return -E_BAD_PATH;
+  80c613:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80c618:	eb d5                	jmp    80c5ef <open+0x91>
+
+000000000080c61a <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80c61a:	55                   	push   %rbp
+  80c61b:	48 89 e5             	mov    %rsp,%rbp
+  80c61e:	41 57                	push   %r15
+  80c620:	41 56                	push   %r14
+  80c622:	41 55                	push   %r13
+  80c624:	41 54                	push   %r12
+  80c626:	53                   	push   %rbx
+  80c627:	48 83 ec 18          	sub    $0x18,%rsp
+  80c62b:	41 89 f6             	mov    %esi,%r14d
+  80c62e:	49 89 d7             	mov    %rdx,%r15
+  80c631:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80c634:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80c638:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80c63f:	00 00 00 
+  80c642:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80c644:	85 c0                	test   %eax,%eax
+  80c646:	0f 88 db 00 00 00    	js     80c727 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80c64c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80c650:	48 b8 a0 50 81 00 00 	movabs $0x8150a0,%rax
+  80c657:	00 00 00 
+  80c65a:	8b 00                	mov    (%rax),%eax
+  80c65c:	39 07                	cmp    %eax,(%rdi)
+  80c65e:	0f 85 db 00 00 00    	jne    80c73f <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80c664:	45 85 f6             	test   %r14d,%r14d
+  80c667:	0f 88 db 00 00 00    	js     80c748 <fmap+0x12e>
+  80c66d:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80c674:	0f 85 d7 00 00 00    	jne    80c751 <fmap+0x137>
+  80c67a:	4c 89 fb             	mov    %r15,%rbx
+  80c67d:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80c683:	0f 85 d1 00 00 00    	jne    80c75a <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80c689:	48 b8 aa bd 80 00 00 	movabs $0x80bdaa,%rax
+  80c690:	00 00 00 
+  80c693:	ff d0                	call   *%rax
+  80c695:	85 c0                	test   %eax,%eax
+  80c697:	0f 88 8e 00 00 00    	js     80c72b <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80c69d:	49 bc 00 70 a4 00 00 	movabs $0xa47000,%r12
+  80c6a4:	00 00 00 
+    while (i < n) {
+  80c6a7:	4d 85 ed             	test   %r13,%r13
+  80c6aa:	0f 84 8a 00 00 00    	je     80c73a <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80c6b0:	4c 89 ea             	mov    %r13,%rdx
+  80c6b3:	48 29 da             	sub    %rbx,%rdx
+  80c6b6:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80c6bd:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80c6c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80c6c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80c6cb:	8b 40 0c             	mov    0xc(%rax),%eax
+  80c6ce:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80c6d2:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  80c6d6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  80c6db:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80c6e0:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80c6e4:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80c6e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80c6ed:	4c 89 e6             	mov    %r12,%rsi
+  80c6f0:	bf 09 00 00 00       	mov    $0x9,%edi
+  80c6f5:	48 b8 38 bb 80 00 00 	movabs $0x80bb38,%rax
+  80c6fc:	00 00 00 
+  80c6ff:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80c701:	85 c0                	test   %eax,%eax
+  80c703:	78 2a                	js     80c72f <fmap+0x115>
+        i += res;
+  80c705:	48 98                	cltq
+  80c707:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80c70a:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  80c70e:	72 05                	jb     80c715 <fmap+0xfb>
+    while (i < n) {
+  80c710:	4c 39 eb             	cmp    %r13,%rbx
+  80c713:	72 9b                	jb     80c6b0 <fmap+0x96>
+    }
+    return i;
+  80c715:	48 89 d8             	mov    %rbx,%rax
+}
+  80c718:	48 83 c4 18          	add    $0x18,%rsp
+  80c71c:	5b                   	pop    %rbx
+  80c71d:	41 5c                	pop    %r12
+  80c71f:	41 5d                	pop    %r13
+  80c721:	41 5e                	pop    %r14
+  80c723:	41 5f                	pop    %r15
+  80c725:	5d                   	pop    %rbp
+  80c726:	c3                   	ret
+    if (res < 0) return res;
+  80c727:	48 98                	cltq
+  80c729:	eb ed                	jmp    80c718 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80c72b:	48 98                	cltq
+  80c72d:	eb e9                	jmp    80c718 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  80c72f:	48 98                	cltq
+  80c731:	48 85 db             	test   %rbx,%rbx
+  80c734:	48 0f 45 c3          	cmovne %rbx,%rax
+  80c738:	eb de                	jmp    80c718 <fmap+0xfe>
+    size_t i = 0;
+  80c73a:	4c 89 eb             	mov    %r13,%rbx
+  80c73d:	eb d6                	jmp    80c715 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80c73f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80c746:	eb d0                	jmp    80c718 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80c748:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80c74f:	eb c7                	jmp    80c718 <fmap+0xfe>
+  80c751:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80c758:	eb be                	jmp    80c718 <fmap+0xfe>
+  80c75a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80c761:	eb b5                	jmp    80c718 <fmap+0xfe>
+
+000000000080c763 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80c763:	55                   	push   %rbp
+  80c764:	48 89 e5             	mov    %rsp,%rbp
+  80c767:	41 56                	push   %r14
+  80c769:	41 55                	push   %r13
+  80c76b:	41 54                	push   %r12
+  80c76d:	53                   	push   %rbx
+  80c76e:	48 83 ec 10          	sub    $0x10,%rsp
+  80c772:	89 fb                	mov    %edi,%ebx
+  80c774:	41 89 f4             	mov    %esi,%r12d
+  80c777:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80c77a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80c77e:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80c785:	00 00 00 
+  80c788:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80c78a:	85 c0                	test   %eax,%eax
+  80c78c:	78 63                	js     80c7f1 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80c78e:	45 85 e4             	test   %r12d,%r12d
+  80c791:	0f 88 80 00 00 00    	js     80c817 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80c797:	45 89 e6             	mov    %r12d,%r14d
+  80c79a:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80c7a1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80c7a5:	48 b8 f6 b1 80 00 00 	movabs $0x80b1f6,%rax
+  80c7ac:	00 00 00 
+  80c7af:	ff d0                	call   *%rax
+  80c7b1:	48 89 c2             	mov    %rax,%rdx
+  80c7b4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80c7b9:	44 89 f6             	mov    %r14d,%esi
+  80c7bc:	89 df                	mov    %ebx,%edi
+  80c7be:	48 b8 1a c6 80 00 00 	movabs $0x80c61a,%rax
+  80c7c5:	00 00 00 
+  80c7c8:	ff d0                	call   *%rax
+  80c7ca:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80c7cd:	45 29 f4             	sub    %r14d,%r12d
+  80c7d0:	4d 63 f4             	movslq %r12d,%r14
+  80c7d3:	49 39 c6             	cmp    %rax,%r14
+  80c7d6:	7c 1d                	jl     80c7f5 <read_map+0x92>
+  80c7d8:	48 85 c0             	test   %rax,%rax
+  80c7db:	b8 00 00 00 00       	mov    $0x0,%eax
+  80c7e0:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80c7e4:	48 83 c4 10          	add    $0x10,%rsp
+  80c7e8:	5b                   	pop    %rbx
+  80c7e9:	41 5c                	pop    %r12
+  80c7eb:	41 5d                	pop    %r13
+  80c7ed:	41 5e                	pop    %r14
+  80c7ef:	5d                   	pop    %rbp
+  80c7f0:	c3                   	ret
+    if (res < 0) return res;
+  80c7f1:	48 98                	cltq
+  80c7f3:	eb ef                	jmp    80c7e4 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  80c7f5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80c7f9:	48 b8 f6 b1 80 00 00 	movabs $0x80b1f6,%rax
+  80c800:	00 00 00 
+  80c803:	ff d0                	call   *%rax
+  80c805:	4d 63 e4             	movslq %r12d,%r12
+  80c808:	4c 01 e0             	add    %r12,%rax
+  80c80b:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  80c80f:	48 89 d8             	mov    %rbx,%rax
+  80c812:	4c 29 f0             	sub    %r14,%rax
+  80c815:	eb cd                	jmp    80c7e4 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  80c817:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80c81e:	eb c4                	jmp    80c7e4 <read_map+0x81>
+
+000000000080c820 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  80c820:	55                   	push   %rbp
+  80c821:	48 89 e5             	mov    %rsp,%rbp
+  80c824:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80c828:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80c82c:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80c833:	00 00 00 
+  80c836:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80c838:	85 c0                	test   %eax,%eax
+  80c83a:	78 4a                	js     80c886 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80c83c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80c840:	48 b8 a0 50 81 00 00 	movabs $0x8150a0,%rax
+  80c847:	00 00 00 
+  80c84a:	8b 00                	mov    (%rax),%eax
+  80c84c:	39 07                	cmp    %eax,(%rdi)
+  80c84e:	75 38                	jne    80c888 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80c850:	48 b8 aa bd 80 00 00 	movabs $0x80bdaa,%rax
+  80c857:	00 00 00 
+  80c85a:	ff d0                	call   *%rax
+  80c85c:	85 c0                	test   %eax,%eax
+  80c85e:	78 26                	js     80c886 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80c860:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80c864:	8b 40 0c             	mov    0xc(%rax),%eax
+  80c867:	a3 00 70 a4 00 00 00 	movabs %eax,0xa47000
+  80c86e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80c870:	be 00 00 00 00       	mov    $0x0,%esi
+  80c875:	bf 06 00 00 00       	mov    $0x6,%edi
+  80c87a:	48 b8 e4 bd 80 00 00 	movabs $0x80bde4,%rax
+  80c881:	00 00 00 
+  80c884:	ff d0                	call   *%rax
+}
+  80c886:	c9                   	leave
+  80c887:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80c888:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80c88d:	eb f7                	jmp    80c886 <fsync+0x66>
+
+000000000080c88f <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80c88f:	55                   	push   %rbp
+  80c890:	48 89 e5             	mov    %rsp,%rbp
+  80c893:	41 57                	push   %r15
+  80c895:	41 56                	push   %r14
+  80c897:	41 55                	push   %r13
+  80c899:	41 54                	push   %r12
+  80c89b:	53                   	push   %rbx
+  80c89c:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80c8a0:	49 bc 20 80 a4 00 00 	movabs $0xa48020,%r12
+  80c8a7:	00 00 00 
+  80c8aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80c8af:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80c8b5:	49 bd 72 b2 80 00 00 	movabs $0x80b272,%r13
+  80c8bc:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80c8bf:	49 be a0 50 81 00 00 	movabs $0x8150a0,%r14
+  80c8c6:	00 00 00 
+  80c8c9:	eb 0c                	jmp    80c8d7 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80c8cb:	83 c3 01             	add    $0x1,%ebx
+  80c8ce:	49 83 c4 28          	add    $0x28,%r12
+  80c8d2:	83 fb 20             	cmp    $0x20,%ebx
+  80c8d5:	74 33                	je     80c90a <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80c8d7:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80c8dc:	74 ed                	je     80c8cb <flushall+0x3c>
+  80c8de:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80c8e2:	89 df                	mov    %ebx,%edi
+  80c8e4:	41 ff d5             	call   *%r13
+  80c8e7:	85 c0                	test   %eax,%eax
+  80c8e9:	78 e0                	js     80c8cb <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80c8eb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80c8ef:	41 8b 06             	mov    (%r14),%eax
+  80c8f2:	39 07                	cmp    %eax,(%rdi)
+  80c8f4:	75 d5                	jne    80c8cb <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  80c8f6:	48 b8 aa bd 80 00 00 	movabs $0x80bdaa,%rax
+  80c8fd:	00 00 00 
+  80c900:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80c902:	85 c0                	test   %eax,%eax
+  80c904:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80c908:	eb c1                	jmp    80c8cb <flushall+0x3c>
+    }
+    return res;
+}
+  80c90a:	44 89 f8             	mov    %r15d,%eax
+  80c90d:	48 83 c4 18          	add    $0x18,%rsp
+  80c911:	5b                   	pop    %rbx
+  80c912:	41 5c                	pop    %r12
+  80c914:	41 5d                	pop    %r13
+  80c916:	41 5e                	pop    %r14
+  80c918:	41 5f                	pop    %r15
+  80c91a:	5d                   	pop    %rbp
+  80c91b:	c3                   	ret
+
+000000000080c91c <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80c91c:	55                   	push   %rbp
+  80c91d:	48 89 e5             	mov    %rsp,%rbp
+  80c920:	53                   	push   %rbx
+  80c921:	48 83 ec 08          	sub    $0x8,%rsp
+  80c925:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80c928:	40 0f b6 c6          	movzbl %sil,%eax
+  80c92c:	a3 00 70 a4 00 00 00 	movabs %eax,0xa47000
+  80c933:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  80c935:	be 00 00 00 00       	mov    $0x0,%esi
+  80c93a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80c93f:	48 b8 e4 bd 80 00 00 	movabs $0x80bde4,%rax
+  80c946:	00 00 00 
+  80c949:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80c94b:	85 c0                	test   %eax,%eax
+  80c94d:	78 23                	js     80c972 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80c94f:	ba 58 06 00 00       	mov    $0x658,%edx
+  80c954:	48 be 00 70 a4 00 00 	movabs $0xa47000,%rsi
+  80c95b:	00 00 00 
+  80c95e:	48 89 df             	mov    %rbx,%rdi
+  80c961:	48 b8 a2 9e 80 00 00 	movabs $0x809ea2,%rax
+  80c968:	00 00 00 
+  80c96b:	ff d0                	call   *%rax
+    return 0;
+  80c96d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80c972:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80c976:	c9                   	leave
+  80c977:	c3                   	ret
+
+000000000080c978 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80c978:	55                   	push   %rbp
+  80c979:	48 89 e5             	mov    %rsp,%rbp
+  80c97c:	53                   	push   %rbx
+  80c97d:	48 83 ec 08          	sub    $0x8,%rsp
+  80c981:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  80c984:	48 b8 6f 9a 80 00 00 	movabs $0x809a6f,%rax
+  80c98b:	00 00 00 
+  80c98e:	ff d0                	call   *%rax
+  80c990:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80c996:	77 35                	ja     80c9cd <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80c998:	48 89 de             	mov    %rbx,%rsi
+  80c99b:	48 bf 00 70 a4 00 00 	movabs $0xa47000,%rdi
+  80c9a2:	00 00 00 
+  80c9a5:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  80c9ac:	00 00 00 
+  80c9af:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80c9b1:	be 00 00 00 00       	mov    $0x0,%esi
+  80c9b6:	bf 07 00 00 00       	mov    $0x7,%edi
+  80c9bb:	48 b8 e4 bd 80 00 00 	movabs $0x80bde4,%rax
+  80c9c2:	00 00 00 
+  80c9c5:	ff d0                	call   *%rax
+}
+  80c9c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80c9cb:	c9                   	leave
+  80c9cc:	c3                   	ret
+        return -E_BAD_PATH;
+  80c9cd:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80c9d2:	eb f3                	jmp    80c9c7 <remove+0x4f>
+
+000000000080c9d4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80c9d4:	55                   	push   %rbp
+  80c9d5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  80c9d8:	48 b8 8f c8 80 00 00 	movabs $0x80c88f,%rax
+  80c9df:	00 00 00 
+  80c9e2:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80c9e4:	be 00 00 00 00       	mov    $0x0,%esi
+  80c9e9:	bf 08 00 00 00       	mov    $0x8,%edi
+  80c9ee:	48 b8 e4 bd 80 00 00 	movabs $0x80bde4,%rax
+  80c9f5:	00 00 00 
+  80c9f8:	ff d0                	call   *%rax
+}
+  80c9fa:	5d                   	pop    %rbp
+  80c9fb:	c3                   	ret
+
+000000000080c9fc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80c9fc:	55                   	push   %rbp
+  80c9fd:	48 89 e5             	mov    %rsp,%rbp
+  80ca00:	41 54                	push   %r12
+  80ca02:	53                   	push   %rbx
+  80ca03:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80ca06:	48 b8 f6 b1 80 00 00 	movabs $0x80b1f6,%rax
+  80ca0d:	00 00 00 
+  80ca10:	ff d0                	call   *%rax
+  80ca12:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80ca15:	48 be 60 f2 80 00 00 	movabs $0x80f260,%rsi
+  80ca1c:	00 00 00 
+  80ca1f:	48 89 df             	mov    %rbx,%rdi
+  80ca22:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  80ca29:	00 00 00 
+  80ca2c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80ca2e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80ca33:	41 2b 04 24          	sub    (%r12),%eax
+  80ca37:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80ca3d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80ca44:	00 00 00 
+    stat->st_dev = &devpipe;
+  80ca47:	48 b8 e0 50 81 00 00 	movabs $0x8150e0,%rax
+  80ca4e:	00 00 00 
+  80ca51:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80ca58:	b8 00 00 00 00       	mov    $0x0,%eax
+  80ca5d:	5b                   	pop    %rbx
+  80ca5e:	41 5c                	pop    %r12
+  80ca60:	5d                   	pop    %rbp
+  80ca61:	c3                   	ret
+
+000000000080ca62 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80ca62:	55                   	push   %rbp
+  80ca63:	48 89 e5             	mov    %rsp,%rbp
+  80ca66:	41 54                	push   %r12
+  80ca68:	53                   	push   %rbx
+  80ca69:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80ca6c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80ca71:	48 89 fe             	mov    %rdi,%rsi
+  80ca74:	bf 00 00 00 00       	mov    $0x0,%edi
+  80ca79:	49 bc ec a3 80 00 00 	movabs $0x80a3ec,%r12
+  80ca80:	00 00 00 
+  80ca83:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80ca86:	48 89 df             	mov    %rbx,%rdi
+  80ca89:	48 b8 f6 b1 80 00 00 	movabs $0x80b1f6,%rax
+  80ca90:	00 00 00 
+  80ca93:	ff d0                	call   *%rax
+  80ca95:	48 89 c6             	mov    %rax,%rsi
+  80ca98:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80ca9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  80caa2:	41 ff d4             	call   *%r12
+}
+  80caa5:	5b                   	pop    %rbx
+  80caa6:	41 5c                	pop    %r12
+  80caa8:	5d                   	pop    %rbp
+  80caa9:	c3                   	ret
+
+000000000080caaa <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80caaa:	55                   	push   %rbp
+  80caab:	48 89 e5             	mov    %rsp,%rbp
+  80caae:	41 57                	push   %r15
+  80cab0:	41 56                	push   %r14
+  80cab2:	41 55                	push   %r13
+  80cab4:	41 54                	push   %r12
+  80cab6:	53                   	push   %rbx
+  80cab7:	48 83 ec 18          	sub    $0x18,%rsp
+  80cabb:	49 89 fc             	mov    %rdi,%r12
+  80cabe:	49 89 f5             	mov    %rsi,%r13
+  80cac1:	49 89 d7             	mov    %rdx,%r15
+  80cac4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80cac8:	48 b8 f6 b1 80 00 00 	movabs $0x80b1f6,%rax
+  80cacf:	00 00 00 
+  80cad2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80cad4:	4d 85 ff             	test   %r15,%r15
+  80cad7:	0f 84 af 00 00 00    	je     80cb8c <devpipe_write+0xe2>
+  80cadd:	48 89 c3             	mov    %rax,%rbx
+  80cae0:	4c 89 f8             	mov    %r15,%rax
+  80cae3:	4d 89 ef             	mov    %r13,%r15
+  80cae6:	4c 01 e8             	add    %r13,%rax
+  80cae9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80caed:	49 bd e1 a1 80 00 00 	movabs $0x80a1e1,%r13
+  80caf4:	00 00 00 
+            sys_yield();
+  80caf7:	49 be 7e a1 80 00 00 	movabs $0x80a17e,%r14
+  80cafe:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80cb01:	8b 73 04             	mov    0x4(%rbx),%esi
+  80cb04:	48 63 ce             	movslq %esi,%rcx
+  80cb07:	48 63 03             	movslq (%rbx),%rax
+  80cb0a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80cb10:	48 39 c1             	cmp    %rax,%rcx
+  80cb13:	72 2e                	jb     80cb43 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80cb15:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80cb1a:	48 89 da             	mov    %rbx,%rdx
+  80cb1d:	be 00 10 00 00       	mov    $0x1000,%esi
+  80cb22:	4c 89 e7             	mov    %r12,%rdi
+  80cb25:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80cb28:	85 c0                	test   %eax,%eax
+  80cb2a:	74 66                	je     80cb92 <devpipe_write+0xe8>
+            sys_yield();
+  80cb2c:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80cb2f:	8b 73 04             	mov    0x4(%rbx),%esi
+  80cb32:	48 63 ce             	movslq %esi,%rcx
+  80cb35:	48 63 03             	movslq (%rbx),%rax
+  80cb38:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80cb3e:	48 39 c1             	cmp    %rax,%rcx
+  80cb41:	73 d2                	jae    80cb15 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80cb43:	41 0f b6 3f          	movzbl (%r15),%edi
+  80cb47:	48 89 ca             	mov    %rcx,%rdx
+  80cb4a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80cb4e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80cb55:	08 10 20 
+  80cb58:	48 f7 e2             	mul    %rdx
+  80cb5b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80cb5f:	48 89 d0             	mov    %rdx,%rax
+  80cb62:	48 c1 e0 09          	shl    $0x9,%rax
+  80cb66:	48 29 d0             	sub    %rdx,%rax
+  80cb69:	48 c1 e0 03          	shl    $0x3,%rax
+  80cb6d:	48 29 c1             	sub    %rax,%rcx
+  80cb70:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80cb75:	83 c6 01             	add    $0x1,%esi
+  80cb78:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80cb7b:	49 83 c7 01          	add    $0x1,%r15
+  80cb7f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80cb83:	49 39 c7             	cmp    %rax,%r15
+  80cb86:	0f 85 75 ff ff ff    	jne    80cb01 <devpipe_write+0x57>
+    return n;
+  80cb8c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80cb90:	eb 05                	jmp    80cb97 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80cb92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80cb97:	48 83 c4 18          	add    $0x18,%rsp
+  80cb9b:	5b                   	pop    %rbx
+  80cb9c:	41 5c                	pop    %r12
+  80cb9e:	41 5d                	pop    %r13
+  80cba0:	41 5e                	pop    %r14
+  80cba2:	41 5f                	pop    %r15
+  80cba4:	5d                   	pop    %rbp
+  80cba5:	c3                   	ret
+
+000000000080cba6 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80cba6:	55                   	push   %rbp
+  80cba7:	48 89 e5             	mov    %rsp,%rbp
+  80cbaa:	41 57                	push   %r15
+  80cbac:	41 56                	push   %r14
+  80cbae:	41 55                	push   %r13
+  80cbb0:	41 54                	push   %r12
+  80cbb2:	53                   	push   %rbx
+  80cbb3:	48 83 ec 18          	sub    $0x18,%rsp
+  80cbb7:	49 89 fc             	mov    %rdi,%r12
+  80cbba:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80cbbe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80cbc2:	48 b8 f6 b1 80 00 00 	movabs $0x80b1f6,%rax
+  80cbc9:	00 00 00 
+  80cbcc:	ff d0                	call   *%rax
+  80cbce:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80cbd1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80cbd7:	49 bd e1 a1 80 00 00 	movabs $0x80a1e1,%r13
+  80cbde:	00 00 00 
+            sys_yield();
+  80cbe1:	49 be 7e a1 80 00 00 	movabs $0x80a17e,%r14
+  80cbe8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80cbeb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80cbf0:	74 7d                	je     80cc6f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80cbf2:	8b 03                	mov    (%rbx),%eax
+  80cbf4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80cbf7:	75 26                	jne    80cc1f <devpipe_read+0x79>
+            if (i > 0) return i;
+  80cbf9:	4d 85 ff             	test   %r15,%r15
+  80cbfc:	75 77                	jne    80cc75 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80cbfe:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80cc03:	48 89 da             	mov    %rbx,%rdx
+  80cc06:	be 00 10 00 00       	mov    $0x1000,%esi
+  80cc0b:	4c 89 e7             	mov    %r12,%rdi
+  80cc0e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80cc11:	85 c0                	test   %eax,%eax
+  80cc13:	74 72                	je     80cc87 <devpipe_read+0xe1>
+            sys_yield();
+  80cc15:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80cc18:	8b 03                	mov    (%rbx),%eax
+  80cc1a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80cc1d:	74 df                	je     80cbfe <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80cc1f:	48 63 c8             	movslq %eax,%rcx
+  80cc22:	48 89 ca             	mov    %rcx,%rdx
+  80cc25:	48 c1 ea 03          	shr    $0x3,%rdx
+  80cc29:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80cc30:	08 10 20 
+  80cc33:	48 89 d0             	mov    %rdx,%rax
+  80cc36:	48 f7 e6             	mul    %rsi
+  80cc39:	48 c1 ea 06          	shr    $0x6,%rdx
+  80cc3d:	48 89 d0             	mov    %rdx,%rax
+  80cc40:	48 c1 e0 09          	shl    $0x9,%rax
+  80cc44:	48 29 d0             	sub    %rdx,%rax
+  80cc47:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80cc4e:	00 
+  80cc4f:	48 89 c8             	mov    %rcx,%rax
+  80cc52:	48 29 d0             	sub    %rdx,%rax
+  80cc55:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80cc5a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80cc5e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80cc62:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80cc65:	49 83 c7 01          	add    $0x1,%r15
+  80cc69:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80cc6d:	75 83                	jne    80cbf2 <devpipe_read+0x4c>
+    return n;
+  80cc6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80cc73:	eb 03                	jmp    80cc78 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80cc75:	4c 89 f8             	mov    %r15,%rax
+}
+  80cc78:	48 83 c4 18          	add    $0x18,%rsp
+  80cc7c:	5b                   	pop    %rbx
+  80cc7d:	41 5c                	pop    %r12
+  80cc7f:	41 5d                	pop    %r13
+  80cc81:	41 5e                	pop    %r14
+  80cc83:	41 5f                	pop    %r15
+  80cc85:	5d                   	pop    %rbp
+  80cc86:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80cc87:	b8 00 00 00 00       	mov    $0x0,%eax
+  80cc8c:	eb ea                	jmp    80cc78 <devpipe_read+0xd2>
+
+000000000080cc8e <pipe>:
+pipe(int pfd[2]) {
+  80cc8e:	55                   	push   %rbp
+  80cc8f:	48 89 e5             	mov    %rsp,%rbp
+  80cc92:	41 55                	push   %r13
+  80cc94:	41 54                	push   %r12
+  80cc96:	53                   	push   %rbx
+  80cc97:	48 83 ec 18          	sub    $0x18,%rsp
+  80cc9b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80cc9e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80cca2:	48 b8 12 b2 80 00 00 	movabs $0x80b212,%rax
+  80cca9:	00 00 00 
+  80ccac:	ff d0                	call   *%rax
+  80ccae:	89 c3                	mov    %eax,%ebx
+  80ccb0:	85 c0                	test   %eax,%eax
+  80ccb2:	0f 88 a0 01 00 00    	js     80ce58 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80ccb8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80ccbd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80ccc2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80ccc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  80cccb:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  80ccd2:	00 00 00 
+  80ccd5:	ff d0                	call   *%rax
+  80ccd7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80ccd9:	85 c0                	test   %eax,%eax
+  80ccdb:	0f 88 77 01 00 00    	js     80ce58 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80cce1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80cce5:	48 b8 12 b2 80 00 00 	movabs $0x80b212,%rax
+  80ccec:	00 00 00 
+  80ccef:	ff d0                	call   *%rax
+  80ccf1:	89 c3                	mov    %eax,%ebx
+  80ccf3:	85 c0                	test   %eax,%eax
+  80ccf5:	0f 88 43 01 00 00    	js     80ce3e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80ccfb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80cd00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80cd05:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80cd09:	bf 00 00 00 00       	mov    $0x0,%edi
+  80cd0e:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  80cd15:	00 00 00 
+  80cd18:	ff d0                	call   *%rax
+  80cd1a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80cd1c:	85 c0                	test   %eax,%eax
+  80cd1e:	0f 88 1a 01 00 00    	js     80ce3e <pipe+0x1b0>
+    va = fd2data(fd0);
+  80cd24:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80cd28:	48 b8 f6 b1 80 00 00 	movabs $0x80b1f6,%rax
+  80cd2f:	00 00 00 
+  80cd32:	ff d0                	call   *%rax
+  80cd34:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80cd37:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80cd3c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80cd41:	48 89 c6             	mov    %rax,%rsi
+  80cd44:	bf 00 00 00 00       	mov    $0x0,%edi
+  80cd49:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  80cd50:	00 00 00 
+  80cd53:	ff d0                	call   *%rax
+  80cd55:	89 c3                	mov    %eax,%ebx
+  80cd57:	85 c0                	test   %eax,%eax
+  80cd59:	0f 88 c5 00 00 00    	js     80ce24 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80cd5f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80cd63:	48 b8 f6 b1 80 00 00 	movabs $0x80b1f6,%rax
+  80cd6a:	00 00 00 
+  80cd6d:	ff d0                	call   *%rax
+  80cd6f:	48 89 c1             	mov    %rax,%rcx
+  80cd72:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80cd78:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80cd7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  80cd83:	4c 89 ee             	mov    %r13,%rsi
+  80cd86:	bf 00 00 00 00       	mov    $0x0,%edi
+  80cd8b:	48 b8 74 a2 80 00 00 	movabs $0x80a274,%rax
+  80cd92:	00 00 00 
+  80cd95:	ff d0                	call   *%rax
+  80cd97:	89 c3                	mov    %eax,%ebx
+  80cd99:	85 c0                	test   %eax,%eax
+  80cd9b:	78 6e                	js     80ce0b <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80cd9d:	be 00 10 00 00       	mov    $0x1000,%esi
+  80cda2:	4c 89 ef             	mov    %r13,%rdi
+  80cda5:	48 b8 af a1 80 00 00 	movabs $0x80a1af,%rax
+  80cdac:	00 00 00 
+  80cdaf:	ff d0                	call   *%rax
+  80cdb1:	83 f8 02             	cmp    $0x2,%eax
+  80cdb4:	0f 85 ab 00 00 00    	jne    80ce65 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80cdba:	a1 e0 50 81 00 00 00 	movabs 0x8150e0,%eax
+  80cdc1:	00 00 
+  80cdc3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80cdc7:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80cdc9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80cdcd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80cdd4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80cdd8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80cdda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80cdde:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80cde5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80cde9:	48 bb e4 b1 80 00 00 	movabs $0x80b1e4,%rbx
+  80cdf0:	00 00 00 
+  80cdf3:	ff d3                	call   *%rbx
+  80cdf5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80cdf9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80cdfd:	ff d3                	call   *%rbx
+  80cdff:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80ce04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80ce09:	eb 4d                	jmp    80ce58 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80ce0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80ce10:	4c 89 ee             	mov    %r13,%rsi
+  80ce13:	bf 00 00 00 00       	mov    $0x0,%edi
+  80ce18:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  80ce1f:	00 00 00 
+  80ce22:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80ce24:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80ce29:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80ce2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  80ce32:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  80ce39:	00 00 00 
+  80ce3c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80ce3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80ce43:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80ce47:	bf 00 00 00 00       	mov    $0x0,%edi
+  80ce4c:	48 b8 ec a3 80 00 00 	movabs $0x80a3ec,%rax
+  80ce53:	00 00 00 
+  80ce56:	ff d0                	call   *%rax
+}
+  80ce58:	89 d8                	mov    %ebx,%eax
+  80ce5a:	48 83 c4 18          	add    $0x18,%rsp
+  80ce5e:	5b                   	pop    %rbx
+  80ce5f:	41 5c                	pop    %r12
+  80ce61:	41 5d                	pop    %r13
+  80ce63:	5d                   	pop    %rbp
+  80ce64:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80ce65:	48 b9 78 f2 80 00 00 	movabs $0x80f278,%rcx
+  80ce6c:	00 00 00 
+  80ce6f:	48 ba 44 e0 80 00 00 	movabs $0x80e044,%rdx
+  80ce76:	00 00 00 
+  80ce79:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80ce7e:	48 bf 67 f2 80 00 00 	movabs $0x80f267,%rdi
+  80ce85:	00 00 00 
+  80ce88:	b8 00 00 00 00       	mov    $0x0,%eax
+  80ce8d:	49 b8 e5 8f 80 00 00 	movabs $0x808fe5,%r8
+  80ce94:	00 00 00 
+  80ce97:	41 ff d0             	call   *%r8
+
+000000000080ce9a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80ce9a:	55                   	push   %rbp
+  80ce9b:	48 89 e5             	mov    %rsp,%rbp
+  80ce9e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80cea2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80cea6:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80cead:	00 00 00 
+  80ceb0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80ceb2:	85 c0                	test   %eax,%eax
+  80ceb4:	78 35                	js     80ceeb <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80ceb6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80ceba:	48 b8 f6 b1 80 00 00 	movabs $0x80b1f6,%rax
+  80cec1:	00 00 00 
+  80cec4:	ff d0                	call   *%rax
+  80cec6:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80cec9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80cece:	be 00 10 00 00       	mov    $0x1000,%esi
+  80ced3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80ced7:	48 b8 e1 a1 80 00 00 	movabs $0x80a1e1,%rax
+  80cede:	00 00 00 
+  80cee1:	ff d0                	call   *%rax
+  80cee3:	85 c0                	test   %eax,%eax
+  80cee5:	0f 94 c0             	sete   %al
+  80cee8:	0f b6 c0             	movzbl %al,%eax
+}
+  80ceeb:	c9                   	leave
+  80ceec:	c3                   	ret
+
+000000000080ceed <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80ceed:	48 89 f8             	mov    %rdi,%rax
+  80cef0:	48 c1 e8 27          	shr    $0x27,%rax
+  80cef4:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80cefb:	7f 00 00 
+  80cefe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80cf02:	f6 c2 01             	test   $0x1,%dl
+  80cf05:	74 6d                	je     80cf74 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80cf07:	48 89 f8             	mov    %rdi,%rax
+  80cf0a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80cf0e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80cf15:	7f 00 00 
+  80cf18:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80cf1c:	f6 c2 01             	test   $0x1,%dl
+  80cf1f:	74 62                	je     80cf83 <get_uvpt_entry+0x96>
+  80cf21:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80cf28:	7f 00 00 
+  80cf2b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80cf2f:	f6 c2 80             	test   $0x80,%dl
+  80cf32:	75 4f                	jne    80cf83 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80cf34:	48 89 f8             	mov    %rdi,%rax
+  80cf37:	48 c1 e8 15          	shr    $0x15,%rax
+  80cf3b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80cf42:	7f 00 00 
+  80cf45:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80cf49:	f6 c2 01             	test   $0x1,%dl
+  80cf4c:	74 44                	je     80cf92 <get_uvpt_entry+0xa5>
+  80cf4e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80cf55:	7f 00 00 
+  80cf58:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80cf5c:	f6 c2 80             	test   $0x80,%dl
+  80cf5f:	75 31                	jne    80cf92 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80cf61:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80cf65:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80cf6c:	7f 00 00 
+  80cf6f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80cf73:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80cf74:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80cf7b:	7f 00 00 
+  80cf7e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80cf82:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80cf83:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80cf8a:	7f 00 00 
+  80cf8d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80cf91:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80cf92:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80cf99:	7f 00 00 
+  80cf9c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80cfa0:	c3                   	ret
+
+000000000080cfa1 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80cfa1:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80cfa4:	48 89 f9             	mov    %rdi,%rcx
+  80cfa7:	48 c1 e9 27          	shr    $0x27,%rcx
+  80cfab:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80cfb2:	7f 00 00 
+  80cfb5:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80cfb9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80cfc0:	f6 c1 01             	test   $0x1,%cl
+  80cfc3:	0f 84 b2 00 00 00    	je     80d07b <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80cfc9:	48 89 f9             	mov    %rdi,%rcx
+  80cfcc:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80cfd0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80cfd7:	7f 00 00 
+  80cfda:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80cfde:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80cfe5:	40 f6 c6 01          	test   $0x1,%sil
+  80cfe9:	0f 84 8c 00 00 00    	je     80d07b <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  80cfef:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80cff6:	7f 00 00 
+  80cff9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80cffd:	a8 80                	test   $0x80,%al
+  80cfff:	75 7b                	jne    80d07c <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80d001:	48 89 f9             	mov    %rdi,%rcx
+  80d004:	48 c1 e9 15          	shr    $0x15,%rcx
+  80d008:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80d00f:	7f 00 00 
+  80d012:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80d016:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80d01d:	40 f6 c6 01          	test   $0x1,%sil
+  80d021:	74 58                	je     80d07b <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80d023:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80d02a:	7f 00 00 
+  80d02d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80d031:	a8 80                	test   $0x80,%al
+  80d033:	75 6c                	jne    80d0a1 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80d035:	48 89 f9             	mov    %rdi,%rcx
+  80d038:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80d03c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80d043:	7f 00 00 
+  80d046:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80d04a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80d051:	40 f6 c6 01          	test   $0x1,%sil
+  80d055:	74 24                	je     80d07b <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80d057:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80d05e:	7f 00 00 
+  80d061:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80d065:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80d06c:	ff ff 7f 
+  80d06f:	48 21 c8             	and    %rcx,%rax
+  80d072:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80d078:	48 09 d0             	or     %rdx,%rax
+}
+  80d07b:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80d07c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80d083:	7f 00 00 
+  80d086:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80d08a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80d091:	ff ff 7f 
+  80d094:	48 21 c8             	and    %rcx,%rax
+  80d097:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80d09d:	48 01 d0             	add    %rdx,%rax
+  80d0a0:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80d0a1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80d0a8:	7f 00 00 
+  80d0ab:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80d0af:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80d0b6:	ff ff 7f 
+  80d0b9:	48 21 c8             	and    %rcx,%rax
+  80d0bc:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80d0c2:	48 01 d0             	add    %rdx,%rax
+  80d0c5:	c3                   	ret
+
+000000000080d0c6 <get_prot>:
+
+int
+get_prot(void *va) {
+  80d0c6:	55                   	push   %rbp
+  80d0c7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80d0ca:	48 b8 ed ce 80 00 00 	movabs $0x80ceed,%rax
+  80d0d1:	00 00 00 
+  80d0d4:	ff d0                	call   *%rax
+  80d0d6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80d0d9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80d0de:	89 c1                	mov    %eax,%ecx
+  80d0e0:	83 c9 04             	or     $0x4,%ecx
+  80d0e3:	f6 c2 01             	test   $0x1,%dl
+  80d0e6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80d0e9:	89 c1                	mov    %eax,%ecx
+  80d0eb:	83 c9 02             	or     $0x2,%ecx
+  80d0ee:	f6 c2 02             	test   $0x2,%dl
+  80d0f1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80d0f4:	89 c1                	mov    %eax,%ecx
+  80d0f6:	83 c9 01             	or     $0x1,%ecx
+  80d0f9:	48 85 d2             	test   %rdx,%rdx
+  80d0fc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80d0ff:	89 c1                	mov    %eax,%ecx
+  80d101:	83 c9 40             	or     $0x40,%ecx
+  80d104:	f6 c6 04             	test   $0x4,%dh
+  80d107:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80d10a:	5d                   	pop    %rbp
+  80d10b:	c3                   	ret
+
+000000000080d10c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80d10c:	55                   	push   %rbp
+  80d10d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80d110:	48 b8 ed ce 80 00 00 	movabs $0x80ceed,%rax
+  80d117:	00 00 00 
+  80d11a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80d11c:	48 c1 e8 06          	shr    $0x6,%rax
+  80d120:	83 e0 01             	and    $0x1,%eax
+}
+  80d123:	5d                   	pop    %rbp
+  80d124:	c3                   	ret
+
+000000000080d125 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80d125:	55                   	push   %rbp
+  80d126:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80d129:	48 b8 ed ce 80 00 00 	movabs $0x80ceed,%rax
+  80d130:	00 00 00 
+  80d133:	ff d0                	call   *%rax
+  80d135:	83 e0 01             	and    $0x1,%eax
+}
+  80d138:	5d                   	pop    %rbp
+  80d139:	c3                   	ret
+
+000000000080d13a <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  80d13a:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80d141:	7f 00 00 
+  80d144:	a8 01                	test   $0x1,%al
+  80d146:	75 06                	jne    80d14e <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  80d148:	b8 00 00 00 00       	mov    $0x0,%eax
+  80d14d:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80d14e:	55                   	push   %rbp
+  80d14f:	48 89 e5             	mov    %rsp,%rbp
+  80d152:	41 57                	push   %r15
+  80d154:	41 56                	push   %r14
+  80d156:	41 55                	push   %r13
+  80d158:	41 54                	push   %r12
+  80d15a:	53                   	push   %rbx
+  80d15b:	48 83 ec 18          	sub    $0x18,%rsp
+  80d15f:	49 89 fe             	mov    %rdi,%r14
+  80d162:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80d165:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80d16c:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80d16d:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  80d174:	7f 00 00 
+  80d177:	e9 81 00 00 00       	jmp    80d1fd <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  80d17c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80d183:	49 39 dd             	cmp    %rbx,%r13
+  80d186:	74 2b                	je     80d1b3 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80d188:	48 89 d8             	mov    %rbx,%rax
+  80d18b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80d18f:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  80d193:	f6 c2 01             	test   $0x1,%dl
+  80d196:	74 e4                	je     80d17c <foreach_shared_region+0x42>
+  80d198:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  80d19c:	f6 c4 04             	test   $0x4,%ah
+  80d19f:	74 db                	je     80d17c <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  80d1a1:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80d1a8:	4c 89 fa             	mov    %r15,%rdx
+  80d1ab:	48 89 df             	mov    %rbx,%rdi
+  80d1ae:	41 ff d6             	call   *%r14
+  80d1b1:	eb c9                	jmp    80d17c <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80d1b3:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  80d1ba:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  80d1be:	74 22                	je     80d1e2 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  80d1c0:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  80d1c7:	48 89 d8             	mov    %rbx,%rax
+  80d1ca:	48 c1 e8 15          	shr    $0x15,%rax
+  80d1ce:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  80d1d5:	7f 00 00 
+  80d1d8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80d1dc:	a8 01                	test   $0x1,%al
+  80d1de:	74 d3                	je     80d1b3 <foreach_shared_region+0x79>
+  80d1e0:	eb a6                	jmp    80d188 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80d1e2:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  80d1e9:	40 
+  80d1ea:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80d1ee:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80d1f5:	00 00 00 
+  80d1f8:	48 39 c1             	cmp    %rax,%rcx
+  80d1fb:	74 31                	je     80d22e <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  80d1fd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80d201:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80d205:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  80d20c:	7f 00 00 
+  80d20f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80d213:	a8 01                	test   $0x1,%al
+  80d215:	74 cb                	je     80d1e2 <foreach_shared_region+0xa8>
+  80d217:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80d21b:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80d222:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  80d228:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80d22c:	eb 92                	jmp    80d1c0 <foreach_shared_region+0x86>
+}
+  80d22e:	b8 00 00 00 00       	mov    $0x0,%eax
+  80d233:	48 83 c4 18          	add    $0x18,%rsp
+  80d237:	5b                   	pop    %rbx
+  80d238:	41 5c                	pop    %r12
+  80d23a:	41 5d                	pop    %r13
+  80d23c:	41 5e                	pop    %r14
+  80d23e:	41 5f                	pop    %r15
+  80d240:	5d                   	pop    %rbp
+  80d241:	c3                   	ret
+
+000000000080d242 <vsys_gettime>:
+
+static inline uint64_t
+vsyscall(int num) {
+    if (num >= NVSYSCALLS)
+        return -E_INVAL;
+    return vsys[num];
+  80d242:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  80d249:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  80d24b:	c3                   	ret
+
+000000000080d24c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80d24c:	b8 00 00 00 00       	mov    $0x0,%eax
+  80d251:	c3                   	ret
+
+000000000080d252 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80d252:	55                   	push   %rbp
+  80d253:	48 89 e5             	mov    %rsp,%rbp
+  80d256:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80d259:	48 be 9c f2 80 00 00 	movabs $0x80f29c,%rsi
+  80d260:	00 00 00 
+  80d263:	48 b8 ad 9a 80 00 00 	movabs $0x809aad,%rax
+  80d26a:	00 00 00 
+  80d26d:	ff d0                	call   *%rax
+    return 0;
+}
+  80d26f:	b8 00 00 00 00       	mov    $0x0,%eax
+  80d274:	5d                   	pop    %rbp
+  80d275:	c3                   	ret
+
+000000000080d276 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80d276:	55                   	push   %rbp
+  80d277:	48 89 e5             	mov    %rsp,%rbp
+  80d27a:	41 57                	push   %r15
+  80d27c:	41 56                	push   %r14
+  80d27e:	41 55                	push   %r13
+  80d280:	41 54                	push   %r12
+  80d282:	53                   	push   %rbx
+  80d283:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80d28a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80d291:	48 85 d2             	test   %rdx,%rdx
+  80d294:	74 7a                	je     80d310 <devcons_write+0x9a>
+  80d296:	49 89 d6             	mov    %rdx,%r14
+  80d299:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80d29f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80d2a4:	49 bf 3b 9e 80 00 00 	movabs $0x809e3b,%r15
+  80d2ab:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80d2ae:	4c 89 f3             	mov    %r14,%rbx
+  80d2b1:	48 29 f3             	sub    %rsi,%rbx
+  80d2b4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80d2b9:	48 39 c3             	cmp    %rax,%rbx
+  80d2bc:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80d2c0:	4c 63 eb             	movslq %ebx,%r13
+  80d2c3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80d2ca:	48 01 c6             	add    %rax,%rsi
+  80d2cd:	4c 89 ea             	mov    %r13,%rdx
+  80d2d0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80d2d7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80d2da:	4c 89 ee             	mov    %r13,%rsi
+  80d2dd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80d2e4:	48 b8 84 a0 80 00 00 	movabs $0x80a084,%rax
+  80d2eb:	00 00 00 
+  80d2ee:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80d2f0:	41 01 dc             	add    %ebx,%r12d
+  80d2f3:	49 63 f4             	movslq %r12d,%rsi
+  80d2f6:	4c 39 f6             	cmp    %r14,%rsi
+  80d2f9:	72 b3                	jb     80d2ae <devcons_write+0x38>
+    return res;
+  80d2fb:	49 63 c4             	movslq %r12d,%rax
+}
+  80d2fe:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80d305:	5b                   	pop    %rbx
+  80d306:	41 5c                	pop    %r12
+  80d308:	41 5d                	pop    %r13
+  80d30a:	41 5e                	pop    %r14
+  80d30c:	41 5f                	pop    %r15
+  80d30e:	5d                   	pop    %rbp
+  80d30f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80d310:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80d316:	eb e3                	jmp    80d2fb <devcons_write+0x85>
+
+000000000080d318 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80d318:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80d31b:	ba 00 00 00 00       	mov    $0x0,%edx
+  80d320:	48 85 c0             	test   %rax,%rax
+  80d323:	74 55                	je     80d37a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80d325:	55                   	push   %rbp
+  80d326:	48 89 e5             	mov    %rsp,%rbp
+  80d329:	41 55                	push   %r13
+  80d32b:	41 54                	push   %r12
+  80d32d:	53                   	push   %rbx
+  80d32e:	48 83 ec 08          	sub    $0x8,%rsp
+  80d332:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80d335:	48 bb b1 a0 80 00 00 	movabs $0x80a0b1,%rbx
+  80d33c:	00 00 00 
+  80d33f:	49 bc 7e a1 80 00 00 	movabs $0x80a17e,%r12
+  80d346:	00 00 00 
+  80d349:	eb 03                	jmp    80d34e <devcons_read+0x36>
+  80d34b:	41 ff d4             	call   *%r12
+  80d34e:	ff d3                	call   *%rbx
+  80d350:	85 c0                	test   %eax,%eax
+  80d352:	74 f7                	je     80d34b <devcons_read+0x33>
+    if (c < 0) return c;
+  80d354:	48 63 d0             	movslq %eax,%rdx
+  80d357:	78 13                	js     80d36c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80d359:	ba 00 00 00 00       	mov    $0x0,%edx
+  80d35e:	83 f8 04             	cmp    $0x4,%eax
+  80d361:	74 09                	je     80d36c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80d363:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80d367:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80d36c:	48 89 d0             	mov    %rdx,%rax
+  80d36f:	48 83 c4 08          	add    $0x8,%rsp
+  80d373:	5b                   	pop    %rbx
+  80d374:	41 5c                	pop    %r12
+  80d376:	41 5d                	pop    %r13
+  80d378:	5d                   	pop    %rbp
+  80d379:	c3                   	ret
+  80d37a:	48 89 d0             	mov    %rdx,%rax
+  80d37d:	c3                   	ret
+
+000000000080d37e <cputchar>:
+cputchar(int ch) {
+  80d37e:	55                   	push   %rbp
+  80d37f:	48 89 e5             	mov    %rsp,%rbp
+  80d382:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80d386:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80d38a:	be 01 00 00 00       	mov    $0x1,%esi
+  80d38f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80d393:	48 b8 84 a0 80 00 00 	movabs $0x80a084,%rax
+  80d39a:	00 00 00 
+  80d39d:	ff d0                	call   *%rax
+}
+  80d39f:	c9                   	leave
+  80d3a0:	c3                   	ret
+
+000000000080d3a1 <getchar>:
+getchar(void) {
+  80d3a1:	55                   	push   %rbp
+  80d3a2:	48 89 e5             	mov    %rsp,%rbp
+  80d3a5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80d3a9:	ba 01 00 00 00       	mov    $0x1,%edx
+  80d3ae:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80d3b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  80d3b7:	48 b8 55 b5 80 00 00 	movabs $0x80b555,%rax
+  80d3be:	00 00 00 
+  80d3c1:	ff d0                	call   *%rax
+  80d3c3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80d3c5:	85 c0                	test   %eax,%eax
+  80d3c7:	78 06                	js     80d3cf <getchar+0x2e>
+  80d3c9:	74 08                	je     80d3d3 <getchar+0x32>
+  80d3cb:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80d3cf:	89 d0                	mov    %edx,%eax
+  80d3d1:	c9                   	leave
+  80d3d2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80d3d3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80d3d8:	eb f5                	jmp    80d3cf <getchar+0x2e>
+
+000000000080d3da <iscons>:
+iscons(int fdnum) {
+  80d3da:	55                   	push   %rbp
+  80d3db:	48 89 e5             	mov    %rsp,%rbp
+  80d3de:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80d3e2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80d3e6:	48 b8 72 b2 80 00 00 	movabs $0x80b272,%rax
+  80d3ed:	00 00 00 
+  80d3f0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80d3f2:	85 c0                	test   %eax,%eax
+  80d3f4:	78 18                	js     80d40e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80d3f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80d3fa:	48 b8 20 51 81 00 00 	movabs $0x815120,%rax
+  80d401:	00 00 00 
+  80d404:	8b 00                	mov    (%rax),%eax
+  80d406:	39 02                	cmp    %eax,(%rdx)
+  80d408:	0f 94 c0             	sete   %al
+  80d40b:	0f b6 c0             	movzbl %al,%eax
+}
+  80d40e:	c9                   	leave
+  80d40f:	c3                   	ret
+
+000000000080d410 <opencons>:
+opencons(void) {
+  80d410:	55                   	push   %rbp
+  80d411:	48 89 e5             	mov    %rsp,%rbp
+  80d414:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80d418:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80d41c:	48 b8 12 b2 80 00 00 	movabs $0x80b212,%rax
+  80d423:	00 00 00 
+  80d426:	ff d0                	call   *%rax
+  80d428:	85 c0                	test   %eax,%eax
+  80d42a:	78 49                	js     80d475 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80d42c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80d431:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80d436:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80d43a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80d43f:	48 b8 0d a2 80 00 00 	movabs $0x80a20d,%rax
+  80d446:	00 00 00 
+  80d449:	ff d0                	call   *%rax
+  80d44b:	85 c0                	test   %eax,%eax
+  80d44d:	78 26                	js     80d475 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80d44f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80d453:	a1 20 51 81 00 00 00 	movabs 0x815120,%eax
+  80d45a:	00 00 
+  80d45c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80d45e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80d462:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80d469:	48 b8 e4 b1 80 00 00 	movabs $0x80b1e4,%rax
+  80d470:	00 00 00 
+  80d473:	ff d0                	call   *%rax
+}
+  80d475:	c9                   	leave
+  80d476:	c3                   	ret
+  80d477:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  80d47e:	00 00 
+
+000000000080d480 <__popcountdi2>:
+  80d480:	f3 0f 1e fa          	endbr64
+  80d484:	48 ba 55 55 55 55 55 	movabs $0x5555555555555555,%rdx
+  80d48b:	55 55 55 
+  80d48e:	48 89 f8             	mov    %rdi,%rax
+  80d491:	48 d1 e8             	shr    %rax
+  80d494:	48 21 d0             	and    %rdx,%rax
+  80d497:	48 29 c7             	sub    %rax,%rdi
+  80d49a:	48 b8 33 33 33 33 33 	movabs $0x3333333333333333,%rax
+  80d4a1:	33 33 33 
+  80d4a4:	48 89 fa             	mov    %rdi,%rdx
+  80d4a7:	48 c1 ef 02          	shr    $0x2,%rdi
+  80d4ab:	48 21 c2             	and    %rax,%rdx
+  80d4ae:	48 21 c7             	and    %rax,%rdi
+  80d4b1:	48 01 fa             	add    %rdi,%rdx
+  80d4b4:	48 89 d0             	mov    %rdx,%rax
+  80d4b7:	48 c1 e8 04          	shr    $0x4,%rax
+  80d4bb:	48 01 d0             	add    %rdx,%rax
+  80d4be:	48 ba 0f 0f 0f 0f 0f 	movabs $0xf0f0f0f0f0f0f0f,%rdx
+  80d4c5:	0f 0f 0f 
+  80d4c8:	48 21 d0             	and    %rdx,%rax
+  80d4cb:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80d4d2:	01 01 01 
+  80d4d5:	48 0f af c2          	imul   %rdx,%rax
+  80d4d9:	48 c1 e8 38          	shr    $0x38,%rax
+  80d4dd:	c3                   	ret
+
+000000000080d4de <__text_end>:
+  80d4de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d4e5:	00 00 00 
+  80d4e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d4ef:	00 00 00 
+  80d4f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d4f9:	00 00 00 
+  80d4fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d503:	00 00 00 
+  80d506:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d50d:	00 00 00 
+  80d510:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d517:	00 00 00 
+  80d51a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d521:	00 00 00 
+  80d524:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d52b:	00 00 00 
+  80d52e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d535:	00 00 00 
+  80d538:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d53f:	00 00 00 
+  80d542:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d549:	00 00 00 
+  80d54c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d553:	00 00 00 
+  80d556:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d55d:	00 00 00 
+  80d560:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d567:	00 00 00 
+  80d56a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d571:	00 00 00 
+  80d574:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d57b:	00 00 00 
+  80d57e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d585:	00 00 00 
+  80d588:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d58f:	00 00 00 
+  80d592:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d599:	00 00 00 
+  80d59c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d5a3:	00 00 00 
+  80d5a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d5ad:	00 00 00 
+  80d5b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d5b7:	00 00 00 
+  80d5ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d5c1:	00 00 00 
+  80d5c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d5cb:	00 00 00 
+  80d5ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d5d5:	00 00 00 
+  80d5d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d5df:	00 00 00 
+  80d5e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d5e9:	00 00 00 
+  80d5ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d5f3:	00 00 00 
+  80d5f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d5fd:	00 00 00 
+  80d600:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d607:	00 00 00 
+  80d60a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d611:	00 00 00 
+  80d614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d61b:	00 00 00 
+  80d61e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d625:	00 00 00 
+  80d628:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d62f:	00 00 00 
+  80d632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d639:	00 00 00 
+  80d63c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d643:	00 00 00 
+  80d646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d64d:	00 00 00 
+  80d650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d657:	00 00 00 
+  80d65a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d661:	00 00 00 
+  80d664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d66b:	00 00 00 
+  80d66e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d675:	00 00 00 
+  80d678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d67f:	00 00 00 
+  80d682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d689:	00 00 00 
+  80d68c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d693:	00 00 00 
+  80d696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d69d:	00 00 00 
+  80d6a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d6a7:	00 00 00 
+  80d6aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d6b1:	00 00 00 
+  80d6b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d6bb:	00 00 00 
+  80d6be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d6c5:	00 00 00 
+  80d6c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d6cf:	00 00 00 
+  80d6d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d6d9:	00 00 00 
+  80d6dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d6e3:	00 00 00 
+  80d6e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d6ed:	00 00 00 
+  80d6f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d6f7:	00 00 00 
+  80d6fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d701:	00 00 00 
+  80d704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d70b:	00 00 00 
+  80d70e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d715:	00 00 00 
+  80d718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d71f:	00 00 00 
+  80d722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d729:	00 00 00 
+  80d72c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d733:	00 00 00 
+  80d736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d73d:	00 00 00 
+  80d740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d747:	00 00 00 
+  80d74a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d751:	00 00 00 
+  80d754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d75b:	00 00 00 
+  80d75e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d765:	00 00 00 
+  80d768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d76f:	00 00 00 
+  80d772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d779:	00 00 00 
+  80d77c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d783:	00 00 00 
+  80d786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d78d:	00 00 00 
+  80d790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d797:	00 00 00 
+  80d79a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d7a1:	00 00 00 
+  80d7a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d7ab:	00 00 00 
+  80d7ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d7b5:	00 00 00 
+  80d7b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d7bf:	00 00 00 
+  80d7c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d7c9:	00 00 00 
+  80d7cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d7d3:	00 00 00 
+  80d7d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d7dd:	00 00 00 
+  80d7e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d7e7:	00 00 00 
+  80d7ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d7f1:	00 00 00 
+  80d7f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d7fb:	00 00 00 
+  80d7fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d805:	00 00 00 
+  80d808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d80f:	00 00 00 
+  80d812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d819:	00 00 00 
+  80d81c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d823:	00 00 00 
+  80d826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d82d:	00 00 00 
+  80d830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d837:	00 00 00 
+  80d83a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d841:	00 00 00 
+  80d844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d84b:	00 00 00 
+  80d84e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d855:	00 00 00 
+  80d858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d85f:	00 00 00 
+  80d862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d869:	00 00 00 
+  80d86c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d873:	00 00 00 
+  80d876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d87d:	00 00 00 
+  80d880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d887:	00 00 00 
+  80d88a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d891:	00 00 00 
+  80d894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d89b:	00 00 00 
+  80d89e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d8a5:	00 00 00 
+  80d8a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d8af:	00 00 00 
+  80d8b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d8b9:	00 00 00 
+  80d8bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d8c3:	00 00 00 
+  80d8c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d8cd:	00 00 00 
+  80d8d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d8d7:	00 00 00 
+  80d8da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d8e1:	00 00 00 
+  80d8e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d8eb:	00 00 00 
+  80d8ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d8f5:	00 00 00 
+  80d8f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d8ff:	00 00 00 
+  80d902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d909:	00 00 00 
+  80d90c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d913:	00 00 00 
+  80d916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d91d:	00 00 00 
+  80d920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d927:	00 00 00 
+  80d92a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d931:	00 00 00 
+  80d934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d93b:	00 00 00 
+  80d93e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d945:	00 00 00 
+  80d948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d94f:	00 00 00 
+  80d952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d959:	00 00 00 
+  80d95c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d963:	00 00 00 
+  80d966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d96d:	00 00 00 
+  80d970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d977:	00 00 00 
+  80d97a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d981:	00 00 00 
+  80d984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d98b:	00 00 00 
+  80d98e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d995:	00 00 00 
+  80d998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d99f:	00 00 00 
+  80d9a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d9a9:	00 00 00 
+  80d9ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d9b3:	00 00 00 
+  80d9b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d9bd:	00 00 00 
+  80d9c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d9c7:	00 00 00 
+  80d9ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d9d1:	00 00 00 
+  80d9d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d9db:	00 00 00 
+  80d9de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d9e5:	00 00 00 
+  80d9e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d9ef:	00 00 00 
+  80d9f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80d9f9:	00 00 00 
+  80d9fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da03:	00 00 00 
+  80da06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da0d:	00 00 00 
+  80da10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da17:	00 00 00 
+  80da1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da21:	00 00 00 
+  80da24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da2b:	00 00 00 
+  80da2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da35:	00 00 00 
+  80da38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da3f:	00 00 00 
+  80da42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da49:	00 00 00 
+  80da4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da53:	00 00 00 
+  80da56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da5d:	00 00 00 
+  80da60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da67:	00 00 00 
+  80da6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da71:	00 00 00 
+  80da74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da7b:	00 00 00 
+  80da7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da85:	00 00 00 
+  80da88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da8f:	00 00 00 
+  80da92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80da99:	00 00 00 
+  80da9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80daa3:	00 00 00 
+  80daa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80daad:	00 00 00 
+  80dab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dab7:	00 00 00 
+  80daba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dac1:	00 00 00 
+  80dac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dacb:	00 00 00 
+  80dace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dad5:	00 00 00 
+  80dad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dadf:	00 00 00 
+  80dae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dae9:	00 00 00 
+  80daec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80daf3:	00 00 00 
+  80daf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dafd:	00 00 00 
+  80db00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db07:	00 00 00 
+  80db0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db11:	00 00 00 
+  80db14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db1b:	00 00 00 
+  80db1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db25:	00 00 00 
+  80db28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db2f:	00 00 00 
+  80db32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db39:	00 00 00 
+  80db3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db43:	00 00 00 
+  80db46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db4d:	00 00 00 
+  80db50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db57:	00 00 00 
+  80db5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db61:	00 00 00 
+  80db64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db6b:	00 00 00 
+  80db6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db75:	00 00 00 
+  80db78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db7f:	00 00 00 
+  80db82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db89:	00 00 00 
+  80db8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db93:	00 00 00 
+  80db96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80db9d:	00 00 00 
+  80dba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dba7:	00 00 00 
+  80dbaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dbb1:	00 00 00 
+  80dbb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dbbb:	00 00 00 
+  80dbbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dbc5:	00 00 00 
+  80dbc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dbcf:	00 00 00 
+  80dbd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dbd9:	00 00 00 
+  80dbdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dbe3:	00 00 00 
+  80dbe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dbed:	00 00 00 
+  80dbf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dbf7:	00 00 00 
+  80dbfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc01:	00 00 00 
+  80dc04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc0b:	00 00 00 
+  80dc0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc15:	00 00 00 
+  80dc18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc1f:	00 00 00 
+  80dc22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc29:	00 00 00 
+  80dc2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc33:	00 00 00 
+  80dc36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc3d:	00 00 00 
+  80dc40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc47:	00 00 00 
+  80dc4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc51:	00 00 00 
+  80dc54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc5b:	00 00 00 
+  80dc5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc65:	00 00 00 
+  80dc68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc6f:	00 00 00 
+  80dc72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc79:	00 00 00 
+  80dc7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc83:	00 00 00 
+  80dc86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc8d:	00 00 00 
+  80dc90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dc97:	00 00 00 
+  80dc9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dca1:	00 00 00 
+  80dca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dcab:	00 00 00 
+  80dcae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dcb5:	00 00 00 
+  80dcb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dcbf:	00 00 00 
+  80dcc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dcc9:	00 00 00 
+  80dccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dcd3:	00 00 00 
+  80dcd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dcdd:	00 00 00 
+  80dce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dce7:	00 00 00 
+  80dcea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dcf1:	00 00 00 
+  80dcf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dcfb:	00 00 00 
+  80dcfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd05:	00 00 00 
+  80dd08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd0f:	00 00 00 
+  80dd12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd19:	00 00 00 
+  80dd1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd23:	00 00 00 
+  80dd26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd2d:	00 00 00 
+  80dd30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd37:	00 00 00 
+  80dd3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd41:	00 00 00 
+  80dd44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd4b:	00 00 00 
+  80dd4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd55:	00 00 00 
+  80dd58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd5f:	00 00 00 
+  80dd62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd69:	00 00 00 
+  80dd6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd73:	00 00 00 
+  80dd76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd7d:	00 00 00 
+  80dd80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd87:	00 00 00 
+  80dd8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd91:	00 00 00 
+  80dd94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dd9b:	00 00 00 
+  80dd9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dda5:	00 00 00 
+  80dda8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ddaf:	00 00 00 
+  80ddb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ddb9:	00 00 00 
+  80ddbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ddc3:	00 00 00 
+  80ddc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ddcd:	00 00 00 
+  80ddd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ddd7:	00 00 00 
+  80ddda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dde1:	00 00 00 
+  80dde4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ddeb:	00 00 00 
+  80ddee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ddf5:	00 00 00 
+  80ddf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ddff:	00 00 00 
+  80de02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de09:	00 00 00 
+  80de0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de13:	00 00 00 
+  80de16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de1d:	00 00 00 
+  80de20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de27:	00 00 00 
+  80de2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de31:	00 00 00 
+  80de34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de3b:	00 00 00 
+  80de3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de45:	00 00 00 
+  80de48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de4f:	00 00 00 
+  80de52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de59:	00 00 00 
+  80de5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de63:	00 00 00 
+  80de66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de6d:	00 00 00 
+  80de70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de77:	00 00 00 
+  80de7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de81:	00 00 00 
+  80de84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de8b:	00 00 00 
+  80de8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de95:	00 00 00 
+  80de98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80de9f:	00 00 00 
+  80dea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dea9:	00 00 00 
+  80deac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80deb3:	00 00 00 
+  80deb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80debd:	00 00 00 
+  80dec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dec7:	00 00 00 
+  80deca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80ded1:	00 00 00 
+  80ded4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dedb:	00 00 00 
+  80dede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dee5:	00 00 00 
+  80dee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80deef:	00 00 00 
+  80def2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80def9:	00 00 00 
+  80defc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df03:	00 00 00 
+  80df06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df0d:	00 00 00 
+  80df10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df17:	00 00 00 
+  80df1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df21:	00 00 00 
+  80df24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df2b:	00 00 00 
+  80df2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df35:	00 00 00 
+  80df38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df3f:	00 00 00 
+  80df42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df49:	00 00 00 
+  80df4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df53:	00 00 00 
+  80df56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df5d:	00 00 00 
+  80df60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df67:	00 00 00 
+  80df6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df71:	00 00 00 
+  80df74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df7b:	00 00 00 
+  80df7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df85:	00 00 00 
+  80df88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df8f:	00 00 00 
+  80df92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80df99:	00 00 00 
+  80df9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dfa3:	00 00 00 
+  80dfa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dfad:	00 00 00 
+  80dfb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dfb7:	00 00 00 
+  80dfba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dfc1:	00 00 00 
+  80dfc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dfcb:	00 00 00 
+  80dfce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dfd5:	00 00 00 
+  80dfd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dfdf:	00 00 00 
+  80dfe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dfe9:	00 00 00 
+  80dfec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dff3:	00 00 00 
+  80dff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80dffd:	00 00 00 
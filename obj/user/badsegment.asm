@@ -0,0 +1,8095 @@
+
+obj/user/badsegment:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 09 00 00 00       	call   80002c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    /* Try to load the kernel's TSS selector into the DS register. */
+    asm volatile("movw $0x38,%ax; movw %ax,%ds");
+  800025:	66 b8 38 00          	mov    $0x38,%ax
+  800029:	8e d8                	mov    %eax,%ds
+}
+  80002b:	c3                   	ret
+
+000000000080002c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80002c:	55                   	push   %rbp
+  80002d:	48 89 e5             	mov    %rsp,%rbp
+  800030:	41 56                	push   %r14
+  800032:	41 55                	push   %r13
+  800034:	41 54                	push   %r12
+  800036:	53                   	push   %rbx
+  800037:	41 89 fd             	mov    %edi,%r13d
+  80003a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80003d:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800044:	00 00 00 
+  800047:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80004e:	00 00 00 
+  800051:	48 39 c2             	cmp    %rax,%rdx
+  800054:	73 17                	jae    80006d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800056:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800059:	49 89 c4             	mov    %rax,%r12
+  80005c:	48 83 c3 08          	add    $0x8,%rbx
+  800060:	b8 00 00 00 00       	mov    $0x0,%eax
+  800065:	ff 53 f8             	call   *-0x8(%rbx)
+  800068:	4c 39 e3             	cmp    %r12,%rbx
+  80006b:	72 ef                	jb     80005c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80006d:	48 b8 c1 01 80 00 00 	movabs $0x8001c1,%rax
+  800074:	00 00 00 
+  800077:	ff d0                	call   *%rax
+  800079:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007e:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800085:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80008c:	00 00 00 
+  80008f:	48 01 d0             	add    %rdx,%rax
+  800092:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800099:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80009c:	45 85 ed             	test   %r13d,%r13d
+  80009f:	7e 0d                	jle    8000ae <libmain+0x82>
+  8000a1:	49 8b 06             	mov    (%r14),%rax
+  8000a4:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000ab:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000ae:	4c 89 f6             	mov    %r14,%rsi
+  8000b1:	44 89 ef             	mov    %r13d,%edi
+  8000b4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000bb:	00 00 00 
+  8000be:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c0:	48 b8 d5 00 80 00 00 	movabs $0x8000d5,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+#endif
+}
+  8000cc:	5b                   	pop    %rbx
+  8000cd:	41 5c                	pop    %r12
+  8000cf:	41 5d                	pop    %r13
+  8000d1:	41 5e                	pop    %r14
+  8000d3:	5d                   	pop    %rbp
+  8000d4:	c3                   	ret
+
+00000000008000d5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d5:	55                   	push   %rbp
+  8000d6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000d9:	48 b8 bd 0e 80 00 00 	movabs $0x800ebd,%rax
+  8000e0:	00 00 00 
+  8000e3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ea:	48 b8 56 01 80 00 00 	movabs $0x800156,%rax
+  8000f1:	00 00 00 
+  8000f4:	ff d0                	call   *%rax
+}
+  8000f6:	5d                   	pop    %rbp
+  8000f7:	c3                   	ret
+
+00000000008000f8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f8:	55                   	push   %rbp
+  8000f9:	48 89 e5             	mov    %rsp,%rbp
+  8000fc:	53                   	push   %rbx
+  8000fd:	48 89 fa             	mov    %rdi,%rdx
+  800100:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800103:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800108:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80010d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800112:	be 00 00 00 00       	mov    $0x0,%esi
+  800117:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80011d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80011f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800123:	c9                   	leave
+  800124:	c3                   	ret
+
+0000000000800125 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800125:	55                   	push   %rbp
+  800126:	48 89 e5             	mov    %rsp,%rbp
+  800129:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80012a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80012f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800134:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80013e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800143:	be 00 00 00 00       	mov    $0x0,%esi
+  800148:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80014e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800150:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+0000000000800156 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800156:	55                   	push   %rbp
+  800157:	48 89 e5             	mov    %rsp,%rbp
+  80015a:	53                   	push   %rbx
+  80015b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80015f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800162:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800167:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80016c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800171:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800176:	be 00 00 00 00       	mov    $0x0,%esi
+  80017b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800181:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800183:	48 85 c0             	test   %rax,%rax
+  800186:	7f 06                	jg     80018e <sys_env_destroy+0x38>
+}
+  800188:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80018e:	49 89 c0             	mov    %rax,%r8
+  800191:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800196:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80019d:	00 00 00 
+  8001a0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001a5:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8001ac:	00 00 00 
+  8001af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b4:	49 b9 20 2f 80 00 00 	movabs $0x802f20,%r9
+  8001bb:	00 00 00 
+  8001be:	41 ff d1             	call   *%r9
+
+00000000008001c1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001c1:	55                   	push   %rbp
+  8001c2:	48 89 e5             	mov    %rsp,%rbp
+  8001c5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001df:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ea:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f0:	c9                   	leave
+  8001f1:	c3                   	ret
+
+00000000008001f2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8001f2:	55                   	push   %rbp
+  8001f3:	48 89 e5             	mov    %rsp,%rbp
+  8001f6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f7:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800201:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800206:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80020b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800210:	be 00 00 00 00       	mov    $0x0,%esi
+  800215:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80021b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80021d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800221:	c9                   	leave
+  800222:	c3                   	ret
+
+0000000000800223 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800223:	55                   	push   %rbp
+  800224:	48 89 e5             	mov    %rsp,%rbp
+  800227:	53                   	push   %rbx
+  800228:	48 89 fa             	mov    %rdi,%rdx
+  80022b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80022e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800233:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80023a:	00 00 00 
+  80023d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800242:	be 00 00 00 00       	mov    $0x0,%esi
+  800247:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80024d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80024f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800253:	c9                   	leave
+  800254:	c3                   	ret
+
+0000000000800255 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800255:	55                   	push   %rbp
+  800256:	48 89 e5             	mov    %rsp,%rbp
+  800259:	53                   	push   %rbx
+  80025a:	49 89 f8             	mov    %rdi,%r8
+  80025d:	48 89 d3             	mov    %rdx,%rbx
+  800260:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800263:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800268:	4c 89 c2             	mov    %r8,%rdx
+  80026b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80026e:	be 00 00 00 00       	mov    $0x0,%esi
+  800273:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800279:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80027b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027f:	c9                   	leave
+  800280:	c3                   	ret
+
+0000000000800281 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800281:	55                   	push   %rbp
+  800282:	48 89 e5             	mov    %rsp,%rbp
+  800285:	53                   	push   %rbx
+  800286:	48 83 ec 08          	sub    $0x8,%rsp
+  80028a:	89 f8                	mov    %edi,%eax
+  80028c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80028f:	48 63 f9             	movslq %ecx,%rdi
+  800292:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800295:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80029a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80029d:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002aa:	48 85 c0             	test   %rax,%rax
+  8002ad:	7f 06                	jg     8002b5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b3:	c9                   	leave
+  8002b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b5:	49 89 c0             	mov    %rax,%r8
+  8002b8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002bd:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8002c4:	00 00 00 
+  8002c7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002cc:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8002d3:	00 00 00 
+  8002d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002db:	49 b9 20 2f 80 00 00 	movabs $0x802f20,%r9
+  8002e2:	00 00 00 
+  8002e5:	41 ff d1             	call   *%r9
+
+00000000008002e8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e8:	55                   	push   %rbp
+  8002e9:	48 89 e5             	mov    %rsp,%rbp
+  8002ec:	53                   	push   %rbx
+  8002ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f1:	89 f8                	mov    %edi,%eax
+  8002f3:	49 89 f2             	mov    %rsi,%r10
+  8002f6:	48 89 cf             	mov    %rcx,%rdi
+  8002f9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002fc:	48 63 da             	movslq %edx,%rbx
+  8002ff:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800302:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800307:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80030a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80030d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80030f:	48 85 c0             	test   %rax,%rax
+  800312:	7f 06                	jg     80031a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800314:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800318:	c9                   	leave
+  800319:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031a:	49 89 c0             	mov    %rax,%r8
+  80031d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800322:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800329:	00 00 00 
+  80032c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800331:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800338:	00 00 00 
+  80033b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800340:	49 b9 20 2f 80 00 00 	movabs $0x802f20,%r9
+  800347:	00 00 00 
+  80034a:	41 ff d1             	call   *%r9
+
+000000000080034d <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80034d:	55                   	push   %rbp
+  80034e:	48 89 e5             	mov    %rsp,%rbp
+  800351:	53                   	push   %rbx
+  800352:	48 83 ec 08          	sub    $0x8,%rsp
+  800356:	49 89 f9             	mov    %rdi,%r9
+  800359:	89 f0                	mov    %esi,%eax
+  80035b:	48 89 d3             	mov    %rdx,%rbx
+  80035e:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  800361:	49 63 f0             	movslq %r8d,%rsi
+  800364:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800367:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80036c:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80036f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800375:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800377:	48 85 c0             	test   %rax,%rax
+  80037a:	7f 06                	jg     800382 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80037c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800380:	c9                   	leave
+  800381:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800382:	49 89 c0             	mov    %rax,%r8
+  800385:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80038a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800391:	00 00 00 
+  800394:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800399:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8003a0:	00 00 00 
+  8003a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a8:	49 b9 20 2f 80 00 00 	movabs $0x802f20,%r9
+  8003af:	00 00 00 
+  8003b2:	41 ff d1             	call   *%r9
+
+00000000008003b5 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003b5:	55                   	push   %rbp
+  8003b6:	48 89 e5             	mov    %rsp,%rbp
+  8003b9:	53                   	push   %rbx
+  8003ba:	89 f8                	mov    %edi,%eax
+  8003bc:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8003bf:	48 63 f9             	movslq %ecx,%rdi
+  8003c2:	48 63 da             	movslq %edx,%rbx
+  8003c5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003cd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003db:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8003dd:	89 c2                	mov    %eax,%edx
+  8003df:	48 85 c0             	test   %rax,%rax
+  8003e2:	78 0d                	js     8003f1 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8003e4:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8003e9:	4d 85 c9             	test   %r9,%r9
+  8003ec:	74 03                	je     8003f1 <sys_alloc_dma_region+0x3c>
+  8003ee:	49 89 01             	mov    %rax,(%r9)
+}
+  8003f1:	89 d0                	mov    %edx,%eax
+  8003f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003f7:	c9                   	leave
+  8003f8:	c3                   	ret
+
+00000000008003f9 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8003f9:	55                   	push   %rbp
+  8003fa:	48 89 e5             	mov    %rsp,%rbp
+  8003fd:	53                   	push   %rbx
+  8003fe:	48 83 ec 08          	sub    $0x8,%rsp
+  800402:	48 89 f1             	mov    %rsi,%rcx
+  800405:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800408:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80040b:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800410:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800415:	be 00 00 00 00       	mov    $0x0,%esi
+  80041a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800420:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800422:	48 85 c0             	test   %rax,%rax
+  800425:	7f 06                	jg     80042d <sys_set_cache_region+0x34>
+}
+  800427:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80042b:	c9                   	leave
+  80042c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80042d:	49 89 c0             	mov    %rax,%r8
+  800430:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800435:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80043c:	00 00 00 
+  80043f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800444:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80044b:	00 00 00 
+  80044e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800453:	49 b9 20 2f 80 00 00 	movabs $0x802f20,%r9
+  80045a:	00 00 00 
+  80045d:	41 ff d1             	call   *%r9
+
+0000000000800460 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800460:	55                   	push   %rbp
+  800461:	48 89 e5             	mov    %rsp,%rbp
+  800464:	53                   	push   %rbx
+  800465:	48 83 ec 08          	sub    $0x8,%rsp
+  800469:	48 89 f1             	mov    %rsi,%rcx
+  80046c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80046f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800472:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800477:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80047c:	be 00 00 00 00       	mov    $0x0,%esi
+  800481:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800487:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800489:	48 85 c0             	test   %rax,%rax
+  80048c:	7f 06                	jg     800494 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80048e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800492:	c9                   	leave
+  800493:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800494:	49 89 c0             	mov    %rax,%r8
+  800497:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80049c:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8004a3:	00 00 00 
+  8004a6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004ab:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8004b2:	00 00 00 
+  8004b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ba:	49 b9 20 2f 80 00 00 	movabs $0x802f20,%r9
+  8004c1:	00 00 00 
+  8004c4:	41 ff d1             	call   *%r9
+
+00000000008004c7 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004c7:	55                   	push   %rbp
+  8004c8:	48 89 e5             	mov    %rsp,%rbp
+  8004cb:	53                   	push   %rbx
+  8004cc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004d0:	48 63 ce             	movslq %esi,%rcx
+  8004d3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004f2:	48 85 c0             	test   %rax,%rax
+  8004f5:	7f 06                	jg     8004fd <sys_env_set_status+0x36>
+}
+  8004f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004fb:	c9                   	leave
+  8004fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004fd:	49 89 c0             	mov    %rax,%r8
+  800500:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800505:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80050c:	00 00 00 
+  80050f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800514:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80051b:	00 00 00 
+  80051e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800523:	49 b9 20 2f 80 00 00 	movabs $0x802f20,%r9
+  80052a:	00 00 00 
+  80052d:	41 ff d1             	call   *%r9
+
+0000000000800530 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800530:	55                   	push   %rbp
+  800531:	48 89 e5             	mov    %rsp,%rbp
+  800534:	53                   	push   %rbx
+  800535:	48 83 ec 08          	sub    $0x8,%rsp
+  800539:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80053c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80053f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800544:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800549:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80054e:	be 00 00 00 00       	mov    $0x0,%esi
+  800553:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800559:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80055b:	48 85 c0             	test   %rax,%rax
+  80055e:	7f 06                	jg     800566 <sys_env_set_trapframe+0x36>
+}
+  800560:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800564:	c9                   	leave
+  800565:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800566:	49 89 c0             	mov    %rax,%r8
+  800569:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80056e:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800575:	00 00 00 
+  800578:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80057d:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800584:	00 00 00 
+  800587:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058c:	49 b9 20 2f 80 00 00 	movabs $0x802f20,%r9
+  800593:	00 00 00 
+  800596:	41 ff d1             	call   *%r9
+
+0000000000800599 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800599:	55                   	push   %rbp
+  80059a:	48 89 e5             	mov    %rsp,%rbp
+  80059d:	53                   	push   %rbx
+  80059e:	48 83 ec 08          	sub    $0x8,%rsp
+  8005a2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005a5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005a8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8005bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005c4:	48 85 c0             	test   %rax,%rax
+  8005c7:	7f 06                	jg     8005cf <sys_env_set_pgfault_upcall+0x36>
+}
+  8005c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005cf:	49 89 c0             	mov    %rax,%r8
+  8005d2:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005d7:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8005de:	00 00 00 
+  8005e1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8005e6:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8005ed:	00 00 00 
+  8005f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f5:	49 b9 20 2f 80 00 00 	movabs $0x802f20,%r9
+  8005fc:	00 00 00 
+  8005ff:	41 ff d1             	call   *%r9
+
+0000000000800602 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800602:	55                   	push   %rbp
+  800603:	48 89 e5             	mov    %rsp,%rbp
+  800606:	53                   	push   %rbx
+  800607:	89 f8                	mov    %edi,%eax
+  800609:	49 89 f1             	mov    %rsi,%r9
+  80060c:	48 89 d3             	mov    %rdx,%rbx
+  80060f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800612:	49 63 f0             	movslq %r8d,%rsi
+  800615:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800618:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80061d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800620:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800626:	cd 30                	int    $0x30
+}
+  800628:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80062c:	c9                   	leave
+  80062d:	c3                   	ret
+
+000000000080062e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80062e:	55                   	push   %rbp
+  80062f:	48 89 e5             	mov    %rsp,%rbp
+  800632:	53                   	push   %rbx
+  800633:	48 83 ec 08          	sub    $0x8,%rsp
+  800637:	48 89 fa             	mov    %rdi,%rdx
+  80063a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80063d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800642:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800647:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80064c:	be 00 00 00 00       	mov    $0x0,%esi
+  800651:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800657:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800659:	48 85 c0             	test   %rax,%rax
+  80065c:	7f 06                	jg     800664 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80065e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800662:	c9                   	leave
+  800663:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800664:	49 89 c0             	mov    %rax,%r8
+  800667:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80066c:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800673:	00 00 00 
+  800676:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80067b:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800682:	00 00 00 
+  800685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068a:	49 b9 20 2f 80 00 00 	movabs $0x802f20,%r9
+  800691:	00 00 00 
+  800694:	41 ff d1             	call   *%r9
+
+0000000000800697 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  800697:	55                   	push   %rbp
+  800698:	48 89 e5             	mov    %rsp,%rbp
+  80069b:	53                   	push   %rbx
+  80069c:	48 89 fa             	mov    %rdi,%rdx
+  80069f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006a2:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006bc:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006c2:	c9                   	leave
+  8006c3:	c3                   	ret
+
+00000000008006c4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006c4:	55                   	push   %rbp
+  8006c5:	48 89 e5             	mov    %rsp,%rbp
+  8006c8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006c9:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8006e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006ed:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8006ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006f3:	c9                   	leave
+  8006f4:	c3                   	ret
+
+00000000008006f5 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8006f5:	48 85 ff             	test   %rdi,%rdi
+  8006f8:	0f 84 b6 01 00 00    	je     8008b4 <malloc+0x1bf>
+malloc(size_t size) {
+  8006fe:	55                   	push   %rbp
+  8006ff:	48 89 e5             	mov    %rsp,%rbp
+  800702:	41 56                	push   %r14
+  800704:	41 55                	push   %r13
+  800706:	41 54                	push   %r12
+  800708:	53                   	push   %rbx
+  800709:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80070c:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800713:	00 00 00 
+  800716:	4c 8b 20             	mov    (%rax),%r12
+  800719:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  800720:	0f 87 94 01 00 00    	ja     8008ba <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  800726:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80072d:	00 00 00 
+  800730:	48 85 c0             	test   %rax,%rax
+  800733:	74 6b                	je     8007a0 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  800735:	4d 85 e4             	test   %r12,%r12
+  800738:	74 66                	je     8007a0 <malloc+0xab>
+  80073a:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  800741:	00 00 00 
+  800744:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800749:	eb 0d                	jmp    800758 <malloc+0x63>
+  80074b:	48 83 c1 01          	add    $0x1,%rcx
+  80074f:	48 83 c2 18          	add    $0x18,%rdx
+  800753:	49 39 cc             	cmp    %rcx,%r12
+  800756:	74 48                	je     8007a0 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  800758:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80075d:	74 ec                	je     80074b <malloc+0x56>
+  80075f:	48 39 1a             	cmp    %rbx,(%rdx)
+  800762:	72 e7                	jb     80074b <malloc+0x56>
+                real_freep_size--;
+  800764:	48 83 e8 01          	sub    $0x1,%rax
+  800768:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80076f:	00 00 00 
+                freep[i].is_free = false;
+  800772:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800779:	00 00 00 
+  80077c:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  800780:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  800784:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  800788:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  80078f:	00 
+                freep[i].size = size;
+  800790:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  800794:	48 01 c8             	add    %rcx,%rax
+  800797:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80079b:	e9 0b 01 00 00       	jmp    8008ab <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8007a0:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8007a7:	00 00 00 
+  8007aa:	48 01 d8             	add    %rbx,%rax
+  8007ad:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007b3:	76 7c                	jbe    800831 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007b5:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8007bc:	00 00 00 
+  8007bf:	4c 8b 30             	mov    (%rax),%r14
+  8007c2:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8007c9:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8007cc:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8007d3:	00 00 00 
+  8007d6:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8007dd:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8007e4:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8007ea:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8007ee:	48 b8 c1 01 80 00 00 	movabs $0x8001c1,%rax
+  8007f5:	00 00 00 
+  8007f8:	ff d0                	call   *%rax
+  8007fa:	89 c7                	mov    %eax,%edi
+  8007fc:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  800803:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80080a:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  800811:	00 00 00 
+  800814:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  800818:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80081d:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  800824:	00 00 00 
+  800827:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  800829:	85 c0                	test   %eax,%eax
+  80082b:	0f 88 90 00 00 00    	js     8008c1 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  800831:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  800838:	00 00 00 
+  80083b:	48 8b 31             	mov    (%rcx),%rsi
+  80083e:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  800845:	00 00 00 
+  800848:	4c 8b 07             	mov    (%rdi),%r8
+  80084b:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80084f:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  800856:	00 00 00 
+  800859:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80085d:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  800861:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800868:	00 00 00 
+  80086b:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80086f:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  800872:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  800876:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80087d:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  80087e:	48 89 d8             	mov    %rbx,%rax
+  800881:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800886:	4c 01 c0             	add    %r8,%rax
+  800889:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  80088c:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  800893:	48 01 f3             	add    %rsi,%rbx
+  800896:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  800899:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  80089e:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008a5:	00 00 00 
+  8008a8:	48 89 d0             	mov    %rdx,%rax
+}
+  8008ab:	5b                   	pop    %rbx
+  8008ac:	41 5c                	pop    %r12
+  8008ae:	41 5d                	pop    %r13
+  8008b0:	41 5e                	pop    %r14
+  8008b2:	5d                   	pop    %rbp
+  8008b3:	c3                   	ret
+        return NULL;
+  8008b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008b9:	c3                   	ret
+        return NULL;
+  8008ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bf:	eb ea                	jmp    8008ab <malloc+0x1b6>
+            return NULL;
+  8008c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c6:	eb e3                	jmp    8008ab <malloc+0x1b6>
+
+00000000008008c8 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8008c8:	55                   	push   %rbp
+  8008c9:	48 89 e5             	mov    %rsp,%rbp
+  8008cc:	53                   	push   %rbx
+  8008cd:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8008d1:	48 89 fb             	mov    %rdi,%rbx
+  8008d4:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8008d8:	48 89 df             	mov    %rbx,%rdi
+  8008db:	48 b8 f5 06 80 00 00 	movabs $0x8006f5,%rax
+  8008e2:	00 00 00 
+  8008e5:	ff d0                	call   *%rax
+  8008e7:	48 89 c7             	mov    %rax,%rdi
+  8008ea:	48 89 da             	mov    %rbx,%rdx
+  8008ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8008f2:	48 b8 c8 3c 80 00 00 	movabs $0x803cc8,%rax
+  8008f9:	00 00 00 
+  8008fc:	ff d0                	call   *%rax
+}
+  8008fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800902:	c9                   	leave
+  800903:	c3                   	ret
+
+0000000000800904 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  800904:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  80090b:	00 00 00 
+  80090e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  800915:	00 00 00 
+  800918:	48 3b 02             	cmp    (%rdx),%rax
+  80091b:	74 4d                	je     80096a <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  80091d:	48 85 c0             	test   %rax,%rax
+  800920:	74 4d                	je     80096f <get_allocsize+0x6b>
+  800922:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  800929:	00 00 00 
+  80092c:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  800931:	48 3b 39             	cmp    (%rcx),%rdi
+  800934:	74 13                	je     800949 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  800936:	48 83 c2 01          	add    $0x1,%rdx
+  80093a:	48 83 c1 18          	add    $0x18,%rcx
+  80093e:	48 39 d0             	cmp    %rdx,%rax
+  800941:	75 ee                	jne    800931 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  800943:	b8 00 00 00 00       	mov    $0x0,%eax
+  800948:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  800949:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80094d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800952:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800959:	00 00 00 
+  80095c:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800962:	75 0b                	jne    80096f <get_allocsize+0x6b>
+  800964:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  800969:	c3                   	ret
+        return 0;
+  80096a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096f:	c3                   	ret
+
+0000000000800970 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  800970:	48 85 ff             	test   %rdi,%rdi
+  800973:	0f 84 01 01 00 00    	je     800a7a <free+0x10a>
+free(void *ptr) {
+  800979:	55                   	push   %rbp
+  80097a:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  80097d:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800984:	00 00 00 
+  800987:	48 8b 30             	mov    (%rax),%rsi
+  80098a:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800991:	00 00 00 
+  800994:	48 39 c6             	cmp    %rax,%rsi
+  800997:	74 50                	je     8009e9 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  800999:	48 85 f6             	test   %rsi,%rsi
+  80099c:	74 21                	je     8009bf <free+0x4f>
+  80099e:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009a5:	00 00 00 
+  8009a8:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009ad:	48 3b 39             	cmp    (%rcx),%rdi
+  8009b0:	74 61                	je     800a13 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009b2:	48 83 c2 01          	add    $0x1,%rdx
+  8009b6:	48 83 c1 18          	add    $0x18,%rcx
+  8009ba:	48 39 d6             	cmp    %rdx,%rsi
+  8009bd:	75 ee                	jne    8009ad <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8009bf:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  8009c6:	00 00 00 
+  8009c9:	be 12 01 00 00       	mov    $0x112,%esi
+  8009ce:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009d5:	00 00 00 
+  8009d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009dd:	48 b9 20 2f 80 00 00 	movabs $0x802f20,%rcx
+  8009e4:	00 00 00 
+  8009e7:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  8009e9:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  8009f0:	00 00 00 
+  8009f3:	be 06 01 00 00       	mov    $0x106,%esi
+  8009f8:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009ff:	00 00 00 
+  800a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a07:	48 b9 20 2f 80 00 00 	movabs $0x802f20,%rcx
+  800a0e:	00 00 00 
+  800a11:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a13:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a17:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a1e:	00 00 00 
+  800a21:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a27:	75 27                	jne    800a50 <free+0xe0>
+            freep[i].is_free = true;
+  800a29:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a2d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a34:	00 00 00 
+  800a37:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a3e:	00 00 
+            real_freep_size++;
+  800a40:	48 83 c0 01          	add    $0x1,%rax
+  800a44:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a4b:	00 00 00 
+}
+  800a4e:	5d                   	pop    %rbp
+  800a4f:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a50:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a57:	00 00 00 
+  800a5a:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800a5f:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a66:	00 00 00 
+  800a69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6e:	48 b9 20 2f 80 00 00 	movabs $0x802f20,%rcx
+  800a75:	00 00 00 
+  800a78:	ff d1                	call   *%rcx
+  800a7a:	c3                   	ret
+
+0000000000800a7b <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800a7b:	55                   	push   %rbp
+  800a7c:	48 89 e5             	mov    %rsp,%rbp
+  800a7f:	41 55                	push   %r13
+  800a81:	41 54                	push   %r12
+  800a83:	53                   	push   %rbx
+  800a84:	48 83 ec 08          	sub    $0x8,%rsp
+  800a88:	48 89 fb             	mov    %rdi,%rbx
+  800a8b:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800a8e:	48 b8 04 09 80 00 00 	movabs $0x800904,%rax
+  800a95:	00 00 00 
+  800a98:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800a9a:	49 39 c5             	cmp    %rax,%r13
+  800a9d:	73 0e                	jae    800aad <realloc+0x32>
+}
+  800a9f:	48 89 d8             	mov    %rbx,%rax
+  800aa2:	48 83 c4 08          	add    $0x8,%rsp
+  800aa6:	5b                   	pop    %rbx
+  800aa7:	41 5c                	pop    %r12
+  800aa9:	41 5d                	pop    %r13
+  800aab:	5d                   	pop    %rbp
+  800aac:	c3                   	ret
+  800aad:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800ab0:	4c 89 ef             	mov    %r13,%rdi
+  800ab3:	48 b8 f5 06 80 00 00 	movabs $0x8006f5,%rax
+  800aba:	00 00 00 
+  800abd:	ff d0                	call   *%rax
+  800abf:	48 89 c7             	mov    %rax,%rdi
+  800ac2:	4c 89 e2             	mov    %r12,%rdx
+  800ac5:	48 89 de             	mov    %rbx,%rsi
+  800ac8:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  800acf:	00 00 00 
+  800ad2:	ff d0                	call   *%rax
+  800ad4:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800ad7:	48 89 df             	mov    %rbx,%rdi
+  800ada:	48 b8 70 09 80 00 00 	movabs $0x800970,%rax
+  800ae1:	00 00 00 
+  800ae4:	ff d0                	call   *%rax
+    return newptr;
+  800ae6:	4c 89 e3             	mov    %r12,%rbx
+  800ae9:	eb b4                	jmp    800a9f <realloc+0x24>
+
+0000000000800aeb <strdup>:
+
+char*
+strdup (const char *src) {
+  800aeb:	55                   	push   %rbp
+  800aec:	48 89 e5             	mov    %rsp,%rbp
+  800aef:	41 54                	push   %r12
+  800af1:	53                   	push   %rbx
+  800af2:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800af5:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  800afc:	00 00 00 
+  800aff:	ff d0                	call   *%rax
+  800b01:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b05:	4c 89 e7             	mov    %r12,%rdi
+  800b08:	48 b8 f5 06 80 00 00 	movabs $0x8006f5,%rax
+  800b0f:	00 00 00 
+  800b12:	ff d0                	call   *%rax
+  800b14:	48 89 c7             	mov    %rax,%rdi
+  800b17:	4c 89 e2             	mov    %r12,%rdx
+  800b1a:	48 89 de             	mov    %rbx,%rsi
+  800b1d:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  800b24:	00 00 00 
+  800b27:	ff d0                	call   *%rax
+}
+  800b29:	5b                   	pop    %rbx
+  800b2a:	41 5c                	pop    %r12
+  800b2c:	5d                   	pop    %rbp
+  800b2d:	c3                   	ret
+
+0000000000800b2e <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b2e:	55                   	push   %rbp
+  800b2f:	48 89 e5             	mov    %rsp,%rbp
+  800b32:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b33:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b38:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b47:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b4c:	be 00 00 00 00       	mov    $0x0,%esi
+  800b51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b57:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b59:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b5d:	c9                   	leave
+  800b5e:	c3                   	ret
+
+0000000000800b5f <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800b5f:	55                   	push   %rbp
+  800b60:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800b63:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800b6a:	00 00 00 
+  800b6d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b71:	74 26                	je     800b99 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800b73:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b75:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b79:	89 c0                	mov    %eax,%eax
+  800b7b:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800b7e:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800b85:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800b8c:	00 00 00 
+  800b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b94:	48 f7 31             	divq   (%rcx)
+}
+  800b97:	5d                   	pop    %rbp
+  800b98:	c3                   	ret
+        freq = get_cpufreq();
+  800b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9e:	48 ba 2e 0b 80 00 00 	movabs $0x800b2e,%rdx
+  800ba5:	00 00 00 
+  800ba8:	ff d2                	call   *%rdx
+  800baa:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bb1:	00 00 00 
+  800bb4:	eb bd                	jmp    800b73 <get_ticks+0x14>
+
+0000000000800bb6 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bb6:	55                   	push   %rbp
+  800bb7:	48 89 e5             	mov    %rsp,%rbp
+  800bba:	53                   	push   %rbx
+  800bbb:	48 83 ec 08          	sub    $0x8,%rsp
+  800bbf:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800bc2:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bc9:	00 00 00 
+  800bcc:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800bd0:	74 50                	je     800c22 <sleep+0x6c>
+    asm volatile("rdtsc"
+  800bd2:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bd4:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bd8:	89 c0                	mov    %eax,%eax
+  800bda:	48 89 d6             	mov    %rdx,%rsi
+  800bdd:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800be0:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800be7:	00 00 00 
+  800bea:	48 0f af 18          	imul   (%rax),%rbx
+  800bee:	48 c1 eb 03          	shr    $0x3,%rbx
+  800bf2:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800bf9:	9b c4 20 
+  800bfc:	48 89 d8             	mov    %rbx,%rax
+  800bff:	48 f7 e2             	mul    %rdx
+  800c02:	48 89 d1             	mov    %rdx,%rcx
+  800c05:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c09:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c0b:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c0f:	89 c0                	mov    %eax,%eax
+  800c11:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c14:	48 29 f2             	sub    %rsi,%rdx
+  800c17:	48 39 ca             	cmp    %rcx,%rdx
+  800c1a:	72 ed                	jb     800c09 <sleep+0x53>
+}
+  800c1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c20:	c9                   	leave
+  800c21:	c3                   	ret
+        freq = get_cpufreq();
+  800c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c27:	48 ba 2e 0b 80 00 00 	movabs $0x800b2e,%rdx
+  800c2e:	00 00 00 
+  800c31:	ff d2                	call   *%rdx
+  800c33:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c3a:	00 00 00 
+  800c3d:	eb 93                	jmp    800bd2 <sleep+0x1c>
+
+0000000000800c3f <poll_kbd>:
+
+int poll_kbd() {
+  800c3f:	55                   	push   %rbp
+  800c40:	48 89 e5             	mov    %rsp,%rbp
+  800c43:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c44:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c5d:	be 00 00 00 00       	mov    $0x0,%esi
+  800c62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c68:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c6e:	c9                   	leave
+  800c6f:	c3                   	ret
+
+0000000000800c70 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800c70:	55                   	push   %rbp
+  800c71:	48 89 e5             	mov    %rsp,%rbp
+  800c74:	53                   	push   %rbx
+  800c75:	49 89 fa             	mov    %rdi,%r10
+  800c78:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800c7a:	44 89 c6             	mov    %r8d,%esi
+  800c7d:	89 cf                	mov    %ecx,%edi
+  800c7f:	89 d3                	mov    %edx,%ebx
+  800c81:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800c83:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c88:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c8b:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800c8f:	cd 30                	int    $0x30
+  800c91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c95:	c9                   	leave
+  800c96:	c3                   	ret
+
+0000000000800c97 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800c97:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800c9e:	ff ff ff 
+  800ca1:	48 01 f8             	add    %rdi,%rax
+  800ca4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800ca8:	c3                   	ret
+
+0000000000800ca9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800ca9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cb0:	ff ff ff 
+  800cb3:	48 01 f8             	add    %rdi,%rax
+  800cb6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800cba:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800cc0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800cc4:	c3                   	ret
+
+0000000000800cc5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800cc5:	55                   	push   %rbp
+  800cc6:	48 89 e5             	mov    %rsp,%rbp
+  800cc9:	41 57                	push   %r15
+  800ccb:	41 56                	push   %r14
+  800ccd:	41 55                	push   %r13
+  800ccf:	41 54                	push   %r12
+  800cd1:	53                   	push   %rbx
+  800cd2:	48 83 ec 08          	sub    $0x8,%rsp
+  800cd6:	49 89 ff             	mov    %rdi,%r15
+  800cd9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800cde:	49 bd 79 2b 80 00 00 	movabs $0x802b79,%r13
+  800ce5:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800ce8:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800cee:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800cf1:	48 89 df             	mov    %rbx,%rdi
+  800cf4:	41 ff d5             	call   *%r13
+  800cf7:	83 e0 04             	and    $0x4,%eax
+  800cfa:	74 17                	je     800d13 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800cfc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d03:	4c 39 f3             	cmp    %r14,%rbx
+  800d06:	75 e6                	jne    800cee <fd_alloc+0x29>
+  800d08:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d0e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d13:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d16:	48 83 c4 08          	add    $0x8,%rsp
+  800d1a:	5b                   	pop    %rbx
+  800d1b:	41 5c                	pop    %r12
+  800d1d:	41 5d                	pop    %r13
+  800d1f:	41 5e                	pop    %r14
+  800d21:	41 5f                	pop    %r15
+  800d23:	5d                   	pop    %rbp
+  800d24:	c3                   	ret
+
+0000000000800d25 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d25:	83 ff 1f             	cmp    $0x1f,%edi
+  800d28:	77 39                	ja     800d63 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d2a:	55                   	push   %rbp
+  800d2b:	48 89 e5             	mov    %rsp,%rbp
+  800d2e:	41 54                	push   %r12
+  800d30:	53                   	push   %rbx
+  800d31:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d34:	48 63 df             	movslq %edi,%rbx
+  800d37:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d3e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d42:	48 89 df             	mov    %rbx,%rdi
+  800d45:	48 b8 79 2b 80 00 00 	movabs $0x802b79,%rax
+  800d4c:	00 00 00 
+  800d4f:	ff d0                	call   *%rax
+  800d51:	a8 04                	test   $0x4,%al
+  800d53:	74 14                	je     800d69 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d55:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d5e:	5b                   	pop    %rbx
+  800d5f:	41 5c                	pop    %r12
+  800d61:	5d                   	pop    %rbp
+  800d62:	c3                   	ret
+        return -E_INVAL;
+  800d63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d68:	c3                   	ret
+        return -E_INVAL;
+  800d69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d6e:	eb ee                	jmp    800d5e <fd_lookup+0x39>
+
+0000000000800d70 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d70:	55                   	push   %rbp
+  800d71:	48 89 e5             	mov    %rsp,%rbp
+  800d74:	41 54                	push   %r12
+  800d76:	53                   	push   %rbx
+  800d77:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800d7a:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800d81:	00 00 00 
+  800d84:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800d8b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800d8e:	39 3b                	cmp    %edi,(%rbx)
+  800d90:	74 47                	je     800dd9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800d92:	48 83 c0 08          	add    $0x8,%rax
+  800d96:	48 8b 18             	mov    (%rax),%rbx
+  800d99:	48 85 db             	test   %rbx,%rbx
+  800d9c:	75 f0                	jne    800d8e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800d9e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800da5:	00 00 00 
+  800da8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800dae:	89 fa                	mov    %edi,%edx
+  800db0:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  800db7:	00 00 00 
+  800dba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbf:	48 b9 70 30 80 00 00 	movabs $0x803070,%rcx
+  800dc6:	00 00 00 
+  800dc9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800dcb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800dd0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800dd4:	5b                   	pop    %rbx
+  800dd5:	41 5c                	pop    %r12
+  800dd7:	5d                   	pop    %rbp
+  800dd8:	c3                   	ret
+            return 0;
+  800dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dde:	eb f0                	jmp    800dd0 <dev_lookup+0x60>
+
+0000000000800de0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800de0:	55                   	push   %rbp
+  800de1:	48 89 e5             	mov    %rsp,%rbp
+  800de4:	41 55                	push   %r13
+  800de6:	41 54                	push   %r12
+  800de8:	53                   	push   %rbx
+  800de9:	48 83 ec 18          	sub    $0x18,%rsp
+  800ded:	48 89 fb             	mov    %rdi,%rbx
+  800df0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800df3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800dfa:	ff ff ff 
+  800dfd:	48 01 df             	add    %rbx,%rdi
+  800e00:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800e04:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e08:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  800e0f:	00 00 00 
+  800e12:	ff d0                	call   *%rax
+  800e14:	41 89 c5             	mov    %eax,%r13d
+  800e17:	85 c0                	test   %eax,%eax
+  800e19:	78 06                	js     800e21 <fd_close+0x41>
+  800e1b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e1f:	74 1a                	je     800e3b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e21:	45 84 e4             	test   %r12b,%r12b
+  800e24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e29:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e2d:	44 89 e8             	mov    %r13d,%eax
+  800e30:	48 83 c4 18          	add    $0x18,%rsp
+  800e34:	5b                   	pop    %rbx
+  800e35:	41 5c                	pop    %r12
+  800e37:	41 5d                	pop    %r13
+  800e39:	5d                   	pop    %rbp
+  800e3a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e3b:	8b 3b                	mov    (%rbx),%edi
+  800e3d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e41:	48 b8 70 0d 80 00 00 	movabs $0x800d70,%rax
+  800e48:	00 00 00 
+  800e4b:	ff d0                	call   *%rax
+  800e4d:	41 89 c5             	mov    %eax,%r13d
+  800e50:	85 c0                	test   %eax,%eax
+  800e52:	78 1b                	js     800e6f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e58:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800e5c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e62:	48 85 c0             	test   %rax,%rax
+  800e65:	74 08                	je     800e6f <fd_close+0x8f>
+  800e67:	48 89 df             	mov    %rbx,%rdi
+  800e6a:	ff d0                	call   *%rax
+  800e6c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800e6f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e74:	48 89 de             	mov    %rbx,%rsi
+  800e77:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e7c:	48 b8 60 04 80 00 00 	movabs $0x800460,%rax
+  800e83:	00 00 00 
+  800e86:	ff d0                	call   *%rax
+    return res;
+  800e88:	eb a3                	jmp    800e2d <fd_close+0x4d>
+
+0000000000800e8a <close>:
+
+int
+close(int fdnum) {
+  800e8a:	55                   	push   %rbp
+  800e8b:	48 89 e5             	mov    %rsp,%rbp
+  800e8e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800e92:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e96:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  800e9d:	00 00 00 
+  800ea0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800ea2:	85 c0                	test   %eax,%eax
+  800ea4:	78 15                	js     800ebb <close+0x31>
+
+    return fd_close(fd, 1);
+  800ea6:	be 01 00 00 00       	mov    $0x1,%esi
+  800eab:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800eaf:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  800eb6:	00 00 00 
+  800eb9:	ff d0                	call   *%rax
+}
+  800ebb:	c9                   	leave
+  800ebc:	c3                   	ret
+
+0000000000800ebd <close_all>:
+
+void
+close_all(void) {
+  800ebd:	55                   	push   %rbp
+  800ebe:	48 89 e5             	mov    %rsp,%rbp
+  800ec1:	41 54                	push   %r12
+  800ec3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800ec4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec9:	49 bc 8a 0e 80 00 00 	movabs $0x800e8a,%r12
+  800ed0:	00 00 00 
+  800ed3:	89 df                	mov    %ebx,%edi
+  800ed5:	41 ff d4             	call   *%r12
+  800ed8:	83 c3 01             	add    $0x1,%ebx
+  800edb:	83 fb 20             	cmp    $0x20,%ebx
+  800ede:	75 f3                	jne    800ed3 <close_all+0x16>
+}
+  800ee0:	5b                   	pop    %rbx
+  800ee1:	41 5c                	pop    %r12
+  800ee3:	5d                   	pop    %rbp
+  800ee4:	c3                   	ret
+
+0000000000800ee5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800ee5:	55                   	push   %rbp
+  800ee6:	48 89 e5             	mov    %rsp,%rbp
+  800ee9:	41 57                	push   %r15
+  800eeb:	41 56                	push   %r14
+  800eed:	41 55                	push   %r13
+  800eef:	41 54                	push   %r12
+  800ef1:	53                   	push   %rbx
+  800ef2:	48 83 ec 18          	sub    $0x18,%rsp
+  800ef6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800ef9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800efd:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  800f04:	00 00 00 
+  800f07:	ff d0                	call   *%rax
+  800f09:	89 c3                	mov    %eax,%ebx
+  800f0b:	85 c0                	test   %eax,%eax
+  800f0d:	0f 88 b8 00 00 00    	js     800fcb <dup+0xe6>
+    close(newfdnum);
+  800f13:	44 89 e7             	mov    %r12d,%edi
+  800f16:	48 b8 8a 0e 80 00 00 	movabs $0x800e8a,%rax
+  800f1d:	00 00 00 
+  800f20:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f22:	4d 63 ec             	movslq %r12d,%r13
+  800f25:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f2c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f30:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f34:	4c 89 ff             	mov    %r15,%rdi
+  800f37:	49 be a9 0c 80 00 00 	movabs $0x800ca9,%r14
+  800f3e:	00 00 00 
+  800f41:	41 ff d6             	call   *%r14
+  800f44:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f47:	4c 89 ef             	mov    %r13,%rdi
+  800f4a:	41 ff d6             	call   *%r14
+  800f4d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f50:	48 89 df             	mov    %rbx,%rdi
+  800f53:	48 b8 79 2b 80 00 00 	movabs $0x802b79,%rax
+  800f5a:	00 00 00 
+  800f5d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800f5f:	a8 04                	test   $0x4,%al
+  800f61:	74 2b                	je     800f8e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800f63:	41 89 c1             	mov    %eax,%r9d
+  800f66:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f6c:	4c 89 f1             	mov    %r14,%rcx
+  800f6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f74:	48 89 de             	mov    %rbx,%rsi
+  800f77:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f7c:	48 b8 e8 02 80 00 00 	movabs $0x8002e8,%rax
+  800f83:	00 00 00 
+  800f86:	ff d0                	call   *%rax
+  800f88:	89 c3                	mov    %eax,%ebx
+  800f8a:	85 c0                	test   %eax,%eax
+  800f8c:	78 4e                	js     800fdc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800f8e:	4c 89 ff             	mov    %r15,%rdi
+  800f91:	48 b8 79 2b 80 00 00 	movabs $0x802b79,%rax
+  800f98:	00 00 00 
+  800f9b:	ff d0                	call   *%rax
+  800f9d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800fa0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fa6:	4c 89 e9             	mov    %r13,%rcx
+  800fa9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fae:	4c 89 fe             	mov    %r15,%rsi
+  800fb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fb6:	48 b8 e8 02 80 00 00 	movabs $0x8002e8,%rax
+  800fbd:	00 00 00 
+  800fc0:	ff d0                	call   *%rax
+  800fc2:	89 c3                	mov    %eax,%ebx
+  800fc4:	85 c0                	test   %eax,%eax
+  800fc6:	78 14                	js     800fdc <dup+0xf7>
+
+    return newfdnum;
+  800fc8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800fcb:	89 d8                	mov    %ebx,%eax
+  800fcd:	48 83 c4 18          	add    $0x18,%rsp
+  800fd1:	5b                   	pop    %rbx
+  800fd2:	41 5c                	pop    %r12
+  800fd4:	41 5d                	pop    %r13
+  800fd6:	41 5e                	pop    %r14
+  800fd8:	41 5f                	pop    %r15
+  800fda:	5d                   	pop    %rbp
+  800fdb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800fdc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800fe1:	4c 89 ee             	mov    %r13,%rsi
+  800fe4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe9:	49 bc 60 04 80 00 00 	movabs $0x800460,%r12
+  800ff0:	00 00 00 
+  800ff3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800ff6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ffb:	4c 89 f6             	mov    %r14,%rsi
+  800ffe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801003:	41 ff d4             	call   *%r12
+    return res;
+  801006:	eb c3                	jmp    800fcb <dup+0xe6>
+
+0000000000801008 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801008:	55                   	push   %rbp
+  801009:	48 89 e5             	mov    %rsp,%rbp
+  80100c:	41 56                	push   %r14
+  80100e:	41 55                	push   %r13
+  801010:	41 54                	push   %r12
+  801012:	53                   	push   %rbx
+  801013:	48 83 ec 10          	sub    $0x10,%rsp
+  801017:	89 fb                	mov    %edi,%ebx
+  801019:	49 89 f4             	mov    %rsi,%r12
+  80101c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80101f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801023:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  80102a:	00 00 00 
+  80102d:	ff d0                	call   *%rax
+  80102f:	85 c0                	test   %eax,%eax
+  801031:	78 4c                	js     80107f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801033:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801037:	41 8b 3e             	mov    (%r14),%edi
+  80103a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80103e:	48 b8 70 0d 80 00 00 	movabs $0x800d70,%rax
+  801045:	00 00 00 
+  801048:	ff d0                	call   *%rax
+  80104a:	85 c0                	test   %eax,%eax
+  80104c:	78 35                	js     801083 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80104e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801052:	83 e0 03             	and    $0x3,%eax
+  801055:	83 f8 01             	cmp    $0x1,%eax
+  801058:	74 2d                	je     801087 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80105a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80105e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801062:	48 85 c0             	test   %rax,%rax
+  801065:	74 56                	je     8010bd <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801067:	4c 89 ea             	mov    %r13,%rdx
+  80106a:	4c 89 e6             	mov    %r12,%rsi
+  80106d:	4c 89 f7             	mov    %r14,%rdi
+  801070:	ff d0                	call   *%rax
+}
+  801072:	48 83 c4 10          	add    $0x10,%rsp
+  801076:	5b                   	pop    %rbx
+  801077:	41 5c                	pop    %r12
+  801079:	41 5d                	pop    %r13
+  80107b:	41 5e                	pop    %r14
+  80107d:	5d                   	pop    %rbp
+  80107e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80107f:	48 98                	cltq
+  801081:	eb ef                	jmp    801072 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801083:	48 98                	cltq
+  801085:	eb eb                	jmp    801072 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801087:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80108e:	00 00 00 
+  801091:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801097:	89 da                	mov    %ebx,%edx
+  801099:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  8010a0:	00 00 00 
+  8010a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a8:	48 b9 70 30 80 00 00 	movabs $0x803070,%rcx
+  8010af:	00 00 00 
+  8010b2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8010bb:	eb b5                	jmp    801072 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010bd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8010c4:	eb ac                	jmp    801072 <read+0x6a>
+
+00000000008010c6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8010c6:	55                   	push   %rbp
+  8010c7:	48 89 e5             	mov    %rsp,%rbp
+  8010ca:	41 57                	push   %r15
+  8010cc:	41 56                	push   %r14
+  8010ce:	41 55                	push   %r13
+  8010d0:	41 54                	push   %r12
+  8010d2:	53                   	push   %rbx
+  8010d3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8010d7:	48 85 d2             	test   %rdx,%rdx
+  8010da:	74 54                	je     801130 <readn+0x6a>
+  8010dc:	41 89 fd             	mov    %edi,%r13d
+  8010df:	49 89 f6             	mov    %rsi,%r14
+  8010e2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8010e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8010ea:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8010ef:	49 bf 08 10 80 00 00 	movabs $0x801008,%r15
+  8010f6:	00 00 00 
+  8010f9:	4c 89 e2             	mov    %r12,%rdx
+  8010fc:	48 29 f2             	sub    %rsi,%rdx
+  8010ff:	4c 01 f6             	add    %r14,%rsi
+  801102:	44 89 ef             	mov    %r13d,%edi
+  801105:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801108:	85 c0                	test   %eax,%eax
+  80110a:	78 20                	js     80112c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80110c:	01 c3                	add    %eax,%ebx
+  80110e:	85 c0                	test   %eax,%eax
+  801110:	74 08                	je     80111a <readn+0x54>
+  801112:	48 63 f3             	movslq %ebx,%rsi
+  801115:	4c 39 e6             	cmp    %r12,%rsi
+  801118:	72 df                	jb     8010f9 <readn+0x33>
+    }
+    return res;
+  80111a:	48 63 c3             	movslq %ebx,%rax
+}
+  80111d:	48 83 c4 08          	add    $0x8,%rsp
+  801121:	5b                   	pop    %rbx
+  801122:	41 5c                	pop    %r12
+  801124:	41 5d                	pop    %r13
+  801126:	41 5e                	pop    %r14
+  801128:	41 5f                	pop    %r15
+  80112a:	5d                   	pop    %rbp
+  80112b:	c3                   	ret
+        if (inc < 0) return inc;
+  80112c:	48 98                	cltq
+  80112e:	eb ed                	jmp    80111d <readn+0x57>
+    int inc = 1, res = 0;
+  801130:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801135:	eb e3                	jmp    80111a <readn+0x54>
+
+0000000000801137 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801137:	55                   	push   %rbp
+  801138:	48 89 e5             	mov    %rsp,%rbp
+  80113b:	41 56                	push   %r14
+  80113d:	41 55                	push   %r13
+  80113f:	41 54                	push   %r12
+  801141:	53                   	push   %rbx
+  801142:	48 83 ec 10          	sub    $0x10,%rsp
+  801146:	89 fb                	mov    %edi,%ebx
+  801148:	49 89 f4             	mov    %rsi,%r12
+  80114b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80114e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801152:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  801159:	00 00 00 
+  80115c:	ff d0                	call   *%rax
+  80115e:	85 c0                	test   %eax,%eax
+  801160:	78 47                	js     8011a9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801162:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801166:	41 8b 3e             	mov    (%r14),%edi
+  801169:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80116d:	48 b8 70 0d 80 00 00 	movabs $0x800d70,%rax
+  801174:	00 00 00 
+  801177:	ff d0                	call   *%rax
+  801179:	85 c0                	test   %eax,%eax
+  80117b:	78 30                	js     8011ad <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80117d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801182:	74 2d                	je     8011b1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801184:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801188:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80118c:	48 85 c0             	test   %rax,%rax
+  80118f:	74 56                	je     8011e7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801191:	4c 89 ea             	mov    %r13,%rdx
+  801194:	4c 89 e6             	mov    %r12,%rsi
+  801197:	4c 89 f7             	mov    %r14,%rdi
+  80119a:	ff d0                	call   *%rax
+}
+  80119c:	48 83 c4 10          	add    $0x10,%rsp
+  8011a0:	5b                   	pop    %rbx
+  8011a1:	41 5c                	pop    %r12
+  8011a3:	41 5d                	pop    %r13
+  8011a5:	41 5e                	pop    %r14
+  8011a7:	5d                   	pop    %rbp
+  8011a8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011a9:	48 98                	cltq
+  8011ab:	eb ef                	jmp    80119c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011ad:	48 98                	cltq
+  8011af:	eb eb                	jmp    80119c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011b1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8011b8:	00 00 00 
+  8011bb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8011c1:	89 da                	mov    %ebx,%edx
+  8011c3:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  8011ca:	00 00 00 
+  8011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d2:	48 b9 70 30 80 00 00 	movabs $0x803070,%rcx
+  8011d9:	00 00 00 
+  8011dc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8011de:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011e5:	eb b5                	jmp    80119c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8011e7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8011ee:	eb ac                	jmp    80119c <write+0x65>
+
+00000000008011f0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8011f0:	55                   	push   %rbp
+  8011f1:	48 89 e5             	mov    %rsp,%rbp
+  8011f4:	53                   	push   %rbx
+  8011f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8011f9:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011fb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8011ff:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  801206:	00 00 00 
+  801209:	ff d0                	call   *%rax
+  80120b:	85 c0                	test   %eax,%eax
+  80120d:	78 0c                	js     80121b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80120f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801213:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801216:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80121b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121f:	c9                   	leave
+  801220:	c3                   	ret
+
+0000000000801221 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  801221:	55                   	push   %rbp
+  801222:	48 89 e5             	mov    %rsp,%rbp
+  801225:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801229:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80122d:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  801234:	00 00 00 
+  801237:	ff d0                	call   *%rax
+  801239:	85 c0                	test   %eax,%eax
+  80123b:	78 07                	js     801244 <tell+0x23>
+    return fdes->fd_offset;
+  80123d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801241:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  801244:	c9                   	leave
+  801245:	c3                   	ret
+
+0000000000801246 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801246:	55                   	push   %rbp
+  801247:	48 89 e5             	mov    %rsp,%rbp
+  80124a:	41 55                	push   %r13
+  80124c:	41 54                	push   %r12
+  80124e:	53                   	push   %rbx
+  80124f:	48 83 ec 18          	sub    $0x18,%rsp
+  801253:	89 fb                	mov    %edi,%ebx
+  801255:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801258:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80125c:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  801263:	00 00 00 
+  801266:	ff d0                	call   *%rax
+  801268:	85 c0                	test   %eax,%eax
+  80126a:	78 38                	js     8012a4 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80126c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801270:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801274:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801278:	48 b8 70 0d 80 00 00 	movabs $0x800d70,%rax
+  80127f:	00 00 00 
+  801282:	ff d0                	call   *%rax
+  801284:	85 c0                	test   %eax,%eax
+  801286:	78 1c                	js     8012a4 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801288:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80128d:	74 20                	je     8012af <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80128f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801293:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801297:	48 85 c0             	test   %rax,%rax
+  80129a:	74 47                	je     8012e3 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80129c:	44 89 e6             	mov    %r12d,%esi
+  80129f:	4c 89 ef             	mov    %r13,%rdi
+  8012a2:	ff d0                	call   *%rax
+}
+  8012a4:	48 83 c4 18          	add    $0x18,%rsp
+  8012a8:	5b                   	pop    %rbx
+  8012a9:	41 5c                	pop    %r12
+  8012ab:	41 5d                	pop    %r13
+  8012ad:	5d                   	pop    %rbp
+  8012ae:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8012af:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8012b6:	00 00 00 
+  8012b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012bf:	89 da                	mov    %ebx,%edx
+  8012c1:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  8012c8:	00 00 00 
+  8012cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d0:	48 b9 70 30 80 00 00 	movabs $0x803070,%rcx
+  8012d7:	00 00 00 
+  8012da:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8012dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e1:	eb c1                	jmp    8012a4 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012e3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8012e8:	eb ba                	jmp    8012a4 <ftruncate+0x5e>
+
+00000000008012ea <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8012ea:	55                   	push   %rbp
+  8012eb:	48 89 e5             	mov    %rsp,%rbp
+  8012ee:	41 54                	push   %r12
+  8012f0:	53                   	push   %rbx
+  8012f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8012f5:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8012f8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8012fc:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  801303:	00 00 00 
+  801306:	ff d0                	call   *%rax
+  801308:	85 c0                	test   %eax,%eax
+  80130a:	78 4e                	js     80135a <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80130c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801310:	41 8b 3c 24          	mov    (%r12),%edi
+  801314:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801318:	48 b8 70 0d 80 00 00 	movabs $0x800d70,%rax
+  80131f:	00 00 00 
+  801322:	ff d0                	call   *%rax
+  801324:	85 c0                	test   %eax,%eax
+  801326:	78 32                	js     80135a <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801328:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80132c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801331:	74 30                	je     801363 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801333:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801336:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80133d:	00 00 00 
+    stat->st_isdir = 0;
+  801340:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801347:	00 00 00 
+    stat->st_dev = dev;
+  80134a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801351:	48 89 de             	mov    %rbx,%rsi
+  801354:	4c 89 e7             	mov    %r12,%rdi
+  801357:	ff 50 28             	call   *0x28(%rax)
+}
+  80135a:	48 83 c4 10          	add    $0x10,%rsp
+  80135e:	5b                   	pop    %rbx
+  80135f:	41 5c                	pop    %r12
+  801361:	5d                   	pop    %rbp
+  801362:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801363:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801368:	eb f0                	jmp    80135a <fstat+0x70>
+
+000000000080136a <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80136a:	55                   	push   %rbp
+  80136b:	48 89 e5             	mov    %rsp,%rbp
+  80136e:	41 54                	push   %r12
+  801370:	53                   	push   %rbx
+  801371:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  801378:	41 89 fc             	mov    %edi,%r12d
+  80137b:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80137d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801381:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  801388:	00 00 00 
+  80138b:	ff d0                	call   *%rax
+  80138d:	85 c0                	test   %eax,%eax
+  80138f:	78 31                	js     8013c2 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  801391:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801398:	44 89 e7             	mov    %r12d,%edi
+  80139b:	48 b8 ea 12 80 00 00 	movabs $0x8012ea,%rax
+  8013a2:	00 00 00 
+  8013a5:	ff d0                	call   *%rax
+  8013a7:	85 c0                	test   %eax,%eax
+  8013a9:	78 17                	js     8013c2 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8013ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013af:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8013b2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8013b5:	39 d3                	cmp    %edx,%ebx
+  8013b7:	0f 4f da             	cmovg  %edx,%ebx
+  8013ba:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8013bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013c2:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8013c9:	5b                   	pop    %rbx
+  8013ca:	41 5c                	pop    %r12
+  8013cc:	5d                   	pop    %rbp
+  8013cd:	c3                   	ret
+
+00000000008013ce <seektoend>:
+{
+  8013ce:	55                   	push   %rbp
+  8013cf:	48 89 e5             	mov    %rsp,%rbp
+  8013d2:	53                   	push   %rbx
+  8013d3:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8013da:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8013dc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013e0:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  8013e7:	00 00 00 
+  8013ea:	ff d0                	call   *%rax
+  8013ec:	85 c0                	test   %eax,%eax
+  8013ee:	78 28                	js     801418 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8013f0:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8013f7:	89 df                	mov    %ebx,%edi
+  8013f9:	48 b8 ea 12 80 00 00 	movabs $0x8012ea,%rax
+  801400:	00 00 00 
+  801403:	ff d0                	call   *%rax
+  801405:	85 c0                	test   %eax,%eax
+  801407:	78 0f                	js     801418 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  801409:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80140c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801410:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  801413:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801418:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141c:	c9                   	leave
+  80141d:	c3                   	ret
+
+000000000080141e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80141e:	55                   	push   %rbp
+  80141f:	48 89 e5             	mov    %rsp,%rbp
+  801422:	41 54                	push   %r12
+  801424:	53                   	push   %rbx
+  801425:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801428:	be 00 00 00 00       	mov    $0x0,%esi
+  80142d:	48 b8 11 20 80 00 00 	movabs $0x802011,%rax
+  801434:	00 00 00 
+  801437:	ff d0                	call   *%rax
+  801439:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80143b:	85 c0                	test   %eax,%eax
+  80143d:	78 25                	js     801464 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80143f:	4c 89 e6             	mov    %r12,%rsi
+  801442:	89 c7                	mov    %eax,%edi
+  801444:	48 b8 ea 12 80 00 00 	movabs $0x8012ea,%rax
+  80144b:	00 00 00 
+  80144e:	ff d0                	call   *%rax
+  801450:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801453:	89 df                	mov    %ebx,%edi
+  801455:	48 b8 8a 0e 80 00 00 	movabs $0x800e8a,%rax
+  80145c:	00 00 00 
+  80145f:	ff d0                	call   *%rax
+
+    return res;
+  801461:	44 89 e3             	mov    %r12d,%ebx
+}
+  801464:	89 d8                	mov    %ebx,%eax
+  801466:	5b                   	pop    %rbx
+  801467:	41 5c                	pop    %r12
+  801469:	5d                   	pop    %rbp
+  80146a:	c3                   	ret
+
+000000000080146b <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  80146b:	55                   	push   %rbp
+  80146c:	48 89 e5             	mov    %rsp,%rbp
+  80146f:	53                   	push   %rbx
+  801470:	48 83 ec 08          	sub    $0x8,%rsp
+  801474:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801477:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  80147e:	00 00 00 
+  801481:	ff d0                	call   *%rax
+  801483:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801487:	0f 87 ea 00 00 00    	ja     801577 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  80148d:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  801494:	00 00 00 
+  801497:	80 38 00             	cmpb   $0x0,(%rax)
+  80149a:	75 35                	jne    8014d1 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  80149c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014a1:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8014a6:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8014ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014b0:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  8014b7:	00 00 00 
+  8014ba:	ff d0                	call   *%rax
+  8014bc:	85 c0                	test   %eax,%eax
+  8014be:	0f 88 ba 00 00 00    	js     80157e <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8014c4:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014cb:	00 00 00 
+  8014ce:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8014d1:	48 89 df             	mov    %rbx,%rdi
+  8014d4:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  8014db:	00 00 00 
+  8014de:	ff d0                	call   *%rax
+  8014e0:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8014e4:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8014eb:	00 00 00 
+  8014ee:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8014f2:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8014f5:	39 39                	cmp    %edi,(%rcx)
+  8014f7:	74 46                	je     80153f <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8014f9:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8014fd:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  801504:	00 
+  801505:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80150c:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  801513:	00 
+  801514:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80151b:	00 
+  80151c:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  801523:	00 
+  801524:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80152b:	00 
+  80152c:	89 39                	mov    %edi,(%rcx)
+  80152e:	48 01 c6             	add    %rax,%rsi
+  801531:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  801536:	48 89 c8             	mov    %rcx,%rax
+  801539:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153d:	c9                   	leave
+  80153e:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80153f:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  801543:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80154a:	00 00 00 
+  80154d:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801550:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  801554:	74 e0                	je     801536 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  801556:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80155d:	00 
+  80155e:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  801562:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  801569:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80156b:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80156e:	48 01 c2             	add    %rax,%rdx
+  801571:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  801575:	eb bf                	jmp    801536 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801577:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157c:	eb b8                	jmp    801536 <fbuf_get+0xcb>
+            return NULL;
+  80157e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801583:	eb b1                	jmp    801536 <fbuf_get+0xcb>
+
+0000000000801585 <fsipc_bulk>:
+fsipc_bulk(void) {
+  801585:	55                   	push   %rbp
+  801586:	48 89 e5             	mov    %rsp,%rbp
+  801589:	53                   	push   %rbx
+  80158a:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  80158e:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  801595:	00 00 00 
+  801598:	48 8b 18             	mov    (%rax),%rbx
+  80159b:	48 85 db             	test   %rbx,%rbx
+  80159e:	74 16                	je     8015b6 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8015a0:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015a7:	00 00 00 
+  8015aa:	48 8b 18             	mov    (%rax),%rbx
+}
+  8015ad:	48 89 d8             	mov    %rbx,%rax
+  8015b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b4:	c9                   	leave
+  8015b5:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8015b6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015bb:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8015c0:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8015c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ca:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  8015d1:	00 00 00 
+  8015d4:	ff d0                	call   *%rax
+  8015d6:	85 c0                	test   %eax,%eax
+  8015d8:	78 d3                	js     8015ad <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8015da:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8015df:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8015e6:	00 00 00 
+  8015e9:	eb b5                	jmp    8015a0 <fsipc_bulk+0x1b>
+
+00000000008015eb <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8015eb:	55                   	push   %rbp
+  8015ec:	48 89 e5             	mov    %rsp,%rbp
+  8015ef:	41 57                	push   %r15
+  8015f1:	41 56                	push   %r14
+  8015f3:	41 55                	push   %r13
+  8015f5:	41 54                	push   %r12
+  8015f7:	53                   	push   %rbx
+  8015f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8015fc:	41 89 fd             	mov    %edi,%r13d
+  8015ff:	49 89 f6             	mov    %rsi,%r14
+  801602:	49 89 d7             	mov    %rdx,%r15
+  801605:	48 89 cb             	mov    %rcx,%rbx
+  801608:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80160b:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801612:	00 00 00 
+  801615:	83 38 00             	cmpl   $0x0,(%rax)
+  801618:	74 52                	je     80166c <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80161a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801620:	4c 89 f9             	mov    %r15,%rcx
+  801623:	4c 89 f2             	mov    %r14,%rdx
+  801626:	44 89 ee             	mov    %r13d,%esi
+  801629:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801630:	00 00 00 
+  801633:	8b 38                	mov    (%rax),%edi
+  801635:	48 b8 6f 41 80 00 00 	movabs $0x80416f,%rax
+  80163c:	00 00 00 
+  80163f:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  801641:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801646:	4c 89 e2             	mov    %r12,%rdx
+  801649:	48 89 de             	mov    %rbx,%rsi
+  80164c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801651:	48 b8 bf 3f 80 00 00 	movabs $0x803fbf,%rax
+  801658:	00 00 00 
+  80165b:	ff d0                	call   *%rax
+}
+  80165d:	48 83 c4 08          	add    $0x8,%rsp
+  801661:	5b                   	pop    %rbx
+  801662:	41 5c                	pop    %r12
+  801664:	41 5d                	pop    %r13
+  801666:	41 5e                	pop    %r14
+  801668:	41 5f                	pop    %r15
+  80166a:	5d                   	pop    %rbp
+  80166b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80166c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801671:	48 b8 12 42 80 00 00 	movabs $0x804212,%rax
+  801678:	00 00 00 
+  80167b:	ff d0                	call   *%rax
+  80167d:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  801684:	00 00 
+  801686:	eb 92                	jmp    80161a <fsipc_region+0x2f>
+
+0000000000801688 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  801688:	55                   	push   %rbp
+  801689:	48 89 e5             	mov    %rsp,%rbp
+  80168c:	41 57                	push   %r15
+  80168e:	41 56                	push   %r14
+  801690:	41 55                	push   %r13
+  801692:	41 54                	push   %r12
+  801694:	53                   	push   %rbx
+  801695:	48 83 ec 28          	sub    $0x28,%rsp
+  801699:	49 89 ff             	mov    %rdi,%r15
+  80169c:	49 89 f6             	mov    %rsi,%r14
+  80169f:	48 89 d3             	mov    %rdx,%rbx
+  8016a2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016a6:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8016a9:	48 b8 85 15 80 00 00 	movabs $0x801585,%rax
+  8016b0:	00 00 00 
+  8016b3:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8016b5:	48 85 c0             	test   %rax,%rax
+  8016b8:	0f 84 cc 00 00 00    	je     80178a <devfile_write_direct+0x102>
+  8016be:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8016c1:	48 85 db             	test   %rbx,%rbx
+  8016c4:	0f 84 ba 00 00 00    	je     801784 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8016ca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016d0:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8016d7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8016db:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8016df:	4c 29 e3             	sub    %r12,%rbx
+  8016e2:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8016e7:	48 39 c3             	cmp    %rax,%rbx
+  8016ea:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016ee:	48 89 da             	mov    %rbx,%rdx
+  8016f1:	4c 89 f6             	mov    %r14,%rsi
+  8016f4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8016f8:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  8016ff:	00 00 00 
+  801702:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  801704:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801708:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  80170c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80170f:	44 01 e0             	add    %r12d,%eax
+  801712:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  801716:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80171a:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  801721:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801728:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80172f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801735:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80173a:	4c 89 ee             	mov    %r13,%rsi
+  80173d:	bf 04 00 00 00       	mov    $0x4,%edi
+  801742:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  801749:	00 00 00 
+  80174c:	ff d0                	call   *%rax
+        if (res < 0)
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	78 29                	js     80177b <devfile_write_direct+0xf3>
+        if (res == 0)
+  801752:	74 2b                	je     80177f <devfile_write_direct+0xf7>
+        i += res;
+  801754:	48 98                	cltq
+  801756:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  801759:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  80175c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801760:	49 39 c4             	cmp    %rax,%r12
+  801763:	0f 82 72 ff ff ff    	jb     8016db <devfile_write_direct+0x53>
+    return i;
+  801769:	4c 89 e0             	mov    %r12,%rax
+}
+  80176c:	48 83 c4 28          	add    $0x28,%rsp
+  801770:	5b                   	pop    %rbx
+  801771:	41 5c                	pop    %r12
+  801773:	41 5d                	pop    %r13
+  801775:	41 5e                	pop    %r14
+  801777:	41 5f                	pop    %r15
+  801779:	5d                   	pop    %rbp
+  80177a:	c3                   	ret
+            return res;
+  80177b:	48 98                	cltq
+  80177d:	eb ed                	jmp    80176c <devfile_write_direct+0xe4>
+            return i;
+  80177f:	4c 89 e0             	mov    %r12,%rax
+  801782:	eb e8                	jmp    80176c <devfile_write_direct+0xe4>
+    size_t i = 0;
+  801784:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  801788:	eb df                	jmp    801769 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  80178a:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  801791:	eb d9                	jmp    80176c <devfile_write_direct+0xe4>
+
+0000000000801793 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  801793:	55                   	push   %rbp
+  801794:	48 89 e5             	mov    %rsp,%rbp
+  801797:	41 56                	push   %r14
+  801799:	41 55                	push   %r13
+  80179b:	41 54                	push   %r12
+  80179d:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  80179e:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8017a2:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8017a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ab:	4d 39 ee             	cmp    %r13,%r14
+  8017ae:	0f 84 99 00 00 00    	je     80184d <fbuf_flush+0xba>
+  8017b4:	49 89 fc             	mov    %rdi,%r12
+  8017b7:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8017ba:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017bd:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8017c1:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  8017c8:	00 00 00 
+  8017cb:	ff d0                	call   *%rax
+  8017cd:	48 89 c2             	mov    %rax,%rdx
+  8017d0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8017d4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8017d8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8017dc:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8017e1:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017e4:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8017e8:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8017ef:	00 
+  8017f0:	44 89 f1             	mov    %r14d,%ecx
+  8017f3:	4c 89 ea             	mov    %r13,%rdx
+  8017f6:	4c 89 e7             	mov    %r12,%rdi
+  8017f9:	48 b8 88 16 80 00 00 	movabs $0x801688,%rax
+  801800:	00 00 00 
+  801803:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801805:	48 85 c0             	test   %rax,%rax
+  801808:	78 43                	js     80184d <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80180a:	4c 39 e8             	cmp    %r13,%rax
+  80180d:	72 47                	jb     801856 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80180f:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  801814:	83 c0 01             	add    $0x1,%eax
+  801817:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80181c:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80181f:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801823:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  801827:	72 0f                	jb     801838 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  801829:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80182d:	48 39 c2             	cmp    %rax,%rdx
+  801830:	48 0f 42 d0          	cmovb  %rax,%rdx
+  801834:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  801838:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80183f:	00 
+  801840:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  801847:	00 
+    return 0;
+  801848:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80184d:	5b                   	pop    %rbx
+  80184e:	41 5c                	pop    %r12
+  801850:	41 5d                	pop    %r13
+  801852:	41 5e                	pop    %r14
+  801854:	5d                   	pop    %rbp
+  801855:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  801856:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80185b:	eb f0                	jmp    80184d <fbuf_flush+0xba>
+
+000000000080185d <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80185d:	55                   	push   %rbp
+  80185e:	48 89 e5             	mov    %rsp,%rbp
+  801861:	53                   	push   %rbx
+  801862:	48 83 ec 08          	sub    $0x8,%rsp
+  801866:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  801869:	48 b8 6b 14 80 00 00 	movabs $0x80146b,%rax
+  801870:	00 00 00 
+  801873:	ff d0                	call   *%rax
+  801875:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  801878:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187d:	48 85 f6             	test   %rsi,%rsi
+  801880:	74 0f                	je     801891 <devfile_sync+0x34>
+  801882:	48 89 df             	mov    %rbx,%rdi
+  801885:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  80188c:	00 00 00 
+  80188f:	ff d0                	call   *%rax
+}
+  801891:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801895:	c9                   	leave
+  801896:	c3                   	ret
+
+0000000000801897 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  801897:	55                   	push   %rbp
+  801898:	48 89 e5             	mov    %rsp,%rbp
+  80189b:	48 83 ec 10          	sub    $0x10,%rsp
+  80189f:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8018a2:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8018a9:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8018aa:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8018ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018b3:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8018ba:	00 00 00 
+  8018bd:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  8018c4:	00 00 00 
+  8018c7:	ff d0                	call   *%rax
+}
+  8018c9:	c9                   	leave
+  8018ca:	c3                   	ret
+
+00000000008018cb <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018cb:	55                   	push   %rbp
+  8018cc:	48 89 e5             	mov    %rsp,%rbp
+  8018cf:	41 54                	push   %r12
+  8018d1:	53                   	push   %rbx
+  8018d2:	48 89 fb             	mov    %rdi,%rbx
+  8018d5:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8018d8:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  8018df:	00 00 00 
+  8018e2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018e4:	85 c0                	test   %eax,%eax
+  8018e6:	78 63                	js     80194b <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018e8:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8018eb:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8018f2:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  8018f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8018fe:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801905:	00 00 00 
+  801908:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80190a:	85 c0                	test   %eax,%eax
+  80190c:	78 3d                	js     80194b <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80190e:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  801915:	00 00 00 
+  801918:	48 89 de             	mov    %rbx,%rsi
+  80191b:	4c 89 e7             	mov    %r12,%rdi
+  80191e:	48 b8 e8 39 80 00 00 	movabs $0x8039e8,%rax
+  801925:	00 00 00 
+  801928:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80192a:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  801930:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  801937:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801938:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80193e:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  801945:	00 
+
+    return 0;
+  801946:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80194b:	5b                   	pop    %rbx
+  80194c:	41 5c                	pop    %r12
+  80194e:	5d                   	pop    %rbp
+  80194f:	c3                   	ret
+
+0000000000801950 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801950:	55                   	push   %rbp
+  801951:	48 89 e5             	mov    %rsp,%rbp
+  801954:	41 54                	push   %r12
+  801956:	53                   	push   %rbx
+  801957:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  80195a:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  801961:	00 00 00 
+  801964:	ff d0                	call   *%rax
+  801966:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  801969:	48 89 df             	mov    %rbx,%rdi
+  80196c:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  801973:	00 00 00 
+  801976:	ff d0                	call   *%rax
+  801978:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80197c:	76 2e                	jbe    8019ac <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  80197e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801981:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  801988:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  80198a:	be 00 00 00 00       	mov    $0x0,%esi
+  80198f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801994:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  80199b:	00 00 00 
+  80199e:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019a0:	45 85 e4             	test   %r12d,%r12d
+  8019a3:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019a7:	5b                   	pop    %rbx
+  8019a8:	41 5c                	pop    %r12
+  8019aa:	5d                   	pop    %rbp
+  8019ab:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8019ac:	48 89 df             	mov    %rbx,%rdi
+  8019af:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  8019b6:	00 00 00 
+  8019b9:	ff d0                	call   *%rax
+  8019bb:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8019bf:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8019c6:	00 00 00 
+  8019c9:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8019d0:	48 89 df             	mov    %rbx,%rdi
+  8019d3:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  8019da:	00 00 00 
+  8019dd:	ff d0                	call   *%rax
+  8019df:	48 89 c6             	mov    %rax,%rsi
+  8019e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ec:	48 b8 60 04 80 00 00 	movabs $0x800460,%rax
+  8019f3:	00 00 00 
+  8019f6:	ff d0                	call   *%rax
+  8019f8:	eb 84                	jmp    80197e <devfile_flush+0x2e>
+
+00000000008019fa <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8019fa:	55                   	push   %rbp
+  8019fb:	48 89 e5             	mov    %rsp,%rbp
+  8019fe:	41 55                	push   %r13
+  801a00:	41 54                	push   %r12
+  801a02:	53                   	push   %rbx
+  801a03:	48 83 ec 08          	sub    $0x8,%rsp
+  801a07:	48 89 fb             	mov    %rdi,%rbx
+  801a0a:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a0d:	48 b8 6b 14 80 00 00 	movabs $0x80146b,%rax
+  801a14:	00 00 00 
+  801a17:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a19:	48 85 c0             	test   %rax,%rax
+  801a1c:	74 51                	je     801a6f <devfile_trunc+0x75>
+  801a1e:	49 89 c4             	mov    %rax,%r12
+  801a21:	48 89 c6             	mov    %rax,%rsi
+  801a24:	48 89 df             	mov    %rbx,%rdi
+  801a27:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801a2e:	00 00 00 
+  801a31:	ff d0                	call   *%rax
+  801a33:	85 c0                	test   %eax,%eax
+  801a35:	78 2d                	js     801a64 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a37:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a3e:	00 00 00 
+  801a41:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a44:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a46:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a4a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a4f:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a54:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801a5b:	00 00 00 
+  801a5e:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a60:	85 c0                	test   %eax,%eax
+  801a62:	79 3e                	jns    801aa2 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801a64:	48 83 c4 08          	add    $0x8,%rsp
+  801a68:	5b                   	pop    %rbx
+  801a69:	41 5c                	pop    %r12
+  801a6b:	41 5d                	pop    %r13
+  801a6d:	5d                   	pop    %rbp
+  801a6e:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a6f:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a76:	00 00 00 
+  801a79:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a7c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a7e:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a82:	be 00 00 00 00       	mov    $0x0,%esi
+  801a87:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a8c:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801a93:	00 00 00 
+  801a96:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	78 c8                	js     801a64 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801a9c:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801aa0:	eb c2                	jmp    801a64 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801aa2:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801aa5:	8d 51 01             	lea    0x1(%rcx),%edx
+  801aa8:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801aab:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801ab0:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801ab7:	00 00 
+  801ab9:	eb a9                	jmp    801a64 <devfile_trunc+0x6a>
+
+0000000000801abb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801abb:	55                   	push   %rbp
+  801abc:	48 89 e5             	mov    %rsp,%rbp
+  801abf:	41 57                	push   %r15
+  801ac1:	41 56                	push   %r14
+  801ac3:	41 55                	push   %r13
+  801ac5:	41 54                	push   %r12
+  801ac7:	53                   	push   %rbx
+  801ac8:	48 83 ec 28          	sub    $0x28,%rsp
+  801acc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ad0:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801ad4:	49 89 d7             	mov    %rdx,%r15
+  801ad7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801adb:	48 b8 6b 14 80 00 00 	movabs $0x80146b,%rax
+  801ae2:	00 00 00 
+  801ae5:	ff d0                	call   *%rax
+  801ae7:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801aea:	48 85 c0             	test   %rax,%rax
+  801aed:	74 31                	je     801b20 <devfile_write+0x65>
+  801aef:	4c 89 f8             	mov    %r15,%rax
+  801af2:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801af9:	77 25                	ja     801b20 <devfile_write+0x65>
+    size_t i = 0;
+  801afb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801b01:	48 85 c0             	test   %rax,%rax
+  801b04:	0f 85 64 01 00 00    	jne    801c6e <devfile_write+0x1b3>
+    size_t i = 0;
+  801b0a:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b0e:	4c 89 f8             	mov    %r15,%rax
+}
+  801b11:	48 83 c4 28          	add    $0x28,%rsp
+  801b15:	5b                   	pop    %rbx
+  801b16:	41 5c                	pop    %r12
+  801b18:	41 5d                	pop    %r13
+  801b1a:	41 5e                	pop    %r14
+  801b1c:	41 5f                	pop    %r15
+  801b1e:	5d                   	pop    %rbp
+  801b1f:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b20:	48 85 db             	test   %rbx,%rbx
+  801b23:	74 5b                	je     801b80 <devfile_write+0xc5>
+  801b25:	48 89 de             	mov    %rbx,%rsi
+  801b28:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b2c:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801b33:	00 00 00 
+  801b36:	ff d0                	call   *%rax
+  801b38:	85 c0                	test   %eax,%eax
+  801b3a:	78 40                	js     801b7c <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b3c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b40:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801b43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b47:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b4b:	48 b8 88 16 80 00 00 	movabs $0x801688,%rax
+  801b52:	00 00 00 
+  801b55:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b57:	48 85 c0             	test   %rax,%rax
+  801b5a:	7e b5                	jle    801b11 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801b5c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801b60:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801b63:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801b66:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801b69:	8d 51 01             	lea    0x1(%rcx),%edx
+  801b6c:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b6f:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801b72:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801b79:	00 
+  801b7a:	eb 95                	jmp    801b11 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b7c:	48 98                	cltq
+  801b7e:	eb 91                	jmp    801b11 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b80:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801b84:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801b87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b8b:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b8f:	48 89 df             	mov    %rbx,%rdi
+  801b92:	48 b8 88 16 80 00 00 	movabs $0x801688,%rax
+  801b99:	00 00 00 
+  801b9c:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b9e:	48 85 c0             	test   %rax,%rax
+  801ba1:	0f 8e 6a ff ff ff    	jle    801b11 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801ba7:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801baa:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801bae:	e9 5e ff ff ff       	jmp    801b11 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bb3:	48 98                	cltq
+  801bb5:	4d 85 ff             	test   %r15,%r15
+  801bb8:	49 0f 45 c7          	cmovne %r15,%rax
+  801bbc:	e9 50 ff ff ff       	jmp    801b11 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bc1:	48 89 de             	mov    %rbx,%rsi
+  801bc4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801bc8:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801bcf:	00 00 00 
+  801bd2:	ff d0                	call   *%rax
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	0f 88 2b 01 00 00    	js     801d07 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801bdc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801be0:	4c 01 f8             	add    %r15,%rax
+  801be3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801be7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801beb:	48 b9 97 0c 80 00 00 	movabs $0x800c97,%rcx
+  801bf2:	00 00 00 
+  801bf5:	ff d1                	call   *%rcx
+  801bf7:	48 89 c2             	mov    %rax,%rdx
+  801bfa:	48 c1 e2 04          	shl    $0x4,%rdx
+  801bfe:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801c02:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c06:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c0b:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c0e:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c15:	00 
+  801c16:	4c 89 ea             	mov    %r13,%rdx
+  801c19:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c1d:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  801c24:	00 00 00 
+  801c27:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c29:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c2d:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801c31:	48 39 c2             	cmp    %rax,%rdx
+  801c34:	0f 84 db 00 00 00    	je     801d15 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801c3a:	4c 39 e2             	cmp    %r12,%rdx
+  801c3d:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801c41:	4d 01 ec             	add    %r13,%r12
+  801c44:	49 39 c4             	cmp    %rax,%r12
+  801c47:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801c4b:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801c4f:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801c53:	45 01 ee             	add    %r13d,%r14d
+  801c56:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c5a:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801c5e:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801c61:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c65:	49 39 c7             	cmp    %rax,%r15
+  801c68:	0f 83 a0 fe ff ff    	jae    801b0e <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801c6e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c72:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801c76:	8b 43 08             	mov    0x8(%rbx),%eax
+  801c79:	44 39 f0             	cmp    %r14d,%eax
+  801c7c:	7f 10                	jg     801c8e <devfile_write+0x1d3>
+  801c7e:	48 98                	cltq
+  801c80:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801c86:	49 63 d6             	movslq %r14d,%rdx
+  801c89:	48 39 d0             	cmp    %rdx,%rax
+  801c8c:	7d 2d                	jge    801cbb <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801c8e:	48 89 de             	mov    %rbx,%rsi
+  801c91:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c95:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801c9c:	00 00 00 
+  801c9f:	ff d0                	call   *%rax
+  801ca1:	85 c0                	test   %eax,%eax
+  801ca3:	0f 88 0a ff ff ff    	js     801bb3 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801ca9:	44 89 f0             	mov    %r14d,%eax
+  801cac:	66 b8 00 00          	mov    $0x0,%ax
+  801cb0:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801cb3:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801cba:	00 
+        size_t off = pos - fb->fb_base;
+  801cbb:	45 89 f4             	mov    %r14d,%r12d
+  801cbe:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801cc2:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801cc5:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801cc9:	4d 29 fd             	sub    %r15,%r13
+  801ccc:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801cd1:	4c 29 e0             	sub    %r12,%rax
+  801cd4:	49 39 c5             	cmp    %rax,%r13
+  801cd7:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801cdb:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801cdf:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801ce3:	48 39 c2             	cmp    %rax,%rdx
+  801ce6:	0f 84 f0 fe ff ff    	je     801bdc <devfile_write+0x121>
+  801cec:	4c 39 e0             	cmp    %r12,%rax
+  801cef:	0f 82 cc fe ff ff    	jb     801bc1 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801cf5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801cf9:	48 39 d0             	cmp    %rdx,%rax
+  801cfc:	0f 83 da fe ff ff    	jae    801bdc <devfile_write+0x121>
+  801d02:	e9 ba fe ff ff       	jmp    801bc1 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d07:	48 98                	cltq
+  801d09:	4d 85 ff             	test   %r15,%r15
+  801d0c:	49 0f 45 c7          	cmovne %r15,%rax
+  801d10:	e9 fc fd ff ff       	jmp    801b11 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d15:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d19:	4c 89 e2             	mov    %r12,%rdx
+  801d1c:	e9 2a ff ff ff       	jmp    801c4b <devfile_write+0x190>
+
+0000000000801d21 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d21:	55                   	push   %rbp
+  801d22:	48 89 e5             	mov    %rsp,%rbp
+  801d25:	41 57                	push   %r15
+  801d27:	41 56                	push   %r14
+  801d29:	41 55                	push   %r13
+  801d2b:	41 54                	push   %r12
+  801d2d:	53                   	push   %rbx
+  801d2e:	48 83 ec 28          	sub    $0x28,%rsp
+  801d32:	49 89 ff             	mov    %rdi,%r15
+  801d35:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801d39:	48 89 d3             	mov    %rdx,%rbx
+  801d3c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801d40:	48 b8 6b 14 80 00 00 	movabs $0x80146b,%rax
+  801d47:	00 00 00 
+  801d4a:	ff d0                	call   *%rax
+  801d4c:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801d4f:	48 85 c0             	test   %rax,%rax
+  801d52:	74 0d                	je     801d61 <devfile_read+0x40>
+  801d54:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801d5b:	0f 86 1a 01 00 00    	jbe    801e7b <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801d61:	4d 85 e4             	test   %r12,%r12
+  801d64:	74 1a                	je     801d80 <devfile_read+0x5f>
+  801d66:	4c 89 e6             	mov    %r12,%rsi
+  801d69:	4c 89 ff             	mov    %r15,%rdi
+  801d6c:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801d73:	00 00 00 
+  801d76:	ff d0                	call   *%rax
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	0f 88 e8 00 00 00    	js     801e68 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801d80:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801d84:	48 b8 85 15 80 00 00 	movabs $0x801585,%rax
+  801d8b:	00 00 00 
+  801d8e:	ff d0                	call   *%rax
+  801d90:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801d93:	48 85 c0             	test   %rax,%rax
+  801d96:	0f 84 69 02 00 00    	je     802005 <devfile_read+0x2e4>
+    while (i < n) {
+  801d9c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801da1:	0f 84 ce 00 00 00    	je     801e75 <devfile_read+0x154>
+    size_t i = 0;
+  801da7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801dac:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801db3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801db7:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801dbb:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801dbf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801dc3:	48 29 da             	sub    %rbx,%rdx
+  801dc6:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801dcb:	48 39 c2             	cmp    %rax,%rdx
+  801dce:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801dd2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801dd6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801dda:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801ddd:	01 d8                	add    %ebx,%eax
+  801ddf:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801de3:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801de7:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801dee:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801df5:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801dfc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e07:	4c 89 ee             	mov    %r13,%rsi
+  801e0a:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e0f:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  801e16:	00 00 00 
+  801e19:	ff d0                	call   *%rax
+        if (res < 0)
+  801e1b:	85 c0                	test   %eax,%eax
+  801e1d:	78 4d                	js     801e6c <devfile_read+0x14b>
+        if (res == 0)
+  801e1f:	74 4f                	je     801e70 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e21:	4c 63 e0             	movslq %eax,%r12
+  801e24:	4c 89 e2             	mov    %r12,%rdx
+  801e27:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e2b:	4c 89 f7             	mov    %r14,%rdi
+  801e2e:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  801e35:	00 00 00 
+  801e38:	ff d0                	call   *%rax
+        i += res;
+  801e3a:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801e3d:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801e40:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e44:	48 39 c3             	cmp    %rax,%rbx
+  801e47:	0f 82 72 ff ff ff    	jb     801dbf <devfile_read+0x9e>
+    return i;
+  801e4d:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801e50:	48 85 c0             	test   %rax,%rax
+  801e53:	7e 04                	jle    801e59 <devfile_read+0x138>
+  801e55:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801e59:	48 83 c4 28          	add    $0x28,%rsp
+  801e5d:	5b                   	pop    %rbx
+  801e5e:	41 5c                	pop    %r12
+  801e60:	41 5d                	pop    %r13
+  801e62:	41 5e                	pop    %r14
+  801e64:	41 5f                	pop    %r15
+  801e66:	5d                   	pop    %rbp
+  801e67:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801e68:	48 98                	cltq
+  801e6a:	eb ed                	jmp    801e59 <devfile_read+0x138>
+            return res;
+  801e6c:	48 98                	cltq
+  801e6e:	eb e9                	jmp    801e59 <devfile_read+0x138>
+            return i;
+  801e70:	48 89 d8             	mov    %rbx,%rax
+  801e73:	eb db                	jmp    801e50 <devfile_read+0x12f>
+    size_t i = 0;
+  801e75:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801e79:	eb d2                	jmp    801e4d <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801e7b:	48 89 c6             	mov    %rax,%rsi
+  801e7e:	4c 89 ff             	mov    %r15,%rdi
+  801e81:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801e88:	00 00 00 
+  801e8b:	ff d0                	call   *%rax
+  801e8d:	85 c0                	test   %eax,%eax
+  801e8f:	78 40                	js     801ed1 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801e91:	4c 89 ff             	mov    %r15,%rdi
+  801e94:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+  801ea0:	48 89 c2             	mov    %rax,%rdx
+  801ea3:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ea7:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801eab:	48 c1 e0 0c          	shl    $0xc,%rax
+  801eaf:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801eb4:	48 01 d0             	add    %rdx,%rax
+  801eb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801ebb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ec0:	0f 84 33 01 00 00    	je     801ff9 <devfile_read+0x2d8>
+    size_t i = 0;
+  801ec6:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801ecc:	e9 f5 00 00 00       	jmp    801fc6 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801ed1:	48 98                	cltq
+  801ed3:	eb 84                	jmp    801e59 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801ed5:	44 89 e8             	mov    %r13d,%eax
+  801ed8:	66 b8 00 00          	mov    $0x0,%ax
+  801edc:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801ee1:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801ee8:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801eea:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801eee:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801ef2:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801ef4:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801ef9:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801efc:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801f03:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801f04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f0f:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f14:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f19:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  801f20:	00 00 00 
+  801f23:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f25:	85 c0                	test   %eax,%eax
+  801f27:	0f 88 be 00 00 00    	js     801feb <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f2d:	48 63 d0             	movslq %eax,%rdx
+  801f30:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801f35:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801f3a:	44 39 e8             	cmp    %r13d,%eax
+  801f3d:	0f 8e ba 00 00 00    	jle    801ffd <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801f43:	49 63 c5             	movslq %r13d,%rax
+  801f46:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801f4b:	48 29 c3             	sub    %rax,%rbx
+  801f4e:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801f53:	48 01 c3             	add    %rax,%rbx
+  801f56:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f5a:	4c 29 f0             	sub    %r14,%rax
+  801f5d:	48 39 c3             	cmp    %rax,%rbx
+  801f60:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801f64:	4c 89 ff             	mov    %r15,%rdi
+  801f67:	48 b9 97 0c 80 00 00 	movabs $0x800c97,%rcx
+  801f6e:	00 00 00 
+  801f71:	ff d1                	call   *%rcx
+  801f73:	48 89 c2             	mov    %rax,%rdx
+  801f76:	48 c1 e2 04          	shl    $0x4,%rdx
+  801f7a:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801f7e:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f82:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801f87:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801f8a:	44 89 ea             	mov    %r13d,%edx
+  801f8d:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  801f92:	48 63 d2             	movslq %edx,%rdx
+  801f95:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801f9c:	00 
+  801f9d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801fa1:	4c 01 f7             	add    %r14,%rdi
+  801fa4:	48 89 da             	mov    %rbx,%rdx
+  801fa7:	48 b9 dd 3d 80 00 00 	movabs $0x803ddd,%rcx
+  801fae:	00 00 00 
+  801fb1:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  801fb3:	41 01 dd             	add    %ebx,%r13d
+  801fb6:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  801fba:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  801fbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fc1:	49 39 c6             	cmp    %rax,%r14
+  801fc4:	73 37                	jae    801ffd <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  801fc6:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  801fca:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801fcf:	44 39 e8             	cmp    %r13d,%eax
+  801fd2:	0f 8f fd fe ff ff    	jg     801ed5 <devfile_read+0x1b4>
+  801fd8:	41 03 44 24 10       	add    0x10(%r12),%eax
+  801fdd:	44 39 e8             	cmp    %r13d,%eax
+  801fe0:	0f 8f 5d ff ff ff    	jg     801f43 <devfile_read+0x222>
+  801fe6:	e9 ea fe ff ff       	jmp    801ed5 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  801feb:	48 98                	cltq
+  801fed:	4d 85 f6             	test   %r14,%r14
+  801ff0:	49 0f 45 c6          	cmovne %r14,%rax
+  801ff4:	e9 60 fe ff ff       	jmp    801e59 <devfile_read+0x138>
+    size_t i = 0;
+  801ff9:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  801ffd:	4c 89 f0             	mov    %r14,%rax
+  802000:	e9 54 fe ff ff       	jmp    801e59 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  802005:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80200c:	e9 48 fe ff ff       	jmp    801e59 <devfile_read+0x138>
+
+0000000000802011 <open>:
+open(const char *path, int mode) {
+  802011:	55                   	push   %rbp
+  802012:	48 89 e5             	mov    %rsp,%rbp
+  802015:	41 55                	push   %r13
+  802017:	41 54                	push   %r12
+  802019:	53                   	push   %rbx
+  80201a:	48 83 ec 18          	sub    $0x18,%rsp
+  80201e:	49 89 fc             	mov    %rdi,%r12
+  802021:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802024:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  80202b:	00 00 00 
+  80202e:	ff d0                	call   *%rax
+  802030:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802036:	0f 87 8a 00 00 00    	ja     8020c6 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80203c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802040:	48 b8 c5 0c 80 00 00 	movabs $0x800cc5,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+  80204c:	89 c3                	mov    %eax,%ebx
+  80204e:	85 c0                	test   %eax,%eax
+  802050:	78 50                	js     8020a2 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802052:	4c 89 e6             	mov    %r12,%rsi
+  802055:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80205c:	00 00 00 
+  80205f:	48 89 df             	mov    %rbx,%rdi
+  802062:	48 b8 e8 39 80 00 00 	movabs $0x8039e8,%rax
+  802069:	00 00 00 
+  80206c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80206e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802075:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802079:	bf 01 00 00 00       	mov    $0x1,%edi
+  80207e:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  802085:	00 00 00 
+  802088:	ff d0                	call   *%rax
+  80208a:	89 c3                	mov    %eax,%ebx
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	78 1f                	js     8020af <open+0x9e>
+    return fd2num(fd);
+  802090:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802094:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  80209b:	00 00 00 
+  80209e:	ff d0                	call   *%rax
+  8020a0:	89 c3                	mov    %eax,%ebx
+}
+  8020a2:	89 d8                	mov    %ebx,%eax
+  8020a4:	48 83 c4 18          	add    $0x18,%rsp
+  8020a8:	5b                   	pop    %rbx
+  8020a9:	41 5c                	pop    %r12
+  8020ab:	41 5d                	pop    %r13
+  8020ad:	5d                   	pop    %rbp
+  8020ae:	c3                   	ret
+        fd_close(fd, 0);
+  8020af:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020b8:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  8020bf:	00 00 00 
+  8020c2:	ff d0                	call   *%rax
+        return res;
+  8020c4:	eb dc                	jmp    8020a2 <open+0x91>
+        return -E_BAD_PATH;
+  8020c6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020cb:	eb d5                	jmp    8020a2 <open+0x91>
+
+00000000008020cd <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8020cd:	55                   	push   %rbp
+  8020ce:	48 89 e5             	mov    %rsp,%rbp
+  8020d1:	41 57                	push   %r15
+  8020d3:	41 56                	push   %r14
+  8020d5:	41 55                	push   %r13
+  8020d7:	41 54                	push   %r12
+  8020d9:	53                   	push   %rbx
+  8020da:	48 83 ec 18          	sub    $0x18,%rsp
+  8020de:	41 89 f6             	mov    %esi,%r14d
+  8020e1:	49 89 d7             	mov    %rdx,%r15
+  8020e4:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020e7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8020eb:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  8020f2:	00 00 00 
+  8020f5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020f7:	85 c0                	test   %eax,%eax
+  8020f9:	0f 88 db 00 00 00    	js     8021da <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8020ff:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802103:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80210a:	00 00 00 
+  80210d:	8b 00                	mov    (%rax),%eax
+  80210f:	39 07                	cmp    %eax,(%rdi)
+  802111:	0f 85 db 00 00 00    	jne    8021f2 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802117:	45 85 f6             	test   %r14d,%r14d
+  80211a:	0f 88 db 00 00 00    	js     8021fb <fmap+0x12e>
+  802120:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802127:	0f 85 d7 00 00 00    	jne    802204 <fmap+0x137>
+  80212d:	4c 89 fb             	mov    %r15,%rbx
+  802130:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802136:	0f 85 d1 00 00 00    	jne    80220d <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80213c:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  802143:	00 00 00 
+  802146:	ff d0                	call   *%rax
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	0f 88 8e 00 00 00    	js     8021de <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802150:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  802157:	00 00 00 
+    while (i < n) {
+  80215a:	4d 85 ed             	test   %r13,%r13
+  80215d:	0f 84 8a 00 00 00    	je     8021ed <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  802163:	4c 89 ea             	mov    %r13,%rdx
+  802166:	48 29 da             	sub    %rbx,%rdx
+  802169:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  802170:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802176:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80217a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80217e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802181:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  802185:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  802189:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  80218e:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  802193:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  802197:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80219b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021a0:	4c 89 e6             	mov    %r12,%rsi
+  8021a3:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021a8:	48 b8 eb 15 80 00 00 	movabs $0x8015eb,%rax
+  8021af:	00 00 00 
+  8021b2:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021b4:	85 c0                	test   %eax,%eax
+  8021b6:	78 2a                	js     8021e2 <fmap+0x115>
+        i += res;
+  8021b8:	48 98                	cltq
+  8021ba:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8021bd:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8021c1:	72 05                	jb     8021c8 <fmap+0xfb>
+    while (i < n) {
+  8021c3:	4c 39 eb             	cmp    %r13,%rbx
+  8021c6:	72 9b                	jb     802163 <fmap+0x96>
+    }
+    return i;
+  8021c8:	48 89 d8             	mov    %rbx,%rax
+}
+  8021cb:	48 83 c4 18          	add    $0x18,%rsp
+  8021cf:	5b                   	pop    %rbx
+  8021d0:	41 5c                	pop    %r12
+  8021d2:	41 5d                	pop    %r13
+  8021d4:	41 5e                	pop    %r14
+  8021d6:	41 5f                	pop    %r15
+  8021d8:	5d                   	pop    %rbp
+  8021d9:	c3                   	ret
+    if (res < 0) return res;
+  8021da:	48 98                	cltq
+  8021dc:	eb ed                	jmp    8021cb <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8021de:	48 98                	cltq
+  8021e0:	eb e9                	jmp    8021cb <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021e2:	48 98                	cltq
+  8021e4:	48 85 db             	test   %rbx,%rbx
+  8021e7:	48 0f 45 c3          	cmovne %rbx,%rax
+  8021eb:	eb de                	jmp    8021cb <fmap+0xfe>
+    size_t i = 0;
+  8021ed:	4c 89 eb             	mov    %r13,%rbx
+  8021f0:	eb d6                	jmp    8021c8 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8021f2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8021f9:	eb d0                	jmp    8021cb <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8021fb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802202:	eb c7                	jmp    8021cb <fmap+0xfe>
+  802204:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80220b:	eb be                	jmp    8021cb <fmap+0xfe>
+  80220d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802214:	eb b5                	jmp    8021cb <fmap+0xfe>
+
+0000000000802216 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  802216:	55                   	push   %rbp
+  802217:	48 89 e5             	mov    %rsp,%rbp
+  80221a:	41 56                	push   %r14
+  80221c:	41 55                	push   %r13
+  80221e:	41 54                	push   %r12
+  802220:	53                   	push   %rbx
+  802221:	48 83 ec 10          	sub    $0x10,%rsp
+  802225:	89 fb                	mov    %edi,%ebx
+  802227:	41 89 f4             	mov    %esi,%r12d
+  80222a:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80222d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802231:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  802238:	00 00 00 
+  80223b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80223d:	85 c0                	test   %eax,%eax
+  80223f:	78 63                	js     8022a4 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  802241:	45 85 e4             	test   %r12d,%r12d
+  802244:	0f 88 80 00 00 00    	js     8022ca <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80224a:	45 89 e6             	mov    %r12d,%r14d
+  80224d:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  802254:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802258:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  80225f:	00 00 00 
+  802262:	ff d0                	call   *%rax
+  802264:	48 89 c2             	mov    %rax,%rdx
+  802267:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80226c:	44 89 f6             	mov    %r14d,%esi
+  80226f:	89 df                	mov    %ebx,%edi
+  802271:	48 b8 cd 20 80 00 00 	movabs $0x8020cd,%rax
+  802278:	00 00 00 
+  80227b:	ff d0                	call   *%rax
+  80227d:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  802280:	45 29 f4             	sub    %r14d,%r12d
+  802283:	4d 63 f4             	movslq %r12d,%r14
+  802286:	49 39 c6             	cmp    %rax,%r14
+  802289:	7c 1d                	jl     8022a8 <read_map+0x92>
+  80228b:	48 85 c0             	test   %rax,%rax
+  80228e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802293:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  802297:	48 83 c4 10          	add    $0x10,%rsp
+  80229b:	5b                   	pop    %rbx
+  80229c:	41 5c                	pop    %r12
+  80229e:	41 5d                	pop    %r13
+  8022a0:	41 5e                	pop    %r14
+  8022a2:	5d                   	pop    %rbp
+  8022a3:	c3                   	ret
+    if (res < 0) return res;
+  8022a4:	48 98                	cltq
+  8022a6:	eb ef                	jmp    802297 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8022a8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022ac:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  8022b3:	00 00 00 
+  8022b6:	ff d0                	call   *%rax
+  8022b8:	4d 63 e4             	movslq %r12d,%r12
+  8022bb:	4c 01 e0             	add    %r12,%rax
+  8022be:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8022c2:	48 89 d8             	mov    %rbx,%rax
+  8022c5:	4c 29 f0             	sub    %r14,%rax
+  8022c8:	eb cd                	jmp    802297 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8022ca:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022d1:	eb c4                	jmp    802297 <read_map+0x81>
+
+00000000008022d3 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8022d3:	55                   	push   %rbp
+  8022d4:	48 89 e5             	mov    %rsp,%rbp
+  8022d7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022db:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022df:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  8022e6:	00 00 00 
+  8022e9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022eb:	85 c0                	test   %eax,%eax
+  8022ed:	78 4a                	js     802339 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8022ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8022f3:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8022fa:	00 00 00 
+  8022fd:	8b 00                	mov    (%rax),%eax
+  8022ff:	39 07                	cmp    %eax,(%rdi)
+  802301:	75 38                	jne    80233b <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802303:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  80230a:	00 00 00 
+  80230d:	ff d0                	call   *%rax
+  80230f:	85 c0                	test   %eax,%eax
+  802311:	78 26                	js     802339 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802313:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802317:	8b 40 0c             	mov    0xc(%rax),%eax
+  80231a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802321:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802323:	be 00 00 00 00       	mov    $0x0,%esi
+  802328:	bf 06 00 00 00       	mov    $0x6,%edi
+  80232d:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  802334:	00 00 00 
+  802337:	ff d0                	call   *%rax
+}
+  802339:	c9                   	leave
+  80233a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80233b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802340:	eb f7                	jmp    802339 <fsync+0x66>
+
+0000000000802342 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  802342:	55                   	push   %rbp
+  802343:	48 89 e5             	mov    %rsp,%rbp
+  802346:	41 57                	push   %r15
+  802348:	41 56                	push   %r14
+  80234a:	41 55                	push   %r13
+  80234c:	41 54                	push   %r12
+  80234e:	53                   	push   %rbx
+  80234f:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  802353:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80235a:	00 00 00 
+  80235d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  802362:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802368:	49 bd 25 0d 80 00 00 	movabs $0x800d25,%r13
+  80236f:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  802372:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  802379:	00 00 00 
+  80237c:	eb 0c                	jmp    80238a <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80237e:	83 c3 01             	add    $0x1,%ebx
+  802381:	49 83 c4 28          	add    $0x28,%r12
+  802385:	83 fb 20             	cmp    $0x20,%ebx
+  802388:	74 33                	je     8023bd <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80238a:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80238f:	74 ed                	je     80237e <flushall+0x3c>
+  802391:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802395:	89 df                	mov    %ebx,%edi
+  802397:	41 ff d5             	call   *%r13
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	78 e0                	js     80237e <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80239e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023a2:	41 8b 06             	mov    (%r14),%eax
+  8023a5:	39 07                	cmp    %eax,(%rdi)
+  8023a7:	75 d5                	jne    80237e <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8023a9:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  8023b0:	00 00 00 
+  8023b3:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8023b5:	85 c0                	test   %eax,%eax
+  8023b7:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8023bb:	eb c1                	jmp    80237e <flushall+0x3c>
+    }
+    return res;
+}
+  8023bd:	44 89 f8             	mov    %r15d,%eax
+  8023c0:	48 83 c4 18          	add    $0x18,%rsp
+  8023c4:	5b                   	pop    %rbx
+  8023c5:	41 5c                	pop    %r12
+  8023c7:	41 5d                	pop    %r13
+  8023c9:	41 5e                	pop    %r14
+  8023cb:	41 5f                	pop    %r15
+  8023cd:	5d                   	pop    %rbp
+  8023ce:	c3                   	ret
+
+00000000008023cf <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8023cf:	55                   	push   %rbp
+  8023d0:	48 89 e5             	mov    %rsp,%rbp
+  8023d3:	53                   	push   %rbx
+  8023d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d8:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8023db:	40 0f b6 c6          	movzbl %sil,%eax
+  8023df:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8023e6:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8023e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ed:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8023f2:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  8023f9:	00 00 00 
+  8023fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023fe:	85 c0                	test   %eax,%eax
+  802400:	78 23                	js     802425 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  802402:	ba 58 06 00 00       	mov    $0x658,%edx
+  802407:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80240e:	00 00 00 
+  802411:	48 89 df             	mov    %rbx,%rdi
+  802414:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  80241b:	00 00 00 
+  80241e:	ff d0                	call   *%rax
+    return 0;
+  802420:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802425:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802429:	c9                   	leave
+  80242a:	c3                   	ret
+
+000000000080242b <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80242b:	55                   	push   %rbp
+  80242c:	48 89 e5             	mov    %rsp,%rbp
+  80242f:	53                   	push   %rbx
+  802430:	48 83 ec 08          	sub    $0x8,%rsp
+  802434:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  802437:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  80243e:	00 00 00 
+  802441:	ff d0                	call   *%rax
+  802443:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802449:	77 35                	ja     802480 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80244b:	48 89 de             	mov    %rbx,%rsi
+  80244e:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  802455:	00 00 00 
+  802458:	48 b8 e8 39 80 00 00 	movabs $0x8039e8,%rax
+  80245f:	00 00 00 
+  802462:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  802464:	be 00 00 00 00       	mov    $0x0,%esi
+  802469:	bf 07 00 00 00       	mov    $0x7,%edi
+  80246e:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+}
+  80247a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80247e:	c9                   	leave
+  80247f:	c3                   	ret
+        return -E_BAD_PATH;
+  802480:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802485:	eb f3                	jmp    80247a <remove+0x4f>
+
+0000000000802487 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802487:	55                   	push   %rbp
+  802488:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  80248b:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802492:	00 00 00 
+  802495:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802497:	be 00 00 00 00       	mov    $0x0,%esi
+  80249c:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024a1:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  8024a8:	00 00 00 
+  8024ab:	ff d0                	call   *%rax
+}
+  8024ad:	5d                   	pop    %rbp
+  8024ae:	c3                   	ret
+
+00000000008024af <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024af:	55                   	push   %rbp
+  8024b0:	48 89 e5             	mov    %rsp,%rbp
+  8024b3:	41 54                	push   %r12
+  8024b5:	53                   	push   %rbx
+  8024b6:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024b9:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  8024c0:	00 00 00 
+  8024c3:	ff d0                	call   *%rax
+  8024c5:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024c8:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  8024cf:	00 00 00 
+  8024d2:	48 89 df             	mov    %rbx,%rdi
+  8024d5:	48 b8 e8 39 80 00 00 	movabs $0x8039e8,%rax
+  8024dc:	00 00 00 
+  8024df:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024e1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024e6:	41 2b 04 24          	sub    (%r12),%eax
+  8024ea:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024f0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024f7:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024fa:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802501:	00 00 00 
+  802504:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80250b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802510:	5b                   	pop    %rbx
+  802511:	41 5c                	pop    %r12
+  802513:	5d                   	pop    %rbp
+  802514:	c3                   	ret
+
+0000000000802515 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802515:	55                   	push   %rbp
+  802516:	48 89 e5             	mov    %rsp,%rbp
+  802519:	41 54                	push   %r12
+  80251b:	53                   	push   %rbx
+  80251c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80251f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802524:	48 89 fe             	mov    %rdi,%rsi
+  802527:	bf 00 00 00 00       	mov    $0x0,%edi
+  80252c:	49 bc 60 04 80 00 00 	movabs $0x800460,%r12
+  802533:	00 00 00 
+  802536:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802539:	48 89 df             	mov    %rbx,%rdi
+  80253c:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  802543:	00 00 00 
+  802546:	ff d0                	call   *%rax
+  802548:	48 89 c6             	mov    %rax,%rsi
+  80254b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802550:	bf 00 00 00 00       	mov    $0x0,%edi
+  802555:	41 ff d4             	call   *%r12
+}
+  802558:	5b                   	pop    %rbx
+  802559:	41 5c                	pop    %r12
+  80255b:	5d                   	pop    %rbp
+  80255c:	c3                   	ret
+
+000000000080255d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80255d:	55                   	push   %rbp
+  80255e:	48 89 e5             	mov    %rsp,%rbp
+  802561:	41 57                	push   %r15
+  802563:	41 56                	push   %r14
+  802565:	41 55                	push   %r13
+  802567:	41 54                	push   %r12
+  802569:	53                   	push   %rbx
+  80256a:	48 83 ec 18          	sub    $0x18,%rsp
+  80256e:	49 89 fc             	mov    %rdi,%r12
+  802571:	49 89 f5             	mov    %rsi,%r13
+  802574:	49 89 d7             	mov    %rdx,%r15
+  802577:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80257b:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  802582:	00 00 00 
+  802585:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802587:	4d 85 ff             	test   %r15,%r15
+  80258a:	0f 84 af 00 00 00    	je     80263f <devpipe_write+0xe2>
+  802590:	48 89 c3             	mov    %rax,%rbx
+  802593:	4c 89 f8             	mov    %r15,%rax
+  802596:	4d 89 ef             	mov    %r13,%r15
+  802599:	4c 01 e8             	add    %r13,%rax
+  80259c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025a0:	49 bd 55 02 80 00 00 	movabs $0x800255,%r13
+  8025a7:	00 00 00 
+            sys_yield();
+  8025aa:	49 be f2 01 80 00 00 	movabs $0x8001f2,%r14
+  8025b1:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025b4:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025b7:	48 63 ce             	movslq %esi,%rcx
+  8025ba:	48 63 03             	movslq (%rbx),%rax
+  8025bd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025c3:	48 39 c1             	cmp    %rax,%rcx
+  8025c6:	72 2e                	jb     8025f6 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025c8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025cd:	48 89 da             	mov    %rbx,%rdx
+  8025d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025d5:	4c 89 e7             	mov    %r12,%rdi
+  8025d8:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025db:	85 c0                	test   %eax,%eax
+  8025dd:	74 66                	je     802645 <devpipe_write+0xe8>
+            sys_yield();
+  8025df:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025e2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025e5:	48 63 ce             	movslq %esi,%rcx
+  8025e8:	48 63 03             	movslq (%rbx),%rax
+  8025eb:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025f1:	48 39 c1             	cmp    %rax,%rcx
+  8025f4:	73 d2                	jae    8025c8 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025f6:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025fa:	48 89 ca             	mov    %rcx,%rdx
+  8025fd:	48 c1 ea 03          	shr    $0x3,%rdx
+  802601:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802608:	08 10 20 
+  80260b:	48 f7 e2             	mul    %rdx
+  80260e:	48 c1 ea 06          	shr    $0x6,%rdx
+  802612:	48 89 d0             	mov    %rdx,%rax
+  802615:	48 c1 e0 09          	shl    $0x9,%rax
+  802619:	48 29 d0             	sub    %rdx,%rax
+  80261c:	48 c1 e0 03          	shl    $0x3,%rax
+  802620:	48 29 c1             	sub    %rax,%rcx
+  802623:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802628:	83 c6 01             	add    $0x1,%esi
+  80262b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80262e:	49 83 c7 01          	add    $0x1,%r15
+  802632:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802636:	49 39 c7             	cmp    %rax,%r15
+  802639:	0f 85 75 ff ff ff    	jne    8025b4 <devpipe_write+0x57>
+    return n;
+  80263f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802643:	eb 05                	jmp    80264a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802645:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80264a:	48 83 c4 18          	add    $0x18,%rsp
+  80264e:	5b                   	pop    %rbx
+  80264f:	41 5c                	pop    %r12
+  802651:	41 5d                	pop    %r13
+  802653:	41 5e                	pop    %r14
+  802655:	41 5f                	pop    %r15
+  802657:	5d                   	pop    %rbp
+  802658:	c3                   	ret
+
+0000000000802659 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802659:	55                   	push   %rbp
+  80265a:	48 89 e5             	mov    %rsp,%rbp
+  80265d:	41 57                	push   %r15
+  80265f:	41 56                	push   %r14
+  802661:	41 55                	push   %r13
+  802663:	41 54                	push   %r12
+  802665:	53                   	push   %rbx
+  802666:	48 83 ec 18          	sub    $0x18,%rsp
+  80266a:	49 89 fc             	mov    %rdi,%r12
+  80266d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802671:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802675:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+  802681:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802684:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80268a:	49 bd 55 02 80 00 00 	movabs $0x800255,%r13
+  802691:	00 00 00 
+            sys_yield();
+  802694:	49 be f2 01 80 00 00 	movabs $0x8001f2,%r14
+  80269b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80269e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026a3:	74 7d                	je     802722 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026a5:	8b 03                	mov    (%rbx),%eax
+  8026a7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026aa:	75 26                	jne    8026d2 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026ac:	4d 85 ff             	test   %r15,%r15
+  8026af:	75 77                	jne    802728 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026b1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026b6:	48 89 da             	mov    %rbx,%rdx
+  8026b9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026be:	4c 89 e7             	mov    %r12,%rdi
+  8026c1:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026c4:	85 c0                	test   %eax,%eax
+  8026c6:	74 72                	je     80273a <devpipe_read+0xe1>
+            sys_yield();
+  8026c8:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026cb:	8b 03                	mov    (%rbx),%eax
+  8026cd:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026d0:	74 df                	je     8026b1 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026d2:	48 63 c8             	movslq %eax,%rcx
+  8026d5:	48 89 ca             	mov    %rcx,%rdx
+  8026d8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026dc:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026e3:	08 10 20 
+  8026e6:	48 89 d0             	mov    %rdx,%rax
+  8026e9:	48 f7 e6             	mul    %rsi
+  8026ec:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026f0:	48 89 d0             	mov    %rdx,%rax
+  8026f3:	48 c1 e0 09          	shl    $0x9,%rax
+  8026f7:	48 29 d0             	sub    %rdx,%rax
+  8026fa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802701:	00 
+  802702:	48 89 c8             	mov    %rcx,%rax
+  802705:	48 29 d0             	sub    %rdx,%rax
+  802708:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80270d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802711:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802715:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802718:	49 83 c7 01          	add    $0x1,%r15
+  80271c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802720:	75 83                	jne    8026a5 <devpipe_read+0x4c>
+    return n;
+  802722:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802726:	eb 03                	jmp    80272b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802728:	4c 89 f8             	mov    %r15,%rax
+}
+  80272b:	48 83 c4 18          	add    $0x18,%rsp
+  80272f:	5b                   	pop    %rbx
+  802730:	41 5c                	pop    %r12
+  802732:	41 5d                	pop    %r13
+  802734:	41 5e                	pop    %r14
+  802736:	41 5f                	pop    %r15
+  802738:	5d                   	pop    %rbp
+  802739:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80273a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273f:	eb ea                	jmp    80272b <devpipe_read+0xd2>
+
+0000000000802741 <pipe>:
+pipe(int pfd[2]) {
+  802741:	55                   	push   %rbp
+  802742:	48 89 e5             	mov    %rsp,%rbp
+  802745:	41 55                	push   %r13
+  802747:	41 54                	push   %r12
+  802749:	53                   	push   %rbx
+  80274a:	48 83 ec 18          	sub    $0x18,%rsp
+  80274e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802751:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802755:	48 b8 c5 0c 80 00 00 	movabs $0x800cc5,%rax
+  80275c:	00 00 00 
+  80275f:	ff d0                	call   *%rax
+  802761:	89 c3                	mov    %eax,%ebx
+  802763:	85 c0                	test   %eax,%eax
+  802765:	0f 88 a0 01 00 00    	js     80290b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80276b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802770:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802775:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802779:	bf 00 00 00 00       	mov    $0x0,%edi
+  80277e:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  802785:	00 00 00 
+  802788:	ff d0                	call   *%rax
+  80278a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80278c:	85 c0                	test   %eax,%eax
+  80278e:	0f 88 77 01 00 00    	js     80290b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802794:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802798:	48 b8 c5 0c 80 00 00 	movabs $0x800cc5,%rax
+  80279f:	00 00 00 
+  8027a2:	ff d0                	call   *%rax
+  8027a4:	89 c3                	mov    %eax,%ebx
+  8027a6:	85 c0                	test   %eax,%eax
+  8027a8:	0f 88 43 01 00 00    	js     8028f1 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027ae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027b3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027b8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c1:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  8027c8:	00 00 00 
+  8027cb:	ff d0                	call   *%rax
+  8027cd:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027cf:	85 c0                	test   %eax,%eax
+  8027d1:	0f 88 1a 01 00 00    	js     8028f1 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027d7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027db:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  8027e2:	00 00 00 
+  8027e5:	ff d0                	call   *%rax
+  8027e7:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027ea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027f4:	48 89 c6             	mov    %rax,%rsi
+  8027f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027fc:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  802803:	00 00 00 
+  802806:	ff d0                	call   *%rax
+  802808:	89 c3                	mov    %eax,%ebx
+  80280a:	85 c0                	test   %eax,%eax
+  80280c:	0f 88 c5 00 00 00    	js     8028d7 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802812:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802816:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  80281d:	00 00 00 
+  802820:	ff d0                	call   *%rax
+  802822:	48 89 c1             	mov    %rax,%rcx
+  802825:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80282b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802831:	ba 00 00 00 00       	mov    $0x0,%edx
+  802836:	4c 89 ee             	mov    %r13,%rsi
+  802839:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283e:	48 b8 e8 02 80 00 00 	movabs $0x8002e8,%rax
+  802845:	00 00 00 
+  802848:	ff d0                	call   *%rax
+  80284a:	89 c3                	mov    %eax,%ebx
+  80284c:	85 c0                	test   %eax,%eax
+  80284e:	78 6e                	js     8028be <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802850:	be 00 10 00 00       	mov    $0x1000,%esi
+  802855:	4c 89 ef             	mov    %r13,%rdi
+  802858:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  80285f:	00 00 00 
+  802862:	ff d0                	call   *%rax
+  802864:	83 f8 02             	cmp    $0x2,%eax
+  802867:	0f 85 ab 00 00 00    	jne    802918 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80286d:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  802874:	00 00 
+  802876:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80287a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80287c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802880:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802887:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80288b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80288d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802891:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802898:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80289c:	48 bb 97 0c 80 00 00 	movabs $0x800c97,%rbx
+  8028a3:	00 00 00 
+  8028a6:	ff d3                	call   *%rbx
+  8028a8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028ac:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028b0:	ff d3                	call   *%rbx
+  8028b2:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028bc:	eb 4d                	jmp    80290b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8028be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028c3:	4c 89 ee             	mov    %r13,%rsi
+  8028c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028cb:	48 b8 60 04 80 00 00 	movabs $0x800460,%rax
+  8028d2:	00 00 00 
+  8028d5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028dc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e5:	48 b8 60 04 80 00 00 	movabs $0x800460,%rax
+  8028ec:	00 00 00 
+  8028ef:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8028f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028f6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ff:	48 b8 60 04 80 00 00 	movabs $0x800460,%rax
+  802906:	00 00 00 
+  802909:	ff d0                	call   *%rax
+}
+  80290b:	89 d8                	mov    %ebx,%eax
+  80290d:	48 83 c4 18          	add    $0x18,%rsp
+  802911:	5b                   	pop    %rbx
+  802912:	41 5c                	pop    %r12
+  802914:	41 5d                	pop    %r13
+  802916:	5d                   	pop    %rbp
+  802917:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802918:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  80291f:	00 00 00 
+  802922:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  802929:	00 00 00 
+  80292c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802931:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  802938:	00 00 00 
+  80293b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802940:	49 b8 20 2f 80 00 00 	movabs $0x802f20,%r8
+  802947:	00 00 00 
+  80294a:	41 ff d0             	call   *%r8
+
+000000000080294d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80294d:	55                   	push   %rbp
+  80294e:	48 89 e5             	mov    %rsp,%rbp
+  802951:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802955:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802959:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  802960:	00 00 00 
+  802963:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802965:	85 c0                	test   %eax,%eax
+  802967:	78 35                	js     80299e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802969:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80296d:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  802974:	00 00 00 
+  802977:	ff d0                	call   *%rax
+  802979:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80297c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802981:	be 00 10 00 00       	mov    $0x1000,%esi
+  802986:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80298a:	48 b8 55 02 80 00 00 	movabs $0x800255,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+  802996:	85 c0                	test   %eax,%eax
+  802998:	0f 94 c0             	sete   %al
+  80299b:	0f b6 c0             	movzbl %al,%eax
+}
+  80299e:	c9                   	leave
+  80299f:	c3                   	ret
+
+00000000008029a0 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029a0:	48 89 f8             	mov    %rdi,%rax
+  8029a3:	48 c1 e8 27          	shr    $0x27,%rax
+  8029a7:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8029ae:	7f 00 00 
+  8029b1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029b5:	f6 c2 01             	test   $0x1,%dl
+  8029b8:	74 6d                	je     802a27 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029ba:	48 89 f8             	mov    %rdi,%rax
+  8029bd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029c1:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029c8:	7f 00 00 
+  8029cb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029cf:	f6 c2 01             	test   $0x1,%dl
+  8029d2:	74 62                	je     802a36 <get_uvpt_entry+0x96>
+  8029d4:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029db:	7f 00 00 
+  8029de:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029e2:	f6 c2 80             	test   $0x80,%dl
+  8029e5:	75 4f                	jne    802a36 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029e7:	48 89 f8             	mov    %rdi,%rax
+  8029ea:	48 c1 e8 15          	shr    $0x15,%rax
+  8029ee:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8029f5:	7f 00 00 
+  8029f8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029fc:	f6 c2 01             	test   $0x1,%dl
+  8029ff:	74 44                	je     802a45 <get_uvpt_entry+0xa5>
+  802a01:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a08:	7f 00 00 
+  802a0b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a0f:	f6 c2 80             	test   $0x80,%dl
+  802a12:	75 31                	jne    802a45 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a14:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a18:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a1f:	7f 00 00 
+  802a22:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a26:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a27:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a2e:	7f 00 00 
+  802a31:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a35:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a36:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a3d:	7f 00 00 
+  802a40:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a44:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a45:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a4c:	7f 00 00 
+  802a4f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a53:	c3                   	ret
+
+0000000000802a54 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802a54:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a57:	48 89 f9             	mov    %rdi,%rcx
+  802a5a:	48 c1 e9 27          	shr    $0x27,%rcx
+  802a5e:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802a65:	7f 00 00 
+  802a68:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802a6c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a73:	f6 c1 01             	test   $0x1,%cl
+  802a76:	0f 84 b2 00 00 00    	je     802b2e <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a7c:	48 89 f9             	mov    %rdi,%rcx
+  802a7f:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802a83:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802a8a:	7f 00 00 
+  802a8d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802a91:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a98:	40 f6 c6 01          	test   $0x1,%sil
+  802a9c:	0f 84 8c 00 00 00    	je     802b2e <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802aa2:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802aa9:	7f 00 00 
+  802aac:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802ab0:	a8 80                	test   $0x80,%al
+  802ab2:	75 7b                	jne    802b2f <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ab4:	48 89 f9             	mov    %rdi,%rcx
+  802ab7:	48 c1 e9 15          	shr    $0x15,%rcx
+  802abb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802ac2:	7f 00 00 
+  802ac5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802ac9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ad0:	40 f6 c6 01          	test   $0x1,%sil
+  802ad4:	74 58                	je     802b2e <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802ad6:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802add:	7f 00 00 
+  802ae0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802ae4:	a8 80                	test   $0x80,%al
+  802ae6:	75 6c                	jne    802b54 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802ae8:	48 89 f9             	mov    %rdi,%rcx
+  802aeb:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802aef:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802af6:	7f 00 00 
+  802af9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802afd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b04:	40 f6 c6 01          	test   $0x1,%sil
+  802b08:	74 24                	je     802b2e <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b0a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b11:	7f 00 00 
+  802b14:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b18:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b1f:	ff ff 7f 
+  802b22:	48 21 c8             	and    %rcx,%rax
+  802b25:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b2b:	48 09 d0             	or     %rdx,%rax
+}
+  802b2e:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b2f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b36:	7f 00 00 
+  802b39:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b3d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b44:	ff ff 7f 
+  802b47:	48 21 c8             	and    %rcx,%rax
+  802b4a:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802b50:	48 01 d0             	add    %rdx,%rax
+  802b53:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802b54:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b5b:	7f 00 00 
+  802b5e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b62:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b69:	ff ff 7f 
+  802b6c:	48 21 c8             	and    %rcx,%rax
+  802b6f:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802b75:	48 01 d0             	add    %rdx,%rax
+  802b78:	c3                   	ret
+
+0000000000802b79 <get_prot>:
+
+int
+get_prot(void *va) {
+  802b79:	55                   	push   %rbp
+  802b7a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b7d:	48 b8 a0 29 80 00 00 	movabs $0x8029a0,%rax
+  802b84:	00 00 00 
+  802b87:	ff d0                	call   *%rax
+  802b89:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b8c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b91:	89 c1                	mov    %eax,%ecx
+  802b93:	83 c9 04             	or     $0x4,%ecx
+  802b96:	f6 c2 01             	test   $0x1,%dl
+  802b99:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b9c:	89 c1                	mov    %eax,%ecx
+  802b9e:	83 c9 02             	or     $0x2,%ecx
+  802ba1:	f6 c2 02             	test   $0x2,%dl
+  802ba4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ba7:	89 c1                	mov    %eax,%ecx
+  802ba9:	83 c9 01             	or     $0x1,%ecx
+  802bac:	48 85 d2             	test   %rdx,%rdx
+  802baf:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bb2:	89 c1                	mov    %eax,%ecx
+  802bb4:	83 c9 40             	or     $0x40,%ecx
+  802bb7:	f6 c6 04             	test   $0x4,%dh
+  802bba:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802bbd:	5d                   	pop    %rbp
+  802bbe:	c3                   	ret
+
+0000000000802bbf <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802bbf:	55                   	push   %rbp
+  802bc0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bc3:	48 b8 a0 29 80 00 00 	movabs $0x8029a0,%rax
+  802bca:	00 00 00 
+  802bcd:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802bcf:	48 c1 e8 06          	shr    $0x6,%rax
+  802bd3:	83 e0 01             	and    $0x1,%eax
+}
+  802bd6:	5d                   	pop    %rbp
+  802bd7:	c3                   	ret
+
+0000000000802bd8 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bd8:	55                   	push   %rbp
+  802bd9:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802bdc:	48 b8 a0 29 80 00 00 	movabs $0x8029a0,%rax
+  802be3:	00 00 00 
+  802be6:	ff d0                	call   *%rax
+  802be8:	83 e0 01             	and    $0x1,%eax
+}
+  802beb:	5d                   	pop    %rbp
+  802bec:	c3                   	ret
+
+0000000000802bed <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802bed:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802bf4:	7f 00 00 
+  802bf7:	a8 01                	test   $0x1,%al
+  802bf9:	75 06                	jne    802c01 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c00:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c01:	55                   	push   %rbp
+  802c02:	48 89 e5             	mov    %rsp,%rbp
+  802c05:	41 57                	push   %r15
+  802c07:	41 56                	push   %r14
+  802c09:	41 55                	push   %r13
+  802c0b:	41 54                	push   %r12
+  802c0d:	53                   	push   %rbx
+  802c0e:	48 83 ec 18          	sub    $0x18,%rsp
+  802c12:	49 89 fe             	mov    %rdi,%r14
+  802c15:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c18:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c1f:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c20:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c27:	7f 00 00 
+  802c2a:	e9 81 00 00 00       	jmp    802cb0 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c2f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c36:	49 39 dd             	cmp    %rbx,%r13
+  802c39:	74 2b                	je     802c66 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c3b:	48 89 d8             	mov    %rbx,%rax
+  802c3e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c42:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802c46:	f6 c2 01             	test   $0x1,%dl
+  802c49:	74 e4                	je     802c2f <foreach_shared_region+0x42>
+  802c4b:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802c4f:	f6 c4 04             	test   $0x4,%ah
+  802c52:	74 db                	je     802c2f <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802c54:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802c5b:	4c 89 fa             	mov    %r15,%rdx
+  802c5e:	48 89 df             	mov    %rbx,%rdi
+  802c61:	41 ff d6             	call   *%r14
+  802c64:	eb c9                	jmp    802c2f <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802c66:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802c6d:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802c71:	74 22                	je     802c95 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802c73:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802c7a:	48 89 d8             	mov    %rbx,%rax
+  802c7d:	48 c1 e8 15          	shr    $0x15,%rax
+  802c81:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802c88:	7f 00 00 
+  802c8b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802c8f:	a8 01                	test   $0x1,%al
+  802c91:	74 d3                	je     802c66 <foreach_shared_region+0x79>
+  802c93:	eb a6                	jmp    802c3b <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c95:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802c9c:	40 
+  802c9d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802ca1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ca8:	00 00 00 
+  802cab:	48 39 c1             	cmp    %rax,%rcx
+  802cae:	74 31                	je     802ce1 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802cb0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cb4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cb8:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802cbf:	7f 00 00 
+  802cc2:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802cc6:	a8 01                	test   $0x1,%al
+  802cc8:	74 cb                	je     802c95 <foreach_shared_region+0xa8>
+  802cca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cce:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cd5:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802cdb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802cdf:	eb 92                	jmp    802c73 <foreach_shared_region+0x86>
+}
+  802ce1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce6:	48 83 c4 18          	add    $0x18,%rsp
+  802cea:	5b                   	pop    %rbx
+  802ceb:	41 5c                	pop    %r12
+  802ced:	41 5d                	pop    %r13
+  802cef:	41 5e                	pop    %r14
+  802cf1:	41 5f                	pop    %r15
+  802cf3:	5d                   	pop    %rbp
+  802cf4:	c3                   	ret
+
+0000000000802cf5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfa:	c3                   	ret
+
+0000000000802cfb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802cfb:	55                   	push   %rbp
+  802cfc:	48 89 e5             	mov    %rsp,%rbp
+  802cff:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d02:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d09:	00 00 00 
+  802d0c:	48 b8 e8 39 80 00 00 	movabs $0x8039e8,%rax
+  802d13:	00 00 00 
+  802d16:	ff d0                	call   *%rax
+    return 0;
+}
+  802d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1d:	5d                   	pop    %rbp
+  802d1e:	c3                   	ret
+
+0000000000802d1f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d1f:	55                   	push   %rbp
+  802d20:	48 89 e5             	mov    %rsp,%rbp
+  802d23:	41 57                	push   %r15
+  802d25:	41 56                	push   %r14
+  802d27:	41 55                	push   %r13
+  802d29:	41 54                	push   %r12
+  802d2b:	53                   	push   %rbx
+  802d2c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d33:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d3a:	48 85 d2             	test   %rdx,%rdx
+  802d3d:	74 7a                	je     802db9 <devcons_write+0x9a>
+  802d3f:	49 89 d6             	mov    %rdx,%r14
+  802d42:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d48:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d4d:	49 bf 76 3d 80 00 00 	movabs $0x803d76,%r15
+  802d54:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d57:	4c 89 f3             	mov    %r14,%rbx
+  802d5a:	48 29 f3             	sub    %rsi,%rbx
+  802d5d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d62:	48 39 c3             	cmp    %rax,%rbx
+  802d65:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d69:	4c 63 eb             	movslq %ebx,%r13
+  802d6c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d73:	48 01 c6             	add    %rax,%rsi
+  802d76:	4c 89 ea             	mov    %r13,%rdx
+  802d79:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d80:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d83:	4c 89 ee             	mov    %r13,%rsi
+  802d86:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d8d:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  802d94:	00 00 00 
+  802d97:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d99:	41 01 dc             	add    %ebx,%r12d
+  802d9c:	49 63 f4             	movslq %r12d,%rsi
+  802d9f:	4c 39 f6             	cmp    %r14,%rsi
+  802da2:	72 b3                	jb     802d57 <devcons_write+0x38>
+    return res;
+  802da4:	49 63 c4             	movslq %r12d,%rax
+}
+  802da7:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802dae:	5b                   	pop    %rbx
+  802daf:	41 5c                	pop    %r12
+  802db1:	41 5d                	pop    %r13
+  802db3:	41 5e                	pop    %r14
+  802db5:	41 5f                	pop    %r15
+  802db7:	5d                   	pop    %rbp
+  802db8:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802db9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dbf:	eb e3                	jmp    802da4 <devcons_write+0x85>
+
+0000000000802dc1 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dc1:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802dc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dc9:	48 85 c0             	test   %rax,%rax
+  802dcc:	74 55                	je     802e23 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dce:	55                   	push   %rbp
+  802dcf:	48 89 e5             	mov    %rsp,%rbp
+  802dd2:	41 55                	push   %r13
+  802dd4:	41 54                	push   %r12
+  802dd6:	53                   	push   %rbx
+  802dd7:	48 83 ec 08          	sub    $0x8,%rsp
+  802ddb:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802dde:	48 bb 25 01 80 00 00 	movabs $0x800125,%rbx
+  802de5:	00 00 00 
+  802de8:	49 bc f2 01 80 00 00 	movabs $0x8001f2,%r12
+  802def:	00 00 00 
+  802df2:	eb 03                	jmp    802df7 <devcons_read+0x36>
+  802df4:	41 ff d4             	call   *%r12
+  802df7:	ff d3                	call   *%rbx
+  802df9:	85 c0                	test   %eax,%eax
+  802dfb:	74 f7                	je     802df4 <devcons_read+0x33>
+    if (c < 0) return c;
+  802dfd:	48 63 d0             	movslq %eax,%rdx
+  802e00:	78 13                	js     802e15 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e07:	83 f8 04             	cmp    $0x4,%eax
+  802e0a:	74 09                	je     802e15 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e0c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e10:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e15:	48 89 d0             	mov    %rdx,%rax
+  802e18:	48 83 c4 08          	add    $0x8,%rsp
+  802e1c:	5b                   	pop    %rbx
+  802e1d:	41 5c                	pop    %r12
+  802e1f:	41 5d                	pop    %r13
+  802e21:	5d                   	pop    %rbp
+  802e22:	c3                   	ret
+  802e23:	48 89 d0             	mov    %rdx,%rax
+  802e26:	c3                   	ret
+
+0000000000802e27 <cputchar>:
+cputchar(int ch) {
+  802e27:	55                   	push   %rbp
+  802e28:	48 89 e5             	mov    %rsp,%rbp
+  802e2b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e2f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e33:	be 01 00 00 00       	mov    $0x1,%esi
+  802e38:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e3c:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  802e43:	00 00 00 
+  802e46:	ff d0                	call   *%rax
+}
+  802e48:	c9                   	leave
+  802e49:	c3                   	ret
+
+0000000000802e4a <getchar>:
+getchar(void) {
+  802e4a:	55                   	push   %rbp
+  802e4b:	48 89 e5             	mov    %rsp,%rbp
+  802e4e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e52:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e57:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e60:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  802e67:	00 00 00 
+  802e6a:	ff d0                	call   *%rax
+  802e6c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e6e:	85 c0                	test   %eax,%eax
+  802e70:	78 06                	js     802e78 <getchar+0x2e>
+  802e72:	74 08                	je     802e7c <getchar+0x32>
+  802e74:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e78:	89 d0                	mov    %edx,%eax
+  802e7a:	c9                   	leave
+  802e7b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e7c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e81:	eb f5                	jmp    802e78 <getchar+0x2e>
+
+0000000000802e83 <iscons>:
+iscons(int fdnum) {
+  802e83:	55                   	push   %rbp
+  802e84:	48 89 e5             	mov    %rsp,%rbp
+  802e87:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e8b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e8f:	48 b8 25 0d 80 00 00 	movabs $0x800d25,%rax
+  802e96:	00 00 00 
+  802e99:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e9b:	85 c0                	test   %eax,%eax
+  802e9d:	78 18                	js     802eb7 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e9f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ea3:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802eaa:	00 00 00 
+  802ead:	8b 00                	mov    (%rax),%eax
+  802eaf:	39 02                	cmp    %eax,(%rdx)
+  802eb1:	0f 94 c0             	sete   %al
+  802eb4:	0f b6 c0             	movzbl %al,%eax
+}
+  802eb7:	c9                   	leave
+  802eb8:	c3                   	ret
+
+0000000000802eb9 <opencons>:
+opencons(void) {
+  802eb9:	55                   	push   %rbp
+  802eba:	48 89 e5             	mov    %rsp,%rbp
+  802ebd:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ec1:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ec5:	48 b8 c5 0c 80 00 00 	movabs $0x800cc5,%rax
+  802ecc:	00 00 00 
+  802ecf:	ff d0                	call   *%rax
+  802ed1:	85 c0                	test   %eax,%eax
+  802ed3:	78 49                	js     802f1e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ed5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802eda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802edf:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802ee3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee8:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  802eef:	00 00 00 
+  802ef2:	ff d0                	call   *%rax
+  802ef4:	85 c0                	test   %eax,%eax
+  802ef6:	78 26                	js     802f1e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802ef8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802efc:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802f03:	00 00 
+  802f05:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f07:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f0b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f12:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  802f19:	00 00 00 
+  802f1c:	ff d0                	call   *%rax
+}
+  802f1e:	c9                   	leave
+  802f1f:	c3                   	ret
+
+0000000000802f20 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f20:	55                   	push   %rbp
+  802f21:	48 89 e5             	mov    %rsp,%rbp
+  802f24:	41 56                	push   %r14
+  802f26:	41 55                	push   %r13
+  802f28:	41 54                	push   %r12
+  802f2a:	53                   	push   %rbx
+  802f2b:	48 83 ec 50          	sub    $0x50,%rsp
+  802f2f:	49 89 fc             	mov    %rdi,%r12
+  802f32:	41 89 f5             	mov    %esi,%r13d
+  802f35:	48 89 d3             	mov    %rdx,%rbx
+  802f38:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802f3c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802f40:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f44:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802f4b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f4f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f53:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802f57:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f5b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802f62:	00 00 00 
+  802f65:	4c 8b 30             	mov    (%rax),%r14
+  802f68:	48 b8 c1 01 80 00 00 	movabs $0x8001c1,%rax
+  802f6f:	00 00 00 
+  802f72:	ff d0                	call   *%rax
+  802f74:	89 c6                	mov    %eax,%esi
+  802f76:	45 89 e8             	mov    %r13d,%r8d
+  802f79:	4c 89 e1             	mov    %r12,%rcx
+  802f7c:	4c 89 f2             	mov    %r14,%rdx
+  802f7f:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802f86:	00 00 00 
+  802f89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8e:	49 bc 70 30 80 00 00 	movabs $0x803070,%r12
+  802f95:	00 00 00 
+  802f98:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802f9b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802f9f:	48 89 df             	mov    %rbx,%rdi
+  802fa2:	48 b8 0c 30 80 00 00 	movabs $0x80300c,%rax
+  802fa9:	00 00 00 
+  802fac:	ff d0                	call   *%rax
+    cprintf("\n");
+  802fae:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  802fb5:	00 00 00 
+  802fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fbd:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802fc0:	cc                   	int3
+  802fc1:	eb fd                	jmp    802fc0 <_panic+0xa0>
+
+0000000000802fc3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802fc3:	55                   	push   %rbp
+  802fc4:	48 89 e5             	mov    %rsp,%rbp
+  802fc7:	53                   	push   %rbx
+  802fc8:	48 83 ec 08          	sub    $0x8,%rsp
+  802fcc:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802fcf:	8b 06                	mov    (%rsi),%eax
+  802fd1:	8d 50 01             	lea    0x1(%rax),%edx
+  802fd4:	89 16                	mov    %edx,(%rsi)
+  802fd6:	48 98                	cltq
+  802fd8:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802fdd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802fe3:	74 0a                	je     802fef <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802fe5:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802fe9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fed:	c9                   	leave
+  802fee:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802fef:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802ff3:	be ff 00 00 00       	mov    $0xff,%esi
+  802ff8:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  802fff:	00 00 00 
+  803002:	ff d0                	call   *%rax
+        state->offset = 0;
+  803004:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80300a:	eb d9                	jmp    802fe5 <putch+0x22>
+
+000000000080300c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80300c:	55                   	push   %rbp
+  80300d:	48 89 e5             	mov    %rsp,%rbp
+  803010:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803017:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80301a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803021:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803026:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80302e:	48 89 f1             	mov    %rsi,%rcx
+  803031:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803038:	48 bf c3 2f 80 00 00 	movabs $0x802fc3,%rdi
+  80303f:	00 00 00 
+  803042:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  803049:	00 00 00 
+  80304c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80304e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803055:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80305c:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  803063:	00 00 00 
+  803066:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  803068:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80306e:	c9                   	leave
+  80306f:	c3                   	ret
+
+0000000000803070 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803070:	55                   	push   %rbp
+  803071:	48 89 e5             	mov    %rsp,%rbp
+  803074:	48 83 ec 50          	sub    $0x50,%rsp
+  803078:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80307c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803080:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803084:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803088:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80308c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803093:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803097:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80309b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80309f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8030a3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8030a7:	48 b8 0c 30 80 00 00 	movabs $0x80300c,%rax
+  8030ae:	00 00 00 
+  8030b1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8030b3:	c9                   	leave
+  8030b4:	c3                   	ret
+
+00000000008030b5 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8030b5:	55                   	push   %rbp
+  8030b6:	48 89 e5             	mov    %rsp,%rbp
+  8030b9:	41 57                	push   %r15
+  8030bb:	41 56                	push   %r14
+  8030bd:	41 55                	push   %r13
+  8030bf:	41 54                	push   %r12
+  8030c1:	53                   	push   %rbx
+  8030c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8030c6:	49 89 fc             	mov    %rdi,%r12
+  8030c9:	49 89 f5             	mov    %rsi,%r13
+  8030cc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8030d0:	8b 45 10             	mov    0x10(%rbp),%eax
+  8030d3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8030d6:	41 89 cf             	mov    %ecx,%r15d
+  8030d9:	4c 39 fa             	cmp    %r15,%rdx
+  8030dc:	73 5b                	jae    803139 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8030de:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8030e2:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8030e6:	85 db                	test   %ebx,%ebx
+  8030e8:	7e 0e                	jle    8030f8 <print_num+0x43>
+            putch(padc, put_arg);
+  8030ea:	4c 89 ee             	mov    %r13,%rsi
+  8030ed:	44 89 f7             	mov    %r14d,%edi
+  8030f0:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8030f3:	83 eb 01             	sub    $0x1,%ebx
+  8030f6:	75 f2                	jne    8030ea <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8030f8:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8030fc:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  803103:	00 00 00 
+  803106:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  80310d:	00 00 00 
+  803110:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803114:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80311d:	49 f7 f7             	div    %r15
+  803120:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803124:	4c 89 ee             	mov    %r13,%rsi
+  803127:	41 ff d4             	call   *%r12
+}
+  80312a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80312e:	5b                   	pop    %rbx
+  80312f:	41 5c                	pop    %r12
+  803131:	41 5d                	pop    %r13
+  803133:	41 5e                	pop    %r14
+  803135:	41 5f                	pop    %r15
+  803137:	5d                   	pop    %rbp
+  803138:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803139:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80313d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803142:	49 f7 f7             	div    %r15
+  803145:	48 83 ec 08          	sub    $0x8,%rsp
+  803149:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80314d:	52                   	push   %rdx
+  80314e:	45 0f be c9          	movsbl %r9b,%r9d
+  803152:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803156:	48 89 c2             	mov    %rax,%rdx
+  803159:	48 b8 b5 30 80 00 00 	movabs $0x8030b5,%rax
+  803160:	00 00 00 
+  803163:	ff d0                	call   *%rax
+  803165:	48 83 c4 10          	add    $0x10,%rsp
+  803169:	eb 8d                	jmp    8030f8 <print_num+0x43>
+
+000000000080316b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80316b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80316f:	48 8b 06             	mov    (%rsi),%rax
+  803172:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  803176:	73 0a                	jae    803182 <sprintputch+0x17>
+        *state->start++ = ch;
+  803178:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80317c:	48 89 16             	mov    %rdx,(%rsi)
+  80317f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  803182:	c3                   	ret
+
+0000000000803183 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803183:	55                   	push   %rbp
+  803184:	48 89 e5             	mov    %rsp,%rbp
+  803187:	48 83 ec 50          	sub    $0x50,%rsp
+  80318b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80318f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803193:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  803197:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80319e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031a6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031aa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8031ae:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8031b2:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  8031b9:	00 00 00 
+  8031bc:	ff d0                	call   *%rax
+}
+  8031be:	c9                   	leave
+  8031bf:	c3                   	ret
+
+00000000008031c0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8031c0:	55                   	push   %rbp
+  8031c1:	48 89 e5             	mov    %rsp,%rbp
+  8031c4:	41 57                	push   %r15
+  8031c6:	41 56                	push   %r14
+  8031c8:	41 55                	push   %r13
+  8031ca:	41 54                	push   %r12
+  8031cc:	53                   	push   %rbx
+  8031cd:	48 83 ec 38          	sub    $0x38,%rsp
+  8031d1:	49 89 fe             	mov    %rdi,%r14
+  8031d4:	49 89 f5             	mov    %rsi,%r13
+  8031d7:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8031da:	48 8b 01             	mov    (%rcx),%rax
+  8031dd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031e1:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8031e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031e9:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8031ed:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8031f1:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8031f5:	0f b6 3b             	movzbl (%rbx),%edi
+  8031f8:	40 80 ff 25          	cmp    $0x25,%dil
+  8031fc:	74 18                	je     803216 <vprintfmt+0x56>
+            if (!ch) return;
+  8031fe:	40 84 ff             	test   %dil,%dil
+  803201:	0f 84 04 07 00 00    	je     80390b <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  803207:	40 0f b6 ff          	movzbl %dil,%edi
+  80320b:	4c 89 ee             	mov    %r13,%rsi
+  80320e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803211:	4c 89 e3             	mov    %r12,%rbx
+  803214:	eb db                	jmp    8031f1 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803216:	be 00 00 00 00       	mov    $0x0,%esi
+  80321b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80321f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803224:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80322a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803231:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803235:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80323a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80323f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803242:	83 e8 23             	sub    $0x23,%eax
+  803245:	3c 57                	cmp    $0x57,%al
+  803247:	0f 87 a4 06 00 00    	ja     8038f1 <vprintfmt+0x731>
+  80324d:	0f b6 c0             	movzbl %al,%eax
+  803250:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  803257:	00 00 00 
+  80325a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80325d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803260:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803264:	eb cf                	jmp    803235 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  803266:	49 89 dc             	mov    %rbx,%r12
+  803269:	be 01 00 00 00       	mov    $0x1,%esi
+  80326e:	eb c5                	jmp    803235 <vprintfmt+0x75>
+            padc = ch;
+  803270:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  803274:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803277:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80327a:	eb b9                	jmp    803235 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80327c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80327f:	83 f8 2f             	cmp    $0x2f,%eax
+  803282:	77 24                	ja     8032a8 <vprintfmt+0xe8>
+  803284:	89 c1                	mov    %eax,%ecx
+  803286:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80328a:	83 c0 08             	add    $0x8,%eax
+  80328d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803290:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  803293:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  803296:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80329a:	79 99                	jns    803235 <vprintfmt+0x75>
+                width = precision;
+  80329c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8032a0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8032a6:	eb 8d                	jmp    803235 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032a8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032ac:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8032b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032b4:	eb da                	jmp    803290 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8032b6:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8032bb:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032bf:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8032c5:	3c 39                	cmp    $0x39,%al
+  8032c7:	77 1c                	ja     8032e5 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8032c9:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8032cd:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8032d1:	0f b6 c0             	movzbl %al,%eax
+  8032d4:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032d9:	0f b6 03             	movzbl (%rbx),%eax
+  8032dc:	3c 39                	cmp    $0x39,%al
+  8032de:	76 e9                	jbe    8032c9 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8032e0:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8032e3:	eb b1                	jmp    803296 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8032e5:	49 89 dc             	mov    %rbx,%r12
+  8032e8:	eb ac                	jmp    803296 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8032ea:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8032ed:	85 c9                	test   %ecx,%ecx
+  8032ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f4:	0f 49 c1             	cmovns %ecx,%eax
+  8032f7:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8032fa:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8032fd:	e9 33 ff ff ff       	jmp    803235 <vprintfmt+0x75>
+            lflag++;
+  803302:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803305:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803308:	e9 28 ff ff ff       	jmp    803235 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80330d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803310:	83 f8 2f             	cmp    $0x2f,%eax
+  803313:	77 19                	ja     80332e <vprintfmt+0x16e>
+  803315:	89 c2                	mov    %eax,%edx
+  803317:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80331b:	83 c0 08             	add    $0x8,%eax
+  80331e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803321:	8b 3a                	mov    (%rdx),%edi
+  803323:	4c 89 ee             	mov    %r13,%rsi
+  803326:	41 ff d6             	call   *%r14
+            break;
+  803329:	e9 c3 fe ff ff       	jmp    8031f1 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80332e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803332:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803336:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80333a:	eb e5                	jmp    803321 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80333c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80333f:	83 f8 2f             	cmp    $0x2f,%eax
+  803342:	77 5a                	ja     80339e <vprintfmt+0x1de>
+  803344:	89 c2                	mov    %eax,%edx
+  803346:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80334a:	83 c0 08             	add    $0x8,%eax
+  80334d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803350:	8b 02                	mov    (%rdx),%eax
+  803352:	89 c1                	mov    %eax,%ecx
+  803354:	f7 d9                	neg    %ecx
+  803356:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803359:	83 f9 13             	cmp    $0x13,%ecx
+  80335c:	7f 4e                	jg     8033ac <vprintfmt+0x1ec>
+  80335e:	48 63 c1             	movslq %ecx,%rax
+  803361:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  803368:	00 00 00 
+  80336b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80336f:	48 85 c0             	test   %rax,%rax
+  803372:	74 38                	je     8033ac <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803374:	48 89 c1             	mov    %rax,%rcx
+  803377:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  80337e:	00 00 00 
+  803381:	4c 89 ee             	mov    %r13,%rsi
+  803384:	4c 89 f7             	mov    %r14,%rdi
+  803387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338c:	49 b8 83 31 80 00 00 	movabs $0x803183,%r8
+  803393:	00 00 00 
+  803396:	41 ff d0             	call   *%r8
+  803399:	e9 53 fe ff ff       	jmp    8031f1 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80339e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033aa:	eb a4                	jmp    803350 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8033ac:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  8033b3:	00 00 00 
+  8033b6:	4c 89 ee             	mov    %r13,%rsi
+  8033b9:	4c 89 f7             	mov    %r14,%rdi
+  8033bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c1:	49 b8 83 31 80 00 00 	movabs $0x803183,%r8
+  8033c8:	00 00 00 
+  8033cb:	41 ff d0             	call   *%r8
+  8033ce:	e9 1e fe ff ff       	jmp    8031f1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8033d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8033d9:	77 36                	ja     803411 <vprintfmt+0x251>
+  8033db:	89 c2                	mov    %eax,%edx
+  8033dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033e1:	83 c0 08             	add    $0x8,%eax
+  8033e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033e7:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8033ea:	48 85 f6             	test   %rsi,%rsi
+  8033ed:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  8033f4:	00 00 00 
+  8033f7:	48 0f 45 c6          	cmovne %rsi,%rax
+  8033fb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8033ff:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803403:	7e 06                	jle    80340b <vprintfmt+0x24b>
+  803405:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803409:	75 14                	jne    80341f <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80340b:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80340f:	eb 5b                	jmp    80346c <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  803411:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803415:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803419:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80341d:	eb c8                	jmp    8033e7 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80341f:	49 63 f7             	movslq %r15d,%rsi
+  803422:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803426:	48 b8 c5 39 80 00 00 	movabs $0x8039c5,%rax
+  80342d:	00 00 00 
+  803430:	ff d0                	call   *%rax
+  803432:	48 89 c2             	mov    %rax,%rdx
+  803435:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803438:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80343a:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80343d:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803440:	85 c0                	test   %eax,%eax
+  803442:	7e c7                	jle    80340b <vprintfmt+0x24b>
+  803444:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803449:	4c 89 ee             	mov    %r13,%rsi
+  80344c:	44 89 e7             	mov    %r12d,%edi
+  80344f:	41 ff d6             	call   *%r14
+  803452:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803456:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803459:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80345c:	75 eb                	jne    803449 <vprintfmt+0x289>
+  80345e:	eb ab                	jmp    80340b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803460:	0f b6 f8             	movzbl %al,%edi
+  803463:	4c 89 ee             	mov    %r13,%rsi
+  803466:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  803469:	4c 89 e2             	mov    %r12,%rdx
+  80346c:	45 85 ff             	test   %r15d,%r15d
+  80346f:	78 06                	js     803477 <vprintfmt+0x2b7>
+  803471:	41 83 ef 01          	sub    $0x1,%r15d
+  803475:	78 23                	js     80349a <vprintfmt+0x2da>
+  803477:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80347b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803481:	84 c0                	test   %al,%al
+  803483:	74 15                	je     80349a <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803485:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803489:	74 d5                	je     803460 <vprintfmt+0x2a0>
+  80348b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80348e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803493:	80 fa 5e             	cmp    $0x5e,%dl
+  803496:	77 cb                	ja     803463 <vprintfmt+0x2a3>
+  803498:	eb c6                	jmp    803460 <vprintfmt+0x2a0>
+  80349a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80349d:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8034a0:	01 f0                	add    %esi,%eax
+  8034a2:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8034a4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8034a8:	85 c0                	test   %eax,%eax
+  8034aa:	0f 8e 41 fd ff ff    	jle    8031f1 <vprintfmt+0x31>
+  8034b0:	4c 89 ee             	mov    %r13,%rsi
+  8034b3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8034b8:	41 ff d6             	call   *%r14
+  8034bb:	41 83 ec 01          	sub    $0x1,%r12d
+  8034bf:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8034c3:	75 eb                	jne    8034b0 <vprintfmt+0x2f0>
+  8034c5:	e9 27 fd ff ff       	jmp    8031f1 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8034ca:	40 84 f6             	test   %sil,%sil
+  8034cd:	75 26                	jne    8034f5 <vprintfmt+0x335>
+    switch (lflag) {
+  8034cf:	85 d2                	test   %edx,%edx
+  8034d1:	74 59                	je     80352c <vprintfmt+0x36c>
+  8034d3:	83 fa 01             	cmp    $0x1,%edx
+  8034d6:	74 7b                	je     803553 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8034d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034db:	83 f8 2f             	cmp    $0x2f,%eax
+  8034de:	0f 87 96 00 00 00    	ja     80357a <vprintfmt+0x3ba>
+  8034e4:	89 c2                	mov    %eax,%edx
+  8034e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034ea:	83 c0 08             	add    $0x8,%eax
+  8034ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034f0:	4c 8b 22             	mov    (%rdx),%r12
+  8034f3:	eb 17                	jmp    80350c <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8034f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8034fb:	77 21                	ja     80351e <vprintfmt+0x35e>
+  8034fd:	89 c2                	mov    %eax,%edx
+  8034ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803503:	83 c0 08             	add    $0x8,%eax
+  803506:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803509:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80350c:	4d 85 e4             	test   %r12,%r12
+  80350f:	78 7a                	js     80358b <vprintfmt+0x3cb>
+            num = i;
+  803511:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803514:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803519:	e9 b5 02 00 00       	jmp    8037d3 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80351e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803522:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803526:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80352a:	eb dd                	jmp    803509 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  80352c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80352f:	83 f8 2f             	cmp    $0x2f,%eax
+  803532:	77 11                	ja     803545 <vprintfmt+0x385>
+  803534:	89 c2                	mov    %eax,%edx
+  803536:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80353a:	83 c0 08             	add    $0x8,%eax
+  80353d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803540:	4c 63 22             	movslq (%rdx),%r12
+  803543:	eb c7                	jmp    80350c <vprintfmt+0x34c>
+  803545:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803549:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80354d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803551:	eb ed                	jmp    803540 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  803553:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803556:	83 f8 2f             	cmp    $0x2f,%eax
+  803559:	77 11                	ja     80356c <vprintfmt+0x3ac>
+  80355b:	89 c2                	mov    %eax,%edx
+  80355d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803561:	83 c0 08             	add    $0x8,%eax
+  803564:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803567:	4c 8b 22             	mov    (%rdx),%r12
+  80356a:	eb a0                	jmp    80350c <vprintfmt+0x34c>
+  80356c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803570:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803574:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803578:	eb ed                	jmp    803567 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  80357a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80357e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803582:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803586:	e9 65 ff ff ff       	jmp    8034f0 <vprintfmt+0x330>
+                putch('-', put_arg);
+  80358b:	4c 89 ee             	mov    %r13,%rsi
+  80358e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803593:	41 ff d6             	call   *%r14
+                i = -i;
+  803596:	49 f7 dc             	neg    %r12
+  803599:	e9 73 ff ff ff       	jmp    803511 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  80359e:	40 84 f6             	test   %sil,%sil
+  8035a1:	75 32                	jne    8035d5 <vprintfmt+0x415>
+    switch (lflag) {
+  8035a3:	85 d2                	test   %edx,%edx
+  8035a5:	74 5d                	je     803604 <vprintfmt+0x444>
+  8035a7:	83 fa 01             	cmp    $0x1,%edx
+  8035aa:	0f 84 82 00 00 00    	je     803632 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8035b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8035b6:	0f 87 a5 00 00 00    	ja     803661 <vprintfmt+0x4a1>
+  8035bc:	89 c2                	mov    %eax,%edx
+  8035be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035c2:	83 c0 08             	add    $0x8,%eax
+  8035c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035c8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8035d0:	e9 fe 01 00 00       	jmp    8037d3 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8035d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8035db:	77 19                	ja     8035f6 <vprintfmt+0x436>
+  8035dd:	89 c2                	mov    %eax,%edx
+  8035df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035e3:	83 c0 08             	add    $0x8,%eax
+  8035e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035e9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8035f1:	e9 dd 01 00 00       	jmp    8037d3 <vprintfmt+0x613>
+  8035f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803602:	eb e5                	jmp    8035e9 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  803604:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803607:	83 f8 2f             	cmp    $0x2f,%eax
+  80360a:	77 18                	ja     803624 <vprintfmt+0x464>
+  80360c:	89 c2                	mov    %eax,%edx
+  80360e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803612:	83 c0 08             	add    $0x8,%eax
+  803615:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803618:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80361a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80361f:	e9 af 01 00 00       	jmp    8037d3 <vprintfmt+0x613>
+  803624:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803628:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80362c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803630:	eb e6                	jmp    803618 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  803632:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803635:	83 f8 2f             	cmp    $0x2f,%eax
+  803638:	77 19                	ja     803653 <vprintfmt+0x493>
+  80363a:	89 c2                	mov    %eax,%edx
+  80363c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803640:	83 c0 08             	add    $0x8,%eax
+  803643:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803646:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803649:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80364e:	e9 80 01 00 00       	jmp    8037d3 <vprintfmt+0x613>
+  803653:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803657:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80365b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80365f:	eb e5                	jmp    803646 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  803661:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803665:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803669:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80366d:	e9 56 ff ff ff       	jmp    8035c8 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  803672:	40 84 f6             	test   %sil,%sil
+  803675:	75 2e                	jne    8036a5 <vprintfmt+0x4e5>
+    switch (lflag) {
+  803677:	85 d2                	test   %edx,%edx
+  803679:	0f 84 b3 00 00 00    	je     803732 <vprintfmt+0x572>
+  80367f:	83 fa 01             	cmp    $0x1,%edx
+  803682:	0f 84 d3 00 00 00    	je     80375b <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  803688:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80368b:	83 f8 2f             	cmp    $0x2f,%eax
+  80368e:	0f 87 f1 00 00 00    	ja     803785 <vprintfmt+0x5c5>
+  803694:	89 c2                	mov    %eax,%edx
+  803696:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80369a:	83 c0 08             	add    $0x8,%eax
+  80369d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036a0:	48 8b 02             	mov    (%rdx),%rax
+  8036a3:	eb 17                	jmp    8036bc <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8036ab:	77 77                	ja     803724 <vprintfmt+0x564>
+  8036ad:	89 c2                	mov    %eax,%edx
+  8036af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036b3:	83 c0 08             	add    $0x8,%eax
+  8036b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036b9:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8036bc:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036be:	83 f8 07             	cmp    $0x7,%eax
+  8036c1:	0f 8e cf 00 00 00    	jle    803796 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8036c7:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036cd:	44 89 e7             	mov    %r12d,%edi
+  8036d0:	41 c1 e4 03          	shl    $0x3,%r12d
+  8036d4:	89 d1                	mov    %edx,%ecx
+  8036d6:	8d 72 07             	lea    0x7(%rdx),%esi
+  8036d9:	85 d2                	test   %edx,%edx
+  8036db:	0f 48 d6             	cmovs  %esi,%edx
+  8036de:	c1 fa 03             	sar    $0x3,%edx
+  8036e1:	83 f9 3f             	cmp    $0x3f,%ecx
+  8036e4:	7f e7                	jg     8036cd <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8036e6:	85 ff                	test   %edi,%edi
+  8036e8:	0f 84 03 fb ff ff    	je     8031f1 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8036ee:	49 63 f4             	movslq %r12d,%rsi
+  8036f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036f6:	48 f7 f6             	div    %rsi
+  8036f9:	49 89 d7             	mov    %rdx,%r15
+  8036fc:	83 c0 30             	add    $0x30,%eax
+  8036ff:	0f be f8             	movsbl %al,%edi
+  803702:	4c 89 ee             	mov    %r13,%rsi
+  803705:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  803708:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  80370b:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  803710:	45 85 e4             	test   %r12d,%r12d
+  803713:	41 0f 49 d4          	cmovns %r12d,%edx
+  803717:	c1 fa 03             	sar    $0x3,%edx
+  80371a:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  80371d:	75 cf                	jne    8036ee <vprintfmt+0x52e>
+  80371f:	e9 cd fa ff ff       	jmp    8031f1 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  803724:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803728:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80372c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803730:	eb 87                	jmp    8036b9 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  803732:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803735:	83 f8 2f             	cmp    $0x2f,%eax
+  803738:	77 13                	ja     80374d <vprintfmt+0x58d>
+  80373a:	89 c2                	mov    %eax,%edx
+  80373c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803740:	83 c0 08             	add    $0x8,%eax
+  803743:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803746:	8b 02                	mov    (%rdx),%eax
+  803748:	e9 6f ff ff ff       	jmp    8036bc <vprintfmt+0x4fc>
+  80374d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803751:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803755:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803759:	eb eb                	jmp    803746 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  80375b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80375e:	83 f8 2f             	cmp    $0x2f,%eax
+  803761:	77 14                	ja     803777 <vprintfmt+0x5b7>
+  803763:	89 c2                	mov    %eax,%edx
+  803765:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803769:	83 c0 08             	add    $0x8,%eax
+  80376c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80376f:	48 8b 02             	mov    (%rdx),%rax
+  803772:	e9 45 ff ff ff       	jmp    8036bc <vprintfmt+0x4fc>
+  803777:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80377b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80377f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803783:	eb ea                	jmp    80376f <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  803785:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803789:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80378d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803791:	e9 0a ff ff ff       	jmp    8036a0 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  803796:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  80379c:	e9 4d ff ff ff       	jmp    8036ee <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8037a1:	4c 89 ee             	mov    %r13,%rsi
+  8037a4:	bf 30 00 00 00       	mov    $0x30,%edi
+  8037a9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8037ac:	4c 89 ee             	mov    %r13,%rsi
+  8037af:	bf 78 00 00 00       	mov    $0x78,%edi
+  8037b4:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8037b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8037bd:	77 47                	ja     803806 <vprintfmt+0x646>
+  8037bf:	89 c2                	mov    %eax,%edx
+  8037c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037c5:	83 c0 08             	add    $0x8,%eax
+  8037c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037cb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8037ce:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8037d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8037d7:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8037db:	0f 94 c0             	sete   %al
+  8037de:	0f b6 c0             	movzbl %al,%eax
+  8037e1:	50                   	push   %rax
+  8037e2:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8037e7:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8037eb:	4c 89 ee             	mov    %r13,%rsi
+  8037ee:	4c 89 f7             	mov    %r14,%rdi
+  8037f1:	48 b8 b5 30 80 00 00 	movabs $0x8030b5,%rax
+  8037f8:	00 00 00 
+  8037fb:	ff d0                	call   *%rax
+            break;
+  8037fd:	48 83 c4 10          	add    $0x10,%rsp
+  803801:	e9 eb f9 ff ff       	jmp    8031f1 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803806:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80380a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80380e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803812:	eb b7                	jmp    8037cb <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  803814:	40 84 f6             	test   %sil,%sil
+  803817:	75 2b                	jne    803844 <vprintfmt+0x684>
+    switch (lflag) {
+  803819:	85 d2                	test   %edx,%edx
+  80381b:	74 56                	je     803873 <vprintfmt+0x6b3>
+  80381d:	83 fa 01             	cmp    $0x1,%edx
+  803820:	74 7f                	je     8038a1 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  803822:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803825:	83 f8 2f             	cmp    $0x2f,%eax
+  803828:	0f 87 a2 00 00 00    	ja     8038d0 <vprintfmt+0x710>
+  80382e:	89 c2                	mov    %eax,%edx
+  803830:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803834:	83 c0 08             	add    $0x8,%eax
+  803837:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80383a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80383d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803842:	eb 8f                	jmp    8037d3 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803844:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803847:	83 f8 2f             	cmp    $0x2f,%eax
+  80384a:	77 19                	ja     803865 <vprintfmt+0x6a5>
+  80384c:	89 c2                	mov    %eax,%edx
+  80384e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803852:	83 c0 08             	add    $0x8,%eax
+  803855:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803858:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80385b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803860:	e9 6e ff ff ff       	jmp    8037d3 <vprintfmt+0x613>
+  803865:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803869:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80386d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803871:	eb e5                	jmp    803858 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  803873:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803876:	83 f8 2f             	cmp    $0x2f,%eax
+  803879:	77 18                	ja     803893 <vprintfmt+0x6d3>
+  80387b:	89 c2                	mov    %eax,%edx
+  80387d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803881:	83 c0 08             	add    $0x8,%eax
+  803884:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803887:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803889:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80388e:	e9 40 ff ff ff       	jmp    8037d3 <vprintfmt+0x613>
+  803893:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803897:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80389b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80389f:	eb e6                	jmp    803887 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8038a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8038a7:	77 19                	ja     8038c2 <vprintfmt+0x702>
+  8038a9:	89 c2                	mov    %eax,%edx
+  8038ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038af:	83 c0 08             	add    $0x8,%eax
+  8038b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038b5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038b8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8038bd:	e9 11 ff ff ff       	jmp    8037d3 <vprintfmt+0x613>
+  8038c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038ce:	eb e5                	jmp    8038b5 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  8038d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038dc:	e9 59 ff ff ff       	jmp    80383a <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8038e1:	4c 89 ee             	mov    %r13,%rsi
+  8038e4:	bf 25 00 00 00       	mov    $0x25,%edi
+  8038e9:	41 ff d6             	call   *%r14
+            break;
+  8038ec:	e9 00 f9 ff ff       	jmp    8031f1 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8038f1:	4c 89 ee             	mov    %r13,%rsi
+  8038f4:	bf 25 00 00 00       	mov    $0x25,%edi
+  8038f9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8038fc:	48 83 eb 01          	sub    $0x1,%rbx
+  803900:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803904:	75 f6                	jne    8038fc <vprintfmt+0x73c>
+  803906:	e9 e6 f8 ff ff       	jmp    8031f1 <vprintfmt+0x31>
+}
+  80390b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80390f:	5b                   	pop    %rbx
+  803910:	41 5c                	pop    %r12
+  803912:	41 5d                	pop    %r13
+  803914:	41 5e                	pop    %r14
+  803916:	41 5f                	pop    %r15
+  803918:	5d                   	pop    %rbp
+  803919:	c3                   	ret
+
+000000000080391a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80391a:	55                   	push   %rbp
+  80391b:	48 89 e5             	mov    %rsp,%rbp
+  80391e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803922:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803926:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80392b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80392f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803936:	48 85 ff             	test   %rdi,%rdi
+  803939:	74 2b                	je     803966 <vsnprintf+0x4c>
+  80393b:	48 85 f6             	test   %rsi,%rsi
+  80393e:	74 26                	je     803966 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803940:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803944:	48 bf 6b 31 80 00 00 	movabs $0x80316b,%rdi
+  80394b:	00 00 00 
+  80394e:	48 b8 c0 31 80 00 00 	movabs $0x8031c0,%rax
+  803955:	00 00 00 
+  803958:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80395a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80395e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803961:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803964:	c9                   	leave
+  803965:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803966:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80396b:	eb f7                	jmp    803964 <vsnprintf+0x4a>
+
+000000000080396d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80396d:	55                   	push   %rbp
+  80396e:	48 89 e5             	mov    %rsp,%rbp
+  803971:	48 83 ec 50          	sub    $0x50,%rsp
+  803975:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803979:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80397d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803981:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803988:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80398c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803990:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803994:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803998:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80399c:	48 b8 1a 39 80 00 00 	movabs $0x80391a,%rax
+  8039a3:	00 00 00 
+  8039a6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8039a8:	c9                   	leave
+  8039a9:	c3                   	ret
+
+00000000008039aa <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8039aa:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8039ad:	74 10                	je     8039bf <strlen+0x15>
+    size_t n = 0;
+  8039af:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8039b4:	48 83 c0 01          	add    $0x1,%rax
+  8039b8:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8039bc:	75 f6                	jne    8039b4 <strlen+0xa>
+  8039be:	c3                   	ret
+    size_t n = 0;
+  8039bf:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8039c4:	c3                   	ret
+
+00000000008039c5 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8039c5:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8039c8:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8039cd:	48 85 f6             	test   %rsi,%rsi
+  8039d0:	74 11                	je     8039e3 <strnlen+0x1e>
+  8039d2:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8039d6:	74 0c                	je     8039e4 <strnlen+0x1f>
+  8039d8:	48 83 c2 01          	add    $0x1,%rdx
+  8039dc:	48 39 d0             	cmp    %rdx,%rax
+  8039df:	75 f1                	jne    8039d2 <strnlen+0xd>
+  8039e1:	eb 04                	jmp    8039e7 <strnlen+0x22>
+  8039e3:	c3                   	ret
+  8039e4:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8039e7:	c3                   	ret
+
+00000000008039e8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8039e8:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8039eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039f0:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8039f4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8039f7:	48 83 c2 01          	add    $0x1,%rdx
+  8039fb:	84 c9                	test   %cl,%cl
+  8039fd:	75 f1                	jne    8039f0 <strcpy+0x8>
+        ;
+    return res;
+}
+  8039ff:	c3                   	ret
+
+0000000000803a00 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803a00:	55                   	push   %rbp
+  803a01:	48 89 e5             	mov    %rsp,%rbp
+  803a04:	41 54                	push   %r12
+  803a06:	53                   	push   %rbx
+  803a07:	48 89 fb             	mov    %rdi,%rbx
+  803a0a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a0d:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  803a14:	00 00 00 
+  803a17:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a19:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a1d:	4c 89 e6             	mov    %r12,%rsi
+  803a20:	48 b8 e8 39 80 00 00 	movabs $0x8039e8,%rax
+  803a27:	00 00 00 
+  803a2a:	ff d0                	call   *%rax
+    return dst;
+}
+  803a2c:	48 89 d8             	mov    %rbx,%rax
+  803a2f:	5b                   	pop    %rbx
+  803a30:	41 5c                	pop    %r12
+  803a32:	5d                   	pop    %rbp
+  803a33:	c3                   	ret
+
+0000000000803a34 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803a34:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803a37:	48 85 d2             	test   %rdx,%rdx
+  803a3a:	74 1f                	je     803a5b <strncpy+0x27>
+  803a3c:	48 01 fa             	add    %rdi,%rdx
+  803a3f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803a42:	48 83 c1 01          	add    $0x1,%rcx
+  803a46:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803a4a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803a4e:	41 80 f8 01          	cmp    $0x1,%r8b
+  803a52:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803a56:	48 39 ca             	cmp    %rcx,%rdx
+  803a59:	75 e7                	jne    803a42 <strncpy+0xe>
+    }
+    return ret;
+}
+  803a5b:	c3                   	ret
+
+0000000000803a5c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803a5c:	48 89 f8             	mov    %rdi,%rax
+  803a5f:	48 85 d2             	test   %rdx,%rdx
+  803a62:	74 24                	je     803a88 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803a64:	48 83 ea 01          	sub    $0x1,%rdx
+  803a68:	74 1b                	je     803a85 <strlcpy+0x29>
+  803a6a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803a6e:	0f b6 16             	movzbl (%rsi),%edx
+  803a71:	84 d2                	test   %dl,%dl
+  803a73:	74 10                	je     803a85 <strlcpy+0x29>
+            *dst++ = *src++;
+  803a75:	48 83 c6 01          	add    $0x1,%rsi
+  803a79:	48 83 c0 01          	add    $0x1,%rax
+  803a7d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803a80:	48 39 c8             	cmp    %rcx,%rax
+  803a83:	75 e9                	jne    803a6e <strlcpy+0x12>
+        *dst = '\0';
+  803a85:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803a88:	48 29 f8             	sub    %rdi,%rax
+}
+  803a8b:	c3                   	ret
+
+0000000000803a8c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803a8c:	0f b6 07             	movzbl (%rdi),%eax
+  803a8f:	84 c0                	test   %al,%al
+  803a91:	74 13                	je     803aa6 <strcmp+0x1a>
+  803a93:	38 06                	cmp    %al,(%rsi)
+  803a95:	75 0f                	jne    803aa6 <strcmp+0x1a>
+  803a97:	48 83 c7 01          	add    $0x1,%rdi
+  803a9b:	48 83 c6 01          	add    $0x1,%rsi
+  803a9f:	0f b6 07             	movzbl (%rdi),%eax
+  803aa2:	84 c0                	test   %al,%al
+  803aa4:	75 ed                	jne    803a93 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803aa6:	0f b6 c0             	movzbl %al,%eax
+  803aa9:	0f b6 16             	movzbl (%rsi),%edx
+  803aac:	29 d0                	sub    %edx,%eax
+}
+  803aae:	c3                   	ret
+
+0000000000803aaf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803aaf:	48 85 d2             	test   %rdx,%rdx
+  803ab2:	74 1f                	je     803ad3 <strncmp+0x24>
+  803ab4:	0f b6 07             	movzbl (%rdi),%eax
+  803ab7:	84 c0                	test   %al,%al
+  803ab9:	74 1e                	je     803ad9 <strncmp+0x2a>
+  803abb:	3a 06                	cmp    (%rsi),%al
+  803abd:	75 1a                	jne    803ad9 <strncmp+0x2a>
+  803abf:	48 83 c7 01          	add    $0x1,%rdi
+  803ac3:	48 83 c6 01          	add    $0x1,%rsi
+  803ac7:	48 83 ea 01          	sub    $0x1,%rdx
+  803acb:	75 e7                	jne    803ab4 <strncmp+0x5>
+
+    if (!n) return 0;
+  803acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad2:	c3                   	ret
+  803ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad8:	c3                   	ret
+  803ad9:	48 85 d2             	test   %rdx,%rdx
+  803adc:	74 09                	je     803ae7 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ade:	0f b6 07             	movzbl (%rdi),%eax
+  803ae1:	0f b6 16             	movzbl (%rsi),%edx
+  803ae4:	29 d0                	sub    %edx,%eax
+  803ae6:	c3                   	ret
+    if (!n) return 0;
+  803ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aec:	c3                   	ret
+
+0000000000803aed <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803aed:	0f b6 17             	movzbl (%rdi),%edx
+  803af0:	84 d2                	test   %dl,%dl
+  803af2:	74 18                	je     803b0c <strchr+0x1f>
+        if (*str == c) {
+  803af4:	0f be d2             	movsbl %dl,%edx
+  803af7:	39 f2                	cmp    %esi,%edx
+  803af9:	74 17                	je     803b12 <strchr+0x25>
+    for (; *str; str++) {
+  803afb:	48 83 c7 01          	add    $0x1,%rdi
+  803aff:	0f b6 17             	movzbl (%rdi),%edx
+  803b02:	84 d2                	test   %dl,%dl
+  803b04:	75 ee                	jne    803af4 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b06:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0b:	c3                   	ret
+  803b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b11:	c3                   	ret
+  803b12:	48 89 f8             	mov    %rdi,%rax
+}
+  803b15:	c3                   	ret
+
+0000000000803b16 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b16:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b19:	0f b6 17             	movzbl (%rdi),%edx
+  803b1c:	84 d2                	test   %dl,%dl
+  803b1e:	74 13                	je     803b33 <strfind+0x1d>
+  803b20:	0f be d2             	movsbl %dl,%edx
+  803b23:	39 f2                	cmp    %esi,%edx
+  803b25:	74 0b                	je     803b32 <strfind+0x1c>
+  803b27:	48 83 c0 01          	add    $0x1,%rax
+  803b2b:	0f b6 10             	movzbl (%rax),%edx
+  803b2e:	84 d2                	test   %dl,%dl
+  803b30:	75 ee                	jne    803b20 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803b32:	c3                   	ret
+  803b33:	c3                   	ret
+
+0000000000803b34 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803b34:	55                   	push   %rbp
+  803b35:	48 89 e5             	mov    %rsp,%rbp
+  803b38:	41 57                	push   %r15
+  803b3a:	41 56                	push   %r14
+  803b3c:	41 55                	push   %r13
+  803b3e:	41 54                	push   %r12
+  803b40:	53                   	push   %rbx
+  803b41:	48 83 ec 08          	sub    $0x8,%rsp
+  803b45:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803b48:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803b4c:	45 84 ed             	test   %r13b,%r13b
+  803b4f:	75 12                	jne    803b63 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803b51:	4c 89 f8             	mov    %r15,%rax
+  803b54:	48 83 c4 08          	add    $0x8,%rsp
+  803b58:	5b                   	pop    %rbx
+  803b59:	41 5c                	pop    %r12
+  803b5b:	41 5d                	pop    %r13
+  803b5d:	41 5e                	pop    %r14
+  803b5f:	41 5f                	pop    %r15
+  803b61:	5d                   	pop    %rbp
+  803b62:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803b63:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803b67:	4c 89 e7             	mov    %r12,%rdi
+  803b6a:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  803b71:	00 00 00 
+  803b74:	ff d0                	call   *%rax
+  803b76:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803b79:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803b7d:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803b81:	49 bf af 3a 80 00 00 	movabs $0x803aaf,%r15
+  803b88:	00 00 00 
+				if ((sc = *s++) == 0)
+  803b8b:	84 c0                	test   %al,%al
+  803b8d:	75 14                	jne    803ba3 <strstr+0x6f>
+					return NULL;
+  803b8f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803b95:	eb ba                	jmp    803b51 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803b97:	48 83 c3 01          	add    $0x1,%rbx
+  803b9b:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803b9f:	84 c0                	test   %al,%al
+  803ba1:	74 1b                	je     803bbe <strstr+0x8a>
+			} while (sc != c);
+  803ba3:	41 38 c5             	cmp    %al,%r13b
+  803ba6:	75 ef                	jne    803b97 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803ba8:	4c 89 f2             	mov    %r14,%rdx
+  803bab:	4c 89 e6             	mov    %r12,%rsi
+  803bae:	48 89 df             	mov    %rbx,%rdi
+  803bb1:	41 ff d7             	call   *%r15
+  803bb4:	85 c0                	test   %eax,%eax
+  803bb6:	75 df                	jne    803b97 <strstr+0x63>
+  803bb8:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803bbc:	eb 93                	jmp    803b51 <strstr+0x1d>
+					return NULL;
+  803bbe:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bc4:	eb 8b                	jmp    803b51 <strstr+0x1d>
+
+0000000000803bc6 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803bc6:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803bc8:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803bcb:	8d 57 20             	lea    0x20(%rdi),%edx
+  803bce:	83 f9 1a             	cmp    $0x1a,%ecx
+  803bd1:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803bd4:	c3                   	ret
+
+0000000000803bd5 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803bd5:	55                   	push   %rbp
+  803bd6:	48 89 e5             	mov    %rsp,%rbp
+  803bd9:	41 57                	push   %r15
+  803bdb:	41 56                	push   %r14
+  803bdd:	41 55                	push   %r13
+  803bdf:	41 54                	push   %r12
+  803be1:	53                   	push   %rbx
+  803be2:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803be6:	48 39 f7             	cmp    %rsi,%rdi
+  803be9:	74 49                	je     803c34 <strcasecmp+0x5f>
+  803beb:	49 89 fd             	mov    %rdi,%r13
+  803bee:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803bf1:	49 bf c6 3b 80 00 00 	movabs $0x803bc6,%r15
+  803bf8:	00 00 00 
+  803bfb:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803c00:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c04:	41 ff d7             	call   *%r15
+  803c07:	89 c3                	mov    %eax,%ebx
+  803c09:	49 83 c4 01          	add    $0x1,%r12
+  803c0d:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c13:	41 ff d7             	call   *%r15
+  803c16:	29 c3                	sub    %eax,%ebx
+  803c18:	75 09                	jne    803c23 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c1a:	49 83 c5 01          	add    $0x1,%r13
+  803c1e:	45 84 f6             	test   %r14b,%r14b
+  803c21:	75 d8                	jne    803bfb <strcasecmp+0x26>
+}
+  803c23:	89 d8                	mov    %ebx,%eax
+  803c25:	48 83 c4 08          	add    $0x8,%rsp
+  803c29:	5b                   	pop    %rbx
+  803c2a:	41 5c                	pop    %r12
+  803c2c:	41 5d                	pop    %r13
+  803c2e:	41 5e                	pop    %r14
+  803c30:	41 5f                	pop    %r15
+  803c32:	5d                   	pop    %rbp
+  803c33:	c3                   	ret
+        return 0;
+  803c34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c39:	eb e8                	jmp    803c23 <strcasecmp+0x4e>
+
+0000000000803c3b <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c3b:	55                   	push   %rbp
+  803c3c:	48 89 e5             	mov    %rsp,%rbp
+  803c3f:	41 57                	push   %r15
+  803c41:	41 56                	push   %r14
+  803c43:	41 55                	push   %r13
+  803c45:	41 54                	push   %r12
+  803c47:	53                   	push   %rbx
+  803c48:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803c4c:	48 85 d2             	test   %rdx,%rdx
+  803c4f:	74 4f                	je     803ca0 <strncasecmp+0x65>
+  803c51:	49 89 fc             	mov    %rdi,%r12
+  803c54:	49 89 f5             	mov    %rsi,%r13
+  803c57:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803c5b:	49 be c6 3b 80 00 00 	movabs $0x803bc6,%r14
+  803c62:	00 00 00 
+  803c65:	49 83 c4 01          	add    $0x1,%r12
+  803c69:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c6f:	41 ff d6             	call   *%r14
+  803c72:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803c74:	49 83 c5 01          	add    $0x1,%r13
+  803c78:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803c7d:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803c80:	29 c3                	sub    %eax,%ebx
+  803c82:	85 c0                	test   %eax,%eax
+  803c84:	74 09                	je     803c8f <strncasecmp+0x54>
+  803c86:	85 db                	test   %ebx,%ebx
+  803c88:	75 05                	jne    803c8f <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803c8a:	4d 39 fc             	cmp    %r15,%r12
+  803c8d:	75 d6                	jne    803c65 <strncasecmp+0x2a>
+}
+  803c8f:	89 d8                	mov    %ebx,%eax
+  803c91:	48 83 c4 08          	add    $0x8,%rsp
+  803c95:	5b                   	pop    %rbx
+  803c96:	41 5c                	pop    %r12
+  803c98:	41 5d                	pop    %r13
+  803c9a:	41 5e                	pop    %r14
+  803c9c:	41 5f                	pop    %r15
+  803c9e:	5d                   	pop    %rbp
+  803c9f:	c3                   	ret
+    int d = 0;
+  803ca0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803ca5:	eb e8                	jmp    803c8f <strncasecmp+0x54>
+
+0000000000803ca7 <toupper>:
+
+int toupper(int c) {
+  803ca7:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803ca9:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803cac:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803caf:	83 f9 1a             	cmp    $0x1a,%ecx
+  803cb2:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803cb5:	c3                   	ret
+
+0000000000803cb6 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803cb6:	83 ff 20             	cmp    $0x20,%edi
+  803cb9:	0f 94 c0             	sete   %al
+  803cbc:	0f b6 c0             	movzbl %al,%eax
+}
+  803cbf:	c3                   	ret
+
+0000000000803cc0 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803cc0:	89 f8                	mov    %edi,%eax
+  803cc2:	f7 d8                	neg    %eax
+  803cc4:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803cc7:	c3                   	ret
+
+0000000000803cc8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803cc8:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803ccb:	48 89 f8             	mov    %rdi,%rax
+  803cce:	48 f7 d8             	neg    %rax
+  803cd1:	83 e0 07             	and    $0x7,%eax
+  803cd4:	49 89 d1             	mov    %rdx,%r9
+  803cd7:	49 29 c1             	sub    %rax,%r9
+  803cda:	78 36                	js     803d12 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803cdc:	40 0f b6 c6          	movzbl %sil,%eax
+  803ce0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803ce7:	01 01 01 
+  803cea:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803cee:	40 f6 c7 07          	test   $0x7,%dil
+  803cf2:	75 38                	jne    803d2c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803cf4:	4c 89 c9             	mov    %r9,%rcx
+  803cf7:	48 c1 f9 03          	sar    $0x3,%rcx
+  803cfb:	74 0c                	je     803d09 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803cfd:	fc                   	cld
+  803cfe:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803d01:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d05:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d09:	4d 85 c9             	test   %r9,%r9
+  803d0c:	75 45                	jne    803d53 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d0e:	4c 89 c0             	mov    %r8,%rax
+  803d11:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d12:	48 85 d2             	test   %rdx,%rdx
+  803d15:	74 f7                	je     803d0e <memset+0x46>
+  803d17:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d1a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d1d:	48 83 c0 01          	add    $0x1,%rax
+  803d21:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d25:	48 39 c2             	cmp    %rax,%rdx
+  803d28:	75 f3                	jne    803d1d <memset+0x55>
+  803d2a:	eb e2                	jmp    803d0e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d2c:	40 f6 c7 01          	test   $0x1,%dil
+  803d30:	74 06                	je     803d38 <memset+0x70>
+  803d32:	88 07                	mov    %al,(%rdi)
+  803d34:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d38:	40 f6 c7 02          	test   $0x2,%dil
+  803d3c:	74 07                	je     803d45 <memset+0x7d>
+  803d3e:	66 89 07             	mov    %ax,(%rdi)
+  803d41:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d45:	40 f6 c7 04          	test   $0x4,%dil
+  803d49:	74 a9                	je     803cf4 <memset+0x2c>
+  803d4b:	89 07                	mov    %eax,(%rdi)
+  803d4d:	48 83 c7 04          	add    $0x4,%rdi
+  803d51:	eb a1                	jmp    803cf4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d53:	41 f6 c1 04          	test   $0x4,%r9b
+  803d57:	74 06                	je     803d5f <memset+0x97>
+  803d59:	89 07                	mov    %eax,(%rdi)
+  803d5b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d5f:	41 f6 c1 02          	test   $0x2,%r9b
+  803d63:	74 07                	je     803d6c <memset+0xa4>
+  803d65:	66 89 07             	mov    %ax,(%rdi)
+  803d68:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803d6c:	41 f6 c1 01          	test   $0x1,%r9b
+  803d70:	74 9c                	je     803d0e <memset+0x46>
+  803d72:	88 07                	mov    %al,(%rdi)
+  803d74:	eb 98                	jmp    803d0e <memset+0x46>
+
+0000000000803d76 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803d76:	48 89 f8             	mov    %rdi,%rax
+  803d79:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803d7c:	48 39 fe             	cmp    %rdi,%rsi
+  803d7f:	73 3b                	jae    803dbc <memmove+0x46>
+  803d81:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803d85:	48 39 d7             	cmp    %rdx,%rdi
+  803d88:	73 32                	jae    803dbc <memmove+0x46>
+        s += n;
+        d += n;
+  803d8a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803d8e:	48 89 d6             	mov    %rdx,%rsi
+  803d91:	48 09 fe             	or     %rdi,%rsi
+  803d94:	48 09 ce             	or     %rcx,%rsi
+  803d97:	40 f6 c6 07          	test   $0x7,%sil
+  803d9b:	75 12                	jne    803daf <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803d9d:	48 83 ef 08          	sub    $0x8,%rdi
+  803da1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803da5:	48 c1 e9 03          	shr    $0x3,%rcx
+  803da9:	fd                   	std
+  803daa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803dad:	fc                   	cld
+  803dae:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803daf:	48 83 ef 01          	sub    $0x1,%rdi
+  803db3:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803db7:	fd                   	std
+  803db8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803dba:	eb f1                	jmp    803dad <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803dbc:	48 89 f2             	mov    %rsi,%rdx
+  803dbf:	48 09 c2             	or     %rax,%rdx
+  803dc2:	48 09 ca             	or     %rcx,%rdx
+  803dc5:	f6 c2 07             	test   $0x7,%dl
+  803dc8:	75 0c                	jne    803dd6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803dca:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dce:	48 89 c7             	mov    %rax,%rdi
+  803dd1:	fc                   	cld
+  803dd2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803dd5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803dd6:	48 89 c7             	mov    %rax,%rdi
+  803dd9:	fc                   	cld
+  803dda:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803ddc:	c3                   	ret
+
+0000000000803ddd <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803ddd:	55                   	push   %rbp
+  803dde:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803de1:	48 b8 76 3d 80 00 00 	movabs $0x803d76,%rax
+  803de8:	00 00 00 
+  803deb:	ff d0                	call   *%rax
+}
+  803ded:	5d                   	pop    %rbp
+  803dee:	c3                   	ret
+
+0000000000803def <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803def:	55                   	push   %rbp
+  803df0:	48 89 e5             	mov    %rsp,%rbp
+  803df3:	41 57                	push   %r15
+  803df5:	41 56                	push   %r14
+  803df7:	41 55                	push   %r13
+  803df9:	41 54                	push   %r12
+  803dfb:	53                   	push   %rbx
+  803dfc:	48 83 ec 08          	sub    $0x8,%rsp
+  803e00:	49 89 fe             	mov    %rdi,%r14
+  803e03:	49 89 f7             	mov    %rsi,%r15
+  803e06:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e09:	48 89 f7             	mov    %rsi,%rdi
+  803e0c:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  803e13:	00 00 00 
+  803e16:	ff d0                	call   *%rax
+  803e18:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e1b:	48 89 de             	mov    %rbx,%rsi
+  803e1e:	4c 89 f7             	mov    %r14,%rdi
+  803e21:	48 b8 c5 39 80 00 00 	movabs $0x8039c5,%rax
+  803e28:	00 00 00 
+  803e2b:	ff d0                	call   *%rax
+  803e2d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e30:	48 39 c3             	cmp    %rax,%rbx
+  803e33:	74 36                	je     803e6b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e35:	48 89 d8             	mov    %rbx,%rax
+  803e38:	4c 29 e8             	sub    %r13,%rax
+  803e3b:	49 39 c4             	cmp    %rax,%r12
+  803e3e:	73 31                	jae    803e71 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803e40:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803e45:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e49:	4c 89 fe             	mov    %r15,%rsi
+  803e4c:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  803e53:	00 00 00 
+  803e56:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803e58:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803e5c:	48 83 c4 08          	add    $0x8,%rsp
+  803e60:	5b                   	pop    %rbx
+  803e61:	41 5c                	pop    %r12
+  803e63:	41 5d                	pop    %r13
+  803e65:	41 5e                	pop    %r14
+  803e67:	41 5f                	pop    %r15
+  803e69:	5d                   	pop    %rbp
+  803e6a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e6b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803e6f:	eb eb                	jmp    803e5c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803e71:	48 83 eb 01          	sub    $0x1,%rbx
+  803e75:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e79:	48 89 da             	mov    %rbx,%rdx
+  803e7c:	4c 89 fe             	mov    %r15,%rsi
+  803e7f:	48 b8 dd 3d 80 00 00 	movabs $0x803ddd,%rax
+  803e86:	00 00 00 
+  803e89:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803e8b:	49 01 de             	add    %rbx,%r14
+  803e8e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803e93:	eb c3                	jmp    803e58 <strlcat+0x69>
+
+0000000000803e95 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803e95:	48 85 d2             	test   %rdx,%rdx
+  803e98:	74 2d                	je     803ec7 <memcmp+0x32>
+  803e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803e9f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803ea3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803ea8:	44 38 c1             	cmp    %r8b,%cl
+  803eab:	75 0f                	jne    803ebc <memcmp+0x27>
+    while (n-- > 0) {
+  803ead:	48 83 c0 01          	add    $0x1,%rax
+  803eb1:	48 39 c2             	cmp    %rax,%rdx
+  803eb4:	75 e9                	jne    803e9f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ebb:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803ebc:	0f b6 c1             	movzbl %cl,%eax
+  803ebf:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803ec3:	44 29 c0             	sub    %r8d,%eax
+  803ec6:	c3                   	ret
+    return 0;
+  803ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ecc:	c3                   	ret
+
+0000000000803ecd <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803ecd:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803ed1:	48 39 c7             	cmp    %rax,%rdi
+  803ed4:	73 0f                	jae    803ee5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803ed6:	40 38 37             	cmp    %sil,(%rdi)
+  803ed9:	74 0e                	je     803ee9 <memfind+0x1c>
+    for (; src < end; src++) {
+  803edb:	48 83 c7 01          	add    $0x1,%rdi
+  803edf:	48 39 f8             	cmp    %rdi,%rax
+  803ee2:	75 f2                	jne    803ed6 <memfind+0x9>
+  803ee4:	c3                   	ret
+  803ee5:	48 89 f8             	mov    %rdi,%rax
+  803ee8:	c3                   	ret
+  803ee9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803eec:	c3                   	ret
+
+0000000000803eed <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803eed:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803ef0:	0f b6 37             	movzbl (%rdi),%esi
+  803ef3:	40 80 fe 20          	cmp    $0x20,%sil
+  803ef7:	74 06                	je     803eff <strtol+0x12>
+  803ef9:	40 80 fe 09          	cmp    $0x9,%sil
+  803efd:	75 13                	jne    803f12 <strtol+0x25>
+  803eff:	48 83 c7 01          	add    $0x1,%rdi
+  803f03:	0f b6 37             	movzbl (%rdi),%esi
+  803f06:	40 80 fe 20          	cmp    $0x20,%sil
+  803f0a:	74 f3                	je     803eff <strtol+0x12>
+  803f0c:	40 80 fe 09          	cmp    $0x9,%sil
+  803f10:	74 ed                	je     803eff <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f12:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f15:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f18:	3c 01                	cmp    $0x1,%al
+  803f1a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f1e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f24:	75 0f                	jne    803f35 <strtol+0x48>
+  803f26:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f29:	74 14                	je     803f3f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f2b:	85 d2                	test   %edx,%edx
+  803f2d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f32:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f35:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803f3a:	4c 63 ca             	movslq %edx,%r9
+  803f3d:	eb 36                	jmp    803f75 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f3f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803f43:	74 0f                	je     803f54 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803f45:	85 d2                	test   %edx,%edx
+  803f47:	75 ec                	jne    803f35 <strtol+0x48>
+        s++;
+  803f49:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803f4d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803f52:	eb e1                	jmp    803f35 <strtol+0x48>
+        s += 2;
+  803f54:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803f58:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803f5d:	eb d6                	jmp    803f35 <strtol+0x48>
+            dig -= '0';
+  803f5f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803f62:	44 0f b6 c1          	movzbl %cl,%r8d
+  803f66:	41 39 d0             	cmp    %edx,%r8d
+  803f69:	7d 21                	jge    803f8c <strtol+0x9f>
+        val = val * base + dig;
+  803f6b:	49 0f af c1          	imul   %r9,%rax
+  803f6f:	0f b6 c9             	movzbl %cl,%ecx
+  803f72:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803f75:	48 83 c7 01          	add    $0x1,%rdi
+  803f79:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803f7d:	80 f9 39             	cmp    $0x39,%cl
+  803f80:	76 dd                	jbe    803f5f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803f82:	80 f9 7b             	cmp    $0x7b,%cl
+  803f85:	77 05                	ja     803f8c <strtol+0x9f>
+            dig -= 'a' - 10;
+  803f87:	83 e9 57             	sub    $0x57,%ecx
+  803f8a:	eb d6                	jmp    803f62 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803f8c:	4d 85 d2             	test   %r10,%r10
+  803f8f:	74 03                	je     803f94 <strtol+0xa7>
+  803f91:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803f94:	48 89 c2             	mov    %rax,%rdx
+  803f97:	48 f7 da             	neg    %rdx
+  803f9a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803f9e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803fa2:	c3                   	ret
+
+0000000000803fa3 <atoi>:
+int atoi(const char *str) {
+  803fa3:	55                   	push   %rbp
+  803fa4:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  803fa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fac:	be 00 00 00 00       	mov    $0x0,%esi
+  803fb1:	48 b8 ed 3e 80 00 00 	movabs $0x803eed,%rax
+  803fb8:	00 00 00 
+  803fbb:	ff d0                	call   *%rax
+}
+  803fbd:	5d                   	pop    %rbp
+  803fbe:	c3                   	ret
+
+0000000000803fbf <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fbf:	55                   	push   %rbp
+  803fc0:	48 89 e5             	mov    %rsp,%rbp
+  803fc3:	41 55                	push   %r13
+  803fc5:	41 54                	push   %r12
+  803fc7:	53                   	push   %rbx
+  803fc8:	48 83 ec 08          	sub    $0x8,%rsp
+  803fcc:	49 89 fc             	mov    %rdi,%r12
+  803fcf:	48 89 f7             	mov    %rsi,%rdi
+  803fd2:	48 89 d3             	mov    %rdx,%rbx
+  803fd5:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803fd8:	48 85 f6             	test   %rsi,%rsi
+  803fdb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fe2:	00 00 00 
+  803fe5:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  803fe9:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fee:	48 85 d2             	test   %rdx,%rdx
+  803ff1:	74 03                	je     803ff6 <ipc_recv+0x37>
+  803ff3:	48 8b 32             	mov    (%rdx),%rsi
+  803ff6:	48 b8 2e 06 80 00 00 	movabs $0x80062e,%rax
+  803ffd:	00 00 00 
+  804000:	ff d0                	call   *%rax
+    if (errno) {
+  804002:	85 c0                	test   %eax,%eax
+  804004:	74 1c                	je     804022 <ipc_recv+0x63>
+        if (from_env_store)
+  804006:	4d 85 e4             	test   %r12,%r12
+  804009:	74 08                	je     804013 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80400b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804012:	00 
+
+        if (perm_store)
+  804013:	4d 85 ed             	test   %r13,%r13
+  804016:	74 74                	je     80408c <ipc_recv+0xcd>
+            *perm_store = 0;
+  804018:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80401f:	00 
+  804020:	eb 6a                	jmp    80408c <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804022:	4d 85 e4             	test   %r12,%r12
+  804025:	74 14                	je     80403b <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804027:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80402e:	00 00 00 
+  804031:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804037:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80403b:	48 85 db             	test   %rbx,%rbx
+  80403e:	74 23                	je     804063 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804040:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804047:	00 00 00 
+  80404a:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804050:	ba 00 00 00 00       	mov    $0x0,%edx
+  804055:	85 c9                	test   %ecx,%ecx
+  804057:	74 07                	je     804060 <ipc_recv+0xa1>
+  804059:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804060:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804063:	4d 85 ed             	test   %r13,%r13
+  804066:	74 14                	je     80407c <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804068:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80406f:	00 00 00 
+  804072:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804078:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  80407c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804083:	00 00 00 
+  804086:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  80408c:	48 83 c4 08          	add    $0x8,%rsp
+  804090:	5b                   	pop    %rbx
+  804091:	41 5c                	pop    %r12
+  804093:	41 5d                	pop    %r13
+  804095:	5d                   	pop    %rbp
+  804096:	c3                   	ret
+
+0000000000804097 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804097:	55                   	push   %rbp
+  804098:	48 89 e5             	mov    %rsp,%rbp
+  80409b:	41 55                	push   %r13
+  80409d:	41 54                	push   %r12
+  80409f:	53                   	push   %rbx
+  8040a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8040a4:	49 89 fc             	mov    %rdi,%r12
+  8040a7:	48 89 f7             	mov    %rsi,%rdi
+  8040aa:	48 89 d3             	mov    %rdx,%rbx
+  8040ad:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040b0:	48 85 f6             	test   %rsi,%rsi
+  8040b3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040ba:	00 00 00 
+  8040bd:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040c1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040c6:	48 85 d2             	test   %rdx,%rdx
+  8040c9:	74 03                	je     8040ce <ipc_try_recv+0x37>
+  8040cb:	48 8b 32             	mov    (%rdx),%rsi
+  8040ce:	48 b8 97 06 80 00 00 	movabs $0x800697,%rax
+  8040d5:	00 00 00 
+  8040d8:	ff d0                	call   *%rax
+    if (errno) {
+  8040da:	85 c0                	test   %eax,%eax
+  8040dc:	75 75                	jne    804153 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8040de:	4d 85 e4             	test   %r12,%r12
+  8040e1:	74 14                	je     8040f7 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8040e3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040ea:	00 00 00 
+  8040ed:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8040f3:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8040f7:	48 85 db             	test   %rbx,%rbx
+  8040fa:	74 23                	je     80411f <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8040fc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804103:	00 00 00 
+  804106:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80410c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804111:	85 c9                	test   %ecx,%ecx
+  804113:	74 07                	je     80411c <ipc_try_recv+0x85>
+  804115:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80411c:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80411f:	4d 85 ed             	test   %r13,%r13
+  804122:	74 14                	je     804138 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804124:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80412b:	00 00 00 
+  80412e:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804134:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804138:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80413f:	00 00 00 
+  804142:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804148:	48 83 c4 08          	add    $0x8,%rsp
+  80414c:	5b                   	pop    %rbx
+  80414d:	41 5c                	pop    %r12
+  80414f:	41 5d                	pop    %r13
+  804151:	5d                   	pop    %rbp
+  804152:	c3                   	ret
+        if (from_env_store)
+  804153:	4d 85 e4             	test   %r12,%r12
+  804156:	74 08                	je     804160 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804158:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80415f:	00 
+        if (perm_store)
+  804160:	4d 85 ed             	test   %r13,%r13
+  804163:	74 e3                	je     804148 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804165:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80416c:	00 
+  80416d:	eb d9                	jmp    804148 <ipc_try_recv+0xb1>
+
+000000000080416f <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80416f:	55                   	push   %rbp
+  804170:	48 89 e5             	mov    %rsp,%rbp
+  804173:	41 57                	push   %r15
+  804175:	41 56                	push   %r14
+  804177:	41 55                	push   %r13
+  804179:	41 54                	push   %r12
+  80417b:	53                   	push   %rbx
+  80417c:	48 83 ec 18          	sub    $0x18,%rsp
+  804180:	41 89 fd             	mov    %edi,%r13d
+  804183:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804186:	48 89 d3             	mov    %rdx,%rbx
+  804189:	49 89 cc             	mov    %rcx,%r12
+  80418c:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804190:	48 85 d2             	test   %rdx,%rdx
+  804193:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80419a:	00 00 00 
+  80419d:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041a1:	49 be 02 06 80 00 00 	movabs $0x800602,%r14
+  8041a8:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041ab:	49 bf f2 01 80 00 00 	movabs $0x8001f2,%r15
+  8041b2:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041b5:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041b8:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041bc:	4c 89 e1             	mov    %r12,%rcx
+  8041bf:	48 89 da             	mov    %rbx,%rdx
+  8041c2:	44 89 ef             	mov    %r13d,%edi
+  8041c5:	41 ff d6             	call   *%r14
+  8041c8:	85 c0                	test   %eax,%eax
+  8041ca:	74 37                	je     804203 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041cc:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041cf:	75 05                	jne    8041d6 <ipc_send+0x67>
+        sys_yield();
+  8041d1:	41 ff d7             	call   *%r15
+  8041d4:	eb df                	jmp    8041b5 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041d6:	89 c1                	mov    %eax,%ecx
+  8041d8:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  8041df:	00 00 00 
+  8041e2:	be 65 00 00 00       	mov    $0x65,%esi
+  8041e7:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  8041ee:	00 00 00 
+  8041f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f6:	49 b8 20 2f 80 00 00 	movabs $0x802f20,%r8
+  8041fd:	00 00 00 
+  804200:	41 ff d0             	call   *%r8
+    }
+}
+  804203:	48 83 c4 18          	add    $0x18,%rsp
+  804207:	5b                   	pop    %rbx
+  804208:	41 5c                	pop    %r12
+  80420a:	41 5d                	pop    %r13
+  80420c:	41 5e                	pop    %r14
+  80420e:	41 5f                	pop    %r15
+  804210:	5d                   	pop    %rbp
+  804211:	c3                   	ret
+
+0000000000804212 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804212:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804217:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80421e:	00 00 00 
+  804221:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804228:	48 01 ca             	add    %rcx,%rdx
+  80422b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804231:	39 fa                	cmp    %edi,%edx
+  804233:	74 12                	je     804247 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804235:	48 83 c0 01          	add    $0x1,%rax
+  804239:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80423f:	75 e0                	jne    804221 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804241:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804246:	c3                   	ret
+            return envs[i].env_id;
+  804247:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80424e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804255:	00 00 00 
+  804258:	48 01 d0             	add    %rdx,%rax
+  80425b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804261:	c3                   	ret
+
+0000000000804262 <__text_end>:
+  804262:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804269:	00 00 00 
+  80426c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804273:	00 00 00 
+  804276:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80427d:	00 00 00 
+  804280:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804287:	00 00 00 
+  80428a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804291:	00 00 00 
+  804294:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429b:	00 00 00 
+  80429e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a5:	00 00 00 
+  8042a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042af:	00 00 00 
+  8042b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b9:	00 00 00 
+  8042bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c3:	00 00 00 
+  8042c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cd:	00 00 00 
+  8042d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d7:	00 00 00 
+  8042da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e1:	00 00 00 
+  8042e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042eb:	00 00 00 
+  8042ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f5:	00 00 00 
+  8042f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ff:	00 00 00 
+  804302:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804309:	00 00 00 
+  80430c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804313:	00 00 00 
+  804316:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431d:	00 00 00 
+  804320:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804327:	00 00 00 
+  80432a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804331:	00 00 00 
+  804334:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433b:	00 00 00 
+  80433e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804345:	00 00 00 
+  804348:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434f:	00 00 00 
+  804352:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804359:	00 00 00 
+  80435c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804363:	00 00 00 
+  804366:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436d:	00 00 00 
+  804370:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804377:	00 00 00 
+  80437a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804381:	00 00 00 
+  804384:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438b:	00 00 00 
+  80438e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804395:	00 00 00 
+  804398:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439f:	00 00 00 
+  8043a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a9:	00 00 00 
+  8043ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b3:	00 00 00 
+  8043b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bd:	00 00 00 
+  8043c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c7:	00 00 00 
+  8043ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d1:	00 00 00 
+  8043d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043db:	00 00 00 
+  8043de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e5:	00 00 00 
+  8043e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ef:	00 00 00 
+  8043f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f9:	00 00 00 
+  8043fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804403:	00 00 00 
+  804406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440d:	00 00 00 
+  804410:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804417:	00 00 00 
+  80441a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804421:	00 00 00 
+  804424:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442b:	00 00 00 
+  80442e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804435:	00 00 00 
+  804438:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443f:	00 00 00 
+  804442:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804449:	00 00 00 
+  80444c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804453:	00 00 00 
+  804456:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445d:	00 00 00 
+  804460:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804467:	00 00 00 
+  80446a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804471:	00 00 00 
+  804474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447b:	00 00 00 
+  80447e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804485:	00 00 00 
+  804488:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448f:	00 00 00 
+  804492:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804499:	00 00 00 
+  80449c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a3:	00 00 00 
+  8044a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ad:	00 00 00 
+  8044b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b7:	00 00 00 
+  8044ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c1:	00 00 00 
+  8044c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cb:	00 00 00 
+  8044ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d5:	00 00 00 
+  8044d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044df:	00 00 00 
+  8044e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e9:	00 00 00 
+  8044ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f3:	00 00 00 
+  8044f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fd:	00 00 00 
+  804500:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804507:	00 00 00 
+  80450a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804511:	00 00 00 
+  804514:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451b:	00 00 00 
+  80451e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804525:	00 00 00 
+  804528:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452f:	00 00 00 
+  804532:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804539:	00 00 00 
+  80453c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804543:	00 00 00 
+  804546:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454d:	00 00 00 
+  804550:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804557:	00 00 00 
+  80455a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804561:	00 00 00 
+  804564:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456b:	00 00 00 
+  80456e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804575:	00 00 00 
+  804578:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457f:	00 00 00 
+  804582:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804589:	00 00 00 
+  80458c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804593:	00 00 00 
+  804596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459d:	00 00 00 
+  8045a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a7:	00 00 00 
+  8045aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b1:	00 00 00 
+  8045b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bb:	00 00 00 
+  8045be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c5:	00 00 00 
+  8045c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cf:	00 00 00 
+  8045d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d9:	00 00 00 
+  8045dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e3:	00 00 00 
+  8045e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ed:	00 00 00 
+  8045f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f7:	00 00 00 
+  8045fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804601:	00 00 00 
+  804604:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460b:	00 00 00 
+  80460e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804615:	00 00 00 
+  804618:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461f:	00 00 00 
+  804622:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804629:	00 00 00 
+  80462c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804633:	00 00 00 
+  804636:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463d:	00 00 00 
+  804640:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804647:	00 00 00 
+  80464a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804651:	00 00 00 
+  804654:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465b:	00 00 00 
+  80465e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804665:	00 00 00 
+  804668:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466f:	00 00 00 
+  804672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804679:	00 00 00 
+  80467c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804683:	00 00 00 
+  804686:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468d:	00 00 00 
+  804690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804697:	00 00 00 
+  80469a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a1:	00 00 00 
+  8046a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ab:	00 00 00 
+  8046ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b5:	00 00 00 
+  8046b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bf:	00 00 00 
+  8046c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c9:	00 00 00 
+  8046cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d3:	00 00 00 
+  8046d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dd:	00 00 00 
+  8046e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e7:	00 00 00 
+  8046ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f1:	00 00 00 
+  8046f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fb:	00 00 00 
+  8046fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804705:	00 00 00 
+  804708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470f:	00 00 00 
+  804712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804719:	00 00 00 
+  80471c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804723:	00 00 00 
+  804726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472d:	00 00 00 
+  804730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804737:	00 00 00 
+  80473a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804741:	00 00 00 
+  804744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474b:	00 00 00 
+  80474e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804755:	00 00 00 
+  804758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475f:	00 00 00 
+  804762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804769:	00 00 00 
+  80476c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804773:	00 00 00 
+  804776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477d:	00 00 00 
+  804780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804787:	00 00 00 
+  80478a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804791:	00 00 00 
+  804794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479b:	00 00 00 
+  80479e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a5:	00 00 00 
+  8047a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047af:	00 00 00 
+  8047b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b9:	00 00 00 
+  8047bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c3:	00 00 00 
+  8047c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cd:	00 00 00 
+  8047d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d7:	00 00 00 
+  8047da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e1:	00 00 00 
+  8047e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047eb:	00 00 00 
+  8047ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f5:	00 00 00 
+  8047f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ff:	00 00 00 
+  804802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804809:	00 00 00 
+  80480c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804813:	00 00 00 
+  804816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481d:	00 00 00 
+  804820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804827:	00 00 00 
+  80482a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804831:	00 00 00 
+  804834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483b:	00 00 00 
+  80483e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804845:	00 00 00 
+  804848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484f:	00 00 00 
+  804852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804859:	00 00 00 
+  80485c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804863:	00 00 00 
+  804866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486d:	00 00 00 
+  804870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804877:	00 00 00 
+  80487a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804881:	00 00 00 
+  804884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488b:	00 00 00 
+  80488e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804895:	00 00 00 
+  804898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489f:	00 00 00 
+  8048a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a9:	00 00 00 
+  8048ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b3:	00 00 00 
+  8048b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bd:	00 00 00 
+  8048c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c7:	00 00 00 
+  8048ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d1:	00 00 00 
+  8048d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048db:	00 00 00 
+  8048de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e5:	00 00 00 
+  8048e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ef:	00 00 00 
+  8048f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f9:	00 00 00 
+  8048fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804903:	00 00 00 
+  804906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490d:	00 00 00 
+  804910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804917:	00 00 00 
+  80491a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804921:	00 00 00 
+  804924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492b:	00 00 00 
+  80492e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804935:	00 00 00 
+  804938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493f:	00 00 00 
+  804942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804949:	00 00 00 
+  80494c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804953:	00 00 00 
+  804956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495d:	00 00 00 
+  804960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804967:	00 00 00 
+  80496a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804971:	00 00 00 
+  804974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497b:	00 00 00 
+  80497e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804985:	00 00 00 
+  804988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498f:	00 00 00 
+  804992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804999:	00 00 00 
+  80499c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a3:	00 00 00 
+  8049a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ad:	00 00 00 
+  8049b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b7:	00 00 00 
+  8049ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c1:	00 00 00 
+  8049c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cb:	00 00 00 
+  8049ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d5:	00 00 00 
+  8049d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049df:	00 00 00 
+  8049e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e9:	00 00 00 
+  8049ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f3:	00 00 00 
+  8049f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fd:	00 00 00 
+  804a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a07:	00 00 00 
+  804a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a11:	00 00 00 
+  804a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1b:	00 00 00 
+  804a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a25:	00 00 00 
+  804a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2f:	00 00 00 
+  804a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a39:	00 00 00 
+  804a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a43:	00 00 00 
+  804a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4d:	00 00 00 
+  804a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a57:	00 00 00 
+  804a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a61:	00 00 00 
+  804a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6b:	00 00 00 
+  804a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a75:	00 00 00 
+  804a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7f:	00 00 00 
+  804a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a89:	00 00 00 
+  804a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a93:	00 00 00 
+  804a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9d:	00 00 00 
+  804aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa7:	00 00 00 
+  804aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab1:	00 00 00 
+  804ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abb:	00 00 00 
+  804abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac5:	00 00 00 
+  804ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acf:	00 00 00 
+  804ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad9:	00 00 00 
+  804adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae3:	00 00 00 
+  804ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aed:	00 00 00 
+  804af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af7:	00 00 00 
+  804afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b01:	00 00 00 
+  804b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0b:	00 00 00 
+  804b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b15:	00 00 00 
+  804b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1f:	00 00 00 
+  804b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b29:	00 00 00 
+  804b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b33:	00 00 00 
+  804b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3d:	00 00 00 
+  804b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b47:	00 00 00 
+  804b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b51:	00 00 00 
+  804b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5b:	00 00 00 
+  804b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b65:	00 00 00 
+  804b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6f:	00 00 00 
+  804b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b79:	00 00 00 
+  804b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b83:	00 00 00 
+  804b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8d:	00 00 00 
+  804b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b97:	00 00 00 
+  804b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba1:	00 00 00 
+  804ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bab:	00 00 00 
+  804bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb5:	00 00 00 
+  804bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbf:	00 00 00 
+  804bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc9:	00 00 00 
+  804bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd3:	00 00 00 
+  804bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdd:	00 00 00 
+  804be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be7:	00 00 00 
+  804bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf1:	00 00 00 
+  804bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfb:	00 00 00 
+  804bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c05:	00 00 00 
+  804c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0f:	00 00 00 
+  804c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c19:	00 00 00 
+  804c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c23:	00 00 00 
+  804c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2d:	00 00 00 
+  804c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c37:	00 00 00 
+  804c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c41:	00 00 00 
+  804c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4b:	00 00 00 
+  804c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c55:	00 00 00 
+  804c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5f:	00 00 00 
+  804c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c69:	00 00 00 
+  804c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c73:	00 00 00 
+  804c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7d:	00 00 00 
+  804c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c87:	00 00 00 
+  804c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c91:	00 00 00 
+  804c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9b:	00 00 00 
+  804c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca5:	00 00 00 
+  804ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caf:	00 00 00 
+  804cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb9:	00 00 00 
+  804cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc3:	00 00 00 
+  804cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccd:	00 00 00 
+  804cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd7:	00 00 00 
+  804cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce1:	00 00 00 
+  804ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ceb:	00 00 00 
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cff:	00 00 00 
+  804d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d09:	00 00 00 
+  804d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d13:	00 00 00 
+  804d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1d:	00 00 00 
+  804d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d27:	00 00 00 
+  804d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d31:	00 00 00 
+  804d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3b:	00 00 00 
+  804d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d45:	00 00 00 
+  804d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4f:	00 00 00 
+  804d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d59:	00 00 00 
+  804d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d63:	00 00 00 
+  804d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6d:	00 00 00 
+  804d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d77:	00 00 00 
+  804d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d81:	00 00 00 
+  804d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8b:	00 00 00 
+  804d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d95:	00 00 00 
+  804d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9f:	00 00 00 
+  804da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da9:	00 00 00 
+  804dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db3:	00 00 00 
+  804db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbd:	00 00 00 
+  804dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc7:	00 00 00 
+  804dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd1:	00 00 00 
+  804dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddb:	00 00 00 
+  804dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de5:	00 00 00 
+  804de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804def:	00 00 00 
+  804df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df9:	00 00 00 
+  804dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e03:	00 00 00 
+  804e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0d:	00 00 00 
+  804e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e17:	00 00 00 
+  804e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e21:	00 00 00 
+  804e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2b:	00 00 00 
+  804e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e35:	00 00 00 
+  804e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3f:	00 00 00 
+  804e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e49:	00 00 00 
+  804e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e53:	00 00 00 
+  804e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5d:	00 00 00 
+  804e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e67:	00 00 00 
+  804e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e71:	00 00 00 
+  804e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7b:	00 00 00 
+  804e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e85:	00 00 00 
+  804e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8f:	00 00 00 
+  804e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e99:	00 00 00 
+  804e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea3:	00 00 00 
+  804ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ead:	00 00 00 
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
@@ -0,0 +1,8104 @@
+
+obj/user/bounds:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3a 00 00 00       	call   80005d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - accessing array element with an out-of-borders index */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	48 83 ec 10          	sub    $0x10,%rsp
+    int a[4] = {0};
+    /* Trying to print the value of the fifth element of the array (which causes undefined behavior).
+     * The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable.
+     * The access operator ([]) is not used because it will trigger -Warray-bounds option of Clang,
+     * which will make this test unrunnable because of -Werror flag which is specified in GNUmakefile. */
+    cprintf("%d\n", *(a + 5));
+  80002d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800034:	00 
+  800035:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80003c:	00 
+  80003d:	8b 75 04             	mov    0x4(%rbp),%esi
+  800040:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 ba d6 01 80 00 00 	movabs $0x8001d6,%rdx
+  800056:	00 00 00 
+  800059:	ff d2                	call   *%rdx
+}
+  80005b:	c9                   	leave
+  80005c:	c3                   	ret
+
+000000000080005d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80005d:	55                   	push   %rbp
+  80005e:	48 89 e5             	mov    %rsp,%rbp
+  800061:	41 56                	push   %r14
+  800063:	41 55                	push   %r13
+  800065:	41 54                	push   %r12
+  800067:	53                   	push   %rbx
+  800068:	41 89 fd             	mov    %edi,%r13d
+  80006b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80006e:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800075:	00 00 00 
+  800078:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80007f:	00 00 00 
+  800082:	48 39 c2             	cmp    %rax,%rdx
+  800085:	73 17                	jae    80009e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800087:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008a:	49 89 c4             	mov    %rax,%r12
+  80008d:	48 83 c3 08          	add    $0x8,%rbx
+  800091:	b8 00 00 00 00       	mov    $0x0,%eax
+  800096:	ff 53 f8             	call   *-0x8(%rbx)
+  800099:	4c 39 e3             	cmp    %r12,%rbx
+  80009c:	72 ef                	jb     80008d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80009e:	48 b8 ee 11 80 00 00 	movabs $0x8011ee,%rax
+  8000a5:	00 00 00 
+  8000a8:	ff d0                	call   *%rax
+  8000aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000af:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000b6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000bd:	00 00 00 
+  8000c0:	48 01 d0             	add    %rdx,%rax
+  8000c3:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000ca:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000cd:	45 85 ed             	test   %r13d,%r13d
+  8000d0:	7e 0d                	jle    8000df <libmain+0x82>
+  8000d2:	49 8b 06             	mov    (%r14),%rax
+  8000d5:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000dc:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000df:	4c 89 f6             	mov    %r14,%rsi
+  8000e2:	44 89 ef             	mov    %r13d,%edi
+  8000e5:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ec:	00 00 00 
+  8000ef:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000f1:	48 b8 06 01 80 00 00 	movabs $0x800106,%rax
+  8000f8:	00 00 00 
+  8000fb:	ff d0                	call   *%rax
+#endif
+}
+  8000fd:	5b                   	pop    %rbx
+  8000fe:	41 5c                	pop    %r12
+  800100:	41 5d                	pop    %r13
+  800102:	41 5e                	pop    %r14
+  800104:	5d                   	pop    %rbp
+  800105:	c3                   	ret
+
+0000000000800106 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800106:	55                   	push   %rbp
+  800107:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80010a:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  800111:	00 00 00 
+  800114:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800116:	bf 00 00 00 00       	mov    $0x0,%edi
+  80011b:	48 b8 83 11 80 00 00 	movabs $0x801183,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+}
+  800127:	5d                   	pop    %rbp
+  800128:	c3                   	ret
+
+0000000000800129 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800129:	55                   	push   %rbp
+  80012a:	48 89 e5             	mov    %rsp,%rbp
+  80012d:	53                   	push   %rbx
+  80012e:	48 83 ec 08          	sub    $0x8,%rsp
+  800132:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800135:	8b 06                	mov    (%rsi),%eax
+  800137:	8d 50 01             	lea    0x1(%rax),%edx
+  80013a:	89 16                	mov    %edx,(%rsi)
+  80013c:	48 98                	cltq
+  80013e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800143:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800149:	74 0a                	je     800155 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80014b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80014f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800153:	c9                   	leave
+  800154:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800155:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800159:	be ff 00 00 00       	mov    $0xff,%esi
+  80015e:	48 b8 25 11 80 00 00 	movabs $0x801125,%rax
+  800165:	00 00 00 
+  800168:	ff d0                	call   *%rax
+        state->offset = 0;
+  80016a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800170:	eb d9                	jmp    80014b <putch+0x22>
+
+0000000000800172 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800172:	55                   	push   %rbp
+  800173:	48 89 e5             	mov    %rsp,%rbp
+  800176:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80017d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800180:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800187:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800194:	48 89 f1             	mov    %rsi,%rcx
+  800197:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80019e:	48 bf 29 01 80 00 00 	movabs $0x800129,%rdi
+  8001a5:	00 00 00 
+  8001a8:	48 b8 26 03 80 00 00 	movabs $0x800326,%rax
+  8001af:	00 00 00 
+  8001b2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001b4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001bb:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001c2:	48 b8 25 11 80 00 00 	movabs $0x801125,%rax
+  8001c9:	00 00 00 
+  8001cc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001ce:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001d4:	c9                   	leave
+  8001d5:	c3                   	ret
+
+00000000008001d6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001d6:	55                   	push   %rbp
+  8001d7:	48 89 e5             	mov    %rsp,%rbp
+  8001da:	48 83 ec 50          	sub    $0x50,%rsp
+  8001de:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001e2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001e6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001ea:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001ee:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001f2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800201:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800205:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800209:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80020d:	48 b8 72 01 80 00 00 	movabs $0x800172,%rax
+  800214:	00 00 00 
+  800217:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800219:	c9                   	leave
+  80021a:	c3                   	ret
+
+000000000080021b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80021b:	55                   	push   %rbp
+  80021c:	48 89 e5             	mov    %rsp,%rbp
+  80021f:	41 57                	push   %r15
+  800221:	41 56                	push   %r14
+  800223:	41 55                	push   %r13
+  800225:	41 54                	push   %r12
+  800227:	53                   	push   %rbx
+  800228:	48 83 ec 18          	sub    $0x18,%rsp
+  80022c:	49 89 fc             	mov    %rdi,%r12
+  80022f:	49 89 f5             	mov    %rsi,%r13
+  800232:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800236:	8b 45 10             	mov    0x10(%rbp),%eax
+  800239:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80023c:	41 89 cf             	mov    %ecx,%r15d
+  80023f:	4c 39 fa             	cmp    %r15,%rdx
+  800242:	73 5b                	jae    80029f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800244:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800248:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80024c:	85 db                	test   %ebx,%ebx
+  80024e:	7e 0e                	jle    80025e <print_num+0x43>
+            putch(padc, put_arg);
+  800250:	4c 89 ee             	mov    %r13,%rsi
+  800253:	44 89 f7             	mov    %r14d,%edi
+  800256:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800259:	83 eb 01             	sub    $0x1,%ebx
+  80025c:	75 f2                	jne    800250 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80025e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800262:	48 b9 1f 50 80 00 00 	movabs $0x80501f,%rcx
+  800269:	00 00 00 
+  80026c:	48 b8 0e 50 80 00 00 	movabs $0x80500e,%rax
+  800273:	00 00 00 
+  800276:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80027a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80027e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800283:	49 f7 f7             	div    %r15
+  800286:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80028a:	4c 89 ee             	mov    %r13,%rsi
+  80028d:	41 ff d4             	call   *%r12
+}
+  800290:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800294:	5b                   	pop    %rbx
+  800295:	41 5c                	pop    %r12
+  800297:	41 5d                	pop    %r13
+  800299:	41 5e                	pop    %r14
+  80029b:	41 5f                	pop    %r15
+  80029d:	5d                   	pop    %rbp
+  80029e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80029f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a8:	49 f7 f7             	div    %r15
+  8002ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8002af:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002b3:	52                   	push   %rdx
+  8002b4:	45 0f be c9          	movsbl %r9b,%r9d
+  8002b8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002bc:	48 89 c2             	mov    %rax,%rdx
+  8002bf:	48 b8 1b 02 80 00 00 	movabs $0x80021b,%rax
+  8002c6:	00 00 00 
+  8002c9:	ff d0                	call   *%rax
+  8002cb:	48 83 c4 10          	add    $0x10,%rsp
+  8002cf:	eb 8d                	jmp    80025e <print_num+0x43>
+
+00000000008002d1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002d1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002d5:	48 8b 06             	mov    (%rsi),%rax
+  8002d8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002dc:	73 0a                	jae    8002e8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002de:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002e2:	48 89 16             	mov    %rdx,(%rsi)
+  8002e5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002e8:	c3                   	ret
+
+00000000008002e9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002e9:	55                   	push   %rbp
+  8002ea:	48 89 e5             	mov    %rsp,%rbp
+  8002ed:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002f5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002f9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002fd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800304:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800308:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80030c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800310:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800314:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800318:	48 b8 26 03 80 00 00 	movabs $0x800326,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+}
+  800324:	c9                   	leave
+  800325:	c3                   	ret
+
+0000000000800326 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800326:	55                   	push   %rbp
+  800327:	48 89 e5             	mov    %rsp,%rbp
+  80032a:	41 57                	push   %r15
+  80032c:	41 56                	push   %r14
+  80032e:	41 55                	push   %r13
+  800330:	41 54                	push   %r12
+  800332:	53                   	push   %rbx
+  800333:	48 83 ec 38          	sub    $0x38,%rsp
+  800337:	49 89 fe             	mov    %rdi,%r14
+  80033a:	49 89 f5             	mov    %rsi,%r13
+  80033d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800340:	48 8b 01             	mov    (%rcx),%rax
+  800343:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800347:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80034b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80034f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800353:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800357:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80035b:	0f b6 3b             	movzbl (%rbx),%edi
+  80035e:	40 80 ff 25          	cmp    $0x25,%dil
+  800362:	74 18                	je     80037c <vprintfmt+0x56>
+            if (!ch) return;
+  800364:	40 84 ff             	test   %dil,%dil
+  800367:	0f 84 04 07 00 00    	je     800a71 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80036d:	40 0f b6 ff          	movzbl %dil,%edi
+  800371:	4c 89 ee             	mov    %r13,%rsi
+  800374:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800377:	4c 89 e3             	mov    %r12,%rbx
+  80037a:	eb db                	jmp    800357 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80037c:	be 00 00 00 00       	mov    $0x0,%esi
+  800381:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800385:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80038a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800390:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800397:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80039b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003a0:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003a5:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003a8:	83 e8 23             	sub    $0x23,%eax
+  8003ab:	3c 57                	cmp    $0x57,%al
+  8003ad:	0f 87 a4 06 00 00    	ja     800a57 <vprintfmt+0x731>
+  8003b3:	0f b6 c0             	movzbl %al,%eax
+  8003b6:	48 b9 a0 51 80 00 00 	movabs $0x8051a0,%rcx
+  8003bd:	00 00 00 
+  8003c0:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003c3:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003c6:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003ca:	eb cf                	jmp    80039b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003cc:	49 89 dc             	mov    %rbx,%r12
+  8003cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d4:	eb c5                	jmp    80039b <vprintfmt+0x75>
+            padc = ch;
+  8003d6:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003da:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003dd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003e0:	eb b9                	jmp    80039b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8003e8:	77 24                	ja     80040e <vprintfmt+0xe8>
+  8003ea:	89 c1                	mov    %eax,%ecx
+  8003ec:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003f0:	83 c0 08             	add    $0x8,%eax
+  8003f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003f6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003f9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003fc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800400:	79 99                	jns    80039b <vprintfmt+0x75>
+                width = precision;
+  800402:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800406:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80040c:	eb 8d                	jmp    80039b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80040e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800412:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800416:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041a:	eb da                	jmp    8003f6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80041c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800421:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800425:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80042b:	3c 39                	cmp    $0x39,%al
+  80042d:	77 1c                	ja     80044b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80042f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800433:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800437:	0f b6 c0             	movzbl %al,%eax
+  80043a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80043f:	0f b6 03             	movzbl (%rbx),%eax
+  800442:	3c 39                	cmp    $0x39,%al
+  800444:	76 e9                	jbe    80042f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800446:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800449:	eb b1                	jmp    8003fc <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80044b:	49 89 dc             	mov    %rbx,%r12
+  80044e:	eb ac                	jmp    8003fc <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800450:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800453:	85 c9                	test   %ecx,%ecx
+  800455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045a:	0f 49 c1             	cmovns %ecx,%eax
+  80045d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800460:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800463:	e9 33 ff ff ff       	jmp    80039b <vprintfmt+0x75>
+            lflag++;
+  800468:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80046b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046e:	e9 28 ff ff ff       	jmp    80039b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800473:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800476:	83 f8 2f             	cmp    $0x2f,%eax
+  800479:	77 19                	ja     800494 <vprintfmt+0x16e>
+  80047b:	89 c2                	mov    %eax,%edx
+  80047d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800481:	83 c0 08             	add    $0x8,%eax
+  800484:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800487:	8b 3a                	mov    (%rdx),%edi
+  800489:	4c 89 ee             	mov    %r13,%rsi
+  80048c:	41 ff d6             	call   *%r14
+            break;
+  80048f:	e9 c3 fe ff ff       	jmp    800357 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800494:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800498:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80049c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a0:	eb e5                	jmp    800487 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a8:	77 5a                	ja     800504 <vprintfmt+0x1de>
+  8004aa:	89 c2                	mov    %eax,%edx
+  8004ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b0:	83 c0 08             	add    $0x8,%eax
+  8004b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004b6:	8b 02                	mov    (%rdx),%eax
+  8004b8:	89 c1                	mov    %eax,%ecx
+  8004ba:	f7 d9                	neg    %ecx
+  8004bc:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004bf:	83 f9 13             	cmp    $0x13,%ecx
+  8004c2:	7f 4e                	jg     800512 <vprintfmt+0x1ec>
+  8004c4:	48 63 c1             	movslq %ecx,%rax
+  8004c7:	48 ba 60 54 80 00 00 	movabs $0x805460,%rdx
+  8004ce:	00 00 00 
+  8004d1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004d5:	48 85 c0             	test   %rax,%rax
+  8004d8:	74 38                	je     800512 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004da:	48 89 c1             	mov    %rax,%rcx
+  8004dd:	48 ba 99 56 80 00 00 	movabs $0x805699,%rdx
+  8004e4:	00 00 00 
+  8004e7:	4c 89 ee             	mov    %r13,%rsi
+  8004ea:	4c 89 f7             	mov    %r14,%rdi
+  8004ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f2:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  8004f9:	00 00 00 
+  8004fc:	41 ff d0             	call   *%r8
+  8004ff:	e9 53 fe ff ff       	jmp    800357 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800504:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800508:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	eb a4                	jmp    8004b6 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800512:	48 ba 37 50 80 00 00 	movabs $0x805037,%rdx
+  800519:	00 00 00 
+  80051c:	4c 89 ee             	mov    %r13,%rsi
+  80051f:	4c 89 f7             	mov    %r14,%rdi
+  800522:	b8 00 00 00 00       	mov    $0x0,%eax
+  800527:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  80052e:	00 00 00 
+  800531:	41 ff d0             	call   *%r8
+  800534:	e9 1e fe ff ff       	jmp    800357 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800539:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053c:	83 f8 2f             	cmp    $0x2f,%eax
+  80053f:	77 36                	ja     800577 <vprintfmt+0x251>
+  800541:	89 c2                	mov    %eax,%edx
+  800543:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800547:	83 c0 08             	add    $0x8,%eax
+  80054a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80054d:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800550:	48 85 f6             	test   %rsi,%rsi
+  800553:	48 b8 30 50 80 00 00 	movabs $0x805030,%rax
+  80055a:	00 00 00 
+  80055d:	48 0f 45 c6          	cmovne %rsi,%rax
+  800561:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800565:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800569:	7e 06                	jle    800571 <vprintfmt+0x24b>
+  80056b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80056f:	75 14                	jne    800585 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800571:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800575:	eb 5b                	jmp    8005d2 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800577:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80057b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80057f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800583:	eb c8                	jmp    80054d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800585:	49 63 f7             	movslq %r15d,%rsi
+  800588:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80058c:	48 b8 2b 0b 80 00 00 	movabs $0x800b2b,%rax
+  800593:	00 00 00 
+  800596:	ff d0                	call   *%rax
+  800598:	48 89 c2             	mov    %rax,%rdx
+  80059b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80059e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005a0:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005a3:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005a6:	85 c0                	test   %eax,%eax
+  8005a8:	7e c7                	jle    800571 <vprintfmt+0x24b>
+  8005aa:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005af:	4c 89 ee             	mov    %r13,%rsi
+  8005b2:	44 89 e7             	mov    %r12d,%edi
+  8005b5:	41 ff d6             	call   *%r14
+  8005b8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005bc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005c2:	75 eb                	jne    8005af <vprintfmt+0x289>
+  8005c4:	eb ab                	jmp    800571 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005c6:	0f b6 f8             	movzbl %al,%edi
+  8005c9:	4c 89 ee             	mov    %r13,%rsi
+  8005cc:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8005cf:	4c 89 e2             	mov    %r12,%rdx
+  8005d2:	45 85 ff             	test   %r15d,%r15d
+  8005d5:	78 06                	js     8005dd <vprintfmt+0x2b7>
+  8005d7:	41 83 ef 01          	sub    $0x1,%r15d
+  8005db:	78 23                	js     800600 <vprintfmt+0x2da>
+  8005dd:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8005e1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8005e7:	84 c0                	test   %al,%al
+  8005e9:	74 15                	je     800600 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005eb:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8005ef:	74 d5                	je     8005c6 <vprintfmt+0x2a0>
+  8005f1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8005f4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8005f9:	80 fa 5e             	cmp    $0x5e,%dl
+  8005fc:	77 cb                	ja     8005c9 <vprintfmt+0x2a3>
+  8005fe:	eb c6                	jmp    8005c6 <vprintfmt+0x2a0>
+  800600:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800603:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800606:	01 f0                	add    %esi,%eax
+  800608:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80060a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80060e:	85 c0                	test   %eax,%eax
+  800610:	0f 8e 41 fd ff ff    	jle    800357 <vprintfmt+0x31>
+  800616:	4c 89 ee             	mov    %r13,%rsi
+  800619:	bf 20 00 00 00       	mov    $0x20,%edi
+  80061e:	41 ff d6             	call   *%r14
+  800621:	41 83 ec 01          	sub    $0x1,%r12d
+  800625:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800629:	75 eb                	jne    800616 <vprintfmt+0x2f0>
+  80062b:	e9 27 fd ff ff       	jmp    800357 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800630:	40 84 f6             	test   %sil,%sil
+  800633:	75 26                	jne    80065b <vprintfmt+0x335>
+    switch (lflag) {
+  800635:	85 d2                	test   %edx,%edx
+  800637:	74 59                	je     800692 <vprintfmt+0x36c>
+  800639:	83 fa 01             	cmp    $0x1,%edx
+  80063c:	74 7b                	je     8006b9 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80063e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800641:	83 f8 2f             	cmp    $0x2f,%eax
+  800644:	0f 87 96 00 00 00    	ja     8006e0 <vprintfmt+0x3ba>
+  80064a:	89 c2                	mov    %eax,%edx
+  80064c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800650:	83 c0 08             	add    $0x8,%eax
+  800653:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800656:	4c 8b 22             	mov    (%rdx),%r12
+  800659:	eb 17                	jmp    800672 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80065b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065e:	83 f8 2f             	cmp    $0x2f,%eax
+  800661:	77 21                	ja     800684 <vprintfmt+0x35e>
+  800663:	89 c2                	mov    %eax,%edx
+  800665:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800669:	83 c0 08             	add    $0x8,%eax
+  80066c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80066f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800672:	4d 85 e4             	test   %r12,%r12
+  800675:	78 7a                	js     8006f1 <vprintfmt+0x3cb>
+            num = i;
+  800677:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80067a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80067f:	e9 b5 02 00 00       	jmp    800939 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800684:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800688:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800690:	eb dd                	jmp    80066f <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800692:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800695:	83 f8 2f             	cmp    $0x2f,%eax
+  800698:	77 11                	ja     8006ab <vprintfmt+0x385>
+  80069a:	89 c2                	mov    %eax,%edx
+  80069c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a0:	83 c0 08             	add    $0x8,%eax
+  8006a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a6:	4c 63 22             	movslq (%rdx),%r12
+  8006a9:	eb c7                	jmp    800672 <vprintfmt+0x34c>
+  8006ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b7:	eb ed                	jmp    8006a6 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8006b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bf:	77 11                	ja     8006d2 <vprintfmt+0x3ac>
+  8006c1:	89 c2                	mov    %eax,%edx
+  8006c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c7:	83 c0 08             	add    $0x8,%eax
+  8006ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006cd:	4c 8b 22             	mov    (%rdx),%r12
+  8006d0:	eb a0                	jmp    800672 <vprintfmt+0x34c>
+  8006d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006de:	eb ed                	jmp    8006cd <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8006e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ec:	e9 65 ff ff ff       	jmp    800656 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8006f1:	4c 89 ee             	mov    %r13,%rsi
+  8006f4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006f9:	41 ff d6             	call   *%r14
+                i = -i;
+  8006fc:	49 f7 dc             	neg    %r12
+  8006ff:	e9 73 ff ff ff       	jmp    800677 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800704:	40 84 f6             	test   %sil,%sil
+  800707:	75 32                	jne    80073b <vprintfmt+0x415>
+    switch (lflag) {
+  800709:	85 d2                	test   %edx,%edx
+  80070b:	74 5d                	je     80076a <vprintfmt+0x444>
+  80070d:	83 fa 01             	cmp    $0x1,%edx
+  800710:	0f 84 82 00 00 00    	je     800798 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800716:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800719:	83 f8 2f             	cmp    $0x2f,%eax
+  80071c:	0f 87 a5 00 00 00    	ja     8007c7 <vprintfmt+0x4a1>
+  800722:	89 c2                	mov    %eax,%edx
+  800724:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800728:	83 c0 08             	add    $0x8,%eax
+  80072b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800731:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800736:	e9 fe 01 00 00       	jmp    800939 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80073b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073e:	83 f8 2f             	cmp    $0x2f,%eax
+  800741:	77 19                	ja     80075c <vprintfmt+0x436>
+  800743:	89 c2                	mov    %eax,%edx
+  800745:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800749:	83 c0 08             	add    $0x8,%eax
+  80074c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800752:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800757:	e9 dd 01 00 00       	jmp    800939 <vprintfmt+0x613>
+  80075c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800760:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800764:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800768:	eb e5                	jmp    80074f <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80076a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076d:	83 f8 2f             	cmp    $0x2f,%eax
+  800770:	77 18                	ja     80078a <vprintfmt+0x464>
+  800772:	89 c2                	mov    %eax,%edx
+  800774:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800778:	83 c0 08             	add    $0x8,%eax
+  80077b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800780:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800785:	e9 af 01 00 00       	jmp    800939 <vprintfmt+0x613>
+  80078a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800792:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800796:	eb e6                	jmp    80077e <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800798:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079b:	83 f8 2f             	cmp    $0x2f,%eax
+  80079e:	77 19                	ja     8007b9 <vprintfmt+0x493>
+  8007a0:	89 c2                	mov    %eax,%edx
+  8007a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a6:	83 c0 08             	add    $0x8,%eax
+  8007a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ac:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007af:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007b4:	e9 80 01 00 00       	jmp    800939 <vprintfmt+0x613>
+  8007b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c5:	eb e5                	jmp    8007ac <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8007c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d3:	e9 56 ff ff ff       	jmp    80072e <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d8:	40 84 f6             	test   %sil,%sil
+  8007db:	75 2e                	jne    80080b <vprintfmt+0x4e5>
+    switch (lflag) {
+  8007dd:	85 d2                	test   %edx,%edx
+  8007df:	0f 84 b3 00 00 00    	je     800898 <vprintfmt+0x572>
+  8007e5:	83 fa 01             	cmp    $0x1,%edx
+  8007e8:	0f 84 d3 00 00 00    	je     8008c1 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8007ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f4:	0f 87 f1 00 00 00    	ja     8008eb <vprintfmt+0x5c5>
+  8007fa:	89 c2                	mov    %eax,%edx
+  8007fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800800:	83 c0 08             	add    $0x8,%eax
+  800803:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800806:	48 8b 02             	mov    (%rdx),%rax
+  800809:	eb 17                	jmp    800822 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  80080b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080e:	83 f8 2f             	cmp    $0x2f,%eax
+  800811:	77 77                	ja     80088a <vprintfmt+0x564>
+  800813:	89 c2                	mov    %eax,%edx
+  800815:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800819:	83 c0 08             	add    $0x8,%eax
+  80081c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081f:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800822:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800824:	83 f8 07             	cmp    $0x7,%eax
+  800827:	0f 8e cf 00 00 00    	jle    8008fc <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  80082d:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800833:	44 89 e7             	mov    %r12d,%edi
+  800836:	41 c1 e4 03          	shl    $0x3,%r12d
+  80083a:	89 d1                	mov    %edx,%ecx
+  80083c:	8d 72 07             	lea    0x7(%rdx),%esi
+  80083f:	85 d2                	test   %edx,%edx
+  800841:	0f 48 d6             	cmovs  %esi,%edx
+  800844:	c1 fa 03             	sar    $0x3,%edx
+  800847:	83 f9 3f             	cmp    $0x3f,%ecx
+  80084a:	7f e7                	jg     800833 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80084c:	85 ff                	test   %edi,%edi
+  80084e:	0f 84 03 fb ff ff    	je     800357 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800854:	49 63 f4             	movslq %r12d,%rsi
+  800857:	ba 00 00 00 00       	mov    $0x0,%edx
+  80085c:	48 f7 f6             	div    %rsi
+  80085f:	49 89 d7             	mov    %rdx,%r15
+  800862:	83 c0 30             	add    $0x30,%eax
+  800865:	0f be f8             	movsbl %al,%edi
+  800868:	4c 89 ee             	mov    %r13,%rsi
+  80086b:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80086e:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800871:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800876:	45 85 e4             	test   %r12d,%r12d
+  800879:	41 0f 49 d4          	cmovns %r12d,%edx
+  80087d:	c1 fa 03             	sar    $0x3,%edx
+  800880:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800883:	75 cf                	jne    800854 <vprintfmt+0x52e>
+  800885:	e9 cd fa ff ff       	jmp    800357 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80088a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800892:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800896:	eb 87                	jmp    80081f <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800898:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089b:	83 f8 2f             	cmp    $0x2f,%eax
+  80089e:	77 13                	ja     8008b3 <vprintfmt+0x58d>
+  8008a0:	89 c2                	mov    %eax,%edx
+  8008a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a6:	83 c0 08             	add    $0x8,%eax
+  8008a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ac:	8b 02                	mov    (%rdx),%eax
+  8008ae:	e9 6f ff ff ff       	jmp    800822 <vprintfmt+0x4fc>
+  8008b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bf:	eb eb                	jmp    8008ac <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8008c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c7:	77 14                	ja     8008dd <vprintfmt+0x5b7>
+  8008c9:	89 c2                	mov    %eax,%edx
+  8008cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cf:	83 c0 08             	add    $0x8,%eax
+  8008d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d5:	48 8b 02             	mov    (%rdx),%rax
+  8008d8:	e9 45 ff ff ff       	jmp    800822 <vprintfmt+0x4fc>
+  8008dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e9:	eb ea                	jmp    8008d5 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8008eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f7:	e9 0a ff ff ff       	jmp    800806 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8008fc:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800902:	e9 4d ff ff ff       	jmp    800854 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800907:	4c 89 ee             	mov    %r13,%rsi
+  80090a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80090f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800912:	4c 89 ee             	mov    %r13,%rsi
+  800915:	bf 78 00 00 00       	mov    $0x78,%edi
+  80091a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80091d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800920:	83 f8 2f             	cmp    $0x2f,%eax
+  800923:	77 47                	ja     80096c <vprintfmt+0x646>
+  800925:	89 c2                	mov    %eax,%edx
+  800927:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092b:	83 c0 08             	add    $0x8,%eax
+  80092e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800931:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800934:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800939:	48 83 ec 08          	sub    $0x8,%rsp
+  80093d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800941:	0f 94 c0             	sete   %al
+  800944:	0f b6 c0             	movzbl %al,%eax
+  800947:	50                   	push   %rax
+  800948:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80094d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800951:	4c 89 ee             	mov    %r13,%rsi
+  800954:	4c 89 f7             	mov    %r14,%rdi
+  800957:	48 b8 1b 02 80 00 00 	movabs $0x80021b,%rax
+  80095e:	00 00 00 
+  800961:	ff d0                	call   *%rax
+            break;
+  800963:	48 83 c4 10          	add    $0x10,%rsp
+  800967:	e9 eb f9 ff ff       	jmp    800357 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80096c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800970:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800974:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800978:	eb b7                	jmp    800931 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  80097a:	40 84 f6             	test   %sil,%sil
+  80097d:	75 2b                	jne    8009aa <vprintfmt+0x684>
+    switch (lflag) {
+  80097f:	85 d2                	test   %edx,%edx
+  800981:	74 56                	je     8009d9 <vprintfmt+0x6b3>
+  800983:	83 fa 01             	cmp    $0x1,%edx
+  800986:	74 7f                	je     800a07 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800988:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098b:	83 f8 2f             	cmp    $0x2f,%eax
+  80098e:	0f 87 a2 00 00 00    	ja     800a36 <vprintfmt+0x710>
+  800994:	89 c2                	mov    %eax,%edx
+  800996:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099a:	83 c0 08             	add    $0x8,%eax
+  80099d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009a3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009a8:	eb 8f                	jmp    800939 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8009aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b0:	77 19                	ja     8009cb <vprintfmt+0x6a5>
+  8009b2:	89 c2                	mov    %eax,%edx
+  8009b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b8:	83 c0 08             	add    $0x8,%eax
+  8009bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009be:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009c6:	e9 6e ff ff ff       	jmp    800939 <vprintfmt+0x613>
+  8009cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d7:	eb e5                	jmp    8009be <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8009d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009df:	77 18                	ja     8009f9 <vprintfmt+0x6d3>
+  8009e1:	89 c2                	mov    %eax,%edx
+  8009e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e7:	83 c0 08             	add    $0x8,%eax
+  8009ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ed:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009ef:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009f4:	e9 40 ff ff ff       	jmp    800939 <vprintfmt+0x613>
+  8009f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a05:	eb e6                	jmp    8009ed <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800a07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0d:	77 19                	ja     800a28 <vprintfmt+0x702>
+  800a0f:	89 c2                	mov    %eax,%edx
+  800a11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a15:	83 c0 08             	add    $0x8,%eax
+  800a18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a1e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a23:	e9 11 ff ff ff       	jmp    800939 <vprintfmt+0x613>
+  800a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a34:	eb e5                	jmp    800a1b <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800a36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a42:	e9 59 ff ff ff       	jmp    8009a0 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800a47:	4c 89 ee             	mov    %r13,%rsi
+  800a4a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a4f:	41 ff d6             	call   *%r14
+            break;
+  800a52:	e9 00 f9 ff ff       	jmp    800357 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a57:	4c 89 ee             	mov    %r13,%rsi
+  800a5a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a5f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a62:	48 83 eb 01          	sub    $0x1,%rbx
+  800a66:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a6a:	75 f6                	jne    800a62 <vprintfmt+0x73c>
+  800a6c:	e9 e6 f8 ff ff       	jmp    800357 <vprintfmt+0x31>
+}
+  800a71:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a75:	5b                   	pop    %rbx
+  800a76:	41 5c                	pop    %r12
+  800a78:	41 5d                	pop    %r13
+  800a7a:	41 5e                	pop    %r14
+  800a7c:	41 5f                	pop    %r15
+  800a7e:	5d                   	pop    %rbp
+  800a7f:	c3                   	ret
+
+0000000000800a80 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a80:	55                   	push   %rbp
+  800a81:	48 89 e5             	mov    %rsp,%rbp
+  800a84:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a88:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a8c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a91:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a95:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a9c:	48 85 ff             	test   %rdi,%rdi
+  800a9f:	74 2b                	je     800acc <vsnprintf+0x4c>
+  800aa1:	48 85 f6             	test   %rsi,%rsi
+  800aa4:	74 26                	je     800acc <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800aa6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800aaa:	48 bf d1 02 80 00 00 	movabs $0x8002d1,%rdi
+  800ab1:	00 00 00 
+  800ab4:	48 b8 26 03 80 00 00 	movabs $0x800326,%rax
+  800abb:	00 00 00 
+  800abe:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ac0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ac4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ac7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800aca:	c9                   	leave
+  800acb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800acc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad1:	eb f7                	jmp    800aca <vsnprintf+0x4a>
+
+0000000000800ad3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ad3:	55                   	push   %rbp
+  800ad4:	48 89 e5             	mov    %rsp,%rbp
+  800ad7:	48 83 ec 50          	sub    $0x50,%rsp
+  800adb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800adf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ae3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ae7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800aee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800af2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800afa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800afe:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b02:	48 b8 80 0a 80 00 00 	movabs $0x800a80,%rax
+  800b09:	00 00 00 
+  800b0c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b0e:	c9                   	leave
+  800b0f:	c3                   	ret
+
+0000000000800b10 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b10:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b13:	74 10                	je     800b25 <strlen+0x15>
+    size_t n = 0;
+  800b15:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b1a:	48 83 c0 01          	add    $0x1,%rax
+  800b1e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b22:	75 f6                	jne    800b1a <strlen+0xa>
+  800b24:	c3                   	ret
+    size_t n = 0;
+  800b25:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b2a:	c3                   	ret
+
+0000000000800b2b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b2b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b2e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b33:	48 85 f6             	test   %rsi,%rsi
+  800b36:	74 11                	je     800b49 <strnlen+0x1e>
+  800b38:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b3c:	74 0c                	je     800b4a <strnlen+0x1f>
+  800b3e:	48 83 c2 01          	add    $0x1,%rdx
+  800b42:	48 39 d0             	cmp    %rdx,%rax
+  800b45:	75 f1                	jne    800b38 <strnlen+0xd>
+  800b47:	eb 04                	jmp    800b4d <strnlen+0x22>
+  800b49:	c3                   	ret
+  800b4a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b4d:	c3                   	ret
+
+0000000000800b4e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b4e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b56:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b5a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b5d:	48 83 c2 01          	add    $0x1,%rdx
+  800b61:	84 c9                	test   %cl,%cl
+  800b63:	75 f1                	jne    800b56 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b65:	c3                   	ret
+
+0000000000800b66 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b66:	55                   	push   %rbp
+  800b67:	48 89 e5             	mov    %rsp,%rbp
+  800b6a:	41 54                	push   %r12
+  800b6c:	53                   	push   %rbx
+  800b6d:	48 89 fb             	mov    %rdi,%rbx
+  800b70:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b73:	48 b8 10 0b 80 00 00 	movabs $0x800b10,%rax
+  800b7a:	00 00 00 
+  800b7d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b7f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b83:	4c 89 e6             	mov    %r12,%rsi
+  800b86:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  800b8d:	00 00 00 
+  800b90:	ff d0                	call   *%rax
+    return dst;
+}
+  800b92:	48 89 d8             	mov    %rbx,%rax
+  800b95:	5b                   	pop    %rbx
+  800b96:	41 5c                	pop    %r12
+  800b98:	5d                   	pop    %rbp
+  800b99:	c3                   	ret
+
+0000000000800b9a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b9a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b9d:	48 85 d2             	test   %rdx,%rdx
+  800ba0:	74 1f                	je     800bc1 <strncpy+0x27>
+  800ba2:	48 01 fa             	add    %rdi,%rdx
+  800ba5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ba8:	48 83 c1 01          	add    $0x1,%rcx
+  800bac:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bb0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bb4:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bb8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bbc:	48 39 ca             	cmp    %rcx,%rdx
+  800bbf:	75 e7                	jne    800ba8 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bc1:	c3                   	ret
+
+0000000000800bc2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bc2:	48 89 f8             	mov    %rdi,%rax
+  800bc5:	48 85 d2             	test   %rdx,%rdx
+  800bc8:	74 24                	je     800bee <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bca:	48 83 ea 01          	sub    $0x1,%rdx
+  800bce:	74 1b                	je     800beb <strlcpy+0x29>
+  800bd0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bd4:	0f b6 16             	movzbl (%rsi),%edx
+  800bd7:	84 d2                	test   %dl,%dl
+  800bd9:	74 10                	je     800beb <strlcpy+0x29>
+            *dst++ = *src++;
+  800bdb:	48 83 c6 01          	add    $0x1,%rsi
+  800bdf:	48 83 c0 01          	add    $0x1,%rax
+  800be3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800be6:	48 39 c8             	cmp    %rcx,%rax
+  800be9:	75 e9                	jne    800bd4 <strlcpy+0x12>
+        *dst = '\0';
+  800beb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bee:	48 29 f8             	sub    %rdi,%rax
+}
+  800bf1:	c3                   	ret
+
+0000000000800bf2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bf2:	0f b6 07             	movzbl (%rdi),%eax
+  800bf5:	84 c0                	test   %al,%al
+  800bf7:	74 13                	je     800c0c <strcmp+0x1a>
+  800bf9:	38 06                	cmp    %al,(%rsi)
+  800bfb:	75 0f                	jne    800c0c <strcmp+0x1a>
+  800bfd:	48 83 c7 01          	add    $0x1,%rdi
+  800c01:	48 83 c6 01          	add    $0x1,%rsi
+  800c05:	0f b6 07             	movzbl (%rdi),%eax
+  800c08:	84 c0                	test   %al,%al
+  800c0a:	75 ed                	jne    800bf9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c0c:	0f b6 c0             	movzbl %al,%eax
+  800c0f:	0f b6 16             	movzbl (%rsi),%edx
+  800c12:	29 d0                	sub    %edx,%eax
+}
+  800c14:	c3                   	ret
+
+0000000000800c15 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c15:	48 85 d2             	test   %rdx,%rdx
+  800c18:	74 1f                	je     800c39 <strncmp+0x24>
+  800c1a:	0f b6 07             	movzbl (%rdi),%eax
+  800c1d:	84 c0                	test   %al,%al
+  800c1f:	74 1e                	je     800c3f <strncmp+0x2a>
+  800c21:	3a 06                	cmp    (%rsi),%al
+  800c23:	75 1a                	jne    800c3f <strncmp+0x2a>
+  800c25:	48 83 c7 01          	add    $0x1,%rdi
+  800c29:	48 83 c6 01          	add    $0x1,%rsi
+  800c2d:	48 83 ea 01          	sub    $0x1,%rdx
+  800c31:	75 e7                	jne    800c1a <strncmp+0x5>
+
+    if (!n) return 0;
+  800c33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c38:	c3                   	ret
+  800c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3e:	c3                   	ret
+  800c3f:	48 85 d2             	test   %rdx,%rdx
+  800c42:	74 09                	je     800c4d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c44:	0f b6 07             	movzbl (%rdi),%eax
+  800c47:	0f b6 16             	movzbl (%rsi),%edx
+  800c4a:	29 d0                	sub    %edx,%eax
+  800c4c:	c3                   	ret
+    if (!n) return 0;
+  800c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c52:	c3                   	ret
+
+0000000000800c53 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c53:	0f b6 17             	movzbl (%rdi),%edx
+  800c56:	84 d2                	test   %dl,%dl
+  800c58:	74 18                	je     800c72 <strchr+0x1f>
+        if (*str == c) {
+  800c5a:	0f be d2             	movsbl %dl,%edx
+  800c5d:	39 f2                	cmp    %esi,%edx
+  800c5f:	74 17                	je     800c78 <strchr+0x25>
+    for (; *str; str++) {
+  800c61:	48 83 c7 01          	add    $0x1,%rdi
+  800c65:	0f b6 17             	movzbl (%rdi),%edx
+  800c68:	84 d2                	test   %dl,%dl
+  800c6a:	75 ee                	jne    800c5a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c71:	c3                   	ret
+  800c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c77:	c3                   	ret
+  800c78:	48 89 f8             	mov    %rdi,%rax
+}
+  800c7b:	c3                   	ret
+
+0000000000800c7c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c7c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c7f:	0f b6 17             	movzbl (%rdi),%edx
+  800c82:	84 d2                	test   %dl,%dl
+  800c84:	74 13                	je     800c99 <strfind+0x1d>
+  800c86:	0f be d2             	movsbl %dl,%edx
+  800c89:	39 f2                	cmp    %esi,%edx
+  800c8b:	74 0b                	je     800c98 <strfind+0x1c>
+  800c8d:	48 83 c0 01          	add    $0x1,%rax
+  800c91:	0f b6 10             	movzbl (%rax),%edx
+  800c94:	84 d2                	test   %dl,%dl
+  800c96:	75 ee                	jne    800c86 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c98:	c3                   	ret
+  800c99:	c3                   	ret
+
+0000000000800c9a <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800c9a:	55                   	push   %rbp
+  800c9b:	48 89 e5             	mov    %rsp,%rbp
+  800c9e:	41 57                	push   %r15
+  800ca0:	41 56                	push   %r14
+  800ca2:	41 55                	push   %r13
+  800ca4:	41 54                	push   %r12
+  800ca6:	53                   	push   %rbx
+  800ca7:	48 83 ec 08          	sub    $0x8,%rsp
+  800cab:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800cae:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800cb2:	45 84 ed             	test   %r13b,%r13b
+  800cb5:	75 12                	jne    800cc9 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800cb7:	4c 89 f8             	mov    %r15,%rax
+  800cba:	48 83 c4 08          	add    $0x8,%rsp
+  800cbe:	5b                   	pop    %rbx
+  800cbf:	41 5c                	pop    %r12
+  800cc1:	41 5d                	pop    %r13
+  800cc3:	41 5e                	pop    %r14
+  800cc5:	41 5f                	pop    %r15
+  800cc7:	5d                   	pop    %rbp
+  800cc8:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800cc9:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800ccd:	4c 89 e7             	mov    %r12,%rdi
+  800cd0:	48 b8 10 0b 80 00 00 	movabs $0x800b10,%rax
+  800cd7:	00 00 00 
+  800cda:	ff d0                	call   *%rax
+  800cdc:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800cdf:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800ce3:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800ce7:	49 bf 15 0c 80 00 00 	movabs $0x800c15,%r15
+  800cee:	00 00 00 
+				if ((sc = *s++) == 0)
+  800cf1:	84 c0                	test   %al,%al
+  800cf3:	75 14                	jne    800d09 <strstr+0x6f>
+					return NULL;
+  800cf5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800cfb:	eb ba                	jmp    800cb7 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800cfd:	48 83 c3 01          	add    $0x1,%rbx
+  800d01:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800d05:	84 c0                	test   %al,%al
+  800d07:	74 1b                	je     800d24 <strstr+0x8a>
+			} while (sc != c);
+  800d09:	41 38 c5             	cmp    %al,%r13b
+  800d0c:	75 ef                	jne    800cfd <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800d0e:	4c 89 f2             	mov    %r14,%rdx
+  800d11:	4c 89 e6             	mov    %r12,%rsi
+  800d14:	48 89 df             	mov    %rbx,%rdi
+  800d17:	41 ff d7             	call   *%r15
+  800d1a:	85 c0                	test   %eax,%eax
+  800d1c:	75 df                	jne    800cfd <strstr+0x63>
+  800d1e:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800d22:	eb 93                	jmp    800cb7 <strstr+0x1d>
+					return NULL;
+  800d24:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d2a:	eb 8b                	jmp    800cb7 <strstr+0x1d>
+
+0000000000800d2c <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800d2c:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800d2e:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800d31:	8d 57 20             	lea    0x20(%rdi),%edx
+  800d34:	83 f9 1a             	cmp    $0x1a,%ecx
+  800d37:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800d3a:	c3                   	ret
+
+0000000000800d3b <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800d3b:	55                   	push   %rbp
+  800d3c:	48 89 e5             	mov    %rsp,%rbp
+  800d3f:	41 57                	push   %r15
+  800d41:	41 56                	push   %r14
+  800d43:	41 55                	push   %r13
+  800d45:	41 54                	push   %r12
+  800d47:	53                   	push   %rbx
+  800d48:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800d4c:	48 39 f7             	cmp    %rsi,%rdi
+  800d4f:	74 49                	je     800d9a <strcasecmp+0x5f>
+  800d51:	49 89 fd             	mov    %rdi,%r13
+  800d54:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800d57:	49 bf 2c 0d 80 00 00 	movabs $0x800d2c,%r15
+  800d5e:	00 00 00 
+  800d61:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800d66:	41 0f b6 fe          	movzbl %r14b,%edi
+  800d6a:	41 ff d7             	call   *%r15
+  800d6d:	89 c3                	mov    %eax,%ebx
+  800d6f:	49 83 c4 01          	add    $0x1,%r12
+  800d73:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800d79:	41 ff d7             	call   *%r15
+  800d7c:	29 c3                	sub    %eax,%ebx
+  800d7e:	75 09                	jne    800d89 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800d80:	49 83 c5 01          	add    $0x1,%r13
+  800d84:	45 84 f6             	test   %r14b,%r14b
+  800d87:	75 d8                	jne    800d61 <strcasecmp+0x26>
+}
+  800d89:	89 d8                	mov    %ebx,%eax
+  800d8b:	48 83 c4 08          	add    $0x8,%rsp
+  800d8f:	5b                   	pop    %rbx
+  800d90:	41 5c                	pop    %r12
+  800d92:	41 5d                	pop    %r13
+  800d94:	41 5e                	pop    %r14
+  800d96:	41 5f                	pop    %r15
+  800d98:	5d                   	pop    %rbp
+  800d99:	c3                   	ret
+        return 0;
+  800d9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9f:	eb e8                	jmp    800d89 <strcasecmp+0x4e>
+
+0000000000800da1 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800da1:	55                   	push   %rbp
+  800da2:	48 89 e5             	mov    %rsp,%rbp
+  800da5:	41 57                	push   %r15
+  800da7:	41 56                	push   %r14
+  800da9:	41 55                	push   %r13
+  800dab:	41 54                	push   %r12
+  800dad:	53                   	push   %rbx
+  800dae:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800db2:	48 85 d2             	test   %rdx,%rdx
+  800db5:	74 4f                	je     800e06 <strncasecmp+0x65>
+  800db7:	49 89 fc             	mov    %rdi,%r12
+  800dba:	49 89 f5             	mov    %rsi,%r13
+  800dbd:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800dc1:	49 be 2c 0d 80 00 00 	movabs $0x800d2c,%r14
+  800dc8:	00 00 00 
+  800dcb:	49 83 c4 01          	add    $0x1,%r12
+  800dcf:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800dd5:	41 ff d6             	call   *%r14
+  800dd8:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800dda:	49 83 c5 01          	add    $0x1,%r13
+  800dde:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800de3:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800de6:	29 c3                	sub    %eax,%ebx
+  800de8:	85 c0                	test   %eax,%eax
+  800dea:	74 09                	je     800df5 <strncasecmp+0x54>
+  800dec:	85 db                	test   %ebx,%ebx
+  800dee:	75 05                	jne    800df5 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800df0:	4d 39 fc             	cmp    %r15,%r12
+  800df3:	75 d6                	jne    800dcb <strncasecmp+0x2a>
+}
+  800df5:	89 d8                	mov    %ebx,%eax
+  800df7:	48 83 c4 08          	add    $0x8,%rsp
+  800dfb:	5b                   	pop    %rbx
+  800dfc:	41 5c                	pop    %r12
+  800dfe:	41 5d                	pop    %r13
+  800e00:	41 5e                	pop    %r14
+  800e02:	41 5f                	pop    %r15
+  800e04:	5d                   	pop    %rbp
+  800e05:	c3                   	ret
+    int d = 0;
+  800e06:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800e0b:	eb e8                	jmp    800df5 <strncasecmp+0x54>
+
+0000000000800e0d <toupper>:
+
+int toupper(int c) {
+  800e0d:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800e0f:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800e12:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800e15:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e18:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e1b:	c3                   	ret
+
+0000000000800e1c <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800e1c:	83 ff 20             	cmp    $0x20,%edi
+  800e1f:	0f 94 c0             	sete   %al
+  800e22:	0f b6 c0             	movzbl %al,%eax
+}
+  800e25:	c3                   	ret
+
+0000000000800e26 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800e26:	89 f8                	mov    %edi,%eax
+  800e28:	f7 d8                	neg    %eax
+  800e2a:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800e2d:	c3                   	ret
+
+0000000000800e2e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e2e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e31:	48 89 f8             	mov    %rdi,%rax
+  800e34:	48 f7 d8             	neg    %rax
+  800e37:	83 e0 07             	and    $0x7,%eax
+  800e3a:	49 89 d1             	mov    %rdx,%r9
+  800e3d:	49 29 c1             	sub    %rax,%r9
+  800e40:	78 36                	js     800e78 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e42:	40 0f b6 c6          	movzbl %sil,%eax
+  800e46:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e4d:	01 01 01 
+  800e50:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e54:	40 f6 c7 07          	test   $0x7,%dil
+  800e58:	75 38                	jne    800e92 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e5a:	4c 89 c9             	mov    %r9,%rcx
+  800e5d:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e61:	74 0c                	je     800e6f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e63:	fc                   	cld
+  800e64:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e67:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e6b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e6f:	4d 85 c9             	test   %r9,%r9
+  800e72:	75 45                	jne    800eb9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e74:	4c 89 c0             	mov    %r8,%rax
+  800e77:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e78:	48 85 d2             	test   %rdx,%rdx
+  800e7b:	74 f7                	je     800e74 <memset+0x46>
+  800e7d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e80:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e83:	48 83 c0 01          	add    $0x1,%rax
+  800e87:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e8b:	48 39 c2             	cmp    %rax,%rdx
+  800e8e:	75 f3                	jne    800e83 <memset+0x55>
+  800e90:	eb e2                	jmp    800e74 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e92:	40 f6 c7 01          	test   $0x1,%dil
+  800e96:	74 06                	je     800e9e <memset+0x70>
+  800e98:	88 07                	mov    %al,(%rdi)
+  800e9a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e9e:	40 f6 c7 02          	test   $0x2,%dil
+  800ea2:	74 07                	je     800eab <memset+0x7d>
+  800ea4:	66 89 07             	mov    %ax,(%rdi)
+  800ea7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eab:	40 f6 c7 04          	test   $0x4,%dil
+  800eaf:	74 a9                	je     800e5a <memset+0x2c>
+  800eb1:	89 07                	mov    %eax,(%rdi)
+  800eb3:	48 83 c7 04          	add    $0x4,%rdi
+  800eb7:	eb a1                	jmp    800e5a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eb9:	41 f6 c1 04          	test   $0x4,%r9b
+  800ebd:	74 06                	je     800ec5 <memset+0x97>
+  800ebf:	89 07                	mov    %eax,(%rdi)
+  800ec1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ec5:	41 f6 c1 02          	test   $0x2,%r9b
+  800ec9:	74 07                	je     800ed2 <memset+0xa4>
+  800ecb:	66 89 07             	mov    %ax,(%rdi)
+  800ece:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ed2:	41 f6 c1 01          	test   $0x1,%r9b
+  800ed6:	74 9c                	je     800e74 <memset+0x46>
+  800ed8:	88 07                	mov    %al,(%rdi)
+  800eda:	eb 98                	jmp    800e74 <memset+0x46>
+
+0000000000800edc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800edc:	48 89 f8             	mov    %rdi,%rax
+  800edf:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ee2:	48 39 fe             	cmp    %rdi,%rsi
+  800ee5:	73 3b                	jae    800f22 <memmove+0x46>
+  800ee7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800eeb:	48 39 d7             	cmp    %rdx,%rdi
+  800eee:	73 32                	jae    800f22 <memmove+0x46>
+        s += n;
+        d += n;
+  800ef0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ef4:	48 89 d6             	mov    %rdx,%rsi
+  800ef7:	48 09 fe             	or     %rdi,%rsi
+  800efa:	48 09 ce             	or     %rcx,%rsi
+  800efd:	40 f6 c6 07          	test   $0x7,%sil
+  800f01:	75 12                	jne    800f15 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f03:	48 83 ef 08          	sub    $0x8,%rdi
+  800f07:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f0b:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f0f:	fd                   	std
+  800f10:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f13:	fc                   	cld
+  800f14:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f15:	48 83 ef 01          	sub    $0x1,%rdi
+  800f19:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f1d:	fd                   	std
+  800f1e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f20:	eb f1                	jmp    800f13 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f22:	48 89 f2             	mov    %rsi,%rdx
+  800f25:	48 09 c2             	or     %rax,%rdx
+  800f28:	48 09 ca             	or     %rcx,%rdx
+  800f2b:	f6 c2 07             	test   $0x7,%dl
+  800f2e:	75 0c                	jne    800f3c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f30:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f34:	48 89 c7             	mov    %rax,%rdi
+  800f37:	fc                   	cld
+  800f38:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f3b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f3c:	48 89 c7             	mov    %rax,%rdi
+  800f3f:	fc                   	cld
+  800f40:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f42:	c3                   	ret
+
+0000000000800f43 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f43:	55                   	push   %rbp
+  800f44:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f47:	48 b8 dc 0e 80 00 00 	movabs $0x800edc,%rax
+  800f4e:	00 00 00 
+  800f51:	ff d0                	call   *%rax
+}
+  800f53:	5d                   	pop    %rbp
+  800f54:	c3                   	ret
+
+0000000000800f55 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f55:	55                   	push   %rbp
+  800f56:	48 89 e5             	mov    %rsp,%rbp
+  800f59:	41 57                	push   %r15
+  800f5b:	41 56                	push   %r14
+  800f5d:	41 55                	push   %r13
+  800f5f:	41 54                	push   %r12
+  800f61:	53                   	push   %rbx
+  800f62:	48 83 ec 08          	sub    $0x8,%rsp
+  800f66:	49 89 fe             	mov    %rdi,%r14
+  800f69:	49 89 f7             	mov    %rsi,%r15
+  800f6c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f6f:	48 89 f7             	mov    %rsi,%rdi
+  800f72:	48 b8 10 0b 80 00 00 	movabs $0x800b10,%rax
+  800f79:	00 00 00 
+  800f7c:	ff d0                	call   *%rax
+  800f7e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f81:	48 89 de             	mov    %rbx,%rsi
+  800f84:	4c 89 f7             	mov    %r14,%rdi
+  800f87:	48 b8 2b 0b 80 00 00 	movabs $0x800b2b,%rax
+  800f8e:	00 00 00 
+  800f91:	ff d0                	call   *%rax
+  800f93:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f96:	48 39 c3             	cmp    %rax,%rbx
+  800f99:	74 36                	je     800fd1 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f9b:	48 89 d8             	mov    %rbx,%rax
+  800f9e:	4c 29 e8             	sub    %r13,%rax
+  800fa1:	49 39 c4             	cmp    %rax,%r12
+  800fa4:	73 31                	jae    800fd7 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fa6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fab:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800faf:	4c 89 fe             	mov    %r15,%rsi
+  800fb2:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  800fb9:	00 00 00 
+  800fbc:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fbe:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fc2:	48 83 c4 08          	add    $0x8,%rsp
+  800fc6:	5b                   	pop    %rbx
+  800fc7:	41 5c                	pop    %r12
+  800fc9:	41 5d                	pop    %r13
+  800fcb:	41 5e                	pop    %r14
+  800fcd:	41 5f                	pop    %r15
+  800fcf:	5d                   	pop    %rbp
+  800fd0:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fd1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fd5:	eb eb                	jmp    800fc2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fd7:	48 83 eb 01          	sub    $0x1,%rbx
+  800fdb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fdf:	48 89 da             	mov    %rbx,%rdx
+  800fe2:	4c 89 fe             	mov    %r15,%rsi
+  800fe5:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  800fec:	00 00 00 
+  800fef:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ff1:	49 01 de             	add    %rbx,%r14
+  800ff4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ff9:	eb c3                	jmp    800fbe <strlcat+0x69>
+
+0000000000800ffb <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ffb:	48 85 d2             	test   %rdx,%rdx
+  800ffe:	74 2d                	je     80102d <memcmp+0x32>
+  801000:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801005:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801009:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80100e:	44 38 c1             	cmp    %r8b,%cl
+  801011:	75 0f                	jne    801022 <memcmp+0x27>
+    while (n-- > 0) {
+  801013:	48 83 c0 01          	add    $0x1,%rax
+  801017:	48 39 c2             	cmp    %rax,%rdx
+  80101a:	75 e9                	jne    801005 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80101c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801021:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801022:	0f b6 c1             	movzbl %cl,%eax
+  801025:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801029:	44 29 c0             	sub    %r8d,%eax
+  80102c:	c3                   	ret
+    return 0;
+  80102d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801032:	c3                   	ret
+
+0000000000801033 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801033:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801037:	48 39 c7             	cmp    %rax,%rdi
+  80103a:	73 0f                	jae    80104b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80103c:	40 38 37             	cmp    %sil,(%rdi)
+  80103f:	74 0e                	je     80104f <memfind+0x1c>
+    for (; src < end; src++) {
+  801041:	48 83 c7 01          	add    $0x1,%rdi
+  801045:	48 39 f8             	cmp    %rdi,%rax
+  801048:	75 f2                	jne    80103c <memfind+0x9>
+  80104a:	c3                   	ret
+  80104b:	48 89 f8             	mov    %rdi,%rax
+  80104e:	c3                   	ret
+  80104f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801052:	c3                   	ret
+
+0000000000801053 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801053:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801056:	0f b6 37             	movzbl (%rdi),%esi
+  801059:	40 80 fe 20          	cmp    $0x20,%sil
+  80105d:	74 06                	je     801065 <strtol+0x12>
+  80105f:	40 80 fe 09          	cmp    $0x9,%sil
+  801063:	75 13                	jne    801078 <strtol+0x25>
+  801065:	48 83 c7 01          	add    $0x1,%rdi
+  801069:	0f b6 37             	movzbl (%rdi),%esi
+  80106c:	40 80 fe 20          	cmp    $0x20,%sil
+  801070:	74 f3                	je     801065 <strtol+0x12>
+  801072:	40 80 fe 09          	cmp    $0x9,%sil
+  801076:	74 ed                	je     801065 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801078:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80107b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80107e:	3c 01                	cmp    $0x1,%al
+  801080:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801084:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80108a:	75 0f                	jne    80109b <strtol+0x48>
+  80108c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80108f:	74 14                	je     8010a5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801091:	85 d2                	test   %edx,%edx
+  801093:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801098:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80109b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010a0:	4c 63 ca             	movslq %edx,%r9
+  8010a3:	eb 36                	jmp    8010db <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010a5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010a9:	74 0f                	je     8010ba <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010ab:	85 d2                	test   %edx,%edx
+  8010ad:	75 ec                	jne    80109b <strtol+0x48>
+        s++;
+  8010af:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010b3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010b8:	eb e1                	jmp    80109b <strtol+0x48>
+        s += 2;
+  8010ba:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010be:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010c3:	eb d6                	jmp    80109b <strtol+0x48>
+            dig -= '0';
+  8010c5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010c8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010cc:	41 39 d0             	cmp    %edx,%r8d
+  8010cf:	7d 21                	jge    8010f2 <strtol+0x9f>
+        val = val * base + dig;
+  8010d1:	49 0f af c1          	imul   %r9,%rax
+  8010d5:	0f b6 c9             	movzbl %cl,%ecx
+  8010d8:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010db:	48 83 c7 01          	add    $0x1,%rdi
+  8010df:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010e3:	80 f9 39             	cmp    $0x39,%cl
+  8010e6:	76 dd                	jbe    8010c5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010e8:	80 f9 7b             	cmp    $0x7b,%cl
+  8010eb:	77 05                	ja     8010f2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010ed:	83 e9 57             	sub    $0x57,%ecx
+  8010f0:	eb d6                	jmp    8010c8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010f2:	4d 85 d2             	test   %r10,%r10
+  8010f5:	74 03                	je     8010fa <strtol+0xa7>
+  8010f7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010fa:	48 89 c2             	mov    %rax,%rdx
+  8010fd:	48 f7 da             	neg    %rdx
+  801100:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801104:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801108:	c3                   	ret
+
+0000000000801109 <atoi>:
+int atoi(const char *str) {
+  801109:	55                   	push   %rbp
+  80110a:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  80110d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801112:	be 00 00 00 00       	mov    $0x0,%esi
+  801117:	48 b8 53 10 80 00 00 	movabs $0x801053,%rax
+  80111e:	00 00 00 
+  801121:	ff d0                	call   *%rax
+}
+  801123:	5d                   	pop    %rbp
+  801124:	c3                   	ret
+
+0000000000801125 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801125:	55                   	push   %rbp
+  801126:	48 89 e5             	mov    %rsp,%rbp
+  801129:	53                   	push   %rbx
+  80112a:	48 89 fa             	mov    %rdi,%rdx
+  80112d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801130:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801135:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113f:	be 00 00 00 00       	mov    $0x0,%esi
+  801144:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80114a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80114c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801150:	c9                   	leave
+  801151:	c3                   	ret
+
+0000000000801152 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801152:	55                   	push   %rbp
+  801153:	48 89 e5             	mov    %rsp,%rbp
+  801156:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801157:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80115c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801161:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801166:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801170:	be 00 00 00 00       	mov    $0x0,%esi
+  801175:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80117d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801181:	c9                   	leave
+  801182:	c3                   	ret
+
+0000000000801183 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801183:	55                   	push   %rbp
+  801184:	48 89 e5             	mov    %rsp,%rbp
+  801187:	53                   	push   %rbx
+  801188:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80118c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80118f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801194:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801199:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011b0:	48 85 c0             	test   %rax,%rax
+  8011b3:	7f 06                	jg     8011bb <sys_env_destroy+0x38>
+}
+  8011b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b9:	c9                   	leave
+  8011ba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011bb:	49 89 c0             	mov    %rax,%r8
+  8011be:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011c3:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8011ca:	00 00 00 
+  8011cd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8011d2:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  8011d9:	00 00 00 
+  8011dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e1:	49 b9 4d 3f 80 00 00 	movabs $0x803f4d,%r9
+  8011e8:	00 00 00 
+  8011eb:	41 ff d1             	call   *%r9
+
+00000000008011ee <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011ee:	55                   	push   %rbp
+  8011ef:	48 89 e5             	mov    %rsp,%rbp
+  8011f2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801207:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120c:	be 00 00 00 00       	mov    $0x0,%esi
+  801211:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801217:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801219:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121d:	c9                   	leave
+  80121e:	c3                   	ret
+
+000000000080121f <sys_yield>:
+
+void
+sys_yield(void) {
+  80121f:	55                   	push   %rbp
+  801220:	48 89 e5             	mov    %rsp,%rbp
+  801223:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801224:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801229:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801233:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801238:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123d:	be 00 00 00 00       	mov    $0x0,%esi
+  801242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801248:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80124a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124e:	c9                   	leave
+  80124f:	c3                   	ret
+
+0000000000801250 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801250:	55                   	push   %rbp
+  801251:	48 89 e5             	mov    %rsp,%rbp
+  801254:	53                   	push   %rbx
+  801255:	48 89 fa             	mov    %rdi,%rdx
+  801258:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80125b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801260:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801267:	00 00 00 
+  80126a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126f:	be 00 00 00 00       	mov    $0x0,%esi
+  801274:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80127c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801280:	c9                   	leave
+  801281:	c3                   	ret
+
+0000000000801282 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801282:	55                   	push   %rbp
+  801283:	48 89 e5             	mov    %rsp,%rbp
+  801286:	53                   	push   %rbx
+  801287:	49 89 f8             	mov    %rdi,%r8
+  80128a:	48 89 d3             	mov    %rdx,%rbx
+  80128d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801290:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801295:	4c 89 c2             	mov    %r8,%rdx
+  801298:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129b:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ac:	c9                   	leave
+  8012ad:	c3                   	ret
+
+00000000008012ae <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012ae:	55                   	push   %rbp
+  8012af:	48 89 e5             	mov    %rsp,%rbp
+  8012b2:	53                   	push   %rbx
+  8012b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b7:	89 f8                	mov    %edi,%eax
+  8012b9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012bc:	48 63 f9             	movslq %ecx,%rdi
+  8012bf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8012cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d7:	48 85 c0             	test   %rax,%rax
+  8012da:	7f 06                	jg     8012e2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e0:	c9                   	leave
+  8012e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e2:	49 89 c0             	mov    %rax,%r8
+  8012e5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012ea:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8012f1:	00 00 00 
+  8012f4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8012f9:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801300:	00 00 00 
+  801303:	b8 00 00 00 00       	mov    $0x0,%eax
+  801308:	49 b9 4d 3f 80 00 00 	movabs $0x803f4d,%r9
+  80130f:	00 00 00 
+  801312:	41 ff d1             	call   *%r9
+
+0000000000801315 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801315:	55                   	push   %rbp
+  801316:	48 89 e5             	mov    %rsp,%rbp
+  801319:	53                   	push   %rbx
+  80131a:	48 83 ec 08          	sub    $0x8,%rsp
+  80131e:	89 f8                	mov    %edi,%eax
+  801320:	49 89 f2             	mov    %rsi,%r10
+  801323:	48 89 cf             	mov    %rcx,%rdi
+  801326:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801329:	48 63 da             	movslq %edx,%rbx
+  80132c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80132f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801334:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801337:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80133a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80133c:	48 85 c0             	test   %rax,%rax
+  80133f:	7f 06                	jg     801347 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801341:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801347:	49 89 c0             	mov    %rax,%r8
+  80134a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80134f:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  801356:	00 00 00 
+  801359:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80135e:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801365:	00 00 00 
+  801368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136d:	49 b9 4d 3f 80 00 00 	movabs $0x803f4d,%r9
+  801374:	00 00 00 
+  801377:	41 ff d1             	call   *%r9
+
+000000000080137a <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80137a:	55                   	push   %rbp
+  80137b:	48 89 e5             	mov    %rsp,%rbp
+  80137e:	53                   	push   %rbx
+  80137f:	48 83 ec 08          	sub    $0x8,%rsp
+  801383:	49 89 f9             	mov    %rdi,%r9
+  801386:	89 f0                	mov    %esi,%eax
+  801388:	48 89 d3             	mov    %rdx,%rbx
+  80138b:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80138e:	49 63 f0             	movslq %r8d,%rsi
+  801391:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801394:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801399:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a4:	48 85 c0             	test   %rax,%rax
+  8013a7:	7f 06                	jg     8013af <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ad:	c9                   	leave
+  8013ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013af:	49 89 c0             	mov    %rax,%r8
+  8013b2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013b7:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8013be:	00 00 00 
+  8013c1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013c6:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  8013cd:	00 00 00 
+  8013d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d5:	49 b9 4d 3f 80 00 00 	movabs $0x803f4d,%r9
+  8013dc:	00 00 00 
+  8013df:	41 ff d1             	call   *%r9
+
+00000000008013e2 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8013e2:	55                   	push   %rbp
+  8013e3:	48 89 e5             	mov    %rsp,%rbp
+  8013e6:	53                   	push   %rbx
+  8013e7:	89 f8                	mov    %edi,%eax
+  8013e9:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8013ec:	48 63 f9             	movslq %ecx,%rdi
+  8013ef:	48 63 da             	movslq %edx,%rbx
+  8013f2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fa:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801402:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801408:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80140a:	89 c2                	mov    %eax,%edx
+  80140c:	48 85 c0             	test   %rax,%rax
+  80140f:	78 0d                	js     80141e <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801411:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801416:	4d 85 c9             	test   %r9,%r9
+  801419:	74 03                	je     80141e <sys_alloc_dma_region+0x3c>
+  80141b:	49 89 01             	mov    %rax,(%r9)
+}
+  80141e:	89 d0                	mov    %edx,%eax
+  801420:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801424:	c9                   	leave
+  801425:	c3                   	ret
+
+0000000000801426 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801426:	55                   	push   %rbp
+  801427:	48 89 e5             	mov    %rsp,%rbp
+  80142a:	53                   	push   %rbx
+  80142b:	48 83 ec 08          	sub    $0x8,%rsp
+  80142f:	48 89 f1             	mov    %rsi,%rcx
+  801432:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801435:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801438:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80143d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801442:	be 00 00 00 00       	mov    $0x0,%esi
+  801447:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144f:	48 85 c0             	test   %rax,%rax
+  801452:	7f 06                	jg     80145a <sys_set_cache_region+0x34>
+}
+  801454:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801458:	c9                   	leave
+  801459:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145a:	49 89 c0             	mov    %rax,%r8
+  80145d:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801462:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  801469:	00 00 00 
+  80146c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801471:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801478:	00 00 00 
+  80147b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801480:	49 b9 4d 3f 80 00 00 	movabs $0x803f4d,%r9
+  801487:	00 00 00 
+  80148a:	41 ff d1             	call   *%r9
+
+000000000080148d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80148d:	55                   	push   %rbp
+  80148e:	48 89 e5             	mov    %rsp,%rbp
+  801491:	53                   	push   %rbx
+  801492:	48 83 ec 08          	sub    $0x8,%rsp
+  801496:	48 89 f1             	mov    %rsi,%rcx
+  801499:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80149c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80149f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b6:	48 85 c0             	test   %rax,%rax
+  8014b9:	7f 06                	jg     8014c1 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014bf:	c9                   	leave
+  8014c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c1:	49 89 c0             	mov    %rax,%r8
+  8014c4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014c9:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8014d0:	00 00 00 
+  8014d3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014d8:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  8014df:	00 00 00 
+  8014e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e7:	49 b9 4d 3f 80 00 00 	movabs $0x803f4d,%r9
+  8014ee:	00 00 00 
+  8014f1:	41 ff d1             	call   *%r9
+
+00000000008014f4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014f4:	55                   	push   %rbp
+  8014f5:	48 89 e5             	mov    %rsp,%rbp
+  8014f8:	53                   	push   %rbx
+  8014f9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014fd:	48 63 ce             	movslq %esi,%rcx
+  801500:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801503:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801508:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801512:	be 00 00 00 00       	mov    $0x0,%esi
+  801517:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151f:	48 85 c0             	test   %rax,%rax
+  801522:	7f 06                	jg     80152a <sys_env_set_status+0x36>
+}
+  801524:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801528:	c9                   	leave
+  801529:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80152a:	49 89 c0             	mov    %rax,%r8
+  80152d:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801532:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  801539:	00 00 00 
+  80153c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801541:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801548:	00 00 00 
+  80154b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801550:	49 b9 4d 3f 80 00 00 	movabs $0x803f4d,%r9
+  801557:	00 00 00 
+  80155a:	41 ff d1             	call   *%r9
+
+000000000080155d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80155d:	55                   	push   %rbp
+  80155e:	48 89 e5             	mov    %rsp,%rbp
+  801561:	53                   	push   %rbx
+  801562:	48 83 ec 08          	sub    $0x8,%rsp
+  801566:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801569:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801571:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801576:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157b:	be 00 00 00 00       	mov    $0x0,%esi
+  801580:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801586:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801588:	48 85 c0             	test   %rax,%rax
+  80158b:	7f 06                	jg     801593 <sys_env_set_trapframe+0x36>
+}
+  80158d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801591:	c9                   	leave
+  801592:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801593:	49 89 c0             	mov    %rax,%r8
+  801596:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80159b:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8015a2:	00 00 00 
+  8015a5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015aa:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  8015b1:	00 00 00 
+  8015b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b9:	49 b9 4d 3f 80 00 00 	movabs $0x803f4d,%r9
+  8015c0:	00 00 00 
+  8015c3:	41 ff d1             	call   *%r9
+
+00000000008015c6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015c6:	55                   	push   %rbp
+  8015c7:	48 89 e5             	mov    %rsp,%rbp
+  8015ca:	53                   	push   %rbx
+  8015cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8015cf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015d2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d5:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ef:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f1:	48 85 c0             	test   %rax,%rax
+  8015f4:	7f 06                	jg     8015fc <sys_env_set_pgfault_upcall+0x36>
+}
+  8015f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fa:	c9                   	leave
+  8015fb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015fc:	49 89 c0             	mov    %rax,%r8
+  8015ff:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801604:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  80160b:	00 00 00 
+  80160e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801613:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  80161a:	00 00 00 
+  80161d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801622:	49 b9 4d 3f 80 00 00 	movabs $0x803f4d,%r9
+  801629:	00 00 00 
+  80162c:	41 ff d1             	call   *%r9
+
+000000000080162f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80162f:	55                   	push   %rbp
+  801630:	48 89 e5             	mov    %rsp,%rbp
+  801633:	53                   	push   %rbx
+  801634:	89 f8                	mov    %edi,%eax
+  801636:	49 89 f1             	mov    %rsi,%r9
+  801639:	48 89 d3             	mov    %rdx,%rbx
+  80163c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80163f:	49 63 f0             	movslq %r8d,%rsi
+  801642:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801645:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80164d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801653:	cd 30                	int    $0x30
+}
+  801655:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801659:	c9                   	leave
+  80165a:	c3                   	ret
+
+000000000080165b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80165b:	55                   	push   %rbp
+  80165c:	48 89 e5             	mov    %rsp,%rbp
+  80165f:	53                   	push   %rbx
+  801660:	48 83 ec 08          	sub    $0x8,%rsp
+  801664:	48 89 fa             	mov    %rdi,%rdx
+  801667:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80166a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80166f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801674:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801679:	be 00 00 00 00       	mov    $0x0,%esi
+  80167e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801684:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801686:	48 85 c0             	test   %rax,%rax
+  801689:	7f 06                	jg     801691 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80168b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80168f:	c9                   	leave
+  801690:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801691:	49 89 c0             	mov    %rax,%r8
+  801694:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801699:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8016a0:	00 00 00 
+  8016a3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016a8:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  8016af:	00 00 00 
+  8016b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b7:	49 b9 4d 3f 80 00 00 	movabs $0x803f4d,%r9
+  8016be:	00 00 00 
+  8016c1:	41 ff d1             	call   *%r9
+
+00000000008016c4 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8016c4:	55                   	push   %rbp
+  8016c5:	48 89 e5             	mov    %rsp,%rbp
+  8016c8:	53                   	push   %rbx
+  8016c9:	48 89 fa             	mov    %rdi,%rdx
+  8016cc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cf:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016de:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e9:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ef:	c9                   	leave
+  8016f0:	c3                   	ret
+
+00000000008016f1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016f1:	55                   	push   %rbp
+  8016f2:	48 89 e5             	mov    %rsp,%rbp
+  8016f5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801700:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801705:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80170f:	be 00 00 00 00       	mov    $0x0,%esi
+  801714:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80171a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80171c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801720:	c9                   	leave
+  801721:	c3                   	ret
+
+0000000000801722 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801722:	48 85 ff             	test   %rdi,%rdi
+  801725:	0f 84 b6 01 00 00    	je     8018e1 <malloc+0x1bf>
+malloc(size_t size) {
+  80172b:	55                   	push   %rbp
+  80172c:	48 89 e5             	mov    %rsp,%rbp
+  80172f:	41 56                	push   %r14
+  801731:	41 55                	push   %r13
+  801733:	41 54                	push   %r12
+  801735:	53                   	push   %rbx
+  801736:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801739:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801740:	00 00 00 
+  801743:	4c 8b 20             	mov    (%rax),%r12
+  801746:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80174d:	0f 87 94 01 00 00    	ja     8018e7 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801753:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80175a:	00 00 00 
+  80175d:	48 85 c0             	test   %rax,%rax
+  801760:	74 6b                	je     8017cd <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801762:	4d 85 e4             	test   %r12,%r12
+  801765:	74 66                	je     8017cd <malloc+0xab>
+  801767:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80176e:	00 00 00 
+  801771:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801776:	eb 0d                	jmp    801785 <malloc+0x63>
+  801778:	48 83 c1 01          	add    $0x1,%rcx
+  80177c:	48 83 c2 18          	add    $0x18,%rdx
+  801780:	49 39 cc             	cmp    %rcx,%r12
+  801783:	74 48                	je     8017cd <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801785:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80178a:	74 ec                	je     801778 <malloc+0x56>
+  80178c:	48 39 1a             	cmp    %rbx,(%rdx)
+  80178f:	72 e7                	jb     801778 <malloc+0x56>
+                real_freep_size--;
+  801791:	48 83 e8 01          	sub    $0x1,%rax
+  801795:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80179c:	00 00 00 
+                freep[i].is_free = false;
+  80179f:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8017a6:	00 00 00 
+  8017a9:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8017ad:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8017b1:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8017b5:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8017bc:	00 
+                freep[i].size = size;
+  8017bd:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8017c1:	48 01 c8             	add    %rcx,%rax
+  8017c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017c8:	e9 0b 01 00 00       	jmp    8018d8 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8017cd:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8017d4:	00 00 00 
+  8017d7:	48 01 d8             	add    %rbx,%rax
+  8017da:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8017e0:	76 7c                	jbe    80185e <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8017e2:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8017e9:	00 00 00 
+  8017ec:	4c 8b 30             	mov    (%rax),%r14
+  8017ef:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8017f6:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8017f9:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801800:	00 00 00 
+  801803:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  80180a:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801811:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801817:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80181b:	48 b8 ee 11 80 00 00 	movabs $0x8011ee,%rax
+  801822:	00 00 00 
+  801825:	ff d0                	call   *%rax
+  801827:	89 c7                	mov    %eax,%edi
+  801829:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801830:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801837:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80183e:	00 00 00 
+  801841:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801845:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80184a:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  801851:	00 00 00 
+  801854:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801856:	85 c0                	test   %eax,%eax
+  801858:	0f 88 90 00 00 00    	js     8018ee <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80185e:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801865:	00 00 00 
+  801868:	48 8b 31             	mov    (%rcx),%rsi
+  80186b:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801872:	00 00 00 
+  801875:	4c 8b 07             	mov    (%rdi),%r8
+  801878:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80187c:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801883:	00 00 00 
+  801886:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80188a:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80188e:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801895:	00 00 00 
+  801898:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80189c:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80189f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8018a3:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8018aa:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8018ab:	48 89 d8             	mov    %rbx,%rax
+  8018ae:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8018b3:	4c 01 c0             	add    %r8,%rax
+  8018b6:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8018b9:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8018c0:	48 01 f3             	add    %rsi,%rbx
+  8018c3:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8018c6:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8018cb:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8018d2:	00 00 00 
+  8018d5:	48 89 d0             	mov    %rdx,%rax
+}
+  8018d8:	5b                   	pop    %rbx
+  8018d9:	41 5c                	pop    %r12
+  8018db:	41 5d                	pop    %r13
+  8018dd:	41 5e                	pop    %r14
+  8018df:	5d                   	pop    %rbp
+  8018e0:	c3                   	ret
+        return NULL;
+  8018e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018e6:	c3                   	ret
+        return NULL;
+  8018e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ec:	eb ea                	jmp    8018d8 <malloc+0x1b6>
+            return NULL;
+  8018ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f3:	eb e3                	jmp    8018d8 <malloc+0x1b6>
+
+00000000008018f5 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8018f5:	55                   	push   %rbp
+  8018f6:	48 89 e5             	mov    %rsp,%rbp
+  8018f9:	53                   	push   %rbx
+  8018fa:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8018fe:	48 89 fb             	mov    %rdi,%rbx
+  801901:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801905:	48 89 df             	mov    %rbx,%rdi
+  801908:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  80190f:	00 00 00 
+  801912:	ff d0                	call   *%rax
+  801914:	48 89 c7             	mov    %rax,%rdi
+  801917:	48 89 da             	mov    %rbx,%rdx
+  80191a:	be 00 00 00 00       	mov    $0x0,%esi
+  80191f:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  801926:	00 00 00 
+  801929:	ff d0                	call   *%rax
+}
+  80192b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80192f:	c9                   	leave
+  801930:	c3                   	ret
+
+0000000000801931 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801931:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801938:	00 00 00 
+  80193b:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801942:	00 00 00 
+  801945:	48 3b 02             	cmp    (%rdx),%rax
+  801948:	74 4d                	je     801997 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  80194a:	48 85 c0             	test   %rax,%rax
+  80194d:	74 4d                	je     80199c <get_allocsize+0x6b>
+  80194f:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801956:	00 00 00 
+  801959:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80195e:	48 3b 39             	cmp    (%rcx),%rdi
+  801961:	74 13                	je     801976 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801963:	48 83 c2 01          	add    $0x1,%rdx
+  801967:	48 83 c1 18          	add    $0x18,%rcx
+  80196b:	48 39 d0             	cmp    %rdx,%rax
+  80196e:	75 ee                	jne    80195e <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801970:	b8 00 00 00 00       	mov    $0x0,%eax
+  801975:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801976:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80197a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197f:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801986:	00 00 00 
+  801989:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80198f:	75 0b                	jne    80199c <get_allocsize+0x6b>
+  801991:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801996:	c3                   	ret
+        return 0;
+  801997:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80199c:	c3                   	ret
+
+000000000080199d <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80199d:	48 85 ff             	test   %rdi,%rdi
+  8019a0:	0f 84 01 01 00 00    	je     801aa7 <free+0x10a>
+free(void *ptr) {
+  8019a6:	55                   	push   %rbp
+  8019a7:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8019aa:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8019b1:	00 00 00 
+  8019b4:	48 8b 30             	mov    (%rax),%rsi
+  8019b7:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8019be:	00 00 00 
+  8019c1:	48 39 c6             	cmp    %rax,%rsi
+  8019c4:	74 50                	je     801a16 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8019c6:	48 85 f6             	test   %rsi,%rsi
+  8019c9:	74 21                	je     8019ec <free+0x4f>
+  8019cb:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8019d2:	00 00 00 
+  8019d5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8019da:	48 3b 39             	cmp    (%rcx),%rdi
+  8019dd:	74 61                	je     801a40 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8019df:	48 83 c2 01          	add    $0x1,%rdx
+  8019e3:	48 83 c1 18          	add    $0x18,%rcx
+  8019e7:	48 39 d6             	cmp    %rdx,%rsi
+  8019ea:	75 ee                	jne    8019da <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8019ec:	48 ba 90 55 80 00 00 	movabs $0x805590,%rdx
+  8019f3:	00 00 00 
+  8019f6:	be 12 01 00 00       	mov    $0x112,%esi
+  8019fb:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801a02:	00 00 00 
+  801a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0a:	48 b9 4d 3f 80 00 00 	movabs $0x803f4d,%rcx
+  801a11:	00 00 00 
+  801a14:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801a16:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801a1d:	00 00 00 
+  801a20:	be 06 01 00 00       	mov    $0x106,%esi
+  801a25:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801a2c:	00 00 00 
+  801a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a34:	48 b9 4d 3f 80 00 00 	movabs $0x803f4d,%rcx
+  801a3b:	00 00 00 
+  801a3e:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801a40:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a44:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a4b:	00 00 00 
+  801a4e:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a54:	75 27                	jne    801a7d <free+0xe0>
+            freep[i].is_free = true;
+  801a56:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a5a:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801a61:	00 00 00 
+  801a64:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801a6b:	00 00 
+            real_freep_size++;
+  801a6d:	48 83 c0 01          	add    $0x1,%rax
+  801a71:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801a78:	00 00 00 
+}
+  801a7b:	5d                   	pop    %rbp
+  801a7c:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801a7d:	48 ba 68 55 80 00 00 	movabs $0x805568,%rdx
+  801a84:	00 00 00 
+  801a87:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801a8c:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801a93:	00 00 00 
+  801a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9b:	48 b9 4d 3f 80 00 00 	movabs $0x803f4d,%rcx
+  801aa2:	00 00 00 
+  801aa5:	ff d1                	call   *%rcx
+  801aa7:	c3                   	ret
+
+0000000000801aa8 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801aa8:	55                   	push   %rbp
+  801aa9:	48 89 e5             	mov    %rsp,%rbp
+  801aac:	41 55                	push   %r13
+  801aae:	41 54                	push   %r12
+  801ab0:	53                   	push   %rbx
+  801ab1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ab5:	48 89 fb             	mov    %rdi,%rbx
+  801ab8:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801abb:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  801ac2:	00 00 00 
+  801ac5:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801ac7:	49 39 c5             	cmp    %rax,%r13
+  801aca:	73 0e                	jae    801ada <realloc+0x32>
+}
+  801acc:	48 89 d8             	mov    %rbx,%rax
+  801acf:	48 83 c4 08          	add    $0x8,%rsp
+  801ad3:	5b                   	pop    %rbx
+  801ad4:	41 5c                	pop    %r12
+  801ad6:	41 5d                	pop    %r13
+  801ad8:	5d                   	pop    %rbp
+  801ad9:	c3                   	ret
+  801ada:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801add:	4c 89 ef             	mov    %r13,%rdi
+  801ae0:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  801ae7:	00 00 00 
+  801aea:	ff d0                	call   *%rax
+  801aec:	48 89 c7             	mov    %rax,%rdi
+  801aef:	4c 89 e2             	mov    %r12,%rdx
+  801af2:	48 89 de             	mov    %rbx,%rsi
+  801af5:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+  801b01:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801b04:	48 89 df             	mov    %rbx,%rdi
+  801b07:	48 b8 9d 19 80 00 00 	movabs $0x80199d,%rax
+  801b0e:	00 00 00 
+  801b11:	ff d0                	call   *%rax
+    return newptr;
+  801b13:	4c 89 e3             	mov    %r12,%rbx
+  801b16:	eb b4                	jmp    801acc <realloc+0x24>
+
+0000000000801b18 <strdup>:
+
+char*
+strdup (const char *src) {
+  801b18:	55                   	push   %rbp
+  801b19:	48 89 e5             	mov    %rsp,%rbp
+  801b1c:	41 54                	push   %r12
+  801b1e:	53                   	push   %rbx
+  801b1f:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801b22:	48 b8 10 0b 80 00 00 	movabs $0x800b10,%rax
+  801b29:	00 00 00 
+  801b2c:	ff d0                	call   *%rax
+  801b2e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801b32:	4c 89 e7             	mov    %r12,%rdi
+  801b35:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  801b3c:	00 00 00 
+  801b3f:	ff d0                	call   *%rax
+  801b41:	48 89 c7             	mov    %rax,%rdi
+  801b44:	4c 89 e2             	mov    %r12,%rdx
+  801b47:	48 89 de             	mov    %rbx,%rsi
+  801b4a:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  801b51:	00 00 00 
+  801b54:	ff d0                	call   *%rax
+}
+  801b56:	5b                   	pop    %rbx
+  801b57:	41 5c                	pop    %r12
+  801b59:	5d                   	pop    %rbp
+  801b5a:	c3                   	ret
+
+0000000000801b5b <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801b5b:	55                   	push   %rbp
+  801b5c:	48 89 e5             	mov    %rsp,%rbp
+  801b5f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b60:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b74:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b79:	be 00 00 00 00       	mov    $0x0,%esi
+  801b7e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b84:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b8a:	c9                   	leave
+  801b8b:	c3                   	ret
+
+0000000000801b8c <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801b8c:	55                   	push   %rbp
+  801b8d:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801b90:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801b97:	00 00 00 
+  801b9a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801b9e:	74 26                	je     801bc6 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801ba0:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801ba2:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ba6:	89 c0                	mov    %eax,%eax
+  801ba8:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801bab:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801bb2:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801bb9:	00 00 00 
+  801bbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc1:	48 f7 31             	divq   (%rcx)
+}
+  801bc4:	5d                   	pop    %rbp
+  801bc5:	c3                   	ret
+        freq = get_cpufreq();
+  801bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcb:	48 ba 5b 1b 80 00 00 	movabs $0x801b5b,%rdx
+  801bd2:	00 00 00 
+  801bd5:	ff d2                	call   *%rdx
+  801bd7:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801bde:	00 00 00 
+  801be1:	eb bd                	jmp    801ba0 <get_ticks+0x14>
+
+0000000000801be3 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801be3:	55                   	push   %rbp
+  801be4:	48 89 e5             	mov    %rsp,%rbp
+  801be7:	53                   	push   %rbx
+  801be8:	48 83 ec 08          	sub    $0x8,%rsp
+  801bec:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801bef:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801bf6:	00 00 00 
+  801bf9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801bfd:	74 50                	je     801c4f <sleep+0x6c>
+    asm volatile("rdtsc"
+  801bff:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c01:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c05:	89 c0                	mov    %eax,%eax
+  801c07:	48 89 d6             	mov    %rdx,%rsi
+  801c0a:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801c0d:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c14:	00 00 00 
+  801c17:	48 0f af 18          	imul   (%rax),%rbx
+  801c1b:	48 c1 eb 03          	shr    $0x3,%rbx
+  801c1f:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801c26:	9b c4 20 
+  801c29:	48 89 d8             	mov    %rbx,%rax
+  801c2c:	48 f7 e2             	mul    %rdx
+  801c2f:	48 89 d1             	mov    %rdx,%rcx
+  801c32:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801c36:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c38:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c3c:	89 c0                	mov    %eax,%eax
+  801c3e:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801c41:	48 29 f2             	sub    %rsi,%rdx
+  801c44:	48 39 ca             	cmp    %rcx,%rdx
+  801c47:	72 ed                	jb     801c36 <sleep+0x53>
+}
+  801c49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+        freq = get_cpufreq();
+  801c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c54:	48 ba 5b 1b 80 00 00 	movabs $0x801b5b,%rdx
+  801c5b:	00 00 00 
+  801c5e:	ff d2                	call   *%rdx
+  801c60:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c67:	00 00 00 
+  801c6a:	eb 93                	jmp    801bff <sleep+0x1c>
+
+0000000000801c6c <poll_kbd>:
+
+int poll_kbd() {
+  801c6c:	55                   	push   %rbp
+  801c6d:	48 89 e5             	mov    %rsp,%rbp
+  801c70:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c71:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c85:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801c8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c95:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c9b:	c9                   	leave
+  801c9c:	c3                   	ret
+
+0000000000801c9d <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801c9d:	55                   	push   %rbp
+  801c9e:	48 89 e5             	mov    %rsp,%rbp
+  801ca1:	53                   	push   %rbx
+  801ca2:	49 89 fa             	mov    %rdi,%r10
+  801ca5:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801ca7:	44 89 c6             	mov    %r8d,%esi
+  801caa:	89 cf                	mov    %ecx,%edi
+  801cac:	89 d3                	mov    %edx,%ebx
+  801cae:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801cb0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cb5:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cb8:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801cbc:	cd 30                	int    $0x30
+  801cbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cc2:	c9                   	leave
+  801cc3:	c3                   	ret
+
+0000000000801cc4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cc4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ccb:	ff ff ff 
+  801cce:	48 01 f8             	add    %rdi,%rax
+  801cd1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801cd5:	c3                   	ret
+
+0000000000801cd6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cd6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801cdd:	ff ff ff 
+  801ce0:	48 01 f8             	add    %rdi,%rax
+  801ce3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ce7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801ced:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801cf1:	c3                   	ret
+
+0000000000801cf2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801cf2:	55                   	push   %rbp
+  801cf3:	48 89 e5             	mov    %rsp,%rbp
+  801cf6:	41 57                	push   %r15
+  801cf8:	41 56                	push   %r14
+  801cfa:	41 55                	push   %r13
+  801cfc:	41 54                	push   %r12
+  801cfe:	53                   	push   %rbx
+  801cff:	48 83 ec 08          	sub    $0x8,%rsp
+  801d03:	49 89 ff             	mov    %rdi,%r15
+  801d06:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801d0b:	49 bd a6 3b 80 00 00 	movabs $0x803ba6,%r13
+  801d12:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801d15:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801d1b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801d1e:	48 89 df             	mov    %rbx,%rdi
+  801d21:	41 ff d5             	call   *%r13
+  801d24:	83 e0 04             	and    $0x4,%eax
+  801d27:	74 17                	je     801d40 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801d29:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d30:	4c 39 f3             	cmp    %r14,%rbx
+  801d33:	75 e6                	jne    801d1b <fd_alloc+0x29>
+  801d35:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801d3b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801d40:	4d 89 27             	mov    %r12,(%r15)
+}
+  801d43:	48 83 c4 08          	add    $0x8,%rsp
+  801d47:	5b                   	pop    %rbx
+  801d48:	41 5c                	pop    %r12
+  801d4a:	41 5d                	pop    %r13
+  801d4c:	41 5e                	pop    %r14
+  801d4e:	41 5f                	pop    %r15
+  801d50:	5d                   	pop    %rbp
+  801d51:	c3                   	ret
+
+0000000000801d52 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801d52:	83 ff 1f             	cmp    $0x1f,%edi
+  801d55:	77 39                	ja     801d90 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801d57:	55                   	push   %rbp
+  801d58:	48 89 e5             	mov    %rsp,%rbp
+  801d5b:	41 54                	push   %r12
+  801d5d:	53                   	push   %rbx
+  801d5e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801d61:	48 63 df             	movslq %edi,%rbx
+  801d64:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801d6b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801d6f:	48 89 df             	mov    %rbx,%rdi
+  801d72:	48 b8 a6 3b 80 00 00 	movabs $0x803ba6,%rax
+  801d79:	00 00 00 
+  801d7c:	ff d0                	call   *%rax
+  801d7e:	a8 04                	test   $0x4,%al
+  801d80:	74 14                	je     801d96 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d82:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d8b:	5b                   	pop    %rbx
+  801d8c:	41 5c                	pop    %r12
+  801d8e:	5d                   	pop    %rbp
+  801d8f:	c3                   	ret
+        return -E_INVAL;
+  801d90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d95:	c3                   	ret
+        return -E_INVAL;
+  801d96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d9b:	eb ee                	jmp    801d8b <fd_lookup+0x39>
+
+0000000000801d9d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d9d:	55                   	push   %rbp
+  801d9e:	48 89 e5             	mov    %rsp,%rbp
+  801da1:	41 54                	push   %r12
+  801da3:	53                   	push   %rbx
+  801da4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801da7:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801dae:	00 00 00 
+  801db1:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801db8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801dbb:	39 3b                	cmp    %edi,(%rbx)
+  801dbd:	74 47                	je     801e06 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801dbf:	48 83 c0 08          	add    $0x8,%rax
+  801dc3:	48 8b 18             	mov    (%rax),%rbx
+  801dc6:	48 85 db             	test   %rbx,%rbx
+  801dc9:	75 f0                	jne    801dbb <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801dcb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801dd2:	00 00 00 
+  801dd5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ddb:	89 fa                	mov    %edi,%edx
+  801ddd:	48 bf c8 55 80 00 00 	movabs $0x8055c8,%rdi
+  801de4:	00 00 00 
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dec:	48 b9 d6 01 80 00 00 	movabs $0x8001d6,%rcx
+  801df3:	00 00 00 
+  801df6:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801df8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801dfd:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801e01:	5b                   	pop    %rbx
+  801e02:	41 5c                	pop    %r12
+  801e04:	5d                   	pop    %rbp
+  801e05:	c3                   	ret
+            return 0;
+  801e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0b:	eb f0                	jmp    801dfd <dev_lookup+0x60>
+
+0000000000801e0d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801e0d:	55                   	push   %rbp
+  801e0e:	48 89 e5             	mov    %rsp,%rbp
+  801e11:	41 55                	push   %r13
+  801e13:	41 54                	push   %r12
+  801e15:	53                   	push   %rbx
+  801e16:	48 83 ec 18          	sub    $0x18,%rsp
+  801e1a:	48 89 fb             	mov    %rdi,%rbx
+  801e1d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e20:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801e27:	ff ff ff 
+  801e2a:	48 01 df             	add    %rbx,%rdi
+  801e2d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801e31:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e35:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  801e3c:	00 00 00 
+  801e3f:	ff d0                	call   *%rax
+  801e41:	41 89 c5             	mov    %eax,%r13d
+  801e44:	85 c0                	test   %eax,%eax
+  801e46:	78 06                	js     801e4e <fd_close+0x41>
+  801e48:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801e4c:	74 1a                	je     801e68 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801e4e:	45 84 e4             	test   %r12b,%r12b
+  801e51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e56:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801e5a:	44 89 e8             	mov    %r13d,%eax
+  801e5d:	48 83 c4 18          	add    $0x18,%rsp
+  801e61:	5b                   	pop    %rbx
+  801e62:	41 5c                	pop    %r12
+  801e64:	41 5d                	pop    %r13
+  801e66:	5d                   	pop    %rbp
+  801e67:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e68:	8b 3b                	mov    (%rbx),%edi
+  801e6a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e6e:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  801e75:	00 00 00 
+  801e78:	ff d0                	call   *%rax
+  801e7a:	41 89 c5             	mov    %eax,%r13d
+  801e7d:	85 c0                	test   %eax,%eax
+  801e7f:	78 1b                	js     801e9c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e81:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e85:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e89:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e8f:	48 85 c0             	test   %rax,%rax
+  801e92:	74 08                	je     801e9c <fd_close+0x8f>
+  801e94:	48 89 df             	mov    %rbx,%rdi
+  801e97:	ff d0                	call   *%rax
+  801e99:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ea1:	48 89 de             	mov    %rbx,%rsi
+  801ea4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ea9:	48 b8 8d 14 80 00 00 	movabs $0x80148d,%rax
+  801eb0:	00 00 00 
+  801eb3:	ff d0                	call   *%rax
+    return res;
+  801eb5:	eb a3                	jmp    801e5a <fd_close+0x4d>
+
+0000000000801eb7 <close>:
+
+int
+close(int fdnum) {
+  801eb7:	55                   	push   %rbp
+  801eb8:	48 89 e5             	mov    %rsp,%rbp
+  801ebb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ebf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ec3:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  801eca:	00 00 00 
+  801ecd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ecf:	85 c0                	test   %eax,%eax
+  801ed1:	78 15                	js     801ee8 <close+0x31>
+
+    return fd_close(fd, 1);
+  801ed3:	be 01 00 00 00       	mov    $0x1,%esi
+  801ed8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801edc:	48 b8 0d 1e 80 00 00 	movabs $0x801e0d,%rax
+  801ee3:	00 00 00 
+  801ee6:	ff d0                	call   *%rax
+}
+  801ee8:	c9                   	leave
+  801ee9:	c3                   	ret
+
+0000000000801eea <close_all>:
+
+void
+close_all(void) {
+  801eea:	55                   	push   %rbp
+  801eeb:	48 89 e5             	mov    %rsp,%rbp
+  801eee:	41 54                	push   %r12
+  801ef0:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ef1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ef6:	49 bc b7 1e 80 00 00 	movabs $0x801eb7,%r12
+  801efd:	00 00 00 
+  801f00:	89 df                	mov    %ebx,%edi
+  801f02:	41 ff d4             	call   *%r12
+  801f05:	83 c3 01             	add    $0x1,%ebx
+  801f08:	83 fb 20             	cmp    $0x20,%ebx
+  801f0b:	75 f3                	jne    801f00 <close_all+0x16>
+}
+  801f0d:	5b                   	pop    %rbx
+  801f0e:	41 5c                	pop    %r12
+  801f10:	5d                   	pop    %rbp
+  801f11:	c3                   	ret
+
+0000000000801f12 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801f12:	55                   	push   %rbp
+  801f13:	48 89 e5             	mov    %rsp,%rbp
+  801f16:	41 57                	push   %r15
+  801f18:	41 56                	push   %r14
+  801f1a:	41 55                	push   %r13
+  801f1c:	41 54                	push   %r12
+  801f1e:	53                   	push   %rbx
+  801f1f:	48 83 ec 18          	sub    $0x18,%rsp
+  801f23:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801f26:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801f2a:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  801f31:	00 00 00 
+  801f34:	ff d0                	call   *%rax
+  801f36:	89 c3                	mov    %eax,%ebx
+  801f38:	85 c0                	test   %eax,%eax
+  801f3a:	0f 88 b8 00 00 00    	js     801ff8 <dup+0xe6>
+    close(newfdnum);
+  801f40:	44 89 e7             	mov    %r12d,%edi
+  801f43:	48 b8 b7 1e 80 00 00 	movabs $0x801eb7,%rax
+  801f4a:	00 00 00 
+  801f4d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801f4f:	4d 63 ec             	movslq %r12d,%r13
+  801f52:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801f59:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801f5d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801f61:	4c 89 ff             	mov    %r15,%rdi
+  801f64:	49 be d6 1c 80 00 00 	movabs $0x801cd6,%r14
+  801f6b:	00 00 00 
+  801f6e:	41 ff d6             	call   *%r14
+  801f71:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801f74:	4c 89 ef             	mov    %r13,%rdi
+  801f77:	41 ff d6             	call   *%r14
+  801f7a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801f7d:	48 89 df             	mov    %rbx,%rdi
+  801f80:	48 b8 a6 3b 80 00 00 	movabs $0x803ba6,%rax
+  801f87:	00 00 00 
+  801f8a:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801f8c:	a8 04                	test   $0x4,%al
+  801f8e:	74 2b                	je     801fbb <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801f90:	41 89 c1             	mov    %eax,%r9d
+  801f93:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f99:	4c 89 f1             	mov    %r14,%rcx
+  801f9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa1:	48 89 de             	mov    %rbx,%rsi
+  801fa4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fa9:	48 b8 15 13 80 00 00 	movabs $0x801315,%rax
+  801fb0:	00 00 00 
+  801fb3:	ff d0                	call   *%rax
+  801fb5:	89 c3                	mov    %eax,%ebx
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	78 4e                	js     802009 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801fbb:	4c 89 ff             	mov    %r15,%rdi
+  801fbe:	48 b8 a6 3b 80 00 00 	movabs $0x803ba6,%rax
+  801fc5:	00 00 00 
+  801fc8:	ff d0                	call   *%rax
+  801fca:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801fcd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fd3:	4c 89 e9             	mov    %r13,%rcx
+  801fd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fdb:	4c 89 fe             	mov    %r15,%rsi
+  801fde:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fe3:	48 b8 15 13 80 00 00 	movabs $0x801315,%rax
+  801fea:	00 00 00 
+  801fed:	ff d0                	call   *%rax
+  801fef:	89 c3                	mov    %eax,%ebx
+  801ff1:	85 c0                	test   %eax,%eax
+  801ff3:	78 14                	js     802009 <dup+0xf7>
+
+    return newfdnum;
+  801ff5:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ff8:	89 d8                	mov    %ebx,%eax
+  801ffa:	48 83 c4 18          	add    $0x18,%rsp
+  801ffe:	5b                   	pop    %rbx
+  801fff:	41 5c                	pop    %r12
+  802001:	41 5d                	pop    %r13
+  802003:	41 5e                	pop    %r14
+  802005:	41 5f                	pop    %r15
+  802007:	5d                   	pop    %rbp
+  802008:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802009:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80200e:	4c 89 ee             	mov    %r13,%rsi
+  802011:	bf 00 00 00 00       	mov    $0x0,%edi
+  802016:	49 bc 8d 14 80 00 00 	movabs $0x80148d,%r12
+  80201d:	00 00 00 
+  802020:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802023:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802028:	4c 89 f6             	mov    %r14,%rsi
+  80202b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802030:	41 ff d4             	call   *%r12
+    return res;
+  802033:	eb c3                	jmp    801ff8 <dup+0xe6>
+
+0000000000802035 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802035:	55                   	push   %rbp
+  802036:	48 89 e5             	mov    %rsp,%rbp
+  802039:	41 56                	push   %r14
+  80203b:	41 55                	push   %r13
+  80203d:	41 54                	push   %r12
+  80203f:	53                   	push   %rbx
+  802040:	48 83 ec 10          	sub    $0x10,%rsp
+  802044:	89 fb                	mov    %edi,%ebx
+  802046:	49 89 f4             	mov    %rsi,%r12
+  802049:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80204c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802050:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  802057:	00 00 00 
+  80205a:	ff d0                	call   *%rax
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	78 4c                	js     8020ac <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802060:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802064:	41 8b 3e             	mov    (%r14),%edi
+  802067:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80206b:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  802072:	00 00 00 
+  802075:	ff d0                	call   *%rax
+  802077:	85 c0                	test   %eax,%eax
+  802079:	78 35                	js     8020b0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80207b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80207f:	83 e0 03             	and    $0x3,%eax
+  802082:	83 f8 01             	cmp    $0x1,%eax
+  802085:	74 2d                	je     8020b4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802087:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80208b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80208f:	48 85 c0             	test   %rax,%rax
+  802092:	74 56                	je     8020ea <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802094:	4c 89 ea             	mov    %r13,%rdx
+  802097:	4c 89 e6             	mov    %r12,%rsi
+  80209a:	4c 89 f7             	mov    %r14,%rdi
+  80209d:	ff d0                	call   *%rax
+}
+  80209f:	48 83 c4 10          	add    $0x10,%rsp
+  8020a3:	5b                   	pop    %rbx
+  8020a4:	41 5c                	pop    %r12
+  8020a6:	41 5d                	pop    %r13
+  8020a8:	41 5e                	pop    %r14
+  8020aa:	5d                   	pop    %rbp
+  8020ab:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020ac:	48 98                	cltq
+  8020ae:	eb ef                	jmp    80209f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020b0:	48 98                	cltq
+  8020b2:	eb eb                	jmp    80209f <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020b4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020bb:	00 00 00 
+  8020be:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020c4:	89 da                	mov    %ebx,%edx
+  8020c6:	48 bf 09 56 80 00 00 	movabs $0x805609,%rdi
+  8020cd:	00 00 00 
+  8020d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d5:	48 b9 d6 01 80 00 00 	movabs $0x8001d6,%rcx
+  8020dc:	00 00 00 
+  8020df:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020e1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020e8:	eb b5                	jmp    80209f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020ea:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020f1:	eb ac                	jmp    80209f <read+0x6a>
+
+00000000008020f3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8020f3:	55                   	push   %rbp
+  8020f4:	48 89 e5             	mov    %rsp,%rbp
+  8020f7:	41 57                	push   %r15
+  8020f9:	41 56                	push   %r14
+  8020fb:	41 55                	push   %r13
+  8020fd:	41 54                	push   %r12
+  8020ff:	53                   	push   %rbx
+  802100:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802104:	48 85 d2             	test   %rdx,%rdx
+  802107:	74 54                	je     80215d <readn+0x6a>
+  802109:	41 89 fd             	mov    %edi,%r13d
+  80210c:	49 89 f6             	mov    %rsi,%r14
+  80210f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802112:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802117:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80211c:	49 bf 35 20 80 00 00 	movabs $0x802035,%r15
+  802123:	00 00 00 
+  802126:	4c 89 e2             	mov    %r12,%rdx
+  802129:	48 29 f2             	sub    %rsi,%rdx
+  80212c:	4c 01 f6             	add    %r14,%rsi
+  80212f:	44 89 ef             	mov    %r13d,%edi
+  802132:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802135:	85 c0                	test   %eax,%eax
+  802137:	78 20                	js     802159 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802139:	01 c3                	add    %eax,%ebx
+  80213b:	85 c0                	test   %eax,%eax
+  80213d:	74 08                	je     802147 <readn+0x54>
+  80213f:	48 63 f3             	movslq %ebx,%rsi
+  802142:	4c 39 e6             	cmp    %r12,%rsi
+  802145:	72 df                	jb     802126 <readn+0x33>
+    }
+    return res;
+  802147:	48 63 c3             	movslq %ebx,%rax
+}
+  80214a:	48 83 c4 08          	add    $0x8,%rsp
+  80214e:	5b                   	pop    %rbx
+  80214f:	41 5c                	pop    %r12
+  802151:	41 5d                	pop    %r13
+  802153:	41 5e                	pop    %r14
+  802155:	41 5f                	pop    %r15
+  802157:	5d                   	pop    %rbp
+  802158:	c3                   	ret
+        if (inc < 0) return inc;
+  802159:	48 98                	cltq
+  80215b:	eb ed                	jmp    80214a <readn+0x57>
+    int inc = 1, res = 0;
+  80215d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802162:	eb e3                	jmp    802147 <readn+0x54>
+
+0000000000802164 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802164:	55                   	push   %rbp
+  802165:	48 89 e5             	mov    %rsp,%rbp
+  802168:	41 56                	push   %r14
+  80216a:	41 55                	push   %r13
+  80216c:	41 54                	push   %r12
+  80216e:	53                   	push   %rbx
+  80216f:	48 83 ec 10          	sub    $0x10,%rsp
+  802173:	89 fb                	mov    %edi,%ebx
+  802175:	49 89 f4             	mov    %rsi,%r12
+  802178:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80217b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80217f:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  802186:	00 00 00 
+  802189:	ff d0                	call   *%rax
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	78 47                	js     8021d6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80218f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802193:	41 8b 3e             	mov    (%r14),%edi
+  802196:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80219a:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  8021a1:	00 00 00 
+  8021a4:	ff d0                	call   *%rax
+  8021a6:	85 c0                	test   %eax,%eax
+  8021a8:	78 30                	js     8021da <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021aa:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8021af:	74 2d                	je     8021de <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021b5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8021b9:	48 85 c0             	test   %rax,%rax
+  8021bc:	74 56                	je     802214 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8021be:	4c 89 ea             	mov    %r13,%rdx
+  8021c1:	4c 89 e6             	mov    %r12,%rsi
+  8021c4:	4c 89 f7             	mov    %r14,%rdi
+  8021c7:	ff d0                	call   *%rax
+}
+  8021c9:	48 83 c4 10          	add    $0x10,%rsp
+  8021cd:	5b                   	pop    %rbx
+  8021ce:	41 5c                	pop    %r12
+  8021d0:	41 5d                	pop    %r13
+  8021d2:	41 5e                	pop    %r14
+  8021d4:	5d                   	pop    %rbp
+  8021d5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021d6:	48 98                	cltq
+  8021d8:	eb ef                	jmp    8021c9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021da:	48 98                	cltq
+  8021dc:	eb eb                	jmp    8021c9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021de:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021e5:	00 00 00 
+  8021e8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021ee:	89 da                	mov    %ebx,%edx
+  8021f0:	48 bf 25 56 80 00 00 	movabs $0x805625,%rdi
+  8021f7:	00 00 00 
+  8021fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ff:	48 b9 d6 01 80 00 00 	movabs $0x8001d6,%rcx
+  802206:	00 00 00 
+  802209:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80220b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802212:	eb b5                	jmp    8021c9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802214:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80221b:	eb ac                	jmp    8021c9 <write+0x65>
+
+000000000080221d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80221d:	55                   	push   %rbp
+  80221e:	48 89 e5             	mov    %rsp,%rbp
+  802221:	53                   	push   %rbx
+  802222:	48 83 ec 18          	sub    $0x18,%rsp
+  802226:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802228:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80222c:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  802233:	00 00 00 
+  802236:	ff d0                	call   *%rax
+  802238:	85 c0                	test   %eax,%eax
+  80223a:	78 0c                	js     802248 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80223c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802240:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802243:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802248:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80224c:	c9                   	leave
+  80224d:	c3                   	ret
+
+000000000080224e <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80224e:	55                   	push   %rbp
+  80224f:	48 89 e5             	mov    %rsp,%rbp
+  802252:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802256:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80225a:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  802261:	00 00 00 
+  802264:	ff d0                	call   *%rax
+  802266:	85 c0                	test   %eax,%eax
+  802268:	78 07                	js     802271 <tell+0x23>
+    return fdes->fd_offset;
+  80226a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80226e:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802271:	c9                   	leave
+  802272:	c3                   	ret
+
+0000000000802273 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802273:	55                   	push   %rbp
+  802274:	48 89 e5             	mov    %rsp,%rbp
+  802277:	41 55                	push   %r13
+  802279:	41 54                	push   %r12
+  80227b:	53                   	push   %rbx
+  80227c:	48 83 ec 18          	sub    $0x18,%rsp
+  802280:	89 fb                	mov    %edi,%ebx
+  802282:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802285:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802289:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  802290:	00 00 00 
+  802293:	ff d0                	call   *%rax
+  802295:	85 c0                	test   %eax,%eax
+  802297:	78 38                	js     8022d1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802299:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80229d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8022a1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022a5:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  8022ac:	00 00 00 
+  8022af:	ff d0                	call   *%rax
+  8022b1:	85 c0                	test   %eax,%eax
+  8022b3:	78 1c                	js     8022d1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022b5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8022ba:	74 20                	je     8022dc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022bc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022c0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8022c4:	48 85 c0             	test   %rax,%rax
+  8022c7:	74 47                	je     802310 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8022c9:	44 89 e6             	mov    %r12d,%esi
+  8022cc:	4c 89 ef             	mov    %r13,%rdi
+  8022cf:	ff d0                	call   *%rax
+}
+  8022d1:	48 83 c4 18          	add    $0x18,%rsp
+  8022d5:	5b                   	pop    %rbx
+  8022d6:	41 5c                	pop    %r12
+  8022d8:	41 5d                	pop    %r13
+  8022da:	5d                   	pop    %rbp
+  8022db:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8022dc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022e3:	00 00 00 
+  8022e6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022ec:	89 da                	mov    %ebx,%edx
+  8022ee:	48 bf e8 55 80 00 00 	movabs $0x8055e8,%rdi
+  8022f5:	00 00 00 
+  8022f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022fd:	48 b9 d6 01 80 00 00 	movabs $0x8001d6,%rcx
+  802304:	00 00 00 
+  802307:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802309:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80230e:	eb c1                	jmp    8022d1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802310:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802315:	eb ba                	jmp    8022d1 <ftruncate+0x5e>
+
+0000000000802317 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802317:	55                   	push   %rbp
+  802318:	48 89 e5             	mov    %rsp,%rbp
+  80231b:	41 54                	push   %r12
+  80231d:	53                   	push   %rbx
+  80231e:	48 83 ec 10          	sub    $0x10,%rsp
+  802322:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802325:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802329:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  802330:	00 00 00 
+  802333:	ff d0                	call   *%rax
+  802335:	85 c0                	test   %eax,%eax
+  802337:	78 4e                	js     802387 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802339:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80233d:	41 8b 3c 24          	mov    (%r12),%edi
+  802341:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802345:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  80234c:	00 00 00 
+  80234f:	ff d0                	call   *%rax
+  802351:	85 c0                	test   %eax,%eax
+  802353:	78 32                	js     802387 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802355:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802359:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80235e:	74 30                	je     802390 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802360:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802363:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80236a:	00 00 00 
+    stat->st_isdir = 0;
+  80236d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802374:	00 00 00 
+    stat->st_dev = dev;
+  802377:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80237e:	48 89 de             	mov    %rbx,%rsi
+  802381:	4c 89 e7             	mov    %r12,%rdi
+  802384:	ff 50 28             	call   *0x28(%rax)
+}
+  802387:	48 83 c4 10          	add    $0x10,%rsp
+  80238b:	5b                   	pop    %rbx
+  80238c:	41 5c                	pop    %r12
+  80238e:	5d                   	pop    %rbp
+  80238f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802390:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802395:	eb f0                	jmp    802387 <fstat+0x70>
+
+0000000000802397 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802397:	55                   	push   %rbp
+  802398:	48 89 e5             	mov    %rsp,%rbp
+  80239b:	41 54                	push   %r12
+  80239d:	53                   	push   %rbx
+  80239e:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8023a5:	41 89 fc             	mov    %edi,%r12d
+  8023a8:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023aa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023ae:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  8023b5:	00 00 00 
+  8023b8:	ff d0                	call   *%rax
+  8023ba:	85 c0                	test   %eax,%eax
+  8023bc:	78 31                	js     8023ef <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8023be:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8023c5:	44 89 e7             	mov    %r12d,%edi
+  8023c8:	48 b8 17 23 80 00 00 	movabs $0x802317,%rax
+  8023cf:	00 00 00 
+  8023d2:	ff d0                	call   *%rax
+  8023d4:	85 c0                	test   %eax,%eax
+  8023d6:	78 17                	js     8023ef <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8023d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023dc:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8023df:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8023e2:	39 d3                	cmp    %edx,%ebx
+  8023e4:	0f 4f da             	cmovg  %edx,%ebx
+  8023e7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023ef:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8023f6:	5b                   	pop    %rbx
+  8023f7:	41 5c                	pop    %r12
+  8023f9:	5d                   	pop    %rbp
+  8023fa:	c3                   	ret
+
+00000000008023fb <seektoend>:
+{
+  8023fb:	55                   	push   %rbp
+  8023fc:	48 89 e5             	mov    %rsp,%rbp
+  8023ff:	53                   	push   %rbx
+  802400:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802407:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802409:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80240d:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  802414:	00 00 00 
+  802417:	ff d0                	call   *%rax
+  802419:	85 c0                	test   %eax,%eax
+  80241b:	78 28                	js     802445 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80241d:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802424:	89 df                	mov    %ebx,%edi
+  802426:	48 b8 17 23 80 00 00 	movabs $0x802317,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+  802432:	85 c0                	test   %eax,%eax
+  802434:	78 0f                	js     802445 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802436:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802439:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80243d:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802440:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802445:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802449:	c9                   	leave
+  80244a:	c3                   	ret
+
+000000000080244b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80244b:	55                   	push   %rbp
+  80244c:	48 89 e5             	mov    %rsp,%rbp
+  80244f:	41 54                	push   %r12
+  802451:	53                   	push   %rbx
+  802452:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802455:	be 00 00 00 00       	mov    $0x0,%esi
+  80245a:	48 b8 3e 30 80 00 00 	movabs $0x80303e,%rax
+  802461:	00 00 00 
+  802464:	ff d0                	call   *%rax
+  802466:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802468:	85 c0                	test   %eax,%eax
+  80246a:	78 25                	js     802491 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80246c:	4c 89 e6             	mov    %r12,%rsi
+  80246f:	89 c7                	mov    %eax,%edi
+  802471:	48 b8 17 23 80 00 00 	movabs $0x802317,%rax
+  802478:	00 00 00 
+  80247b:	ff d0                	call   *%rax
+  80247d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802480:	89 df                	mov    %ebx,%edi
+  802482:	48 b8 b7 1e 80 00 00 	movabs $0x801eb7,%rax
+  802489:	00 00 00 
+  80248c:	ff d0                	call   *%rax
+
+    return res;
+  80248e:	44 89 e3             	mov    %r12d,%ebx
+}
+  802491:	89 d8                	mov    %ebx,%eax
+  802493:	5b                   	pop    %rbx
+  802494:	41 5c                	pop    %r12
+  802496:	5d                   	pop    %rbp
+  802497:	c3                   	ret
+
+0000000000802498 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802498:	55                   	push   %rbp
+  802499:	48 89 e5             	mov    %rsp,%rbp
+  80249c:	53                   	push   %rbx
+  80249d:	48 83 ec 08          	sub    $0x8,%rsp
+  8024a1:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8024a4:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  8024ab:	00 00 00 
+  8024ae:	ff d0                	call   *%rax
+  8024b0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8024b4:	0f 87 ea 00 00 00    	ja     8025a4 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8024ba:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024c1:	00 00 00 
+  8024c4:	80 38 00             	cmpb   $0x0,(%rax)
+  8024c7:	75 35                	jne    8024fe <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8024c9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8024ce:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8024d3:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8024d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024dd:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  8024e4:	00 00 00 
+  8024e7:	ff d0                	call   *%rax
+  8024e9:	85 c0                	test   %eax,%eax
+  8024eb:	0f 88 ba 00 00 00    	js     8025ab <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8024f1:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024f8:	00 00 00 
+  8024fb:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8024fe:	48 89 df             	mov    %rbx,%rdi
+  802501:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  802508:	00 00 00 
+  80250b:	ff d0                	call   *%rax
+  80250d:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802511:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802518:	00 00 00 
+  80251b:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80251f:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802522:	39 39                	cmp    %edi,(%rcx)
+  802524:	74 46                	je     80256c <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802526:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80252a:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802531:	00 
+  802532:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802539:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802540:	00 
+  802541:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802548:	00 
+  802549:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802550:	00 
+  802551:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802558:	00 
+  802559:	89 39                	mov    %edi,(%rcx)
+  80255b:	48 01 c6             	add    %rax,%rsi
+  80255e:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802563:	48 89 c8             	mov    %rcx,%rax
+  802566:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80256a:	c9                   	leave
+  80256b:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80256c:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802570:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802577:	00 00 00 
+  80257a:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80257d:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802581:	74 e0                	je     802563 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802583:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80258a:	00 
+  80258b:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80258f:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802596:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802598:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80259b:	48 01 c2             	add    %rax,%rdx
+  80259e:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8025a2:	eb bf                	jmp    802563 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8025a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a9:	eb b8                	jmp    802563 <fbuf_get+0xcb>
+            return NULL;
+  8025ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025b0:	eb b1                	jmp    802563 <fbuf_get+0xcb>
+
+00000000008025b2 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8025b2:	55                   	push   %rbp
+  8025b3:	48 89 e5             	mov    %rsp,%rbp
+  8025b6:	53                   	push   %rbx
+  8025b7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8025bb:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025c2:	00 00 00 
+  8025c5:	48 8b 18             	mov    (%rax),%rbx
+  8025c8:	48 85 db             	test   %rbx,%rbx
+  8025cb:	74 16                	je     8025e3 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8025cd:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025d4:	00 00 00 
+  8025d7:	48 8b 18             	mov    (%rax),%rbx
+}
+  8025da:	48 89 d8             	mov    %rbx,%rax
+  8025dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025e1:	c9                   	leave
+  8025e2:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8025e3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8025e8:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8025ed:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8025f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025f7:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  8025fe:	00 00 00 
+  802601:	ff d0                	call   *%rax
+  802603:	85 c0                	test   %eax,%eax
+  802605:	78 d3                	js     8025da <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802607:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  80260c:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802613:	00 00 00 
+  802616:	eb b5                	jmp    8025cd <fsipc_bulk+0x1b>
+
+0000000000802618 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802618:	55                   	push   %rbp
+  802619:	48 89 e5             	mov    %rsp,%rbp
+  80261c:	41 57                	push   %r15
+  80261e:	41 56                	push   %r14
+  802620:	41 55                	push   %r13
+  802622:	41 54                	push   %r12
+  802624:	53                   	push   %rbx
+  802625:	48 83 ec 08          	sub    $0x8,%rsp
+  802629:	41 89 fd             	mov    %edi,%r13d
+  80262c:	49 89 f6             	mov    %rsi,%r14
+  80262f:	49 89 d7             	mov    %rdx,%r15
+  802632:	48 89 cb             	mov    %rcx,%rbx
+  802635:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802638:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80263f:	00 00 00 
+  802642:	83 38 00             	cmpl   $0x0,(%rax)
+  802645:	74 52                	je     802699 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802647:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80264d:	4c 89 f9             	mov    %r15,%rcx
+  802650:	4c 89 f2             	mov    %r14,%rdx
+  802653:	44 89 ee             	mov    %r13d,%esi
+  802656:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80265d:	00 00 00 
+  802660:	8b 38                	mov    (%rax),%edi
+  802662:	48 b8 a0 41 80 00 00 	movabs $0x8041a0,%rax
+  802669:	00 00 00 
+  80266c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80266e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802673:	4c 89 e2             	mov    %r12,%rdx
+  802676:	48 89 de             	mov    %rbx,%rsi
+  802679:	bf 00 00 00 00       	mov    $0x0,%edi
+  80267e:	48 b8 f0 3f 80 00 00 	movabs $0x803ff0,%rax
+  802685:	00 00 00 
+  802688:	ff d0                	call   *%rax
+}
+  80268a:	48 83 c4 08          	add    $0x8,%rsp
+  80268e:	5b                   	pop    %rbx
+  80268f:	41 5c                	pop    %r12
+  802691:	41 5d                	pop    %r13
+  802693:	41 5e                	pop    %r14
+  802695:	41 5f                	pop    %r15
+  802697:	5d                   	pop    %rbp
+  802698:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802699:	bf 03 00 00 00       	mov    $0x3,%edi
+  80269e:	48 b8 43 42 80 00 00 	movabs $0x804243,%rax
+  8026a5:	00 00 00 
+  8026a8:	ff d0                	call   *%rax
+  8026aa:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8026b1:	00 00 
+  8026b3:	eb 92                	jmp    802647 <fsipc_region+0x2f>
+
+00000000008026b5 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8026b5:	55                   	push   %rbp
+  8026b6:	48 89 e5             	mov    %rsp,%rbp
+  8026b9:	41 57                	push   %r15
+  8026bb:	41 56                	push   %r14
+  8026bd:	41 55                	push   %r13
+  8026bf:	41 54                	push   %r12
+  8026c1:	53                   	push   %rbx
+  8026c2:	48 83 ec 28          	sub    $0x28,%rsp
+  8026c6:	49 89 ff             	mov    %rdi,%r15
+  8026c9:	49 89 f6             	mov    %rsi,%r14
+  8026cc:	48 89 d3             	mov    %rdx,%rbx
+  8026cf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026d3:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8026d6:	48 b8 b2 25 80 00 00 	movabs $0x8025b2,%rax
+  8026dd:	00 00 00 
+  8026e0:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8026e2:	48 85 c0             	test   %rax,%rax
+  8026e5:	0f 84 cc 00 00 00    	je     8027b7 <devfile_write_direct+0x102>
+  8026eb:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8026ee:	48 85 db             	test   %rbx,%rbx
+  8026f1:	0f 84 ba 00 00 00    	je     8027b1 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8026f7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8026fd:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802704:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802708:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80270c:	4c 29 e3             	sub    %r12,%rbx
+  80270f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802714:	48 39 c3             	cmp    %rax,%rbx
+  802717:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80271b:	48 89 da             	mov    %rbx,%rdx
+  80271e:	4c 89 f6             	mov    %r14,%rsi
+  802721:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802725:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  80272c:	00 00 00 
+  80272f:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802731:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802735:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802739:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80273c:	44 01 e0             	add    %r12d,%eax
+  80273f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802743:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802747:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80274e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802755:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80275c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802762:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802767:	4c 89 ee             	mov    %r13,%rsi
+  80276a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80276f:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  802776:	00 00 00 
+  802779:	ff d0                	call   *%rax
+        if (res < 0)
+  80277b:	85 c0                	test   %eax,%eax
+  80277d:	78 29                	js     8027a8 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80277f:	74 2b                	je     8027ac <devfile_write_direct+0xf7>
+        i += res;
+  802781:	48 98                	cltq
+  802783:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802786:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802789:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80278d:	49 39 c4             	cmp    %rax,%r12
+  802790:	0f 82 72 ff ff ff    	jb     802708 <devfile_write_direct+0x53>
+    return i;
+  802796:	4c 89 e0             	mov    %r12,%rax
+}
+  802799:	48 83 c4 28          	add    $0x28,%rsp
+  80279d:	5b                   	pop    %rbx
+  80279e:	41 5c                	pop    %r12
+  8027a0:	41 5d                	pop    %r13
+  8027a2:	41 5e                	pop    %r14
+  8027a4:	41 5f                	pop    %r15
+  8027a6:	5d                   	pop    %rbp
+  8027a7:	c3                   	ret
+            return res;
+  8027a8:	48 98                	cltq
+  8027aa:	eb ed                	jmp    802799 <devfile_write_direct+0xe4>
+            return i;
+  8027ac:	4c 89 e0             	mov    %r12,%rax
+  8027af:	eb e8                	jmp    802799 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8027b1:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8027b5:	eb df                	jmp    802796 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8027b7:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8027be:	eb d9                	jmp    802799 <devfile_write_direct+0xe4>
+
+00000000008027c0 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8027c0:	55                   	push   %rbp
+  8027c1:	48 89 e5             	mov    %rsp,%rbp
+  8027c4:	41 56                	push   %r14
+  8027c6:	41 55                	push   %r13
+  8027c8:	41 54                	push   %r12
+  8027ca:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8027cb:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8027cf:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8027d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d8:	4d 39 ee             	cmp    %r13,%r14
+  8027db:	0f 84 99 00 00 00    	je     80287a <fbuf_flush+0xba>
+  8027e1:	49 89 fc             	mov    %rdi,%r12
+  8027e4:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8027e7:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8027ea:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8027ee:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  8027f5:	00 00 00 
+  8027f8:	ff d0                	call   *%rax
+  8027fa:	48 89 c2             	mov    %rax,%rdx
+  8027fd:	48 c1 e2 04          	shl    $0x4,%rdx
+  802801:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802805:	48 c1 e0 0c          	shl    $0xc,%rax
+  802809:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80280e:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802811:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802815:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80281c:	00 
+  80281d:	44 89 f1             	mov    %r14d,%ecx
+  802820:	4c 89 ea             	mov    %r13,%rdx
+  802823:	4c 89 e7             	mov    %r12,%rdi
+  802826:	48 b8 b5 26 80 00 00 	movabs $0x8026b5,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802832:	48 85 c0             	test   %rax,%rax
+  802835:	78 43                	js     80287a <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802837:	4c 39 e8             	cmp    %r13,%rax
+  80283a:	72 47                	jb     802883 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80283c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802841:	83 c0 01             	add    $0x1,%eax
+  802844:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802849:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80284c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802850:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802854:	72 0f                	jb     802865 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802856:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80285a:	48 39 c2             	cmp    %rax,%rdx
+  80285d:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802861:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802865:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80286c:	00 
+  80286d:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802874:	00 
+    return 0;
+  802875:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80287a:	5b                   	pop    %rbx
+  80287b:	41 5c                	pop    %r12
+  80287d:	41 5d                	pop    %r13
+  80287f:	41 5e                	pop    %r14
+  802881:	5d                   	pop    %rbp
+  802882:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802883:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802888:	eb f0                	jmp    80287a <fbuf_flush+0xba>
+
+000000000080288a <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80288a:	55                   	push   %rbp
+  80288b:	48 89 e5             	mov    %rsp,%rbp
+  80288e:	53                   	push   %rbx
+  80288f:	48 83 ec 08          	sub    $0x8,%rsp
+  802893:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802896:	48 b8 98 24 80 00 00 	movabs $0x802498,%rax
+  80289d:	00 00 00 
+  8028a0:	ff d0                	call   *%rax
+  8028a2:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  8028a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028aa:	48 85 f6             	test   %rsi,%rsi
+  8028ad:	74 0f                	je     8028be <devfile_sync+0x34>
+  8028af:	48 89 df             	mov    %rbx,%rdi
+  8028b2:	48 b8 c0 27 80 00 00 	movabs $0x8027c0,%rax
+  8028b9:	00 00 00 
+  8028bc:	ff d0                	call   *%rax
+}
+  8028be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028c2:	c9                   	leave
+  8028c3:	c3                   	ret
+
+00000000008028c4 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8028cc:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8028cf:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8028d6:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8028d7:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8028db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028e0:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8028e7:	00 00 00 
+  8028ea:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  8028f1:	00 00 00 
+  8028f4:	ff d0                	call   *%rax
+}
+  8028f6:	c9                   	leave
+  8028f7:	c3                   	ret
+
+00000000008028f8 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8028f8:	55                   	push   %rbp
+  8028f9:	48 89 e5             	mov    %rsp,%rbp
+  8028fc:	41 54                	push   %r12
+  8028fe:	53                   	push   %rbx
+  8028ff:	48 89 fb             	mov    %rdi,%rbx
+  802902:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802905:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  80290c:	00 00 00 
+  80290f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802911:	85 c0                	test   %eax,%eax
+  802913:	78 63                	js     802978 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802915:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802918:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80291f:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802921:	be 00 00 00 00       	mov    $0x0,%esi
+  802926:	bf 05 00 00 00       	mov    $0x5,%edi
+  80292b:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  802932:	00 00 00 
+  802935:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802937:	85 c0                	test   %eax,%eax
+  802939:	78 3d                	js     802978 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80293b:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802942:	00 00 00 
+  802945:	48 89 de             	mov    %rbx,%rsi
+  802948:	4c 89 e7             	mov    %r12,%rdi
+  80294b:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  802952:	00 00 00 
+  802955:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802957:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80295d:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802964:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802965:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80296b:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802972:	00 
+
+    return 0;
+  802973:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802978:	5b                   	pop    %rbx
+  802979:	41 5c                	pop    %r12
+  80297b:	5d                   	pop    %rbp
+  80297c:	c3                   	ret
+
+000000000080297d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80297d:	55                   	push   %rbp
+  80297e:	48 89 e5             	mov    %rsp,%rbp
+  802981:	41 54                	push   %r12
+  802983:	53                   	push   %rbx
+  802984:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802987:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  80298e:	00 00 00 
+  802991:	ff d0                	call   *%rax
+  802993:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802996:	48 89 df             	mov    %rbx,%rdi
+  802999:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  8029a0:	00 00 00 
+  8029a3:	ff d0                	call   *%rax
+  8029a5:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8029a9:	76 2e                	jbe    8029d9 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  8029ab:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8029ae:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8029b5:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8029b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029bc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029c1:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  8029c8:	00 00 00 
+  8029cb:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8029cd:	45 85 e4             	test   %r12d,%r12d
+  8029d0:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8029d4:	5b                   	pop    %rbx
+  8029d5:	41 5c                	pop    %r12
+  8029d7:	5d                   	pop    %rbp
+  8029d8:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8029d9:	48 89 df             	mov    %rbx,%rdi
+  8029dc:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  8029e3:	00 00 00 
+  8029e6:	ff d0                	call   *%rax
+  8029e8:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8029ec:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8029f3:	00 00 00 
+  8029f6:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8029fd:	48 89 df             	mov    %rbx,%rdi
+  802a00:	48 b8 d6 1c 80 00 00 	movabs $0x801cd6,%rax
+  802a07:	00 00 00 
+  802a0a:	ff d0                	call   *%rax
+  802a0c:	48 89 c6             	mov    %rax,%rsi
+  802a0f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a14:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a19:	48 b8 8d 14 80 00 00 	movabs $0x80148d,%rax
+  802a20:	00 00 00 
+  802a23:	ff d0                	call   *%rax
+  802a25:	eb 84                	jmp    8029ab <devfile_flush+0x2e>
+
+0000000000802a27 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802a27:	55                   	push   %rbp
+  802a28:	48 89 e5             	mov    %rsp,%rbp
+  802a2b:	41 55                	push   %r13
+  802a2d:	41 54                	push   %r12
+  802a2f:	53                   	push   %rbx
+  802a30:	48 83 ec 08          	sub    $0x8,%rsp
+  802a34:	48 89 fb             	mov    %rdi,%rbx
+  802a37:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802a3a:	48 b8 98 24 80 00 00 	movabs $0x802498,%rax
+  802a41:	00 00 00 
+  802a44:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802a46:	48 85 c0             	test   %rax,%rax
+  802a49:	74 51                	je     802a9c <devfile_trunc+0x75>
+  802a4b:	49 89 c4             	mov    %rax,%r12
+  802a4e:	48 89 c6             	mov    %rax,%rsi
+  802a51:	48 89 df             	mov    %rbx,%rdi
+  802a54:	48 b8 c0 27 80 00 00 	movabs $0x8027c0,%rax
+  802a5b:	00 00 00 
+  802a5e:	ff d0                	call   *%rax
+  802a60:	85 c0                	test   %eax,%eax
+  802a62:	78 2d                	js     802a91 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a64:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802a6b:	00 00 00 
+  802a6e:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802a71:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802a73:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802a77:	be 00 00 00 00       	mov    $0x0,%esi
+  802a7c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a81:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  802a88:	00 00 00 
+  802a8b:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802a8d:	85 c0                	test   %eax,%eax
+  802a8f:	79 3e                	jns    802acf <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802a91:	48 83 c4 08          	add    $0x8,%rsp
+  802a95:	5b                   	pop    %rbx
+  802a96:	41 5c                	pop    %r12
+  802a98:	41 5d                	pop    %r13
+  802a9a:	5d                   	pop    %rbp
+  802a9b:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a9c:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802aa3:	00 00 00 
+  802aa6:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802aa9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802aab:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802aaf:	be 00 00 00 00       	mov    $0x0,%esi
+  802ab4:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ab9:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  802ac0:	00 00 00 
+  802ac3:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ac5:	85 c0                	test   %eax,%eax
+  802ac7:	78 c8                	js     802a91 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ac9:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802acd:	eb c2                	jmp    802a91 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802acf:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802ad2:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ad5:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ad8:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802add:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802ae4:	00 00 
+  802ae6:	eb a9                	jmp    802a91 <devfile_trunc+0x6a>
+
+0000000000802ae8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802ae8:	55                   	push   %rbp
+  802ae9:	48 89 e5             	mov    %rsp,%rbp
+  802aec:	41 57                	push   %r15
+  802aee:	41 56                	push   %r14
+  802af0:	41 55                	push   %r13
+  802af2:	41 54                	push   %r12
+  802af4:	53                   	push   %rbx
+  802af5:	48 83 ec 28          	sub    $0x28,%rsp
+  802af9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802afd:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802b01:	49 89 d7             	mov    %rdx,%r15
+  802b04:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802b08:	48 b8 98 24 80 00 00 	movabs $0x802498,%rax
+  802b0f:	00 00 00 
+  802b12:	ff d0                	call   *%rax
+  802b14:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802b17:	48 85 c0             	test   %rax,%rax
+  802b1a:	74 31                	je     802b4d <devfile_write+0x65>
+  802b1c:	4c 89 f8             	mov    %r15,%rax
+  802b1f:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802b26:	77 25                	ja     802b4d <devfile_write+0x65>
+    size_t i = 0;
+  802b28:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802b2e:	48 85 c0             	test   %rax,%rax
+  802b31:	0f 85 64 01 00 00    	jne    802c9b <devfile_write+0x1b3>
+    size_t i = 0;
+  802b37:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802b3b:	4c 89 f8             	mov    %r15,%rax
+}
+  802b3e:	48 83 c4 28          	add    $0x28,%rsp
+  802b42:	5b                   	pop    %rbx
+  802b43:	41 5c                	pop    %r12
+  802b45:	41 5d                	pop    %r13
+  802b47:	41 5e                	pop    %r14
+  802b49:	41 5f                	pop    %r15
+  802b4b:	5d                   	pop    %rbp
+  802b4c:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802b4d:	48 85 db             	test   %rbx,%rbx
+  802b50:	74 5b                	je     802bad <devfile_write+0xc5>
+  802b52:	48 89 de             	mov    %rbx,%rsi
+  802b55:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b59:	48 b8 c0 27 80 00 00 	movabs $0x8027c0,%rax
+  802b60:	00 00 00 
+  802b63:	ff d0                	call   *%rax
+  802b65:	85 c0                	test   %eax,%eax
+  802b67:	78 40                	js     802ba9 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802b69:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b6d:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802b70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b74:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802b78:	48 b8 b5 26 80 00 00 	movabs $0x8026b5,%rax
+  802b7f:	00 00 00 
+  802b82:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802b84:	48 85 c0             	test   %rax,%rax
+  802b87:	7e b5                	jle    802b3e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802b89:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802b8d:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802b90:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802b93:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802b96:	8d 51 01             	lea    0x1(%rcx),%edx
+  802b99:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802b9c:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802b9f:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802ba6:	00 
+  802ba7:	eb 95                	jmp    802b3e <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ba9:	48 98                	cltq
+  802bab:	eb 91                	jmp    802b3e <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802bad:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802bb1:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802bb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bb8:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802bbc:	48 89 df             	mov    %rbx,%rdi
+  802bbf:	48 b8 b5 26 80 00 00 	movabs $0x8026b5,%rax
+  802bc6:	00 00 00 
+  802bc9:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802bcb:	48 85 c0             	test   %rax,%rax
+  802bce:	0f 8e 6a ff ff ff    	jle    802b3e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802bd4:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802bd7:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802bdb:	e9 5e ff ff ff       	jmp    802b3e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802be0:	48 98                	cltq
+  802be2:	4d 85 ff             	test   %r15,%r15
+  802be5:	49 0f 45 c7          	cmovne %r15,%rax
+  802be9:	e9 50 ff ff ff       	jmp    802b3e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802bee:	48 89 de             	mov    %rbx,%rsi
+  802bf1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802bf5:	48 b8 c0 27 80 00 00 	movabs $0x8027c0,%rax
+  802bfc:	00 00 00 
+  802bff:	ff d0                	call   *%rax
+  802c01:	85 c0                	test   %eax,%eax
+  802c03:	0f 88 2b 01 00 00    	js     802d34 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802c09:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c0d:	4c 01 f8             	add    %r15,%rax
+  802c10:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c14:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c18:	48 b9 c4 1c 80 00 00 	movabs $0x801cc4,%rcx
+  802c1f:	00 00 00 
+  802c22:	ff d1                	call   *%rcx
+  802c24:	48 89 c2             	mov    %rax,%rdx
+  802c27:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c2b:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c2f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c33:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802c38:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802c3b:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802c42:	00 
+  802c43:	4c 89 ea             	mov    %r13,%rdx
+  802c46:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802c4a:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  802c51:	00 00 00 
+  802c54:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802c56:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c5a:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802c5e:	48 39 c2             	cmp    %rax,%rdx
+  802c61:	0f 84 db 00 00 00    	je     802d42 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802c67:	4c 39 e2             	cmp    %r12,%rdx
+  802c6a:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802c6e:	4d 01 ec             	add    %r13,%r12
+  802c71:	49 39 c4             	cmp    %rax,%r12
+  802c74:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802c78:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802c7c:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802c80:	45 01 ee             	add    %r13d,%r14d
+  802c83:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c87:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802c8b:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802c8e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c92:	49 39 c7             	cmp    %rax,%r15
+  802c95:	0f 83 a0 fe ff ff    	jae    802b3b <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802c9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c9f:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802ca3:	8b 43 08             	mov    0x8(%rbx),%eax
+  802ca6:	44 39 f0             	cmp    %r14d,%eax
+  802ca9:	7f 10                	jg     802cbb <devfile_write+0x1d3>
+  802cab:	48 98                	cltq
+  802cad:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802cb3:	49 63 d6             	movslq %r14d,%rdx
+  802cb6:	48 39 d0             	cmp    %rdx,%rax
+  802cb9:	7d 2d                	jge    802ce8 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802cbb:	48 89 de             	mov    %rbx,%rsi
+  802cbe:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802cc2:	48 b8 c0 27 80 00 00 	movabs $0x8027c0,%rax
+  802cc9:	00 00 00 
+  802ccc:	ff d0                	call   *%rax
+  802cce:	85 c0                	test   %eax,%eax
+  802cd0:	0f 88 0a ff ff ff    	js     802be0 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802cd6:	44 89 f0             	mov    %r14d,%eax
+  802cd9:	66 b8 00 00          	mov    $0x0,%ax
+  802cdd:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802ce0:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802ce7:	00 
+        size_t off = pos - fb->fb_base;
+  802ce8:	45 89 f4             	mov    %r14d,%r12d
+  802ceb:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802cef:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802cf2:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802cf6:	4d 29 fd             	sub    %r15,%r13
+  802cf9:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802cfe:	4c 29 e0             	sub    %r12,%rax
+  802d01:	49 39 c5             	cmp    %rax,%r13
+  802d04:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802d08:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802d0c:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802d10:	48 39 c2             	cmp    %rax,%rdx
+  802d13:	0f 84 f0 fe ff ff    	je     802c09 <devfile_write+0x121>
+  802d19:	4c 39 e0             	cmp    %r12,%rax
+  802d1c:	0f 82 cc fe ff ff    	jb     802bee <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802d22:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d26:	48 39 d0             	cmp    %rdx,%rax
+  802d29:	0f 83 da fe ff ff    	jae    802c09 <devfile_write+0x121>
+  802d2f:	e9 ba fe ff ff       	jmp    802bee <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d34:	48 98                	cltq
+  802d36:	4d 85 ff             	test   %r15,%r15
+  802d39:	49 0f 45 c7          	cmovne %r15,%rax
+  802d3d:	e9 fc fd ff ff       	jmp    802b3e <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802d42:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d46:	4c 89 e2             	mov    %r12,%rdx
+  802d49:	e9 2a ff ff ff       	jmp    802c78 <devfile_write+0x190>
+
+0000000000802d4e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d4e:	55                   	push   %rbp
+  802d4f:	48 89 e5             	mov    %rsp,%rbp
+  802d52:	41 57                	push   %r15
+  802d54:	41 56                	push   %r14
+  802d56:	41 55                	push   %r13
+  802d58:	41 54                	push   %r12
+  802d5a:	53                   	push   %rbx
+  802d5b:	48 83 ec 28          	sub    $0x28,%rsp
+  802d5f:	49 89 ff             	mov    %rdi,%r15
+  802d62:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d66:	48 89 d3             	mov    %rdx,%rbx
+  802d69:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802d6d:	48 b8 98 24 80 00 00 	movabs $0x802498,%rax
+  802d74:	00 00 00 
+  802d77:	ff d0                	call   *%rax
+  802d79:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802d7c:	48 85 c0             	test   %rax,%rax
+  802d7f:	74 0d                	je     802d8e <devfile_read+0x40>
+  802d81:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802d88:	0f 86 1a 01 00 00    	jbe    802ea8 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d8e:	4d 85 e4             	test   %r12,%r12
+  802d91:	74 1a                	je     802dad <devfile_read+0x5f>
+  802d93:	4c 89 e6             	mov    %r12,%rsi
+  802d96:	4c 89 ff             	mov    %r15,%rdi
+  802d99:	48 b8 c0 27 80 00 00 	movabs $0x8027c0,%rax
+  802da0:	00 00 00 
+  802da3:	ff d0                	call   *%rax
+  802da5:	85 c0                	test   %eax,%eax
+  802da7:	0f 88 e8 00 00 00    	js     802e95 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802dad:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802db1:	48 b8 b2 25 80 00 00 	movabs $0x8025b2,%rax
+  802db8:	00 00 00 
+  802dbb:	ff d0                	call   *%rax
+  802dbd:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802dc0:	48 85 c0             	test   %rax,%rax
+  802dc3:	0f 84 69 02 00 00    	je     803032 <devfile_read+0x2e4>
+    while (i < n) {
+  802dc9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802dce:	0f 84 ce 00 00 00    	je     802ea2 <devfile_read+0x154>
+    size_t i = 0;
+  802dd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802dd9:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802de0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802de4:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802de8:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802dec:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802df0:	48 29 da             	sub    %rbx,%rdx
+  802df3:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802df8:	48 39 c2             	cmp    %rax,%rdx
+  802dfb:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802dff:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e03:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802e07:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802e0a:	01 d8                	add    %ebx,%eax
+  802e0c:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802e10:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802e14:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802e1b:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e22:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802e29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e34:	4c 89 ee             	mov    %r13,%rsi
+  802e37:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e3c:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  802e43:	00 00 00 
+  802e46:	ff d0                	call   *%rax
+        if (res < 0)
+  802e48:	85 c0                	test   %eax,%eax
+  802e4a:	78 4d                	js     802e99 <devfile_read+0x14b>
+        if (res == 0)
+  802e4c:	74 4f                	je     802e9d <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802e4e:	4c 63 e0             	movslq %eax,%r12
+  802e51:	4c 89 e2             	mov    %r12,%rdx
+  802e54:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802e58:	4c 89 f7             	mov    %r14,%rdi
+  802e5b:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  802e62:	00 00 00 
+  802e65:	ff d0                	call   *%rax
+        i += res;
+  802e67:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  802e6a:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  802e6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e71:	48 39 c3             	cmp    %rax,%rbx
+  802e74:	0f 82 72 ff ff ff    	jb     802dec <devfile_read+0x9e>
+    return i;
+  802e7a:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802e7d:	48 85 c0             	test   %rax,%rax
+  802e80:	7e 04                	jle    802e86 <devfile_read+0x138>
+  802e82:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  802e86:	48 83 c4 28          	add    $0x28,%rsp
+  802e8a:	5b                   	pop    %rbx
+  802e8b:	41 5c                	pop    %r12
+  802e8d:	41 5d                	pop    %r13
+  802e8f:	41 5e                	pop    %r14
+  802e91:	41 5f                	pop    %r15
+  802e93:	5d                   	pop    %rbp
+  802e94:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e95:	48 98                	cltq
+  802e97:	eb ed                	jmp    802e86 <devfile_read+0x138>
+            return res;
+  802e99:	48 98                	cltq
+  802e9b:	eb e9                	jmp    802e86 <devfile_read+0x138>
+            return i;
+  802e9d:	48 89 d8             	mov    %rbx,%rax
+  802ea0:	eb db                	jmp    802e7d <devfile_read+0x12f>
+    size_t i = 0;
+  802ea2:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802ea6:	eb d2                	jmp    802e7a <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802ea8:	48 89 c6             	mov    %rax,%rsi
+  802eab:	4c 89 ff             	mov    %r15,%rdi
+  802eae:	48 b8 c0 27 80 00 00 	movabs $0x8027c0,%rax
+  802eb5:	00 00 00 
+  802eb8:	ff d0                	call   *%rax
+  802eba:	85 c0                	test   %eax,%eax
+  802ebc:	78 40                	js     802efe <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802ebe:	4c 89 ff             	mov    %r15,%rdi
+  802ec1:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  802ec8:	00 00 00 
+  802ecb:	ff d0                	call   *%rax
+  802ecd:	48 89 c2             	mov    %rax,%rdx
+  802ed0:	48 c1 e2 04          	shl    $0x4,%rdx
+  802ed4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802ed8:	48 c1 e0 0c          	shl    $0xc,%rax
+  802edc:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802ee1:	48 01 d0             	add    %rdx,%rax
+  802ee4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  802ee8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802eed:	0f 84 33 01 00 00    	je     803026 <devfile_read+0x2d8>
+    size_t i = 0;
+  802ef3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802ef9:	e9 f5 00 00 00       	jmp    802ff3 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802efe:	48 98                	cltq
+  802f00:	eb 84                	jmp    802e86 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802f02:	44 89 e8             	mov    %r13d,%eax
+  802f05:	66 b8 00 00          	mov    $0x0,%ax
+  802f09:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  802f0e:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f15:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  802f17:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f1b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f1f:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  802f21:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802f26:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  802f29:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  802f30:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  802f31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f3c:	ba 00 10 01 00       	mov    $0x11000,%edx
+  802f41:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f46:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  802f4d:	00 00 00 
+  802f50:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  802f52:	85 c0                	test   %eax,%eax
+  802f54:	0f 88 be 00 00 00    	js     803018 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  802f5a:	48 63 d0             	movslq %eax,%rdx
+  802f5d:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  802f62:	41 03 44 24 08       	add    0x8(%r12),%eax
+  802f67:	44 39 e8             	cmp    %r13d,%eax
+  802f6a:	0f 8e ba 00 00 00    	jle    80302a <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  802f70:	49 63 c5             	movslq %r13d,%rax
+  802f73:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802f78:	48 29 c3             	sub    %rax,%rbx
+  802f7b:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  802f80:	48 01 c3             	add    %rax,%rbx
+  802f83:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f87:	4c 29 f0             	sub    %r14,%rax
+  802f8a:	48 39 c3             	cmp    %rax,%rbx
+  802f8d:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802f91:	4c 89 ff             	mov    %r15,%rdi
+  802f94:	48 b9 c4 1c 80 00 00 	movabs $0x801cc4,%rcx
+  802f9b:	00 00 00 
+  802f9e:	ff d1                	call   *%rcx
+  802fa0:	48 89 c2             	mov    %rax,%rdx
+  802fa3:	48 c1 e2 04          	shl    $0x4,%rdx
+  802fa7:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802fab:	48 c1 e0 0c          	shl    $0xc,%rax
+  802faf:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  802fb4:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  802fb7:	44 89 ea             	mov    %r13d,%edx
+  802fba:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  802fbf:	48 63 d2             	movslq %edx,%rdx
+  802fc2:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802fc9:	00 
+  802fca:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802fce:	4c 01 f7             	add    %r14,%rdi
+  802fd1:	48 89 da             	mov    %rbx,%rdx
+  802fd4:	48 b9 43 0f 80 00 00 	movabs $0x800f43,%rcx
+  802fdb:	00 00 00 
+  802fde:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  802fe0:	41 01 dd             	add    %ebx,%r13d
+  802fe3:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  802fe7:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  802fea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fee:	49 39 c6             	cmp    %rax,%r14
+  802ff1:	73 37                	jae    80302a <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  802ff3:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  802ff7:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802ffc:	44 39 e8             	cmp    %r13d,%eax
+  802fff:	0f 8f fd fe ff ff    	jg     802f02 <devfile_read+0x1b4>
+  803005:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80300a:	44 39 e8             	cmp    %r13d,%eax
+  80300d:	0f 8f 5d ff ff ff    	jg     802f70 <devfile_read+0x222>
+  803013:	e9 ea fe ff ff       	jmp    802f02 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803018:	48 98                	cltq
+  80301a:	4d 85 f6             	test   %r14,%r14
+  80301d:	49 0f 45 c6          	cmovne %r14,%rax
+  803021:	e9 60 fe ff ff       	jmp    802e86 <devfile_read+0x138>
+    size_t i = 0;
+  803026:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80302a:	4c 89 f0             	mov    %r14,%rax
+  80302d:	e9 54 fe ff ff       	jmp    802e86 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803032:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803039:	e9 48 fe ff ff       	jmp    802e86 <devfile_read+0x138>
+
+000000000080303e <open>:
+open(const char *path, int mode) {
+  80303e:	55                   	push   %rbp
+  80303f:	48 89 e5             	mov    %rsp,%rbp
+  803042:	41 55                	push   %r13
+  803044:	41 54                	push   %r12
+  803046:	53                   	push   %rbx
+  803047:	48 83 ec 18          	sub    $0x18,%rsp
+  80304b:	49 89 fc             	mov    %rdi,%r12
+  80304e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803051:	48 b8 10 0b 80 00 00 	movabs $0x800b10,%rax
+  803058:	00 00 00 
+  80305b:	ff d0                	call   *%rax
+  80305d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803063:	0f 87 8a 00 00 00    	ja     8030f3 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803069:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80306d:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  803074:	00 00 00 
+  803077:	ff d0                	call   *%rax
+  803079:	89 c3                	mov    %eax,%ebx
+  80307b:	85 c0                	test   %eax,%eax
+  80307d:	78 50                	js     8030cf <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80307f:	4c 89 e6             	mov    %r12,%rsi
+  803082:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803089:	00 00 00 
+  80308c:	48 89 df             	mov    %rbx,%rdi
+  80308f:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  803096:	00 00 00 
+  803099:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80309b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8030a2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030a6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8030ab:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  8030b2:	00 00 00 
+  8030b5:	ff d0                	call   *%rax
+  8030b7:	89 c3                	mov    %eax,%ebx
+  8030b9:	85 c0                	test   %eax,%eax
+  8030bb:	78 1f                	js     8030dc <open+0x9e>
+    return fd2num(fd);
+  8030bd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030c1:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  8030c8:	00 00 00 
+  8030cb:	ff d0                	call   *%rax
+  8030cd:	89 c3                	mov    %eax,%ebx
+}
+  8030cf:	89 d8                	mov    %ebx,%eax
+  8030d1:	48 83 c4 18          	add    $0x18,%rsp
+  8030d5:	5b                   	pop    %rbx
+  8030d6:	41 5c                	pop    %r12
+  8030d8:	41 5d                	pop    %r13
+  8030da:	5d                   	pop    %rbp
+  8030db:	c3                   	ret
+        fd_close(fd, 0);
+  8030dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8030e1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030e5:	48 b8 0d 1e 80 00 00 	movabs $0x801e0d,%rax
+  8030ec:	00 00 00 
+  8030ef:	ff d0                	call   *%rax
+        return res;
+  8030f1:	eb dc                	jmp    8030cf <open+0x91>
+        return -E_BAD_PATH;
+  8030f3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030f8:	eb d5                	jmp    8030cf <open+0x91>
+
+00000000008030fa <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8030fa:	55                   	push   %rbp
+  8030fb:	48 89 e5             	mov    %rsp,%rbp
+  8030fe:	41 57                	push   %r15
+  803100:	41 56                	push   %r14
+  803102:	41 55                	push   %r13
+  803104:	41 54                	push   %r12
+  803106:	53                   	push   %rbx
+  803107:	48 83 ec 18          	sub    $0x18,%rsp
+  80310b:	41 89 f6             	mov    %esi,%r14d
+  80310e:	49 89 d7             	mov    %rdx,%r15
+  803111:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803114:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803118:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  80311f:	00 00 00 
+  803122:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803124:	85 c0                	test   %eax,%eax
+  803126:	0f 88 db 00 00 00    	js     803207 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80312c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803130:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803137:	00 00 00 
+  80313a:	8b 00                	mov    (%rax),%eax
+  80313c:	39 07                	cmp    %eax,(%rdi)
+  80313e:	0f 85 db 00 00 00    	jne    80321f <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803144:	45 85 f6             	test   %r14d,%r14d
+  803147:	0f 88 db 00 00 00    	js     803228 <fmap+0x12e>
+  80314d:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803154:	0f 85 d7 00 00 00    	jne    803231 <fmap+0x137>
+  80315a:	4c 89 fb             	mov    %r15,%rbx
+  80315d:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803163:	0f 85 d1 00 00 00    	jne    80323a <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803169:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  803170:	00 00 00 
+  803173:	ff d0                	call   *%rax
+  803175:	85 c0                	test   %eax,%eax
+  803177:	0f 88 8e 00 00 00    	js     80320b <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80317d:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803184:	00 00 00 
+    while (i < n) {
+  803187:	4d 85 ed             	test   %r13,%r13
+  80318a:	0f 84 8a 00 00 00    	je     80321a <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803190:	4c 89 ea             	mov    %r13,%rdx
+  803193:	48 29 da             	sub    %rbx,%rdx
+  803196:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80319d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8031a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031ab:	8b 40 0c             	mov    0xc(%rax),%eax
+  8031ae:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8031b2:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8031b6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8031bb:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8031c0:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8031c4:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8031c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031cd:	4c 89 e6             	mov    %r12,%rsi
+  8031d0:	bf 09 00 00 00       	mov    $0x9,%edi
+  8031d5:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  8031dc:	00 00 00 
+  8031df:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8031e1:	85 c0                	test   %eax,%eax
+  8031e3:	78 2a                	js     80320f <fmap+0x115>
+        i += res;
+  8031e5:	48 98                	cltq
+  8031e7:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8031ea:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8031ee:	72 05                	jb     8031f5 <fmap+0xfb>
+    while (i < n) {
+  8031f0:	4c 39 eb             	cmp    %r13,%rbx
+  8031f3:	72 9b                	jb     803190 <fmap+0x96>
+    }
+    return i;
+  8031f5:	48 89 d8             	mov    %rbx,%rax
+}
+  8031f8:	48 83 c4 18          	add    $0x18,%rsp
+  8031fc:	5b                   	pop    %rbx
+  8031fd:	41 5c                	pop    %r12
+  8031ff:	41 5d                	pop    %r13
+  803201:	41 5e                	pop    %r14
+  803203:	41 5f                	pop    %r15
+  803205:	5d                   	pop    %rbp
+  803206:	c3                   	ret
+    if (res < 0) return res;
+  803207:	48 98                	cltq
+  803209:	eb ed                	jmp    8031f8 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80320b:	48 98                	cltq
+  80320d:	eb e9                	jmp    8031f8 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  80320f:	48 98                	cltq
+  803211:	48 85 db             	test   %rbx,%rbx
+  803214:	48 0f 45 c3          	cmovne %rbx,%rax
+  803218:	eb de                	jmp    8031f8 <fmap+0xfe>
+    size_t i = 0;
+  80321a:	4c 89 eb             	mov    %r13,%rbx
+  80321d:	eb d6                	jmp    8031f5 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80321f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803226:	eb d0                	jmp    8031f8 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803228:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80322f:	eb c7                	jmp    8031f8 <fmap+0xfe>
+  803231:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803238:	eb be                	jmp    8031f8 <fmap+0xfe>
+  80323a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803241:	eb b5                	jmp    8031f8 <fmap+0xfe>
+
+0000000000803243 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803243:	55                   	push   %rbp
+  803244:	48 89 e5             	mov    %rsp,%rbp
+  803247:	41 56                	push   %r14
+  803249:	41 55                	push   %r13
+  80324b:	41 54                	push   %r12
+  80324d:	53                   	push   %rbx
+  80324e:	48 83 ec 10          	sub    $0x10,%rsp
+  803252:	89 fb                	mov    %edi,%ebx
+  803254:	41 89 f4             	mov    %esi,%r12d
+  803257:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80325a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80325e:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  803265:	00 00 00 
+  803268:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80326a:	85 c0                	test   %eax,%eax
+  80326c:	78 63                	js     8032d1 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80326e:	45 85 e4             	test   %r12d,%r12d
+  803271:	0f 88 80 00 00 00    	js     8032f7 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803277:	45 89 e6             	mov    %r12d,%r14d
+  80327a:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803281:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803285:	48 b8 d6 1c 80 00 00 	movabs $0x801cd6,%rax
+  80328c:	00 00 00 
+  80328f:	ff d0                	call   *%rax
+  803291:	48 89 c2             	mov    %rax,%rdx
+  803294:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803299:	44 89 f6             	mov    %r14d,%esi
+  80329c:	89 df                	mov    %ebx,%edi
+  80329e:	48 b8 fa 30 80 00 00 	movabs $0x8030fa,%rax
+  8032a5:	00 00 00 
+  8032a8:	ff d0                	call   *%rax
+  8032aa:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8032ad:	45 29 f4             	sub    %r14d,%r12d
+  8032b0:	4d 63 f4             	movslq %r12d,%r14
+  8032b3:	49 39 c6             	cmp    %rax,%r14
+  8032b6:	7c 1d                	jl     8032d5 <read_map+0x92>
+  8032b8:	48 85 c0             	test   %rax,%rax
+  8032bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c0:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8032c4:	48 83 c4 10          	add    $0x10,%rsp
+  8032c8:	5b                   	pop    %rbx
+  8032c9:	41 5c                	pop    %r12
+  8032cb:	41 5d                	pop    %r13
+  8032cd:	41 5e                	pop    %r14
+  8032cf:	5d                   	pop    %rbp
+  8032d0:	c3                   	ret
+    if (res < 0) return res;
+  8032d1:	48 98                	cltq
+  8032d3:	eb ef                	jmp    8032c4 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8032d5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032d9:	48 b8 d6 1c 80 00 00 	movabs $0x801cd6,%rax
+  8032e0:	00 00 00 
+  8032e3:	ff d0                	call   *%rax
+  8032e5:	4d 63 e4             	movslq %r12d,%r12
+  8032e8:	4c 01 e0             	add    %r12,%rax
+  8032eb:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8032ef:	48 89 d8             	mov    %rbx,%rax
+  8032f2:	4c 29 f0             	sub    %r14,%rax
+  8032f5:	eb cd                	jmp    8032c4 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8032f7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032fe:	eb c4                	jmp    8032c4 <read_map+0x81>
+
+0000000000803300 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803300:	55                   	push   %rbp
+  803301:	48 89 e5             	mov    %rsp,%rbp
+  803304:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803308:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80330c:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  803313:	00 00 00 
+  803316:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803318:	85 c0                	test   %eax,%eax
+  80331a:	78 4a                	js     803366 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80331c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803320:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803327:	00 00 00 
+  80332a:	8b 00                	mov    (%rax),%eax
+  80332c:	39 07                	cmp    %eax,(%rdi)
+  80332e:	75 38                	jne    803368 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803330:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  803337:	00 00 00 
+  80333a:	ff d0                	call   *%rax
+  80333c:	85 c0                	test   %eax,%eax
+  80333e:	78 26                	js     803366 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803344:	8b 40 0c             	mov    0xc(%rax),%eax
+  803347:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80334e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803350:	be 00 00 00 00       	mov    $0x0,%esi
+  803355:	bf 06 00 00 00       	mov    $0x6,%edi
+  80335a:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  803361:	00 00 00 
+  803364:	ff d0                	call   *%rax
+}
+  803366:	c9                   	leave
+  803367:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803368:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80336d:	eb f7                	jmp    803366 <fsync+0x66>
+
+000000000080336f <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80336f:	55                   	push   %rbp
+  803370:	48 89 e5             	mov    %rsp,%rbp
+  803373:	41 57                	push   %r15
+  803375:	41 56                	push   %r14
+  803377:	41 55                	push   %r13
+  803379:	41 54                	push   %r12
+  80337b:	53                   	push   %rbx
+  80337c:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803380:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803387:	00 00 00 
+  80338a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80338f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803395:	49 bd 52 1d 80 00 00 	movabs $0x801d52,%r13
+  80339c:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80339f:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8033a6:	00 00 00 
+  8033a9:	eb 0c                	jmp    8033b7 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8033ab:	83 c3 01             	add    $0x1,%ebx
+  8033ae:	49 83 c4 28          	add    $0x28,%r12
+  8033b2:	83 fb 20             	cmp    $0x20,%ebx
+  8033b5:	74 33                	je     8033ea <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033b7:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8033bc:	74 ed                	je     8033ab <flushall+0x3c>
+  8033be:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033c2:	89 df                	mov    %ebx,%edi
+  8033c4:	41 ff d5             	call   *%r13
+  8033c7:	85 c0                	test   %eax,%eax
+  8033c9:	78 e0                	js     8033ab <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8033cb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033cf:	41 8b 06             	mov    (%r14),%eax
+  8033d2:	39 07                	cmp    %eax,(%rdi)
+  8033d4:	75 d5                	jne    8033ab <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8033d6:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  8033dd:	00 00 00 
+  8033e0:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8033e2:	85 c0                	test   %eax,%eax
+  8033e4:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8033e8:	eb c1                	jmp    8033ab <flushall+0x3c>
+    }
+    return res;
+}
+  8033ea:	44 89 f8             	mov    %r15d,%eax
+  8033ed:	48 83 c4 18          	add    $0x18,%rsp
+  8033f1:	5b                   	pop    %rbx
+  8033f2:	41 5c                	pop    %r12
+  8033f4:	41 5d                	pop    %r13
+  8033f6:	41 5e                	pop    %r14
+  8033f8:	41 5f                	pop    %r15
+  8033fa:	5d                   	pop    %rbp
+  8033fb:	c3                   	ret
+
+00000000008033fc <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8033fc:	55                   	push   %rbp
+  8033fd:	48 89 e5             	mov    %rsp,%rbp
+  803400:	53                   	push   %rbx
+  803401:	48 83 ec 08          	sub    $0x8,%rsp
+  803405:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803408:	40 0f b6 c6          	movzbl %sil,%eax
+  80340c:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803413:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803415:	be 00 00 00 00       	mov    $0x0,%esi
+  80341a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80341f:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  803426:	00 00 00 
+  803429:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80342b:	85 c0                	test   %eax,%eax
+  80342d:	78 23                	js     803452 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80342f:	ba 58 06 00 00       	mov    $0x658,%edx
+  803434:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80343b:	00 00 00 
+  80343e:	48 89 df             	mov    %rbx,%rdi
+  803441:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  803448:	00 00 00 
+  80344b:	ff d0                	call   *%rax
+    return 0;
+  80344d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803452:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803456:	c9                   	leave
+  803457:	c3                   	ret
+
+0000000000803458 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803458:	55                   	push   %rbp
+  803459:	48 89 e5             	mov    %rsp,%rbp
+  80345c:	53                   	push   %rbx
+  80345d:	48 83 ec 08          	sub    $0x8,%rsp
+  803461:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803464:	48 b8 10 0b 80 00 00 	movabs $0x800b10,%rax
+  80346b:	00 00 00 
+  80346e:	ff d0                	call   *%rax
+  803470:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803476:	77 35                	ja     8034ad <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803478:	48 89 de             	mov    %rbx,%rsi
+  80347b:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803482:	00 00 00 
+  803485:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  80348c:	00 00 00 
+  80348f:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803491:	be 00 00 00 00       	mov    $0x0,%esi
+  803496:	bf 07 00 00 00       	mov    $0x7,%edi
+  80349b:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  8034a2:	00 00 00 
+  8034a5:	ff d0                	call   *%rax
+}
+  8034a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034ab:	c9                   	leave
+  8034ac:	c3                   	ret
+        return -E_BAD_PATH;
+  8034ad:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034b2:	eb f3                	jmp    8034a7 <remove+0x4f>
+
+00000000008034b4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8034b4:	55                   	push   %rbp
+  8034b5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8034b8:	48 b8 6f 33 80 00 00 	movabs $0x80336f,%rax
+  8034bf:	00 00 00 
+  8034c2:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8034c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8034c9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8034ce:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  8034d5:	00 00 00 
+  8034d8:	ff d0                	call   *%rax
+}
+  8034da:	5d                   	pop    %rbp
+  8034db:	c3                   	ret
+
+00000000008034dc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8034dc:	55                   	push   %rbp
+  8034dd:	48 89 e5             	mov    %rsp,%rbp
+  8034e0:	41 54                	push   %r12
+  8034e2:	53                   	push   %rbx
+  8034e3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8034e6:	48 b8 d6 1c 80 00 00 	movabs $0x801cd6,%rax
+  8034ed:	00 00 00 
+  8034f0:	ff d0                	call   *%rax
+  8034f2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8034f5:	48 be 80 56 80 00 00 	movabs $0x805680,%rsi
+  8034fc:	00 00 00 
+  8034ff:	48 89 df             	mov    %rbx,%rdi
+  803502:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  803509:	00 00 00 
+  80350c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80350e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803513:	41 2b 04 24          	sub    (%r12),%eax
+  803517:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80351d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803524:	00 00 00 
+    stat->st_dev = &devpipe;
+  803527:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80352e:	00 00 00 
+  803531:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353d:	5b                   	pop    %rbx
+  80353e:	41 5c                	pop    %r12
+  803540:	5d                   	pop    %rbp
+  803541:	c3                   	ret
+
+0000000000803542 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803542:	55                   	push   %rbp
+  803543:	48 89 e5             	mov    %rsp,%rbp
+  803546:	41 54                	push   %r12
+  803548:	53                   	push   %rbx
+  803549:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80354c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803551:	48 89 fe             	mov    %rdi,%rsi
+  803554:	bf 00 00 00 00       	mov    $0x0,%edi
+  803559:	49 bc 8d 14 80 00 00 	movabs $0x80148d,%r12
+  803560:	00 00 00 
+  803563:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803566:	48 89 df             	mov    %rbx,%rdi
+  803569:	48 b8 d6 1c 80 00 00 	movabs $0x801cd6,%rax
+  803570:	00 00 00 
+  803573:	ff d0                	call   *%rax
+  803575:	48 89 c6             	mov    %rax,%rsi
+  803578:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80357d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803582:	41 ff d4             	call   *%r12
+}
+  803585:	5b                   	pop    %rbx
+  803586:	41 5c                	pop    %r12
+  803588:	5d                   	pop    %rbp
+  803589:	c3                   	ret
+
+000000000080358a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80358a:	55                   	push   %rbp
+  80358b:	48 89 e5             	mov    %rsp,%rbp
+  80358e:	41 57                	push   %r15
+  803590:	41 56                	push   %r14
+  803592:	41 55                	push   %r13
+  803594:	41 54                	push   %r12
+  803596:	53                   	push   %rbx
+  803597:	48 83 ec 18          	sub    $0x18,%rsp
+  80359b:	49 89 fc             	mov    %rdi,%r12
+  80359e:	49 89 f5             	mov    %rsi,%r13
+  8035a1:	49 89 d7             	mov    %rdx,%r15
+  8035a4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8035a8:	48 b8 d6 1c 80 00 00 	movabs $0x801cd6,%rax
+  8035af:	00 00 00 
+  8035b2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8035b4:	4d 85 ff             	test   %r15,%r15
+  8035b7:	0f 84 af 00 00 00    	je     80366c <devpipe_write+0xe2>
+  8035bd:	48 89 c3             	mov    %rax,%rbx
+  8035c0:	4c 89 f8             	mov    %r15,%rax
+  8035c3:	4d 89 ef             	mov    %r13,%r15
+  8035c6:	4c 01 e8             	add    %r13,%rax
+  8035c9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035cd:	49 bd 82 12 80 00 00 	movabs $0x801282,%r13
+  8035d4:	00 00 00 
+            sys_yield();
+  8035d7:	49 be 1f 12 80 00 00 	movabs $0x80121f,%r14
+  8035de:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8035e1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8035e4:	48 63 ce             	movslq %esi,%rcx
+  8035e7:	48 63 03             	movslq (%rbx),%rax
+  8035ea:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8035f0:	48 39 c1             	cmp    %rax,%rcx
+  8035f3:	72 2e                	jb     803623 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035f5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8035fa:	48 89 da             	mov    %rbx,%rdx
+  8035fd:	be 00 10 00 00       	mov    $0x1000,%esi
+  803602:	4c 89 e7             	mov    %r12,%rdi
+  803605:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803608:	85 c0                	test   %eax,%eax
+  80360a:	74 66                	je     803672 <devpipe_write+0xe8>
+            sys_yield();
+  80360c:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80360f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803612:	48 63 ce             	movslq %esi,%rcx
+  803615:	48 63 03             	movslq (%rbx),%rax
+  803618:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80361e:	48 39 c1             	cmp    %rax,%rcx
+  803621:	73 d2                	jae    8035f5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803623:	41 0f b6 3f          	movzbl (%r15),%edi
+  803627:	48 89 ca             	mov    %rcx,%rdx
+  80362a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80362e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803635:	08 10 20 
+  803638:	48 f7 e2             	mul    %rdx
+  80363b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80363f:	48 89 d0             	mov    %rdx,%rax
+  803642:	48 c1 e0 09          	shl    $0x9,%rax
+  803646:	48 29 d0             	sub    %rdx,%rax
+  803649:	48 c1 e0 03          	shl    $0x3,%rax
+  80364d:	48 29 c1             	sub    %rax,%rcx
+  803650:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803655:	83 c6 01             	add    $0x1,%esi
+  803658:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80365b:	49 83 c7 01          	add    $0x1,%r15
+  80365f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803663:	49 39 c7             	cmp    %rax,%r15
+  803666:	0f 85 75 ff ff ff    	jne    8035e1 <devpipe_write+0x57>
+    return n;
+  80366c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803670:	eb 05                	jmp    803677 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803672:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803677:	48 83 c4 18          	add    $0x18,%rsp
+  80367b:	5b                   	pop    %rbx
+  80367c:	41 5c                	pop    %r12
+  80367e:	41 5d                	pop    %r13
+  803680:	41 5e                	pop    %r14
+  803682:	41 5f                	pop    %r15
+  803684:	5d                   	pop    %rbp
+  803685:	c3                   	ret
+
+0000000000803686 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803686:	55                   	push   %rbp
+  803687:	48 89 e5             	mov    %rsp,%rbp
+  80368a:	41 57                	push   %r15
+  80368c:	41 56                	push   %r14
+  80368e:	41 55                	push   %r13
+  803690:	41 54                	push   %r12
+  803692:	53                   	push   %rbx
+  803693:	48 83 ec 18          	sub    $0x18,%rsp
+  803697:	49 89 fc             	mov    %rdi,%r12
+  80369a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80369e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036a2:	48 b8 d6 1c 80 00 00 	movabs $0x801cd6,%rax
+  8036a9:	00 00 00 
+  8036ac:	ff d0                	call   *%rax
+  8036ae:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036b1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036b7:	49 bd 82 12 80 00 00 	movabs $0x801282,%r13
+  8036be:	00 00 00 
+            sys_yield();
+  8036c1:	49 be 1f 12 80 00 00 	movabs $0x80121f,%r14
+  8036c8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8036cb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8036d0:	74 7d                	je     80374f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036d2:	8b 03                	mov    (%rbx),%eax
+  8036d4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036d7:	75 26                	jne    8036ff <devpipe_read+0x79>
+            if (i > 0) return i;
+  8036d9:	4d 85 ff             	test   %r15,%r15
+  8036dc:	75 77                	jne    803755 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036de:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036e3:	48 89 da             	mov    %rbx,%rdx
+  8036e6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036eb:	4c 89 e7             	mov    %r12,%rdi
+  8036ee:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8036f1:	85 c0                	test   %eax,%eax
+  8036f3:	74 72                	je     803767 <devpipe_read+0xe1>
+            sys_yield();
+  8036f5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036f8:	8b 03                	mov    (%rbx),%eax
+  8036fa:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036fd:	74 df                	je     8036de <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8036ff:	48 63 c8             	movslq %eax,%rcx
+  803702:	48 89 ca             	mov    %rcx,%rdx
+  803705:	48 c1 ea 03          	shr    $0x3,%rdx
+  803709:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803710:	08 10 20 
+  803713:	48 89 d0             	mov    %rdx,%rax
+  803716:	48 f7 e6             	mul    %rsi
+  803719:	48 c1 ea 06          	shr    $0x6,%rdx
+  80371d:	48 89 d0             	mov    %rdx,%rax
+  803720:	48 c1 e0 09          	shl    $0x9,%rax
+  803724:	48 29 d0             	sub    %rdx,%rax
+  803727:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80372e:	00 
+  80372f:	48 89 c8             	mov    %rcx,%rax
+  803732:	48 29 d0             	sub    %rdx,%rax
+  803735:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80373a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80373e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803742:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803745:	49 83 c7 01          	add    $0x1,%r15
+  803749:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80374d:	75 83                	jne    8036d2 <devpipe_read+0x4c>
+    return n;
+  80374f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803753:	eb 03                	jmp    803758 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803755:	4c 89 f8             	mov    %r15,%rax
+}
+  803758:	48 83 c4 18          	add    $0x18,%rsp
+  80375c:	5b                   	pop    %rbx
+  80375d:	41 5c                	pop    %r12
+  80375f:	41 5d                	pop    %r13
+  803761:	41 5e                	pop    %r14
+  803763:	41 5f                	pop    %r15
+  803765:	5d                   	pop    %rbp
+  803766:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803767:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376c:	eb ea                	jmp    803758 <devpipe_read+0xd2>
+
+000000000080376e <pipe>:
+pipe(int pfd[2]) {
+  80376e:	55                   	push   %rbp
+  80376f:	48 89 e5             	mov    %rsp,%rbp
+  803772:	41 55                	push   %r13
+  803774:	41 54                	push   %r12
+  803776:	53                   	push   %rbx
+  803777:	48 83 ec 18          	sub    $0x18,%rsp
+  80377b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80377e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803782:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  803789:	00 00 00 
+  80378c:	ff d0                	call   *%rax
+  80378e:	89 c3                	mov    %eax,%ebx
+  803790:	85 c0                	test   %eax,%eax
+  803792:	0f 88 a0 01 00 00    	js     803938 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803798:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80379d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037a2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8037a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ab:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  8037b2:	00 00 00 
+  8037b5:	ff d0                	call   *%rax
+  8037b7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8037b9:	85 c0                	test   %eax,%eax
+  8037bb:	0f 88 77 01 00 00    	js     803938 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037c1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8037c5:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  8037cc:	00 00 00 
+  8037cf:	ff d0                	call   *%rax
+  8037d1:	89 c3                	mov    %eax,%ebx
+  8037d3:	85 c0                	test   %eax,%eax
+  8037d5:	0f 88 43 01 00 00    	js     80391e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8037db:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037e5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8037e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ee:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  8037f5:	00 00 00 
+  8037f8:	ff d0                	call   *%rax
+  8037fa:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037fc:	85 c0                	test   %eax,%eax
+  8037fe:	0f 88 1a 01 00 00    	js     80391e <pipe+0x1b0>
+    va = fd2data(fd0);
+  803804:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803808:	48 b8 d6 1c 80 00 00 	movabs $0x801cd6,%rax
+  80380f:	00 00 00 
+  803812:	ff d0                	call   *%rax
+  803814:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803817:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80381c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803821:	48 89 c6             	mov    %rax,%rsi
+  803824:	bf 00 00 00 00       	mov    $0x0,%edi
+  803829:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  803830:	00 00 00 
+  803833:	ff d0                	call   *%rax
+  803835:	89 c3                	mov    %eax,%ebx
+  803837:	85 c0                	test   %eax,%eax
+  803839:	0f 88 c5 00 00 00    	js     803904 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80383f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803843:	48 b8 d6 1c 80 00 00 	movabs $0x801cd6,%rax
+  80384a:	00 00 00 
+  80384d:	ff d0                	call   *%rax
+  80384f:	48 89 c1             	mov    %rax,%rcx
+  803852:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803858:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80385e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803863:	4c 89 ee             	mov    %r13,%rsi
+  803866:	bf 00 00 00 00       	mov    $0x0,%edi
+  80386b:	48 b8 15 13 80 00 00 	movabs $0x801315,%rax
+  803872:	00 00 00 
+  803875:	ff d0                	call   *%rax
+  803877:	89 c3                	mov    %eax,%ebx
+  803879:	85 c0                	test   %eax,%eax
+  80387b:	78 6e                	js     8038eb <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80387d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803882:	4c 89 ef             	mov    %r13,%rdi
+  803885:	48 b8 50 12 80 00 00 	movabs $0x801250,%rax
+  80388c:	00 00 00 
+  80388f:	ff d0                	call   *%rax
+  803891:	83 f8 02             	cmp    $0x2,%eax
+  803894:	0f 85 ab 00 00 00    	jne    803945 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80389a:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8038a1:	00 00 
+  8038a3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038a7:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8038a9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038ad:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8038b4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8038b8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8038ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038be:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8038c5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8038c9:	48 bb c4 1c 80 00 00 	movabs $0x801cc4,%rbx
+  8038d0:	00 00 00 
+  8038d3:	ff d3                	call   *%rbx
+  8038d5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8038d9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8038dd:	ff d3                	call   *%rbx
+  8038df:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8038e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038e9:	eb 4d                	jmp    803938 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8038eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038f0:	4c 89 ee             	mov    %r13,%rsi
+  8038f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038f8:	48 b8 8d 14 80 00 00 	movabs $0x80148d,%rax
+  8038ff:	00 00 00 
+  803902:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803904:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803909:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80390d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803912:	48 b8 8d 14 80 00 00 	movabs $0x80148d,%rax
+  803919:	00 00 00 
+  80391c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80391e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803923:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803927:	bf 00 00 00 00       	mov    $0x0,%edi
+  80392c:	48 b8 8d 14 80 00 00 	movabs $0x80148d,%rax
+  803933:	00 00 00 
+  803936:	ff d0                	call   *%rax
+}
+  803938:	89 d8                	mov    %ebx,%eax
+  80393a:	48 83 c4 18          	add    $0x18,%rsp
+  80393e:	5b                   	pop    %rbx
+  80393f:	41 5c                	pop    %r12
+  803941:	41 5d                	pop    %r13
+  803943:	5d                   	pop    %rbp
+  803944:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803945:	48 b9 b0 56 80 00 00 	movabs $0x8056b0,%rcx
+  80394c:	00 00 00 
+  80394f:	48 ba 87 56 80 00 00 	movabs $0x805687,%rdx
+  803956:	00 00 00 
+  803959:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80395e:	48 bf 9c 56 80 00 00 	movabs $0x80569c,%rdi
+  803965:	00 00 00 
+  803968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80396d:	49 b8 4d 3f 80 00 00 	movabs $0x803f4d,%r8
+  803974:	00 00 00 
+  803977:	41 ff d0             	call   *%r8
+
+000000000080397a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80397a:	55                   	push   %rbp
+  80397b:	48 89 e5             	mov    %rsp,%rbp
+  80397e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803982:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803986:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  80398d:	00 00 00 
+  803990:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803992:	85 c0                	test   %eax,%eax
+  803994:	78 35                	js     8039cb <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803996:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80399a:	48 b8 d6 1c 80 00 00 	movabs $0x801cd6,%rax
+  8039a1:	00 00 00 
+  8039a4:	ff d0                	call   *%rax
+  8039a6:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039a9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039ae:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039b3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039b7:	48 b8 82 12 80 00 00 	movabs $0x801282,%rax
+  8039be:	00 00 00 
+  8039c1:	ff d0                	call   *%rax
+  8039c3:	85 c0                	test   %eax,%eax
+  8039c5:	0f 94 c0             	sete   %al
+  8039c8:	0f b6 c0             	movzbl %al,%eax
+}
+  8039cb:	c9                   	leave
+  8039cc:	c3                   	ret
+
+00000000008039cd <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8039cd:	48 89 f8             	mov    %rdi,%rax
+  8039d0:	48 c1 e8 27          	shr    $0x27,%rax
+  8039d4:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8039db:	7f 00 00 
+  8039de:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039e2:	f6 c2 01             	test   $0x1,%dl
+  8039e5:	74 6d                	je     803a54 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8039e7:	48 89 f8             	mov    %rdi,%rax
+  8039ea:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039ee:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039f5:	7f 00 00 
+  8039f8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039fc:	f6 c2 01             	test   $0x1,%dl
+  8039ff:	74 62                	je     803a63 <get_uvpt_entry+0x96>
+  803a01:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a08:	7f 00 00 
+  803a0b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a0f:	f6 c2 80             	test   $0x80,%dl
+  803a12:	75 4f                	jne    803a63 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a14:	48 89 f8             	mov    %rdi,%rax
+  803a17:	48 c1 e8 15          	shr    $0x15,%rax
+  803a1b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a22:	7f 00 00 
+  803a25:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a29:	f6 c2 01             	test   $0x1,%dl
+  803a2c:	74 44                	je     803a72 <get_uvpt_entry+0xa5>
+  803a2e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a35:	7f 00 00 
+  803a38:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a3c:	f6 c2 80             	test   $0x80,%dl
+  803a3f:	75 31                	jne    803a72 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803a41:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803a45:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a4c:	7f 00 00 
+  803a4f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803a53:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a54:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803a5b:	7f 00 00 
+  803a5e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a62:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a63:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a6a:	7f 00 00 
+  803a6d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a71:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a72:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a79:	7f 00 00 
+  803a7c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a80:	c3                   	ret
+
+0000000000803a81 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803a81:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a84:	48 89 f9             	mov    %rdi,%rcx
+  803a87:	48 c1 e9 27          	shr    $0x27,%rcx
+  803a8b:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803a92:	7f 00 00 
+  803a95:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803a99:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803aa0:	f6 c1 01             	test   $0x1,%cl
+  803aa3:	0f 84 b2 00 00 00    	je     803b5b <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803aa9:	48 89 f9             	mov    %rdi,%rcx
+  803aac:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803ab0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ab7:	7f 00 00 
+  803aba:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803abe:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ac5:	40 f6 c6 01          	test   $0x1,%sil
+  803ac9:	0f 84 8c 00 00 00    	je     803b5b <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803acf:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ad6:	7f 00 00 
+  803ad9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803add:	a8 80                	test   $0x80,%al
+  803adf:	75 7b                	jne    803b5c <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ae1:	48 89 f9             	mov    %rdi,%rcx
+  803ae4:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ae8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803aef:	7f 00 00 
+  803af2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803af6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803afd:	40 f6 c6 01          	test   $0x1,%sil
+  803b01:	74 58                	je     803b5b <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803b03:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b0a:	7f 00 00 
+  803b0d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b11:	a8 80                	test   $0x80,%al
+  803b13:	75 6c                	jne    803b81 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b15:	48 89 f9             	mov    %rdi,%rcx
+  803b18:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803b1c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b23:	7f 00 00 
+  803b26:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b2a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b31:	40 f6 c6 01          	test   $0x1,%sil
+  803b35:	74 24                	je     803b5b <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803b37:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b3e:	7f 00 00 
+  803b41:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b45:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b4c:	ff ff 7f 
+  803b4f:	48 21 c8             	and    %rcx,%rax
+  803b52:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803b58:	48 09 d0             	or     %rdx,%rax
+}
+  803b5b:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803b5c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b63:	7f 00 00 
+  803b66:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b6a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b71:	ff ff 7f 
+  803b74:	48 21 c8             	and    %rcx,%rax
+  803b77:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803b7d:	48 01 d0             	add    %rdx,%rax
+  803b80:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803b81:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b88:	7f 00 00 
+  803b8b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b8f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b96:	ff ff 7f 
+  803b99:	48 21 c8             	and    %rcx,%rax
+  803b9c:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803ba2:	48 01 d0             	add    %rdx,%rax
+  803ba5:	c3                   	ret
+
+0000000000803ba6 <get_prot>:
+
+int
+get_prot(void *va) {
+  803ba6:	55                   	push   %rbp
+  803ba7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803baa:	48 b8 cd 39 80 00 00 	movabs $0x8039cd,%rax
+  803bb1:	00 00 00 
+  803bb4:	ff d0                	call   *%rax
+  803bb6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803bb9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803bbe:	89 c1                	mov    %eax,%ecx
+  803bc0:	83 c9 04             	or     $0x4,%ecx
+  803bc3:	f6 c2 01             	test   $0x1,%dl
+  803bc6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803bc9:	89 c1                	mov    %eax,%ecx
+  803bcb:	83 c9 02             	or     $0x2,%ecx
+  803bce:	f6 c2 02             	test   $0x2,%dl
+  803bd1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803bd4:	89 c1                	mov    %eax,%ecx
+  803bd6:	83 c9 01             	or     $0x1,%ecx
+  803bd9:	48 85 d2             	test   %rdx,%rdx
+  803bdc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803bdf:	89 c1                	mov    %eax,%ecx
+  803be1:	83 c9 40             	or     $0x40,%ecx
+  803be4:	f6 c6 04             	test   $0x4,%dh
+  803be7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803bea:	5d                   	pop    %rbp
+  803beb:	c3                   	ret
+
+0000000000803bec <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803bec:	55                   	push   %rbp
+  803bed:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803bf0:	48 b8 cd 39 80 00 00 	movabs $0x8039cd,%rax
+  803bf7:	00 00 00 
+  803bfa:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803bfc:	48 c1 e8 06          	shr    $0x6,%rax
+  803c00:	83 e0 01             	and    $0x1,%eax
+}
+  803c03:	5d                   	pop    %rbp
+  803c04:	c3                   	ret
+
+0000000000803c05 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803c05:	55                   	push   %rbp
+  803c06:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803c09:	48 b8 cd 39 80 00 00 	movabs $0x8039cd,%rax
+  803c10:	00 00 00 
+  803c13:	ff d0                	call   *%rax
+  803c15:	83 e0 01             	and    $0x1,%eax
+}
+  803c18:	5d                   	pop    %rbp
+  803c19:	c3                   	ret
+
+0000000000803c1a <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803c1a:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803c21:	7f 00 00 
+  803c24:	a8 01                	test   $0x1,%al
+  803c26:	75 06                	jne    803c2e <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c2d:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803c2e:	55                   	push   %rbp
+  803c2f:	48 89 e5             	mov    %rsp,%rbp
+  803c32:	41 57                	push   %r15
+  803c34:	41 56                	push   %r14
+  803c36:	41 55                	push   %r13
+  803c38:	41 54                	push   %r12
+  803c3a:	53                   	push   %rbx
+  803c3b:	48 83 ec 18          	sub    $0x18,%rsp
+  803c3f:	49 89 fe             	mov    %rdi,%r14
+  803c42:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803c45:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803c4c:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c4d:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803c54:	7f 00 00 
+  803c57:	e9 81 00 00 00       	jmp    803cdd <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803c5c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803c63:	49 39 dd             	cmp    %rbx,%r13
+  803c66:	74 2b                	je     803c93 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c68:	48 89 d8             	mov    %rbx,%rax
+  803c6b:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c6f:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803c73:	f6 c2 01             	test   $0x1,%dl
+  803c76:	74 e4                	je     803c5c <foreach_shared_region+0x42>
+  803c78:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803c7c:	f6 c4 04             	test   $0x4,%ah
+  803c7f:	74 db                	je     803c5c <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803c81:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803c88:	4c 89 fa             	mov    %r15,%rdx
+  803c8b:	48 89 df             	mov    %rbx,%rdi
+  803c8e:	41 ff d6             	call   *%r14
+  803c91:	eb c9                	jmp    803c5c <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803c93:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803c9a:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803c9e:	74 22                	je     803cc2 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803ca0:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803ca7:	48 89 d8             	mov    %rbx,%rax
+  803caa:	48 c1 e8 15          	shr    $0x15,%rax
+  803cae:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803cb5:	7f 00 00 
+  803cb8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803cbc:	a8 01                	test   $0x1,%al
+  803cbe:	74 d3                	je     803c93 <foreach_shared_region+0x79>
+  803cc0:	eb a6                	jmp    803c68 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803cc2:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803cc9:	40 
+  803cca:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803cce:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cd5:	00 00 00 
+  803cd8:	48 39 c1             	cmp    %rax,%rcx
+  803cdb:	74 31                	je     803d0e <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803cdd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ce1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ce5:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803cec:	7f 00 00 
+  803cef:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803cf3:	a8 01                	test   $0x1,%al
+  803cf5:	74 cb                	je     803cc2 <foreach_shared_region+0xa8>
+  803cf7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cfb:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803d02:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803d08:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d0c:	eb 92                	jmp    803ca0 <foreach_shared_region+0x86>
+}
+  803d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d13:	48 83 c4 18          	add    $0x18,%rsp
+  803d17:	5b                   	pop    %rbx
+  803d18:	41 5c                	pop    %r12
+  803d1a:	41 5d                	pop    %r13
+  803d1c:	41 5e                	pop    %r14
+  803d1e:	41 5f                	pop    %r15
+  803d20:	5d                   	pop    %rbp
+  803d21:	c3                   	ret
+
+0000000000803d22 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d27:	c3                   	ret
+
+0000000000803d28 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803d28:	55                   	push   %rbp
+  803d29:	48 89 e5             	mov    %rsp,%rbp
+  803d2c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803d2f:	48 be d4 56 80 00 00 	movabs $0x8056d4,%rsi
+  803d36:	00 00 00 
+  803d39:	48 b8 4e 0b 80 00 00 	movabs $0x800b4e,%rax
+  803d40:	00 00 00 
+  803d43:	ff d0                	call   *%rax
+    return 0;
+}
+  803d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d4a:	5d                   	pop    %rbp
+  803d4b:	c3                   	ret
+
+0000000000803d4c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d4c:	55                   	push   %rbp
+  803d4d:	48 89 e5             	mov    %rsp,%rbp
+  803d50:	41 57                	push   %r15
+  803d52:	41 56                	push   %r14
+  803d54:	41 55                	push   %r13
+  803d56:	41 54                	push   %r12
+  803d58:	53                   	push   %rbx
+  803d59:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803d60:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803d67:	48 85 d2             	test   %rdx,%rdx
+  803d6a:	74 7a                	je     803de6 <devcons_write+0x9a>
+  803d6c:	49 89 d6             	mov    %rdx,%r14
+  803d6f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803d75:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803d7a:	49 bf dc 0e 80 00 00 	movabs $0x800edc,%r15
+  803d81:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803d84:	4c 89 f3             	mov    %r14,%rbx
+  803d87:	48 29 f3             	sub    %rsi,%rbx
+  803d8a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803d8f:	48 39 c3             	cmp    %rax,%rbx
+  803d92:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803d96:	4c 63 eb             	movslq %ebx,%r13
+  803d99:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803da0:	48 01 c6             	add    %rax,%rsi
+  803da3:	4c 89 ea             	mov    %r13,%rdx
+  803da6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803dad:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803db0:	4c 89 ee             	mov    %r13,%rsi
+  803db3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803dba:	48 b8 25 11 80 00 00 	movabs $0x801125,%rax
+  803dc1:	00 00 00 
+  803dc4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803dc6:	41 01 dc             	add    %ebx,%r12d
+  803dc9:	49 63 f4             	movslq %r12d,%rsi
+  803dcc:	4c 39 f6             	cmp    %r14,%rsi
+  803dcf:	72 b3                	jb     803d84 <devcons_write+0x38>
+    return res;
+  803dd1:	49 63 c4             	movslq %r12d,%rax
+}
+  803dd4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803ddb:	5b                   	pop    %rbx
+  803ddc:	41 5c                	pop    %r12
+  803dde:	41 5d                	pop    %r13
+  803de0:	41 5e                	pop    %r14
+  803de2:	41 5f                	pop    %r15
+  803de4:	5d                   	pop    %rbp
+  803de5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803de6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803dec:	eb e3                	jmp    803dd1 <devcons_write+0x85>
+
+0000000000803dee <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803dee:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803df1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803df6:	48 85 c0             	test   %rax,%rax
+  803df9:	74 55                	je     803e50 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803dfb:	55                   	push   %rbp
+  803dfc:	48 89 e5             	mov    %rsp,%rbp
+  803dff:	41 55                	push   %r13
+  803e01:	41 54                	push   %r12
+  803e03:	53                   	push   %rbx
+  803e04:	48 83 ec 08          	sub    $0x8,%rsp
+  803e08:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803e0b:	48 bb 52 11 80 00 00 	movabs $0x801152,%rbx
+  803e12:	00 00 00 
+  803e15:	49 bc 1f 12 80 00 00 	movabs $0x80121f,%r12
+  803e1c:	00 00 00 
+  803e1f:	eb 03                	jmp    803e24 <devcons_read+0x36>
+  803e21:	41 ff d4             	call   *%r12
+  803e24:	ff d3                	call   *%rbx
+  803e26:	85 c0                	test   %eax,%eax
+  803e28:	74 f7                	je     803e21 <devcons_read+0x33>
+    if (c < 0) return c;
+  803e2a:	48 63 d0             	movslq %eax,%rdx
+  803e2d:	78 13                	js     803e42 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803e2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e34:	83 f8 04             	cmp    $0x4,%eax
+  803e37:	74 09                	je     803e42 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803e39:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803e3d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803e42:	48 89 d0             	mov    %rdx,%rax
+  803e45:	48 83 c4 08          	add    $0x8,%rsp
+  803e49:	5b                   	pop    %rbx
+  803e4a:	41 5c                	pop    %r12
+  803e4c:	41 5d                	pop    %r13
+  803e4e:	5d                   	pop    %rbp
+  803e4f:	c3                   	ret
+  803e50:	48 89 d0             	mov    %rdx,%rax
+  803e53:	c3                   	ret
+
+0000000000803e54 <cputchar>:
+cputchar(int ch) {
+  803e54:	55                   	push   %rbp
+  803e55:	48 89 e5             	mov    %rsp,%rbp
+  803e58:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803e5c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803e60:	be 01 00 00 00       	mov    $0x1,%esi
+  803e65:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803e69:	48 b8 25 11 80 00 00 	movabs $0x801125,%rax
+  803e70:	00 00 00 
+  803e73:	ff d0                	call   *%rax
+}
+  803e75:	c9                   	leave
+  803e76:	c3                   	ret
+
+0000000000803e77 <getchar>:
+getchar(void) {
+  803e77:	55                   	push   %rbp
+  803e78:	48 89 e5             	mov    %rsp,%rbp
+  803e7b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803e7f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e84:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803e88:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e8d:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  803e94:	00 00 00 
+  803e97:	ff d0                	call   *%rax
+  803e99:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803e9b:	85 c0                	test   %eax,%eax
+  803e9d:	78 06                	js     803ea5 <getchar+0x2e>
+  803e9f:	74 08                	je     803ea9 <getchar+0x32>
+  803ea1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803ea5:	89 d0                	mov    %edx,%eax
+  803ea7:	c9                   	leave
+  803ea8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803ea9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803eae:	eb f5                	jmp    803ea5 <getchar+0x2e>
+
+0000000000803eb0 <iscons>:
+iscons(int fdnum) {
+  803eb0:	55                   	push   %rbp
+  803eb1:	48 89 e5             	mov    %rsp,%rbp
+  803eb4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803eb8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803ebc:	48 b8 52 1d 80 00 00 	movabs $0x801d52,%rax
+  803ec3:	00 00 00 
+  803ec6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ec8:	85 c0                	test   %eax,%eax
+  803eca:	78 18                	js     803ee4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803ecc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ed0:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803ed7:	00 00 00 
+  803eda:	8b 00                	mov    (%rax),%eax
+  803edc:	39 02                	cmp    %eax,(%rdx)
+  803ede:	0f 94 c0             	sete   %al
+  803ee1:	0f b6 c0             	movzbl %al,%eax
+}
+  803ee4:	c9                   	leave
+  803ee5:	c3                   	ret
+
+0000000000803ee6 <opencons>:
+opencons(void) {
+  803ee6:	55                   	push   %rbp
+  803ee7:	48 89 e5             	mov    %rsp,%rbp
+  803eea:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803eee:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803ef2:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  803ef9:	00 00 00 
+  803efc:	ff d0                	call   *%rax
+  803efe:	85 c0                	test   %eax,%eax
+  803f00:	78 49                	js     803f4b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803f02:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f07:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f0c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803f10:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f15:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  803f1c:	00 00 00 
+  803f1f:	ff d0                	call   *%rax
+  803f21:	85 c0                	test   %eax,%eax
+  803f23:	78 26                	js     803f4b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803f25:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f29:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803f30:	00 00 
+  803f32:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803f34:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f38:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803f3f:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  803f46:	00 00 00 
+  803f49:	ff d0                	call   *%rax
+}
+  803f4b:	c9                   	leave
+  803f4c:	c3                   	ret
+
+0000000000803f4d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803f4d:	55                   	push   %rbp
+  803f4e:	48 89 e5             	mov    %rsp,%rbp
+  803f51:	41 56                	push   %r14
+  803f53:	41 55                	push   %r13
+  803f55:	41 54                	push   %r12
+  803f57:	53                   	push   %rbx
+  803f58:	48 83 ec 50          	sub    $0x50,%rsp
+  803f5c:	49 89 fc             	mov    %rdi,%r12
+  803f5f:	41 89 f5             	mov    %esi,%r13d
+  803f62:	48 89 d3             	mov    %rdx,%rbx
+  803f65:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f69:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803f6d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803f71:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803f78:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f7c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803f80:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803f84:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803f88:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803f8f:	00 00 00 
+  803f92:	4c 8b 30             	mov    (%rax),%r14
+  803f95:	48 b8 ee 11 80 00 00 	movabs $0x8011ee,%rax
+  803f9c:	00 00 00 
+  803f9f:	ff d0                	call   *%rax
+  803fa1:	89 c6                	mov    %eax,%esi
+  803fa3:	45 89 e8             	mov    %r13d,%r8d
+  803fa6:	4c 89 e1             	mov    %r12,%rcx
+  803fa9:	4c 89 f2             	mov    %r14,%rdx
+  803fac:	48 bf e0 56 80 00 00 	movabs $0x8056e0,%rdi
+  803fb3:	00 00 00 
+  803fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fbb:	49 bc d6 01 80 00 00 	movabs $0x8001d6,%r12
+  803fc2:	00 00 00 
+  803fc5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803fc8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803fcc:	48 89 df             	mov    %rbx,%rdi
+  803fcf:	48 b8 72 01 80 00 00 	movabs $0x800172,%rax
+  803fd6:	00 00 00 
+  803fd9:	ff d0                	call   *%rax
+    cprintf("\n");
+  803fdb:	48 bf 02 50 80 00 00 	movabs $0x805002,%rdi
+  803fe2:	00 00 00 
+  803fe5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fea:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803fed:	cc                   	int3
+  803fee:	eb fd                	jmp    803fed <_panic+0xa0>
+
+0000000000803ff0 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803ff0:	55                   	push   %rbp
+  803ff1:	48 89 e5             	mov    %rsp,%rbp
+  803ff4:	41 55                	push   %r13
+  803ff6:	41 54                	push   %r12
+  803ff8:	53                   	push   %rbx
+  803ff9:	48 83 ec 08          	sub    $0x8,%rsp
+  803ffd:	49 89 fc             	mov    %rdi,%r12
+  804000:	48 89 f7             	mov    %rsi,%rdi
+  804003:	48 89 d3             	mov    %rdx,%rbx
+  804006:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804009:	48 85 f6             	test   %rsi,%rsi
+  80400c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804013:	00 00 00 
+  804016:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80401a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80401f:	48 85 d2             	test   %rdx,%rdx
+  804022:	74 03                	je     804027 <ipc_recv+0x37>
+  804024:	48 8b 32             	mov    (%rdx),%rsi
+  804027:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  80402e:	00 00 00 
+  804031:	ff d0                	call   *%rax
+    if (errno) {
+  804033:	85 c0                	test   %eax,%eax
+  804035:	74 1c                	je     804053 <ipc_recv+0x63>
+        if (from_env_store)
+  804037:	4d 85 e4             	test   %r12,%r12
+  80403a:	74 08                	je     804044 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80403c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804043:	00 
+
+        if (perm_store)
+  804044:	4d 85 ed             	test   %r13,%r13
+  804047:	74 74                	je     8040bd <ipc_recv+0xcd>
+            *perm_store = 0;
+  804049:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804050:	00 
+  804051:	eb 6a                	jmp    8040bd <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804053:	4d 85 e4             	test   %r12,%r12
+  804056:	74 14                	je     80406c <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804058:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80405f:	00 00 00 
+  804062:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804068:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80406c:	48 85 db             	test   %rbx,%rbx
+  80406f:	74 23                	je     804094 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804071:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804078:	00 00 00 
+  80407b:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804081:	ba 00 00 00 00       	mov    $0x0,%edx
+  804086:	85 c9                	test   %ecx,%ecx
+  804088:	74 07                	je     804091 <ipc_recv+0xa1>
+  80408a:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804091:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804094:	4d 85 ed             	test   %r13,%r13
+  804097:	74 14                	je     8040ad <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804099:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040a0:	00 00 00 
+  8040a3:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8040a9:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8040ad:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040b4:	00 00 00 
+  8040b7:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040bd:	48 83 c4 08          	add    $0x8,%rsp
+  8040c1:	5b                   	pop    %rbx
+  8040c2:	41 5c                	pop    %r12
+  8040c4:	41 5d                	pop    %r13
+  8040c6:	5d                   	pop    %rbp
+  8040c7:	c3                   	ret
+
+00000000008040c8 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040c8:	55                   	push   %rbp
+  8040c9:	48 89 e5             	mov    %rsp,%rbp
+  8040cc:	41 55                	push   %r13
+  8040ce:	41 54                	push   %r12
+  8040d0:	53                   	push   %rbx
+  8040d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8040d5:	49 89 fc             	mov    %rdi,%r12
+  8040d8:	48 89 f7             	mov    %rsi,%rdi
+  8040db:	48 89 d3             	mov    %rdx,%rbx
+  8040de:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040e1:	48 85 f6             	test   %rsi,%rsi
+  8040e4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040eb:	00 00 00 
+  8040ee:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040f2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040f7:	48 85 d2             	test   %rdx,%rdx
+  8040fa:	74 03                	je     8040ff <ipc_try_recv+0x37>
+  8040fc:	48 8b 32             	mov    (%rdx),%rsi
+  8040ff:	48 b8 c4 16 80 00 00 	movabs $0x8016c4,%rax
+  804106:	00 00 00 
+  804109:	ff d0                	call   *%rax
+    if (errno) {
+  80410b:	85 c0                	test   %eax,%eax
+  80410d:	75 75                	jne    804184 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80410f:	4d 85 e4             	test   %r12,%r12
+  804112:	74 14                	je     804128 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804114:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80411b:	00 00 00 
+  80411e:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804124:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804128:	48 85 db             	test   %rbx,%rbx
+  80412b:	74 23                	je     804150 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80412d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804134:	00 00 00 
+  804137:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80413d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804142:	85 c9                	test   %ecx,%ecx
+  804144:	74 07                	je     80414d <ipc_try_recv+0x85>
+  804146:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80414d:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804150:	4d 85 ed             	test   %r13,%r13
+  804153:	74 14                	je     804169 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804155:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80415c:	00 00 00 
+  80415f:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804165:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804169:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804170:	00 00 00 
+  804173:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804179:	48 83 c4 08          	add    $0x8,%rsp
+  80417d:	5b                   	pop    %rbx
+  80417e:	41 5c                	pop    %r12
+  804180:	41 5d                	pop    %r13
+  804182:	5d                   	pop    %rbp
+  804183:	c3                   	ret
+        if (from_env_store)
+  804184:	4d 85 e4             	test   %r12,%r12
+  804187:	74 08                	je     804191 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804189:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804190:	00 
+        if (perm_store)
+  804191:	4d 85 ed             	test   %r13,%r13
+  804194:	74 e3                	je     804179 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804196:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80419d:	00 
+  80419e:	eb d9                	jmp    804179 <ipc_try_recv+0xb1>
+
+00000000008041a0 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8041a0:	55                   	push   %rbp
+  8041a1:	48 89 e5             	mov    %rsp,%rbp
+  8041a4:	41 57                	push   %r15
+  8041a6:	41 56                	push   %r14
+  8041a8:	41 55                	push   %r13
+  8041aa:	41 54                	push   %r12
+  8041ac:	53                   	push   %rbx
+  8041ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8041b1:	41 89 fd             	mov    %edi,%r13d
+  8041b4:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8041b7:	48 89 d3             	mov    %rdx,%rbx
+  8041ba:	49 89 cc             	mov    %rcx,%r12
+  8041bd:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041c1:	48 85 d2             	test   %rdx,%rdx
+  8041c4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041cb:	00 00 00 
+  8041ce:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041d2:	49 be 2f 16 80 00 00 	movabs $0x80162f,%r14
+  8041d9:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041dc:	49 bf 1f 12 80 00 00 	movabs $0x80121f,%r15
+  8041e3:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041e6:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041e9:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041ed:	4c 89 e1             	mov    %r12,%rcx
+  8041f0:	48 89 da             	mov    %rbx,%rdx
+  8041f3:	44 89 ef             	mov    %r13d,%edi
+  8041f6:	41 ff d6             	call   *%r14
+  8041f9:	85 c0                	test   %eax,%eax
+  8041fb:	74 37                	je     804234 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041fd:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804200:	75 05                	jne    804207 <ipc_send+0x67>
+        sys_yield();
+  804202:	41 ff d7             	call   *%r15
+  804205:	eb df                	jmp    8041e6 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804207:	89 c1                	mov    %eax,%ecx
+  804209:	48 ba 03 57 80 00 00 	movabs $0x805703,%rdx
+  804210:	00 00 00 
+  804213:	be 65 00 00 00       	mov    $0x65,%esi
+  804218:	48 bf 1e 57 80 00 00 	movabs $0x80571e,%rdi
+  80421f:	00 00 00 
+  804222:	b8 00 00 00 00       	mov    $0x0,%eax
+  804227:	49 b8 4d 3f 80 00 00 	movabs $0x803f4d,%r8
+  80422e:	00 00 00 
+  804231:	41 ff d0             	call   *%r8
+    }
+}
+  804234:	48 83 c4 18          	add    $0x18,%rsp
+  804238:	5b                   	pop    %rbx
+  804239:	41 5c                	pop    %r12
+  80423b:	41 5d                	pop    %r13
+  80423d:	41 5e                	pop    %r14
+  80423f:	41 5f                	pop    %r15
+  804241:	5d                   	pop    %rbp
+  804242:	c3                   	ret
+
+0000000000804243 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804243:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804248:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80424f:	00 00 00 
+  804252:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804259:	48 01 ca             	add    %rcx,%rdx
+  80425c:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804262:	39 fa                	cmp    %edi,%edx
+  804264:	74 12                	je     804278 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804266:	48 83 c0 01          	add    $0x1,%rax
+  80426a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804270:	75 e0                	jne    804252 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804272:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804277:	c3                   	ret
+            return envs[i].env_id;
+  804278:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80427f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804286:	00 00 00 
+  804289:	48 01 d0             	add    %rdx,%rax
+  80428c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804292:	c3                   	ret
+
+0000000000804293 <__text_end>:
+  804293:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429a:	00 00 00 
+  80429d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a4:	00 00 00 
+  8042a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ae:	00 00 00 
+  8042b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b8:	00 00 00 
+  8042bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c2:	00 00 00 
+  8042c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cc:	00 00 00 
+  8042cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d6:	00 00 00 
+  8042d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e0:	00 00 00 
+  8042e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ea:	00 00 00 
+  8042ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f4:	00 00 00 
+  8042f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fe:	00 00 00 
+  804301:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804308:	00 00 00 
+  80430b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804312:	00 00 00 
+  804315:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431c:	00 00 00 
+  80431f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804326:	00 00 00 
+  804329:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804330:	00 00 00 
+  804333:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433a:	00 00 00 
+  80433d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804344:	00 00 00 
+  804347:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434e:	00 00 00 
+  804351:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804358:	00 00 00 
+  80435b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804362:	00 00 00 
+  804365:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436c:	00 00 00 
+  80436f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804376:	00 00 00 
+  804379:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804380:	00 00 00 
+  804383:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438a:	00 00 00 
+  80438d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804394:	00 00 00 
+  804397:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439e:	00 00 00 
+  8043a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a8:	00 00 00 
+  8043ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b2:	00 00 00 
+  8043b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bc:	00 00 00 
+  8043bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c6:	00 00 00 
+  8043c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d0:	00 00 00 
+  8043d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043da:	00 00 00 
+  8043dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e4:	00 00 00 
+  8043e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ee:	00 00 00 
+  8043f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f8:	00 00 00 
+  8043fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804402:	00 00 00 
+  804405:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440c:	00 00 00 
+  80440f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804416:	00 00 00 
+  804419:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804420:	00 00 00 
+  804423:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442a:	00 00 00 
+  80442d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804434:	00 00 00 
+  804437:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443e:	00 00 00 
+  804441:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804448:	00 00 00 
+  80444b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804452:	00 00 00 
+  804455:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445c:	00 00 00 
+  80445f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804466:	00 00 00 
+  804469:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804470:	00 00 00 
+  804473:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447a:	00 00 00 
+  80447d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804484:	00 00 00 
+  804487:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448e:	00 00 00 
+  804491:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804498:	00 00 00 
+  80449b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a2:	00 00 00 
+  8044a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ac:	00 00 00 
+  8044af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b6:	00 00 00 
+  8044b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c0:	00 00 00 
+  8044c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ca:	00 00 00 
+  8044cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d4:	00 00 00 
+  8044d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044de:	00 00 00 
+  8044e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e8:	00 00 00 
+  8044eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f2:	00 00 00 
+  8044f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fc:	00 00 00 
+  8044ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804506:	00 00 00 
+  804509:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804510:	00 00 00 
+  804513:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451a:	00 00 00 
+  80451d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804524:	00 00 00 
+  804527:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452e:	00 00 00 
+  804531:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804538:	00 00 00 
+  80453b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804542:	00 00 00 
+  804545:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454c:	00 00 00 
+  80454f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804556:	00 00 00 
+  804559:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804560:	00 00 00 
+  804563:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456a:	00 00 00 
+  80456d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804574:	00 00 00 
+  804577:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457e:	00 00 00 
+  804581:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804588:	00 00 00 
+  80458b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804592:	00 00 00 
+  804595:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459c:	00 00 00 
+  80459f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a6:	00 00 00 
+  8045a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b0:	00 00 00 
+  8045b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ba:	00 00 00 
+  8045bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c4:	00 00 00 
+  8045c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ce:	00 00 00 
+  8045d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d8:	00 00 00 
+  8045db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e2:	00 00 00 
+  8045e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ec:	00 00 00 
+  8045ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f6:	00 00 00 
+  8045f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804600:	00 00 00 
+  804603:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460a:	00 00 00 
+  80460d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804614:	00 00 00 
+  804617:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461e:	00 00 00 
+  804621:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804628:	00 00 00 
+  80462b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804632:	00 00 00 
+  804635:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463c:	00 00 00 
+  80463f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804646:	00 00 00 
+  804649:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804650:	00 00 00 
+  804653:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465a:	00 00 00 
+  80465d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804664:	00 00 00 
+  804667:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466e:	00 00 00 
+  804671:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804678:	00 00 00 
+  80467b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804682:	00 00 00 
+  804685:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468c:	00 00 00 
+  80468f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804696:	00 00 00 
+  804699:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a0:	00 00 00 
+  8046a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046aa:	00 00 00 
+  8046ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b4:	00 00 00 
+  8046b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046be:	00 00 00 
+  8046c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c8:	00 00 00 
+  8046cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d2:	00 00 00 
+  8046d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dc:	00 00 00 
+  8046df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e6:	00 00 00 
+  8046e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f0:	00 00 00 
+  8046f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fa:	00 00 00 
+  8046fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804704:	00 00 00 
+  804707:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470e:	00 00 00 
+  804711:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804718:	00 00 00 
+  80471b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804722:	00 00 00 
+  804725:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472c:	00 00 00 
+  80472f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804736:	00 00 00 
+  804739:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804740:	00 00 00 
+  804743:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474a:	00 00 00 
+  80474d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804754:	00 00 00 
+  804757:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475e:	00 00 00 
+  804761:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804768:	00 00 00 
+  80476b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804772:	00 00 00 
+  804775:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477c:	00 00 00 
+  80477f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804786:	00 00 00 
+  804789:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804790:	00 00 00 
+  804793:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479a:	00 00 00 
+  80479d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a4:	00 00 00 
+  8047a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ae:	00 00 00 
+  8047b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b8:	00 00 00 
+  8047bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c2:	00 00 00 
+  8047c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cc:	00 00 00 
+  8047cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d6:	00 00 00 
+  8047d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e0:	00 00 00 
+  8047e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ea:	00 00 00 
+  8047ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f4:	00 00 00 
+  8047f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fe:	00 00 00 
+  804801:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804808:	00 00 00 
+  80480b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804812:	00 00 00 
+  804815:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481c:	00 00 00 
+  80481f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804826:	00 00 00 
+  804829:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804830:	00 00 00 
+  804833:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483a:	00 00 00 
+  80483d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804844:	00 00 00 
+  804847:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484e:	00 00 00 
+  804851:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804858:	00 00 00 
+  80485b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804862:	00 00 00 
+  804865:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486c:	00 00 00 
+  80486f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804876:	00 00 00 
+  804879:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804880:	00 00 00 
+  804883:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488a:	00 00 00 
+  80488d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804894:	00 00 00 
+  804897:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489e:	00 00 00 
+  8048a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a8:	00 00 00 
+  8048ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b2:	00 00 00 
+  8048b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bc:	00 00 00 
+  8048bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c6:	00 00 00 
+  8048c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d0:	00 00 00 
+  8048d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048da:	00 00 00 
+  8048dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e4:	00 00 00 
+  8048e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ee:	00 00 00 
+  8048f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f8:	00 00 00 
+  8048fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804902:	00 00 00 
+  804905:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490c:	00 00 00 
+  80490f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804916:	00 00 00 
+  804919:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804920:	00 00 00 
+  804923:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492a:	00 00 00 
+  80492d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804934:	00 00 00 
+  804937:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493e:	00 00 00 
+  804941:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804948:	00 00 00 
+  80494b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804952:	00 00 00 
+  804955:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495c:	00 00 00 
+  80495f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804966:	00 00 00 
+  804969:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804970:	00 00 00 
+  804973:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497a:	00 00 00 
+  80497d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804984:	00 00 00 
+  804987:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498e:	00 00 00 
+  804991:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804998:	00 00 00 
+  80499b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a2:	00 00 00 
+  8049a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ac:	00 00 00 
+  8049af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b6:	00 00 00 
+  8049b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c0:	00 00 00 
+  8049c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ca:	00 00 00 
+  8049cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d4:	00 00 00 
+  8049d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049de:	00 00 00 
+  8049e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e8:	00 00 00 
+  8049eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f2:	00 00 00 
+  8049f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fc:	00 00 00 
+  8049ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a06:	00 00 00 
+  804a09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a10:	00 00 00 
+  804a13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1a:	00 00 00 
+  804a1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a24:	00 00 00 
+  804a27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2e:	00 00 00 
+  804a31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a38:	00 00 00 
+  804a3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a42:	00 00 00 
+  804a45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4c:	00 00 00 
+  804a4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a56:	00 00 00 
+  804a59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a60:	00 00 00 
+  804a63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6a:	00 00 00 
+  804a6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a74:	00 00 00 
+  804a77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7e:	00 00 00 
+  804a81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a88:	00 00 00 
+  804a8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a92:	00 00 00 
+  804a95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9c:	00 00 00 
+  804a9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa6:	00 00 00 
+  804aa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab0:	00 00 00 
+  804ab3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aba:	00 00 00 
+  804abd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac4:	00 00 00 
+  804ac7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ace:	00 00 00 
+  804ad1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad8:	00 00 00 
+  804adb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae2:	00 00 00 
+  804ae5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aec:	00 00 00 
+  804aef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af6:	00 00 00 
+  804af9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b00:	00 00 00 
+  804b03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0a:	00 00 00 
+  804b0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b14:	00 00 00 
+  804b17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1e:	00 00 00 
+  804b21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b28:	00 00 00 
+  804b2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b32:	00 00 00 
+  804b35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3c:	00 00 00 
+  804b3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b46:	00 00 00 
+  804b49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b50:	00 00 00 
+  804b53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5a:	00 00 00 
+  804b5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b64:	00 00 00 
+  804b67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6e:	00 00 00 
+  804b71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b78:	00 00 00 
+  804b7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b82:	00 00 00 
+  804b85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8c:	00 00 00 
+  804b8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b96:	00 00 00 
+  804b99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba0:	00 00 00 
+  804ba3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baa:	00 00 00 
+  804bad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb4:	00 00 00 
+  804bb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbe:	00 00 00 
+  804bc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc8:	00 00 00 
+  804bcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd2:	00 00 00 
+  804bd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdc:	00 00 00 
+  804bdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be6:	00 00 00 
+  804be9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf0:	00 00 00 
+  804bf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfa:	00 00 00 
+  804bfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c04:	00 00 00 
+  804c07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0e:	00 00 00 
+  804c11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c18:	00 00 00 
+  804c1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c22:	00 00 00 
+  804c25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2c:	00 00 00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c40:	00 00 00 
+  804c43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4a:	00 00 00 
+  804c4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c54:	00 00 00 
+  804c57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5e:	00 00 00 
+  804c61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c68:	00 00 00 
+  804c6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c72:	00 00 00 
+  804c75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7c:	00 00 00 
+  804c7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c86:	00 00 00 
+  804c89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c90:	00 00 00 
+  804c93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9a:	00 00 00 
+  804c9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca4:	00 00 00 
+  804ca7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cae:	00 00 00 
+  804cb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb8:	00 00 00 
+  804cbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc2:	00 00 00 
+  804cc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccc:	00 00 00 
+  804ccf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd6:	00 00 00 
+  804cd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce0:	00 00 00 
+  804ce3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cea:	00 00 00 
+  804ced:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf4:	00 00 00 
+  804cf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfe:	00 00 00 
+  804d01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d08:	00 00 00 
+  804d0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d12:	00 00 00 
+  804d15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1c:	00 00 00 
+  804d1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d26:	00 00 00 
+  804d29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d30:	00 00 00 
+  804d33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3a:	00 00 00 
+  804d3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d44:	00 00 00 
+  804d47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4e:	00 00 00 
+  804d51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d58:	00 00 00 
+  804d5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d62:	00 00 00 
+  804d65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6c:	00 00 00 
+  804d6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d76:	00 00 00 
+  804d79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d80:	00 00 00 
+  804d83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8a:	00 00 00 
+  804d8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d94:	00 00 00 
+  804d97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9e:	00 00 00 
+  804da1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da8:	00 00 00 
+  804dab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db2:	00 00 00 
+  804db5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbc:	00 00 00 
+  804dbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc6:	00 00 00 
+  804dc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd0:	00 00 00 
+  804dd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dda:	00 00 00 
+  804ddd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de4:	00 00 00 
+  804de7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dee:	00 00 00 
+  804df1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df8:	00 00 00 
+  804dfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e02:	00 00 00 
+  804e05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0c:	00 00 00 
+  804e0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e16:	00 00 00 
+  804e19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e20:	00 00 00 
+  804e23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2a:	00 00 00 
+  804e2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e34:	00 00 00 
+  804e37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3e:	00 00 00 
+  804e41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e48:	00 00 00 
+  804e4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e52:	00 00 00 
+  804e55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5c:	00 00 00 
+  804e5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e66:	00 00 00 
+  804e69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e70:	00 00 00 
+  804e73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7a:	00 00 00 
+  804e7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e84:	00 00 00 
+  804e87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8e:	00 00 00 
+  804e91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e98:	00 00 00 
+  804e9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea2:	00 00 00 
+  804ea5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eac:	00 00 00 
+  804eaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb6:	00 00 00 
+  804eb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec0:	00 00 00 
+  804ec3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eca:	00 00 00 
+  804ecd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed4:	00 00 00 
+  804ed7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ede:	00 00 00 
+  804ee1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee8:	00 00 00 
+  804eeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef2:	00 00 00 
+  804ef5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efc:	00 00 00 
+  804eff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f06:	00 00 00 
+  804f09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f10:	00 00 00 
+  804f13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1a:	00 00 00 
+  804f1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f24:	00 00 00 
+  804f27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2e:	00 00 00 
+  804f31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f38:	00 00 00 
+  804f3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f42:	00 00 00 
+  804f45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4c:	00 00 00 
+  804f4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f56:	00 00 00 
+  804f59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f60:	00 00 00 
+  804f63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6a:	00 00 00 
+  804f6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f74:	00 00 00 
+  804f77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7e:	00 00 00 
+  804f81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f88:	00 00 00 
+  804f8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f92:	00 00 00 
+  804f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9c:	00 00 00 
+  804f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa6:	00 00 00 
+  804fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb0:	00 00 00 
+  804fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fba:	00 00 00 
+  804fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc4:	00 00 00 
+  804fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fce:	00 00 00 
+  804fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd8:	00 00 00 
+  804fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe2:	00 00 00 
+  804fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fec:	00 00 00 
+  804fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff6:	00 00 00 
+  804ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
@@ -0,0 +1,8096 @@
+
+obj/user/breakpoint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 04 00 00 00       	call   800027 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $3");
+  800025:	cc                   	int3
+}
+  800026:	c3                   	ret
+
+0000000000800027 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800027:	55                   	push   %rbp
+  800028:	48 89 e5             	mov    %rsp,%rbp
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	41 89 fd             	mov    %edi,%r13d
+  800035:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800038:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80003f:	00 00 00 
+  800042:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800049:	00 00 00 
+  80004c:	48 39 c2             	cmp    %rax,%rdx
+  80004f:	73 17                	jae    800068 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800051:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800054:	49 89 c4             	mov    %rax,%r12
+  800057:	48 83 c3 08          	add    $0x8,%rbx
+  80005b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800060:	ff 53 f8             	call   *-0x8(%rbx)
+  800063:	4c 39 e3             	cmp    %r12,%rbx
+  800066:	72 ef                	jb     800057 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800068:	48 b8 bc 01 80 00 00 	movabs $0x8001bc,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800079:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800080:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800087:	00 00 00 
+  80008a:	48 01 d0             	add    %rdx,%rax
+  80008d:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800094:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800097:	45 85 ed             	test   %r13d,%r13d
+  80009a:	7e 0d                	jle    8000a9 <libmain+0x82>
+  80009c:	49 8b 06             	mov    (%r14),%rax
+  80009f:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000a6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000a9:	4c 89 f6             	mov    %r14,%rsi
+  8000ac:	44 89 ef             	mov    %r13d,%edi
+  8000af:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b6:	00 00 00 
+  8000b9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000bb:	48 b8 d0 00 80 00 00 	movabs $0x8000d0,%rax
+  8000c2:	00 00 00 
+  8000c5:	ff d0                	call   *%rax
+#endif
+}
+  8000c7:	5b                   	pop    %rbx
+  8000c8:	41 5c                	pop    %r12
+  8000ca:	41 5d                	pop    %r13
+  8000cc:	41 5e                	pop    %r14
+  8000ce:	5d                   	pop    %rbp
+  8000cf:	c3                   	ret
+
+00000000008000d0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d0:	55                   	push   %rbp
+  8000d1:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000d4:	48 b8 b8 0e 80 00 00 	movabs $0x800eb8,%rax
+  8000db:	00 00 00 
+  8000de:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e5:	48 b8 51 01 80 00 00 	movabs $0x800151,%rax
+  8000ec:	00 00 00 
+  8000ef:	ff d0                	call   *%rax
+}
+  8000f1:	5d                   	pop    %rbp
+  8000f2:	c3                   	ret
+
+00000000008000f3 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f3:	55                   	push   %rbp
+  8000f4:	48 89 e5             	mov    %rsp,%rbp
+  8000f7:	53                   	push   %rbx
+  8000f8:	48 89 fa             	mov    %rdi,%rdx
+  8000fb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800103:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800108:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80010d:	be 00 00 00 00       	mov    $0x0,%esi
+  800112:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800118:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80011a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80011e:	c9                   	leave
+  80011f:	c3                   	ret
+
+0000000000800120 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800120:	55                   	push   %rbp
+  800121:	48 89 e5             	mov    %rsp,%rbp
+  800124:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800125:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80012a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800134:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800139:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80013e:	be 00 00 00 00       	mov    $0x0,%esi
+  800143:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800149:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80014b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80014f:	c9                   	leave
+  800150:	c3                   	ret
+
+0000000000800151 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800151:	55                   	push   %rbp
+  800152:	48 89 e5             	mov    %rsp,%rbp
+  800155:	53                   	push   %rbx
+  800156:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80015a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80015d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800162:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800167:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80016c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800171:	be 00 00 00 00       	mov    $0x0,%esi
+  800176:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80017c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80017e:	48 85 c0             	test   %rax,%rax
+  800181:	7f 06                	jg     800189 <sys_env_destroy+0x38>
+}
+  800183:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800187:	c9                   	leave
+  800188:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800189:	49 89 c0             	mov    %rax,%r8
+  80018c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800191:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800198:	00 00 00 
+  80019b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001a0:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8001a7:	00 00 00 
+  8001aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001af:	49 b9 1b 2f 80 00 00 	movabs $0x802f1b,%r9
+  8001b6:	00 00 00 
+  8001b9:	41 ff d1             	call   *%r9
+
+00000000008001bc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001bc:	55                   	push   %rbp
+  8001bd:	48 89 e5             	mov    %rsp,%rbp
+  8001c0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001da:	be 00 00 00 00       	mov    $0x0,%esi
+  8001df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001e5:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001eb:	c9                   	leave
+  8001ec:	c3                   	ret
+
+00000000008001ed <sys_yield>:
+
+void
+sys_yield(void) {
+  8001ed:	55                   	push   %rbp
+  8001ee:	48 89 e5             	mov    %rsp,%rbp
+  8001f1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f2:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800206:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80020b:	be 00 00 00 00       	mov    $0x0,%esi
+  800210:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800216:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800218:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80021c:	c9                   	leave
+  80021d:	c3                   	ret
+
+000000000080021e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80021e:	55                   	push   %rbp
+  80021f:	48 89 e5             	mov    %rsp,%rbp
+  800222:	53                   	push   %rbx
+  800223:	48 89 fa             	mov    %rdi,%rdx
+  800226:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800229:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800235:	00 00 00 
+  800238:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80023d:	be 00 00 00 00       	mov    $0x0,%esi
+  800242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800248:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80024a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80024e:	c9                   	leave
+  80024f:	c3                   	ret
+
+0000000000800250 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800250:	55                   	push   %rbp
+  800251:	48 89 e5             	mov    %rsp,%rbp
+  800254:	53                   	push   %rbx
+  800255:	49 89 f8             	mov    %rdi,%r8
+  800258:	48 89 d3             	mov    %rdx,%rbx
+  80025b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80025e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800263:	4c 89 c2             	mov    %r8,%rdx
+  800266:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800269:	be 00 00 00 00       	mov    $0x0,%esi
+  80026e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800274:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800276:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027a:	c9                   	leave
+  80027b:	c3                   	ret
+
+000000000080027c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80027c:	55                   	push   %rbp
+  80027d:	48 89 e5             	mov    %rsp,%rbp
+  800280:	53                   	push   %rbx
+  800281:	48 83 ec 08          	sub    $0x8,%rsp
+  800285:	89 f8                	mov    %edi,%eax
+  800287:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80028a:	48 63 f9             	movslq %ecx,%rdi
+  80028d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800290:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800295:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800298:	be 00 00 00 00       	mov    $0x0,%esi
+  80029d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002a5:	48 85 c0             	test   %rax,%rax
+  8002a8:	7f 06                	jg     8002b0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b0:	49 89 c0             	mov    %rax,%r8
+  8002b3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002b8:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8002bf:	00 00 00 
+  8002c2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002c7:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8002ce:	00 00 00 
+  8002d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d6:	49 b9 1b 2f 80 00 00 	movabs $0x802f1b,%r9
+  8002dd:	00 00 00 
+  8002e0:	41 ff d1             	call   *%r9
+
+00000000008002e3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e3:	55                   	push   %rbp
+  8002e4:	48 89 e5             	mov    %rsp,%rbp
+  8002e7:	53                   	push   %rbx
+  8002e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ec:	89 f8                	mov    %edi,%eax
+  8002ee:	49 89 f2             	mov    %rsi,%r10
+  8002f1:	48 89 cf             	mov    %rcx,%rdi
+  8002f4:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002f7:	48 63 da             	movslq %edx,%rbx
+  8002fa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002fd:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800302:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800305:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800308:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80030a:	48 85 c0             	test   %rax,%rax
+  80030d:	7f 06                	jg     800315 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80030f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800313:	c9                   	leave
+  800314:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800315:	49 89 c0             	mov    %rax,%r8
+  800318:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80031d:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800324:	00 00 00 
+  800327:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80032c:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800333:	00 00 00 
+  800336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033b:	49 b9 1b 2f 80 00 00 	movabs $0x802f1b,%r9
+  800342:	00 00 00 
+  800345:	41 ff d1             	call   *%r9
+
+0000000000800348 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800348:	55                   	push   %rbp
+  800349:	48 89 e5             	mov    %rsp,%rbp
+  80034c:	53                   	push   %rbx
+  80034d:	48 83 ec 08          	sub    $0x8,%rsp
+  800351:	49 89 f9             	mov    %rdi,%r9
+  800354:	89 f0                	mov    %esi,%eax
+  800356:	48 89 d3             	mov    %rdx,%rbx
+  800359:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80035c:	49 63 f0             	movslq %r8d,%rsi
+  80035f:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800362:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800367:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80036a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800370:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800372:	48 85 c0             	test   %rax,%rax
+  800375:	7f 06                	jg     80037d <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800377:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80037b:	c9                   	leave
+  80037c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80037d:	49 89 c0             	mov    %rax,%r8
+  800380:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800385:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80038c:	00 00 00 
+  80038f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800394:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80039b:	00 00 00 
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	49 b9 1b 2f 80 00 00 	movabs $0x802f1b,%r9
+  8003aa:	00 00 00 
+  8003ad:	41 ff d1             	call   *%r9
+
+00000000008003b0 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003b0:	55                   	push   %rbp
+  8003b1:	48 89 e5             	mov    %rsp,%rbp
+  8003b4:	53                   	push   %rbx
+  8003b5:	89 f8                	mov    %edi,%eax
+  8003b7:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8003ba:	48 63 f9             	movslq %ecx,%rdi
+  8003bd:	48 63 da             	movslq %edx,%rbx
+  8003c0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003c8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003d6:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8003d8:	89 c2                	mov    %eax,%edx
+  8003da:	48 85 c0             	test   %rax,%rax
+  8003dd:	78 0d                	js     8003ec <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8003df:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8003e4:	4d 85 c9             	test   %r9,%r9
+  8003e7:	74 03                	je     8003ec <sys_alloc_dma_region+0x3c>
+  8003e9:	49 89 01             	mov    %rax,(%r9)
+}
+  8003ec:	89 d0                	mov    %edx,%eax
+  8003ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003f2:	c9                   	leave
+  8003f3:	c3                   	ret
+
+00000000008003f4 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8003f4:	55                   	push   %rbp
+  8003f5:	48 89 e5             	mov    %rsp,%rbp
+  8003f8:	53                   	push   %rbx
+  8003f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8003fd:	48 89 f1             	mov    %rsi,%rcx
+  800400:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800403:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800406:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80040b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800410:	be 00 00 00 00       	mov    $0x0,%esi
+  800415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80041b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80041d:	48 85 c0             	test   %rax,%rax
+  800420:	7f 06                	jg     800428 <sys_set_cache_region+0x34>
+}
+  800422:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800426:	c9                   	leave
+  800427:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800428:	49 89 c0             	mov    %rax,%r8
+  80042b:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800430:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800437:	00 00 00 
+  80043a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80043f:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800446:	00 00 00 
+  800449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044e:	49 b9 1b 2f 80 00 00 	movabs $0x802f1b,%r9
+  800455:	00 00 00 
+  800458:	41 ff d1             	call   *%r9
+
+000000000080045b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80045b:	55                   	push   %rbp
+  80045c:	48 89 e5             	mov    %rsp,%rbp
+  80045f:	53                   	push   %rbx
+  800460:	48 83 ec 08          	sub    $0x8,%rsp
+  800464:	48 89 f1             	mov    %rsi,%rcx
+  800467:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80046a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80046d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800472:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800477:	be 00 00 00 00       	mov    $0x0,%esi
+  80047c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800482:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800484:	48 85 c0             	test   %rax,%rax
+  800487:	7f 06                	jg     80048f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800489:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80048d:	c9                   	leave
+  80048e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80048f:	49 89 c0             	mov    %rax,%r8
+  800492:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800497:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80049e:	00 00 00 
+  8004a1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004a6:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8004ad:	00 00 00 
+  8004b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b5:	49 b9 1b 2f 80 00 00 	movabs $0x802f1b,%r9
+  8004bc:	00 00 00 
+  8004bf:	41 ff d1             	call   *%r9
+
+00000000008004c2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004c2:	55                   	push   %rbp
+  8004c3:	48 89 e5             	mov    %rsp,%rbp
+  8004c6:	53                   	push   %rbx
+  8004c7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004cb:	48 63 ce             	movslq %esi,%rcx
+  8004ce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004d1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8004e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ed:	48 85 c0             	test   %rax,%rax
+  8004f0:	7f 06                	jg     8004f8 <sys_env_set_status+0x36>
+}
+  8004f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004f6:	c9                   	leave
+  8004f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004f8:	49 89 c0             	mov    %rax,%r8
+  8004fb:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800500:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800507:	00 00 00 
+  80050a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80050f:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800516:	00 00 00 
+  800519:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051e:	49 b9 1b 2f 80 00 00 	movabs $0x802f1b,%r9
+  800525:	00 00 00 
+  800528:	41 ff d1             	call   *%r9
+
+000000000080052b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80052b:	55                   	push   %rbp
+  80052c:	48 89 e5             	mov    %rsp,%rbp
+  80052f:	53                   	push   %rbx
+  800530:	48 83 ec 08          	sub    $0x8,%rsp
+  800534:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800537:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80053a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80053f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800544:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800549:	be 00 00 00 00       	mov    $0x0,%esi
+  80054e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800554:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800556:	48 85 c0             	test   %rax,%rax
+  800559:	7f 06                	jg     800561 <sys_env_set_trapframe+0x36>
+}
+  80055b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80055f:	c9                   	leave
+  800560:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800561:	49 89 c0             	mov    %rax,%r8
+  800564:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800569:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800570:	00 00 00 
+  800573:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800578:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80057f:	00 00 00 
+  800582:	b8 00 00 00 00       	mov    $0x0,%eax
+  800587:	49 b9 1b 2f 80 00 00 	movabs $0x802f1b,%r9
+  80058e:	00 00 00 
+  800591:	41 ff d1             	call   *%r9
+
+0000000000800594 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800594:	55                   	push   %rbp
+  800595:	48 89 e5             	mov    %rsp,%rbp
+  800598:	53                   	push   %rbx
+  800599:	48 83 ec 08          	sub    $0x8,%rsp
+  80059d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005a0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005a3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005bf:	48 85 c0             	test   %rax,%rax
+  8005c2:	7f 06                	jg     8005ca <sys_env_set_pgfault_upcall+0x36>
+}
+  8005c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005c8:	c9                   	leave
+  8005c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005ca:	49 89 c0             	mov    %rax,%r8
+  8005cd:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005d2:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8005d9:	00 00 00 
+  8005dc:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8005e1:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8005e8:	00 00 00 
+  8005eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f0:	49 b9 1b 2f 80 00 00 	movabs $0x802f1b,%r9
+  8005f7:	00 00 00 
+  8005fa:	41 ff d1             	call   *%r9
+
+00000000008005fd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005fd:	55                   	push   %rbp
+  8005fe:	48 89 e5             	mov    %rsp,%rbp
+  800601:	53                   	push   %rbx
+  800602:	89 f8                	mov    %edi,%eax
+  800604:	49 89 f1             	mov    %rsi,%r9
+  800607:	48 89 d3             	mov    %rdx,%rbx
+  80060a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80060d:	49 63 f0             	movslq %r8d,%rsi
+  800610:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800613:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800618:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80061b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800621:	cd 30                	int    $0x30
+}
+  800623:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800627:	c9                   	leave
+  800628:	c3                   	ret
+
+0000000000800629 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800629:	55                   	push   %rbp
+  80062a:	48 89 e5             	mov    %rsp,%rbp
+  80062d:	53                   	push   %rbx
+  80062e:	48 83 ec 08          	sub    $0x8,%rsp
+  800632:	48 89 fa             	mov    %rdi,%rdx
+  800635:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800638:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80063d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800642:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800647:	be 00 00 00 00       	mov    $0x0,%esi
+  80064c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800652:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800654:	48 85 c0             	test   %rax,%rax
+  800657:	7f 06                	jg     80065f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800659:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80065d:	c9                   	leave
+  80065e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80065f:	49 89 c0             	mov    %rax,%r8
+  800662:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800667:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80066e:	00 00 00 
+  800671:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800676:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80067d:	00 00 00 
+  800680:	b8 00 00 00 00       	mov    $0x0,%eax
+  800685:	49 b9 1b 2f 80 00 00 	movabs $0x802f1b,%r9
+  80068c:	00 00 00 
+  80068f:	41 ff d1             	call   *%r9
+
+0000000000800692 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  800692:	55                   	push   %rbp
+  800693:	48 89 e5             	mov    %rsp,%rbp
+  800696:	53                   	push   %rbx
+  800697:	48 89 fa             	mov    %rdi,%rdx
+  80069a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80069d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006b7:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006bd:	c9                   	leave
+  8006be:	c3                   	ret
+
+00000000008006bf <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006bf:	55                   	push   %rbp
+  8006c0:	48 89 e5             	mov    %rsp,%rbp
+  8006c3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006c4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8006e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006e8:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8006ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006ee:	c9                   	leave
+  8006ef:	c3                   	ret
+
+00000000008006f0 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8006f0:	48 85 ff             	test   %rdi,%rdi
+  8006f3:	0f 84 b6 01 00 00    	je     8008af <malloc+0x1bf>
+malloc(size_t size) {
+  8006f9:	55                   	push   %rbp
+  8006fa:	48 89 e5             	mov    %rsp,%rbp
+  8006fd:	41 56                	push   %r14
+  8006ff:	41 55                	push   %r13
+  800701:	41 54                	push   %r12
+  800703:	53                   	push   %rbx
+  800704:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800707:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80070e:	00 00 00 
+  800711:	4c 8b 20             	mov    (%rax),%r12
+  800714:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80071b:	0f 87 94 01 00 00    	ja     8008b5 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  800721:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800728:	00 00 00 
+  80072b:	48 85 c0             	test   %rax,%rax
+  80072e:	74 6b                	je     80079b <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  800730:	4d 85 e4             	test   %r12,%r12
+  800733:	74 66                	je     80079b <malloc+0xab>
+  800735:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80073c:	00 00 00 
+  80073f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800744:	eb 0d                	jmp    800753 <malloc+0x63>
+  800746:	48 83 c1 01          	add    $0x1,%rcx
+  80074a:	48 83 c2 18          	add    $0x18,%rdx
+  80074e:	49 39 cc             	cmp    %rcx,%r12
+  800751:	74 48                	je     80079b <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  800753:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  800758:	74 ec                	je     800746 <malloc+0x56>
+  80075a:	48 39 1a             	cmp    %rbx,(%rdx)
+  80075d:	72 e7                	jb     800746 <malloc+0x56>
+                real_freep_size--;
+  80075f:	48 83 e8 01          	sub    $0x1,%rax
+  800763:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80076a:	00 00 00 
+                freep[i].is_free = false;
+  80076d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800774:	00 00 00 
+  800777:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80077b:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  80077f:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  800783:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  80078a:	00 
+                freep[i].size = size;
+  80078b:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  80078f:	48 01 c8             	add    %rcx,%rax
+  800792:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800796:	e9 0b 01 00 00       	jmp    8008a6 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  80079b:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8007a2:	00 00 00 
+  8007a5:	48 01 d8             	add    %rbx,%rax
+  8007a8:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007ae:	76 7c                	jbe    80082c <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007b0:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8007b7:	00 00 00 
+  8007ba:	4c 8b 30             	mov    (%rax),%r14
+  8007bd:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8007c4:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8007c7:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8007ce:	00 00 00 
+  8007d1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8007d8:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8007df:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8007e5:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8007e9:	48 b8 bc 01 80 00 00 	movabs $0x8001bc,%rax
+  8007f0:	00 00 00 
+  8007f3:	ff d0                	call   *%rax
+  8007f5:	89 c7                	mov    %eax,%edi
+  8007f7:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8007fe:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  800805:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80080c:	00 00 00 
+  80080f:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  800813:	b9 26 00 00 00       	mov    $0x26,%ecx
+  800818:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  80081f:	00 00 00 
+  800822:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  800824:	85 c0                	test   %eax,%eax
+  800826:	0f 88 90 00 00 00    	js     8008bc <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80082c:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  800833:	00 00 00 
+  800836:	48 8b 31             	mov    (%rcx),%rsi
+  800839:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  800840:	00 00 00 
+  800843:	4c 8b 07             	mov    (%rdi),%r8
+  800846:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80084a:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  800851:	00 00 00 
+  800854:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  800858:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80085c:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800863:	00 00 00 
+  800866:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80086a:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80086d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  800871:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  800878:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  800879:	48 89 d8             	mov    %rbx,%rax
+  80087c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800881:	4c 01 c0             	add    %r8,%rax
+  800884:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  800887:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80088e:	48 01 f3             	add    %rsi,%rbx
+  800891:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  800894:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  800899:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008a0:	00 00 00 
+  8008a3:	48 89 d0             	mov    %rdx,%rax
+}
+  8008a6:	5b                   	pop    %rbx
+  8008a7:	41 5c                	pop    %r12
+  8008a9:	41 5d                	pop    %r13
+  8008ab:	41 5e                	pop    %r14
+  8008ad:	5d                   	pop    %rbp
+  8008ae:	c3                   	ret
+        return NULL;
+  8008af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008b4:	c3                   	ret
+        return NULL;
+  8008b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ba:	eb ea                	jmp    8008a6 <malloc+0x1b6>
+            return NULL;
+  8008bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c1:	eb e3                	jmp    8008a6 <malloc+0x1b6>
+
+00000000008008c3 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8008c3:	55                   	push   %rbp
+  8008c4:	48 89 e5             	mov    %rsp,%rbp
+  8008c7:	53                   	push   %rbx
+  8008c8:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8008cc:	48 89 fb             	mov    %rdi,%rbx
+  8008cf:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8008d3:	48 89 df             	mov    %rbx,%rdi
+  8008d6:	48 b8 f0 06 80 00 00 	movabs $0x8006f0,%rax
+  8008dd:	00 00 00 
+  8008e0:	ff d0                	call   *%rax
+  8008e2:	48 89 c7             	mov    %rax,%rdi
+  8008e5:	48 89 da             	mov    %rbx,%rdx
+  8008e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8008ed:	48 b8 c3 3c 80 00 00 	movabs $0x803cc3,%rax
+  8008f4:	00 00 00 
+  8008f7:	ff d0                	call   *%rax
+}
+  8008f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008fd:	c9                   	leave
+  8008fe:	c3                   	ret
+
+00000000008008ff <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  8008ff:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  800906:	00 00 00 
+  800909:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  800910:	00 00 00 
+  800913:	48 3b 02             	cmp    (%rdx),%rax
+  800916:	74 4d                	je     800965 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  800918:	48 85 c0             	test   %rax,%rax
+  80091b:	74 4d                	je     80096a <get_allocsize+0x6b>
+  80091d:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  800924:	00 00 00 
+  800927:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80092c:	48 3b 39             	cmp    (%rcx),%rdi
+  80092f:	74 13                	je     800944 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  800931:	48 83 c2 01          	add    $0x1,%rdx
+  800935:	48 83 c1 18          	add    $0x18,%rcx
+  800939:	48 39 d0             	cmp    %rdx,%rax
+  80093c:	75 ee                	jne    80092c <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  80093e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800943:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  800944:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094d:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800954:	00 00 00 
+  800957:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80095d:	75 0b                	jne    80096a <get_allocsize+0x6b>
+  80095f:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  800964:	c3                   	ret
+        return 0;
+  800965:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096a:	c3                   	ret
+
+000000000080096b <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80096b:	48 85 ff             	test   %rdi,%rdi
+  80096e:	0f 84 01 01 00 00    	je     800a75 <free+0x10a>
+free(void *ptr) {
+  800974:	55                   	push   %rbp
+  800975:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  800978:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80097f:	00 00 00 
+  800982:	48 8b 30             	mov    (%rax),%rsi
+  800985:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80098c:	00 00 00 
+  80098f:	48 39 c6             	cmp    %rax,%rsi
+  800992:	74 50                	je     8009e4 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  800994:	48 85 f6             	test   %rsi,%rsi
+  800997:	74 21                	je     8009ba <free+0x4f>
+  800999:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009a0:	00 00 00 
+  8009a3:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009a8:	48 3b 39             	cmp    (%rcx),%rdi
+  8009ab:	74 61                	je     800a0e <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009ad:	48 83 c2 01          	add    $0x1,%rdx
+  8009b1:	48 83 c1 18          	add    $0x18,%rcx
+  8009b5:	48 39 d6             	cmp    %rdx,%rsi
+  8009b8:	75 ee                	jne    8009a8 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8009ba:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  8009c1:	00 00 00 
+  8009c4:	be 12 01 00 00       	mov    $0x112,%esi
+  8009c9:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009d0:	00 00 00 
+  8009d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d8:	48 b9 1b 2f 80 00 00 	movabs $0x802f1b,%rcx
+  8009df:	00 00 00 
+  8009e2:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  8009e4:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  8009eb:	00 00 00 
+  8009ee:	be 06 01 00 00       	mov    $0x106,%esi
+  8009f3:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009fa:	00 00 00 
+  8009fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a02:	48 b9 1b 2f 80 00 00 	movabs $0x802f1b,%rcx
+  800a09:	00 00 00 
+  800a0c:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a0e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a12:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a19:	00 00 00 
+  800a1c:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a22:	75 27                	jne    800a4b <free+0xe0>
+            freep[i].is_free = true;
+  800a24:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a28:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a2f:	00 00 00 
+  800a32:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a39:	00 00 
+            real_freep_size++;
+  800a3b:	48 83 c0 01          	add    $0x1,%rax
+  800a3f:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a46:	00 00 00 
+}
+  800a49:	5d                   	pop    %rbp
+  800a4a:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a4b:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a52:	00 00 00 
+  800a55:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800a5a:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a61:	00 00 00 
+  800a64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a69:	48 b9 1b 2f 80 00 00 	movabs $0x802f1b,%rcx
+  800a70:	00 00 00 
+  800a73:	ff d1                	call   *%rcx
+  800a75:	c3                   	ret
+
+0000000000800a76 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800a76:	55                   	push   %rbp
+  800a77:	48 89 e5             	mov    %rsp,%rbp
+  800a7a:	41 55                	push   %r13
+  800a7c:	41 54                	push   %r12
+  800a7e:	53                   	push   %rbx
+  800a7f:	48 83 ec 08          	sub    $0x8,%rsp
+  800a83:	48 89 fb             	mov    %rdi,%rbx
+  800a86:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800a89:	48 b8 ff 08 80 00 00 	movabs $0x8008ff,%rax
+  800a90:	00 00 00 
+  800a93:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800a95:	49 39 c5             	cmp    %rax,%r13
+  800a98:	73 0e                	jae    800aa8 <realloc+0x32>
+}
+  800a9a:	48 89 d8             	mov    %rbx,%rax
+  800a9d:	48 83 c4 08          	add    $0x8,%rsp
+  800aa1:	5b                   	pop    %rbx
+  800aa2:	41 5c                	pop    %r12
+  800aa4:	41 5d                	pop    %r13
+  800aa6:	5d                   	pop    %rbp
+  800aa7:	c3                   	ret
+  800aa8:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800aab:	4c 89 ef             	mov    %r13,%rdi
+  800aae:	48 b8 f0 06 80 00 00 	movabs $0x8006f0,%rax
+  800ab5:	00 00 00 
+  800ab8:	ff d0                	call   *%rax
+  800aba:	48 89 c7             	mov    %rax,%rdi
+  800abd:	4c 89 e2             	mov    %r12,%rdx
+  800ac0:	48 89 de             	mov    %rbx,%rsi
+  800ac3:	48 b8 d8 3d 80 00 00 	movabs $0x803dd8,%rax
+  800aca:	00 00 00 
+  800acd:	ff d0                	call   *%rax
+  800acf:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800ad2:	48 89 df             	mov    %rbx,%rdi
+  800ad5:	48 b8 6b 09 80 00 00 	movabs $0x80096b,%rax
+  800adc:	00 00 00 
+  800adf:	ff d0                	call   *%rax
+    return newptr;
+  800ae1:	4c 89 e3             	mov    %r12,%rbx
+  800ae4:	eb b4                	jmp    800a9a <realloc+0x24>
+
+0000000000800ae6 <strdup>:
+
+char*
+strdup (const char *src) {
+  800ae6:	55                   	push   %rbp
+  800ae7:	48 89 e5             	mov    %rsp,%rbp
+  800aea:	41 54                	push   %r12
+  800aec:	53                   	push   %rbx
+  800aed:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800af0:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  800af7:	00 00 00 
+  800afa:	ff d0                	call   *%rax
+  800afc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b00:	4c 89 e7             	mov    %r12,%rdi
+  800b03:	48 b8 f0 06 80 00 00 	movabs $0x8006f0,%rax
+  800b0a:	00 00 00 
+  800b0d:	ff d0                	call   *%rax
+  800b0f:	48 89 c7             	mov    %rax,%rdi
+  800b12:	4c 89 e2             	mov    %r12,%rdx
+  800b15:	48 89 de             	mov    %rbx,%rsi
+  800b18:	48 b8 d8 3d 80 00 00 	movabs $0x803dd8,%rax
+  800b1f:	00 00 00 
+  800b22:	ff d0                	call   *%rax
+}
+  800b24:	5b                   	pop    %rbx
+  800b25:	41 5c                	pop    %r12
+  800b27:	5d                   	pop    %rbp
+  800b28:	c3                   	ret
+
+0000000000800b29 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b29:	55                   	push   %rbp
+  800b2a:	48 89 e5             	mov    %rsp,%rbp
+  800b2d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b2e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b33:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b38:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b42:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b47:	be 00 00 00 00       	mov    $0x0,%esi
+  800b4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b52:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b58:	c9                   	leave
+  800b59:	c3                   	ret
+
+0000000000800b5a <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800b5a:	55                   	push   %rbp
+  800b5b:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800b5e:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800b65:	00 00 00 
+  800b68:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b6c:	74 26                	je     800b94 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800b6e:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b70:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b74:	89 c0                	mov    %eax,%eax
+  800b76:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800b79:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800b80:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800b87:	00 00 00 
+  800b8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8f:	48 f7 31             	divq   (%rcx)
+}
+  800b92:	5d                   	pop    %rbp
+  800b93:	c3                   	ret
+        freq = get_cpufreq();
+  800b94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b99:	48 ba 29 0b 80 00 00 	movabs $0x800b29,%rdx
+  800ba0:	00 00 00 
+  800ba3:	ff d2                	call   *%rdx
+  800ba5:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bac:	00 00 00 
+  800baf:	eb bd                	jmp    800b6e <get_ticks+0x14>
+
+0000000000800bb1 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bb1:	55                   	push   %rbp
+  800bb2:	48 89 e5             	mov    %rsp,%rbp
+  800bb5:	53                   	push   %rbx
+  800bb6:	48 83 ec 08          	sub    $0x8,%rsp
+  800bba:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800bbd:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bc4:	00 00 00 
+  800bc7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800bcb:	74 50                	je     800c1d <sleep+0x6c>
+    asm volatile("rdtsc"
+  800bcd:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bcf:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bd3:	89 c0                	mov    %eax,%eax
+  800bd5:	48 89 d6             	mov    %rdx,%rsi
+  800bd8:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800bdb:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800be2:	00 00 00 
+  800be5:	48 0f af 18          	imul   (%rax),%rbx
+  800be9:	48 c1 eb 03          	shr    $0x3,%rbx
+  800bed:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800bf4:	9b c4 20 
+  800bf7:	48 89 d8             	mov    %rbx,%rax
+  800bfa:	48 f7 e2             	mul    %rdx
+  800bfd:	48 89 d1             	mov    %rdx,%rcx
+  800c00:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c04:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c06:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c0a:	89 c0                	mov    %eax,%eax
+  800c0c:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c0f:	48 29 f2             	sub    %rsi,%rdx
+  800c12:	48 39 ca             	cmp    %rcx,%rdx
+  800c15:	72 ed                	jb     800c04 <sleep+0x53>
+}
+  800c17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c1b:	c9                   	leave
+  800c1c:	c3                   	ret
+        freq = get_cpufreq();
+  800c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c22:	48 ba 29 0b 80 00 00 	movabs $0x800b29,%rdx
+  800c29:	00 00 00 
+  800c2c:	ff d2                	call   *%rdx
+  800c2e:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c35:	00 00 00 
+  800c38:	eb 93                	jmp    800bcd <sleep+0x1c>
+
+0000000000800c3a <poll_kbd>:
+
+int poll_kbd() {
+  800c3a:	55                   	push   %rbp
+  800c3b:	48 89 e5             	mov    %rsp,%rbp
+  800c3e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c3f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c49:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c53:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c58:	be 00 00 00 00       	mov    $0x0,%esi
+  800c5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c63:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c65:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c69:	c9                   	leave
+  800c6a:	c3                   	ret
+
+0000000000800c6b <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800c6b:	55                   	push   %rbp
+  800c6c:	48 89 e5             	mov    %rsp,%rbp
+  800c6f:	53                   	push   %rbx
+  800c70:	49 89 fa             	mov    %rdi,%r10
+  800c73:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800c75:	44 89 c6             	mov    %r8d,%esi
+  800c78:	89 cf                	mov    %ecx,%edi
+  800c7a:	89 d3                	mov    %edx,%ebx
+  800c7c:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800c7e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c83:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c86:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800c8a:	cd 30                	int    $0x30
+  800c8c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c90:	c9                   	leave
+  800c91:	c3                   	ret
+
+0000000000800c92 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800c92:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800c99:	ff ff ff 
+  800c9c:	48 01 f8             	add    %rdi,%rax
+  800c9f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800ca3:	c3                   	ret
+
+0000000000800ca4 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800ca4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cab:	ff ff ff 
+  800cae:	48 01 f8             	add    %rdi,%rax
+  800cb1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800cb5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800cbb:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800cbf:	c3                   	ret
+
+0000000000800cc0 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800cc0:	55                   	push   %rbp
+  800cc1:	48 89 e5             	mov    %rsp,%rbp
+  800cc4:	41 57                	push   %r15
+  800cc6:	41 56                	push   %r14
+  800cc8:	41 55                	push   %r13
+  800cca:	41 54                	push   %r12
+  800ccc:	53                   	push   %rbx
+  800ccd:	48 83 ec 08          	sub    $0x8,%rsp
+  800cd1:	49 89 ff             	mov    %rdi,%r15
+  800cd4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800cd9:	49 bd 74 2b 80 00 00 	movabs $0x802b74,%r13
+  800ce0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800ce3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800ce9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800cec:	48 89 df             	mov    %rbx,%rdi
+  800cef:	41 ff d5             	call   *%r13
+  800cf2:	83 e0 04             	and    $0x4,%eax
+  800cf5:	74 17                	je     800d0e <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800cf7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800cfe:	4c 39 f3             	cmp    %r14,%rbx
+  800d01:	75 e6                	jne    800ce9 <fd_alloc+0x29>
+  800d03:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d09:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d0e:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d11:	48 83 c4 08          	add    $0x8,%rsp
+  800d15:	5b                   	pop    %rbx
+  800d16:	41 5c                	pop    %r12
+  800d18:	41 5d                	pop    %r13
+  800d1a:	41 5e                	pop    %r14
+  800d1c:	41 5f                	pop    %r15
+  800d1e:	5d                   	pop    %rbp
+  800d1f:	c3                   	ret
+
+0000000000800d20 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d20:	83 ff 1f             	cmp    $0x1f,%edi
+  800d23:	77 39                	ja     800d5e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d25:	55                   	push   %rbp
+  800d26:	48 89 e5             	mov    %rsp,%rbp
+  800d29:	41 54                	push   %r12
+  800d2b:	53                   	push   %rbx
+  800d2c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d2f:	48 63 df             	movslq %edi,%rbx
+  800d32:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d39:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d3d:	48 89 df             	mov    %rbx,%rdi
+  800d40:	48 b8 74 2b 80 00 00 	movabs $0x802b74,%rax
+  800d47:	00 00 00 
+  800d4a:	ff d0                	call   *%rax
+  800d4c:	a8 04                	test   $0x4,%al
+  800d4e:	74 14                	je     800d64 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d50:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d59:	5b                   	pop    %rbx
+  800d5a:	41 5c                	pop    %r12
+  800d5c:	5d                   	pop    %rbp
+  800d5d:	c3                   	ret
+        return -E_INVAL;
+  800d5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d63:	c3                   	ret
+        return -E_INVAL;
+  800d64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d69:	eb ee                	jmp    800d59 <fd_lookup+0x39>
+
+0000000000800d6b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d6b:	55                   	push   %rbp
+  800d6c:	48 89 e5             	mov    %rsp,%rbp
+  800d6f:	41 54                	push   %r12
+  800d71:	53                   	push   %rbx
+  800d72:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800d75:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800d7c:	00 00 00 
+  800d7f:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800d86:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800d89:	39 3b                	cmp    %edi,(%rbx)
+  800d8b:	74 47                	je     800dd4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800d8d:	48 83 c0 08          	add    $0x8,%rax
+  800d91:	48 8b 18             	mov    (%rax),%rbx
+  800d94:	48 85 db             	test   %rbx,%rbx
+  800d97:	75 f0                	jne    800d89 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800d99:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800da0:	00 00 00 
+  800da3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800da9:	89 fa                	mov    %edi,%edx
+  800dab:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  800db2:	00 00 00 
+  800db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dba:	48 b9 6b 30 80 00 00 	movabs $0x80306b,%rcx
+  800dc1:	00 00 00 
+  800dc4:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800dc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800dcb:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800dcf:	5b                   	pop    %rbx
+  800dd0:	41 5c                	pop    %r12
+  800dd2:	5d                   	pop    %rbp
+  800dd3:	c3                   	ret
+            return 0;
+  800dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd9:	eb f0                	jmp    800dcb <dev_lookup+0x60>
+
+0000000000800ddb <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800ddb:	55                   	push   %rbp
+  800ddc:	48 89 e5             	mov    %rsp,%rbp
+  800ddf:	41 55                	push   %r13
+  800de1:	41 54                	push   %r12
+  800de3:	53                   	push   %rbx
+  800de4:	48 83 ec 18          	sub    $0x18,%rsp
+  800de8:	48 89 fb             	mov    %rdi,%rbx
+  800deb:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800dee:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800df5:	ff ff ff 
+  800df8:	48 01 df             	add    %rbx,%rdi
+  800dfb:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800dff:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e03:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  800e0a:	00 00 00 
+  800e0d:	ff d0                	call   *%rax
+  800e0f:	41 89 c5             	mov    %eax,%r13d
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	78 06                	js     800e1c <fd_close+0x41>
+  800e16:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e1a:	74 1a                	je     800e36 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e1c:	45 84 e4             	test   %r12b,%r12b
+  800e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e24:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e28:	44 89 e8             	mov    %r13d,%eax
+  800e2b:	48 83 c4 18          	add    $0x18,%rsp
+  800e2f:	5b                   	pop    %rbx
+  800e30:	41 5c                	pop    %r12
+  800e32:	41 5d                	pop    %r13
+  800e34:	5d                   	pop    %rbp
+  800e35:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e36:	8b 3b                	mov    (%rbx),%edi
+  800e38:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e3c:	48 b8 6b 0d 80 00 00 	movabs $0x800d6b,%rax
+  800e43:	00 00 00 
+  800e46:	ff d0                	call   *%rax
+  800e48:	41 89 c5             	mov    %eax,%r13d
+  800e4b:	85 c0                	test   %eax,%eax
+  800e4d:	78 1b                	js     800e6a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e4f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e53:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800e57:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e5d:	48 85 c0             	test   %rax,%rax
+  800e60:	74 08                	je     800e6a <fd_close+0x8f>
+  800e62:	48 89 df             	mov    %rbx,%rdi
+  800e65:	ff d0                	call   *%rax
+  800e67:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800e6a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e6f:	48 89 de             	mov    %rbx,%rsi
+  800e72:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e77:	48 b8 5b 04 80 00 00 	movabs $0x80045b,%rax
+  800e7e:	00 00 00 
+  800e81:	ff d0                	call   *%rax
+    return res;
+  800e83:	eb a3                	jmp    800e28 <fd_close+0x4d>
+
+0000000000800e85 <close>:
+
+int
+close(int fdnum) {
+  800e85:	55                   	push   %rbp
+  800e86:	48 89 e5             	mov    %rsp,%rbp
+  800e89:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800e8d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e91:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  800e98:	00 00 00 
+  800e9b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800e9d:	85 c0                	test   %eax,%eax
+  800e9f:	78 15                	js     800eb6 <close+0x31>
+
+    return fd_close(fd, 1);
+  800ea1:	be 01 00 00 00       	mov    $0x1,%esi
+  800ea6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800eaa:	48 b8 db 0d 80 00 00 	movabs $0x800ddb,%rax
+  800eb1:	00 00 00 
+  800eb4:	ff d0                	call   *%rax
+}
+  800eb6:	c9                   	leave
+  800eb7:	c3                   	ret
+
+0000000000800eb8 <close_all>:
+
+void
+close_all(void) {
+  800eb8:	55                   	push   %rbp
+  800eb9:	48 89 e5             	mov    %rsp,%rbp
+  800ebc:	41 54                	push   %r12
+  800ebe:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800ebf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec4:	49 bc 85 0e 80 00 00 	movabs $0x800e85,%r12
+  800ecb:	00 00 00 
+  800ece:	89 df                	mov    %ebx,%edi
+  800ed0:	41 ff d4             	call   *%r12
+  800ed3:	83 c3 01             	add    $0x1,%ebx
+  800ed6:	83 fb 20             	cmp    $0x20,%ebx
+  800ed9:	75 f3                	jne    800ece <close_all+0x16>
+}
+  800edb:	5b                   	pop    %rbx
+  800edc:	41 5c                	pop    %r12
+  800ede:	5d                   	pop    %rbp
+  800edf:	c3                   	ret
+
+0000000000800ee0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800ee0:	55                   	push   %rbp
+  800ee1:	48 89 e5             	mov    %rsp,%rbp
+  800ee4:	41 57                	push   %r15
+  800ee6:	41 56                	push   %r14
+  800ee8:	41 55                	push   %r13
+  800eea:	41 54                	push   %r12
+  800eec:	53                   	push   %rbx
+  800eed:	48 83 ec 18          	sub    $0x18,%rsp
+  800ef1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800ef4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800ef8:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  800eff:	00 00 00 
+  800f02:	ff d0                	call   *%rax
+  800f04:	89 c3                	mov    %eax,%ebx
+  800f06:	85 c0                	test   %eax,%eax
+  800f08:	0f 88 b8 00 00 00    	js     800fc6 <dup+0xe6>
+    close(newfdnum);
+  800f0e:	44 89 e7             	mov    %r12d,%edi
+  800f11:	48 b8 85 0e 80 00 00 	movabs $0x800e85,%rax
+  800f18:	00 00 00 
+  800f1b:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f1d:	4d 63 ec             	movslq %r12d,%r13
+  800f20:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f27:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f2b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f2f:	4c 89 ff             	mov    %r15,%rdi
+  800f32:	49 be a4 0c 80 00 00 	movabs $0x800ca4,%r14
+  800f39:	00 00 00 
+  800f3c:	41 ff d6             	call   *%r14
+  800f3f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f42:	4c 89 ef             	mov    %r13,%rdi
+  800f45:	41 ff d6             	call   *%r14
+  800f48:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f4b:	48 89 df             	mov    %rbx,%rdi
+  800f4e:	48 b8 74 2b 80 00 00 	movabs $0x802b74,%rax
+  800f55:	00 00 00 
+  800f58:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800f5a:	a8 04                	test   $0x4,%al
+  800f5c:	74 2b                	je     800f89 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800f5e:	41 89 c1             	mov    %eax,%r9d
+  800f61:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f67:	4c 89 f1             	mov    %r14,%rcx
+  800f6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6f:	48 89 de             	mov    %rbx,%rsi
+  800f72:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f77:	48 b8 e3 02 80 00 00 	movabs $0x8002e3,%rax
+  800f7e:	00 00 00 
+  800f81:	ff d0                	call   *%rax
+  800f83:	89 c3                	mov    %eax,%ebx
+  800f85:	85 c0                	test   %eax,%eax
+  800f87:	78 4e                	js     800fd7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800f89:	4c 89 ff             	mov    %r15,%rdi
+  800f8c:	48 b8 74 2b 80 00 00 	movabs $0x802b74,%rax
+  800f93:	00 00 00 
+  800f96:	ff d0                	call   *%rax
+  800f98:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800f9b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fa1:	4c 89 e9             	mov    %r13,%rcx
+  800fa4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa9:	4c 89 fe             	mov    %r15,%rsi
+  800fac:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fb1:	48 b8 e3 02 80 00 00 	movabs $0x8002e3,%rax
+  800fb8:	00 00 00 
+  800fbb:	ff d0                	call   *%rax
+  800fbd:	89 c3                	mov    %eax,%ebx
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	78 14                	js     800fd7 <dup+0xf7>
+
+    return newfdnum;
+  800fc3:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800fc6:	89 d8                	mov    %ebx,%eax
+  800fc8:	48 83 c4 18          	add    $0x18,%rsp
+  800fcc:	5b                   	pop    %rbx
+  800fcd:	41 5c                	pop    %r12
+  800fcf:	41 5d                	pop    %r13
+  800fd1:	41 5e                	pop    %r14
+  800fd3:	41 5f                	pop    %r15
+  800fd5:	5d                   	pop    %rbp
+  800fd6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800fd7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800fdc:	4c 89 ee             	mov    %r13,%rsi
+  800fdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe4:	49 bc 5b 04 80 00 00 	movabs $0x80045b,%r12
+  800feb:	00 00 00 
+  800fee:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800ff1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ff6:	4c 89 f6             	mov    %r14,%rsi
+  800ff9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ffe:	41 ff d4             	call   *%r12
+    return res;
+  801001:	eb c3                	jmp    800fc6 <dup+0xe6>
+
+0000000000801003 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801003:	55                   	push   %rbp
+  801004:	48 89 e5             	mov    %rsp,%rbp
+  801007:	41 56                	push   %r14
+  801009:	41 55                	push   %r13
+  80100b:	41 54                	push   %r12
+  80100d:	53                   	push   %rbx
+  80100e:	48 83 ec 10          	sub    $0x10,%rsp
+  801012:	89 fb                	mov    %edi,%ebx
+  801014:	49 89 f4             	mov    %rsi,%r12
+  801017:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80101a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80101e:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  801025:	00 00 00 
+  801028:	ff d0                	call   *%rax
+  80102a:	85 c0                	test   %eax,%eax
+  80102c:	78 4c                	js     80107a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80102e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801032:	41 8b 3e             	mov    (%r14),%edi
+  801035:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801039:	48 b8 6b 0d 80 00 00 	movabs $0x800d6b,%rax
+  801040:	00 00 00 
+  801043:	ff d0                	call   *%rax
+  801045:	85 c0                	test   %eax,%eax
+  801047:	78 35                	js     80107e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801049:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80104d:	83 e0 03             	and    $0x3,%eax
+  801050:	83 f8 01             	cmp    $0x1,%eax
+  801053:	74 2d                	je     801082 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801055:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801059:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80105d:	48 85 c0             	test   %rax,%rax
+  801060:	74 56                	je     8010b8 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801062:	4c 89 ea             	mov    %r13,%rdx
+  801065:	4c 89 e6             	mov    %r12,%rsi
+  801068:	4c 89 f7             	mov    %r14,%rdi
+  80106b:	ff d0                	call   *%rax
+}
+  80106d:	48 83 c4 10          	add    $0x10,%rsp
+  801071:	5b                   	pop    %rbx
+  801072:	41 5c                	pop    %r12
+  801074:	41 5d                	pop    %r13
+  801076:	41 5e                	pop    %r14
+  801078:	5d                   	pop    %rbp
+  801079:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80107a:	48 98                	cltq
+  80107c:	eb ef                	jmp    80106d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80107e:	48 98                	cltq
+  801080:	eb eb                	jmp    80106d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801082:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801089:	00 00 00 
+  80108c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801092:	89 da                	mov    %ebx,%edx
+  801094:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  80109b:	00 00 00 
+  80109e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a3:	48 b9 6b 30 80 00 00 	movabs $0x80306b,%rcx
+  8010aa:	00 00 00 
+  8010ad:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010af:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8010b6:	eb b5                	jmp    80106d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010b8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8010bf:	eb ac                	jmp    80106d <read+0x6a>
+
+00000000008010c1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8010c1:	55                   	push   %rbp
+  8010c2:	48 89 e5             	mov    %rsp,%rbp
+  8010c5:	41 57                	push   %r15
+  8010c7:	41 56                	push   %r14
+  8010c9:	41 55                	push   %r13
+  8010cb:	41 54                	push   %r12
+  8010cd:	53                   	push   %rbx
+  8010ce:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8010d2:	48 85 d2             	test   %rdx,%rdx
+  8010d5:	74 54                	je     80112b <readn+0x6a>
+  8010d7:	41 89 fd             	mov    %edi,%r13d
+  8010da:	49 89 f6             	mov    %rsi,%r14
+  8010dd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8010e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8010e5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8010ea:	49 bf 03 10 80 00 00 	movabs $0x801003,%r15
+  8010f1:	00 00 00 
+  8010f4:	4c 89 e2             	mov    %r12,%rdx
+  8010f7:	48 29 f2             	sub    %rsi,%rdx
+  8010fa:	4c 01 f6             	add    %r14,%rsi
+  8010fd:	44 89 ef             	mov    %r13d,%edi
+  801100:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801103:	85 c0                	test   %eax,%eax
+  801105:	78 20                	js     801127 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801107:	01 c3                	add    %eax,%ebx
+  801109:	85 c0                	test   %eax,%eax
+  80110b:	74 08                	je     801115 <readn+0x54>
+  80110d:	48 63 f3             	movslq %ebx,%rsi
+  801110:	4c 39 e6             	cmp    %r12,%rsi
+  801113:	72 df                	jb     8010f4 <readn+0x33>
+    }
+    return res;
+  801115:	48 63 c3             	movslq %ebx,%rax
+}
+  801118:	48 83 c4 08          	add    $0x8,%rsp
+  80111c:	5b                   	pop    %rbx
+  80111d:	41 5c                	pop    %r12
+  80111f:	41 5d                	pop    %r13
+  801121:	41 5e                	pop    %r14
+  801123:	41 5f                	pop    %r15
+  801125:	5d                   	pop    %rbp
+  801126:	c3                   	ret
+        if (inc < 0) return inc;
+  801127:	48 98                	cltq
+  801129:	eb ed                	jmp    801118 <readn+0x57>
+    int inc = 1, res = 0;
+  80112b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801130:	eb e3                	jmp    801115 <readn+0x54>
+
+0000000000801132 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801132:	55                   	push   %rbp
+  801133:	48 89 e5             	mov    %rsp,%rbp
+  801136:	41 56                	push   %r14
+  801138:	41 55                	push   %r13
+  80113a:	41 54                	push   %r12
+  80113c:	53                   	push   %rbx
+  80113d:	48 83 ec 10          	sub    $0x10,%rsp
+  801141:	89 fb                	mov    %edi,%ebx
+  801143:	49 89 f4             	mov    %rsi,%r12
+  801146:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801149:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80114d:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  801154:	00 00 00 
+  801157:	ff d0                	call   *%rax
+  801159:	85 c0                	test   %eax,%eax
+  80115b:	78 47                	js     8011a4 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80115d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801161:	41 8b 3e             	mov    (%r14),%edi
+  801164:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801168:	48 b8 6b 0d 80 00 00 	movabs $0x800d6b,%rax
+  80116f:	00 00 00 
+  801172:	ff d0                	call   *%rax
+  801174:	85 c0                	test   %eax,%eax
+  801176:	78 30                	js     8011a8 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801178:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80117d:	74 2d                	je     8011ac <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80117f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801183:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801187:	48 85 c0             	test   %rax,%rax
+  80118a:	74 56                	je     8011e2 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80118c:	4c 89 ea             	mov    %r13,%rdx
+  80118f:	4c 89 e6             	mov    %r12,%rsi
+  801192:	4c 89 f7             	mov    %r14,%rdi
+  801195:	ff d0                	call   *%rax
+}
+  801197:	48 83 c4 10          	add    $0x10,%rsp
+  80119b:	5b                   	pop    %rbx
+  80119c:	41 5c                	pop    %r12
+  80119e:	41 5d                	pop    %r13
+  8011a0:	41 5e                	pop    %r14
+  8011a2:	5d                   	pop    %rbp
+  8011a3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011a4:	48 98                	cltq
+  8011a6:	eb ef                	jmp    801197 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011a8:	48 98                	cltq
+  8011aa:	eb eb                	jmp    801197 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011ac:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8011b3:	00 00 00 
+  8011b6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8011bc:	89 da                	mov    %ebx,%edx
+  8011be:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  8011c5:	00 00 00 
+  8011c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cd:	48 b9 6b 30 80 00 00 	movabs $0x80306b,%rcx
+  8011d4:	00 00 00 
+  8011d7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8011d9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011e0:	eb b5                	jmp    801197 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8011e2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8011e9:	eb ac                	jmp    801197 <write+0x65>
+
+00000000008011eb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8011eb:	55                   	push   %rbp
+  8011ec:	48 89 e5             	mov    %rsp,%rbp
+  8011ef:	53                   	push   %rbx
+  8011f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8011f4:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011f6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8011fa:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  801201:	00 00 00 
+  801204:	ff d0                	call   *%rax
+  801206:	85 c0                	test   %eax,%eax
+  801208:	78 0c                	js     801216 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80120a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80120e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801211:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801216:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121a:	c9                   	leave
+  80121b:	c3                   	ret
+
+000000000080121c <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80121c:	55                   	push   %rbp
+  80121d:	48 89 e5             	mov    %rsp,%rbp
+  801220:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801224:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801228:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  80122f:	00 00 00 
+  801232:	ff d0                	call   *%rax
+  801234:	85 c0                	test   %eax,%eax
+  801236:	78 07                	js     80123f <tell+0x23>
+    return fdes->fd_offset;
+  801238:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80123c:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80123f:	c9                   	leave
+  801240:	c3                   	ret
+
+0000000000801241 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801241:	55                   	push   %rbp
+  801242:	48 89 e5             	mov    %rsp,%rbp
+  801245:	41 55                	push   %r13
+  801247:	41 54                	push   %r12
+  801249:	53                   	push   %rbx
+  80124a:	48 83 ec 18          	sub    $0x18,%rsp
+  80124e:	89 fb                	mov    %edi,%ebx
+  801250:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801253:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801257:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  80125e:	00 00 00 
+  801261:	ff d0                	call   *%rax
+  801263:	85 c0                	test   %eax,%eax
+  801265:	78 38                	js     80129f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801267:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80126b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80126f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801273:	48 b8 6b 0d 80 00 00 	movabs $0x800d6b,%rax
+  80127a:	00 00 00 
+  80127d:	ff d0                	call   *%rax
+  80127f:	85 c0                	test   %eax,%eax
+  801281:	78 1c                	js     80129f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801283:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801288:	74 20                	je     8012aa <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80128a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80128e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801292:	48 85 c0             	test   %rax,%rax
+  801295:	74 47                	je     8012de <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801297:	44 89 e6             	mov    %r12d,%esi
+  80129a:	4c 89 ef             	mov    %r13,%rdi
+  80129d:	ff d0                	call   *%rax
+}
+  80129f:	48 83 c4 18          	add    $0x18,%rsp
+  8012a3:	5b                   	pop    %rbx
+  8012a4:	41 5c                	pop    %r12
+  8012a6:	41 5d                	pop    %r13
+  8012a8:	5d                   	pop    %rbp
+  8012a9:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8012aa:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8012b1:	00 00 00 
+  8012b4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012ba:	89 da                	mov    %ebx,%edx
+  8012bc:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  8012c3:	00 00 00 
+  8012c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012cb:	48 b9 6b 30 80 00 00 	movabs $0x80306b,%rcx
+  8012d2:	00 00 00 
+  8012d5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8012d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012dc:	eb c1                	jmp    80129f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012de:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8012e3:	eb ba                	jmp    80129f <ftruncate+0x5e>
+
+00000000008012e5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8012e5:	55                   	push   %rbp
+  8012e6:	48 89 e5             	mov    %rsp,%rbp
+  8012e9:	41 54                	push   %r12
+  8012eb:	53                   	push   %rbx
+  8012ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8012f0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8012f3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8012f7:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  8012fe:	00 00 00 
+  801301:	ff d0                	call   *%rax
+  801303:	85 c0                	test   %eax,%eax
+  801305:	78 4e                	js     801355 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801307:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80130b:	41 8b 3c 24          	mov    (%r12),%edi
+  80130f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801313:	48 b8 6b 0d 80 00 00 	movabs $0x800d6b,%rax
+  80131a:	00 00 00 
+  80131d:	ff d0                	call   *%rax
+  80131f:	85 c0                	test   %eax,%eax
+  801321:	78 32                	js     801355 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801323:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801327:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80132c:	74 30                	je     80135e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80132e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801331:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801338:	00 00 00 
+    stat->st_isdir = 0;
+  80133b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801342:	00 00 00 
+    stat->st_dev = dev;
+  801345:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80134c:	48 89 de             	mov    %rbx,%rsi
+  80134f:	4c 89 e7             	mov    %r12,%rdi
+  801352:	ff 50 28             	call   *0x28(%rax)
+}
+  801355:	48 83 c4 10          	add    $0x10,%rsp
+  801359:	5b                   	pop    %rbx
+  80135a:	41 5c                	pop    %r12
+  80135c:	5d                   	pop    %rbp
+  80135d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80135e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801363:	eb f0                	jmp    801355 <fstat+0x70>
+
+0000000000801365 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  801365:	55                   	push   %rbp
+  801366:	48 89 e5             	mov    %rsp,%rbp
+  801369:	41 54                	push   %r12
+  80136b:	53                   	push   %rbx
+  80136c:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  801373:	41 89 fc             	mov    %edi,%r12d
+  801376:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801378:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80137c:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  801383:	00 00 00 
+  801386:	ff d0                	call   *%rax
+  801388:	85 c0                	test   %eax,%eax
+  80138a:	78 31                	js     8013bd <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  80138c:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801393:	44 89 e7             	mov    %r12d,%edi
+  801396:	48 b8 e5 12 80 00 00 	movabs $0x8012e5,%rax
+  80139d:	00 00 00 
+  8013a0:	ff d0                	call   *%rax
+  8013a2:	85 c0                	test   %eax,%eax
+  8013a4:	78 17                	js     8013bd <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8013a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013aa:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8013ad:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8013b0:	39 d3                	cmp    %edx,%ebx
+  8013b2:	0f 4f da             	cmovg  %edx,%ebx
+  8013b5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8013b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013bd:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8013c4:	5b                   	pop    %rbx
+  8013c5:	41 5c                	pop    %r12
+  8013c7:	5d                   	pop    %rbp
+  8013c8:	c3                   	ret
+
+00000000008013c9 <seektoend>:
+{
+  8013c9:	55                   	push   %rbp
+  8013ca:	48 89 e5             	mov    %rsp,%rbp
+  8013cd:	53                   	push   %rbx
+  8013ce:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8013d5:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8013d7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013db:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  8013e2:	00 00 00 
+  8013e5:	ff d0                	call   *%rax
+  8013e7:	85 c0                	test   %eax,%eax
+  8013e9:	78 28                	js     801413 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8013eb:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8013f2:	89 df                	mov    %ebx,%edi
+  8013f4:	48 b8 e5 12 80 00 00 	movabs $0x8012e5,%rax
+  8013fb:	00 00 00 
+  8013fe:	ff d0                	call   *%rax
+  801400:	85 c0                	test   %eax,%eax
+  801402:	78 0f                	js     801413 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  801404:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801407:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80140b:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80140e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801413:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801417:	c9                   	leave
+  801418:	c3                   	ret
+
+0000000000801419 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801419:	55                   	push   %rbp
+  80141a:	48 89 e5             	mov    %rsp,%rbp
+  80141d:	41 54                	push   %r12
+  80141f:	53                   	push   %rbx
+  801420:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801423:	be 00 00 00 00       	mov    $0x0,%esi
+  801428:	48 b8 0c 20 80 00 00 	movabs $0x80200c,%rax
+  80142f:	00 00 00 
+  801432:	ff d0                	call   *%rax
+  801434:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801436:	85 c0                	test   %eax,%eax
+  801438:	78 25                	js     80145f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80143a:	4c 89 e6             	mov    %r12,%rsi
+  80143d:	89 c7                	mov    %eax,%edi
+  80143f:	48 b8 e5 12 80 00 00 	movabs $0x8012e5,%rax
+  801446:	00 00 00 
+  801449:	ff d0                	call   *%rax
+  80144b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80144e:	89 df                	mov    %ebx,%edi
+  801450:	48 b8 85 0e 80 00 00 	movabs $0x800e85,%rax
+  801457:	00 00 00 
+  80145a:	ff d0                	call   *%rax
+
+    return res;
+  80145c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80145f:	89 d8                	mov    %ebx,%eax
+  801461:	5b                   	pop    %rbx
+  801462:	41 5c                	pop    %r12
+  801464:	5d                   	pop    %rbp
+  801465:	c3                   	ret
+
+0000000000801466 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  801466:	55                   	push   %rbp
+  801467:	48 89 e5             	mov    %rsp,%rbp
+  80146a:	53                   	push   %rbx
+  80146b:	48 83 ec 08          	sub    $0x8,%rsp
+  80146f:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801472:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  801479:	00 00 00 
+  80147c:	ff d0                	call   *%rax
+  80147e:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801482:	0f 87 ea 00 00 00    	ja     801572 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  801488:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80148f:	00 00 00 
+  801492:	80 38 00             	cmpb   $0x0,(%rax)
+  801495:	75 35                	jne    8014cc <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  801497:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80149c:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8014a1:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8014a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ab:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  8014b2:	00 00 00 
+  8014b5:	ff d0                	call   *%rax
+  8014b7:	85 c0                	test   %eax,%eax
+  8014b9:	0f 88 ba 00 00 00    	js     801579 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8014bf:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014c6:	00 00 00 
+  8014c9:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8014cc:	48 89 df             	mov    %rbx,%rdi
+  8014cf:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  8014d6:	00 00 00 
+  8014d9:	ff d0                	call   *%rax
+  8014db:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8014df:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8014e6:	00 00 00 
+  8014e9:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8014ed:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8014f0:	39 39                	cmp    %edi,(%rcx)
+  8014f2:	74 46                	je     80153a <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8014f4:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8014f8:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8014ff:	00 
+  801500:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  801507:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  80150e:	00 
+  80150f:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  801516:	00 
+  801517:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  80151e:	00 
+  80151f:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  801526:	00 
+  801527:	89 39                	mov    %edi,(%rcx)
+  801529:	48 01 c6             	add    %rax,%rsi
+  80152c:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  801531:	48 89 c8             	mov    %rcx,%rax
+  801534:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801538:	c9                   	leave
+  801539:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80153a:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80153e:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  801545:	00 00 00 
+  801548:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80154b:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80154f:	74 e0                	je     801531 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  801551:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  801558:	00 
+  801559:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80155d:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  801564:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  801566:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801569:	48 01 c2             	add    %rax,%rdx
+  80156c:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  801570:	eb bf                	jmp    801531 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801572:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801577:	eb b8                	jmp    801531 <fbuf_get+0xcb>
+            return NULL;
+  801579:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157e:	eb b1                	jmp    801531 <fbuf_get+0xcb>
+
+0000000000801580 <fsipc_bulk>:
+fsipc_bulk(void) {
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+  801584:	53                   	push   %rbx
+  801585:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  801589:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  801590:	00 00 00 
+  801593:	48 8b 18             	mov    (%rax),%rbx
+  801596:	48 85 db             	test   %rbx,%rbx
+  801599:	74 16                	je     8015b1 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  80159b:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015a2:	00 00 00 
+  8015a5:	48 8b 18             	mov    (%rax),%rbx
+}
+  8015a8:	48 89 d8             	mov    %rbx,%rax
+  8015ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8015b1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015b6:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8015bb:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8015c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c5:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  8015cc:	00 00 00 
+  8015cf:	ff d0                	call   *%rax
+  8015d1:	85 c0                	test   %eax,%eax
+  8015d3:	78 d3                	js     8015a8 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8015d5:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8015da:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8015e1:	00 00 00 
+  8015e4:	eb b5                	jmp    80159b <fsipc_bulk+0x1b>
+
+00000000008015e6 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8015e6:	55                   	push   %rbp
+  8015e7:	48 89 e5             	mov    %rsp,%rbp
+  8015ea:	41 57                	push   %r15
+  8015ec:	41 56                	push   %r14
+  8015ee:	41 55                	push   %r13
+  8015f0:	41 54                	push   %r12
+  8015f2:	53                   	push   %rbx
+  8015f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f7:	41 89 fd             	mov    %edi,%r13d
+  8015fa:	49 89 f6             	mov    %rsi,%r14
+  8015fd:	49 89 d7             	mov    %rdx,%r15
+  801600:	48 89 cb             	mov    %rcx,%rbx
+  801603:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801606:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80160d:	00 00 00 
+  801610:	83 38 00             	cmpl   $0x0,(%rax)
+  801613:	74 52                	je     801667 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  801615:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80161b:	4c 89 f9             	mov    %r15,%rcx
+  80161e:	4c 89 f2             	mov    %r14,%rdx
+  801621:	44 89 ee             	mov    %r13d,%esi
+  801624:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80162b:	00 00 00 
+  80162e:	8b 38                	mov    (%rax),%edi
+  801630:	48 b8 6a 41 80 00 00 	movabs $0x80416a,%rax
+  801637:	00 00 00 
+  80163a:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80163c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801641:	4c 89 e2             	mov    %r12,%rdx
+  801644:	48 89 de             	mov    %rbx,%rsi
+  801647:	bf 00 00 00 00       	mov    $0x0,%edi
+  80164c:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  801653:	00 00 00 
+  801656:	ff d0                	call   *%rax
+}
+  801658:	48 83 c4 08          	add    $0x8,%rsp
+  80165c:	5b                   	pop    %rbx
+  80165d:	41 5c                	pop    %r12
+  80165f:	41 5d                	pop    %r13
+  801661:	41 5e                	pop    %r14
+  801663:	41 5f                	pop    %r15
+  801665:	5d                   	pop    %rbp
+  801666:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801667:	bf 03 00 00 00       	mov    $0x3,%edi
+  80166c:	48 b8 0d 42 80 00 00 	movabs $0x80420d,%rax
+  801673:	00 00 00 
+  801676:	ff d0                	call   *%rax
+  801678:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80167f:	00 00 
+  801681:	eb 92                	jmp    801615 <fsipc_region+0x2f>
+
+0000000000801683 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  801683:	55                   	push   %rbp
+  801684:	48 89 e5             	mov    %rsp,%rbp
+  801687:	41 57                	push   %r15
+  801689:	41 56                	push   %r14
+  80168b:	41 55                	push   %r13
+  80168d:	41 54                	push   %r12
+  80168f:	53                   	push   %rbx
+  801690:	48 83 ec 28          	sub    $0x28,%rsp
+  801694:	49 89 ff             	mov    %rdi,%r15
+  801697:	49 89 f6             	mov    %rsi,%r14
+  80169a:	48 89 d3             	mov    %rdx,%rbx
+  80169d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016a1:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8016a4:	48 b8 80 15 80 00 00 	movabs $0x801580,%rax
+  8016ab:	00 00 00 
+  8016ae:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8016b0:	48 85 c0             	test   %rax,%rax
+  8016b3:	0f 84 cc 00 00 00    	je     801785 <devfile_write_direct+0x102>
+  8016b9:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8016bc:	48 85 db             	test   %rbx,%rbx
+  8016bf:	0f 84 ba 00 00 00    	je     80177f <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8016c5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016cb:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8016d2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8016d6:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8016da:	4c 29 e3             	sub    %r12,%rbx
+  8016dd:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8016e2:	48 39 c3             	cmp    %rax,%rbx
+  8016e5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016e9:	48 89 da             	mov    %rbx,%rdx
+  8016ec:	4c 89 f6             	mov    %r14,%rsi
+  8016ef:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8016f3:	48 b8 d8 3d 80 00 00 	movabs $0x803dd8,%rax
+  8016fa:	00 00 00 
+  8016fd:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8016ff:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801703:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  801707:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80170a:	44 01 e0             	add    %r12d,%eax
+  80170d:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  801711:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  801715:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80171c:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801723:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80172a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801730:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801735:	4c 89 ee             	mov    %r13,%rsi
+  801738:	bf 04 00 00 00       	mov    $0x4,%edi
+  80173d:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  801744:	00 00 00 
+  801747:	ff d0                	call   *%rax
+        if (res < 0)
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	78 29                	js     801776 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80174d:	74 2b                	je     80177a <devfile_write_direct+0xf7>
+        i += res;
+  80174f:	48 98                	cltq
+  801751:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  801754:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  801757:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80175b:	49 39 c4             	cmp    %rax,%r12
+  80175e:	0f 82 72 ff ff ff    	jb     8016d6 <devfile_write_direct+0x53>
+    return i;
+  801764:	4c 89 e0             	mov    %r12,%rax
+}
+  801767:	48 83 c4 28          	add    $0x28,%rsp
+  80176b:	5b                   	pop    %rbx
+  80176c:	41 5c                	pop    %r12
+  80176e:	41 5d                	pop    %r13
+  801770:	41 5e                	pop    %r14
+  801772:	41 5f                	pop    %r15
+  801774:	5d                   	pop    %rbp
+  801775:	c3                   	ret
+            return res;
+  801776:	48 98                	cltq
+  801778:	eb ed                	jmp    801767 <devfile_write_direct+0xe4>
+            return i;
+  80177a:	4c 89 e0             	mov    %r12,%rax
+  80177d:	eb e8                	jmp    801767 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80177f:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  801783:	eb df                	jmp    801764 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  801785:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  80178c:	eb d9                	jmp    801767 <devfile_write_direct+0xe4>
+
+000000000080178e <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  80178e:	55                   	push   %rbp
+  80178f:	48 89 e5             	mov    %rsp,%rbp
+  801792:	41 56                	push   %r14
+  801794:	41 55                	push   %r13
+  801796:	41 54                	push   %r12
+  801798:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  801799:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  80179d:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8017a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a6:	4d 39 ee             	cmp    %r13,%r14
+  8017a9:	0f 84 99 00 00 00    	je     801848 <fbuf_flush+0xba>
+  8017af:	49 89 fc             	mov    %rdi,%r12
+  8017b2:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8017b5:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017b8:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8017bc:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  8017c3:	00 00 00 
+  8017c6:	ff d0                	call   *%rax
+  8017c8:	48 89 c2             	mov    %rax,%rdx
+  8017cb:	48 c1 e2 04          	shl    $0x4,%rdx
+  8017cf:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8017d3:	48 c1 e0 0c          	shl    $0xc,%rax
+  8017d7:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8017dc:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017df:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8017e3:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8017ea:	00 
+  8017eb:	44 89 f1             	mov    %r14d,%ecx
+  8017ee:	4c 89 ea             	mov    %r13,%rdx
+  8017f1:	4c 89 e7             	mov    %r12,%rdi
+  8017f4:	48 b8 83 16 80 00 00 	movabs $0x801683,%rax
+  8017fb:	00 00 00 
+  8017fe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801800:	48 85 c0             	test   %rax,%rax
+  801803:	78 43                	js     801848 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  801805:	4c 39 e8             	cmp    %r13,%rax
+  801808:	72 47                	jb     801851 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80180a:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80180f:	83 c0 01             	add    $0x1,%eax
+  801812:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801817:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80181a:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80181e:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  801822:	72 0f                	jb     801833 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  801824:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  801828:	48 39 c2             	cmp    %rax,%rdx
+  80182b:	48 0f 42 d0          	cmovb  %rax,%rdx
+  80182f:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  801833:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80183a:	00 
+  80183b:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  801842:	00 
+    return 0;
+  801843:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801848:	5b                   	pop    %rbx
+  801849:	41 5c                	pop    %r12
+  80184b:	41 5d                	pop    %r13
+  80184d:	41 5e                	pop    %r14
+  80184f:	5d                   	pop    %rbp
+  801850:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  801851:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801856:	eb f0                	jmp    801848 <fbuf_flush+0xba>
+
+0000000000801858 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  801858:	55                   	push   %rbp
+  801859:	48 89 e5             	mov    %rsp,%rbp
+  80185c:	53                   	push   %rbx
+  80185d:	48 83 ec 08          	sub    $0x8,%rsp
+  801861:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  801864:	48 b8 66 14 80 00 00 	movabs $0x801466,%rax
+  80186b:	00 00 00 
+  80186e:	ff d0                	call   *%rax
+  801870:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  801873:	b8 00 00 00 00       	mov    $0x0,%eax
+  801878:	48 85 f6             	test   %rsi,%rsi
+  80187b:	74 0f                	je     80188c <devfile_sync+0x34>
+  80187d:	48 89 df             	mov    %rbx,%rdi
+  801880:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801887:	00 00 00 
+  80188a:	ff d0                	call   *%rax
+}
+  80188c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801890:	c9                   	leave
+  801891:	c3                   	ret
+
+0000000000801892 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  801892:	55                   	push   %rbp
+  801893:	48 89 e5             	mov    %rsp,%rbp
+  801896:	48 83 ec 10          	sub    $0x10,%rsp
+  80189a:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  80189d:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8018a4:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8018a5:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8018a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018ae:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8018b5:	00 00 00 
+  8018b8:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  8018bf:	00 00 00 
+  8018c2:	ff d0                	call   *%rax
+}
+  8018c4:	c9                   	leave
+  8018c5:	c3                   	ret
+
+00000000008018c6 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018c6:	55                   	push   %rbp
+  8018c7:	48 89 e5             	mov    %rsp,%rbp
+  8018ca:	41 54                	push   %r12
+  8018cc:	53                   	push   %rbx
+  8018cd:	48 89 fb             	mov    %rdi,%rbx
+  8018d0:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8018d3:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  8018da:	00 00 00 
+  8018dd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018df:	85 c0                	test   %eax,%eax
+  8018e1:	78 63                	js     801946 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018e3:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8018e6:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8018ed:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  8018ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f4:	bf 05 00 00 00       	mov    $0x5,%edi
+  8018f9:	48 b8 92 18 80 00 00 	movabs $0x801892,%rax
+  801900:	00 00 00 
+  801903:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801905:	85 c0                	test   %eax,%eax
+  801907:	78 3d                	js     801946 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801909:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  801910:	00 00 00 
+  801913:	48 89 de             	mov    %rbx,%rsi
+  801916:	4c 89 e7             	mov    %r12,%rdi
+  801919:	48 b8 e3 39 80 00 00 	movabs $0x8039e3,%rax
+  801920:	00 00 00 
+  801923:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801925:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80192b:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  801932:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801933:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  801939:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  801940:	00 
+
+    return 0;
+  801941:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801946:	5b                   	pop    %rbx
+  801947:	41 5c                	pop    %r12
+  801949:	5d                   	pop    %rbp
+  80194a:	c3                   	ret
+
+000000000080194b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80194b:	55                   	push   %rbp
+  80194c:	48 89 e5             	mov    %rsp,%rbp
+  80194f:	41 54                	push   %r12
+  801951:	53                   	push   %rbx
+  801952:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  801955:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  80195c:	00 00 00 
+  80195f:	ff d0                	call   *%rax
+  801961:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  801964:	48 89 df             	mov    %rbx,%rdi
+  801967:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  80196e:	00 00 00 
+  801971:	ff d0                	call   *%rax
+  801973:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801977:	76 2e                	jbe    8019a7 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  801979:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80197c:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  801983:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  801985:	be 00 00 00 00       	mov    $0x0,%esi
+  80198a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80198f:	48 b8 92 18 80 00 00 	movabs $0x801892,%rax
+  801996:	00 00 00 
+  801999:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  80199b:	45 85 e4             	test   %r12d,%r12d
+  80199e:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019a2:	5b                   	pop    %rbx
+  8019a3:	41 5c                	pop    %r12
+  8019a5:	5d                   	pop    %rbp
+  8019a6:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8019a7:	48 89 df             	mov    %rbx,%rdi
+  8019aa:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  8019b1:	00 00 00 
+  8019b4:	ff d0                	call   *%rax
+  8019b6:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8019ba:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8019c1:	00 00 00 
+  8019c4:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8019cb:	48 89 df             	mov    %rbx,%rdi
+  8019ce:	48 b8 a4 0c 80 00 00 	movabs $0x800ca4,%rax
+  8019d5:	00 00 00 
+  8019d8:	ff d0                	call   *%rax
+  8019da:	48 89 c6             	mov    %rax,%rsi
+  8019dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019e7:	48 b8 5b 04 80 00 00 	movabs $0x80045b,%rax
+  8019ee:	00 00 00 
+  8019f1:	ff d0                	call   *%rax
+  8019f3:	eb 84                	jmp    801979 <devfile_flush+0x2e>
+
+00000000008019f5 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8019f5:	55                   	push   %rbp
+  8019f6:	48 89 e5             	mov    %rsp,%rbp
+  8019f9:	41 55                	push   %r13
+  8019fb:	41 54                	push   %r12
+  8019fd:	53                   	push   %rbx
+  8019fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801a02:	48 89 fb             	mov    %rdi,%rbx
+  801a05:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a08:	48 b8 66 14 80 00 00 	movabs $0x801466,%rax
+  801a0f:	00 00 00 
+  801a12:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a14:	48 85 c0             	test   %rax,%rax
+  801a17:	74 51                	je     801a6a <devfile_trunc+0x75>
+  801a19:	49 89 c4             	mov    %rax,%r12
+  801a1c:	48 89 c6             	mov    %rax,%rsi
+  801a1f:	48 89 df             	mov    %rbx,%rdi
+  801a22:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801a29:	00 00 00 
+  801a2c:	ff d0                	call   *%rax
+  801a2e:	85 c0                	test   %eax,%eax
+  801a30:	78 2d                	js     801a5f <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a32:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a39:	00 00 00 
+  801a3c:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a3f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a41:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a45:	be 00 00 00 00       	mov    $0x0,%esi
+  801a4a:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a4f:	48 b8 92 18 80 00 00 	movabs $0x801892,%rax
+  801a56:	00 00 00 
+  801a59:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a5b:	85 c0                	test   %eax,%eax
+  801a5d:	79 3e                	jns    801a9d <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801a5f:	48 83 c4 08          	add    $0x8,%rsp
+  801a63:	5b                   	pop    %rbx
+  801a64:	41 5c                	pop    %r12
+  801a66:	41 5d                	pop    %r13
+  801a68:	5d                   	pop    %rbp
+  801a69:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a6a:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a71:	00 00 00 
+  801a74:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a77:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a79:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a82:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a87:	48 b8 92 18 80 00 00 	movabs $0x801892,%rax
+  801a8e:	00 00 00 
+  801a91:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a93:	85 c0                	test   %eax,%eax
+  801a95:	78 c8                	js     801a5f <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801a97:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801a9b:	eb c2                	jmp    801a5f <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801a9d:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801aa0:	8d 51 01             	lea    0x1(%rcx),%edx
+  801aa3:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801aa6:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801aab:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801ab2:	00 00 
+  801ab4:	eb a9                	jmp    801a5f <devfile_trunc+0x6a>
+
+0000000000801ab6 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801ab6:	55                   	push   %rbp
+  801ab7:	48 89 e5             	mov    %rsp,%rbp
+  801aba:	41 57                	push   %r15
+  801abc:	41 56                	push   %r14
+  801abe:	41 55                	push   %r13
+  801ac0:	41 54                	push   %r12
+  801ac2:	53                   	push   %rbx
+  801ac3:	48 83 ec 28          	sub    $0x28,%rsp
+  801ac7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801acb:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801acf:	49 89 d7             	mov    %rdx,%r15
+  801ad2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801ad6:	48 b8 66 14 80 00 00 	movabs $0x801466,%rax
+  801add:	00 00 00 
+  801ae0:	ff d0                	call   *%rax
+  801ae2:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801ae5:	48 85 c0             	test   %rax,%rax
+  801ae8:	74 31                	je     801b1b <devfile_write+0x65>
+  801aea:	4c 89 f8             	mov    %r15,%rax
+  801aed:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801af4:	77 25                	ja     801b1b <devfile_write+0x65>
+    size_t i = 0;
+  801af6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801afc:	48 85 c0             	test   %rax,%rax
+  801aff:	0f 85 64 01 00 00    	jne    801c69 <devfile_write+0x1b3>
+    size_t i = 0;
+  801b05:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b09:	4c 89 f8             	mov    %r15,%rax
+}
+  801b0c:	48 83 c4 28          	add    $0x28,%rsp
+  801b10:	5b                   	pop    %rbx
+  801b11:	41 5c                	pop    %r12
+  801b13:	41 5d                	pop    %r13
+  801b15:	41 5e                	pop    %r14
+  801b17:	41 5f                	pop    %r15
+  801b19:	5d                   	pop    %rbp
+  801b1a:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b1b:	48 85 db             	test   %rbx,%rbx
+  801b1e:	74 5b                	je     801b7b <devfile_write+0xc5>
+  801b20:	48 89 de             	mov    %rbx,%rsi
+  801b23:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b27:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801b2e:	00 00 00 
+  801b31:	ff d0                	call   *%rax
+  801b33:	85 c0                	test   %eax,%eax
+  801b35:	78 40                	js     801b77 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b37:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b3b:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801b3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b42:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b46:	48 b8 83 16 80 00 00 	movabs $0x801683,%rax
+  801b4d:	00 00 00 
+  801b50:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b52:	48 85 c0             	test   %rax,%rax
+  801b55:	7e b5                	jle    801b0c <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801b57:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801b5b:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801b5e:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801b61:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801b64:	8d 51 01             	lea    0x1(%rcx),%edx
+  801b67:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b6a:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801b6d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801b74:	00 
+  801b75:	eb 95                	jmp    801b0c <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b77:	48 98                	cltq
+  801b79:	eb 91                	jmp    801b0c <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b7b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801b7f:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801b82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b86:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b8a:	48 89 df             	mov    %rbx,%rdi
+  801b8d:	48 b8 83 16 80 00 00 	movabs $0x801683,%rax
+  801b94:	00 00 00 
+  801b97:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b99:	48 85 c0             	test   %rax,%rax
+  801b9c:	0f 8e 6a ff ff ff    	jle    801b0c <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801ba2:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801ba5:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801ba9:	e9 5e ff ff ff       	jmp    801b0c <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bae:	48 98                	cltq
+  801bb0:	4d 85 ff             	test   %r15,%r15
+  801bb3:	49 0f 45 c7          	cmovne %r15,%rax
+  801bb7:	e9 50 ff ff ff       	jmp    801b0c <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bbc:	48 89 de             	mov    %rbx,%rsi
+  801bbf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801bc3:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801bca:	00 00 00 
+  801bcd:	ff d0                	call   *%rax
+  801bcf:	85 c0                	test   %eax,%eax
+  801bd1:	0f 88 2b 01 00 00    	js     801d02 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801bd7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801bdb:	4c 01 f8             	add    %r15,%rax
+  801bde:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801be2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801be6:	48 b9 92 0c 80 00 00 	movabs $0x800c92,%rcx
+  801bed:	00 00 00 
+  801bf0:	ff d1                	call   *%rcx
+  801bf2:	48 89 c2             	mov    %rax,%rdx
+  801bf5:	48 c1 e2 04          	shl    $0x4,%rdx
+  801bf9:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801bfd:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c01:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c06:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c09:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c10:	00 
+  801c11:	4c 89 ea             	mov    %r13,%rdx
+  801c14:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c18:	48 b8 d8 3d 80 00 00 	movabs $0x803dd8,%rax
+  801c1f:	00 00 00 
+  801c22:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c24:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c28:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801c2c:	48 39 c2             	cmp    %rax,%rdx
+  801c2f:	0f 84 db 00 00 00    	je     801d10 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801c35:	4c 39 e2             	cmp    %r12,%rdx
+  801c38:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801c3c:	4d 01 ec             	add    %r13,%r12
+  801c3f:	49 39 c4             	cmp    %rax,%r12
+  801c42:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801c46:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801c4a:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801c4e:	45 01 ee             	add    %r13d,%r14d
+  801c51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c55:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801c59:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801c5c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c60:	49 39 c7             	cmp    %rax,%r15
+  801c63:	0f 83 a0 fe ff ff    	jae    801b09 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801c69:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c6d:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801c71:	8b 43 08             	mov    0x8(%rbx),%eax
+  801c74:	44 39 f0             	cmp    %r14d,%eax
+  801c77:	7f 10                	jg     801c89 <devfile_write+0x1d3>
+  801c79:	48 98                	cltq
+  801c7b:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801c81:	49 63 d6             	movslq %r14d,%rdx
+  801c84:	48 39 d0             	cmp    %rdx,%rax
+  801c87:	7d 2d                	jge    801cb6 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801c89:	48 89 de             	mov    %rbx,%rsi
+  801c8c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c90:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801c97:	00 00 00 
+  801c9a:	ff d0                	call   *%rax
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	0f 88 0a ff ff ff    	js     801bae <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801ca4:	44 89 f0             	mov    %r14d,%eax
+  801ca7:	66 b8 00 00          	mov    $0x0,%ax
+  801cab:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801cae:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801cb5:	00 
+        size_t off = pos - fb->fb_base;
+  801cb6:	45 89 f4             	mov    %r14d,%r12d
+  801cb9:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801cbd:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801cc0:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801cc4:	4d 29 fd             	sub    %r15,%r13
+  801cc7:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801ccc:	4c 29 e0             	sub    %r12,%rax
+  801ccf:	49 39 c5             	cmp    %rax,%r13
+  801cd2:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801cd6:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801cda:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801cde:	48 39 c2             	cmp    %rax,%rdx
+  801ce1:	0f 84 f0 fe ff ff    	je     801bd7 <devfile_write+0x121>
+  801ce7:	4c 39 e0             	cmp    %r12,%rax
+  801cea:	0f 82 cc fe ff ff    	jb     801bbc <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801cf0:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801cf4:	48 39 d0             	cmp    %rdx,%rax
+  801cf7:	0f 83 da fe ff ff    	jae    801bd7 <devfile_write+0x121>
+  801cfd:	e9 ba fe ff ff       	jmp    801bbc <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d02:	48 98                	cltq
+  801d04:	4d 85 ff             	test   %r15,%r15
+  801d07:	49 0f 45 c7          	cmovne %r15,%rax
+  801d0b:	e9 fc fd ff ff       	jmp    801b0c <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d10:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d14:	4c 89 e2             	mov    %r12,%rdx
+  801d17:	e9 2a ff ff ff       	jmp    801c46 <devfile_write+0x190>
+
+0000000000801d1c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d1c:	55                   	push   %rbp
+  801d1d:	48 89 e5             	mov    %rsp,%rbp
+  801d20:	41 57                	push   %r15
+  801d22:	41 56                	push   %r14
+  801d24:	41 55                	push   %r13
+  801d26:	41 54                	push   %r12
+  801d28:	53                   	push   %rbx
+  801d29:	48 83 ec 28          	sub    $0x28,%rsp
+  801d2d:	49 89 ff             	mov    %rdi,%r15
+  801d30:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801d34:	48 89 d3             	mov    %rdx,%rbx
+  801d37:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801d3b:	48 b8 66 14 80 00 00 	movabs $0x801466,%rax
+  801d42:	00 00 00 
+  801d45:	ff d0                	call   *%rax
+  801d47:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801d4a:	48 85 c0             	test   %rax,%rax
+  801d4d:	74 0d                	je     801d5c <devfile_read+0x40>
+  801d4f:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801d56:	0f 86 1a 01 00 00    	jbe    801e76 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801d5c:	4d 85 e4             	test   %r12,%r12
+  801d5f:	74 1a                	je     801d7b <devfile_read+0x5f>
+  801d61:	4c 89 e6             	mov    %r12,%rsi
+  801d64:	4c 89 ff             	mov    %r15,%rdi
+  801d67:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801d6e:	00 00 00 
+  801d71:	ff d0                	call   *%rax
+  801d73:	85 c0                	test   %eax,%eax
+  801d75:	0f 88 e8 00 00 00    	js     801e63 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801d7b:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801d7f:	48 b8 80 15 80 00 00 	movabs $0x801580,%rax
+  801d86:	00 00 00 
+  801d89:	ff d0                	call   *%rax
+  801d8b:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801d8e:	48 85 c0             	test   %rax,%rax
+  801d91:	0f 84 69 02 00 00    	je     802000 <devfile_read+0x2e4>
+    while (i < n) {
+  801d97:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801d9c:	0f 84 ce 00 00 00    	je     801e70 <devfile_read+0x154>
+    size_t i = 0;
+  801da2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801da7:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801dae:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801db2:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801db6:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801dba:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801dbe:	48 29 da             	sub    %rbx,%rdx
+  801dc1:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801dc6:	48 39 c2             	cmp    %rax,%rdx
+  801dc9:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801dcd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801dd1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801dd5:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801dd8:	01 d8                	add    %ebx,%eax
+  801dda:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801dde:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801de2:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801de9:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801df0:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801df7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dfd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e02:	4c 89 ee             	mov    %r13,%rsi
+  801e05:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e0a:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  801e11:	00 00 00 
+  801e14:	ff d0                	call   *%rax
+        if (res < 0)
+  801e16:	85 c0                	test   %eax,%eax
+  801e18:	78 4d                	js     801e67 <devfile_read+0x14b>
+        if (res == 0)
+  801e1a:	74 4f                	je     801e6b <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e1c:	4c 63 e0             	movslq %eax,%r12
+  801e1f:	4c 89 e2             	mov    %r12,%rdx
+  801e22:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e26:	4c 89 f7             	mov    %r14,%rdi
+  801e29:	48 b8 d8 3d 80 00 00 	movabs $0x803dd8,%rax
+  801e30:	00 00 00 
+  801e33:	ff d0                	call   *%rax
+        i += res;
+  801e35:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801e38:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801e3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e3f:	48 39 c3             	cmp    %rax,%rbx
+  801e42:	0f 82 72 ff ff ff    	jb     801dba <devfile_read+0x9e>
+    return i;
+  801e48:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801e4b:	48 85 c0             	test   %rax,%rax
+  801e4e:	7e 04                	jle    801e54 <devfile_read+0x138>
+  801e50:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801e54:	48 83 c4 28          	add    $0x28,%rsp
+  801e58:	5b                   	pop    %rbx
+  801e59:	41 5c                	pop    %r12
+  801e5b:	41 5d                	pop    %r13
+  801e5d:	41 5e                	pop    %r14
+  801e5f:	41 5f                	pop    %r15
+  801e61:	5d                   	pop    %rbp
+  801e62:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801e63:	48 98                	cltq
+  801e65:	eb ed                	jmp    801e54 <devfile_read+0x138>
+            return res;
+  801e67:	48 98                	cltq
+  801e69:	eb e9                	jmp    801e54 <devfile_read+0x138>
+            return i;
+  801e6b:	48 89 d8             	mov    %rbx,%rax
+  801e6e:	eb db                	jmp    801e4b <devfile_read+0x12f>
+    size_t i = 0;
+  801e70:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801e74:	eb d2                	jmp    801e48 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801e76:	48 89 c6             	mov    %rax,%rsi
+  801e79:	4c 89 ff             	mov    %r15,%rdi
+  801e7c:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801e83:	00 00 00 
+  801e86:	ff d0                	call   *%rax
+  801e88:	85 c0                	test   %eax,%eax
+  801e8a:	78 40                	js     801ecc <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801e8c:	4c 89 ff             	mov    %r15,%rdi
+  801e8f:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  801e96:	00 00 00 
+  801e99:	ff d0                	call   *%rax
+  801e9b:	48 89 c2             	mov    %rax,%rdx
+  801e9e:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ea2:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801ea6:	48 c1 e0 0c          	shl    $0xc,%rax
+  801eaa:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801eaf:	48 01 d0             	add    %rdx,%rax
+  801eb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801eb6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ebb:	0f 84 33 01 00 00    	je     801ff4 <devfile_read+0x2d8>
+    size_t i = 0;
+  801ec1:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801ec7:	e9 f5 00 00 00       	jmp    801fc1 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801ecc:	48 98                	cltq
+  801ece:	eb 84                	jmp    801e54 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801ed0:	44 89 e8             	mov    %r13d,%eax
+  801ed3:	66 b8 00 00          	mov    $0x0,%ax
+  801ed7:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801edc:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801ee3:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801ee5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801ee9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801eed:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801eef:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801ef4:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801ef7:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801efe:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801eff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f0a:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f0f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f14:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  801f1b:	00 00 00 
+  801f1e:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f20:	85 c0                	test   %eax,%eax
+  801f22:	0f 88 be 00 00 00    	js     801fe6 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f28:	48 63 d0             	movslq %eax,%rdx
+  801f2b:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801f30:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801f35:	44 39 e8             	cmp    %r13d,%eax
+  801f38:	0f 8e ba 00 00 00    	jle    801ff8 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801f3e:	49 63 c5             	movslq %r13d,%rax
+  801f41:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801f46:	48 29 c3             	sub    %rax,%rbx
+  801f49:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801f4e:	48 01 c3             	add    %rax,%rbx
+  801f51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f55:	4c 29 f0             	sub    %r14,%rax
+  801f58:	48 39 c3             	cmp    %rax,%rbx
+  801f5b:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801f5f:	4c 89 ff             	mov    %r15,%rdi
+  801f62:	48 b9 92 0c 80 00 00 	movabs $0x800c92,%rcx
+  801f69:	00 00 00 
+  801f6c:	ff d1                	call   *%rcx
+  801f6e:	48 89 c2             	mov    %rax,%rdx
+  801f71:	48 c1 e2 04          	shl    $0x4,%rdx
+  801f75:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801f79:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f7d:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801f82:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801f85:	44 89 ea             	mov    %r13d,%edx
+  801f88:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  801f8d:	48 63 d2             	movslq %edx,%rdx
+  801f90:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801f97:	00 
+  801f98:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801f9c:	4c 01 f7             	add    %r14,%rdi
+  801f9f:	48 89 da             	mov    %rbx,%rdx
+  801fa2:	48 b9 d8 3d 80 00 00 	movabs $0x803dd8,%rcx
+  801fa9:	00 00 00 
+  801fac:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  801fae:	41 01 dd             	add    %ebx,%r13d
+  801fb1:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  801fb5:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  801fb8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fbc:	49 39 c6             	cmp    %rax,%r14
+  801fbf:	73 37                	jae    801ff8 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  801fc1:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  801fc5:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801fca:	44 39 e8             	cmp    %r13d,%eax
+  801fcd:	0f 8f fd fe ff ff    	jg     801ed0 <devfile_read+0x1b4>
+  801fd3:	41 03 44 24 10       	add    0x10(%r12),%eax
+  801fd8:	44 39 e8             	cmp    %r13d,%eax
+  801fdb:	0f 8f 5d ff ff ff    	jg     801f3e <devfile_read+0x222>
+  801fe1:	e9 ea fe ff ff       	jmp    801ed0 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  801fe6:	48 98                	cltq
+  801fe8:	4d 85 f6             	test   %r14,%r14
+  801feb:	49 0f 45 c6          	cmovne %r14,%rax
+  801fef:	e9 60 fe ff ff       	jmp    801e54 <devfile_read+0x138>
+    size_t i = 0;
+  801ff4:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  801ff8:	4c 89 f0             	mov    %r14,%rax
+  801ffb:	e9 54 fe ff ff       	jmp    801e54 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  802000:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802007:	e9 48 fe ff ff       	jmp    801e54 <devfile_read+0x138>
+
+000000000080200c <open>:
+open(const char *path, int mode) {
+  80200c:	55                   	push   %rbp
+  80200d:	48 89 e5             	mov    %rsp,%rbp
+  802010:	41 55                	push   %r13
+  802012:	41 54                	push   %r12
+  802014:	53                   	push   %rbx
+  802015:	48 83 ec 18          	sub    $0x18,%rsp
+  802019:	49 89 fc             	mov    %rdi,%r12
+  80201c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80201f:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  802026:	00 00 00 
+  802029:	ff d0                	call   *%rax
+  80202b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802031:	0f 87 8a 00 00 00    	ja     8020c1 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802037:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80203b:	48 b8 c0 0c 80 00 00 	movabs $0x800cc0,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+  802047:	89 c3                	mov    %eax,%ebx
+  802049:	85 c0                	test   %eax,%eax
+  80204b:	78 50                	js     80209d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80204d:	4c 89 e6             	mov    %r12,%rsi
+  802050:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802057:	00 00 00 
+  80205a:	48 89 df             	mov    %rbx,%rdi
+  80205d:	48 b8 e3 39 80 00 00 	movabs $0x8039e3,%rax
+  802064:	00 00 00 
+  802067:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802069:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802070:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802074:	bf 01 00 00 00       	mov    $0x1,%edi
+  802079:	48 b8 92 18 80 00 00 	movabs $0x801892,%rax
+  802080:	00 00 00 
+  802083:	ff d0                	call   *%rax
+  802085:	89 c3                	mov    %eax,%ebx
+  802087:	85 c0                	test   %eax,%eax
+  802089:	78 1f                	js     8020aa <open+0x9e>
+    return fd2num(fd);
+  80208b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80208f:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  802096:	00 00 00 
+  802099:	ff d0                	call   *%rax
+  80209b:	89 c3                	mov    %eax,%ebx
+}
+  80209d:	89 d8                	mov    %ebx,%eax
+  80209f:	48 83 c4 18          	add    $0x18,%rsp
+  8020a3:	5b                   	pop    %rbx
+  8020a4:	41 5c                	pop    %r12
+  8020a6:	41 5d                	pop    %r13
+  8020a8:	5d                   	pop    %rbp
+  8020a9:	c3                   	ret
+        fd_close(fd, 0);
+  8020aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8020af:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020b3:	48 b8 db 0d 80 00 00 	movabs $0x800ddb,%rax
+  8020ba:	00 00 00 
+  8020bd:	ff d0                	call   *%rax
+        return res;
+  8020bf:	eb dc                	jmp    80209d <open+0x91>
+        return -E_BAD_PATH;
+  8020c1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020c6:	eb d5                	jmp    80209d <open+0x91>
+
+00000000008020c8 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8020c8:	55                   	push   %rbp
+  8020c9:	48 89 e5             	mov    %rsp,%rbp
+  8020cc:	41 57                	push   %r15
+  8020ce:	41 56                	push   %r14
+  8020d0:	41 55                	push   %r13
+  8020d2:	41 54                	push   %r12
+  8020d4:	53                   	push   %rbx
+  8020d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8020d9:	41 89 f6             	mov    %esi,%r14d
+  8020dc:	49 89 d7             	mov    %rdx,%r15
+  8020df:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020e2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8020e6:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  8020ed:	00 00 00 
+  8020f0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020f2:	85 c0                	test   %eax,%eax
+  8020f4:	0f 88 db 00 00 00    	js     8021d5 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8020fa:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8020fe:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802105:	00 00 00 
+  802108:	8b 00                	mov    (%rax),%eax
+  80210a:	39 07                	cmp    %eax,(%rdi)
+  80210c:	0f 85 db 00 00 00    	jne    8021ed <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802112:	45 85 f6             	test   %r14d,%r14d
+  802115:	0f 88 db 00 00 00    	js     8021f6 <fmap+0x12e>
+  80211b:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802122:	0f 85 d7 00 00 00    	jne    8021ff <fmap+0x137>
+  802128:	4c 89 fb             	mov    %r15,%rbx
+  80212b:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802131:	0f 85 d1 00 00 00    	jne    802208 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802137:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  80213e:	00 00 00 
+  802141:	ff d0                	call   *%rax
+  802143:	85 c0                	test   %eax,%eax
+  802145:	0f 88 8e 00 00 00    	js     8021d9 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80214b:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  802152:	00 00 00 
+    while (i < n) {
+  802155:	4d 85 ed             	test   %r13,%r13
+  802158:	0f 84 8a 00 00 00    	je     8021e8 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80215e:	4c 89 ea             	mov    %r13,%rdx
+  802161:	48 29 da             	sub    %rbx,%rdx
+  802164:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80216b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802171:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802175:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802179:	8b 40 0c             	mov    0xc(%rax),%eax
+  80217c:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  802180:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  802184:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  802189:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80218e:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  802192:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  802196:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80219b:	4c 89 e6             	mov    %r12,%rsi
+  80219e:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021a3:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  8021aa:	00 00 00 
+  8021ad:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021af:	85 c0                	test   %eax,%eax
+  8021b1:	78 2a                	js     8021dd <fmap+0x115>
+        i += res;
+  8021b3:	48 98                	cltq
+  8021b5:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8021b8:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8021bc:	72 05                	jb     8021c3 <fmap+0xfb>
+    while (i < n) {
+  8021be:	4c 39 eb             	cmp    %r13,%rbx
+  8021c1:	72 9b                	jb     80215e <fmap+0x96>
+    }
+    return i;
+  8021c3:	48 89 d8             	mov    %rbx,%rax
+}
+  8021c6:	48 83 c4 18          	add    $0x18,%rsp
+  8021ca:	5b                   	pop    %rbx
+  8021cb:	41 5c                	pop    %r12
+  8021cd:	41 5d                	pop    %r13
+  8021cf:	41 5e                	pop    %r14
+  8021d1:	41 5f                	pop    %r15
+  8021d3:	5d                   	pop    %rbp
+  8021d4:	c3                   	ret
+    if (res < 0) return res;
+  8021d5:	48 98                	cltq
+  8021d7:	eb ed                	jmp    8021c6 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8021d9:	48 98                	cltq
+  8021db:	eb e9                	jmp    8021c6 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021dd:	48 98                	cltq
+  8021df:	48 85 db             	test   %rbx,%rbx
+  8021e2:	48 0f 45 c3          	cmovne %rbx,%rax
+  8021e6:	eb de                	jmp    8021c6 <fmap+0xfe>
+    size_t i = 0;
+  8021e8:	4c 89 eb             	mov    %r13,%rbx
+  8021eb:	eb d6                	jmp    8021c3 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8021ed:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8021f4:	eb d0                	jmp    8021c6 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8021f6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8021fd:	eb c7                	jmp    8021c6 <fmap+0xfe>
+  8021ff:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802206:	eb be                	jmp    8021c6 <fmap+0xfe>
+  802208:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80220f:	eb b5                	jmp    8021c6 <fmap+0xfe>
+
+0000000000802211 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  802211:	55                   	push   %rbp
+  802212:	48 89 e5             	mov    %rsp,%rbp
+  802215:	41 56                	push   %r14
+  802217:	41 55                	push   %r13
+  802219:	41 54                	push   %r12
+  80221b:	53                   	push   %rbx
+  80221c:	48 83 ec 10          	sub    $0x10,%rsp
+  802220:	89 fb                	mov    %edi,%ebx
+  802222:	41 89 f4             	mov    %esi,%r12d
+  802225:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802228:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80222c:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  802233:	00 00 00 
+  802236:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802238:	85 c0                	test   %eax,%eax
+  80223a:	78 63                	js     80229f <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80223c:	45 85 e4             	test   %r12d,%r12d
+  80223f:	0f 88 80 00 00 00    	js     8022c5 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  802245:	45 89 e6             	mov    %r12d,%r14d
+  802248:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80224f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802253:	48 b8 a4 0c 80 00 00 	movabs $0x800ca4,%rax
+  80225a:	00 00 00 
+  80225d:	ff d0                	call   *%rax
+  80225f:	48 89 c2             	mov    %rax,%rdx
+  802262:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802267:	44 89 f6             	mov    %r14d,%esi
+  80226a:	89 df                	mov    %ebx,%edi
+  80226c:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802273:	00 00 00 
+  802276:	ff d0                	call   *%rax
+  802278:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80227b:	45 29 f4             	sub    %r14d,%r12d
+  80227e:	4d 63 f4             	movslq %r12d,%r14
+  802281:	49 39 c6             	cmp    %rax,%r14
+  802284:	7c 1d                	jl     8022a3 <read_map+0x92>
+  802286:	48 85 c0             	test   %rax,%rax
+  802289:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228e:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  802292:	48 83 c4 10          	add    $0x10,%rsp
+  802296:	5b                   	pop    %rbx
+  802297:	41 5c                	pop    %r12
+  802299:	41 5d                	pop    %r13
+  80229b:	41 5e                	pop    %r14
+  80229d:	5d                   	pop    %rbp
+  80229e:	c3                   	ret
+    if (res < 0) return res;
+  80229f:	48 98                	cltq
+  8022a1:	eb ef                	jmp    802292 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8022a3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022a7:	48 b8 a4 0c 80 00 00 	movabs $0x800ca4,%rax
+  8022ae:	00 00 00 
+  8022b1:	ff d0                	call   *%rax
+  8022b3:	4d 63 e4             	movslq %r12d,%r12
+  8022b6:	4c 01 e0             	add    %r12,%rax
+  8022b9:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8022bd:	48 89 d8             	mov    %rbx,%rax
+  8022c0:	4c 29 f0             	sub    %r14,%rax
+  8022c3:	eb cd                	jmp    802292 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8022c5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022cc:	eb c4                	jmp    802292 <read_map+0x81>
+
+00000000008022ce <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8022ce:	55                   	push   %rbp
+  8022cf:	48 89 e5             	mov    %rsp,%rbp
+  8022d2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022d6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022da:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  8022e1:	00 00 00 
+  8022e4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022e6:	85 c0                	test   %eax,%eax
+  8022e8:	78 4a                	js     802334 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8022ea:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8022ee:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8022f5:	00 00 00 
+  8022f8:	8b 00                	mov    (%rax),%eax
+  8022fa:	39 07                	cmp    %eax,(%rdi)
+  8022fc:	75 38                	jne    802336 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8022fe:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  802305:	00 00 00 
+  802308:	ff d0                	call   *%rax
+  80230a:	85 c0                	test   %eax,%eax
+  80230c:	78 26                	js     802334 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80230e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802312:	8b 40 0c             	mov    0xc(%rax),%eax
+  802315:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80231c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80231e:	be 00 00 00 00       	mov    $0x0,%esi
+  802323:	bf 06 00 00 00       	mov    $0x6,%edi
+  802328:	48 b8 92 18 80 00 00 	movabs $0x801892,%rax
+  80232f:	00 00 00 
+  802332:	ff d0                	call   *%rax
+}
+  802334:	c9                   	leave
+  802335:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802336:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80233b:	eb f7                	jmp    802334 <fsync+0x66>
+
+000000000080233d <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80233d:	55                   	push   %rbp
+  80233e:	48 89 e5             	mov    %rsp,%rbp
+  802341:	41 57                	push   %r15
+  802343:	41 56                	push   %r14
+  802345:	41 55                	push   %r13
+  802347:	41 54                	push   %r12
+  802349:	53                   	push   %rbx
+  80234a:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80234e:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  802355:	00 00 00 
+  802358:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80235d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802363:	49 bd 20 0d 80 00 00 	movabs $0x800d20,%r13
+  80236a:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80236d:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  802374:	00 00 00 
+  802377:	eb 0c                	jmp    802385 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  802379:	83 c3 01             	add    $0x1,%ebx
+  80237c:	49 83 c4 28          	add    $0x28,%r12
+  802380:	83 fb 20             	cmp    $0x20,%ebx
+  802383:	74 33                	je     8023b8 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802385:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80238a:	74 ed                	je     802379 <flushall+0x3c>
+  80238c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802390:	89 df                	mov    %ebx,%edi
+  802392:	41 ff d5             	call   *%r13
+  802395:	85 c0                	test   %eax,%eax
+  802397:	78 e0                	js     802379 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  802399:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80239d:	41 8b 06             	mov    (%r14),%eax
+  8023a0:	39 07                	cmp    %eax,(%rdi)
+  8023a2:	75 d5                	jne    802379 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8023a4:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  8023ab:	00 00 00 
+  8023ae:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8023b0:	85 c0                	test   %eax,%eax
+  8023b2:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8023b6:	eb c1                	jmp    802379 <flushall+0x3c>
+    }
+    return res;
+}
+  8023b8:	44 89 f8             	mov    %r15d,%eax
+  8023bb:	48 83 c4 18          	add    $0x18,%rsp
+  8023bf:	5b                   	pop    %rbx
+  8023c0:	41 5c                	pop    %r12
+  8023c2:	41 5d                	pop    %r13
+  8023c4:	41 5e                	pop    %r14
+  8023c6:	41 5f                	pop    %r15
+  8023c8:	5d                   	pop    %rbp
+  8023c9:	c3                   	ret
+
+00000000008023ca <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8023ca:	55                   	push   %rbp
+  8023cb:	48 89 e5             	mov    %rsp,%rbp
+  8023ce:	53                   	push   %rbx
+  8023cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d3:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8023d6:	40 0f b6 c6          	movzbl %sil,%eax
+  8023da:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8023e1:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8023e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8023ed:	48 b8 92 18 80 00 00 	movabs $0x801892,%rax
+  8023f4:	00 00 00 
+  8023f7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023f9:	85 c0                	test   %eax,%eax
+  8023fb:	78 23                	js     802420 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8023fd:	ba 58 06 00 00       	mov    $0x658,%edx
+  802402:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802409:	00 00 00 
+  80240c:	48 89 df             	mov    %rbx,%rdi
+  80240f:	48 b8 d8 3d 80 00 00 	movabs $0x803dd8,%rax
+  802416:	00 00 00 
+  802419:	ff d0                	call   *%rax
+    return 0;
+  80241b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802420:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802424:	c9                   	leave
+  802425:	c3                   	ret
+
+0000000000802426 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  802426:	55                   	push   %rbp
+  802427:	48 89 e5             	mov    %rsp,%rbp
+  80242a:	53                   	push   %rbx
+  80242b:	48 83 ec 08          	sub    $0x8,%rsp
+  80242f:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  802432:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  802439:	00 00 00 
+  80243c:	ff d0                	call   *%rax
+  80243e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802444:	77 35                	ja     80247b <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  802446:	48 89 de             	mov    %rbx,%rsi
+  802449:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  802450:	00 00 00 
+  802453:	48 b8 e3 39 80 00 00 	movabs $0x8039e3,%rax
+  80245a:	00 00 00 
+  80245d:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80245f:	be 00 00 00 00       	mov    $0x0,%esi
+  802464:	bf 07 00 00 00       	mov    $0x7,%edi
+  802469:	48 b8 92 18 80 00 00 	movabs $0x801892,%rax
+  802470:	00 00 00 
+  802473:	ff d0                	call   *%rax
+}
+  802475:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802479:	c9                   	leave
+  80247a:	c3                   	ret
+        return -E_BAD_PATH;
+  80247b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802480:	eb f3                	jmp    802475 <remove+0x4f>
+
+0000000000802482 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802482:	55                   	push   %rbp
+  802483:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  802486:	48 b8 3d 23 80 00 00 	movabs $0x80233d,%rax
+  80248d:	00 00 00 
+  802490:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802492:	be 00 00 00 00       	mov    $0x0,%esi
+  802497:	bf 08 00 00 00       	mov    $0x8,%edi
+  80249c:	48 b8 92 18 80 00 00 	movabs $0x801892,%rax
+  8024a3:	00 00 00 
+  8024a6:	ff d0                	call   *%rax
+}
+  8024a8:	5d                   	pop    %rbp
+  8024a9:	c3                   	ret
+
+00000000008024aa <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024aa:	55                   	push   %rbp
+  8024ab:	48 89 e5             	mov    %rsp,%rbp
+  8024ae:	41 54                	push   %r12
+  8024b0:	53                   	push   %rbx
+  8024b1:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024b4:	48 b8 a4 0c 80 00 00 	movabs $0x800ca4,%rax
+  8024bb:	00 00 00 
+  8024be:	ff d0                	call   *%rax
+  8024c0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024c3:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  8024ca:	00 00 00 
+  8024cd:	48 89 df             	mov    %rbx,%rdi
+  8024d0:	48 b8 e3 39 80 00 00 	movabs $0x8039e3,%rax
+  8024d7:	00 00 00 
+  8024da:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024dc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024e1:	41 2b 04 24          	sub    (%r12),%eax
+  8024e5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024eb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024f2:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024f5:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8024fc:	00 00 00 
+  8024ff:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250b:	5b                   	pop    %rbx
+  80250c:	41 5c                	pop    %r12
+  80250e:	5d                   	pop    %rbp
+  80250f:	c3                   	ret
+
+0000000000802510 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802510:	55                   	push   %rbp
+  802511:	48 89 e5             	mov    %rsp,%rbp
+  802514:	41 54                	push   %r12
+  802516:	53                   	push   %rbx
+  802517:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80251a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80251f:	48 89 fe             	mov    %rdi,%rsi
+  802522:	bf 00 00 00 00       	mov    $0x0,%edi
+  802527:	49 bc 5b 04 80 00 00 	movabs $0x80045b,%r12
+  80252e:	00 00 00 
+  802531:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802534:	48 89 df             	mov    %rbx,%rdi
+  802537:	48 b8 a4 0c 80 00 00 	movabs $0x800ca4,%rax
+  80253e:	00 00 00 
+  802541:	ff d0                	call   *%rax
+  802543:	48 89 c6             	mov    %rax,%rsi
+  802546:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80254b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802550:	41 ff d4             	call   *%r12
+}
+  802553:	5b                   	pop    %rbx
+  802554:	41 5c                	pop    %r12
+  802556:	5d                   	pop    %rbp
+  802557:	c3                   	ret
+
+0000000000802558 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802558:	55                   	push   %rbp
+  802559:	48 89 e5             	mov    %rsp,%rbp
+  80255c:	41 57                	push   %r15
+  80255e:	41 56                	push   %r14
+  802560:	41 55                	push   %r13
+  802562:	41 54                	push   %r12
+  802564:	53                   	push   %rbx
+  802565:	48 83 ec 18          	sub    $0x18,%rsp
+  802569:	49 89 fc             	mov    %rdi,%r12
+  80256c:	49 89 f5             	mov    %rsi,%r13
+  80256f:	49 89 d7             	mov    %rdx,%r15
+  802572:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802576:	48 b8 a4 0c 80 00 00 	movabs $0x800ca4,%rax
+  80257d:	00 00 00 
+  802580:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802582:	4d 85 ff             	test   %r15,%r15
+  802585:	0f 84 af 00 00 00    	je     80263a <devpipe_write+0xe2>
+  80258b:	48 89 c3             	mov    %rax,%rbx
+  80258e:	4c 89 f8             	mov    %r15,%rax
+  802591:	4d 89 ef             	mov    %r13,%r15
+  802594:	4c 01 e8             	add    %r13,%rax
+  802597:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80259b:	49 bd 50 02 80 00 00 	movabs $0x800250,%r13
+  8025a2:	00 00 00 
+            sys_yield();
+  8025a5:	49 be ed 01 80 00 00 	movabs $0x8001ed,%r14
+  8025ac:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025af:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025b2:	48 63 ce             	movslq %esi,%rcx
+  8025b5:	48 63 03             	movslq (%rbx),%rax
+  8025b8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025be:	48 39 c1             	cmp    %rax,%rcx
+  8025c1:	72 2e                	jb     8025f1 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025c3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025c8:	48 89 da             	mov    %rbx,%rdx
+  8025cb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025d0:	4c 89 e7             	mov    %r12,%rdi
+  8025d3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025d6:	85 c0                	test   %eax,%eax
+  8025d8:	74 66                	je     802640 <devpipe_write+0xe8>
+            sys_yield();
+  8025da:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025dd:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025e0:	48 63 ce             	movslq %esi,%rcx
+  8025e3:	48 63 03             	movslq (%rbx),%rax
+  8025e6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025ec:	48 39 c1             	cmp    %rax,%rcx
+  8025ef:	73 d2                	jae    8025c3 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025f1:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025f5:	48 89 ca             	mov    %rcx,%rdx
+  8025f8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025fc:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802603:	08 10 20 
+  802606:	48 f7 e2             	mul    %rdx
+  802609:	48 c1 ea 06          	shr    $0x6,%rdx
+  80260d:	48 89 d0             	mov    %rdx,%rax
+  802610:	48 c1 e0 09          	shl    $0x9,%rax
+  802614:	48 29 d0             	sub    %rdx,%rax
+  802617:	48 c1 e0 03          	shl    $0x3,%rax
+  80261b:	48 29 c1             	sub    %rax,%rcx
+  80261e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802623:	83 c6 01             	add    $0x1,%esi
+  802626:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802629:	49 83 c7 01          	add    $0x1,%r15
+  80262d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802631:	49 39 c7             	cmp    %rax,%r15
+  802634:	0f 85 75 ff ff ff    	jne    8025af <devpipe_write+0x57>
+    return n;
+  80263a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80263e:	eb 05                	jmp    802645 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802640:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802645:	48 83 c4 18          	add    $0x18,%rsp
+  802649:	5b                   	pop    %rbx
+  80264a:	41 5c                	pop    %r12
+  80264c:	41 5d                	pop    %r13
+  80264e:	41 5e                	pop    %r14
+  802650:	41 5f                	pop    %r15
+  802652:	5d                   	pop    %rbp
+  802653:	c3                   	ret
+
+0000000000802654 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802654:	55                   	push   %rbp
+  802655:	48 89 e5             	mov    %rsp,%rbp
+  802658:	41 57                	push   %r15
+  80265a:	41 56                	push   %r14
+  80265c:	41 55                	push   %r13
+  80265e:	41 54                	push   %r12
+  802660:	53                   	push   %rbx
+  802661:	48 83 ec 18          	sub    $0x18,%rsp
+  802665:	49 89 fc             	mov    %rdi,%r12
+  802668:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80266c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802670:	48 b8 a4 0c 80 00 00 	movabs $0x800ca4,%rax
+  802677:	00 00 00 
+  80267a:	ff d0                	call   *%rax
+  80267c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80267f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802685:	49 bd 50 02 80 00 00 	movabs $0x800250,%r13
+  80268c:	00 00 00 
+            sys_yield();
+  80268f:	49 be ed 01 80 00 00 	movabs $0x8001ed,%r14
+  802696:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802699:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80269e:	74 7d                	je     80271d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026a0:	8b 03                	mov    (%rbx),%eax
+  8026a2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026a5:	75 26                	jne    8026cd <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026a7:	4d 85 ff             	test   %r15,%r15
+  8026aa:	75 77                	jne    802723 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026ac:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026b1:	48 89 da             	mov    %rbx,%rdx
+  8026b4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026b9:	4c 89 e7             	mov    %r12,%rdi
+  8026bc:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026bf:	85 c0                	test   %eax,%eax
+  8026c1:	74 72                	je     802735 <devpipe_read+0xe1>
+            sys_yield();
+  8026c3:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026c6:	8b 03                	mov    (%rbx),%eax
+  8026c8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026cb:	74 df                	je     8026ac <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026cd:	48 63 c8             	movslq %eax,%rcx
+  8026d0:	48 89 ca             	mov    %rcx,%rdx
+  8026d3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026d7:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026de:	08 10 20 
+  8026e1:	48 89 d0             	mov    %rdx,%rax
+  8026e4:	48 f7 e6             	mul    %rsi
+  8026e7:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026eb:	48 89 d0             	mov    %rdx,%rax
+  8026ee:	48 c1 e0 09          	shl    $0x9,%rax
+  8026f2:	48 29 d0             	sub    %rdx,%rax
+  8026f5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8026fc:	00 
+  8026fd:	48 89 c8             	mov    %rcx,%rax
+  802700:	48 29 d0             	sub    %rdx,%rax
+  802703:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802708:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80270c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802710:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802713:	49 83 c7 01          	add    $0x1,%r15
+  802717:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80271b:	75 83                	jne    8026a0 <devpipe_read+0x4c>
+    return n;
+  80271d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802721:	eb 03                	jmp    802726 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802723:	4c 89 f8             	mov    %r15,%rax
+}
+  802726:	48 83 c4 18          	add    $0x18,%rsp
+  80272a:	5b                   	pop    %rbx
+  80272b:	41 5c                	pop    %r12
+  80272d:	41 5d                	pop    %r13
+  80272f:	41 5e                	pop    %r14
+  802731:	41 5f                	pop    %r15
+  802733:	5d                   	pop    %rbp
+  802734:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273a:	eb ea                	jmp    802726 <devpipe_read+0xd2>
+
+000000000080273c <pipe>:
+pipe(int pfd[2]) {
+  80273c:	55                   	push   %rbp
+  80273d:	48 89 e5             	mov    %rsp,%rbp
+  802740:	41 55                	push   %r13
+  802742:	41 54                	push   %r12
+  802744:	53                   	push   %rbx
+  802745:	48 83 ec 18          	sub    $0x18,%rsp
+  802749:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80274c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802750:	48 b8 c0 0c 80 00 00 	movabs $0x800cc0,%rax
+  802757:	00 00 00 
+  80275a:	ff d0                	call   *%rax
+  80275c:	89 c3                	mov    %eax,%ebx
+  80275e:	85 c0                	test   %eax,%eax
+  802760:	0f 88 a0 01 00 00    	js     802906 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802766:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80276b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802770:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802774:	bf 00 00 00 00       	mov    $0x0,%edi
+  802779:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+  802785:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802787:	85 c0                	test   %eax,%eax
+  802789:	0f 88 77 01 00 00    	js     802906 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80278f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802793:	48 b8 c0 0c 80 00 00 	movabs $0x800cc0,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+  80279f:	89 c3                	mov    %eax,%ebx
+  8027a1:	85 c0                	test   %eax,%eax
+  8027a3:	0f 88 43 01 00 00    	js     8028ec <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027a9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027b3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027bc:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  8027c3:	00 00 00 
+  8027c6:	ff d0                	call   *%rax
+  8027c8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027ca:	85 c0                	test   %eax,%eax
+  8027cc:	0f 88 1a 01 00 00    	js     8028ec <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027d2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027d6:	48 b8 a4 0c 80 00 00 	movabs $0x800ca4,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+  8027e2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027e5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027ea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027ef:	48 89 c6             	mov    %rax,%rsi
+  8027f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027f7:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  8027fe:	00 00 00 
+  802801:	ff d0                	call   *%rax
+  802803:	89 c3                	mov    %eax,%ebx
+  802805:	85 c0                	test   %eax,%eax
+  802807:	0f 88 c5 00 00 00    	js     8028d2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80280d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802811:	48 b8 a4 0c 80 00 00 	movabs $0x800ca4,%rax
+  802818:	00 00 00 
+  80281b:	ff d0                	call   *%rax
+  80281d:	48 89 c1             	mov    %rax,%rcx
+  802820:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802826:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80282c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802831:	4c 89 ee             	mov    %r13,%rsi
+  802834:	bf 00 00 00 00       	mov    $0x0,%edi
+  802839:	48 b8 e3 02 80 00 00 	movabs $0x8002e3,%rax
+  802840:	00 00 00 
+  802843:	ff d0                	call   *%rax
+  802845:	89 c3                	mov    %eax,%ebx
+  802847:	85 c0                	test   %eax,%eax
+  802849:	78 6e                	js     8028b9 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80284b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802850:	4c 89 ef             	mov    %r13,%rdi
+  802853:	48 b8 1e 02 80 00 00 	movabs $0x80021e,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+  80285f:	83 f8 02             	cmp    $0x2,%eax
+  802862:	0f 85 ab 00 00 00    	jne    802913 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802868:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80286f:	00 00 
+  802871:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802875:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802877:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80287b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802882:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802886:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802888:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80288c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802893:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802897:	48 bb 92 0c 80 00 00 	movabs $0x800c92,%rbx
+  80289e:	00 00 00 
+  8028a1:	ff d3                	call   *%rbx
+  8028a3:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028a7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028ab:	ff d3                	call   *%rbx
+  8028ad:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028b7:	eb 4d                	jmp    802906 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8028b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028be:	4c 89 ee             	mov    %r13,%rsi
+  8028c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028c6:	48 b8 5b 04 80 00 00 	movabs $0x80045b,%rax
+  8028cd:	00 00 00 
+  8028d0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028d7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e0:	48 b8 5b 04 80 00 00 	movabs $0x80045b,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8028ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028f1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fa:	48 b8 5b 04 80 00 00 	movabs $0x80045b,%rax
+  802901:	00 00 00 
+  802904:	ff d0                	call   *%rax
+}
+  802906:	89 d8                	mov    %ebx,%eax
+  802908:	48 83 c4 18          	add    $0x18,%rsp
+  80290c:	5b                   	pop    %rbx
+  80290d:	41 5c                	pop    %r12
+  80290f:	41 5d                	pop    %r13
+  802911:	5d                   	pop    %rbp
+  802912:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802913:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  80291a:	00 00 00 
+  80291d:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  802924:	00 00 00 
+  802927:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80292c:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  802933:	00 00 00 
+  802936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293b:	49 b8 1b 2f 80 00 00 	movabs $0x802f1b,%r8
+  802942:	00 00 00 
+  802945:	41 ff d0             	call   *%r8
+
+0000000000802948 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802948:	55                   	push   %rbp
+  802949:	48 89 e5             	mov    %rsp,%rbp
+  80294c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802950:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802954:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  80295b:	00 00 00 
+  80295e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802960:	85 c0                	test   %eax,%eax
+  802962:	78 35                	js     802999 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802964:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802968:	48 b8 a4 0c 80 00 00 	movabs $0x800ca4,%rax
+  80296f:	00 00 00 
+  802972:	ff d0                	call   *%rax
+  802974:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802977:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80297c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802981:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802985:	48 b8 50 02 80 00 00 	movabs $0x800250,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+  802991:	85 c0                	test   %eax,%eax
+  802993:	0f 94 c0             	sete   %al
+  802996:	0f b6 c0             	movzbl %al,%eax
+}
+  802999:	c9                   	leave
+  80299a:	c3                   	ret
+
+000000000080299b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80299b:	48 89 f8             	mov    %rdi,%rax
+  80299e:	48 c1 e8 27          	shr    $0x27,%rax
+  8029a2:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8029a9:	7f 00 00 
+  8029ac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029b0:	f6 c2 01             	test   $0x1,%dl
+  8029b3:	74 6d                	je     802a22 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029b5:	48 89 f8             	mov    %rdi,%rax
+  8029b8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029bc:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029c3:	7f 00 00 
+  8029c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ca:	f6 c2 01             	test   $0x1,%dl
+  8029cd:	74 62                	je     802a31 <get_uvpt_entry+0x96>
+  8029cf:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029d6:	7f 00 00 
+  8029d9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029dd:	f6 c2 80             	test   $0x80,%dl
+  8029e0:	75 4f                	jne    802a31 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029e2:	48 89 f8             	mov    %rdi,%rax
+  8029e5:	48 c1 e8 15          	shr    $0x15,%rax
+  8029e9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8029f0:	7f 00 00 
+  8029f3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029f7:	f6 c2 01             	test   $0x1,%dl
+  8029fa:	74 44                	je     802a40 <get_uvpt_entry+0xa5>
+  8029fc:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a03:	7f 00 00 
+  802a06:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a0a:	f6 c2 80             	test   $0x80,%dl
+  802a0d:	75 31                	jne    802a40 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a0f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a13:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a1a:	7f 00 00 
+  802a1d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a21:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a22:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a29:	7f 00 00 
+  802a2c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a30:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a31:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a38:	7f 00 00 
+  802a3b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a3f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a40:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a47:	7f 00 00 
+  802a4a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a4e:	c3                   	ret
+
+0000000000802a4f <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802a4f:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a52:	48 89 f9             	mov    %rdi,%rcx
+  802a55:	48 c1 e9 27          	shr    $0x27,%rcx
+  802a59:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802a60:	7f 00 00 
+  802a63:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802a67:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a6e:	f6 c1 01             	test   $0x1,%cl
+  802a71:	0f 84 b2 00 00 00    	je     802b29 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a77:	48 89 f9             	mov    %rdi,%rcx
+  802a7a:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802a7e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802a85:	7f 00 00 
+  802a88:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802a8c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a93:	40 f6 c6 01          	test   $0x1,%sil
+  802a97:	0f 84 8c 00 00 00    	je     802b29 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802a9d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802aa4:	7f 00 00 
+  802aa7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802aab:	a8 80                	test   $0x80,%al
+  802aad:	75 7b                	jne    802b2a <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802aaf:	48 89 f9             	mov    %rdi,%rcx
+  802ab2:	48 c1 e9 15          	shr    $0x15,%rcx
+  802ab6:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802abd:	7f 00 00 
+  802ac0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802ac4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802acb:	40 f6 c6 01          	test   $0x1,%sil
+  802acf:	74 58                	je     802b29 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802ad1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802ad8:	7f 00 00 
+  802adb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802adf:	a8 80                	test   $0x80,%al
+  802ae1:	75 6c                	jne    802b4f <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802ae3:	48 89 f9             	mov    %rdi,%rcx
+  802ae6:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802aea:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802af1:	7f 00 00 
+  802af4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802af8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802aff:	40 f6 c6 01          	test   $0x1,%sil
+  802b03:	74 24                	je     802b29 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b05:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b0c:	7f 00 00 
+  802b0f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b13:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b1a:	ff ff 7f 
+  802b1d:	48 21 c8             	and    %rcx,%rax
+  802b20:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b26:	48 09 d0             	or     %rdx,%rax
+}
+  802b29:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b2a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b31:	7f 00 00 
+  802b34:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b38:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b3f:	ff ff 7f 
+  802b42:	48 21 c8             	and    %rcx,%rax
+  802b45:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802b4b:	48 01 d0             	add    %rdx,%rax
+  802b4e:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802b4f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b56:	7f 00 00 
+  802b59:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b5d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b64:	ff ff 7f 
+  802b67:	48 21 c8             	and    %rcx,%rax
+  802b6a:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802b70:	48 01 d0             	add    %rdx,%rax
+  802b73:	c3                   	ret
+
+0000000000802b74 <get_prot>:
+
+int
+get_prot(void *va) {
+  802b74:	55                   	push   %rbp
+  802b75:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b78:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  802b7f:	00 00 00 
+  802b82:	ff d0                	call   *%rax
+  802b84:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b87:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b8c:	89 c1                	mov    %eax,%ecx
+  802b8e:	83 c9 04             	or     $0x4,%ecx
+  802b91:	f6 c2 01             	test   $0x1,%dl
+  802b94:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b97:	89 c1                	mov    %eax,%ecx
+  802b99:	83 c9 02             	or     $0x2,%ecx
+  802b9c:	f6 c2 02             	test   $0x2,%dl
+  802b9f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ba2:	89 c1                	mov    %eax,%ecx
+  802ba4:	83 c9 01             	or     $0x1,%ecx
+  802ba7:	48 85 d2             	test   %rdx,%rdx
+  802baa:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bad:	89 c1                	mov    %eax,%ecx
+  802baf:	83 c9 40             	or     $0x40,%ecx
+  802bb2:	f6 c6 04             	test   $0x4,%dh
+  802bb5:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802bb8:	5d                   	pop    %rbp
+  802bb9:	c3                   	ret
+
+0000000000802bba <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802bba:	55                   	push   %rbp
+  802bbb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bbe:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  802bc5:	00 00 00 
+  802bc8:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802bca:	48 c1 e8 06          	shr    $0x6,%rax
+  802bce:	83 e0 01             	and    $0x1,%eax
+}
+  802bd1:	5d                   	pop    %rbp
+  802bd2:	c3                   	ret
+
+0000000000802bd3 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bd3:	55                   	push   %rbp
+  802bd4:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802bd7:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  802bde:	00 00 00 
+  802be1:	ff d0                	call   *%rax
+  802be3:	83 e0 01             	and    $0x1,%eax
+}
+  802be6:	5d                   	pop    %rbp
+  802be7:	c3                   	ret
+
+0000000000802be8 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802be8:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802bef:	7f 00 00 
+  802bf2:	a8 01                	test   $0x1,%al
+  802bf4:	75 06                	jne    802bfc <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bfb:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802bfc:	55                   	push   %rbp
+  802bfd:	48 89 e5             	mov    %rsp,%rbp
+  802c00:	41 57                	push   %r15
+  802c02:	41 56                	push   %r14
+  802c04:	41 55                	push   %r13
+  802c06:	41 54                	push   %r12
+  802c08:	53                   	push   %rbx
+  802c09:	48 83 ec 18          	sub    $0x18,%rsp
+  802c0d:	49 89 fe             	mov    %rdi,%r14
+  802c10:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c13:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c1a:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c1b:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c22:	7f 00 00 
+  802c25:	e9 81 00 00 00       	jmp    802cab <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c2a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c31:	49 39 dd             	cmp    %rbx,%r13
+  802c34:	74 2b                	je     802c61 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c36:	48 89 d8             	mov    %rbx,%rax
+  802c39:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c3d:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802c41:	f6 c2 01             	test   $0x1,%dl
+  802c44:	74 e4                	je     802c2a <foreach_shared_region+0x42>
+  802c46:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802c4a:	f6 c4 04             	test   $0x4,%ah
+  802c4d:	74 db                	je     802c2a <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802c4f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802c56:	4c 89 fa             	mov    %r15,%rdx
+  802c59:	48 89 df             	mov    %rbx,%rdi
+  802c5c:	41 ff d6             	call   *%r14
+  802c5f:	eb c9                	jmp    802c2a <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802c61:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802c68:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802c6c:	74 22                	je     802c90 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802c6e:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802c75:	48 89 d8             	mov    %rbx,%rax
+  802c78:	48 c1 e8 15          	shr    $0x15,%rax
+  802c7c:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802c83:	7f 00 00 
+  802c86:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802c8a:	a8 01                	test   $0x1,%al
+  802c8c:	74 d3                	je     802c61 <foreach_shared_region+0x79>
+  802c8e:	eb a6                	jmp    802c36 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c90:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802c97:	40 
+  802c98:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802c9c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ca3:	00 00 00 
+  802ca6:	48 39 c1             	cmp    %rax,%rcx
+  802ca9:	74 31                	je     802cdc <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802cab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802caf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cb3:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802cba:	7f 00 00 
+  802cbd:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802cc1:	a8 01                	test   $0x1,%al
+  802cc3:	74 cb                	je     802c90 <foreach_shared_region+0xa8>
+  802cc5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cc9:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cd0:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802cd6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802cda:	eb 92                	jmp    802c6e <foreach_shared_region+0x86>
+}
+  802cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce1:	48 83 c4 18          	add    $0x18,%rsp
+  802ce5:	5b                   	pop    %rbx
+  802ce6:	41 5c                	pop    %r12
+  802ce8:	41 5d                	pop    %r13
+  802cea:	41 5e                	pop    %r14
+  802cec:	41 5f                	pop    %r15
+  802cee:	5d                   	pop    %rbp
+  802cef:	c3                   	ret
+
+0000000000802cf0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf5:	c3                   	ret
+
+0000000000802cf6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802cf6:	55                   	push   %rbp
+  802cf7:	48 89 e5             	mov    %rsp,%rbp
+  802cfa:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802cfd:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d04:	00 00 00 
+  802d07:	48 b8 e3 39 80 00 00 	movabs $0x8039e3,%rax
+  802d0e:	00 00 00 
+  802d11:	ff d0                	call   *%rax
+    return 0;
+}
+  802d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d18:	5d                   	pop    %rbp
+  802d19:	c3                   	ret
+
+0000000000802d1a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d1a:	55                   	push   %rbp
+  802d1b:	48 89 e5             	mov    %rsp,%rbp
+  802d1e:	41 57                	push   %r15
+  802d20:	41 56                	push   %r14
+  802d22:	41 55                	push   %r13
+  802d24:	41 54                	push   %r12
+  802d26:	53                   	push   %rbx
+  802d27:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d2e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d35:	48 85 d2             	test   %rdx,%rdx
+  802d38:	74 7a                	je     802db4 <devcons_write+0x9a>
+  802d3a:	49 89 d6             	mov    %rdx,%r14
+  802d3d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d43:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d48:	49 bf 71 3d 80 00 00 	movabs $0x803d71,%r15
+  802d4f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d52:	4c 89 f3             	mov    %r14,%rbx
+  802d55:	48 29 f3             	sub    %rsi,%rbx
+  802d58:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d5d:	48 39 c3             	cmp    %rax,%rbx
+  802d60:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d64:	4c 63 eb             	movslq %ebx,%r13
+  802d67:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d6e:	48 01 c6             	add    %rax,%rsi
+  802d71:	4c 89 ea             	mov    %r13,%rdx
+  802d74:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d7b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d7e:	4c 89 ee             	mov    %r13,%rsi
+  802d81:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d88:	48 b8 f3 00 80 00 00 	movabs $0x8000f3,%rax
+  802d8f:	00 00 00 
+  802d92:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d94:	41 01 dc             	add    %ebx,%r12d
+  802d97:	49 63 f4             	movslq %r12d,%rsi
+  802d9a:	4c 39 f6             	cmp    %r14,%rsi
+  802d9d:	72 b3                	jb     802d52 <devcons_write+0x38>
+    return res;
+  802d9f:	49 63 c4             	movslq %r12d,%rax
+}
+  802da2:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802da9:	5b                   	pop    %rbx
+  802daa:	41 5c                	pop    %r12
+  802dac:	41 5d                	pop    %r13
+  802dae:	41 5e                	pop    %r14
+  802db0:	41 5f                	pop    %r15
+  802db2:	5d                   	pop    %rbp
+  802db3:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802db4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dba:	eb e3                	jmp    802d9f <devcons_write+0x85>
+
+0000000000802dbc <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dbc:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802dbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dc4:	48 85 c0             	test   %rax,%rax
+  802dc7:	74 55                	je     802e1e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dc9:	55                   	push   %rbp
+  802dca:	48 89 e5             	mov    %rsp,%rbp
+  802dcd:	41 55                	push   %r13
+  802dcf:	41 54                	push   %r12
+  802dd1:	53                   	push   %rbx
+  802dd2:	48 83 ec 08          	sub    $0x8,%rsp
+  802dd6:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802dd9:	48 bb 20 01 80 00 00 	movabs $0x800120,%rbx
+  802de0:	00 00 00 
+  802de3:	49 bc ed 01 80 00 00 	movabs $0x8001ed,%r12
+  802dea:	00 00 00 
+  802ded:	eb 03                	jmp    802df2 <devcons_read+0x36>
+  802def:	41 ff d4             	call   *%r12
+  802df2:	ff d3                	call   *%rbx
+  802df4:	85 c0                	test   %eax,%eax
+  802df6:	74 f7                	je     802def <devcons_read+0x33>
+    if (c < 0) return c;
+  802df8:	48 63 d0             	movslq %eax,%rdx
+  802dfb:	78 13                	js     802e10 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802dfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e02:	83 f8 04             	cmp    $0x4,%eax
+  802e05:	74 09                	je     802e10 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e07:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e0b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e10:	48 89 d0             	mov    %rdx,%rax
+  802e13:	48 83 c4 08          	add    $0x8,%rsp
+  802e17:	5b                   	pop    %rbx
+  802e18:	41 5c                	pop    %r12
+  802e1a:	41 5d                	pop    %r13
+  802e1c:	5d                   	pop    %rbp
+  802e1d:	c3                   	ret
+  802e1e:	48 89 d0             	mov    %rdx,%rax
+  802e21:	c3                   	ret
+
+0000000000802e22 <cputchar>:
+cputchar(int ch) {
+  802e22:	55                   	push   %rbp
+  802e23:	48 89 e5             	mov    %rsp,%rbp
+  802e26:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e2a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e2e:	be 01 00 00 00       	mov    $0x1,%esi
+  802e33:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e37:	48 b8 f3 00 80 00 00 	movabs $0x8000f3,%rax
+  802e3e:	00 00 00 
+  802e41:	ff d0                	call   *%rax
+}
+  802e43:	c9                   	leave
+  802e44:	c3                   	ret
+
+0000000000802e45 <getchar>:
+getchar(void) {
+  802e45:	55                   	push   %rbp
+  802e46:	48 89 e5             	mov    %rsp,%rbp
+  802e49:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e4d:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e52:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5b:	48 b8 03 10 80 00 00 	movabs $0x801003,%rax
+  802e62:	00 00 00 
+  802e65:	ff d0                	call   *%rax
+  802e67:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e69:	85 c0                	test   %eax,%eax
+  802e6b:	78 06                	js     802e73 <getchar+0x2e>
+  802e6d:	74 08                	je     802e77 <getchar+0x32>
+  802e6f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e73:	89 d0                	mov    %edx,%eax
+  802e75:	c9                   	leave
+  802e76:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e77:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e7c:	eb f5                	jmp    802e73 <getchar+0x2e>
+
+0000000000802e7e <iscons>:
+iscons(int fdnum) {
+  802e7e:	55                   	push   %rbp
+  802e7f:	48 89 e5             	mov    %rsp,%rbp
+  802e82:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e86:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e8a:	48 b8 20 0d 80 00 00 	movabs $0x800d20,%rax
+  802e91:	00 00 00 
+  802e94:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e96:	85 c0                	test   %eax,%eax
+  802e98:	78 18                	js     802eb2 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e9a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e9e:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802ea5:	00 00 00 
+  802ea8:	8b 00                	mov    (%rax),%eax
+  802eaa:	39 02                	cmp    %eax,(%rdx)
+  802eac:	0f 94 c0             	sete   %al
+  802eaf:	0f b6 c0             	movzbl %al,%eax
+}
+  802eb2:	c9                   	leave
+  802eb3:	c3                   	ret
+
+0000000000802eb4 <opencons>:
+opencons(void) {
+  802eb4:	55                   	push   %rbp
+  802eb5:	48 89 e5             	mov    %rsp,%rbp
+  802eb8:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ebc:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ec0:	48 b8 c0 0c 80 00 00 	movabs $0x800cc0,%rax
+  802ec7:	00 00 00 
+  802eca:	ff d0                	call   *%rax
+  802ecc:	85 c0                	test   %eax,%eax
+  802ece:	78 49                	js     802f19 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ed0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ed5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802eda:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802ede:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee3:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  802eea:	00 00 00 
+  802eed:	ff d0                	call   *%rax
+  802eef:	85 c0                	test   %eax,%eax
+  802ef1:	78 26                	js     802f19 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802ef3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ef7:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802efe:	00 00 
+  802f00:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f02:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f06:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f0d:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  802f14:	00 00 00 
+  802f17:	ff d0                	call   *%rax
+}
+  802f19:	c9                   	leave
+  802f1a:	c3                   	ret
+
+0000000000802f1b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f1b:	55                   	push   %rbp
+  802f1c:	48 89 e5             	mov    %rsp,%rbp
+  802f1f:	41 56                	push   %r14
+  802f21:	41 55                	push   %r13
+  802f23:	41 54                	push   %r12
+  802f25:	53                   	push   %rbx
+  802f26:	48 83 ec 50          	sub    $0x50,%rsp
+  802f2a:	49 89 fc             	mov    %rdi,%r12
+  802f2d:	41 89 f5             	mov    %esi,%r13d
+  802f30:	48 89 d3             	mov    %rdx,%rbx
+  802f33:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802f37:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802f3b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f3f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802f46:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f4a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f4e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802f52:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f56:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802f5d:	00 00 00 
+  802f60:	4c 8b 30             	mov    (%rax),%r14
+  802f63:	48 b8 bc 01 80 00 00 	movabs $0x8001bc,%rax
+  802f6a:	00 00 00 
+  802f6d:	ff d0                	call   *%rax
+  802f6f:	89 c6                	mov    %eax,%esi
+  802f71:	45 89 e8             	mov    %r13d,%r8d
+  802f74:	4c 89 e1             	mov    %r12,%rcx
+  802f77:	4c 89 f2             	mov    %r14,%rdx
+  802f7a:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802f81:	00 00 00 
+  802f84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f89:	49 bc 6b 30 80 00 00 	movabs $0x80306b,%r12
+  802f90:	00 00 00 
+  802f93:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802f96:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802f9a:	48 89 df             	mov    %rbx,%rdi
+  802f9d:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  802fa4:	00 00 00 
+  802fa7:	ff d0                	call   *%rax
+    cprintf("\n");
+  802fa9:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  802fb0:	00 00 00 
+  802fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802fbb:	cc                   	int3
+  802fbc:	eb fd                	jmp    802fbb <_panic+0xa0>
+
+0000000000802fbe <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802fbe:	55                   	push   %rbp
+  802fbf:	48 89 e5             	mov    %rsp,%rbp
+  802fc2:	53                   	push   %rbx
+  802fc3:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802fca:	8b 06                	mov    (%rsi),%eax
+  802fcc:	8d 50 01             	lea    0x1(%rax),%edx
+  802fcf:	89 16                	mov    %edx,(%rsi)
+  802fd1:	48 98                	cltq
+  802fd3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802fd8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802fde:	74 0a                	je     802fea <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802fe0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802fe4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fe8:	c9                   	leave
+  802fe9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802fea:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802fee:	be ff 00 00 00       	mov    $0xff,%esi
+  802ff3:	48 b8 f3 00 80 00 00 	movabs $0x8000f3,%rax
+  802ffa:	00 00 00 
+  802ffd:	ff d0                	call   *%rax
+        state->offset = 0;
+  802fff:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803005:	eb d9                	jmp    802fe0 <putch+0x22>
+
+0000000000803007 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803007:	55                   	push   %rbp
+  803008:	48 89 e5             	mov    %rsp,%rbp
+  80300b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803012:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803015:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80301c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803021:	b8 00 00 00 00       	mov    $0x0,%eax
+  803026:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803029:	48 89 f1             	mov    %rsi,%rcx
+  80302c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803033:	48 bf be 2f 80 00 00 	movabs $0x802fbe,%rdi
+  80303a:	00 00 00 
+  80303d:	48 b8 bb 31 80 00 00 	movabs $0x8031bb,%rax
+  803044:	00 00 00 
+  803047:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803049:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803050:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803057:	48 b8 f3 00 80 00 00 	movabs $0x8000f3,%rax
+  80305e:	00 00 00 
+  803061:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  803063:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  803069:	c9                   	leave
+  80306a:	c3                   	ret
+
+000000000080306b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80306b:	55                   	push   %rbp
+  80306c:	48 89 e5             	mov    %rsp,%rbp
+  80306f:	48 83 ec 50          	sub    $0x50,%rsp
+  803073:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803077:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80307b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80307f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803083:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803087:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80308e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803092:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803096:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80309a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80309e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8030a2:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  8030a9:	00 00 00 
+  8030ac:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8030ae:	c9                   	leave
+  8030af:	c3                   	ret
+
+00000000008030b0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8030b0:	55                   	push   %rbp
+  8030b1:	48 89 e5             	mov    %rsp,%rbp
+  8030b4:	41 57                	push   %r15
+  8030b6:	41 56                	push   %r14
+  8030b8:	41 55                	push   %r13
+  8030ba:	41 54                	push   %r12
+  8030bc:	53                   	push   %rbx
+  8030bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8030c1:	49 89 fc             	mov    %rdi,%r12
+  8030c4:	49 89 f5             	mov    %rsi,%r13
+  8030c7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8030cb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8030ce:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8030d1:	41 89 cf             	mov    %ecx,%r15d
+  8030d4:	4c 39 fa             	cmp    %r15,%rdx
+  8030d7:	73 5b                	jae    803134 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8030d9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8030dd:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8030e1:	85 db                	test   %ebx,%ebx
+  8030e3:	7e 0e                	jle    8030f3 <print_num+0x43>
+            putch(padc, put_arg);
+  8030e5:	4c 89 ee             	mov    %r13,%rsi
+  8030e8:	44 89 f7             	mov    %r14d,%edi
+  8030eb:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8030ee:	83 eb 01             	sub    $0x1,%ebx
+  8030f1:	75 f2                	jne    8030e5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8030f3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8030f7:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  8030fe:	00 00 00 
+  803101:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  803108:	00 00 00 
+  80310b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80310f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803113:	ba 00 00 00 00       	mov    $0x0,%edx
+  803118:	49 f7 f7             	div    %r15
+  80311b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80311f:	4c 89 ee             	mov    %r13,%rsi
+  803122:	41 ff d4             	call   *%r12
+}
+  803125:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803129:	5b                   	pop    %rbx
+  80312a:	41 5c                	pop    %r12
+  80312c:	41 5d                	pop    %r13
+  80312e:	41 5e                	pop    %r14
+  803130:	41 5f                	pop    %r15
+  803132:	5d                   	pop    %rbp
+  803133:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803134:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803138:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313d:	49 f7 f7             	div    %r15
+  803140:	48 83 ec 08          	sub    $0x8,%rsp
+  803144:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803148:	52                   	push   %rdx
+  803149:	45 0f be c9          	movsbl %r9b,%r9d
+  80314d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803151:	48 89 c2             	mov    %rax,%rdx
+  803154:	48 b8 b0 30 80 00 00 	movabs $0x8030b0,%rax
+  80315b:	00 00 00 
+  80315e:	ff d0                	call   *%rax
+  803160:	48 83 c4 10          	add    $0x10,%rsp
+  803164:	eb 8d                	jmp    8030f3 <print_num+0x43>
+
+0000000000803166 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803166:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80316a:	48 8b 06             	mov    (%rsi),%rax
+  80316d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  803171:	73 0a                	jae    80317d <sprintputch+0x17>
+        *state->start++ = ch;
+  803173:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803177:	48 89 16             	mov    %rdx,(%rsi)
+  80317a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80317d:	c3                   	ret
+
+000000000080317e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80317e:	55                   	push   %rbp
+  80317f:	48 89 e5             	mov    %rsp,%rbp
+  803182:	48 83 ec 50          	sub    $0x50,%rsp
+  803186:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80318a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80318e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  803192:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803199:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80319d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031a1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031a5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8031a9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8031ad:	48 b8 bb 31 80 00 00 	movabs $0x8031bb,%rax
+  8031b4:	00 00 00 
+  8031b7:	ff d0                	call   *%rax
+}
+  8031b9:	c9                   	leave
+  8031ba:	c3                   	ret
+
+00000000008031bb <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8031bb:	55                   	push   %rbp
+  8031bc:	48 89 e5             	mov    %rsp,%rbp
+  8031bf:	41 57                	push   %r15
+  8031c1:	41 56                	push   %r14
+  8031c3:	41 55                	push   %r13
+  8031c5:	41 54                	push   %r12
+  8031c7:	53                   	push   %rbx
+  8031c8:	48 83 ec 38          	sub    $0x38,%rsp
+  8031cc:	49 89 fe             	mov    %rdi,%r14
+  8031cf:	49 89 f5             	mov    %rsi,%r13
+  8031d2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8031d5:	48 8b 01             	mov    (%rcx),%rax
+  8031d8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031dc:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8031e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031e4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8031e8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8031ec:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8031f0:	0f b6 3b             	movzbl (%rbx),%edi
+  8031f3:	40 80 ff 25          	cmp    $0x25,%dil
+  8031f7:	74 18                	je     803211 <vprintfmt+0x56>
+            if (!ch) return;
+  8031f9:	40 84 ff             	test   %dil,%dil
+  8031fc:	0f 84 04 07 00 00    	je     803906 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  803202:	40 0f b6 ff          	movzbl %dil,%edi
+  803206:	4c 89 ee             	mov    %r13,%rsi
+  803209:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80320c:	4c 89 e3             	mov    %r12,%rbx
+  80320f:	eb db                	jmp    8031ec <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803211:	be 00 00 00 00       	mov    $0x0,%esi
+  803216:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80321a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80321f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803225:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80322c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803230:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803235:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80323a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80323d:	83 e8 23             	sub    $0x23,%eax
+  803240:	3c 57                	cmp    $0x57,%al
+  803242:	0f 87 a4 06 00 00    	ja     8038ec <vprintfmt+0x731>
+  803248:	0f b6 c0             	movzbl %al,%eax
+  80324b:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  803252:	00 00 00 
+  803255:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803258:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80325b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80325f:	eb cf                	jmp    803230 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  803261:	49 89 dc             	mov    %rbx,%r12
+  803264:	be 01 00 00 00       	mov    $0x1,%esi
+  803269:	eb c5                	jmp    803230 <vprintfmt+0x75>
+            padc = ch;
+  80326b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80326f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803272:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803275:	eb b9                	jmp    803230 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803277:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80327a:	83 f8 2f             	cmp    $0x2f,%eax
+  80327d:	77 24                	ja     8032a3 <vprintfmt+0xe8>
+  80327f:	89 c1                	mov    %eax,%ecx
+  803281:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  803285:	83 c0 08             	add    $0x8,%eax
+  803288:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80328b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80328e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  803291:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803295:	79 99                	jns    803230 <vprintfmt+0x75>
+                width = precision;
+  803297:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80329b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8032a1:	eb 8d                	jmp    803230 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032a3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032a7:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8032ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032af:	eb da                	jmp    80328b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8032b1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8032b6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032ba:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8032c0:	3c 39                	cmp    $0x39,%al
+  8032c2:	77 1c                	ja     8032e0 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8032c4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8032c8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8032cc:	0f b6 c0             	movzbl %al,%eax
+  8032cf:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032d4:	0f b6 03             	movzbl (%rbx),%eax
+  8032d7:	3c 39                	cmp    $0x39,%al
+  8032d9:	76 e9                	jbe    8032c4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8032db:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8032de:	eb b1                	jmp    803291 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8032e0:	49 89 dc             	mov    %rbx,%r12
+  8032e3:	eb ac                	jmp    803291 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8032e5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8032e8:	85 c9                	test   %ecx,%ecx
+  8032ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ef:	0f 49 c1             	cmovns %ecx,%eax
+  8032f2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8032f5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8032f8:	e9 33 ff ff ff       	jmp    803230 <vprintfmt+0x75>
+            lflag++;
+  8032fd:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803300:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803303:	e9 28 ff ff ff       	jmp    803230 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803308:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80330b:	83 f8 2f             	cmp    $0x2f,%eax
+  80330e:	77 19                	ja     803329 <vprintfmt+0x16e>
+  803310:	89 c2                	mov    %eax,%edx
+  803312:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803316:	83 c0 08             	add    $0x8,%eax
+  803319:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80331c:	8b 3a                	mov    (%rdx),%edi
+  80331e:	4c 89 ee             	mov    %r13,%rsi
+  803321:	41 ff d6             	call   *%r14
+            break;
+  803324:	e9 c3 fe ff ff       	jmp    8031ec <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803329:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80332d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803331:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803335:	eb e5                	jmp    80331c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803337:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80333a:	83 f8 2f             	cmp    $0x2f,%eax
+  80333d:	77 5a                	ja     803399 <vprintfmt+0x1de>
+  80333f:	89 c2                	mov    %eax,%edx
+  803341:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803345:	83 c0 08             	add    $0x8,%eax
+  803348:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80334b:	8b 02                	mov    (%rdx),%eax
+  80334d:	89 c1                	mov    %eax,%ecx
+  80334f:	f7 d9                	neg    %ecx
+  803351:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803354:	83 f9 13             	cmp    $0x13,%ecx
+  803357:	7f 4e                	jg     8033a7 <vprintfmt+0x1ec>
+  803359:	48 63 c1             	movslq %ecx,%rax
+  80335c:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  803363:	00 00 00 
+  803366:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80336a:	48 85 c0             	test   %rax,%rax
+  80336d:	74 38                	je     8033a7 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80336f:	48 89 c1             	mov    %rax,%rcx
+  803372:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  803379:	00 00 00 
+  80337c:	4c 89 ee             	mov    %r13,%rsi
+  80337f:	4c 89 f7             	mov    %r14,%rdi
+  803382:	b8 00 00 00 00       	mov    $0x0,%eax
+  803387:	49 b8 7e 31 80 00 00 	movabs $0x80317e,%r8
+  80338e:	00 00 00 
+  803391:	41 ff d0             	call   *%r8
+  803394:	e9 53 fe ff ff       	jmp    8031ec <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  803399:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80339d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033a5:	eb a4                	jmp    80334b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8033a7:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  8033ae:	00 00 00 
+  8033b1:	4c 89 ee             	mov    %r13,%rsi
+  8033b4:	4c 89 f7             	mov    %r14,%rdi
+  8033b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033bc:	49 b8 7e 31 80 00 00 	movabs $0x80317e,%r8
+  8033c3:	00 00 00 
+  8033c6:	41 ff d0             	call   *%r8
+  8033c9:	e9 1e fe ff ff       	jmp    8031ec <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8033ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8033d4:	77 36                	ja     80340c <vprintfmt+0x251>
+  8033d6:	89 c2                	mov    %eax,%edx
+  8033d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033dc:	83 c0 08             	add    $0x8,%eax
+  8033df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033e2:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8033e5:	48 85 f6             	test   %rsi,%rsi
+  8033e8:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  8033ef:	00 00 00 
+  8033f2:	48 0f 45 c6          	cmovne %rsi,%rax
+  8033f6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8033fa:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8033fe:	7e 06                	jle    803406 <vprintfmt+0x24b>
+  803400:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803404:	75 14                	jne    80341a <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803406:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80340a:	eb 5b                	jmp    803467 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80340c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803410:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803414:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803418:	eb c8                	jmp    8033e2 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80341a:	49 63 f7             	movslq %r15d,%rsi
+  80341d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803421:	48 b8 c0 39 80 00 00 	movabs $0x8039c0,%rax
+  803428:	00 00 00 
+  80342b:	ff d0                	call   *%rax
+  80342d:	48 89 c2             	mov    %rax,%rdx
+  803430:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803433:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803435:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803438:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80343b:	85 c0                	test   %eax,%eax
+  80343d:	7e c7                	jle    803406 <vprintfmt+0x24b>
+  80343f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803444:	4c 89 ee             	mov    %r13,%rsi
+  803447:	44 89 e7             	mov    %r12d,%edi
+  80344a:	41 ff d6             	call   *%r14
+  80344d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803451:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803454:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803457:	75 eb                	jne    803444 <vprintfmt+0x289>
+  803459:	eb ab                	jmp    803406 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80345b:	0f b6 f8             	movzbl %al,%edi
+  80345e:	4c 89 ee             	mov    %r13,%rsi
+  803461:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  803464:	4c 89 e2             	mov    %r12,%rdx
+  803467:	45 85 ff             	test   %r15d,%r15d
+  80346a:	78 06                	js     803472 <vprintfmt+0x2b7>
+  80346c:	41 83 ef 01          	sub    $0x1,%r15d
+  803470:	78 23                	js     803495 <vprintfmt+0x2da>
+  803472:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  803476:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80347c:	84 c0                	test   %al,%al
+  80347e:	74 15                	je     803495 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803480:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803484:	74 d5                	je     80345b <vprintfmt+0x2a0>
+  803486:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803489:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80348e:	80 fa 5e             	cmp    $0x5e,%dl
+  803491:	77 cb                	ja     80345e <vprintfmt+0x2a3>
+  803493:	eb c6                	jmp    80345b <vprintfmt+0x2a0>
+  803495:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803498:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  80349b:	01 f0                	add    %esi,%eax
+  80349d:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80349f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8034a3:	85 c0                	test   %eax,%eax
+  8034a5:	0f 8e 41 fd ff ff    	jle    8031ec <vprintfmt+0x31>
+  8034ab:	4c 89 ee             	mov    %r13,%rsi
+  8034ae:	bf 20 00 00 00       	mov    $0x20,%edi
+  8034b3:	41 ff d6             	call   *%r14
+  8034b6:	41 83 ec 01          	sub    $0x1,%r12d
+  8034ba:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8034be:	75 eb                	jne    8034ab <vprintfmt+0x2f0>
+  8034c0:	e9 27 fd ff ff       	jmp    8031ec <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8034c5:	40 84 f6             	test   %sil,%sil
+  8034c8:	75 26                	jne    8034f0 <vprintfmt+0x335>
+    switch (lflag) {
+  8034ca:	85 d2                	test   %edx,%edx
+  8034cc:	74 59                	je     803527 <vprintfmt+0x36c>
+  8034ce:	83 fa 01             	cmp    $0x1,%edx
+  8034d1:	74 7b                	je     80354e <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8034d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8034d9:	0f 87 96 00 00 00    	ja     803575 <vprintfmt+0x3ba>
+  8034df:	89 c2                	mov    %eax,%edx
+  8034e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034e5:	83 c0 08             	add    $0x8,%eax
+  8034e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034eb:	4c 8b 22             	mov    (%rdx),%r12
+  8034ee:	eb 17                	jmp    803507 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8034f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8034f6:	77 21                	ja     803519 <vprintfmt+0x35e>
+  8034f8:	89 c2                	mov    %eax,%edx
+  8034fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034fe:	83 c0 08             	add    $0x8,%eax
+  803501:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803504:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803507:	4d 85 e4             	test   %r12,%r12
+  80350a:	78 7a                	js     803586 <vprintfmt+0x3cb>
+            num = i;
+  80350c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80350f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803514:	e9 b5 02 00 00       	jmp    8037ce <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803519:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80351d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803521:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803525:	eb dd                	jmp    803504 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  803527:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80352a:	83 f8 2f             	cmp    $0x2f,%eax
+  80352d:	77 11                	ja     803540 <vprintfmt+0x385>
+  80352f:	89 c2                	mov    %eax,%edx
+  803531:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803535:	83 c0 08             	add    $0x8,%eax
+  803538:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80353b:	4c 63 22             	movslq (%rdx),%r12
+  80353e:	eb c7                	jmp    803507 <vprintfmt+0x34c>
+  803540:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803544:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803548:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80354c:	eb ed                	jmp    80353b <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80354e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803551:	83 f8 2f             	cmp    $0x2f,%eax
+  803554:	77 11                	ja     803567 <vprintfmt+0x3ac>
+  803556:	89 c2                	mov    %eax,%edx
+  803558:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80355c:	83 c0 08             	add    $0x8,%eax
+  80355f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803562:	4c 8b 22             	mov    (%rdx),%r12
+  803565:	eb a0                	jmp    803507 <vprintfmt+0x34c>
+  803567:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80356b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80356f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803573:	eb ed                	jmp    803562 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  803575:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803579:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80357d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803581:	e9 65 ff ff ff       	jmp    8034eb <vprintfmt+0x330>
+                putch('-', put_arg);
+  803586:	4c 89 ee             	mov    %r13,%rsi
+  803589:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80358e:	41 ff d6             	call   *%r14
+                i = -i;
+  803591:	49 f7 dc             	neg    %r12
+  803594:	e9 73 ff ff ff       	jmp    80350c <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  803599:	40 84 f6             	test   %sil,%sil
+  80359c:	75 32                	jne    8035d0 <vprintfmt+0x415>
+    switch (lflag) {
+  80359e:	85 d2                	test   %edx,%edx
+  8035a0:	74 5d                	je     8035ff <vprintfmt+0x444>
+  8035a2:	83 fa 01             	cmp    $0x1,%edx
+  8035a5:	0f 84 82 00 00 00    	je     80362d <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8035ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8035b1:	0f 87 a5 00 00 00    	ja     80365c <vprintfmt+0x4a1>
+  8035b7:	89 c2                	mov    %eax,%edx
+  8035b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035bd:	83 c0 08             	add    $0x8,%eax
+  8035c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035c3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8035cb:	e9 fe 01 00 00       	jmp    8037ce <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8035d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8035d6:	77 19                	ja     8035f1 <vprintfmt+0x436>
+  8035d8:	89 c2                	mov    %eax,%edx
+  8035da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035de:	83 c0 08             	add    $0x8,%eax
+  8035e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035e4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035e7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8035ec:	e9 dd 01 00 00       	jmp    8037ce <vprintfmt+0x613>
+  8035f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035fd:	eb e5                	jmp    8035e4 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8035ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803602:	83 f8 2f             	cmp    $0x2f,%eax
+  803605:	77 18                	ja     80361f <vprintfmt+0x464>
+  803607:	89 c2                	mov    %eax,%edx
+  803609:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80360d:	83 c0 08             	add    $0x8,%eax
+  803610:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803613:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803615:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80361a:	e9 af 01 00 00       	jmp    8037ce <vprintfmt+0x613>
+  80361f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803623:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803627:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80362b:	eb e6                	jmp    803613 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80362d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803630:	83 f8 2f             	cmp    $0x2f,%eax
+  803633:	77 19                	ja     80364e <vprintfmt+0x493>
+  803635:	89 c2                	mov    %eax,%edx
+  803637:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80363b:	83 c0 08             	add    $0x8,%eax
+  80363e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803641:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803644:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803649:	e9 80 01 00 00       	jmp    8037ce <vprintfmt+0x613>
+  80364e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803652:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803656:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80365a:	eb e5                	jmp    803641 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80365c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803660:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803664:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803668:	e9 56 ff ff ff       	jmp    8035c3 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80366d:	40 84 f6             	test   %sil,%sil
+  803670:	75 2e                	jne    8036a0 <vprintfmt+0x4e5>
+    switch (lflag) {
+  803672:	85 d2                	test   %edx,%edx
+  803674:	0f 84 b3 00 00 00    	je     80372d <vprintfmt+0x572>
+  80367a:	83 fa 01             	cmp    $0x1,%edx
+  80367d:	0f 84 d3 00 00 00    	je     803756 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  803683:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803686:	83 f8 2f             	cmp    $0x2f,%eax
+  803689:	0f 87 f1 00 00 00    	ja     803780 <vprintfmt+0x5c5>
+  80368f:	89 c2                	mov    %eax,%edx
+  803691:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803695:	83 c0 08             	add    $0x8,%eax
+  803698:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80369b:	48 8b 02             	mov    (%rdx),%rax
+  80369e:	eb 17                	jmp    8036b7 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8036a6:	77 77                	ja     80371f <vprintfmt+0x564>
+  8036a8:	89 c2                	mov    %eax,%edx
+  8036aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036ae:	83 c0 08             	add    $0x8,%eax
+  8036b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036b4:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8036b7:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036b9:	83 f8 07             	cmp    $0x7,%eax
+  8036bc:	0f 8e cf 00 00 00    	jle    803791 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8036c2:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036c8:	44 89 e7             	mov    %r12d,%edi
+  8036cb:	41 c1 e4 03          	shl    $0x3,%r12d
+  8036cf:	89 d1                	mov    %edx,%ecx
+  8036d1:	8d 72 07             	lea    0x7(%rdx),%esi
+  8036d4:	85 d2                	test   %edx,%edx
+  8036d6:	0f 48 d6             	cmovs  %esi,%edx
+  8036d9:	c1 fa 03             	sar    $0x3,%edx
+  8036dc:	83 f9 3f             	cmp    $0x3f,%ecx
+  8036df:	7f e7                	jg     8036c8 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8036e1:	85 ff                	test   %edi,%edi
+  8036e3:	0f 84 03 fb ff ff    	je     8031ec <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8036e9:	49 63 f4             	movslq %r12d,%rsi
+  8036ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036f1:	48 f7 f6             	div    %rsi
+  8036f4:	49 89 d7             	mov    %rdx,%r15
+  8036f7:	83 c0 30             	add    $0x30,%eax
+  8036fa:	0f be f8             	movsbl %al,%edi
+  8036fd:	4c 89 ee             	mov    %r13,%rsi
+  803700:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  803703:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  803706:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  80370b:	45 85 e4             	test   %r12d,%r12d
+  80370e:	41 0f 49 d4          	cmovns %r12d,%edx
+  803712:	c1 fa 03             	sar    $0x3,%edx
+  803715:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  803718:	75 cf                	jne    8036e9 <vprintfmt+0x52e>
+  80371a:	e9 cd fa ff ff       	jmp    8031ec <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80371f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803723:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803727:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80372b:	eb 87                	jmp    8036b4 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80372d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803730:	83 f8 2f             	cmp    $0x2f,%eax
+  803733:	77 13                	ja     803748 <vprintfmt+0x58d>
+  803735:	89 c2                	mov    %eax,%edx
+  803737:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80373b:	83 c0 08             	add    $0x8,%eax
+  80373e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803741:	8b 02                	mov    (%rdx),%eax
+  803743:	e9 6f ff ff ff       	jmp    8036b7 <vprintfmt+0x4fc>
+  803748:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80374c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803750:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803754:	eb eb                	jmp    803741 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  803756:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803759:	83 f8 2f             	cmp    $0x2f,%eax
+  80375c:	77 14                	ja     803772 <vprintfmt+0x5b7>
+  80375e:	89 c2                	mov    %eax,%edx
+  803760:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803764:	83 c0 08             	add    $0x8,%eax
+  803767:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80376a:	48 8b 02             	mov    (%rdx),%rax
+  80376d:	e9 45 ff ff ff       	jmp    8036b7 <vprintfmt+0x4fc>
+  803772:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803776:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80377a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80377e:	eb ea                	jmp    80376a <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  803780:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803784:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803788:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80378c:	e9 0a ff ff ff       	jmp    80369b <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  803791:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  803797:	e9 4d ff ff ff       	jmp    8036e9 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  80379c:	4c 89 ee             	mov    %r13,%rsi
+  80379f:	bf 30 00 00 00       	mov    $0x30,%edi
+  8037a4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8037a7:	4c 89 ee             	mov    %r13,%rsi
+  8037aa:	bf 78 00 00 00       	mov    $0x78,%edi
+  8037af:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8037b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8037b8:	77 47                	ja     803801 <vprintfmt+0x646>
+  8037ba:	89 c2                	mov    %eax,%edx
+  8037bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037c0:	83 c0 08             	add    $0x8,%eax
+  8037c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037c6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8037c9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8037ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8037d2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8037d6:	0f 94 c0             	sete   %al
+  8037d9:	0f b6 c0             	movzbl %al,%eax
+  8037dc:	50                   	push   %rax
+  8037dd:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8037e2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8037e6:	4c 89 ee             	mov    %r13,%rsi
+  8037e9:	4c 89 f7             	mov    %r14,%rdi
+  8037ec:	48 b8 b0 30 80 00 00 	movabs $0x8030b0,%rax
+  8037f3:	00 00 00 
+  8037f6:	ff d0                	call   *%rax
+            break;
+  8037f8:	48 83 c4 10          	add    $0x10,%rsp
+  8037fc:	e9 eb f9 ff ff       	jmp    8031ec <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803801:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803805:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803809:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80380d:	eb b7                	jmp    8037c6 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  80380f:	40 84 f6             	test   %sil,%sil
+  803812:	75 2b                	jne    80383f <vprintfmt+0x684>
+    switch (lflag) {
+  803814:	85 d2                	test   %edx,%edx
+  803816:	74 56                	je     80386e <vprintfmt+0x6b3>
+  803818:	83 fa 01             	cmp    $0x1,%edx
+  80381b:	74 7f                	je     80389c <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  80381d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803820:	83 f8 2f             	cmp    $0x2f,%eax
+  803823:	0f 87 a2 00 00 00    	ja     8038cb <vprintfmt+0x710>
+  803829:	89 c2                	mov    %eax,%edx
+  80382b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80382f:	83 c0 08             	add    $0x8,%eax
+  803832:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803835:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803838:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80383d:	eb 8f                	jmp    8037ce <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80383f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803842:	83 f8 2f             	cmp    $0x2f,%eax
+  803845:	77 19                	ja     803860 <vprintfmt+0x6a5>
+  803847:	89 c2                	mov    %eax,%edx
+  803849:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80384d:	83 c0 08             	add    $0x8,%eax
+  803850:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803853:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803856:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80385b:	e9 6e ff ff ff       	jmp    8037ce <vprintfmt+0x613>
+  803860:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803864:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803868:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80386c:	eb e5                	jmp    803853 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  80386e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803871:	83 f8 2f             	cmp    $0x2f,%eax
+  803874:	77 18                	ja     80388e <vprintfmt+0x6d3>
+  803876:	89 c2                	mov    %eax,%edx
+  803878:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80387c:	83 c0 08             	add    $0x8,%eax
+  80387f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803882:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803884:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803889:	e9 40 ff ff ff       	jmp    8037ce <vprintfmt+0x613>
+  80388e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803892:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803896:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80389a:	eb e6                	jmp    803882 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  80389c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80389f:	83 f8 2f             	cmp    $0x2f,%eax
+  8038a2:	77 19                	ja     8038bd <vprintfmt+0x702>
+  8038a4:	89 c2                	mov    %eax,%edx
+  8038a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038aa:	83 c0 08             	add    $0x8,%eax
+  8038ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038b0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038b3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8038b8:	e9 11 ff ff ff       	jmp    8037ce <vprintfmt+0x613>
+  8038bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038c9:	eb e5                	jmp    8038b0 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  8038cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038d7:	e9 59 ff ff ff       	jmp    803835 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8038dc:	4c 89 ee             	mov    %r13,%rsi
+  8038df:	bf 25 00 00 00       	mov    $0x25,%edi
+  8038e4:	41 ff d6             	call   *%r14
+            break;
+  8038e7:	e9 00 f9 ff ff       	jmp    8031ec <vprintfmt+0x31>
+            putch('%', put_arg);
+  8038ec:	4c 89 ee             	mov    %r13,%rsi
+  8038ef:	bf 25 00 00 00       	mov    $0x25,%edi
+  8038f4:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8038f7:	48 83 eb 01          	sub    $0x1,%rbx
+  8038fb:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8038ff:	75 f6                	jne    8038f7 <vprintfmt+0x73c>
+  803901:	e9 e6 f8 ff ff       	jmp    8031ec <vprintfmt+0x31>
+}
+  803906:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80390a:	5b                   	pop    %rbx
+  80390b:	41 5c                	pop    %r12
+  80390d:	41 5d                	pop    %r13
+  80390f:	41 5e                	pop    %r14
+  803911:	41 5f                	pop    %r15
+  803913:	5d                   	pop    %rbp
+  803914:	c3                   	ret
+
+0000000000803915 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803915:	55                   	push   %rbp
+  803916:	48 89 e5             	mov    %rsp,%rbp
+  803919:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80391d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803921:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803926:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80392a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803931:	48 85 ff             	test   %rdi,%rdi
+  803934:	74 2b                	je     803961 <vsnprintf+0x4c>
+  803936:	48 85 f6             	test   %rsi,%rsi
+  803939:	74 26                	je     803961 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80393b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80393f:	48 bf 66 31 80 00 00 	movabs $0x803166,%rdi
+  803946:	00 00 00 
+  803949:	48 b8 bb 31 80 00 00 	movabs $0x8031bb,%rax
+  803950:	00 00 00 
+  803953:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803955:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803959:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80395c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80395f:	c9                   	leave
+  803960:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803961:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803966:	eb f7                	jmp    80395f <vsnprintf+0x4a>
+
+0000000000803968 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803968:	55                   	push   %rbp
+  803969:	48 89 e5             	mov    %rsp,%rbp
+  80396c:	48 83 ec 50          	sub    $0x50,%rsp
+  803970:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803974:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803978:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80397c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803983:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803987:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80398b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80398f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803993:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803997:	48 b8 15 39 80 00 00 	movabs $0x803915,%rax
+  80399e:	00 00 00 
+  8039a1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8039a3:	c9                   	leave
+  8039a4:	c3                   	ret
+
+00000000008039a5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8039a5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8039a8:	74 10                	je     8039ba <strlen+0x15>
+    size_t n = 0;
+  8039aa:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8039af:	48 83 c0 01          	add    $0x1,%rax
+  8039b3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8039b7:	75 f6                	jne    8039af <strlen+0xa>
+  8039b9:	c3                   	ret
+    size_t n = 0;
+  8039ba:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8039bf:	c3                   	ret
+
+00000000008039c0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8039c0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8039c3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8039c8:	48 85 f6             	test   %rsi,%rsi
+  8039cb:	74 11                	je     8039de <strnlen+0x1e>
+  8039cd:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8039d1:	74 0c                	je     8039df <strnlen+0x1f>
+  8039d3:	48 83 c2 01          	add    $0x1,%rdx
+  8039d7:	48 39 d0             	cmp    %rdx,%rax
+  8039da:	75 f1                	jne    8039cd <strnlen+0xd>
+  8039dc:	eb 04                	jmp    8039e2 <strnlen+0x22>
+  8039de:	c3                   	ret
+  8039df:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8039e2:	c3                   	ret
+
+00000000008039e3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8039e3:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8039e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039eb:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8039ef:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8039f2:	48 83 c2 01          	add    $0x1,%rdx
+  8039f6:	84 c9                	test   %cl,%cl
+  8039f8:	75 f1                	jne    8039eb <strcpy+0x8>
+        ;
+    return res;
+}
+  8039fa:	c3                   	ret
+
+00000000008039fb <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8039fb:	55                   	push   %rbp
+  8039fc:	48 89 e5             	mov    %rsp,%rbp
+  8039ff:	41 54                	push   %r12
+  803a01:	53                   	push   %rbx
+  803a02:	48 89 fb             	mov    %rdi,%rbx
+  803a05:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a08:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  803a0f:	00 00 00 
+  803a12:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a14:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a18:	4c 89 e6             	mov    %r12,%rsi
+  803a1b:	48 b8 e3 39 80 00 00 	movabs $0x8039e3,%rax
+  803a22:	00 00 00 
+  803a25:	ff d0                	call   *%rax
+    return dst;
+}
+  803a27:	48 89 d8             	mov    %rbx,%rax
+  803a2a:	5b                   	pop    %rbx
+  803a2b:	41 5c                	pop    %r12
+  803a2d:	5d                   	pop    %rbp
+  803a2e:	c3                   	ret
+
+0000000000803a2f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803a2f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803a32:	48 85 d2             	test   %rdx,%rdx
+  803a35:	74 1f                	je     803a56 <strncpy+0x27>
+  803a37:	48 01 fa             	add    %rdi,%rdx
+  803a3a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803a3d:	48 83 c1 01          	add    $0x1,%rcx
+  803a41:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803a45:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803a49:	41 80 f8 01          	cmp    $0x1,%r8b
+  803a4d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803a51:	48 39 ca             	cmp    %rcx,%rdx
+  803a54:	75 e7                	jne    803a3d <strncpy+0xe>
+    }
+    return ret;
+}
+  803a56:	c3                   	ret
+
+0000000000803a57 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803a57:	48 89 f8             	mov    %rdi,%rax
+  803a5a:	48 85 d2             	test   %rdx,%rdx
+  803a5d:	74 24                	je     803a83 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803a5f:	48 83 ea 01          	sub    $0x1,%rdx
+  803a63:	74 1b                	je     803a80 <strlcpy+0x29>
+  803a65:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803a69:	0f b6 16             	movzbl (%rsi),%edx
+  803a6c:	84 d2                	test   %dl,%dl
+  803a6e:	74 10                	je     803a80 <strlcpy+0x29>
+            *dst++ = *src++;
+  803a70:	48 83 c6 01          	add    $0x1,%rsi
+  803a74:	48 83 c0 01          	add    $0x1,%rax
+  803a78:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803a7b:	48 39 c8             	cmp    %rcx,%rax
+  803a7e:	75 e9                	jne    803a69 <strlcpy+0x12>
+        *dst = '\0';
+  803a80:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803a83:	48 29 f8             	sub    %rdi,%rax
+}
+  803a86:	c3                   	ret
+
+0000000000803a87 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803a87:	0f b6 07             	movzbl (%rdi),%eax
+  803a8a:	84 c0                	test   %al,%al
+  803a8c:	74 13                	je     803aa1 <strcmp+0x1a>
+  803a8e:	38 06                	cmp    %al,(%rsi)
+  803a90:	75 0f                	jne    803aa1 <strcmp+0x1a>
+  803a92:	48 83 c7 01          	add    $0x1,%rdi
+  803a96:	48 83 c6 01          	add    $0x1,%rsi
+  803a9a:	0f b6 07             	movzbl (%rdi),%eax
+  803a9d:	84 c0                	test   %al,%al
+  803a9f:	75 ed                	jne    803a8e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803aa1:	0f b6 c0             	movzbl %al,%eax
+  803aa4:	0f b6 16             	movzbl (%rsi),%edx
+  803aa7:	29 d0                	sub    %edx,%eax
+}
+  803aa9:	c3                   	ret
+
+0000000000803aaa <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803aaa:	48 85 d2             	test   %rdx,%rdx
+  803aad:	74 1f                	je     803ace <strncmp+0x24>
+  803aaf:	0f b6 07             	movzbl (%rdi),%eax
+  803ab2:	84 c0                	test   %al,%al
+  803ab4:	74 1e                	je     803ad4 <strncmp+0x2a>
+  803ab6:	3a 06                	cmp    (%rsi),%al
+  803ab8:	75 1a                	jne    803ad4 <strncmp+0x2a>
+  803aba:	48 83 c7 01          	add    $0x1,%rdi
+  803abe:	48 83 c6 01          	add    $0x1,%rsi
+  803ac2:	48 83 ea 01          	sub    $0x1,%rdx
+  803ac6:	75 e7                	jne    803aaf <strncmp+0x5>
+
+    if (!n) return 0;
+  803ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803acd:	c3                   	ret
+  803ace:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad3:	c3                   	ret
+  803ad4:	48 85 d2             	test   %rdx,%rdx
+  803ad7:	74 09                	je     803ae2 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ad9:	0f b6 07             	movzbl (%rdi),%eax
+  803adc:	0f b6 16             	movzbl (%rsi),%edx
+  803adf:	29 d0                	sub    %edx,%eax
+  803ae1:	c3                   	ret
+    if (!n) return 0;
+  803ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ae7:	c3                   	ret
+
+0000000000803ae8 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803ae8:	0f b6 17             	movzbl (%rdi),%edx
+  803aeb:	84 d2                	test   %dl,%dl
+  803aed:	74 18                	je     803b07 <strchr+0x1f>
+        if (*str == c) {
+  803aef:	0f be d2             	movsbl %dl,%edx
+  803af2:	39 f2                	cmp    %esi,%edx
+  803af4:	74 17                	je     803b0d <strchr+0x25>
+    for (; *str; str++) {
+  803af6:	48 83 c7 01          	add    $0x1,%rdi
+  803afa:	0f b6 17             	movzbl (%rdi),%edx
+  803afd:	84 d2                	test   %dl,%dl
+  803aff:	75 ee                	jne    803aef <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b06:	c3                   	ret
+  803b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0c:	c3                   	ret
+  803b0d:	48 89 f8             	mov    %rdi,%rax
+}
+  803b10:	c3                   	ret
+
+0000000000803b11 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b11:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b14:	0f b6 17             	movzbl (%rdi),%edx
+  803b17:	84 d2                	test   %dl,%dl
+  803b19:	74 13                	je     803b2e <strfind+0x1d>
+  803b1b:	0f be d2             	movsbl %dl,%edx
+  803b1e:	39 f2                	cmp    %esi,%edx
+  803b20:	74 0b                	je     803b2d <strfind+0x1c>
+  803b22:	48 83 c0 01          	add    $0x1,%rax
+  803b26:	0f b6 10             	movzbl (%rax),%edx
+  803b29:	84 d2                	test   %dl,%dl
+  803b2b:	75 ee                	jne    803b1b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803b2d:	c3                   	ret
+  803b2e:	c3                   	ret
+
+0000000000803b2f <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803b2f:	55                   	push   %rbp
+  803b30:	48 89 e5             	mov    %rsp,%rbp
+  803b33:	41 57                	push   %r15
+  803b35:	41 56                	push   %r14
+  803b37:	41 55                	push   %r13
+  803b39:	41 54                	push   %r12
+  803b3b:	53                   	push   %rbx
+  803b3c:	48 83 ec 08          	sub    $0x8,%rsp
+  803b40:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803b43:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803b47:	45 84 ed             	test   %r13b,%r13b
+  803b4a:	75 12                	jne    803b5e <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803b4c:	4c 89 f8             	mov    %r15,%rax
+  803b4f:	48 83 c4 08          	add    $0x8,%rsp
+  803b53:	5b                   	pop    %rbx
+  803b54:	41 5c                	pop    %r12
+  803b56:	41 5d                	pop    %r13
+  803b58:	41 5e                	pop    %r14
+  803b5a:	41 5f                	pop    %r15
+  803b5c:	5d                   	pop    %rbp
+  803b5d:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803b5e:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803b62:	4c 89 e7             	mov    %r12,%rdi
+  803b65:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  803b6c:	00 00 00 
+  803b6f:	ff d0                	call   *%rax
+  803b71:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803b74:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803b78:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803b7c:	49 bf aa 3a 80 00 00 	movabs $0x803aaa,%r15
+  803b83:	00 00 00 
+				if ((sc = *s++) == 0)
+  803b86:	84 c0                	test   %al,%al
+  803b88:	75 14                	jne    803b9e <strstr+0x6f>
+					return NULL;
+  803b8a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803b90:	eb ba                	jmp    803b4c <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803b92:	48 83 c3 01          	add    $0x1,%rbx
+  803b96:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803b9a:	84 c0                	test   %al,%al
+  803b9c:	74 1b                	je     803bb9 <strstr+0x8a>
+			} while (sc != c);
+  803b9e:	41 38 c5             	cmp    %al,%r13b
+  803ba1:	75 ef                	jne    803b92 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803ba3:	4c 89 f2             	mov    %r14,%rdx
+  803ba6:	4c 89 e6             	mov    %r12,%rsi
+  803ba9:	48 89 df             	mov    %rbx,%rdi
+  803bac:	41 ff d7             	call   *%r15
+  803baf:	85 c0                	test   %eax,%eax
+  803bb1:	75 df                	jne    803b92 <strstr+0x63>
+  803bb3:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803bb7:	eb 93                	jmp    803b4c <strstr+0x1d>
+					return NULL;
+  803bb9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bbf:	eb 8b                	jmp    803b4c <strstr+0x1d>
+
+0000000000803bc1 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803bc1:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803bc3:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803bc6:	8d 57 20             	lea    0x20(%rdi),%edx
+  803bc9:	83 f9 1a             	cmp    $0x1a,%ecx
+  803bcc:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803bcf:	c3                   	ret
+
+0000000000803bd0 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803bd0:	55                   	push   %rbp
+  803bd1:	48 89 e5             	mov    %rsp,%rbp
+  803bd4:	41 57                	push   %r15
+  803bd6:	41 56                	push   %r14
+  803bd8:	41 55                	push   %r13
+  803bda:	41 54                	push   %r12
+  803bdc:	53                   	push   %rbx
+  803bdd:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803be1:	48 39 f7             	cmp    %rsi,%rdi
+  803be4:	74 49                	je     803c2f <strcasecmp+0x5f>
+  803be6:	49 89 fd             	mov    %rdi,%r13
+  803be9:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803bec:	49 bf c1 3b 80 00 00 	movabs $0x803bc1,%r15
+  803bf3:	00 00 00 
+  803bf6:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803bfb:	41 0f b6 fe          	movzbl %r14b,%edi
+  803bff:	41 ff d7             	call   *%r15
+  803c02:	89 c3                	mov    %eax,%ebx
+  803c04:	49 83 c4 01          	add    $0x1,%r12
+  803c08:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c0e:	41 ff d7             	call   *%r15
+  803c11:	29 c3                	sub    %eax,%ebx
+  803c13:	75 09                	jne    803c1e <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c15:	49 83 c5 01          	add    $0x1,%r13
+  803c19:	45 84 f6             	test   %r14b,%r14b
+  803c1c:	75 d8                	jne    803bf6 <strcasecmp+0x26>
+}
+  803c1e:	89 d8                	mov    %ebx,%eax
+  803c20:	48 83 c4 08          	add    $0x8,%rsp
+  803c24:	5b                   	pop    %rbx
+  803c25:	41 5c                	pop    %r12
+  803c27:	41 5d                	pop    %r13
+  803c29:	41 5e                	pop    %r14
+  803c2b:	41 5f                	pop    %r15
+  803c2d:	5d                   	pop    %rbp
+  803c2e:	c3                   	ret
+        return 0;
+  803c2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c34:	eb e8                	jmp    803c1e <strcasecmp+0x4e>
+
+0000000000803c36 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c36:	55                   	push   %rbp
+  803c37:	48 89 e5             	mov    %rsp,%rbp
+  803c3a:	41 57                	push   %r15
+  803c3c:	41 56                	push   %r14
+  803c3e:	41 55                	push   %r13
+  803c40:	41 54                	push   %r12
+  803c42:	53                   	push   %rbx
+  803c43:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803c47:	48 85 d2             	test   %rdx,%rdx
+  803c4a:	74 4f                	je     803c9b <strncasecmp+0x65>
+  803c4c:	49 89 fc             	mov    %rdi,%r12
+  803c4f:	49 89 f5             	mov    %rsi,%r13
+  803c52:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803c56:	49 be c1 3b 80 00 00 	movabs $0x803bc1,%r14
+  803c5d:	00 00 00 
+  803c60:	49 83 c4 01          	add    $0x1,%r12
+  803c64:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c6a:	41 ff d6             	call   *%r14
+  803c6d:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803c6f:	49 83 c5 01          	add    $0x1,%r13
+  803c73:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803c78:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803c7b:	29 c3                	sub    %eax,%ebx
+  803c7d:	85 c0                	test   %eax,%eax
+  803c7f:	74 09                	je     803c8a <strncasecmp+0x54>
+  803c81:	85 db                	test   %ebx,%ebx
+  803c83:	75 05                	jne    803c8a <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803c85:	4d 39 fc             	cmp    %r15,%r12
+  803c88:	75 d6                	jne    803c60 <strncasecmp+0x2a>
+}
+  803c8a:	89 d8                	mov    %ebx,%eax
+  803c8c:	48 83 c4 08          	add    $0x8,%rsp
+  803c90:	5b                   	pop    %rbx
+  803c91:	41 5c                	pop    %r12
+  803c93:	41 5d                	pop    %r13
+  803c95:	41 5e                	pop    %r14
+  803c97:	41 5f                	pop    %r15
+  803c99:	5d                   	pop    %rbp
+  803c9a:	c3                   	ret
+    int d = 0;
+  803c9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803ca0:	eb e8                	jmp    803c8a <strncasecmp+0x54>
+
+0000000000803ca2 <toupper>:
+
+int toupper(int c) {
+  803ca2:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803ca4:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803ca7:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803caa:	83 f9 1a             	cmp    $0x1a,%ecx
+  803cad:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803cb0:	c3                   	ret
+
+0000000000803cb1 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803cb1:	83 ff 20             	cmp    $0x20,%edi
+  803cb4:	0f 94 c0             	sete   %al
+  803cb7:	0f b6 c0             	movzbl %al,%eax
+}
+  803cba:	c3                   	ret
+
+0000000000803cbb <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803cbb:	89 f8                	mov    %edi,%eax
+  803cbd:	f7 d8                	neg    %eax
+  803cbf:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803cc2:	c3                   	ret
+
+0000000000803cc3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803cc3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803cc6:	48 89 f8             	mov    %rdi,%rax
+  803cc9:	48 f7 d8             	neg    %rax
+  803ccc:	83 e0 07             	and    $0x7,%eax
+  803ccf:	49 89 d1             	mov    %rdx,%r9
+  803cd2:	49 29 c1             	sub    %rax,%r9
+  803cd5:	78 36                	js     803d0d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803cd7:	40 0f b6 c6          	movzbl %sil,%eax
+  803cdb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803ce2:	01 01 01 
+  803ce5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803ce9:	40 f6 c7 07          	test   $0x7,%dil
+  803ced:	75 38                	jne    803d27 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803cef:	4c 89 c9             	mov    %r9,%rcx
+  803cf2:	48 c1 f9 03          	sar    $0x3,%rcx
+  803cf6:	74 0c                	je     803d04 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803cf8:	fc                   	cld
+  803cf9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803cfc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d00:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d04:	4d 85 c9             	test   %r9,%r9
+  803d07:	75 45                	jne    803d4e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d09:	4c 89 c0             	mov    %r8,%rax
+  803d0c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d0d:	48 85 d2             	test   %rdx,%rdx
+  803d10:	74 f7                	je     803d09 <memset+0x46>
+  803d12:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d15:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d18:	48 83 c0 01          	add    $0x1,%rax
+  803d1c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d20:	48 39 c2             	cmp    %rax,%rdx
+  803d23:	75 f3                	jne    803d18 <memset+0x55>
+  803d25:	eb e2                	jmp    803d09 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d27:	40 f6 c7 01          	test   $0x1,%dil
+  803d2b:	74 06                	je     803d33 <memset+0x70>
+  803d2d:	88 07                	mov    %al,(%rdi)
+  803d2f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d33:	40 f6 c7 02          	test   $0x2,%dil
+  803d37:	74 07                	je     803d40 <memset+0x7d>
+  803d39:	66 89 07             	mov    %ax,(%rdi)
+  803d3c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d40:	40 f6 c7 04          	test   $0x4,%dil
+  803d44:	74 a9                	je     803cef <memset+0x2c>
+  803d46:	89 07                	mov    %eax,(%rdi)
+  803d48:	48 83 c7 04          	add    $0x4,%rdi
+  803d4c:	eb a1                	jmp    803cef <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d4e:	41 f6 c1 04          	test   $0x4,%r9b
+  803d52:	74 06                	je     803d5a <memset+0x97>
+  803d54:	89 07                	mov    %eax,(%rdi)
+  803d56:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d5a:	41 f6 c1 02          	test   $0x2,%r9b
+  803d5e:	74 07                	je     803d67 <memset+0xa4>
+  803d60:	66 89 07             	mov    %ax,(%rdi)
+  803d63:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803d67:	41 f6 c1 01          	test   $0x1,%r9b
+  803d6b:	74 9c                	je     803d09 <memset+0x46>
+  803d6d:	88 07                	mov    %al,(%rdi)
+  803d6f:	eb 98                	jmp    803d09 <memset+0x46>
+
+0000000000803d71 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803d71:	48 89 f8             	mov    %rdi,%rax
+  803d74:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803d77:	48 39 fe             	cmp    %rdi,%rsi
+  803d7a:	73 3b                	jae    803db7 <memmove+0x46>
+  803d7c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803d80:	48 39 d7             	cmp    %rdx,%rdi
+  803d83:	73 32                	jae    803db7 <memmove+0x46>
+        s += n;
+        d += n;
+  803d85:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803d89:	48 89 d6             	mov    %rdx,%rsi
+  803d8c:	48 09 fe             	or     %rdi,%rsi
+  803d8f:	48 09 ce             	or     %rcx,%rsi
+  803d92:	40 f6 c6 07          	test   $0x7,%sil
+  803d96:	75 12                	jne    803daa <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803d98:	48 83 ef 08          	sub    $0x8,%rdi
+  803d9c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803da0:	48 c1 e9 03          	shr    $0x3,%rcx
+  803da4:	fd                   	std
+  803da5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803da8:	fc                   	cld
+  803da9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803daa:	48 83 ef 01          	sub    $0x1,%rdi
+  803dae:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803db2:	fd                   	std
+  803db3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803db5:	eb f1                	jmp    803da8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803db7:	48 89 f2             	mov    %rsi,%rdx
+  803dba:	48 09 c2             	or     %rax,%rdx
+  803dbd:	48 09 ca             	or     %rcx,%rdx
+  803dc0:	f6 c2 07             	test   $0x7,%dl
+  803dc3:	75 0c                	jne    803dd1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803dc5:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dc9:	48 89 c7             	mov    %rax,%rdi
+  803dcc:	fc                   	cld
+  803dcd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803dd0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803dd1:	48 89 c7             	mov    %rax,%rdi
+  803dd4:	fc                   	cld
+  803dd5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803dd7:	c3                   	ret
+
+0000000000803dd8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803dd8:	55                   	push   %rbp
+  803dd9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803ddc:	48 b8 71 3d 80 00 00 	movabs $0x803d71,%rax
+  803de3:	00 00 00 
+  803de6:	ff d0                	call   *%rax
+}
+  803de8:	5d                   	pop    %rbp
+  803de9:	c3                   	ret
+
+0000000000803dea <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803dea:	55                   	push   %rbp
+  803deb:	48 89 e5             	mov    %rsp,%rbp
+  803dee:	41 57                	push   %r15
+  803df0:	41 56                	push   %r14
+  803df2:	41 55                	push   %r13
+  803df4:	41 54                	push   %r12
+  803df6:	53                   	push   %rbx
+  803df7:	48 83 ec 08          	sub    $0x8,%rsp
+  803dfb:	49 89 fe             	mov    %rdi,%r14
+  803dfe:	49 89 f7             	mov    %rsi,%r15
+  803e01:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e04:	48 89 f7             	mov    %rsi,%rdi
+  803e07:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  803e0e:	00 00 00 
+  803e11:	ff d0                	call   *%rax
+  803e13:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e16:	48 89 de             	mov    %rbx,%rsi
+  803e19:	4c 89 f7             	mov    %r14,%rdi
+  803e1c:	48 b8 c0 39 80 00 00 	movabs $0x8039c0,%rax
+  803e23:	00 00 00 
+  803e26:	ff d0                	call   *%rax
+  803e28:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e2b:	48 39 c3             	cmp    %rax,%rbx
+  803e2e:	74 36                	je     803e66 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e30:	48 89 d8             	mov    %rbx,%rax
+  803e33:	4c 29 e8             	sub    %r13,%rax
+  803e36:	49 39 c4             	cmp    %rax,%r12
+  803e39:	73 31                	jae    803e6c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803e3b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803e40:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e44:	4c 89 fe             	mov    %r15,%rsi
+  803e47:	48 b8 d8 3d 80 00 00 	movabs $0x803dd8,%rax
+  803e4e:	00 00 00 
+  803e51:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803e53:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803e57:	48 83 c4 08          	add    $0x8,%rsp
+  803e5b:	5b                   	pop    %rbx
+  803e5c:	41 5c                	pop    %r12
+  803e5e:	41 5d                	pop    %r13
+  803e60:	41 5e                	pop    %r14
+  803e62:	41 5f                	pop    %r15
+  803e64:	5d                   	pop    %rbp
+  803e65:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e66:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803e6a:	eb eb                	jmp    803e57 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803e6c:	48 83 eb 01          	sub    $0x1,%rbx
+  803e70:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e74:	48 89 da             	mov    %rbx,%rdx
+  803e77:	4c 89 fe             	mov    %r15,%rsi
+  803e7a:	48 b8 d8 3d 80 00 00 	movabs $0x803dd8,%rax
+  803e81:	00 00 00 
+  803e84:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803e86:	49 01 de             	add    %rbx,%r14
+  803e89:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803e8e:	eb c3                	jmp    803e53 <strlcat+0x69>
+
+0000000000803e90 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803e90:	48 85 d2             	test   %rdx,%rdx
+  803e93:	74 2d                	je     803ec2 <memcmp+0x32>
+  803e95:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803e9a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803e9e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803ea3:	44 38 c1             	cmp    %r8b,%cl
+  803ea6:	75 0f                	jne    803eb7 <memcmp+0x27>
+    while (n-- > 0) {
+  803ea8:	48 83 c0 01          	add    $0x1,%rax
+  803eac:	48 39 c2             	cmp    %rax,%rdx
+  803eaf:	75 e9                	jne    803e9a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803eb7:	0f b6 c1             	movzbl %cl,%eax
+  803eba:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803ebe:	44 29 c0             	sub    %r8d,%eax
+  803ec1:	c3                   	ret
+    return 0;
+  803ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ec7:	c3                   	ret
+
+0000000000803ec8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803ec8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803ecc:	48 39 c7             	cmp    %rax,%rdi
+  803ecf:	73 0f                	jae    803ee0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803ed1:	40 38 37             	cmp    %sil,(%rdi)
+  803ed4:	74 0e                	je     803ee4 <memfind+0x1c>
+    for (; src < end; src++) {
+  803ed6:	48 83 c7 01          	add    $0x1,%rdi
+  803eda:	48 39 f8             	cmp    %rdi,%rax
+  803edd:	75 f2                	jne    803ed1 <memfind+0x9>
+  803edf:	c3                   	ret
+  803ee0:	48 89 f8             	mov    %rdi,%rax
+  803ee3:	c3                   	ret
+  803ee4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803ee7:	c3                   	ret
+
+0000000000803ee8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803ee8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803eeb:	0f b6 37             	movzbl (%rdi),%esi
+  803eee:	40 80 fe 20          	cmp    $0x20,%sil
+  803ef2:	74 06                	je     803efa <strtol+0x12>
+  803ef4:	40 80 fe 09          	cmp    $0x9,%sil
+  803ef8:	75 13                	jne    803f0d <strtol+0x25>
+  803efa:	48 83 c7 01          	add    $0x1,%rdi
+  803efe:	0f b6 37             	movzbl (%rdi),%esi
+  803f01:	40 80 fe 20          	cmp    $0x20,%sil
+  803f05:	74 f3                	je     803efa <strtol+0x12>
+  803f07:	40 80 fe 09          	cmp    $0x9,%sil
+  803f0b:	74 ed                	je     803efa <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f0d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f10:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f13:	3c 01                	cmp    $0x1,%al
+  803f15:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f19:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f1f:	75 0f                	jne    803f30 <strtol+0x48>
+  803f21:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f24:	74 14                	je     803f3a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f26:	85 d2                	test   %edx,%edx
+  803f28:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f2d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f30:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803f35:	4c 63 ca             	movslq %edx,%r9
+  803f38:	eb 36                	jmp    803f70 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f3a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803f3e:	74 0f                	je     803f4f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803f40:	85 d2                	test   %edx,%edx
+  803f42:	75 ec                	jne    803f30 <strtol+0x48>
+        s++;
+  803f44:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803f48:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803f4d:	eb e1                	jmp    803f30 <strtol+0x48>
+        s += 2;
+  803f4f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803f53:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803f58:	eb d6                	jmp    803f30 <strtol+0x48>
+            dig -= '0';
+  803f5a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803f5d:	44 0f b6 c1          	movzbl %cl,%r8d
+  803f61:	41 39 d0             	cmp    %edx,%r8d
+  803f64:	7d 21                	jge    803f87 <strtol+0x9f>
+        val = val * base + dig;
+  803f66:	49 0f af c1          	imul   %r9,%rax
+  803f6a:	0f b6 c9             	movzbl %cl,%ecx
+  803f6d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803f70:	48 83 c7 01          	add    $0x1,%rdi
+  803f74:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803f78:	80 f9 39             	cmp    $0x39,%cl
+  803f7b:	76 dd                	jbe    803f5a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803f7d:	80 f9 7b             	cmp    $0x7b,%cl
+  803f80:	77 05                	ja     803f87 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803f82:	83 e9 57             	sub    $0x57,%ecx
+  803f85:	eb d6                	jmp    803f5d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803f87:	4d 85 d2             	test   %r10,%r10
+  803f8a:	74 03                	je     803f8f <strtol+0xa7>
+  803f8c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803f8f:	48 89 c2             	mov    %rax,%rdx
+  803f92:	48 f7 da             	neg    %rdx
+  803f95:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803f99:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803f9d:	c3                   	ret
+
+0000000000803f9e <atoi>:
+int atoi(const char *str) {
+  803f9e:	55                   	push   %rbp
+  803f9f:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  803fa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fa7:	be 00 00 00 00       	mov    $0x0,%esi
+  803fac:	48 b8 e8 3e 80 00 00 	movabs $0x803ee8,%rax
+  803fb3:	00 00 00 
+  803fb6:	ff d0                	call   *%rax
+}
+  803fb8:	5d                   	pop    %rbp
+  803fb9:	c3                   	ret
+
+0000000000803fba <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fba:	55                   	push   %rbp
+  803fbb:	48 89 e5             	mov    %rsp,%rbp
+  803fbe:	41 55                	push   %r13
+  803fc0:	41 54                	push   %r12
+  803fc2:	53                   	push   %rbx
+  803fc3:	48 83 ec 08          	sub    $0x8,%rsp
+  803fc7:	49 89 fc             	mov    %rdi,%r12
+  803fca:	48 89 f7             	mov    %rsi,%rdi
+  803fcd:	48 89 d3             	mov    %rdx,%rbx
+  803fd0:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803fd3:	48 85 f6             	test   %rsi,%rsi
+  803fd6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fdd:	00 00 00 
+  803fe0:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  803fe4:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fe9:	48 85 d2             	test   %rdx,%rdx
+  803fec:	74 03                	je     803ff1 <ipc_recv+0x37>
+  803fee:	48 8b 32             	mov    (%rdx),%rsi
+  803ff1:	48 b8 29 06 80 00 00 	movabs $0x800629,%rax
+  803ff8:	00 00 00 
+  803ffb:	ff d0                	call   *%rax
+    if (errno) {
+  803ffd:	85 c0                	test   %eax,%eax
+  803fff:	74 1c                	je     80401d <ipc_recv+0x63>
+        if (from_env_store)
+  804001:	4d 85 e4             	test   %r12,%r12
+  804004:	74 08                	je     80400e <ipc_recv+0x54>
+            *from_env_store = 0;
+  804006:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80400d:	00 
+
+        if (perm_store)
+  80400e:	4d 85 ed             	test   %r13,%r13
+  804011:	74 74                	je     804087 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804013:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80401a:	00 
+  80401b:	eb 6a                	jmp    804087 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80401d:	4d 85 e4             	test   %r12,%r12
+  804020:	74 14                	je     804036 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804022:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804029:	00 00 00 
+  80402c:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804032:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804036:	48 85 db             	test   %rbx,%rbx
+  804039:	74 23                	je     80405e <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80403b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804042:	00 00 00 
+  804045:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80404b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804050:	85 c9                	test   %ecx,%ecx
+  804052:	74 07                	je     80405b <ipc_recv+0xa1>
+  804054:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80405b:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80405e:	4d 85 ed             	test   %r13,%r13
+  804061:	74 14                	je     804077 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804063:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80406a:	00 00 00 
+  80406d:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804073:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804077:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80407e:	00 00 00 
+  804081:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804087:	48 83 c4 08          	add    $0x8,%rsp
+  80408b:	5b                   	pop    %rbx
+  80408c:	41 5c                	pop    %r12
+  80408e:	41 5d                	pop    %r13
+  804090:	5d                   	pop    %rbp
+  804091:	c3                   	ret
+
+0000000000804092 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804092:	55                   	push   %rbp
+  804093:	48 89 e5             	mov    %rsp,%rbp
+  804096:	41 55                	push   %r13
+  804098:	41 54                	push   %r12
+  80409a:	53                   	push   %rbx
+  80409b:	48 83 ec 08          	sub    $0x8,%rsp
+  80409f:	49 89 fc             	mov    %rdi,%r12
+  8040a2:	48 89 f7             	mov    %rsi,%rdi
+  8040a5:	48 89 d3             	mov    %rdx,%rbx
+  8040a8:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040ab:	48 85 f6             	test   %rsi,%rsi
+  8040ae:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040b5:	00 00 00 
+  8040b8:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040bc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040c1:	48 85 d2             	test   %rdx,%rdx
+  8040c4:	74 03                	je     8040c9 <ipc_try_recv+0x37>
+  8040c6:	48 8b 32             	mov    (%rdx),%rsi
+  8040c9:	48 b8 92 06 80 00 00 	movabs $0x800692,%rax
+  8040d0:	00 00 00 
+  8040d3:	ff d0                	call   *%rax
+    if (errno) {
+  8040d5:	85 c0                	test   %eax,%eax
+  8040d7:	75 75                	jne    80414e <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8040d9:	4d 85 e4             	test   %r12,%r12
+  8040dc:	74 14                	je     8040f2 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8040de:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040e5:	00 00 00 
+  8040e8:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8040ee:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8040f2:	48 85 db             	test   %rbx,%rbx
+  8040f5:	74 23                	je     80411a <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8040f7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040fe:	00 00 00 
+  804101:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804107:	ba 00 00 00 00       	mov    $0x0,%edx
+  80410c:	85 c9                	test   %ecx,%ecx
+  80410e:	74 07                	je     804117 <ipc_try_recv+0x85>
+  804110:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804117:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80411a:	4d 85 ed             	test   %r13,%r13
+  80411d:	74 14                	je     804133 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80411f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804126:	00 00 00 
+  804129:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80412f:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804133:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80413a:	00 00 00 
+  80413d:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804143:	48 83 c4 08          	add    $0x8,%rsp
+  804147:	5b                   	pop    %rbx
+  804148:	41 5c                	pop    %r12
+  80414a:	41 5d                	pop    %r13
+  80414c:	5d                   	pop    %rbp
+  80414d:	c3                   	ret
+        if (from_env_store)
+  80414e:	4d 85 e4             	test   %r12,%r12
+  804151:	74 08                	je     80415b <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804153:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80415a:	00 
+        if (perm_store)
+  80415b:	4d 85 ed             	test   %r13,%r13
+  80415e:	74 e3                	je     804143 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804160:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804167:	00 
+  804168:	eb d9                	jmp    804143 <ipc_try_recv+0xb1>
+
+000000000080416a <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80416a:	55                   	push   %rbp
+  80416b:	48 89 e5             	mov    %rsp,%rbp
+  80416e:	41 57                	push   %r15
+  804170:	41 56                	push   %r14
+  804172:	41 55                	push   %r13
+  804174:	41 54                	push   %r12
+  804176:	53                   	push   %rbx
+  804177:	48 83 ec 18          	sub    $0x18,%rsp
+  80417b:	41 89 fd             	mov    %edi,%r13d
+  80417e:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804181:	48 89 d3             	mov    %rdx,%rbx
+  804184:	49 89 cc             	mov    %rcx,%r12
+  804187:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80418b:	48 85 d2             	test   %rdx,%rdx
+  80418e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804195:	00 00 00 
+  804198:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80419c:	49 be fd 05 80 00 00 	movabs $0x8005fd,%r14
+  8041a3:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041a6:	49 bf ed 01 80 00 00 	movabs $0x8001ed,%r15
+  8041ad:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041b0:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041b3:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041b7:	4c 89 e1             	mov    %r12,%rcx
+  8041ba:	48 89 da             	mov    %rbx,%rdx
+  8041bd:	44 89 ef             	mov    %r13d,%edi
+  8041c0:	41 ff d6             	call   *%r14
+  8041c3:	85 c0                	test   %eax,%eax
+  8041c5:	74 37                	je     8041fe <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041c7:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041ca:	75 05                	jne    8041d1 <ipc_send+0x67>
+        sys_yield();
+  8041cc:	41 ff d7             	call   *%r15
+  8041cf:	eb df                	jmp    8041b0 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041d1:	89 c1                	mov    %eax,%ecx
+  8041d3:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  8041da:	00 00 00 
+  8041dd:	be 65 00 00 00       	mov    $0x65,%esi
+  8041e2:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  8041e9:	00 00 00 
+  8041ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f1:	49 b8 1b 2f 80 00 00 	movabs $0x802f1b,%r8
+  8041f8:	00 00 00 
+  8041fb:	41 ff d0             	call   *%r8
+    }
+}
+  8041fe:	48 83 c4 18          	add    $0x18,%rsp
+  804202:	5b                   	pop    %rbx
+  804203:	41 5c                	pop    %r12
+  804205:	41 5d                	pop    %r13
+  804207:	41 5e                	pop    %r14
+  804209:	41 5f                	pop    %r15
+  80420b:	5d                   	pop    %rbp
+  80420c:	c3                   	ret
+
+000000000080420d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80420d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804212:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804219:	00 00 00 
+  80421c:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804223:	48 01 ca             	add    %rcx,%rdx
+  804226:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80422c:	39 fa                	cmp    %edi,%edx
+  80422e:	74 12                	je     804242 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804230:	48 83 c0 01          	add    $0x1,%rax
+  804234:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80423a:	75 e0                	jne    80421c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80423c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804241:	c3                   	ret
+            return envs[i].env_id;
+  804242:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804249:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804250:	00 00 00 
+  804253:	48 01 d0             	add    %rdx,%rax
+  804256:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80425c:	c3                   	ret
+
+000000000080425d <__text_end>:
+  80425d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804264:	00 00 00 
+  804267:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80426e:	00 00 00 
+  804271:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804278:	00 00 00 
+  80427b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804282:	00 00 00 
+  804285:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428c:	00 00 00 
+  80428f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804296:	00 00 00 
+  804299:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a0:	00 00 00 
+  8042a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042aa:	00 00 00 
+  8042ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b4:	00 00 00 
+  8042b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042be:	00 00 00 
+  8042c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c8:	00 00 00 
+  8042cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d2:	00 00 00 
+  8042d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042dc:	00 00 00 
+  8042df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e6:	00 00 00 
+  8042e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f0:	00 00 00 
+  8042f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fa:	00 00 00 
+  8042fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804304:	00 00 00 
+  804307:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430e:	00 00 00 
+  804311:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804318:	00 00 00 
+  80431b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804322:	00 00 00 
+  804325:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432c:	00 00 00 
+  80432f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804336:	00 00 00 
+  804339:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804340:	00 00 00 
+  804343:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434a:	00 00 00 
+  80434d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804354:	00 00 00 
+  804357:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435e:	00 00 00 
+  804361:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804368:	00 00 00 
+  80436b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804372:	00 00 00 
+  804375:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437c:	00 00 00 
+  80437f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804386:	00 00 00 
+  804389:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804390:	00 00 00 
+  804393:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439a:	00 00 00 
+  80439d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a4:	00 00 00 
+  8043a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ae:	00 00 00 
+  8043b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b8:	00 00 00 
+  8043bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c2:	00 00 00 
+  8043c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cc:	00 00 00 
+  8043cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d6:	00 00 00 
+  8043d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e0:	00 00 00 
+  8043e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ea:	00 00 00 
+  8043ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f4:	00 00 00 
+  8043f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fe:	00 00 00 
+  804401:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804408:	00 00 00 
+  80440b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804412:	00 00 00 
+  804415:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441c:	00 00 00 
+  80441f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804426:	00 00 00 
+  804429:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804430:	00 00 00 
+  804433:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443a:	00 00 00 
+  80443d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804444:	00 00 00 
+  804447:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444e:	00 00 00 
+  804451:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804458:	00 00 00 
+  80445b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804462:	00 00 00 
+  804465:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446c:	00 00 00 
+  80446f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804476:	00 00 00 
+  804479:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804480:	00 00 00 
+  804483:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448a:	00 00 00 
+  80448d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804494:	00 00 00 
+  804497:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449e:	00 00 00 
+  8044a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a8:	00 00 00 
+  8044ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b2:	00 00 00 
+  8044b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bc:	00 00 00 
+  8044bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c6:	00 00 00 
+  8044c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d0:	00 00 00 
+  8044d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044da:	00 00 00 
+  8044dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e4:	00 00 00 
+  8044e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ee:	00 00 00 
+  8044f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f8:	00 00 00 
+  8044fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804502:	00 00 00 
+  804505:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450c:	00 00 00 
+  80450f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804516:	00 00 00 
+  804519:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804520:	00 00 00 
+  804523:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452a:	00 00 00 
+  80452d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804534:	00 00 00 
+  804537:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453e:	00 00 00 
+  804541:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804548:	00 00 00 
+  80454b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804552:	00 00 00 
+  804555:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455c:	00 00 00 
+  80455f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804566:	00 00 00 
+  804569:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804570:	00 00 00 
+  804573:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457a:	00 00 00 
+  80457d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804584:	00 00 00 
+  804587:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458e:	00 00 00 
+  804591:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804598:	00 00 00 
+  80459b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a2:	00 00 00 
+  8045a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ac:	00 00 00 
+  8045af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b6:	00 00 00 
+  8045b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c0:	00 00 00 
+  8045c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ca:	00 00 00 
+  8045cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d4:	00 00 00 
+  8045d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045de:	00 00 00 
+  8045e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e8:	00 00 00 
+  8045eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f2:	00 00 00 
+  8045f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fc:	00 00 00 
+  8045ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804606:	00 00 00 
+  804609:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804610:	00 00 00 
+  804613:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461a:	00 00 00 
+  80461d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804624:	00 00 00 
+  804627:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462e:	00 00 00 
+  804631:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804638:	00 00 00 
+  80463b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804642:	00 00 00 
+  804645:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464c:	00 00 00 
+  80464f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804656:	00 00 00 
+  804659:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804660:	00 00 00 
+  804663:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466a:	00 00 00 
+  80466d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804674:	00 00 00 
+  804677:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467e:	00 00 00 
+  804681:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804688:	00 00 00 
+  80468b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804692:	00 00 00 
+  804695:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469c:	00 00 00 
+  80469f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a6:	00 00 00 
+  8046a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b0:	00 00 00 
+  8046b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ba:	00 00 00 
+  8046bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c4:	00 00 00 
+  8046c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ce:	00 00 00 
+  8046d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d8:	00 00 00 
+  8046db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e2:	00 00 00 
+  8046e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ec:	00 00 00 
+  8046ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f6:	00 00 00 
+  8046f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804700:	00 00 00 
+  804703:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470a:	00 00 00 
+  80470d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804714:	00 00 00 
+  804717:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471e:	00 00 00 
+  804721:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804728:	00 00 00 
+  80472b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804732:	00 00 00 
+  804735:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473c:	00 00 00 
+  80473f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804746:	00 00 00 
+  804749:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804750:	00 00 00 
+  804753:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475a:	00 00 00 
+  80475d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804764:	00 00 00 
+  804767:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476e:	00 00 00 
+  804771:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804778:	00 00 00 
+  80477b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804782:	00 00 00 
+  804785:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478c:	00 00 00 
+  80478f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804796:	00 00 00 
+  804799:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a0:	00 00 00 
+  8047a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047aa:	00 00 00 
+  8047ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b4:	00 00 00 
+  8047b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047be:	00 00 00 
+  8047c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c8:	00 00 00 
+  8047cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d2:	00 00 00 
+  8047d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dc:	00 00 00 
+  8047df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e6:	00 00 00 
+  8047e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f0:	00 00 00 
+  8047f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fa:	00 00 00 
+  8047fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804804:	00 00 00 
+  804807:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480e:	00 00 00 
+  804811:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804818:	00 00 00 
+  80481b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804822:	00 00 00 
+  804825:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482c:	00 00 00 
+  80482f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804836:	00 00 00 
+  804839:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804840:	00 00 00 
+  804843:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484a:	00 00 00 
+  80484d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804854:	00 00 00 
+  804857:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485e:	00 00 00 
+  804861:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804868:	00 00 00 
+  80486b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804872:	00 00 00 
+  804875:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487c:	00 00 00 
+  80487f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804886:	00 00 00 
+  804889:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804890:	00 00 00 
+  804893:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489a:	00 00 00 
+  80489d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a4:	00 00 00 
+  8048a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ae:	00 00 00 
+  8048b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b8:	00 00 00 
+  8048bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c2:	00 00 00 
+  8048c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cc:	00 00 00 
+  8048cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d6:	00 00 00 
+  8048d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e0:	00 00 00 
+  8048e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ea:	00 00 00 
+  8048ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f4:	00 00 00 
+  8048f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fe:	00 00 00 
+  804901:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804908:	00 00 00 
+  80490b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804912:	00 00 00 
+  804915:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491c:	00 00 00 
+  80491f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804926:	00 00 00 
+  804929:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804930:	00 00 00 
+  804933:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493a:	00 00 00 
+  80493d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804944:	00 00 00 
+  804947:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494e:	00 00 00 
+  804951:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804958:	00 00 00 
+  80495b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804962:	00 00 00 
+  804965:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496c:	00 00 00 
+  80496f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804976:	00 00 00 
+  804979:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804980:	00 00 00 
+  804983:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498a:	00 00 00 
+  80498d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804994:	00 00 00 
+  804997:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499e:	00 00 00 
+  8049a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a8:	00 00 00 
+  8049ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b2:	00 00 00 
+  8049b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bc:	00 00 00 
+  8049bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c6:	00 00 00 
+  8049c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d0:	00 00 00 
+  8049d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049da:	00 00 00 
+  8049dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e4:	00 00 00 
+  8049e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ee:	00 00 00 
+  8049f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f8:	00 00 00 
+  8049fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a02:	00 00 00 
+  804a05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0c:	00 00 00 
+  804a0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a16:	00 00 00 
+  804a19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a20:	00 00 00 
+  804a23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2a:	00 00 00 
+  804a2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a34:	00 00 00 
+  804a37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3e:	00 00 00 
+  804a41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a48:	00 00 00 
+  804a4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a52:	00 00 00 
+  804a55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5c:	00 00 00 
+  804a5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a66:	00 00 00 
+  804a69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a70:	00 00 00 
+  804a73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7a:	00 00 00 
+  804a7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a84:	00 00 00 
+  804a87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8e:	00 00 00 
+  804a91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a98:	00 00 00 
+  804a9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa2:	00 00 00 
+  804aa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aac:	00 00 00 
+  804aaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab6:	00 00 00 
+  804ab9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac0:	00 00 00 
+  804ac3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aca:	00 00 00 
+  804acd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad4:	00 00 00 
+  804ad7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ade:	00 00 00 
+  804ae1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae8:	00 00 00 
+  804aeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af2:	00 00 00 
+  804af5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afc:	00 00 00 
+  804aff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b06:	00 00 00 
+  804b09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b10:	00 00 00 
+  804b13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1a:	00 00 00 
+  804b1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b24:	00 00 00 
+  804b27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2e:	00 00 00 
+  804b31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b38:	00 00 00 
+  804b3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b42:	00 00 00 
+  804b45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4c:	00 00 00 
+  804b4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b56:	00 00 00 
+  804b59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b60:	00 00 00 
+  804b63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6a:	00 00 00 
+  804b6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b74:	00 00 00 
+  804b77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7e:	00 00 00 
+  804b81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b88:	00 00 00 
+  804b8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b92:	00 00 00 
+  804b95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9c:	00 00 00 
+  804b9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba6:	00 00 00 
+  804ba9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb0:	00 00 00 
+  804bb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bba:	00 00 00 
+  804bbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc4:	00 00 00 
+  804bc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bce:	00 00 00 
+  804bd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd8:	00 00 00 
+  804bdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be2:	00 00 00 
+  804be5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bec:	00 00 00 
+  804bef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf6:	00 00 00 
+  804bf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c00:	00 00 00 
+  804c03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0a:	00 00 00 
+  804c0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c14:	00 00 00 
+  804c17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1e:	00 00 00 
+  804c21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c28:	00 00 00 
+  804c2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c32:	00 00 00 
+  804c35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3c:	00 00 00 
+  804c3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c46:	00 00 00 
+  804c49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c50:	00 00 00 
+  804c53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5a:	00 00 00 
+  804c5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c64:	00 00 00 
+  804c67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6e:	00 00 00 
+  804c71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c78:	00 00 00 
+  804c7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c82:	00 00 00 
+  804c85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8c:	00 00 00 
+  804c8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c96:	00 00 00 
+  804c99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca0:	00 00 00 
+  804ca3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caa:	00 00 00 
+  804cad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb4:	00 00 00 
+  804cb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbe:	00 00 00 
+  804cc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc8:	00 00 00 
+  804ccb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd2:	00 00 00 
+  804cd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdc:	00 00 00 
+  804cdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce6:	00 00 00 
+  804ce9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf0:	00 00 00 
+  804cf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfa:	00 00 00 
+  804cfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d04:	00 00 00 
+  804d07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0e:	00 00 00 
+  804d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d18:	00 00 00 
+  804d1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d22:	00 00 00 
+  804d25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2c:	00 00 00 
+  804d2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d36:	00 00 00 
+  804d39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d40:	00 00 00 
+  804d43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4a:	00 00 00 
+  804d4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d54:	00 00 00 
+  804d57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5e:	00 00 00 
+  804d61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d68:	00 00 00 
+  804d6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d72:	00 00 00 
+  804d75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7c:	00 00 00 
+  804d7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d86:	00 00 00 
+  804d89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d90:	00 00 00 
+  804d93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9a:	00 00 00 
+  804d9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da4:	00 00 00 
+  804da7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dae:	00 00 00 
+  804db1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db8:	00 00 00 
+  804dbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc2:	00 00 00 
+  804dc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcc:	00 00 00 
+  804dcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd6:	00 00 00 
+  804dd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de0:	00 00 00 
+  804de3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dea:	00 00 00 
+  804ded:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df4:	00 00 00 
+  804df7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfe:	00 00 00 
+  804e01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e08:	00 00 00 
+  804e0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e12:	00 00 00 
+  804e15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1c:	00 00 00 
+  804e1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e26:	00 00 00 
+  804e29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e30:	00 00 00 
+  804e33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3a:	00 00 00 
+  804e3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e44:	00 00 00 
+  804e47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4e:	00 00 00 
+  804e51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e58:	00 00 00 
+  804e5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e62:	00 00 00 
+  804e65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6c:	00 00 00 
+  804e6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e76:	00 00 00 
+  804e79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e80:	00 00 00 
+  804e83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8a:	00 00 00 
+  804e8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e94:	00 00 00 
+  804e97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9e:	00 00 00 
+  804ea1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea8:	00 00 00 
+  804eab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb2:	00 00 00 
+  804eb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebc:	00 00 00 
+  804ebf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec6:	00 00 00 
+  804ec9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed0:	00 00 00 
+  804ed3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eda:	00 00 00 
+  804edd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee4:	00 00 00 
+  804ee7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eee:	00 00 00 
+  804ef1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef8:	00 00 00 
+  804efb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f02:	00 00 00 
+  804f05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0c:	00 00 00 
+  804f0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f16:	00 00 00 
+  804f19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f20:	00 00 00 
+  804f23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2a:	00 00 00 
+  804f2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f34:	00 00 00 
+  804f37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3e:	00 00 00 
+  804f41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f48:	00 00 00 
+  804f4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f52:	00 00 00 
+  804f55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5c:	00 00 00 
+  804f5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f66:	00 00 00 
+  804f69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f70:	00 00 00 
+  804f73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7a:	00 00 00 
+  804f7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f84:	00 00 00 
+  804f87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8e:	00 00 00 
+  804f91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f98:	00 00 00 
+  804f9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa2:	00 00 00 
+  804fa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fac:	00 00 00 
+  804faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb6:	00 00 00 
+  804fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc0:	00 00 00 
+  804fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fca:	00 00 00 
+  804fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd4:	00 00 00 
+  804fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fde:	00 00 00 
+  804fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe8:	00 00 00 
+  804feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff2:	00 00 00 
+  804ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffc:	00 00 00 
+  804fff:	90                   	nop
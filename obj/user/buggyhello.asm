@@ -0,0 +1,8098 @@
+
+obj/user/buggyhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 1e 00 00 00       	call   800041 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs((char *)1, 1);
+  800029:	be 01 00 00 00       	mov    $0x1,%esi
+  80002e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800033:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  80003a:	00 00 00 
+  80003d:	ff d0                	call   *%rax
+}
+  80003f:	5d                   	pop    %rbp
+  800040:	c3                   	ret
+
+0000000000800041 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800041:	55                   	push   %rbp
+  800042:	48 89 e5             	mov    %rsp,%rbp
+  800045:	41 56                	push   %r14
+  800047:	41 55                	push   %r13
+  800049:	41 54                	push   %r12
+  80004b:	53                   	push   %rbx
+  80004c:	41 89 fd             	mov    %edi,%r13d
+  80004f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800052:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800059:	00 00 00 
+  80005c:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800063:	00 00 00 
+  800066:	48 39 c2             	cmp    %rax,%rdx
+  800069:	73 17                	jae    800082 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80006b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80006e:	49 89 c4             	mov    %rax,%r12
+  800071:	48 83 c3 08          	add    $0x8,%rbx
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	ff 53 f8             	call   *-0x8(%rbx)
+  80007d:	4c 39 e3             	cmp    %r12,%rbx
+  800080:	72 ef                	jb     800071 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800082:	48 b8 d6 01 80 00 00 	movabs $0x8001d6,%rax
+  800089:	00 00 00 
+  80008c:	ff d0                	call   *%rax
+  80008e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800093:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80009a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a1:	00 00 00 
+  8000a4:	48 01 d0             	add    %rdx,%rax
+  8000a7:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000ae:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b1:	45 85 ed             	test   %r13d,%r13d
+  8000b4:	7e 0d                	jle    8000c3 <libmain+0x82>
+  8000b6:	49 8b 06             	mov    (%r14),%rax
+  8000b9:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000c0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000c3:	4c 89 f6             	mov    %r14,%rsi
+  8000c6:	44 89 ef             	mov    %r13d,%edi
+  8000c9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d0:	00 00 00 
+  8000d3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000d5:	48 b8 ea 00 80 00 00 	movabs $0x8000ea,%rax
+  8000dc:	00 00 00 
+  8000df:	ff d0                	call   *%rax
+#endif
+}
+  8000e1:	5b                   	pop    %rbx
+  8000e2:	41 5c                	pop    %r12
+  8000e4:	41 5d                	pop    %r13
+  8000e6:	41 5e                	pop    %r14
+  8000e8:	5d                   	pop    %rbp
+  8000e9:	c3                   	ret
+
+00000000008000ea <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000ea:	55                   	push   %rbp
+  8000eb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000ee:	48 b8 d2 0e 80 00 00 	movabs $0x800ed2,%rax
+  8000f5:	00 00 00 
+  8000f8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ff:	48 b8 6b 01 80 00 00 	movabs $0x80016b,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+}
+  80010b:	5d                   	pop    %rbp
+  80010c:	c3                   	ret
+
+000000000080010d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80010d:	55                   	push   %rbp
+  80010e:	48 89 e5             	mov    %rsp,%rbp
+  800111:	53                   	push   %rbx
+  800112:	48 89 fa             	mov    %rdi,%rdx
+  800115:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800118:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80011d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800122:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800127:	be 00 00 00 00       	mov    $0x0,%esi
+  80012c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800132:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800134:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800138:	c9                   	leave
+  800139:	c3                   	ret
+
+000000000080013a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80013a:	55                   	push   %rbp
+  80013b:	48 89 e5             	mov    %rsp,%rbp
+  80013e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80013f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800144:	ba 00 00 00 00       	mov    $0x0,%edx
+  800149:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80014e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800153:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800158:	be 00 00 00 00       	mov    $0x0,%esi
+  80015d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800163:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800165:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800169:	c9                   	leave
+  80016a:	c3                   	ret
+
+000000000080016b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80016b:	55                   	push   %rbp
+  80016c:	48 89 e5             	mov    %rsp,%rbp
+  80016f:	53                   	push   %rbx
+  800170:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800174:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800177:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80017c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800181:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800186:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80018b:	be 00 00 00 00       	mov    $0x0,%esi
+  800190:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800196:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800198:	48 85 c0             	test   %rax,%rax
+  80019b:	7f 06                	jg     8001a3 <sys_env_destroy+0x38>
+}
+  80019d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a1:	c9                   	leave
+  8001a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001a3:	49 89 c0             	mov    %rax,%r8
+  8001a6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001ab:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8001b2:	00 00 00 
+  8001b5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001ba:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8001c1:	00 00 00 
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c9:	49 b9 35 2f 80 00 00 	movabs $0x802f35,%r9
+  8001d0:	00 00 00 
+  8001d3:	41 ff d1             	call   *%r9
+
+00000000008001d6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001d6:	55                   	push   %rbp
+  8001d7:	48 89 e5             	mov    %rsp,%rbp
+  8001da:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001db:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ff:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800201:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+0000000000800207 <sys_yield>:
+
+void
+sys_yield(void) {
+  800207:	55                   	push   %rbp
+  800208:	48 89 e5             	mov    %rsp,%rbp
+  80020b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80020c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800211:	ba 00 00 00 00       	mov    $0x0,%edx
+  800216:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80021b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800220:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800225:	be 00 00 00 00       	mov    $0x0,%esi
+  80022a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800230:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800232:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800236:	c9                   	leave
+  800237:	c3                   	ret
+
+0000000000800238 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800238:	55                   	push   %rbp
+  800239:	48 89 e5             	mov    %rsp,%rbp
+  80023c:	53                   	push   %rbx
+  80023d:	48 89 fa             	mov    %rdi,%rdx
+  800240:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800243:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800248:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80024f:	00 00 00 
+  800252:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800257:	be 00 00 00 00       	mov    $0x0,%esi
+  80025c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800262:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800264:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800268:	c9                   	leave
+  800269:	c3                   	ret
+
+000000000080026a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80026a:	55                   	push   %rbp
+  80026b:	48 89 e5             	mov    %rsp,%rbp
+  80026e:	53                   	push   %rbx
+  80026f:	49 89 f8             	mov    %rdi,%r8
+  800272:	48 89 d3             	mov    %rdx,%rbx
+  800275:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800278:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80027d:	4c 89 c2             	mov    %r8,%rdx
+  800280:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800283:	be 00 00 00 00       	mov    $0x0,%esi
+  800288:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80028e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800290:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800294:	c9                   	leave
+  800295:	c3                   	ret
+
+0000000000800296 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800296:	55                   	push   %rbp
+  800297:	48 89 e5             	mov    %rsp,%rbp
+  80029a:	53                   	push   %rbx
+  80029b:	48 83 ec 08          	sub    $0x8,%rsp
+  80029f:	89 f8                	mov    %edi,%eax
+  8002a1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002a4:	48 63 f9             	movslq %ecx,%rdi
+  8002a7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002aa:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002af:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002bf:	48 85 c0             	test   %rax,%rax
+  8002c2:	7f 06                	jg     8002ca <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c8:	c9                   	leave
+  8002c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002ca:	49 89 c0             	mov    %rax,%r8
+  8002cd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002d2:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8002d9:	00 00 00 
+  8002dc:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002e1:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8002e8:	00 00 00 
+  8002eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f0:	49 b9 35 2f 80 00 00 	movabs $0x802f35,%r9
+  8002f7:	00 00 00 
+  8002fa:	41 ff d1             	call   *%r9
+
+00000000008002fd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002fd:	55                   	push   %rbp
+  8002fe:	48 89 e5             	mov    %rsp,%rbp
+  800301:	53                   	push   %rbx
+  800302:	48 83 ec 08          	sub    $0x8,%rsp
+  800306:	89 f8                	mov    %edi,%eax
+  800308:	49 89 f2             	mov    %rsi,%r10
+  80030b:	48 89 cf             	mov    %rcx,%rdi
+  80030e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800311:	48 63 da             	movslq %edx,%rbx
+  800314:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800317:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80031c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80031f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800322:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800324:	48 85 c0             	test   %rax,%rax
+  800327:	7f 06                	jg     80032f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800329:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80032d:	c9                   	leave
+  80032e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80032f:	49 89 c0             	mov    %rax,%r8
+  800332:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800337:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80033e:	00 00 00 
+  800341:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800346:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80034d:	00 00 00 
+  800350:	b8 00 00 00 00       	mov    $0x0,%eax
+  800355:	49 b9 35 2f 80 00 00 	movabs $0x802f35,%r9
+  80035c:	00 00 00 
+  80035f:	41 ff d1             	call   *%r9
+
+0000000000800362 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800362:	55                   	push   %rbp
+  800363:	48 89 e5             	mov    %rsp,%rbp
+  800366:	53                   	push   %rbx
+  800367:	48 83 ec 08          	sub    $0x8,%rsp
+  80036b:	49 89 f9             	mov    %rdi,%r9
+  80036e:	89 f0                	mov    %esi,%eax
+  800370:	48 89 d3             	mov    %rdx,%rbx
+  800373:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  800376:	49 63 f0             	movslq %r8d,%rsi
+  800379:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80037c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800381:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800384:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80038a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80038c:	48 85 c0             	test   %rax,%rax
+  80038f:	7f 06                	jg     800397 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800391:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800395:	c9                   	leave
+  800396:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800397:	49 89 c0             	mov    %rax,%r8
+  80039a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80039f:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8003a6:	00 00 00 
+  8003a9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8003ae:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8003b5:	00 00 00 
+  8003b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bd:	49 b9 35 2f 80 00 00 	movabs $0x802f35,%r9
+  8003c4:	00 00 00 
+  8003c7:	41 ff d1             	call   *%r9
+
+00000000008003ca <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003ca:	55                   	push   %rbp
+  8003cb:	48 89 e5             	mov    %rsp,%rbp
+  8003ce:	53                   	push   %rbx
+  8003cf:	89 f8                	mov    %edi,%eax
+  8003d1:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8003d4:	48 63 f9             	movslq %ecx,%rdi
+  8003d7:	48 63 da             	movslq %edx,%rbx
+  8003da:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003dd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003e2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003f0:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8003f2:	89 c2                	mov    %eax,%edx
+  8003f4:	48 85 c0             	test   %rax,%rax
+  8003f7:	78 0d                	js     800406 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8003f9:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8003fe:	4d 85 c9             	test   %r9,%r9
+  800401:	74 03                	je     800406 <sys_alloc_dma_region+0x3c>
+  800403:	49 89 01             	mov    %rax,(%r9)
+}
+  800406:	89 d0                	mov    %edx,%eax
+  800408:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80040c:	c9                   	leave
+  80040d:	c3                   	ret
+
+000000000080040e <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80040e:	55                   	push   %rbp
+  80040f:	48 89 e5             	mov    %rsp,%rbp
+  800412:	53                   	push   %rbx
+  800413:	48 83 ec 08          	sub    $0x8,%rsp
+  800417:	48 89 f1             	mov    %rsi,%rcx
+  80041a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80041d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800420:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800425:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80042a:	be 00 00 00 00       	mov    $0x0,%esi
+  80042f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800435:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800437:	48 85 c0             	test   %rax,%rax
+  80043a:	7f 06                	jg     800442 <sys_set_cache_region+0x34>
+}
+  80043c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800440:	c9                   	leave
+  800441:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800442:	49 89 c0             	mov    %rax,%r8
+  800445:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80044a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800451:	00 00 00 
+  800454:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800459:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800460:	00 00 00 
+  800463:	b8 00 00 00 00       	mov    $0x0,%eax
+  800468:	49 b9 35 2f 80 00 00 	movabs $0x802f35,%r9
+  80046f:	00 00 00 
+  800472:	41 ff d1             	call   *%r9
+
+0000000000800475 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800475:	55                   	push   %rbp
+  800476:	48 89 e5             	mov    %rsp,%rbp
+  800479:	53                   	push   %rbx
+  80047a:	48 83 ec 08          	sub    $0x8,%rsp
+  80047e:	48 89 f1             	mov    %rsi,%rcx
+  800481:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800484:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800487:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80048c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800491:	be 00 00 00 00       	mov    $0x0,%esi
+  800496:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80049c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80049e:	48 85 c0             	test   %rax,%rax
+  8004a1:	7f 06                	jg     8004a9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8004a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004a7:	c9                   	leave
+  8004a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004a9:	49 89 c0             	mov    %rax,%r8
+  8004ac:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004b1:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8004b8:	00 00 00 
+  8004bb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004c0:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8004c7:	00 00 00 
+  8004ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cf:	49 b9 35 2f 80 00 00 	movabs $0x802f35,%r9
+  8004d6:	00 00 00 
+  8004d9:	41 ff d1             	call   *%r9
+
+00000000008004dc <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004dc:	55                   	push   %rbp
+  8004dd:	48 89 e5             	mov    %rsp,%rbp
+  8004e0:	53                   	push   %rbx
+  8004e1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004e5:	48 63 ce             	movslq %esi,%rcx
+  8004e8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800505:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800507:	48 85 c0             	test   %rax,%rax
+  80050a:	7f 06                	jg     800512 <sys_env_set_status+0x36>
+}
+  80050c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800510:	c9                   	leave
+  800511:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800512:	49 89 c0             	mov    %rax,%r8
+  800515:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80051a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800521:	00 00 00 
+  800524:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800529:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800530:	00 00 00 
+  800533:	b8 00 00 00 00       	mov    $0x0,%eax
+  800538:	49 b9 35 2f 80 00 00 	movabs $0x802f35,%r9
+  80053f:	00 00 00 
+  800542:	41 ff d1             	call   *%r9
+
+0000000000800545 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800545:	55                   	push   %rbp
+  800546:	48 89 e5             	mov    %rsp,%rbp
+  800549:	53                   	push   %rbx
+  80054a:	48 83 ec 08          	sub    $0x8,%rsp
+  80054e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800551:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800554:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80055e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800563:	be 00 00 00 00       	mov    $0x0,%esi
+  800568:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80056e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800570:	48 85 c0             	test   %rax,%rax
+  800573:	7f 06                	jg     80057b <sys_env_set_trapframe+0x36>
+}
+  800575:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800579:	c9                   	leave
+  80057a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80057b:	49 89 c0             	mov    %rax,%r8
+  80057e:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800583:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80058a:	00 00 00 
+  80058d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800592:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800599:	00 00 00 
+  80059c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a1:	49 b9 35 2f 80 00 00 	movabs $0x802f35,%r9
+  8005a8:	00 00 00 
+  8005ab:	41 ff d1             	call   *%r9
+
+00000000008005ae <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005ae:	55                   	push   %rbp
+  8005af:	48 89 e5             	mov    %rsp,%rbp
+  8005b2:	53                   	push   %rbx
+  8005b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005b7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005bd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8005d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005d9:	48 85 c0             	test   %rax,%rax
+  8005dc:	7f 06                	jg     8005e4 <sys_env_set_pgfault_upcall+0x36>
+}
+  8005de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005e2:	c9                   	leave
+  8005e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005e4:	49 89 c0             	mov    %rax,%r8
+  8005e7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005ec:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8005f3:	00 00 00 
+  8005f6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8005fb:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800602:	00 00 00 
+  800605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060a:	49 b9 35 2f 80 00 00 	movabs $0x802f35,%r9
+  800611:	00 00 00 
+  800614:	41 ff d1             	call   *%r9
+
+0000000000800617 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800617:	55                   	push   %rbp
+  800618:	48 89 e5             	mov    %rsp,%rbp
+  80061b:	53                   	push   %rbx
+  80061c:	89 f8                	mov    %edi,%eax
+  80061e:	49 89 f1             	mov    %rsi,%r9
+  800621:	48 89 d3             	mov    %rdx,%rbx
+  800624:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800627:	49 63 f0             	movslq %r8d,%rsi
+  80062a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80062d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800632:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800635:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80063b:	cd 30                	int    $0x30
+}
+  80063d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800641:	c9                   	leave
+  800642:	c3                   	ret
+
+0000000000800643 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800643:	55                   	push   %rbp
+  800644:	48 89 e5             	mov    %rsp,%rbp
+  800647:	53                   	push   %rbx
+  800648:	48 83 ec 08          	sub    $0x8,%rsp
+  80064c:	48 89 fa             	mov    %rdi,%rdx
+  80064f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800652:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800657:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80065c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800661:	be 00 00 00 00       	mov    $0x0,%esi
+  800666:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80066c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80066e:	48 85 c0             	test   %rax,%rax
+  800671:	7f 06                	jg     800679 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800673:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800677:	c9                   	leave
+  800678:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800679:	49 89 c0             	mov    %rax,%r8
+  80067c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800681:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800688:	00 00 00 
+  80068b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800690:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800697:	00 00 00 
+  80069a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069f:	49 b9 35 2f 80 00 00 	movabs $0x802f35,%r9
+  8006a6:	00 00 00 
+  8006a9:	41 ff d1             	call   *%r9
+
+00000000008006ac <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8006ac:	55                   	push   %rbp
+  8006ad:	48 89 e5             	mov    %rsp,%rbp
+  8006b0:	53                   	push   %rbx
+  8006b1:	48 89 fa             	mov    %rdi,%rdx
+  8006b4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006b7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8006cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006d1:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006d7:	c9                   	leave
+  8006d8:	c3                   	ret
+
+00000000008006d9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006d9:	55                   	push   %rbp
+  8006da:	48 89 e5             	mov    %rsp,%rbp
+  8006dd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006de:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8006fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800702:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800704:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800708:	c9                   	leave
+  800709:	c3                   	ret
+
+000000000080070a <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80070a:	48 85 ff             	test   %rdi,%rdi
+  80070d:	0f 84 b6 01 00 00    	je     8008c9 <malloc+0x1bf>
+malloc(size_t size) {
+  800713:	55                   	push   %rbp
+  800714:	48 89 e5             	mov    %rsp,%rbp
+  800717:	41 56                	push   %r14
+  800719:	41 55                	push   %r13
+  80071b:	41 54                	push   %r12
+  80071d:	53                   	push   %rbx
+  80071e:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800721:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800728:	00 00 00 
+  80072b:	4c 8b 20             	mov    (%rax),%r12
+  80072e:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  800735:	0f 87 94 01 00 00    	ja     8008cf <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  80073b:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800742:	00 00 00 
+  800745:	48 85 c0             	test   %rax,%rax
+  800748:	74 6b                	je     8007b5 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80074a:	4d 85 e4             	test   %r12,%r12
+  80074d:	74 66                	je     8007b5 <malloc+0xab>
+  80074f:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  800756:	00 00 00 
+  800759:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075e:	eb 0d                	jmp    80076d <malloc+0x63>
+  800760:	48 83 c1 01          	add    $0x1,%rcx
+  800764:	48 83 c2 18          	add    $0x18,%rdx
+  800768:	49 39 cc             	cmp    %rcx,%r12
+  80076b:	74 48                	je     8007b5 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80076d:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  800772:	74 ec                	je     800760 <malloc+0x56>
+  800774:	48 39 1a             	cmp    %rbx,(%rdx)
+  800777:	72 e7                	jb     800760 <malloc+0x56>
+                real_freep_size--;
+  800779:	48 83 e8 01          	sub    $0x1,%rax
+  80077d:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800784:	00 00 00 
+                freep[i].is_free = false;
+  800787:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80078e:	00 00 00 
+  800791:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  800795:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  800799:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  80079d:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8007a4:	00 
+                freep[i].size = size;
+  8007a5:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8007a9:	48 01 c8             	add    %rcx,%rax
+  8007ac:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007b0:	e9 0b 01 00 00       	jmp    8008c0 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8007b5:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8007bc:	00 00 00 
+  8007bf:	48 01 d8             	add    %rbx,%rax
+  8007c2:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007c8:	76 7c                	jbe    800846 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007ca:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8007d1:	00 00 00 
+  8007d4:	4c 8b 30             	mov    (%rax),%r14
+  8007d7:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8007de:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8007e1:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8007e8:	00 00 00 
+  8007eb:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8007f2:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8007f9:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8007ff:	4c 0f 45 eb          	cmovne %rbx,%r13
+  800803:	48 b8 d6 01 80 00 00 	movabs $0x8001d6,%rax
+  80080a:	00 00 00 
+  80080d:	ff d0                	call   *%rax
+  80080f:	89 c7                	mov    %eax,%edi
+  800811:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  800818:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80081f:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  800826:	00 00 00 
+  800829:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80082d:	b9 26 00 00 00       	mov    $0x26,%ecx
+  800832:	48 b8 96 02 80 00 00 	movabs $0x800296,%rax
+  800839:	00 00 00 
+  80083c:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80083e:	85 c0                	test   %eax,%eax
+  800840:	0f 88 90 00 00 00    	js     8008d6 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  800846:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  80084d:	00 00 00 
+  800850:	48 8b 31             	mov    (%rcx),%rsi
+  800853:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  80085a:	00 00 00 
+  80085d:	4c 8b 07             	mov    (%rdi),%r8
+  800860:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  800864:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  80086b:	00 00 00 
+  80086e:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  800872:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  800876:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80087d:	00 00 00 
+  800880:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  800884:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  800887:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  80088b:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  800892:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  800893:	48 89 d8             	mov    %rbx,%rax
+  800896:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80089b:	4c 01 c0             	add    %r8,%rax
+  80089e:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8008a1:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8008a8:	48 01 f3             	add    %rsi,%rbx
+  8008ab:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8008ae:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8008b3:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008ba:	00 00 00 
+  8008bd:	48 89 d0             	mov    %rdx,%rax
+}
+  8008c0:	5b                   	pop    %rbx
+  8008c1:	41 5c                	pop    %r12
+  8008c3:	41 5d                	pop    %r13
+  8008c5:	41 5e                	pop    %r14
+  8008c7:	5d                   	pop    %rbp
+  8008c8:	c3                   	ret
+        return NULL;
+  8008c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008ce:	c3                   	ret
+        return NULL;
+  8008cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d4:	eb ea                	jmp    8008c0 <malloc+0x1b6>
+            return NULL;
+  8008d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008db:	eb e3                	jmp    8008c0 <malloc+0x1b6>
+
+00000000008008dd <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8008dd:	55                   	push   %rbp
+  8008de:	48 89 e5             	mov    %rsp,%rbp
+  8008e1:	53                   	push   %rbx
+  8008e2:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8008e6:	48 89 fb             	mov    %rdi,%rbx
+  8008e9:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8008ed:	48 89 df             	mov    %rbx,%rdi
+  8008f0:	48 b8 0a 07 80 00 00 	movabs $0x80070a,%rax
+  8008f7:	00 00 00 
+  8008fa:	ff d0                	call   *%rax
+  8008fc:	48 89 c7             	mov    %rax,%rdi
+  8008ff:	48 89 da             	mov    %rbx,%rdx
+  800902:	be 00 00 00 00       	mov    $0x0,%esi
+  800907:	48 b8 dd 3c 80 00 00 	movabs $0x803cdd,%rax
+  80090e:	00 00 00 
+  800911:	ff d0                	call   *%rax
+}
+  800913:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800917:	c9                   	leave
+  800918:	c3                   	ret
+
+0000000000800919 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  800919:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  800920:	00 00 00 
+  800923:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80092a:	00 00 00 
+  80092d:	48 3b 02             	cmp    (%rdx),%rax
+  800930:	74 4d                	je     80097f <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  800932:	48 85 c0             	test   %rax,%rax
+  800935:	74 4d                	je     800984 <get_allocsize+0x6b>
+  800937:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80093e:	00 00 00 
+  800941:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  800946:	48 3b 39             	cmp    (%rcx),%rdi
+  800949:	74 13                	je     80095e <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  80094b:	48 83 c2 01          	add    $0x1,%rdx
+  80094f:	48 83 c1 18          	add    $0x18,%rcx
+  800953:	48 39 d0             	cmp    %rdx,%rax
+  800956:	75 ee                	jne    800946 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  800958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095d:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  80095e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800962:	b8 00 00 00 00       	mov    $0x0,%eax
+  800967:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  80096e:	00 00 00 
+  800971:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800977:	75 0b                	jne    800984 <get_allocsize+0x6b>
+  800979:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  80097e:	c3                   	ret
+        return 0;
+  80097f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800984:	c3                   	ret
+
+0000000000800985 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  800985:	48 85 ff             	test   %rdi,%rdi
+  800988:	0f 84 01 01 00 00    	je     800a8f <free+0x10a>
+free(void *ptr) {
+  80098e:	55                   	push   %rbp
+  80098f:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  800992:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800999:	00 00 00 
+  80099c:	48 8b 30             	mov    (%rax),%rsi
+  80099f:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8009a6:	00 00 00 
+  8009a9:	48 39 c6             	cmp    %rax,%rsi
+  8009ac:	74 50                	je     8009fe <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8009ae:	48 85 f6             	test   %rsi,%rsi
+  8009b1:	74 21                	je     8009d4 <free+0x4f>
+  8009b3:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009ba:	00 00 00 
+  8009bd:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009c2:	48 3b 39             	cmp    (%rcx),%rdi
+  8009c5:	74 61                	je     800a28 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009c7:	48 83 c2 01          	add    $0x1,%rdx
+  8009cb:	48 83 c1 18          	add    $0x18,%rcx
+  8009cf:	48 39 d6             	cmp    %rdx,%rsi
+  8009d2:	75 ee                	jne    8009c2 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8009d4:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  8009db:	00 00 00 
+  8009de:	be 12 01 00 00       	mov    $0x112,%esi
+  8009e3:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009ea:	00 00 00 
+  8009ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f2:	48 b9 35 2f 80 00 00 	movabs $0x802f35,%rcx
+  8009f9:	00 00 00 
+  8009fc:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  8009fe:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  800a05:	00 00 00 
+  800a08:	be 06 01 00 00       	mov    $0x106,%esi
+  800a0d:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a14:	00 00 00 
+  800a17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1c:	48 b9 35 2f 80 00 00 	movabs $0x802f35,%rcx
+  800a23:	00 00 00 
+  800a26:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a28:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a2c:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a33:	00 00 00 
+  800a36:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a3c:	75 27                	jne    800a65 <free+0xe0>
+            freep[i].is_free = true;
+  800a3e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a42:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a49:	00 00 00 
+  800a4c:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a53:	00 00 
+            real_freep_size++;
+  800a55:	48 83 c0 01          	add    $0x1,%rax
+  800a59:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a60:	00 00 00 
+}
+  800a63:	5d                   	pop    %rbp
+  800a64:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a65:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a6c:	00 00 00 
+  800a6f:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800a74:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a7b:	00 00 00 
+  800a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a83:	48 b9 35 2f 80 00 00 	movabs $0x802f35,%rcx
+  800a8a:	00 00 00 
+  800a8d:	ff d1                	call   *%rcx
+  800a8f:	c3                   	ret
+
+0000000000800a90 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800a90:	55                   	push   %rbp
+  800a91:	48 89 e5             	mov    %rsp,%rbp
+  800a94:	41 55                	push   %r13
+  800a96:	41 54                	push   %r12
+  800a98:	53                   	push   %rbx
+  800a99:	48 83 ec 08          	sub    $0x8,%rsp
+  800a9d:	48 89 fb             	mov    %rdi,%rbx
+  800aa0:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800aa3:	48 b8 19 09 80 00 00 	movabs $0x800919,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800aaf:	49 39 c5             	cmp    %rax,%r13
+  800ab2:	73 0e                	jae    800ac2 <realloc+0x32>
+}
+  800ab4:	48 89 d8             	mov    %rbx,%rax
+  800ab7:	48 83 c4 08          	add    $0x8,%rsp
+  800abb:	5b                   	pop    %rbx
+  800abc:	41 5c                	pop    %r12
+  800abe:	41 5d                	pop    %r13
+  800ac0:	5d                   	pop    %rbp
+  800ac1:	c3                   	ret
+  800ac2:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800ac5:	4c 89 ef             	mov    %r13,%rdi
+  800ac8:	48 b8 0a 07 80 00 00 	movabs $0x80070a,%rax
+  800acf:	00 00 00 
+  800ad2:	ff d0                	call   *%rax
+  800ad4:	48 89 c7             	mov    %rax,%rdi
+  800ad7:	4c 89 e2             	mov    %r12,%rdx
+  800ada:	48 89 de             	mov    %rbx,%rsi
+  800add:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  800ae4:	00 00 00 
+  800ae7:	ff d0                	call   *%rax
+  800ae9:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800aec:	48 89 df             	mov    %rbx,%rdi
+  800aef:	48 b8 85 09 80 00 00 	movabs $0x800985,%rax
+  800af6:	00 00 00 
+  800af9:	ff d0                	call   *%rax
+    return newptr;
+  800afb:	4c 89 e3             	mov    %r12,%rbx
+  800afe:	eb b4                	jmp    800ab4 <realloc+0x24>
+
+0000000000800b00 <strdup>:
+
+char*
+strdup (const char *src) {
+  800b00:	55                   	push   %rbp
+  800b01:	48 89 e5             	mov    %rsp,%rbp
+  800b04:	41 54                	push   %r12
+  800b06:	53                   	push   %rbx
+  800b07:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800b0a:	48 b8 bf 39 80 00 00 	movabs $0x8039bf,%rax
+  800b11:	00 00 00 
+  800b14:	ff d0                	call   *%rax
+  800b16:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b1a:	4c 89 e7             	mov    %r12,%rdi
+  800b1d:	48 b8 0a 07 80 00 00 	movabs $0x80070a,%rax
+  800b24:	00 00 00 
+  800b27:	ff d0                	call   *%rax
+  800b29:	48 89 c7             	mov    %rax,%rdi
+  800b2c:	4c 89 e2             	mov    %r12,%rdx
+  800b2f:	48 89 de             	mov    %rbx,%rsi
+  800b32:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  800b39:	00 00 00 
+  800b3c:	ff d0                	call   *%rax
+}
+  800b3e:	5b                   	pop    %rbx
+  800b3f:	41 5c                	pop    %r12
+  800b41:	5d                   	pop    %rbp
+  800b42:	c3                   	ret
+
+0000000000800b43 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b43:	55                   	push   %rbp
+  800b44:	48 89 e5             	mov    %rsp,%rbp
+  800b47:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b48:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b52:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b5c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b61:	be 00 00 00 00       	mov    $0x0,%esi
+  800b66:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b6c:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b72:	c9                   	leave
+  800b73:	c3                   	ret
+
+0000000000800b74 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800b74:	55                   	push   %rbp
+  800b75:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800b78:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800b7f:	00 00 00 
+  800b82:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b86:	74 26                	je     800bae <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800b88:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b8a:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b8e:	89 c0                	mov    %eax,%eax
+  800b90:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800b93:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800b9a:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800ba1:	00 00 00 
+  800ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ba9:	48 f7 31             	divq   (%rcx)
+}
+  800bac:	5d                   	pop    %rbp
+  800bad:	c3                   	ret
+        freq = get_cpufreq();
+  800bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb3:	48 ba 43 0b 80 00 00 	movabs $0x800b43,%rdx
+  800bba:	00 00 00 
+  800bbd:	ff d2                	call   *%rdx
+  800bbf:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bc6:	00 00 00 
+  800bc9:	eb bd                	jmp    800b88 <get_ticks+0x14>
+
+0000000000800bcb <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bcb:	55                   	push   %rbp
+  800bcc:	48 89 e5             	mov    %rsp,%rbp
+  800bcf:	53                   	push   %rbx
+  800bd0:	48 83 ec 08          	sub    $0x8,%rsp
+  800bd4:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800bd7:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bde:	00 00 00 
+  800be1:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800be5:	74 50                	je     800c37 <sleep+0x6c>
+    asm volatile("rdtsc"
+  800be7:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800be9:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bed:	89 c0                	mov    %eax,%eax
+  800bef:	48 89 d6             	mov    %rdx,%rsi
+  800bf2:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800bf5:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bfc:	00 00 00 
+  800bff:	48 0f af 18          	imul   (%rax),%rbx
+  800c03:	48 c1 eb 03          	shr    $0x3,%rbx
+  800c07:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800c0e:	9b c4 20 
+  800c11:	48 89 d8             	mov    %rbx,%rax
+  800c14:	48 f7 e2             	mul    %rdx
+  800c17:	48 89 d1             	mov    %rdx,%rcx
+  800c1a:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c1e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c20:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c24:	89 c0                	mov    %eax,%eax
+  800c26:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c29:	48 29 f2             	sub    %rsi,%rdx
+  800c2c:	48 39 ca             	cmp    %rcx,%rdx
+  800c2f:	72 ed                	jb     800c1e <sleep+0x53>
+}
+  800c31:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c35:	c9                   	leave
+  800c36:	c3                   	ret
+        freq = get_cpufreq();
+  800c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3c:	48 ba 43 0b 80 00 00 	movabs $0x800b43,%rdx
+  800c43:	00 00 00 
+  800c46:	ff d2                	call   *%rdx
+  800c48:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c4f:	00 00 00 
+  800c52:	eb 93                	jmp    800be7 <sleep+0x1c>
+
+0000000000800c54 <poll_kbd>:
+
+int poll_kbd() {
+  800c54:	55                   	push   %rbp
+  800c55:	48 89 e5             	mov    %rsp,%rbp
+  800c58:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c59:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c63:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c6d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c72:	be 00 00 00 00       	mov    $0x0,%esi
+  800c77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c7d:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c83:	c9                   	leave
+  800c84:	c3                   	ret
+
+0000000000800c85 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800c85:	55                   	push   %rbp
+  800c86:	48 89 e5             	mov    %rsp,%rbp
+  800c89:	53                   	push   %rbx
+  800c8a:	49 89 fa             	mov    %rdi,%r10
+  800c8d:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800c8f:	44 89 c6             	mov    %r8d,%esi
+  800c92:	89 cf                	mov    %ecx,%edi
+  800c94:	89 d3                	mov    %edx,%ebx
+  800c96:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800c98:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c9d:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ca0:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800ca4:	cd 30                	int    $0x30
+  800ca6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800caa:	c9                   	leave
+  800cab:	c3                   	ret
+
+0000000000800cac <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cac:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cb3:	ff ff ff 
+  800cb6:	48 01 f8             	add    %rdi,%rax
+  800cb9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800cbd:	c3                   	ret
+
+0000000000800cbe <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cbe:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cc5:	ff ff ff 
+  800cc8:	48 01 f8             	add    %rdi,%rax
+  800ccb:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800ccf:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800cd5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800cd9:	c3                   	ret
+
+0000000000800cda <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800cda:	55                   	push   %rbp
+  800cdb:	48 89 e5             	mov    %rsp,%rbp
+  800cde:	41 57                	push   %r15
+  800ce0:	41 56                	push   %r14
+  800ce2:	41 55                	push   %r13
+  800ce4:	41 54                	push   %r12
+  800ce6:	53                   	push   %rbx
+  800ce7:	48 83 ec 08          	sub    $0x8,%rsp
+  800ceb:	49 89 ff             	mov    %rdi,%r15
+  800cee:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800cf3:	49 bd 8e 2b 80 00 00 	movabs $0x802b8e,%r13
+  800cfa:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800cfd:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800d03:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800d06:	48 89 df             	mov    %rbx,%rdi
+  800d09:	41 ff d5             	call   *%r13
+  800d0c:	83 e0 04             	and    $0x4,%eax
+  800d0f:	74 17                	je     800d28 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800d11:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d18:	4c 39 f3             	cmp    %r14,%rbx
+  800d1b:	75 e6                	jne    800d03 <fd_alloc+0x29>
+  800d1d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d23:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d28:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d2b:	48 83 c4 08          	add    $0x8,%rsp
+  800d2f:	5b                   	pop    %rbx
+  800d30:	41 5c                	pop    %r12
+  800d32:	41 5d                	pop    %r13
+  800d34:	41 5e                	pop    %r14
+  800d36:	41 5f                	pop    %r15
+  800d38:	5d                   	pop    %rbp
+  800d39:	c3                   	ret
+
+0000000000800d3a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d3a:	83 ff 1f             	cmp    $0x1f,%edi
+  800d3d:	77 39                	ja     800d78 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d3f:	55                   	push   %rbp
+  800d40:	48 89 e5             	mov    %rsp,%rbp
+  800d43:	41 54                	push   %r12
+  800d45:	53                   	push   %rbx
+  800d46:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d49:	48 63 df             	movslq %edi,%rbx
+  800d4c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d53:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d57:	48 89 df             	mov    %rbx,%rdi
+  800d5a:	48 b8 8e 2b 80 00 00 	movabs $0x802b8e,%rax
+  800d61:	00 00 00 
+  800d64:	ff d0                	call   *%rax
+  800d66:	a8 04                	test   $0x4,%al
+  800d68:	74 14                	je     800d7e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d6a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d73:	5b                   	pop    %rbx
+  800d74:	41 5c                	pop    %r12
+  800d76:	5d                   	pop    %rbp
+  800d77:	c3                   	ret
+        return -E_INVAL;
+  800d78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d7d:	c3                   	ret
+        return -E_INVAL;
+  800d7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d83:	eb ee                	jmp    800d73 <fd_lookup+0x39>
+
+0000000000800d85 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d85:	55                   	push   %rbp
+  800d86:	48 89 e5             	mov    %rsp,%rbp
+  800d89:	41 54                	push   %r12
+  800d8b:	53                   	push   %rbx
+  800d8c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800d8f:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800d96:	00 00 00 
+  800d99:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800da0:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800da3:	39 3b                	cmp    %edi,(%rbx)
+  800da5:	74 47                	je     800dee <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800da7:	48 83 c0 08          	add    $0x8,%rax
+  800dab:	48 8b 18             	mov    (%rax),%rbx
+  800dae:	48 85 db             	test   %rbx,%rbx
+  800db1:	75 f0                	jne    800da3 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800db3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800dba:	00 00 00 
+  800dbd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800dc3:	89 fa                	mov    %edi,%edx
+  800dc5:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  800dcc:	00 00 00 
+  800dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd4:	48 b9 85 30 80 00 00 	movabs $0x803085,%rcx
+  800ddb:	00 00 00 
+  800dde:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800de0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800de5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800de9:	5b                   	pop    %rbx
+  800dea:	41 5c                	pop    %r12
+  800dec:	5d                   	pop    %rbp
+  800ded:	c3                   	ret
+            return 0;
+  800dee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df3:	eb f0                	jmp    800de5 <dev_lookup+0x60>
+
+0000000000800df5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800df5:	55                   	push   %rbp
+  800df6:	48 89 e5             	mov    %rsp,%rbp
+  800df9:	41 55                	push   %r13
+  800dfb:	41 54                	push   %r12
+  800dfd:	53                   	push   %rbx
+  800dfe:	48 83 ec 18          	sub    $0x18,%rsp
+  800e02:	48 89 fb             	mov    %rdi,%rbx
+  800e05:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800e08:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800e0f:	ff ff ff 
+  800e12:	48 01 df             	add    %rbx,%rdi
+  800e15:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800e19:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e1d:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  800e24:	00 00 00 
+  800e27:	ff d0                	call   *%rax
+  800e29:	41 89 c5             	mov    %eax,%r13d
+  800e2c:	85 c0                	test   %eax,%eax
+  800e2e:	78 06                	js     800e36 <fd_close+0x41>
+  800e30:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e34:	74 1a                	je     800e50 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e36:	45 84 e4             	test   %r12b,%r12b
+  800e39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e42:	44 89 e8             	mov    %r13d,%eax
+  800e45:	48 83 c4 18          	add    $0x18,%rsp
+  800e49:	5b                   	pop    %rbx
+  800e4a:	41 5c                	pop    %r12
+  800e4c:	41 5d                	pop    %r13
+  800e4e:	5d                   	pop    %rbp
+  800e4f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e50:	8b 3b                	mov    (%rbx),%edi
+  800e52:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e56:	48 b8 85 0d 80 00 00 	movabs $0x800d85,%rax
+  800e5d:	00 00 00 
+  800e60:	ff d0                	call   *%rax
+  800e62:	41 89 c5             	mov    %eax,%r13d
+  800e65:	85 c0                	test   %eax,%eax
+  800e67:	78 1b                	js     800e84 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e69:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e6d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800e71:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e77:	48 85 c0             	test   %rax,%rax
+  800e7a:	74 08                	je     800e84 <fd_close+0x8f>
+  800e7c:	48 89 df             	mov    %rbx,%rdi
+  800e7f:	ff d0                	call   *%rax
+  800e81:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800e84:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e89:	48 89 de             	mov    %rbx,%rsi
+  800e8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e91:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  800e98:	00 00 00 
+  800e9b:	ff d0                	call   *%rax
+    return res;
+  800e9d:	eb a3                	jmp    800e42 <fd_close+0x4d>
+
+0000000000800e9f <close>:
+
+int
+close(int fdnum) {
+  800e9f:	55                   	push   %rbp
+  800ea0:	48 89 e5             	mov    %rsp,%rbp
+  800ea3:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800ea7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800eab:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  800eb2:	00 00 00 
+  800eb5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800eb7:	85 c0                	test   %eax,%eax
+  800eb9:	78 15                	js     800ed0 <close+0x31>
+
+    return fd_close(fd, 1);
+  800ebb:	be 01 00 00 00       	mov    $0x1,%esi
+  800ec0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800ec4:	48 b8 f5 0d 80 00 00 	movabs $0x800df5,%rax
+  800ecb:	00 00 00 
+  800ece:	ff d0                	call   *%rax
+}
+  800ed0:	c9                   	leave
+  800ed1:	c3                   	ret
+
+0000000000800ed2 <close_all>:
+
+void
+close_all(void) {
+  800ed2:	55                   	push   %rbp
+  800ed3:	48 89 e5             	mov    %rsp,%rbp
+  800ed6:	41 54                	push   %r12
+  800ed8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800ed9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ede:	49 bc 9f 0e 80 00 00 	movabs $0x800e9f,%r12
+  800ee5:	00 00 00 
+  800ee8:	89 df                	mov    %ebx,%edi
+  800eea:	41 ff d4             	call   *%r12
+  800eed:	83 c3 01             	add    $0x1,%ebx
+  800ef0:	83 fb 20             	cmp    $0x20,%ebx
+  800ef3:	75 f3                	jne    800ee8 <close_all+0x16>
+}
+  800ef5:	5b                   	pop    %rbx
+  800ef6:	41 5c                	pop    %r12
+  800ef8:	5d                   	pop    %rbp
+  800ef9:	c3                   	ret
+
+0000000000800efa <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800efa:	55                   	push   %rbp
+  800efb:	48 89 e5             	mov    %rsp,%rbp
+  800efe:	41 57                	push   %r15
+  800f00:	41 56                	push   %r14
+  800f02:	41 55                	push   %r13
+  800f04:	41 54                	push   %r12
+  800f06:	53                   	push   %rbx
+  800f07:	48 83 ec 18          	sub    $0x18,%rsp
+  800f0b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800f0e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800f12:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  800f19:	00 00 00 
+  800f1c:	ff d0                	call   *%rax
+  800f1e:	89 c3                	mov    %eax,%ebx
+  800f20:	85 c0                	test   %eax,%eax
+  800f22:	0f 88 b8 00 00 00    	js     800fe0 <dup+0xe6>
+    close(newfdnum);
+  800f28:	44 89 e7             	mov    %r12d,%edi
+  800f2b:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  800f32:	00 00 00 
+  800f35:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f37:	4d 63 ec             	movslq %r12d,%r13
+  800f3a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f41:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f45:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f49:	4c 89 ff             	mov    %r15,%rdi
+  800f4c:	49 be be 0c 80 00 00 	movabs $0x800cbe,%r14
+  800f53:	00 00 00 
+  800f56:	41 ff d6             	call   *%r14
+  800f59:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f5c:	4c 89 ef             	mov    %r13,%rdi
+  800f5f:	41 ff d6             	call   *%r14
+  800f62:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f65:	48 89 df             	mov    %rbx,%rdi
+  800f68:	48 b8 8e 2b 80 00 00 	movabs $0x802b8e,%rax
+  800f6f:	00 00 00 
+  800f72:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800f74:	a8 04                	test   $0x4,%al
+  800f76:	74 2b                	je     800fa3 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800f78:	41 89 c1             	mov    %eax,%r9d
+  800f7b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f81:	4c 89 f1             	mov    %r14,%rcx
+  800f84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f89:	48 89 de             	mov    %rbx,%rsi
+  800f8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f91:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  800f98:	00 00 00 
+  800f9b:	ff d0                	call   *%rax
+  800f9d:	89 c3                	mov    %eax,%ebx
+  800f9f:	85 c0                	test   %eax,%eax
+  800fa1:	78 4e                	js     800ff1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800fa3:	4c 89 ff             	mov    %r15,%rdi
+  800fa6:	48 b8 8e 2b 80 00 00 	movabs $0x802b8e,%rax
+  800fad:	00 00 00 
+  800fb0:	ff d0                	call   *%rax
+  800fb2:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800fb5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fbb:	4c 89 e9             	mov    %r13,%rcx
+  800fbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc3:	4c 89 fe             	mov    %r15,%rsi
+  800fc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fcb:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  800fd2:	00 00 00 
+  800fd5:	ff d0                	call   *%rax
+  800fd7:	89 c3                	mov    %eax,%ebx
+  800fd9:	85 c0                	test   %eax,%eax
+  800fdb:	78 14                	js     800ff1 <dup+0xf7>
+
+    return newfdnum;
+  800fdd:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800fe0:	89 d8                	mov    %ebx,%eax
+  800fe2:	48 83 c4 18          	add    $0x18,%rsp
+  800fe6:	5b                   	pop    %rbx
+  800fe7:	41 5c                	pop    %r12
+  800fe9:	41 5d                	pop    %r13
+  800feb:	41 5e                	pop    %r14
+  800fed:	41 5f                	pop    %r15
+  800fef:	5d                   	pop    %rbp
+  800ff0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800ff1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ff6:	4c 89 ee             	mov    %r13,%rsi
+  800ff9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ffe:	49 bc 75 04 80 00 00 	movabs $0x800475,%r12
+  801005:	00 00 00 
+  801008:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80100b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801010:	4c 89 f6             	mov    %r14,%rsi
+  801013:	bf 00 00 00 00       	mov    $0x0,%edi
+  801018:	41 ff d4             	call   *%r12
+    return res;
+  80101b:	eb c3                	jmp    800fe0 <dup+0xe6>
+
+000000000080101d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80101d:	55                   	push   %rbp
+  80101e:	48 89 e5             	mov    %rsp,%rbp
+  801021:	41 56                	push   %r14
+  801023:	41 55                	push   %r13
+  801025:	41 54                	push   %r12
+  801027:	53                   	push   %rbx
+  801028:	48 83 ec 10          	sub    $0x10,%rsp
+  80102c:	89 fb                	mov    %edi,%ebx
+  80102e:	49 89 f4             	mov    %rsi,%r12
+  801031:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801034:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801038:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  80103f:	00 00 00 
+  801042:	ff d0                	call   *%rax
+  801044:	85 c0                	test   %eax,%eax
+  801046:	78 4c                	js     801094 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801048:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80104c:	41 8b 3e             	mov    (%r14),%edi
+  80104f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801053:	48 b8 85 0d 80 00 00 	movabs $0x800d85,%rax
+  80105a:	00 00 00 
+  80105d:	ff d0                	call   *%rax
+  80105f:	85 c0                	test   %eax,%eax
+  801061:	78 35                	js     801098 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801063:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801067:	83 e0 03             	and    $0x3,%eax
+  80106a:	83 f8 01             	cmp    $0x1,%eax
+  80106d:	74 2d                	je     80109c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80106f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801073:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801077:	48 85 c0             	test   %rax,%rax
+  80107a:	74 56                	je     8010d2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80107c:	4c 89 ea             	mov    %r13,%rdx
+  80107f:	4c 89 e6             	mov    %r12,%rsi
+  801082:	4c 89 f7             	mov    %r14,%rdi
+  801085:	ff d0                	call   *%rax
+}
+  801087:	48 83 c4 10          	add    $0x10,%rsp
+  80108b:	5b                   	pop    %rbx
+  80108c:	41 5c                	pop    %r12
+  80108e:	41 5d                	pop    %r13
+  801090:	41 5e                	pop    %r14
+  801092:	5d                   	pop    %rbp
+  801093:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801094:	48 98                	cltq
+  801096:	eb ef                	jmp    801087 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801098:	48 98                	cltq
+  80109a:	eb eb                	jmp    801087 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80109c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8010a3:	00 00 00 
+  8010a6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8010ac:	89 da                	mov    %ebx,%edx
+  8010ae:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  8010b5:	00 00 00 
+  8010b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010bd:	48 b9 85 30 80 00 00 	movabs $0x803085,%rcx
+  8010c4:	00 00 00 
+  8010c7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010c9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8010d0:	eb b5                	jmp    801087 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010d2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8010d9:	eb ac                	jmp    801087 <read+0x6a>
+
+00000000008010db <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8010db:	55                   	push   %rbp
+  8010dc:	48 89 e5             	mov    %rsp,%rbp
+  8010df:	41 57                	push   %r15
+  8010e1:	41 56                	push   %r14
+  8010e3:	41 55                	push   %r13
+  8010e5:	41 54                	push   %r12
+  8010e7:	53                   	push   %rbx
+  8010e8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8010ec:	48 85 d2             	test   %rdx,%rdx
+  8010ef:	74 54                	je     801145 <readn+0x6a>
+  8010f1:	41 89 fd             	mov    %edi,%r13d
+  8010f4:	49 89 f6             	mov    %rsi,%r14
+  8010f7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8010fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8010ff:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801104:	49 bf 1d 10 80 00 00 	movabs $0x80101d,%r15
+  80110b:	00 00 00 
+  80110e:	4c 89 e2             	mov    %r12,%rdx
+  801111:	48 29 f2             	sub    %rsi,%rdx
+  801114:	4c 01 f6             	add    %r14,%rsi
+  801117:	44 89 ef             	mov    %r13d,%edi
+  80111a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80111d:	85 c0                	test   %eax,%eax
+  80111f:	78 20                	js     801141 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801121:	01 c3                	add    %eax,%ebx
+  801123:	85 c0                	test   %eax,%eax
+  801125:	74 08                	je     80112f <readn+0x54>
+  801127:	48 63 f3             	movslq %ebx,%rsi
+  80112a:	4c 39 e6             	cmp    %r12,%rsi
+  80112d:	72 df                	jb     80110e <readn+0x33>
+    }
+    return res;
+  80112f:	48 63 c3             	movslq %ebx,%rax
+}
+  801132:	48 83 c4 08          	add    $0x8,%rsp
+  801136:	5b                   	pop    %rbx
+  801137:	41 5c                	pop    %r12
+  801139:	41 5d                	pop    %r13
+  80113b:	41 5e                	pop    %r14
+  80113d:	41 5f                	pop    %r15
+  80113f:	5d                   	pop    %rbp
+  801140:	c3                   	ret
+        if (inc < 0) return inc;
+  801141:	48 98                	cltq
+  801143:	eb ed                	jmp    801132 <readn+0x57>
+    int inc = 1, res = 0;
+  801145:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114a:	eb e3                	jmp    80112f <readn+0x54>
+
+000000000080114c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80114c:	55                   	push   %rbp
+  80114d:	48 89 e5             	mov    %rsp,%rbp
+  801150:	41 56                	push   %r14
+  801152:	41 55                	push   %r13
+  801154:	41 54                	push   %r12
+  801156:	53                   	push   %rbx
+  801157:	48 83 ec 10          	sub    $0x10,%rsp
+  80115b:	89 fb                	mov    %edi,%ebx
+  80115d:	49 89 f4             	mov    %rsi,%r12
+  801160:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801163:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801167:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  80116e:	00 00 00 
+  801171:	ff d0                	call   *%rax
+  801173:	85 c0                	test   %eax,%eax
+  801175:	78 47                	js     8011be <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801177:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80117b:	41 8b 3e             	mov    (%r14),%edi
+  80117e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801182:	48 b8 85 0d 80 00 00 	movabs $0x800d85,%rax
+  801189:	00 00 00 
+  80118c:	ff d0                	call   *%rax
+  80118e:	85 c0                	test   %eax,%eax
+  801190:	78 30                	js     8011c2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801192:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801197:	74 2d                	je     8011c6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801199:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80119d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8011a1:	48 85 c0             	test   %rax,%rax
+  8011a4:	74 56                	je     8011fc <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8011a6:	4c 89 ea             	mov    %r13,%rdx
+  8011a9:	4c 89 e6             	mov    %r12,%rsi
+  8011ac:	4c 89 f7             	mov    %r14,%rdi
+  8011af:	ff d0                	call   *%rax
+}
+  8011b1:	48 83 c4 10          	add    $0x10,%rsp
+  8011b5:	5b                   	pop    %rbx
+  8011b6:	41 5c                	pop    %r12
+  8011b8:	41 5d                	pop    %r13
+  8011ba:	41 5e                	pop    %r14
+  8011bc:	5d                   	pop    %rbp
+  8011bd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011be:	48 98                	cltq
+  8011c0:	eb ef                	jmp    8011b1 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011c2:	48 98                	cltq
+  8011c4:	eb eb                	jmp    8011b1 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011c6:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8011cd:	00 00 00 
+  8011d0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8011d6:	89 da                	mov    %ebx,%edx
+  8011d8:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  8011df:	00 00 00 
+  8011e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e7:	48 b9 85 30 80 00 00 	movabs $0x803085,%rcx
+  8011ee:	00 00 00 
+  8011f1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8011f3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011fa:	eb b5                	jmp    8011b1 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8011fc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801203:	eb ac                	jmp    8011b1 <write+0x65>
+
+0000000000801205 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801205:	55                   	push   %rbp
+  801206:	48 89 e5             	mov    %rsp,%rbp
+  801209:	53                   	push   %rbx
+  80120a:	48 83 ec 18          	sub    $0x18,%rsp
+  80120e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801210:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801214:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  80121b:	00 00 00 
+  80121e:	ff d0                	call   *%rax
+  801220:	85 c0                	test   %eax,%eax
+  801222:	78 0c                	js     801230 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801224:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801228:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80122b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801230:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801234:	c9                   	leave
+  801235:	c3                   	ret
+
+0000000000801236 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  801236:	55                   	push   %rbp
+  801237:	48 89 e5             	mov    %rsp,%rbp
+  80123a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80123e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801242:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  801249:	00 00 00 
+  80124c:	ff d0                	call   *%rax
+  80124e:	85 c0                	test   %eax,%eax
+  801250:	78 07                	js     801259 <tell+0x23>
+    return fdes->fd_offset;
+  801252:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801256:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  801259:	c9                   	leave
+  80125a:	c3                   	ret
+
+000000000080125b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80125b:	55                   	push   %rbp
+  80125c:	48 89 e5             	mov    %rsp,%rbp
+  80125f:	41 55                	push   %r13
+  801261:	41 54                	push   %r12
+  801263:	53                   	push   %rbx
+  801264:	48 83 ec 18          	sub    $0x18,%rsp
+  801268:	89 fb                	mov    %edi,%ebx
+  80126a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80126d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801271:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  801278:	00 00 00 
+  80127b:	ff d0                	call   *%rax
+  80127d:	85 c0                	test   %eax,%eax
+  80127f:	78 38                	js     8012b9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801281:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801285:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801289:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80128d:	48 b8 85 0d 80 00 00 	movabs $0x800d85,%rax
+  801294:	00 00 00 
+  801297:	ff d0                	call   *%rax
+  801299:	85 c0                	test   %eax,%eax
+  80129b:	78 1c                	js     8012b9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80129d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8012a2:	74 20                	je     8012c4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8012a8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8012ac:	48 85 c0             	test   %rax,%rax
+  8012af:	74 47                	je     8012f8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8012b1:	44 89 e6             	mov    %r12d,%esi
+  8012b4:	4c 89 ef             	mov    %r13,%rdi
+  8012b7:	ff d0                	call   *%rax
+}
+  8012b9:	48 83 c4 18          	add    $0x18,%rsp
+  8012bd:	5b                   	pop    %rbx
+  8012be:	41 5c                	pop    %r12
+  8012c0:	41 5d                	pop    %r13
+  8012c2:	5d                   	pop    %rbp
+  8012c3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8012c4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8012cb:	00 00 00 
+  8012ce:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012d4:	89 da                	mov    %ebx,%edx
+  8012d6:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  8012dd:	00 00 00 
+  8012e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e5:	48 b9 85 30 80 00 00 	movabs $0x803085,%rcx
+  8012ec:	00 00 00 
+  8012ef:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8012f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012f6:	eb c1                	jmp    8012b9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012f8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8012fd:	eb ba                	jmp    8012b9 <ftruncate+0x5e>
+
+00000000008012ff <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8012ff:	55                   	push   %rbp
+  801300:	48 89 e5             	mov    %rsp,%rbp
+  801303:	41 54                	push   %r12
+  801305:	53                   	push   %rbx
+  801306:	48 83 ec 10          	sub    $0x10,%rsp
+  80130a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80130d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801311:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  801318:	00 00 00 
+  80131b:	ff d0                	call   *%rax
+  80131d:	85 c0                	test   %eax,%eax
+  80131f:	78 4e                	js     80136f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801321:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801325:	41 8b 3c 24          	mov    (%r12),%edi
+  801329:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80132d:	48 b8 85 0d 80 00 00 	movabs $0x800d85,%rax
+  801334:	00 00 00 
+  801337:	ff d0                	call   *%rax
+  801339:	85 c0                	test   %eax,%eax
+  80133b:	78 32                	js     80136f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80133d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801341:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801346:	74 30                	je     801378 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801348:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80134b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801352:	00 00 00 
+    stat->st_isdir = 0;
+  801355:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80135c:	00 00 00 
+    stat->st_dev = dev;
+  80135f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801366:	48 89 de             	mov    %rbx,%rsi
+  801369:	4c 89 e7             	mov    %r12,%rdi
+  80136c:	ff 50 28             	call   *0x28(%rax)
+}
+  80136f:	48 83 c4 10          	add    $0x10,%rsp
+  801373:	5b                   	pop    %rbx
+  801374:	41 5c                	pop    %r12
+  801376:	5d                   	pop    %rbp
+  801377:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801378:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80137d:	eb f0                	jmp    80136f <fstat+0x70>
+
+000000000080137f <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80137f:	55                   	push   %rbp
+  801380:	48 89 e5             	mov    %rsp,%rbp
+  801383:	41 54                	push   %r12
+  801385:	53                   	push   %rbx
+  801386:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80138d:	41 89 fc             	mov    %edi,%r12d
+  801390:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801392:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801396:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  80139d:	00 00 00 
+  8013a0:	ff d0                	call   *%rax
+  8013a2:	85 c0                	test   %eax,%eax
+  8013a4:	78 31                	js     8013d7 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8013a6:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8013ad:	44 89 e7             	mov    %r12d,%edi
+  8013b0:	48 b8 ff 12 80 00 00 	movabs $0x8012ff,%rax
+  8013b7:	00 00 00 
+  8013ba:	ff d0                	call   *%rax
+  8013bc:	85 c0                	test   %eax,%eax
+  8013be:	78 17                	js     8013d7 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8013c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c4:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8013c7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8013ca:	39 d3                	cmp    %edx,%ebx
+  8013cc:	0f 4f da             	cmovg  %edx,%ebx
+  8013cf:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8013d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013d7:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8013de:	5b                   	pop    %rbx
+  8013df:	41 5c                	pop    %r12
+  8013e1:	5d                   	pop    %rbp
+  8013e2:	c3                   	ret
+
+00000000008013e3 <seektoend>:
+{
+  8013e3:	55                   	push   %rbp
+  8013e4:	48 89 e5             	mov    %rsp,%rbp
+  8013e7:	53                   	push   %rbx
+  8013e8:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8013ef:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8013f1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013f5:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  8013fc:	00 00 00 
+  8013ff:	ff d0                	call   *%rax
+  801401:	85 c0                	test   %eax,%eax
+  801403:	78 28                	js     80142d <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  801405:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80140c:	89 df                	mov    %ebx,%edi
+  80140e:	48 b8 ff 12 80 00 00 	movabs $0x8012ff,%rax
+  801415:	00 00 00 
+  801418:	ff d0                	call   *%rax
+  80141a:	85 c0                	test   %eax,%eax
+  80141c:	78 0f                	js     80142d <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80141e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801421:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801425:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  801428:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80142d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801431:	c9                   	leave
+  801432:	c3                   	ret
+
+0000000000801433 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801433:	55                   	push   %rbp
+  801434:	48 89 e5             	mov    %rsp,%rbp
+  801437:	41 54                	push   %r12
+  801439:	53                   	push   %rbx
+  80143a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80143d:	be 00 00 00 00       	mov    $0x0,%esi
+  801442:	48 b8 26 20 80 00 00 	movabs $0x802026,%rax
+  801449:	00 00 00 
+  80144c:	ff d0                	call   *%rax
+  80144e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801450:	85 c0                	test   %eax,%eax
+  801452:	78 25                	js     801479 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801454:	4c 89 e6             	mov    %r12,%rsi
+  801457:	89 c7                	mov    %eax,%edi
+  801459:	48 b8 ff 12 80 00 00 	movabs $0x8012ff,%rax
+  801460:	00 00 00 
+  801463:	ff d0                	call   *%rax
+  801465:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801468:	89 df                	mov    %ebx,%edi
+  80146a:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  801471:	00 00 00 
+  801474:	ff d0                	call   *%rax
+
+    return res;
+  801476:	44 89 e3             	mov    %r12d,%ebx
+}
+  801479:	89 d8                	mov    %ebx,%eax
+  80147b:	5b                   	pop    %rbx
+  80147c:	41 5c                	pop    %r12
+  80147e:	5d                   	pop    %rbp
+  80147f:	c3                   	ret
+
+0000000000801480 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  801480:	55                   	push   %rbp
+  801481:	48 89 e5             	mov    %rsp,%rbp
+  801484:	53                   	push   %rbx
+  801485:	48 83 ec 08          	sub    $0x8,%rsp
+  801489:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80148c:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  801493:	00 00 00 
+  801496:	ff d0                	call   *%rax
+  801498:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80149c:	0f 87 ea 00 00 00    	ja     80158c <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8014a2:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014a9:	00 00 00 
+  8014ac:	80 38 00             	cmpb   $0x0,(%rax)
+  8014af:	75 35                	jne    8014e6 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8014b1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014b6:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8014bb:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8014c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014c5:	48 b8 96 02 80 00 00 	movabs $0x800296,%rax
+  8014cc:	00 00 00 
+  8014cf:	ff d0                	call   *%rax
+  8014d1:	85 c0                	test   %eax,%eax
+  8014d3:	0f 88 ba 00 00 00    	js     801593 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8014d9:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014e0:	00 00 00 
+  8014e3:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8014e6:	48 89 df             	mov    %rbx,%rdi
+  8014e9:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  8014f0:	00 00 00 
+  8014f3:	ff d0                	call   *%rax
+  8014f5:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8014f9:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  801500:	00 00 00 
+  801503:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  801507:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  80150a:	39 39                	cmp    %edi,(%rcx)
+  80150c:	74 46                	je     801554 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80150e:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  801512:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  801519:	00 
+  80151a:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  801521:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  801528:	00 
+  801529:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  801530:	00 
+  801531:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  801538:	00 
+  801539:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  801540:	00 
+  801541:	89 39                	mov    %edi,(%rcx)
+  801543:	48 01 c6             	add    %rax,%rsi
+  801546:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  80154b:	48 89 c8             	mov    %rcx,%rax
+  80154e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801552:	c9                   	leave
+  801553:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  801554:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  801558:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80155f:	00 00 00 
+  801562:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801565:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  801569:	74 e0                	je     80154b <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80156b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  801572:	00 
+  801573:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  801577:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  80157e:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  801580:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801583:	48 01 c2             	add    %rax,%rdx
+  801586:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80158a:	eb bf                	jmp    80154b <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80158c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801591:	eb b8                	jmp    80154b <fbuf_get+0xcb>
+            return NULL;
+  801593:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801598:	eb b1                	jmp    80154b <fbuf_get+0xcb>
+
+000000000080159a <fsipc_bulk>:
+fsipc_bulk(void) {
+  80159a:	55                   	push   %rbp
+  80159b:	48 89 e5             	mov    %rsp,%rbp
+  80159e:	53                   	push   %rbx
+  80159f:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8015a3:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015aa:	00 00 00 
+  8015ad:	48 8b 18             	mov    (%rax),%rbx
+  8015b0:	48 85 db             	test   %rbx,%rbx
+  8015b3:	74 16                	je     8015cb <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8015b5:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015bc:	00 00 00 
+  8015bf:	48 8b 18             	mov    (%rax),%rbx
+}
+  8015c2:	48 89 d8             	mov    %rbx,%rax
+  8015c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c9:	c9                   	leave
+  8015ca:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8015cb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015d0:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8015d5:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8015da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015df:	48 b8 96 02 80 00 00 	movabs $0x800296,%rax
+  8015e6:	00 00 00 
+  8015e9:	ff d0                	call   *%rax
+  8015eb:	85 c0                	test   %eax,%eax
+  8015ed:	78 d3                	js     8015c2 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8015ef:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8015f4:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8015fb:	00 00 00 
+  8015fe:	eb b5                	jmp    8015b5 <fsipc_bulk+0x1b>
+
+0000000000801600 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  801600:	55                   	push   %rbp
+  801601:	48 89 e5             	mov    %rsp,%rbp
+  801604:	41 57                	push   %r15
+  801606:	41 56                	push   %r14
+  801608:	41 55                	push   %r13
+  80160a:	41 54                	push   %r12
+  80160c:	53                   	push   %rbx
+  80160d:	48 83 ec 08          	sub    $0x8,%rsp
+  801611:	41 89 fd             	mov    %edi,%r13d
+  801614:	49 89 f6             	mov    %rsi,%r14
+  801617:	49 89 d7             	mov    %rdx,%r15
+  80161a:	48 89 cb             	mov    %rcx,%rbx
+  80161d:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801620:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801627:	00 00 00 
+  80162a:	83 38 00             	cmpl   $0x0,(%rax)
+  80162d:	74 52                	je     801681 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80162f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801635:	4c 89 f9             	mov    %r15,%rcx
+  801638:	4c 89 f2             	mov    %r14,%rdx
+  80163b:	44 89 ee             	mov    %r13d,%esi
+  80163e:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801645:	00 00 00 
+  801648:	8b 38                	mov    (%rax),%edi
+  80164a:	48 b8 84 41 80 00 00 	movabs $0x804184,%rax
+  801651:	00 00 00 
+  801654:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  801656:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80165b:	4c 89 e2             	mov    %r12,%rdx
+  80165e:	48 89 de             	mov    %rbx,%rsi
+  801661:	bf 00 00 00 00       	mov    $0x0,%edi
+  801666:	48 b8 d4 3f 80 00 00 	movabs $0x803fd4,%rax
+  80166d:	00 00 00 
+  801670:	ff d0                	call   *%rax
+}
+  801672:	48 83 c4 08          	add    $0x8,%rsp
+  801676:	5b                   	pop    %rbx
+  801677:	41 5c                	pop    %r12
+  801679:	41 5d                	pop    %r13
+  80167b:	41 5e                	pop    %r14
+  80167d:	41 5f                	pop    %r15
+  80167f:	5d                   	pop    %rbp
+  801680:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801681:	bf 03 00 00 00       	mov    $0x3,%edi
+  801686:	48 b8 27 42 80 00 00 	movabs $0x804227,%rax
+  80168d:	00 00 00 
+  801690:	ff d0                	call   *%rax
+  801692:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  801699:	00 00 
+  80169b:	eb 92                	jmp    80162f <fsipc_region+0x2f>
+
+000000000080169d <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80169d:	55                   	push   %rbp
+  80169e:	48 89 e5             	mov    %rsp,%rbp
+  8016a1:	41 57                	push   %r15
+  8016a3:	41 56                	push   %r14
+  8016a5:	41 55                	push   %r13
+  8016a7:	41 54                	push   %r12
+  8016a9:	53                   	push   %rbx
+  8016aa:	48 83 ec 28          	sub    $0x28,%rsp
+  8016ae:	49 89 ff             	mov    %rdi,%r15
+  8016b1:	49 89 f6             	mov    %rsi,%r14
+  8016b4:	48 89 d3             	mov    %rdx,%rbx
+  8016b7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016bb:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8016be:	48 b8 9a 15 80 00 00 	movabs $0x80159a,%rax
+  8016c5:	00 00 00 
+  8016c8:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8016ca:	48 85 c0             	test   %rax,%rax
+  8016cd:	0f 84 cc 00 00 00    	je     80179f <devfile_write_direct+0x102>
+  8016d3:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8016d6:	48 85 db             	test   %rbx,%rbx
+  8016d9:	0f 84 ba 00 00 00    	je     801799 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8016df:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016e5:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8016ec:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8016f0:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8016f4:	4c 29 e3             	sub    %r12,%rbx
+  8016f7:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8016fc:	48 39 c3             	cmp    %rax,%rbx
+  8016ff:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  801703:	48 89 da             	mov    %rbx,%rdx
+  801706:	4c 89 f6             	mov    %r14,%rsi
+  801709:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80170d:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  801714:	00 00 00 
+  801717:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  801719:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80171d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  801721:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801724:	44 01 e0             	add    %r12d,%eax
+  801727:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  80172b:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80172f:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  801736:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80173d:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  801744:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80174a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80174f:	4c 89 ee             	mov    %r13,%rsi
+  801752:	bf 04 00 00 00       	mov    $0x4,%edi
+  801757:	48 b8 00 16 80 00 00 	movabs $0x801600,%rax
+  80175e:	00 00 00 
+  801761:	ff d0                	call   *%rax
+        if (res < 0)
+  801763:	85 c0                	test   %eax,%eax
+  801765:	78 29                	js     801790 <devfile_write_direct+0xf3>
+        if (res == 0)
+  801767:	74 2b                	je     801794 <devfile_write_direct+0xf7>
+        i += res;
+  801769:	48 98                	cltq
+  80176b:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  80176e:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  801771:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801775:	49 39 c4             	cmp    %rax,%r12
+  801778:	0f 82 72 ff ff ff    	jb     8016f0 <devfile_write_direct+0x53>
+    return i;
+  80177e:	4c 89 e0             	mov    %r12,%rax
+}
+  801781:	48 83 c4 28          	add    $0x28,%rsp
+  801785:	5b                   	pop    %rbx
+  801786:	41 5c                	pop    %r12
+  801788:	41 5d                	pop    %r13
+  80178a:	41 5e                	pop    %r14
+  80178c:	41 5f                	pop    %r15
+  80178e:	5d                   	pop    %rbp
+  80178f:	c3                   	ret
+            return res;
+  801790:	48 98                	cltq
+  801792:	eb ed                	jmp    801781 <devfile_write_direct+0xe4>
+            return i;
+  801794:	4c 89 e0             	mov    %r12,%rax
+  801797:	eb e8                	jmp    801781 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  801799:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  80179d:	eb df                	jmp    80177e <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  80179f:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8017a6:	eb d9                	jmp    801781 <devfile_write_direct+0xe4>
+
+00000000008017a8 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8017a8:	55                   	push   %rbp
+  8017a9:	48 89 e5             	mov    %rsp,%rbp
+  8017ac:	41 56                	push   %r14
+  8017ae:	41 55                	push   %r13
+  8017b0:	41 54                	push   %r12
+  8017b2:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8017b3:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8017b7:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8017bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c0:	4d 39 ee             	cmp    %r13,%r14
+  8017c3:	0f 84 99 00 00 00    	je     801862 <fbuf_flush+0xba>
+  8017c9:	49 89 fc             	mov    %rdi,%r12
+  8017cc:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8017cf:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017d2:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8017d6:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  8017dd:	00 00 00 
+  8017e0:	ff d0                	call   *%rax
+  8017e2:	48 89 c2             	mov    %rax,%rdx
+  8017e5:	48 c1 e2 04          	shl    $0x4,%rdx
+  8017e9:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8017ed:	48 c1 e0 0c          	shl    $0xc,%rax
+  8017f1:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8017f6:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017f9:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8017fd:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801804:	00 
+  801805:	44 89 f1             	mov    %r14d,%ecx
+  801808:	4c 89 ea             	mov    %r13,%rdx
+  80180b:	4c 89 e7             	mov    %r12,%rdi
+  80180e:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  801815:	00 00 00 
+  801818:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80181a:	48 85 c0             	test   %rax,%rax
+  80181d:	78 43                	js     801862 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80181f:	4c 39 e8             	cmp    %r13,%rax
+  801822:	72 47                	jb     80186b <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  801824:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  801829:	83 c0 01             	add    $0x1,%eax
+  80182c:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801831:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  801834:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801838:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  80183c:	72 0f                	jb     80184d <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  80183e:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  801842:	48 39 c2             	cmp    %rax,%rdx
+  801845:	48 0f 42 d0          	cmovb  %rax,%rdx
+  801849:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  80184d:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  801854:	00 
+  801855:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  80185c:	00 
+    return 0;
+  80185d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801862:	5b                   	pop    %rbx
+  801863:	41 5c                	pop    %r12
+  801865:	41 5d                	pop    %r13
+  801867:	41 5e                	pop    %r14
+  801869:	5d                   	pop    %rbp
+  80186a:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  80186b:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801870:	eb f0                	jmp    801862 <fbuf_flush+0xba>
+
+0000000000801872 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  801872:	55                   	push   %rbp
+  801873:	48 89 e5             	mov    %rsp,%rbp
+  801876:	53                   	push   %rbx
+  801877:	48 83 ec 08          	sub    $0x8,%rsp
+  80187b:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  80187e:	48 b8 80 14 80 00 00 	movabs $0x801480,%rax
+  801885:	00 00 00 
+  801888:	ff d0                	call   *%rax
+  80188a:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  80188d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801892:	48 85 f6             	test   %rsi,%rsi
+  801895:	74 0f                	je     8018a6 <devfile_sync+0x34>
+  801897:	48 89 df             	mov    %rbx,%rdi
+  80189a:	48 b8 a8 17 80 00 00 	movabs $0x8017a8,%rax
+  8018a1:	00 00 00 
+  8018a4:	ff d0                	call   *%rax
+}
+  8018a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018aa:	c9                   	leave
+  8018ab:	c3                   	ret
+
+00000000008018ac <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8018ac:	55                   	push   %rbp
+  8018ad:	48 89 e5             	mov    %rsp,%rbp
+  8018b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8018b4:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8018b7:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8018be:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8018bf:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8018c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018c8:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8018cf:	00 00 00 
+  8018d2:	48 b8 00 16 80 00 00 	movabs $0x801600,%rax
+  8018d9:	00 00 00 
+  8018dc:	ff d0                	call   *%rax
+}
+  8018de:	c9                   	leave
+  8018df:	c3                   	ret
+
+00000000008018e0 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018e0:	55                   	push   %rbp
+  8018e1:	48 89 e5             	mov    %rsp,%rbp
+  8018e4:	41 54                	push   %r12
+  8018e6:	53                   	push   %rbx
+  8018e7:	48 89 fb             	mov    %rdi,%rbx
+  8018ea:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8018ed:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  8018f4:	00 00 00 
+  8018f7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018f9:	85 c0                	test   %eax,%eax
+  8018fb:	78 63                	js     801960 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018fd:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801900:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  801907:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  801909:	be 00 00 00 00       	mov    $0x0,%esi
+  80190e:	bf 05 00 00 00       	mov    $0x5,%edi
+  801913:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  80191a:	00 00 00 
+  80191d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80191f:	85 c0                	test   %eax,%eax
+  801921:	78 3d                	js     801960 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801923:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80192a:	00 00 00 
+  80192d:	48 89 de             	mov    %rbx,%rsi
+  801930:	4c 89 e7             	mov    %r12,%rdi
+  801933:	48 b8 fd 39 80 00 00 	movabs $0x8039fd,%rax
+  80193a:	00 00 00 
+  80193d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80193f:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  801945:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  80194c:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80194d:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  801953:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  80195a:	00 
+
+    return 0;
+  80195b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801960:	5b                   	pop    %rbx
+  801961:	41 5c                	pop    %r12
+  801963:	5d                   	pop    %rbp
+  801964:	c3                   	ret
+
+0000000000801965 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801965:	55                   	push   %rbp
+  801966:	48 89 e5             	mov    %rsp,%rbp
+  801969:	41 54                	push   %r12
+  80196b:	53                   	push   %rbx
+  80196c:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  80196f:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  801976:	00 00 00 
+  801979:	ff d0                	call   *%rax
+  80197b:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  80197e:	48 89 df             	mov    %rbx,%rdi
+  801981:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  801988:	00 00 00 
+  80198b:	ff d0                	call   *%rax
+  80198d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801991:	76 2e                	jbe    8019c1 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  801993:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801996:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80199d:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  80199f:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019a9:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  8019b0:	00 00 00 
+  8019b3:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019b5:	45 85 e4             	test   %r12d,%r12d
+  8019b8:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019bc:	5b                   	pop    %rbx
+  8019bd:	41 5c                	pop    %r12
+  8019bf:	5d                   	pop    %rbp
+  8019c0:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8019c1:	48 89 df             	mov    %rbx,%rdi
+  8019c4:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  8019cb:	00 00 00 
+  8019ce:	ff d0                	call   *%rax
+  8019d0:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8019d4:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8019db:	00 00 00 
+  8019de:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8019e5:	48 89 df             	mov    %rbx,%rdi
+  8019e8:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  8019ef:	00 00 00 
+  8019f2:	ff d0                	call   *%rax
+  8019f4:	48 89 c6             	mov    %rax,%rsi
+  8019f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a01:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  801a08:	00 00 00 
+  801a0b:	ff d0                	call   *%rax
+  801a0d:	eb 84                	jmp    801993 <devfile_flush+0x2e>
+
+0000000000801a0f <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801a0f:	55                   	push   %rbp
+  801a10:	48 89 e5             	mov    %rsp,%rbp
+  801a13:	41 55                	push   %r13
+  801a15:	41 54                	push   %r12
+  801a17:	53                   	push   %rbx
+  801a18:	48 83 ec 08          	sub    $0x8,%rsp
+  801a1c:	48 89 fb             	mov    %rdi,%rbx
+  801a1f:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a22:	48 b8 80 14 80 00 00 	movabs $0x801480,%rax
+  801a29:	00 00 00 
+  801a2c:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a2e:	48 85 c0             	test   %rax,%rax
+  801a31:	74 51                	je     801a84 <devfile_trunc+0x75>
+  801a33:	49 89 c4             	mov    %rax,%r12
+  801a36:	48 89 c6             	mov    %rax,%rsi
+  801a39:	48 89 df             	mov    %rbx,%rdi
+  801a3c:	48 b8 a8 17 80 00 00 	movabs $0x8017a8,%rax
+  801a43:	00 00 00 
+  801a46:	ff d0                	call   *%rax
+  801a48:	85 c0                	test   %eax,%eax
+  801a4a:	78 2d                	js     801a79 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a4c:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a53:	00 00 00 
+  801a56:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a59:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a5b:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a5f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a64:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a69:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801a70:	00 00 00 
+  801a73:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a75:	85 c0                	test   %eax,%eax
+  801a77:	79 3e                	jns    801ab7 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801a79:	48 83 c4 08          	add    $0x8,%rsp
+  801a7d:	5b                   	pop    %rbx
+  801a7e:	41 5c                	pop    %r12
+  801a80:	41 5d                	pop    %r13
+  801a82:	5d                   	pop    %rbp
+  801a83:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a84:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a8b:	00 00 00 
+  801a8e:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a91:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a93:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a97:	be 00 00 00 00       	mov    $0x0,%esi
+  801a9c:	bf 02 00 00 00       	mov    $0x2,%edi
+  801aa1:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  801aa8:	00 00 00 
+  801aab:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801aad:	85 c0                	test   %eax,%eax
+  801aaf:	78 c8                	js     801a79 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801ab1:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801ab5:	eb c2                	jmp    801a79 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801ab7:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801aba:	8d 51 01             	lea    0x1(%rcx),%edx
+  801abd:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801ac0:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801ac5:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801acc:	00 00 
+  801ace:	eb a9                	jmp    801a79 <devfile_trunc+0x6a>
+
+0000000000801ad0 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801ad0:	55                   	push   %rbp
+  801ad1:	48 89 e5             	mov    %rsp,%rbp
+  801ad4:	41 57                	push   %r15
+  801ad6:	41 56                	push   %r14
+  801ad8:	41 55                	push   %r13
+  801ada:	41 54                	push   %r12
+  801adc:	53                   	push   %rbx
+  801add:	48 83 ec 28          	sub    $0x28,%rsp
+  801ae1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ae5:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801ae9:	49 89 d7             	mov    %rdx,%r15
+  801aec:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801af0:	48 b8 80 14 80 00 00 	movabs $0x801480,%rax
+  801af7:	00 00 00 
+  801afa:	ff d0                	call   *%rax
+  801afc:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801aff:	48 85 c0             	test   %rax,%rax
+  801b02:	74 31                	je     801b35 <devfile_write+0x65>
+  801b04:	4c 89 f8             	mov    %r15,%rax
+  801b07:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801b0e:	77 25                	ja     801b35 <devfile_write+0x65>
+    size_t i = 0;
+  801b10:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801b16:	48 85 c0             	test   %rax,%rax
+  801b19:	0f 85 64 01 00 00    	jne    801c83 <devfile_write+0x1b3>
+    size_t i = 0;
+  801b1f:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b23:	4c 89 f8             	mov    %r15,%rax
+}
+  801b26:	48 83 c4 28          	add    $0x28,%rsp
+  801b2a:	5b                   	pop    %rbx
+  801b2b:	41 5c                	pop    %r12
+  801b2d:	41 5d                	pop    %r13
+  801b2f:	41 5e                	pop    %r14
+  801b31:	41 5f                	pop    %r15
+  801b33:	5d                   	pop    %rbp
+  801b34:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b35:	48 85 db             	test   %rbx,%rbx
+  801b38:	74 5b                	je     801b95 <devfile_write+0xc5>
+  801b3a:	48 89 de             	mov    %rbx,%rsi
+  801b3d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b41:	48 b8 a8 17 80 00 00 	movabs $0x8017a8,%rax
+  801b48:	00 00 00 
+  801b4b:	ff d0                	call   *%rax
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	78 40                	js     801b91 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b51:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b55:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801b58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b5c:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b60:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  801b67:	00 00 00 
+  801b6a:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b6c:	48 85 c0             	test   %rax,%rax
+  801b6f:	7e b5                	jle    801b26 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801b71:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801b75:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801b78:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801b7b:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801b7e:	8d 51 01             	lea    0x1(%rcx),%edx
+  801b81:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b84:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801b87:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801b8e:	00 
+  801b8f:	eb 95                	jmp    801b26 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b91:	48 98                	cltq
+  801b93:	eb 91                	jmp    801b26 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b95:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801b99:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801b9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba0:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801ba4:	48 89 df             	mov    %rbx,%rdi
+  801ba7:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  801bae:	00 00 00 
+  801bb1:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801bb3:	48 85 c0             	test   %rax,%rax
+  801bb6:	0f 8e 6a ff ff ff    	jle    801b26 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801bbc:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801bbf:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801bc3:	e9 5e ff ff ff       	jmp    801b26 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bc8:	48 98                	cltq
+  801bca:	4d 85 ff             	test   %r15,%r15
+  801bcd:	49 0f 45 c7          	cmovne %r15,%rax
+  801bd1:	e9 50 ff ff ff       	jmp    801b26 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bd6:	48 89 de             	mov    %rbx,%rsi
+  801bd9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801bdd:	48 b8 a8 17 80 00 00 	movabs $0x8017a8,%rax
+  801be4:	00 00 00 
+  801be7:	ff d0                	call   *%rax
+  801be9:	85 c0                	test   %eax,%eax
+  801beb:	0f 88 2b 01 00 00    	js     801d1c <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801bf1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801bf5:	4c 01 f8             	add    %r15,%rax
+  801bf8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801bfc:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c00:	48 b9 ac 0c 80 00 00 	movabs $0x800cac,%rcx
+  801c07:	00 00 00 
+  801c0a:	ff d1                	call   *%rcx
+  801c0c:	48 89 c2             	mov    %rax,%rdx
+  801c0f:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c13:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801c17:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c1b:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c20:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c23:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c2a:	00 
+  801c2b:	4c 89 ea             	mov    %r13,%rdx
+  801c2e:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c32:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  801c39:	00 00 00 
+  801c3c:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c3e:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c42:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801c46:	48 39 c2             	cmp    %rax,%rdx
+  801c49:	0f 84 db 00 00 00    	je     801d2a <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801c4f:	4c 39 e2             	cmp    %r12,%rdx
+  801c52:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801c56:	4d 01 ec             	add    %r13,%r12
+  801c59:	49 39 c4             	cmp    %rax,%r12
+  801c5c:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801c60:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801c64:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801c68:	45 01 ee             	add    %r13d,%r14d
+  801c6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c6f:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801c73:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801c76:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c7a:	49 39 c7             	cmp    %rax,%r15
+  801c7d:	0f 83 a0 fe ff ff    	jae    801b23 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801c83:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c87:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801c8b:	8b 43 08             	mov    0x8(%rbx),%eax
+  801c8e:	44 39 f0             	cmp    %r14d,%eax
+  801c91:	7f 10                	jg     801ca3 <devfile_write+0x1d3>
+  801c93:	48 98                	cltq
+  801c95:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801c9b:	49 63 d6             	movslq %r14d,%rdx
+  801c9e:	48 39 d0             	cmp    %rdx,%rax
+  801ca1:	7d 2d                	jge    801cd0 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801ca3:	48 89 de             	mov    %rbx,%rsi
+  801ca6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801caa:	48 b8 a8 17 80 00 00 	movabs $0x8017a8,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	0f 88 0a ff ff ff    	js     801bc8 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801cbe:	44 89 f0             	mov    %r14d,%eax
+  801cc1:	66 b8 00 00          	mov    $0x0,%ax
+  801cc5:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801cc8:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801ccf:	00 
+        size_t off = pos - fb->fb_base;
+  801cd0:	45 89 f4             	mov    %r14d,%r12d
+  801cd3:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801cd7:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801cda:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801cde:	4d 29 fd             	sub    %r15,%r13
+  801ce1:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801ce6:	4c 29 e0             	sub    %r12,%rax
+  801ce9:	49 39 c5             	cmp    %rax,%r13
+  801cec:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801cf0:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801cf4:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801cf8:	48 39 c2             	cmp    %rax,%rdx
+  801cfb:	0f 84 f0 fe ff ff    	je     801bf1 <devfile_write+0x121>
+  801d01:	4c 39 e0             	cmp    %r12,%rax
+  801d04:	0f 82 cc fe ff ff    	jb     801bd6 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801d0a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d0e:	48 39 d0             	cmp    %rdx,%rax
+  801d11:	0f 83 da fe ff ff    	jae    801bf1 <devfile_write+0x121>
+  801d17:	e9 ba fe ff ff       	jmp    801bd6 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d1c:	48 98                	cltq
+  801d1e:	4d 85 ff             	test   %r15,%r15
+  801d21:	49 0f 45 c7          	cmovne %r15,%rax
+  801d25:	e9 fc fd ff ff       	jmp    801b26 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d2a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d2e:	4c 89 e2             	mov    %r12,%rdx
+  801d31:	e9 2a ff ff ff       	jmp    801c60 <devfile_write+0x190>
+
+0000000000801d36 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d36:	55                   	push   %rbp
+  801d37:	48 89 e5             	mov    %rsp,%rbp
+  801d3a:	41 57                	push   %r15
+  801d3c:	41 56                	push   %r14
+  801d3e:	41 55                	push   %r13
+  801d40:	41 54                	push   %r12
+  801d42:	53                   	push   %rbx
+  801d43:	48 83 ec 28          	sub    $0x28,%rsp
+  801d47:	49 89 ff             	mov    %rdi,%r15
+  801d4a:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801d4e:	48 89 d3             	mov    %rdx,%rbx
+  801d51:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801d55:	48 b8 80 14 80 00 00 	movabs $0x801480,%rax
+  801d5c:	00 00 00 
+  801d5f:	ff d0                	call   *%rax
+  801d61:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801d64:	48 85 c0             	test   %rax,%rax
+  801d67:	74 0d                	je     801d76 <devfile_read+0x40>
+  801d69:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801d70:	0f 86 1a 01 00 00    	jbe    801e90 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801d76:	4d 85 e4             	test   %r12,%r12
+  801d79:	74 1a                	je     801d95 <devfile_read+0x5f>
+  801d7b:	4c 89 e6             	mov    %r12,%rsi
+  801d7e:	4c 89 ff             	mov    %r15,%rdi
+  801d81:	48 b8 a8 17 80 00 00 	movabs $0x8017a8,%rax
+  801d88:	00 00 00 
+  801d8b:	ff d0                	call   *%rax
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	0f 88 e8 00 00 00    	js     801e7d <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801d95:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801d99:	48 b8 9a 15 80 00 00 	movabs $0x80159a,%rax
+  801da0:	00 00 00 
+  801da3:	ff d0                	call   *%rax
+  801da5:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801da8:	48 85 c0             	test   %rax,%rax
+  801dab:	0f 84 69 02 00 00    	je     80201a <devfile_read+0x2e4>
+    while (i < n) {
+  801db1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801db6:	0f 84 ce 00 00 00    	je     801e8a <devfile_read+0x154>
+    size_t i = 0;
+  801dbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801dc1:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801dc8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dcc:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801dd0:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801dd4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801dd8:	48 29 da             	sub    %rbx,%rdx
+  801ddb:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801de0:	48 39 c2             	cmp    %rax,%rdx
+  801de3:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801de7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801deb:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801def:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801df2:	01 d8                	add    %ebx,%eax
+  801df4:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801df8:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801dfc:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801e03:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801e0a:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801e11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e1c:	4c 89 ee             	mov    %r13,%rsi
+  801e1f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e24:	48 b8 00 16 80 00 00 	movabs $0x801600,%rax
+  801e2b:	00 00 00 
+  801e2e:	ff d0                	call   *%rax
+        if (res < 0)
+  801e30:	85 c0                	test   %eax,%eax
+  801e32:	78 4d                	js     801e81 <devfile_read+0x14b>
+        if (res == 0)
+  801e34:	74 4f                	je     801e85 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e36:	4c 63 e0             	movslq %eax,%r12
+  801e39:	4c 89 e2             	mov    %r12,%rdx
+  801e3c:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e40:	4c 89 f7             	mov    %r14,%rdi
+  801e43:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  801e4a:	00 00 00 
+  801e4d:	ff d0                	call   *%rax
+        i += res;
+  801e4f:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801e52:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801e55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e59:	48 39 c3             	cmp    %rax,%rbx
+  801e5c:	0f 82 72 ff ff ff    	jb     801dd4 <devfile_read+0x9e>
+    return i;
+  801e62:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801e65:	48 85 c0             	test   %rax,%rax
+  801e68:	7e 04                	jle    801e6e <devfile_read+0x138>
+  801e6a:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801e6e:	48 83 c4 28          	add    $0x28,%rsp
+  801e72:	5b                   	pop    %rbx
+  801e73:	41 5c                	pop    %r12
+  801e75:	41 5d                	pop    %r13
+  801e77:	41 5e                	pop    %r14
+  801e79:	41 5f                	pop    %r15
+  801e7b:	5d                   	pop    %rbp
+  801e7c:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801e7d:	48 98                	cltq
+  801e7f:	eb ed                	jmp    801e6e <devfile_read+0x138>
+            return res;
+  801e81:	48 98                	cltq
+  801e83:	eb e9                	jmp    801e6e <devfile_read+0x138>
+            return i;
+  801e85:	48 89 d8             	mov    %rbx,%rax
+  801e88:	eb db                	jmp    801e65 <devfile_read+0x12f>
+    size_t i = 0;
+  801e8a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801e8e:	eb d2                	jmp    801e62 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801e90:	48 89 c6             	mov    %rax,%rsi
+  801e93:	4c 89 ff             	mov    %r15,%rdi
+  801e96:	48 b8 a8 17 80 00 00 	movabs $0x8017a8,%rax
+  801e9d:	00 00 00 
+  801ea0:	ff d0                	call   *%rax
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 40                	js     801ee6 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801ea6:	4c 89 ff             	mov    %r15,%rdi
+  801ea9:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  801eb0:	00 00 00 
+  801eb3:	ff d0                	call   *%rax
+  801eb5:	48 89 c2             	mov    %rax,%rdx
+  801eb8:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ebc:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801ec0:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ec4:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801ec9:	48 01 d0             	add    %rdx,%rax
+  801ecc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801ed0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ed5:	0f 84 33 01 00 00    	je     80200e <devfile_read+0x2d8>
+    size_t i = 0;
+  801edb:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801ee1:	e9 f5 00 00 00       	jmp    801fdb <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801ee6:	48 98                	cltq
+  801ee8:	eb 84                	jmp    801e6e <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801eea:	44 89 e8             	mov    %r13d,%eax
+  801eed:	66 b8 00 00          	mov    $0x0,%ax
+  801ef1:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801ef6:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801efd:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801eff:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801f03:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801f07:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801f09:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801f0e:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801f11:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801f18:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801f19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f24:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f29:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f2e:	48 b8 00 16 80 00 00 	movabs $0x801600,%rax
+  801f35:	00 00 00 
+  801f38:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	0f 88 be 00 00 00    	js     802000 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f42:	48 63 d0             	movslq %eax,%rdx
+  801f45:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801f4a:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801f4f:	44 39 e8             	cmp    %r13d,%eax
+  801f52:	0f 8e ba 00 00 00    	jle    802012 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801f58:	49 63 c5             	movslq %r13d,%rax
+  801f5b:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801f60:	48 29 c3             	sub    %rax,%rbx
+  801f63:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801f68:	48 01 c3             	add    %rax,%rbx
+  801f6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f6f:	4c 29 f0             	sub    %r14,%rax
+  801f72:	48 39 c3             	cmp    %rax,%rbx
+  801f75:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801f79:	4c 89 ff             	mov    %r15,%rdi
+  801f7c:	48 b9 ac 0c 80 00 00 	movabs $0x800cac,%rcx
+  801f83:	00 00 00 
+  801f86:	ff d1                	call   *%rcx
+  801f88:	48 89 c2             	mov    %rax,%rdx
+  801f8b:	48 c1 e2 04          	shl    $0x4,%rdx
+  801f8f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801f93:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f97:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801f9c:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801f9f:	44 89 ea             	mov    %r13d,%edx
+  801fa2:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  801fa7:	48 63 d2             	movslq %edx,%rdx
+  801faa:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801fb1:	00 
+  801fb2:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801fb6:	4c 01 f7             	add    %r14,%rdi
+  801fb9:	48 89 da             	mov    %rbx,%rdx
+  801fbc:	48 b9 f2 3d 80 00 00 	movabs $0x803df2,%rcx
+  801fc3:	00 00 00 
+  801fc6:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  801fc8:	41 01 dd             	add    %ebx,%r13d
+  801fcb:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  801fcf:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  801fd2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fd6:	49 39 c6             	cmp    %rax,%r14
+  801fd9:	73 37                	jae    802012 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  801fdb:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  801fdf:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801fe4:	44 39 e8             	cmp    %r13d,%eax
+  801fe7:	0f 8f fd fe ff ff    	jg     801eea <devfile_read+0x1b4>
+  801fed:	41 03 44 24 10       	add    0x10(%r12),%eax
+  801ff2:	44 39 e8             	cmp    %r13d,%eax
+  801ff5:	0f 8f 5d ff ff ff    	jg     801f58 <devfile_read+0x222>
+  801ffb:	e9 ea fe ff ff       	jmp    801eea <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  802000:	48 98                	cltq
+  802002:	4d 85 f6             	test   %r14,%r14
+  802005:	49 0f 45 c6          	cmovne %r14,%rax
+  802009:	e9 60 fe ff ff       	jmp    801e6e <devfile_read+0x138>
+    size_t i = 0;
+  80200e:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  802012:	4c 89 f0             	mov    %r14,%rax
+  802015:	e9 54 fe ff ff       	jmp    801e6e <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80201a:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802021:	e9 48 fe ff ff       	jmp    801e6e <devfile_read+0x138>
+
+0000000000802026 <open>:
+open(const char *path, int mode) {
+  802026:	55                   	push   %rbp
+  802027:	48 89 e5             	mov    %rsp,%rbp
+  80202a:	41 55                	push   %r13
+  80202c:	41 54                	push   %r12
+  80202e:	53                   	push   %rbx
+  80202f:	48 83 ec 18          	sub    $0x18,%rsp
+  802033:	49 89 fc             	mov    %rdi,%r12
+  802036:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802039:	48 b8 bf 39 80 00 00 	movabs $0x8039bf,%rax
+  802040:	00 00 00 
+  802043:	ff d0                	call   *%rax
+  802045:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80204b:	0f 87 8a 00 00 00    	ja     8020db <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802051:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802055:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  80205c:	00 00 00 
+  80205f:	ff d0                	call   *%rax
+  802061:	89 c3                	mov    %eax,%ebx
+  802063:	85 c0                	test   %eax,%eax
+  802065:	78 50                	js     8020b7 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802067:	4c 89 e6             	mov    %r12,%rsi
+  80206a:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802071:	00 00 00 
+  802074:	48 89 df             	mov    %rbx,%rdi
+  802077:	48 b8 fd 39 80 00 00 	movabs $0x8039fd,%rax
+  80207e:	00 00 00 
+  802081:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802083:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80208a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80208e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802093:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  80209a:	00 00 00 
+  80209d:	ff d0                	call   *%rax
+  80209f:	89 c3                	mov    %eax,%ebx
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	78 1f                	js     8020c4 <open+0x9e>
+    return fd2num(fd);
+  8020a5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020a9:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  8020b0:	00 00 00 
+  8020b3:	ff d0                	call   *%rax
+  8020b5:	89 c3                	mov    %eax,%ebx
+}
+  8020b7:	89 d8                	mov    %ebx,%eax
+  8020b9:	48 83 c4 18          	add    $0x18,%rsp
+  8020bd:	5b                   	pop    %rbx
+  8020be:	41 5c                	pop    %r12
+  8020c0:	41 5d                	pop    %r13
+  8020c2:	5d                   	pop    %rbp
+  8020c3:	c3                   	ret
+        fd_close(fd, 0);
+  8020c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020c9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020cd:	48 b8 f5 0d 80 00 00 	movabs $0x800df5,%rax
+  8020d4:	00 00 00 
+  8020d7:	ff d0                	call   *%rax
+        return res;
+  8020d9:	eb dc                	jmp    8020b7 <open+0x91>
+        return -E_BAD_PATH;
+  8020db:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020e0:	eb d5                	jmp    8020b7 <open+0x91>
+
+00000000008020e2 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8020e2:	55                   	push   %rbp
+  8020e3:	48 89 e5             	mov    %rsp,%rbp
+  8020e6:	41 57                	push   %r15
+  8020e8:	41 56                	push   %r14
+  8020ea:	41 55                	push   %r13
+  8020ec:	41 54                	push   %r12
+  8020ee:	53                   	push   %rbx
+  8020ef:	48 83 ec 18          	sub    $0x18,%rsp
+  8020f3:	41 89 f6             	mov    %esi,%r14d
+  8020f6:	49 89 d7             	mov    %rdx,%r15
+  8020f9:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020fc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802100:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80210c:	85 c0                	test   %eax,%eax
+  80210e:	0f 88 db 00 00 00    	js     8021ef <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802114:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802118:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80211f:	00 00 00 
+  802122:	8b 00                	mov    (%rax),%eax
+  802124:	39 07                	cmp    %eax,(%rdi)
+  802126:	0f 85 db 00 00 00    	jne    802207 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80212c:	45 85 f6             	test   %r14d,%r14d
+  80212f:	0f 88 db 00 00 00    	js     802210 <fmap+0x12e>
+  802135:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80213c:	0f 85 d7 00 00 00    	jne    802219 <fmap+0x137>
+  802142:	4c 89 fb             	mov    %r15,%rbx
+  802145:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80214b:	0f 85 d1 00 00 00    	jne    802222 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802151:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  802158:	00 00 00 
+  80215b:	ff d0                	call   *%rax
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	0f 88 8e 00 00 00    	js     8021f3 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802165:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80216c:	00 00 00 
+    while (i < n) {
+  80216f:	4d 85 ed             	test   %r13,%r13
+  802172:	0f 84 8a 00 00 00    	je     802202 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  802178:	4c 89 ea             	mov    %r13,%rdx
+  80217b:	48 29 da             	sub    %rbx,%rdx
+  80217e:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  802185:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80218b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80218f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802193:	8b 40 0c             	mov    0xc(%rax),%eax
+  802196:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80219a:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  80219e:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8021a3:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8021a8:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8021ac:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8021b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021b5:	4c 89 e6             	mov    %r12,%rsi
+  8021b8:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021bd:	48 b8 00 16 80 00 00 	movabs $0x801600,%rax
+  8021c4:	00 00 00 
+  8021c7:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021c9:	85 c0                	test   %eax,%eax
+  8021cb:	78 2a                	js     8021f7 <fmap+0x115>
+        i += res;
+  8021cd:	48 98                	cltq
+  8021cf:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8021d2:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8021d6:	72 05                	jb     8021dd <fmap+0xfb>
+    while (i < n) {
+  8021d8:	4c 39 eb             	cmp    %r13,%rbx
+  8021db:	72 9b                	jb     802178 <fmap+0x96>
+    }
+    return i;
+  8021dd:	48 89 d8             	mov    %rbx,%rax
+}
+  8021e0:	48 83 c4 18          	add    $0x18,%rsp
+  8021e4:	5b                   	pop    %rbx
+  8021e5:	41 5c                	pop    %r12
+  8021e7:	41 5d                	pop    %r13
+  8021e9:	41 5e                	pop    %r14
+  8021eb:	41 5f                	pop    %r15
+  8021ed:	5d                   	pop    %rbp
+  8021ee:	c3                   	ret
+    if (res < 0) return res;
+  8021ef:	48 98                	cltq
+  8021f1:	eb ed                	jmp    8021e0 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8021f3:	48 98                	cltq
+  8021f5:	eb e9                	jmp    8021e0 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021f7:	48 98                	cltq
+  8021f9:	48 85 db             	test   %rbx,%rbx
+  8021fc:	48 0f 45 c3          	cmovne %rbx,%rax
+  802200:	eb de                	jmp    8021e0 <fmap+0xfe>
+    size_t i = 0;
+  802202:	4c 89 eb             	mov    %r13,%rbx
+  802205:	eb d6                	jmp    8021dd <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802207:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80220e:	eb d0                	jmp    8021e0 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802210:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802217:	eb c7                	jmp    8021e0 <fmap+0xfe>
+  802219:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802220:	eb be                	jmp    8021e0 <fmap+0xfe>
+  802222:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802229:	eb b5                	jmp    8021e0 <fmap+0xfe>
+
+000000000080222b <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80222b:	55                   	push   %rbp
+  80222c:	48 89 e5             	mov    %rsp,%rbp
+  80222f:	41 56                	push   %r14
+  802231:	41 55                	push   %r13
+  802233:	41 54                	push   %r12
+  802235:	53                   	push   %rbx
+  802236:	48 83 ec 10          	sub    $0x10,%rsp
+  80223a:	89 fb                	mov    %edi,%ebx
+  80223c:	41 89 f4             	mov    %esi,%r12d
+  80223f:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802242:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802246:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  80224d:	00 00 00 
+  802250:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802252:	85 c0                	test   %eax,%eax
+  802254:	78 63                	js     8022b9 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  802256:	45 85 e4             	test   %r12d,%r12d
+  802259:	0f 88 80 00 00 00    	js     8022df <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80225f:	45 89 e6             	mov    %r12d,%r14d
+  802262:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  802269:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80226d:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  802274:	00 00 00 
+  802277:	ff d0                	call   *%rax
+  802279:	48 89 c2             	mov    %rax,%rdx
+  80227c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802281:	44 89 f6             	mov    %r14d,%esi
+  802284:	89 df                	mov    %ebx,%edi
+  802286:	48 b8 e2 20 80 00 00 	movabs $0x8020e2,%rax
+  80228d:	00 00 00 
+  802290:	ff d0                	call   *%rax
+  802292:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  802295:	45 29 f4             	sub    %r14d,%r12d
+  802298:	4d 63 f4             	movslq %r12d,%r14
+  80229b:	49 39 c6             	cmp    %rax,%r14
+  80229e:	7c 1d                	jl     8022bd <read_map+0x92>
+  8022a0:	48 85 c0             	test   %rax,%rax
+  8022a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a8:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8022ac:	48 83 c4 10          	add    $0x10,%rsp
+  8022b0:	5b                   	pop    %rbx
+  8022b1:	41 5c                	pop    %r12
+  8022b3:	41 5d                	pop    %r13
+  8022b5:	41 5e                	pop    %r14
+  8022b7:	5d                   	pop    %rbp
+  8022b8:	c3                   	ret
+    if (res < 0) return res;
+  8022b9:	48 98                	cltq
+  8022bb:	eb ef                	jmp    8022ac <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8022bd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022c1:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  8022c8:	00 00 00 
+  8022cb:	ff d0                	call   *%rax
+  8022cd:	4d 63 e4             	movslq %r12d,%r12
+  8022d0:	4c 01 e0             	add    %r12,%rax
+  8022d3:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8022d7:	48 89 d8             	mov    %rbx,%rax
+  8022da:	4c 29 f0             	sub    %r14,%rax
+  8022dd:	eb cd                	jmp    8022ac <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8022df:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022e6:	eb c4                	jmp    8022ac <read_map+0x81>
+
+00000000008022e8 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8022e8:	55                   	push   %rbp
+  8022e9:	48 89 e5             	mov    %rsp,%rbp
+  8022ec:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022f0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022f4:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  8022fb:	00 00 00 
+  8022fe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802300:	85 c0                	test   %eax,%eax
+  802302:	78 4a                	js     80234e <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802304:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802308:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80230f:	00 00 00 
+  802312:	8b 00                	mov    (%rax),%eax
+  802314:	39 07                	cmp    %eax,(%rdi)
+  802316:	75 38                	jne    802350 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802318:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  80231f:	00 00 00 
+  802322:	ff d0                	call   *%rax
+  802324:	85 c0                	test   %eax,%eax
+  802326:	78 26                	js     80234e <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802328:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80232c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80232f:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802336:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802338:	be 00 00 00 00       	mov    $0x0,%esi
+  80233d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802342:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  802349:	00 00 00 
+  80234c:	ff d0                	call   *%rax
+}
+  80234e:	c9                   	leave
+  80234f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802350:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802355:	eb f7                	jmp    80234e <fsync+0x66>
+
+0000000000802357 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  802357:	55                   	push   %rbp
+  802358:	48 89 e5             	mov    %rsp,%rbp
+  80235b:	41 57                	push   %r15
+  80235d:	41 56                	push   %r14
+  80235f:	41 55                	push   %r13
+  802361:	41 54                	push   %r12
+  802363:	53                   	push   %rbx
+  802364:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  802368:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80236f:	00 00 00 
+  802372:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  802377:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80237d:	49 bd 3a 0d 80 00 00 	movabs $0x800d3a,%r13
+  802384:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  802387:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  80238e:	00 00 00 
+  802391:	eb 0c                	jmp    80239f <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  802393:	83 c3 01             	add    $0x1,%ebx
+  802396:	49 83 c4 28          	add    $0x28,%r12
+  80239a:	83 fb 20             	cmp    $0x20,%ebx
+  80239d:	74 33                	je     8023d2 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80239f:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8023a4:	74 ed                	je     802393 <flushall+0x3c>
+  8023a6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8023aa:	89 df                	mov    %ebx,%edi
+  8023ac:	41 ff d5             	call   *%r13
+  8023af:	85 c0                	test   %eax,%eax
+  8023b1:	78 e0                	js     802393 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8023b3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023b7:	41 8b 06             	mov    (%r14),%eax
+  8023ba:	39 07                	cmp    %eax,(%rdi)
+  8023bc:	75 d5                	jne    802393 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8023be:	48 b8 72 18 80 00 00 	movabs $0x801872,%rax
+  8023c5:	00 00 00 
+  8023c8:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8023ca:	85 c0                	test   %eax,%eax
+  8023cc:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8023d0:	eb c1                	jmp    802393 <flushall+0x3c>
+    }
+    return res;
+}
+  8023d2:	44 89 f8             	mov    %r15d,%eax
+  8023d5:	48 83 c4 18          	add    $0x18,%rsp
+  8023d9:	5b                   	pop    %rbx
+  8023da:	41 5c                	pop    %r12
+  8023dc:	41 5d                	pop    %r13
+  8023de:	41 5e                	pop    %r14
+  8023e0:	41 5f                	pop    %r15
+  8023e2:	5d                   	pop    %rbp
+  8023e3:	c3                   	ret
+
+00000000008023e4 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8023e4:	55                   	push   %rbp
+  8023e5:	48 89 e5             	mov    %rsp,%rbp
+  8023e8:	53                   	push   %rbx
+  8023e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ed:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8023f0:	40 0f b6 c6          	movzbl %sil,%eax
+  8023f4:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8023fb:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8023fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802402:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802407:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  80240e:	00 00 00 
+  802411:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802413:	85 c0                	test   %eax,%eax
+  802415:	78 23                	js     80243a <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  802417:	ba 58 06 00 00       	mov    $0x658,%edx
+  80241c:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802423:	00 00 00 
+  802426:	48 89 df             	mov    %rbx,%rdi
+  802429:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  802430:	00 00 00 
+  802433:	ff d0                	call   *%rax
+    return 0;
+  802435:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80243a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80243e:	c9                   	leave
+  80243f:	c3                   	ret
+
+0000000000802440 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  802440:	55                   	push   %rbp
+  802441:	48 89 e5             	mov    %rsp,%rbp
+  802444:	53                   	push   %rbx
+  802445:	48 83 ec 08          	sub    $0x8,%rsp
+  802449:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  80244c:	48 b8 bf 39 80 00 00 	movabs $0x8039bf,%rax
+  802453:	00 00 00 
+  802456:	ff d0                	call   *%rax
+  802458:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80245e:	77 35                	ja     802495 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  802460:	48 89 de             	mov    %rbx,%rsi
+  802463:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80246a:	00 00 00 
+  80246d:	48 b8 fd 39 80 00 00 	movabs $0x8039fd,%rax
+  802474:	00 00 00 
+  802477:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  802479:	be 00 00 00 00       	mov    $0x0,%esi
+  80247e:	bf 07 00 00 00       	mov    $0x7,%edi
+  802483:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  80248a:	00 00 00 
+  80248d:	ff d0                	call   *%rax
+}
+  80248f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802493:	c9                   	leave
+  802494:	c3                   	ret
+        return -E_BAD_PATH;
+  802495:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80249a:	eb f3                	jmp    80248f <remove+0x4f>
+
+000000000080249c <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80249c:	55                   	push   %rbp
+  80249d:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8024a0:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  8024a7:	00 00 00 
+  8024aa:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024b6:	48 b8 ac 18 80 00 00 	movabs $0x8018ac,%rax
+  8024bd:	00 00 00 
+  8024c0:	ff d0                	call   *%rax
+}
+  8024c2:	5d                   	pop    %rbp
+  8024c3:	c3                   	ret
+
+00000000008024c4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024c4:	55                   	push   %rbp
+  8024c5:	48 89 e5             	mov    %rsp,%rbp
+  8024c8:	41 54                	push   %r12
+  8024ca:	53                   	push   %rbx
+  8024cb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024ce:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  8024d5:	00 00 00 
+  8024d8:	ff d0                	call   *%rax
+  8024da:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024dd:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  8024e4:	00 00 00 
+  8024e7:	48 89 df             	mov    %rbx,%rdi
+  8024ea:	48 b8 fd 39 80 00 00 	movabs $0x8039fd,%rax
+  8024f1:	00 00 00 
+  8024f4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024f6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024fb:	41 2b 04 24          	sub    (%r12),%eax
+  8024ff:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802505:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80250c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80250f:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802516:	00 00 00 
+  802519:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802520:	b8 00 00 00 00       	mov    $0x0,%eax
+  802525:	5b                   	pop    %rbx
+  802526:	41 5c                	pop    %r12
+  802528:	5d                   	pop    %rbp
+  802529:	c3                   	ret
+
+000000000080252a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80252a:	55                   	push   %rbp
+  80252b:	48 89 e5             	mov    %rsp,%rbp
+  80252e:	41 54                	push   %r12
+  802530:	53                   	push   %rbx
+  802531:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802534:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802539:	48 89 fe             	mov    %rdi,%rsi
+  80253c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802541:	49 bc 75 04 80 00 00 	movabs $0x800475,%r12
+  802548:	00 00 00 
+  80254b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80254e:	48 89 df             	mov    %rbx,%rdi
+  802551:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  802558:	00 00 00 
+  80255b:	ff d0                	call   *%rax
+  80255d:	48 89 c6             	mov    %rax,%rsi
+  802560:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802565:	bf 00 00 00 00       	mov    $0x0,%edi
+  80256a:	41 ff d4             	call   *%r12
+}
+  80256d:	5b                   	pop    %rbx
+  80256e:	41 5c                	pop    %r12
+  802570:	5d                   	pop    %rbp
+  802571:	c3                   	ret
+
+0000000000802572 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802572:	55                   	push   %rbp
+  802573:	48 89 e5             	mov    %rsp,%rbp
+  802576:	41 57                	push   %r15
+  802578:	41 56                	push   %r14
+  80257a:	41 55                	push   %r13
+  80257c:	41 54                	push   %r12
+  80257e:	53                   	push   %rbx
+  80257f:	48 83 ec 18          	sub    $0x18,%rsp
+  802583:	49 89 fc             	mov    %rdi,%r12
+  802586:	49 89 f5             	mov    %rsi,%r13
+  802589:	49 89 d7             	mov    %rdx,%r15
+  80258c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802590:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  802597:	00 00 00 
+  80259a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80259c:	4d 85 ff             	test   %r15,%r15
+  80259f:	0f 84 af 00 00 00    	je     802654 <devpipe_write+0xe2>
+  8025a5:	48 89 c3             	mov    %rax,%rbx
+  8025a8:	4c 89 f8             	mov    %r15,%rax
+  8025ab:	4d 89 ef             	mov    %r13,%r15
+  8025ae:	4c 01 e8             	add    %r13,%rax
+  8025b1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025b5:	49 bd 6a 02 80 00 00 	movabs $0x80026a,%r13
+  8025bc:	00 00 00 
+            sys_yield();
+  8025bf:	49 be 07 02 80 00 00 	movabs $0x800207,%r14
+  8025c6:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025c9:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025cc:	48 63 ce             	movslq %esi,%rcx
+  8025cf:	48 63 03             	movslq (%rbx),%rax
+  8025d2:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025d8:	48 39 c1             	cmp    %rax,%rcx
+  8025db:	72 2e                	jb     80260b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025dd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025e2:	48 89 da             	mov    %rbx,%rdx
+  8025e5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025ea:	4c 89 e7             	mov    %r12,%rdi
+  8025ed:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025f0:	85 c0                	test   %eax,%eax
+  8025f2:	74 66                	je     80265a <devpipe_write+0xe8>
+            sys_yield();
+  8025f4:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025f7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025fa:	48 63 ce             	movslq %esi,%rcx
+  8025fd:	48 63 03             	movslq (%rbx),%rax
+  802600:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802606:	48 39 c1             	cmp    %rax,%rcx
+  802609:	73 d2                	jae    8025dd <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80260b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80260f:	48 89 ca             	mov    %rcx,%rdx
+  802612:	48 c1 ea 03          	shr    $0x3,%rdx
+  802616:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80261d:	08 10 20 
+  802620:	48 f7 e2             	mul    %rdx
+  802623:	48 c1 ea 06          	shr    $0x6,%rdx
+  802627:	48 89 d0             	mov    %rdx,%rax
+  80262a:	48 c1 e0 09          	shl    $0x9,%rax
+  80262e:	48 29 d0             	sub    %rdx,%rax
+  802631:	48 c1 e0 03          	shl    $0x3,%rax
+  802635:	48 29 c1             	sub    %rax,%rcx
+  802638:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80263d:	83 c6 01             	add    $0x1,%esi
+  802640:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802643:	49 83 c7 01          	add    $0x1,%r15
+  802647:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80264b:	49 39 c7             	cmp    %rax,%r15
+  80264e:	0f 85 75 ff ff ff    	jne    8025c9 <devpipe_write+0x57>
+    return n;
+  802654:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802658:	eb 05                	jmp    80265f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80265a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80265f:	48 83 c4 18          	add    $0x18,%rsp
+  802663:	5b                   	pop    %rbx
+  802664:	41 5c                	pop    %r12
+  802666:	41 5d                	pop    %r13
+  802668:	41 5e                	pop    %r14
+  80266a:	41 5f                	pop    %r15
+  80266c:	5d                   	pop    %rbp
+  80266d:	c3                   	ret
+
+000000000080266e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80266e:	55                   	push   %rbp
+  80266f:	48 89 e5             	mov    %rsp,%rbp
+  802672:	41 57                	push   %r15
+  802674:	41 56                	push   %r14
+  802676:	41 55                	push   %r13
+  802678:	41 54                	push   %r12
+  80267a:	53                   	push   %rbx
+  80267b:	48 83 ec 18          	sub    $0x18,%rsp
+  80267f:	49 89 fc             	mov    %rdi,%r12
+  802682:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802686:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80268a:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  802691:	00 00 00 
+  802694:	ff d0                	call   *%rax
+  802696:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802699:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80269f:	49 bd 6a 02 80 00 00 	movabs $0x80026a,%r13
+  8026a6:	00 00 00 
+            sys_yield();
+  8026a9:	49 be 07 02 80 00 00 	movabs $0x800207,%r14
+  8026b0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026b3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026b8:	74 7d                	je     802737 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026ba:	8b 03                	mov    (%rbx),%eax
+  8026bc:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026bf:	75 26                	jne    8026e7 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026c1:	4d 85 ff             	test   %r15,%r15
+  8026c4:	75 77                	jne    80273d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026c6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026cb:	48 89 da             	mov    %rbx,%rdx
+  8026ce:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026d3:	4c 89 e7             	mov    %r12,%rdi
+  8026d6:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	74 72                	je     80274f <devpipe_read+0xe1>
+            sys_yield();
+  8026dd:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026e0:	8b 03                	mov    (%rbx),%eax
+  8026e2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026e5:	74 df                	je     8026c6 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026e7:	48 63 c8             	movslq %eax,%rcx
+  8026ea:	48 89 ca             	mov    %rcx,%rdx
+  8026ed:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026f1:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026f8:	08 10 20 
+  8026fb:	48 89 d0             	mov    %rdx,%rax
+  8026fe:	48 f7 e6             	mul    %rsi
+  802701:	48 c1 ea 06          	shr    $0x6,%rdx
+  802705:	48 89 d0             	mov    %rdx,%rax
+  802708:	48 c1 e0 09          	shl    $0x9,%rax
+  80270c:	48 29 d0             	sub    %rdx,%rax
+  80270f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802716:	00 
+  802717:	48 89 c8             	mov    %rcx,%rax
+  80271a:	48 29 d0             	sub    %rdx,%rax
+  80271d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802722:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802726:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80272a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80272d:	49 83 c7 01          	add    $0x1,%r15
+  802731:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802735:	75 83                	jne    8026ba <devpipe_read+0x4c>
+    return n;
+  802737:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80273b:	eb 03                	jmp    802740 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80273d:	4c 89 f8             	mov    %r15,%rax
+}
+  802740:	48 83 c4 18          	add    $0x18,%rsp
+  802744:	5b                   	pop    %rbx
+  802745:	41 5c                	pop    %r12
+  802747:	41 5d                	pop    %r13
+  802749:	41 5e                	pop    %r14
+  80274b:	41 5f                	pop    %r15
+  80274d:	5d                   	pop    %rbp
+  80274e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80274f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802754:	eb ea                	jmp    802740 <devpipe_read+0xd2>
+
+0000000000802756 <pipe>:
+pipe(int pfd[2]) {
+  802756:	55                   	push   %rbp
+  802757:	48 89 e5             	mov    %rsp,%rbp
+  80275a:	41 55                	push   %r13
+  80275c:	41 54                	push   %r12
+  80275e:	53                   	push   %rbx
+  80275f:	48 83 ec 18          	sub    $0x18,%rsp
+  802763:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802766:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80276a:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  802771:	00 00 00 
+  802774:	ff d0                	call   *%rax
+  802776:	89 c3                	mov    %eax,%ebx
+  802778:	85 c0                	test   %eax,%eax
+  80277a:	0f 88 a0 01 00 00    	js     802920 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802780:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802785:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80278a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80278e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802793:	48 b8 96 02 80 00 00 	movabs $0x800296,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+  80279f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027a1:	85 c0                	test   %eax,%eax
+  8027a3:	0f 88 77 01 00 00    	js     802920 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027a9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8027ad:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+  8027b9:	89 c3                	mov    %eax,%ebx
+  8027bb:	85 c0                	test   %eax,%eax
+  8027bd:	0f 88 43 01 00 00    	js     802906 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027c3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027cd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027d6:	48 b8 96 02 80 00 00 	movabs $0x800296,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+  8027e2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027e4:	85 c0                	test   %eax,%eax
+  8027e6:	0f 88 1a 01 00 00    	js     802906 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027ec:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027f0:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  8027f7:	00 00 00 
+  8027fa:	ff d0                	call   *%rax
+  8027fc:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027ff:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802804:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802809:	48 89 c6             	mov    %rax,%rsi
+  80280c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802811:	48 b8 96 02 80 00 00 	movabs $0x800296,%rax
+  802818:	00 00 00 
+  80281b:	ff d0                	call   *%rax
+  80281d:	89 c3                	mov    %eax,%ebx
+  80281f:	85 c0                	test   %eax,%eax
+  802821:	0f 88 c5 00 00 00    	js     8028ec <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802827:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80282b:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  802832:	00 00 00 
+  802835:	ff d0                	call   *%rax
+  802837:	48 89 c1             	mov    %rax,%rcx
+  80283a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802840:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802846:	ba 00 00 00 00       	mov    $0x0,%edx
+  80284b:	4c 89 ee             	mov    %r13,%rsi
+  80284e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802853:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+  80285f:	89 c3                	mov    %eax,%ebx
+  802861:	85 c0                	test   %eax,%eax
+  802863:	78 6e                	js     8028d3 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802865:	be 00 10 00 00       	mov    $0x1000,%esi
+  80286a:	4c 89 ef             	mov    %r13,%rdi
+  80286d:	48 b8 38 02 80 00 00 	movabs $0x800238,%rax
+  802874:	00 00 00 
+  802877:	ff d0                	call   *%rax
+  802879:	83 f8 02             	cmp    $0x2,%eax
+  80287c:	0f 85 ab 00 00 00    	jne    80292d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802882:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  802889:	00 00 
+  80288b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80288f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802891:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802895:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80289c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028a0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028a2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028a6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028ad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028b1:	48 bb ac 0c 80 00 00 	movabs $0x800cac,%rbx
+  8028b8:	00 00 00 
+  8028bb:	ff d3                	call   *%rbx
+  8028bd:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028c1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028c5:	ff d3                	call   *%rbx
+  8028c7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d1:	eb 4d                	jmp    802920 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8028d3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028d8:	4c 89 ee             	mov    %r13,%rsi
+  8028db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e0:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028f1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fa:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  802901:	00 00 00 
+  802904:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802906:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80290b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80290f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802914:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  80291b:	00 00 00 
+  80291e:	ff d0                	call   *%rax
+}
+  802920:	89 d8                	mov    %ebx,%eax
+  802922:	48 83 c4 18          	add    $0x18,%rsp
+  802926:	5b                   	pop    %rbx
+  802927:	41 5c                	pop    %r12
+  802929:	41 5d                	pop    %r13
+  80292b:	5d                   	pop    %rbp
+  80292c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80292d:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  802934:	00 00 00 
+  802937:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  80293e:	00 00 00 
+  802941:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802946:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  80294d:	00 00 00 
+  802950:	b8 00 00 00 00       	mov    $0x0,%eax
+  802955:	49 b8 35 2f 80 00 00 	movabs $0x802f35,%r8
+  80295c:	00 00 00 
+  80295f:	41 ff d0             	call   *%r8
+
+0000000000802962 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802962:	55                   	push   %rbp
+  802963:	48 89 e5             	mov    %rsp,%rbp
+  802966:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80296a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80296e:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  802975:	00 00 00 
+  802978:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80297a:	85 c0                	test   %eax,%eax
+  80297c:	78 35                	js     8029b3 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80297e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802982:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  802989:	00 00 00 
+  80298c:	ff d0                	call   *%rax
+  80298e:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802991:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802996:	be 00 10 00 00       	mov    $0x1000,%esi
+  80299b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80299f:	48 b8 6a 02 80 00 00 	movabs $0x80026a,%rax
+  8029a6:	00 00 00 
+  8029a9:	ff d0                	call   *%rax
+  8029ab:	85 c0                	test   %eax,%eax
+  8029ad:	0f 94 c0             	sete   %al
+  8029b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8029b3:	c9                   	leave
+  8029b4:	c3                   	ret
+
+00000000008029b5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029b5:	48 89 f8             	mov    %rdi,%rax
+  8029b8:	48 c1 e8 27          	shr    $0x27,%rax
+  8029bc:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8029c3:	7f 00 00 
+  8029c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ca:	f6 c2 01             	test   $0x1,%dl
+  8029cd:	74 6d                	je     802a3c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029cf:	48 89 f8             	mov    %rdi,%rax
+  8029d2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029d6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029dd:	7f 00 00 
+  8029e0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029e4:	f6 c2 01             	test   $0x1,%dl
+  8029e7:	74 62                	je     802a4b <get_uvpt_entry+0x96>
+  8029e9:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029f0:	7f 00 00 
+  8029f3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029f7:	f6 c2 80             	test   $0x80,%dl
+  8029fa:	75 4f                	jne    802a4b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029fc:	48 89 f8             	mov    %rdi,%rax
+  8029ff:	48 c1 e8 15          	shr    $0x15,%rax
+  802a03:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a0a:	7f 00 00 
+  802a0d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a11:	f6 c2 01             	test   $0x1,%dl
+  802a14:	74 44                	je     802a5a <get_uvpt_entry+0xa5>
+  802a16:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a1d:	7f 00 00 
+  802a20:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a24:	f6 c2 80             	test   $0x80,%dl
+  802a27:	75 31                	jne    802a5a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a29:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a2d:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a34:	7f 00 00 
+  802a37:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a3b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a3c:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a43:	7f 00 00 
+  802a46:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a4a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a4b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a52:	7f 00 00 
+  802a55:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a59:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a5a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a61:	7f 00 00 
+  802a64:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a68:	c3                   	ret
+
+0000000000802a69 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802a69:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a6c:	48 89 f9             	mov    %rdi,%rcx
+  802a6f:	48 c1 e9 27          	shr    $0x27,%rcx
+  802a73:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802a7a:	7f 00 00 
+  802a7d:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802a81:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a88:	f6 c1 01             	test   $0x1,%cl
+  802a8b:	0f 84 b2 00 00 00    	je     802b43 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a91:	48 89 f9             	mov    %rdi,%rcx
+  802a94:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802a98:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802a9f:	7f 00 00 
+  802aa2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802aa6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802aad:	40 f6 c6 01          	test   $0x1,%sil
+  802ab1:	0f 84 8c 00 00 00    	je     802b43 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802ab7:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802abe:	7f 00 00 
+  802ac1:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802ac5:	a8 80                	test   $0x80,%al
+  802ac7:	75 7b                	jne    802b44 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ac9:	48 89 f9             	mov    %rdi,%rcx
+  802acc:	48 c1 e9 15          	shr    $0x15,%rcx
+  802ad0:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802ad7:	7f 00 00 
+  802ada:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802ade:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ae5:	40 f6 c6 01          	test   $0x1,%sil
+  802ae9:	74 58                	je     802b43 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802aeb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802af2:	7f 00 00 
+  802af5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802af9:	a8 80                	test   $0x80,%al
+  802afb:	75 6c                	jne    802b69 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802afd:	48 89 f9             	mov    %rdi,%rcx
+  802b00:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802b04:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b0b:	7f 00 00 
+  802b0e:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b12:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b19:	40 f6 c6 01          	test   $0x1,%sil
+  802b1d:	74 24                	je     802b43 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b1f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b26:	7f 00 00 
+  802b29:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b2d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b34:	ff ff 7f 
+  802b37:	48 21 c8             	and    %rcx,%rax
+  802b3a:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b40:	48 09 d0             	or     %rdx,%rax
+}
+  802b43:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b44:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b4b:	7f 00 00 
+  802b4e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b52:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b59:	ff ff 7f 
+  802b5c:	48 21 c8             	and    %rcx,%rax
+  802b5f:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802b65:	48 01 d0             	add    %rdx,%rax
+  802b68:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802b69:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b70:	7f 00 00 
+  802b73:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b77:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b7e:	ff ff 7f 
+  802b81:	48 21 c8             	and    %rcx,%rax
+  802b84:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802b8a:	48 01 d0             	add    %rdx,%rax
+  802b8d:	c3                   	ret
+
+0000000000802b8e <get_prot>:
+
+int
+get_prot(void *va) {
+  802b8e:	55                   	push   %rbp
+  802b8f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b92:	48 b8 b5 29 80 00 00 	movabs $0x8029b5,%rax
+  802b99:	00 00 00 
+  802b9c:	ff d0                	call   *%rax
+  802b9e:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802ba1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802ba6:	89 c1                	mov    %eax,%ecx
+  802ba8:	83 c9 04             	or     $0x4,%ecx
+  802bab:	f6 c2 01             	test   $0x1,%dl
+  802bae:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802bb1:	89 c1                	mov    %eax,%ecx
+  802bb3:	83 c9 02             	or     $0x2,%ecx
+  802bb6:	f6 c2 02             	test   $0x2,%dl
+  802bb9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802bbc:	89 c1                	mov    %eax,%ecx
+  802bbe:	83 c9 01             	or     $0x1,%ecx
+  802bc1:	48 85 d2             	test   %rdx,%rdx
+  802bc4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bc7:	89 c1                	mov    %eax,%ecx
+  802bc9:	83 c9 40             	or     $0x40,%ecx
+  802bcc:	f6 c6 04             	test   $0x4,%dh
+  802bcf:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802bd2:	5d                   	pop    %rbp
+  802bd3:	c3                   	ret
+
+0000000000802bd4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802bd4:	55                   	push   %rbp
+  802bd5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bd8:	48 b8 b5 29 80 00 00 	movabs $0x8029b5,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802be4:	48 c1 e8 06          	shr    $0x6,%rax
+  802be8:	83 e0 01             	and    $0x1,%eax
+}
+  802beb:	5d                   	pop    %rbp
+  802bec:	c3                   	ret
+
+0000000000802bed <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bed:	55                   	push   %rbp
+  802bee:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802bf1:	48 b8 b5 29 80 00 00 	movabs $0x8029b5,%rax
+  802bf8:	00 00 00 
+  802bfb:	ff d0                	call   *%rax
+  802bfd:	83 e0 01             	and    $0x1,%eax
+}
+  802c00:	5d                   	pop    %rbp
+  802c01:	c3                   	ret
+
+0000000000802c02 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802c02:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802c09:	7f 00 00 
+  802c0c:	a8 01                	test   $0x1,%al
+  802c0e:	75 06                	jne    802c16 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c15:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c16:	55                   	push   %rbp
+  802c17:	48 89 e5             	mov    %rsp,%rbp
+  802c1a:	41 57                	push   %r15
+  802c1c:	41 56                	push   %r14
+  802c1e:	41 55                	push   %r13
+  802c20:	41 54                	push   %r12
+  802c22:	53                   	push   %rbx
+  802c23:	48 83 ec 18          	sub    $0x18,%rsp
+  802c27:	49 89 fe             	mov    %rdi,%r14
+  802c2a:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c2d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c34:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c35:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c3c:	7f 00 00 
+  802c3f:	e9 81 00 00 00       	jmp    802cc5 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c44:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c4b:	49 39 dd             	cmp    %rbx,%r13
+  802c4e:	74 2b                	je     802c7b <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c50:	48 89 d8             	mov    %rbx,%rax
+  802c53:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c57:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802c5b:	f6 c2 01             	test   $0x1,%dl
+  802c5e:	74 e4                	je     802c44 <foreach_shared_region+0x42>
+  802c60:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802c64:	f6 c4 04             	test   $0x4,%ah
+  802c67:	74 db                	je     802c44 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802c69:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802c70:	4c 89 fa             	mov    %r15,%rdx
+  802c73:	48 89 df             	mov    %rbx,%rdi
+  802c76:	41 ff d6             	call   *%r14
+  802c79:	eb c9                	jmp    802c44 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802c7b:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802c82:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802c86:	74 22                	je     802caa <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802c88:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802c8f:	48 89 d8             	mov    %rbx,%rax
+  802c92:	48 c1 e8 15          	shr    $0x15,%rax
+  802c96:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802c9d:	7f 00 00 
+  802ca0:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802ca4:	a8 01                	test   $0x1,%al
+  802ca6:	74 d3                	je     802c7b <foreach_shared_region+0x79>
+  802ca8:	eb a6                	jmp    802c50 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802caa:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802cb1:	40 
+  802cb2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802cb6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802cbd:	00 00 00 
+  802cc0:	48 39 c1             	cmp    %rax,%rcx
+  802cc3:	74 31                	je     802cf6 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802cc5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cc9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ccd:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802cd4:	7f 00 00 
+  802cd7:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802cdb:	a8 01                	test   $0x1,%al
+  802cdd:	74 cb                	je     802caa <foreach_shared_region+0xa8>
+  802cdf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ce3:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cea:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802cf0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802cf4:	eb 92                	jmp    802c88 <foreach_shared_region+0x86>
+}
+  802cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfb:	48 83 c4 18          	add    $0x18,%rsp
+  802cff:	5b                   	pop    %rbx
+  802d00:	41 5c                	pop    %r12
+  802d02:	41 5d                	pop    %r13
+  802d04:	41 5e                	pop    %r14
+  802d06:	41 5f                	pop    %r15
+  802d08:	5d                   	pop    %rbp
+  802d09:	c3                   	ret
+
+0000000000802d0a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0f:	c3                   	ret
+
+0000000000802d10 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d10:	55                   	push   %rbp
+  802d11:	48 89 e5             	mov    %rsp,%rbp
+  802d14:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d17:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d1e:	00 00 00 
+  802d21:	48 b8 fd 39 80 00 00 	movabs $0x8039fd,%rax
+  802d28:	00 00 00 
+  802d2b:	ff d0                	call   *%rax
+    return 0;
+}
+  802d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d32:	5d                   	pop    %rbp
+  802d33:	c3                   	ret
+
+0000000000802d34 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d34:	55                   	push   %rbp
+  802d35:	48 89 e5             	mov    %rsp,%rbp
+  802d38:	41 57                	push   %r15
+  802d3a:	41 56                	push   %r14
+  802d3c:	41 55                	push   %r13
+  802d3e:	41 54                	push   %r12
+  802d40:	53                   	push   %rbx
+  802d41:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d48:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d4f:	48 85 d2             	test   %rdx,%rdx
+  802d52:	74 7a                	je     802dce <devcons_write+0x9a>
+  802d54:	49 89 d6             	mov    %rdx,%r14
+  802d57:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d5d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d62:	49 bf 8b 3d 80 00 00 	movabs $0x803d8b,%r15
+  802d69:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d6c:	4c 89 f3             	mov    %r14,%rbx
+  802d6f:	48 29 f3             	sub    %rsi,%rbx
+  802d72:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d77:	48 39 c3             	cmp    %rax,%rbx
+  802d7a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d7e:	4c 63 eb             	movslq %ebx,%r13
+  802d81:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d88:	48 01 c6             	add    %rax,%rsi
+  802d8b:	4c 89 ea             	mov    %r13,%rdx
+  802d8e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d95:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d98:	4c 89 ee             	mov    %r13,%rsi
+  802d9b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802da2:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  802da9:	00 00 00 
+  802dac:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802dae:	41 01 dc             	add    %ebx,%r12d
+  802db1:	49 63 f4             	movslq %r12d,%rsi
+  802db4:	4c 39 f6             	cmp    %r14,%rsi
+  802db7:	72 b3                	jb     802d6c <devcons_write+0x38>
+    return res;
+  802db9:	49 63 c4             	movslq %r12d,%rax
+}
+  802dbc:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802dc3:	5b                   	pop    %rbx
+  802dc4:	41 5c                	pop    %r12
+  802dc6:	41 5d                	pop    %r13
+  802dc8:	41 5e                	pop    %r14
+  802dca:	41 5f                	pop    %r15
+  802dcc:	5d                   	pop    %rbp
+  802dcd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802dce:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dd4:	eb e3                	jmp    802db9 <devcons_write+0x85>
+
+0000000000802dd6 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dd6:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802dd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dde:	48 85 c0             	test   %rax,%rax
+  802de1:	74 55                	je     802e38 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802de3:	55                   	push   %rbp
+  802de4:	48 89 e5             	mov    %rsp,%rbp
+  802de7:	41 55                	push   %r13
+  802de9:	41 54                	push   %r12
+  802deb:	53                   	push   %rbx
+  802dec:	48 83 ec 08          	sub    $0x8,%rsp
+  802df0:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802df3:	48 bb 3a 01 80 00 00 	movabs $0x80013a,%rbx
+  802dfa:	00 00 00 
+  802dfd:	49 bc 07 02 80 00 00 	movabs $0x800207,%r12
+  802e04:	00 00 00 
+  802e07:	eb 03                	jmp    802e0c <devcons_read+0x36>
+  802e09:	41 ff d4             	call   *%r12
+  802e0c:	ff d3                	call   *%rbx
+  802e0e:	85 c0                	test   %eax,%eax
+  802e10:	74 f7                	je     802e09 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e12:	48 63 d0             	movslq %eax,%rdx
+  802e15:	78 13                	js     802e2a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e17:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e1c:	83 f8 04             	cmp    $0x4,%eax
+  802e1f:	74 09                	je     802e2a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e21:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e25:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e2a:	48 89 d0             	mov    %rdx,%rax
+  802e2d:	48 83 c4 08          	add    $0x8,%rsp
+  802e31:	5b                   	pop    %rbx
+  802e32:	41 5c                	pop    %r12
+  802e34:	41 5d                	pop    %r13
+  802e36:	5d                   	pop    %rbp
+  802e37:	c3                   	ret
+  802e38:	48 89 d0             	mov    %rdx,%rax
+  802e3b:	c3                   	ret
+
+0000000000802e3c <cputchar>:
+cputchar(int ch) {
+  802e3c:	55                   	push   %rbp
+  802e3d:	48 89 e5             	mov    %rsp,%rbp
+  802e40:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e44:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e48:	be 01 00 00 00       	mov    $0x1,%esi
+  802e4d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e51:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  802e58:	00 00 00 
+  802e5b:	ff d0                	call   *%rax
+}
+  802e5d:	c9                   	leave
+  802e5e:	c3                   	ret
+
+0000000000802e5f <getchar>:
+getchar(void) {
+  802e5f:	55                   	push   %rbp
+  802e60:	48 89 e5             	mov    %rsp,%rbp
+  802e63:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e67:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e6c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e70:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e75:	48 b8 1d 10 80 00 00 	movabs $0x80101d,%rax
+  802e7c:	00 00 00 
+  802e7f:	ff d0                	call   *%rax
+  802e81:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e83:	85 c0                	test   %eax,%eax
+  802e85:	78 06                	js     802e8d <getchar+0x2e>
+  802e87:	74 08                	je     802e91 <getchar+0x32>
+  802e89:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e8d:	89 d0                	mov    %edx,%eax
+  802e8f:	c9                   	leave
+  802e90:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e91:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e96:	eb f5                	jmp    802e8d <getchar+0x2e>
+
+0000000000802e98 <iscons>:
+iscons(int fdnum) {
+  802e98:	55                   	push   %rbp
+  802e99:	48 89 e5             	mov    %rsp,%rbp
+  802e9c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ea0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ea4:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  802eab:	00 00 00 
+  802eae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802eb0:	85 c0                	test   %eax,%eax
+  802eb2:	78 18                	js     802ecc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802eb4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802eb8:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802ebf:	00 00 00 
+  802ec2:	8b 00                	mov    (%rax),%eax
+  802ec4:	39 02                	cmp    %eax,(%rdx)
+  802ec6:	0f 94 c0             	sete   %al
+  802ec9:	0f b6 c0             	movzbl %al,%eax
+}
+  802ecc:	c9                   	leave
+  802ecd:	c3                   	ret
+
+0000000000802ece <opencons>:
+opencons(void) {
+  802ece:	55                   	push   %rbp
+  802ecf:	48 89 e5             	mov    %rsp,%rbp
+  802ed2:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ed6:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802eda:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  802ee1:	00 00 00 
+  802ee4:	ff d0                	call   *%rax
+  802ee6:	85 c0                	test   %eax,%eax
+  802ee8:	78 49                	js     802f33 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802eea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802eef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ef4:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802ef8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802efd:	48 b8 96 02 80 00 00 	movabs $0x800296,%rax
+  802f04:	00 00 00 
+  802f07:	ff d0                	call   *%rax
+  802f09:	85 c0                	test   %eax,%eax
+  802f0b:	78 26                	js     802f33 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f11:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802f18:	00 00 
+  802f1a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f1c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f20:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f27:	48 b8 ac 0c 80 00 00 	movabs $0x800cac,%rax
+  802f2e:	00 00 00 
+  802f31:	ff d0                	call   *%rax
+}
+  802f33:	c9                   	leave
+  802f34:	c3                   	ret
+
+0000000000802f35 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f35:	55                   	push   %rbp
+  802f36:	48 89 e5             	mov    %rsp,%rbp
+  802f39:	41 56                	push   %r14
+  802f3b:	41 55                	push   %r13
+  802f3d:	41 54                	push   %r12
+  802f3f:	53                   	push   %rbx
+  802f40:	48 83 ec 50          	sub    $0x50,%rsp
+  802f44:	49 89 fc             	mov    %rdi,%r12
+  802f47:	41 89 f5             	mov    %esi,%r13d
+  802f4a:	48 89 d3             	mov    %rdx,%rbx
+  802f4d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802f51:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802f55:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f59:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802f60:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f64:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f68:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802f6c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f70:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802f77:	00 00 00 
+  802f7a:	4c 8b 30             	mov    (%rax),%r14
+  802f7d:	48 b8 d6 01 80 00 00 	movabs $0x8001d6,%rax
+  802f84:	00 00 00 
+  802f87:	ff d0                	call   *%rax
+  802f89:	89 c6                	mov    %eax,%esi
+  802f8b:	45 89 e8             	mov    %r13d,%r8d
+  802f8e:	4c 89 e1             	mov    %r12,%rcx
+  802f91:	4c 89 f2             	mov    %r14,%rdx
+  802f94:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802f9b:	00 00 00 
+  802f9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa3:	49 bc 85 30 80 00 00 	movabs $0x803085,%r12
+  802faa:	00 00 00 
+  802fad:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802fb0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802fb4:	48 89 df             	mov    %rbx,%rdi
+  802fb7:	48 b8 21 30 80 00 00 	movabs $0x803021,%rax
+  802fbe:	00 00 00 
+  802fc1:	ff d0                	call   *%rax
+    cprintf("\n");
+  802fc3:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  802fca:	00 00 00 
+  802fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd2:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802fd5:	cc                   	int3
+  802fd6:	eb fd                	jmp    802fd5 <_panic+0xa0>
+
+0000000000802fd8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802fd8:	55                   	push   %rbp
+  802fd9:	48 89 e5             	mov    %rsp,%rbp
+  802fdc:	53                   	push   %rbx
+  802fdd:	48 83 ec 08          	sub    $0x8,%rsp
+  802fe1:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802fe4:	8b 06                	mov    (%rsi),%eax
+  802fe6:	8d 50 01             	lea    0x1(%rax),%edx
+  802fe9:	89 16                	mov    %edx,(%rsi)
+  802feb:	48 98                	cltq
+  802fed:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802ff2:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802ff8:	74 0a                	je     803004 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802ffa:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802ffe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803002:	c9                   	leave
+  803003:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803004:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803008:	be ff 00 00 00       	mov    $0xff,%esi
+  80300d:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  803014:	00 00 00 
+  803017:	ff d0                	call   *%rax
+        state->offset = 0;
+  803019:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80301f:	eb d9                	jmp    802ffa <putch+0x22>
+
+0000000000803021 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803021:	55                   	push   %rbp
+  803022:	48 89 e5             	mov    %rsp,%rbp
+  803025:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80302c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80302f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803036:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80303b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803040:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803043:	48 89 f1             	mov    %rsi,%rcx
+  803046:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80304d:	48 bf d8 2f 80 00 00 	movabs $0x802fd8,%rdi
+  803054:	00 00 00 
+  803057:	48 b8 d5 31 80 00 00 	movabs $0x8031d5,%rax
+  80305e:	00 00 00 
+  803061:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803063:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80306a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803071:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  803078:	00 00 00 
+  80307b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80307d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  803083:	c9                   	leave
+  803084:	c3                   	ret
+
+0000000000803085 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803085:	55                   	push   %rbp
+  803086:	48 89 e5             	mov    %rsp,%rbp
+  803089:	48 83 ec 50          	sub    $0x50,%rsp
+  80308d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803091:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803095:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803099:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80309d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8030a1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8030a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030b0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030b4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8030b8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8030bc:	48 b8 21 30 80 00 00 	movabs $0x803021,%rax
+  8030c3:	00 00 00 
+  8030c6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8030c8:	c9                   	leave
+  8030c9:	c3                   	ret
+
+00000000008030ca <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8030ca:	55                   	push   %rbp
+  8030cb:	48 89 e5             	mov    %rsp,%rbp
+  8030ce:	41 57                	push   %r15
+  8030d0:	41 56                	push   %r14
+  8030d2:	41 55                	push   %r13
+  8030d4:	41 54                	push   %r12
+  8030d6:	53                   	push   %rbx
+  8030d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8030db:	49 89 fc             	mov    %rdi,%r12
+  8030de:	49 89 f5             	mov    %rsi,%r13
+  8030e1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8030e5:	8b 45 10             	mov    0x10(%rbp),%eax
+  8030e8:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8030eb:	41 89 cf             	mov    %ecx,%r15d
+  8030ee:	4c 39 fa             	cmp    %r15,%rdx
+  8030f1:	73 5b                	jae    80314e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8030f3:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8030f7:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8030fb:	85 db                	test   %ebx,%ebx
+  8030fd:	7e 0e                	jle    80310d <print_num+0x43>
+            putch(padc, put_arg);
+  8030ff:	4c 89 ee             	mov    %r13,%rsi
+  803102:	44 89 f7             	mov    %r14d,%edi
+  803105:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803108:	83 eb 01             	sub    $0x1,%ebx
+  80310b:	75 f2                	jne    8030ff <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80310d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803111:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  803118:	00 00 00 
+  80311b:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  803122:	00 00 00 
+  803125:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803129:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80312d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803132:	49 f7 f7             	div    %r15
+  803135:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803139:	4c 89 ee             	mov    %r13,%rsi
+  80313c:	41 ff d4             	call   *%r12
+}
+  80313f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803143:	5b                   	pop    %rbx
+  803144:	41 5c                	pop    %r12
+  803146:	41 5d                	pop    %r13
+  803148:	41 5e                	pop    %r14
+  80314a:	41 5f                	pop    %r15
+  80314c:	5d                   	pop    %rbp
+  80314d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80314e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803152:	ba 00 00 00 00       	mov    $0x0,%edx
+  803157:	49 f7 f7             	div    %r15
+  80315a:	48 83 ec 08          	sub    $0x8,%rsp
+  80315e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803162:	52                   	push   %rdx
+  803163:	45 0f be c9          	movsbl %r9b,%r9d
+  803167:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80316b:	48 89 c2             	mov    %rax,%rdx
+  80316e:	48 b8 ca 30 80 00 00 	movabs $0x8030ca,%rax
+  803175:	00 00 00 
+  803178:	ff d0                	call   *%rax
+  80317a:	48 83 c4 10          	add    $0x10,%rsp
+  80317e:	eb 8d                	jmp    80310d <print_num+0x43>
+
+0000000000803180 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803180:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  803184:	48 8b 06             	mov    (%rsi),%rax
+  803187:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80318b:	73 0a                	jae    803197 <sprintputch+0x17>
+        *state->start++ = ch;
+  80318d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803191:	48 89 16             	mov    %rdx,(%rsi)
+  803194:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  803197:	c3                   	ret
+
+0000000000803198 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803198:	55                   	push   %rbp
+  803199:	48 89 e5             	mov    %rsp,%rbp
+  80319c:	48 83 ec 50          	sub    $0x50,%rsp
+  8031a0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8031a4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8031a8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8031ac:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8031b3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031bb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031bf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8031c3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8031c7:	48 b8 d5 31 80 00 00 	movabs $0x8031d5,%rax
+  8031ce:	00 00 00 
+  8031d1:	ff d0                	call   *%rax
+}
+  8031d3:	c9                   	leave
+  8031d4:	c3                   	ret
+
+00000000008031d5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8031d5:	55                   	push   %rbp
+  8031d6:	48 89 e5             	mov    %rsp,%rbp
+  8031d9:	41 57                	push   %r15
+  8031db:	41 56                	push   %r14
+  8031dd:	41 55                	push   %r13
+  8031df:	41 54                	push   %r12
+  8031e1:	53                   	push   %rbx
+  8031e2:	48 83 ec 38          	sub    $0x38,%rsp
+  8031e6:	49 89 fe             	mov    %rdi,%r14
+  8031e9:	49 89 f5             	mov    %rsi,%r13
+  8031ec:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8031ef:	48 8b 01             	mov    (%rcx),%rax
+  8031f2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031f6:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8031fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031fe:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803202:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803206:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80320a:	0f b6 3b             	movzbl (%rbx),%edi
+  80320d:	40 80 ff 25          	cmp    $0x25,%dil
+  803211:	74 18                	je     80322b <vprintfmt+0x56>
+            if (!ch) return;
+  803213:	40 84 ff             	test   %dil,%dil
+  803216:	0f 84 04 07 00 00    	je     803920 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80321c:	40 0f b6 ff          	movzbl %dil,%edi
+  803220:	4c 89 ee             	mov    %r13,%rsi
+  803223:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803226:	4c 89 e3             	mov    %r12,%rbx
+  803229:	eb db                	jmp    803206 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80322b:	be 00 00 00 00       	mov    $0x0,%esi
+  803230:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803234:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803239:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80323f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803246:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80324a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80324f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803254:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803257:	83 e8 23             	sub    $0x23,%eax
+  80325a:	3c 57                	cmp    $0x57,%al
+  80325c:	0f 87 a4 06 00 00    	ja     803906 <vprintfmt+0x731>
+  803262:	0f b6 c0             	movzbl %al,%eax
+  803265:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  80326c:	00 00 00 
+  80326f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803272:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803275:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803279:	eb cf                	jmp    80324a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80327b:	49 89 dc             	mov    %rbx,%r12
+  80327e:	be 01 00 00 00       	mov    $0x1,%esi
+  803283:	eb c5                	jmp    80324a <vprintfmt+0x75>
+            padc = ch;
+  803285:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  803289:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80328c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80328f:	eb b9                	jmp    80324a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803291:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803294:	83 f8 2f             	cmp    $0x2f,%eax
+  803297:	77 24                	ja     8032bd <vprintfmt+0xe8>
+  803299:	89 c1                	mov    %eax,%ecx
+  80329b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80329f:	83 c0 08             	add    $0x8,%eax
+  8032a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032a5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8032a8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8032ab:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8032af:	79 99                	jns    80324a <vprintfmt+0x75>
+                width = precision;
+  8032b1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8032b5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8032bb:	eb 8d                	jmp    80324a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032bd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032c1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8032c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032c9:	eb da                	jmp    8032a5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8032cb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8032d0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032d4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8032da:	3c 39                	cmp    $0x39,%al
+  8032dc:	77 1c                	ja     8032fa <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8032de:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8032e2:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8032e6:	0f b6 c0             	movzbl %al,%eax
+  8032e9:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032ee:	0f b6 03             	movzbl (%rbx),%eax
+  8032f1:	3c 39                	cmp    $0x39,%al
+  8032f3:	76 e9                	jbe    8032de <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8032f5:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8032f8:	eb b1                	jmp    8032ab <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8032fa:	49 89 dc             	mov    %rbx,%r12
+  8032fd:	eb ac                	jmp    8032ab <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8032ff:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803302:	85 c9                	test   %ecx,%ecx
+  803304:	b8 00 00 00 00       	mov    $0x0,%eax
+  803309:	0f 49 c1             	cmovns %ecx,%eax
+  80330c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80330f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803312:	e9 33 ff ff ff       	jmp    80324a <vprintfmt+0x75>
+            lflag++;
+  803317:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80331a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80331d:	e9 28 ff ff ff       	jmp    80324a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803322:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803325:	83 f8 2f             	cmp    $0x2f,%eax
+  803328:	77 19                	ja     803343 <vprintfmt+0x16e>
+  80332a:	89 c2                	mov    %eax,%edx
+  80332c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803330:	83 c0 08             	add    $0x8,%eax
+  803333:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803336:	8b 3a                	mov    (%rdx),%edi
+  803338:	4c 89 ee             	mov    %r13,%rsi
+  80333b:	41 ff d6             	call   *%r14
+            break;
+  80333e:	e9 c3 fe ff ff       	jmp    803206 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803343:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803347:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80334b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80334f:	eb e5                	jmp    803336 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803351:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803354:	83 f8 2f             	cmp    $0x2f,%eax
+  803357:	77 5a                	ja     8033b3 <vprintfmt+0x1de>
+  803359:	89 c2                	mov    %eax,%edx
+  80335b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80335f:	83 c0 08             	add    $0x8,%eax
+  803362:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803365:	8b 02                	mov    (%rdx),%eax
+  803367:	89 c1                	mov    %eax,%ecx
+  803369:	f7 d9                	neg    %ecx
+  80336b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80336e:	83 f9 13             	cmp    $0x13,%ecx
+  803371:	7f 4e                	jg     8033c1 <vprintfmt+0x1ec>
+  803373:	48 63 c1             	movslq %ecx,%rax
+  803376:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  80337d:	00 00 00 
+  803380:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803384:	48 85 c0             	test   %rax,%rax
+  803387:	74 38                	je     8033c1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803389:	48 89 c1             	mov    %rax,%rcx
+  80338c:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  803393:	00 00 00 
+  803396:	4c 89 ee             	mov    %r13,%rsi
+  803399:	4c 89 f7             	mov    %r14,%rdi
+  80339c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a1:	49 b8 98 31 80 00 00 	movabs $0x803198,%r8
+  8033a8:	00 00 00 
+  8033ab:	41 ff d0             	call   *%r8
+  8033ae:	e9 53 fe ff ff       	jmp    803206 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8033b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033bf:	eb a4                	jmp    803365 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8033c1:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  8033c8:	00 00 00 
+  8033cb:	4c 89 ee             	mov    %r13,%rsi
+  8033ce:	4c 89 f7             	mov    %r14,%rdi
+  8033d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d6:	49 b8 98 31 80 00 00 	movabs $0x803198,%r8
+  8033dd:	00 00 00 
+  8033e0:	41 ff d0             	call   *%r8
+  8033e3:	e9 1e fe ff ff       	jmp    803206 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8033e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8033ee:	77 36                	ja     803426 <vprintfmt+0x251>
+  8033f0:	89 c2                	mov    %eax,%edx
+  8033f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033f6:	83 c0 08             	add    $0x8,%eax
+  8033f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033fc:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8033ff:	48 85 f6             	test   %rsi,%rsi
+  803402:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  803409:	00 00 00 
+  80340c:	48 0f 45 c6          	cmovne %rsi,%rax
+  803410:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803414:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803418:	7e 06                	jle    803420 <vprintfmt+0x24b>
+  80341a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80341e:	75 14                	jne    803434 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803420:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803424:	eb 5b                	jmp    803481 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  803426:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80342a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80342e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803432:	eb c8                	jmp    8033fc <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803434:	49 63 f7             	movslq %r15d,%rsi
+  803437:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80343b:	48 b8 da 39 80 00 00 	movabs $0x8039da,%rax
+  803442:	00 00 00 
+  803445:	ff d0                	call   *%rax
+  803447:	48 89 c2             	mov    %rax,%rdx
+  80344a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80344d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80344f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803452:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803455:	85 c0                	test   %eax,%eax
+  803457:	7e c7                	jle    803420 <vprintfmt+0x24b>
+  803459:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80345e:	4c 89 ee             	mov    %r13,%rsi
+  803461:	44 89 e7             	mov    %r12d,%edi
+  803464:	41 ff d6             	call   *%r14
+  803467:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80346b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80346e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803471:	75 eb                	jne    80345e <vprintfmt+0x289>
+  803473:	eb ab                	jmp    803420 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803475:	0f b6 f8             	movzbl %al,%edi
+  803478:	4c 89 ee             	mov    %r13,%rsi
+  80347b:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  80347e:	4c 89 e2             	mov    %r12,%rdx
+  803481:	45 85 ff             	test   %r15d,%r15d
+  803484:	78 06                	js     80348c <vprintfmt+0x2b7>
+  803486:	41 83 ef 01          	sub    $0x1,%r15d
+  80348a:	78 23                	js     8034af <vprintfmt+0x2da>
+  80348c:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  803490:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803496:	84 c0                	test   %al,%al
+  803498:	74 15                	je     8034af <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80349a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80349e:	74 d5                	je     803475 <vprintfmt+0x2a0>
+  8034a0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8034a3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8034a8:	80 fa 5e             	cmp    $0x5e,%dl
+  8034ab:	77 cb                	ja     803478 <vprintfmt+0x2a3>
+  8034ad:	eb c6                	jmp    803475 <vprintfmt+0x2a0>
+  8034af:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8034b2:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8034b5:	01 f0                	add    %esi,%eax
+  8034b7:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8034b9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8034bd:	85 c0                	test   %eax,%eax
+  8034bf:	0f 8e 41 fd ff ff    	jle    803206 <vprintfmt+0x31>
+  8034c5:	4c 89 ee             	mov    %r13,%rsi
+  8034c8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8034cd:	41 ff d6             	call   *%r14
+  8034d0:	41 83 ec 01          	sub    $0x1,%r12d
+  8034d4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8034d8:	75 eb                	jne    8034c5 <vprintfmt+0x2f0>
+  8034da:	e9 27 fd ff ff       	jmp    803206 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8034df:	40 84 f6             	test   %sil,%sil
+  8034e2:	75 26                	jne    80350a <vprintfmt+0x335>
+    switch (lflag) {
+  8034e4:	85 d2                	test   %edx,%edx
+  8034e6:	74 59                	je     803541 <vprintfmt+0x36c>
+  8034e8:	83 fa 01             	cmp    $0x1,%edx
+  8034eb:	74 7b                	je     803568 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8034ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8034f3:	0f 87 96 00 00 00    	ja     80358f <vprintfmt+0x3ba>
+  8034f9:	89 c2                	mov    %eax,%edx
+  8034fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034ff:	83 c0 08             	add    $0x8,%eax
+  803502:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803505:	4c 8b 22             	mov    (%rdx),%r12
+  803508:	eb 17                	jmp    803521 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80350a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80350d:	83 f8 2f             	cmp    $0x2f,%eax
+  803510:	77 21                	ja     803533 <vprintfmt+0x35e>
+  803512:	89 c2                	mov    %eax,%edx
+  803514:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803518:	83 c0 08             	add    $0x8,%eax
+  80351b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80351e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803521:	4d 85 e4             	test   %r12,%r12
+  803524:	78 7a                	js     8035a0 <vprintfmt+0x3cb>
+            num = i;
+  803526:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803529:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80352e:	e9 b5 02 00 00       	jmp    8037e8 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803533:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803537:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80353b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80353f:	eb dd                	jmp    80351e <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  803541:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803544:	83 f8 2f             	cmp    $0x2f,%eax
+  803547:	77 11                	ja     80355a <vprintfmt+0x385>
+  803549:	89 c2                	mov    %eax,%edx
+  80354b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80354f:	83 c0 08             	add    $0x8,%eax
+  803552:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803555:	4c 63 22             	movslq (%rdx),%r12
+  803558:	eb c7                	jmp    803521 <vprintfmt+0x34c>
+  80355a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80355e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803562:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803566:	eb ed                	jmp    803555 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  803568:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80356b:	83 f8 2f             	cmp    $0x2f,%eax
+  80356e:	77 11                	ja     803581 <vprintfmt+0x3ac>
+  803570:	89 c2                	mov    %eax,%edx
+  803572:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803576:	83 c0 08             	add    $0x8,%eax
+  803579:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80357c:	4c 8b 22             	mov    (%rdx),%r12
+  80357f:	eb a0                	jmp    803521 <vprintfmt+0x34c>
+  803581:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803585:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803589:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80358d:	eb ed                	jmp    80357c <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  80358f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803593:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803597:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80359b:	e9 65 ff ff ff       	jmp    803505 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8035a0:	4c 89 ee             	mov    %r13,%rsi
+  8035a3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8035a8:	41 ff d6             	call   *%r14
+                i = -i;
+  8035ab:	49 f7 dc             	neg    %r12
+  8035ae:	e9 73 ff ff ff       	jmp    803526 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8035b3:	40 84 f6             	test   %sil,%sil
+  8035b6:	75 32                	jne    8035ea <vprintfmt+0x415>
+    switch (lflag) {
+  8035b8:	85 d2                	test   %edx,%edx
+  8035ba:	74 5d                	je     803619 <vprintfmt+0x444>
+  8035bc:	83 fa 01             	cmp    $0x1,%edx
+  8035bf:	0f 84 82 00 00 00    	je     803647 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8035c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8035cb:	0f 87 a5 00 00 00    	ja     803676 <vprintfmt+0x4a1>
+  8035d1:	89 c2                	mov    %eax,%edx
+  8035d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035d7:	83 c0 08             	add    $0x8,%eax
+  8035da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035dd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035e0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8035e5:	e9 fe 01 00 00       	jmp    8037e8 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8035ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8035f0:	77 19                	ja     80360b <vprintfmt+0x436>
+  8035f2:	89 c2                	mov    %eax,%edx
+  8035f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035f8:	83 c0 08             	add    $0x8,%eax
+  8035fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035fe:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803601:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803606:	e9 dd 01 00 00       	jmp    8037e8 <vprintfmt+0x613>
+  80360b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80360f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803613:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803617:	eb e5                	jmp    8035fe <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  803619:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80361c:	83 f8 2f             	cmp    $0x2f,%eax
+  80361f:	77 18                	ja     803639 <vprintfmt+0x464>
+  803621:	89 c2                	mov    %eax,%edx
+  803623:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803627:	83 c0 08             	add    $0x8,%eax
+  80362a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80362d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80362f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803634:	e9 af 01 00 00       	jmp    8037e8 <vprintfmt+0x613>
+  803639:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80363d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803641:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803645:	eb e6                	jmp    80362d <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  803647:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80364a:	83 f8 2f             	cmp    $0x2f,%eax
+  80364d:	77 19                	ja     803668 <vprintfmt+0x493>
+  80364f:	89 c2                	mov    %eax,%edx
+  803651:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803655:	83 c0 08             	add    $0x8,%eax
+  803658:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80365b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80365e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803663:	e9 80 01 00 00       	jmp    8037e8 <vprintfmt+0x613>
+  803668:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80366c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803670:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803674:	eb e5                	jmp    80365b <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  803676:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80367a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80367e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803682:	e9 56 ff ff ff       	jmp    8035dd <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  803687:	40 84 f6             	test   %sil,%sil
+  80368a:	75 2e                	jne    8036ba <vprintfmt+0x4e5>
+    switch (lflag) {
+  80368c:	85 d2                	test   %edx,%edx
+  80368e:	0f 84 b3 00 00 00    	je     803747 <vprintfmt+0x572>
+  803694:	83 fa 01             	cmp    $0x1,%edx
+  803697:	0f 84 d3 00 00 00    	je     803770 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  80369d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8036a3:	0f 87 f1 00 00 00    	ja     80379a <vprintfmt+0x5c5>
+  8036a9:	89 c2                	mov    %eax,%edx
+  8036ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036af:	83 c0 08             	add    $0x8,%eax
+  8036b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036b5:	48 8b 02             	mov    (%rdx),%rax
+  8036b8:	eb 17                	jmp    8036d1 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8036c0:	77 77                	ja     803739 <vprintfmt+0x564>
+  8036c2:	89 c2                	mov    %eax,%edx
+  8036c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036c8:	83 c0 08             	add    $0x8,%eax
+  8036cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036ce:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8036d1:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036d3:	83 f8 07             	cmp    $0x7,%eax
+  8036d6:	0f 8e cf 00 00 00    	jle    8037ab <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8036dc:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036e2:	44 89 e7             	mov    %r12d,%edi
+  8036e5:	41 c1 e4 03          	shl    $0x3,%r12d
+  8036e9:	89 d1                	mov    %edx,%ecx
+  8036eb:	8d 72 07             	lea    0x7(%rdx),%esi
+  8036ee:	85 d2                	test   %edx,%edx
+  8036f0:	0f 48 d6             	cmovs  %esi,%edx
+  8036f3:	c1 fa 03             	sar    $0x3,%edx
+  8036f6:	83 f9 3f             	cmp    $0x3f,%ecx
+  8036f9:	7f e7                	jg     8036e2 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8036fb:	85 ff                	test   %edi,%edi
+  8036fd:	0f 84 03 fb ff ff    	je     803206 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  803703:	49 63 f4             	movslq %r12d,%rsi
+  803706:	ba 00 00 00 00       	mov    $0x0,%edx
+  80370b:	48 f7 f6             	div    %rsi
+  80370e:	49 89 d7             	mov    %rdx,%r15
+  803711:	83 c0 30             	add    $0x30,%eax
+  803714:	0f be f8             	movsbl %al,%edi
+  803717:	4c 89 ee             	mov    %r13,%rsi
+  80371a:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80371d:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  803720:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  803725:	45 85 e4             	test   %r12d,%r12d
+  803728:	41 0f 49 d4          	cmovns %r12d,%edx
+  80372c:	c1 fa 03             	sar    $0x3,%edx
+  80372f:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  803732:	75 cf                	jne    803703 <vprintfmt+0x52e>
+  803734:	e9 cd fa ff ff       	jmp    803206 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  803739:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80373d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803741:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803745:	eb 87                	jmp    8036ce <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  803747:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80374a:	83 f8 2f             	cmp    $0x2f,%eax
+  80374d:	77 13                	ja     803762 <vprintfmt+0x58d>
+  80374f:	89 c2                	mov    %eax,%edx
+  803751:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803755:	83 c0 08             	add    $0x8,%eax
+  803758:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80375b:	8b 02                	mov    (%rdx),%eax
+  80375d:	e9 6f ff ff ff       	jmp    8036d1 <vprintfmt+0x4fc>
+  803762:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803766:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80376a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80376e:	eb eb                	jmp    80375b <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  803770:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803773:	83 f8 2f             	cmp    $0x2f,%eax
+  803776:	77 14                	ja     80378c <vprintfmt+0x5b7>
+  803778:	89 c2                	mov    %eax,%edx
+  80377a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80377e:	83 c0 08             	add    $0x8,%eax
+  803781:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803784:	48 8b 02             	mov    (%rdx),%rax
+  803787:	e9 45 ff ff ff       	jmp    8036d1 <vprintfmt+0x4fc>
+  80378c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803790:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803794:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803798:	eb ea                	jmp    803784 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  80379a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80379e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037a6:	e9 0a ff ff ff       	jmp    8036b5 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8037ab:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8037b1:	e9 4d ff ff ff       	jmp    803703 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8037b6:	4c 89 ee             	mov    %r13,%rsi
+  8037b9:	bf 30 00 00 00       	mov    $0x30,%edi
+  8037be:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8037c1:	4c 89 ee             	mov    %r13,%rsi
+  8037c4:	bf 78 00 00 00       	mov    $0x78,%edi
+  8037c9:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8037cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8037d2:	77 47                	ja     80381b <vprintfmt+0x646>
+  8037d4:	89 c2                	mov    %eax,%edx
+  8037d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037da:	83 c0 08             	add    $0x8,%eax
+  8037dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037e0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8037e3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8037e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8037ec:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8037f0:	0f 94 c0             	sete   %al
+  8037f3:	0f b6 c0             	movzbl %al,%eax
+  8037f6:	50                   	push   %rax
+  8037f7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8037fc:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803800:	4c 89 ee             	mov    %r13,%rsi
+  803803:	4c 89 f7             	mov    %r14,%rdi
+  803806:	48 b8 ca 30 80 00 00 	movabs $0x8030ca,%rax
+  80380d:	00 00 00 
+  803810:	ff d0                	call   *%rax
+            break;
+  803812:	48 83 c4 10          	add    $0x10,%rsp
+  803816:	e9 eb f9 ff ff       	jmp    803206 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80381b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80381f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803823:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803827:	eb b7                	jmp    8037e0 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  803829:	40 84 f6             	test   %sil,%sil
+  80382c:	75 2b                	jne    803859 <vprintfmt+0x684>
+    switch (lflag) {
+  80382e:	85 d2                	test   %edx,%edx
+  803830:	74 56                	je     803888 <vprintfmt+0x6b3>
+  803832:	83 fa 01             	cmp    $0x1,%edx
+  803835:	74 7f                	je     8038b6 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  803837:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80383a:	83 f8 2f             	cmp    $0x2f,%eax
+  80383d:	0f 87 a2 00 00 00    	ja     8038e5 <vprintfmt+0x710>
+  803843:	89 c2                	mov    %eax,%edx
+  803845:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803849:	83 c0 08             	add    $0x8,%eax
+  80384c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80384f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803852:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803857:	eb 8f                	jmp    8037e8 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803859:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80385c:	83 f8 2f             	cmp    $0x2f,%eax
+  80385f:	77 19                	ja     80387a <vprintfmt+0x6a5>
+  803861:	89 c2                	mov    %eax,%edx
+  803863:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803867:	83 c0 08             	add    $0x8,%eax
+  80386a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80386d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803870:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803875:	e9 6e ff ff ff       	jmp    8037e8 <vprintfmt+0x613>
+  80387a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80387e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803882:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803886:	eb e5                	jmp    80386d <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  803888:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80388b:	83 f8 2f             	cmp    $0x2f,%eax
+  80388e:	77 18                	ja     8038a8 <vprintfmt+0x6d3>
+  803890:	89 c2                	mov    %eax,%edx
+  803892:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803896:	83 c0 08             	add    $0x8,%eax
+  803899:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80389c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80389e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8038a3:	e9 40 ff ff ff       	jmp    8037e8 <vprintfmt+0x613>
+  8038a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038b4:	eb e6                	jmp    80389c <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8038b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8038bc:	77 19                	ja     8038d7 <vprintfmt+0x702>
+  8038be:	89 c2                	mov    %eax,%edx
+  8038c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038c4:	83 c0 08             	add    $0x8,%eax
+  8038c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038ca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038cd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8038d2:	e9 11 ff ff ff       	jmp    8037e8 <vprintfmt+0x613>
+  8038d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038e3:	eb e5                	jmp    8038ca <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  8038e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038f1:	e9 59 ff ff ff       	jmp    80384f <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8038f6:	4c 89 ee             	mov    %r13,%rsi
+  8038f9:	bf 25 00 00 00       	mov    $0x25,%edi
+  8038fe:	41 ff d6             	call   *%r14
+            break;
+  803901:	e9 00 f9 ff ff       	jmp    803206 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803906:	4c 89 ee             	mov    %r13,%rsi
+  803909:	bf 25 00 00 00       	mov    $0x25,%edi
+  80390e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803911:	48 83 eb 01          	sub    $0x1,%rbx
+  803915:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803919:	75 f6                	jne    803911 <vprintfmt+0x73c>
+  80391b:	e9 e6 f8 ff ff       	jmp    803206 <vprintfmt+0x31>
+}
+  803920:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803924:	5b                   	pop    %rbx
+  803925:	41 5c                	pop    %r12
+  803927:	41 5d                	pop    %r13
+  803929:	41 5e                	pop    %r14
+  80392b:	41 5f                	pop    %r15
+  80392d:	5d                   	pop    %rbp
+  80392e:	c3                   	ret
+
+000000000080392f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80392f:	55                   	push   %rbp
+  803930:	48 89 e5             	mov    %rsp,%rbp
+  803933:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803937:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80393b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803940:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803944:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80394b:	48 85 ff             	test   %rdi,%rdi
+  80394e:	74 2b                	je     80397b <vsnprintf+0x4c>
+  803950:	48 85 f6             	test   %rsi,%rsi
+  803953:	74 26                	je     80397b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803955:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803959:	48 bf 80 31 80 00 00 	movabs $0x803180,%rdi
+  803960:	00 00 00 
+  803963:	48 b8 d5 31 80 00 00 	movabs $0x8031d5,%rax
+  80396a:	00 00 00 
+  80396d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80396f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803973:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803976:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803979:	c9                   	leave
+  80397a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80397b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803980:	eb f7                	jmp    803979 <vsnprintf+0x4a>
+
+0000000000803982 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803982:	55                   	push   %rbp
+  803983:	48 89 e5             	mov    %rsp,%rbp
+  803986:	48 83 ec 50          	sub    $0x50,%rsp
+  80398a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80398e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803992:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803996:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80399d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8039a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039a5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8039a9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8039ad:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8039b1:	48 b8 2f 39 80 00 00 	movabs $0x80392f,%rax
+  8039b8:	00 00 00 
+  8039bb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8039bd:	c9                   	leave
+  8039be:	c3                   	ret
+
+00000000008039bf <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8039bf:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8039c2:	74 10                	je     8039d4 <strlen+0x15>
+    size_t n = 0;
+  8039c4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8039c9:	48 83 c0 01          	add    $0x1,%rax
+  8039cd:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8039d1:	75 f6                	jne    8039c9 <strlen+0xa>
+  8039d3:	c3                   	ret
+    size_t n = 0;
+  8039d4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8039d9:	c3                   	ret
+
+00000000008039da <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8039da:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8039dd:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8039e2:	48 85 f6             	test   %rsi,%rsi
+  8039e5:	74 11                	je     8039f8 <strnlen+0x1e>
+  8039e7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8039eb:	74 0c                	je     8039f9 <strnlen+0x1f>
+  8039ed:	48 83 c2 01          	add    $0x1,%rdx
+  8039f1:	48 39 d0             	cmp    %rdx,%rax
+  8039f4:	75 f1                	jne    8039e7 <strnlen+0xd>
+  8039f6:	eb 04                	jmp    8039fc <strnlen+0x22>
+  8039f8:	c3                   	ret
+  8039f9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8039fc:	c3                   	ret
+
+00000000008039fd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8039fd:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803a00:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a05:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803a09:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803a0c:	48 83 c2 01          	add    $0x1,%rdx
+  803a10:	84 c9                	test   %cl,%cl
+  803a12:	75 f1                	jne    803a05 <strcpy+0x8>
+        ;
+    return res;
+}
+  803a14:	c3                   	ret
+
+0000000000803a15 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803a15:	55                   	push   %rbp
+  803a16:	48 89 e5             	mov    %rsp,%rbp
+  803a19:	41 54                	push   %r12
+  803a1b:	53                   	push   %rbx
+  803a1c:	48 89 fb             	mov    %rdi,%rbx
+  803a1f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a22:	48 b8 bf 39 80 00 00 	movabs $0x8039bf,%rax
+  803a29:	00 00 00 
+  803a2c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a2e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a32:	4c 89 e6             	mov    %r12,%rsi
+  803a35:	48 b8 fd 39 80 00 00 	movabs $0x8039fd,%rax
+  803a3c:	00 00 00 
+  803a3f:	ff d0                	call   *%rax
+    return dst;
+}
+  803a41:	48 89 d8             	mov    %rbx,%rax
+  803a44:	5b                   	pop    %rbx
+  803a45:	41 5c                	pop    %r12
+  803a47:	5d                   	pop    %rbp
+  803a48:	c3                   	ret
+
+0000000000803a49 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803a49:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803a4c:	48 85 d2             	test   %rdx,%rdx
+  803a4f:	74 1f                	je     803a70 <strncpy+0x27>
+  803a51:	48 01 fa             	add    %rdi,%rdx
+  803a54:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803a57:	48 83 c1 01          	add    $0x1,%rcx
+  803a5b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803a5f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803a63:	41 80 f8 01          	cmp    $0x1,%r8b
+  803a67:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803a6b:	48 39 ca             	cmp    %rcx,%rdx
+  803a6e:	75 e7                	jne    803a57 <strncpy+0xe>
+    }
+    return ret;
+}
+  803a70:	c3                   	ret
+
+0000000000803a71 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803a71:	48 89 f8             	mov    %rdi,%rax
+  803a74:	48 85 d2             	test   %rdx,%rdx
+  803a77:	74 24                	je     803a9d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803a79:	48 83 ea 01          	sub    $0x1,%rdx
+  803a7d:	74 1b                	je     803a9a <strlcpy+0x29>
+  803a7f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803a83:	0f b6 16             	movzbl (%rsi),%edx
+  803a86:	84 d2                	test   %dl,%dl
+  803a88:	74 10                	je     803a9a <strlcpy+0x29>
+            *dst++ = *src++;
+  803a8a:	48 83 c6 01          	add    $0x1,%rsi
+  803a8e:	48 83 c0 01          	add    $0x1,%rax
+  803a92:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803a95:	48 39 c8             	cmp    %rcx,%rax
+  803a98:	75 e9                	jne    803a83 <strlcpy+0x12>
+        *dst = '\0';
+  803a9a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803a9d:	48 29 f8             	sub    %rdi,%rax
+}
+  803aa0:	c3                   	ret
+
+0000000000803aa1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803aa1:	0f b6 07             	movzbl (%rdi),%eax
+  803aa4:	84 c0                	test   %al,%al
+  803aa6:	74 13                	je     803abb <strcmp+0x1a>
+  803aa8:	38 06                	cmp    %al,(%rsi)
+  803aaa:	75 0f                	jne    803abb <strcmp+0x1a>
+  803aac:	48 83 c7 01          	add    $0x1,%rdi
+  803ab0:	48 83 c6 01          	add    $0x1,%rsi
+  803ab4:	0f b6 07             	movzbl (%rdi),%eax
+  803ab7:	84 c0                	test   %al,%al
+  803ab9:	75 ed                	jne    803aa8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803abb:	0f b6 c0             	movzbl %al,%eax
+  803abe:	0f b6 16             	movzbl (%rsi),%edx
+  803ac1:	29 d0                	sub    %edx,%eax
+}
+  803ac3:	c3                   	ret
+
+0000000000803ac4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803ac4:	48 85 d2             	test   %rdx,%rdx
+  803ac7:	74 1f                	je     803ae8 <strncmp+0x24>
+  803ac9:	0f b6 07             	movzbl (%rdi),%eax
+  803acc:	84 c0                	test   %al,%al
+  803ace:	74 1e                	je     803aee <strncmp+0x2a>
+  803ad0:	3a 06                	cmp    (%rsi),%al
+  803ad2:	75 1a                	jne    803aee <strncmp+0x2a>
+  803ad4:	48 83 c7 01          	add    $0x1,%rdi
+  803ad8:	48 83 c6 01          	add    $0x1,%rsi
+  803adc:	48 83 ea 01          	sub    $0x1,%rdx
+  803ae0:	75 e7                	jne    803ac9 <strncmp+0x5>
+
+    if (!n) return 0;
+  803ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae7:	c3                   	ret
+  803ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aed:	c3                   	ret
+  803aee:	48 85 d2             	test   %rdx,%rdx
+  803af1:	74 09                	je     803afc <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803af3:	0f b6 07             	movzbl (%rdi),%eax
+  803af6:	0f b6 16             	movzbl (%rsi),%edx
+  803af9:	29 d0                	sub    %edx,%eax
+  803afb:	c3                   	ret
+    if (!n) return 0;
+  803afc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b01:	c3                   	ret
+
+0000000000803b02 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803b02:	0f b6 17             	movzbl (%rdi),%edx
+  803b05:	84 d2                	test   %dl,%dl
+  803b07:	74 18                	je     803b21 <strchr+0x1f>
+        if (*str == c) {
+  803b09:	0f be d2             	movsbl %dl,%edx
+  803b0c:	39 f2                	cmp    %esi,%edx
+  803b0e:	74 17                	je     803b27 <strchr+0x25>
+    for (; *str; str++) {
+  803b10:	48 83 c7 01          	add    $0x1,%rdi
+  803b14:	0f b6 17             	movzbl (%rdi),%edx
+  803b17:	84 d2                	test   %dl,%dl
+  803b19:	75 ee                	jne    803b09 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b20:	c3                   	ret
+  803b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b26:	c3                   	ret
+  803b27:	48 89 f8             	mov    %rdi,%rax
+}
+  803b2a:	c3                   	ret
+
+0000000000803b2b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b2b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b2e:	0f b6 17             	movzbl (%rdi),%edx
+  803b31:	84 d2                	test   %dl,%dl
+  803b33:	74 13                	je     803b48 <strfind+0x1d>
+  803b35:	0f be d2             	movsbl %dl,%edx
+  803b38:	39 f2                	cmp    %esi,%edx
+  803b3a:	74 0b                	je     803b47 <strfind+0x1c>
+  803b3c:	48 83 c0 01          	add    $0x1,%rax
+  803b40:	0f b6 10             	movzbl (%rax),%edx
+  803b43:	84 d2                	test   %dl,%dl
+  803b45:	75 ee                	jne    803b35 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803b47:	c3                   	ret
+  803b48:	c3                   	ret
+
+0000000000803b49 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803b49:	55                   	push   %rbp
+  803b4a:	48 89 e5             	mov    %rsp,%rbp
+  803b4d:	41 57                	push   %r15
+  803b4f:	41 56                	push   %r14
+  803b51:	41 55                	push   %r13
+  803b53:	41 54                	push   %r12
+  803b55:	53                   	push   %rbx
+  803b56:	48 83 ec 08          	sub    $0x8,%rsp
+  803b5a:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803b5d:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803b61:	45 84 ed             	test   %r13b,%r13b
+  803b64:	75 12                	jne    803b78 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803b66:	4c 89 f8             	mov    %r15,%rax
+  803b69:	48 83 c4 08          	add    $0x8,%rsp
+  803b6d:	5b                   	pop    %rbx
+  803b6e:	41 5c                	pop    %r12
+  803b70:	41 5d                	pop    %r13
+  803b72:	41 5e                	pop    %r14
+  803b74:	41 5f                	pop    %r15
+  803b76:	5d                   	pop    %rbp
+  803b77:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803b78:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803b7c:	4c 89 e7             	mov    %r12,%rdi
+  803b7f:	48 b8 bf 39 80 00 00 	movabs $0x8039bf,%rax
+  803b86:	00 00 00 
+  803b89:	ff d0                	call   *%rax
+  803b8b:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803b8e:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803b92:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803b96:	49 bf c4 3a 80 00 00 	movabs $0x803ac4,%r15
+  803b9d:	00 00 00 
+				if ((sc = *s++) == 0)
+  803ba0:	84 c0                	test   %al,%al
+  803ba2:	75 14                	jne    803bb8 <strstr+0x6f>
+					return NULL;
+  803ba4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803baa:	eb ba                	jmp    803b66 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803bac:	48 83 c3 01          	add    $0x1,%rbx
+  803bb0:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803bb4:	84 c0                	test   %al,%al
+  803bb6:	74 1b                	je     803bd3 <strstr+0x8a>
+			} while (sc != c);
+  803bb8:	41 38 c5             	cmp    %al,%r13b
+  803bbb:	75 ef                	jne    803bac <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803bbd:	4c 89 f2             	mov    %r14,%rdx
+  803bc0:	4c 89 e6             	mov    %r12,%rsi
+  803bc3:	48 89 df             	mov    %rbx,%rdi
+  803bc6:	41 ff d7             	call   *%r15
+  803bc9:	85 c0                	test   %eax,%eax
+  803bcb:	75 df                	jne    803bac <strstr+0x63>
+  803bcd:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803bd1:	eb 93                	jmp    803b66 <strstr+0x1d>
+					return NULL;
+  803bd3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bd9:	eb 8b                	jmp    803b66 <strstr+0x1d>
+
+0000000000803bdb <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803bdb:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803bdd:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803be0:	8d 57 20             	lea    0x20(%rdi),%edx
+  803be3:	83 f9 1a             	cmp    $0x1a,%ecx
+  803be6:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803be9:	c3                   	ret
+
+0000000000803bea <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803bea:	55                   	push   %rbp
+  803beb:	48 89 e5             	mov    %rsp,%rbp
+  803bee:	41 57                	push   %r15
+  803bf0:	41 56                	push   %r14
+  803bf2:	41 55                	push   %r13
+  803bf4:	41 54                	push   %r12
+  803bf6:	53                   	push   %rbx
+  803bf7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803bfb:	48 39 f7             	cmp    %rsi,%rdi
+  803bfe:	74 49                	je     803c49 <strcasecmp+0x5f>
+  803c00:	49 89 fd             	mov    %rdi,%r13
+  803c03:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803c06:	49 bf db 3b 80 00 00 	movabs $0x803bdb,%r15
+  803c0d:	00 00 00 
+  803c10:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803c15:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c19:	41 ff d7             	call   *%r15
+  803c1c:	89 c3                	mov    %eax,%ebx
+  803c1e:	49 83 c4 01          	add    $0x1,%r12
+  803c22:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c28:	41 ff d7             	call   *%r15
+  803c2b:	29 c3                	sub    %eax,%ebx
+  803c2d:	75 09                	jne    803c38 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c2f:	49 83 c5 01          	add    $0x1,%r13
+  803c33:	45 84 f6             	test   %r14b,%r14b
+  803c36:	75 d8                	jne    803c10 <strcasecmp+0x26>
+}
+  803c38:	89 d8                	mov    %ebx,%eax
+  803c3a:	48 83 c4 08          	add    $0x8,%rsp
+  803c3e:	5b                   	pop    %rbx
+  803c3f:	41 5c                	pop    %r12
+  803c41:	41 5d                	pop    %r13
+  803c43:	41 5e                	pop    %r14
+  803c45:	41 5f                	pop    %r15
+  803c47:	5d                   	pop    %rbp
+  803c48:	c3                   	ret
+        return 0;
+  803c49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c4e:	eb e8                	jmp    803c38 <strcasecmp+0x4e>
+
+0000000000803c50 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c50:	55                   	push   %rbp
+  803c51:	48 89 e5             	mov    %rsp,%rbp
+  803c54:	41 57                	push   %r15
+  803c56:	41 56                	push   %r14
+  803c58:	41 55                	push   %r13
+  803c5a:	41 54                	push   %r12
+  803c5c:	53                   	push   %rbx
+  803c5d:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803c61:	48 85 d2             	test   %rdx,%rdx
+  803c64:	74 4f                	je     803cb5 <strncasecmp+0x65>
+  803c66:	49 89 fc             	mov    %rdi,%r12
+  803c69:	49 89 f5             	mov    %rsi,%r13
+  803c6c:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803c70:	49 be db 3b 80 00 00 	movabs $0x803bdb,%r14
+  803c77:	00 00 00 
+  803c7a:	49 83 c4 01          	add    $0x1,%r12
+  803c7e:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c84:	41 ff d6             	call   *%r14
+  803c87:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803c89:	49 83 c5 01          	add    $0x1,%r13
+  803c8d:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803c92:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803c95:	29 c3                	sub    %eax,%ebx
+  803c97:	85 c0                	test   %eax,%eax
+  803c99:	74 09                	je     803ca4 <strncasecmp+0x54>
+  803c9b:	85 db                	test   %ebx,%ebx
+  803c9d:	75 05                	jne    803ca4 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803c9f:	4d 39 fc             	cmp    %r15,%r12
+  803ca2:	75 d6                	jne    803c7a <strncasecmp+0x2a>
+}
+  803ca4:	89 d8                	mov    %ebx,%eax
+  803ca6:	48 83 c4 08          	add    $0x8,%rsp
+  803caa:	5b                   	pop    %rbx
+  803cab:	41 5c                	pop    %r12
+  803cad:	41 5d                	pop    %r13
+  803caf:	41 5e                	pop    %r14
+  803cb1:	41 5f                	pop    %r15
+  803cb3:	5d                   	pop    %rbp
+  803cb4:	c3                   	ret
+    int d = 0;
+  803cb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803cba:	eb e8                	jmp    803ca4 <strncasecmp+0x54>
+
+0000000000803cbc <toupper>:
+
+int toupper(int c) {
+  803cbc:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803cbe:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803cc1:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803cc4:	83 f9 1a             	cmp    $0x1a,%ecx
+  803cc7:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803cca:	c3                   	ret
+
+0000000000803ccb <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803ccb:	83 ff 20             	cmp    $0x20,%edi
+  803cce:	0f 94 c0             	sete   %al
+  803cd1:	0f b6 c0             	movzbl %al,%eax
+}
+  803cd4:	c3                   	ret
+
+0000000000803cd5 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803cd5:	89 f8                	mov    %edi,%eax
+  803cd7:	f7 d8                	neg    %eax
+  803cd9:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803cdc:	c3                   	ret
+
+0000000000803cdd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803cdd:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803ce0:	48 89 f8             	mov    %rdi,%rax
+  803ce3:	48 f7 d8             	neg    %rax
+  803ce6:	83 e0 07             	and    $0x7,%eax
+  803ce9:	49 89 d1             	mov    %rdx,%r9
+  803cec:	49 29 c1             	sub    %rax,%r9
+  803cef:	78 36                	js     803d27 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803cf1:	40 0f b6 c6          	movzbl %sil,%eax
+  803cf5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803cfc:	01 01 01 
+  803cff:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803d03:	40 f6 c7 07          	test   $0x7,%dil
+  803d07:	75 38                	jne    803d41 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803d09:	4c 89 c9             	mov    %r9,%rcx
+  803d0c:	48 c1 f9 03          	sar    $0x3,%rcx
+  803d10:	74 0c                	je     803d1e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803d12:	fc                   	cld
+  803d13:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803d16:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d1a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d1e:	4d 85 c9             	test   %r9,%r9
+  803d21:	75 45                	jne    803d68 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d23:	4c 89 c0             	mov    %r8,%rax
+  803d26:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d27:	48 85 d2             	test   %rdx,%rdx
+  803d2a:	74 f7                	je     803d23 <memset+0x46>
+  803d2c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d2f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d32:	48 83 c0 01          	add    $0x1,%rax
+  803d36:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d3a:	48 39 c2             	cmp    %rax,%rdx
+  803d3d:	75 f3                	jne    803d32 <memset+0x55>
+  803d3f:	eb e2                	jmp    803d23 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d41:	40 f6 c7 01          	test   $0x1,%dil
+  803d45:	74 06                	je     803d4d <memset+0x70>
+  803d47:	88 07                	mov    %al,(%rdi)
+  803d49:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d4d:	40 f6 c7 02          	test   $0x2,%dil
+  803d51:	74 07                	je     803d5a <memset+0x7d>
+  803d53:	66 89 07             	mov    %ax,(%rdi)
+  803d56:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d5a:	40 f6 c7 04          	test   $0x4,%dil
+  803d5e:	74 a9                	je     803d09 <memset+0x2c>
+  803d60:	89 07                	mov    %eax,(%rdi)
+  803d62:	48 83 c7 04          	add    $0x4,%rdi
+  803d66:	eb a1                	jmp    803d09 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d68:	41 f6 c1 04          	test   $0x4,%r9b
+  803d6c:	74 06                	je     803d74 <memset+0x97>
+  803d6e:	89 07                	mov    %eax,(%rdi)
+  803d70:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d74:	41 f6 c1 02          	test   $0x2,%r9b
+  803d78:	74 07                	je     803d81 <memset+0xa4>
+  803d7a:	66 89 07             	mov    %ax,(%rdi)
+  803d7d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803d81:	41 f6 c1 01          	test   $0x1,%r9b
+  803d85:	74 9c                	je     803d23 <memset+0x46>
+  803d87:	88 07                	mov    %al,(%rdi)
+  803d89:	eb 98                	jmp    803d23 <memset+0x46>
+
+0000000000803d8b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803d8b:	48 89 f8             	mov    %rdi,%rax
+  803d8e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803d91:	48 39 fe             	cmp    %rdi,%rsi
+  803d94:	73 3b                	jae    803dd1 <memmove+0x46>
+  803d96:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803d9a:	48 39 d7             	cmp    %rdx,%rdi
+  803d9d:	73 32                	jae    803dd1 <memmove+0x46>
+        s += n;
+        d += n;
+  803d9f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803da3:	48 89 d6             	mov    %rdx,%rsi
+  803da6:	48 09 fe             	or     %rdi,%rsi
+  803da9:	48 09 ce             	or     %rcx,%rsi
+  803dac:	40 f6 c6 07          	test   $0x7,%sil
+  803db0:	75 12                	jne    803dc4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803db2:	48 83 ef 08          	sub    $0x8,%rdi
+  803db6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803dba:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dbe:	fd                   	std
+  803dbf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803dc2:	fc                   	cld
+  803dc3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803dc4:	48 83 ef 01          	sub    $0x1,%rdi
+  803dc8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803dcc:	fd                   	std
+  803dcd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803dcf:	eb f1                	jmp    803dc2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803dd1:	48 89 f2             	mov    %rsi,%rdx
+  803dd4:	48 09 c2             	or     %rax,%rdx
+  803dd7:	48 09 ca             	or     %rcx,%rdx
+  803dda:	f6 c2 07             	test   $0x7,%dl
+  803ddd:	75 0c                	jne    803deb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803ddf:	48 c1 e9 03          	shr    $0x3,%rcx
+  803de3:	48 89 c7             	mov    %rax,%rdi
+  803de6:	fc                   	cld
+  803de7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803dea:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803deb:	48 89 c7             	mov    %rax,%rdi
+  803dee:	fc                   	cld
+  803def:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803df1:	c3                   	ret
+
+0000000000803df2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803df2:	55                   	push   %rbp
+  803df3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803df6:	48 b8 8b 3d 80 00 00 	movabs $0x803d8b,%rax
+  803dfd:	00 00 00 
+  803e00:	ff d0                	call   *%rax
+}
+  803e02:	5d                   	pop    %rbp
+  803e03:	c3                   	ret
+
+0000000000803e04 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803e04:	55                   	push   %rbp
+  803e05:	48 89 e5             	mov    %rsp,%rbp
+  803e08:	41 57                	push   %r15
+  803e0a:	41 56                	push   %r14
+  803e0c:	41 55                	push   %r13
+  803e0e:	41 54                	push   %r12
+  803e10:	53                   	push   %rbx
+  803e11:	48 83 ec 08          	sub    $0x8,%rsp
+  803e15:	49 89 fe             	mov    %rdi,%r14
+  803e18:	49 89 f7             	mov    %rsi,%r15
+  803e1b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e1e:	48 89 f7             	mov    %rsi,%rdi
+  803e21:	48 b8 bf 39 80 00 00 	movabs $0x8039bf,%rax
+  803e28:	00 00 00 
+  803e2b:	ff d0                	call   *%rax
+  803e2d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e30:	48 89 de             	mov    %rbx,%rsi
+  803e33:	4c 89 f7             	mov    %r14,%rdi
+  803e36:	48 b8 da 39 80 00 00 	movabs $0x8039da,%rax
+  803e3d:	00 00 00 
+  803e40:	ff d0                	call   *%rax
+  803e42:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e45:	48 39 c3             	cmp    %rax,%rbx
+  803e48:	74 36                	je     803e80 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e4a:	48 89 d8             	mov    %rbx,%rax
+  803e4d:	4c 29 e8             	sub    %r13,%rax
+  803e50:	49 39 c4             	cmp    %rax,%r12
+  803e53:	73 31                	jae    803e86 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803e55:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803e5a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e5e:	4c 89 fe             	mov    %r15,%rsi
+  803e61:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  803e68:	00 00 00 
+  803e6b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803e6d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803e71:	48 83 c4 08          	add    $0x8,%rsp
+  803e75:	5b                   	pop    %rbx
+  803e76:	41 5c                	pop    %r12
+  803e78:	41 5d                	pop    %r13
+  803e7a:	41 5e                	pop    %r14
+  803e7c:	41 5f                	pop    %r15
+  803e7e:	5d                   	pop    %rbp
+  803e7f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e80:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803e84:	eb eb                	jmp    803e71 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803e86:	48 83 eb 01          	sub    $0x1,%rbx
+  803e8a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e8e:	48 89 da             	mov    %rbx,%rdx
+  803e91:	4c 89 fe             	mov    %r15,%rsi
+  803e94:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  803e9b:	00 00 00 
+  803e9e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803ea0:	49 01 de             	add    %rbx,%r14
+  803ea3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803ea8:	eb c3                	jmp    803e6d <strlcat+0x69>
+
+0000000000803eaa <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803eaa:	48 85 d2             	test   %rdx,%rdx
+  803ead:	74 2d                	je     803edc <memcmp+0x32>
+  803eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803eb4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803eb8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803ebd:	44 38 c1             	cmp    %r8b,%cl
+  803ec0:	75 0f                	jne    803ed1 <memcmp+0x27>
+    while (n-- > 0) {
+  803ec2:	48 83 c0 01          	add    $0x1,%rax
+  803ec6:	48 39 c2             	cmp    %rax,%rdx
+  803ec9:	75 e9                	jne    803eb4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803ecb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803ed1:	0f b6 c1             	movzbl %cl,%eax
+  803ed4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803ed8:	44 29 c0             	sub    %r8d,%eax
+  803edb:	c3                   	ret
+    return 0;
+  803edc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee1:	c3                   	ret
+
+0000000000803ee2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803ee2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803ee6:	48 39 c7             	cmp    %rax,%rdi
+  803ee9:	73 0f                	jae    803efa <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803eeb:	40 38 37             	cmp    %sil,(%rdi)
+  803eee:	74 0e                	je     803efe <memfind+0x1c>
+    for (; src < end; src++) {
+  803ef0:	48 83 c7 01          	add    $0x1,%rdi
+  803ef4:	48 39 f8             	cmp    %rdi,%rax
+  803ef7:	75 f2                	jne    803eeb <memfind+0x9>
+  803ef9:	c3                   	ret
+  803efa:	48 89 f8             	mov    %rdi,%rax
+  803efd:	c3                   	ret
+  803efe:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803f01:	c3                   	ret
+
+0000000000803f02 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803f02:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803f05:	0f b6 37             	movzbl (%rdi),%esi
+  803f08:	40 80 fe 20          	cmp    $0x20,%sil
+  803f0c:	74 06                	je     803f14 <strtol+0x12>
+  803f0e:	40 80 fe 09          	cmp    $0x9,%sil
+  803f12:	75 13                	jne    803f27 <strtol+0x25>
+  803f14:	48 83 c7 01          	add    $0x1,%rdi
+  803f18:	0f b6 37             	movzbl (%rdi),%esi
+  803f1b:	40 80 fe 20          	cmp    $0x20,%sil
+  803f1f:	74 f3                	je     803f14 <strtol+0x12>
+  803f21:	40 80 fe 09          	cmp    $0x9,%sil
+  803f25:	74 ed                	je     803f14 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f27:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f2a:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f2d:	3c 01                	cmp    $0x1,%al
+  803f2f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f33:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f39:	75 0f                	jne    803f4a <strtol+0x48>
+  803f3b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f3e:	74 14                	je     803f54 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f40:	85 d2                	test   %edx,%edx
+  803f42:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f47:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803f4f:	4c 63 ca             	movslq %edx,%r9
+  803f52:	eb 36                	jmp    803f8a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f54:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803f58:	74 0f                	je     803f69 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803f5a:	85 d2                	test   %edx,%edx
+  803f5c:	75 ec                	jne    803f4a <strtol+0x48>
+        s++;
+  803f5e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803f62:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803f67:	eb e1                	jmp    803f4a <strtol+0x48>
+        s += 2;
+  803f69:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803f6d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803f72:	eb d6                	jmp    803f4a <strtol+0x48>
+            dig -= '0';
+  803f74:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803f77:	44 0f b6 c1          	movzbl %cl,%r8d
+  803f7b:	41 39 d0             	cmp    %edx,%r8d
+  803f7e:	7d 21                	jge    803fa1 <strtol+0x9f>
+        val = val * base + dig;
+  803f80:	49 0f af c1          	imul   %r9,%rax
+  803f84:	0f b6 c9             	movzbl %cl,%ecx
+  803f87:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803f8a:	48 83 c7 01          	add    $0x1,%rdi
+  803f8e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803f92:	80 f9 39             	cmp    $0x39,%cl
+  803f95:	76 dd                	jbe    803f74 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803f97:	80 f9 7b             	cmp    $0x7b,%cl
+  803f9a:	77 05                	ja     803fa1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803f9c:	83 e9 57             	sub    $0x57,%ecx
+  803f9f:	eb d6                	jmp    803f77 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803fa1:	4d 85 d2             	test   %r10,%r10
+  803fa4:	74 03                	je     803fa9 <strtol+0xa7>
+  803fa6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803fa9:	48 89 c2             	mov    %rax,%rdx
+  803fac:	48 f7 da             	neg    %rdx
+  803faf:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803fb3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803fb7:	c3                   	ret
+
+0000000000803fb8 <atoi>:
+int atoi(const char *str) {
+  803fb8:	55                   	push   %rbp
+  803fb9:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  803fbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fc1:	be 00 00 00 00       	mov    $0x0,%esi
+  803fc6:	48 b8 02 3f 80 00 00 	movabs $0x803f02,%rax
+  803fcd:	00 00 00 
+  803fd0:	ff d0                	call   *%rax
+}
+  803fd2:	5d                   	pop    %rbp
+  803fd3:	c3                   	ret
+
+0000000000803fd4 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fd4:	55                   	push   %rbp
+  803fd5:	48 89 e5             	mov    %rsp,%rbp
+  803fd8:	41 55                	push   %r13
+  803fda:	41 54                	push   %r12
+  803fdc:	53                   	push   %rbx
+  803fdd:	48 83 ec 08          	sub    $0x8,%rsp
+  803fe1:	49 89 fc             	mov    %rdi,%r12
+  803fe4:	48 89 f7             	mov    %rsi,%rdi
+  803fe7:	48 89 d3             	mov    %rdx,%rbx
+  803fea:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803fed:	48 85 f6             	test   %rsi,%rsi
+  803ff0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ff7:	00 00 00 
+  803ffa:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  803ffe:	be 00 10 00 00       	mov    $0x1000,%esi
+  804003:	48 85 d2             	test   %rdx,%rdx
+  804006:	74 03                	je     80400b <ipc_recv+0x37>
+  804008:	48 8b 32             	mov    (%rdx),%rsi
+  80400b:	48 b8 43 06 80 00 00 	movabs $0x800643,%rax
+  804012:	00 00 00 
+  804015:	ff d0                	call   *%rax
+    if (errno) {
+  804017:	85 c0                	test   %eax,%eax
+  804019:	74 1c                	je     804037 <ipc_recv+0x63>
+        if (from_env_store)
+  80401b:	4d 85 e4             	test   %r12,%r12
+  80401e:	74 08                	je     804028 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804020:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804027:	00 
+
+        if (perm_store)
+  804028:	4d 85 ed             	test   %r13,%r13
+  80402b:	74 74                	je     8040a1 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80402d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804034:	00 
+  804035:	eb 6a                	jmp    8040a1 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804037:	4d 85 e4             	test   %r12,%r12
+  80403a:	74 14                	je     804050 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80403c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804043:	00 00 00 
+  804046:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80404c:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804050:	48 85 db             	test   %rbx,%rbx
+  804053:	74 23                	je     804078 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804055:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80405c:	00 00 00 
+  80405f:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804065:	ba 00 00 00 00       	mov    $0x0,%edx
+  80406a:	85 c9                	test   %ecx,%ecx
+  80406c:	74 07                	je     804075 <ipc_recv+0xa1>
+  80406e:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804075:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804078:	4d 85 ed             	test   %r13,%r13
+  80407b:	74 14                	je     804091 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80407d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804084:	00 00 00 
+  804087:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80408d:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804091:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804098:	00 00 00 
+  80409b:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040a1:	48 83 c4 08          	add    $0x8,%rsp
+  8040a5:	5b                   	pop    %rbx
+  8040a6:	41 5c                	pop    %r12
+  8040a8:	41 5d                	pop    %r13
+  8040aa:	5d                   	pop    %rbp
+  8040ab:	c3                   	ret
+
+00000000008040ac <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040ac:	55                   	push   %rbp
+  8040ad:	48 89 e5             	mov    %rsp,%rbp
+  8040b0:	41 55                	push   %r13
+  8040b2:	41 54                	push   %r12
+  8040b4:	53                   	push   %rbx
+  8040b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8040b9:	49 89 fc             	mov    %rdi,%r12
+  8040bc:	48 89 f7             	mov    %rsi,%rdi
+  8040bf:	48 89 d3             	mov    %rdx,%rbx
+  8040c2:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040c5:	48 85 f6             	test   %rsi,%rsi
+  8040c8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040cf:	00 00 00 
+  8040d2:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040db:	48 85 d2             	test   %rdx,%rdx
+  8040de:	74 03                	je     8040e3 <ipc_try_recv+0x37>
+  8040e0:	48 8b 32             	mov    (%rdx),%rsi
+  8040e3:	48 b8 ac 06 80 00 00 	movabs $0x8006ac,%rax
+  8040ea:	00 00 00 
+  8040ed:	ff d0                	call   *%rax
+    if (errno) {
+  8040ef:	85 c0                	test   %eax,%eax
+  8040f1:	75 75                	jne    804168 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8040f3:	4d 85 e4             	test   %r12,%r12
+  8040f6:	74 14                	je     80410c <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8040f8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040ff:	00 00 00 
+  804102:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804108:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80410c:	48 85 db             	test   %rbx,%rbx
+  80410f:	74 23                	je     804134 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804111:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804118:	00 00 00 
+  80411b:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804121:	ba 00 00 00 00       	mov    $0x0,%edx
+  804126:	85 c9                	test   %ecx,%ecx
+  804128:	74 07                	je     804131 <ipc_try_recv+0x85>
+  80412a:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804131:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804134:	4d 85 ed             	test   %r13,%r13
+  804137:	74 14                	je     80414d <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804139:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804140:	00 00 00 
+  804143:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804149:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80414d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804154:	00 00 00 
+  804157:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80415d:	48 83 c4 08          	add    $0x8,%rsp
+  804161:	5b                   	pop    %rbx
+  804162:	41 5c                	pop    %r12
+  804164:	41 5d                	pop    %r13
+  804166:	5d                   	pop    %rbp
+  804167:	c3                   	ret
+        if (from_env_store)
+  804168:	4d 85 e4             	test   %r12,%r12
+  80416b:	74 08                	je     804175 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80416d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804174:	00 
+        if (perm_store)
+  804175:	4d 85 ed             	test   %r13,%r13
+  804178:	74 e3                	je     80415d <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80417a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804181:	00 
+  804182:	eb d9                	jmp    80415d <ipc_try_recv+0xb1>
+
+0000000000804184 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804184:	55                   	push   %rbp
+  804185:	48 89 e5             	mov    %rsp,%rbp
+  804188:	41 57                	push   %r15
+  80418a:	41 56                	push   %r14
+  80418c:	41 55                	push   %r13
+  80418e:	41 54                	push   %r12
+  804190:	53                   	push   %rbx
+  804191:	48 83 ec 18          	sub    $0x18,%rsp
+  804195:	41 89 fd             	mov    %edi,%r13d
+  804198:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80419b:	48 89 d3             	mov    %rdx,%rbx
+  80419e:	49 89 cc             	mov    %rcx,%r12
+  8041a1:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041a5:	48 85 d2             	test   %rdx,%rdx
+  8041a8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041af:	00 00 00 
+  8041b2:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041b6:	49 be 17 06 80 00 00 	movabs $0x800617,%r14
+  8041bd:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041c0:	49 bf 07 02 80 00 00 	movabs $0x800207,%r15
+  8041c7:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041ca:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041cd:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041d1:	4c 89 e1             	mov    %r12,%rcx
+  8041d4:	48 89 da             	mov    %rbx,%rdx
+  8041d7:	44 89 ef             	mov    %r13d,%edi
+  8041da:	41 ff d6             	call   *%r14
+  8041dd:	85 c0                	test   %eax,%eax
+  8041df:	74 37                	je     804218 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041e1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041e4:	75 05                	jne    8041eb <ipc_send+0x67>
+        sys_yield();
+  8041e6:	41 ff d7             	call   *%r15
+  8041e9:	eb df                	jmp    8041ca <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041eb:	89 c1                	mov    %eax,%ecx
+  8041ed:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  8041f4:	00 00 00 
+  8041f7:	be 65 00 00 00       	mov    $0x65,%esi
+  8041fc:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  804203:	00 00 00 
+  804206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80420b:	49 b8 35 2f 80 00 00 	movabs $0x802f35,%r8
+  804212:	00 00 00 
+  804215:	41 ff d0             	call   *%r8
+    }
+}
+  804218:	48 83 c4 18          	add    $0x18,%rsp
+  80421c:	5b                   	pop    %rbx
+  80421d:	41 5c                	pop    %r12
+  80421f:	41 5d                	pop    %r13
+  804221:	41 5e                	pop    %r14
+  804223:	41 5f                	pop    %r15
+  804225:	5d                   	pop    %rbp
+  804226:	c3                   	ret
+
+0000000000804227 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804227:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80422c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804233:	00 00 00 
+  804236:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80423d:	48 01 ca             	add    %rcx,%rdx
+  804240:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804246:	39 fa                	cmp    %edi,%edx
+  804248:	74 12                	je     80425c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80424a:	48 83 c0 01          	add    $0x1,%rax
+  80424e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804254:	75 e0                	jne    804236 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804256:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80425b:	c3                   	ret
+            return envs[i].env_id;
+  80425c:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804263:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80426a:	00 00 00 
+  80426d:	48 01 d0             	add    %rdx,%rax
+  804270:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804276:	c3                   	ret
+
+0000000000804277 <__text_end>:
+  804277:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80427e:	00 00 00 
+  804281:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804288:	00 00 00 
+  80428b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804292:	00 00 00 
+  804295:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429c:	00 00 00 
+  80429f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a6:	00 00 00 
+  8042a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b0:	00 00 00 
+  8042b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ba:	00 00 00 
+  8042bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c4:	00 00 00 
+  8042c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ce:	00 00 00 
+  8042d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d8:	00 00 00 
+  8042db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e2:	00 00 00 
+  8042e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ec:	00 00 00 
+  8042ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f6:	00 00 00 
+  8042f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804300:	00 00 00 
+  804303:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430a:	00 00 00 
+  80430d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804314:	00 00 00 
+  804317:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431e:	00 00 00 
+  804321:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804328:	00 00 00 
+  80432b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804332:	00 00 00 
+  804335:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433c:	00 00 00 
+  80433f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804346:	00 00 00 
+  804349:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804350:	00 00 00 
+  804353:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435a:	00 00 00 
+  80435d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804364:	00 00 00 
+  804367:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436e:	00 00 00 
+  804371:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804378:	00 00 00 
+  80437b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804382:	00 00 00 
+  804385:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438c:	00 00 00 
+  80438f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804396:	00 00 00 
+  804399:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a0:	00 00 00 
+  8043a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043aa:	00 00 00 
+  8043ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b4:	00 00 00 
+  8043b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043be:	00 00 00 
+  8043c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c8:	00 00 00 
+  8043cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d2:	00 00 00 
+  8043d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dc:	00 00 00 
+  8043df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e6:	00 00 00 
+  8043e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f0:	00 00 00 
+  8043f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fa:	00 00 00 
+  8043fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804404:	00 00 00 
+  804407:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440e:	00 00 00 
+  804411:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804418:	00 00 00 
+  80441b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804422:	00 00 00 
+  804425:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442c:	00 00 00 
+  80442f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804436:	00 00 00 
+  804439:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804440:	00 00 00 
+  804443:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444a:	00 00 00 
+  80444d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804454:	00 00 00 
+  804457:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445e:	00 00 00 
+  804461:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804468:	00 00 00 
+  80446b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804472:	00 00 00 
+  804475:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447c:	00 00 00 
+  80447f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804486:	00 00 00 
+  804489:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804490:	00 00 00 
+  804493:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449a:	00 00 00 
+  80449d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a4:	00 00 00 
+  8044a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ae:	00 00 00 
+  8044b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b8:	00 00 00 
+  8044bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c2:	00 00 00 
+  8044c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cc:	00 00 00 
+  8044cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d6:	00 00 00 
+  8044d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e0:	00 00 00 
+  8044e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ea:	00 00 00 
+  8044ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f4:	00 00 00 
+  8044f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fe:	00 00 00 
+  804501:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804508:	00 00 00 
+  80450b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804512:	00 00 00 
+  804515:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451c:	00 00 00 
+  80451f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804526:	00 00 00 
+  804529:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804530:	00 00 00 
+  804533:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453a:	00 00 00 
+  80453d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804544:	00 00 00 
+  804547:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454e:	00 00 00 
+  804551:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804558:	00 00 00 
+  80455b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804562:	00 00 00 
+  804565:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456c:	00 00 00 
+  80456f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804576:	00 00 00 
+  804579:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804580:	00 00 00 
+  804583:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458a:	00 00 00 
+  80458d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804594:	00 00 00 
+  804597:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459e:	00 00 00 
+  8045a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a8:	00 00 00 
+  8045ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b2:	00 00 00 
+  8045b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bc:	00 00 00 
+  8045bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c6:	00 00 00 
+  8045c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d0:	00 00 00 
+  8045d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045da:	00 00 00 
+  8045dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e4:	00 00 00 
+  8045e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ee:	00 00 00 
+  8045f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f8:	00 00 00 
+  8045fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804602:	00 00 00 
+  804605:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460c:	00 00 00 
+  80460f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804616:	00 00 00 
+  804619:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804620:	00 00 00 
+  804623:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462a:	00 00 00 
+  80462d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804634:	00 00 00 
+  804637:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463e:	00 00 00 
+  804641:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804648:	00 00 00 
+  80464b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804652:	00 00 00 
+  804655:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465c:	00 00 00 
+  80465f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804666:	00 00 00 
+  804669:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804670:	00 00 00 
+  804673:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467a:	00 00 00 
+  80467d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804684:	00 00 00 
+  804687:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468e:	00 00 00 
+  804691:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804698:	00 00 00 
+  80469b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a2:	00 00 00 
+  8046a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ac:	00 00 00 
+  8046af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b6:	00 00 00 
+  8046b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c0:	00 00 00 
+  8046c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ca:	00 00 00 
+  8046cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d4:	00 00 00 
+  8046d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046de:	00 00 00 
+  8046e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e8:	00 00 00 
+  8046eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f2:	00 00 00 
+  8046f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fc:	00 00 00 
+  8046ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804706:	00 00 00 
+  804709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804710:	00 00 00 
+  804713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471a:	00 00 00 
+  80471d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804724:	00 00 00 
+  804727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472e:	00 00 00 
+  804731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804738:	00 00 00 
+  80473b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804742:	00 00 00 
+  804745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474c:	00 00 00 
+  80474f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804756:	00 00 00 
+  804759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804760:	00 00 00 
+  804763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476a:	00 00 00 
+  80476d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804774:	00 00 00 
+  804777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477e:	00 00 00 
+  804781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804788:	00 00 00 
+  80478b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804792:	00 00 00 
+  804795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479c:	00 00 00 
+  80479f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a6:	00 00 00 
+  8047a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b0:	00 00 00 
+  8047b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ba:	00 00 00 
+  8047bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c4:	00 00 00 
+  8047c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ce:	00 00 00 
+  8047d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d8:	00 00 00 
+  8047db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e2:	00 00 00 
+  8047e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ec:	00 00 00 
+  8047ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f6:	00 00 00 
+  8047f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804800:	00 00 00 
+  804803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480a:	00 00 00 
+  80480d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804814:	00 00 00 
+  804817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481e:	00 00 00 
+  804821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804828:	00 00 00 
+  80482b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804832:	00 00 00 
+  804835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483c:	00 00 00 
+  80483f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804846:	00 00 00 
+  804849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804850:	00 00 00 
+  804853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485a:	00 00 00 
+  80485d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804864:	00 00 00 
+  804867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486e:	00 00 00 
+  804871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804878:	00 00 00 
+  80487b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804882:	00 00 00 
+  804885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488c:	00 00 00 
+  80488f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804896:	00 00 00 
+  804899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a0:	00 00 00 
+  8048a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048aa:	00 00 00 
+  8048ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b4:	00 00 00 
+  8048b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048be:	00 00 00 
+  8048c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c8:	00 00 00 
+  8048cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d2:	00 00 00 
+  8048d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dc:	00 00 00 
+  8048df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e6:	00 00 00 
+  8048e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f0:	00 00 00 
+  8048f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fa:	00 00 00 
+  8048fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804904:	00 00 00 
+  804907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490e:	00 00 00 
+  804911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804918:	00 00 00 
+  80491b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804922:	00 00 00 
+  804925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492c:	00 00 00 
+  80492f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804936:	00 00 00 
+  804939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804940:	00 00 00 
+  804943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494a:	00 00 00 
+  80494d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804954:	00 00 00 
+  804957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495e:	00 00 00 
+  804961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804968:	00 00 00 
+  80496b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804972:	00 00 00 
+  804975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497c:	00 00 00 
+  80497f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804986:	00 00 00 
+  804989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804990:	00 00 00 
+  804993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499a:	00 00 00 
+  80499d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a4:	00 00 00 
+  8049a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ae:	00 00 00 
+  8049b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b8:	00 00 00 
+  8049bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c2:	00 00 00 
+  8049c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cc:	00 00 00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e0:	00 00 00 
+  8049e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ea:	00 00 00 
+  8049ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f4:	00 00 00 
+  8049f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fe:	00 00 00 
+  804a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a08:	00 00 00 
+  804a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a12:	00 00 00 
+  804a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1c:	00 00 00 
+  804a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a26:	00 00 00 
+  804a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a30:	00 00 00 
+  804a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3a:	00 00 00 
+  804a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a44:	00 00 00 
+  804a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4e:	00 00 00 
+  804a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a58:	00 00 00 
+  804a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a62:	00 00 00 
+  804a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6c:	00 00 00 
+  804a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a76:	00 00 00 
+  804a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a80:	00 00 00 
+  804a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8a:	00 00 00 
+  804a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a94:	00 00 00 
+  804a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9e:	00 00 00 
+  804aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa8:	00 00 00 
+  804aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab2:	00 00 00 
+  804ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abc:	00 00 00 
+  804abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac6:	00 00 00 
+  804ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad0:	00 00 00 
+  804ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ada:	00 00 00 
+  804add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae4:	00 00 00 
+  804ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aee:	00 00 00 
+  804af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af8:	00 00 00 
+  804afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b02:	00 00 00 
+  804b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0c:	00 00 00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b20:	00 00 00 
+  804b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2a:	00 00 00 
+  804b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b34:	00 00 00 
+  804b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3e:	00 00 00 
+  804b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b48:	00 00 00 
+  804b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b52:	00 00 00 
+  804b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5c:	00 00 00 
+  804b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b66:	00 00 00 
+  804b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b70:	00 00 00 
+  804b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7a:	00 00 00 
+  804b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b84:	00 00 00 
+  804b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8e:	00 00 00 
+  804b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b98:	00 00 00 
+  804b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba2:	00 00 00 
+  804ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bac:	00 00 00 
+  804baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb6:	00 00 00 
+  804bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc0:	00 00 00 
+  804bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bca:	00 00 00 
+  804bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd4:	00 00 00 
+  804bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bde:	00 00 00 
+  804be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be8:	00 00 00 
+  804beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf2:	00 00 00 
+  804bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfc:	00 00 00 
+  804bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c06:	00 00 00 
+  804c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c10:	00 00 00 
+  804c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1a:	00 00 00 
+  804c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c24:	00 00 00 
+  804c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2e:	00 00 00 
+  804c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c38:	00 00 00 
+  804c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c42:	00 00 00 
+  804c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4c:	00 00 00 
+  804c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c56:	00 00 00 
+  804c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c60:	00 00 00 
+  804c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6a:	00 00 00 
+  804c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c74:	00 00 00 
+  804c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7e:	00 00 00 
+  804c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c88:	00 00 00 
+  804c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c92:	00 00 00 
+  804c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9c:	00 00 00 
+  804c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca6:	00 00 00 
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
@@ -0,0 +1,8098 @@
+
+obj/user/buggyhello2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 26 00 00 00       	call   800049 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs(hello, 1024 * 1024);
+  800029:	be 00 00 10 00       	mov    $0x100000,%esi
+  80002e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800035:	00 00 00 
+  800038:	48 8b 38             	mov    (%rax),%rdi
+  80003b:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+}
+  800047:	5d                   	pop    %rbp
+  800048:	c3                   	ret
+
+0000000000800049 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800049:	55                   	push   %rbp
+  80004a:	48 89 e5             	mov    %rsp,%rbp
+  80004d:	41 56                	push   %r14
+  80004f:	41 55                	push   %r13
+  800051:	41 54                	push   %r12
+  800053:	53                   	push   %rbx
+  800054:	41 89 fd             	mov    %edi,%r13d
+  800057:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005a:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800061:	00 00 00 
+  800064:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80006b:	00 00 00 
+  80006e:	48 39 c2             	cmp    %rax,%rdx
+  800071:	73 17                	jae    80008a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800073:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800076:	49 89 c4             	mov    %rax,%r12
+  800079:	48 83 c3 08          	add    $0x8,%rbx
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	ff 53 f8             	call   *-0x8(%rbx)
+  800085:	4c 39 e3             	cmp    %r12,%rbx
+  800088:	72 ef                	jb     800079 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80008a:	48 b8 de 01 80 00 00 	movabs $0x8001de,%rax
+  800091:	00 00 00 
+  800094:	ff d0                	call   *%rax
+  800096:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009b:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000a2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a9:	00 00 00 
+  8000ac:	48 01 d0             	add    %rdx,%rax
+  8000af:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000b6:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b9:	45 85 ed             	test   %r13d,%r13d
+  8000bc:	7e 0d                	jle    8000cb <libmain+0x82>
+  8000be:	49 8b 06             	mov    (%r14),%rax
+  8000c1:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  8000c8:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000cb:	4c 89 f6             	mov    %r14,%rsi
+  8000ce:	44 89 ef             	mov    %r13d,%edi
+  8000d1:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d8:	00 00 00 
+  8000db:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000dd:	48 b8 f2 00 80 00 00 	movabs $0x8000f2,%rax
+  8000e4:	00 00 00 
+  8000e7:	ff d0                	call   *%rax
+#endif
+}
+  8000e9:	5b                   	pop    %rbx
+  8000ea:	41 5c                	pop    %r12
+  8000ec:	41 5d                	pop    %r13
+  8000ee:	41 5e                	pop    %r14
+  8000f0:	5d                   	pop    %rbp
+  8000f1:	c3                   	ret
+
+00000000008000f2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f2:	55                   	push   %rbp
+  8000f3:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f6:	48 b8 da 0e 80 00 00 	movabs $0x800eda,%rax
+  8000fd:	00 00 00 
+  800100:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800102:	bf 00 00 00 00       	mov    $0x0,%edi
+  800107:	48 b8 73 01 80 00 00 	movabs $0x800173,%rax
+  80010e:	00 00 00 
+  800111:	ff d0                	call   *%rax
+}
+  800113:	5d                   	pop    %rbp
+  800114:	c3                   	ret
+
+0000000000800115 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800115:	55                   	push   %rbp
+  800116:	48 89 e5             	mov    %rsp,%rbp
+  800119:	53                   	push   %rbx
+  80011a:	48 89 fa             	mov    %rdi,%rdx
+  80011d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800125:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80012a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80012f:	be 00 00 00 00       	mov    $0x0,%esi
+  800134:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80013a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80013c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800140:	c9                   	leave
+  800141:	c3                   	ret
+
+0000000000800142 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800142:	55                   	push   %rbp
+  800143:	48 89 e5             	mov    %rsp,%rbp
+  800146:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800147:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80014c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800151:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800156:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80015b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800160:	be 00 00 00 00       	mov    $0x0,%esi
+  800165:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80016b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80016d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800171:	c9                   	leave
+  800172:	c3                   	ret
+
+0000000000800173 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800173:	55                   	push   %rbp
+  800174:	48 89 e5             	mov    %rsp,%rbp
+  800177:	53                   	push   %rbx
+  800178:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80017c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80017f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800184:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800189:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80018e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800193:	be 00 00 00 00       	mov    $0x0,%esi
+  800198:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80019e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001a0:	48 85 c0             	test   %rax,%rax
+  8001a3:	7f 06                	jg     8001ab <sys_env_destroy+0x38>
+}
+  8001a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a9:	c9                   	leave
+  8001aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001ab:	49 89 c0             	mov    %rax,%r8
+  8001ae:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001b3:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8001ba:	00 00 00 
+  8001bd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001c2:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  8001c9:	00 00 00 
+  8001cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d1:	49 b9 3d 2f 80 00 00 	movabs $0x802f3d,%r9
+  8001d8:	00 00 00 
+  8001db:	41 ff d1             	call   *%r9
+
+00000000008001de <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001de:	55                   	push   %rbp
+  8001df:	48 89 e5             	mov    %rsp,%rbp
+  8001e2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001e3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800201:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800207:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800209:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+
+000000000080020f <sys_yield>:
+
+void
+sys_yield(void) {
+  80020f:	55                   	push   %rbp
+  800210:	48 89 e5             	mov    %rsp,%rbp
+  800213:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800214:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800219:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800223:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800228:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80022d:	be 00 00 00 00       	mov    $0x0,%esi
+  800232:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800238:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80023a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80023e:	c9                   	leave
+  80023f:	c3                   	ret
+
+0000000000800240 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800240:	55                   	push   %rbp
+  800241:	48 89 e5             	mov    %rsp,%rbp
+  800244:	53                   	push   %rbx
+  800245:	48 89 fa             	mov    %rdi,%rdx
+  800248:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80024b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800250:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800257:	00 00 00 
+  80025a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80025f:	be 00 00 00 00       	mov    $0x0,%esi
+  800264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80026a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80026c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800270:	c9                   	leave
+  800271:	c3                   	ret
+
+0000000000800272 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800272:	55                   	push   %rbp
+  800273:	48 89 e5             	mov    %rsp,%rbp
+  800276:	53                   	push   %rbx
+  800277:	49 89 f8             	mov    %rdi,%r8
+  80027a:	48 89 d3             	mov    %rdx,%rbx
+  80027d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800280:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800285:	4c 89 c2             	mov    %r8,%rdx
+  800288:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80028b:	be 00 00 00 00       	mov    $0x0,%esi
+  800290:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800296:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800298:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80029c:	c9                   	leave
+  80029d:	c3                   	ret
+
+000000000080029e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80029e:	55                   	push   %rbp
+  80029f:	48 89 e5             	mov    %rsp,%rbp
+  8002a2:	53                   	push   %rbx
+  8002a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a7:	89 f8                	mov    %edi,%eax
+  8002a9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002ac:	48 63 f9             	movslq %ecx,%rdi
+  8002af:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002b2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8002bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002c7:	48 85 c0             	test   %rax,%rax
+  8002ca:	7f 06                	jg     8002d2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d0:	c9                   	leave
+  8002d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d2:	49 89 c0             	mov    %rax,%r8
+  8002d5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002da:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8002e1:	00 00 00 
+  8002e4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002e9:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  8002f0:	00 00 00 
+  8002f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f8:	49 b9 3d 2f 80 00 00 	movabs $0x802f3d,%r9
+  8002ff:	00 00 00 
+  800302:	41 ff d1             	call   *%r9
+
+0000000000800305 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800305:	55                   	push   %rbp
+  800306:	48 89 e5             	mov    %rsp,%rbp
+  800309:	53                   	push   %rbx
+  80030a:	48 83 ec 08          	sub    $0x8,%rsp
+  80030e:	89 f8                	mov    %edi,%eax
+  800310:	49 89 f2             	mov    %rsi,%r10
+  800313:	48 89 cf             	mov    %rcx,%rdi
+  800316:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800319:	48 63 da             	movslq %edx,%rbx
+  80031c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80031f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800324:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800327:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80032a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80032c:	48 85 c0             	test   %rax,%rax
+  80032f:	7f 06                	jg     800337 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800331:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800335:	c9                   	leave
+  800336:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800337:	49 89 c0             	mov    %rax,%r8
+  80033a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80033f:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  800346:	00 00 00 
+  800349:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80034e:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  800355:	00 00 00 
+  800358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035d:	49 b9 3d 2f 80 00 00 	movabs $0x802f3d,%r9
+  800364:	00 00 00 
+  800367:	41 ff d1             	call   *%r9
+
+000000000080036a <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80036a:	55                   	push   %rbp
+  80036b:	48 89 e5             	mov    %rsp,%rbp
+  80036e:	53                   	push   %rbx
+  80036f:	48 83 ec 08          	sub    $0x8,%rsp
+  800373:	49 89 f9             	mov    %rdi,%r9
+  800376:	89 f0                	mov    %esi,%eax
+  800378:	48 89 d3             	mov    %rdx,%rbx
+  80037b:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80037e:	49 63 f0             	movslq %r8d,%rsi
+  800381:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800384:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800389:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80038c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800392:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800394:	48 85 c0             	test   %rax,%rax
+  800397:	7f 06                	jg     80039f <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800399:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80039d:	c9                   	leave
+  80039e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80039f:	49 89 c0             	mov    %rax,%r8
+  8003a2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003a7:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8003ae:	00 00 00 
+  8003b1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8003b6:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  8003bd:	00 00 00 
+  8003c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c5:	49 b9 3d 2f 80 00 00 	movabs $0x802f3d,%r9
+  8003cc:	00 00 00 
+  8003cf:	41 ff d1             	call   *%r9
+
+00000000008003d2 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003d2:	55                   	push   %rbp
+  8003d3:	48 89 e5             	mov    %rsp,%rbp
+  8003d6:	53                   	push   %rbx
+  8003d7:	89 f8                	mov    %edi,%eax
+  8003d9:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8003dc:	48 63 f9             	movslq %ecx,%rdi
+  8003df:	48 63 da             	movslq %edx,%rbx
+  8003e2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003e5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003ea:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003f8:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8003fa:	89 c2                	mov    %eax,%edx
+  8003fc:	48 85 c0             	test   %rax,%rax
+  8003ff:	78 0d                	js     80040e <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  800401:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  800406:	4d 85 c9             	test   %r9,%r9
+  800409:	74 03                	je     80040e <sys_alloc_dma_region+0x3c>
+  80040b:	49 89 01             	mov    %rax,(%r9)
+}
+  80040e:	89 d0                	mov    %edx,%eax
+  800410:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800414:	c9                   	leave
+  800415:	c3                   	ret
+
+0000000000800416 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  800416:	55                   	push   %rbp
+  800417:	48 89 e5             	mov    %rsp,%rbp
+  80041a:	53                   	push   %rbx
+  80041b:	48 83 ec 08          	sub    $0x8,%rsp
+  80041f:	48 89 f1             	mov    %rsi,%rcx
+  800422:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800425:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800428:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80042d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800432:	be 00 00 00 00       	mov    $0x0,%esi
+  800437:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80043d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80043f:	48 85 c0             	test   %rax,%rax
+  800442:	7f 06                	jg     80044a <sys_set_cache_region+0x34>
+}
+  800444:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800448:	c9                   	leave
+  800449:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80044a:	49 89 c0             	mov    %rax,%r8
+  80044d:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800452:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  800459:	00 00 00 
+  80045c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800461:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  800468:	00 00 00 
+  80046b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800470:	49 b9 3d 2f 80 00 00 	movabs $0x802f3d,%r9
+  800477:	00 00 00 
+  80047a:	41 ff d1             	call   *%r9
+
+000000000080047d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80047d:	55                   	push   %rbp
+  80047e:	48 89 e5             	mov    %rsp,%rbp
+  800481:	53                   	push   %rbx
+  800482:	48 83 ec 08          	sub    $0x8,%rsp
+  800486:	48 89 f1             	mov    %rsi,%rcx
+  800489:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80048c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80048f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800494:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800499:	be 00 00 00 00       	mov    $0x0,%esi
+  80049e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004a6:	48 85 c0             	test   %rax,%rax
+  8004a9:	7f 06                	jg     8004b1 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8004ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004af:	c9                   	leave
+  8004b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004b1:	49 89 c0             	mov    %rax,%r8
+  8004b4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004b9:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8004c0:	00 00 00 
+  8004c3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004c8:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  8004cf:	00 00 00 
+  8004d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d7:	49 b9 3d 2f 80 00 00 	movabs $0x802f3d,%r9
+  8004de:	00 00 00 
+  8004e1:	41 ff d1             	call   *%r9
+
+00000000008004e4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004e4:	55                   	push   %rbp
+  8004e5:	48 89 e5             	mov    %rsp,%rbp
+  8004e8:	53                   	push   %rbx
+  8004e9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004ed:	48 63 ce             	movslq %esi,%rcx
+  8004f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800502:	be 00 00 00 00       	mov    $0x0,%esi
+  800507:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80050d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80050f:	48 85 c0             	test   %rax,%rax
+  800512:	7f 06                	jg     80051a <sys_env_set_status+0x36>
+}
+  800514:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800518:	c9                   	leave
+  800519:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80051a:	49 89 c0             	mov    %rax,%r8
+  80051d:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800522:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  800529:	00 00 00 
+  80052c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800531:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  800538:	00 00 00 
+  80053b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800540:	49 b9 3d 2f 80 00 00 	movabs $0x802f3d,%r9
+  800547:	00 00 00 
+  80054a:	41 ff d1             	call   *%r9
+
+000000000080054d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80054d:	55                   	push   %rbp
+  80054e:	48 89 e5             	mov    %rsp,%rbp
+  800551:	53                   	push   %rbx
+  800552:	48 83 ec 08          	sub    $0x8,%rsp
+  800556:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800559:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80055c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800561:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800566:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80056b:	be 00 00 00 00       	mov    $0x0,%esi
+  800570:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800576:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800578:	48 85 c0             	test   %rax,%rax
+  80057b:	7f 06                	jg     800583 <sys_env_set_trapframe+0x36>
+}
+  80057d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800581:	c9                   	leave
+  800582:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800583:	49 89 c0             	mov    %rax,%r8
+  800586:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80058b:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  800592:	00 00 00 
+  800595:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80059a:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  8005a1:	00 00 00 
+  8005a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a9:	49 b9 3d 2f 80 00 00 	movabs $0x802f3d,%r9
+  8005b0:	00 00 00 
+  8005b3:	41 ff d1             	call   *%r9
+
+00000000008005b6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005b6:	55                   	push   %rbp
+  8005b7:	48 89 e5             	mov    %rsp,%rbp
+  8005ba:	53                   	push   %rbx
+  8005bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8005bf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005c2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005c5:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8005d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005e1:	48 85 c0             	test   %rax,%rax
+  8005e4:	7f 06                	jg     8005ec <sys_env_set_pgfault_upcall+0x36>
+}
+  8005e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ea:	c9                   	leave
+  8005eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005ec:	49 89 c0             	mov    %rax,%r8
+  8005ef:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005f4:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8005fb:	00 00 00 
+  8005fe:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800603:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  80060a:	00 00 00 
+  80060d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800612:	49 b9 3d 2f 80 00 00 	movabs $0x802f3d,%r9
+  800619:	00 00 00 
+  80061c:	41 ff d1             	call   *%r9
+
+000000000080061f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80061f:	55                   	push   %rbp
+  800620:	48 89 e5             	mov    %rsp,%rbp
+  800623:	53                   	push   %rbx
+  800624:	89 f8                	mov    %edi,%eax
+  800626:	49 89 f1             	mov    %rsi,%r9
+  800629:	48 89 d3             	mov    %rdx,%rbx
+  80062c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80062f:	49 63 f0             	movslq %r8d,%rsi
+  800632:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800635:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80063a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80063d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800643:	cd 30                	int    $0x30
+}
+  800645:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800649:	c9                   	leave
+  80064a:	c3                   	ret
+
+000000000080064b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80064b:	55                   	push   %rbp
+  80064c:	48 89 e5             	mov    %rsp,%rbp
+  80064f:	53                   	push   %rbx
+  800650:	48 83 ec 08          	sub    $0x8,%rsp
+  800654:	48 89 fa             	mov    %rdi,%rdx
+  800657:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80065a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80065f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800664:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800669:	be 00 00 00 00       	mov    $0x0,%esi
+  80066e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800674:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800676:	48 85 c0             	test   %rax,%rax
+  800679:	7f 06                	jg     800681 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80067b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80067f:	c9                   	leave
+  800680:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800681:	49 89 c0             	mov    %rax,%r8
+  800684:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800689:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  800690:	00 00 00 
+  800693:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800698:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  80069f:	00 00 00 
+  8006a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a7:	49 b9 3d 2f 80 00 00 	movabs $0x802f3d,%r9
+  8006ae:	00 00 00 
+  8006b1:	41 ff d1             	call   *%r9
+
+00000000008006b4 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8006b4:	55                   	push   %rbp
+  8006b5:	48 89 e5             	mov    %rsp,%rbp
+  8006b8:	53                   	push   %rbx
+  8006b9:	48 89 fa             	mov    %rdi,%rdx
+  8006bc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006bf:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8006d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006d9:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006df:	c9                   	leave
+  8006e0:	c3                   	ret
+
+00000000008006e1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006e1:	55                   	push   %rbp
+  8006e2:	48 89 e5             	mov    %rsp,%rbp
+  8006e5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006e6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800704:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80070a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80070c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800710:	c9                   	leave
+  800711:	c3                   	ret
+
+0000000000800712 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800712:	48 85 ff             	test   %rdi,%rdi
+  800715:	0f 84 b6 01 00 00    	je     8008d1 <malloc+0x1bf>
+malloc(size_t size) {
+  80071b:	55                   	push   %rbp
+  80071c:	48 89 e5             	mov    %rsp,%rbp
+  80071f:	41 56                	push   %r14
+  800721:	41 55                	push   %r13
+  800723:	41 54                	push   %r12
+  800725:	53                   	push   %rbx
+  800726:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800729:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800730:	00 00 00 
+  800733:	4c 8b 20             	mov    (%rax),%r12
+  800736:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80073d:	0f 87 94 01 00 00    	ja     8008d7 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  800743:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80074a:	00 00 00 
+  80074d:	48 85 c0             	test   %rax,%rax
+  800750:	74 6b                	je     8007bd <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  800752:	4d 85 e4             	test   %r12,%r12
+  800755:	74 66                	je     8007bd <malloc+0xab>
+  800757:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80075e:	00 00 00 
+  800761:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800766:	eb 0d                	jmp    800775 <malloc+0x63>
+  800768:	48 83 c1 01          	add    $0x1,%rcx
+  80076c:	48 83 c2 18          	add    $0x18,%rdx
+  800770:	49 39 cc             	cmp    %rcx,%r12
+  800773:	74 48                	je     8007bd <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  800775:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80077a:	74 ec                	je     800768 <malloc+0x56>
+  80077c:	48 39 1a             	cmp    %rbx,(%rdx)
+  80077f:	72 e7                	jb     800768 <malloc+0x56>
+                real_freep_size--;
+  800781:	48 83 e8 01          	sub    $0x1,%rax
+  800785:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80078c:	00 00 00 
+                freep[i].is_free = false;
+  80078f:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800796:	00 00 00 
+  800799:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80079d:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8007a1:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8007a5:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8007ac:	00 
+                freep[i].size = size;
+  8007ad:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8007b1:	48 01 c8             	add    %rcx,%rax
+  8007b4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007b8:	e9 0b 01 00 00       	jmp    8008c8 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8007bd:	48 a1 10 60 80 00 00 	movabs 0x806010,%rax
+  8007c4:	00 00 00 
+  8007c7:	48 01 d8             	add    %rbx,%rax
+  8007ca:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007d0:	76 7c                	jbe    80084e <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007d2:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  8007d9:	00 00 00 
+  8007dc:	4c 8b 30             	mov    (%rax),%r14
+  8007df:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8007e6:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8007e9:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8007f0:	00 00 00 
+  8007f3:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8007fa:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  800801:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  800807:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80080b:	48 b8 de 01 80 00 00 	movabs $0x8001de,%rax
+  800812:	00 00 00 
+  800815:	ff d0                	call   *%rax
+  800817:	89 c7                	mov    %eax,%edi
+  800819:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  800820:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  800827:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80082e:	00 00 00 
+  800831:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  800835:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80083a:	48 b8 9e 02 80 00 00 	movabs $0x80029e,%rax
+  800841:	00 00 00 
+  800844:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  800846:	85 c0                	test   %eax,%eax
+  800848:	0f 88 90 00 00 00    	js     8008de <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80084e:	48 b9 18 60 80 00 00 	movabs $0x806018,%rcx
+  800855:	00 00 00 
+  800858:	48 8b 31             	mov    (%rcx),%rsi
+  80085b:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800862:	00 00 00 
+  800865:	4c 8b 07             	mov    (%rdi),%r8
+  800868:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80086c:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  800873:	00 00 00 
+  800876:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80087a:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80087e:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800885:	00 00 00 
+  800888:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80088c:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80088f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  800893:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80089a:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  80089b:	48 89 d8             	mov    %rbx,%rax
+  80089e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8008a3:	4c 01 c0             	add    %r8,%rax
+  8008a6:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8008a9:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8008b0:	48 01 f3             	add    %rsi,%rbx
+  8008b3:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8008b6:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8008bb:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008c2:	00 00 00 
+  8008c5:	48 89 d0             	mov    %rdx,%rax
+}
+  8008c8:	5b                   	pop    %rbx
+  8008c9:	41 5c                	pop    %r12
+  8008cb:	41 5d                	pop    %r13
+  8008cd:	41 5e                	pop    %r14
+  8008cf:	5d                   	pop    %rbp
+  8008d0:	c3                   	ret
+        return NULL;
+  8008d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008d6:	c3                   	ret
+        return NULL;
+  8008d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dc:	eb ea                	jmp    8008c8 <malloc+0x1b6>
+            return NULL;
+  8008de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e3:	eb e3                	jmp    8008c8 <malloc+0x1b6>
+
+00000000008008e5 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8008e5:	55                   	push   %rbp
+  8008e6:	48 89 e5             	mov    %rsp,%rbp
+  8008e9:	53                   	push   %rbx
+  8008ea:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8008ee:	48 89 fb             	mov    %rdi,%rbx
+  8008f1:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8008f5:	48 89 df             	mov    %rbx,%rdi
+  8008f8:	48 b8 12 07 80 00 00 	movabs $0x800712,%rax
+  8008ff:	00 00 00 
+  800902:	ff d0                	call   *%rax
+  800904:	48 89 c7             	mov    %rax,%rdi
+  800907:	48 89 da             	mov    %rbx,%rdx
+  80090a:	be 00 00 00 00       	mov    $0x0,%esi
+  80090f:	48 b8 e5 3c 80 00 00 	movabs $0x803ce5,%rax
+  800916:	00 00 00 
+  800919:	ff d0                	call   *%rax
+}
+  80091b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80091f:	c9                   	leave
+  800920:	c3                   	ret
+
+0000000000800921 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  800921:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  800928:	00 00 00 
+  80092b:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  800932:	00 00 00 
+  800935:	48 3b 02             	cmp    (%rdx),%rax
+  800938:	74 4d                	je     800987 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  80093a:	48 85 c0             	test   %rax,%rax
+  80093d:	74 4d                	je     80098c <get_allocsize+0x6b>
+  80093f:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  800946:	00 00 00 
+  800949:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80094e:	48 3b 39             	cmp    (%rcx),%rdi
+  800951:	74 13                	je     800966 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  800953:	48 83 c2 01          	add    $0x1,%rdx
+  800957:	48 83 c1 18          	add    $0x18,%rcx
+  80095b:	48 39 d0             	cmp    %rdx,%rax
+  80095e:	75 ee                	jne    80094e <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  800960:	b8 00 00 00 00       	mov    $0x0,%eax
+  800965:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  800966:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80096a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096f:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800976:	00 00 00 
+  800979:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80097f:	75 0b                	jne    80098c <get_allocsize+0x6b>
+  800981:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  800986:	c3                   	ret
+        return 0;
+  800987:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80098c:	c3                   	ret
+
+000000000080098d <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80098d:	48 85 ff             	test   %rdi,%rdi
+  800990:	0f 84 01 01 00 00    	je     800a97 <free+0x10a>
+free(void *ptr) {
+  800996:	55                   	push   %rbp
+  800997:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  80099a:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8009a1:	00 00 00 
+  8009a4:	48 8b 30             	mov    (%rax),%rsi
+  8009a7:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8009ae:	00 00 00 
+  8009b1:	48 39 c6             	cmp    %rax,%rsi
+  8009b4:	74 50                	je     800a06 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8009b6:	48 85 f6             	test   %rsi,%rsi
+  8009b9:	74 21                	je     8009dc <free+0x4f>
+  8009bb:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009c2:	00 00 00 
+  8009c5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009ca:	48 3b 39             	cmp    (%rcx),%rdi
+  8009cd:	74 61                	je     800a30 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009cf:	48 83 c2 01          	add    $0x1,%rdx
+  8009d3:	48 83 c1 18          	add    $0x18,%rcx
+  8009d7:	48 39 d6             	cmp    %rdx,%rsi
+  8009da:	75 ee                	jne    8009ca <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8009dc:	48 ba 88 50 80 00 00 	movabs $0x805088,%rdx
+  8009e3:	00 00 00 
+  8009e6:	be 12 01 00 00       	mov    $0x112,%esi
+  8009eb:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  8009f2:	00 00 00 
+  8009f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fa:	48 b9 3d 2f 80 00 00 	movabs $0x802f3d,%rcx
+  800a01:	00 00 00 
+  800a04:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  800a06:	48 ba 38 50 80 00 00 	movabs $0x805038,%rdx
+  800a0d:	00 00 00 
+  800a10:	be 06 01 00 00       	mov    $0x106,%esi
+  800a15:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  800a1c:	00 00 00 
+  800a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a24:	48 b9 3d 2f 80 00 00 	movabs $0x802f3d,%rcx
+  800a2b:	00 00 00 
+  800a2e:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a30:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a34:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a3b:	00 00 00 
+  800a3e:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a44:	75 27                	jne    800a6d <free+0xe0>
+            freep[i].is_free = true;
+  800a46:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a4a:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a51:	00 00 00 
+  800a54:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a5b:	00 00 
+            real_freep_size++;
+  800a5d:	48 83 c0 01          	add    $0x1,%rax
+  800a61:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a68:	00 00 00 
+}
+  800a6b:	5d                   	pop    %rbp
+  800a6c:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a6d:	48 ba 60 50 80 00 00 	movabs $0x805060,%rdx
+  800a74:	00 00 00 
+  800a77:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800a7c:	48 bf b0 50 80 00 00 	movabs $0x8050b0,%rdi
+  800a83:	00 00 00 
+  800a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8b:	48 b9 3d 2f 80 00 00 	movabs $0x802f3d,%rcx
+  800a92:	00 00 00 
+  800a95:	ff d1                	call   *%rcx
+  800a97:	c3                   	ret
+
+0000000000800a98 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800a98:	55                   	push   %rbp
+  800a99:	48 89 e5             	mov    %rsp,%rbp
+  800a9c:	41 55                	push   %r13
+  800a9e:	41 54                	push   %r12
+  800aa0:	53                   	push   %rbx
+  800aa1:	48 83 ec 08          	sub    $0x8,%rsp
+  800aa5:	48 89 fb             	mov    %rdi,%rbx
+  800aa8:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800aab:	48 b8 21 09 80 00 00 	movabs $0x800921,%rax
+  800ab2:	00 00 00 
+  800ab5:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800ab7:	49 39 c5             	cmp    %rax,%r13
+  800aba:	73 0e                	jae    800aca <realloc+0x32>
+}
+  800abc:	48 89 d8             	mov    %rbx,%rax
+  800abf:	48 83 c4 08          	add    $0x8,%rsp
+  800ac3:	5b                   	pop    %rbx
+  800ac4:	41 5c                	pop    %r12
+  800ac6:	41 5d                	pop    %r13
+  800ac8:	5d                   	pop    %rbp
+  800ac9:	c3                   	ret
+  800aca:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800acd:	4c 89 ef             	mov    %r13,%rdi
+  800ad0:	48 b8 12 07 80 00 00 	movabs $0x800712,%rax
+  800ad7:	00 00 00 
+  800ada:	ff d0                	call   *%rax
+  800adc:	48 89 c7             	mov    %rax,%rdi
+  800adf:	4c 89 e2             	mov    %r12,%rdx
+  800ae2:	48 89 de             	mov    %rbx,%rsi
+  800ae5:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  800aec:	00 00 00 
+  800aef:	ff d0                	call   *%rax
+  800af1:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800af4:	48 89 df             	mov    %rbx,%rdi
+  800af7:	48 b8 8d 09 80 00 00 	movabs $0x80098d,%rax
+  800afe:	00 00 00 
+  800b01:	ff d0                	call   *%rax
+    return newptr;
+  800b03:	4c 89 e3             	mov    %r12,%rbx
+  800b06:	eb b4                	jmp    800abc <realloc+0x24>
+
+0000000000800b08 <strdup>:
+
+char*
+strdup (const char *src) {
+  800b08:	55                   	push   %rbp
+  800b09:	48 89 e5             	mov    %rsp,%rbp
+  800b0c:	41 54                	push   %r12
+  800b0e:	53                   	push   %rbx
+  800b0f:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800b12:	48 b8 c7 39 80 00 00 	movabs $0x8039c7,%rax
+  800b19:	00 00 00 
+  800b1c:	ff d0                	call   *%rax
+  800b1e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b22:	4c 89 e7             	mov    %r12,%rdi
+  800b25:	48 b8 12 07 80 00 00 	movabs $0x800712,%rax
+  800b2c:	00 00 00 
+  800b2f:	ff d0                	call   *%rax
+  800b31:	48 89 c7             	mov    %rax,%rdi
+  800b34:	4c 89 e2             	mov    %r12,%rdx
+  800b37:	48 89 de             	mov    %rbx,%rsi
+  800b3a:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  800b41:	00 00 00 
+  800b44:	ff d0                	call   *%rax
+}
+  800b46:	5b                   	pop    %rbx
+  800b47:	41 5c                	pop    %r12
+  800b49:	5d                   	pop    %rbp
+  800b4a:	c3                   	ret
+
+0000000000800b4b <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b4b:	55                   	push   %rbp
+  800b4c:	48 89 e5             	mov    %rsp,%rbp
+  800b4f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b50:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b64:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b69:	be 00 00 00 00       	mov    $0x0,%esi
+  800b6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b74:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b7a:	c9                   	leave
+  800b7b:	c3                   	ret
+
+0000000000800b7c <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800b7c:	55                   	push   %rbp
+  800b7d:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800b80:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800b87:	00 00 00 
+  800b8a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b8e:	74 26                	je     800bb6 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800b90:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b92:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b96:	89 c0                	mov    %eax,%eax
+  800b98:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800b9b:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800ba2:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800ba9:	00 00 00 
+  800bac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb1:	48 f7 31             	divq   (%rcx)
+}
+  800bb4:	5d                   	pop    %rbp
+  800bb5:	c3                   	ret
+        freq = get_cpufreq();
+  800bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbb:	48 ba 4b 0b 80 00 00 	movabs $0x800b4b,%rdx
+  800bc2:	00 00 00 
+  800bc5:	ff d2                	call   *%rdx
+  800bc7:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bce:	00 00 00 
+  800bd1:	eb bd                	jmp    800b90 <get_ticks+0x14>
+
+0000000000800bd3 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bd3:	55                   	push   %rbp
+  800bd4:	48 89 e5             	mov    %rsp,%rbp
+  800bd7:	53                   	push   %rbx
+  800bd8:	48 83 ec 08          	sub    $0x8,%rsp
+  800bdc:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800bdf:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800be6:	00 00 00 
+  800be9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800bed:	74 50                	je     800c3f <sleep+0x6c>
+    asm volatile("rdtsc"
+  800bef:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bf1:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bf5:	89 c0                	mov    %eax,%eax
+  800bf7:	48 89 d6             	mov    %rdx,%rsi
+  800bfa:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800bfd:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800c04:	00 00 00 
+  800c07:	48 0f af 18          	imul   (%rax),%rbx
+  800c0b:	48 c1 eb 03          	shr    $0x3,%rbx
+  800c0f:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800c16:	9b c4 20 
+  800c19:	48 89 d8             	mov    %rbx,%rax
+  800c1c:	48 f7 e2             	mul    %rdx
+  800c1f:	48 89 d1             	mov    %rdx,%rcx
+  800c22:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c26:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c28:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c2c:	89 c0                	mov    %eax,%eax
+  800c2e:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c31:	48 29 f2             	sub    %rsi,%rdx
+  800c34:	48 39 ca             	cmp    %rcx,%rdx
+  800c37:	72 ed                	jb     800c26 <sleep+0x53>
+}
+  800c39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c3d:	c9                   	leave
+  800c3e:	c3                   	ret
+        freq = get_cpufreq();
+  800c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c44:	48 ba 4b 0b 80 00 00 	movabs $0x800b4b,%rdx
+  800c4b:	00 00 00 
+  800c4e:	ff d2                	call   *%rdx
+  800c50:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c57:	00 00 00 
+  800c5a:	eb 93                	jmp    800bef <sleep+0x1c>
+
+0000000000800c5c <poll_kbd>:
+
+int poll_kbd() {
+  800c5c:	55                   	push   %rbp
+  800c5d:	48 89 e5             	mov    %rsp,%rbp
+  800c60:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c61:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c75:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c7a:	be 00 00 00 00       	mov    $0x0,%esi
+  800c7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c85:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c8b:	c9                   	leave
+  800c8c:	c3                   	ret
+
+0000000000800c8d <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800c8d:	55                   	push   %rbp
+  800c8e:	48 89 e5             	mov    %rsp,%rbp
+  800c91:	53                   	push   %rbx
+  800c92:	49 89 fa             	mov    %rdi,%r10
+  800c95:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800c97:	44 89 c6             	mov    %r8d,%esi
+  800c9a:	89 cf                	mov    %ecx,%edi
+  800c9c:	89 d3                	mov    %edx,%ebx
+  800c9e:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800ca0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ca5:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ca8:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800cac:	cd 30                	int    $0x30
+  800cae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cb2:	c9                   	leave
+  800cb3:	c3                   	ret
+
+0000000000800cb4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cb4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cbb:	ff ff ff 
+  800cbe:	48 01 f8             	add    %rdi,%rax
+  800cc1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800cc5:	c3                   	ret
+
+0000000000800cc6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cc6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800ccd:	ff ff ff 
+  800cd0:	48 01 f8             	add    %rdi,%rax
+  800cd3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800cd7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800cdd:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800ce1:	c3                   	ret
+
+0000000000800ce2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800ce2:	55                   	push   %rbp
+  800ce3:	48 89 e5             	mov    %rsp,%rbp
+  800ce6:	41 57                	push   %r15
+  800ce8:	41 56                	push   %r14
+  800cea:	41 55                	push   %r13
+  800cec:	41 54                	push   %r12
+  800cee:	53                   	push   %rbx
+  800cef:	48 83 ec 08          	sub    $0x8,%rsp
+  800cf3:	49 89 ff             	mov    %rdi,%r15
+  800cf6:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800cfb:	49 bd 96 2b 80 00 00 	movabs $0x802b96,%r13
+  800d02:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800d05:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800d0b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800d0e:	48 89 df             	mov    %rbx,%rdi
+  800d11:	41 ff d5             	call   *%r13
+  800d14:	83 e0 04             	and    $0x4,%eax
+  800d17:	74 17                	je     800d30 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800d19:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d20:	4c 39 f3             	cmp    %r14,%rbx
+  800d23:	75 e6                	jne    800d0b <fd_alloc+0x29>
+  800d25:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d2b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d30:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d33:	48 83 c4 08          	add    $0x8,%rsp
+  800d37:	5b                   	pop    %rbx
+  800d38:	41 5c                	pop    %r12
+  800d3a:	41 5d                	pop    %r13
+  800d3c:	41 5e                	pop    %r14
+  800d3e:	41 5f                	pop    %r15
+  800d40:	5d                   	pop    %rbp
+  800d41:	c3                   	ret
+
+0000000000800d42 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d42:	83 ff 1f             	cmp    $0x1f,%edi
+  800d45:	77 39                	ja     800d80 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d47:	55                   	push   %rbp
+  800d48:	48 89 e5             	mov    %rsp,%rbp
+  800d4b:	41 54                	push   %r12
+  800d4d:	53                   	push   %rbx
+  800d4e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d51:	48 63 df             	movslq %edi,%rbx
+  800d54:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d5b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d5f:	48 89 df             	mov    %rbx,%rdi
+  800d62:	48 b8 96 2b 80 00 00 	movabs $0x802b96,%rax
+  800d69:	00 00 00 
+  800d6c:	ff d0                	call   *%rax
+  800d6e:	a8 04                	test   $0x4,%al
+  800d70:	74 14                	je     800d86 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d72:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d7b:	5b                   	pop    %rbx
+  800d7c:	41 5c                	pop    %r12
+  800d7e:	5d                   	pop    %rbp
+  800d7f:	c3                   	ret
+        return -E_INVAL;
+  800d80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d85:	c3                   	ret
+        return -E_INVAL;
+  800d86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d8b:	eb ee                	jmp    800d7b <fd_lookup+0x39>
+
+0000000000800d8d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d8d:	55                   	push   %rbp
+  800d8e:	48 89 e5             	mov    %rsp,%rbp
+  800d91:	41 54                	push   %r12
+  800d93:	53                   	push   %rbx
+  800d94:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800d97:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800d9e:	00 00 00 
+  800da1:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800da8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800dab:	39 3b                	cmp    %edi,(%rbx)
+  800dad:	74 47                	je     800df6 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800daf:	48 83 c0 08          	add    $0x8,%rax
+  800db3:	48 8b 18             	mov    (%rax),%rbx
+  800db6:	48 85 db             	test   %rbx,%rbx
+  800db9:	75 f0                	jne    800dab <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800dbb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800dc2:	00 00 00 
+  800dc5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800dcb:	89 fa                	mov    %edi,%edx
+  800dcd:	48 bf c0 50 80 00 00 	movabs $0x8050c0,%rdi
+  800dd4:	00 00 00 
+  800dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ddc:	48 b9 8d 30 80 00 00 	movabs $0x80308d,%rcx
+  800de3:	00 00 00 
+  800de6:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800de8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800ded:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800df1:	5b                   	pop    %rbx
+  800df2:	41 5c                	pop    %r12
+  800df4:	5d                   	pop    %rbp
+  800df5:	c3                   	ret
+            return 0;
+  800df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfb:	eb f0                	jmp    800ded <dev_lookup+0x60>
+
+0000000000800dfd <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800dfd:	55                   	push   %rbp
+  800dfe:	48 89 e5             	mov    %rsp,%rbp
+  800e01:	41 55                	push   %r13
+  800e03:	41 54                	push   %r12
+  800e05:	53                   	push   %rbx
+  800e06:	48 83 ec 18          	sub    $0x18,%rsp
+  800e0a:	48 89 fb             	mov    %rdi,%rbx
+  800e0d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800e10:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800e17:	ff ff ff 
+  800e1a:	48 01 df             	add    %rbx,%rdi
+  800e1d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800e21:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e25:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  800e2c:	00 00 00 
+  800e2f:	ff d0                	call   *%rax
+  800e31:	41 89 c5             	mov    %eax,%r13d
+  800e34:	85 c0                	test   %eax,%eax
+  800e36:	78 06                	js     800e3e <fd_close+0x41>
+  800e38:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e3c:	74 1a                	je     800e58 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e3e:	45 84 e4             	test   %r12b,%r12b
+  800e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e46:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e4a:	44 89 e8             	mov    %r13d,%eax
+  800e4d:	48 83 c4 18          	add    $0x18,%rsp
+  800e51:	5b                   	pop    %rbx
+  800e52:	41 5c                	pop    %r12
+  800e54:	41 5d                	pop    %r13
+  800e56:	5d                   	pop    %rbp
+  800e57:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e58:	8b 3b                	mov    (%rbx),%edi
+  800e5a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e5e:	48 b8 8d 0d 80 00 00 	movabs $0x800d8d,%rax
+  800e65:	00 00 00 
+  800e68:	ff d0                	call   *%rax
+  800e6a:	41 89 c5             	mov    %eax,%r13d
+  800e6d:	85 c0                	test   %eax,%eax
+  800e6f:	78 1b                	js     800e8c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e75:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800e79:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e7f:	48 85 c0             	test   %rax,%rax
+  800e82:	74 08                	je     800e8c <fd_close+0x8f>
+  800e84:	48 89 df             	mov    %rbx,%rdi
+  800e87:	ff d0                	call   *%rax
+  800e89:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800e8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e91:	48 89 de             	mov    %rbx,%rsi
+  800e94:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e99:	48 b8 7d 04 80 00 00 	movabs $0x80047d,%rax
+  800ea0:	00 00 00 
+  800ea3:	ff d0                	call   *%rax
+    return res;
+  800ea5:	eb a3                	jmp    800e4a <fd_close+0x4d>
+
+0000000000800ea7 <close>:
+
+int
+close(int fdnum) {
+  800ea7:	55                   	push   %rbp
+  800ea8:	48 89 e5             	mov    %rsp,%rbp
+  800eab:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800eaf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800eb3:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  800eba:	00 00 00 
+  800ebd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800ebf:	85 c0                	test   %eax,%eax
+  800ec1:	78 15                	js     800ed8 <close+0x31>
+
+    return fd_close(fd, 1);
+  800ec3:	be 01 00 00 00       	mov    $0x1,%esi
+  800ec8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800ecc:	48 b8 fd 0d 80 00 00 	movabs $0x800dfd,%rax
+  800ed3:	00 00 00 
+  800ed6:	ff d0                	call   *%rax
+}
+  800ed8:	c9                   	leave
+  800ed9:	c3                   	ret
+
+0000000000800eda <close_all>:
+
+void
+close_all(void) {
+  800eda:	55                   	push   %rbp
+  800edb:	48 89 e5             	mov    %rsp,%rbp
+  800ede:	41 54                	push   %r12
+  800ee0:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800ee1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee6:	49 bc a7 0e 80 00 00 	movabs $0x800ea7,%r12
+  800eed:	00 00 00 
+  800ef0:	89 df                	mov    %ebx,%edi
+  800ef2:	41 ff d4             	call   *%r12
+  800ef5:	83 c3 01             	add    $0x1,%ebx
+  800ef8:	83 fb 20             	cmp    $0x20,%ebx
+  800efb:	75 f3                	jne    800ef0 <close_all+0x16>
+}
+  800efd:	5b                   	pop    %rbx
+  800efe:	41 5c                	pop    %r12
+  800f00:	5d                   	pop    %rbp
+  800f01:	c3                   	ret
+
+0000000000800f02 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800f02:	55                   	push   %rbp
+  800f03:	48 89 e5             	mov    %rsp,%rbp
+  800f06:	41 57                	push   %r15
+  800f08:	41 56                	push   %r14
+  800f0a:	41 55                	push   %r13
+  800f0c:	41 54                	push   %r12
+  800f0e:	53                   	push   %rbx
+  800f0f:	48 83 ec 18          	sub    $0x18,%rsp
+  800f13:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800f16:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800f1a:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  800f21:	00 00 00 
+  800f24:	ff d0                	call   *%rax
+  800f26:	89 c3                	mov    %eax,%ebx
+  800f28:	85 c0                	test   %eax,%eax
+  800f2a:	0f 88 b8 00 00 00    	js     800fe8 <dup+0xe6>
+    close(newfdnum);
+  800f30:	44 89 e7             	mov    %r12d,%edi
+  800f33:	48 b8 a7 0e 80 00 00 	movabs $0x800ea7,%rax
+  800f3a:	00 00 00 
+  800f3d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f3f:	4d 63 ec             	movslq %r12d,%r13
+  800f42:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f49:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f4d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f51:	4c 89 ff             	mov    %r15,%rdi
+  800f54:	49 be c6 0c 80 00 00 	movabs $0x800cc6,%r14
+  800f5b:	00 00 00 
+  800f5e:	41 ff d6             	call   *%r14
+  800f61:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f64:	4c 89 ef             	mov    %r13,%rdi
+  800f67:	41 ff d6             	call   *%r14
+  800f6a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f6d:	48 89 df             	mov    %rbx,%rdi
+  800f70:	48 b8 96 2b 80 00 00 	movabs $0x802b96,%rax
+  800f77:	00 00 00 
+  800f7a:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800f7c:	a8 04                	test   $0x4,%al
+  800f7e:	74 2b                	je     800fab <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800f80:	41 89 c1             	mov    %eax,%r9d
+  800f83:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f89:	4c 89 f1             	mov    %r14,%rcx
+  800f8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f91:	48 89 de             	mov    %rbx,%rsi
+  800f94:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f99:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  800fa0:	00 00 00 
+  800fa3:	ff d0                	call   *%rax
+  800fa5:	89 c3                	mov    %eax,%ebx
+  800fa7:	85 c0                	test   %eax,%eax
+  800fa9:	78 4e                	js     800ff9 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800fab:	4c 89 ff             	mov    %r15,%rdi
+  800fae:	48 b8 96 2b 80 00 00 	movabs $0x802b96,%rax
+  800fb5:	00 00 00 
+  800fb8:	ff d0                	call   *%rax
+  800fba:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800fbd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fc3:	4c 89 e9             	mov    %r13,%rcx
+  800fc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fcb:	4c 89 fe             	mov    %r15,%rsi
+  800fce:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fd3:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  800fda:	00 00 00 
+  800fdd:	ff d0                	call   *%rax
+  800fdf:	89 c3                	mov    %eax,%ebx
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	78 14                	js     800ff9 <dup+0xf7>
+
+    return newfdnum;
+  800fe5:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800fe8:	89 d8                	mov    %ebx,%eax
+  800fea:	48 83 c4 18          	add    $0x18,%rsp
+  800fee:	5b                   	pop    %rbx
+  800fef:	41 5c                	pop    %r12
+  800ff1:	41 5d                	pop    %r13
+  800ff3:	41 5e                	pop    %r14
+  800ff5:	41 5f                	pop    %r15
+  800ff7:	5d                   	pop    %rbp
+  800ff8:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800ff9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ffe:	4c 89 ee             	mov    %r13,%rsi
+  801001:	bf 00 00 00 00       	mov    $0x0,%edi
+  801006:	49 bc 7d 04 80 00 00 	movabs $0x80047d,%r12
+  80100d:	00 00 00 
+  801010:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801013:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801018:	4c 89 f6             	mov    %r14,%rsi
+  80101b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801020:	41 ff d4             	call   *%r12
+    return res;
+  801023:	eb c3                	jmp    800fe8 <dup+0xe6>
+
+0000000000801025 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801025:	55                   	push   %rbp
+  801026:	48 89 e5             	mov    %rsp,%rbp
+  801029:	41 56                	push   %r14
+  80102b:	41 55                	push   %r13
+  80102d:	41 54                	push   %r12
+  80102f:	53                   	push   %rbx
+  801030:	48 83 ec 10          	sub    $0x10,%rsp
+  801034:	89 fb                	mov    %edi,%ebx
+  801036:	49 89 f4             	mov    %rsi,%r12
+  801039:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80103c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801040:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  801047:	00 00 00 
+  80104a:	ff d0                	call   *%rax
+  80104c:	85 c0                	test   %eax,%eax
+  80104e:	78 4c                	js     80109c <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801050:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801054:	41 8b 3e             	mov    (%r14),%edi
+  801057:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80105b:	48 b8 8d 0d 80 00 00 	movabs $0x800d8d,%rax
+  801062:	00 00 00 
+  801065:	ff d0                	call   *%rax
+  801067:	85 c0                	test   %eax,%eax
+  801069:	78 35                	js     8010a0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80106b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80106f:	83 e0 03             	and    $0x3,%eax
+  801072:	83 f8 01             	cmp    $0x1,%eax
+  801075:	74 2d                	je     8010a4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801077:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80107b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80107f:	48 85 c0             	test   %rax,%rax
+  801082:	74 56                	je     8010da <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801084:	4c 89 ea             	mov    %r13,%rdx
+  801087:	4c 89 e6             	mov    %r12,%rsi
+  80108a:	4c 89 f7             	mov    %r14,%rdi
+  80108d:	ff d0                	call   *%rax
+}
+  80108f:	48 83 c4 10          	add    $0x10,%rsp
+  801093:	5b                   	pop    %rbx
+  801094:	41 5c                	pop    %r12
+  801096:	41 5d                	pop    %r13
+  801098:	41 5e                	pop    %r14
+  80109a:	5d                   	pop    %rbp
+  80109b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80109c:	48 98                	cltq
+  80109e:	eb ef                	jmp    80108f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010a0:	48 98                	cltq
+  8010a2:	eb eb                	jmp    80108f <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8010a4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8010ab:	00 00 00 
+  8010ae:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8010b4:	89 da                	mov    %ebx,%edx
+  8010b6:	48 bf 01 51 80 00 00 	movabs $0x805101,%rdi
+  8010bd:	00 00 00 
+  8010c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c5:	48 b9 8d 30 80 00 00 	movabs $0x80308d,%rcx
+  8010cc:	00 00 00 
+  8010cf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010d1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8010d8:	eb b5                	jmp    80108f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010da:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8010e1:	eb ac                	jmp    80108f <read+0x6a>
+
+00000000008010e3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8010e3:	55                   	push   %rbp
+  8010e4:	48 89 e5             	mov    %rsp,%rbp
+  8010e7:	41 57                	push   %r15
+  8010e9:	41 56                	push   %r14
+  8010eb:	41 55                	push   %r13
+  8010ed:	41 54                	push   %r12
+  8010ef:	53                   	push   %rbx
+  8010f0:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8010f4:	48 85 d2             	test   %rdx,%rdx
+  8010f7:	74 54                	je     80114d <readn+0x6a>
+  8010f9:	41 89 fd             	mov    %edi,%r13d
+  8010fc:	49 89 f6             	mov    %rsi,%r14
+  8010ff:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801102:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801107:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80110c:	49 bf 25 10 80 00 00 	movabs $0x801025,%r15
+  801113:	00 00 00 
+  801116:	4c 89 e2             	mov    %r12,%rdx
+  801119:	48 29 f2             	sub    %rsi,%rdx
+  80111c:	4c 01 f6             	add    %r14,%rsi
+  80111f:	44 89 ef             	mov    %r13d,%edi
+  801122:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801125:	85 c0                	test   %eax,%eax
+  801127:	78 20                	js     801149 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801129:	01 c3                	add    %eax,%ebx
+  80112b:	85 c0                	test   %eax,%eax
+  80112d:	74 08                	je     801137 <readn+0x54>
+  80112f:	48 63 f3             	movslq %ebx,%rsi
+  801132:	4c 39 e6             	cmp    %r12,%rsi
+  801135:	72 df                	jb     801116 <readn+0x33>
+    }
+    return res;
+  801137:	48 63 c3             	movslq %ebx,%rax
+}
+  80113a:	48 83 c4 08          	add    $0x8,%rsp
+  80113e:	5b                   	pop    %rbx
+  80113f:	41 5c                	pop    %r12
+  801141:	41 5d                	pop    %r13
+  801143:	41 5e                	pop    %r14
+  801145:	41 5f                	pop    %r15
+  801147:	5d                   	pop    %rbp
+  801148:	c3                   	ret
+        if (inc < 0) return inc;
+  801149:	48 98                	cltq
+  80114b:	eb ed                	jmp    80113a <readn+0x57>
+    int inc = 1, res = 0;
+  80114d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801152:	eb e3                	jmp    801137 <readn+0x54>
+
+0000000000801154 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801154:	55                   	push   %rbp
+  801155:	48 89 e5             	mov    %rsp,%rbp
+  801158:	41 56                	push   %r14
+  80115a:	41 55                	push   %r13
+  80115c:	41 54                	push   %r12
+  80115e:	53                   	push   %rbx
+  80115f:	48 83 ec 10          	sub    $0x10,%rsp
+  801163:	89 fb                	mov    %edi,%ebx
+  801165:	49 89 f4             	mov    %rsi,%r12
+  801168:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80116b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80116f:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  801176:	00 00 00 
+  801179:	ff d0                	call   *%rax
+  80117b:	85 c0                	test   %eax,%eax
+  80117d:	78 47                	js     8011c6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80117f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801183:	41 8b 3e             	mov    (%r14),%edi
+  801186:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80118a:	48 b8 8d 0d 80 00 00 	movabs $0x800d8d,%rax
+  801191:	00 00 00 
+  801194:	ff d0                	call   *%rax
+  801196:	85 c0                	test   %eax,%eax
+  801198:	78 30                	js     8011ca <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80119a:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80119f:	74 2d                	je     8011ce <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8011a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011a5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8011a9:	48 85 c0             	test   %rax,%rax
+  8011ac:	74 56                	je     801204 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8011ae:	4c 89 ea             	mov    %r13,%rdx
+  8011b1:	4c 89 e6             	mov    %r12,%rsi
+  8011b4:	4c 89 f7             	mov    %r14,%rdi
+  8011b7:	ff d0                	call   *%rax
+}
+  8011b9:	48 83 c4 10          	add    $0x10,%rsp
+  8011bd:	5b                   	pop    %rbx
+  8011be:	41 5c                	pop    %r12
+  8011c0:	41 5d                	pop    %r13
+  8011c2:	41 5e                	pop    %r14
+  8011c4:	5d                   	pop    %rbp
+  8011c5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011c6:	48 98                	cltq
+  8011c8:	eb ef                	jmp    8011b9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011ca:	48 98                	cltq
+  8011cc:	eb eb                	jmp    8011b9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011ce:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8011d5:	00 00 00 
+  8011d8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8011de:	89 da                	mov    %ebx,%edx
+  8011e0:	48 bf 1d 51 80 00 00 	movabs $0x80511d,%rdi
+  8011e7:	00 00 00 
+  8011ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ef:	48 b9 8d 30 80 00 00 	movabs $0x80308d,%rcx
+  8011f6:	00 00 00 
+  8011f9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8011fb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801202:	eb b5                	jmp    8011b9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801204:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80120b:	eb ac                	jmp    8011b9 <write+0x65>
+
+000000000080120d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80120d:	55                   	push   %rbp
+  80120e:	48 89 e5             	mov    %rsp,%rbp
+  801211:	53                   	push   %rbx
+  801212:	48 83 ec 18          	sub    $0x18,%rsp
+  801216:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801218:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80121c:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  801223:	00 00 00 
+  801226:	ff d0                	call   *%rax
+  801228:	85 c0                	test   %eax,%eax
+  80122a:	78 0c                	js     801238 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80122c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801230:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801233:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801238:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80123c:	c9                   	leave
+  80123d:	c3                   	ret
+
+000000000080123e <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80123e:	55                   	push   %rbp
+  80123f:	48 89 e5             	mov    %rsp,%rbp
+  801242:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801246:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80124a:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  801251:	00 00 00 
+  801254:	ff d0                	call   *%rax
+  801256:	85 c0                	test   %eax,%eax
+  801258:	78 07                	js     801261 <tell+0x23>
+    return fdes->fd_offset;
+  80125a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80125e:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  801261:	c9                   	leave
+  801262:	c3                   	ret
+
+0000000000801263 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801263:	55                   	push   %rbp
+  801264:	48 89 e5             	mov    %rsp,%rbp
+  801267:	41 55                	push   %r13
+  801269:	41 54                	push   %r12
+  80126b:	53                   	push   %rbx
+  80126c:	48 83 ec 18          	sub    $0x18,%rsp
+  801270:	89 fb                	mov    %edi,%ebx
+  801272:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801275:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801279:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  801280:	00 00 00 
+  801283:	ff d0                	call   *%rax
+  801285:	85 c0                	test   %eax,%eax
+  801287:	78 38                	js     8012c1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801289:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80128d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801291:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801295:	48 b8 8d 0d 80 00 00 	movabs $0x800d8d,%rax
+  80129c:	00 00 00 
+  80129f:	ff d0                	call   *%rax
+  8012a1:	85 c0                	test   %eax,%eax
+  8012a3:	78 1c                	js     8012c1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012a5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8012aa:	74 20                	je     8012cc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8012b0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8012b4:	48 85 c0             	test   %rax,%rax
+  8012b7:	74 47                	je     801300 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8012b9:	44 89 e6             	mov    %r12d,%esi
+  8012bc:	4c 89 ef             	mov    %r13,%rdi
+  8012bf:	ff d0                	call   *%rax
+}
+  8012c1:	48 83 c4 18          	add    $0x18,%rsp
+  8012c5:	5b                   	pop    %rbx
+  8012c6:	41 5c                	pop    %r12
+  8012c8:	41 5d                	pop    %r13
+  8012ca:	5d                   	pop    %rbp
+  8012cb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8012cc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8012d3:	00 00 00 
+  8012d6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012dc:	89 da                	mov    %ebx,%edx
+  8012de:	48 bf e0 50 80 00 00 	movabs $0x8050e0,%rdi
+  8012e5:	00 00 00 
+  8012e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ed:	48 b9 8d 30 80 00 00 	movabs $0x80308d,%rcx
+  8012f4:	00 00 00 
+  8012f7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8012f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012fe:	eb c1                	jmp    8012c1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801300:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801305:	eb ba                	jmp    8012c1 <ftruncate+0x5e>
+
+0000000000801307 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801307:	55                   	push   %rbp
+  801308:	48 89 e5             	mov    %rsp,%rbp
+  80130b:	41 54                	push   %r12
+  80130d:	53                   	push   %rbx
+  80130e:	48 83 ec 10          	sub    $0x10,%rsp
+  801312:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801315:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801319:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  801320:	00 00 00 
+  801323:	ff d0                	call   *%rax
+  801325:	85 c0                	test   %eax,%eax
+  801327:	78 4e                	js     801377 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801329:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80132d:	41 8b 3c 24          	mov    (%r12),%edi
+  801331:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801335:	48 b8 8d 0d 80 00 00 	movabs $0x800d8d,%rax
+  80133c:	00 00 00 
+  80133f:	ff d0                	call   *%rax
+  801341:	85 c0                	test   %eax,%eax
+  801343:	78 32                	js     801377 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801345:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801349:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80134e:	74 30                	je     801380 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801350:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801353:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80135a:	00 00 00 
+    stat->st_isdir = 0;
+  80135d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801364:	00 00 00 
+    stat->st_dev = dev;
+  801367:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80136e:	48 89 de             	mov    %rbx,%rsi
+  801371:	4c 89 e7             	mov    %r12,%rdi
+  801374:	ff 50 28             	call   *0x28(%rax)
+}
+  801377:	48 83 c4 10          	add    $0x10,%rsp
+  80137b:	5b                   	pop    %rbx
+  80137c:	41 5c                	pop    %r12
+  80137e:	5d                   	pop    %rbp
+  80137f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801380:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801385:	eb f0                	jmp    801377 <fstat+0x70>
+
+0000000000801387 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  801387:	55                   	push   %rbp
+  801388:	48 89 e5             	mov    %rsp,%rbp
+  80138b:	41 54                	push   %r12
+  80138d:	53                   	push   %rbx
+  80138e:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  801395:	41 89 fc             	mov    %edi,%r12d
+  801398:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80139a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80139e:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  8013a5:	00 00 00 
+  8013a8:	ff d0                	call   *%rax
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	78 31                	js     8013df <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8013ae:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8013b5:	44 89 e7             	mov    %r12d,%edi
+  8013b8:	48 b8 07 13 80 00 00 	movabs $0x801307,%rax
+  8013bf:	00 00 00 
+  8013c2:	ff d0                	call   *%rax
+  8013c4:	85 c0                	test   %eax,%eax
+  8013c6:	78 17                	js     8013df <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8013c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013cc:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8013cf:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8013d2:	39 d3                	cmp    %edx,%ebx
+  8013d4:	0f 4f da             	cmovg  %edx,%ebx
+  8013d7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8013da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013df:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8013e6:	5b                   	pop    %rbx
+  8013e7:	41 5c                	pop    %r12
+  8013e9:	5d                   	pop    %rbp
+  8013ea:	c3                   	ret
+
+00000000008013eb <seektoend>:
+{
+  8013eb:	55                   	push   %rbp
+  8013ec:	48 89 e5             	mov    %rsp,%rbp
+  8013ef:	53                   	push   %rbx
+  8013f0:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8013f7:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8013f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013fd:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  801404:	00 00 00 
+  801407:	ff d0                	call   *%rax
+  801409:	85 c0                	test   %eax,%eax
+  80140b:	78 28                	js     801435 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80140d:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801414:	89 df                	mov    %ebx,%edi
+  801416:	48 b8 07 13 80 00 00 	movabs $0x801307,%rax
+  80141d:	00 00 00 
+  801420:	ff d0                	call   *%rax
+  801422:	85 c0                	test   %eax,%eax
+  801424:	78 0f                	js     801435 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  801426:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801429:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80142d:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  801430:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801435:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801439:	c9                   	leave
+  80143a:	c3                   	ret
+
+000000000080143b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80143b:	55                   	push   %rbp
+  80143c:	48 89 e5             	mov    %rsp,%rbp
+  80143f:	41 54                	push   %r12
+  801441:	53                   	push   %rbx
+  801442:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801445:	be 00 00 00 00       	mov    $0x0,%esi
+  80144a:	48 b8 2e 20 80 00 00 	movabs $0x80202e,%rax
+  801451:	00 00 00 
+  801454:	ff d0                	call   *%rax
+  801456:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801458:	85 c0                	test   %eax,%eax
+  80145a:	78 25                	js     801481 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80145c:	4c 89 e6             	mov    %r12,%rsi
+  80145f:	89 c7                	mov    %eax,%edi
+  801461:	48 b8 07 13 80 00 00 	movabs $0x801307,%rax
+  801468:	00 00 00 
+  80146b:	ff d0                	call   *%rax
+  80146d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801470:	89 df                	mov    %ebx,%edi
+  801472:	48 b8 a7 0e 80 00 00 	movabs $0x800ea7,%rax
+  801479:	00 00 00 
+  80147c:	ff d0                	call   *%rax
+
+    return res;
+  80147e:	44 89 e3             	mov    %r12d,%ebx
+}
+  801481:	89 d8                	mov    %ebx,%eax
+  801483:	5b                   	pop    %rbx
+  801484:	41 5c                	pop    %r12
+  801486:	5d                   	pop    %rbp
+  801487:	c3                   	ret
+
+0000000000801488 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  801488:	55                   	push   %rbp
+  801489:	48 89 e5             	mov    %rsp,%rbp
+  80148c:	53                   	push   %rbx
+  80148d:	48 83 ec 08          	sub    $0x8,%rsp
+  801491:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801494:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  80149b:	00 00 00 
+  80149e:	ff d0                	call   *%rax
+  8014a0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8014a4:	0f 87 ea 00 00 00    	ja     801594 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8014aa:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014b1:	00 00 00 
+  8014b4:	80 38 00             	cmpb   $0x0,(%rax)
+  8014b7:	75 35                	jne    8014ee <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8014b9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014be:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8014c3:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8014c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014cd:	48 b8 9e 02 80 00 00 	movabs $0x80029e,%rax
+  8014d4:	00 00 00 
+  8014d7:	ff d0                	call   *%rax
+  8014d9:	85 c0                	test   %eax,%eax
+  8014db:	0f 88 ba 00 00 00    	js     80159b <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8014e1:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014e8:	00 00 00 
+  8014eb:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8014ee:	48 89 df             	mov    %rbx,%rdi
+  8014f1:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  8014f8:	00 00 00 
+  8014fb:	ff d0                	call   *%rax
+  8014fd:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  801501:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  801508:	00 00 00 
+  80150b:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80150f:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  801512:	39 39                	cmp    %edi,(%rcx)
+  801514:	74 46                	je     80155c <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  801516:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80151a:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  801521:	00 
+  801522:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  801529:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  801530:	00 
+  801531:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  801538:	00 
+  801539:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  801540:	00 
+  801541:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  801548:	00 
+  801549:	89 39                	mov    %edi,(%rcx)
+  80154b:	48 01 c6             	add    %rax,%rsi
+  80154e:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  801553:	48 89 c8             	mov    %rcx,%rax
+  801556:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155a:	c9                   	leave
+  80155b:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80155c:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  801560:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  801567:	00 00 00 
+  80156a:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80156d:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  801571:	74 e0                	je     801553 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  801573:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80157a:	00 
+  80157b:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80157f:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  801586:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  801588:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80158b:	48 01 c2             	add    %rax,%rdx
+  80158e:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  801592:	eb bf                	jmp    801553 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801594:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801599:	eb b8                	jmp    801553 <fbuf_get+0xcb>
+            return NULL;
+  80159b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a0:	eb b1                	jmp    801553 <fbuf_get+0xcb>
+
+00000000008015a2 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8015a2:	55                   	push   %rbp
+  8015a3:	48 89 e5             	mov    %rsp,%rbp
+  8015a6:	53                   	push   %rbx
+  8015a7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8015ab:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015b2:	00 00 00 
+  8015b5:	48 8b 18             	mov    (%rax),%rbx
+  8015b8:	48 85 db             	test   %rbx,%rbx
+  8015bb:	74 16                	je     8015d3 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8015bd:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015c4:	00 00 00 
+  8015c7:	48 8b 18             	mov    (%rax),%rbx
+}
+  8015ca:	48 89 d8             	mov    %rbx,%rax
+  8015cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d1:	c9                   	leave
+  8015d2:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8015d3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015d8:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8015dd:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8015e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e7:	48 b8 9e 02 80 00 00 	movabs $0x80029e,%rax
+  8015ee:	00 00 00 
+  8015f1:	ff d0                	call   *%rax
+  8015f3:	85 c0                	test   %eax,%eax
+  8015f5:	78 d3                	js     8015ca <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8015f7:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8015fc:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  801603:	00 00 00 
+  801606:	eb b5                	jmp    8015bd <fsipc_bulk+0x1b>
+
+0000000000801608 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  801608:	55                   	push   %rbp
+  801609:	48 89 e5             	mov    %rsp,%rbp
+  80160c:	41 57                	push   %r15
+  80160e:	41 56                	push   %r14
+  801610:	41 55                	push   %r13
+  801612:	41 54                	push   %r12
+  801614:	53                   	push   %rbx
+  801615:	48 83 ec 08          	sub    $0x8,%rsp
+  801619:	41 89 fd             	mov    %edi,%r13d
+  80161c:	49 89 f6             	mov    %rsi,%r14
+  80161f:	49 89 d7             	mov    %rdx,%r15
+  801622:	48 89 cb             	mov    %rcx,%rbx
+  801625:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801628:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80162f:	00 00 00 
+  801632:	83 38 00             	cmpl   $0x0,(%rax)
+  801635:	74 52                	je     801689 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  801637:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80163d:	4c 89 f9             	mov    %r15,%rcx
+  801640:	4c 89 f2             	mov    %r14,%rdx
+  801643:	44 89 ee             	mov    %r13d,%esi
+  801646:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80164d:	00 00 00 
+  801650:	8b 38                	mov    (%rax),%edi
+  801652:	48 b8 8c 41 80 00 00 	movabs $0x80418c,%rax
+  801659:	00 00 00 
+  80165c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80165e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801663:	4c 89 e2             	mov    %r12,%rdx
+  801666:	48 89 de             	mov    %rbx,%rsi
+  801669:	bf 00 00 00 00       	mov    $0x0,%edi
+  80166e:	48 b8 dc 3f 80 00 00 	movabs $0x803fdc,%rax
+  801675:	00 00 00 
+  801678:	ff d0                	call   *%rax
+}
+  80167a:	48 83 c4 08          	add    $0x8,%rsp
+  80167e:	5b                   	pop    %rbx
+  80167f:	41 5c                	pop    %r12
+  801681:	41 5d                	pop    %r13
+  801683:	41 5e                	pop    %r14
+  801685:	41 5f                	pop    %r15
+  801687:	5d                   	pop    %rbp
+  801688:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801689:	bf 03 00 00 00       	mov    $0x3,%edi
+  80168e:	48 b8 2f 42 80 00 00 	movabs $0x80422f,%rax
+  801695:	00 00 00 
+  801698:	ff d0                	call   *%rax
+  80169a:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8016a1:	00 00 
+  8016a3:	eb 92                	jmp    801637 <fsipc_region+0x2f>
+
+00000000008016a5 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8016a5:	55                   	push   %rbp
+  8016a6:	48 89 e5             	mov    %rsp,%rbp
+  8016a9:	41 57                	push   %r15
+  8016ab:	41 56                	push   %r14
+  8016ad:	41 55                	push   %r13
+  8016af:	41 54                	push   %r12
+  8016b1:	53                   	push   %rbx
+  8016b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8016b6:	49 89 ff             	mov    %rdi,%r15
+  8016b9:	49 89 f6             	mov    %rsi,%r14
+  8016bc:	48 89 d3             	mov    %rdx,%rbx
+  8016bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016c3:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8016c6:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  8016cd:	00 00 00 
+  8016d0:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8016d2:	48 85 c0             	test   %rax,%rax
+  8016d5:	0f 84 cc 00 00 00    	je     8017a7 <devfile_write_direct+0x102>
+  8016db:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8016de:	48 85 db             	test   %rbx,%rbx
+  8016e1:	0f 84 ba 00 00 00    	je     8017a1 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8016e7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016ed:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8016f4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8016f8:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8016fc:	4c 29 e3             	sub    %r12,%rbx
+  8016ff:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801704:	48 39 c3             	cmp    %rax,%rbx
+  801707:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80170b:	48 89 da             	mov    %rbx,%rdx
+  80170e:	4c 89 f6             	mov    %r14,%rsi
+  801711:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801715:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  80171c:	00 00 00 
+  80171f:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  801721:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801725:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  801729:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80172c:	44 01 e0             	add    %r12d,%eax
+  80172f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  801733:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  801737:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80173e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801745:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80174c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801752:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801757:	4c 89 ee             	mov    %r13,%rsi
+  80175a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80175f:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  801766:	00 00 00 
+  801769:	ff d0                	call   *%rax
+        if (res < 0)
+  80176b:	85 c0                	test   %eax,%eax
+  80176d:	78 29                	js     801798 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80176f:	74 2b                	je     80179c <devfile_write_direct+0xf7>
+        i += res;
+  801771:	48 98                	cltq
+  801773:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  801776:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  801779:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80177d:	49 39 c4             	cmp    %rax,%r12
+  801780:	0f 82 72 ff ff ff    	jb     8016f8 <devfile_write_direct+0x53>
+    return i;
+  801786:	4c 89 e0             	mov    %r12,%rax
+}
+  801789:	48 83 c4 28          	add    $0x28,%rsp
+  80178d:	5b                   	pop    %rbx
+  80178e:	41 5c                	pop    %r12
+  801790:	41 5d                	pop    %r13
+  801792:	41 5e                	pop    %r14
+  801794:	41 5f                	pop    %r15
+  801796:	5d                   	pop    %rbp
+  801797:	c3                   	ret
+            return res;
+  801798:	48 98                	cltq
+  80179a:	eb ed                	jmp    801789 <devfile_write_direct+0xe4>
+            return i;
+  80179c:	4c 89 e0             	mov    %r12,%rax
+  80179f:	eb e8                	jmp    801789 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8017a1:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8017a5:	eb df                	jmp    801786 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8017a7:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8017ae:	eb d9                	jmp    801789 <devfile_write_direct+0xe4>
+
+00000000008017b0 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8017b0:	55                   	push   %rbp
+  8017b1:	48 89 e5             	mov    %rsp,%rbp
+  8017b4:	41 56                	push   %r14
+  8017b6:	41 55                	push   %r13
+  8017b8:	41 54                	push   %r12
+  8017ba:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8017bb:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8017bf:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8017c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c8:	4d 39 ee             	cmp    %r13,%r14
+  8017cb:	0f 84 99 00 00 00    	je     80186a <fbuf_flush+0xba>
+  8017d1:	49 89 fc             	mov    %rdi,%r12
+  8017d4:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8017d7:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017da:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8017de:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  8017e5:	00 00 00 
+  8017e8:	ff d0                	call   *%rax
+  8017ea:	48 89 c2             	mov    %rax,%rdx
+  8017ed:	48 c1 e2 04          	shl    $0x4,%rdx
+  8017f1:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8017f5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8017f9:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8017fe:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  801801:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801805:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80180c:	00 
+  80180d:	44 89 f1             	mov    %r14d,%ecx
+  801810:	4c 89 ea             	mov    %r13,%rdx
+  801813:	4c 89 e7             	mov    %r12,%rdi
+  801816:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  80181d:	00 00 00 
+  801820:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801822:	48 85 c0             	test   %rax,%rax
+  801825:	78 43                	js     80186a <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  801827:	4c 39 e8             	cmp    %r13,%rax
+  80182a:	72 47                	jb     801873 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80182c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  801831:	83 c0 01             	add    $0x1,%eax
+  801834:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801839:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80183c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801840:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  801844:	72 0f                	jb     801855 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  801846:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80184a:	48 39 c2             	cmp    %rax,%rdx
+  80184d:	48 0f 42 d0          	cmovb  %rax,%rdx
+  801851:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  801855:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80185c:	00 
+  80185d:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  801864:	00 
+    return 0;
+  801865:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80186a:	5b                   	pop    %rbx
+  80186b:	41 5c                	pop    %r12
+  80186d:	41 5d                	pop    %r13
+  80186f:	41 5e                	pop    %r14
+  801871:	5d                   	pop    %rbp
+  801872:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  801873:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801878:	eb f0                	jmp    80186a <fbuf_flush+0xba>
+
+000000000080187a <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80187a:	55                   	push   %rbp
+  80187b:	48 89 e5             	mov    %rsp,%rbp
+  80187e:	53                   	push   %rbx
+  80187f:	48 83 ec 08          	sub    $0x8,%rsp
+  801883:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  801886:	48 b8 88 14 80 00 00 	movabs $0x801488,%rax
+  80188d:	00 00 00 
+  801890:	ff d0                	call   *%rax
+  801892:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  801895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189a:	48 85 f6             	test   %rsi,%rsi
+  80189d:	74 0f                	je     8018ae <devfile_sync+0x34>
+  80189f:	48 89 df             	mov    %rbx,%rdi
+  8018a2:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  8018a9:	00 00 00 
+  8018ac:	ff d0                	call   *%rax
+}
+  8018ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b2:	c9                   	leave
+  8018b3:	c3                   	ret
+
+00000000008018b4 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8018b4:	55                   	push   %rbp
+  8018b5:	48 89 e5             	mov    %rsp,%rbp
+  8018b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8018bc:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8018bf:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8018c6:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8018c7:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8018cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018d0:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8018d7:	00 00 00 
+  8018da:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  8018e1:	00 00 00 
+  8018e4:	ff d0                	call   *%rax
+}
+  8018e6:	c9                   	leave
+  8018e7:	c3                   	ret
+
+00000000008018e8 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018e8:	55                   	push   %rbp
+  8018e9:	48 89 e5             	mov    %rsp,%rbp
+  8018ec:	41 54                	push   %r12
+  8018ee:	53                   	push   %rbx
+  8018ef:	48 89 fb             	mov    %rdi,%rbx
+  8018f2:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8018f5:	48 b8 7a 18 80 00 00 	movabs $0x80187a,%rax
+  8018fc:	00 00 00 
+  8018ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801901:	85 c0                	test   %eax,%eax
+  801903:	78 63                	js     801968 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801905:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801908:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80190f:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  801911:	be 00 00 00 00       	mov    $0x0,%esi
+  801916:	bf 05 00 00 00       	mov    $0x5,%edi
+  80191b:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  801922:	00 00 00 
+  801925:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801927:	85 c0                	test   %eax,%eax
+  801929:	78 3d                	js     801968 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80192b:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  801932:	00 00 00 
+  801935:	48 89 de             	mov    %rbx,%rsi
+  801938:	4c 89 e7             	mov    %r12,%rdi
+  80193b:	48 b8 05 3a 80 00 00 	movabs $0x803a05,%rax
+  801942:	00 00 00 
+  801945:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801947:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80194d:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  801954:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801955:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80195b:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  801962:	00 
+
+    return 0;
+  801963:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801968:	5b                   	pop    %rbx
+  801969:	41 5c                	pop    %r12
+  80196b:	5d                   	pop    %rbp
+  80196c:	c3                   	ret
+
+000000000080196d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80196d:	55                   	push   %rbp
+  80196e:	48 89 e5             	mov    %rsp,%rbp
+  801971:	41 54                	push   %r12
+  801973:	53                   	push   %rbx
+  801974:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  801977:	48 b8 7a 18 80 00 00 	movabs $0x80187a,%rax
+  80197e:	00 00 00 
+  801981:	ff d0                	call   *%rax
+  801983:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  801986:	48 89 df             	mov    %rbx,%rdi
+  801989:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  801990:	00 00 00 
+  801993:	ff d0                	call   *%rax
+  801995:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801999:	76 2e                	jbe    8019c9 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  80199b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80199e:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8019a5:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8019a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019b1:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  8019b8:	00 00 00 
+  8019bb:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019bd:	45 85 e4             	test   %r12d,%r12d
+  8019c0:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019c4:	5b                   	pop    %rbx
+  8019c5:	41 5c                	pop    %r12
+  8019c7:	5d                   	pop    %rbp
+  8019c8:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8019c9:	48 89 df             	mov    %rbx,%rdi
+  8019cc:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  8019d3:	00 00 00 
+  8019d6:	ff d0                	call   *%rax
+  8019d8:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8019dc:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8019e3:	00 00 00 
+  8019e6:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8019ed:	48 89 df             	mov    %rbx,%rdi
+  8019f0:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  8019f7:	00 00 00 
+  8019fa:	ff d0                	call   *%rax
+  8019fc:	48 89 c6             	mov    %rax,%rsi
+  8019ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a04:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a09:	48 b8 7d 04 80 00 00 	movabs $0x80047d,%rax
+  801a10:	00 00 00 
+  801a13:	ff d0                	call   *%rax
+  801a15:	eb 84                	jmp    80199b <devfile_flush+0x2e>
+
+0000000000801a17 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801a17:	55                   	push   %rbp
+  801a18:	48 89 e5             	mov    %rsp,%rbp
+  801a1b:	41 55                	push   %r13
+  801a1d:	41 54                	push   %r12
+  801a1f:	53                   	push   %rbx
+  801a20:	48 83 ec 08          	sub    $0x8,%rsp
+  801a24:	48 89 fb             	mov    %rdi,%rbx
+  801a27:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a2a:	48 b8 88 14 80 00 00 	movabs $0x801488,%rax
+  801a31:	00 00 00 
+  801a34:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a36:	48 85 c0             	test   %rax,%rax
+  801a39:	74 51                	je     801a8c <devfile_trunc+0x75>
+  801a3b:	49 89 c4             	mov    %rax,%r12
+  801a3e:	48 89 c6             	mov    %rax,%rsi
+  801a41:	48 89 df             	mov    %rbx,%rdi
+  801a44:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801a4b:	00 00 00 
+  801a4e:	ff d0                	call   *%rax
+  801a50:	85 c0                	test   %eax,%eax
+  801a52:	78 2d                	js     801a81 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a54:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a5b:	00 00 00 
+  801a5e:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a61:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a63:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a67:	be 00 00 00 00       	mov    $0x0,%esi
+  801a6c:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a71:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  801a78:	00 00 00 
+  801a7b:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	79 3e                	jns    801abf <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801a81:	48 83 c4 08          	add    $0x8,%rsp
+  801a85:	5b                   	pop    %rbx
+  801a86:	41 5c                	pop    %r12
+  801a88:	41 5d                	pop    %r13
+  801a8a:	5d                   	pop    %rbp
+  801a8b:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a8c:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a93:	00 00 00 
+  801a96:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a99:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a9b:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a9f:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa4:	bf 02 00 00 00       	mov    $0x2,%edi
+  801aa9:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	78 c8                	js     801a81 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801ab9:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801abd:	eb c2                	jmp    801a81 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801abf:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801ac2:	8d 51 01             	lea    0x1(%rcx),%edx
+  801ac5:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801ac8:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801acd:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801ad4:	00 00 
+  801ad6:	eb a9                	jmp    801a81 <devfile_trunc+0x6a>
+
+0000000000801ad8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801ad8:	55                   	push   %rbp
+  801ad9:	48 89 e5             	mov    %rsp,%rbp
+  801adc:	41 57                	push   %r15
+  801ade:	41 56                	push   %r14
+  801ae0:	41 55                	push   %r13
+  801ae2:	41 54                	push   %r12
+  801ae4:	53                   	push   %rbx
+  801ae5:	48 83 ec 28          	sub    $0x28,%rsp
+  801ae9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801aed:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801af1:	49 89 d7             	mov    %rdx,%r15
+  801af4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801af8:	48 b8 88 14 80 00 00 	movabs $0x801488,%rax
+  801aff:	00 00 00 
+  801b02:	ff d0                	call   *%rax
+  801b04:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801b07:	48 85 c0             	test   %rax,%rax
+  801b0a:	74 31                	je     801b3d <devfile_write+0x65>
+  801b0c:	4c 89 f8             	mov    %r15,%rax
+  801b0f:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801b16:	77 25                	ja     801b3d <devfile_write+0x65>
+    size_t i = 0;
+  801b18:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801b1e:	48 85 c0             	test   %rax,%rax
+  801b21:	0f 85 64 01 00 00    	jne    801c8b <devfile_write+0x1b3>
+    size_t i = 0;
+  801b27:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b2b:	4c 89 f8             	mov    %r15,%rax
+}
+  801b2e:	48 83 c4 28          	add    $0x28,%rsp
+  801b32:	5b                   	pop    %rbx
+  801b33:	41 5c                	pop    %r12
+  801b35:	41 5d                	pop    %r13
+  801b37:	41 5e                	pop    %r14
+  801b39:	41 5f                	pop    %r15
+  801b3b:	5d                   	pop    %rbp
+  801b3c:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b3d:	48 85 db             	test   %rbx,%rbx
+  801b40:	74 5b                	je     801b9d <devfile_write+0xc5>
+  801b42:	48 89 de             	mov    %rbx,%rsi
+  801b45:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b49:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801b50:	00 00 00 
+  801b53:	ff d0                	call   *%rax
+  801b55:	85 c0                	test   %eax,%eax
+  801b57:	78 40                	js     801b99 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b59:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b5d:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801b60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b64:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b68:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  801b6f:	00 00 00 
+  801b72:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b74:	48 85 c0             	test   %rax,%rax
+  801b77:	7e b5                	jle    801b2e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801b79:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801b7d:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801b80:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801b83:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801b86:	8d 51 01             	lea    0x1(%rcx),%edx
+  801b89:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b8c:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801b8f:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801b96:	00 
+  801b97:	eb 95                	jmp    801b2e <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b99:	48 98                	cltq
+  801b9b:	eb 91                	jmp    801b2e <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b9d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801ba1:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801ba4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba8:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801bac:	48 89 df             	mov    %rbx,%rdi
+  801baf:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  801bb6:	00 00 00 
+  801bb9:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801bbb:	48 85 c0             	test   %rax,%rax
+  801bbe:	0f 8e 6a ff ff ff    	jle    801b2e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801bc4:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801bc7:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801bcb:	e9 5e ff ff ff       	jmp    801b2e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bd0:	48 98                	cltq
+  801bd2:	4d 85 ff             	test   %r15,%r15
+  801bd5:	49 0f 45 c7          	cmovne %r15,%rax
+  801bd9:	e9 50 ff ff ff       	jmp    801b2e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bde:	48 89 de             	mov    %rbx,%rsi
+  801be1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801be5:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801bec:	00 00 00 
+  801bef:	ff d0                	call   *%rax
+  801bf1:	85 c0                	test   %eax,%eax
+  801bf3:	0f 88 2b 01 00 00    	js     801d24 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801bf9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801bfd:	4c 01 f8             	add    %r15,%rax
+  801c00:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801c04:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c08:	48 b9 b4 0c 80 00 00 	movabs $0x800cb4,%rcx
+  801c0f:	00 00 00 
+  801c12:	ff d1                	call   *%rcx
+  801c14:	48 89 c2             	mov    %rax,%rdx
+  801c17:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c1b:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801c1f:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c23:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c28:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c2b:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c32:	00 
+  801c33:	4c 89 ea             	mov    %r13,%rdx
+  801c36:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c3a:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  801c41:	00 00 00 
+  801c44:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c46:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c4a:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801c4e:	48 39 c2             	cmp    %rax,%rdx
+  801c51:	0f 84 db 00 00 00    	je     801d32 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801c57:	4c 39 e2             	cmp    %r12,%rdx
+  801c5a:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801c5e:	4d 01 ec             	add    %r13,%r12
+  801c61:	49 39 c4             	cmp    %rax,%r12
+  801c64:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801c68:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801c6c:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801c70:	45 01 ee             	add    %r13d,%r14d
+  801c73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c77:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801c7b:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801c7e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c82:	49 39 c7             	cmp    %rax,%r15
+  801c85:	0f 83 a0 fe ff ff    	jae    801b2b <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801c8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c8f:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801c93:	8b 43 08             	mov    0x8(%rbx),%eax
+  801c96:	44 39 f0             	cmp    %r14d,%eax
+  801c99:	7f 10                	jg     801cab <devfile_write+0x1d3>
+  801c9b:	48 98                	cltq
+  801c9d:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801ca3:	49 63 d6             	movslq %r14d,%rdx
+  801ca6:	48 39 d0             	cmp    %rdx,%rax
+  801ca9:	7d 2d                	jge    801cd8 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801cab:	48 89 de             	mov    %rbx,%rsi
+  801cae:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801cb2:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801cb9:	00 00 00 
+  801cbc:	ff d0                	call   *%rax
+  801cbe:	85 c0                	test   %eax,%eax
+  801cc0:	0f 88 0a ff ff ff    	js     801bd0 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801cc6:	44 89 f0             	mov    %r14d,%eax
+  801cc9:	66 b8 00 00          	mov    $0x0,%ax
+  801ccd:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801cd0:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801cd7:	00 
+        size_t off = pos - fb->fb_base;
+  801cd8:	45 89 f4             	mov    %r14d,%r12d
+  801cdb:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801cdf:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801ce2:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801ce6:	4d 29 fd             	sub    %r15,%r13
+  801ce9:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801cee:	4c 29 e0             	sub    %r12,%rax
+  801cf1:	49 39 c5             	cmp    %rax,%r13
+  801cf4:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801cf8:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801cfc:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801d00:	48 39 c2             	cmp    %rax,%rdx
+  801d03:	0f 84 f0 fe ff ff    	je     801bf9 <devfile_write+0x121>
+  801d09:	4c 39 e0             	cmp    %r12,%rax
+  801d0c:	0f 82 cc fe ff ff    	jb     801bde <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801d12:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d16:	48 39 d0             	cmp    %rdx,%rax
+  801d19:	0f 83 da fe ff ff    	jae    801bf9 <devfile_write+0x121>
+  801d1f:	e9 ba fe ff ff       	jmp    801bde <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d24:	48 98                	cltq
+  801d26:	4d 85 ff             	test   %r15,%r15
+  801d29:	49 0f 45 c7          	cmovne %r15,%rax
+  801d2d:	e9 fc fd ff ff       	jmp    801b2e <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d32:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d36:	4c 89 e2             	mov    %r12,%rdx
+  801d39:	e9 2a ff ff ff       	jmp    801c68 <devfile_write+0x190>
+
+0000000000801d3e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d3e:	55                   	push   %rbp
+  801d3f:	48 89 e5             	mov    %rsp,%rbp
+  801d42:	41 57                	push   %r15
+  801d44:	41 56                	push   %r14
+  801d46:	41 55                	push   %r13
+  801d48:	41 54                	push   %r12
+  801d4a:	53                   	push   %rbx
+  801d4b:	48 83 ec 28          	sub    $0x28,%rsp
+  801d4f:	49 89 ff             	mov    %rdi,%r15
+  801d52:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801d56:	48 89 d3             	mov    %rdx,%rbx
+  801d59:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801d5d:	48 b8 88 14 80 00 00 	movabs $0x801488,%rax
+  801d64:	00 00 00 
+  801d67:	ff d0                	call   *%rax
+  801d69:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801d6c:	48 85 c0             	test   %rax,%rax
+  801d6f:	74 0d                	je     801d7e <devfile_read+0x40>
+  801d71:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801d78:	0f 86 1a 01 00 00    	jbe    801e98 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801d7e:	4d 85 e4             	test   %r12,%r12
+  801d81:	74 1a                	je     801d9d <devfile_read+0x5f>
+  801d83:	4c 89 e6             	mov    %r12,%rsi
+  801d86:	4c 89 ff             	mov    %r15,%rdi
+  801d89:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801d90:	00 00 00 
+  801d93:	ff d0                	call   *%rax
+  801d95:	85 c0                	test   %eax,%eax
+  801d97:	0f 88 e8 00 00 00    	js     801e85 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801d9d:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801da1:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  801da8:	00 00 00 
+  801dab:	ff d0                	call   *%rax
+  801dad:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801db0:	48 85 c0             	test   %rax,%rax
+  801db3:	0f 84 69 02 00 00    	je     802022 <devfile_read+0x2e4>
+    while (i < n) {
+  801db9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801dbe:	0f 84 ce 00 00 00    	je     801e92 <devfile_read+0x154>
+    size_t i = 0;
+  801dc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801dc9:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801dd0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dd4:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801dd8:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801ddc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801de0:	48 29 da             	sub    %rbx,%rdx
+  801de3:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801de8:	48 39 c2             	cmp    %rax,%rdx
+  801deb:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801def:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801df3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801df7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801dfa:	01 d8                	add    %ebx,%eax
+  801dfc:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801e00:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801e04:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801e0b:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801e12:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801e19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e24:	4c 89 ee             	mov    %r13,%rsi
+  801e27:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e2c:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  801e33:	00 00 00 
+  801e36:	ff d0                	call   *%rax
+        if (res < 0)
+  801e38:	85 c0                	test   %eax,%eax
+  801e3a:	78 4d                	js     801e89 <devfile_read+0x14b>
+        if (res == 0)
+  801e3c:	74 4f                	je     801e8d <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e3e:	4c 63 e0             	movslq %eax,%r12
+  801e41:	4c 89 e2             	mov    %r12,%rdx
+  801e44:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e48:	4c 89 f7             	mov    %r14,%rdi
+  801e4b:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  801e52:	00 00 00 
+  801e55:	ff d0                	call   *%rax
+        i += res;
+  801e57:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801e5a:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801e5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e61:	48 39 c3             	cmp    %rax,%rbx
+  801e64:	0f 82 72 ff ff ff    	jb     801ddc <devfile_read+0x9e>
+    return i;
+  801e6a:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801e6d:	48 85 c0             	test   %rax,%rax
+  801e70:	7e 04                	jle    801e76 <devfile_read+0x138>
+  801e72:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801e76:	48 83 c4 28          	add    $0x28,%rsp
+  801e7a:	5b                   	pop    %rbx
+  801e7b:	41 5c                	pop    %r12
+  801e7d:	41 5d                	pop    %r13
+  801e7f:	41 5e                	pop    %r14
+  801e81:	41 5f                	pop    %r15
+  801e83:	5d                   	pop    %rbp
+  801e84:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801e85:	48 98                	cltq
+  801e87:	eb ed                	jmp    801e76 <devfile_read+0x138>
+            return res;
+  801e89:	48 98                	cltq
+  801e8b:	eb e9                	jmp    801e76 <devfile_read+0x138>
+            return i;
+  801e8d:	48 89 d8             	mov    %rbx,%rax
+  801e90:	eb db                	jmp    801e6d <devfile_read+0x12f>
+    size_t i = 0;
+  801e92:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801e96:	eb d2                	jmp    801e6a <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801e98:	48 89 c6             	mov    %rax,%rsi
+  801e9b:	4c 89 ff             	mov    %r15,%rdi
+  801e9e:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801ea5:	00 00 00 
+  801ea8:	ff d0                	call   *%rax
+  801eaa:	85 c0                	test   %eax,%eax
+  801eac:	78 40                	js     801eee <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801eae:	4c 89 ff             	mov    %r15,%rdi
+  801eb1:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  801eb8:	00 00 00 
+  801ebb:	ff d0                	call   *%rax
+  801ebd:	48 89 c2             	mov    %rax,%rdx
+  801ec0:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ec4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801ec8:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ecc:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801ed1:	48 01 d0             	add    %rdx,%rax
+  801ed4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801ed8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801edd:	0f 84 33 01 00 00    	je     802016 <devfile_read+0x2d8>
+    size_t i = 0;
+  801ee3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801ee9:	e9 f5 00 00 00       	jmp    801fe3 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801eee:	48 98                	cltq
+  801ef0:	eb 84                	jmp    801e76 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801ef2:	44 89 e8             	mov    %r13d,%eax
+  801ef5:	66 b8 00 00          	mov    $0x0,%ax
+  801ef9:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801efe:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801f05:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801f07:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801f0b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801f0f:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801f11:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801f16:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801f19:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801f20:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801f21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f2c:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f31:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f36:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  801f3d:	00 00 00 
+  801f40:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	0f 88 be 00 00 00    	js     802008 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f4a:	48 63 d0             	movslq %eax,%rdx
+  801f4d:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801f52:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801f57:	44 39 e8             	cmp    %r13d,%eax
+  801f5a:	0f 8e ba 00 00 00    	jle    80201a <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801f60:	49 63 c5             	movslq %r13d,%rax
+  801f63:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801f68:	48 29 c3             	sub    %rax,%rbx
+  801f6b:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801f70:	48 01 c3             	add    %rax,%rbx
+  801f73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f77:	4c 29 f0             	sub    %r14,%rax
+  801f7a:	48 39 c3             	cmp    %rax,%rbx
+  801f7d:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801f81:	4c 89 ff             	mov    %r15,%rdi
+  801f84:	48 b9 b4 0c 80 00 00 	movabs $0x800cb4,%rcx
+  801f8b:	00 00 00 
+  801f8e:	ff d1                	call   *%rcx
+  801f90:	48 89 c2             	mov    %rax,%rdx
+  801f93:	48 c1 e2 04          	shl    $0x4,%rdx
+  801f97:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801f9b:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f9f:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801fa4:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801fa7:	44 89 ea             	mov    %r13d,%edx
+  801faa:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  801faf:	48 63 d2             	movslq %edx,%rdx
+  801fb2:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801fb9:	00 
+  801fba:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801fbe:	4c 01 f7             	add    %r14,%rdi
+  801fc1:	48 89 da             	mov    %rbx,%rdx
+  801fc4:	48 b9 fa 3d 80 00 00 	movabs $0x803dfa,%rcx
+  801fcb:	00 00 00 
+  801fce:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  801fd0:	41 01 dd             	add    %ebx,%r13d
+  801fd3:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  801fd7:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  801fda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fde:	49 39 c6             	cmp    %rax,%r14
+  801fe1:	73 37                	jae    80201a <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  801fe3:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  801fe7:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801fec:	44 39 e8             	cmp    %r13d,%eax
+  801fef:	0f 8f fd fe ff ff    	jg     801ef2 <devfile_read+0x1b4>
+  801ff5:	41 03 44 24 10       	add    0x10(%r12),%eax
+  801ffa:	44 39 e8             	cmp    %r13d,%eax
+  801ffd:	0f 8f 5d ff ff ff    	jg     801f60 <devfile_read+0x222>
+  802003:	e9 ea fe ff ff       	jmp    801ef2 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  802008:	48 98                	cltq
+  80200a:	4d 85 f6             	test   %r14,%r14
+  80200d:	49 0f 45 c6          	cmovne %r14,%rax
+  802011:	e9 60 fe ff ff       	jmp    801e76 <devfile_read+0x138>
+    size_t i = 0;
+  802016:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80201a:	4c 89 f0             	mov    %r14,%rax
+  80201d:	e9 54 fe ff ff       	jmp    801e76 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  802022:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802029:	e9 48 fe ff ff       	jmp    801e76 <devfile_read+0x138>
+
+000000000080202e <open>:
+open(const char *path, int mode) {
+  80202e:	55                   	push   %rbp
+  80202f:	48 89 e5             	mov    %rsp,%rbp
+  802032:	41 55                	push   %r13
+  802034:	41 54                	push   %r12
+  802036:	53                   	push   %rbx
+  802037:	48 83 ec 18          	sub    $0x18,%rsp
+  80203b:	49 89 fc             	mov    %rdi,%r12
+  80203e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802041:	48 b8 c7 39 80 00 00 	movabs $0x8039c7,%rax
+  802048:	00 00 00 
+  80204b:	ff d0                	call   *%rax
+  80204d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802053:	0f 87 8a 00 00 00    	ja     8020e3 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802059:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80205d:	48 b8 e2 0c 80 00 00 	movabs $0x800ce2,%rax
+  802064:	00 00 00 
+  802067:	ff d0                	call   *%rax
+  802069:	89 c3                	mov    %eax,%ebx
+  80206b:	85 c0                	test   %eax,%eax
+  80206d:	78 50                	js     8020bf <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80206f:	4c 89 e6             	mov    %r12,%rsi
+  802072:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802079:	00 00 00 
+  80207c:	48 89 df             	mov    %rbx,%rdi
+  80207f:	48 b8 05 3a 80 00 00 	movabs $0x803a05,%rax
+  802086:	00 00 00 
+  802089:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80208b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802092:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802096:	bf 01 00 00 00       	mov    $0x1,%edi
+  80209b:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  8020a2:	00 00 00 
+  8020a5:	ff d0                	call   *%rax
+  8020a7:	89 c3                	mov    %eax,%ebx
+  8020a9:	85 c0                	test   %eax,%eax
+  8020ab:	78 1f                	js     8020cc <open+0x9e>
+    return fd2num(fd);
+  8020ad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020b1:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  8020b8:	00 00 00 
+  8020bb:	ff d0                	call   *%rax
+  8020bd:	89 c3                	mov    %eax,%ebx
+}
+  8020bf:	89 d8                	mov    %ebx,%eax
+  8020c1:	48 83 c4 18          	add    $0x18,%rsp
+  8020c5:	5b                   	pop    %rbx
+  8020c6:	41 5c                	pop    %r12
+  8020c8:	41 5d                	pop    %r13
+  8020ca:	5d                   	pop    %rbp
+  8020cb:	c3                   	ret
+        fd_close(fd, 0);
+  8020cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020d5:	48 b8 fd 0d 80 00 00 	movabs $0x800dfd,%rax
+  8020dc:	00 00 00 
+  8020df:	ff d0                	call   *%rax
+        return res;
+  8020e1:	eb dc                	jmp    8020bf <open+0x91>
+        return -E_BAD_PATH;
+  8020e3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020e8:	eb d5                	jmp    8020bf <open+0x91>
+
+00000000008020ea <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8020ea:	55                   	push   %rbp
+  8020eb:	48 89 e5             	mov    %rsp,%rbp
+  8020ee:	41 57                	push   %r15
+  8020f0:	41 56                	push   %r14
+  8020f2:	41 55                	push   %r13
+  8020f4:	41 54                	push   %r12
+  8020f6:	53                   	push   %rbx
+  8020f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8020fb:	41 89 f6             	mov    %esi,%r14d
+  8020fe:	49 89 d7             	mov    %rdx,%r15
+  802101:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802104:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802108:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  80210f:	00 00 00 
+  802112:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802114:	85 c0                	test   %eax,%eax
+  802116:	0f 88 db 00 00 00    	js     8021f7 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80211c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802120:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802127:	00 00 00 
+  80212a:	8b 00                	mov    (%rax),%eax
+  80212c:	39 07                	cmp    %eax,(%rdi)
+  80212e:	0f 85 db 00 00 00    	jne    80220f <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802134:	45 85 f6             	test   %r14d,%r14d
+  802137:	0f 88 db 00 00 00    	js     802218 <fmap+0x12e>
+  80213d:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802144:	0f 85 d7 00 00 00    	jne    802221 <fmap+0x137>
+  80214a:	4c 89 fb             	mov    %r15,%rbx
+  80214d:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802153:	0f 85 d1 00 00 00    	jne    80222a <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802159:	48 b8 7a 18 80 00 00 	movabs $0x80187a,%rax
+  802160:	00 00 00 
+  802163:	ff d0                	call   *%rax
+  802165:	85 c0                	test   %eax,%eax
+  802167:	0f 88 8e 00 00 00    	js     8021fb <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80216d:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  802174:	00 00 00 
+    while (i < n) {
+  802177:	4d 85 ed             	test   %r13,%r13
+  80217a:	0f 84 8a 00 00 00    	je     80220a <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  802180:	4c 89 ea             	mov    %r13,%rdx
+  802183:	48 29 da             	sub    %rbx,%rdx
+  802186:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80218d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802193:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802197:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80219b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80219e:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8021a2:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8021a6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8021ab:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8021b0:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8021b4:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8021b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021bd:	4c 89 e6             	mov    %r12,%rsi
+  8021c0:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021c5:	48 b8 08 16 80 00 00 	movabs $0x801608,%rax
+  8021cc:	00 00 00 
+  8021cf:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021d1:	85 c0                	test   %eax,%eax
+  8021d3:	78 2a                	js     8021ff <fmap+0x115>
+        i += res;
+  8021d5:	48 98                	cltq
+  8021d7:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8021da:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8021de:	72 05                	jb     8021e5 <fmap+0xfb>
+    while (i < n) {
+  8021e0:	4c 39 eb             	cmp    %r13,%rbx
+  8021e3:	72 9b                	jb     802180 <fmap+0x96>
+    }
+    return i;
+  8021e5:	48 89 d8             	mov    %rbx,%rax
+}
+  8021e8:	48 83 c4 18          	add    $0x18,%rsp
+  8021ec:	5b                   	pop    %rbx
+  8021ed:	41 5c                	pop    %r12
+  8021ef:	41 5d                	pop    %r13
+  8021f1:	41 5e                	pop    %r14
+  8021f3:	41 5f                	pop    %r15
+  8021f5:	5d                   	pop    %rbp
+  8021f6:	c3                   	ret
+    if (res < 0) return res;
+  8021f7:	48 98                	cltq
+  8021f9:	eb ed                	jmp    8021e8 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8021fb:	48 98                	cltq
+  8021fd:	eb e9                	jmp    8021e8 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021ff:	48 98                	cltq
+  802201:	48 85 db             	test   %rbx,%rbx
+  802204:	48 0f 45 c3          	cmovne %rbx,%rax
+  802208:	eb de                	jmp    8021e8 <fmap+0xfe>
+    size_t i = 0;
+  80220a:	4c 89 eb             	mov    %r13,%rbx
+  80220d:	eb d6                	jmp    8021e5 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80220f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802216:	eb d0                	jmp    8021e8 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802218:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80221f:	eb c7                	jmp    8021e8 <fmap+0xfe>
+  802221:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802228:	eb be                	jmp    8021e8 <fmap+0xfe>
+  80222a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802231:	eb b5                	jmp    8021e8 <fmap+0xfe>
+
+0000000000802233 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  802233:	55                   	push   %rbp
+  802234:	48 89 e5             	mov    %rsp,%rbp
+  802237:	41 56                	push   %r14
+  802239:	41 55                	push   %r13
+  80223b:	41 54                	push   %r12
+  80223d:	53                   	push   %rbx
+  80223e:	48 83 ec 10          	sub    $0x10,%rsp
+  802242:	89 fb                	mov    %edi,%ebx
+  802244:	41 89 f4             	mov    %esi,%r12d
+  802247:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80224a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80224e:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  802255:	00 00 00 
+  802258:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	78 63                	js     8022c1 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80225e:	45 85 e4             	test   %r12d,%r12d
+  802261:	0f 88 80 00 00 00    	js     8022e7 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  802267:	45 89 e6             	mov    %r12d,%r14d
+  80226a:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  802271:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802275:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  80227c:	00 00 00 
+  80227f:	ff d0                	call   *%rax
+  802281:	48 89 c2             	mov    %rax,%rdx
+  802284:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802289:	44 89 f6             	mov    %r14d,%esi
+  80228c:	89 df                	mov    %ebx,%edi
+  80228e:	48 b8 ea 20 80 00 00 	movabs $0x8020ea,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+  80229a:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80229d:	45 29 f4             	sub    %r14d,%r12d
+  8022a0:	4d 63 f4             	movslq %r12d,%r14
+  8022a3:	49 39 c6             	cmp    %rax,%r14
+  8022a6:	7c 1d                	jl     8022c5 <read_map+0x92>
+  8022a8:	48 85 c0             	test   %rax,%rax
+  8022ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b0:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8022b4:	48 83 c4 10          	add    $0x10,%rsp
+  8022b8:	5b                   	pop    %rbx
+  8022b9:	41 5c                	pop    %r12
+  8022bb:	41 5d                	pop    %r13
+  8022bd:	41 5e                	pop    %r14
+  8022bf:	5d                   	pop    %rbp
+  8022c0:	c3                   	ret
+    if (res < 0) return res;
+  8022c1:	48 98                	cltq
+  8022c3:	eb ef                	jmp    8022b4 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8022c5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022c9:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  8022d0:	00 00 00 
+  8022d3:	ff d0                	call   *%rax
+  8022d5:	4d 63 e4             	movslq %r12d,%r12
+  8022d8:	4c 01 e0             	add    %r12,%rax
+  8022db:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8022df:	48 89 d8             	mov    %rbx,%rax
+  8022e2:	4c 29 f0             	sub    %r14,%rax
+  8022e5:	eb cd                	jmp    8022b4 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8022e7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022ee:	eb c4                	jmp    8022b4 <read_map+0x81>
+
+00000000008022f0 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8022f0:	55                   	push   %rbp
+  8022f1:	48 89 e5             	mov    %rsp,%rbp
+  8022f4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022f8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022fc:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802308:	85 c0                	test   %eax,%eax
+  80230a:	78 4a                	js     802356 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80230c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802310:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802317:	00 00 00 
+  80231a:	8b 00                	mov    (%rax),%eax
+  80231c:	39 07                	cmp    %eax,(%rdi)
+  80231e:	75 38                	jne    802358 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802320:	48 b8 7a 18 80 00 00 	movabs $0x80187a,%rax
+  802327:	00 00 00 
+  80232a:	ff d0                	call   *%rax
+  80232c:	85 c0                	test   %eax,%eax
+  80232e:	78 26                	js     802356 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802330:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802334:	8b 40 0c             	mov    0xc(%rax),%eax
+  802337:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80233e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802340:	be 00 00 00 00       	mov    $0x0,%esi
+  802345:	bf 06 00 00 00       	mov    $0x6,%edi
+  80234a:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  802351:	00 00 00 
+  802354:	ff d0                	call   *%rax
+}
+  802356:	c9                   	leave
+  802357:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802358:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80235d:	eb f7                	jmp    802356 <fsync+0x66>
+
+000000000080235f <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80235f:	55                   	push   %rbp
+  802360:	48 89 e5             	mov    %rsp,%rbp
+  802363:	41 57                	push   %r15
+  802365:	41 56                	push   %r14
+  802367:	41 55                	push   %r13
+  802369:	41 54                	push   %r12
+  80236b:	53                   	push   %rbx
+  80236c:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  802370:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  802377:	00 00 00 
+  80237a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80237f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802385:	49 bd 42 0d 80 00 00 	movabs $0x800d42,%r13
+  80238c:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80238f:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  802396:	00 00 00 
+  802399:	eb 0c                	jmp    8023a7 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80239b:	83 c3 01             	add    $0x1,%ebx
+  80239e:	49 83 c4 28          	add    $0x28,%r12
+  8023a2:	83 fb 20             	cmp    $0x20,%ebx
+  8023a5:	74 33                	je     8023da <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023a7:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8023ac:	74 ed                	je     80239b <flushall+0x3c>
+  8023ae:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8023b2:	89 df                	mov    %ebx,%edi
+  8023b4:	41 ff d5             	call   *%r13
+  8023b7:	85 c0                	test   %eax,%eax
+  8023b9:	78 e0                	js     80239b <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8023bb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023bf:	41 8b 06             	mov    (%r14),%eax
+  8023c2:	39 07                	cmp    %eax,(%rdi)
+  8023c4:	75 d5                	jne    80239b <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8023c6:	48 b8 7a 18 80 00 00 	movabs $0x80187a,%rax
+  8023cd:	00 00 00 
+  8023d0:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8023d2:	85 c0                	test   %eax,%eax
+  8023d4:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8023d8:	eb c1                	jmp    80239b <flushall+0x3c>
+    }
+    return res;
+}
+  8023da:	44 89 f8             	mov    %r15d,%eax
+  8023dd:	48 83 c4 18          	add    $0x18,%rsp
+  8023e1:	5b                   	pop    %rbx
+  8023e2:	41 5c                	pop    %r12
+  8023e4:	41 5d                	pop    %r13
+  8023e6:	41 5e                	pop    %r14
+  8023e8:	41 5f                	pop    %r15
+  8023ea:	5d                   	pop    %rbp
+  8023eb:	c3                   	ret
+
+00000000008023ec <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8023ec:	55                   	push   %rbp
+  8023ed:	48 89 e5             	mov    %rsp,%rbp
+  8023f0:	53                   	push   %rbx
+  8023f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8023f5:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8023f8:	40 0f b6 c6          	movzbl %sil,%eax
+  8023fc:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802403:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  802405:	be 00 00 00 00       	mov    $0x0,%esi
+  80240a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80240f:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  802416:	00 00 00 
+  802419:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80241b:	85 c0                	test   %eax,%eax
+  80241d:	78 23                	js     802442 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80241f:	ba 58 06 00 00       	mov    $0x658,%edx
+  802424:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80242b:	00 00 00 
+  80242e:	48 89 df             	mov    %rbx,%rdi
+  802431:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  802438:	00 00 00 
+  80243b:	ff d0                	call   *%rax
+    return 0;
+  80243d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802442:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802446:	c9                   	leave
+  802447:	c3                   	ret
+
+0000000000802448 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  802448:	55                   	push   %rbp
+  802449:	48 89 e5             	mov    %rsp,%rbp
+  80244c:	53                   	push   %rbx
+  80244d:	48 83 ec 08          	sub    $0x8,%rsp
+  802451:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  802454:	48 b8 c7 39 80 00 00 	movabs $0x8039c7,%rax
+  80245b:	00 00 00 
+  80245e:	ff d0                	call   *%rax
+  802460:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802466:	77 35                	ja     80249d <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  802468:	48 89 de             	mov    %rbx,%rsi
+  80246b:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  802472:	00 00 00 
+  802475:	48 b8 05 3a 80 00 00 	movabs $0x803a05,%rax
+  80247c:	00 00 00 
+  80247f:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  802481:	be 00 00 00 00       	mov    $0x0,%esi
+  802486:	bf 07 00 00 00       	mov    $0x7,%edi
+  80248b:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  802492:	00 00 00 
+  802495:	ff d0                	call   *%rax
+}
+  802497:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80249b:	c9                   	leave
+  80249c:	c3                   	ret
+        return -E_BAD_PATH;
+  80249d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8024a2:	eb f3                	jmp    802497 <remove+0x4f>
+
+00000000008024a4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024a4:	55                   	push   %rbp
+  8024a5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8024a8:	48 b8 5f 23 80 00 00 	movabs $0x80235f,%rax
+  8024af:	00 00 00 
+  8024b2:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024be:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+}
+  8024ca:	5d                   	pop    %rbp
+  8024cb:	c3                   	ret
+
+00000000008024cc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024cc:	55                   	push   %rbp
+  8024cd:	48 89 e5             	mov    %rsp,%rbp
+  8024d0:	41 54                	push   %r12
+  8024d2:	53                   	push   %rbx
+  8024d3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024d6:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+  8024e2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024e5:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  8024ec:	00 00 00 
+  8024ef:	48 89 df             	mov    %rbx,%rdi
+  8024f2:	48 b8 05 3a 80 00 00 	movabs $0x803a05,%rax
+  8024f9:	00 00 00 
+  8024fc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024fe:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802503:	41 2b 04 24          	sub    (%r12),%eax
+  802507:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80250d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802514:	00 00 00 
+    stat->st_dev = &devpipe;
+  802517:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80251e:	00 00 00 
+  802521:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80252d:	5b                   	pop    %rbx
+  80252e:	41 5c                	pop    %r12
+  802530:	5d                   	pop    %rbp
+  802531:	c3                   	ret
+
+0000000000802532 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802532:	55                   	push   %rbp
+  802533:	48 89 e5             	mov    %rsp,%rbp
+  802536:	41 54                	push   %r12
+  802538:	53                   	push   %rbx
+  802539:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80253c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802541:	48 89 fe             	mov    %rdi,%rsi
+  802544:	bf 00 00 00 00       	mov    $0x0,%edi
+  802549:	49 bc 7d 04 80 00 00 	movabs $0x80047d,%r12
+  802550:	00 00 00 
+  802553:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802556:	48 89 df             	mov    %rbx,%rdi
+  802559:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  802560:	00 00 00 
+  802563:	ff d0                	call   *%rax
+  802565:	48 89 c6             	mov    %rax,%rsi
+  802568:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80256d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802572:	41 ff d4             	call   *%r12
+}
+  802575:	5b                   	pop    %rbx
+  802576:	41 5c                	pop    %r12
+  802578:	5d                   	pop    %rbp
+  802579:	c3                   	ret
+
+000000000080257a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80257a:	55                   	push   %rbp
+  80257b:	48 89 e5             	mov    %rsp,%rbp
+  80257e:	41 57                	push   %r15
+  802580:	41 56                	push   %r14
+  802582:	41 55                	push   %r13
+  802584:	41 54                	push   %r12
+  802586:	53                   	push   %rbx
+  802587:	48 83 ec 18          	sub    $0x18,%rsp
+  80258b:	49 89 fc             	mov    %rdi,%r12
+  80258e:	49 89 f5             	mov    %rsi,%r13
+  802591:	49 89 d7             	mov    %rdx,%r15
+  802594:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802598:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025a4:	4d 85 ff             	test   %r15,%r15
+  8025a7:	0f 84 af 00 00 00    	je     80265c <devpipe_write+0xe2>
+  8025ad:	48 89 c3             	mov    %rax,%rbx
+  8025b0:	4c 89 f8             	mov    %r15,%rax
+  8025b3:	4d 89 ef             	mov    %r13,%r15
+  8025b6:	4c 01 e8             	add    %r13,%rax
+  8025b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025bd:	49 bd 72 02 80 00 00 	movabs $0x800272,%r13
+  8025c4:	00 00 00 
+            sys_yield();
+  8025c7:	49 be 0f 02 80 00 00 	movabs $0x80020f,%r14
+  8025ce:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025d1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025d4:	48 63 ce             	movslq %esi,%rcx
+  8025d7:	48 63 03             	movslq (%rbx),%rax
+  8025da:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025e0:	48 39 c1             	cmp    %rax,%rcx
+  8025e3:	72 2e                	jb     802613 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025e5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025ea:	48 89 da             	mov    %rbx,%rdx
+  8025ed:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025f2:	4c 89 e7             	mov    %r12,%rdi
+  8025f5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025f8:	85 c0                	test   %eax,%eax
+  8025fa:	74 66                	je     802662 <devpipe_write+0xe8>
+            sys_yield();
+  8025fc:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025ff:	8b 73 04             	mov    0x4(%rbx),%esi
+  802602:	48 63 ce             	movslq %esi,%rcx
+  802605:	48 63 03             	movslq (%rbx),%rax
+  802608:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80260e:	48 39 c1             	cmp    %rax,%rcx
+  802611:	73 d2                	jae    8025e5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802613:	41 0f b6 3f          	movzbl (%r15),%edi
+  802617:	48 89 ca             	mov    %rcx,%rdx
+  80261a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80261e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802625:	08 10 20 
+  802628:	48 f7 e2             	mul    %rdx
+  80262b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80262f:	48 89 d0             	mov    %rdx,%rax
+  802632:	48 c1 e0 09          	shl    $0x9,%rax
+  802636:	48 29 d0             	sub    %rdx,%rax
+  802639:	48 c1 e0 03          	shl    $0x3,%rax
+  80263d:	48 29 c1             	sub    %rax,%rcx
+  802640:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802645:	83 c6 01             	add    $0x1,%esi
+  802648:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80264b:	49 83 c7 01          	add    $0x1,%r15
+  80264f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802653:	49 39 c7             	cmp    %rax,%r15
+  802656:	0f 85 75 ff ff ff    	jne    8025d1 <devpipe_write+0x57>
+    return n;
+  80265c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802660:	eb 05                	jmp    802667 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802662:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802667:	48 83 c4 18          	add    $0x18,%rsp
+  80266b:	5b                   	pop    %rbx
+  80266c:	41 5c                	pop    %r12
+  80266e:	41 5d                	pop    %r13
+  802670:	41 5e                	pop    %r14
+  802672:	41 5f                	pop    %r15
+  802674:	5d                   	pop    %rbp
+  802675:	c3                   	ret
+
+0000000000802676 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802676:	55                   	push   %rbp
+  802677:	48 89 e5             	mov    %rsp,%rbp
+  80267a:	41 57                	push   %r15
+  80267c:	41 56                	push   %r14
+  80267e:	41 55                	push   %r13
+  802680:	41 54                	push   %r12
+  802682:	53                   	push   %rbx
+  802683:	48 83 ec 18          	sub    $0x18,%rsp
+  802687:	49 89 fc             	mov    %rdi,%r12
+  80268a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80268e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802692:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  802699:	00 00 00 
+  80269c:	ff d0                	call   *%rax
+  80269e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026a1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026a7:	49 bd 72 02 80 00 00 	movabs $0x800272,%r13
+  8026ae:	00 00 00 
+            sys_yield();
+  8026b1:	49 be 0f 02 80 00 00 	movabs $0x80020f,%r14
+  8026b8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026bb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026c0:	74 7d                	je     80273f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026c2:	8b 03                	mov    (%rbx),%eax
+  8026c4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026c7:	75 26                	jne    8026ef <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026c9:	4d 85 ff             	test   %r15,%r15
+  8026cc:	75 77                	jne    802745 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026ce:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026d3:	48 89 da             	mov    %rbx,%rdx
+  8026d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026db:	4c 89 e7             	mov    %r12,%rdi
+  8026de:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026e1:	85 c0                	test   %eax,%eax
+  8026e3:	74 72                	je     802757 <devpipe_read+0xe1>
+            sys_yield();
+  8026e5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026e8:	8b 03                	mov    (%rbx),%eax
+  8026ea:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026ed:	74 df                	je     8026ce <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026ef:	48 63 c8             	movslq %eax,%rcx
+  8026f2:	48 89 ca             	mov    %rcx,%rdx
+  8026f5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026f9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802700:	08 10 20 
+  802703:	48 89 d0             	mov    %rdx,%rax
+  802706:	48 f7 e6             	mul    %rsi
+  802709:	48 c1 ea 06          	shr    $0x6,%rdx
+  80270d:	48 89 d0             	mov    %rdx,%rax
+  802710:	48 c1 e0 09          	shl    $0x9,%rax
+  802714:	48 29 d0             	sub    %rdx,%rax
+  802717:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80271e:	00 
+  80271f:	48 89 c8             	mov    %rcx,%rax
+  802722:	48 29 d0             	sub    %rdx,%rax
+  802725:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80272a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80272e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802732:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802735:	49 83 c7 01          	add    $0x1,%r15
+  802739:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80273d:	75 83                	jne    8026c2 <devpipe_read+0x4c>
+    return n;
+  80273f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802743:	eb 03                	jmp    802748 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802745:	4c 89 f8             	mov    %r15,%rax
+}
+  802748:	48 83 c4 18          	add    $0x18,%rsp
+  80274c:	5b                   	pop    %rbx
+  80274d:	41 5c                	pop    %r12
+  80274f:	41 5d                	pop    %r13
+  802751:	41 5e                	pop    %r14
+  802753:	41 5f                	pop    %r15
+  802755:	5d                   	pop    %rbp
+  802756:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80275c:	eb ea                	jmp    802748 <devpipe_read+0xd2>
+
+000000000080275e <pipe>:
+pipe(int pfd[2]) {
+  80275e:	55                   	push   %rbp
+  80275f:	48 89 e5             	mov    %rsp,%rbp
+  802762:	41 55                	push   %r13
+  802764:	41 54                	push   %r12
+  802766:	53                   	push   %rbx
+  802767:	48 83 ec 18          	sub    $0x18,%rsp
+  80276b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80276e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802772:	48 b8 e2 0c 80 00 00 	movabs $0x800ce2,%rax
+  802779:	00 00 00 
+  80277c:	ff d0                	call   *%rax
+  80277e:	89 c3                	mov    %eax,%ebx
+  802780:	85 c0                	test   %eax,%eax
+  802782:	0f 88 a0 01 00 00    	js     802928 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802788:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80278d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802792:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802796:	bf 00 00 00 00       	mov    $0x0,%edi
+  80279b:	48 b8 9e 02 80 00 00 	movabs $0x80029e,%rax
+  8027a2:	00 00 00 
+  8027a5:	ff d0                	call   *%rax
+  8027a7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027a9:	85 c0                	test   %eax,%eax
+  8027ab:	0f 88 77 01 00 00    	js     802928 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027b1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8027b5:	48 b8 e2 0c 80 00 00 	movabs $0x800ce2,%rax
+  8027bc:	00 00 00 
+  8027bf:	ff d0                	call   *%rax
+  8027c1:	89 c3                	mov    %eax,%ebx
+  8027c3:	85 c0                	test   %eax,%eax
+  8027c5:	0f 88 43 01 00 00    	js     80290e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027cb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027d5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027de:	48 b8 9e 02 80 00 00 	movabs $0x80029e,%rax
+  8027e5:	00 00 00 
+  8027e8:	ff d0                	call   *%rax
+  8027ea:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027ec:	85 c0                	test   %eax,%eax
+  8027ee:	0f 88 1a 01 00 00    	js     80290e <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027f4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027f8:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  8027ff:	00 00 00 
+  802802:	ff d0                	call   *%rax
+  802804:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802807:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80280c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802811:	48 89 c6             	mov    %rax,%rsi
+  802814:	bf 00 00 00 00       	mov    $0x0,%edi
+  802819:	48 b8 9e 02 80 00 00 	movabs $0x80029e,%rax
+  802820:	00 00 00 
+  802823:	ff d0                	call   *%rax
+  802825:	89 c3                	mov    %eax,%ebx
+  802827:	85 c0                	test   %eax,%eax
+  802829:	0f 88 c5 00 00 00    	js     8028f4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80282f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802833:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  80283a:	00 00 00 
+  80283d:	ff d0                	call   *%rax
+  80283f:	48 89 c1             	mov    %rax,%rcx
+  802842:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802848:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80284e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802853:	4c 89 ee             	mov    %r13,%rsi
+  802856:	bf 00 00 00 00       	mov    $0x0,%edi
+  80285b:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  802862:	00 00 00 
+  802865:	ff d0                	call   *%rax
+  802867:	89 c3                	mov    %eax,%ebx
+  802869:	85 c0                	test   %eax,%eax
+  80286b:	78 6e                	js     8028db <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80286d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802872:	4c 89 ef             	mov    %r13,%rdi
+  802875:	48 b8 40 02 80 00 00 	movabs $0x800240,%rax
+  80287c:	00 00 00 
+  80287f:	ff d0                	call   *%rax
+  802881:	83 f8 02             	cmp    $0x2,%eax
+  802884:	0f 85 ab 00 00 00    	jne    802935 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80288a:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  802891:	00 00 
+  802893:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802897:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802899:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80289d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028a4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028a8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028ae:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028b5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028b9:	48 bb b4 0c 80 00 00 	movabs $0x800cb4,%rbx
+  8028c0:	00 00 00 
+  8028c3:	ff d3                	call   *%rbx
+  8028c5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028c9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028cd:	ff d3                	call   *%rbx
+  8028cf:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d9:	eb 4d                	jmp    802928 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8028db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028e0:	4c 89 ee             	mov    %r13,%rsi
+  8028e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e8:	48 b8 7d 04 80 00 00 	movabs $0x80047d,%rax
+  8028ef:	00 00 00 
+  8028f2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028f9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802902:	48 b8 7d 04 80 00 00 	movabs $0x80047d,%rax
+  802909:	00 00 00 
+  80290c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80290e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802913:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802917:	bf 00 00 00 00       	mov    $0x0,%edi
+  80291c:	48 b8 7d 04 80 00 00 	movabs $0x80047d,%rax
+  802923:	00 00 00 
+  802926:	ff d0                	call   *%rax
+}
+  802928:	89 d8                	mov    %ebx,%eax
+  80292a:	48 83 c4 18          	add    $0x18,%rsp
+  80292e:	5b                   	pop    %rbx
+  80292f:	41 5c                	pop    %r12
+  802931:	41 5d                	pop    %r13
+  802933:	5d                   	pop    %rbp
+  802934:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802935:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  80293c:	00 00 00 
+  80293f:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  802946:	00 00 00 
+  802949:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80294e:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  802955:	00 00 00 
+  802958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295d:	49 b8 3d 2f 80 00 00 	movabs $0x802f3d,%r8
+  802964:	00 00 00 
+  802967:	41 ff d0             	call   *%r8
+
+000000000080296a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80296a:	55                   	push   %rbp
+  80296b:	48 89 e5             	mov    %rsp,%rbp
+  80296e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802972:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802976:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  80297d:	00 00 00 
+  802980:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802982:	85 c0                	test   %eax,%eax
+  802984:	78 35                	js     8029bb <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802986:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80298a:	48 b8 c6 0c 80 00 00 	movabs $0x800cc6,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+  802996:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802999:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80299e:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029a3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029a7:	48 b8 72 02 80 00 00 	movabs $0x800272,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+  8029b3:	85 c0                	test   %eax,%eax
+  8029b5:	0f 94 c0             	sete   %al
+  8029b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8029bb:	c9                   	leave
+  8029bc:	c3                   	ret
+
+00000000008029bd <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029bd:	48 89 f8             	mov    %rdi,%rax
+  8029c0:	48 c1 e8 27          	shr    $0x27,%rax
+  8029c4:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8029cb:	7f 00 00 
+  8029ce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029d2:	f6 c2 01             	test   $0x1,%dl
+  8029d5:	74 6d                	je     802a44 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029d7:	48 89 f8             	mov    %rdi,%rax
+  8029da:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029de:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029e5:	7f 00 00 
+  8029e8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ec:	f6 c2 01             	test   $0x1,%dl
+  8029ef:	74 62                	je     802a53 <get_uvpt_entry+0x96>
+  8029f1:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029f8:	7f 00 00 
+  8029fb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ff:	f6 c2 80             	test   $0x80,%dl
+  802a02:	75 4f                	jne    802a53 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a04:	48 89 f8             	mov    %rdi,%rax
+  802a07:	48 c1 e8 15          	shr    $0x15,%rax
+  802a0b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a12:	7f 00 00 
+  802a15:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a19:	f6 c2 01             	test   $0x1,%dl
+  802a1c:	74 44                	je     802a62 <get_uvpt_entry+0xa5>
+  802a1e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a25:	7f 00 00 
+  802a28:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a2c:	f6 c2 80             	test   $0x80,%dl
+  802a2f:	75 31                	jne    802a62 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a31:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a35:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a3c:	7f 00 00 
+  802a3f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a43:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a44:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a4b:	7f 00 00 
+  802a4e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a52:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a53:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a5a:	7f 00 00 
+  802a5d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a61:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a62:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a69:	7f 00 00 
+  802a6c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a70:	c3                   	ret
+
+0000000000802a71 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802a71:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a74:	48 89 f9             	mov    %rdi,%rcx
+  802a77:	48 c1 e9 27          	shr    $0x27,%rcx
+  802a7b:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802a82:	7f 00 00 
+  802a85:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802a89:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a90:	f6 c1 01             	test   $0x1,%cl
+  802a93:	0f 84 b2 00 00 00    	je     802b4b <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a99:	48 89 f9             	mov    %rdi,%rcx
+  802a9c:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802aa0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802aa7:	7f 00 00 
+  802aaa:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802aae:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802ab5:	40 f6 c6 01          	test   $0x1,%sil
+  802ab9:	0f 84 8c 00 00 00    	je     802b4b <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802abf:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802ac6:	7f 00 00 
+  802ac9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802acd:	a8 80                	test   $0x80,%al
+  802acf:	75 7b                	jne    802b4c <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ad1:	48 89 f9             	mov    %rdi,%rcx
+  802ad4:	48 c1 e9 15          	shr    $0x15,%rcx
+  802ad8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802adf:	7f 00 00 
+  802ae2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802ae6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802aed:	40 f6 c6 01          	test   $0x1,%sil
+  802af1:	74 58                	je     802b4b <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802af3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802afa:	7f 00 00 
+  802afd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b01:	a8 80                	test   $0x80,%al
+  802b03:	75 6c                	jne    802b71 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b05:	48 89 f9             	mov    %rdi,%rcx
+  802b08:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802b0c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b13:	7f 00 00 
+  802b16:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b1a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b21:	40 f6 c6 01          	test   $0x1,%sil
+  802b25:	74 24                	je     802b4b <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b27:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b2e:	7f 00 00 
+  802b31:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b35:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b3c:	ff ff 7f 
+  802b3f:	48 21 c8             	and    %rcx,%rax
+  802b42:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b48:	48 09 d0             	or     %rdx,%rax
+}
+  802b4b:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b4c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b53:	7f 00 00 
+  802b56:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b5a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b61:	ff ff 7f 
+  802b64:	48 21 c8             	and    %rcx,%rax
+  802b67:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802b6d:	48 01 d0             	add    %rdx,%rax
+  802b70:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802b71:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b78:	7f 00 00 
+  802b7b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b7f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b86:	ff ff 7f 
+  802b89:	48 21 c8             	and    %rcx,%rax
+  802b8c:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802b92:	48 01 d0             	add    %rdx,%rax
+  802b95:	c3                   	ret
+
+0000000000802b96 <get_prot>:
+
+int
+get_prot(void *va) {
+  802b96:	55                   	push   %rbp
+  802b97:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b9a:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  802ba1:	00 00 00 
+  802ba4:	ff d0                	call   *%rax
+  802ba6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802ba9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802bae:	89 c1                	mov    %eax,%ecx
+  802bb0:	83 c9 04             	or     $0x4,%ecx
+  802bb3:	f6 c2 01             	test   $0x1,%dl
+  802bb6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802bb9:	89 c1                	mov    %eax,%ecx
+  802bbb:	83 c9 02             	or     $0x2,%ecx
+  802bbe:	f6 c2 02             	test   $0x2,%dl
+  802bc1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802bc4:	89 c1                	mov    %eax,%ecx
+  802bc6:	83 c9 01             	or     $0x1,%ecx
+  802bc9:	48 85 d2             	test   %rdx,%rdx
+  802bcc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bcf:	89 c1                	mov    %eax,%ecx
+  802bd1:	83 c9 40             	or     $0x40,%ecx
+  802bd4:	f6 c6 04             	test   $0x4,%dh
+  802bd7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802bda:	5d                   	pop    %rbp
+  802bdb:	c3                   	ret
+
+0000000000802bdc <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802bdc:	55                   	push   %rbp
+  802bdd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802be0:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  802be7:	00 00 00 
+  802bea:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802bec:	48 c1 e8 06          	shr    $0x6,%rax
+  802bf0:	83 e0 01             	and    $0x1,%eax
+}
+  802bf3:	5d                   	pop    %rbp
+  802bf4:	c3                   	ret
+
+0000000000802bf5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bf5:	55                   	push   %rbp
+  802bf6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802bf9:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  802c00:	00 00 00 
+  802c03:	ff d0                	call   *%rax
+  802c05:	83 e0 01             	and    $0x1,%eax
+}
+  802c08:	5d                   	pop    %rbp
+  802c09:	c3                   	ret
+
+0000000000802c0a <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802c0a:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802c11:	7f 00 00 
+  802c14:	a8 01                	test   $0x1,%al
+  802c16:	75 06                	jne    802c1e <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1d:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c1e:	55                   	push   %rbp
+  802c1f:	48 89 e5             	mov    %rsp,%rbp
+  802c22:	41 57                	push   %r15
+  802c24:	41 56                	push   %r14
+  802c26:	41 55                	push   %r13
+  802c28:	41 54                	push   %r12
+  802c2a:	53                   	push   %rbx
+  802c2b:	48 83 ec 18          	sub    $0x18,%rsp
+  802c2f:	49 89 fe             	mov    %rdi,%r14
+  802c32:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c35:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c3c:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c3d:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c44:	7f 00 00 
+  802c47:	e9 81 00 00 00       	jmp    802ccd <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c4c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c53:	49 39 dd             	cmp    %rbx,%r13
+  802c56:	74 2b                	je     802c83 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c58:	48 89 d8             	mov    %rbx,%rax
+  802c5b:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c5f:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802c63:	f6 c2 01             	test   $0x1,%dl
+  802c66:	74 e4                	je     802c4c <foreach_shared_region+0x42>
+  802c68:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802c6c:	f6 c4 04             	test   $0x4,%ah
+  802c6f:	74 db                	je     802c4c <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802c71:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802c78:	4c 89 fa             	mov    %r15,%rdx
+  802c7b:	48 89 df             	mov    %rbx,%rdi
+  802c7e:	41 ff d6             	call   *%r14
+  802c81:	eb c9                	jmp    802c4c <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802c83:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802c8a:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802c8e:	74 22                	je     802cb2 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802c90:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802c97:	48 89 d8             	mov    %rbx,%rax
+  802c9a:	48 c1 e8 15          	shr    $0x15,%rax
+  802c9e:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802ca5:	7f 00 00 
+  802ca8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802cac:	a8 01                	test   $0x1,%al
+  802cae:	74 d3                	je     802c83 <foreach_shared_region+0x79>
+  802cb0:	eb a6                	jmp    802c58 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802cb2:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802cb9:	40 
+  802cba:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802cbe:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802cc5:	00 00 00 
+  802cc8:	48 39 c1             	cmp    %rax,%rcx
+  802ccb:	74 31                	je     802cfe <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802ccd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cd1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cd5:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802cdc:	7f 00 00 
+  802cdf:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802ce3:	a8 01                	test   $0x1,%al
+  802ce5:	74 cb                	je     802cb2 <foreach_shared_region+0xa8>
+  802ce7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ceb:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cf2:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802cf8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802cfc:	eb 92                	jmp    802c90 <foreach_shared_region+0x86>
+}
+  802cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d03:	48 83 c4 18          	add    $0x18,%rsp
+  802d07:	5b                   	pop    %rbx
+  802d08:	41 5c                	pop    %r12
+  802d0a:	41 5d                	pop    %r13
+  802d0c:	41 5e                	pop    %r14
+  802d0e:	41 5f                	pop    %r15
+  802d10:	5d                   	pop    %rbp
+  802d11:	c3                   	ret
+
+0000000000802d12 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d17:	c3                   	ret
+
+0000000000802d18 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d18:	55                   	push   %rbp
+  802d19:	48 89 e5             	mov    %rsp,%rbp
+  802d1c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d1f:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d26:	00 00 00 
+  802d29:	48 b8 05 3a 80 00 00 	movabs $0x803a05,%rax
+  802d30:	00 00 00 
+  802d33:	ff d0                	call   *%rax
+    return 0;
+}
+  802d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d3a:	5d                   	pop    %rbp
+  802d3b:	c3                   	ret
+
+0000000000802d3c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d3c:	55                   	push   %rbp
+  802d3d:	48 89 e5             	mov    %rsp,%rbp
+  802d40:	41 57                	push   %r15
+  802d42:	41 56                	push   %r14
+  802d44:	41 55                	push   %r13
+  802d46:	41 54                	push   %r12
+  802d48:	53                   	push   %rbx
+  802d49:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d50:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d57:	48 85 d2             	test   %rdx,%rdx
+  802d5a:	74 7a                	je     802dd6 <devcons_write+0x9a>
+  802d5c:	49 89 d6             	mov    %rdx,%r14
+  802d5f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d65:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d6a:	49 bf 93 3d 80 00 00 	movabs $0x803d93,%r15
+  802d71:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d74:	4c 89 f3             	mov    %r14,%rbx
+  802d77:	48 29 f3             	sub    %rsi,%rbx
+  802d7a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d7f:	48 39 c3             	cmp    %rax,%rbx
+  802d82:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d86:	4c 63 eb             	movslq %ebx,%r13
+  802d89:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d90:	48 01 c6             	add    %rax,%rsi
+  802d93:	4c 89 ea             	mov    %r13,%rdx
+  802d96:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d9d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802da0:	4c 89 ee             	mov    %r13,%rsi
+  802da3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802daa:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  802db1:	00 00 00 
+  802db4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802db6:	41 01 dc             	add    %ebx,%r12d
+  802db9:	49 63 f4             	movslq %r12d,%rsi
+  802dbc:	4c 39 f6             	cmp    %r14,%rsi
+  802dbf:	72 b3                	jb     802d74 <devcons_write+0x38>
+    return res;
+  802dc1:	49 63 c4             	movslq %r12d,%rax
+}
+  802dc4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802dcb:	5b                   	pop    %rbx
+  802dcc:	41 5c                	pop    %r12
+  802dce:	41 5d                	pop    %r13
+  802dd0:	41 5e                	pop    %r14
+  802dd2:	41 5f                	pop    %r15
+  802dd4:	5d                   	pop    %rbp
+  802dd5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802dd6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ddc:	eb e3                	jmp    802dc1 <devcons_write+0x85>
+
+0000000000802dde <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dde:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802de1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de6:	48 85 c0             	test   %rax,%rax
+  802de9:	74 55                	je     802e40 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802deb:	55                   	push   %rbp
+  802dec:	48 89 e5             	mov    %rsp,%rbp
+  802def:	41 55                	push   %r13
+  802df1:	41 54                	push   %r12
+  802df3:	53                   	push   %rbx
+  802df4:	48 83 ec 08          	sub    $0x8,%rsp
+  802df8:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802dfb:	48 bb 42 01 80 00 00 	movabs $0x800142,%rbx
+  802e02:	00 00 00 
+  802e05:	49 bc 0f 02 80 00 00 	movabs $0x80020f,%r12
+  802e0c:	00 00 00 
+  802e0f:	eb 03                	jmp    802e14 <devcons_read+0x36>
+  802e11:	41 ff d4             	call   *%r12
+  802e14:	ff d3                	call   *%rbx
+  802e16:	85 c0                	test   %eax,%eax
+  802e18:	74 f7                	je     802e11 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e1a:	48 63 d0             	movslq %eax,%rdx
+  802e1d:	78 13                	js     802e32 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e24:	83 f8 04             	cmp    $0x4,%eax
+  802e27:	74 09                	je     802e32 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e29:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e2d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e32:	48 89 d0             	mov    %rdx,%rax
+  802e35:	48 83 c4 08          	add    $0x8,%rsp
+  802e39:	5b                   	pop    %rbx
+  802e3a:	41 5c                	pop    %r12
+  802e3c:	41 5d                	pop    %r13
+  802e3e:	5d                   	pop    %rbp
+  802e3f:	c3                   	ret
+  802e40:	48 89 d0             	mov    %rdx,%rax
+  802e43:	c3                   	ret
+
+0000000000802e44 <cputchar>:
+cputchar(int ch) {
+  802e44:	55                   	push   %rbp
+  802e45:	48 89 e5             	mov    %rsp,%rbp
+  802e48:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e4c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e50:	be 01 00 00 00       	mov    $0x1,%esi
+  802e55:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e59:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  802e60:	00 00 00 
+  802e63:	ff d0                	call   *%rax
+}
+  802e65:	c9                   	leave
+  802e66:	c3                   	ret
+
+0000000000802e67 <getchar>:
+getchar(void) {
+  802e67:	55                   	push   %rbp
+  802e68:	48 89 e5             	mov    %rsp,%rbp
+  802e6b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e6f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e74:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e78:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e7d:	48 b8 25 10 80 00 00 	movabs $0x801025,%rax
+  802e84:	00 00 00 
+  802e87:	ff d0                	call   *%rax
+  802e89:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e8b:	85 c0                	test   %eax,%eax
+  802e8d:	78 06                	js     802e95 <getchar+0x2e>
+  802e8f:	74 08                	je     802e99 <getchar+0x32>
+  802e91:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e95:	89 d0                	mov    %edx,%eax
+  802e97:	c9                   	leave
+  802e98:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e99:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e9e:	eb f5                	jmp    802e95 <getchar+0x2e>
+
+0000000000802ea0 <iscons>:
+iscons(int fdnum) {
+  802ea0:	55                   	push   %rbp
+  802ea1:	48 89 e5             	mov    %rsp,%rbp
+  802ea4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ea8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802eac:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  802eb3:	00 00 00 
+  802eb6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802eb8:	85 c0                	test   %eax,%eax
+  802eba:	78 18                	js     802ed4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ebc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ec0:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802ec7:	00 00 00 
+  802eca:	8b 00                	mov    (%rax),%eax
+  802ecc:	39 02                	cmp    %eax,(%rdx)
+  802ece:	0f 94 c0             	sete   %al
+  802ed1:	0f b6 c0             	movzbl %al,%eax
+}
+  802ed4:	c9                   	leave
+  802ed5:	c3                   	ret
+
+0000000000802ed6 <opencons>:
+opencons(void) {
+  802ed6:	55                   	push   %rbp
+  802ed7:	48 89 e5             	mov    %rsp,%rbp
+  802eda:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ede:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ee2:	48 b8 e2 0c 80 00 00 	movabs $0x800ce2,%rax
+  802ee9:	00 00 00 
+  802eec:	ff d0                	call   *%rax
+  802eee:	85 c0                	test   %eax,%eax
+  802ef0:	78 49                	js     802f3b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ef2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ef7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802efc:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f00:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f05:	48 b8 9e 02 80 00 00 	movabs $0x80029e,%rax
+  802f0c:	00 00 00 
+  802f0f:	ff d0                	call   *%rax
+  802f11:	85 c0                	test   %eax,%eax
+  802f13:	78 26                	js     802f3b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f15:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f19:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802f20:	00 00 
+  802f22:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f24:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f28:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f2f:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  802f36:	00 00 00 
+  802f39:	ff d0                	call   *%rax
+}
+  802f3b:	c9                   	leave
+  802f3c:	c3                   	ret
+
+0000000000802f3d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f3d:	55                   	push   %rbp
+  802f3e:	48 89 e5             	mov    %rsp,%rbp
+  802f41:	41 56                	push   %r14
+  802f43:	41 55                	push   %r13
+  802f45:	41 54                	push   %r12
+  802f47:	53                   	push   %rbx
+  802f48:	48 83 ec 50          	sub    $0x50,%rsp
+  802f4c:	49 89 fc             	mov    %rdi,%r12
+  802f4f:	41 89 f5             	mov    %esi,%r13d
+  802f52:	48 89 d3             	mov    %rdx,%rbx
+  802f55:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802f59:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802f5d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f61:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802f68:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f6c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f70:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802f74:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f78:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  802f7f:	00 00 00 
+  802f82:	4c 8b 30             	mov    (%rax),%r14
+  802f85:	48 b8 de 01 80 00 00 	movabs $0x8001de,%rax
+  802f8c:	00 00 00 
+  802f8f:	ff d0                	call   *%rax
+  802f91:	89 c6                	mov    %eax,%esi
+  802f93:	45 89 e8             	mov    %r13d,%r8d
+  802f96:	4c 89 e1             	mov    %r12,%rcx
+  802f99:	4c 89 f2             	mov    %r14,%rdx
+  802f9c:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802fa3:	00 00 00 
+  802fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fab:	49 bc 8d 30 80 00 00 	movabs $0x80308d,%r12
+  802fb2:	00 00 00 
+  802fb5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802fb8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802fbc:	48 89 df             	mov    %rbx,%rdi
+  802fbf:	48 b8 29 30 80 00 00 	movabs $0x803029,%rax
+  802fc6:	00 00 00 
+  802fc9:	ff d0                	call   *%rax
+    cprintf("\n");
+  802fcb:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  802fd2:	00 00 00 
+  802fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fda:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802fdd:	cc                   	int3
+  802fde:	eb fd                	jmp    802fdd <_panic+0xa0>
+
+0000000000802fe0 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802fe0:	55                   	push   %rbp
+  802fe1:	48 89 e5             	mov    %rsp,%rbp
+  802fe4:	53                   	push   %rbx
+  802fe5:	48 83 ec 08          	sub    $0x8,%rsp
+  802fe9:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802fec:	8b 06                	mov    (%rsi),%eax
+  802fee:	8d 50 01             	lea    0x1(%rax),%edx
+  802ff1:	89 16                	mov    %edx,(%rsi)
+  802ff3:	48 98                	cltq
+  802ff5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802ffa:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803000:	74 0a                	je     80300c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803002:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803006:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80300a:	c9                   	leave
+  80300b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80300c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803010:	be ff 00 00 00       	mov    $0xff,%esi
+  803015:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  80301c:	00 00 00 
+  80301f:	ff d0                	call   *%rax
+        state->offset = 0;
+  803021:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803027:	eb d9                	jmp    803002 <putch+0x22>
+
+0000000000803029 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803029:	55                   	push   %rbp
+  80302a:	48 89 e5             	mov    %rsp,%rbp
+  80302d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803034:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803037:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80303e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803043:	b8 00 00 00 00       	mov    $0x0,%eax
+  803048:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80304b:	48 89 f1             	mov    %rsi,%rcx
+  80304e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803055:	48 bf e0 2f 80 00 00 	movabs $0x802fe0,%rdi
+  80305c:	00 00 00 
+  80305f:	48 b8 dd 31 80 00 00 	movabs $0x8031dd,%rax
+  803066:	00 00 00 
+  803069:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80306b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803072:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803079:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  803080:	00 00 00 
+  803083:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  803085:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80308b:	c9                   	leave
+  80308c:	c3                   	ret
+
+000000000080308d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80308d:	55                   	push   %rbp
+  80308e:	48 89 e5             	mov    %rsp,%rbp
+  803091:	48 83 ec 50          	sub    $0x50,%rsp
+  803095:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803099:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80309d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8030a1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8030a5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8030a9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8030b0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030b8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030bc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8030c0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8030c4:	48 b8 29 30 80 00 00 	movabs $0x803029,%rax
+  8030cb:	00 00 00 
+  8030ce:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8030d0:	c9                   	leave
+  8030d1:	c3                   	ret
+
+00000000008030d2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8030d2:	55                   	push   %rbp
+  8030d3:	48 89 e5             	mov    %rsp,%rbp
+  8030d6:	41 57                	push   %r15
+  8030d8:	41 56                	push   %r14
+  8030da:	41 55                	push   %r13
+  8030dc:	41 54                	push   %r12
+  8030de:	53                   	push   %rbx
+  8030df:	48 83 ec 18          	sub    $0x18,%rsp
+  8030e3:	49 89 fc             	mov    %rdi,%r12
+  8030e6:	49 89 f5             	mov    %rsi,%r13
+  8030e9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8030ed:	8b 45 10             	mov    0x10(%rbp),%eax
+  8030f0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8030f3:	41 89 cf             	mov    %ecx,%r15d
+  8030f6:	4c 39 fa             	cmp    %r15,%rdx
+  8030f9:	73 5b                	jae    803156 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8030fb:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8030ff:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803103:	85 db                	test   %ebx,%ebx
+  803105:	7e 0e                	jle    803115 <print_num+0x43>
+            putch(padc, put_arg);
+  803107:	4c 89 ee             	mov    %r13,%rsi
+  80310a:	44 89 f7             	mov    %r14d,%edi
+  80310d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803110:	83 eb 01             	sub    $0x1,%ebx
+  803113:	75 f2                	jne    803107 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803115:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803119:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  803120:	00 00 00 
+  803123:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  80312a:	00 00 00 
+  80312d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803131:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313a:	49 f7 f7             	div    %r15
+  80313d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803141:	4c 89 ee             	mov    %r13,%rsi
+  803144:	41 ff d4             	call   *%r12
+}
+  803147:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80314b:	5b                   	pop    %rbx
+  80314c:	41 5c                	pop    %r12
+  80314e:	41 5d                	pop    %r13
+  803150:	41 5e                	pop    %r14
+  803152:	41 5f                	pop    %r15
+  803154:	5d                   	pop    %rbp
+  803155:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803156:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80315a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80315f:	49 f7 f7             	div    %r15
+  803162:	48 83 ec 08          	sub    $0x8,%rsp
+  803166:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80316a:	52                   	push   %rdx
+  80316b:	45 0f be c9          	movsbl %r9b,%r9d
+  80316f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803173:	48 89 c2             	mov    %rax,%rdx
+  803176:	48 b8 d2 30 80 00 00 	movabs $0x8030d2,%rax
+  80317d:	00 00 00 
+  803180:	ff d0                	call   *%rax
+  803182:	48 83 c4 10          	add    $0x10,%rsp
+  803186:	eb 8d                	jmp    803115 <print_num+0x43>
+
+0000000000803188 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803188:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80318c:	48 8b 06             	mov    (%rsi),%rax
+  80318f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  803193:	73 0a                	jae    80319f <sprintputch+0x17>
+        *state->start++ = ch;
+  803195:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803199:	48 89 16             	mov    %rdx,(%rsi)
+  80319c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80319f:	c3                   	ret
+
+00000000008031a0 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8031a0:	55                   	push   %rbp
+  8031a1:	48 89 e5             	mov    %rsp,%rbp
+  8031a4:	48 83 ec 50          	sub    $0x50,%rsp
+  8031a8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8031ac:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8031b0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8031b4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8031bb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031c3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031c7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8031cb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8031cf:	48 b8 dd 31 80 00 00 	movabs $0x8031dd,%rax
+  8031d6:	00 00 00 
+  8031d9:	ff d0                	call   *%rax
+}
+  8031db:	c9                   	leave
+  8031dc:	c3                   	ret
+
+00000000008031dd <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8031dd:	55                   	push   %rbp
+  8031de:	48 89 e5             	mov    %rsp,%rbp
+  8031e1:	41 57                	push   %r15
+  8031e3:	41 56                	push   %r14
+  8031e5:	41 55                	push   %r13
+  8031e7:	41 54                	push   %r12
+  8031e9:	53                   	push   %rbx
+  8031ea:	48 83 ec 38          	sub    $0x38,%rsp
+  8031ee:	49 89 fe             	mov    %rdi,%r14
+  8031f1:	49 89 f5             	mov    %rsi,%r13
+  8031f4:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8031f7:	48 8b 01             	mov    (%rcx),%rax
+  8031fa:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031fe:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803202:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803206:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80320a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80320e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803212:	0f b6 3b             	movzbl (%rbx),%edi
+  803215:	40 80 ff 25          	cmp    $0x25,%dil
+  803219:	74 18                	je     803233 <vprintfmt+0x56>
+            if (!ch) return;
+  80321b:	40 84 ff             	test   %dil,%dil
+  80321e:	0f 84 04 07 00 00    	je     803928 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  803224:	40 0f b6 ff          	movzbl %dil,%edi
+  803228:	4c 89 ee             	mov    %r13,%rsi
+  80322b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80322e:	4c 89 e3             	mov    %r12,%rbx
+  803231:	eb db                	jmp    80320e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803233:	be 00 00 00 00       	mov    $0x0,%esi
+  803238:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80323c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803241:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803247:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80324e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803252:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803257:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80325c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80325f:	83 e8 23             	sub    $0x23,%eax
+  803262:	3c 57                	cmp    $0x57,%al
+  803264:	0f 87 a4 06 00 00    	ja     80390e <vprintfmt+0x731>
+  80326a:	0f b6 c0             	movzbl %al,%eax
+  80326d:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  803274:	00 00 00 
+  803277:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80327a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80327d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803281:	eb cf                	jmp    803252 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  803283:	49 89 dc             	mov    %rbx,%r12
+  803286:	be 01 00 00 00       	mov    $0x1,%esi
+  80328b:	eb c5                	jmp    803252 <vprintfmt+0x75>
+            padc = ch;
+  80328d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  803291:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803294:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803297:	eb b9                	jmp    803252 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803299:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80329c:	83 f8 2f             	cmp    $0x2f,%eax
+  80329f:	77 24                	ja     8032c5 <vprintfmt+0xe8>
+  8032a1:	89 c1                	mov    %eax,%ecx
+  8032a3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8032a7:	83 c0 08             	add    $0x8,%eax
+  8032aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032ad:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8032b0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8032b3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8032b7:	79 99                	jns    803252 <vprintfmt+0x75>
+                width = precision;
+  8032b9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8032bd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8032c3:	eb 8d                	jmp    803252 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032c5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032c9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8032cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032d1:	eb da                	jmp    8032ad <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8032d3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8032d8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032dc:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8032e2:	3c 39                	cmp    $0x39,%al
+  8032e4:	77 1c                	ja     803302 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8032e6:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8032ea:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8032ee:	0f b6 c0             	movzbl %al,%eax
+  8032f1:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032f6:	0f b6 03             	movzbl (%rbx),%eax
+  8032f9:	3c 39                	cmp    $0x39,%al
+  8032fb:	76 e9                	jbe    8032e6 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8032fd:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803300:	eb b1                	jmp    8032b3 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803302:	49 89 dc             	mov    %rbx,%r12
+  803305:	eb ac                	jmp    8032b3 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803307:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80330a:	85 c9                	test   %ecx,%ecx
+  80330c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803311:	0f 49 c1             	cmovns %ecx,%eax
+  803314:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803317:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80331a:	e9 33 ff ff ff       	jmp    803252 <vprintfmt+0x75>
+            lflag++;
+  80331f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803322:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803325:	e9 28 ff ff ff       	jmp    803252 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80332a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80332d:	83 f8 2f             	cmp    $0x2f,%eax
+  803330:	77 19                	ja     80334b <vprintfmt+0x16e>
+  803332:	89 c2                	mov    %eax,%edx
+  803334:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803338:	83 c0 08             	add    $0x8,%eax
+  80333b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80333e:	8b 3a                	mov    (%rdx),%edi
+  803340:	4c 89 ee             	mov    %r13,%rsi
+  803343:	41 ff d6             	call   *%r14
+            break;
+  803346:	e9 c3 fe ff ff       	jmp    80320e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80334b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80334f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803353:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803357:	eb e5                	jmp    80333e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803359:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80335c:	83 f8 2f             	cmp    $0x2f,%eax
+  80335f:	77 5a                	ja     8033bb <vprintfmt+0x1de>
+  803361:	89 c2                	mov    %eax,%edx
+  803363:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803367:	83 c0 08             	add    $0x8,%eax
+  80336a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80336d:	8b 02                	mov    (%rdx),%eax
+  80336f:	89 c1                	mov    %eax,%ecx
+  803371:	f7 d9                	neg    %ecx
+  803373:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803376:	83 f9 13             	cmp    $0x13,%ecx
+  803379:	7f 4e                	jg     8033c9 <vprintfmt+0x1ec>
+  80337b:	48 63 c1             	movslq %ecx,%rax
+  80337e:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  803385:	00 00 00 
+  803388:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80338c:	48 85 c0             	test   %rax,%rax
+  80338f:	74 38                	je     8033c9 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803391:	48 89 c1             	mov    %rax,%rcx
+  803394:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  80339b:	00 00 00 
+  80339e:	4c 89 ee             	mov    %r13,%rsi
+  8033a1:	4c 89 f7             	mov    %r14,%rdi
+  8033a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a9:	49 b8 a0 31 80 00 00 	movabs $0x8031a0,%r8
+  8033b0:	00 00 00 
+  8033b3:	41 ff d0             	call   *%r8
+  8033b6:	e9 53 fe ff ff       	jmp    80320e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8033bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033c7:	eb a4                	jmp    80336d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8033c9:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  8033d0:	00 00 00 
+  8033d3:	4c 89 ee             	mov    %r13,%rsi
+  8033d6:	4c 89 f7             	mov    %r14,%rdi
+  8033d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033de:	49 b8 a0 31 80 00 00 	movabs $0x8031a0,%r8
+  8033e5:	00 00 00 
+  8033e8:	41 ff d0             	call   *%r8
+  8033eb:	e9 1e fe ff ff       	jmp    80320e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8033f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8033f6:	77 36                	ja     80342e <vprintfmt+0x251>
+  8033f8:	89 c2                	mov    %eax,%edx
+  8033fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033fe:	83 c0 08             	add    $0x8,%eax
+  803401:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803404:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  803407:	48 85 f6             	test   %rsi,%rsi
+  80340a:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  803411:	00 00 00 
+  803414:	48 0f 45 c6          	cmovne %rsi,%rax
+  803418:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80341c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803420:	7e 06                	jle    803428 <vprintfmt+0x24b>
+  803422:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803426:	75 14                	jne    80343c <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803428:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80342c:	eb 5b                	jmp    803489 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80342e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803432:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803436:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80343a:	eb c8                	jmp    803404 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80343c:	49 63 f7             	movslq %r15d,%rsi
+  80343f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803443:	48 b8 e2 39 80 00 00 	movabs $0x8039e2,%rax
+  80344a:	00 00 00 
+  80344d:	ff d0                	call   *%rax
+  80344f:	48 89 c2             	mov    %rax,%rdx
+  803452:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803455:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803457:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80345a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80345d:	85 c0                	test   %eax,%eax
+  80345f:	7e c7                	jle    803428 <vprintfmt+0x24b>
+  803461:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803466:	4c 89 ee             	mov    %r13,%rsi
+  803469:	44 89 e7             	mov    %r12d,%edi
+  80346c:	41 ff d6             	call   *%r14
+  80346f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803473:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803476:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803479:	75 eb                	jne    803466 <vprintfmt+0x289>
+  80347b:	eb ab                	jmp    803428 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80347d:	0f b6 f8             	movzbl %al,%edi
+  803480:	4c 89 ee             	mov    %r13,%rsi
+  803483:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  803486:	4c 89 e2             	mov    %r12,%rdx
+  803489:	45 85 ff             	test   %r15d,%r15d
+  80348c:	78 06                	js     803494 <vprintfmt+0x2b7>
+  80348e:	41 83 ef 01          	sub    $0x1,%r15d
+  803492:	78 23                	js     8034b7 <vprintfmt+0x2da>
+  803494:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  803498:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80349e:	84 c0                	test   %al,%al
+  8034a0:	74 15                	je     8034b7 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8034a2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8034a6:	74 d5                	je     80347d <vprintfmt+0x2a0>
+  8034a8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8034ab:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8034b0:	80 fa 5e             	cmp    $0x5e,%dl
+  8034b3:	77 cb                	ja     803480 <vprintfmt+0x2a3>
+  8034b5:	eb c6                	jmp    80347d <vprintfmt+0x2a0>
+  8034b7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8034ba:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8034bd:	01 f0                	add    %esi,%eax
+  8034bf:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8034c1:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8034c5:	85 c0                	test   %eax,%eax
+  8034c7:	0f 8e 41 fd ff ff    	jle    80320e <vprintfmt+0x31>
+  8034cd:	4c 89 ee             	mov    %r13,%rsi
+  8034d0:	bf 20 00 00 00       	mov    $0x20,%edi
+  8034d5:	41 ff d6             	call   *%r14
+  8034d8:	41 83 ec 01          	sub    $0x1,%r12d
+  8034dc:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8034e0:	75 eb                	jne    8034cd <vprintfmt+0x2f0>
+  8034e2:	e9 27 fd ff ff       	jmp    80320e <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8034e7:	40 84 f6             	test   %sil,%sil
+  8034ea:	75 26                	jne    803512 <vprintfmt+0x335>
+    switch (lflag) {
+  8034ec:	85 d2                	test   %edx,%edx
+  8034ee:	74 59                	je     803549 <vprintfmt+0x36c>
+  8034f0:	83 fa 01             	cmp    $0x1,%edx
+  8034f3:	74 7b                	je     803570 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8034f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8034fb:	0f 87 96 00 00 00    	ja     803597 <vprintfmt+0x3ba>
+  803501:	89 c2                	mov    %eax,%edx
+  803503:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803507:	83 c0 08             	add    $0x8,%eax
+  80350a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80350d:	4c 8b 22             	mov    (%rdx),%r12
+  803510:	eb 17                	jmp    803529 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  803512:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803515:	83 f8 2f             	cmp    $0x2f,%eax
+  803518:	77 21                	ja     80353b <vprintfmt+0x35e>
+  80351a:	89 c2                	mov    %eax,%edx
+  80351c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803520:	83 c0 08             	add    $0x8,%eax
+  803523:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803526:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803529:	4d 85 e4             	test   %r12,%r12
+  80352c:	78 7a                	js     8035a8 <vprintfmt+0x3cb>
+            num = i;
+  80352e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803531:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803536:	e9 b5 02 00 00       	jmp    8037f0 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80353b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80353f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803543:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803547:	eb dd                	jmp    803526 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  803549:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80354c:	83 f8 2f             	cmp    $0x2f,%eax
+  80354f:	77 11                	ja     803562 <vprintfmt+0x385>
+  803551:	89 c2                	mov    %eax,%edx
+  803553:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803557:	83 c0 08             	add    $0x8,%eax
+  80355a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80355d:	4c 63 22             	movslq (%rdx),%r12
+  803560:	eb c7                	jmp    803529 <vprintfmt+0x34c>
+  803562:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803566:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80356a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80356e:	eb ed                	jmp    80355d <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  803570:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803573:	83 f8 2f             	cmp    $0x2f,%eax
+  803576:	77 11                	ja     803589 <vprintfmt+0x3ac>
+  803578:	89 c2                	mov    %eax,%edx
+  80357a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80357e:	83 c0 08             	add    $0x8,%eax
+  803581:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803584:	4c 8b 22             	mov    (%rdx),%r12
+  803587:	eb a0                	jmp    803529 <vprintfmt+0x34c>
+  803589:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80358d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803591:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803595:	eb ed                	jmp    803584 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  803597:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80359b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80359f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035a3:	e9 65 ff ff ff       	jmp    80350d <vprintfmt+0x330>
+                putch('-', put_arg);
+  8035a8:	4c 89 ee             	mov    %r13,%rsi
+  8035ab:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8035b0:	41 ff d6             	call   *%r14
+                i = -i;
+  8035b3:	49 f7 dc             	neg    %r12
+  8035b6:	e9 73 ff ff ff       	jmp    80352e <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8035bb:	40 84 f6             	test   %sil,%sil
+  8035be:	75 32                	jne    8035f2 <vprintfmt+0x415>
+    switch (lflag) {
+  8035c0:	85 d2                	test   %edx,%edx
+  8035c2:	74 5d                	je     803621 <vprintfmt+0x444>
+  8035c4:	83 fa 01             	cmp    $0x1,%edx
+  8035c7:	0f 84 82 00 00 00    	je     80364f <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8035cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8035d3:	0f 87 a5 00 00 00    	ja     80367e <vprintfmt+0x4a1>
+  8035d9:	89 c2                	mov    %eax,%edx
+  8035db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035df:	83 c0 08             	add    $0x8,%eax
+  8035e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035e5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035e8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8035ed:	e9 fe 01 00 00       	jmp    8037f0 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8035f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8035f8:	77 19                	ja     803613 <vprintfmt+0x436>
+  8035fa:	89 c2                	mov    %eax,%edx
+  8035fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803600:	83 c0 08             	add    $0x8,%eax
+  803603:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803606:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803609:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80360e:	e9 dd 01 00 00       	jmp    8037f0 <vprintfmt+0x613>
+  803613:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803617:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80361b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80361f:	eb e5                	jmp    803606 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  803621:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803624:	83 f8 2f             	cmp    $0x2f,%eax
+  803627:	77 18                	ja     803641 <vprintfmt+0x464>
+  803629:	89 c2                	mov    %eax,%edx
+  80362b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80362f:	83 c0 08             	add    $0x8,%eax
+  803632:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803635:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803637:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80363c:	e9 af 01 00 00       	jmp    8037f0 <vprintfmt+0x613>
+  803641:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803645:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803649:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80364d:	eb e6                	jmp    803635 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80364f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803652:	83 f8 2f             	cmp    $0x2f,%eax
+  803655:	77 19                	ja     803670 <vprintfmt+0x493>
+  803657:	89 c2                	mov    %eax,%edx
+  803659:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80365d:	83 c0 08             	add    $0x8,%eax
+  803660:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803663:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803666:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80366b:	e9 80 01 00 00       	jmp    8037f0 <vprintfmt+0x613>
+  803670:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803674:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803678:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80367c:	eb e5                	jmp    803663 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80367e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803682:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803686:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80368a:	e9 56 ff ff ff       	jmp    8035e5 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80368f:	40 84 f6             	test   %sil,%sil
+  803692:	75 2e                	jne    8036c2 <vprintfmt+0x4e5>
+    switch (lflag) {
+  803694:	85 d2                	test   %edx,%edx
+  803696:	0f 84 b3 00 00 00    	je     80374f <vprintfmt+0x572>
+  80369c:	83 fa 01             	cmp    $0x1,%edx
+  80369f:	0f 84 d3 00 00 00    	je     803778 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8036a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8036ab:	0f 87 f1 00 00 00    	ja     8037a2 <vprintfmt+0x5c5>
+  8036b1:	89 c2                	mov    %eax,%edx
+  8036b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036b7:	83 c0 08             	add    $0x8,%eax
+  8036ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036bd:	48 8b 02             	mov    (%rdx),%rax
+  8036c0:	eb 17                	jmp    8036d9 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8036c8:	77 77                	ja     803741 <vprintfmt+0x564>
+  8036ca:	89 c2                	mov    %eax,%edx
+  8036cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036d0:	83 c0 08             	add    $0x8,%eax
+  8036d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036d6:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8036d9:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036db:	83 f8 07             	cmp    $0x7,%eax
+  8036de:	0f 8e cf 00 00 00    	jle    8037b3 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8036e4:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036ea:	44 89 e7             	mov    %r12d,%edi
+  8036ed:	41 c1 e4 03          	shl    $0x3,%r12d
+  8036f1:	89 d1                	mov    %edx,%ecx
+  8036f3:	8d 72 07             	lea    0x7(%rdx),%esi
+  8036f6:	85 d2                	test   %edx,%edx
+  8036f8:	0f 48 d6             	cmovs  %esi,%edx
+  8036fb:	c1 fa 03             	sar    $0x3,%edx
+  8036fe:	83 f9 3f             	cmp    $0x3f,%ecx
+  803701:	7f e7                	jg     8036ea <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  803703:	85 ff                	test   %edi,%edi
+  803705:	0f 84 03 fb ff ff    	je     80320e <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  80370b:	49 63 f4             	movslq %r12d,%rsi
+  80370e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803713:	48 f7 f6             	div    %rsi
+  803716:	49 89 d7             	mov    %rdx,%r15
+  803719:	83 c0 30             	add    $0x30,%eax
+  80371c:	0f be f8             	movsbl %al,%edi
+  80371f:	4c 89 ee             	mov    %r13,%rsi
+  803722:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  803725:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  803728:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  80372d:	45 85 e4             	test   %r12d,%r12d
+  803730:	41 0f 49 d4          	cmovns %r12d,%edx
+  803734:	c1 fa 03             	sar    $0x3,%edx
+  803737:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  80373a:	75 cf                	jne    80370b <vprintfmt+0x52e>
+  80373c:	e9 cd fa ff ff       	jmp    80320e <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  803741:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803745:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803749:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80374d:	eb 87                	jmp    8036d6 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80374f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803752:	83 f8 2f             	cmp    $0x2f,%eax
+  803755:	77 13                	ja     80376a <vprintfmt+0x58d>
+  803757:	89 c2                	mov    %eax,%edx
+  803759:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80375d:	83 c0 08             	add    $0x8,%eax
+  803760:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803763:	8b 02                	mov    (%rdx),%eax
+  803765:	e9 6f ff ff ff       	jmp    8036d9 <vprintfmt+0x4fc>
+  80376a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80376e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803772:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803776:	eb eb                	jmp    803763 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  803778:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80377b:	83 f8 2f             	cmp    $0x2f,%eax
+  80377e:	77 14                	ja     803794 <vprintfmt+0x5b7>
+  803780:	89 c2                	mov    %eax,%edx
+  803782:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803786:	83 c0 08             	add    $0x8,%eax
+  803789:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80378c:	48 8b 02             	mov    (%rdx),%rax
+  80378f:	e9 45 ff ff ff       	jmp    8036d9 <vprintfmt+0x4fc>
+  803794:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803798:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80379c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037a0:	eb ea                	jmp    80378c <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8037a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037ae:	e9 0a ff ff ff       	jmp    8036bd <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8037b3:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8037b9:	e9 4d ff ff ff       	jmp    80370b <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8037be:	4c 89 ee             	mov    %r13,%rsi
+  8037c1:	bf 30 00 00 00       	mov    $0x30,%edi
+  8037c6:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8037c9:	4c 89 ee             	mov    %r13,%rsi
+  8037cc:	bf 78 00 00 00       	mov    $0x78,%edi
+  8037d1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8037d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8037da:	77 47                	ja     803823 <vprintfmt+0x646>
+  8037dc:	89 c2                	mov    %eax,%edx
+  8037de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037e2:	83 c0 08             	add    $0x8,%eax
+  8037e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037e8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8037eb:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8037f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8037f4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8037f8:	0f 94 c0             	sete   %al
+  8037fb:	0f b6 c0             	movzbl %al,%eax
+  8037fe:	50                   	push   %rax
+  8037ff:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803804:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803808:	4c 89 ee             	mov    %r13,%rsi
+  80380b:	4c 89 f7             	mov    %r14,%rdi
+  80380e:	48 b8 d2 30 80 00 00 	movabs $0x8030d2,%rax
+  803815:	00 00 00 
+  803818:	ff d0                	call   *%rax
+            break;
+  80381a:	48 83 c4 10          	add    $0x10,%rsp
+  80381e:	e9 eb f9 ff ff       	jmp    80320e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803823:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803827:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80382b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80382f:	eb b7                	jmp    8037e8 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  803831:	40 84 f6             	test   %sil,%sil
+  803834:	75 2b                	jne    803861 <vprintfmt+0x684>
+    switch (lflag) {
+  803836:	85 d2                	test   %edx,%edx
+  803838:	74 56                	je     803890 <vprintfmt+0x6b3>
+  80383a:	83 fa 01             	cmp    $0x1,%edx
+  80383d:	74 7f                	je     8038be <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  80383f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803842:	83 f8 2f             	cmp    $0x2f,%eax
+  803845:	0f 87 a2 00 00 00    	ja     8038ed <vprintfmt+0x710>
+  80384b:	89 c2                	mov    %eax,%edx
+  80384d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803851:	83 c0 08             	add    $0x8,%eax
+  803854:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803857:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80385a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80385f:	eb 8f                	jmp    8037f0 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803861:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803864:	83 f8 2f             	cmp    $0x2f,%eax
+  803867:	77 19                	ja     803882 <vprintfmt+0x6a5>
+  803869:	89 c2                	mov    %eax,%edx
+  80386b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80386f:	83 c0 08             	add    $0x8,%eax
+  803872:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803875:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803878:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80387d:	e9 6e ff ff ff       	jmp    8037f0 <vprintfmt+0x613>
+  803882:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803886:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80388a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80388e:	eb e5                	jmp    803875 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  803890:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803893:	83 f8 2f             	cmp    $0x2f,%eax
+  803896:	77 18                	ja     8038b0 <vprintfmt+0x6d3>
+  803898:	89 c2                	mov    %eax,%edx
+  80389a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80389e:	83 c0 08             	add    $0x8,%eax
+  8038a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038a4:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8038a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8038ab:	e9 40 ff ff ff       	jmp    8037f0 <vprintfmt+0x613>
+  8038b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038bc:	eb e6                	jmp    8038a4 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8038be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8038c4:	77 19                	ja     8038df <vprintfmt+0x702>
+  8038c6:	89 c2                	mov    %eax,%edx
+  8038c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038cc:	83 c0 08             	add    $0x8,%eax
+  8038cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038d2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038d5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8038da:	e9 11 ff ff ff       	jmp    8037f0 <vprintfmt+0x613>
+  8038df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038eb:	eb e5                	jmp    8038d2 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  8038ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038f9:	e9 59 ff ff ff       	jmp    803857 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8038fe:	4c 89 ee             	mov    %r13,%rsi
+  803901:	bf 25 00 00 00       	mov    $0x25,%edi
+  803906:	41 ff d6             	call   *%r14
+            break;
+  803909:	e9 00 f9 ff ff       	jmp    80320e <vprintfmt+0x31>
+            putch('%', put_arg);
+  80390e:	4c 89 ee             	mov    %r13,%rsi
+  803911:	bf 25 00 00 00       	mov    $0x25,%edi
+  803916:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803919:	48 83 eb 01          	sub    $0x1,%rbx
+  80391d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803921:	75 f6                	jne    803919 <vprintfmt+0x73c>
+  803923:	e9 e6 f8 ff ff       	jmp    80320e <vprintfmt+0x31>
+}
+  803928:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80392c:	5b                   	pop    %rbx
+  80392d:	41 5c                	pop    %r12
+  80392f:	41 5d                	pop    %r13
+  803931:	41 5e                	pop    %r14
+  803933:	41 5f                	pop    %r15
+  803935:	5d                   	pop    %rbp
+  803936:	c3                   	ret
+
+0000000000803937 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803937:	55                   	push   %rbp
+  803938:	48 89 e5             	mov    %rsp,%rbp
+  80393b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80393f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803943:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803948:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80394c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803953:	48 85 ff             	test   %rdi,%rdi
+  803956:	74 2b                	je     803983 <vsnprintf+0x4c>
+  803958:	48 85 f6             	test   %rsi,%rsi
+  80395b:	74 26                	je     803983 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80395d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803961:	48 bf 88 31 80 00 00 	movabs $0x803188,%rdi
+  803968:	00 00 00 
+  80396b:	48 b8 dd 31 80 00 00 	movabs $0x8031dd,%rax
+  803972:	00 00 00 
+  803975:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803977:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80397b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80397e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803981:	c9                   	leave
+  803982:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803983:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803988:	eb f7                	jmp    803981 <vsnprintf+0x4a>
+
+000000000080398a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80398a:	55                   	push   %rbp
+  80398b:	48 89 e5             	mov    %rsp,%rbp
+  80398e:	48 83 ec 50          	sub    $0x50,%rsp
+  803992:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803996:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80399a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80399e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8039a5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8039a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039ad:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8039b1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8039b5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8039b9:	48 b8 37 39 80 00 00 	movabs $0x803937,%rax
+  8039c0:	00 00 00 
+  8039c3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8039c5:	c9                   	leave
+  8039c6:	c3                   	ret
+
+00000000008039c7 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8039c7:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8039ca:	74 10                	je     8039dc <strlen+0x15>
+    size_t n = 0;
+  8039cc:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8039d1:	48 83 c0 01          	add    $0x1,%rax
+  8039d5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8039d9:	75 f6                	jne    8039d1 <strlen+0xa>
+  8039db:	c3                   	ret
+    size_t n = 0;
+  8039dc:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8039e1:	c3                   	ret
+
+00000000008039e2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8039e2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8039e5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8039ea:	48 85 f6             	test   %rsi,%rsi
+  8039ed:	74 11                	je     803a00 <strnlen+0x1e>
+  8039ef:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8039f3:	74 0c                	je     803a01 <strnlen+0x1f>
+  8039f5:	48 83 c2 01          	add    $0x1,%rdx
+  8039f9:	48 39 d0             	cmp    %rdx,%rax
+  8039fc:	75 f1                	jne    8039ef <strnlen+0xd>
+  8039fe:	eb 04                	jmp    803a04 <strnlen+0x22>
+  803a00:	c3                   	ret
+  803a01:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803a04:	c3                   	ret
+
+0000000000803a05 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803a05:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803a08:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a0d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803a11:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803a14:	48 83 c2 01          	add    $0x1,%rdx
+  803a18:	84 c9                	test   %cl,%cl
+  803a1a:	75 f1                	jne    803a0d <strcpy+0x8>
+        ;
+    return res;
+}
+  803a1c:	c3                   	ret
+
+0000000000803a1d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803a1d:	55                   	push   %rbp
+  803a1e:	48 89 e5             	mov    %rsp,%rbp
+  803a21:	41 54                	push   %r12
+  803a23:	53                   	push   %rbx
+  803a24:	48 89 fb             	mov    %rdi,%rbx
+  803a27:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a2a:	48 b8 c7 39 80 00 00 	movabs $0x8039c7,%rax
+  803a31:	00 00 00 
+  803a34:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a36:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a3a:	4c 89 e6             	mov    %r12,%rsi
+  803a3d:	48 b8 05 3a 80 00 00 	movabs $0x803a05,%rax
+  803a44:	00 00 00 
+  803a47:	ff d0                	call   *%rax
+    return dst;
+}
+  803a49:	48 89 d8             	mov    %rbx,%rax
+  803a4c:	5b                   	pop    %rbx
+  803a4d:	41 5c                	pop    %r12
+  803a4f:	5d                   	pop    %rbp
+  803a50:	c3                   	ret
+
+0000000000803a51 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803a51:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803a54:	48 85 d2             	test   %rdx,%rdx
+  803a57:	74 1f                	je     803a78 <strncpy+0x27>
+  803a59:	48 01 fa             	add    %rdi,%rdx
+  803a5c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803a5f:	48 83 c1 01          	add    $0x1,%rcx
+  803a63:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803a67:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803a6b:	41 80 f8 01          	cmp    $0x1,%r8b
+  803a6f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803a73:	48 39 ca             	cmp    %rcx,%rdx
+  803a76:	75 e7                	jne    803a5f <strncpy+0xe>
+    }
+    return ret;
+}
+  803a78:	c3                   	ret
+
+0000000000803a79 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803a79:	48 89 f8             	mov    %rdi,%rax
+  803a7c:	48 85 d2             	test   %rdx,%rdx
+  803a7f:	74 24                	je     803aa5 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803a81:	48 83 ea 01          	sub    $0x1,%rdx
+  803a85:	74 1b                	je     803aa2 <strlcpy+0x29>
+  803a87:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803a8b:	0f b6 16             	movzbl (%rsi),%edx
+  803a8e:	84 d2                	test   %dl,%dl
+  803a90:	74 10                	je     803aa2 <strlcpy+0x29>
+            *dst++ = *src++;
+  803a92:	48 83 c6 01          	add    $0x1,%rsi
+  803a96:	48 83 c0 01          	add    $0x1,%rax
+  803a9a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803a9d:	48 39 c8             	cmp    %rcx,%rax
+  803aa0:	75 e9                	jne    803a8b <strlcpy+0x12>
+        *dst = '\0';
+  803aa2:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803aa5:	48 29 f8             	sub    %rdi,%rax
+}
+  803aa8:	c3                   	ret
+
+0000000000803aa9 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803aa9:	0f b6 07             	movzbl (%rdi),%eax
+  803aac:	84 c0                	test   %al,%al
+  803aae:	74 13                	je     803ac3 <strcmp+0x1a>
+  803ab0:	38 06                	cmp    %al,(%rsi)
+  803ab2:	75 0f                	jne    803ac3 <strcmp+0x1a>
+  803ab4:	48 83 c7 01          	add    $0x1,%rdi
+  803ab8:	48 83 c6 01          	add    $0x1,%rsi
+  803abc:	0f b6 07             	movzbl (%rdi),%eax
+  803abf:	84 c0                	test   %al,%al
+  803ac1:	75 ed                	jne    803ab0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ac3:	0f b6 c0             	movzbl %al,%eax
+  803ac6:	0f b6 16             	movzbl (%rsi),%edx
+  803ac9:	29 d0                	sub    %edx,%eax
+}
+  803acb:	c3                   	ret
+
+0000000000803acc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803acc:	48 85 d2             	test   %rdx,%rdx
+  803acf:	74 1f                	je     803af0 <strncmp+0x24>
+  803ad1:	0f b6 07             	movzbl (%rdi),%eax
+  803ad4:	84 c0                	test   %al,%al
+  803ad6:	74 1e                	je     803af6 <strncmp+0x2a>
+  803ad8:	3a 06                	cmp    (%rsi),%al
+  803ada:	75 1a                	jne    803af6 <strncmp+0x2a>
+  803adc:	48 83 c7 01          	add    $0x1,%rdi
+  803ae0:	48 83 c6 01          	add    $0x1,%rsi
+  803ae4:	48 83 ea 01          	sub    $0x1,%rdx
+  803ae8:	75 e7                	jne    803ad1 <strncmp+0x5>
+
+    if (!n) return 0;
+  803aea:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aef:	c3                   	ret
+  803af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af5:	c3                   	ret
+  803af6:	48 85 d2             	test   %rdx,%rdx
+  803af9:	74 09                	je     803b04 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803afb:	0f b6 07             	movzbl (%rdi),%eax
+  803afe:	0f b6 16             	movzbl (%rsi),%edx
+  803b01:	29 d0                	sub    %edx,%eax
+  803b03:	c3                   	ret
+    if (!n) return 0;
+  803b04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b09:	c3                   	ret
+
+0000000000803b0a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803b0a:	0f b6 17             	movzbl (%rdi),%edx
+  803b0d:	84 d2                	test   %dl,%dl
+  803b0f:	74 18                	je     803b29 <strchr+0x1f>
+        if (*str == c) {
+  803b11:	0f be d2             	movsbl %dl,%edx
+  803b14:	39 f2                	cmp    %esi,%edx
+  803b16:	74 17                	je     803b2f <strchr+0x25>
+    for (; *str; str++) {
+  803b18:	48 83 c7 01          	add    $0x1,%rdi
+  803b1c:	0f b6 17             	movzbl (%rdi),%edx
+  803b1f:	84 d2                	test   %dl,%dl
+  803b21:	75 ee                	jne    803b11 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b28:	c3                   	ret
+  803b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2e:	c3                   	ret
+  803b2f:	48 89 f8             	mov    %rdi,%rax
+}
+  803b32:	c3                   	ret
+
+0000000000803b33 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b33:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b36:	0f b6 17             	movzbl (%rdi),%edx
+  803b39:	84 d2                	test   %dl,%dl
+  803b3b:	74 13                	je     803b50 <strfind+0x1d>
+  803b3d:	0f be d2             	movsbl %dl,%edx
+  803b40:	39 f2                	cmp    %esi,%edx
+  803b42:	74 0b                	je     803b4f <strfind+0x1c>
+  803b44:	48 83 c0 01          	add    $0x1,%rax
+  803b48:	0f b6 10             	movzbl (%rax),%edx
+  803b4b:	84 d2                	test   %dl,%dl
+  803b4d:	75 ee                	jne    803b3d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803b4f:	c3                   	ret
+  803b50:	c3                   	ret
+
+0000000000803b51 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803b51:	55                   	push   %rbp
+  803b52:	48 89 e5             	mov    %rsp,%rbp
+  803b55:	41 57                	push   %r15
+  803b57:	41 56                	push   %r14
+  803b59:	41 55                	push   %r13
+  803b5b:	41 54                	push   %r12
+  803b5d:	53                   	push   %rbx
+  803b5e:	48 83 ec 08          	sub    $0x8,%rsp
+  803b62:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803b65:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803b69:	45 84 ed             	test   %r13b,%r13b
+  803b6c:	75 12                	jne    803b80 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803b6e:	4c 89 f8             	mov    %r15,%rax
+  803b71:	48 83 c4 08          	add    $0x8,%rsp
+  803b75:	5b                   	pop    %rbx
+  803b76:	41 5c                	pop    %r12
+  803b78:	41 5d                	pop    %r13
+  803b7a:	41 5e                	pop    %r14
+  803b7c:	41 5f                	pop    %r15
+  803b7e:	5d                   	pop    %rbp
+  803b7f:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803b80:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803b84:	4c 89 e7             	mov    %r12,%rdi
+  803b87:	48 b8 c7 39 80 00 00 	movabs $0x8039c7,%rax
+  803b8e:	00 00 00 
+  803b91:	ff d0                	call   *%rax
+  803b93:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803b96:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803b9a:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803b9e:	49 bf cc 3a 80 00 00 	movabs $0x803acc,%r15
+  803ba5:	00 00 00 
+				if ((sc = *s++) == 0)
+  803ba8:	84 c0                	test   %al,%al
+  803baa:	75 14                	jne    803bc0 <strstr+0x6f>
+					return NULL;
+  803bac:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bb2:	eb ba                	jmp    803b6e <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803bb4:	48 83 c3 01          	add    $0x1,%rbx
+  803bb8:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803bbc:	84 c0                	test   %al,%al
+  803bbe:	74 1b                	je     803bdb <strstr+0x8a>
+			} while (sc != c);
+  803bc0:	41 38 c5             	cmp    %al,%r13b
+  803bc3:	75 ef                	jne    803bb4 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803bc5:	4c 89 f2             	mov    %r14,%rdx
+  803bc8:	4c 89 e6             	mov    %r12,%rsi
+  803bcb:	48 89 df             	mov    %rbx,%rdi
+  803bce:	41 ff d7             	call   *%r15
+  803bd1:	85 c0                	test   %eax,%eax
+  803bd3:	75 df                	jne    803bb4 <strstr+0x63>
+  803bd5:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803bd9:	eb 93                	jmp    803b6e <strstr+0x1d>
+					return NULL;
+  803bdb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803be1:	eb 8b                	jmp    803b6e <strstr+0x1d>
+
+0000000000803be3 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803be3:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803be5:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803be8:	8d 57 20             	lea    0x20(%rdi),%edx
+  803beb:	83 f9 1a             	cmp    $0x1a,%ecx
+  803bee:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803bf1:	c3                   	ret
+
+0000000000803bf2 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803bf2:	55                   	push   %rbp
+  803bf3:	48 89 e5             	mov    %rsp,%rbp
+  803bf6:	41 57                	push   %r15
+  803bf8:	41 56                	push   %r14
+  803bfa:	41 55                	push   %r13
+  803bfc:	41 54                	push   %r12
+  803bfe:	53                   	push   %rbx
+  803bff:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803c03:	48 39 f7             	cmp    %rsi,%rdi
+  803c06:	74 49                	je     803c51 <strcasecmp+0x5f>
+  803c08:	49 89 fd             	mov    %rdi,%r13
+  803c0b:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803c0e:	49 bf e3 3b 80 00 00 	movabs $0x803be3,%r15
+  803c15:	00 00 00 
+  803c18:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803c1d:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c21:	41 ff d7             	call   *%r15
+  803c24:	89 c3                	mov    %eax,%ebx
+  803c26:	49 83 c4 01          	add    $0x1,%r12
+  803c2a:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c30:	41 ff d7             	call   *%r15
+  803c33:	29 c3                	sub    %eax,%ebx
+  803c35:	75 09                	jne    803c40 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c37:	49 83 c5 01          	add    $0x1,%r13
+  803c3b:	45 84 f6             	test   %r14b,%r14b
+  803c3e:	75 d8                	jne    803c18 <strcasecmp+0x26>
+}
+  803c40:	89 d8                	mov    %ebx,%eax
+  803c42:	48 83 c4 08          	add    $0x8,%rsp
+  803c46:	5b                   	pop    %rbx
+  803c47:	41 5c                	pop    %r12
+  803c49:	41 5d                	pop    %r13
+  803c4b:	41 5e                	pop    %r14
+  803c4d:	41 5f                	pop    %r15
+  803c4f:	5d                   	pop    %rbp
+  803c50:	c3                   	ret
+        return 0;
+  803c51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c56:	eb e8                	jmp    803c40 <strcasecmp+0x4e>
+
+0000000000803c58 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c58:	55                   	push   %rbp
+  803c59:	48 89 e5             	mov    %rsp,%rbp
+  803c5c:	41 57                	push   %r15
+  803c5e:	41 56                	push   %r14
+  803c60:	41 55                	push   %r13
+  803c62:	41 54                	push   %r12
+  803c64:	53                   	push   %rbx
+  803c65:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803c69:	48 85 d2             	test   %rdx,%rdx
+  803c6c:	74 4f                	je     803cbd <strncasecmp+0x65>
+  803c6e:	49 89 fc             	mov    %rdi,%r12
+  803c71:	49 89 f5             	mov    %rsi,%r13
+  803c74:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803c78:	49 be e3 3b 80 00 00 	movabs $0x803be3,%r14
+  803c7f:	00 00 00 
+  803c82:	49 83 c4 01          	add    $0x1,%r12
+  803c86:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c8c:	41 ff d6             	call   *%r14
+  803c8f:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803c91:	49 83 c5 01          	add    $0x1,%r13
+  803c95:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803c9a:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803c9d:	29 c3                	sub    %eax,%ebx
+  803c9f:	85 c0                	test   %eax,%eax
+  803ca1:	74 09                	je     803cac <strncasecmp+0x54>
+  803ca3:	85 db                	test   %ebx,%ebx
+  803ca5:	75 05                	jne    803cac <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803ca7:	4d 39 fc             	cmp    %r15,%r12
+  803caa:	75 d6                	jne    803c82 <strncasecmp+0x2a>
+}
+  803cac:	89 d8                	mov    %ebx,%eax
+  803cae:	48 83 c4 08          	add    $0x8,%rsp
+  803cb2:	5b                   	pop    %rbx
+  803cb3:	41 5c                	pop    %r12
+  803cb5:	41 5d                	pop    %r13
+  803cb7:	41 5e                	pop    %r14
+  803cb9:	41 5f                	pop    %r15
+  803cbb:	5d                   	pop    %rbp
+  803cbc:	c3                   	ret
+    int d = 0;
+  803cbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803cc2:	eb e8                	jmp    803cac <strncasecmp+0x54>
+
+0000000000803cc4 <toupper>:
+
+int toupper(int c) {
+  803cc4:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803cc6:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803cc9:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803ccc:	83 f9 1a             	cmp    $0x1a,%ecx
+  803ccf:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803cd2:	c3                   	ret
+
+0000000000803cd3 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803cd3:	83 ff 20             	cmp    $0x20,%edi
+  803cd6:	0f 94 c0             	sete   %al
+  803cd9:	0f b6 c0             	movzbl %al,%eax
+}
+  803cdc:	c3                   	ret
+
+0000000000803cdd <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803cdd:	89 f8                	mov    %edi,%eax
+  803cdf:	f7 d8                	neg    %eax
+  803ce1:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803ce4:	c3                   	ret
+
+0000000000803ce5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803ce5:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803ce8:	48 89 f8             	mov    %rdi,%rax
+  803ceb:	48 f7 d8             	neg    %rax
+  803cee:	83 e0 07             	and    $0x7,%eax
+  803cf1:	49 89 d1             	mov    %rdx,%r9
+  803cf4:	49 29 c1             	sub    %rax,%r9
+  803cf7:	78 36                	js     803d2f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803cf9:	40 0f b6 c6          	movzbl %sil,%eax
+  803cfd:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803d04:	01 01 01 
+  803d07:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803d0b:	40 f6 c7 07          	test   $0x7,%dil
+  803d0f:	75 38                	jne    803d49 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803d11:	4c 89 c9             	mov    %r9,%rcx
+  803d14:	48 c1 f9 03          	sar    $0x3,%rcx
+  803d18:	74 0c                	je     803d26 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803d1a:	fc                   	cld
+  803d1b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803d1e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d22:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d26:	4d 85 c9             	test   %r9,%r9
+  803d29:	75 45                	jne    803d70 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d2b:	4c 89 c0             	mov    %r8,%rax
+  803d2e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d2f:	48 85 d2             	test   %rdx,%rdx
+  803d32:	74 f7                	je     803d2b <memset+0x46>
+  803d34:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d37:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d3a:	48 83 c0 01          	add    $0x1,%rax
+  803d3e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d42:	48 39 c2             	cmp    %rax,%rdx
+  803d45:	75 f3                	jne    803d3a <memset+0x55>
+  803d47:	eb e2                	jmp    803d2b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d49:	40 f6 c7 01          	test   $0x1,%dil
+  803d4d:	74 06                	je     803d55 <memset+0x70>
+  803d4f:	88 07                	mov    %al,(%rdi)
+  803d51:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d55:	40 f6 c7 02          	test   $0x2,%dil
+  803d59:	74 07                	je     803d62 <memset+0x7d>
+  803d5b:	66 89 07             	mov    %ax,(%rdi)
+  803d5e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d62:	40 f6 c7 04          	test   $0x4,%dil
+  803d66:	74 a9                	je     803d11 <memset+0x2c>
+  803d68:	89 07                	mov    %eax,(%rdi)
+  803d6a:	48 83 c7 04          	add    $0x4,%rdi
+  803d6e:	eb a1                	jmp    803d11 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d70:	41 f6 c1 04          	test   $0x4,%r9b
+  803d74:	74 06                	je     803d7c <memset+0x97>
+  803d76:	89 07                	mov    %eax,(%rdi)
+  803d78:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d7c:	41 f6 c1 02          	test   $0x2,%r9b
+  803d80:	74 07                	je     803d89 <memset+0xa4>
+  803d82:	66 89 07             	mov    %ax,(%rdi)
+  803d85:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803d89:	41 f6 c1 01          	test   $0x1,%r9b
+  803d8d:	74 9c                	je     803d2b <memset+0x46>
+  803d8f:	88 07                	mov    %al,(%rdi)
+  803d91:	eb 98                	jmp    803d2b <memset+0x46>
+
+0000000000803d93 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803d93:	48 89 f8             	mov    %rdi,%rax
+  803d96:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803d99:	48 39 fe             	cmp    %rdi,%rsi
+  803d9c:	73 3b                	jae    803dd9 <memmove+0x46>
+  803d9e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803da2:	48 39 d7             	cmp    %rdx,%rdi
+  803da5:	73 32                	jae    803dd9 <memmove+0x46>
+        s += n;
+        d += n;
+  803da7:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803dab:	48 89 d6             	mov    %rdx,%rsi
+  803dae:	48 09 fe             	or     %rdi,%rsi
+  803db1:	48 09 ce             	or     %rcx,%rsi
+  803db4:	40 f6 c6 07          	test   $0x7,%sil
+  803db8:	75 12                	jne    803dcc <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803dba:	48 83 ef 08          	sub    $0x8,%rdi
+  803dbe:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803dc2:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dc6:	fd                   	std
+  803dc7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803dca:	fc                   	cld
+  803dcb:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803dcc:	48 83 ef 01          	sub    $0x1,%rdi
+  803dd0:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803dd4:	fd                   	std
+  803dd5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803dd7:	eb f1                	jmp    803dca <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803dd9:	48 89 f2             	mov    %rsi,%rdx
+  803ddc:	48 09 c2             	or     %rax,%rdx
+  803ddf:	48 09 ca             	or     %rcx,%rdx
+  803de2:	f6 c2 07             	test   $0x7,%dl
+  803de5:	75 0c                	jne    803df3 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803de7:	48 c1 e9 03          	shr    $0x3,%rcx
+  803deb:	48 89 c7             	mov    %rax,%rdi
+  803dee:	fc                   	cld
+  803def:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803df2:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803df3:	48 89 c7             	mov    %rax,%rdi
+  803df6:	fc                   	cld
+  803df7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803df9:	c3                   	ret
+
+0000000000803dfa <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803dfa:	55                   	push   %rbp
+  803dfb:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803dfe:	48 b8 93 3d 80 00 00 	movabs $0x803d93,%rax
+  803e05:	00 00 00 
+  803e08:	ff d0                	call   *%rax
+}
+  803e0a:	5d                   	pop    %rbp
+  803e0b:	c3                   	ret
+
+0000000000803e0c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803e0c:	55                   	push   %rbp
+  803e0d:	48 89 e5             	mov    %rsp,%rbp
+  803e10:	41 57                	push   %r15
+  803e12:	41 56                	push   %r14
+  803e14:	41 55                	push   %r13
+  803e16:	41 54                	push   %r12
+  803e18:	53                   	push   %rbx
+  803e19:	48 83 ec 08          	sub    $0x8,%rsp
+  803e1d:	49 89 fe             	mov    %rdi,%r14
+  803e20:	49 89 f7             	mov    %rsi,%r15
+  803e23:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e26:	48 89 f7             	mov    %rsi,%rdi
+  803e29:	48 b8 c7 39 80 00 00 	movabs $0x8039c7,%rax
+  803e30:	00 00 00 
+  803e33:	ff d0                	call   *%rax
+  803e35:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e38:	48 89 de             	mov    %rbx,%rsi
+  803e3b:	4c 89 f7             	mov    %r14,%rdi
+  803e3e:	48 b8 e2 39 80 00 00 	movabs $0x8039e2,%rax
+  803e45:	00 00 00 
+  803e48:	ff d0                	call   *%rax
+  803e4a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e4d:	48 39 c3             	cmp    %rax,%rbx
+  803e50:	74 36                	je     803e88 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e52:	48 89 d8             	mov    %rbx,%rax
+  803e55:	4c 29 e8             	sub    %r13,%rax
+  803e58:	49 39 c4             	cmp    %rax,%r12
+  803e5b:	73 31                	jae    803e8e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803e5d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803e62:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e66:	4c 89 fe             	mov    %r15,%rsi
+  803e69:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  803e70:	00 00 00 
+  803e73:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803e75:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803e79:	48 83 c4 08          	add    $0x8,%rsp
+  803e7d:	5b                   	pop    %rbx
+  803e7e:	41 5c                	pop    %r12
+  803e80:	41 5d                	pop    %r13
+  803e82:	41 5e                	pop    %r14
+  803e84:	41 5f                	pop    %r15
+  803e86:	5d                   	pop    %rbp
+  803e87:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e88:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803e8c:	eb eb                	jmp    803e79 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803e8e:	48 83 eb 01          	sub    $0x1,%rbx
+  803e92:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e96:	48 89 da             	mov    %rbx,%rdx
+  803e99:	4c 89 fe             	mov    %r15,%rsi
+  803e9c:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  803ea3:	00 00 00 
+  803ea6:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803ea8:	49 01 de             	add    %rbx,%r14
+  803eab:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803eb0:	eb c3                	jmp    803e75 <strlcat+0x69>
+
+0000000000803eb2 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803eb2:	48 85 d2             	test   %rdx,%rdx
+  803eb5:	74 2d                	je     803ee4 <memcmp+0x32>
+  803eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803ebc:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803ec0:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803ec5:	44 38 c1             	cmp    %r8b,%cl
+  803ec8:	75 0f                	jne    803ed9 <memcmp+0x27>
+    while (n-- > 0) {
+  803eca:	48 83 c0 01          	add    $0x1,%rax
+  803ece:	48 39 c2             	cmp    %rax,%rdx
+  803ed1:	75 e9                	jne    803ebc <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed8:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803ed9:	0f b6 c1             	movzbl %cl,%eax
+  803edc:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803ee0:	44 29 c0             	sub    %r8d,%eax
+  803ee3:	c3                   	ret
+    return 0;
+  803ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee9:	c3                   	ret
+
+0000000000803eea <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803eea:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803eee:	48 39 c7             	cmp    %rax,%rdi
+  803ef1:	73 0f                	jae    803f02 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803ef3:	40 38 37             	cmp    %sil,(%rdi)
+  803ef6:	74 0e                	je     803f06 <memfind+0x1c>
+    for (; src < end; src++) {
+  803ef8:	48 83 c7 01          	add    $0x1,%rdi
+  803efc:	48 39 f8             	cmp    %rdi,%rax
+  803eff:	75 f2                	jne    803ef3 <memfind+0x9>
+  803f01:	c3                   	ret
+  803f02:	48 89 f8             	mov    %rdi,%rax
+  803f05:	c3                   	ret
+  803f06:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803f09:	c3                   	ret
+
+0000000000803f0a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803f0a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803f0d:	0f b6 37             	movzbl (%rdi),%esi
+  803f10:	40 80 fe 20          	cmp    $0x20,%sil
+  803f14:	74 06                	je     803f1c <strtol+0x12>
+  803f16:	40 80 fe 09          	cmp    $0x9,%sil
+  803f1a:	75 13                	jne    803f2f <strtol+0x25>
+  803f1c:	48 83 c7 01          	add    $0x1,%rdi
+  803f20:	0f b6 37             	movzbl (%rdi),%esi
+  803f23:	40 80 fe 20          	cmp    $0x20,%sil
+  803f27:	74 f3                	je     803f1c <strtol+0x12>
+  803f29:	40 80 fe 09          	cmp    $0x9,%sil
+  803f2d:	74 ed                	je     803f1c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f2f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f32:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f35:	3c 01                	cmp    $0x1,%al
+  803f37:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f3b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f41:	75 0f                	jne    803f52 <strtol+0x48>
+  803f43:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f46:	74 14                	je     803f5c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f48:	85 d2                	test   %edx,%edx
+  803f4a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f4f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f52:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803f57:	4c 63 ca             	movslq %edx,%r9
+  803f5a:	eb 36                	jmp    803f92 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f5c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803f60:	74 0f                	je     803f71 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803f62:	85 d2                	test   %edx,%edx
+  803f64:	75 ec                	jne    803f52 <strtol+0x48>
+        s++;
+  803f66:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803f6a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803f6f:	eb e1                	jmp    803f52 <strtol+0x48>
+        s += 2;
+  803f71:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803f75:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803f7a:	eb d6                	jmp    803f52 <strtol+0x48>
+            dig -= '0';
+  803f7c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803f7f:	44 0f b6 c1          	movzbl %cl,%r8d
+  803f83:	41 39 d0             	cmp    %edx,%r8d
+  803f86:	7d 21                	jge    803fa9 <strtol+0x9f>
+        val = val * base + dig;
+  803f88:	49 0f af c1          	imul   %r9,%rax
+  803f8c:	0f b6 c9             	movzbl %cl,%ecx
+  803f8f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803f92:	48 83 c7 01          	add    $0x1,%rdi
+  803f96:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803f9a:	80 f9 39             	cmp    $0x39,%cl
+  803f9d:	76 dd                	jbe    803f7c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803f9f:	80 f9 7b             	cmp    $0x7b,%cl
+  803fa2:	77 05                	ja     803fa9 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803fa4:	83 e9 57             	sub    $0x57,%ecx
+  803fa7:	eb d6                	jmp    803f7f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803fa9:	4d 85 d2             	test   %r10,%r10
+  803fac:	74 03                	je     803fb1 <strtol+0xa7>
+  803fae:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803fb1:	48 89 c2             	mov    %rax,%rdx
+  803fb4:	48 f7 da             	neg    %rdx
+  803fb7:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803fbb:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803fbf:	c3                   	ret
+
+0000000000803fc0 <atoi>:
+int atoi(const char *str) {
+  803fc0:	55                   	push   %rbp
+  803fc1:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  803fc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fc9:	be 00 00 00 00       	mov    $0x0,%esi
+  803fce:	48 b8 0a 3f 80 00 00 	movabs $0x803f0a,%rax
+  803fd5:	00 00 00 
+  803fd8:	ff d0                	call   *%rax
+}
+  803fda:	5d                   	pop    %rbp
+  803fdb:	c3                   	ret
+
+0000000000803fdc <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fdc:	55                   	push   %rbp
+  803fdd:	48 89 e5             	mov    %rsp,%rbp
+  803fe0:	41 55                	push   %r13
+  803fe2:	41 54                	push   %r12
+  803fe4:	53                   	push   %rbx
+  803fe5:	48 83 ec 08          	sub    $0x8,%rsp
+  803fe9:	49 89 fc             	mov    %rdi,%r12
+  803fec:	48 89 f7             	mov    %rsi,%rdi
+  803fef:	48 89 d3             	mov    %rdx,%rbx
+  803ff2:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803ff5:	48 85 f6             	test   %rsi,%rsi
+  803ff8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fff:	00 00 00 
+  804002:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804006:	be 00 10 00 00       	mov    $0x1000,%esi
+  80400b:	48 85 d2             	test   %rdx,%rdx
+  80400e:	74 03                	je     804013 <ipc_recv+0x37>
+  804010:	48 8b 32             	mov    (%rdx),%rsi
+  804013:	48 b8 4b 06 80 00 00 	movabs $0x80064b,%rax
+  80401a:	00 00 00 
+  80401d:	ff d0                	call   *%rax
+    if (errno) {
+  80401f:	85 c0                	test   %eax,%eax
+  804021:	74 1c                	je     80403f <ipc_recv+0x63>
+        if (from_env_store)
+  804023:	4d 85 e4             	test   %r12,%r12
+  804026:	74 08                	je     804030 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804028:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80402f:	00 
+
+        if (perm_store)
+  804030:	4d 85 ed             	test   %r13,%r13
+  804033:	74 74                	je     8040a9 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804035:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80403c:	00 
+  80403d:	eb 6a                	jmp    8040a9 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80403f:	4d 85 e4             	test   %r12,%r12
+  804042:	74 14                	je     804058 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804044:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80404b:	00 00 00 
+  80404e:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804054:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804058:	48 85 db             	test   %rbx,%rbx
+  80405b:	74 23                	je     804080 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80405d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804064:	00 00 00 
+  804067:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80406d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804072:	85 c9                	test   %ecx,%ecx
+  804074:	74 07                	je     80407d <ipc_recv+0xa1>
+  804076:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80407d:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804080:	4d 85 ed             	test   %r13,%r13
+  804083:	74 14                	je     804099 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804085:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80408c:	00 00 00 
+  80408f:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804095:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804099:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040a0:	00 00 00 
+  8040a3:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040a9:	48 83 c4 08          	add    $0x8,%rsp
+  8040ad:	5b                   	pop    %rbx
+  8040ae:	41 5c                	pop    %r12
+  8040b0:	41 5d                	pop    %r13
+  8040b2:	5d                   	pop    %rbp
+  8040b3:	c3                   	ret
+
+00000000008040b4 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040b4:	55                   	push   %rbp
+  8040b5:	48 89 e5             	mov    %rsp,%rbp
+  8040b8:	41 55                	push   %r13
+  8040ba:	41 54                	push   %r12
+  8040bc:	53                   	push   %rbx
+  8040bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8040c1:	49 89 fc             	mov    %rdi,%r12
+  8040c4:	48 89 f7             	mov    %rsi,%rdi
+  8040c7:	48 89 d3             	mov    %rdx,%rbx
+  8040ca:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040cd:	48 85 f6             	test   %rsi,%rsi
+  8040d0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040d7:	00 00 00 
+  8040da:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040de:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040e3:	48 85 d2             	test   %rdx,%rdx
+  8040e6:	74 03                	je     8040eb <ipc_try_recv+0x37>
+  8040e8:	48 8b 32             	mov    (%rdx),%rsi
+  8040eb:	48 b8 b4 06 80 00 00 	movabs $0x8006b4,%rax
+  8040f2:	00 00 00 
+  8040f5:	ff d0                	call   *%rax
+    if (errno) {
+  8040f7:	85 c0                	test   %eax,%eax
+  8040f9:	75 75                	jne    804170 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8040fb:	4d 85 e4             	test   %r12,%r12
+  8040fe:	74 14                	je     804114 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804100:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804107:	00 00 00 
+  80410a:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804110:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804114:	48 85 db             	test   %rbx,%rbx
+  804117:	74 23                	je     80413c <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804119:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804120:	00 00 00 
+  804123:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804129:	ba 00 00 00 00       	mov    $0x0,%edx
+  80412e:	85 c9                	test   %ecx,%ecx
+  804130:	74 07                	je     804139 <ipc_try_recv+0x85>
+  804132:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804139:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80413c:	4d 85 ed             	test   %r13,%r13
+  80413f:	74 14                	je     804155 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804141:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804148:	00 00 00 
+  80414b:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804151:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804155:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80415c:	00 00 00 
+  80415f:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804165:	48 83 c4 08          	add    $0x8,%rsp
+  804169:	5b                   	pop    %rbx
+  80416a:	41 5c                	pop    %r12
+  80416c:	41 5d                	pop    %r13
+  80416e:	5d                   	pop    %rbp
+  80416f:	c3                   	ret
+        if (from_env_store)
+  804170:	4d 85 e4             	test   %r12,%r12
+  804173:	74 08                	je     80417d <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804175:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80417c:	00 
+        if (perm_store)
+  80417d:	4d 85 ed             	test   %r13,%r13
+  804180:	74 e3                	je     804165 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804182:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804189:	00 
+  80418a:	eb d9                	jmp    804165 <ipc_try_recv+0xb1>
+
+000000000080418c <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80418c:	55                   	push   %rbp
+  80418d:	48 89 e5             	mov    %rsp,%rbp
+  804190:	41 57                	push   %r15
+  804192:	41 56                	push   %r14
+  804194:	41 55                	push   %r13
+  804196:	41 54                	push   %r12
+  804198:	53                   	push   %rbx
+  804199:	48 83 ec 18          	sub    $0x18,%rsp
+  80419d:	41 89 fd             	mov    %edi,%r13d
+  8041a0:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8041a3:	48 89 d3             	mov    %rdx,%rbx
+  8041a6:	49 89 cc             	mov    %rcx,%r12
+  8041a9:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041ad:	48 85 d2             	test   %rdx,%rdx
+  8041b0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041b7:	00 00 00 
+  8041ba:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041be:	49 be 1f 06 80 00 00 	movabs $0x80061f,%r14
+  8041c5:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041c8:	49 bf 0f 02 80 00 00 	movabs $0x80020f,%r15
+  8041cf:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041d2:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041d5:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041d9:	4c 89 e1             	mov    %r12,%rcx
+  8041dc:	48 89 da             	mov    %rbx,%rdx
+  8041df:	44 89 ef             	mov    %r13d,%edi
+  8041e2:	41 ff d6             	call   *%r14
+  8041e5:	85 c0                	test   %eax,%eax
+  8041e7:	74 37                	je     804220 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041e9:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041ec:	75 05                	jne    8041f3 <ipc_send+0x67>
+        sys_yield();
+  8041ee:	41 ff d7             	call   *%r15
+  8041f1:	eb df                	jmp    8041d2 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041f3:	89 c1                	mov    %eax,%ecx
+  8041f5:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  8041fc:	00 00 00 
+  8041ff:	be 65 00 00 00       	mov    $0x65,%esi
+  804204:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  80420b:	00 00 00 
+  80420e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804213:	49 b8 3d 2f 80 00 00 	movabs $0x802f3d,%r8
+  80421a:	00 00 00 
+  80421d:	41 ff d0             	call   *%r8
+    }
+}
+  804220:	48 83 c4 18          	add    $0x18,%rsp
+  804224:	5b                   	pop    %rbx
+  804225:	41 5c                	pop    %r12
+  804227:	41 5d                	pop    %r13
+  804229:	41 5e                	pop    %r14
+  80422b:	41 5f                	pop    %r15
+  80422d:	5d                   	pop    %rbp
+  80422e:	c3                   	ret
+
+000000000080422f <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80422f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804234:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80423b:	00 00 00 
+  80423e:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804245:	48 01 ca             	add    %rcx,%rdx
+  804248:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80424e:	39 fa                	cmp    %edi,%edx
+  804250:	74 12                	je     804264 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804252:	48 83 c0 01          	add    $0x1,%rax
+  804256:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80425c:	75 e0                	jne    80423e <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80425e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804263:	c3                   	ret
+            return envs[i].env_id;
+  804264:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80426b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804272:	00 00 00 
+  804275:	48 01 d0             	add    %rdx,%rax
+  804278:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80427e:	c3                   	ret
+
+000000000080427f <__text_end>:
+  80427f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804286:	00 00 00 
+  804289:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804290:	00 00 00 
+  804293:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429a:	00 00 00 
+  80429d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a4:	00 00 00 
+  8042a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ae:	00 00 00 
+  8042b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b8:	00 00 00 
+  8042bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c2:	00 00 00 
+  8042c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cc:	00 00 00 
+  8042cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d6:	00 00 00 
+  8042d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e0:	00 00 00 
+  8042e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ea:	00 00 00 
+  8042ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f4:	00 00 00 
+  8042f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fe:	00 00 00 
+  804301:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804308:	00 00 00 
+  80430b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804312:	00 00 00 
+  804315:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431c:	00 00 00 
+  80431f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804326:	00 00 00 
+  804329:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804330:	00 00 00 
+  804333:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433a:	00 00 00 
+  80433d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804344:	00 00 00 
+  804347:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434e:	00 00 00 
+  804351:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804358:	00 00 00 
+  80435b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804362:	00 00 00 
+  804365:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436c:	00 00 00 
+  80436f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804376:	00 00 00 
+  804379:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804380:	00 00 00 
+  804383:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438a:	00 00 00 
+  80438d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804394:	00 00 00 
+  804397:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439e:	00 00 00 
+  8043a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a8:	00 00 00 
+  8043ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b2:	00 00 00 
+  8043b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bc:	00 00 00 
+  8043bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c6:	00 00 00 
+  8043c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d0:	00 00 00 
+  8043d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043da:	00 00 00 
+  8043dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e4:	00 00 00 
+  8043e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ee:	00 00 00 
+  8043f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f8:	00 00 00 
+  8043fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804402:	00 00 00 
+  804405:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440c:	00 00 00 
+  80440f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804416:	00 00 00 
+  804419:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804420:	00 00 00 
+  804423:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442a:	00 00 00 
+  80442d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804434:	00 00 00 
+  804437:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443e:	00 00 00 
+  804441:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804448:	00 00 00 
+  80444b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804452:	00 00 00 
+  804455:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445c:	00 00 00 
+  80445f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804466:	00 00 00 
+  804469:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804470:	00 00 00 
+  804473:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447a:	00 00 00 
+  80447d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804484:	00 00 00 
+  804487:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448e:	00 00 00 
+  804491:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804498:	00 00 00 
+  80449b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a2:	00 00 00 
+  8044a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ac:	00 00 00 
+  8044af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b6:	00 00 00 
+  8044b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c0:	00 00 00 
+  8044c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ca:	00 00 00 
+  8044cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d4:	00 00 00 
+  8044d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044de:	00 00 00 
+  8044e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e8:	00 00 00 
+  8044eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f2:	00 00 00 
+  8044f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fc:	00 00 00 
+  8044ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804506:	00 00 00 
+  804509:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804510:	00 00 00 
+  804513:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451a:	00 00 00 
+  80451d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804524:	00 00 00 
+  804527:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452e:	00 00 00 
+  804531:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804538:	00 00 00 
+  80453b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804542:	00 00 00 
+  804545:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454c:	00 00 00 
+  80454f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804556:	00 00 00 
+  804559:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804560:	00 00 00 
+  804563:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456a:	00 00 00 
+  80456d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804574:	00 00 00 
+  804577:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457e:	00 00 00 
+  804581:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804588:	00 00 00 
+  80458b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804592:	00 00 00 
+  804595:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459c:	00 00 00 
+  80459f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a6:	00 00 00 
+  8045a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b0:	00 00 00 
+  8045b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ba:	00 00 00 
+  8045bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c4:	00 00 00 
+  8045c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ce:	00 00 00 
+  8045d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d8:	00 00 00 
+  8045db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e2:	00 00 00 
+  8045e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ec:	00 00 00 
+  8045ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f6:	00 00 00 
+  8045f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804600:	00 00 00 
+  804603:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460a:	00 00 00 
+  80460d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804614:	00 00 00 
+  804617:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461e:	00 00 00 
+  804621:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804628:	00 00 00 
+  80462b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804632:	00 00 00 
+  804635:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463c:	00 00 00 
+  80463f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804646:	00 00 00 
+  804649:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804650:	00 00 00 
+  804653:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465a:	00 00 00 
+  80465d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804664:	00 00 00 
+  804667:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466e:	00 00 00 
+  804671:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804678:	00 00 00 
+  80467b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804682:	00 00 00 
+  804685:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468c:	00 00 00 
+  80468f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804696:	00 00 00 
+  804699:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a0:	00 00 00 
+  8046a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046aa:	00 00 00 
+  8046ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b4:	00 00 00 
+  8046b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046be:	00 00 00 
+  8046c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c8:	00 00 00 
+  8046cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d2:	00 00 00 
+  8046d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dc:	00 00 00 
+  8046df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e6:	00 00 00 
+  8046e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f0:	00 00 00 
+  8046f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fa:	00 00 00 
+  8046fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804704:	00 00 00 
+  804707:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470e:	00 00 00 
+  804711:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804718:	00 00 00 
+  80471b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804722:	00 00 00 
+  804725:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472c:	00 00 00 
+  80472f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804736:	00 00 00 
+  804739:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804740:	00 00 00 
+  804743:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474a:	00 00 00 
+  80474d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804754:	00 00 00 
+  804757:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475e:	00 00 00 
+  804761:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804768:	00 00 00 
+  80476b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804772:	00 00 00 
+  804775:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477c:	00 00 00 
+  80477f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804786:	00 00 00 
+  804789:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804790:	00 00 00 
+  804793:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479a:	00 00 00 
+  80479d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a4:	00 00 00 
+  8047a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ae:	00 00 00 
+  8047b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b8:	00 00 00 
+  8047bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c2:	00 00 00 
+  8047c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cc:	00 00 00 
+  8047cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d6:	00 00 00 
+  8047d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e0:	00 00 00 
+  8047e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ea:	00 00 00 
+  8047ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f4:	00 00 00 
+  8047f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fe:	00 00 00 
+  804801:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804808:	00 00 00 
+  80480b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804812:	00 00 00 
+  804815:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481c:	00 00 00 
+  80481f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804826:	00 00 00 
+  804829:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804830:	00 00 00 
+  804833:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483a:	00 00 00 
+  80483d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804844:	00 00 00 
+  804847:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484e:	00 00 00 
+  804851:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804858:	00 00 00 
+  80485b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804862:	00 00 00 
+  804865:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486c:	00 00 00 
+  80486f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804876:	00 00 00 
+  804879:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804880:	00 00 00 
+  804883:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488a:	00 00 00 
+  80488d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804894:	00 00 00 
+  804897:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489e:	00 00 00 
+  8048a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a8:	00 00 00 
+  8048ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b2:	00 00 00 
+  8048b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bc:	00 00 00 
+  8048bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c6:	00 00 00 
+  8048c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d0:	00 00 00 
+  8048d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048da:	00 00 00 
+  8048dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e4:	00 00 00 
+  8048e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ee:	00 00 00 
+  8048f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f8:	00 00 00 
+  8048fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804902:	00 00 00 
+  804905:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490c:	00 00 00 
+  80490f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804916:	00 00 00 
+  804919:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804920:	00 00 00 
+  804923:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492a:	00 00 00 
+  80492d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804934:	00 00 00 
+  804937:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493e:	00 00 00 
+  804941:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804948:	00 00 00 
+  80494b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804952:	00 00 00 
+  804955:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495c:	00 00 00 
+  80495f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804966:	00 00 00 
+  804969:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804970:	00 00 00 
+  804973:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497a:	00 00 00 
+  80497d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804984:	00 00 00 
+  804987:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498e:	00 00 00 
+  804991:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804998:	00 00 00 
+  80499b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a2:	00 00 00 
+  8049a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ac:	00 00 00 
+  8049af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b6:	00 00 00 
+  8049b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c0:	00 00 00 
+  8049c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ca:	00 00 00 
+  8049cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d4:	00 00 00 
+  8049d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049de:	00 00 00 
+  8049e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e8:	00 00 00 
+  8049eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f2:	00 00 00 
+  8049f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fc:	00 00 00 
+  8049ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a06:	00 00 00 
+  804a09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a10:	00 00 00 
+  804a13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1a:	00 00 00 
+  804a1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a24:	00 00 00 
+  804a27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2e:	00 00 00 
+  804a31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a38:	00 00 00 
+  804a3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a42:	00 00 00 
+  804a45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4c:	00 00 00 
+  804a4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a56:	00 00 00 
+  804a59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a60:	00 00 00 
+  804a63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6a:	00 00 00 
+  804a6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a74:	00 00 00 
+  804a77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7e:	00 00 00 
+  804a81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a88:	00 00 00 
+  804a8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a92:	00 00 00 
+  804a95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9c:	00 00 00 
+  804a9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa6:	00 00 00 
+  804aa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab0:	00 00 00 
+  804ab3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aba:	00 00 00 
+  804abd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac4:	00 00 00 
+  804ac7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ace:	00 00 00 
+  804ad1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad8:	00 00 00 
+  804adb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae2:	00 00 00 
+  804ae5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aec:	00 00 00 
+  804aef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af6:	00 00 00 
+  804af9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b00:	00 00 00 
+  804b03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0a:	00 00 00 
+  804b0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b14:	00 00 00 
+  804b17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1e:	00 00 00 
+  804b21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b28:	00 00 00 
+  804b2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b32:	00 00 00 
+  804b35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3c:	00 00 00 
+  804b3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b46:	00 00 00 
+  804b49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b50:	00 00 00 
+  804b53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5a:	00 00 00 
+  804b5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b64:	00 00 00 
+  804b67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6e:	00 00 00 
+  804b71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b78:	00 00 00 
+  804b7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b82:	00 00 00 
+  804b85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8c:	00 00 00 
+  804b8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b96:	00 00 00 
+  804b99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba0:	00 00 00 
+  804ba3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baa:	00 00 00 
+  804bad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb4:	00 00 00 
+  804bb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbe:	00 00 00 
+  804bc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc8:	00 00 00 
+  804bcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd2:	00 00 00 
+  804bd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdc:	00 00 00 
+  804bdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be6:	00 00 00 
+  804be9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf0:	00 00 00 
+  804bf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfa:	00 00 00 
+  804bfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c04:	00 00 00 
+  804c07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0e:	00 00 00 
+  804c11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c18:	00 00 00 
+  804c1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c22:	00 00 00 
+  804c25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2c:	00 00 00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c40:	00 00 00 
+  804c43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4a:	00 00 00 
+  804c4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c54:	00 00 00 
+  804c57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5e:	00 00 00 
+  804c61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c68:	00 00 00 
+  804c6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c72:	00 00 00 
+  804c75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7c:	00 00 00 
+  804c7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c86:	00 00 00 
+  804c89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c90:	00 00 00 
+  804c93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9a:	00 00 00 
+  804c9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca4:	00 00 00 
+  804ca7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cae:	00 00 00 
+  804cb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb8:	00 00 00 
+  804cbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc2:	00 00 00 
+  804cc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccc:	00 00 00 
+  804ccf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd6:	00 00 00 
+  804cd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce0:	00 00 00 
+  804ce3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cea:	00 00 00 
+  804ced:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf4:	00 00 00 
+  804cf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfe:	00 00 00 
+  804d01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d08:	00 00 00 
+  804d0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d12:	00 00 00 
+  804d15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1c:	00 00 00 
+  804d1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d26:	00 00 00 
+  804d29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d30:	00 00 00 
+  804d33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3a:	00 00 00 
+  804d3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d44:	00 00 00 
+  804d47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4e:	00 00 00 
+  804d51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d58:	00 00 00 
+  804d5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d62:	00 00 00 
+  804d65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6c:	00 00 00 
+  804d6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d76:	00 00 00 
+  804d79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d80:	00 00 00 
+  804d83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8a:	00 00 00 
+  804d8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d94:	00 00 00 
+  804d97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9e:	00 00 00 
+  804da1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da8:	00 00 00 
+  804dab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db2:	00 00 00 
+  804db5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbc:	00 00 00 
+  804dbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc6:	00 00 00 
+  804dc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd0:	00 00 00 
+  804dd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dda:	00 00 00 
+  804ddd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de4:	00 00 00 
+  804de7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dee:	00 00 00 
+  804df1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df8:	00 00 00 
+  804dfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e02:	00 00 00 
+  804e05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0c:	00 00 00 
+  804e0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e16:	00 00 00 
+  804e19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e20:	00 00 00 
+  804e23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2a:	00 00 00 
+  804e2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e34:	00 00 00 
+  804e37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3e:	00 00 00 
+  804e41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e48:	00 00 00 
+  804e4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e52:	00 00 00 
+  804e55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5c:	00 00 00 
+  804e5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e66:	00 00 00 
+  804e69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e70:	00 00 00 
+  804e73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7a:	00 00 00 
+  804e7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e84:	00 00 00 
+  804e87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8e:	00 00 00 
+  804e91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e98:	00 00 00 
+  804e9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea2:	00 00 00 
+  804ea5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eac:	00 00 00 
+  804eaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb6:	00 00 00 
+  804eb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec0:	00 00 00 
+  804ec3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eca:	00 00 00 
+  804ecd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed4:	00 00 00 
+  804ed7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ede:	00 00 00 
+  804ee1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee8:	00 00 00 
+  804eeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef2:	00 00 00 
+  804ef5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efc:	00 00 00 
+  804eff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f06:	00 00 00 
+  804f09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f10:	00 00 00 
+  804f13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1a:	00 00 00 
+  804f1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f24:	00 00 00 
+  804f27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2e:	00 00 00 
+  804f31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f38:	00 00 00 
+  804f3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f42:	00 00 00 
+  804f45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4c:	00 00 00 
+  804f4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f56:	00 00 00 
+  804f59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f60:	00 00 00 
+  804f63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6a:	00 00 00 
+  804f6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f74:	00 00 00 
+  804f77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7e:	00 00 00 
+  804f81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f88:	00 00 00 
+  804f8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f92:	00 00 00 
+  804f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9c:	00 00 00 
+  804f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa6:	00 00 00 
+  804fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb0:	00 00 00 
+  804fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fba:	00 00 00 
+  804fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc4:	00 00 00 
+  804fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fce:	00 00 00 
+  804fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd8:	00 00 00 
+  804fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe2:	00 00 00 
+  804fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fec:	00 00 00 
+  804fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff6:	00 00 00 
+  804ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
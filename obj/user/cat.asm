@@ -0,0 +1,8287 @@
+
+obj/user/cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 a6 01 00 00       	call   8001c9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <cat>:
+#include <inc/lib.h>
+
+char buf[8192];
+
+void
+cat(int f, char *s) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	41 89 fd             	mov    %edi,%r13d
+  800039:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    long n;
+    int r;
+
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003d:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  800044:	00 00 00 
+  800047:	49 be 44 22 80 00 00 	movabs $0x802244,%r14
+  80004e:	00 00 00 
+        if ((r = write(1, buf, n)) != n)
+  800051:	49 bf 73 23 80 00 00 	movabs $0x802373,%r15
+  800058:	00 00 00 
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80005b:	ba 00 20 00 00       	mov    $0x2000,%edx
+  800060:	4c 89 e6             	mov    %r12,%rsi
+  800063:	44 89 ef             	mov    %r13d,%edi
+  800066:	41 ff d6             	call   *%r14
+  800069:	48 89 c3             	mov    %rax,%rbx
+  80006c:	48 85 c0             	test   %rax,%rax
+  80006f:	7e 48                	jle    8000b9 <cat+0x94>
+        if ((r = write(1, buf, n)) != n)
+  800071:	48 89 da             	mov    %rbx,%rdx
+  800074:	4c 89 e6             	mov    %r12,%rsi
+  800077:	bf 01 00 00 00       	mov    $0x1,%edi
+  80007c:	41 ff d7             	call   *%r15
+  80007f:	48 63 d0             	movslq %eax,%rdx
+  800082:	48 39 da             	cmp    %rbx,%rdx
+  800085:	74 d4                	je     80005b <cat+0x36>
+            panic("write error copying %s: %i", s, r);
+  800087:	41 89 c0             	mov    %eax,%r8d
+  80008a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80008e:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800095:	00 00 00 
+  800098:	be 0c 00 00 00       	mov    $0xc,%esi
+  80009d:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8000a4:	00 00 00 
+  8000a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ac:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  8000b3:	00 00 00 
+  8000b6:	41 ff d1             	call   *%r9
+    if (n < 0)
+  8000b9:	78 0f                	js     8000ca <cat+0xa5>
+        panic("error reading %s: %i", s, (int)n);
+}
+  8000bb:	48 83 c4 18          	add    $0x18,%rsp
+  8000bf:	5b                   	pop    %rbx
+  8000c0:	41 5c                	pop    %r12
+  8000c2:	41 5d                	pop    %r13
+  8000c4:	41 5e                	pop    %r14
+  8000c6:	41 5f                	pop    %r15
+  8000c8:	5d                   	pop    %rbp
+  8000c9:	c3                   	ret
+        panic("error reading %s: %i", s, (int)n);
+  8000ca:	41 89 c0             	mov    %eax,%r8d
+  8000cd:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8000d1:	48 ba 26 50 80 00 00 	movabs $0x805026,%rdx
+  8000d8:	00 00 00 
+  8000db:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000e0:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8000e7:	00 00 00 
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  8000f6:	00 00 00 
+  8000f9:	41 ff d1             	call   *%r9
+
+00000000008000fc <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000fc:	55                   	push   %rbp
+  8000fd:	48 89 e5             	mov    %rsp,%rbp
+  800100:	41 57                	push   %r15
+  800102:	41 56                	push   %r14
+  800104:	41 55                	push   %r13
+  800106:	41 54                	push   %r12
+  800108:	53                   	push   %rbx
+  800109:	48 83 ec 08          	sub    $0x8,%rsp
+    int f, i;
+
+    binaryname = "cat";
+  80010d:	48 b8 3b 50 80 00 00 	movabs $0x80503b,%rax
+  800114:	00 00 00 
+  800117:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80011e:	00 00 00 
+    if (argc == 1)
+  800121:	83 ff 01             	cmp    $0x1,%edi
+  800124:	74 24                	je     80014a <umain+0x4e>
+        cat(0, "<stdin>");
+    else
+        for (i = 1; i < argc; i++) {
+  800126:	7e 3d                	jle    800165 <umain+0x69>
+  800128:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  80012c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80012f:	4c 8d 74 c6 10       	lea    0x10(%rsi,%rax,8),%r14
+            f = open(argv[i], O_RDONLY);
+  800134:	49 bd 4d 32 80 00 00 	movabs $0x80324d,%r13
+  80013b:	00 00 00 
+            if (f < 0)
+                printf("can't open %s: %i\n", argv[i], f);
+            else {
+                cat(f, argv[i]);
+  80013e:	49 bf 25 00 80 00 00 	movabs $0x800025,%r15
+  800145:	00 00 00 
+  800148:	eb 54                	jmp    80019e <umain+0xa2>
+        cat(0, "<stdin>");
+  80014a:	48 be 3f 50 80 00 00 	movabs $0x80503f,%rsi
+  800151:	00 00 00 
+  800154:	bf 00 00 00 00       	mov    $0x0,%edi
+  800159:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800160:	00 00 00 
+  800163:	ff d0                	call   *%rax
+                close(f);
+            }
+        }
+}
+  800165:	48 83 c4 08          	add    $0x8,%rsp
+  800169:	5b                   	pop    %rbx
+  80016a:	41 5c                	pop    %r12
+  80016c:	41 5d                	pop    %r13
+  80016e:	41 5e                	pop    %r14
+  800170:	41 5f                	pop    %r15
+  800172:	5d                   	pop    %rbp
+  800173:	c3                   	ret
+                printf("can't open %s: %i\n", argv[i], f);
+  800174:	49 8b 34 24          	mov    (%r12),%rsi
+  800178:	89 c2                	mov    %eax,%edx
+  80017a:	48 bf 47 50 80 00 00 	movabs $0x805047,%rdi
+  800181:	00 00 00 
+  800184:	b8 00 00 00 00       	mov    $0x0,%eax
+  800189:	48 b9 42 38 80 00 00 	movabs $0x803842,%rcx
+  800190:	00 00 00 
+  800193:	ff d1                	call   *%rcx
+        for (i = 1; i < argc; i++) {
+  800195:	49 83 c4 08          	add    $0x8,%r12
+  800199:	4d 39 f4             	cmp    %r14,%r12
+  80019c:	74 c7                	je     800165 <umain+0x69>
+            f = open(argv[i], O_RDONLY);
+  80019e:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a7:	41 ff d5             	call   *%r13
+  8001aa:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  8001ac:	85 c0                	test   %eax,%eax
+  8001ae:	78 c4                	js     800174 <umain+0x78>
+                cat(f, argv[i]);
+  8001b0:	49 8b 34 24          	mov    (%r12),%rsi
+  8001b4:	89 c7                	mov    %eax,%edi
+  8001b6:	41 ff d7             	call   *%r15
+                close(f);
+  8001b9:	89 df                	mov    %ebx,%edi
+  8001bb:	48 b8 c6 20 80 00 00 	movabs $0x8020c6,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+  8001c7:	eb cc                	jmp    800195 <umain+0x99>
+
+00000000008001c9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001c9:	55                   	push   %rbp
+  8001ca:	48 89 e5             	mov    %rsp,%rbp
+  8001cd:	41 56                	push   %r14
+  8001cf:	41 55                	push   %r13
+  8001d1:	41 54                	push   %r12
+  8001d3:	53                   	push   %rbx
+  8001d4:	41 89 fd             	mov    %edi,%r13d
+  8001d7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001da:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8001e1:	00 00 00 
+  8001e4:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8001eb:	00 00 00 
+  8001ee:	48 39 c2             	cmp    %rax,%rdx
+  8001f1:	73 17                	jae    80020a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001f3:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001f6:	49 89 c4             	mov    %rax,%r12
+  8001f9:	48 83 c3 08          	add    $0x8,%rbx
+  8001fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800202:	ff 53 f8             	call   *-0x8(%rbx)
+  800205:	4c 39 e3             	cmp    %r12,%rbx
+  800208:	72 ef                	jb     8001f9 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80020a:	48 b8 fd 13 80 00 00 	movabs $0x8013fd,%rax
+  800211:	00 00 00 
+  800214:	ff d0                	call   *%rax
+  800216:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80021b:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800222:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800229:	00 00 00 
+  80022c:	48 01 d0             	add    %rdx,%rax
+  80022f:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800236:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800239:	45 85 ed             	test   %r13d,%r13d
+  80023c:	7e 0d                	jle    80024b <libmain+0x82>
+  80023e:	49 8b 06             	mov    (%r14),%rax
+  800241:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800248:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80024b:	4c 89 f6             	mov    %r14,%rsi
+  80024e:	44 89 ef             	mov    %r13d,%edi
+  800251:	48 b8 fc 00 80 00 00 	movabs $0x8000fc,%rax
+  800258:	00 00 00 
+  80025b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80025d:	48 b8 72 02 80 00 00 	movabs $0x800272,%rax
+  800264:	00 00 00 
+  800267:	ff d0                	call   *%rax
+#endif
+}
+  800269:	5b                   	pop    %rbx
+  80026a:	41 5c                	pop    %r12
+  80026c:	41 5d                	pop    %r13
+  80026e:	41 5e                	pop    %r14
+  800270:	5d                   	pop    %rbp
+  800271:	c3                   	ret
+
+0000000000800272 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800272:	55                   	push   %rbp
+  800273:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800276:	48 b8 f9 20 80 00 00 	movabs $0x8020f9,%rax
+  80027d:	00 00 00 
+  800280:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800282:	bf 00 00 00 00       	mov    $0x0,%edi
+  800287:	48 b8 92 13 80 00 00 	movabs $0x801392,%rax
+  80028e:	00 00 00 
+  800291:	ff d0                	call   *%rax
+}
+  800293:	5d                   	pop    %rbp
+  800294:	c3                   	ret
+
+0000000000800295 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800295:	55                   	push   %rbp
+  800296:	48 89 e5             	mov    %rsp,%rbp
+  800299:	41 56                	push   %r14
+  80029b:	41 55                	push   %r13
+  80029d:	41 54                	push   %r12
+  80029f:	53                   	push   %rbx
+  8002a0:	48 83 ec 50          	sub    $0x50,%rsp
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+  8002a7:	41 89 f5             	mov    %esi,%r13d
+  8002aa:	48 89 d3             	mov    %rdx,%rbx
+  8002ad:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002b1:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002b5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002b9:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002c0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002c4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002c8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002cc:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002d0:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002d7:	00 00 00 
+  8002da:	4c 8b 30             	mov    (%rax),%r14
+  8002dd:	48 b8 fd 13 80 00 00 	movabs $0x8013fd,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+  8002e9:	89 c6                	mov    %eax,%esi
+  8002eb:	45 89 e8             	mov    %r13d,%r8d
+  8002ee:	4c 89 e1             	mov    %r12,%rcx
+  8002f1:	4c 89 f2             	mov    %r14,%rdx
+  8002f4:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  8002fb:	00 00 00 
+  8002fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800303:	49 bc e5 03 80 00 00 	movabs $0x8003e5,%r12
+  80030a:	00 00 00 
+  80030d:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800310:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800314:	48 89 df             	mov    %rbx,%rdi
+  800317:	48 b8 81 03 80 00 00 	movabs $0x800381,%rax
+  80031e:	00 00 00 
+  800321:	ff d0                	call   *%rax
+    cprintf("\n");
+  800323:	48 bf a3 56 80 00 00 	movabs $0x8056a3,%rdi
+  80032a:	00 00 00 
+  80032d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800332:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800335:	cc                   	int3
+  800336:	eb fd                	jmp    800335 <_panic+0xa0>
+
+0000000000800338 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800338:	55                   	push   %rbp
+  800339:	48 89 e5             	mov    %rsp,%rbp
+  80033c:	53                   	push   %rbx
+  80033d:	48 83 ec 08          	sub    $0x8,%rsp
+  800341:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800344:	8b 06                	mov    (%rsi),%eax
+  800346:	8d 50 01             	lea    0x1(%rax),%edx
+  800349:	89 16                	mov    %edx,(%rsi)
+  80034b:	48 98                	cltq
+  80034d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800352:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800358:	74 0a                	je     800364 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80035a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80035e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800362:	c9                   	leave
+  800363:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800364:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800368:	be ff 00 00 00       	mov    $0xff,%esi
+  80036d:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  800374:	00 00 00 
+  800377:	ff d0                	call   *%rax
+        state->offset = 0;
+  800379:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80037f:	eb d9                	jmp    80035a <putch+0x22>
+
+0000000000800381 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800381:	55                   	push   %rbp
+  800382:	48 89 e5             	mov    %rsp,%rbp
+  800385:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80038c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80038f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800396:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80039b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003a3:	48 89 f1             	mov    %rsi,%rcx
+  8003a6:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003ad:	48 bf 38 03 80 00 00 	movabs $0x800338,%rdi
+  8003b4:	00 00 00 
+  8003b7:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  8003be:	00 00 00 
+  8003c1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003c3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003ca:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003d1:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  8003d8:	00 00 00 
+  8003db:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003dd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003e3:	c9                   	leave
+  8003e4:	c3                   	ret
+
+00000000008003e5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003e5:	55                   	push   %rbp
+  8003e6:	48 89 e5             	mov    %rsp,%rbp
+  8003e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8003ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800401:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800408:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80040c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800410:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800414:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800418:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80041c:	48 b8 81 03 80 00 00 	movabs $0x800381,%rax
+  800423:	00 00 00 
+  800426:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800428:	c9                   	leave
+  800429:	c3                   	ret
+
+000000000080042a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80042a:	55                   	push   %rbp
+  80042b:	48 89 e5             	mov    %rsp,%rbp
+  80042e:	41 57                	push   %r15
+  800430:	41 56                	push   %r14
+  800432:	41 55                	push   %r13
+  800434:	41 54                	push   %r12
+  800436:	53                   	push   %rbx
+  800437:	48 83 ec 18          	sub    $0x18,%rsp
+  80043b:	49 89 fc             	mov    %rdi,%r12
+  80043e:	49 89 f5             	mov    %rsi,%r13
+  800441:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800445:	8b 45 10             	mov    0x10(%rbp),%eax
+  800448:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80044b:	41 89 cf             	mov    %ecx,%r15d
+  80044e:	4c 39 fa             	cmp    %r15,%rdx
+  800451:	73 5b                	jae    8004ae <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800453:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800457:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80045b:	85 db                	test   %ebx,%ebx
+  80045d:	7e 0e                	jle    80046d <print_num+0x43>
+            putch(padc, put_arg);
+  80045f:	4c 89 ee             	mov    %r13,%rsi
+  800462:	44 89 f7             	mov    %r14d,%edi
+  800465:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800468:	83 eb 01             	sub    $0x1,%ebx
+  80046b:	75 f2                	jne    80045f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80046d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800471:	48 b9 9c 50 80 00 00 	movabs $0x80509c,%rcx
+  800478:	00 00 00 
+  80047b:	48 b8 8b 50 80 00 00 	movabs $0x80508b,%rax
+  800482:	00 00 00 
+  800485:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800489:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80048d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800492:	49 f7 f7             	div    %r15
+  800495:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800499:	4c 89 ee             	mov    %r13,%rsi
+  80049c:	41 ff d4             	call   *%r12
+}
+  80049f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004a3:	5b                   	pop    %rbx
+  8004a4:	41 5c                	pop    %r12
+  8004a6:	41 5d                	pop    %r13
+  8004a8:	41 5e                	pop    %r14
+  8004aa:	41 5f                	pop    %r15
+  8004ac:	5d                   	pop    %rbp
+  8004ad:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b7:	49 f7 f7             	div    %r15
+  8004ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8004be:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004c2:	52                   	push   %rdx
+  8004c3:	45 0f be c9          	movsbl %r9b,%r9d
+  8004c7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004cb:	48 89 c2             	mov    %rax,%rdx
+  8004ce:	48 b8 2a 04 80 00 00 	movabs $0x80042a,%rax
+  8004d5:	00 00 00 
+  8004d8:	ff d0                	call   *%rax
+  8004da:	48 83 c4 10          	add    $0x10,%rsp
+  8004de:	eb 8d                	jmp    80046d <print_num+0x43>
+
+00000000008004e0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004e0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004e4:	48 8b 06             	mov    (%rsi),%rax
+  8004e7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004eb:	73 0a                	jae    8004f7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004ed:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004f1:	48 89 16             	mov    %rdx,(%rsi)
+  8004f4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004f7:	c3                   	ret
+
+00000000008004f8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004f8:	55                   	push   %rbp
+  8004f9:	48 89 e5             	mov    %rsp,%rbp
+  8004fc:	48 83 ec 50          	sub    $0x50,%rsp
+  800500:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800504:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800508:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80050c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800513:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800517:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80051b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80051f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800523:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800527:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  80052e:	00 00 00 
+  800531:	ff d0                	call   *%rax
+}
+  800533:	c9                   	leave
+  800534:	c3                   	ret
+
+0000000000800535 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800535:	55                   	push   %rbp
+  800536:	48 89 e5             	mov    %rsp,%rbp
+  800539:	41 57                	push   %r15
+  80053b:	41 56                	push   %r14
+  80053d:	41 55                	push   %r13
+  80053f:	41 54                	push   %r12
+  800541:	53                   	push   %rbx
+  800542:	48 83 ec 38          	sub    $0x38,%rsp
+  800546:	49 89 fe             	mov    %rdi,%r14
+  800549:	49 89 f5             	mov    %rsi,%r13
+  80054c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80054f:	48 8b 01             	mov    (%rcx),%rax
+  800552:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800556:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80055a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80055e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800562:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800566:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80056a:	0f b6 3b             	movzbl (%rbx),%edi
+  80056d:	40 80 ff 25          	cmp    $0x25,%dil
+  800571:	74 18                	je     80058b <vprintfmt+0x56>
+            if (!ch) return;
+  800573:	40 84 ff             	test   %dil,%dil
+  800576:	0f 84 04 07 00 00    	je     800c80 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80057c:	40 0f b6 ff          	movzbl %dil,%edi
+  800580:	4c 89 ee             	mov    %r13,%rsi
+  800583:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800586:	4c 89 e3             	mov    %r12,%rbx
+  800589:	eb db                	jmp    800566 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80058b:	be 00 00 00 00       	mov    $0x0,%esi
+  800590:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800594:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800599:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80059f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005a6:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005aa:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005af:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005b4:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005b7:	83 e8 23             	sub    $0x23,%eax
+  8005ba:	3c 57                	cmp    $0x57,%al
+  8005bc:	0f 87 a4 06 00 00    	ja     800c66 <vprintfmt+0x731>
+  8005c2:	0f b6 c0             	movzbl %al,%eax
+  8005c5:	48 b9 20 52 80 00 00 	movabs $0x805220,%rcx
+  8005cc:	00 00 00 
+  8005cf:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005d2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005d5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005d9:	eb cf                	jmp    8005aa <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005db:	49 89 dc             	mov    %rbx,%r12
+  8005de:	be 01 00 00 00       	mov    $0x1,%esi
+  8005e3:	eb c5                	jmp    8005aa <vprintfmt+0x75>
+            padc = ch;
+  8005e5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005e9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005ec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ef:	eb b9                	jmp    8005aa <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8005f7:	77 24                	ja     80061d <vprintfmt+0xe8>
+  8005f9:	89 c1                	mov    %eax,%ecx
+  8005fb:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005ff:	83 c0 08             	add    $0x8,%eax
+  800602:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800605:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800608:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80060b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80060f:	79 99                	jns    8005aa <vprintfmt+0x75>
+                width = precision;
+  800611:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800615:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80061b:	eb 8d                	jmp    8005aa <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80061d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800621:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800625:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800629:	eb da                	jmp    800605 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80062b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800630:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800634:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80063a:	3c 39                	cmp    $0x39,%al
+  80063c:	77 1c                	ja     80065a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80063e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800642:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800646:	0f b6 c0             	movzbl %al,%eax
+  800649:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80064e:	0f b6 03             	movzbl (%rbx),%eax
+  800651:	3c 39                	cmp    $0x39,%al
+  800653:	76 e9                	jbe    80063e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800655:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800658:	eb b1                	jmp    80060b <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80065a:	49 89 dc             	mov    %rbx,%r12
+  80065d:	eb ac                	jmp    80060b <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80065f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800662:	85 c9                	test   %ecx,%ecx
+  800664:	b8 00 00 00 00       	mov    $0x0,%eax
+  800669:	0f 49 c1             	cmovns %ecx,%eax
+  80066c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80066f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800672:	e9 33 ff ff ff       	jmp    8005aa <vprintfmt+0x75>
+            lflag++;
+  800677:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80067a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80067d:	e9 28 ff ff ff       	jmp    8005aa <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800682:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800685:	83 f8 2f             	cmp    $0x2f,%eax
+  800688:	77 19                	ja     8006a3 <vprintfmt+0x16e>
+  80068a:	89 c2                	mov    %eax,%edx
+  80068c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800690:	83 c0 08             	add    $0x8,%eax
+  800693:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800696:	8b 3a                	mov    (%rdx),%edi
+  800698:	4c 89 ee             	mov    %r13,%rsi
+  80069b:	41 ff d6             	call   *%r14
+            break;
+  80069e:	e9 c3 fe ff ff       	jmp    800566 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006af:	eb e5                	jmp    800696 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b7:	77 5a                	ja     800713 <vprintfmt+0x1de>
+  8006b9:	89 c2                	mov    %eax,%edx
+  8006bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bf:	83 c0 08             	add    $0x8,%eax
+  8006c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006c5:	8b 02                	mov    (%rdx),%eax
+  8006c7:	89 c1                	mov    %eax,%ecx
+  8006c9:	f7 d9                	neg    %ecx
+  8006cb:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006ce:	83 f9 13             	cmp    $0x13,%ecx
+  8006d1:	7f 4e                	jg     800721 <vprintfmt+0x1ec>
+  8006d3:	48 63 c1             	movslq %ecx,%rax
+  8006d6:	48 ba e0 54 80 00 00 	movabs $0x8054e0,%rdx
+  8006dd:	00 00 00 
+  8006e0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006e4:	48 85 c0             	test   %rax,%rax
+  8006e7:	74 38                	je     800721 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006e9:	48 89 c1             	mov    %rax,%rcx
+  8006ec:	48 ba 1d 57 80 00 00 	movabs $0x80571d,%rdx
+  8006f3:	00 00 00 
+  8006f6:	4c 89 ee             	mov    %r13,%rsi
+  8006f9:	4c 89 f7             	mov    %r14,%rdi
+  8006fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800701:	49 b8 f8 04 80 00 00 	movabs $0x8004f8,%r8
+  800708:	00 00 00 
+  80070b:	41 ff d0             	call   *%r8
+  80070e:	e9 53 fe ff ff       	jmp    800566 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800713:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800717:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80071b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80071f:	eb a4                	jmp    8006c5 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800721:	48 ba b4 50 80 00 00 	movabs $0x8050b4,%rdx
+  800728:	00 00 00 
+  80072b:	4c 89 ee             	mov    %r13,%rsi
+  80072e:	4c 89 f7             	mov    %r14,%rdi
+  800731:	b8 00 00 00 00       	mov    $0x0,%eax
+  800736:	49 b8 f8 04 80 00 00 	movabs $0x8004f8,%r8
+  80073d:	00 00 00 
+  800740:	41 ff d0             	call   *%r8
+  800743:	e9 1e fe ff ff       	jmp    800566 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800748:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074b:	83 f8 2f             	cmp    $0x2f,%eax
+  80074e:	77 36                	ja     800786 <vprintfmt+0x251>
+  800750:	89 c2                	mov    %eax,%edx
+  800752:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800756:	83 c0 08             	add    $0x8,%eax
+  800759:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075c:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80075f:	48 85 f6             	test   %rsi,%rsi
+  800762:	48 b8 ad 50 80 00 00 	movabs $0x8050ad,%rax
+  800769:	00 00 00 
+  80076c:	48 0f 45 c6          	cmovne %rsi,%rax
+  800770:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800774:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800778:	7e 06                	jle    800780 <vprintfmt+0x24b>
+  80077a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80077e:	75 14                	jne    800794 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800780:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800784:	eb 5b                	jmp    8007e1 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800786:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800792:	eb c8                	jmp    80075c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800794:	49 63 f7             	movslq %r15d,%rsi
+  800797:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80079b:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  8007a2:	00 00 00 
+  8007a5:	ff d0                	call   *%rax
+  8007a7:	48 89 c2             	mov    %rax,%rdx
+  8007aa:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007ad:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007af:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007b2:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007b5:	85 c0                	test   %eax,%eax
+  8007b7:	7e c7                	jle    800780 <vprintfmt+0x24b>
+  8007b9:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007be:	4c 89 ee             	mov    %r13,%rsi
+  8007c1:	44 89 e7             	mov    %r12d,%edi
+  8007c4:	41 ff d6             	call   *%r14
+  8007c7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007cb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007ce:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007d1:	75 eb                	jne    8007be <vprintfmt+0x289>
+  8007d3:	eb ab                	jmp    800780 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007d5:	0f b6 f8             	movzbl %al,%edi
+  8007d8:	4c 89 ee             	mov    %r13,%rsi
+  8007db:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8007de:	4c 89 e2             	mov    %r12,%rdx
+  8007e1:	45 85 ff             	test   %r15d,%r15d
+  8007e4:	78 06                	js     8007ec <vprintfmt+0x2b7>
+  8007e6:	41 83 ef 01          	sub    $0x1,%r15d
+  8007ea:	78 23                	js     80080f <vprintfmt+0x2da>
+  8007ec:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8007f0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007f6:	84 c0                	test   %al,%al
+  8007f8:	74 15                	je     80080f <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007fa:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007fe:	74 d5                	je     8007d5 <vprintfmt+0x2a0>
+  800800:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800803:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800808:	80 fa 5e             	cmp    $0x5e,%dl
+  80080b:	77 cb                	ja     8007d8 <vprintfmt+0x2a3>
+  80080d:	eb c6                	jmp    8007d5 <vprintfmt+0x2a0>
+  80080f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800812:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800815:	01 f0                	add    %esi,%eax
+  800817:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800819:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80081d:	85 c0                	test   %eax,%eax
+  80081f:	0f 8e 41 fd ff ff    	jle    800566 <vprintfmt+0x31>
+  800825:	4c 89 ee             	mov    %r13,%rsi
+  800828:	bf 20 00 00 00       	mov    $0x20,%edi
+  80082d:	41 ff d6             	call   *%r14
+  800830:	41 83 ec 01          	sub    $0x1,%r12d
+  800834:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800838:	75 eb                	jne    800825 <vprintfmt+0x2f0>
+  80083a:	e9 27 fd ff ff       	jmp    800566 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80083f:	40 84 f6             	test   %sil,%sil
+  800842:	75 26                	jne    80086a <vprintfmt+0x335>
+    switch (lflag) {
+  800844:	85 d2                	test   %edx,%edx
+  800846:	74 59                	je     8008a1 <vprintfmt+0x36c>
+  800848:	83 fa 01             	cmp    $0x1,%edx
+  80084b:	74 7b                	je     8008c8 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80084d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800850:	83 f8 2f             	cmp    $0x2f,%eax
+  800853:	0f 87 96 00 00 00    	ja     8008ef <vprintfmt+0x3ba>
+  800859:	89 c2                	mov    %eax,%edx
+  80085b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085f:	83 c0 08             	add    $0x8,%eax
+  800862:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800865:	4c 8b 22             	mov    (%rdx),%r12
+  800868:	eb 17                	jmp    800881 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80086a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086d:	83 f8 2f             	cmp    $0x2f,%eax
+  800870:	77 21                	ja     800893 <vprintfmt+0x35e>
+  800872:	89 c2                	mov    %eax,%edx
+  800874:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800878:	83 c0 08             	add    $0x8,%eax
+  80087b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800881:	4d 85 e4             	test   %r12,%r12
+  800884:	78 7a                	js     800900 <vprintfmt+0x3cb>
+            num = i;
+  800886:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800889:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80088e:	e9 b5 02 00 00       	jmp    800b48 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800893:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800897:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089f:	eb dd                	jmp    80087e <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8008a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a7:	77 11                	ja     8008ba <vprintfmt+0x385>
+  8008a9:	89 c2                	mov    %eax,%edx
+  8008ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008af:	83 c0 08             	add    $0x8,%eax
+  8008b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b5:	4c 63 22             	movslq (%rdx),%r12
+  8008b8:	eb c7                	jmp    800881 <vprintfmt+0x34c>
+  8008ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c6:	eb ed                	jmp    8008b5 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8008c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ce:	77 11                	ja     8008e1 <vprintfmt+0x3ac>
+  8008d0:	89 c2                	mov    %eax,%edx
+  8008d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d6:	83 c0 08             	add    $0x8,%eax
+  8008d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dc:	4c 8b 22             	mov    (%rdx),%r12
+  8008df:	eb a0                	jmp    800881 <vprintfmt+0x34c>
+  8008e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ed:	eb ed                	jmp    8008dc <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8008ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fb:	e9 65 ff ff ff       	jmp    800865 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800900:	4c 89 ee             	mov    %r13,%rsi
+  800903:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800908:	41 ff d6             	call   *%r14
+                i = -i;
+  80090b:	49 f7 dc             	neg    %r12
+  80090e:	e9 73 ff ff ff       	jmp    800886 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800913:	40 84 f6             	test   %sil,%sil
+  800916:	75 32                	jne    80094a <vprintfmt+0x415>
+    switch (lflag) {
+  800918:	85 d2                	test   %edx,%edx
+  80091a:	74 5d                	je     800979 <vprintfmt+0x444>
+  80091c:	83 fa 01             	cmp    $0x1,%edx
+  80091f:	0f 84 82 00 00 00    	je     8009a7 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800925:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800928:	83 f8 2f             	cmp    $0x2f,%eax
+  80092b:	0f 87 a5 00 00 00    	ja     8009d6 <vprintfmt+0x4a1>
+  800931:	89 c2                	mov    %eax,%edx
+  800933:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800937:	83 c0 08             	add    $0x8,%eax
+  80093a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800940:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800945:	e9 fe 01 00 00       	jmp    800b48 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80094a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094d:	83 f8 2f             	cmp    $0x2f,%eax
+  800950:	77 19                	ja     80096b <vprintfmt+0x436>
+  800952:	89 c2                	mov    %eax,%edx
+  800954:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800958:	83 c0 08             	add    $0x8,%eax
+  80095b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800961:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800966:	e9 dd 01 00 00       	jmp    800b48 <vprintfmt+0x613>
+  80096b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800973:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800977:	eb e5                	jmp    80095e <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800979:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097c:	83 f8 2f             	cmp    $0x2f,%eax
+  80097f:	77 18                	ja     800999 <vprintfmt+0x464>
+  800981:	89 c2                	mov    %eax,%edx
+  800983:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800987:	83 c0 08             	add    $0x8,%eax
+  80098a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80098f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800994:	e9 af 01 00 00       	jmp    800b48 <vprintfmt+0x613>
+  800999:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a5:	eb e6                	jmp    80098d <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8009a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ad:	77 19                	ja     8009c8 <vprintfmt+0x493>
+  8009af:	89 c2                	mov    %eax,%edx
+  8009b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b5:	83 c0 08             	add    $0x8,%eax
+  8009b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009be:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c3:	e9 80 01 00 00       	jmp    800b48 <vprintfmt+0x613>
+  8009c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d4:	eb e5                	jmp    8009bb <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8009d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e2:	e9 56 ff ff ff       	jmp    80093d <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e7:	40 84 f6             	test   %sil,%sil
+  8009ea:	75 2e                	jne    800a1a <vprintfmt+0x4e5>
+    switch (lflag) {
+  8009ec:	85 d2                	test   %edx,%edx
+  8009ee:	0f 84 b3 00 00 00    	je     800aa7 <vprintfmt+0x572>
+  8009f4:	83 fa 01             	cmp    $0x1,%edx
+  8009f7:	0f 84 d3 00 00 00    	je     800ad0 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8009fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a00:	83 f8 2f             	cmp    $0x2f,%eax
+  800a03:	0f 87 f1 00 00 00    	ja     800afa <vprintfmt+0x5c5>
+  800a09:	89 c2                	mov    %eax,%edx
+  800a0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0f:	83 c0 08             	add    $0x8,%eax
+  800a12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a15:	48 8b 02             	mov    (%rdx),%rax
+  800a18:	eb 17                	jmp    800a31 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a20:	77 77                	ja     800a99 <vprintfmt+0x564>
+  800a22:	89 c2                	mov    %eax,%edx
+  800a24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a28:	83 c0 08             	add    $0x8,%eax
+  800a2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2e:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800a31:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800a33:	83 f8 07             	cmp    $0x7,%eax
+  800a36:	0f 8e cf 00 00 00    	jle    800b0b <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800a3c:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800a42:	44 89 e7             	mov    %r12d,%edi
+  800a45:	41 c1 e4 03          	shl    $0x3,%r12d
+  800a49:	89 d1                	mov    %edx,%ecx
+  800a4b:	8d 72 07             	lea    0x7(%rdx),%esi
+  800a4e:	85 d2                	test   %edx,%edx
+  800a50:	0f 48 d6             	cmovs  %esi,%edx
+  800a53:	c1 fa 03             	sar    $0x3,%edx
+  800a56:	83 f9 3f             	cmp    $0x3f,%ecx
+  800a59:	7f e7                	jg     800a42 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800a5b:	85 ff                	test   %edi,%edi
+  800a5d:	0f 84 03 fb ff ff    	je     800566 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800a63:	49 63 f4             	movslq %r12d,%rsi
+  800a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a6b:	48 f7 f6             	div    %rsi
+  800a6e:	49 89 d7             	mov    %rdx,%r15
+  800a71:	83 c0 30             	add    $0x30,%eax
+  800a74:	0f be f8             	movsbl %al,%edi
+  800a77:	4c 89 ee             	mov    %r13,%rsi
+  800a7a:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800a7d:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800a80:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800a85:	45 85 e4             	test   %r12d,%r12d
+  800a88:	41 0f 49 d4          	cmovns %r12d,%edx
+  800a8c:	c1 fa 03             	sar    $0x3,%edx
+  800a8f:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800a92:	75 cf                	jne    800a63 <vprintfmt+0x52e>
+  800a94:	e9 cd fa ff ff       	jmp    800566 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800a99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa5:	eb 87                	jmp    800a2e <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800aa7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aaa:	83 f8 2f             	cmp    $0x2f,%eax
+  800aad:	77 13                	ja     800ac2 <vprintfmt+0x58d>
+  800aaf:	89 c2                	mov    %eax,%edx
+  800ab1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab5:	83 c0 08             	add    $0x8,%eax
+  800ab8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abb:	8b 02                	mov    (%rdx),%eax
+  800abd:	e9 6f ff ff ff       	jmp    800a31 <vprintfmt+0x4fc>
+  800ac2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ace:	eb eb                	jmp    800abb <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800ad0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad6:	77 14                	ja     800aec <vprintfmt+0x5b7>
+  800ad8:	89 c2                	mov    %eax,%edx
+  800ada:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ade:	83 c0 08             	add    $0x8,%eax
+  800ae1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae4:	48 8b 02             	mov    (%rdx),%rax
+  800ae7:	e9 45 ff ff ff       	jmp    800a31 <vprintfmt+0x4fc>
+  800aec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af8:	eb ea                	jmp    800ae4 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800afa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b06:	e9 0a ff ff ff       	jmp    800a15 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800b0b:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800b11:	e9 4d ff ff ff       	jmp    800a63 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800b16:	4c 89 ee             	mov    %r13,%rsi
+  800b19:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b1e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b21:	4c 89 ee             	mov    %r13,%rsi
+  800b24:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b29:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b32:	77 47                	ja     800b7b <vprintfmt+0x646>
+  800b34:	89 c2                	mov    %eax,%edx
+  800b36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3a:	83 c0 08             	add    $0x8,%eax
+  800b3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b40:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b43:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b48:	48 83 ec 08          	sub    $0x8,%rsp
+  800b4c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b50:	0f 94 c0             	sete   %al
+  800b53:	0f b6 c0             	movzbl %al,%eax
+  800b56:	50                   	push   %rax
+  800b57:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b5c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b60:	4c 89 ee             	mov    %r13,%rsi
+  800b63:	4c 89 f7             	mov    %r14,%rdi
+  800b66:	48 b8 2a 04 80 00 00 	movabs $0x80042a,%rax
+  800b6d:	00 00 00 
+  800b70:	ff d0                	call   *%rax
+            break;
+  800b72:	48 83 c4 10          	add    $0x10,%rsp
+  800b76:	e9 eb f9 ff ff       	jmp    800566 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b87:	eb b7                	jmp    800b40 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800b89:	40 84 f6             	test   %sil,%sil
+  800b8c:	75 2b                	jne    800bb9 <vprintfmt+0x684>
+    switch (lflag) {
+  800b8e:	85 d2                	test   %edx,%edx
+  800b90:	74 56                	je     800be8 <vprintfmt+0x6b3>
+  800b92:	83 fa 01             	cmp    $0x1,%edx
+  800b95:	74 7f                	je     800c16 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800b97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9d:	0f 87 a2 00 00 00    	ja     800c45 <vprintfmt+0x710>
+  800ba3:	89 c2                	mov    %eax,%edx
+  800ba5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba9:	83 c0 08             	add    $0x8,%eax
+  800bac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800baf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bb2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bb7:	eb 8f                	jmp    800b48 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800bb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbf:	77 19                	ja     800bda <vprintfmt+0x6a5>
+  800bc1:	89 c2                	mov    %eax,%edx
+  800bc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc7:	83 c0 08             	add    $0x8,%eax
+  800bca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bd0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bd5:	e9 6e ff ff ff       	jmp    800b48 <vprintfmt+0x613>
+  800bda:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bde:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be6:	eb e5                	jmp    800bcd <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800be8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800beb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bee:	77 18                	ja     800c08 <vprintfmt+0x6d3>
+  800bf0:	89 c2                	mov    %eax,%edx
+  800bf2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf6:	83 c0 08             	add    $0x8,%eax
+  800bf9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bfc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bfe:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c03:	e9 40 ff ff ff       	jmp    800b48 <vprintfmt+0x613>
+  800c08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c14:	eb e6                	jmp    800bfc <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800c16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c19:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1c:	77 19                	ja     800c37 <vprintfmt+0x702>
+  800c1e:	89 c2                	mov    %eax,%edx
+  800c20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c24:	83 c0 08             	add    $0x8,%eax
+  800c27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c2d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c32:	e9 11 ff ff ff       	jmp    800b48 <vprintfmt+0x613>
+  800c37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c43:	eb e5                	jmp    800c2a <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800c45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c51:	e9 59 ff ff ff       	jmp    800baf <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800c56:	4c 89 ee             	mov    %r13,%rsi
+  800c59:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c5e:	41 ff d6             	call   *%r14
+            break;
+  800c61:	e9 00 f9 ff ff       	jmp    800566 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c66:	4c 89 ee             	mov    %r13,%rsi
+  800c69:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c6e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c71:	48 83 eb 01          	sub    $0x1,%rbx
+  800c75:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c79:	75 f6                	jne    800c71 <vprintfmt+0x73c>
+  800c7b:	e9 e6 f8 ff ff       	jmp    800566 <vprintfmt+0x31>
+}
+  800c80:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c84:	5b                   	pop    %rbx
+  800c85:	41 5c                	pop    %r12
+  800c87:	41 5d                	pop    %r13
+  800c89:	41 5e                	pop    %r14
+  800c8b:	41 5f                	pop    %r15
+  800c8d:	5d                   	pop    %rbp
+  800c8e:	c3                   	ret
+
+0000000000800c8f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c8f:	55                   	push   %rbp
+  800c90:	48 89 e5             	mov    %rsp,%rbp
+  800c93:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c97:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c9b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ca0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ca4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cab:	48 85 ff             	test   %rdi,%rdi
+  800cae:	74 2b                	je     800cdb <vsnprintf+0x4c>
+  800cb0:	48 85 f6             	test   %rsi,%rsi
+  800cb3:	74 26                	je     800cdb <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cb5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cb9:	48 bf e0 04 80 00 00 	movabs $0x8004e0,%rdi
+  800cc0:	00 00 00 
+  800cc3:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  800cca:	00 00 00 
+  800ccd:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ccf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cd3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cd6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cd9:	c9                   	leave
+  800cda:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cdb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ce0:	eb f7                	jmp    800cd9 <vsnprintf+0x4a>
+
+0000000000800ce2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ce2:	55                   	push   %rbp
+  800ce3:	48 89 e5             	mov    %rsp,%rbp
+  800ce6:	48 83 ec 50          	sub    $0x50,%rsp
+  800cea:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cee:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cf2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cf6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cfd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d05:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d09:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d0d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d11:	48 b8 8f 0c 80 00 00 	movabs $0x800c8f,%rax
+  800d18:	00 00 00 
+  800d1b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d1d:	c9                   	leave
+  800d1e:	c3                   	ret
+
+0000000000800d1f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d1f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d22:	74 10                	je     800d34 <strlen+0x15>
+    size_t n = 0;
+  800d24:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d29:	48 83 c0 01          	add    $0x1,%rax
+  800d2d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d31:	75 f6                	jne    800d29 <strlen+0xa>
+  800d33:	c3                   	ret
+    size_t n = 0;
+  800d34:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d39:	c3                   	ret
+
+0000000000800d3a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d3a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d3d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d42:	48 85 f6             	test   %rsi,%rsi
+  800d45:	74 11                	je     800d58 <strnlen+0x1e>
+  800d47:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d4b:	74 0c                	je     800d59 <strnlen+0x1f>
+  800d4d:	48 83 c2 01          	add    $0x1,%rdx
+  800d51:	48 39 d0             	cmp    %rdx,%rax
+  800d54:	75 f1                	jne    800d47 <strnlen+0xd>
+  800d56:	eb 04                	jmp    800d5c <strnlen+0x22>
+  800d58:	c3                   	ret
+  800d59:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d5c:	c3                   	ret
+
+0000000000800d5d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d5d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d60:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d65:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d69:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d6c:	48 83 c2 01          	add    $0x1,%rdx
+  800d70:	84 c9                	test   %cl,%cl
+  800d72:	75 f1                	jne    800d65 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d74:	c3                   	ret
+
+0000000000800d75 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d75:	55                   	push   %rbp
+  800d76:	48 89 e5             	mov    %rsp,%rbp
+  800d79:	41 54                	push   %r12
+  800d7b:	53                   	push   %rbx
+  800d7c:	48 89 fb             	mov    %rdi,%rbx
+  800d7f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d82:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  800d89:	00 00 00 
+  800d8c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d8e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d92:	4c 89 e6             	mov    %r12,%rsi
+  800d95:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  800d9c:	00 00 00 
+  800d9f:	ff d0                	call   *%rax
+    return dst;
+}
+  800da1:	48 89 d8             	mov    %rbx,%rax
+  800da4:	5b                   	pop    %rbx
+  800da5:	41 5c                	pop    %r12
+  800da7:	5d                   	pop    %rbp
+  800da8:	c3                   	ret
+
+0000000000800da9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800da9:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800dac:	48 85 d2             	test   %rdx,%rdx
+  800daf:	74 1f                	je     800dd0 <strncpy+0x27>
+  800db1:	48 01 fa             	add    %rdi,%rdx
+  800db4:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800db7:	48 83 c1 01          	add    $0x1,%rcx
+  800dbb:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800dbf:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800dc3:	41 80 f8 01          	cmp    $0x1,%r8b
+  800dc7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800dcb:	48 39 ca             	cmp    %rcx,%rdx
+  800dce:	75 e7                	jne    800db7 <strncpy+0xe>
+    }
+    return ret;
+}
+  800dd0:	c3                   	ret
+
+0000000000800dd1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800dd1:	48 89 f8             	mov    %rdi,%rax
+  800dd4:	48 85 d2             	test   %rdx,%rdx
+  800dd7:	74 24                	je     800dfd <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800dd9:	48 83 ea 01          	sub    $0x1,%rdx
+  800ddd:	74 1b                	je     800dfa <strlcpy+0x29>
+  800ddf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800de3:	0f b6 16             	movzbl (%rsi),%edx
+  800de6:	84 d2                	test   %dl,%dl
+  800de8:	74 10                	je     800dfa <strlcpy+0x29>
+            *dst++ = *src++;
+  800dea:	48 83 c6 01          	add    $0x1,%rsi
+  800dee:	48 83 c0 01          	add    $0x1,%rax
+  800df2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800df5:	48 39 c8             	cmp    %rcx,%rax
+  800df8:	75 e9                	jne    800de3 <strlcpy+0x12>
+        *dst = '\0';
+  800dfa:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dfd:	48 29 f8             	sub    %rdi,%rax
+}
+  800e00:	c3                   	ret
+
+0000000000800e01 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e01:	0f b6 07             	movzbl (%rdi),%eax
+  800e04:	84 c0                	test   %al,%al
+  800e06:	74 13                	je     800e1b <strcmp+0x1a>
+  800e08:	38 06                	cmp    %al,(%rsi)
+  800e0a:	75 0f                	jne    800e1b <strcmp+0x1a>
+  800e0c:	48 83 c7 01          	add    $0x1,%rdi
+  800e10:	48 83 c6 01          	add    $0x1,%rsi
+  800e14:	0f b6 07             	movzbl (%rdi),%eax
+  800e17:	84 c0                	test   %al,%al
+  800e19:	75 ed                	jne    800e08 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e1b:	0f b6 c0             	movzbl %al,%eax
+  800e1e:	0f b6 16             	movzbl (%rsi),%edx
+  800e21:	29 d0                	sub    %edx,%eax
+}
+  800e23:	c3                   	ret
+
+0000000000800e24 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e24:	48 85 d2             	test   %rdx,%rdx
+  800e27:	74 1f                	je     800e48 <strncmp+0x24>
+  800e29:	0f b6 07             	movzbl (%rdi),%eax
+  800e2c:	84 c0                	test   %al,%al
+  800e2e:	74 1e                	je     800e4e <strncmp+0x2a>
+  800e30:	3a 06                	cmp    (%rsi),%al
+  800e32:	75 1a                	jne    800e4e <strncmp+0x2a>
+  800e34:	48 83 c7 01          	add    $0x1,%rdi
+  800e38:	48 83 c6 01          	add    $0x1,%rsi
+  800e3c:	48 83 ea 01          	sub    $0x1,%rdx
+  800e40:	75 e7                	jne    800e29 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e47:	c3                   	ret
+  800e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4d:	c3                   	ret
+  800e4e:	48 85 d2             	test   %rdx,%rdx
+  800e51:	74 09                	je     800e5c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e53:	0f b6 07             	movzbl (%rdi),%eax
+  800e56:	0f b6 16             	movzbl (%rsi),%edx
+  800e59:	29 d0                	sub    %edx,%eax
+  800e5b:	c3                   	ret
+    if (!n) return 0;
+  800e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e61:	c3                   	ret
+
+0000000000800e62 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e62:	0f b6 17             	movzbl (%rdi),%edx
+  800e65:	84 d2                	test   %dl,%dl
+  800e67:	74 18                	je     800e81 <strchr+0x1f>
+        if (*str == c) {
+  800e69:	0f be d2             	movsbl %dl,%edx
+  800e6c:	39 f2                	cmp    %esi,%edx
+  800e6e:	74 17                	je     800e87 <strchr+0x25>
+    for (; *str; str++) {
+  800e70:	48 83 c7 01          	add    $0x1,%rdi
+  800e74:	0f b6 17             	movzbl (%rdi),%edx
+  800e77:	84 d2                	test   %dl,%dl
+  800e79:	75 ee                	jne    800e69 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e80:	c3                   	ret
+  800e81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e86:	c3                   	ret
+  800e87:	48 89 f8             	mov    %rdi,%rax
+}
+  800e8a:	c3                   	ret
+
+0000000000800e8b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e8b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e8e:	0f b6 17             	movzbl (%rdi),%edx
+  800e91:	84 d2                	test   %dl,%dl
+  800e93:	74 13                	je     800ea8 <strfind+0x1d>
+  800e95:	0f be d2             	movsbl %dl,%edx
+  800e98:	39 f2                	cmp    %esi,%edx
+  800e9a:	74 0b                	je     800ea7 <strfind+0x1c>
+  800e9c:	48 83 c0 01          	add    $0x1,%rax
+  800ea0:	0f b6 10             	movzbl (%rax),%edx
+  800ea3:	84 d2                	test   %dl,%dl
+  800ea5:	75 ee                	jne    800e95 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ea7:	c3                   	ret
+  800ea8:	c3                   	ret
+
+0000000000800ea9 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800ea9:	55                   	push   %rbp
+  800eaa:	48 89 e5             	mov    %rsp,%rbp
+  800ead:	41 57                	push   %r15
+  800eaf:	41 56                	push   %r14
+  800eb1:	41 55                	push   %r13
+  800eb3:	41 54                	push   %r12
+  800eb5:	53                   	push   %rbx
+  800eb6:	48 83 ec 08          	sub    $0x8,%rsp
+  800eba:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800ebd:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800ec1:	45 84 ed             	test   %r13b,%r13b
+  800ec4:	75 12                	jne    800ed8 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800ec6:	4c 89 f8             	mov    %r15,%rax
+  800ec9:	48 83 c4 08          	add    $0x8,%rsp
+  800ecd:	5b                   	pop    %rbx
+  800ece:	41 5c                	pop    %r12
+  800ed0:	41 5d                	pop    %r13
+  800ed2:	41 5e                	pop    %r14
+  800ed4:	41 5f                	pop    %r15
+  800ed6:	5d                   	pop    %rbp
+  800ed7:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800ed8:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800edc:	4c 89 e7             	mov    %r12,%rdi
+  800edf:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  800ee6:	00 00 00 
+  800ee9:	ff d0                	call   *%rax
+  800eeb:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800eee:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800ef2:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800ef6:	49 bf 24 0e 80 00 00 	movabs $0x800e24,%r15
+  800efd:	00 00 00 
+				if ((sc = *s++) == 0)
+  800f00:	84 c0                	test   %al,%al
+  800f02:	75 14                	jne    800f18 <strstr+0x6f>
+					return NULL;
+  800f04:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800f0a:	eb ba                	jmp    800ec6 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800f0c:	48 83 c3 01          	add    $0x1,%rbx
+  800f10:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800f14:	84 c0                	test   %al,%al
+  800f16:	74 1b                	je     800f33 <strstr+0x8a>
+			} while (sc != c);
+  800f18:	41 38 c5             	cmp    %al,%r13b
+  800f1b:	75 ef                	jne    800f0c <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800f1d:	4c 89 f2             	mov    %r14,%rdx
+  800f20:	4c 89 e6             	mov    %r12,%rsi
+  800f23:	48 89 df             	mov    %rbx,%rdi
+  800f26:	41 ff d7             	call   *%r15
+  800f29:	85 c0                	test   %eax,%eax
+  800f2b:	75 df                	jne    800f0c <strstr+0x63>
+  800f2d:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800f31:	eb 93                	jmp    800ec6 <strstr+0x1d>
+					return NULL;
+  800f33:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800f39:	eb 8b                	jmp    800ec6 <strstr+0x1d>
+
+0000000000800f3b <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800f3b:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800f3d:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800f40:	8d 57 20             	lea    0x20(%rdi),%edx
+  800f43:	83 f9 1a             	cmp    $0x1a,%ecx
+  800f46:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800f49:	c3                   	ret
+
+0000000000800f4a <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800f4a:	55                   	push   %rbp
+  800f4b:	48 89 e5             	mov    %rsp,%rbp
+  800f4e:	41 57                	push   %r15
+  800f50:	41 56                	push   %r14
+  800f52:	41 55                	push   %r13
+  800f54:	41 54                	push   %r12
+  800f56:	53                   	push   %rbx
+  800f57:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800f5b:	48 39 f7             	cmp    %rsi,%rdi
+  800f5e:	74 49                	je     800fa9 <strcasecmp+0x5f>
+  800f60:	49 89 fd             	mov    %rdi,%r13
+  800f63:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800f66:	49 bf 3b 0f 80 00 00 	movabs $0x800f3b,%r15
+  800f6d:	00 00 00 
+  800f70:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800f75:	41 0f b6 fe          	movzbl %r14b,%edi
+  800f79:	41 ff d7             	call   *%r15
+  800f7c:	89 c3                	mov    %eax,%ebx
+  800f7e:	49 83 c4 01          	add    $0x1,%r12
+  800f82:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800f88:	41 ff d7             	call   *%r15
+  800f8b:	29 c3                	sub    %eax,%ebx
+  800f8d:	75 09                	jne    800f98 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800f8f:	49 83 c5 01          	add    $0x1,%r13
+  800f93:	45 84 f6             	test   %r14b,%r14b
+  800f96:	75 d8                	jne    800f70 <strcasecmp+0x26>
+}
+  800f98:	89 d8                	mov    %ebx,%eax
+  800f9a:	48 83 c4 08          	add    $0x8,%rsp
+  800f9e:	5b                   	pop    %rbx
+  800f9f:	41 5c                	pop    %r12
+  800fa1:	41 5d                	pop    %r13
+  800fa3:	41 5e                	pop    %r14
+  800fa5:	41 5f                	pop    %r15
+  800fa7:	5d                   	pop    %rbp
+  800fa8:	c3                   	ret
+        return 0;
+  800fa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fae:	eb e8                	jmp    800f98 <strcasecmp+0x4e>
+
+0000000000800fb0 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800fb0:	55                   	push   %rbp
+  800fb1:	48 89 e5             	mov    %rsp,%rbp
+  800fb4:	41 57                	push   %r15
+  800fb6:	41 56                	push   %r14
+  800fb8:	41 55                	push   %r13
+  800fba:	41 54                	push   %r12
+  800fbc:	53                   	push   %rbx
+  800fbd:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800fc1:	48 85 d2             	test   %rdx,%rdx
+  800fc4:	74 4f                	je     801015 <strncasecmp+0x65>
+  800fc6:	49 89 fc             	mov    %rdi,%r12
+  800fc9:	49 89 f5             	mov    %rsi,%r13
+  800fcc:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800fd0:	49 be 3b 0f 80 00 00 	movabs $0x800f3b,%r14
+  800fd7:	00 00 00 
+  800fda:	49 83 c4 01          	add    $0x1,%r12
+  800fde:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800fe4:	41 ff d6             	call   *%r14
+  800fe7:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800fe9:	49 83 c5 01          	add    $0x1,%r13
+  800fed:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800ff2:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800ff5:	29 c3                	sub    %eax,%ebx
+  800ff7:	85 c0                	test   %eax,%eax
+  800ff9:	74 09                	je     801004 <strncasecmp+0x54>
+  800ffb:	85 db                	test   %ebx,%ebx
+  800ffd:	75 05                	jne    801004 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800fff:	4d 39 fc             	cmp    %r15,%r12
+  801002:	75 d6                	jne    800fda <strncasecmp+0x2a>
+}
+  801004:	89 d8                	mov    %ebx,%eax
+  801006:	48 83 c4 08          	add    $0x8,%rsp
+  80100a:	5b                   	pop    %rbx
+  80100b:	41 5c                	pop    %r12
+  80100d:	41 5d                	pop    %r13
+  80100f:	41 5e                	pop    %r14
+  801011:	41 5f                	pop    %r15
+  801013:	5d                   	pop    %rbp
+  801014:	c3                   	ret
+    int d = 0;
+  801015:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  80101a:	eb e8                	jmp    801004 <strncasecmp+0x54>
+
+000000000080101c <toupper>:
+
+int toupper(int c) {
+  80101c:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  80101e:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801021:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801024:	83 f9 1a             	cmp    $0x1a,%ecx
+  801027:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80102a:	c3                   	ret
+
+000000000080102b <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  80102b:	83 ff 20             	cmp    $0x20,%edi
+  80102e:	0f 94 c0             	sete   %al
+  801031:	0f b6 c0             	movzbl %al,%eax
+}
+  801034:	c3                   	ret
+
+0000000000801035 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  801035:	89 f8                	mov    %edi,%eax
+  801037:	f7 d8                	neg    %eax
+  801039:	0f 48 c7             	cmovs  %edi,%eax
+}
+  80103c:	c3                   	ret
+
+000000000080103d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80103d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801040:	48 89 f8             	mov    %rdi,%rax
+  801043:	48 f7 d8             	neg    %rax
+  801046:	83 e0 07             	and    $0x7,%eax
+  801049:	49 89 d1             	mov    %rdx,%r9
+  80104c:	49 29 c1             	sub    %rax,%r9
+  80104f:	78 36                	js     801087 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801051:	40 0f b6 c6          	movzbl %sil,%eax
+  801055:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80105c:	01 01 01 
+  80105f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801063:	40 f6 c7 07          	test   $0x7,%dil
+  801067:	75 38                	jne    8010a1 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801069:	4c 89 c9             	mov    %r9,%rcx
+  80106c:	48 c1 f9 03          	sar    $0x3,%rcx
+  801070:	74 0c                	je     80107e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801072:	fc                   	cld
+  801073:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801076:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80107a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80107e:	4d 85 c9             	test   %r9,%r9
+  801081:	75 45                	jne    8010c8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801083:	4c 89 c0             	mov    %r8,%rax
+  801086:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801087:	48 85 d2             	test   %rdx,%rdx
+  80108a:	74 f7                	je     801083 <memset+0x46>
+  80108c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80108f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801092:	48 83 c0 01          	add    $0x1,%rax
+  801096:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80109a:	48 39 c2             	cmp    %rax,%rdx
+  80109d:	75 f3                	jne    801092 <memset+0x55>
+  80109f:	eb e2                	jmp    801083 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8010a1:	40 f6 c7 01          	test   $0x1,%dil
+  8010a5:	74 06                	je     8010ad <memset+0x70>
+  8010a7:	88 07                	mov    %al,(%rdi)
+  8010a9:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010ad:	40 f6 c7 02          	test   $0x2,%dil
+  8010b1:	74 07                	je     8010ba <memset+0x7d>
+  8010b3:	66 89 07             	mov    %ax,(%rdi)
+  8010b6:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010ba:	40 f6 c7 04          	test   $0x4,%dil
+  8010be:	74 a9                	je     801069 <memset+0x2c>
+  8010c0:	89 07                	mov    %eax,(%rdi)
+  8010c2:	48 83 c7 04          	add    $0x4,%rdi
+  8010c6:	eb a1                	jmp    801069 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010c8:	41 f6 c1 04          	test   $0x4,%r9b
+  8010cc:	74 06                	je     8010d4 <memset+0x97>
+  8010ce:	89 07                	mov    %eax,(%rdi)
+  8010d0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010d4:	41 f6 c1 02          	test   $0x2,%r9b
+  8010d8:	74 07                	je     8010e1 <memset+0xa4>
+  8010da:	66 89 07             	mov    %ax,(%rdi)
+  8010dd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010e1:	41 f6 c1 01          	test   $0x1,%r9b
+  8010e5:	74 9c                	je     801083 <memset+0x46>
+  8010e7:	88 07                	mov    %al,(%rdi)
+  8010e9:	eb 98                	jmp    801083 <memset+0x46>
+
+00000000008010eb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010eb:	48 89 f8             	mov    %rdi,%rax
+  8010ee:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010f1:	48 39 fe             	cmp    %rdi,%rsi
+  8010f4:	73 3b                	jae    801131 <memmove+0x46>
+  8010f6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010fa:	48 39 d7             	cmp    %rdx,%rdi
+  8010fd:	73 32                	jae    801131 <memmove+0x46>
+        s += n;
+        d += n;
+  8010ff:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801103:	48 89 d6             	mov    %rdx,%rsi
+  801106:	48 09 fe             	or     %rdi,%rsi
+  801109:	48 09 ce             	or     %rcx,%rsi
+  80110c:	40 f6 c6 07          	test   $0x7,%sil
+  801110:	75 12                	jne    801124 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801112:	48 83 ef 08          	sub    $0x8,%rdi
+  801116:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80111a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80111e:	fd                   	std
+  80111f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801122:	fc                   	cld
+  801123:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801124:	48 83 ef 01          	sub    $0x1,%rdi
+  801128:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80112c:	fd                   	std
+  80112d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80112f:	eb f1                	jmp    801122 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801131:	48 89 f2             	mov    %rsi,%rdx
+  801134:	48 09 c2             	or     %rax,%rdx
+  801137:	48 09 ca             	or     %rcx,%rdx
+  80113a:	f6 c2 07             	test   $0x7,%dl
+  80113d:	75 0c                	jne    80114b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80113f:	48 c1 e9 03          	shr    $0x3,%rcx
+  801143:	48 89 c7             	mov    %rax,%rdi
+  801146:	fc                   	cld
+  801147:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80114a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80114b:	48 89 c7             	mov    %rax,%rdi
+  80114e:	fc                   	cld
+  80114f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801151:	c3                   	ret
+
+0000000000801152 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801152:	55                   	push   %rbp
+  801153:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801156:	48 b8 eb 10 80 00 00 	movabs $0x8010eb,%rax
+  80115d:	00 00 00 
+  801160:	ff d0                	call   *%rax
+}
+  801162:	5d                   	pop    %rbp
+  801163:	c3                   	ret
+
+0000000000801164 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801164:	55                   	push   %rbp
+  801165:	48 89 e5             	mov    %rsp,%rbp
+  801168:	41 57                	push   %r15
+  80116a:	41 56                	push   %r14
+  80116c:	41 55                	push   %r13
+  80116e:	41 54                	push   %r12
+  801170:	53                   	push   %rbx
+  801171:	48 83 ec 08          	sub    $0x8,%rsp
+  801175:	49 89 fe             	mov    %rdi,%r14
+  801178:	49 89 f7             	mov    %rsi,%r15
+  80117b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80117e:	48 89 f7             	mov    %rsi,%rdi
+  801181:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  801188:	00 00 00 
+  80118b:	ff d0                	call   *%rax
+  80118d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801190:	48 89 de             	mov    %rbx,%rsi
+  801193:	4c 89 f7             	mov    %r14,%rdi
+  801196:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  80119d:	00 00 00 
+  8011a0:	ff d0                	call   *%rax
+  8011a2:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011a5:	48 39 c3             	cmp    %rax,%rbx
+  8011a8:	74 36                	je     8011e0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8011aa:	48 89 d8             	mov    %rbx,%rax
+  8011ad:	4c 29 e8             	sub    %r13,%rax
+  8011b0:	49 39 c4             	cmp    %rax,%r12
+  8011b3:	73 31                	jae    8011e6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8011b5:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011ba:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011be:	4c 89 fe             	mov    %r15,%rsi
+  8011c1:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  8011c8:	00 00 00 
+  8011cb:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011cd:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011d1:	48 83 c4 08          	add    $0x8,%rsp
+  8011d5:	5b                   	pop    %rbx
+  8011d6:	41 5c                	pop    %r12
+  8011d8:	41 5d                	pop    %r13
+  8011da:	41 5e                	pop    %r14
+  8011dc:	41 5f                	pop    %r15
+  8011de:	5d                   	pop    %rbp
+  8011df:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011e0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011e4:	eb eb                	jmp    8011d1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011e6:	48 83 eb 01          	sub    $0x1,%rbx
+  8011ea:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011ee:	48 89 da             	mov    %rbx,%rdx
+  8011f1:	4c 89 fe             	mov    %r15,%rsi
+  8011f4:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  8011fb:	00 00 00 
+  8011fe:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801200:	49 01 de             	add    %rbx,%r14
+  801203:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801208:	eb c3                	jmp    8011cd <strlcat+0x69>
+
+000000000080120a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80120a:	48 85 d2             	test   %rdx,%rdx
+  80120d:	74 2d                	je     80123c <memcmp+0x32>
+  80120f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801214:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801218:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80121d:	44 38 c1             	cmp    %r8b,%cl
+  801220:	75 0f                	jne    801231 <memcmp+0x27>
+    while (n-- > 0) {
+  801222:	48 83 c0 01          	add    $0x1,%rax
+  801226:	48 39 c2             	cmp    %rax,%rdx
+  801229:	75 e9                	jne    801214 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80122b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801230:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801231:	0f b6 c1             	movzbl %cl,%eax
+  801234:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801238:	44 29 c0             	sub    %r8d,%eax
+  80123b:	c3                   	ret
+    return 0;
+  80123c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801241:	c3                   	ret
+
+0000000000801242 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801242:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801246:	48 39 c7             	cmp    %rax,%rdi
+  801249:	73 0f                	jae    80125a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80124b:	40 38 37             	cmp    %sil,(%rdi)
+  80124e:	74 0e                	je     80125e <memfind+0x1c>
+    for (; src < end; src++) {
+  801250:	48 83 c7 01          	add    $0x1,%rdi
+  801254:	48 39 f8             	cmp    %rdi,%rax
+  801257:	75 f2                	jne    80124b <memfind+0x9>
+  801259:	c3                   	ret
+  80125a:	48 89 f8             	mov    %rdi,%rax
+  80125d:	c3                   	ret
+  80125e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801261:	c3                   	ret
+
+0000000000801262 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801262:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801265:	0f b6 37             	movzbl (%rdi),%esi
+  801268:	40 80 fe 20          	cmp    $0x20,%sil
+  80126c:	74 06                	je     801274 <strtol+0x12>
+  80126e:	40 80 fe 09          	cmp    $0x9,%sil
+  801272:	75 13                	jne    801287 <strtol+0x25>
+  801274:	48 83 c7 01          	add    $0x1,%rdi
+  801278:	0f b6 37             	movzbl (%rdi),%esi
+  80127b:	40 80 fe 20          	cmp    $0x20,%sil
+  80127f:	74 f3                	je     801274 <strtol+0x12>
+  801281:	40 80 fe 09          	cmp    $0x9,%sil
+  801285:	74 ed                	je     801274 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801287:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80128a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80128d:	3c 01                	cmp    $0x1,%al
+  80128f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801293:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801299:	75 0f                	jne    8012aa <strtol+0x48>
+  80129b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80129e:	74 14                	je     8012b4 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8012a0:	85 d2                	test   %edx,%edx
+  8012a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012a7:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8012aa:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8012af:	4c 63 ca             	movslq %edx,%r9
+  8012b2:	eb 36                	jmp    8012ea <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012b4:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012b8:	74 0f                	je     8012c9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012ba:	85 d2                	test   %edx,%edx
+  8012bc:	75 ec                	jne    8012aa <strtol+0x48>
+        s++;
+  8012be:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012c2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012c7:	eb e1                	jmp    8012aa <strtol+0x48>
+        s += 2;
+  8012c9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012cd:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012d2:	eb d6                	jmp    8012aa <strtol+0x48>
+            dig -= '0';
+  8012d4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012d7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012db:	41 39 d0             	cmp    %edx,%r8d
+  8012de:	7d 21                	jge    801301 <strtol+0x9f>
+        val = val * base + dig;
+  8012e0:	49 0f af c1          	imul   %r9,%rax
+  8012e4:	0f b6 c9             	movzbl %cl,%ecx
+  8012e7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012ea:	48 83 c7 01          	add    $0x1,%rdi
+  8012ee:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012f2:	80 f9 39             	cmp    $0x39,%cl
+  8012f5:	76 dd                	jbe    8012d4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012f7:	80 f9 7b             	cmp    $0x7b,%cl
+  8012fa:	77 05                	ja     801301 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012fc:	83 e9 57             	sub    $0x57,%ecx
+  8012ff:	eb d6                	jmp    8012d7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801301:	4d 85 d2             	test   %r10,%r10
+  801304:	74 03                	je     801309 <strtol+0xa7>
+  801306:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801309:	48 89 c2             	mov    %rax,%rdx
+  80130c:	48 f7 da             	neg    %rdx
+  80130f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801313:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801317:	c3                   	ret
+
+0000000000801318 <atoi>:
+int atoi(const char *str) {
+  801318:	55                   	push   %rbp
+  801319:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  80131c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801321:	be 00 00 00 00       	mov    $0x0,%esi
+  801326:	48 b8 62 12 80 00 00 	movabs $0x801262,%rax
+  80132d:	00 00 00 
+  801330:	ff d0                	call   *%rax
+}
+  801332:	5d                   	pop    %rbp
+  801333:	c3                   	ret
+
+0000000000801334 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801334:	55                   	push   %rbp
+  801335:	48 89 e5             	mov    %rsp,%rbp
+  801338:	53                   	push   %rbx
+  801339:	48 89 fa             	mov    %rdi,%rdx
+  80133c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80133f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801344:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801349:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134e:	be 00 00 00 00       	mov    $0x0,%esi
+  801353:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801359:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80135b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135f:	c9                   	leave
+  801360:	c3                   	ret
+
+0000000000801361 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801361:	55                   	push   %rbp
+  801362:	48 89 e5             	mov    %rsp,%rbp
+  801365:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801366:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80136b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801370:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801375:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80137f:	be 00 00 00 00       	mov    $0x0,%esi
+  801384:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80138c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801390:	c9                   	leave
+  801391:	c3                   	ret
+
+0000000000801392 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801392:	55                   	push   %rbp
+  801393:	48 89 e5             	mov    %rsp,%rbp
+  801396:	53                   	push   %rbx
+  801397:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80139b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80139e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013bf:	48 85 c0             	test   %rax,%rax
+  8013c2:	7f 06                	jg     8013ca <sys_env_destroy+0x38>
+}
+  8013c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c8:	c9                   	leave
+  8013c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ca:	49 89 c0             	mov    %rax,%r8
+  8013cd:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013d2:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8013d9:	00 00 00 
+  8013dc:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013e1:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8013e8:	00 00 00 
+  8013eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f0:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  8013f7:	00 00 00 
+  8013fa:	41 ff d1             	call   *%r9
+
+00000000008013fd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013fd:	55                   	push   %rbp
+  8013fe:	48 89 e5             	mov    %rsp,%rbp
+  801401:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801402:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801407:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801411:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801416:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141b:	be 00 00 00 00       	mov    $0x0,%esi
+  801420:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801426:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801428:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80142c:	c9                   	leave
+  80142d:	c3                   	ret
+
+000000000080142e <sys_yield>:
+
+void
+sys_yield(void) {
+  80142e:	55                   	push   %rbp
+  80142f:	48 89 e5             	mov    %rsp,%rbp
+  801432:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801433:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801438:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801442:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801447:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144c:	be 00 00 00 00       	mov    $0x0,%esi
+  801451:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801457:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801459:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145d:	c9                   	leave
+  80145e:	c3                   	ret
+
+000000000080145f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80145f:	55                   	push   %rbp
+  801460:	48 89 e5             	mov    %rsp,%rbp
+  801463:	53                   	push   %rbx
+  801464:	48 89 fa             	mov    %rdi,%rdx
+  801467:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80146a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80146f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801476:	00 00 00 
+  801479:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147e:	be 00 00 00 00       	mov    $0x0,%esi
+  801483:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801489:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80148b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148f:	c9                   	leave
+  801490:	c3                   	ret
+
+0000000000801491 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801491:	55                   	push   %rbp
+  801492:	48 89 e5             	mov    %rsp,%rbp
+  801495:	53                   	push   %rbx
+  801496:	49 89 f8             	mov    %rdi,%r8
+  801499:	48 89 d3             	mov    %rdx,%rbx
+  80149c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80149f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a4:	4c 89 c2             	mov    %r8,%rdx
+  8014a7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8014af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014bb:	c9                   	leave
+  8014bc:	c3                   	ret
+
+00000000008014bd <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014bd:	55                   	push   %rbp
+  8014be:	48 89 e5             	mov    %rsp,%rbp
+  8014c1:	53                   	push   %rbx
+  8014c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014c6:	89 f8                	mov    %edi,%eax
+  8014c8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014cb:	48 63 f9             	movslq %ecx,%rdi
+  8014ce:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d1:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014d6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e6:	48 85 c0             	test   %rax,%rax
+  8014e9:	7f 06                	jg     8014f1 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ef:	c9                   	leave
+  8014f0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f1:	49 89 c0             	mov    %rax,%r8
+  8014f4:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014f9:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801500:	00 00 00 
+  801503:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801508:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80150f:	00 00 00 
+  801512:	b8 00 00 00 00       	mov    $0x0,%eax
+  801517:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  80151e:	00 00 00 
+  801521:	41 ff d1             	call   *%r9
+
+0000000000801524 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801524:	55                   	push   %rbp
+  801525:	48 89 e5             	mov    %rsp,%rbp
+  801528:	53                   	push   %rbx
+  801529:	48 83 ec 08          	sub    $0x8,%rsp
+  80152d:	89 f8                	mov    %edi,%eax
+  80152f:	49 89 f2             	mov    %rsi,%r10
+  801532:	48 89 cf             	mov    %rcx,%rdi
+  801535:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801538:	48 63 da             	movslq %edx,%rbx
+  80153b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80153e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801543:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801546:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801549:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80154b:	48 85 c0             	test   %rax,%rax
+  80154e:	7f 06                	jg     801556 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801550:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801554:	c9                   	leave
+  801555:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801556:	49 89 c0             	mov    %rax,%r8
+  801559:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80155e:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801565:	00 00 00 
+  801568:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80156d:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801574:	00 00 00 
+  801577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157c:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  801583:	00 00 00 
+  801586:	41 ff d1             	call   *%r9
+
+0000000000801589 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801589:	55                   	push   %rbp
+  80158a:	48 89 e5             	mov    %rsp,%rbp
+  80158d:	53                   	push   %rbx
+  80158e:	48 83 ec 08          	sub    $0x8,%rsp
+  801592:	49 89 f9             	mov    %rdi,%r9
+  801595:	89 f0                	mov    %esi,%eax
+  801597:	48 89 d3             	mov    %rdx,%rbx
+  80159a:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80159d:	49 63 f0             	movslq %r8d,%rsi
+  8015a0:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a3:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015a8:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b3:	48 85 c0             	test   %rax,%rax
+  8015b6:	7f 06                	jg     8015be <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015bc:	c9                   	leave
+  8015bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015be:	49 89 c0             	mov    %rax,%r8
+  8015c1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015c6:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8015cd:	00 00 00 
+  8015d0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015d5:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8015dc:	00 00 00 
+  8015df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e4:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  8015eb:	00 00 00 
+  8015ee:	41 ff d1             	call   *%r9
+
+00000000008015f1 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8015f1:	55                   	push   %rbp
+  8015f2:	48 89 e5             	mov    %rsp,%rbp
+  8015f5:	53                   	push   %rbx
+  8015f6:	89 f8                	mov    %edi,%eax
+  8015f8:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8015fb:	48 63 f9             	movslq %ecx,%rdi
+  8015fe:	48 63 da             	movslq %edx,%rbx
+  801601:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801604:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801609:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160c:	be 00 00 00 00       	mov    $0x0,%esi
+  801611:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801617:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  801619:	89 c2                	mov    %eax,%edx
+  80161b:	48 85 c0             	test   %rax,%rax
+  80161e:	78 0d                	js     80162d <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801620:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801625:	4d 85 c9             	test   %r9,%r9
+  801628:	74 03                	je     80162d <sys_alloc_dma_region+0x3c>
+  80162a:	49 89 01             	mov    %rax,(%r9)
+}
+  80162d:	89 d0                	mov    %edx,%eax
+  80162f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801633:	c9                   	leave
+  801634:	c3                   	ret
+
+0000000000801635 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801635:	55                   	push   %rbp
+  801636:	48 89 e5             	mov    %rsp,%rbp
+  801639:	53                   	push   %rbx
+  80163a:	48 83 ec 08          	sub    $0x8,%rsp
+  80163e:	48 89 f1             	mov    %rsi,%rcx
+  801641:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801644:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801647:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80164c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801651:	be 00 00 00 00       	mov    $0x0,%esi
+  801656:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80165e:	48 85 c0             	test   %rax,%rax
+  801661:	7f 06                	jg     801669 <sys_set_cache_region+0x34>
+}
+  801663:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801667:	c9                   	leave
+  801668:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801669:	49 89 c0             	mov    %rax,%r8
+  80166c:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801671:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801678:	00 00 00 
+  80167b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801680:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801687:	00 00 00 
+  80168a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80168f:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  801696:	00 00 00 
+  801699:	41 ff d1             	call   *%r9
+
+000000000080169c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80169c:	55                   	push   %rbp
+  80169d:	48 89 e5             	mov    %rsp,%rbp
+  8016a0:	53                   	push   %rbx
+  8016a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a5:	48 89 f1             	mov    %rsi,%rcx
+  8016a8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8016ab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ae:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c5:	48 85 c0             	test   %rax,%rax
+  8016c8:	7f 06                	jg     8016d0 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8016ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ce:	c9                   	leave
+  8016cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d0:	49 89 c0             	mov    %rax,%r8
+  8016d3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8016d8:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8016df:	00 00 00 
+  8016e2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016e7:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8016ee:	00 00 00 
+  8016f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f6:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  8016fd:	00 00 00 
+  801700:	41 ff d1             	call   *%r9
+
+0000000000801703 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801703:	55                   	push   %rbp
+  801704:	48 89 e5             	mov    %rsp,%rbp
+  801707:	53                   	push   %rbx
+  801708:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80170c:	48 63 ce             	movslq %esi,%rcx
+  80170f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801712:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801717:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801721:	be 00 00 00 00       	mov    $0x0,%esi
+  801726:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80172e:	48 85 c0             	test   %rax,%rax
+  801731:	7f 06                	jg     801739 <sys_env_set_status+0x36>
+}
+  801733:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801737:	c9                   	leave
+  801738:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801739:	49 89 c0             	mov    %rax,%r8
+  80173c:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801741:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801748:	00 00 00 
+  80174b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801750:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801757:	00 00 00 
+  80175a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175f:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  801766:	00 00 00 
+  801769:	41 ff d1             	call   *%r9
+
+000000000080176c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80176c:	55                   	push   %rbp
+  80176d:	48 89 e5             	mov    %rsp,%rbp
+  801770:	53                   	push   %rbx
+  801771:	48 83 ec 08          	sub    $0x8,%rsp
+  801775:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801778:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80177b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801780:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801785:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80178a:	be 00 00 00 00       	mov    $0x0,%esi
+  80178f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801795:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801797:	48 85 c0             	test   %rax,%rax
+  80179a:	7f 06                	jg     8017a2 <sys_env_set_trapframe+0x36>
+}
+  80179c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a0:	c9                   	leave
+  8017a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017a2:	49 89 c0             	mov    %rax,%r8
+  8017a5:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8017aa:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8017b1:	00 00 00 
+  8017b4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017b9:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8017c0:	00 00 00 
+  8017c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c8:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  8017cf:	00 00 00 
+  8017d2:	41 ff d1             	call   *%r9
+
+00000000008017d5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017d5:	55                   	push   %rbp
+  8017d6:	48 89 e5             	mov    %rsp,%rbp
+  8017d9:	53                   	push   %rbx
+  8017da:	48 83 ec 08          	sub    $0x8,%rsp
+  8017de:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8017e1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801800:	48 85 c0             	test   %rax,%rax
+  801803:	7f 06                	jg     80180b <sys_env_set_pgfault_upcall+0x36>
+}
+  801805:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801809:	c9                   	leave
+  80180a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80180b:	49 89 c0             	mov    %rax,%r8
+  80180e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801813:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  80181a:	00 00 00 
+  80181d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801822:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801829:	00 00 00 
+  80182c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801831:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  801838:	00 00 00 
+  80183b:	41 ff d1             	call   *%r9
+
+000000000080183e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80183e:	55                   	push   %rbp
+  80183f:	48 89 e5             	mov    %rsp,%rbp
+  801842:	53                   	push   %rbx
+  801843:	89 f8                	mov    %edi,%eax
+  801845:	49 89 f1             	mov    %rsi,%r9
+  801848:	48 89 d3             	mov    %rdx,%rbx
+  80184b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80184e:	49 63 f0             	movslq %r8d,%rsi
+  801851:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801854:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801859:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80185c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801862:	cd 30                	int    $0x30
+}
+  801864:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801868:	c9                   	leave
+  801869:	c3                   	ret
+
+000000000080186a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80186a:	55                   	push   %rbp
+  80186b:	48 89 e5             	mov    %rsp,%rbp
+  80186e:	53                   	push   %rbx
+  80186f:	48 83 ec 08          	sub    $0x8,%rsp
+  801873:	48 89 fa             	mov    %rdi,%rdx
+  801876:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801879:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80187e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801883:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801888:	be 00 00 00 00       	mov    $0x0,%esi
+  80188d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801893:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801895:	48 85 c0             	test   %rax,%rax
+  801898:	7f 06                	jg     8018a0 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80189a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80189e:	c9                   	leave
+  80189f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018a0:	49 89 c0             	mov    %rax,%r8
+  8018a3:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8018a8:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8018af:	00 00 00 
+  8018b2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018b7:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8018be:	00 00 00 
+  8018c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c6:	49 b9 95 02 80 00 00 	movabs $0x800295,%r9
+  8018cd:	00 00 00 
+  8018d0:	41 ff d1             	call   *%r9
+
+00000000008018d3 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8018d3:	55                   	push   %rbp
+  8018d4:	48 89 e5             	mov    %rsp,%rbp
+  8018d7:	53                   	push   %rbx
+  8018d8:	48 89 fa             	mov    %rdi,%rdx
+  8018db:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018de:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018f8:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018fe:	c9                   	leave
+  8018ff:	c3                   	ret
+
+0000000000801900 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801900:	55                   	push   %rbp
+  801901:	48 89 e5             	mov    %rsp,%rbp
+  801904:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801905:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80190a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801914:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801919:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80191e:	be 00 00 00 00       	mov    $0x0,%esi
+  801923:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801929:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80192b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80192f:	c9                   	leave
+  801930:	c3                   	ret
+
+0000000000801931 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801931:	48 85 ff             	test   %rdi,%rdi
+  801934:	0f 84 b6 01 00 00    	je     801af0 <malloc+0x1bf>
+malloc(size_t size) {
+  80193a:	55                   	push   %rbp
+  80193b:	48 89 e5             	mov    %rsp,%rbp
+  80193e:	41 56                	push   %r14
+  801940:	41 55                	push   %r13
+  801942:	41 54                	push   %r12
+  801944:	53                   	push   %rbx
+  801945:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801948:	48 b8 28 90 80 00 00 	movabs $0x809028,%rax
+  80194f:	00 00 00 
+  801952:	4c 8b 20             	mov    (%rax),%r12
+  801955:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80195c:	0f 87 94 01 00 00    	ja     801af6 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801962:	48 a1 20 90 80 00 00 	movabs 0x809020,%rax
+  801969:	00 00 00 
+  80196c:	48 85 c0             	test   %rax,%rax
+  80196f:	74 6b                	je     8019dc <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801971:	4d 85 e4             	test   %r12,%r12
+  801974:	74 66                	je     8019dc <malloc+0xab>
+  801976:	48 ba 48 90 80 00 00 	movabs $0x809048,%rdx
+  80197d:	00 00 00 
+  801980:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801985:	eb 0d                	jmp    801994 <malloc+0x63>
+  801987:	48 83 c1 01          	add    $0x1,%rcx
+  80198b:	48 83 c2 18          	add    $0x18,%rdx
+  80198f:	49 39 cc             	cmp    %rcx,%r12
+  801992:	74 48                	je     8019dc <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801994:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801999:	74 ec                	je     801987 <malloc+0x56>
+  80199b:	48 39 1a             	cmp    %rbx,(%rdx)
+  80199e:	72 e7                	jb     801987 <malloc+0x56>
+                real_freep_size--;
+  8019a0:	48 83 e8 01          	sub    $0x1,%rax
+  8019a4:	48 a3 20 90 80 00 00 	movabs %rax,0x809020
+  8019ab:	00 00 00 
+                freep[i].is_free = false;
+  8019ae:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  8019b5:	00 00 00 
+  8019b8:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8019bc:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8019c0:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8019c4:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8019cb:	00 
+                freep[i].size = size;
+  8019cc:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8019d0:	48 01 c8             	add    %rcx,%rax
+  8019d3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019d7:	e9 0b 01 00 00       	jmp    801ae7 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8019dc:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8019e3:	00 00 00 
+  8019e6:	48 01 d8             	add    %rbx,%rax
+  8019e9:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8019ef:	76 7c                	jbe    801a6d <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8019f1:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8019f8:	00 00 00 
+  8019fb:	4c 8b 30             	mov    (%rax),%r14
+  8019fe:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801a05:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801a08:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801a0f:	00 00 00 
+  801a12:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801a19:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801a20:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801a26:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801a2a:	48 b8 fd 13 80 00 00 	movabs $0x8013fd,%rax
+  801a31:	00 00 00 
+  801a34:	ff d0                	call   *%rax
+  801a36:	89 c7                	mov    %eax,%edi
+  801a38:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801a3f:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801a46:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801a4d:	00 00 00 
+  801a50:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801a54:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801a59:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  801a60:	00 00 00 
+  801a63:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801a65:	85 c0                	test   %eax,%eax
+  801a67:	0f 88 90 00 00 00    	js     801afd <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801a6d:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801a74:	00 00 00 
+  801a77:	48 8b 31             	mov    (%rcx),%rsi
+  801a7a:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801a81:	00 00 00 
+  801a84:	4c 8b 07             	mov    (%rdi),%r8
+  801a87:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801a8b:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801a92:	00 00 00 
+  801a95:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801a99:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801a9d:	48 b8 40 90 80 00 00 	movabs $0x809040,%rax
+  801aa4:	00 00 00 
+  801aa7:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801aab:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801aae:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801ab2:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801ab9:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801aba:	48 89 d8             	mov    %rbx,%rax
+  801abd:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ac2:	4c 01 c0             	add    %r8,%rax
+  801ac5:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801ac8:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801acf:	48 01 f3             	add    %rsi,%rbx
+  801ad2:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801ad5:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801ada:	48 a3 28 90 80 00 00 	movabs %rax,0x809028
+  801ae1:	00 00 00 
+  801ae4:	48 89 d0             	mov    %rdx,%rax
+}
+  801ae7:	5b                   	pop    %rbx
+  801ae8:	41 5c                	pop    %r12
+  801aea:	41 5d                	pop    %r13
+  801aec:	41 5e                	pop    %r14
+  801aee:	5d                   	pop    %rbp
+  801aef:	c3                   	ret
+        return NULL;
+  801af0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801af5:	c3                   	ret
+        return NULL;
+  801af6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afb:	eb ea                	jmp    801ae7 <malloc+0x1b6>
+            return NULL;
+  801afd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b02:	eb e3                	jmp    801ae7 <malloc+0x1b6>
+
+0000000000801b04 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801b04:	55                   	push   %rbp
+  801b05:	48 89 e5             	mov    %rsp,%rbp
+  801b08:	53                   	push   %rbx
+  801b09:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801b0d:	48 89 fb             	mov    %rdi,%rbx
+  801b10:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801b14:	48 89 df             	mov    %rbx,%rdi
+  801b17:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  801b1e:	00 00 00 
+  801b21:	ff d0                	call   *%rax
+  801b23:	48 89 c7             	mov    %rax,%rdi
+  801b26:	48 89 da             	mov    %rbx,%rdx
+  801b29:	be 00 00 00 00       	mov    $0x0,%esi
+  801b2e:	48 b8 3d 10 80 00 00 	movabs $0x80103d,%rax
+  801b35:	00 00 00 
+  801b38:	ff d0                	call   *%rax
+}
+  801b3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b3e:	c9                   	leave
+  801b3f:	c3                   	ret
+
+0000000000801b40 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801b40:	48 a1 28 90 80 00 00 	movabs 0x809028,%rax
+  801b47:	00 00 00 
+  801b4a:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  801b51:	00 00 00 
+  801b54:	48 3b 02             	cmp    (%rdx),%rax
+  801b57:	74 4d                	je     801ba6 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801b59:	48 85 c0             	test   %rax,%rax
+  801b5c:	74 4d                	je     801bab <get_allocsize+0x6b>
+  801b5e:	48 b9 40 90 80 00 00 	movabs $0x809040,%rcx
+  801b65:	00 00 00 
+  801b68:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801b6d:	48 3b 39             	cmp    (%rcx),%rdi
+  801b70:	74 13                	je     801b85 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801b72:	48 83 c2 01          	add    $0x1,%rdx
+  801b76:	48 83 c1 18          	add    $0x18,%rcx
+  801b7a:	48 39 d0             	cmp    %rdx,%rax
+  801b7d:	75 ee                	jne    801b6d <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b84:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801b85:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8e:	48 be 40 90 80 00 00 	movabs $0x809040,%rsi
+  801b95:	00 00 00 
+  801b98:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b9e:	75 0b                	jne    801bab <get_allocsize+0x6b>
+  801ba0:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801ba5:	c3                   	ret
+        return 0;
+  801ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bab:	c3                   	ret
+
+0000000000801bac <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801bac:	48 85 ff             	test   %rdi,%rdi
+  801baf:	0f 84 01 01 00 00    	je     801cb6 <free+0x10a>
+free(void *ptr) {
+  801bb5:	55                   	push   %rbp
+  801bb6:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801bb9:	48 b8 28 90 80 00 00 	movabs $0x809028,%rax
+  801bc0:	00 00 00 
+  801bc3:	48 8b 30             	mov    (%rax),%rsi
+  801bc6:	48 a1 20 90 80 00 00 	movabs 0x809020,%rax
+  801bcd:	00 00 00 
+  801bd0:	48 39 c6             	cmp    %rax,%rsi
+  801bd3:	74 50                	je     801c25 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801bd5:	48 85 f6             	test   %rsi,%rsi
+  801bd8:	74 21                	je     801bfb <free+0x4f>
+  801bda:	48 b9 40 90 80 00 00 	movabs $0x809040,%rcx
+  801be1:	00 00 00 
+  801be4:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801be9:	48 3b 39             	cmp    (%rcx),%rdi
+  801bec:	74 61                	je     801c4f <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801bee:	48 83 c2 01          	add    $0x1,%rdx
+  801bf2:	48 83 c1 18          	add    $0x18,%rcx
+  801bf6:	48 39 d6             	cmp    %rdx,%rsi
+  801bf9:	75 ee                	jne    801be9 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801bfb:	48 ba 10 56 80 00 00 	movabs $0x805610,%rdx
+  801c02:	00 00 00 
+  801c05:	be 12 01 00 00       	mov    $0x112,%esi
+  801c0a:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801c11:	00 00 00 
+  801c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c19:	48 b9 95 02 80 00 00 	movabs $0x800295,%rcx
+  801c20:	00 00 00 
+  801c23:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801c25:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801c2c:	00 00 00 
+  801c2f:	be 06 01 00 00       	mov    $0x106,%esi
+  801c34:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801c3b:	00 00 00 
+  801c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c43:	48 b9 95 02 80 00 00 	movabs $0x800295,%rcx
+  801c4a:	00 00 00 
+  801c4d:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801c4f:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c53:	48 be 40 90 80 00 00 	movabs $0x809040,%rsi
+  801c5a:	00 00 00 
+  801c5d:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801c63:	75 27                	jne    801c8c <free+0xe0>
+            freep[i].is_free = true;
+  801c65:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c69:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  801c70:	00 00 00 
+  801c73:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801c7a:	00 00 
+            real_freep_size++;
+  801c7c:	48 83 c0 01          	add    $0x1,%rax
+  801c80:	48 a3 20 90 80 00 00 	movabs %rax,0x809020
+  801c87:	00 00 00 
+}
+  801c8a:	5d                   	pop    %rbp
+  801c8b:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801c8c:	48 ba e8 55 80 00 00 	movabs $0x8055e8,%rdx
+  801c93:	00 00 00 
+  801c96:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801c9b:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801ca2:	00 00 00 
+  801ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801caa:	48 b9 95 02 80 00 00 	movabs $0x800295,%rcx
+  801cb1:	00 00 00 
+  801cb4:	ff d1                	call   *%rcx
+  801cb6:	c3                   	ret
+
+0000000000801cb7 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801cb7:	55                   	push   %rbp
+  801cb8:	48 89 e5             	mov    %rsp,%rbp
+  801cbb:	41 55                	push   %r13
+  801cbd:	41 54                	push   %r12
+  801cbf:	53                   	push   %rbx
+  801cc0:	48 83 ec 08          	sub    $0x8,%rsp
+  801cc4:	48 89 fb             	mov    %rdi,%rbx
+  801cc7:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801cca:	48 b8 40 1b 80 00 00 	movabs $0x801b40,%rax
+  801cd1:	00 00 00 
+  801cd4:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801cd6:	49 39 c5             	cmp    %rax,%r13
+  801cd9:	73 0e                	jae    801ce9 <realloc+0x32>
+}
+  801cdb:	48 89 d8             	mov    %rbx,%rax
+  801cde:	48 83 c4 08          	add    $0x8,%rsp
+  801ce2:	5b                   	pop    %rbx
+  801ce3:	41 5c                	pop    %r12
+  801ce5:	41 5d                	pop    %r13
+  801ce7:	5d                   	pop    %rbp
+  801ce8:	c3                   	ret
+  801ce9:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801cec:	4c 89 ef             	mov    %r13,%rdi
+  801cef:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  801cf6:	00 00 00 
+  801cf9:	ff d0                	call   *%rax
+  801cfb:	48 89 c7             	mov    %rax,%rdi
+  801cfe:	4c 89 e2             	mov    %r12,%rdx
+  801d01:	48 89 de             	mov    %rbx,%rsi
+  801d04:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  801d0b:	00 00 00 
+  801d0e:	ff d0                	call   *%rax
+  801d10:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801d13:	48 89 df             	mov    %rbx,%rdi
+  801d16:	48 b8 ac 1b 80 00 00 	movabs $0x801bac,%rax
+  801d1d:	00 00 00 
+  801d20:	ff d0                	call   *%rax
+    return newptr;
+  801d22:	4c 89 e3             	mov    %r12,%rbx
+  801d25:	eb b4                	jmp    801cdb <realloc+0x24>
+
+0000000000801d27 <strdup>:
+
+char*
+strdup (const char *src) {
+  801d27:	55                   	push   %rbp
+  801d28:	48 89 e5             	mov    %rsp,%rbp
+  801d2b:	41 54                	push   %r12
+  801d2d:	53                   	push   %rbx
+  801d2e:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801d31:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  801d38:	00 00 00 
+  801d3b:	ff d0                	call   *%rax
+  801d3d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801d41:	4c 89 e7             	mov    %r12,%rdi
+  801d44:	48 b8 31 19 80 00 00 	movabs $0x801931,%rax
+  801d4b:	00 00 00 
+  801d4e:	ff d0                	call   *%rax
+  801d50:	48 89 c7             	mov    %rax,%rdi
+  801d53:	4c 89 e2             	mov    %r12,%rdx
+  801d56:	48 89 de             	mov    %rbx,%rsi
+  801d59:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  801d60:	00 00 00 
+  801d63:	ff d0                	call   *%rax
+}
+  801d65:	5b                   	pop    %rbx
+  801d66:	41 5c                	pop    %r12
+  801d68:	5d                   	pop    %rbp
+  801d69:	c3                   	ret
+
+0000000000801d6a <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801d6a:	55                   	push   %rbp
+  801d6b:	48 89 e5             	mov    %rsp,%rbp
+  801d6e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d6f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d79:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d83:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d88:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d93:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d99:	c9                   	leave
+  801d9a:	c3                   	ret
+
+0000000000801d9b <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801d9b:	55                   	push   %rbp
+  801d9c:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801d9f:	48 b8 40 90 98 00 00 	movabs $0x989040,%rax
+  801da6:	00 00 00 
+  801da9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801dad:	74 26                	je     801dd5 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801daf:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801db1:	48 c1 e2 20          	shl    $0x20,%rdx
+  801db5:	89 c0                	mov    %eax,%eax
+  801db7:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801dba:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801dc1:	48 b9 40 90 98 00 00 	movabs $0x989040,%rcx
+  801dc8:	00 00 00 
+  801dcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd0:	48 f7 31             	divq   (%rcx)
+}
+  801dd3:	5d                   	pop    %rbp
+  801dd4:	c3                   	ret
+        freq = get_cpufreq();
+  801dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dda:	48 ba 6a 1d 80 00 00 	movabs $0x801d6a,%rdx
+  801de1:	00 00 00 
+  801de4:	ff d2                	call   *%rdx
+  801de6:	48 a3 40 90 98 00 00 	movabs %rax,0x989040
+  801ded:	00 00 00 
+  801df0:	eb bd                	jmp    801daf <get_ticks+0x14>
+
+0000000000801df2 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801df2:	55                   	push   %rbp
+  801df3:	48 89 e5             	mov    %rsp,%rbp
+  801df6:	53                   	push   %rbx
+  801df7:	48 83 ec 08          	sub    $0x8,%rsp
+  801dfb:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801dfe:	48 b8 40 90 98 00 00 	movabs $0x989040,%rax
+  801e05:	00 00 00 
+  801e08:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801e0c:	74 50                	je     801e5e <sleep+0x6c>
+    asm volatile("rdtsc"
+  801e0e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801e10:	48 c1 e2 20          	shl    $0x20,%rdx
+  801e14:	89 c0                	mov    %eax,%eax
+  801e16:	48 89 d6             	mov    %rdx,%rsi
+  801e19:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801e1c:	48 b8 40 90 98 00 00 	movabs $0x989040,%rax
+  801e23:	00 00 00 
+  801e26:	48 0f af 18          	imul   (%rax),%rbx
+  801e2a:	48 c1 eb 03          	shr    $0x3,%rbx
+  801e2e:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801e35:	9b c4 20 
+  801e38:	48 89 d8             	mov    %rbx,%rax
+  801e3b:	48 f7 e2             	mul    %rdx
+  801e3e:	48 89 d1             	mov    %rdx,%rcx
+  801e41:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801e45:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801e47:	48 c1 e2 20          	shl    $0x20,%rdx
+  801e4b:	89 c0                	mov    %eax,%eax
+  801e4d:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801e50:	48 29 f2             	sub    %rsi,%rdx
+  801e53:	48 39 ca             	cmp    %rcx,%rdx
+  801e56:	72 ed                	jb     801e45 <sleep+0x53>
+}
+  801e58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e5c:	c9                   	leave
+  801e5d:	c3                   	ret
+        freq = get_cpufreq();
+  801e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e63:	48 ba 6a 1d 80 00 00 	movabs $0x801d6a,%rdx
+  801e6a:	00 00 00 
+  801e6d:	ff d2                	call   *%rdx
+  801e6f:	48 a3 40 90 98 00 00 	movabs %rax,0x989040
+  801e76:	00 00 00 
+  801e79:	eb 93                	jmp    801e0e <sleep+0x1c>
+
+0000000000801e7b <poll_kbd>:
+
+int poll_kbd() {
+  801e7b:	55                   	push   %rbp
+  801e7c:	48 89 e5             	mov    %rsp,%rbp
+  801e7f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e80:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e85:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e94:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e99:	be 00 00 00 00       	mov    $0x0,%esi
+  801e9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ea4:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ea6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eaa:	c9                   	leave
+  801eab:	c3                   	ret
+
+0000000000801eac <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801eac:	55                   	push   %rbp
+  801ead:	48 89 e5             	mov    %rsp,%rbp
+  801eb0:	53                   	push   %rbx
+  801eb1:	49 89 fa             	mov    %rdi,%r10
+  801eb4:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801eb6:	44 89 c6             	mov    %r8d,%esi
+  801eb9:	89 cf                	mov    %ecx,%edi
+  801ebb:	89 d3                	mov    %edx,%ebx
+  801ebd:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ebf:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ec4:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ec7:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801ecb:	cd 30                	int    $0x30
+  801ecd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ed1:	c9                   	leave
+  801ed2:	c3                   	ret
+
+0000000000801ed3 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ed3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801eda:	ff ff ff 
+  801edd:	48 01 f8             	add    %rdi,%rax
+  801ee0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ee4:	c3                   	ret
+
+0000000000801ee5 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ee5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801eec:	ff ff ff 
+  801eef:	48 01 f8             	add    %rdi,%rax
+  801ef2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ef6:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801efc:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801f00:	c3                   	ret
+
+0000000000801f01 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801f01:	55                   	push   %rbp
+  801f02:	48 89 e5             	mov    %rsp,%rbp
+  801f05:	41 57                	push   %r15
+  801f07:	41 56                	push   %r14
+  801f09:	41 55                	push   %r13
+  801f0b:	41 54                	push   %r12
+  801f0d:	53                   	push   %rbx
+  801f0e:	48 83 ec 08          	sub    $0x8,%rsp
+  801f12:	49 89 ff             	mov    %rdi,%r15
+  801f15:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801f1a:	49 bd 7d 3f 80 00 00 	movabs $0x803f7d,%r13
+  801f21:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801f24:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801f2a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801f2d:	48 89 df             	mov    %rbx,%rdi
+  801f30:	41 ff d5             	call   *%r13
+  801f33:	83 e0 04             	and    $0x4,%eax
+  801f36:	74 17                	je     801f4f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801f38:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801f3f:	4c 39 f3             	cmp    %r14,%rbx
+  801f42:	75 e6                	jne    801f2a <fd_alloc+0x29>
+  801f44:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801f4a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801f4f:	4d 89 27             	mov    %r12,(%r15)
+}
+  801f52:	48 83 c4 08          	add    $0x8,%rsp
+  801f56:	5b                   	pop    %rbx
+  801f57:	41 5c                	pop    %r12
+  801f59:	41 5d                	pop    %r13
+  801f5b:	41 5e                	pop    %r14
+  801f5d:	41 5f                	pop    %r15
+  801f5f:	5d                   	pop    %rbp
+  801f60:	c3                   	ret
+
+0000000000801f61 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801f61:	83 ff 1f             	cmp    $0x1f,%edi
+  801f64:	77 39                	ja     801f9f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801f66:	55                   	push   %rbp
+  801f67:	48 89 e5             	mov    %rsp,%rbp
+  801f6a:	41 54                	push   %r12
+  801f6c:	53                   	push   %rbx
+  801f6d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801f70:	48 63 df             	movslq %edi,%rbx
+  801f73:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801f7a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801f7e:	48 89 df             	mov    %rbx,%rdi
+  801f81:	48 b8 7d 3f 80 00 00 	movabs $0x803f7d,%rax
+  801f88:	00 00 00 
+  801f8b:	ff d0                	call   *%rax
+  801f8d:	a8 04                	test   $0x4,%al
+  801f8f:	74 14                	je     801fa5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801f91:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801f95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f9a:	5b                   	pop    %rbx
+  801f9b:	41 5c                	pop    %r12
+  801f9d:	5d                   	pop    %rbp
+  801f9e:	c3                   	ret
+        return -E_INVAL;
+  801f9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801fa4:	c3                   	ret
+        return -E_INVAL;
+  801fa5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801faa:	eb ee                	jmp    801f9a <fd_lookup+0x39>
+
+0000000000801fac <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801fac:	55                   	push   %rbp
+  801fad:	48 89 e5             	mov    %rsp,%rbp
+  801fb0:	41 54                	push   %r12
+  801fb2:	53                   	push   %rbx
+  801fb3:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801fb6:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801fbd:	00 00 00 
+  801fc0:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801fc7:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801fca:	39 3b                	cmp    %edi,(%rbx)
+  801fcc:	74 47                	je     802015 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801fce:	48 83 c0 08          	add    $0x8,%rax
+  801fd2:	48 8b 18             	mov    (%rax),%rbx
+  801fd5:	48 85 db             	test   %rbx,%rbx
+  801fd8:	75 f0                	jne    801fca <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801fda:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  801fe1:	00 00 00 
+  801fe4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fea:	89 fa                	mov    %edi,%edx
+  801fec:	48 bf 48 56 80 00 00 	movabs $0x805648,%rdi
+  801ff3:	00 00 00 
+  801ff6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffb:	48 b9 e5 03 80 00 00 	movabs $0x8003e5,%rcx
+  802002:	00 00 00 
+  802005:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802007:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80200c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802010:	5b                   	pop    %rbx
+  802011:	41 5c                	pop    %r12
+  802013:	5d                   	pop    %rbp
+  802014:	c3                   	ret
+            return 0;
+  802015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201a:	eb f0                	jmp    80200c <dev_lookup+0x60>
+
+000000000080201c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80201c:	55                   	push   %rbp
+  80201d:	48 89 e5             	mov    %rsp,%rbp
+  802020:	41 55                	push   %r13
+  802022:	41 54                	push   %r12
+  802024:	53                   	push   %rbx
+  802025:	48 83 ec 18          	sub    $0x18,%rsp
+  802029:	48 89 fb             	mov    %rdi,%rbx
+  80202c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80202f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802036:	ff ff ff 
+  802039:	48 01 df             	add    %rbx,%rdi
+  80203c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802040:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802044:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  80204b:	00 00 00 
+  80204e:	ff d0                	call   *%rax
+  802050:	41 89 c5             	mov    %eax,%r13d
+  802053:	85 c0                	test   %eax,%eax
+  802055:	78 06                	js     80205d <fd_close+0x41>
+  802057:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80205b:	74 1a                	je     802077 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80205d:	45 84 e4             	test   %r12b,%r12b
+  802060:	b8 00 00 00 00       	mov    $0x0,%eax
+  802065:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802069:	44 89 e8             	mov    %r13d,%eax
+  80206c:	48 83 c4 18          	add    $0x18,%rsp
+  802070:	5b                   	pop    %rbx
+  802071:	41 5c                	pop    %r12
+  802073:	41 5d                	pop    %r13
+  802075:	5d                   	pop    %rbp
+  802076:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802077:	8b 3b                	mov    (%rbx),%edi
+  802079:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80207d:	48 b8 ac 1f 80 00 00 	movabs $0x801fac,%rax
+  802084:	00 00 00 
+  802087:	ff d0                	call   *%rax
+  802089:	41 89 c5             	mov    %eax,%r13d
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	78 1b                	js     8020ab <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802090:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802094:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802098:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80209e:	48 85 c0             	test   %rax,%rax
+  8020a1:	74 08                	je     8020ab <fd_close+0x8f>
+  8020a3:	48 89 df             	mov    %rbx,%rdi
+  8020a6:	ff d0                	call   *%rax
+  8020a8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020b0:	48 89 de             	mov    %rbx,%rsi
+  8020b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020b8:	48 b8 9c 16 80 00 00 	movabs $0x80169c,%rax
+  8020bf:	00 00 00 
+  8020c2:	ff d0                	call   *%rax
+    return res;
+  8020c4:	eb a3                	jmp    802069 <fd_close+0x4d>
+
+00000000008020c6 <close>:
+
+int
+close(int fdnum) {
+  8020c6:	55                   	push   %rbp
+  8020c7:	48 89 e5             	mov    %rsp,%rbp
+  8020ca:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020ce:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020d2:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  8020d9:	00 00 00 
+  8020dc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020de:	85 c0                	test   %eax,%eax
+  8020e0:	78 15                	js     8020f7 <close+0x31>
+
+    return fd_close(fd, 1);
+  8020e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8020e7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020eb:	48 b8 1c 20 80 00 00 	movabs $0x80201c,%rax
+  8020f2:	00 00 00 
+  8020f5:	ff d0                	call   *%rax
+}
+  8020f7:	c9                   	leave
+  8020f8:	c3                   	ret
+
+00000000008020f9 <close_all>:
+
+void
+close_all(void) {
+  8020f9:	55                   	push   %rbp
+  8020fa:	48 89 e5             	mov    %rsp,%rbp
+  8020fd:	41 54                	push   %r12
+  8020ff:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802100:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802105:	49 bc c6 20 80 00 00 	movabs $0x8020c6,%r12
+  80210c:	00 00 00 
+  80210f:	89 df                	mov    %ebx,%edi
+  802111:	41 ff d4             	call   *%r12
+  802114:	83 c3 01             	add    $0x1,%ebx
+  802117:	83 fb 20             	cmp    $0x20,%ebx
+  80211a:	75 f3                	jne    80210f <close_all+0x16>
+}
+  80211c:	5b                   	pop    %rbx
+  80211d:	41 5c                	pop    %r12
+  80211f:	5d                   	pop    %rbp
+  802120:	c3                   	ret
+
+0000000000802121 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802121:	55                   	push   %rbp
+  802122:	48 89 e5             	mov    %rsp,%rbp
+  802125:	41 57                	push   %r15
+  802127:	41 56                	push   %r14
+  802129:	41 55                	push   %r13
+  80212b:	41 54                	push   %r12
+  80212d:	53                   	push   %rbx
+  80212e:	48 83 ec 18          	sub    $0x18,%rsp
+  802132:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802135:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802139:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  802140:	00 00 00 
+  802143:	ff d0                	call   *%rax
+  802145:	89 c3                	mov    %eax,%ebx
+  802147:	85 c0                	test   %eax,%eax
+  802149:	0f 88 b8 00 00 00    	js     802207 <dup+0xe6>
+    close(newfdnum);
+  80214f:	44 89 e7             	mov    %r12d,%edi
+  802152:	48 b8 c6 20 80 00 00 	movabs $0x8020c6,%rax
+  802159:	00 00 00 
+  80215c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80215e:	4d 63 ec             	movslq %r12d,%r13
+  802161:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802168:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80216c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802170:	4c 89 ff             	mov    %r15,%rdi
+  802173:	49 be e5 1e 80 00 00 	movabs $0x801ee5,%r14
+  80217a:	00 00 00 
+  80217d:	41 ff d6             	call   *%r14
+  802180:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802183:	4c 89 ef             	mov    %r13,%rdi
+  802186:	41 ff d6             	call   *%r14
+  802189:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80218c:	48 89 df             	mov    %rbx,%rdi
+  80218f:	48 b8 7d 3f 80 00 00 	movabs $0x803f7d,%rax
+  802196:	00 00 00 
+  802199:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80219b:	a8 04                	test   $0x4,%al
+  80219d:	74 2b                	je     8021ca <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80219f:	41 89 c1             	mov    %eax,%r9d
+  8021a2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8021a8:	4c 89 f1             	mov    %r14,%rcx
+  8021ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b0:	48 89 de             	mov    %rbx,%rsi
+  8021b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b8:	48 b8 24 15 80 00 00 	movabs $0x801524,%rax
+  8021bf:	00 00 00 
+  8021c2:	ff d0                	call   *%rax
+  8021c4:	89 c3                	mov    %eax,%ebx
+  8021c6:	85 c0                	test   %eax,%eax
+  8021c8:	78 4e                	js     802218 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8021ca:	4c 89 ff             	mov    %r15,%rdi
+  8021cd:	48 b8 7d 3f 80 00 00 	movabs $0x803f7d,%rax
+  8021d4:	00 00 00 
+  8021d7:	ff d0                	call   *%rax
+  8021d9:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8021dc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8021e2:	4c 89 e9             	mov    %r13,%rcx
+  8021e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ea:	4c 89 fe             	mov    %r15,%rsi
+  8021ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021f2:	48 b8 24 15 80 00 00 	movabs $0x801524,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+  8021fe:	89 c3                	mov    %eax,%ebx
+  802200:	85 c0                	test   %eax,%eax
+  802202:	78 14                	js     802218 <dup+0xf7>
+
+    return newfdnum;
+  802204:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802207:	89 d8                	mov    %ebx,%eax
+  802209:	48 83 c4 18          	add    $0x18,%rsp
+  80220d:	5b                   	pop    %rbx
+  80220e:	41 5c                	pop    %r12
+  802210:	41 5d                	pop    %r13
+  802212:	41 5e                	pop    %r14
+  802214:	41 5f                	pop    %r15
+  802216:	5d                   	pop    %rbp
+  802217:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802218:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80221d:	4c 89 ee             	mov    %r13,%rsi
+  802220:	bf 00 00 00 00       	mov    $0x0,%edi
+  802225:	49 bc 9c 16 80 00 00 	movabs $0x80169c,%r12
+  80222c:	00 00 00 
+  80222f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802232:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802237:	4c 89 f6             	mov    %r14,%rsi
+  80223a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80223f:	41 ff d4             	call   *%r12
+    return res;
+  802242:	eb c3                	jmp    802207 <dup+0xe6>
+
+0000000000802244 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802244:	55                   	push   %rbp
+  802245:	48 89 e5             	mov    %rsp,%rbp
+  802248:	41 56                	push   %r14
+  80224a:	41 55                	push   %r13
+  80224c:	41 54                	push   %r12
+  80224e:	53                   	push   %rbx
+  80224f:	48 83 ec 10          	sub    $0x10,%rsp
+  802253:	89 fb                	mov    %edi,%ebx
+  802255:	49 89 f4             	mov    %rsi,%r12
+  802258:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80225b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80225f:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  802266:	00 00 00 
+  802269:	ff d0                	call   *%rax
+  80226b:	85 c0                	test   %eax,%eax
+  80226d:	78 4c                	js     8022bb <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80226f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802273:	41 8b 3e             	mov    (%r14),%edi
+  802276:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80227a:	48 b8 ac 1f 80 00 00 	movabs $0x801fac,%rax
+  802281:	00 00 00 
+  802284:	ff d0                	call   *%rax
+  802286:	85 c0                	test   %eax,%eax
+  802288:	78 35                	js     8022bf <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80228a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80228e:	83 e0 03             	and    $0x3,%eax
+  802291:	83 f8 01             	cmp    $0x1,%eax
+  802294:	74 2d                	je     8022c3 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802296:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80229a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80229e:	48 85 c0             	test   %rax,%rax
+  8022a1:	74 56                	je     8022f9 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8022a3:	4c 89 ea             	mov    %r13,%rdx
+  8022a6:	4c 89 e6             	mov    %r12,%rsi
+  8022a9:	4c 89 f7             	mov    %r14,%rdi
+  8022ac:	ff d0                	call   *%rax
+}
+  8022ae:	48 83 c4 10          	add    $0x10,%rsp
+  8022b2:	5b                   	pop    %rbx
+  8022b3:	41 5c                	pop    %r12
+  8022b5:	41 5d                	pop    %r13
+  8022b7:	41 5e                	pop    %r14
+  8022b9:	5d                   	pop    %rbp
+  8022ba:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022bb:	48 98                	cltq
+  8022bd:	eb ef                	jmp    8022ae <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022bf:	48 98                	cltq
+  8022c1:	eb eb                	jmp    8022ae <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022c3:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8022ca:	00 00 00 
+  8022cd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022d3:	89 da                	mov    %ebx,%edx
+  8022d5:	48 bf 89 56 80 00 00 	movabs $0x805689,%rdi
+  8022dc:	00 00 00 
+  8022df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e4:	48 b9 e5 03 80 00 00 	movabs $0x8003e5,%rcx
+  8022eb:	00 00 00 
+  8022ee:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022f0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022f7:	eb b5                	jmp    8022ae <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8022f9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802300:	eb ac                	jmp    8022ae <read+0x6a>
+
+0000000000802302 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802302:	55                   	push   %rbp
+  802303:	48 89 e5             	mov    %rsp,%rbp
+  802306:	41 57                	push   %r15
+  802308:	41 56                	push   %r14
+  80230a:	41 55                	push   %r13
+  80230c:	41 54                	push   %r12
+  80230e:	53                   	push   %rbx
+  80230f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802313:	48 85 d2             	test   %rdx,%rdx
+  802316:	74 54                	je     80236c <readn+0x6a>
+  802318:	41 89 fd             	mov    %edi,%r13d
+  80231b:	49 89 f6             	mov    %rsi,%r14
+  80231e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802321:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802326:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80232b:	49 bf 44 22 80 00 00 	movabs $0x802244,%r15
+  802332:	00 00 00 
+  802335:	4c 89 e2             	mov    %r12,%rdx
+  802338:	48 29 f2             	sub    %rsi,%rdx
+  80233b:	4c 01 f6             	add    %r14,%rsi
+  80233e:	44 89 ef             	mov    %r13d,%edi
+  802341:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802344:	85 c0                	test   %eax,%eax
+  802346:	78 20                	js     802368 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802348:	01 c3                	add    %eax,%ebx
+  80234a:	85 c0                	test   %eax,%eax
+  80234c:	74 08                	je     802356 <readn+0x54>
+  80234e:	48 63 f3             	movslq %ebx,%rsi
+  802351:	4c 39 e6             	cmp    %r12,%rsi
+  802354:	72 df                	jb     802335 <readn+0x33>
+    }
+    return res;
+  802356:	48 63 c3             	movslq %ebx,%rax
+}
+  802359:	48 83 c4 08          	add    $0x8,%rsp
+  80235d:	5b                   	pop    %rbx
+  80235e:	41 5c                	pop    %r12
+  802360:	41 5d                	pop    %r13
+  802362:	41 5e                	pop    %r14
+  802364:	41 5f                	pop    %r15
+  802366:	5d                   	pop    %rbp
+  802367:	c3                   	ret
+        if (inc < 0) return inc;
+  802368:	48 98                	cltq
+  80236a:	eb ed                	jmp    802359 <readn+0x57>
+    int inc = 1, res = 0;
+  80236c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802371:	eb e3                	jmp    802356 <readn+0x54>
+
+0000000000802373 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802373:	55                   	push   %rbp
+  802374:	48 89 e5             	mov    %rsp,%rbp
+  802377:	41 56                	push   %r14
+  802379:	41 55                	push   %r13
+  80237b:	41 54                	push   %r12
+  80237d:	53                   	push   %rbx
+  80237e:	48 83 ec 10          	sub    $0x10,%rsp
+  802382:	89 fb                	mov    %edi,%ebx
+  802384:	49 89 f4             	mov    %rsi,%r12
+  802387:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80238a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80238e:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  802395:	00 00 00 
+  802398:	ff d0                	call   *%rax
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	78 47                	js     8023e5 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80239e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8023a2:	41 8b 3e             	mov    (%r14),%edi
+  8023a5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023a9:	48 b8 ac 1f 80 00 00 	movabs $0x801fac,%rax
+  8023b0:	00 00 00 
+  8023b3:	ff d0                	call   *%rax
+  8023b5:	85 c0                	test   %eax,%eax
+  8023b7:	78 30                	js     8023e9 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023b9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8023be:	74 2d                	je     8023ed <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023c0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023c4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8023c8:	48 85 c0             	test   %rax,%rax
+  8023cb:	74 56                	je     802423 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8023cd:	4c 89 ea             	mov    %r13,%rdx
+  8023d0:	4c 89 e6             	mov    %r12,%rsi
+  8023d3:	4c 89 f7             	mov    %r14,%rdi
+  8023d6:	ff d0                	call   *%rax
+}
+  8023d8:	48 83 c4 10          	add    $0x10,%rsp
+  8023dc:	5b                   	pop    %rbx
+  8023dd:	41 5c                	pop    %r12
+  8023df:	41 5d                	pop    %r13
+  8023e1:	41 5e                	pop    %r14
+  8023e3:	5d                   	pop    %rbp
+  8023e4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023e5:	48 98                	cltq
+  8023e7:	eb ef                	jmp    8023d8 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023e9:	48 98                	cltq
+  8023eb:	eb eb                	jmp    8023d8 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023ed:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8023f4:	00 00 00 
+  8023f7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023fd:	89 da                	mov    %ebx,%edx
+  8023ff:	48 bf a5 56 80 00 00 	movabs $0x8056a5,%rdi
+  802406:	00 00 00 
+  802409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240e:	48 b9 e5 03 80 00 00 	movabs $0x8003e5,%rcx
+  802415:	00 00 00 
+  802418:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80241a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802421:	eb b5                	jmp    8023d8 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802423:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80242a:	eb ac                	jmp    8023d8 <write+0x65>
+
+000000000080242c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80242c:	55                   	push   %rbp
+  80242d:	48 89 e5             	mov    %rsp,%rbp
+  802430:	53                   	push   %rbx
+  802431:	48 83 ec 18          	sub    $0x18,%rsp
+  802435:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802437:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80243b:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  802442:	00 00 00 
+  802445:	ff d0                	call   *%rax
+  802447:	85 c0                	test   %eax,%eax
+  802449:	78 0c                	js     802457 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80244b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80244f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802452:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802457:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80245b:	c9                   	leave
+  80245c:	c3                   	ret
+
+000000000080245d <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80245d:	55                   	push   %rbp
+  80245e:	48 89 e5             	mov    %rsp,%rbp
+  802461:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802465:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802469:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  802470:	00 00 00 
+  802473:	ff d0                	call   *%rax
+  802475:	85 c0                	test   %eax,%eax
+  802477:	78 07                	js     802480 <tell+0x23>
+    return fdes->fd_offset;
+  802479:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80247d:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802480:	c9                   	leave
+  802481:	c3                   	ret
+
+0000000000802482 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802482:	55                   	push   %rbp
+  802483:	48 89 e5             	mov    %rsp,%rbp
+  802486:	41 55                	push   %r13
+  802488:	41 54                	push   %r12
+  80248a:	53                   	push   %rbx
+  80248b:	48 83 ec 18          	sub    $0x18,%rsp
+  80248f:	89 fb                	mov    %edi,%ebx
+  802491:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802494:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802498:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  80249f:	00 00 00 
+  8024a2:	ff d0                	call   *%rax
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	78 38                	js     8024e0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024a8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8024ac:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8024b0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024b4:	48 b8 ac 1f 80 00 00 	movabs $0x801fac,%rax
+  8024bb:	00 00 00 
+  8024be:	ff d0                	call   *%rax
+  8024c0:	85 c0                	test   %eax,%eax
+  8024c2:	78 1c                	js     8024e0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024c4:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8024c9:	74 20                	je     8024eb <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024cf:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8024d3:	48 85 c0             	test   %rax,%rax
+  8024d6:	74 47                	je     80251f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8024d8:	44 89 e6             	mov    %r12d,%esi
+  8024db:	4c 89 ef             	mov    %r13,%rdi
+  8024de:	ff d0                	call   *%rax
+}
+  8024e0:	48 83 c4 18          	add    $0x18,%rsp
+  8024e4:	5b                   	pop    %rbx
+  8024e5:	41 5c                	pop    %r12
+  8024e7:	41 5d                	pop    %r13
+  8024e9:	5d                   	pop    %rbp
+  8024ea:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8024eb:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8024f2:	00 00 00 
+  8024f5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8024fb:	89 da                	mov    %ebx,%edx
+  8024fd:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  802504:	00 00 00 
+  802507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250c:	48 b9 e5 03 80 00 00 	movabs $0x8003e5,%rcx
+  802513:	00 00 00 
+  802516:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802518:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80251d:	eb c1                	jmp    8024e0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80251f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802524:	eb ba                	jmp    8024e0 <ftruncate+0x5e>
+
+0000000000802526 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802526:	55                   	push   %rbp
+  802527:	48 89 e5             	mov    %rsp,%rbp
+  80252a:	41 54                	push   %r12
+  80252c:	53                   	push   %rbx
+  80252d:	48 83 ec 10          	sub    $0x10,%rsp
+  802531:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802534:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802538:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+  802544:	85 c0                	test   %eax,%eax
+  802546:	78 4e                	js     802596 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802548:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80254c:	41 8b 3c 24          	mov    (%r12),%edi
+  802550:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802554:	48 b8 ac 1f 80 00 00 	movabs $0x801fac,%rax
+  80255b:	00 00 00 
+  80255e:	ff d0                	call   *%rax
+  802560:	85 c0                	test   %eax,%eax
+  802562:	78 32                	js     802596 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802564:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802568:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80256d:	74 30                	je     80259f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80256f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802572:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802579:	00 00 00 
+    stat->st_isdir = 0;
+  80257c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802583:	00 00 00 
+    stat->st_dev = dev;
+  802586:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80258d:	48 89 de             	mov    %rbx,%rsi
+  802590:	4c 89 e7             	mov    %r12,%rdi
+  802593:	ff 50 28             	call   *0x28(%rax)
+}
+  802596:	48 83 c4 10          	add    $0x10,%rsp
+  80259a:	5b                   	pop    %rbx
+  80259b:	41 5c                	pop    %r12
+  80259d:	5d                   	pop    %rbp
+  80259e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80259f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025a4:	eb f0                	jmp    802596 <fstat+0x70>
+
+00000000008025a6 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8025a6:	55                   	push   %rbp
+  8025a7:	48 89 e5             	mov    %rsp,%rbp
+  8025aa:	41 54                	push   %r12
+  8025ac:	53                   	push   %rbx
+  8025ad:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8025b4:	41 89 fc             	mov    %edi,%r12d
+  8025b7:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025b9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025bd:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  8025c4:	00 00 00 
+  8025c7:	ff d0                	call   *%rax
+  8025c9:	85 c0                	test   %eax,%eax
+  8025cb:	78 31                	js     8025fe <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8025cd:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8025d4:	44 89 e7             	mov    %r12d,%edi
+  8025d7:	48 b8 26 25 80 00 00 	movabs $0x802526,%rax
+  8025de:	00 00 00 
+  8025e1:	ff d0                	call   *%rax
+  8025e3:	85 c0                	test   %eax,%eax
+  8025e5:	78 17                	js     8025fe <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8025e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025eb:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8025ee:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8025f1:	39 d3                	cmp    %edx,%ebx
+  8025f3:	0f 4f da             	cmovg  %edx,%ebx
+  8025f6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8025f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025fe:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802605:	5b                   	pop    %rbx
+  802606:	41 5c                	pop    %r12
+  802608:	5d                   	pop    %rbp
+  802609:	c3                   	ret
+
+000000000080260a <seektoend>:
+{
+  80260a:	55                   	push   %rbp
+  80260b:	48 89 e5             	mov    %rsp,%rbp
+  80260e:	53                   	push   %rbx
+  80260f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802616:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802618:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80261c:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  802623:	00 00 00 
+  802626:	ff d0                	call   *%rax
+  802628:	85 c0                	test   %eax,%eax
+  80262a:	78 28                	js     802654 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80262c:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802633:	89 df                	mov    %ebx,%edi
+  802635:	48 b8 26 25 80 00 00 	movabs $0x802526,%rax
+  80263c:	00 00 00 
+  80263f:	ff d0                	call   *%rax
+  802641:	85 c0                	test   %eax,%eax
+  802643:	78 0f                	js     802654 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802645:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802648:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80264c:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80264f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802654:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802658:	c9                   	leave
+  802659:	c3                   	ret
+
+000000000080265a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80265a:	55                   	push   %rbp
+  80265b:	48 89 e5             	mov    %rsp,%rbp
+  80265e:	41 54                	push   %r12
+  802660:	53                   	push   %rbx
+  802661:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802664:	be 00 00 00 00       	mov    $0x0,%esi
+  802669:	48 b8 4d 32 80 00 00 	movabs $0x80324d,%rax
+  802670:	00 00 00 
+  802673:	ff d0                	call   *%rax
+  802675:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802677:	85 c0                	test   %eax,%eax
+  802679:	78 25                	js     8026a0 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80267b:	4c 89 e6             	mov    %r12,%rsi
+  80267e:	89 c7                	mov    %eax,%edi
+  802680:	48 b8 26 25 80 00 00 	movabs $0x802526,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+  80268c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80268f:	89 df                	mov    %ebx,%edi
+  802691:	48 b8 c6 20 80 00 00 	movabs $0x8020c6,%rax
+  802698:	00 00 00 
+  80269b:	ff d0                	call   *%rax
+
+    return res;
+  80269d:	44 89 e3             	mov    %r12d,%ebx
+}
+  8026a0:	89 d8                	mov    %ebx,%eax
+  8026a2:	5b                   	pop    %rbx
+  8026a3:	41 5c                	pop    %r12
+  8026a5:	5d                   	pop    %rbp
+  8026a6:	c3                   	ret
+
+00000000008026a7 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8026a7:	55                   	push   %rbp
+  8026a8:	48 89 e5             	mov    %rsp,%rbp
+  8026ab:	53                   	push   %rbx
+  8026ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b0:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8026b3:	48 b8 d3 1e 80 00 00 	movabs $0x801ed3,%rax
+  8026ba:	00 00 00 
+  8026bd:	ff d0                	call   *%rax
+  8026bf:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8026c3:	0f 87 ea 00 00 00    	ja     8027b3 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8026c9:	48 b8 04 b0 98 00 00 	movabs $0x98b004,%rax
+  8026d0:	00 00 00 
+  8026d3:	80 38 00             	cmpb   $0x0,(%rax)
+  8026d6:	75 35                	jne    80270d <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8026d8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8026dd:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8026e2:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8026e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ec:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  8026f3:	00 00 00 
+  8026f6:	ff d0                	call   *%rax
+  8026f8:	85 c0                	test   %eax,%eax
+  8026fa:	0f 88 ba 00 00 00    	js     8027ba <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802700:	48 b8 04 b0 98 00 00 	movabs $0x98b004,%rax
+  802707:	00 00 00 
+  80270a:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  80270d:	48 89 df             	mov    %rbx,%rdi
+  802710:	48 b8 d3 1e 80 00 00 	movabs $0x801ed3,%rax
+  802717:	00 00 00 
+  80271a:	ff d0                	call   *%rax
+  80271c:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802720:	48 ba 20 b0 98 00 00 	movabs $0x98b020,%rdx
+  802727:	00 00 00 
+  80272a:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80272e:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802731:	39 39                	cmp    %edi,(%rcx)
+  802733:	74 46                	je     80277b <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802735:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802739:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802740:	00 
+  802741:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802748:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  80274f:	00 
+  802750:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802757:	00 
+  802758:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  80275f:	00 
+  802760:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802767:	00 
+  802768:	89 39                	mov    %edi,(%rcx)
+  80276a:	48 01 c6             	add    %rax,%rsi
+  80276d:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802772:	48 89 c8             	mov    %rcx,%rax
+  802775:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802779:	c9                   	leave
+  80277a:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80277b:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80277f:	48 be 20 b0 98 00 00 	movabs $0x98b020,%rsi
+  802786:	00 00 00 
+  802789:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80278c:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802790:	74 e0                	je     802772 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802792:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802799:	00 
+  80279a:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80279e:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8027a5:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8027a7:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8027aa:	48 01 c2             	add    %rax,%rdx
+  8027ad:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8027b1:	eb bf                	jmp    802772 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8027b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027b8:	eb b8                	jmp    802772 <fbuf_get+0xcb>
+            return NULL;
+  8027ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027bf:	eb b1                	jmp    802772 <fbuf_get+0xcb>
+
+00000000008027c1 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8027c1:	55                   	push   %rbp
+  8027c2:	48 89 e5             	mov    %rsp,%rbp
+  8027c5:	53                   	push   %rbx
+  8027c6:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8027ca:	48 b8 20 b5 98 00 00 	movabs $0x98b520,%rax
+  8027d1:	00 00 00 
+  8027d4:	48 8b 18             	mov    (%rax),%rbx
+  8027d7:	48 85 db             	test   %rbx,%rbx
+  8027da:	74 16                	je     8027f2 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8027dc:	48 b8 20 b5 98 00 00 	movabs $0x98b520,%rax
+  8027e3:	00 00 00 
+  8027e6:	48 8b 18             	mov    (%rax),%rbx
+}
+  8027e9:	48 89 d8             	mov    %rbx,%rax
+  8027ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027f0:	c9                   	leave
+  8027f1:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8027f2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027f7:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8027fc:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802801:	bf 00 00 00 00       	mov    $0x0,%edi
+  802806:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  80280d:	00 00 00 
+  802810:	ff d0                	call   *%rax
+  802812:	85 c0                	test   %eax,%eax
+  802814:	78 d3                	js     8027e9 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802816:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  80281b:	48 a3 20 b5 98 00 00 	movabs %rax,0x98b520
+  802822:	00 00 00 
+  802825:	eb b5                	jmp    8027dc <fsipc_bulk+0x1b>
+
+0000000000802827 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802827:	55                   	push   %rbp
+  802828:	48 89 e5             	mov    %rsp,%rbp
+  80282b:	41 57                	push   %r15
+  80282d:	41 56                	push   %r14
+  80282f:	41 55                	push   %r13
+  802831:	41 54                	push   %r12
+  802833:	53                   	push   %rbx
+  802834:	48 83 ec 08          	sub    $0x8,%rsp
+  802838:	41 89 fd             	mov    %edi,%r13d
+  80283b:	49 89 f6             	mov    %rsi,%r14
+  80283e:	49 89 d7             	mov    %rdx,%r15
+  802841:	48 89 cb             	mov    %rcx,%rbx
+  802844:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802847:	48 b8 00 b0 98 00 00 	movabs $0x98b000,%rax
+  80284e:	00 00 00 
+  802851:	83 38 00             	cmpl   $0x0,(%rax)
+  802854:	74 52                	je     8028a8 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802856:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80285c:	4c 89 f9             	mov    %r15,%rcx
+  80285f:	4c 89 f2             	mov    %r14,%rdx
+  802862:	44 89 ee             	mov    %r13d,%esi
+  802865:	48 b8 00 b0 98 00 00 	movabs $0x98b000,%rax
+  80286c:	00 00 00 
+  80286f:	8b 38                	mov    (%rax),%edi
+  802871:	48 b8 d4 44 80 00 00 	movabs $0x8044d4,%rax
+  802878:	00 00 00 
+  80287b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80287d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802882:	4c 89 e2             	mov    %r12,%rdx
+  802885:	48 89 de             	mov    %rbx,%rsi
+  802888:	bf 00 00 00 00       	mov    $0x0,%edi
+  80288d:	48 b8 24 43 80 00 00 	movabs $0x804324,%rax
+  802894:	00 00 00 
+  802897:	ff d0                	call   *%rax
+}
+  802899:	48 83 c4 08          	add    $0x8,%rsp
+  80289d:	5b                   	pop    %rbx
+  80289e:	41 5c                	pop    %r12
+  8028a0:	41 5d                	pop    %r13
+  8028a2:	41 5e                	pop    %r14
+  8028a4:	41 5f                	pop    %r15
+  8028a6:	5d                   	pop    %rbp
+  8028a7:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028ad:	48 b8 77 45 80 00 00 	movabs $0x804577,%rax
+  8028b4:	00 00 00 
+  8028b7:	ff d0                	call   *%rax
+  8028b9:	a3 00 b0 98 00 00 00 	movabs %eax,0x98b000
+  8028c0:	00 00 
+  8028c2:	eb 92                	jmp    802856 <fsipc_region+0x2f>
+
+00000000008028c4 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	41 57                	push   %r15
+  8028ca:	41 56                	push   %r14
+  8028cc:	41 55                	push   %r13
+  8028ce:	41 54                	push   %r12
+  8028d0:	53                   	push   %rbx
+  8028d1:	48 83 ec 28          	sub    $0x28,%rsp
+  8028d5:	49 89 ff             	mov    %rdi,%r15
+  8028d8:	49 89 f6             	mov    %rsi,%r14
+  8028db:	48 89 d3             	mov    %rdx,%rbx
+  8028de:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8028e2:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8028e5:	48 b8 c1 27 80 00 00 	movabs $0x8027c1,%rax
+  8028ec:	00 00 00 
+  8028ef:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8028f1:	48 85 c0             	test   %rax,%rax
+  8028f4:	0f 84 cc 00 00 00    	je     8029c6 <devfile_write_direct+0x102>
+  8028fa:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8028fd:	48 85 db             	test   %rbx,%rbx
+  802900:	0f 84 ba 00 00 00    	je     8029c0 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802906:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80290c:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802913:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802917:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80291b:	4c 29 e3             	sub    %r12,%rbx
+  80291e:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802923:	48 39 c3             	cmp    %rax,%rbx
+  802926:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80292a:	48 89 da             	mov    %rbx,%rdx
+  80292d:	4c 89 f6             	mov    %r14,%rsi
+  802930:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802934:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  80293b:	00 00 00 
+  80293e:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802940:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802944:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802948:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80294b:	44 01 e0             	add    %r12d,%eax
+  80294e:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802952:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802956:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80295d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802964:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80296b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802971:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802976:	4c 89 ee             	mov    %r13,%rsi
+  802979:	bf 04 00 00 00       	mov    $0x4,%edi
+  80297e:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  802985:	00 00 00 
+  802988:	ff d0                	call   *%rax
+        if (res < 0)
+  80298a:	85 c0                	test   %eax,%eax
+  80298c:	78 29                	js     8029b7 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80298e:	74 2b                	je     8029bb <devfile_write_direct+0xf7>
+        i += res;
+  802990:	48 98                	cltq
+  802992:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802995:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802998:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80299c:	49 39 c4             	cmp    %rax,%r12
+  80299f:	0f 82 72 ff ff ff    	jb     802917 <devfile_write_direct+0x53>
+    return i;
+  8029a5:	4c 89 e0             	mov    %r12,%rax
+}
+  8029a8:	48 83 c4 28          	add    $0x28,%rsp
+  8029ac:	5b                   	pop    %rbx
+  8029ad:	41 5c                	pop    %r12
+  8029af:	41 5d                	pop    %r13
+  8029b1:	41 5e                	pop    %r14
+  8029b3:	41 5f                	pop    %r15
+  8029b5:	5d                   	pop    %rbp
+  8029b6:	c3                   	ret
+            return res;
+  8029b7:	48 98                	cltq
+  8029b9:	eb ed                	jmp    8029a8 <devfile_write_direct+0xe4>
+            return i;
+  8029bb:	4c 89 e0             	mov    %r12,%rax
+  8029be:	eb e8                	jmp    8029a8 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8029c0:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8029c4:	eb df                	jmp    8029a5 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8029c6:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8029cd:	eb d9                	jmp    8029a8 <devfile_write_direct+0xe4>
+
+00000000008029cf <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8029cf:	55                   	push   %rbp
+  8029d0:	48 89 e5             	mov    %rsp,%rbp
+  8029d3:	41 56                	push   %r14
+  8029d5:	41 55                	push   %r13
+  8029d7:	41 54                	push   %r12
+  8029d9:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8029da:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8029de:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8029e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e7:	4d 39 ee             	cmp    %r13,%r14
+  8029ea:	0f 84 99 00 00 00    	je     802a89 <fbuf_flush+0xba>
+  8029f0:	49 89 fc             	mov    %rdi,%r12
+  8029f3:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8029f6:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8029f9:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8029fd:	48 b8 d3 1e 80 00 00 	movabs $0x801ed3,%rax
+  802a04:	00 00 00 
+  802a07:	ff d0                	call   *%rax
+  802a09:	48 89 c2             	mov    %rax,%rdx
+  802a0c:	48 c1 e2 04          	shl    $0x4,%rdx
+  802a10:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802a14:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a18:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802a1d:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802a20:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802a24:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802a2b:	00 
+  802a2c:	44 89 f1             	mov    %r14d,%ecx
+  802a2f:	4c 89 ea             	mov    %r13,%rdx
+  802a32:	4c 89 e7             	mov    %r12,%rdi
+  802a35:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  802a3c:	00 00 00 
+  802a3f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a41:	48 85 c0             	test   %rax,%rax
+  802a44:	78 43                	js     802a89 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802a46:	4c 39 e8             	cmp    %r13,%rax
+  802a49:	72 47                	jb     802a92 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802a4b:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802a50:	83 c0 01             	add    $0x1,%eax
+  802a53:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802a58:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802a5b:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802a5f:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802a63:	72 0f                	jb     802a74 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802a65:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802a69:	48 39 c2             	cmp    %rax,%rdx
+  802a6c:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802a70:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802a74:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802a7b:	00 
+  802a7c:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802a83:	00 
+    return 0;
+  802a84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a89:	5b                   	pop    %rbx
+  802a8a:	41 5c                	pop    %r12
+  802a8c:	41 5d                	pop    %r13
+  802a8e:	41 5e                	pop    %r14
+  802a90:	5d                   	pop    %rbp
+  802a91:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802a92:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802a97:	eb f0                	jmp    802a89 <fbuf_flush+0xba>
+
+0000000000802a99 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802a99:	55                   	push   %rbp
+  802a9a:	48 89 e5             	mov    %rsp,%rbp
+  802a9d:	53                   	push   %rbx
+  802a9e:	48 83 ec 08          	sub    $0x8,%rsp
+  802aa2:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802aa5:	48 b8 a7 26 80 00 00 	movabs $0x8026a7,%rax
+  802aac:	00 00 00 
+  802aaf:	ff d0                	call   *%rax
+  802ab1:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab9:	48 85 f6             	test   %rsi,%rsi
+  802abc:	74 0f                	je     802acd <devfile_sync+0x34>
+  802abe:	48 89 df             	mov    %rbx,%rdi
+  802ac1:	48 b8 cf 29 80 00 00 	movabs $0x8029cf,%rax
+  802ac8:	00 00 00 
+  802acb:	ff d0                	call   *%rax
+}
+  802acd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ad1:	c9                   	leave
+  802ad2:	c3                   	ret
+
+0000000000802ad3 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802ad3:	55                   	push   %rbp
+  802ad4:	48 89 e5             	mov    %rsp,%rbp
+  802ad7:	48 83 ec 10          	sub    $0x10,%rsp
+  802adb:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802ade:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802ae5:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802ae6:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802aea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802aef:	48 be 00 a0 98 00 00 	movabs $0x98a000,%rsi
+  802af6:	00 00 00 
+  802af9:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  802b00:	00 00 00 
+  802b03:	ff d0                	call   *%rax
+}
+  802b05:	c9                   	leave
+  802b06:	c3                   	ret
+
+0000000000802b07 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802b07:	55                   	push   %rbp
+  802b08:	48 89 e5             	mov    %rsp,%rbp
+  802b0b:	41 54                	push   %r12
+  802b0d:	53                   	push   %rbx
+  802b0e:	48 89 fb             	mov    %rdi,%rbx
+  802b11:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802b14:	48 b8 99 2a 80 00 00 	movabs $0x802a99,%rax
+  802b1b:	00 00 00 
+  802b1e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b20:	85 c0                	test   %eax,%eax
+  802b22:	78 63                	js     802b87 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802b24:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b27:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  802b2e:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802b30:	be 00 00 00 00       	mov    $0x0,%esi
+  802b35:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b3a:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  802b41:	00 00 00 
+  802b44:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b46:	85 c0                	test   %eax,%eax
+  802b48:	78 3d                	js     802b87 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b4a:	48 bb 00 a0 98 00 00 	movabs $0x98a000,%rbx
+  802b51:	00 00 00 
+  802b54:	48 89 de             	mov    %rbx,%rsi
+  802b57:	4c 89 e7             	mov    %r12,%rdi
+  802b5a:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  802b61:	00 00 00 
+  802b64:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b66:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802b6c:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802b73:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b74:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802b7a:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802b81:	00 
+
+    return 0;
+  802b82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b87:	5b                   	pop    %rbx
+  802b88:	41 5c                	pop    %r12
+  802b8a:	5d                   	pop    %rbp
+  802b8b:	c3                   	ret
+
+0000000000802b8c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b8c:	55                   	push   %rbp
+  802b8d:	48 89 e5             	mov    %rsp,%rbp
+  802b90:	41 54                	push   %r12
+  802b92:	53                   	push   %rbx
+  802b93:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802b96:	48 b8 99 2a 80 00 00 	movabs $0x802a99,%rax
+  802b9d:	00 00 00 
+  802ba0:	ff d0                	call   *%rax
+  802ba2:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802ba5:	48 89 df             	mov    %rbx,%rdi
+  802ba8:	48 b8 d3 1e 80 00 00 	movabs $0x801ed3,%rax
+  802baf:	00 00 00 
+  802bb2:	ff d0                	call   *%rax
+  802bb4:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802bb8:	76 2e                	jbe    802be8 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802bba:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802bbd:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  802bc4:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802bc6:	be 00 00 00 00       	mov    $0x0,%esi
+  802bcb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bd0:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  802bd7:	00 00 00 
+  802bda:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802bdc:	45 85 e4             	test   %r12d,%r12d
+  802bdf:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802be3:	5b                   	pop    %rbx
+  802be4:	41 5c                	pop    %r12
+  802be6:	5d                   	pop    %rbp
+  802be7:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802be8:	48 89 df             	mov    %rbx,%rdi
+  802beb:	48 b8 d3 1e 80 00 00 	movabs $0x801ed3,%rax
+  802bf2:	00 00 00 
+  802bf5:	ff d0                	call   *%rax
+  802bf7:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802bfb:	48 b8 20 b0 98 00 00 	movabs $0x98b020,%rax
+  802c02:	00 00 00 
+  802c05:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802c0c:	48 89 df             	mov    %rbx,%rdi
+  802c0f:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  802c16:	00 00 00 
+  802c19:	ff d0                	call   *%rax
+  802c1b:	48 89 c6             	mov    %rax,%rsi
+  802c1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c28:	48 b8 9c 16 80 00 00 	movabs $0x80169c,%rax
+  802c2f:	00 00 00 
+  802c32:	ff d0                	call   *%rax
+  802c34:	eb 84                	jmp    802bba <devfile_flush+0x2e>
+
+0000000000802c36 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802c36:	55                   	push   %rbp
+  802c37:	48 89 e5             	mov    %rsp,%rbp
+  802c3a:	41 55                	push   %r13
+  802c3c:	41 54                	push   %r12
+  802c3e:	53                   	push   %rbx
+  802c3f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c43:	48 89 fb             	mov    %rdi,%rbx
+  802c46:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802c49:	48 b8 a7 26 80 00 00 	movabs $0x8026a7,%rax
+  802c50:	00 00 00 
+  802c53:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802c55:	48 85 c0             	test   %rax,%rax
+  802c58:	74 51                	je     802cab <devfile_trunc+0x75>
+  802c5a:	49 89 c4             	mov    %rax,%r12
+  802c5d:	48 89 c6             	mov    %rax,%rsi
+  802c60:	48 89 df             	mov    %rbx,%rdi
+  802c63:	48 b8 cf 29 80 00 00 	movabs $0x8029cf,%rax
+  802c6a:	00 00 00 
+  802c6d:	ff d0                	call   *%rax
+  802c6f:	85 c0                	test   %eax,%eax
+  802c71:	78 2d                	js     802ca0 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802c73:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  802c7a:	00 00 00 
+  802c7d:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802c80:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802c82:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802c86:	be 00 00 00 00       	mov    $0x0,%esi
+  802c8b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c90:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  802c97:	00 00 00 
+  802c9a:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802c9c:	85 c0                	test   %eax,%eax
+  802c9e:	79 3e                	jns    802cde <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802ca0:	48 83 c4 08          	add    $0x8,%rsp
+  802ca4:	5b                   	pop    %rbx
+  802ca5:	41 5c                	pop    %r12
+  802ca7:	41 5d                	pop    %r13
+  802ca9:	5d                   	pop    %rbp
+  802caa:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802cab:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  802cb2:	00 00 00 
+  802cb5:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802cb8:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802cba:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802cbe:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc3:	bf 02 00 00 00       	mov    $0x2,%edi
+  802cc8:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  802ccf:	00 00 00 
+  802cd2:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802cd4:	85 c0                	test   %eax,%eax
+  802cd6:	78 c8                	js     802ca0 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802cd8:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802cdc:	eb c2                	jmp    802ca0 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802cde:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802ce1:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ce4:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ce7:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802cec:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802cf3:	00 00 
+  802cf5:	eb a9                	jmp    802ca0 <devfile_trunc+0x6a>
+
+0000000000802cf7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802cf7:	55                   	push   %rbp
+  802cf8:	48 89 e5             	mov    %rsp,%rbp
+  802cfb:	41 57                	push   %r15
+  802cfd:	41 56                	push   %r14
+  802cff:	41 55                	push   %r13
+  802d01:	41 54                	push   %r12
+  802d03:	53                   	push   %rbx
+  802d04:	48 83 ec 28          	sub    $0x28,%rsp
+  802d08:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802d0c:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d10:	49 89 d7             	mov    %rdx,%r15
+  802d13:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802d17:	48 b8 a7 26 80 00 00 	movabs $0x8026a7,%rax
+  802d1e:	00 00 00 
+  802d21:	ff d0                	call   *%rax
+  802d23:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802d26:	48 85 c0             	test   %rax,%rax
+  802d29:	74 31                	je     802d5c <devfile_write+0x65>
+  802d2b:	4c 89 f8             	mov    %r15,%rax
+  802d2e:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802d35:	77 25                	ja     802d5c <devfile_write+0x65>
+    size_t i = 0;
+  802d37:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802d3d:	48 85 c0             	test   %rax,%rax
+  802d40:	0f 85 64 01 00 00    	jne    802eaa <devfile_write+0x1b3>
+    size_t i = 0;
+  802d46:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802d4a:	4c 89 f8             	mov    %r15,%rax
+}
+  802d4d:	48 83 c4 28          	add    $0x28,%rsp
+  802d51:	5b                   	pop    %rbx
+  802d52:	41 5c                	pop    %r12
+  802d54:	41 5d                	pop    %r13
+  802d56:	41 5e                	pop    %r14
+  802d58:	41 5f                	pop    %r15
+  802d5a:	5d                   	pop    %rbp
+  802d5b:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d5c:	48 85 db             	test   %rbx,%rbx
+  802d5f:	74 5b                	je     802dbc <devfile_write+0xc5>
+  802d61:	48 89 de             	mov    %rbx,%rsi
+  802d64:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d68:	48 b8 cf 29 80 00 00 	movabs $0x8029cf,%rax
+  802d6f:	00 00 00 
+  802d72:	ff d0                	call   *%rax
+  802d74:	85 c0                	test   %eax,%eax
+  802d76:	78 40                	js     802db8 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802d78:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d7c:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802d7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d83:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802d87:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  802d8e:	00 00 00 
+  802d91:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802d93:	48 85 c0             	test   %rax,%rax
+  802d96:	7e b5                	jle    802d4d <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802d98:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802d9c:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802d9f:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802da2:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802da5:	8d 51 01             	lea    0x1(%rcx),%edx
+  802da8:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802dab:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802dae:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802db5:	00 
+  802db6:	eb 95                	jmp    802d4d <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802db8:	48 98                	cltq
+  802dba:	eb 91                	jmp    802d4d <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802dbc:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802dc0:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802dc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dc7:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802dcb:	48 89 df             	mov    %rbx,%rdi
+  802dce:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  802dd5:	00 00 00 
+  802dd8:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802dda:	48 85 c0             	test   %rax,%rax
+  802ddd:	0f 8e 6a ff ff ff    	jle    802d4d <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802de3:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802de6:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802dea:	e9 5e ff ff ff       	jmp    802d4d <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802def:	48 98                	cltq
+  802df1:	4d 85 ff             	test   %r15,%r15
+  802df4:	49 0f 45 c7          	cmovne %r15,%rax
+  802df8:	e9 50 ff ff ff       	jmp    802d4d <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802dfd:	48 89 de             	mov    %rbx,%rsi
+  802e00:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e04:	48 b8 cf 29 80 00 00 	movabs $0x8029cf,%rax
+  802e0b:	00 00 00 
+  802e0e:	ff d0                	call   *%rax
+  802e10:	85 c0                	test   %eax,%eax
+  802e12:	0f 88 2b 01 00 00    	js     802f43 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802e18:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e1c:	4c 01 f8             	add    %r15,%rax
+  802e1f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802e23:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e27:	48 b9 d3 1e 80 00 00 	movabs $0x801ed3,%rcx
+  802e2e:	00 00 00 
+  802e31:	ff d1                	call   *%rcx
+  802e33:	48 89 c2             	mov    %rax,%rdx
+  802e36:	48 c1 e2 04          	shl    $0x4,%rdx
+  802e3a:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802e3e:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e42:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802e47:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802e4a:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802e51:	00 
+  802e52:	4c 89 ea             	mov    %r13,%rdx
+  802e55:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802e59:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  802e60:	00 00 00 
+  802e63:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802e65:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802e69:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802e6d:	48 39 c2             	cmp    %rax,%rdx
+  802e70:	0f 84 db 00 00 00    	je     802f51 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802e76:	4c 39 e2             	cmp    %r12,%rdx
+  802e79:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802e7d:	4d 01 ec             	add    %r13,%r12
+  802e80:	49 39 c4             	cmp    %rax,%r12
+  802e83:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802e87:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802e8b:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802e8f:	45 01 ee             	add    %r13d,%r14d
+  802e92:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e96:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802e9a:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802e9d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ea1:	49 39 c7             	cmp    %rax,%r15
+  802ea4:	0f 83 a0 fe ff ff    	jae    802d4a <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802eaa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802eae:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802eb2:	8b 43 08             	mov    0x8(%rbx),%eax
+  802eb5:	44 39 f0             	cmp    %r14d,%eax
+  802eb8:	7f 10                	jg     802eca <devfile_write+0x1d3>
+  802eba:	48 98                	cltq
+  802ebc:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802ec2:	49 63 d6             	movslq %r14d,%rdx
+  802ec5:	48 39 d0             	cmp    %rdx,%rax
+  802ec8:	7d 2d                	jge    802ef7 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802eca:	48 89 de             	mov    %rbx,%rsi
+  802ecd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802ed1:	48 b8 cf 29 80 00 00 	movabs $0x8029cf,%rax
+  802ed8:	00 00 00 
+  802edb:	ff d0                	call   *%rax
+  802edd:	85 c0                	test   %eax,%eax
+  802edf:	0f 88 0a ff ff ff    	js     802def <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802ee5:	44 89 f0             	mov    %r14d,%eax
+  802ee8:	66 b8 00 00          	mov    $0x0,%ax
+  802eec:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802eef:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802ef6:	00 
+        size_t off = pos - fb->fb_base;
+  802ef7:	45 89 f4             	mov    %r14d,%r12d
+  802efa:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802efe:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802f01:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802f05:	4d 29 fd             	sub    %r15,%r13
+  802f08:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802f0d:	4c 29 e0             	sub    %r12,%rax
+  802f10:	49 39 c5             	cmp    %rax,%r13
+  802f13:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802f17:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802f1b:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802f1f:	48 39 c2             	cmp    %rax,%rdx
+  802f22:	0f 84 f0 fe ff ff    	je     802e18 <devfile_write+0x121>
+  802f28:	4c 39 e0             	cmp    %r12,%rax
+  802f2b:	0f 82 cc fe ff ff    	jb     802dfd <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802f31:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802f35:	48 39 d0             	cmp    %rdx,%rax
+  802f38:	0f 83 da fe ff ff    	jae    802e18 <devfile_write+0x121>
+  802f3e:	e9 ba fe ff ff       	jmp    802dfd <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f43:	48 98                	cltq
+  802f45:	4d 85 ff             	test   %r15,%r15
+  802f48:	49 0f 45 c7          	cmovne %r15,%rax
+  802f4c:	e9 fc fd ff ff       	jmp    802d4d <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802f51:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802f55:	4c 89 e2             	mov    %r12,%rdx
+  802f58:	e9 2a ff ff ff       	jmp    802e87 <devfile_write+0x190>
+
+0000000000802f5d <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802f5d:	55                   	push   %rbp
+  802f5e:	48 89 e5             	mov    %rsp,%rbp
+  802f61:	41 57                	push   %r15
+  802f63:	41 56                	push   %r14
+  802f65:	41 55                	push   %r13
+  802f67:	41 54                	push   %r12
+  802f69:	53                   	push   %rbx
+  802f6a:	48 83 ec 28          	sub    $0x28,%rsp
+  802f6e:	49 89 ff             	mov    %rdi,%r15
+  802f71:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f75:	48 89 d3             	mov    %rdx,%rbx
+  802f78:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f7c:	48 b8 a7 26 80 00 00 	movabs $0x8026a7,%rax
+  802f83:	00 00 00 
+  802f86:	ff d0                	call   *%rax
+  802f88:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802f8b:	48 85 c0             	test   %rax,%rax
+  802f8e:	74 0d                	je     802f9d <devfile_read+0x40>
+  802f90:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802f97:	0f 86 1a 01 00 00    	jbe    8030b7 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f9d:	4d 85 e4             	test   %r12,%r12
+  802fa0:	74 1a                	je     802fbc <devfile_read+0x5f>
+  802fa2:	4c 89 e6             	mov    %r12,%rsi
+  802fa5:	4c 89 ff             	mov    %r15,%rdi
+  802fa8:	48 b8 cf 29 80 00 00 	movabs $0x8029cf,%rax
+  802faf:	00 00 00 
+  802fb2:	ff d0                	call   *%rax
+  802fb4:	85 c0                	test   %eax,%eax
+  802fb6:	0f 88 e8 00 00 00    	js     8030a4 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802fbc:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802fc0:	48 b8 c1 27 80 00 00 	movabs $0x8027c1,%rax
+  802fc7:	00 00 00 
+  802fca:	ff d0                	call   *%rax
+  802fcc:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802fcf:	48 85 c0             	test   %rax,%rax
+  802fd2:	0f 84 69 02 00 00    	je     803241 <devfile_read+0x2e4>
+    while (i < n) {
+  802fd8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802fdd:	0f 84 ce 00 00 00    	je     8030b1 <devfile_read+0x154>
+    size_t i = 0;
+  802fe3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802fe8:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802fef:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ff3:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802ff7:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802ffb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802fff:	48 29 da             	sub    %rbx,%rdx
+  803002:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803007:	48 39 c2             	cmp    %rax,%rdx
+  80300a:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  80300e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803012:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803016:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803019:	01 d8                	add    %ebx,%eax
+  80301b:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  80301f:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803023:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  80302a:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803031:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803038:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80303e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803043:	4c 89 ee             	mov    %r13,%rsi
+  803046:	bf 03 00 00 00       	mov    $0x3,%edi
+  80304b:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  803052:	00 00 00 
+  803055:	ff d0                	call   *%rax
+        if (res < 0)
+  803057:	85 c0                	test   %eax,%eax
+  803059:	78 4d                	js     8030a8 <devfile_read+0x14b>
+        if (res == 0)
+  80305b:	74 4f                	je     8030ac <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80305d:	4c 63 e0             	movslq %eax,%r12
+  803060:	4c 89 e2             	mov    %r12,%rdx
+  803063:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803067:	4c 89 f7             	mov    %r14,%rdi
+  80306a:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  803071:	00 00 00 
+  803074:	ff d0                	call   *%rax
+        i += res;
+  803076:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803079:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  80307c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803080:	48 39 c3             	cmp    %rax,%rbx
+  803083:	0f 82 72 ff ff ff    	jb     802ffb <devfile_read+0x9e>
+    return i;
+  803089:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80308c:	48 85 c0             	test   %rax,%rax
+  80308f:	7e 04                	jle    803095 <devfile_read+0x138>
+  803091:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803095:	48 83 c4 28          	add    $0x28,%rsp
+  803099:	5b                   	pop    %rbx
+  80309a:	41 5c                	pop    %r12
+  80309c:	41 5d                	pop    %r13
+  80309e:	41 5e                	pop    %r14
+  8030a0:	41 5f                	pop    %r15
+  8030a2:	5d                   	pop    %rbp
+  8030a3:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8030a4:	48 98                	cltq
+  8030a6:	eb ed                	jmp    803095 <devfile_read+0x138>
+            return res;
+  8030a8:	48 98                	cltq
+  8030aa:	eb e9                	jmp    803095 <devfile_read+0x138>
+            return i;
+  8030ac:	48 89 d8             	mov    %rbx,%rax
+  8030af:	eb db                	jmp    80308c <devfile_read+0x12f>
+    size_t i = 0;
+  8030b1:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8030b5:	eb d2                	jmp    803089 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8030b7:	48 89 c6             	mov    %rax,%rsi
+  8030ba:	4c 89 ff             	mov    %r15,%rdi
+  8030bd:	48 b8 cf 29 80 00 00 	movabs $0x8029cf,%rax
+  8030c4:	00 00 00 
+  8030c7:	ff d0                	call   *%rax
+  8030c9:	85 c0                	test   %eax,%eax
+  8030cb:	78 40                	js     80310d <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8030cd:	4c 89 ff             	mov    %r15,%rdi
+  8030d0:	48 b8 d3 1e 80 00 00 	movabs $0x801ed3,%rax
+  8030d7:	00 00 00 
+  8030da:	ff d0                	call   *%rax
+  8030dc:	48 89 c2             	mov    %rax,%rdx
+  8030df:	48 c1 e2 04          	shl    $0x4,%rdx
+  8030e3:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8030e7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030eb:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8030f0:	48 01 d0             	add    %rdx,%rax
+  8030f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8030f7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8030fc:	0f 84 33 01 00 00    	je     803235 <devfile_read+0x2d8>
+    size_t i = 0;
+  803102:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803108:	e9 f5 00 00 00       	jmp    803202 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80310d:	48 98                	cltq
+  80310f:	eb 84                	jmp    803095 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803111:	44 89 e8             	mov    %r13d,%eax
+  803114:	66 b8 00 00          	mov    $0x0,%ax
+  803118:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  80311d:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803124:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803126:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80312a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80312e:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803130:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803135:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803138:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  80313f:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803140:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803146:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80314b:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803150:	bf 03 00 00 00       	mov    $0x3,%edi
+  803155:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  80315c:	00 00 00 
+  80315f:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803161:	85 c0                	test   %eax,%eax
+  803163:	0f 88 be 00 00 00    	js     803227 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803169:	48 63 d0             	movslq %eax,%rdx
+  80316c:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803171:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803176:	44 39 e8             	cmp    %r13d,%eax
+  803179:	0f 8e ba 00 00 00    	jle    803239 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80317f:	49 63 c5             	movslq %r13d,%rax
+  803182:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803187:	48 29 c3             	sub    %rax,%rbx
+  80318a:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80318f:	48 01 c3             	add    %rax,%rbx
+  803192:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803196:	4c 29 f0             	sub    %r14,%rax
+  803199:	48 39 c3             	cmp    %rax,%rbx
+  80319c:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8031a0:	4c 89 ff             	mov    %r15,%rdi
+  8031a3:	48 b9 d3 1e 80 00 00 	movabs $0x801ed3,%rcx
+  8031aa:	00 00 00 
+  8031ad:	ff d1                	call   *%rcx
+  8031af:	48 89 c2             	mov    %rax,%rdx
+  8031b2:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031b6:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8031ba:	48 c1 e0 0c          	shl    $0xc,%rax
+  8031be:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8031c3:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8031c6:	44 89 ea             	mov    %r13d,%edx
+  8031c9:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8031ce:	48 63 d2             	movslq %edx,%rdx
+  8031d1:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8031d8:	00 
+  8031d9:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8031dd:	4c 01 f7             	add    %r14,%rdi
+  8031e0:	48 89 da             	mov    %rbx,%rdx
+  8031e3:	48 b9 52 11 80 00 00 	movabs $0x801152,%rcx
+  8031ea:	00 00 00 
+  8031ed:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8031ef:	41 01 dd             	add    %ebx,%r13d
+  8031f2:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8031f6:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8031f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031fd:	49 39 c6             	cmp    %rax,%r14
+  803200:	73 37                	jae    803239 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803202:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803206:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80320b:	44 39 e8             	cmp    %r13d,%eax
+  80320e:	0f 8f fd fe ff ff    	jg     803111 <devfile_read+0x1b4>
+  803214:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803219:	44 39 e8             	cmp    %r13d,%eax
+  80321c:	0f 8f 5d ff ff ff    	jg     80317f <devfile_read+0x222>
+  803222:	e9 ea fe ff ff       	jmp    803111 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803227:	48 98                	cltq
+  803229:	4d 85 f6             	test   %r14,%r14
+  80322c:	49 0f 45 c6          	cmovne %r14,%rax
+  803230:	e9 60 fe ff ff       	jmp    803095 <devfile_read+0x138>
+    size_t i = 0;
+  803235:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803239:	4c 89 f0             	mov    %r14,%rax
+  80323c:	e9 54 fe ff ff       	jmp    803095 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803241:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803248:	e9 48 fe ff ff       	jmp    803095 <devfile_read+0x138>
+
+000000000080324d <open>:
+open(const char *path, int mode) {
+  80324d:	55                   	push   %rbp
+  80324e:	48 89 e5             	mov    %rsp,%rbp
+  803251:	41 55                	push   %r13
+  803253:	41 54                	push   %r12
+  803255:	53                   	push   %rbx
+  803256:	48 83 ec 18          	sub    $0x18,%rsp
+  80325a:	49 89 fc             	mov    %rdi,%r12
+  80325d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803260:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  803267:	00 00 00 
+  80326a:	ff d0                	call   *%rax
+  80326c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803272:	0f 87 8a 00 00 00    	ja     803302 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803278:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80327c:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  803283:	00 00 00 
+  803286:	ff d0                	call   *%rax
+  803288:	89 c3                	mov    %eax,%ebx
+  80328a:	85 c0                	test   %eax,%eax
+  80328c:	78 50                	js     8032de <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80328e:	4c 89 e6             	mov    %r12,%rsi
+  803291:	48 bb 00 a0 98 00 00 	movabs $0x98a000,%rbx
+  803298:	00 00 00 
+  80329b:	48 89 df             	mov    %rbx,%rdi
+  80329e:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  8032a5:	00 00 00 
+  8032a8:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8032aa:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8032b1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8032b5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8032ba:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  8032c1:	00 00 00 
+  8032c4:	ff d0                	call   *%rax
+  8032c6:	89 c3                	mov    %eax,%ebx
+  8032c8:	85 c0                	test   %eax,%eax
+  8032ca:	78 1f                	js     8032eb <open+0x9e>
+    return fd2num(fd);
+  8032cc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032d0:	48 b8 d3 1e 80 00 00 	movabs $0x801ed3,%rax
+  8032d7:	00 00 00 
+  8032da:	ff d0                	call   *%rax
+  8032dc:	89 c3                	mov    %eax,%ebx
+}
+  8032de:	89 d8                	mov    %ebx,%eax
+  8032e0:	48 83 c4 18          	add    $0x18,%rsp
+  8032e4:	5b                   	pop    %rbx
+  8032e5:	41 5c                	pop    %r12
+  8032e7:	41 5d                	pop    %r13
+  8032e9:	5d                   	pop    %rbp
+  8032ea:	c3                   	ret
+        fd_close(fd, 0);
+  8032eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8032f0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032f4:	48 b8 1c 20 80 00 00 	movabs $0x80201c,%rax
+  8032fb:	00 00 00 
+  8032fe:	ff d0                	call   *%rax
+        return res;
+  803300:	eb dc                	jmp    8032de <open+0x91>
+        return -E_BAD_PATH;
+  803302:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803307:	eb d5                	jmp    8032de <open+0x91>
+
+0000000000803309 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803309:	55                   	push   %rbp
+  80330a:	48 89 e5             	mov    %rsp,%rbp
+  80330d:	41 57                	push   %r15
+  80330f:	41 56                	push   %r14
+  803311:	41 55                	push   %r13
+  803313:	41 54                	push   %r12
+  803315:	53                   	push   %rbx
+  803316:	48 83 ec 18          	sub    $0x18,%rsp
+  80331a:	41 89 f6             	mov    %esi,%r14d
+  80331d:	49 89 d7             	mov    %rdx,%r15
+  803320:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803323:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803327:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  80332e:	00 00 00 
+  803331:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803333:	85 c0                	test   %eax,%eax
+  803335:	0f 88 db 00 00 00    	js     803416 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80333b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80333f:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803346:	00 00 00 
+  803349:	8b 00                	mov    (%rax),%eax
+  80334b:	39 07                	cmp    %eax,(%rdi)
+  80334d:	0f 85 db 00 00 00    	jne    80342e <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803353:	45 85 f6             	test   %r14d,%r14d
+  803356:	0f 88 db 00 00 00    	js     803437 <fmap+0x12e>
+  80335c:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803363:	0f 85 d7 00 00 00    	jne    803440 <fmap+0x137>
+  803369:	4c 89 fb             	mov    %r15,%rbx
+  80336c:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803372:	0f 85 d1 00 00 00    	jne    803449 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803378:	48 b8 99 2a 80 00 00 	movabs $0x802a99,%rax
+  80337f:	00 00 00 
+  803382:	ff d0                	call   *%rax
+  803384:	85 c0                	test   %eax,%eax
+  803386:	0f 88 8e 00 00 00    	js     80341a <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80338c:	49 bc 00 a0 98 00 00 	movabs $0x98a000,%r12
+  803393:	00 00 00 
+    while (i < n) {
+  803396:	4d 85 ed             	test   %r13,%r13
+  803399:	0f 84 8a 00 00 00    	je     803429 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80339f:	4c 89 ea             	mov    %r13,%rdx
+  8033a2:	48 29 da             	sub    %rbx,%rdx
+  8033a5:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8033ac:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8033b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8033b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033ba:	8b 40 0c             	mov    0xc(%rax),%eax
+  8033bd:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8033c1:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8033c5:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8033ca:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8033cf:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8033d3:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8033d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033dc:	4c 89 e6             	mov    %r12,%rsi
+  8033df:	bf 09 00 00 00       	mov    $0x9,%edi
+  8033e4:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  8033eb:	00 00 00 
+  8033ee:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8033f0:	85 c0                	test   %eax,%eax
+  8033f2:	78 2a                	js     80341e <fmap+0x115>
+        i += res;
+  8033f4:	48 98                	cltq
+  8033f6:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8033f9:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8033fd:	72 05                	jb     803404 <fmap+0xfb>
+    while (i < n) {
+  8033ff:	4c 39 eb             	cmp    %r13,%rbx
+  803402:	72 9b                	jb     80339f <fmap+0x96>
+    }
+    return i;
+  803404:	48 89 d8             	mov    %rbx,%rax
+}
+  803407:	48 83 c4 18          	add    $0x18,%rsp
+  80340b:	5b                   	pop    %rbx
+  80340c:	41 5c                	pop    %r12
+  80340e:	41 5d                	pop    %r13
+  803410:	41 5e                	pop    %r14
+  803412:	41 5f                	pop    %r15
+  803414:	5d                   	pop    %rbp
+  803415:	c3                   	ret
+    if (res < 0) return res;
+  803416:	48 98                	cltq
+  803418:	eb ed                	jmp    803407 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80341a:	48 98                	cltq
+  80341c:	eb e9                	jmp    803407 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  80341e:	48 98                	cltq
+  803420:	48 85 db             	test   %rbx,%rbx
+  803423:	48 0f 45 c3          	cmovne %rbx,%rax
+  803427:	eb de                	jmp    803407 <fmap+0xfe>
+    size_t i = 0;
+  803429:	4c 89 eb             	mov    %r13,%rbx
+  80342c:	eb d6                	jmp    803404 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80342e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803435:	eb d0                	jmp    803407 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803437:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80343e:	eb c7                	jmp    803407 <fmap+0xfe>
+  803440:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803447:	eb be                	jmp    803407 <fmap+0xfe>
+  803449:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803450:	eb b5                	jmp    803407 <fmap+0xfe>
+
+0000000000803452 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803452:	55                   	push   %rbp
+  803453:	48 89 e5             	mov    %rsp,%rbp
+  803456:	41 56                	push   %r14
+  803458:	41 55                	push   %r13
+  80345a:	41 54                	push   %r12
+  80345c:	53                   	push   %rbx
+  80345d:	48 83 ec 10          	sub    $0x10,%rsp
+  803461:	89 fb                	mov    %edi,%ebx
+  803463:	41 89 f4             	mov    %esi,%r12d
+  803466:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803469:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80346d:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  803474:	00 00 00 
+  803477:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803479:	85 c0                	test   %eax,%eax
+  80347b:	78 63                	js     8034e0 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80347d:	45 85 e4             	test   %r12d,%r12d
+  803480:	0f 88 80 00 00 00    	js     803506 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803486:	45 89 e6             	mov    %r12d,%r14d
+  803489:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803490:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803494:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+  8034a0:	48 89 c2             	mov    %rax,%rdx
+  8034a3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8034a8:	44 89 f6             	mov    %r14d,%esi
+  8034ab:	89 df                	mov    %ebx,%edi
+  8034ad:	48 b8 09 33 80 00 00 	movabs $0x803309,%rax
+  8034b4:	00 00 00 
+  8034b7:	ff d0                	call   *%rax
+  8034b9:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8034bc:	45 29 f4             	sub    %r14d,%r12d
+  8034bf:	4d 63 f4             	movslq %r12d,%r14
+  8034c2:	49 39 c6             	cmp    %rax,%r14
+  8034c5:	7c 1d                	jl     8034e4 <read_map+0x92>
+  8034c7:	48 85 c0             	test   %rax,%rax
+  8034ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034cf:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8034d3:	48 83 c4 10          	add    $0x10,%rsp
+  8034d7:	5b                   	pop    %rbx
+  8034d8:	41 5c                	pop    %r12
+  8034da:	41 5d                	pop    %r13
+  8034dc:	41 5e                	pop    %r14
+  8034de:	5d                   	pop    %rbp
+  8034df:	c3                   	ret
+    if (res < 0) return res;
+  8034e0:	48 98                	cltq
+  8034e2:	eb ef                	jmp    8034d3 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8034e4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034e8:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  8034ef:	00 00 00 
+  8034f2:	ff d0                	call   *%rax
+  8034f4:	4d 63 e4             	movslq %r12d,%r12
+  8034f7:	4c 01 e0             	add    %r12,%rax
+  8034fa:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8034fe:	48 89 d8             	mov    %rbx,%rax
+  803501:	4c 29 f0             	sub    %r14,%rax
+  803504:	eb cd                	jmp    8034d3 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803506:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80350d:	eb c4                	jmp    8034d3 <read_map+0x81>
+
+000000000080350f <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  80350f:	55                   	push   %rbp
+  803510:	48 89 e5             	mov    %rsp,%rbp
+  803513:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803517:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80351b:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  803522:	00 00 00 
+  803525:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803527:	85 c0                	test   %eax,%eax
+  803529:	78 4a                	js     803575 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80352b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80352f:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803536:	00 00 00 
+  803539:	8b 00                	mov    (%rax),%eax
+  80353b:	39 07                	cmp    %eax,(%rdi)
+  80353d:	75 38                	jne    803577 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80353f:	48 b8 99 2a 80 00 00 	movabs $0x802a99,%rax
+  803546:	00 00 00 
+  803549:	ff d0                	call   *%rax
+  80354b:	85 c0                	test   %eax,%eax
+  80354d:	78 26                	js     803575 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80354f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803553:	8b 40 0c             	mov    0xc(%rax),%eax
+  803556:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  80355d:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80355f:	be 00 00 00 00       	mov    $0x0,%esi
+  803564:	bf 06 00 00 00       	mov    $0x6,%edi
+  803569:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  803570:	00 00 00 
+  803573:	ff d0                	call   *%rax
+}
+  803575:	c9                   	leave
+  803576:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803577:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80357c:	eb f7                	jmp    803575 <fsync+0x66>
+
+000000000080357e <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80357e:	55                   	push   %rbp
+  80357f:	48 89 e5             	mov    %rsp,%rbp
+  803582:	41 57                	push   %r15
+  803584:	41 56                	push   %r14
+  803586:	41 55                	push   %r13
+  803588:	41 54                	push   %r12
+  80358a:	53                   	push   %rbx
+  80358b:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80358f:	49 bc 20 b0 98 00 00 	movabs $0x98b020,%r12
+  803596:	00 00 00 
+  803599:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80359e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8035a4:	49 bd 61 1f 80 00 00 	movabs $0x801f61,%r13
+  8035ab:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8035ae:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8035b5:	00 00 00 
+  8035b8:	eb 0c                	jmp    8035c6 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8035ba:	83 c3 01             	add    $0x1,%ebx
+  8035bd:	49 83 c4 28          	add    $0x28,%r12
+  8035c1:	83 fb 20             	cmp    $0x20,%ebx
+  8035c4:	74 33                	je     8035f9 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8035c6:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8035cb:	74 ed                	je     8035ba <flushall+0x3c>
+  8035cd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8035d1:	89 df                	mov    %ebx,%edi
+  8035d3:	41 ff d5             	call   *%r13
+  8035d6:	85 c0                	test   %eax,%eax
+  8035d8:	78 e0                	js     8035ba <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8035da:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8035de:	41 8b 06             	mov    (%r14),%eax
+  8035e1:	39 07                	cmp    %eax,(%rdi)
+  8035e3:	75 d5                	jne    8035ba <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8035e5:	48 b8 99 2a 80 00 00 	movabs $0x802a99,%rax
+  8035ec:	00 00 00 
+  8035ef:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8035f1:	85 c0                	test   %eax,%eax
+  8035f3:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8035f7:	eb c1                	jmp    8035ba <flushall+0x3c>
+    }
+    return res;
+}
+  8035f9:	44 89 f8             	mov    %r15d,%eax
+  8035fc:	48 83 c4 18          	add    $0x18,%rsp
+  803600:	5b                   	pop    %rbx
+  803601:	41 5c                	pop    %r12
+  803603:	41 5d                	pop    %r13
+  803605:	41 5e                	pop    %r14
+  803607:	41 5f                	pop    %r15
+  803609:	5d                   	pop    %rbp
+  80360a:	c3                   	ret
+
+000000000080360b <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80360b:	55                   	push   %rbp
+  80360c:	48 89 e5             	mov    %rsp,%rbp
+  80360f:	53                   	push   %rbx
+  803610:	48 83 ec 08          	sub    $0x8,%rsp
+  803614:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803617:	40 0f b6 c6          	movzbl %sil,%eax
+  80361b:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  803622:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803624:	be 00 00 00 00       	mov    $0x0,%esi
+  803629:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80362e:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  803635:	00 00 00 
+  803638:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80363a:	85 c0                	test   %eax,%eax
+  80363c:	78 23                	js     803661 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80363e:	ba 58 06 00 00       	mov    $0x658,%edx
+  803643:	48 be 00 a0 98 00 00 	movabs $0x98a000,%rsi
+  80364a:	00 00 00 
+  80364d:	48 89 df             	mov    %rbx,%rdi
+  803650:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  803657:	00 00 00 
+  80365a:	ff d0                	call   *%rax
+    return 0;
+  80365c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803661:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803665:	c9                   	leave
+  803666:	c3                   	ret
+
+0000000000803667 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803667:	55                   	push   %rbp
+  803668:	48 89 e5             	mov    %rsp,%rbp
+  80366b:	53                   	push   %rbx
+  80366c:	48 83 ec 08          	sub    $0x8,%rsp
+  803670:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803673:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  80367a:	00 00 00 
+  80367d:	ff d0                	call   *%rax
+  80367f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803685:	77 35                	ja     8036bc <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803687:	48 89 de             	mov    %rbx,%rsi
+  80368a:	48 bf 00 a0 98 00 00 	movabs $0x98a000,%rdi
+  803691:	00 00 00 
+  803694:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  80369b:	00 00 00 
+  80369e:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8036a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8036a5:	bf 07 00 00 00       	mov    $0x7,%edi
+  8036aa:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  8036b1:	00 00 00 
+  8036b4:	ff d0                	call   *%rax
+}
+  8036b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036ba:	c9                   	leave
+  8036bb:	c3                   	ret
+        return -E_BAD_PATH;
+  8036bc:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8036c1:	eb f3                	jmp    8036b6 <remove+0x4f>
+
+00000000008036c3 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8036c3:	55                   	push   %rbp
+  8036c4:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8036c7:	48 b8 7e 35 80 00 00 	movabs $0x80357e,%rax
+  8036ce:	00 00 00 
+  8036d1:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8036d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8036d8:	bf 08 00 00 00       	mov    $0x8,%edi
+  8036dd:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  8036e4:	00 00 00 
+  8036e7:	ff d0                	call   *%rax
+}
+  8036e9:	5d                   	pop    %rbp
+  8036ea:	c3                   	ret
+
+00000000008036eb <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8036eb:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8036ef:	7f 01                	jg     8036f2 <writebuf+0x7>
+  8036f1:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8036f2:	55                   	push   %rbp
+  8036f3:	48 89 e5             	mov    %rsp,%rbp
+  8036f6:	53                   	push   %rbx
+  8036f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8036fb:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8036fe:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803702:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803706:	8b 3f                	mov    (%rdi),%edi
+  803708:	48 b8 73 23 80 00 00 	movabs $0x802373,%rax
+  80370f:	00 00 00 
+  803712:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803714:	48 85 c0             	test   %rax,%rax
+  803717:	7e 04                	jle    80371d <writebuf+0x32>
+  803719:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80371d:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803721:	48 39 c2             	cmp    %rax,%rdx
+  803724:	74 0f                	je     803735 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803726:	48 85 c0             	test   %rax,%rax
+  803729:	ba 00 00 00 00       	mov    $0x0,%edx
+  80372e:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803732:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803735:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803739:	c9                   	leave
+  80373a:	c3                   	ret
+
+000000000080373b <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80373b:	8b 46 04             	mov    0x4(%rsi),%eax
+  80373e:	8d 50 01             	lea    0x1(%rax),%edx
+  803741:	89 56 04             	mov    %edx,0x4(%rsi)
+  803744:	48 98                	cltq
+  803746:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80374b:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803751:	74 01                	je     803754 <putch+0x19>
+  803753:	c3                   	ret
+putch(int ch, void *arg) {
+  803754:	55                   	push   %rbp
+  803755:	48 89 e5             	mov    %rsp,%rbp
+  803758:	53                   	push   %rbx
+  803759:	48 83 ec 08          	sub    $0x8,%rsp
+  80375d:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803760:	48 89 f7             	mov    %rsi,%rdi
+  803763:	48 b8 eb 36 80 00 00 	movabs $0x8036eb,%rax
+  80376a:	00 00 00 
+  80376d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80376f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803776:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80377a:	c9                   	leave
+  80377b:	c3                   	ret
+
+000000000080377c <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80377c:	55                   	push   %rbp
+  80377d:	48 89 e5             	mov    %rsp,%rbp
+  803780:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803787:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80378a:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803790:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803797:	00 00 00 
+    state.result = 0;
+  80379a:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8037a1:	00 00 00 00 
+    state.error = 1;
+  8037a5:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8037ac:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8037af:	48 89 f2             	mov    %rsi,%rdx
+  8037b2:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8037b9:	48 bf 3b 37 80 00 00 	movabs $0x80373b,%rdi
+  8037c0:	00 00 00 
+  8037c3:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  8037ca:	00 00 00 
+  8037cd:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8037cf:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8037d6:	7f 14                	jg     8037ec <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8037d8:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8037df:	48 85 c0             	test   %rax,%rax
+  8037e2:	75 06                	jne    8037ea <vfprintf+0x6e>
+  8037e4:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8037ea:	c9                   	leave
+  8037eb:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8037ec:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8037f3:	48 b8 eb 36 80 00 00 	movabs $0x8036eb,%rax
+  8037fa:	00 00 00 
+  8037fd:	ff d0                	call   *%rax
+  8037ff:	eb d7                	jmp    8037d8 <vfprintf+0x5c>
+
+0000000000803801 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803801:	55                   	push   %rbp
+  803802:	48 89 e5             	mov    %rsp,%rbp
+  803805:	48 83 ec 50          	sub    $0x50,%rsp
+  803809:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80380d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803811:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803815:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803819:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803820:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803824:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803828:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80382c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803830:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803834:	48 b8 7c 37 80 00 00 	movabs $0x80377c,%rax
+  80383b:	00 00 00 
+  80383e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803840:	c9                   	leave
+  803841:	c3                   	ret
+
+0000000000803842 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803842:	55                   	push   %rbp
+  803843:	48 89 e5             	mov    %rsp,%rbp
+  803846:	48 83 ec 50          	sub    $0x50,%rsp
+  80384a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80384e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803852:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803856:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80385a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80385e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803865:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803869:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80386d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803871:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803875:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803879:	48 89 fe             	mov    %rdi,%rsi
+  80387c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803881:	48 b8 7c 37 80 00 00 	movabs $0x80377c,%rax
+  803888:	00 00 00 
+  80388b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80388d:	c9                   	leave
+  80388e:	c3                   	ret
+
+000000000080388f <puts>:
+
+int
+puts(const char *str) {
+  80388f:	55                   	push   %rbp
+  803890:	48 89 e5             	mov    %rsp,%rbp
+  803893:	48 89 fe             	mov    %rdi,%rsi
+    return printf("%s\n", str);
+  803896:	48 bf 00 57 80 00 00 	movabs $0x805700,%rdi
+  80389d:	00 00 00 
+  8038a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a5:	48 ba 42 38 80 00 00 	movabs $0x803842,%rdx
+  8038ac:	00 00 00 
+  8038af:	ff d2                	call   *%rdx
+}
+  8038b1:	5d                   	pop    %rbp
+  8038b2:	c3                   	ret
+
+00000000008038b3 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8038b3:	55                   	push   %rbp
+  8038b4:	48 89 e5             	mov    %rsp,%rbp
+  8038b7:	41 54                	push   %r12
+  8038b9:	53                   	push   %rbx
+  8038ba:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038bd:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  8038c4:	00 00 00 
+  8038c7:	ff d0                	call   *%rax
+  8038c9:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8038cc:	48 be 04 57 80 00 00 	movabs $0x805704,%rsi
+  8038d3:	00 00 00 
+  8038d6:	48 89 df             	mov    %rbx,%rdi
+  8038d9:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  8038e0:	00 00 00 
+  8038e3:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8038e5:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8038ea:	41 2b 04 24          	sub    (%r12),%eax
+  8038ee:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8038f4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8038fb:	00 00 00 
+    stat->st_dev = &devpipe;
+  8038fe:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803905:	00 00 00 
+  803908:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80390f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803914:	5b                   	pop    %rbx
+  803915:	41 5c                	pop    %r12
+  803917:	5d                   	pop    %rbp
+  803918:	c3                   	ret
+
+0000000000803919 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803919:	55                   	push   %rbp
+  80391a:	48 89 e5             	mov    %rsp,%rbp
+  80391d:	41 54                	push   %r12
+  80391f:	53                   	push   %rbx
+  803920:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803923:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803928:	48 89 fe             	mov    %rdi,%rsi
+  80392b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803930:	49 bc 9c 16 80 00 00 	movabs $0x80169c,%r12
+  803937:	00 00 00 
+  80393a:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80393d:	48 89 df             	mov    %rbx,%rdi
+  803940:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  803947:	00 00 00 
+  80394a:	ff d0                	call   *%rax
+  80394c:	48 89 c6             	mov    %rax,%rsi
+  80394f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803954:	bf 00 00 00 00       	mov    $0x0,%edi
+  803959:	41 ff d4             	call   *%r12
+}
+  80395c:	5b                   	pop    %rbx
+  80395d:	41 5c                	pop    %r12
+  80395f:	5d                   	pop    %rbp
+  803960:	c3                   	ret
+
+0000000000803961 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803961:	55                   	push   %rbp
+  803962:	48 89 e5             	mov    %rsp,%rbp
+  803965:	41 57                	push   %r15
+  803967:	41 56                	push   %r14
+  803969:	41 55                	push   %r13
+  80396b:	41 54                	push   %r12
+  80396d:	53                   	push   %rbx
+  80396e:	48 83 ec 18          	sub    $0x18,%rsp
+  803972:	49 89 fc             	mov    %rdi,%r12
+  803975:	49 89 f5             	mov    %rsi,%r13
+  803978:	49 89 d7             	mov    %rdx,%r15
+  80397b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80397f:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  803986:	00 00 00 
+  803989:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80398b:	4d 85 ff             	test   %r15,%r15
+  80398e:	0f 84 af 00 00 00    	je     803a43 <devpipe_write+0xe2>
+  803994:	48 89 c3             	mov    %rax,%rbx
+  803997:	4c 89 f8             	mov    %r15,%rax
+  80399a:	4d 89 ef             	mov    %r13,%r15
+  80399d:	4c 01 e8             	add    %r13,%rax
+  8039a0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039a4:	49 bd 91 14 80 00 00 	movabs $0x801491,%r13
+  8039ab:	00 00 00 
+            sys_yield();
+  8039ae:	49 be 2e 14 80 00 00 	movabs $0x80142e,%r14
+  8039b5:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8039b8:	8b 73 04             	mov    0x4(%rbx),%esi
+  8039bb:	48 63 ce             	movslq %esi,%rcx
+  8039be:	48 63 03             	movslq (%rbx),%rax
+  8039c1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8039c7:	48 39 c1             	cmp    %rax,%rcx
+  8039ca:	72 2e                	jb     8039fa <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039cc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039d1:	48 89 da             	mov    %rbx,%rdx
+  8039d4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039d9:	4c 89 e7             	mov    %r12,%rdi
+  8039dc:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8039df:	85 c0                	test   %eax,%eax
+  8039e1:	74 66                	je     803a49 <devpipe_write+0xe8>
+            sys_yield();
+  8039e3:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8039e6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8039e9:	48 63 ce             	movslq %esi,%rcx
+  8039ec:	48 63 03             	movslq (%rbx),%rax
+  8039ef:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8039f5:	48 39 c1             	cmp    %rax,%rcx
+  8039f8:	73 d2                	jae    8039cc <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8039fa:	41 0f b6 3f          	movzbl (%r15),%edi
+  8039fe:	48 89 ca             	mov    %rcx,%rdx
+  803a01:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a05:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803a0c:	08 10 20 
+  803a0f:	48 f7 e2             	mul    %rdx
+  803a12:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a16:	48 89 d0             	mov    %rdx,%rax
+  803a19:	48 c1 e0 09          	shl    $0x9,%rax
+  803a1d:	48 29 d0             	sub    %rdx,%rax
+  803a20:	48 c1 e0 03          	shl    $0x3,%rax
+  803a24:	48 29 c1             	sub    %rax,%rcx
+  803a27:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803a2c:	83 c6 01             	add    $0x1,%esi
+  803a2f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a32:	49 83 c7 01          	add    $0x1,%r15
+  803a36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a3a:	49 39 c7             	cmp    %rax,%r15
+  803a3d:	0f 85 75 ff ff ff    	jne    8039b8 <devpipe_write+0x57>
+    return n;
+  803a43:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a47:	eb 05                	jmp    803a4e <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a4e:	48 83 c4 18          	add    $0x18,%rsp
+  803a52:	5b                   	pop    %rbx
+  803a53:	41 5c                	pop    %r12
+  803a55:	41 5d                	pop    %r13
+  803a57:	41 5e                	pop    %r14
+  803a59:	41 5f                	pop    %r15
+  803a5b:	5d                   	pop    %rbp
+  803a5c:	c3                   	ret
+
+0000000000803a5d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a5d:	55                   	push   %rbp
+  803a5e:	48 89 e5             	mov    %rsp,%rbp
+  803a61:	41 57                	push   %r15
+  803a63:	41 56                	push   %r14
+  803a65:	41 55                	push   %r13
+  803a67:	41 54                	push   %r12
+  803a69:	53                   	push   %rbx
+  803a6a:	48 83 ec 18          	sub    $0x18,%rsp
+  803a6e:	49 89 fc             	mov    %rdi,%r12
+  803a71:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803a75:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a79:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  803a80:	00 00 00 
+  803a83:	ff d0                	call   *%rax
+  803a85:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803a88:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a8e:	49 bd 91 14 80 00 00 	movabs $0x801491,%r13
+  803a95:	00 00 00 
+            sys_yield();
+  803a98:	49 be 2e 14 80 00 00 	movabs $0x80142e,%r14
+  803a9f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803aa2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803aa7:	74 7d                	je     803b26 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803aa9:	8b 03                	mov    (%rbx),%eax
+  803aab:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803aae:	75 26                	jne    803ad6 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803ab0:	4d 85 ff             	test   %r15,%r15
+  803ab3:	75 77                	jne    803b2c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ab5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803aba:	48 89 da             	mov    %rbx,%rdx
+  803abd:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ac2:	4c 89 e7             	mov    %r12,%rdi
+  803ac5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803ac8:	85 c0                	test   %eax,%eax
+  803aca:	74 72                	je     803b3e <devpipe_read+0xe1>
+            sys_yield();
+  803acc:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803acf:	8b 03                	mov    (%rbx),%eax
+  803ad1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803ad4:	74 df                	je     803ab5 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803ad6:	48 63 c8             	movslq %eax,%rcx
+  803ad9:	48 89 ca             	mov    %rcx,%rdx
+  803adc:	48 c1 ea 03          	shr    $0x3,%rdx
+  803ae0:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803ae7:	08 10 20 
+  803aea:	48 89 d0             	mov    %rdx,%rax
+  803aed:	48 f7 e6             	mul    %rsi
+  803af0:	48 c1 ea 06          	shr    $0x6,%rdx
+  803af4:	48 89 d0             	mov    %rdx,%rax
+  803af7:	48 c1 e0 09          	shl    $0x9,%rax
+  803afb:	48 29 d0             	sub    %rdx,%rax
+  803afe:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803b05:	00 
+  803b06:	48 89 c8             	mov    %rcx,%rax
+  803b09:	48 29 d0             	sub    %rdx,%rax
+  803b0c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803b11:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b15:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803b19:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b1c:	49 83 c7 01          	add    $0x1,%r15
+  803b20:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803b24:	75 83                	jne    803aa9 <devpipe_read+0x4c>
+    return n;
+  803b26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b2a:	eb 03                	jmp    803b2f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803b2c:	4c 89 f8             	mov    %r15,%rax
+}
+  803b2f:	48 83 c4 18          	add    $0x18,%rsp
+  803b33:	5b                   	pop    %rbx
+  803b34:	41 5c                	pop    %r12
+  803b36:	41 5d                	pop    %r13
+  803b38:	41 5e                	pop    %r14
+  803b3a:	41 5f                	pop    %r15
+  803b3c:	5d                   	pop    %rbp
+  803b3d:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b43:	eb ea                	jmp    803b2f <devpipe_read+0xd2>
+
+0000000000803b45 <pipe>:
+pipe(int pfd[2]) {
+  803b45:	55                   	push   %rbp
+  803b46:	48 89 e5             	mov    %rsp,%rbp
+  803b49:	41 55                	push   %r13
+  803b4b:	41 54                	push   %r12
+  803b4d:	53                   	push   %rbx
+  803b4e:	48 83 ec 18          	sub    $0x18,%rsp
+  803b52:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b55:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803b59:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  803b60:	00 00 00 
+  803b63:	ff d0                	call   *%rax
+  803b65:	89 c3                	mov    %eax,%ebx
+  803b67:	85 c0                	test   %eax,%eax
+  803b69:	0f 88 a0 01 00 00    	js     803d0f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b6f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b74:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b79:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b82:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  803b89:	00 00 00 
+  803b8c:	ff d0                	call   *%rax
+  803b8e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b90:	85 c0                	test   %eax,%eax
+  803b92:	0f 88 77 01 00 00    	js     803d0f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b98:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803b9c:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  803ba3:	00 00 00 
+  803ba6:	ff d0                	call   *%rax
+  803ba8:	89 c3                	mov    %eax,%ebx
+  803baa:	85 c0                	test   %eax,%eax
+  803bac:	0f 88 43 01 00 00    	js     803cf5 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803bb2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bb7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bbc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803bc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bc5:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  803bcc:	00 00 00 
+  803bcf:	ff d0                	call   *%rax
+  803bd1:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bd3:	85 c0                	test   %eax,%eax
+  803bd5:	0f 88 1a 01 00 00    	js     803cf5 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803bdb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803bdf:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  803be6:	00 00 00 
+  803be9:	ff d0                	call   *%rax
+  803beb:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803bee:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bf3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bf8:	48 89 c6             	mov    %rax,%rsi
+  803bfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c00:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  803c07:	00 00 00 
+  803c0a:	ff d0                	call   *%rax
+  803c0c:	89 c3                	mov    %eax,%ebx
+  803c0e:	85 c0                	test   %eax,%eax
+  803c10:	0f 88 c5 00 00 00    	js     803cdb <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c16:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c1a:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  803c21:	00 00 00 
+  803c24:	ff d0                	call   *%rax
+  803c26:	48 89 c1             	mov    %rax,%rcx
+  803c29:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c2f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803c35:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c3a:	4c 89 ee             	mov    %r13,%rsi
+  803c3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c42:	48 b8 24 15 80 00 00 	movabs $0x801524,%rax
+  803c49:	00 00 00 
+  803c4c:	ff d0                	call   *%rax
+  803c4e:	89 c3                	mov    %eax,%ebx
+  803c50:	85 c0                	test   %eax,%eax
+  803c52:	78 6e                	js     803cc2 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c54:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c59:	4c 89 ef             	mov    %r13,%rdi
+  803c5c:	48 b8 5f 14 80 00 00 	movabs $0x80145f,%rax
+  803c63:	00 00 00 
+  803c66:	ff d0                	call   *%rax
+  803c68:	83 f8 02             	cmp    $0x2,%eax
+  803c6b:	0f 85 ab 00 00 00    	jne    803d1c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c71:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803c78:	00 00 
+  803c7a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c7e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c80:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c84:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c8b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803c8f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c95:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c9c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ca0:	48 bb d3 1e 80 00 00 	movabs $0x801ed3,%rbx
+  803ca7:	00 00 00 
+  803caa:	ff d3                	call   *%rbx
+  803cac:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803cb0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803cb4:	ff d3                	call   *%rbx
+  803cb6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803cbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803cc0:	eb 4d                	jmp    803d0f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803cc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc7:	4c 89 ee             	mov    %r13,%rsi
+  803cca:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ccf:	48 b8 9c 16 80 00 00 	movabs $0x80169c,%rax
+  803cd6:	00 00 00 
+  803cd9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803cdb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ce0:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ce9:	48 b8 9c 16 80 00 00 	movabs $0x80169c,%rax
+  803cf0:	00 00 00 
+  803cf3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803cf5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cfa:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803cfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d03:	48 b8 9c 16 80 00 00 	movabs $0x80169c,%rax
+  803d0a:	00 00 00 
+  803d0d:	ff d0                	call   *%rax
+}
+  803d0f:	89 d8                	mov    %ebx,%eax
+  803d11:	48 83 c4 18          	add    $0x18,%rsp
+  803d15:	5b                   	pop    %rbx
+  803d16:	41 5c                	pop    %r12
+  803d18:	41 5d                	pop    %r13
+  803d1a:	5d                   	pop    %rbp
+  803d1b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d1c:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  803d23:	00 00 00 
+  803d26:	48 ba 0b 57 80 00 00 	movabs $0x80570b,%rdx
+  803d2d:	00 00 00 
+  803d30:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803d35:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  803d3c:	00 00 00 
+  803d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d44:	49 b8 95 02 80 00 00 	movabs $0x800295,%r8
+  803d4b:	00 00 00 
+  803d4e:	41 ff d0             	call   *%r8
+
+0000000000803d51 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d51:	55                   	push   %rbp
+  803d52:	48 89 e5             	mov    %rsp,%rbp
+  803d55:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d59:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d5d:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  803d64:	00 00 00 
+  803d67:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d69:	85 c0                	test   %eax,%eax
+  803d6b:	78 35                	js     803da2 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d6d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d71:	48 b8 e5 1e 80 00 00 	movabs $0x801ee5,%rax
+  803d78:	00 00 00 
+  803d7b:	ff d0                	call   *%rax
+  803d7d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803d80:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803d85:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d8a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d8e:	48 b8 91 14 80 00 00 	movabs $0x801491,%rax
+  803d95:	00 00 00 
+  803d98:	ff d0                	call   *%rax
+  803d9a:	85 c0                	test   %eax,%eax
+  803d9c:	0f 94 c0             	sete   %al
+  803d9f:	0f b6 c0             	movzbl %al,%eax
+}
+  803da2:	c9                   	leave
+  803da3:	c3                   	ret
+
+0000000000803da4 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803da4:	48 89 f8             	mov    %rdi,%rax
+  803da7:	48 c1 e8 27          	shr    $0x27,%rax
+  803dab:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803db2:	7f 00 00 
+  803db5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803db9:	f6 c2 01             	test   $0x1,%dl
+  803dbc:	74 6d                	je     803e2b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803dbe:	48 89 f8             	mov    %rdi,%rax
+  803dc1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803dc5:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803dcc:	7f 00 00 
+  803dcf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dd3:	f6 c2 01             	test   $0x1,%dl
+  803dd6:	74 62                	je     803e3a <get_uvpt_entry+0x96>
+  803dd8:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ddf:	7f 00 00 
+  803de2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803de6:	f6 c2 80             	test   $0x80,%dl
+  803de9:	75 4f                	jne    803e3a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803deb:	48 89 f8             	mov    %rdi,%rax
+  803dee:	48 c1 e8 15          	shr    $0x15,%rax
+  803df2:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803df9:	7f 00 00 
+  803dfc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e00:	f6 c2 01             	test   $0x1,%dl
+  803e03:	74 44                	je     803e49 <get_uvpt_entry+0xa5>
+  803e05:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e0c:	7f 00 00 
+  803e0f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e13:	f6 c2 80             	test   $0x80,%dl
+  803e16:	75 31                	jne    803e49 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e18:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e1c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e23:	7f 00 00 
+  803e26:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e2a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e2b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e32:	7f 00 00 
+  803e35:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e39:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e3a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e41:	7f 00 00 
+  803e44:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e48:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e49:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e50:	7f 00 00 
+  803e53:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e57:	c3                   	ret
+
+0000000000803e58 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803e58:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e5b:	48 89 f9             	mov    %rdi,%rcx
+  803e5e:	48 c1 e9 27          	shr    $0x27,%rcx
+  803e62:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803e69:	7f 00 00 
+  803e6c:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803e70:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803e77:	f6 c1 01             	test   $0x1,%cl
+  803e7a:	0f 84 b2 00 00 00    	je     803f32 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e80:	48 89 f9             	mov    %rdi,%rcx
+  803e83:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803e87:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e8e:	7f 00 00 
+  803e91:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e95:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e9c:	40 f6 c6 01          	test   $0x1,%sil
+  803ea0:	0f 84 8c 00 00 00    	je     803f32 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803ea6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ead:	7f 00 00 
+  803eb0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803eb4:	a8 80                	test   $0x80,%al
+  803eb6:	75 7b                	jne    803f33 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803eb8:	48 89 f9             	mov    %rdi,%rcx
+  803ebb:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ebf:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ec6:	7f 00 00 
+  803ec9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ecd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ed4:	40 f6 c6 01          	test   $0x1,%sil
+  803ed8:	74 58                	je     803f32 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803eda:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ee1:	7f 00 00 
+  803ee4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ee8:	a8 80                	test   $0x80,%al
+  803eea:	75 6c                	jne    803f58 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803eec:	48 89 f9             	mov    %rdi,%rcx
+  803eef:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803ef3:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803efa:	7f 00 00 
+  803efd:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f01:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f08:	40 f6 c6 01          	test   $0x1,%sil
+  803f0c:	74 24                	je     803f32 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f0e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f15:	7f 00 00 
+  803f18:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f1c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f23:	ff ff 7f 
+  803f26:	48 21 c8             	and    %rcx,%rax
+  803f29:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f2f:	48 09 d0             	or     %rdx,%rax
+}
+  803f32:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f33:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f3a:	7f 00 00 
+  803f3d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f41:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f48:	ff ff 7f 
+  803f4b:	48 21 c8             	and    %rcx,%rax
+  803f4e:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803f54:	48 01 d0             	add    %rdx,%rax
+  803f57:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803f58:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f5f:	7f 00 00 
+  803f62:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f66:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f6d:	ff ff 7f 
+  803f70:	48 21 c8             	and    %rcx,%rax
+  803f73:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803f79:	48 01 d0             	add    %rdx,%rax
+  803f7c:	c3                   	ret
+
+0000000000803f7d <get_prot>:
+
+int
+get_prot(void *va) {
+  803f7d:	55                   	push   %rbp
+  803f7e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f81:	48 b8 a4 3d 80 00 00 	movabs $0x803da4,%rax
+  803f88:	00 00 00 
+  803f8b:	ff d0                	call   *%rax
+  803f8d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f90:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f95:	89 c1                	mov    %eax,%ecx
+  803f97:	83 c9 04             	or     $0x4,%ecx
+  803f9a:	f6 c2 01             	test   $0x1,%dl
+  803f9d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803fa0:	89 c1                	mov    %eax,%ecx
+  803fa2:	83 c9 02             	or     $0x2,%ecx
+  803fa5:	f6 c2 02             	test   $0x2,%dl
+  803fa8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803fab:	89 c1                	mov    %eax,%ecx
+  803fad:	83 c9 01             	or     $0x1,%ecx
+  803fb0:	48 85 d2             	test   %rdx,%rdx
+  803fb3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803fb6:	89 c1                	mov    %eax,%ecx
+  803fb8:	83 c9 40             	or     $0x40,%ecx
+  803fbb:	f6 c6 04             	test   $0x4,%dh
+  803fbe:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803fc1:	5d                   	pop    %rbp
+  803fc2:	c3                   	ret
+
+0000000000803fc3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803fc3:	55                   	push   %rbp
+  803fc4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fc7:	48 b8 a4 3d 80 00 00 	movabs $0x803da4,%rax
+  803fce:	00 00 00 
+  803fd1:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803fd3:	48 c1 e8 06          	shr    $0x6,%rax
+  803fd7:	83 e0 01             	and    $0x1,%eax
+}
+  803fda:	5d                   	pop    %rbp
+  803fdb:	c3                   	ret
+
+0000000000803fdc <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803fdc:	55                   	push   %rbp
+  803fdd:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803fe0:	48 b8 a4 3d 80 00 00 	movabs $0x803da4,%rax
+  803fe7:	00 00 00 
+  803fea:	ff d0                	call   *%rax
+  803fec:	83 e0 01             	and    $0x1,%eax
+}
+  803fef:	5d                   	pop    %rbp
+  803ff0:	c3                   	ret
+
+0000000000803ff1 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803ff1:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803ff8:	7f 00 00 
+  803ffb:	a8 01                	test   $0x1,%al
+  803ffd:	75 06                	jne    804005 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803fff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804004:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804005:	55                   	push   %rbp
+  804006:	48 89 e5             	mov    %rsp,%rbp
+  804009:	41 57                	push   %r15
+  80400b:	41 56                	push   %r14
+  80400d:	41 55                	push   %r13
+  80400f:	41 54                	push   %r12
+  804011:	53                   	push   %rbx
+  804012:	48 83 ec 18          	sub    $0x18,%rsp
+  804016:	49 89 fe             	mov    %rdi,%r14
+  804019:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80401c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804023:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804024:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  80402b:	7f 00 00 
+  80402e:	e9 81 00 00 00       	jmp    8040b4 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804033:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80403a:	49 39 dd             	cmp    %rbx,%r13
+  80403d:	74 2b                	je     80406a <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80403f:	48 89 d8             	mov    %rbx,%rax
+  804042:	48 c1 e8 0c          	shr    $0xc,%rax
+  804046:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  80404a:	f6 c2 01             	test   $0x1,%dl
+  80404d:	74 e4                	je     804033 <foreach_shared_region+0x42>
+  80404f:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804053:	f6 c4 04             	test   $0x4,%ah
+  804056:	74 db                	je     804033 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804058:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80405f:	4c 89 fa             	mov    %r15,%rdx
+  804062:	48 89 df             	mov    %rbx,%rdi
+  804065:	41 ff d6             	call   *%r14
+  804068:	eb c9                	jmp    804033 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80406a:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804071:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804075:	74 22                	je     804099 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804077:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  80407e:	48 89 d8             	mov    %rbx,%rax
+  804081:	48 c1 e8 15          	shr    $0x15,%rax
+  804085:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  80408c:	7f 00 00 
+  80408f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804093:	a8 01                	test   $0x1,%al
+  804095:	74 d3                	je     80406a <foreach_shared_region+0x79>
+  804097:	eb a6                	jmp    80403f <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804099:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  8040a0:	40 
+  8040a1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8040a5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040ac:	00 00 00 
+  8040af:	48 39 c1             	cmp    %rax,%rcx
+  8040b2:	74 31                	je     8040e5 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  8040b4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040b8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8040bc:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8040c3:	7f 00 00 
+  8040c6:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8040ca:	a8 01                	test   $0x1,%al
+  8040cc:	74 cb                	je     804099 <foreach_shared_region+0xa8>
+  8040ce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040d2:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8040d9:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8040df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8040e3:	eb 92                	jmp    804077 <foreach_shared_region+0x86>
+}
+  8040e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ea:	48 83 c4 18          	add    $0x18,%rsp
+  8040ee:	5b                   	pop    %rbx
+  8040ef:	41 5c                	pop    %r12
+  8040f1:	41 5d                	pop    %r13
+  8040f3:	41 5e                	pop    %r14
+  8040f5:	41 5f                	pop    %r15
+  8040f7:	5d                   	pop    %rbp
+  8040f8:	c3                   	ret
+
+00000000008040f9 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8040f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040fe:	c3                   	ret
+
+00000000008040ff <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8040ff:	55                   	push   %rbp
+  804100:	48 89 e5             	mov    %rsp,%rbp
+  804103:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804106:	48 be 54 57 80 00 00 	movabs $0x805754,%rsi
+  80410d:	00 00 00 
+  804110:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  804117:	00 00 00 
+  80411a:	ff d0                	call   *%rax
+    return 0;
+}
+  80411c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804121:	5d                   	pop    %rbp
+  804122:	c3                   	ret
+
+0000000000804123 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804123:	55                   	push   %rbp
+  804124:	48 89 e5             	mov    %rsp,%rbp
+  804127:	41 57                	push   %r15
+  804129:	41 56                	push   %r14
+  80412b:	41 55                	push   %r13
+  80412d:	41 54                	push   %r12
+  80412f:	53                   	push   %rbx
+  804130:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804137:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80413e:	48 85 d2             	test   %rdx,%rdx
+  804141:	74 7a                	je     8041bd <devcons_write+0x9a>
+  804143:	49 89 d6             	mov    %rdx,%r14
+  804146:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80414c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804151:	49 bf eb 10 80 00 00 	movabs $0x8010eb,%r15
+  804158:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80415b:	4c 89 f3             	mov    %r14,%rbx
+  80415e:	48 29 f3             	sub    %rsi,%rbx
+  804161:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804166:	48 39 c3             	cmp    %rax,%rbx
+  804169:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80416d:	4c 63 eb             	movslq %ebx,%r13
+  804170:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804177:	48 01 c6             	add    %rax,%rsi
+  80417a:	4c 89 ea             	mov    %r13,%rdx
+  80417d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804184:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804187:	4c 89 ee             	mov    %r13,%rsi
+  80418a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804191:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  804198:	00 00 00 
+  80419b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80419d:	41 01 dc             	add    %ebx,%r12d
+  8041a0:	49 63 f4             	movslq %r12d,%rsi
+  8041a3:	4c 39 f6             	cmp    %r14,%rsi
+  8041a6:	72 b3                	jb     80415b <devcons_write+0x38>
+    return res;
+  8041a8:	49 63 c4             	movslq %r12d,%rax
+}
+  8041ab:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8041b2:	5b                   	pop    %rbx
+  8041b3:	41 5c                	pop    %r12
+  8041b5:	41 5d                	pop    %r13
+  8041b7:	41 5e                	pop    %r14
+  8041b9:	41 5f                	pop    %r15
+  8041bb:	5d                   	pop    %rbp
+  8041bc:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8041bd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041c3:	eb e3                	jmp    8041a8 <devcons_write+0x85>
+
+00000000008041c5 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041c5:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8041c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041cd:	48 85 c0             	test   %rax,%rax
+  8041d0:	74 55                	je     804227 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041d2:	55                   	push   %rbp
+  8041d3:	48 89 e5             	mov    %rsp,%rbp
+  8041d6:	41 55                	push   %r13
+  8041d8:	41 54                	push   %r12
+  8041da:	53                   	push   %rbx
+  8041db:	48 83 ec 08          	sub    $0x8,%rsp
+  8041df:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8041e2:	48 bb 61 13 80 00 00 	movabs $0x801361,%rbx
+  8041e9:	00 00 00 
+  8041ec:	49 bc 2e 14 80 00 00 	movabs $0x80142e,%r12
+  8041f3:	00 00 00 
+  8041f6:	eb 03                	jmp    8041fb <devcons_read+0x36>
+  8041f8:	41 ff d4             	call   *%r12
+  8041fb:	ff d3                	call   *%rbx
+  8041fd:	85 c0                	test   %eax,%eax
+  8041ff:	74 f7                	je     8041f8 <devcons_read+0x33>
+    if (c < 0) return c;
+  804201:	48 63 d0             	movslq %eax,%rdx
+  804204:	78 13                	js     804219 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804206:	ba 00 00 00 00       	mov    $0x0,%edx
+  80420b:	83 f8 04             	cmp    $0x4,%eax
+  80420e:	74 09                	je     804219 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804210:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804214:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804219:	48 89 d0             	mov    %rdx,%rax
+  80421c:	48 83 c4 08          	add    $0x8,%rsp
+  804220:	5b                   	pop    %rbx
+  804221:	41 5c                	pop    %r12
+  804223:	41 5d                	pop    %r13
+  804225:	5d                   	pop    %rbp
+  804226:	c3                   	ret
+  804227:	48 89 d0             	mov    %rdx,%rax
+  80422a:	c3                   	ret
+
+000000000080422b <cputchar>:
+cputchar(int ch) {
+  80422b:	55                   	push   %rbp
+  80422c:	48 89 e5             	mov    %rsp,%rbp
+  80422f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804233:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804237:	be 01 00 00 00       	mov    $0x1,%esi
+  80423c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804240:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  804247:	00 00 00 
+  80424a:	ff d0                	call   *%rax
+}
+  80424c:	c9                   	leave
+  80424d:	c3                   	ret
+
+000000000080424e <getchar>:
+getchar(void) {
+  80424e:	55                   	push   %rbp
+  80424f:	48 89 e5             	mov    %rsp,%rbp
+  804252:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804256:	ba 01 00 00 00       	mov    $0x1,%edx
+  80425b:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80425f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804264:	48 b8 44 22 80 00 00 	movabs $0x802244,%rax
+  80426b:	00 00 00 
+  80426e:	ff d0                	call   *%rax
+  804270:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804272:	85 c0                	test   %eax,%eax
+  804274:	78 06                	js     80427c <getchar+0x2e>
+  804276:	74 08                	je     804280 <getchar+0x32>
+  804278:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80427c:	89 d0                	mov    %edx,%eax
+  80427e:	c9                   	leave
+  80427f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804280:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804285:	eb f5                	jmp    80427c <getchar+0x2e>
+
+0000000000804287 <iscons>:
+iscons(int fdnum) {
+  804287:	55                   	push   %rbp
+  804288:	48 89 e5             	mov    %rsp,%rbp
+  80428b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80428f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804293:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  80429a:	00 00 00 
+  80429d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80429f:	85 c0                	test   %eax,%eax
+  8042a1:	78 18                	js     8042bb <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8042a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042a7:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8042ae:	00 00 00 
+  8042b1:	8b 00                	mov    (%rax),%eax
+  8042b3:	39 02                	cmp    %eax,(%rdx)
+  8042b5:	0f 94 c0             	sete   %al
+  8042b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8042bb:	c9                   	leave
+  8042bc:	c3                   	ret
+
+00000000008042bd <opencons>:
+opencons(void) {
+  8042bd:	55                   	push   %rbp
+  8042be:	48 89 e5             	mov    %rsp,%rbp
+  8042c1:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8042c5:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8042c9:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  8042d0:	00 00 00 
+  8042d3:	ff d0                	call   *%rax
+  8042d5:	85 c0                	test   %eax,%eax
+  8042d7:	78 49                	js     804322 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8042d9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042e3:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8042e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ec:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  8042f3:	00 00 00 
+  8042f6:	ff d0                	call   *%rax
+  8042f8:	85 c0                	test   %eax,%eax
+  8042fa:	78 26                	js     804322 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8042fc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804300:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804307:	00 00 
+  804309:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80430b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80430f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804316:	48 b8 d3 1e 80 00 00 	movabs $0x801ed3,%rax
+  80431d:	00 00 00 
+  804320:	ff d0                	call   *%rax
+}
+  804322:	c9                   	leave
+  804323:	c3                   	ret
+
+0000000000804324 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804324:	55                   	push   %rbp
+  804325:	48 89 e5             	mov    %rsp,%rbp
+  804328:	41 55                	push   %r13
+  80432a:	41 54                	push   %r12
+  80432c:	53                   	push   %rbx
+  80432d:	48 83 ec 08          	sub    $0x8,%rsp
+  804331:	49 89 fc             	mov    %rdi,%r12
+  804334:	48 89 f7             	mov    %rsi,%rdi
+  804337:	48 89 d3             	mov    %rdx,%rbx
+  80433a:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80433d:	48 85 f6             	test   %rsi,%rsi
+  804340:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804347:	00 00 00 
+  80434a:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80434e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804353:	48 85 d2             	test   %rdx,%rdx
+  804356:	74 03                	je     80435b <ipc_recv+0x37>
+  804358:	48 8b 32             	mov    (%rdx),%rsi
+  80435b:	48 b8 6a 18 80 00 00 	movabs $0x80186a,%rax
+  804362:	00 00 00 
+  804365:	ff d0                	call   *%rax
+    if (errno) {
+  804367:	85 c0                	test   %eax,%eax
+  804369:	74 1c                	je     804387 <ipc_recv+0x63>
+        if (from_env_store)
+  80436b:	4d 85 e4             	test   %r12,%r12
+  80436e:	74 08                	je     804378 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804370:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804377:	00 
+
+        if (perm_store)
+  804378:	4d 85 ed             	test   %r13,%r13
+  80437b:	74 74                	je     8043f1 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80437d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804384:	00 
+  804385:	eb 6a                	jmp    8043f1 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804387:	4d 85 e4             	test   %r12,%r12
+  80438a:	74 14                	je     8043a0 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80438c:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  804393:	00 00 00 
+  804396:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80439c:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  8043a0:	48 85 db             	test   %rbx,%rbx
+  8043a3:	74 23                	je     8043c8 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8043a5:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8043ac:	00 00 00 
+  8043af:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8043b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043ba:	85 c9                	test   %ecx,%ecx
+  8043bc:	74 07                	je     8043c5 <ipc_recv+0xa1>
+  8043be:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8043c5:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8043c8:	4d 85 ed             	test   %r13,%r13
+  8043cb:	74 14                	je     8043e1 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8043cd:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8043d4:	00 00 00 
+  8043d7:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8043dd:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8043e1:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8043e8:	00 00 00 
+  8043eb:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8043f1:	48 83 c4 08          	add    $0x8,%rsp
+  8043f5:	5b                   	pop    %rbx
+  8043f6:	41 5c                	pop    %r12
+  8043f8:	41 5d                	pop    %r13
+  8043fa:	5d                   	pop    %rbp
+  8043fb:	c3                   	ret
+
+00000000008043fc <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8043fc:	55                   	push   %rbp
+  8043fd:	48 89 e5             	mov    %rsp,%rbp
+  804400:	41 55                	push   %r13
+  804402:	41 54                	push   %r12
+  804404:	53                   	push   %rbx
+  804405:	48 83 ec 08          	sub    $0x8,%rsp
+  804409:	49 89 fc             	mov    %rdi,%r12
+  80440c:	48 89 f7             	mov    %rsi,%rdi
+  80440f:	48 89 d3             	mov    %rdx,%rbx
+  804412:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804415:	48 85 f6             	test   %rsi,%rsi
+  804418:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80441f:	00 00 00 
+  804422:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804426:	be 00 10 00 00       	mov    $0x1000,%esi
+  80442b:	48 85 d2             	test   %rdx,%rdx
+  80442e:	74 03                	je     804433 <ipc_try_recv+0x37>
+  804430:	48 8b 32             	mov    (%rdx),%rsi
+  804433:	48 b8 d3 18 80 00 00 	movabs $0x8018d3,%rax
+  80443a:	00 00 00 
+  80443d:	ff d0                	call   *%rax
+    if (errno) {
+  80443f:	85 c0                	test   %eax,%eax
+  804441:	75 75                	jne    8044b8 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804443:	4d 85 e4             	test   %r12,%r12
+  804446:	74 14                	je     80445c <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804448:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  80444f:	00 00 00 
+  804452:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804458:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80445c:	48 85 db             	test   %rbx,%rbx
+  80445f:	74 23                	je     804484 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804461:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  804468:	00 00 00 
+  80446b:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804471:	ba 00 00 00 00       	mov    $0x0,%edx
+  804476:	85 c9                	test   %ecx,%ecx
+  804478:	74 07                	je     804481 <ipc_try_recv+0x85>
+  80447a:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804481:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804484:	4d 85 ed             	test   %r13,%r13
+  804487:	74 14                	je     80449d <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804489:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  804490:	00 00 00 
+  804493:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804499:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80449d:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8044a4:	00 00 00 
+  8044a7:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  8044ad:	48 83 c4 08          	add    $0x8,%rsp
+  8044b1:	5b                   	pop    %rbx
+  8044b2:	41 5c                	pop    %r12
+  8044b4:	41 5d                	pop    %r13
+  8044b6:	5d                   	pop    %rbp
+  8044b7:	c3                   	ret
+        if (from_env_store)
+  8044b8:	4d 85 e4             	test   %r12,%r12
+  8044bb:	74 08                	je     8044c5 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8044bd:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8044c4:	00 
+        if (perm_store)
+  8044c5:	4d 85 ed             	test   %r13,%r13
+  8044c8:	74 e3                	je     8044ad <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8044ca:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8044d1:	00 
+  8044d2:	eb d9                	jmp    8044ad <ipc_try_recv+0xb1>
+
+00000000008044d4 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8044d4:	55                   	push   %rbp
+  8044d5:	48 89 e5             	mov    %rsp,%rbp
+  8044d8:	41 57                	push   %r15
+  8044da:	41 56                	push   %r14
+  8044dc:	41 55                	push   %r13
+  8044de:	41 54                	push   %r12
+  8044e0:	53                   	push   %rbx
+  8044e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8044e5:	41 89 fd             	mov    %edi,%r13d
+  8044e8:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8044eb:	48 89 d3             	mov    %rdx,%rbx
+  8044ee:	49 89 cc             	mov    %rcx,%r12
+  8044f1:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8044f5:	48 85 d2             	test   %rdx,%rdx
+  8044f8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044ff:	00 00 00 
+  804502:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804506:	49 be 3e 18 80 00 00 	movabs $0x80183e,%r14
+  80450d:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804510:	49 bf 2e 14 80 00 00 	movabs $0x80142e,%r15
+  804517:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80451a:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80451d:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804521:	4c 89 e1             	mov    %r12,%rcx
+  804524:	48 89 da             	mov    %rbx,%rdx
+  804527:	44 89 ef             	mov    %r13d,%edi
+  80452a:	41 ff d6             	call   *%r14
+  80452d:	85 c0                	test   %eax,%eax
+  80452f:	74 37                	je     804568 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804531:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804534:	75 05                	jne    80453b <ipc_send+0x67>
+        sys_yield();
+  804536:	41 ff d7             	call   *%r15
+  804539:	eb df                	jmp    80451a <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80453b:	89 c1                	mov    %eax,%ecx
+  80453d:	48 ba 60 57 80 00 00 	movabs $0x805760,%rdx
+  804544:	00 00 00 
+  804547:	be 65 00 00 00       	mov    $0x65,%esi
+  80454c:	48 bf 7b 57 80 00 00 	movabs $0x80577b,%rdi
+  804553:	00 00 00 
+  804556:	b8 00 00 00 00       	mov    $0x0,%eax
+  80455b:	49 b8 95 02 80 00 00 	movabs $0x800295,%r8
+  804562:	00 00 00 
+  804565:	41 ff d0             	call   *%r8
+    }
+}
+  804568:	48 83 c4 18          	add    $0x18,%rsp
+  80456c:	5b                   	pop    %rbx
+  80456d:	41 5c                	pop    %r12
+  80456f:	41 5d                	pop    %r13
+  804571:	41 5e                	pop    %r14
+  804573:	41 5f                	pop    %r15
+  804575:	5d                   	pop    %rbp
+  804576:	c3                   	ret
+
+0000000000804577 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804577:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80457c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804583:	00 00 00 
+  804586:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80458d:	48 01 ca             	add    %rcx,%rdx
+  804590:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804596:	39 fa                	cmp    %edi,%edx
+  804598:	74 12                	je     8045ac <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80459a:	48 83 c0 01          	add    $0x1,%rax
+  80459e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8045a4:	75 e0                	jne    804586 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8045a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045ab:	c3                   	ret
+            return envs[i].env_id;
+  8045ac:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8045b3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8045ba:	00 00 00 
+  8045bd:	48 01 d0             	add    %rdx,%rax
+  8045c0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8045c6:	c3                   	ret
+
+00000000008045c7 <__text_end>:
+  8045c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ce:	00 00 00 
+  8045d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d8:	00 00 00 
+  8045db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e2:	00 00 00 
+  8045e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ec:	00 00 00 
+  8045ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f6:	00 00 00 
+  8045f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804600:	00 00 00 
+  804603:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460a:	00 00 00 
+  80460d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804614:	00 00 00 
+  804617:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461e:	00 00 00 
+  804621:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804628:	00 00 00 
+  80462b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804632:	00 00 00 
+  804635:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463c:	00 00 00 
+  80463f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804646:	00 00 00 
+  804649:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804650:	00 00 00 
+  804653:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465a:	00 00 00 
+  80465d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804664:	00 00 00 
+  804667:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466e:	00 00 00 
+  804671:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804678:	00 00 00 
+  80467b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804682:	00 00 00 
+  804685:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468c:	00 00 00 
+  80468f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804696:	00 00 00 
+  804699:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a0:	00 00 00 
+  8046a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046aa:	00 00 00 
+  8046ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b4:	00 00 00 
+  8046b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046be:	00 00 00 
+  8046c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c8:	00 00 00 
+  8046cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d2:	00 00 00 
+  8046d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dc:	00 00 00 
+  8046df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e6:	00 00 00 
+  8046e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f0:	00 00 00 
+  8046f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fa:	00 00 00 
+  8046fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804704:	00 00 00 
+  804707:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470e:	00 00 00 
+  804711:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804718:	00 00 00 
+  80471b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804722:	00 00 00 
+  804725:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472c:	00 00 00 
+  80472f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804736:	00 00 00 
+  804739:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804740:	00 00 00 
+  804743:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474a:	00 00 00 
+  80474d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804754:	00 00 00 
+  804757:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475e:	00 00 00 
+  804761:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804768:	00 00 00 
+  80476b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804772:	00 00 00 
+  804775:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477c:	00 00 00 
+  80477f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804786:	00 00 00 
+  804789:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804790:	00 00 00 
+  804793:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479a:	00 00 00 
+  80479d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a4:	00 00 00 
+  8047a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ae:	00 00 00 
+  8047b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b8:	00 00 00 
+  8047bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c2:	00 00 00 
+  8047c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cc:	00 00 00 
+  8047cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d6:	00 00 00 
+  8047d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e0:	00 00 00 
+  8047e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ea:	00 00 00 
+  8047ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f4:	00 00 00 
+  8047f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fe:	00 00 00 
+  804801:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804808:	00 00 00 
+  80480b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804812:	00 00 00 
+  804815:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481c:	00 00 00 
+  80481f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804826:	00 00 00 
+  804829:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804830:	00 00 00 
+  804833:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483a:	00 00 00 
+  80483d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804844:	00 00 00 
+  804847:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484e:	00 00 00 
+  804851:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804858:	00 00 00 
+  80485b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804862:	00 00 00 
+  804865:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486c:	00 00 00 
+  80486f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804876:	00 00 00 
+  804879:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804880:	00 00 00 
+  804883:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488a:	00 00 00 
+  80488d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804894:	00 00 00 
+  804897:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489e:	00 00 00 
+  8048a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a8:	00 00 00 
+  8048ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b2:	00 00 00 
+  8048b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bc:	00 00 00 
+  8048bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c6:	00 00 00 
+  8048c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d0:	00 00 00 
+  8048d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048da:	00 00 00 
+  8048dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e4:	00 00 00 
+  8048e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ee:	00 00 00 
+  8048f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f8:	00 00 00 
+  8048fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804902:	00 00 00 
+  804905:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490c:	00 00 00 
+  80490f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804916:	00 00 00 
+  804919:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804920:	00 00 00 
+  804923:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492a:	00 00 00 
+  80492d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804934:	00 00 00 
+  804937:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493e:	00 00 00 
+  804941:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804948:	00 00 00 
+  80494b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804952:	00 00 00 
+  804955:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495c:	00 00 00 
+  80495f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804966:	00 00 00 
+  804969:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804970:	00 00 00 
+  804973:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497a:	00 00 00 
+  80497d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804984:	00 00 00 
+  804987:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498e:	00 00 00 
+  804991:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804998:	00 00 00 
+  80499b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a2:	00 00 00 
+  8049a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ac:	00 00 00 
+  8049af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b6:	00 00 00 
+  8049b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c0:	00 00 00 
+  8049c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ca:	00 00 00 
+  8049cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d4:	00 00 00 
+  8049d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049de:	00 00 00 
+  8049e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e8:	00 00 00 
+  8049eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f2:	00 00 00 
+  8049f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fc:	00 00 00 
+  8049ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a06:	00 00 00 
+  804a09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a10:	00 00 00 
+  804a13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1a:	00 00 00 
+  804a1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a24:	00 00 00 
+  804a27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2e:	00 00 00 
+  804a31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a38:	00 00 00 
+  804a3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a42:	00 00 00 
+  804a45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4c:	00 00 00 
+  804a4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a56:	00 00 00 
+  804a59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a60:	00 00 00 
+  804a63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6a:	00 00 00 
+  804a6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a74:	00 00 00 
+  804a77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7e:	00 00 00 
+  804a81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a88:	00 00 00 
+  804a8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a92:	00 00 00 
+  804a95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9c:	00 00 00 
+  804a9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa6:	00 00 00 
+  804aa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab0:	00 00 00 
+  804ab3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aba:	00 00 00 
+  804abd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac4:	00 00 00 
+  804ac7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ace:	00 00 00 
+  804ad1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad8:	00 00 00 
+  804adb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae2:	00 00 00 
+  804ae5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aec:	00 00 00 
+  804aef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af6:	00 00 00 
+  804af9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b00:	00 00 00 
+  804b03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0a:	00 00 00 
+  804b0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b14:	00 00 00 
+  804b17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1e:	00 00 00 
+  804b21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b28:	00 00 00 
+  804b2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b32:	00 00 00 
+  804b35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3c:	00 00 00 
+  804b3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b46:	00 00 00 
+  804b49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b50:	00 00 00 
+  804b53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5a:	00 00 00 
+  804b5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b64:	00 00 00 
+  804b67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6e:	00 00 00 
+  804b71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b78:	00 00 00 
+  804b7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b82:	00 00 00 
+  804b85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8c:	00 00 00 
+  804b8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b96:	00 00 00 
+  804b99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba0:	00 00 00 
+  804ba3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baa:	00 00 00 
+  804bad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb4:	00 00 00 
+  804bb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbe:	00 00 00 
+  804bc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc8:	00 00 00 
+  804bcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd2:	00 00 00 
+  804bd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdc:	00 00 00 
+  804bdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be6:	00 00 00 
+  804be9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf0:	00 00 00 
+  804bf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfa:	00 00 00 
+  804bfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c04:	00 00 00 
+  804c07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0e:	00 00 00 
+  804c11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c18:	00 00 00 
+  804c1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c22:	00 00 00 
+  804c25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2c:	00 00 00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c40:	00 00 00 
+  804c43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4a:	00 00 00 
+  804c4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c54:	00 00 00 
+  804c57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5e:	00 00 00 
+  804c61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c68:	00 00 00 
+  804c6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c72:	00 00 00 
+  804c75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7c:	00 00 00 
+  804c7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c86:	00 00 00 
+  804c89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c90:	00 00 00 
+  804c93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9a:	00 00 00 
+  804c9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca4:	00 00 00 
+  804ca7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cae:	00 00 00 
+  804cb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb8:	00 00 00 
+  804cbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc2:	00 00 00 
+  804cc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccc:	00 00 00 
+  804ccf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd6:	00 00 00 
+  804cd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce0:	00 00 00 
+  804ce3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cea:	00 00 00 
+  804ced:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf4:	00 00 00 
+  804cf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfe:	00 00 00 
+  804d01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d08:	00 00 00 
+  804d0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d12:	00 00 00 
+  804d15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1c:	00 00 00 
+  804d1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d26:	00 00 00 
+  804d29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d30:	00 00 00 
+  804d33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3a:	00 00 00 
+  804d3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d44:	00 00 00 
+  804d47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4e:	00 00 00 
+  804d51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d58:	00 00 00 
+  804d5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d62:	00 00 00 
+  804d65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6c:	00 00 00 
+  804d6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d76:	00 00 00 
+  804d79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d80:	00 00 00 
+  804d83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8a:	00 00 00 
+  804d8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d94:	00 00 00 
+  804d97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9e:	00 00 00 
+  804da1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da8:	00 00 00 
+  804dab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db2:	00 00 00 
+  804db5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbc:	00 00 00 
+  804dbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc6:	00 00 00 
+  804dc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd0:	00 00 00 
+  804dd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dda:	00 00 00 
+  804ddd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de4:	00 00 00 
+  804de7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dee:	00 00 00 
+  804df1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df8:	00 00 00 
+  804dfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e02:	00 00 00 
+  804e05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0c:	00 00 00 
+  804e0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e16:	00 00 00 
+  804e19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e20:	00 00 00 
+  804e23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2a:	00 00 00 
+  804e2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e34:	00 00 00 
+  804e37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3e:	00 00 00 
+  804e41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e48:	00 00 00 
+  804e4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e52:	00 00 00 
+  804e55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5c:	00 00 00 
+  804e5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e66:	00 00 00 
+  804e69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e70:	00 00 00 
+  804e73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7a:	00 00 00 
+  804e7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e84:	00 00 00 
+  804e87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8e:	00 00 00 
+  804e91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e98:	00 00 00 
+  804e9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea2:	00 00 00 
+  804ea5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eac:	00 00 00 
+  804eaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb6:	00 00 00 
+  804eb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec0:	00 00 00 
+  804ec3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eca:	00 00 00 
+  804ecd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed4:	00 00 00 
+  804ed7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ede:	00 00 00 
+  804ee1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee8:	00 00 00 
+  804eeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef2:	00 00 00 
+  804ef5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efc:	00 00 00 
+  804eff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f06:	00 00 00 
+  804f09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f10:	00 00 00 
+  804f13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1a:	00 00 00 
+  804f1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f24:	00 00 00 
+  804f27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2e:	00 00 00 
+  804f31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f38:	00 00 00 
+  804f3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f42:	00 00 00 
+  804f45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4c:	00 00 00 
+  804f4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f56:	00 00 00 
+  804f59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f60:	00 00 00 
+  804f63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6a:	00 00 00 
+  804f6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f74:	00 00 00 
+  804f77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7e:	00 00 00 
+  804f81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f88:	00 00 00 
+  804f8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f92:	00 00 00 
+  804f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9c:	00 00 00 
+  804f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa6:	00 00 00 
+  804fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb0:	00 00 00 
+  804fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fba:	00 00 00 
+  804fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc4:	00 00 00 
+  804fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fce:	00 00 00 
+  804fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd8:	00 00 00 
+  804fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe2:	00 00 00 
+  804fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fec:	00 00 00 
+  804fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff6:	00 00 00 
+  804ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
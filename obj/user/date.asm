@@ -0,0 +1,8177 @@
+
+obj/user/date:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 5f 03 00 00       	call   800382 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/time.h>
+#include <inc/stdio.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 58          	sub    $0x58,%rsp
+    char time[20];
+    int now = sys_gettime();
+  80002e:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  800035:	00 00 00 
+  800038:	ff d0                	call   *%rax
+  80003a:	41 89 c0             	mov    %eax,%r8d
+
+inline static void
+mktime(int time, struct tm *tm) {
+    // TODO Support negative timestamps
+
+    int year = 1970 + (time / (DAY * 366 + 1));
+  80003d:	48 63 f0             	movslq %eax,%rsi
+  800040:	48 69 f6 c1 40 fa 10 	imul   $0x10fa40c1,%rsi,%rsi
+  800047:	48 c1 fe 35          	sar    $0x35,%rsi
+  80004b:	c1 f8 1f             	sar    $0x1f,%eax
+  80004e:	29 c6                	sub    %eax,%esi
+  800050:	8d be b2 07 00 00    	lea    0x7b2(%rsi),%edi
+    while (time >= DAY * (Y2DAYS(year + 1) - Y2DAYS(1970))) year++;
+  800056:	81 c6 b3 07 00 00    	add    $0x7b3,%esi
+  80005c:	69 f6 6d 01 00 00    	imul   $0x16d,%esi,%esi
+  800062:	89 f9                	mov    %edi,%ecx
+  800064:	83 c7 01             	add    $0x1,%edi
+  800067:	8d 41 03             	lea    0x3(%rcx),%eax
+  80006a:	85 c9                	test   %ecx,%ecx
+  80006c:	0f 49 c1             	cmovns %ecx,%eax
+  80006f:	c1 f8 02             	sar    $0x2,%eax
+  800072:	01 f0                	add    %esi,%eax
+  800074:	48 63 d1             	movslq %ecx,%rdx
+  800077:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  80007e:	48 89 d3             	mov    %rdx,%rbx
+  800081:	48 c1 fb 25          	sar    $0x25,%rbx
+  800085:	49 89 db             	mov    %rbx,%r11
+  800088:	41 89 c9             	mov    %ecx,%r9d
+  80008b:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  80008f:	45 89 ca             	mov    %r9d,%r10d
+  800092:	41 29 da             	sub    %ebx,%r10d
+  800095:	44 01 d0             	add    %r10d,%eax
+  800098:	48 c1 fa 27          	sar    $0x27,%rdx
+  80009c:	44 29 ca             	sub    %r9d,%edx
+  80009f:	8d 84 10 59 05 f5 ff 	lea    -0xafaa7(%rax,%rdx,1),%eax
+  8000a6:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  8000ac:	81 c6 6d 01 00 00    	add    $0x16d,%esi
+  8000b2:	41 39 c0             	cmp    %eax,%r8d
+  8000b5:	7d ab                	jge    800062 <umain+0x3d>
+    tm->tm_year = year - 1900;
+    time -= DAY * (Y2DAYS(year) - Y2DAYS(1970));
+  8000b7:	69 f1 6d 01 00 00    	imul   $0x16d,%ecx,%esi
+  8000bd:	8d 41 02             	lea    0x2(%rcx),%eax
+  8000c0:	89 ca                	mov    %ecx,%edx
+  8000c2:	83 ea 01             	sub    $0x1,%edx
+  8000c5:	0f 49 c2             	cmovns %edx,%eax
+  8000c8:	c1 f8 02             	sar    $0x2,%eax
+  8000cb:	01 c6                	add    %eax,%esi
+  8000cd:	48 63 c2             	movslq %edx,%rax
+  8000d0:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  8000d7:	48 89 c3             	mov    %rax,%rbx
+  8000da:	48 c1 fb 25          	sar    $0x25,%rbx
+  8000de:	c1 fa 1f             	sar    $0x1f,%edx
+  8000e1:	89 d7                	mov    %edx,%edi
+  8000e3:	29 df                	sub    %ebx,%edi
+  8000e5:	01 fe                	add    %edi,%esi
+  8000e7:	48 c1 f8 27          	sar    $0x27,%rax
+  8000eb:	29 d0                	sub    %edx,%eax
+  8000ed:	8d b4 06 59 05 f5 ff 	lea    -0xafaa7(%rsi,%rax,1),%esi
+  8000f4:	69 f6 80 ae fe ff    	imul   $0xfffeae80,%esi,%esi
+  8000fa:	44 01 c6             	add    %r8d,%esi
+
+    int month = time / (DAY * 32);
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  8000fd:	4c 63 c9             	movslq %ecx,%r9
+  800100:	4d 69 c9 1f 85 eb 51 	imul   $0x51eb851f,%r9,%r9
+  800107:	4c 89 c8             	mov    %r9,%rax
+  80010a:	48 c1 f8 27          	sar    $0x27,%rax
+  80010e:	49 89 c2             	mov    %rax,%r10
+  800111:	89 c8                	mov    %ecx,%eax
+  800113:	c1 f8 1f             	sar    $0x1f,%eax
+  800116:	41 29 c2             	sub    %eax,%r10d
+  800119:	41 69 d2 90 01 00 00 	imul   $0x190,%r10d,%edx
+  800120:	41 89 ca             	mov    %ecx,%r10d
+  800123:	41 29 d2             	sub    %edx,%r10d
+  800126:	4d 89 d9             	mov    %r11,%r9
+  800129:	41 29 c1             	sub    %eax,%r9d
+  80012c:	41 6b c1 64          	imul   $0x64,%r9d,%eax
+  800130:	41 89 c9             	mov    %ecx,%r9d
+  800133:	41 29 c1             	sub    %eax,%r9d
+    int month = time / (DAY * 32);
+  800136:	48 63 d6             	movslq %esi,%rdx
+  800139:	48 69 d2 07 45 2e c2 	imul   $0xffffffffc22e4507,%rdx,%rdx
+  800140:	48 c1 ea 20          	shr    $0x20,%rdx
+  800144:	01 f2                	add    %esi,%edx
+  800146:	c1 fa 15             	sar    $0x15,%edx
+  800149:	89 f0                	mov    %esi,%eax
+  80014b:	c1 f8 1f             	sar    $0x1f,%eax
+  80014e:	29 c2                	sub    %eax,%edx
+  800150:	48 63 d2             	movslq %edx,%rdx
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  800153:	41 89 cb             	mov    %ecx,%r11d
+  800156:	41 83 e3 03          	and    $0x3,%r11d
+  80015a:	44 89 cb             	mov    %r9d,%ebx
+  80015d:	eb 21                	jmp    800180 <umain+0x15b>
+  80015f:	85 d2                	test   %edx,%edx
+  800161:	40 0f 9f c7          	setg   %dil
+  800165:	40 0f b6 ff          	movzbl %dil,%edi
+  800169:	4c 8d 42 01          	lea    0x1(%rdx),%r8
+  80016d:	01 f8                	add    %edi,%eax
+  80016f:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800175:	39 c6                	cmp    %eax,%esi
+  800177:	0f 8c 89 00 00 00    	jl     800206 <umain+0x1e1>
+  80017d:	4c 89 c2             	mov    %r8,%rdx
+  800180:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  800187:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  80018e:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  800195:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  80019c:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  8001a3:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  8001aa:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  8001b1:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  8001b8:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  8001bf:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  8001c6:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  8001cd:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  8001d4:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  8001db:	8b 44 95 ac          	mov    -0x54(%rbp,%rdx,4),%eax
+  8001df:	45 85 d2             	test   %r10d,%r10d
+  8001e2:	0f 84 77 ff ff ff    	je     80015f <umain+0x13a>
+  8001e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ed:	45 85 db             	test   %r11d,%r11d
+  8001f0:	0f 85 73 ff ff ff    	jne    800169 <umain+0x144>
+  8001f6:	89 df                	mov    %ebx,%edi
+  8001f8:	45 85 c9             	test   %r9d,%r9d
+  8001fb:	0f 84 68 ff ff ff    	je     800169 <umain+0x144>
+  800201:	e9 59 ff ff ff       	jmp    80015f <umain+0x13a>
+  800206:	89 d7                	mov    %edx,%edi
+    tm->tm_mon = month;
+    time -= DAY * M2DAYS(month, year);
+  800208:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  80020f:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  800216:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  80021d:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  800224:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  80022b:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  800232:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  800239:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  800240:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  800247:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  80024e:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  800255:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  80025c:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  800263:	48 63 c2             	movslq %edx,%rax
+  800266:	8b 44 85 a8          	mov    -0x58(%rbp,%rax,4),%eax
+  80026a:	45 85 d2             	test   %r10d,%r10d
+  80026d:	74 0e                	je     80027d <umain+0x258>
+  80026f:	f6 c1 03             	test   $0x3,%cl
+  800272:	0f 85 ff 00 00 00    	jne    800377 <umain+0x352>
+  800278:	45 85 c9             	test   %r9d,%r9d
+  80027b:	74 0b                	je     800288 <umain+0x263>
+  80027d:	83 ff 01             	cmp    $0x1,%edi
+  800280:	41 0f 9f c1          	setg   %r9b
+  800284:	45 0f b6 c9          	movzbl %r9b,%r9d
+  800288:	44 01 c8             	add    %r9d,%eax
+  80028b:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800291:	29 c6                	sub    %eax,%esi
+
+    tm->tm_mday = time / DAY + 1;
+    time %= DAY;
+  800293:	48 63 c6             	movslq %esi,%rax
+  800296:	48 69 c0 07 45 2e c2 	imul   $0xffffffffc22e4507,%rax,%rax
+  80029d:	48 c1 e8 20          	shr    $0x20,%rax
+  8002a1:	01 f0                	add    %esi,%eax
+  8002a3:	c1 f8 10             	sar    $0x10,%eax
+  8002a6:	41 89 f3             	mov    %esi,%r11d
+  8002a9:	41 c1 fb 1f          	sar    $0x1f,%r11d
+  8002ad:	41 89 c2             	mov    %eax,%r10d
+  8002b0:	45 29 da             	sub    %r11d,%r10d
+  8002b3:	41 69 fa 80 51 01 00 	imul   $0x15180,%r10d,%edi
+  8002ba:	29 fe                	sub    %edi,%esi
+  8002bc:	41 89 f2             	mov    %esi,%r10d
+    tm->tm_hour = time / HOUR;
+    time %= HOUR;
+  8002bf:	48 63 f6             	movslq %esi,%rsi
+  8002c2:	48 69 f6 c5 b3 a2 91 	imul   $0xffffffff91a2b3c5,%rsi,%rsi
+  8002c9:	48 c1 ee 20          	shr    $0x20,%rsi
+  8002cd:	44 01 d6             	add    %r10d,%esi
+  8002d0:	c1 fe 0b             	sar    $0xb,%esi
+  8002d3:	41 89 f0             	mov    %esi,%r8d
+  8002d6:	45 89 d1             	mov    %r10d,%r9d
+  8002d9:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  8002dd:	89 f7                	mov    %esi,%edi
+  8002df:	44 29 cf             	sub    %r9d,%edi
+  8002e2:	69 f7 10 0e 00 00    	imul   $0xe10,%edi,%esi
+  8002e8:	44 89 d7             	mov    %r10d,%edi
+  8002eb:	29 f7                	sub    %esi,%edi
+    tm->tm_mday = time / DAY + 1;
+  8002ed:	44 29 d8             	sub    %r11d,%eax
+  8002f0:	89 c6                	mov    %eax,%esi
+}
+
+inline static void
+snprint_datetime(char *buf, int size, struct tm *tm) {
+    assert(size >= 10 + 1 + 8 + 1);
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  8002f2:	48 83 ec 08          	sub    $0x8,%rsp
+    time %= MINUTE;
+  8002f6:	48 63 c7             	movslq %edi,%rax
+  8002f9:	48 69 c0 89 88 88 88 	imul   $0xffffffff88888889,%rax,%rax
+  800300:	48 c1 e8 20          	shr    $0x20,%rax
+  800304:	01 f8                	add    %edi,%eax
+  800306:	c1 f8 05             	sar    $0x5,%eax
+  800309:	41 89 fa             	mov    %edi,%r10d
+  80030c:	41 c1 fa 1f          	sar    $0x1f,%r10d
+  800310:	44 29 d0             	sub    %r10d,%eax
+  800313:	44 6b d0 3c          	imul   $0x3c,%eax,%r10d
+  800317:	44 29 d7             	sub    %r10d,%edi
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  80031a:	57                   	push   %rdi
+  80031b:	50                   	push   %rax
+    tm->tm_hour = time / HOUR;
+  80031c:	45 29 c8             	sub    %r9d,%r8d
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  80031f:	41 50                	push   %r8
+  800321:	44 8d 4e 01          	lea    0x1(%rsi),%r9d
+  800325:	44 8d 42 01          	lea    0x1(%rdx),%r8d
+  800329:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800330:	00 00 00 
+  800333:	be 14 00 00 00       	mov    $0x14,%esi
+  800338:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80033c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800341:	49 ba f8 0d 80 00 00 	movabs $0x800df8,%r10
+  800348:	00 00 00 
+  80034b:	41 ff d2             	call   *%r10
+    struct tm tnow;
+
+    mktime(now, &tnow);
+
+    snprint_datetime(time, 20, &tnow);
+    cprintf("DATE: %s\n", time);
+  80034e:	48 83 c4 20          	add    $0x20,%rsp
+  800352:	48 8d 75 dc          	lea    -0x24(%rbp),%rsi
+  800356:	48 bf 1e 50 80 00 00 	movabs $0x80501e,%rdi
+  80035d:	00 00 00 
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	48 ba fb 04 80 00 00 	movabs $0x8004fb,%rdx
+  80036c:	00 00 00 
+  80036f:	ff d2                	call   *%rdx
+}
+  800371:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800375:	c9                   	leave
+  800376:	c3                   	ret
+    time -= DAY * M2DAYS(month, year);
+  800377:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80037d:	e9 06 ff ff ff       	jmp    800288 <umain+0x263>
+
+0000000000800382 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800382:	55                   	push   %rbp
+  800383:	48 89 e5             	mov    %rsp,%rbp
+  800386:	41 56                	push   %r14
+  800388:	41 55                	push   %r13
+  80038a:	41 54                	push   %r12
+  80038c:	53                   	push   %rbx
+  80038d:	41 89 fd             	mov    %edi,%r13d
+  800390:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800393:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80039a:	00 00 00 
+  80039d:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8003a4:	00 00 00 
+  8003a7:	48 39 c2             	cmp    %rax,%rdx
+  8003aa:	73 17                	jae    8003c3 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8003ac:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003af:	49 89 c4             	mov    %rax,%r12
+  8003b2:	48 83 c3 08          	add    $0x8,%rbx
+  8003b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bb:	ff 53 f8             	call   *-0x8(%rbx)
+  8003be:	4c 39 e3             	cmp    %r12,%rbx
+  8003c1:	72 ef                	jb     8003b2 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003c3:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  8003ca:	00 00 00 
+  8003cd:	ff d0                	call   *%rax
+  8003cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003d4:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8003db:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003e2:	00 00 00 
+  8003e5:	48 01 d0             	add    %rdx,%rax
+  8003e8:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8003ef:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003f2:	45 85 ed             	test   %r13d,%r13d
+  8003f5:	7e 0d                	jle    800404 <libmain+0x82>
+  8003f7:	49 8b 06             	mov    (%r14),%rax
+  8003fa:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800401:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800404:	4c 89 f6             	mov    %r14,%rsi
+  800407:	44 89 ef             	mov    %r13d,%edi
+  80040a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800411:	00 00 00 
+  800414:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800416:	48 b8 2b 04 80 00 00 	movabs $0x80042b,%rax
+  80041d:	00 00 00 
+  800420:	ff d0                	call   *%rax
+#endif
+}
+  800422:	5b                   	pop    %rbx
+  800423:	41 5c                	pop    %r12
+  800425:	41 5d                	pop    %r13
+  800427:	41 5e                	pop    %r14
+  800429:	5d                   	pop    %rbp
+  80042a:	c3                   	ret
+
+000000000080042b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80042b:	55                   	push   %rbp
+  80042c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80042f:	48 b8 0f 22 80 00 00 	movabs $0x80220f,%rax
+  800436:	00 00 00 
+  800439:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80043b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800440:	48 b8 a8 14 80 00 00 	movabs $0x8014a8,%rax
+  800447:	00 00 00 
+  80044a:	ff d0                	call   *%rax
+}
+  80044c:	5d                   	pop    %rbp
+  80044d:	c3                   	ret
+
+000000000080044e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80044e:	55                   	push   %rbp
+  80044f:	48 89 e5             	mov    %rsp,%rbp
+  800452:	53                   	push   %rbx
+  800453:	48 83 ec 08          	sub    $0x8,%rsp
+  800457:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80045a:	8b 06                	mov    (%rsi),%eax
+  80045c:	8d 50 01             	lea    0x1(%rax),%edx
+  80045f:	89 16                	mov    %edx,(%rsi)
+  800461:	48 98                	cltq
+  800463:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800468:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80046e:	74 0a                	je     80047a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800470:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800474:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800478:	c9                   	leave
+  800479:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80047a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80047e:	be ff 00 00 00       	mov    $0xff,%esi
+  800483:	48 b8 4a 14 80 00 00 	movabs $0x80144a,%rax
+  80048a:	00 00 00 
+  80048d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80048f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800495:	eb d9                	jmp    800470 <putch+0x22>
+
+0000000000800497 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800497:	55                   	push   %rbp
+  800498:	48 89 e5             	mov    %rsp,%rbp
+  80049b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004a2:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004a5:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004ac:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004b9:	48 89 f1             	mov    %rsi,%rcx
+  8004bc:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004c3:	48 bf 4e 04 80 00 00 	movabs $0x80044e,%rdi
+  8004ca:	00 00 00 
+  8004cd:	48 b8 4b 06 80 00 00 	movabs $0x80064b,%rax
+  8004d4:	00 00 00 
+  8004d7:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004d9:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004e0:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004e7:	48 b8 4a 14 80 00 00 	movabs $0x80144a,%rax
+  8004ee:	00 00 00 
+  8004f1:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004f3:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8004f9:	c9                   	leave
+  8004fa:	c3                   	ret
+
+00000000008004fb <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8004fb:	55                   	push   %rbp
+  8004fc:	48 89 e5             	mov    %rsp,%rbp
+  8004ff:	48 83 ec 50          	sub    $0x50,%rsp
+  800503:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800507:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80050b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80050f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800513:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800517:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80051e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800522:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800526:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80052a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80052e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800532:	48 b8 97 04 80 00 00 	movabs $0x800497,%rax
+  800539:	00 00 00 
+  80053c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80053e:	c9                   	leave
+  80053f:	c3                   	ret
+
+0000000000800540 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800540:	55                   	push   %rbp
+  800541:	48 89 e5             	mov    %rsp,%rbp
+  800544:	41 57                	push   %r15
+  800546:	41 56                	push   %r14
+  800548:	41 55                	push   %r13
+  80054a:	41 54                	push   %r12
+  80054c:	53                   	push   %rbx
+  80054d:	48 83 ec 18          	sub    $0x18,%rsp
+  800551:	49 89 fc             	mov    %rdi,%r12
+  800554:	49 89 f5             	mov    %rsi,%r13
+  800557:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80055b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80055e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800561:	41 89 cf             	mov    %ecx,%r15d
+  800564:	4c 39 fa             	cmp    %r15,%rdx
+  800567:	73 5b                	jae    8005c4 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800569:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80056d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800571:	85 db                	test   %ebx,%ebx
+  800573:	7e 0e                	jle    800583 <print_num+0x43>
+            putch(padc, put_arg);
+  800575:	4c 89 ee             	mov    %r13,%rsi
+  800578:	44 89 f7             	mov    %r14d,%edi
+  80057b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80057e:	83 eb 01             	sub    $0x1,%ebx
+  800581:	75 f2                	jne    800575 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800583:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800587:	48 b9 43 50 80 00 00 	movabs $0x805043,%rcx
+  80058e:	00 00 00 
+  800591:	48 b8 32 50 80 00 00 	movabs $0x805032,%rax
+  800598:	00 00 00 
+  80059b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80059f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a8:	49 f7 f7             	div    %r15
+  8005ab:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005af:	4c 89 ee             	mov    %r13,%rsi
+  8005b2:	41 ff d4             	call   *%r12
+}
+  8005b5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005b9:	5b                   	pop    %rbx
+  8005ba:	41 5c                	pop    %r12
+  8005bc:	41 5d                	pop    %r13
+  8005be:	41 5e                	pop    %r14
+  8005c0:	41 5f                	pop    %r15
+  8005c2:	5d                   	pop    %rbp
+  8005c3:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005cd:	49 f7 f7             	div    %r15
+  8005d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8005d4:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005d8:	52                   	push   %rdx
+  8005d9:	45 0f be c9          	movsbl %r9b,%r9d
+  8005dd:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005e1:	48 89 c2             	mov    %rax,%rdx
+  8005e4:	48 b8 40 05 80 00 00 	movabs $0x800540,%rax
+  8005eb:	00 00 00 
+  8005ee:	ff d0                	call   *%rax
+  8005f0:	48 83 c4 10          	add    $0x10,%rsp
+  8005f4:	eb 8d                	jmp    800583 <print_num+0x43>
+
+00000000008005f6 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8005f6:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8005fa:	48 8b 06             	mov    (%rsi),%rax
+  8005fd:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800601:	73 0a                	jae    80060d <sprintputch+0x17>
+        *state->start++ = ch;
+  800603:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800607:	48 89 16             	mov    %rdx,(%rsi)
+  80060a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80060d:	c3                   	ret
+
+000000000080060e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80060e:	55                   	push   %rbp
+  80060f:	48 89 e5             	mov    %rsp,%rbp
+  800612:	48 83 ec 50          	sub    $0x50,%rsp
+  800616:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80061a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80061e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800622:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800629:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80062d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800631:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800635:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800639:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80063d:	48 b8 4b 06 80 00 00 	movabs $0x80064b,%rax
+  800644:	00 00 00 
+  800647:	ff d0                	call   *%rax
+}
+  800649:	c9                   	leave
+  80064a:	c3                   	ret
+
+000000000080064b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80064b:	55                   	push   %rbp
+  80064c:	48 89 e5             	mov    %rsp,%rbp
+  80064f:	41 57                	push   %r15
+  800651:	41 56                	push   %r14
+  800653:	41 55                	push   %r13
+  800655:	41 54                	push   %r12
+  800657:	53                   	push   %rbx
+  800658:	48 83 ec 38          	sub    $0x38,%rsp
+  80065c:	49 89 fe             	mov    %rdi,%r14
+  80065f:	49 89 f5             	mov    %rsi,%r13
+  800662:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800665:	48 8b 01             	mov    (%rcx),%rax
+  800668:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80066c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800670:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800674:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800678:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80067c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800680:	0f b6 3b             	movzbl (%rbx),%edi
+  800683:	40 80 ff 25          	cmp    $0x25,%dil
+  800687:	74 18                	je     8006a1 <vprintfmt+0x56>
+            if (!ch) return;
+  800689:	40 84 ff             	test   %dil,%dil
+  80068c:	0f 84 04 07 00 00    	je     800d96 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800692:	40 0f b6 ff          	movzbl %dil,%edi
+  800696:	4c 89 ee             	mov    %r13,%rsi
+  800699:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80069c:	4c 89 e3             	mov    %r12,%rbx
+  80069f:	eb db                	jmp    80067c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8006a6:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006aa:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006af:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006b5:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006bc:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006c0:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006c5:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006ca:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006cd:	83 e8 23             	sub    $0x23,%eax
+  8006d0:	3c 57                	cmp    $0x57,%al
+  8006d2:	0f 87 a4 06 00 00    	ja     800d7c <vprintfmt+0x731>
+  8006d8:	0f b6 c0             	movzbl %al,%eax
+  8006db:	48 b9 e0 51 80 00 00 	movabs $0x8051e0,%rcx
+  8006e2:	00 00 00 
+  8006e5:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006e8:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006eb:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006ef:	eb cf                	jmp    8006c0 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006f1:	49 89 dc             	mov    %rbx,%r12
+  8006f4:	be 01 00 00 00       	mov    $0x1,%esi
+  8006f9:	eb c5                	jmp    8006c0 <vprintfmt+0x75>
+            padc = ch;
+  8006fb:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8006ff:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800702:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800705:	eb b9                	jmp    8006c0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800707:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070a:	83 f8 2f             	cmp    $0x2f,%eax
+  80070d:	77 24                	ja     800733 <vprintfmt+0xe8>
+  80070f:	89 c1                	mov    %eax,%ecx
+  800711:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800715:	83 c0 08             	add    $0x8,%eax
+  800718:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80071e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800721:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800725:	79 99                	jns    8006c0 <vprintfmt+0x75>
+                width = precision;
+  800727:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80072b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800731:	eb 8d                	jmp    8006c0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800733:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800737:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80073b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80073f:	eb da                	jmp    80071b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800741:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800746:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80074a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800750:	3c 39                	cmp    $0x39,%al
+  800752:	77 1c                	ja     800770 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800754:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800758:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80075c:	0f b6 c0             	movzbl %al,%eax
+  80075f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800764:	0f b6 03             	movzbl (%rbx),%eax
+  800767:	3c 39                	cmp    $0x39,%al
+  800769:	76 e9                	jbe    800754 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80076b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80076e:	eb b1                	jmp    800721 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800770:	49 89 dc             	mov    %rbx,%r12
+  800773:	eb ac                	jmp    800721 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800775:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800778:	85 c9                	test   %ecx,%ecx
+  80077a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077f:	0f 49 c1             	cmovns %ecx,%eax
+  800782:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800785:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800788:	e9 33 ff ff ff       	jmp    8006c0 <vprintfmt+0x75>
+            lflag++;
+  80078d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800790:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800793:	e9 28 ff ff ff       	jmp    8006c0 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800798:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079b:	83 f8 2f             	cmp    $0x2f,%eax
+  80079e:	77 19                	ja     8007b9 <vprintfmt+0x16e>
+  8007a0:	89 c2                	mov    %eax,%edx
+  8007a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a6:	83 c0 08             	add    $0x8,%eax
+  8007a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ac:	8b 3a                	mov    (%rdx),%edi
+  8007ae:	4c 89 ee             	mov    %r13,%rsi
+  8007b1:	41 ff d6             	call   *%r14
+            break;
+  8007b4:	e9 c3 fe ff ff       	jmp    80067c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c5:	eb e5                	jmp    8007ac <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cd:	77 5a                	ja     800829 <vprintfmt+0x1de>
+  8007cf:	89 c2                	mov    %eax,%edx
+  8007d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d5:	83 c0 08             	add    $0x8,%eax
+  8007d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007db:	8b 02                	mov    (%rdx),%eax
+  8007dd:	89 c1                	mov    %eax,%ecx
+  8007df:	f7 d9                	neg    %ecx
+  8007e1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007e4:	83 f9 13             	cmp    $0x13,%ecx
+  8007e7:	7f 4e                	jg     800837 <vprintfmt+0x1ec>
+  8007e9:	48 63 c1             	movslq %ecx,%rax
+  8007ec:	48 ba a0 54 80 00 00 	movabs $0x8054a0,%rdx
+  8007f3:	00 00 00 
+  8007f6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007fa:	48 85 c0             	test   %rax,%rax
+  8007fd:	74 38                	je     800837 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8007ff:	48 89 c1             	mov    %rax,%rcx
+  800802:	48 ba d9 56 80 00 00 	movabs $0x8056d9,%rdx
+  800809:	00 00 00 
+  80080c:	4c 89 ee             	mov    %r13,%rsi
+  80080f:	4c 89 f7             	mov    %r14,%rdi
+  800812:	b8 00 00 00 00       	mov    $0x0,%eax
+  800817:	49 b8 0e 06 80 00 00 	movabs $0x80060e,%r8
+  80081e:	00 00 00 
+  800821:	41 ff d0             	call   *%r8
+  800824:	e9 53 fe ff ff       	jmp    80067c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800829:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800831:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800835:	eb a4                	jmp    8007db <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800837:	48 ba 5b 50 80 00 00 	movabs $0x80505b,%rdx
+  80083e:	00 00 00 
+  800841:	4c 89 ee             	mov    %r13,%rsi
+  800844:	4c 89 f7             	mov    %r14,%rdi
+  800847:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084c:	49 b8 0e 06 80 00 00 	movabs $0x80060e,%r8
+  800853:	00 00 00 
+  800856:	41 ff d0             	call   *%r8
+  800859:	e9 1e fe ff ff       	jmp    80067c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80085e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800861:	83 f8 2f             	cmp    $0x2f,%eax
+  800864:	77 36                	ja     80089c <vprintfmt+0x251>
+  800866:	89 c2                	mov    %eax,%edx
+  800868:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086c:	83 c0 08             	add    $0x8,%eax
+  80086f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800872:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800875:	48 85 f6             	test   %rsi,%rsi
+  800878:	48 b8 54 50 80 00 00 	movabs $0x805054,%rax
+  80087f:	00 00 00 
+  800882:	48 0f 45 c6          	cmovne %rsi,%rax
+  800886:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80088a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80088e:	7e 06                	jle    800896 <vprintfmt+0x24b>
+  800890:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800894:	75 14                	jne    8008aa <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800896:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80089a:	eb 5b                	jmp    8008f7 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80089c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a8:	eb c8                	jmp    800872 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008aa:	49 63 f7             	movslq %r15d,%rsi
+  8008ad:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008b1:	48 b8 50 0e 80 00 00 	movabs $0x800e50,%rax
+  8008b8:	00 00 00 
+  8008bb:	ff d0                	call   *%rax
+  8008bd:	48 89 c2             	mov    %rax,%rdx
+  8008c0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008c3:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8008c5:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8008c8:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8008cb:	85 c0                	test   %eax,%eax
+  8008cd:	7e c7                	jle    800896 <vprintfmt+0x24b>
+  8008cf:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008d4:	4c 89 ee             	mov    %r13,%rsi
+  8008d7:	44 89 e7             	mov    %r12d,%edi
+  8008da:	41 ff d6             	call   *%r14
+  8008dd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008e1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008e4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008e7:	75 eb                	jne    8008d4 <vprintfmt+0x289>
+  8008e9:	eb ab                	jmp    800896 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008eb:	0f b6 f8             	movzbl %al,%edi
+  8008ee:	4c 89 ee             	mov    %r13,%rsi
+  8008f1:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8008f4:	4c 89 e2             	mov    %r12,%rdx
+  8008f7:	45 85 ff             	test   %r15d,%r15d
+  8008fa:	78 06                	js     800902 <vprintfmt+0x2b7>
+  8008fc:	41 83 ef 01          	sub    $0x1,%r15d
+  800900:	78 23                	js     800925 <vprintfmt+0x2da>
+  800902:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800906:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80090c:	84 c0                	test   %al,%al
+  80090e:	74 15                	je     800925 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800910:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800914:	74 d5                	je     8008eb <vprintfmt+0x2a0>
+  800916:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800919:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80091e:	80 fa 5e             	cmp    $0x5e,%dl
+  800921:	77 cb                	ja     8008ee <vprintfmt+0x2a3>
+  800923:	eb c6                	jmp    8008eb <vprintfmt+0x2a0>
+  800925:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800928:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  80092b:	01 f0                	add    %esi,%eax
+  80092d:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80092f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800933:	85 c0                	test   %eax,%eax
+  800935:	0f 8e 41 fd ff ff    	jle    80067c <vprintfmt+0x31>
+  80093b:	4c 89 ee             	mov    %r13,%rsi
+  80093e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800943:	41 ff d6             	call   *%r14
+  800946:	41 83 ec 01          	sub    $0x1,%r12d
+  80094a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80094e:	75 eb                	jne    80093b <vprintfmt+0x2f0>
+  800950:	e9 27 fd ff ff       	jmp    80067c <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800955:	40 84 f6             	test   %sil,%sil
+  800958:	75 26                	jne    800980 <vprintfmt+0x335>
+    switch (lflag) {
+  80095a:	85 d2                	test   %edx,%edx
+  80095c:	74 59                	je     8009b7 <vprintfmt+0x36c>
+  80095e:	83 fa 01             	cmp    $0x1,%edx
+  800961:	74 7b                	je     8009de <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800963:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800966:	83 f8 2f             	cmp    $0x2f,%eax
+  800969:	0f 87 96 00 00 00    	ja     800a05 <vprintfmt+0x3ba>
+  80096f:	89 c2                	mov    %eax,%edx
+  800971:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800975:	83 c0 08             	add    $0x8,%eax
+  800978:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097b:	4c 8b 22             	mov    (%rdx),%r12
+  80097e:	eb 17                	jmp    800997 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800980:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800983:	83 f8 2f             	cmp    $0x2f,%eax
+  800986:	77 21                	ja     8009a9 <vprintfmt+0x35e>
+  800988:	89 c2                	mov    %eax,%edx
+  80098a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098e:	83 c0 08             	add    $0x8,%eax
+  800991:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800994:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800997:	4d 85 e4             	test   %r12,%r12
+  80099a:	78 7a                	js     800a16 <vprintfmt+0x3cb>
+            num = i;
+  80099c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80099f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009a4:	e9 b5 02 00 00       	jmp    800c5e <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b5:	eb dd                	jmp    800994 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8009b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bd:	77 11                	ja     8009d0 <vprintfmt+0x385>
+  8009bf:	89 c2                	mov    %eax,%edx
+  8009c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c5:	83 c0 08             	add    $0x8,%eax
+  8009c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cb:	4c 63 22             	movslq (%rdx),%r12
+  8009ce:	eb c7                	jmp    800997 <vprintfmt+0x34c>
+  8009d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009dc:	eb ed                	jmp    8009cb <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8009de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e4:	77 11                	ja     8009f7 <vprintfmt+0x3ac>
+  8009e6:	89 c2                	mov    %eax,%edx
+  8009e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ec:	83 c0 08             	add    $0x8,%eax
+  8009ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f2:	4c 8b 22             	mov    (%rdx),%r12
+  8009f5:	eb a0                	jmp    800997 <vprintfmt+0x34c>
+  8009f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a03:	eb ed                	jmp    8009f2 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800a05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a11:	e9 65 ff ff ff       	jmp    80097b <vprintfmt+0x330>
+                putch('-', put_arg);
+  800a16:	4c 89 ee             	mov    %r13,%rsi
+  800a19:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a1e:	41 ff d6             	call   *%r14
+                i = -i;
+  800a21:	49 f7 dc             	neg    %r12
+  800a24:	e9 73 ff ff ff       	jmp    80099c <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800a29:	40 84 f6             	test   %sil,%sil
+  800a2c:	75 32                	jne    800a60 <vprintfmt+0x415>
+    switch (lflag) {
+  800a2e:	85 d2                	test   %edx,%edx
+  800a30:	74 5d                	je     800a8f <vprintfmt+0x444>
+  800a32:	83 fa 01             	cmp    $0x1,%edx
+  800a35:	0f 84 82 00 00 00    	je     800abd <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800a3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a41:	0f 87 a5 00 00 00    	ja     800aec <vprintfmt+0x4a1>
+  800a47:	89 c2                	mov    %eax,%edx
+  800a49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4d:	83 c0 08             	add    $0x8,%eax
+  800a50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a53:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a5b:	e9 fe 01 00 00       	jmp    800c5e <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a63:	83 f8 2f             	cmp    $0x2f,%eax
+  800a66:	77 19                	ja     800a81 <vprintfmt+0x436>
+  800a68:	89 c2                	mov    %eax,%edx
+  800a6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6e:	83 c0 08             	add    $0x8,%eax
+  800a71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a74:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a77:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a7c:	e9 dd 01 00 00       	jmp    800c5e <vprintfmt+0x613>
+  800a81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8d:	eb e5                	jmp    800a74 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800a8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a92:	83 f8 2f             	cmp    $0x2f,%eax
+  800a95:	77 18                	ja     800aaf <vprintfmt+0x464>
+  800a97:	89 c2                	mov    %eax,%edx
+  800a99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9d:	83 c0 08             	add    $0x8,%eax
+  800aa0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800aa5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800aaa:	e9 af 01 00 00       	jmp    800c5e <vprintfmt+0x613>
+  800aaf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abb:	eb e6                	jmp    800aa3 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800abd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac3:	77 19                	ja     800ade <vprintfmt+0x493>
+  800ac5:	89 c2                	mov    %eax,%edx
+  800ac7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acb:	83 c0 08             	add    $0x8,%eax
+  800ace:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ad4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ad9:	e9 80 01 00 00       	jmp    800c5e <vprintfmt+0x613>
+  800ade:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aea:	eb e5                	jmp    800ad1 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800aec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af8:	e9 56 ff ff ff       	jmp    800a53 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800afd:	40 84 f6             	test   %sil,%sil
+  800b00:	75 2e                	jne    800b30 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800b02:	85 d2                	test   %edx,%edx
+  800b04:	0f 84 b3 00 00 00    	je     800bbd <vprintfmt+0x572>
+  800b0a:	83 fa 01             	cmp    $0x1,%edx
+  800b0d:	0f 84 d3 00 00 00    	je     800be6 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800b13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b16:	83 f8 2f             	cmp    $0x2f,%eax
+  800b19:	0f 87 f1 00 00 00    	ja     800c10 <vprintfmt+0x5c5>
+  800b1f:	89 c2                	mov    %eax,%edx
+  800b21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b25:	83 c0 08             	add    $0x8,%eax
+  800b28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2b:	48 8b 02             	mov    (%rdx),%rax
+  800b2e:	eb 17                	jmp    800b47 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800b30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b33:	83 f8 2f             	cmp    $0x2f,%eax
+  800b36:	77 77                	ja     800baf <vprintfmt+0x564>
+  800b38:	89 c2                	mov    %eax,%edx
+  800b3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3e:	83 c0 08             	add    $0x8,%eax
+  800b41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b44:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800b47:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800b49:	83 f8 07             	cmp    $0x7,%eax
+  800b4c:	0f 8e cf 00 00 00    	jle    800c21 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800b52:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800b58:	44 89 e7             	mov    %r12d,%edi
+  800b5b:	41 c1 e4 03          	shl    $0x3,%r12d
+  800b5f:	89 d1                	mov    %edx,%ecx
+  800b61:	8d 72 07             	lea    0x7(%rdx),%esi
+  800b64:	85 d2                	test   %edx,%edx
+  800b66:	0f 48 d6             	cmovs  %esi,%edx
+  800b69:	c1 fa 03             	sar    $0x3,%edx
+  800b6c:	83 f9 3f             	cmp    $0x3f,%ecx
+  800b6f:	7f e7                	jg     800b58 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800b71:	85 ff                	test   %edi,%edi
+  800b73:	0f 84 03 fb ff ff    	je     80067c <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800b79:	49 63 f4             	movslq %r12d,%rsi
+  800b7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b81:	48 f7 f6             	div    %rsi
+  800b84:	49 89 d7             	mov    %rdx,%r15
+  800b87:	83 c0 30             	add    $0x30,%eax
+  800b8a:	0f be f8             	movsbl %al,%edi
+  800b8d:	4c 89 ee             	mov    %r13,%rsi
+  800b90:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800b93:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800b96:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800b9b:	45 85 e4             	test   %r12d,%r12d
+  800b9e:	41 0f 49 d4          	cmovns %r12d,%edx
+  800ba2:	c1 fa 03             	sar    $0x3,%edx
+  800ba5:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800ba8:	75 cf                	jne    800b79 <vprintfmt+0x52e>
+  800baa:	e9 cd fa ff ff       	jmp    80067c <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800baf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbb:	eb 87                	jmp    800b44 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800bbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc3:	77 13                	ja     800bd8 <vprintfmt+0x58d>
+  800bc5:	89 c2                	mov    %eax,%edx
+  800bc7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcb:	83 c0 08             	add    $0x8,%eax
+  800bce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd1:	8b 02                	mov    (%rdx),%eax
+  800bd3:	e9 6f ff ff ff       	jmp    800b47 <vprintfmt+0x4fc>
+  800bd8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be4:	eb eb                	jmp    800bd1 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800be6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bec:	77 14                	ja     800c02 <vprintfmt+0x5b7>
+  800bee:	89 c2                	mov    %eax,%edx
+  800bf0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf4:	83 c0 08             	add    $0x8,%eax
+  800bf7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bfa:	48 8b 02             	mov    (%rdx),%rax
+  800bfd:	e9 45 ff ff ff       	jmp    800b47 <vprintfmt+0x4fc>
+  800c02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0e:	eb ea                	jmp    800bfa <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800c10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1c:	e9 0a ff ff ff       	jmp    800b2b <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800c21:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800c27:	e9 4d ff ff ff       	jmp    800b79 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800c2c:	4c 89 ee             	mov    %r13,%rsi
+  800c2f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c34:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c37:	4c 89 ee             	mov    %r13,%rsi
+  800c3a:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c3f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c45:	83 f8 2f             	cmp    $0x2f,%eax
+  800c48:	77 47                	ja     800c91 <vprintfmt+0x646>
+  800c4a:	89 c2                	mov    %eax,%edx
+  800c4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c50:	83 c0 08             	add    $0x8,%eax
+  800c53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c56:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c59:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c5e:	48 83 ec 08          	sub    $0x8,%rsp
+  800c62:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c66:	0f 94 c0             	sete   %al
+  800c69:	0f b6 c0             	movzbl %al,%eax
+  800c6c:	50                   	push   %rax
+  800c6d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c72:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c76:	4c 89 ee             	mov    %r13,%rsi
+  800c79:	4c 89 f7             	mov    %r14,%rdi
+  800c7c:	48 b8 40 05 80 00 00 	movabs $0x800540,%rax
+  800c83:	00 00 00 
+  800c86:	ff d0                	call   *%rax
+            break;
+  800c88:	48 83 c4 10          	add    $0x10,%rsp
+  800c8c:	e9 eb f9 ff ff       	jmp    80067c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9d:	eb b7                	jmp    800c56 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800c9f:	40 84 f6             	test   %sil,%sil
+  800ca2:	75 2b                	jne    800ccf <vprintfmt+0x684>
+    switch (lflag) {
+  800ca4:	85 d2                	test   %edx,%edx
+  800ca6:	74 56                	je     800cfe <vprintfmt+0x6b3>
+  800ca8:	83 fa 01             	cmp    $0x1,%edx
+  800cab:	74 7f                	je     800d2c <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800cad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb0:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb3:	0f 87 a2 00 00 00    	ja     800d5b <vprintfmt+0x710>
+  800cb9:	89 c2                	mov    %eax,%edx
+  800cbb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cbf:	83 c0 08             	add    $0x8,%eax
+  800cc2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cc8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ccd:	eb 8f                	jmp    800c5e <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800ccf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd2:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd5:	77 19                	ja     800cf0 <vprintfmt+0x6a5>
+  800cd7:	89 c2                	mov    %eax,%edx
+  800cd9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cdd:	83 c0 08             	add    $0x8,%eax
+  800ce0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ce6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ceb:	e9 6e ff ff ff       	jmp    800c5e <vprintfmt+0x613>
+  800cf0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cfc:	eb e5                	jmp    800ce3 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800cfe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d01:	83 f8 2f             	cmp    $0x2f,%eax
+  800d04:	77 18                	ja     800d1e <vprintfmt+0x6d3>
+  800d06:	89 c2                	mov    %eax,%edx
+  800d08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d0c:	83 c0 08             	add    $0x8,%eax
+  800d0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d12:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d14:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d19:	e9 40 ff ff ff       	jmp    800c5e <vprintfmt+0x613>
+  800d1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2a:	eb e6                	jmp    800d12 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800d2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d32:	77 19                	ja     800d4d <vprintfmt+0x702>
+  800d34:	89 c2                	mov    %eax,%edx
+  800d36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3a:	83 c0 08             	add    $0x8,%eax
+  800d3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d40:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d43:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d48:	e9 11 ff ff ff       	jmp    800c5e <vprintfmt+0x613>
+  800d4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d51:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d59:	eb e5                	jmp    800d40 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800d5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d67:	e9 59 ff ff ff       	jmp    800cc5 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800d6c:	4c 89 ee             	mov    %r13,%rsi
+  800d6f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d74:	41 ff d6             	call   *%r14
+            break;
+  800d77:	e9 00 f9 ff ff       	jmp    80067c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d7c:	4c 89 ee             	mov    %r13,%rsi
+  800d7f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d84:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d87:	48 83 eb 01          	sub    $0x1,%rbx
+  800d8b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d8f:	75 f6                	jne    800d87 <vprintfmt+0x73c>
+  800d91:	e9 e6 f8 ff ff       	jmp    80067c <vprintfmt+0x31>
+}
+  800d96:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d9a:	5b                   	pop    %rbx
+  800d9b:	41 5c                	pop    %r12
+  800d9d:	41 5d                	pop    %r13
+  800d9f:	41 5e                	pop    %r14
+  800da1:	41 5f                	pop    %r15
+  800da3:	5d                   	pop    %rbp
+  800da4:	c3                   	ret
+
+0000000000800da5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800da5:	55                   	push   %rbp
+  800da6:	48 89 e5             	mov    %rsp,%rbp
+  800da9:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800dad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800db1:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800db6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dba:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800dc1:	48 85 ff             	test   %rdi,%rdi
+  800dc4:	74 2b                	je     800df1 <vsnprintf+0x4c>
+  800dc6:	48 85 f6             	test   %rsi,%rsi
+  800dc9:	74 26                	je     800df1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800dcb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dcf:	48 bf f6 05 80 00 00 	movabs $0x8005f6,%rdi
+  800dd6:	00 00 00 
+  800dd9:	48 b8 4b 06 80 00 00 	movabs $0x80064b,%rax
+  800de0:	00 00 00 
+  800de3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800de5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800de9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800dec:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800def:	c9                   	leave
+  800df0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800df1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800df6:	eb f7                	jmp    800def <vsnprintf+0x4a>
+
+0000000000800df8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800df8:	55                   	push   %rbp
+  800df9:	48 89 e5             	mov    %rsp,%rbp
+  800dfc:	48 83 ec 50          	sub    $0x50,%rsp
+  800e00:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e04:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e08:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e0c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e13:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e1b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e1f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e23:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e27:	48 b8 a5 0d 80 00 00 	movabs $0x800da5,%rax
+  800e2e:	00 00 00 
+  800e31:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e33:	c9                   	leave
+  800e34:	c3                   	ret
+
+0000000000800e35 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e35:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e38:	74 10                	je     800e4a <strlen+0x15>
+    size_t n = 0;
+  800e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e3f:	48 83 c0 01          	add    $0x1,%rax
+  800e43:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e47:	75 f6                	jne    800e3f <strlen+0xa>
+  800e49:	c3                   	ret
+    size_t n = 0;
+  800e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e4f:	c3                   	ret
+
+0000000000800e50 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e50:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e53:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e58:	48 85 f6             	test   %rsi,%rsi
+  800e5b:	74 11                	je     800e6e <strnlen+0x1e>
+  800e5d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e61:	74 0c                	je     800e6f <strnlen+0x1f>
+  800e63:	48 83 c2 01          	add    $0x1,%rdx
+  800e67:	48 39 d0             	cmp    %rdx,%rax
+  800e6a:	75 f1                	jne    800e5d <strnlen+0xd>
+  800e6c:	eb 04                	jmp    800e72 <strnlen+0x22>
+  800e6e:	c3                   	ret
+  800e6f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e72:	c3                   	ret
+
+0000000000800e73 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e73:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e7f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e82:	48 83 c2 01          	add    $0x1,%rdx
+  800e86:	84 c9                	test   %cl,%cl
+  800e88:	75 f1                	jne    800e7b <strcpy+0x8>
+        ;
+    return res;
+}
+  800e8a:	c3                   	ret
+
+0000000000800e8b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e8b:	55                   	push   %rbp
+  800e8c:	48 89 e5             	mov    %rsp,%rbp
+  800e8f:	41 54                	push   %r12
+  800e91:	53                   	push   %rbx
+  800e92:	48 89 fb             	mov    %rdi,%rbx
+  800e95:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e98:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800e9f:	00 00 00 
+  800ea2:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ea4:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ea8:	4c 89 e6             	mov    %r12,%rsi
+  800eab:	48 b8 73 0e 80 00 00 	movabs $0x800e73,%rax
+  800eb2:	00 00 00 
+  800eb5:	ff d0                	call   *%rax
+    return dst;
+}
+  800eb7:	48 89 d8             	mov    %rbx,%rax
+  800eba:	5b                   	pop    %rbx
+  800ebb:	41 5c                	pop    %r12
+  800ebd:	5d                   	pop    %rbp
+  800ebe:	c3                   	ret
+
+0000000000800ebf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ebf:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ec2:	48 85 d2             	test   %rdx,%rdx
+  800ec5:	74 1f                	je     800ee6 <strncpy+0x27>
+  800ec7:	48 01 fa             	add    %rdi,%rdx
+  800eca:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ecd:	48 83 c1 01          	add    $0x1,%rcx
+  800ed1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ed5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ed9:	41 80 f8 01          	cmp    $0x1,%r8b
+  800edd:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ee1:	48 39 ca             	cmp    %rcx,%rdx
+  800ee4:	75 e7                	jne    800ecd <strncpy+0xe>
+    }
+    return ret;
+}
+  800ee6:	c3                   	ret
+
+0000000000800ee7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ee7:	48 89 f8             	mov    %rdi,%rax
+  800eea:	48 85 d2             	test   %rdx,%rdx
+  800eed:	74 24                	je     800f13 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800eef:	48 83 ea 01          	sub    $0x1,%rdx
+  800ef3:	74 1b                	je     800f10 <strlcpy+0x29>
+  800ef5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ef9:	0f b6 16             	movzbl (%rsi),%edx
+  800efc:	84 d2                	test   %dl,%dl
+  800efe:	74 10                	je     800f10 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f00:	48 83 c6 01          	add    $0x1,%rsi
+  800f04:	48 83 c0 01          	add    $0x1,%rax
+  800f08:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f0b:	48 39 c8             	cmp    %rcx,%rax
+  800f0e:	75 e9                	jne    800ef9 <strlcpy+0x12>
+        *dst = '\0';
+  800f10:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f13:	48 29 f8             	sub    %rdi,%rax
+}
+  800f16:	c3                   	ret
+
+0000000000800f17 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f17:	0f b6 07             	movzbl (%rdi),%eax
+  800f1a:	84 c0                	test   %al,%al
+  800f1c:	74 13                	je     800f31 <strcmp+0x1a>
+  800f1e:	38 06                	cmp    %al,(%rsi)
+  800f20:	75 0f                	jne    800f31 <strcmp+0x1a>
+  800f22:	48 83 c7 01          	add    $0x1,%rdi
+  800f26:	48 83 c6 01          	add    $0x1,%rsi
+  800f2a:	0f b6 07             	movzbl (%rdi),%eax
+  800f2d:	84 c0                	test   %al,%al
+  800f2f:	75 ed                	jne    800f1e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f31:	0f b6 c0             	movzbl %al,%eax
+  800f34:	0f b6 16             	movzbl (%rsi),%edx
+  800f37:	29 d0                	sub    %edx,%eax
+}
+  800f39:	c3                   	ret
+
+0000000000800f3a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f3a:	48 85 d2             	test   %rdx,%rdx
+  800f3d:	74 1f                	je     800f5e <strncmp+0x24>
+  800f3f:	0f b6 07             	movzbl (%rdi),%eax
+  800f42:	84 c0                	test   %al,%al
+  800f44:	74 1e                	je     800f64 <strncmp+0x2a>
+  800f46:	3a 06                	cmp    (%rsi),%al
+  800f48:	75 1a                	jne    800f64 <strncmp+0x2a>
+  800f4a:	48 83 c7 01          	add    $0x1,%rdi
+  800f4e:	48 83 c6 01          	add    $0x1,%rsi
+  800f52:	48 83 ea 01          	sub    $0x1,%rdx
+  800f56:	75 e7                	jne    800f3f <strncmp+0x5>
+
+    if (!n) return 0;
+  800f58:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5d:	c3                   	ret
+  800f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f63:	c3                   	ret
+  800f64:	48 85 d2             	test   %rdx,%rdx
+  800f67:	74 09                	je     800f72 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f69:	0f b6 07             	movzbl (%rdi),%eax
+  800f6c:	0f b6 16             	movzbl (%rsi),%edx
+  800f6f:	29 d0                	sub    %edx,%eax
+  800f71:	c3                   	ret
+    if (!n) return 0;
+  800f72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f77:	c3                   	ret
+
+0000000000800f78 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f78:	0f b6 17             	movzbl (%rdi),%edx
+  800f7b:	84 d2                	test   %dl,%dl
+  800f7d:	74 18                	je     800f97 <strchr+0x1f>
+        if (*str == c) {
+  800f7f:	0f be d2             	movsbl %dl,%edx
+  800f82:	39 f2                	cmp    %esi,%edx
+  800f84:	74 17                	je     800f9d <strchr+0x25>
+    for (; *str; str++) {
+  800f86:	48 83 c7 01          	add    $0x1,%rdi
+  800f8a:	0f b6 17             	movzbl (%rdi),%edx
+  800f8d:	84 d2                	test   %dl,%dl
+  800f8f:	75 ee                	jne    800f7f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f96:	c3                   	ret
+  800f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f9c:	c3                   	ret
+  800f9d:	48 89 f8             	mov    %rdi,%rax
+}
+  800fa0:	c3                   	ret
+
+0000000000800fa1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fa1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fa4:	0f b6 17             	movzbl (%rdi),%edx
+  800fa7:	84 d2                	test   %dl,%dl
+  800fa9:	74 13                	je     800fbe <strfind+0x1d>
+  800fab:	0f be d2             	movsbl %dl,%edx
+  800fae:	39 f2                	cmp    %esi,%edx
+  800fb0:	74 0b                	je     800fbd <strfind+0x1c>
+  800fb2:	48 83 c0 01          	add    $0x1,%rax
+  800fb6:	0f b6 10             	movzbl (%rax),%edx
+  800fb9:	84 d2                	test   %dl,%dl
+  800fbb:	75 ee                	jne    800fab <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fbd:	c3                   	ret
+  800fbe:	c3                   	ret
+
+0000000000800fbf <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800fbf:	55                   	push   %rbp
+  800fc0:	48 89 e5             	mov    %rsp,%rbp
+  800fc3:	41 57                	push   %r15
+  800fc5:	41 56                	push   %r14
+  800fc7:	41 55                	push   %r13
+  800fc9:	41 54                	push   %r12
+  800fcb:	53                   	push   %rbx
+  800fcc:	48 83 ec 08          	sub    $0x8,%rsp
+  800fd0:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800fd3:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800fd7:	45 84 ed             	test   %r13b,%r13b
+  800fda:	75 12                	jne    800fee <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800fdc:	4c 89 f8             	mov    %r15,%rax
+  800fdf:	48 83 c4 08          	add    $0x8,%rsp
+  800fe3:	5b                   	pop    %rbx
+  800fe4:	41 5c                	pop    %r12
+  800fe6:	41 5d                	pop    %r13
+  800fe8:	41 5e                	pop    %r14
+  800fea:	41 5f                	pop    %r15
+  800fec:	5d                   	pop    %rbp
+  800fed:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800fee:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800ff2:	4c 89 e7             	mov    %r12,%rdi
+  800ff5:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800ffc:	00 00 00 
+  800fff:	ff d0                	call   *%rax
+  801001:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  801004:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  801008:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  80100c:	49 bf 3a 0f 80 00 00 	movabs $0x800f3a,%r15
+  801013:	00 00 00 
+				if ((sc = *s++) == 0)
+  801016:	84 c0                	test   %al,%al
+  801018:	75 14                	jne    80102e <strstr+0x6f>
+					return NULL;
+  80101a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801020:	eb ba                	jmp    800fdc <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  801022:	48 83 c3 01          	add    $0x1,%rbx
+  801026:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80102a:	84 c0                	test   %al,%al
+  80102c:	74 1b                	je     801049 <strstr+0x8a>
+			} while (sc != c);
+  80102e:	41 38 c5             	cmp    %al,%r13b
+  801031:	75 ef                	jne    801022 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  801033:	4c 89 f2             	mov    %r14,%rdx
+  801036:	4c 89 e6             	mov    %r12,%rsi
+  801039:	48 89 df             	mov    %rbx,%rdi
+  80103c:	41 ff d7             	call   *%r15
+  80103f:	85 c0                	test   %eax,%eax
+  801041:	75 df                	jne    801022 <strstr+0x63>
+  801043:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  801047:	eb 93                	jmp    800fdc <strstr+0x1d>
+					return NULL;
+  801049:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80104f:	eb 8b                	jmp    800fdc <strstr+0x1d>
+
+0000000000801051 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  801051:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  801053:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  801056:	8d 57 20             	lea    0x20(%rdi),%edx
+  801059:	83 f9 1a             	cmp    $0x1a,%ecx
+  80105c:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80105f:	c3                   	ret
+
+0000000000801060 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  801060:	55                   	push   %rbp
+  801061:	48 89 e5             	mov    %rsp,%rbp
+  801064:	41 57                	push   %r15
+  801066:	41 56                	push   %r14
+  801068:	41 55                	push   %r13
+  80106a:	41 54                	push   %r12
+  80106c:	53                   	push   %rbx
+  80106d:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  801071:	48 39 f7             	cmp    %rsi,%rdi
+  801074:	74 49                	je     8010bf <strcasecmp+0x5f>
+  801076:	49 89 fd             	mov    %rdi,%r13
+  801079:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  80107c:	49 bf 51 10 80 00 00 	movabs $0x801051,%r15
+  801083:	00 00 00 
+  801086:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  80108b:	41 0f b6 fe          	movzbl %r14b,%edi
+  80108f:	41 ff d7             	call   *%r15
+  801092:	89 c3                	mov    %eax,%ebx
+  801094:	49 83 c4 01          	add    $0x1,%r12
+  801098:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  80109e:	41 ff d7             	call   *%r15
+  8010a1:	29 c3                	sub    %eax,%ebx
+  8010a3:	75 09                	jne    8010ae <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  8010a5:	49 83 c5 01          	add    $0x1,%r13
+  8010a9:	45 84 f6             	test   %r14b,%r14b
+  8010ac:	75 d8                	jne    801086 <strcasecmp+0x26>
+}
+  8010ae:	89 d8                	mov    %ebx,%eax
+  8010b0:	48 83 c4 08          	add    $0x8,%rsp
+  8010b4:	5b                   	pop    %rbx
+  8010b5:	41 5c                	pop    %r12
+  8010b7:	41 5d                	pop    %r13
+  8010b9:	41 5e                	pop    %r14
+  8010bb:	41 5f                	pop    %r15
+  8010bd:	5d                   	pop    %rbp
+  8010be:	c3                   	ret
+        return 0;
+  8010bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c4:	eb e8                	jmp    8010ae <strcasecmp+0x4e>
+
+00000000008010c6 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8010c6:	55                   	push   %rbp
+  8010c7:	48 89 e5             	mov    %rsp,%rbp
+  8010ca:	41 57                	push   %r15
+  8010cc:	41 56                	push   %r14
+  8010ce:	41 55                	push   %r13
+  8010d0:	41 54                	push   %r12
+  8010d2:	53                   	push   %rbx
+  8010d3:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  8010d7:	48 85 d2             	test   %rdx,%rdx
+  8010da:	74 4f                	je     80112b <strncasecmp+0x65>
+  8010dc:	49 89 fc             	mov    %rdi,%r12
+  8010df:	49 89 f5             	mov    %rsi,%r13
+  8010e2:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  8010e6:	49 be 51 10 80 00 00 	movabs $0x801051,%r14
+  8010ed:	00 00 00 
+  8010f0:	49 83 c4 01          	add    $0x1,%r12
+  8010f4:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8010fa:	41 ff d6             	call   *%r14
+  8010fd:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  8010ff:	49 83 c5 01          	add    $0x1,%r13
+  801103:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801108:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  80110b:	29 c3                	sub    %eax,%ebx
+  80110d:	85 c0                	test   %eax,%eax
+  80110f:	74 09                	je     80111a <strncasecmp+0x54>
+  801111:	85 db                	test   %ebx,%ebx
+  801113:	75 05                	jne    80111a <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  801115:	4d 39 fc             	cmp    %r15,%r12
+  801118:	75 d6                	jne    8010f0 <strncasecmp+0x2a>
+}
+  80111a:	89 d8                	mov    %ebx,%eax
+  80111c:	48 83 c4 08          	add    $0x8,%rsp
+  801120:	5b                   	pop    %rbx
+  801121:	41 5c                	pop    %r12
+  801123:	41 5d                	pop    %r13
+  801125:	41 5e                	pop    %r14
+  801127:	41 5f                	pop    %r15
+  801129:	5d                   	pop    %rbp
+  80112a:	c3                   	ret
+    int d = 0;
+  80112b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  801130:	eb e8                	jmp    80111a <strncasecmp+0x54>
+
+0000000000801132 <toupper>:
+
+int toupper(int c) {
+  801132:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  801134:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801137:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80113a:	83 f9 1a             	cmp    $0x1a,%ecx
+  80113d:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801140:	c3                   	ret
+
+0000000000801141 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  801141:	83 ff 20             	cmp    $0x20,%edi
+  801144:	0f 94 c0             	sete   %al
+  801147:	0f b6 c0             	movzbl %al,%eax
+}
+  80114a:	c3                   	ret
+
+000000000080114b <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  80114b:	89 f8                	mov    %edi,%eax
+  80114d:	f7 d8                	neg    %eax
+  80114f:	0f 48 c7             	cmovs  %edi,%eax
+}
+  801152:	c3                   	ret
+
+0000000000801153 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801153:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801156:	48 89 f8             	mov    %rdi,%rax
+  801159:	48 f7 d8             	neg    %rax
+  80115c:	83 e0 07             	and    $0x7,%eax
+  80115f:	49 89 d1             	mov    %rdx,%r9
+  801162:	49 29 c1             	sub    %rax,%r9
+  801165:	78 36                	js     80119d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801167:	40 0f b6 c6          	movzbl %sil,%eax
+  80116b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801172:	01 01 01 
+  801175:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801179:	40 f6 c7 07          	test   $0x7,%dil
+  80117d:	75 38                	jne    8011b7 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80117f:	4c 89 c9             	mov    %r9,%rcx
+  801182:	48 c1 f9 03          	sar    $0x3,%rcx
+  801186:	74 0c                	je     801194 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801188:	fc                   	cld
+  801189:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80118c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801190:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801194:	4d 85 c9             	test   %r9,%r9
+  801197:	75 45                	jne    8011de <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801199:	4c 89 c0             	mov    %r8,%rax
+  80119c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80119d:	48 85 d2             	test   %rdx,%rdx
+  8011a0:	74 f7                	je     801199 <memset+0x46>
+  8011a2:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8011a5:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8011a8:	48 83 c0 01          	add    $0x1,%rax
+  8011ac:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8011b0:	48 39 c2             	cmp    %rax,%rdx
+  8011b3:	75 f3                	jne    8011a8 <memset+0x55>
+  8011b5:	eb e2                	jmp    801199 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8011b7:	40 f6 c7 01          	test   $0x1,%dil
+  8011bb:	74 06                	je     8011c3 <memset+0x70>
+  8011bd:	88 07                	mov    %al,(%rdi)
+  8011bf:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011c3:	40 f6 c7 02          	test   $0x2,%dil
+  8011c7:	74 07                	je     8011d0 <memset+0x7d>
+  8011c9:	66 89 07             	mov    %ax,(%rdi)
+  8011cc:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011d0:	40 f6 c7 04          	test   $0x4,%dil
+  8011d4:	74 a9                	je     80117f <memset+0x2c>
+  8011d6:	89 07                	mov    %eax,(%rdi)
+  8011d8:	48 83 c7 04          	add    $0x4,%rdi
+  8011dc:	eb a1                	jmp    80117f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011de:	41 f6 c1 04          	test   $0x4,%r9b
+  8011e2:	74 06                	je     8011ea <memset+0x97>
+  8011e4:	89 07                	mov    %eax,(%rdi)
+  8011e6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011ea:	41 f6 c1 02          	test   $0x2,%r9b
+  8011ee:	74 07                	je     8011f7 <memset+0xa4>
+  8011f0:	66 89 07             	mov    %ax,(%rdi)
+  8011f3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8011f7:	41 f6 c1 01          	test   $0x1,%r9b
+  8011fb:	74 9c                	je     801199 <memset+0x46>
+  8011fd:	88 07                	mov    %al,(%rdi)
+  8011ff:	eb 98                	jmp    801199 <memset+0x46>
+
+0000000000801201 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801201:	48 89 f8             	mov    %rdi,%rax
+  801204:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801207:	48 39 fe             	cmp    %rdi,%rsi
+  80120a:	73 3b                	jae    801247 <memmove+0x46>
+  80120c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801210:	48 39 d7             	cmp    %rdx,%rdi
+  801213:	73 32                	jae    801247 <memmove+0x46>
+        s += n;
+        d += n;
+  801215:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801219:	48 89 d6             	mov    %rdx,%rsi
+  80121c:	48 09 fe             	or     %rdi,%rsi
+  80121f:	48 09 ce             	or     %rcx,%rsi
+  801222:	40 f6 c6 07          	test   $0x7,%sil
+  801226:	75 12                	jne    80123a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801228:	48 83 ef 08          	sub    $0x8,%rdi
+  80122c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801230:	48 c1 e9 03          	shr    $0x3,%rcx
+  801234:	fd                   	std
+  801235:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801238:	fc                   	cld
+  801239:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80123a:	48 83 ef 01          	sub    $0x1,%rdi
+  80123e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801242:	fd                   	std
+  801243:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801245:	eb f1                	jmp    801238 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801247:	48 89 f2             	mov    %rsi,%rdx
+  80124a:	48 09 c2             	or     %rax,%rdx
+  80124d:	48 09 ca             	or     %rcx,%rdx
+  801250:	f6 c2 07             	test   $0x7,%dl
+  801253:	75 0c                	jne    801261 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801255:	48 c1 e9 03          	shr    $0x3,%rcx
+  801259:	48 89 c7             	mov    %rax,%rdi
+  80125c:	fc                   	cld
+  80125d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801260:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801261:	48 89 c7             	mov    %rax,%rdi
+  801264:	fc                   	cld
+  801265:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801267:	c3                   	ret
+
+0000000000801268 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801268:	55                   	push   %rbp
+  801269:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80126c:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  801273:	00 00 00 
+  801276:	ff d0                	call   *%rax
+}
+  801278:	5d                   	pop    %rbp
+  801279:	c3                   	ret
+
+000000000080127a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80127a:	55                   	push   %rbp
+  80127b:	48 89 e5             	mov    %rsp,%rbp
+  80127e:	41 57                	push   %r15
+  801280:	41 56                	push   %r14
+  801282:	41 55                	push   %r13
+  801284:	41 54                	push   %r12
+  801286:	53                   	push   %rbx
+  801287:	48 83 ec 08          	sub    $0x8,%rsp
+  80128b:	49 89 fe             	mov    %rdi,%r14
+  80128e:	49 89 f7             	mov    %rsi,%r15
+  801291:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801294:	48 89 f7             	mov    %rsi,%rdi
+  801297:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  80129e:	00 00 00 
+  8012a1:	ff d0                	call   *%rax
+  8012a3:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8012a6:	48 89 de             	mov    %rbx,%rsi
+  8012a9:	4c 89 f7             	mov    %r14,%rdi
+  8012ac:	48 b8 50 0e 80 00 00 	movabs $0x800e50,%rax
+  8012b3:	00 00 00 
+  8012b6:	ff d0                	call   *%rax
+  8012b8:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012bb:	48 39 c3             	cmp    %rax,%rbx
+  8012be:	74 36                	je     8012f6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8012c0:	48 89 d8             	mov    %rbx,%rax
+  8012c3:	4c 29 e8             	sub    %r13,%rax
+  8012c6:	49 39 c4             	cmp    %rax,%r12
+  8012c9:	73 31                	jae    8012fc <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8012cb:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8012d0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012d4:	4c 89 fe             	mov    %r15,%rsi
+  8012d7:	48 b8 68 12 80 00 00 	movabs $0x801268,%rax
+  8012de:	00 00 00 
+  8012e1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8012e3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8012e7:	48 83 c4 08          	add    $0x8,%rsp
+  8012eb:	5b                   	pop    %rbx
+  8012ec:	41 5c                	pop    %r12
+  8012ee:	41 5d                	pop    %r13
+  8012f0:	41 5e                	pop    %r14
+  8012f2:	41 5f                	pop    %r15
+  8012f4:	5d                   	pop    %rbp
+  8012f5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012f6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012fa:	eb eb                	jmp    8012e7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8012fc:	48 83 eb 01          	sub    $0x1,%rbx
+  801300:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801304:	48 89 da             	mov    %rbx,%rdx
+  801307:	4c 89 fe             	mov    %r15,%rsi
+  80130a:	48 b8 68 12 80 00 00 	movabs $0x801268,%rax
+  801311:	00 00 00 
+  801314:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801316:	49 01 de             	add    %rbx,%r14
+  801319:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80131e:	eb c3                	jmp    8012e3 <strlcat+0x69>
+
+0000000000801320 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801320:	48 85 d2             	test   %rdx,%rdx
+  801323:	74 2d                	je     801352 <memcmp+0x32>
+  801325:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80132a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80132e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801333:	44 38 c1             	cmp    %r8b,%cl
+  801336:	75 0f                	jne    801347 <memcmp+0x27>
+    while (n-- > 0) {
+  801338:	48 83 c0 01          	add    $0x1,%rax
+  80133c:	48 39 c2             	cmp    %rax,%rdx
+  80133f:	75 e9                	jne    80132a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801341:	b8 00 00 00 00       	mov    $0x0,%eax
+  801346:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801347:	0f b6 c1             	movzbl %cl,%eax
+  80134a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80134e:	44 29 c0             	sub    %r8d,%eax
+  801351:	c3                   	ret
+    return 0;
+  801352:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801357:	c3                   	ret
+
+0000000000801358 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801358:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80135c:	48 39 c7             	cmp    %rax,%rdi
+  80135f:	73 0f                	jae    801370 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801361:	40 38 37             	cmp    %sil,(%rdi)
+  801364:	74 0e                	je     801374 <memfind+0x1c>
+    for (; src < end; src++) {
+  801366:	48 83 c7 01          	add    $0x1,%rdi
+  80136a:	48 39 f8             	cmp    %rdi,%rax
+  80136d:	75 f2                	jne    801361 <memfind+0x9>
+  80136f:	c3                   	ret
+  801370:	48 89 f8             	mov    %rdi,%rax
+  801373:	c3                   	ret
+  801374:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801377:	c3                   	ret
+
+0000000000801378 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801378:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80137b:	0f b6 37             	movzbl (%rdi),%esi
+  80137e:	40 80 fe 20          	cmp    $0x20,%sil
+  801382:	74 06                	je     80138a <strtol+0x12>
+  801384:	40 80 fe 09          	cmp    $0x9,%sil
+  801388:	75 13                	jne    80139d <strtol+0x25>
+  80138a:	48 83 c7 01          	add    $0x1,%rdi
+  80138e:	0f b6 37             	movzbl (%rdi),%esi
+  801391:	40 80 fe 20          	cmp    $0x20,%sil
+  801395:	74 f3                	je     80138a <strtol+0x12>
+  801397:	40 80 fe 09          	cmp    $0x9,%sil
+  80139b:	74 ed                	je     80138a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80139d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8013a0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8013a3:	3c 01                	cmp    $0x1,%al
+  8013a5:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013a9:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8013af:	75 0f                	jne    8013c0 <strtol+0x48>
+  8013b1:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8013b4:	74 14                	je     8013ca <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8013b6:	85 d2                	test   %edx,%edx
+  8013b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013bd:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8013c0:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8013c5:	4c 63 ca             	movslq %edx,%r9
+  8013c8:	eb 36                	jmp    801400 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013ca:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8013ce:	74 0f                	je     8013df <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8013d0:	85 d2                	test   %edx,%edx
+  8013d2:	75 ec                	jne    8013c0 <strtol+0x48>
+        s++;
+  8013d4:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8013d8:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8013dd:	eb e1                	jmp    8013c0 <strtol+0x48>
+        s += 2;
+  8013df:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8013e3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013e8:	eb d6                	jmp    8013c0 <strtol+0x48>
+            dig -= '0';
+  8013ea:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8013ed:	44 0f b6 c1          	movzbl %cl,%r8d
+  8013f1:	41 39 d0             	cmp    %edx,%r8d
+  8013f4:	7d 21                	jge    801417 <strtol+0x9f>
+        val = val * base + dig;
+  8013f6:	49 0f af c1          	imul   %r9,%rax
+  8013fa:	0f b6 c9             	movzbl %cl,%ecx
+  8013fd:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801400:	48 83 c7 01          	add    $0x1,%rdi
+  801404:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801408:	80 f9 39             	cmp    $0x39,%cl
+  80140b:	76 dd                	jbe    8013ea <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80140d:	80 f9 7b             	cmp    $0x7b,%cl
+  801410:	77 05                	ja     801417 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801412:	83 e9 57             	sub    $0x57,%ecx
+  801415:	eb d6                	jmp    8013ed <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801417:	4d 85 d2             	test   %r10,%r10
+  80141a:	74 03                	je     80141f <strtol+0xa7>
+  80141c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80141f:	48 89 c2             	mov    %rax,%rdx
+  801422:	48 f7 da             	neg    %rdx
+  801425:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801429:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80142d:	c3                   	ret
+
+000000000080142e <atoi>:
+int atoi(const char *str) {
+  80142e:	55                   	push   %rbp
+  80142f:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801432:	ba 00 00 00 00       	mov    $0x0,%edx
+  801437:	be 00 00 00 00       	mov    $0x0,%esi
+  80143c:	48 b8 78 13 80 00 00 	movabs $0x801378,%rax
+  801443:	00 00 00 
+  801446:	ff d0                	call   *%rax
+}
+  801448:	5d                   	pop    %rbp
+  801449:	c3                   	ret
+
+000000000080144a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80144a:	55                   	push   %rbp
+  80144b:	48 89 e5             	mov    %rsp,%rbp
+  80144e:	53                   	push   %rbx
+  80144f:	48 89 fa             	mov    %rdi,%rdx
+  801452:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801455:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80145a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801464:	be 00 00 00 00       	mov    $0x0,%esi
+  801469:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801471:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801475:	c9                   	leave
+  801476:	c3                   	ret
+
+0000000000801477 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801477:	55                   	push   %rbp
+  801478:	48 89 e5             	mov    %rsp,%rbp
+  80147b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80147c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801481:	ba 00 00 00 00       	mov    $0x0,%edx
+  801486:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80148b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801490:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801495:	be 00 00 00 00       	mov    $0x0,%esi
+  80149a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a0:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a6:	c9                   	leave
+  8014a7:	c3                   	ret
+
+00000000008014a8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8014a8:	55                   	push   %rbp
+  8014a9:	48 89 e5             	mov    %rsp,%rbp
+  8014ac:	53                   	push   %rbx
+  8014ad:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8014b1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b4:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d5:	48 85 c0             	test   %rax,%rax
+  8014d8:	7f 06                	jg     8014e0 <sys_env_destroy+0x38>
+}
+  8014da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014de:	c9                   	leave
+  8014df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e0:	49 89 c0             	mov    %rax,%r8
+  8014e3:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8014e8:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8014ef:	00 00 00 
+  8014f2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014f7:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8014fe:	00 00 00 
+  801501:	b8 00 00 00 00       	mov    $0x0,%eax
+  801506:	49 b9 72 42 80 00 00 	movabs $0x804272,%r9
+  80150d:	00 00 00 
+  801510:	41 ff d1             	call   *%r9
+
+0000000000801513 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801513:	55                   	push   %rbp
+  801514:	48 89 e5             	mov    %rsp,%rbp
+  801517:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801518:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80151d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801522:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801527:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801531:	be 00 00 00 00       	mov    $0x0,%esi
+  801536:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80153e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801542:	c9                   	leave
+  801543:	c3                   	ret
+
+0000000000801544 <sys_yield>:
+
+void
+sys_yield(void) {
+  801544:	55                   	push   %rbp
+  801545:	48 89 e5             	mov    %rsp,%rbp
+  801548:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801549:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80154e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801553:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801558:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801562:	be 00 00 00 00       	mov    $0x0,%esi
+  801567:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156d:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80156f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801573:	c9                   	leave
+  801574:	c3                   	ret
+
+0000000000801575 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801575:	55                   	push   %rbp
+  801576:	48 89 e5             	mov    %rsp,%rbp
+  801579:	53                   	push   %rbx
+  80157a:	48 89 fa             	mov    %rdi,%rdx
+  80157d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801580:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801585:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80158c:	00 00 00 
+  80158f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801594:	be 00 00 00 00       	mov    $0x0,%esi
+  801599:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8015a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a5:	c9                   	leave
+  8015a6:	c3                   	ret
+
+00000000008015a7 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8015a7:	55                   	push   %rbp
+  8015a8:	48 89 e5             	mov    %rsp,%rbp
+  8015ab:	53                   	push   %rbx
+  8015ac:	49 89 f8             	mov    %rdi,%r8
+  8015af:	48 89 d3             	mov    %rdx,%rbx
+  8015b2:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ba:	4c 89 c2             	mov    %r8,%rdx
+  8015bd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015cb:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8015cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d1:	c9                   	leave
+  8015d2:	c3                   	ret
+
+00000000008015d3 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8015d3:	55                   	push   %rbp
+  8015d4:	48 89 e5             	mov    %rsp,%rbp
+  8015d7:	53                   	push   %rbx
+  8015d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8015dc:	89 f8                	mov    %edi,%eax
+  8015de:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8015e1:	48 63 f9             	movslq %ecx,%rdi
+  8015e4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e7:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ec:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fc:	48 85 c0             	test   %rax,%rax
+  8015ff:	7f 06                	jg     801607 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801601:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801605:	c9                   	leave
+  801606:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801607:	49 89 c0             	mov    %rax,%r8
+  80160a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80160f:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801616:	00 00 00 
+  801619:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80161e:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801625:	00 00 00 
+  801628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162d:	49 b9 72 42 80 00 00 	movabs $0x804272,%r9
+  801634:	00 00 00 
+  801637:	41 ff d1             	call   *%r9
+
+000000000080163a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80163a:	55                   	push   %rbp
+  80163b:	48 89 e5             	mov    %rsp,%rbp
+  80163e:	53                   	push   %rbx
+  80163f:	48 83 ec 08          	sub    $0x8,%rsp
+  801643:	89 f8                	mov    %edi,%eax
+  801645:	49 89 f2             	mov    %rsi,%r10
+  801648:	48 89 cf             	mov    %rcx,%rdi
+  80164b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80164e:	48 63 da             	movslq %edx,%rbx
+  801651:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801654:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801659:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165c:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80165f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801661:	48 85 c0             	test   %rax,%rax
+  801664:	7f 06                	jg     80166c <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801666:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166a:	c9                   	leave
+  80166b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80166c:	49 89 c0             	mov    %rax,%r8
+  80166f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801674:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80167b:	00 00 00 
+  80167e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801683:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80168a:	00 00 00 
+  80168d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801692:	49 b9 72 42 80 00 00 	movabs $0x804272,%r9
+  801699:	00 00 00 
+  80169c:	41 ff d1             	call   *%r9
+
+000000000080169f <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+  8016a3:	53                   	push   %rbx
+  8016a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a8:	49 89 f9             	mov    %rdi,%r9
+  8016ab:	89 f0                	mov    %esi,%eax
+  8016ad:	48 89 d3             	mov    %rdx,%rbx
+  8016b0:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8016b3:	49 63 f0             	movslq %r8d,%rsi
+  8016b6:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b9:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016be:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c9:	48 85 c0             	test   %rax,%rax
+  8016cc:	7f 06                	jg     8016d4 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d2:	c9                   	leave
+  8016d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d4:	49 89 c0             	mov    %rax,%r8
+  8016d7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8016dc:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8016e3:	00 00 00 
+  8016e6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016eb:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8016f2:	00 00 00 
+  8016f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fa:	49 b9 72 42 80 00 00 	movabs $0x804272,%r9
+  801701:	00 00 00 
+  801704:	41 ff d1             	call   *%r9
+
+0000000000801707 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801707:	55                   	push   %rbp
+  801708:	48 89 e5             	mov    %rsp,%rbp
+  80170b:	53                   	push   %rbx
+  80170c:	89 f8                	mov    %edi,%eax
+  80170e:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801711:	48 63 f9             	movslq %ecx,%rdi
+  801714:	48 63 da             	movslq %edx,%rbx
+  801717:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80171a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80171f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801722:	be 00 00 00 00       	mov    $0x0,%esi
+  801727:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172d:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80172f:	89 c2                	mov    %eax,%edx
+  801731:	48 85 c0             	test   %rax,%rax
+  801734:	78 0d                	js     801743 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801736:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80173b:	4d 85 c9             	test   %r9,%r9
+  80173e:	74 03                	je     801743 <sys_alloc_dma_region+0x3c>
+  801740:	49 89 01             	mov    %rax,(%r9)
+}
+  801743:	89 d0                	mov    %edx,%eax
+  801745:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801749:	c9                   	leave
+  80174a:	c3                   	ret
+
+000000000080174b <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80174b:	55                   	push   %rbp
+  80174c:	48 89 e5             	mov    %rsp,%rbp
+  80174f:	53                   	push   %rbx
+  801750:	48 83 ec 08          	sub    $0x8,%rsp
+  801754:	48 89 f1             	mov    %rsi,%rcx
+  801757:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80175a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80175d:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801762:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801767:	be 00 00 00 00       	mov    $0x0,%esi
+  80176c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801772:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801774:	48 85 c0             	test   %rax,%rax
+  801777:	7f 06                	jg     80177f <sys_set_cache_region+0x34>
+}
+  801779:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177d:	c9                   	leave
+  80177e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80177f:	49 89 c0             	mov    %rax,%r8
+  801782:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801787:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80178e:	00 00 00 
+  801791:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801796:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80179d:	00 00 00 
+  8017a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a5:	49 b9 72 42 80 00 00 	movabs $0x804272,%r9
+  8017ac:	00 00 00 
+  8017af:	41 ff d1             	call   *%r9
+
+00000000008017b2 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8017b2:	55                   	push   %rbp
+  8017b3:	48 89 e5             	mov    %rsp,%rbp
+  8017b6:	53                   	push   %rbx
+  8017b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017bb:	48 89 f1             	mov    %rsi,%rcx
+  8017be:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017c1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017c4:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017db:	48 85 c0             	test   %rax,%rax
+  8017de:	7f 06                	jg     8017e6 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8017e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e4:	c9                   	leave
+  8017e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e6:	49 89 c0             	mov    %rax,%r8
+  8017e9:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8017ee:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8017f5:	00 00 00 
+  8017f8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017fd:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801804:	00 00 00 
+  801807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180c:	49 b9 72 42 80 00 00 	movabs $0x804272,%r9
+  801813:	00 00 00 
+  801816:	41 ff d1             	call   *%r9
+
+0000000000801819 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801819:	55                   	push   %rbp
+  80181a:	48 89 e5             	mov    %rsp,%rbp
+  80181d:	53                   	push   %rbx
+  80181e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801822:	48 63 ce             	movslq %esi,%rcx
+  801825:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801828:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80182d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801832:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801837:	be 00 00 00 00       	mov    $0x0,%esi
+  80183c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801842:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801844:	48 85 c0             	test   %rax,%rax
+  801847:	7f 06                	jg     80184f <sys_env_set_status+0x36>
+}
+  801849:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80184d:	c9                   	leave
+  80184e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80184f:	49 89 c0             	mov    %rax,%r8
+  801852:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801857:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80185e:	00 00 00 
+  801861:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801866:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80186d:	00 00 00 
+  801870:	b8 00 00 00 00       	mov    $0x0,%eax
+  801875:	49 b9 72 42 80 00 00 	movabs $0x804272,%r9
+  80187c:	00 00 00 
+  80187f:	41 ff d1             	call   *%r9
+
+0000000000801882 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801882:	55                   	push   %rbp
+  801883:	48 89 e5             	mov    %rsp,%rbp
+  801886:	53                   	push   %rbx
+  801887:	48 83 ec 08          	sub    $0x8,%rsp
+  80188b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80188e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801891:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801896:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018ad:	48 85 c0             	test   %rax,%rax
+  8018b0:	7f 06                	jg     8018b8 <sys_env_set_trapframe+0x36>
+}
+  8018b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b6:	c9                   	leave
+  8018b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018b8:	49 89 c0             	mov    %rax,%r8
+  8018bb:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8018c0:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8018c7:	00 00 00 
+  8018ca:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018cf:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8018d6:	00 00 00 
+  8018d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018de:	49 b9 72 42 80 00 00 	movabs $0x804272,%r9
+  8018e5:	00 00 00 
+  8018e8:	41 ff d1             	call   *%r9
+
+00000000008018eb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8018eb:	55                   	push   %rbp
+  8018ec:	48 89 e5             	mov    %rsp,%rbp
+  8018ef:	53                   	push   %rbx
+  8018f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8018f4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8018f7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018fa:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801904:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801909:	be 00 00 00 00       	mov    $0x0,%esi
+  80190e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801914:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801916:	48 85 c0             	test   %rax,%rax
+  801919:	7f 06                	jg     801921 <sys_env_set_pgfault_upcall+0x36>
+}
+  80191b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80191f:	c9                   	leave
+  801920:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801921:	49 89 c0             	mov    %rax,%r8
+  801924:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801929:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801930:	00 00 00 
+  801933:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801938:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80193f:	00 00 00 
+  801942:	b8 00 00 00 00       	mov    $0x0,%eax
+  801947:	49 b9 72 42 80 00 00 	movabs $0x804272,%r9
+  80194e:	00 00 00 
+  801951:	41 ff d1             	call   *%r9
+
+0000000000801954 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801954:	55                   	push   %rbp
+  801955:	48 89 e5             	mov    %rsp,%rbp
+  801958:	53                   	push   %rbx
+  801959:	89 f8                	mov    %edi,%eax
+  80195b:	49 89 f1             	mov    %rsi,%r9
+  80195e:	48 89 d3             	mov    %rdx,%rbx
+  801961:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801964:	49 63 f0             	movslq %r8d,%rsi
+  801967:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80196a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80196f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801972:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801978:	cd 30                	int    $0x30
+}
+  80197a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80197e:	c9                   	leave
+  80197f:	c3                   	ret
+
+0000000000801980 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801980:	55                   	push   %rbp
+  801981:	48 89 e5             	mov    %rsp,%rbp
+  801984:	53                   	push   %rbx
+  801985:	48 83 ec 08          	sub    $0x8,%rsp
+  801989:	48 89 fa             	mov    %rdi,%rdx
+  80198c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80198f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801994:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801999:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80199e:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019ab:	48 85 c0             	test   %rax,%rax
+  8019ae:	7f 06                	jg     8019b6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019b4:	c9                   	leave
+  8019b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019b6:	49 89 c0             	mov    %rax,%r8
+  8019b9:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8019be:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8019c5:	00 00 00 
+  8019c8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019cd:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8019d4:	00 00 00 
+  8019d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019dc:	49 b9 72 42 80 00 00 	movabs $0x804272,%r9
+  8019e3:	00 00 00 
+  8019e6:	41 ff d1             	call   *%r9
+
+00000000008019e9 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8019e9:	55                   	push   %rbp
+  8019ea:	48 89 e5             	mov    %rsp,%rbp
+  8019ed:	53                   	push   %rbx
+  8019ee:	48 89 fa             	mov    %rdi,%rdx
+  8019f1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019f4:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a03:	be 00 00 00 00       	mov    $0x0,%esi
+  801a08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a0e:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a14:	c9                   	leave
+  801a15:	c3                   	ret
+
+0000000000801a16 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a16:	55                   	push   %rbp
+  801a17:	48 89 e5             	mov    %rsp,%rbp
+  801a1a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a1b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a20:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a25:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a2f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a34:	be 00 00 00 00       	mov    $0x0,%esi
+  801a39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a3f:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a45:	c9                   	leave
+  801a46:	c3                   	ret
+
+0000000000801a47 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801a47:	48 85 ff             	test   %rdi,%rdi
+  801a4a:	0f 84 b6 01 00 00    	je     801c06 <malloc+0x1bf>
+malloc(size_t size) {
+  801a50:	55                   	push   %rbp
+  801a51:	48 89 e5             	mov    %rsp,%rbp
+  801a54:	41 56                	push   %r14
+  801a56:	41 55                	push   %r13
+  801a58:	41 54                	push   %r12
+  801a5a:	53                   	push   %rbx
+  801a5b:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801a5e:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801a65:	00 00 00 
+  801a68:	4c 8b 20             	mov    (%rax),%r12
+  801a6b:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801a72:	0f 87 94 01 00 00    	ja     801c0c <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801a78:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801a7f:	00 00 00 
+  801a82:	48 85 c0             	test   %rax,%rax
+  801a85:	74 6b                	je     801af2 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801a87:	4d 85 e4             	test   %r12,%r12
+  801a8a:	74 66                	je     801af2 <malloc+0xab>
+  801a8c:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801a93:	00 00 00 
+  801a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a9b:	eb 0d                	jmp    801aaa <malloc+0x63>
+  801a9d:	48 83 c1 01          	add    $0x1,%rcx
+  801aa1:	48 83 c2 18          	add    $0x18,%rdx
+  801aa5:	49 39 cc             	cmp    %rcx,%r12
+  801aa8:	74 48                	je     801af2 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801aaa:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801aaf:	74 ec                	je     801a9d <malloc+0x56>
+  801ab1:	48 39 1a             	cmp    %rbx,(%rdx)
+  801ab4:	72 e7                	jb     801a9d <malloc+0x56>
+                real_freep_size--;
+  801ab6:	48 83 e8 01          	sub    $0x1,%rax
+  801aba:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801ac1:	00 00 00 
+                freep[i].is_free = false;
+  801ac4:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801acb:	00 00 00 
+  801ace:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801ad2:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801ad6:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801ada:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801ae1:	00 
+                freep[i].size = size;
+  801ae2:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801ae6:	48 01 c8             	add    %rcx,%rax
+  801ae9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801aed:	e9 0b 01 00 00       	jmp    801bfd <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801af2:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801af9:	00 00 00 
+  801afc:	48 01 d8             	add    %rbx,%rax
+  801aff:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801b05:	76 7c                	jbe    801b83 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801b07:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801b0e:	00 00 00 
+  801b11:	4c 8b 30             	mov    (%rax),%r14
+  801b14:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801b1b:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801b1e:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801b25:	00 00 00 
+  801b28:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801b2f:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801b36:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801b3c:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801b40:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  801b47:	00 00 00 
+  801b4a:	ff d0                	call   *%rax
+  801b4c:	89 c7                	mov    %eax,%edi
+  801b4e:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801b55:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801b5c:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801b63:	00 00 00 
+  801b66:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801b6a:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801b6f:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  801b76:	00 00 00 
+  801b79:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801b7b:	85 c0                	test   %eax,%eax
+  801b7d:	0f 88 90 00 00 00    	js     801c13 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801b83:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801b8a:	00 00 00 
+  801b8d:	48 8b 31             	mov    (%rcx),%rsi
+  801b90:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801b97:	00 00 00 
+  801b9a:	4c 8b 07             	mov    (%rdi),%r8
+  801b9d:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801ba1:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801ba8:	00 00 00 
+  801bab:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801baf:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801bb3:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801bba:	00 00 00 
+  801bbd:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801bc1:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801bc4:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801bc8:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801bcf:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801bd0:	48 89 d8             	mov    %rbx,%rax
+  801bd3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801bd8:	4c 01 c0             	add    %r8,%rax
+  801bdb:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801bde:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801be5:	48 01 f3             	add    %rsi,%rbx
+  801be8:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801beb:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801bf0:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801bf7:	00 00 00 
+  801bfa:	48 89 d0             	mov    %rdx,%rax
+}
+  801bfd:	5b                   	pop    %rbx
+  801bfe:	41 5c                	pop    %r12
+  801c00:	41 5d                	pop    %r13
+  801c02:	41 5e                	pop    %r14
+  801c04:	5d                   	pop    %rbp
+  801c05:	c3                   	ret
+        return NULL;
+  801c06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c0b:	c3                   	ret
+        return NULL;
+  801c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c11:	eb ea                	jmp    801bfd <malloc+0x1b6>
+            return NULL;
+  801c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c18:	eb e3                	jmp    801bfd <malloc+0x1b6>
+
+0000000000801c1a <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801c1a:	55                   	push   %rbp
+  801c1b:	48 89 e5             	mov    %rsp,%rbp
+  801c1e:	53                   	push   %rbx
+  801c1f:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801c23:	48 89 fb             	mov    %rdi,%rbx
+  801c26:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801c2a:	48 89 df             	mov    %rbx,%rdi
+  801c2d:	48 b8 47 1a 80 00 00 	movabs $0x801a47,%rax
+  801c34:	00 00 00 
+  801c37:	ff d0                	call   *%rax
+  801c39:	48 89 c7             	mov    %rax,%rdi
+  801c3c:	48 89 da             	mov    %rbx,%rdx
+  801c3f:	be 00 00 00 00       	mov    $0x0,%esi
+  801c44:	48 b8 53 11 80 00 00 	movabs $0x801153,%rax
+  801c4b:	00 00 00 
+  801c4e:	ff d0                	call   *%rax
+}
+  801c50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c54:	c9                   	leave
+  801c55:	c3                   	ret
+
+0000000000801c56 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801c56:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801c5d:	00 00 00 
+  801c60:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801c67:	00 00 00 
+  801c6a:	48 3b 02             	cmp    (%rdx),%rax
+  801c6d:	74 4d                	je     801cbc <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801c6f:	48 85 c0             	test   %rax,%rax
+  801c72:	74 4d                	je     801cc1 <get_allocsize+0x6b>
+  801c74:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801c7b:	00 00 00 
+  801c7e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801c83:	48 3b 39             	cmp    (%rcx),%rdi
+  801c86:	74 13                	je     801c9b <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801c88:	48 83 c2 01          	add    $0x1,%rdx
+  801c8c:	48 83 c1 18          	add    $0x18,%rcx
+  801c90:	48 39 d0             	cmp    %rdx,%rax
+  801c93:	75 ee                	jne    801c83 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801c95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9a:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801c9b:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca4:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801cab:	00 00 00 
+  801cae:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801cb4:	75 0b                	jne    801cc1 <get_allocsize+0x6b>
+  801cb6:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801cbb:	c3                   	ret
+        return 0;
+  801cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cc1:	c3                   	ret
+
+0000000000801cc2 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801cc2:	48 85 ff             	test   %rdi,%rdi
+  801cc5:	0f 84 01 01 00 00    	je     801dcc <free+0x10a>
+free(void *ptr) {
+  801ccb:	55                   	push   %rbp
+  801ccc:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801ccf:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801cd6:	00 00 00 
+  801cd9:	48 8b 30             	mov    (%rax),%rsi
+  801cdc:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801ce3:	00 00 00 
+  801ce6:	48 39 c6             	cmp    %rax,%rsi
+  801ce9:	74 50                	je     801d3b <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801ceb:	48 85 f6             	test   %rsi,%rsi
+  801cee:	74 21                	je     801d11 <free+0x4f>
+  801cf0:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801cf7:	00 00 00 
+  801cfa:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801cff:	48 3b 39             	cmp    (%rcx),%rdi
+  801d02:	74 61                	je     801d65 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801d04:	48 83 c2 01          	add    $0x1,%rdx
+  801d08:	48 83 c1 18          	add    $0x18,%rcx
+  801d0c:	48 39 d6             	cmp    %rdx,%rsi
+  801d0f:	75 ee                	jne    801cff <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801d11:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  801d18:	00 00 00 
+  801d1b:	be 12 01 00 00       	mov    $0x112,%esi
+  801d20:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801d27:	00 00 00 
+  801d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2f:	48 b9 72 42 80 00 00 	movabs $0x804272,%rcx
+  801d36:	00 00 00 
+  801d39:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801d3b:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801d42:	00 00 00 
+  801d45:	be 06 01 00 00       	mov    $0x106,%esi
+  801d4a:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801d51:	00 00 00 
+  801d54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d59:	48 b9 72 42 80 00 00 	movabs $0x804272,%rcx
+  801d60:	00 00 00 
+  801d63:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801d65:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d69:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801d70:	00 00 00 
+  801d73:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801d79:	75 27                	jne    801da2 <free+0xe0>
+            freep[i].is_free = true;
+  801d7b:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d7f:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801d86:	00 00 00 
+  801d89:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801d90:	00 00 
+            real_freep_size++;
+  801d92:	48 83 c0 01          	add    $0x1,%rax
+  801d96:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801d9d:	00 00 00 
+}
+  801da0:	5d                   	pop    %rbp
+  801da1:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801da2:	48 ba a8 55 80 00 00 	movabs $0x8055a8,%rdx
+  801da9:	00 00 00 
+  801dac:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801db1:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801db8:	00 00 00 
+  801dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc0:	48 b9 72 42 80 00 00 	movabs $0x804272,%rcx
+  801dc7:	00 00 00 
+  801dca:	ff d1                	call   *%rcx
+  801dcc:	c3                   	ret
+
+0000000000801dcd <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801dcd:	55                   	push   %rbp
+  801dce:	48 89 e5             	mov    %rsp,%rbp
+  801dd1:	41 55                	push   %r13
+  801dd3:	41 54                	push   %r12
+  801dd5:	53                   	push   %rbx
+  801dd6:	48 83 ec 08          	sub    $0x8,%rsp
+  801dda:	48 89 fb             	mov    %rdi,%rbx
+  801ddd:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801de0:	48 b8 56 1c 80 00 00 	movabs $0x801c56,%rax
+  801de7:	00 00 00 
+  801dea:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801dec:	49 39 c5             	cmp    %rax,%r13
+  801def:	73 0e                	jae    801dff <realloc+0x32>
+}
+  801df1:	48 89 d8             	mov    %rbx,%rax
+  801df4:	48 83 c4 08          	add    $0x8,%rsp
+  801df8:	5b                   	pop    %rbx
+  801df9:	41 5c                	pop    %r12
+  801dfb:	41 5d                	pop    %r13
+  801dfd:	5d                   	pop    %rbp
+  801dfe:	c3                   	ret
+  801dff:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801e02:	4c 89 ef             	mov    %r13,%rdi
+  801e05:	48 b8 47 1a 80 00 00 	movabs $0x801a47,%rax
+  801e0c:	00 00 00 
+  801e0f:	ff d0                	call   *%rax
+  801e11:	48 89 c7             	mov    %rax,%rdi
+  801e14:	4c 89 e2             	mov    %r12,%rdx
+  801e17:	48 89 de             	mov    %rbx,%rsi
+  801e1a:	48 b8 68 12 80 00 00 	movabs $0x801268,%rax
+  801e21:	00 00 00 
+  801e24:	ff d0                	call   *%rax
+  801e26:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801e29:	48 89 df             	mov    %rbx,%rdi
+  801e2c:	48 b8 c2 1c 80 00 00 	movabs $0x801cc2,%rax
+  801e33:	00 00 00 
+  801e36:	ff d0                	call   *%rax
+    return newptr;
+  801e38:	4c 89 e3             	mov    %r12,%rbx
+  801e3b:	eb b4                	jmp    801df1 <realloc+0x24>
+
+0000000000801e3d <strdup>:
+
+char*
+strdup (const char *src) {
+  801e3d:	55                   	push   %rbp
+  801e3e:	48 89 e5             	mov    %rsp,%rbp
+  801e41:	41 54                	push   %r12
+  801e43:	53                   	push   %rbx
+  801e44:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801e47:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  801e4e:	00 00 00 
+  801e51:	ff d0                	call   *%rax
+  801e53:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801e57:	4c 89 e7             	mov    %r12,%rdi
+  801e5a:	48 b8 47 1a 80 00 00 	movabs $0x801a47,%rax
+  801e61:	00 00 00 
+  801e64:	ff d0                	call   *%rax
+  801e66:	48 89 c7             	mov    %rax,%rdi
+  801e69:	4c 89 e2             	mov    %r12,%rdx
+  801e6c:	48 89 de             	mov    %rbx,%rsi
+  801e6f:	48 b8 68 12 80 00 00 	movabs $0x801268,%rax
+  801e76:	00 00 00 
+  801e79:	ff d0                	call   *%rax
+}
+  801e7b:	5b                   	pop    %rbx
+  801e7c:	41 5c                	pop    %r12
+  801e7e:	5d                   	pop    %rbp
+  801e7f:	c3                   	ret
+
+0000000000801e80 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801e80:	55                   	push   %rbp
+  801e81:	48 89 e5             	mov    %rsp,%rbp
+  801e84:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e85:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e99:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e9e:	be 00 00 00 00       	mov    $0x0,%esi
+  801ea3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ea9:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801eab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eaf:	c9                   	leave
+  801eb0:	c3                   	ret
+
+0000000000801eb1 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801eb1:	55                   	push   %rbp
+  801eb2:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801eb5:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801ebc:	00 00 00 
+  801ebf:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801ec3:	74 26                	je     801eeb <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801ec5:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801ec7:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ecb:	89 c0                	mov    %eax,%eax
+  801ecd:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801ed0:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801ed7:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801ede:	00 00 00 
+  801ee1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee6:	48 f7 31             	divq   (%rcx)
+}
+  801ee9:	5d                   	pop    %rbp
+  801eea:	c3                   	ret
+        freq = get_cpufreq();
+  801eeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef0:	48 ba 80 1e 80 00 00 	movabs $0x801e80,%rdx
+  801ef7:	00 00 00 
+  801efa:	ff d2                	call   *%rdx
+  801efc:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801f03:	00 00 00 
+  801f06:	eb bd                	jmp    801ec5 <get_ticks+0x14>
+
+0000000000801f08 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801f08:	55                   	push   %rbp
+  801f09:	48 89 e5             	mov    %rsp,%rbp
+  801f0c:	53                   	push   %rbx
+  801f0d:	48 83 ec 08          	sub    $0x8,%rsp
+  801f11:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801f14:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801f1b:	00 00 00 
+  801f1e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801f22:	74 50                	je     801f74 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801f24:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f26:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f2a:	89 c0                	mov    %eax,%eax
+  801f2c:	48 89 d6             	mov    %rdx,%rsi
+  801f2f:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801f32:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801f39:	00 00 00 
+  801f3c:	48 0f af 18          	imul   (%rax),%rbx
+  801f40:	48 c1 eb 03          	shr    $0x3,%rbx
+  801f44:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801f4b:	9b c4 20 
+  801f4e:	48 89 d8             	mov    %rbx,%rax
+  801f51:	48 f7 e2             	mul    %rdx
+  801f54:	48 89 d1             	mov    %rdx,%rcx
+  801f57:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801f5b:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f5d:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f61:	89 c0                	mov    %eax,%eax
+  801f63:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801f66:	48 29 f2             	sub    %rsi,%rdx
+  801f69:	48 39 ca             	cmp    %rcx,%rdx
+  801f6c:	72 ed                	jb     801f5b <sleep+0x53>
+}
+  801f6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f72:	c9                   	leave
+  801f73:	c3                   	ret
+        freq = get_cpufreq();
+  801f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f79:	48 ba 80 1e 80 00 00 	movabs $0x801e80,%rdx
+  801f80:	00 00 00 
+  801f83:	ff d2                	call   *%rdx
+  801f85:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801f8c:	00 00 00 
+  801f8f:	eb 93                	jmp    801f24 <sleep+0x1c>
+
+0000000000801f91 <poll_kbd>:
+
+int poll_kbd() {
+  801f91:	55                   	push   %rbp
+  801f92:	48 89 e5             	mov    %rsp,%rbp
+  801f95:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f96:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fa5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801faa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801faf:	be 00 00 00 00       	mov    $0x0,%esi
+  801fb4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fba:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801fbc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fc0:	c9                   	leave
+  801fc1:	c3                   	ret
+
+0000000000801fc2 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801fc2:	55                   	push   %rbp
+  801fc3:	48 89 e5             	mov    %rsp,%rbp
+  801fc6:	53                   	push   %rbx
+  801fc7:	49 89 fa             	mov    %rdi,%r10
+  801fca:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801fcc:	44 89 c6             	mov    %r8d,%esi
+  801fcf:	89 cf                	mov    %ecx,%edi
+  801fd1:	89 d3                	mov    %edx,%ebx
+  801fd3:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801fd5:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fda:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fdd:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801fe1:	cd 30                	int    $0x30
+  801fe3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fe7:	c9                   	leave
+  801fe8:	c3                   	ret
+
+0000000000801fe9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801fe9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ff0:	ff ff ff 
+  801ff3:	48 01 f8             	add    %rdi,%rax
+  801ff6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ffa:	c3                   	ret
+
+0000000000801ffb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ffb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802002:	ff ff ff 
+  802005:	48 01 f8             	add    %rdi,%rax
+  802008:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80200c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802012:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802016:	c3                   	ret
+
+0000000000802017 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802017:	55                   	push   %rbp
+  802018:	48 89 e5             	mov    %rsp,%rbp
+  80201b:	41 57                	push   %r15
+  80201d:	41 56                	push   %r14
+  80201f:	41 55                	push   %r13
+  802021:	41 54                	push   %r12
+  802023:	53                   	push   %rbx
+  802024:	48 83 ec 08          	sub    $0x8,%rsp
+  802028:	49 89 ff             	mov    %rdi,%r15
+  80202b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802030:	49 bd cb 3e 80 00 00 	movabs $0x803ecb,%r13
+  802037:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80203a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802040:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802043:	48 89 df             	mov    %rbx,%rdi
+  802046:	41 ff d5             	call   *%r13
+  802049:	83 e0 04             	and    $0x4,%eax
+  80204c:	74 17                	je     802065 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80204e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802055:	4c 39 f3             	cmp    %r14,%rbx
+  802058:	75 e6                	jne    802040 <fd_alloc+0x29>
+  80205a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802060:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802065:	4d 89 27             	mov    %r12,(%r15)
+}
+  802068:	48 83 c4 08          	add    $0x8,%rsp
+  80206c:	5b                   	pop    %rbx
+  80206d:	41 5c                	pop    %r12
+  80206f:	41 5d                	pop    %r13
+  802071:	41 5e                	pop    %r14
+  802073:	41 5f                	pop    %r15
+  802075:	5d                   	pop    %rbp
+  802076:	c3                   	ret
+
+0000000000802077 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802077:	83 ff 1f             	cmp    $0x1f,%edi
+  80207a:	77 39                	ja     8020b5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80207c:	55                   	push   %rbp
+  80207d:	48 89 e5             	mov    %rsp,%rbp
+  802080:	41 54                	push   %r12
+  802082:	53                   	push   %rbx
+  802083:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802086:	48 63 df             	movslq %edi,%rbx
+  802089:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802090:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802094:	48 89 df             	mov    %rbx,%rdi
+  802097:	48 b8 cb 3e 80 00 00 	movabs $0x803ecb,%rax
+  80209e:	00 00 00 
+  8020a1:	ff d0                	call   *%rax
+  8020a3:	a8 04                	test   $0x4,%al
+  8020a5:	74 14                	je     8020bb <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8020a7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8020ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020b0:	5b                   	pop    %rbx
+  8020b1:	41 5c                	pop    %r12
+  8020b3:	5d                   	pop    %rbp
+  8020b4:	c3                   	ret
+        return -E_INVAL;
+  8020b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8020ba:	c3                   	ret
+        return -E_INVAL;
+  8020bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020c0:	eb ee                	jmp    8020b0 <fd_lookup+0x39>
+
+00000000008020c2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8020c2:	55                   	push   %rbp
+  8020c3:	48 89 e5             	mov    %rsp,%rbp
+  8020c6:	41 54                	push   %r12
+  8020c8:	53                   	push   %rbx
+  8020c9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8020cc:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  8020d3:	00 00 00 
+  8020d6:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8020dd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8020e0:	39 3b                	cmp    %edi,(%rbx)
+  8020e2:	74 47                	je     80212b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8020e4:	48 83 c0 08          	add    $0x8,%rax
+  8020e8:	48 8b 18             	mov    (%rax),%rbx
+  8020eb:	48 85 db             	test   %rbx,%rbx
+  8020ee:	75 f0                	jne    8020e0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8020f0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020f7:	00 00 00 
+  8020fa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802100:	89 fa                	mov    %edi,%edx
+  802102:	48 bf 08 56 80 00 00 	movabs $0x805608,%rdi
+  802109:	00 00 00 
+  80210c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802111:	48 b9 fb 04 80 00 00 	movabs $0x8004fb,%rcx
+  802118:	00 00 00 
+  80211b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80211d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802122:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802126:	5b                   	pop    %rbx
+  802127:	41 5c                	pop    %r12
+  802129:	5d                   	pop    %rbp
+  80212a:	c3                   	ret
+            return 0;
+  80212b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802130:	eb f0                	jmp    802122 <dev_lookup+0x60>
+
+0000000000802132 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802132:	55                   	push   %rbp
+  802133:	48 89 e5             	mov    %rsp,%rbp
+  802136:	41 55                	push   %r13
+  802138:	41 54                	push   %r12
+  80213a:	53                   	push   %rbx
+  80213b:	48 83 ec 18          	sub    $0x18,%rsp
+  80213f:	48 89 fb             	mov    %rdi,%rbx
+  802142:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802145:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80214c:	ff ff ff 
+  80214f:	48 01 df             	add    %rbx,%rdi
+  802152:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802156:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80215a:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  802161:	00 00 00 
+  802164:	ff d0                	call   *%rax
+  802166:	41 89 c5             	mov    %eax,%r13d
+  802169:	85 c0                	test   %eax,%eax
+  80216b:	78 06                	js     802173 <fd_close+0x41>
+  80216d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802171:	74 1a                	je     80218d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802173:	45 84 e4             	test   %r12b,%r12b
+  802176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80217f:	44 89 e8             	mov    %r13d,%eax
+  802182:	48 83 c4 18          	add    $0x18,%rsp
+  802186:	5b                   	pop    %rbx
+  802187:	41 5c                	pop    %r12
+  802189:	41 5d                	pop    %r13
+  80218b:	5d                   	pop    %rbp
+  80218c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80218d:	8b 3b                	mov    (%rbx),%edi
+  80218f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802193:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  80219a:	00 00 00 
+  80219d:	ff d0                	call   *%rax
+  80219f:	41 89 c5             	mov    %eax,%r13d
+  8021a2:	85 c0                	test   %eax,%eax
+  8021a4:	78 1b                	js     8021c1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8021a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021aa:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8021ae:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8021b4:	48 85 c0             	test   %rax,%rax
+  8021b7:	74 08                	je     8021c1 <fd_close+0x8f>
+  8021b9:	48 89 df             	mov    %rbx,%rdi
+  8021bc:	ff d0                	call   *%rax
+  8021be:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8021c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021c6:	48 89 de             	mov    %rbx,%rsi
+  8021c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021ce:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  8021d5:	00 00 00 
+  8021d8:	ff d0                	call   *%rax
+    return res;
+  8021da:	eb a3                	jmp    80217f <fd_close+0x4d>
+
+00000000008021dc <close>:
+
+int
+close(int fdnum) {
+  8021dc:	55                   	push   %rbp
+  8021dd:	48 89 e5             	mov    %rsp,%rbp
+  8021e0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8021e4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021e8:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  8021ef:	00 00 00 
+  8021f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	78 15                	js     80220d <close+0x31>
+
+    return fd_close(fd, 1);
+  8021f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8021fd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802201:	48 b8 32 21 80 00 00 	movabs $0x802132,%rax
+  802208:	00 00 00 
+  80220b:	ff d0                	call   *%rax
+}
+  80220d:	c9                   	leave
+  80220e:	c3                   	ret
+
+000000000080220f <close_all>:
+
+void
+close_all(void) {
+  80220f:	55                   	push   %rbp
+  802210:	48 89 e5             	mov    %rsp,%rbp
+  802213:	41 54                	push   %r12
+  802215:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802216:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80221b:	49 bc dc 21 80 00 00 	movabs $0x8021dc,%r12
+  802222:	00 00 00 
+  802225:	89 df                	mov    %ebx,%edi
+  802227:	41 ff d4             	call   *%r12
+  80222a:	83 c3 01             	add    $0x1,%ebx
+  80222d:	83 fb 20             	cmp    $0x20,%ebx
+  802230:	75 f3                	jne    802225 <close_all+0x16>
+}
+  802232:	5b                   	pop    %rbx
+  802233:	41 5c                	pop    %r12
+  802235:	5d                   	pop    %rbp
+  802236:	c3                   	ret
+
+0000000000802237 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802237:	55                   	push   %rbp
+  802238:	48 89 e5             	mov    %rsp,%rbp
+  80223b:	41 57                	push   %r15
+  80223d:	41 56                	push   %r14
+  80223f:	41 55                	push   %r13
+  802241:	41 54                	push   %r12
+  802243:	53                   	push   %rbx
+  802244:	48 83 ec 18          	sub    $0x18,%rsp
+  802248:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80224b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80224f:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  802256:	00 00 00 
+  802259:	ff d0                	call   *%rax
+  80225b:	89 c3                	mov    %eax,%ebx
+  80225d:	85 c0                	test   %eax,%eax
+  80225f:	0f 88 b8 00 00 00    	js     80231d <dup+0xe6>
+    close(newfdnum);
+  802265:	44 89 e7             	mov    %r12d,%edi
+  802268:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  80226f:	00 00 00 
+  802272:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802274:	4d 63 ec             	movslq %r12d,%r13
+  802277:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80227e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802282:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802286:	4c 89 ff             	mov    %r15,%rdi
+  802289:	49 be fb 1f 80 00 00 	movabs $0x801ffb,%r14
+  802290:	00 00 00 
+  802293:	41 ff d6             	call   *%r14
+  802296:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802299:	4c 89 ef             	mov    %r13,%rdi
+  80229c:	41 ff d6             	call   *%r14
+  80229f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8022a2:	48 89 df             	mov    %rbx,%rdi
+  8022a5:	48 b8 cb 3e 80 00 00 	movabs $0x803ecb,%rax
+  8022ac:	00 00 00 
+  8022af:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8022b1:	a8 04                	test   $0x4,%al
+  8022b3:	74 2b                	je     8022e0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8022b5:	41 89 c1             	mov    %eax,%r9d
+  8022b8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8022be:	4c 89 f1             	mov    %r14,%rcx
+  8022c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c6:	48 89 de             	mov    %rbx,%rsi
+  8022c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ce:	48 b8 3a 16 80 00 00 	movabs $0x80163a,%rax
+  8022d5:	00 00 00 
+  8022d8:	ff d0                	call   *%rax
+  8022da:	89 c3                	mov    %eax,%ebx
+  8022dc:	85 c0                	test   %eax,%eax
+  8022de:	78 4e                	js     80232e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8022e0:	4c 89 ff             	mov    %r15,%rdi
+  8022e3:	48 b8 cb 3e 80 00 00 	movabs $0x803ecb,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+  8022ef:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8022f2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8022f8:	4c 89 e9             	mov    %r13,%rcx
+  8022fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802300:	4c 89 fe             	mov    %r15,%rsi
+  802303:	bf 00 00 00 00       	mov    $0x0,%edi
+  802308:	48 b8 3a 16 80 00 00 	movabs $0x80163a,%rax
+  80230f:	00 00 00 
+  802312:	ff d0                	call   *%rax
+  802314:	89 c3                	mov    %eax,%ebx
+  802316:	85 c0                	test   %eax,%eax
+  802318:	78 14                	js     80232e <dup+0xf7>
+
+    return newfdnum;
+  80231a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80231d:	89 d8                	mov    %ebx,%eax
+  80231f:	48 83 c4 18          	add    $0x18,%rsp
+  802323:	5b                   	pop    %rbx
+  802324:	41 5c                	pop    %r12
+  802326:	41 5d                	pop    %r13
+  802328:	41 5e                	pop    %r14
+  80232a:	41 5f                	pop    %r15
+  80232c:	5d                   	pop    %rbp
+  80232d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80232e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802333:	4c 89 ee             	mov    %r13,%rsi
+  802336:	bf 00 00 00 00       	mov    $0x0,%edi
+  80233b:	49 bc b2 17 80 00 00 	movabs $0x8017b2,%r12
+  802342:	00 00 00 
+  802345:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802348:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80234d:	4c 89 f6             	mov    %r14,%rsi
+  802350:	bf 00 00 00 00       	mov    $0x0,%edi
+  802355:	41 ff d4             	call   *%r12
+    return res;
+  802358:	eb c3                	jmp    80231d <dup+0xe6>
+
+000000000080235a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80235a:	55                   	push   %rbp
+  80235b:	48 89 e5             	mov    %rsp,%rbp
+  80235e:	41 56                	push   %r14
+  802360:	41 55                	push   %r13
+  802362:	41 54                	push   %r12
+  802364:	53                   	push   %rbx
+  802365:	48 83 ec 10          	sub    $0x10,%rsp
+  802369:	89 fb                	mov    %edi,%ebx
+  80236b:	49 89 f4             	mov    %rsi,%r12
+  80236e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802371:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802375:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  80237c:	00 00 00 
+  80237f:	ff d0                	call   *%rax
+  802381:	85 c0                	test   %eax,%eax
+  802383:	78 4c                	js     8023d1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802385:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802389:	41 8b 3e             	mov    (%r14),%edi
+  80238c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802390:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  802397:	00 00 00 
+  80239a:	ff d0                	call   *%rax
+  80239c:	85 c0                	test   %eax,%eax
+  80239e:	78 35                	js     8023d5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8023a0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8023a4:	83 e0 03             	and    $0x3,%eax
+  8023a7:	83 f8 01             	cmp    $0x1,%eax
+  8023aa:	74 2d                	je     8023d9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8023ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023b0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8023b4:	48 85 c0             	test   %rax,%rax
+  8023b7:	74 56                	je     80240f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8023b9:	4c 89 ea             	mov    %r13,%rdx
+  8023bc:	4c 89 e6             	mov    %r12,%rsi
+  8023bf:	4c 89 f7             	mov    %r14,%rdi
+  8023c2:	ff d0                	call   *%rax
+}
+  8023c4:	48 83 c4 10          	add    $0x10,%rsp
+  8023c8:	5b                   	pop    %rbx
+  8023c9:	41 5c                	pop    %r12
+  8023cb:	41 5d                	pop    %r13
+  8023cd:	41 5e                	pop    %r14
+  8023cf:	5d                   	pop    %rbp
+  8023d0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023d1:	48 98                	cltq
+  8023d3:	eb ef                	jmp    8023c4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023d5:	48 98                	cltq
+  8023d7:	eb eb                	jmp    8023c4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023d9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8023e0:	00 00 00 
+  8023e3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023e9:	89 da                	mov    %ebx,%edx
+  8023eb:	48 bf 49 56 80 00 00 	movabs $0x805649,%rdi
+  8023f2:	00 00 00 
+  8023f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fa:	48 b9 fb 04 80 00 00 	movabs $0x8004fb,%rcx
+  802401:	00 00 00 
+  802404:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802406:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80240d:	eb b5                	jmp    8023c4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80240f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802416:	eb ac                	jmp    8023c4 <read+0x6a>
+
+0000000000802418 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802418:	55                   	push   %rbp
+  802419:	48 89 e5             	mov    %rsp,%rbp
+  80241c:	41 57                	push   %r15
+  80241e:	41 56                	push   %r14
+  802420:	41 55                	push   %r13
+  802422:	41 54                	push   %r12
+  802424:	53                   	push   %rbx
+  802425:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802429:	48 85 d2             	test   %rdx,%rdx
+  80242c:	74 54                	je     802482 <readn+0x6a>
+  80242e:	41 89 fd             	mov    %edi,%r13d
+  802431:	49 89 f6             	mov    %rsi,%r14
+  802434:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802437:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80243c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802441:	49 bf 5a 23 80 00 00 	movabs $0x80235a,%r15
+  802448:	00 00 00 
+  80244b:	4c 89 e2             	mov    %r12,%rdx
+  80244e:	48 29 f2             	sub    %rsi,%rdx
+  802451:	4c 01 f6             	add    %r14,%rsi
+  802454:	44 89 ef             	mov    %r13d,%edi
+  802457:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80245a:	85 c0                	test   %eax,%eax
+  80245c:	78 20                	js     80247e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80245e:	01 c3                	add    %eax,%ebx
+  802460:	85 c0                	test   %eax,%eax
+  802462:	74 08                	je     80246c <readn+0x54>
+  802464:	48 63 f3             	movslq %ebx,%rsi
+  802467:	4c 39 e6             	cmp    %r12,%rsi
+  80246a:	72 df                	jb     80244b <readn+0x33>
+    }
+    return res;
+  80246c:	48 63 c3             	movslq %ebx,%rax
+}
+  80246f:	48 83 c4 08          	add    $0x8,%rsp
+  802473:	5b                   	pop    %rbx
+  802474:	41 5c                	pop    %r12
+  802476:	41 5d                	pop    %r13
+  802478:	41 5e                	pop    %r14
+  80247a:	41 5f                	pop    %r15
+  80247c:	5d                   	pop    %rbp
+  80247d:	c3                   	ret
+        if (inc < 0) return inc;
+  80247e:	48 98                	cltq
+  802480:	eb ed                	jmp    80246f <readn+0x57>
+    int inc = 1, res = 0;
+  802482:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802487:	eb e3                	jmp    80246c <readn+0x54>
+
+0000000000802489 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802489:	55                   	push   %rbp
+  80248a:	48 89 e5             	mov    %rsp,%rbp
+  80248d:	41 56                	push   %r14
+  80248f:	41 55                	push   %r13
+  802491:	41 54                	push   %r12
+  802493:	53                   	push   %rbx
+  802494:	48 83 ec 10          	sub    $0x10,%rsp
+  802498:	89 fb                	mov    %edi,%ebx
+  80249a:	49 89 f4             	mov    %rsi,%r12
+  80249d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024a0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024a4:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  8024ab:	00 00 00 
+  8024ae:	ff d0                	call   *%rax
+  8024b0:	85 c0                	test   %eax,%eax
+  8024b2:	78 47                	js     8024fb <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024b4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8024b8:	41 8b 3e             	mov    (%r14),%edi
+  8024bb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024bf:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  8024c6:	00 00 00 
+  8024c9:	ff d0                	call   *%rax
+  8024cb:	85 c0                	test   %eax,%eax
+  8024cd:	78 30                	js     8024ff <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024cf:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8024d4:	74 2d                	je     802503 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8024d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024da:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8024de:	48 85 c0             	test   %rax,%rax
+  8024e1:	74 56                	je     802539 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8024e3:	4c 89 ea             	mov    %r13,%rdx
+  8024e6:	4c 89 e6             	mov    %r12,%rsi
+  8024e9:	4c 89 f7             	mov    %r14,%rdi
+  8024ec:	ff d0                	call   *%rax
+}
+  8024ee:	48 83 c4 10          	add    $0x10,%rsp
+  8024f2:	5b                   	pop    %rbx
+  8024f3:	41 5c                	pop    %r12
+  8024f5:	41 5d                	pop    %r13
+  8024f7:	41 5e                	pop    %r14
+  8024f9:	5d                   	pop    %rbp
+  8024fa:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024fb:	48 98                	cltq
+  8024fd:	eb ef                	jmp    8024ee <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024ff:	48 98                	cltq
+  802501:	eb eb                	jmp    8024ee <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802503:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80250a:	00 00 00 
+  80250d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802513:	89 da                	mov    %ebx,%edx
+  802515:	48 bf 65 56 80 00 00 	movabs $0x805665,%rdi
+  80251c:	00 00 00 
+  80251f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802524:	48 b9 fb 04 80 00 00 	movabs $0x8004fb,%rcx
+  80252b:	00 00 00 
+  80252e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802530:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802537:	eb b5                	jmp    8024ee <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802539:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802540:	eb ac                	jmp    8024ee <write+0x65>
+
+0000000000802542 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802542:	55                   	push   %rbp
+  802543:	48 89 e5             	mov    %rsp,%rbp
+  802546:	53                   	push   %rbx
+  802547:	48 83 ec 18          	sub    $0x18,%rsp
+  80254b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80254d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802551:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  802558:	00 00 00 
+  80255b:	ff d0                	call   *%rax
+  80255d:	85 c0                	test   %eax,%eax
+  80255f:	78 0c                	js     80256d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802561:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802565:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802568:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80256d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802571:	c9                   	leave
+  802572:	c3                   	ret
+
+0000000000802573 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802573:	55                   	push   %rbp
+  802574:	48 89 e5             	mov    %rsp,%rbp
+  802577:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80257b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80257f:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  802586:	00 00 00 
+  802589:	ff d0                	call   *%rax
+  80258b:	85 c0                	test   %eax,%eax
+  80258d:	78 07                	js     802596 <tell+0x23>
+    return fdes->fd_offset;
+  80258f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802593:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802596:	c9                   	leave
+  802597:	c3                   	ret
+
+0000000000802598 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802598:	55                   	push   %rbp
+  802599:	48 89 e5             	mov    %rsp,%rbp
+  80259c:	41 55                	push   %r13
+  80259e:	41 54                	push   %r12
+  8025a0:	53                   	push   %rbx
+  8025a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8025a5:	89 fb                	mov    %edi,%ebx
+  8025a7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025aa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025ae:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  8025b5:	00 00 00 
+  8025b8:	ff d0                	call   *%rax
+  8025ba:	85 c0                	test   %eax,%eax
+  8025bc:	78 38                	js     8025f6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025be:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8025c2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8025c6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025ca:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  8025d1:	00 00 00 
+  8025d4:	ff d0                	call   *%rax
+  8025d6:	85 c0                	test   %eax,%eax
+  8025d8:	78 1c                	js     8025f6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025da:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8025df:	74 20                	je     802601 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8025e1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025e5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8025e9:	48 85 c0             	test   %rax,%rax
+  8025ec:	74 47                	je     802635 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8025ee:	44 89 e6             	mov    %r12d,%esi
+  8025f1:	4c 89 ef             	mov    %r13,%rdi
+  8025f4:	ff d0                	call   *%rax
+}
+  8025f6:	48 83 c4 18          	add    $0x18,%rsp
+  8025fa:	5b                   	pop    %rbx
+  8025fb:	41 5c                	pop    %r12
+  8025fd:	41 5d                	pop    %r13
+  8025ff:	5d                   	pop    %rbp
+  802600:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802601:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802608:	00 00 00 
+  80260b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802611:	89 da                	mov    %ebx,%edx
+  802613:	48 bf 28 56 80 00 00 	movabs $0x805628,%rdi
+  80261a:	00 00 00 
+  80261d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802622:	48 b9 fb 04 80 00 00 	movabs $0x8004fb,%rcx
+  802629:	00 00 00 
+  80262c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80262e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802633:	eb c1                	jmp    8025f6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802635:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80263a:	eb ba                	jmp    8025f6 <ftruncate+0x5e>
+
+000000000080263c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80263c:	55                   	push   %rbp
+  80263d:	48 89 e5             	mov    %rsp,%rbp
+  802640:	41 54                	push   %r12
+  802642:	53                   	push   %rbx
+  802643:	48 83 ec 10          	sub    $0x10,%rsp
+  802647:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80264a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80264e:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  802655:	00 00 00 
+  802658:	ff d0                	call   *%rax
+  80265a:	85 c0                	test   %eax,%eax
+  80265c:	78 4e                	js     8026ac <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80265e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802662:	41 8b 3c 24          	mov    (%r12),%edi
+  802666:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80266a:	48 b8 c2 20 80 00 00 	movabs $0x8020c2,%rax
+  802671:	00 00 00 
+  802674:	ff d0                	call   *%rax
+  802676:	85 c0                	test   %eax,%eax
+  802678:	78 32                	js     8026ac <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80267a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80267e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802683:	74 30                	je     8026b5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802685:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802688:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80268f:	00 00 00 
+    stat->st_isdir = 0;
+  802692:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802699:	00 00 00 
+    stat->st_dev = dev;
+  80269c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8026a3:	48 89 de             	mov    %rbx,%rsi
+  8026a6:	4c 89 e7             	mov    %r12,%rdi
+  8026a9:	ff 50 28             	call   *0x28(%rax)
+}
+  8026ac:	48 83 c4 10          	add    $0x10,%rsp
+  8026b0:	5b                   	pop    %rbx
+  8026b1:	41 5c                	pop    %r12
+  8026b3:	5d                   	pop    %rbp
+  8026b4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8026b5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8026ba:	eb f0                	jmp    8026ac <fstat+0x70>
+
+00000000008026bc <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8026bc:	55                   	push   %rbp
+  8026bd:	48 89 e5             	mov    %rsp,%rbp
+  8026c0:	41 54                	push   %r12
+  8026c2:	53                   	push   %rbx
+  8026c3:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8026ca:	41 89 fc             	mov    %edi,%r12d
+  8026cd:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026cf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026d3:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  8026da:	00 00 00 
+  8026dd:	ff d0                	call   *%rax
+  8026df:	85 c0                	test   %eax,%eax
+  8026e1:	78 31                	js     802714 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8026e3:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8026ea:	44 89 e7             	mov    %r12d,%edi
+  8026ed:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	78 17                	js     802714 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8026fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802701:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802704:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802707:	39 d3                	cmp    %edx,%ebx
+  802709:	0f 4f da             	cmovg  %edx,%ebx
+  80270c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80270f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802714:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  80271b:	5b                   	pop    %rbx
+  80271c:	41 5c                	pop    %r12
+  80271e:	5d                   	pop    %rbp
+  80271f:	c3                   	ret
+
+0000000000802720 <seektoend>:
+{
+  802720:	55                   	push   %rbp
+  802721:	48 89 e5             	mov    %rsp,%rbp
+  802724:	53                   	push   %rbx
+  802725:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80272c:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80272e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802732:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  802739:	00 00 00 
+  80273c:	ff d0                	call   *%rax
+  80273e:	85 c0                	test   %eax,%eax
+  802740:	78 28                	js     80276a <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802742:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802749:	89 df                	mov    %ebx,%edi
+  80274b:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  802752:	00 00 00 
+  802755:	ff d0                	call   *%rax
+  802757:	85 c0                	test   %eax,%eax
+  802759:	78 0f                	js     80276a <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80275b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80275e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802762:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802765:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80276a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80276e:	c9                   	leave
+  80276f:	c3                   	ret
+
+0000000000802770 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802770:	55                   	push   %rbp
+  802771:	48 89 e5             	mov    %rsp,%rbp
+  802774:	41 54                	push   %r12
+  802776:	53                   	push   %rbx
+  802777:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80277a:	be 00 00 00 00       	mov    $0x0,%esi
+  80277f:	48 b8 63 33 80 00 00 	movabs $0x803363,%rax
+  802786:	00 00 00 
+  802789:	ff d0                	call   *%rax
+  80278b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80278d:	85 c0                	test   %eax,%eax
+  80278f:	78 25                	js     8027b6 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802791:	4c 89 e6             	mov    %r12,%rsi
+  802794:	89 c7                	mov    %eax,%edi
+  802796:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  80279d:	00 00 00 
+  8027a0:	ff d0                	call   *%rax
+  8027a2:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8027a5:	89 df                	mov    %ebx,%edi
+  8027a7:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  8027ae:	00 00 00 
+  8027b1:	ff d0                	call   *%rax
+
+    return res;
+  8027b3:	44 89 e3             	mov    %r12d,%ebx
+}
+  8027b6:	89 d8                	mov    %ebx,%eax
+  8027b8:	5b                   	pop    %rbx
+  8027b9:	41 5c                	pop    %r12
+  8027bb:	5d                   	pop    %rbp
+  8027bc:	c3                   	ret
+
+00000000008027bd <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8027bd:	55                   	push   %rbp
+  8027be:	48 89 e5             	mov    %rsp,%rbp
+  8027c1:	53                   	push   %rbx
+  8027c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c6:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8027c9:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+  8027d5:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8027d9:	0f 87 ea 00 00 00    	ja     8028c9 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8027df:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8027e6:	00 00 00 
+  8027e9:	80 38 00             	cmpb   $0x0,(%rax)
+  8027ec:	75 35                	jne    802823 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8027ee:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027f3:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8027f8:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8027fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802802:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  802809:	00 00 00 
+  80280c:	ff d0                	call   *%rax
+  80280e:	85 c0                	test   %eax,%eax
+  802810:	0f 88 ba 00 00 00    	js     8028d0 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802816:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80281d:	00 00 00 
+  802820:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802823:	48 89 df             	mov    %rbx,%rdi
+  802826:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+  802832:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802836:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80283d:	00 00 00 
+  802840:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802844:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802847:	39 39                	cmp    %edi,(%rcx)
+  802849:	74 46                	je     802891 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80284b:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80284f:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802856:	00 
+  802857:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80285e:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802865:	00 
+  802866:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80286d:	00 
+  80286e:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802875:	00 
+  802876:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80287d:	00 
+  80287e:	89 39                	mov    %edi,(%rcx)
+  802880:	48 01 c6             	add    %rax,%rsi
+  802883:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802888:	48 89 c8             	mov    %rcx,%rax
+  80288b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80288f:	c9                   	leave
+  802890:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802891:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802895:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80289c:	00 00 00 
+  80289f:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8028a2:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  8028a6:	74 e0                	je     802888 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  8028a8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8028af:	00 
+  8028b0:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8028b4:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8028bb:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8028bd:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8028c0:	48 01 c2             	add    %rax,%rdx
+  8028c3:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8028c7:	eb bf                	jmp    802888 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8028c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ce:	eb b8                	jmp    802888 <fbuf_get+0xcb>
+            return NULL;
+  8028d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028d5:	eb b1                	jmp    802888 <fbuf_get+0xcb>
+
+00000000008028d7 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8028d7:	55                   	push   %rbp
+  8028d8:	48 89 e5             	mov    %rsp,%rbp
+  8028db:	53                   	push   %rbx
+  8028dc:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8028e0:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8028e7:	00 00 00 
+  8028ea:	48 8b 18             	mov    (%rax),%rbx
+  8028ed:	48 85 db             	test   %rbx,%rbx
+  8028f0:	74 16                	je     802908 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8028f2:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8028f9:	00 00 00 
+  8028fc:	48 8b 18             	mov    (%rax),%rbx
+}
+  8028ff:	48 89 d8             	mov    %rbx,%rax
+  802902:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802906:	c9                   	leave
+  802907:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802908:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80290d:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802912:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802917:	bf 00 00 00 00       	mov    $0x0,%edi
+  80291c:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  802923:	00 00 00 
+  802926:	ff d0                	call   *%rax
+  802928:	85 c0                	test   %eax,%eax
+  80292a:	78 d3                	js     8028ff <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  80292c:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802931:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802938:	00 00 00 
+  80293b:	eb b5                	jmp    8028f2 <fsipc_bulk+0x1b>
+
+000000000080293d <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80293d:	55                   	push   %rbp
+  80293e:	48 89 e5             	mov    %rsp,%rbp
+  802941:	41 57                	push   %r15
+  802943:	41 56                	push   %r14
+  802945:	41 55                	push   %r13
+  802947:	41 54                	push   %r12
+  802949:	53                   	push   %rbx
+  80294a:	48 83 ec 08          	sub    $0x8,%rsp
+  80294e:	41 89 fd             	mov    %edi,%r13d
+  802951:	49 89 f6             	mov    %rsi,%r14
+  802954:	49 89 d7             	mov    %rdx,%r15
+  802957:	48 89 cb             	mov    %rcx,%rbx
+  80295a:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80295d:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802964:	00 00 00 
+  802967:	83 38 00             	cmpl   $0x0,(%rax)
+  80296a:	74 52                	je     8029be <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80296c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802972:	4c 89 f9             	mov    %r15,%rcx
+  802975:	4c 89 f2             	mov    %r14,%rdx
+  802978:	44 89 ee             	mov    %r13d,%esi
+  80297b:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802982:	00 00 00 
+  802985:	8b 38                	mov    (%rax),%edi
+  802987:	48 b8 c5 44 80 00 00 	movabs $0x8044c5,%rax
+  80298e:	00 00 00 
+  802991:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802993:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802998:	4c 89 e2             	mov    %r12,%rdx
+  80299b:	48 89 de             	mov    %rbx,%rsi
+  80299e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029a3:	48 b8 15 43 80 00 00 	movabs $0x804315,%rax
+  8029aa:	00 00 00 
+  8029ad:	ff d0                	call   *%rax
+}
+  8029af:	48 83 c4 08          	add    $0x8,%rsp
+  8029b3:	5b                   	pop    %rbx
+  8029b4:	41 5c                	pop    %r12
+  8029b6:	41 5d                	pop    %r13
+  8029b8:	41 5e                	pop    %r14
+  8029ba:	41 5f                	pop    %r15
+  8029bc:	5d                   	pop    %rbp
+  8029bd:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029be:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029c3:	48 b8 68 45 80 00 00 	movabs $0x804568,%rax
+  8029ca:	00 00 00 
+  8029cd:	ff d0                	call   *%rax
+  8029cf:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8029d6:	00 00 
+  8029d8:	eb 92                	jmp    80296c <fsipc_region+0x2f>
+
+00000000008029da <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8029da:	55                   	push   %rbp
+  8029db:	48 89 e5             	mov    %rsp,%rbp
+  8029de:	41 57                	push   %r15
+  8029e0:	41 56                	push   %r14
+  8029e2:	41 55                	push   %r13
+  8029e4:	41 54                	push   %r12
+  8029e6:	53                   	push   %rbx
+  8029e7:	48 83 ec 28          	sub    $0x28,%rsp
+  8029eb:	49 89 ff             	mov    %rdi,%r15
+  8029ee:	49 89 f6             	mov    %rsi,%r14
+  8029f1:	48 89 d3             	mov    %rdx,%rbx
+  8029f4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8029f8:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8029fb:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  802a02:	00 00 00 
+  802a05:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802a07:	48 85 c0             	test   %rax,%rax
+  802a0a:	0f 84 cc 00 00 00    	je     802adc <devfile_write_direct+0x102>
+  802a10:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802a13:	48 85 db             	test   %rbx,%rbx
+  802a16:	0f 84 ba 00 00 00    	je     802ad6 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802a1c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802a22:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802a29:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802a2d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802a31:	4c 29 e3             	sub    %r12,%rbx
+  802a34:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802a39:	48 39 c3             	cmp    %rax,%rbx
+  802a3c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802a40:	48 89 da             	mov    %rbx,%rdx
+  802a43:	4c 89 f6             	mov    %r14,%rsi
+  802a46:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802a4a:	48 b8 68 12 80 00 00 	movabs $0x801268,%rax
+  802a51:	00 00 00 
+  802a54:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802a56:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a5a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802a5e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802a61:	44 01 e0             	add    %r12d,%eax
+  802a64:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802a68:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802a6c:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802a73:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802a7a:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802a81:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a8c:	4c 89 ee             	mov    %r13,%rsi
+  802a8f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a94:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  802a9b:	00 00 00 
+  802a9e:	ff d0                	call   *%rax
+        if (res < 0)
+  802aa0:	85 c0                	test   %eax,%eax
+  802aa2:	78 29                	js     802acd <devfile_write_direct+0xf3>
+        if (res == 0)
+  802aa4:	74 2b                	je     802ad1 <devfile_write_direct+0xf7>
+        i += res;
+  802aa6:	48 98                	cltq
+  802aa8:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802aab:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802aae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ab2:	49 39 c4             	cmp    %rax,%r12
+  802ab5:	0f 82 72 ff ff ff    	jb     802a2d <devfile_write_direct+0x53>
+    return i;
+  802abb:	4c 89 e0             	mov    %r12,%rax
+}
+  802abe:	48 83 c4 28          	add    $0x28,%rsp
+  802ac2:	5b                   	pop    %rbx
+  802ac3:	41 5c                	pop    %r12
+  802ac5:	41 5d                	pop    %r13
+  802ac7:	41 5e                	pop    %r14
+  802ac9:	41 5f                	pop    %r15
+  802acb:	5d                   	pop    %rbp
+  802acc:	c3                   	ret
+            return res;
+  802acd:	48 98                	cltq
+  802acf:	eb ed                	jmp    802abe <devfile_write_direct+0xe4>
+            return i;
+  802ad1:	4c 89 e0             	mov    %r12,%rax
+  802ad4:	eb e8                	jmp    802abe <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802ad6:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802ada:	eb df                	jmp    802abb <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802adc:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802ae3:	eb d9                	jmp    802abe <devfile_write_direct+0xe4>
+
+0000000000802ae5 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802ae5:	55                   	push   %rbp
+  802ae6:	48 89 e5             	mov    %rsp,%rbp
+  802ae9:	41 56                	push   %r14
+  802aeb:	41 55                	push   %r13
+  802aed:	41 54                	push   %r12
+  802aef:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802af0:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802af4:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802af8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802afd:	4d 39 ee             	cmp    %r13,%r14
+  802b00:	0f 84 99 00 00 00    	je     802b9f <fbuf_flush+0xba>
+  802b06:	49 89 fc             	mov    %rdi,%r12
+  802b09:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802b0c:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802b0f:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802b13:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  802b1a:	00 00 00 
+  802b1d:	ff d0                	call   *%rax
+  802b1f:	48 89 c2             	mov    %rax,%rdx
+  802b22:	48 c1 e2 04          	shl    $0x4,%rdx
+  802b26:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802b2a:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b2e:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802b33:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802b36:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802b3a:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802b41:	00 
+  802b42:	44 89 f1             	mov    %r14d,%ecx
+  802b45:	4c 89 ea             	mov    %r13,%rdx
+  802b48:	4c 89 e7             	mov    %r12,%rdi
+  802b4b:	48 b8 da 29 80 00 00 	movabs $0x8029da,%rax
+  802b52:	00 00 00 
+  802b55:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b57:	48 85 c0             	test   %rax,%rax
+  802b5a:	78 43                	js     802b9f <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802b5c:	4c 39 e8             	cmp    %r13,%rax
+  802b5f:	72 47                	jb     802ba8 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802b61:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802b66:	83 c0 01             	add    $0x1,%eax
+  802b69:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802b6e:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802b71:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802b75:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802b79:	72 0f                	jb     802b8a <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802b7b:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802b7f:	48 39 c2             	cmp    %rax,%rdx
+  802b82:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802b86:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802b8a:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802b91:	00 
+  802b92:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802b99:	00 
+    return 0;
+  802b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b9f:	5b                   	pop    %rbx
+  802ba0:	41 5c                	pop    %r12
+  802ba2:	41 5d                	pop    %r13
+  802ba4:	41 5e                	pop    %r14
+  802ba6:	5d                   	pop    %rbp
+  802ba7:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802ba8:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802bad:	eb f0                	jmp    802b9f <fbuf_flush+0xba>
+
+0000000000802baf <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802baf:	55                   	push   %rbp
+  802bb0:	48 89 e5             	mov    %rsp,%rbp
+  802bb3:	53                   	push   %rbx
+  802bb4:	48 83 ec 08          	sub    $0x8,%rsp
+  802bb8:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802bbb:	48 b8 bd 27 80 00 00 	movabs $0x8027bd,%rax
+  802bc2:	00 00 00 
+  802bc5:	ff d0                	call   *%rax
+  802bc7:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802bca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcf:	48 85 f6             	test   %rsi,%rsi
+  802bd2:	74 0f                	je     802be3 <devfile_sync+0x34>
+  802bd4:	48 89 df             	mov    %rbx,%rdi
+  802bd7:	48 b8 e5 2a 80 00 00 	movabs $0x802ae5,%rax
+  802bde:	00 00 00 
+  802be1:	ff d0                	call   *%rax
+}
+  802be3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802be7:	c9                   	leave
+  802be8:	c3                   	ret
+
+0000000000802be9 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802be9:	55                   	push   %rbp
+  802bea:	48 89 e5             	mov    %rsp,%rbp
+  802bed:	48 83 ec 10          	sub    $0x10,%rsp
+  802bf1:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802bf4:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802bfb:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802bfc:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802c00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c05:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802c0c:	00 00 00 
+  802c0f:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  802c16:	00 00 00 
+  802c19:	ff d0                	call   *%rax
+}
+  802c1b:	c9                   	leave
+  802c1c:	c3                   	ret
+
+0000000000802c1d <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c1d:	55                   	push   %rbp
+  802c1e:	48 89 e5             	mov    %rsp,%rbp
+  802c21:	41 54                	push   %r12
+  802c23:	53                   	push   %rbx
+  802c24:	48 89 fb             	mov    %rdi,%rbx
+  802c27:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802c2a:	48 b8 af 2b 80 00 00 	movabs $0x802baf,%rax
+  802c31:	00 00 00 
+  802c34:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c36:	85 c0                	test   %eax,%eax
+  802c38:	78 63                	js     802c9d <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c3a:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c3d:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802c44:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802c46:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c50:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  802c57:	00 00 00 
+  802c5a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c5c:	85 c0                	test   %eax,%eax
+  802c5e:	78 3d                	js     802c9d <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c60:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802c67:	00 00 00 
+  802c6a:	48 89 de             	mov    %rbx,%rsi
+  802c6d:	4c 89 e7             	mov    %r12,%rdi
+  802c70:	48 b8 73 0e 80 00 00 	movabs $0x800e73,%rax
+  802c77:	00 00 00 
+  802c7a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c7c:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802c82:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802c89:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c8a:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802c90:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802c97:	00 
+
+    return 0;
+  802c98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c9d:	5b                   	pop    %rbx
+  802c9e:	41 5c                	pop    %r12
+  802ca0:	5d                   	pop    %rbp
+  802ca1:	c3                   	ret
+
+0000000000802ca2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802ca2:	55                   	push   %rbp
+  802ca3:	48 89 e5             	mov    %rsp,%rbp
+  802ca6:	41 54                	push   %r12
+  802ca8:	53                   	push   %rbx
+  802ca9:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802cac:	48 b8 af 2b 80 00 00 	movabs $0x802baf,%rax
+  802cb3:	00 00 00 
+  802cb6:	ff d0                	call   *%rax
+  802cb8:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802cbb:	48 89 df             	mov    %rbx,%rdi
+  802cbe:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  802cc5:	00 00 00 
+  802cc8:	ff d0                	call   *%rax
+  802cca:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802cce:	76 2e                	jbe    802cfe <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802cd0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802cd3:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802cda:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802cdc:	be 00 00 00 00       	mov    $0x0,%esi
+  802ce1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ce6:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  802ced:	00 00 00 
+  802cf0:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802cf2:	45 85 e4             	test   %r12d,%r12d
+  802cf5:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802cf9:	5b                   	pop    %rbx
+  802cfa:	41 5c                	pop    %r12
+  802cfc:	5d                   	pop    %rbp
+  802cfd:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802cfe:	48 89 df             	mov    %rbx,%rdi
+  802d01:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  802d08:	00 00 00 
+  802d0b:	ff d0                	call   *%rax
+  802d0d:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802d11:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802d18:	00 00 00 
+  802d1b:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802d22:	48 89 df             	mov    %rbx,%rdi
+  802d25:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  802d2c:	00 00 00 
+  802d2f:	ff d0                	call   *%rax
+  802d31:	48 89 c6             	mov    %rax,%rsi
+  802d34:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d39:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d3e:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  802d45:	00 00 00 
+  802d48:	ff d0                	call   *%rax
+  802d4a:	eb 84                	jmp    802cd0 <devfile_flush+0x2e>
+
+0000000000802d4c <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802d4c:	55                   	push   %rbp
+  802d4d:	48 89 e5             	mov    %rsp,%rbp
+  802d50:	41 55                	push   %r13
+  802d52:	41 54                	push   %r12
+  802d54:	53                   	push   %rbx
+  802d55:	48 83 ec 08          	sub    $0x8,%rsp
+  802d59:	48 89 fb             	mov    %rdi,%rbx
+  802d5c:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802d5f:	48 b8 bd 27 80 00 00 	movabs $0x8027bd,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d6b:	48 85 c0             	test   %rax,%rax
+  802d6e:	74 51                	je     802dc1 <devfile_trunc+0x75>
+  802d70:	49 89 c4             	mov    %rax,%r12
+  802d73:	48 89 c6             	mov    %rax,%rsi
+  802d76:	48 89 df             	mov    %rbx,%rdi
+  802d79:	48 b8 e5 2a 80 00 00 	movabs $0x802ae5,%rax
+  802d80:	00 00 00 
+  802d83:	ff d0                	call   *%rax
+  802d85:	85 c0                	test   %eax,%eax
+  802d87:	78 2d                	js     802db6 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802d89:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802d90:	00 00 00 
+  802d93:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802d96:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802d98:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802d9c:	be 00 00 00 00       	mov    $0x0,%esi
+  802da1:	bf 02 00 00 00       	mov    $0x2,%edi
+  802da6:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  802dad:	00 00 00 
+  802db0:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802db2:	85 c0                	test   %eax,%eax
+  802db4:	79 3e                	jns    802df4 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802db6:	48 83 c4 08          	add    $0x8,%rsp
+  802dba:	5b                   	pop    %rbx
+  802dbb:	41 5c                	pop    %r12
+  802dbd:	41 5d                	pop    %r13
+  802dbf:	5d                   	pop    %rbp
+  802dc0:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802dc1:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802dc8:	00 00 00 
+  802dcb:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802dce:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802dd0:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802dd4:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd9:	bf 02 00 00 00       	mov    $0x2,%edi
+  802dde:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  802de5:	00 00 00 
+  802de8:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802dea:	85 c0                	test   %eax,%eax
+  802dec:	78 c8                	js     802db6 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802dee:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802df2:	eb c2                	jmp    802db6 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802df4:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802df7:	8d 51 01             	lea    0x1(%rcx),%edx
+  802dfa:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802dfd:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802e02:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802e09:	00 00 
+  802e0b:	eb a9                	jmp    802db6 <devfile_trunc+0x6a>
+
+0000000000802e0d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802e0d:	55                   	push   %rbp
+  802e0e:	48 89 e5             	mov    %rsp,%rbp
+  802e11:	41 57                	push   %r15
+  802e13:	41 56                	push   %r14
+  802e15:	41 55                	push   %r13
+  802e17:	41 54                	push   %r12
+  802e19:	53                   	push   %rbx
+  802e1a:	48 83 ec 28          	sub    $0x28,%rsp
+  802e1e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802e22:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802e26:	49 89 d7             	mov    %rdx,%r15
+  802e29:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802e2d:	48 b8 bd 27 80 00 00 	movabs $0x8027bd,%rax
+  802e34:	00 00 00 
+  802e37:	ff d0                	call   *%rax
+  802e39:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802e3c:	48 85 c0             	test   %rax,%rax
+  802e3f:	74 31                	je     802e72 <devfile_write+0x65>
+  802e41:	4c 89 f8             	mov    %r15,%rax
+  802e44:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802e4b:	77 25                	ja     802e72 <devfile_write+0x65>
+    size_t i = 0;
+  802e4d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802e53:	48 85 c0             	test   %rax,%rax
+  802e56:	0f 85 64 01 00 00    	jne    802fc0 <devfile_write+0x1b3>
+    size_t i = 0;
+  802e5c:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802e60:	4c 89 f8             	mov    %r15,%rax
+}
+  802e63:	48 83 c4 28          	add    $0x28,%rsp
+  802e67:	5b                   	pop    %rbx
+  802e68:	41 5c                	pop    %r12
+  802e6a:	41 5d                	pop    %r13
+  802e6c:	41 5e                	pop    %r14
+  802e6e:	41 5f                	pop    %r15
+  802e70:	5d                   	pop    %rbp
+  802e71:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e72:	48 85 db             	test   %rbx,%rbx
+  802e75:	74 5b                	je     802ed2 <devfile_write+0xc5>
+  802e77:	48 89 de             	mov    %rbx,%rsi
+  802e7a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e7e:	48 b8 e5 2a 80 00 00 	movabs $0x802ae5,%rax
+  802e85:	00 00 00 
+  802e88:	ff d0                	call   *%rax
+  802e8a:	85 c0                	test   %eax,%eax
+  802e8c:	78 40                	js     802ece <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802e8e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e92:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802e95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e99:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802e9d:	48 b8 da 29 80 00 00 	movabs $0x8029da,%rax
+  802ea4:	00 00 00 
+  802ea7:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802ea9:	48 85 c0             	test   %rax,%rax
+  802eac:	7e b5                	jle    802e63 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802eae:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802eb2:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802eb5:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802eb8:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802ebb:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ebe:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ec1:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802ec4:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802ecb:	00 
+  802ecc:	eb 95                	jmp    802e63 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ece:	48 98                	cltq
+  802ed0:	eb 91                	jmp    802e63 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802ed2:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802ed6:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802ed9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802edd:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802ee1:	48 89 df             	mov    %rbx,%rdi
+  802ee4:	48 b8 da 29 80 00 00 	movabs $0x8029da,%rax
+  802eeb:	00 00 00 
+  802eee:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802ef0:	48 85 c0             	test   %rax,%rax
+  802ef3:	0f 8e 6a ff ff ff    	jle    802e63 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802ef9:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802efc:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f00:	e9 5e ff ff ff       	jmp    802e63 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f05:	48 98                	cltq
+  802f07:	4d 85 ff             	test   %r15,%r15
+  802f0a:	49 0f 45 c7          	cmovne %r15,%rax
+  802f0e:	e9 50 ff ff ff       	jmp    802e63 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f13:	48 89 de             	mov    %rbx,%rsi
+  802f16:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f1a:	48 b8 e5 2a 80 00 00 	movabs $0x802ae5,%rax
+  802f21:	00 00 00 
+  802f24:	ff d0                	call   *%rax
+  802f26:	85 c0                	test   %eax,%eax
+  802f28:	0f 88 2b 01 00 00    	js     803059 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802f2e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f32:	4c 01 f8             	add    %r15,%rax
+  802f35:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802f39:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f3d:	48 b9 e9 1f 80 00 00 	movabs $0x801fe9,%rcx
+  802f44:	00 00 00 
+  802f47:	ff d1                	call   *%rcx
+  802f49:	48 89 c2             	mov    %rax,%rdx
+  802f4c:	48 c1 e2 04          	shl    $0x4,%rdx
+  802f50:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802f54:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f58:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802f5d:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802f60:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802f67:	00 
+  802f68:	4c 89 ea             	mov    %r13,%rdx
+  802f6b:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802f6f:	48 b8 68 12 80 00 00 	movabs $0x801268,%rax
+  802f76:	00 00 00 
+  802f79:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802f7b:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802f7f:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802f83:	48 39 c2             	cmp    %rax,%rdx
+  802f86:	0f 84 db 00 00 00    	je     803067 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802f8c:	4c 39 e2             	cmp    %r12,%rdx
+  802f8f:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802f93:	4d 01 ec             	add    %r13,%r12
+  802f96:	49 39 c4             	cmp    %rax,%r12
+  802f99:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802f9d:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802fa1:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802fa5:	45 01 ee             	add    %r13d,%r14d
+  802fa8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fac:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802fb0:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802fb3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802fb7:	49 39 c7             	cmp    %rax,%r15
+  802fba:	0f 83 a0 fe ff ff    	jae    802e60 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802fc0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fc4:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802fc8:	8b 43 08             	mov    0x8(%rbx),%eax
+  802fcb:	44 39 f0             	cmp    %r14d,%eax
+  802fce:	7f 10                	jg     802fe0 <devfile_write+0x1d3>
+  802fd0:	48 98                	cltq
+  802fd2:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802fd8:	49 63 d6             	movslq %r14d,%rdx
+  802fdb:	48 39 d0             	cmp    %rdx,%rax
+  802fde:	7d 2d                	jge    80300d <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802fe0:	48 89 de             	mov    %rbx,%rsi
+  802fe3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fe7:	48 b8 e5 2a 80 00 00 	movabs $0x802ae5,%rax
+  802fee:	00 00 00 
+  802ff1:	ff d0                	call   *%rax
+  802ff3:	85 c0                	test   %eax,%eax
+  802ff5:	0f 88 0a ff ff ff    	js     802f05 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802ffb:	44 89 f0             	mov    %r14d,%eax
+  802ffe:	66 b8 00 00          	mov    $0x0,%ax
+  803002:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803005:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80300c:	00 
+        size_t off = pos - fb->fb_base;
+  80300d:	45 89 f4             	mov    %r14d,%r12d
+  803010:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803014:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803017:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  80301b:	4d 29 fd             	sub    %r15,%r13
+  80301e:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803023:	4c 29 e0             	sub    %r12,%rax
+  803026:	49 39 c5             	cmp    %rax,%r13
+  803029:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  80302d:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803031:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803035:	48 39 c2             	cmp    %rax,%rdx
+  803038:	0f 84 f0 fe ff ff    	je     802f2e <devfile_write+0x121>
+  80303e:	4c 39 e0             	cmp    %r12,%rax
+  803041:	0f 82 cc fe ff ff    	jb     802f13 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803047:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80304b:	48 39 d0             	cmp    %rdx,%rax
+  80304e:	0f 83 da fe ff ff    	jae    802f2e <devfile_write+0x121>
+  803054:	e9 ba fe ff ff       	jmp    802f13 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803059:	48 98                	cltq
+  80305b:	4d 85 ff             	test   %r15,%r15
+  80305e:	49 0f 45 c7          	cmovne %r15,%rax
+  803062:	e9 fc fd ff ff       	jmp    802e63 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803067:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80306b:	4c 89 e2             	mov    %r12,%rdx
+  80306e:	e9 2a ff ff ff       	jmp    802f9d <devfile_write+0x190>
+
+0000000000803073 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803073:	55                   	push   %rbp
+  803074:	48 89 e5             	mov    %rsp,%rbp
+  803077:	41 57                	push   %r15
+  803079:	41 56                	push   %r14
+  80307b:	41 55                	push   %r13
+  80307d:	41 54                	push   %r12
+  80307f:	53                   	push   %rbx
+  803080:	48 83 ec 28          	sub    $0x28,%rsp
+  803084:	49 89 ff             	mov    %rdi,%r15
+  803087:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80308b:	48 89 d3             	mov    %rdx,%rbx
+  80308e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803092:	48 b8 bd 27 80 00 00 	movabs $0x8027bd,%rax
+  803099:	00 00 00 
+  80309c:	ff d0                	call   *%rax
+  80309e:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8030a1:	48 85 c0             	test   %rax,%rax
+  8030a4:	74 0d                	je     8030b3 <devfile_read+0x40>
+  8030a6:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8030ad:	0f 86 1a 01 00 00    	jbe    8031cd <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8030b3:	4d 85 e4             	test   %r12,%r12
+  8030b6:	74 1a                	je     8030d2 <devfile_read+0x5f>
+  8030b8:	4c 89 e6             	mov    %r12,%rsi
+  8030bb:	4c 89 ff             	mov    %r15,%rdi
+  8030be:	48 b8 e5 2a 80 00 00 	movabs $0x802ae5,%rax
+  8030c5:	00 00 00 
+  8030c8:	ff d0                	call   *%rax
+  8030ca:	85 c0                	test   %eax,%eax
+  8030cc:	0f 88 e8 00 00 00    	js     8031ba <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8030d2:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8030d6:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  8030dd:	00 00 00 
+  8030e0:	ff d0                	call   *%rax
+  8030e2:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  8030e5:	48 85 c0             	test   %rax,%rax
+  8030e8:	0f 84 69 02 00 00    	je     803357 <devfile_read+0x2e4>
+    while (i < n) {
+  8030ee:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8030f3:	0f 84 ce 00 00 00    	je     8031c7 <devfile_read+0x154>
+    size_t i = 0;
+  8030f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8030fe:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803105:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803109:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80310d:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803111:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803115:	48 29 da             	sub    %rbx,%rdx
+  803118:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80311d:	48 39 c2             	cmp    %rax,%rdx
+  803120:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803124:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803128:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  80312c:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80312f:	01 d8                	add    %ebx,%eax
+  803131:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803135:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803139:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803140:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803147:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80314e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803154:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803159:	4c 89 ee             	mov    %r13,%rsi
+  80315c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803161:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  803168:	00 00 00 
+  80316b:	ff d0                	call   *%rax
+        if (res < 0)
+  80316d:	85 c0                	test   %eax,%eax
+  80316f:	78 4d                	js     8031be <devfile_read+0x14b>
+        if (res == 0)
+  803171:	74 4f                	je     8031c2 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803173:	4c 63 e0             	movslq %eax,%r12
+  803176:	4c 89 e2             	mov    %r12,%rdx
+  803179:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80317d:	4c 89 f7             	mov    %r14,%rdi
+  803180:	48 b8 68 12 80 00 00 	movabs $0x801268,%rax
+  803187:	00 00 00 
+  80318a:	ff d0                	call   *%rax
+        i += res;
+  80318c:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  80318f:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803192:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803196:	48 39 c3             	cmp    %rax,%rbx
+  803199:	0f 82 72 ff ff ff    	jb     803111 <devfile_read+0x9e>
+    return i;
+  80319f:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8031a2:	48 85 c0             	test   %rax,%rax
+  8031a5:	7e 04                	jle    8031ab <devfile_read+0x138>
+  8031a7:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8031ab:	48 83 c4 28          	add    $0x28,%rsp
+  8031af:	5b                   	pop    %rbx
+  8031b0:	41 5c                	pop    %r12
+  8031b2:	41 5d                	pop    %r13
+  8031b4:	41 5e                	pop    %r14
+  8031b6:	41 5f                	pop    %r15
+  8031b8:	5d                   	pop    %rbp
+  8031b9:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8031ba:	48 98                	cltq
+  8031bc:	eb ed                	jmp    8031ab <devfile_read+0x138>
+            return res;
+  8031be:	48 98                	cltq
+  8031c0:	eb e9                	jmp    8031ab <devfile_read+0x138>
+            return i;
+  8031c2:	48 89 d8             	mov    %rbx,%rax
+  8031c5:	eb db                	jmp    8031a2 <devfile_read+0x12f>
+    size_t i = 0;
+  8031c7:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8031cb:	eb d2                	jmp    80319f <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8031cd:	48 89 c6             	mov    %rax,%rsi
+  8031d0:	4c 89 ff             	mov    %r15,%rdi
+  8031d3:	48 b8 e5 2a 80 00 00 	movabs $0x802ae5,%rax
+  8031da:	00 00 00 
+  8031dd:	ff d0                	call   *%rax
+  8031df:	85 c0                	test   %eax,%eax
+  8031e1:	78 40                	js     803223 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8031e3:	4c 89 ff             	mov    %r15,%rdi
+  8031e6:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  8031ed:	00 00 00 
+  8031f0:	ff d0                	call   *%rax
+  8031f2:	48 89 c2             	mov    %rax,%rdx
+  8031f5:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031f9:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8031fd:	48 c1 e0 0c          	shl    $0xc,%rax
+  803201:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803206:	48 01 d0             	add    %rdx,%rax
+  803209:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80320d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803212:	0f 84 33 01 00 00    	je     80334b <devfile_read+0x2d8>
+    size_t i = 0;
+  803218:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80321e:	e9 f5 00 00 00       	jmp    803318 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803223:	48 98                	cltq
+  803225:	eb 84                	jmp    8031ab <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803227:	44 89 e8             	mov    %r13d,%eax
+  80322a:	66 b8 00 00          	mov    $0x0,%ax
+  80322e:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803233:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80323a:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  80323c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803240:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803244:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803246:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80324b:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80324e:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803255:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803256:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80325c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803261:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803266:	bf 03 00 00 00       	mov    $0x3,%edi
+  80326b:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  803272:	00 00 00 
+  803275:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803277:	85 c0                	test   %eax,%eax
+  803279:	0f 88 be 00 00 00    	js     80333d <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80327f:	48 63 d0             	movslq %eax,%rdx
+  803282:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803287:	41 03 44 24 08       	add    0x8(%r12),%eax
+  80328c:	44 39 e8             	cmp    %r13d,%eax
+  80328f:	0f 8e ba 00 00 00    	jle    80334f <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803295:	49 63 c5             	movslq %r13d,%rax
+  803298:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  80329d:	48 29 c3             	sub    %rax,%rbx
+  8032a0:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8032a5:	48 01 c3             	add    %rax,%rbx
+  8032a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032ac:	4c 29 f0             	sub    %r14,%rax
+  8032af:	48 39 c3             	cmp    %rax,%rbx
+  8032b2:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8032b6:	4c 89 ff             	mov    %r15,%rdi
+  8032b9:	48 b9 e9 1f 80 00 00 	movabs $0x801fe9,%rcx
+  8032c0:	00 00 00 
+  8032c3:	ff d1                	call   *%rcx
+  8032c5:	48 89 c2             	mov    %rax,%rdx
+  8032c8:	48 c1 e2 04          	shl    $0x4,%rdx
+  8032cc:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8032d0:	48 c1 e0 0c          	shl    $0xc,%rax
+  8032d4:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8032d9:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8032dc:	44 89 ea             	mov    %r13d,%edx
+  8032df:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8032e4:	48 63 d2             	movslq %edx,%rdx
+  8032e7:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8032ee:	00 
+  8032ef:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8032f3:	4c 01 f7             	add    %r14,%rdi
+  8032f6:	48 89 da             	mov    %rbx,%rdx
+  8032f9:	48 b9 68 12 80 00 00 	movabs $0x801268,%rcx
+  803300:	00 00 00 
+  803303:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803305:	41 01 dd             	add    %ebx,%r13d
+  803308:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  80330c:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80330f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803313:	49 39 c6             	cmp    %rax,%r14
+  803316:	73 37                	jae    80334f <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803318:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  80331c:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803321:	44 39 e8             	cmp    %r13d,%eax
+  803324:	0f 8f fd fe ff ff    	jg     803227 <devfile_read+0x1b4>
+  80332a:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80332f:	44 39 e8             	cmp    %r13d,%eax
+  803332:	0f 8f 5d ff ff ff    	jg     803295 <devfile_read+0x222>
+  803338:	e9 ea fe ff ff       	jmp    803227 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80333d:	48 98                	cltq
+  80333f:	4d 85 f6             	test   %r14,%r14
+  803342:	49 0f 45 c6          	cmovne %r14,%rax
+  803346:	e9 60 fe ff ff       	jmp    8031ab <devfile_read+0x138>
+    size_t i = 0;
+  80334b:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80334f:	4c 89 f0             	mov    %r14,%rax
+  803352:	e9 54 fe ff ff       	jmp    8031ab <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803357:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80335e:	e9 48 fe ff ff       	jmp    8031ab <devfile_read+0x138>
+
+0000000000803363 <open>:
+open(const char *path, int mode) {
+  803363:	55                   	push   %rbp
+  803364:	48 89 e5             	mov    %rsp,%rbp
+  803367:	41 55                	push   %r13
+  803369:	41 54                	push   %r12
+  80336b:	53                   	push   %rbx
+  80336c:	48 83 ec 18          	sub    $0x18,%rsp
+  803370:	49 89 fc             	mov    %rdi,%r12
+  803373:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803376:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  80337d:	00 00 00 
+  803380:	ff d0                	call   *%rax
+  803382:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803388:	0f 87 8a 00 00 00    	ja     803418 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80338e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803392:	48 b8 17 20 80 00 00 	movabs $0x802017,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+  80339e:	89 c3                	mov    %eax,%ebx
+  8033a0:	85 c0                	test   %eax,%eax
+  8033a2:	78 50                	js     8033f4 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8033a4:	4c 89 e6             	mov    %r12,%rsi
+  8033a7:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8033ae:	00 00 00 
+  8033b1:	48 89 df             	mov    %rbx,%rdi
+  8033b4:	48 b8 73 0e 80 00 00 	movabs $0x800e73,%rax
+  8033bb:	00 00 00 
+  8033be:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8033c0:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8033c7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8033cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8033d0:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  8033d7:	00 00 00 
+  8033da:	ff d0                	call   *%rax
+  8033dc:	89 c3                	mov    %eax,%ebx
+  8033de:	85 c0                	test   %eax,%eax
+  8033e0:	78 1f                	js     803401 <open+0x9e>
+    return fd2num(fd);
+  8033e2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033e6:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  8033ed:	00 00 00 
+  8033f0:	ff d0                	call   *%rax
+  8033f2:	89 c3                	mov    %eax,%ebx
+}
+  8033f4:	89 d8                	mov    %ebx,%eax
+  8033f6:	48 83 c4 18          	add    $0x18,%rsp
+  8033fa:	5b                   	pop    %rbx
+  8033fb:	41 5c                	pop    %r12
+  8033fd:	41 5d                	pop    %r13
+  8033ff:	5d                   	pop    %rbp
+  803400:	c3                   	ret
+        fd_close(fd, 0);
+  803401:	be 00 00 00 00       	mov    $0x0,%esi
+  803406:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80340a:	48 b8 32 21 80 00 00 	movabs $0x802132,%rax
+  803411:	00 00 00 
+  803414:	ff d0                	call   *%rax
+        return res;
+  803416:	eb dc                	jmp    8033f4 <open+0x91>
+        return -E_BAD_PATH;
+  803418:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80341d:	eb d5                	jmp    8033f4 <open+0x91>
+
+000000000080341f <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80341f:	55                   	push   %rbp
+  803420:	48 89 e5             	mov    %rsp,%rbp
+  803423:	41 57                	push   %r15
+  803425:	41 56                	push   %r14
+  803427:	41 55                	push   %r13
+  803429:	41 54                	push   %r12
+  80342b:	53                   	push   %rbx
+  80342c:	48 83 ec 18          	sub    $0x18,%rsp
+  803430:	41 89 f6             	mov    %esi,%r14d
+  803433:	49 89 d7             	mov    %rdx,%r15
+  803436:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803439:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80343d:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  803444:	00 00 00 
+  803447:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803449:	85 c0                	test   %eax,%eax
+  80344b:	0f 88 db 00 00 00    	js     80352c <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803451:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803455:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80345c:	00 00 00 
+  80345f:	8b 00                	mov    (%rax),%eax
+  803461:	39 07                	cmp    %eax,(%rdi)
+  803463:	0f 85 db 00 00 00    	jne    803544 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803469:	45 85 f6             	test   %r14d,%r14d
+  80346c:	0f 88 db 00 00 00    	js     80354d <fmap+0x12e>
+  803472:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803479:	0f 85 d7 00 00 00    	jne    803556 <fmap+0x137>
+  80347f:	4c 89 fb             	mov    %r15,%rbx
+  803482:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803488:	0f 85 d1 00 00 00    	jne    80355f <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80348e:	48 b8 af 2b 80 00 00 	movabs $0x802baf,%rax
+  803495:	00 00 00 
+  803498:	ff d0                	call   *%rax
+  80349a:	85 c0                	test   %eax,%eax
+  80349c:	0f 88 8e 00 00 00    	js     803530 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8034a2:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8034a9:	00 00 00 
+    while (i < n) {
+  8034ac:	4d 85 ed             	test   %r13,%r13
+  8034af:	0f 84 8a 00 00 00    	je     80353f <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8034b5:	4c 89 ea             	mov    %r13,%rdx
+  8034b8:	48 29 da             	sub    %rbx,%rdx
+  8034bb:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8034c2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8034c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8034cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034d0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034d3:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8034d7:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8034db:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8034e0:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8034e5:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8034e9:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8034ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034f2:	4c 89 e6             	mov    %r12,%rsi
+  8034f5:	bf 09 00 00 00       	mov    $0x9,%edi
+  8034fa:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  803501:	00 00 00 
+  803504:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803506:	85 c0                	test   %eax,%eax
+  803508:	78 2a                	js     803534 <fmap+0x115>
+        i += res;
+  80350a:	48 98                	cltq
+  80350c:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80350f:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803513:	72 05                	jb     80351a <fmap+0xfb>
+    while (i < n) {
+  803515:	4c 39 eb             	cmp    %r13,%rbx
+  803518:	72 9b                	jb     8034b5 <fmap+0x96>
+    }
+    return i;
+  80351a:	48 89 d8             	mov    %rbx,%rax
+}
+  80351d:	48 83 c4 18          	add    $0x18,%rsp
+  803521:	5b                   	pop    %rbx
+  803522:	41 5c                	pop    %r12
+  803524:	41 5d                	pop    %r13
+  803526:	41 5e                	pop    %r14
+  803528:	41 5f                	pop    %r15
+  80352a:	5d                   	pop    %rbp
+  80352b:	c3                   	ret
+    if (res < 0) return res;
+  80352c:	48 98                	cltq
+  80352e:	eb ed                	jmp    80351d <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803530:	48 98                	cltq
+  803532:	eb e9                	jmp    80351d <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803534:	48 98                	cltq
+  803536:	48 85 db             	test   %rbx,%rbx
+  803539:	48 0f 45 c3          	cmovne %rbx,%rax
+  80353d:	eb de                	jmp    80351d <fmap+0xfe>
+    size_t i = 0;
+  80353f:	4c 89 eb             	mov    %r13,%rbx
+  803542:	eb d6                	jmp    80351a <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803544:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80354b:	eb d0                	jmp    80351d <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80354d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803554:	eb c7                	jmp    80351d <fmap+0xfe>
+  803556:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80355d:	eb be                	jmp    80351d <fmap+0xfe>
+  80355f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803566:	eb b5                	jmp    80351d <fmap+0xfe>
+
+0000000000803568 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803568:	55                   	push   %rbp
+  803569:	48 89 e5             	mov    %rsp,%rbp
+  80356c:	41 56                	push   %r14
+  80356e:	41 55                	push   %r13
+  803570:	41 54                	push   %r12
+  803572:	53                   	push   %rbx
+  803573:	48 83 ec 10          	sub    $0x10,%rsp
+  803577:	89 fb                	mov    %edi,%ebx
+  803579:	41 89 f4             	mov    %esi,%r12d
+  80357c:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80357f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803583:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  80358a:	00 00 00 
+  80358d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80358f:	85 c0                	test   %eax,%eax
+  803591:	78 63                	js     8035f6 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803593:	45 85 e4             	test   %r12d,%r12d
+  803596:	0f 88 80 00 00 00    	js     80361c <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80359c:	45 89 e6             	mov    %r12d,%r14d
+  80359f:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8035a6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035aa:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  8035b1:	00 00 00 
+  8035b4:	ff d0                	call   *%rax
+  8035b6:	48 89 c2             	mov    %rax,%rdx
+  8035b9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8035be:	44 89 f6             	mov    %r14d,%esi
+  8035c1:	89 df                	mov    %ebx,%edi
+  8035c3:	48 b8 1f 34 80 00 00 	movabs $0x80341f,%rax
+  8035ca:	00 00 00 
+  8035cd:	ff d0                	call   *%rax
+  8035cf:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8035d2:	45 29 f4             	sub    %r14d,%r12d
+  8035d5:	4d 63 f4             	movslq %r12d,%r14
+  8035d8:	49 39 c6             	cmp    %rax,%r14
+  8035db:	7c 1d                	jl     8035fa <read_map+0x92>
+  8035dd:	48 85 c0             	test   %rax,%rax
+  8035e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e5:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8035e9:	48 83 c4 10          	add    $0x10,%rsp
+  8035ed:	5b                   	pop    %rbx
+  8035ee:	41 5c                	pop    %r12
+  8035f0:	41 5d                	pop    %r13
+  8035f2:	41 5e                	pop    %r14
+  8035f4:	5d                   	pop    %rbp
+  8035f5:	c3                   	ret
+    if (res < 0) return res;
+  8035f6:	48 98                	cltq
+  8035f8:	eb ef                	jmp    8035e9 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8035fa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035fe:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  803605:	00 00 00 
+  803608:	ff d0                	call   *%rax
+  80360a:	4d 63 e4             	movslq %r12d,%r12
+  80360d:	4c 01 e0             	add    %r12,%rax
+  803610:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803614:	48 89 d8             	mov    %rbx,%rax
+  803617:	4c 29 f0             	sub    %r14,%rax
+  80361a:	eb cd                	jmp    8035e9 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  80361c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803623:	eb c4                	jmp    8035e9 <read_map+0x81>
+
+0000000000803625 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803625:	55                   	push   %rbp
+  803626:	48 89 e5             	mov    %rsp,%rbp
+  803629:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80362d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803631:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  803638:	00 00 00 
+  80363b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80363d:	85 c0                	test   %eax,%eax
+  80363f:	78 4a                	js     80368b <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803641:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803645:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80364c:	00 00 00 
+  80364f:	8b 00                	mov    (%rax),%eax
+  803651:	39 07                	cmp    %eax,(%rdi)
+  803653:	75 38                	jne    80368d <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803655:	48 b8 af 2b 80 00 00 	movabs $0x802baf,%rax
+  80365c:	00 00 00 
+  80365f:	ff d0                	call   *%rax
+  803661:	85 c0                	test   %eax,%eax
+  803663:	78 26                	js     80368b <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803665:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803669:	8b 40 0c             	mov    0xc(%rax),%eax
+  80366c:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803673:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803675:	be 00 00 00 00       	mov    $0x0,%esi
+  80367a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80367f:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  803686:	00 00 00 
+  803689:	ff d0                	call   *%rax
+}
+  80368b:	c9                   	leave
+  80368c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80368d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803692:	eb f7                	jmp    80368b <fsync+0x66>
+
+0000000000803694 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803694:	55                   	push   %rbp
+  803695:	48 89 e5             	mov    %rsp,%rbp
+  803698:	41 57                	push   %r15
+  80369a:	41 56                	push   %r14
+  80369c:	41 55                	push   %r13
+  80369e:	41 54                	push   %r12
+  8036a0:	53                   	push   %rbx
+  8036a1:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8036a5:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8036ac:	00 00 00 
+  8036af:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8036b4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8036ba:	49 bd 77 20 80 00 00 	movabs $0x802077,%r13
+  8036c1:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8036c4:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8036cb:	00 00 00 
+  8036ce:	eb 0c                	jmp    8036dc <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8036d0:	83 c3 01             	add    $0x1,%ebx
+  8036d3:	49 83 c4 28          	add    $0x28,%r12
+  8036d7:	83 fb 20             	cmp    $0x20,%ebx
+  8036da:	74 33                	je     80370f <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8036dc:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8036e1:	74 ed                	je     8036d0 <flushall+0x3c>
+  8036e3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8036e7:	89 df                	mov    %ebx,%edi
+  8036e9:	41 ff d5             	call   *%r13
+  8036ec:	85 c0                	test   %eax,%eax
+  8036ee:	78 e0                	js     8036d0 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8036f0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8036f4:	41 8b 06             	mov    (%r14),%eax
+  8036f7:	39 07                	cmp    %eax,(%rdi)
+  8036f9:	75 d5                	jne    8036d0 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8036fb:	48 b8 af 2b 80 00 00 	movabs $0x802baf,%rax
+  803702:	00 00 00 
+  803705:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803707:	85 c0                	test   %eax,%eax
+  803709:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80370d:	eb c1                	jmp    8036d0 <flushall+0x3c>
+    }
+    return res;
+}
+  80370f:	44 89 f8             	mov    %r15d,%eax
+  803712:	48 83 c4 18          	add    $0x18,%rsp
+  803716:	5b                   	pop    %rbx
+  803717:	41 5c                	pop    %r12
+  803719:	41 5d                	pop    %r13
+  80371b:	41 5e                	pop    %r14
+  80371d:	41 5f                	pop    %r15
+  80371f:	5d                   	pop    %rbp
+  803720:	c3                   	ret
+
+0000000000803721 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803721:	55                   	push   %rbp
+  803722:	48 89 e5             	mov    %rsp,%rbp
+  803725:	53                   	push   %rbx
+  803726:	48 83 ec 08          	sub    $0x8,%rsp
+  80372a:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80372d:	40 0f b6 c6          	movzbl %sil,%eax
+  803731:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803738:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  80373a:	be 00 00 00 00       	mov    $0x0,%esi
+  80373f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803744:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  80374b:	00 00 00 
+  80374e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803750:	85 c0                	test   %eax,%eax
+  803752:	78 23                	js     803777 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803754:	ba 58 06 00 00       	mov    $0x658,%edx
+  803759:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803760:	00 00 00 
+  803763:	48 89 df             	mov    %rbx,%rdi
+  803766:	48 b8 68 12 80 00 00 	movabs $0x801268,%rax
+  80376d:	00 00 00 
+  803770:	ff d0                	call   *%rax
+    return 0;
+  803772:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803777:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80377b:	c9                   	leave
+  80377c:	c3                   	ret
+
+000000000080377d <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80377d:	55                   	push   %rbp
+  80377e:	48 89 e5             	mov    %rsp,%rbp
+  803781:	53                   	push   %rbx
+  803782:	48 83 ec 08          	sub    $0x8,%rsp
+  803786:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803789:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  803790:	00 00 00 
+  803793:	ff d0                	call   *%rax
+  803795:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80379b:	77 35                	ja     8037d2 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80379d:	48 89 de             	mov    %rbx,%rsi
+  8037a0:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8037a7:	00 00 00 
+  8037aa:	48 b8 73 0e 80 00 00 	movabs $0x800e73,%rax
+  8037b1:	00 00 00 
+  8037b4:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8037b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8037bb:	bf 07 00 00 00       	mov    $0x7,%edi
+  8037c0:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  8037c7:	00 00 00 
+  8037ca:	ff d0                	call   *%rax
+}
+  8037cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037d0:	c9                   	leave
+  8037d1:	c3                   	ret
+        return -E_BAD_PATH;
+  8037d2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8037d7:	eb f3                	jmp    8037cc <remove+0x4f>
+
+00000000008037d9 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8037d9:	55                   	push   %rbp
+  8037da:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8037dd:	48 b8 94 36 80 00 00 	movabs $0x803694,%rax
+  8037e4:	00 00 00 
+  8037e7:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8037e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ee:	bf 08 00 00 00       	mov    $0x8,%edi
+  8037f3:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  8037fa:	00 00 00 
+  8037fd:	ff d0                	call   *%rax
+}
+  8037ff:	5d                   	pop    %rbp
+  803800:	c3                   	ret
+
+0000000000803801 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803801:	55                   	push   %rbp
+  803802:	48 89 e5             	mov    %rsp,%rbp
+  803805:	41 54                	push   %r12
+  803807:	53                   	push   %rbx
+  803808:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80380b:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  803812:	00 00 00 
+  803815:	ff d0                	call   *%rax
+  803817:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80381a:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  803821:	00 00 00 
+  803824:	48 89 df             	mov    %rbx,%rdi
+  803827:	48 b8 73 0e 80 00 00 	movabs $0x800e73,%rax
+  80382e:	00 00 00 
+  803831:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803833:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803838:	41 2b 04 24          	sub    (%r12),%eax
+  80383c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803842:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803849:	00 00 00 
+    stat->st_dev = &devpipe;
+  80384c:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803853:	00 00 00 
+  803856:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80385d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803862:	5b                   	pop    %rbx
+  803863:	41 5c                	pop    %r12
+  803865:	5d                   	pop    %rbp
+  803866:	c3                   	ret
+
+0000000000803867 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803867:	55                   	push   %rbp
+  803868:	48 89 e5             	mov    %rsp,%rbp
+  80386b:	41 54                	push   %r12
+  80386d:	53                   	push   %rbx
+  80386e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803871:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803876:	48 89 fe             	mov    %rdi,%rsi
+  803879:	bf 00 00 00 00       	mov    $0x0,%edi
+  80387e:	49 bc b2 17 80 00 00 	movabs $0x8017b2,%r12
+  803885:	00 00 00 
+  803888:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80388b:	48 89 df             	mov    %rbx,%rdi
+  80388e:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  803895:	00 00 00 
+  803898:	ff d0                	call   *%rax
+  80389a:	48 89 c6             	mov    %rax,%rsi
+  80389d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038a7:	41 ff d4             	call   *%r12
+}
+  8038aa:	5b                   	pop    %rbx
+  8038ab:	41 5c                	pop    %r12
+  8038ad:	5d                   	pop    %rbp
+  8038ae:	c3                   	ret
+
+00000000008038af <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038af:	55                   	push   %rbp
+  8038b0:	48 89 e5             	mov    %rsp,%rbp
+  8038b3:	41 57                	push   %r15
+  8038b5:	41 56                	push   %r14
+  8038b7:	41 55                	push   %r13
+  8038b9:	41 54                	push   %r12
+  8038bb:	53                   	push   %rbx
+  8038bc:	48 83 ec 18          	sub    $0x18,%rsp
+  8038c0:	49 89 fc             	mov    %rdi,%r12
+  8038c3:	49 89 f5             	mov    %rsi,%r13
+  8038c6:	49 89 d7             	mov    %rdx,%r15
+  8038c9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038cd:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  8038d4:	00 00 00 
+  8038d7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8038d9:	4d 85 ff             	test   %r15,%r15
+  8038dc:	0f 84 af 00 00 00    	je     803991 <devpipe_write+0xe2>
+  8038e2:	48 89 c3             	mov    %rax,%rbx
+  8038e5:	4c 89 f8             	mov    %r15,%rax
+  8038e8:	4d 89 ef             	mov    %r13,%r15
+  8038eb:	4c 01 e8             	add    %r13,%rax
+  8038ee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8038f2:	49 bd a7 15 80 00 00 	movabs $0x8015a7,%r13
+  8038f9:	00 00 00 
+            sys_yield();
+  8038fc:	49 be 44 15 80 00 00 	movabs $0x801544,%r14
+  803903:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803906:	8b 73 04             	mov    0x4(%rbx),%esi
+  803909:	48 63 ce             	movslq %esi,%rcx
+  80390c:	48 63 03             	movslq (%rbx),%rax
+  80390f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803915:	48 39 c1             	cmp    %rax,%rcx
+  803918:	72 2e                	jb     803948 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80391a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80391f:	48 89 da             	mov    %rbx,%rdx
+  803922:	be 00 10 00 00       	mov    $0x1000,%esi
+  803927:	4c 89 e7             	mov    %r12,%rdi
+  80392a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80392d:	85 c0                	test   %eax,%eax
+  80392f:	74 66                	je     803997 <devpipe_write+0xe8>
+            sys_yield();
+  803931:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803934:	8b 73 04             	mov    0x4(%rbx),%esi
+  803937:	48 63 ce             	movslq %esi,%rcx
+  80393a:	48 63 03             	movslq (%rbx),%rax
+  80393d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803943:	48 39 c1             	cmp    %rax,%rcx
+  803946:	73 d2                	jae    80391a <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803948:	41 0f b6 3f          	movzbl (%r15),%edi
+  80394c:	48 89 ca             	mov    %rcx,%rdx
+  80394f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803953:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80395a:	08 10 20 
+  80395d:	48 f7 e2             	mul    %rdx
+  803960:	48 c1 ea 06          	shr    $0x6,%rdx
+  803964:	48 89 d0             	mov    %rdx,%rax
+  803967:	48 c1 e0 09          	shl    $0x9,%rax
+  80396b:	48 29 d0             	sub    %rdx,%rax
+  80396e:	48 c1 e0 03          	shl    $0x3,%rax
+  803972:	48 29 c1             	sub    %rax,%rcx
+  803975:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80397a:	83 c6 01             	add    $0x1,%esi
+  80397d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803980:	49 83 c7 01          	add    $0x1,%r15
+  803984:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803988:	49 39 c7             	cmp    %rax,%r15
+  80398b:	0f 85 75 ff ff ff    	jne    803906 <devpipe_write+0x57>
+    return n;
+  803991:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803995:	eb 05                	jmp    80399c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803997:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80399c:	48 83 c4 18          	add    $0x18,%rsp
+  8039a0:	5b                   	pop    %rbx
+  8039a1:	41 5c                	pop    %r12
+  8039a3:	41 5d                	pop    %r13
+  8039a5:	41 5e                	pop    %r14
+  8039a7:	41 5f                	pop    %r15
+  8039a9:	5d                   	pop    %rbp
+  8039aa:	c3                   	ret
+
+00000000008039ab <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039ab:	55                   	push   %rbp
+  8039ac:	48 89 e5             	mov    %rsp,%rbp
+  8039af:	41 57                	push   %r15
+  8039b1:	41 56                	push   %r14
+  8039b3:	41 55                	push   %r13
+  8039b5:	41 54                	push   %r12
+  8039b7:	53                   	push   %rbx
+  8039b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8039bc:	49 89 fc             	mov    %rdi,%r12
+  8039bf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8039c3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039c7:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  8039ce:	00 00 00 
+  8039d1:	ff d0                	call   *%rax
+  8039d3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8039d6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039dc:	49 bd a7 15 80 00 00 	movabs $0x8015a7,%r13
+  8039e3:	00 00 00 
+            sys_yield();
+  8039e6:	49 be 44 15 80 00 00 	movabs $0x801544,%r14
+  8039ed:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8039f0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8039f5:	74 7d                	je     803a74 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8039f7:	8b 03                	mov    (%rbx),%eax
+  8039f9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8039fc:	75 26                	jne    803a24 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8039fe:	4d 85 ff             	test   %r15,%r15
+  803a01:	75 77                	jne    803a7a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a03:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a08:	48 89 da             	mov    %rbx,%rdx
+  803a0b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a10:	4c 89 e7             	mov    %r12,%rdi
+  803a13:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803a16:	85 c0                	test   %eax,%eax
+  803a18:	74 72                	je     803a8c <devpipe_read+0xe1>
+            sys_yield();
+  803a1a:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803a1d:	8b 03                	mov    (%rbx),%eax
+  803a1f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803a22:	74 df                	je     803a03 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a24:	48 63 c8             	movslq %eax,%rcx
+  803a27:	48 89 ca             	mov    %rcx,%rdx
+  803a2a:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a2e:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803a35:	08 10 20 
+  803a38:	48 89 d0             	mov    %rdx,%rax
+  803a3b:	48 f7 e6             	mul    %rsi
+  803a3e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a42:	48 89 d0             	mov    %rdx,%rax
+  803a45:	48 c1 e0 09          	shl    $0x9,%rax
+  803a49:	48 29 d0             	sub    %rdx,%rax
+  803a4c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803a53:	00 
+  803a54:	48 89 c8             	mov    %rcx,%rax
+  803a57:	48 29 d0             	sub    %rdx,%rax
+  803a5a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803a5f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803a63:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803a67:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a6a:	49 83 c7 01          	add    $0x1,%r15
+  803a6e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803a72:	75 83                	jne    8039f7 <devpipe_read+0x4c>
+    return n;
+  803a74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a78:	eb 03                	jmp    803a7d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803a7a:	4c 89 f8             	mov    %r15,%rax
+}
+  803a7d:	48 83 c4 18          	add    $0x18,%rsp
+  803a81:	5b                   	pop    %rbx
+  803a82:	41 5c                	pop    %r12
+  803a84:	41 5d                	pop    %r13
+  803a86:	41 5e                	pop    %r14
+  803a88:	41 5f                	pop    %r15
+  803a8a:	5d                   	pop    %rbp
+  803a8b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a91:	eb ea                	jmp    803a7d <devpipe_read+0xd2>
+
+0000000000803a93 <pipe>:
+pipe(int pfd[2]) {
+  803a93:	55                   	push   %rbp
+  803a94:	48 89 e5             	mov    %rsp,%rbp
+  803a97:	41 55                	push   %r13
+  803a99:	41 54                	push   %r12
+  803a9b:	53                   	push   %rbx
+  803a9c:	48 83 ec 18          	sub    $0x18,%rsp
+  803aa0:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803aa3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803aa7:	48 b8 17 20 80 00 00 	movabs $0x802017,%rax
+  803aae:	00 00 00 
+  803ab1:	ff d0                	call   *%rax
+  803ab3:	89 c3                	mov    %eax,%ebx
+  803ab5:	85 c0                	test   %eax,%eax
+  803ab7:	0f 88 a0 01 00 00    	js     803c5d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803abd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ac2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ac7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803acb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ad0:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  803ad7:	00 00 00 
+  803ada:	ff d0                	call   *%rax
+  803adc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ade:	85 c0                	test   %eax,%eax
+  803ae0:	0f 88 77 01 00 00    	js     803c5d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ae6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803aea:	48 b8 17 20 80 00 00 	movabs $0x802017,%rax
+  803af1:	00 00 00 
+  803af4:	ff d0                	call   *%rax
+  803af6:	89 c3                	mov    %eax,%ebx
+  803af8:	85 c0                	test   %eax,%eax
+  803afa:	0f 88 43 01 00 00    	js     803c43 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b00:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b05:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b0a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803b0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b13:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  803b1a:	00 00 00 
+  803b1d:	ff d0                	call   *%rax
+  803b1f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b21:	85 c0                	test   %eax,%eax
+  803b23:	0f 88 1a 01 00 00    	js     803c43 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803b29:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b2d:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  803b34:	00 00 00 
+  803b37:	ff d0                	call   *%rax
+  803b39:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803b3c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b41:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b46:	48 89 c6             	mov    %rax,%rsi
+  803b49:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b4e:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  803b55:	00 00 00 
+  803b58:	ff d0                	call   *%rax
+  803b5a:	89 c3                	mov    %eax,%ebx
+  803b5c:	85 c0                	test   %eax,%eax
+  803b5e:	0f 88 c5 00 00 00    	js     803c29 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803b64:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803b68:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  803b6f:	00 00 00 
+  803b72:	ff d0                	call   *%rax
+  803b74:	48 89 c1             	mov    %rax,%rcx
+  803b77:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803b7d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803b83:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b88:	4c 89 ee             	mov    %r13,%rsi
+  803b8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b90:	48 b8 3a 16 80 00 00 	movabs $0x80163a,%rax
+  803b97:	00 00 00 
+  803b9a:	ff d0                	call   *%rax
+  803b9c:	89 c3                	mov    %eax,%ebx
+  803b9e:	85 c0                	test   %eax,%eax
+  803ba0:	78 6e                	js     803c10 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803ba2:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ba7:	4c 89 ef             	mov    %r13,%rdi
+  803baa:	48 b8 75 15 80 00 00 	movabs $0x801575,%rax
+  803bb1:	00 00 00 
+  803bb4:	ff d0                	call   *%rax
+  803bb6:	83 f8 02             	cmp    $0x2,%eax
+  803bb9:	0f 85 ab 00 00 00    	jne    803c6a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803bbf:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803bc6:	00 00 
+  803bc8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803bcc:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803bce:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803bd2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803bd9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803bdd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803bdf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803be3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803bea:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803bee:	48 bb e9 1f 80 00 00 	movabs $0x801fe9,%rbx
+  803bf5:	00 00 00 
+  803bf8:	ff d3                	call   *%rbx
+  803bfa:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803bfe:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c02:	ff d3                	call   *%rbx
+  803c04:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803c09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c0e:	eb 4d                	jmp    803c5d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803c10:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c15:	4c 89 ee             	mov    %r13,%rsi
+  803c18:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c1d:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  803c24:	00 00 00 
+  803c27:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803c29:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c2e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c32:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c37:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  803c3e:	00 00 00 
+  803c41:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803c43:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c48:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c51:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  803c58:	00 00 00 
+  803c5b:	ff d0                	call   *%rax
+}
+  803c5d:	89 d8                	mov    %ebx,%eax
+  803c5f:	48 83 c4 18          	add    $0x18,%rsp
+  803c63:	5b                   	pop    %rbx
+  803c64:	41 5c                	pop    %r12
+  803c66:	41 5d                	pop    %r13
+  803c68:	5d                   	pop    %rbp
+  803c69:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c6a:	48 b9 f0 56 80 00 00 	movabs $0x8056f0,%rcx
+  803c71:	00 00 00 
+  803c74:	48 ba c7 56 80 00 00 	movabs $0x8056c7,%rdx
+  803c7b:	00 00 00 
+  803c7e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803c83:	48 bf dc 56 80 00 00 	movabs $0x8056dc,%rdi
+  803c8a:	00 00 00 
+  803c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c92:	49 b8 72 42 80 00 00 	movabs $0x804272,%r8
+  803c99:	00 00 00 
+  803c9c:	41 ff d0             	call   *%r8
+
+0000000000803c9f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803c9f:	55                   	push   %rbp
+  803ca0:	48 89 e5             	mov    %rsp,%rbp
+  803ca3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ca7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803cab:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  803cb2:	00 00 00 
+  803cb5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cb7:	85 c0                	test   %eax,%eax
+  803cb9:	78 35                	js     803cf0 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803cbb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803cbf:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  803cc6:	00 00 00 
+  803cc9:	ff d0                	call   *%rax
+  803ccb:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803cce:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803cd3:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cd8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803cdc:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  803ce3:	00 00 00 
+  803ce6:	ff d0                	call   *%rax
+  803ce8:	85 c0                	test   %eax,%eax
+  803cea:	0f 94 c0             	sete   %al
+  803ced:	0f b6 c0             	movzbl %al,%eax
+}
+  803cf0:	c9                   	leave
+  803cf1:	c3                   	ret
+
+0000000000803cf2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803cf2:	48 89 f8             	mov    %rdi,%rax
+  803cf5:	48 c1 e8 27          	shr    $0x27,%rax
+  803cf9:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803d00:	7f 00 00 
+  803d03:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d07:	f6 c2 01             	test   $0x1,%dl
+  803d0a:	74 6d                	je     803d79 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d0c:	48 89 f8             	mov    %rdi,%rax
+  803d0f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d13:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d1a:	7f 00 00 
+  803d1d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d21:	f6 c2 01             	test   $0x1,%dl
+  803d24:	74 62                	je     803d88 <get_uvpt_entry+0x96>
+  803d26:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d2d:	7f 00 00 
+  803d30:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d34:	f6 c2 80             	test   $0x80,%dl
+  803d37:	75 4f                	jne    803d88 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d39:	48 89 f8             	mov    %rdi,%rax
+  803d3c:	48 c1 e8 15          	shr    $0x15,%rax
+  803d40:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d47:	7f 00 00 
+  803d4a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d4e:	f6 c2 01             	test   $0x1,%dl
+  803d51:	74 44                	je     803d97 <get_uvpt_entry+0xa5>
+  803d53:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d5a:	7f 00 00 
+  803d5d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d61:	f6 c2 80             	test   $0x80,%dl
+  803d64:	75 31                	jne    803d97 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803d66:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803d6a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d71:	7f 00 00 
+  803d74:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803d78:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d79:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803d80:	7f 00 00 
+  803d83:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d87:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d88:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d8f:	7f 00 00 
+  803d92:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d96:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d97:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d9e:	7f 00 00 
+  803da1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803da5:	c3                   	ret
+
+0000000000803da6 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803da6:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803da9:	48 89 f9             	mov    %rdi,%rcx
+  803dac:	48 c1 e9 27          	shr    $0x27,%rcx
+  803db0:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803db7:	7f 00 00 
+  803dba:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803dbe:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803dc5:	f6 c1 01             	test   $0x1,%cl
+  803dc8:	0f 84 b2 00 00 00    	je     803e80 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803dce:	48 89 f9             	mov    %rdi,%rcx
+  803dd1:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803dd5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ddc:	7f 00 00 
+  803ddf:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803de3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803dea:	40 f6 c6 01          	test   $0x1,%sil
+  803dee:	0f 84 8c 00 00 00    	je     803e80 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803df4:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803dfb:	7f 00 00 
+  803dfe:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e02:	a8 80                	test   $0x80,%al
+  803e04:	75 7b                	jne    803e81 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e06:	48 89 f9             	mov    %rdi,%rcx
+  803e09:	48 c1 e9 15          	shr    $0x15,%rcx
+  803e0d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e14:	7f 00 00 
+  803e17:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e1b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e22:	40 f6 c6 01          	test   $0x1,%sil
+  803e26:	74 58                	je     803e80 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803e28:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e2f:	7f 00 00 
+  803e32:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e36:	a8 80                	test   $0x80,%al
+  803e38:	75 6c                	jne    803ea6 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e3a:	48 89 f9             	mov    %rdi,%rcx
+  803e3d:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803e41:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e48:	7f 00 00 
+  803e4b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e4f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e56:	40 f6 c6 01          	test   $0x1,%sil
+  803e5a:	74 24                	je     803e80 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803e5c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e63:	7f 00 00 
+  803e66:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e6a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e71:	ff ff 7f 
+  803e74:	48 21 c8             	and    %rcx,%rax
+  803e77:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803e7d:	48 09 d0             	or     %rdx,%rax
+}
+  803e80:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803e81:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e88:	7f 00 00 
+  803e8b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e8f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e96:	ff ff 7f 
+  803e99:	48 21 c8             	and    %rcx,%rax
+  803e9c:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803ea2:	48 01 d0             	add    %rdx,%rax
+  803ea5:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803ea6:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ead:	7f 00 00 
+  803eb0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803eb4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ebb:	ff ff 7f 
+  803ebe:	48 21 c8             	and    %rcx,%rax
+  803ec1:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803ec7:	48 01 d0             	add    %rdx,%rax
+  803eca:	c3                   	ret
+
+0000000000803ecb <get_prot>:
+
+int
+get_prot(void *va) {
+  803ecb:	55                   	push   %rbp
+  803ecc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ecf:	48 b8 f2 3c 80 00 00 	movabs $0x803cf2,%rax
+  803ed6:	00 00 00 
+  803ed9:	ff d0                	call   *%rax
+  803edb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803ede:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803ee3:	89 c1                	mov    %eax,%ecx
+  803ee5:	83 c9 04             	or     $0x4,%ecx
+  803ee8:	f6 c2 01             	test   $0x1,%dl
+  803eeb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803eee:	89 c1                	mov    %eax,%ecx
+  803ef0:	83 c9 02             	or     $0x2,%ecx
+  803ef3:	f6 c2 02             	test   $0x2,%dl
+  803ef6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803ef9:	89 c1                	mov    %eax,%ecx
+  803efb:	83 c9 01             	or     $0x1,%ecx
+  803efe:	48 85 d2             	test   %rdx,%rdx
+  803f01:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803f04:	89 c1                	mov    %eax,%ecx
+  803f06:	83 c9 40             	or     $0x40,%ecx
+  803f09:	f6 c6 04             	test   $0x4,%dh
+  803f0c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803f0f:	5d                   	pop    %rbp
+  803f10:	c3                   	ret
+
+0000000000803f11 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803f11:	55                   	push   %rbp
+  803f12:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f15:	48 b8 f2 3c 80 00 00 	movabs $0x803cf2,%rax
+  803f1c:	00 00 00 
+  803f1f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803f21:	48 c1 e8 06          	shr    $0x6,%rax
+  803f25:	83 e0 01             	and    $0x1,%eax
+}
+  803f28:	5d                   	pop    %rbp
+  803f29:	c3                   	ret
+
+0000000000803f2a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803f2a:	55                   	push   %rbp
+  803f2b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803f2e:	48 b8 f2 3c 80 00 00 	movabs $0x803cf2,%rax
+  803f35:	00 00 00 
+  803f38:	ff d0                	call   *%rax
+  803f3a:	83 e0 01             	and    $0x1,%eax
+}
+  803f3d:	5d                   	pop    %rbp
+  803f3e:	c3                   	ret
+
+0000000000803f3f <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803f3f:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803f46:	7f 00 00 
+  803f49:	a8 01                	test   $0x1,%al
+  803f4b:	75 06                	jne    803f53 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f52:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803f53:	55                   	push   %rbp
+  803f54:	48 89 e5             	mov    %rsp,%rbp
+  803f57:	41 57                	push   %r15
+  803f59:	41 56                	push   %r14
+  803f5b:	41 55                	push   %r13
+  803f5d:	41 54                	push   %r12
+  803f5f:	53                   	push   %rbx
+  803f60:	48 83 ec 18          	sub    $0x18,%rsp
+  803f64:	49 89 fe             	mov    %rdi,%r14
+  803f67:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803f6a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803f71:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803f72:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803f79:	7f 00 00 
+  803f7c:	e9 81 00 00 00       	jmp    804002 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803f81:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803f88:	49 39 dd             	cmp    %rbx,%r13
+  803f8b:	74 2b                	je     803fb8 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803f8d:	48 89 d8             	mov    %rbx,%rax
+  803f90:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f94:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803f98:	f6 c2 01             	test   $0x1,%dl
+  803f9b:	74 e4                	je     803f81 <foreach_shared_region+0x42>
+  803f9d:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803fa1:	f6 c4 04             	test   $0x4,%ah
+  803fa4:	74 db                	je     803f81 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803fa6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803fad:	4c 89 fa             	mov    %r15,%rdx
+  803fb0:	48 89 df             	mov    %rbx,%rdi
+  803fb3:	41 ff d6             	call   *%r14
+  803fb6:	eb c9                	jmp    803f81 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803fb8:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803fbf:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803fc3:	74 22                	je     803fe7 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803fc5:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803fcc:	48 89 d8             	mov    %rbx,%rax
+  803fcf:	48 c1 e8 15          	shr    $0x15,%rax
+  803fd3:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803fda:	7f 00 00 
+  803fdd:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803fe1:	a8 01                	test   $0x1,%al
+  803fe3:	74 d3                	je     803fb8 <foreach_shared_region+0x79>
+  803fe5:	eb a6                	jmp    803f8d <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803fe7:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803fee:	40 
+  803fef:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803ff3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ffa:	00 00 00 
+  803ffd:	48 39 c1             	cmp    %rax,%rcx
+  804000:	74 31                	je     804033 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804002:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804006:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80400a:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804011:	7f 00 00 
+  804014:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804018:	a8 01                	test   $0x1,%al
+  80401a:	74 cb                	je     803fe7 <foreach_shared_region+0xa8>
+  80401c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804020:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804027:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  80402d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804031:	eb 92                	jmp    803fc5 <foreach_shared_region+0x86>
+}
+  804033:	b8 00 00 00 00       	mov    $0x0,%eax
+  804038:	48 83 c4 18          	add    $0x18,%rsp
+  80403c:	5b                   	pop    %rbx
+  80403d:	41 5c                	pop    %r12
+  80403f:	41 5d                	pop    %r13
+  804041:	41 5e                	pop    %r14
+  804043:	41 5f                	pop    %r15
+  804045:	5d                   	pop    %rbp
+  804046:	c3                   	ret
+
+0000000000804047 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80404c:	c3                   	ret
+
+000000000080404d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80404d:	55                   	push   %rbp
+  80404e:	48 89 e5             	mov    %rsp,%rbp
+  804051:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804054:	48 be 14 57 80 00 00 	movabs $0x805714,%rsi
+  80405b:	00 00 00 
+  80405e:	48 b8 73 0e 80 00 00 	movabs $0x800e73,%rax
+  804065:	00 00 00 
+  804068:	ff d0                	call   *%rax
+    return 0;
+}
+  80406a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80406f:	5d                   	pop    %rbp
+  804070:	c3                   	ret
+
+0000000000804071 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804071:	55                   	push   %rbp
+  804072:	48 89 e5             	mov    %rsp,%rbp
+  804075:	41 57                	push   %r15
+  804077:	41 56                	push   %r14
+  804079:	41 55                	push   %r13
+  80407b:	41 54                	push   %r12
+  80407d:	53                   	push   %rbx
+  80407e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804085:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80408c:	48 85 d2             	test   %rdx,%rdx
+  80408f:	74 7a                	je     80410b <devcons_write+0x9a>
+  804091:	49 89 d6             	mov    %rdx,%r14
+  804094:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80409a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80409f:	49 bf 01 12 80 00 00 	movabs $0x801201,%r15
+  8040a6:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8040a9:	4c 89 f3             	mov    %r14,%rbx
+  8040ac:	48 29 f3             	sub    %rsi,%rbx
+  8040af:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8040b4:	48 39 c3             	cmp    %rax,%rbx
+  8040b7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8040bb:	4c 63 eb             	movslq %ebx,%r13
+  8040be:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8040c5:	48 01 c6             	add    %rax,%rsi
+  8040c8:	4c 89 ea             	mov    %r13,%rdx
+  8040cb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8040d2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8040d5:	4c 89 ee             	mov    %r13,%rsi
+  8040d8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8040df:	48 b8 4a 14 80 00 00 	movabs $0x80144a,%rax
+  8040e6:	00 00 00 
+  8040e9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8040eb:	41 01 dc             	add    %ebx,%r12d
+  8040ee:	49 63 f4             	movslq %r12d,%rsi
+  8040f1:	4c 39 f6             	cmp    %r14,%rsi
+  8040f4:	72 b3                	jb     8040a9 <devcons_write+0x38>
+    return res;
+  8040f6:	49 63 c4             	movslq %r12d,%rax
+}
+  8040f9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804100:	5b                   	pop    %rbx
+  804101:	41 5c                	pop    %r12
+  804103:	41 5d                	pop    %r13
+  804105:	41 5e                	pop    %r14
+  804107:	41 5f                	pop    %r15
+  804109:	5d                   	pop    %rbp
+  80410a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80410b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804111:	eb e3                	jmp    8040f6 <devcons_write+0x85>
+
+0000000000804113 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804113:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80411b:	48 85 c0             	test   %rax,%rax
+  80411e:	74 55                	je     804175 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804120:	55                   	push   %rbp
+  804121:	48 89 e5             	mov    %rsp,%rbp
+  804124:	41 55                	push   %r13
+  804126:	41 54                	push   %r12
+  804128:	53                   	push   %rbx
+  804129:	48 83 ec 08          	sub    $0x8,%rsp
+  80412d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804130:	48 bb 77 14 80 00 00 	movabs $0x801477,%rbx
+  804137:	00 00 00 
+  80413a:	49 bc 44 15 80 00 00 	movabs $0x801544,%r12
+  804141:	00 00 00 
+  804144:	eb 03                	jmp    804149 <devcons_read+0x36>
+  804146:	41 ff d4             	call   *%r12
+  804149:	ff d3                	call   *%rbx
+  80414b:	85 c0                	test   %eax,%eax
+  80414d:	74 f7                	je     804146 <devcons_read+0x33>
+    if (c < 0) return c;
+  80414f:	48 63 d0             	movslq %eax,%rdx
+  804152:	78 13                	js     804167 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804154:	ba 00 00 00 00       	mov    $0x0,%edx
+  804159:	83 f8 04             	cmp    $0x4,%eax
+  80415c:	74 09                	je     804167 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80415e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804162:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804167:	48 89 d0             	mov    %rdx,%rax
+  80416a:	48 83 c4 08          	add    $0x8,%rsp
+  80416e:	5b                   	pop    %rbx
+  80416f:	41 5c                	pop    %r12
+  804171:	41 5d                	pop    %r13
+  804173:	5d                   	pop    %rbp
+  804174:	c3                   	ret
+  804175:	48 89 d0             	mov    %rdx,%rax
+  804178:	c3                   	ret
+
+0000000000804179 <cputchar>:
+cputchar(int ch) {
+  804179:	55                   	push   %rbp
+  80417a:	48 89 e5             	mov    %rsp,%rbp
+  80417d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804181:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804185:	be 01 00 00 00       	mov    $0x1,%esi
+  80418a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80418e:	48 b8 4a 14 80 00 00 	movabs $0x80144a,%rax
+  804195:	00 00 00 
+  804198:	ff d0                	call   *%rax
+}
+  80419a:	c9                   	leave
+  80419b:	c3                   	ret
+
+000000000080419c <getchar>:
+getchar(void) {
+  80419c:	55                   	push   %rbp
+  80419d:	48 89 e5             	mov    %rsp,%rbp
+  8041a0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8041a4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041a9:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8041ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041b2:	48 b8 5a 23 80 00 00 	movabs $0x80235a,%rax
+  8041b9:	00 00 00 
+  8041bc:	ff d0                	call   *%rax
+  8041be:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8041c0:	85 c0                	test   %eax,%eax
+  8041c2:	78 06                	js     8041ca <getchar+0x2e>
+  8041c4:	74 08                	je     8041ce <getchar+0x32>
+  8041c6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8041ca:	89 d0                	mov    %edx,%eax
+  8041cc:	c9                   	leave
+  8041cd:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8041ce:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8041d3:	eb f5                	jmp    8041ca <getchar+0x2e>
+
+00000000008041d5 <iscons>:
+iscons(int fdnum) {
+  8041d5:	55                   	push   %rbp
+  8041d6:	48 89 e5             	mov    %rsp,%rbp
+  8041d9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041dd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041e1:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  8041e8:	00 00 00 
+  8041eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041ed:	85 c0                	test   %eax,%eax
+  8041ef:	78 18                	js     804209 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8041f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041f5:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8041fc:	00 00 00 
+  8041ff:	8b 00                	mov    (%rax),%eax
+  804201:	39 02                	cmp    %eax,(%rdx)
+  804203:	0f 94 c0             	sete   %al
+  804206:	0f b6 c0             	movzbl %al,%eax
+}
+  804209:	c9                   	leave
+  80420a:	c3                   	ret
+
+000000000080420b <opencons>:
+opencons(void) {
+  80420b:	55                   	push   %rbp
+  80420c:	48 89 e5             	mov    %rsp,%rbp
+  80420f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804213:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804217:	48 b8 17 20 80 00 00 	movabs $0x802017,%rax
+  80421e:	00 00 00 
+  804221:	ff d0                	call   *%rax
+  804223:	85 c0                	test   %eax,%eax
+  804225:	78 49                	js     804270 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804227:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80422c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804231:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804235:	bf 00 00 00 00       	mov    $0x0,%edi
+  80423a:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  804241:	00 00 00 
+  804244:	ff d0                	call   *%rax
+  804246:	85 c0                	test   %eax,%eax
+  804248:	78 26                	js     804270 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80424a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80424e:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804255:	00 00 
+  804257:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804259:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80425d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804264:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  80426b:	00 00 00 
+  80426e:	ff d0                	call   *%rax
+}
+  804270:	c9                   	leave
+  804271:	c3                   	ret
+
+0000000000804272 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804272:	55                   	push   %rbp
+  804273:	48 89 e5             	mov    %rsp,%rbp
+  804276:	41 56                	push   %r14
+  804278:	41 55                	push   %r13
+  80427a:	41 54                	push   %r12
+  80427c:	53                   	push   %rbx
+  80427d:	48 83 ec 50          	sub    $0x50,%rsp
+  804281:	49 89 fc             	mov    %rdi,%r12
+  804284:	41 89 f5             	mov    %esi,%r13d
+  804287:	48 89 d3             	mov    %rdx,%rbx
+  80428a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80428e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  804292:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804296:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80429d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042a1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8042a5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8042a9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8042ad:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8042b4:	00 00 00 
+  8042b7:	4c 8b 30             	mov    (%rax),%r14
+  8042ba:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  8042c1:	00 00 00 
+  8042c4:	ff d0                	call   *%rax
+  8042c6:	89 c6                	mov    %eax,%esi
+  8042c8:	45 89 e8             	mov    %r13d,%r8d
+  8042cb:	4c 89 e1             	mov    %r12,%rcx
+  8042ce:	4c 89 f2             	mov    %r14,%rdx
+  8042d1:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  8042d8:	00 00 00 
+  8042db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e0:	49 bc fb 04 80 00 00 	movabs $0x8004fb,%r12
+  8042e7:	00 00 00 
+  8042ea:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8042ed:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8042f1:	48 89 df             	mov    %rbx,%rdi
+  8042f4:	48 b8 97 04 80 00 00 	movabs $0x800497,%rax
+  8042fb:	00 00 00 
+  8042fe:	ff d0                	call   *%rax
+    cprintf("\n");
+  804300:	48 bf 63 56 80 00 00 	movabs $0x805663,%rdi
+  804307:	00 00 00 
+  80430a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80430f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804312:	cc                   	int3
+  804313:	eb fd                	jmp    804312 <_panic+0xa0>
+
+0000000000804315 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804315:	55                   	push   %rbp
+  804316:	48 89 e5             	mov    %rsp,%rbp
+  804319:	41 55                	push   %r13
+  80431b:	41 54                	push   %r12
+  80431d:	53                   	push   %rbx
+  80431e:	48 83 ec 08          	sub    $0x8,%rsp
+  804322:	49 89 fc             	mov    %rdi,%r12
+  804325:	48 89 f7             	mov    %rsi,%rdi
+  804328:	48 89 d3             	mov    %rdx,%rbx
+  80432b:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80432e:	48 85 f6             	test   %rsi,%rsi
+  804331:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804338:	00 00 00 
+  80433b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80433f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804344:	48 85 d2             	test   %rdx,%rdx
+  804347:	74 03                	je     80434c <ipc_recv+0x37>
+  804349:	48 8b 32             	mov    (%rdx),%rsi
+  80434c:	48 b8 80 19 80 00 00 	movabs $0x801980,%rax
+  804353:	00 00 00 
+  804356:	ff d0                	call   *%rax
+    if (errno) {
+  804358:	85 c0                	test   %eax,%eax
+  80435a:	74 1c                	je     804378 <ipc_recv+0x63>
+        if (from_env_store)
+  80435c:	4d 85 e4             	test   %r12,%r12
+  80435f:	74 08                	je     804369 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804361:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804368:	00 
+
+        if (perm_store)
+  804369:	4d 85 ed             	test   %r13,%r13
+  80436c:	74 74                	je     8043e2 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80436e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804375:	00 
+  804376:	eb 6a                	jmp    8043e2 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804378:	4d 85 e4             	test   %r12,%r12
+  80437b:	74 14                	je     804391 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80437d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804384:	00 00 00 
+  804387:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80438d:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804391:	48 85 db             	test   %rbx,%rbx
+  804394:	74 23                	je     8043b9 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804396:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80439d:	00 00 00 
+  8043a0:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8043a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043ab:	85 c9                	test   %ecx,%ecx
+  8043ad:	74 07                	je     8043b6 <ipc_recv+0xa1>
+  8043af:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8043b6:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8043b9:	4d 85 ed             	test   %r13,%r13
+  8043bc:	74 14                	je     8043d2 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8043be:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8043c5:	00 00 00 
+  8043c8:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8043ce:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8043d2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8043d9:	00 00 00 
+  8043dc:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8043e2:	48 83 c4 08          	add    $0x8,%rsp
+  8043e6:	5b                   	pop    %rbx
+  8043e7:	41 5c                	pop    %r12
+  8043e9:	41 5d                	pop    %r13
+  8043eb:	5d                   	pop    %rbp
+  8043ec:	c3                   	ret
+
+00000000008043ed <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8043ed:	55                   	push   %rbp
+  8043ee:	48 89 e5             	mov    %rsp,%rbp
+  8043f1:	41 55                	push   %r13
+  8043f3:	41 54                	push   %r12
+  8043f5:	53                   	push   %rbx
+  8043f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8043fa:	49 89 fc             	mov    %rdi,%r12
+  8043fd:	48 89 f7             	mov    %rsi,%rdi
+  804400:	48 89 d3             	mov    %rdx,%rbx
+  804403:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804406:	48 85 f6             	test   %rsi,%rsi
+  804409:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804410:	00 00 00 
+  804413:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804417:	be 00 10 00 00       	mov    $0x1000,%esi
+  80441c:	48 85 d2             	test   %rdx,%rdx
+  80441f:	74 03                	je     804424 <ipc_try_recv+0x37>
+  804421:	48 8b 32             	mov    (%rdx),%rsi
+  804424:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  80442b:	00 00 00 
+  80442e:	ff d0                	call   *%rax
+    if (errno) {
+  804430:	85 c0                	test   %eax,%eax
+  804432:	75 75                	jne    8044a9 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804434:	4d 85 e4             	test   %r12,%r12
+  804437:	74 14                	je     80444d <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804439:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804440:	00 00 00 
+  804443:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804449:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80444d:	48 85 db             	test   %rbx,%rbx
+  804450:	74 23                	je     804475 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804452:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804459:	00 00 00 
+  80445c:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804462:	ba 00 00 00 00       	mov    $0x0,%edx
+  804467:	85 c9                	test   %ecx,%ecx
+  804469:	74 07                	je     804472 <ipc_try_recv+0x85>
+  80446b:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804472:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804475:	4d 85 ed             	test   %r13,%r13
+  804478:	74 14                	je     80448e <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80447a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804481:	00 00 00 
+  804484:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80448a:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80448e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804495:	00 00 00 
+  804498:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80449e:	48 83 c4 08          	add    $0x8,%rsp
+  8044a2:	5b                   	pop    %rbx
+  8044a3:	41 5c                	pop    %r12
+  8044a5:	41 5d                	pop    %r13
+  8044a7:	5d                   	pop    %rbp
+  8044a8:	c3                   	ret
+        if (from_env_store)
+  8044a9:	4d 85 e4             	test   %r12,%r12
+  8044ac:	74 08                	je     8044b6 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8044ae:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8044b5:	00 
+        if (perm_store)
+  8044b6:	4d 85 ed             	test   %r13,%r13
+  8044b9:	74 e3                	je     80449e <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8044bb:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8044c2:	00 
+  8044c3:	eb d9                	jmp    80449e <ipc_try_recv+0xb1>
+
+00000000008044c5 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8044c5:	55                   	push   %rbp
+  8044c6:	48 89 e5             	mov    %rsp,%rbp
+  8044c9:	41 57                	push   %r15
+  8044cb:	41 56                	push   %r14
+  8044cd:	41 55                	push   %r13
+  8044cf:	41 54                	push   %r12
+  8044d1:	53                   	push   %rbx
+  8044d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8044d6:	41 89 fd             	mov    %edi,%r13d
+  8044d9:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8044dc:	48 89 d3             	mov    %rdx,%rbx
+  8044df:	49 89 cc             	mov    %rcx,%r12
+  8044e2:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8044e6:	48 85 d2             	test   %rdx,%rdx
+  8044e9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044f0:	00 00 00 
+  8044f3:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8044f7:	49 be 54 19 80 00 00 	movabs $0x801954,%r14
+  8044fe:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804501:	49 bf 44 15 80 00 00 	movabs $0x801544,%r15
+  804508:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80450b:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80450e:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804512:	4c 89 e1             	mov    %r12,%rcx
+  804515:	48 89 da             	mov    %rbx,%rdx
+  804518:	44 89 ef             	mov    %r13d,%edi
+  80451b:	41 ff d6             	call   *%r14
+  80451e:	85 c0                	test   %eax,%eax
+  804520:	74 37                	je     804559 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804522:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804525:	75 05                	jne    80452c <ipc_send+0x67>
+        sys_yield();
+  804527:	41 ff d7             	call   *%r15
+  80452a:	eb df                	jmp    80450b <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80452c:	89 c1                	mov    %eax,%ecx
+  80452e:	48 ba 43 57 80 00 00 	movabs $0x805743,%rdx
+  804535:	00 00 00 
+  804538:	be 65 00 00 00       	mov    $0x65,%esi
+  80453d:	48 bf 5e 57 80 00 00 	movabs $0x80575e,%rdi
+  804544:	00 00 00 
+  804547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80454c:	49 b8 72 42 80 00 00 	movabs $0x804272,%r8
+  804553:	00 00 00 
+  804556:	41 ff d0             	call   *%r8
+    }
+}
+  804559:	48 83 c4 18          	add    $0x18,%rsp
+  80455d:	5b                   	pop    %rbx
+  80455e:	41 5c                	pop    %r12
+  804560:	41 5d                	pop    %r13
+  804562:	41 5e                	pop    %r14
+  804564:	41 5f                	pop    %r15
+  804566:	5d                   	pop    %rbp
+  804567:	c3                   	ret
+
+0000000000804568 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804568:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80456d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804574:	00 00 00 
+  804577:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80457e:	48 01 ca             	add    %rcx,%rdx
+  804581:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804587:	39 fa                	cmp    %edi,%edx
+  804589:	74 12                	je     80459d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80458b:	48 83 c0 01          	add    $0x1,%rax
+  80458f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804595:	75 e0                	jne    804577 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804597:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80459c:	c3                   	ret
+            return envs[i].env_id;
+  80459d:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8045a4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8045ab:	00 00 00 
+  8045ae:	48 01 d0             	add    %rdx,%rax
+  8045b1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8045b7:	c3                   	ret
+
+00000000008045b8 <__text_end>:
+  8045b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bf:	00 00 00 
+  8045c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c9:	00 00 00 
+  8045cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d3:	00 00 00 
+  8045d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045dd:	00 00 00 
+  8045e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e7:	00 00 00 
+  8045ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f1:	00 00 00 
+  8045f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fb:	00 00 00 
+  8045fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804605:	00 00 00 
+  804608:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460f:	00 00 00 
+  804612:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804619:	00 00 00 
+  80461c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804623:	00 00 00 
+  804626:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462d:	00 00 00 
+  804630:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804637:	00 00 00 
+  80463a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804641:	00 00 00 
+  804644:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464b:	00 00 00 
+  80464e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804655:	00 00 00 
+  804658:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465f:	00 00 00 
+  804662:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804669:	00 00 00 
+  80466c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804673:	00 00 00 
+  804676:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467d:	00 00 00 
+  804680:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804687:	00 00 00 
+  80468a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804691:	00 00 00 
+  804694:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469b:	00 00 00 
+  80469e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a5:	00 00 00 
+  8046a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046af:	00 00 00 
+  8046b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b9:	00 00 00 
+  8046bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c3:	00 00 00 
+  8046c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cd:	00 00 00 
+  8046d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d7:	00 00 00 
+  8046da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e1:	00 00 00 
+  8046e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046eb:	00 00 00 
+  8046ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f5:	00 00 00 
+  8046f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ff:	00 00 00 
+  804702:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804709:	00 00 00 
+  80470c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804713:	00 00 00 
+  804716:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471d:	00 00 00 
+  804720:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804727:	00 00 00 
+  80472a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804731:	00 00 00 
+  804734:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473b:	00 00 00 
+  80473e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804745:	00 00 00 
+  804748:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474f:	00 00 00 
+  804752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804759:	00 00 00 
+  80475c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804763:	00 00 00 
+  804766:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476d:	00 00 00 
+  804770:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804777:	00 00 00 
+  80477a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804781:	00 00 00 
+  804784:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478b:	00 00 00 
+  80478e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804795:	00 00 00 
+  804798:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479f:	00 00 00 
+  8047a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a9:	00 00 00 
+  8047ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b3:	00 00 00 
+  8047b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bd:	00 00 00 
+  8047c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c7:	00 00 00 
+  8047ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d1:	00 00 00 
+  8047d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047db:	00 00 00 
+  8047de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e5:	00 00 00 
+  8047e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ef:	00 00 00 
+  8047f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f9:	00 00 00 
+  8047fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804803:	00 00 00 
+  804806:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480d:	00 00 00 
+  804810:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804817:	00 00 00 
+  80481a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804821:	00 00 00 
+  804824:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482b:	00 00 00 
+  80482e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804835:	00 00 00 
+  804838:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483f:	00 00 00 
+  804842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804849:	00 00 00 
+  80484c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804853:	00 00 00 
+  804856:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485d:	00 00 00 
+  804860:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804867:	00 00 00 
+  80486a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804871:	00 00 00 
+  804874:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487b:	00 00 00 
+  80487e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804885:	00 00 00 
+  804888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488f:	00 00 00 
+  804892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804899:	00 00 00 
+  80489c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a3:	00 00 00 
+  8048a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ad:	00 00 00 
+  8048b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b7:	00 00 00 
+  8048ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c1:	00 00 00 
+  8048c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cb:	00 00 00 
+  8048ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d5:	00 00 00 
+  8048d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048df:	00 00 00 
+  8048e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e9:	00 00 00 
+  8048ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f3:	00 00 00 
+  8048f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fd:	00 00 00 
+  804900:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804907:	00 00 00 
+  80490a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804911:	00 00 00 
+  804914:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491b:	00 00 00 
+  80491e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804925:	00 00 00 
+  804928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492f:	00 00 00 
+  804932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804939:	00 00 00 
+  80493c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804943:	00 00 00 
+  804946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494d:	00 00 00 
+  804950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804957:	00 00 00 
+  80495a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804961:	00 00 00 
+  804964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496b:	00 00 00 
+  80496e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804975:	00 00 00 
+  804978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497f:	00 00 00 
+  804982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804989:	00 00 00 
+  80498c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804993:	00 00 00 
+  804996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499d:	00 00 00 
+  8049a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a7:	00 00 00 
+  8049aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b1:	00 00 00 
+  8049b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bb:	00 00 00 
+  8049be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c5:	00 00 00 
+  8049c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cf:	00 00 00 
+  8049d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d9:	00 00 00 
+  8049dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e3:	00 00 00 
+  8049e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ed:	00 00 00 
+  8049f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f7:	00 00 00 
+  8049fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a01:	00 00 00 
+  804a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0b:	00 00 00 
+  804a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a15:	00 00 00 
+  804a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1f:	00 00 00 
+  804a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a29:	00 00 00 
+  804a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a33:	00 00 00 
+  804a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3d:	00 00 00 
+  804a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a47:	00 00 00 
+  804a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a51:	00 00 00 
+  804a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5b:	00 00 00 
+  804a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a65:	00 00 00 
+  804a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6f:	00 00 00 
+  804a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a79:	00 00 00 
+  804a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a83:	00 00 00 
+  804a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8d:	00 00 00 
+  804a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a97:	00 00 00 
+  804a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa1:	00 00 00 
+  804aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aab:	00 00 00 
+  804aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab5:	00 00 00 
+  804ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abf:	00 00 00 
+  804ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac9:	00 00 00 
+  804acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad3:	00 00 00 
+  804ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804add:	00 00 00 
+  804ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae7:	00 00 00 
+  804aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af1:	00 00 00 
+  804af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afb:	00 00 00 
+  804afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b05:	00 00 00 
+  804b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0f:	00 00 00 
+  804b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b19:	00 00 00 
+  804b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b23:	00 00 00 
+  804b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2d:	00 00 00 
+  804b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b37:	00 00 00 
+  804b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b41:	00 00 00 
+  804b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4b:	00 00 00 
+  804b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b55:	00 00 00 
+  804b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5f:	00 00 00 
+  804b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b69:	00 00 00 
+  804b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b73:	00 00 00 
+  804b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7d:	00 00 00 
+  804b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b87:	00 00 00 
+  804b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b91:	00 00 00 
+  804b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9b:	00 00 00 
+  804b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba5:	00 00 00 
+  804ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baf:	00 00 00 
+  804bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb9:	00 00 00 
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8100 @@
+
+obj/user/divzero:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3d 00 00 00       	call   800060 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int zero;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("1337/0 is %08x!\n", 1337 / zero);
+  800029:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800030:	00 00 00 
+  800033:	8b 08                	mov    (%rax),%ecx
+  800035:	b8 39 05 00 00       	mov    $0x539,%eax
+  80003a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80003f:	f7 f9                	idiv   %ecx
+  800041:	89 c6                	mov    %eax,%esi
+  800043:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80004a:	00 00 00 
+  80004d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800052:	48 ba d9 01 80 00 00 	movabs $0x8001d9,%rdx
+  800059:	00 00 00 
+  80005c:	ff d2                	call   *%rdx
+}
+  80005e:	5d                   	pop    %rbp
+  80005f:	c3                   	ret
+
+0000000000800060 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800060:	55                   	push   %rbp
+  800061:	48 89 e5             	mov    %rsp,%rbp
+  800064:	41 56                	push   %r14
+  800066:	41 55                	push   %r13
+  800068:	41 54                	push   %r12
+  80006a:	53                   	push   %rbx
+  80006b:	41 89 fd             	mov    %edi,%r13d
+  80006e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800071:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800078:	00 00 00 
+  80007b:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800082:	00 00 00 
+  800085:	48 39 c2             	cmp    %rax,%rdx
+  800088:	73 17                	jae    8000a1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80008a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008d:	49 89 c4             	mov    %rax,%r12
+  800090:	48 83 c3 08          	add    $0x8,%rbx
+  800094:	b8 00 00 00 00       	mov    $0x0,%eax
+  800099:	ff 53 f8             	call   *-0x8(%rbx)
+  80009c:	4c 39 e3             	cmp    %r12,%rbx
+  80009f:	72 ef                	jb     800090 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000a1:	48 b8 f1 11 80 00 00 	movabs $0x8011f1,%rax
+  8000a8:	00 00 00 
+  8000ab:	ff d0                	call   *%rax
+  8000ad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b2:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000b9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000c0:	00 00 00 
+  8000c3:	48 01 d0             	add    %rdx,%rax
+  8000c6:	48 a3 08 70 80 00 00 	movabs %rax,0x807008
+  8000cd:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000d0:	45 85 ed             	test   %r13d,%r13d
+  8000d3:	7e 0d                	jle    8000e2 <libmain+0x82>
+  8000d5:	49 8b 06             	mov    (%r14),%rax
+  8000d8:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000df:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000e2:	4c 89 f6             	mov    %r14,%rsi
+  8000e5:	44 89 ef             	mov    %r13d,%edi
+  8000e8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ef:	00 00 00 
+  8000f2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000f4:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8000fb:	00 00 00 
+  8000fe:	ff d0                	call   *%rax
+#endif
+}
+  800100:	5b                   	pop    %rbx
+  800101:	41 5c                	pop    %r12
+  800103:	41 5d                	pop    %r13
+  800105:	41 5e                	pop    %r14
+  800107:	5d                   	pop    %rbp
+  800108:	c3                   	ret
+
+0000000000800109 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800109:	55                   	push   %rbp
+  80010a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80010d:	48 b8 ed 1e 80 00 00 	movabs $0x801eed,%rax
+  800114:	00 00 00 
+  800117:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800119:	bf 00 00 00 00       	mov    $0x0,%edi
+  80011e:	48 b8 86 11 80 00 00 	movabs $0x801186,%rax
+  800125:	00 00 00 
+  800128:	ff d0                	call   *%rax
+}
+  80012a:	5d                   	pop    %rbp
+  80012b:	c3                   	ret
+
+000000000080012c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80012c:	55                   	push   %rbp
+  80012d:	48 89 e5             	mov    %rsp,%rbp
+  800130:	53                   	push   %rbx
+  800131:	48 83 ec 08          	sub    $0x8,%rsp
+  800135:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800138:	8b 06                	mov    (%rsi),%eax
+  80013a:	8d 50 01             	lea    0x1(%rax),%edx
+  80013d:	89 16                	mov    %edx,(%rsi)
+  80013f:	48 98                	cltq
+  800141:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800146:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80014c:	74 0a                	je     800158 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80014e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800152:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800156:	c9                   	leave
+  800157:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800158:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80015c:	be ff 00 00 00       	mov    $0xff,%esi
+  800161:	48 b8 28 11 80 00 00 	movabs $0x801128,%rax
+  800168:	00 00 00 
+  80016b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80016d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800173:	eb d9                	jmp    80014e <putch+0x22>
+
+0000000000800175 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800175:	55                   	push   %rbp
+  800176:	48 89 e5             	mov    %rsp,%rbp
+  800179:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800180:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800183:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80018a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80018f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800194:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800197:	48 89 f1             	mov    %rsi,%rcx
+  80019a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001a1:	48 bf 2c 01 80 00 00 	movabs $0x80012c,%rdi
+  8001a8:	00 00 00 
+  8001ab:	48 b8 29 03 80 00 00 	movabs $0x800329,%rax
+  8001b2:	00 00 00 
+  8001b5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001b7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001be:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001c5:	48 b8 28 11 80 00 00 	movabs $0x801128,%rax
+  8001cc:	00 00 00 
+  8001cf:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001d1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001d7:	c9                   	leave
+  8001d8:	c3                   	ret
+
+00000000008001d9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+  8001dd:	48 83 ec 50          	sub    $0x50,%rsp
+  8001e1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001e5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001e9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001ed:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001f1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001f5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001fc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800200:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800204:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800208:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80020c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800210:	48 b8 75 01 80 00 00 	movabs $0x800175,%rax
+  800217:	00 00 00 
+  80021a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80021c:	c9                   	leave
+  80021d:	c3                   	ret
+
+000000000080021e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80021e:	55                   	push   %rbp
+  80021f:	48 89 e5             	mov    %rsp,%rbp
+  800222:	41 57                	push   %r15
+  800224:	41 56                	push   %r14
+  800226:	41 55                	push   %r13
+  800228:	41 54                	push   %r12
+  80022a:	53                   	push   %rbx
+  80022b:	48 83 ec 18          	sub    $0x18,%rsp
+  80022f:	49 89 fc             	mov    %rdi,%r12
+  800232:	49 89 f5             	mov    %rsi,%r13
+  800235:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800239:	8b 45 10             	mov    0x10(%rbp),%eax
+  80023c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80023f:	41 89 cf             	mov    %ecx,%r15d
+  800242:	4c 39 fa             	cmp    %r15,%rdx
+  800245:	73 5b                	jae    8002a2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800247:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80024b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80024f:	85 db                	test   %ebx,%ebx
+  800251:	7e 0e                	jle    800261 <print_num+0x43>
+            putch(padc, put_arg);
+  800253:	4c 89 ee             	mov    %r13,%rsi
+  800256:	44 89 f7             	mov    %r14d,%edi
+  800259:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80025c:	83 eb 01             	sub    $0x1,%ebx
+  80025f:	75 f2                	jne    800253 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800261:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800265:	48 b9 2c 50 80 00 00 	movabs $0x80502c,%rcx
+  80026c:	00 00 00 
+  80026f:	48 b8 1b 50 80 00 00 	movabs $0x80501b,%rax
+  800276:	00 00 00 
+  800279:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80027d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800281:	ba 00 00 00 00       	mov    $0x0,%edx
+  800286:	49 f7 f7             	div    %r15
+  800289:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80028d:	4c 89 ee             	mov    %r13,%rsi
+  800290:	41 ff d4             	call   *%r12
+}
+  800293:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800297:	5b                   	pop    %rbx
+  800298:	41 5c                	pop    %r12
+  80029a:	41 5d                	pop    %r13
+  80029c:	41 5e                	pop    %r14
+  80029e:	41 5f                	pop    %r15
+  8002a0:	5d                   	pop    %rbp
+  8002a1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ab:	49 f7 f7             	div    %r15
+  8002ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8002b2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002b6:	52                   	push   %rdx
+  8002b7:	45 0f be c9          	movsbl %r9b,%r9d
+  8002bb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002bf:	48 89 c2             	mov    %rax,%rdx
+  8002c2:	48 b8 1e 02 80 00 00 	movabs $0x80021e,%rax
+  8002c9:	00 00 00 
+  8002cc:	ff d0                	call   *%rax
+  8002ce:	48 83 c4 10          	add    $0x10,%rsp
+  8002d2:	eb 8d                	jmp    800261 <print_num+0x43>
+
+00000000008002d4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002d4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002d8:	48 8b 06             	mov    (%rsi),%rax
+  8002db:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002df:	73 0a                	jae    8002eb <sprintputch+0x17>
+        *state->start++ = ch;
+  8002e1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002e5:	48 89 16             	mov    %rdx,(%rsi)
+  8002e8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002eb:	c3                   	ret
+
+00000000008002ec <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002ec:	55                   	push   %rbp
+  8002ed:	48 89 e5             	mov    %rsp,%rbp
+  8002f0:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002f8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002fc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800300:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800307:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80030b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80030f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800313:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800317:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80031b:	48 b8 29 03 80 00 00 	movabs $0x800329,%rax
+  800322:	00 00 00 
+  800325:	ff d0                	call   *%rax
+}
+  800327:	c9                   	leave
+  800328:	c3                   	ret
+
+0000000000800329 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800329:	55                   	push   %rbp
+  80032a:	48 89 e5             	mov    %rsp,%rbp
+  80032d:	41 57                	push   %r15
+  80032f:	41 56                	push   %r14
+  800331:	41 55                	push   %r13
+  800333:	41 54                	push   %r12
+  800335:	53                   	push   %rbx
+  800336:	48 83 ec 38          	sub    $0x38,%rsp
+  80033a:	49 89 fe             	mov    %rdi,%r14
+  80033d:	49 89 f5             	mov    %rsi,%r13
+  800340:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800343:	48 8b 01             	mov    (%rcx),%rax
+  800346:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80034a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80034e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800352:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800356:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80035a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80035e:	0f b6 3b             	movzbl (%rbx),%edi
+  800361:	40 80 ff 25          	cmp    $0x25,%dil
+  800365:	74 18                	je     80037f <vprintfmt+0x56>
+            if (!ch) return;
+  800367:	40 84 ff             	test   %dil,%dil
+  80036a:	0f 84 04 07 00 00    	je     800a74 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800370:	40 0f b6 ff          	movzbl %dil,%edi
+  800374:	4c 89 ee             	mov    %r13,%rsi
+  800377:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80037a:	4c 89 e3             	mov    %r12,%rbx
+  80037d:	eb db                	jmp    80035a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80037f:	be 00 00 00 00       	mov    $0x0,%esi
+  800384:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800388:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80038d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800393:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80039a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80039e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003a3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003a8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003ab:	83 e8 23             	sub    $0x23,%eax
+  8003ae:	3c 57                	cmp    $0x57,%al
+  8003b0:	0f 87 a4 06 00 00    	ja     800a5a <vprintfmt+0x731>
+  8003b6:	0f b6 c0             	movzbl %al,%eax
+  8003b9:	48 b9 c0 51 80 00 00 	movabs $0x8051c0,%rcx
+  8003c0:	00 00 00 
+  8003c3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003c6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003c9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003cd:	eb cf                	jmp    80039e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003cf:	49 89 dc             	mov    %rbx,%r12
+  8003d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d7:	eb c5                	jmp    80039e <vprintfmt+0x75>
+            padc = ch;
+  8003d9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003dd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003e0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003e3:	eb b9                	jmp    80039e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8003eb:	77 24                	ja     800411 <vprintfmt+0xe8>
+  8003ed:	89 c1                	mov    %eax,%ecx
+  8003ef:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003f3:	83 c0 08             	add    $0x8,%eax
+  8003f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003f9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003fc:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003ff:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800403:	79 99                	jns    80039e <vprintfmt+0x75>
+                width = precision;
+  800405:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800409:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80040f:	eb 8d                	jmp    80039e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800411:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800415:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800419:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041d:	eb da                	jmp    8003f9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80041f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800424:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800428:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80042e:	3c 39                	cmp    $0x39,%al
+  800430:	77 1c                	ja     80044e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800432:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800436:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80043a:	0f b6 c0             	movzbl %al,%eax
+  80043d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800442:	0f b6 03             	movzbl (%rbx),%eax
+  800445:	3c 39                	cmp    $0x39,%al
+  800447:	76 e9                	jbe    800432 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800449:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80044c:	eb b1                	jmp    8003ff <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80044e:	49 89 dc             	mov    %rbx,%r12
+  800451:	eb ac                	jmp    8003ff <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800453:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800456:	85 c9                	test   %ecx,%ecx
+  800458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045d:	0f 49 c1             	cmovns %ecx,%eax
+  800460:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800463:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800466:	e9 33 ff ff ff       	jmp    80039e <vprintfmt+0x75>
+            lflag++;
+  80046b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80046e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800471:	e9 28 ff ff ff       	jmp    80039e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800476:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800479:	83 f8 2f             	cmp    $0x2f,%eax
+  80047c:	77 19                	ja     800497 <vprintfmt+0x16e>
+  80047e:	89 c2                	mov    %eax,%edx
+  800480:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800484:	83 c0 08             	add    $0x8,%eax
+  800487:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80048a:	8b 3a                	mov    (%rdx),%edi
+  80048c:	4c 89 ee             	mov    %r13,%rsi
+  80048f:	41 ff d6             	call   *%r14
+            break;
+  800492:	e9 c3 fe ff ff       	jmp    80035a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800497:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80049b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80049f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a3:	eb e5                	jmp    80048a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ab:	77 5a                	ja     800507 <vprintfmt+0x1de>
+  8004ad:	89 c2                	mov    %eax,%edx
+  8004af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b3:	83 c0 08             	add    $0x8,%eax
+  8004b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004b9:	8b 02                	mov    (%rdx),%eax
+  8004bb:	89 c1                	mov    %eax,%ecx
+  8004bd:	f7 d9                	neg    %ecx
+  8004bf:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004c2:	83 f9 13             	cmp    $0x13,%ecx
+  8004c5:	7f 4e                	jg     800515 <vprintfmt+0x1ec>
+  8004c7:	48 63 c1             	movslq %ecx,%rax
+  8004ca:	48 ba 80 54 80 00 00 	movabs $0x805480,%rdx
+  8004d1:	00 00 00 
+  8004d4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004d8:	48 85 c0             	test   %rax,%rax
+  8004db:	74 38                	je     800515 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004dd:	48 89 c1             	mov    %rax,%rcx
+  8004e0:	48 ba b9 56 80 00 00 	movabs $0x8056b9,%rdx
+  8004e7:	00 00 00 
+  8004ea:	4c 89 ee             	mov    %r13,%rsi
+  8004ed:	4c 89 f7             	mov    %r14,%rdi
+  8004f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f5:	49 b8 ec 02 80 00 00 	movabs $0x8002ec,%r8
+  8004fc:	00 00 00 
+  8004ff:	41 ff d0             	call   *%r8
+  800502:	e9 53 fe ff ff       	jmp    80035a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800507:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80050b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80050f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800513:	eb a4                	jmp    8004b9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800515:	48 ba 44 50 80 00 00 	movabs $0x805044,%rdx
+  80051c:	00 00 00 
+  80051f:	4c 89 ee             	mov    %r13,%rsi
+  800522:	4c 89 f7             	mov    %r14,%rdi
+  800525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052a:	49 b8 ec 02 80 00 00 	movabs $0x8002ec,%r8
+  800531:	00 00 00 
+  800534:	41 ff d0             	call   *%r8
+  800537:	e9 1e fe ff ff       	jmp    80035a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80053c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053f:	83 f8 2f             	cmp    $0x2f,%eax
+  800542:	77 36                	ja     80057a <vprintfmt+0x251>
+  800544:	89 c2                	mov    %eax,%edx
+  800546:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80054a:	83 c0 08             	add    $0x8,%eax
+  80054d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800550:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800553:	48 85 f6             	test   %rsi,%rsi
+  800556:	48 b8 3d 50 80 00 00 	movabs $0x80503d,%rax
+  80055d:	00 00 00 
+  800560:	48 0f 45 c6          	cmovne %rsi,%rax
+  800564:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800568:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80056c:	7e 06                	jle    800574 <vprintfmt+0x24b>
+  80056e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800572:	75 14                	jne    800588 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800574:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800578:	eb 5b                	jmp    8005d5 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80057a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80057e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800582:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800586:	eb c8                	jmp    800550 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800588:	49 63 f7             	movslq %r15d,%rsi
+  80058b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80058f:	48 b8 2e 0b 80 00 00 	movabs $0x800b2e,%rax
+  800596:	00 00 00 
+  800599:	ff d0                	call   *%rax
+  80059b:	48 89 c2             	mov    %rax,%rdx
+  80059e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005a1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005a3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005a6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005a9:	85 c0                	test   %eax,%eax
+  8005ab:	7e c7                	jle    800574 <vprintfmt+0x24b>
+  8005ad:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005b2:	4c 89 ee             	mov    %r13,%rsi
+  8005b5:	44 89 e7             	mov    %r12d,%edi
+  8005b8:	41 ff d6             	call   *%r14
+  8005bb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005bf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005c5:	75 eb                	jne    8005b2 <vprintfmt+0x289>
+  8005c7:	eb ab                	jmp    800574 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005c9:	0f b6 f8             	movzbl %al,%edi
+  8005cc:	4c 89 ee             	mov    %r13,%rsi
+  8005cf:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8005d2:	4c 89 e2             	mov    %r12,%rdx
+  8005d5:	45 85 ff             	test   %r15d,%r15d
+  8005d8:	78 06                	js     8005e0 <vprintfmt+0x2b7>
+  8005da:	41 83 ef 01          	sub    $0x1,%r15d
+  8005de:	78 23                	js     800603 <vprintfmt+0x2da>
+  8005e0:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8005e4:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8005ea:	84 c0                	test   %al,%al
+  8005ec:	74 15                	je     800603 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005ee:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8005f2:	74 d5                	je     8005c9 <vprintfmt+0x2a0>
+  8005f4:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8005f7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8005fc:	80 fa 5e             	cmp    $0x5e,%dl
+  8005ff:	77 cb                	ja     8005cc <vprintfmt+0x2a3>
+  800601:	eb c6                	jmp    8005c9 <vprintfmt+0x2a0>
+  800603:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800606:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800609:	01 f0                	add    %esi,%eax
+  80060b:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80060d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800611:	85 c0                	test   %eax,%eax
+  800613:	0f 8e 41 fd ff ff    	jle    80035a <vprintfmt+0x31>
+  800619:	4c 89 ee             	mov    %r13,%rsi
+  80061c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800621:	41 ff d6             	call   *%r14
+  800624:	41 83 ec 01          	sub    $0x1,%r12d
+  800628:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80062c:	75 eb                	jne    800619 <vprintfmt+0x2f0>
+  80062e:	e9 27 fd ff ff       	jmp    80035a <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800633:	40 84 f6             	test   %sil,%sil
+  800636:	75 26                	jne    80065e <vprintfmt+0x335>
+    switch (lflag) {
+  800638:	85 d2                	test   %edx,%edx
+  80063a:	74 59                	je     800695 <vprintfmt+0x36c>
+  80063c:	83 fa 01             	cmp    $0x1,%edx
+  80063f:	74 7b                	je     8006bc <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800641:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800644:	83 f8 2f             	cmp    $0x2f,%eax
+  800647:	0f 87 96 00 00 00    	ja     8006e3 <vprintfmt+0x3ba>
+  80064d:	89 c2                	mov    %eax,%edx
+  80064f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800653:	83 c0 08             	add    $0x8,%eax
+  800656:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800659:	4c 8b 22             	mov    (%rdx),%r12
+  80065c:	eb 17                	jmp    800675 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80065e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800661:	83 f8 2f             	cmp    $0x2f,%eax
+  800664:	77 21                	ja     800687 <vprintfmt+0x35e>
+  800666:	89 c2                	mov    %eax,%edx
+  800668:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066c:	83 c0 08             	add    $0x8,%eax
+  80066f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800672:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800675:	4d 85 e4             	test   %r12,%r12
+  800678:	78 7a                	js     8006f4 <vprintfmt+0x3cb>
+            num = i;
+  80067a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80067d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800682:	e9 b5 02 00 00       	jmp    80093c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800687:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800693:	eb dd                	jmp    800672 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800695:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800698:	83 f8 2f             	cmp    $0x2f,%eax
+  80069b:	77 11                	ja     8006ae <vprintfmt+0x385>
+  80069d:	89 c2                	mov    %eax,%edx
+  80069f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a3:	83 c0 08             	add    $0x8,%eax
+  8006a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a9:	4c 63 22             	movslq (%rdx),%r12
+  8006ac:	eb c7                	jmp    800675 <vprintfmt+0x34c>
+  8006ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ba:	eb ed                	jmp    8006a9 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8006bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c2:	77 11                	ja     8006d5 <vprintfmt+0x3ac>
+  8006c4:	89 c2                	mov    %eax,%edx
+  8006c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ca:	83 c0 08             	add    $0x8,%eax
+  8006cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d0:	4c 8b 22             	mov    (%rdx),%r12
+  8006d3:	eb a0                	jmp    800675 <vprintfmt+0x34c>
+  8006d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e1:	eb ed                	jmp    8006d0 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8006e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ef:	e9 65 ff ff ff       	jmp    800659 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8006f4:	4c 89 ee             	mov    %r13,%rsi
+  8006f7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006fc:	41 ff d6             	call   *%r14
+                i = -i;
+  8006ff:	49 f7 dc             	neg    %r12
+  800702:	e9 73 ff ff ff       	jmp    80067a <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800707:	40 84 f6             	test   %sil,%sil
+  80070a:	75 32                	jne    80073e <vprintfmt+0x415>
+    switch (lflag) {
+  80070c:	85 d2                	test   %edx,%edx
+  80070e:	74 5d                	je     80076d <vprintfmt+0x444>
+  800710:	83 fa 01             	cmp    $0x1,%edx
+  800713:	0f 84 82 00 00 00    	je     80079b <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800719:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071c:	83 f8 2f             	cmp    $0x2f,%eax
+  80071f:	0f 87 a5 00 00 00    	ja     8007ca <vprintfmt+0x4a1>
+  800725:	89 c2                	mov    %eax,%edx
+  800727:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072b:	83 c0 08             	add    $0x8,%eax
+  80072e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800731:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800734:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800739:	e9 fe 01 00 00       	jmp    80093c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80073e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800741:	83 f8 2f             	cmp    $0x2f,%eax
+  800744:	77 19                	ja     80075f <vprintfmt+0x436>
+  800746:	89 c2                	mov    %eax,%edx
+  800748:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80074c:	83 c0 08             	add    $0x8,%eax
+  80074f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800752:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800755:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80075a:	e9 dd 01 00 00       	jmp    80093c <vprintfmt+0x613>
+  80075f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800763:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800767:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076b:	eb e5                	jmp    800752 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80076d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800770:	83 f8 2f             	cmp    $0x2f,%eax
+  800773:	77 18                	ja     80078d <vprintfmt+0x464>
+  800775:	89 c2                	mov    %eax,%edx
+  800777:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077b:	83 c0 08             	add    $0x8,%eax
+  80077e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800781:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800783:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800788:	e9 af 01 00 00       	jmp    80093c <vprintfmt+0x613>
+  80078d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800791:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800795:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800799:	eb e6                	jmp    800781 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80079b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079e:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a1:	77 19                	ja     8007bc <vprintfmt+0x493>
+  8007a3:	89 c2                	mov    %eax,%edx
+  8007a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a9:	83 c0 08             	add    $0x8,%eax
+  8007ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007af:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007b2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007b7:	e9 80 01 00 00       	jmp    80093c <vprintfmt+0x613>
+  8007bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c8:	eb e5                	jmp    8007af <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8007ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d6:	e9 56 ff ff ff       	jmp    800731 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8007db:	40 84 f6             	test   %sil,%sil
+  8007de:	75 2e                	jne    80080e <vprintfmt+0x4e5>
+    switch (lflag) {
+  8007e0:	85 d2                	test   %edx,%edx
+  8007e2:	0f 84 b3 00 00 00    	je     80089b <vprintfmt+0x572>
+  8007e8:	83 fa 01             	cmp    $0x1,%edx
+  8007eb:	0f 84 d3 00 00 00    	je     8008c4 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8007f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f7:	0f 87 f1 00 00 00    	ja     8008ee <vprintfmt+0x5c5>
+  8007fd:	89 c2                	mov    %eax,%edx
+  8007ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800803:	83 c0 08             	add    $0x8,%eax
+  800806:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800809:	48 8b 02             	mov    (%rdx),%rax
+  80080c:	eb 17                	jmp    800825 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  80080e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800811:	83 f8 2f             	cmp    $0x2f,%eax
+  800814:	77 77                	ja     80088d <vprintfmt+0x564>
+  800816:	89 c2                	mov    %eax,%edx
+  800818:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081c:	83 c0 08             	add    $0x8,%eax
+  80081f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800822:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800825:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800827:	83 f8 07             	cmp    $0x7,%eax
+  80082a:	0f 8e cf 00 00 00    	jle    8008ff <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800830:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800836:	44 89 e7             	mov    %r12d,%edi
+  800839:	41 c1 e4 03          	shl    $0x3,%r12d
+  80083d:	89 d1                	mov    %edx,%ecx
+  80083f:	8d 72 07             	lea    0x7(%rdx),%esi
+  800842:	85 d2                	test   %edx,%edx
+  800844:	0f 48 d6             	cmovs  %esi,%edx
+  800847:	c1 fa 03             	sar    $0x3,%edx
+  80084a:	83 f9 3f             	cmp    $0x3f,%ecx
+  80084d:	7f e7                	jg     800836 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80084f:	85 ff                	test   %edi,%edi
+  800851:	0f 84 03 fb ff ff    	je     80035a <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800857:	49 63 f4             	movslq %r12d,%rsi
+  80085a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80085f:	48 f7 f6             	div    %rsi
+  800862:	49 89 d7             	mov    %rdx,%r15
+  800865:	83 c0 30             	add    $0x30,%eax
+  800868:	0f be f8             	movsbl %al,%edi
+  80086b:	4c 89 ee             	mov    %r13,%rsi
+  80086e:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800871:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800874:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800879:	45 85 e4             	test   %r12d,%r12d
+  80087c:	41 0f 49 d4          	cmovns %r12d,%edx
+  800880:	c1 fa 03             	sar    $0x3,%edx
+  800883:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800886:	75 cf                	jne    800857 <vprintfmt+0x52e>
+  800888:	e9 cd fa ff ff       	jmp    80035a <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80088d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800891:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800895:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800899:	eb 87                	jmp    800822 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80089b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089e:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a1:	77 13                	ja     8008b6 <vprintfmt+0x58d>
+  8008a3:	89 c2                	mov    %eax,%edx
+  8008a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a9:	83 c0 08             	add    $0x8,%eax
+  8008ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008af:	8b 02                	mov    (%rdx),%eax
+  8008b1:	e9 6f ff ff ff       	jmp    800825 <vprintfmt+0x4fc>
+  8008b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c2:	eb eb                	jmp    8008af <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8008c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ca:	77 14                	ja     8008e0 <vprintfmt+0x5b7>
+  8008cc:	89 c2                	mov    %eax,%edx
+  8008ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d2:	83 c0 08             	add    $0x8,%eax
+  8008d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d8:	48 8b 02             	mov    (%rdx),%rax
+  8008db:	e9 45 ff ff ff       	jmp    800825 <vprintfmt+0x4fc>
+  8008e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ec:	eb ea                	jmp    8008d8 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8008ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fa:	e9 0a ff ff ff       	jmp    800809 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8008ff:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800905:	e9 4d ff ff ff       	jmp    800857 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  80090a:	4c 89 ee             	mov    %r13,%rsi
+  80090d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800912:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800915:	4c 89 ee             	mov    %r13,%rsi
+  800918:	bf 78 00 00 00       	mov    $0x78,%edi
+  80091d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800920:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800923:	83 f8 2f             	cmp    $0x2f,%eax
+  800926:	77 47                	ja     80096f <vprintfmt+0x646>
+  800928:	89 c2                	mov    %eax,%edx
+  80092a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092e:	83 c0 08             	add    $0x8,%eax
+  800931:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800934:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800937:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80093c:	48 83 ec 08          	sub    $0x8,%rsp
+  800940:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800944:	0f 94 c0             	sete   %al
+  800947:	0f b6 c0             	movzbl %al,%eax
+  80094a:	50                   	push   %rax
+  80094b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800950:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800954:	4c 89 ee             	mov    %r13,%rsi
+  800957:	4c 89 f7             	mov    %r14,%rdi
+  80095a:	48 b8 1e 02 80 00 00 	movabs $0x80021e,%rax
+  800961:	00 00 00 
+  800964:	ff d0                	call   *%rax
+            break;
+  800966:	48 83 c4 10          	add    $0x10,%rsp
+  80096a:	e9 eb f9 ff ff       	jmp    80035a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80096f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800973:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800977:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097b:	eb b7                	jmp    800934 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  80097d:	40 84 f6             	test   %sil,%sil
+  800980:	75 2b                	jne    8009ad <vprintfmt+0x684>
+    switch (lflag) {
+  800982:	85 d2                	test   %edx,%edx
+  800984:	74 56                	je     8009dc <vprintfmt+0x6b3>
+  800986:	83 fa 01             	cmp    $0x1,%edx
+  800989:	74 7f                	je     800a0a <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  80098b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098e:	83 f8 2f             	cmp    $0x2f,%eax
+  800991:	0f 87 a2 00 00 00    	ja     800a39 <vprintfmt+0x710>
+  800997:	89 c2                	mov    %eax,%edx
+  800999:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099d:	83 c0 08             	add    $0x8,%eax
+  8009a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009ab:	eb 8f                	jmp    80093c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b3:	77 19                	ja     8009ce <vprintfmt+0x6a5>
+  8009b5:	89 c2                	mov    %eax,%edx
+  8009b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bb:	83 c0 08             	add    $0x8,%eax
+  8009be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009c9:	e9 6e ff ff ff       	jmp    80093c <vprintfmt+0x613>
+  8009ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009da:	eb e5                	jmp    8009c1 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8009dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009df:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e2:	77 18                	ja     8009fc <vprintfmt+0x6d3>
+  8009e4:	89 c2                	mov    %eax,%edx
+  8009e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ea:	83 c0 08             	add    $0x8,%eax
+  8009ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f0:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009f7:	e9 40 ff ff ff       	jmp    80093c <vprintfmt+0x613>
+  8009fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a08:	eb e6                	jmp    8009f0 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800a0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a10:	77 19                	ja     800a2b <vprintfmt+0x702>
+  800a12:	89 c2                	mov    %eax,%edx
+  800a14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a18:	83 c0 08             	add    $0x8,%eax
+  800a1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a21:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a26:	e9 11 ff ff ff       	jmp    80093c <vprintfmt+0x613>
+  800a2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a37:	eb e5                	jmp    800a1e <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800a39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a45:	e9 59 ff ff ff       	jmp    8009a3 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800a4a:	4c 89 ee             	mov    %r13,%rsi
+  800a4d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a52:	41 ff d6             	call   *%r14
+            break;
+  800a55:	e9 00 f9 ff ff       	jmp    80035a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a5a:	4c 89 ee             	mov    %r13,%rsi
+  800a5d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a62:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a65:	48 83 eb 01          	sub    $0x1,%rbx
+  800a69:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a6d:	75 f6                	jne    800a65 <vprintfmt+0x73c>
+  800a6f:	e9 e6 f8 ff ff       	jmp    80035a <vprintfmt+0x31>
+}
+  800a74:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a78:	5b                   	pop    %rbx
+  800a79:	41 5c                	pop    %r12
+  800a7b:	41 5d                	pop    %r13
+  800a7d:	41 5e                	pop    %r14
+  800a7f:	41 5f                	pop    %r15
+  800a81:	5d                   	pop    %rbp
+  800a82:	c3                   	ret
+
+0000000000800a83 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a83:	55                   	push   %rbp
+  800a84:	48 89 e5             	mov    %rsp,%rbp
+  800a87:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a8b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a8f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a94:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a98:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a9f:	48 85 ff             	test   %rdi,%rdi
+  800aa2:	74 2b                	je     800acf <vsnprintf+0x4c>
+  800aa4:	48 85 f6             	test   %rsi,%rsi
+  800aa7:	74 26                	je     800acf <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800aa9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800aad:	48 bf d4 02 80 00 00 	movabs $0x8002d4,%rdi
+  800ab4:	00 00 00 
+  800ab7:	48 b8 29 03 80 00 00 	movabs $0x800329,%rax
+  800abe:	00 00 00 
+  800ac1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ac3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ac7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800aca:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800acd:	c9                   	leave
+  800ace:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800acf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad4:	eb f7                	jmp    800acd <vsnprintf+0x4a>
+
+0000000000800ad6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ad6:	55                   	push   %rbp
+  800ad7:	48 89 e5             	mov    %rsp,%rbp
+  800ada:	48 83 ec 50          	sub    $0x50,%rsp
+  800ade:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ae2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ae6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800aea:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800af1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800af5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800afd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b01:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b05:	48 b8 83 0a 80 00 00 	movabs $0x800a83,%rax
+  800b0c:	00 00 00 
+  800b0f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b11:	c9                   	leave
+  800b12:	c3                   	ret
+
+0000000000800b13 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b13:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b16:	74 10                	je     800b28 <strlen+0x15>
+    size_t n = 0;
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b1d:	48 83 c0 01          	add    $0x1,%rax
+  800b21:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b25:	75 f6                	jne    800b1d <strlen+0xa>
+  800b27:	c3                   	ret
+    size_t n = 0;
+  800b28:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b2d:	c3                   	ret
+
+0000000000800b2e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b2e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b31:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b36:	48 85 f6             	test   %rsi,%rsi
+  800b39:	74 11                	je     800b4c <strnlen+0x1e>
+  800b3b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b3f:	74 0c                	je     800b4d <strnlen+0x1f>
+  800b41:	48 83 c2 01          	add    $0x1,%rdx
+  800b45:	48 39 d0             	cmp    %rdx,%rax
+  800b48:	75 f1                	jne    800b3b <strnlen+0xd>
+  800b4a:	eb 04                	jmp    800b50 <strnlen+0x22>
+  800b4c:	c3                   	ret
+  800b4d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b50:	c3                   	ret
+
+0000000000800b51 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b51:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b54:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b59:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b5d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b60:	48 83 c2 01          	add    $0x1,%rdx
+  800b64:	84 c9                	test   %cl,%cl
+  800b66:	75 f1                	jne    800b59 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b68:	c3                   	ret
+
+0000000000800b69 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b69:	55                   	push   %rbp
+  800b6a:	48 89 e5             	mov    %rsp,%rbp
+  800b6d:	41 54                	push   %r12
+  800b6f:	53                   	push   %rbx
+  800b70:	48 89 fb             	mov    %rdi,%rbx
+  800b73:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b76:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  800b7d:	00 00 00 
+  800b80:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b82:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b86:	4c 89 e6             	mov    %r12,%rsi
+  800b89:	48 b8 51 0b 80 00 00 	movabs $0x800b51,%rax
+  800b90:	00 00 00 
+  800b93:	ff d0                	call   *%rax
+    return dst;
+}
+  800b95:	48 89 d8             	mov    %rbx,%rax
+  800b98:	5b                   	pop    %rbx
+  800b99:	41 5c                	pop    %r12
+  800b9b:	5d                   	pop    %rbp
+  800b9c:	c3                   	ret
+
+0000000000800b9d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b9d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ba0:	48 85 d2             	test   %rdx,%rdx
+  800ba3:	74 1f                	je     800bc4 <strncpy+0x27>
+  800ba5:	48 01 fa             	add    %rdi,%rdx
+  800ba8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bab:	48 83 c1 01          	add    $0x1,%rcx
+  800baf:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bb3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bb7:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bbb:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bbf:	48 39 ca             	cmp    %rcx,%rdx
+  800bc2:	75 e7                	jne    800bab <strncpy+0xe>
+    }
+    return ret;
+}
+  800bc4:	c3                   	ret
+
+0000000000800bc5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bc5:	48 89 f8             	mov    %rdi,%rax
+  800bc8:	48 85 d2             	test   %rdx,%rdx
+  800bcb:	74 24                	je     800bf1 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bcd:	48 83 ea 01          	sub    $0x1,%rdx
+  800bd1:	74 1b                	je     800bee <strlcpy+0x29>
+  800bd3:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bd7:	0f b6 16             	movzbl (%rsi),%edx
+  800bda:	84 d2                	test   %dl,%dl
+  800bdc:	74 10                	je     800bee <strlcpy+0x29>
+            *dst++ = *src++;
+  800bde:	48 83 c6 01          	add    $0x1,%rsi
+  800be2:	48 83 c0 01          	add    $0x1,%rax
+  800be6:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800be9:	48 39 c8             	cmp    %rcx,%rax
+  800bec:	75 e9                	jne    800bd7 <strlcpy+0x12>
+        *dst = '\0';
+  800bee:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bf1:	48 29 f8             	sub    %rdi,%rax
+}
+  800bf4:	c3                   	ret
+
+0000000000800bf5 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bf5:	0f b6 07             	movzbl (%rdi),%eax
+  800bf8:	84 c0                	test   %al,%al
+  800bfa:	74 13                	je     800c0f <strcmp+0x1a>
+  800bfc:	38 06                	cmp    %al,(%rsi)
+  800bfe:	75 0f                	jne    800c0f <strcmp+0x1a>
+  800c00:	48 83 c7 01          	add    $0x1,%rdi
+  800c04:	48 83 c6 01          	add    $0x1,%rsi
+  800c08:	0f b6 07             	movzbl (%rdi),%eax
+  800c0b:	84 c0                	test   %al,%al
+  800c0d:	75 ed                	jne    800bfc <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c0f:	0f b6 c0             	movzbl %al,%eax
+  800c12:	0f b6 16             	movzbl (%rsi),%edx
+  800c15:	29 d0                	sub    %edx,%eax
+}
+  800c17:	c3                   	ret
+
+0000000000800c18 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c18:	48 85 d2             	test   %rdx,%rdx
+  800c1b:	74 1f                	je     800c3c <strncmp+0x24>
+  800c1d:	0f b6 07             	movzbl (%rdi),%eax
+  800c20:	84 c0                	test   %al,%al
+  800c22:	74 1e                	je     800c42 <strncmp+0x2a>
+  800c24:	3a 06                	cmp    (%rsi),%al
+  800c26:	75 1a                	jne    800c42 <strncmp+0x2a>
+  800c28:	48 83 c7 01          	add    $0x1,%rdi
+  800c2c:	48 83 c6 01          	add    $0x1,%rsi
+  800c30:	48 83 ea 01          	sub    $0x1,%rdx
+  800c34:	75 e7                	jne    800c1d <strncmp+0x5>
+
+    if (!n) return 0;
+  800c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3b:	c3                   	ret
+  800c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c41:	c3                   	ret
+  800c42:	48 85 d2             	test   %rdx,%rdx
+  800c45:	74 09                	je     800c50 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c47:	0f b6 07             	movzbl (%rdi),%eax
+  800c4a:	0f b6 16             	movzbl (%rsi),%edx
+  800c4d:	29 d0                	sub    %edx,%eax
+  800c4f:	c3                   	ret
+    if (!n) return 0;
+  800c50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c55:	c3                   	ret
+
+0000000000800c56 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c56:	0f b6 17             	movzbl (%rdi),%edx
+  800c59:	84 d2                	test   %dl,%dl
+  800c5b:	74 18                	je     800c75 <strchr+0x1f>
+        if (*str == c) {
+  800c5d:	0f be d2             	movsbl %dl,%edx
+  800c60:	39 f2                	cmp    %esi,%edx
+  800c62:	74 17                	je     800c7b <strchr+0x25>
+    for (; *str; str++) {
+  800c64:	48 83 c7 01          	add    $0x1,%rdi
+  800c68:	0f b6 17             	movzbl (%rdi),%edx
+  800c6b:	84 d2                	test   %dl,%dl
+  800c6d:	75 ee                	jne    800c5d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c74:	c3                   	ret
+  800c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7a:	c3                   	ret
+  800c7b:	48 89 f8             	mov    %rdi,%rax
+}
+  800c7e:	c3                   	ret
+
+0000000000800c7f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c7f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c82:	0f b6 17             	movzbl (%rdi),%edx
+  800c85:	84 d2                	test   %dl,%dl
+  800c87:	74 13                	je     800c9c <strfind+0x1d>
+  800c89:	0f be d2             	movsbl %dl,%edx
+  800c8c:	39 f2                	cmp    %esi,%edx
+  800c8e:	74 0b                	je     800c9b <strfind+0x1c>
+  800c90:	48 83 c0 01          	add    $0x1,%rax
+  800c94:	0f b6 10             	movzbl (%rax),%edx
+  800c97:	84 d2                	test   %dl,%dl
+  800c99:	75 ee                	jne    800c89 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c9b:	c3                   	ret
+  800c9c:	c3                   	ret
+
+0000000000800c9d <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800c9d:	55                   	push   %rbp
+  800c9e:	48 89 e5             	mov    %rsp,%rbp
+  800ca1:	41 57                	push   %r15
+  800ca3:	41 56                	push   %r14
+  800ca5:	41 55                	push   %r13
+  800ca7:	41 54                	push   %r12
+  800ca9:	53                   	push   %rbx
+  800caa:	48 83 ec 08          	sub    $0x8,%rsp
+  800cae:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800cb1:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800cb5:	45 84 ed             	test   %r13b,%r13b
+  800cb8:	75 12                	jne    800ccc <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800cba:	4c 89 f8             	mov    %r15,%rax
+  800cbd:	48 83 c4 08          	add    $0x8,%rsp
+  800cc1:	5b                   	pop    %rbx
+  800cc2:	41 5c                	pop    %r12
+  800cc4:	41 5d                	pop    %r13
+  800cc6:	41 5e                	pop    %r14
+  800cc8:	41 5f                	pop    %r15
+  800cca:	5d                   	pop    %rbp
+  800ccb:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800ccc:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800cd0:	4c 89 e7             	mov    %r12,%rdi
+  800cd3:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  800cda:	00 00 00 
+  800cdd:	ff d0                	call   *%rax
+  800cdf:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800ce2:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800ce6:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800cea:	49 bf 18 0c 80 00 00 	movabs $0x800c18,%r15
+  800cf1:	00 00 00 
+				if ((sc = *s++) == 0)
+  800cf4:	84 c0                	test   %al,%al
+  800cf6:	75 14                	jne    800d0c <strstr+0x6f>
+					return NULL;
+  800cf8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800cfe:	eb ba                	jmp    800cba <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800d00:	48 83 c3 01          	add    $0x1,%rbx
+  800d04:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800d08:	84 c0                	test   %al,%al
+  800d0a:	74 1b                	je     800d27 <strstr+0x8a>
+			} while (sc != c);
+  800d0c:	41 38 c5             	cmp    %al,%r13b
+  800d0f:	75 ef                	jne    800d00 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800d11:	4c 89 f2             	mov    %r14,%rdx
+  800d14:	4c 89 e6             	mov    %r12,%rsi
+  800d17:	48 89 df             	mov    %rbx,%rdi
+  800d1a:	41 ff d7             	call   *%r15
+  800d1d:	85 c0                	test   %eax,%eax
+  800d1f:	75 df                	jne    800d00 <strstr+0x63>
+  800d21:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800d25:	eb 93                	jmp    800cba <strstr+0x1d>
+					return NULL;
+  800d27:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d2d:	eb 8b                	jmp    800cba <strstr+0x1d>
+
+0000000000800d2f <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800d2f:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800d31:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800d34:	8d 57 20             	lea    0x20(%rdi),%edx
+  800d37:	83 f9 1a             	cmp    $0x1a,%ecx
+  800d3a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800d3d:	c3                   	ret
+
+0000000000800d3e <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800d3e:	55                   	push   %rbp
+  800d3f:	48 89 e5             	mov    %rsp,%rbp
+  800d42:	41 57                	push   %r15
+  800d44:	41 56                	push   %r14
+  800d46:	41 55                	push   %r13
+  800d48:	41 54                	push   %r12
+  800d4a:	53                   	push   %rbx
+  800d4b:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800d4f:	48 39 f7             	cmp    %rsi,%rdi
+  800d52:	74 49                	je     800d9d <strcasecmp+0x5f>
+  800d54:	49 89 fd             	mov    %rdi,%r13
+  800d57:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800d5a:	49 bf 2f 0d 80 00 00 	movabs $0x800d2f,%r15
+  800d61:	00 00 00 
+  800d64:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800d69:	41 0f b6 fe          	movzbl %r14b,%edi
+  800d6d:	41 ff d7             	call   *%r15
+  800d70:	89 c3                	mov    %eax,%ebx
+  800d72:	49 83 c4 01          	add    $0x1,%r12
+  800d76:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800d7c:	41 ff d7             	call   *%r15
+  800d7f:	29 c3                	sub    %eax,%ebx
+  800d81:	75 09                	jne    800d8c <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800d83:	49 83 c5 01          	add    $0x1,%r13
+  800d87:	45 84 f6             	test   %r14b,%r14b
+  800d8a:	75 d8                	jne    800d64 <strcasecmp+0x26>
+}
+  800d8c:	89 d8                	mov    %ebx,%eax
+  800d8e:	48 83 c4 08          	add    $0x8,%rsp
+  800d92:	5b                   	pop    %rbx
+  800d93:	41 5c                	pop    %r12
+  800d95:	41 5d                	pop    %r13
+  800d97:	41 5e                	pop    %r14
+  800d99:	41 5f                	pop    %r15
+  800d9b:	5d                   	pop    %rbp
+  800d9c:	c3                   	ret
+        return 0;
+  800d9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da2:	eb e8                	jmp    800d8c <strcasecmp+0x4e>
+
+0000000000800da4 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800da4:	55                   	push   %rbp
+  800da5:	48 89 e5             	mov    %rsp,%rbp
+  800da8:	41 57                	push   %r15
+  800daa:	41 56                	push   %r14
+  800dac:	41 55                	push   %r13
+  800dae:	41 54                	push   %r12
+  800db0:	53                   	push   %rbx
+  800db1:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800db5:	48 85 d2             	test   %rdx,%rdx
+  800db8:	74 4f                	je     800e09 <strncasecmp+0x65>
+  800dba:	49 89 fc             	mov    %rdi,%r12
+  800dbd:	49 89 f5             	mov    %rsi,%r13
+  800dc0:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800dc4:	49 be 2f 0d 80 00 00 	movabs $0x800d2f,%r14
+  800dcb:	00 00 00 
+  800dce:	49 83 c4 01          	add    $0x1,%r12
+  800dd2:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800dd8:	41 ff d6             	call   *%r14
+  800ddb:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800ddd:	49 83 c5 01          	add    $0x1,%r13
+  800de1:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800de6:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800de9:	29 c3                	sub    %eax,%ebx
+  800deb:	85 c0                	test   %eax,%eax
+  800ded:	74 09                	je     800df8 <strncasecmp+0x54>
+  800def:	85 db                	test   %ebx,%ebx
+  800df1:	75 05                	jne    800df8 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800df3:	4d 39 fc             	cmp    %r15,%r12
+  800df6:	75 d6                	jne    800dce <strncasecmp+0x2a>
+}
+  800df8:	89 d8                	mov    %ebx,%eax
+  800dfa:	48 83 c4 08          	add    $0x8,%rsp
+  800dfe:	5b                   	pop    %rbx
+  800dff:	41 5c                	pop    %r12
+  800e01:	41 5d                	pop    %r13
+  800e03:	41 5e                	pop    %r14
+  800e05:	41 5f                	pop    %r15
+  800e07:	5d                   	pop    %rbp
+  800e08:	c3                   	ret
+    int d = 0;
+  800e09:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800e0e:	eb e8                	jmp    800df8 <strncasecmp+0x54>
+
+0000000000800e10 <toupper>:
+
+int toupper(int c) {
+  800e10:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800e12:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800e15:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800e18:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e1b:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e1e:	c3                   	ret
+
+0000000000800e1f <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800e1f:	83 ff 20             	cmp    $0x20,%edi
+  800e22:	0f 94 c0             	sete   %al
+  800e25:	0f b6 c0             	movzbl %al,%eax
+}
+  800e28:	c3                   	ret
+
+0000000000800e29 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800e29:	89 f8                	mov    %edi,%eax
+  800e2b:	f7 d8                	neg    %eax
+  800e2d:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800e30:	c3                   	ret
+
+0000000000800e31 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e31:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e34:	48 89 f8             	mov    %rdi,%rax
+  800e37:	48 f7 d8             	neg    %rax
+  800e3a:	83 e0 07             	and    $0x7,%eax
+  800e3d:	49 89 d1             	mov    %rdx,%r9
+  800e40:	49 29 c1             	sub    %rax,%r9
+  800e43:	78 36                	js     800e7b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e45:	40 0f b6 c6          	movzbl %sil,%eax
+  800e49:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e50:	01 01 01 
+  800e53:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e57:	40 f6 c7 07          	test   $0x7,%dil
+  800e5b:	75 38                	jne    800e95 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e5d:	4c 89 c9             	mov    %r9,%rcx
+  800e60:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e64:	74 0c                	je     800e72 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e66:	fc                   	cld
+  800e67:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e6a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e6e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e72:	4d 85 c9             	test   %r9,%r9
+  800e75:	75 45                	jne    800ebc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e77:	4c 89 c0             	mov    %r8,%rax
+  800e7a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e7b:	48 85 d2             	test   %rdx,%rdx
+  800e7e:	74 f7                	je     800e77 <memset+0x46>
+  800e80:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e83:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e86:	48 83 c0 01          	add    $0x1,%rax
+  800e8a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e8e:	48 39 c2             	cmp    %rax,%rdx
+  800e91:	75 f3                	jne    800e86 <memset+0x55>
+  800e93:	eb e2                	jmp    800e77 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e95:	40 f6 c7 01          	test   $0x1,%dil
+  800e99:	74 06                	je     800ea1 <memset+0x70>
+  800e9b:	88 07                	mov    %al,(%rdi)
+  800e9d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ea1:	40 f6 c7 02          	test   $0x2,%dil
+  800ea5:	74 07                	je     800eae <memset+0x7d>
+  800ea7:	66 89 07             	mov    %ax,(%rdi)
+  800eaa:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eae:	40 f6 c7 04          	test   $0x4,%dil
+  800eb2:	74 a9                	je     800e5d <memset+0x2c>
+  800eb4:	89 07                	mov    %eax,(%rdi)
+  800eb6:	48 83 c7 04          	add    $0x4,%rdi
+  800eba:	eb a1                	jmp    800e5d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ebc:	41 f6 c1 04          	test   $0x4,%r9b
+  800ec0:	74 06                	je     800ec8 <memset+0x97>
+  800ec2:	89 07                	mov    %eax,(%rdi)
+  800ec4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ec8:	41 f6 c1 02          	test   $0x2,%r9b
+  800ecc:	74 07                	je     800ed5 <memset+0xa4>
+  800ece:	66 89 07             	mov    %ax,(%rdi)
+  800ed1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ed5:	41 f6 c1 01          	test   $0x1,%r9b
+  800ed9:	74 9c                	je     800e77 <memset+0x46>
+  800edb:	88 07                	mov    %al,(%rdi)
+  800edd:	eb 98                	jmp    800e77 <memset+0x46>
+
+0000000000800edf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800edf:	48 89 f8             	mov    %rdi,%rax
+  800ee2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ee5:	48 39 fe             	cmp    %rdi,%rsi
+  800ee8:	73 3b                	jae    800f25 <memmove+0x46>
+  800eea:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800eee:	48 39 d7             	cmp    %rdx,%rdi
+  800ef1:	73 32                	jae    800f25 <memmove+0x46>
+        s += n;
+        d += n;
+  800ef3:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ef7:	48 89 d6             	mov    %rdx,%rsi
+  800efa:	48 09 fe             	or     %rdi,%rsi
+  800efd:	48 09 ce             	or     %rcx,%rsi
+  800f00:	40 f6 c6 07          	test   $0x7,%sil
+  800f04:	75 12                	jne    800f18 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f06:	48 83 ef 08          	sub    $0x8,%rdi
+  800f0a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f0e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f12:	fd                   	std
+  800f13:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f16:	fc                   	cld
+  800f17:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f18:	48 83 ef 01          	sub    $0x1,%rdi
+  800f1c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f20:	fd                   	std
+  800f21:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f23:	eb f1                	jmp    800f16 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f25:	48 89 f2             	mov    %rsi,%rdx
+  800f28:	48 09 c2             	or     %rax,%rdx
+  800f2b:	48 09 ca             	or     %rcx,%rdx
+  800f2e:	f6 c2 07             	test   $0x7,%dl
+  800f31:	75 0c                	jne    800f3f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f33:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f37:	48 89 c7             	mov    %rax,%rdi
+  800f3a:	fc                   	cld
+  800f3b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f3e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f3f:	48 89 c7             	mov    %rax,%rdi
+  800f42:	fc                   	cld
+  800f43:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f45:	c3                   	ret
+
+0000000000800f46 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f46:	55                   	push   %rbp
+  800f47:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f4a:	48 b8 df 0e 80 00 00 	movabs $0x800edf,%rax
+  800f51:	00 00 00 
+  800f54:	ff d0                	call   *%rax
+}
+  800f56:	5d                   	pop    %rbp
+  800f57:	c3                   	ret
+
+0000000000800f58 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f58:	55                   	push   %rbp
+  800f59:	48 89 e5             	mov    %rsp,%rbp
+  800f5c:	41 57                	push   %r15
+  800f5e:	41 56                	push   %r14
+  800f60:	41 55                	push   %r13
+  800f62:	41 54                	push   %r12
+  800f64:	53                   	push   %rbx
+  800f65:	48 83 ec 08          	sub    $0x8,%rsp
+  800f69:	49 89 fe             	mov    %rdi,%r14
+  800f6c:	49 89 f7             	mov    %rsi,%r15
+  800f6f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f72:	48 89 f7             	mov    %rsi,%rdi
+  800f75:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  800f7c:	00 00 00 
+  800f7f:	ff d0                	call   *%rax
+  800f81:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f84:	48 89 de             	mov    %rbx,%rsi
+  800f87:	4c 89 f7             	mov    %r14,%rdi
+  800f8a:	48 b8 2e 0b 80 00 00 	movabs $0x800b2e,%rax
+  800f91:	00 00 00 
+  800f94:	ff d0                	call   *%rax
+  800f96:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f99:	48 39 c3             	cmp    %rax,%rbx
+  800f9c:	74 36                	je     800fd4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f9e:	48 89 d8             	mov    %rbx,%rax
+  800fa1:	4c 29 e8             	sub    %r13,%rax
+  800fa4:	49 39 c4             	cmp    %rax,%r12
+  800fa7:	73 31                	jae    800fda <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fa9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fae:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fb2:	4c 89 fe             	mov    %r15,%rsi
+  800fb5:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  800fbc:	00 00 00 
+  800fbf:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fc1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fc5:	48 83 c4 08          	add    $0x8,%rsp
+  800fc9:	5b                   	pop    %rbx
+  800fca:	41 5c                	pop    %r12
+  800fcc:	41 5d                	pop    %r13
+  800fce:	41 5e                	pop    %r14
+  800fd0:	41 5f                	pop    %r15
+  800fd2:	5d                   	pop    %rbp
+  800fd3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fd4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fd8:	eb eb                	jmp    800fc5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fda:	48 83 eb 01          	sub    $0x1,%rbx
+  800fde:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fe2:	48 89 da             	mov    %rbx,%rdx
+  800fe5:	4c 89 fe             	mov    %r15,%rsi
+  800fe8:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  800fef:	00 00 00 
+  800ff2:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ff4:	49 01 de             	add    %rbx,%r14
+  800ff7:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ffc:	eb c3                	jmp    800fc1 <strlcat+0x69>
+
+0000000000800ffe <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ffe:	48 85 d2             	test   %rdx,%rdx
+  801001:	74 2d                	je     801030 <memcmp+0x32>
+  801003:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801008:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80100c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801011:	44 38 c1             	cmp    %r8b,%cl
+  801014:	75 0f                	jne    801025 <memcmp+0x27>
+    while (n-- > 0) {
+  801016:	48 83 c0 01          	add    $0x1,%rax
+  80101a:	48 39 c2             	cmp    %rax,%rdx
+  80101d:	75 e9                	jne    801008 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80101f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801024:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801025:	0f b6 c1             	movzbl %cl,%eax
+  801028:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80102c:	44 29 c0             	sub    %r8d,%eax
+  80102f:	c3                   	ret
+    return 0;
+  801030:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801035:	c3                   	ret
+
+0000000000801036 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801036:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80103a:	48 39 c7             	cmp    %rax,%rdi
+  80103d:	73 0f                	jae    80104e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80103f:	40 38 37             	cmp    %sil,(%rdi)
+  801042:	74 0e                	je     801052 <memfind+0x1c>
+    for (; src < end; src++) {
+  801044:	48 83 c7 01          	add    $0x1,%rdi
+  801048:	48 39 f8             	cmp    %rdi,%rax
+  80104b:	75 f2                	jne    80103f <memfind+0x9>
+  80104d:	c3                   	ret
+  80104e:	48 89 f8             	mov    %rdi,%rax
+  801051:	c3                   	ret
+  801052:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801055:	c3                   	ret
+
+0000000000801056 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801056:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801059:	0f b6 37             	movzbl (%rdi),%esi
+  80105c:	40 80 fe 20          	cmp    $0x20,%sil
+  801060:	74 06                	je     801068 <strtol+0x12>
+  801062:	40 80 fe 09          	cmp    $0x9,%sil
+  801066:	75 13                	jne    80107b <strtol+0x25>
+  801068:	48 83 c7 01          	add    $0x1,%rdi
+  80106c:	0f b6 37             	movzbl (%rdi),%esi
+  80106f:	40 80 fe 20          	cmp    $0x20,%sil
+  801073:	74 f3                	je     801068 <strtol+0x12>
+  801075:	40 80 fe 09          	cmp    $0x9,%sil
+  801079:	74 ed                	je     801068 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80107b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80107e:	83 e0 fd             	and    $0xfffffffd,%eax
+  801081:	3c 01                	cmp    $0x1,%al
+  801083:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801087:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80108d:	75 0f                	jne    80109e <strtol+0x48>
+  80108f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801092:	74 14                	je     8010a8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801094:	85 d2                	test   %edx,%edx
+  801096:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80109b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80109e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010a3:	4c 63 ca             	movslq %edx,%r9
+  8010a6:	eb 36                	jmp    8010de <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010a8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010ac:	74 0f                	je     8010bd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010ae:	85 d2                	test   %edx,%edx
+  8010b0:	75 ec                	jne    80109e <strtol+0x48>
+        s++;
+  8010b2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010b6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010bb:	eb e1                	jmp    80109e <strtol+0x48>
+        s += 2;
+  8010bd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010c1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010c6:	eb d6                	jmp    80109e <strtol+0x48>
+            dig -= '0';
+  8010c8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010cb:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010cf:	41 39 d0             	cmp    %edx,%r8d
+  8010d2:	7d 21                	jge    8010f5 <strtol+0x9f>
+        val = val * base + dig;
+  8010d4:	49 0f af c1          	imul   %r9,%rax
+  8010d8:	0f b6 c9             	movzbl %cl,%ecx
+  8010db:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010de:	48 83 c7 01          	add    $0x1,%rdi
+  8010e2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010e6:	80 f9 39             	cmp    $0x39,%cl
+  8010e9:	76 dd                	jbe    8010c8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010eb:	80 f9 7b             	cmp    $0x7b,%cl
+  8010ee:	77 05                	ja     8010f5 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010f0:	83 e9 57             	sub    $0x57,%ecx
+  8010f3:	eb d6                	jmp    8010cb <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010f5:	4d 85 d2             	test   %r10,%r10
+  8010f8:	74 03                	je     8010fd <strtol+0xa7>
+  8010fa:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010fd:	48 89 c2             	mov    %rax,%rdx
+  801100:	48 f7 da             	neg    %rdx
+  801103:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801107:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80110b:	c3                   	ret
+
+000000000080110c <atoi>:
+int atoi(const char *str) {
+  80110c:	55                   	push   %rbp
+  80110d:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801110:	ba 00 00 00 00       	mov    $0x0,%edx
+  801115:	be 00 00 00 00       	mov    $0x0,%esi
+  80111a:	48 b8 56 10 80 00 00 	movabs $0x801056,%rax
+  801121:	00 00 00 
+  801124:	ff d0                	call   *%rax
+}
+  801126:	5d                   	pop    %rbp
+  801127:	c3                   	ret
+
+0000000000801128 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801128:	55                   	push   %rbp
+  801129:	48 89 e5             	mov    %rsp,%rbp
+  80112c:	53                   	push   %rbx
+  80112d:	48 89 fa             	mov    %rdi,%rdx
+  801130:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801133:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801138:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801142:	be 00 00 00 00       	mov    $0x0,%esi
+  801147:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80114d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80114f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801153:	c9                   	leave
+  801154:	c3                   	ret
+
+0000000000801155 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801155:	55                   	push   %rbp
+  801156:	48 89 e5             	mov    %rsp,%rbp
+  801159:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80115a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80115f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801164:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801169:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801173:	be 00 00 00 00       	mov    $0x0,%esi
+  801178:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801180:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801184:	c9                   	leave
+  801185:	c3                   	ret
+
+0000000000801186 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801186:	55                   	push   %rbp
+  801187:	48 89 e5             	mov    %rsp,%rbp
+  80118a:	53                   	push   %rbx
+  80118b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80118f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801192:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801197:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80119c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011b3:	48 85 c0             	test   %rax,%rax
+  8011b6:	7f 06                	jg     8011be <sys_env_destroy+0x38>
+}
+  8011b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011bc:	c9                   	leave
+  8011bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011be:	49 89 c0             	mov    %rax,%r8
+  8011c1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011c6:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8011cd:	00 00 00 
+  8011d0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8011d5:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8011dc:	00 00 00 
+  8011df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e4:	49 b9 50 3f 80 00 00 	movabs $0x803f50,%r9
+  8011eb:	00 00 00 
+  8011ee:	41 ff d1             	call   *%r9
+
+00000000008011f1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011f1:	55                   	push   %rbp
+  8011f2:	48 89 e5             	mov    %rsp,%rbp
+  8011f5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801200:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801205:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120f:	be 00 00 00 00       	mov    $0x0,%esi
+  801214:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80121a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80121c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801220:	c9                   	leave
+  801221:	c3                   	ret
+
+0000000000801222 <sys_yield>:
+
+void
+sys_yield(void) {
+  801222:	55                   	push   %rbp
+  801223:	48 89 e5             	mov    %rsp,%rbp
+  801226:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801227:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80122c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801231:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801236:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801240:	be 00 00 00 00       	mov    $0x0,%esi
+  801245:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80124b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80124d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801251:	c9                   	leave
+  801252:	c3                   	ret
+
+0000000000801253 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801253:	55                   	push   %rbp
+  801254:	48 89 e5             	mov    %rsp,%rbp
+  801257:	53                   	push   %rbx
+  801258:	48 89 fa             	mov    %rdi,%rdx
+  80125b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80125e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801263:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80126a:	00 00 00 
+  80126d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801272:	be 00 00 00 00       	mov    $0x0,%esi
+  801277:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80127f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801283:	c9                   	leave
+  801284:	c3                   	ret
+
+0000000000801285 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801285:	55                   	push   %rbp
+  801286:	48 89 e5             	mov    %rsp,%rbp
+  801289:	53                   	push   %rbx
+  80128a:	49 89 f8             	mov    %rdi,%r8
+  80128d:	48 89 d3             	mov    %rdx,%rbx
+  801290:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801293:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801298:	4c 89 c2             	mov    %r8,%rdx
+  80129b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129e:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012af:	c9                   	leave
+  8012b0:	c3                   	ret
+
+00000000008012b1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012b1:	55                   	push   %rbp
+  8012b2:	48 89 e5             	mov    %rsp,%rbp
+  8012b5:	53                   	push   %rbx
+  8012b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ba:	89 f8                	mov    %edi,%eax
+  8012bc:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012bf:	48 63 f9             	movslq %ecx,%rdi
+  8012c2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ca:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012da:	48 85 c0             	test   %rax,%rax
+  8012dd:	7f 06                	jg     8012e5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e3:	c9                   	leave
+  8012e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e5:	49 89 c0             	mov    %rax,%r8
+  8012e8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012ed:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8012f4:	00 00 00 
+  8012f7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8012fc:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801303:	00 00 00 
+  801306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130b:	49 b9 50 3f 80 00 00 	movabs $0x803f50,%r9
+  801312:	00 00 00 
+  801315:	41 ff d1             	call   *%r9
+
+0000000000801318 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801318:	55                   	push   %rbp
+  801319:	48 89 e5             	mov    %rsp,%rbp
+  80131c:	53                   	push   %rbx
+  80131d:	48 83 ec 08          	sub    $0x8,%rsp
+  801321:	89 f8                	mov    %edi,%eax
+  801323:	49 89 f2             	mov    %rsi,%r10
+  801326:	48 89 cf             	mov    %rcx,%rdi
+  801329:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80132c:	48 63 da             	movslq %edx,%rbx
+  80132f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801332:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801337:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80133d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80133f:	48 85 c0             	test   %rax,%rax
+  801342:	7f 06                	jg     80134a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801344:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801348:	c9                   	leave
+  801349:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80134a:	49 89 c0             	mov    %rax,%r8
+  80134d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801352:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801359:	00 00 00 
+  80135c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801361:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801368:	00 00 00 
+  80136b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801370:	49 b9 50 3f 80 00 00 	movabs $0x803f50,%r9
+  801377:	00 00 00 
+  80137a:	41 ff d1             	call   *%r9
+
+000000000080137d <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80137d:	55                   	push   %rbp
+  80137e:	48 89 e5             	mov    %rsp,%rbp
+  801381:	53                   	push   %rbx
+  801382:	48 83 ec 08          	sub    $0x8,%rsp
+  801386:	49 89 f9             	mov    %rdi,%r9
+  801389:	89 f0                	mov    %esi,%eax
+  80138b:	48 89 d3             	mov    %rdx,%rbx
+  80138e:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801391:	49 63 f0             	movslq %r8d,%rsi
+  801394:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801397:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80139c:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a7:	48 85 c0             	test   %rax,%rax
+  8013aa:	7f 06                	jg     8013b2 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b0:	c9                   	leave
+  8013b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b2:	49 89 c0             	mov    %rax,%r8
+  8013b5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013ba:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8013c1:	00 00 00 
+  8013c4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013c9:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8013d0:	00 00 00 
+  8013d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d8:	49 b9 50 3f 80 00 00 	movabs $0x803f50,%r9
+  8013df:	00 00 00 
+  8013e2:	41 ff d1             	call   *%r9
+
+00000000008013e5 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8013e5:	55                   	push   %rbp
+  8013e6:	48 89 e5             	mov    %rsp,%rbp
+  8013e9:	53                   	push   %rbx
+  8013ea:	89 f8                	mov    %edi,%eax
+  8013ec:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8013ef:	48 63 f9             	movslq %ecx,%rdi
+  8013f2:	48 63 da             	movslq %edx,%rbx
+  8013f5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801400:	be 00 00 00 00       	mov    $0x0,%esi
+  801405:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140b:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80140d:	89 c2                	mov    %eax,%edx
+  80140f:	48 85 c0             	test   %rax,%rax
+  801412:	78 0d                	js     801421 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801414:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801419:	4d 85 c9             	test   %r9,%r9
+  80141c:	74 03                	je     801421 <sys_alloc_dma_region+0x3c>
+  80141e:	49 89 01             	mov    %rax,(%r9)
+}
+  801421:	89 d0                	mov    %edx,%eax
+  801423:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801427:	c9                   	leave
+  801428:	c3                   	ret
+
+0000000000801429 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801429:	55                   	push   %rbp
+  80142a:	48 89 e5             	mov    %rsp,%rbp
+  80142d:	53                   	push   %rbx
+  80142e:	48 83 ec 08          	sub    $0x8,%rsp
+  801432:	48 89 f1             	mov    %rsi,%rcx
+  801435:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801438:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80143b:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801440:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801445:	be 00 00 00 00       	mov    $0x0,%esi
+  80144a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801450:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801452:	48 85 c0             	test   %rax,%rax
+  801455:	7f 06                	jg     80145d <sys_set_cache_region+0x34>
+}
+  801457:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145b:	c9                   	leave
+  80145c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145d:	49 89 c0             	mov    %rax,%r8
+  801460:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801465:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80146c:	00 00 00 
+  80146f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801474:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80147b:	00 00 00 
+  80147e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801483:	49 b9 50 3f 80 00 00 	movabs $0x803f50,%r9
+  80148a:	00 00 00 
+  80148d:	41 ff d1             	call   *%r9
+
+0000000000801490 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801490:	55                   	push   %rbp
+  801491:	48 89 e5             	mov    %rsp,%rbp
+  801494:	53                   	push   %rbx
+  801495:	48 83 ec 08          	sub    $0x8,%rsp
+  801499:	48 89 f1             	mov    %rsi,%rcx
+  80149c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80149f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b9:	48 85 c0             	test   %rax,%rax
+  8014bc:	7f 06                	jg     8014c4 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c2:	c9                   	leave
+  8014c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c4:	49 89 c0             	mov    %rax,%r8
+  8014c7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014cc:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8014d3:	00 00 00 
+  8014d6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014db:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8014e2:	00 00 00 
+  8014e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ea:	49 b9 50 3f 80 00 00 	movabs $0x803f50,%r9
+  8014f1:	00 00 00 
+  8014f4:	41 ff d1             	call   *%r9
+
+00000000008014f7 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014f7:	55                   	push   %rbp
+  8014f8:	48 89 e5             	mov    %rsp,%rbp
+  8014fb:	53                   	push   %rbx
+  8014fc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801500:	48 63 ce             	movslq %esi,%rcx
+  801503:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801506:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80150b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801510:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801515:	be 00 00 00 00       	mov    $0x0,%esi
+  80151a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801520:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801522:	48 85 c0             	test   %rax,%rax
+  801525:	7f 06                	jg     80152d <sys_env_set_status+0x36>
+}
+  801527:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152b:	c9                   	leave
+  80152c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80152d:	49 89 c0             	mov    %rax,%r8
+  801530:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801535:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80153c:	00 00 00 
+  80153f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801544:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80154b:	00 00 00 
+  80154e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801553:	49 b9 50 3f 80 00 00 	movabs $0x803f50,%r9
+  80155a:	00 00 00 
+  80155d:	41 ff d1             	call   *%r9
+
+0000000000801560 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801560:	55                   	push   %rbp
+  801561:	48 89 e5             	mov    %rsp,%rbp
+  801564:	53                   	push   %rbx
+  801565:	48 83 ec 08          	sub    $0x8,%rsp
+  801569:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80156c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801574:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801579:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157e:	be 00 00 00 00       	mov    $0x0,%esi
+  801583:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801589:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80158b:	48 85 c0             	test   %rax,%rax
+  80158e:	7f 06                	jg     801596 <sys_env_set_trapframe+0x36>
+}
+  801590:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801594:	c9                   	leave
+  801595:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801596:	49 89 c0             	mov    %rax,%r8
+  801599:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80159e:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8015a5:	00 00 00 
+  8015a8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015ad:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8015b4:	00 00 00 
+  8015b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bc:	49 b9 50 3f 80 00 00 	movabs $0x803f50,%r9
+  8015c3:	00 00 00 
+  8015c6:	41 ff d1             	call   *%r9
+
+00000000008015c9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015c9:	55                   	push   %rbp
+  8015ca:	48 89 e5             	mov    %rsp,%rbp
+  8015cd:	53                   	push   %rbx
+  8015ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015d5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f4:	48 85 c0             	test   %rax,%rax
+  8015f7:	7f 06                	jg     8015ff <sys_env_set_pgfault_upcall+0x36>
+}
+  8015f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fd:	c9                   	leave
+  8015fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ff:	49 89 c0             	mov    %rax,%r8
+  801602:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801607:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80160e:	00 00 00 
+  801611:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801616:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80161d:	00 00 00 
+  801620:	b8 00 00 00 00       	mov    $0x0,%eax
+  801625:	49 b9 50 3f 80 00 00 	movabs $0x803f50,%r9
+  80162c:	00 00 00 
+  80162f:	41 ff d1             	call   *%r9
+
+0000000000801632 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801632:	55                   	push   %rbp
+  801633:	48 89 e5             	mov    %rsp,%rbp
+  801636:	53                   	push   %rbx
+  801637:	89 f8                	mov    %edi,%eax
+  801639:	49 89 f1             	mov    %rsi,%r9
+  80163c:	48 89 d3             	mov    %rdx,%rbx
+  80163f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801642:	49 63 f0             	movslq %r8d,%rsi
+  801645:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801648:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801650:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801656:	cd 30                	int    $0x30
+}
+  801658:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80165c:	c9                   	leave
+  80165d:	c3                   	ret
+
+000000000080165e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80165e:	55                   	push   %rbp
+  80165f:	48 89 e5             	mov    %rsp,%rbp
+  801662:	53                   	push   %rbx
+  801663:	48 83 ec 08          	sub    $0x8,%rsp
+  801667:	48 89 fa             	mov    %rdi,%rdx
+  80166a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80166d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801672:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801677:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167c:	be 00 00 00 00       	mov    $0x0,%esi
+  801681:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801687:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801689:	48 85 c0             	test   %rax,%rax
+  80168c:	7f 06                	jg     801694 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80168e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801692:	c9                   	leave
+  801693:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801694:	49 89 c0             	mov    %rax,%r8
+  801697:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80169c:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8016a3:	00 00 00 
+  8016a6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016ab:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8016b2:	00 00 00 
+  8016b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ba:	49 b9 50 3f 80 00 00 	movabs $0x803f50,%r9
+  8016c1:	00 00 00 
+  8016c4:	41 ff d1             	call   *%r9
+
+00000000008016c7 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8016c7:	55                   	push   %rbp
+  8016c8:	48 89 e5             	mov    %rsp,%rbp
+  8016cb:	53                   	push   %rbx
+  8016cc:	48 89 fa             	mov    %rdi,%rdx
+  8016cf:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d2:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ec:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f2:	c9                   	leave
+  8016f3:	c3                   	ret
+
+00000000008016f4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016f4:	55                   	push   %rbp
+  8016f5:	48 89 e5             	mov    %rsp,%rbp
+  8016f8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f9:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801703:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801708:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801712:	be 00 00 00 00       	mov    $0x0,%esi
+  801717:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80171d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80171f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801723:	c9                   	leave
+  801724:	c3                   	ret
+
+0000000000801725 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801725:	48 85 ff             	test   %rdi,%rdi
+  801728:	0f 84 b6 01 00 00    	je     8018e4 <malloc+0x1bf>
+malloc(size_t size) {
+  80172e:	55                   	push   %rbp
+  80172f:	48 89 e5             	mov    %rsp,%rbp
+  801732:	41 56                	push   %r14
+  801734:	41 55                	push   %r13
+  801736:	41 54                	push   %r12
+  801738:	53                   	push   %rbx
+  801739:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80173c:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801743:	00 00 00 
+  801746:	4c 8b 20             	mov    (%rax),%r12
+  801749:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801750:	0f 87 94 01 00 00    	ja     8018ea <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801756:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80175d:	00 00 00 
+  801760:	48 85 c0             	test   %rax,%rax
+  801763:	74 6b                	je     8017d0 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801765:	4d 85 e4             	test   %r12,%r12
+  801768:	74 66                	je     8017d0 <malloc+0xab>
+  80176a:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801771:	00 00 00 
+  801774:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801779:	eb 0d                	jmp    801788 <malloc+0x63>
+  80177b:	48 83 c1 01          	add    $0x1,%rcx
+  80177f:	48 83 c2 18          	add    $0x18,%rdx
+  801783:	49 39 cc             	cmp    %rcx,%r12
+  801786:	74 48                	je     8017d0 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801788:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80178d:	74 ec                	je     80177b <malloc+0x56>
+  80178f:	48 39 1a             	cmp    %rbx,(%rdx)
+  801792:	72 e7                	jb     80177b <malloc+0x56>
+                real_freep_size--;
+  801794:	48 83 e8 01          	sub    $0x1,%rax
+  801798:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80179f:	00 00 00 
+                freep[i].is_free = false;
+  8017a2:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8017a9:	00 00 00 
+  8017ac:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8017b0:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8017b4:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8017b8:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8017bf:	00 
+                freep[i].size = size;
+  8017c0:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8017c4:	48 01 c8             	add    %rcx,%rax
+  8017c7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017cb:	e9 0b 01 00 00       	jmp    8018db <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8017d0:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8017d7:	00 00 00 
+  8017da:	48 01 d8             	add    %rbx,%rax
+  8017dd:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8017e3:	76 7c                	jbe    801861 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8017e5:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8017ec:	00 00 00 
+  8017ef:	4c 8b 30             	mov    (%rax),%r14
+  8017f2:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8017f9:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8017fc:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801803:	00 00 00 
+  801806:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  80180d:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801814:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80181a:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80181e:	48 b8 f1 11 80 00 00 	movabs $0x8011f1,%rax
+  801825:	00 00 00 
+  801828:	ff d0                	call   *%rax
+  80182a:	89 c7                	mov    %eax,%edi
+  80182c:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801833:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80183a:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801841:	00 00 00 
+  801844:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801848:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80184d:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  801854:	00 00 00 
+  801857:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	0f 88 90 00 00 00    	js     8018f1 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801861:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801868:	00 00 00 
+  80186b:	48 8b 31             	mov    (%rcx),%rsi
+  80186e:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801875:	00 00 00 
+  801878:	4c 8b 07             	mov    (%rdi),%r8
+  80187b:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80187f:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801886:	00 00 00 
+  801889:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80188d:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801891:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801898:	00 00 00 
+  80189b:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80189f:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  8018a2:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8018a6:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8018ad:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8018ae:	48 89 d8             	mov    %rbx,%rax
+  8018b1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8018b6:	4c 01 c0             	add    %r8,%rax
+  8018b9:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8018bc:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8018c3:	48 01 f3             	add    %rsi,%rbx
+  8018c6:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8018c9:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8018ce:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8018d5:	00 00 00 
+  8018d8:	48 89 d0             	mov    %rdx,%rax
+}
+  8018db:	5b                   	pop    %rbx
+  8018dc:	41 5c                	pop    %r12
+  8018de:	41 5d                	pop    %r13
+  8018e0:	41 5e                	pop    %r14
+  8018e2:	5d                   	pop    %rbp
+  8018e3:	c3                   	ret
+        return NULL;
+  8018e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018e9:	c3                   	ret
+        return NULL;
+  8018ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ef:	eb ea                	jmp    8018db <malloc+0x1b6>
+            return NULL;
+  8018f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f6:	eb e3                	jmp    8018db <malloc+0x1b6>
+
+00000000008018f8 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8018f8:	55                   	push   %rbp
+  8018f9:	48 89 e5             	mov    %rsp,%rbp
+  8018fc:	53                   	push   %rbx
+  8018fd:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801901:	48 89 fb             	mov    %rdi,%rbx
+  801904:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801908:	48 89 df             	mov    %rbx,%rdi
+  80190b:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801912:	00 00 00 
+  801915:	ff d0                	call   *%rax
+  801917:	48 89 c7             	mov    %rax,%rdi
+  80191a:	48 89 da             	mov    %rbx,%rdx
+  80191d:	be 00 00 00 00       	mov    $0x0,%esi
+  801922:	48 b8 31 0e 80 00 00 	movabs $0x800e31,%rax
+  801929:	00 00 00 
+  80192c:	ff d0                	call   *%rax
+}
+  80192e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801932:	c9                   	leave
+  801933:	c3                   	ret
+
+0000000000801934 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801934:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  80193b:	00 00 00 
+  80193e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801945:	00 00 00 
+  801948:	48 3b 02             	cmp    (%rdx),%rax
+  80194b:	74 4d                	je     80199a <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  80194d:	48 85 c0             	test   %rax,%rax
+  801950:	74 4d                	je     80199f <get_allocsize+0x6b>
+  801952:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801959:	00 00 00 
+  80195c:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801961:	48 3b 39             	cmp    (%rcx),%rdi
+  801964:	74 13                	je     801979 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801966:	48 83 c2 01          	add    $0x1,%rdx
+  80196a:	48 83 c1 18          	add    $0x18,%rcx
+  80196e:	48 39 d0             	cmp    %rdx,%rax
+  801971:	75 ee                	jne    801961 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+  801978:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801979:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80197d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801982:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801989:	00 00 00 
+  80198c:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801992:	75 0b                	jne    80199f <get_allocsize+0x6b>
+  801994:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801999:	c3                   	ret
+        return 0;
+  80199a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80199f:	c3                   	ret
+
+00000000008019a0 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  8019a0:	48 85 ff             	test   %rdi,%rdi
+  8019a3:	0f 84 01 01 00 00    	je     801aaa <free+0x10a>
+free(void *ptr) {
+  8019a9:	55                   	push   %rbp
+  8019aa:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8019ad:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8019b4:	00 00 00 
+  8019b7:	48 8b 30             	mov    (%rax),%rsi
+  8019ba:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8019c1:	00 00 00 
+  8019c4:	48 39 c6             	cmp    %rax,%rsi
+  8019c7:	74 50                	je     801a19 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8019c9:	48 85 f6             	test   %rsi,%rsi
+  8019cc:	74 21                	je     8019ef <free+0x4f>
+  8019ce:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8019d5:	00 00 00 
+  8019d8:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8019dd:	48 3b 39             	cmp    (%rcx),%rdi
+  8019e0:	74 61                	je     801a43 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8019e2:	48 83 c2 01          	add    $0x1,%rdx
+  8019e6:	48 83 c1 18          	add    $0x18,%rcx
+  8019ea:	48 39 d6             	cmp    %rdx,%rsi
+  8019ed:	75 ee                	jne    8019dd <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8019ef:	48 ba b0 55 80 00 00 	movabs $0x8055b0,%rdx
+  8019f6:	00 00 00 
+  8019f9:	be 12 01 00 00       	mov    $0x112,%esi
+  8019fe:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801a05:	00 00 00 
+  801a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0d:	48 b9 50 3f 80 00 00 	movabs $0x803f50,%rcx
+  801a14:	00 00 00 
+  801a17:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801a19:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801a20:	00 00 00 
+  801a23:	be 06 01 00 00       	mov    $0x106,%esi
+  801a28:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801a2f:	00 00 00 
+  801a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a37:	48 b9 50 3f 80 00 00 	movabs $0x803f50,%rcx
+  801a3e:	00 00 00 
+  801a41:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801a43:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a47:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a4e:	00 00 00 
+  801a51:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a57:	75 27                	jne    801a80 <free+0xe0>
+            freep[i].is_free = true;
+  801a59:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a5d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801a64:	00 00 00 
+  801a67:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801a6e:	00 00 
+            real_freep_size++;
+  801a70:	48 83 c0 01          	add    $0x1,%rax
+  801a74:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801a7b:	00 00 00 
+}
+  801a7e:	5d                   	pop    %rbp
+  801a7f:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801a80:	48 ba 88 55 80 00 00 	movabs $0x805588,%rdx
+  801a87:	00 00 00 
+  801a8a:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801a8f:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801a96:	00 00 00 
+  801a99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9e:	48 b9 50 3f 80 00 00 	movabs $0x803f50,%rcx
+  801aa5:	00 00 00 
+  801aa8:	ff d1                	call   *%rcx
+  801aaa:	c3                   	ret
+
+0000000000801aab <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801aab:	55                   	push   %rbp
+  801aac:	48 89 e5             	mov    %rsp,%rbp
+  801aaf:	41 55                	push   %r13
+  801ab1:	41 54                	push   %r12
+  801ab3:	53                   	push   %rbx
+  801ab4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ab8:	48 89 fb             	mov    %rdi,%rbx
+  801abb:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801abe:	48 b8 34 19 80 00 00 	movabs $0x801934,%rax
+  801ac5:	00 00 00 
+  801ac8:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801aca:	49 39 c5             	cmp    %rax,%r13
+  801acd:	73 0e                	jae    801add <realloc+0x32>
+}
+  801acf:	48 89 d8             	mov    %rbx,%rax
+  801ad2:	48 83 c4 08          	add    $0x8,%rsp
+  801ad6:	5b                   	pop    %rbx
+  801ad7:	41 5c                	pop    %r12
+  801ad9:	41 5d                	pop    %r13
+  801adb:	5d                   	pop    %rbp
+  801adc:	c3                   	ret
+  801add:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801ae0:	4c 89 ef             	mov    %r13,%rdi
+  801ae3:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+  801aef:	48 89 c7             	mov    %rax,%rdi
+  801af2:	4c 89 e2             	mov    %r12,%rdx
+  801af5:	48 89 de             	mov    %rbx,%rsi
+  801af8:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  801aff:	00 00 00 
+  801b02:	ff d0                	call   *%rax
+  801b04:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801b07:	48 89 df             	mov    %rbx,%rdi
+  801b0a:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  801b11:	00 00 00 
+  801b14:	ff d0                	call   *%rax
+    return newptr;
+  801b16:	4c 89 e3             	mov    %r12,%rbx
+  801b19:	eb b4                	jmp    801acf <realloc+0x24>
+
+0000000000801b1b <strdup>:
+
+char*
+strdup (const char *src) {
+  801b1b:	55                   	push   %rbp
+  801b1c:	48 89 e5             	mov    %rsp,%rbp
+  801b1f:	41 54                	push   %r12
+  801b21:	53                   	push   %rbx
+  801b22:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801b25:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  801b2c:	00 00 00 
+  801b2f:	ff d0                	call   *%rax
+  801b31:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801b35:	4c 89 e7             	mov    %r12,%rdi
+  801b38:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801b3f:	00 00 00 
+  801b42:	ff d0                	call   *%rax
+  801b44:	48 89 c7             	mov    %rax,%rdi
+  801b47:	4c 89 e2             	mov    %r12,%rdx
+  801b4a:	48 89 de             	mov    %rbx,%rsi
+  801b4d:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  801b54:	00 00 00 
+  801b57:	ff d0                	call   *%rax
+}
+  801b59:	5b                   	pop    %rbx
+  801b5a:	41 5c                	pop    %r12
+  801b5c:	5d                   	pop    %rbp
+  801b5d:	c3                   	ret
+
+0000000000801b5e <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801b5e:	55                   	push   %rbp
+  801b5f:	48 89 e5             	mov    %rsp,%rbp
+  801b62:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b63:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b77:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b81:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b87:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b8d:	c9                   	leave
+  801b8e:	c3                   	ret
+
+0000000000801b8f <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801b8f:	55                   	push   %rbp
+  801b90:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801b93:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801b9a:	00 00 00 
+  801b9d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801ba1:	74 26                	je     801bc9 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801ba3:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801ba5:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ba9:	89 c0                	mov    %eax,%eax
+  801bab:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801bae:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801bb5:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801bbc:	00 00 00 
+  801bbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc4:	48 f7 31             	divq   (%rcx)
+}
+  801bc7:	5d                   	pop    %rbp
+  801bc8:	c3                   	ret
+        freq = get_cpufreq();
+  801bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bce:	48 ba 5e 1b 80 00 00 	movabs $0x801b5e,%rdx
+  801bd5:	00 00 00 
+  801bd8:	ff d2                	call   *%rdx
+  801bda:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801be1:	00 00 00 
+  801be4:	eb bd                	jmp    801ba3 <get_ticks+0x14>
+
+0000000000801be6 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801be6:	55                   	push   %rbp
+  801be7:	48 89 e5             	mov    %rsp,%rbp
+  801bea:	53                   	push   %rbx
+  801beb:	48 83 ec 08          	sub    $0x8,%rsp
+  801bef:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801bf2:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801bf9:	00 00 00 
+  801bfc:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c00:	74 50                	je     801c52 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801c02:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c04:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c08:	89 c0                	mov    %eax,%eax
+  801c0a:	48 89 d6             	mov    %rdx,%rsi
+  801c0d:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801c10:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c17:	00 00 00 
+  801c1a:	48 0f af 18          	imul   (%rax),%rbx
+  801c1e:	48 c1 eb 03          	shr    $0x3,%rbx
+  801c22:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801c29:	9b c4 20 
+  801c2c:	48 89 d8             	mov    %rbx,%rax
+  801c2f:	48 f7 e2             	mul    %rdx
+  801c32:	48 89 d1             	mov    %rdx,%rcx
+  801c35:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801c39:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c3b:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c3f:	89 c0                	mov    %eax,%eax
+  801c41:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801c44:	48 29 f2             	sub    %rsi,%rdx
+  801c47:	48 39 ca             	cmp    %rcx,%rdx
+  801c4a:	72 ed                	jb     801c39 <sleep+0x53>
+}
+  801c4c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c50:	c9                   	leave
+  801c51:	c3                   	ret
+        freq = get_cpufreq();
+  801c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c57:	48 ba 5e 1b 80 00 00 	movabs $0x801b5e,%rdx
+  801c5e:	00 00 00 
+  801c61:	ff d2                	call   *%rdx
+  801c63:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c6a:	00 00 00 
+  801c6d:	eb 93                	jmp    801c02 <sleep+0x1c>
+
+0000000000801c6f <poll_kbd>:
+
+int poll_kbd() {
+  801c6f:	55                   	push   %rbp
+  801c70:	48 89 e5             	mov    %rsp,%rbp
+  801c73:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c74:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c88:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c8d:	be 00 00 00 00       	mov    $0x0,%esi
+  801c92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c98:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c9e:	c9                   	leave
+  801c9f:	c3                   	ret
+
+0000000000801ca0 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801ca0:	55                   	push   %rbp
+  801ca1:	48 89 e5             	mov    %rsp,%rbp
+  801ca4:	53                   	push   %rbx
+  801ca5:	49 89 fa             	mov    %rdi,%r10
+  801ca8:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801caa:	44 89 c6             	mov    %r8d,%esi
+  801cad:	89 cf                	mov    %ecx,%edi
+  801caf:	89 d3                	mov    %edx,%ebx
+  801cb1:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801cb3:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cb8:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cbb:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801cbf:	cd 30                	int    $0x30
+  801cc1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cc5:	c9                   	leave
+  801cc6:	c3                   	ret
+
+0000000000801cc7 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cc7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801cce:	ff ff ff 
+  801cd1:	48 01 f8             	add    %rdi,%rax
+  801cd4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801cd8:	c3                   	ret
+
+0000000000801cd9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cd9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ce0:	ff ff ff 
+  801ce3:	48 01 f8             	add    %rdi,%rax
+  801ce6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801cea:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801cf0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801cf4:	c3                   	ret
+
+0000000000801cf5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801cf5:	55                   	push   %rbp
+  801cf6:	48 89 e5             	mov    %rsp,%rbp
+  801cf9:	41 57                	push   %r15
+  801cfb:	41 56                	push   %r14
+  801cfd:	41 55                	push   %r13
+  801cff:	41 54                	push   %r12
+  801d01:	53                   	push   %rbx
+  801d02:	48 83 ec 08          	sub    $0x8,%rsp
+  801d06:	49 89 ff             	mov    %rdi,%r15
+  801d09:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801d0e:	49 bd a9 3b 80 00 00 	movabs $0x803ba9,%r13
+  801d15:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801d18:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801d1e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801d21:	48 89 df             	mov    %rbx,%rdi
+  801d24:	41 ff d5             	call   *%r13
+  801d27:	83 e0 04             	and    $0x4,%eax
+  801d2a:	74 17                	je     801d43 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801d2c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d33:	4c 39 f3             	cmp    %r14,%rbx
+  801d36:	75 e6                	jne    801d1e <fd_alloc+0x29>
+  801d38:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801d3e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801d43:	4d 89 27             	mov    %r12,(%r15)
+}
+  801d46:	48 83 c4 08          	add    $0x8,%rsp
+  801d4a:	5b                   	pop    %rbx
+  801d4b:	41 5c                	pop    %r12
+  801d4d:	41 5d                	pop    %r13
+  801d4f:	41 5e                	pop    %r14
+  801d51:	41 5f                	pop    %r15
+  801d53:	5d                   	pop    %rbp
+  801d54:	c3                   	ret
+
+0000000000801d55 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801d55:	83 ff 1f             	cmp    $0x1f,%edi
+  801d58:	77 39                	ja     801d93 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801d5a:	55                   	push   %rbp
+  801d5b:	48 89 e5             	mov    %rsp,%rbp
+  801d5e:	41 54                	push   %r12
+  801d60:	53                   	push   %rbx
+  801d61:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801d64:	48 63 df             	movslq %edi,%rbx
+  801d67:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801d6e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801d72:	48 89 df             	mov    %rbx,%rdi
+  801d75:	48 b8 a9 3b 80 00 00 	movabs $0x803ba9,%rax
+  801d7c:	00 00 00 
+  801d7f:	ff d0                	call   *%rax
+  801d81:	a8 04                	test   $0x4,%al
+  801d83:	74 14                	je     801d99 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d85:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d8e:	5b                   	pop    %rbx
+  801d8f:	41 5c                	pop    %r12
+  801d91:	5d                   	pop    %rbp
+  801d92:	c3                   	ret
+        return -E_INVAL;
+  801d93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d98:	c3                   	ret
+        return -E_INVAL;
+  801d99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d9e:	eb ee                	jmp    801d8e <fd_lookup+0x39>
+
+0000000000801da0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801da0:	55                   	push   %rbp
+  801da1:	48 89 e5             	mov    %rsp,%rbp
+  801da4:	41 54                	push   %r12
+  801da6:	53                   	push   %rbx
+  801da7:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801daa:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  801db1:	00 00 00 
+  801db4:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801dbb:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801dbe:	39 3b                	cmp    %edi,(%rbx)
+  801dc0:	74 47                	je     801e09 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801dc2:	48 83 c0 08          	add    $0x8,%rax
+  801dc6:	48 8b 18             	mov    (%rax),%rbx
+  801dc9:	48 85 db             	test   %rbx,%rbx
+  801dcc:	75 f0                	jne    801dbe <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801dce:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  801dd5:	00 00 00 
+  801dd8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dde:	89 fa                	mov    %edi,%edx
+  801de0:	48 bf e8 55 80 00 00 	movabs $0x8055e8,%rdi
+  801de7:	00 00 00 
+  801dea:	b8 00 00 00 00       	mov    $0x0,%eax
+  801def:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  801df6:	00 00 00 
+  801df9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801dfb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801e00:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801e04:	5b                   	pop    %rbx
+  801e05:	41 5c                	pop    %r12
+  801e07:	5d                   	pop    %rbp
+  801e08:	c3                   	ret
+            return 0;
+  801e09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0e:	eb f0                	jmp    801e00 <dev_lookup+0x60>
+
+0000000000801e10 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801e10:	55                   	push   %rbp
+  801e11:	48 89 e5             	mov    %rsp,%rbp
+  801e14:	41 55                	push   %r13
+  801e16:	41 54                	push   %r12
+  801e18:	53                   	push   %rbx
+  801e19:	48 83 ec 18          	sub    $0x18,%rsp
+  801e1d:	48 89 fb             	mov    %rdi,%rbx
+  801e20:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e23:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801e2a:	ff ff ff 
+  801e2d:	48 01 df             	add    %rbx,%rdi
+  801e30:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801e34:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e38:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  801e3f:	00 00 00 
+  801e42:	ff d0                	call   *%rax
+  801e44:	41 89 c5             	mov    %eax,%r13d
+  801e47:	85 c0                	test   %eax,%eax
+  801e49:	78 06                	js     801e51 <fd_close+0x41>
+  801e4b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801e4f:	74 1a                	je     801e6b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801e51:	45 84 e4             	test   %r12b,%r12b
+  801e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e59:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801e5d:	44 89 e8             	mov    %r13d,%eax
+  801e60:	48 83 c4 18          	add    $0x18,%rsp
+  801e64:	5b                   	pop    %rbx
+  801e65:	41 5c                	pop    %r12
+  801e67:	41 5d                	pop    %r13
+  801e69:	5d                   	pop    %rbp
+  801e6a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e6b:	8b 3b                	mov    (%rbx),%edi
+  801e6d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e71:	48 b8 a0 1d 80 00 00 	movabs $0x801da0,%rax
+  801e78:	00 00 00 
+  801e7b:	ff d0                	call   *%rax
+  801e7d:	41 89 c5             	mov    %eax,%r13d
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	78 1b                	js     801e9f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e84:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e88:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e8c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e92:	48 85 c0             	test   %rax,%rax
+  801e95:	74 08                	je     801e9f <fd_close+0x8f>
+  801e97:	48 89 df             	mov    %rbx,%rdi
+  801e9a:	ff d0                	call   *%rax
+  801e9c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e9f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ea4:	48 89 de             	mov    %rbx,%rsi
+  801ea7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eac:	48 b8 90 14 80 00 00 	movabs $0x801490,%rax
+  801eb3:	00 00 00 
+  801eb6:	ff d0                	call   *%rax
+    return res;
+  801eb8:	eb a3                	jmp    801e5d <fd_close+0x4d>
+
+0000000000801eba <close>:
+
+int
+close(int fdnum) {
+  801eba:	55                   	push   %rbp
+  801ebb:	48 89 e5             	mov    %rsp,%rbp
+  801ebe:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ec2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ec6:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  801ecd:	00 00 00 
+  801ed0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ed2:	85 c0                	test   %eax,%eax
+  801ed4:	78 15                	js     801eeb <close+0x31>
+
+    return fd_close(fd, 1);
+  801ed6:	be 01 00 00 00       	mov    $0x1,%esi
+  801edb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801edf:	48 b8 10 1e 80 00 00 	movabs $0x801e10,%rax
+  801ee6:	00 00 00 
+  801ee9:	ff d0                	call   *%rax
+}
+  801eeb:	c9                   	leave
+  801eec:	c3                   	ret
+
+0000000000801eed <close_all>:
+
+void
+close_all(void) {
+  801eed:	55                   	push   %rbp
+  801eee:	48 89 e5             	mov    %rsp,%rbp
+  801ef1:	41 54                	push   %r12
+  801ef3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ef4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ef9:	49 bc ba 1e 80 00 00 	movabs $0x801eba,%r12
+  801f00:	00 00 00 
+  801f03:	89 df                	mov    %ebx,%edi
+  801f05:	41 ff d4             	call   *%r12
+  801f08:	83 c3 01             	add    $0x1,%ebx
+  801f0b:	83 fb 20             	cmp    $0x20,%ebx
+  801f0e:	75 f3                	jne    801f03 <close_all+0x16>
+}
+  801f10:	5b                   	pop    %rbx
+  801f11:	41 5c                	pop    %r12
+  801f13:	5d                   	pop    %rbp
+  801f14:	c3                   	ret
+
+0000000000801f15 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801f15:	55                   	push   %rbp
+  801f16:	48 89 e5             	mov    %rsp,%rbp
+  801f19:	41 57                	push   %r15
+  801f1b:	41 56                	push   %r14
+  801f1d:	41 55                	push   %r13
+  801f1f:	41 54                	push   %r12
+  801f21:	53                   	push   %rbx
+  801f22:	48 83 ec 18          	sub    $0x18,%rsp
+  801f26:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801f29:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801f2d:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  801f34:	00 00 00 
+  801f37:	ff d0                	call   *%rax
+  801f39:	89 c3                	mov    %eax,%ebx
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	0f 88 b8 00 00 00    	js     801ffb <dup+0xe6>
+    close(newfdnum);
+  801f43:	44 89 e7             	mov    %r12d,%edi
+  801f46:	48 b8 ba 1e 80 00 00 	movabs $0x801eba,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801f52:	4d 63 ec             	movslq %r12d,%r13
+  801f55:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801f5c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801f60:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801f64:	4c 89 ff             	mov    %r15,%rdi
+  801f67:	49 be d9 1c 80 00 00 	movabs $0x801cd9,%r14
+  801f6e:	00 00 00 
+  801f71:	41 ff d6             	call   *%r14
+  801f74:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801f77:	4c 89 ef             	mov    %r13,%rdi
+  801f7a:	41 ff d6             	call   *%r14
+  801f7d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801f80:	48 89 df             	mov    %rbx,%rdi
+  801f83:	48 b8 a9 3b 80 00 00 	movabs $0x803ba9,%rax
+  801f8a:	00 00 00 
+  801f8d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801f8f:	a8 04                	test   $0x4,%al
+  801f91:	74 2b                	je     801fbe <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801f93:	41 89 c1             	mov    %eax,%r9d
+  801f96:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f9c:	4c 89 f1             	mov    %r14,%rcx
+  801f9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa4:	48 89 de             	mov    %rbx,%rsi
+  801fa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fac:	48 b8 18 13 80 00 00 	movabs $0x801318,%rax
+  801fb3:	00 00 00 
+  801fb6:	ff d0                	call   *%rax
+  801fb8:	89 c3                	mov    %eax,%ebx
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	78 4e                	js     80200c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801fbe:	4c 89 ff             	mov    %r15,%rdi
+  801fc1:	48 b8 a9 3b 80 00 00 	movabs $0x803ba9,%rax
+  801fc8:	00 00 00 
+  801fcb:	ff d0                	call   *%rax
+  801fcd:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801fd0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fd6:	4c 89 e9             	mov    %r13,%rcx
+  801fd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fde:	4c 89 fe             	mov    %r15,%rsi
+  801fe1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fe6:	48 b8 18 13 80 00 00 	movabs $0x801318,%rax
+  801fed:	00 00 00 
+  801ff0:	ff d0                	call   *%rax
+  801ff2:	89 c3                	mov    %eax,%ebx
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	78 14                	js     80200c <dup+0xf7>
+
+    return newfdnum;
+  801ff8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ffb:	89 d8                	mov    %ebx,%eax
+  801ffd:	48 83 c4 18          	add    $0x18,%rsp
+  802001:	5b                   	pop    %rbx
+  802002:	41 5c                	pop    %r12
+  802004:	41 5d                	pop    %r13
+  802006:	41 5e                	pop    %r14
+  802008:	41 5f                	pop    %r15
+  80200a:	5d                   	pop    %rbp
+  80200b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80200c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802011:	4c 89 ee             	mov    %r13,%rsi
+  802014:	bf 00 00 00 00       	mov    $0x0,%edi
+  802019:	49 bc 90 14 80 00 00 	movabs $0x801490,%r12
+  802020:	00 00 00 
+  802023:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802026:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80202b:	4c 89 f6             	mov    %r14,%rsi
+  80202e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802033:	41 ff d4             	call   *%r12
+    return res;
+  802036:	eb c3                	jmp    801ffb <dup+0xe6>
+
+0000000000802038 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802038:	55                   	push   %rbp
+  802039:	48 89 e5             	mov    %rsp,%rbp
+  80203c:	41 56                	push   %r14
+  80203e:	41 55                	push   %r13
+  802040:	41 54                	push   %r12
+  802042:	53                   	push   %rbx
+  802043:	48 83 ec 10          	sub    $0x10,%rsp
+  802047:	89 fb                	mov    %edi,%ebx
+  802049:	49 89 f4             	mov    %rsi,%r12
+  80204c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80204f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802053:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  80205a:	00 00 00 
+  80205d:	ff d0                	call   *%rax
+  80205f:	85 c0                	test   %eax,%eax
+  802061:	78 4c                	js     8020af <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802063:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802067:	41 8b 3e             	mov    (%r14),%edi
+  80206a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80206e:	48 b8 a0 1d 80 00 00 	movabs $0x801da0,%rax
+  802075:	00 00 00 
+  802078:	ff d0                	call   *%rax
+  80207a:	85 c0                	test   %eax,%eax
+  80207c:	78 35                	js     8020b3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80207e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802082:	83 e0 03             	and    $0x3,%eax
+  802085:	83 f8 01             	cmp    $0x1,%eax
+  802088:	74 2d                	je     8020b7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80208a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80208e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802092:	48 85 c0             	test   %rax,%rax
+  802095:	74 56                	je     8020ed <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802097:	4c 89 ea             	mov    %r13,%rdx
+  80209a:	4c 89 e6             	mov    %r12,%rsi
+  80209d:	4c 89 f7             	mov    %r14,%rdi
+  8020a0:	ff d0                	call   *%rax
+}
+  8020a2:	48 83 c4 10          	add    $0x10,%rsp
+  8020a6:	5b                   	pop    %rbx
+  8020a7:	41 5c                	pop    %r12
+  8020a9:	41 5d                	pop    %r13
+  8020ab:	41 5e                	pop    %r14
+  8020ad:	5d                   	pop    %rbp
+  8020ae:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020af:	48 98                	cltq
+  8020b1:	eb ef                	jmp    8020a2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020b3:	48 98                	cltq
+  8020b5:	eb eb                	jmp    8020a2 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020b7:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8020be:	00 00 00 
+  8020c1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020c7:	89 da                	mov    %ebx,%edx
+  8020c9:	48 bf 29 56 80 00 00 	movabs $0x805629,%rdi
+  8020d0:	00 00 00 
+  8020d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d8:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  8020df:	00 00 00 
+  8020e2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020e4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020eb:	eb b5                	jmp    8020a2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020ed:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020f4:	eb ac                	jmp    8020a2 <read+0x6a>
+
+00000000008020f6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8020f6:	55                   	push   %rbp
+  8020f7:	48 89 e5             	mov    %rsp,%rbp
+  8020fa:	41 57                	push   %r15
+  8020fc:	41 56                	push   %r14
+  8020fe:	41 55                	push   %r13
+  802100:	41 54                	push   %r12
+  802102:	53                   	push   %rbx
+  802103:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802107:	48 85 d2             	test   %rdx,%rdx
+  80210a:	74 54                	je     802160 <readn+0x6a>
+  80210c:	41 89 fd             	mov    %edi,%r13d
+  80210f:	49 89 f6             	mov    %rsi,%r14
+  802112:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802115:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80211a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80211f:	49 bf 38 20 80 00 00 	movabs $0x802038,%r15
+  802126:	00 00 00 
+  802129:	4c 89 e2             	mov    %r12,%rdx
+  80212c:	48 29 f2             	sub    %rsi,%rdx
+  80212f:	4c 01 f6             	add    %r14,%rsi
+  802132:	44 89 ef             	mov    %r13d,%edi
+  802135:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802138:	85 c0                	test   %eax,%eax
+  80213a:	78 20                	js     80215c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80213c:	01 c3                	add    %eax,%ebx
+  80213e:	85 c0                	test   %eax,%eax
+  802140:	74 08                	je     80214a <readn+0x54>
+  802142:	48 63 f3             	movslq %ebx,%rsi
+  802145:	4c 39 e6             	cmp    %r12,%rsi
+  802148:	72 df                	jb     802129 <readn+0x33>
+    }
+    return res;
+  80214a:	48 63 c3             	movslq %ebx,%rax
+}
+  80214d:	48 83 c4 08          	add    $0x8,%rsp
+  802151:	5b                   	pop    %rbx
+  802152:	41 5c                	pop    %r12
+  802154:	41 5d                	pop    %r13
+  802156:	41 5e                	pop    %r14
+  802158:	41 5f                	pop    %r15
+  80215a:	5d                   	pop    %rbp
+  80215b:	c3                   	ret
+        if (inc < 0) return inc;
+  80215c:	48 98                	cltq
+  80215e:	eb ed                	jmp    80214d <readn+0x57>
+    int inc = 1, res = 0;
+  802160:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802165:	eb e3                	jmp    80214a <readn+0x54>
+
+0000000000802167 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802167:	55                   	push   %rbp
+  802168:	48 89 e5             	mov    %rsp,%rbp
+  80216b:	41 56                	push   %r14
+  80216d:	41 55                	push   %r13
+  80216f:	41 54                	push   %r12
+  802171:	53                   	push   %rbx
+  802172:	48 83 ec 10          	sub    $0x10,%rsp
+  802176:	89 fb                	mov    %edi,%ebx
+  802178:	49 89 f4             	mov    %rsi,%r12
+  80217b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80217e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802182:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  802189:	00 00 00 
+  80218c:	ff d0                	call   *%rax
+  80218e:	85 c0                	test   %eax,%eax
+  802190:	78 47                	js     8021d9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802192:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802196:	41 8b 3e             	mov    (%r14),%edi
+  802199:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80219d:	48 b8 a0 1d 80 00 00 	movabs $0x801da0,%rax
+  8021a4:	00 00 00 
+  8021a7:	ff d0                	call   *%rax
+  8021a9:	85 c0                	test   %eax,%eax
+  8021ab:	78 30                	js     8021dd <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021ad:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8021b2:	74 2d                	je     8021e1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021b8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8021bc:	48 85 c0             	test   %rax,%rax
+  8021bf:	74 56                	je     802217 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8021c1:	4c 89 ea             	mov    %r13,%rdx
+  8021c4:	4c 89 e6             	mov    %r12,%rsi
+  8021c7:	4c 89 f7             	mov    %r14,%rdi
+  8021ca:	ff d0                	call   *%rax
+}
+  8021cc:	48 83 c4 10          	add    $0x10,%rsp
+  8021d0:	5b                   	pop    %rbx
+  8021d1:	41 5c                	pop    %r12
+  8021d3:	41 5d                	pop    %r13
+  8021d5:	41 5e                	pop    %r14
+  8021d7:	5d                   	pop    %rbp
+  8021d8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021d9:	48 98                	cltq
+  8021db:	eb ef                	jmp    8021cc <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021dd:	48 98                	cltq
+  8021df:	eb eb                	jmp    8021cc <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021e1:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8021e8:	00 00 00 
+  8021eb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021f1:	89 da                	mov    %ebx,%edx
+  8021f3:	48 bf 45 56 80 00 00 	movabs $0x805645,%rdi
+  8021fa:	00 00 00 
+  8021fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802202:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  802209:	00 00 00 
+  80220c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80220e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802215:	eb b5                	jmp    8021cc <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802217:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80221e:	eb ac                	jmp    8021cc <write+0x65>
+
+0000000000802220 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802220:	55                   	push   %rbp
+  802221:	48 89 e5             	mov    %rsp,%rbp
+  802224:	53                   	push   %rbx
+  802225:	48 83 ec 18          	sub    $0x18,%rsp
+  802229:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80222b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80222f:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  802236:	00 00 00 
+  802239:	ff d0                	call   *%rax
+  80223b:	85 c0                	test   %eax,%eax
+  80223d:	78 0c                	js     80224b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80223f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802243:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802246:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80224b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80224f:	c9                   	leave
+  802250:	c3                   	ret
+
+0000000000802251 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802251:	55                   	push   %rbp
+  802252:	48 89 e5             	mov    %rsp,%rbp
+  802255:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802259:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80225d:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  802264:	00 00 00 
+  802267:	ff d0                	call   *%rax
+  802269:	85 c0                	test   %eax,%eax
+  80226b:	78 07                	js     802274 <tell+0x23>
+    return fdes->fd_offset;
+  80226d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802271:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802274:	c9                   	leave
+  802275:	c3                   	ret
+
+0000000000802276 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802276:	55                   	push   %rbp
+  802277:	48 89 e5             	mov    %rsp,%rbp
+  80227a:	41 55                	push   %r13
+  80227c:	41 54                	push   %r12
+  80227e:	53                   	push   %rbx
+  80227f:	48 83 ec 18          	sub    $0x18,%rsp
+  802283:	89 fb                	mov    %edi,%ebx
+  802285:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802288:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80228c:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  802293:	00 00 00 
+  802296:	ff d0                	call   *%rax
+  802298:	85 c0                	test   %eax,%eax
+  80229a:	78 38                	js     8022d4 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80229c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8022a0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8022a4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022a8:	48 b8 a0 1d 80 00 00 	movabs $0x801da0,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+  8022b4:	85 c0                	test   %eax,%eax
+  8022b6:	78 1c                	js     8022d4 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022b8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8022bd:	74 20                	je     8022df <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022bf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022c3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8022c7:	48 85 c0             	test   %rax,%rax
+  8022ca:	74 47                	je     802313 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8022cc:	44 89 e6             	mov    %r12d,%esi
+  8022cf:	4c 89 ef             	mov    %r13,%rdi
+  8022d2:	ff d0                	call   *%rax
+}
+  8022d4:	48 83 c4 18          	add    $0x18,%rsp
+  8022d8:	5b                   	pop    %rbx
+  8022d9:	41 5c                	pop    %r12
+  8022db:	41 5d                	pop    %r13
+  8022dd:	5d                   	pop    %rbp
+  8022de:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8022df:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8022e6:	00 00 00 
+  8022e9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022ef:	89 da                	mov    %ebx,%edx
+  8022f1:	48 bf 08 56 80 00 00 	movabs $0x805608,%rdi
+  8022f8:	00 00 00 
+  8022fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802300:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  802307:	00 00 00 
+  80230a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80230c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802311:	eb c1                	jmp    8022d4 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802313:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802318:	eb ba                	jmp    8022d4 <ftruncate+0x5e>
+
+000000000080231a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80231a:	55                   	push   %rbp
+  80231b:	48 89 e5             	mov    %rsp,%rbp
+  80231e:	41 54                	push   %r12
+  802320:	53                   	push   %rbx
+  802321:	48 83 ec 10          	sub    $0x10,%rsp
+  802325:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802328:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80232c:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  802333:	00 00 00 
+  802336:	ff d0                	call   *%rax
+  802338:	85 c0                	test   %eax,%eax
+  80233a:	78 4e                	js     80238a <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80233c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802340:	41 8b 3c 24          	mov    (%r12),%edi
+  802344:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802348:	48 b8 a0 1d 80 00 00 	movabs $0x801da0,%rax
+  80234f:	00 00 00 
+  802352:	ff d0                	call   *%rax
+  802354:	85 c0                	test   %eax,%eax
+  802356:	78 32                	js     80238a <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802358:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80235c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802361:	74 30                	je     802393 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802363:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802366:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80236d:	00 00 00 
+    stat->st_isdir = 0;
+  802370:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802377:	00 00 00 
+    stat->st_dev = dev;
+  80237a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802381:	48 89 de             	mov    %rbx,%rsi
+  802384:	4c 89 e7             	mov    %r12,%rdi
+  802387:	ff 50 28             	call   *0x28(%rax)
+}
+  80238a:	48 83 c4 10          	add    $0x10,%rsp
+  80238e:	5b                   	pop    %rbx
+  80238f:	41 5c                	pop    %r12
+  802391:	5d                   	pop    %rbp
+  802392:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802393:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802398:	eb f0                	jmp    80238a <fstat+0x70>
+
+000000000080239a <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80239a:	55                   	push   %rbp
+  80239b:	48 89 e5             	mov    %rsp,%rbp
+  80239e:	41 54                	push   %r12
+  8023a0:	53                   	push   %rbx
+  8023a1:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8023a8:	41 89 fc             	mov    %edi,%r12d
+  8023ab:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023ad:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023b1:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  8023b8:	00 00 00 
+  8023bb:	ff d0                	call   *%rax
+  8023bd:	85 c0                	test   %eax,%eax
+  8023bf:	78 31                	js     8023f2 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8023c1:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8023c8:	44 89 e7             	mov    %r12d,%edi
+  8023cb:	48 b8 1a 23 80 00 00 	movabs $0x80231a,%rax
+  8023d2:	00 00 00 
+  8023d5:	ff d0                	call   *%rax
+  8023d7:	85 c0                	test   %eax,%eax
+  8023d9:	78 17                	js     8023f2 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8023db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023df:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8023e2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8023e5:	39 d3                	cmp    %edx,%ebx
+  8023e7:	0f 4f da             	cmovg  %edx,%ebx
+  8023ea:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023f2:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8023f9:	5b                   	pop    %rbx
+  8023fa:	41 5c                	pop    %r12
+  8023fc:	5d                   	pop    %rbp
+  8023fd:	c3                   	ret
+
+00000000008023fe <seektoend>:
+{
+  8023fe:	55                   	push   %rbp
+  8023ff:	48 89 e5             	mov    %rsp,%rbp
+  802402:	53                   	push   %rbx
+  802403:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80240a:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80240c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802410:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  802417:	00 00 00 
+  80241a:	ff d0                	call   *%rax
+  80241c:	85 c0                	test   %eax,%eax
+  80241e:	78 28                	js     802448 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802420:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802427:	89 df                	mov    %ebx,%edi
+  802429:	48 b8 1a 23 80 00 00 	movabs $0x80231a,%rax
+  802430:	00 00 00 
+  802433:	ff d0                	call   *%rax
+  802435:	85 c0                	test   %eax,%eax
+  802437:	78 0f                	js     802448 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802439:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80243c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802440:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802443:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802448:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80244c:	c9                   	leave
+  80244d:	c3                   	ret
+
+000000000080244e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80244e:	55                   	push   %rbp
+  80244f:	48 89 e5             	mov    %rsp,%rbp
+  802452:	41 54                	push   %r12
+  802454:	53                   	push   %rbx
+  802455:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802458:	be 00 00 00 00       	mov    $0x0,%esi
+  80245d:	48 b8 41 30 80 00 00 	movabs $0x803041,%rax
+  802464:	00 00 00 
+  802467:	ff d0                	call   *%rax
+  802469:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80246b:	85 c0                	test   %eax,%eax
+  80246d:	78 25                	js     802494 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80246f:	4c 89 e6             	mov    %r12,%rsi
+  802472:	89 c7                	mov    %eax,%edi
+  802474:	48 b8 1a 23 80 00 00 	movabs $0x80231a,%rax
+  80247b:	00 00 00 
+  80247e:	ff d0                	call   *%rax
+  802480:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802483:	89 df                	mov    %ebx,%edi
+  802485:	48 b8 ba 1e 80 00 00 	movabs $0x801eba,%rax
+  80248c:	00 00 00 
+  80248f:	ff d0                	call   *%rax
+
+    return res;
+  802491:	44 89 e3             	mov    %r12d,%ebx
+}
+  802494:	89 d8                	mov    %ebx,%eax
+  802496:	5b                   	pop    %rbx
+  802497:	41 5c                	pop    %r12
+  802499:	5d                   	pop    %rbp
+  80249a:	c3                   	ret
+
+000000000080249b <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  80249b:	55                   	push   %rbp
+  80249c:	48 89 e5             	mov    %rsp,%rbp
+  80249f:	53                   	push   %rbx
+  8024a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024a4:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8024a7:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  8024ae:	00 00 00 
+  8024b1:	ff d0                	call   *%rax
+  8024b3:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8024b7:	0f 87 ea 00 00 00    	ja     8025a7 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8024bd:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024c4:	00 00 00 
+  8024c7:	80 38 00             	cmpb   $0x0,(%rax)
+  8024ca:	75 35                	jne    802501 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8024cc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8024d1:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8024d6:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8024db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024e0:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  8024e7:	00 00 00 
+  8024ea:	ff d0                	call   *%rax
+  8024ec:	85 c0                	test   %eax,%eax
+  8024ee:	0f 88 ba 00 00 00    	js     8025ae <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8024f4:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024fb:	00 00 00 
+  8024fe:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802501:	48 89 df             	mov    %rbx,%rdi
+  802504:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  80250b:	00 00 00 
+  80250e:	ff d0                	call   *%rax
+  802510:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802514:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80251b:	00 00 00 
+  80251e:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802522:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802525:	39 39                	cmp    %edi,(%rcx)
+  802527:	74 46                	je     80256f <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802529:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80252d:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802534:	00 
+  802535:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80253c:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802543:	00 
+  802544:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80254b:	00 
+  80254c:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802553:	00 
+  802554:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80255b:	00 
+  80255c:	89 39                	mov    %edi,(%rcx)
+  80255e:	48 01 c6             	add    %rax,%rsi
+  802561:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802566:	48 89 c8             	mov    %rcx,%rax
+  802569:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80256d:	c9                   	leave
+  80256e:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80256f:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802573:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80257a:	00 00 00 
+  80257d:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802580:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802584:	74 e0                	je     802566 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802586:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80258d:	00 
+  80258e:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802592:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802599:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80259b:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80259e:	48 01 c2             	add    %rax,%rdx
+  8025a1:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8025a5:	eb bf                	jmp    802566 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8025a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025ac:	eb b8                	jmp    802566 <fbuf_get+0xcb>
+            return NULL;
+  8025ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025b3:	eb b1                	jmp    802566 <fbuf_get+0xcb>
+
+00000000008025b5 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8025b5:	55                   	push   %rbp
+  8025b6:	48 89 e5             	mov    %rsp,%rbp
+  8025b9:	53                   	push   %rbx
+  8025ba:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8025be:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025c5:	00 00 00 
+  8025c8:	48 8b 18             	mov    (%rax),%rbx
+  8025cb:	48 85 db             	test   %rbx,%rbx
+  8025ce:	74 16                	je     8025e6 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8025d0:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025d7:	00 00 00 
+  8025da:	48 8b 18             	mov    (%rax),%rbx
+}
+  8025dd:	48 89 d8             	mov    %rbx,%rax
+  8025e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025e4:	c9                   	leave
+  8025e5:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8025e6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8025eb:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8025f0:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8025f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025fa:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  802601:	00 00 00 
+  802604:	ff d0                	call   *%rax
+  802606:	85 c0                	test   %eax,%eax
+  802608:	78 d3                	js     8025dd <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  80260a:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  80260f:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802616:	00 00 00 
+  802619:	eb b5                	jmp    8025d0 <fsipc_bulk+0x1b>
+
+000000000080261b <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80261b:	55                   	push   %rbp
+  80261c:	48 89 e5             	mov    %rsp,%rbp
+  80261f:	41 57                	push   %r15
+  802621:	41 56                	push   %r14
+  802623:	41 55                	push   %r13
+  802625:	41 54                	push   %r12
+  802627:	53                   	push   %rbx
+  802628:	48 83 ec 08          	sub    $0x8,%rsp
+  80262c:	41 89 fd             	mov    %edi,%r13d
+  80262f:	49 89 f6             	mov    %rsi,%r14
+  802632:	49 89 d7             	mov    %rdx,%r15
+  802635:	48 89 cb             	mov    %rcx,%rbx
+  802638:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80263b:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802642:	00 00 00 
+  802645:	83 38 00             	cmpl   $0x0,(%rax)
+  802648:	74 52                	je     80269c <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80264a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802650:	4c 89 f9             	mov    %r15,%rcx
+  802653:	4c 89 f2             	mov    %r14,%rdx
+  802656:	44 89 ee             	mov    %r13d,%esi
+  802659:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802660:	00 00 00 
+  802663:	8b 38                	mov    (%rax),%edi
+  802665:	48 b8 a3 41 80 00 00 	movabs $0x8041a3,%rax
+  80266c:	00 00 00 
+  80266f:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802671:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802676:	4c 89 e2             	mov    %r12,%rdx
+  802679:	48 89 de             	mov    %rbx,%rsi
+  80267c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802681:	48 b8 f3 3f 80 00 00 	movabs $0x803ff3,%rax
+  802688:	00 00 00 
+  80268b:	ff d0                	call   *%rax
+}
+  80268d:	48 83 c4 08          	add    $0x8,%rsp
+  802691:	5b                   	pop    %rbx
+  802692:	41 5c                	pop    %r12
+  802694:	41 5d                	pop    %r13
+  802696:	41 5e                	pop    %r14
+  802698:	41 5f                	pop    %r15
+  80269a:	5d                   	pop    %rbp
+  80269b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80269c:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026a1:	48 b8 46 42 80 00 00 	movabs $0x804246,%rax
+  8026a8:	00 00 00 
+  8026ab:	ff d0                	call   *%rax
+  8026ad:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8026b4:	00 00 
+  8026b6:	eb 92                	jmp    80264a <fsipc_region+0x2f>
+
+00000000008026b8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8026b8:	55                   	push   %rbp
+  8026b9:	48 89 e5             	mov    %rsp,%rbp
+  8026bc:	41 57                	push   %r15
+  8026be:	41 56                	push   %r14
+  8026c0:	41 55                	push   %r13
+  8026c2:	41 54                	push   %r12
+  8026c4:	53                   	push   %rbx
+  8026c5:	48 83 ec 28          	sub    $0x28,%rsp
+  8026c9:	49 89 ff             	mov    %rdi,%r15
+  8026cc:	49 89 f6             	mov    %rsi,%r14
+  8026cf:	48 89 d3             	mov    %rdx,%rbx
+  8026d2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026d6:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8026d9:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  8026e0:	00 00 00 
+  8026e3:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8026e5:	48 85 c0             	test   %rax,%rax
+  8026e8:	0f 84 cc 00 00 00    	je     8027ba <devfile_write_direct+0x102>
+  8026ee:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8026f1:	48 85 db             	test   %rbx,%rbx
+  8026f4:	0f 84 ba 00 00 00    	je     8027b4 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8026fa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802700:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802707:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  80270b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80270f:	4c 29 e3             	sub    %r12,%rbx
+  802712:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802717:	48 39 c3             	cmp    %rax,%rbx
+  80271a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80271e:	48 89 da             	mov    %rbx,%rdx
+  802721:	4c 89 f6             	mov    %r14,%rsi
+  802724:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802728:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  80272f:	00 00 00 
+  802732:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802734:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802738:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  80273c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80273f:	44 01 e0             	add    %r12d,%eax
+  802742:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802746:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80274a:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802751:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802758:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80275f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802765:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80276a:	4c 89 ee             	mov    %r13,%rsi
+  80276d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802772:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  802779:	00 00 00 
+  80277c:	ff d0                	call   *%rax
+        if (res < 0)
+  80277e:	85 c0                	test   %eax,%eax
+  802780:	78 29                	js     8027ab <devfile_write_direct+0xf3>
+        if (res == 0)
+  802782:	74 2b                	je     8027af <devfile_write_direct+0xf7>
+        i += res;
+  802784:	48 98                	cltq
+  802786:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802789:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  80278c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802790:	49 39 c4             	cmp    %rax,%r12
+  802793:	0f 82 72 ff ff ff    	jb     80270b <devfile_write_direct+0x53>
+    return i;
+  802799:	4c 89 e0             	mov    %r12,%rax
+}
+  80279c:	48 83 c4 28          	add    $0x28,%rsp
+  8027a0:	5b                   	pop    %rbx
+  8027a1:	41 5c                	pop    %r12
+  8027a3:	41 5d                	pop    %r13
+  8027a5:	41 5e                	pop    %r14
+  8027a7:	41 5f                	pop    %r15
+  8027a9:	5d                   	pop    %rbp
+  8027aa:	c3                   	ret
+            return res;
+  8027ab:	48 98                	cltq
+  8027ad:	eb ed                	jmp    80279c <devfile_write_direct+0xe4>
+            return i;
+  8027af:	4c 89 e0             	mov    %r12,%rax
+  8027b2:	eb e8                	jmp    80279c <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8027b4:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8027b8:	eb df                	jmp    802799 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8027ba:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8027c1:	eb d9                	jmp    80279c <devfile_write_direct+0xe4>
+
+00000000008027c3 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8027c3:	55                   	push   %rbp
+  8027c4:	48 89 e5             	mov    %rsp,%rbp
+  8027c7:	41 56                	push   %r14
+  8027c9:	41 55                	push   %r13
+  8027cb:	41 54                	push   %r12
+  8027cd:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8027ce:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8027d2:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8027d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027db:	4d 39 ee             	cmp    %r13,%r14
+  8027de:	0f 84 99 00 00 00    	je     80287d <fbuf_flush+0xba>
+  8027e4:	49 89 fc             	mov    %rdi,%r12
+  8027e7:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8027ea:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8027ed:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8027f1:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  8027f8:	00 00 00 
+  8027fb:	ff d0                	call   *%rax
+  8027fd:	48 89 c2             	mov    %rax,%rdx
+  802800:	48 c1 e2 04          	shl    $0x4,%rdx
+  802804:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802808:	48 c1 e0 0c          	shl    $0xc,%rax
+  80280c:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802811:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802814:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802818:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80281f:	00 
+  802820:	44 89 f1             	mov    %r14d,%ecx
+  802823:	4c 89 ea             	mov    %r13,%rdx
+  802826:	4c 89 e7             	mov    %r12,%rdi
+  802829:	48 b8 b8 26 80 00 00 	movabs $0x8026b8,%rax
+  802830:	00 00 00 
+  802833:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802835:	48 85 c0             	test   %rax,%rax
+  802838:	78 43                	js     80287d <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80283a:	4c 39 e8             	cmp    %r13,%rax
+  80283d:	72 47                	jb     802886 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80283f:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802844:	83 c0 01             	add    $0x1,%eax
+  802847:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80284c:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80284f:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802853:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802857:	72 0f                	jb     802868 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802859:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80285d:	48 39 c2             	cmp    %rax,%rdx
+  802860:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802864:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802868:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80286f:	00 
+  802870:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802877:	00 
+    return 0;
+  802878:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80287d:	5b                   	pop    %rbx
+  80287e:	41 5c                	pop    %r12
+  802880:	41 5d                	pop    %r13
+  802882:	41 5e                	pop    %r14
+  802884:	5d                   	pop    %rbp
+  802885:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802886:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80288b:	eb f0                	jmp    80287d <fbuf_flush+0xba>
+
+000000000080288d <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80288d:	55                   	push   %rbp
+  80288e:	48 89 e5             	mov    %rsp,%rbp
+  802891:	53                   	push   %rbx
+  802892:	48 83 ec 08          	sub    $0x8,%rsp
+  802896:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802899:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  8028a0:	00 00 00 
+  8028a3:	ff d0                	call   *%rax
+  8028a5:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  8028a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ad:	48 85 f6             	test   %rsi,%rsi
+  8028b0:	74 0f                	je     8028c1 <devfile_sync+0x34>
+  8028b2:	48 89 df             	mov    %rbx,%rdi
+  8028b5:	48 b8 c3 27 80 00 00 	movabs $0x8027c3,%rax
+  8028bc:	00 00 00 
+  8028bf:	ff d0                	call   *%rax
+}
+  8028c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028c5:	c9                   	leave
+  8028c6:	c3                   	ret
+
+00000000008028c7 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8028c7:	55                   	push   %rbp
+  8028c8:	48 89 e5             	mov    %rsp,%rbp
+  8028cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8028cf:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8028d2:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8028d9:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8028da:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8028de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028e3:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8028ea:	00 00 00 
+  8028ed:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  8028f4:	00 00 00 
+  8028f7:	ff d0                	call   *%rax
+}
+  8028f9:	c9                   	leave
+  8028fa:	c3                   	ret
+
+00000000008028fb <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8028fb:	55                   	push   %rbp
+  8028fc:	48 89 e5             	mov    %rsp,%rbp
+  8028ff:	41 54                	push   %r12
+  802901:	53                   	push   %rbx
+  802902:	48 89 fb             	mov    %rdi,%rbx
+  802905:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802908:	48 b8 8d 28 80 00 00 	movabs $0x80288d,%rax
+  80290f:	00 00 00 
+  802912:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802914:	85 c0                	test   %eax,%eax
+  802916:	78 63                	js     80297b <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802918:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80291b:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802922:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802924:	be 00 00 00 00       	mov    $0x0,%esi
+  802929:	bf 05 00 00 00       	mov    $0x5,%edi
+  80292e:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  802935:	00 00 00 
+  802938:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80293a:	85 c0                	test   %eax,%eax
+  80293c:	78 3d                	js     80297b <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80293e:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802945:	00 00 00 
+  802948:	48 89 de             	mov    %rbx,%rsi
+  80294b:	4c 89 e7             	mov    %r12,%rdi
+  80294e:	48 b8 51 0b 80 00 00 	movabs $0x800b51,%rax
+  802955:	00 00 00 
+  802958:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80295a:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802960:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802967:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802968:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80296e:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802975:	00 
+
+    return 0;
+  802976:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80297b:	5b                   	pop    %rbx
+  80297c:	41 5c                	pop    %r12
+  80297e:	5d                   	pop    %rbp
+  80297f:	c3                   	ret
+
+0000000000802980 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802980:	55                   	push   %rbp
+  802981:	48 89 e5             	mov    %rsp,%rbp
+  802984:	41 54                	push   %r12
+  802986:	53                   	push   %rbx
+  802987:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  80298a:	48 b8 8d 28 80 00 00 	movabs $0x80288d,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+  802996:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802999:	48 89 df             	mov    %rbx,%rdi
+  80299c:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  8029a3:	00 00 00 
+  8029a6:	ff d0                	call   *%rax
+  8029a8:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8029ac:	76 2e                	jbe    8029dc <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  8029ae:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8029b1:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8029b8:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8029ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8029bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029c4:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  8029cb:	00 00 00 
+  8029ce:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8029d0:	45 85 e4             	test   %r12d,%r12d
+  8029d3:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8029d7:	5b                   	pop    %rbx
+  8029d8:	41 5c                	pop    %r12
+  8029da:	5d                   	pop    %rbp
+  8029db:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8029dc:	48 89 df             	mov    %rbx,%rdi
+  8029df:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  8029e6:	00 00 00 
+  8029e9:	ff d0                	call   *%rax
+  8029eb:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8029ef:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8029f6:	00 00 00 
+  8029f9:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802a00:	48 89 df             	mov    %rbx,%rdi
+  802a03:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  802a0a:	00 00 00 
+  802a0d:	ff d0                	call   *%rax
+  802a0f:	48 89 c6             	mov    %rax,%rsi
+  802a12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a17:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a1c:	48 b8 90 14 80 00 00 	movabs $0x801490,%rax
+  802a23:	00 00 00 
+  802a26:	ff d0                	call   *%rax
+  802a28:	eb 84                	jmp    8029ae <devfile_flush+0x2e>
+
+0000000000802a2a <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802a2a:	55                   	push   %rbp
+  802a2b:	48 89 e5             	mov    %rsp,%rbp
+  802a2e:	41 55                	push   %r13
+  802a30:	41 54                	push   %r12
+  802a32:	53                   	push   %rbx
+  802a33:	48 83 ec 08          	sub    $0x8,%rsp
+  802a37:	48 89 fb             	mov    %rdi,%rbx
+  802a3a:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802a3d:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  802a44:	00 00 00 
+  802a47:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802a49:	48 85 c0             	test   %rax,%rax
+  802a4c:	74 51                	je     802a9f <devfile_trunc+0x75>
+  802a4e:	49 89 c4             	mov    %rax,%r12
+  802a51:	48 89 c6             	mov    %rax,%rsi
+  802a54:	48 89 df             	mov    %rbx,%rdi
+  802a57:	48 b8 c3 27 80 00 00 	movabs $0x8027c3,%rax
+  802a5e:	00 00 00 
+  802a61:	ff d0                	call   *%rax
+  802a63:	85 c0                	test   %eax,%eax
+  802a65:	78 2d                	js     802a94 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a67:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802a6e:	00 00 00 
+  802a71:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802a74:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802a76:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802a7a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a7f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a84:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  802a8b:	00 00 00 
+  802a8e:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802a90:	85 c0                	test   %eax,%eax
+  802a92:	79 3e                	jns    802ad2 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802a94:	48 83 c4 08          	add    $0x8,%rsp
+  802a98:	5b                   	pop    %rbx
+  802a99:	41 5c                	pop    %r12
+  802a9b:	41 5d                	pop    %r13
+  802a9d:	5d                   	pop    %rbp
+  802a9e:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a9f:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802aa6:	00 00 00 
+  802aa9:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802aac:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802aae:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ab2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ab7:	bf 02 00 00 00       	mov    $0x2,%edi
+  802abc:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  802ac3:	00 00 00 
+  802ac6:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ac8:	85 c0                	test   %eax,%eax
+  802aca:	78 c8                	js     802a94 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802acc:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ad0:	eb c2                	jmp    802a94 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ad2:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802ad5:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ad8:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802adb:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802ae0:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802ae7:	00 00 
+  802ae9:	eb a9                	jmp    802a94 <devfile_trunc+0x6a>
+
+0000000000802aeb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802aeb:	55                   	push   %rbp
+  802aec:	48 89 e5             	mov    %rsp,%rbp
+  802aef:	41 57                	push   %r15
+  802af1:	41 56                	push   %r14
+  802af3:	41 55                	push   %r13
+  802af5:	41 54                	push   %r12
+  802af7:	53                   	push   %rbx
+  802af8:	48 83 ec 28          	sub    $0x28,%rsp
+  802afc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802b00:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802b04:	49 89 d7             	mov    %rdx,%r15
+  802b07:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802b0b:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  802b12:	00 00 00 
+  802b15:	ff d0                	call   *%rax
+  802b17:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802b1a:	48 85 c0             	test   %rax,%rax
+  802b1d:	74 31                	je     802b50 <devfile_write+0x65>
+  802b1f:	4c 89 f8             	mov    %r15,%rax
+  802b22:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802b29:	77 25                	ja     802b50 <devfile_write+0x65>
+    size_t i = 0;
+  802b2b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802b31:	48 85 c0             	test   %rax,%rax
+  802b34:	0f 85 64 01 00 00    	jne    802c9e <devfile_write+0x1b3>
+    size_t i = 0;
+  802b3a:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802b3e:	4c 89 f8             	mov    %r15,%rax
+}
+  802b41:	48 83 c4 28          	add    $0x28,%rsp
+  802b45:	5b                   	pop    %rbx
+  802b46:	41 5c                	pop    %r12
+  802b48:	41 5d                	pop    %r13
+  802b4a:	41 5e                	pop    %r14
+  802b4c:	41 5f                	pop    %r15
+  802b4e:	5d                   	pop    %rbp
+  802b4f:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802b50:	48 85 db             	test   %rbx,%rbx
+  802b53:	74 5b                	je     802bb0 <devfile_write+0xc5>
+  802b55:	48 89 de             	mov    %rbx,%rsi
+  802b58:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b5c:	48 b8 c3 27 80 00 00 	movabs $0x8027c3,%rax
+  802b63:	00 00 00 
+  802b66:	ff d0                	call   *%rax
+  802b68:	85 c0                	test   %eax,%eax
+  802b6a:	78 40                	js     802bac <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802b6c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b70:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802b73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b77:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802b7b:	48 b8 b8 26 80 00 00 	movabs $0x8026b8,%rax
+  802b82:	00 00 00 
+  802b85:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802b87:	48 85 c0             	test   %rax,%rax
+  802b8a:	7e b5                	jle    802b41 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802b8c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802b90:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802b93:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802b96:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802b99:	8d 51 01             	lea    0x1(%rcx),%edx
+  802b9c:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802b9f:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802ba2:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802ba9:	00 
+  802baa:	eb 95                	jmp    802b41 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802bac:	48 98                	cltq
+  802bae:	eb 91                	jmp    802b41 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802bb0:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802bb4:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802bb7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bbb:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802bbf:	48 89 df             	mov    %rbx,%rdi
+  802bc2:	48 b8 b8 26 80 00 00 	movabs $0x8026b8,%rax
+  802bc9:	00 00 00 
+  802bcc:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802bce:	48 85 c0             	test   %rax,%rax
+  802bd1:	0f 8e 6a ff ff ff    	jle    802b41 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802bd7:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802bda:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802bde:	e9 5e ff ff ff       	jmp    802b41 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802be3:	48 98                	cltq
+  802be5:	4d 85 ff             	test   %r15,%r15
+  802be8:	49 0f 45 c7          	cmovne %r15,%rax
+  802bec:	e9 50 ff ff ff       	jmp    802b41 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802bf1:	48 89 de             	mov    %rbx,%rsi
+  802bf4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802bf8:	48 b8 c3 27 80 00 00 	movabs $0x8027c3,%rax
+  802bff:	00 00 00 
+  802c02:	ff d0                	call   *%rax
+  802c04:	85 c0                	test   %eax,%eax
+  802c06:	0f 88 2b 01 00 00    	js     802d37 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802c0c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c10:	4c 01 f8             	add    %r15,%rax
+  802c13:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c17:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c1b:	48 b9 c7 1c 80 00 00 	movabs $0x801cc7,%rcx
+  802c22:	00 00 00 
+  802c25:	ff d1                	call   *%rcx
+  802c27:	48 89 c2             	mov    %rax,%rdx
+  802c2a:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c2e:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c32:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c36:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802c3b:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802c3e:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802c45:	00 
+  802c46:	4c 89 ea             	mov    %r13,%rdx
+  802c49:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802c4d:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  802c54:	00 00 00 
+  802c57:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802c59:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c5d:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802c61:	48 39 c2             	cmp    %rax,%rdx
+  802c64:	0f 84 db 00 00 00    	je     802d45 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802c6a:	4c 39 e2             	cmp    %r12,%rdx
+  802c6d:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802c71:	4d 01 ec             	add    %r13,%r12
+  802c74:	49 39 c4             	cmp    %rax,%r12
+  802c77:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802c7b:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802c7f:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802c83:	45 01 ee             	add    %r13d,%r14d
+  802c86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c8a:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802c8e:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802c91:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c95:	49 39 c7             	cmp    %rax,%r15
+  802c98:	0f 83 a0 fe ff ff    	jae    802b3e <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802c9e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ca2:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802ca6:	8b 43 08             	mov    0x8(%rbx),%eax
+  802ca9:	44 39 f0             	cmp    %r14d,%eax
+  802cac:	7f 10                	jg     802cbe <devfile_write+0x1d3>
+  802cae:	48 98                	cltq
+  802cb0:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802cb6:	49 63 d6             	movslq %r14d,%rdx
+  802cb9:	48 39 d0             	cmp    %rdx,%rax
+  802cbc:	7d 2d                	jge    802ceb <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802cbe:	48 89 de             	mov    %rbx,%rsi
+  802cc1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802cc5:	48 b8 c3 27 80 00 00 	movabs $0x8027c3,%rax
+  802ccc:	00 00 00 
+  802ccf:	ff d0                	call   *%rax
+  802cd1:	85 c0                	test   %eax,%eax
+  802cd3:	0f 88 0a ff ff ff    	js     802be3 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802cd9:	44 89 f0             	mov    %r14d,%eax
+  802cdc:	66 b8 00 00          	mov    $0x0,%ax
+  802ce0:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802ce3:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802cea:	00 
+        size_t off = pos - fb->fb_base;
+  802ceb:	45 89 f4             	mov    %r14d,%r12d
+  802cee:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802cf2:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802cf5:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802cf9:	4d 29 fd             	sub    %r15,%r13
+  802cfc:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802d01:	4c 29 e0             	sub    %r12,%rax
+  802d04:	49 39 c5             	cmp    %rax,%r13
+  802d07:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802d0b:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802d0f:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802d13:	48 39 c2             	cmp    %rax,%rdx
+  802d16:	0f 84 f0 fe ff ff    	je     802c0c <devfile_write+0x121>
+  802d1c:	4c 39 e0             	cmp    %r12,%rax
+  802d1f:	0f 82 cc fe ff ff    	jb     802bf1 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802d25:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d29:	48 39 d0             	cmp    %rdx,%rax
+  802d2c:	0f 83 da fe ff ff    	jae    802c0c <devfile_write+0x121>
+  802d32:	e9 ba fe ff ff       	jmp    802bf1 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d37:	48 98                	cltq
+  802d39:	4d 85 ff             	test   %r15,%r15
+  802d3c:	49 0f 45 c7          	cmovne %r15,%rax
+  802d40:	e9 fc fd ff ff       	jmp    802b41 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802d45:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d49:	4c 89 e2             	mov    %r12,%rdx
+  802d4c:	e9 2a ff ff ff       	jmp    802c7b <devfile_write+0x190>
+
+0000000000802d51 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d51:	55                   	push   %rbp
+  802d52:	48 89 e5             	mov    %rsp,%rbp
+  802d55:	41 57                	push   %r15
+  802d57:	41 56                	push   %r14
+  802d59:	41 55                	push   %r13
+  802d5b:	41 54                	push   %r12
+  802d5d:	53                   	push   %rbx
+  802d5e:	48 83 ec 28          	sub    $0x28,%rsp
+  802d62:	49 89 ff             	mov    %rdi,%r15
+  802d65:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d69:	48 89 d3             	mov    %rdx,%rbx
+  802d6c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802d70:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  802d77:	00 00 00 
+  802d7a:	ff d0                	call   *%rax
+  802d7c:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802d7f:	48 85 c0             	test   %rax,%rax
+  802d82:	74 0d                	je     802d91 <devfile_read+0x40>
+  802d84:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802d8b:	0f 86 1a 01 00 00    	jbe    802eab <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d91:	4d 85 e4             	test   %r12,%r12
+  802d94:	74 1a                	je     802db0 <devfile_read+0x5f>
+  802d96:	4c 89 e6             	mov    %r12,%rsi
+  802d99:	4c 89 ff             	mov    %r15,%rdi
+  802d9c:	48 b8 c3 27 80 00 00 	movabs $0x8027c3,%rax
+  802da3:	00 00 00 
+  802da6:	ff d0                	call   *%rax
+  802da8:	85 c0                	test   %eax,%eax
+  802daa:	0f 88 e8 00 00 00    	js     802e98 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802db0:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802db4:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  802dbb:	00 00 00 
+  802dbe:	ff d0                	call   *%rax
+  802dc0:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802dc3:	48 85 c0             	test   %rax,%rax
+  802dc6:	0f 84 69 02 00 00    	je     803035 <devfile_read+0x2e4>
+    while (i < n) {
+  802dcc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802dd1:	0f 84 ce 00 00 00    	je     802ea5 <devfile_read+0x154>
+    size_t i = 0;
+  802dd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802ddc:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802de3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802de7:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802deb:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802def:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802df3:	48 29 da             	sub    %rbx,%rdx
+  802df6:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802dfb:	48 39 c2             	cmp    %rax,%rdx
+  802dfe:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802e02:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e06:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802e0a:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802e0d:	01 d8                	add    %ebx,%eax
+  802e0f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802e13:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802e17:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802e1e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e25:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802e2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e37:	4c 89 ee             	mov    %r13,%rsi
+  802e3a:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e3f:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  802e46:	00 00 00 
+  802e49:	ff d0                	call   *%rax
+        if (res < 0)
+  802e4b:	85 c0                	test   %eax,%eax
+  802e4d:	78 4d                	js     802e9c <devfile_read+0x14b>
+        if (res == 0)
+  802e4f:	74 4f                	je     802ea0 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802e51:	4c 63 e0             	movslq %eax,%r12
+  802e54:	4c 89 e2             	mov    %r12,%rdx
+  802e57:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802e5b:	4c 89 f7             	mov    %r14,%rdi
+  802e5e:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  802e65:	00 00 00 
+  802e68:	ff d0                	call   *%rax
+        i += res;
+  802e6a:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  802e6d:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  802e70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e74:	48 39 c3             	cmp    %rax,%rbx
+  802e77:	0f 82 72 ff ff ff    	jb     802def <devfile_read+0x9e>
+    return i;
+  802e7d:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802e80:	48 85 c0             	test   %rax,%rax
+  802e83:	7e 04                	jle    802e89 <devfile_read+0x138>
+  802e85:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  802e89:	48 83 c4 28          	add    $0x28,%rsp
+  802e8d:	5b                   	pop    %rbx
+  802e8e:	41 5c                	pop    %r12
+  802e90:	41 5d                	pop    %r13
+  802e92:	41 5e                	pop    %r14
+  802e94:	41 5f                	pop    %r15
+  802e96:	5d                   	pop    %rbp
+  802e97:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e98:	48 98                	cltq
+  802e9a:	eb ed                	jmp    802e89 <devfile_read+0x138>
+            return res;
+  802e9c:	48 98                	cltq
+  802e9e:	eb e9                	jmp    802e89 <devfile_read+0x138>
+            return i;
+  802ea0:	48 89 d8             	mov    %rbx,%rax
+  802ea3:	eb db                	jmp    802e80 <devfile_read+0x12f>
+    size_t i = 0;
+  802ea5:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802ea9:	eb d2                	jmp    802e7d <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802eab:	48 89 c6             	mov    %rax,%rsi
+  802eae:	4c 89 ff             	mov    %r15,%rdi
+  802eb1:	48 b8 c3 27 80 00 00 	movabs $0x8027c3,%rax
+  802eb8:	00 00 00 
+  802ebb:	ff d0                	call   *%rax
+  802ebd:	85 c0                	test   %eax,%eax
+  802ebf:	78 40                	js     802f01 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802ec1:	4c 89 ff             	mov    %r15,%rdi
+  802ec4:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  802ecb:	00 00 00 
+  802ece:	ff d0                	call   *%rax
+  802ed0:	48 89 c2             	mov    %rax,%rdx
+  802ed3:	48 c1 e2 04          	shl    $0x4,%rdx
+  802ed7:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802edb:	48 c1 e0 0c          	shl    $0xc,%rax
+  802edf:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802ee4:	48 01 d0             	add    %rdx,%rax
+  802ee7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  802eeb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802ef0:	0f 84 33 01 00 00    	je     803029 <devfile_read+0x2d8>
+    size_t i = 0;
+  802ef6:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802efc:	e9 f5 00 00 00       	jmp    802ff6 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802f01:	48 98                	cltq
+  802f03:	eb 84                	jmp    802e89 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802f05:	44 89 e8             	mov    %r13d,%eax
+  802f08:	66 b8 00 00          	mov    $0x0,%ax
+  802f0c:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  802f11:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f18:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  802f1a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f1e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f22:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  802f24:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802f29:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  802f2c:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  802f33:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  802f34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f3f:	ba 00 10 01 00       	mov    $0x11000,%edx
+  802f44:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f49:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  802f50:	00 00 00 
+  802f53:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  802f55:	85 c0                	test   %eax,%eax
+  802f57:	0f 88 be 00 00 00    	js     80301b <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  802f5d:	48 63 d0             	movslq %eax,%rdx
+  802f60:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  802f65:	41 03 44 24 08       	add    0x8(%r12),%eax
+  802f6a:	44 39 e8             	cmp    %r13d,%eax
+  802f6d:	0f 8e ba 00 00 00    	jle    80302d <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  802f73:	49 63 c5             	movslq %r13d,%rax
+  802f76:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802f7b:	48 29 c3             	sub    %rax,%rbx
+  802f7e:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  802f83:	48 01 c3             	add    %rax,%rbx
+  802f86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f8a:	4c 29 f0             	sub    %r14,%rax
+  802f8d:	48 39 c3             	cmp    %rax,%rbx
+  802f90:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802f94:	4c 89 ff             	mov    %r15,%rdi
+  802f97:	48 b9 c7 1c 80 00 00 	movabs $0x801cc7,%rcx
+  802f9e:	00 00 00 
+  802fa1:	ff d1                	call   *%rcx
+  802fa3:	48 89 c2             	mov    %rax,%rdx
+  802fa6:	48 c1 e2 04          	shl    $0x4,%rdx
+  802faa:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802fae:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fb2:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  802fb7:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  802fba:	44 89 ea             	mov    %r13d,%edx
+  802fbd:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  802fc2:	48 63 d2             	movslq %edx,%rdx
+  802fc5:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802fcc:	00 
+  802fcd:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802fd1:	4c 01 f7             	add    %r14,%rdi
+  802fd4:	48 89 da             	mov    %rbx,%rdx
+  802fd7:	48 b9 46 0f 80 00 00 	movabs $0x800f46,%rcx
+  802fde:	00 00 00 
+  802fe1:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  802fe3:	41 01 dd             	add    %ebx,%r13d
+  802fe6:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  802fea:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  802fed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ff1:	49 39 c6             	cmp    %rax,%r14
+  802ff4:	73 37                	jae    80302d <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  802ff6:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  802ffa:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802fff:	44 39 e8             	cmp    %r13d,%eax
+  803002:	0f 8f fd fe ff ff    	jg     802f05 <devfile_read+0x1b4>
+  803008:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80300d:	44 39 e8             	cmp    %r13d,%eax
+  803010:	0f 8f 5d ff ff ff    	jg     802f73 <devfile_read+0x222>
+  803016:	e9 ea fe ff ff       	jmp    802f05 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80301b:	48 98                	cltq
+  80301d:	4d 85 f6             	test   %r14,%r14
+  803020:	49 0f 45 c6          	cmovne %r14,%rax
+  803024:	e9 60 fe ff ff       	jmp    802e89 <devfile_read+0x138>
+    size_t i = 0;
+  803029:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80302d:	4c 89 f0             	mov    %r14,%rax
+  803030:	e9 54 fe ff ff       	jmp    802e89 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803035:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80303c:	e9 48 fe ff ff       	jmp    802e89 <devfile_read+0x138>
+
+0000000000803041 <open>:
+open(const char *path, int mode) {
+  803041:	55                   	push   %rbp
+  803042:	48 89 e5             	mov    %rsp,%rbp
+  803045:	41 55                	push   %r13
+  803047:	41 54                	push   %r12
+  803049:	53                   	push   %rbx
+  80304a:	48 83 ec 18          	sub    $0x18,%rsp
+  80304e:	49 89 fc             	mov    %rdi,%r12
+  803051:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803054:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  80305b:	00 00 00 
+  80305e:	ff d0                	call   *%rax
+  803060:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803066:	0f 87 8a 00 00 00    	ja     8030f6 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80306c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803070:	48 b8 f5 1c 80 00 00 	movabs $0x801cf5,%rax
+  803077:	00 00 00 
+  80307a:	ff d0                	call   *%rax
+  80307c:	89 c3                	mov    %eax,%ebx
+  80307e:	85 c0                	test   %eax,%eax
+  803080:	78 50                	js     8030d2 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803082:	4c 89 e6             	mov    %r12,%rsi
+  803085:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80308c:	00 00 00 
+  80308f:	48 89 df             	mov    %rbx,%rdi
+  803092:	48 b8 51 0b 80 00 00 	movabs $0x800b51,%rax
+  803099:	00 00 00 
+  80309c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80309e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8030a5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030a9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8030ae:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  8030b5:	00 00 00 
+  8030b8:	ff d0                	call   *%rax
+  8030ba:	89 c3                	mov    %eax,%ebx
+  8030bc:	85 c0                	test   %eax,%eax
+  8030be:	78 1f                	js     8030df <open+0x9e>
+    return fd2num(fd);
+  8030c0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030c4:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  8030cb:	00 00 00 
+  8030ce:	ff d0                	call   *%rax
+  8030d0:	89 c3                	mov    %eax,%ebx
+}
+  8030d2:	89 d8                	mov    %ebx,%eax
+  8030d4:	48 83 c4 18          	add    $0x18,%rsp
+  8030d8:	5b                   	pop    %rbx
+  8030d9:	41 5c                	pop    %r12
+  8030db:	41 5d                	pop    %r13
+  8030dd:	5d                   	pop    %rbp
+  8030de:	c3                   	ret
+        fd_close(fd, 0);
+  8030df:	be 00 00 00 00       	mov    $0x0,%esi
+  8030e4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030e8:	48 b8 10 1e 80 00 00 	movabs $0x801e10,%rax
+  8030ef:	00 00 00 
+  8030f2:	ff d0                	call   *%rax
+        return res;
+  8030f4:	eb dc                	jmp    8030d2 <open+0x91>
+        return -E_BAD_PATH;
+  8030f6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030fb:	eb d5                	jmp    8030d2 <open+0x91>
+
+00000000008030fd <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8030fd:	55                   	push   %rbp
+  8030fe:	48 89 e5             	mov    %rsp,%rbp
+  803101:	41 57                	push   %r15
+  803103:	41 56                	push   %r14
+  803105:	41 55                	push   %r13
+  803107:	41 54                	push   %r12
+  803109:	53                   	push   %rbx
+  80310a:	48 83 ec 18          	sub    $0x18,%rsp
+  80310e:	41 89 f6             	mov    %esi,%r14d
+  803111:	49 89 d7             	mov    %rdx,%r15
+  803114:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803117:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80311b:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  803122:	00 00 00 
+  803125:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803127:	85 c0                	test   %eax,%eax
+  803129:	0f 88 db 00 00 00    	js     80320a <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80312f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803133:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80313a:	00 00 00 
+  80313d:	8b 00                	mov    (%rax),%eax
+  80313f:	39 07                	cmp    %eax,(%rdi)
+  803141:	0f 85 db 00 00 00    	jne    803222 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803147:	45 85 f6             	test   %r14d,%r14d
+  80314a:	0f 88 db 00 00 00    	js     80322b <fmap+0x12e>
+  803150:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803157:	0f 85 d7 00 00 00    	jne    803234 <fmap+0x137>
+  80315d:	4c 89 fb             	mov    %r15,%rbx
+  803160:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803166:	0f 85 d1 00 00 00    	jne    80323d <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80316c:	48 b8 8d 28 80 00 00 	movabs $0x80288d,%rax
+  803173:	00 00 00 
+  803176:	ff d0                	call   *%rax
+  803178:	85 c0                	test   %eax,%eax
+  80317a:	0f 88 8e 00 00 00    	js     80320e <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803180:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803187:	00 00 00 
+    while (i < n) {
+  80318a:	4d 85 ed             	test   %r13,%r13
+  80318d:	0f 84 8a 00 00 00    	je     80321d <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803193:	4c 89 ea             	mov    %r13,%rdx
+  803196:	48 29 da             	sub    %rbx,%rdx
+  803199:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8031a0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8031aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031ae:	8b 40 0c             	mov    0xc(%rax),%eax
+  8031b1:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8031b5:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8031b9:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8031be:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8031c3:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8031c7:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8031cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031d0:	4c 89 e6             	mov    %r12,%rsi
+  8031d3:	bf 09 00 00 00       	mov    $0x9,%edi
+  8031d8:	48 b8 1b 26 80 00 00 	movabs $0x80261b,%rax
+  8031df:	00 00 00 
+  8031e2:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8031e4:	85 c0                	test   %eax,%eax
+  8031e6:	78 2a                	js     803212 <fmap+0x115>
+        i += res;
+  8031e8:	48 98                	cltq
+  8031ea:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8031ed:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8031f1:	72 05                	jb     8031f8 <fmap+0xfb>
+    while (i < n) {
+  8031f3:	4c 39 eb             	cmp    %r13,%rbx
+  8031f6:	72 9b                	jb     803193 <fmap+0x96>
+    }
+    return i;
+  8031f8:	48 89 d8             	mov    %rbx,%rax
+}
+  8031fb:	48 83 c4 18          	add    $0x18,%rsp
+  8031ff:	5b                   	pop    %rbx
+  803200:	41 5c                	pop    %r12
+  803202:	41 5d                	pop    %r13
+  803204:	41 5e                	pop    %r14
+  803206:	41 5f                	pop    %r15
+  803208:	5d                   	pop    %rbp
+  803209:	c3                   	ret
+    if (res < 0) return res;
+  80320a:	48 98                	cltq
+  80320c:	eb ed                	jmp    8031fb <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80320e:	48 98                	cltq
+  803210:	eb e9                	jmp    8031fb <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803212:	48 98                	cltq
+  803214:	48 85 db             	test   %rbx,%rbx
+  803217:	48 0f 45 c3          	cmovne %rbx,%rax
+  80321b:	eb de                	jmp    8031fb <fmap+0xfe>
+    size_t i = 0;
+  80321d:	4c 89 eb             	mov    %r13,%rbx
+  803220:	eb d6                	jmp    8031f8 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803222:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803229:	eb d0                	jmp    8031fb <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80322b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803232:	eb c7                	jmp    8031fb <fmap+0xfe>
+  803234:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80323b:	eb be                	jmp    8031fb <fmap+0xfe>
+  80323d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803244:	eb b5                	jmp    8031fb <fmap+0xfe>
+
+0000000000803246 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803246:	55                   	push   %rbp
+  803247:	48 89 e5             	mov    %rsp,%rbp
+  80324a:	41 56                	push   %r14
+  80324c:	41 55                	push   %r13
+  80324e:	41 54                	push   %r12
+  803250:	53                   	push   %rbx
+  803251:	48 83 ec 10          	sub    $0x10,%rsp
+  803255:	89 fb                	mov    %edi,%ebx
+  803257:	41 89 f4             	mov    %esi,%r12d
+  80325a:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80325d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803261:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  803268:	00 00 00 
+  80326b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80326d:	85 c0                	test   %eax,%eax
+  80326f:	78 63                	js     8032d4 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803271:	45 85 e4             	test   %r12d,%r12d
+  803274:	0f 88 80 00 00 00    	js     8032fa <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80327a:	45 89 e6             	mov    %r12d,%r14d
+  80327d:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803284:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803288:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  80328f:	00 00 00 
+  803292:	ff d0                	call   *%rax
+  803294:	48 89 c2             	mov    %rax,%rdx
+  803297:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80329c:	44 89 f6             	mov    %r14d,%esi
+  80329f:	89 df                	mov    %ebx,%edi
+  8032a1:	48 b8 fd 30 80 00 00 	movabs $0x8030fd,%rax
+  8032a8:	00 00 00 
+  8032ab:	ff d0                	call   *%rax
+  8032ad:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8032b0:	45 29 f4             	sub    %r14d,%r12d
+  8032b3:	4d 63 f4             	movslq %r12d,%r14
+  8032b6:	49 39 c6             	cmp    %rax,%r14
+  8032b9:	7c 1d                	jl     8032d8 <read_map+0x92>
+  8032bb:	48 85 c0             	test   %rax,%rax
+  8032be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c3:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8032c7:	48 83 c4 10          	add    $0x10,%rsp
+  8032cb:	5b                   	pop    %rbx
+  8032cc:	41 5c                	pop    %r12
+  8032ce:	41 5d                	pop    %r13
+  8032d0:	41 5e                	pop    %r14
+  8032d2:	5d                   	pop    %rbp
+  8032d3:	c3                   	ret
+    if (res < 0) return res;
+  8032d4:	48 98                	cltq
+  8032d6:	eb ef                	jmp    8032c7 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8032d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032dc:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  8032e3:	00 00 00 
+  8032e6:	ff d0                	call   *%rax
+  8032e8:	4d 63 e4             	movslq %r12d,%r12
+  8032eb:	4c 01 e0             	add    %r12,%rax
+  8032ee:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8032f2:	48 89 d8             	mov    %rbx,%rax
+  8032f5:	4c 29 f0             	sub    %r14,%rax
+  8032f8:	eb cd                	jmp    8032c7 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8032fa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803301:	eb c4                	jmp    8032c7 <read_map+0x81>
+
+0000000000803303 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803303:	55                   	push   %rbp
+  803304:	48 89 e5             	mov    %rsp,%rbp
+  803307:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80330b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80330f:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  803316:	00 00 00 
+  803319:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80331b:	85 c0                	test   %eax,%eax
+  80331d:	78 4a                	js     803369 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80331f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803323:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80332a:	00 00 00 
+  80332d:	8b 00                	mov    (%rax),%eax
+  80332f:	39 07                	cmp    %eax,(%rdi)
+  803331:	75 38                	jne    80336b <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803333:	48 b8 8d 28 80 00 00 	movabs $0x80288d,%rax
+  80333a:	00 00 00 
+  80333d:	ff d0                	call   *%rax
+  80333f:	85 c0                	test   %eax,%eax
+  803341:	78 26                	js     803369 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803343:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803347:	8b 40 0c             	mov    0xc(%rax),%eax
+  80334a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803351:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803353:	be 00 00 00 00       	mov    $0x0,%esi
+  803358:	bf 06 00 00 00       	mov    $0x6,%edi
+  80335d:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  803364:	00 00 00 
+  803367:	ff d0                	call   *%rax
+}
+  803369:	c9                   	leave
+  80336a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80336b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803370:	eb f7                	jmp    803369 <fsync+0x66>
+
+0000000000803372 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803372:	55                   	push   %rbp
+  803373:	48 89 e5             	mov    %rsp,%rbp
+  803376:	41 57                	push   %r15
+  803378:	41 56                	push   %r14
+  80337a:	41 55                	push   %r13
+  80337c:	41 54                	push   %r12
+  80337e:	53                   	push   %rbx
+  80337f:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803383:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80338a:	00 00 00 
+  80338d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803392:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803398:	49 bd 55 1d 80 00 00 	movabs $0x801d55,%r13
+  80339f:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8033a2:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8033a9:	00 00 00 
+  8033ac:	eb 0c                	jmp    8033ba <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8033ae:	83 c3 01             	add    $0x1,%ebx
+  8033b1:	49 83 c4 28          	add    $0x28,%r12
+  8033b5:	83 fb 20             	cmp    $0x20,%ebx
+  8033b8:	74 33                	je     8033ed <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033ba:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8033bf:	74 ed                	je     8033ae <flushall+0x3c>
+  8033c1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033c5:	89 df                	mov    %ebx,%edi
+  8033c7:	41 ff d5             	call   *%r13
+  8033ca:	85 c0                	test   %eax,%eax
+  8033cc:	78 e0                	js     8033ae <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8033ce:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033d2:	41 8b 06             	mov    (%r14),%eax
+  8033d5:	39 07                	cmp    %eax,(%rdi)
+  8033d7:	75 d5                	jne    8033ae <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8033d9:	48 b8 8d 28 80 00 00 	movabs $0x80288d,%rax
+  8033e0:	00 00 00 
+  8033e3:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8033e5:	85 c0                	test   %eax,%eax
+  8033e7:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8033eb:	eb c1                	jmp    8033ae <flushall+0x3c>
+    }
+    return res;
+}
+  8033ed:	44 89 f8             	mov    %r15d,%eax
+  8033f0:	48 83 c4 18          	add    $0x18,%rsp
+  8033f4:	5b                   	pop    %rbx
+  8033f5:	41 5c                	pop    %r12
+  8033f7:	41 5d                	pop    %r13
+  8033f9:	41 5e                	pop    %r14
+  8033fb:	41 5f                	pop    %r15
+  8033fd:	5d                   	pop    %rbp
+  8033fe:	c3                   	ret
+
+00000000008033ff <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8033ff:	55                   	push   %rbp
+  803400:	48 89 e5             	mov    %rsp,%rbp
+  803403:	53                   	push   %rbx
+  803404:	48 83 ec 08          	sub    $0x8,%rsp
+  803408:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80340b:	40 0f b6 c6          	movzbl %sil,%eax
+  80340f:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803416:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803418:	be 00 00 00 00       	mov    $0x0,%esi
+  80341d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803422:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  803429:	00 00 00 
+  80342c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80342e:	85 c0                	test   %eax,%eax
+  803430:	78 23                	js     803455 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803432:	ba 58 06 00 00       	mov    $0x658,%edx
+  803437:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80343e:	00 00 00 
+  803441:	48 89 df             	mov    %rbx,%rdi
+  803444:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  80344b:	00 00 00 
+  80344e:	ff d0                	call   *%rax
+    return 0;
+  803450:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803455:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803459:	c9                   	leave
+  80345a:	c3                   	ret
+
+000000000080345b <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80345b:	55                   	push   %rbp
+  80345c:	48 89 e5             	mov    %rsp,%rbp
+  80345f:	53                   	push   %rbx
+  803460:	48 83 ec 08          	sub    $0x8,%rsp
+  803464:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803467:	48 b8 13 0b 80 00 00 	movabs $0x800b13,%rax
+  80346e:	00 00 00 
+  803471:	ff d0                	call   *%rax
+  803473:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803479:	77 35                	ja     8034b0 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80347b:	48 89 de             	mov    %rbx,%rsi
+  80347e:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803485:	00 00 00 
+  803488:	48 b8 51 0b 80 00 00 	movabs $0x800b51,%rax
+  80348f:	00 00 00 
+  803492:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803494:	be 00 00 00 00       	mov    $0x0,%esi
+  803499:	bf 07 00 00 00       	mov    $0x7,%edi
+  80349e:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  8034a5:	00 00 00 
+  8034a8:	ff d0                	call   *%rax
+}
+  8034aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034ae:	c9                   	leave
+  8034af:	c3                   	ret
+        return -E_BAD_PATH;
+  8034b0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034b5:	eb f3                	jmp    8034aa <remove+0x4f>
+
+00000000008034b7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8034b7:	55                   	push   %rbp
+  8034b8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8034bb:	48 b8 72 33 80 00 00 	movabs $0x803372,%rax
+  8034c2:	00 00 00 
+  8034c5:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8034c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8034cc:	bf 08 00 00 00       	mov    $0x8,%edi
+  8034d1:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  8034d8:	00 00 00 
+  8034db:	ff d0                	call   *%rax
+}
+  8034dd:	5d                   	pop    %rbp
+  8034de:	c3                   	ret
+
+00000000008034df <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8034df:	55                   	push   %rbp
+  8034e0:	48 89 e5             	mov    %rsp,%rbp
+  8034e3:	41 54                	push   %r12
+  8034e5:	53                   	push   %rbx
+  8034e6:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8034e9:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  8034f0:	00 00 00 
+  8034f3:	ff d0                	call   *%rax
+  8034f5:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8034f8:	48 be a0 56 80 00 00 	movabs $0x8056a0,%rsi
+  8034ff:	00 00 00 
+  803502:	48 89 df             	mov    %rbx,%rdi
+  803505:	48 b8 51 0b 80 00 00 	movabs $0x800b51,%rax
+  80350c:	00 00 00 
+  80350f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803511:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803516:	41 2b 04 24          	sub    (%r12),%eax
+  80351a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803520:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803527:	00 00 00 
+    stat->st_dev = &devpipe;
+  80352a:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803531:	00 00 00 
+  803534:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80353b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803540:	5b                   	pop    %rbx
+  803541:	41 5c                	pop    %r12
+  803543:	5d                   	pop    %rbp
+  803544:	c3                   	ret
+
+0000000000803545 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803545:	55                   	push   %rbp
+  803546:	48 89 e5             	mov    %rsp,%rbp
+  803549:	41 54                	push   %r12
+  80354b:	53                   	push   %rbx
+  80354c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80354f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803554:	48 89 fe             	mov    %rdi,%rsi
+  803557:	bf 00 00 00 00       	mov    $0x0,%edi
+  80355c:	49 bc 90 14 80 00 00 	movabs $0x801490,%r12
+  803563:	00 00 00 
+  803566:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803569:	48 89 df             	mov    %rbx,%rdi
+  80356c:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  803573:	00 00 00 
+  803576:	ff d0                	call   *%rax
+  803578:	48 89 c6             	mov    %rax,%rsi
+  80357b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803580:	bf 00 00 00 00       	mov    $0x0,%edi
+  803585:	41 ff d4             	call   *%r12
+}
+  803588:	5b                   	pop    %rbx
+  803589:	41 5c                	pop    %r12
+  80358b:	5d                   	pop    %rbp
+  80358c:	c3                   	ret
+
+000000000080358d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80358d:	55                   	push   %rbp
+  80358e:	48 89 e5             	mov    %rsp,%rbp
+  803591:	41 57                	push   %r15
+  803593:	41 56                	push   %r14
+  803595:	41 55                	push   %r13
+  803597:	41 54                	push   %r12
+  803599:	53                   	push   %rbx
+  80359a:	48 83 ec 18          	sub    $0x18,%rsp
+  80359e:	49 89 fc             	mov    %rdi,%r12
+  8035a1:	49 89 f5             	mov    %rsi,%r13
+  8035a4:	49 89 d7             	mov    %rdx,%r15
+  8035a7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8035ab:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  8035b2:	00 00 00 
+  8035b5:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8035b7:	4d 85 ff             	test   %r15,%r15
+  8035ba:	0f 84 af 00 00 00    	je     80366f <devpipe_write+0xe2>
+  8035c0:	48 89 c3             	mov    %rax,%rbx
+  8035c3:	4c 89 f8             	mov    %r15,%rax
+  8035c6:	4d 89 ef             	mov    %r13,%r15
+  8035c9:	4c 01 e8             	add    %r13,%rax
+  8035cc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035d0:	49 bd 85 12 80 00 00 	movabs $0x801285,%r13
+  8035d7:	00 00 00 
+            sys_yield();
+  8035da:	49 be 22 12 80 00 00 	movabs $0x801222,%r14
+  8035e1:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8035e4:	8b 73 04             	mov    0x4(%rbx),%esi
+  8035e7:	48 63 ce             	movslq %esi,%rcx
+  8035ea:	48 63 03             	movslq (%rbx),%rax
+  8035ed:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8035f3:	48 39 c1             	cmp    %rax,%rcx
+  8035f6:	72 2e                	jb     803626 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035f8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8035fd:	48 89 da             	mov    %rbx,%rdx
+  803600:	be 00 10 00 00       	mov    $0x1000,%esi
+  803605:	4c 89 e7             	mov    %r12,%rdi
+  803608:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80360b:	85 c0                	test   %eax,%eax
+  80360d:	74 66                	je     803675 <devpipe_write+0xe8>
+            sys_yield();
+  80360f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803612:	8b 73 04             	mov    0x4(%rbx),%esi
+  803615:	48 63 ce             	movslq %esi,%rcx
+  803618:	48 63 03             	movslq (%rbx),%rax
+  80361b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803621:	48 39 c1             	cmp    %rax,%rcx
+  803624:	73 d2                	jae    8035f8 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803626:	41 0f b6 3f          	movzbl (%r15),%edi
+  80362a:	48 89 ca             	mov    %rcx,%rdx
+  80362d:	48 c1 ea 03          	shr    $0x3,%rdx
+  803631:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803638:	08 10 20 
+  80363b:	48 f7 e2             	mul    %rdx
+  80363e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803642:	48 89 d0             	mov    %rdx,%rax
+  803645:	48 c1 e0 09          	shl    $0x9,%rax
+  803649:	48 29 d0             	sub    %rdx,%rax
+  80364c:	48 c1 e0 03          	shl    $0x3,%rax
+  803650:	48 29 c1             	sub    %rax,%rcx
+  803653:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803658:	83 c6 01             	add    $0x1,%esi
+  80365b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80365e:	49 83 c7 01          	add    $0x1,%r15
+  803662:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803666:	49 39 c7             	cmp    %rax,%r15
+  803669:	0f 85 75 ff ff ff    	jne    8035e4 <devpipe_write+0x57>
+    return n;
+  80366f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803673:	eb 05                	jmp    80367a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803675:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80367a:	48 83 c4 18          	add    $0x18,%rsp
+  80367e:	5b                   	pop    %rbx
+  80367f:	41 5c                	pop    %r12
+  803681:	41 5d                	pop    %r13
+  803683:	41 5e                	pop    %r14
+  803685:	41 5f                	pop    %r15
+  803687:	5d                   	pop    %rbp
+  803688:	c3                   	ret
+
+0000000000803689 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803689:	55                   	push   %rbp
+  80368a:	48 89 e5             	mov    %rsp,%rbp
+  80368d:	41 57                	push   %r15
+  80368f:	41 56                	push   %r14
+  803691:	41 55                	push   %r13
+  803693:	41 54                	push   %r12
+  803695:	53                   	push   %rbx
+  803696:	48 83 ec 18          	sub    $0x18,%rsp
+  80369a:	49 89 fc             	mov    %rdi,%r12
+  80369d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8036a1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036a5:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+  8036b1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036b4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036ba:	49 bd 85 12 80 00 00 	movabs $0x801285,%r13
+  8036c1:	00 00 00 
+            sys_yield();
+  8036c4:	49 be 22 12 80 00 00 	movabs $0x801222,%r14
+  8036cb:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8036ce:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8036d3:	74 7d                	je     803752 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036d5:	8b 03                	mov    (%rbx),%eax
+  8036d7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036da:	75 26                	jne    803702 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8036dc:	4d 85 ff             	test   %r15,%r15
+  8036df:	75 77                	jne    803758 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036e1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036e6:	48 89 da             	mov    %rbx,%rdx
+  8036e9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036ee:	4c 89 e7             	mov    %r12,%rdi
+  8036f1:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8036f4:	85 c0                	test   %eax,%eax
+  8036f6:	74 72                	je     80376a <devpipe_read+0xe1>
+            sys_yield();
+  8036f8:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036fb:	8b 03                	mov    (%rbx),%eax
+  8036fd:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803700:	74 df                	je     8036e1 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803702:	48 63 c8             	movslq %eax,%rcx
+  803705:	48 89 ca             	mov    %rcx,%rdx
+  803708:	48 c1 ea 03          	shr    $0x3,%rdx
+  80370c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803713:	08 10 20 
+  803716:	48 89 d0             	mov    %rdx,%rax
+  803719:	48 f7 e6             	mul    %rsi
+  80371c:	48 c1 ea 06          	shr    $0x6,%rdx
+  803720:	48 89 d0             	mov    %rdx,%rax
+  803723:	48 c1 e0 09          	shl    $0x9,%rax
+  803727:	48 29 d0             	sub    %rdx,%rax
+  80372a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803731:	00 
+  803732:	48 89 c8             	mov    %rcx,%rax
+  803735:	48 29 d0             	sub    %rdx,%rax
+  803738:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80373d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803741:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803745:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803748:	49 83 c7 01          	add    $0x1,%r15
+  80374c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803750:	75 83                	jne    8036d5 <devpipe_read+0x4c>
+    return n;
+  803752:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803756:	eb 03                	jmp    80375b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803758:	4c 89 f8             	mov    %r15,%rax
+}
+  80375b:	48 83 c4 18          	add    $0x18,%rsp
+  80375f:	5b                   	pop    %rbx
+  803760:	41 5c                	pop    %r12
+  803762:	41 5d                	pop    %r13
+  803764:	41 5e                	pop    %r14
+  803766:	41 5f                	pop    %r15
+  803768:	5d                   	pop    %rbp
+  803769:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80376a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376f:	eb ea                	jmp    80375b <devpipe_read+0xd2>
+
+0000000000803771 <pipe>:
+pipe(int pfd[2]) {
+  803771:	55                   	push   %rbp
+  803772:	48 89 e5             	mov    %rsp,%rbp
+  803775:	41 55                	push   %r13
+  803777:	41 54                	push   %r12
+  803779:	53                   	push   %rbx
+  80377a:	48 83 ec 18          	sub    $0x18,%rsp
+  80377e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803781:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803785:	48 b8 f5 1c 80 00 00 	movabs $0x801cf5,%rax
+  80378c:	00 00 00 
+  80378f:	ff d0                	call   *%rax
+  803791:	89 c3                	mov    %eax,%ebx
+  803793:	85 c0                	test   %eax,%eax
+  803795:	0f 88 a0 01 00 00    	js     80393b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80379b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037a5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8037a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ae:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  8037b5:	00 00 00 
+  8037b8:	ff d0                	call   *%rax
+  8037ba:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8037bc:	85 c0                	test   %eax,%eax
+  8037be:	0f 88 77 01 00 00    	js     80393b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037c4:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8037c8:	48 b8 f5 1c 80 00 00 	movabs $0x801cf5,%rax
+  8037cf:	00 00 00 
+  8037d2:	ff d0                	call   *%rax
+  8037d4:	89 c3                	mov    %eax,%ebx
+  8037d6:	85 c0                	test   %eax,%eax
+  8037d8:	0f 88 43 01 00 00    	js     803921 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8037de:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037e8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8037ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f1:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  8037f8:	00 00 00 
+  8037fb:	ff d0                	call   *%rax
+  8037fd:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037ff:	85 c0                	test   %eax,%eax
+  803801:	0f 88 1a 01 00 00    	js     803921 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803807:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80380b:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  803812:	00 00 00 
+  803815:	ff d0                	call   *%rax
+  803817:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80381a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80381f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803824:	48 89 c6             	mov    %rax,%rsi
+  803827:	bf 00 00 00 00       	mov    $0x0,%edi
+  80382c:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  803833:	00 00 00 
+  803836:	ff d0                	call   *%rax
+  803838:	89 c3                	mov    %eax,%ebx
+  80383a:	85 c0                	test   %eax,%eax
+  80383c:	0f 88 c5 00 00 00    	js     803907 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803842:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803846:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  80384d:	00 00 00 
+  803850:	ff d0                	call   *%rax
+  803852:	48 89 c1             	mov    %rax,%rcx
+  803855:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80385b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803861:	ba 00 00 00 00       	mov    $0x0,%edx
+  803866:	4c 89 ee             	mov    %r13,%rsi
+  803869:	bf 00 00 00 00       	mov    $0x0,%edi
+  80386e:	48 b8 18 13 80 00 00 	movabs $0x801318,%rax
+  803875:	00 00 00 
+  803878:	ff d0                	call   *%rax
+  80387a:	89 c3                	mov    %eax,%ebx
+  80387c:	85 c0                	test   %eax,%eax
+  80387e:	78 6e                	js     8038ee <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803880:	be 00 10 00 00       	mov    $0x1000,%esi
+  803885:	4c 89 ef             	mov    %r13,%rdi
+  803888:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  80388f:	00 00 00 
+  803892:	ff d0                	call   *%rax
+  803894:	83 f8 02             	cmp    $0x2,%eax
+  803897:	0f 85 ab 00 00 00    	jne    803948 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80389d:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8038a4:	00 00 
+  8038a6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038aa:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8038ac:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038b0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8038b7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8038bb:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8038bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038c1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8038c8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8038cc:	48 bb c7 1c 80 00 00 	movabs $0x801cc7,%rbx
+  8038d3:	00 00 00 
+  8038d6:	ff d3                	call   *%rbx
+  8038d8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8038dc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8038e0:	ff d3                	call   *%rbx
+  8038e2:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8038e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038ec:	eb 4d                	jmp    80393b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8038ee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038f3:	4c 89 ee             	mov    %r13,%rsi
+  8038f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038fb:	48 b8 90 14 80 00 00 	movabs $0x801490,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803907:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80390c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803910:	bf 00 00 00 00       	mov    $0x0,%edi
+  803915:	48 b8 90 14 80 00 00 	movabs $0x801490,%rax
+  80391c:	00 00 00 
+  80391f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803921:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803926:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80392a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80392f:	48 b8 90 14 80 00 00 	movabs $0x801490,%rax
+  803936:	00 00 00 
+  803939:	ff d0                	call   *%rax
+}
+  80393b:	89 d8                	mov    %ebx,%eax
+  80393d:	48 83 c4 18          	add    $0x18,%rsp
+  803941:	5b                   	pop    %rbx
+  803942:	41 5c                	pop    %r12
+  803944:	41 5d                	pop    %r13
+  803946:	5d                   	pop    %rbp
+  803947:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803948:	48 b9 d0 56 80 00 00 	movabs $0x8056d0,%rcx
+  80394f:	00 00 00 
+  803952:	48 ba a7 56 80 00 00 	movabs $0x8056a7,%rdx
+  803959:	00 00 00 
+  80395c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803961:	48 bf bc 56 80 00 00 	movabs $0x8056bc,%rdi
+  803968:	00 00 00 
+  80396b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803970:	49 b8 50 3f 80 00 00 	movabs $0x803f50,%r8
+  803977:	00 00 00 
+  80397a:	41 ff d0             	call   *%r8
+
+000000000080397d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80397d:	55                   	push   %rbp
+  80397e:	48 89 e5             	mov    %rsp,%rbp
+  803981:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803985:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803989:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  803990:	00 00 00 
+  803993:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803995:	85 c0                	test   %eax,%eax
+  803997:	78 35                	js     8039ce <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803999:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80399d:	48 b8 d9 1c 80 00 00 	movabs $0x801cd9,%rax
+  8039a4:	00 00 00 
+  8039a7:	ff d0                	call   *%rax
+  8039a9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039ac:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039b1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039b6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039ba:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  8039c1:	00 00 00 
+  8039c4:	ff d0                	call   *%rax
+  8039c6:	85 c0                	test   %eax,%eax
+  8039c8:	0f 94 c0             	sete   %al
+  8039cb:	0f b6 c0             	movzbl %al,%eax
+}
+  8039ce:	c9                   	leave
+  8039cf:	c3                   	ret
+
+00000000008039d0 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8039d0:	48 89 f8             	mov    %rdi,%rax
+  8039d3:	48 c1 e8 27          	shr    $0x27,%rax
+  8039d7:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8039de:	7f 00 00 
+  8039e1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039e5:	f6 c2 01             	test   $0x1,%dl
+  8039e8:	74 6d                	je     803a57 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8039ea:	48 89 f8             	mov    %rdi,%rax
+  8039ed:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039f1:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039f8:	7f 00 00 
+  8039fb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039ff:	f6 c2 01             	test   $0x1,%dl
+  803a02:	74 62                	je     803a66 <get_uvpt_entry+0x96>
+  803a04:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a0b:	7f 00 00 
+  803a0e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a12:	f6 c2 80             	test   $0x80,%dl
+  803a15:	75 4f                	jne    803a66 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a17:	48 89 f8             	mov    %rdi,%rax
+  803a1a:	48 c1 e8 15          	shr    $0x15,%rax
+  803a1e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a25:	7f 00 00 
+  803a28:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a2c:	f6 c2 01             	test   $0x1,%dl
+  803a2f:	74 44                	je     803a75 <get_uvpt_entry+0xa5>
+  803a31:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a38:	7f 00 00 
+  803a3b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a3f:	f6 c2 80             	test   $0x80,%dl
+  803a42:	75 31                	jne    803a75 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803a44:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803a48:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a4f:	7f 00 00 
+  803a52:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803a56:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a57:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803a5e:	7f 00 00 
+  803a61:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a65:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a66:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a6d:	7f 00 00 
+  803a70:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a74:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a75:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a7c:	7f 00 00 
+  803a7f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a83:	c3                   	ret
+
+0000000000803a84 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803a84:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a87:	48 89 f9             	mov    %rdi,%rcx
+  803a8a:	48 c1 e9 27          	shr    $0x27,%rcx
+  803a8e:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803a95:	7f 00 00 
+  803a98:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803a9c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803aa3:	f6 c1 01             	test   $0x1,%cl
+  803aa6:	0f 84 b2 00 00 00    	je     803b5e <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803aac:	48 89 f9             	mov    %rdi,%rcx
+  803aaf:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803ab3:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803aba:	7f 00 00 
+  803abd:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ac1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ac8:	40 f6 c6 01          	test   $0x1,%sil
+  803acc:	0f 84 8c 00 00 00    	je     803b5e <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803ad2:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ad9:	7f 00 00 
+  803adc:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ae0:	a8 80                	test   $0x80,%al
+  803ae2:	75 7b                	jne    803b5f <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ae4:	48 89 f9             	mov    %rdi,%rcx
+  803ae7:	48 c1 e9 15          	shr    $0x15,%rcx
+  803aeb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803af2:	7f 00 00 
+  803af5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803af9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803b00:	40 f6 c6 01          	test   $0x1,%sil
+  803b04:	74 58                	je     803b5e <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803b06:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b0d:	7f 00 00 
+  803b10:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b14:	a8 80                	test   $0x80,%al
+  803b16:	75 6c                	jne    803b84 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b18:	48 89 f9             	mov    %rdi,%rcx
+  803b1b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803b1f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b26:	7f 00 00 
+  803b29:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b2d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b34:	40 f6 c6 01          	test   $0x1,%sil
+  803b38:	74 24                	je     803b5e <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803b3a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b41:	7f 00 00 
+  803b44:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b48:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b4f:	ff ff 7f 
+  803b52:	48 21 c8             	and    %rcx,%rax
+  803b55:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803b5b:	48 09 d0             	or     %rdx,%rax
+}
+  803b5e:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803b5f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b66:	7f 00 00 
+  803b69:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b6d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b74:	ff ff 7f 
+  803b77:	48 21 c8             	and    %rcx,%rax
+  803b7a:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803b80:	48 01 d0             	add    %rdx,%rax
+  803b83:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803b84:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b8b:	7f 00 00 
+  803b8e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b92:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b99:	ff ff 7f 
+  803b9c:	48 21 c8             	and    %rcx,%rax
+  803b9f:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803ba5:	48 01 d0             	add    %rdx,%rax
+  803ba8:	c3                   	ret
+
+0000000000803ba9 <get_prot>:
+
+int
+get_prot(void *va) {
+  803ba9:	55                   	push   %rbp
+  803baa:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803bad:	48 b8 d0 39 80 00 00 	movabs $0x8039d0,%rax
+  803bb4:	00 00 00 
+  803bb7:	ff d0                	call   *%rax
+  803bb9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803bbc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803bc1:	89 c1                	mov    %eax,%ecx
+  803bc3:	83 c9 04             	or     $0x4,%ecx
+  803bc6:	f6 c2 01             	test   $0x1,%dl
+  803bc9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803bcc:	89 c1                	mov    %eax,%ecx
+  803bce:	83 c9 02             	or     $0x2,%ecx
+  803bd1:	f6 c2 02             	test   $0x2,%dl
+  803bd4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803bd7:	89 c1                	mov    %eax,%ecx
+  803bd9:	83 c9 01             	or     $0x1,%ecx
+  803bdc:	48 85 d2             	test   %rdx,%rdx
+  803bdf:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803be2:	89 c1                	mov    %eax,%ecx
+  803be4:	83 c9 40             	or     $0x40,%ecx
+  803be7:	f6 c6 04             	test   $0x4,%dh
+  803bea:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803bed:	5d                   	pop    %rbp
+  803bee:	c3                   	ret
+
+0000000000803bef <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803bef:	55                   	push   %rbp
+  803bf0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803bf3:	48 b8 d0 39 80 00 00 	movabs $0x8039d0,%rax
+  803bfa:	00 00 00 
+  803bfd:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803bff:	48 c1 e8 06          	shr    $0x6,%rax
+  803c03:	83 e0 01             	and    $0x1,%eax
+}
+  803c06:	5d                   	pop    %rbp
+  803c07:	c3                   	ret
+
+0000000000803c08 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803c08:	55                   	push   %rbp
+  803c09:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803c0c:	48 b8 d0 39 80 00 00 	movabs $0x8039d0,%rax
+  803c13:	00 00 00 
+  803c16:	ff d0                	call   *%rax
+  803c18:	83 e0 01             	and    $0x1,%eax
+}
+  803c1b:	5d                   	pop    %rbp
+  803c1c:	c3                   	ret
+
+0000000000803c1d <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803c1d:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803c24:	7f 00 00 
+  803c27:	a8 01                	test   $0x1,%al
+  803c29:	75 06                	jne    803c31 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c30:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803c31:	55                   	push   %rbp
+  803c32:	48 89 e5             	mov    %rsp,%rbp
+  803c35:	41 57                	push   %r15
+  803c37:	41 56                	push   %r14
+  803c39:	41 55                	push   %r13
+  803c3b:	41 54                	push   %r12
+  803c3d:	53                   	push   %rbx
+  803c3e:	48 83 ec 18          	sub    $0x18,%rsp
+  803c42:	49 89 fe             	mov    %rdi,%r14
+  803c45:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803c48:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803c4f:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c50:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803c57:	7f 00 00 
+  803c5a:	e9 81 00 00 00       	jmp    803ce0 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803c5f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803c66:	49 39 dd             	cmp    %rbx,%r13
+  803c69:	74 2b                	je     803c96 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c6b:	48 89 d8             	mov    %rbx,%rax
+  803c6e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c72:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803c76:	f6 c2 01             	test   $0x1,%dl
+  803c79:	74 e4                	je     803c5f <foreach_shared_region+0x42>
+  803c7b:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803c7f:	f6 c4 04             	test   $0x4,%ah
+  803c82:	74 db                	je     803c5f <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803c84:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803c8b:	4c 89 fa             	mov    %r15,%rdx
+  803c8e:	48 89 df             	mov    %rbx,%rdi
+  803c91:	41 ff d6             	call   *%r14
+  803c94:	eb c9                	jmp    803c5f <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803c96:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803c9d:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803ca1:	74 22                	je     803cc5 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803ca3:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803caa:	48 89 d8             	mov    %rbx,%rax
+  803cad:	48 c1 e8 15          	shr    $0x15,%rax
+  803cb1:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803cb8:	7f 00 00 
+  803cbb:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803cbf:	a8 01                	test   $0x1,%al
+  803cc1:	74 d3                	je     803c96 <foreach_shared_region+0x79>
+  803cc3:	eb a6                	jmp    803c6b <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803cc5:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803ccc:	40 
+  803ccd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803cd1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cd8:	00 00 00 
+  803cdb:	48 39 c1             	cmp    %rax,%rcx
+  803cde:	74 31                	je     803d11 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803ce0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ce4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ce8:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803cef:	7f 00 00 
+  803cf2:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803cf6:	a8 01                	test   $0x1,%al
+  803cf8:	74 cb                	je     803cc5 <foreach_shared_region+0xa8>
+  803cfa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cfe:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803d05:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803d0b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d0f:	eb 92                	jmp    803ca3 <foreach_shared_region+0x86>
+}
+  803d11:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d16:	48 83 c4 18          	add    $0x18,%rsp
+  803d1a:	5b                   	pop    %rbx
+  803d1b:	41 5c                	pop    %r12
+  803d1d:	41 5d                	pop    %r13
+  803d1f:	41 5e                	pop    %r14
+  803d21:	41 5f                	pop    %r15
+  803d23:	5d                   	pop    %rbp
+  803d24:	c3                   	ret
+
+0000000000803d25 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803d25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d2a:	c3                   	ret
+
+0000000000803d2b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803d2b:	55                   	push   %rbp
+  803d2c:	48 89 e5             	mov    %rsp,%rbp
+  803d2f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803d32:	48 be f4 56 80 00 00 	movabs $0x8056f4,%rsi
+  803d39:	00 00 00 
+  803d3c:	48 b8 51 0b 80 00 00 	movabs $0x800b51,%rax
+  803d43:	00 00 00 
+  803d46:	ff d0                	call   *%rax
+    return 0;
+}
+  803d48:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d4d:	5d                   	pop    %rbp
+  803d4e:	c3                   	ret
+
+0000000000803d4f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d4f:	55                   	push   %rbp
+  803d50:	48 89 e5             	mov    %rsp,%rbp
+  803d53:	41 57                	push   %r15
+  803d55:	41 56                	push   %r14
+  803d57:	41 55                	push   %r13
+  803d59:	41 54                	push   %r12
+  803d5b:	53                   	push   %rbx
+  803d5c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803d63:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803d6a:	48 85 d2             	test   %rdx,%rdx
+  803d6d:	74 7a                	je     803de9 <devcons_write+0x9a>
+  803d6f:	49 89 d6             	mov    %rdx,%r14
+  803d72:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803d78:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803d7d:	49 bf df 0e 80 00 00 	movabs $0x800edf,%r15
+  803d84:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803d87:	4c 89 f3             	mov    %r14,%rbx
+  803d8a:	48 29 f3             	sub    %rsi,%rbx
+  803d8d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803d92:	48 39 c3             	cmp    %rax,%rbx
+  803d95:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803d99:	4c 63 eb             	movslq %ebx,%r13
+  803d9c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803da3:	48 01 c6             	add    %rax,%rsi
+  803da6:	4c 89 ea             	mov    %r13,%rdx
+  803da9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803db0:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803db3:	4c 89 ee             	mov    %r13,%rsi
+  803db6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803dbd:	48 b8 28 11 80 00 00 	movabs $0x801128,%rax
+  803dc4:	00 00 00 
+  803dc7:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803dc9:	41 01 dc             	add    %ebx,%r12d
+  803dcc:	49 63 f4             	movslq %r12d,%rsi
+  803dcf:	4c 39 f6             	cmp    %r14,%rsi
+  803dd2:	72 b3                	jb     803d87 <devcons_write+0x38>
+    return res;
+  803dd4:	49 63 c4             	movslq %r12d,%rax
+}
+  803dd7:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803dde:	5b                   	pop    %rbx
+  803ddf:	41 5c                	pop    %r12
+  803de1:	41 5d                	pop    %r13
+  803de3:	41 5e                	pop    %r14
+  803de5:	41 5f                	pop    %r15
+  803de7:	5d                   	pop    %rbp
+  803de8:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803de9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803def:	eb e3                	jmp    803dd4 <devcons_write+0x85>
+
+0000000000803df1 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803df1:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803df4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803df9:	48 85 c0             	test   %rax,%rax
+  803dfc:	74 55                	je     803e53 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803dfe:	55                   	push   %rbp
+  803dff:	48 89 e5             	mov    %rsp,%rbp
+  803e02:	41 55                	push   %r13
+  803e04:	41 54                	push   %r12
+  803e06:	53                   	push   %rbx
+  803e07:	48 83 ec 08          	sub    $0x8,%rsp
+  803e0b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803e0e:	48 bb 55 11 80 00 00 	movabs $0x801155,%rbx
+  803e15:	00 00 00 
+  803e18:	49 bc 22 12 80 00 00 	movabs $0x801222,%r12
+  803e1f:	00 00 00 
+  803e22:	eb 03                	jmp    803e27 <devcons_read+0x36>
+  803e24:	41 ff d4             	call   *%r12
+  803e27:	ff d3                	call   *%rbx
+  803e29:	85 c0                	test   %eax,%eax
+  803e2b:	74 f7                	je     803e24 <devcons_read+0x33>
+    if (c < 0) return c;
+  803e2d:	48 63 d0             	movslq %eax,%rdx
+  803e30:	78 13                	js     803e45 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803e32:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e37:	83 f8 04             	cmp    $0x4,%eax
+  803e3a:	74 09                	je     803e45 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803e3c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803e40:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803e45:	48 89 d0             	mov    %rdx,%rax
+  803e48:	48 83 c4 08          	add    $0x8,%rsp
+  803e4c:	5b                   	pop    %rbx
+  803e4d:	41 5c                	pop    %r12
+  803e4f:	41 5d                	pop    %r13
+  803e51:	5d                   	pop    %rbp
+  803e52:	c3                   	ret
+  803e53:	48 89 d0             	mov    %rdx,%rax
+  803e56:	c3                   	ret
+
+0000000000803e57 <cputchar>:
+cputchar(int ch) {
+  803e57:	55                   	push   %rbp
+  803e58:	48 89 e5             	mov    %rsp,%rbp
+  803e5b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803e5f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803e63:	be 01 00 00 00       	mov    $0x1,%esi
+  803e68:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803e6c:	48 b8 28 11 80 00 00 	movabs $0x801128,%rax
+  803e73:	00 00 00 
+  803e76:	ff d0                	call   *%rax
+}
+  803e78:	c9                   	leave
+  803e79:	c3                   	ret
+
+0000000000803e7a <getchar>:
+getchar(void) {
+  803e7a:	55                   	push   %rbp
+  803e7b:	48 89 e5             	mov    %rsp,%rbp
+  803e7e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803e82:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e87:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803e8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e90:	48 b8 38 20 80 00 00 	movabs $0x802038,%rax
+  803e97:	00 00 00 
+  803e9a:	ff d0                	call   *%rax
+  803e9c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803e9e:	85 c0                	test   %eax,%eax
+  803ea0:	78 06                	js     803ea8 <getchar+0x2e>
+  803ea2:	74 08                	je     803eac <getchar+0x32>
+  803ea4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803ea8:	89 d0                	mov    %edx,%eax
+  803eaa:	c9                   	leave
+  803eab:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803eac:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803eb1:	eb f5                	jmp    803ea8 <getchar+0x2e>
+
+0000000000803eb3 <iscons>:
+iscons(int fdnum) {
+  803eb3:	55                   	push   %rbp
+  803eb4:	48 89 e5             	mov    %rsp,%rbp
+  803eb7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ebb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803ebf:	48 b8 55 1d 80 00 00 	movabs $0x801d55,%rax
+  803ec6:	00 00 00 
+  803ec9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ecb:	85 c0                	test   %eax,%eax
+  803ecd:	78 18                	js     803ee7 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803ecf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ed3:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803eda:	00 00 00 
+  803edd:	8b 00                	mov    (%rax),%eax
+  803edf:	39 02                	cmp    %eax,(%rdx)
+  803ee1:	0f 94 c0             	sete   %al
+  803ee4:	0f b6 c0             	movzbl %al,%eax
+}
+  803ee7:	c9                   	leave
+  803ee8:	c3                   	ret
+
+0000000000803ee9 <opencons>:
+opencons(void) {
+  803ee9:	55                   	push   %rbp
+  803eea:	48 89 e5             	mov    %rsp,%rbp
+  803eed:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803ef1:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803ef5:	48 b8 f5 1c 80 00 00 	movabs $0x801cf5,%rax
+  803efc:	00 00 00 
+  803eff:	ff d0                	call   *%rax
+  803f01:	85 c0                	test   %eax,%eax
+  803f03:	78 49                	js     803f4e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803f05:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f0a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f0f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803f13:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f18:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  803f1f:	00 00 00 
+  803f22:	ff d0                	call   *%rax
+  803f24:	85 c0                	test   %eax,%eax
+  803f26:	78 26                	js     803f4e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803f28:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f2c:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803f33:	00 00 
+  803f35:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803f37:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f3b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803f42:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  803f49:	00 00 00 
+  803f4c:	ff d0                	call   *%rax
+}
+  803f4e:	c9                   	leave
+  803f4f:	c3                   	ret
+
+0000000000803f50 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803f50:	55                   	push   %rbp
+  803f51:	48 89 e5             	mov    %rsp,%rbp
+  803f54:	41 56                	push   %r14
+  803f56:	41 55                	push   %r13
+  803f58:	41 54                	push   %r12
+  803f5a:	53                   	push   %rbx
+  803f5b:	48 83 ec 50          	sub    $0x50,%rsp
+  803f5f:	49 89 fc             	mov    %rdi,%r12
+  803f62:	41 89 f5             	mov    %esi,%r13d
+  803f65:	48 89 d3             	mov    %rdx,%rbx
+  803f68:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f6c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803f70:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803f74:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803f7b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f7f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803f83:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803f87:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803f8b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803f92:	00 00 00 
+  803f95:	4c 8b 30             	mov    (%rax),%r14
+  803f98:	48 b8 f1 11 80 00 00 	movabs $0x8011f1,%rax
+  803f9f:	00 00 00 
+  803fa2:	ff d0                	call   *%rax
+  803fa4:	89 c6                	mov    %eax,%esi
+  803fa6:	45 89 e8             	mov    %r13d,%r8d
+  803fa9:	4c 89 e1             	mov    %r12,%rcx
+  803fac:	4c 89 f2             	mov    %r14,%rdx
+  803faf:	48 bf 00 57 80 00 00 	movabs $0x805700,%rdi
+  803fb6:	00 00 00 
+  803fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fbe:	49 bc d9 01 80 00 00 	movabs $0x8001d9,%r12
+  803fc5:	00 00 00 
+  803fc8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803fcb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803fcf:	48 89 df             	mov    %rbx,%rdi
+  803fd2:	48 b8 75 01 80 00 00 	movabs $0x800175,%rax
+  803fd9:	00 00 00 
+  803fdc:	ff d0                	call   *%rax
+    cprintf("\n");
+  803fde:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  803fe5:	00 00 00 
+  803fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fed:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803ff0:	cc                   	int3
+  803ff1:	eb fd                	jmp    803ff0 <_panic+0xa0>
+
+0000000000803ff3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803ff3:	55                   	push   %rbp
+  803ff4:	48 89 e5             	mov    %rsp,%rbp
+  803ff7:	41 55                	push   %r13
+  803ff9:	41 54                	push   %r12
+  803ffb:	53                   	push   %rbx
+  803ffc:	48 83 ec 08          	sub    $0x8,%rsp
+  804000:	49 89 fc             	mov    %rdi,%r12
+  804003:	48 89 f7             	mov    %rsi,%rdi
+  804006:	48 89 d3             	mov    %rdx,%rbx
+  804009:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80400c:	48 85 f6             	test   %rsi,%rsi
+  80400f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804016:	00 00 00 
+  804019:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80401d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804022:	48 85 d2             	test   %rdx,%rdx
+  804025:	74 03                	je     80402a <ipc_recv+0x37>
+  804027:	48 8b 32             	mov    (%rdx),%rsi
+  80402a:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  804031:	00 00 00 
+  804034:	ff d0                	call   *%rax
+    if (errno) {
+  804036:	85 c0                	test   %eax,%eax
+  804038:	74 1c                	je     804056 <ipc_recv+0x63>
+        if (from_env_store)
+  80403a:	4d 85 e4             	test   %r12,%r12
+  80403d:	74 08                	je     804047 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80403f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804046:	00 
+
+        if (perm_store)
+  804047:	4d 85 ed             	test   %r13,%r13
+  80404a:	74 74                	je     8040c0 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80404c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804053:	00 
+  804054:	eb 6a                	jmp    8040c0 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804056:	4d 85 e4             	test   %r12,%r12
+  804059:	74 14                	je     80406f <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80405b:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804062:	00 00 00 
+  804065:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80406b:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80406f:	48 85 db             	test   %rbx,%rbx
+  804072:	74 23                	je     804097 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804074:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80407b:	00 00 00 
+  80407e:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804084:	ba 00 00 00 00       	mov    $0x0,%edx
+  804089:	85 c9                	test   %ecx,%ecx
+  80408b:	74 07                	je     804094 <ipc_recv+0xa1>
+  80408d:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804094:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804097:	4d 85 ed             	test   %r13,%r13
+  80409a:	74 14                	je     8040b0 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80409c:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8040a3:	00 00 00 
+  8040a6:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8040ac:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8040b0:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8040b7:	00 00 00 
+  8040ba:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040c0:	48 83 c4 08          	add    $0x8,%rsp
+  8040c4:	5b                   	pop    %rbx
+  8040c5:	41 5c                	pop    %r12
+  8040c7:	41 5d                	pop    %r13
+  8040c9:	5d                   	pop    %rbp
+  8040ca:	c3                   	ret
+
+00000000008040cb <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040cb:	55                   	push   %rbp
+  8040cc:	48 89 e5             	mov    %rsp,%rbp
+  8040cf:	41 55                	push   %r13
+  8040d1:	41 54                	push   %r12
+  8040d3:	53                   	push   %rbx
+  8040d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8040d8:	49 89 fc             	mov    %rdi,%r12
+  8040db:	48 89 f7             	mov    %rsi,%rdi
+  8040de:	48 89 d3             	mov    %rdx,%rbx
+  8040e1:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040e4:	48 85 f6             	test   %rsi,%rsi
+  8040e7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040ee:	00 00 00 
+  8040f1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040f5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040fa:	48 85 d2             	test   %rdx,%rdx
+  8040fd:	74 03                	je     804102 <ipc_try_recv+0x37>
+  8040ff:	48 8b 32             	mov    (%rdx),%rsi
+  804102:	48 b8 c7 16 80 00 00 	movabs $0x8016c7,%rax
+  804109:	00 00 00 
+  80410c:	ff d0                	call   *%rax
+    if (errno) {
+  80410e:	85 c0                	test   %eax,%eax
+  804110:	75 75                	jne    804187 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804112:	4d 85 e4             	test   %r12,%r12
+  804115:	74 14                	je     80412b <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804117:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80411e:	00 00 00 
+  804121:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804127:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80412b:	48 85 db             	test   %rbx,%rbx
+  80412e:	74 23                	je     804153 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804130:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804137:	00 00 00 
+  80413a:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804140:	ba 00 00 00 00       	mov    $0x0,%edx
+  804145:	85 c9                	test   %ecx,%ecx
+  804147:	74 07                	je     804150 <ipc_try_recv+0x85>
+  804149:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804150:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804153:	4d 85 ed             	test   %r13,%r13
+  804156:	74 14                	je     80416c <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804158:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80415f:	00 00 00 
+  804162:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804168:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80416c:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804173:	00 00 00 
+  804176:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80417c:	48 83 c4 08          	add    $0x8,%rsp
+  804180:	5b                   	pop    %rbx
+  804181:	41 5c                	pop    %r12
+  804183:	41 5d                	pop    %r13
+  804185:	5d                   	pop    %rbp
+  804186:	c3                   	ret
+        if (from_env_store)
+  804187:	4d 85 e4             	test   %r12,%r12
+  80418a:	74 08                	je     804194 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80418c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804193:	00 
+        if (perm_store)
+  804194:	4d 85 ed             	test   %r13,%r13
+  804197:	74 e3                	je     80417c <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804199:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8041a0:	00 
+  8041a1:	eb d9                	jmp    80417c <ipc_try_recv+0xb1>
+
+00000000008041a3 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8041a3:	55                   	push   %rbp
+  8041a4:	48 89 e5             	mov    %rsp,%rbp
+  8041a7:	41 57                	push   %r15
+  8041a9:	41 56                	push   %r14
+  8041ab:	41 55                	push   %r13
+  8041ad:	41 54                	push   %r12
+  8041af:	53                   	push   %rbx
+  8041b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8041b4:	41 89 fd             	mov    %edi,%r13d
+  8041b7:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8041ba:	48 89 d3             	mov    %rdx,%rbx
+  8041bd:	49 89 cc             	mov    %rcx,%r12
+  8041c0:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041c4:	48 85 d2             	test   %rdx,%rdx
+  8041c7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041ce:	00 00 00 
+  8041d1:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041d5:	49 be 32 16 80 00 00 	movabs $0x801632,%r14
+  8041dc:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041df:	49 bf 22 12 80 00 00 	movabs $0x801222,%r15
+  8041e6:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041e9:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041ec:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041f0:	4c 89 e1             	mov    %r12,%rcx
+  8041f3:	48 89 da             	mov    %rbx,%rdx
+  8041f6:	44 89 ef             	mov    %r13d,%edi
+  8041f9:	41 ff d6             	call   *%r14
+  8041fc:	85 c0                	test   %eax,%eax
+  8041fe:	74 37                	je     804237 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804200:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804203:	75 05                	jne    80420a <ipc_send+0x67>
+        sys_yield();
+  804205:	41 ff d7             	call   *%r15
+  804208:	eb df                	jmp    8041e9 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80420a:	89 c1                	mov    %eax,%ecx
+  80420c:	48 ba 23 57 80 00 00 	movabs $0x805723,%rdx
+  804213:	00 00 00 
+  804216:	be 65 00 00 00       	mov    $0x65,%esi
+  80421b:	48 bf 3e 57 80 00 00 	movabs $0x80573e,%rdi
+  804222:	00 00 00 
+  804225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80422a:	49 b8 50 3f 80 00 00 	movabs $0x803f50,%r8
+  804231:	00 00 00 
+  804234:	41 ff d0             	call   *%r8
+    }
+}
+  804237:	48 83 c4 18          	add    $0x18,%rsp
+  80423b:	5b                   	pop    %rbx
+  80423c:	41 5c                	pop    %r12
+  80423e:	41 5d                	pop    %r13
+  804240:	41 5e                	pop    %r14
+  804242:	41 5f                	pop    %r15
+  804244:	5d                   	pop    %rbp
+  804245:	c3                   	ret
+
+0000000000804246 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804246:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80424b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804252:	00 00 00 
+  804255:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80425c:	48 01 ca             	add    %rcx,%rdx
+  80425f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804265:	39 fa                	cmp    %edi,%edx
+  804267:	74 12                	je     80427b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804269:	48 83 c0 01          	add    $0x1,%rax
+  80426d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804273:	75 e0                	jne    804255 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804275:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80427a:	c3                   	ret
+            return envs[i].env_id;
+  80427b:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804282:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804289:	00 00 00 
+  80428c:	48 01 d0             	add    %rdx,%rax
+  80428f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804295:	c3                   	ret
+
+0000000000804296 <__text_end>:
+  804296:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429d:	00 00 00 
+  8042a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a7:	00 00 00 
+  8042aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b1:	00 00 00 
+  8042b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042bb:	00 00 00 
+  8042be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c5:	00 00 00 
+  8042c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cf:	00 00 00 
+  8042d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d9:	00 00 00 
+  8042dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e3:	00 00 00 
+  8042e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ed:	00 00 00 
+  8042f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f7:	00 00 00 
+  8042fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804301:	00 00 00 
+  804304:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430b:	00 00 00 
+  80430e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804315:	00 00 00 
+  804318:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431f:	00 00 00 
+  804322:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804329:	00 00 00 
+  80432c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804333:	00 00 00 
+  804336:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433d:	00 00 00 
+  804340:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804347:	00 00 00 
+  80434a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804351:	00 00 00 
+  804354:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435b:	00 00 00 
+  80435e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804365:	00 00 00 
+  804368:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436f:	00 00 00 
+  804372:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804379:	00 00 00 
+  80437c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804383:	00 00 00 
+  804386:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438d:	00 00 00 
+  804390:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804397:	00 00 00 
+  80439a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a1:	00 00 00 
+  8043a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ab:	00 00 00 
+  8043ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b5:	00 00 00 
+  8043b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bf:	00 00 00 
+  8043c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c9:	00 00 00 
+  8043cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d3:	00 00 00 
+  8043d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dd:	00 00 00 
+  8043e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e7:	00 00 00 
+  8043ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f1:	00 00 00 
+  8043f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fb:	00 00 00 
+  8043fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804405:	00 00 00 
+  804408:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440f:	00 00 00 
+  804412:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804419:	00 00 00 
+  80441c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804423:	00 00 00 
+  804426:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442d:	00 00 00 
+  804430:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804437:	00 00 00 
+  80443a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804441:	00 00 00 
+  804444:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444b:	00 00 00 
+  80444e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804455:	00 00 00 
+  804458:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445f:	00 00 00 
+  804462:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804469:	00 00 00 
+  80446c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804473:	00 00 00 
+  804476:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447d:	00 00 00 
+  804480:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804487:	00 00 00 
+  80448a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804491:	00 00 00 
+  804494:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449b:	00 00 00 
+  80449e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a5:	00 00 00 
+  8044a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044af:	00 00 00 
+  8044b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b9:	00 00 00 
+  8044bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c3:	00 00 00 
+  8044c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cd:	00 00 00 
+  8044d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d7:	00 00 00 
+  8044da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e1:	00 00 00 
+  8044e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044eb:	00 00 00 
+  8044ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f5:	00 00 00 
+  8044f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ff:	00 00 00 
+  804502:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804509:	00 00 00 
+  80450c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804513:	00 00 00 
+  804516:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451d:	00 00 00 
+  804520:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804527:	00 00 00 
+  80452a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804531:	00 00 00 
+  804534:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453b:	00 00 00 
+  80453e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804545:	00 00 00 
+  804548:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454f:	00 00 00 
+  804552:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804559:	00 00 00 
+  80455c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804563:	00 00 00 
+  804566:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456d:	00 00 00 
+  804570:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804577:	00 00 00 
+  80457a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804581:	00 00 00 
+  804584:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458b:	00 00 00 
+  80458e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804595:	00 00 00 
+  804598:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459f:	00 00 00 
+  8045a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a9:	00 00 00 
+  8045ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b3:	00 00 00 
+  8045b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bd:	00 00 00 
+  8045c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c7:	00 00 00 
+  8045ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d1:	00 00 00 
+  8045d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045db:	00 00 00 
+  8045de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e5:	00 00 00 
+  8045e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ef:	00 00 00 
+  8045f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f9:	00 00 00 
+  8045fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804603:	00 00 00 
+  804606:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460d:	00 00 00 
+  804610:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804617:	00 00 00 
+  80461a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804621:	00 00 00 
+  804624:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462b:	00 00 00 
+  80462e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804635:	00 00 00 
+  804638:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463f:	00 00 00 
+  804642:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804649:	00 00 00 
+  80464c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804653:	00 00 00 
+  804656:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465d:	00 00 00 
+  804660:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804667:	00 00 00 
+  80466a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804671:	00 00 00 
+  804674:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467b:	00 00 00 
+  80467e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804685:	00 00 00 
+  804688:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468f:	00 00 00 
+  804692:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804699:	00 00 00 
+  80469c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a3:	00 00 00 
+  8046a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ad:	00 00 00 
+  8046b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b7:	00 00 00 
+  8046ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c1:	00 00 00 
+  8046c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cb:	00 00 00 
+  8046ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d5:	00 00 00 
+  8046d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046df:	00 00 00 
+  8046e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e9:	00 00 00 
+  8046ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f3:	00 00 00 
+  8046f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fd:	00 00 00 
+  804700:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804707:	00 00 00 
+  80470a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804711:	00 00 00 
+  804714:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471b:	00 00 00 
+  80471e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804725:	00 00 00 
+  804728:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472f:	00 00 00 
+  804732:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804739:	00 00 00 
+  80473c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804743:	00 00 00 
+  804746:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474d:	00 00 00 
+  804750:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804757:	00 00 00 
+  80475a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804761:	00 00 00 
+  804764:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476b:	00 00 00 
+  80476e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804775:	00 00 00 
+  804778:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477f:	00 00 00 
+  804782:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804789:	00 00 00 
+  80478c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804793:	00 00 00 
+  804796:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479d:	00 00 00 
+  8047a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a7:	00 00 00 
+  8047aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b1:	00 00 00 
+  8047b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bb:	00 00 00 
+  8047be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c5:	00 00 00 
+  8047c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cf:	00 00 00 
+  8047d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d9:	00 00 00 
+  8047dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e3:	00 00 00 
+  8047e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ed:	00 00 00 
+  8047f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f7:	00 00 00 
+  8047fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804801:	00 00 00 
+  804804:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480b:	00 00 00 
+  80480e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804815:	00 00 00 
+  804818:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481f:	00 00 00 
+  804822:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804829:	00 00 00 
+  80482c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804833:	00 00 00 
+  804836:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483d:	00 00 00 
+  804840:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804847:	00 00 00 
+  80484a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804851:	00 00 00 
+  804854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485b:	00 00 00 
+  80485e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804865:	00 00 00 
+  804868:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486f:	00 00 00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,8167 @@
+
+obj/user/dumbfork:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 81 01 00 00       	call   8001a4 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <dumbfork>:
+        sys_yield();
+    }
+}
+
+envid_t
+dumbfork(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80002e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800033:	cd 30                	int    $0x30
+  800035:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  800037:	85 c0                	test   %eax,%eax
+  800039:	78 4e                	js     800089 <dumbfork+0x64>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  80003b:	74 79                	je     8000b6 <dumbfork+0x91>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  80003d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  800043:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80004a:	00 00 00 
+  80004d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800052:	89 c2                	mov    %eax,%edx
+  800054:	be 00 00 00 00       	mov    $0x0,%esi
+  800059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005e:	48 b8 ff 14 80 00 00 	movabs $0x8014ff,%rax
+  800065:	00 00 00 
+  800068:	ff d0                	call   *%rax
+
+    /* Start the child environment running */
+    if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80006a:	be 02 00 00 00       	mov    $0x2,%esi
+  80006f:	89 df                	mov    %ebx,%edi
+  800071:	48 b8 de 16 80 00 00 	movabs $0x8016de,%rax
+  800078:	00 00 00 
+  80007b:	ff d0                	call   *%rax
+  80007d:	85 c0                	test   %eax,%eax
+  80007f:	78 66                	js     8000e7 <dumbfork+0xc2>
+        panic("sys_env_set_status: %i", r);
+
+    return envid;
+}
+  800081:	89 d8                	mov    %ebx,%eax
+  800083:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800087:	c9                   	leave
+  800088:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  800089:	89 c1                	mov    %eax,%ecx
+  80008b:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800092:	00 00 00 
+  800095:	be 23 00 00 00       	mov    $0x23,%esi
+  80009a:	48 bf 10 50 80 00 00 	movabs $0x805010,%rdi
+  8000a1:	00 00 00 
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	49 b8 70 02 80 00 00 	movabs $0x800270,%r8
+  8000b0:	00 00 00 
+  8000b3:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8000b6:	48 b8 d8 13 80 00 00 	movabs $0x8013d8,%rax
+  8000bd:	00 00 00 
+  8000c0:	ff d0                	call   *%rax
+  8000c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c7:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000ce:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000d5:	00 00 00 
+  8000d8:	48 01 d0             	add    %rdx,%rax
+  8000db:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000e2:	00 00 00 
+        return 0;
+  8000e5:	eb 9a                	jmp    800081 <dumbfork+0x5c>
+        panic("sys_env_set_status: %i", r);
+  8000e7:	89 c1                	mov    %eax,%ecx
+  8000e9:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8000f0:	00 00 00 
+  8000f3:	be 33 00 00 00       	mov    $0x33,%esi
+  8000f8:	48 bf 10 50 80 00 00 	movabs $0x805010,%rdi
+  8000ff:	00 00 00 
+  800102:	b8 00 00 00 00       	mov    $0x0,%eax
+  800107:	49 b8 70 02 80 00 00 	movabs $0x800270,%r8
+  80010e:	00 00 00 
+  800111:	41 ff d0             	call   *%r8
+
+0000000000800114 <umain>:
+umain(int argc, char **argv) {
+  800114:	55                   	push   %rbp
+  800115:	48 89 e5             	mov    %rsp,%rbp
+  800118:	41 57                	push   %r15
+  80011a:	41 56                	push   %r14
+  80011c:	41 55                	push   %r13
+  80011e:	41 54                	push   %r12
+  800120:	53                   	push   %rbx
+  800121:	48 83 ec 08          	sub    $0x8,%rsp
+    who = dumbfork();
+  800125:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+  800131:	41 89 c4             	mov    %eax,%r12d
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800134:	85 c0                	test   %eax,%eax
+  800136:	49 bd 37 50 80 00 00 	movabs $0x805037,%r13
+  80013d:	00 00 00 
+  800140:	48 b8 3e 50 80 00 00 	movabs $0x80503e,%rax
+  800147:	00 00 00 
+  80014a:	4c 0f 44 e8          	cmove  %rax,%r13
+  80014e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800153:	49 bf c0 03 80 00 00 	movabs $0x8003c0,%r15
+  80015a:	00 00 00 
+        sys_yield();
+  80015d:	49 be 09 14 80 00 00 	movabs $0x801409,%r14
+  800164:	00 00 00 
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800167:	eb 22                	jmp    80018b <umain+0x77>
+  800169:	83 fb 13             	cmp    $0x13,%ebx
+  80016c:	7f 27                	jg     800195 <umain+0x81>
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  80016e:	4c 89 ea             	mov    %r13,%rdx
+  800171:	89 de                	mov    %ebx,%esi
+  800173:	48 bf 44 50 80 00 00 	movabs $0x805044,%rdi
+  80017a:	00 00 00 
+  80017d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800182:	41 ff d7             	call   *%r15
+        sys_yield();
+  800185:	41 ff d6             	call   *%r14
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800188:	83 c3 01             	add    $0x1,%ebx
+  80018b:	45 85 e4             	test   %r12d,%r12d
+  80018e:	74 d9                	je     800169 <umain+0x55>
+  800190:	83 fb 09             	cmp    $0x9,%ebx
+  800193:	7e d9                	jle    80016e <umain+0x5a>
+}
+  800195:	48 83 c4 08          	add    $0x8,%rsp
+  800199:	5b                   	pop    %rbx
+  80019a:	41 5c                	pop    %r12
+  80019c:	41 5d                	pop    %r13
+  80019e:	41 5e                	pop    %r14
+  8001a0:	41 5f                	pop    %r15
+  8001a2:	5d                   	pop    %rbp
+  8001a3:	c3                   	ret
+
+00000000008001a4 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001a4:	55                   	push   %rbp
+  8001a5:	48 89 e5             	mov    %rsp,%rbp
+  8001a8:	41 56                	push   %r14
+  8001aa:	41 55                	push   %r13
+  8001ac:	41 54                	push   %r12
+  8001ae:	53                   	push   %rbx
+  8001af:	41 89 fd             	mov    %edi,%r13d
+  8001b2:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001b5:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8001bc:	00 00 00 
+  8001bf:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8001c6:	00 00 00 
+  8001c9:	48 39 c2             	cmp    %rax,%rdx
+  8001cc:	73 17                	jae    8001e5 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001ce:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001d1:	49 89 c4             	mov    %rax,%r12
+  8001d4:	48 83 c3 08          	add    $0x8,%rbx
+  8001d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001dd:	ff 53 f8             	call   *-0x8(%rbx)
+  8001e0:	4c 39 e3             	cmp    %r12,%rbx
+  8001e3:	72 ef                	jb     8001d4 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001e5:	48 b8 d8 13 80 00 00 	movabs $0x8013d8,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+  8001f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001f6:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8001fd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800204:	00 00 00 
+  800207:	48 01 d0             	add    %rdx,%rax
+  80020a:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800211:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800214:	45 85 ed             	test   %r13d,%r13d
+  800217:	7e 0d                	jle    800226 <libmain+0x82>
+  800219:	49 8b 06             	mov    (%r14),%rax
+  80021c:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800223:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800226:	4c 89 f6             	mov    %r14,%rsi
+  800229:	44 89 ef             	mov    %r13d,%edi
+  80022c:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800233:	00 00 00 
+  800236:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800238:	48 b8 4d 02 80 00 00 	movabs $0x80024d,%rax
+  80023f:	00 00 00 
+  800242:	ff d0                	call   *%rax
+#endif
+}
+  800244:	5b                   	pop    %rbx
+  800245:	41 5c                	pop    %r12
+  800247:	41 5d                	pop    %r13
+  800249:	41 5e                	pop    %r14
+  80024b:	5d                   	pop    %rbp
+  80024c:	c3                   	ret
+
+000000000080024d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80024d:	55                   	push   %rbp
+  80024e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800251:	48 b8 d4 20 80 00 00 	movabs $0x8020d4,%rax
+  800258:	00 00 00 
+  80025b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80025d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800262:	48 b8 6d 13 80 00 00 	movabs $0x80136d,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+}
+  80026e:	5d                   	pop    %rbp
+  80026f:	c3                   	ret
+
+0000000000800270 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800270:	55                   	push   %rbp
+  800271:	48 89 e5             	mov    %rsp,%rbp
+  800274:	41 56                	push   %r14
+  800276:	41 55                	push   %r13
+  800278:	41 54                	push   %r12
+  80027a:	53                   	push   %rbx
+  80027b:	48 83 ec 50          	sub    $0x50,%rsp
+  80027f:	49 89 fc             	mov    %rdi,%r12
+  800282:	41 89 f5             	mov    %esi,%r13d
+  800285:	48 89 d3             	mov    %rdx,%rbx
+  800288:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80028c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800290:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800294:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80029b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80029f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002a3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002a7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002ab:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002b2:	00 00 00 
+  8002b5:	4c 8b 30             	mov    (%rax),%r14
+  8002b8:	48 b8 d8 13 80 00 00 	movabs $0x8013d8,%rax
+  8002bf:	00 00 00 
+  8002c2:	ff d0                	call   *%rax
+  8002c4:	89 c6                	mov    %eax,%esi
+  8002c6:	45 89 e8             	mov    %r13d,%r8d
+  8002c9:	4c 89 e1             	mov    %r12,%rcx
+  8002cc:	4c 89 f2             	mov    %r14,%rdx
+  8002cf:	48 bf 60 50 80 00 00 	movabs $0x805060,%rdi
+  8002d6:	00 00 00 
+  8002d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002de:	49 bc c0 03 80 00 00 	movabs $0x8003c0,%r12
+  8002e5:	00 00 00 
+  8002e8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002eb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002ef:	48 89 df             	mov    %rbx,%rdi
+  8002f2:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  8002f9:	00 00 00 
+  8002fc:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002fe:	48 bf 54 50 80 00 00 	movabs $0x805054,%rdi
+  800305:	00 00 00 
+  800308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800310:	cc                   	int3
+  800311:	eb fd                	jmp    800310 <_panic+0xa0>
+
+0000000000800313 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800313:	55                   	push   %rbp
+  800314:	48 89 e5             	mov    %rsp,%rbp
+  800317:	53                   	push   %rbx
+  800318:	48 83 ec 08          	sub    $0x8,%rsp
+  80031c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80031f:	8b 06                	mov    (%rsi),%eax
+  800321:	8d 50 01             	lea    0x1(%rax),%edx
+  800324:	89 16                	mov    %edx,(%rsi)
+  800326:	48 98                	cltq
+  800328:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80032d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800333:	74 0a                	je     80033f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800335:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800339:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80033d:	c9                   	leave
+  80033e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80033f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800343:	be ff 00 00 00       	mov    $0xff,%esi
+  800348:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  80034f:	00 00 00 
+  800352:	ff d0                	call   *%rax
+        state->offset = 0;
+  800354:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80035a:	eb d9                	jmp    800335 <putch+0x22>
+
+000000000080035c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80035c:	55                   	push   %rbp
+  80035d:	48 89 e5             	mov    %rsp,%rbp
+  800360:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800367:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80036a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800371:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80037e:	48 89 f1             	mov    %rsi,%rcx
+  800381:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800388:	48 bf 13 03 80 00 00 	movabs $0x800313,%rdi
+  80038f:	00 00 00 
+  800392:	48 b8 10 05 80 00 00 	movabs $0x800510,%rax
+  800399:	00 00 00 
+  80039c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80039e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003a5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003ac:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  8003b3:	00 00 00 
+  8003b6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003b8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003be:	c9                   	leave
+  8003bf:	c3                   	ret
+
+00000000008003c0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003c0:	55                   	push   %rbp
+  8003c1:	48 89 e5             	mov    %rsp,%rbp
+  8003c4:	48 83 ec 50          	sub    $0x50,%rsp
+  8003c8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003cc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003d4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003d8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003dc:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003e3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003eb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003ef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003f3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003f7:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  8003fe:	00 00 00 
+  800401:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800403:	c9                   	leave
+  800404:	c3                   	ret
+
+0000000000800405 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800405:	55                   	push   %rbp
+  800406:	48 89 e5             	mov    %rsp,%rbp
+  800409:	41 57                	push   %r15
+  80040b:	41 56                	push   %r14
+  80040d:	41 55                	push   %r13
+  80040f:	41 54                	push   %r12
+  800411:	53                   	push   %rbx
+  800412:	48 83 ec 18          	sub    $0x18,%rsp
+  800416:	49 89 fc             	mov    %rdi,%r12
+  800419:	49 89 f5             	mov    %rsi,%r13
+  80041c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800420:	8b 45 10             	mov    0x10(%rbp),%eax
+  800423:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800426:	41 89 cf             	mov    %ecx,%r15d
+  800429:	4c 39 fa             	cmp    %r15,%rdx
+  80042c:	73 5b                	jae    800489 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80042e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800432:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800436:	85 db                	test   %ebx,%ebx
+  800438:	7e 0e                	jle    800448 <print_num+0x43>
+            putch(padc, put_arg);
+  80043a:	4c 89 ee             	mov    %r13,%rsi
+  80043d:	44 89 f7             	mov    %r14d,%edi
+  800440:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800443:	83 eb 01             	sub    $0x1,%ebx
+  800446:	75 f2                	jne    80043a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800448:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80044c:	48 b9 94 50 80 00 00 	movabs $0x805094,%rcx
+  800453:	00 00 00 
+  800456:	48 b8 83 50 80 00 00 	movabs $0x805083,%rax
+  80045d:	00 00 00 
+  800460:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800464:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800468:	ba 00 00 00 00       	mov    $0x0,%edx
+  80046d:	49 f7 f7             	div    %r15
+  800470:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800474:	4c 89 ee             	mov    %r13,%rsi
+  800477:	41 ff d4             	call   *%r12
+}
+  80047a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80047e:	5b                   	pop    %rbx
+  80047f:	41 5c                	pop    %r12
+  800481:	41 5d                	pop    %r13
+  800483:	41 5e                	pop    %r14
+  800485:	41 5f                	pop    %r15
+  800487:	5d                   	pop    %rbp
+  800488:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800489:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80048d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800492:	49 f7 f7             	div    %r15
+  800495:	48 83 ec 08          	sub    $0x8,%rsp
+  800499:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80049d:	52                   	push   %rdx
+  80049e:	45 0f be c9          	movsbl %r9b,%r9d
+  8004a2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004a6:	48 89 c2             	mov    %rax,%rdx
+  8004a9:	48 b8 05 04 80 00 00 	movabs $0x800405,%rax
+  8004b0:	00 00 00 
+  8004b3:	ff d0                	call   *%rax
+  8004b5:	48 83 c4 10          	add    $0x10,%rsp
+  8004b9:	eb 8d                	jmp    800448 <print_num+0x43>
+
+00000000008004bb <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004bb:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004bf:	48 8b 06             	mov    (%rsi),%rax
+  8004c2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004c6:	73 0a                	jae    8004d2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004c8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004cc:	48 89 16             	mov    %rdx,(%rsi)
+  8004cf:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004d2:	c3                   	ret
+
+00000000008004d3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004d3:	55                   	push   %rbp
+  8004d4:	48 89 e5             	mov    %rsp,%rbp
+  8004d7:	48 83 ec 50          	sub    $0x50,%rsp
+  8004db:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004df:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004e3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004e7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004fe:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800502:	48 b8 10 05 80 00 00 	movabs $0x800510,%rax
+  800509:	00 00 00 
+  80050c:	ff d0                	call   *%rax
+}
+  80050e:	c9                   	leave
+  80050f:	c3                   	ret
+
+0000000000800510 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800510:	55                   	push   %rbp
+  800511:	48 89 e5             	mov    %rsp,%rbp
+  800514:	41 57                	push   %r15
+  800516:	41 56                	push   %r14
+  800518:	41 55                	push   %r13
+  80051a:	41 54                	push   %r12
+  80051c:	53                   	push   %rbx
+  80051d:	48 83 ec 38          	sub    $0x38,%rsp
+  800521:	49 89 fe             	mov    %rdi,%r14
+  800524:	49 89 f5             	mov    %rsi,%r13
+  800527:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80052a:	48 8b 01             	mov    (%rcx),%rax
+  80052d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800531:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800535:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800539:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80053d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800541:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800545:	0f b6 3b             	movzbl (%rbx),%edi
+  800548:	40 80 ff 25          	cmp    $0x25,%dil
+  80054c:	74 18                	je     800566 <vprintfmt+0x56>
+            if (!ch) return;
+  80054e:	40 84 ff             	test   %dil,%dil
+  800551:	0f 84 04 07 00 00    	je     800c5b <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800557:	40 0f b6 ff          	movzbl %dil,%edi
+  80055b:	4c 89 ee             	mov    %r13,%rsi
+  80055e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800561:	4c 89 e3             	mov    %r12,%rbx
+  800564:	eb db                	jmp    800541 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800566:	be 00 00 00 00       	mov    $0x0,%esi
+  80056b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80056f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800574:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80057a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800581:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800585:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80058a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80058f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800592:	83 e8 23             	sub    $0x23,%eax
+  800595:	3c 57                	cmp    $0x57,%al
+  800597:	0f 87 a4 06 00 00    	ja     800c41 <vprintfmt+0x731>
+  80059d:	0f b6 c0             	movzbl %al,%eax
+  8005a0:	48 b9 20 52 80 00 00 	movabs $0x805220,%rcx
+  8005a7:	00 00 00 
+  8005aa:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005ad:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005b0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005b4:	eb cf                	jmp    800585 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005b6:	49 89 dc             	mov    %rbx,%r12
+  8005b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8005be:	eb c5                	jmp    800585 <vprintfmt+0x75>
+            padc = ch;
+  8005c0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005c4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005c7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ca:	eb b9                	jmp    800585 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d2:	77 24                	ja     8005f8 <vprintfmt+0xe8>
+  8005d4:	89 c1                	mov    %eax,%ecx
+  8005d6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005da:	83 c0 08             	add    $0x8,%eax
+  8005dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005e0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005e3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005e6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005ea:	79 99                	jns    800585 <vprintfmt+0x75>
+                width = precision;
+  8005ec:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005f0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005f6:	eb 8d                	jmp    800585 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005f8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005fc:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800600:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800604:	eb da                	jmp    8005e0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800606:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80060b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80060f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800615:	3c 39                	cmp    $0x39,%al
+  800617:	77 1c                	ja     800635 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800619:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80061d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800621:	0f b6 c0             	movzbl %al,%eax
+  800624:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800629:	0f b6 03             	movzbl (%rbx),%eax
+  80062c:	3c 39                	cmp    $0x39,%al
+  80062e:	76 e9                	jbe    800619 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800630:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800633:	eb b1                	jmp    8005e6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800635:	49 89 dc             	mov    %rbx,%r12
+  800638:	eb ac                	jmp    8005e6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80063a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80063d:	85 c9                	test   %ecx,%ecx
+  80063f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800644:	0f 49 c1             	cmovns %ecx,%eax
+  800647:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80064a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80064d:	e9 33 ff ff ff       	jmp    800585 <vprintfmt+0x75>
+            lflag++;
+  800652:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800655:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800658:	e9 28 ff ff ff       	jmp    800585 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80065d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800660:	83 f8 2f             	cmp    $0x2f,%eax
+  800663:	77 19                	ja     80067e <vprintfmt+0x16e>
+  800665:	89 c2                	mov    %eax,%edx
+  800667:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066b:	83 c0 08             	add    $0x8,%eax
+  80066e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800671:	8b 3a                	mov    (%rdx),%edi
+  800673:	4c 89 ee             	mov    %r13,%rsi
+  800676:	41 ff d6             	call   *%r14
+            break;
+  800679:	e9 c3 fe ff ff       	jmp    800541 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80067e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800682:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800686:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80068a:	eb e5                	jmp    800671 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80068c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068f:	83 f8 2f             	cmp    $0x2f,%eax
+  800692:	77 5a                	ja     8006ee <vprintfmt+0x1de>
+  800694:	89 c2                	mov    %eax,%edx
+  800696:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069a:	83 c0 08             	add    $0x8,%eax
+  80069d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006a0:	8b 02                	mov    (%rdx),%eax
+  8006a2:	89 c1                	mov    %eax,%ecx
+  8006a4:	f7 d9                	neg    %ecx
+  8006a6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006a9:	83 f9 13             	cmp    $0x13,%ecx
+  8006ac:	7f 4e                	jg     8006fc <vprintfmt+0x1ec>
+  8006ae:	48 63 c1             	movslq %ecx,%rax
+  8006b1:	48 ba e0 54 80 00 00 	movabs $0x8054e0,%rdx
+  8006b8:	00 00 00 
+  8006bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006bf:	48 85 c0             	test   %rax,%rax
+  8006c2:	74 38                	je     8006fc <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006c4:	48 89 c1             	mov    %rax,%rcx
+  8006c7:	48 ba 19 57 80 00 00 	movabs $0x805719,%rdx
+  8006ce:	00 00 00 
+  8006d1:	4c 89 ee             	mov    %r13,%rsi
+  8006d4:	4c 89 f7             	mov    %r14,%rdi
+  8006d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006dc:	49 b8 d3 04 80 00 00 	movabs $0x8004d3,%r8
+  8006e3:	00 00 00 
+  8006e6:	41 ff d0             	call   *%r8
+  8006e9:	e9 53 fe ff ff       	jmp    800541 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fa:	eb a4                	jmp    8006a0 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006fc:	48 ba ac 50 80 00 00 	movabs $0x8050ac,%rdx
+  800703:	00 00 00 
+  800706:	4c 89 ee             	mov    %r13,%rsi
+  800709:	4c 89 f7             	mov    %r14,%rdi
+  80070c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800711:	49 b8 d3 04 80 00 00 	movabs $0x8004d3,%r8
+  800718:	00 00 00 
+  80071b:	41 ff d0             	call   *%r8
+  80071e:	e9 1e fe ff ff       	jmp    800541 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800723:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800726:	83 f8 2f             	cmp    $0x2f,%eax
+  800729:	77 36                	ja     800761 <vprintfmt+0x251>
+  80072b:	89 c2                	mov    %eax,%edx
+  80072d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800731:	83 c0 08             	add    $0x8,%eax
+  800734:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800737:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80073a:	48 85 f6             	test   %rsi,%rsi
+  80073d:	48 b8 a5 50 80 00 00 	movabs $0x8050a5,%rax
+  800744:	00 00 00 
+  800747:	48 0f 45 c6          	cmovne %rsi,%rax
+  80074b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80074f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800753:	7e 06                	jle    80075b <vprintfmt+0x24b>
+  800755:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800759:	75 14                	jne    80076f <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80075b:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80075f:	eb 5b                	jmp    8007bc <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800761:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800765:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800769:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076d:	eb c8                	jmp    800737 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80076f:	49 63 f7             	movslq %r15d,%rsi
+  800772:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800776:	48 b8 15 0d 80 00 00 	movabs $0x800d15,%rax
+  80077d:	00 00 00 
+  800780:	ff d0                	call   *%rax
+  800782:	48 89 c2             	mov    %rax,%rdx
+  800785:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800788:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80078a:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80078d:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800790:	85 c0                	test   %eax,%eax
+  800792:	7e c7                	jle    80075b <vprintfmt+0x24b>
+  800794:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800799:	4c 89 ee             	mov    %r13,%rsi
+  80079c:	44 89 e7             	mov    %r12d,%edi
+  80079f:	41 ff d6             	call   *%r14
+  8007a2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007a6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007a9:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007ac:	75 eb                	jne    800799 <vprintfmt+0x289>
+  8007ae:	eb ab                	jmp    80075b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007b0:	0f b6 f8             	movzbl %al,%edi
+  8007b3:	4c 89 ee             	mov    %r13,%rsi
+  8007b6:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8007b9:	4c 89 e2             	mov    %r12,%rdx
+  8007bc:	45 85 ff             	test   %r15d,%r15d
+  8007bf:	78 06                	js     8007c7 <vprintfmt+0x2b7>
+  8007c1:	41 83 ef 01          	sub    $0x1,%r15d
+  8007c5:	78 23                	js     8007ea <vprintfmt+0x2da>
+  8007c7:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8007cb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007d1:	84 c0                	test   %al,%al
+  8007d3:	74 15                	je     8007ea <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007d5:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007d9:	74 d5                	je     8007b0 <vprintfmt+0x2a0>
+  8007db:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007de:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007e3:	80 fa 5e             	cmp    $0x5e,%dl
+  8007e6:	77 cb                	ja     8007b3 <vprintfmt+0x2a3>
+  8007e8:	eb c6                	jmp    8007b0 <vprintfmt+0x2a0>
+  8007ea:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007ed:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8007f0:	01 f0                	add    %esi,%eax
+  8007f2:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8007f4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007f8:	85 c0                	test   %eax,%eax
+  8007fa:	0f 8e 41 fd ff ff    	jle    800541 <vprintfmt+0x31>
+  800800:	4c 89 ee             	mov    %r13,%rsi
+  800803:	bf 20 00 00 00       	mov    $0x20,%edi
+  800808:	41 ff d6             	call   *%r14
+  80080b:	41 83 ec 01          	sub    $0x1,%r12d
+  80080f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800813:	75 eb                	jne    800800 <vprintfmt+0x2f0>
+  800815:	e9 27 fd ff ff       	jmp    800541 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80081a:	40 84 f6             	test   %sil,%sil
+  80081d:	75 26                	jne    800845 <vprintfmt+0x335>
+    switch (lflag) {
+  80081f:	85 d2                	test   %edx,%edx
+  800821:	74 59                	je     80087c <vprintfmt+0x36c>
+  800823:	83 fa 01             	cmp    $0x1,%edx
+  800826:	74 7b                	je     8008a3 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800828:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082b:	83 f8 2f             	cmp    $0x2f,%eax
+  80082e:	0f 87 96 00 00 00    	ja     8008ca <vprintfmt+0x3ba>
+  800834:	89 c2                	mov    %eax,%edx
+  800836:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083a:	83 c0 08             	add    $0x8,%eax
+  80083d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800840:	4c 8b 22             	mov    (%rdx),%r12
+  800843:	eb 17                	jmp    80085c <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800845:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800848:	83 f8 2f             	cmp    $0x2f,%eax
+  80084b:	77 21                	ja     80086e <vprintfmt+0x35e>
+  80084d:	89 c2                	mov    %eax,%edx
+  80084f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800853:	83 c0 08             	add    $0x8,%eax
+  800856:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800859:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80085c:	4d 85 e4             	test   %r12,%r12
+  80085f:	78 7a                	js     8008db <vprintfmt+0x3cb>
+            num = i;
+  800861:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800864:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800869:	e9 b5 02 00 00       	jmp    800b23 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80086e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800872:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800876:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087a:	eb dd                	jmp    800859 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  80087c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087f:	83 f8 2f             	cmp    $0x2f,%eax
+  800882:	77 11                	ja     800895 <vprintfmt+0x385>
+  800884:	89 c2                	mov    %eax,%edx
+  800886:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088a:	83 c0 08             	add    $0x8,%eax
+  80088d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800890:	4c 63 22             	movslq (%rdx),%r12
+  800893:	eb c7                	jmp    80085c <vprintfmt+0x34c>
+  800895:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800899:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a1:	eb ed                	jmp    800890 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8008a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a9:	77 11                	ja     8008bc <vprintfmt+0x3ac>
+  8008ab:	89 c2                	mov    %eax,%edx
+  8008ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b1:	83 c0 08             	add    $0x8,%eax
+  8008b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b7:	4c 8b 22             	mov    (%rdx),%r12
+  8008ba:	eb a0                	jmp    80085c <vprintfmt+0x34c>
+  8008bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c8:	eb ed                	jmp    8008b7 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8008ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d6:	e9 65 ff ff ff       	jmp    800840 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8008db:	4c 89 ee             	mov    %r13,%rsi
+  8008de:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008e3:	41 ff d6             	call   *%r14
+                i = -i;
+  8008e6:	49 f7 dc             	neg    %r12
+  8008e9:	e9 73 ff ff ff       	jmp    800861 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ee:	40 84 f6             	test   %sil,%sil
+  8008f1:	75 32                	jne    800925 <vprintfmt+0x415>
+    switch (lflag) {
+  8008f3:	85 d2                	test   %edx,%edx
+  8008f5:	74 5d                	je     800954 <vprintfmt+0x444>
+  8008f7:	83 fa 01             	cmp    $0x1,%edx
+  8008fa:	0f 84 82 00 00 00    	je     800982 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800900:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800903:	83 f8 2f             	cmp    $0x2f,%eax
+  800906:	0f 87 a5 00 00 00    	ja     8009b1 <vprintfmt+0x4a1>
+  80090c:	89 c2                	mov    %eax,%edx
+  80090e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800912:	83 c0 08             	add    $0x8,%eax
+  800915:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800918:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80091b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800920:	e9 fe 01 00 00       	jmp    800b23 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800925:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800928:	83 f8 2f             	cmp    $0x2f,%eax
+  80092b:	77 19                	ja     800946 <vprintfmt+0x436>
+  80092d:	89 c2                	mov    %eax,%edx
+  80092f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800933:	83 c0 08             	add    $0x8,%eax
+  800936:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800939:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80093c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800941:	e9 dd 01 00 00       	jmp    800b23 <vprintfmt+0x613>
+  800946:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800952:	eb e5                	jmp    800939 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800954:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800957:	83 f8 2f             	cmp    $0x2f,%eax
+  80095a:	77 18                	ja     800974 <vprintfmt+0x464>
+  80095c:	89 c2                	mov    %eax,%edx
+  80095e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800962:	83 c0 08             	add    $0x8,%eax
+  800965:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800968:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80096a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80096f:	e9 af 01 00 00       	jmp    800b23 <vprintfmt+0x613>
+  800974:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800978:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800980:	eb e6                	jmp    800968 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800982:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800985:	83 f8 2f             	cmp    $0x2f,%eax
+  800988:	77 19                	ja     8009a3 <vprintfmt+0x493>
+  80098a:	89 c2                	mov    %eax,%edx
+  80098c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800990:	83 c0 08             	add    $0x8,%eax
+  800993:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800996:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800999:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80099e:	e9 80 01 00 00       	jmp    800b23 <vprintfmt+0x613>
+  8009a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009af:	eb e5                	jmp    800996 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8009b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bd:	e9 56 ff ff ff       	jmp    800918 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c2:	40 84 f6             	test   %sil,%sil
+  8009c5:	75 2e                	jne    8009f5 <vprintfmt+0x4e5>
+    switch (lflag) {
+  8009c7:	85 d2                	test   %edx,%edx
+  8009c9:	0f 84 b3 00 00 00    	je     800a82 <vprintfmt+0x572>
+  8009cf:	83 fa 01             	cmp    $0x1,%edx
+  8009d2:	0f 84 d3 00 00 00    	je     800aab <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8009d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009db:	83 f8 2f             	cmp    $0x2f,%eax
+  8009de:	0f 87 f1 00 00 00    	ja     800ad5 <vprintfmt+0x5c5>
+  8009e4:	89 c2                	mov    %eax,%edx
+  8009e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ea:	83 c0 08             	add    $0x8,%eax
+  8009ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f0:	48 8b 02             	mov    (%rdx),%rax
+  8009f3:	eb 17                	jmp    800a0c <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fb:	77 77                	ja     800a74 <vprintfmt+0x564>
+  8009fd:	89 c2                	mov    %eax,%edx
+  8009ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a03:	83 c0 08             	add    $0x8,%eax
+  800a06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a09:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800a0c:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800a0e:	83 f8 07             	cmp    $0x7,%eax
+  800a11:	0f 8e cf 00 00 00    	jle    800ae6 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800a17:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800a1d:	44 89 e7             	mov    %r12d,%edi
+  800a20:	41 c1 e4 03          	shl    $0x3,%r12d
+  800a24:	89 d1                	mov    %edx,%ecx
+  800a26:	8d 72 07             	lea    0x7(%rdx),%esi
+  800a29:	85 d2                	test   %edx,%edx
+  800a2b:	0f 48 d6             	cmovs  %esi,%edx
+  800a2e:	c1 fa 03             	sar    $0x3,%edx
+  800a31:	83 f9 3f             	cmp    $0x3f,%ecx
+  800a34:	7f e7                	jg     800a1d <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800a36:	85 ff                	test   %edi,%edi
+  800a38:	0f 84 03 fb ff ff    	je     800541 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800a3e:	49 63 f4             	movslq %r12d,%rsi
+  800a41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a46:	48 f7 f6             	div    %rsi
+  800a49:	49 89 d7             	mov    %rdx,%r15
+  800a4c:	83 c0 30             	add    $0x30,%eax
+  800a4f:	0f be f8             	movsbl %al,%edi
+  800a52:	4c 89 ee             	mov    %r13,%rsi
+  800a55:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800a58:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800a5b:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800a60:	45 85 e4             	test   %r12d,%r12d
+  800a63:	41 0f 49 d4          	cmovns %r12d,%edx
+  800a67:	c1 fa 03             	sar    $0x3,%edx
+  800a6a:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800a6d:	75 cf                	jne    800a3e <vprintfmt+0x52e>
+  800a6f:	e9 cd fa ff ff       	jmp    800541 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800a74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a80:	eb 87                	jmp    800a09 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800a82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a85:	83 f8 2f             	cmp    $0x2f,%eax
+  800a88:	77 13                	ja     800a9d <vprintfmt+0x58d>
+  800a8a:	89 c2                	mov    %eax,%edx
+  800a8c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a90:	83 c0 08             	add    $0x8,%eax
+  800a93:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a96:	8b 02                	mov    (%rdx),%eax
+  800a98:	e9 6f ff ff ff       	jmp    800a0c <vprintfmt+0x4fc>
+  800a9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa9:	eb eb                	jmp    800a96 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800aab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aae:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab1:	77 14                	ja     800ac7 <vprintfmt+0x5b7>
+  800ab3:	89 c2                	mov    %eax,%edx
+  800ab5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab9:	83 c0 08             	add    $0x8,%eax
+  800abc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abf:	48 8b 02             	mov    (%rdx),%rax
+  800ac2:	e9 45 ff ff ff       	jmp    800a0c <vprintfmt+0x4fc>
+  800ac7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad3:	eb ea                	jmp    800abf <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800ad5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800add:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae1:	e9 0a ff ff ff       	jmp    8009f0 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800ae6:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800aec:	e9 4d ff ff ff       	jmp    800a3e <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800af1:	4c 89 ee             	mov    %r13,%rsi
+  800af4:	bf 30 00 00 00       	mov    $0x30,%edi
+  800af9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800afc:	4c 89 ee             	mov    %r13,%rsi
+  800aff:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b04:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0d:	77 47                	ja     800b56 <vprintfmt+0x646>
+  800b0f:	89 c2                	mov    %eax,%edx
+  800b11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b15:	83 c0 08             	add    $0x8,%eax
+  800b18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b1e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b23:	48 83 ec 08          	sub    $0x8,%rsp
+  800b27:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b2b:	0f 94 c0             	sete   %al
+  800b2e:	0f b6 c0             	movzbl %al,%eax
+  800b31:	50                   	push   %rax
+  800b32:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b37:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b3b:	4c 89 ee             	mov    %r13,%rsi
+  800b3e:	4c 89 f7             	mov    %r14,%rdi
+  800b41:	48 b8 05 04 80 00 00 	movabs $0x800405,%rax
+  800b48:	00 00 00 
+  800b4b:	ff d0                	call   *%rax
+            break;
+  800b4d:	48 83 c4 10          	add    $0x10,%rsp
+  800b51:	e9 eb f9 ff ff       	jmp    800541 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b62:	eb b7                	jmp    800b1b <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800b64:	40 84 f6             	test   %sil,%sil
+  800b67:	75 2b                	jne    800b94 <vprintfmt+0x684>
+    switch (lflag) {
+  800b69:	85 d2                	test   %edx,%edx
+  800b6b:	74 56                	je     800bc3 <vprintfmt+0x6b3>
+  800b6d:	83 fa 01             	cmp    $0x1,%edx
+  800b70:	74 7f                	je     800bf1 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800b72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b75:	83 f8 2f             	cmp    $0x2f,%eax
+  800b78:	0f 87 a2 00 00 00    	ja     800c20 <vprintfmt+0x710>
+  800b7e:	89 c2                	mov    %eax,%edx
+  800b80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b84:	83 c0 08             	add    $0x8,%eax
+  800b87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b8d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b92:	eb 8f                	jmp    800b23 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800b94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b97:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9a:	77 19                	ja     800bb5 <vprintfmt+0x6a5>
+  800b9c:	89 c2                	mov    %eax,%edx
+  800b9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba2:	83 c0 08             	add    $0x8,%eax
+  800ba5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bab:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bb0:	e9 6e ff ff ff       	jmp    800b23 <vprintfmt+0x613>
+  800bb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc1:	eb e5                	jmp    800ba8 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800bc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc6:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc9:	77 18                	ja     800be3 <vprintfmt+0x6d3>
+  800bcb:	89 c2                	mov    %eax,%edx
+  800bcd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd1:	83 c0 08             	add    $0x8,%eax
+  800bd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bd9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bde:	e9 40 ff ff ff       	jmp    800b23 <vprintfmt+0x613>
+  800be3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800beb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bef:	eb e6                	jmp    800bd7 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800bf1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf4:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf7:	77 19                	ja     800c12 <vprintfmt+0x702>
+  800bf9:	89 c2                	mov    %eax,%edx
+  800bfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bff:	83 c0 08             	add    $0x8,%eax
+  800c02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c05:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c08:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c0d:	e9 11 ff ff ff       	jmp    800b23 <vprintfmt+0x613>
+  800c12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1e:	eb e5                	jmp    800c05 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800c20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2c:	e9 59 ff ff ff       	jmp    800b8a <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800c31:	4c 89 ee             	mov    %r13,%rsi
+  800c34:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c39:	41 ff d6             	call   *%r14
+            break;
+  800c3c:	e9 00 f9 ff ff       	jmp    800541 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c41:	4c 89 ee             	mov    %r13,%rsi
+  800c44:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c49:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c4c:	48 83 eb 01          	sub    $0x1,%rbx
+  800c50:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c54:	75 f6                	jne    800c4c <vprintfmt+0x73c>
+  800c56:	e9 e6 f8 ff ff       	jmp    800541 <vprintfmt+0x31>
+}
+  800c5b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c5f:	5b                   	pop    %rbx
+  800c60:	41 5c                	pop    %r12
+  800c62:	41 5d                	pop    %r13
+  800c64:	41 5e                	pop    %r14
+  800c66:	41 5f                	pop    %r15
+  800c68:	5d                   	pop    %rbp
+  800c69:	c3                   	ret
+
+0000000000800c6a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c6a:	55                   	push   %rbp
+  800c6b:	48 89 e5             	mov    %rsp,%rbp
+  800c6e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c76:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c7b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c7f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c86:	48 85 ff             	test   %rdi,%rdi
+  800c89:	74 2b                	je     800cb6 <vsnprintf+0x4c>
+  800c8b:	48 85 f6             	test   %rsi,%rsi
+  800c8e:	74 26                	je     800cb6 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c90:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c94:	48 bf bb 04 80 00 00 	movabs $0x8004bb,%rdi
+  800c9b:	00 00 00 
+  800c9e:	48 b8 10 05 80 00 00 	movabs $0x800510,%rax
+  800ca5:	00 00 00 
+  800ca8:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800caa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cae:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cb1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cb4:	c9                   	leave
+  800cb5:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cbb:	eb f7                	jmp    800cb4 <vsnprintf+0x4a>
+
+0000000000800cbd <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cbd:	55                   	push   %rbp
+  800cbe:	48 89 e5             	mov    %rsp,%rbp
+  800cc1:	48 83 ec 50          	sub    $0x50,%rsp
+  800cc5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cc9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ccd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cd1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cd8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ce4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ce8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cec:	48 b8 6a 0c 80 00 00 	movabs $0x800c6a,%rax
+  800cf3:	00 00 00 
+  800cf6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cf8:	c9                   	leave
+  800cf9:	c3                   	ret
+
+0000000000800cfa <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cfa:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cfd:	74 10                	je     800d0f <strlen+0x15>
+    size_t n = 0;
+  800cff:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d04:	48 83 c0 01          	add    $0x1,%rax
+  800d08:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d0c:	75 f6                	jne    800d04 <strlen+0xa>
+  800d0e:	c3                   	ret
+    size_t n = 0;
+  800d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d14:	c3                   	ret
+
+0000000000800d15 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d15:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d18:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d1d:	48 85 f6             	test   %rsi,%rsi
+  800d20:	74 11                	je     800d33 <strnlen+0x1e>
+  800d22:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d26:	74 0c                	je     800d34 <strnlen+0x1f>
+  800d28:	48 83 c2 01          	add    $0x1,%rdx
+  800d2c:	48 39 d0             	cmp    %rdx,%rax
+  800d2f:	75 f1                	jne    800d22 <strnlen+0xd>
+  800d31:	eb 04                	jmp    800d37 <strnlen+0x22>
+  800d33:	c3                   	ret
+  800d34:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d37:	c3                   	ret
+
+0000000000800d38 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d38:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d40:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d44:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d47:	48 83 c2 01          	add    $0x1,%rdx
+  800d4b:	84 c9                	test   %cl,%cl
+  800d4d:	75 f1                	jne    800d40 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d4f:	c3                   	ret
+
+0000000000800d50 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d50:	55                   	push   %rbp
+  800d51:	48 89 e5             	mov    %rsp,%rbp
+  800d54:	41 54                	push   %r12
+  800d56:	53                   	push   %rbx
+  800d57:	48 89 fb             	mov    %rdi,%rbx
+  800d5a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d5d:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  800d64:	00 00 00 
+  800d67:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d69:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d6d:	4c 89 e6             	mov    %r12,%rsi
+  800d70:	48 b8 38 0d 80 00 00 	movabs $0x800d38,%rax
+  800d77:	00 00 00 
+  800d7a:	ff d0                	call   *%rax
+    return dst;
+}
+  800d7c:	48 89 d8             	mov    %rbx,%rax
+  800d7f:	5b                   	pop    %rbx
+  800d80:	41 5c                	pop    %r12
+  800d82:	5d                   	pop    %rbp
+  800d83:	c3                   	ret
+
+0000000000800d84 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d84:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d87:	48 85 d2             	test   %rdx,%rdx
+  800d8a:	74 1f                	je     800dab <strncpy+0x27>
+  800d8c:	48 01 fa             	add    %rdi,%rdx
+  800d8f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d92:	48 83 c1 01          	add    $0x1,%rcx
+  800d96:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d9a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d9e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800da2:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800da6:	48 39 ca             	cmp    %rcx,%rdx
+  800da9:	75 e7                	jne    800d92 <strncpy+0xe>
+    }
+    return ret;
+}
+  800dab:	c3                   	ret
+
+0000000000800dac <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800dac:	48 89 f8             	mov    %rdi,%rax
+  800daf:	48 85 d2             	test   %rdx,%rdx
+  800db2:	74 24                	je     800dd8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800db4:	48 83 ea 01          	sub    $0x1,%rdx
+  800db8:	74 1b                	je     800dd5 <strlcpy+0x29>
+  800dba:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800dbe:	0f b6 16             	movzbl (%rsi),%edx
+  800dc1:	84 d2                	test   %dl,%dl
+  800dc3:	74 10                	je     800dd5 <strlcpy+0x29>
+            *dst++ = *src++;
+  800dc5:	48 83 c6 01          	add    $0x1,%rsi
+  800dc9:	48 83 c0 01          	add    $0x1,%rax
+  800dcd:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800dd0:	48 39 c8             	cmp    %rcx,%rax
+  800dd3:	75 e9                	jne    800dbe <strlcpy+0x12>
+        *dst = '\0';
+  800dd5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dd8:	48 29 f8             	sub    %rdi,%rax
+}
+  800ddb:	c3                   	ret
+
+0000000000800ddc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ddc:	0f b6 07             	movzbl (%rdi),%eax
+  800ddf:	84 c0                	test   %al,%al
+  800de1:	74 13                	je     800df6 <strcmp+0x1a>
+  800de3:	38 06                	cmp    %al,(%rsi)
+  800de5:	75 0f                	jne    800df6 <strcmp+0x1a>
+  800de7:	48 83 c7 01          	add    $0x1,%rdi
+  800deb:	48 83 c6 01          	add    $0x1,%rsi
+  800def:	0f b6 07             	movzbl (%rdi),%eax
+  800df2:	84 c0                	test   %al,%al
+  800df4:	75 ed                	jne    800de3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800df6:	0f b6 c0             	movzbl %al,%eax
+  800df9:	0f b6 16             	movzbl (%rsi),%edx
+  800dfc:	29 d0                	sub    %edx,%eax
+}
+  800dfe:	c3                   	ret
+
+0000000000800dff <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800dff:	48 85 d2             	test   %rdx,%rdx
+  800e02:	74 1f                	je     800e23 <strncmp+0x24>
+  800e04:	0f b6 07             	movzbl (%rdi),%eax
+  800e07:	84 c0                	test   %al,%al
+  800e09:	74 1e                	je     800e29 <strncmp+0x2a>
+  800e0b:	3a 06                	cmp    (%rsi),%al
+  800e0d:	75 1a                	jne    800e29 <strncmp+0x2a>
+  800e0f:	48 83 c7 01          	add    $0x1,%rdi
+  800e13:	48 83 c6 01          	add    $0x1,%rsi
+  800e17:	48 83 ea 01          	sub    $0x1,%rdx
+  800e1b:	75 e7                	jne    800e04 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e22:	c3                   	ret
+  800e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e28:	c3                   	ret
+  800e29:	48 85 d2             	test   %rdx,%rdx
+  800e2c:	74 09                	je     800e37 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e2e:	0f b6 07             	movzbl (%rdi),%eax
+  800e31:	0f b6 16             	movzbl (%rsi),%edx
+  800e34:	29 d0                	sub    %edx,%eax
+  800e36:	c3                   	ret
+    if (!n) return 0;
+  800e37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e3c:	c3                   	ret
+
+0000000000800e3d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e3d:	0f b6 17             	movzbl (%rdi),%edx
+  800e40:	84 d2                	test   %dl,%dl
+  800e42:	74 18                	je     800e5c <strchr+0x1f>
+        if (*str == c) {
+  800e44:	0f be d2             	movsbl %dl,%edx
+  800e47:	39 f2                	cmp    %esi,%edx
+  800e49:	74 17                	je     800e62 <strchr+0x25>
+    for (; *str; str++) {
+  800e4b:	48 83 c7 01          	add    $0x1,%rdi
+  800e4f:	0f b6 17             	movzbl (%rdi),%edx
+  800e52:	84 d2                	test   %dl,%dl
+  800e54:	75 ee                	jne    800e44 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5b:	c3                   	ret
+  800e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e61:	c3                   	ret
+  800e62:	48 89 f8             	mov    %rdi,%rax
+}
+  800e65:	c3                   	ret
+
+0000000000800e66 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e66:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e69:	0f b6 17             	movzbl (%rdi),%edx
+  800e6c:	84 d2                	test   %dl,%dl
+  800e6e:	74 13                	je     800e83 <strfind+0x1d>
+  800e70:	0f be d2             	movsbl %dl,%edx
+  800e73:	39 f2                	cmp    %esi,%edx
+  800e75:	74 0b                	je     800e82 <strfind+0x1c>
+  800e77:	48 83 c0 01          	add    $0x1,%rax
+  800e7b:	0f b6 10             	movzbl (%rax),%edx
+  800e7e:	84 d2                	test   %dl,%dl
+  800e80:	75 ee                	jne    800e70 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e82:	c3                   	ret
+  800e83:	c3                   	ret
+
+0000000000800e84 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800e84:	55                   	push   %rbp
+  800e85:	48 89 e5             	mov    %rsp,%rbp
+  800e88:	41 57                	push   %r15
+  800e8a:	41 56                	push   %r14
+  800e8c:	41 55                	push   %r13
+  800e8e:	41 54                	push   %r12
+  800e90:	53                   	push   %rbx
+  800e91:	48 83 ec 08          	sub    $0x8,%rsp
+  800e95:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800e98:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800e9c:	45 84 ed             	test   %r13b,%r13b
+  800e9f:	75 12                	jne    800eb3 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800ea1:	4c 89 f8             	mov    %r15,%rax
+  800ea4:	48 83 c4 08          	add    $0x8,%rsp
+  800ea8:	5b                   	pop    %rbx
+  800ea9:	41 5c                	pop    %r12
+  800eab:	41 5d                	pop    %r13
+  800ead:	41 5e                	pop    %r14
+  800eaf:	41 5f                	pop    %r15
+  800eb1:	5d                   	pop    %rbp
+  800eb2:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800eb3:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800eb7:	4c 89 e7             	mov    %r12,%rdi
+  800eba:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  800ec1:	00 00 00 
+  800ec4:	ff d0                	call   *%rax
+  800ec6:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800ec9:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800ecd:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800ed1:	49 bf ff 0d 80 00 00 	movabs $0x800dff,%r15
+  800ed8:	00 00 00 
+				if ((sc = *s++) == 0)
+  800edb:	84 c0                	test   %al,%al
+  800edd:	75 14                	jne    800ef3 <strstr+0x6f>
+					return NULL;
+  800edf:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800ee5:	eb ba                	jmp    800ea1 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800ee7:	48 83 c3 01          	add    $0x1,%rbx
+  800eeb:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800eef:	84 c0                	test   %al,%al
+  800ef1:	74 1b                	je     800f0e <strstr+0x8a>
+			} while (sc != c);
+  800ef3:	41 38 c5             	cmp    %al,%r13b
+  800ef6:	75 ef                	jne    800ee7 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800ef8:	4c 89 f2             	mov    %r14,%rdx
+  800efb:	4c 89 e6             	mov    %r12,%rsi
+  800efe:	48 89 df             	mov    %rbx,%rdi
+  800f01:	41 ff d7             	call   *%r15
+  800f04:	85 c0                	test   %eax,%eax
+  800f06:	75 df                	jne    800ee7 <strstr+0x63>
+  800f08:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800f0c:	eb 93                	jmp    800ea1 <strstr+0x1d>
+					return NULL;
+  800f0e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800f14:	eb 8b                	jmp    800ea1 <strstr+0x1d>
+
+0000000000800f16 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800f16:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800f18:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800f1b:	8d 57 20             	lea    0x20(%rdi),%edx
+  800f1e:	83 f9 1a             	cmp    $0x1a,%ecx
+  800f21:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800f24:	c3                   	ret
+
+0000000000800f25 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800f25:	55                   	push   %rbp
+  800f26:	48 89 e5             	mov    %rsp,%rbp
+  800f29:	41 57                	push   %r15
+  800f2b:	41 56                	push   %r14
+  800f2d:	41 55                	push   %r13
+  800f2f:	41 54                	push   %r12
+  800f31:	53                   	push   %rbx
+  800f32:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800f36:	48 39 f7             	cmp    %rsi,%rdi
+  800f39:	74 49                	je     800f84 <strcasecmp+0x5f>
+  800f3b:	49 89 fd             	mov    %rdi,%r13
+  800f3e:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800f41:	49 bf 16 0f 80 00 00 	movabs $0x800f16,%r15
+  800f48:	00 00 00 
+  800f4b:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800f50:	41 0f b6 fe          	movzbl %r14b,%edi
+  800f54:	41 ff d7             	call   *%r15
+  800f57:	89 c3                	mov    %eax,%ebx
+  800f59:	49 83 c4 01          	add    $0x1,%r12
+  800f5d:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800f63:	41 ff d7             	call   *%r15
+  800f66:	29 c3                	sub    %eax,%ebx
+  800f68:	75 09                	jne    800f73 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800f6a:	49 83 c5 01          	add    $0x1,%r13
+  800f6e:	45 84 f6             	test   %r14b,%r14b
+  800f71:	75 d8                	jne    800f4b <strcasecmp+0x26>
+}
+  800f73:	89 d8                	mov    %ebx,%eax
+  800f75:	48 83 c4 08          	add    $0x8,%rsp
+  800f79:	5b                   	pop    %rbx
+  800f7a:	41 5c                	pop    %r12
+  800f7c:	41 5d                	pop    %r13
+  800f7e:	41 5e                	pop    %r14
+  800f80:	41 5f                	pop    %r15
+  800f82:	5d                   	pop    %rbp
+  800f83:	c3                   	ret
+        return 0;
+  800f84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f89:	eb e8                	jmp    800f73 <strcasecmp+0x4e>
+
+0000000000800f8b <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800f8b:	55                   	push   %rbp
+  800f8c:	48 89 e5             	mov    %rsp,%rbp
+  800f8f:	41 57                	push   %r15
+  800f91:	41 56                	push   %r14
+  800f93:	41 55                	push   %r13
+  800f95:	41 54                	push   %r12
+  800f97:	53                   	push   %rbx
+  800f98:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800f9c:	48 85 d2             	test   %rdx,%rdx
+  800f9f:	74 4f                	je     800ff0 <strncasecmp+0x65>
+  800fa1:	49 89 fc             	mov    %rdi,%r12
+  800fa4:	49 89 f5             	mov    %rsi,%r13
+  800fa7:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800fab:	49 be 16 0f 80 00 00 	movabs $0x800f16,%r14
+  800fb2:	00 00 00 
+  800fb5:	49 83 c4 01          	add    $0x1,%r12
+  800fb9:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800fbf:	41 ff d6             	call   *%r14
+  800fc2:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800fc4:	49 83 c5 01          	add    $0x1,%r13
+  800fc8:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800fcd:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800fd0:	29 c3                	sub    %eax,%ebx
+  800fd2:	85 c0                	test   %eax,%eax
+  800fd4:	74 09                	je     800fdf <strncasecmp+0x54>
+  800fd6:	85 db                	test   %ebx,%ebx
+  800fd8:	75 05                	jne    800fdf <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800fda:	4d 39 fc             	cmp    %r15,%r12
+  800fdd:	75 d6                	jne    800fb5 <strncasecmp+0x2a>
+}
+  800fdf:	89 d8                	mov    %ebx,%eax
+  800fe1:	48 83 c4 08          	add    $0x8,%rsp
+  800fe5:	5b                   	pop    %rbx
+  800fe6:	41 5c                	pop    %r12
+  800fe8:	41 5d                	pop    %r13
+  800fea:	41 5e                	pop    %r14
+  800fec:	41 5f                	pop    %r15
+  800fee:	5d                   	pop    %rbp
+  800fef:	c3                   	ret
+    int d = 0;
+  800ff0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800ff5:	eb e8                	jmp    800fdf <strncasecmp+0x54>
+
+0000000000800ff7 <toupper>:
+
+int toupper(int c) {
+  800ff7:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800ff9:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800ffc:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800fff:	83 f9 1a             	cmp    $0x1a,%ecx
+  801002:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801005:	c3                   	ret
+
+0000000000801006 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  801006:	83 ff 20             	cmp    $0x20,%edi
+  801009:	0f 94 c0             	sete   %al
+  80100c:	0f b6 c0             	movzbl %al,%eax
+}
+  80100f:	c3                   	ret
+
+0000000000801010 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  801010:	89 f8                	mov    %edi,%eax
+  801012:	f7 d8                	neg    %eax
+  801014:	0f 48 c7             	cmovs  %edi,%eax
+}
+  801017:	c3                   	ret
+
+0000000000801018 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801018:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80101b:	48 89 f8             	mov    %rdi,%rax
+  80101e:	48 f7 d8             	neg    %rax
+  801021:	83 e0 07             	and    $0x7,%eax
+  801024:	49 89 d1             	mov    %rdx,%r9
+  801027:	49 29 c1             	sub    %rax,%r9
+  80102a:	78 36                	js     801062 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80102c:	40 0f b6 c6          	movzbl %sil,%eax
+  801030:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801037:	01 01 01 
+  80103a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80103e:	40 f6 c7 07          	test   $0x7,%dil
+  801042:	75 38                	jne    80107c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801044:	4c 89 c9             	mov    %r9,%rcx
+  801047:	48 c1 f9 03          	sar    $0x3,%rcx
+  80104b:	74 0c                	je     801059 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80104d:	fc                   	cld
+  80104e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801051:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801055:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801059:	4d 85 c9             	test   %r9,%r9
+  80105c:	75 45                	jne    8010a3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80105e:	4c 89 c0             	mov    %r8,%rax
+  801061:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801062:	48 85 d2             	test   %rdx,%rdx
+  801065:	74 f7                	je     80105e <memset+0x46>
+  801067:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80106a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80106d:	48 83 c0 01          	add    $0x1,%rax
+  801071:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801075:	48 39 c2             	cmp    %rax,%rdx
+  801078:	75 f3                	jne    80106d <memset+0x55>
+  80107a:	eb e2                	jmp    80105e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80107c:	40 f6 c7 01          	test   $0x1,%dil
+  801080:	74 06                	je     801088 <memset+0x70>
+  801082:	88 07                	mov    %al,(%rdi)
+  801084:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801088:	40 f6 c7 02          	test   $0x2,%dil
+  80108c:	74 07                	je     801095 <memset+0x7d>
+  80108e:	66 89 07             	mov    %ax,(%rdi)
+  801091:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801095:	40 f6 c7 04          	test   $0x4,%dil
+  801099:	74 a9                	je     801044 <memset+0x2c>
+  80109b:	89 07                	mov    %eax,(%rdi)
+  80109d:	48 83 c7 04          	add    $0x4,%rdi
+  8010a1:	eb a1                	jmp    801044 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010a3:	41 f6 c1 04          	test   $0x4,%r9b
+  8010a7:	74 06                	je     8010af <memset+0x97>
+  8010a9:	89 07                	mov    %eax,(%rdi)
+  8010ab:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010af:	41 f6 c1 02          	test   $0x2,%r9b
+  8010b3:	74 07                	je     8010bc <memset+0xa4>
+  8010b5:	66 89 07             	mov    %ax,(%rdi)
+  8010b8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010bc:	41 f6 c1 01          	test   $0x1,%r9b
+  8010c0:	74 9c                	je     80105e <memset+0x46>
+  8010c2:	88 07                	mov    %al,(%rdi)
+  8010c4:	eb 98                	jmp    80105e <memset+0x46>
+
+00000000008010c6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010c6:	48 89 f8             	mov    %rdi,%rax
+  8010c9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010cc:	48 39 fe             	cmp    %rdi,%rsi
+  8010cf:	73 3b                	jae    80110c <memmove+0x46>
+  8010d1:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010d5:	48 39 d7             	cmp    %rdx,%rdi
+  8010d8:	73 32                	jae    80110c <memmove+0x46>
+        s += n;
+        d += n;
+  8010da:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010de:	48 89 d6             	mov    %rdx,%rsi
+  8010e1:	48 09 fe             	or     %rdi,%rsi
+  8010e4:	48 09 ce             	or     %rcx,%rsi
+  8010e7:	40 f6 c6 07          	test   $0x7,%sil
+  8010eb:	75 12                	jne    8010ff <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010ed:	48 83 ef 08          	sub    $0x8,%rdi
+  8010f1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010f5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010f9:	fd                   	std
+  8010fa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010fd:	fc                   	cld
+  8010fe:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010ff:	48 83 ef 01          	sub    $0x1,%rdi
+  801103:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801107:	fd                   	std
+  801108:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80110a:	eb f1                	jmp    8010fd <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80110c:	48 89 f2             	mov    %rsi,%rdx
+  80110f:	48 09 c2             	or     %rax,%rdx
+  801112:	48 09 ca             	or     %rcx,%rdx
+  801115:	f6 c2 07             	test   $0x7,%dl
+  801118:	75 0c                	jne    801126 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80111a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80111e:	48 89 c7             	mov    %rax,%rdi
+  801121:	fc                   	cld
+  801122:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801125:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801126:	48 89 c7             	mov    %rax,%rdi
+  801129:	fc                   	cld
+  80112a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80112c:	c3                   	ret
+
+000000000080112d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80112d:	55                   	push   %rbp
+  80112e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801131:	48 b8 c6 10 80 00 00 	movabs $0x8010c6,%rax
+  801138:	00 00 00 
+  80113b:	ff d0                	call   *%rax
+}
+  80113d:	5d                   	pop    %rbp
+  80113e:	c3                   	ret
+
+000000000080113f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80113f:	55                   	push   %rbp
+  801140:	48 89 e5             	mov    %rsp,%rbp
+  801143:	41 57                	push   %r15
+  801145:	41 56                	push   %r14
+  801147:	41 55                	push   %r13
+  801149:	41 54                	push   %r12
+  80114b:	53                   	push   %rbx
+  80114c:	48 83 ec 08          	sub    $0x8,%rsp
+  801150:	49 89 fe             	mov    %rdi,%r14
+  801153:	49 89 f7             	mov    %rsi,%r15
+  801156:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801159:	48 89 f7             	mov    %rsi,%rdi
+  80115c:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  801163:	00 00 00 
+  801166:	ff d0                	call   *%rax
+  801168:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80116b:	48 89 de             	mov    %rbx,%rsi
+  80116e:	4c 89 f7             	mov    %r14,%rdi
+  801171:	48 b8 15 0d 80 00 00 	movabs $0x800d15,%rax
+  801178:	00 00 00 
+  80117b:	ff d0                	call   *%rax
+  80117d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801180:	48 39 c3             	cmp    %rax,%rbx
+  801183:	74 36                	je     8011bb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801185:	48 89 d8             	mov    %rbx,%rax
+  801188:	4c 29 e8             	sub    %r13,%rax
+  80118b:	49 39 c4             	cmp    %rax,%r12
+  80118e:	73 31                	jae    8011c1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801190:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801195:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801199:	4c 89 fe             	mov    %r15,%rsi
+  80119c:	48 b8 2d 11 80 00 00 	movabs $0x80112d,%rax
+  8011a3:	00 00 00 
+  8011a6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011a8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011ac:	48 83 c4 08          	add    $0x8,%rsp
+  8011b0:	5b                   	pop    %rbx
+  8011b1:	41 5c                	pop    %r12
+  8011b3:	41 5d                	pop    %r13
+  8011b5:	41 5e                	pop    %r14
+  8011b7:	41 5f                	pop    %r15
+  8011b9:	5d                   	pop    %rbp
+  8011ba:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011bb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011bf:	eb eb                	jmp    8011ac <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011c1:	48 83 eb 01          	sub    $0x1,%rbx
+  8011c5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011c9:	48 89 da             	mov    %rbx,%rdx
+  8011cc:	4c 89 fe             	mov    %r15,%rsi
+  8011cf:	48 b8 2d 11 80 00 00 	movabs $0x80112d,%rax
+  8011d6:	00 00 00 
+  8011d9:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011db:	49 01 de             	add    %rbx,%r14
+  8011de:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011e3:	eb c3                	jmp    8011a8 <strlcat+0x69>
+
+00000000008011e5 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011e5:	48 85 d2             	test   %rdx,%rdx
+  8011e8:	74 2d                	je     801217 <memcmp+0x32>
+  8011ea:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011ef:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011f3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011f8:	44 38 c1             	cmp    %r8b,%cl
+  8011fb:	75 0f                	jne    80120c <memcmp+0x27>
+    while (n-- > 0) {
+  8011fd:	48 83 c0 01          	add    $0x1,%rax
+  801201:	48 39 c2             	cmp    %rax,%rdx
+  801204:	75 e9                	jne    8011ef <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80120c:	0f b6 c1             	movzbl %cl,%eax
+  80120f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801213:	44 29 c0             	sub    %r8d,%eax
+  801216:	c3                   	ret
+    return 0;
+  801217:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80121c:	c3                   	ret
+
+000000000080121d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80121d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801221:	48 39 c7             	cmp    %rax,%rdi
+  801224:	73 0f                	jae    801235 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801226:	40 38 37             	cmp    %sil,(%rdi)
+  801229:	74 0e                	je     801239 <memfind+0x1c>
+    for (; src < end; src++) {
+  80122b:	48 83 c7 01          	add    $0x1,%rdi
+  80122f:	48 39 f8             	cmp    %rdi,%rax
+  801232:	75 f2                	jne    801226 <memfind+0x9>
+  801234:	c3                   	ret
+  801235:	48 89 f8             	mov    %rdi,%rax
+  801238:	c3                   	ret
+  801239:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80123c:	c3                   	ret
+
+000000000080123d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80123d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801240:	0f b6 37             	movzbl (%rdi),%esi
+  801243:	40 80 fe 20          	cmp    $0x20,%sil
+  801247:	74 06                	je     80124f <strtol+0x12>
+  801249:	40 80 fe 09          	cmp    $0x9,%sil
+  80124d:	75 13                	jne    801262 <strtol+0x25>
+  80124f:	48 83 c7 01          	add    $0x1,%rdi
+  801253:	0f b6 37             	movzbl (%rdi),%esi
+  801256:	40 80 fe 20          	cmp    $0x20,%sil
+  80125a:	74 f3                	je     80124f <strtol+0x12>
+  80125c:	40 80 fe 09          	cmp    $0x9,%sil
+  801260:	74 ed                	je     80124f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801262:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801265:	83 e0 fd             	and    $0xfffffffd,%eax
+  801268:	3c 01                	cmp    $0x1,%al
+  80126a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80126e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801274:	75 0f                	jne    801285 <strtol+0x48>
+  801276:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801279:	74 14                	je     80128f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80127b:	85 d2                	test   %edx,%edx
+  80127d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801282:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801285:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80128a:	4c 63 ca             	movslq %edx,%r9
+  80128d:	eb 36                	jmp    8012c5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80128f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801293:	74 0f                	je     8012a4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801295:	85 d2                	test   %edx,%edx
+  801297:	75 ec                	jne    801285 <strtol+0x48>
+        s++;
+  801299:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80129d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012a2:	eb e1                	jmp    801285 <strtol+0x48>
+        s += 2;
+  8012a4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012a8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012ad:	eb d6                	jmp    801285 <strtol+0x48>
+            dig -= '0';
+  8012af:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012b2:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012b6:	41 39 d0             	cmp    %edx,%r8d
+  8012b9:	7d 21                	jge    8012dc <strtol+0x9f>
+        val = val * base + dig;
+  8012bb:	49 0f af c1          	imul   %r9,%rax
+  8012bf:	0f b6 c9             	movzbl %cl,%ecx
+  8012c2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012c5:	48 83 c7 01          	add    $0x1,%rdi
+  8012c9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012cd:	80 f9 39             	cmp    $0x39,%cl
+  8012d0:	76 dd                	jbe    8012af <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012d2:	80 f9 7b             	cmp    $0x7b,%cl
+  8012d5:	77 05                	ja     8012dc <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012d7:	83 e9 57             	sub    $0x57,%ecx
+  8012da:	eb d6                	jmp    8012b2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012dc:	4d 85 d2             	test   %r10,%r10
+  8012df:	74 03                	je     8012e4 <strtol+0xa7>
+  8012e1:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012e4:	48 89 c2             	mov    %rax,%rdx
+  8012e7:	48 f7 da             	neg    %rdx
+  8012ea:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012ee:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012f2:	c3                   	ret
+
+00000000008012f3 <atoi>:
+int atoi(const char *str) {
+  8012f3:	55                   	push   %rbp
+  8012f4:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8012f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801301:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  801308:	00 00 00 
+  80130b:	ff d0                	call   *%rax
+}
+  80130d:	5d                   	pop    %rbp
+  80130e:	c3                   	ret
+
+000000000080130f <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80130f:	55                   	push   %rbp
+  801310:	48 89 e5             	mov    %rsp,%rbp
+  801313:	53                   	push   %rbx
+  801314:	48 89 fa             	mov    %rdi,%rdx
+  801317:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80131a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801324:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801329:	be 00 00 00 00       	mov    $0x0,%esi
+  80132e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801334:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801336:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133a:	c9                   	leave
+  80133b:	c3                   	ret
+
+000000000080133c <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80133c:	55                   	push   %rbp
+  80133d:	48 89 e5             	mov    %rsp,%rbp
+  801340:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801341:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801346:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801350:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801355:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80135a:	be 00 00 00 00       	mov    $0x0,%esi
+  80135f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801365:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801367:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136b:	c9                   	leave
+  80136c:	c3                   	ret
+
+000000000080136d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80136d:	55                   	push   %rbp
+  80136e:	48 89 e5             	mov    %rsp,%rbp
+  801371:	53                   	push   %rbx
+  801372:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801376:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801379:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80137e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801383:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801388:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138d:	be 00 00 00 00       	mov    $0x0,%esi
+  801392:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801398:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80139a:	48 85 c0             	test   %rax,%rax
+  80139d:	7f 06                	jg     8013a5 <sys_env_destroy+0x38>
+}
+  80139f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a3:	c9                   	leave
+  8013a4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a5:	49 89 c0             	mov    %rax,%r8
+  8013a8:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013ad:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8013b4:	00 00 00 
+  8013b7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013bc:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8013c3:	00 00 00 
+  8013c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cb:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8013d2:	00 00 00 
+  8013d5:	41 ff d1             	call   *%r9
+
+00000000008013d8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013d8:	55                   	push   %rbp
+  8013d9:	48 89 e5             	mov    %rsp,%rbp
+  8013dc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013dd:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801401:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801403:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801407:	c9                   	leave
+  801408:	c3                   	ret
+
+0000000000801409 <sys_yield>:
+
+void
+sys_yield(void) {
+  801409:	55                   	push   %rbp
+  80140a:	48 89 e5             	mov    %rsp,%rbp
+  80140d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80140e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801413:	ba 00 00 00 00       	mov    $0x0,%edx
+  801418:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80141d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801422:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801427:	be 00 00 00 00       	mov    $0x0,%esi
+  80142c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801432:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801434:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801438:	c9                   	leave
+  801439:	c3                   	ret
+
+000000000080143a <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80143a:	55                   	push   %rbp
+  80143b:	48 89 e5             	mov    %rsp,%rbp
+  80143e:	53                   	push   %rbx
+  80143f:	48 89 fa             	mov    %rdi,%rdx
+  801442:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801445:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80144a:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801451:	00 00 00 
+  801454:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801459:	be 00 00 00 00       	mov    $0x0,%esi
+  80145e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801464:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801466:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146a:	c9                   	leave
+  80146b:	c3                   	ret
+
+000000000080146c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80146c:	55                   	push   %rbp
+  80146d:	48 89 e5             	mov    %rsp,%rbp
+  801470:	53                   	push   %rbx
+  801471:	49 89 f8             	mov    %rdi,%r8
+  801474:	48 89 d3             	mov    %rdx,%rbx
+  801477:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80147a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147f:	4c 89 c2             	mov    %r8,%rdx
+  801482:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801485:	be 00 00 00 00       	mov    $0x0,%esi
+  80148a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801490:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801492:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+
+0000000000801498 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801498:	55                   	push   %rbp
+  801499:	48 89 e5             	mov    %rsp,%rbp
+  80149c:	53                   	push   %rbx
+  80149d:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a1:	89 f8                	mov    %edi,%eax
+  8014a3:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014a6:	48 63 f9             	movslq %ecx,%rdi
+  8014a9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ac:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b1:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c1:	48 85 c0             	test   %rax,%rax
+  8014c4:	7f 06                	jg     8014cc <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ca:	c9                   	leave
+  8014cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014cc:	49 89 c0             	mov    %rax,%r8
+  8014cf:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014d4:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8014db:	00 00 00 
+  8014de:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014e3:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8014ea:	00 00 00 
+  8014ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f2:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8014f9:	00 00 00 
+  8014fc:	41 ff d1             	call   *%r9
+
+00000000008014ff <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014ff:	55                   	push   %rbp
+  801500:	48 89 e5             	mov    %rsp,%rbp
+  801503:	53                   	push   %rbx
+  801504:	48 83 ec 08          	sub    $0x8,%rsp
+  801508:	89 f8                	mov    %edi,%eax
+  80150a:	49 89 f2             	mov    %rsi,%r10
+  80150d:	48 89 cf             	mov    %rcx,%rdi
+  801510:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801513:	48 63 da             	movslq %edx,%rbx
+  801516:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801519:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80151e:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801521:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801524:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801526:	48 85 c0             	test   %rax,%rax
+  801529:	7f 06                	jg     801531 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80152b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152f:	c9                   	leave
+  801530:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801531:	49 89 c0             	mov    %rax,%r8
+  801534:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801539:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801540:	00 00 00 
+  801543:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801548:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80154f:	00 00 00 
+  801552:	b8 00 00 00 00       	mov    $0x0,%eax
+  801557:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  80155e:	00 00 00 
+  801561:	41 ff d1             	call   *%r9
+
+0000000000801564 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801564:	55                   	push   %rbp
+  801565:	48 89 e5             	mov    %rsp,%rbp
+  801568:	53                   	push   %rbx
+  801569:	48 83 ec 08          	sub    $0x8,%rsp
+  80156d:	49 89 f9             	mov    %rdi,%r9
+  801570:	89 f0                	mov    %esi,%eax
+  801572:	48 89 d3             	mov    %rdx,%rbx
+  801575:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801578:	49 63 f0             	movslq %r8d,%rsi
+  80157b:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80157e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801583:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801586:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80158e:	48 85 c0             	test   %rax,%rax
+  801591:	7f 06                	jg     801599 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801593:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801597:	c9                   	leave
+  801598:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801599:	49 89 c0             	mov    %rax,%r8
+  80159c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015a1:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8015a8:	00 00 00 
+  8015ab:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015b0:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8015b7:	00 00 00 
+  8015ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bf:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8015c6:	00 00 00 
+  8015c9:	41 ff d1             	call   *%r9
+
+00000000008015cc <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8015cc:	55                   	push   %rbp
+  8015cd:	48 89 e5             	mov    %rsp,%rbp
+  8015d0:	53                   	push   %rbx
+  8015d1:	89 f8                	mov    %edi,%eax
+  8015d3:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8015d6:	48 63 f9             	movslq %ecx,%rdi
+  8015d9:	48 63 da             	movslq %edx,%rbx
+  8015dc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015df:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f2:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8015f4:	89 c2                	mov    %eax,%edx
+  8015f6:	48 85 c0             	test   %rax,%rax
+  8015f9:	78 0d                	js     801608 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8015fb:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801600:	4d 85 c9             	test   %r9,%r9
+  801603:	74 03                	je     801608 <sys_alloc_dma_region+0x3c>
+  801605:	49 89 01             	mov    %rax,(%r9)
+}
+  801608:	89 d0                	mov    %edx,%eax
+  80160a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80160e:	c9                   	leave
+  80160f:	c3                   	ret
+
+0000000000801610 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801610:	55                   	push   %rbp
+  801611:	48 89 e5             	mov    %rsp,%rbp
+  801614:	53                   	push   %rbx
+  801615:	48 83 ec 08          	sub    $0x8,%rsp
+  801619:	48 89 f1             	mov    %rsi,%rcx
+  80161c:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80161f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801622:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801627:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162c:	be 00 00 00 00       	mov    $0x0,%esi
+  801631:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801637:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801639:	48 85 c0             	test   %rax,%rax
+  80163c:	7f 06                	jg     801644 <sys_set_cache_region+0x34>
+}
+  80163e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801642:	c9                   	leave
+  801643:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801644:	49 89 c0             	mov    %rax,%r8
+  801647:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80164c:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801653:	00 00 00 
+  801656:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80165b:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801662:	00 00 00 
+  801665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166a:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  801671:	00 00 00 
+  801674:	41 ff d1             	call   *%r9
+
+0000000000801677 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801677:	55                   	push   %rbp
+  801678:	48 89 e5             	mov    %rsp,%rbp
+  80167b:	53                   	push   %rbx
+  80167c:	48 83 ec 08          	sub    $0x8,%rsp
+  801680:	48 89 f1             	mov    %rsi,%rcx
+  801683:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801686:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801689:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80168e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801693:	be 00 00 00 00       	mov    $0x0,%esi
+  801698:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016a0:	48 85 c0             	test   %rax,%rax
+  8016a3:	7f 06                	jg     8016ab <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8016a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a9:	c9                   	leave
+  8016aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ab:	49 89 c0             	mov    %rax,%r8
+  8016ae:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8016b3:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8016ba:	00 00 00 
+  8016bd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016c2:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8016c9:	00 00 00 
+  8016cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d1:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8016d8:	00 00 00 
+  8016db:	41 ff d1             	call   *%r9
+
+00000000008016de <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8016de:	55                   	push   %rbp
+  8016df:	48 89 e5             	mov    %rsp,%rbp
+  8016e2:	53                   	push   %rbx
+  8016e3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8016e7:	48 63 ce             	movslq %esi,%rcx
+  8016ea:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ed:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801701:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801707:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801709:	48 85 c0             	test   %rax,%rax
+  80170c:	7f 06                	jg     801714 <sys_env_set_status+0x36>
+}
+  80170e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801712:	c9                   	leave
+  801713:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801714:	49 89 c0             	mov    %rax,%r8
+  801717:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80171c:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801723:	00 00 00 
+  801726:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80172b:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801732:	00 00 00 
+  801735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173a:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  801741:	00 00 00 
+  801744:	41 ff d1             	call   *%r9
+
+0000000000801747 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801747:	55                   	push   %rbp
+  801748:	48 89 e5             	mov    %rsp,%rbp
+  80174b:	53                   	push   %rbx
+  80174c:	48 83 ec 08          	sub    $0x8,%rsp
+  801750:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801753:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801756:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80175b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801760:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801765:	be 00 00 00 00       	mov    $0x0,%esi
+  80176a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801770:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801772:	48 85 c0             	test   %rax,%rax
+  801775:	7f 06                	jg     80177d <sys_env_set_trapframe+0x36>
+}
+  801777:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177b:	c9                   	leave
+  80177c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80177d:	49 89 c0             	mov    %rax,%r8
+  801780:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801785:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  80178c:	00 00 00 
+  80178f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801794:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80179b:	00 00 00 
+  80179e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a3:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8017aa:	00 00 00 
+  8017ad:	41 ff d1             	call   *%r9
+
+00000000008017b0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017b0:	55                   	push   %rbp
+  8017b1:	48 89 e5             	mov    %rsp,%rbp
+  8017b4:	53                   	push   %rbx
+  8017b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8017b9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8017bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017bf:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017db:	48 85 c0             	test   %rax,%rax
+  8017de:	7f 06                	jg     8017e6 <sys_env_set_pgfault_upcall+0x36>
+}
+  8017e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e4:	c9                   	leave
+  8017e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e6:	49 89 c0             	mov    %rax,%r8
+  8017e9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8017ee:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8017f5:	00 00 00 
+  8017f8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017fd:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801804:	00 00 00 
+  801807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180c:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  801813:	00 00 00 
+  801816:	41 ff d1             	call   *%r9
+
+0000000000801819 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801819:	55                   	push   %rbp
+  80181a:	48 89 e5             	mov    %rsp,%rbp
+  80181d:	53                   	push   %rbx
+  80181e:	89 f8                	mov    %edi,%eax
+  801820:	49 89 f1             	mov    %rsi,%r9
+  801823:	48 89 d3             	mov    %rdx,%rbx
+  801826:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801829:	49 63 f0             	movslq %r8d,%rsi
+  80182c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80182f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801834:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801837:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80183d:	cd 30                	int    $0x30
+}
+  80183f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801843:	c9                   	leave
+  801844:	c3                   	ret
+
+0000000000801845 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801845:	55                   	push   %rbp
+  801846:	48 89 e5             	mov    %rsp,%rbp
+  801849:	53                   	push   %rbx
+  80184a:	48 83 ec 08          	sub    $0x8,%rsp
+  80184e:	48 89 fa             	mov    %rdi,%rdx
+  801851:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801854:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801859:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801863:	be 00 00 00 00       	mov    $0x0,%esi
+  801868:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80186e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801870:	48 85 c0             	test   %rax,%rax
+  801873:	7f 06                	jg     80187b <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801875:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801879:	c9                   	leave
+  80187a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80187b:	49 89 c0             	mov    %rax,%r8
+  80187e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801883:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  80188a:	00 00 00 
+  80188d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801892:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801899:	00 00 00 
+  80189c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a1:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8018a8:	00 00 00 
+  8018ab:	41 ff d1             	call   *%r9
+
+00000000008018ae <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8018ae:	55                   	push   %rbp
+  8018af:	48 89 e5             	mov    %rsp,%rbp
+  8018b2:	53                   	push   %rbx
+  8018b3:	48 89 fa             	mov    %rdi,%rdx
+  8018b6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018d3:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d9:	c9                   	leave
+  8018da:	c3                   	ret
+
+00000000008018db <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8018db:	55                   	push   %rbp
+  8018dc:	48 89 e5             	mov    %rsp,%rbp
+  8018df:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018e0:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8018fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801904:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801906:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80190a:	c9                   	leave
+  80190b:	c3                   	ret
+
+000000000080190c <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80190c:	48 85 ff             	test   %rdi,%rdi
+  80190f:	0f 84 b6 01 00 00    	je     801acb <malloc+0x1bf>
+malloc(size_t size) {
+  801915:	55                   	push   %rbp
+  801916:	48 89 e5             	mov    %rsp,%rbp
+  801919:	41 56                	push   %r14
+  80191b:	41 55                	push   %r13
+  80191d:	41 54                	push   %r12
+  80191f:	53                   	push   %rbx
+  801920:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801923:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80192a:	00 00 00 
+  80192d:	4c 8b 20             	mov    (%rax),%r12
+  801930:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801937:	0f 87 94 01 00 00    	ja     801ad1 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  80193d:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801944:	00 00 00 
+  801947:	48 85 c0             	test   %rax,%rax
+  80194a:	74 6b                	je     8019b7 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80194c:	4d 85 e4             	test   %r12,%r12
+  80194f:	74 66                	je     8019b7 <malloc+0xab>
+  801951:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801958:	00 00 00 
+  80195b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801960:	eb 0d                	jmp    80196f <malloc+0x63>
+  801962:	48 83 c1 01          	add    $0x1,%rcx
+  801966:	48 83 c2 18          	add    $0x18,%rdx
+  80196a:	49 39 cc             	cmp    %rcx,%r12
+  80196d:	74 48                	je     8019b7 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80196f:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801974:	74 ec                	je     801962 <malloc+0x56>
+  801976:	48 39 1a             	cmp    %rbx,(%rdx)
+  801979:	72 e7                	jb     801962 <malloc+0x56>
+                real_freep_size--;
+  80197b:	48 83 e8 01          	sub    $0x1,%rax
+  80197f:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801986:	00 00 00 
+                freep[i].is_free = false;
+  801989:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801990:	00 00 00 
+  801993:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801997:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  80199b:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  80199f:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8019a6:	00 
+                freep[i].size = size;
+  8019a7:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8019ab:	48 01 c8             	add    %rcx,%rax
+  8019ae:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019b2:	e9 0b 01 00 00       	jmp    801ac2 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8019b7:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8019be:	00 00 00 
+  8019c1:	48 01 d8             	add    %rbx,%rax
+  8019c4:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8019ca:	76 7c                	jbe    801a48 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8019cc:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8019d3:	00 00 00 
+  8019d6:	4c 8b 30             	mov    (%rax),%r14
+  8019d9:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8019e0:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8019e3:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8019ea:	00 00 00 
+  8019ed:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8019f4:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8019fb:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801a01:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801a05:	48 b8 d8 13 80 00 00 	movabs $0x8013d8,%rax
+  801a0c:	00 00 00 
+  801a0f:	ff d0                	call   *%rax
+  801a11:	89 c7                	mov    %eax,%edi
+  801a13:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801a1a:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801a21:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801a28:	00 00 00 
+  801a2b:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801a2f:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801a34:	48 b8 98 14 80 00 00 	movabs $0x801498,%rax
+  801a3b:	00 00 00 
+  801a3e:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801a40:	85 c0                	test   %eax,%eax
+  801a42:	0f 88 90 00 00 00    	js     801ad8 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801a48:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801a4f:	00 00 00 
+  801a52:	48 8b 31             	mov    (%rcx),%rsi
+  801a55:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801a5c:	00 00 00 
+  801a5f:	4c 8b 07             	mov    (%rdi),%r8
+  801a62:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801a66:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801a6d:	00 00 00 
+  801a70:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801a74:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801a78:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801a7f:	00 00 00 
+  801a82:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801a86:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801a89:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801a8d:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801a94:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801a95:	48 89 d8             	mov    %rbx,%rax
+  801a98:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a9d:	4c 01 c0             	add    %r8,%rax
+  801aa0:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801aa3:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801aaa:	48 01 f3             	add    %rsi,%rbx
+  801aad:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801ab0:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801ab5:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801abc:	00 00 00 
+  801abf:	48 89 d0             	mov    %rdx,%rax
+}
+  801ac2:	5b                   	pop    %rbx
+  801ac3:	41 5c                	pop    %r12
+  801ac5:	41 5d                	pop    %r13
+  801ac7:	41 5e                	pop    %r14
+  801ac9:	5d                   	pop    %rbp
+  801aca:	c3                   	ret
+        return NULL;
+  801acb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ad0:	c3                   	ret
+        return NULL;
+  801ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad6:	eb ea                	jmp    801ac2 <malloc+0x1b6>
+            return NULL;
+  801ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801add:	eb e3                	jmp    801ac2 <malloc+0x1b6>
+
+0000000000801adf <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801adf:	55                   	push   %rbp
+  801ae0:	48 89 e5             	mov    %rsp,%rbp
+  801ae3:	53                   	push   %rbx
+  801ae4:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801ae8:	48 89 fb             	mov    %rdi,%rbx
+  801aeb:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801aef:	48 89 df             	mov    %rbx,%rdi
+  801af2:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  801af9:	00 00 00 
+  801afc:	ff d0                	call   *%rax
+  801afe:	48 89 c7             	mov    %rax,%rdi
+  801b01:	48 89 da             	mov    %rbx,%rdx
+  801b04:	be 00 00 00 00       	mov    $0x0,%esi
+  801b09:	48 b8 18 10 80 00 00 	movabs $0x801018,%rax
+  801b10:	00 00 00 
+  801b13:	ff d0                	call   *%rax
+}
+  801b15:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b19:	c9                   	leave
+  801b1a:	c3                   	ret
+
+0000000000801b1b <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801b1b:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801b22:	00 00 00 
+  801b25:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801b2c:	00 00 00 
+  801b2f:	48 3b 02             	cmp    (%rdx),%rax
+  801b32:	74 4d                	je     801b81 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801b34:	48 85 c0             	test   %rax,%rax
+  801b37:	74 4d                	je     801b86 <get_allocsize+0x6b>
+  801b39:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801b40:	00 00 00 
+  801b43:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801b48:	48 3b 39             	cmp    (%rcx),%rdi
+  801b4b:	74 13                	je     801b60 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801b4d:	48 83 c2 01          	add    $0x1,%rdx
+  801b51:	48 83 c1 18          	add    $0x18,%rcx
+  801b55:	48 39 d0             	cmp    %rdx,%rax
+  801b58:	75 ee                	jne    801b48 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5f:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801b60:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b69:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801b70:	00 00 00 
+  801b73:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b79:	75 0b                	jne    801b86 <get_allocsize+0x6b>
+  801b7b:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801b80:	c3                   	ret
+        return 0;
+  801b81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b86:	c3                   	ret
+
+0000000000801b87 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801b87:	48 85 ff             	test   %rdi,%rdi
+  801b8a:	0f 84 01 01 00 00    	je     801c91 <free+0x10a>
+free(void *ptr) {
+  801b90:	55                   	push   %rbp
+  801b91:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801b94:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801b9b:	00 00 00 
+  801b9e:	48 8b 30             	mov    (%rax),%rsi
+  801ba1:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801ba8:	00 00 00 
+  801bab:	48 39 c6             	cmp    %rax,%rsi
+  801bae:	74 50                	je     801c00 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801bb0:	48 85 f6             	test   %rsi,%rsi
+  801bb3:	74 21                	je     801bd6 <free+0x4f>
+  801bb5:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801bbc:	00 00 00 
+  801bbf:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801bc4:	48 3b 39             	cmp    (%rcx),%rdi
+  801bc7:	74 61                	je     801c2a <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801bc9:	48 83 c2 01          	add    $0x1,%rdx
+  801bcd:	48 83 c1 18          	add    $0x18,%rcx
+  801bd1:	48 39 d6             	cmp    %rdx,%rsi
+  801bd4:	75 ee                	jne    801bc4 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801bd6:	48 ba 10 56 80 00 00 	movabs $0x805610,%rdx
+  801bdd:	00 00 00 
+  801be0:	be 12 01 00 00       	mov    $0x112,%esi
+  801be5:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801bec:	00 00 00 
+  801bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf4:	48 b9 70 02 80 00 00 	movabs $0x800270,%rcx
+  801bfb:	00 00 00 
+  801bfe:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801c00:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801c07:	00 00 00 
+  801c0a:	be 06 01 00 00       	mov    $0x106,%esi
+  801c0f:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801c16:	00 00 00 
+  801c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1e:	48 b9 70 02 80 00 00 	movabs $0x800270,%rcx
+  801c25:	00 00 00 
+  801c28:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801c2a:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c2e:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801c35:	00 00 00 
+  801c38:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801c3e:	75 27                	jne    801c67 <free+0xe0>
+            freep[i].is_free = true;
+  801c40:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c44:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801c4b:	00 00 00 
+  801c4e:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801c55:	00 00 
+            real_freep_size++;
+  801c57:	48 83 c0 01          	add    $0x1,%rax
+  801c5b:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801c62:	00 00 00 
+}
+  801c65:	5d                   	pop    %rbp
+  801c66:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801c67:	48 ba e8 55 80 00 00 	movabs $0x8055e8,%rdx
+  801c6e:	00 00 00 
+  801c71:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801c76:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801c7d:	00 00 00 
+  801c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c85:	48 b9 70 02 80 00 00 	movabs $0x800270,%rcx
+  801c8c:	00 00 00 
+  801c8f:	ff d1                	call   *%rcx
+  801c91:	c3                   	ret
+
+0000000000801c92 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801c92:	55                   	push   %rbp
+  801c93:	48 89 e5             	mov    %rsp,%rbp
+  801c96:	41 55                	push   %r13
+  801c98:	41 54                	push   %r12
+  801c9a:	53                   	push   %rbx
+  801c9b:	48 83 ec 08          	sub    $0x8,%rsp
+  801c9f:	48 89 fb             	mov    %rdi,%rbx
+  801ca2:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801ca5:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  801cac:	00 00 00 
+  801caf:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801cb1:	49 39 c5             	cmp    %rax,%r13
+  801cb4:	73 0e                	jae    801cc4 <realloc+0x32>
+}
+  801cb6:	48 89 d8             	mov    %rbx,%rax
+  801cb9:	48 83 c4 08          	add    $0x8,%rsp
+  801cbd:	5b                   	pop    %rbx
+  801cbe:	41 5c                	pop    %r12
+  801cc0:	41 5d                	pop    %r13
+  801cc2:	5d                   	pop    %rbp
+  801cc3:	c3                   	ret
+  801cc4:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801cc7:	4c 89 ef             	mov    %r13,%rdi
+  801cca:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  801cd1:	00 00 00 
+  801cd4:	ff d0                	call   *%rax
+  801cd6:	48 89 c7             	mov    %rax,%rdi
+  801cd9:	4c 89 e2             	mov    %r12,%rdx
+  801cdc:	48 89 de             	mov    %rbx,%rsi
+  801cdf:	48 b8 2d 11 80 00 00 	movabs $0x80112d,%rax
+  801ce6:	00 00 00 
+  801ce9:	ff d0                	call   *%rax
+  801ceb:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801cee:	48 89 df             	mov    %rbx,%rdi
+  801cf1:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  801cf8:	00 00 00 
+  801cfb:	ff d0                	call   *%rax
+    return newptr;
+  801cfd:	4c 89 e3             	mov    %r12,%rbx
+  801d00:	eb b4                	jmp    801cb6 <realloc+0x24>
+
+0000000000801d02 <strdup>:
+
+char*
+strdup (const char *src) {
+  801d02:	55                   	push   %rbp
+  801d03:	48 89 e5             	mov    %rsp,%rbp
+  801d06:	41 54                	push   %r12
+  801d08:	53                   	push   %rbx
+  801d09:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801d0c:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  801d13:	00 00 00 
+  801d16:	ff d0                	call   *%rax
+  801d18:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801d1c:	4c 89 e7             	mov    %r12,%rdi
+  801d1f:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  801d26:	00 00 00 
+  801d29:	ff d0                	call   *%rax
+  801d2b:	48 89 c7             	mov    %rax,%rdi
+  801d2e:	4c 89 e2             	mov    %r12,%rdx
+  801d31:	48 89 de             	mov    %rbx,%rsi
+  801d34:	48 b8 2d 11 80 00 00 	movabs $0x80112d,%rax
+  801d3b:	00 00 00 
+  801d3e:	ff d0                	call   *%rax
+}
+  801d40:	5b                   	pop    %rbx
+  801d41:	41 5c                	pop    %r12
+  801d43:	5d                   	pop    %rbp
+  801d44:	c3                   	ret
+
+0000000000801d45 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801d45:	55                   	push   %rbp
+  801d46:	48 89 e5             	mov    %rsp,%rbp
+  801d49:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d4a:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d54:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d5e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d63:	be 00 00 00 00       	mov    $0x0,%esi
+  801d68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d6e:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d74:	c9                   	leave
+  801d75:	c3                   	ret
+
+0000000000801d76 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801d76:	55                   	push   %rbp
+  801d77:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801d7a:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d81:	00 00 00 
+  801d84:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d88:	74 26                	je     801db0 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801d8a:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d8c:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d90:	89 c0                	mov    %eax,%eax
+  801d92:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801d95:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801d9c:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801da3:	00 00 00 
+  801da6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dab:	48 f7 31             	divq   (%rcx)
+}
+  801dae:	5d                   	pop    %rbp
+  801daf:	c3                   	ret
+        freq = get_cpufreq();
+  801db0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db5:	48 ba 45 1d 80 00 00 	movabs $0x801d45,%rdx
+  801dbc:	00 00 00 
+  801dbf:	ff d2                	call   *%rdx
+  801dc1:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801dc8:	00 00 00 
+  801dcb:	eb bd                	jmp    801d8a <get_ticks+0x14>
+
+0000000000801dcd <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801dcd:	55                   	push   %rbp
+  801dce:	48 89 e5             	mov    %rsp,%rbp
+  801dd1:	53                   	push   %rbx
+  801dd2:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd6:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801dd9:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801de0:	00 00 00 
+  801de3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801de7:	74 50                	je     801e39 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801de9:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801deb:	48 c1 e2 20          	shl    $0x20,%rdx
+  801def:	89 c0                	mov    %eax,%eax
+  801df1:	48 89 d6             	mov    %rdx,%rsi
+  801df4:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801df7:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801dfe:	00 00 00 
+  801e01:	48 0f af 18          	imul   (%rax),%rbx
+  801e05:	48 c1 eb 03          	shr    $0x3,%rbx
+  801e09:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801e10:	9b c4 20 
+  801e13:	48 89 d8             	mov    %rbx,%rax
+  801e16:	48 f7 e2             	mul    %rdx
+  801e19:	48 89 d1             	mov    %rdx,%rcx
+  801e1c:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801e20:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801e22:	48 c1 e2 20          	shl    $0x20,%rdx
+  801e26:	89 c0                	mov    %eax,%eax
+  801e28:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801e2b:	48 29 f2             	sub    %rsi,%rdx
+  801e2e:	48 39 ca             	cmp    %rcx,%rdx
+  801e31:	72 ed                	jb     801e20 <sleep+0x53>
+}
+  801e33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e37:	c9                   	leave
+  801e38:	c3                   	ret
+        freq = get_cpufreq();
+  801e39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3e:	48 ba 45 1d 80 00 00 	movabs $0x801d45,%rdx
+  801e45:	00 00 00 
+  801e48:	ff d2                	call   *%rdx
+  801e4a:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801e51:	00 00 00 
+  801e54:	eb 93                	jmp    801de9 <sleep+0x1c>
+
+0000000000801e56 <poll_kbd>:
+
+int poll_kbd() {
+  801e56:	55                   	push   %rbp
+  801e57:	48 89 e5             	mov    %rsp,%rbp
+  801e5a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e5b:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e65:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e6f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e74:	be 00 00 00 00       	mov    $0x0,%esi
+  801e79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e7f:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e85:	c9                   	leave
+  801e86:	c3                   	ret
+
+0000000000801e87 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801e87:	55                   	push   %rbp
+  801e88:	48 89 e5             	mov    %rsp,%rbp
+  801e8b:	53                   	push   %rbx
+  801e8c:	49 89 fa             	mov    %rdi,%r10
+  801e8f:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801e91:	44 89 c6             	mov    %r8d,%esi
+  801e94:	89 cf                	mov    %ecx,%edi
+  801e96:	89 d3                	mov    %edx,%ebx
+  801e98:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801e9a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e9f:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ea2:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801ea6:	cd 30                	int    $0x30
+  801ea8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eac:	c9                   	leave
+  801ead:	c3                   	ret
+
+0000000000801eae <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801eae:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801eb5:	ff ff ff 
+  801eb8:	48 01 f8             	add    %rdi,%rax
+  801ebb:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ebf:	c3                   	ret
+
+0000000000801ec0 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ec0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ec7:	ff ff ff 
+  801eca:	48 01 f8             	add    %rdi,%rax
+  801ecd:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ed1:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801ed7:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801edb:	c3                   	ret
+
+0000000000801edc <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801edc:	55                   	push   %rbp
+  801edd:	48 89 e5             	mov    %rsp,%rbp
+  801ee0:	41 57                	push   %r15
+  801ee2:	41 56                	push   %r14
+  801ee4:	41 55                	push   %r13
+  801ee6:	41 54                	push   %r12
+  801ee8:	53                   	push   %rbx
+  801ee9:	48 83 ec 08          	sub    $0x8,%rsp
+  801eed:	49 89 ff             	mov    %rdi,%r15
+  801ef0:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ef5:	49 bd 90 3d 80 00 00 	movabs $0x803d90,%r13
+  801efc:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801eff:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801f05:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801f08:	48 89 df             	mov    %rbx,%rdi
+  801f0b:	41 ff d5             	call   *%r13
+  801f0e:	83 e0 04             	and    $0x4,%eax
+  801f11:	74 17                	je     801f2a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801f13:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801f1a:	4c 39 f3             	cmp    %r14,%rbx
+  801f1d:	75 e6                	jne    801f05 <fd_alloc+0x29>
+  801f1f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801f25:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801f2a:	4d 89 27             	mov    %r12,(%r15)
+}
+  801f2d:	48 83 c4 08          	add    $0x8,%rsp
+  801f31:	5b                   	pop    %rbx
+  801f32:	41 5c                	pop    %r12
+  801f34:	41 5d                	pop    %r13
+  801f36:	41 5e                	pop    %r14
+  801f38:	41 5f                	pop    %r15
+  801f3a:	5d                   	pop    %rbp
+  801f3b:	c3                   	ret
+
+0000000000801f3c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801f3c:	83 ff 1f             	cmp    $0x1f,%edi
+  801f3f:	77 39                	ja     801f7a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801f41:	55                   	push   %rbp
+  801f42:	48 89 e5             	mov    %rsp,%rbp
+  801f45:	41 54                	push   %r12
+  801f47:	53                   	push   %rbx
+  801f48:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801f4b:	48 63 df             	movslq %edi,%rbx
+  801f4e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801f55:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801f59:	48 89 df             	mov    %rbx,%rdi
+  801f5c:	48 b8 90 3d 80 00 00 	movabs $0x803d90,%rax
+  801f63:	00 00 00 
+  801f66:	ff d0                	call   *%rax
+  801f68:	a8 04                	test   $0x4,%al
+  801f6a:	74 14                	je     801f80 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801f6c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801f70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f75:	5b                   	pop    %rbx
+  801f76:	41 5c                	pop    %r12
+  801f78:	5d                   	pop    %rbp
+  801f79:	c3                   	ret
+        return -E_INVAL;
+  801f7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801f7f:	c3                   	ret
+        return -E_INVAL;
+  801f80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f85:	eb ee                	jmp    801f75 <fd_lookup+0x39>
+
+0000000000801f87 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801f87:	55                   	push   %rbp
+  801f88:	48 89 e5             	mov    %rsp,%rbp
+  801f8b:	41 54                	push   %r12
+  801f8d:	53                   	push   %rbx
+  801f8e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801f91:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801f98:	00 00 00 
+  801f9b:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801fa2:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801fa5:	39 3b                	cmp    %edi,(%rbx)
+  801fa7:	74 47                	je     801ff0 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801fa9:	48 83 c0 08          	add    $0x8,%rax
+  801fad:	48 8b 18             	mov    (%rax),%rbx
+  801fb0:	48 85 db             	test   %rbx,%rbx
+  801fb3:	75 f0                	jne    801fa5 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801fb5:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801fbc:	00 00 00 
+  801fbf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fc5:	89 fa                	mov    %edi,%edx
+  801fc7:	48 bf 48 56 80 00 00 	movabs $0x805648,%rdi
+  801fce:	00 00 00 
+  801fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd6:	48 b9 c0 03 80 00 00 	movabs $0x8003c0,%rcx
+  801fdd:	00 00 00 
+  801fe0:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801fe2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801fe7:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801feb:	5b                   	pop    %rbx
+  801fec:	41 5c                	pop    %r12
+  801fee:	5d                   	pop    %rbp
+  801fef:	c3                   	ret
+            return 0;
+  801ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff5:	eb f0                	jmp    801fe7 <dev_lookup+0x60>
+
+0000000000801ff7 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ff7:	55                   	push   %rbp
+  801ff8:	48 89 e5             	mov    %rsp,%rbp
+  801ffb:	41 55                	push   %r13
+  801ffd:	41 54                	push   %r12
+  801fff:	53                   	push   %rbx
+  802000:	48 83 ec 18          	sub    $0x18,%rsp
+  802004:	48 89 fb             	mov    %rdi,%rbx
+  802007:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80200a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802011:	ff ff ff 
+  802014:	48 01 df             	add    %rbx,%rdi
+  802017:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80201b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80201f:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  802026:	00 00 00 
+  802029:	ff d0                	call   *%rax
+  80202b:	41 89 c5             	mov    %eax,%r13d
+  80202e:	85 c0                	test   %eax,%eax
+  802030:	78 06                	js     802038 <fd_close+0x41>
+  802032:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802036:	74 1a                	je     802052 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802038:	45 84 e4             	test   %r12b,%r12b
+  80203b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802040:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802044:	44 89 e8             	mov    %r13d,%eax
+  802047:	48 83 c4 18          	add    $0x18,%rsp
+  80204b:	5b                   	pop    %rbx
+  80204c:	41 5c                	pop    %r12
+  80204e:	41 5d                	pop    %r13
+  802050:	5d                   	pop    %rbp
+  802051:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802052:	8b 3b                	mov    (%rbx),%edi
+  802054:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802058:	48 b8 87 1f 80 00 00 	movabs $0x801f87,%rax
+  80205f:	00 00 00 
+  802062:	ff d0                	call   *%rax
+  802064:	41 89 c5             	mov    %eax,%r13d
+  802067:	85 c0                	test   %eax,%eax
+  802069:	78 1b                	js     802086 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80206b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80206f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802073:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802079:	48 85 c0             	test   %rax,%rax
+  80207c:	74 08                	je     802086 <fd_close+0x8f>
+  80207e:	48 89 df             	mov    %rbx,%rdi
+  802081:	ff d0                	call   *%rax
+  802083:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802086:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80208b:	48 89 de             	mov    %rbx,%rsi
+  80208e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802093:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  80209a:	00 00 00 
+  80209d:	ff d0                	call   *%rax
+    return res;
+  80209f:	eb a3                	jmp    802044 <fd_close+0x4d>
+
+00000000008020a1 <close>:
+
+int
+close(int fdnum) {
+  8020a1:	55                   	push   %rbp
+  8020a2:	48 89 e5             	mov    %rsp,%rbp
+  8020a5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020a9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020ad:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020b9:	85 c0                	test   %eax,%eax
+  8020bb:	78 15                	js     8020d2 <close+0x31>
+
+    return fd_close(fd, 1);
+  8020bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8020c2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020c6:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  8020cd:	00 00 00 
+  8020d0:	ff d0                	call   *%rax
+}
+  8020d2:	c9                   	leave
+  8020d3:	c3                   	ret
+
+00000000008020d4 <close_all>:
+
+void
+close_all(void) {
+  8020d4:	55                   	push   %rbp
+  8020d5:	48 89 e5             	mov    %rsp,%rbp
+  8020d8:	41 54                	push   %r12
+  8020da:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8020db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020e0:	49 bc a1 20 80 00 00 	movabs $0x8020a1,%r12
+  8020e7:	00 00 00 
+  8020ea:	89 df                	mov    %ebx,%edi
+  8020ec:	41 ff d4             	call   *%r12
+  8020ef:	83 c3 01             	add    $0x1,%ebx
+  8020f2:	83 fb 20             	cmp    $0x20,%ebx
+  8020f5:	75 f3                	jne    8020ea <close_all+0x16>
+}
+  8020f7:	5b                   	pop    %rbx
+  8020f8:	41 5c                	pop    %r12
+  8020fa:	5d                   	pop    %rbp
+  8020fb:	c3                   	ret
+
+00000000008020fc <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8020fc:	55                   	push   %rbp
+  8020fd:	48 89 e5             	mov    %rsp,%rbp
+  802100:	41 57                	push   %r15
+  802102:	41 56                	push   %r14
+  802104:	41 55                	push   %r13
+  802106:	41 54                	push   %r12
+  802108:	53                   	push   %rbx
+  802109:	48 83 ec 18          	sub    $0x18,%rsp
+  80210d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802110:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802114:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  80211b:	00 00 00 
+  80211e:	ff d0                	call   *%rax
+  802120:	89 c3                	mov    %eax,%ebx
+  802122:	85 c0                	test   %eax,%eax
+  802124:	0f 88 b8 00 00 00    	js     8021e2 <dup+0xe6>
+    close(newfdnum);
+  80212a:	44 89 e7             	mov    %r12d,%edi
+  80212d:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  802134:	00 00 00 
+  802137:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802139:	4d 63 ec             	movslq %r12d,%r13
+  80213c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802143:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802147:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80214b:	4c 89 ff             	mov    %r15,%rdi
+  80214e:	49 be c0 1e 80 00 00 	movabs $0x801ec0,%r14
+  802155:	00 00 00 
+  802158:	41 ff d6             	call   *%r14
+  80215b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80215e:	4c 89 ef             	mov    %r13,%rdi
+  802161:	41 ff d6             	call   *%r14
+  802164:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802167:	48 89 df             	mov    %rbx,%rdi
+  80216a:	48 b8 90 3d 80 00 00 	movabs $0x803d90,%rax
+  802171:	00 00 00 
+  802174:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802176:	a8 04                	test   $0x4,%al
+  802178:	74 2b                	je     8021a5 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80217a:	41 89 c1             	mov    %eax,%r9d
+  80217d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802183:	4c 89 f1             	mov    %r14,%rcx
+  802186:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218b:	48 89 de             	mov    %rbx,%rsi
+  80218e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802193:	48 b8 ff 14 80 00 00 	movabs $0x8014ff,%rax
+  80219a:	00 00 00 
+  80219d:	ff d0                	call   *%rax
+  80219f:	89 c3                	mov    %eax,%ebx
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 4e                	js     8021f3 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8021a5:	4c 89 ff             	mov    %r15,%rdi
+  8021a8:	48 b8 90 3d 80 00 00 	movabs $0x803d90,%rax
+  8021af:	00 00 00 
+  8021b2:	ff d0                	call   *%rax
+  8021b4:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8021b7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8021bd:	4c 89 e9             	mov    %r13,%rcx
+  8021c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c5:	4c 89 fe             	mov    %r15,%rsi
+  8021c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021cd:	48 b8 ff 14 80 00 00 	movabs $0x8014ff,%rax
+  8021d4:	00 00 00 
+  8021d7:	ff d0                	call   *%rax
+  8021d9:	89 c3                	mov    %eax,%ebx
+  8021db:	85 c0                	test   %eax,%eax
+  8021dd:	78 14                	js     8021f3 <dup+0xf7>
+
+    return newfdnum;
+  8021df:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8021e2:	89 d8                	mov    %ebx,%eax
+  8021e4:	48 83 c4 18          	add    $0x18,%rsp
+  8021e8:	5b                   	pop    %rbx
+  8021e9:	41 5c                	pop    %r12
+  8021eb:	41 5d                	pop    %r13
+  8021ed:	41 5e                	pop    %r14
+  8021ef:	41 5f                	pop    %r15
+  8021f1:	5d                   	pop    %rbp
+  8021f2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8021f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021f8:	4c 89 ee             	mov    %r13,%rsi
+  8021fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802200:	49 bc 77 16 80 00 00 	movabs $0x801677,%r12
+  802207:	00 00 00 
+  80220a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80220d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802212:	4c 89 f6             	mov    %r14,%rsi
+  802215:	bf 00 00 00 00       	mov    $0x0,%edi
+  80221a:	41 ff d4             	call   *%r12
+    return res;
+  80221d:	eb c3                	jmp    8021e2 <dup+0xe6>
+
+000000000080221f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80221f:	55                   	push   %rbp
+  802220:	48 89 e5             	mov    %rsp,%rbp
+  802223:	41 56                	push   %r14
+  802225:	41 55                	push   %r13
+  802227:	41 54                	push   %r12
+  802229:	53                   	push   %rbx
+  80222a:	48 83 ec 10          	sub    $0x10,%rsp
+  80222e:	89 fb                	mov    %edi,%ebx
+  802230:	49 89 f4             	mov    %rsi,%r12
+  802233:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802236:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80223a:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  802241:	00 00 00 
+  802244:	ff d0                	call   *%rax
+  802246:	85 c0                	test   %eax,%eax
+  802248:	78 4c                	js     802296 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80224a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80224e:	41 8b 3e             	mov    (%r14),%edi
+  802251:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802255:	48 b8 87 1f 80 00 00 	movabs $0x801f87,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+  802261:	85 c0                	test   %eax,%eax
+  802263:	78 35                	js     80229a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802265:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802269:	83 e0 03             	and    $0x3,%eax
+  80226c:	83 f8 01             	cmp    $0x1,%eax
+  80226f:	74 2d                	je     80229e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802271:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802275:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802279:	48 85 c0             	test   %rax,%rax
+  80227c:	74 56                	je     8022d4 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80227e:	4c 89 ea             	mov    %r13,%rdx
+  802281:	4c 89 e6             	mov    %r12,%rsi
+  802284:	4c 89 f7             	mov    %r14,%rdi
+  802287:	ff d0                	call   *%rax
+}
+  802289:	48 83 c4 10          	add    $0x10,%rsp
+  80228d:	5b                   	pop    %rbx
+  80228e:	41 5c                	pop    %r12
+  802290:	41 5d                	pop    %r13
+  802292:	41 5e                	pop    %r14
+  802294:	5d                   	pop    %rbp
+  802295:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802296:	48 98                	cltq
+  802298:	eb ef                	jmp    802289 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80229a:	48 98                	cltq
+  80229c:	eb eb                	jmp    802289 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80229e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022a5:	00 00 00 
+  8022a8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022ae:	89 da                	mov    %ebx,%edx
+  8022b0:	48 bf 89 56 80 00 00 	movabs $0x805689,%rdi
+  8022b7:	00 00 00 
+  8022ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bf:	48 b9 c0 03 80 00 00 	movabs $0x8003c0,%rcx
+  8022c6:	00 00 00 
+  8022c9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022cb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022d2:	eb b5                	jmp    802289 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8022d4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8022db:	eb ac                	jmp    802289 <read+0x6a>
+
+00000000008022dd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8022dd:	55                   	push   %rbp
+  8022de:	48 89 e5             	mov    %rsp,%rbp
+  8022e1:	41 57                	push   %r15
+  8022e3:	41 56                	push   %r14
+  8022e5:	41 55                	push   %r13
+  8022e7:	41 54                	push   %r12
+  8022e9:	53                   	push   %rbx
+  8022ea:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8022ee:	48 85 d2             	test   %rdx,%rdx
+  8022f1:	74 54                	je     802347 <readn+0x6a>
+  8022f3:	41 89 fd             	mov    %edi,%r13d
+  8022f6:	49 89 f6             	mov    %rsi,%r14
+  8022f9:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8022fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802301:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802306:	49 bf 1f 22 80 00 00 	movabs $0x80221f,%r15
+  80230d:	00 00 00 
+  802310:	4c 89 e2             	mov    %r12,%rdx
+  802313:	48 29 f2             	sub    %rsi,%rdx
+  802316:	4c 01 f6             	add    %r14,%rsi
+  802319:	44 89 ef             	mov    %r13d,%edi
+  80231c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80231f:	85 c0                	test   %eax,%eax
+  802321:	78 20                	js     802343 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802323:	01 c3                	add    %eax,%ebx
+  802325:	85 c0                	test   %eax,%eax
+  802327:	74 08                	je     802331 <readn+0x54>
+  802329:	48 63 f3             	movslq %ebx,%rsi
+  80232c:	4c 39 e6             	cmp    %r12,%rsi
+  80232f:	72 df                	jb     802310 <readn+0x33>
+    }
+    return res;
+  802331:	48 63 c3             	movslq %ebx,%rax
+}
+  802334:	48 83 c4 08          	add    $0x8,%rsp
+  802338:	5b                   	pop    %rbx
+  802339:	41 5c                	pop    %r12
+  80233b:	41 5d                	pop    %r13
+  80233d:	41 5e                	pop    %r14
+  80233f:	41 5f                	pop    %r15
+  802341:	5d                   	pop    %rbp
+  802342:	c3                   	ret
+        if (inc < 0) return inc;
+  802343:	48 98                	cltq
+  802345:	eb ed                	jmp    802334 <readn+0x57>
+    int inc = 1, res = 0;
+  802347:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80234c:	eb e3                	jmp    802331 <readn+0x54>
+
+000000000080234e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80234e:	55                   	push   %rbp
+  80234f:	48 89 e5             	mov    %rsp,%rbp
+  802352:	41 56                	push   %r14
+  802354:	41 55                	push   %r13
+  802356:	41 54                	push   %r12
+  802358:	53                   	push   %rbx
+  802359:	48 83 ec 10          	sub    $0x10,%rsp
+  80235d:	89 fb                	mov    %edi,%ebx
+  80235f:	49 89 f4             	mov    %rsi,%r12
+  802362:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802365:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802369:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  802370:	00 00 00 
+  802373:	ff d0                	call   *%rax
+  802375:	85 c0                	test   %eax,%eax
+  802377:	78 47                	js     8023c0 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802379:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80237d:	41 8b 3e             	mov    (%r14),%edi
+  802380:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802384:	48 b8 87 1f 80 00 00 	movabs $0x801f87,%rax
+  80238b:	00 00 00 
+  80238e:	ff d0                	call   *%rax
+  802390:	85 c0                	test   %eax,%eax
+  802392:	78 30                	js     8023c4 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802394:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802399:	74 2d                	je     8023c8 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80239b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80239f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8023a3:	48 85 c0             	test   %rax,%rax
+  8023a6:	74 56                	je     8023fe <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8023a8:	4c 89 ea             	mov    %r13,%rdx
+  8023ab:	4c 89 e6             	mov    %r12,%rsi
+  8023ae:	4c 89 f7             	mov    %r14,%rdi
+  8023b1:	ff d0                	call   *%rax
+}
+  8023b3:	48 83 c4 10          	add    $0x10,%rsp
+  8023b7:	5b                   	pop    %rbx
+  8023b8:	41 5c                	pop    %r12
+  8023ba:	41 5d                	pop    %r13
+  8023bc:	41 5e                	pop    %r14
+  8023be:	5d                   	pop    %rbp
+  8023bf:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023c0:	48 98                	cltq
+  8023c2:	eb ef                	jmp    8023b3 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023c4:	48 98                	cltq
+  8023c6:	eb eb                	jmp    8023b3 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023c8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8023cf:	00 00 00 
+  8023d2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023d8:	89 da                	mov    %ebx,%edx
+  8023da:	48 bf a5 56 80 00 00 	movabs $0x8056a5,%rdi
+  8023e1:	00 00 00 
+  8023e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e9:	48 b9 c0 03 80 00 00 	movabs $0x8003c0,%rcx
+  8023f0:	00 00 00 
+  8023f3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023f5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023fc:	eb b5                	jmp    8023b3 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023fe:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802405:	eb ac                	jmp    8023b3 <write+0x65>
+
+0000000000802407 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802407:	55                   	push   %rbp
+  802408:	48 89 e5             	mov    %rsp,%rbp
+  80240b:	53                   	push   %rbx
+  80240c:	48 83 ec 18          	sub    $0x18,%rsp
+  802410:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802412:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802416:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  80241d:	00 00 00 
+  802420:	ff d0                	call   *%rax
+  802422:	85 c0                	test   %eax,%eax
+  802424:	78 0c                	js     802432 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802426:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80242a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80242d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802432:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802436:	c9                   	leave
+  802437:	c3                   	ret
+
+0000000000802438 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802438:	55                   	push   %rbp
+  802439:	48 89 e5             	mov    %rsp,%rbp
+  80243c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802440:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802444:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  80244b:	00 00 00 
+  80244e:	ff d0                	call   *%rax
+  802450:	85 c0                	test   %eax,%eax
+  802452:	78 07                	js     80245b <tell+0x23>
+    return fdes->fd_offset;
+  802454:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802458:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80245b:	c9                   	leave
+  80245c:	c3                   	ret
+
+000000000080245d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80245d:	55                   	push   %rbp
+  80245e:	48 89 e5             	mov    %rsp,%rbp
+  802461:	41 55                	push   %r13
+  802463:	41 54                	push   %r12
+  802465:	53                   	push   %rbx
+  802466:	48 83 ec 18          	sub    $0x18,%rsp
+  80246a:	89 fb                	mov    %edi,%ebx
+  80246c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80246f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802473:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  80247a:	00 00 00 
+  80247d:	ff d0                	call   *%rax
+  80247f:	85 c0                	test   %eax,%eax
+  802481:	78 38                	js     8024bb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802483:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802487:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80248b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80248f:	48 b8 87 1f 80 00 00 	movabs $0x801f87,%rax
+  802496:	00 00 00 
+  802499:	ff d0                	call   *%rax
+  80249b:	85 c0                	test   %eax,%eax
+  80249d:	78 1c                	js     8024bb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80249f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8024a4:	74 20                	je     8024c6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024aa:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8024ae:	48 85 c0             	test   %rax,%rax
+  8024b1:	74 47                	je     8024fa <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8024b3:	44 89 e6             	mov    %r12d,%esi
+  8024b6:	4c 89 ef             	mov    %r13,%rdi
+  8024b9:	ff d0                	call   *%rax
+}
+  8024bb:	48 83 c4 18          	add    $0x18,%rsp
+  8024bf:	5b                   	pop    %rbx
+  8024c0:	41 5c                	pop    %r12
+  8024c2:	41 5d                	pop    %r13
+  8024c4:	5d                   	pop    %rbp
+  8024c5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8024c6:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8024cd:	00 00 00 
+  8024d0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8024d6:	89 da                	mov    %ebx,%edx
+  8024d8:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  8024df:	00 00 00 
+  8024e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e7:	48 b9 c0 03 80 00 00 	movabs $0x8003c0,%rcx
+  8024ee:	00 00 00 
+  8024f1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8024f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024f8:	eb c1                	jmp    8024bb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024fa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024ff:	eb ba                	jmp    8024bb <ftruncate+0x5e>
+
+0000000000802501 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802501:	55                   	push   %rbp
+  802502:	48 89 e5             	mov    %rsp,%rbp
+  802505:	41 54                	push   %r12
+  802507:	53                   	push   %rbx
+  802508:	48 83 ec 10          	sub    $0x10,%rsp
+  80250c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80250f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802513:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  80251a:	00 00 00 
+  80251d:	ff d0                	call   *%rax
+  80251f:	85 c0                	test   %eax,%eax
+  802521:	78 4e                	js     802571 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802523:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802527:	41 8b 3c 24          	mov    (%r12),%edi
+  80252b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80252f:	48 b8 87 1f 80 00 00 	movabs $0x801f87,%rax
+  802536:	00 00 00 
+  802539:	ff d0                	call   *%rax
+  80253b:	85 c0                	test   %eax,%eax
+  80253d:	78 32                	js     802571 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80253f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802543:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802548:	74 30                	je     80257a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80254a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80254d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802554:	00 00 00 
+    stat->st_isdir = 0;
+  802557:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80255e:	00 00 00 
+    stat->st_dev = dev;
+  802561:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802568:	48 89 de             	mov    %rbx,%rsi
+  80256b:	4c 89 e7             	mov    %r12,%rdi
+  80256e:	ff 50 28             	call   *0x28(%rax)
+}
+  802571:	48 83 c4 10          	add    $0x10,%rsp
+  802575:	5b                   	pop    %rbx
+  802576:	41 5c                	pop    %r12
+  802578:	5d                   	pop    %rbp
+  802579:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80257a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80257f:	eb f0                	jmp    802571 <fstat+0x70>
+
+0000000000802581 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802581:	55                   	push   %rbp
+  802582:	48 89 e5             	mov    %rsp,%rbp
+  802585:	41 54                	push   %r12
+  802587:	53                   	push   %rbx
+  802588:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80258f:	41 89 fc             	mov    %edi,%r12d
+  802592:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802594:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802598:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+  8025a4:	85 c0                	test   %eax,%eax
+  8025a6:	78 31                	js     8025d9 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8025a8:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8025af:	44 89 e7             	mov    %r12d,%edi
+  8025b2:	48 b8 01 25 80 00 00 	movabs $0x802501,%rax
+  8025b9:	00 00 00 
+  8025bc:	ff d0                	call   *%rax
+  8025be:	85 c0                	test   %eax,%eax
+  8025c0:	78 17                	js     8025d9 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8025c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025c6:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8025c9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8025cc:	39 d3                	cmp    %edx,%ebx
+  8025ce:	0f 4f da             	cmovg  %edx,%ebx
+  8025d1:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8025d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d9:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8025e0:	5b                   	pop    %rbx
+  8025e1:	41 5c                	pop    %r12
+  8025e3:	5d                   	pop    %rbp
+  8025e4:	c3                   	ret
+
+00000000008025e5 <seektoend>:
+{
+  8025e5:	55                   	push   %rbp
+  8025e6:	48 89 e5             	mov    %rsp,%rbp
+  8025e9:	53                   	push   %rbx
+  8025ea:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8025f1:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8025f3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025f7:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  8025fe:	00 00 00 
+  802601:	ff d0                	call   *%rax
+  802603:	85 c0                	test   %eax,%eax
+  802605:	78 28                	js     80262f <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802607:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80260e:	89 df                	mov    %ebx,%edi
+  802610:	48 b8 01 25 80 00 00 	movabs $0x802501,%rax
+  802617:	00 00 00 
+  80261a:	ff d0                	call   *%rax
+  80261c:	85 c0                	test   %eax,%eax
+  80261e:	78 0f                	js     80262f <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802620:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802623:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802627:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80262a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80262f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802633:	c9                   	leave
+  802634:	c3                   	ret
+
+0000000000802635 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802635:	55                   	push   %rbp
+  802636:	48 89 e5             	mov    %rsp,%rbp
+  802639:	41 54                	push   %r12
+  80263b:	53                   	push   %rbx
+  80263c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80263f:	be 00 00 00 00       	mov    $0x0,%esi
+  802644:	48 b8 28 32 80 00 00 	movabs $0x803228,%rax
+  80264b:	00 00 00 
+  80264e:	ff d0                	call   *%rax
+  802650:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802652:	85 c0                	test   %eax,%eax
+  802654:	78 25                	js     80267b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802656:	4c 89 e6             	mov    %r12,%rsi
+  802659:	89 c7                	mov    %eax,%edi
+  80265b:	48 b8 01 25 80 00 00 	movabs $0x802501,%rax
+  802662:	00 00 00 
+  802665:	ff d0                	call   *%rax
+  802667:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80266a:	89 df                	mov    %ebx,%edi
+  80266c:	48 b8 a1 20 80 00 00 	movabs $0x8020a1,%rax
+  802673:	00 00 00 
+  802676:	ff d0                	call   *%rax
+
+    return res;
+  802678:	44 89 e3             	mov    %r12d,%ebx
+}
+  80267b:	89 d8                	mov    %ebx,%eax
+  80267d:	5b                   	pop    %rbx
+  80267e:	41 5c                	pop    %r12
+  802680:	5d                   	pop    %rbp
+  802681:	c3                   	ret
+
+0000000000802682 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802682:	55                   	push   %rbp
+  802683:	48 89 e5             	mov    %rsp,%rbp
+  802686:	53                   	push   %rbx
+  802687:	48 83 ec 08          	sub    $0x8,%rsp
+  80268b:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80268e:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  802695:	00 00 00 
+  802698:	ff d0                	call   *%rax
+  80269a:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80269e:	0f 87 ea 00 00 00    	ja     80278e <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8026a4:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8026ab:	00 00 00 
+  8026ae:	80 38 00             	cmpb   $0x0,(%rax)
+  8026b1:	75 35                	jne    8026e8 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8026b3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8026b8:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8026bd:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8026c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026c7:	48 b8 98 14 80 00 00 	movabs $0x801498,%rax
+  8026ce:	00 00 00 
+  8026d1:	ff d0                	call   *%rax
+  8026d3:	85 c0                	test   %eax,%eax
+  8026d5:	0f 88 ba 00 00 00    	js     802795 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8026db:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8026e2:	00 00 00 
+  8026e5:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8026e8:	48 89 df             	mov    %rbx,%rdi
+  8026eb:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  8026f2:	00 00 00 
+  8026f5:	ff d0                	call   *%rax
+  8026f7:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8026fb:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802702:	00 00 00 
+  802705:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802709:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  80270c:	39 39                	cmp    %edi,(%rcx)
+  80270e:	74 46                	je     802756 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802710:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802714:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  80271b:	00 
+  80271c:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802723:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  80272a:	00 
+  80272b:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802732:	00 
+  802733:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  80273a:	00 
+  80273b:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802742:	00 
+  802743:	89 39                	mov    %edi,(%rcx)
+  802745:	48 01 c6             	add    %rax,%rsi
+  802748:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  80274d:	48 89 c8             	mov    %rcx,%rax
+  802750:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802754:	c9                   	leave
+  802755:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802756:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80275a:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802761:	00 00 00 
+  802764:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802767:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80276b:	74 e0                	je     80274d <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80276d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802774:	00 
+  802775:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802779:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802780:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802782:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802785:	48 01 c2             	add    %rax,%rdx
+  802788:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80278c:	eb bf                	jmp    80274d <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80278e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802793:	eb b8                	jmp    80274d <fbuf_get+0xcb>
+            return NULL;
+  802795:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80279a:	eb b1                	jmp    80274d <fbuf_get+0xcb>
+
+000000000080279c <fsipc_bulk>:
+fsipc_bulk(void) {
+  80279c:	55                   	push   %rbp
+  80279d:	48 89 e5             	mov    %rsp,%rbp
+  8027a0:	53                   	push   %rbx
+  8027a1:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8027a5:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8027ac:	00 00 00 
+  8027af:	48 8b 18             	mov    (%rax),%rbx
+  8027b2:	48 85 db             	test   %rbx,%rbx
+  8027b5:	74 16                	je     8027cd <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8027b7:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8027be:	00 00 00 
+  8027c1:	48 8b 18             	mov    (%rax),%rbx
+}
+  8027c4:	48 89 d8             	mov    %rbx,%rax
+  8027c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027cb:	c9                   	leave
+  8027cc:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8027cd:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027d2:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8027d7:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8027dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027e1:	48 b8 98 14 80 00 00 	movabs $0x801498,%rax
+  8027e8:	00 00 00 
+  8027eb:	ff d0                	call   *%rax
+  8027ed:	85 c0                	test   %eax,%eax
+  8027ef:	78 d3                	js     8027c4 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8027f1:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8027f6:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8027fd:	00 00 00 
+  802800:	eb b5                	jmp    8027b7 <fsipc_bulk+0x1b>
+
+0000000000802802 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802802:	55                   	push   %rbp
+  802803:	48 89 e5             	mov    %rsp,%rbp
+  802806:	41 57                	push   %r15
+  802808:	41 56                	push   %r14
+  80280a:	41 55                	push   %r13
+  80280c:	41 54                	push   %r12
+  80280e:	53                   	push   %rbx
+  80280f:	48 83 ec 08          	sub    $0x8,%rsp
+  802813:	41 89 fd             	mov    %edi,%r13d
+  802816:	49 89 f6             	mov    %rsi,%r14
+  802819:	49 89 d7             	mov    %rdx,%r15
+  80281c:	48 89 cb             	mov    %rcx,%rbx
+  80281f:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802822:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802829:	00 00 00 
+  80282c:	83 38 00             	cmpl   $0x0,(%rax)
+  80282f:	74 52                	je     802883 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802831:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802837:	4c 89 f9             	mov    %r15,%rcx
+  80283a:	4c 89 f2             	mov    %r14,%rdx
+  80283d:	44 89 ee             	mov    %r13d,%esi
+  802840:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802847:	00 00 00 
+  80284a:	8b 38                	mov    (%rax),%edi
+  80284c:	48 b8 e7 42 80 00 00 	movabs $0x8042e7,%rax
+  802853:	00 00 00 
+  802856:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802858:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80285d:	4c 89 e2             	mov    %r12,%rdx
+  802860:	48 89 de             	mov    %rbx,%rsi
+  802863:	bf 00 00 00 00       	mov    $0x0,%edi
+  802868:	48 b8 37 41 80 00 00 	movabs $0x804137,%rax
+  80286f:	00 00 00 
+  802872:	ff d0                	call   *%rax
+}
+  802874:	48 83 c4 08          	add    $0x8,%rsp
+  802878:	5b                   	pop    %rbx
+  802879:	41 5c                	pop    %r12
+  80287b:	41 5d                	pop    %r13
+  80287d:	41 5e                	pop    %r14
+  80287f:	41 5f                	pop    %r15
+  802881:	5d                   	pop    %rbp
+  802882:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802883:	bf 03 00 00 00       	mov    $0x3,%edi
+  802888:	48 b8 8a 43 80 00 00 	movabs $0x80438a,%rax
+  80288f:	00 00 00 
+  802892:	ff d0                	call   *%rax
+  802894:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80289b:	00 00 
+  80289d:	eb 92                	jmp    802831 <fsipc_region+0x2f>
+
+000000000080289f <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80289f:	55                   	push   %rbp
+  8028a0:	48 89 e5             	mov    %rsp,%rbp
+  8028a3:	41 57                	push   %r15
+  8028a5:	41 56                	push   %r14
+  8028a7:	41 55                	push   %r13
+  8028a9:	41 54                	push   %r12
+  8028ab:	53                   	push   %rbx
+  8028ac:	48 83 ec 28          	sub    $0x28,%rsp
+  8028b0:	49 89 ff             	mov    %rdi,%r15
+  8028b3:	49 89 f6             	mov    %rsi,%r14
+  8028b6:	48 89 d3             	mov    %rdx,%rbx
+  8028b9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8028bd:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8028c0:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  8028c7:	00 00 00 
+  8028ca:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8028cc:	48 85 c0             	test   %rax,%rax
+  8028cf:	0f 84 cc 00 00 00    	je     8029a1 <devfile_write_direct+0x102>
+  8028d5:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8028d8:	48 85 db             	test   %rbx,%rbx
+  8028db:	0f 84 ba 00 00 00    	je     80299b <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8028e1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8028e7:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8028ee:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8028f2:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8028f6:	4c 29 e3             	sub    %r12,%rbx
+  8028f9:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8028fe:	48 39 c3             	cmp    %rax,%rbx
+  802901:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802905:	48 89 da             	mov    %rbx,%rdx
+  802908:	4c 89 f6             	mov    %r14,%rsi
+  80290b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80290f:	48 b8 2d 11 80 00 00 	movabs $0x80112d,%rax
+  802916:	00 00 00 
+  802919:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  80291b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80291f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802923:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802926:	44 01 e0             	add    %r12d,%eax
+  802929:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  80292d:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802931:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802938:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80293f:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802946:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80294c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802951:	4c 89 ee             	mov    %r13,%rsi
+  802954:	bf 04 00 00 00       	mov    $0x4,%edi
+  802959:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  802960:	00 00 00 
+  802963:	ff d0                	call   *%rax
+        if (res < 0)
+  802965:	85 c0                	test   %eax,%eax
+  802967:	78 29                	js     802992 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802969:	74 2b                	je     802996 <devfile_write_direct+0xf7>
+        i += res;
+  80296b:	48 98                	cltq
+  80296d:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802970:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802973:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802977:	49 39 c4             	cmp    %rax,%r12
+  80297a:	0f 82 72 ff ff ff    	jb     8028f2 <devfile_write_direct+0x53>
+    return i;
+  802980:	4c 89 e0             	mov    %r12,%rax
+}
+  802983:	48 83 c4 28          	add    $0x28,%rsp
+  802987:	5b                   	pop    %rbx
+  802988:	41 5c                	pop    %r12
+  80298a:	41 5d                	pop    %r13
+  80298c:	41 5e                	pop    %r14
+  80298e:	41 5f                	pop    %r15
+  802990:	5d                   	pop    %rbp
+  802991:	c3                   	ret
+            return res;
+  802992:	48 98                	cltq
+  802994:	eb ed                	jmp    802983 <devfile_write_direct+0xe4>
+            return i;
+  802996:	4c 89 e0             	mov    %r12,%rax
+  802999:	eb e8                	jmp    802983 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80299b:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  80299f:	eb df                	jmp    802980 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8029a1:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8029a8:	eb d9                	jmp    802983 <devfile_write_direct+0xe4>
+
+00000000008029aa <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8029aa:	55                   	push   %rbp
+  8029ab:	48 89 e5             	mov    %rsp,%rbp
+  8029ae:	41 56                	push   %r14
+  8029b0:	41 55                	push   %r13
+  8029b2:	41 54                	push   %r12
+  8029b4:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8029b5:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8029b9:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8029bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c2:	4d 39 ee             	cmp    %r13,%r14
+  8029c5:	0f 84 99 00 00 00    	je     802a64 <fbuf_flush+0xba>
+  8029cb:	49 89 fc             	mov    %rdi,%r12
+  8029ce:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8029d1:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8029d4:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8029d8:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  8029df:	00 00 00 
+  8029e2:	ff d0                	call   *%rax
+  8029e4:	48 89 c2             	mov    %rax,%rdx
+  8029e7:	48 c1 e2 04          	shl    $0x4,%rdx
+  8029eb:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8029ef:	48 c1 e0 0c          	shl    $0xc,%rax
+  8029f3:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8029f8:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8029fb:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8029ff:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802a06:	00 
+  802a07:	44 89 f1             	mov    %r14d,%ecx
+  802a0a:	4c 89 ea             	mov    %r13,%rdx
+  802a0d:	4c 89 e7             	mov    %r12,%rdi
+  802a10:	48 b8 9f 28 80 00 00 	movabs $0x80289f,%rax
+  802a17:	00 00 00 
+  802a1a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a1c:	48 85 c0             	test   %rax,%rax
+  802a1f:	78 43                	js     802a64 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802a21:	4c 39 e8             	cmp    %r13,%rax
+  802a24:	72 47                	jb     802a6d <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802a26:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802a2b:	83 c0 01             	add    $0x1,%eax
+  802a2e:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802a33:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802a36:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802a3a:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802a3e:	72 0f                	jb     802a4f <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802a40:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802a44:	48 39 c2             	cmp    %rax,%rdx
+  802a47:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802a4b:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802a4f:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802a56:	00 
+  802a57:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802a5e:	00 
+    return 0;
+  802a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a64:	5b                   	pop    %rbx
+  802a65:	41 5c                	pop    %r12
+  802a67:	41 5d                	pop    %r13
+  802a69:	41 5e                	pop    %r14
+  802a6b:	5d                   	pop    %rbp
+  802a6c:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802a6d:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802a72:	eb f0                	jmp    802a64 <fbuf_flush+0xba>
+
+0000000000802a74 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802a74:	55                   	push   %rbp
+  802a75:	48 89 e5             	mov    %rsp,%rbp
+  802a78:	53                   	push   %rbx
+  802a79:	48 83 ec 08          	sub    $0x8,%rsp
+  802a7d:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802a80:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  802a87:	00 00 00 
+  802a8a:	ff d0                	call   *%rax
+  802a8c:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a94:	48 85 f6             	test   %rsi,%rsi
+  802a97:	74 0f                	je     802aa8 <devfile_sync+0x34>
+  802a99:	48 89 df             	mov    %rbx,%rdi
+  802a9c:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  802aa3:	00 00 00 
+  802aa6:	ff d0                	call   *%rax
+}
+  802aa8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aac:	c9                   	leave
+  802aad:	c3                   	ret
+
+0000000000802aae <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802aae:	55                   	push   %rbp
+  802aaf:	48 89 e5             	mov    %rsp,%rbp
+  802ab2:	48 83 ec 10          	sub    $0x10,%rsp
+  802ab6:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802ab9:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802ac0:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802ac1:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802ac5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802aca:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802ad1:	00 00 00 
+  802ad4:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+}
+  802ae0:	c9                   	leave
+  802ae1:	c3                   	ret
+
+0000000000802ae2 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ae2:	55                   	push   %rbp
+  802ae3:	48 89 e5             	mov    %rsp,%rbp
+  802ae6:	41 54                	push   %r12
+  802ae8:	53                   	push   %rbx
+  802ae9:	48 89 fb             	mov    %rdi,%rbx
+  802aec:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802aef:	48 b8 74 2a 80 00 00 	movabs $0x802a74,%rax
+  802af6:	00 00 00 
+  802af9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802afb:	85 c0                	test   %eax,%eax
+  802afd:	78 63                	js     802b62 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802aff:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b02:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802b09:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802b0b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b10:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b15:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  802b1c:	00 00 00 
+  802b1f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b21:	85 c0                	test   %eax,%eax
+  802b23:	78 3d                	js     802b62 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b25:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802b2c:	00 00 00 
+  802b2f:	48 89 de             	mov    %rbx,%rsi
+  802b32:	4c 89 e7             	mov    %r12,%rdi
+  802b35:	48 b8 38 0d 80 00 00 	movabs $0x800d38,%rax
+  802b3c:	00 00 00 
+  802b3f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b41:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802b47:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802b4e:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b4f:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802b55:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802b5c:	00 
+
+    return 0;
+  802b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b62:	5b                   	pop    %rbx
+  802b63:	41 5c                	pop    %r12
+  802b65:	5d                   	pop    %rbp
+  802b66:	c3                   	ret
+
+0000000000802b67 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b67:	55                   	push   %rbp
+  802b68:	48 89 e5             	mov    %rsp,%rbp
+  802b6b:	41 54                	push   %r12
+  802b6d:	53                   	push   %rbx
+  802b6e:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802b71:	48 b8 74 2a 80 00 00 	movabs $0x802a74,%rax
+  802b78:	00 00 00 
+  802b7b:	ff d0                	call   *%rax
+  802b7d:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802b80:	48 89 df             	mov    %rbx,%rdi
+  802b83:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  802b8a:	00 00 00 
+  802b8d:	ff d0                	call   *%rax
+  802b8f:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802b93:	76 2e                	jbe    802bc3 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802b95:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b98:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802b9f:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802ba1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bab:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  802bb2:	00 00 00 
+  802bb5:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802bb7:	45 85 e4             	test   %r12d,%r12d
+  802bba:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802bbe:	5b                   	pop    %rbx
+  802bbf:	41 5c                	pop    %r12
+  802bc1:	5d                   	pop    %rbp
+  802bc2:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802bc3:	48 89 df             	mov    %rbx,%rdi
+  802bc6:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  802bcd:	00 00 00 
+  802bd0:	ff d0                	call   *%rax
+  802bd2:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802bd6:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802bdd:	00 00 00 
+  802be0:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802be7:	48 89 df             	mov    %rbx,%rdi
+  802bea:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+  802bf6:	48 89 c6             	mov    %rax,%rsi
+  802bf9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c03:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  802c0a:	00 00 00 
+  802c0d:	ff d0                	call   *%rax
+  802c0f:	eb 84                	jmp    802b95 <devfile_flush+0x2e>
+
+0000000000802c11 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802c11:	55                   	push   %rbp
+  802c12:	48 89 e5             	mov    %rsp,%rbp
+  802c15:	41 55                	push   %r13
+  802c17:	41 54                	push   %r12
+  802c19:	53                   	push   %rbx
+  802c1a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c1e:	48 89 fb             	mov    %rdi,%rbx
+  802c21:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802c24:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802c30:	48 85 c0             	test   %rax,%rax
+  802c33:	74 51                	je     802c86 <devfile_trunc+0x75>
+  802c35:	49 89 c4             	mov    %rax,%r12
+  802c38:	48 89 c6             	mov    %rax,%rsi
+  802c3b:	48 89 df             	mov    %rbx,%rdi
+  802c3e:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  802c45:	00 00 00 
+  802c48:	ff d0                	call   *%rax
+  802c4a:	85 c0                	test   %eax,%eax
+  802c4c:	78 2d                	js     802c7b <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802c4e:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802c55:	00 00 00 
+  802c58:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802c5b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802c5d:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802c61:	be 00 00 00 00       	mov    $0x0,%esi
+  802c66:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c6b:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  802c72:	00 00 00 
+  802c75:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802c77:	85 c0                	test   %eax,%eax
+  802c79:	79 3e                	jns    802cb9 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802c7b:	48 83 c4 08          	add    $0x8,%rsp
+  802c7f:	5b                   	pop    %rbx
+  802c80:	41 5c                	pop    %r12
+  802c82:	41 5d                	pop    %r13
+  802c84:	5d                   	pop    %rbp
+  802c85:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802c86:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802c8d:	00 00 00 
+  802c90:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802c93:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802c95:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802c99:	be 00 00 00 00       	mov    $0x0,%esi
+  802c9e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ca3:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  802caa:	00 00 00 
+  802cad:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802caf:	85 c0                	test   %eax,%eax
+  802cb1:	78 c8                	js     802c7b <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802cb3:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802cb7:	eb c2                	jmp    802c7b <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802cb9:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802cbc:	8d 51 01             	lea    0x1(%rcx),%edx
+  802cbf:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802cc2:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802cc7:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802cce:	00 00 
+  802cd0:	eb a9                	jmp    802c7b <devfile_trunc+0x6a>
+
+0000000000802cd2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802cd2:	55                   	push   %rbp
+  802cd3:	48 89 e5             	mov    %rsp,%rbp
+  802cd6:	41 57                	push   %r15
+  802cd8:	41 56                	push   %r14
+  802cda:	41 55                	push   %r13
+  802cdc:	41 54                	push   %r12
+  802cde:	53                   	push   %rbx
+  802cdf:	48 83 ec 28          	sub    $0x28,%rsp
+  802ce3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802ce7:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802ceb:	49 89 d7             	mov    %rdx,%r15
+  802cee:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802cf2:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  802cf9:	00 00 00 
+  802cfc:	ff d0                	call   *%rax
+  802cfe:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802d01:	48 85 c0             	test   %rax,%rax
+  802d04:	74 31                	je     802d37 <devfile_write+0x65>
+  802d06:	4c 89 f8             	mov    %r15,%rax
+  802d09:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802d10:	77 25                	ja     802d37 <devfile_write+0x65>
+    size_t i = 0;
+  802d12:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802d18:	48 85 c0             	test   %rax,%rax
+  802d1b:	0f 85 64 01 00 00    	jne    802e85 <devfile_write+0x1b3>
+    size_t i = 0;
+  802d21:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802d25:	4c 89 f8             	mov    %r15,%rax
+}
+  802d28:	48 83 c4 28          	add    $0x28,%rsp
+  802d2c:	5b                   	pop    %rbx
+  802d2d:	41 5c                	pop    %r12
+  802d2f:	41 5d                	pop    %r13
+  802d31:	41 5e                	pop    %r14
+  802d33:	41 5f                	pop    %r15
+  802d35:	5d                   	pop    %rbp
+  802d36:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d37:	48 85 db             	test   %rbx,%rbx
+  802d3a:	74 5b                	je     802d97 <devfile_write+0xc5>
+  802d3c:	48 89 de             	mov    %rbx,%rsi
+  802d3f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d43:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  802d4a:	00 00 00 
+  802d4d:	ff d0                	call   *%rax
+  802d4f:	85 c0                	test   %eax,%eax
+  802d51:	78 40                	js     802d93 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802d53:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d57:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802d5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d5e:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802d62:	48 b8 9f 28 80 00 00 	movabs $0x80289f,%rax
+  802d69:	00 00 00 
+  802d6c:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802d6e:	48 85 c0             	test   %rax,%rax
+  802d71:	7e b5                	jle    802d28 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802d73:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802d77:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802d7a:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802d7d:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802d80:	8d 51 01             	lea    0x1(%rcx),%edx
+  802d83:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d86:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802d89:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802d90:	00 
+  802d91:	eb 95                	jmp    802d28 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d93:	48 98                	cltq
+  802d95:	eb 91                	jmp    802d28 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802d97:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802d9b:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802d9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802da2:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802da6:	48 89 df             	mov    %rbx,%rdi
+  802da9:	48 b8 9f 28 80 00 00 	movabs $0x80289f,%rax
+  802db0:	00 00 00 
+  802db3:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802db5:	48 85 c0             	test   %rax,%rax
+  802db8:	0f 8e 6a ff ff ff    	jle    802d28 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802dbe:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802dc1:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802dc5:	e9 5e ff ff ff       	jmp    802d28 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802dca:	48 98                	cltq
+  802dcc:	4d 85 ff             	test   %r15,%r15
+  802dcf:	49 0f 45 c7          	cmovne %r15,%rax
+  802dd3:	e9 50 ff ff ff       	jmp    802d28 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802dd8:	48 89 de             	mov    %rbx,%rsi
+  802ddb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802ddf:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  802de6:	00 00 00 
+  802de9:	ff d0                	call   *%rax
+  802deb:	85 c0                	test   %eax,%eax
+  802ded:	0f 88 2b 01 00 00    	js     802f1e <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802df3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802df7:	4c 01 f8             	add    %r15,%rax
+  802dfa:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802dfe:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e02:	48 b9 ae 1e 80 00 00 	movabs $0x801eae,%rcx
+  802e09:	00 00 00 
+  802e0c:	ff d1                	call   *%rcx
+  802e0e:	48 89 c2             	mov    %rax,%rdx
+  802e11:	48 c1 e2 04          	shl    $0x4,%rdx
+  802e15:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802e19:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e1d:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802e22:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802e25:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802e2c:	00 
+  802e2d:	4c 89 ea             	mov    %r13,%rdx
+  802e30:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802e34:	48 b8 2d 11 80 00 00 	movabs $0x80112d,%rax
+  802e3b:	00 00 00 
+  802e3e:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802e40:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802e44:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802e48:	48 39 c2             	cmp    %rax,%rdx
+  802e4b:	0f 84 db 00 00 00    	je     802f2c <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802e51:	4c 39 e2             	cmp    %r12,%rdx
+  802e54:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802e58:	4d 01 ec             	add    %r13,%r12
+  802e5b:	49 39 c4             	cmp    %rax,%r12
+  802e5e:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802e62:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802e66:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802e6a:	45 01 ee             	add    %r13d,%r14d
+  802e6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e71:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802e75:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802e78:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e7c:	49 39 c7             	cmp    %rax,%r15
+  802e7f:	0f 83 a0 fe ff ff    	jae    802d25 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802e85:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e89:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802e8d:	8b 43 08             	mov    0x8(%rbx),%eax
+  802e90:	44 39 f0             	cmp    %r14d,%eax
+  802e93:	7f 10                	jg     802ea5 <devfile_write+0x1d3>
+  802e95:	48 98                	cltq
+  802e97:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802e9d:	49 63 d6             	movslq %r14d,%rdx
+  802ea0:	48 39 d0             	cmp    %rdx,%rax
+  802ea3:	7d 2d                	jge    802ed2 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802ea5:	48 89 de             	mov    %rbx,%rsi
+  802ea8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802eac:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  802eb3:	00 00 00 
+  802eb6:	ff d0                	call   *%rax
+  802eb8:	85 c0                	test   %eax,%eax
+  802eba:	0f 88 0a ff ff ff    	js     802dca <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802ec0:	44 89 f0             	mov    %r14d,%eax
+  802ec3:	66 b8 00 00          	mov    $0x0,%ax
+  802ec7:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802eca:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802ed1:	00 
+        size_t off = pos - fb->fb_base;
+  802ed2:	45 89 f4             	mov    %r14d,%r12d
+  802ed5:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802ed9:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802edc:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802ee0:	4d 29 fd             	sub    %r15,%r13
+  802ee3:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802ee8:	4c 29 e0             	sub    %r12,%rax
+  802eeb:	49 39 c5             	cmp    %rax,%r13
+  802eee:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802ef2:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802ef6:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802efa:	48 39 c2             	cmp    %rax,%rdx
+  802efd:	0f 84 f0 fe ff ff    	je     802df3 <devfile_write+0x121>
+  802f03:	4c 39 e0             	cmp    %r12,%rax
+  802f06:	0f 82 cc fe ff ff    	jb     802dd8 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802f0c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802f10:	48 39 d0             	cmp    %rdx,%rax
+  802f13:	0f 83 da fe ff ff    	jae    802df3 <devfile_write+0x121>
+  802f19:	e9 ba fe ff ff       	jmp    802dd8 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f1e:	48 98                	cltq
+  802f20:	4d 85 ff             	test   %r15,%r15
+  802f23:	49 0f 45 c7          	cmovne %r15,%rax
+  802f27:	e9 fc fd ff ff       	jmp    802d28 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802f2c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802f30:	4c 89 e2             	mov    %r12,%rdx
+  802f33:	e9 2a ff ff ff       	jmp    802e62 <devfile_write+0x190>
+
+0000000000802f38 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802f38:	55                   	push   %rbp
+  802f39:	48 89 e5             	mov    %rsp,%rbp
+  802f3c:	41 57                	push   %r15
+  802f3e:	41 56                	push   %r14
+  802f40:	41 55                	push   %r13
+  802f42:	41 54                	push   %r12
+  802f44:	53                   	push   %rbx
+  802f45:	48 83 ec 28          	sub    $0x28,%rsp
+  802f49:	49 89 ff             	mov    %rdi,%r15
+  802f4c:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f50:	48 89 d3             	mov    %rdx,%rbx
+  802f53:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f57:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  802f5e:	00 00 00 
+  802f61:	ff d0                	call   *%rax
+  802f63:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802f66:	48 85 c0             	test   %rax,%rax
+  802f69:	74 0d                	je     802f78 <devfile_read+0x40>
+  802f6b:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802f72:	0f 86 1a 01 00 00    	jbe    803092 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f78:	4d 85 e4             	test   %r12,%r12
+  802f7b:	74 1a                	je     802f97 <devfile_read+0x5f>
+  802f7d:	4c 89 e6             	mov    %r12,%rsi
+  802f80:	4c 89 ff             	mov    %r15,%rdi
+  802f83:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+  802f8f:	85 c0                	test   %eax,%eax
+  802f91:	0f 88 e8 00 00 00    	js     80307f <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802f97:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802f9b:	48 b8 9c 27 80 00 00 	movabs $0x80279c,%rax
+  802fa2:	00 00 00 
+  802fa5:	ff d0                	call   *%rax
+  802fa7:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802faa:	48 85 c0             	test   %rax,%rax
+  802fad:	0f 84 69 02 00 00    	je     80321c <devfile_read+0x2e4>
+    while (i < n) {
+  802fb3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802fb8:	0f 84 ce 00 00 00    	je     80308c <devfile_read+0x154>
+    size_t i = 0;
+  802fbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802fc3:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802fca:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802fce:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802fd2:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802fd6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802fda:	48 29 da             	sub    %rbx,%rdx
+  802fdd:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802fe2:	48 39 c2             	cmp    %rax,%rdx
+  802fe5:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802fe9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802fed:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802ff1:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802ff4:	01 d8                	add    %ebx,%eax
+  802ff6:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802ffa:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802ffe:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803005:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80300c:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803013:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803019:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80301e:	4c 89 ee             	mov    %r13,%rsi
+  803021:	bf 03 00 00 00       	mov    $0x3,%edi
+  803026:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  80302d:	00 00 00 
+  803030:	ff d0                	call   *%rax
+        if (res < 0)
+  803032:	85 c0                	test   %eax,%eax
+  803034:	78 4d                	js     803083 <devfile_read+0x14b>
+        if (res == 0)
+  803036:	74 4f                	je     803087 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803038:	4c 63 e0             	movslq %eax,%r12
+  80303b:	4c 89 e2             	mov    %r12,%rdx
+  80303e:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803042:	4c 89 f7             	mov    %r14,%rdi
+  803045:	48 b8 2d 11 80 00 00 	movabs $0x80112d,%rax
+  80304c:	00 00 00 
+  80304f:	ff d0                	call   *%rax
+        i += res;
+  803051:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803054:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803057:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80305b:	48 39 c3             	cmp    %rax,%rbx
+  80305e:	0f 82 72 ff ff ff    	jb     802fd6 <devfile_read+0x9e>
+    return i;
+  803064:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803067:	48 85 c0             	test   %rax,%rax
+  80306a:	7e 04                	jle    803070 <devfile_read+0x138>
+  80306c:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803070:	48 83 c4 28          	add    $0x28,%rsp
+  803074:	5b                   	pop    %rbx
+  803075:	41 5c                	pop    %r12
+  803077:	41 5d                	pop    %r13
+  803079:	41 5e                	pop    %r14
+  80307b:	41 5f                	pop    %r15
+  80307d:	5d                   	pop    %rbp
+  80307e:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80307f:	48 98                	cltq
+  803081:	eb ed                	jmp    803070 <devfile_read+0x138>
+            return res;
+  803083:	48 98                	cltq
+  803085:	eb e9                	jmp    803070 <devfile_read+0x138>
+            return i;
+  803087:	48 89 d8             	mov    %rbx,%rax
+  80308a:	eb db                	jmp    803067 <devfile_read+0x12f>
+    size_t i = 0;
+  80308c:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803090:	eb d2                	jmp    803064 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803092:	48 89 c6             	mov    %rax,%rsi
+  803095:	4c 89 ff             	mov    %r15,%rdi
+  803098:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  80309f:	00 00 00 
+  8030a2:	ff d0                	call   *%rax
+  8030a4:	85 c0                	test   %eax,%eax
+  8030a6:	78 40                	js     8030e8 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8030a8:	4c 89 ff             	mov    %r15,%rdi
+  8030ab:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  8030b2:	00 00 00 
+  8030b5:	ff d0                	call   *%rax
+  8030b7:	48 89 c2             	mov    %rax,%rdx
+  8030ba:	48 c1 e2 04          	shl    $0x4,%rdx
+  8030be:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8030c2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030c6:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8030cb:	48 01 d0             	add    %rdx,%rax
+  8030ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8030d2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8030d7:	0f 84 33 01 00 00    	je     803210 <devfile_read+0x2d8>
+    size_t i = 0;
+  8030dd:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8030e3:	e9 f5 00 00 00       	jmp    8031dd <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8030e8:	48 98                	cltq
+  8030ea:	eb 84                	jmp    803070 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8030ec:	44 89 e8             	mov    %r13d,%eax
+  8030ef:	66 b8 00 00          	mov    $0x0,%ax
+  8030f3:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8030f8:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8030ff:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803101:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803105:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803109:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  80310b:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803110:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803113:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  80311a:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  80311b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803121:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803126:	ba 00 10 01 00       	mov    $0x11000,%edx
+  80312b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803130:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  803137:	00 00 00 
+  80313a:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  80313c:	85 c0                	test   %eax,%eax
+  80313e:	0f 88 be 00 00 00    	js     803202 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803144:	48 63 d0             	movslq %eax,%rdx
+  803147:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  80314c:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803151:	44 39 e8             	cmp    %r13d,%eax
+  803154:	0f 8e ba 00 00 00    	jle    803214 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80315a:	49 63 c5             	movslq %r13d,%rax
+  80315d:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803162:	48 29 c3             	sub    %rax,%rbx
+  803165:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80316a:	48 01 c3             	add    %rax,%rbx
+  80316d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803171:	4c 29 f0             	sub    %r14,%rax
+  803174:	48 39 c3             	cmp    %rax,%rbx
+  803177:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80317b:	4c 89 ff             	mov    %r15,%rdi
+  80317e:	48 b9 ae 1e 80 00 00 	movabs $0x801eae,%rcx
+  803185:	00 00 00 
+  803188:	ff d1                	call   *%rcx
+  80318a:	48 89 c2             	mov    %rax,%rdx
+  80318d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803191:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803195:	48 c1 e0 0c          	shl    $0xc,%rax
+  803199:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  80319e:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8031a1:	44 89 ea             	mov    %r13d,%edx
+  8031a4:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8031a9:	48 63 d2             	movslq %edx,%rdx
+  8031ac:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8031b3:	00 
+  8031b4:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8031b8:	4c 01 f7             	add    %r14,%rdi
+  8031bb:	48 89 da             	mov    %rbx,%rdx
+  8031be:	48 b9 2d 11 80 00 00 	movabs $0x80112d,%rcx
+  8031c5:	00 00 00 
+  8031c8:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8031ca:	41 01 dd             	add    %ebx,%r13d
+  8031cd:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8031d1:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8031d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031d8:	49 39 c6             	cmp    %rax,%r14
+  8031db:	73 37                	jae    803214 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8031dd:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8031e1:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8031e6:	44 39 e8             	cmp    %r13d,%eax
+  8031e9:	0f 8f fd fe ff ff    	jg     8030ec <devfile_read+0x1b4>
+  8031ef:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8031f4:	44 39 e8             	cmp    %r13d,%eax
+  8031f7:	0f 8f 5d ff ff ff    	jg     80315a <devfile_read+0x222>
+  8031fd:	e9 ea fe ff ff       	jmp    8030ec <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803202:	48 98                	cltq
+  803204:	4d 85 f6             	test   %r14,%r14
+  803207:	49 0f 45 c6          	cmovne %r14,%rax
+  80320b:	e9 60 fe ff ff       	jmp    803070 <devfile_read+0x138>
+    size_t i = 0;
+  803210:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803214:	4c 89 f0             	mov    %r14,%rax
+  803217:	e9 54 fe ff ff       	jmp    803070 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80321c:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803223:	e9 48 fe ff ff       	jmp    803070 <devfile_read+0x138>
+
+0000000000803228 <open>:
+open(const char *path, int mode) {
+  803228:	55                   	push   %rbp
+  803229:	48 89 e5             	mov    %rsp,%rbp
+  80322c:	41 55                	push   %r13
+  80322e:	41 54                	push   %r12
+  803230:	53                   	push   %rbx
+  803231:	48 83 ec 18          	sub    $0x18,%rsp
+  803235:	49 89 fc             	mov    %rdi,%r12
+  803238:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80323b:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  803242:	00 00 00 
+  803245:	ff d0                	call   *%rax
+  803247:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80324d:	0f 87 8a 00 00 00    	ja     8032dd <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803253:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803257:	48 b8 dc 1e 80 00 00 	movabs $0x801edc,%rax
+  80325e:	00 00 00 
+  803261:	ff d0                	call   *%rax
+  803263:	89 c3                	mov    %eax,%ebx
+  803265:	85 c0                	test   %eax,%eax
+  803267:	78 50                	js     8032b9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803269:	4c 89 e6             	mov    %r12,%rsi
+  80326c:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803273:	00 00 00 
+  803276:	48 89 df             	mov    %rbx,%rdi
+  803279:	48 b8 38 0d 80 00 00 	movabs $0x800d38,%rax
+  803280:	00 00 00 
+  803283:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803285:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80328c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803290:	bf 01 00 00 00       	mov    $0x1,%edi
+  803295:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  80329c:	00 00 00 
+  80329f:	ff d0                	call   *%rax
+  8032a1:	89 c3                	mov    %eax,%ebx
+  8032a3:	85 c0                	test   %eax,%eax
+  8032a5:	78 1f                	js     8032c6 <open+0x9e>
+    return fd2num(fd);
+  8032a7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032ab:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  8032b2:	00 00 00 
+  8032b5:	ff d0                	call   *%rax
+  8032b7:	89 c3                	mov    %eax,%ebx
+}
+  8032b9:	89 d8                	mov    %ebx,%eax
+  8032bb:	48 83 c4 18          	add    $0x18,%rsp
+  8032bf:	5b                   	pop    %rbx
+  8032c0:	41 5c                	pop    %r12
+  8032c2:	41 5d                	pop    %r13
+  8032c4:	5d                   	pop    %rbp
+  8032c5:	c3                   	ret
+        fd_close(fd, 0);
+  8032c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8032cb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032cf:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  8032d6:	00 00 00 
+  8032d9:	ff d0                	call   *%rax
+        return res;
+  8032db:	eb dc                	jmp    8032b9 <open+0x91>
+        return -E_BAD_PATH;
+  8032dd:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8032e2:	eb d5                	jmp    8032b9 <open+0x91>
+
+00000000008032e4 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8032e4:	55                   	push   %rbp
+  8032e5:	48 89 e5             	mov    %rsp,%rbp
+  8032e8:	41 57                	push   %r15
+  8032ea:	41 56                	push   %r14
+  8032ec:	41 55                	push   %r13
+  8032ee:	41 54                	push   %r12
+  8032f0:	53                   	push   %rbx
+  8032f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8032f5:	41 89 f6             	mov    %esi,%r14d
+  8032f8:	49 89 d7             	mov    %rdx,%r15
+  8032fb:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032fe:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803302:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  803309:	00 00 00 
+  80330c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80330e:	85 c0                	test   %eax,%eax
+  803310:	0f 88 db 00 00 00    	js     8033f1 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803316:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80331a:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803321:	00 00 00 
+  803324:	8b 00                	mov    (%rax),%eax
+  803326:	39 07                	cmp    %eax,(%rdi)
+  803328:	0f 85 db 00 00 00    	jne    803409 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80332e:	45 85 f6             	test   %r14d,%r14d
+  803331:	0f 88 db 00 00 00    	js     803412 <fmap+0x12e>
+  803337:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80333e:	0f 85 d7 00 00 00    	jne    80341b <fmap+0x137>
+  803344:	4c 89 fb             	mov    %r15,%rbx
+  803347:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80334d:	0f 85 d1 00 00 00    	jne    803424 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803353:	48 b8 74 2a 80 00 00 	movabs $0x802a74,%rax
+  80335a:	00 00 00 
+  80335d:	ff d0                	call   *%rax
+  80335f:	85 c0                	test   %eax,%eax
+  803361:	0f 88 8e 00 00 00    	js     8033f5 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803367:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80336e:	00 00 00 
+    while (i < n) {
+  803371:	4d 85 ed             	test   %r13,%r13
+  803374:	0f 84 8a 00 00 00    	je     803404 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80337a:	4c 89 ea             	mov    %r13,%rdx
+  80337d:	48 29 da             	sub    %rbx,%rdx
+  803380:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803387:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80338d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803391:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803395:	8b 40 0c             	mov    0xc(%rax),%eax
+  803398:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80339c:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8033a0:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8033a5:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8033aa:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8033ae:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8033b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033b7:	4c 89 e6             	mov    %r12,%rsi
+  8033ba:	bf 09 00 00 00       	mov    $0x9,%edi
+  8033bf:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  8033c6:	00 00 00 
+  8033c9:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8033cb:	85 c0                	test   %eax,%eax
+  8033cd:	78 2a                	js     8033f9 <fmap+0x115>
+        i += res;
+  8033cf:	48 98                	cltq
+  8033d1:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8033d4:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8033d8:	72 05                	jb     8033df <fmap+0xfb>
+    while (i < n) {
+  8033da:	4c 39 eb             	cmp    %r13,%rbx
+  8033dd:	72 9b                	jb     80337a <fmap+0x96>
+    }
+    return i;
+  8033df:	48 89 d8             	mov    %rbx,%rax
+}
+  8033e2:	48 83 c4 18          	add    $0x18,%rsp
+  8033e6:	5b                   	pop    %rbx
+  8033e7:	41 5c                	pop    %r12
+  8033e9:	41 5d                	pop    %r13
+  8033eb:	41 5e                	pop    %r14
+  8033ed:	41 5f                	pop    %r15
+  8033ef:	5d                   	pop    %rbp
+  8033f0:	c3                   	ret
+    if (res < 0) return res;
+  8033f1:	48 98                	cltq
+  8033f3:	eb ed                	jmp    8033e2 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8033f5:	48 98                	cltq
+  8033f7:	eb e9                	jmp    8033e2 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8033f9:	48 98                	cltq
+  8033fb:	48 85 db             	test   %rbx,%rbx
+  8033fe:	48 0f 45 c3          	cmovne %rbx,%rax
+  803402:	eb de                	jmp    8033e2 <fmap+0xfe>
+    size_t i = 0;
+  803404:	4c 89 eb             	mov    %r13,%rbx
+  803407:	eb d6                	jmp    8033df <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803409:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803410:	eb d0                	jmp    8033e2 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803412:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803419:	eb c7                	jmp    8033e2 <fmap+0xfe>
+  80341b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803422:	eb be                	jmp    8033e2 <fmap+0xfe>
+  803424:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80342b:	eb b5                	jmp    8033e2 <fmap+0xfe>
+
+000000000080342d <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80342d:	55                   	push   %rbp
+  80342e:	48 89 e5             	mov    %rsp,%rbp
+  803431:	41 56                	push   %r14
+  803433:	41 55                	push   %r13
+  803435:	41 54                	push   %r12
+  803437:	53                   	push   %rbx
+  803438:	48 83 ec 10          	sub    $0x10,%rsp
+  80343c:	89 fb                	mov    %edi,%ebx
+  80343e:	41 89 f4             	mov    %esi,%r12d
+  803441:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803444:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803448:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  80344f:	00 00 00 
+  803452:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803454:	85 c0                	test   %eax,%eax
+  803456:	78 63                	js     8034bb <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803458:	45 85 e4             	test   %r12d,%r12d
+  80345b:	0f 88 80 00 00 00    	js     8034e1 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803461:	45 89 e6             	mov    %r12d,%r14d
+  803464:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80346b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80346f:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  803476:	00 00 00 
+  803479:	ff d0                	call   *%rax
+  80347b:	48 89 c2             	mov    %rax,%rdx
+  80347e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803483:	44 89 f6             	mov    %r14d,%esi
+  803486:	89 df                	mov    %ebx,%edi
+  803488:	48 b8 e4 32 80 00 00 	movabs $0x8032e4,%rax
+  80348f:	00 00 00 
+  803492:	ff d0                	call   *%rax
+  803494:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803497:	45 29 f4             	sub    %r14d,%r12d
+  80349a:	4d 63 f4             	movslq %r12d,%r14
+  80349d:	49 39 c6             	cmp    %rax,%r14
+  8034a0:	7c 1d                	jl     8034bf <read_map+0x92>
+  8034a2:	48 85 c0             	test   %rax,%rax
+  8034a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034aa:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8034ae:	48 83 c4 10          	add    $0x10,%rsp
+  8034b2:	5b                   	pop    %rbx
+  8034b3:	41 5c                	pop    %r12
+  8034b5:	41 5d                	pop    %r13
+  8034b7:	41 5e                	pop    %r14
+  8034b9:	5d                   	pop    %rbp
+  8034ba:	c3                   	ret
+    if (res < 0) return res;
+  8034bb:	48 98                	cltq
+  8034bd:	eb ef                	jmp    8034ae <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8034bf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034c3:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  8034ca:	00 00 00 
+  8034cd:	ff d0                	call   *%rax
+  8034cf:	4d 63 e4             	movslq %r12d,%r12
+  8034d2:	4c 01 e0             	add    %r12,%rax
+  8034d5:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8034d9:	48 89 d8             	mov    %rbx,%rax
+  8034dc:	4c 29 f0             	sub    %r14,%rax
+  8034df:	eb cd                	jmp    8034ae <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8034e1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034e8:	eb c4                	jmp    8034ae <read_map+0x81>
+
+00000000008034ea <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8034ea:	55                   	push   %rbp
+  8034eb:	48 89 e5             	mov    %rsp,%rbp
+  8034ee:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034f2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034f6:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  8034fd:	00 00 00 
+  803500:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803502:	85 c0                	test   %eax,%eax
+  803504:	78 4a                	js     803550 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803506:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80350a:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803511:	00 00 00 
+  803514:	8b 00                	mov    (%rax),%eax
+  803516:	39 07                	cmp    %eax,(%rdi)
+  803518:	75 38                	jne    803552 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80351a:	48 b8 74 2a 80 00 00 	movabs $0x802a74,%rax
+  803521:	00 00 00 
+  803524:	ff d0                	call   *%rax
+  803526:	85 c0                	test   %eax,%eax
+  803528:	78 26                	js     803550 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80352a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80352e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803531:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803538:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80353a:	be 00 00 00 00       	mov    $0x0,%esi
+  80353f:	bf 06 00 00 00       	mov    $0x6,%edi
+  803544:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  80354b:	00 00 00 
+  80354e:	ff d0                	call   *%rax
+}
+  803550:	c9                   	leave
+  803551:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803552:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803557:	eb f7                	jmp    803550 <fsync+0x66>
+
+0000000000803559 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803559:	55                   	push   %rbp
+  80355a:	48 89 e5             	mov    %rsp,%rbp
+  80355d:	41 57                	push   %r15
+  80355f:	41 56                	push   %r14
+  803561:	41 55                	push   %r13
+  803563:	41 54                	push   %r12
+  803565:	53                   	push   %rbx
+  803566:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80356a:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803571:	00 00 00 
+  803574:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803579:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80357f:	49 bd 3c 1f 80 00 00 	movabs $0x801f3c,%r13
+  803586:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803589:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803590:	00 00 00 
+  803593:	eb 0c                	jmp    8035a1 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803595:	83 c3 01             	add    $0x1,%ebx
+  803598:	49 83 c4 28          	add    $0x28,%r12
+  80359c:	83 fb 20             	cmp    $0x20,%ebx
+  80359f:	74 33                	je     8035d4 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8035a1:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8035a6:	74 ed                	je     803595 <flushall+0x3c>
+  8035a8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8035ac:	89 df                	mov    %ebx,%edi
+  8035ae:	41 ff d5             	call   *%r13
+  8035b1:	85 c0                	test   %eax,%eax
+  8035b3:	78 e0                	js     803595 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8035b5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8035b9:	41 8b 06             	mov    (%r14),%eax
+  8035bc:	39 07                	cmp    %eax,(%rdi)
+  8035be:	75 d5                	jne    803595 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8035c0:	48 b8 74 2a 80 00 00 	movabs $0x802a74,%rax
+  8035c7:	00 00 00 
+  8035ca:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8035cc:	85 c0                	test   %eax,%eax
+  8035ce:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8035d2:	eb c1                	jmp    803595 <flushall+0x3c>
+    }
+    return res;
+}
+  8035d4:	44 89 f8             	mov    %r15d,%eax
+  8035d7:	48 83 c4 18          	add    $0x18,%rsp
+  8035db:	5b                   	pop    %rbx
+  8035dc:	41 5c                	pop    %r12
+  8035de:	41 5d                	pop    %r13
+  8035e0:	41 5e                	pop    %r14
+  8035e2:	41 5f                	pop    %r15
+  8035e4:	5d                   	pop    %rbp
+  8035e5:	c3                   	ret
+
+00000000008035e6 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8035e6:	55                   	push   %rbp
+  8035e7:	48 89 e5             	mov    %rsp,%rbp
+  8035ea:	53                   	push   %rbx
+  8035eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8035ef:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8035f2:	40 0f b6 c6          	movzbl %sil,%eax
+  8035f6:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8035fd:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8035ff:	be 00 00 00 00       	mov    $0x0,%esi
+  803604:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803609:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  803610:	00 00 00 
+  803613:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803615:	85 c0                	test   %eax,%eax
+  803617:	78 23                	js     80363c <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803619:	ba 58 06 00 00       	mov    $0x658,%edx
+  80361e:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803625:	00 00 00 
+  803628:	48 89 df             	mov    %rbx,%rdi
+  80362b:	48 b8 2d 11 80 00 00 	movabs $0x80112d,%rax
+  803632:	00 00 00 
+  803635:	ff d0                	call   *%rax
+    return 0;
+  803637:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80363c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803640:	c9                   	leave
+  803641:	c3                   	ret
+
+0000000000803642 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803642:	55                   	push   %rbp
+  803643:	48 89 e5             	mov    %rsp,%rbp
+  803646:	53                   	push   %rbx
+  803647:	48 83 ec 08          	sub    $0x8,%rsp
+  80364b:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  80364e:	48 b8 fa 0c 80 00 00 	movabs $0x800cfa,%rax
+  803655:	00 00 00 
+  803658:	ff d0                	call   *%rax
+  80365a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803660:	77 35                	ja     803697 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803662:	48 89 de             	mov    %rbx,%rsi
+  803665:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80366c:	00 00 00 
+  80366f:	48 b8 38 0d 80 00 00 	movabs $0x800d38,%rax
+  803676:	00 00 00 
+  803679:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80367b:	be 00 00 00 00       	mov    $0x0,%esi
+  803680:	bf 07 00 00 00       	mov    $0x7,%edi
+  803685:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  80368c:	00 00 00 
+  80368f:	ff d0                	call   *%rax
+}
+  803691:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803695:	c9                   	leave
+  803696:	c3                   	ret
+        return -E_BAD_PATH;
+  803697:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80369c:	eb f3                	jmp    803691 <remove+0x4f>
+
+000000000080369e <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80369e:	55                   	push   %rbp
+  80369f:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8036a2:	48 b8 59 35 80 00 00 	movabs $0x803559,%rax
+  8036a9:	00 00 00 
+  8036ac:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8036ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8036b3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8036b8:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  8036bf:	00 00 00 
+  8036c2:	ff d0                	call   *%rax
+}
+  8036c4:	5d                   	pop    %rbp
+  8036c5:	c3                   	ret
+
+00000000008036c6 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8036c6:	55                   	push   %rbp
+  8036c7:	48 89 e5             	mov    %rsp,%rbp
+  8036ca:	41 54                	push   %r12
+  8036cc:	53                   	push   %rbx
+  8036cd:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036d0:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  8036d7:	00 00 00 
+  8036da:	ff d0                	call   *%rax
+  8036dc:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8036df:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  8036e6:	00 00 00 
+  8036e9:	48 89 df             	mov    %rbx,%rdi
+  8036ec:	48 b8 38 0d 80 00 00 	movabs $0x800d38,%rax
+  8036f3:	00 00 00 
+  8036f6:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8036f8:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8036fd:	41 2b 04 24          	sub    (%r12),%eax
+  803701:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803707:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80370e:	00 00 00 
+    stat->st_dev = &devpipe;
+  803711:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803718:	00 00 00 
+  80371b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803722:	b8 00 00 00 00       	mov    $0x0,%eax
+  803727:	5b                   	pop    %rbx
+  803728:	41 5c                	pop    %r12
+  80372a:	5d                   	pop    %rbp
+  80372b:	c3                   	ret
+
+000000000080372c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80372c:	55                   	push   %rbp
+  80372d:	48 89 e5             	mov    %rsp,%rbp
+  803730:	41 54                	push   %r12
+  803732:	53                   	push   %rbx
+  803733:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803736:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80373b:	48 89 fe             	mov    %rdi,%rsi
+  80373e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803743:	49 bc 77 16 80 00 00 	movabs $0x801677,%r12
+  80374a:	00 00 00 
+  80374d:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803750:	48 89 df             	mov    %rbx,%rdi
+  803753:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  80375a:	00 00 00 
+  80375d:	ff d0                	call   *%rax
+  80375f:	48 89 c6             	mov    %rax,%rsi
+  803762:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803767:	bf 00 00 00 00       	mov    $0x0,%edi
+  80376c:	41 ff d4             	call   *%r12
+}
+  80376f:	5b                   	pop    %rbx
+  803770:	41 5c                	pop    %r12
+  803772:	5d                   	pop    %rbp
+  803773:	c3                   	ret
+
+0000000000803774 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803774:	55                   	push   %rbp
+  803775:	48 89 e5             	mov    %rsp,%rbp
+  803778:	41 57                	push   %r15
+  80377a:	41 56                	push   %r14
+  80377c:	41 55                	push   %r13
+  80377e:	41 54                	push   %r12
+  803780:	53                   	push   %rbx
+  803781:	48 83 ec 18          	sub    $0x18,%rsp
+  803785:	49 89 fc             	mov    %rdi,%r12
+  803788:	49 89 f5             	mov    %rsi,%r13
+  80378b:	49 89 d7             	mov    %rdx,%r15
+  80378e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803792:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  803799:	00 00 00 
+  80379c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80379e:	4d 85 ff             	test   %r15,%r15
+  8037a1:	0f 84 af 00 00 00    	je     803856 <devpipe_write+0xe2>
+  8037a7:	48 89 c3             	mov    %rax,%rbx
+  8037aa:	4c 89 f8             	mov    %r15,%rax
+  8037ad:	4d 89 ef             	mov    %r13,%r15
+  8037b0:	4c 01 e8             	add    %r13,%rax
+  8037b3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8037b7:	49 bd 6c 14 80 00 00 	movabs $0x80146c,%r13
+  8037be:	00 00 00 
+            sys_yield();
+  8037c1:	49 be 09 14 80 00 00 	movabs $0x801409,%r14
+  8037c8:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8037cb:	8b 73 04             	mov    0x4(%rbx),%esi
+  8037ce:	48 63 ce             	movslq %esi,%rcx
+  8037d1:	48 63 03             	movslq (%rbx),%rax
+  8037d4:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8037da:	48 39 c1             	cmp    %rax,%rcx
+  8037dd:	72 2e                	jb     80380d <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8037df:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8037e4:	48 89 da             	mov    %rbx,%rdx
+  8037e7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037ec:	4c 89 e7             	mov    %r12,%rdi
+  8037ef:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8037f2:	85 c0                	test   %eax,%eax
+  8037f4:	74 66                	je     80385c <devpipe_write+0xe8>
+            sys_yield();
+  8037f6:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8037f9:	8b 73 04             	mov    0x4(%rbx),%esi
+  8037fc:	48 63 ce             	movslq %esi,%rcx
+  8037ff:	48 63 03             	movslq (%rbx),%rax
+  803802:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803808:	48 39 c1             	cmp    %rax,%rcx
+  80380b:	73 d2                	jae    8037df <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80380d:	41 0f b6 3f          	movzbl (%r15),%edi
+  803811:	48 89 ca             	mov    %rcx,%rdx
+  803814:	48 c1 ea 03          	shr    $0x3,%rdx
+  803818:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80381f:	08 10 20 
+  803822:	48 f7 e2             	mul    %rdx
+  803825:	48 c1 ea 06          	shr    $0x6,%rdx
+  803829:	48 89 d0             	mov    %rdx,%rax
+  80382c:	48 c1 e0 09          	shl    $0x9,%rax
+  803830:	48 29 d0             	sub    %rdx,%rax
+  803833:	48 c1 e0 03          	shl    $0x3,%rax
+  803837:	48 29 c1             	sub    %rax,%rcx
+  80383a:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80383f:	83 c6 01             	add    $0x1,%esi
+  803842:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803845:	49 83 c7 01          	add    $0x1,%r15
+  803849:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80384d:	49 39 c7             	cmp    %rax,%r15
+  803850:	0f 85 75 ff ff ff    	jne    8037cb <devpipe_write+0x57>
+    return n;
+  803856:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80385a:	eb 05                	jmp    803861 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80385c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803861:	48 83 c4 18          	add    $0x18,%rsp
+  803865:	5b                   	pop    %rbx
+  803866:	41 5c                	pop    %r12
+  803868:	41 5d                	pop    %r13
+  80386a:	41 5e                	pop    %r14
+  80386c:	41 5f                	pop    %r15
+  80386e:	5d                   	pop    %rbp
+  80386f:	c3                   	ret
+
+0000000000803870 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803870:	55                   	push   %rbp
+  803871:	48 89 e5             	mov    %rsp,%rbp
+  803874:	41 57                	push   %r15
+  803876:	41 56                	push   %r14
+  803878:	41 55                	push   %r13
+  80387a:	41 54                	push   %r12
+  80387c:	53                   	push   %rbx
+  80387d:	48 83 ec 18          	sub    $0x18,%rsp
+  803881:	49 89 fc             	mov    %rdi,%r12
+  803884:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803888:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80388c:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  803893:	00 00 00 
+  803896:	ff d0                	call   *%rax
+  803898:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80389b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8038a1:	49 bd 6c 14 80 00 00 	movabs $0x80146c,%r13
+  8038a8:	00 00 00 
+            sys_yield();
+  8038ab:	49 be 09 14 80 00 00 	movabs $0x801409,%r14
+  8038b2:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8038b5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8038ba:	74 7d                	je     803939 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8038bc:	8b 03                	mov    (%rbx),%eax
+  8038be:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8038c1:	75 26                	jne    8038e9 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8038c3:	4d 85 ff             	test   %r15,%r15
+  8038c6:	75 77                	jne    80393f <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8038c8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8038cd:	48 89 da             	mov    %rbx,%rdx
+  8038d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8038d5:	4c 89 e7             	mov    %r12,%rdi
+  8038d8:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8038db:	85 c0                	test   %eax,%eax
+  8038dd:	74 72                	je     803951 <devpipe_read+0xe1>
+            sys_yield();
+  8038df:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8038e2:	8b 03                	mov    (%rbx),%eax
+  8038e4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8038e7:	74 df                	je     8038c8 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8038e9:	48 63 c8             	movslq %eax,%rcx
+  8038ec:	48 89 ca             	mov    %rcx,%rdx
+  8038ef:	48 c1 ea 03          	shr    $0x3,%rdx
+  8038f3:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8038fa:	08 10 20 
+  8038fd:	48 89 d0             	mov    %rdx,%rax
+  803900:	48 f7 e6             	mul    %rsi
+  803903:	48 c1 ea 06          	shr    $0x6,%rdx
+  803907:	48 89 d0             	mov    %rdx,%rax
+  80390a:	48 c1 e0 09          	shl    $0x9,%rax
+  80390e:	48 29 d0             	sub    %rdx,%rax
+  803911:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803918:	00 
+  803919:	48 89 c8             	mov    %rcx,%rax
+  80391c:	48 29 d0             	sub    %rdx,%rax
+  80391f:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803924:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803928:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80392c:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80392f:	49 83 c7 01          	add    $0x1,%r15
+  803933:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803937:	75 83                	jne    8038bc <devpipe_read+0x4c>
+    return n;
+  803939:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80393d:	eb 03                	jmp    803942 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80393f:	4c 89 f8             	mov    %r15,%rax
+}
+  803942:	48 83 c4 18          	add    $0x18,%rsp
+  803946:	5b                   	pop    %rbx
+  803947:	41 5c                	pop    %r12
+  803949:	41 5d                	pop    %r13
+  80394b:	41 5e                	pop    %r14
+  80394d:	41 5f                	pop    %r15
+  80394f:	5d                   	pop    %rbp
+  803950:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803951:	b8 00 00 00 00       	mov    $0x0,%eax
+  803956:	eb ea                	jmp    803942 <devpipe_read+0xd2>
+
+0000000000803958 <pipe>:
+pipe(int pfd[2]) {
+  803958:	55                   	push   %rbp
+  803959:	48 89 e5             	mov    %rsp,%rbp
+  80395c:	41 55                	push   %r13
+  80395e:	41 54                	push   %r12
+  803960:	53                   	push   %rbx
+  803961:	48 83 ec 18          	sub    $0x18,%rsp
+  803965:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803968:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80396c:	48 b8 dc 1e 80 00 00 	movabs $0x801edc,%rax
+  803973:	00 00 00 
+  803976:	ff d0                	call   *%rax
+  803978:	89 c3                	mov    %eax,%ebx
+  80397a:	85 c0                	test   %eax,%eax
+  80397c:	0f 88 a0 01 00 00    	js     803b22 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803982:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803987:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80398c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803990:	bf 00 00 00 00       	mov    $0x0,%edi
+  803995:	48 b8 98 14 80 00 00 	movabs $0x801498,%rax
+  80399c:	00 00 00 
+  80399f:	ff d0                	call   *%rax
+  8039a1:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8039a3:	85 c0                	test   %eax,%eax
+  8039a5:	0f 88 77 01 00 00    	js     803b22 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039ab:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8039af:	48 b8 dc 1e 80 00 00 	movabs $0x801edc,%rax
+  8039b6:	00 00 00 
+  8039b9:	ff d0                	call   *%rax
+  8039bb:	89 c3                	mov    %eax,%ebx
+  8039bd:	85 c0                	test   %eax,%eax
+  8039bf:	0f 88 43 01 00 00    	js     803b08 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8039c5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039cf:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8039d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d8:	48 b8 98 14 80 00 00 	movabs $0x801498,%rax
+  8039df:	00 00 00 
+  8039e2:	ff d0                	call   *%rax
+  8039e4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039e6:	85 c0                	test   %eax,%eax
+  8039e8:	0f 88 1a 01 00 00    	js     803b08 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8039ee:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8039f2:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  8039f9:	00 00 00 
+  8039fc:	ff d0                	call   *%rax
+  8039fe:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803a01:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a06:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a0b:	48 89 c6             	mov    %rax,%rsi
+  803a0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a13:	48 b8 98 14 80 00 00 	movabs $0x801498,%rax
+  803a1a:	00 00 00 
+  803a1d:	ff d0                	call   *%rax
+  803a1f:	89 c3                	mov    %eax,%ebx
+  803a21:	85 c0                	test   %eax,%eax
+  803a23:	0f 88 c5 00 00 00    	js     803aee <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803a29:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a2d:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  803a34:	00 00 00 
+  803a37:	ff d0                	call   *%rax
+  803a39:	48 89 c1             	mov    %rax,%rcx
+  803a3c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803a42:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803a48:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a4d:	4c 89 ee             	mov    %r13,%rsi
+  803a50:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a55:	48 b8 ff 14 80 00 00 	movabs $0x8014ff,%rax
+  803a5c:	00 00 00 
+  803a5f:	ff d0                	call   *%rax
+  803a61:	89 c3                	mov    %eax,%ebx
+  803a63:	85 c0                	test   %eax,%eax
+  803a65:	78 6e                	js     803ad5 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a67:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a6c:	4c 89 ef             	mov    %r13,%rdi
+  803a6f:	48 b8 3a 14 80 00 00 	movabs $0x80143a,%rax
+  803a76:	00 00 00 
+  803a79:	ff d0                	call   *%rax
+  803a7b:	83 f8 02             	cmp    $0x2,%eax
+  803a7e:	0f 85 ab 00 00 00    	jne    803b2f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a84:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803a8b:	00 00 
+  803a8d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a91:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a93:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a97:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a9e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803aa2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803aa4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803aa8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803aaf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ab3:	48 bb ae 1e 80 00 00 	movabs $0x801eae,%rbx
+  803aba:	00 00 00 
+  803abd:	ff d3                	call   *%rbx
+  803abf:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ac3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ac7:	ff d3                	call   *%rbx
+  803ac9:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803ace:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ad3:	eb 4d                	jmp    803b22 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803ad5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ada:	4c 89 ee             	mov    %r13,%rsi
+  803add:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae2:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  803ae9:	00 00 00 
+  803aec:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803aee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803af3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803af7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803afc:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  803b03:	00 00 00 
+  803b06:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803b08:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b0d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b11:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b16:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  803b1d:	00 00 00 
+  803b20:	ff d0                	call   *%rax
+}
+  803b22:	89 d8                	mov    %ebx,%eax
+  803b24:	48 83 c4 18          	add    $0x18,%rsp
+  803b28:	5b                   	pop    %rbx
+  803b29:	41 5c                	pop    %r12
+  803b2b:	41 5d                	pop    %r13
+  803b2d:	5d                   	pop    %rbp
+  803b2e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b2f:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  803b36:	00 00 00 
+  803b39:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  803b40:	00 00 00 
+  803b43:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803b48:	48 bf 1c 57 80 00 00 	movabs $0x80571c,%rdi
+  803b4f:	00 00 00 
+  803b52:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b57:	49 b8 70 02 80 00 00 	movabs $0x800270,%r8
+  803b5e:	00 00 00 
+  803b61:	41 ff d0             	call   *%r8
+
+0000000000803b64 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b64:	55                   	push   %rbp
+  803b65:	48 89 e5             	mov    %rsp,%rbp
+  803b68:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b6c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b70:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  803b77:	00 00 00 
+  803b7a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b7c:	85 c0                	test   %eax,%eax
+  803b7e:	78 35                	js     803bb5 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b80:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b84:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  803b8b:	00 00 00 
+  803b8e:	ff d0                	call   *%rax
+  803b90:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b93:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b98:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b9d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ba1:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  803ba8:	00 00 00 
+  803bab:	ff d0                	call   *%rax
+  803bad:	85 c0                	test   %eax,%eax
+  803baf:	0f 94 c0             	sete   %al
+  803bb2:	0f b6 c0             	movzbl %al,%eax
+}
+  803bb5:	c9                   	leave
+  803bb6:	c3                   	ret
+
+0000000000803bb7 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803bb7:	48 89 f8             	mov    %rdi,%rax
+  803bba:	48 c1 e8 27          	shr    $0x27,%rax
+  803bbe:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803bc5:	7f 00 00 
+  803bc8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bcc:	f6 c2 01             	test   $0x1,%dl
+  803bcf:	74 6d                	je     803c3e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803bd1:	48 89 f8             	mov    %rdi,%rax
+  803bd4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bd8:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803bdf:	7f 00 00 
+  803be2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803be6:	f6 c2 01             	test   $0x1,%dl
+  803be9:	74 62                	je     803c4d <get_uvpt_entry+0x96>
+  803beb:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803bf2:	7f 00 00 
+  803bf5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bf9:	f6 c2 80             	test   $0x80,%dl
+  803bfc:	75 4f                	jne    803c4d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803bfe:	48 89 f8             	mov    %rdi,%rax
+  803c01:	48 c1 e8 15          	shr    $0x15,%rax
+  803c05:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803c0c:	7f 00 00 
+  803c0f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c13:	f6 c2 01             	test   $0x1,%dl
+  803c16:	74 44                	je     803c5c <get_uvpt_entry+0xa5>
+  803c18:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803c1f:	7f 00 00 
+  803c22:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c26:	f6 c2 80             	test   $0x80,%dl
+  803c29:	75 31                	jne    803c5c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803c2b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803c2f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803c36:	7f 00 00 
+  803c39:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803c3d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c3e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803c45:	7f 00 00 
+  803c48:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c4c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c4d:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c54:	7f 00 00 
+  803c57:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c5b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c5c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803c63:	7f 00 00 
+  803c66:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c6a:	c3                   	ret
+
+0000000000803c6b <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803c6b:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803c6e:	48 89 f9             	mov    %rdi,%rcx
+  803c71:	48 c1 e9 27          	shr    $0x27,%rcx
+  803c75:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803c7c:	7f 00 00 
+  803c7f:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803c83:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803c8a:	f6 c1 01             	test   $0x1,%cl
+  803c8d:	0f 84 b2 00 00 00    	je     803d45 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803c93:	48 89 f9             	mov    %rdi,%rcx
+  803c96:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803c9a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ca1:	7f 00 00 
+  803ca4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ca8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803caf:	40 f6 c6 01          	test   $0x1,%sil
+  803cb3:	0f 84 8c 00 00 00    	je     803d45 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803cb9:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803cc0:	7f 00 00 
+  803cc3:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803cc7:	a8 80                	test   $0x80,%al
+  803cc9:	75 7b                	jne    803d46 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ccb:	48 89 f9             	mov    %rdi,%rcx
+  803cce:	48 c1 e9 15          	shr    $0x15,%rcx
+  803cd2:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803cd9:	7f 00 00 
+  803cdc:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ce0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ce7:	40 f6 c6 01          	test   $0x1,%sil
+  803ceb:	74 58                	je     803d45 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803ced:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803cf4:	7f 00 00 
+  803cf7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803cfb:	a8 80                	test   $0x80,%al
+  803cfd:	75 6c                	jne    803d6b <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803cff:	48 89 f9             	mov    %rdi,%rcx
+  803d02:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803d06:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d0d:	7f 00 00 
+  803d10:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803d14:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803d1b:	40 f6 c6 01          	test   $0x1,%sil
+  803d1f:	74 24                	je     803d45 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803d21:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d28:	7f 00 00 
+  803d2b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d2f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d36:	ff ff 7f 
+  803d39:	48 21 c8             	and    %rcx,%rax
+  803d3c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803d42:	48 09 d0             	or     %rdx,%rax
+}
+  803d45:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803d46:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803d4d:	7f 00 00 
+  803d50:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d54:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d5b:	ff ff 7f 
+  803d5e:	48 21 c8             	and    %rcx,%rax
+  803d61:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803d67:	48 01 d0             	add    %rdx,%rax
+  803d6a:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803d6b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803d72:	7f 00 00 
+  803d75:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d79:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d80:	ff ff 7f 
+  803d83:	48 21 c8             	and    %rcx,%rax
+  803d86:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803d8c:	48 01 d0             	add    %rdx,%rax
+  803d8f:	c3                   	ret
+
+0000000000803d90 <get_prot>:
+
+int
+get_prot(void *va) {
+  803d90:	55                   	push   %rbp
+  803d91:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803d94:	48 b8 b7 3b 80 00 00 	movabs $0x803bb7,%rax
+  803d9b:	00 00 00 
+  803d9e:	ff d0                	call   *%rax
+  803da0:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803da3:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803da8:	89 c1                	mov    %eax,%ecx
+  803daa:	83 c9 04             	or     $0x4,%ecx
+  803dad:	f6 c2 01             	test   $0x1,%dl
+  803db0:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803db3:	89 c1                	mov    %eax,%ecx
+  803db5:	83 c9 02             	or     $0x2,%ecx
+  803db8:	f6 c2 02             	test   $0x2,%dl
+  803dbb:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803dbe:	89 c1                	mov    %eax,%ecx
+  803dc0:	83 c9 01             	or     $0x1,%ecx
+  803dc3:	48 85 d2             	test   %rdx,%rdx
+  803dc6:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803dc9:	89 c1                	mov    %eax,%ecx
+  803dcb:	83 c9 40             	or     $0x40,%ecx
+  803dce:	f6 c6 04             	test   $0x4,%dh
+  803dd1:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803dd4:	5d                   	pop    %rbp
+  803dd5:	c3                   	ret
+
+0000000000803dd6 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803dd6:	55                   	push   %rbp
+  803dd7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803dda:	48 b8 b7 3b 80 00 00 	movabs $0x803bb7,%rax
+  803de1:	00 00 00 
+  803de4:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803de6:	48 c1 e8 06          	shr    $0x6,%rax
+  803dea:	83 e0 01             	and    $0x1,%eax
+}
+  803ded:	5d                   	pop    %rbp
+  803dee:	c3                   	ret
+
+0000000000803def <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803def:	55                   	push   %rbp
+  803df0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803df3:	48 b8 b7 3b 80 00 00 	movabs $0x803bb7,%rax
+  803dfa:	00 00 00 
+  803dfd:	ff d0                	call   *%rax
+  803dff:	83 e0 01             	and    $0x1,%eax
+}
+  803e02:	5d                   	pop    %rbp
+  803e03:	c3                   	ret
+
+0000000000803e04 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803e04:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803e0b:	7f 00 00 
+  803e0e:	a8 01                	test   $0x1,%al
+  803e10:	75 06                	jne    803e18 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e17:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803e18:	55                   	push   %rbp
+  803e19:	48 89 e5             	mov    %rsp,%rbp
+  803e1c:	41 57                	push   %r15
+  803e1e:	41 56                	push   %r14
+  803e20:	41 55                	push   %r13
+  803e22:	41 54                	push   %r12
+  803e24:	53                   	push   %rbx
+  803e25:	48 83 ec 18          	sub    $0x18,%rsp
+  803e29:	49 89 fe             	mov    %rdi,%r14
+  803e2c:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803e2f:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803e36:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803e37:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803e3e:	7f 00 00 
+  803e41:	e9 81 00 00 00       	jmp    803ec7 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803e46:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803e4d:	49 39 dd             	cmp    %rbx,%r13
+  803e50:	74 2b                	je     803e7d <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803e52:	48 89 d8             	mov    %rbx,%rax
+  803e55:	48 c1 e8 0c          	shr    $0xc,%rax
+  803e59:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803e5d:	f6 c2 01             	test   $0x1,%dl
+  803e60:	74 e4                	je     803e46 <foreach_shared_region+0x42>
+  803e62:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803e66:	f6 c4 04             	test   $0x4,%ah
+  803e69:	74 db                	je     803e46 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803e6b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803e72:	4c 89 fa             	mov    %r15,%rdx
+  803e75:	48 89 df             	mov    %rbx,%rdi
+  803e78:	41 ff d6             	call   *%r14
+  803e7b:	eb c9                	jmp    803e46 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803e7d:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803e84:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803e88:	74 22                	je     803eac <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803e8a:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803e91:	48 89 d8             	mov    %rbx,%rax
+  803e94:	48 c1 e8 15          	shr    $0x15,%rax
+  803e98:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803e9f:	7f 00 00 
+  803ea2:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803ea6:	a8 01                	test   $0x1,%al
+  803ea8:	74 d3                	je     803e7d <foreach_shared_region+0x79>
+  803eaa:	eb a6                	jmp    803e52 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803eac:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803eb3:	40 
+  803eb4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803eb8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ebf:	00 00 00 
+  803ec2:	48 39 c1             	cmp    %rax,%rcx
+  803ec5:	74 31                	je     803ef8 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803ec7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ecb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ecf:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803ed6:	7f 00 00 
+  803ed9:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803edd:	a8 01                	test   $0x1,%al
+  803edf:	74 cb                	je     803eac <foreach_shared_region+0xa8>
+  803ee1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ee5:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803eec:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803ef2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803ef6:	eb 92                	jmp    803e8a <foreach_shared_region+0x86>
+}
+  803ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efd:	48 83 c4 18          	add    $0x18,%rsp
+  803f01:	5b                   	pop    %rbx
+  803f02:	41 5c                	pop    %r12
+  803f04:	41 5d                	pop    %r13
+  803f06:	41 5e                	pop    %r14
+  803f08:	41 5f                	pop    %r15
+  803f0a:	5d                   	pop    %rbp
+  803f0b:	c3                   	ret
+
+0000000000803f0c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f11:	c3                   	ret
+
+0000000000803f12 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803f12:	55                   	push   %rbp
+  803f13:	48 89 e5             	mov    %rsp,%rbp
+  803f16:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f19:	48 be 54 57 80 00 00 	movabs $0x805754,%rsi
+  803f20:	00 00 00 
+  803f23:	48 b8 38 0d 80 00 00 	movabs $0x800d38,%rax
+  803f2a:	00 00 00 
+  803f2d:	ff d0                	call   *%rax
+    return 0;
+}
+  803f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f34:	5d                   	pop    %rbp
+  803f35:	c3                   	ret
+
+0000000000803f36 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f36:	55                   	push   %rbp
+  803f37:	48 89 e5             	mov    %rsp,%rbp
+  803f3a:	41 57                	push   %r15
+  803f3c:	41 56                	push   %r14
+  803f3e:	41 55                	push   %r13
+  803f40:	41 54                	push   %r12
+  803f42:	53                   	push   %rbx
+  803f43:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803f4a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803f51:	48 85 d2             	test   %rdx,%rdx
+  803f54:	74 7a                	je     803fd0 <devcons_write+0x9a>
+  803f56:	49 89 d6             	mov    %rdx,%r14
+  803f59:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f5f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803f64:	49 bf c6 10 80 00 00 	movabs $0x8010c6,%r15
+  803f6b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803f6e:	4c 89 f3             	mov    %r14,%rbx
+  803f71:	48 29 f3             	sub    %rsi,%rbx
+  803f74:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803f79:	48 39 c3             	cmp    %rax,%rbx
+  803f7c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803f80:	4c 63 eb             	movslq %ebx,%r13
+  803f83:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803f8a:	48 01 c6             	add    %rax,%rsi
+  803f8d:	4c 89 ea             	mov    %r13,%rdx
+  803f90:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803f97:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803f9a:	4c 89 ee             	mov    %r13,%rsi
+  803f9d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fa4:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  803fab:	00 00 00 
+  803fae:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803fb0:	41 01 dc             	add    %ebx,%r12d
+  803fb3:	49 63 f4             	movslq %r12d,%rsi
+  803fb6:	4c 39 f6             	cmp    %r14,%rsi
+  803fb9:	72 b3                	jb     803f6e <devcons_write+0x38>
+    return res;
+  803fbb:	49 63 c4             	movslq %r12d,%rax
+}
+  803fbe:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803fc5:	5b                   	pop    %rbx
+  803fc6:	41 5c                	pop    %r12
+  803fc8:	41 5d                	pop    %r13
+  803fca:	41 5e                	pop    %r14
+  803fcc:	41 5f                	pop    %r15
+  803fce:	5d                   	pop    %rbp
+  803fcf:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803fd0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803fd6:	eb e3                	jmp    803fbb <devcons_write+0x85>
+
+0000000000803fd8 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803fd8:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803fdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fe0:	48 85 c0             	test   %rax,%rax
+  803fe3:	74 55                	je     80403a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803fe5:	55                   	push   %rbp
+  803fe6:	48 89 e5             	mov    %rsp,%rbp
+  803fe9:	41 55                	push   %r13
+  803feb:	41 54                	push   %r12
+  803fed:	53                   	push   %rbx
+  803fee:	48 83 ec 08          	sub    $0x8,%rsp
+  803ff2:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803ff5:	48 bb 3c 13 80 00 00 	movabs $0x80133c,%rbx
+  803ffc:	00 00 00 
+  803fff:	49 bc 09 14 80 00 00 	movabs $0x801409,%r12
+  804006:	00 00 00 
+  804009:	eb 03                	jmp    80400e <devcons_read+0x36>
+  80400b:	41 ff d4             	call   *%r12
+  80400e:	ff d3                	call   *%rbx
+  804010:	85 c0                	test   %eax,%eax
+  804012:	74 f7                	je     80400b <devcons_read+0x33>
+    if (c < 0) return c;
+  804014:	48 63 d0             	movslq %eax,%rdx
+  804017:	78 13                	js     80402c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804019:	ba 00 00 00 00       	mov    $0x0,%edx
+  80401e:	83 f8 04             	cmp    $0x4,%eax
+  804021:	74 09                	je     80402c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804023:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804027:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80402c:	48 89 d0             	mov    %rdx,%rax
+  80402f:	48 83 c4 08          	add    $0x8,%rsp
+  804033:	5b                   	pop    %rbx
+  804034:	41 5c                	pop    %r12
+  804036:	41 5d                	pop    %r13
+  804038:	5d                   	pop    %rbp
+  804039:	c3                   	ret
+  80403a:	48 89 d0             	mov    %rdx,%rax
+  80403d:	c3                   	ret
+
+000000000080403e <cputchar>:
+cputchar(int ch) {
+  80403e:	55                   	push   %rbp
+  80403f:	48 89 e5             	mov    %rsp,%rbp
+  804042:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804046:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80404a:	be 01 00 00 00       	mov    $0x1,%esi
+  80404f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804053:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  80405a:	00 00 00 
+  80405d:	ff d0                	call   *%rax
+}
+  80405f:	c9                   	leave
+  804060:	c3                   	ret
+
+0000000000804061 <getchar>:
+getchar(void) {
+  804061:	55                   	push   %rbp
+  804062:	48 89 e5             	mov    %rsp,%rbp
+  804065:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804069:	ba 01 00 00 00       	mov    $0x1,%edx
+  80406e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804072:	bf 00 00 00 00       	mov    $0x0,%edi
+  804077:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  80407e:	00 00 00 
+  804081:	ff d0                	call   *%rax
+  804083:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804085:	85 c0                	test   %eax,%eax
+  804087:	78 06                	js     80408f <getchar+0x2e>
+  804089:	74 08                	je     804093 <getchar+0x32>
+  80408b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80408f:	89 d0                	mov    %edx,%eax
+  804091:	c9                   	leave
+  804092:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804093:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804098:	eb f5                	jmp    80408f <getchar+0x2e>
+
+000000000080409a <iscons>:
+iscons(int fdnum) {
+  80409a:	55                   	push   %rbp
+  80409b:	48 89 e5             	mov    %rsp,%rbp
+  80409e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040a2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040a6:	48 b8 3c 1f 80 00 00 	movabs $0x801f3c,%rax
+  8040ad:	00 00 00 
+  8040b0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040b2:	85 c0                	test   %eax,%eax
+  8040b4:	78 18                	js     8040ce <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8040b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040ba:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8040c1:	00 00 00 
+  8040c4:	8b 00                	mov    (%rax),%eax
+  8040c6:	39 02                	cmp    %eax,(%rdx)
+  8040c8:	0f 94 c0             	sete   %al
+  8040cb:	0f b6 c0             	movzbl %al,%eax
+}
+  8040ce:	c9                   	leave
+  8040cf:	c3                   	ret
+
+00000000008040d0 <opencons>:
+opencons(void) {
+  8040d0:	55                   	push   %rbp
+  8040d1:	48 89 e5             	mov    %rsp,%rbp
+  8040d4:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8040d8:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8040dc:	48 b8 dc 1e 80 00 00 	movabs $0x801edc,%rax
+  8040e3:	00 00 00 
+  8040e6:	ff d0                	call   *%rax
+  8040e8:	85 c0                	test   %eax,%eax
+  8040ea:	78 49                	js     804135 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8040ec:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040f6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8040fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ff:	48 b8 98 14 80 00 00 	movabs $0x801498,%rax
+  804106:	00 00 00 
+  804109:	ff d0                	call   *%rax
+  80410b:	85 c0                	test   %eax,%eax
+  80410d:	78 26                	js     804135 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80410f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804113:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80411a:	00 00 
+  80411c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80411e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804122:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804129:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  804130:	00 00 00 
+  804133:	ff d0                	call   *%rax
+}
+  804135:	c9                   	leave
+  804136:	c3                   	ret
+
+0000000000804137 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804137:	55                   	push   %rbp
+  804138:	48 89 e5             	mov    %rsp,%rbp
+  80413b:	41 55                	push   %r13
+  80413d:	41 54                	push   %r12
+  80413f:	53                   	push   %rbx
+  804140:	48 83 ec 08          	sub    $0x8,%rsp
+  804144:	49 89 fc             	mov    %rdi,%r12
+  804147:	48 89 f7             	mov    %rsi,%rdi
+  80414a:	48 89 d3             	mov    %rdx,%rbx
+  80414d:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804150:	48 85 f6             	test   %rsi,%rsi
+  804153:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80415a:	00 00 00 
+  80415d:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804161:	be 00 10 00 00       	mov    $0x1000,%esi
+  804166:	48 85 d2             	test   %rdx,%rdx
+  804169:	74 03                	je     80416e <ipc_recv+0x37>
+  80416b:	48 8b 32             	mov    (%rdx),%rsi
+  80416e:	48 b8 45 18 80 00 00 	movabs $0x801845,%rax
+  804175:	00 00 00 
+  804178:	ff d0                	call   *%rax
+    if (errno) {
+  80417a:	85 c0                	test   %eax,%eax
+  80417c:	74 1c                	je     80419a <ipc_recv+0x63>
+        if (from_env_store)
+  80417e:	4d 85 e4             	test   %r12,%r12
+  804181:	74 08                	je     80418b <ipc_recv+0x54>
+            *from_env_store = 0;
+  804183:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80418a:	00 
+
+        if (perm_store)
+  80418b:	4d 85 ed             	test   %r13,%r13
+  80418e:	74 74                	je     804204 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804190:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804197:	00 
+  804198:	eb 6a                	jmp    804204 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80419a:	4d 85 e4             	test   %r12,%r12
+  80419d:	74 14                	je     8041b3 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80419f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041a6:	00 00 00 
+  8041a9:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8041af:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  8041b3:	48 85 db             	test   %rbx,%rbx
+  8041b6:	74 23                	je     8041db <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8041b8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041bf:	00 00 00 
+  8041c2:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8041c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041cd:	85 c9                	test   %ecx,%ecx
+  8041cf:	74 07                	je     8041d8 <ipc_recv+0xa1>
+  8041d1:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8041d8:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8041db:	4d 85 ed             	test   %r13,%r13
+  8041de:	74 14                	je     8041f4 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8041e0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041e7:	00 00 00 
+  8041ea:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8041f0:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8041f4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041fb:	00 00 00 
+  8041fe:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804204:	48 83 c4 08          	add    $0x8,%rsp
+  804208:	5b                   	pop    %rbx
+  804209:	41 5c                	pop    %r12
+  80420b:	41 5d                	pop    %r13
+  80420d:	5d                   	pop    %rbp
+  80420e:	c3                   	ret
+
+000000000080420f <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80420f:	55                   	push   %rbp
+  804210:	48 89 e5             	mov    %rsp,%rbp
+  804213:	41 55                	push   %r13
+  804215:	41 54                	push   %r12
+  804217:	53                   	push   %rbx
+  804218:	48 83 ec 08          	sub    $0x8,%rsp
+  80421c:	49 89 fc             	mov    %rdi,%r12
+  80421f:	48 89 f7             	mov    %rsi,%rdi
+  804222:	48 89 d3             	mov    %rdx,%rbx
+  804225:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804228:	48 85 f6             	test   %rsi,%rsi
+  80422b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804232:	00 00 00 
+  804235:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804239:	be 00 10 00 00       	mov    $0x1000,%esi
+  80423e:	48 85 d2             	test   %rdx,%rdx
+  804241:	74 03                	je     804246 <ipc_try_recv+0x37>
+  804243:	48 8b 32             	mov    (%rdx),%rsi
+  804246:	48 b8 ae 18 80 00 00 	movabs $0x8018ae,%rax
+  80424d:	00 00 00 
+  804250:	ff d0                	call   *%rax
+    if (errno) {
+  804252:	85 c0                	test   %eax,%eax
+  804254:	75 75                	jne    8042cb <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804256:	4d 85 e4             	test   %r12,%r12
+  804259:	74 14                	je     80426f <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  80425b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804262:	00 00 00 
+  804265:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80426b:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80426f:	48 85 db             	test   %rbx,%rbx
+  804272:	74 23                	je     804297 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804274:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80427b:	00 00 00 
+  80427e:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804284:	ba 00 00 00 00       	mov    $0x0,%edx
+  804289:	85 c9                	test   %ecx,%ecx
+  80428b:	74 07                	je     804294 <ipc_try_recv+0x85>
+  80428d:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804294:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804297:	4d 85 ed             	test   %r13,%r13
+  80429a:	74 14                	je     8042b0 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80429c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8042a3:	00 00 00 
+  8042a6:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8042ac:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8042b0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8042b7:	00 00 00 
+  8042ba:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  8042c0:	48 83 c4 08          	add    $0x8,%rsp
+  8042c4:	5b                   	pop    %rbx
+  8042c5:	41 5c                	pop    %r12
+  8042c7:	41 5d                	pop    %r13
+  8042c9:	5d                   	pop    %rbp
+  8042ca:	c3                   	ret
+        if (from_env_store)
+  8042cb:	4d 85 e4             	test   %r12,%r12
+  8042ce:	74 08                	je     8042d8 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8042d0:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8042d7:	00 
+        if (perm_store)
+  8042d8:	4d 85 ed             	test   %r13,%r13
+  8042db:	74 e3                	je     8042c0 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8042dd:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8042e4:	00 
+  8042e5:	eb d9                	jmp    8042c0 <ipc_try_recv+0xb1>
+
+00000000008042e7 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8042e7:	55                   	push   %rbp
+  8042e8:	48 89 e5             	mov    %rsp,%rbp
+  8042eb:	41 57                	push   %r15
+  8042ed:	41 56                	push   %r14
+  8042ef:	41 55                	push   %r13
+  8042f1:	41 54                	push   %r12
+  8042f3:	53                   	push   %rbx
+  8042f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8042f8:	41 89 fd             	mov    %edi,%r13d
+  8042fb:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8042fe:	48 89 d3             	mov    %rdx,%rbx
+  804301:	49 89 cc             	mov    %rcx,%r12
+  804304:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804308:	48 85 d2             	test   %rdx,%rdx
+  80430b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804312:	00 00 00 
+  804315:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804319:	49 be 19 18 80 00 00 	movabs $0x801819,%r14
+  804320:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804323:	49 bf 09 14 80 00 00 	movabs $0x801409,%r15
+  80432a:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80432d:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804330:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804334:	4c 89 e1             	mov    %r12,%rcx
+  804337:	48 89 da             	mov    %rbx,%rdx
+  80433a:	44 89 ef             	mov    %r13d,%edi
+  80433d:	41 ff d6             	call   *%r14
+  804340:	85 c0                	test   %eax,%eax
+  804342:	74 37                	je     80437b <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804344:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804347:	75 05                	jne    80434e <ipc_send+0x67>
+        sys_yield();
+  804349:	41 ff d7             	call   *%r15
+  80434c:	eb df                	jmp    80432d <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80434e:	89 c1                	mov    %eax,%ecx
+  804350:	48 ba 60 57 80 00 00 	movabs $0x805760,%rdx
+  804357:	00 00 00 
+  80435a:	be 65 00 00 00       	mov    $0x65,%esi
+  80435f:	48 bf 7b 57 80 00 00 	movabs $0x80577b,%rdi
+  804366:	00 00 00 
+  804369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80436e:	49 b8 70 02 80 00 00 	movabs $0x800270,%r8
+  804375:	00 00 00 
+  804378:	41 ff d0             	call   *%r8
+    }
+}
+  80437b:	48 83 c4 18          	add    $0x18,%rsp
+  80437f:	5b                   	pop    %rbx
+  804380:	41 5c                	pop    %r12
+  804382:	41 5d                	pop    %r13
+  804384:	41 5e                	pop    %r14
+  804386:	41 5f                	pop    %r15
+  804388:	5d                   	pop    %rbp
+  804389:	c3                   	ret
+
+000000000080438a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80438a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80438f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804396:	00 00 00 
+  804399:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8043a0:	48 01 ca             	add    %rcx,%rdx
+  8043a3:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8043a9:	39 fa                	cmp    %edi,%edx
+  8043ab:	74 12                	je     8043bf <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8043ad:	48 83 c0 01          	add    $0x1,%rax
+  8043b1:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8043b7:	75 e0                	jne    804399 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8043b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043be:	c3                   	ret
+            return envs[i].env_id;
+  8043bf:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8043c6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8043cd:	00 00 00 
+  8043d0:	48 01 d0             	add    %rdx,%rax
+  8043d3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8043d9:	c3                   	ret
+
+00000000008043da <__text_end>:
+  8043da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e1:	00 00 00 
+  8043e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043eb:	00 00 00 
+  8043ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f5:	00 00 00 
+  8043f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ff:	00 00 00 
+  804402:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804409:	00 00 00 
+  80440c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804413:	00 00 00 
+  804416:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441d:	00 00 00 
+  804420:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804427:	00 00 00 
+  80442a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804431:	00 00 00 
+  804434:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443b:	00 00 00 
+  80443e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804445:	00 00 00 
+  804448:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444f:	00 00 00 
+  804452:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804459:	00 00 00 
+  80445c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804463:	00 00 00 
+  804466:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446d:	00 00 00 
+  804470:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804477:	00 00 00 
+  80447a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804481:	00 00 00 
+  804484:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448b:	00 00 00 
+  80448e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804495:	00 00 00 
+  804498:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449f:	00 00 00 
+  8044a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a9:	00 00 00 
+  8044ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b3:	00 00 00 
+  8044b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bd:	00 00 00 
+  8044c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c7:	00 00 00 
+  8044ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d1:	00 00 00 
+  8044d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044db:	00 00 00 
+  8044de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e5:	00 00 00 
+  8044e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ef:	00 00 00 
+  8044f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f9:	00 00 00 
+  8044fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804503:	00 00 00 
+  804506:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450d:	00 00 00 
+  804510:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804517:	00 00 00 
+  80451a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804521:	00 00 00 
+  804524:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452b:	00 00 00 
+  80452e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804535:	00 00 00 
+  804538:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453f:	00 00 00 
+  804542:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804549:	00 00 00 
+  80454c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804553:	00 00 00 
+  804556:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455d:	00 00 00 
+  804560:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804567:	00 00 00 
+  80456a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804571:	00 00 00 
+  804574:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457b:	00 00 00 
+  80457e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804585:	00 00 00 
+  804588:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458f:	00 00 00 
+  804592:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804599:	00 00 00 
+  80459c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a3:	00 00 00 
+  8045a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ad:	00 00 00 
+  8045b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b7:	00 00 00 
+  8045ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c1:	00 00 00 
+  8045c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cb:	00 00 00 
+  8045ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d5:	00 00 00 
+  8045d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045df:	00 00 00 
+  8045e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e9:	00 00 00 
+  8045ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f3:	00 00 00 
+  8045f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fd:	00 00 00 
+  804600:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804607:	00 00 00 
+  80460a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804611:	00 00 00 
+  804614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461b:	00 00 00 
+  80461e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804625:	00 00 00 
+  804628:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462f:	00 00 00 
+  804632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804639:	00 00 00 
+  80463c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804643:	00 00 00 
+  804646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464d:	00 00 00 
+  804650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804657:	00 00 00 
+  80465a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804661:	00 00 00 
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467f:	00 00 00 
+  804682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804689:	00 00 00 
+  80468c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804693:	00 00 00 
+  804696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469d:	00 00 00 
+  8046a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a7:	00 00 00 
+  8046aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b1:	00 00 00 
+  8046b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bb:	00 00 00 
+  8046be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c5:	00 00 00 
+  8046c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cf:	00 00 00 
+  8046d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d9:	00 00 00 
+  8046dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e3:	00 00 00 
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
@@ -0,0 +1,8136 @@
+
+obj/user/echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 f0 00 00 00       	call   800113 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, nflag;
+
+    nflag = 0;
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800036:	83 ff 01             	cmp    $0x1,%edi
+  800039:	7f 25                	jg     800060 <umain+0x3b>
+        if (i > 1)
+            write(1, " ", 1);
+        write(1, argv[i], strlen(argv[i]));
+    }
+    if (!nflag)
+        write(1, "\n", 1);
+  80003b:	ba 01 00 00 00       	mov    $0x1,%edx
+  800040:	48 be 13 51 80 00 00 	movabs $0x805113,%rsi
+  800047:	00 00 00 
+  80004a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80004f:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  800056:	00 00 00 
+  800059:	ff d0                	call   *%rax
+}
+  80005b:	e9 a4 00 00 00       	jmp    800104 <umain+0xdf>
+  800060:	41 89 fe             	mov    %edi,%r14d
+  800063:	49 89 f4             	mov    %rsi,%r12
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800066:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  80006a:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  800071:	00 00 00 
+  800074:	48 b8 c1 02 80 00 00 	movabs $0x8002c1,%rax
+  80007b:	00 00 00 
+  80007e:	ff d0                	call   *%rax
+  800080:	85 c0                	test   %eax,%eax
+  800082:	75 30                	jne    8000b4 <umain+0x8f>
+        argc--;
+  800084:	41 83 ee 01          	sub    $0x1,%r14d
+        argv++;
+  800088:	49 83 c4 08          	add    $0x8,%r12
+    for (i = 1; i < argc; i++) {
+  80008c:	41 83 fe 01          	cmp    $0x1,%r14d
+  800090:	7e 72                	jle    800104 <umain+0xdf>
+        nflag = 1;
+  800092:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%rbp)
+  800099:	bb 01 00 00 00       	mov    $0x1,%ebx
+            write(1, " ", 1);
+  80009e:	49 bd 33 18 80 00 00 	movabs $0x801833,%r13
+  8000a5:	00 00 00 
+        write(1, argv[i], strlen(argv[i]));
+  8000a8:	49 bf df 01 80 00 00 	movabs $0x8001df,%r15
+  8000af:	00 00 00 
+  8000b2:	eb 28                	jmp    8000dc <umain+0xb7>
+    nflag = 0;
+  8000b4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8000bb:	eb dc                	jmp    800099 <umain+0x74>
+        write(1, argv[i], strlen(argv[i]));
+  8000bd:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  8000c1:	41 ff d7             	call   *%r15
+  8000c4:	48 89 c2             	mov    %rax,%rdx
+  8000c7:	49 8b 34 dc          	mov    (%r12,%rbx,8),%rsi
+  8000cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000d0:	41 ff d5             	call   *%r13
+    for (i = 1; i < argc; i++) {
+  8000d3:	48 83 c3 01          	add    $0x1,%rbx
+  8000d7:	41 39 de             	cmp    %ebx,%r14d
+  8000da:	7e 1e                	jle    8000fa <umain+0xd5>
+        if (i > 1)
+  8000dc:	83 fb 01             	cmp    $0x1,%ebx
+  8000df:	7e dc                	jle    8000bd <umain+0x98>
+            write(1, " ", 1);
+  8000e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000e6:	48 be 03 50 80 00 00 	movabs $0x805003,%rsi
+  8000ed:	00 00 00 
+  8000f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000f5:	41 ff d5             	call   *%r13
+  8000f8:	eb c3                	jmp    8000bd <umain+0x98>
+    if (!nflag)
+  8000fa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8000fe:	0f 84 37 ff ff ff    	je     80003b <umain+0x16>
+}
+  800104:	48 83 c4 18          	add    $0x18,%rsp
+  800108:	5b                   	pop    %rbx
+  800109:	41 5c                	pop    %r12
+  80010b:	41 5d                	pop    %r13
+  80010d:	41 5e                	pop    %r14
+  80010f:	41 5f                	pop    %r15
+  800111:	5d                   	pop    %rbp
+  800112:	c3                   	ret
+
+0000000000800113 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800113:	55                   	push   %rbp
+  800114:	48 89 e5             	mov    %rsp,%rbp
+  800117:	41 56                	push   %r14
+  800119:	41 55                	push   %r13
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+  80011e:	41 89 fd             	mov    %edi,%r13d
+  800121:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800124:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80012b:	00 00 00 
+  80012e:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800135:	00 00 00 
+  800138:	48 39 c2             	cmp    %rax,%rdx
+  80013b:	73 17                	jae    800154 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80013d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800140:	49 89 c4             	mov    %rax,%r12
+  800143:	48 83 c3 08          	add    $0x8,%rbx
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	ff 53 f8             	call   *-0x8(%rbx)
+  80014f:	4c 39 e3             	cmp    %r12,%rbx
+  800152:	72 ef                	jb     800143 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800154:	48 b8 bd 08 80 00 00 	movabs $0x8008bd,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+  800160:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800165:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80016c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800173:	00 00 00 
+  800176:	48 01 d0             	add    %rdx,%rax
+  800179:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800180:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800183:	45 85 ed             	test   %r13d,%r13d
+  800186:	7e 0d                	jle    800195 <libmain+0x82>
+  800188:	49 8b 06             	mov    (%r14),%rax
+  80018b:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800192:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800195:	4c 89 f6             	mov    %r14,%rsi
+  800198:	44 89 ef             	mov    %r13d,%edi
+  80019b:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001a2:	00 00 00 
+  8001a5:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001a7:	48 b8 bc 01 80 00 00 	movabs $0x8001bc,%rax
+  8001ae:	00 00 00 
+  8001b1:	ff d0                	call   *%rax
+#endif
+}
+  8001b3:	5b                   	pop    %rbx
+  8001b4:	41 5c                	pop    %r12
+  8001b6:	41 5d                	pop    %r13
+  8001b8:	41 5e                	pop    %r14
+  8001ba:	5d                   	pop    %rbp
+  8001bb:	c3                   	ret
+
+00000000008001bc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001bc:	55                   	push   %rbp
+  8001bd:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001c0:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  8001c7:	00 00 00 
+  8001ca:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001d1:	48 b8 52 08 80 00 00 	movabs $0x800852,%rax
+  8001d8:	00 00 00 
+  8001db:	ff d0                	call   *%rax
+}
+  8001dd:	5d                   	pop    %rbp
+  8001de:	c3                   	ret
+
+00000000008001df <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8001df:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8001e2:	74 10                	je     8001f4 <strlen+0x15>
+    size_t n = 0;
+  8001e4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8001e9:	48 83 c0 01          	add    $0x1,%rax
+  8001ed:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8001f1:	75 f6                	jne    8001e9 <strlen+0xa>
+  8001f3:	c3                   	ret
+    size_t n = 0;
+  8001f4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8001f9:	c3                   	ret
+
+00000000008001fa <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8001fa:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8001fd:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800202:	48 85 f6             	test   %rsi,%rsi
+  800205:	74 11                	je     800218 <strnlen+0x1e>
+  800207:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80020b:	74 0c                	je     800219 <strnlen+0x1f>
+  80020d:	48 83 c2 01          	add    $0x1,%rdx
+  800211:	48 39 d0             	cmp    %rdx,%rax
+  800214:	75 f1                	jne    800207 <strnlen+0xd>
+  800216:	eb 04                	jmp    80021c <strnlen+0x22>
+  800218:	c3                   	ret
+  800219:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80021c:	c3                   	ret
+
+000000000080021d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80021d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800220:	ba 00 00 00 00       	mov    $0x0,%edx
+  800225:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800229:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80022c:	48 83 c2 01          	add    $0x1,%rdx
+  800230:	84 c9                	test   %cl,%cl
+  800232:	75 f1                	jne    800225 <strcpy+0x8>
+        ;
+    return res;
+}
+  800234:	c3                   	ret
+
+0000000000800235 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800235:	55                   	push   %rbp
+  800236:	48 89 e5             	mov    %rsp,%rbp
+  800239:	41 54                	push   %r12
+  80023b:	53                   	push   %rbx
+  80023c:	48 89 fb             	mov    %rdi,%rbx
+  80023f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800242:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  800249:	00 00 00 
+  80024c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80024e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800252:	4c 89 e6             	mov    %r12,%rsi
+  800255:	48 b8 1d 02 80 00 00 	movabs $0x80021d,%rax
+  80025c:	00 00 00 
+  80025f:	ff d0                	call   *%rax
+    return dst;
+}
+  800261:	48 89 d8             	mov    %rbx,%rax
+  800264:	5b                   	pop    %rbx
+  800265:	41 5c                	pop    %r12
+  800267:	5d                   	pop    %rbp
+  800268:	c3                   	ret
+
+0000000000800269 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800269:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80026c:	48 85 d2             	test   %rdx,%rdx
+  80026f:	74 1f                	je     800290 <strncpy+0x27>
+  800271:	48 01 fa             	add    %rdi,%rdx
+  800274:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800277:	48 83 c1 01          	add    $0x1,%rcx
+  80027b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80027f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800283:	41 80 f8 01          	cmp    $0x1,%r8b
+  800287:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80028b:	48 39 ca             	cmp    %rcx,%rdx
+  80028e:	75 e7                	jne    800277 <strncpy+0xe>
+    }
+    return ret;
+}
+  800290:	c3                   	ret
+
+0000000000800291 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800291:	48 89 f8             	mov    %rdi,%rax
+  800294:	48 85 d2             	test   %rdx,%rdx
+  800297:	74 24                	je     8002bd <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800299:	48 83 ea 01          	sub    $0x1,%rdx
+  80029d:	74 1b                	je     8002ba <strlcpy+0x29>
+  80029f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8002a3:	0f b6 16             	movzbl (%rsi),%edx
+  8002a6:	84 d2                	test   %dl,%dl
+  8002a8:	74 10                	je     8002ba <strlcpy+0x29>
+            *dst++ = *src++;
+  8002aa:	48 83 c6 01          	add    $0x1,%rsi
+  8002ae:	48 83 c0 01          	add    $0x1,%rax
+  8002b2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8002b5:	48 39 c8             	cmp    %rcx,%rax
+  8002b8:	75 e9                	jne    8002a3 <strlcpy+0x12>
+        *dst = '\0';
+  8002ba:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8002bd:	48 29 f8             	sub    %rdi,%rax
+}
+  8002c0:	c3                   	ret
+
+00000000008002c1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8002c1:	0f b6 07             	movzbl (%rdi),%eax
+  8002c4:	84 c0                	test   %al,%al
+  8002c6:	74 13                	je     8002db <strcmp+0x1a>
+  8002c8:	38 06                	cmp    %al,(%rsi)
+  8002ca:	75 0f                	jne    8002db <strcmp+0x1a>
+  8002cc:	48 83 c7 01          	add    $0x1,%rdi
+  8002d0:	48 83 c6 01          	add    $0x1,%rsi
+  8002d4:	0f b6 07             	movzbl (%rdi),%eax
+  8002d7:	84 c0                	test   %al,%al
+  8002d9:	75 ed                	jne    8002c8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8002db:	0f b6 c0             	movzbl %al,%eax
+  8002de:	0f b6 16             	movzbl (%rsi),%edx
+  8002e1:	29 d0                	sub    %edx,%eax
+}
+  8002e3:	c3                   	ret
+
+00000000008002e4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8002e4:	48 85 d2             	test   %rdx,%rdx
+  8002e7:	74 1f                	je     800308 <strncmp+0x24>
+  8002e9:	0f b6 07             	movzbl (%rdi),%eax
+  8002ec:	84 c0                	test   %al,%al
+  8002ee:	74 1e                	je     80030e <strncmp+0x2a>
+  8002f0:	3a 06                	cmp    (%rsi),%al
+  8002f2:	75 1a                	jne    80030e <strncmp+0x2a>
+  8002f4:	48 83 c7 01          	add    $0x1,%rdi
+  8002f8:	48 83 c6 01          	add    $0x1,%rsi
+  8002fc:	48 83 ea 01          	sub    $0x1,%rdx
+  800300:	75 e7                	jne    8002e9 <strncmp+0x5>
+
+    if (!n) return 0;
+  800302:	b8 00 00 00 00       	mov    $0x0,%eax
+  800307:	c3                   	ret
+  800308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030d:	c3                   	ret
+  80030e:	48 85 d2             	test   %rdx,%rdx
+  800311:	74 09                	je     80031c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800313:	0f b6 07             	movzbl (%rdi),%eax
+  800316:	0f b6 16             	movzbl (%rsi),%edx
+  800319:	29 d0                	sub    %edx,%eax
+  80031b:	c3                   	ret
+    if (!n) return 0;
+  80031c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800321:	c3                   	ret
+
+0000000000800322 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800322:	0f b6 17             	movzbl (%rdi),%edx
+  800325:	84 d2                	test   %dl,%dl
+  800327:	74 18                	je     800341 <strchr+0x1f>
+        if (*str == c) {
+  800329:	0f be d2             	movsbl %dl,%edx
+  80032c:	39 f2                	cmp    %esi,%edx
+  80032e:	74 17                	je     800347 <strchr+0x25>
+    for (; *str; str++) {
+  800330:	48 83 c7 01          	add    $0x1,%rdi
+  800334:	0f b6 17             	movzbl (%rdi),%edx
+  800337:	84 d2                	test   %dl,%dl
+  800339:	75 ee                	jne    800329 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80033b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800340:	c3                   	ret
+  800341:	b8 00 00 00 00       	mov    $0x0,%eax
+  800346:	c3                   	ret
+  800347:	48 89 f8             	mov    %rdi,%rax
+}
+  80034a:	c3                   	ret
+
+000000000080034b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80034b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80034e:	0f b6 17             	movzbl (%rdi),%edx
+  800351:	84 d2                	test   %dl,%dl
+  800353:	74 13                	je     800368 <strfind+0x1d>
+  800355:	0f be d2             	movsbl %dl,%edx
+  800358:	39 f2                	cmp    %esi,%edx
+  80035a:	74 0b                	je     800367 <strfind+0x1c>
+  80035c:	48 83 c0 01          	add    $0x1,%rax
+  800360:	0f b6 10             	movzbl (%rax),%edx
+  800363:	84 d2                	test   %dl,%dl
+  800365:	75 ee                	jne    800355 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800367:	c3                   	ret
+  800368:	c3                   	ret
+
+0000000000800369 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800369:	55                   	push   %rbp
+  80036a:	48 89 e5             	mov    %rsp,%rbp
+  80036d:	41 57                	push   %r15
+  80036f:	41 56                	push   %r14
+  800371:	41 55                	push   %r13
+  800373:	41 54                	push   %r12
+  800375:	53                   	push   %rbx
+  800376:	48 83 ec 08          	sub    $0x8,%rsp
+  80037a:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  80037d:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800381:	45 84 ed             	test   %r13b,%r13b
+  800384:	75 12                	jne    800398 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800386:	4c 89 f8             	mov    %r15,%rax
+  800389:	48 83 c4 08          	add    $0x8,%rsp
+  80038d:	5b                   	pop    %rbx
+  80038e:	41 5c                	pop    %r12
+  800390:	41 5d                	pop    %r13
+  800392:	41 5e                	pop    %r14
+  800394:	41 5f                	pop    %r15
+  800396:	5d                   	pop    %rbp
+  800397:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800398:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  80039c:	4c 89 e7             	mov    %r12,%rdi
+  80039f:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  8003a6:	00 00 00 
+  8003a9:	ff d0                	call   *%rax
+  8003ab:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  8003ae:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  8003b2:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  8003b6:	49 bf e4 02 80 00 00 	movabs $0x8002e4,%r15
+  8003bd:	00 00 00 
+				if ((sc = *s++) == 0)
+  8003c0:	84 c0                	test   %al,%al
+  8003c2:	75 14                	jne    8003d8 <strstr+0x6f>
+					return NULL;
+  8003c4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8003ca:	eb ba                	jmp    800386 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  8003cc:	48 83 c3 01          	add    $0x1,%rbx
+  8003d0:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8003d4:	84 c0                	test   %al,%al
+  8003d6:	74 1b                	je     8003f3 <strstr+0x8a>
+			} while (sc != c);
+  8003d8:	41 38 c5             	cmp    %al,%r13b
+  8003db:	75 ef                	jne    8003cc <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  8003dd:	4c 89 f2             	mov    %r14,%rdx
+  8003e0:	4c 89 e6             	mov    %r12,%rsi
+  8003e3:	48 89 df             	mov    %rbx,%rdi
+  8003e6:	41 ff d7             	call   *%r15
+  8003e9:	85 c0                	test   %eax,%eax
+  8003eb:	75 df                	jne    8003cc <strstr+0x63>
+  8003ed:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  8003f1:	eb 93                	jmp    800386 <strstr+0x1d>
+					return NULL;
+  8003f3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8003f9:	eb 8b                	jmp    800386 <strstr+0x1d>
+
+00000000008003fb <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  8003fb:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  8003fd:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800400:	8d 57 20             	lea    0x20(%rdi),%edx
+  800403:	83 f9 1a             	cmp    $0x1a,%ecx
+  800406:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800409:	c3                   	ret
+
+000000000080040a <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  80040a:	55                   	push   %rbp
+  80040b:	48 89 e5             	mov    %rsp,%rbp
+  80040e:	41 57                	push   %r15
+  800410:	41 56                	push   %r14
+  800412:	41 55                	push   %r13
+  800414:	41 54                	push   %r12
+  800416:	53                   	push   %rbx
+  800417:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  80041b:	48 39 f7             	cmp    %rsi,%rdi
+  80041e:	74 49                	je     800469 <strcasecmp+0x5f>
+  800420:	49 89 fd             	mov    %rdi,%r13
+  800423:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800426:	49 bf fb 03 80 00 00 	movabs $0x8003fb,%r15
+  80042d:	00 00 00 
+  800430:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800435:	41 0f b6 fe          	movzbl %r14b,%edi
+  800439:	41 ff d7             	call   *%r15
+  80043c:	89 c3                	mov    %eax,%ebx
+  80043e:	49 83 c4 01          	add    $0x1,%r12
+  800442:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800448:	41 ff d7             	call   *%r15
+  80044b:	29 c3                	sub    %eax,%ebx
+  80044d:	75 09                	jne    800458 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  80044f:	49 83 c5 01          	add    $0x1,%r13
+  800453:	45 84 f6             	test   %r14b,%r14b
+  800456:	75 d8                	jne    800430 <strcasecmp+0x26>
+}
+  800458:	89 d8                	mov    %ebx,%eax
+  80045a:	48 83 c4 08          	add    $0x8,%rsp
+  80045e:	5b                   	pop    %rbx
+  80045f:	41 5c                	pop    %r12
+  800461:	41 5d                	pop    %r13
+  800463:	41 5e                	pop    %r14
+  800465:	41 5f                	pop    %r15
+  800467:	5d                   	pop    %rbp
+  800468:	c3                   	ret
+        return 0;
+  800469:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80046e:	eb e8                	jmp    800458 <strcasecmp+0x4e>
+
+0000000000800470 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800470:	55                   	push   %rbp
+  800471:	48 89 e5             	mov    %rsp,%rbp
+  800474:	41 57                	push   %r15
+  800476:	41 56                	push   %r14
+  800478:	41 55                	push   %r13
+  80047a:	41 54                	push   %r12
+  80047c:	53                   	push   %rbx
+  80047d:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800481:	48 85 d2             	test   %rdx,%rdx
+  800484:	74 4f                	je     8004d5 <strncasecmp+0x65>
+  800486:	49 89 fc             	mov    %rdi,%r12
+  800489:	49 89 f5             	mov    %rsi,%r13
+  80048c:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800490:	49 be fb 03 80 00 00 	movabs $0x8003fb,%r14
+  800497:	00 00 00 
+  80049a:	49 83 c4 01          	add    $0x1,%r12
+  80049e:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8004a4:	41 ff d6             	call   *%r14
+  8004a7:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  8004a9:	49 83 c5 01          	add    $0x1,%r13
+  8004ad:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  8004b2:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  8004b5:	29 c3                	sub    %eax,%ebx
+  8004b7:	85 c0                	test   %eax,%eax
+  8004b9:	74 09                	je     8004c4 <strncasecmp+0x54>
+  8004bb:	85 db                	test   %ebx,%ebx
+  8004bd:	75 05                	jne    8004c4 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8004bf:	4d 39 fc             	cmp    %r15,%r12
+  8004c2:	75 d6                	jne    80049a <strncasecmp+0x2a>
+}
+  8004c4:	89 d8                	mov    %ebx,%eax
+  8004c6:	48 83 c4 08          	add    $0x8,%rsp
+  8004ca:	5b                   	pop    %rbx
+  8004cb:	41 5c                	pop    %r12
+  8004cd:	41 5d                	pop    %r13
+  8004cf:	41 5e                	pop    %r14
+  8004d1:	41 5f                	pop    %r15
+  8004d3:	5d                   	pop    %rbp
+  8004d4:	c3                   	ret
+    int d = 0;
+  8004d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  8004da:	eb e8                	jmp    8004c4 <strncasecmp+0x54>
+
+00000000008004dc <toupper>:
+
+int toupper(int c) {
+  8004dc:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  8004de:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  8004e1:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8004e4:	83 f9 1a             	cmp    $0x1a,%ecx
+  8004e7:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8004ea:	c3                   	ret
+
+00000000008004eb <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  8004eb:	83 ff 20             	cmp    $0x20,%edi
+  8004ee:	0f 94 c0             	sete   %al
+  8004f1:	0f b6 c0             	movzbl %al,%eax
+}
+  8004f4:	c3                   	ret
+
+00000000008004f5 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  8004f5:	89 f8                	mov    %edi,%eax
+  8004f7:	f7 d8                	neg    %eax
+  8004f9:	0f 48 c7             	cmovs  %edi,%eax
+}
+  8004fc:	c3                   	ret
+
+00000000008004fd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8004fd:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800500:	48 89 f8             	mov    %rdi,%rax
+  800503:	48 f7 d8             	neg    %rax
+  800506:	83 e0 07             	and    $0x7,%eax
+  800509:	49 89 d1             	mov    %rdx,%r9
+  80050c:	49 29 c1             	sub    %rax,%r9
+  80050f:	78 36                	js     800547 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800511:	40 0f b6 c6          	movzbl %sil,%eax
+  800515:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80051c:	01 01 01 
+  80051f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800523:	40 f6 c7 07          	test   $0x7,%dil
+  800527:	75 38                	jne    800561 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800529:	4c 89 c9             	mov    %r9,%rcx
+  80052c:	48 c1 f9 03          	sar    $0x3,%rcx
+  800530:	74 0c                	je     80053e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800532:	fc                   	cld
+  800533:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800536:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80053a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80053e:	4d 85 c9             	test   %r9,%r9
+  800541:	75 45                	jne    800588 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800543:	4c 89 c0             	mov    %r8,%rax
+  800546:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800547:	48 85 d2             	test   %rdx,%rdx
+  80054a:	74 f7                	je     800543 <memset+0x46>
+  80054c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80054f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800552:	48 83 c0 01          	add    $0x1,%rax
+  800556:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80055a:	48 39 c2             	cmp    %rax,%rdx
+  80055d:	75 f3                	jne    800552 <memset+0x55>
+  80055f:	eb e2                	jmp    800543 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800561:	40 f6 c7 01          	test   $0x1,%dil
+  800565:	74 06                	je     80056d <memset+0x70>
+  800567:	88 07                	mov    %al,(%rdi)
+  800569:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80056d:	40 f6 c7 02          	test   $0x2,%dil
+  800571:	74 07                	je     80057a <memset+0x7d>
+  800573:	66 89 07             	mov    %ax,(%rdi)
+  800576:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80057a:	40 f6 c7 04          	test   $0x4,%dil
+  80057e:	74 a9                	je     800529 <memset+0x2c>
+  800580:	89 07                	mov    %eax,(%rdi)
+  800582:	48 83 c7 04          	add    $0x4,%rdi
+  800586:	eb a1                	jmp    800529 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800588:	41 f6 c1 04          	test   $0x4,%r9b
+  80058c:	74 06                	je     800594 <memset+0x97>
+  80058e:	89 07                	mov    %eax,(%rdi)
+  800590:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800594:	41 f6 c1 02          	test   $0x2,%r9b
+  800598:	74 07                	je     8005a1 <memset+0xa4>
+  80059a:	66 89 07             	mov    %ax,(%rdi)
+  80059d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8005a1:	41 f6 c1 01          	test   $0x1,%r9b
+  8005a5:	74 9c                	je     800543 <memset+0x46>
+  8005a7:	88 07                	mov    %al,(%rdi)
+  8005a9:	eb 98                	jmp    800543 <memset+0x46>
+
+00000000008005ab <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8005ab:	48 89 f8             	mov    %rdi,%rax
+  8005ae:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8005b1:	48 39 fe             	cmp    %rdi,%rsi
+  8005b4:	73 3b                	jae    8005f1 <memmove+0x46>
+  8005b6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8005ba:	48 39 d7             	cmp    %rdx,%rdi
+  8005bd:	73 32                	jae    8005f1 <memmove+0x46>
+        s += n;
+        d += n;
+  8005bf:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8005c3:	48 89 d6             	mov    %rdx,%rsi
+  8005c6:	48 09 fe             	or     %rdi,%rsi
+  8005c9:	48 09 ce             	or     %rcx,%rsi
+  8005cc:	40 f6 c6 07          	test   $0x7,%sil
+  8005d0:	75 12                	jne    8005e4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8005d2:	48 83 ef 08          	sub    $0x8,%rdi
+  8005d6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8005da:	48 c1 e9 03          	shr    $0x3,%rcx
+  8005de:	fd                   	std
+  8005df:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8005e2:	fc                   	cld
+  8005e3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8005e4:	48 83 ef 01          	sub    $0x1,%rdi
+  8005e8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8005ec:	fd                   	std
+  8005ed:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8005ef:	eb f1                	jmp    8005e2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8005f1:	48 89 f2             	mov    %rsi,%rdx
+  8005f4:	48 09 c2             	or     %rax,%rdx
+  8005f7:	48 09 ca             	or     %rcx,%rdx
+  8005fa:	f6 c2 07             	test   $0x7,%dl
+  8005fd:	75 0c                	jne    80060b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8005ff:	48 c1 e9 03          	shr    $0x3,%rcx
+  800603:	48 89 c7             	mov    %rax,%rdi
+  800606:	fc                   	cld
+  800607:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80060a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80060b:	48 89 c7             	mov    %rax,%rdi
+  80060e:	fc                   	cld
+  80060f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800611:	c3                   	ret
+
+0000000000800612 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800612:	55                   	push   %rbp
+  800613:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800616:	48 b8 ab 05 80 00 00 	movabs $0x8005ab,%rax
+  80061d:	00 00 00 
+  800620:	ff d0                	call   *%rax
+}
+  800622:	5d                   	pop    %rbp
+  800623:	c3                   	ret
+
+0000000000800624 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800624:	55                   	push   %rbp
+  800625:	48 89 e5             	mov    %rsp,%rbp
+  800628:	41 57                	push   %r15
+  80062a:	41 56                	push   %r14
+  80062c:	41 55                	push   %r13
+  80062e:	41 54                	push   %r12
+  800630:	53                   	push   %rbx
+  800631:	48 83 ec 08          	sub    $0x8,%rsp
+  800635:	49 89 fe             	mov    %rdi,%r14
+  800638:	49 89 f7             	mov    %rsi,%r15
+  80063b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80063e:	48 89 f7             	mov    %rsi,%rdi
+  800641:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  800648:	00 00 00 
+  80064b:	ff d0                	call   *%rax
+  80064d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800650:	48 89 de             	mov    %rbx,%rsi
+  800653:	4c 89 f7             	mov    %r14,%rdi
+  800656:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  80065d:	00 00 00 
+  800660:	ff d0                	call   *%rax
+  800662:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800665:	48 39 c3             	cmp    %rax,%rbx
+  800668:	74 36                	je     8006a0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80066a:	48 89 d8             	mov    %rbx,%rax
+  80066d:	4c 29 e8             	sub    %r13,%rax
+  800670:	49 39 c4             	cmp    %rax,%r12
+  800673:	73 31                	jae    8006a6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800675:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80067a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80067e:	4c 89 fe             	mov    %r15,%rsi
+  800681:	48 b8 12 06 80 00 00 	movabs $0x800612,%rax
+  800688:	00 00 00 
+  80068b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80068d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800691:	48 83 c4 08          	add    $0x8,%rsp
+  800695:	5b                   	pop    %rbx
+  800696:	41 5c                	pop    %r12
+  800698:	41 5d                	pop    %r13
+  80069a:	41 5e                	pop    %r14
+  80069c:	41 5f                	pop    %r15
+  80069e:	5d                   	pop    %rbp
+  80069f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8006a0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8006a4:	eb eb                	jmp    800691 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8006a6:	48 83 eb 01          	sub    $0x1,%rbx
+  8006aa:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8006ae:	48 89 da             	mov    %rbx,%rdx
+  8006b1:	4c 89 fe             	mov    %r15,%rsi
+  8006b4:	48 b8 12 06 80 00 00 	movabs $0x800612,%rax
+  8006bb:	00 00 00 
+  8006be:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8006c0:	49 01 de             	add    %rbx,%r14
+  8006c3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8006c8:	eb c3                	jmp    80068d <strlcat+0x69>
+
+00000000008006ca <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8006ca:	48 85 d2             	test   %rdx,%rdx
+  8006cd:	74 2d                	je     8006fc <memcmp+0x32>
+  8006cf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8006d4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8006d8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8006dd:	44 38 c1             	cmp    %r8b,%cl
+  8006e0:	75 0f                	jne    8006f1 <memcmp+0x27>
+    while (n-- > 0) {
+  8006e2:	48 83 c0 01          	add    $0x1,%rax
+  8006e6:	48 39 c2             	cmp    %rax,%rdx
+  8006e9:	75 e9                	jne    8006d4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8006eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8006f1:	0f b6 c1             	movzbl %cl,%eax
+  8006f4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8006f8:	44 29 c0             	sub    %r8d,%eax
+  8006fb:	c3                   	ret
+    return 0;
+  8006fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800701:	c3                   	ret
+
+0000000000800702 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800702:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800706:	48 39 c7             	cmp    %rax,%rdi
+  800709:	73 0f                	jae    80071a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80070b:	40 38 37             	cmp    %sil,(%rdi)
+  80070e:	74 0e                	je     80071e <memfind+0x1c>
+    for (; src < end; src++) {
+  800710:	48 83 c7 01          	add    $0x1,%rdi
+  800714:	48 39 f8             	cmp    %rdi,%rax
+  800717:	75 f2                	jne    80070b <memfind+0x9>
+  800719:	c3                   	ret
+  80071a:	48 89 f8             	mov    %rdi,%rax
+  80071d:	c3                   	ret
+  80071e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800721:	c3                   	ret
+
+0000000000800722 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800722:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800725:	0f b6 37             	movzbl (%rdi),%esi
+  800728:	40 80 fe 20          	cmp    $0x20,%sil
+  80072c:	74 06                	je     800734 <strtol+0x12>
+  80072e:	40 80 fe 09          	cmp    $0x9,%sil
+  800732:	75 13                	jne    800747 <strtol+0x25>
+  800734:	48 83 c7 01          	add    $0x1,%rdi
+  800738:	0f b6 37             	movzbl (%rdi),%esi
+  80073b:	40 80 fe 20          	cmp    $0x20,%sil
+  80073f:	74 f3                	je     800734 <strtol+0x12>
+  800741:	40 80 fe 09          	cmp    $0x9,%sil
+  800745:	74 ed                	je     800734 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800747:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80074a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80074d:	3c 01                	cmp    $0x1,%al
+  80074f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800753:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800759:	75 0f                	jne    80076a <strtol+0x48>
+  80075b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80075e:	74 14                	je     800774 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800760:	85 d2                	test   %edx,%edx
+  800762:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800767:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80076a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80076f:	4c 63 ca             	movslq %edx,%r9
+  800772:	eb 36                	jmp    8007aa <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800774:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800778:	74 0f                	je     800789 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80077a:	85 d2                	test   %edx,%edx
+  80077c:	75 ec                	jne    80076a <strtol+0x48>
+        s++;
+  80077e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800782:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800787:	eb e1                	jmp    80076a <strtol+0x48>
+        s += 2;
+  800789:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80078d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800792:	eb d6                	jmp    80076a <strtol+0x48>
+            dig -= '0';
+  800794:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800797:	44 0f b6 c1          	movzbl %cl,%r8d
+  80079b:	41 39 d0             	cmp    %edx,%r8d
+  80079e:	7d 21                	jge    8007c1 <strtol+0x9f>
+        val = val * base + dig;
+  8007a0:	49 0f af c1          	imul   %r9,%rax
+  8007a4:	0f b6 c9             	movzbl %cl,%ecx
+  8007a7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8007aa:	48 83 c7 01          	add    $0x1,%rdi
+  8007ae:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8007b2:	80 f9 39             	cmp    $0x39,%cl
+  8007b5:	76 dd                	jbe    800794 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8007b7:	80 f9 7b             	cmp    $0x7b,%cl
+  8007ba:	77 05                	ja     8007c1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8007bc:	83 e9 57             	sub    $0x57,%ecx
+  8007bf:	eb d6                	jmp    800797 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8007c1:	4d 85 d2             	test   %r10,%r10
+  8007c4:	74 03                	je     8007c9 <strtol+0xa7>
+  8007c6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8007c9:	48 89 c2             	mov    %rax,%rdx
+  8007cc:	48 f7 da             	neg    %rdx
+  8007cf:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8007d3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8007d7:	c3                   	ret
+
+00000000008007d8 <atoi>:
+int atoi(const char *str) {
+  8007d8:	55                   	push   %rbp
+  8007d9:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8007dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8007e6:	48 b8 22 07 80 00 00 	movabs $0x800722,%rax
+  8007ed:	00 00 00 
+  8007f0:	ff d0                	call   *%rax
+}
+  8007f2:	5d                   	pop    %rbp
+  8007f3:	c3                   	ret
+
+00000000008007f4 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8007f4:	55                   	push   %rbp
+  8007f5:	48 89 e5             	mov    %rsp,%rbp
+  8007f8:	53                   	push   %rbx
+  8007f9:	48 89 fa             	mov    %rdi,%rdx
+  8007fc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8007ff:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800804:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800809:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80080e:	be 00 00 00 00       	mov    $0x0,%esi
+  800813:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800819:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80081b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80081f:	c9                   	leave
+  800820:	c3                   	ret
+
+0000000000800821 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800821:	55                   	push   %rbp
+  800822:	48 89 e5             	mov    %rsp,%rbp
+  800825:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800826:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80082b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800830:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800835:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80083a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80083f:	be 00 00 00 00       	mov    $0x0,%esi
+  800844:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80084a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80084c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800850:	c9                   	leave
+  800851:	c3                   	ret
+
+0000000000800852 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800852:	55                   	push   %rbp
+  800853:	48 89 e5             	mov    %rsp,%rbp
+  800856:	53                   	push   %rbx
+  800857:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80085b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80085e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800863:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800868:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80086d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800872:	be 00 00 00 00       	mov    $0x0,%esi
+  800877:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80087d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80087f:	48 85 c0             	test   %rax,%rax
+  800882:	7f 06                	jg     80088a <sys_env_destroy+0x38>
+}
+  800884:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800888:	c9                   	leave
+  800889:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80088a:	49 89 c0             	mov    %rax,%r8
+  80088d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800892:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800899:	00 00 00 
+  80089c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8008a1:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8008a8:	00 00 00 
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	49 b9 1c 36 80 00 00 	movabs $0x80361c,%r9
+  8008b7:	00 00 00 
+  8008ba:	41 ff d1             	call   *%r9
+
+00000000008008bd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8008bd:	55                   	push   %rbp
+  8008be:	48 89 e5             	mov    %rsp,%rbp
+  8008c1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8008c2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8008d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8008db:	be 00 00 00 00       	mov    $0x0,%esi
+  8008e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8008e6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8008e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008ec:	c9                   	leave
+  8008ed:	c3                   	ret
+
+00000000008008ee <sys_yield>:
+
+void
+sys_yield(void) {
+  8008ee:	55                   	push   %rbp
+  8008ef:	48 89 e5             	mov    %rsp,%rbp
+  8008f2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8008f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8008f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800902:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800907:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80090c:	be 00 00 00 00       	mov    $0x0,%esi
+  800911:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800917:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800919:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80091d:	c9                   	leave
+  80091e:	c3                   	ret
+
+000000000080091f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80091f:	55                   	push   %rbp
+  800920:	48 89 e5             	mov    %rsp,%rbp
+  800923:	53                   	push   %rbx
+  800924:	48 89 fa             	mov    %rdi,%rdx
+  800927:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80092a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80092f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800936:	00 00 00 
+  800939:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80093e:	be 00 00 00 00       	mov    $0x0,%esi
+  800943:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800949:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80094b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80094f:	c9                   	leave
+  800950:	c3                   	ret
+
+0000000000800951 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800951:	55                   	push   %rbp
+  800952:	48 89 e5             	mov    %rsp,%rbp
+  800955:	53                   	push   %rbx
+  800956:	49 89 f8             	mov    %rdi,%r8
+  800959:	48 89 d3             	mov    %rdx,%rbx
+  80095c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80095f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800964:	4c 89 c2             	mov    %r8,%rdx
+  800967:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80096a:	be 00 00 00 00       	mov    $0x0,%esi
+  80096f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800975:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800977:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+
+000000000080097d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80097d:	55                   	push   %rbp
+  80097e:	48 89 e5             	mov    %rsp,%rbp
+  800981:	53                   	push   %rbx
+  800982:	48 83 ec 08          	sub    $0x8,%rsp
+  800986:	89 f8                	mov    %edi,%eax
+  800988:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80098b:	48 63 f9             	movslq %ecx,%rdi
+  80098e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800991:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800996:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800999:	be 00 00 00 00       	mov    $0x0,%esi
+  80099e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8009a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8009a6:	48 85 c0             	test   %rax,%rax
+  8009a9:	7f 06                	jg     8009b1 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8009ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009af:	c9                   	leave
+  8009b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8009b1:	49 89 c0             	mov    %rax,%r8
+  8009b4:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8009b9:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8009c0:	00 00 00 
+  8009c3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8009c8:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009cf:	00 00 00 
+  8009d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d7:	49 b9 1c 36 80 00 00 	movabs $0x80361c,%r9
+  8009de:	00 00 00 
+  8009e1:	41 ff d1             	call   *%r9
+
+00000000008009e4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8009e4:	55                   	push   %rbp
+  8009e5:	48 89 e5             	mov    %rsp,%rbp
+  8009e8:	53                   	push   %rbx
+  8009e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8009ed:	89 f8                	mov    %edi,%eax
+  8009ef:	49 89 f2             	mov    %rsi,%r10
+  8009f2:	48 89 cf             	mov    %rcx,%rdi
+  8009f5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8009f8:	48 63 da             	movslq %edx,%rbx
+  8009fb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8009fe:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800a03:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a06:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800a09:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800a0b:	48 85 c0             	test   %rax,%rax
+  800a0e:	7f 06                	jg     800a16 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800a10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a14:	c9                   	leave
+  800a15:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800a16:	49 89 c0             	mov    %rax,%r8
+  800a19:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800a1e:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800a25:	00 00 00 
+  800a28:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800a2d:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a34:	00 00 00 
+  800a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3c:	49 b9 1c 36 80 00 00 	movabs $0x80361c,%r9
+  800a43:	00 00 00 
+  800a46:	41 ff d1             	call   *%r9
+
+0000000000800a49 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800a49:	55                   	push   %rbp
+  800a4a:	48 89 e5             	mov    %rsp,%rbp
+  800a4d:	53                   	push   %rbx
+  800a4e:	48 83 ec 08          	sub    $0x8,%rsp
+  800a52:	49 89 f9             	mov    %rdi,%r9
+  800a55:	89 f0                	mov    %esi,%eax
+  800a57:	48 89 d3             	mov    %rdx,%rbx
+  800a5a:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  800a5d:	49 63 f0             	movslq %r8d,%rsi
+  800a60:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800a63:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800a68:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800a6b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800a71:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800a73:	48 85 c0             	test   %rax,%rax
+  800a76:	7f 06                	jg     800a7e <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800a78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a7c:	c9                   	leave
+  800a7d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800a7e:	49 89 c0             	mov    %rax,%r8
+  800a81:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800a86:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800a8d:	00 00 00 
+  800a90:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800a95:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a9c:	00 00 00 
+  800a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa4:	49 b9 1c 36 80 00 00 	movabs $0x80361c,%r9
+  800aab:	00 00 00 
+  800aae:	41 ff d1             	call   *%r9
+
+0000000000800ab1 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  800ab1:	55                   	push   %rbp
+  800ab2:	48 89 e5             	mov    %rsp,%rbp
+  800ab5:	53                   	push   %rbx
+  800ab6:	89 f8                	mov    %edi,%eax
+  800ab8:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  800abb:	48 63 f9             	movslq %ecx,%rdi
+  800abe:	48 63 da             	movslq %edx,%rbx
+  800ac1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800ac4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ac9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800acc:	be 00 00 00 00       	mov    $0x0,%esi
+  800ad1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800ad7:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  800ad9:	89 c2                	mov    %eax,%edx
+  800adb:	48 85 c0             	test   %rax,%rax
+  800ade:	78 0d                	js     800aed <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  800ae0:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  800ae5:	4d 85 c9             	test   %r9,%r9
+  800ae8:	74 03                	je     800aed <sys_alloc_dma_region+0x3c>
+  800aea:	49 89 01             	mov    %rax,(%r9)
+}
+  800aed:	89 d0                	mov    %edx,%eax
+  800aef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800af3:	c9                   	leave
+  800af4:	c3                   	ret
+
+0000000000800af5 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  800af5:	55                   	push   %rbp
+  800af6:	48 89 e5             	mov    %rsp,%rbp
+  800af9:	53                   	push   %rbx
+  800afa:	48 83 ec 08          	sub    $0x8,%rsp
+  800afe:	48 89 f1             	mov    %rsi,%rcx
+  800b01:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800b04:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800b07:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b0c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b11:	be 00 00 00 00       	mov    $0x0,%esi
+  800b16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b1c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800b1e:	48 85 c0             	test   %rax,%rax
+  800b21:	7f 06                	jg     800b29 <sys_set_cache_region+0x34>
+}
+  800b23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b27:	c9                   	leave
+  800b28:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800b29:	49 89 c0             	mov    %rax,%r8
+  800b2c:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800b31:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800b38:	00 00 00 
+  800b3b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800b40:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800b47:	00 00 00 
+  800b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4f:	49 b9 1c 36 80 00 00 	movabs $0x80361c,%r9
+  800b56:	00 00 00 
+  800b59:	41 ff d1             	call   *%r9
+
+0000000000800b5c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800b5c:	55                   	push   %rbp
+  800b5d:	48 89 e5             	mov    %rsp,%rbp
+  800b60:	53                   	push   %rbx
+  800b61:	48 83 ec 08          	sub    $0x8,%rsp
+  800b65:	48 89 f1             	mov    %rsi,%rcx
+  800b68:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800b6b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800b6e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b73:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b78:	be 00 00 00 00       	mov    $0x0,%esi
+  800b7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b83:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800b85:	48 85 c0             	test   %rax,%rax
+  800b88:	7f 06                	jg     800b90 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800b8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b8e:	c9                   	leave
+  800b8f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800b90:	49 89 c0             	mov    %rax,%r8
+  800b93:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800b98:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800b9f:	00 00 00 
+  800ba2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800ba7:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800bae:	00 00 00 
+  800bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb6:	49 b9 1c 36 80 00 00 	movabs $0x80361c,%r9
+  800bbd:	00 00 00 
+  800bc0:	41 ff d1             	call   *%r9
+
+0000000000800bc3 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800bc3:	55                   	push   %rbp
+  800bc4:	48 89 e5             	mov    %rsp,%rbp
+  800bc7:	53                   	push   %rbx
+  800bc8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800bcc:	48 63 ce             	movslq %esi,%rcx
+  800bcf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800bd2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800bd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bdc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800be1:	be 00 00 00 00       	mov    $0x0,%esi
+  800be6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800bec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800bee:	48 85 c0             	test   %rax,%rax
+  800bf1:	7f 06                	jg     800bf9 <sys_env_set_status+0x36>
+}
+  800bf3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800bf7:	c9                   	leave
+  800bf8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800bf9:	49 89 c0             	mov    %rax,%r8
+  800bfc:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800c01:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800c08:	00 00 00 
+  800c0b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800c10:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800c17:	00 00 00 
+  800c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1f:	49 b9 1c 36 80 00 00 	movabs $0x80361c,%r9
+  800c26:	00 00 00 
+  800c29:	41 ff d1             	call   *%r9
+
+0000000000800c2c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800c2c:	55                   	push   %rbp
+  800c2d:	48 89 e5             	mov    %rsp,%rbp
+  800c30:	53                   	push   %rbx
+  800c31:	48 83 ec 08          	sub    $0x8,%rsp
+  800c35:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800c38:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800c3b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c45:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c4a:	be 00 00 00 00       	mov    $0x0,%esi
+  800c4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c55:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800c57:	48 85 c0             	test   %rax,%rax
+  800c5a:	7f 06                	jg     800c62 <sys_env_set_trapframe+0x36>
+}
+  800c5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c60:	c9                   	leave
+  800c61:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800c62:	49 89 c0             	mov    %rax,%r8
+  800c65:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800c6a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800c71:	00 00 00 
+  800c74:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800c79:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800c80:	00 00 00 
+  800c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c88:	49 b9 1c 36 80 00 00 	movabs $0x80361c,%r9
+  800c8f:	00 00 00 
+  800c92:	41 ff d1             	call   *%r9
+
+0000000000800c95 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800c95:	55                   	push   %rbp
+  800c96:	48 89 e5             	mov    %rsp,%rbp
+  800c99:	53                   	push   %rbx
+  800c9a:	48 83 ec 08          	sub    $0x8,%rsp
+  800c9e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800ca1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800ca4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ca9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800cb3:	be 00 00 00 00       	mov    $0x0,%esi
+  800cb8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800cbe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800cc0:	48 85 c0             	test   %rax,%rax
+  800cc3:	7f 06                	jg     800ccb <sys_env_set_pgfault_upcall+0x36>
+}
+  800cc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cc9:	c9                   	leave
+  800cca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800ccb:	49 89 c0             	mov    %rax,%r8
+  800cce:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800cd3:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800cda:	00 00 00 
+  800cdd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800ce2:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800ce9:	00 00 00 
+  800cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf1:	49 b9 1c 36 80 00 00 	movabs $0x80361c,%r9
+  800cf8:	00 00 00 
+  800cfb:	41 ff d1             	call   *%r9
+
+0000000000800cfe <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800cfe:	55                   	push   %rbp
+  800cff:	48 89 e5             	mov    %rsp,%rbp
+  800d02:	53                   	push   %rbx
+  800d03:	89 f8                	mov    %edi,%eax
+  800d05:	49 89 f1             	mov    %rsi,%r9
+  800d08:	48 89 d3             	mov    %rdx,%rbx
+  800d0b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800d0e:	49 63 f0             	movslq %r8d,%rsi
+  800d11:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800d14:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800d19:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800d1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800d22:	cd 30                	int    $0x30
+}
+  800d24:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d28:	c9                   	leave
+  800d29:	c3                   	ret
+
+0000000000800d2a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800d2a:	55                   	push   %rbp
+  800d2b:	48 89 e5             	mov    %rsp,%rbp
+  800d2e:	53                   	push   %rbx
+  800d2f:	48 83 ec 08          	sub    $0x8,%rsp
+  800d33:	48 89 fa             	mov    %rdi,%rdx
+  800d36:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800d39:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800d3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d43:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800d48:	be 00 00 00 00       	mov    $0x0,%esi
+  800d4d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800d53:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800d55:	48 85 c0             	test   %rax,%rax
+  800d58:	7f 06                	jg     800d60 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800d5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d5e:	c9                   	leave
+  800d5f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800d60:	49 89 c0             	mov    %rax,%r8
+  800d63:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800d68:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800d6f:	00 00 00 
+  800d72:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800d77:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800d7e:	00 00 00 
+  800d81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d86:	49 b9 1c 36 80 00 00 	movabs $0x80361c,%r9
+  800d8d:	00 00 00 
+  800d90:	41 ff d1             	call   *%r9
+
+0000000000800d93 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  800d93:	55                   	push   %rbp
+  800d94:	48 89 e5             	mov    %rsp,%rbp
+  800d97:	53                   	push   %rbx
+  800d98:	48 89 fa             	mov    %rdi,%rdx
+  800d9b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800d9e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800da3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800dad:	be 00 00 00 00       	mov    $0x0,%esi
+  800db2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800db8:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800dba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800dbe:	c9                   	leave
+  800dbf:	c3                   	ret
+
+0000000000800dc0 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800dc0:	55                   	push   %rbp
+  800dc1:	48 89 e5             	mov    %rsp,%rbp
+  800dc4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800dc5:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800dd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800dde:	be 00 00 00 00       	mov    $0x0,%esi
+  800de3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800de9:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800deb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800def:	c9                   	leave
+  800df0:	c3                   	ret
+
+0000000000800df1 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800df1:	48 85 ff             	test   %rdi,%rdi
+  800df4:	0f 84 b6 01 00 00    	je     800fb0 <malloc+0x1bf>
+malloc(size_t size) {
+  800dfa:	55                   	push   %rbp
+  800dfb:	48 89 e5             	mov    %rsp,%rbp
+  800dfe:	41 56                	push   %r14
+  800e00:	41 55                	push   %r13
+  800e02:	41 54                	push   %r12
+  800e04:	53                   	push   %rbx
+  800e05:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800e08:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800e0f:	00 00 00 
+  800e12:	4c 8b 20             	mov    (%rax),%r12
+  800e15:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  800e1c:	0f 87 94 01 00 00    	ja     800fb6 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  800e22:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800e29:	00 00 00 
+  800e2c:	48 85 c0             	test   %rax,%rax
+  800e2f:	74 6b                	je     800e9c <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  800e31:	4d 85 e4             	test   %r12,%r12
+  800e34:	74 66                	je     800e9c <malloc+0xab>
+  800e36:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  800e3d:	00 00 00 
+  800e40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e45:	eb 0d                	jmp    800e54 <malloc+0x63>
+  800e47:	48 83 c1 01          	add    $0x1,%rcx
+  800e4b:	48 83 c2 18          	add    $0x18,%rdx
+  800e4f:	49 39 cc             	cmp    %rcx,%r12
+  800e52:	74 48                	je     800e9c <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  800e54:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  800e59:	74 ec                	je     800e47 <malloc+0x56>
+  800e5b:	48 39 1a             	cmp    %rbx,(%rdx)
+  800e5e:	72 e7                	jb     800e47 <malloc+0x56>
+                real_freep_size--;
+  800e60:	48 83 e8 01          	sub    $0x1,%rax
+  800e64:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800e6b:	00 00 00 
+                freep[i].is_free = false;
+  800e6e:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800e75:	00 00 00 
+  800e78:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  800e7c:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  800e80:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  800e84:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  800e8b:	00 
+                freep[i].size = size;
+  800e8c:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  800e90:	48 01 c8             	add    %rcx,%rax
+  800e93:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800e97:	e9 0b 01 00 00       	jmp    800fa7 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  800e9c:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  800ea3:	00 00 00 
+  800ea6:	48 01 d8             	add    %rbx,%rax
+  800ea9:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  800eaf:	76 7c                	jbe    800f2d <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  800eb1:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  800eb8:	00 00 00 
+  800ebb:	4c 8b 30             	mov    (%rax),%r14
+  800ebe:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  800ec5:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  800ec8:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800ecf:	00 00 00 
+  800ed2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  800ed9:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  800ee0:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  800ee6:	4c 0f 45 eb          	cmovne %rbx,%r13
+  800eea:	48 b8 bd 08 80 00 00 	movabs $0x8008bd,%rax
+  800ef1:	00 00 00 
+  800ef4:	ff d0                	call   *%rax
+  800ef6:	89 c7                	mov    %eax,%edi
+  800ef8:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  800eff:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  800f06:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  800f0d:	00 00 00 
+  800f10:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  800f14:	b9 26 00 00 00       	mov    $0x26,%ecx
+  800f19:	48 b8 7d 09 80 00 00 	movabs $0x80097d,%rax
+  800f20:	00 00 00 
+  800f23:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  800f25:	85 c0                	test   %eax,%eax
+  800f27:	0f 88 90 00 00 00    	js     800fbd <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  800f2d:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  800f34:	00 00 00 
+  800f37:	48 8b 31             	mov    (%rcx),%rsi
+  800f3a:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  800f41:	00 00 00 
+  800f44:	4c 8b 07             	mov    (%rdi),%r8
+  800f47:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  800f4b:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  800f52:	00 00 00 
+  800f55:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  800f59:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  800f5d:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800f64:	00 00 00 
+  800f67:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  800f6b:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  800f6e:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  800f72:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  800f79:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  800f7a:	48 89 d8             	mov    %rbx,%rax
+  800f7d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f82:	4c 01 c0             	add    %r8,%rax
+  800f85:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  800f88:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  800f8f:	48 01 f3             	add    %rsi,%rbx
+  800f92:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  800f95:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  800f9a:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  800fa1:	00 00 00 
+  800fa4:	48 89 d0             	mov    %rdx,%rax
+}
+  800fa7:	5b                   	pop    %rbx
+  800fa8:	41 5c                	pop    %r12
+  800faa:	41 5d                	pop    %r13
+  800fac:	41 5e                	pop    %r14
+  800fae:	5d                   	pop    %rbp
+  800faf:	c3                   	ret
+        return NULL;
+  800fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fb5:	c3                   	ret
+        return NULL;
+  800fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbb:	eb ea                	jmp    800fa7 <malloc+0x1b6>
+            return NULL;
+  800fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc2:	eb e3                	jmp    800fa7 <malloc+0x1b6>
+
+0000000000800fc4 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  800fc4:	55                   	push   %rbp
+  800fc5:	48 89 e5             	mov    %rsp,%rbp
+  800fc8:	53                   	push   %rbx
+  800fc9:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  800fcd:	48 89 fb             	mov    %rdi,%rbx
+  800fd0:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  800fd4:	48 89 df             	mov    %rbx,%rdi
+  800fd7:	48 b8 f1 0d 80 00 00 	movabs $0x800df1,%rax
+  800fde:	00 00 00 
+  800fe1:	ff d0                	call   *%rax
+  800fe3:	48 89 c7             	mov    %rax,%rdi
+  800fe6:	48 89 da             	mov    %rbx,%rdx
+  800fe9:	be 00 00 00 00       	mov    $0x0,%esi
+  800fee:	48 b8 fd 04 80 00 00 	movabs $0x8004fd,%rax
+  800ff5:	00 00 00 
+  800ff8:	ff d0                	call   *%rax
+}
+  800ffa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ffe:	c9                   	leave
+  800fff:	c3                   	ret
+
+0000000000801000 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801000:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801007:	00 00 00 
+  80100a:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801011:	00 00 00 
+  801014:	48 3b 02             	cmp    (%rdx),%rax
+  801017:	74 4d                	je     801066 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801019:	48 85 c0             	test   %rax,%rax
+  80101c:	74 4d                	je     80106b <get_allocsize+0x6b>
+  80101e:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801025:	00 00 00 
+  801028:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80102d:	48 3b 39             	cmp    (%rcx),%rdi
+  801030:	74 13                	je     801045 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801032:	48 83 c2 01          	add    $0x1,%rdx
+  801036:	48 83 c1 18          	add    $0x18,%rcx
+  80103a:	48 39 d0             	cmp    %rdx,%rax
+  80103d:	75 ee                	jne    80102d <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  80103f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801044:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801045:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801049:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104e:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801055:	00 00 00 
+  801058:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80105e:	75 0b                	jne    80106b <get_allocsize+0x6b>
+  801060:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801065:	c3                   	ret
+        return 0;
+  801066:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80106b:	c3                   	ret
+
+000000000080106c <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80106c:	48 85 ff             	test   %rdi,%rdi
+  80106f:	0f 84 01 01 00 00    	je     801176 <free+0x10a>
+free(void *ptr) {
+  801075:	55                   	push   %rbp
+  801076:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801079:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801080:	00 00 00 
+  801083:	48 8b 30             	mov    (%rax),%rsi
+  801086:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80108d:	00 00 00 
+  801090:	48 39 c6             	cmp    %rax,%rsi
+  801093:	74 50                	je     8010e5 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801095:	48 85 f6             	test   %rsi,%rsi
+  801098:	74 21                	je     8010bb <free+0x4f>
+  80109a:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8010a1:	00 00 00 
+  8010a4:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8010a9:	48 3b 39             	cmp    (%rcx),%rdi
+  8010ac:	74 61                	je     80110f <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8010ae:	48 83 c2 01          	add    $0x1,%rdx
+  8010b2:	48 83 c1 18          	add    $0x18,%rcx
+  8010b6:	48 39 d6             	cmp    %rdx,%rsi
+  8010b9:	75 ee                	jne    8010a9 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8010bb:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  8010c2:	00 00 00 
+  8010c5:	be 12 01 00 00       	mov    $0x112,%esi
+  8010ca:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8010d1:	00 00 00 
+  8010d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d9:	48 b9 1c 36 80 00 00 	movabs $0x80361c,%rcx
+  8010e0:	00 00 00 
+  8010e3:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  8010e5:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  8010ec:	00 00 00 
+  8010ef:	be 06 01 00 00       	mov    $0x106,%esi
+  8010f4:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8010fb:	00 00 00 
+  8010fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801103:	48 b9 1c 36 80 00 00 	movabs $0x80361c,%rcx
+  80110a:	00 00 00 
+  80110d:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  80110f:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801113:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  80111a:	00 00 00 
+  80111d:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801123:	75 27                	jne    80114c <free+0xe0>
+            freep[i].is_free = true;
+  801125:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801129:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801130:	00 00 00 
+  801133:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  80113a:	00 00 
+            real_freep_size++;
+  80113c:	48 83 c0 01          	add    $0x1,%rax
+  801140:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801147:	00 00 00 
+}
+  80114a:	5d                   	pop    %rbp
+  80114b:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  80114c:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  801153:	00 00 00 
+  801156:	be 0b 01 00 00       	mov    $0x10b,%esi
+  80115b:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  801162:	00 00 00 
+  801165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116a:	48 b9 1c 36 80 00 00 	movabs $0x80361c,%rcx
+  801171:	00 00 00 
+  801174:	ff d1                	call   *%rcx
+  801176:	c3                   	ret
+
+0000000000801177 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801177:	55                   	push   %rbp
+  801178:	48 89 e5             	mov    %rsp,%rbp
+  80117b:	41 55                	push   %r13
+  80117d:	41 54                	push   %r12
+  80117f:	53                   	push   %rbx
+  801180:	48 83 ec 08          	sub    $0x8,%rsp
+  801184:	48 89 fb             	mov    %rdi,%rbx
+  801187:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  80118a:	48 b8 00 10 80 00 00 	movabs $0x801000,%rax
+  801191:	00 00 00 
+  801194:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801196:	49 39 c5             	cmp    %rax,%r13
+  801199:	73 0e                	jae    8011a9 <realloc+0x32>
+}
+  80119b:	48 89 d8             	mov    %rbx,%rax
+  80119e:	48 83 c4 08          	add    $0x8,%rsp
+  8011a2:	5b                   	pop    %rbx
+  8011a3:	41 5c                	pop    %r12
+  8011a5:	41 5d                	pop    %r13
+  8011a7:	5d                   	pop    %rbp
+  8011a8:	c3                   	ret
+  8011a9:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  8011ac:	4c 89 ef             	mov    %r13,%rdi
+  8011af:	48 b8 f1 0d 80 00 00 	movabs $0x800df1,%rax
+  8011b6:	00 00 00 
+  8011b9:	ff d0                	call   *%rax
+  8011bb:	48 89 c7             	mov    %rax,%rdi
+  8011be:	4c 89 e2             	mov    %r12,%rdx
+  8011c1:	48 89 de             	mov    %rbx,%rsi
+  8011c4:	48 b8 12 06 80 00 00 	movabs $0x800612,%rax
+  8011cb:	00 00 00 
+  8011ce:	ff d0                	call   *%rax
+  8011d0:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  8011d3:	48 89 df             	mov    %rbx,%rdi
+  8011d6:	48 b8 6c 10 80 00 00 	movabs $0x80106c,%rax
+  8011dd:	00 00 00 
+  8011e0:	ff d0                	call   *%rax
+    return newptr;
+  8011e2:	4c 89 e3             	mov    %r12,%rbx
+  8011e5:	eb b4                	jmp    80119b <realloc+0x24>
+
+00000000008011e7 <strdup>:
+
+char*
+strdup (const char *src) {
+  8011e7:	55                   	push   %rbp
+  8011e8:	48 89 e5             	mov    %rsp,%rbp
+  8011eb:	41 54                	push   %r12
+  8011ed:	53                   	push   %rbx
+  8011ee:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  8011f1:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  8011f8:	00 00 00 
+  8011fb:	ff d0                	call   *%rax
+  8011fd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801201:	4c 89 e7             	mov    %r12,%rdi
+  801204:	48 b8 f1 0d 80 00 00 	movabs $0x800df1,%rax
+  80120b:	00 00 00 
+  80120e:	ff d0                	call   *%rax
+  801210:	48 89 c7             	mov    %rax,%rdi
+  801213:	4c 89 e2             	mov    %r12,%rdx
+  801216:	48 89 de             	mov    %rbx,%rsi
+  801219:	48 b8 12 06 80 00 00 	movabs $0x800612,%rax
+  801220:	00 00 00 
+  801223:	ff d0                	call   *%rax
+}
+  801225:	5b                   	pop    %rbx
+  801226:	41 5c                	pop    %r12
+  801228:	5d                   	pop    %rbp
+  801229:	c3                   	ret
+
+000000000080122a <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  80122a:	55                   	push   %rbp
+  80122b:	48 89 e5             	mov    %rsp,%rbp
+  80122e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80122f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801234:	ba 00 00 00 00       	mov    $0x0,%edx
+  801239:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80123e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801243:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801248:	be 00 00 00 00       	mov    $0x0,%esi
+  80124d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801253:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801255:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801259:	c9                   	leave
+  80125a:	c3                   	ret
+
+000000000080125b <get_ticks>:
+
+uint64_t
+get_ticks() {
+  80125b:	55                   	push   %rbp
+  80125c:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  80125f:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801266:	00 00 00 
+  801269:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80126d:	74 26                	je     801295 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80126f:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801271:	48 c1 e2 20          	shl    $0x20,%rdx
+  801275:	89 c0                	mov    %eax,%eax
+  801277:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  80127a:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801281:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801288:	00 00 00 
+  80128b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801290:	48 f7 31             	divq   (%rcx)
+}
+  801293:	5d                   	pop    %rbp
+  801294:	c3                   	ret
+        freq = get_cpufreq();
+  801295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129a:	48 ba 2a 12 80 00 00 	movabs $0x80122a,%rdx
+  8012a1:	00 00 00 
+  8012a4:	ff d2                	call   *%rdx
+  8012a6:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  8012ad:	00 00 00 
+  8012b0:	eb bd                	jmp    80126f <get_ticks+0x14>
+
+00000000008012b2 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  8012b2:	55                   	push   %rbp
+  8012b3:	48 89 e5             	mov    %rsp,%rbp
+  8012b6:	53                   	push   %rbx
+  8012b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8012bb:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  8012be:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  8012c5:	00 00 00 
+  8012c8:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8012cc:	74 50                	je     80131e <sleep+0x6c>
+    asm volatile("rdtsc"
+  8012ce:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8012d0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8012d4:	89 c0                	mov    %eax,%eax
+  8012d6:	48 89 d6             	mov    %rdx,%rsi
+  8012d9:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  8012dc:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  8012e3:	00 00 00 
+  8012e6:	48 0f af 18          	imul   (%rax),%rbx
+  8012ea:	48 c1 eb 03          	shr    $0x3,%rbx
+  8012ee:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  8012f5:	9b c4 20 
+  8012f8:	48 89 d8             	mov    %rbx,%rax
+  8012fb:	48 f7 e2             	mul    %rdx
+  8012fe:	48 89 d1             	mov    %rdx,%rcx
+  801301:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801305:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801307:	48 c1 e2 20          	shl    $0x20,%rdx
+  80130b:	89 c0                	mov    %eax,%eax
+  80130d:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801310:	48 29 f2             	sub    %rsi,%rdx
+  801313:	48 39 ca             	cmp    %rcx,%rdx
+  801316:	72 ed                	jb     801305 <sleep+0x53>
+}
+  801318:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131c:	c9                   	leave
+  80131d:	c3                   	ret
+        freq = get_cpufreq();
+  80131e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801323:	48 ba 2a 12 80 00 00 	movabs $0x80122a,%rdx
+  80132a:	00 00 00 
+  80132d:	ff d2                	call   *%rdx
+  80132f:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801336:	00 00 00 
+  801339:	eb 93                	jmp    8012ce <sleep+0x1c>
+
+000000000080133b <poll_kbd>:
+
+int poll_kbd() {
+  80133b:	55                   	push   %rbp
+  80133c:	48 89 e5             	mov    %rsp,%rbp
+  80133f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801340:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801345:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801354:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801359:	be 00 00 00 00       	mov    $0x0,%esi
+  80135e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801364:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801366:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136a:	c9                   	leave
+  80136b:	c3                   	ret
+
+000000000080136c <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  80136c:	55                   	push   %rbp
+  80136d:	48 89 e5             	mov    %rsp,%rbp
+  801370:	53                   	push   %rbx
+  801371:	49 89 fa             	mov    %rdi,%r10
+  801374:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801376:	44 89 c6             	mov    %r8d,%esi
+  801379:	89 cf                	mov    %ecx,%edi
+  80137b:	89 d3                	mov    %edx,%ebx
+  80137d:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80137f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801384:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801387:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  80138b:	cd 30                	int    $0x30
+  80138d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801391:	c9                   	leave
+  801392:	c3                   	ret
+
+0000000000801393 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801393:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80139a:	ff ff ff 
+  80139d:	48 01 f8             	add    %rdi,%rax
+  8013a0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8013a4:	c3                   	ret
+
+00000000008013a5 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8013a5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8013ac:	ff ff ff 
+  8013af:	48 01 f8             	add    %rdi,%rax
+  8013b2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8013b6:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8013bc:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8013c0:	c3                   	ret
+
+00000000008013c1 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8013c1:	55                   	push   %rbp
+  8013c2:	48 89 e5             	mov    %rsp,%rbp
+  8013c5:	41 57                	push   %r15
+  8013c7:	41 56                	push   %r14
+  8013c9:	41 55                	push   %r13
+  8013cb:	41 54                	push   %r12
+  8013cd:	53                   	push   %rbx
+  8013ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d2:	49 89 ff             	mov    %rdi,%r15
+  8013d5:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8013da:	49 bd 75 32 80 00 00 	movabs $0x803275,%r13
+  8013e1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8013e4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8013ea:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8013ed:	48 89 df             	mov    %rbx,%rdi
+  8013f0:	41 ff d5             	call   *%r13
+  8013f3:	83 e0 04             	and    $0x4,%eax
+  8013f6:	74 17                	je     80140f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8013f8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8013ff:	4c 39 f3             	cmp    %r14,%rbx
+  801402:	75 e6                	jne    8013ea <fd_alloc+0x29>
+  801404:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80140a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80140f:	4d 89 27             	mov    %r12,(%r15)
+}
+  801412:	48 83 c4 08          	add    $0x8,%rsp
+  801416:	5b                   	pop    %rbx
+  801417:	41 5c                	pop    %r12
+  801419:	41 5d                	pop    %r13
+  80141b:	41 5e                	pop    %r14
+  80141d:	41 5f                	pop    %r15
+  80141f:	5d                   	pop    %rbp
+  801420:	c3                   	ret
+
+0000000000801421 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801421:	83 ff 1f             	cmp    $0x1f,%edi
+  801424:	77 39                	ja     80145f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801426:	55                   	push   %rbp
+  801427:	48 89 e5             	mov    %rsp,%rbp
+  80142a:	41 54                	push   %r12
+  80142c:	53                   	push   %rbx
+  80142d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801430:	48 63 df             	movslq %edi,%rbx
+  801433:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80143a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80143e:	48 89 df             	mov    %rbx,%rdi
+  801441:	48 b8 75 32 80 00 00 	movabs $0x803275,%rax
+  801448:	00 00 00 
+  80144b:	ff d0                	call   *%rax
+  80144d:	a8 04                	test   $0x4,%al
+  80144f:	74 14                	je     801465 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801451:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801455:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80145a:	5b                   	pop    %rbx
+  80145b:	41 5c                	pop    %r12
+  80145d:	5d                   	pop    %rbp
+  80145e:	c3                   	ret
+        return -E_INVAL;
+  80145f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801464:	c3                   	ret
+        return -E_INVAL;
+  801465:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80146a:	eb ee                	jmp    80145a <fd_lookup+0x39>
+
+000000000080146c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80146c:	55                   	push   %rbp
+  80146d:	48 89 e5             	mov    %rsp,%rbp
+  801470:	41 54                	push   %r12
+  801472:	53                   	push   %rbx
+  801473:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801476:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  80147d:	00 00 00 
+  801480:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801487:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80148a:	39 3b                	cmp    %edi,(%rbx)
+  80148c:	74 47                	je     8014d5 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80148e:	48 83 c0 08          	add    $0x8,%rax
+  801492:	48 8b 18             	mov    (%rax),%rbx
+  801495:	48 85 db             	test   %rbx,%rbx
+  801498:	75 f0                	jne    80148a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80149a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8014a1:	00 00 00 
+  8014a4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8014aa:	89 fa                	mov    %edi,%edx
+  8014ac:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  8014b3:	00 00 00 
+  8014b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014bb:	48 b9 6c 37 80 00 00 	movabs $0x80376c,%rcx
+  8014c2:	00 00 00 
+  8014c5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8014c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8014cc:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8014d0:	5b                   	pop    %rbx
+  8014d1:	41 5c                	pop    %r12
+  8014d3:	5d                   	pop    %rbp
+  8014d4:	c3                   	ret
+            return 0;
+  8014d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014da:	eb f0                	jmp    8014cc <dev_lookup+0x60>
+
+00000000008014dc <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8014dc:	55                   	push   %rbp
+  8014dd:	48 89 e5             	mov    %rsp,%rbp
+  8014e0:	41 55                	push   %r13
+  8014e2:	41 54                	push   %r12
+  8014e4:	53                   	push   %rbx
+  8014e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8014e9:	48 89 fb             	mov    %rdi,%rbx
+  8014ec:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014ef:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8014f6:	ff ff ff 
+  8014f9:	48 01 df             	add    %rbx,%rdi
+  8014fc:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801500:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801504:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  80150b:	00 00 00 
+  80150e:	ff d0                	call   *%rax
+  801510:	41 89 c5             	mov    %eax,%r13d
+  801513:	85 c0                	test   %eax,%eax
+  801515:	78 06                	js     80151d <fd_close+0x41>
+  801517:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80151b:	74 1a                	je     801537 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80151d:	45 84 e4             	test   %r12b,%r12b
+  801520:	b8 00 00 00 00       	mov    $0x0,%eax
+  801525:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801529:	44 89 e8             	mov    %r13d,%eax
+  80152c:	48 83 c4 18          	add    $0x18,%rsp
+  801530:	5b                   	pop    %rbx
+  801531:	41 5c                	pop    %r12
+  801533:	41 5d                	pop    %r13
+  801535:	5d                   	pop    %rbp
+  801536:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801537:	8b 3b                	mov    (%rbx),%edi
+  801539:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80153d:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  801544:	00 00 00 
+  801547:	ff d0                	call   *%rax
+  801549:	41 89 c5             	mov    %eax,%r13d
+  80154c:	85 c0                	test   %eax,%eax
+  80154e:	78 1b                	js     80156b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801550:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801554:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801558:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80155e:	48 85 c0             	test   %rax,%rax
+  801561:	74 08                	je     80156b <fd_close+0x8f>
+  801563:	48 89 df             	mov    %rbx,%rdi
+  801566:	ff d0                	call   *%rax
+  801568:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80156b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801570:	48 89 de             	mov    %rbx,%rsi
+  801573:	bf 00 00 00 00       	mov    $0x0,%edi
+  801578:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  80157f:	00 00 00 
+  801582:	ff d0                	call   *%rax
+    return res;
+  801584:	eb a3                	jmp    801529 <fd_close+0x4d>
+
+0000000000801586 <close>:
+
+int
+close(int fdnum) {
+  801586:	55                   	push   %rbp
+  801587:	48 89 e5             	mov    %rsp,%rbp
+  80158a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80158e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801592:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  801599:	00 00 00 
+  80159c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	78 15                	js     8015b7 <close+0x31>
+
+    return fd_close(fd, 1);
+  8015a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8015a7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8015ab:	48 b8 dc 14 80 00 00 	movabs $0x8014dc,%rax
+  8015b2:	00 00 00 
+  8015b5:	ff d0                	call   *%rax
+}
+  8015b7:	c9                   	leave
+  8015b8:	c3                   	ret
+
+00000000008015b9 <close_all>:
+
+void
+close_all(void) {
+  8015b9:	55                   	push   %rbp
+  8015ba:	48 89 e5             	mov    %rsp,%rbp
+  8015bd:	41 54                	push   %r12
+  8015bf:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8015c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c5:	49 bc 86 15 80 00 00 	movabs $0x801586,%r12
+  8015cc:	00 00 00 
+  8015cf:	89 df                	mov    %ebx,%edi
+  8015d1:	41 ff d4             	call   *%r12
+  8015d4:	83 c3 01             	add    $0x1,%ebx
+  8015d7:	83 fb 20             	cmp    $0x20,%ebx
+  8015da:	75 f3                	jne    8015cf <close_all+0x16>
+}
+  8015dc:	5b                   	pop    %rbx
+  8015dd:	41 5c                	pop    %r12
+  8015df:	5d                   	pop    %rbp
+  8015e0:	c3                   	ret
+
+00000000008015e1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8015e1:	55                   	push   %rbp
+  8015e2:	48 89 e5             	mov    %rsp,%rbp
+  8015e5:	41 57                	push   %r15
+  8015e7:	41 56                	push   %r14
+  8015e9:	41 55                	push   %r13
+  8015eb:	41 54                	push   %r12
+  8015ed:	53                   	push   %rbx
+  8015ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8015f2:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8015f5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8015f9:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  801600:	00 00 00 
+  801603:	ff d0                	call   *%rax
+  801605:	89 c3                	mov    %eax,%ebx
+  801607:	85 c0                	test   %eax,%eax
+  801609:	0f 88 b8 00 00 00    	js     8016c7 <dup+0xe6>
+    close(newfdnum);
+  80160f:	44 89 e7             	mov    %r12d,%edi
+  801612:	48 b8 86 15 80 00 00 	movabs $0x801586,%rax
+  801619:	00 00 00 
+  80161c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80161e:	4d 63 ec             	movslq %r12d,%r13
+  801621:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801628:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80162c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801630:	4c 89 ff             	mov    %r15,%rdi
+  801633:	49 be a5 13 80 00 00 	movabs $0x8013a5,%r14
+  80163a:	00 00 00 
+  80163d:	41 ff d6             	call   *%r14
+  801640:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801643:	4c 89 ef             	mov    %r13,%rdi
+  801646:	41 ff d6             	call   *%r14
+  801649:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80164c:	48 89 df             	mov    %rbx,%rdi
+  80164f:	48 b8 75 32 80 00 00 	movabs $0x803275,%rax
+  801656:	00 00 00 
+  801659:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80165b:	a8 04                	test   $0x4,%al
+  80165d:	74 2b                	je     80168a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80165f:	41 89 c1             	mov    %eax,%r9d
+  801662:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801668:	4c 89 f1             	mov    %r14,%rcx
+  80166b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801670:	48 89 de             	mov    %rbx,%rsi
+  801673:	bf 00 00 00 00       	mov    $0x0,%edi
+  801678:	48 b8 e4 09 80 00 00 	movabs $0x8009e4,%rax
+  80167f:	00 00 00 
+  801682:	ff d0                	call   *%rax
+  801684:	89 c3                	mov    %eax,%ebx
+  801686:	85 c0                	test   %eax,%eax
+  801688:	78 4e                	js     8016d8 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80168a:	4c 89 ff             	mov    %r15,%rdi
+  80168d:	48 b8 75 32 80 00 00 	movabs $0x803275,%rax
+  801694:	00 00 00 
+  801697:	ff d0                	call   *%rax
+  801699:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80169c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8016a2:	4c 89 e9             	mov    %r13,%rcx
+  8016a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016aa:	4c 89 fe             	mov    %r15,%rsi
+  8016ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016b2:	48 b8 e4 09 80 00 00 	movabs $0x8009e4,%rax
+  8016b9:	00 00 00 
+  8016bc:	ff d0                	call   *%rax
+  8016be:	89 c3                	mov    %eax,%ebx
+  8016c0:	85 c0                	test   %eax,%eax
+  8016c2:	78 14                	js     8016d8 <dup+0xf7>
+
+    return newfdnum;
+  8016c4:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8016c7:	89 d8                	mov    %ebx,%eax
+  8016c9:	48 83 c4 18          	add    $0x18,%rsp
+  8016cd:	5b                   	pop    %rbx
+  8016ce:	41 5c                	pop    %r12
+  8016d0:	41 5d                	pop    %r13
+  8016d2:	41 5e                	pop    %r14
+  8016d4:	41 5f                	pop    %r15
+  8016d6:	5d                   	pop    %rbp
+  8016d7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8016d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8016dd:	4c 89 ee             	mov    %r13,%rsi
+  8016e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016e5:	49 bc 5c 0b 80 00 00 	movabs $0x800b5c,%r12
+  8016ec:	00 00 00 
+  8016ef:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8016f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8016f7:	4c 89 f6             	mov    %r14,%rsi
+  8016fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016ff:	41 ff d4             	call   *%r12
+    return res;
+  801702:	eb c3                	jmp    8016c7 <dup+0xe6>
+
+0000000000801704 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801704:	55                   	push   %rbp
+  801705:	48 89 e5             	mov    %rsp,%rbp
+  801708:	41 56                	push   %r14
+  80170a:	41 55                	push   %r13
+  80170c:	41 54                	push   %r12
+  80170e:	53                   	push   %rbx
+  80170f:	48 83 ec 10          	sub    $0x10,%rsp
+  801713:	89 fb                	mov    %edi,%ebx
+  801715:	49 89 f4             	mov    %rsi,%r12
+  801718:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80171b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80171f:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  801726:	00 00 00 
+  801729:	ff d0                	call   *%rax
+  80172b:	85 c0                	test   %eax,%eax
+  80172d:	78 4c                	js     80177b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80172f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801733:	41 8b 3e             	mov    (%r14),%edi
+  801736:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80173a:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  801741:	00 00 00 
+  801744:	ff d0                	call   *%rax
+  801746:	85 c0                	test   %eax,%eax
+  801748:	78 35                	js     80177f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80174a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80174e:	83 e0 03             	and    $0x3,%eax
+  801751:	83 f8 01             	cmp    $0x1,%eax
+  801754:	74 2d                	je     801783 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801756:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80175a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80175e:	48 85 c0             	test   %rax,%rax
+  801761:	74 56                	je     8017b9 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801763:	4c 89 ea             	mov    %r13,%rdx
+  801766:	4c 89 e6             	mov    %r12,%rsi
+  801769:	4c 89 f7             	mov    %r14,%rdi
+  80176c:	ff d0                	call   *%rax
+}
+  80176e:	48 83 c4 10          	add    $0x10,%rsp
+  801772:	5b                   	pop    %rbx
+  801773:	41 5c                	pop    %r12
+  801775:	41 5d                	pop    %r13
+  801777:	41 5e                	pop    %r14
+  801779:	5d                   	pop    %rbp
+  80177a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80177b:	48 98                	cltq
+  80177d:	eb ef                	jmp    80176e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80177f:	48 98                	cltq
+  801781:	eb eb                	jmp    80176e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801783:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80178a:	00 00 00 
+  80178d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801793:	89 da                	mov    %ebx,%edx
+  801795:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  80179c:	00 00 00 
+  80179f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a4:	48 b9 6c 37 80 00 00 	movabs $0x80376c,%rcx
+  8017ab:	00 00 00 
+  8017ae:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8017b0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8017b7:	eb b5                	jmp    80176e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8017b9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8017c0:	eb ac                	jmp    80176e <read+0x6a>
+
+00000000008017c2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8017c2:	55                   	push   %rbp
+  8017c3:	48 89 e5             	mov    %rsp,%rbp
+  8017c6:	41 57                	push   %r15
+  8017c8:	41 56                	push   %r14
+  8017ca:	41 55                	push   %r13
+  8017cc:	41 54                	push   %r12
+  8017ce:	53                   	push   %rbx
+  8017cf:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8017d3:	48 85 d2             	test   %rdx,%rdx
+  8017d6:	74 54                	je     80182c <readn+0x6a>
+  8017d8:	41 89 fd             	mov    %edi,%r13d
+  8017db:	49 89 f6             	mov    %rsi,%r14
+  8017de:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8017e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8017e6:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8017eb:	49 bf 04 17 80 00 00 	movabs $0x801704,%r15
+  8017f2:	00 00 00 
+  8017f5:	4c 89 e2             	mov    %r12,%rdx
+  8017f8:	48 29 f2             	sub    %rsi,%rdx
+  8017fb:	4c 01 f6             	add    %r14,%rsi
+  8017fe:	44 89 ef             	mov    %r13d,%edi
+  801801:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801804:	85 c0                	test   %eax,%eax
+  801806:	78 20                	js     801828 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801808:	01 c3                	add    %eax,%ebx
+  80180a:	85 c0                	test   %eax,%eax
+  80180c:	74 08                	je     801816 <readn+0x54>
+  80180e:	48 63 f3             	movslq %ebx,%rsi
+  801811:	4c 39 e6             	cmp    %r12,%rsi
+  801814:	72 df                	jb     8017f5 <readn+0x33>
+    }
+    return res;
+  801816:	48 63 c3             	movslq %ebx,%rax
+}
+  801819:	48 83 c4 08          	add    $0x8,%rsp
+  80181d:	5b                   	pop    %rbx
+  80181e:	41 5c                	pop    %r12
+  801820:	41 5d                	pop    %r13
+  801822:	41 5e                	pop    %r14
+  801824:	41 5f                	pop    %r15
+  801826:	5d                   	pop    %rbp
+  801827:	c3                   	ret
+        if (inc < 0) return inc;
+  801828:	48 98                	cltq
+  80182a:	eb ed                	jmp    801819 <readn+0x57>
+    int inc = 1, res = 0;
+  80182c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801831:	eb e3                	jmp    801816 <readn+0x54>
+
+0000000000801833 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801833:	55                   	push   %rbp
+  801834:	48 89 e5             	mov    %rsp,%rbp
+  801837:	41 56                	push   %r14
+  801839:	41 55                	push   %r13
+  80183b:	41 54                	push   %r12
+  80183d:	53                   	push   %rbx
+  80183e:	48 83 ec 10          	sub    $0x10,%rsp
+  801842:	89 fb                	mov    %edi,%ebx
+  801844:	49 89 f4             	mov    %rsi,%r12
+  801847:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80184a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80184e:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  801855:	00 00 00 
+  801858:	ff d0                	call   *%rax
+  80185a:	85 c0                	test   %eax,%eax
+  80185c:	78 47                	js     8018a5 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80185e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801862:	41 8b 3e             	mov    (%r14),%edi
+  801865:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801869:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  801870:	00 00 00 
+  801873:	ff d0                	call   *%rax
+  801875:	85 c0                	test   %eax,%eax
+  801877:	78 30                	js     8018a9 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801879:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80187e:	74 2d                	je     8018ad <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801880:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801884:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801888:	48 85 c0             	test   %rax,%rax
+  80188b:	74 56                	je     8018e3 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80188d:	4c 89 ea             	mov    %r13,%rdx
+  801890:	4c 89 e6             	mov    %r12,%rsi
+  801893:	4c 89 f7             	mov    %r14,%rdi
+  801896:	ff d0                	call   *%rax
+}
+  801898:	48 83 c4 10          	add    $0x10,%rsp
+  80189c:	5b                   	pop    %rbx
+  80189d:	41 5c                	pop    %r12
+  80189f:	41 5d                	pop    %r13
+  8018a1:	41 5e                	pop    %r14
+  8018a3:	5d                   	pop    %rbp
+  8018a4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018a5:	48 98                	cltq
+  8018a7:	eb ef                	jmp    801898 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018a9:	48 98                	cltq
+  8018ab:	eb eb                	jmp    801898 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018ad:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8018b4:	00 00 00 
+  8018b7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8018bd:	89 da                	mov    %ebx,%edx
+  8018bf:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  8018c6:	00 00 00 
+  8018c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ce:	48 b9 6c 37 80 00 00 	movabs $0x80376c,%rcx
+  8018d5:	00 00 00 
+  8018d8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8018da:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8018e1:	eb b5                	jmp    801898 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8018e3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8018ea:	eb ac                	jmp    801898 <write+0x65>
+
+00000000008018ec <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8018ec:	55                   	push   %rbp
+  8018ed:	48 89 e5             	mov    %rsp,%rbp
+  8018f0:	53                   	push   %rbx
+  8018f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8018f5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018f7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8018fb:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  801902:	00 00 00 
+  801905:	ff d0                	call   *%rax
+  801907:	85 c0                	test   %eax,%eax
+  801909:	78 0c                	js     801917 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80190b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80190f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801912:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801917:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80191b:	c9                   	leave
+  80191c:	c3                   	ret
+
+000000000080191d <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80191d:	55                   	push   %rbp
+  80191e:	48 89 e5             	mov    %rsp,%rbp
+  801921:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801925:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801929:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  801930:	00 00 00 
+  801933:	ff d0                	call   *%rax
+  801935:	85 c0                	test   %eax,%eax
+  801937:	78 07                	js     801940 <tell+0x23>
+    return fdes->fd_offset;
+  801939:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80193d:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  801940:	c9                   	leave
+  801941:	c3                   	ret
+
+0000000000801942 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801942:	55                   	push   %rbp
+  801943:	48 89 e5             	mov    %rsp,%rbp
+  801946:	41 55                	push   %r13
+  801948:	41 54                	push   %r12
+  80194a:	53                   	push   %rbx
+  80194b:	48 83 ec 18          	sub    $0x18,%rsp
+  80194f:	89 fb                	mov    %edi,%ebx
+  801951:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801954:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801958:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  80195f:	00 00 00 
+  801962:	ff d0                	call   *%rax
+  801964:	85 c0                	test   %eax,%eax
+  801966:	78 38                	js     8019a0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801968:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80196c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801970:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801974:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  80197b:	00 00 00 
+  80197e:	ff d0                	call   *%rax
+  801980:	85 c0                	test   %eax,%eax
+  801982:	78 1c                	js     8019a0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801984:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801989:	74 20                	je     8019ab <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80198b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80198f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801993:	48 85 c0             	test   %rax,%rax
+  801996:	74 47                	je     8019df <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801998:	44 89 e6             	mov    %r12d,%esi
+  80199b:	4c 89 ef             	mov    %r13,%rdi
+  80199e:	ff d0                	call   *%rax
+}
+  8019a0:	48 83 c4 18          	add    $0x18,%rsp
+  8019a4:	5b                   	pop    %rbx
+  8019a5:	41 5c                	pop    %r12
+  8019a7:	41 5d                	pop    %r13
+  8019a9:	5d                   	pop    %rbp
+  8019aa:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8019ab:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8019b2:	00 00 00 
+  8019b5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019bb:	89 da                	mov    %ebx,%edx
+  8019bd:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  8019c4:	00 00 00 
+  8019c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cc:	48 b9 6c 37 80 00 00 	movabs $0x80376c,%rcx
+  8019d3:	00 00 00 
+  8019d6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8019d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019dd:	eb c1                	jmp    8019a0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8019df:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8019e4:	eb ba                	jmp    8019a0 <ftruncate+0x5e>
+
+00000000008019e6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8019e6:	55                   	push   %rbp
+  8019e7:	48 89 e5             	mov    %rsp,%rbp
+  8019ea:	41 54                	push   %r12
+  8019ec:	53                   	push   %rbx
+  8019ed:	48 83 ec 10          	sub    $0x10,%rsp
+  8019f1:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019f4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8019f8:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  8019ff:	00 00 00 
+  801a02:	ff d0                	call   *%rax
+  801a04:	85 c0                	test   %eax,%eax
+  801a06:	78 4e                	js     801a56 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a08:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801a0c:	41 8b 3c 24          	mov    (%r12),%edi
+  801a10:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801a14:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  801a1b:	00 00 00 
+  801a1e:	ff d0                	call   *%rax
+  801a20:	85 c0                	test   %eax,%eax
+  801a22:	78 32                	js     801a56 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801a24:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a28:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801a2d:	74 30                	je     801a5f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801a2f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801a32:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801a39:	00 00 00 
+    stat->st_isdir = 0;
+  801a3c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801a43:	00 00 00 
+    stat->st_dev = dev;
+  801a46:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801a4d:	48 89 de             	mov    %rbx,%rsi
+  801a50:	4c 89 e7             	mov    %r12,%rdi
+  801a53:	ff 50 28             	call   *0x28(%rax)
+}
+  801a56:	48 83 c4 10          	add    $0x10,%rsp
+  801a5a:	5b                   	pop    %rbx
+  801a5b:	41 5c                	pop    %r12
+  801a5d:	5d                   	pop    %rbp
+  801a5e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801a5f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801a64:	eb f0                	jmp    801a56 <fstat+0x70>
+
+0000000000801a66 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  801a66:	55                   	push   %rbp
+  801a67:	48 89 e5             	mov    %rsp,%rbp
+  801a6a:	41 54                	push   %r12
+  801a6c:	53                   	push   %rbx
+  801a6d:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  801a74:	41 89 fc             	mov    %edi,%r12d
+  801a77:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a79:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a7d:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  801a84:	00 00 00 
+  801a87:	ff d0                	call   *%rax
+  801a89:	85 c0                	test   %eax,%eax
+  801a8b:	78 31                	js     801abe <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  801a8d:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801a94:	44 89 e7             	mov    %r12d,%edi
+  801a97:	48 b8 e6 19 80 00 00 	movabs $0x8019e6,%rax
+  801a9e:	00 00 00 
+  801aa1:	ff d0                	call   *%rax
+  801aa3:	85 c0                	test   %eax,%eax
+  801aa5:	78 17                	js     801abe <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  801aa7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aab:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  801aae:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801ab1:	39 d3                	cmp    %edx,%ebx
+  801ab3:	0f 4f da             	cmovg  %edx,%ebx
+  801ab6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801abe:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  801ac5:	5b                   	pop    %rbx
+  801ac6:	41 5c                	pop    %r12
+  801ac8:	5d                   	pop    %rbp
+  801ac9:	c3                   	ret
+
+0000000000801aca <seektoend>:
+{
+  801aca:	55                   	push   %rbp
+  801acb:	48 89 e5             	mov    %rsp,%rbp
+  801ace:	53                   	push   %rbx
+  801acf:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  801ad6:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801ad8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801adc:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  801ae3:	00 00 00 
+  801ae6:	ff d0                	call   *%rax
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	78 28                	js     801b14 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  801aec:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801af3:	89 df                	mov    %ebx,%edi
+  801af5:	48 b8 e6 19 80 00 00 	movabs $0x8019e6,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+  801b01:	85 c0                	test   %eax,%eax
+  801b03:	78 0f                	js     801b14 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  801b05:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801b08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b0c:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  801b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b14:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b18:	c9                   	leave
+  801b19:	c3                   	ret
+
+0000000000801b1a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801b1a:	55                   	push   %rbp
+  801b1b:	48 89 e5             	mov    %rsp,%rbp
+  801b1e:	41 54                	push   %r12
+  801b20:	53                   	push   %rbx
+  801b21:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801b24:	be 00 00 00 00       	mov    $0x0,%esi
+  801b29:	48 b8 0d 27 80 00 00 	movabs $0x80270d,%rax
+  801b30:	00 00 00 
+  801b33:	ff d0                	call   *%rax
+  801b35:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801b37:	85 c0                	test   %eax,%eax
+  801b39:	78 25                	js     801b60 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801b3b:	4c 89 e6             	mov    %r12,%rsi
+  801b3e:	89 c7                	mov    %eax,%edi
+  801b40:	48 b8 e6 19 80 00 00 	movabs $0x8019e6,%rax
+  801b47:	00 00 00 
+  801b4a:	ff d0                	call   *%rax
+  801b4c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801b4f:	89 df                	mov    %ebx,%edi
+  801b51:	48 b8 86 15 80 00 00 	movabs $0x801586,%rax
+  801b58:	00 00 00 
+  801b5b:	ff d0                	call   *%rax
+
+    return res;
+  801b5d:	44 89 e3             	mov    %r12d,%ebx
+}
+  801b60:	89 d8                	mov    %ebx,%eax
+  801b62:	5b                   	pop    %rbx
+  801b63:	41 5c                	pop    %r12
+  801b65:	5d                   	pop    %rbp
+  801b66:	c3                   	ret
+
+0000000000801b67 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  801b67:	55                   	push   %rbp
+  801b68:	48 89 e5             	mov    %rsp,%rbp
+  801b6b:	53                   	push   %rbx
+  801b6c:	48 83 ec 08          	sub    $0x8,%rsp
+  801b70:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801b73:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  801b7a:	00 00 00 
+  801b7d:	ff d0                	call   *%rax
+  801b7f:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801b83:	0f 87 ea 00 00 00    	ja     801c73 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  801b89:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  801b90:	00 00 00 
+  801b93:	80 38 00             	cmpb   $0x0,(%rax)
+  801b96:	75 35                	jne    801bcd <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  801b98:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801b9d:	ba 00 00 22 00       	mov    $0x220000,%edx
+  801ba2:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  801ba7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bac:	48 b8 7d 09 80 00 00 	movabs $0x80097d,%rax
+  801bb3:	00 00 00 
+  801bb6:	ff d0                	call   *%rax
+  801bb8:	85 c0                	test   %eax,%eax
+  801bba:	0f 88 ba 00 00 00    	js     801c7a <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  801bc0:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  801bc7:	00 00 00 
+  801bca:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  801bcd:	48 89 df             	mov    %rbx,%rdi
+  801bd0:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  801bd7:	00 00 00 
+  801bda:	ff d0                	call   *%rax
+  801bdc:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  801be0:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  801be7:	00 00 00 
+  801bea:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  801bee:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  801bf1:	39 39                	cmp    %edi,(%rcx)
+  801bf3:	74 46                	je     801c3b <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  801bf5:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  801bf9:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  801c00:	00 
+  801c01:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  801c08:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  801c0f:	00 
+  801c10:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  801c17:	00 
+  801c18:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  801c1f:	00 
+  801c20:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  801c27:	00 
+  801c28:	89 39                	mov    %edi,(%rcx)
+  801c2a:	48 01 c6             	add    %rax,%rsi
+  801c2d:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  801c32:	48 89 c8             	mov    %rcx,%rax
+  801c35:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c39:	c9                   	leave
+  801c3a:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  801c3b:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  801c3f:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  801c46:	00 00 00 
+  801c49:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801c4c:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  801c50:	74 e0                	je     801c32 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  801c52:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  801c59:	00 
+  801c5a:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  801c5e:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  801c65:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  801c67:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801c6a:	48 01 c2             	add    %rax,%rdx
+  801c6d:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  801c71:	eb bf                	jmp    801c32 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801c73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c78:	eb b8                	jmp    801c32 <fbuf_get+0xcb>
+            return NULL;
+  801c7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c7f:	eb b1                	jmp    801c32 <fbuf_get+0xcb>
+
+0000000000801c81 <fsipc_bulk>:
+fsipc_bulk(void) {
+  801c81:	55                   	push   %rbp
+  801c82:	48 89 e5             	mov    %rsp,%rbp
+  801c85:	53                   	push   %rbx
+  801c86:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  801c8a:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  801c91:	00 00 00 
+  801c94:	48 8b 18             	mov    (%rax),%rbx
+  801c97:	48 85 db             	test   %rbx,%rbx
+  801c9a:	74 16                	je     801cb2 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  801c9c:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  801ca3:	00 00 00 
+  801ca6:	48 8b 18             	mov    (%rax),%rbx
+}
+  801ca9:	48 89 d8             	mov    %rbx,%rax
+  801cac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cb0:	c9                   	leave
+  801cb1:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  801cb2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801cb7:	ba 00 10 04 00       	mov    $0x41000,%edx
+  801cbc:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  801cc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc6:	48 b8 7d 09 80 00 00 	movabs $0x80097d,%rax
+  801ccd:	00 00 00 
+  801cd0:	ff d0                	call   *%rax
+  801cd2:	85 c0                	test   %eax,%eax
+  801cd4:	78 d3                	js     801ca9 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  801cd6:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  801cdb:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  801ce2:	00 00 00 
+  801ce5:	eb b5                	jmp    801c9c <fsipc_bulk+0x1b>
+
+0000000000801ce7 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  801ce7:	55                   	push   %rbp
+  801ce8:	48 89 e5             	mov    %rsp,%rbp
+  801ceb:	41 57                	push   %r15
+  801ced:	41 56                	push   %r14
+  801cef:	41 55                	push   %r13
+  801cf1:	41 54                	push   %r12
+  801cf3:	53                   	push   %rbx
+  801cf4:	48 83 ec 08          	sub    $0x8,%rsp
+  801cf8:	41 89 fd             	mov    %edi,%r13d
+  801cfb:	49 89 f6             	mov    %rsi,%r14
+  801cfe:	49 89 d7             	mov    %rdx,%r15
+  801d01:	48 89 cb             	mov    %rcx,%rbx
+  801d04:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d07:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801d0e:	00 00 00 
+  801d11:	83 38 00             	cmpl   $0x0,(%rax)
+  801d14:	74 52                	je     801d68 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  801d16:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801d1c:	4c 89 f9             	mov    %r15,%rcx
+  801d1f:	4c 89 f2             	mov    %r14,%rdx
+  801d22:	44 89 ee             	mov    %r13d,%esi
+  801d25:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801d2c:	00 00 00 
+  801d2f:	8b 38                	mov    (%rax),%edi
+  801d31:	48 b8 56 42 80 00 00 	movabs $0x804256,%rax
+  801d38:	00 00 00 
+  801d3b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  801d3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d42:	4c 89 e2             	mov    %r12,%rdx
+  801d45:	48 89 de             	mov    %rbx,%rsi
+  801d48:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d4d:	48 b8 a6 40 80 00 00 	movabs $0x8040a6,%rax
+  801d54:	00 00 00 
+  801d57:	ff d0                	call   *%rax
+}
+  801d59:	48 83 c4 08          	add    $0x8,%rsp
+  801d5d:	5b                   	pop    %rbx
+  801d5e:	41 5c                	pop    %r12
+  801d60:	41 5d                	pop    %r13
+  801d62:	41 5e                	pop    %r14
+  801d64:	41 5f                	pop    %r15
+  801d66:	5d                   	pop    %rbp
+  801d67:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d68:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d6d:	48 b8 f9 42 80 00 00 	movabs $0x8042f9,%rax
+  801d74:	00 00 00 
+  801d77:	ff d0                	call   *%rax
+  801d79:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  801d80:	00 00 
+  801d82:	eb 92                	jmp    801d16 <fsipc_region+0x2f>
+
+0000000000801d84 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  801d84:	55                   	push   %rbp
+  801d85:	48 89 e5             	mov    %rsp,%rbp
+  801d88:	41 57                	push   %r15
+  801d8a:	41 56                	push   %r14
+  801d8c:	41 55                	push   %r13
+  801d8e:	41 54                	push   %r12
+  801d90:	53                   	push   %rbx
+  801d91:	48 83 ec 28          	sub    $0x28,%rsp
+  801d95:	49 89 ff             	mov    %rdi,%r15
+  801d98:	49 89 f6             	mov    %rsi,%r14
+  801d9b:	48 89 d3             	mov    %rdx,%rbx
+  801d9e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801da2:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  801da5:	48 b8 81 1c 80 00 00 	movabs $0x801c81,%rax
+  801dac:	00 00 00 
+  801daf:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  801db1:	48 85 c0             	test   %rax,%rax
+  801db4:	0f 84 cc 00 00 00    	je     801e86 <devfile_write_direct+0x102>
+  801dba:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  801dbd:	48 85 db             	test   %rbx,%rbx
+  801dc0:	0f 84 ba 00 00 00    	je     801e80 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  801dc6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  801dcc:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801dd3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  801dd7:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801ddb:	4c 29 e3             	sub    %r12,%rbx
+  801dde:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801de3:	48 39 c3             	cmp    %rax,%rbx
+  801de6:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  801dea:	48 89 da             	mov    %rbx,%rdx
+  801ded:	4c 89 f6             	mov    %r14,%rsi
+  801df0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801df4:	48 b8 12 06 80 00 00 	movabs $0x800612,%rax
+  801dfb:	00 00 00 
+  801dfe:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  801e00:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801e04:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  801e08:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e0b:	44 01 e0             	add    %r12d,%eax
+  801e0e:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  801e12:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  801e16:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  801e1d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801e24:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  801e2b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e36:	4c 89 ee             	mov    %r13,%rsi
+  801e39:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e3e:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  801e45:	00 00 00 
+  801e48:	ff d0                	call   *%rax
+        if (res < 0)
+  801e4a:	85 c0                	test   %eax,%eax
+  801e4c:	78 29                	js     801e77 <devfile_write_direct+0xf3>
+        if (res == 0)
+  801e4e:	74 2b                	je     801e7b <devfile_write_direct+0xf7>
+        i += res;
+  801e50:	48 98                	cltq
+  801e52:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  801e55:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  801e58:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e5c:	49 39 c4             	cmp    %rax,%r12
+  801e5f:	0f 82 72 ff ff ff    	jb     801dd7 <devfile_write_direct+0x53>
+    return i;
+  801e65:	4c 89 e0             	mov    %r12,%rax
+}
+  801e68:	48 83 c4 28          	add    $0x28,%rsp
+  801e6c:	5b                   	pop    %rbx
+  801e6d:	41 5c                	pop    %r12
+  801e6f:	41 5d                	pop    %r13
+  801e71:	41 5e                	pop    %r14
+  801e73:	41 5f                	pop    %r15
+  801e75:	5d                   	pop    %rbp
+  801e76:	c3                   	ret
+            return res;
+  801e77:	48 98                	cltq
+  801e79:	eb ed                	jmp    801e68 <devfile_write_direct+0xe4>
+            return i;
+  801e7b:	4c 89 e0             	mov    %r12,%rax
+  801e7e:	eb e8                	jmp    801e68 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  801e80:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  801e84:	eb df                	jmp    801e65 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  801e86:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  801e8d:	eb d9                	jmp    801e68 <devfile_write_direct+0xe4>
+
+0000000000801e8f <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  801e8f:	55                   	push   %rbp
+  801e90:	48 89 e5             	mov    %rsp,%rbp
+  801e93:	41 56                	push   %r14
+  801e95:	41 55                	push   %r13
+  801e97:	41 54                	push   %r12
+  801e99:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  801e9a:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  801e9e:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  801ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea7:	4d 39 ee             	cmp    %r13,%r14
+  801eaa:	0f 84 99 00 00 00    	je     801f49 <fbuf_flush+0xba>
+  801eb0:	49 89 fc             	mov    %rdi,%r12
+  801eb3:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  801eb6:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  801eb9:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801ebd:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  801ec4:	00 00 00 
+  801ec7:	ff d0                	call   *%rax
+  801ec9:	48 89 c2             	mov    %rax,%rdx
+  801ecc:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ed0:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801ed4:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ed8:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801edd:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  801ee0:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801ee4:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801eeb:	00 
+  801eec:	44 89 f1             	mov    %r14d,%ecx
+  801eef:	4c 89 ea             	mov    %r13,%rdx
+  801ef2:	4c 89 e7             	mov    %r12,%rdi
+  801ef5:	48 b8 84 1d 80 00 00 	movabs $0x801d84,%rax
+  801efc:	00 00 00 
+  801eff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801f01:	48 85 c0             	test   %rax,%rax
+  801f04:	78 43                	js     801f49 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  801f06:	4c 39 e8             	cmp    %r13,%rax
+  801f09:	72 47                	jb     801f52 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  801f0b:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  801f10:	83 c0 01             	add    $0x1,%eax
+  801f13:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801f18:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  801f1b:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801f1f:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  801f23:	72 0f                	jb     801f34 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  801f25:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  801f29:	48 39 c2             	cmp    %rax,%rdx
+  801f2c:	48 0f 42 d0          	cmovb  %rax,%rdx
+  801f30:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  801f34:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  801f3b:	00 
+  801f3c:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  801f43:	00 
+    return 0;
+  801f44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f49:	5b                   	pop    %rbx
+  801f4a:	41 5c                	pop    %r12
+  801f4c:	41 5d                	pop    %r13
+  801f4e:	41 5e                	pop    %r14
+  801f50:	5d                   	pop    %rbp
+  801f51:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  801f52:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801f57:	eb f0                	jmp    801f49 <fbuf_flush+0xba>
+
+0000000000801f59 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  801f59:	55                   	push   %rbp
+  801f5a:	48 89 e5             	mov    %rsp,%rbp
+  801f5d:	53                   	push   %rbx
+  801f5e:	48 83 ec 08          	sub    $0x8,%rsp
+  801f62:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  801f65:	48 b8 67 1b 80 00 00 	movabs $0x801b67,%rax
+  801f6c:	00 00 00 
+  801f6f:	ff d0                	call   *%rax
+  801f71:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  801f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f79:	48 85 f6             	test   %rsi,%rsi
+  801f7c:	74 0f                	je     801f8d <devfile_sync+0x34>
+  801f7e:	48 89 df             	mov    %rbx,%rdi
+  801f81:	48 b8 8f 1e 80 00 00 	movabs $0x801e8f,%rax
+  801f88:	00 00 00 
+  801f8b:	ff d0                	call   *%rax
+}
+  801f8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f91:	c9                   	leave
+  801f92:	c3                   	ret
+
+0000000000801f93 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  801f93:	55                   	push   %rbp
+  801f94:	48 89 e5             	mov    %rsp,%rbp
+  801f97:	48 83 ec 10          	sub    $0x10,%rsp
+  801f9b:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  801f9e:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  801fa5:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  801fa6:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  801faa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801faf:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  801fb6:	00 00 00 
+  801fb9:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  801fc0:	00 00 00 
+  801fc3:	ff d0                	call   *%rax
+}
+  801fc5:	c9                   	leave
+  801fc6:	c3                   	ret
+
+0000000000801fc7 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801fc7:	55                   	push   %rbp
+  801fc8:	48 89 e5             	mov    %rsp,%rbp
+  801fcb:	41 54                	push   %r12
+  801fcd:	53                   	push   %rbx
+  801fce:	48 89 fb             	mov    %rdi,%rbx
+  801fd1:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  801fd4:	48 b8 59 1f 80 00 00 	movabs $0x801f59,%rax
+  801fdb:	00 00 00 
+  801fde:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	78 63                	js     802047 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fe4:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801fe7:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  801fee:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  801ff0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff5:	bf 05 00 00 00       	mov    $0x5,%edi
+  801ffa:	48 b8 93 1f 80 00 00 	movabs $0x801f93,%rax
+  802001:	00 00 00 
+  802004:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802006:	85 c0                	test   %eax,%eax
+  802008:	78 3d                	js     802047 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80200a:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802011:	00 00 00 
+  802014:	48 89 de             	mov    %rbx,%rsi
+  802017:	4c 89 e7             	mov    %r12,%rdi
+  80201a:	48 b8 1d 02 80 00 00 	movabs $0x80021d,%rax
+  802021:	00 00 00 
+  802024:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802026:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80202c:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802033:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802034:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80203a:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802041:	00 
+
+    return 0;
+  802042:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802047:	5b                   	pop    %rbx
+  802048:	41 5c                	pop    %r12
+  80204a:	5d                   	pop    %rbp
+  80204b:	c3                   	ret
+
+000000000080204c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80204c:	55                   	push   %rbp
+  80204d:	48 89 e5             	mov    %rsp,%rbp
+  802050:	41 54                	push   %r12
+  802052:	53                   	push   %rbx
+  802053:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802056:	48 b8 59 1f 80 00 00 	movabs $0x801f59,%rax
+  80205d:	00 00 00 
+  802060:	ff d0                	call   *%rax
+  802062:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802065:	48 89 df             	mov    %rbx,%rdi
+  802068:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  80206f:	00 00 00 
+  802072:	ff d0                	call   *%rax
+  802074:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802078:	76 2e                	jbe    8020a8 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  80207a:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80207d:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802084:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802086:	be 00 00 00 00       	mov    $0x0,%esi
+  80208b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802090:	48 b8 93 1f 80 00 00 	movabs $0x801f93,%rax
+  802097:	00 00 00 
+  80209a:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  80209c:	45 85 e4             	test   %r12d,%r12d
+  80209f:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8020a3:	5b                   	pop    %rbx
+  8020a4:	41 5c                	pop    %r12
+  8020a6:	5d                   	pop    %rbp
+  8020a7:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8020a8:	48 89 df             	mov    %rbx,%rdi
+  8020ab:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  8020b2:	00 00 00 
+  8020b5:	ff d0                	call   *%rax
+  8020b7:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8020bb:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8020c2:	00 00 00 
+  8020c5:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8020cc:	48 89 df             	mov    %rbx,%rdi
+  8020cf:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  8020d6:	00 00 00 
+  8020d9:	ff d0                	call   *%rax
+  8020db:	48 89 c6             	mov    %rax,%rsi
+  8020de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e8:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  8020ef:	00 00 00 
+  8020f2:	ff d0                	call   *%rax
+  8020f4:	eb 84                	jmp    80207a <devfile_flush+0x2e>
+
+00000000008020f6 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8020f6:	55                   	push   %rbp
+  8020f7:	48 89 e5             	mov    %rsp,%rbp
+  8020fa:	41 55                	push   %r13
+  8020fc:	41 54                	push   %r12
+  8020fe:	53                   	push   %rbx
+  8020ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802103:	48 89 fb             	mov    %rdi,%rbx
+  802106:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802109:	48 b8 67 1b 80 00 00 	movabs $0x801b67,%rax
+  802110:	00 00 00 
+  802113:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802115:	48 85 c0             	test   %rax,%rax
+  802118:	74 51                	je     80216b <devfile_trunc+0x75>
+  80211a:	49 89 c4             	mov    %rax,%r12
+  80211d:	48 89 c6             	mov    %rax,%rsi
+  802120:	48 89 df             	mov    %rbx,%rdi
+  802123:	48 b8 8f 1e 80 00 00 	movabs $0x801e8f,%rax
+  80212a:	00 00 00 
+  80212d:	ff d0                	call   *%rax
+  80212f:	85 c0                	test   %eax,%eax
+  802131:	78 2d                	js     802160 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802133:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  80213a:	00 00 00 
+  80213d:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802140:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802142:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802146:	be 00 00 00 00       	mov    $0x0,%esi
+  80214b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802150:	48 b8 93 1f 80 00 00 	movabs $0x801f93,%rax
+  802157:	00 00 00 
+  80215a:	ff d0                	call   *%rax
+    if (res >= 0) {
+  80215c:	85 c0                	test   %eax,%eax
+  80215e:	79 3e                	jns    80219e <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802160:	48 83 c4 08          	add    $0x8,%rsp
+  802164:	5b                   	pop    %rbx
+  802165:	41 5c                	pop    %r12
+  802167:	41 5d                	pop    %r13
+  802169:	5d                   	pop    %rbp
+  80216a:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80216b:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802172:	00 00 00 
+  802175:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802178:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80217a:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  80217e:	be 00 00 00 00       	mov    $0x0,%esi
+  802183:	bf 02 00 00 00       	mov    $0x2,%edi
+  802188:	48 b8 93 1f 80 00 00 	movabs $0x801f93,%rax
+  80218f:	00 00 00 
+  802192:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802194:	85 c0                	test   %eax,%eax
+  802196:	78 c8                	js     802160 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802198:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80219c:	eb c2                	jmp    802160 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  80219e:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  8021a1:	8d 51 01             	lea    0x1(%rcx),%edx
+  8021a4:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8021a7:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  8021ac:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8021b3:	00 00 
+  8021b5:	eb a9                	jmp    802160 <devfile_trunc+0x6a>
+
+00000000008021b7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8021b7:	55                   	push   %rbp
+  8021b8:	48 89 e5             	mov    %rsp,%rbp
+  8021bb:	41 57                	push   %r15
+  8021bd:	41 56                	push   %r14
+  8021bf:	41 55                	push   %r13
+  8021c1:	41 54                	push   %r12
+  8021c3:	53                   	push   %rbx
+  8021c4:	48 83 ec 28          	sub    $0x28,%rsp
+  8021c8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8021cc:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8021d0:	49 89 d7             	mov    %rdx,%r15
+  8021d3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8021d7:	48 b8 67 1b 80 00 00 	movabs $0x801b67,%rax
+  8021de:	00 00 00 
+  8021e1:	ff d0                	call   *%rax
+  8021e3:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  8021e6:	48 85 c0             	test   %rax,%rax
+  8021e9:	74 31                	je     80221c <devfile_write+0x65>
+  8021eb:	4c 89 f8             	mov    %r15,%rax
+  8021ee:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  8021f5:	77 25                	ja     80221c <devfile_write+0x65>
+    size_t i = 0;
+  8021f7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  8021fd:	48 85 c0             	test   %rax,%rax
+  802200:	0f 85 64 01 00 00    	jne    80236a <devfile_write+0x1b3>
+    size_t i = 0;
+  802206:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  80220a:	4c 89 f8             	mov    %r15,%rax
+}
+  80220d:	48 83 c4 28          	add    $0x28,%rsp
+  802211:	5b                   	pop    %rbx
+  802212:	41 5c                	pop    %r12
+  802214:	41 5d                	pop    %r13
+  802216:	41 5e                	pop    %r14
+  802218:	41 5f                	pop    %r15
+  80221a:	5d                   	pop    %rbp
+  80221b:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80221c:	48 85 db             	test   %rbx,%rbx
+  80221f:	74 5b                	je     80227c <devfile_write+0xc5>
+  802221:	48 89 de             	mov    %rbx,%rsi
+  802224:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802228:	48 b8 8f 1e 80 00 00 	movabs $0x801e8f,%rax
+  80222f:	00 00 00 
+  802232:	ff d0                	call   *%rax
+  802234:	85 c0                	test   %eax,%eax
+  802236:	78 40                	js     802278 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802238:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80223c:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  80223f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802243:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802247:	48 b8 84 1d 80 00 00 	movabs $0x801d84,%rax
+  80224e:	00 00 00 
+  802251:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802253:	48 85 c0             	test   %rax,%rax
+  802256:	7e b5                	jle    80220d <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802258:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80225c:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  80225f:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802262:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802265:	8d 51 01             	lea    0x1(%rcx),%edx
+  802268:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80226b:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  80226e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802275:	00 
+  802276:	eb 95                	jmp    80220d <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802278:	48 98                	cltq
+  80227a:	eb 91                	jmp    80220d <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80227c:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802280:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802283:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802287:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80228b:	48 89 df             	mov    %rbx,%rdi
+  80228e:	48 b8 84 1d 80 00 00 	movabs $0x801d84,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80229a:	48 85 c0             	test   %rax,%rax
+  80229d:	0f 8e 6a ff ff ff    	jle    80220d <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8022a3:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  8022a6:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8022aa:	e9 5e ff ff ff       	jmp    80220d <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8022af:	48 98                	cltq
+  8022b1:	4d 85 ff             	test   %r15,%r15
+  8022b4:	49 0f 45 c7          	cmovne %r15,%rax
+  8022b8:	e9 50 ff ff ff       	jmp    80220d <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8022bd:	48 89 de             	mov    %rbx,%rsi
+  8022c0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8022c4:	48 b8 8f 1e 80 00 00 	movabs $0x801e8f,%rax
+  8022cb:	00 00 00 
+  8022ce:	ff d0                	call   *%rax
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	0f 88 2b 01 00 00    	js     802403 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8022d8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8022dc:	4c 01 f8             	add    %r15,%rax
+  8022df:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8022e3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8022e7:	48 b9 93 13 80 00 00 	movabs $0x801393,%rcx
+  8022ee:	00 00 00 
+  8022f1:	ff d1                	call   *%rcx
+  8022f3:	48 89 c2             	mov    %rax,%rdx
+  8022f6:	48 c1 e2 04          	shl    $0x4,%rdx
+  8022fa:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8022fe:	48 c1 e0 0c          	shl    $0xc,%rax
+  802302:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802307:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80230a:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802311:	00 
+  802312:	4c 89 ea             	mov    %r13,%rdx
+  802315:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802319:	48 b8 12 06 80 00 00 	movabs $0x800612,%rax
+  802320:	00 00 00 
+  802323:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802325:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802329:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80232d:	48 39 c2             	cmp    %rax,%rdx
+  802330:	0f 84 db 00 00 00    	je     802411 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802336:	4c 39 e2             	cmp    %r12,%rdx
+  802339:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  80233d:	4d 01 ec             	add    %r13,%r12
+  802340:	49 39 c4             	cmp    %rax,%r12
+  802343:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802347:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  80234b:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  80234f:	45 01 ee             	add    %r13d,%r14d
+  802352:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802356:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  80235a:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  80235d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802361:	49 39 c7             	cmp    %rax,%r15
+  802364:	0f 83 a0 fe ff ff    	jae    80220a <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  80236a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80236e:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802372:	8b 43 08             	mov    0x8(%rbx),%eax
+  802375:	44 39 f0             	cmp    %r14d,%eax
+  802378:	7f 10                	jg     80238a <devfile_write+0x1d3>
+  80237a:	48 98                	cltq
+  80237c:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802382:	49 63 d6             	movslq %r14d,%rdx
+  802385:	48 39 d0             	cmp    %rdx,%rax
+  802388:	7d 2d                	jge    8023b7 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80238a:	48 89 de             	mov    %rbx,%rsi
+  80238d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802391:	48 b8 8f 1e 80 00 00 	movabs $0x801e8f,%rax
+  802398:	00 00 00 
+  80239b:	ff d0                	call   *%rax
+  80239d:	85 c0                	test   %eax,%eax
+  80239f:	0f 88 0a ff ff ff    	js     8022af <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8023a5:	44 89 f0             	mov    %r14d,%eax
+  8023a8:	66 b8 00 00          	mov    $0x0,%ax
+  8023ac:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  8023af:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8023b6:	00 
+        size_t off = pos - fb->fb_base;
+  8023b7:	45 89 f4             	mov    %r14d,%r12d
+  8023ba:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  8023be:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  8023c1:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  8023c5:	4d 29 fd             	sub    %r15,%r13
+  8023c8:	b8 00 00 01 00       	mov    $0x10000,%eax
+  8023cd:	4c 29 e0             	sub    %r12,%rax
+  8023d0:	49 39 c5             	cmp    %rax,%r13
+  8023d3:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  8023d7:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8023db:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8023df:	48 39 c2             	cmp    %rax,%rdx
+  8023e2:	0f 84 f0 fe ff ff    	je     8022d8 <devfile_write+0x121>
+  8023e8:	4c 39 e0             	cmp    %r12,%rax
+  8023eb:	0f 82 cc fe ff ff    	jb     8022bd <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  8023f1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8023f5:	48 39 d0             	cmp    %rdx,%rax
+  8023f8:	0f 83 da fe ff ff    	jae    8022d8 <devfile_write+0x121>
+  8023fe:	e9 ba fe ff ff       	jmp    8022bd <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802403:	48 98                	cltq
+  802405:	4d 85 ff             	test   %r15,%r15
+  802408:	49 0f 45 c7          	cmovne %r15,%rax
+  80240c:	e9 fc fd ff ff       	jmp    80220d <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802411:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802415:	4c 89 e2             	mov    %r12,%rdx
+  802418:	e9 2a ff ff ff       	jmp    802347 <devfile_write+0x190>
+
+000000000080241d <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80241d:	55                   	push   %rbp
+  80241e:	48 89 e5             	mov    %rsp,%rbp
+  802421:	41 57                	push   %r15
+  802423:	41 56                	push   %r14
+  802425:	41 55                	push   %r13
+  802427:	41 54                	push   %r12
+  802429:	53                   	push   %rbx
+  80242a:	48 83 ec 28          	sub    $0x28,%rsp
+  80242e:	49 89 ff             	mov    %rdi,%r15
+  802431:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802435:	48 89 d3             	mov    %rdx,%rbx
+  802438:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  80243c:	48 b8 67 1b 80 00 00 	movabs $0x801b67,%rax
+  802443:	00 00 00 
+  802446:	ff d0                	call   *%rax
+  802448:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  80244b:	48 85 c0             	test   %rax,%rax
+  80244e:	74 0d                	je     80245d <devfile_read+0x40>
+  802450:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802457:	0f 86 1a 01 00 00    	jbe    802577 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80245d:	4d 85 e4             	test   %r12,%r12
+  802460:	74 1a                	je     80247c <devfile_read+0x5f>
+  802462:	4c 89 e6             	mov    %r12,%rsi
+  802465:	4c 89 ff             	mov    %r15,%rdi
+  802468:	48 b8 8f 1e 80 00 00 	movabs $0x801e8f,%rax
+  80246f:	00 00 00 
+  802472:	ff d0                	call   *%rax
+  802474:	85 c0                	test   %eax,%eax
+  802476:	0f 88 e8 00 00 00    	js     802564 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  80247c:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802480:	48 b8 81 1c 80 00 00 	movabs $0x801c81,%rax
+  802487:	00 00 00 
+  80248a:	ff d0                	call   *%rax
+  80248c:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  80248f:	48 85 c0             	test   %rax,%rax
+  802492:	0f 84 69 02 00 00    	je     802701 <devfile_read+0x2e4>
+    while (i < n) {
+  802498:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80249d:	0f 84 ce 00 00 00    	je     802571 <devfile_read+0x154>
+    size_t i = 0;
+  8024a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8024a8:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8024af:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8024b3:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  8024b7:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  8024bb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8024bf:	48 29 da             	sub    %rbx,%rdx
+  8024c2:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8024c7:	48 39 c2             	cmp    %rax,%rdx
+  8024ca:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  8024ce:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8024d2:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  8024d6:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8024d9:	01 d8                	add    %ebx,%eax
+  8024db:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  8024df:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  8024e3:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  8024ea:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8024f1:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8024f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802503:	4c 89 ee             	mov    %r13,%rsi
+  802506:	bf 03 00 00 00       	mov    $0x3,%edi
+  80250b:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  802512:	00 00 00 
+  802515:	ff d0                	call   *%rax
+        if (res < 0)
+  802517:	85 c0                	test   %eax,%eax
+  802519:	78 4d                	js     802568 <devfile_read+0x14b>
+        if (res == 0)
+  80251b:	74 4f                	je     80256c <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80251d:	4c 63 e0             	movslq %eax,%r12
+  802520:	4c 89 e2             	mov    %r12,%rdx
+  802523:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802527:	4c 89 f7             	mov    %r14,%rdi
+  80252a:	48 b8 12 06 80 00 00 	movabs $0x800612,%rax
+  802531:	00 00 00 
+  802534:	ff d0                	call   *%rax
+        i += res;
+  802536:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  802539:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  80253c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802540:	48 39 c3             	cmp    %rax,%rbx
+  802543:	0f 82 72 ff ff ff    	jb     8024bb <devfile_read+0x9e>
+    return i;
+  802549:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80254c:	48 85 c0             	test   %rax,%rax
+  80254f:	7e 04                	jle    802555 <devfile_read+0x138>
+  802551:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  802555:	48 83 c4 28          	add    $0x28,%rsp
+  802559:	5b                   	pop    %rbx
+  80255a:	41 5c                	pop    %r12
+  80255c:	41 5d                	pop    %r13
+  80255e:	41 5e                	pop    %r14
+  802560:	41 5f                	pop    %r15
+  802562:	5d                   	pop    %rbp
+  802563:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802564:	48 98                	cltq
+  802566:	eb ed                	jmp    802555 <devfile_read+0x138>
+            return res;
+  802568:	48 98                	cltq
+  80256a:	eb e9                	jmp    802555 <devfile_read+0x138>
+            return i;
+  80256c:	48 89 d8             	mov    %rbx,%rax
+  80256f:	eb db                	jmp    80254c <devfile_read+0x12f>
+    size_t i = 0;
+  802571:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802575:	eb d2                	jmp    802549 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802577:	48 89 c6             	mov    %rax,%rsi
+  80257a:	4c 89 ff             	mov    %r15,%rdi
+  80257d:	48 b8 8f 1e 80 00 00 	movabs $0x801e8f,%rax
+  802584:	00 00 00 
+  802587:	ff d0                	call   *%rax
+  802589:	85 c0                	test   %eax,%eax
+  80258b:	78 40                	js     8025cd <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80258d:	4c 89 ff             	mov    %r15,%rdi
+  802590:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  802597:	00 00 00 
+  80259a:	ff d0                	call   *%rax
+  80259c:	48 89 c2             	mov    %rax,%rdx
+  80259f:	48 c1 e2 04          	shl    $0x4,%rdx
+  8025a3:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8025a7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8025ab:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8025b0:	48 01 d0             	add    %rdx,%rax
+  8025b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8025b7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8025bc:	0f 84 33 01 00 00    	je     8026f5 <devfile_read+0x2d8>
+    size_t i = 0;
+  8025c2:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8025c8:	e9 f5 00 00 00       	jmp    8026c2 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8025cd:	48 98                	cltq
+  8025cf:	eb 84                	jmp    802555 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8025d1:	44 89 e8             	mov    %r13d,%eax
+  8025d4:	66 b8 00 00          	mov    $0x0,%ax
+  8025d8:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8025dd:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8025e4:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8025e6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8025ea:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8025ee:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8025f0:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8025f5:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8025f8:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8025ff:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  802600:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802606:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80260b:	ba 00 10 01 00       	mov    $0x11000,%edx
+  802610:	bf 03 00 00 00       	mov    $0x3,%edi
+  802615:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  80261c:	00 00 00 
+  80261f:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  802621:	85 c0                	test   %eax,%eax
+  802623:	0f 88 be 00 00 00    	js     8026e7 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  802629:	48 63 d0             	movslq %eax,%rdx
+  80262c:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  802631:	41 03 44 24 08       	add    0x8(%r12),%eax
+  802636:	44 39 e8             	cmp    %r13d,%eax
+  802639:	0f 8e ba 00 00 00    	jle    8026f9 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80263f:	49 63 c5             	movslq %r13d,%rax
+  802642:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802647:	48 29 c3             	sub    %rax,%rbx
+  80264a:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80264f:	48 01 c3             	add    %rax,%rbx
+  802652:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802656:	4c 29 f0             	sub    %r14,%rax
+  802659:	48 39 c3             	cmp    %rax,%rbx
+  80265c:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802660:	4c 89 ff             	mov    %r15,%rdi
+  802663:	48 b9 93 13 80 00 00 	movabs $0x801393,%rcx
+  80266a:	00 00 00 
+  80266d:	ff d1                	call   *%rcx
+  80266f:	48 89 c2             	mov    %rax,%rdx
+  802672:	48 c1 e2 04          	shl    $0x4,%rdx
+  802676:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80267a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80267e:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  802683:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  802686:	44 89 ea             	mov    %r13d,%edx
+  802689:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  80268e:	48 63 d2             	movslq %edx,%rdx
+  802691:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802698:	00 
+  802699:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80269d:	4c 01 f7             	add    %r14,%rdi
+  8026a0:	48 89 da             	mov    %rbx,%rdx
+  8026a3:	48 b9 12 06 80 00 00 	movabs $0x800612,%rcx
+  8026aa:	00 00 00 
+  8026ad:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8026af:	41 01 dd             	add    %ebx,%r13d
+  8026b2:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8026b6:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8026b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026bd:	49 39 c6             	cmp    %rax,%r14
+  8026c0:	73 37                	jae    8026f9 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8026c2:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8026c6:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8026cb:	44 39 e8             	cmp    %r13d,%eax
+  8026ce:	0f 8f fd fe ff ff    	jg     8025d1 <devfile_read+0x1b4>
+  8026d4:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8026d9:	44 39 e8             	cmp    %r13d,%eax
+  8026dc:	0f 8f 5d ff ff ff    	jg     80263f <devfile_read+0x222>
+  8026e2:	e9 ea fe ff ff       	jmp    8025d1 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8026e7:	48 98                	cltq
+  8026e9:	4d 85 f6             	test   %r14,%r14
+  8026ec:	49 0f 45 c6          	cmovne %r14,%rax
+  8026f0:	e9 60 fe ff ff       	jmp    802555 <devfile_read+0x138>
+    size_t i = 0;
+  8026f5:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8026f9:	4c 89 f0             	mov    %r14,%rax
+  8026fc:	e9 54 fe ff ff       	jmp    802555 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  802701:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802708:	e9 48 fe ff ff       	jmp    802555 <devfile_read+0x138>
+
+000000000080270d <open>:
+open(const char *path, int mode) {
+  80270d:	55                   	push   %rbp
+  80270e:	48 89 e5             	mov    %rsp,%rbp
+  802711:	41 55                	push   %r13
+  802713:	41 54                	push   %r12
+  802715:	53                   	push   %rbx
+  802716:	48 83 ec 18          	sub    $0x18,%rsp
+  80271a:	49 89 fc             	mov    %rdi,%r12
+  80271d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802720:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  802727:	00 00 00 
+  80272a:	ff d0                	call   *%rax
+  80272c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802732:	0f 87 8a 00 00 00    	ja     8027c2 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802738:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80273c:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  802743:	00 00 00 
+  802746:	ff d0                	call   *%rax
+  802748:	89 c3                	mov    %eax,%ebx
+  80274a:	85 c0                	test   %eax,%eax
+  80274c:	78 50                	js     80279e <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80274e:	4c 89 e6             	mov    %r12,%rsi
+  802751:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802758:	00 00 00 
+  80275b:	48 89 df             	mov    %rbx,%rdi
+  80275e:	48 b8 1d 02 80 00 00 	movabs $0x80021d,%rax
+  802765:	00 00 00 
+  802768:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80276a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802771:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802775:	bf 01 00 00 00       	mov    $0x1,%edi
+  80277a:	48 b8 93 1f 80 00 00 	movabs $0x801f93,%rax
+  802781:	00 00 00 
+  802784:	ff d0                	call   *%rax
+  802786:	89 c3                	mov    %eax,%ebx
+  802788:	85 c0                	test   %eax,%eax
+  80278a:	78 1f                	js     8027ab <open+0x9e>
+    return fd2num(fd);
+  80278c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802790:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  802797:	00 00 00 
+  80279a:	ff d0                	call   *%rax
+  80279c:	89 c3                	mov    %eax,%ebx
+}
+  80279e:	89 d8                	mov    %ebx,%eax
+  8027a0:	48 83 c4 18          	add    $0x18,%rsp
+  8027a4:	5b                   	pop    %rbx
+  8027a5:	41 5c                	pop    %r12
+  8027a7:	41 5d                	pop    %r13
+  8027a9:	5d                   	pop    %rbp
+  8027aa:	c3                   	ret
+        fd_close(fd, 0);
+  8027ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027b4:	48 b8 dc 14 80 00 00 	movabs $0x8014dc,%rax
+  8027bb:	00 00 00 
+  8027be:	ff d0                	call   *%rax
+        return res;
+  8027c0:	eb dc                	jmp    80279e <open+0x91>
+        return -E_BAD_PATH;
+  8027c2:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8027c7:	eb d5                	jmp    80279e <open+0x91>
+
+00000000008027c9 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8027c9:	55                   	push   %rbp
+  8027ca:	48 89 e5             	mov    %rsp,%rbp
+  8027cd:	41 57                	push   %r15
+  8027cf:	41 56                	push   %r14
+  8027d1:	41 55                	push   %r13
+  8027d3:	41 54                	push   %r12
+  8027d5:	53                   	push   %rbx
+  8027d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8027da:	41 89 f6             	mov    %esi,%r14d
+  8027dd:	49 89 d7             	mov    %rdx,%r15
+  8027e0:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8027e3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8027e7:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  8027ee:	00 00 00 
+  8027f1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8027f3:	85 c0                	test   %eax,%eax
+  8027f5:	0f 88 db 00 00 00    	js     8028d6 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8027fb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8027ff:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802806:	00 00 00 
+  802809:	8b 00                	mov    (%rax),%eax
+  80280b:	39 07                	cmp    %eax,(%rdi)
+  80280d:	0f 85 db 00 00 00    	jne    8028ee <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802813:	45 85 f6             	test   %r14d,%r14d
+  802816:	0f 88 db 00 00 00    	js     8028f7 <fmap+0x12e>
+  80281c:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802823:	0f 85 d7 00 00 00    	jne    802900 <fmap+0x137>
+  802829:	4c 89 fb             	mov    %r15,%rbx
+  80282c:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802832:	0f 85 d1 00 00 00    	jne    802909 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802838:	48 b8 59 1f 80 00 00 	movabs $0x801f59,%rax
+  80283f:	00 00 00 
+  802842:	ff d0                	call   *%rax
+  802844:	85 c0                	test   %eax,%eax
+  802846:	0f 88 8e 00 00 00    	js     8028da <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80284c:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  802853:	00 00 00 
+    while (i < n) {
+  802856:	4d 85 ed             	test   %r13,%r13
+  802859:	0f 84 8a 00 00 00    	je     8028e9 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80285f:	4c 89 ea             	mov    %r13,%rdx
+  802862:	48 29 da             	sub    %rbx,%rdx
+  802865:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80286c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802872:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802876:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80287a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80287d:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  802881:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  802885:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  80288a:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80288f:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  802893:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  802897:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80289c:	4c 89 e6             	mov    %r12,%rsi
+  80289f:	bf 09 00 00 00       	mov    $0x9,%edi
+  8028a4:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  8028ab:	00 00 00 
+  8028ae:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	78 2a                	js     8028de <fmap+0x115>
+        i += res;
+  8028b4:	48 98                	cltq
+  8028b6:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8028b9:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8028bd:	72 05                	jb     8028c4 <fmap+0xfb>
+    while (i < n) {
+  8028bf:	4c 39 eb             	cmp    %r13,%rbx
+  8028c2:	72 9b                	jb     80285f <fmap+0x96>
+    }
+    return i;
+  8028c4:	48 89 d8             	mov    %rbx,%rax
+}
+  8028c7:	48 83 c4 18          	add    $0x18,%rsp
+  8028cb:	5b                   	pop    %rbx
+  8028cc:	41 5c                	pop    %r12
+  8028ce:	41 5d                	pop    %r13
+  8028d0:	41 5e                	pop    %r14
+  8028d2:	41 5f                	pop    %r15
+  8028d4:	5d                   	pop    %rbp
+  8028d5:	c3                   	ret
+    if (res < 0) return res;
+  8028d6:	48 98                	cltq
+  8028d8:	eb ed                	jmp    8028c7 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8028da:	48 98                	cltq
+  8028dc:	eb e9                	jmp    8028c7 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8028de:	48 98                	cltq
+  8028e0:	48 85 db             	test   %rbx,%rbx
+  8028e3:	48 0f 45 c3          	cmovne %rbx,%rax
+  8028e7:	eb de                	jmp    8028c7 <fmap+0xfe>
+    size_t i = 0;
+  8028e9:	4c 89 eb             	mov    %r13,%rbx
+  8028ec:	eb d6                	jmp    8028c4 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8028ee:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8028f5:	eb d0                	jmp    8028c7 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8028f7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8028fe:	eb c7                	jmp    8028c7 <fmap+0xfe>
+  802900:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802907:	eb be                	jmp    8028c7 <fmap+0xfe>
+  802909:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802910:	eb b5                	jmp    8028c7 <fmap+0xfe>
+
+0000000000802912 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  802912:	55                   	push   %rbp
+  802913:	48 89 e5             	mov    %rsp,%rbp
+  802916:	41 56                	push   %r14
+  802918:	41 55                	push   %r13
+  80291a:	41 54                	push   %r12
+  80291c:	53                   	push   %rbx
+  80291d:	48 83 ec 10          	sub    $0x10,%rsp
+  802921:	89 fb                	mov    %edi,%ebx
+  802923:	41 89 f4             	mov    %esi,%r12d
+  802926:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802929:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80292d:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  802934:	00 00 00 
+  802937:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802939:	85 c0                	test   %eax,%eax
+  80293b:	78 63                	js     8029a0 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80293d:	45 85 e4             	test   %r12d,%r12d
+  802940:	0f 88 80 00 00 00    	js     8029c6 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  802946:	45 89 e6             	mov    %r12d,%r14d
+  802949:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  802950:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802954:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  80295b:	00 00 00 
+  80295e:	ff d0                	call   *%rax
+  802960:	48 89 c2             	mov    %rax,%rdx
+  802963:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802968:	44 89 f6             	mov    %r14d,%esi
+  80296b:	89 df                	mov    %ebx,%edi
+  80296d:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  802974:	00 00 00 
+  802977:	ff d0                	call   *%rax
+  802979:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80297c:	45 29 f4             	sub    %r14d,%r12d
+  80297f:	4d 63 f4             	movslq %r12d,%r14
+  802982:	49 39 c6             	cmp    %rax,%r14
+  802985:	7c 1d                	jl     8029a4 <read_map+0x92>
+  802987:	48 85 c0             	test   %rax,%rax
+  80298a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298f:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  802993:	48 83 c4 10          	add    $0x10,%rsp
+  802997:	5b                   	pop    %rbx
+  802998:	41 5c                	pop    %r12
+  80299a:	41 5d                	pop    %r13
+  80299c:	41 5e                	pop    %r14
+  80299e:	5d                   	pop    %rbp
+  80299f:	c3                   	ret
+    if (res < 0) return res;
+  8029a0:	48 98                	cltq
+  8029a2:	eb ef                	jmp    802993 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8029a4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8029a8:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  8029af:	00 00 00 
+  8029b2:	ff d0                	call   *%rax
+  8029b4:	4d 63 e4             	movslq %r12d,%r12
+  8029b7:	4c 01 e0             	add    %r12,%rax
+  8029ba:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8029be:	48 89 d8             	mov    %rbx,%rax
+  8029c1:	4c 29 f0             	sub    %r14,%rax
+  8029c4:	eb cd                	jmp    802993 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8029c6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8029cd:	eb c4                	jmp    802993 <read_map+0x81>
+
+00000000008029cf <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8029cf:	55                   	push   %rbp
+  8029d0:	48 89 e5             	mov    %rsp,%rbp
+  8029d3:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8029d7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029db:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  8029e2:	00 00 00 
+  8029e5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029e7:	85 c0                	test   %eax,%eax
+  8029e9:	78 4a                	js     802a35 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8029eb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029ef:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8029f6:	00 00 00 
+  8029f9:	8b 00                	mov    (%rax),%eax
+  8029fb:	39 07                	cmp    %eax,(%rdi)
+  8029fd:	75 38                	jne    802a37 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8029ff:	48 b8 59 1f 80 00 00 	movabs $0x801f59,%rax
+  802a06:	00 00 00 
+  802a09:	ff d0                	call   *%rax
+  802a0b:	85 c0                	test   %eax,%eax
+  802a0d:	78 26                	js     802a35 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802a0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a13:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a16:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802a1d:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802a1f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a24:	bf 06 00 00 00       	mov    $0x6,%edi
+  802a29:	48 b8 93 1f 80 00 00 	movabs $0x801f93,%rax
+  802a30:	00 00 00 
+  802a33:	ff d0                	call   *%rax
+}
+  802a35:	c9                   	leave
+  802a36:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802a37:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802a3c:	eb f7                	jmp    802a35 <fsync+0x66>
+
+0000000000802a3e <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  802a3e:	55                   	push   %rbp
+  802a3f:	48 89 e5             	mov    %rsp,%rbp
+  802a42:	41 57                	push   %r15
+  802a44:	41 56                	push   %r14
+  802a46:	41 55                	push   %r13
+  802a48:	41 54                	push   %r12
+  802a4a:	53                   	push   %rbx
+  802a4b:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  802a4f:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  802a56:	00 00 00 
+  802a59:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  802a5e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802a64:	49 bd 21 14 80 00 00 	movabs $0x801421,%r13
+  802a6b:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  802a6e:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  802a75:	00 00 00 
+  802a78:	eb 0c                	jmp    802a86 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  802a7a:	83 c3 01             	add    $0x1,%ebx
+  802a7d:	49 83 c4 28          	add    $0x28,%r12
+  802a81:	83 fb 20             	cmp    $0x20,%ebx
+  802a84:	74 33                	je     802ab9 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802a86:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  802a8b:	74 ed                	je     802a7a <flushall+0x3c>
+  802a8d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802a91:	89 df                	mov    %ebx,%edi
+  802a93:	41 ff d5             	call   *%r13
+  802a96:	85 c0                	test   %eax,%eax
+  802a98:	78 e0                	js     802a7a <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  802a9a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802a9e:	41 8b 06             	mov    (%r14),%eax
+  802aa1:	39 07                	cmp    %eax,(%rdi)
+  802aa3:	75 d5                	jne    802a7a <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  802aa5:	48 b8 59 1f 80 00 00 	movabs $0x801f59,%rax
+  802aac:	00 00 00 
+  802aaf:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  802ab1:	85 c0                	test   %eax,%eax
+  802ab3:	44 0f 48 f8          	cmovs  %eax,%r15d
+  802ab7:	eb c1                	jmp    802a7a <flushall+0x3c>
+    }
+    return res;
+}
+  802ab9:	44 89 f8             	mov    %r15d,%eax
+  802abc:	48 83 c4 18          	add    $0x18,%rsp
+  802ac0:	5b                   	pop    %rbx
+  802ac1:	41 5c                	pop    %r12
+  802ac3:	41 5d                	pop    %r13
+  802ac5:	41 5e                	pop    %r14
+  802ac7:	41 5f                	pop    %r15
+  802ac9:	5d                   	pop    %rbp
+  802aca:	c3                   	ret
+
+0000000000802acb <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  802acb:	55                   	push   %rbp
+  802acc:	48 89 e5             	mov    %rsp,%rbp
+  802acf:	53                   	push   %rbx
+  802ad0:	48 83 ec 08          	sub    $0x8,%rsp
+  802ad4:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  802ad7:	40 0f b6 c6          	movzbl %sil,%eax
+  802adb:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802ae2:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  802ae4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802aee:	48 b8 93 1f 80 00 00 	movabs $0x801f93,%rax
+  802af5:	00 00 00 
+  802af8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802afa:	85 c0                	test   %eax,%eax
+  802afc:	78 23                	js     802b21 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  802afe:	ba 58 06 00 00       	mov    $0x658,%edx
+  802b03:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802b0a:	00 00 00 
+  802b0d:	48 89 df             	mov    %rbx,%rdi
+  802b10:	48 b8 12 06 80 00 00 	movabs $0x800612,%rax
+  802b17:	00 00 00 
+  802b1a:	ff d0                	call   *%rax
+    return 0;
+  802b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b25:	c9                   	leave
+  802b26:	c3                   	ret
+
+0000000000802b27 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  802b27:	55                   	push   %rbp
+  802b28:	48 89 e5             	mov    %rsp,%rbp
+  802b2b:	53                   	push   %rbx
+  802b2c:	48 83 ec 08          	sub    $0x8,%rsp
+  802b30:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  802b33:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  802b3a:	00 00 00 
+  802b3d:	ff d0                	call   *%rax
+  802b3f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802b45:	77 35                	ja     802b7c <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  802b47:	48 89 de             	mov    %rbx,%rsi
+  802b4a:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  802b51:	00 00 00 
+  802b54:	48 b8 1d 02 80 00 00 	movabs $0x80021d,%rax
+  802b5b:	00 00 00 
+  802b5e:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  802b60:	be 00 00 00 00       	mov    $0x0,%esi
+  802b65:	bf 07 00 00 00       	mov    $0x7,%edi
+  802b6a:	48 b8 93 1f 80 00 00 	movabs $0x801f93,%rax
+  802b71:	00 00 00 
+  802b74:	ff d0                	call   *%rax
+}
+  802b76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7a:	c9                   	leave
+  802b7b:	c3                   	ret
+        return -E_BAD_PATH;
+  802b7c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802b81:	eb f3                	jmp    802b76 <remove+0x4f>
+
+0000000000802b83 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802b83:	55                   	push   %rbp
+  802b84:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  802b87:	48 b8 3e 2a 80 00 00 	movabs $0x802a3e,%rax
+  802b8e:	00 00 00 
+  802b91:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802b93:	be 00 00 00 00       	mov    $0x0,%esi
+  802b98:	bf 08 00 00 00       	mov    $0x8,%edi
+  802b9d:	48 b8 93 1f 80 00 00 	movabs $0x801f93,%rax
+  802ba4:	00 00 00 
+  802ba7:	ff d0                	call   *%rax
+}
+  802ba9:	5d                   	pop    %rbp
+  802baa:	c3                   	ret
+
+0000000000802bab <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802bab:	55                   	push   %rbp
+  802bac:	48 89 e5             	mov    %rsp,%rbp
+  802baf:	41 54                	push   %r12
+  802bb1:	53                   	push   %rbx
+  802bb2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802bb5:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  802bbc:	00 00 00 
+  802bbf:	ff d0                	call   *%rax
+  802bc1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802bc4:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  802bcb:	00 00 00 
+  802bce:	48 89 df             	mov    %rbx,%rdi
+  802bd1:	48 b8 1d 02 80 00 00 	movabs $0x80021d,%rax
+  802bd8:	00 00 00 
+  802bdb:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802bdd:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802be2:	41 2b 04 24          	sub    (%r12),%eax
+  802be6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802bec:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802bf3:	00 00 00 
+    stat->st_dev = &devpipe;
+  802bf6:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802bfd:	00 00 00 
+  802c00:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802c07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0c:	5b                   	pop    %rbx
+  802c0d:	41 5c                	pop    %r12
+  802c0f:	5d                   	pop    %rbp
+  802c10:	c3                   	ret
+
+0000000000802c11 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802c11:	55                   	push   %rbp
+  802c12:	48 89 e5             	mov    %rsp,%rbp
+  802c15:	41 54                	push   %r12
+  802c17:	53                   	push   %rbx
+  802c18:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802c1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c20:	48 89 fe             	mov    %rdi,%rsi
+  802c23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c28:	49 bc 5c 0b 80 00 00 	movabs $0x800b5c,%r12
+  802c2f:	00 00 00 
+  802c32:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802c35:	48 89 df             	mov    %rbx,%rdi
+  802c38:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  802c3f:	00 00 00 
+  802c42:	ff d0                	call   *%rax
+  802c44:	48 89 c6             	mov    %rax,%rsi
+  802c47:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c51:	41 ff d4             	call   *%r12
+}
+  802c54:	5b                   	pop    %rbx
+  802c55:	41 5c                	pop    %r12
+  802c57:	5d                   	pop    %rbp
+  802c58:	c3                   	ret
+
+0000000000802c59 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c59:	55                   	push   %rbp
+  802c5a:	48 89 e5             	mov    %rsp,%rbp
+  802c5d:	41 57                	push   %r15
+  802c5f:	41 56                	push   %r14
+  802c61:	41 55                	push   %r13
+  802c63:	41 54                	push   %r12
+  802c65:	53                   	push   %rbx
+  802c66:	48 83 ec 18          	sub    $0x18,%rsp
+  802c6a:	49 89 fc             	mov    %rdi,%r12
+  802c6d:	49 89 f5             	mov    %rsi,%r13
+  802c70:	49 89 d7             	mov    %rdx,%r15
+  802c73:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c77:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  802c7e:	00 00 00 
+  802c81:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802c83:	4d 85 ff             	test   %r15,%r15
+  802c86:	0f 84 af 00 00 00    	je     802d3b <devpipe_write+0xe2>
+  802c8c:	48 89 c3             	mov    %rax,%rbx
+  802c8f:	4c 89 f8             	mov    %r15,%rax
+  802c92:	4d 89 ef             	mov    %r13,%r15
+  802c95:	4c 01 e8             	add    %r13,%rax
+  802c98:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c9c:	49 bd 51 09 80 00 00 	movabs $0x800951,%r13
+  802ca3:	00 00 00 
+            sys_yield();
+  802ca6:	49 be ee 08 80 00 00 	movabs $0x8008ee,%r14
+  802cad:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802cb0:	8b 73 04             	mov    0x4(%rbx),%esi
+  802cb3:	48 63 ce             	movslq %esi,%rcx
+  802cb6:	48 63 03             	movslq (%rbx),%rax
+  802cb9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802cbf:	48 39 c1             	cmp    %rax,%rcx
+  802cc2:	72 2e                	jb     802cf2 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802cc4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cc9:	48 89 da             	mov    %rbx,%rdx
+  802ccc:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cd1:	4c 89 e7             	mov    %r12,%rdi
+  802cd4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802cd7:	85 c0                	test   %eax,%eax
+  802cd9:	74 66                	je     802d41 <devpipe_write+0xe8>
+            sys_yield();
+  802cdb:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802cde:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ce1:	48 63 ce             	movslq %esi,%rcx
+  802ce4:	48 63 03             	movslq (%rbx),%rax
+  802ce7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ced:	48 39 c1             	cmp    %rax,%rcx
+  802cf0:	73 d2                	jae    802cc4 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802cf2:	41 0f b6 3f          	movzbl (%r15),%edi
+  802cf6:	48 89 ca             	mov    %rcx,%rdx
+  802cf9:	48 c1 ea 03          	shr    $0x3,%rdx
+  802cfd:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802d04:	08 10 20 
+  802d07:	48 f7 e2             	mul    %rdx
+  802d0a:	48 c1 ea 06          	shr    $0x6,%rdx
+  802d0e:	48 89 d0             	mov    %rdx,%rax
+  802d11:	48 c1 e0 09          	shl    $0x9,%rax
+  802d15:	48 29 d0             	sub    %rdx,%rax
+  802d18:	48 c1 e0 03          	shl    $0x3,%rax
+  802d1c:	48 29 c1             	sub    %rax,%rcx
+  802d1f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802d24:	83 c6 01             	add    $0x1,%esi
+  802d27:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d2a:	49 83 c7 01          	add    $0x1,%r15
+  802d2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d32:	49 39 c7             	cmp    %rax,%r15
+  802d35:	0f 85 75 ff ff ff    	jne    802cb0 <devpipe_write+0x57>
+    return n;
+  802d3b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d3f:	eb 05                	jmp    802d46 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802d41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d46:	48 83 c4 18          	add    $0x18,%rsp
+  802d4a:	5b                   	pop    %rbx
+  802d4b:	41 5c                	pop    %r12
+  802d4d:	41 5d                	pop    %r13
+  802d4f:	41 5e                	pop    %r14
+  802d51:	41 5f                	pop    %r15
+  802d53:	5d                   	pop    %rbp
+  802d54:	c3                   	ret
+
+0000000000802d55 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d55:	55                   	push   %rbp
+  802d56:	48 89 e5             	mov    %rsp,%rbp
+  802d59:	41 57                	push   %r15
+  802d5b:	41 56                	push   %r14
+  802d5d:	41 55                	push   %r13
+  802d5f:	41 54                	push   %r12
+  802d61:	53                   	push   %rbx
+  802d62:	48 83 ec 18          	sub    $0x18,%rsp
+  802d66:	49 89 fc             	mov    %rdi,%r12
+  802d69:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802d6d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d71:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  802d78:	00 00 00 
+  802d7b:	ff d0                	call   *%rax
+  802d7d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802d80:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d86:	49 bd 51 09 80 00 00 	movabs $0x800951,%r13
+  802d8d:	00 00 00 
+            sys_yield();
+  802d90:	49 be ee 08 80 00 00 	movabs $0x8008ee,%r14
+  802d97:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802d9a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802d9f:	74 7d                	je     802e1e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802da1:	8b 03                	mov    (%rbx),%eax
+  802da3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802da6:	75 26                	jne    802dce <devpipe_read+0x79>
+            if (i > 0) return i;
+  802da8:	4d 85 ff             	test   %r15,%r15
+  802dab:	75 77                	jne    802e24 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802dad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802db2:	48 89 da             	mov    %rbx,%rdx
+  802db5:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dba:	4c 89 e7             	mov    %r12,%rdi
+  802dbd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802dc0:	85 c0                	test   %eax,%eax
+  802dc2:	74 72                	je     802e36 <devpipe_read+0xe1>
+            sys_yield();
+  802dc4:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802dc7:	8b 03                	mov    (%rbx),%eax
+  802dc9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802dcc:	74 df                	je     802dad <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802dce:	48 63 c8             	movslq %eax,%rcx
+  802dd1:	48 89 ca             	mov    %rcx,%rdx
+  802dd4:	48 c1 ea 03          	shr    $0x3,%rdx
+  802dd8:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802ddf:	08 10 20 
+  802de2:	48 89 d0             	mov    %rdx,%rax
+  802de5:	48 f7 e6             	mul    %rsi
+  802de8:	48 c1 ea 06          	shr    $0x6,%rdx
+  802dec:	48 89 d0             	mov    %rdx,%rax
+  802def:	48 c1 e0 09          	shl    $0x9,%rax
+  802df3:	48 29 d0             	sub    %rdx,%rax
+  802df6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802dfd:	00 
+  802dfe:	48 89 c8             	mov    %rcx,%rax
+  802e01:	48 29 d0             	sub    %rdx,%rax
+  802e04:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802e09:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802e0d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802e11:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802e14:	49 83 c7 01          	add    $0x1,%r15
+  802e18:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802e1c:	75 83                	jne    802da1 <devpipe_read+0x4c>
+    return n;
+  802e1e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e22:	eb 03                	jmp    802e27 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802e24:	4c 89 f8             	mov    %r15,%rax
+}
+  802e27:	48 83 c4 18          	add    $0x18,%rsp
+  802e2b:	5b                   	pop    %rbx
+  802e2c:	41 5c                	pop    %r12
+  802e2e:	41 5d                	pop    %r13
+  802e30:	41 5e                	pop    %r14
+  802e32:	41 5f                	pop    %r15
+  802e34:	5d                   	pop    %rbp
+  802e35:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802e36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3b:	eb ea                	jmp    802e27 <devpipe_read+0xd2>
+
+0000000000802e3d <pipe>:
+pipe(int pfd[2]) {
+  802e3d:	55                   	push   %rbp
+  802e3e:	48 89 e5             	mov    %rsp,%rbp
+  802e41:	41 55                	push   %r13
+  802e43:	41 54                	push   %r12
+  802e45:	53                   	push   %rbx
+  802e46:	48 83 ec 18          	sub    $0x18,%rsp
+  802e4a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e4d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e51:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  802e58:	00 00 00 
+  802e5b:	ff d0                	call   *%rax
+  802e5d:	89 c3                	mov    %eax,%ebx
+  802e5f:	85 c0                	test   %eax,%eax
+  802e61:	0f 88 a0 01 00 00    	js     803007 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802e67:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e6c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e71:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e75:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e7a:	48 b8 7d 09 80 00 00 	movabs $0x80097d,%rax
+  802e81:	00 00 00 
+  802e84:	ff d0                	call   *%rax
+  802e86:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e88:	85 c0                	test   %eax,%eax
+  802e8a:	0f 88 77 01 00 00    	js     803007 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802e90:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802e94:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  802e9b:	00 00 00 
+  802e9e:	ff d0                	call   *%rax
+  802ea0:	89 c3                	mov    %eax,%ebx
+  802ea2:	85 c0                	test   %eax,%eax
+  802ea4:	0f 88 43 01 00 00    	js     802fed <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802eaa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802eaf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802eb4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802eb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ebd:	48 b8 7d 09 80 00 00 	movabs $0x80097d,%rax
+  802ec4:	00 00 00 
+  802ec7:	ff d0                	call   *%rax
+  802ec9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802ecb:	85 c0                	test   %eax,%eax
+  802ecd:	0f 88 1a 01 00 00    	js     802fed <pipe+0x1b0>
+    va = fd2data(fd0);
+  802ed3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ed7:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  802ede:	00 00 00 
+  802ee1:	ff d0                	call   *%rax
+  802ee3:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802ee6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802eeb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ef0:	48 89 c6             	mov    %rax,%rsi
+  802ef3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef8:	48 b8 7d 09 80 00 00 	movabs $0x80097d,%rax
+  802eff:	00 00 00 
+  802f02:	ff d0                	call   *%rax
+  802f04:	89 c3                	mov    %eax,%ebx
+  802f06:	85 c0                	test   %eax,%eax
+  802f08:	0f 88 c5 00 00 00    	js     802fd3 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802f0e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f12:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  802f19:	00 00 00 
+  802f1c:	ff d0                	call   *%rax
+  802f1e:	48 89 c1             	mov    %rax,%rcx
+  802f21:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802f27:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802f2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f32:	4c 89 ee             	mov    %r13,%rsi
+  802f35:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f3a:	48 b8 e4 09 80 00 00 	movabs $0x8009e4,%rax
+  802f41:	00 00 00 
+  802f44:	ff d0                	call   *%rax
+  802f46:	89 c3                	mov    %eax,%ebx
+  802f48:	85 c0                	test   %eax,%eax
+  802f4a:	78 6e                	js     802fba <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f4c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f51:	4c 89 ef             	mov    %r13,%rdi
+  802f54:	48 b8 1f 09 80 00 00 	movabs $0x80091f,%rax
+  802f5b:	00 00 00 
+  802f5e:	ff d0                	call   *%rax
+  802f60:	83 f8 02             	cmp    $0x2,%eax
+  802f63:	0f 85 ab 00 00 00    	jne    803014 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802f69:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  802f70:	00 00 
+  802f72:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f76:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802f78:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f7c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802f83:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f87:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802f89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f8d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802f94:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f98:	48 bb 93 13 80 00 00 	movabs $0x801393,%rbx
+  802f9f:	00 00 00 
+  802fa2:	ff d3                	call   *%rbx
+  802fa4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802fa8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802fac:	ff d3                	call   *%rbx
+  802fae:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802fb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fb8:	eb 4d                	jmp    803007 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802fba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fbf:	4c 89 ee             	mov    %r13,%rsi
+  802fc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc7:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  802fce:	00 00 00 
+  802fd1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802fd3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fd8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802fdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fe1:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  802fe8:	00 00 00 
+  802feb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802fed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ff2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ff6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ffb:	48 b8 5c 0b 80 00 00 	movabs $0x800b5c,%rax
+  803002:	00 00 00 
+  803005:	ff d0                	call   *%rax
+}
+  803007:	89 d8                	mov    %ebx,%eax
+  803009:	48 83 c4 18          	add    $0x18,%rsp
+  80300d:	5b                   	pop    %rbx
+  80300e:	41 5c                	pop    %r12
+  803010:	41 5d                	pop    %r13
+  803012:	5d                   	pop    %rbp
+  803013:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803014:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  80301b:	00 00 00 
+  80301e:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  803025:	00 00 00 
+  803028:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80302d:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  803034:	00 00 00 
+  803037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303c:	49 b8 1c 36 80 00 00 	movabs $0x80361c,%r8
+  803043:	00 00 00 
+  803046:	41 ff d0             	call   *%r8
+
+0000000000803049 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803049:	55                   	push   %rbp
+  80304a:	48 89 e5             	mov    %rsp,%rbp
+  80304d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803051:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803055:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  80305c:	00 00 00 
+  80305f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803061:	85 c0                	test   %eax,%eax
+  803063:	78 35                	js     80309a <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803065:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803069:	48 b8 a5 13 80 00 00 	movabs $0x8013a5,%rax
+  803070:	00 00 00 
+  803073:	ff d0                	call   *%rax
+  803075:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803078:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80307d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803082:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803086:	48 b8 51 09 80 00 00 	movabs $0x800951,%rax
+  80308d:	00 00 00 
+  803090:	ff d0                	call   *%rax
+  803092:	85 c0                	test   %eax,%eax
+  803094:	0f 94 c0             	sete   %al
+  803097:	0f b6 c0             	movzbl %al,%eax
+}
+  80309a:	c9                   	leave
+  80309b:	c3                   	ret
+
+000000000080309c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80309c:	48 89 f8             	mov    %rdi,%rax
+  80309f:	48 c1 e8 27          	shr    $0x27,%rax
+  8030a3:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8030aa:	7f 00 00 
+  8030ad:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030b1:	f6 c2 01             	test   $0x1,%dl
+  8030b4:	74 6d                	je     803123 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8030b6:	48 89 f8             	mov    %rdi,%rax
+  8030b9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8030bd:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8030c4:	7f 00 00 
+  8030c7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030cb:	f6 c2 01             	test   $0x1,%dl
+  8030ce:	74 62                	je     803132 <get_uvpt_entry+0x96>
+  8030d0:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8030d7:	7f 00 00 
+  8030da:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030de:	f6 c2 80             	test   $0x80,%dl
+  8030e1:	75 4f                	jne    803132 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8030e3:	48 89 f8             	mov    %rdi,%rax
+  8030e6:	48 c1 e8 15          	shr    $0x15,%rax
+  8030ea:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8030f1:	7f 00 00 
+  8030f4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030f8:	f6 c2 01             	test   $0x1,%dl
+  8030fb:	74 44                	je     803141 <get_uvpt_entry+0xa5>
+  8030fd:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803104:	7f 00 00 
+  803107:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80310b:	f6 c2 80             	test   $0x80,%dl
+  80310e:	75 31                	jne    803141 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803110:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803114:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80311b:	7f 00 00 
+  80311e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803122:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803123:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80312a:	7f 00 00 
+  80312d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803131:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803132:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803139:	7f 00 00 
+  80313c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803140:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803141:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803148:	7f 00 00 
+  80314b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80314f:	c3                   	ret
+
+0000000000803150 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803150:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803153:	48 89 f9             	mov    %rdi,%rcx
+  803156:	48 c1 e9 27          	shr    $0x27,%rcx
+  80315a:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803161:	7f 00 00 
+  803164:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803168:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80316f:	f6 c1 01             	test   $0x1,%cl
+  803172:	0f 84 b2 00 00 00    	je     80322a <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803178:	48 89 f9             	mov    %rdi,%rcx
+  80317b:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80317f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803186:	7f 00 00 
+  803189:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80318d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803194:	40 f6 c6 01          	test   $0x1,%sil
+  803198:	0f 84 8c 00 00 00    	je     80322a <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  80319e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8031a5:	7f 00 00 
+  8031a8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8031ac:	a8 80                	test   $0x80,%al
+  8031ae:	75 7b                	jne    80322b <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8031b0:	48 89 f9             	mov    %rdi,%rcx
+  8031b3:	48 c1 e9 15          	shr    $0x15,%rcx
+  8031b7:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8031be:	7f 00 00 
+  8031c1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8031c5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8031cc:	40 f6 c6 01          	test   $0x1,%sil
+  8031d0:	74 58                	je     80322a <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8031d2:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8031d9:	7f 00 00 
+  8031dc:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8031e0:	a8 80                	test   $0x80,%al
+  8031e2:	75 6c                	jne    803250 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8031e4:	48 89 f9             	mov    %rdi,%rcx
+  8031e7:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8031eb:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8031f2:	7f 00 00 
+  8031f5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8031f9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803200:	40 f6 c6 01          	test   $0x1,%sil
+  803204:	74 24                	je     80322a <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803206:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80320d:	7f 00 00 
+  803210:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803214:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80321b:	ff ff 7f 
+  80321e:	48 21 c8             	and    %rcx,%rax
+  803221:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803227:	48 09 d0             	or     %rdx,%rax
+}
+  80322a:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80322b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803232:	7f 00 00 
+  803235:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803239:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803240:	ff ff 7f 
+  803243:	48 21 c8             	and    %rcx,%rax
+  803246:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80324c:	48 01 d0             	add    %rdx,%rax
+  80324f:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803250:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803257:	7f 00 00 
+  80325a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80325e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803265:	ff ff 7f 
+  803268:	48 21 c8             	and    %rcx,%rax
+  80326b:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803271:	48 01 d0             	add    %rdx,%rax
+  803274:	c3                   	ret
+
+0000000000803275 <get_prot>:
+
+int
+get_prot(void *va) {
+  803275:	55                   	push   %rbp
+  803276:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803279:	48 b8 9c 30 80 00 00 	movabs $0x80309c,%rax
+  803280:	00 00 00 
+  803283:	ff d0                	call   *%rax
+  803285:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803288:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80328d:	89 c1                	mov    %eax,%ecx
+  80328f:	83 c9 04             	or     $0x4,%ecx
+  803292:	f6 c2 01             	test   $0x1,%dl
+  803295:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803298:	89 c1                	mov    %eax,%ecx
+  80329a:	83 c9 02             	or     $0x2,%ecx
+  80329d:	f6 c2 02             	test   $0x2,%dl
+  8032a0:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8032a3:	89 c1                	mov    %eax,%ecx
+  8032a5:	83 c9 01             	or     $0x1,%ecx
+  8032a8:	48 85 d2             	test   %rdx,%rdx
+  8032ab:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8032ae:	89 c1                	mov    %eax,%ecx
+  8032b0:	83 c9 40             	or     $0x40,%ecx
+  8032b3:	f6 c6 04             	test   $0x4,%dh
+  8032b6:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8032b9:	5d                   	pop    %rbp
+  8032ba:	c3                   	ret
+
+00000000008032bb <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8032bb:	55                   	push   %rbp
+  8032bc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032bf:	48 b8 9c 30 80 00 00 	movabs $0x80309c,%rax
+  8032c6:	00 00 00 
+  8032c9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8032cb:	48 c1 e8 06          	shr    $0x6,%rax
+  8032cf:	83 e0 01             	and    $0x1,%eax
+}
+  8032d2:	5d                   	pop    %rbp
+  8032d3:	c3                   	ret
+
+00000000008032d4 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8032d4:	55                   	push   %rbp
+  8032d5:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8032d8:	48 b8 9c 30 80 00 00 	movabs $0x80309c,%rax
+  8032df:	00 00 00 
+  8032e2:	ff d0                	call   *%rax
+  8032e4:	83 e0 01             	and    $0x1,%eax
+}
+  8032e7:	5d                   	pop    %rbp
+  8032e8:	c3                   	ret
+
+00000000008032e9 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8032e9:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8032f0:	7f 00 00 
+  8032f3:	a8 01                	test   $0x1,%al
+  8032f5:	75 06                	jne    8032fd <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8032f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032fc:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8032fd:	55                   	push   %rbp
+  8032fe:	48 89 e5             	mov    %rsp,%rbp
+  803301:	41 57                	push   %r15
+  803303:	41 56                	push   %r14
+  803305:	41 55                	push   %r13
+  803307:	41 54                	push   %r12
+  803309:	53                   	push   %rbx
+  80330a:	48 83 ec 18          	sub    $0x18,%rsp
+  80330e:	49 89 fe             	mov    %rdi,%r14
+  803311:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803314:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80331b:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80331c:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803323:	7f 00 00 
+  803326:	e9 81 00 00 00       	jmp    8033ac <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  80332b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803332:	49 39 dd             	cmp    %rbx,%r13
+  803335:	74 2b                	je     803362 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803337:	48 89 d8             	mov    %rbx,%rax
+  80333a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80333e:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803342:	f6 c2 01             	test   $0x1,%dl
+  803345:	74 e4                	je     80332b <foreach_shared_region+0x42>
+  803347:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  80334b:	f6 c4 04             	test   $0x4,%ah
+  80334e:	74 db                	je     80332b <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803350:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803357:	4c 89 fa             	mov    %r15,%rdx
+  80335a:	48 89 df             	mov    %rbx,%rdi
+  80335d:	41 ff d6             	call   *%r14
+  803360:	eb c9                	jmp    80332b <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803362:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803369:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  80336d:	74 22                	je     803391 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  80336f:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803376:	48 89 d8             	mov    %rbx,%rax
+  803379:	48 c1 e8 15          	shr    $0x15,%rax
+  80337d:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803384:	7f 00 00 
+  803387:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80338b:	a8 01                	test   $0x1,%al
+  80338d:	74 d3                	je     803362 <foreach_shared_region+0x79>
+  80338f:	eb a6                	jmp    803337 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803391:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803398:	40 
+  803399:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80339d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8033a4:	00 00 00 
+  8033a7:	48 39 c1             	cmp    %rax,%rcx
+  8033aa:	74 31                	je     8033dd <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  8033ac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033b0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033b4:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8033bb:	7f 00 00 
+  8033be:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8033c2:	a8 01                	test   $0x1,%al
+  8033c4:	74 cb                	je     803391 <foreach_shared_region+0xa8>
+  8033c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033ca:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8033d1:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8033d7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8033db:	eb 92                	jmp    80336f <foreach_shared_region+0x86>
+}
+  8033dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e2:	48 83 c4 18          	add    $0x18,%rsp
+  8033e6:	5b                   	pop    %rbx
+  8033e7:	41 5c                	pop    %r12
+  8033e9:	41 5d                	pop    %r13
+  8033eb:	41 5e                	pop    %r14
+  8033ed:	41 5f                	pop    %r15
+  8033ef:	5d                   	pop    %rbp
+  8033f0:	c3                   	ret
+
+00000000008033f1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8033f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f6:	c3                   	ret
+
+00000000008033f7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8033f7:	55                   	push   %rbp
+  8033f8:	48 89 e5             	mov    %rsp,%rbp
+  8033fb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8033fe:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  803405:	00 00 00 
+  803408:	48 b8 1d 02 80 00 00 	movabs $0x80021d,%rax
+  80340f:	00 00 00 
+  803412:	ff d0                	call   *%rax
+    return 0;
+}
+  803414:	b8 00 00 00 00       	mov    $0x0,%eax
+  803419:	5d                   	pop    %rbp
+  80341a:	c3                   	ret
+
+000000000080341b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80341b:	55                   	push   %rbp
+  80341c:	48 89 e5             	mov    %rsp,%rbp
+  80341f:	41 57                	push   %r15
+  803421:	41 56                	push   %r14
+  803423:	41 55                	push   %r13
+  803425:	41 54                	push   %r12
+  803427:	53                   	push   %rbx
+  803428:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80342f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803436:	48 85 d2             	test   %rdx,%rdx
+  803439:	74 7a                	je     8034b5 <devcons_write+0x9a>
+  80343b:	49 89 d6             	mov    %rdx,%r14
+  80343e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803444:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803449:	49 bf ab 05 80 00 00 	movabs $0x8005ab,%r15
+  803450:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803453:	4c 89 f3             	mov    %r14,%rbx
+  803456:	48 29 f3             	sub    %rsi,%rbx
+  803459:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80345e:	48 39 c3             	cmp    %rax,%rbx
+  803461:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803465:	4c 63 eb             	movslq %ebx,%r13
+  803468:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80346f:	48 01 c6             	add    %rax,%rsi
+  803472:	4c 89 ea             	mov    %r13,%rdx
+  803475:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80347c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80347f:	4c 89 ee             	mov    %r13,%rsi
+  803482:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803489:	48 b8 f4 07 80 00 00 	movabs $0x8007f4,%rax
+  803490:	00 00 00 
+  803493:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803495:	41 01 dc             	add    %ebx,%r12d
+  803498:	49 63 f4             	movslq %r12d,%rsi
+  80349b:	4c 39 f6             	cmp    %r14,%rsi
+  80349e:	72 b3                	jb     803453 <devcons_write+0x38>
+    return res;
+  8034a0:	49 63 c4             	movslq %r12d,%rax
+}
+  8034a3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8034aa:	5b                   	pop    %rbx
+  8034ab:	41 5c                	pop    %r12
+  8034ad:	41 5d                	pop    %r13
+  8034af:	41 5e                	pop    %r14
+  8034b1:	41 5f                	pop    %r15
+  8034b3:	5d                   	pop    %rbp
+  8034b4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8034b5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8034bb:	eb e3                	jmp    8034a0 <devcons_write+0x85>
+
+00000000008034bd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8034bd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8034c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034c5:	48 85 c0             	test   %rax,%rax
+  8034c8:	74 55                	je     80351f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8034ca:	55                   	push   %rbp
+  8034cb:	48 89 e5             	mov    %rsp,%rbp
+  8034ce:	41 55                	push   %r13
+  8034d0:	41 54                	push   %r12
+  8034d2:	53                   	push   %rbx
+  8034d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8034d7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8034da:	48 bb 21 08 80 00 00 	movabs $0x800821,%rbx
+  8034e1:	00 00 00 
+  8034e4:	49 bc ee 08 80 00 00 	movabs $0x8008ee,%r12
+  8034eb:	00 00 00 
+  8034ee:	eb 03                	jmp    8034f3 <devcons_read+0x36>
+  8034f0:	41 ff d4             	call   *%r12
+  8034f3:	ff d3                	call   *%rbx
+  8034f5:	85 c0                	test   %eax,%eax
+  8034f7:	74 f7                	je     8034f0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8034f9:	48 63 d0             	movslq %eax,%rdx
+  8034fc:	78 13                	js     803511 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8034fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803503:	83 f8 04             	cmp    $0x4,%eax
+  803506:	74 09                	je     803511 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803508:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80350c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803511:	48 89 d0             	mov    %rdx,%rax
+  803514:	48 83 c4 08          	add    $0x8,%rsp
+  803518:	5b                   	pop    %rbx
+  803519:	41 5c                	pop    %r12
+  80351b:	41 5d                	pop    %r13
+  80351d:	5d                   	pop    %rbp
+  80351e:	c3                   	ret
+  80351f:	48 89 d0             	mov    %rdx,%rax
+  803522:	c3                   	ret
+
+0000000000803523 <cputchar>:
+cputchar(int ch) {
+  803523:	55                   	push   %rbp
+  803524:	48 89 e5             	mov    %rsp,%rbp
+  803527:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80352b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80352f:	be 01 00 00 00       	mov    $0x1,%esi
+  803534:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803538:	48 b8 f4 07 80 00 00 	movabs $0x8007f4,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+}
+  803544:	c9                   	leave
+  803545:	c3                   	ret
+
+0000000000803546 <getchar>:
+getchar(void) {
+  803546:	55                   	push   %rbp
+  803547:	48 89 e5             	mov    %rsp,%rbp
+  80354a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80354e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803553:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803557:	bf 00 00 00 00       	mov    $0x0,%edi
+  80355c:	48 b8 04 17 80 00 00 	movabs $0x801704,%rax
+  803563:	00 00 00 
+  803566:	ff d0                	call   *%rax
+  803568:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80356a:	85 c0                	test   %eax,%eax
+  80356c:	78 06                	js     803574 <getchar+0x2e>
+  80356e:	74 08                	je     803578 <getchar+0x32>
+  803570:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803574:	89 d0                	mov    %edx,%eax
+  803576:	c9                   	leave
+  803577:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803578:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80357d:	eb f5                	jmp    803574 <getchar+0x2e>
+
+000000000080357f <iscons>:
+iscons(int fdnum) {
+  80357f:	55                   	push   %rbp
+  803580:	48 89 e5             	mov    %rsp,%rbp
+  803583:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803587:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80358b:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  803592:	00 00 00 
+  803595:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803597:	85 c0                	test   %eax,%eax
+  803599:	78 18                	js     8035b3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80359b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80359f:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8035a6:	00 00 00 
+  8035a9:	8b 00                	mov    (%rax),%eax
+  8035ab:	39 02                	cmp    %eax,(%rdx)
+  8035ad:	0f 94 c0             	sete   %al
+  8035b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8035b3:	c9                   	leave
+  8035b4:	c3                   	ret
+
+00000000008035b5 <opencons>:
+opencons(void) {
+  8035b5:	55                   	push   %rbp
+  8035b6:	48 89 e5             	mov    %rsp,%rbp
+  8035b9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8035bd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8035c1:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  8035c8:	00 00 00 
+  8035cb:	ff d0                	call   *%rax
+  8035cd:	85 c0                	test   %eax,%eax
+  8035cf:	78 49                	js     80361a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8035d1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8035d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035db:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8035df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e4:	48 b8 7d 09 80 00 00 	movabs $0x80097d,%rax
+  8035eb:	00 00 00 
+  8035ee:	ff d0                	call   *%rax
+  8035f0:	85 c0                	test   %eax,%eax
+  8035f2:	78 26                	js     80361a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8035f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8035f8:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8035ff:	00 00 
+  803601:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803603:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803607:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80360e:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  803615:	00 00 00 
+  803618:	ff d0                	call   *%rax
+}
+  80361a:	c9                   	leave
+  80361b:	c3                   	ret
+
+000000000080361c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80361c:	55                   	push   %rbp
+  80361d:	48 89 e5             	mov    %rsp,%rbp
+  803620:	41 56                	push   %r14
+  803622:	41 55                	push   %r13
+  803624:	41 54                	push   %r12
+  803626:	53                   	push   %rbx
+  803627:	48 83 ec 50          	sub    $0x50,%rsp
+  80362b:	49 89 fc             	mov    %rdi,%r12
+  80362e:	41 89 f5             	mov    %esi,%r13d
+  803631:	48 89 d3             	mov    %rdx,%rbx
+  803634:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803638:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80363c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803640:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803647:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80364b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80364f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803653:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803657:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80365e:	00 00 00 
+  803661:	4c 8b 30             	mov    (%rax),%r14
+  803664:	48 b8 bd 08 80 00 00 	movabs $0x8008bd,%rax
+  80366b:	00 00 00 
+  80366e:	ff d0                	call   *%rax
+  803670:	89 c6                	mov    %eax,%esi
+  803672:	45 89 e8             	mov    %r13d,%r8d
+  803675:	4c 89 e1             	mov    %r12,%rcx
+  803678:	4c 89 f2             	mov    %r14,%rdx
+  80367b:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  803682:	00 00 00 
+  803685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368a:	49 bc 6c 37 80 00 00 	movabs $0x80376c,%r12
+  803691:	00 00 00 
+  803694:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803697:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80369b:	48 89 df             	mov    %rbx,%rdi
+  80369e:	48 b8 08 37 80 00 00 	movabs $0x803708,%rax
+  8036a5:	00 00 00 
+  8036a8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8036aa:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  8036b1:	00 00 00 
+  8036b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8036bc:	cc                   	int3
+  8036bd:	eb fd                	jmp    8036bc <_panic+0xa0>
+
+00000000008036bf <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8036bf:	55                   	push   %rbp
+  8036c0:	48 89 e5             	mov    %rsp,%rbp
+  8036c3:	53                   	push   %rbx
+  8036c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8036c8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8036cb:	8b 06                	mov    (%rsi),%eax
+  8036cd:	8d 50 01             	lea    0x1(%rax),%edx
+  8036d0:	89 16                	mov    %edx,(%rsi)
+  8036d2:	48 98                	cltq
+  8036d4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8036d9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8036df:	74 0a                	je     8036eb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8036e1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8036e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036e9:	c9                   	leave
+  8036ea:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8036eb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8036ef:	be ff 00 00 00       	mov    $0xff,%esi
+  8036f4:	48 b8 f4 07 80 00 00 	movabs $0x8007f4,%rax
+  8036fb:	00 00 00 
+  8036fe:	ff d0                	call   *%rax
+        state->offset = 0;
+  803700:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803706:	eb d9                	jmp    8036e1 <putch+0x22>
+
+0000000000803708 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803708:	55                   	push   %rbp
+  803709:	48 89 e5             	mov    %rsp,%rbp
+  80370c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803713:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803716:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80371d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803722:	b8 00 00 00 00       	mov    $0x0,%eax
+  803727:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80372a:	48 89 f1             	mov    %rsi,%rcx
+  80372d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803734:	48 bf bf 36 80 00 00 	movabs $0x8036bf,%rdi
+  80373b:	00 00 00 
+  80373e:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  803745:	00 00 00 
+  803748:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80374a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803751:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803758:	48 b8 f4 07 80 00 00 	movabs $0x8007f4,%rax
+  80375f:	00 00 00 
+  803762:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  803764:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80376a:	c9                   	leave
+  80376b:	c3                   	ret
+
+000000000080376c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80376c:	55                   	push   %rbp
+  80376d:	48 89 e5             	mov    %rsp,%rbp
+  803770:	48 83 ec 50          	sub    $0x50,%rsp
+  803774:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803778:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80377c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803780:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803784:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803788:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80378f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803793:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803797:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80379b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80379f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8037a3:	48 b8 08 37 80 00 00 	movabs $0x803708,%rax
+  8037aa:	00 00 00 
+  8037ad:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8037af:	c9                   	leave
+  8037b0:	c3                   	ret
+
+00000000008037b1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8037b1:	55                   	push   %rbp
+  8037b2:	48 89 e5             	mov    %rsp,%rbp
+  8037b5:	41 57                	push   %r15
+  8037b7:	41 56                	push   %r14
+  8037b9:	41 55                	push   %r13
+  8037bb:	41 54                	push   %r12
+  8037bd:	53                   	push   %rbx
+  8037be:	48 83 ec 18          	sub    $0x18,%rsp
+  8037c2:	49 89 fc             	mov    %rdi,%r12
+  8037c5:	49 89 f5             	mov    %rsi,%r13
+  8037c8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8037cc:	8b 45 10             	mov    0x10(%rbp),%eax
+  8037cf:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8037d2:	41 89 cf             	mov    %ecx,%r15d
+  8037d5:	4c 39 fa             	cmp    %r15,%rdx
+  8037d8:	73 5b                	jae    803835 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8037da:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8037de:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8037e2:	85 db                	test   %ebx,%ebx
+  8037e4:	7e 0e                	jle    8037f4 <print_num+0x43>
+            putch(padc, put_arg);
+  8037e6:	4c 89 ee             	mov    %r13,%rsi
+  8037e9:	44 89 f7             	mov    %r14d,%edi
+  8037ec:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8037ef:	83 eb 01             	sub    $0x1,%ebx
+  8037f2:	75 f2                	jne    8037e6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8037f4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8037f8:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  8037ff:	00 00 00 
+  803802:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  803809:	00 00 00 
+  80380c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803810:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803814:	ba 00 00 00 00       	mov    $0x0,%edx
+  803819:	49 f7 f7             	div    %r15
+  80381c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803820:	4c 89 ee             	mov    %r13,%rsi
+  803823:	41 ff d4             	call   *%r12
+}
+  803826:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80382a:	5b                   	pop    %rbx
+  80382b:	41 5c                	pop    %r12
+  80382d:	41 5d                	pop    %r13
+  80382f:	41 5e                	pop    %r14
+  803831:	41 5f                	pop    %r15
+  803833:	5d                   	pop    %rbp
+  803834:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803835:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803839:	ba 00 00 00 00       	mov    $0x0,%edx
+  80383e:	49 f7 f7             	div    %r15
+  803841:	48 83 ec 08          	sub    $0x8,%rsp
+  803845:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803849:	52                   	push   %rdx
+  80384a:	45 0f be c9          	movsbl %r9b,%r9d
+  80384e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803852:	48 89 c2             	mov    %rax,%rdx
+  803855:	48 b8 b1 37 80 00 00 	movabs $0x8037b1,%rax
+  80385c:	00 00 00 
+  80385f:	ff d0                	call   *%rax
+  803861:	48 83 c4 10          	add    $0x10,%rsp
+  803865:	eb 8d                	jmp    8037f4 <print_num+0x43>
+
+0000000000803867 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803867:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80386b:	48 8b 06             	mov    (%rsi),%rax
+  80386e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  803872:	73 0a                	jae    80387e <sprintputch+0x17>
+        *state->start++ = ch;
+  803874:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803878:	48 89 16             	mov    %rdx,(%rsi)
+  80387b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80387e:	c3                   	ret
+
+000000000080387f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80387f:	55                   	push   %rbp
+  803880:	48 89 e5             	mov    %rsp,%rbp
+  803883:	48 83 ec 50          	sub    $0x50,%rsp
+  803887:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80388b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80388f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  803893:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80389a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80389e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038a2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8038a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8038aa:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8038ae:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  8038b5:	00 00 00 
+  8038b8:	ff d0                	call   *%rax
+}
+  8038ba:	c9                   	leave
+  8038bb:	c3                   	ret
+
+00000000008038bc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8038bc:	55                   	push   %rbp
+  8038bd:	48 89 e5             	mov    %rsp,%rbp
+  8038c0:	41 57                	push   %r15
+  8038c2:	41 56                	push   %r14
+  8038c4:	41 55                	push   %r13
+  8038c6:	41 54                	push   %r12
+  8038c8:	53                   	push   %rbx
+  8038c9:	48 83 ec 38          	sub    $0x38,%rsp
+  8038cd:	49 89 fe             	mov    %rdi,%r14
+  8038d0:	49 89 f5             	mov    %rsi,%r13
+  8038d3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8038d6:	48 8b 01             	mov    (%rcx),%rax
+  8038d9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8038dd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8038e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038e5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8038e9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8038ed:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8038f1:	0f b6 3b             	movzbl (%rbx),%edi
+  8038f4:	40 80 ff 25          	cmp    $0x25,%dil
+  8038f8:	74 18                	je     803912 <vprintfmt+0x56>
+            if (!ch) return;
+  8038fa:	40 84 ff             	test   %dil,%dil
+  8038fd:	0f 84 04 07 00 00    	je     804007 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  803903:	40 0f b6 ff          	movzbl %dil,%edi
+  803907:	4c 89 ee             	mov    %r13,%rsi
+  80390a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80390d:	4c 89 e3             	mov    %r12,%rbx
+  803910:	eb db                	jmp    8038ed <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803912:	be 00 00 00 00       	mov    $0x0,%esi
+  803917:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80391b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803920:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803926:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80392d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803931:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803936:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80393b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80393e:	83 e8 23             	sub    $0x23,%eax
+  803941:	3c 57                	cmp    $0x57,%al
+  803943:	0f 87 a4 06 00 00    	ja     803fed <vprintfmt+0x731>
+  803949:	0f b6 c0             	movzbl %al,%eax
+  80394c:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  803953:	00 00 00 
+  803956:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803959:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80395c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803960:	eb cf                	jmp    803931 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  803962:	49 89 dc             	mov    %rbx,%r12
+  803965:	be 01 00 00 00       	mov    $0x1,%esi
+  80396a:	eb c5                	jmp    803931 <vprintfmt+0x75>
+            padc = ch;
+  80396c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  803970:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803973:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803976:	eb b9                	jmp    803931 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803978:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80397b:	83 f8 2f             	cmp    $0x2f,%eax
+  80397e:	77 24                	ja     8039a4 <vprintfmt+0xe8>
+  803980:	89 c1                	mov    %eax,%ecx
+  803982:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  803986:	83 c0 08             	add    $0x8,%eax
+  803989:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80398c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80398f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  803992:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803996:	79 99                	jns    803931 <vprintfmt+0x75>
+                width = precision;
+  803998:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80399c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8039a2:	eb 8d                	jmp    803931 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8039a4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039a8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8039ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039b0:	eb da                	jmp    80398c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8039b2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8039b7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8039bb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8039c1:	3c 39                	cmp    $0x39,%al
+  8039c3:	77 1c                	ja     8039e1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8039c5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8039c9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8039cd:	0f b6 c0             	movzbl %al,%eax
+  8039d0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8039d5:	0f b6 03             	movzbl (%rbx),%eax
+  8039d8:	3c 39                	cmp    $0x39,%al
+  8039da:	76 e9                	jbe    8039c5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8039dc:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8039df:	eb b1                	jmp    803992 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8039e1:	49 89 dc             	mov    %rbx,%r12
+  8039e4:	eb ac                	jmp    803992 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8039e6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8039e9:	85 c9                	test   %ecx,%ecx
+  8039eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039f0:	0f 49 c1             	cmovns %ecx,%eax
+  8039f3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8039f6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8039f9:	e9 33 ff ff ff       	jmp    803931 <vprintfmt+0x75>
+            lflag++;
+  8039fe:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803a01:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803a04:	e9 28 ff ff ff       	jmp    803931 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803a09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a0c:	83 f8 2f             	cmp    $0x2f,%eax
+  803a0f:	77 19                	ja     803a2a <vprintfmt+0x16e>
+  803a11:	89 c2                	mov    %eax,%edx
+  803a13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a17:	83 c0 08             	add    $0x8,%eax
+  803a1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a1d:	8b 3a                	mov    (%rdx),%edi
+  803a1f:	4c 89 ee             	mov    %r13,%rsi
+  803a22:	41 ff d6             	call   *%r14
+            break;
+  803a25:	e9 c3 fe ff ff       	jmp    8038ed <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803a2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a36:	eb e5                	jmp    803a1d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803a38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a3b:	83 f8 2f             	cmp    $0x2f,%eax
+  803a3e:	77 5a                	ja     803a9a <vprintfmt+0x1de>
+  803a40:	89 c2                	mov    %eax,%edx
+  803a42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a46:	83 c0 08             	add    $0x8,%eax
+  803a49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803a4c:	8b 02                	mov    (%rdx),%eax
+  803a4e:	89 c1                	mov    %eax,%ecx
+  803a50:	f7 d9                	neg    %ecx
+  803a52:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803a55:	83 f9 13             	cmp    $0x13,%ecx
+  803a58:	7f 4e                	jg     803aa8 <vprintfmt+0x1ec>
+  803a5a:	48 63 c1             	movslq %ecx,%rax
+  803a5d:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  803a64:	00 00 00 
+  803a67:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a6b:	48 85 c0             	test   %rax,%rax
+  803a6e:	74 38                	je     803aa8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803a70:	48 89 c1             	mov    %rax,%rcx
+  803a73:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  803a7a:	00 00 00 
+  803a7d:	4c 89 ee             	mov    %r13,%rsi
+  803a80:	4c 89 f7             	mov    %r14,%rdi
+  803a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a88:	49 b8 7f 38 80 00 00 	movabs $0x80387f,%r8
+  803a8f:	00 00 00 
+  803a92:	41 ff d0             	call   *%r8
+  803a95:	e9 53 fe ff ff       	jmp    8038ed <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  803a9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aa2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803aa6:	eb a4                	jmp    803a4c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803aa8:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  803aaf:	00 00 00 
+  803ab2:	4c 89 ee             	mov    %r13,%rsi
+  803ab5:	4c 89 f7             	mov    %r14,%rdi
+  803ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803abd:	49 b8 7f 38 80 00 00 	movabs $0x80387f,%r8
+  803ac4:	00 00 00 
+  803ac7:	41 ff d0             	call   *%r8
+  803aca:	e9 1e fe ff ff       	jmp    8038ed <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803acf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ad2:	83 f8 2f             	cmp    $0x2f,%eax
+  803ad5:	77 36                	ja     803b0d <vprintfmt+0x251>
+  803ad7:	89 c2                	mov    %eax,%edx
+  803ad9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803add:	83 c0 08             	add    $0x8,%eax
+  803ae0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ae3:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  803ae6:	48 85 f6             	test   %rsi,%rsi
+  803ae9:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  803af0:	00 00 00 
+  803af3:	48 0f 45 c6          	cmovne %rsi,%rax
+  803af7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803afb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803aff:	7e 06                	jle    803b07 <vprintfmt+0x24b>
+  803b01:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803b05:	75 14                	jne    803b1b <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803b07:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803b0b:	eb 5b                	jmp    803b68 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  803b0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b19:	eb c8                	jmp    803ae3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803b1b:	49 63 f7             	movslq %r15d,%rsi
+  803b1e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803b22:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+  803b2e:	48 89 c2             	mov    %rax,%rdx
+  803b31:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803b34:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803b36:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803b39:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803b3c:	85 c0                	test   %eax,%eax
+  803b3e:	7e c7                	jle    803b07 <vprintfmt+0x24b>
+  803b40:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803b45:	4c 89 ee             	mov    %r13,%rsi
+  803b48:	44 89 e7             	mov    %r12d,%edi
+  803b4b:	41 ff d6             	call   *%r14
+  803b4e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803b52:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803b55:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803b58:	75 eb                	jne    803b45 <vprintfmt+0x289>
+  803b5a:	eb ab                	jmp    803b07 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803b5c:	0f b6 f8             	movzbl %al,%edi
+  803b5f:	4c 89 ee             	mov    %r13,%rsi
+  803b62:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  803b65:	4c 89 e2             	mov    %r12,%rdx
+  803b68:	45 85 ff             	test   %r15d,%r15d
+  803b6b:	78 06                	js     803b73 <vprintfmt+0x2b7>
+  803b6d:	41 83 ef 01          	sub    $0x1,%r15d
+  803b71:	78 23                	js     803b96 <vprintfmt+0x2da>
+  803b73:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  803b77:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803b7d:	84 c0                	test   %al,%al
+  803b7f:	74 15                	je     803b96 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803b81:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803b85:	74 d5                	je     803b5c <vprintfmt+0x2a0>
+  803b87:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803b8a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803b8f:	80 fa 5e             	cmp    $0x5e,%dl
+  803b92:	77 cb                	ja     803b5f <vprintfmt+0x2a3>
+  803b94:	eb c6                	jmp    803b5c <vprintfmt+0x2a0>
+  803b96:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803b99:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  803b9c:	01 f0                	add    %esi,%eax
+  803b9e:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  803ba0:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803ba4:	85 c0                	test   %eax,%eax
+  803ba6:	0f 8e 41 fd ff ff    	jle    8038ed <vprintfmt+0x31>
+  803bac:	4c 89 ee             	mov    %r13,%rsi
+  803baf:	bf 20 00 00 00       	mov    $0x20,%edi
+  803bb4:	41 ff d6             	call   *%r14
+  803bb7:	41 83 ec 01          	sub    $0x1,%r12d
+  803bbb:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803bbf:	75 eb                	jne    803bac <vprintfmt+0x2f0>
+  803bc1:	e9 27 fd ff ff       	jmp    8038ed <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  803bc6:	40 84 f6             	test   %sil,%sil
+  803bc9:	75 26                	jne    803bf1 <vprintfmt+0x335>
+    switch (lflag) {
+  803bcb:	85 d2                	test   %edx,%edx
+  803bcd:	74 59                	je     803c28 <vprintfmt+0x36c>
+  803bcf:	83 fa 01             	cmp    $0x1,%edx
+  803bd2:	74 7b                	je     803c4f <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  803bd4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bd7:	83 f8 2f             	cmp    $0x2f,%eax
+  803bda:	0f 87 96 00 00 00    	ja     803c76 <vprintfmt+0x3ba>
+  803be0:	89 c2                	mov    %eax,%edx
+  803be2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803be6:	83 c0 08             	add    $0x8,%eax
+  803be9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bec:	4c 8b 22             	mov    (%rdx),%r12
+  803bef:	eb 17                	jmp    803c08 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  803bf1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bf4:	83 f8 2f             	cmp    $0x2f,%eax
+  803bf7:	77 21                	ja     803c1a <vprintfmt+0x35e>
+  803bf9:	89 c2                	mov    %eax,%edx
+  803bfb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803bff:	83 c0 08             	add    $0x8,%eax
+  803c02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c05:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803c08:	4d 85 e4             	test   %r12,%r12
+  803c0b:	78 7a                	js     803c87 <vprintfmt+0x3cb>
+            num = i;
+  803c0d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803c10:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803c15:	e9 b5 02 00 00       	jmp    803ecf <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803c1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c26:	eb dd                	jmp    803c05 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  803c28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c2b:	83 f8 2f             	cmp    $0x2f,%eax
+  803c2e:	77 11                	ja     803c41 <vprintfmt+0x385>
+  803c30:	89 c2                	mov    %eax,%edx
+  803c32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c36:	83 c0 08             	add    $0x8,%eax
+  803c39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c3c:	4c 63 22             	movslq (%rdx),%r12
+  803c3f:	eb c7                	jmp    803c08 <vprintfmt+0x34c>
+  803c41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c4d:	eb ed                	jmp    803c3c <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  803c4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c52:	83 f8 2f             	cmp    $0x2f,%eax
+  803c55:	77 11                	ja     803c68 <vprintfmt+0x3ac>
+  803c57:	89 c2                	mov    %eax,%edx
+  803c59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c5d:	83 c0 08             	add    $0x8,%eax
+  803c60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c63:	4c 8b 22             	mov    (%rdx),%r12
+  803c66:	eb a0                	jmp    803c08 <vprintfmt+0x34c>
+  803c68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c74:	eb ed                	jmp    803c63 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  803c76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c82:	e9 65 ff ff ff       	jmp    803bec <vprintfmt+0x330>
+                putch('-', put_arg);
+  803c87:	4c 89 ee             	mov    %r13,%rsi
+  803c8a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803c8f:	41 ff d6             	call   *%r14
+                i = -i;
+  803c92:	49 f7 dc             	neg    %r12
+  803c95:	e9 73 ff ff ff       	jmp    803c0d <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  803c9a:	40 84 f6             	test   %sil,%sil
+  803c9d:	75 32                	jne    803cd1 <vprintfmt+0x415>
+    switch (lflag) {
+  803c9f:	85 d2                	test   %edx,%edx
+  803ca1:	74 5d                	je     803d00 <vprintfmt+0x444>
+  803ca3:	83 fa 01             	cmp    $0x1,%edx
+  803ca6:	0f 84 82 00 00 00    	je     803d2e <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  803cac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803caf:	83 f8 2f             	cmp    $0x2f,%eax
+  803cb2:	0f 87 a5 00 00 00    	ja     803d5d <vprintfmt+0x4a1>
+  803cb8:	89 c2                	mov    %eax,%edx
+  803cba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803cbe:	83 c0 08             	add    $0x8,%eax
+  803cc1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803cc4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803cc7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803ccc:	e9 fe 01 00 00       	jmp    803ecf <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803cd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803cd4:	83 f8 2f             	cmp    $0x2f,%eax
+  803cd7:	77 19                	ja     803cf2 <vprintfmt+0x436>
+  803cd9:	89 c2                	mov    %eax,%edx
+  803cdb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803cdf:	83 c0 08             	add    $0x8,%eax
+  803ce2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ce5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803ce8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803ced:	e9 dd 01 00 00       	jmp    803ecf <vprintfmt+0x613>
+  803cf2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cf6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cfa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cfe:	eb e5                	jmp    803ce5 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  803d00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803d03:	83 f8 2f             	cmp    $0x2f,%eax
+  803d06:	77 18                	ja     803d20 <vprintfmt+0x464>
+  803d08:	89 c2                	mov    %eax,%edx
+  803d0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803d0e:	83 c0 08             	add    $0x8,%eax
+  803d11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803d14:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803d16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803d1b:	e9 af 01 00 00       	jmp    803ecf <vprintfmt+0x613>
+  803d20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803d28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d2c:	eb e6                	jmp    803d14 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  803d2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803d31:	83 f8 2f             	cmp    $0x2f,%eax
+  803d34:	77 19                	ja     803d4f <vprintfmt+0x493>
+  803d36:	89 c2                	mov    %eax,%edx
+  803d38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803d3c:	83 c0 08             	add    $0x8,%eax
+  803d3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803d42:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803d45:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803d4a:	e9 80 01 00 00       	jmp    803ecf <vprintfmt+0x613>
+  803d4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803d57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d5b:	eb e5                	jmp    803d42 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  803d5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803d65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d69:	e9 56 ff ff ff       	jmp    803cc4 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  803d6e:	40 84 f6             	test   %sil,%sil
+  803d71:	75 2e                	jne    803da1 <vprintfmt+0x4e5>
+    switch (lflag) {
+  803d73:	85 d2                	test   %edx,%edx
+  803d75:	0f 84 b3 00 00 00    	je     803e2e <vprintfmt+0x572>
+  803d7b:	83 fa 01             	cmp    $0x1,%edx
+  803d7e:	0f 84 d3 00 00 00    	je     803e57 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  803d84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803d87:	83 f8 2f             	cmp    $0x2f,%eax
+  803d8a:	0f 87 f1 00 00 00    	ja     803e81 <vprintfmt+0x5c5>
+  803d90:	89 c2                	mov    %eax,%edx
+  803d92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803d96:	83 c0 08             	add    $0x8,%eax
+  803d99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803d9c:	48 8b 02             	mov    (%rdx),%rax
+  803d9f:	eb 17                	jmp    803db8 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  803da1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803da4:	83 f8 2f             	cmp    $0x2f,%eax
+  803da7:	77 77                	ja     803e20 <vprintfmt+0x564>
+  803da9:	89 c2                	mov    %eax,%edx
+  803dab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803daf:	83 c0 08             	add    $0x8,%eax
+  803db2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803db5:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  803db8:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  803dba:	83 f8 07             	cmp    $0x7,%eax
+  803dbd:	0f 8e cf 00 00 00    	jle    803e92 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  803dc3:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  803dc9:	44 89 e7             	mov    %r12d,%edi
+  803dcc:	41 c1 e4 03          	shl    $0x3,%r12d
+  803dd0:	89 d1                	mov    %edx,%ecx
+  803dd2:	8d 72 07             	lea    0x7(%rdx),%esi
+  803dd5:	85 d2                	test   %edx,%edx
+  803dd7:	0f 48 d6             	cmovs  %esi,%edx
+  803dda:	c1 fa 03             	sar    $0x3,%edx
+  803ddd:	83 f9 3f             	cmp    $0x3f,%ecx
+  803de0:	7f e7                	jg     803dc9 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  803de2:	85 ff                	test   %edi,%edi
+  803de4:	0f 84 03 fb ff ff    	je     8038ed <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  803dea:	49 63 f4             	movslq %r12d,%rsi
+  803ded:	ba 00 00 00 00       	mov    $0x0,%edx
+  803df2:	48 f7 f6             	div    %rsi
+  803df5:	49 89 d7             	mov    %rdx,%r15
+  803df8:	83 c0 30             	add    $0x30,%eax
+  803dfb:	0f be f8             	movsbl %al,%edi
+  803dfe:	4c 89 ee             	mov    %r13,%rsi
+  803e01:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  803e04:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  803e07:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  803e0c:	45 85 e4             	test   %r12d,%r12d
+  803e0f:	41 0f 49 d4          	cmovns %r12d,%edx
+  803e13:	c1 fa 03             	sar    $0x3,%edx
+  803e16:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  803e19:	75 cf                	jne    803dea <vprintfmt+0x52e>
+  803e1b:	e9 cd fa ff ff       	jmp    8038ed <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  803e20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803e24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803e28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e2c:	eb 87                	jmp    803db5 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  803e2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803e31:	83 f8 2f             	cmp    $0x2f,%eax
+  803e34:	77 13                	ja     803e49 <vprintfmt+0x58d>
+  803e36:	89 c2                	mov    %eax,%edx
+  803e38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803e3c:	83 c0 08             	add    $0x8,%eax
+  803e3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803e42:	8b 02                	mov    (%rdx),%eax
+  803e44:	e9 6f ff ff ff       	jmp    803db8 <vprintfmt+0x4fc>
+  803e49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803e4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803e51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e55:	eb eb                	jmp    803e42 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  803e57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803e5a:	83 f8 2f             	cmp    $0x2f,%eax
+  803e5d:	77 14                	ja     803e73 <vprintfmt+0x5b7>
+  803e5f:	89 c2                	mov    %eax,%edx
+  803e61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803e65:	83 c0 08             	add    $0x8,%eax
+  803e68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803e6b:	48 8b 02             	mov    (%rdx),%rax
+  803e6e:	e9 45 ff ff ff       	jmp    803db8 <vprintfmt+0x4fc>
+  803e73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803e77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803e7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e7f:	eb ea                	jmp    803e6b <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  803e81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803e85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803e89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e8d:	e9 0a ff ff ff       	jmp    803d9c <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  803e92:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  803e98:	e9 4d ff ff ff       	jmp    803dea <vprintfmt+0x52e>
+            putch('0', put_arg);
+  803e9d:	4c 89 ee             	mov    %r13,%rsi
+  803ea0:	bf 30 00 00 00       	mov    $0x30,%edi
+  803ea5:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803ea8:	4c 89 ee             	mov    %r13,%rsi
+  803eab:	bf 78 00 00 00       	mov    $0x78,%edi
+  803eb0:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803eb3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803eb6:	83 f8 2f             	cmp    $0x2f,%eax
+  803eb9:	77 47                	ja     803f02 <vprintfmt+0x646>
+  803ebb:	89 c2                	mov    %eax,%edx
+  803ebd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ec1:	83 c0 08             	add    $0x8,%eax
+  803ec4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ec7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803eca:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803ecf:	48 83 ec 08          	sub    $0x8,%rsp
+  803ed3:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803ed7:	0f 94 c0             	sete   %al
+  803eda:	0f b6 c0             	movzbl %al,%eax
+  803edd:	50                   	push   %rax
+  803ede:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803ee3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803ee7:	4c 89 ee             	mov    %r13,%rsi
+  803eea:	4c 89 f7             	mov    %r14,%rdi
+  803eed:	48 b8 b1 37 80 00 00 	movabs $0x8037b1,%rax
+  803ef4:	00 00 00 
+  803ef7:	ff d0                	call   *%rax
+            break;
+  803ef9:	48 83 c4 10          	add    $0x10,%rsp
+  803efd:	e9 eb f9 ff ff       	jmp    8038ed <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803f02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803f06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803f0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f0e:	eb b7                	jmp    803ec7 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  803f10:	40 84 f6             	test   %sil,%sil
+  803f13:	75 2b                	jne    803f40 <vprintfmt+0x684>
+    switch (lflag) {
+  803f15:	85 d2                	test   %edx,%edx
+  803f17:	74 56                	je     803f6f <vprintfmt+0x6b3>
+  803f19:	83 fa 01             	cmp    $0x1,%edx
+  803f1c:	74 7f                	je     803f9d <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  803f1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f21:	83 f8 2f             	cmp    $0x2f,%eax
+  803f24:	0f 87 a2 00 00 00    	ja     803fcc <vprintfmt+0x710>
+  803f2a:	89 c2                	mov    %eax,%edx
+  803f2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803f30:	83 c0 08             	add    $0x8,%eax
+  803f33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803f36:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803f39:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803f3e:	eb 8f                	jmp    803ecf <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803f40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f43:	83 f8 2f             	cmp    $0x2f,%eax
+  803f46:	77 19                	ja     803f61 <vprintfmt+0x6a5>
+  803f48:	89 c2                	mov    %eax,%edx
+  803f4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803f4e:	83 c0 08             	add    $0x8,%eax
+  803f51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803f54:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803f57:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803f5c:	e9 6e ff ff ff       	jmp    803ecf <vprintfmt+0x613>
+  803f61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803f65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803f69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f6d:	eb e5                	jmp    803f54 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  803f6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f72:	83 f8 2f             	cmp    $0x2f,%eax
+  803f75:	77 18                	ja     803f8f <vprintfmt+0x6d3>
+  803f77:	89 c2                	mov    %eax,%edx
+  803f79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803f7d:	83 c0 08             	add    $0x8,%eax
+  803f80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803f83:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803f85:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803f8a:	e9 40 ff ff ff       	jmp    803ecf <vprintfmt+0x613>
+  803f8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803f93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803f97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f9b:	eb e6                	jmp    803f83 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  803f9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803fa0:	83 f8 2f             	cmp    $0x2f,%eax
+  803fa3:	77 19                	ja     803fbe <vprintfmt+0x702>
+  803fa5:	89 c2                	mov    %eax,%edx
+  803fa7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803fab:	83 c0 08             	add    $0x8,%eax
+  803fae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803fb1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803fb4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803fb9:	e9 11 ff ff ff       	jmp    803ecf <vprintfmt+0x613>
+  803fbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803fc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803fc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803fca:	eb e5                	jmp    803fb1 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  803fcc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803fd0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803fd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803fd8:	e9 59 ff ff ff       	jmp    803f36 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  803fdd:	4c 89 ee             	mov    %r13,%rsi
+  803fe0:	bf 25 00 00 00       	mov    $0x25,%edi
+  803fe5:	41 ff d6             	call   *%r14
+            break;
+  803fe8:	e9 00 f9 ff ff       	jmp    8038ed <vprintfmt+0x31>
+            putch('%', put_arg);
+  803fed:	4c 89 ee             	mov    %r13,%rsi
+  803ff0:	bf 25 00 00 00       	mov    $0x25,%edi
+  803ff5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803ff8:	48 83 eb 01          	sub    $0x1,%rbx
+  803ffc:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  804000:	75 f6                	jne    803ff8 <vprintfmt+0x73c>
+  804002:	e9 e6 f8 ff ff       	jmp    8038ed <vprintfmt+0x31>
+}
+  804007:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80400b:	5b                   	pop    %rbx
+  80400c:	41 5c                	pop    %r12
+  80400e:	41 5d                	pop    %r13
+  804010:	41 5e                	pop    %r14
+  804012:	41 5f                	pop    %r15
+  804014:	5d                   	pop    %rbp
+  804015:	c3                   	ret
+
+0000000000804016 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  804016:	55                   	push   %rbp
+  804017:	48 89 e5             	mov    %rsp,%rbp
+  80401a:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80401e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804022:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  804027:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80402b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  804032:	48 85 ff             	test   %rdi,%rdi
+  804035:	74 2b                	je     804062 <vsnprintf+0x4c>
+  804037:	48 85 f6             	test   %rsi,%rsi
+  80403a:	74 26                	je     804062 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80403c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804040:	48 bf 67 38 80 00 00 	movabs $0x803867,%rdi
+  804047:	00 00 00 
+  80404a:	48 b8 bc 38 80 00 00 	movabs $0x8038bc,%rax
+  804051:	00 00 00 
+  804054:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  804056:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80405a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80405d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804060:	c9                   	leave
+  804061:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  804062:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804067:	eb f7                	jmp    804060 <vsnprintf+0x4a>
+
+0000000000804069 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  804069:	55                   	push   %rbp
+  80406a:	48 89 e5             	mov    %rsp,%rbp
+  80406d:	48 83 ec 50          	sub    $0x50,%rsp
+  804071:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804075:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804079:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80407d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  804084:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804088:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80408c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804090:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  804094:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  804098:	48 b8 16 40 80 00 00 	movabs $0x804016,%rax
+  80409f:	00 00 00 
+  8040a2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8040a4:	c9                   	leave
+  8040a5:	c3                   	ret
+
+00000000008040a6 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040a6:	55                   	push   %rbp
+  8040a7:	48 89 e5             	mov    %rsp,%rbp
+  8040aa:	41 55                	push   %r13
+  8040ac:	41 54                	push   %r12
+  8040ae:	53                   	push   %rbx
+  8040af:	48 83 ec 08          	sub    $0x8,%rsp
+  8040b3:	49 89 fc             	mov    %rdi,%r12
+  8040b6:	48 89 f7             	mov    %rsi,%rdi
+  8040b9:	48 89 d3             	mov    %rdx,%rbx
+  8040bc:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040bf:	48 85 f6             	test   %rsi,%rsi
+  8040c2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040c9:	00 00 00 
+  8040cc:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8040d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040d5:	48 85 d2             	test   %rdx,%rdx
+  8040d8:	74 03                	je     8040dd <ipc_recv+0x37>
+  8040da:	48 8b 32             	mov    (%rdx),%rsi
+  8040dd:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  8040e4:	00 00 00 
+  8040e7:	ff d0                	call   *%rax
+    if (errno) {
+  8040e9:	85 c0                	test   %eax,%eax
+  8040eb:	74 1c                	je     804109 <ipc_recv+0x63>
+        if (from_env_store)
+  8040ed:	4d 85 e4             	test   %r12,%r12
+  8040f0:	74 08                	je     8040fa <ipc_recv+0x54>
+            *from_env_store = 0;
+  8040f2:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8040f9:	00 
+
+        if (perm_store)
+  8040fa:	4d 85 ed             	test   %r13,%r13
+  8040fd:	74 74                	je     804173 <ipc_recv+0xcd>
+            *perm_store = 0;
+  8040ff:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804106:	00 
+  804107:	eb 6a                	jmp    804173 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804109:	4d 85 e4             	test   %r12,%r12
+  80410c:	74 14                	je     804122 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80410e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804115:	00 00 00 
+  804118:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80411e:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804122:	48 85 db             	test   %rbx,%rbx
+  804125:	74 23                	je     80414a <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804127:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80412e:	00 00 00 
+  804131:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804137:	ba 00 00 00 00       	mov    $0x0,%edx
+  80413c:	85 c9                	test   %ecx,%ecx
+  80413e:	74 07                	je     804147 <ipc_recv+0xa1>
+  804140:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804147:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80414a:	4d 85 ed             	test   %r13,%r13
+  80414d:	74 14                	je     804163 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80414f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804156:	00 00 00 
+  804159:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80415f:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804163:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80416a:	00 00 00 
+  80416d:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804173:	48 83 c4 08          	add    $0x8,%rsp
+  804177:	5b                   	pop    %rbx
+  804178:	41 5c                	pop    %r12
+  80417a:	41 5d                	pop    %r13
+  80417c:	5d                   	pop    %rbp
+  80417d:	c3                   	ret
+
+000000000080417e <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80417e:	55                   	push   %rbp
+  80417f:	48 89 e5             	mov    %rsp,%rbp
+  804182:	41 55                	push   %r13
+  804184:	41 54                	push   %r12
+  804186:	53                   	push   %rbx
+  804187:	48 83 ec 08          	sub    $0x8,%rsp
+  80418b:	49 89 fc             	mov    %rdi,%r12
+  80418e:	48 89 f7             	mov    %rsi,%rdi
+  804191:	48 89 d3             	mov    %rdx,%rbx
+  804194:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804197:	48 85 f6             	test   %rsi,%rsi
+  80419a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041a1:	00 00 00 
+  8041a4:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8041a8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041ad:	48 85 d2             	test   %rdx,%rdx
+  8041b0:	74 03                	je     8041b5 <ipc_try_recv+0x37>
+  8041b2:	48 8b 32             	mov    (%rdx),%rsi
+  8041b5:	48 b8 93 0d 80 00 00 	movabs $0x800d93,%rax
+  8041bc:	00 00 00 
+  8041bf:	ff d0                	call   *%rax
+    if (errno) {
+  8041c1:	85 c0                	test   %eax,%eax
+  8041c3:	75 75                	jne    80423a <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8041c5:	4d 85 e4             	test   %r12,%r12
+  8041c8:	74 14                	je     8041de <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8041ca:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041d1:	00 00 00 
+  8041d4:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8041da:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8041de:	48 85 db             	test   %rbx,%rbx
+  8041e1:	74 23                	je     804206 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8041e3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041ea:	00 00 00 
+  8041ed:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8041f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041f8:	85 c9                	test   %ecx,%ecx
+  8041fa:	74 07                	je     804203 <ipc_try_recv+0x85>
+  8041fc:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804203:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804206:	4d 85 ed             	test   %r13,%r13
+  804209:	74 14                	je     80421f <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80420b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804212:	00 00 00 
+  804215:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80421b:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80421f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804226:	00 00 00 
+  804229:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80422f:	48 83 c4 08          	add    $0x8,%rsp
+  804233:	5b                   	pop    %rbx
+  804234:	41 5c                	pop    %r12
+  804236:	41 5d                	pop    %r13
+  804238:	5d                   	pop    %rbp
+  804239:	c3                   	ret
+        if (from_env_store)
+  80423a:	4d 85 e4             	test   %r12,%r12
+  80423d:	74 08                	je     804247 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80423f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804246:	00 
+        if (perm_store)
+  804247:	4d 85 ed             	test   %r13,%r13
+  80424a:	74 e3                	je     80422f <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80424c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804253:	00 
+  804254:	eb d9                	jmp    80422f <ipc_try_recv+0xb1>
+
+0000000000804256 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804256:	55                   	push   %rbp
+  804257:	48 89 e5             	mov    %rsp,%rbp
+  80425a:	41 57                	push   %r15
+  80425c:	41 56                	push   %r14
+  80425e:	41 55                	push   %r13
+  804260:	41 54                	push   %r12
+  804262:	53                   	push   %rbx
+  804263:	48 83 ec 18          	sub    $0x18,%rsp
+  804267:	41 89 fd             	mov    %edi,%r13d
+  80426a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80426d:	48 89 d3             	mov    %rdx,%rbx
+  804270:	49 89 cc             	mov    %rcx,%r12
+  804273:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804277:	48 85 d2             	test   %rdx,%rdx
+  80427a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804281:	00 00 00 
+  804284:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804288:	49 be fe 0c 80 00 00 	movabs $0x800cfe,%r14
+  80428f:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804292:	49 bf ee 08 80 00 00 	movabs $0x8008ee,%r15
+  804299:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80429c:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80429f:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8042a3:	4c 89 e1             	mov    %r12,%rcx
+  8042a6:	48 89 da             	mov    %rbx,%rdx
+  8042a9:	44 89 ef             	mov    %r13d,%edi
+  8042ac:	41 ff d6             	call   *%r14
+  8042af:	85 c0                	test   %eax,%eax
+  8042b1:	74 37                	je     8042ea <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8042b3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8042b6:	75 05                	jne    8042bd <ipc_send+0x67>
+        sys_yield();
+  8042b8:	41 ff d7             	call   *%r15
+  8042bb:	eb df                	jmp    80429c <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8042bd:	89 c1                	mov    %eax,%ecx
+  8042bf:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  8042c6:	00 00 00 
+  8042c9:	be 65 00 00 00       	mov    $0x65,%esi
+  8042ce:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  8042d5:	00 00 00 
+  8042d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042dd:	49 b8 1c 36 80 00 00 	movabs $0x80361c,%r8
+  8042e4:	00 00 00 
+  8042e7:	41 ff d0             	call   *%r8
+    }
+}
+  8042ea:	48 83 c4 18          	add    $0x18,%rsp
+  8042ee:	5b                   	pop    %rbx
+  8042ef:	41 5c                	pop    %r12
+  8042f1:	41 5d                	pop    %r13
+  8042f3:	41 5e                	pop    %r14
+  8042f5:	41 5f                	pop    %r15
+  8042f7:	5d                   	pop    %rbp
+  8042f8:	c3                   	ret
+
+00000000008042f9 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8042f9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8042fe:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804305:	00 00 00 
+  804308:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80430f:	48 01 ca             	add    %rcx,%rdx
+  804312:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804318:	39 fa                	cmp    %edi,%edx
+  80431a:	74 12                	je     80432e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80431c:	48 83 c0 01          	add    $0x1,%rax
+  804320:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804326:	75 e0                	jne    804308 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804328:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80432d:	c3                   	ret
+            return envs[i].env_id;
+  80432e:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804335:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80433c:	00 00 00 
+  80433f:	48 01 d0             	add    %rdx,%rax
+  804342:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804348:	c3                   	ret
+
+0000000000804349 <__text_end>:
+  804349:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804350:	00 00 00 
+  804353:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435a:	00 00 00 
+  80435d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804364:	00 00 00 
+  804367:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436e:	00 00 00 
+  804371:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804378:	00 00 00 
+  80437b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804382:	00 00 00 
+  804385:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438c:	00 00 00 
+  80438f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804396:	00 00 00 
+  804399:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a0:	00 00 00 
+  8043a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043aa:	00 00 00 
+  8043ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b4:	00 00 00 
+  8043b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043be:	00 00 00 
+  8043c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c8:	00 00 00 
+  8043cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d2:	00 00 00 
+  8043d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dc:	00 00 00 
+  8043df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e6:	00 00 00 
+  8043e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f0:	00 00 00 
+  8043f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fa:	00 00 00 
+  8043fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804404:	00 00 00 
+  804407:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440e:	00 00 00 
+  804411:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804418:	00 00 00 
+  80441b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804422:	00 00 00 
+  804425:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442c:	00 00 00 
+  80442f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804436:	00 00 00 
+  804439:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804440:	00 00 00 
+  804443:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444a:	00 00 00 
+  80444d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804454:	00 00 00 
+  804457:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445e:	00 00 00 
+  804461:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804468:	00 00 00 
+  80446b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804472:	00 00 00 
+  804475:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447c:	00 00 00 
+  80447f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804486:	00 00 00 
+  804489:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804490:	00 00 00 
+  804493:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449a:	00 00 00 
+  80449d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a4:	00 00 00 
+  8044a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ae:	00 00 00 
+  8044b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b8:	00 00 00 
+  8044bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c2:	00 00 00 
+  8044c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cc:	00 00 00 
+  8044cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d6:	00 00 00 
+  8044d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e0:	00 00 00 
+  8044e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ea:	00 00 00 
+  8044ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f4:	00 00 00 
+  8044f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fe:	00 00 00 
+  804501:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804508:	00 00 00 
+  80450b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804512:	00 00 00 
+  804515:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451c:	00 00 00 
+  80451f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804526:	00 00 00 
+  804529:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804530:	00 00 00 
+  804533:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453a:	00 00 00 
+  80453d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804544:	00 00 00 
+  804547:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454e:	00 00 00 
+  804551:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804558:	00 00 00 
+  80455b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804562:	00 00 00 
+  804565:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456c:	00 00 00 
+  80456f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804576:	00 00 00 
+  804579:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804580:	00 00 00 
+  804583:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458a:	00 00 00 
+  80458d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804594:	00 00 00 
+  804597:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459e:	00 00 00 
+  8045a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a8:	00 00 00 
+  8045ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b2:	00 00 00 
+  8045b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bc:	00 00 00 
+  8045bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c6:	00 00 00 
+  8045c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d0:	00 00 00 
+  8045d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045da:	00 00 00 
+  8045dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e4:	00 00 00 
+  8045e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ee:	00 00 00 
+  8045f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f8:	00 00 00 
+  8045fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804602:	00 00 00 
+  804605:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460c:	00 00 00 
+  80460f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804616:	00 00 00 
+  804619:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804620:	00 00 00 
+  804623:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462a:	00 00 00 
+  80462d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804634:	00 00 00 
+  804637:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463e:	00 00 00 
+  804641:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804648:	00 00 00 
+  80464b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804652:	00 00 00 
+  804655:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465c:	00 00 00 
+  80465f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804666:	00 00 00 
+  804669:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804670:	00 00 00 
+  804673:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467a:	00 00 00 
+  80467d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804684:	00 00 00 
+  804687:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468e:	00 00 00 
+  804691:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804698:	00 00 00 
+  80469b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a2:	00 00 00 
+  8046a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ac:	00 00 00 
+  8046af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b6:	00 00 00 
+  8046b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c0:	00 00 00 
+  8046c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ca:	00 00 00 
+  8046cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d4:	00 00 00 
+  8046d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046de:	00 00 00 
+  8046e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e8:	00 00 00 
+  8046eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f2:	00 00 00 
+  8046f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fc:	00 00 00 
+  8046ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804706:	00 00 00 
+  804709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804710:	00 00 00 
+  804713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471a:	00 00 00 
+  80471d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804724:	00 00 00 
+  804727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472e:	00 00 00 
+  804731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804738:	00 00 00 
+  80473b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804742:	00 00 00 
+  804745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474c:	00 00 00 
+  80474f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804756:	00 00 00 
+  804759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804760:	00 00 00 
+  804763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476a:	00 00 00 
+  80476d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804774:	00 00 00 
+  804777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477e:	00 00 00 
+  804781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804788:	00 00 00 
+  80478b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804792:	00 00 00 
+  804795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479c:	00 00 00 
+  80479f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a6:	00 00 00 
+  8047a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b0:	00 00 00 
+  8047b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ba:	00 00 00 
+  8047bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c4:	00 00 00 
+  8047c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ce:	00 00 00 
+  8047d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d8:	00 00 00 
+  8047db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e2:	00 00 00 
+  8047e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ec:	00 00 00 
+  8047ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f6:	00 00 00 
+  8047f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804800:	00 00 00 
+  804803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480a:	00 00 00 
+  80480d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804814:	00 00 00 
+  804817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481e:	00 00 00 
+  804821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804828:	00 00 00 
+  80482b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804832:	00 00 00 
+  804835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483c:	00 00 00 
+  80483f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804846:	00 00 00 
+  804849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804850:	00 00 00 
+  804853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485a:	00 00 00 
+  80485d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804864:	00 00 00 
+  804867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486e:	00 00 00 
+  804871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804878:	00 00 00 
+  80487b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804882:	00 00 00 
+  804885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488c:	00 00 00 
+  80488f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804896:	00 00 00 
+  804899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a0:	00 00 00 
+  8048a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048aa:	00 00 00 
+  8048ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b4:	00 00 00 
+  8048b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048be:	00 00 00 
+  8048c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c8:	00 00 00 
+  8048cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d2:	00 00 00 
+  8048d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dc:	00 00 00 
+  8048df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e6:	00 00 00 
+  8048e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f0:	00 00 00 
+  8048f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fa:	00 00 00 
+  8048fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804904:	00 00 00 
+  804907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490e:	00 00 00 
+  804911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804918:	00 00 00 
+  80491b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804922:	00 00 00 
+  804925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492c:	00 00 00 
+  80492f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804936:	00 00 00 
+  804939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804940:	00 00 00 
+  804943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494a:	00 00 00 
+  80494d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804954:	00 00 00 
+  804957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495e:	00 00 00 
+  804961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804968:	00 00 00 
+  80496b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804972:	00 00 00 
+  804975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497c:	00 00 00 
+  80497f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804986:	00 00 00 
+  804989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804990:	00 00 00 
+  804993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499a:	00 00 00 
+  80499d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a4:	00 00 00 
+  8049a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ae:	00 00 00 
+  8049b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b8:	00 00 00 
+  8049bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c2:	00 00 00 
+  8049c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cc:	00 00 00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e0:	00 00 00 
+  8049e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ea:	00 00 00 
+  8049ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f4:	00 00 00 
+  8049f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fe:	00 00 00 
+  804a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a08:	00 00 00 
+  804a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a12:	00 00 00 
+  804a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1c:	00 00 00 
+  804a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a26:	00 00 00 
+  804a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a30:	00 00 00 
+  804a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3a:	00 00 00 
+  804a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a44:	00 00 00 
+  804a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4e:	00 00 00 
+  804a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a58:	00 00 00 
+  804a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a62:	00 00 00 
+  804a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6c:	00 00 00 
+  804a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a76:	00 00 00 
+  804a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a80:	00 00 00 
+  804a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8a:	00 00 00 
+  804a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a94:	00 00 00 
+  804a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9e:	00 00 00 
+  804aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa8:	00 00 00 
+  804aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab2:	00 00 00 
+  804ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abc:	00 00 00 
+  804abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac6:	00 00 00 
+  804ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad0:	00 00 00 
+  804ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ada:	00 00 00 
+  804add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae4:	00 00 00 
+  804ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aee:	00 00 00 
+  804af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af8:	00 00 00 
+  804afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b02:	00 00 00 
+  804b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0c:	00 00 00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b20:	00 00 00 
+  804b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2a:	00 00 00 
+  804b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b34:	00 00 00 
+  804b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3e:	00 00 00 
+  804b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b48:	00 00 00 
+  804b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b52:	00 00 00 
+  804b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5c:	00 00 00 
+  804b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b66:	00 00 00 
+  804b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b70:	00 00 00 
+  804b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7a:	00 00 00 
+  804b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b84:	00 00 00 
+  804b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8e:	00 00 00 
+  804b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b98:	00 00 00 
+  804b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba2:	00 00 00 
+  804ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bac:	00 00 00 
+  804baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb6:	00 00 00 
+  804bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc0:	00 00 00 
+  804bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bca:	00 00 00 
+  804bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd4:	00 00 00 
+  804bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bde:	00 00 00 
+  804be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be8:	00 00 00 
+  804beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf2:	00 00 00 
+  804bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfc:	00 00 00 
+  804bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c06:	00 00 00 
+  804c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c10:	00 00 00 
+  804c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1a:	00 00 00 
+  804c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c24:	00 00 00 
+  804c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2e:	00 00 00 
+  804c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c38:	00 00 00 
+  804c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c42:	00 00 00 
+  804c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4c:	00 00 00 
+  804c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c56:	00 00 00 
+  804c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c60:	00 00 00 
+  804c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6a:	00 00 00 
+  804c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c74:	00 00 00 
+  804c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7e:	00 00 00 
+  804c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c88:	00 00 00 
+  804c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c92:	00 00 00 
+  804c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9c:	00 00 00 
+  804c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca6:	00 00 00 
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
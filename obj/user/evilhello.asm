@@ -0,0 +1,8099 @@
+
+obj/user/evilhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 23 00 00 00       	call   800046 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* try to print the kernel entry point as a string!  mua ha ha! */
+    sys_cputs((char *)0x804020000c, 100);
+  800029:	be 64 00 00 00       	mov    $0x64,%esi
+  80002e:	48 bf 0c 00 20 40 80 	movabs $0x804020000c,%rdi
+  800035:	00 00 00 
+  800038:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+}
+  800044:	5d                   	pop    %rbp
+  800045:	c3                   	ret
+
+0000000000800046 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800046:	55                   	push   %rbp
+  800047:	48 89 e5             	mov    %rsp,%rbp
+  80004a:	41 56                	push   %r14
+  80004c:	41 55                	push   %r13
+  80004e:	41 54                	push   %r12
+  800050:	53                   	push   %rbx
+  800051:	41 89 fd             	mov    %edi,%r13d
+  800054:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800057:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80005e:	00 00 00 
+  800061:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800068:	00 00 00 
+  80006b:	48 39 c2             	cmp    %rax,%rdx
+  80006e:	73 17                	jae    800087 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800070:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800073:	49 89 c4             	mov    %rax,%r12
+  800076:	48 83 c3 08          	add    $0x8,%rbx
+  80007a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007f:	ff 53 f8             	call   *-0x8(%rbx)
+  800082:	4c 39 e3             	cmp    %r12,%rbx
+  800085:	72 ef                	jb     800076 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800087:	48 b8 db 01 80 00 00 	movabs $0x8001db,%rax
+  80008e:	00 00 00 
+  800091:	ff d0                	call   *%rax
+  800093:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800098:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80009f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a6:	00 00 00 
+  8000a9:	48 01 d0             	add    %rdx,%rax
+  8000ac:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000b3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b6:	45 85 ed             	test   %r13d,%r13d
+  8000b9:	7e 0d                	jle    8000c8 <libmain+0x82>
+  8000bb:	49 8b 06             	mov    (%r14),%rax
+  8000be:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000c5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000c8:	4c 89 f6             	mov    %r14,%rsi
+  8000cb:	44 89 ef             	mov    %r13d,%edi
+  8000ce:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000da:	48 b8 ef 00 80 00 00 	movabs $0x8000ef,%rax
+  8000e1:	00 00 00 
+  8000e4:	ff d0                	call   *%rax
+#endif
+}
+  8000e6:	5b                   	pop    %rbx
+  8000e7:	41 5c                	pop    %r12
+  8000e9:	41 5d                	pop    %r13
+  8000eb:	41 5e                	pop    %r14
+  8000ed:	5d                   	pop    %rbp
+  8000ee:	c3                   	ret
+
+00000000008000ef <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000ef:	55                   	push   %rbp
+  8000f0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f3:	48 b8 d7 0e 80 00 00 	movabs $0x800ed7,%rax
+  8000fa:	00 00 00 
+  8000fd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800104:	48 b8 70 01 80 00 00 	movabs $0x800170,%rax
+  80010b:	00 00 00 
+  80010e:	ff d0                	call   *%rax
+}
+  800110:	5d                   	pop    %rbp
+  800111:	c3                   	ret
+
+0000000000800112 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800112:	55                   	push   %rbp
+  800113:	48 89 e5             	mov    %rsp,%rbp
+  800116:	53                   	push   %rbx
+  800117:	48 89 fa             	mov    %rdi,%rdx
+  80011a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80011d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800122:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800127:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80012c:	be 00 00 00 00       	mov    $0x0,%esi
+  800131:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800137:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800139:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80013d:	c9                   	leave
+  80013e:	c3                   	ret
+
+000000000080013f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80013f:	55                   	push   %rbp
+  800140:	48 89 e5             	mov    %rsp,%rbp
+  800143:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800144:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800153:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800158:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80015d:	be 00 00 00 00       	mov    $0x0,%esi
+  800162:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800168:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80016a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80016e:	c9                   	leave
+  80016f:	c3                   	ret
+
+0000000000800170 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800170:	55                   	push   %rbp
+  800171:	48 89 e5             	mov    %rsp,%rbp
+  800174:	53                   	push   %rbx
+  800175:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800179:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80017c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800181:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800186:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80018b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800190:	be 00 00 00 00       	mov    $0x0,%esi
+  800195:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80019b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80019d:	48 85 c0             	test   %rax,%rax
+  8001a0:	7f 06                	jg     8001a8 <sys_env_destroy+0x38>
+}
+  8001a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a6:	c9                   	leave
+  8001a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001a8:	49 89 c0             	mov    %rax,%r8
+  8001ab:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001b0:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8001b7:	00 00 00 
+  8001ba:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001bf:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8001c6:	00 00 00 
+  8001c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ce:	49 b9 3a 2f 80 00 00 	movabs $0x802f3a,%r9
+  8001d5:	00 00 00 
+  8001d8:	41 ff d1             	call   *%r9
+
+00000000008001db <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001db:	55                   	push   %rbp
+  8001dc:	48 89 e5             	mov    %rsp,%rbp
+  8001df:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001e0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800204:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800206:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80020a:	c9                   	leave
+  80020b:	c3                   	ret
+
+000000000080020c <sys_yield>:
+
+void
+sys_yield(void) {
+  80020c:	55                   	push   %rbp
+  80020d:	48 89 e5             	mov    %rsp,%rbp
+  800210:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800211:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800220:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800225:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80022a:	be 00 00 00 00       	mov    $0x0,%esi
+  80022f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800235:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800237:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+000000000080023d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80023d:	55                   	push   %rbp
+  80023e:	48 89 e5             	mov    %rsp,%rbp
+  800241:	53                   	push   %rbx
+  800242:	48 89 fa             	mov    %rdi,%rdx
+  800245:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800248:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80024d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800254:	00 00 00 
+  800257:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80025c:	be 00 00 00 00       	mov    $0x0,%esi
+  800261:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800267:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800269:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80026d:	c9                   	leave
+  80026e:	c3                   	ret
+
+000000000080026f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80026f:	55                   	push   %rbp
+  800270:	48 89 e5             	mov    %rsp,%rbp
+  800273:	53                   	push   %rbx
+  800274:	49 89 f8             	mov    %rdi,%r8
+  800277:	48 89 d3             	mov    %rdx,%rbx
+  80027a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80027d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800282:	4c 89 c2             	mov    %r8,%rdx
+  800285:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800288:	be 00 00 00 00       	mov    $0x0,%esi
+  80028d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800293:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800295:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+
+000000000080029b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	53                   	push   %rbx
+  8002a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a4:	89 f8                	mov    %edi,%eax
+  8002a6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002a9:	48 63 f9             	movslq %ecx,%rdi
+  8002ac:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002af:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002c4:	48 85 c0             	test   %rax,%rax
+  8002c7:	7f 06                	jg     8002cf <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002cd:	c9                   	leave
+  8002ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002cf:	49 89 c0             	mov    %rax,%r8
+  8002d2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002d7:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8002de:	00 00 00 
+  8002e1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002e6:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8002ed:	00 00 00 
+  8002f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f5:	49 b9 3a 2f 80 00 00 	movabs $0x802f3a,%r9
+  8002fc:	00 00 00 
+  8002ff:	41 ff d1             	call   *%r9
+
+0000000000800302 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800302:	55                   	push   %rbp
+  800303:	48 89 e5             	mov    %rsp,%rbp
+  800306:	53                   	push   %rbx
+  800307:	48 83 ec 08          	sub    $0x8,%rsp
+  80030b:	89 f8                	mov    %edi,%eax
+  80030d:	49 89 f2             	mov    %rsi,%r10
+  800310:	48 89 cf             	mov    %rcx,%rdi
+  800313:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800316:	48 63 da             	movslq %edx,%rbx
+  800319:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80031c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800321:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800324:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800327:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800329:	48 85 c0             	test   %rax,%rax
+  80032c:	7f 06                	jg     800334 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80032e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800332:	c9                   	leave
+  800333:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800334:	49 89 c0             	mov    %rax,%r8
+  800337:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80033c:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800343:	00 00 00 
+  800346:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80034b:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800352:	00 00 00 
+  800355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035a:	49 b9 3a 2f 80 00 00 	movabs $0x802f3a,%r9
+  800361:	00 00 00 
+  800364:	41 ff d1             	call   *%r9
+
+0000000000800367 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800367:	55                   	push   %rbp
+  800368:	48 89 e5             	mov    %rsp,%rbp
+  80036b:	53                   	push   %rbx
+  80036c:	48 83 ec 08          	sub    $0x8,%rsp
+  800370:	49 89 f9             	mov    %rdi,%r9
+  800373:	89 f0                	mov    %esi,%eax
+  800375:	48 89 d3             	mov    %rdx,%rbx
+  800378:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80037b:	49 63 f0             	movslq %r8d,%rsi
+  80037e:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800381:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800386:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800389:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80038f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800391:	48 85 c0             	test   %rax,%rax
+  800394:	7f 06                	jg     80039c <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800396:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80039a:	c9                   	leave
+  80039b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80039c:	49 89 c0             	mov    %rax,%r8
+  80039f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003a4:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8003ab:	00 00 00 
+  8003ae:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8003b3:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8003ba:	00 00 00 
+  8003bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c2:	49 b9 3a 2f 80 00 00 	movabs $0x802f3a,%r9
+  8003c9:	00 00 00 
+  8003cc:	41 ff d1             	call   *%r9
+
+00000000008003cf <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003cf:	55                   	push   %rbp
+  8003d0:	48 89 e5             	mov    %rsp,%rbp
+  8003d3:	53                   	push   %rbx
+  8003d4:	89 f8                	mov    %edi,%eax
+  8003d6:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8003d9:	48 63 f9             	movslq %ecx,%rdi
+  8003dc:	48 63 da             	movslq %edx,%rbx
+  8003df:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003e2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003e7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003f5:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8003f7:	89 c2                	mov    %eax,%edx
+  8003f9:	48 85 c0             	test   %rax,%rax
+  8003fc:	78 0d                	js     80040b <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8003fe:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  800403:	4d 85 c9             	test   %r9,%r9
+  800406:	74 03                	je     80040b <sys_alloc_dma_region+0x3c>
+  800408:	49 89 01             	mov    %rax,(%r9)
+}
+  80040b:	89 d0                	mov    %edx,%eax
+  80040d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800411:	c9                   	leave
+  800412:	c3                   	ret
+
+0000000000800413 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  800413:	55                   	push   %rbp
+  800414:	48 89 e5             	mov    %rsp,%rbp
+  800417:	53                   	push   %rbx
+  800418:	48 83 ec 08          	sub    $0x8,%rsp
+  80041c:	48 89 f1             	mov    %rsi,%rcx
+  80041f:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800422:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800425:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80042a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80042f:	be 00 00 00 00       	mov    $0x0,%esi
+  800434:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80043a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80043c:	48 85 c0             	test   %rax,%rax
+  80043f:	7f 06                	jg     800447 <sys_set_cache_region+0x34>
+}
+  800441:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800445:	c9                   	leave
+  800446:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800447:	49 89 c0             	mov    %rax,%r8
+  80044a:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80044f:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800456:	00 00 00 
+  800459:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80045e:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800465:	00 00 00 
+  800468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046d:	49 b9 3a 2f 80 00 00 	movabs $0x802f3a,%r9
+  800474:	00 00 00 
+  800477:	41 ff d1             	call   *%r9
+
+000000000080047a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80047a:	55                   	push   %rbp
+  80047b:	48 89 e5             	mov    %rsp,%rbp
+  80047e:	53                   	push   %rbx
+  80047f:	48 83 ec 08          	sub    $0x8,%rsp
+  800483:	48 89 f1             	mov    %rsi,%rcx
+  800486:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800489:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80048c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800491:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800496:	be 00 00 00 00       	mov    $0x0,%esi
+  80049b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004a1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004a3:	48 85 c0             	test   %rax,%rax
+  8004a6:	7f 06                	jg     8004ae <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8004a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004ac:	c9                   	leave
+  8004ad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004ae:	49 89 c0             	mov    %rax,%r8
+  8004b1:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004b6:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8004bd:	00 00 00 
+  8004c0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004c5:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8004cc:	00 00 00 
+  8004cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d4:	49 b9 3a 2f 80 00 00 	movabs $0x802f3a,%r9
+  8004db:	00 00 00 
+  8004de:	41 ff d1             	call   *%r9
+
+00000000008004e1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004e1:	55                   	push   %rbp
+  8004e2:	48 89 e5             	mov    %rsp,%rbp
+  8004e5:	53                   	push   %rbx
+  8004e6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004ea:	48 63 ce             	movslq %esi,%rcx
+  8004ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800504:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80050a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80050c:	48 85 c0             	test   %rax,%rax
+  80050f:	7f 06                	jg     800517 <sys_env_set_status+0x36>
+}
+  800511:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800515:	c9                   	leave
+  800516:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800517:	49 89 c0             	mov    %rax,%r8
+  80051a:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80051f:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800526:	00 00 00 
+  800529:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80052e:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800535:	00 00 00 
+  800538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053d:	49 b9 3a 2f 80 00 00 	movabs $0x802f3a,%r9
+  800544:	00 00 00 
+  800547:	41 ff d1             	call   *%r9
+
+000000000080054a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80054a:	55                   	push   %rbp
+  80054b:	48 89 e5             	mov    %rsp,%rbp
+  80054e:	53                   	push   %rbx
+  80054f:	48 83 ec 08          	sub    $0x8,%rsp
+  800553:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800556:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800559:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80055e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800563:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800568:	be 00 00 00 00       	mov    $0x0,%esi
+  80056d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800573:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800575:	48 85 c0             	test   %rax,%rax
+  800578:	7f 06                	jg     800580 <sys_env_set_trapframe+0x36>
+}
+  80057a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80057e:	c9                   	leave
+  80057f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800580:	49 89 c0             	mov    %rax,%r8
+  800583:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800588:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80058f:	00 00 00 
+  800592:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800597:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80059e:	00 00 00 
+  8005a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a6:	49 b9 3a 2f 80 00 00 	movabs $0x802f3a,%r9
+  8005ad:	00 00 00 
+  8005b0:	41 ff d1             	call   *%r9
+
+00000000008005b3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005b3:	55                   	push   %rbp
+  8005b4:	48 89 e5             	mov    %rsp,%rbp
+  8005b7:	53                   	push   %rbx
+  8005b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005bc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005bf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005c2:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005de:	48 85 c0             	test   %rax,%rax
+  8005e1:	7f 06                	jg     8005e9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8005e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005e7:	c9                   	leave
+  8005e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005e9:	49 89 c0             	mov    %rax,%r8
+  8005ec:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005f1:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8005f8:	00 00 00 
+  8005fb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800600:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800607:	00 00 00 
+  80060a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060f:	49 b9 3a 2f 80 00 00 	movabs $0x802f3a,%r9
+  800616:	00 00 00 
+  800619:	41 ff d1             	call   *%r9
+
+000000000080061c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80061c:	55                   	push   %rbp
+  80061d:	48 89 e5             	mov    %rsp,%rbp
+  800620:	53                   	push   %rbx
+  800621:	89 f8                	mov    %edi,%eax
+  800623:	49 89 f1             	mov    %rsi,%r9
+  800626:	48 89 d3             	mov    %rdx,%rbx
+  800629:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80062c:	49 63 f0             	movslq %r8d,%rsi
+  80062f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800632:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800637:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80063a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800640:	cd 30                	int    $0x30
+}
+  800642:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800646:	c9                   	leave
+  800647:	c3                   	ret
+
+0000000000800648 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800648:	55                   	push   %rbp
+  800649:	48 89 e5             	mov    %rsp,%rbp
+  80064c:	53                   	push   %rbx
+  80064d:	48 83 ec 08          	sub    $0x8,%rsp
+  800651:	48 89 fa             	mov    %rdi,%rdx
+  800654:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800657:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80065c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800661:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800666:	be 00 00 00 00       	mov    $0x0,%esi
+  80066b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800671:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800673:	48 85 c0             	test   %rax,%rax
+  800676:	7f 06                	jg     80067e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800678:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80067c:	c9                   	leave
+  80067d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80067e:	49 89 c0             	mov    %rax,%r8
+  800681:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800686:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80068d:	00 00 00 
+  800690:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800695:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80069c:	00 00 00 
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	49 b9 3a 2f 80 00 00 	movabs $0x802f3a,%r9
+  8006ab:	00 00 00 
+  8006ae:	41 ff d1             	call   *%r9
+
+00000000008006b1 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8006b1:	55                   	push   %rbp
+  8006b2:	48 89 e5             	mov    %rsp,%rbp
+  8006b5:	53                   	push   %rbx
+  8006b6:	48 89 fa             	mov    %rdi,%rdx
+  8006b9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006bc:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8006d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006d6:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006dc:	c9                   	leave
+  8006dd:	c3                   	ret
+
+00000000008006de <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006de:	55                   	push   %rbp
+  8006df:	48 89 e5             	mov    %rsp,%rbp
+  8006e2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006e3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800701:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800707:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800709:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80070d:	c9                   	leave
+  80070e:	c3                   	ret
+
+000000000080070f <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80070f:	48 85 ff             	test   %rdi,%rdi
+  800712:	0f 84 b6 01 00 00    	je     8008ce <malloc+0x1bf>
+malloc(size_t size) {
+  800718:	55                   	push   %rbp
+  800719:	48 89 e5             	mov    %rsp,%rbp
+  80071c:	41 56                	push   %r14
+  80071e:	41 55                	push   %r13
+  800720:	41 54                	push   %r12
+  800722:	53                   	push   %rbx
+  800723:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800726:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80072d:	00 00 00 
+  800730:	4c 8b 20             	mov    (%rax),%r12
+  800733:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80073a:	0f 87 94 01 00 00    	ja     8008d4 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  800740:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800747:	00 00 00 
+  80074a:	48 85 c0             	test   %rax,%rax
+  80074d:	74 6b                	je     8007ba <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80074f:	4d 85 e4             	test   %r12,%r12
+  800752:	74 66                	je     8007ba <malloc+0xab>
+  800754:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80075b:	00 00 00 
+  80075e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800763:	eb 0d                	jmp    800772 <malloc+0x63>
+  800765:	48 83 c1 01          	add    $0x1,%rcx
+  800769:	48 83 c2 18          	add    $0x18,%rdx
+  80076d:	49 39 cc             	cmp    %rcx,%r12
+  800770:	74 48                	je     8007ba <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  800772:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  800777:	74 ec                	je     800765 <malloc+0x56>
+  800779:	48 39 1a             	cmp    %rbx,(%rdx)
+  80077c:	72 e7                	jb     800765 <malloc+0x56>
+                real_freep_size--;
+  80077e:	48 83 e8 01          	sub    $0x1,%rax
+  800782:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800789:	00 00 00 
+                freep[i].is_free = false;
+  80078c:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800793:	00 00 00 
+  800796:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80079a:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  80079e:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8007a2:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8007a9:	00 
+                freep[i].size = size;
+  8007aa:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8007ae:	48 01 c8             	add    %rcx,%rax
+  8007b1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007b5:	e9 0b 01 00 00       	jmp    8008c5 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8007ba:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8007c1:	00 00 00 
+  8007c4:	48 01 d8             	add    %rbx,%rax
+  8007c7:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007cd:	76 7c                	jbe    80084b <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007cf:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8007d6:	00 00 00 
+  8007d9:	4c 8b 30             	mov    (%rax),%r14
+  8007dc:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8007e3:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8007e6:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8007ed:	00 00 00 
+  8007f0:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8007f7:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8007fe:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  800804:	4c 0f 45 eb          	cmovne %rbx,%r13
+  800808:	48 b8 db 01 80 00 00 	movabs $0x8001db,%rax
+  80080f:	00 00 00 
+  800812:	ff d0                	call   *%rax
+  800814:	89 c7                	mov    %eax,%edi
+  800816:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80081d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  800824:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80082b:	00 00 00 
+  80082e:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  800832:	b9 26 00 00 00       	mov    $0x26,%ecx
+  800837:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  80083e:	00 00 00 
+  800841:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  800843:	85 c0                	test   %eax,%eax
+  800845:	0f 88 90 00 00 00    	js     8008db <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80084b:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  800852:	00 00 00 
+  800855:	48 8b 31             	mov    (%rcx),%rsi
+  800858:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  80085f:	00 00 00 
+  800862:	4c 8b 07             	mov    (%rdi),%r8
+  800865:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  800869:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  800870:	00 00 00 
+  800873:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  800877:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80087b:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800882:	00 00 00 
+  800885:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  800889:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80088c:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  800890:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  800897:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  800898:	48 89 d8             	mov    %rbx,%rax
+  80089b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8008a0:	4c 01 c0             	add    %r8,%rax
+  8008a3:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8008a6:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8008ad:	48 01 f3             	add    %rsi,%rbx
+  8008b0:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8008b3:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8008b8:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008bf:	00 00 00 
+  8008c2:	48 89 d0             	mov    %rdx,%rax
+}
+  8008c5:	5b                   	pop    %rbx
+  8008c6:	41 5c                	pop    %r12
+  8008c8:	41 5d                	pop    %r13
+  8008ca:	41 5e                	pop    %r14
+  8008cc:	5d                   	pop    %rbp
+  8008cd:	c3                   	ret
+        return NULL;
+  8008ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008d3:	c3                   	ret
+        return NULL;
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d9:	eb ea                	jmp    8008c5 <malloc+0x1b6>
+            return NULL;
+  8008db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e0:	eb e3                	jmp    8008c5 <malloc+0x1b6>
+
+00000000008008e2 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8008e2:	55                   	push   %rbp
+  8008e3:	48 89 e5             	mov    %rsp,%rbp
+  8008e6:	53                   	push   %rbx
+  8008e7:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8008eb:	48 89 fb             	mov    %rdi,%rbx
+  8008ee:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8008f2:	48 89 df             	mov    %rbx,%rdi
+  8008f5:	48 b8 0f 07 80 00 00 	movabs $0x80070f,%rax
+  8008fc:	00 00 00 
+  8008ff:	ff d0                	call   *%rax
+  800901:	48 89 c7             	mov    %rax,%rdi
+  800904:	48 89 da             	mov    %rbx,%rdx
+  800907:	be 00 00 00 00       	mov    $0x0,%esi
+  80090c:	48 b8 e2 3c 80 00 00 	movabs $0x803ce2,%rax
+  800913:	00 00 00 
+  800916:	ff d0                	call   *%rax
+}
+  800918:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80091c:	c9                   	leave
+  80091d:	c3                   	ret
+
+000000000080091e <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  80091e:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  800925:	00 00 00 
+  800928:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80092f:	00 00 00 
+  800932:	48 3b 02             	cmp    (%rdx),%rax
+  800935:	74 4d                	je     800984 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  800937:	48 85 c0             	test   %rax,%rax
+  80093a:	74 4d                	je     800989 <get_allocsize+0x6b>
+  80093c:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  800943:	00 00 00 
+  800946:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80094b:	48 3b 39             	cmp    (%rcx),%rdi
+  80094e:	74 13                	je     800963 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  800950:	48 83 c2 01          	add    $0x1,%rdx
+  800954:	48 83 c1 18          	add    $0x18,%rcx
+  800958:	48 39 d0             	cmp    %rdx,%rax
+  80095b:	75 ee                	jne    80094b <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  80095d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800962:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  800963:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096c:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800973:	00 00 00 
+  800976:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80097c:	75 0b                	jne    800989 <get_allocsize+0x6b>
+  80097e:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  800983:	c3                   	ret
+        return 0;
+  800984:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800989:	c3                   	ret
+
+000000000080098a <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80098a:	48 85 ff             	test   %rdi,%rdi
+  80098d:	0f 84 01 01 00 00    	je     800a94 <free+0x10a>
+free(void *ptr) {
+  800993:	55                   	push   %rbp
+  800994:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  800997:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80099e:	00 00 00 
+  8009a1:	48 8b 30             	mov    (%rax),%rsi
+  8009a4:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8009ab:	00 00 00 
+  8009ae:	48 39 c6             	cmp    %rax,%rsi
+  8009b1:	74 50                	je     800a03 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8009b3:	48 85 f6             	test   %rsi,%rsi
+  8009b6:	74 21                	je     8009d9 <free+0x4f>
+  8009b8:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009bf:	00 00 00 
+  8009c2:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009c7:	48 3b 39             	cmp    (%rcx),%rdi
+  8009ca:	74 61                	je     800a2d <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009cc:	48 83 c2 01          	add    $0x1,%rdx
+  8009d0:	48 83 c1 18          	add    $0x18,%rcx
+  8009d4:	48 39 d6             	cmp    %rdx,%rsi
+  8009d7:	75 ee                	jne    8009c7 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8009d9:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  8009e0:	00 00 00 
+  8009e3:	be 12 01 00 00       	mov    $0x112,%esi
+  8009e8:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009ef:	00 00 00 
+  8009f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f7:	48 b9 3a 2f 80 00 00 	movabs $0x802f3a,%rcx
+  8009fe:	00 00 00 
+  800a01:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  800a03:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  800a0a:	00 00 00 
+  800a0d:	be 06 01 00 00       	mov    $0x106,%esi
+  800a12:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a19:	00 00 00 
+  800a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a21:	48 b9 3a 2f 80 00 00 	movabs $0x802f3a,%rcx
+  800a28:	00 00 00 
+  800a2b:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a2d:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a31:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a38:	00 00 00 
+  800a3b:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a41:	75 27                	jne    800a6a <free+0xe0>
+            freep[i].is_free = true;
+  800a43:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a47:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a4e:	00 00 00 
+  800a51:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a58:	00 00 
+            real_freep_size++;
+  800a5a:	48 83 c0 01          	add    $0x1,%rax
+  800a5e:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a65:	00 00 00 
+}
+  800a68:	5d                   	pop    %rbp
+  800a69:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a6a:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a71:	00 00 00 
+  800a74:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800a79:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a80:	00 00 00 
+  800a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a88:	48 b9 3a 2f 80 00 00 	movabs $0x802f3a,%rcx
+  800a8f:	00 00 00 
+  800a92:	ff d1                	call   *%rcx
+  800a94:	c3                   	ret
+
+0000000000800a95 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800a95:	55                   	push   %rbp
+  800a96:	48 89 e5             	mov    %rsp,%rbp
+  800a99:	41 55                	push   %r13
+  800a9b:	41 54                	push   %r12
+  800a9d:	53                   	push   %rbx
+  800a9e:	48 83 ec 08          	sub    $0x8,%rsp
+  800aa2:	48 89 fb             	mov    %rdi,%rbx
+  800aa5:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800aa8:	48 b8 1e 09 80 00 00 	movabs $0x80091e,%rax
+  800aaf:	00 00 00 
+  800ab2:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800ab4:	49 39 c5             	cmp    %rax,%r13
+  800ab7:	73 0e                	jae    800ac7 <realloc+0x32>
+}
+  800ab9:	48 89 d8             	mov    %rbx,%rax
+  800abc:	48 83 c4 08          	add    $0x8,%rsp
+  800ac0:	5b                   	pop    %rbx
+  800ac1:	41 5c                	pop    %r12
+  800ac3:	41 5d                	pop    %r13
+  800ac5:	5d                   	pop    %rbp
+  800ac6:	c3                   	ret
+  800ac7:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800aca:	4c 89 ef             	mov    %r13,%rdi
+  800acd:	48 b8 0f 07 80 00 00 	movabs $0x80070f,%rax
+  800ad4:	00 00 00 
+  800ad7:	ff d0                	call   *%rax
+  800ad9:	48 89 c7             	mov    %rax,%rdi
+  800adc:	4c 89 e2             	mov    %r12,%rdx
+  800adf:	48 89 de             	mov    %rbx,%rsi
+  800ae2:	48 b8 f7 3d 80 00 00 	movabs $0x803df7,%rax
+  800ae9:	00 00 00 
+  800aec:	ff d0                	call   *%rax
+  800aee:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800af1:	48 89 df             	mov    %rbx,%rdi
+  800af4:	48 b8 8a 09 80 00 00 	movabs $0x80098a,%rax
+  800afb:	00 00 00 
+  800afe:	ff d0                	call   *%rax
+    return newptr;
+  800b00:	4c 89 e3             	mov    %r12,%rbx
+  800b03:	eb b4                	jmp    800ab9 <realloc+0x24>
+
+0000000000800b05 <strdup>:
+
+char*
+strdup (const char *src) {
+  800b05:	55                   	push   %rbp
+  800b06:	48 89 e5             	mov    %rsp,%rbp
+  800b09:	41 54                	push   %r12
+  800b0b:	53                   	push   %rbx
+  800b0c:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800b0f:	48 b8 c4 39 80 00 00 	movabs $0x8039c4,%rax
+  800b16:	00 00 00 
+  800b19:	ff d0                	call   *%rax
+  800b1b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b1f:	4c 89 e7             	mov    %r12,%rdi
+  800b22:	48 b8 0f 07 80 00 00 	movabs $0x80070f,%rax
+  800b29:	00 00 00 
+  800b2c:	ff d0                	call   *%rax
+  800b2e:	48 89 c7             	mov    %rax,%rdi
+  800b31:	4c 89 e2             	mov    %r12,%rdx
+  800b34:	48 89 de             	mov    %rbx,%rsi
+  800b37:	48 b8 f7 3d 80 00 00 	movabs $0x803df7,%rax
+  800b3e:	00 00 00 
+  800b41:	ff d0                	call   *%rax
+}
+  800b43:	5b                   	pop    %rbx
+  800b44:	41 5c                	pop    %r12
+  800b46:	5d                   	pop    %rbp
+  800b47:	c3                   	ret
+
+0000000000800b48 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b48:	55                   	push   %rbp
+  800b49:	48 89 e5             	mov    %rsp,%rbp
+  800b4c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b4d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b57:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b61:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b66:	be 00 00 00 00       	mov    $0x0,%esi
+  800b6b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b71:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b77:	c9                   	leave
+  800b78:	c3                   	ret
+
+0000000000800b79 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800b79:	55                   	push   %rbp
+  800b7a:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800b7d:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800b84:	00 00 00 
+  800b87:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b8b:	74 26                	je     800bb3 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800b8d:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b8f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b93:	89 c0                	mov    %eax,%eax
+  800b95:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800b98:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800b9f:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800ba6:	00 00 00 
+  800ba9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bae:	48 f7 31             	divq   (%rcx)
+}
+  800bb1:	5d                   	pop    %rbp
+  800bb2:	c3                   	ret
+        freq = get_cpufreq();
+  800bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb8:	48 ba 48 0b 80 00 00 	movabs $0x800b48,%rdx
+  800bbf:	00 00 00 
+  800bc2:	ff d2                	call   *%rdx
+  800bc4:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bcb:	00 00 00 
+  800bce:	eb bd                	jmp    800b8d <get_ticks+0x14>
+
+0000000000800bd0 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bd0:	55                   	push   %rbp
+  800bd1:	48 89 e5             	mov    %rsp,%rbp
+  800bd4:	53                   	push   %rbx
+  800bd5:	48 83 ec 08          	sub    $0x8,%rsp
+  800bd9:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800bdc:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800be3:	00 00 00 
+  800be6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800bea:	74 50                	je     800c3c <sleep+0x6c>
+    asm volatile("rdtsc"
+  800bec:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bee:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bf2:	89 c0                	mov    %eax,%eax
+  800bf4:	48 89 d6             	mov    %rdx,%rsi
+  800bf7:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800bfa:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800c01:	00 00 00 
+  800c04:	48 0f af 18          	imul   (%rax),%rbx
+  800c08:	48 c1 eb 03          	shr    $0x3,%rbx
+  800c0c:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800c13:	9b c4 20 
+  800c16:	48 89 d8             	mov    %rbx,%rax
+  800c19:	48 f7 e2             	mul    %rdx
+  800c1c:	48 89 d1             	mov    %rdx,%rcx
+  800c1f:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c23:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c25:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c29:	89 c0                	mov    %eax,%eax
+  800c2b:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c2e:	48 29 f2             	sub    %rsi,%rdx
+  800c31:	48 39 ca             	cmp    %rcx,%rdx
+  800c34:	72 ed                	jb     800c23 <sleep+0x53>
+}
+  800c36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c3a:	c9                   	leave
+  800c3b:	c3                   	ret
+        freq = get_cpufreq();
+  800c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c41:	48 ba 48 0b 80 00 00 	movabs $0x800b48,%rdx
+  800c48:	00 00 00 
+  800c4b:	ff d2                	call   *%rdx
+  800c4d:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c54:	00 00 00 
+  800c57:	eb 93                	jmp    800bec <sleep+0x1c>
+
+0000000000800c59 <poll_kbd>:
+
+int poll_kbd() {
+  800c59:	55                   	push   %rbp
+  800c5a:	48 89 e5             	mov    %rsp,%rbp
+  800c5d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c5e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c68:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c72:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c77:	be 00 00 00 00       	mov    $0x0,%esi
+  800c7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c82:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c88:	c9                   	leave
+  800c89:	c3                   	ret
+
+0000000000800c8a <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800c8a:	55                   	push   %rbp
+  800c8b:	48 89 e5             	mov    %rsp,%rbp
+  800c8e:	53                   	push   %rbx
+  800c8f:	49 89 fa             	mov    %rdi,%r10
+  800c92:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800c94:	44 89 c6             	mov    %r8d,%esi
+  800c97:	89 cf                	mov    %ecx,%edi
+  800c99:	89 d3                	mov    %edx,%ebx
+  800c9b:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800c9d:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ca2:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ca5:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800ca9:	cd 30                	int    $0x30
+  800cab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800caf:	c9                   	leave
+  800cb0:	c3                   	ret
+
+0000000000800cb1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cb1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cb8:	ff ff ff 
+  800cbb:	48 01 f8             	add    %rdi,%rax
+  800cbe:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800cc2:	c3                   	ret
+
+0000000000800cc3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cc3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cca:	ff ff ff 
+  800ccd:	48 01 f8             	add    %rdi,%rax
+  800cd0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800cd4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800cda:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800cde:	c3                   	ret
+
+0000000000800cdf <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800cdf:	55                   	push   %rbp
+  800ce0:	48 89 e5             	mov    %rsp,%rbp
+  800ce3:	41 57                	push   %r15
+  800ce5:	41 56                	push   %r14
+  800ce7:	41 55                	push   %r13
+  800ce9:	41 54                	push   %r12
+  800ceb:	53                   	push   %rbx
+  800cec:	48 83 ec 08          	sub    $0x8,%rsp
+  800cf0:	49 89 ff             	mov    %rdi,%r15
+  800cf3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800cf8:	49 bd 93 2b 80 00 00 	movabs $0x802b93,%r13
+  800cff:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800d02:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800d08:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800d0b:	48 89 df             	mov    %rbx,%rdi
+  800d0e:	41 ff d5             	call   *%r13
+  800d11:	83 e0 04             	and    $0x4,%eax
+  800d14:	74 17                	je     800d2d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800d16:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d1d:	4c 39 f3             	cmp    %r14,%rbx
+  800d20:	75 e6                	jne    800d08 <fd_alloc+0x29>
+  800d22:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d28:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d2d:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d30:	48 83 c4 08          	add    $0x8,%rsp
+  800d34:	5b                   	pop    %rbx
+  800d35:	41 5c                	pop    %r12
+  800d37:	41 5d                	pop    %r13
+  800d39:	41 5e                	pop    %r14
+  800d3b:	41 5f                	pop    %r15
+  800d3d:	5d                   	pop    %rbp
+  800d3e:	c3                   	ret
+
+0000000000800d3f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d3f:	83 ff 1f             	cmp    $0x1f,%edi
+  800d42:	77 39                	ja     800d7d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d44:	55                   	push   %rbp
+  800d45:	48 89 e5             	mov    %rsp,%rbp
+  800d48:	41 54                	push   %r12
+  800d4a:	53                   	push   %rbx
+  800d4b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d4e:	48 63 df             	movslq %edi,%rbx
+  800d51:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d58:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d5c:	48 89 df             	mov    %rbx,%rdi
+  800d5f:	48 b8 93 2b 80 00 00 	movabs $0x802b93,%rax
+  800d66:	00 00 00 
+  800d69:	ff d0                	call   *%rax
+  800d6b:	a8 04                	test   $0x4,%al
+  800d6d:	74 14                	je     800d83 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d6f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d78:	5b                   	pop    %rbx
+  800d79:	41 5c                	pop    %r12
+  800d7b:	5d                   	pop    %rbp
+  800d7c:	c3                   	ret
+        return -E_INVAL;
+  800d7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d82:	c3                   	ret
+        return -E_INVAL;
+  800d83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d88:	eb ee                	jmp    800d78 <fd_lookup+0x39>
+
+0000000000800d8a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d8a:	55                   	push   %rbp
+  800d8b:	48 89 e5             	mov    %rsp,%rbp
+  800d8e:	41 54                	push   %r12
+  800d90:	53                   	push   %rbx
+  800d91:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800d94:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800d9b:	00 00 00 
+  800d9e:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800da5:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800da8:	39 3b                	cmp    %edi,(%rbx)
+  800daa:	74 47                	je     800df3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800dac:	48 83 c0 08          	add    $0x8,%rax
+  800db0:	48 8b 18             	mov    (%rax),%rbx
+  800db3:	48 85 db             	test   %rbx,%rbx
+  800db6:	75 f0                	jne    800da8 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800db8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800dbf:	00 00 00 
+  800dc2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800dc8:	89 fa                	mov    %edi,%edx
+  800dca:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  800dd1:	00 00 00 
+  800dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd9:	48 b9 8a 30 80 00 00 	movabs $0x80308a,%rcx
+  800de0:	00 00 00 
+  800de3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800de5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800dea:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800dee:	5b                   	pop    %rbx
+  800def:	41 5c                	pop    %r12
+  800df1:	5d                   	pop    %rbp
+  800df2:	c3                   	ret
+            return 0;
+  800df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df8:	eb f0                	jmp    800dea <dev_lookup+0x60>
+
+0000000000800dfa <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800dfa:	55                   	push   %rbp
+  800dfb:	48 89 e5             	mov    %rsp,%rbp
+  800dfe:	41 55                	push   %r13
+  800e00:	41 54                	push   %r12
+  800e02:	53                   	push   %rbx
+  800e03:	48 83 ec 18          	sub    $0x18,%rsp
+  800e07:	48 89 fb             	mov    %rdi,%rbx
+  800e0a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800e0d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800e14:	ff ff ff 
+  800e17:	48 01 df             	add    %rbx,%rdi
+  800e1a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800e1e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e22:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  800e29:	00 00 00 
+  800e2c:	ff d0                	call   *%rax
+  800e2e:	41 89 c5             	mov    %eax,%r13d
+  800e31:	85 c0                	test   %eax,%eax
+  800e33:	78 06                	js     800e3b <fd_close+0x41>
+  800e35:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e39:	74 1a                	je     800e55 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e3b:	45 84 e4             	test   %r12b,%r12b
+  800e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e43:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e47:	44 89 e8             	mov    %r13d,%eax
+  800e4a:	48 83 c4 18          	add    $0x18,%rsp
+  800e4e:	5b                   	pop    %rbx
+  800e4f:	41 5c                	pop    %r12
+  800e51:	41 5d                	pop    %r13
+  800e53:	5d                   	pop    %rbp
+  800e54:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e55:	8b 3b                	mov    (%rbx),%edi
+  800e57:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e5b:	48 b8 8a 0d 80 00 00 	movabs $0x800d8a,%rax
+  800e62:	00 00 00 
+  800e65:	ff d0                	call   *%rax
+  800e67:	41 89 c5             	mov    %eax,%r13d
+  800e6a:	85 c0                	test   %eax,%eax
+  800e6c:	78 1b                	js     800e89 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e6e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e72:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800e76:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e7c:	48 85 c0             	test   %rax,%rax
+  800e7f:	74 08                	je     800e89 <fd_close+0x8f>
+  800e81:	48 89 df             	mov    %rbx,%rdi
+  800e84:	ff d0                	call   *%rax
+  800e86:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800e89:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e8e:	48 89 de             	mov    %rbx,%rsi
+  800e91:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e96:	48 b8 7a 04 80 00 00 	movabs $0x80047a,%rax
+  800e9d:	00 00 00 
+  800ea0:	ff d0                	call   *%rax
+    return res;
+  800ea2:	eb a3                	jmp    800e47 <fd_close+0x4d>
+
+0000000000800ea4 <close>:
+
+int
+close(int fdnum) {
+  800ea4:	55                   	push   %rbp
+  800ea5:	48 89 e5             	mov    %rsp,%rbp
+  800ea8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800eac:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800eb0:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  800eb7:	00 00 00 
+  800eba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800ebc:	85 c0                	test   %eax,%eax
+  800ebe:	78 15                	js     800ed5 <close+0x31>
+
+    return fd_close(fd, 1);
+  800ec0:	be 01 00 00 00       	mov    $0x1,%esi
+  800ec5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800ec9:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  800ed0:	00 00 00 
+  800ed3:	ff d0                	call   *%rax
+}
+  800ed5:	c9                   	leave
+  800ed6:	c3                   	ret
+
+0000000000800ed7 <close_all>:
+
+void
+close_all(void) {
+  800ed7:	55                   	push   %rbp
+  800ed8:	48 89 e5             	mov    %rsp,%rbp
+  800edb:	41 54                	push   %r12
+  800edd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800ede:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee3:	49 bc a4 0e 80 00 00 	movabs $0x800ea4,%r12
+  800eea:	00 00 00 
+  800eed:	89 df                	mov    %ebx,%edi
+  800eef:	41 ff d4             	call   *%r12
+  800ef2:	83 c3 01             	add    $0x1,%ebx
+  800ef5:	83 fb 20             	cmp    $0x20,%ebx
+  800ef8:	75 f3                	jne    800eed <close_all+0x16>
+}
+  800efa:	5b                   	pop    %rbx
+  800efb:	41 5c                	pop    %r12
+  800efd:	5d                   	pop    %rbp
+  800efe:	c3                   	ret
+
+0000000000800eff <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800eff:	55                   	push   %rbp
+  800f00:	48 89 e5             	mov    %rsp,%rbp
+  800f03:	41 57                	push   %r15
+  800f05:	41 56                	push   %r14
+  800f07:	41 55                	push   %r13
+  800f09:	41 54                	push   %r12
+  800f0b:	53                   	push   %rbx
+  800f0c:	48 83 ec 18          	sub    $0x18,%rsp
+  800f10:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800f13:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800f17:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+  800f23:	89 c3                	mov    %eax,%ebx
+  800f25:	85 c0                	test   %eax,%eax
+  800f27:	0f 88 b8 00 00 00    	js     800fe5 <dup+0xe6>
+    close(newfdnum);
+  800f2d:	44 89 e7             	mov    %r12d,%edi
+  800f30:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  800f37:	00 00 00 
+  800f3a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f3c:	4d 63 ec             	movslq %r12d,%r13
+  800f3f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f46:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f4a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f4e:	4c 89 ff             	mov    %r15,%rdi
+  800f51:	49 be c3 0c 80 00 00 	movabs $0x800cc3,%r14
+  800f58:	00 00 00 
+  800f5b:	41 ff d6             	call   *%r14
+  800f5e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f61:	4c 89 ef             	mov    %r13,%rdi
+  800f64:	41 ff d6             	call   *%r14
+  800f67:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f6a:	48 89 df             	mov    %rbx,%rdi
+  800f6d:	48 b8 93 2b 80 00 00 	movabs $0x802b93,%rax
+  800f74:	00 00 00 
+  800f77:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800f79:	a8 04                	test   $0x4,%al
+  800f7b:	74 2b                	je     800fa8 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800f7d:	41 89 c1             	mov    %eax,%r9d
+  800f80:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f86:	4c 89 f1             	mov    %r14,%rcx
+  800f89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f8e:	48 89 de             	mov    %rbx,%rsi
+  800f91:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f96:	48 b8 02 03 80 00 00 	movabs $0x800302,%rax
+  800f9d:	00 00 00 
+  800fa0:	ff d0                	call   *%rax
+  800fa2:	89 c3                	mov    %eax,%ebx
+  800fa4:	85 c0                	test   %eax,%eax
+  800fa6:	78 4e                	js     800ff6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800fa8:	4c 89 ff             	mov    %r15,%rdi
+  800fab:	48 b8 93 2b 80 00 00 	movabs $0x802b93,%rax
+  800fb2:	00 00 00 
+  800fb5:	ff d0                	call   *%rax
+  800fb7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800fba:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fc0:	4c 89 e9             	mov    %r13,%rcx
+  800fc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc8:	4c 89 fe             	mov    %r15,%rsi
+  800fcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fd0:	48 b8 02 03 80 00 00 	movabs $0x800302,%rax
+  800fd7:	00 00 00 
+  800fda:	ff d0                	call   *%rax
+  800fdc:	89 c3                	mov    %eax,%ebx
+  800fde:	85 c0                	test   %eax,%eax
+  800fe0:	78 14                	js     800ff6 <dup+0xf7>
+
+    return newfdnum;
+  800fe2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800fe5:	89 d8                	mov    %ebx,%eax
+  800fe7:	48 83 c4 18          	add    $0x18,%rsp
+  800feb:	5b                   	pop    %rbx
+  800fec:	41 5c                	pop    %r12
+  800fee:	41 5d                	pop    %r13
+  800ff0:	41 5e                	pop    %r14
+  800ff2:	41 5f                	pop    %r15
+  800ff4:	5d                   	pop    %rbp
+  800ff5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800ff6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ffb:	4c 89 ee             	mov    %r13,%rsi
+  800ffe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801003:	49 bc 7a 04 80 00 00 	movabs $0x80047a,%r12
+  80100a:	00 00 00 
+  80100d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801010:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801015:	4c 89 f6             	mov    %r14,%rsi
+  801018:	bf 00 00 00 00       	mov    $0x0,%edi
+  80101d:	41 ff d4             	call   *%r12
+    return res;
+  801020:	eb c3                	jmp    800fe5 <dup+0xe6>
+
+0000000000801022 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801022:	55                   	push   %rbp
+  801023:	48 89 e5             	mov    %rsp,%rbp
+  801026:	41 56                	push   %r14
+  801028:	41 55                	push   %r13
+  80102a:	41 54                	push   %r12
+  80102c:	53                   	push   %rbx
+  80102d:	48 83 ec 10          	sub    $0x10,%rsp
+  801031:	89 fb                	mov    %edi,%ebx
+  801033:	49 89 f4             	mov    %rsi,%r12
+  801036:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801039:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80103d:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  801044:	00 00 00 
+  801047:	ff d0                	call   *%rax
+  801049:	85 c0                	test   %eax,%eax
+  80104b:	78 4c                	js     801099 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80104d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801051:	41 8b 3e             	mov    (%r14),%edi
+  801054:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801058:	48 b8 8a 0d 80 00 00 	movabs $0x800d8a,%rax
+  80105f:	00 00 00 
+  801062:	ff d0                	call   *%rax
+  801064:	85 c0                	test   %eax,%eax
+  801066:	78 35                	js     80109d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801068:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80106c:	83 e0 03             	and    $0x3,%eax
+  80106f:	83 f8 01             	cmp    $0x1,%eax
+  801072:	74 2d                	je     8010a1 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801074:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801078:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80107c:	48 85 c0             	test   %rax,%rax
+  80107f:	74 56                	je     8010d7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801081:	4c 89 ea             	mov    %r13,%rdx
+  801084:	4c 89 e6             	mov    %r12,%rsi
+  801087:	4c 89 f7             	mov    %r14,%rdi
+  80108a:	ff d0                	call   *%rax
+}
+  80108c:	48 83 c4 10          	add    $0x10,%rsp
+  801090:	5b                   	pop    %rbx
+  801091:	41 5c                	pop    %r12
+  801093:	41 5d                	pop    %r13
+  801095:	41 5e                	pop    %r14
+  801097:	5d                   	pop    %rbp
+  801098:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801099:	48 98                	cltq
+  80109b:	eb ef                	jmp    80108c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80109d:	48 98                	cltq
+  80109f:	eb eb                	jmp    80108c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8010a1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8010a8:	00 00 00 
+  8010ab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8010b1:	89 da                	mov    %ebx,%edx
+  8010b3:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  8010ba:	00 00 00 
+  8010bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c2:	48 b9 8a 30 80 00 00 	movabs $0x80308a,%rcx
+  8010c9:	00 00 00 
+  8010cc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010ce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8010d5:	eb b5                	jmp    80108c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010d7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8010de:	eb ac                	jmp    80108c <read+0x6a>
+
+00000000008010e0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8010e0:	55                   	push   %rbp
+  8010e1:	48 89 e5             	mov    %rsp,%rbp
+  8010e4:	41 57                	push   %r15
+  8010e6:	41 56                	push   %r14
+  8010e8:	41 55                	push   %r13
+  8010ea:	41 54                	push   %r12
+  8010ec:	53                   	push   %rbx
+  8010ed:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8010f1:	48 85 d2             	test   %rdx,%rdx
+  8010f4:	74 54                	je     80114a <readn+0x6a>
+  8010f6:	41 89 fd             	mov    %edi,%r13d
+  8010f9:	49 89 f6             	mov    %rsi,%r14
+  8010fc:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8010ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801104:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801109:	49 bf 22 10 80 00 00 	movabs $0x801022,%r15
+  801110:	00 00 00 
+  801113:	4c 89 e2             	mov    %r12,%rdx
+  801116:	48 29 f2             	sub    %rsi,%rdx
+  801119:	4c 01 f6             	add    %r14,%rsi
+  80111c:	44 89 ef             	mov    %r13d,%edi
+  80111f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801122:	85 c0                	test   %eax,%eax
+  801124:	78 20                	js     801146 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801126:	01 c3                	add    %eax,%ebx
+  801128:	85 c0                	test   %eax,%eax
+  80112a:	74 08                	je     801134 <readn+0x54>
+  80112c:	48 63 f3             	movslq %ebx,%rsi
+  80112f:	4c 39 e6             	cmp    %r12,%rsi
+  801132:	72 df                	jb     801113 <readn+0x33>
+    }
+    return res;
+  801134:	48 63 c3             	movslq %ebx,%rax
+}
+  801137:	48 83 c4 08          	add    $0x8,%rsp
+  80113b:	5b                   	pop    %rbx
+  80113c:	41 5c                	pop    %r12
+  80113e:	41 5d                	pop    %r13
+  801140:	41 5e                	pop    %r14
+  801142:	41 5f                	pop    %r15
+  801144:	5d                   	pop    %rbp
+  801145:	c3                   	ret
+        if (inc < 0) return inc;
+  801146:	48 98                	cltq
+  801148:	eb ed                	jmp    801137 <readn+0x57>
+    int inc = 1, res = 0;
+  80114a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114f:	eb e3                	jmp    801134 <readn+0x54>
+
+0000000000801151 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801151:	55                   	push   %rbp
+  801152:	48 89 e5             	mov    %rsp,%rbp
+  801155:	41 56                	push   %r14
+  801157:	41 55                	push   %r13
+  801159:	41 54                	push   %r12
+  80115b:	53                   	push   %rbx
+  80115c:	48 83 ec 10          	sub    $0x10,%rsp
+  801160:	89 fb                	mov    %edi,%ebx
+  801162:	49 89 f4             	mov    %rsi,%r12
+  801165:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801168:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80116c:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  801173:	00 00 00 
+  801176:	ff d0                	call   *%rax
+  801178:	85 c0                	test   %eax,%eax
+  80117a:	78 47                	js     8011c3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80117c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801180:	41 8b 3e             	mov    (%r14),%edi
+  801183:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801187:	48 b8 8a 0d 80 00 00 	movabs $0x800d8a,%rax
+  80118e:	00 00 00 
+  801191:	ff d0                	call   *%rax
+  801193:	85 c0                	test   %eax,%eax
+  801195:	78 30                	js     8011c7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801197:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80119c:	74 2d                	je     8011cb <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80119e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011a2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8011a6:	48 85 c0             	test   %rax,%rax
+  8011a9:	74 56                	je     801201 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8011ab:	4c 89 ea             	mov    %r13,%rdx
+  8011ae:	4c 89 e6             	mov    %r12,%rsi
+  8011b1:	4c 89 f7             	mov    %r14,%rdi
+  8011b4:	ff d0                	call   *%rax
+}
+  8011b6:	48 83 c4 10          	add    $0x10,%rsp
+  8011ba:	5b                   	pop    %rbx
+  8011bb:	41 5c                	pop    %r12
+  8011bd:	41 5d                	pop    %r13
+  8011bf:	41 5e                	pop    %r14
+  8011c1:	5d                   	pop    %rbp
+  8011c2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011c3:	48 98                	cltq
+  8011c5:	eb ef                	jmp    8011b6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011c7:	48 98                	cltq
+  8011c9:	eb eb                	jmp    8011b6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011cb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8011d2:	00 00 00 
+  8011d5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8011db:	89 da                	mov    %ebx,%edx
+  8011dd:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  8011e4:	00 00 00 
+  8011e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ec:	48 b9 8a 30 80 00 00 	movabs $0x80308a,%rcx
+  8011f3:	00 00 00 
+  8011f6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8011f8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011ff:	eb b5                	jmp    8011b6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801201:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801208:	eb ac                	jmp    8011b6 <write+0x65>
+
+000000000080120a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80120a:	55                   	push   %rbp
+  80120b:	48 89 e5             	mov    %rsp,%rbp
+  80120e:	53                   	push   %rbx
+  80120f:	48 83 ec 18          	sub    $0x18,%rsp
+  801213:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801215:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801219:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  801220:	00 00 00 
+  801223:	ff d0                	call   *%rax
+  801225:	85 c0                	test   %eax,%eax
+  801227:	78 0c                	js     801235 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801229:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80122d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801230:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801235:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801239:	c9                   	leave
+  80123a:	c3                   	ret
+
+000000000080123b <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80123b:	55                   	push   %rbp
+  80123c:	48 89 e5             	mov    %rsp,%rbp
+  80123f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801243:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801247:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  80124e:	00 00 00 
+  801251:	ff d0                	call   *%rax
+  801253:	85 c0                	test   %eax,%eax
+  801255:	78 07                	js     80125e <tell+0x23>
+    return fdes->fd_offset;
+  801257:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80125b:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80125e:	c9                   	leave
+  80125f:	c3                   	ret
+
+0000000000801260 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801260:	55                   	push   %rbp
+  801261:	48 89 e5             	mov    %rsp,%rbp
+  801264:	41 55                	push   %r13
+  801266:	41 54                	push   %r12
+  801268:	53                   	push   %rbx
+  801269:	48 83 ec 18          	sub    $0x18,%rsp
+  80126d:	89 fb                	mov    %edi,%ebx
+  80126f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801272:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801276:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  80127d:	00 00 00 
+  801280:	ff d0                	call   *%rax
+  801282:	85 c0                	test   %eax,%eax
+  801284:	78 38                	js     8012be <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801286:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80128a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80128e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801292:	48 b8 8a 0d 80 00 00 	movabs $0x800d8a,%rax
+  801299:	00 00 00 
+  80129c:	ff d0                	call   *%rax
+  80129e:	85 c0                	test   %eax,%eax
+  8012a0:	78 1c                	js     8012be <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012a2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8012a7:	74 20                	je     8012c9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8012ad:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8012b1:	48 85 c0             	test   %rax,%rax
+  8012b4:	74 47                	je     8012fd <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8012b6:	44 89 e6             	mov    %r12d,%esi
+  8012b9:	4c 89 ef             	mov    %r13,%rdi
+  8012bc:	ff d0                	call   *%rax
+}
+  8012be:	48 83 c4 18          	add    $0x18,%rsp
+  8012c2:	5b                   	pop    %rbx
+  8012c3:	41 5c                	pop    %r12
+  8012c5:	41 5d                	pop    %r13
+  8012c7:	5d                   	pop    %rbp
+  8012c8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8012c9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8012d0:	00 00 00 
+  8012d3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012d9:	89 da                	mov    %ebx,%edx
+  8012db:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  8012e2:	00 00 00 
+  8012e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ea:	48 b9 8a 30 80 00 00 	movabs $0x80308a,%rcx
+  8012f1:	00 00 00 
+  8012f4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8012f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012fb:	eb c1                	jmp    8012be <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012fd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801302:	eb ba                	jmp    8012be <ftruncate+0x5e>
+
+0000000000801304 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801304:	55                   	push   %rbp
+  801305:	48 89 e5             	mov    %rsp,%rbp
+  801308:	41 54                	push   %r12
+  80130a:	53                   	push   %rbx
+  80130b:	48 83 ec 10          	sub    $0x10,%rsp
+  80130f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801312:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801316:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  80131d:	00 00 00 
+  801320:	ff d0                	call   *%rax
+  801322:	85 c0                	test   %eax,%eax
+  801324:	78 4e                	js     801374 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801326:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80132a:	41 8b 3c 24          	mov    (%r12),%edi
+  80132e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801332:	48 b8 8a 0d 80 00 00 	movabs $0x800d8a,%rax
+  801339:	00 00 00 
+  80133c:	ff d0                	call   *%rax
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	78 32                	js     801374 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801342:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801346:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80134b:	74 30                	je     80137d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80134d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801350:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801357:	00 00 00 
+    stat->st_isdir = 0;
+  80135a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801361:	00 00 00 
+    stat->st_dev = dev;
+  801364:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80136b:	48 89 de             	mov    %rbx,%rsi
+  80136e:	4c 89 e7             	mov    %r12,%rdi
+  801371:	ff 50 28             	call   *0x28(%rax)
+}
+  801374:	48 83 c4 10          	add    $0x10,%rsp
+  801378:	5b                   	pop    %rbx
+  801379:	41 5c                	pop    %r12
+  80137b:	5d                   	pop    %rbp
+  80137c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80137d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801382:	eb f0                	jmp    801374 <fstat+0x70>
+
+0000000000801384 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+  801388:	41 54                	push   %r12
+  80138a:	53                   	push   %rbx
+  80138b:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  801392:	41 89 fc             	mov    %edi,%r12d
+  801395:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801397:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80139b:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  8013a2:	00 00 00 
+  8013a5:	ff d0                	call   *%rax
+  8013a7:	85 c0                	test   %eax,%eax
+  8013a9:	78 31                	js     8013dc <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8013ab:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8013b2:	44 89 e7             	mov    %r12d,%edi
+  8013b5:	48 b8 04 13 80 00 00 	movabs $0x801304,%rax
+  8013bc:	00 00 00 
+  8013bf:	ff d0                	call   *%rax
+  8013c1:	85 c0                	test   %eax,%eax
+  8013c3:	78 17                	js     8013dc <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8013c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c9:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8013cc:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8013cf:	39 d3                	cmp    %edx,%ebx
+  8013d1:	0f 4f da             	cmovg  %edx,%ebx
+  8013d4:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8013d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013dc:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8013e3:	5b                   	pop    %rbx
+  8013e4:	41 5c                	pop    %r12
+  8013e6:	5d                   	pop    %rbp
+  8013e7:	c3                   	ret
+
+00000000008013e8 <seektoend>:
+{
+  8013e8:	55                   	push   %rbp
+  8013e9:	48 89 e5             	mov    %rsp,%rbp
+  8013ec:	53                   	push   %rbx
+  8013ed:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8013f4:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8013f6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013fa:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  801401:	00 00 00 
+  801404:	ff d0                	call   *%rax
+  801406:	85 c0                	test   %eax,%eax
+  801408:	78 28                	js     801432 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80140a:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801411:	89 df                	mov    %ebx,%edi
+  801413:	48 b8 04 13 80 00 00 	movabs $0x801304,%rax
+  80141a:	00 00 00 
+  80141d:	ff d0                	call   *%rax
+  80141f:	85 c0                	test   %eax,%eax
+  801421:	78 0f                	js     801432 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  801423:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801426:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80142a:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80142d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801432:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801436:	c9                   	leave
+  801437:	c3                   	ret
+
+0000000000801438 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801438:	55                   	push   %rbp
+  801439:	48 89 e5             	mov    %rsp,%rbp
+  80143c:	41 54                	push   %r12
+  80143e:	53                   	push   %rbx
+  80143f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801442:	be 00 00 00 00       	mov    $0x0,%esi
+  801447:	48 b8 2b 20 80 00 00 	movabs $0x80202b,%rax
+  80144e:	00 00 00 
+  801451:	ff d0                	call   *%rax
+  801453:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801455:	85 c0                	test   %eax,%eax
+  801457:	78 25                	js     80147e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801459:	4c 89 e6             	mov    %r12,%rsi
+  80145c:	89 c7                	mov    %eax,%edi
+  80145e:	48 b8 04 13 80 00 00 	movabs $0x801304,%rax
+  801465:	00 00 00 
+  801468:	ff d0                	call   *%rax
+  80146a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80146d:	89 df                	mov    %ebx,%edi
+  80146f:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  801476:	00 00 00 
+  801479:	ff d0                	call   *%rax
+
+    return res;
+  80147b:	44 89 e3             	mov    %r12d,%ebx
+}
+  80147e:	89 d8                	mov    %ebx,%eax
+  801480:	5b                   	pop    %rbx
+  801481:	41 5c                	pop    %r12
+  801483:	5d                   	pop    %rbp
+  801484:	c3                   	ret
+
+0000000000801485 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  801485:	55                   	push   %rbp
+  801486:	48 89 e5             	mov    %rsp,%rbp
+  801489:	53                   	push   %rbx
+  80148a:	48 83 ec 08          	sub    $0x8,%rsp
+  80148e:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801491:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  801498:	00 00 00 
+  80149b:	ff d0                	call   *%rax
+  80149d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8014a1:	0f 87 ea 00 00 00    	ja     801591 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8014a7:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014ae:	00 00 00 
+  8014b1:	80 38 00             	cmpb   $0x0,(%rax)
+  8014b4:	75 35                	jne    8014eb <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8014b6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014bb:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8014c0:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8014c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ca:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  8014d1:	00 00 00 
+  8014d4:	ff d0                	call   *%rax
+  8014d6:	85 c0                	test   %eax,%eax
+  8014d8:	0f 88 ba 00 00 00    	js     801598 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8014de:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014e5:	00 00 00 
+  8014e8:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8014eb:	48 89 df             	mov    %rbx,%rdi
+  8014ee:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8014f5:	00 00 00 
+  8014f8:	ff d0                	call   *%rax
+  8014fa:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8014fe:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  801505:	00 00 00 
+  801508:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80150c:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  80150f:	39 39                	cmp    %edi,(%rcx)
+  801511:	74 46                	je     801559 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  801513:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  801517:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  80151e:	00 
+  80151f:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  801526:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  80152d:	00 
+  80152e:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  801535:	00 
+  801536:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  80153d:	00 
+  80153e:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  801545:	00 
+  801546:	89 39                	mov    %edi,(%rcx)
+  801548:	48 01 c6             	add    %rax,%rsi
+  80154b:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  801550:	48 89 c8             	mov    %rcx,%rax
+  801553:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801557:	c9                   	leave
+  801558:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  801559:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80155d:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  801564:	00 00 00 
+  801567:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80156a:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80156e:	74 e0                	je     801550 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  801570:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  801577:	00 
+  801578:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80157c:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  801583:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  801585:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801588:	48 01 c2             	add    %rax,%rdx
+  80158b:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80158f:	eb bf                	jmp    801550 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801591:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801596:	eb b8                	jmp    801550 <fbuf_get+0xcb>
+            return NULL;
+  801598:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80159d:	eb b1                	jmp    801550 <fbuf_get+0xcb>
+
+000000000080159f <fsipc_bulk>:
+fsipc_bulk(void) {
+  80159f:	55                   	push   %rbp
+  8015a0:	48 89 e5             	mov    %rsp,%rbp
+  8015a3:	53                   	push   %rbx
+  8015a4:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8015a8:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015af:	00 00 00 
+  8015b2:	48 8b 18             	mov    (%rax),%rbx
+  8015b5:	48 85 db             	test   %rbx,%rbx
+  8015b8:	74 16                	je     8015d0 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8015ba:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015c1:	00 00 00 
+  8015c4:	48 8b 18             	mov    (%rax),%rbx
+}
+  8015c7:	48 89 d8             	mov    %rbx,%rax
+  8015ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ce:	c9                   	leave
+  8015cf:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8015d0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015d5:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8015da:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8015df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e4:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  8015eb:	00 00 00 
+  8015ee:	ff d0                	call   *%rax
+  8015f0:	85 c0                	test   %eax,%eax
+  8015f2:	78 d3                	js     8015c7 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8015f4:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8015f9:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  801600:	00 00 00 
+  801603:	eb b5                	jmp    8015ba <fsipc_bulk+0x1b>
+
+0000000000801605 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  801605:	55                   	push   %rbp
+  801606:	48 89 e5             	mov    %rsp,%rbp
+  801609:	41 57                	push   %r15
+  80160b:	41 56                	push   %r14
+  80160d:	41 55                	push   %r13
+  80160f:	41 54                	push   %r12
+  801611:	53                   	push   %rbx
+  801612:	48 83 ec 08          	sub    $0x8,%rsp
+  801616:	41 89 fd             	mov    %edi,%r13d
+  801619:	49 89 f6             	mov    %rsi,%r14
+  80161c:	49 89 d7             	mov    %rdx,%r15
+  80161f:	48 89 cb             	mov    %rcx,%rbx
+  801622:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801625:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80162c:	00 00 00 
+  80162f:	83 38 00             	cmpl   $0x0,(%rax)
+  801632:	74 52                	je     801686 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  801634:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80163a:	4c 89 f9             	mov    %r15,%rcx
+  80163d:	4c 89 f2             	mov    %r14,%rdx
+  801640:	44 89 ee             	mov    %r13d,%esi
+  801643:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80164a:	00 00 00 
+  80164d:	8b 38                	mov    (%rax),%edi
+  80164f:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  801656:	00 00 00 
+  801659:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80165b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801660:	4c 89 e2             	mov    %r12,%rdx
+  801663:	48 89 de             	mov    %rbx,%rsi
+  801666:	bf 00 00 00 00       	mov    $0x0,%edi
+  80166b:	48 b8 d9 3f 80 00 00 	movabs $0x803fd9,%rax
+  801672:	00 00 00 
+  801675:	ff d0                	call   *%rax
+}
+  801677:	48 83 c4 08          	add    $0x8,%rsp
+  80167b:	5b                   	pop    %rbx
+  80167c:	41 5c                	pop    %r12
+  80167e:	41 5d                	pop    %r13
+  801680:	41 5e                	pop    %r14
+  801682:	41 5f                	pop    %r15
+  801684:	5d                   	pop    %rbp
+  801685:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801686:	bf 03 00 00 00       	mov    $0x3,%edi
+  80168b:	48 b8 2c 42 80 00 00 	movabs $0x80422c,%rax
+  801692:	00 00 00 
+  801695:	ff d0                	call   *%rax
+  801697:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80169e:	00 00 
+  8016a0:	eb 92                	jmp    801634 <fsipc_region+0x2f>
+
+00000000008016a2 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8016a2:	55                   	push   %rbp
+  8016a3:	48 89 e5             	mov    %rsp,%rbp
+  8016a6:	41 57                	push   %r15
+  8016a8:	41 56                	push   %r14
+  8016aa:	41 55                	push   %r13
+  8016ac:	41 54                	push   %r12
+  8016ae:	53                   	push   %rbx
+  8016af:	48 83 ec 28          	sub    $0x28,%rsp
+  8016b3:	49 89 ff             	mov    %rdi,%r15
+  8016b6:	49 89 f6             	mov    %rsi,%r14
+  8016b9:	48 89 d3             	mov    %rdx,%rbx
+  8016bc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016c0:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8016c3:	48 b8 9f 15 80 00 00 	movabs $0x80159f,%rax
+  8016ca:	00 00 00 
+  8016cd:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8016cf:	48 85 c0             	test   %rax,%rax
+  8016d2:	0f 84 cc 00 00 00    	je     8017a4 <devfile_write_direct+0x102>
+  8016d8:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8016db:	48 85 db             	test   %rbx,%rbx
+  8016de:	0f 84 ba 00 00 00    	je     80179e <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8016e4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016ea:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8016f1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8016f5:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8016f9:	4c 29 e3             	sub    %r12,%rbx
+  8016fc:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801701:	48 39 c3             	cmp    %rax,%rbx
+  801704:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  801708:	48 89 da             	mov    %rbx,%rdx
+  80170b:	4c 89 f6             	mov    %r14,%rsi
+  80170e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801712:	48 b8 f7 3d 80 00 00 	movabs $0x803df7,%rax
+  801719:	00 00 00 
+  80171c:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  80171e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801722:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  801726:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801729:	44 01 e0             	add    %r12d,%eax
+  80172c:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  801730:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  801734:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80173b:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801742:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  801749:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80174f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801754:	4c 89 ee             	mov    %r13,%rsi
+  801757:	bf 04 00 00 00       	mov    $0x4,%edi
+  80175c:	48 b8 05 16 80 00 00 	movabs $0x801605,%rax
+  801763:	00 00 00 
+  801766:	ff d0                	call   *%rax
+        if (res < 0)
+  801768:	85 c0                	test   %eax,%eax
+  80176a:	78 29                	js     801795 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80176c:	74 2b                	je     801799 <devfile_write_direct+0xf7>
+        i += res;
+  80176e:	48 98                	cltq
+  801770:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  801773:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  801776:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80177a:	49 39 c4             	cmp    %rax,%r12
+  80177d:	0f 82 72 ff ff ff    	jb     8016f5 <devfile_write_direct+0x53>
+    return i;
+  801783:	4c 89 e0             	mov    %r12,%rax
+}
+  801786:	48 83 c4 28          	add    $0x28,%rsp
+  80178a:	5b                   	pop    %rbx
+  80178b:	41 5c                	pop    %r12
+  80178d:	41 5d                	pop    %r13
+  80178f:	41 5e                	pop    %r14
+  801791:	41 5f                	pop    %r15
+  801793:	5d                   	pop    %rbp
+  801794:	c3                   	ret
+            return res;
+  801795:	48 98                	cltq
+  801797:	eb ed                	jmp    801786 <devfile_write_direct+0xe4>
+            return i;
+  801799:	4c 89 e0             	mov    %r12,%rax
+  80179c:	eb e8                	jmp    801786 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80179e:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8017a2:	eb df                	jmp    801783 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8017a4:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8017ab:	eb d9                	jmp    801786 <devfile_write_direct+0xe4>
+
+00000000008017ad <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8017ad:	55                   	push   %rbp
+  8017ae:	48 89 e5             	mov    %rsp,%rbp
+  8017b1:	41 56                	push   %r14
+  8017b3:	41 55                	push   %r13
+  8017b5:	41 54                	push   %r12
+  8017b7:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8017b8:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8017bc:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8017c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c5:	4d 39 ee             	cmp    %r13,%r14
+  8017c8:	0f 84 99 00 00 00    	je     801867 <fbuf_flush+0xba>
+  8017ce:	49 89 fc             	mov    %rdi,%r12
+  8017d1:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8017d4:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017d7:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8017db:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8017e2:	00 00 00 
+  8017e5:	ff d0                	call   *%rax
+  8017e7:	48 89 c2             	mov    %rax,%rdx
+  8017ea:	48 c1 e2 04          	shl    $0x4,%rdx
+  8017ee:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8017f2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8017f6:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8017fb:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017fe:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801802:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801809:	00 
+  80180a:	44 89 f1             	mov    %r14d,%ecx
+  80180d:	4c 89 ea             	mov    %r13,%rdx
+  801810:	4c 89 e7             	mov    %r12,%rdi
+  801813:	48 b8 a2 16 80 00 00 	movabs $0x8016a2,%rax
+  80181a:	00 00 00 
+  80181d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80181f:	48 85 c0             	test   %rax,%rax
+  801822:	78 43                	js     801867 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  801824:	4c 39 e8             	cmp    %r13,%rax
+  801827:	72 47                	jb     801870 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  801829:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80182e:	83 c0 01             	add    $0x1,%eax
+  801831:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801836:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  801839:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80183d:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  801841:	72 0f                	jb     801852 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  801843:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  801847:	48 39 c2             	cmp    %rax,%rdx
+  80184a:	48 0f 42 d0          	cmovb  %rax,%rdx
+  80184e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  801852:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  801859:	00 
+  80185a:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  801861:	00 
+    return 0;
+  801862:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801867:	5b                   	pop    %rbx
+  801868:	41 5c                	pop    %r12
+  80186a:	41 5d                	pop    %r13
+  80186c:	41 5e                	pop    %r14
+  80186e:	5d                   	pop    %rbp
+  80186f:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  801870:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801875:	eb f0                	jmp    801867 <fbuf_flush+0xba>
+
+0000000000801877 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  801877:	55                   	push   %rbp
+  801878:	48 89 e5             	mov    %rsp,%rbp
+  80187b:	53                   	push   %rbx
+  80187c:	48 83 ec 08          	sub    $0x8,%rsp
+  801880:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  801883:	48 b8 85 14 80 00 00 	movabs $0x801485,%rax
+  80188a:	00 00 00 
+  80188d:	ff d0                	call   *%rax
+  80188f:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  801892:	b8 00 00 00 00       	mov    $0x0,%eax
+  801897:	48 85 f6             	test   %rsi,%rsi
+  80189a:	74 0f                	je     8018ab <devfile_sync+0x34>
+  80189c:	48 89 df             	mov    %rbx,%rdi
+  80189f:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  8018a6:	00 00 00 
+  8018a9:	ff d0                	call   *%rax
+}
+  8018ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018af:	c9                   	leave
+  8018b0:	c3                   	ret
+
+00000000008018b1 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8018b1:	55                   	push   %rbp
+  8018b2:	48 89 e5             	mov    %rsp,%rbp
+  8018b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8018b9:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8018bc:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8018c3:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8018c4:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8018c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018cd:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8018d4:	00 00 00 
+  8018d7:	48 b8 05 16 80 00 00 	movabs $0x801605,%rax
+  8018de:	00 00 00 
+  8018e1:	ff d0                	call   *%rax
+}
+  8018e3:	c9                   	leave
+  8018e4:	c3                   	ret
+
+00000000008018e5 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018e5:	55                   	push   %rbp
+  8018e6:	48 89 e5             	mov    %rsp,%rbp
+  8018e9:	41 54                	push   %r12
+  8018eb:	53                   	push   %rbx
+  8018ec:	48 89 fb             	mov    %rdi,%rbx
+  8018ef:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8018f2:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  8018f9:	00 00 00 
+  8018fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018fe:	85 c0                	test   %eax,%eax
+  801900:	78 63                	js     801965 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801902:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801905:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80190c:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  80190e:	be 00 00 00 00       	mov    $0x0,%esi
+  801913:	bf 05 00 00 00       	mov    $0x5,%edi
+  801918:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  80191f:	00 00 00 
+  801922:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801924:	85 c0                	test   %eax,%eax
+  801926:	78 3d                	js     801965 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801928:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80192f:	00 00 00 
+  801932:	48 89 de             	mov    %rbx,%rsi
+  801935:	4c 89 e7             	mov    %r12,%rdi
+  801938:	48 b8 02 3a 80 00 00 	movabs $0x803a02,%rax
+  80193f:	00 00 00 
+  801942:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801944:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80194a:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  801951:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801952:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  801958:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  80195f:	00 
+
+    return 0;
+  801960:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801965:	5b                   	pop    %rbx
+  801966:	41 5c                	pop    %r12
+  801968:	5d                   	pop    %rbp
+  801969:	c3                   	ret
+
+000000000080196a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80196a:	55                   	push   %rbp
+  80196b:	48 89 e5             	mov    %rsp,%rbp
+  80196e:	41 54                	push   %r12
+  801970:	53                   	push   %rbx
+  801971:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  801974:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  80197b:	00 00 00 
+  80197e:	ff d0                	call   *%rax
+  801980:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  801983:	48 89 df             	mov    %rbx,%rdi
+  801986:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  80198d:	00 00 00 
+  801990:	ff d0                	call   *%rax
+  801992:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801996:	76 2e                	jbe    8019c6 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  801998:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80199b:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8019a2:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8019a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019ae:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  8019b5:	00 00 00 
+  8019b8:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019ba:	45 85 e4             	test   %r12d,%r12d
+  8019bd:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019c1:	5b                   	pop    %rbx
+  8019c2:	41 5c                	pop    %r12
+  8019c4:	5d                   	pop    %rbp
+  8019c5:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8019c6:	48 89 df             	mov    %rbx,%rdi
+  8019c9:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8019d0:	00 00 00 
+  8019d3:	ff d0                	call   *%rax
+  8019d5:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8019d9:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8019e0:	00 00 00 
+  8019e3:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8019ea:	48 89 df             	mov    %rbx,%rdi
+  8019ed:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  8019f4:	00 00 00 
+  8019f7:	ff d0                	call   *%rax
+  8019f9:	48 89 c6             	mov    %rax,%rsi
+  8019fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a01:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a06:	48 b8 7a 04 80 00 00 	movabs $0x80047a,%rax
+  801a0d:	00 00 00 
+  801a10:	ff d0                	call   *%rax
+  801a12:	eb 84                	jmp    801998 <devfile_flush+0x2e>
+
+0000000000801a14 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801a14:	55                   	push   %rbp
+  801a15:	48 89 e5             	mov    %rsp,%rbp
+  801a18:	41 55                	push   %r13
+  801a1a:	41 54                	push   %r12
+  801a1c:	53                   	push   %rbx
+  801a1d:	48 83 ec 08          	sub    $0x8,%rsp
+  801a21:	48 89 fb             	mov    %rdi,%rbx
+  801a24:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a27:	48 b8 85 14 80 00 00 	movabs $0x801485,%rax
+  801a2e:	00 00 00 
+  801a31:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a33:	48 85 c0             	test   %rax,%rax
+  801a36:	74 51                	je     801a89 <devfile_trunc+0x75>
+  801a38:	49 89 c4             	mov    %rax,%r12
+  801a3b:	48 89 c6             	mov    %rax,%rsi
+  801a3e:	48 89 df             	mov    %rbx,%rdi
+  801a41:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  801a48:	00 00 00 
+  801a4b:	ff d0                	call   *%rax
+  801a4d:	85 c0                	test   %eax,%eax
+  801a4f:	78 2d                	js     801a7e <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a51:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a58:	00 00 00 
+  801a5b:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a5e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a60:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a64:	be 00 00 00 00       	mov    $0x0,%esi
+  801a69:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a6e:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  801a75:	00 00 00 
+  801a78:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	79 3e                	jns    801abc <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801a7e:	48 83 c4 08          	add    $0x8,%rsp
+  801a82:	5b                   	pop    %rbx
+  801a83:	41 5c                	pop    %r12
+  801a85:	41 5d                	pop    %r13
+  801a87:	5d                   	pop    %rbp
+  801a88:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a89:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a90:	00 00 00 
+  801a93:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a96:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a98:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a9c:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa1:	bf 02 00 00 00       	mov    $0x2,%edi
+  801aa6:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  801aad:	00 00 00 
+  801ab0:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801ab2:	85 c0                	test   %eax,%eax
+  801ab4:	78 c8                	js     801a7e <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801ab6:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801aba:	eb c2                	jmp    801a7e <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801abc:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801abf:	8d 51 01             	lea    0x1(%rcx),%edx
+  801ac2:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801ac5:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801aca:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801ad1:	00 00 
+  801ad3:	eb a9                	jmp    801a7e <devfile_trunc+0x6a>
+
+0000000000801ad5 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801ad5:	55                   	push   %rbp
+  801ad6:	48 89 e5             	mov    %rsp,%rbp
+  801ad9:	41 57                	push   %r15
+  801adb:	41 56                	push   %r14
+  801add:	41 55                	push   %r13
+  801adf:	41 54                	push   %r12
+  801ae1:	53                   	push   %rbx
+  801ae2:	48 83 ec 28          	sub    $0x28,%rsp
+  801ae6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801aea:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801aee:	49 89 d7             	mov    %rdx,%r15
+  801af1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801af5:	48 b8 85 14 80 00 00 	movabs $0x801485,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+  801b01:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801b04:	48 85 c0             	test   %rax,%rax
+  801b07:	74 31                	je     801b3a <devfile_write+0x65>
+  801b09:	4c 89 f8             	mov    %r15,%rax
+  801b0c:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801b13:	77 25                	ja     801b3a <devfile_write+0x65>
+    size_t i = 0;
+  801b15:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801b1b:	48 85 c0             	test   %rax,%rax
+  801b1e:	0f 85 64 01 00 00    	jne    801c88 <devfile_write+0x1b3>
+    size_t i = 0;
+  801b24:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b28:	4c 89 f8             	mov    %r15,%rax
+}
+  801b2b:	48 83 c4 28          	add    $0x28,%rsp
+  801b2f:	5b                   	pop    %rbx
+  801b30:	41 5c                	pop    %r12
+  801b32:	41 5d                	pop    %r13
+  801b34:	41 5e                	pop    %r14
+  801b36:	41 5f                	pop    %r15
+  801b38:	5d                   	pop    %rbp
+  801b39:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b3a:	48 85 db             	test   %rbx,%rbx
+  801b3d:	74 5b                	je     801b9a <devfile_write+0xc5>
+  801b3f:	48 89 de             	mov    %rbx,%rsi
+  801b42:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b46:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  801b4d:	00 00 00 
+  801b50:	ff d0                	call   *%rax
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	78 40                	js     801b96 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b56:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b5a:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801b5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b61:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b65:	48 b8 a2 16 80 00 00 	movabs $0x8016a2,%rax
+  801b6c:	00 00 00 
+  801b6f:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b71:	48 85 c0             	test   %rax,%rax
+  801b74:	7e b5                	jle    801b2b <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801b76:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801b7a:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801b7d:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801b80:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801b83:	8d 51 01             	lea    0x1(%rcx),%edx
+  801b86:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b89:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801b8c:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801b93:	00 
+  801b94:	eb 95                	jmp    801b2b <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b96:	48 98                	cltq
+  801b98:	eb 91                	jmp    801b2b <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b9a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801b9e:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801ba1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba5:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801ba9:	48 89 df             	mov    %rbx,%rdi
+  801bac:	48 b8 a2 16 80 00 00 	movabs $0x8016a2,%rax
+  801bb3:	00 00 00 
+  801bb6:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801bb8:	48 85 c0             	test   %rax,%rax
+  801bbb:	0f 8e 6a ff ff ff    	jle    801b2b <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801bc1:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801bc4:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801bc8:	e9 5e ff ff ff       	jmp    801b2b <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bcd:	48 98                	cltq
+  801bcf:	4d 85 ff             	test   %r15,%r15
+  801bd2:	49 0f 45 c7          	cmovne %r15,%rax
+  801bd6:	e9 50 ff ff ff       	jmp    801b2b <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bdb:	48 89 de             	mov    %rbx,%rsi
+  801bde:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801be2:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  801be9:	00 00 00 
+  801bec:	ff d0                	call   *%rax
+  801bee:	85 c0                	test   %eax,%eax
+  801bf0:	0f 88 2b 01 00 00    	js     801d21 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801bf6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801bfa:	4c 01 f8             	add    %r15,%rax
+  801bfd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801c01:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c05:	48 b9 b1 0c 80 00 00 	movabs $0x800cb1,%rcx
+  801c0c:	00 00 00 
+  801c0f:	ff d1                	call   *%rcx
+  801c11:	48 89 c2             	mov    %rax,%rdx
+  801c14:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c18:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801c1c:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c20:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c25:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c28:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c2f:	00 
+  801c30:	4c 89 ea             	mov    %r13,%rdx
+  801c33:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c37:	48 b8 f7 3d 80 00 00 	movabs $0x803df7,%rax
+  801c3e:	00 00 00 
+  801c41:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c43:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c47:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801c4b:	48 39 c2             	cmp    %rax,%rdx
+  801c4e:	0f 84 db 00 00 00    	je     801d2f <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801c54:	4c 39 e2             	cmp    %r12,%rdx
+  801c57:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801c5b:	4d 01 ec             	add    %r13,%r12
+  801c5e:	49 39 c4             	cmp    %rax,%r12
+  801c61:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801c65:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801c69:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801c6d:	45 01 ee             	add    %r13d,%r14d
+  801c70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c74:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801c78:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801c7b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c7f:	49 39 c7             	cmp    %rax,%r15
+  801c82:	0f 83 a0 fe ff ff    	jae    801b28 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801c88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c8c:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801c90:	8b 43 08             	mov    0x8(%rbx),%eax
+  801c93:	44 39 f0             	cmp    %r14d,%eax
+  801c96:	7f 10                	jg     801ca8 <devfile_write+0x1d3>
+  801c98:	48 98                	cltq
+  801c9a:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801ca0:	49 63 d6             	movslq %r14d,%rdx
+  801ca3:	48 39 d0             	cmp    %rdx,%rax
+  801ca6:	7d 2d                	jge    801cd5 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801ca8:	48 89 de             	mov    %rbx,%rsi
+  801cab:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801caf:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  801cb6:	00 00 00 
+  801cb9:	ff d0                	call   *%rax
+  801cbb:	85 c0                	test   %eax,%eax
+  801cbd:	0f 88 0a ff ff ff    	js     801bcd <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801cc3:	44 89 f0             	mov    %r14d,%eax
+  801cc6:	66 b8 00 00          	mov    $0x0,%ax
+  801cca:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801ccd:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801cd4:	00 
+        size_t off = pos - fb->fb_base;
+  801cd5:	45 89 f4             	mov    %r14d,%r12d
+  801cd8:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801cdc:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801cdf:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801ce3:	4d 29 fd             	sub    %r15,%r13
+  801ce6:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801ceb:	4c 29 e0             	sub    %r12,%rax
+  801cee:	49 39 c5             	cmp    %rax,%r13
+  801cf1:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801cf5:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801cf9:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801cfd:	48 39 c2             	cmp    %rax,%rdx
+  801d00:	0f 84 f0 fe ff ff    	je     801bf6 <devfile_write+0x121>
+  801d06:	4c 39 e0             	cmp    %r12,%rax
+  801d09:	0f 82 cc fe ff ff    	jb     801bdb <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801d0f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d13:	48 39 d0             	cmp    %rdx,%rax
+  801d16:	0f 83 da fe ff ff    	jae    801bf6 <devfile_write+0x121>
+  801d1c:	e9 ba fe ff ff       	jmp    801bdb <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d21:	48 98                	cltq
+  801d23:	4d 85 ff             	test   %r15,%r15
+  801d26:	49 0f 45 c7          	cmovne %r15,%rax
+  801d2a:	e9 fc fd ff ff       	jmp    801b2b <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d2f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d33:	4c 89 e2             	mov    %r12,%rdx
+  801d36:	e9 2a ff ff ff       	jmp    801c65 <devfile_write+0x190>
+
+0000000000801d3b <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d3b:	55                   	push   %rbp
+  801d3c:	48 89 e5             	mov    %rsp,%rbp
+  801d3f:	41 57                	push   %r15
+  801d41:	41 56                	push   %r14
+  801d43:	41 55                	push   %r13
+  801d45:	41 54                	push   %r12
+  801d47:	53                   	push   %rbx
+  801d48:	48 83 ec 28          	sub    $0x28,%rsp
+  801d4c:	49 89 ff             	mov    %rdi,%r15
+  801d4f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801d53:	48 89 d3             	mov    %rdx,%rbx
+  801d56:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801d5a:	48 b8 85 14 80 00 00 	movabs $0x801485,%rax
+  801d61:	00 00 00 
+  801d64:	ff d0                	call   *%rax
+  801d66:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801d69:	48 85 c0             	test   %rax,%rax
+  801d6c:	74 0d                	je     801d7b <devfile_read+0x40>
+  801d6e:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801d75:	0f 86 1a 01 00 00    	jbe    801e95 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801d7b:	4d 85 e4             	test   %r12,%r12
+  801d7e:	74 1a                	je     801d9a <devfile_read+0x5f>
+  801d80:	4c 89 e6             	mov    %r12,%rsi
+  801d83:	4c 89 ff             	mov    %r15,%rdi
+  801d86:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  801d8d:	00 00 00 
+  801d90:	ff d0                	call   *%rax
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	0f 88 e8 00 00 00    	js     801e82 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801d9a:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801d9e:	48 b8 9f 15 80 00 00 	movabs $0x80159f,%rax
+  801da5:	00 00 00 
+  801da8:	ff d0                	call   *%rax
+  801daa:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801dad:	48 85 c0             	test   %rax,%rax
+  801db0:	0f 84 69 02 00 00    	je     80201f <devfile_read+0x2e4>
+    while (i < n) {
+  801db6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801dbb:	0f 84 ce 00 00 00    	je     801e8f <devfile_read+0x154>
+    size_t i = 0;
+  801dc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801dc6:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801dcd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dd1:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801dd5:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801dd9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ddd:	48 29 da             	sub    %rbx,%rdx
+  801de0:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801de5:	48 39 c2             	cmp    %rax,%rdx
+  801de8:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801dec:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801df0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801df4:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801df7:	01 d8                	add    %ebx,%eax
+  801df9:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801dfd:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801e01:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801e08:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801e0f:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801e16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e21:	4c 89 ee             	mov    %r13,%rsi
+  801e24:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e29:	48 b8 05 16 80 00 00 	movabs $0x801605,%rax
+  801e30:	00 00 00 
+  801e33:	ff d0                	call   *%rax
+        if (res < 0)
+  801e35:	85 c0                	test   %eax,%eax
+  801e37:	78 4d                	js     801e86 <devfile_read+0x14b>
+        if (res == 0)
+  801e39:	74 4f                	je     801e8a <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e3b:	4c 63 e0             	movslq %eax,%r12
+  801e3e:	4c 89 e2             	mov    %r12,%rdx
+  801e41:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e45:	4c 89 f7             	mov    %r14,%rdi
+  801e48:	48 b8 f7 3d 80 00 00 	movabs $0x803df7,%rax
+  801e4f:	00 00 00 
+  801e52:	ff d0                	call   *%rax
+        i += res;
+  801e54:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801e57:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801e5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e5e:	48 39 c3             	cmp    %rax,%rbx
+  801e61:	0f 82 72 ff ff ff    	jb     801dd9 <devfile_read+0x9e>
+    return i;
+  801e67:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801e6a:	48 85 c0             	test   %rax,%rax
+  801e6d:	7e 04                	jle    801e73 <devfile_read+0x138>
+  801e6f:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801e73:	48 83 c4 28          	add    $0x28,%rsp
+  801e77:	5b                   	pop    %rbx
+  801e78:	41 5c                	pop    %r12
+  801e7a:	41 5d                	pop    %r13
+  801e7c:	41 5e                	pop    %r14
+  801e7e:	41 5f                	pop    %r15
+  801e80:	5d                   	pop    %rbp
+  801e81:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801e82:	48 98                	cltq
+  801e84:	eb ed                	jmp    801e73 <devfile_read+0x138>
+            return res;
+  801e86:	48 98                	cltq
+  801e88:	eb e9                	jmp    801e73 <devfile_read+0x138>
+            return i;
+  801e8a:	48 89 d8             	mov    %rbx,%rax
+  801e8d:	eb db                	jmp    801e6a <devfile_read+0x12f>
+    size_t i = 0;
+  801e8f:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801e93:	eb d2                	jmp    801e67 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801e95:	48 89 c6             	mov    %rax,%rsi
+  801e98:	4c 89 ff             	mov    %r15,%rdi
+  801e9b:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  801ea2:	00 00 00 
+  801ea5:	ff d0                	call   *%rax
+  801ea7:	85 c0                	test   %eax,%eax
+  801ea9:	78 40                	js     801eeb <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801eab:	4c 89 ff             	mov    %r15,%rdi
+  801eae:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  801eb5:	00 00 00 
+  801eb8:	ff d0                	call   *%rax
+  801eba:	48 89 c2             	mov    %rax,%rdx
+  801ebd:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ec1:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801ec5:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ec9:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801ece:	48 01 d0             	add    %rdx,%rax
+  801ed1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801ed5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801eda:	0f 84 33 01 00 00    	je     802013 <devfile_read+0x2d8>
+    size_t i = 0;
+  801ee0:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801ee6:	e9 f5 00 00 00       	jmp    801fe0 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801eeb:	48 98                	cltq
+  801eed:	eb 84                	jmp    801e73 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801eef:	44 89 e8             	mov    %r13d,%eax
+  801ef2:	66 b8 00 00          	mov    $0x0,%ax
+  801ef6:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801efb:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801f02:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801f04:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801f08:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801f0c:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801f0e:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801f13:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801f16:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801f1d:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801f1e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f29:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f2e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f33:	48 b8 05 16 80 00 00 	movabs $0x801605,%rax
+  801f3a:	00 00 00 
+  801f3d:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	0f 88 be 00 00 00    	js     802005 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f47:	48 63 d0             	movslq %eax,%rdx
+  801f4a:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801f4f:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801f54:	44 39 e8             	cmp    %r13d,%eax
+  801f57:	0f 8e ba 00 00 00    	jle    802017 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801f5d:	49 63 c5             	movslq %r13d,%rax
+  801f60:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801f65:	48 29 c3             	sub    %rax,%rbx
+  801f68:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801f6d:	48 01 c3             	add    %rax,%rbx
+  801f70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f74:	4c 29 f0             	sub    %r14,%rax
+  801f77:	48 39 c3             	cmp    %rax,%rbx
+  801f7a:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801f7e:	4c 89 ff             	mov    %r15,%rdi
+  801f81:	48 b9 b1 0c 80 00 00 	movabs $0x800cb1,%rcx
+  801f88:	00 00 00 
+  801f8b:	ff d1                	call   *%rcx
+  801f8d:	48 89 c2             	mov    %rax,%rdx
+  801f90:	48 c1 e2 04          	shl    $0x4,%rdx
+  801f94:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801f98:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f9c:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801fa1:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801fa4:	44 89 ea             	mov    %r13d,%edx
+  801fa7:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  801fac:	48 63 d2             	movslq %edx,%rdx
+  801faf:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801fb6:	00 
+  801fb7:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801fbb:	4c 01 f7             	add    %r14,%rdi
+  801fbe:	48 89 da             	mov    %rbx,%rdx
+  801fc1:	48 b9 f7 3d 80 00 00 	movabs $0x803df7,%rcx
+  801fc8:	00 00 00 
+  801fcb:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  801fcd:	41 01 dd             	add    %ebx,%r13d
+  801fd0:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  801fd4:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  801fd7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fdb:	49 39 c6             	cmp    %rax,%r14
+  801fde:	73 37                	jae    802017 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  801fe0:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  801fe4:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801fe9:	44 39 e8             	cmp    %r13d,%eax
+  801fec:	0f 8f fd fe ff ff    	jg     801eef <devfile_read+0x1b4>
+  801ff2:	41 03 44 24 10       	add    0x10(%r12),%eax
+  801ff7:	44 39 e8             	cmp    %r13d,%eax
+  801ffa:	0f 8f 5d ff ff ff    	jg     801f5d <devfile_read+0x222>
+  802000:	e9 ea fe ff ff       	jmp    801eef <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  802005:	48 98                	cltq
+  802007:	4d 85 f6             	test   %r14,%r14
+  80200a:	49 0f 45 c6          	cmovne %r14,%rax
+  80200e:	e9 60 fe ff ff       	jmp    801e73 <devfile_read+0x138>
+    size_t i = 0;
+  802013:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  802017:	4c 89 f0             	mov    %r14,%rax
+  80201a:	e9 54 fe ff ff       	jmp    801e73 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80201f:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802026:	e9 48 fe ff ff       	jmp    801e73 <devfile_read+0x138>
+
+000000000080202b <open>:
+open(const char *path, int mode) {
+  80202b:	55                   	push   %rbp
+  80202c:	48 89 e5             	mov    %rsp,%rbp
+  80202f:	41 55                	push   %r13
+  802031:	41 54                	push   %r12
+  802033:	53                   	push   %rbx
+  802034:	48 83 ec 18          	sub    $0x18,%rsp
+  802038:	49 89 fc             	mov    %rdi,%r12
+  80203b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80203e:	48 b8 c4 39 80 00 00 	movabs $0x8039c4,%rax
+  802045:	00 00 00 
+  802048:	ff d0                	call   *%rax
+  80204a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802050:	0f 87 8a 00 00 00    	ja     8020e0 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802056:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80205a:	48 b8 df 0c 80 00 00 	movabs $0x800cdf,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+  802066:	89 c3                	mov    %eax,%ebx
+  802068:	85 c0                	test   %eax,%eax
+  80206a:	78 50                	js     8020bc <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80206c:	4c 89 e6             	mov    %r12,%rsi
+  80206f:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802076:	00 00 00 
+  802079:	48 89 df             	mov    %rbx,%rdi
+  80207c:	48 b8 02 3a 80 00 00 	movabs $0x803a02,%rax
+  802083:	00 00 00 
+  802086:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802088:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80208f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802093:	bf 01 00 00 00       	mov    $0x1,%edi
+  802098:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  80209f:	00 00 00 
+  8020a2:	ff d0                	call   *%rax
+  8020a4:	89 c3                	mov    %eax,%ebx
+  8020a6:	85 c0                	test   %eax,%eax
+  8020a8:	78 1f                	js     8020c9 <open+0x9e>
+    return fd2num(fd);
+  8020aa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020ae:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  8020b5:	00 00 00 
+  8020b8:	ff d0                	call   *%rax
+  8020ba:	89 c3                	mov    %eax,%ebx
+}
+  8020bc:	89 d8                	mov    %ebx,%eax
+  8020be:	48 83 c4 18          	add    $0x18,%rsp
+  8020c2:	5b                   	pop    %rbx
+  8020c3:	41 5c                	pop    %r12
+  8020c5:	41 5d                	pop    %r13
+  8020c7:	5d                   	pop    %rbp
+  8020c8:	c3                   	ret
+        fd_close(fd, 0);
+  8020c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ce:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020d2:	48 b8 fa 0d 80 00 00 	movabs $0x800dfa,%rax
+  8020d9:	00 00 00 
+  8020dc:	ff d0                	call   *%rax
+        return res;
+  8020de:	eb dc                	jmp    8020bc <open+0x91>
+        return -E_BAD_PATH;
+  8020e0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020e5:	eb d5                	jmp    8020bc <open+0x91>
+
+00000000008020e7 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8020e7:	55                   	push   %rbp
+  8020e8:	48 89 e5             	mov    %rsp,%rbp
+  8020eb:	41 57                	push   %r15
+  8020ed:	41 56                	push   %r14
+  8020ef:	41 55                	push   %r13
+  8020f1:	41 54                	push   %r12
+  8020f3:	53                   	push   %rbx
+  8020f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8020f8:	41 89 f6             	mov    %esi,%r14d
+  8020fb:	49 89 d7             	mov    %rdx,%r15
+  8020fe:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802101:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802105:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  80210c:	00 00 00 
+  80210f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802111:	85 c0                	test   %eax,%eax
+  802113:	0f 88 db 00 00 00    	js     8021f4 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802119:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80211d:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802124:	00 00 00 
+  802127:	8b 00                	mov    (%rax),%eax
+  802129:	39 07                	cmp    %eax,(%rdi)
+  80212b:	0f 85 db 00 00 00    	jne    80220c <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802131:	45 85 f6             	test   %r14d,%r14d
+  802134:	0f 88 db 00 00 00    	js     802215 <fmap+0x12e>
+  80213a:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802141:	0f 85 d7 00 00 00    	jne    80221e <fmap+0x137>
+  802147:	4c 89 fb             	mov    %r15,%rbx
+  80214a:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802150:	0f 85 d1 00 00 00    	jne    802227 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802156:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  80215d:	00 00 00 
+  802160:	ff d0                	call   *%rax
+  802162:	85 c0                	test   %eax,%eax
+  802164:	0f 88 8e 00 00 00    	js     8021f8 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80216a:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  802171:	00 00 00 
+    while (i < n) {
+  802174:	4d 85 ed             	test   %r13,%r13
+  802177:	0f 84 8a 00 00 00    	je     802207 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80217d:	4c 89 ea             	mov    %r13,%rdx
+  802180:	48 29 da             	sub    %rbx,%rdx
+  802183:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80218a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802190:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802194:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802198:	8b 40 0c             	mov    0xc(%rax),%eax
+  80219b:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80219f:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8021a3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8021a8:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8021ad:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8021b1:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8021b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021ba:	4c 89 e6             	mov    %r12,%rsi
+  8021bd:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021c2:	48 b8 05 16 80 00 00 	movabs $0x801605,%rax
+  8021c9:	00 00 00 
+  8021cc:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021ce:	85 c0                	test   %eax,%eax
+  8021d0:	78 2a                	js     8021fc <fmap+0x115>
+        i += res;
+  8021d2:	48 98                	cltq
+  8021d4:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8021d7:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8021db:	72 05                	jb     8021e2 <fmap+0xfb>
+    while (i < n) {
+  8021dd:	4c 39 eb             	cmp    %r13,%rbx
+  8021e0:	72 9b                	jb     80217d <fmap+0x96>
+    }
+    return i;
+  8021e2:	48 89 d8             	mov    %rbx,%rax
+}
+  8021e5:	48 83 c4 18          	add    $0x18,%rsp
+  8021e9:	5b                   	pop    %rbx
+  8021ea:	41 5c                	pop    %r12
+  8021ec:	41 5d                	pop    %r13
+  8021ee:	41 5e                	pop    %r14
+  8021f0:	41 5f                	pop    %r15
+  8021f2:	5d                   	pop    %rbp
+  8021f3:	c3                   	ret
+    if (res < 0) return res;
+  8021f4:	48 98                	cltq
+  8021f6:	eb ed                	jmp    8021e5 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8021f8:	48 98                	cltq
+  8021fa:	eb e9                	jmp    8021e5 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021fc:	48 98                	cltq
+  8021fe:	48 85 db             	test   %rbx,%rbx
+  802201:	48 0f 45 c3          	cmovne %rbx,%rax
+  802205:	eb de                	jmp    8021e5 <fmap+0xfe>
+    size_t i = 0;
+  802207:	4c 89 eb             	mov    %r13,%rbx
+  80220a:	eb d6                	jmp    8021e2 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80220c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802213:	eb d0                	jmp    8021e5 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802215:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80221c:	eb c7                	jmp    8021e5 <fmap+0xfe>
+  80221e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802225:	eb be                	jmp    8021e5 <fmap+0xfe>
+  802227:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80222e:	eb b5                	jmp    8021e5 <fmap+0xfe>
+
+0000000000802230 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  802230:	55                   	push   %rbp
+  802231:	48 89 e5             	mov    %rsp,%rbp
+  802234:	41 56                	push   %r14
+  802236:	41 55                	push   %r13
+  802238:	41 54                	push   %r12
+  80223a:	53                   	push   %rbx
+  80223b:	48 83 ec 10          	sub    $0x10,%rsp
+  80223f:	89 fb                	mov    %edi,%ebx
+  802241:	41 89 f4             	mov    %esi,%r12d
+  802244:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802247:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80224b:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  802252:	00 00 00 
+  802255:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802257:	85 c0                	test   %eax,%eax
+  802259:	78 63                	js     8022be <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80225b:	45 85 e4             	test   %r12d,%r12d
+  80225e:	0f 88 80 00 00 00    	js     8022e4 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  802264:	45 89 e6             	mov    %r12d,%r14d
+  802267:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80226e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802272:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  802279:	00 00 00 
+  80227c:	ff d0                	call   *%rax
+  80227e:	48 89 c2             	mov    %rax,%rdx
+  802281:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802286:	44 89 f6             	mov    %r14d,%esi
+  802289:	89 df                	mov    %ebx,%edi
+  80228b:	48 b8 e7 20 80 00 00 	movabs $0x8020e7,%rax
+  802292:	00 00 00 
+  802295:	ff d0                	call   *%rax
+  802297:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80229a:	45 29 f4             	sub    %r14d,%r12d
+  80229d:	4d 63 f4             	movslq %r12d,%r14
+  8022a0:	49 39 c6             	cmp    %rax,%r14
+  8022a3:	7c 1d                	jl     8022c2 <read_map+0x92>
+  8022a5:	48 85 c0             	test   %rax,%rax
+  8022a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ad:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8022b1:	48 83 c4 10          	add    $0x10,%rsp
+  8022b5:	5b                   	pop    %rbx
+  8022b6:	41 5c                	pop    %r12
+  8022b8:	41 5d                	pop    %r13
+  8022ba:	41 5e                	pop    %r14
+  8022bc:	5d                   	pop    %rbp
+  8022bd:	c3                   	ret
+    if (res < 0) return res;
+  8022be:	48 98                	cltq
+  8022c0:	eb ef                	jmp    8022b1 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8022c2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022c6:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  8022cd:	00 00 00 
+  8022d0:	ff d0                	call   *%rax
+  8022d2:	4d 63 e4             	movslq %r12d,%r12
+  8022d5:	4c 01 e0             	add    %r12,%rax
+  8022d8:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8022dc:	48 89 d8             	mov    %rbx,%rax
+  8022df:	4c 29 f0             	sub    %r14,%rax
+  8022e2:	eb cd                	jmp    8022b1 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8022e4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022eb:	eb c4                	jmp    8022b1 <read_map+0x81>
+
+00000000008022ed <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8022ed:	55                   	push   %rbp
+  8022ee:	48 89 e5             	mov    %rsp,%rbp
+  8022f1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022f5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022f9:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  802300:	00 00 00 
+  802303:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802305:	85 c0                	test   %eax,%eax
+  802307:	78 4a                	js     802353 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802309:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80230d:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802314:	00 00 00 
+  802317:	8b 00                	mov    (%rax),%eax
+  802319:	39 07                	cmp    %eax,(%rdi)
+  80231b:	75 38                	jne    802355 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80231d:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  802324:	00 00 00 
+  802327:	ff d0                	call   *%rax
+  802329:	85 c0                	test   %eax,%eax
+  80232b:	78 26                	js     802353 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80232d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802331:	8b 40 0c             	mov    0xc(%rax),%eax
+  802334:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80233b:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80233d:	be 00 00 00 00       	mov    $0x0,%esi
+  802342:	bf 06 00 00 00       	mov    $0x6,%edi
+  802347:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  80234e:	00 00 00 
+  802351:	ff d0                	call   *%rax
+}
+  802353:	c9                   	leave
+  802354:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802355:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80235a:	eb f7                	jmp    802353 <fsync+0x66>
+
+000000000080235c <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80235c:	55                   	push   %rbp
+  80235d:	48 89 e5             	mov    %rsp,%rbp
+  802360:	41 57                	push   %r15
+  802362:	41 56                	push   %r14
+  802364:	41 55                	push   %r13
+  802366:	41 54                	push   %r12
+  802368:	53                   	push   %rbx
+  802369:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80236d:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  802374:	00 00 00 
+  802377:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80237c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802382:	49 bd 3f 0d 80 00 00 	movabs $0x800d3f,%r13
+  802389:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80238c:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  802393:	00 00 00 
+  802396:	eb 0c                	jmp    8023a4 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  802398:	83 c3 01             	add    $0x1,%ebx
+  80239b:	49 83 c4 28          	add    $0x28,%r12
+  80239f:	83 fb 20             	cmp    $0x20,%ebx
+  8023a2:	74 33                	je     8023d7 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023a4:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8023a9:	74 ed                	je     802398 <flushall+0x3c>
+  8023ab:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8023af:	89 df                	mov    %ebx,%edi
+  8023b1:	41 ff d5             	call   *%r13
+  8023b4:	85 c0                	test   %eax,%eax
+  8023b6:	78 e0                	js     802398 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8023b8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023bc:	41 8b 06             	mov    (%r14),%eax
+  8023bf:	39 07                	cmp    %eax,(%rdi)
+  8023c1:	75 d5                	jne    802398 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8023c3:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  8023ca:	00 00 00 
+  8023cd:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8023cf:	85 c0                	test   %eax,%eax
+  8023d1:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8023d5:	eb c1                	jmp    802398 <flushall+0x3c>
+    }
+    return res;
+}
+  8023d7:	44 89 f8             	mov    %r15d,%eax
+  8023da:	48 83 c4 18          	add    $0x18,%rsp
+  8023de:	5b                   	pop    %rbx
+  8023df:	41 5c                	pop    %r12
+  8023e1:	41 5d                	pop    %r13
+  8023e3:	41 5e                	pop    %r14
+  8023e5:	41 5f                	pop    %r15
+  8023e7:	5d                   	pop    %rbp
+  8023e8:	c3                   	ret
+
+00000000008023e9 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8023e9:	55                   	push   %rbp
+  8023ea:	48 89 e5             	mov    %rsp,%rbp
+  8023ed:	53                   	push   %rbx
+  8023ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8023f2:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8023f5:	40 0f b6 c6          	movzbl %sil,%eax
+  8023f9:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802400:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  802402:	be 00 00 00 00       	mov    $0x0,%esi
+  802407:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80240c:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  802413:	00 00 00 
+  802416:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802418:	85 c0                	test   %eax,%eax
+  80241a:	78 23                	js     80243f <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80241c:	ba 58 06 00 00       	mov    $0x658,%edx
+  802421:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802428:	00 00 00 
+  80242b:	48 89 df             	mov    %rbx,%rdi
+  80242e:	48 b8 f7 3d 80 00 00 	movabs $0x803df7,%rax
+  802435:	00 00 00 
+  802438:	ff d0                	call   *%rax
+    return 0;
+  80243a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80243f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802443:	c9                   	leave
+  802444:	c3                   	ret
+
+0000000000802445 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  802445:	55                   	push   %rbp
+  802446:	48 89 e5             	mov    %rsp,%rbp
+  802449:	53                   	push   %rbx
+  80244a:	48 83 ec 08          	sub    $0x8,%rsp
+  80244e:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  802451:	48 b8 c4 39 80 00 00 	movabs $0x8039c4,%rax
+  802458:	00 00 00 
+  80245b:	ff d0                	call   *%rax
+  80245d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802463:	77 35                	ja     80249a <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  802465:	48 89 de             	mov    %rbx,%rsi
+  802468:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80246f:	00 00 00 
+  802472:	48 b8 02 3a 80 00 00 	movabs $0x803a02,%rax
+  802479:	00 00 00 
+  80247c:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80247e:	be 00 00 00 00       	mov    $0x0,%esi
+  802483:	bf 07 00 00 00       	mov    $0x7,%edi
+  802488:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  80248f:	00 00 00 
+  802492:	ff d0                	call   *%rax
+}
+  802494:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802498:	c9                   	leave
+  802499:	c3                   	ret
+        return -E_BAD_PATH;
+  80249a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80249f:	eb f3                	jmp    802494 <remove+0x4f>
+
+00000000008024a1 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024a1:	55                   	push   %rbp
+  8024a2:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8024a5:	48 b8 5c 23 80 00 00 	movabs $0x80235c,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024bb:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  8024c2:	00 00 00 
+  8024c5:	ff d0                	call   *%rax
+}
+  8024c7:	5d                   	pop    %rbp
+  8024c8:	c3                   	ret
+
+00000000008024c9 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024c9:	55                   	push   %rbp
+  8024ca:	48 89 e5             	mov    %rsp,%rbp
+  8024cd:	41 54                	push   %r12
+  8024cf:	53                   	push   %rbx
+  8024d0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024d3:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+  8024df:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024e2:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  8024e9:	00 00 00 
+  8024ec:	48 89 df             	mov    %rbx,%rdi
+  8024ef:	48 b8 02 3a 80 00 00 	movabs $0x803a02,%rax
+  8024f6:	00 00 00 
+  8024f9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024fb:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802500:	41 2b 04 24          	sub    (%r12),%eax
+  802504:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80250a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802511:	00 00 00 
+    stat->st_dev = &devpipe;
+  802514:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80251b:	00 00 00 
+  80251e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80252a:	5b                   	pop    %rbx
+  80252b:	41 5c                	pop    %r12
+  80252d:	5d                   	pop    %rbp
+  80252e:	c3                   	ret
+
+000000000080252f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80252f:	55                   	push   %rbp
+  802530:	48 89 e5             	mov    %rsp,%rbp
+  802533:	41 54                	push   %r12
+  802535:	53                   	push   %rbx
+  802536:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802539:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80253e:	48 89 fe             	mov    %rdi,%rsi
+  802541:	bf 00 00 00 00       	mov    $0x0,%edi
+  802546:	49 bc 7a 04 80 00 00 	movabs $0x80047a,%r12
+  80254d:	00 00 00 
+  802550:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802553:	48 89 df             	mov    %rbx,%rdi
+  802556:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  80255d:	00 00 00 
+  802560:	ff d0                	call   *%rax
+  802562:	48 89 c6             	mov    %rax,%rsi
+  802565:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80256a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80256f:	41 ff d4             	call   *%r12
+}
+  802572:	5b                   	pop    %rbx
+  802573:	41 5c                	pop    %r12
+  802575:	5d                   	pop    %rbp
+  802576:	c3                   	ret
+
+0000000000802577 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802577:	55                   	push   %rbp
+  802578:	48 89 e5             	mov    %rsp,%rbp
+  80257b:	41 57                	push   %r15
+  80257d:	41 56                	push   %r14
+  80257f:	41 55                	push   %r13
+  802581:	41 54                	push   %r12
+  802583:	53                   	push   %rbx
+  802584:	48 83 ec 18          	sub    $0x18,%rsp
+  802588:	49 89 fc             	mov    %rdi,%r12
+  80258b:	49 89 f5             	mov    %rsi,%r13
+  80258e:	49 89 d7             	mov    %rdx,%r15
+  802591:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802595:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  80259c:	00 00 00 
+  80259f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025a1:	4d 85 ff             	test   %r15,%r15
+  8025a4:	0f 84 af 00 00 00    	je     802659 <devpipe_write+0xe2>
+  8025aa:	48 89 c3             	mov    %rax,%rbx
+  8025ad:	4c 89 f8             	mov    %r15,%rax
+  8025b0:	4d 89 ef             	mov    %r13,%r15
+  8025b3:	4c 01 e8             	add    %r13,%rax
+  8025b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025ba:	49 bd 6f 02 80 00 00 	movabs $0x80026f,%r13
+  8025c1:	00 00 00 
+            sys_yield();
+  8025c4:	49 be 0c 02 80 00 00 	movabs $0x80020c,%r14
+  8025cb:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025ce:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025d1:	48 63 ce             	movslq %esi,%rcx
+  8025d4:	48 63 03             	movslq (%rbx),%rax
+  8025d7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025dd:	48 39 c1             	cmp    %rax,%rcx
+  8025e0:	72 2e                	jb     802610 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025e2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025e7:	48 89 da             	mov    %rbx,%rdx
+  8025ea:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025ef:	4c 89 e7             	mov    %r12,%rdi
+  8025f2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025f5:	85 c0                	test   %eax,%eax
+  8025f7:	74 66                	je     80265f <devpipe_write+0xe8>
+            sys_yield();
+  8025f9:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025fc:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025ff:	48 63 ce             	movslq %esi,%rcx
+  802602:	48 63 03             	movslq (%rbx),%rax
+  802605:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80260b:	48 39 c1             	cmp    %rax,%rcx
+  80260e:	73 d2                	jae    8025e2 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802610:	41 0f b6 3f          	movzbl (%r15),%edi
+  802614:	48 89 ca             	mov    %rcx,%rdx
+  802617:	48 c1 ea 03          	shr    $0x3,%rdx
+  80261b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802622:	08 10 20 
+  802625:	48 f7 e2             	mul    %rdx
+  802628:	48 c1 ea 06          	shr    $0x6,%rdx
+  80262c:	48 89 d0             	mov    %rdx,%rax
+  80262f:	48 c1 e0 09          	shl    $0x9,%rax
+  802633:	48 29 d0             	sub    %rdx,%rax
+  802636:	48 c1 e0 03          	shl    $0x3,%rax
+  80263a:	48 29 c1             	sub    %rax,%rcx
+  80263d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802642:	83 c6 01             	add    $0x1,%esi
+  802645:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802648:	49 83 c7 01          	add    $0x1,%r15
+  80264c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802650:	49 39 c7             	cmp    %rax,%r15
+  802653:	0f 85 75 ff ff ff    	jne    8025ce <devpipe_write+0x57>
+    return n;
+  802659:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80265d:	eb 05                	jmp    802664 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80265f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802664:	48 83 c4 18          	add    $0x18,%rsp
+  802668:	5b                   	pop    %rbx
+  802669:	41 5c                	pop    %r12
+  80266b:	41 5d                	pop    %r13
+  80266d:	41 5e                	pop    %r14
+  80266f:	41 5f                	pop    %r15
+  802671:	5d                   	pop    %rbp
+  802672:	c3                   	ret
+
+0000000000802673 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802673:	55                   	push   %rbp
+  802674:	48 89 e5             	mov    %rsp,%rbp
+  802677:	41 57                	push   %r15
+  802679:	41 56                	push   %r14
+  80267b:	41 55                	push   %r13
+  80267d:	41 54                	push   %r12
+  80267f:	53                   	push   %rbx
+  802680:	48 83 ec 18          	sub    $0x18,%rsp
+  802684:	49 89 fc             	mov    %rdi,%r12
+  802687:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80268b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80268f:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  802696:	00 00 00 
+  802699:	ff d0                	call   *%rax
+  80269b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80269e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026a4:	49 bd 6f 02 80 00 00 	movabs $0x80026f,%r13
+  8026ab:	00 00 00 
+            sys_yield();
+  8026ae:	49 be 0c 02 80 00 00 	movabs $0x80020c,%r14
+  8026b5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026b8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026bd:	74 7d                	je     80273c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026bf:	8b 03                	mov    (%rbx),%eax
+  8026c1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026c4:	75 26                	jne    8026ec <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026c6:	4d 85 ff             	test   %r15,%r15
+  8026c9:	75 77                	jne    802742 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026cb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026d0:	48 89 da             	mov    %rbx,%rdx
+  8026d3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026d8:	4c 89 e7             	mov    %r12,%rdi
+  8026db:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026de:	85 c0                	test   %eax,%eax
+  8026e0:	74 72                	je     802754 <devpipe_read+0xe1>
+            sys_yield();
+  8026e2:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026e5:	8b 03                	mov    (%rbx),%eax
+  8026e7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026ea:	74 df                	je     8026cb <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026ec:	48 63 c8             	movslq %eax,%rcx
+  8026ef:	48 89 ca             	mov    %rcx,%rdx
+  8026f2:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026f6:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026fd:	08 10 20 
+  802700:	48 89 d0             	mov    %rdx,%rax
+  802703:	48 f7 e6             	mul    %rsi
+  802706:	48 c1 ea 06          	shr    $0x6,%rdx
+  80270a:	48 89 d0             	mov    %rdx,%rax
+  80270d:	48 c1 e0 09          	shl    $0x9,%rax
+  802711:	48 29 d0             	sub    %rdx,%rax
+  802714:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80271b:	00 
+  80271c:	48 89 c8             	mov    %rcx,%rax
+  80271f:	48 29 d0             	sub    %rdx,%rax
+  802722:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802727:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80272b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80272f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802732:	49 83 c7 01          	add    $0x1,%r15
+  802736:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80273a:	75 83                	jne    8026bf <devpipe_read+0x4c>
+    return n;
+  80273c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802740:	eb 03                	jmp    802745 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802742:	4c 89 f8             	mov    %r15,%rax
+}
+  802745:	48 83 c4 18          	add    $0x18,%rsp
+  802749:	5b                   	pop    %rbx
+  80274a:	41 5c                	pop    %r12
+  80274c:	41 5d                	pop    %r13
+  80274e:	41 5e                	pop    %r14
+  802750:	41 5f                	pop    %r15
+  802752:	5d                   	pop    %rbp
+  802753:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802754:	b8 00 00 00 00       	mov    $0x0,%eax
+  802759:	eb ea                	jmp    802745 <devpipe_read+0xd2>
+
+000000000080275b <pipe>:
+pipe(int pfd[2]) {
+  80275b:	55                   	push   %rbp
+  80275c:	48 89 e5             	mov    %rsp,%rbp
+  80275f:	41 55                	push   %r13
+  802761:	41 54                	push   %r12
+  802763:	53                   	push   %rbx
+  802764:	48 83 ec 18          	sub    $0x18,%rsp
+  802768:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80276b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80276f:	48 b8 df 0c 80 00 00 	movabs $0x800cdf,%rax
+  802776:	00 00 00 
+  802779:	ff d0                	call   *%rax
+  80277b:	89 c3                	mov    %eax,%ebx
+  80277d:	85 c0                	test   %eax,%eax
+  80277f:	0f 88 a0 01 00 00    	js     802925 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802785:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80278a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80278f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802793:	bf 00 00 00 00       	mov    $0x0,%edi
+  802798:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  80279f:	00 00 00 
+  8027a2:	ff d0                	call   *%rax
+  8027a4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027a6:	85 c0                	test   %eax,%eax
+  8027a8:	0f 88 77 01 00 00    	js     802925 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027ae:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8027b2:	48 b8 df 0c 80 00 00 	movabs $0x800cdf,%rax
+  8027b9:	00 00 00 
+  8027bc:	ff d0                	call   *%rax
+  8027be:	89 c3                	mov    %eax,%ebx
+  8027c0:	85 c0                	test   %eax,%eax
+  8027c2:	0f 88 43 01 00 00    	js     80290b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027c8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027cd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027d2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027db:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  8027e2:	00 00 00 
+  8027e5:	ff d0                	call   *%rax
+  8027e7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027e9:	85 c0                	test   %eax,%eax
+  8027eb:	0f 88 1a 01 00 00    	js     80290b <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027f1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027f5:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+  802801:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802804:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802809:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80280e:	48 89 c6             	mov    %rax,%rsi
+  802811:	bf 00 00 00 00       	mov    $0x0,%edi
+  802816:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  80281d:	00 00 00 
+  802820:	ff d0                	call   *%rax
+  802822:	89 c3                	mov    %eax,%ebx
+  802824:	85 c0                	test   %eax,%eax
+  802826:	0f 88 c5 00 00 00    	js     8028f1 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80282c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802830:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  802837:	00 00 00 
+  80283a:	ff d0                	call   *%rax
+  80283c:	48 89 c1             	mov    %rax,%rcx
+  80283f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802845:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80284b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802850:	4c 89 ee             	mov    %r13,%rsi
+  802853:	bf 00 00 00 00       	mov    $0x0,%edi
+  802858:	48 b8 02 03 80 00 00 	movabs $0x800302,%rax
+  80285f:	00 00 00 
+  802862:	ff d0                	call   *%rax
+  802864:	89 c3                	mov    %eax,%ebx
+  802866:	85 c0                	test   %eax,%eax
+  802868:	78 6e                	js     8028d8 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80286a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80286f:	4c 89 ef             	mov    %r13,%rdi
+  802872:	48 b8 3d 02 80 00 00 	movabs $0x80023d,%rax
+  802879:	00 00 00 
+  80287c:	ff d0                	call   *%rax
+  80287e:	83 f8 02             	cmp    $0x2,%eax
+  802881:	0f 85 ab 00 00 00    	jne    802932 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802887:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80288e:	00 00 
+  802890:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802894:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802896:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80289a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028a1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028a5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028ab:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028b2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028b6:	48 bb b1 0c 80 00 00 	movabs $0x800cb1,%rbx
+  8028bd:	00 00 00 
+  8028c0:	ff d3                	call   *%rbx
+  8028c2:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028c6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028ca:	ff d3                	call   *%rbx
+  8028cc:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d6:	eb 4d                	jmp    802925 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8028d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028dd:	4c 89 ee             	mov    %r13,%rsi
+  8028e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e5:	48 b8 7a 04 80 00 00 	movabs $0x80047a,%rax
+  8028ec:	00 00 00 
+  8028ef:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028f6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ff:	48 b8 7a 04 80 00 00 	movabs $0x80047a,%rax
+  802906:	00 00 00 
+  802909:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80290b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802910:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802914:	bf 00 00 00 00       	mov    $0x0,%edi
+  802919:	48 b8 7a 04 80 00 00 	movabs $0x80047a,%rax
+  802920:	00 00 00 
+  802923:	ff d0                	call   *%rax
+}
+  802925:	89 d8                	mov    %ebx,%eax
+  802927:	48 83 c4 18          	add    $0x18,%rsp
+  80292b:	5b                   	pop    %rbx
+  80292c:	41 5c                	pop    %r12
+  80292e:	41 5d                	pop    %r13
+  802930:	5d                   	pop    %rbp
+  802931:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802932:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  802939:	00 00 00 
+  80293c:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  802943:	00 00 00 
+  802946:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80294b:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  802952:	00 00 00 
+  802955:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295a:	49 b8 3a 2f 80 00 00 	movabs $0x802f3a,%r8
+  802961:	00 00 00 
+  802964:	41 ff d0             	call   *%r8
+
+0000000000802967 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802967:	55                   	push   %rbp
+  802968:	48 89 e5             	mov    %rsp,%rbp
+  80296b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80296f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802973:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  80297a:	00 00 00 
+  80297d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80297f:	85 c0                	test   %eax,%eax
+  802981:	78 35                	js     8029b8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802983:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802987:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  80298e:	00 00 00 
+  802991:	ff d0                	call   *%rax
+  802993:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802996:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80299b:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029a0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029a4:	48 b8 6f 02 80 00 00 	movabs $0x80026f,%rax
+  8029ab:	00 00 00 
+  8029ae:	ff d0                	call   *%rax
+  8029b0:	85 c0                	test   %eax,%eax
+  8029b2:	0f 94 c0             	sete   %al
+  8029b5:	0f b6 c0             	movzbl %al,%eax
+}
+  8029b8:	c9                   	leave
+  8029b9:	c3                   	ret
+
+00000000008029ba <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029ba:	48 89 f8             	mov    %rdi,%rax
+  8029bd:	48 c1 e8 27          	shr    $0x27,%rax
+  8029c1:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8029c8:	7f 00 00 
+  8029cb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029cf:	f6 c2 01             	test   $0x1,%dl
+  8029d2:	74 6d                	je     802a41 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029d4:	48 89 f8             	mov    %rdi,%rax
+  8029d7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029db:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029e2:	7f 00 00 
+  8029e5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029e9:	f6 c2 01             	test   $0x1,%dl
+  8029ec:	74 62                	je     802a50 <get_uvpt_entry+0x96>
+  8029ee:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029f5:	7f 00 00 
+  8029f8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029fc:	f6 c2 80             	test   $0x80,%dl
+  8029ff:	75 4f                	jne    802a50 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a01:	48 89 f8             	mov    %rdi,%rax
+  802a04:	48 c1 e8 15          	shr    $0x15,%rax
+  802a08:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a0f:	7f 00 00 
+  802a12:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a16:	f6 c2 01             	test   $0x1,%dl
+  802a19:	74 44                	je     802a5f <get_uvpt_entry+0xa5>
+  802a1b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a22:	7f 00 00 
+  802a25:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a29:	f6 c2 80             	test   $0x80,%dl
+  802a2c:	75 31                	jne    802a5f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a2e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a32:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a39:	7f 00 00 
+  802a3c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a40:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a41:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a48:	7f 00 00 
+  802a4b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a4f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a50:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a57:	7f 00 00 
+  802a5a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a5e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a5f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a66:	7f 00 00 
+  802a69:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a6d:	c3                   	ret
+
+0000000000802a6e <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802a6e:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a71:	48 89 f9             	mov    %rdi,%rcx
+  802a74:	48 c1 e9 27          	shr    $0x27,%rcx
+  802a78:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802a7f:	7f 00 00 
+  802a82:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802a86:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a8d:	f6 c1 01             	test   $0x1,%cl
+  802a90:	0f 84 b2 00 00 00    	je     802b48 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a96:	48 89 f9             	mov    %rdi,%rcx
+  802a99:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802a9d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802aa4:	7f 00 00 
+  802aa7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802aab:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802ab2:	40 f6 c6 01          	test   $0x1,%sil
+  802ab6:	0f 84 8c 00 00 00    	je     802b48 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802abc:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802ac3:	7f 00 00 
+  802ac6:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802aca:	a8 80                	test   $0x80,%al
+  802acc:	75 7b                	jne    802b49 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ace:	48 89 f9             	mov    %rdi,%rcx
+  802ad1:	48 c1 e9 15          	shr    $0x15,%rcx
+  802ad5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802adc:	7f 00 00 
+  802adf:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802ae3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802aea:	40 f6 c6 01          	test   $0x1,%sil
+  802aee:	74 58                	je     802b48 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802af0:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802af7:	7f 00 00 
+  802afa:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802afe:	a8 80                	test   $0x80,%al
+  802b00:	75 6c                	jne    802b6e <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b02:	48 89 f9             	mov    %rdi,%rcx
+  802b05:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802b09:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b10:	7f 00 00 
+  802b13:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b17:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b1e:	40 f6 c6 01          	test   $0x1,%sil
+  802b22:	74 24                	je     802b48 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b24:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b2b:	7f 00 00 
+  802b2e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b32:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b39:	ff ff 7f 
+  802b3c:	48 21 c8             	and    %rcx,%rax
+  802b3f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b45:	48 09 d0             	or     %rdx,%rax
+}
+  802b48:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b49:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b50:	7f 00 00 
+  802b53:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b57:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b5e:	ff ff 7f 
+  802b61:	48 21 c8             	and    %rcx,%rax
+  802b64:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802b6a:	48 01 d0             	add    %rdx,%rax
+  802b6d:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802b6e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b75:	7f 00 00 
+  802b78:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b7c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b83:	ff ff 7f 
+  802b86:	48 21 c8             	and    %rcx,%rax
+  802b89:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802b8f:	48 01 d0             	add    %rdx,%rax
+  802b92:	c3                   	ret
+
+0000000000802b93 <get_prot>:
+
+int
+get_prot(void *va) {
+  802b93:	55                   	push   %rbp
+  802b94:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b97:	48 b8 ba 29 80 00 00 	movabs $0x8029ba,%rax
+  802b9e:	00 00 00 
+  802ba1:	ff d0                	call   *%rax
+  802ba3:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802ba6:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802bab:	89 c1                	mov    %eax,%ecx
+  802bad:	83 c9 04             	or     $0x4,%ecx
+  802bb0:	f6 c2 01             	test   $0x1,%dl
+  802bb3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802bb6:	89 c1                	mov    %eax,%ecx
+  802bb8:	83 c9 02             	or     $0x2,%ecx
+  802bbb:	f6 c2 02             	test   $0x2,%dl
+  802bbe:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802bc1:	89 c1                	mov    %eax,%ecx
+  802bc3:	83 c9 01             	or     $0x1,%ecx
+  802bc6:	48 85 d2             	test   %rdx,%rdx
+  802bc9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bcc:	89 c1                	mov    %eax,%ecx
+  802bce:	83 c9 40             	or     $0x40,%ecx
+  802bd1:	f6 c6 04             	test   $0x4,%dh
+  802bd4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802bd7:	5d                   	pop    %rbp
+  802bd8:	c3                   	ret
+
+0000000000802bd9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802bd9:	55                   	push   %rbp
+  802bda:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bdd:	48 b8 ba 29 80 00 00 	movabs $0x8029ba,%rax
+  802be4:	00 00 00 
+  802be7:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802be9:	48 c1 e8 06          	shr    $0x6,%rax
+  802bed:	83 e0 01             	and    $0x1,%eax
+}
+  802bf0:	5d                   	pop    %rbp
+  802bf1:	c3                   	ret
+
+0000000000802bf2 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bf2:	55                   	push   %rbp
+  802bf3:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802bf6:	48 b8 ba 29 80 00 00 	movabs $0x8029ba,%rax
+  802bfd:	00 00 00 
+  802c00:	ff d0                	call   *%rax
+  802c02:	83 e0 01             	and    $0x1,%eax
+}
+  802c05:	5d                   	pop    %rbp
+  802c06:	c3                   	ret
+
+0000000000802c07 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802c07:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802c0e:	7f 00 00 
+  802c11:	a8 01                	test   $0x1,%al
+  802c13:	75 06                	jne    802c1b <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1a:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c1b:	55                   	push   %rbp
+  802c1c:	48 89 e5             	mov    %rsp,%rbp
+  802c1f:	41 57                	push   %r15
+  802c21:	41 56                	push   %r14
+  802c23:	41 55                	push   %r13
+  802c25:	41 54                	push   %r12
+  802c27:	53                   	push   %rbx
+  802c28:	48 83 ec 18          	sub    $0x18,%rsp
+  802c2c:	49 89 fe             	mov    %rdi,%r14
+  802c2f:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c32:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c39:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c3a:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c41:	7f 00 00 
+  802c44:	e9 81 00 00 00       	jmp    802cca <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c49:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c50:	49 39 dd             	cmp    %rbx,%r13
+  802c53:	74 2b                	je     802c80 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c55:	48 89 d8             	mov    %rbx,%rax
+  802c58:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c5c:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802c60:	f6 c2 01             	test   $0x1,%dl
+  802c63:	74 e4                	je     802c49 <foreach_shared_region+0x42>
+  802c65:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802c69:	f6 c4 04             	test   $0x4,%ah
+  802c6c:	74 db                	je     802c49 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802c6e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802c75:	4c 89 fa             	mov    %r15,%rdx
+  802c78:	48 89 df             	mov    %rbx,%rdi
+  802c7b:	41 ff d6             	call   *%r14
+  802c7e:	eb c9                	jmp    802c49 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802c80:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802c87:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802c8b:	74 22                	je     802caf <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802c8d:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802c94:	48 89 d8             	mov    %rbx,%rax
+  802c97:	48 c1 e8 15          	shr    $0x15,%rax
+  802c9b:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802ca2:	7f 00 00 
+  802ca5:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802ca9:	a8 01                	test   $0x1,%al
+  802cab:	74 d3                	je     802c80 <foreach_shared_region+0x79>
+  802cad:	eb a6                	jmp    802c55 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802caf:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802cb6:	40 
+  802cb7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802cbb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802cc2:	00 00 00 
+  802cc5:	48 39 c1             	cmp    %rax,%rcx
+  802cc8:	74 31                	je     802cfb <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802cca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cce:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cd2:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802cd9:	7f 00 00 
+  802cdc:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802ce0:	a8 01                	test   $0x1,%al
+  802ce2:	74 cb                	je     802caf <foreach_shared_region+0xa8>
+  802ce4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ce8:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cef:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802cf5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802cf9:	eb 92                	jmp    802c8d <foreach_shared_region+0x86>
+}
+  802cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d00:	48 83 c4 18          	add    $0x18,%rsp
+  802d04:	5b                   	pop    %rbx
+  802d05:	41 5c                	pop    %r12
+  802d07:	41 5d                	pop    %r13
+  802d09:	41 5e                	pop    %r14
+  802d0b:	41 5f                	pop    %r15
+  802d0d:	5d                   	pop    %rbp
+  802d0e:	c3                   	ret
+
+0000000000802d0f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d14:	c3                   	ret
+
+0000000000802d15 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d15:	55                   	push   %rbp
+  802d16:	48 89 e5             	mov    %rsp,%rbp
+  802d19:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d1c:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d23:	00 00 00 
+  802d26:	48 b8 02 3a 80 00 00 	movabs $0x803a02,%rax
+  802d2d:	00 00 00 
+  802d30:	ff d0                	call   *%rax
+    return 0;
+}
+  802d32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d37:	5d                   	pop    %rbp
+  802d38:	c3                   	ret
+
+0000000000802d39 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d39:	55                   	push   %rbp
+  802d3a:	48 89 e5             	mov    %rsp,%rbp
+  802d3d:	41 57                	push   %r15
+  802d3f:	41 56                	push   %r14
+  802d41:	41 55                	push   %r13
+  802d43:	41 54                	push   %r12
+  802d45:	53                   	push   %rbx
+  802d46:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d4d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d54:	48 85 d2             	test   %rdx,%rdx
+  802d57:	74 7a                	je     802dd3 <devcons_write+0x9a>
+  802d59:	49 89 d6             	mov    %rdx,%r14
+  802d5c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d62:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d67:	49 bf 90 3d 80 00 00 	movabs $0x803d90,%r15
+  802d6e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d71:	4c 89 f3             	mov    %r14,%rbx
+  802d74:	48 29 f3             	sub    %rsi,%rbx
+  802d77:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d7c:	48 39 c3             	cmp    %rax,%rbx
+  802d7f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d83:	4c 63 eb             	movslq %ebx,%r13
+  802d86:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d8d:	48 01 c6             	add    %rax,%rsi
+  802d90:	4c 89 ea             	mov    %r13,%rdx
+  802d93:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d9a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d9d:	4c 89 ee             	mov    %r13,%rsi
+  802da0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802da7:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  802dae:	00 00 00 
+  802db1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802db3:	41 01 dc             	add    %ebx,%r12d
+  802db6:	49 63 f4             	movslq %r12d,%rsi
+  802db9:	4c 39 f6             	cmp    %r14,%rsi
+  802dbc:	72 b3                	jb     802d71 <devcons_write+0x38>
+    return res;
+  802dbe:	49 63 c4             	movslq %r12d,%rax
+}
+  802dc1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802dc8:	5b                   	pop    %rbx
+  802dc9:	41 5c                	pop    %r12
+  802dcb:	41 5d                	pop    %r13
+  802dcd:	41 5e                	pop    %r14
+  802dcf:	41 5f                	pop    %r15
+  802dd1:	5d                   	pop    %rbp
+  802dd2:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802dd3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dd9:	eb e3                	jmp    802dbe <devcons_write+0x85>
+
+0000000000802ddb <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ddb:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802dde:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de3:	48 85 c0             	test   %rax,%rax
+  802de6:	74 55                	je     802e3d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802de8:	55                   	push   %rbp
+  802de9:	48 89 e5             	mov    %rsp,%rbp
+  802dec:	41 55                	push   %r13
+  802dee:	41 54                	push   %r12
+  802df0:	53                   	push   %rbx
+  802df1:	48 83 ec 08          	sub    $0x8,%rsp
+  802df5:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802df8:	48 bb 3f 01 80 00 00 	movabs $0x80013f,%rbx
+  802dff:	00 00 00 
+  802e02:	49 bc 0c 02 80 00 00 	movabs $0x80020c,%r12
+  802e09:	00 00 00 
+  802e0c:	eb 03                	jmp    802e11 <devcons_read+0x36>
+  802e0e:	41 ff d4             	call   *%r12
+  802e11:	ff d3                	call   *%rbx
+  802e13:	85 c0                	test   %eax,%eax
+  802e15:	74 f7                	je     802e0e <devcons_read+0x33>
+    if (c < 0) return c;
+  802e17:	48 63 d0             	movslq %eax,%rdx
+  802e1a:	78 13                	js     802e2f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e21:	83 f8 04             	cmp    $0x4,%eax
+  802e24:	74 09                	je     802e2f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e26:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e2a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e2f:	48 89 d0             	mov    %rdx,%rax
+  802e32:	48 83 c4 08          	add    $0x8,%rsp
+  802e36:	5b                   	pop    %rbx
+  802e37:	41 5c                	pop    %r12
+  802e39:	41 5d                	pop    %r13
+  802e3b:	5d                   	pop    %rbp
+  802e3c:	c3                   	ret
+  802e3d:	48 89 d0             	mov    %rdx,%rax
+  802e40:	c3                   	ret
+
+0000000000802e41 <cputchar>:
+cputchar(int ch) {
+  802e41:	55                   	push   %rbp
+  802e42:	48 89 e5             	mov    %rsp,%rbp
+  802e45:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e49:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e4d:	be 01 00 00 00       	mov    $0x1,%esi
+  802e52:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e56:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  802e5d:	00 00 00 
+  802e60:	ff d0                	call   *%rax
+}
+  802e62:	c9                   	leave
+  802e63:	c3                   	ret
+
+0000000000802e64 <getchar>:
+getchar(void) {
+  802e64:	55                   	push   %rbp
+  802e65:	48 89 e5             	mov    %rsp,%rbp
+  802e68:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e6c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e71:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e75:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e7a:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  802e81:	00 00 00 
+  802e84:	ff d0                	call   *%rax
+  802e86:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e88:	85 c0                	test   %eax,%eax
+  802e8a:	78 06                	js     802e92 <getchar+0x2e>
+  802e8c:	74 08                	je     802e96 <getchar+0x32>
+  802e8e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e92:	89 d0                	mov    %edx,%eax
+  802e94:	c9                   	leave
+  802e95:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e96:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e9b:	eb f5                	jmp    802e92 <getchar+0x2e>
+
+0000000000802e9d <iscons>:
+iscons(int fdnum) {
+  802e9d:	55                   	push   %rbp
+  802e9e:	48 89 e5             	mov    %rsp,%rbp
+  802ea1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ea5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ea9:	48 b8 3f 0d 80 00 00 	movabs $0x800d3f,%rax
+  802eb0:	00 00 00 
+  802eb3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802eb5:	85 c0                	test   %eax,%eax
+  802eb7:	78 18                	js     802ed1 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802eb9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ebd:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802ec4:	00 00 00 
+  802ec7:	8b 00                	mov    (%rax),%eax
+  802ec9:	39 02                	cmp    %eax,(%rdx)
+  802ecb:	0f 94 c0             	sete   %al
+  802ece:	0f b6 c0             	movzbl %al,%eax
+}
+  802ed1:	c9                   	leave
+  802ed2:	c3                   	ret
+
+0000000000802ed3 <opencons>:
+opencons(void) {
+  802ed3:	55                   	push   %rbp
+  802ed4:	48 89 e5             	mov    %rsp,%rbp
+  802ed7:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802edb:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802edf:	48 b8 df 0c 80 00 00 	movabs $0x800cdf,%rax
+  802ee6:	00 00 00 
+  802ee9:	ff d0                	call   *%rax
+  802eeb:	85 c0                	test   %eax,%eax
+  802eed:	78 49                	js     802f38 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802eef:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ef4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ef9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802efd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f02:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  802f09:	00 00 00 
+  802f0c:	ff d0                	call   *%rax
+  802f0e:	85 c0                	test   %eax,%eax
+  802f10:	78 26                	js     802f38 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f12:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f16:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802f1d:	00 00 
+  802f1f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f21:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f25:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f2c:	48 b8 b1 0c 80 00 00 	movabs $0x800cb1,%rax
+  802f33:	00 00 00 
+  802f36:	ff d0                	call   *%rax
+}
+  802f38:	c9                   	leave
+  802f39:	c3                   	ret
+
+0000000000802f3a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f3a:	55                   	push   %rbp
+  802f3b:	48 89 e5             	mov    %rsp,%rbp
+  802f3e:	41 56                	push   %r14
+  802f40:	41 55                	push   %r13
+  802f42:	41 54                	push   %r12
+  802f44:	53                   	push   %rbx
+  802f45:	48 83 ec 50          	sub    $0x50,%rsp
+  802f49:	49 89 fc             	mov    %rdi,%r12
+  802f4c:	41 89 f5             	mov    %esi,%r13d
+  802f4f:	48 89 d3             	mov    %rdx,%rbx
+  802f52:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802f56:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802f5a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f5e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802f65:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f69:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f6d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802f71:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f75:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802f7c:	00 00 00 
+  802f7f:	4c 8b 30             	mov    (%rax),%r14
+  802f82:	48 b8 db 01 80 00 00 	movabs $0x8001db,%rax
+  802f89:	00 00 00 
+  802f8c:	ff d0                	call   *%rax
+  802f8e:	89 c6                	mov    %eax,%esi
+  802f90:	45 89 e8             	mov    %r13d,%r8d
+  802f93:	4c 89 e1             	mov    %r12,%rcx
+  802f96:	4c 89 f2             	mov    %r14,%rdx
+  802f99:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802fa0:	00 00 00 
+  802fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa8:	49 bc 8a 30 80 00 00 	movabs $0x80308a,%r12
+  802faf:	00 00 00 
+  802fb2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802fb5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802fb9:	48 89 df             	mov    %rbx,%rdi
+  802fbc:	48 b8 26 30 80 00 00 	movabs $0x803026,%rax
+  802fc3:	00 00 00 
+  802fc6:	ff d0                	call   *%rax
+    cprintf("\n");
+  802fc8:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  802fcf:	00 00 00 
+  802fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd7:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802fda:	cc                   	int3
+  802fdb:	eb fd                	jmp    802fda <_panic+0xa0>
+
+0000000000802fdd <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802fdd:	55                   	push   %rbp
+  802fde:	48 89 e5             	mov    %rsp,%rbp
+  802fe1:	53                   	push   %rbx
+  802fe2:	48 83 ec 08          	sub    $0x8,%rsp
+  802fe6:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802fe9:	8b 06                	mov    (%rsi),%eax
+  802feb:	8d 50 01             	lea    0x1(%rax),%edx
+  802fee:	89 16                	mov    %edx,(%rsi)
+  802ff0:	48 98                	cltq
+  802ff2:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802ff7:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802ffd:	74 0a                	je     803009 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802fff:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803003:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803007:	c9                   	leave
+  803008:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803009:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80300d:	be ff 00 00 00       	mov    $0xff,%esi
+  803012:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  803019:	00 00 00 
+  80301c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80301e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803024:	eb d9                	jmp    802fff <putch+0x22>
+
+0000000000803026 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803026:	55                   	push   %rbp
+  803027:	48 89 e5             	mov    %rsp,%rbp
+  80302a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803031:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803034:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80303b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803040:	b8 00 00 00 00       	mov    $0x0,%eax
+  803045:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803048:	48 89 f1             	mov    %rsi,%rcx
+  80304b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803052:	48 bf dd 2f 80 00 00 	movabs $0x802fdd,%rdi
+  803059:	00 00 00 
+  80305c:	48 b8 da 31 80 00 00 	movabs $0x8031da,%rax
+  803063:	00 00 00 
+  803066:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803068:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80306f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803076:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  80307d:	00 00 00 
+  803080:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  803082:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  803088:	c9                   	leave
+  803089:	c3                   	ret
+
+000000000080308a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80308a:	55                   	push   %rbp
+  80308b:	48 89 e5             	mov    %rsp,%rbp
+  80308e:	48 83 ec 50          	sub    $0x50,%rsp
+  803092:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803096:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80309a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80309e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8030a2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8030a6:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8030ad:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030b5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8030bd:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8030c1:	48 b8 26 30 80 00 00 	movabs $0x803026,%rax
+  8030c8:	00 00 00 
+  8030cb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8030cd:	c9                   	leave
+  8030ce:	c3                   	ret
+
+00000000008030cf <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8030cf:	55                   	push   %rbp
+  8030d0:	48 89 e5             	mov    %rsp,%rbp
+  8030d3:	41 57                	push   %r15
+  8030d5:	41 56                	push   %r14
+  8030d7:	41 55                	push   %r13
+  8030d9:	41 54                	push   %r12
+  8030db:	53                   	push   %rbx
+  8030dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8030e0:	49 89 fc             	mov    %rdi,%r12
+  8030e3:	49 89 f5             	mov    %rsi,%r13
+  8030e6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8030ea:	8b 45 10             	mov    0x10(%rbp),%eax
+  8030ed:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8030f0:	41 89 cf             	mov    %ecx,%r15d
+  8030f3:	4c 39 fa             	cmp    %r15,%rdx
+  8030f6:	73 5b                	jae    803153 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8030f8:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8030fc:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803100:	85 db                	test   %ebx,%ebx
+  803102:	7e 0e                	jle    803112 <print_num+0x43>
+            putch(padc, put_arg);
+  803104:	4c 89 ee             	mov    %r13,%rsi
+  803107:	44 89 f7             	mov    %r14d,%edi
+  80310a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80310d:	83 eb 01             	sub    $0x1,%ebx
+  803110:	75 f2                	jne    803104 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803112:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803116:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  80311d:	00 00 00 
+  803120:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  803127:	00 00 00 
+  80312a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80312e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803132:	ba 00 00 00 00       	mov    $0x0,%edx
+  803137:	49 f7 f7             	div    %r15
+  80313a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80313e:	4c 89 ee             	mov    %r13,%rsi
+  803141:	41 ff d4             	call   *%r12
+}
+  803144:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803148:	5b                   	pop    %rbx
+  803149:	41 5c                	pop    %r12
+  80314b:	41 5d                	pop    %r13
+  80314d:	41 5e                	pop    %r14
+  80314f:	41 5f                	pop    %r15
+  803151:	5d                   	pop    %rbp
+  803152:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803153:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803157:	ba 00 00 00 00       	mov    $0x0,%edx
+  80315c:	49 f7 f7             	div    %r15
+  80315f:	48 83 ec 08          	sub    $0x8,%rsp
+  803163:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803167:	52                   	push   %rdx
+  803168:	45 0f be c9          	movsbl %r9b,%r9d
+  80316c:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803170:	48 89 c2             	mov    %rax,%rdx
+  803173:	48 b8 cf 30 80 00 00 	movabs $0x8030cf,%rax
+  80317a:	00 00 00 
+  80317d:	ff d0                	call   *%rax
+  80317f:	48 83 c4 10          	add    $0x10,%rsp
+  803183:	eb 8d                	jmp    803112 <print_num+0x43>
+
+0000000000803185 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803185:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  803189:	48 8b 06             	mov    (%rsi),%rax
+  80318c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  803190:	73 0a                	jae    80319c <sprintputch+0x17>
+        *state->start++ = ch;
+  803192:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803196:	48 89 16             	mov    %rdx,(%rsi)
+  803199:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80319c:	c3                   	ret
+
+000000000080319d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80319d:	55                   	push   %rbp
+  80319e:	48 89 e5             	mov    %rsp,%rbp
+  8031a1:	48 83 ec 50          	sub    $0x50,%rsp
+  8031a5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8031a9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8031ad:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8031b1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8031b8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031c0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031c4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8031c8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8031cc:	48 b8 da 31 80 00 00 	movabs $0x8031da,%rax
+  8031d3:	00 00 00 
+  8031d6:	ff d0                	call   *%rax
+}
+  8031d8:	c9                   	leave
+  8031d9:	c3                   	ret
+
+00000000008031da <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8031da:	55                   	push   %rbp
+  8031db:	48 89 e5             	mov    %rsp,%rbp
+  8031de:	41 57                	push   %r15
+  8031e0:	41 56                	push   %r14
+  8031e2:	41 55                	push   %r13
+  8031e4:	41 54                	push   %r12
+  8031e6:	53                   	push   %rbx
+  8031e7:	48 83 ec 38          	sub    $0x38,%rsp
+  8031eb:	49 89 fe             	mov    %rdi,%r14
+  8031ee:	49 89 f5             	mov    %rsi,%r13
+  8031f1:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8031f4:	48 8b 01             	mov    (%rcx),%rax
+  8031f7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031fb:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8031ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803203:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803207:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80320b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80320f:	0f b6 3b             	movzbl (%rbx),%edi
+  803212:	40 80 ff 25          	cmp    $0x25,%dil
+  803216:	74 18                	je     803230 <vprintfmt+0x56>
+            if (!ch) return;
+  803218:	40 84 ff             	test   %dil,%dil
+  80321b:	0f 84 04 07 00 00    	je     803925 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  803221:	40 0f b6 ff          	movzbl %dil,%edi
+  803225:	4c 89 ee             	mov    %r13,%rsi
+  803228:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80322b:	4c 89 e3             	mov    %r12,%rbx
+  80322e:	eb db                	jmp    80320b <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803230:	be 00 00 00 00       	mov    $0x0,%esi
+  803235:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803239:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80323e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803244:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80324b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80324f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803254:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803259:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80325c:	83 e8 23             	sub    $0x23,%eax
+  80325f:	3c 57                	cmp    $0x57,%al
+  803261:	0f 87 a4 06 00 00    	ja     80390b <vprintfmt+0x731>
+  803267:	0f b6 c0             	movzbl %al,%eax
+  80326a:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  803271:	00 00 00 
+  803274:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803277:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80327a:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80327e:	eb cf                	jmp    80324f <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  803280:	49 89 dc             	mov    %rbx,%r12
+  803283:	be 01 00 00 00       	mov    $0x1,%esi
+  803288:	eb c5                	jmp    80324f <vprintfmt+0x75>
+            padc = ch;
+  80328a:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80328e:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803291:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803294:	eb b9                	jmp    80324f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803296:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803299:	83 f8 2f             	cmp    $0x2f,%eax
+  80329c:	77 24                	ja     8032c2 <vprintfmt+0xe8>
+  80329e:	89 c1                	mov    %eax,%ecx
+  8032a0:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8032a4:	83 c0 08             	add    $0x8,%eax
+  8032a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032aa:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8032ad:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8032b0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8032b4:	79 99                	jns    80324f <vprintfmt+0x75>
+                width = precision;
+  8032b6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8032ba:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8032c0:	eb 8d                	jmp    80324f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032c2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032c6:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8032ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032ce:	eb da                	jmp    8032aa <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8032d0:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8032d5:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032d9:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8032df:	3c 39                	cmp    $0x39,%al
+  8032e1:	77 1c                	ja     8032ff <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8032e3:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8032e7:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8032eb:	0f b6 c0             	movzbl %al,%eax
+  8032ee:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032f3:	0f b6 03             	movzbl (%rbx),%eax
+  8032f6:	3c 39                	cmp    $0x39,%al
+  8032f8:	76 e9                	jbe    8032e3 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8032fa:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8032fd:	eb b1                	jmp    8032b0 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8032ff:	49 89 dc             	mov    %rbx,%r12
+  803302:	eb ac                	jmp    8032b0 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803304:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803307:	85 c9                	test   %ecx,%ecx
+  803309:	b8 00 00 00 00       	mov    $0x0,%eax
+  80330e:	0f 49 c1             	cmovns %ecx,%eax
+  803311:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803314:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803317:	e9 33 ff ff ff       	jmp    80324f <vprintfmt+0x75>
+            lflag++;
+  80331c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80331f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803322:	e9 28 ff ff ff       	jmp    80324f <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803327:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80332a:	83 f8 2f             	cmp    $0x2f,%eax
+  80332d:	77 19                	ja     803348 <vprintfmt+0x16e>
+  80332f:	89 c2                	mov    %eax,%edx
+  803331:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803335:	83 c0 08             	add    $0x8,%eax
+  803338:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80333b:	8b 3a                	mov    (%rdx),%edi
+  80333d:	4c 89 ee             	mov    %r13,%rsi
+  803340:	41 ff d6             	call   *%r14
+            break;
+  803343:	e9 c3 fe ff ff       	jmp    80320b <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803348:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80334c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803350:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803354:	eb e5                	jmp    80333b <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803356:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803359:	83 f8 2f             	cmp    $0x2f,%eax
+  80335c:	77 5a                	ja     8033b8 <vprintfmt+0x1de>
+  80335e:	89 c2                	mov    %eax,%edx
+  803360:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803364:	83 c0 08             	add    $0x8,%eax
+  803367:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80336a:	8b 02                	mov    (%rdx),%eax
+  80336c:	89 c1                	mov    %eax,%ecx
+  80336e:	f7 d9                	neg    %ecx
+  803370:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803373:	83 f9 13             	cmp    $0x13,%ecx
+  803376:	7f 4e                	jg     8033c6 <vprintfmt+0x1ec>
+  803378:	48 63 c1             	movslq %ecx,%rax
+  80337b:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  803382:	00 00 00 
+  803385:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803389:	48 85 c0             	test   %rax,%rax
+  80338c:	74 38                	je     8033c6 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80338e:	48 89 c1             	mov    %rax,%rcx
+  803391:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  803398:	00 00 00 
+  80339b:	4c 89 ee             	mov    %r13,%rsi
+  80339e:	4c 89 f7             	mov    %r14,%rdi
+  8033a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a6:	49 b8 9d 31 80 00 00 	movabs $0x80319d,%r8
+  8033ad:	00 00 00 
+  8033b0:	41 ff d0             	call   *%r8
+  8033b3:	e9 53 fe ff ff       	jmp    80320b <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8033b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033c4:	eb a4                	jmp    80336a <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8033c6:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  8033cd:	00 00 00 
+  8033d0:	4c 89 ee             	mov    %r13,%rsi
+  8033d3:	4c 89 f7             	mov    %r14,%rdi
+  8033d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033db:	49 b8 9d 31 80 00 00 	movabs $0x80319d,%r8
+  8033e2:	00 00 00 
+  8033e5:	41 ff d0             	call   *%r8
+  8033e8:	e9 1e fe ff ff       	jmp    80320b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8033ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8033f3:	77 36                	ja     80342b <vprintfmt+0x251>
+  8033f5:	89 c2                	mov    %eax,%edx
+  8033f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033fb:	83 c0 08             	add    $0x8,%eax
+  8033fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803401:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  803404:	48 85 f6             	test   %rsi,%rsi
+  803407:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  80340e:	00 00 00 
+  803411:	48 0f 45 c6          	cmovne %rsi,%rax
+  803415:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803419:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80341d:	7e 06                	jle    803425 <vprintfmt+0x24b>
+  80341f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803423:	75 14                	jne    803439 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803425:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803429:	eb 5b                	jmp    803486 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80342b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80342f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803433:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803437:	eb c8                	jmp    803401 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803439:	49 63 f7             	movslq %r15d,%rsi
+  80343c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803440:	48 b8 df 39 80 00 00 	movabs $0x8039df,%rax
+  803447:	00 00 00 
+  80344a:	ff d0                	call   *%rax
+  80344c:	48 89 c2             	mov    %rax,%rdx
+  80344f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803452:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803454:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803457:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80345a:	85 c0                	test   %eax,%eax
+  80345c:	7e c7                	jle    803425 <vprintfmt+0x24b>
+  80345e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803463:	4c 89 ee             	mov    %r13,%rsi
+  803466:	44 89 e7             	mov    %r12d,%edi
+  803469:	41 ff d6             	call   *%r14
+  80346c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803470:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803473:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803476:	75 eb                	jne    803463 <vprintfmt+0x289>
+  803478:	eb ab                	jmp    803425 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80347a:	0f b6 f8             	movzbl %al,%edi
+  80347d:	4c 89 ee             	mov    %r13,%rsi
+  803480:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  803483:	4c 89 e2             	mov    %r12,%rdx
+  803486:	45 85 ff             	test   %r15d,%r15d
+  803489:	78 06                	js     803491 <vprintfmt+0x2b7>
+  80348b:	41 83 ef 01          	sub    $0x1,%r15d
+  80348f:	78 23                	js     8034b4 <vprintfmt+0x2da>
+  803491:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  803495:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80349b:	84 c0                	test   %al,%al
+  80349d:	74 15                	je     8034b4 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80349f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8034a3:	74 d5                	je     80347a <vprintfmt+0x2a0>
+  8034a5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8034a8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8034ad:	80 fa 5e             	cmp    $0x5e,%dl
+  8034b0:	77 cb                	ja     80347d <vprintfmt+0x2a3>
+  8034b2:	eb c6                	jmp    80347a <vprintfmt+0x2a0>
+  8034b4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8034b7:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8034ba:	01 f0                	add    %esi,%eax
+  8034bc:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8034be:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8034c2:	85 c0                	test   %eax,%eax
+  8034c4:	0f 8e 41 fd ff ff    	jle    80320b <vprintfmt+0x31>
+  8034ca:	4c 89 ee             	mov    %r13,%rsi
+  8034cd:	bf 20 00 00 00       	mov    $0x20,%edi
+  8034d2:	41 ff d6             	call   *%r14
+  8034d5:	41 83 ec 01          	sub    $0x1,%r12d
+  8034d9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8034dd:	75 eb                	jne    8034ca <vprintfmt+0x2f0>
+  8034df:	e9 27 fd ff ff       	jmp    80320b <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8034e4:	40 84 f6             	test   %sil,%sil
+  8034e7:	75 26                	jne    80350f <vprintfmt+0x335>
+    switch (lflag) {
+  8034e9:	85 d2                	test   %edx,%edx
+  8034eb:	74 59                	je     803546 <vprintfmt+0x36c>
+  8034ed:	83 fa 01             	cmp    $0x1,%edx
+  8034f0:	74 7b                	je     80356d <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8034f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8034f8:	0f 87 96 00 00 00    	ja     803594 <vprintfmt+0x3ba>
+  8034fe:	89 c2                	mov    %eax,%edx
+  803500:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803504:	83 c0 08             	add    $0x8,%eax
+  803507:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80350a:	4c 8b 22             	mov    (%rdx),%r12
+  80350d:	eb 17                	jmp    803526 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80350f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803512:	83 f8 2f             	cmp    $0x2f,%eax
+  803515:	77 21                	ja     803538 <vprintfmt+0x35e>
+  803517:	89 c2                	mov    %eax,%edx
+  803519:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80351d:	83 c0 08             	add    $0x8,%eax
+  803520:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803523:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803526:	4d 85 e4             	test   %r12,%r12
+  803529:	78 7a                	js     8035a5 <vprintfmt+0x3cb>
+            num = i;
+  80352b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80352e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803533:	e9 b5 02 00 00       	jmp    8037ed <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803538:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80353c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803540:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803544:	eb dd                	jmp    803523 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  803546:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803549:	83 f8 2f             	cmp    $0x2f,%eax
+  80354c:	77 11                	ja     80355f <vprintfmt+0x385>
+  80354e:	89 c2                	mov    %eax,%edx
+  803550:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803554:	83 c0 08             	add    $0x8,%eax
+  803557:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80355a:	4c 63 22             	movslq (%rdx),%r12
+  80355d:	eb c7                	jmp    803526 <vprintfmt+0x34c>
+  80355f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803563:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803567:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80356b:	eb ed                	jmp    80355a <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80356d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803570:	83 f8 2f             	cmp    $0x2f,%eax
+  803573:	77 11                	ja     803586 <vprintfmt+0x3ac>
+  803575:	89 c2                	mov    %eax,%edx
+  803577:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80357b:	83 c0 08             	add    $0x8,%eax
+  80357e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803581:	4c 8b 22             	mov    (%rdx),%r12
+  803584:	eb a0                	jmp    803526 <vprintfmt+0x34c>
+  803586:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80358a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80358e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803592:	eb ed                	jmp    803581 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  803594:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803598:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80359c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035a0:	e9 65 ff ff ff       	jmp    80350a <vprintfmt+0x330>
+                putch('-', put_arg);
+  8035a5:	4c 89 ee             	mov    %r13,%rsi
+  8035a8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8035ad:	41 ff d6             	call   *%r14
+                i = -i;
+  8035b0:	49 f7 dc             	neg    %r12
+  8035b3:	e9 73 ff ff ff       	jmp    80352b <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8035b8:	40 84 f6             	test   %sil,%sil
+  8035bb:	75 32                	jne    8035ef <vprintfmt+0x415>
+    switch (lflag) {
+  8035bd:	85 d2                	test   %edx,%edx
+  8035bf:	74 5d                	je     80361e <vprintfmt+0x444>
+  8035c1:	83 fa 01             	cmp    $0x1,%edx
+  8035c4:	0f 84 82 00 00 00    	je     80364c <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8035ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8035d0:	0f 87 a5 00 00 00    	ja     80367b <vprintfmt+0x4a1>
+  8035d6:	89 c2                	mov    %eax,%edx
+  8035d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035dc:	83 c0 08             	add    $0x8,%eax
+  8035df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035e2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035e5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8035ea:	e9 fe 01 00 00       	jmp    8037ed <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8035ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8035f5:	77 19                	ja     803610 <vprintfmt+0x436>
+  8035f7:	89 c2                	mov    %eax,%edx
+  8035f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035fd:	83 c0 08             	add    $0x8,%eax
+  803600:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803603:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803606:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80360b:	e9 dd 01 00 00       	jmp    8037ed <vprintfmt+0x613>
+  803610:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803614:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803618:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80361c:	eb e5                	jmp    803603 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80361e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803621:	83 f8 2f             	cmp    $0x2f,%eax
+  803624:	77 18                	ja     80363e <vprintfmt+0x464>
+  803626:	89 c2                	mov    %eax,%edx
+  803628:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80362c:	83 c0 08             	add    $0x8,%eax
+  80362f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803632:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803634:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803639:	e9 af 01 00 00       	jmp    8037ed <vprintfmt+0x613>
+  80363e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803642:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803646:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80364a:	eb e6                	jmp    803632 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80364c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80364f:	83 f8 2f             	cmp    $0x2f,%eax
+  803652:	77 19                	ja     80366d <vprintfmt+0x493>
+  803654:	89 c2                	mov    %eax,%edx
+  803656:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80365a:	83 c0 08             	add    $0x8,%eax
+  80365d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803660:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803663:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803668:	e9 80 01 00 00       	jmp    8037ed <vprintfmt+0x613>
+  80366d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803671:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803675:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803679:	eb e5                	jmp    803660 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80367b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80367f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803683:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803687:	e9 56 ff ff ff       	jmp    8035e2 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80368c:	40 84 f6             	test   %sil,%sil
+  80368f:	75 2e                	jne    8036bf <vprintfmt+0x4e5>
+    switch (lflag) {
+  803691:	85 d2                	test   %edx,%edx
+  803693:	0f 84 b3 00 00 00    	je     80374c <vprintfmt+0x572>
+  803699:	83 fa 01             	cmp    $0x1,%edx
+  80369c:	0f 84 d3 00 00 00    	je     803775 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8036a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8036a8:	0f 87 f1 00 00 00    	ja     80379f <vprintfmt+0x5c5>
+  8036ae:	89 c2                	mov    %eax,%edx
+  8036b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036b4:	83 c0 08             	add    $0x8,%eax
+  8036b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036ba:	48 8b 02             	mov    (%rdx),%rax
+  8036bd:	eb 17                	jmp    8036d6 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8036c5:	77 77                	ja     80373e <vprintfmt+0x564>
+  8036c7:	89 c2                	mov    %eax,%edx
+  8036c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036cd:	83 c0 08             	add    $0x8,%eax
+  8036d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036d3:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8036d6:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036d8:	83 f8 07             	cmp    $0x7,%eax
+  8036db:	0f 8e cf 00 00 00    	jle    8037b0 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8036e1:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036e7:	44 89 e7             	mov    %r12d,%edi
+  8036ea:	41 c1 e4 03          	shl    $0x3,%r12d
+  8036ee:	89 d1                	mov    %edx,%ecx
+  8036f0:	8d 72 07             	lea    0x7(%rdx),%esi
+  8036f3:	85 d2                	test   %edx,%edx
+  8036f5:	0f 48 d6             	cmovs  %esi,%edx
+  8036f8:	c1 fa 03             	sar    $0x3,%edx
+  8036fb:	83 f9 3f             	cmp    $0x3f,%ecx
+  8036fe:	7f e7                	jg     8036e7 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  803700:	85 ff                	test   %edi,%edi
+  803702:	0f 84 03 fb ff ff    	je     80320b <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  803708:	49 63 f4             	movslq %r12d,%rsi
+  80370b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803710:	48 f7 f6             	div    %rsi
+  803713:	49 89 d7             	mov    %rdx,%r15
+  803716:	83 c0 30             	add    $0x30,%eax
+  803719:	0f be f8             	movsbl %al,%edi
+  80371c:	4c 89 ee             	mov    %r13,%rsi
+  80371f:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  803722:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  803725:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  80372a:	45 85 e4             	test   %r12d,%r12d
+  80372d:	41 0f 49 d4          	cmovns %r12d,%edx
+  803731:	c1 fa 03             	sar    $0x3,%edx
+  803734:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  803737:	75 cf                	jne    803708 <vprintfmt+0x52e>
+  803739:	e9 cd fa ff ff       	jmp    80320b <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80373e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803742:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803746:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80374a:	eb 87                	jmp    8036d3 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80374c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80374f:	83 f8 2f             	cmp    $0x2f,%eax
+  803752:	77 13                	ja     803767 <vprintfmt+0x58d>
+  803754:	89 c2                	mov    %eax,%edx
+  803756:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80375a:	83 c0 08             	add    $0x8,%eax
+  80375d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803760:	8b 02                	mov    (%rdx),%eax
+  803762:	e9 6f ff ff ff       	jmp    8036d6 <vprintfmt+0x4fc>
+  803767:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80376b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80376f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803773:	eb eb                	jmp    803760 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  803775:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803778:	83 f8 2f             	cmp    $0x2f,%eax
+  80377b:	77 14                	ja     803791 <vprintfmt+0x5b7>
+  80377d:	89 c2                	mov    %eax,%edx
+  80377f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803783:	83 c0 08             	add    $0x8,%eax
+  803786:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803789:	48 8b 02             	mov    (%rdx),%rax
+  80378c:	e9 45 ff ff ff       	jmp    8036d6 <vprintfmt+0x4fc>
+  803791:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803795:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803799:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80379d:	eb ea                	jmp    803789 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  80379f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037ab:	e9 0a ff ff ff       	jmp    8036ba <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8037b0:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8037b6:	e9 4d ff ff ff       	jmp    803708 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8037bb:	4c 89 ee             	mov    %r13,%rsi
+  8037be:	bf 30 00 00 00       	mov    $0x30,%edi
+  8037c3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8037c6:	4c 89 ee             	mov    %r13,%rsi
+  8037c9:	bf 78 00 00 00       	mov    $0x78,%edi
+  8037ce:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8037d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8037d7:	77 47                	ja     803820 <vprintfmt+0x646>
+  8037d9:	89 c2                	mov    %eax,%edx
+  8037db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037df:	83 c0 08             	add    $0x8,%eax
+  8037e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037e5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8037e8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8037ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8037f1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8037f5:	0f 94 c0             	sete   %al
+  8037f8:	0f b6 c0             	movzbl %al,%eax
+  8037fb:	50                   	push   %rax
+  8037fc:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803801:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803805:	4c 89 ee             	mov    %r13,%rsi
+  803808:	4c 89 f7             	mov    %r14,%rdi
+  80380b:	48 b8 cf 30 80 00 00 	movabs $0x8030cf,%rax
+  803812:	00 00 00 
+  803815:	ff d0                	call   *%rax
+            break;
+  803817:	48 83 c4 10          	add    $0x10,%rsp
+  80381b:	e9 eb f9 ff ff       	jmp    80320b <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803820:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803824:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803828:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80382c:	eb b7                	jmp    8037e5 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  80382e:	40 84 f6             	test   %sil,%sil
+  803831:	75 2b                	jne    80385e <vprintfmt+0x684>
+    switch (lflag) {
+  803833:	85 d2                	test   %edx,%edx
+  803835:	74 56                	je     80388d <vprintfmt+0x6b3>
+  803837:	83 fa 01             	cmp    $0x1,%edx
+  80383a:	74 7f                	je     8038bb <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  80383c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80383f:	83 f8 2f             	cmp    $0x2f,%eax
+  803842:	0f 87 a2 00 00 00    	ja     8038ea <vprintfmt+0x710>
+  803848:	89 c2                	mov    %eax,%edx
+  80384a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80384e:	83 c0 08             	add    $0x8,%eax
+  803851:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803854:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803857:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80385c:	eb 8f                	jmp    8037ed <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80385e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803861:	83 f8 2f             	cmp    $0x2f,%eax
+  803864:	77 19                	ja     80387f <vprintfmt+0x6a5>
+  803866:	89 c2                	mov    %eax,%edx
+  803868:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80386c:	83 c0 08             	add    $0x8,%eax
+  80386f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803872:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803875:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80387a:	e9 6e ff ff ff       	jmp    8037ed <vprintfmt+0x613>
+  80387f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803883:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803887:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80388b:	eb e5                	jmp    803872 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  80388d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803890:	83 f8 2f             	cmp    $0x2f,%eax
+  803893:	77 18                	ja     8038ad <vprintfmt+0x6d3>
+  803895:	89 c2                	mov    %eax,%edx
+  803897:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80389b:	83 c0 08             	add    $0x8,%eax
+  80389e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038a1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8038a3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8038a8:	e9 40 ff ff ff       	jmp    8037ed <vprintfmt+0x613>
+  8038ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038b9:	eb e6                	jmp    8038a1 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8038bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038be:	83 f8 2f             	cmp    $0x2f,%eax
+  8038c1:	77 19                	ja     8038dc <vprintfmt+0x702>
+  8038c3:	89 c2                	mov    %eax,%edx
+  8038c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038c9:	83 c0 08             	add    $0x8,%eax
+  8038cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038cf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038d2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8038d7:	e9 11 ff ff ff       	jmp    8037ed <vprintfmt+0x613>
+  8038dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038e8:	eb e5                	jmp    8038cf <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  8038ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038f6:	e9 59 ff ff ff       	jmp    803854 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8038fb:	4c 89 ee             	mov    %r13,%rsi
+  8038fe:	bf 25 00 00 00       	mov    $0x25,%edi
+  803903:	41 ff d6             	call   *%r14
+            break;
+  803906:	e9 00 f9 ff ff       	jmp    80320b <vprintfmt+0x31>
+            putch('%', put_arg);
+  80390b:	4c 89 ee             	mov    %r13,%rsi
+  80390e:	bf 25 00 00 00       	mov    $0x25,%edi
+  803913:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803916:	48 83 eb 01          	sub    $0x1,%rbx
+  80391a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80391e:	75 f6                	jne    803916 <vprintfmt+0x73c>
+  803920:	e9 e6 f8 ff ff       	jmp    80320b <vprintfmt+0x31>
+}
+  803925:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803929:	5b                   	pop    %rbx
+  80392a:	41 5c                	pop    %r12
+  80392c:	41 5d                	pop    %r13
+  80392e:	41 5e                	pop    %r14
+  803930:	41 5f                	pop    %r15
+  803932:	5d                   	pop    %rbp
+  803933:	c3                   	ret
+
+0000000000803934 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803934:	55                   	push   %rbp
+  803935:	48 89 e5             	mov    %rsp,%rbp
+  803938:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80393c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803940:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803945:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803949:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803950:	48 85 ff             	test   %rdi,%rdi
+  803953:	74 2b                	je     803980 <vsnprintf+0x4c>
+  803955:	48 85 f6             	test   %rsi,%rsi
+  803958:	74 26                	je     803980 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80395a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80395e:	48 bf 85 31 80 00 00 	movabs $0x803185,%rdi
+  803965:	00 00 00 
+  803968:	48 b8 da 31 80 00 00 	movabs $0x8031da,%rax
+  80396f:	00 00 00 
+  803972:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803974:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803978:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80397b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80397e:	c9                   	leave
+  80397f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803980:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803985:	eb f7                	jmp    80397e <vsnprintf+0x4a>
+
+0000000000803987 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803987:	55                   	push   %rbp
+  803988:	48 89 e5             	mov    %rsp,%rbp
+  80398b:	48 83 ec 50          	sub    $0x50,%rsp
+  80398f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803993:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803997:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80399b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8039a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8039a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039aa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8039ae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8039b2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8039b6:	48 b8 34 39 80 00 00 	movabs $0x803934,%rax
+  8039bd:	00 00 00 
+  8039c0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8039c2:	c9                   	leave
+  8039c3:	c3                   	ret
+
+00000000008039c4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8039c4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8039c7:	74 10                	je     8039d9 <strlen+0x15>
+    size_t n = 0;
+  8039c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8039ce:	48 83 c0 01          	add    $0x1,%rax
+  8039d2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8039d6:	75 f6                	jne    8039ce <strlen+0xa>
+  8039d8:	c3                   	ret
+    size_t n = 0;
+  8039d9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8039de:	c3                   	ret
+
+00000000008039df <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8039df:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8039e2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8039e7:	48 85 f6             	test   %rsi,%rsi
+  8039ea:	74 11                	je     8039fd <strnlen+0x1e>
+  8039ec:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8039f0:	74 0c                	je     8039fe <strnlen+0x1f>
+  8039f2:	48 83 c2 01          	add    $0x1,%rdx
+  8039f6:	48 39 d0             	cmp    %rdx,%rax
+  8039f9:	75 f1                	jne    8039ec <strnlen+0xd>
+  8039fb:	eb 04                	jmp    803a01 <strnlen+0x22>
+  8039fd:	c3                   	ret
+  8039fe:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803a01:	c3                   	ret
+
+0000000000803a02 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803a02:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803a05:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a0a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803a0e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803a11:	48 83 c2 01          	add    $0x1,%rdx
+  803a15:	84 c9                	test   %cl,%cl
+  803a17:	75 f1                	jne    803a0a <strcpy+0x8>
+        ;
+    return res;
+}
+  803a19:	c3                   	ret
+
+0000000000803a1a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803a1a:	55                   	push   %rbp
+  803a1b:	48 89 e5             	mov    %rsp,%rbp
+  803a1e:	41 54                	push   %r12
+  803a20:	53                   	push   %rbx
+  803a21:	48 89 fb             	mov    %rdi,%rbx
+  803a24:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a27:	48 b8 c4 39 80 00 00 	movabs $0x8039c4,%rax
+  803a2e:	00 00 00 
+  803a31:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a33:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a37:	4c 89 e6             	mov    %r12,%rsi
+  803a3a:	48 b8 02 3a 80 00 00 	movabs $0x803a02,%rax
+  803a41:	00 00 00 
+  803a44:	ff d0                	call   *%rax
+    return dst;
+}
+  803a46:	48 89 d8             	mov    %rbx,%rax
+  803a49:	5b                   	pop    %rbx
+  803a4a:	41 5c                	pop    %r12
+  803a4c:	5d                   	pop    %rbp
+  803a4d:	c3                   	ret
+
+0000000000803a4e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803a4e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803a51:	48 85 d2             	test   %rdx,%rdx
+  803a54:	74 1f                	je     803a75 <strncpy+0x27>
+  803a56:	48 01 fa             	add    %rdi,%rdx
+  803a59:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803a5c:	48 83 c1 01          	add    $0x1,%rcx
+  803a60:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803a64:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803a68:	41 80 f8 01          	cmp    $0x1,%r8b
+  803a6c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803a70:	48 39 ca             	cmp    %rcx,%rdx
+  803a73:	75 e7                	jne    803a5c <strncpy+0xe>
+    }
+    return ret;
+}
+  803a75:	c3                   	ret
+
+0000000000803a76 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803a76:	48 89 f8             	mov    %rdi,%rax
+  803a79:	48 85 d2             	test   %rdx,%rdx
+  803a7c:	74 24                	je     803aa2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803a7e:	48 83 ea 01          	sub    $0x1,%rdx
+  803a82:	74 1b                	je     803a9f <strlcpy+0x29>
+  803a84:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803a88:	0f b6 16             	movzbl (%rsi),%edx
+  803a8b:	84 d2                	test   %dl,%dl
+  803a8d:	74 10                	je     803a9f <strlcpy+0x29>
+            *dst++ = *src++;
+  803a8f:	48 83 c6 01          	add    $0x1,%rsi
+  803a93:	48 83 c0 01          	add    $0x1,%rax
+  803a97:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803a9a:	48 39 c8             	cmp    %rcx,%rax
+  803a9d:	75 e9                	jne    803a88 <strlcpy+0x12>
+        *dst = '\0';
+  803a9f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803aa2:	48 29 f8             	sub    %rdi,%rax
+}
+  803aa5:	c3                   	ret
+
+0000000000803aa6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803aa6:	0f b6 07             	movzbl (%rdi),%eax
+  803aa9:	84 c0                	test   %al,%al
+  803aab:	74 13                	je     803ac0 <strcmp+0x1a>
+  803aad:	38 06                	cmp    %al,(%rsi)
+  803aaf:	75 0f                	jne    803ac0 <strcmp+0x1a>
+  803ab1:	48 83 c7 01          	add    $0x1,%rdi
+  803ab5:	48 83 c6 01          	add    $0x1,%rsi
+  803ab9:	0f b6 07             	movzbl (%rdi),%eax
+  803abc:	84 c0                	test   %al,%al
+  803abe:	75 ed                	jne    803aad <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ac0:	0f b6 c0             	movzbl %al,%eax
+  803ac3:	0f b6 16             	movzbl (%rsi),%edx
+  803ac6:	29 d0                	sub    %edx,%eax
+}
+  803ac8:	c3                   	ret
+
+0000000000803ac9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803ac9:	48 85 d2             	test   %rdx,%rdx
+  803acc:	74 1f                	je     803aed <strncmp+0x24>
+  803ace:	0f b6 07             	movzbl (%rdi),%eax
+  803ad1:	84 c0                	test   %al,%al
+  803ad3:	74 1e                	je     803af3 <strncmp+0x2a>
+  803ad5:	3a 06                	cmp    (%rsi),%al
+  803ad7:	75 1a                	jne    803af3 <strncmp+0x2a>
+  803ad9:	48 83 c7 01          	add    $0x1,%rdi
+  803add:	48 83 c6 01          	add    $0x1,%rsi
+  803ae1:	48 83 ea 01          	sub    $0x1,%rdx
+  803ae5:	75 e7                	jne    803ace <strncmp+0x5>
+
+    if (!n) return 0;
+  803ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aec:	c3                   	ret
+  803aed:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af2:	c3                   	ret
+  803af3:	48 85 d2             	test   %rdx,%rdx
+  803af6:	74 09                	je     803b01 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803af8:	0f b6 07             	movzbl (%rdi),%eax
+  803afb:	0f b6 16             	movzbl (%rsi),%edx
+  803afe:	29 d0                	sub    %edx,%eax
+  803b00:	c3                   	ret
+    if (!n) return 0;
+  803b01:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b06:	c3                   	ret
+
+0000000000803b07 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803b07:	0f b6 17             	movzbl (%rdi),%edx
+  803b0a:	84 d2                	test   %dl,%dl
+  803b0c:	74 18                	je     803b26 <strchr+0x1f>
+        if (*str == c) {
+  803b0e:	0f be d2             	movsbl %dl,%edx
+  803b11:	39 f2                	cmp    %esi,%edx
+  803b13:	74 17                	je     803b2c <strchr+0x25>
+    for (; *str; str++) {
+  803b15:	48 83 c7 01          	add    $0x1,%rdi
+  803b19:	0f b6 17             	movzbl (%rdi),%edx
+  803b1c:	84 d2                	test   %dl,%dl
+  803b1e:	75 ee                	jne    803b0e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b20:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b25:	c3                   	ret
+  803b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2b:	c3                   	ret
+  803b2c:	48 89 f8             	mov    %rdi,%rax
+}
+  803b2f:	c3                   	ret
+
+0000000000803b30 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b30:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b33:	0f b6 17             	movzbl (%rdi),%edx
+  803b36:	84 d2                	test   %dl,%dl
+  803b38:	74 13                	je     803b4d <strfind+0x1d>
+  803b3a:	0f be d2             	movsbl %dl,%edx
+  803b3d:	39 f2                	cmp    %esi,%edx
+  803b3f:	74 0b                	je     803b4c <strfind+0x1c>
+  803b41:	48 83 c0 01          	add    $0x1,%rax
+  803b45:	0f b6 10             	movzbl (%rax),%edx
+  803b48:	84 d2                	test   %dl,%dl
+  803b4a:	75 ee                	jne    803b3a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803b4c:	c3                   	ret
+  803b4d:	c3                   	ret
+
+0000000000803b4e <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803b4e:	55                   	push   %rbp
+  803b4f:	48 89 e5             	mov    %rsp,%rbp
+  803b52:	41 57                	push   %r15
+  803b54:	41 56                	push   %r14
+  803b56:	41 55                	push   %r13
+  803b58:	41 54                	push   %r12
+  803b5a:	53                   	push   %rbx
+  803b5b:	48 83 ec 08          	sub    $0x8,%rsp
+  803b5f:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803b62:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803b66:	45 84 ed             	test   %r13b,%r13b
+  803b69:	75 12                	jne    803b7d <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803b6b:	4c 89 f8             	mov    %r15,%rax
+  803b6e:	48 83 c4 08          	add    $0x8,%rsp
+  803b72:	5b                   	pop    %rbx
+  803b73:	41 5c                	pop    %r12
+  803b75:	41 5d                	pop    %r13
+  803b77:	41 5e                	pop    %r14
+  803b79:	41 5f                	pop    %r15
+  803b7b:	5d                   	pop    %rbp
+  803b7c:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803b7d:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803b81:	4c 89 e7             	mov    %r12,%rdi
+  803b84:	48 b8 c4 39 80 00 00 	movabs $0x8039c4,%rax
+  803b8b:	00 00 00 
+  803b8e:	ff d0                	call   *%rax
+  803b90:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803b93:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803b97:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803b9b:	49 bf c9 3a 80 00 00 	movabs $0x803ac9,%r15
+  803ba2:	00 00 00 
+				if ((sc = *s++) == 0)
+  803ba5:	84 c0                	test   %al,%al
+  803ba7:	75 14                	jne    803bbd <strstr+0x6f>
+					return NULL;
+  803ba9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803baf:	eb ba                	jmp    803b6b <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803bb1:	48 83 c3 01          	add    $0x1,%rbx
+  803bb5:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803bb9:	84 c0                	test   %al,%al
+  803bbb:	74 1b                	je     803bd8 <strstr+0x8a>
+			} while (sc != c);
+  803bbd:	41 38 c5             	cmp    %al,%r13b
+  803bc0:	75 ef                	jne    803bb1 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803bc2:	4c 89 f2             	mov    %r14,%rdx
+  803bc5:	4c 89 e6             	mov    %r12,%rsi
+  803bc8:	48 89 df             	mov    %rbx,%rdi
+  803bcb:	41 ff d7             	call   *%r15
+  803bce:	85 c0                	test   %eax,%eax
+  803bd0:	75 df                	jne    803bb1 <strstr+0x63>
+  803bd2:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803bd6:	eb 93                	jmp    803b6b <strstr+0x1d>
+					return NULL;
+  803bd8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bde:	eb 8b                	jmp    803b6b <strstr+0x1d>
+
+0000000000803be0 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803be0:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803be2:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803be5:	8d 57 20             	lea    0x20(%rdi),%edx
+  803be8:	83 f9 1a             	cmp    $0x1a,%ecx
+  803beb:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803bee:	c3                   	ret
+
+0000000000803bef <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803bef:	55                   	push   %rbp
+  803bf0:	48 89 e5             	mov    %rsp,%rbp
+  803bf3:	41 57                	push   %r15
+  803bf5:	41 56                	push   %r14
+  803bf7:	41 55                	push   %r13
+  803bf9:	41 54                	push   %r12
+  803bfb:	53                   	push   %rbx
+  803bfc:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803c00:	48 39 f7             	cmp    %rsi,%rdi
+  803c03:	74 49                	je     803c4e <strcasecmp+0x5f>
+  803c05:	49 89 fd             	mov    %rdi,%r13
+  803c08:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803c0b:	49 bf e0 3b 80 00 00 	movabs $0x803be0,%r15
+  803c12:	00 00 00 
+  803c15:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803c1a:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c1e:	41 ff d7             	call   *%r15
+  803c21:	89 c3                	mov    %eax,%ebx
+  803c23:	49 83 c4 01          	add    $0x1,%r12
+  803c27:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c2d:	41 ff d7             	call   *%r15
+  803c30:	29 c3                	sub    %eax,%ebx
+  803c32:	75 09                	jne    803c3d <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c34:	49 83 c5 01          	add    $0x1,%r13
+  803c38:	45 84 f6             	test   %r14b,%r14b
+  803c3b:	75 d8                	jne    803c15 <strcasecmp+0x26>
+}
+  803c3d:	89 d8                	mov    %ebx,%eax
+  803c3f:	48 83 c4 08          	add    $0x8,%rsp
+  803c43:	5b                   	pop    %rbx
+  803c44:	41 5c                	pop    %r12
+  803c46:	41 5d                	pop    %r13
+  803c48:	41 5e                	pop    %r14
+  803c4a:	41 5f                	pop    %r15
+  803c4c:	5d                   	pop    %rbp
+  803c4d:	c3                   	ret
+        return 0;
+  803c4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c53:	eb e8                	jmp    803c3d <strcasecmp+0x4e>
+
+0000000000803c55 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c55:	55                   	push   %rbp
+  803c56:	48 89 e5             	mov    %rsp,%rbp
+  803c59:	41 57                	push   %r15
+  803c5b:	41 56                	push   %r14
+  803c5d:	41 55                	push   %r13
+  803c5f:	41 54                	push   %r12
+  803c61:	53                   	push   %rbx
+  803c62:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803c66:	48 85 d2             	test   %rdx,%rdx
+  803c69:	74 4f                	je     803cba <strncasecmp+0x65>
+  803c6b:	49 89 fc             	mov    %rdi,%r12
+  803c6e:	49 89 f5             	mov    %rsi,%r13
+  803c71:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803c75:	49 be e0 3b 80 00 00 	movabs $0x803be0,%r14
+  803c7c:	00 00 00 
+  803c7f:	49 83 c4 01          	add    $0x1,%r12
+  803c83:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c89:	41 ff d6             	call   *%r14
+  803c8c:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803c8e:	49 83 c5 01          	add    $0x1,%r13
+  803c92:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803c97:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803c9a:	29 c3                	sub    %eax,%ebx
+  803c9c:	85 c0                	test   %eax,%eax
+  803c9e:	74 09                	je     803ca9 <strncasecmp+0x54>
+  803ca0:	85 db                	test   %ebx,%ebx
+  803ca2:	75 05                	jne    803ca9 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803ca4:	4d 39 fc             	cmp    %r15,%r12
+  803ca7:	75 d6                	jne    803c7f <strncasecmp+0x2a>
+}
+  803ca9:	89 d8                	mov    %ebx,%eax
+  803cab:	48 83 c4 08          	add    $0x8,%rsp
+  803caf:	5b                   	pop    %rbx
+  803cb0:	41 5c                	pop    %r12
+  803cb2:	41 5d                	pop    %r13
+  803cb4:	41 5e                	pop    %r14
+  803cb6:	41 5f                	pop    %r15
+  803cb8:	5d                   	pop    %rbp
+  803cb9:	c3                   	ret
+    int d = 0;
+  803cba:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803cbf:	eb e8                	jmp    803ca9 <strncasecmp+0x54>
+
+0000000000803cc1 <toupper>:
+
+int toupper(int c) {
+  803cc1:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803cc3:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803cc6:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803cc9:	83 f9 1a             	cmp    $0x1a,%ecx
+  803ccc:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803ccf:	c3                   	ret
+
+0000000000803cd0 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803cd0:	83 ff 20             	cmp    $0x20,%edi
+  803cd3:	0f 94 c0             	sete   %al
+  803cd6:	0f b6 c0             	movzbl %al,%eax
+}
+  803cd9:	c3                   	ret
+
+0000000000803cda <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803cda:	89 f8                	mov    %edi,%eax
+  803cdc:	f7 d8                	neg    %eax
+  803cde:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803ce1:	c3                   	ret
+
+0000000000803ce2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803ce2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803ce5:	48 89 f8             	mov    %rdi,%rax
+  803ce8:	48 f7 d8             	neg    %rax
+  803ceb:	83 e0 07             	and    $0x7,%eax
+  803cee:	49 89 d1             	mov    %rdx,%r9
+  803cf1:	49 29 c1             	sub    %rax,%r9
+  803cf4:	78 36                	js     803d2c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803cf6:	40 0f b6 c6          	movzbl %sil,%eax
+  803cfa:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803d01:	01 01 01 
+  803d04:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803d08:	40 f6 c7 07          	test   $0x7,%dil
+  803d0c:	75 38                	jne    803d46 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803d0e:	4c 89 c9             	mov    %r9,%rcx
+  803d11:	48 c1 f9 03          	sar    $0x3,%rcx
+  803d15:	74 0c                	je     803d23 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803d17:	fc                   	cld
+  803d18:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803d1b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d1f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d23:	4d 85 c9             	test   %r9,%r9
+  803d26:	75 45                	jne    803d6d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d28:	4c 89 c0             	mov    %r8,%rax
+  803d2b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d2c:	48 85 d2             	test   %rdx,%rdx
+  803d2f:	74 f7                	je     803d28 <memset+0x46>
+  803d31:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d34:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d37:	48 83 c0 01          	add    $0x1,%rax
+  803d3b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d3f:	48 39 c2             	cmp    %rax,%rdx
+  803d42:	75 f3                	jne    803d37 <memset+0x55>
+  803d44:	eb e2                	jmp    803d28 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d46:	40 f6 c7 01          	test   $0x1,%dil
+  803d4a:	74 06                	je     803d52 <memset+0x70>
+  803d4c:	88 07                	mov    %al,(%rdi)
+  803d4e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d52:	40 f6 c7 02          	test   $0x2,%dil
+  803d56:	74 07                	je     803d5f <memset+0x7d>
+  803d58:	66 89 07             	mov    %ax,(%rdi)
+  803d5b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d5f:	40 f6 c7 04          	test   $0x4,%dil
+  803d63:	74 a9                	je     803d0e <memset+0x2c>
+  803d65:	89 07                	mov    %eax,(%rdi)
+  803d67:	48 83 c7 04          	add    $0x4,%rdi
+  803d6b:	eb a1                	jmp    803d0e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d6d:	41 f6 c1 04          	test   $0x4,%r9b
+  803d71:	74 06                	je     803d79 <memset+0x97>
+  803d73:	89 07                	mov    %eax,(%rdi)
+  803d75:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d79:	41 f6 c1 02          	test   $0x2,%r9b
+  803d7d:	74 07                	je     803d86 <memset+0xa4>
+  803d7f:	66 89 07             	mov    %ax,(%rdi)
+  803d82:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803d86:	41 f6 c1 01          	test   $0x1,%r9b
+  803d8a:	74 9c                	je     803d28 <memset+0x46>
+  803d8c:	88 07                	mov    %al,(%rdi)
+  803d8e:	eb 98                	jmp    803d28 <memset+0x46>
+
+0000000000803d90 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803d90:	48 89 f8             	mov    %rdi,%rax
+  803d93:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803d96:	48 39 fe             	cmp    %rdi,%rsi
+  803d99:	73 3b                	jae    803dd6 <memmove+0x46>
+  803d9b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803d9f:	48 39 d7             	cmp    %rdx,%rdi
+  803da2:	73 32                	jae    803dd6 <memmove+0x46>
+        s += n;
+        d += n;
+  803da4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803da8:	48 89 d6             	mov    %rdx,%rsi
+  803dab:	48 09 fe             	or     %rdi,%rsi
+  803dae:	48 09 ce             	or     %rcx,%rsi
+  803db1:	40 f6 c6 07          	test   $0x7,%sil
+  803db5:	75 12                	jne    803dc9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803db7:	48 83 ef 08          	sub    $0x8,%rdi
+  803dbb:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803dbf:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dc3:	fd                   	std
+  803dc4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803dc7:	fc                   	cld
+  803dc8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803dc9:	48 83 ef 01          	sub    $0x1,%rdi
+  803dcd:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803dd1:	fd                   	std
+  803dd2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803dd4:	eb f1                	jmp    803dc7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803dd6:	48 89 f2             	mov    %rsi,%rdx
+  803dd9:	48 09 c2             	or     %rax,%rdx
+  803ddc:	48 09 ca             	or     %rcx,%rdx
+  803ddf:	f6 c2 07             	test   $0x7,%dl
+  803de2:	75 0c                	jne    803df0 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803de4:	48 c1 e9 03          	shr    $0x3,%rcx
+  803de8:	48 89 c7             	mov    %rax,%rdi
+  803deb:	fc                   	cld
+  803dec:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803def:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803df0:	48 89 c7             	mov    %rax,%rdi
+  803df3:	fc                   	cld
+  803df4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803df6:	c3                   	ret
+
+0000000000803df7 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803df7:	55                   	push   %rbp
+  803df8:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803dfb:	48 b8 90 3d 80 00 00 	movabs $0x803d90,%rax
+  803e02:	00 00 00 
+  803e05:	ff d0                	call   *%rax
+}
+  803e07:	5d                   	pop    %rbp
+  803e08:	c3                   	ret
+
+0000000000803e09 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803e09:	55                   	push   %rbp
+  803e0a:	48 89 e5             	mov    %rsp,%rbp
+  803e0d:	41 57                	push   %r15
+  803e0f:	41 56                	push   %r14
+  803e11:	41 55                	push   %r13
+  803e13:	41 54                	push   %r12
+  803e15:	53                   	push   %rbx
+  803e16:	48 83 ec 08          	sub    $0x8,%rsp
+  803e1a:	49 89 fe             	mov    %rdi,%r14
+  803e1d:	49 89 f7             	mov    %rsi,%r15
+  803e20:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e23:	48 89 f7             	mov    %rsi,%rdi
+  803e26:	48 b8 c4 39 80 00 00 	movabs $0x8039c4,%rax
+  803e2d:	00 00 00 
+  803e30:	ff d0                	call   *%rax
+  803e32:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e35:	48 89 de             	mov    %rbx,%rsi
+  803e38:	4c 89 f7             	mov    %r14,%rdi
+  803e3b:	48 b8 df 39 80 00 00 	movabs $0x8039df,%rax
+  803e42:	00 00 00 
+  803e45:	ff d0                	call   *%rax
+  803e47:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e4a:	48 39 c3             	cmp    %rax,%rbx
+  803e4d:	74 36                	je     803e85 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e4f:	48 89 d8             	mov    %rbx,%rax
+  803e52:	4c 29 e8             	sub    %r13,%rax
+  803e55:	49 39 c4             	cmp    %rax,%r12
+  803e58:	73 31                	jae    803e8b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803e5a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803e5f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e63:	4c 89 fe             	mov    %r15,%rsi
+  803e66:	48 b8 f7 3d 80 00 00 	movabs $0x803df7,%rax
+  803e6d:	00 00 00 
+  803e70:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803e72:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803e76:	48 83 c4 08          	add    $0x8,%rsp
+  803e7a:	5b                   	pop    %rbx
+  803e7b:	41 5c                	pop    %r12
+  803e7d:	41 5d                	pop    %r13
+  803e7f:	41 5e                	pop    %r14
+  803e81:	41 5f                	pop    %r15
+  803e83:	5d                   	pop    %rbp
+  803e84:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e85:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803e89:	eb eb                	jmp    803e76 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803e8b:	48 83 eb 01          	sub    $0x1,%rbx
+  803e8f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e93:	48 89 da             	mov    %rbx,%rdx
+  803e96:	4c 89 fe             	mov    %r15,%rsi
+  803e99:	48 b8 f7 3d 80 00 00 	movabs $0x803df7,%rax
+  803ea0:	00 00 00 
+  803ea3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803ea5:	49 01 de             	add    %rbx,%r14
+  803ea8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803ead:	eb c3                	jmp    803e72 <strlcat+0x69>
+
+0000000000803eaf <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803eaf:	48 85 d2             	test   %rdx,%rdx
+  803eb2:	74 2d                	je     803ee1 <memcmp+0x32>
+  803eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803eb9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803ebd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803ec2:	44 38 c1             	cmp    %r8b,%cl
+  803ec5:	75 0f                	jne    803ed6 <memcmp+0x27>
+    while (n-- > 0) {
+  803ec7:	48 83 c0 01          	add    $0x1,%rax
+  803ecb:	48 39 c2             	cmp    %rax,%rdx
+  803ece:	75 e9                	jne    803eb9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803ed6:	0f b6 c1             	movzbl %cl,%eax
+  803ed9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803edd:	44 29 c0             	sub    %r8d,%eax
+  803ee0:	c3                   	ret
+    return 0;
+  803ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee6:	c3                   	ret
+
+0000000000803ee7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803ee7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803eeb:	48 39 c7             	cmp    %rax,%rdi
+  803eee:	73 0f                	jae    803eff <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803ef0:	40 38 37             	cmp    %sil,(%rdi)
+  803ef3:	74 0e                	je     803f03 <memfind+0x1c>
+    for (; src < end; src++) {
+  803ef5:	48 83 c7 01          	add    $0x1,%rdi
+  803ef9:	48 39 f8             	cmp    %rdi,%rax
+  803efc:	75 f2                	jne    803ef0 <memfind+0x9>
+  803efe:	c3                   	ret
+  803eff:	48 89 f8             	mov    %rdi,%rax
+  803f02:	c3                   	ret
+  803f03:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803f06:	c3                   	ret
+
+0000000000803f07 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803f07:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803f0a:	0f b6 37             	movzbl (%rdi),%esi
+  803f0d:	40 80 fe 20          	cmp    $0x20,%sil
+  803f11:	74 06                	je     803f19 <strtol+0x12>
+  803f13:	40 80 fe 09          	cmp    $0x9,%sil
+  803f17:	75 13                	jne    803f2c <strtol+0x25>
+  803f19:	48 83 c7 01          	add    $0x1,%rdi
+  803f1d:	0f b6 37             	movzbl (%rdi),%esi
+  803f20:	40 80 fe 20          	cmp    $0x20,%sil
+  803f24:	74 f3                	je     803f19 <strtol+0x12>
+  803f26:	40 80 fe 09          	cmp    $0x9,%sil
+  803f2a:	74 ed                	je     803f19 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f2c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f2f:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f32:	3c 01                	cmp    $0x1,%al
+  803f34:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f38:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f3e:	75 0f                	jne    803f4f <strtol+0x48>
+  803f40:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f43:	74 14                	je     803f59 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f45:	85 d2                	test   %edx,%edx
+  803f47:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f4c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803f54:	4c 63 ca             	movslq %edx,%r9
+  803f57:	eb 36                	jmp    803f8f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f59:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803f5d:	74 0f                	je     803f6e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803f5f:	85 d2                	test   %edx,%edx
+  803f61:	75 ec                	jne    803f4f <strtol+0x48>
+        s++;
+  803f63:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803f67:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803f6c:	eb e1                	jmp    803f4f <strtol+0x48>
+        s += 2;
+  803f6e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803f72:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803f77:	eb d6                	jmp    803f4f <strtol+0x48>
+            dig -= '0';
+  803f79:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803f7c:	44 0f b6 c1          	movzbl %cl,%r8d
+  803f80:	41 39 d0             	cmp    %edx,%r8d
+  803f83:	7d 21                	jge    803fa6 <strtol+0x9f>
+        val = val * base + dig;
+  803f85:	49 0f af c1          	imul   %r9,%rax
+  803f89:	0f b6 c9             	movzbl %cl,%ecx
+  803f8c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803f8f:	48 83 c7 01          	add    $0x1,%rdi
+  803f93:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803f97:	80 f9 39             	cmp    $0x39,%cl
+  803f9a:	76 dd                	jbe    803f79 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803f9c:	80 f9 7b             	cmp    $0x7b,%cl
+  803f9f:	77 05                	ja     803fa6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803fa1:	83 e9 57             	sub    $0x57,%ecx
+  803fa4:	eb d6                	jmp    803f7c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803fa6:	4d 85 d2             	test   %r10,%r10
+  803fa9:	74 03                	je     803fae <strtol+0xa7>
+  803fab:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803fae:	48 89 c2             	mov    %rax,%rdx
+  803fb1:	48 f7 da             	neg    %rdx
+  803fb4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803fb8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803fbc:	c3                   	ret
+
+0000000000803fbd <atoi>:
+int atoi(const char *str) {
+  803fbd:	55                   	push   %rbp
+  803fbe:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  803fc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fc6:	be 00 00 00 00       	mov    $0x0,%esi
+  803fcb:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  803fd2:	00 00 00 
+  803fd5:	ff d0                	call   *%rax
+}
+  803fd7:	5d                   	pop    %rbp
+  803fd8:	c3                   	ret
+
+0000000000803fd9 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fd9:	55                   	push   %rbp
+  803fda:	48 89 e5             	mov    %rsp,%rbp
+  803fdd:	41 55                	push   %r13
+  803fdf:	41 54                	push   %r12
+  803fe1:	53                   	push   %rbx
+  803fe2:	48 83 ec 08          	sub    $0x8,%rsp
+  803fe6:	49 89 fc             	mov    %rdi,%r12
+  803fe9:	48 89 f7             	mov    %rsi,%rdi
+  803fec:	48 89 d3             	mov    %rdx,%rbx
+  803fef:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803ff2:	48 85 f6             	test   %rsi,%rsi
+  803ff5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ffc:	00 00 00 
+  803fff:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804003:	be 00 10 00 00       	mov    $0x1000,%esi
+  804008:	48 85 d2             	test   %rdx,%rdx
+  80400b:	74 03                	je     804010 <ipc_recv+0x37>
+  80400d:	48 8b 32             	mov    (%rdx),%rsi
+  804010:	48 b8 48 06 80 00 00 	movabs $0x800648,%rax
+  804017:	00 00 00 
+  80401a:	ff d0                	call   *%rax
+    if (errno) {
+  80401c:	85 c0                	test   %eax,%eax
+  80401e:	74 1c                	je     80403c <ipc_recv+0x63>
+        if (from_env_store)
+  804020:	4d 85 e4             	test   %r12,%r12
+  804023:	74 08                	je     80402d <ipc_recv+0x54>
+            *from_env_store = 0;
+  804025:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80402c:	00 
+
+        if (perm_store)
+  80402d:	4d 85 ed             	test   %r13,%r13
+  804030:	74 74                	je     8040a6 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804032:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804039:	00 
+  80403a:	eb 6a                	jmp    8040a6 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80403c:	4d 85 e4             	test   %r12,%r12
+  80403f:	74 14                	je     804055 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804041:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804048:	00 00 00 
+  80404b:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804051:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804055:	48 85 db             	test   %rbx,%rbx
+  804058:	74 23                	je     80407d <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80405a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804061:	00 00 00 
+  804064:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80406a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80406f:	85 c9                	test   %ecx,%ecx
+  804071:	74 07                	je     80407a <ipc_recv+0xa1>
+  804073:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80407a:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80407d:	4d 85 ed             	test   %r13,%r13
+  804080:	74 14                	je     804096 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804082:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804089:	00 00 00 
+  80408c:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804092:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804096:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80409d:	00 00 00 
+  8040a0:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040a6:	48 83 c4 08          	add    $0x8,%rsp
+  8040aa:	5b                   	pop    %rbx
+  8040ab:	41 5c                	pop    %r12
+  8040ad:	41 5d                	pop    %r13
+  8040af:	5d                   	pop    %rbp
+  8040b0:	c3                   	ret
+
+00000000008040b1 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040b1:	55                   	push   %rbp
+  8040b2:	48 89 e5             	mov    %rsp,%rbp
+  8040b5:	41 55                	push   %r13
+  8040b7:	41 54                	push   %r12
+  8040b9:	53                   	push   %rbx
+  8040ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8040be:	49 89 fc             	mov    %rdi,%r12
+  8040c1:	48 89 f7             	mov    %rsi,%rdi
+  8040c4:	48 89 d3             	mov    %rdx,%rbx
+  8040c7:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040ca:	48 85 f6             	test   %rsi,%rsi
+  8040cd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040d4:	00 00 00 
+  8040d7:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040db:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040e0:	48 85 d2             	test   %rdx,%rdx
+  8040e3:	74 03                	je     8040e8 <ipc_try_recv+0x37>
+  8040e5:	48 8b 32             	mov    (%rdx),%rsi
+  8040e8:	48 b8 b1 06 80 00 00 	movabs $0x8006b1,%rax
+  8040ef:	00 00 00 
+  8040f2:	ff d0                	call   *%rax
+    if (errno) {
+  8040f4:	85 c0                	test   %eax,%eax
+  8040f6:	75 75                	jne    80416d <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8040f8:	4d 85 e4             	test   %r12,%r12
+  8040fb:	74 14                	je     804111 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8040fd:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804104:	00 00 00 
+  804107:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80410d:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804111:	48 85 db             	test   %rbx,%rbx
+  804114:	74 23                	je     804139 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804116:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80411d:	00 00 00 
+  804120:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804126:	ba 00 00 00 00       	mov    $0x0,%edx
+  80412b:	85 c9                	test   %ecx,%ecx
+  80412d:	74 07                	je     804136 <ipc_try_recv+0x85>
+  80412f:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804136:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804139:	4d 85 ed             	test   %r13,%r13
+  80413c:	74 14                	je     804152 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80413e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804145:	00 00 00 
+  804148:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80414e:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804152:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804159:	00 00 00 
+  80415c:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804162:	48 83 c4 08          	add    $0x8,%rsp
+  804166:	5b                   	pop    %rbx
+  804167:	41 5c                	pop    %r12
+  804169:	41 5d                	pop    %r13
+  80416b:	5d                   	pop    %rbp
+  80416c:	c3                   	ret
+        if (from_env_store)
+  80416d:	4d 85 e4             	test   %r12,%r12
+  804170:	74 08                	je     80417a <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804172:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804179:	00 
+        if (perm_store)
+  80417a:	4d 85 ed             	test   %r13,%r13
+  80417d:	74 e3                	je     804162 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80417f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804186:	00 
+  804187:	eb d9                	jmp    804162 <ipc_try_recv+0xb1>
+
+0000000000804189 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804189:	55                   	push   %rbp
+  80418a:	48 89 e5             	mov    %rsp,%rbp
+  80418d:	41 57                	push   %r15
+  80418f:	41 56                	push   %r14
+  804191:	41 55                	push   %r13
+  804193:	41 54                	push   %r12
+  804195:	53                   	push   %rbx
+  804196:	48 83 ec 18          	sub    $0x18,%rsp
+  80419a:	41 89 fd             	mov    %edi,%r13d
+  80419d:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8041a0:	48 89 d3             	mov    %rdx,%rbx
+  8041a3:	49 89 cc             	mov    %rcx,%r12
+  8041a6:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041aa:	48 85 d2             	test   %rdx,%rdx
+  8041ad:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041b4:	00 00 00 
+  8041b7:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041bb:	49 be 1c 06 80 00 00 	movabs $0x80061c,%r14
+  8041c2:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041c5:	49 bf 0c 02 80 00 00 	movabs $0x80020c,%r15
+  8041cc:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041cf:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041d2:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041d6:	4c 89 e1             	mov    %r12,%rcx
+  8041d9:	48 89 da             	mov    %rbx,%rdx
+  8041dc:	44 89 ef             	mov    %r13d,%edi
+  8041df:	41 ff d6             	call   *%r14
+  8041e2:	85 c0                	test   %eax,%eax
+  8041e4:	74 37                	je     80421d <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041e6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041e9:	75 05                	jne    8041f0 <ipc_send+0x67>
+        sys_yield();
+  8041eb:	41 ff d7             	call   *%r15
+  8041ee:	eb df                	jmp    8041cf <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041f0:	89 c1                	mov    %eax,%ecx
+  8041f2:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  8041f9:	00 00 00 
+  8041fc:	be 65 00 00 00       	mov    $0x65,%esi
+  804201:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  804208:	00 00 00 
+  80420b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804210:	49 b8 3a 2f 80 00 00 	movabs $0x802f3a,%r8
+  804217:	00 00 00 
+  80421a:	41 ff d0             	call   *%r8
+    }
+}
+  80421d:	48 83 c4 18          	add    $0x18,%rsp
+  804221:	5b                   	pop    %rbx
+  804222:	41 5c                	pop    %r12
+  804224:	41 5d                	pop    %r13
+  804226:	41 5e                	pop    %r14
+  804228:	41 5f                	pop    %r15
+  80422a:	5d                   	pop    %rbp
+  80422b:	c3                   	ret
+
+000000000080422c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80422c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804231:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804238:	00 00 00 
+  80423b:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804242:	48 01 ca             	add    %rcx,%rdx
+  804245:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80424b:	39 fa                	cmp    %edi,%edx
+  80424d:	74 12                	je     804261 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80424f:	48 83 c0 01          	add    $0x1,%rax
+  804253:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804259:	75 e0                	jne    80423b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80425b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804260:	c3                   	ret
+            return envs[i].env_id;
+  804261:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804268:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80426f:	00 00 00 
+  804272:	48 01 d0             	add    %rdx,%rax
+  804275:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80427b:	c3                   	ret
+
+000000000080427c <__text_end>:
+  80427c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804283:	00 00 00 
+  804286:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428d:	00 00 00 
+  804290:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804297:	00 00 00 
+  80429a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a1:	00 00 00 
+  8042a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ab:	00 00 00 
+  8042ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b5:	00 00 00 
+  8042b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042bf:	00 00 00 
+  8042c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c9:	00 00 00 
+  8042cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d3:	00 00 00 
+  8042d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042dd:	00 00 00 
+  8042e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e7:	00 00 00 
+  8042ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f1:	00 00 00 
+  8042f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fb:	00 00 00 
+  8042fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804305:	00 00 00 
+  804308:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430f:	00 00 00 
+  804312:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804319:	00 00 00 
+  80431c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804323:	00 00 00 
+  804326:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432d:	00 00 00 
+  804330:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804337:	00 00 00 
+  80433a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804341:	00 00 00 
+  804344:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434b:	00 00 00 
+  80434e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804355:	00 00 00 
+  804358:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435f:	00 00 00 
+  804362:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804369:	00 00 00 
+  80436c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804373:	00 00 00 
+  804376:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437d:	00 00 00 
+  804380:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804387:	00 00 00 
+  80438a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804391:	00 00 00 
+  804394:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439b:	00 00 00 
+  80439e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a5:	00 00 00 
+  8043a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043af:	00 00 00 
+  8043b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b9:	00 00 00 
+  8043bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c3:	00 00 00 
+  8043c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cd:	00 00 00 
+  8043d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d7:	00 00 00 
+  8043da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e1:	00 00 00 
+  8043e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043eb:	00 00 00 
+  8043ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f5:	00 00 00 
+  8043f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ff:	00 00 00 
+  804402:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804409:	00 00 00 
+  80440c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804413:	00 00 00 
+  804416:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441d:	00 00 00 
+  804420:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804427:	00 00 00 
+  80442a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804431:	00 00 00 
+  804434:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443b:	00 00 00 
+  80443e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804445:	00 00 00 
+  804448:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444f:	00 00 00 
+  804452:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804459:	00 00 00 
+  80445c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804463:	00 00 00 
+  804466:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446d:	00 00 00 
+  804470:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804477:	00 00 00 
+  80447a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804481:	00 00 00 
+  804484:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448b:	00 00 00 
+  80448e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804495:	00 00 00 
+  804498:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449f:	00 00 00 
+  8044a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a9:	00 00 00 
+  8044ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b3:	00 00 00 
+  8044b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bd:	00 00 00 
+  8044c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c7:	00 00 00 
+  8044ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d1:	00 00 00 
+  8044d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044db:	00 00 00 
+  8044de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e5:	00 00 00 
+  8044e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ef:	00 00 00 
+  8044f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f9:	00 00 00 
+  8044fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804503:	00 00 00 
+  804506:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450d:	00 00 00 
+  804510:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804517:	00 00 00 
+  80451a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804521:	00 00 00 
+  804524:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452b:	00 00 00 
+  80452e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804535:	00 00 00 
+  804538:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453f:	00 00 00 
+  804542:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804549:	00 00 00 
+  80454c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804553:	00 00 00 
+  804556:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455d:	00 00 00 
+  804560:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804567:	00 00 00 
+  80456a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804571:	00 00 00 
+  804574:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457b:	00 00 00 
+  80457e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804585:	00 00 00 
+  804588:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458f:	00 00 00 
+  804592:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804599:	00 00 00 
+  80459c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a3:	00 00 00 
+  8045a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ad:	00 00 00 
+  8045b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b7:	00 00 00 
+  8045ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c1:	00 00 00 
+  8045c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cb:	00 00 00 
+  8045ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d5:	00 00 00 
+  8045d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045df:	00 00 00 
+  8045e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e9:	00 00 00 
+  8045ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f3:	00 00 00 
+  8045f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fd:	00 00 00 
+  804600:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804607:	00 00 00 
+  80460a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804611:	00 00 00 
+  804614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461b:	00 00 00 
+  80461e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804625:	00 00 00 
+  804628:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462f:	00 00 00 
+  804632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804639:	00 00 00 
+  80463c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804643:	00 00 00 
+  804646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464d:	00 00 00 
+  804650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804657:	00 00 00 
+  80465a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804661:	00 00 00 
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467f:	00 00 00 
+  804682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804689:	00 00 00 
+  80468c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804693:	00 00 00 
+  804696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469d:	00 00 00 
+  8046a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a7:	00 00 00 
+  8046aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b1:	00 00 00 
+  8046b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bb:	00 00 00 
+  8046be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c5:	00 00 00 
+  8046c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cf:	00 00 00 
+  8046d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d9:	00 00 00 
+  8046dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e3:	00 00 00 
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
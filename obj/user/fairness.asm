@@ -0,0 +1,8124 @@
+
+obj/user/fairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 dc 00 00 00       	call   8000ff <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * (user/idle is env 0). */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t who, id;
+
+    id = sys_getenvid();
+  800034:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  80003b:	00 00 00 
+  80003e:	ff d0                	call   *%rax
+  800040:	89 c3                	mov    %eax,%ebx
+
+    if (thisenv == &envs[1]) {
+  800042:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800049:	00 00 00 
+  80004c:	48 b8 68 01 c0 1f 80 	movabs $0x801fc00168,%rax
+  800053:	00 00 00 
+  800056:	48 39 02             	cmp    %rax,(%rdx)
+  800059:	74 5e                	je     8000b9 <umain+0x94>
+        while (1) {
+            ipc_recv(&who, NULL, NULL, NULL);
+            cprintf("%x recv from %x\n", id, who);
+        }
+    } else {
+        cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80005b:	48 b8 30 02 c0 1f 80 	movabs $0x801fc00230,%rax
+  800062:	00 00 00 
+  800065:	8b 10                	mov    (%rax),%edx
+  800067:	89 de                	mov    %ebx,%esi
+  800069:	48 bf 11 50 80 00 00 	movabs $0x805011,%rdi
+  800070:	00 00 00 
+  800073:	b8 00 00 00 00       	mov    $0x0,%eax
+  800078:	48 b9 78 02 80 00 00 	movabs $0x800278,%rcx
+  80007f:	00 00 00 
+  800082:	ff d1                	call   *%rcx
+        while (1)
+            ipc_send(envs[1].env_id, 0, NULL, 0, 0);
+  800084:	49 bc 00 00 c0 1f 80 	movabs $0x801fc00000,%r12
+  80008b:	00 00 00 
+  80008e:	48 bb 16 1f 80 00 00 	movabs $0x801f16,%rbx
+  800095:	00 00 00 
+  800098:	41 8b bc 24 30 02 00 	mov    0x230(%r12),%edi
+  80009f:	00 
+  8000a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	ff d3                	call   *%rbx
+        while (1)
+  8000b7:	eb df                	jmp    800098 <umain+0x73>
+            ipc_recv(&who, NULL, NULL, NULL);
+  8000b9:	49 be 66 1d 80 00 00 	movabs $0x801d66,%r14
+  8000c0:	00 00 00 
+            cprintf("%x recv from %x\n", id, who);
+  8000c3:	49 bd 00 50 80 00 00 	movabs $0x805000,%r13
+  8000ca:	00 00 00 
+  8000cd:	49 bc 78 02 80 00 00 	movabs $0x800278,%r12
+  8000d4:	00 00 00 
+            ipc_recv(&who, NULL, NULL, NULL);
+  8000d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8000ea:	41 ff d6             	call   *%r14
+            cprintf("%x recv from %x\n", id, who);
+  8000ed:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8000f0:	89 de                	mov    %ebx,%esi
+  8000f2:	4c 89 ef             	mov    %r13,%rdi
+  8000f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fa:	41 ff d4             	call   *%r12
+        while (1) {
+  8000fd:	eb d8                	jmp    8000d7 <umain+0xb2>
+
+00000000008000ff <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000ff:	55                   	push   %rbp
+  800100:	48 89 e5             	mov    %rsp,%rbp
+  800103:	41 56                	push   %r14
+  800105:	41 55                	push   %r13
+  800107:	41 54                	push   %r12
+  800109:	53                   	push   %rbx
+  80010a:	41 89 fd             	mov    %edi,%r13d
+  80010d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800110:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800117:	00 00 00 
+  80011a:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800121:	00 00 00 
+  800124:	48 39 c2             	cmp    %rax,%rdx
+  800127:	73 17                	jae    800140 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800129:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80012c:	49 89 c4             	mov    %rax,%r12
+  80012f:	48 83 c3 08          	add    $0x8,%rbx
+  800133:	b8 00 00 00 00       	mov    $0x0,%eax
+  800138:	ff 53 f8             	call   *-0x8(%rbx)
+  80013b:	4c 39 e3             	cmp    %r12,%rbx
+  80013e:	72 ef                	jb     80012f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800140:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  800147:	00 00 00 
+  80014a:	ff d0                	call   *%rax
+  80014c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800151:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800158:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80015f:	00 00 00 
+  800162:	48 01 d0             	add    %rdx,%rax
+  800165:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  80016c:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80016f:	45 85 ed             	test   %r13d,%r13d
+  800172:	7e 0d                	jle    800181 <libmain+0x82>
+  800174:	49 8b 06             	mov    (%r14),%rax
+  800177:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80017e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800181:	4c 89 f6             	mov    %r14,%rsi
+  800184:	44 89 ef             	mov    %r13d,%edi
+  800187:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80018e:	00 00 00 
+  800191:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800193:	48 b8 a8 01 80 00 00 	movabs $0x8001a8,%rax
+  80019a:	00 00 00 
+  80019d:	ff d0                	call   *%rax
+#endif
+}
+  80019f:	5b                   	pop    %rbx
+  8001a0:	41 5c                	pop    %r12
+  8001a2:	41 5d                	pop    %r13
+  8001a4:	41 5e                	pop    %r14
+  8001a6:	5d                   	pop    %rbp
+  8001a7:	c3                   	ret
+
+00000000008001a8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001a8:	55                   	push   %rbp
+  8001a9:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001ac:	48 b8 2f 22 80 00 00 	movabs $0x80222f,%rax
+  8001b3:	00 00 00 
+  8001b6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001bd:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+}
+  8001c9:	5d                   	pop    %rbp
+  8001ca:	c3                   	ret
+
+00000000008001cb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+  8001cf:	53                   	push   %rbx
+  8001d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8001d4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001d7:	8b 06                	mov    (%rsi),%eax
+  8001d9:	8d 50 01             	lea    0x1(%rax),%edx
+  8001dc:	89 16                	mov    %edx,(%rsi)
+  8001de:	48 98                	cltq
+  8001e0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001e5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001eb:	74 0a                	je     8001f7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001ed:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f5:	c9                   	leave
+  8001f6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001f7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001fb:	be ff 00 00 00       	mov    $0xff,%esi
+  800200:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  800207:	00 00 00 
+  80020a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80020c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800212:	eb d9                	jmp    8001ed <putch+0x22>
+
+0000000000800214 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800214:	55                   	push   %rbp
+  800215:	48 89 e5             	mov    %rsp,%rbp
+  800218:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80021f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800222:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800229:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80022e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800233:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800236:	48 89 f1             	mov    %rsi,%rcx
+  800239:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800240:	48 bf cb 01 80 00 00 	movabs $0x8001cb,%rdi
+  800247:	00 00 00 
+  80024a:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800256:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80025d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800264:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  80026b:	00 00 00 
+  80026e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800270:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800276:	c9                   	leave
+  800277:	c3                   	ret
+
+0000000000800278 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800278:	55                   	push   %rbp
+  800279:	48 89 e5             	mov    %rsp,%rbp
+  80027c:	48 83 ec 50          	sub    $0x50,%rsp
+  800280:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800284:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800288:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80028c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800290:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800294:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80029b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80029f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002a3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002a7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002ab:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002af:	48 b8 14 02 80 00 00 	movabs $0x800214,%rax
+  8002b6:	00 00 00 
+  8002b9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002bb:	c9                   	leave
+  8002bc:	c3                   	ret
+
+00000000008002bd <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002bd:	55                   	push   %rbp
+  8002be:	48 89 e5             	mov    %rsp,%rbp
+  8002c1:	41 57                	push   %r15
+  8002c3:	41 56                	push   %r14
+  8002c5:	41 55                	push   %r13
+  8002c7:	41 54                	push   %r12
+  8002c9:	53                   	push   %rbx
+  8002ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8002ce:	49 89 fc             	mov    %rdi,%r12
+  8002d1:	49 89 f5             	mov    %rsi,%r13
+  8002d4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002d8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002db:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002de:	41 89 cf             	mov    %ecx,%r15d
+  8002e1:	4c 39 fa             	cmp    %r15,%rdx
+  8002e4:	73 5b                	jae    800341 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002e6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002ea:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002ee:	85 db                	test   %ebx,%ebx
+  8002f0:	7e 0e                	jle    800300 <print_num+0x43>
+            putch(padc, put_arg);
+  8002f2:	4c 89 ee             	mov    %r13,%rsi
+  8002f5:	44 89 f7             	mov    %r14d,%edi
+  8002f8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002fb:	83 eb 01             	sub    $0x1,%ebx
+  8002fe:	75 f2                	jne    8002f2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800300:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800304:	48 b9 43 50 80 00 00 	movabs $0x805043,%rcx
+  80030b:	00 00 00 
+  80030e:	48 b8 32 50 80 00 00 	movabs $0x805032,%rax
+  800315:	00 00 00 
+  800318:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80031c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800320:	ba 00 00 00 00       	mov    $0x0,%edx
+  800325:	49 f7 f7             	div    %r15
+  800328:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80032c:	4c 89 ee             	mov    %r13,%rsi
+  80032f:	41 ff d4             	call   *%r12
+}
+  800332:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800336:	5b                   	pop    %rbx
+  800337:	41 5c                	pop    %r12
+  800339:	41 5d                	pop    %r13
+  80033b:	41 5e                	pop    %r14
+  80033d:	41 5f                	pop    %r15
+  80033f:	5d                   	pop    %rbp
+  800340:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800341:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800345:	ba 00 00 00 00       	mov    $0x0,%edx
+  80034a:	49 f7 f7             	div    %r15
+  80034d:	48 83 ec 08          	sub    $0x8,%rsp
+  800351:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800355:	52                   	push   %rdx
+  800356:	45 0f be c9          	movsbl %r9b,%r9d
+  80035a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80035e:	48 89 c2             	mov    %rax,%rdx
+  800361:	48 b8 bd 02 80 00 00 	movabs $0x8002bd,%rax
+  800368:	00 00 00 
+  80036b:	ff d0                	call   *%rax
+  80036d:	48 83 c4 10          	add    $0x10,%rsp
+  800371:	eb 8d                	jmp    800300 <print_num+0x43>
+
+0000000000800373 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800373:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800377:	48 8b 06             	mov    (%rsi),%rax
+  80037a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80037e:	73 0a                	jae    80038a <sprintputch+0x17>
+        *state->start++ = ch;
+  800380:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800384:	48 89 16             	mov    %rdx,(%rsi)
+  800387:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80038a:	c3                   	ret
+
+000000000080038b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80038b:	55                   	push   %rbp
+  80038c:	48 89 e5             	mov    %rsp,%rbp
+  80038f:	48 83 ec 50          	sub    $0x50,%rsp
+  800393:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800397:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80039b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80039f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003a6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ae:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003b2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003b6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003ba:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  8003c1:	00 00 00 
+  8003c4:	ff d0                	call   *%rax
+}
+  8003c6:	c9                   	leave
+  8003c7:	c3                   	ret
+
+00000000008003c8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003c8:	55                   	push   %rbp
+  8003c9:	48 89 e5             	mov    %rsp,%rbp
+  8003cc:	41 57                	push   %r15
+  8003ce:	41 56                	push   %r14
+  8003d0:	41 55                	push   %r13
+  8003d2:	41 54                	push   %r12
+  8003d4:	53                   	push   %rbx
+  8003d5:	48 83 ec 38          	sub    $0x38,%rsp
+  8003d9:	49 89 fe             	mov    %rdi,%r14
+  8003dc:	49 89 f5             	mov    %rsi,%r13
+  8003df:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003e2:	48 8b 01             	mov    (%rcx),%rax
+  8003e5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003e9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003f1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003f9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003fd:	0f b6 3b             	movzbl (%rbx),%edi
+  800400:	40 80 ff 25          	cmp    $0x25,%dil
+  800404:	74 18                	je     80041e <vprintfmt+0x56>
+            if (!ch) return;
+  800406:	40 84 ff             	test   %dil,%dil
+  800409:	0f 84 04 07 00 00    	je     800b13 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80040f:	40 0f b6 ff          	movzbl %dil,%edi
+  800413:	4c 89 ee             	mov    %r13,%rsi
+  800416:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800419:	4c 89 e3             	mov    %r12,%rbx
+  80041c:	eb db                	jmp    8003f9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80041e:	be 00 00 00 00       	mov    $0x0,%esi
+  800423:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800427:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80042c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800432:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800439:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80043d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800442:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800447:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80044a:	83 e8 23             	sub    $0x23,%eax
+  80044d:	3c 57                	cmp    $0x57,%al
+  80044f:	0f 87 a4 06 00 00    	ja     800af9 <vprintfmt+0x731>
+  800455:	0f b6 c0             	movzbl %al,%eax
+  800458:	48 b9 e0 51 80 00 00 	movabs $0x8051e0,%rcx
+  80045f:	00 00 00 
+  800462:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800465:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800468:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80046c:	eb cf                	jmp    80043d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80046e:	49 89 dc             	mov    %rbx,%r12
+  800471:	be 01 00 00 00       	mov    $0x1,%esi
+  800476:	eb c5                	jmp    80043d <vprintfmt+0x75>
+            padc = ch;
+  800478:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80047c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80047f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800482:	eb b9                	jmp    80043d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800484:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800487:	83 f8 2f             	cmp    $0x2f,%eax
+  80048a:	77 24                	ja     8004b0 <vprintfmt+0xe8>
+  80048c:	89 c1                	mov    %eax,%ecx
+  80048e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800492:	83 c0 08             	add    $0x8,%eax
+  800495:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800498:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80049b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80049e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004a2:	79 99                	jns    80043d <vprintfmt+0x75>
+                width = precision;
+  8004a4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004a8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004ae:	eb 8d                	jmp    80043d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004b0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004b4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004bc:	eb da                	jmp    800498 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004be:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004c3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004c7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004cd:	3c 39                	cmp    $0x39,%al
+  8004cf:	77 1c                	ja     8004ed <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004d1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004d5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004d9:	0f b6 c0             	movzbl %al,%eax
+  8004dc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004e1:	0f b6 03             	movzbl (%rbx),%eax
+  8004e4:	3c 39                	cmp    $0x39,%al
+  8004e6:	76 e9                	jbe    8004d1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004e8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004eb:	eb b1                	jmp    80049e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004ed:	49 89 dc             	mov    %rbx,%r12
+  8004f0:	eb ac                	jmp    80049e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004f2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004f5:	85 c9                	test   %ecx,%ecx
+  8004f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fc:	0f 49 c1             	cmovns %ecx,%eax
+  8004ff:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800502:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800505:	e9 33 ff ff ff       	jmp    80043d <vprintfmt+0x75>
+            lflag++;
+  80050a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80050d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800510:	e9 28 ff ff ff       	jmp    80043d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800515:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800518:	83 f8 2f             	cmp    $0x2f,%eax
+  80051b:	77 19                	ja     800536 <vprintfmt+0x16e>
+  80051d:	89 c2                	mov    %eax,%edx
+  80051f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800523:	83 c0 08             	add    $0x8,%eax
+  800526:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800529:	8b 3a                	mov    (%rdx),%edi
+  80052b:	4c 89 ee             	mov    %r13,%rsi
+  80052e:	41 ff d6             	call   *%r14
+            break;
+  800531:	e9 c3 fe ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800536:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80053a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80053e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800542:	eb e5                	jmp    800529 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800544:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800547:	83 f8 2f             	cmp    $0x2f,%eax
+  80054a:	77 5a                	ja     8005a6 <vprintfmt+0x1de>
+  80054c:	89 c2                	mov    %eax,%edx
+  80054e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800552:	83 c0 08             	add    $0x8,%eax
+  800555:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800558:	8b 02                	mov    (%rdx),%eax
+  80055a:	89 c1                	mov    %eax,%ecx
+  80055c:	f7 d9                	neg    %ecx
+  80055e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800561:	83 f9 13             	cmp    $0x13,%ecx
+  800564:	7f 4e                	jg     8005b4 <vprintfmt+0x1ec>
+  800566:	48 63 c1             	movslq %ecx,%rax
+  800569:	48 ba a0 54 80 00 00 	movabs $0x8054a0,%rdx
+  800570:	00 00 00 
+  800573:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800577:	48 85 c0             	test   %rax,%rax
+  80057a:	74 38                	je     8005b4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80057c:	48 89 c1             	mov    %rax,%rcx
+  80057f:	48 ba f9 56 80 00 00 	movabs $0x8056f9,%rdx
+  800586:	00 00 00 
+  800589:	4c 89 ee             	mov    %r13,%rsi
+  80058c:	4c 89 f7             	mov    %r14,%rdi
+  80058f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800594:	49 b8 8b 03 80 00 00 	movabs $0x80038b,%r8
+  80059b:	00 00 00 
+  80059e:	41 ff d0             	call   *%r8
+  8005a1:	e9 53 fe ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b2:	eb a4                	jmp    800558 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005b4:	48 ba 5b 50 80 00 00 	movabs $0x80505b,%rdx
+  8005bb:	00 00 00 
+  8005be:	4c 89 ee             	mov    %r13,%rsi
+  8005c1:	4c 89 f7             	mov    %r14,%rdi
+  8005c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c9:	49 b8 8b 03 80 00 00 	movabs $0x80038b,%r8
+  8005d0:	00 00 00 
+  8005d3:	41 ff d0             	call   *%r8
+  8005d6:	e9 1e fe ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005de:	83 f8 2f             	cmp    $0x2f,%eax
+  8005e1:	77 36                	ja     800619 <vprintfmt+0x251>
+  8005e3:	89 c2                	mov    %eax,%edx
+  8005e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e9:	83 c0 08             	add    $0x8,%eax
+  8005ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005ef:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8005f2:	48 85 f6             	test   %rsi,%rsi
+  8005f5:	48 b8 54 50 80 00 00 	movabs $0x805054,%rax
+  8005fc:	00 00 00 
+  8005ff:	48 0f 45 c6          	cmovne %rsi,%rax
+  800603:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800607:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80060b:	7e 06                	jle    800613 <vprintfmt+0x24b>
+  80060d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800611:	75 14                	jne    800627 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800613:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800617:	eb 5b                	jmp    800674 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800619:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80061d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800621:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800625:	eb c8                	jmp    8005ef <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800627:	49 63 f7             	movslq %r15d,%rsi
+  80062a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80062e:	48 b8 cd 0b 80 00 00 	movabs $0x800bcd,%rax
+  800635:	00 00 00 
+  800638:	ff d0                	call   *%rax
+  80063a:	48 89 c2             	mov    %rax,%rdx
+  80063d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800640:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800642:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800645:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800648:	85 c0                	test   %eax,%eax
+  80064a:	7e c7                	jle    800613 <vprintfmt+0x24b>
+  80064c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800651:	4c 89 ee             	mov    %r13,%rsi
+  800654:	44 89 e7             	mov    %r12d,%edi
+  800657:	41 ff d6             	call   *%r14
+  80065a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80065e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800661:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800664:	75 eb                	jne    800651 <vprintfmt+0x289>
+  800666:	eb ab                	jmp    800613 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800668:	0f b6 f8             	movzbl %al,%edi
+  80066b:	4c 89 ee             	mov    %r13,%rsi
+  80066e:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800671:	4c 89 e2             	mov    %r12,%rdx
+  800674:	45 85 ff             	test   %r15d,%r15d
+  800677:	78 06                	js     80067f <vprintfmt+0x2b7>
+  800679:	41 83 ef 01          	sub    $0x1,%r15d
+  80067d:	78 23                	js     8006a2 <vprintfmt+0x2da>
+  80067f:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800683:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800689:	84 c0                	test   %al,%al
+  80068b:	74 15                	je     8006a2 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80068d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800691:	74 d5                	je     800668 <vprintfmt+0x2a0>
+  800693:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800696:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80069b:	80 fa 5e             	cmp    $0x5e,%dl
+  80069e:	77 cb                	ja     80066b <vprintfmt+0x2a3>
+  8006a0:	eb c6                	jmp    800668 <vprintfmt+0x2a0>
+  8006a2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006a5:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8006a8:	01 f0                	add    %esi,%eax
+  8006aa:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8006ac:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006b0:	85 c0                	test   %eax,%eax
+  8006b2:	0f 8e 41 fd ff ff    	jle    8003f9 <vprintfmt+0x31>
+  8006b8:	4c 89 ee             	mov    %r13,%rsi
+  8006bb:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006c0:	41 ff d6             	call   *%r14
+  8006c3:	41 83 ec 01          	sub    $0x1,%r12d
+  8006c7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006cb:	75 eb                	jne    8006b8 <vprintfmt+0x2f0>
+  8006cd:	e9 27 fd ff ff       	jmp    8003f9 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8006d2:	40 84 f6             	test   %sil,%sil
+  8006d5:	75 26                	jne    8006fd <vprintfmt+0x335>
+    switch (lflag) {
+  8006d7:	85 d2                	test   %edx,%edx
+  8006d9:	74 59                	je     800734 <vprintfmt+0x36c>
+  8006db:	83 fa 01             	cmp    $0x1,%edx
+  8006de:	74 7b                	je     80075b <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8006e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e6:	0f 87 96 00 00 00    	ja     800782 <vprintfmt+0x3ba>
+  8006ec:	89 c2                	mov    %eax,%edx
+  8006ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f2:	83 c0 08             	add    $0x8,%eax
+  8006f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f8:	4c 8b 22             	mov    (%rdx),%r12
+  8006fb:	eb 17                	jmp    800714 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8006fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800700:	83 f8 2f             	cmp    $0x2f,%eax
+  800703:	77 21                	ja     800726 <vprintfmt+0x35e>
+  800705:	89 c2                	mov    %eax,%edx
+  800707:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070b:	83 c0 08             	add    $0x8,%eax
+  80070e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800711:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800714:	4d 85 e4             	test   %r12,%r12
+  800717:	78 7a                	js     800793 <vprintfmt+0x3cb>
+            num = i;
+  800719:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80071c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800721:	e9 b5 02 00 00       	jmp    8009db <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800726:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80072e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800732:	eb dd                	jmp    800711 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800734:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800737:	83 f8 2f             	cmp    $0x2f,%eax
+  80073a:	77 11                	ja     80074d <vprintfmt+0x385>
+  80073c:	89 c2                	mov    %eax,%edx
+  80073e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800742:	83 c0 08             	add    $0x8,%eax
+  800745:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800748:	4c 63 22             	movslq (%rdx),%r12
+  80074b:	eb c7                	jmp    800714 <vprintfmt+0x34c>
+  80074d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800751:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800755:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800759:	eb ed                	jmp    800748 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80075b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075e:	83 f8 2f             	cmp    $0x2f,%eax
+  800761:	77 11                	ja     800774 <vprintfmt+0x3ac>
+  800763:	89 c2                	mov    %eax,%edx
+  800765:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800769:	83 c0 08             	add    $0x8,%eax
+  80076c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076f:	4c 8b 22             	mov    (%rdx),%r12
+  800772:	eb a0                	jmp    800714 <vprintfmt+0x34c>
+  800774:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800778:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80077c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800780:	eb ed                	jmp    80076f <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800782:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800786:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078e:	e9 65 ff ff ff       	jmp    8006f8 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800793:	4c 89 ee             	mov    %r13,%rsi
+  800796:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80079b:	41 ff d6             	call   *%r14
+                i = -i;
+  80079e:	49 f7 dc             	neg    %r12
+  8007a1:	e9 73 ff ff ff       	jmp    800719 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a6:	40 84 f6             	test   %sil,%sil
+  8007a9:	75 32                	jne    8007dd <vprintfmt+0x415>
+    switch (lflag) {
+  8007ab:	85 d2                	test   %edx,%edx
+  8007ad:	74 5d                	je     80080c <vprintfmt+0x444>
+  8007af:	83 fa 01             	cmp    $0x1,%edx
+  8007b2:	0f 84 82 00 00 00    	je     80083a <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8007b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007be:	0f 87 a5 00 00 00    	ja     800869 <vprintfmt+0x4a1>
+  8007c4:	89 c2                	mov    %eax,%edx
+  8007c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ca:	83 c0 08             	add    $0x8,%eax
+  8007cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007d3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007d8:	e9 fe 01 00 00       	jmp    8009db <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8007dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e3:	77 19                	ja     8007fe <vprintfmt+0x436>
+  8007e5:	89 c2                	mov    %eax,%edx
+  8007e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007eb:	83 c0 08             	add    $0x8,%eax
+  8007ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007f4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007f9:	e9 dd 01 00 00       	jmp    8009db <vprintfmt+0x613>
+  8007fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800802:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800806:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080a:	eb e5                	jmp    8007f1 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80080c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080f:	83 f8 2f             	cmp    $0x2f,%eax
+  800812:	77 18                	ja     80082c <vprintfmt+0x464>
+  800814:	89 c2                	mov    %eax,%edx
+  800816:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081a:	83 c0 08             	add    $0x8,%eax
+  80081d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800820:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800822:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800827:	e9 af 01 00 00       	jmp    8009db <vprintfmt+0x613>
+  80082c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800830:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800834:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800838:	eb e6                	jmp    800820 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80083a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083d:	83 f8 2f             	cmp    $0x2f,%eax
+  800840:	77 19                	ja     80085b <vprintfmt+0x493>
+  800842:	89 c2                	mov    %eax,%edx
+  800844:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800848:	83 c0 08             	add    $0x8,%eax
+  80084b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800851:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800856:	e9 80 01 00 00       	jmp    8009db <vprintfmt+0x613>
+  80085b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800863:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800867:	eb e5                	jmp    80084e <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800869:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800871:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800875:	e9 56 ff ff ff       	jmp    8007d0 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80087a:	40 84 f6             	test   %sil,%sil
+  80087d:	75 2e                	jne    8008ad <vprintfmt+0x4e5>
+    switch (lflag) {
+  80087f:	85 d2                	test   %edx,%edx
+  800881:	0f 84 b3 00 00 00    	je     80093a <vprintfmt+0x572>
+  800887:	83 fa 01             	cmp    $0x1,%edx
+  80088a:	0f 84 d3 00 00 00    	je     800963 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800890:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800893:	83 f8 2f             	cmp    $0x2f,%eax
+  800896:	0f 87 f1 00 00 00    	ja     80098d <vprintfmt+0x5c5>
+  80089c:	89 c2                	mov    %eax,%edx
+  80089e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a2:	83 c0 08             	add    $0x8,%eax
+  8008a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a8:	48 8b 02             	mov    (%rdx),%rax
+  8008ab:	eb 17                	jmp    8008c4 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b3:	77 77                	ja     80092c <vprintfmt+0x564>
+  8008b5:	89 c2                	mov    %eax,%edx
+  8008b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bb:	83 c0 08             	add    $0x8,%eax
+  8008be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c1:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8008c4:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8008c6:	83 f8 07             	cmp    $0x7,%eax
+  8008c9:	0f 8e cf 00 00 00    	jle    80099e <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8008cf:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8008d5:	44 89 e7             	mov    %r12d,%edi
+  8008d8:	41 c1 e4 03          	shl    $0x3,%r12d
+  8008dc:	89 d1                	mov    %edx,%ecx
+  8008de:	8d 72 07             	lea    0x7(%rdx),%esi
+  8008e1:	85 d2                	test   %edx,%edx
+  8008e3:	0f 48 d6             	cmovs  %esi,%edx
+  8008e6:	c1 fa 03             	sar    $0x3,%edx
+  8008e9:	83 f9 3f             	cmp    $0x3f,%ecx
+  8008ec:	7f e7                	jg     8008d5 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8008ee:	85 ff                	test   %edi,%edi
+  8008f0:	0f 84 03 fb ff ff    	je     8003f9 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8008f6:	49 63 f4             	movslq %r12d,%rsi
+  8008f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008fe:	48 f7 f6             	div    %rsi
+  800901:	49 89 d7             	mov    %rdx,%r15
+  800904:	83 c0 30             	add    $0x30,%eax
+  800907:	0f be f8             	movsbl %al,%edi
+  80090a:	4c 89 ee             	mov    %r13,%rsi
+  80090d:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800910:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800913:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800918:	45 85 e4             	test   %r12d,%r12d
+  80091b:	41 0f 49 d4          	cmovns %r12d,%edx
+  80091f:	c1 fa 03             	sar    $0x3,%edx
+  800922:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800925:	75 cf                	jne    8008f6 <vprintfmt+0x52e>
+  800927:	e9 cd fa ff ff       	jmp    8003f9 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80092c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800930:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800934:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800938:	eb 87                	jmp    8008c1 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80093a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093d:	83 f8 2f             	cmp    $0x2f,%eax
+  800940:	77 13                	ja     800955 <vprintfmt+0x58d>
+  800942:	89 c2                	mov    %eax,%edx
+  800944:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800948:	83 c0 08             	add    $0x8,%eax
+  80094b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094e:	8b 02                	mov    (%rdx),%eax
+  800950:	e9 6f ff ff ff       	jmp    8008c4 <vprintfmt+0x4fc>
+  800955:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800959:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800961:	eb eb                	jmp    80094e <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800963:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800966:	83 f8 2f             	cmp    $0x2f,%eax
+  800969:	77 14                	ja     80097f <vprintfmt+0x5b7>
+  80096b:	89 c2                	mov    %eax,%edx
+  80096d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800971:	83 c0 08             	add    $0x8,%eax
+  800974:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800977:	48 8b 02             	mov    (%rdx),%rax
+  80097a:	e9 45 ff ff ff       	jmp    8008c4 <vprintfmt+0x4fc>
+  80097f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800983:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800987:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098b:	eb ea                	jmp    800977 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  80098d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800991:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800995:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800999:	e9 0a ff ff ff       	jmp    8008a8 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  80099e:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8009a4:	e9 4d ff ff ff       	jmp    8008f6 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8009a9:	4c 89 ee             	mov    %r13,%rsi
+  8009ac:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009b1:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009b4:	4c 89 ee             	mov    %r13,%rsi
+  8009b7:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009bc:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c5:	77 47                	ja     800a0e <vprintfmt+0x646>
+  8009c7:	89 c2                	mov    %eax,%edx
+  8009c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cd:	83 c0 08             	add    $0x8,%eax
+  8009d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009db:	48 83 ec 08          	sub    $0x8,%rsp
+  8009df:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009e3:	0f 94 c0             	sete   %al
+  8009e6:	0f b6 c0             	movzbl %al,%eax
+  8009e9:	50                   	push   %rax
+  8009ea:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009ef:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009f3:	4c 89 ee             	mov    %r13,%rsi
+  8009f6:	4c 89 f7             	mov    %r14,%rdi
+  8009f9:	48 b8 bd 02 80 00 00 	movabs $0x8002bd,%rax
+  800a00:	00 00 00 
+  800a03:	ff d0                	call   *%rax
+            break;
+  800a05:	48 83 c4 10          	add    $0x10,%rsp
+  800a09:	e9 eb f9 ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1a:	eb b7                	jmp    8009d3 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1c:	40 84 f6             	test   %sil,%sil
+  800a1f:	75 2b                	jne    800a4c <vprintfmt+0x684>
+    switch (lflag) {
+  800a21:	85 d2                	test   %edx,%edx
+  800a23:	74 56                	je     800a7b <vprintfmt+0x6b3>
+  800a25:	83 fa 01             	cmp    $0x1,%edx
+  800a28:	74 7f                	je     800aa9 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800a2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a30:	0f 87 a2 00 00 00    	ja     800ad8 <vprintfmt+0x710>
+  800a36:	89 c2                	mov    %eax,%edx
+  800a38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3c:	83 c0 08             	add    $0x8,%eax
+  800a3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a42:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a45:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a4a:	eb 8f                	jmp    8009db <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a52:	77 19                	ja     800a6d <vprintfmt+0x6a5>
+  800a54:	89 c2                	mov    %eax,%edx
+  800a56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5a:	83 c0 08             	add    $0x8,%eax
+  800a5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a60:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a63:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a68:	e9 6e ff ff ff       	jmp    8009db <vprintfmt+0x613>
+  800a6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a79:	eb e5                	jmp    800a60 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800a7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a81:	77 18                	ja     800a9b <vprintfmt+0x6d3>
+  800a83:	89 c2                	mov    %eax,%edx
+  800a85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a89:	83 c0 08             	add    $0x8,%eax
+  800a8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a8f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a91:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a96:	e9 40 ff ff ff       	jmp    8009db <vprintfmt+0x613>
+  800a9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa7:	eb e6                	jmp    800a8f <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800aa9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aac:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaf:	77 19                	ja     800aca <vprintfmt+0x702>
+  800ab1:	89 c2                	mov    %eax,%edx
+  800ab3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab7:	83 c0 08             	add    $0x8,%eax
+  800aba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ac5:	e9 11 ff ff ff       	jmp    8009db <vprintfmt+0x613>
+  800aca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ace:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad6:	eb e5                	jmp    800abd <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800ad8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800adc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae4:	e9 59 ff ff ff       	jmp    800a42 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800ae9:	4c 89 ee             	mov    %r13,%rsi
+  800aec:	bf 25 00 00 00       	mov    $0x25,%edi
+  800af1:	41 ff d6             	call   *%r14
+            break;
+  800af4:	e9 00 f9 ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800af9:	4c 89 ee             	mov    %r13,%rsi
+  800afc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b01:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b04:	48 83 eb 01          	sub    $0x1,%rbx
+  800b08:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b0c:	75 f6                	jne    800b04 <vprintfmt+0x73c>
+  800b0e:	e9 e6 f8 ff ff       	jmp    8003f9 <vprintfmt+0x31>
+}
+  800b13:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b17:	5b                   	pop    %rbx
+  800b18:	41 5c                	pop    %r12
+  800b1a:	41 5d                	pop    %r13
+  800b1c:	41 5e                	pop    %r14
+  800b1e:	41 5f                	pop    %r15
+  800b20:	5d                   	pop    %rbp
+  800b21:	c3                   	ret
+
+0000000000800b22 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b22:	55                   	push   %rbp
+  800b23:	48 89 e5             	mov    %rsp,%rbp
+  800b26:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b2a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b2e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b33:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b37:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b3e:	48 85 ff             	test   %rdi,%rdi
+  800b41:	74 2b                	je     800b6e <vsnprintf+0x4c>
+  800b43:	48 85 f6             	test   %rsi,%rsi
+  800b46:	74 26                	je     800b6e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b48:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b4c:	48 bf 73 03 80 00 00 	movabs $0x800373,%rdi
+  800b53:	00 00 00 
+  800b56:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  800b5d:	00 00 00 
+  800b60:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b66:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b69:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b6c:	c9                   	leave
+  800b6d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b73:	eb f7                	jmp    800b6c <vsnprintf+0x4a>
+
+0000000000800b75 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b75:	55                   	push   %rbp
+  800b76:	48 89 e5             	mov    %rsp,%rbp
+  800b79:	48 83 ec 50          	sub    $0x50,%rsp
+  800b7d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b81:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b85:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b89:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b98:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ba0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ba4:	48 b8 22 0b 80 00 00 	movabs $0x800b22,%rax
+  800bab:	00 00 00 
+  800bae:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bb0:	c9                   	leave
+  800bb1:	c3                   	ret
+
+0000000000800bb2 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bb2:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bb5:	74 10                	je     800bc7 <strlen+0x15>
+    size_t n = 0;
+  800bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bbc:	48 83 c0 01          	add    $0x1,%rax
+  800bc0:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bc4:	75 f6                	jne    800bbc <strlen+0xa>
+  800bc6:	c3                   	ret
+    size_t n = 0;
+  800bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bcc:	c3                   	ret
+
+0000000000800bcd <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bcd:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bd5:	48 85 f6             	test   %rsi,%rsi
+  800bd8:	74 11                	je     800beb <strnlen+0x1e>
+  800bda:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bde:	74 0c                	je     800bec <strnlen+0x1f>
+  800be0:	48 83 c2 01          	add    $0x1,%rdx
+  800be4:	48 39 d0             	cmp    %rdx,%rax
+  800be7:	75 f1                	jne    800bda <strnlen+0xd>
+  800be9:	eb 04                	jmp    800bef <strnlen+0x22>
+  800beb:	c3                   	ret
+  800bec:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bef:	c3                   	ret
+
+0000000000800bf0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bf0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bfc:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bff:	48 83 c2 01          	add    $0x1,%rdx
+  800c03:	84 c9                	test   %cl,%cl
+  800c05:	75 f1                	jne    800bf8 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c07:	c3                   	ret
+
+0000000000800c08 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c08:	55                   	push   %rbp
+  800c09:	48 89 e5             	mov    %rsp,%rbp
+  800c0c:	41 54                	push   %r12
+  800c0e:	53                   	push   %rbx
+  800c0f:	48 89 fb             	mov    %rdi,%rbx
+  800c12:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c15:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  800c1c:	00 00 00 
+  800c1f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c21:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c25:	4c 89 e6             	mov    %r12,%rsi
+  800c28:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  800c2f:	00 00 00 
+  800c32:	ff d0                	call   *%rax
+    return dst;
+}
+  800c34:	48 89 d8             	mov    %rbx,%rax
+  800c37:	5b                   	pop    %rbx
+  800c38:	41 5c                	pop    %r12
+  800c3a:	5d                   	pop    %rbp
+  800c3b:	c3                   	ret
+
+0000000000800c3c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c3c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c3f:	48 85 d2             	test   %rdx,%rdx
+  800c42:	74 1f                	je     800c63 <strncpy+0x27>
+  800c44:	48 01 fa             	add    %rdi,%rdx
+  800c47:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c4a:	48 83 c1 01          	add    $0x1,%rcx
+  800c4e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c52:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c56:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c5a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c5e:	48 39 ca             	cmp    %rcx,%rdx
+  800c61:	75 e7                	jne    800c4a <strncpy+0xe>
+    }
+    return ret;
+}
+  800c63:	c3                   	ret
+
+0000000000800c64 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c64:	48 89 f8             	mov    %rdi,%rax
+  800c67:	48 85 d2             	test   %rdx,%rdx
+  800c6a:	74 24                	je     800c90 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c6c:	48 83 ea 01          	sub    $0x1,%rdx
+  800c70:	74 1b                	je     800c8d <strlcpy+0x29>
+  800c72:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c76:	0f b6 16             	movzbl (%rsi),%edx
+  800c79:	84 d2                	test   %dl,%dl
+  800c7b:	74 10                	je     800c8d <strlcpy+0x29>
+            *dst++ = *src++;
+  800c7d:	48 83 c6 01          	add    $0x1,%rsi
+  800c81:	48 83 c0 01          	add    $0x1,%rax
+  800c85:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c88:	48 39 c8             	cmp    %rcx,%rax
+  800c8b:	75 e9                	jne    800c76 <strlcpy+0x12>
+        *dst = '\0';
+  800c8d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c90:	48 29 f8             	sub    %rdi,%rax
+}
+  800c93:	c3                   	ret
+
+0000000000800c94 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c94:	0f b6 07             	movzbl (%rdi),%eax
+  800c97:	84 c0                	test   %al,%al
+  800c99:	74 13                	je     800cae <strcmp+0x1a>
+  800c9b:	38 06                	cmp    %al,(%rsi)
+  800c9d:	75 0f                	jne    800cae <strcmp+0x1a>
+  800c9f:	48 83 c7 01          	add    $0x1,%rdi
+  800ca3:	48 83 c6 01          	add    $0x1,%rsi
+  800ca7:	0f b6 07             	movzbl (%rdi),%eax
+  800caa:	84 c0                	test   %al,%al
+  800cac:	75 ed                	jne    800c9b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cae:	0f b6 c0             	movzbl %al,%eax
+  800cb1:	0f b6 16             	movzbl (%rsi),%edx
+  800cb4:	29 d0                	sub    %edx,%eax
+}
+  800cb6:	c3                   	ret
+
+0000000000800cb7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cb7:	48 85 d2             	test   %rdx,%rdx
+  800cba:	74 1f                	je     800cdb <strncmp+0x24>
+  800cbc:	0f b6 07             	movzbl (%rdi),%eax
+  800cbf:	84 c0                	test   %al,%al
+  800cc1:	74 1e                	je     800ce1 <strncmp+0x2a>
+  800cc3:	3a 06                	cmp    (%rsi),%al
+  800cc5:	75 1a                	jne    800ce1 <strncmp+0x2a>
+  800cc7:	48 83 c7 01          	add    $0x1,%rdi
+  800ccb:	48 83 c6 01          	add    $0x1,%rsi
+  800ccf:	48 83 ea 01          	sub    $0x1,%rdx
+  800cd3:	75 e7                	jne    800cbc <strncmp+0x5>
+
+    if (!n) return 0;
+  800cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cda:	c3                   	ret
+  800cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce0:	c3                   	ret
+  800ce1:	48 85 d2             	test   %rdx,%rdx
+  800ce4:	74 09                	je     800cef <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ce6:	0f b6 07             	movzbl (%rdi),%eax
+  800ce9:	0f b6 16             	movzbl (%rsi),%edx
+  800cec:	29 d0                	sub    %edx,%eax
+  800cee:	c3                   	ret
+    if (!n) return 0;
+  800cef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cf4:	c3                   	ret
+
+0000000000800cf5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cf5:	0f b6 17             	movzbl (%rdi),%edx
+  800cf8:	84 d2                	test   %dl,%dl
+  800cfa:	74 18                	je     800d14 <strchr+0x1f>
+        if (*str == c) {
+  800cfc:	0f be d2             	movsbl %dl,%edx
+  800cff:	39 f2                	cmp    %esi,%edx
+  800d01:	74 17                	je     800d1a <strchr+0x25>
+    for (; *str; str++) {
+  800d03:	48 83 c7 01          	add    $0x1,%rdi
+  800d07:	0f b6 17             	movzbl (%rdi),%edx
+  800d0a:	84 d2                	test   %dl,%dl
+  800d0c:	75 ee                	jne    800cfc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d13:	c3                   	ret
+  800d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d19:	c3                   	ret
+  800d1a:	48 89 f8             	mov    %rdi,%rax
+}
+  800d1d:	c3                   	ret
+
+0000000000800d1e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d1e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d21:	0f b6 17             	movzbl (%rdi),%edx
+  800d24:	84 d2                	test   %dl,%dl
+  800d26:	74 13                	je     800d3b <strfind+0x1d>
+  800d28:	0f be d2             	movsbl %dl,%edx
+  800d2b:	39 f2                	cmp    %esi,%edx
+  800d2d:	74 0b                	je     800d3a <strfind+0x1c>
+  800d2f:	48 83 c0 01          	add    $0x1,%rax
+  800d33:	0f b6 10             	movzbl (%rax),%edx
+  800d36:	84 d2                	test   %dl,%dl
+  800d38:	75 ee                	jne    800d28 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d3a:	c3                   	ret
+  800d3b:	c3                   	ret
+
+0000000000800d3c <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800d3c:	55                   	push   %rbp
+  800d3d:	48 89 e5             	mov    %rsp,%rbp
+  800d40:	41 57                	push   %r15
+  800d42:	41 56                	push   %r14
+  800d44:	41 55                	push   %r13
+  800d46:	41 54                	push   %r12
+  800d48:	53                   	push   %rbx
+  800d49:	48 83 ec 08          	sub    $0x8,%rsp
+  800d4d:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800d50:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800d54:	45 84 ed             	test   %r13b,%r13b
+  800d57:	75 12                	jne    800d6b <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800d59:	4c 89 f8             	mov    %r15,%rax
+  800d5c:	48 83 c4 08          	add    $0x8,%rsp
+  800d60:	5b                   	pop    %rbx
+  800d61:	41 5c                	pop    %r12
+  800d63:	41 5d                	pop    %r13
+  800d65:	41 5e                	pop    %r14
+  800d67:	41 5f                	pop    %r15
+  800d69:	5d                   	pop    %rbp
+  800d6a:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800d6b:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800d6f:	4c 89 e7             	mov    %r12,%rdi
+  800d72:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  800d79:	00 00 00 
+  800d7c:	ff d0                	call   *%rax
+  800d7e:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800d81:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800d85:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800d89:	49 bf b7 0c 80 00 00 	movabs $0x800cb7,%r15
+  800d90:	00 00 00 
+				if ((sc = *s++) == 0)
+  800d93:	84 c0                	test   %al,%al
+  800d95:	75 14                	jne    800dab <strstr+0x6f>
+					return NULL;
+  800d97:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d9d:	eb ba                	jmp    800d59 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800d9f:	48 83 c3 01          	add    $0x1,%rbx
+  800da3:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800da7:	84 c0                	test   %al,%al
+  800da9:	74 1b                	je     800dc6 <strstr+0x8a>
+			} while (sc != c);
+  800dab:	41 38 c5             	cmp    %al,%r13b
+  800dae:	75 ef                	jne    800d9f <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800db0:	4c 89 f2             	mov    %r14,%rdx
+  800db3:	4c 89 e6             	mov    %r12,%rsi
+  800db6:	48 89 df             	mov    %rbx,%rdi
+  800db9:	41 ff d7             	call   *%r15
+  800dbc:	85 c0                	test   %eax,%eax
+  800dbe:	75 df                	jne    800d9f <strstr+0x63>
+  800dc0:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800dc4:	eb 93                	jmp    800d59 <strstr+0x1d>
+					return NULL;
+  800dc6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800dcc:	eb 8b                	jmp    800d59 <strstr+0x1d>
+
+0000000000800dce <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800dce:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800dd0:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800dd3:	8d 57 20             	lea    0x20(%rdi),%edx
+  800dd6:	83 f9 1a             	cmp    $0x1a,%ecx
+  800dd9:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800ddc:	c3                   	ret
+
+0000000000800ddd <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800ddd:	55                   	push   %rbp
+  800dde:	48 89 e5             	mov    %rsp,%rbp
+  800de1:	41 57                	push   %r15
+  800de3:	41 56                	push   %r14
+  800de5:	41 55                	push   %r13
+  800de7:	41 54                	push   %r12
+  800de9:	53                   	push   %rbx
+  800dea:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800dee:	48 39 f7             	cmp    %rsi,%rdi
+  800df1:	74 49                	je     800e3c <strcasecmp+0x5f>
+  800df3:	49 89 fd             	mov    %rdi,%r13
+  800df6:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800df9:	49 bf ce 0d 80 00 00 	movabs $0x800dce,%r15
+  800e00:	00 00 00 
+  800e03:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800e08:	41 0f b6 fe          	movzbl %r14b,%edi
+  800e0c:	41 ff d7             	call   *%r15
+  800e0f:	89 c3                	mov    %eax,%ebx
+  800e11:	49 83 c4 01          	add    $0x1,%r12
+  800e15:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e1b:	41 ff d7             	call   *%r15
+  800e1e:	29 c3                	sub    %eax,%ebx
+  800e20:	75 09                	jne    800e2b <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800e22:	49 83 c5 01          	add    $0x1,%r13
+  800e26:	45 84 f6             	test   %r14b,%r14b
+  800e29:	75 d8                	jne    800e03 <strcasecmp+0x26>
+}
+  800e2b:	89 d8                	mov    %ebx,%eax
+  800e2d:	48 83 c4 08          	add    $0x8,%rsp
+  800e31:	5b                   	pop    %rbx
+  800e32:	41 5c                	pop    %r12
+  800e34:	41 5d                	pop    %r13
+  800e36:	41 5e                	pop    %r14
+  800e38:	41 5f                	pop    %r15
+  800e3a:	5d                   	pop    %rbp
+  800e3b:	c3                   	ret
+        return 0;
+  800e3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e41:	eb e8                	jmp    800e2b <strcasecmp+0x4e>
+
+0000000000800e43 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800e43:	55                   	push   %rbp
+  800e44:	48 89 e5             	mov    %rsp,%rbp
+  800e47:	41 57                	push   %r15
+  800e49:	41 56                	push   %r14
+  800e4b:	41 55                	push   %r13
+  800e4d:	41 54                	push   %r12
+  800e4f:	53                   	push   %rbx
+  800e50:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800e54:	48 85 d2             	test   %rdx,%rdx
+  800e57:	74 4f                	je     800ea8 <strncasecmp+0x65>
+  800e59:	49 89 fc             	mov    %rdi,%r12
+  800e5c:	49 89 f5             	mov    %rsi,%r13
+  800e5f:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800e63:	49 be ce 0d 80 00 00 	movabs $0x800dce,%r14
+  800e6a:	00 00 00 
+  800e6d:	49 83 c4 01          	add    $0x1,%r12
+  800e71:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e77:	41 ff d6             	call   *%r14
+  800e7a:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800e7c:	49 83 c5 01          	add    $0x1,%r13
+  800e80:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800e85:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800e88:	29 c3                	sub    %eax,%ebx
+  800e8a:	85 c0                	test   %eax,%eax
+  800e8c:	74 09                	je     800e97 <strncasecmp+0x54>
+  800e8e:	85 db                	test   %ebx,%ebx
+  800e90:	75 05                	jne    800e97 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800e92:	4d 39 fc             	cmp    %r15,%r12
+  800e95:	75 d6                	jne    800e6d <strncasecmp+0x2a>
+}
+  800e97:	89 d8                	mov    %ebx,%eax
+  800e99:	48 83 c4 08          	add    $0x8,%rsp
+  800e9d:	5b                   	pop    %rbx
+  800e9e:	41 5c                	pop    %r12
+  800ea0:	41 5d                	pop    %r13
+  800ea2:	41 5e                	pop    %r14
+  800ea4:	41 5f                	pop    %r15
+  800ea6:	5d                   	pop    %rbp
+  800ea7:	c3                   	ret
+    int d = 0;
+  800ea8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800ead:	eb e8                	jmp    800e97 <strncasecmp+0x54>
+
+0000000000800eaf <toupper>:
+
+int toupper(int c) {
+  800eaf:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800eb1:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800eb4:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800eb7:	83 f9 1a             	cmp    $0x1a,%ecx
+  800eba:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800ebd:	c3                   	ret
+
+0000000000800ebe <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800ebe:	83 ff 20             	cmp    $0x20,%edi
+  800ec1:	0f 94 c0             	sete   %al
+  800ec4:	0f b6 c0             	movzbl %al,%eax
+}
+  800ec7:	c3                   	ret
+
+0000000000800ec8 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800ec8:	89 f8                	mov    %edi,%eax
+  800eca:	f7 d8                	neg    %eax
+  800ecc:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800ecf:	c3                   	ret
+
+0000000000800ed0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ed0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ed3:	48 89 f8             	mov    %rdi,%rax
+  800ed6:	48 f7 d8             	neg    %rax
+  800ed9:	83 e0 07             	and    $0x7,%eax
+  800edc:	49 89 d1             	mov    %rdx,%r9
+  800edf:	49 29 c1             	sub    %rax,%r9
+  800ee2:	78 36                	js     800f1a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ee4:	40 0f b6 c6          	movzbl %sil,%eax
+  800ee8:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800eef:	01 01 01 
+  800ef2:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ef6:	40 f6 c7 07          	test   $0x7,%dil
+  800efa:	75 38                	jne    800f34 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800efc:	4c 89 c9             	mov    %r9,%rcx
+  800eff:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f03:	74 0c                	je     800f11 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f05:	fc                   	cld
+  800f06:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f09:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f0d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f11:	4d 85 c9             	test   %r9,%r9
+  800f14:	75 45                	jne    800f5b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f16:	4c 89 c0             	mov    %r8,%rax
+  800f19:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f1a:	48 85 d2             	test   %rdx,%rdx
+  800f1d:	74 f7                	je     800f16 <memset+0x46>
+  800f1f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f22:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f25:	48 83 c0 01          	add    $0x1,%rax
+  800f29:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f2d:	48 39 c2             	cmp    %rax,%rdx
+  800f30:	75 f3                	jne    800f25 <memset+0x55>
+  800f32:	eb e2                	jmp    800f16 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f34:	40 f6 c7 01          	test   $0x1,%dil
+  800f38:	74 06                	je     800f40 <memset+0x70>
+  800f3a:	88 07                	mov    %al,(%rdi)
+  800f3c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f40:	40 f6 c7 02          	test   $0x2,%dil
+  800f44:	74 07                	je     800f4d <memset+0x7d>
+  800f46:	66 89 07             	mov    %ax,(%rdi)
+  800f49:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f4d:	40 f6 c7 04          	test   $0x4,%dil
+  800f51:	74 a9                	je     800efc <memset+0x2c>
+  800f53:	89 07                	mov    %eax,(%rdi)
+  800f55:	48 83 c7 04          	add    $0x4,%rdi
+  800f59:	eb a1                	jmp    800efc <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f5b:	41 f6 c1 04          	test   $0x4,%r9b
+  800f5f:	74 06                	je     800f67 <memset+0x97>
+  800f61:	89 07                	mov    %eax,(%rdi)
+  800f63:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f67:	41 f6 c1 02          	test   $0x2,%r9b
+  800f6b:	74 07                	je     800f74 <memset+0xa4>
+  800f6d:	66 89 07             	mov    %ax,(%rdi)
+  800f70:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f74:	41 f6 c1 01          	test   $0x1,%r9b
+  800f78:	74 9c                	je     800f16 <memset+0x46>
+  800f7a:	88 07                	mov    %al,(%rdi)
+  800f7c:	eb 98                	jmp    800f16 <memset+0x46>
+
+0000000000800f7e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f7e:	48 89 f8             	mov    %rdi,%rax
+  800f81:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f84:	48 39 fe             	cmp    %rdi,%rsi
+  800f87:	73 3b                	jae    800fc4 <memmove+0x46>
+  800f89:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f8d:	48 39 d7             	cmp    %rdx,%rdi
+  800f90:	73 32                	jae    800fc4 <memmove+0x46>
+        s += n;
+        d += n;
+  800f92:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f96:	48 89 d6             	mov    %rdx,%rsi
+  800f99:	48 09 fe             	or     %rdi,%rsi
+  800f9c:	48 09 ce             	or     %rcx,%rsi
+  800f9f:	40 f6 c6 07          	test   $0x7,%sil
+  800fa3:	75 12                	jne    800fb7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fa5:	48 83 ef 08          	sub    $0x8,%rdi
+  800fa9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fad:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fb1:	fd                   	std
+  800fb2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fb5:	fc                   	cld
+  800fb6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fb7:	48 83 ef 01          	sub    $0x1,%rdi
+  800fbb:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fbf:	fd                   	std
+  800fc0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fc2:	eb f1                	jmp    800fb5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fc4:	48 89 f2             	mov    %rsi,%rdx
+  800fc7:	48 09 c2             	or     %rax,%rdx
+  800fca:	48 09 ca             	or     %rcx,%rdx
+  800fcd:	f6 c2 07             	test   $0x7,%dl
+  800fd0:	75 0c                	jne    800fde <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fd2:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fd6:	48 89 c7             	mov    %rax,%rdi
+  800fd9:	fc                   	cld
+  800fda:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fdd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fde:	48 89 c7             	mov    %rax,%rdi
+  800fe1:	fc                   	cld
+  800fe2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fe4:	c3                   	ret
+
+0000000000800fe5 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fe5:	55                   	push   %rbp
+  800fe6:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fe9:	48 b8 7e 0f 80 00 00 	movabs $0x800f7e,%rax
+  800ff0:	00 00 00 
+  800ff3:	ff d0                	call   *%rax
+}
+  800ff5:	5d                   	pop    %rbp
+  800ff6:	c3                   	ret
+
+0000000000800ff7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ff7:	55                   	push   %rbp
+  800ff8:	48 89 e5             	mov    %rsp,%rbp
+  800ffb:	41 57                	push   %r15
+  800ffd:	41 56                	push   %r14
+  800fff:	41 55                	push   %r13
+  801001:	41 54                	push   %r12
+  801003:	53                   	push   %rbx
+  801004:	48 83 ec 08          	sub    $0x8,%rsp
+  801008:	49 89 fe             	mov    %rdi,%r14
+  80100b:	49 89 f7             	mov    %rsi,%r15
+  80100e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801011:	48 89 f7             	mov    %rsi,%rdi
+  801014:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  80101b:	00 00 00 
+  80101e:	ff d0                	call   *%rax
+  801020:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801023:	48 89 de             	mov    %rbx,%rsi
+  801026:	4c 89 f7             	mov    %r14,%rdi
+  801029:	48 b8 cd 0b 80 00 00 	movabs $0x800bcd,%rax
+  801030:	00 00 00 
+  801033:	ff d0                	call   *%rax
+  801035:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801038:	48 39 c3             	cmp    %rax,%rbx
+  80103b:	74 36                	je     801073 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80103d:	48 89 d8             	mov    %rbx,%rax
+  801040:	4c 29 e8             	sub    %r13,%rax
+  801043:	49 39 c4             	cmp    %rax,%r12
+  801046:	73 31                	jae    801079 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801048:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80104d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801051:	4c 89 fe             	mov    %r15,%rsi
+  801054:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  80105b:	00 00 00 
+  80105e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801060:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801064:	48 83 c4 08          	add    $0x8,%rsp
+  801068:	5b                   	pop    %rbx
+  801069:	41 5c                	pop    %r12
+  80106b:	41 5d                	pop    %r13
+  80106d:	41 5e                	pop    %r14
+  80106f:	41 5f                	pop    %r15
+  801071:	5d                   	pop    %rbp
+  801072:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801073:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801077:	eb eb                	jmp    801064 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801079:	48 83 eb 01          	sub    $0x1,%rbx
+  80107d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801081:	48 89 da             	mov    %rbx,%rdx
+  801084:	4c 89 fe             	mov    %r15,%rsi
+  801087:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  80108e:	00 00 00 
+  801091:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801093:	49 01 de             	add    %rbx,%r14
+  801096:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80109b:	eb c3                	jmp    801060 <strlcat+0x69>
+
+000000000080109d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80109d:	48 85 d2             	test   %rdx,%rdx
+  8010a0:	74 2d                	je     8010cf <memcmp+0x32>
+  8010a2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010a7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010ab:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010b0:	44 38 c1             	cmp    %r8b,%cl
+  8010b3:	75 0f                	jne    8010c4 <memcmp+0x27>
+    while (n-- > 0) {
+  8010b5:	48 83 c0 01          	add    $0x1,%rax
+  8010b9:	48 39 c2             	cmp    %rax,%rdx
+  8010bc:	75 e9                	jne    8010a7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010c4:	0f b6 c1             	movzbl %cl,%eax
+  8010c7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010cb:	44 29 c0             	sub    %r8d,%eax
+  8010ce:	c3                   	ret
+    return 0;
+  8010cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010d4:	c3                   	ret
+
+00000000008010d5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010d5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010d9:	48 39 c7             	cmp    %rax,%rdi
+  8010dc:	73 0f                	jae    8010ed <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010de:	40 38 37             	cmp    %sil,(%rdi)
+  8010e1:	74 0e                	je     8010f1 <memfind+0x1c>
+    for (; src < end; src++) {
+  8010e3:	48 83 c7 01          	add    $0x1,%rdi
+  8010e7:	48 39 f8             	cmp    %rdi,%rax
+  8010ea:	75 f2                	jne    8010de <memfind+0x9>
+  8010ec:	c3                   	ret
+  8010ed:	48 89 f8             	mov    %rdi,%rax
+  8010f0:	c3                   	ret
+  8010f1:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010f4:	c3                   	ret
+
+00000000008010f5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010f5:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010f8:	0f b6 37             	movzbl (%rdi),%esi
+  8010fb:	40 80 fe 20          	cmp    $0x20,%sil
+  8010ff:	74 06                	je     801107 <strtol+0x12>
+  801101:	40 80 fe 09          	cmp    $0x9,%sil
+  801105:	75 13                	jne    80111a <strtol+0x25>
+  801107:	48 83 c7 01          	add    $0x1,%rdi
+  80110b:	0f b6 37             	movzbl (%rdi),%esi
+  80110e:	40 80 fe 20          	cmp    $0x20,%sil
+  801112:	74 f3                	je     801107 <strtol+0x12>
+  801114:	40 80 fe 09          	cmp    $0x9,%sil
+  801118:	74 ed                	je     801107 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80111a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80111d:	83 e0 fd             	and    $0xfffffffd,%eax
+  801120:	3c 01                	cmp    $0x1,%al
+  801122:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801126:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80112c:	75 0f                	jne    80113d <strtol+0x48>
+  80112e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801131:	74 14                	je     801147 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801133:	85 d2                	test   %edx,%edx
+  801135:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80113a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80113d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801142:	4c 63 ca             	movslq %edx,%r9
+  801145:	eb 36                	jmp    80117d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801147:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80114b:	74 0f                	je     80115c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80114d:	85 d2                	test   %edx,%edx
+  80114f:	75 ec                	jne    80113d <strtol+0x48>
+        s++;
+  801151:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801155:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80115a:	eb e1                	jmp    80113d <strtol+0x48>
+        s += 2;
+  80115c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801160:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801165:	eb d6                	jmp    80113d <strtol+0x48>
+            dig -= '0';
+  801167:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80116a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80116e:	41 39 d0             	cmp    %edx,%r8d
+  801171:	7d 21                	jge    801194 <strtol+0x9f>
+        val = val * base + dig;
+  801173:	49 0f af c1          	imul   %r9,%rax
+  801177:	0f b6 c9             	movzbl %cl,%ecx
+  80117a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80117d:	48 83 c7 01          	add    $0x1,%rdi
+  801181:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801185:	80 f9 39             	cmp    $0x39,%cl
+  801188:	76 dd                	jbe    801167 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80118a:	80 f9 7b             	cmp    $0x7b,%cl
+  80118d:	77 05                	ja     801194 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80118f:	83 e9 57             	sub    $0x57,%ecx
+  801192:	eb d6                	jmp    80116a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801194:	4d 85 d2             	test   %r10,%r10
+  801197:	74 03                	je     80119c <strtol+0xa7>
+  801199:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80119c:	48 89 c2             	mov    %rax,%rdx
+  80119f:	48 f7 da             	neg    %rdx
+  8011a2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011a6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011aa:	c3                   	ret
+
+00000000008011ab <atoi>:
+int atoi(const char *str) {
+  8011ab:	55                   	push   %rbp
+  8011ac:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8011af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b9:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  8011c0:	00 00 00 
+  8011c3:	ff d0                	call   *%rax
+}
+  8011c5:	5d                   	pop    %rbp
+  8011c6:	c3                   	ret
+
+00000000008011c7 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011c7:	55                   	push   %rbp
+  8011c8:	48 89 e5             	mov    %rsp,%rbp
+  8011cb:	53                   	push   %rbx
+  8011cc:	48 89 fa             	mov    %rdi,%rdx
+  8011cf:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d2:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ec:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f2:	c9                   	leave
+  8011f3:	c3                   	ret
+
+00000000008011f4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011f4:	55                   	push   %rbp
+  8011f5:	48 89 e5             	mov    %rsp,%rbp
+  8011f8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801203:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801208:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801212:	be 00 00 00 00       	mov    $0x0,%esi
+  801217:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80121d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80121f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801223:	c9                   	leave
+  801224:	c3                   	ret
+
+0000000000801225 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801225:	55                   	push   %rbp
+  801226:	48 89 e5             	mov    %rsp,%rbp
+  801229:	53                   	push   %rbx
+  80122a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80122e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801231:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801236:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80123b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801240:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801245:	be 00 00 00 00       	mov    $0x0,%esi
+  80124a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801250:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801252:	48 85 c0             	test   %rax,%rax
+  801255:	7f 06                	jg     80125d <sys_env_destroy+0x38>
+}
+  801257:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80125b:	c9                   	leave
+  80125c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80125d:	49 89 c0             	mov    %rax,%r8
+  801260:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801265:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80126c:	00 00 00 
+  80126f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801274:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80127b:	00 00 00 
+  80127e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801283:	49 b9 92 42 80 00 00 	movabs $0x804292,%r9
+  80128a:	00 00 00 
+  80128d:	41 ff d1             	call   *%r9
+
+0000000000801290 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801290:	55                   	push   %rbp
+  801291:	48 89 e5             	mov    %rsp,%rbp
+  801294:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801295:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80129a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b9:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012bf:	c9                   	leave
+  8012c0:	c3                   	ret
+
+00000000008012c1 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012c1:	55                   	push   %rbp
+  8012c2:	48 89 e5             	mov    %rsp,%rbp
+  8012c5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c6:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012df:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ea:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f0:	c9                   	leave
+  8012f1:	c3                   	ret
+
+00000000008012f2 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012f2:	55                   	push   %rbp
+  8012f3:	48 89 e5             	mov    %rsp,%rbp
+  8012f6:	53                   	push   %rbx
+  8012f7:	48 89 fa             	mov    %rdi,%rdx
+  8012fa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801302:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801309:	00 00 00 
+  80130c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801311:	be 00 00 00 00       	mov    $0x0,%esi
+  801316:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80131c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80131e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801322:	c9                   	leave
+  801323:	c3                   	ret
+
+0000000000801324 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801324:	55                   	push   %rbp
+  801325:	48 89 e5             	mov    %rsp,%rbp
+  801328:	53                   	push   %rbx
+  801329:	49 89 f8             	mov    %rdi,%r8
+  80132c:	48 89 d3             	mov    %rdx,%rbx
+  80132f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801332:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801337:	4c 89 c2             	mov    %r8,%rdx
+  80133a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133d:	be 00 00 00 00       	mov    $0x0,%esi
+  801342:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801348:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80134a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134e:	c9                   	leave
+  80134f:	c3                   	ret
+
+0000000000801350 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801350:	55                   	push   %rbp
+  801351:	48 89 e5             	mov    %rsp,%rbp
+  801354:	53                   	push   %rbx
+  801355:	48 83 ec 08          	sub    $0x8,%rsp
+  801359:	89 f8                	mov    %edi,%eax
+  80135b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80135e:	48 63 f9             	movslq %ecx,%rdi
+  801361:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801364:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801369:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136c:	be 00 00 00 00       	mov    $0x0,%esi
+  801371:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801377:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801379:	48 85 c0             	test   %rax,%rax
+  80137c:	7f 06                	jg     801384 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80137e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801382:	c9                   	leave
+  801383:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801384:	49 89 c0             	mov    %rax,%r8
+  801387:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80138c:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801393:	00 00 00 
+  801396:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80139b:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8013a2:	00 00 00 
+  8013a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013aa:	49 b9 92 42 80 00 00 	movabs $0x804292,%r9
+  8013b1:	00 00 00 
+  8013b4:	41 ff d1             	call   *%r9
+
+00000000008013b7 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013b7:	55                   	push   %rbp
+  8013b8:	48 89 e5             	mov    %rsp,%rbp
+  8013bb:	53                   	push   %rbx
+  8013bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8013c0:	89 f8                	mov    %edi,%eax
+  8013c2:	49 89 f2             	mov    %rsi,%r10
+  8013c5:	48 89 cf             	mov    %rcx,%rdi
+  8013c8:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013cb:	48 63 da             	movslq %edx,%rbx
+  8013ce:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d9:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013de:	48 85 c0             	test   %rax,%rax
+  8013e1:	7f 06                	jg     8013e9 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e7:	c9                   	leave
+  8013e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e9:	49 89 c0             	mov    %rax,%r8
+  8013ec:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013f1:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8013f8:	00 00 00 
+  8013fb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801400:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801407:	00 00 00 
+  80140a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140f:	49 b9 92 42 80 00 00 	movabs $0x804292,%r9
+  801416:	00 00 00 
+  801419:	41 ff d1             	call   *%r9
+
+000000000080141c <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+  801420:	53                   	push   %rbx
+  801421:	48 83 ec 08          	sub    $0x8,%rsp
+  801425:	49 89 f9             	mov    %rdi,%r9
+  801428:	89 f0                	mov    %esi,%eax
+  80142a:	48 89 d3             	mov    %rdx,%rbx
+  80142d:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801430:	49 63 f0             	movslq %r8d,%rsi
+  801433:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801436:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80143b:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801444:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801446:	48 85 c0             	test   %rax,%rax
+  801449:	7f 06                	jg     801451 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80144b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144f:	c9                   	leave
+  801450:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801451:	49 89 c0             	mov    %rax,%r8
+  801454:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801459:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801460:	00 00 00 
+  801463:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801468:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80146f:	00 00 00 
+  801472:	b8 00 00 00 00       	mov    $0x0,%eax
+  801477:	49 b9 92 42 80 00 00 	movabs $0x804292,%r9
+  80147e:	00 00 00 
+  801481:	41 ff d1             	call   *%r9
+
+0000000000801484 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801484:	55                   	push   %rbp
+  801485:	48 89 e5             	mov    %rsp,%rbp
+  801488:	53                   	push   %rbx
+  801489:	89 f8                	mov    %edi,%eax
+  80148b:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80148e:	48 63 f9             	movslq %ecx,%rdi
+  801491:	48 63 da             	movslq %edx,%rbx
+  801494:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801497:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80149c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149f:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014aa:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8014ac:	89 c2                	mov    %eax,%edx
+  8014ae:	48 85 c0             	test   %rax,%rax
+  8014b1:	78 0d                	js     8014c0 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8014b3:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8014b8:	4d 85 c9             	test   %r9,%r9
+  8014bb:	74 03                	je     8014c0 <sys_alloc_dma_region+0x3c>
+  8014bd:	49 89 01             	mov    %rax,(%r9)
+}
+  8014c0:	89 d0                	mov    %edx,%eax
+  8014c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c6:	c9                   	leave
+  8014c7:	c3                   	ret
+
+00000000008014c8 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8014c8:	55                   	push   %rbp
+  8014c9:	48 89 e5             	mov    %rsp,%rbp
+  8014cc:	53                   	push   %rbx
+  8014cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d1:	48 89 f1             	mov    %rsi,%rcx
+  8014d4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014d7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014da:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ef:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f1:	48 85 c0             	test   %rax,%rax
+  8014f4:	7f 06                	jg     8014fc <sys_set_cache_region+0x34>
+}
+  8014f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fa:	c9                   	leave
+  8014fb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014fc:	49 89 c0             	mov    %rax,%r8
+  8014ff:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801504:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80150b:	00 00 00 
+  80150e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801513:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80151a:	00 00 00 
+  80151d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801522:	49 b9 92 42 80 00 00 	movabs $0x804292,%r9
+  801529:	00 00 00 
+  80152c:	41 ff d1             	call   *%r9
+
+000000000080152f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80152f:	55                   	push   %rbp
+  801530:	48 89 e5             	mov    %rsp,%rbp
+  801533:	53                   	push   %rbx
+  801534:	48 83 ec 08          	sub    $0x8,%rsp
+  801538:	48 89 f1             	mov    %rsi,%rcx
+  80153b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80153e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801541:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801546:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154b:	be 00 00 00 00       	mov    $0x0,%esi
+  801550:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801556:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801558:	48 85 c0             	test   %rax,%rax
+  80155b:	7f 06                	jg     801563 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80155d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801561:	c9                   	leave
+  801562:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801563:	49 89 c0             	mov    %rax,%r8
+  801566:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80156b:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801572:	00 00 00 
+  801575:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80157a:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801581:	00 00 00 
+  801584:	b8 00 00 00 00       	mov    $0x0,%eax
+  801589:	49 b9 92 42 80 00 00 	movabs $0x804292,%r9
+  801590:	00 00 00 
+  801593:	41 ff d1             	call   *%r9
+
+0000000000801596 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801596:	55                   	push   %rbp
+  801597:	48 89 e5             	mov    %rsp,%rbp
+  80159a:	53                   	push   %rbx
+  80159b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80159f:	48 63 ce             	movslq %esi,%rcx
+  8015a2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c1:	48 85 c0             	test   %rax,%rax
+  8015c4:	7f 06                	jg     8015cc <sys_env_set_status+0x36>
+}
+  8015c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ca:	c9                   	leave
+  8015cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015cc:	49 89 c0             	mov    %rax,%r8
+  8015cf:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8015d4:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8015db:	00 00 00 
+  8015de:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015e3:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8015ea:	00 00 00 
+  8015ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f2:	49 b9 92 42 80 00 00 	movabs $0x804292,%r9
+  8015f9:	00 00 00 
+  8015fc:	41 ff d1             	call   *%r9
+
+00000000008015ff <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015ff:	55                   	push   %rbp
+  801600:	48 89 e5             	mov    %rsp,%rbp
+  801603:	53                   	push   %rbx
+  801604:	48 83 ec 08          	sub    $0x8,%rsp
+  801608:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80160b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80160e:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801613:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801618:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80161d:	be 00 00 00 00       	mov    $0x0,%esi
+  801622:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801628:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80162a:	48 85 c0             	test   %rax,%rax
+  80162d:	7f 06                	jg     801635 <sys_env_set_trapframe+0x36>
+}
+  80162f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801633:	c9                   	leave
+  801634:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801635:	49 89 c0             	mov    %rax,%r8
+  801638:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80163d:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801644:	00 00 00 
+  801647:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80164c:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801653:	00 00 00 
+  801656:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165b:	49 b9 92 42 80 00 00 	movabs $0x804292,%r9
+  801662:	00 00 00 
+  801665:	41 ff d1             	call   *%r9
+
+0000000000801668 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801668:	55                   	push   %rbp
+  801669:	48 89 e5             	mov    %rsp,%rbp
+  80166c:	53                   	push   %rbx
+  80166d:	48 83 ec 08          	sub    $0x8,%rsp
+  801671:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801674:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801677:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801681:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801686:	be 00 00 00 00       	mov    $0x0,%esi
+  80168b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801691:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801693:	48 85 c0             	test   %rax,%rax
+  801696:	7f 06                	jg     80169e <sys_env_set_pgfault_upcall+0x36>
+}
+  801698:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169c:	c9                   	leave
+  80169d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169e:	49 89 c0             	mov    %rax,%r8
+  8016a1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016a6:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8016ad:	00 00 00 
+  8016b0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016b5:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8016bc:	00 00 00 
+  8016bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c4:	49 b9 92 42 80 00 00 	movabs $0x804292,%r9
+  8016cb:	00 00 00 
+  8016ce:	41 ff d1             	call   *%r9
+
+00000000008016d1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016d1:	55                   	push   %rbp
+  8016d2:	48 89 e5             	mov    %rsp,%rbp
+  8016d5:	53                   	push   %rbx
+  8016d6:	89 f8                	mov    %edi,%eax
+  8016d8:	49 89 f1             	mov    %rsi,%r9
+  8016db:	48 89 d3             	mov    %rdx,%rbx
+  8016de:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016e1:	49 63 f0             	movslq %r8d,%rsi
+  8016e4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016ec:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f5:	cd 30                	int    $0x30
+}
+  8016f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fb:	c9                   	leave
+  8016fc:	c3                   	ret
+
+00000000008016fd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016fd:	55                   	push   %rbp
+  8016fe:	48 89 e5             	mov    %rsp,%rbp
+  801701:	53                   	push   %rbx
+  801702:	48 83 ec 08          	sub    $0x8,%rsp
+  801706:	48 89 fa             	mov    %rdi,%rdx
+  801709:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80170c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801711:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801716:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171b:	be 00 00 00 00       	mov    $0x0,%esi
+  801720:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801726:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801728:	48 85 c0             	test   %rax,%rax
+  80172b:	7f 06                	jg     801733 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80172d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801731:	c9                   	leave
+  801732:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801733:	49 89 c0             	mov    %rax,%r8
+  801736:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80173b:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801742:	00 00 00 
+  801745:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80174a:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801751:	00 00 00 
+  801754:	b8 00 00 00 00       	mov    $0x0,%eax
+  801759:	49 b9 92 42 80 00 00 	movabs $0x804292,%r9
+  801760:	00 00 00 
+  801763:	41 ff d1             	call   *%r9
+
+0000000000801766 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801766:	55                   	push   %rbp
+  801767:	48 89 e5             	mov    %rsp,%rbp
+  80176a:	53                   	push   %rbx
+  80176b:	48 89 fa             	mov    %rdi,%rdx
+  80176e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801771:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801776:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801780:	be 00 00 00 00       	mov    $0x0,%esi
+  801785:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80178b:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80178d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801791:	c9                   	leave
+  801792:	c3                   	ret
+
+0000000000801793 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801793:	55                   	push   %rbp
+  801794:	48 89 e5             	mov    %rsp,%rbp
+  801797:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801798:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80179d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017bc:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c2:	c9                   	leave
+  8017c3:	c3                   	ret
+
+00000000008017c4 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8017c4:	48 85 ff             	test   %rdi,%rdi
+  8017c7:	0f 84 b6 01 00 00    	je     801983 <malloc+0x1bf>
+malloc(size_t size) {
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+  8017d1:	41 56                	push   %r14
+  8017d3:	41 55                	push   %r13
+  8017d5:	41 54                	push   %r12
+  8017d7:	53                   	push   %rbx
+  8017d8:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8017db:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8017e2:	00 00 00 
+  8017e5:	4c 8b 20             	mov    (%rax),%r12
+  8017e8:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  8017ef:	0f 87 94 01 00 00    	ja     801989 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  8017f5:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8017fc:	00 00 00 
+  8017ff:	48 85 c0             	test   %rax,%rax
+  801802:	74 6b                	je     80186f <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801804:	4d 85 e4             	test   %r12,%r12
+  801807:	74 66                	je     80186f <malloc+0xab>
+  801809:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801810:	00 00 00 
+  801813:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801818:	eb 0d                	jmp    801827 <malloc+0x63>
+  80181a:	48 83 c1 01          	add    $0x1,%rcx
+  80181e:	48 83 c2 18          	add    $0x18,%rdx
+  801822:	49 39 cc             	cmp    %rcx,%r12
+  801825:	74 48                	je     80186f <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801827:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80182c:	74 ec                	je     80181a <malloc+0x56>
+  80182e:	48 39 1a             	cmp    %rbx,(%rdx)
+  801831:	72 e7                	jb     80181a <malloc+0x56>
+                real_freep_size--;
+  801833:	48 83 e8 01          	sub    $0x1,%rax
+  801837:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80183e:	00 00 00 
+                freep[i].is_free = false;
+  801841:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801848:	00 00 00 
+  80184b:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80184f:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801853:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801857:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  80185e:	00 
+                freep[i].size = size;
+  80185f:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801863:	48 01 c8             	add    %rcx,%rax
+  801866:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80186a:	e9 0b 01 00 00       	jmp    80197a <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  80186f:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801876:	00 00 00 
+  801879:	48 01 d8             	add    %rbx,%rax
+  80187c:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801882:	76 7c                	jbe    801900 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801884:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  80188b:	00 00 00 
+  80188e:	4c 8b 30             	mov    (%rax),%r14
+  801891:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801898:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  80189b:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8018a2:	00 00 00 
+  8018a5:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8018ac:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8018b3:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8018b9:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8018bd:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  8018c4:	00 00 00 
+  8018c7:	ff d0                	call   *%rax
+  8018c9:	89 c7                	mov    %eax,%edi
+  8018cb:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8018d2:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8018d9:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  8018e0:	00 00 00 
+  8018e3:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  8018e7:	b9 26 00 00 00       	mov    $0x26,%ecx
+  8018ec:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  8018f3:	00 00 00 
+  8018f6:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  8018f8:	85 c0                	test   %eax,%eax
+  8018fa:	0f 88 90 00 00 00    	js     801990 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801900:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801907:	00 00 00 
+  80190a:	48 8b 31             	mov    (%rcx),%rsi
+  80190d:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801914:	00 00 00 
+  801917:	4c 8b 07             	mov    (%rdi),%r8
+  80191a:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80191e:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801925:	00 00 00 
+  801928:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80192c:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801930:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801937:	00 00 00 
+  80193a:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80193e:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801941:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801945:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80194c:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  80194d:	48 89 d8             	mov    %rbx,%rax
+  801950:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801955:	4c 01 c0             	add    %r8,%rax
+  801958:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  80195b:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801962:	48 01 f3             	add    %rsi,%rbx
+  801965:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801968:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  80196d:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801974:	00 00 00 
+  801977:	48 89 d0             	mov    %rdx,%rax
+}
+  80197a:	5b                   	pop    %rbx
+  80197b:	41 5c                	pop    %r12
+  80197d:	41 5d                	pop    %r13
+  80197f:	41 5e                	pop    %r14
+  801981:	5d                   	pop    %rbp
+  801982:	c3                   	ret
+        return NULL;
+  801983:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801988:	c3                   	ret
+        return NULL;
+  801989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198e:	eb ea                	jmp    80197a <malloc+0x1b6>
+            return NULL;
+  801990:	b8 00 00 00 00       	mov    $0x0,%eax
+  801995:	eb e3                	jmp    80197a <malloc+0x1b6>
+
+0000000000801997 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801997:	55                   	push   %rbp
+  801998:	48 89 e5             	mov    %rsp,%rbp
+  80199b:	53                   	push   %rbx
+  80199c:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8019a0:	48 89 fb             	mov    %rdi,%rbx
+  8019a3:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8019a7:	48 89 df             	mov    %rbx,%rdi
+  8019aa:	48 b8 c4 17 80 00 00 	movabs $0x8017c4,%rax
+  8019b1:	00 00 00 
+  8019b4:	ff d0                	call   *%rax
+  8019b6:	48 89 c7             	mov    %rax,%rdi
+  8019b9:	48 89 da             	mov    %rbx,%rdx
+  8019bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c1:	48 b8 d0 0e 80 00 00 	movabs $0x800ed0,%rax
+  8019c8:	00 00 00 
+  8019cb:	ff d0                	call   *%rax
+}
+  8019cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019d1:	c9                   	leave
+  8019d2:	c3                   	ret
+
+00000000008019d3 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  8019d3:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  8019da:	00 00 00 
+  8019dd:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8019e4:	00 00 00 
+  8019e7:	48 3b 02             	cmp    (%rdx),%rax
+  8019ea:	74 4d                	je     801a39 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  8019ec:	48 85 c0             	test   %rax,%rax
+  8019ef:	74 4d                	je     801a3e <get_allocsize+0x6b>
+  8019f1:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8019f8:	00 00 00 
+  8019fb:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801a00:	48 3b 39             	cmp    (%rcx),%rdi
+  801a03:	74 13                	je     801a18 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801a05:	48 83 c2 01          	add    $0x1,%rdx
+  801a09:	48 83 c1 18          	add    $0x18,%rcx
+  801a0d:	48 39 d0             	cmp    %rdx,%rax
+  801a10:	75 ee                	jne    801a00 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a17:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801a18:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a21:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a28:	00 00 00 
+  801a2b:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a31:	75 0b                	jne    801a3e <get_allocsize+0x6b>
+  801a33:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801a38:	c3                   	ret
+        return 0;
+  801a39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a3e:	c3                   	ret
+
+0000000000801a3f <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801a3f:	48 85 ff             	test   %rdi,%rdi
+  801a42:	0f 84 01 01 00 00    	je     801b49 <free+0x10a>
+free(void *ptr) {
+  801a48:	55                   	push   %rbp
+  801a49:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801a4c:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801a53:	00 00 00 
+  801a56:	48 8b 30             	mov    (%rax),%rsi
+  801a59:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801a60:	00 00 00 
+  801a63:	48 39 c6             	cmp    %rax,%rsi
+  801a66:	74 50                	je     801ab8 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801a68:	48 85 f6             	test   %rsi,%rsi
+  801a6b:	74 21                	je     801a8e <free+0x4f>
+  801a6d:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801a74:	00 00 00 
+  801a77:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801a7c:	48 3b 39             	cmp    (%rcx),%rdi
+  801a7f:	74 61                	je     801ae2 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801a81:	48 83 c2 01          	add    $0x1,%rdx
+  801a85:	48 83 c1 18          	add    $0x18,%rcx
+  801a89:	48 39 d6             	cmp    %rdx,%rsi
+  801a8c:	75 ee                	jne    801a7c <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801a8e:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  801a95:	00 00 00 
+  801a98:	be 12 01 00 00       	mov    $0x112,%esi
+  801a9d:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801aa4:	00 00 00 
+  801aa7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aac:	48 b9 92 42 80 00 00 	movabs $0x804292,%rcx
+  801ab3:	00 00 00 
+  801ab6:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801ab8:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801abf:	00 00 00 
+  801ac2:	be 06 01 00 00       	mov    $0x106,%esi
+  801ac7:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801ace:	00 00 00 
+  801ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad6:	48 b9 92 42 80 00 00 	movabs $0x804292,%rcx
+  801add:	00 00 00 
+  801ae0:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801ae2:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801ae6:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801aed:	00 00 00 
+  801af0:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801af6:	75 27                	jne    801b1f <free+0xe0>
+            freep[i].is_free = true;
+  801af8:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801afc:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801b03:	00 00 00 
+  801b06:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801b0d:	00 00 
+            real_freep_size++;
+  801b0f:	48 83 c0 01          	add    $0x1,%rax
+  801b13:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801b1a:	00 00 00 
+}
+  801b1d:	5d                   	pop    %rbp
+  801b1e:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801b1f:	48 ba a8 55 80 00 00 	movabs $0x8055a8,%rdx
+  801b26:	00 00 00 
+  801b29:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801b2e:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801b35:	00 00 00 
+  801b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3d:	48 b9 92 42 80 00 00 	movabs $0x804292,%rcx
+  801b44:	00 00 00 
+  801b47:	ff d1                	call   *%rcx
+  801b49:	c3                   	ret
+
+0000000000801b4a <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801b4a:	55                   	push   %rbp
+  801b4b:	48 89 e5             	mov    %rsp,%rbp
+  801b4e:	41 55                	push   %r13
+  801b50:	41 54                	push   %r12
+  801b52:	53                   	push   %rbx
+  801b53:	48 83 ec 08          	sub    $0x8,%rsp
+  801b57:	48 89 fb             	mov    %rdi,%rbx
+  801b5a:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801b5d:	48 b8 d3 19 80 00 00 	movabs $0x8019d3,%rax
+  801b64:	00 00 00 
+  801b67:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801b69:	49 39 c5             	cmp    %rax,%r13
+  801b6c:	73 0e                	jae    801b7c <realloc+0x32>
+}
+  801b6e:	48 89 d8             	mov    %rbx,%rax
+  801b71:	48 83 c4 08          	add    $0x8,%rsp
+  801b75:	5b                   	pop    %rbx
+  801b76:	41 5c                	pop    %r12
+  801b78:	41 5d                	pop    %r13
+  801b7a:	5d                   	pop    %rbp
+  801b7b:	c3                   	ret
+  801b7c:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801b7f:	4c 89 ef             	mov    %r13,%rdi
+  801b82:	48 b8 c4 17 80 00 00 	movabs $0x8017c4,%rax
+  801b89:	00 00 00 
+  801b8c:	ff d0                	call   *%rax
+  801b8e:	48 89 c7             	mov    %rax,%rdi
+  801b91:	4c 89 e2             	mov    %r12,%rdx
+  801b94:	48 89 de             	mov    %rbx,%rsi
+  801b97:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  801b9e:	00 00 00 
+  801ba1:	ff d0                	call   *%rax
+  801ba3:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801ba6:	48 89 df             	mov    %rbx,%rdi
+  801ba9:	48 b8 3f 1a 80 00 00 	movabs $0x801a3f,%rax
+  801bb0:	00 00 00 
+  801bb3:	ff d0                	call   *%rax
+    return newptr;
+  801bb5:	4c 89 e3             	mov    %r12,%rbx
+  801bb8:	eb b4                	jmp    801b6e <realloc+0x24>
+
+0000000000801bba <strdup>:
+
+char*
+strdup (const char *src) {
+  801bba:	55                   	push   %rbp
+  801bbb:	48 89 e5             	mov    %rsp,%rbp
+  801bbe:	41 54                	push   %r12
+  801bc0:	53                   	push   %rbx
+  801bc1:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801bc4:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  801bcb:	00 00 00 
+  801bce:	ff d0                	call   *%rax
+  801bd0:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801bd4:	4c 89 e7             	mov    %r12,%rdi
+  801bd7:	48 b8 c4 17 80 00 00 	movabs $0x8017c4,%rax
+  801bde:	00 00 00 
+  801be1:	ff d0                	call   *%rax
+  801be3:	48 89 c7             	mov    %rax,%rdi
+  801be6:	4c 89 e2             	mov    %r12,%rdx
+  801be9:	48 89 de             	mov    %rbx,%rsi
+  801bec:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+}
+  801bf8:	5b                   	pop    %rbx
+  801bf9:	41 5c                	pop    %r12
+  801bfb:	5d                   	pop    %rbp
+  801bfc:	c3                   	ret
+
+0000000000801bfd <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801bfd:	55                   	push   %rbp
+  801bfe:	48 89 e5             	mov    %rsp,%rbp
+  801c01:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c02:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c07:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c16:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c1b:	be 00 00 00 00       	mov    $0x0,%esi
+  801c20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c26:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c2c:	c9                   	leave
+  801c2d:	c3                   	ret
+
+0000000000801c2e <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801c2e:	55                   	push   %rbp
+  801c2f:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801c32:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c39:	00 00 00 
+  801c3c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c40:	74 26                	je     801c68 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801c42:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c44:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c48:	89 c0                	mov    %eax,%eax
+  801c4a:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801c4d:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801c54:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801c5b:	00 00 00 
+  801c5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c63:	48 f7 31             	divq   (%rcx)
+}
+  801c66:	5d                   	pop    %rbp
+  801c67:	c3                   	ret
+        freq = get_cpufreq();
+  801c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6d:	48 ba fd 1b 80 00 00 	movabs $0x801bfd,%rdx
+  801c74:	00 00 00 
+  801c77:	ff d2                	call   *%rdx
+  801c79:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c80:	00 00 00 
+  801c83:	eb bd                	jmp    801c42 <get_ticks+0x14>
+
+0000000000801c85 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801c85:	55                   	push   %rbp
+  801c86:	48 89 e5             	mov    %rsp,%rbp
+  801c89:	53                   	push   %rbx
+  801c8a:	48 83 ec 08          	sub    $0x8,%rsp
+  801c8e:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801c91:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c98:	00 00 00 
+  801c9b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c9f:	74 50                	je     801cf1 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801ca1:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801ca3:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ca7:	89 c0                	mov    %eax,%eax
+  801ca9:	48 89 d6             	mov    %rdx,%rsi
+  801cac:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801caf:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801cb6:	00 00 00 
+  801cb9:	48 0f af 18          	imul   (%rax),%rbx
+  801cbd:	48 c1 eb 03          	shr    $0x3,%rbx
+  801cc1:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801cc8:	9b c4 20 
+  801ccb:	48 89 d8             	mov    %rbx,%rax
+  801cce:	48 f7 e2             	mul    %rdx
+  801cd1:	48 89 d1             	mov    %rdx,%rcx
+  801cd4:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801cd8:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801cda:	48 c1 e2 20          	shl    $0x20,%rdx
+  801cde:	89 c0                	mov    %eax,%eax
+  801ce0:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801ce3:	48 29 f2             	sub    %rsi,%rdx
+  801ce6:	48 39 ca             	cmp    %rcx,%rdx
+  801ce9:	72 ed                	jb     801cd8 <sleep+0x53>
+}
+  801ceb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cef:	c9                   	leave
+  801cf0:	c3                   	ret
+        freq = get_cpufreq();
+  801cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf6:	48 ba fd 1b 80 00 00 	movabs $0x801bfd,%rdx
+  801cfd:	00 00 00 
+  801d00:	ff d2                	call   *%rdx
+  801d02:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801d09:	00 00 00 
+  801d0c:	eb 93                	jmp    801ca1 <sleep+0x1c>
+
+0000000000801d0e <poll_kbd>:
+
+int poll_kbd() {
+  801d0e:	55                   	push   %rbp
+  801d0f:	48 89 e5             	mov    %rsp,%rbp
+  801d12:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d13:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d37:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d3d:	c9                   	leave
+  801d3e:	c3                   	ret
+
+0000000000801d3f <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801d3f:	55                   	push   %rbp
+  801d40:	48 89 e5             	mov    %rsp,%rbp
+  801d43:	53                   	push   %rbx
+  801d44:	49 89 fa             	mov    %rdi,%r10
+  801d47:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801d49:	44 89 c6             	mov    %r8d,%esi
+  801d4c:	89 cf                	mov    %ecx,%edi
+  801d4e:	89 d3                	mov    %edx,%ebx
+  801d50:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801d52:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d57:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d5a:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801d5e:	cd 30                	int    $0x30
+  801d60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d64:	c9                   	leave
+  801d65:	c3                   	ret
+
+0000000000801d66 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801d66:	55                   	push   %rbp
+  801d67:	48 89 e5             	mov    %rsp,%rbp
+  801d6a:	41 55                	push   %r13
+  801d6c:	41 54                	push   %r12
+  801d6e:	53                   	push   %rbx
+  801d6f:	48 83 ec 08          	sub    $0x8,%rsp
+  801d73:	49 89 fc             	mov    %rdi,%r12
+  801d76:	48 89 f7             	mov    %rsi,%rdi
+  801d79:	48 89 d3             	mov    %rdx,%rbx
+  801d7c:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  801d7f:	48 85 f6             	test   %rsi,%rsi
+  801d82:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801d89:	00 00 00 
+  801d8c:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  801d90:	be 00 10 00 00       	mov    $0x1000,%esi
+  801d95:	48 85 d2             	test   %rdx,%rdx
+  801d98:	74 03                	je     801d9d <ipc_recv+0x37>
+  801d9a:	48 8b 32             	mov    (%rdx),%rsi
+  801d9d:	48 b8 fd 16 80 00 00 	movabs $0x8016fd,%rax
+  801da4:	00 00 00 
+  801da7:	ff d0                	call   *%rax
+    if (errno) {
+  801da9:	85 c0                	test   %eax,%eax
+  801dab:	74 1c                	je     801dc9 <ipc_recv+0x63>
+        if (from_env_store)
+  801dad:	4d 85 e4             	test   %r12,%r12
+  801db0:	74 08                	je     801dba <ipc_recv+0x54>
+            *from_env_store = 0;
+  801db2:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801db9:	00 
+
+        if (perm_store)
+  801dba:	4d 85 ed             	test   %r13,%r13
+  801dbd:	74 74                	je     801e33 <ipc_recv+0xcd>
+            *perm_store = 0;
+  801dbf:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801dc6:	00 
+  801dc7:	eb 6a                	jmp    801e33 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  801dc9:	4d 85 e4             	test   %r12,%r12
+  801dcc:	74 14                	je     801de2 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  801dce:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801dd5:	00 00 00 
+  801dd8:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  801dde:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  801de2:	48 85 db             	test   %rbx,%rbx
+  801de5:	74 23                	je     801e0a <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801de7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801dee:	00 00 00 
+  801df1:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  801df7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dfc:	85 c9                	test   %ecx,%ecx
+  801dfe:	74 07                	je     801e07 <ipc_recv+0xa1>
+  801e00:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  801e07:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  801e0a:	4d 85 ed             	test   %r13,%r13
+  801e0d:	74 14                	je     801e23 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  801e0f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801e16:	00 00 00 
+  801e19:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  801e1f:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  801e23:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801e2a:	00 00 00 
+  801e2d:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  801e33:	48 83 c4 08          	add    $0x8,%rsp
+  801e37:	5b                   	pop    %rbx
+  801e38:	41 5c                	pop    %r12
+  801e3a:	41 5d                	pop    %r13
+  801e3c:	5d                   	pop    %rbp
+  801e3d:	c3                   	ret
+
+0000000000801e3e <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801e3e:	55                   	push   %rbp
+  801e3f:	48 89 e5             	mov    %rsp,%rbp
+  801e42:	41 55                	push   %r13
+  801e44:	41 54                	push   %r12
+  801e46:	53                   	push   %rbx
+  801e47:	48 83 ec 08          	sub    $0x8,%rsp
+  801e4b:	49 89 fc             	mov    %rdi,%r12
+  801e4e:	48 89 f7             	mov    %rsi,%rdi
+  801e51:	48 89 d3             	mov    %rdx,%rbx
+  801e54:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  801e57:	48 85 f6             	test   %rsi,%rsi
+  801e5a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801e61:	00 00 00 
+  801e64:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  801e68:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e6d:	48 85 d2             	test   %rdx,%rdx
+  801e70:	74 03                	je     801e75 <ipc_try_recv+0x37>
+  801e72:	48 8b 32             	mov    (%rdx),%rsi
+  801e75:	48 b8 66 17 80 00 00 	movabs $0x801766,%rax
+  801e7c:	00 00 00 
+  801e7f:	ff d0                	call   *%rax
+    if (errno) {
+  801e81:	85 c0                	test   %eax,%eax
+  801e83:	75 75                	jne    801efa <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  801e85:	4d 85 e4             	test   %r12,%r12
+  801e88:	74 14                	je     801e9e <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  801e8a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801e91:	00 00 00 
+  801e94:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  801e9a:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  801e9e:	48 85 db             	test   %rbx,%rbx
+  801ea1:	74 23                	je     801ec6 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801ea3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801eaa:	00 00 00 
+  801ead:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  801eb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb8:	85 c9                	test   %ecx,%ecx
+  801eba:	74 07                	je     801ec3 <ipc_try_recv+0x85>
+  801ebc:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  801ec3:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  801ec6:	4d 85 ed             	test   %r13,%r13
+  801ec9:	74 14                	je     801edf <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  801ecb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801ed2:	00 00 00 
+  801ed5:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  801edb:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  801edf:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801ee6:	00 00 00 
+  801ee9:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  801eef:	48 83 c4 08          	add    $0x8,%rsp
+  801ef3:	5b                   	pop    %rbx
+  801ef4:	41 5c                	pop    %r12
+  801ef6:	41 5d                	pop    %r13
+  801ef8:	5d                   	pop    %rbp
+  801ef9:	c3                   	ret
+        if (from_env_store)
+  801efa:	4d 85 e4             	test   %r12,%r12
+  801efd:	74 08                	je     801f07 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  801eff:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801f06:	00 
+        if (perm_store)
+  801f07:	4d 85 ed             	test   %r13,%r13
+  801f0a:	74 e3                	je     801eef <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  801f0c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801f13:	00 
+  801f14:	eb d9                	jmp    801eef <ipc_try_recv+0xb1>
+
+0000000000801f16 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801f16:	55                   	push   %rbp
+  801f17:	48 89 e5             	mov    %rsp,%rbp
+  801f1a:	41 57                	push   %r15
+  801f1c:	41 56                	push   %r14
+  801f1e:	41 55                	push   %r13
+  801f20:	41 54                	push   %r12
+  801f22:	53                   	push   %rbx
+  801f23:	48 83 ec 18          	sub    $0x18,%rsp
+  801f27:	41 89 fd             	mov    %edi,%r13d
+  801f2a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801f2d:	48 89 d3             	mov    %rdx,%rbx
+  801f30:	49 89 cc             	mov    %rcx,%r12
+  801f33:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  801f37:	48 85 d2             	test   %rdx,%rdx
+  801f3a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801f41:	00 00 00 
+  801f44:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  801f48:	49 be d1 16 80 00 00 	movabs $0x8016d1,%r14
+  801f4f:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  801f52:	49 bf c1 12 80 00 00 	movabs $0x8012c1,%r15
+  801f59:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  801f5c:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801f5f:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  801f63:	4c 89 e1             	mov    %r12,%rcx
+  801f66:	48 89 da             	mov    %rbx,%rdx
+  801f69:	44 89 ef             	mov    %r13d,%edi
+  801f6c:	41 ff d6             	call   *%r14
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	74 37                	je     801faa <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  801f73:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801f76:	75 05                	jne    801f7d <ipc_send+0x67>
+        sys_yield();
+  801f78:	41 ff d7             	call   *%r15
+  801f7b:	eb df                	jmp    801f5c <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  801f7d:	89 c1                	mov    %eax,%ecx
+  801f7f:	48 ba 06 56 80 00 00 	movabs $0x805606,%rdx
+  801f86:	00 00 00 
+  801f89:	be 65 00 00 00       	mov    $0x65,%esi
+  801f8e:	48 bf 21 56 80 00 00 	movabs $0x805621,%rdi
+  801f95:	00 00 00 
+  801f98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9d:	49 b8 92 42 80 00 00 	movabs $0x804292,%r8
+  801fa4:	00 00 00 
+  801fa7:	41 ff d0             	call   *%r8
+    }
+}
+  801faa:	48 83 c4 18          	add    $0x18,%rsp
+  801fae:	5b                   	pop    %rbx
+  801faf:	41 5c                	pop    %r12
+  801fb1:	41 5d                	pop    %r13
+  801fb3:	41 5e                	pop    %r14
+  801fb5:	41 5f                	pop    %r15
+  801fb7:	5d                   	pop    %rbp
+  801fb8:	c3                   	ret
+
+0000000000801fb9 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801fbe:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801fc5:	00 00 00 
+  801fc8:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  801fcf:	48 01 ca             	add    %rcx,%rdx
+  801fd2:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  801fd8:	39 fa                	cmp    %edi,%edx
+  801fda:	74 12                	je     801fee <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  801fdc:	48 83 c0 01          	add    $0x1,%rax
+  801fe0:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  801fe6:	75 e0                	jne    801fc8 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fed:	c3                   	ret
+            return envs[i].env_id;
+  801fee:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  801ff5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801ffc:	00 00 00 
+  801fff:	48 01 d0             	add    %rdx,%rax
+  802002:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802008:	c3                   	ret
+
+0000000000802009 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802009:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802010:	ff ff ff 
+  802013:	48 01 f8             	add    %rdi,%rax
+  802016:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80201a:	c3                   	ret
+
+000000000080201b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80201b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802022:	ff ff ff 
+  802025:	48 01 f8             	add    %rdi,%rax
+  802028:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80202c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802032:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802036:	c3                   	ret
+
+0000000000802037 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802037:	55                   	push   %rbp
+  802038:	48 89 e5             	mov    %rsp,%rbp
+  80203b:	41 57                	push   %r15
+  80203d:	41 56                	push   %r14
+  80203f:	41 55                	push   %r13
+  802041:	41 54                	push   %r12
+  802043:	53                   	push   %rbx
+  802044:	48 83 ec 08          	sub    $0x8,%rsp
+  802048:	49 89 ff             	mov    %rdi,%r15
+  80204b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802050:	49 bd eb 3e 80 00 00 	movabs $0x803eeb,%r13
+  802057:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80205a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802060:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802063:	48 89 df             	mov    %rbx,%rdi
+  802066:	41 ff d5             	call   *%r13
+  802069:	83 e0 04             	and    $0x4,%eax
+  80206c:	74 17                	je     802085 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80206e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802075:	4c 39 f3             	cmp    %r14,%rbx
+  802078:	75 e6                	jne    802060 <fd_alloc+0x29>
+  80207a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802080:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802085:	4d 89 27             	mov    %r12,(%r15)
+}
+  802088:	48 83 c4 08          	add    $0x8,%rsp
+  80208c:	5b                   	pop    %rbx
+  80208d:	41 5c                	pop    %r12
+  80208f:	41 5d                	pop    %r13
+  802091:	41 5e                	pop    %r14
+  802093:	41 5f                	pop    %r15
+  802095:	5d                   	pop    %rbp
+  802096:	c3                   	ret
+
+0000000000802097 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802097:	83 ff 1f             	cmp    $0x1f,%edi
+  80209a:	77 39                	ja     8020d5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80209c:	55                   	push   %rbp
+  80209d:	48 89 e5             	mov    %rsp,%rbp
+  8020a0:	41 54                	push   %r12
+  8020a2:	53                   	push   %rbx
+  8020a3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8020a6:	48 63 df             	movslq %edi,%rbx
+  8020a9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8020b0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8020b4:	48 89 df             	mov    %rbx,%rdi
+  8020b7:	48 b8 eb 3e 80 00 00 	movabs $0x803eeb,%rax
+  8020be:	00 00 00 
+  8020c1:	ff d0                	call   *%rax
+  8020c3:	a8 04                	test   $0x4,%al
+  8020c5:	74 14                	je     8020db <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8020c7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8020cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020d0:	5b                   	pop    %rbx
+  8020d1:	41 5c                	pop    %r12
+  8020d3:	5d                   	pop    %rbp
+  8020d4:	c3                   	ret
+        return -E_INVAL;
+  8020d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8020da:	c3                   	ret
+        return -E_INVAL;
+  8020db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020e0:	eb ee                	jmp    8020d0 <fd_lookup+0x39>
+
+00000000008020e2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8020e2:	55                   	push   %rbp
+  8020e3:	48 89 e5             	mov    %rsp,%rbp
+  8020e6:	41 54                	push   %r12
+  8020e8:	53                   	push   %rbx
+  8020e9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8020ec:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  8020f3:	00 00 00 
+  8020f6:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8020fd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802100:	39 3b                	cmp    %edi,(%rbx)
+  802102:	74 47                	je     80214b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802104:	48 83 c0 08          	add    $0x8,%rax
+  802108:	48 8b 18             	mov    (%rax),%rbx
+  80210b:	48 85 db             	test   %rbx,%rbx
+  80210e:	75 f0                	jne    802100 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802110:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802117:	00 00 00 
+  80211a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802120:	89 fa                	mov    %edi,%edx
+  802122:	48 bf 30 56 80 00 00 	movabs $0x805630,%rdi
+  802129:	00 00 00 
+  80212c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802131:	48 b9 78 02 80 00 00 	movabs $0x800278,%rcx
+  802138:	00 00 00 
+  80213b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80213d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802142:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802146:	5b                   	pop    %rbx
+  802147:	41 5c                	pop    %r12
+  802149:	5d                   	pop    %rbp
+  80214a:	c3                   	ret
+            return 0;
+  80214b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802150:	eb f0                	jmp    802142 <dev_lookup+0x60>
+
+0000000000802152 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802152:	55                   	push   %rbp
+  802153:	48 89 e5             	mov    %rsp,%rbp
+  802156:	41 55                	push   %r13
+  802158:	41 54                	push   %r12
+  80215a:	53                   	push   %rbx
+  80215b:	48 83 ec 18          	sub    $0x18,%rsp
+  80215f:	48 89 fb             	mov    %rdi,%rbx
+  802162:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802165:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80216c:	ff ff ff 
+  80216f:	48 01 df             	add    %rbx,%rdi
+  802172:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802176:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80217a:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  802181:	00 00 00 
+  802184:	ff d0                	call   *%rax
+  802186:	41 89 c5             	mov    %eax,%r13d
+  802189:	85 c0                	test   %eax,%eax
+  80218b:	78 06                	js     802193 <fd_close+0x41>
+  80218d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802191:	74 1a                	je     8021ad <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802193:	45 84 e4             	test   %r12b,%r12b
+  802196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80219b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80219f:	44 89 e8             	mov    %r13d,%eax
+  8021a2:	48 83 c4 18          	add    $0x18,%rsp
+  8021a6:	5b                   	pop    %rbx
+  8021a7:	41 5c                	pop    %r12
+  8021a9:	41 5d                	pop    %r13
+  8021ab:	5d                   	pop    %rbp
+  8021ac:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8021ad:	8b 3b                	mov    (%rbx),%edi
+  8021af:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021b3:	48 b8 e2 20 80 00 00 	movabs $0x8020e2,%rax
+  8021ba:	00 00 00 
+  8021bd:	ff d0                	call   *%rax
+  8021bf:	41 89 c5             	mov    %eax,%r13d
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	78 1b                	js     8021e1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8021c6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021ca:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8021ce:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8021d4:	48 85 c0             	test   %rax,%rax
+  8021d7:	74 08                	je     8021e1 <fd_close+0x8f>
+  8021d9:	48 89 df             	mov    %rbx,%rdi
+  8021dc:	ff d0                	call   *%rax
+  8021de:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8021e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021e6:	48 89 de             	mov    %rbx,%rsi
+  8021e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021ee:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  8021f5:	00 00 00 
+  8021f8:	ff d0                	call   *%rax
+    return res;
+  8021fa:	eb a3                	jmp    80219f <fd_close+0x4d>
+
+00000000008021fc <close>:
+
+int
+close(int fdnum) {
+  8021fc:	55                   	push   %rbp
+  8021fd:	48 89 e5             	mov    %rsp,%rbp
+  802200:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802204:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802208:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  80220f:	00 00 00 
+  802212:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802214:	85 c0                	test   %eax,%eax
+  802216:	78 15                	js     80222d <close+0x31>
+
+    return fd_close(fd, 1);
+  802218:	be 01 00 00 00       	mov    $0x1,%esi
+  80221d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802221:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  802228:	00 00 00 
+  80222b:	ff d0                	call   *%rax
+}
+  80222d:	c9                   	leave
+  80222e:	c3                   	ret
+
+000000000080222f <close_all>:
+
+void
+close_all(void) {
+  80222f:	55                   	push   %rbp
+  802230:	48 89 e5             	mov    %rsp,%rbp
+  802233:	41 54                	push   %r12
+  802235:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802236:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80223b:	49 bc fc 21 80 00 00 	movabs $0x8021fc,%r12
+  802242:	00 00 00 
+  802245:	89 df                	mov    %ebx,%edi
+  802247:	41 ff d4             	call   *%r12
+  80224a:	83 c3 01             	add    $0x1,%ebx
+  80224d:	83 fb 20             	cmp    $0x20,%ebx
+  802250:	75 f3                	jne    802245 <close_all+0x16>
+}
+  802252:	5b                   	pop    %rbx
+  802253:	41 5c                	pop    %r12
+  802255:	5d                   	pop    %rbp
+  802256:	c3                   	ret
+
+0000000000802257 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802257:	55                   	push   %rbp
+  802258:	48 89 e5             	mov    %rsp,%rbp
+  80225b:	41 57                	push   %r15
+  80225d:	41 56                	push   %r14
+  80225f:	41 55                	push   %r13
+  802261:	41 54                	push   %r12
+  802263:	53                   	push   %rbx
+  802264:	48 83 ec 18          	sub    $0x18,%rsp
+  802268:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80226b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80226f:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  802276:	00 00 00 
+  802279:	ff d0                	call   *%rax
+  80227b:	89 c3                	mov    %eax,%ebx
+  80227d:	85 c0                	test   %eax,%eax
+  80227f:	0f 88 b8 00 00 00    	js     80233d <dup+0xe6>
+    close(newfdnum);
+  802285:	44 89 e7             	mov    %r12d,%edi
+  802288:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  80228f:	00 00 00 
+  802292:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802294:	4d 63 ec             	movslq %r12d,%r13
+  802297:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80229e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8022a2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8022a6:	4c 89 ff             	mov    %r15,%rdi
+  8022a9:	49 be 1b 20 80 00 00 	movabs $0x80201b,%r14
+  8022b0:	00 00 00 
+  8022b3:	41 ff d6             	call   *%r14
+  8022b6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8022b9:	4c 89 ef             	mov    %r13,%rdi
+  8022bc:	41 ff d6             	call   *%r14
+  8022bf:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8022c2:	48 89 df             	mov    %rbx,%rdi
+  8022c5:	48 b8 eb 3e 80 00 00 	movabs $0x803eeb,%rax
+  8022cc:	00 00 00 
+  8022cf:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8022d1:	a8 04                	test   $0x4,%al
+  8022d3:	74 2b                	je     802300 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8022d5:	41 89 c1             	mov    %eax,%r9d
+  8022d8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8022de:	4c 89 f1             	mov    %r14,%rcx
+  8022e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e6:	48 89 de             	mov    %rbx,%rsi
+  8022e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ee:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  8022f5:	00 00 00 
+  8022f8:	ff d0                	call   *%rax
+  8022fa:	89 c3                	mov    %eax,%ebx
+  8022fc:	85 c0                	test   %eax,%eax
+  8022fe:	78 4e                	js     80234e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802300:	4c 89 ff             	mov    %r15,%rdi
+  802303:	48 b8 eb 3e 80 00 00 	movabs $0x803eeb,%rax
+  80230a:	00 00 00 
+  80230d:	ff d0                	call   *%rax
+  80230f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802312:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802318:	4c 89 e9             	mov    %r13,%rcx
+  80231b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802320:	4c 89 fe             	mov    %r15,%rsi
+  802323:	bf 00 00 00 00       	mov    $0x0,%edi
+  802328:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  80232f:	00 00 00 
+  802332:	ff d0                	call   *%rax
+  802334:	89 c3                	mov    %eax,%ebx
+  802336:	85 c0                	test   %eax,%eax
+  802338:	78 14                	js     80234e <dup+0xf7>
+
+    return newfdnum;
+  80233a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80233d:	89 d8                	mov    %ebx,%eax
+  80233f:	48 83 c4 18          	add    $0x18,%rsp
+  802343:	5b                   	pop    %rbx
+  802344:	41 5c                	pop    %r12
+  802346:	41 5d                	pop    %r13
+  802348:	41 5e                	pop    %r14
+  80234a:	41 5f                	pop    %r15
+  80234c:	5d                   	pop    %rbp
+  80234d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80234e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802353:	4c 89 ee             	mov    %r13,%rsi
+  802356:	bf 00 00 00 00       	mov    $0x0,%edi
+  80235b:	49 bc 2f 15 80 00 00 	movabs $0x80152f,%r12
+  802362:	00 00 00 
+  802365:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802368:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80236d:	4c 89 f6             	mov    %r14,%rsi
+  802370:	bf 00 00 00 00       	mov    $0x0,%edi
+  802375:	41 ff d4             	call   *%r12
+    return res;
+  802378:	eb c3                	jmp    80233d <dup+0xe6>
+
+000000000080237a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80237a:	55                   	push   %rbp
+  80237b:	48 89 e5             	mov    %rsp,%rbp
+  80237e:	41 56                	push   %r14
+  802380:	41 55                	push   %r13
+  802382:	41 54                	push   %r12
+  802384:	53                   	push   %rbx
+  802385:	48 83 ec 10          	sub    $0x10,%rsp
+  802389:	89 fb                	mov    %edi,%ebx
+  80238b:	49 89 f4             	mov    %rsi,%r12
+  80238e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802391:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802395:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  80239c:	00 00 00 
+  80239f:	ff d0                	call   *%rax
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	78 4c                	js     8023f1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023a5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8023a9:	41 8b 3e             	mov    (%r14),%edi
+  8023ac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023b0:	48 b8 e2 20 80 00 00 	movabs $0x8020e2,%rax
+  8023b7:	00 00 00 
+  8023ba:	ff d0                	call   *%rax
+  8023bc:	85 c0                	test   %eax,%eax
+  8023be:	78 35                	js     8023f5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8023c0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8023c4:	83 e0 03             	and    $0x3,%eax
+  8023c7:	83 f8 01             	cmp    $0x1,%eax
+  8023ca:	74 2d                	je     8023f9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8023cc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023d0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8023d4:	48 85 c0             	test   %rax,%rax
+  8023d7:	74 56                	je     80242f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8023d9:	4c 89 ea             	mov    %r13,%rdx
+  8023dc:	4c 89 e6             	mov    %r12,%rsi
+  8023df:	4c 89 f7             	mov    %r14,%rdi
+  8023e2:	ff d0                	call   *%rax
+}
+  8023e4:	48 83 c4 10          	add    $0x10,%rsp
+  8023e8:	5b                   	pop    %rbx
+  8023e9:	41 5c                	pop    %r12
+  8023eb:	41 5d                	pop    %r13
+  8023ed:	41 5e                	pop    %r14
+  8023ef:	5d                   	pop    %rbp
+  8023f0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023f1:	48 98                	cltq
+  8023f3:	eb ef                	jmp    8023e4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023f5:	48 98                	cltq
+  8023f7:	eb eb                	jmp    8023e4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023f9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802400:	00 00 00 
+  802403:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802409:	89 da                	mov    %ebx,%edx
+  80240b:	48 bf 71 56 80 00 00 	movabs $0x805671,%rdi
+  802412:	00 00 00 
+  802415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241a:	48 b9 78 02 80 00 00 	movabs $0x800278,%rcx
+  802421:	00 00 00 
+  802424:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802426:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80242d:	eb b5                	jmp    8023e4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80242f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802436:	eb ac                	jmp    8023e4 <read+0x6a>
+
+0000000000802438 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802438:	55                   	push   %rbp
+  802439:	48 89 e5             	mov    %rsp,%rbp
+  80243c:	41 57                	push   %r15
+  80243e:	41 56                	push   %r14
+  802440:	41 55                	push   %r13
+  802442:	41 54                	push   %r12
+  802444:	53                   	push   %rbx
+  802445:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802449:	48 85 d2             	test   %rdx,%rdx
+  80244c:	74 54                	je     8024a2 <readn+0x6a>
+  80244e:	41 89 fd             	mov    %edi,%r13d
+  802451:	49 89 f6             	mov    %rsi,%r14
+  802454:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802457:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80245c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802461:	49 bf 7a 23 80 00 00 	movabs $0x80237a,%r15
+  802468:	00 00 00 
+  80246b:	4c 89 e2             	mov    %r12,%rdx
+  80246e:	48 29 f2             	sub    %rsi,%rdx
+  802471:	4c 01 f6             	add    %r14,%rsi
+  802474:	44 89 ef             	mov    %r13d,%edi
+  802477:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80247a:	85 c0                	test   %eax,%eax
+  80247c:	78 20                	js     80249e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80247e:	01 c3                	add    %eax,%ebx
+  802480:	85 c0                	test   %eax,%eax
+  802482:	74 08                	je     80248c <readn+0x54>
+  802484:	48 63 f3             	movslq %ebx,%rsi
+  802487:	4c 39 e6             	cmp    %r12,%rsi
+  80248a:	72 df                	jb     80246b <readn+0x33>
+    }
+    return res;
+  80248c:	48 63 c3             	movslq %ebx,%rax
+}
+  80248f:	48 83 c4 08          	add    $0x8,%rsp
+  802493:	5b                   	pop    %rbx
+  802494:	41 5c                	pop    %r12
+  802496:	41 5d                	pop    %r13
+  802498:	41 5e                	pop    %r14
+  80249a:	41 5f                	pop    %r15
+  80249c:	5d                   	pop    %rbp
+  80249d:	c3                   	ret
+        if (inc < 0) return inc;
+  80249e:	48 98                	cltq
+  8024a0:	eb ed                	jmp    80248f <readn+0x57>
+    int inc = 1, res = 0;
+  8024a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024a7:	eb e3                	jmp    80248c <readn+0x54>
+
+00000000008024a9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8024a9:	55                   	push   %rbp
+  8024aa:	48 89 e5             	mov    %rsp,%rbp
+  8024ad:	41 56                	push   %r14
+  8024af:	41 55                	push   %r13
+  8024b1:	41 54                	push   %r12
+  8024b3:	53                   	push   %rbx
+  8024b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8024b8:	89 fb                	mov    %edi,%ebx
+  8024ba:	49 89 f4             	mov    %rsi,%r12
+  8024bd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024c0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024c4:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  8024cb:	00 00 00 
+  8024ce:	ff d0                	call   *%rax
+  8024d0:	85 c0                	test   %eax,%eax
+  8024d2:	78 47                	js     80251b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024d4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8024d8:	41 8b 3e             	mov    (%r14),%edi
+  8024db:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024df:	48 b8 e2 20 80 00 00 	movabs $0x8020e2,%rax
+  8024e6:	00 00 00 
+  8024e9:	ff d0                	call   *%rax
+  8024eb:	85 c0                	test   %eax,%eax
+  8024ed:	78 30                	js     80251f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024ef:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8024f4:	74 2d                	je     802523 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8024f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024fa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8024fe:	48 85 c0             	test   %rax,%rax
+  802501:	74 56                	je     802559 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802503:	4c 89 ea             	mov    %r13,%rdx
+  802506:	4c 89 e6             	mov    %r12,%rsi
+  802509:	4c 89 f7             	mov    %r14,%rdi
+  80250c:	ff d0                	call   *%rax
+}
+  80250e:	48 83 c4 10          	add    $0x10,%rsp
+  802512:	5b                   	pop    %rbx
+  802513:	41 5c                	pop    %r12
+  802515:	41 5d                	pop    %r13
+  802517:	41 5e                	pop    %r14
+  802519:	5d                   	pop    %rbp
+  80251a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80251b:	48 98                	cltq
+  80251d:	eb ef                	jmp    80250e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80251f:	48 98                	cltq
+  802521:	eb eb                	jmp    80250e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802523:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80252a:	00 00 00 
+  80252d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802533:	89 da                	mov    %ebx,%edx
+  802535:	48 bf 8d 56 80 00 00 	movabs $0x80568d,%rdi
+  80253c:	00 00 00 
+  80253f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802544:	48 b9 78 02 80 00 00 	movabs $0x800278,%rcx
+  80254b:	00 00 00 
+  80254e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802550:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802557:	eb b5                	jmp    80250e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802559:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802560:	eb ac                	jmp    80250e <write+0x65>
+
+0000000000802562 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802562:	55                   	push   %rbp
+  802563:	48 89 e5             	mov    %rsp,%rbp
+  802566:	53                   	push   %rbx
+  802567:	48 83 ec 18          	sub    $0x18,%rsp
+  80256b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80256d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802571:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  802578:	00 00 00 
+  80257b:	ff d0                	call   *%rax
+  80257d:	85 c0                	test   %eax,%eax
+  80257f:	78 0c                	js     80258d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802581:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802585:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802588:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80258d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802591:	c9                   	leave
+  802592:	c3                   	ret
+
+0000000000802593 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802593:	55                   	push   %rbp
+  802594:	48 89 e5             	mov    %rsp,%rbp
+  802597:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80259b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80259f:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  8025a6:	00 00 00 
+  8025a9:	ff d0                	call   *%rax
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	78 07                	js     8025b6 <tell+0x23>
+    return fdes->fd_offset;
+  8025af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b3:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8025b6:	c9                   	leave
+  8025b7:	c3                   	ret
+
+00000000008025b8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8025b8:	55                   	push   %rbp
+  8025b9:	48 89 e5             	mov    %rsp,%rbp
+  8025bc:	41 55                	push   %r13
+  8025be:	41 54                	push   %r12
+  8025c0:	53                   	push   %rbx
+  8025c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8025c5:	89 fb                	mov    %edi,%ebx
+  8025c7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025ca:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025ce:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+  8025da:	85 c0                	test   %eax,%eax
+  8025dc:	78 38                	js     802616 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025de:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8025e2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8025e6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025ea:	48 b8 e2 20 80 00 00 	movabs $0x8020e2,%rax
+  8025f1:	00 00 00 
+  8025f4:	ff d0                	call   *%rax
+  8025f6:	85 c0                	test   %eax,%eax
+  8025f8:	78 1c                	js     802616 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025fa:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8025ff:	74 20                	je     802621 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802601:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802605:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802609:	48 85 c0             	test   %rax,%rax
+  80260c:	74 47                	je     802655 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80260e:	44 89 e6             	mov    %r12d,%esi
+  802611:	4c 89 ef             	mov    %r13,%rdi
+  802614:	ff d0                	call   *%rax
+}
+  802616:	48 83 c4 18          	add    $0x18,%rsp
+  80261a:	5b                   	pop    %rbx
+  80261b:	41 5c                	pop    %r12
+  80261d:	41 5d                	pop    %r13
+  80261f:	5d                   	pop    %rbp
+  802620:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802621:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802628:	00 00 00 
+  80262b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802631:	89 da                	mov    %ebx,%edx
+  802633:	48 bf 50 56 80 00 00 	movabs $0x805650,%rdi
+  80263a:	00 00 00 
+  80263d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802642:	48 b9 78 02 80 00 00 	movabs $0x800278,%rcx
+  802649:	00 00 00 
+  80264c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80264e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802653:	eb c1                	jmp    802616 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802655:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80265a:	eb ba                	jmp    802616 <ftruncate+0x5e>
+
+000000000080265c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80265c:	55                   	push   %rbp
+  80265d:	48 89 e5             	mov    %rsp,%rbp
+  802660:	41 54                	push   %r12
+  802662:	53                   	push   %rbx
+  802663:	48 83 ec 10          	sub    $0x10,%rsp
+  802667:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80266a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80266e:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+  80267a:	85 c0                	test   %eax,%eax
+  80267c:	78 4e                	js     8026cc <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80267e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802682:	41 8b 3c 24          	mov    (%r12),%edi
+  802686:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80268a:	48 b8 e2 20 80 00 00 	movabs $0x8020e2,%rax
+  802691:	00 00 00 
+  802694:	ff d0                	call   *%rax
+  802696:	85 c0                	test   %eax,%eax
+  802698:	78 32                	js     8026cc <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80269a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80269e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8026a3:	74 30                	je     8026d5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8026a5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8026a8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8026af:	00 00 00 
+    stat->st_isdir = 0;
+  8026b2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8026b9:	00 00 00 
+    stat->st_dev = dev;
+  8026bc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8026c3:	48 89 de             	mov    %rbx,%rsi
+  8026c6:	4c 89 e7             	mov    %r12,%rdi
+  8026c9:	ff 50 28             	call   *0x28(%rax)
+}
+  8026cc:	48 83 c4 10          	add    $0x10,%rsp
+  8026d0:	5b                   	pop    %rbx
+  8026d1:	41 5c                	pop    %r12
+  8026d3:	5d                   	pop    %rbp
+  8026d4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8026d5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8026da:	eb f0                	jmp    8026cc <fstat+0x70>
+
+00000000008026dc <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8026dc:	55                   	push   %rbp
+  8026dd:	48 89 e5             	mov    %rsp,%rbp
+  8026e0:	41 54                	push   %r12
+  8026e2:	53                   	push   %rbx
+  8026e3:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8026ea:	41 89 fc             	mov    %edi,%r12d
+  8026ed:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026ef:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026f3:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  8026fa:	00 00 00 
+  8026fd:	ff d0                	call   *%rax
+  8026ff:	85 c0                	test   %eax,%eax
+  802701:	78 31                	js     802734 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802703:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80270a:	44 89 e7             	mov    %r12d,%edi
+  80270d:	48 b8 5c 26 80 00 00 	movabs $0x80265c,%rax
+  802714:	00 00 00 
+  802717:	ff d0                	call   *%rax
+  802719:	85 c0                	test   %eax,%eax
+  80271b:	78 17                	js     802734 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  80271d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802721:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802724:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802727:	39 d3                	cmp    %edx,%ebx
+  802729:	0f 4f da             	cmovg  %edx,%ebx
+  80272c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80272f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802734:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  80273b:	5b                   	pop    %rbx
+  80273c:	41 5c                	pop    %r12
+  80273e:	5d                   	pop    %rbp
+  80273f:	c3                   	ret
+
+0000000000802740 <seektoend>:
+{
+  802740:	55                   	push   %rbp
+  802741:	48 89 e5             	mov    %rsp,%rbp
+  802744:	53                   	push   %rbx
+  802745:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80274c:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80274e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802752:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  802759:	00 00 00 
+  80275c:	ff d0                	call   *%rax
+  80275e:	85 c0                	test   %eax,%eax
+  802760:	78 28                	js     80278a <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802762:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802769:	89 df                	mov    %ebx,%edi
+  80276b:	48 b8 5c 26 80 00 00 	movabs $0x80265c,%rax
+  802772:	00 00 00 
+  802775:	ff d0                	call   *%rax
+  802777:	85 c0                	test   %eax,%eax
+  802779:	78 0f                	js     80278a <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80277b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80277e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802782:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802785:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80278a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80278e:	c9                   	leave
+  80278f:	c3                   	ret
+
+0000000000802790 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802790:	55                   	push   %rbp
+  802791:	48 89 e5             	mov    %rsp,%rbp
+  802794:	41 54                	push   %r12
+  802796:	53                   	push   %rbx
+  802797:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80279a:	be 00 00 00 00       	mov    $0x0,%esi
+  80279f:	48 b8 83 33 80 00 00 	movabs $0x803383,%rax
+  8027a6:	00 00 00 
+  8027a9:	ff d0                	call   *%rax
+  8027ab:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8027ad:	85 c0                	test   %eax,%eax
+  8027af:	78 25                	js     8027d6 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8027b1:	4c 89 e6             	mov    %r12,%rsi
+  8027b4:	89 c7                	mov    %eax,%edi
+  8027b6:	48 b8 5c 26 80 00 00 	movabs $0x80265c,%rax
+  8027bd:	00 00 00 
+  8027c0:	ff d0                	call   *%rax
+  8027c2:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8027c5:	89 df                	mov    %ebx,%edi
+  8027c7:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  8027ce:	00 00 00 
+  8027d1:	ff d0                	call   *%rax
+
+    return res;
+  8027d3:	44 89 e3             	mov    %r12d,%ebx
+}
+  8027d6:	89 d8                	mov    %ebx,%eax
+  8027d8:	5b                   	pop    %rbx
+  8027d9:	41 5c                	pop    %r12
+  8027db:	5d                   	pop    %rbp
+  8027dc:	c3                   	ret
+
+00000000008027dd <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8027dd:	55                   	push   %rbp
+  8027de:	48 89 e5             	mov    %rsp,%rbp
+  8027e1:	53                   	push   %rbx
+  8027e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e6:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8027e9:	48 b8 09 20 80 00 00 	movabs $0x802009,%rax
+  8027f0:	00 00 00 
+  8027f3:	ff d0                	call   *%rax
+  8027f5:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8027f9:	0f 87 ea 00 00 00    	ja     8028e9 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8027ff:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802806:	00 00 00 
+  802809:	80 38 00             	cmpb   $0x0,(%rax)
+  80280c:	75 35                	jne    802843 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  80280e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802813:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802818:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  80281d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802822:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  802829:	00 00 00 
+  80282c:	ff d0                	call   *%rax
+  80282e:	85 c0                	test   %eax,%eax
+  802830:	0f 88 ba 00 00 00    	js     8028f0 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802836:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80283d:	00 00 00 
+  802840:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802843:	48 89 df             	mov    %rbx,%rdi
+  802846:	48 b8 09 20 80 00 00 	movabs $0x802009,%rax
+  80284d:	00 00 00 
+  802850:	ff d0                	call   *%rax
+  802852:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802856:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80285d:	00 00 00 
+  802860:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802864:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802867:	39 39                	cmp    %edi,(%rcx)
+  802869:	74 46                	je     8028b1 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80286b:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80286f:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802876:	00 
+  802877:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80287e:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802885:	00 
+  802886:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80288d:	00 
+  80288e:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802895:	00 
+  802896:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80289d:	00 
+  80289e:	89 39                	mov    %edi,(%rcx)
+  8028a0:	48 01 c6             	add    %rax,%rsi
+  8028a3:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8028a8:	48 89 c8             	mov    %rcx,%rax
+  8028ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028af:	c9                   	leave
+  8028b0:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  8028b1:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8028b5:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  8028bc:	00 00 00 
+  8028bf:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8028c2:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  8028c6:	74 e0                	je     8028a8 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  8028c8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8028cf:	00 
+  8028d0:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8028d4:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8028db:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8028dd:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8028e0:	48 01 c2             	add    %rax,%rdx
+  8028e3:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8028e7:	eb bf                	jmp    8028a8 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8028e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ee:	eb b8                	jmp    8028a8 <fbuf_get+0xcb>
+            return NULL;
+  8028f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028f5:	eb b1                	jmp    8028a8 <fbuf_get+0xcb>
+
+00000000008028f7 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8028f7:	55                   	push   %rbp
+  8028f8:	48 89 e5             	mov    %rsp,%rbp
+  8028fb:	53                   	push   %rbx
+  8028fc:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802900:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802907:	00 00 00 
+  80290a:	48 8b 18             	mov    (%rax),%rbx
+  80290d:	48 85 db             	test   %rbx,%rbx
+  802910:	74 16                	je     802928 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802912:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802919:	00 00 00 
+  80291c:	48 8b 18             	mov    (%rax),%rbx
+}
+  80291f:	48 89 d8             	mov    %rbx,%rax
+  802922:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802926:	c9                   	leave
+  802927:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802928:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80292d:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802932:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802937:	bf 00 00 00 00       	mov    $0x0,%edi
+  80293c:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  802943:	00 00 00 
+  802946:	ff d0                	call   *%rax
+  802948:	85 c0                	test   %eax,%eax
+  80294a:	78 d3                	js     80291f <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  80294c:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802951:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802958:	00 00 00 
+  80295b:	eb b5                	jmp    802912 <fsipc_bulk+0x1b>
+
+000000000080295d <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80295d:	55                   	push   %rbp
+  80295e:	48 89 e5             	mov    %rsp,%rbp
+  802961:	41 57                	push   %r15
+  802963:	41 56                	push   %r14
+  802965:	41 55                	push   %r13
+  802967:	41 54                	push   %r12
+  802969:	53                   	push   %rbx
+  80296a:	48 83 ec 08          	sub    $0x8,%rsp
+  80296e:	41 89 fd             	mov    %edi,%r13d
+  802971:	49 89 f6             	mov    %rsi,%r14
+  802974:	49 89 d7             	mov    %rdx,%r15
+  802977:	48 89 cb             	mov    %rcx,%rbx
+  80297a:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80297d:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802984:	00 00 00 
+  802987:	83 38 00             	cmpl   $0x0,(%rax)
+  80298a:	74 52                	je     8029de <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80298c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802992:	4c 89 f9             	mov    %r15,%rcx
+  802995:	4c 89 f2             	mov    %r14,%rdx
+  802998:	44 89 ee             	mov    %r13d,%esi
+  80299b:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8029a2:	00 00 00 
+  8029a5:	8b 38                	mov    (%rax),%edi
+  8029a7:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  8029b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029b8:	4c 89 e2             	mov    %r12,%rdx
+  8029bb:	48 89 de             	mov    %rbx,%rsi
+  8029be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029c3:	48 b8 66 1d 80 00 00 	movabs $0x801d66,%rax
+  8029ca:	00 00 00 
+  8029cd:	ff d0                	call   *%rax
+}
+  8029cf:	48 83 c4 08          	add    $0x8,%rsp
+  8029d3:	5b                   	pop    %rbx
+  8029d4:	41 5c                	pop    %r12
+  8029d6:	41 5d                	pop    %r13
+  8029d8:	41 5e                	pop    %r14
+  8029da:	41 5f                	pop    %r15
+  8029dc:	5d                   	pop    %rbp
+  8029dd:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029de:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029e3:	48 b8 b9 1f 80 00 00 	movabs $0x801fb9,%rax
+  8029ea:	00 00 00 
+  8029ed:	ff d0                	call   *%rax
+  8029ef:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8029f6:	00 00 
+  8029f8:	eb 92                	jmp    80298c <fsipc_region+0x2f>
+
+00000000008029fa <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8029fa:	55                   	push   %rbp
+  8029fb:	48 89 e5             	mov    %rsp,%rbp
+  8029fe:	41 57                	push   %r15
+  802a00:	41 56                	push   %r14
+  802a02:	41 55                	push   %r13
+  802a04:	41 54                	push   %r12
+  802a06:	53                   	push   %rbx
+  802a07:	48 83 ec 28          	sub    $0x28,%rsp
+  802a0b:	49 89 ff             	mov    %rdi,%r15
+  802a0e:	49 89 f6             	mov    %rsi,%r14
+  802a11:	48 89 d3             	mov    %rdx,%rbx
+  802a14:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802a18:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802a1b:	48 b8 f7 28 80 00 00 	movabs $0x8028f7,%rax
+  802a22:	00 00 00 
+  802a25:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802a27:	48 85 c0             	test   %rax,%rax
+  802a2a:	0f 84 cc 00 00 00    	je     802afc <devfile_write_direct+0x102>
+  802a30:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802a33:	48 85 db             	test   %rbx,%rbx
+  802a36:	0f 84 ba 00 00 00    	je     802af6 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802a3c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802a42:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802a49:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802a4d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802a51:	4c 29 e3             	sub    %r12,%rbx
+  802a54:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802a59:	48 39 c3             	cmp    %rax,%rbx
+  802a5c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802a60:	48 89 da             	mov    %rbx,%rdx
+  802a63:	4c 89 f6             	mov    %r14,%rsi
+  802a66:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802a6a:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  802a71:	00 00 00 
+  802a74:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802a76:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a7a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802a7e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802a81:	44 01 e0             	add    %r12d,%eax
+  802a84:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802a88:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802a8c:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802a93:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802a9a:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802aa1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aa7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802aac:	4c 89 ee             	mov    %r13,%rsi
+  802aaf:	bf 04 00 00 00       	mov    $0x4,%edi
+  802ab4:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  802abb:	00 00 00 
+  802abe:	ff d0                	call   *%rax
+        if (res < 0)
+  802ac0:	85 c0                	test   %eax,%eax
+  802ac2:	78 29                	js     802aed <devfile_write_direct+0xf3>
+        if (res == 0)
+  802ac4:	74 2b                	je     802af1 <devfile_write_direct+0xf7>
+        i += res;
+  802ac6:	48 98                	cltq
+  802ac8:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802acb:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802ace:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ad2:	49 39 c4             	cmp    %rax,%r12
+  802ad5:	0f 82 72 ff ff ff    	jb     802a4d <devfile_write_direct+0x53>
+    return i;
+  802adb:	4c 89 e0             	mov    %r12,%rax
+}
+  802ade:	48 83 c4 28          	add    $0x28,%rsp
+  802ae2:	5b                   	pop    %rbx
+  802ae3:	41 5c                	pop    %r12
+  802ae5:	41 5d                	pop    %r13
+  802ae7:	41 5e                	pop    %r14
+  802ae9:	41 5f                	pop    %r15
+  802aeb:	5d                   	pop    %rbp
+  802aec:	c3                   	ret
+            return res;
+  802aed:	48 98                	cltq
+  802aef:	eb ed                	jmp    802ade <devfile_write_direct+0xe4>
+            return i;
+  802af1:	4c 89 e0             	mov    %r12,%rax
+  802af4:	eb e8                	jmp    802ade <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802af6:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802afa:	eb df                	jmp    802adb <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802afc:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802b03:	eb d9                	jmp    802ade <devfile_write_direct+0xe4>
+
+0000000000802b05 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802b05:	55                   	push   %rbp
+  802b06:	48 89 e5             	mov    %rsp,%rbp
+  802b09:	41 56                	push   %r14
+  802b0b:	41 55                	push   %r13
+  802b0d:	41 54                	push   %r12
+  802b0f:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802b10:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802b14:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b1d:	4d 39 ee             	cmp    %r13,%r14
+  802b20:	0f 84 99 00 00 00    	je     802bbf <fbuf_flush+0xba>
+  802b26:	49 89 fc             	mov    %rdi,%r12
+  802b29:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802b2c:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802b2f:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802b33:	48 b8 09 20 80 00 00 	movabs $0x802009,%rax
+  802b3a:	00 00 00 
+  802b3d:	ff d0                	call   *%rax
+  802b3f:	48 89 c2             	mov    %rax,%rdx
+  802b42:	48 c1 e2 04          	shl    $0x4,%rdx
+  802b46:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802b4a:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b4e:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802b53:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802b56:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802b5a:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802b61:	00 
+  802b62:	44 89 f1             	mov    %r14d,%ecx
+  802b65:	4c 89 ea             	mov    %r13,%rdx
+  802b68:	4c 89 e7             	mov    %r12,%rdi
+  802b6b:	48 b8 fa 29 80 00 00 	movabs $0x8029fa,%rax
+  802b72:	00 00 00 
+  802b75:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b77:	48 85 c0             	test   %rax,%rax
+  802b7a:	78 43                	js     802bbf <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802b7c:	4c 39 e8             	cmp    %r13,%rax
+  802b7f:	72 47                	jb     802bc8 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802b81:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802b86:	83 c0 01             	add    $0x1,%eax
+  802b89:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802b8e:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802b91:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802b95:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802b99:	72 0f                	jb     802baa <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802b9b:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802b9f:	48 39 c2             	cmp    %rax,%rdx
+  802ba2:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802ba6:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802baa:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802bb1:	00 
+  802bb2:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802bb9:	00 
+    return 0;
+  802bba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bbf:	5b                   	pop    %rbx
+  802bc0:	41 5c                	pop    %r12
+  802bc2:	41 5d                	pop    %r13
+  802bc4:	41 5e                	pop    %r14
+  802bc6:	5d                   	pop    %rbp
+  802bc7:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802bc8:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802bcd:	eb f0                	jmp    802bbf <fbuf_flush+0xba>
+
+0000000000802bcf <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802bcf:	55                   	push   %rbp
+  802bd0:	48 89 e5             	mov    %rsp,%rbp
+  802bd3:	53                   	push   %rbx
+  802bd4:	48 83 ec 08          	sub    $0x8,%rsp
+  802bd8:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802bdb:	48 b8 dd 27 80 00 00 	movabs $0x8027dd,%rax
+  802be2:	00 00 00 
+  802be5:	ff d0                	call   *%rax
+  802be7:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802bea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bef:	48 85 f6             	test   %rsi,%rsi
+  802bf2:	74 0f                	je     802c03 <devfile_sync+0x34>
+  802bf4:	48 89 df             	mov    %rbx,%rdi
+  802bf7:	48 b8 05 2b 80 00 00 	movabs $0x802b05,%rax
+  802bfe:	00 00 00 
+  802c01:	ff d0                	call   *%rax
+}
+  802c03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c07:	c9                   	leave
+  802c08:	c3                   	ret
+
+0000000000802c09 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802c09:	55                   	push   %rbp
+  802c0a:	48 89 e5             	mov    %rsp,%rbp
+  802c0d:	48 83 ec 10          	sub    $0x10,%rsp
+  802c11:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802c14:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802c1b:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802c1c:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802c20:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c25:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802c2c:	00 00 00 
+  802c2f:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  802c36:	00 00 00 
+  802c39:	ff d0                	call   *%rax
+}
+  802c3b:	c9                   	leave
+  802c3c:	c3                   	ret
+
+0000000000802c3d <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802c3d:	55                   	push   %rbp
+  802c3e:	48 89 e5             	mov    %rsp,%rbp
+  802c41:	41 54                	push   %r12
+  802c43:	53                   	push   %rbx
+  802c44:	48 89 fb             	mov    %rdi,%rbx
+  802c47:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802c4a:	48 b8 cf 2b 80 00 00 	movabs $0x802bcf,%rax
+  802c51:	00 00 00 
+  802c54:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c56:	85 c0                	test   %eax,%eax
+  802c58:	78 63                	js     802cbd <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c5a:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c5d:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802c64:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802c66:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c70:	48 b8 09 2c 80 00 00 	movabs $0x802c09,%rax
+  802c77:	00 00 00 
+  802c7a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c7c:	85 c0                	test   %eax,%eax
+  802c7e:	78 3d                	js     802cbd <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c80:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802c87:	00 00 00 
+  802c8a:	48 89 de             	mov    %rbx,%rsi
+  802c8d:	4c 89 e7             	mov    %r12,%rdi
+  802c90:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  802c97:	00 00 00 
+  802c9a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c9c:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802ca2:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802ca9:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802caa:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802cb0:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802cb7:	00 
+
+    return 0;
+  802cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cbd:	5b                   	pop    %rbx
+  802cbe:	41 5c                	pop    %r12
+  802cc0:	5d                   	pop    %rbp
+  802cc1:	c3                   	ret
+
+0000000000802cc2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802cc2:	55                   	push   %rbp
+  802cc3:	48 89 e5             	mov    %rsp,%rbp
+  802cc6:	41 54                	push   %r12
+  802cc8:	53                   	push   %rbx
+  802cc9:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802ccc:	48 b8 cf 2b 80 00 00 	movabs $0x802bcf,%rax
+  802cd3:	00 00 00 
+  802cd6:	ff d0                	call   *%rax
+  802cd8:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802cdb:	48 89 df             	mov    %rbx,%rdi
+  802cde:	48 b8 09 20 80 00 00 	movabs $0x802009,%rax
+  802ce5:	00 00 00 
+  802ce8:	ff d0                	call   *%rax
+  802cea:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802cee:	76 2e                	jbe    802d1e <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802cf0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802cf3:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802cfa:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802cfc:	be 00 00 00 00       	mov    $0x0,%esi
+  802d01:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802d06:	48 b8 09 2c 80 00 00 	movabs $0x802c09,%rax
+  802d0d:	00 00 00 
+  802d10:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802d12:	45 85 e4             	test   %r12d,%r12d
+  802d15:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802d19:	5b                   	pop    %rbx
+  802d1a:	41 5c                	pop    %r12
+  802d1c:	5d                   	pop    %rbp
+  802d1d:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802d1e:	48 89 df             	mov    %rbx,%rdi
+  802d21:	48 b8 09 20 80 00 00 	movabs $0x802009,%rax
+  802d28:	00 00 00 
+  802d2b:	ff d0                	call   *%rax
+  802d2d:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802d31:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802d38:	00 00 00 
+  802d3b:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802d42:	48 89 df             	mov    %rbx,%rdi
+  802d45:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  802d4c:	00 00 00 
+  802d4f:	ff d0                	call   *%rax
+  802d51:	48 89 c6             	mov    %rax,%rsi
+  802d54:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d59:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d5e:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  802d65:	00 00 00 
+  802d68:	ff d0                	call   *%rax
+  802d6a:	eb 84                	jmp    802cf0 <devfile_flush+0x2e>
+
+0000000000802d6c <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802d6c:	55                   	push   %rbp
+  802d6d:	48 89 e5             	mov    %rsp,%rbp
+  802d70:	41 55                	push   %r13
+  802d72:	41 54                	push   %r12
+  802d74:	53                   	push   %rbx
+  802d75:	48 83 ec 08          	sub    $0x8,%rsp
+  802d79:	48 89 fb             	mov    %rdi,%rbx
+  802d7c:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802d7f:	48 b8 dd 27 80 00 00 	movabs $0x8027dd,%rax
+  802d86:	00 00 00 
+  802d89:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d8b:	48 85 c0             	test   %rax,%rax
+  802d8e:	74 51                	je     802de1 <devfile_trunc+0x75>
+  802d90:	49 89 c4             	mov    %rax,%r12
+  802d93:	48 89 c6             	mov    %rax,%rsi
+  802d96:	48 89 df             	mov    %rbx,%rdi
+  802d99:	48 b8 05 2b 80 00 00 	movabs $0x802b05,%rax
+  802da0:	00 00 00 
+  802da3:	ff d0                	call   *%rax
+  802da5:	85 c0                	test   %eax,%eax
+  802da7:	78 2d                	js     802dd6 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802da9:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802db0:	00 00 00 
+  802db3:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802db6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802db8:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802dbc:	be 00 00 00 00       	mov    $0x0,%esi
+  802dc1:	bf 02 00 00 00       	mov    $0x2,%edi
+  802dc6:	48 b8 09 2c 80 00 00 	movabs $0x802c09,%rax
+  802dcd:	00 00 00 
+  802dd0:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802dd2:	85 c0                	test   %eax,%eax
+  802dd4:	79 3e                	jns    802e14 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802dd6:	48 83 c4 08          	add    $0x8,%rsp
+  802dda:	5b                   	pop    %rbx
+  802ddb:	41 5c                	pop    %r12
+  802ddd:	41 5d                	pop    %r13
+  802ddf:	5d                   	pop    %rbp
+  802de0:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802de1:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802de8:	00 00 00 
+  802deb:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802dee:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802df0:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802df4:	be 00 00 00 00       	mov    $0x0,%esi
+  802df9:	bf 02 00 00 00       	mov    $0x2,%edi
+  802dfe:	48 b8 09 2c 80 00 00 	movabs $0x802c09,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802e0a:	85 c0                	test   %eax,%eax
+  802e0c:	78 c8                	js     802dd6 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802e0e:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e12:	eb c2                	jmp    802dd6 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802e14:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802e17:	8d 51 01             	lea    0x1(%rcx),%edx
+  802e1a:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e1d:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802e22:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802e29:	00 00 
+  802e2b:	eb a9                	jmp    802dd6 <devfile_trunc+0x6a>
+
+0000000000802e2d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802e2d:	55                   	push   %rbp
+  802e2e:	48 89 e5             	mov    %rsp,%rbp
+  802e31:	41 57                	push   %r15
+  802e33:	41 56                	push   %r14
+  802e35:	41 55                	push   %r13
+  802e37:	41 54                	push   %r12
+  802e39:	53                   	push   %rbx
+  802e3a:	48 83 ec 28          	sub    $0x28,%rsp
+  802e3e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802e42:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802e46:	49 89 d7             	mov    %rdx,%r15
+  802e49:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802e4d:	48 b8 dd 27 80 00 00 	movabs $0x8027dd,%rax
+  802e54:	00 00 00 
+  802e57:	ff d0                	call   *%rax
+  802e59:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802e5c:	48 85 c0             	test   %rax,%rax
+  802e5f:	74 31                	je     802e92 <devfile_write+0x65>
+  802e61:	4c 89 f8             	mov    %r15,%rax
+  802e64:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802e6b:	77 25                	ja     802e92 <devfile_write+0x65>
+    size_t i = 0;
+  802e6d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802e73:	48 85 c0             	test   %rax,%rax
+  802e76:	0f 85 64 01 00 00    	jne    802fe0 <devfile_write+0x1b3>
+    size_t i = 0;
+  802e7c:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802e80:	4c 89 f8             	mov    %r15,%rax
+}
+  802e83:	48 83 c4 28          	add    $0x28,%rsp
+  802e87:	5b                   	pop    %rbx
+  802e88:	41 5c                	pop    %r12
+  802e8a:	41 5d                	pop    %r13
+  802e8c:	41 5e                	pop    %r14
+  802e8e:	41 5f                	pop    %r15
+  802e90:	5d                   	pop    %rbp
+  802e91:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e92:	48 85 db             	test   %rbx,%rbx
+  802e95:	74 5b                	je     802ef2 <devfile_write+0xc5>
+  802e97:	48 89 de             	mov    %rbx,%rsi
+  802e9a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e9e:	48 b8 05 2b 80 00 00 	movabs $0x802b05,%rax
+  802ea5:	00 00 00 
+  802ea8:	ff d0                	call   *%rax
+  802eaa:	85 c0                	test   %eax,%eax
+  802eac:	78 40                	js     802eee <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802eae:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802eb2:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802eb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802eb9:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802ebd:	48 b8 fa 29 80 00 00 	movabs $0x8029fa,%rax
+  802ec4:	00 00 00 
+  802ec7:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802ec9:	48 85 c0             	test   %rax,%rax
+  802ecc:	7e b5                	jle    802e83 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802ece:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802ed2:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802ed5:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802ed8:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802edb:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ede:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ee1:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802ee4:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802eeb:	00 
+  802eec:	eb 95                	jmp    802e83 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802eee:	48 98                	cltq
+  802ef0:	eb 91                	jmp    802e83 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802ef2:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802ef6:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802ef9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802efd:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802f01:	48 89 df             	mov    %rbx,%rdi
+  802f04:	48 b8 fa 29 80 00 00 	movabs $0x8029fa,%rax
+  802f0b:	00 00 00 
+  802f0e:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802f10:	48 85 c0             	test   %rax,%rax
+  802f13:	0f 8e 6a ff ff ff    	jle    802e83 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802f19:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802f1c:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f20:	e9 5e ff ff ff       	jmp    802e83 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f25:	48 98                	cltq
+  802f27:	4d 85 ff             	test   %r15,%r15
+  802f2a:	49 0f 45 c7          	cmovne %r15,%rax
+  802f2e:	e9 50 ff ff ff       	jmp    802e83 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f33:	48 89 de             	mov    %rbx,%rsi
+  802f36:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f3a:	48 b8 05 2b 80 00 00 	movabs $0x802b05,%rax
+  802f41:	00 00 00 
+  802f44:	ff d0                	call   *%rax
+  802f46:	85 c0                	test   %eax,%eax
+  802f48:	0f 88 2b 01 00 00    	js     803079 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802f4e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f52:	4c 01 f8             	add    %r15,%rax
+  802f55:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802f59:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f5d:	48 b9 09 20 80 00 00 	movabs $0x802009,%rcx
+  802f64:	00 00 00 
+  802f67:	ff d1                	call   *%rcx
+  802f69:	48 89 c2             	mov    %rax,%rdx
+  802f6c:	48 c1 e2 04          	shl    $0x4,%rdx
+  802f70:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802f74:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f78:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802f7d:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802f80:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802f87:	00 
+  802f88:	4c 89 ea             	mov    %r13,%rdx
+  802f8b:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802f8f:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  802f96:	00 00 00 
+  802f99:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802f9b:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802f9f:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802fa3:	48 39 c2             	cmp    %rax,%rdx
+  802fa6:	0f 84 db 00 00 00    	je     803087 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802fac:	4c 39 e2             	cmp    %r12,%rdx
+  802faf:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802fb3:	4d 01 ec             	add    %r13,%r12
+  802fb6:	49 39 c4             	cmp    %rax,%r12
+  802fb9:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802fbd:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802fc1:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802fc5:	45 01 ee             	add    %r13d,%r14d
+  802fc8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fcc:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802fd0:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802fd3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802fd7:	49 39 c7             	cmp    %rax,%r15
+  802fda:	0f 83 a0 fe ff ff    	jae    802e80 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802fe0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fe4:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802fe8:	8b 43 08             	mov    0x8(%rbx),%eax
+  802feb:	44 39 f0             	cmp    %r14d,%eax
+  802fee:	7f 10                	jg     803000 <devfile_write+0x1d3>
+  802ff0:	48 98                	cltq
+  802ff2:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802ff8:	49 63 d6             	movslq %r14d,%rdx
+  802ffb:	48 39 d0             	cmp    %rdx,%rax
+  802ffe:	7d 2d                	jge    80302d <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803000:	48 89 de             	mov    %rbx,%rsi
+  803003:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803007:	48 b8 05 2b 80 00 00 	movabs $0x802b05,%rax
+  80300e:	00 00 00 
+  803011:	ff d0                	call   *%rax
+  803013:	85 c0                	test   %eax,%eax
+  803015:	0f 88 0a ff ff ff    	js     802f25 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80301b:	44 89 f0             	mov    %r14d,%eax
+  80301e:	66 b8 00 00          	mov    $0x0,%ax
+  803022:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803025:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80302c:	00 
+        size_t off = pos - fb->fb_base;
+  80302d:	45 89 f4             	mov    %r14d,%r12d
+  803030:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803034:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803037:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  80303b:	4d 29 fd             	sub    %r15,%r13
+  80303e:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803043:	4c 29 e0             	sub    %r12,%rax
+  803046:	49 39 c5             	cmp    %rax,%r13
+  803049:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  80304d:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803051:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803055:	48 39 c2             	cmp    %rax,%rdx
+  803058:	0f 84 f0 fe ff ff    	je     802f4e <devfile_write+0x121>
+  80305e:	4c 39 e0             	cmp    %r12,%rax
+  803061:	0f 82 cc fe ff ff    	jb     802f33 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803067:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80306b:	48 39 d0             	cmp    %rdx,%rax
+  80306e:	0f 83 da fe ff ff    	jae    802f4e <devfile_write+0x121>
+  803074:	e9 ba fe ff ff       	jmp    802f33 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803079:	48 98                	cltq
+  80307b:	4d 85 ff             	test   %r15,%r15
+  80307e:	49 0f 45 c7          	cmovne %r15,%rax
+  803082:	e9 fc fd ff ff       	jmp    802e83 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803087:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80308b:	4c 89 e2             	mov    %r12,%rdx
+  80308e:	e9 2a ff ff ff       	jmp    802fbd <devfile_write+0x190>
+
+0000000000803093 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803093:	55                   	push   %rbp
+  803094:	48 89 e5             	mov    %rsp,%rbp
+  803097:	41 57                	push   %r15
+  803099:	41 56                	push   %r14
+  80309b:	41 55                	push   %r13
+  80309d:	41 54                	push   %r12
+  80309f:	53                   	push   %rbx
+  8030a0:	48 83 ec 28          	sub    $0x28,%rsp
+  8030a4:	49 89 ff             	mov    %rdi,%r15
+  8030a7:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8030ab:	48 89 d3             	mov    %rdx,%rbx
+  8030ae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8030b2:	48 b8 dd 27 80 00 00 	movabs $0x8027dd,%rax
+  8030b9:	00 00 00 
+  8030bc:	ff d0                	call   *%rax
+  8030be:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8030c1:	48 85 c0             	test   %rax,%rax
+  8030c4:	74 0d                	je     8030d3 <devfile_read+0x40>
+  8030c6:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8030cd:	0f 86 1a 01 00 00    	jbe    8031ed <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8030d3:	4d 85 e4             	test   %r12,%r12
+  8030d6:	74 1a                	je     8030f2 <devfile_read+0x5f>
+  8030d8:	4c 89 e6             	mov    %r12,%rsi
+  8030db:	4c 89 ff             	mov    %r15,%rdi
+  8030de:	48 b8 05 2b 80 00 00 	movabs $0x802b05,%rax
+  8030e5:	00 00 00 
+  8030e8:	ff d0                	call   *%rax
+  8030ea:	85 c0                	test   %eax,%eax
+  8030ec:	0f 88 e8 00 00 00    	js     8031da <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8030f2:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8030f6:	48 b8 f7 28 80 00 00 	movabs $0x8028f7,%rax
+  8030fd:	00 00 00 
+  803100:	ff d0                	call   *%rax
+  803102:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803105:	48 85 c0             	test   %rax,%rax
+  803108:	0f 84 69 02 00 00    	je     803377 <devfile_read+0x2e4>
+    while (i < n) {
+  80310e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803113:	0f 84 ce 00 00 00    	je     8031e7 <devfile_read+0x154>
+    size_t i = 0;
+  803119:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80311e:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803125:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803129:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80312d:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803131:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803135:	48 29 da             	sub    %rbx,%rdx
+  803138:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80313d:	48 39 c2             	cmp    %rax,%rdx
+  803140:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803144:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803148:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  80314c:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80314f:	01 d8                	add    %ebx,%eax
+  803151:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803155:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803159:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803160:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803167:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80316e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803174:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803179:	4c 89 ee             	mov    %r13,%rsi
+  80317c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803181:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  803188:	00 00 00 
+  80318b:	ff d0                	call   *%rax
+        if (res < 0)
+  80318d:	85 c0                	test   %eax,%eax
+  80318f:	78 4d                	js     8031de <devfile_read+0x14b>
+        if (res == 0)
+  803191:	74 4f                	je     8031e2 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803193:	4c 63 e0             	movslq %eax,%r12
+  803196:	4c 89 e2             	mov    %r12,%rdx
+  803199:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80319d:	4c 89 f7             	mov    %r14,%rdi
+  8031a0:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  8031a7:	00 00 00 
+  8031aa:	ff d0                	call   *%rax
+        i += res;
+  8031ac:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8031af:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8031b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031b6:	48 39 c3             	cmp    %rax,%rbx
+  8031b9:	0f 82 72 ff ff ff    	jb     803131 <devfile_read+0x9e>
+    return i;
+  8031bf:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8031c2:	48 85 c0             	test   %rax,%rax
+  8031c5:	7e 04                	jle    8031cb <devfile_read+0x138>
+  8031c7:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8031cb:	48 83 c4 28          	add    $0x28,%rsp
+  8031cf:	5b                   	pop    %rbx
+  8031d0:	41 5c                	pop    %r12
+  8031d2:	41 5d                	pop    %r13
+  8031d4:	41 5e                	pop    %r14
+  8031d6:	41 5f                	pop    %r15
+  8031d8:	5d                   	pop    %rbp
+  8031d9:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8031da:	48 98                	cltq
+  8031dc:	eb ed                	jmp    8031cb <devfile_read+0x138>
+            return res;
+  8031de:	48 98                	cltq
+  8031e0:	eb e9                	jmp    8031cb <devfile_read+0x138>
+            return i;
+  8031e2:	48 89 d8             	mov    %rbx,%rax
+  8031e5:	eb db                	jmp    8031c2 <devfile_read+0x12f>
+    size_t i = 0;
+  8031e7:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8031eb:	eb d2                	jmp    8031bf <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8031ed:	48 89 c6             	mov    %rax,%rsi
+  8031f0:	4c 89 ff             	mov    %r15,%rdi
+  8031f3:	48 b8 05 2b 80 00 00 	movabs $0x802b05,%rax
+  8031fa:	00 00 00 
+  8031fd:	ff d0                	call   *%rax
+  8031ff:	85 c0                	test   %eax,%eax
+  803201:	78 40                	js     803243 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803203:	4c 89 ff             	mov    %r15,%rdi
+  803206:	48 b8 09 20 80 00 00 	movabs $0x802009,%rax
+  80320d:	00 00 00 
+  803210:	ff d0                	call   *%rax
+  803212:	48 89 c2             	mov    %rax,%rdx
+  803215:	48 c1 e2 04          	shl    $0x4,%rdx
+  803219:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80321d:	48 c1 e0 0c          	shl    $0xc,%rax
+  803221:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803226:	48 01 d0             	add    %rdx,%rax
+  803229:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80322d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803232:	0f 84 33 01 00 00    	je     80336b <devfile_read+0x2d8>
+    size_t i = 0;
+  803238:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80323e:	e9 f5 00 00 00       	jmp    803338 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803243:	48 98                	cltq
+  803245:	eb 84                	jmp    8031cb <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803247:	44 89 e8             	mov    %r13d,%eax
+  80324a:	66 b8 00 00          	mov    $0x0,%ax
+  80324e:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803253:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80325a:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  80325c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803260:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803264:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803266:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80326b:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80326e:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803275:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803276:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80327c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803281:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803286:	bf 03 00 00 00       	mov    $0x3,%edi
+  80328b:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  803292:	00 00 00 
+  803295:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803297:	85 c0                	test   %eax,%eax
+  803299:	0f 88 be 00 00 00    	js     80335d <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80329f:	48 63 d0             	movslq %eax,%rdx
+  8032a2:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8032a7:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8032ac:	44 39 e8             	cmp    %r13d,%eax
+  8032af:	0f 8e ba 00 00 00    	jle    80336f <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8032b5:	49 63 c5             	movslq %r13d,%rax
+  8032b8:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8032bd:	48 29 c3             	sub    %rax,%rbx
+  8032c0:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8032c5:	48 01 c3             	add    %rax,%rbx
+  8032c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032cc:	4c 29 f0             	sub    %r14,%rax
+  8032cf:	48 39 c3             	cmp    %rax,%rbx
+  8032d2:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8032d6:	4c 89 ff             	mov    %r15,%rdi
+  8032d9:	48 b9 09 20 80 00 00 	movabs $0x802009,%rcx
+  8032e0:	00 00 00 
+  8032e3:	ff d1                	call   *%rcx
+  8032e5:	48 89 c2             	mov    %rax,%rdx
+  8032e8:	48 c1 e2 04          	shl    $0x4,%rdx
+  8032ec:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8032f0:	48 c1 e0 0c          	shl    $0xc,%rax
+  8032f4:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8032f9:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8032fc:	44 89 ea             	mov    %r13d,%edx
+  8032ff:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803304:	48 63 d2             	movslq %edx,%rdx
+  803307:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80330e:	00 
+  80330f:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803313:	4c 01 f7             	add    %r14,%rdi
+  803316:	48 89 da             	mov    %rbx,%rdx
+  803319:	48 b9 e5 0f 80 00 00 	movabs $0x800fe5,%rcx
+  803320:	00 00 00 
+  803323:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803325:	41 01 dd             	add    %ebx,%r13d
+  803328:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  80332c:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80332f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803333:	49 39 c6             	cmp    %rax,%r14
+  803336:	73 37                	jae    80336f <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803338:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  80333c:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803341:	44 39 e8             	cmp    %r13d,%eax
+  803344:	0f 8f fd fe ff ff    	jg     803247 <devfile_read+0x1b4>
+  80334a:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80334f:	44 39 e8             	cmp    %r13d,%eax
+  803352:	0f 8f 5d ff ff ff    	jg     8032b5 <devfile_read+0x222>
+  803358:	e9 ea fe ff ff       	jmp    803247 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80335d:	48 98                	cltq
+  80335f:	4d 85 f6             	test   %r14,%r14
+  803362:	49 0f 45 c6          	cmovne %r14,%rax
+  803366:	e9 60 fe ff ff       	jmp    8031cb <devfile_read+0x138>
+    size_t i = 0;
+  80336b:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80336f:	4c 89 f0             	mov    %r14,%rax
+  803372:	e9 54 fe ff ff       	jmp    8031cb <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803377:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80337e:	e9 48 fe ff ff       	jmp    8031cb <devfile_read+0x138>
+
+0000000000803383 <open>:
+open(const char *path, int mode) {
+  803383:	55                   	push   %rbp
+  803384:	48 89 e5             	mov    %rsp,%rbp
+  803387:	41 55                	push   %r13
+  803389:	41 54                	push   %r12
+  80338b:	53                   	push   %rbx
+  80338c:	48 83 ec 18          	sub    $0x18,%rsp
+  803390:	49 89 fc             	mov    %rdi,%r12
+  803393:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803396:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  80339d:	00 00 00 
+  8033a0:	ff d0                	call   *%rax
+  8033a2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8033a8:	0f 87 8a 00 00 00    	ja     803438 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8033ae:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8033b2:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  8033b9:	00 00 00 
+  8033bc:	ff d0                	call   *%rax
+  8033be:	89 c3                	mov    %eax,%ebx
+  8033c0:	85 c0                	test   %eax,%eax
+  8033c2:	78 50                	js     803414 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8033c4:	4c 89 e6             	mov    %r12,%rsi
+  8033c7:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8033ce:	00 00 00 
+  8033d1:	48 89 df             	mov    %rbx,%rdi
+  8033d4:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  8033db:	00 00 00 
+  8033de:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8033e0:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8033e7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8033eb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8033f0:	48 b8 09 2c 80 00 00 	movabs $0x802c09,%rax
+  8033f7:	00 00 00 
+  8033fa:	ff d0                	call   *%rax
+  8033fc:	89 c3                	mov    %eax,%ebx
+  8033fe:	85 c0                	test   %eax,%eax
+  803400:	78 1f                	js     803421 <open+0x9e>
+    return fd2num(fd);
+  803402:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803406:	48 b8 09 20 80 00 00 	movabs $0x802009,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+  803412:	89 c3                	mov    %eax,%ebx
+}
+  803414:	89 d8                	mov    %ebx,%eax
+  803416:	48 83 c4 18          	add    $0x18,%rsp
+  80341a:	5b                   	pop    %rbx
+  80341b:	41 5c                	pop    %r12
+  80341d:	41 5d                	pop    %r13
+  80341f:	5d                   	pop    %rbp
+  803420:	c3                   	ret
+        fd_close(fd, 0);
+  803421:	be 00 00 00 00       	mov    $0x0,%esi
+  803426:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80342a:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  803431:	00 00 00 
+  803434:	ff d0                	call   *%rax
+        return res;
+  803436:	eb dc                	jmp    803414 <open+0x91>
+        return -E_BAD_PATH;
+  803438:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80343d:	eb d5                	jmp    803414 <open+0x91>
+
+000000000080343f <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80343f:	55                   	push   %rbp
+  803440:	48 89 e5             	mov    %rsp,%rbp
+  803443:	41 57                	push   %r15
+  803445:	41 56                	push   %r14
+  803447:	41 55                	push   %r13
+  803449:	41 54                	push   %r12
+  80344b:	53                   	push   %rbx
+  80344c:	48 83 ec 18          	sub    $0x18,%rsp
+  803450:	41 89 f6             	mov    %esi,%r14d
+  803453:	49 89 d7             	mov    %rdx,%r15
+  803456:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803459:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80345d:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  803464:	00 00 00 
+  803467:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803469:	85 c0                	test   %eax,%eax
+  80346b:	0f 88 db 00 00 00    	js     80354c <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803471:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803475:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80347c:	00 00 00 
+  80347f:	8b 00                	mov    (%rax),%eax
+  803481:	39 07                	cmp    %eax,(%rdi)
+  803483:	0f 85 db 00 00 00    	jne    803564 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803489:	45 85 f6             	test   %r14d,%r14d
+  80348c:	0f 88 db 00 00 00    	js     80356d <fmap+0x12e>
+  803492:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803499:	0f 85 d7 00 00 00    	jne    803576 <fmap+0x137>
+  80349f:	4c 89 fb             	mov    %r15,%rbx
+  8034a2:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8034a8:	0f 85 d1 00 00 00    	jne    80357f <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8034ae:	48 b8 cf 2b 80 00 00 	movabs $0x802bcf,%rax
+  8034b5:	00 00 00 
+  8034b8:	ff d0                	call   *%rax
+  8034ba:	85 c0                	test   %eax,%eax
+  8034bc:	0f 88 8e 00 00 00    	js     803550 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8034c2:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8034c9:	00 00 00 
+    while (i < n) {
+  8034cc:	4d 85 ed             	test   %r13,%r13
+  8034cf:	0f 84 8a 00 00 00    	je     80355f <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8034d5:	4c 89 ea             	mov    %r13,%rdx
+  8034d8:	48 29 da             	sub    %rbx,%rdx
+  8034db:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8034e2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8034e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8034ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034f0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034f3:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8034f7:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8034fb:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803500:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803505:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803509:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80350d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803512:	4c 89 e6             	mov    %r12,%rsi
+  803515:	bf 09 00 00 00       	mov    $0x9,%edi
+  80351a:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  803521:	00 00 00 
+  803524:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803526:	85 c0                	test   %eax,%eax
+  803528:	78 2a                	js     803554 <fmap+0x115>
+        i += res;
+  80352a:	48 98                	cltq
+  80352c:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80352f:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803533:	72 05                	jb     80353a <fmap+0xfb>
+    while (i < n) {
+  803535:	4c 39 eb             	cmp    %r13,%rbx
+  803538:	72 9b                	jb     8034d5 <fmap+0x96>
+    }
+    return i;
+  80353a:	48 89 d8             	mov    %rbx,%rax
+}
+  80353d:	48 83 c4 18          	add    $0x18,%rsp
+  803541:	5b                   	pop    %rbx
+  803542:	41 5c                	pop    %r12
+  803544:	41 5d                	pop    %r13
+  803546:	41 5e                	pop    %r14
+  803548:	41 5f                	pop    %r15
+  80354a:	5d                   	pop    %rbp
+  80354b:	c3                   	ret
+    if (res < 0) return res;
+  80354c:	48 98                	cltq
+  80354e:	eb ed                	jmp    80353d <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803550:	48 98                	cltq
+  803552:	eb e9                	jmp    80353d <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803554:	48 98                	cltq
+  803556:	48 85 db             	test   %rbx,%rbx
+  803559:	48 0f 45 c3          	cmovne %rbx,%rax
+  80355d:	eb de                	jmp    80353d <fmap+0xfe>
+    size_t i = 0;
+  80355f:	4c 89 eb             	mov    %r13,%rbx
+  803562:	eb d6                	jmp    80353a <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803564:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80356b:	eb d0                	jmp    80353d <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80356d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803574:	eb c7                	jmp    80353d <fmap+0xfe>
+  803576:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80357d:	eb be                	jmp    80353d <fmap+0xfe>
+  80357f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803586:	eb b5                	jmp    80353d <fmap+0xfe>
+
+0000000000803588 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803588:	55                   	push   %rbp
+  803589:	48 89 e5             	mov    %rsp,%rbp
+  80358c:	41 56                	push   %r14
+  80358e:	41 55                	push   %r13
+  803590:	41 54                	push   %r12
+  803592:	53                   	push   %rbx
+  803593:	48 83 ec 10          	sub    $0x10,%rsp
+  803597:	89 fb                	mov    %edi,%ebx
+  803599:	41 89 f4             	mov    %esi,%r12d
+  80359c:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80359f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035a3:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  8035aa:	00 00 00 
+  8035ad:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035af:	85 c0                	test   %eax,%eax
+  8035b1:	78 63                	js     803616 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8035b3:	45 85 e4             	test   %r12d,%r12d
+  8035b6:	0f 88 80 00 00 00    	js     80363c <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8035bc:	45 89 e6             	mov    %r12d,%r14d
+  8035bf:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8035c6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035ca:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  8035d1:	00 00 00 
+  8035d4:	ff d0                	call   *%rax
+  8035d6:	48 89 c2             	mov    %rax,%rdx
+  8035d9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8035de:	44 89 f6             	mov    %r14d,%esi
+  8035e1:	89 df                	mov    %ebx,%edi
+  8035e3:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  8035ea:	00 00 00 
+  8035ed:	ff d0                	call   *%rax
+  8035ef:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8035f2:	45 29 f4             	sub    %r14d,%r12d
+  8035f5:	4d 63 f4             	movslq %r12d,%r14
+  8035f8:	49 39 c6             	cmp    %rax,%r14
+  8035fb:	7c 1d                	jl     80361a <read_map+0x92>
+  8035fd:	48 85 c0             	test   %rax,%rax
+  803600:	b8 00 00 00 00       	mov    $0x0,%eax
+  803605:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803609:	48 83 c4 10          	add    $0x10,%rsp
+  80360d:	5b                   	pop    %rbx
+  80360e:	41 5c                	pop    %r12
+  803610:	41 5d                	pop    %r13
+  803612:	41 5e                	pop    %r14
+  803614:	5d                   	pop    %rbp
+  803615:	c3                   	ret
+    if (res < 0) return res;
+  803616:	48 98                	cltq
+  803618:	eb ef                	jmp    803609 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  80361a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80361e:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  803625:	00 00 00 
+  803628:	ff d0                	call   *%rax
+  80362a:	4d 63 e4             	movslq %r12d,%r12
+  80362d:	4c 01 e0             	add    %r12,%rax
+  803630:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803634:	48 89 d8             	mov    %rbx,%rax
+  803637:	4c 29 f0             	sub    %r14,%rax
+  80363a:	eb cd                	jmp    803609 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  80363c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803643:	eb c4                	jmp    803609 <read_map+0x81>
+
+0000000000803645 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803645:	55                   	push   %rbp
+  803646:	48 89 e5             	mov    %rsp,%rbp
+  803649:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80364d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803651:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  803658:	00 00 00 
+  80365b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80365d:	85 c0                	test   %eax,%eax
+  80365f:	78 4a                	js     8036ab <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803661:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803665:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80366c:	00 00 00 
+  80366f:	8b 00                	mov    (%rax),%eax
+  803671:	39 07                	cmp    %eax,(%rdi)
+  803673:	75 38                	jne    8036ad <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803675:	48 b8 cf 2b 80 00 00 	movabs $0x802bcf,%rax
+  80367c:	00 00 00 
+  80367f:	ff d0                	call   *%rax
+  803681:	85 c0                	test   %eax,%eax
+  803683:	78 26                	js     8036ab <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803689:	8b 40 0c             	mov    0xc(%rax),%eax
+  80368c:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803693:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803695:	be 00 00 00 00       	mov    $0x0,%esi
+  80369a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80369f:	48 b8 09 2c 80 00 00 	movabs $0x802c09,%rax
+  8036a6:	00 00 00 
+  8036a9:	ff d0                	call   *%rax
+}
+  8036ab:	c9                   	leave
+  8036ac:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8036ad:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8036b2:	eb f7                	jmp    8036ab <fsync+0x66>
+
+00000000008036b4 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8036b4:	55                   	push   %rbp
+  8036b5:	48 89 e5             	mov    %rsp,%rbp
+  8036b8:	41 57                	push   %r15
+  8036ba:	41 56                	push   %r14
+  8036bc:	41 55                	push   %r13
+  8036be:	41 54                	push   %r12
+  8036c0:	53                   	push   %rbx
+  8036c1:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8036c5:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8036cc:	00 00 00 
+  8036cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8036d4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8036da:	49 bd 97 20 80 00 00 	movabs $0x802097,%r13
+  8036e1:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8036e4:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8036eb:	00 00 00 
+  8036ee:	eb 0c                	jmp    8036fc <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8036f0:	83 c3 01             	add    $0x1,%ebx
+  8036f3:	49 83 c4 28          	add    $0x28,%r12
+  8036f7:	83 fb 20             	cmp    $0x20,%ebx
+  8036fa:	74 33                	je     80372f <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8036fc:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803701:	74 ed                	je     8036f0 <flushall+0x3c>
+  803703:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803707:	89 df                	mov    %ebx,%edi
+  803709:	41 ff d5             	call   *%r13
+  80370c:	85 c0                	test   %eax,%eax
+  80370e:	78 e0                	js     8036f0 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803710:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803714:	41 8b 06             	mov    (%r14),%eax
+  803717:	39 07                	cmp    %eax,(%rdi)
+  803719:	75 d5                	jne    8036f0 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  80371b:	48 b8 cf 2b 80 00 00 	movabs $0x802bcf,%rax
+  803722:	00 00 00 
+  803725:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803727:	85 c0                	test   %eax,%eax
+  803729:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80372d:	eb c1                	jmp    8036f0 <flushall+0x3c>
+    }
+    return res;
+}
+  80372f:	44 89 f8             	mov    %r15d,%eax
+  803732:	48 83 c4 18          	add    $0x18,%rsp
+  803736:	5b                   	pop    %rbx
+  803737:	41 5c                	pop    %r12
+  803739:	41 5d                	pop    %r13
+  80373b:	41 5e                	pop    %r14
+  80373d:	41 5f                	pop    %r15
+  80373f:	5d                   	pop    %rbp
+  803740:	c3                   	ret
+
+0000000000803741 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803741:	55                   	push   %rbp
+  803742:	48 89 e5             	mov    %rsp,%rbp
+  803745:	53                   	push   %rbx
+  803746:	48 83 ec 08          	sub    $0x8,%rsp
+  80374a:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80374d:	40 0f b6 c6          	movzbl %sil,%eax
+  803751:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803758:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  80375a:	be 00 00 00 00       	mov    $0x0,%esi
+  80375f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803764:	48 b8 09 2c 80 00 00 	movabs $0x802c09,%rax
+  80376b:	00 00 00 
+  80376e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803770:	85 c0                	test   %eax,%eax
+  803772:	78 23                	js     803797 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803774:	ba 58 06 00 00       	mov    $0x658,%edx
+  803779:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803780:	00 00 00 
+  803783:	48 89 df             	mov    %rbx,%rdi
+  803786:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  80378d:	00 00 00 
+  803790:	ff d0                	call   *%rax
+    return 0;
+  803792:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803797:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80379b:	c9                   	leave
+  80379c:	c3                   	ret
+
+000000000080379d <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80379d:	55                   	push   %rbp
+  80379e:	48 89 e5             	mov    %rsp,%rbp
+  8037a1:	53                   	push   %rbx
+  8037a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8037a6:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8037a9:	48 b8 b2 0b 80 00 00 	movabs $0x800bb2,%rax
+  8037b0:	00 00 00 
+  8037b3:	ff d0                	call   *%rax
+  8037b5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8037bb:	77 35                	ja     8037f2 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8037bd:	48 89 de             	mov    %rbx,%rsi
+  8037c0:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8037c7:	00 00 00 
+  8037ca:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  8037d1:	00 00 00 
+  8037d4:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8037d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8037db:	bf 07 00 00 00       	mov    $0x7,%edi
+  8037e0:	48 b8 09 2c 80 00 00 	movabs $0x802c09,%rax
+  8037e7:	00 00 00 
+  8037ea:	ff d0                	call   *%rax
+}
+  8037ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037f0:	c9                   	leave
+  8037f1:	c3                   	ret
+        return -E_BAD_PATH;
+  8037f2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8037f7:	eb f3                	jmp    8037ec <remove+0x4f>
+
+00000000008037f9 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8037f9:	55                   	push   %rbp
+  8037fa:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8037fd:	48 b8 b4 36 80 00 00 	movabs $0x8036b4,%rax
+  803804:	00 00 00 
+  803807:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803809:	be 00 00 00 00       	mov    $0x0,%esi
+  80380e:	bf 08 00 00 00       	mov    $0x8,%edi
+  803813:	48 b8 09 2c 80 00 00 	movabs $0x802c09,%rax
+  80381a:	00 00 00 
+  80381d:	ff d0                	call   *%rax
+}
+  80381f:	5d                   	pop    %rbp
+  803820:	c3                   	ret
+
+0000000000803821 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803821:	55                   	push   %rbp
+  803822:	48 89 e5             	mov    %rsp,%rbp
+  803825:	41 54                	push   %r12
+  803827:	53                   	push   %rbx
+  803828:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80382b:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  803832:	00 00 00 
+  803835:	ff d0                	call   *%rax
+  803837:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80383a:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  803841:	00 00 00 
+  803844:	48 89 df             	mov    %rbx,%rdi
+  803847:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  80384e:	00 00 00 
+  803851:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803853:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803858:	41 2b 04 24          	sub    (%r12),%eax
+  80385c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803862:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803869:	00 00 00 
+    stat->st_dev = &devpipe;
+  80386c:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803873:	00 00 00 
+  803876:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80387d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803882:	5b                   	pop    %rbx
+  803883:	41 5c                	pop    %r12
+  803885:	5d                   	pop    %rbp
+  803886:	c3                   	ret
+
+0000000000803887 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803887:	55                   	push   %rbp
+  803888:	48 89 e5             	mov    %rsp,%rbp
+  80388b:	41 54                	push   %r12
+  80388d:	53                   	push   %rbx
+  80388e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803891:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803896:	48 89 fe             	mov    %rdi,%rsi
+  803899:	bf 00 00 00 00       	mov    $0x0,%edi
+  80389e:	49 bc 2f 15 80 00 00 	movabs $0x80152f,%r12
+  8038a5:	00 00 00 
+  8038a8:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8038ab:	48 89 df             	mov    %rbx,%rdi
+  8038ae:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  8038b5:	00 00 00 
+  8038b8:	ff d0                	call   *%rax
+  8038ba:	48 89 c6             	mov    %rax,%rsi
+  8038bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038c7:	41 ff d4             	call   *%r12
+}
+  8038ca:	5b                   	pop    %rbx
+  8038cb:	41 5c                	pop    %r12
+  8038cd:	5d                   	pop    %rbp
+  8038ce:	c3                   	ret
+
+00000000008038cf <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038cf:	55                   	push   %rbp
+  8038d0:	48 89 e5             	mov    %rsp,%rbp
+  8038d3:	41 57                	push   %r15
+  8038d5:	41 56                	push   %r14
+  8038d7:	41 55                	push   %r13
+  8038d9:	41 54                	push   %r12
+  8038db:	53                   	push   %rbx
+  8038dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8038e0:	49 89 fc             	mov    %rdi,%r12
+  8038e3:	49 89 f5             	mov    %rsi,%r13
+  8038e6:	49 89 d7             	mov    %rdx,%r15
+  8038e9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038ed:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  8038f4:	00 00 00 
+  8038f7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8038f9:	4d 85 ff             	test   %r15,%r15
+  8038fc:	0f 84 af 00 00 00    	je     8039b1 <devpipe_write+0xe2>
+  803902:	48 89 c3             	mov    %rax,%rbx
+  803905:	4c 89 f8             	mov    %r15,%rax
+  803908:	4d 89 ef             	mov    %r13,%r15
+  80390b:	4c 01 e8             	add    %r13,%rax
+  80390e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803912:	49 bd 24 13 80 00 00 	movabs $0x801324,%r13
+  803919:	00 00 00 
+            sys_yield();
+  80391c:	49 be c1 12 80 00 00 	movabs $0x8012c1,%r14
+  803923:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803926:	8b 73 04             	mov    0x4(%rbx),%esi
+  803929:	48 63 ce             	movslq %esi,%rcx
+  80392c:	48 63 03             	movslq (%rbx),%rax
+  80392f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803935:	48 39 c1             	cmp    %rax,%rcx
+  803938:	72 2e                	jb     803968 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80393a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80393f:	48 89 da             	mov    %rbx,%rdx
+  803942:	be 00 10 00 00       	mov    $0x1000,%esi
+  803947:	4c 89 e7             	mov    %r12,%rdi
+  80394a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80394d:	85 c0                	test   %eax,%eax
+  80394f:	74 66                	je     8039b7 <devpipe_write+0xe8>
+            sys_yield();
+  803951:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803954:	8b 73 04             	mov    0x4(%rbx),%esi
+  803957:	48 63 ce             	movslq %esi,%rcx
+  80395a:	48 63 03             	movslq (%rbx),%rax
+  80395d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803963:	48 39 c1             	cmp    %rax,%rcx
+  803966:	73 d2                	jae    80393a <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803968:	41 0f b6 3f          	movzbl (%r15),%edi
+  80396c:	48 89 ca             	mov    %rcx,%rdx
+  80396f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803973:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80397a:	08 10 20 
+  80397d:	48 f7 e2             	mul    %rdx
+  803980:	48 c1 ea 06          	shr    $0x6,%rdx
+  803984:	48 89 d0             	mov    %rdx,%rax
+  803987:	48 c1 e0 09          	shl    $0x9,%rax
+  80398b:	48 29 d0             	sub    %rdx,%rax
+  80398e:	48 c1 e0 03          	shl    $0x3,%rax
+  803992:	48 29 c1             	sub    %rax,%rcx
+  803995:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80399a:	83 c6 01             	add    $0x1,%esi
+  80399d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8039a0:	49 83 c7 01          	add    $0x1,%r15
+  8039a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039a8:	49 39 c7             	cmp    %rax,%r15
+  8039ab:	0f 85 75 ff ff ff    	jne    803926 <devpipe_write+0x57>
+    return n;
+  8039b1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8039b5:	eb 05                	jmp    8039bc <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8039b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039bc:	48 83 c4 18          	add    $0x18,%rsp
+  8039c0:	5b                   	pop    %rbx
+  8039c1:	41 5c                	pop    %r12
+  8039c3:	41 5d                	pop    %r13
+  8039c5:	41 5e                	pop    %r14
+  8039c7:	41 5f                	pop    %r15
+  8039c9:	5d                   	pop    %rbp
+  8039ca:	c3                   	ret
+
+00000000008039cb <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039cb:	55                   	push   %rbp
+  8039cc:	48 89 e5             	mov    %rsp,%rbp
+  8039cf:	41 57                	push   %r15
+  8039d1:	41 56                	push   %r14
+  8039d3:	41 55                	push   %r13
+  8039d5:	41 54                	push   %r12
+  8039d7:	53                   	push   %rbx
+  8039d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8039dc:	49 89 fc             	mov    %rdi,%r12
+  8039df:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8039e3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039e7:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  8039ee:	00 00 00 
+  8039f1:	ff d0                	call   *%rax
+  8039f3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8039f6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039fc:	49 bd 24 13 80 00 00 	movabs $0x801324,%r13
+  803a03:	00 00 00 
+            sys_yield();
+  803a06:	49 be c1 12 80 00 00 	movabs $0x8012c1,%r14
+  803a0d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803a10:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803a15:	74 7d                	je     803a94 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803a17:	8b 03                	mov    (%rbx),%eax
+  803a19:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803a1c:	75 26                	jne    803a44 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803a1e:	4d 85 ff             	test   %r15,%r15
+  803a21:	75 77                	jne    803a9a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a23:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a28:	48 89 da             	mov    %rbx,%rdx
+  803a2b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a30:	4c 89 e7             	mov    %r12,%rdi
+  803a33:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803a36:	85 c0                	test   %eax,%eax
+  803a38:	74 72                	je     803aac <devpipe_read+0xe1>
+            sys_yield();
+  803a3a:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803a3d:	8b 03                	mov    (%rbx),%eax
+  803a3f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803a42:	74 df                	je     803a23 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a44:	48 63 c8             	movslq %eax,%rcx
+  803a47:	48 89 ca             	mov    %rcx,%rdx
+  803a4a:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a4e:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803a55:	08 10 20 
+  803a58:	48 89 d0             	mov    %rdx,%rax
+  803a5b:	48 f7 e6             	mul    %rsi
+  803a5e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a62:	48 89 d0             	mov    %rdx,%rax
+  803a65:	48 c1 e0 09          	shl    $0x9,%rax
+  803a69:	48 29 d0             	sub    %rdx,%rax
+  803a6c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803a73:	00 
+  803a74:	48 89 c8             	mov    %rcx,%rax
+  803a77:	48 29 d0             	sub    %rdx,%rax
+  803a7a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803a7f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803a83:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803a87:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a8a:	49 83 c7 01          	add    $0x1,%r15
+  803a8e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803a92:	75 83                	jne    803a17 <devpipe_read+0x4c>
+    return n;
+  803a94:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a98:	eb 03                	jmp    803a9d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803a9a:	4c 89 f8             	mov    %r15,%rax
+}
+  803a9d:	48 83 c4 18          	add    $0x18,%rsp
+  803aa1:	5b                   	pop    %rbx
+  803aa2:	41 5c                	pop    %r12
+  803aa4:	41 5d                	pop    %r13
+  803aa6:	41 5e                	pop    %r14
+  803aa8:	41 5f                	pop    %r15
+  803aaa:	5d                   	pop    %rbp
+  803aab:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab1:	eb ea                	jmp    803a9d <devpipe_read+0xd2>
+
+0000000000803ab3 <pipe>:
+pipe(int pfd[2]) {
+  803ab3:	55                   	push   %rbp
+  803ab4:	48 89 e5             	mov    %rsp,%rbp
+  803ab7:	41 55                	push   %r13
+  803ab9:	41 54                	push   %r12
+  803abb:	53                   	push   %rbx
+  803abc:	48 83 ec 18          	sub    $0x18,%rsp
+  803ac0:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ac3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ac7:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  803ace:	00 00 00 
+  803ad1:	ff d0                	call   *%rax
+  803ad3:	89 c3                	mov    %eax,%ebx
+  803ad5:	85 c0                	test   %eax,%eax
+  803ad7:	0f 88 a0 01 00 00    	js     803c7d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803add:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ae2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ae7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803aeb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803af0:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  803af7:	00 00 00 
+  803afa:	ff d0                	call   *%rax
+  803afc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803afe:	85 c0                	test   %eax,%eax
+  803b00:	0f 88 77 01 00 00    	js     803c7d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b06:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803b0a:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  803b11:	00 00 00 
+  803b14:	ff d0                	call   *%rax
+  803b16:	89 c3                	mov    %eax,%ebx
+  803b18:	85 c0                	test   %eax,%eax
+  803b1a:	0f 88 43 01 00 00    	js     803c63 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b20:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b25:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b2a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803b2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b33:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  803b3a:	00 00 00 
+  803b3d:	ff d0                	call   *%rax
+  803b3f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b41:	85 c0                	test   %eax,%eax
+  803b43:	0f 88 1a 01 00 00    	js     803c63 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803b49:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b4d:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  803b54:	00 00 00 
+  803b57:	ff d0                	call   *%rax
+  803b59:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803b5c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b61:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b66:	48 89 c6             	mov    %rax,%rsi
+  803b69:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b6e:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  803b75:	00 00 00 
+  803b78:	ff d0                	call   *%rax
+  803b7a:	89 c3                	mov    %eax,%ebx
+  803b7c:	85 c0                	test   %eax,%eax
+  803b7e:	0f 88 c5 00 00 00    	js     803c49 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803b84:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803b88:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  803b8f:	00 00 00 
+  803b92:	ff d0                	call   *%rax
+  803b94:	48 89 c1             	mov    %rax,%rcx
+  803b97:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803b9d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803ba3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ba8:	4c 89 ee             	mov    %r13,%rsi
+  803bab:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bb0:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  803bb7:	00 00 00 
+  803bba:	ff d0                	call   *%rax
+  803bbc:	89 c3                	mov    %eax,%ebx
+  803bbe:	85 c0                	test   %eax,%eax
+  803bc0:	78 6e                	js     803c30 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803bc2:	be 00 10 00 00       	mov    $0x1000,%esi
+  803bc7:	4c 89 ef             	mov    %r13,%rdi
+  803bca:	48 b8 f2 12 80 00 00 	movabs $0x8012f2,%rax
+  803bd1:	00 00 00 
+  803bd4:	ff d0                	call   *%rax
+  803bd6:	83 f8 02             	cmp    $0x2,%eax
+  803bd9:	0f 85 ab 00 00 00    	jne    803c8a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803bdf:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803be6:	00 00 
+  803be8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803bec:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803bee:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803bf2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803bf9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803bfd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803bff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c03:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c0a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c0e:	48 bb 09 20 80 00 00 	movabs $0x802009,%rbx
+  803c15:	00 00 00 
+  803c18:	ff d3                	call   *%rbx
+  803c1a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803c1e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c22:	ff d3                	call   *%rbx
+  803c24:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803c29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c2e:	eb 4d                	jmp    803c7d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803c30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c35:	4c 89 ee             	mov    %r13,%rsi
+  803c38:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c3d:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  803c44:	00 00 00 
+  803c47:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803c49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c4e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c52:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c57:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  803c5e:	00 00 00 
+  803c61:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803c63:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c68:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c71:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  803c78:	00 00 00 
+  803c7b:	ff d0                	call   *%rax
+}
+  803c7d:	89 d8                	mov    %ebx,%eax
+  803c7f:	48 83 c4 18          	add    $0x18,%rsp
+  803c83:	5b                   	pop    %rbx
+  803c84:	41 5c                	pop    %r12
+  803c86:	41 5d                	pop    %r13
+  803c88:	5d                   	pop    %rbp
+  803c89:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c8a:	48 b9 10 57 80 00 00 	movabs $0x805710,%rcx
+  803c91:	00 00 00 
+  803c94:	48 ba e7 56 80 00 00 	movabs $0x8056e7,%rdx
+  803c9b:	00 00 00 
+  803c9e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803ca3:	48 bf fc 56 80 00 00 	movabs $0x8056fc,%rdi
+  803caa:	00 00 00 
+  803cad:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb2:	49 b8 92 42 80 00 00 	movabs $0x804292,%r8
+  803cb9:	00 00 00 
+  803cbc:	41 ff d0             	call   *%r8
+
+0000000000803cbf <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803cbf:	55                   	push   %rbp
+  803cc0:	48 89 e5             	mov    %rsp,%rbp
+  803cc3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803cc7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803ccb:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  803cd2:	00 00 00 
+  803cd5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cd7:	85 c0                	test   %eax,%eax
+  803cd9:	78 35                	js     803d10 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803cdb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803cdf:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  803ce6:	00 00 00 
+  803ce9:	ff d0                	call   *%rax
+  803ceb:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803cee:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803cf3:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cf8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803cfc:	48 b8 24 13 80 00 00 	movabs $0x801324,%rax
+  803d03:	00 00 00 
+  803d06:	ff d0                	call   *%rax
+  803d08:	85 c0                	test   %eax,%eax
+  803d0a:	0f 94 c0             	sete   %al
+  803d0d:	0f b6 c0             	movzbl %al,%eax
+}
+  803d10:	c9                   	leave
+  803d11:	c3                   	ret
+
+0000000000803d12 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d12:	48 89 f8             	mov    %rdi,%rax
+  803d15:	48 c1 e8 27          	shr    $0x27,%rax
+  803d19:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803d20:	7f 00 00 
+  803d23:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d27:	f6 c2 01             	test   $0x1,%dl
+  803d2a:	74 6d                	je     803d99 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d2c:	48 89 f8             	mov    %rdi,%rax
+  803d2f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d33:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d3a:	7f 00 00 
+  803d3d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d41:	f6 c2 01             	test   $0x1,%dl
+  803d44:	74 62                	je     803da8 <get_uvpt_entry+0x96>
+  803d46:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d4d:	7f 00 00 
+  803d50:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d54:	f6 c2 80             	test   $0x80,%dl
+  803d57:	75 4f                	jne    803da8 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d59:	48 89 f8             	mov    %rdi,%rax
+  803d5c:	48 c1 e8 15          	shr    $0x15,%rax
+  803d60:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d67:	7f 00 00 
+  803d6a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d6e:	f6 c2 01             	test   $0x1,%dl
+  803d71:	74 44                	je     803db7 <get_uvpt_entry+0xa5>
+  803d73:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d7a:	7f 00 00 
+  803d7d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d81:	f6 c2 80             	test   $0x80,%dl
+  803d84:	75 31                	jne    803db7 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803d86:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803d8a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d91:	7f 00 00 
+  803d94:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803d98:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d99:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803da0:	7f 00 00 
+  803da3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803da7:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803da8:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803daf:	7f 00 00 
+  803db2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803db6:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803db7:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803dbe:	7f 00 00 
+  803dc1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dc5:	c3                   	ret
+
+0000000000803dc6 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803dc6:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803dc9:	48 89 f9             	mov    %rdi,%rcx
+  803dcc:	48 c1 e9 27          	shr    $0x27,%rcx
+  803dd0:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803dd7:	7f 00 00 
+  803dda:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803dde:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803de5:	f6 c1 01             	test   $0x1,%cl
+  803de8:	0f 84 b2 00 00 00    	je     803ea0 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803dee:	48 89 f9             	mov    %rdi,%rcx
+  803df1:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803df5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803dfc:	7f 00 00 
+  803dff:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e03:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803e0a:	40 f6 c6 01          	test   $0x1,%sil
+  803e0e:	0f 84 8c 00 00 00    	je     803ea0 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803e14:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e1b:	7f 00 00 
+  803e1e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e22:	a8 80                	test   $0x80,%al
+  803e24:	75 7b                	jne    803ea1 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e26:	48 89 f9             	mov    %rdi,%rcx
+  803e29:	48 c1 e9 15          	shr    $0x15,%rcx
+  803e2d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e34:	7f 00 00 
+  803e37:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e3b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e42:	40 f6 c6 01          	test   $0x1,%sil
+  803e46:	74 58                	je     803ea0 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803e48:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e4f:	7f 00 00 
+  803e52:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e56:	a8 80                	test   $0x80,%al
+  803e58:	75 6c                	jne    803ec6 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e5a:	48 89 f9             	mov    %rdi,%rcx
+  803e5d:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803e61:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e68:	7f 00 00 
+  803e6b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e6f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e76:	40 f6 c6 01          	test   $0x1,%sil
+  803e7a:	74 24                	je     803ea0 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803e7c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e83:	7f 00 00 
+  803e86:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e8a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e91:	ff ff 7f 
+  803e94:	48 21 c8             	and    %rcx,%rax
+  803e97:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803e9d:	48 09 d0             	or     %rdx,%rax
+}
+  803ea0:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803ea1:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ea8:	7f 00 00 
+  803eab:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803eaf:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803eb6:	ff ff 7f 
+  803eb9:	48 21 c8             	and    %rcx,%rax
+  803ebc:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803ec2:	48 01 d0             	add    %rdx,%rax
+  803ec5:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803ec6:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ecd:	7f 00 00 
+  803ed0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ed4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803edb:	ff ff 7f 
+  803ede:	48 21 c8             	and    %rcx,%rax
+  803ee1:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803ee7:	48 01 d0             	add    %rdx,%rax
+  803eea:	c3                   	ret
+
+0000000000803eeb <get_prot>:
+
+int
+get_prot(void *va) {
+  803eeb:	55                   	push   %rbp
+  803eec:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803eef:	48 b8 12 3d 80 00 00 	movabs $0x803d12,%rax
+  803ef6:	00 00 00 
+  803ef9:	ff d0                	call   *%rax
+  803efb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803efe:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f03:	89 c1                	mov    %eax,%ecx
+  803f05:	83 c9 04             	or     $0x4,%ecx
+  803f08:	f6 c2 01             	test   $0x1,%dl
+  803f0b:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803f0e:	89 c1                	mov    %eax,%ecx
+  803f10:	83 c9 02             	or     $0x2,%ecx
+  803f13:	f6 c2 02             	test   $0x2,%dl
+  803f16:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803f19:	89 c1                	mov    %eax,%ecx
+  803f1b:	83 c9 01             	or     $0x1,%ecx
+  803f1e:	48 85 d2             	test   %rdx,%rdx
+  803f21:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803f24:	89 c1                	mov    %eax,%ecx
+  803f26:	83 c9 40             	or     $0x40,%ecx
+  803f29:	f6 c6 04             	test   $0x4,%dh
+  803f2c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803f2f:	5d                   	pop    %rbp
+  803f30:	c3                   	ret
+
+0000000000803f31 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803f31:	55                   	push   %rbp
+  803f32:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f35:	48 b8 12 3d 80 00 00 	movabs $0x803d12,%rax
+  803f3c:	00 00 00 
+  803f3f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803f41:	48 c1 e8 06          	shr    $0x6,%rax
+  803f45:	83 e0 01             	and    $0x1,%eax
+}
+  803f48:	5d                   	pop    %rbp
+  803f49:	c3                   	ret
+
+0000000000803f4a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803f4a:	55                   	push   %rbp
+  803f4b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803f4e:	48 b8 12 3d 80 00 00 	movabs $0x803d12,%rax
+  803f55:	00 00 00 
+  803f58:	ff d0                	call   *%rax
+  803f5a:	83 e0 01             	and    $0x1,%eax
+}
+  803f5d:	5d                   	pop    %rbp
+  803f5e:	c3                   	ret
+
+0000000000803f5f <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803f5f:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803f66:	7f 00 00 
+  803f69:	a8 01                	test   $0x1,%al
+  803f6b:	75 06                	jne    803f73 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f72:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803f73:	55                   	push   %rbp
+  803f74:	48 89 e5             	mov    %rsp,%rbp
+  803f77:	41 57                	push   %r15
+  803f79:	41 56                	push   %r14
+  803f7b:	41 55                	push   %r13
+  803f7d:	41 54                	push   %r12
+  803f7f:	53                   	push   %rbx
+  803f80:	48 83 ec 18          	sub    $0x18,%rsp
+  803f84:	49 89 fe             	mov    %rdi,%r14
+  803f87:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803f8a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803f91:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803f92:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803f99:	7f 00 00 
+  803f9c:	e9 81 00 00 00       	jmp    804022 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803fa1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803fa8:	49 39 dd             	cmp    %rbx,%r13
+  803fab:	74 2b                	je     803fd8 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803fad:	48 89 d8             	mov    %rbx,%rax
+  803fb0:	48 c1 e8 0c          	shr    $0xc,%rax
+  803fb4:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803fb8:	f6 c2 01             	test   $0x1,%dl
+  803fbb:	74 e4                	je     803fa1 <foreach_shared_region+0x42>
+  803fbd:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803fc1:	f6 c4 04             	test   $0x4,%ah
+  803fc4:	74 db                	je     803fa1 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803fc6:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803fcd:	4c 89 fa             	mov    %r15,%rdx
+  803fd0:	48 89 df             	mov    %rbx,%rdi
+  803fd3:	41 ff d6             	call   *%r14
+  803fd6:	eb c9                	jmp    803fa1 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803fd8:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803fdf:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803fe3:	74 22                	je     804007 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803fe5:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803fec:	48 89 d8             	mov    %rbx,%rax
+  803fef:	48 c1 e8 15          	shr    $0x15,%rax
+  803ff3:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803ffa:	7f 00 00 
+  803ffd:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804001:	a8 01                	test   $0x1,%al
+  804003:	74 d3                	je     803fd8 <foreach_shared_region+0x79>
+  804005:	eb a6                	jmp    803fad <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804007:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  80400e:	40 
+  80400f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804013:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80401a:	00 00 00 
+  80401d:	48 39 c1             	cmp    %rax,%rcx
+  804020:	74 31                	je     804053 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804022:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804026:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80402a:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804031:	7f 00 00 
+  804034:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804038:	a8 01                	test   $0x1,%al
+  80403a:	74 cb                	je     804007 <foreach_shared_region+0xa8>
+  80403c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804040:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804047:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  80404d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804051:	eb 92                	jmp    803fe5 <foreach_shared_region+0x86>
+}
+  804053:	b8 00 00 00 00       	mov    $0x0,%eax
+  804058:	48 83 c4 18          	add    $0x18,%rsp
+  80405c:	5b                   	pop    %rbx
+  80405d:	41 5c                	pop    %r12
+  80405f:	41 5d                	pop    %r13
+  804061:	41 5e                	pop    %r14
+  804063:	41 5f                	pop    %r15
+  804065:	5d                   	pop    %rbp
+  804066:	c3                   	ret
+
+0000000000804067 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80406c:	c3                   	ret
+
+000000000080406d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80406d:	55                   	push   %rbp
+  80406e:	48 89 e5             	mov    %rsp,%rbp
+  804071:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804074:	48 be 34 57 80 00 00 	movabs $0x805734,%rsi
+  80407b:	00 00 00 
+  80407e:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  804085:	00 00 00 
+  804088:	ff d0                	call   *%rax
+    return 0;
+}
+  80408a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80408f:	5d                   	pop    %rbp
+  804090:	c3                   	ret
+
+0000000000804091 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804091:	55                   	push   %rbp
+  804092:	48 89 e5             	mov    %rsp,%rbp
+  804095:	41 57                	push   %r15
+  804097:	41 56                	push   %r14
+  804099:	41 55                	push   %r13
+  80409b:	41 54                	push   %r12
+  80409d:	53                   	push   %rbx
+  80409e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8040a5:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8040ac:	48 85 d2             	test   %rdx,%rdx
+  8040af:	74 7a                	je     80412b <devcons_write+0x9a>
+  8040b1:	49 89 d6             	mov    %rdx,%r14
+  8040b4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8040ba:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8040bf:	49 bf 7e 0f 80 00 00 	movabs $0x800f7e,%r15
+  8040c6:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8040c9:	4c 89 f3             	mov    %r14,%rbx
+  8040cc:	48 29 f3             	sub    %rsi,%rbx
+  8040cf:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8040d4:	48 39 c3             	cmp    %rax,%rbx
+  8040d7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8040db:	4c 63 eb             	movslq %ebx,%r13
+  8040de:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8040e5:	48 01 c6             	add    %rax,%rsi
+  8040e8:	4c 89 ea             	mov    %r13,%rdx
+  8040eb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8040f2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8040f5:	4c 89 ee             	mov    %r13,%rsi
+  8040f8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8040ff:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  804106:	00 00 00 
+  804109:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80410b:	41 01 dc             	add    %ebx,%r12d
+  80410e:	49 63 f4             	movslq %r12d,%rsi
+  804111:	4c 39 f6             	cmp    %r14,%rsi
+  804114:	72 b3                	jb     8040c9 <devcons_write+0x38>
+    return res;
+  804116:	49 63 c4             	movslq %r12d,%rax
+}
+  804119:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804120:	5b                   	pop    %rbx
+  804121:	41 5c                	pop    %r12
+  804123:	41 5d                	pop    %r13
+  804125:	41 5e                	pop    %r14
+  804127:	41 5f                	pop    %r15
+  804129:	5d                   	pop    %rbp
+  80412a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80412b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804131:	eb e3                	jmp    804116 <devcons_write+0x85>
+
+0000000000804133 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804133:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804136:	ba 00 00 00 00       	mov    $0x0,%edx
+  80413b:	48 85 c0             	test   %rax,%rax
+  80413e:	74 55                	je     804195 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804140:	55                   	push   %rbp
+  804141:	48 89 e5             	mov    %rsp,%rbp
+  804144:	41 55                	push   %r13
+  804146:	41 54                	push   %r12
+  804148:	53                   	push   %rbx
+  804149:	48 83 ec 08          	sub    $0x8,%rsp
+  80414d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804150:	48 bb f4 11 80 00 00 	movabs $0x8011f4,%rbx
+  804157:	00 00 00 
+  80415a:	49 bc c1 12 80 00 00 	movabs $0x8012c1,%r12
+  804161:	00 00 00 
+  804164:	eb 03                	jmp    804169 <devcons_read+0x36>
+  804166:	41 ff d4             	call   *%r12
+  804169:	ff d3                	call   *%rbx
+  80416b:	85 c0                	test   %eax,%eax
+  80416d:	74 f7                	je     804166 <devcons_read+0x33>
+    if (c < 0) return c;
+  80416f:	48 63 d0             	movslq %eax,%rdx
+  804172:	78 13                	js     804187 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804174:	ba 00 00 00 00       	mov    $0x0,%edx
+  804179:	83 f8 04             	cmp    $0x4,%eax
+  80417c:	74 09                	je     804187 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80417e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804182:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804187:	48 89 d0             	mov    %rdx,%rax
+  80418a:	48 83 c4 08          	add    $0x8,%rsp
+  80418e:	5b                   	pop    %rbx
+  80418f:	41 5c                	pop    %r12
+  804191:	41 5d                	pop    %r13
+  804193:	5d                   	pop    %rbp
+  804194:	c3                   	ret
+  804195:	48 89 d0             	mov    %rdx,%rax
+  804198:	c3                   	ret
+
+0000000000804199 <cputchar>:
+cputchar(int ch) {
+  804199:	55                   	push   %rbp
+  80419a:	48 89 e5             	mov    %rsp,%rbp
+  80419d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8041a1:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8041a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8041aa:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8041ae:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  8041b5:	00 00 00 
+  8041b8:	ff d0                	call   *%rax
+}
+  8041ba:	c9                   	leave
+  8041bb:	c3                   	ret
+
+00000000008041bc <getchar>:
+getchar(void) {
+  8041bc:	55                   	push   %rbp
+  8041bd:	48 89 e5             	mov    %rsp,%rbp
+  8041c0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8041c4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041c9:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8041cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041d2:	48 b8 7a 23 80 00 00 	movabs $0x80237a,%rax
+  8041d9:	00 00 00 
+  8041dc:	ff d0                	call   *%rax
+  8041de:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8041e0:	85 c0                	test   %eax,%eax
+  8041e2:	78 06                	js     8041ea <getchar+0x2e>
+  8041e4:	74 08                	je     8041ee <getchar+0x32>
+  8041e6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8041ea:	89 d0                	mov    %edx,%eax
+  8041ec:	c9                   	leave
+  8041ed:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8041ee:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8041f3:	eb f5                	jmp    8041ea <getchar+0x2e>
+
+00000000008041f5 <iscons>:
+iscons(int fdnum) {
+  8041f5:	55                   	push   %rbp
+  8041f6:	48 89 e5             	mov    %rsp,%rbp
+  8041f9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041fd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804201:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  804208:	00 00 00 
+  80420b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80420d:	85 c0                	test   %eax,%eax
+  80420f:	78 18                	js     804229 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804211:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804215:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80421c:	00 00 00 
+  80421f:	8b 00                	mov    (%rax),%eax
+  804221:	39 02                	cmp    %eax,(%rdx)
+  804223:	0f 94 c0             	sete   %al
+  804226:	0f b6 c0             	movzbl %al,%eax
+}
+  804229:	c9                   	leave
+  80422a:	c3                   	ret
+
+000000000080422b <opencons>:
+opencons(void) {
+  80422b:	55                   	push   %rbp
+  80422c:	48 89 e5             	mov    %rsp,%rbp
+  80422f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804233:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804237:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  80423e:	00 00 00 
+  804241:	ff d0                	call   *%rax
+  804243:	85 c0                	test   %eax,%eax
+  804245:	78 49                	js     804290 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804247:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80424c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804251:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804255:	bf 00 00 00 00       	mov    $0x0,%edi
+  80425a:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  804261:	00 00 00 
+  804264:	ff d0                	call   *%rax
+  804266:	85 c0                	test   %eax,%eax
+  804268:	78 26                	js     804290 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80426a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80426e:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804275:	00 00 
+  804277:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804279:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80427d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804284:	48 b8 09 20 80 00 00 	movabs $0x802009,%rax
+  80428b:	00 00 00 
+  80428e:	ff d0                	call   *%rax
+}
+  804290:	c9                   	leave
+  804291:	c3                   	ret
+
+0000000000804292 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804292:	55                   	push   %rbp
+  804293:	48 89 e5             	mov    %rsp,%rbp
+  804296:	41 56                	push   %r14
+  804298:	41 55                	push   %r13
+  80429a:	41 54                	push   %r12
+  80429c:	53                   	push   %rbx
+  80429d:	48 83 ec 50          	sub    $0x50,%rsp
+  8042a1:	49 89 fc             	mov    %rdi,%r12
+  8042a4:	41 89 f5             	mov    %esi,%r13d
+  8042a7:	48 89 d3             	mov    %rdx,%rbx
+  8042aa:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8042ae:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8042b2:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8042b6:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8042bd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042c1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8042c5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8042c9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8042cd:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8042d4:	00 00 00 
+  8042d7:	4c 8b 30             	mov    (%rax),%r14
+  8042da:	48 b8 90 12 80 00 00 	movabs $0x801290,%rax
+  8042e1:	00 00 00 
+  8042e4:	ff d0                	call   *%rax
+  8042e6:	89 c6                	mov    %eax,%esi
+  8042e8:	45 89 e8             	mov    %r13d,%r8d
+  8042eb:	4c 89 e1             	mov    %r12,%rcx
+  8042ee:	4c 89 f2             	mov    %r14,%rdx
+  8042f1:	48 bf 40 57 80 00 00 	movabs $0x805740,%rdi
+  8042f8:	00 00 00 
+  8042fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804300:	49 bc 78 02 80 00 00 	movabs $0x800278,%r12
+  804307:	00 00 00 
+  80430a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80430d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  804311:	48 89 df             	mov    %rbx,%rdi
+  804314:	48 b8 14 02 80 00 00 	movabs $0x800214,%rax
+  80431b:	00 00 00 
+  80431e:	ff d0                	call   *%rax
+    cprintf("\n");
+  804320:	48 bf 8b 56 80 00 00 	movabs $0x80568b,%rdi
+  804327:	00 00 00 
+  80432a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80432f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804332:	cc                   	int3
+  804333:	eb fd                	jmp    804332 <_panic+0xa0>
+
+0000000000804335 <__text_end>:
+  804335:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433c:	00 00 00 
+  80433f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804346:	00 00 00 
+  804349:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804350:	00 00 00 
+  804353:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435a:	00 00 00 
+  80435d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804364:	00 00 00 
+  804367:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436e:	00 00 00 
+  804371:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804378:	00 00 00 
+  80437b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804382:	00 00 00 
+  804385:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438c:	00 00 00 
+  80438f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804396:	00 00 00 
+  804399:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a0:	00 00 00 
+  8043a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043aa:	00 00 00 
+  8043ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b4:	00 00 00 
+  8043b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043be:	00 00 00 
+  8043c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c8:	00 00 00 
+  8043cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d2:	00 00 00 
+  8043d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dc:	00 00 00 
+  8043df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e6:	00 00 00 
+  8043e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f0:	00 00 00 
+  8043f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fa:	00 00 00 
+  8043fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804404:	00 00 00 
+  804407:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440e:	00 00 00 
+  804411:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804418:	00 00 00 
+  80441b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804422:	00 00 00 
+  804425:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442c:	00 00 00 
+  80442f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804436:	00 00 00 
+  804439:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804440:	00 00 00 
+  804443:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444a:	00 00 00 
+  80444d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804454:	00 00 00 
+  804457:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445e:	00 00 00 
+  804461:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804468:	00 00 00 
+  80446b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804472:	00 00 00 
+  804475:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447c:	00 00 00 
+  80447f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804486:	00 00 00 
+  804489:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804490:	00 00 00 
+  804493:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449a:	00 00 00 
+  80449d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a4:	00 00 00 
+  8044a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ae:	00 00 00 
+  8044b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b8:	00 00 00 
+  8044bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c2:	00 00 00 
+  8044c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cc:	00 00 00 
+  8044cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d6:	00 00 00 
+  8044d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e0:	00 00 00 
+  8044e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ea:	00 00 00 
+  8044ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f4:	00 00 00 
+  8044f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fe:	00 00 00 
+  804501:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804508:	00 00 00 
+  80450b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804512:	00 00 00 
+  804515:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451c:	00 00 00 
+  80451f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804526:	00 00 00 
+  804529:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804530:	00 00 00 
+  804533:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453a:	00 00 00 
+  80453d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804544:	00 00 00 
+  804547:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454e:	00 00 00 
+  804551:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804558:	00 00 00 
+  80455b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804562:	00 00 00 
+  804565:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456c:	00 00 00 
+  80456f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804576:	00 00 00 
+  804579:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804580:	00 00 00 
+  804583:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458a:	00 00 00 
+  80458d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804594:	00 00 00 
+  804597:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459e:	00 00 00 
+  8045a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a8:	00 00 00 
+  8045ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b2:	00 00 00 
+  8045b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bc:	00 00 00 
+  8045bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c6:	00 00 00 
+  8045c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d0:	00 00 00 
+  8045d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045da:	00 00 00 
+  8045dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e4:	00 00 00 
+  8045e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ee:	00 00 00 
+  8045f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f8:	00 00 00 
+  8045fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804602:	00 00 00 
+  804605:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460c:	00 00 00 
+  80460f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804616:	00 00 00 
+  804619:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804620:	00 00 00 
+  804623:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462a:	00 00 00 
+  80462d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804634:	00 00 00 
+  804637:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463e:	00 00 00 
+  804641:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804648:	00 00 00 
+  80464b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804652:	00 00 00 
+  804655:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465c:	00 00 00 
+  80465f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804666:	00 00 00 
+  804669:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804670:	00 00 00 
+  804673:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467a:	00 00 00 
+  80467d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804684:	00 00 00 
+  804687:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468e:	00 00 00 
+  804691:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804698:	00 00 00 
+  80469b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a2:	00 00 00 
+  8046a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ac:	00 00 00 
+  8046af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b6:	00 00 00 
+  8046b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c0:	00 00 00 
+  8046c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ca:	00 00 00 
+  8046cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d4:	00 00 00 
+  8046d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046de:	00 00 00 
+  8046e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e8:	00 00 00 
+  8046eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f2:	00 00 00 
+  8046f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fc:	00 00 00 
+  8046ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804706:	00 00 00 
+  804709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804710:	00 00 00 
+  804713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471a:	00 00 00 
+  80471d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804724:	00 00 00 
+  804727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472e:	00 00 00 
+  804731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804738:	00 00 00 
+  80473b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804742:	00 00 00 
+  804745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474c:	00 00 00 
+  80474f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804756:	00 00 00 
+  804759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804760:	00 00 00 
+  804763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476a:	00 00 00 
+  80476d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804774:	00 00 00 
+  804777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477e:	00 00 00 
+  804781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804788:	00 00 00 
+  80478b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804792:	00 00 00 
+  804795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479c:	00 00 00 
+  80479f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a6:	00 00 00 
+  8047a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b0:	00 00 00 
+  8047b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ba:	00 00 00 
+  8047bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c4:	00 00 00 
+  8047c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ce:	00 00 00 
+  8047d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d8:	00 00 00 
+  8047db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e2:	00 00 00 
+  8047e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ec:	00 00 00 
+  8047ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f6:	00 00 00 
+  8047f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804800:	00 00 00 
+  804803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480a:	00 00 00 
+  80480d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804814:	00 00 00 
+  804817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481e:	00 00 00 
+  804821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804828:	00 00 00 
+  80482b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804832:	00 00 00 
+  804835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483c:	00 00 00 
+  80483f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804846:	00 00 00 
+  804849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804850:	00 00 00 
+  804853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485a:	00 00 00 
+  80485d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804864:	00 00 00 
+  804867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486e:	00 00 00 
+  804871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804878:	00 00 00 
+  80487b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804882:	00 00 00 
+  804885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488c:	00 00 00 
+  80488f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804896:	00 00 00 
+  804899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a0:	00 00 00 
+  8048a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048aa:	00 00 00 
+  8048ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b4:	00 00 00 
+  8048b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048be:	00 00 00 
+  8048c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c8:	00 00 00 
+  8048cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d2:	00 00 00 
+  8048d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dc:	00 00 00 
+  8048df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e6:	00 00 00 
+  8048e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f0:	00 00 00 
+  8048f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fa:	00 00 00 
+  8048fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804904:	00 00 00 
+  804907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490e:	00 00 00 
+  804911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804918:	00 00 00 
+  80491b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804922:	00 00 00 
+  804925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492c:	00 00 00 
+  80492f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804936:	00 00 00 
+  804939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804940:	00 00 00 
+  804943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494a:	00 00 00 
+  80494d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804954:	00 00 00 
+  804957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495e:	00 00 00 
+  804961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804968:	00 00 00 
+  80496b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804972:	00 00 00 
+  804975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497c:	00 00 00 
+  80497f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804986:	00 00 00 
+  804989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804990:	00 00 00 
+  804993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499a:	00 00 00 
+  80499d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a4:	00 00 00 
+  8049a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ae:	00 00 00 
+  8049b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b8:	00 00 00 
+  8049bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c2:	00 00 00 
+  8049c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cc:	00 00 00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e0:	00 00 00 
+  8049e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ea:	00 00 00 
+  8049ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f4:	00 00 00 
+  8049f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fe:	00 00 00 
+  804a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a08:	00 00 00 
+  804a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a12:	00 00 00 
+  804a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1c:	00 00 00 
+  804a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a26:	00 00 00 
+  804a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a30:	00 00 00 
+  804a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3a:	00 00 00 
+  804a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a44:	00 00 00 
+  804a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4e:	00 00 00 
+  804a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a58:	00 00 00 
+  804a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a62:	00 00 00 
+  804a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6c:	00 00 00 
+  804a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a76:	00 00 00 
+  804a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a80:	00 00 00 
+  804a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8a:	00 00 00 
+  804a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a94:	00 00 00 
+  804a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9e:	00 00 00 
+  804aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa8:	00 00 00 
+  804aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab2:	00 00 00 
+  804ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abc:	00 00 00 
+  804abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac6:	00 00 00 
+  804ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad0:	00 00 00 
+  804ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ada:	00 00 00 
+  804add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae4:	00 00 00 
+  804ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aee:	00 00 00 
+  804af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af8:	00 00 00 
+  804afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b02:	00 00 00 
+  804b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0c:	00 00 00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b20:	00 00 00 
+  804b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2a:	00 00 00 
+  804b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b34:	00 00 00 
+  804b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3e:	00 00 00 
+  804b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b48:	00 00 00 
+  804b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b52:	00 00 00 
+  804b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5c:	00 00 00 
+  804b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b66:	00 00 00 
+  804b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b70:	00 00 00 
+  804b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7a:	00 00 00 
+  804b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b84:	00 00 00 
+  804b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8e:	00 00 00 
+  804b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b98:	00 00 00 
+  804b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba2:	00 00 00 
+  804ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bac:	00 00 00 
+  804baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb6:	00 00 00 
+  804bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc0:	00 00 00 
+  804bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bca:	00 00 00 
+  804bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd4:	00 00 00 
+  804bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bde:	00 00 00 
+  804be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be8:	00 00 00 
+  804beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf2:	00 00 00 
+  804bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfc:	00 00 00 
+  804bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c06:	00 00 00 
+  804c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c10:	00 00 00 
+  804c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1a:	00 00 00 
+  804c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c24:	00 00 00 
+  804c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2e:	00 00 00 
+  804c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c38:	00 00 00 
+  804c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c42:	00 00 00 
+  804c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4c:	00 00 00 
+  804c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c56:	00 00 00 
+  804c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c60:	00 00 00 
+  804c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6a:	00 00 00 
+  804c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c74:	00 00 00 
+  804c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7e:	00 00 00 
+  804c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c88:	00 00 00 
+  804c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c92:	00 00 00 
+  804c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9c:	00 00 00 
+  804c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca6:	00 00 00 
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
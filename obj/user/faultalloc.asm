@@ -0,0 +1,8314 @@
+
+obj/user/faultalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0c 01 00 00       	call   80012f <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- alloc pages to fix faults */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 4b 03 80 00 00 	movabs $0x80034b,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 48 0c 80 00 00 	movabs $0x800c48,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba 28 50 80 00 00 	movabs $0x805028,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000bf:	48 bf 0b 50 80 00 00 	movabs $0x80500b,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+  8000df:	41 54                	push   %r12
+  8000e1:	53                   	push   %rbx
+    add_pgfault_handler(handler);
+  8000e2:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e9:	00 00 00 
+  8000ec:	48 b8 c3 1e 80 00 00 	movabs $0x801ec3,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+    cprintf("%s\n", (char *)0xBeefDead);
+  8000f8:	be ad de ef be       	mov    $0xbeefdead,%esi
+  8000fd:	49 bc 1d 50 80 00 00 	movabs $0x80501d,%r12
+  800104:	00 00 00 
+  800107:	4c 89 e7             	mov    %r12,%rdi
+  80010a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010f:	48 bb 4b 03 80 00 00 	movabs $0x80034b,%rbx
+  800116:	00 00 00 
+  800119:	ff d3                	call   *%rbx
+    cprintf("%s\n", (char *)0xCafeBffe);
+  80011b:	be fe bf fe ca       	mov    $0xcafebffe,%esi
+  800120:	4c 89 e7             	mov    %r12,%rdi
+  800123:	b8 00 00 00 00       	mov    $0x0,%eax
+  800128:	ff d3                	call   *%rbx
+}
+  80012a:	5b                   	pop    %rbx
+  80012b:	41 5c                	pop    %r12
+  80012d:	5d                   	pop    %rbp
+  80012e:	c3                   	ret
+
+000000000080012f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+  800133:	41 56                	push   %r14
+  800135:	41 55                	push   %r13
+  800137:	41 54                	push   %r12
+  800139:	53                   	push   %rbx
+  80013a:	41 89 fd             	mov    %edi,%r13d
+  80013d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800140:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800147:	00 00 00 
+  80014a:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800151:	00 00 00 
+  800154:	48 39 c2             	cmp    %rax,%rdx
+  800157:	73 17                	jae    800170 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800159:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80015c:	49 89 c4             	mov    %rax,%r12
+  80015f:	48 83 c3 08          	add    $0x8,%rbx
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	ff 53 f8             	call   *-0x8(%rbx)
+  80016b:	4c 39 e3             	cmp    %r12,%rbx
+  80016e:	72 ef                	jb     80015f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800170:	48 b8 63 13 80 00 00 	movabs $0x801363,%rax
+  800177:	00 00 00 
+  80017a:	ff d0                	call   *%rax
+  80017c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800181:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800188:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80018f:	00 00 00 
+  800192:	48 01 d0             	add    %rdx,%rax
+  800195:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  80019c:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80019f:	45 85 ed             	test   %r13d,%r13d
+  8001a2:	7e 0d                	jle    8001b1 <libmain+0x82>
+  8001a4:	49 8b 06             	mov    (%r14),%rax
+  8001a7:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001ae:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001b1:	4c 89 f6             	mov    %r14,%rsi
+  8001b4:	44 89 ef             	mov    %r13d,%edi
+  8001b7:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  8001be:	00 00 00 
+  8001c1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001c3:	48 b8 d8 01 80 00 00 	movabs $0x8001d8,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+#endif
+}
+  8001cf:	5b                   	pop    %rbx
+  8001d0:	41 5c                	pop    %r12
+  8001d2:	41 5d                	pop    %r13
+  8001d4:	41 5e                	pop    %r14
+  8001d6:	5d                   	pop    %rbp
+  8001d7:	c3                   	ret
+
+00000000008001d8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001d8:	55                   	push   %rbp
+  8001d9:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001dc:	48 b8 2c 23 80 00 00 	movabs $0x80232c,%rax
+  8001e3:	00 00 00 
+  8001e6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ed:	48 b8 f8 12 80 00 00 	movabs $0x8012f8,%rax
+  8001f4:	00 00 00 
+  8001f7:	ff d0                	call   *%rax
+}
+  8001f9:	5d                   	pop    %rbp
+  8001fa:	c3                   	ret
+
+00000000008001fb <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001fb:	55                   	push   %rbp
+  8001fc:	48 89 e5             	mov    %rsp,%rbp
+  8001ff:	41 56                	push   %r14
+  800201:	41 55                	push   %r13
+  800203:	41 54                	push   %r12
+  800205:	53                   	push   %rbx
+  800206:	48 83 ec 50          	sub    $0x50,%rsp
+  80020a:	49 89 fc             	mov    %rdi,%r12
+  80020d:	41 89 f5             	mov    %esi,%r13d
+  800210:	48 89 d3             	mov    %rdx,%rbx
+  800213:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800217:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80021b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80021f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800226:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80022a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80022e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800232:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800236:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80023d:	00 00 00 
+  800240:	4c 8b 30             	mov    (%rax),%r14
+  800243:	48 b8 63 13 80 00 00 	movabs $0x801363,%rax
+  80024a:	00 00 00 
+  80024d:	ff d0                	call   *%rax
+  80024f:	89 c6                	mov    %eax,%esi
+  800251:	45 89 e8             	mov    %r13d,%r8d
+  800254:	4c 89 e1             	mov    %r12,%rcx
+  800257:	4c 89 f2             	mov    %r14,%rdx
+  80025a:	48 bf 88 50 80 00 00 	movabs $0x805088,%rdi
+  800261:	00 00 00 
+  800264:	b8 00 00 00 00       	mov    $0x0,%eax
+  800269:	49 bc 4b 03 80 00 00 	movabs $0x80034b,%r12
+  800270:	00 00 00 
+  800273:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800276:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80027a:	48 89 df             	mov    %rbx,%rdi
+  80027d:	48 b8 e7 02 80 00 00 	movabs $0x8002e7,%rax
+  800284:	00 00 00 
+  800287:	ff d0                	call   *%rax
+    cprintf("\n");
+  800289:	48 bf 4b 57 80 00 00 	movabs $0x80574b,%rdi
+  800290:	00 00 00 
+  800293:	b8 00 00 00 00       	mov    $0x0,%eax
+  800298:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80029b:	cc                   	int3
+  80029c:	eb fd                	jmp    80029b <_panic+0xa0>
+
+000000000080029e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80029e:	55                   	push   %rbp
+  80029f:	48 89 e5             	mov    %rsp,%rbp
+  8002a2:	53                   	push   %rbx
+  8002a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002aa:	8b 06                	mov    (%rsi),%eax
+  8002ac:	8d 50 01             	lea    0x1(%rax),%edx
+  8002af:	89 16                	mov    %edx,(%rsi)
+  8002b1:	48 98                	cltq
+  8002b3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002b8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002be:	74 0a                	je     8002ca <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002c0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c8:	c9                   	leave
+  8002c9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002ca:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002ce:	be ff 00 00 00       	mov    $0xff,%esi
+  8002d3:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  8002da:	00 00 00 
+  8002dd:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002df:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002e5:	eb d9                	jmp    8002c0 <putch+0x22>
+
+00000000008002e7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002e7:	55                   	push   %rbp
+  8002e8:	48 89 e5             	mov    %rsp,%rbp
+  8002eb:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002f2:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002f5:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002fc:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800301:	b8 00 00 00 00       	mov    $0x0,%eax
+  800306:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800309:	48 89 f1             	mov    %rsi,%rcx
+  80030c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800313:	48 bf 9e 02 80 00 00 	movabs $0x80029e,%rdi
+  80031a:	00 00 00 
+  80031d:	48 b8 9b 04 80 00 00 	movabs $0x80049b,%rax
+  800324:	00 00 00 
+  800327:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800329:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800330:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800337:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  80033e:	00 00 00 
+  800341:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800343:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800349:	c9                   	leave
+  80034a:	c3                   	ret
+
+000000000080034b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80034b:	55                   	push   %rbp
+  80034c:	48 89 e5             	mov    %rsp,%rbp
+  80034f:	48 83 ec 50          	sub    $0x50,%rsp
+  800353:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800357:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80035b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80035f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800363:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800367:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80036e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800372:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800376:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80037a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80037e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800382:	48 b8 e7 02 80 00 00 	movabs $0x8002e7,%rax
+  800389:	00 00 00 
+  80038c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+0000000000800390 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800390:	55                   	push   %rbp
+  800391:	48 89 e5             	mov    %rsp,%rbp
+  800394:	41 57                	push   %r15
+  800396:	41 56                	push   %r14
+  800398:	41 55                	push   %r13
+  80039a:	41 54                	push   %r12
+  80039c:	53                   	push   %rbx
+  80039d:	48 83 ec 18          	sub    $0x18,%rsp
+  8003a1:	49 89 fc             	mov    %rdi,%r12
+  8003a4:	49 89 f5             	mov    %rsi,%r13
+  8003a7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003ab:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003ae:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003b1:	41 89 cf             	mov    %ecx,%r15d
+  8003b4:	4c 39 fa             	cmp    %r15,%rdx
+  8003b7:	73 5b                	jae    800414 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003b9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003bd:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003c1:	85 db                	test   %ebx,%ebx
+  8003c3:	7e 0e                	jle    8003d3 <print_num+0x43>
+            putch(padc, put_arg);
+  8003c5:	4c 89 ee             	mov    %r13,%rsi
+  8003c8:	44 89 f7             	mov    %r14d,%edi
+  8003cb:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003ce:	83 eb 01             	sub    $0x1,%ebx
+  8003d1:	75 f2                	jne    8003c5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003d3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003d7:	48 b9 bc 50 80 00 00 	movabs $0x8050bc,%rcx
+  8003de:	00 00 00 
+  8003e1:	48 b8 ab 50 80 00 00 	movabs $0x8050ab,%rax
+  8003e8:	00 00 00 
+  8003eb:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f8:	49 f7 f7             	div    %r15
+  8003fb:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003ff:	4c 89 ee             	mov    %r13,%rsi
+  800402:	41 ff d4             	call   *%r12
+}
+  800405:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800409:	5b                   	pop    %rbx
+  80040a:	41 5c                	pop    %r12
+  80040c:	41 5d                	pop    %r13
+  80040e:	41 5e                	pop    %r14
+  800410:	41 5f                	pop    %r15
+  800412:	5d                   	pop    %rbp
+  800413:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800414:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800418:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041d:	49 f7 f7             	div    %r15
+  800420:	48 83 ec 08          	sub    $0x8,%rsp
+  800424:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800428:	52                   	push   %rdx
+  800429:	45 0f be c9          	movsbl %r9b,%r9d
+  80042d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800431:	48 89 c2             	mov    %rax,%rdx
+  800434:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  80043b:	00 00 00 
+  80043e:	ff d0                	call   *%rax
+  800440:	48 83 c4 10          	add    $0x10,%rsp
+  800444:	eb 8d                	jmp    8003d3 <print_num+0x43>
+
+0000000000800446 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800446:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80044a:	48 8b 06             	mov    (%rsi),%rax
+  80044d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800451:	73 0a                	jae    80045d <sprintputch+0x17>
+        *state->start++ = ch;
+  800453:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800457:	48 89 16             	mov    %rdx,(%rsi)
+  80045a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80045d:	c3                   	ret
+
+000000000080045e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80045e:	55                   	push   %rbp
+  80045f:	48 89 e5             	mov    %rsp,%rbp
+  800462:	48 83 ec 50          	sub    $0x50,%rsp
+  800466:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80046a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80046e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800472:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800479:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80047d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800481:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800485:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800489:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80048d:	48 b8 9b 04 80 00 00 	movabs $0x80049b,%rax
+  800494:	00 00 00 
+  800497:	ff d0                	call   *%rax
+}
+  800499:	c9                   	leave
+  80049a:	c3                   	ret
+
+000000000080049b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80049b:	55                   	push   %rbp
+  80049c:	48 89 e5             	mov    %rsp,%rbp
+  80049f:	41 57                	push   %r15
+  8004a1:	41 56                	push   %r14
+  8004a3:	41 55                	push   %r13
+  8004a5:	41 54                	push   %r12
+  8004a7:	53                   	push   %rbx
+  8004a8:	48 83 ec 38          	sub    $0x38,%rsp
+  8004ac:	49 89 fe             	mov    %rdi,%r14
+  8004af:	49 89 f5             	mov    %rsi,%r13
+  8004b2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004b5:	48 8b 01             	mov    (%rcx),%rax
+  8004b8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004bc:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004c8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004d0:	0f b6 3b             	movzbl (%rbx),%edi
+  8004d3:	40 80 ff 25          	cmp    $0x25,%dil
+  8004d7:	74 18                	je     8004f1 <vprintfmt+0x56>
+            if (!ch) return;
+  8004d9:	40 84 ff             	test   %dil,%dil
+  8004dc:	0f 84 04 07 00 00    	je     800be6 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8004e2:	40 0f b6 ff          	movzbl %dil,%edi
+  8004e6:	4c 89 ee             	mov    %r13,%rsi
+  8004e9:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004ec:	4c 89 e3             	mov    %r12,%rbx
+  8004ef:	eb db                	jmp    8004cc <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f6:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004fa:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004ff:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800505:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80050c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800510:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800515:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80051a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80051d:	83 e8 23             	sub    $0x23,%eax
+  800520:	3c 57                	cmp    $0x57,%al
+  800522:	0f 87 a4 06 00 00    	ja     800bcc <vprintfmt+0x731>
+  800528:	0f b6 c0             	movzbl %al,%eax
+  80052b:	48 b9 40 52 80 00 00 	movabs $0x805240,%rcx
+  800532:	00 00 00 
+  800535:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800538:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80053b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80053f:	eb cf                	jmp    800510 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800541:	49 89 dc             	mov    %rbx,%r12
+  800544:	be 01 00 00 00       	mov    $0x1,%esi
+  800549:	eb c5                	jmp    800510 <vprintfmt+0x75>
+            padc = ch;
+  80054b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80054f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800552:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800555:	eb b9                	jmp    800510 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800557:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80055a:	83 f8 2f             	cmp    $0x2f,%eax
+  80055d:	77 24                	ja     800583 <vprintfmt+0xe8>
+  80055f:	89 c1                	mov    %eax,%ecx
+  800561:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800565:	83 c0 08             	add    $0x8,%eax
+  800568:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80056b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80056e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800571:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800575:	79 99                	jns    800510 <vprintfmt+0x75>
+                width = precision;
+  800577:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80057b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800581:	eb 8d                	jmp    800510 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800583:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800587:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80058b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80058f:	eb da                	jmp    80056b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800591:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800596:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80059a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005a0:	3c 39                	cmp    $0x39,%al
+  8005a2:	77 1c                	ja     8005c0 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005a4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005a8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005ac:	0f b6 c0             	movzbl %al,%eax
+  8005af:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005b4:	0f b6 03             	movzbl (%rbx),%eax
+  8005b7:	3c 39                	cmp    $0x39,%al
+  8005b9:	76 e9                	jbe    8005a4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005bb:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005be:	eb b1                	jmp    800571 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005c0:	49 89 dc             	mov    %rbx,%r12
+  8005c3:	eb ac                	jmp    800571 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005c5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005c8:	85 c9                	test   %ecx,%ecx
+  8005ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cf:	0f 49 c1             	cmovns %ecx,%eax
+  8005d2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005d5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005d8:	e9 33 ff ff ff       	jmp    800510 <vprintfmt+0x75>
+            lflag++;
+  8005dd:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005e0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005e3:	e9 28 ff ff ff       	jmp    800510 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ee:	77 19                	ja     800609 <vprintfmt+0x16e>
+  8005f0:	89 c2                	mov    %eax,%edx
+  8005f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005f6:	83 c0 08             	add    $0x8,%eax
+  8005f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005fc:	8b 3a                	mov    (%rdx),%edi
+  8005fe:	4c 89 ee             	mov    %r13,%rsi
+  800601:	41 ff d6             	call   *%r14
+            break;
+  800604:	e9 c3 fe ff ff       	jmp    8004cc <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800609:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80060d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800611:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800615:	eb e5                	jmp    8005fc <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800617:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80061a:	83 f8 2f             	cmp    $0x2f,%eax
+  80061d:	77 5a                	ja     800679 <vprintfmt+0x1de>
+  80061f:	89 c2                	mov    %eax,%edx
+  800621:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800625:	83 c0 08             	add    $0x8,%eax
+  800628:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80062b:	8b 02                	mov    (%rdx),%eax
+  80062d:	89 c1                	mov    %eax,%ecx
+  80062f:	f7 d9                	neg    %ecx
+  800631:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800634:	83 f9 13             	cmp    $0x13,%ecx
+  800637:	7f 4e                	jg     800687 <vprintfmt+0x1ec>
+  800639:	48 63 c1             	movslq %ecx,%rax
+  80063c:	48 ba 00 55 80 00 00 	movabs $0x805500,%rdx
+  800643:	00 00 00 
+  800646:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80064a:	48 85 c0             	test   %rax,%rax
+  80064d:	74 38                	je     800687 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80064f:	48 89 c1             	mov    %rax,%rcx
+  800652:	48 ba ea 56 80 00 00 	movabs $0x8056ea,%rdx
+  800659:	00 00 00 
+  80065c:	4c 89 ee             	mov    %r13,%rsi
+  80065f:	4c 89 f7             	mov    %r14,%rdi
+  800662:	b8 00 00 00 00       	mov    $0x0,%eax
+  800667:	49 b8 5e 04 80 00 00 	movabs $0x80045e,%r8
+  80066e:	00 00 00 
+  800671:	41 ff d0             	call   *%r8
+  800674:	e9 53 fe ff ff       	jmp    8004cc <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800679:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80067d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800681:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800685:	eb a4                	jmp    80062b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800687:	48 ba d4 50 80 00 00 	movabs $0x8050d4,%rdx
+  80068e:	00 00 00 
+  800691:	4c 89 ee             	mov    %r13,%rsi
+  800694:	4c 89 f7             	mov    %r14,%rdi
+  800697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069c:	49 b8 5e 04 80 00 00 	movabs $0x80045e,%r8
+  8006a3:	00 00 00 
+  8006a6:	41 ff d0             	call   *%r8
+  8006a9:	e9 1e fe ff ff       	jmp    8004cc <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b4:	77 36                	ja     8006ec <vprintfmt+0x251>
+  8006b6:	89 c2                	mov    %eax,%edx
+  8006b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bc:	83 c0 08             	add    $0x8,%eax
+  8006bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c2:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8006c5:	48 85 f6             	test   %rsi,%rsi
+  8006c8:	48 b8 cd 50 80 00 00 	movabs $0x8050cd,%rax
+  8006cf:	00 00 00 
+  8006d2:	48 0f 45 c6          	cmovne %rsi,%rax
+  8006d6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006da:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006de:	7e 06                	jle    8006e6 <vprintfmt+0x24b>
+  8006e0:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006e4:	75 14                	jne    8006fa <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006e6:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8006ea:	eb 5b                	jmp    800747 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8006ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f8:	eb c8                	jmp    8006c2 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006fa:	49 63 f7             	movslq %r15d,%rsi
+  8006fd:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800701:	48 b8 a0 0c 80 00 00 	movabs $0x800ca0,%rax
+  800708:	00 00 00 
+  80070b:	ff d0                	call   *%rax
+  80070d:	48 89 c2             	mov    %rax,%rdx
+  800710:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800713:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800715:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800718:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80071b:	85 c0                	test   %eax,%eax
+  80071d:	7e c7                	jle    8006e6 <vprintfmt+0x24b>
+  80071f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800724:	4c 89 ee             	mov    %r13,%rsi
+  800727:	44 89 e7             	mov    %r12d,%edi
+  80072a:	41 ff d6             	call   *%r14
+  80072d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800731:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800734:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800737:	75 eb                	jne    800724 <vprintfmt+0x289>
+  800739:	eb ab                	jmp    8006e6 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80073b:	0f b6 f8             	movzbl %al,%edi
+  80073e:	4c 89 ee             	mov    %r13,%rsi
+  800741:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800744:	4c 89 e2             	mov    %r12,%rdx
+  800747:	45 85 ff             	test   %r15d,%r15d
+  80074a:	78 06                	js     800752 <vprintfmt+0x2b7>
+  80074c:	41 83 ef 01          	sub    $0x1,%r15d
+  800750:	78 23                	js     800775 <vprintfmt+0x2da>
+  800752:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800756:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80075c:	84 c0                	test   %al,%al
+  80075e:	74 15                	je     800775 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800760:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800764:	74 d5                	je     80073b <vprintfmt+0x2a0>
+  800766:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800769:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80076e:	80 fa 5e             	cmp    $0x5e,%dl
+  800771:	77 cb                	ja     80073e <vprintfmt+0x2a3>
+  800773:	eb c6                	jmp    80073b <vprintfmt+0x2a0>
+  800775:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800778:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  80077b:	01 f0                	add    %esi,%eax
+  80077d:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80077f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800783:	85 c0                	test   %eax,%eax
+  800785:	0f 8e 41 fd ff ff    	jle    8004cc <vprintfmt+0x31>
+  80078b:	4c 89 ee             	mov    %r13,%rsi
+  80078e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800793:	41 ff d6             	call   *%r14
+  800796:	41 83 ec 01          	sub    $0x1,%r12d
+  80079a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80079e:	75 eb                	jne    80078b <vprintfmt+0x2f0>
+  8007a0:	e9 27 fd ff ff       	jmp    8004cc <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a5:	40 84 f6             	test   %sil,%sil
+  8007a8:	75 26                	jne    8007d0 <vprintfmt+0x335>
+    switch (lflag) {
+  8007aa:	85 d2                	test   %edx,%edx
+  8007ac:	74 59                	je     800807 <vprintfmt+0x36c>
+  8007ae:	83 fa 01             	cmp    $0x1,%edx
+  8007b1:	74 7b                	je     80082e <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8007b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b9:	0f 87 96 00 00 00    	ja     800855 <vprintfmt+0x3ba>
+  8007bf:	89 c2                	mov    %eax,%edx
+  8007c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c5:	83 c0 08             	add    $0x8,%eax
+  8007c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cb:	4c 8b 22             	mov    (%rdx),%r12
+  8007ce:	eb 17                	jmp    8007e7 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d6:	77 21                	ja     8007f9 <vprintfmt+0x35e>
+  8007d8:	89 c2                	mov    %eax,%edx
+  8007da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007de:	83 c0 08             	add    $0x8,%eax
+  8007e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007e7:	4d 85 e4             	test   %r12,%r12
+  8007ea:	78 7a                	js     800866 <vprintfmt+0x3cb>
+            num = i;
+  8007ec:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007ef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007f4:	e9 b5 02 00 00       	jmp    800aae <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800801:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800805:	eb dd                	jmp    8007e4 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800807:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080a:	83 f8 2f             	cmp    $0x2f,%eax
+  80080d:	77 11                	ja     800820 <vprintfmt+0x385>
+  80080f:	89 c2                	mov    %eax,%edx
+  800811:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800815:	83 c0 08             	add    $0x8,%eax
+  800818:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081b:	4c 63 22             	movslq (%rdx),%r12
+  80081e:	eb c7                	jmp    8007e7 <vprintfmt+0x34c>
+  800820:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800824:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800828:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082c:	eb ed                	jmp    80081b <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80082e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800831:	83 f8 2f             	cmp    $0x2f,%eax
+  800834:	77 11                	ja     800847 <vprintfmt+0x3ac>
+  800836:	89 c2                	mov    %eax,%edx
+  800838:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083c:	83 c0 08             	add    $0x8,%eax
+  80083f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800842:	4c 8b 22             	mov    (%rdx),%r12
+  800845:	eb a0                	jmp    8007e7 <vprintfmt+0x34c>
+  800847:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800853:	eb ed                	jmp    800842 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800855:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800859:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800861:	e9 65 ff ff ff       	jmp    8007cb <vprintfmt+0x330>
+                putch('-', put_arg);
+  800866:	4c 89 ee             	mov    %r13,%rsi
+  800869:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80086e:	41 ff d6             	call   *%r14
+                i = -i;
+  800871:	49 f7 dc             	neg    %r12
+  800874:	e9 73 ff ff ff       	jmp    8007ec <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800879:	40 84 f6             	test   %sil,%sil
+  80087c:	75 32                	jne    8008b0 <vprintfmt+0x415>
+    switch (lflag) {
+  80087e:	85 d2                	test   %edx,%edx
+  800880:	74 5d                	je     8008df <vprintfmt+0x444>
+  800882:	83 fa 01             	cmp    $0x1,%edx
+  800885:	0f 84 82 00 00 00    	je     80090d <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  80088b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088e:	83 f8 2f             	cmp    $0x2f,%eax
+  800891:	0f 87 a5 00 00 00    	ja     80093c <vprintfmt+0x4a1>
+  800897:	89 c2                	mov    %eax,%edx
+  800899:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089d:	83 c0 08             	add    $0x8,%eax
+  8008a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008ab:	e9 fe 01 00 00       	jmp    800aae <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b6:	77 19                	ja     8008d1 <vprintfmt+0x436>
+  8008b8:	89 c2                	mov    %eax,%edx
+  8008ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008be:	83 c0 08             	add    $0x8,%eax
+  8008c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008c7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008cc:	e9 dd 01 00 00       	jmp    800aae <vprintfmt+0x613>
+  8008d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008dd:	eb e5                	jmp    8008c4 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8008df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e5:	77 18                	ja     8008ff <vprintfmt+0x464>
+  8008e7:	89 c2                	mov    %eax,%edx
+  8008e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ed:	83 c0 08             	add    $0x8,%eax
+  8008f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008fa:	e9 af 01 00 00       	jmp    800aae <vprintfmt+0x613>
+  8008ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800903:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800907:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090b:	eb e6                	jmp    8008f3 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80090d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800910:	83 f8 2f             	cmp    $0x2f,%eax
+  800913:	77 19                	ja     80092e <vprintfmt+0x493>
+  800915:	89 c2                	mov    %eax,%edx
+  800917:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091b:	83 c0 08             	add    $0x8,%eax
+  80091e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800921:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800924:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800929:	e9 80 01 00 00       	jmp    800aae <vprintfmt+0x613>
+  80092e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800932:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800936:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093a:	eb e5                	jmp    800921 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80093c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800940:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800944:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800948:	e9 56 ff ff ff       	jmp    8008a3 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80094d:	40 84 f6             	test   %sil,%sil
+  800950:	75 2e                	jne    800980 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800952:	85 d2                	test   %edx,%edx
+  800954:	0f 84 b3 00 00 00    	je     800a0d <vprintfmt+0x572>
+  80095a:	83 fa 01             	cmp    $0x1,%edx
+  80095d:	0f 84 d3 00 00 00    	je     800a36 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800963:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800966:	83 f8 2f             	cmp    $0x2f,%eax
+  800969:	0f 87 f1 00 00 00    	ja     800a60 <vprintfmt+0x5c5>
+  80096f:	89 c2                	mov    %eax,%edx
+  800971:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800975:	83 c0 08             	add    $0x8,%eax
+  800978:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097b:	48 8b 02             	mov    (%rdx),%rax
+  80097e:	eb 17                	jmp    800997 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800980:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800983:	83 f8 2f             	cmp    $0x2f,%eax
+  800986:	77 77                	ja     8009ff <vprintfmt+0x564>
+  800988:	89 c2                	mov    %eax,%edx
+  80098a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098e:	83 c0 08             	add    $0x8,%eax
+  800991:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800994:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800997:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800999:	83 f8 07             	cmp    $0x7,%eax
+  80099c:	0f 8e cf 00 00 00    	jle    800a71 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8009a2:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8009a8:	44 89 e7             	mov    %r12d,%edi
+  8009ab:	41 c1 e4 03          	shl    $0x3,%r12d
+  8009af:	89 d1                	mov    %edx,%ecx
+  8009b1:	8d 72 07             	lea    0x7(%rdx),%esi
+  8009b4:	85 d2                	test   %edx,%edx
+  8009b6:	0f 48 d6             	cmovs  %esi,%edx
+  8009b9:	c1 fa 03             	sar    $0x3,%edx
+  8009bc:	83 f9 3f             	cmp    $0x3f,%ecx
+  8009bf:	7f e7                	jg     8009a8 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8009c1:	85 ff                	test   %edi,%edi
+  8009c3:	0f 84 03 fb ff ff    	je     8004cc <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8009c9:	49 63 f4             	movslq %r12d,%rsi
+  8009cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009d1:	48 f7 f6             	div    %rsi
+  8009d4:	49 89 d7             	mov    %rdx,%r15
+  8009d7:	83 c0 30             	add    $0x30,%eax
+  8009da:	0f be f8             	movsbl %al,%edi
+  8009dd:	4c 89 ee             	mov    %r13,%rsi
+  8009e0:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  8009e3:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  8009e6:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  8009eb:	45 85 e4             	test   %r12d,%r12d
+  8009ee:	41 0f 49 d4          	cmovns %r12d,%edx
+  8009f2:	c1 fa 03             	sar    $0x3,%edx
+  8009f5:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  8009f8:	75 cf                	jne    8009c9 <vprintfmt+0x52e>
+  8009fa:	e9 cd fa ff ff       	jmp    8004cc <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0b:	eb 87                	jmp    800994 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800a0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a10:	83 f8 2f             	cmp    $0x2f,%eax
+  800a13:	77 13                	ja     800a28 <vprintfmt+0x58d>
+  800a15:	89 c2                	mov    %eax,%edx
+  800a17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1b:	83 c0 08             	add    $0x8,%eax
+  800a1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a21:	8b 02                	mov    (%rdx),%eax
+  800a23:	e9 6f ff ff ff       	jmp    800997 <vprintfmt+0x4fc>
+  800a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a34:	eb eb                	jmp    800a21 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800a36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a39:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3c:	77 14                	ja     800a52 <vprintfmt+0x5b7>
+  800a3e:	89 c2                	mov    %eax,%edx
+  800a40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a44:	83 c0 08             	add    $0x8,%eax
+  800a47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4a:	48 8b 02             	mov    (%rdx),%rax
+  800a4d:	e9 45 ff ff ff       	jmp    800997 <vprintfmt+0x4fc>
+  800a52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5e:	eb ea                	jmp    800a4a <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800a60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6c:	e9 0a ff ff ff       	jmp    80097b <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800a71:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800a77:	e9 4d ff ff ff       	jmp    8009c9 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800a7c:	4c 89 ee             	mov    %r13,%rsi
+  800a7f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a84:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a87:	4c 89 ee             	mov    %r13,%rsi
+  800a8a:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a8f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a95:	83 f8 2f             	cmp    $0x2f,%eax
+  800a98:	77 47                	ja     800ae1 <vprintfmt+0x646>
+  800a9a:	89 c2                	mov    %eax,%edx
+  800a9c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa0:	83 c0 08             	add    $0x8,%eax
+  800aa3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800aae:	48 83 ec 08          	sub    $0x8,%rsp
+  800ab2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ab6:	0f 94 c0             	sete   %al
+  800ab9:	0f b6 c0             	movzbl %al,%eax
+  800abc:	50                   	push   %rax
+  800abd:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ac2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ac6:	4c 89 ee             	mov    %r13,%rsi
+  800ac9:	4c 89 f7             	mov    %r14,%rdi
+  800acc:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  800ad3:	00 00 00 
+  800ad6:	ff d0                	call   *%rax
+            break;
+  800ad8:	48 83 c4 10          	add    $0x10,%rsp
+  800adc:	e9 eb f9 ff ff       	jmp    8004cc <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ae1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aed:	eb b7                	jmp    800aa6 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800aef:	40 84 f6             	test   %sil,%sil
+  800af2:	75 2b                	jne    800b1f <vprintfmt+0x684>
+    switch (lflag) {
+  800af4:	85 d2                	test   %edx,%edx
+  800af6:	74 56                	je     800b4e <vprintfmt+0x6b3>
+  800af8:	83 fa 01             	cmp    $0x1,%edx
+  800afb:	74 7f                	je     800b7c <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800afd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b00:	83 f8 2f             	cmp    $0x2f,%eax
+  800b03:	0f 87 a2 00 00 00    	ja     800bab <vprintfmt+0x710>
+  800b09:	89 c2                	mov    %eax,%edx
+  800b0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0f:	83 c0 08             	add    $0x8,%eax
+  800b12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b15:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b18:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b1d:	eb 8f                	jmp    800aae <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800b1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b22:	83 f8 2f             	cmp    $0x2f,%eax
+  800b25:	77 19                	ja     800b40 <vprintfmt+0x6a5>
+  800b27:	89 c2                	mov    %eax,%edx
+  800b29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2d:	83 c0 08             	add    $0x8,%eax
+  800b30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b33:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b36:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b3b:	e9 6e ff ff ff       	jmp    800aae <vprintfmt+0x613>
+  800b40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4c:	eb e5                	jmp    800b33 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800b4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b51:	83 f8 2f             	cmp    $0x2f,%eax
+  800b54:	77 18                	ja     800b6e <vprintfmt+0x6d3>
+  800b56:	89 c2                	mov    %eax,%edx
+  800b58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5c:	83 c0 08             	add    $0x8,%eax
+  800b5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b62:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b64:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b69:	e9 40 ff ff ff       	jmp    800aae <vprintfmt+0x613>
+  800b6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7a:	eb e6                	jmp    800b62 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800b7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b82:	77 19                	ja     800b9d <vprintfmt+0x702>
+  800b84:	89 c2                	mov    %eax,%edx
+  800b86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8a:	83 c0 08             	add    $0x8,%eax
+  800b8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b90:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b93:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b98:	e9 11 ff ff ff       	jmp    800aae <vprintfmt+0x613>
+  800b9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba9:	eb e5                	jmp    800b90 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800bab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800baf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb7:	e9 59 ff ff ff       	jmp    800b15 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800bbc:	4c 89 ee             	mov    %r13,%rsi
+  800bbf:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bc4:	41 ff d6             	call   *%r14
+            break;
+  800bc7:	e9 00 f9 ff ff       	jmp    8004cc <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bcc:	4c 89 ee             	mov    %r13,%rsi
+  800bcf:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bd4:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bd7:	48 83 eb 01          	sub    $0x1,%rbx
+  800bdb:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bdf:	75 f6                	jne    800bd7 <vprintfmt+0x73c>
+  800be1:	e9 e6 f8 ff ff       	jmp    8004cc <vprintfmt+0x31>
+}
+  800be6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bea:	5b                   	pop    %rbx
+  800beb:	41 5c                	pop    %r12
+  800bed:	41 5d                	pop    %r13
+  800bef:	41 5e                	pop    %r14
+  800bf1:	41 5f                	pop    %r15
+  800bf3:	5d                   	pop    %rbp
+  800bf4:	c3                   	ret
+
+0000000000800bf5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bf5:	55                   	push   %rbp
+  800bf6:	48 89 e5             	mov    %rsp,%rbp
+  800bf9:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bfd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c01:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c06:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c0a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c11:	48 85 ff             	test   %rdi,%rdi
+  800c14:	74 2b                	je     800c41 <vsnprintf+0x4c>
+  800c16:	48 85 f6             	test   %rsi,%rsi
+  800c19:	74 26                	je     800c41 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c1b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c1f:	48 bf 46 04 80 00 00 	movabs $0x800446,%rdi
+  800c26:	00 00 00 
+  800c29:	48 b8 9b 04 80 00 00 	movabs $0x80049b,%rax
+  800c30:	00 00 00 
+  800c33:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c39:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c3c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c3f:	c9                   	leave
+  800c40:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c46:	eb f7                	jmp    800c3f <vsnprintf+0x4a>
+
+0000000000800c48 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c48:	55                   	push   %rbp
+  800c49:	48 89 e5             	mov    %rsp,%rbp
+  800c4c:	48 83 ec 50          	sub    $0x50,%rsp
+  800c50:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c54:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c58:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c5c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c63:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c6f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c73:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c77:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  800c7e:	00 00 00 
+  800c81:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c83:	c9                   	leave
+  800c84:	c3                   	ret
+
+0000000000800c85 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c85:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c88:	74 10                	je     800c9a <strlen+0x15>
+    size_t n = 0;
+  800c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c8f:	48 83 c0 01          	add    $0x1,%rax
+  800c93:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c97:	75 f6                	jne    800c8f <strlen+0xa>
+  800c99:	c3                   	ret
+    size_t n = 0;
+  800c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c9f:	c3                   	ret
+
+0000000000800ca0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ca0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ca3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ca8:	48 85 f6             	test   %rsi,%rsi
+  800cab:	74 11                	je     800cbe <strnlen+0x1e>
+  800cad:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cb1:	74 0c                	je     800cbf <strnlen+0x1f>
+  800cb3:	48 83 c2 01          	add    $0x1,%rdx
+  800cb7:	48 39 d0             	cmp    %rdx,%rax
+  800cba:	75 f1                	jne    800cad <strnlen+0xd>
+  800cbc:	eb 04                	jmp    800cc2 <strnlen+0x22>
+  800cbe:	c3                   	ret
+  800cbf:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cc2:	c3                   	ret
+
+0000000000800cc3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cc3:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccb:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ccf:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cd2:	48 83 c2 01          	add    $0x1,%rdx
+  800cd6:	84 c9                	test   %cl,%cl
+  800cd8:	75 f1                	jne    800ccb <strcpy+0x8>
+        ;
+    return res;
+}
+  800cda:	c3                   	ret
+
+0000000000800cdb <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cdb:	55                   	push   %rbp
+  800cdc:	48 89 e5             	mov    %rsp,%rbp
+  800cdf:	41 54                	push   %r12
+  800ce1:	53                   	push   %rbx
+  800ce2:	48 89 fb             	mov    %rdi,%rbx
+  800ce5:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ce8:	48 b8 85 0c 80 00 00 	movabs $0x800c85,%rax
+  800cef:	00 00 00 
+  800cf2:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cf4:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cf8:	4c 89 e6             	mov    %r12,%rsi
+  800cfb:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  800d02:	00 00 00 
+  800d05:	ff d0                	call   *%rax
+    return dst;
+}
+  800d07:	48 89 d8             	mov    %rbx,%rax
+  800d0a:	5b                   	pop    %rbx
+  800d0b:	41 5c                	pop    %r12
+  800d0d:	5d                   	pop    %rbp
+  800d0e:	c3                   	ret
+
+0000000000800d0f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d0f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d12:	48 85 d2             	test   %rdx,%rdx
+  800d15:	74 1f                	je     800d36 <strncpy+0x27>
+  800d17:	48 01 fa             	add    %rdi,%rdx
+  800d1a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d1d:	48 83 c1 01          	add    $0x1,%rcx
+  800d21:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d25:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d29:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d2d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d31:	48 39 ca             	cmp    %rcx,%rdx
+  800d34:	75 e7                	jne    800d1d <strncpy+0xe>
+    }
+    return ret;
+}
+  800d36:	c3                   	ret
+
+0000000000800d37 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d37:	48 89 f8             	mov    %rdi,%rax
+  800d3a:	48 85 d2             	test   %rdx,%rdx
+  800d3d:	74 24                	je     800d63 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d3f:	48 83 ea 01          	sub    $0x1,%rdx
+  800d43:	74 1b                	je     800d60 <strlcpy+0x29>
+  800d45:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d49:	0f b6 16             	movzbl (%rsi),%edx
+  800d4c:	84 d2                	test   %dl,%dl
+  800d4e:	74 10                	je     800d60 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d50:	48 83 c6 01          	add    $0x1,%rsi
+  800d54:	48 83 c0 01          	add    $0x1,%rax
+  800d58:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d5b:	48 39 c8             	cmp    %rcx,%rax
+  800d5e:	75 e9                	jne    800d49 <strlcpy+0x12>
+        *dst = '\0';
+  800d60:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d63:	48 29 f8             	sub    %rdi,%rax
+}
+  800d66:	c3                   	ret
+
+0000000000800d67 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d67:	0f b6 07             	movzbl (%rdi),%eax
+  800d6a:	84 c0                	test   %al,%al
+  800d6c:	74 13                	je     800d81 <strcmp+0x1a>
+  800d6e:	38 06                	cmp    %al,(%rsi)
+  800d70:	75 0f                	jne    800d81 <strcmp+0x1a>
+  800d72:	48 83 c7 01          	add    $0x1,%rdi
+  800d76:	48 83 c6 01          	add    $0x1,%rsi
+  800d7a:	0f b6 07             	movzbl (%rdi),%eax
+  800d7d:	84 c0                	test   %al,%al
+  800d7f:	75 ed                	jne    800d6e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d81:	0f b6 c0             	movzbl %al,%eax
+  800d84:	0f b6 16             	movzbl (%rsi),%edx
+  800d87:	29 d0                	sub    %edx,%eax
+}
+  800d89:	c3                   	ret
+
+0000000000800d8a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d8a:	48 85 d2             	test   %rdx,%rdx
+  800d8d:	74 1f                	je     800dae <strncmp+0x24>
+  800d8f:	0f b6 07             	movzbl (%rdi),%eax
+  800d92:	84 c0                	test   %al,%al
+  800d94:	74 1e                	je     800db4 <strncmp+0x2a>
+  800d96:	3a 06                	cmp    (%rsi),%al
+  800d98:	75 1a                	jne    800db4 <strncmp+0x2a>
+  800d9a:	48 83 c7 01          	add    $0x1,%rdi
+  800d9e:	48 83 c6 01          	add    $0x1,%rsi
+  800da2:	48 83 ea 01          	sub    $0x1,%rdx
+  800da6:	75 e7                	jne    800d8f <strncmp+0x5>
+
+    if (!n) return 0;
+  800da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dad:	c3                   	ret
+  800dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db3:	c3                   	ret
+  800db4:	48 85 d2             	test   %rdx,%rdx
+  800db7:	74 09                	je     800dc2 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800db9:	0f b6 07             	movzbl (%rdi),%eax
+  800dbc:	0f b6 16             	movzbl (%rsi),%edx
+  800dbf:	29 d0                	sub    %edx,%eax
+  800dc1:	c3                   	ret
+    if (!n) return 0;
+  800dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dc7:	c3                   	ret
+
+0000000000800dc8 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800dc8:	0f b6 17             	movzbl (%rdi),%edx
+  800dcb:	84 d2                	test   %dl,%dl
+  800dcd:	74 18                	je     800de7 <strchr+0x1f>
+        if (*str == c) {
+  800dcf:	0f be d2             	movsbl %dl,%edx
+  800dd2:	39 f2                	cmp    %esi,%edx
+  800dd4:	74 17                	je     800ded <strchr+0x25>
+    for (; *str; str++) {
+  800dd6:	48 83 c7 01          	add    $0x1,%rdi
+  800dda:	0f b6 17             	movzbl (%rdi),%edx
+  800ddd:	84 d2                	test   %dl,%dl
+  800ddf:	75 ee                	jne    800dcf <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de6:	c3                   	ret
+  800de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dec:	c3                   	ret
+  800ded:	48 89 f8             	mov    %rdi,%rax
+}
+  800df0:	c3                   	ret
+
+0000000000800df1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800df1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800df4:	0f b6 17             	movzbl (%rdi),%edx
+  800df7:	84 d2                	test   %dl,%dl
+  800df9:	74 13                	je     800e0e <strfind+0x1d>
+  800dfb:	0f be d2             	movsbl %dl,%edx
+  800dfe:	39 f2                	cmp    %esi,%edx
+  800e00:	74 0b                	je     800e0d <strfind+0x1c>
+  800e02:	48 83 c0 01          	add    $0x1,%rax
+  800e06:	0f b6 10             	movzbl (%rax),%edx
+  800e09:	84 d2                	test   %dl,%dl
+  800e0b:	75 ee                	jne    800dfb <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e0d:	c3                   	ret
+  800e0e:	c3                   	ret
+
+0000000000800e0f <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800e0f:	55                   	push   %rbp
+  800e10:	48 89 e5             	mov    %rsp,%rbp
+  800e13:	41 57                	push   %r15
+  800e15:	41 56                	push   %r14
+  800e17:	41 55                	push   %r13
+  800e19:	41 54                	push   %r12
+  800e1b:	53                   	push   %rbx
+  800e1c:	48 83 ec 08          	sub    $0x8,%rsp
+  800e20:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800e23:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800e27:	45 84 ed             	test   %r13b,%r13b
+  800e2a:	75 12                	jne    800e3e <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800e2c:	4c 89 f8             	mov    %r15,%rax
+  800e2f:	48 83 c4 08          	add    $0x8,%rsp
+  800e33:	5b                   	pop    %rbx
+  800e34:	41 5c                	pop    %r12
+  800e36:	41 5d                	pop    %r13
+  800e38:	41 5e                	pop    %r14
+  800e3a:	41 5f                	pop    %r15
+  800e3c:	5d                   	pop    %rbp
+  800e3d:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800e3e:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800e42:	4c 89 e7             	mov    %r12,%rdi
+  800e45:	48 b8 85 0c 80 00 00 	movabs $0x800c85,%rax
+  800e4c:	00 00 00 
+  800e4f:	ff d0                	call   *%rax
+  800e51:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800e54:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800e58:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800e5c:	49 bf 8a 0d 80 00 00 	movabs $0x800d8a,%r15
+  800e63:	00 00 00 
+				if ((sc = *s++) == 0)
+  800e66:	84 c0                	test   %al,%al
+  800e68:	75 14                	jne    800e7e <strstr+0x6f>
+					return NULL;
+  800e6a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e70:	eb ba                	jmp    800e2c <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800e72:	48 83 c3 01          	add    $0x1,%rbx
+  800e76:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800e7a:	84 c0                	test   %al,%al
+  800e7c:	74 1b                	je     800e99 <strstr+0x8a>
+			} while (sc != c);
+  800e7e:	41 38 c5             	cmp    %al,%r13b
+  800e81:	75 ef                	jne    800e72 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800e83:	4c 89 f2             	mov    %r14,%rdx
+  800e86:	4c 89 e6             	mov    %r12,%rsi
+  800e89:	48 89 df             	mov    %rbx,%rdi
+  800e8c:	41 ff d7             	call   *%r15
+  800e8f:	85 c0                	test   %eax,%eax
+  800e91:	75 df                	jne    800e72 <strstr+0x63>
+  800e93:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800e97:	eb 93                	jmp    800e2c <strstr+0x1d>
+					return NULL;
+  800e99:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e9f:	eb 8b                	jmp    800e2c <strstr+0x1d>
+
+0000000000800ea1 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800ea1:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800ea3:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800ea6:	8d 57 20             	lea    0x20(%rdi),%edx
+  800ea9:	83 f9 1a             	cmp    $0x1a,%ecx
+  800eac:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800eaf:	c3                   	ret
+
+0000000000800eb0 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800eb0:	55                   	push   %rbp
+  800eb1:	48 89 e5             	mov    %rsp,%rbp
+  800eb4:	41 57                	push   %r15
+  800eb6:	41 56                	push   %r14
+  800eb8:	41 55                	push   %r13
+  800eba:	41 54                	push   %r12
+  800ebc:	53                   	push   %rbx
+  800ebd:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800ec1:	48 39 f7             	cmp    %rsi,%rdi
+  800ec4:	74 49                	je     800f0f <strcasecmp+0x5f>
+  800ec6:	49 89 fd             	mov    %rdi,%r13
+  800ec9:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800ecc:	49 bf a1 0e 80 00 00 	movabs $0x800ea1,%r15
+  800ed3:	00 00 00 
+  800ed6:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800edb:	41 0f b6 fe          	movzbl %r14b,%edi
+  800edf:	41 ff d7             	call   *%r15
+  800ee2:	89 c3                	mov    %eax,%ebx
+  800ee4:	49 83 c4 01          	add    $0x1,%r12
+  800ee8:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800eee:	41 ff d7             	call   *%r15
+  800ef1:	29 c3                	sub    %eax,%ebx
+  800ef3:	75 09                	jne    800efe <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800ef5:	49 83 c5 01          	add    $0x1,%r13
+  800ef9:	45 84 f6             	test   %r14b,%r14b
+  800efc:	75 d8                	jne    800ed6 <strcasecmp+0x26>
+}
+  800efe:	89 d8                	mov    %ebx,%eax
+  800f00:	48 83 c4 08          	add    $0x8,%rsp
+  800f04:	5b                   	pop    %rbx
+  800f05:	41 5c                	pop    %r12
+  800f07:	41 5d                	pop    %r13
+  800f09:	41 5e                	pop    %r14
+  800f0b:	41 5f                	pop    %r15
+  800f0d:	5d                   	pop    %rbp
+  800f0e:	c3                   	ret
+        return 0;
+  800f0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f14:	eb e8                	jmp    800efe <strcasecmp+0x4e>
+
+0000000000800f16 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800f16:	55                   	push   %rbp
+  800f17:	48 89 e5             	mov    %rsp,%rbp
+  800f1a:	41 57                	push   %r15
+  800f1c:	41 56                	push   %r14
+  800f1e:	41 55                	push   %r13
+  800f20:	41 54                	push   %r12
+  800f22:	53                   	push   %rbx
+  800f23:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800f27:	48 85 d2             	test   %rdx,%rdx
+  800f2a:	74 4f                	je     800f7b <strncasecmp+0x65>
+  800f2c:	49 89 fc             	mov    %rdi,%r12
+  800f2f:	49 89 f5             	mov    %rsi,%r13
+  800f32:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800f36:	49 be a1 0e 80 00 00 	movabs $0x800ea1,%r14
+  800f3d:	00 00 00 
+  800f40:	49 83 c4 01          	add    $0x1,%r12
+  800f44:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800f4a:	41 ff d6             	call   *%r14
+  800f4d:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800f4f:	49 83 c5 01          	add    $0x1,%r13
+  800f53:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800f58:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800f5b:	29 c3                	sub    %eax,%ebx
+  800f5d:	85 c0                	test   %eax,%eax
+  800f5f:	74 09                	je     800f6a <strncasecmp+0x54>
+  800f61:	85 db                	test   %ebx,%ebx
+  800f63:	75 05                	jne    800f6a <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800f65:	4d 39 fc             	cmp    %r15,%r12
+  800f68:	75 d6                	jne    800f40 <strncasecmp+0x2a>
+}
+  800f6a:	89 d8                	mov    %ebx,%eax
+  800f6c:	48 83 c4 08          	add    $0x8,%rsp
+  800f70:	5b                   	pop    %rbx
+  800f71:	41 5c                	pop    %r12
+  800f73:	41 5d                	pop    %r13
+  800f75:	41 5e                	pop    %r14
+  800f77:	41 5f                	pop    %r15
+  800f79:	5d                   	pop    %rbp
+  800f7a:	c3                   	ret
+    int d = 0;
+  800f7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800f80:	eb e8                	jmp    800f6a <strncasecmp+0x54>
+
+0000000000800f82 <toupper>:
+
+int toupper(int c) {
+  800f82:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800f84:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800f87:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800f8a:	83 f9 1a             	cmp    $0x1a,%ecx
+  800f8d:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800f90:	c3                   	ret
+
+0000000000800f91 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800f91:	83 ff 20             	cmp    $0x20,%edi
+  800f94:	0f 94 c0             	sete   %al
+  800f97:	0f b6 c0             	movzbl %al,%eax
+}
+  800f9a:	c3                   	ret
+
+0000000000800f9b <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800f9b:	89 f8                	mov    %edi,%eax
+  800f9d:	f7 d8                	neg    %eax
+  800f9f:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800fa2:	c3                   	ret
+
+0000000000800fa3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fa3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fa6:	48 89 f8             	mov    %rdi,%rax
+  800fa9:	48 f7 d8             	neg    %rax
+  800fac:	83 e0 07             	and    $0x7,%eax
+  800faf:	49 89 d1             	mov    %rdx,%r9
+  800fb2:	49 29 c1             	sub    %rax,%r9
+  800fb5:	78 36                	js     800fed <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fb7:	40 0f b6 c6          	movzbl %sil,%eax
+  800fbb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fc2:	01 01 01 
+  800fc5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fc9:	40 f6 c7 07          	test   $0x7,%dil
+  800fcd:	75 38                	jne    801007 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fcf:	4c 89 c9             	mov    %r9,%rcx
+  800fd2:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fd6:	74 0c                	je     800fe4 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fd8:	fc                   	cld
+  800fd9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fdc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fe0:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fe4:	4d 85 c9             	test   %r9,%r9
+  800fe7:	75 45                	jne    80102e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fe9:	4c 89 c0             	mov    %r8,%rax
+  800fec:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fed:	48 85 d2             	test   %rdx,%rdx
+  800ff0:	74 f7                	je     800fe9 <memset+0x46>
+  800ff2:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ff5:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ff8:	48 83 c0 01          	add    $0x1,%rax
+  800ffc:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801000:	48 39 c2             	cmp    %rax,%rdx
+  801003:	75 f3                	jne    800ff8 <memset+0x55>
+  801005:	eb e2                	jmp    800fe9 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801007:	40 f6 c7 01          	test   $0x1,%dil
+  80100b:	74 06                	je     801013 <memset+0x70>
+  80100d:	88 07                	mov    %al,(%rdi)
+  80100f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801013:	40 f6 c7 02          	test   $0x2,%dil
+  801017:	74 07                	je     801020 <memset+0x7d>
+  801019:	66 89 07             	mov    %ax,(%rdi)
+  80101c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801020:	40 f6 c7 04          	test   $0x4,%dil
+  801024:	74 a9                	je     800fcf <memset+0x2c>
+  801026:	89 07                	mov    %eax,(%rdi)
+  801028:	48 83 c7 04          	add    $0x4,%rdi
+  80102c:	eb a1                	jmp    800fcf <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80102e:	41 f6 c1 04          	test   $0x4,%r9b
+  801032:	74 06                	je     80103a <memset+0x97>
+  801034:	89 07                	mov    %eax,(%rdi)
+  801036:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80103a:	41 f6 c1 02          	test   $0x2,%r9b
+  80103e:	74 07                	je     801047 <memset+0xa4>
+  801040:	66 89 07             	mov    %ax,(%rdi)
+  801043:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801047:	41 f6 c1 01          	test   $0x1,%r9b
+  80104b:	74 9c                	je     800fe9 <memset+0x46>
+  80104d:	88 07                	mov    %al,(%rdi)
+  80104f:	eb 98                	jmp    800fe9 <memset+0x46>
+
+0000000000801051 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801051:	48 89 f8             	mov    %rdi,%rax
+  801054:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801057:	48 39 fe             	cmp    %rdi,%rsi
+  80105a:	73 3b                	jae    801097 <memmove+0x46>
+  80105c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801060:	48 39 d7             	cmp    %rdx,%rdi
+  801063:	73 32                	jae    801097 <memmove+0x46>
+        s += n;
+        d += n;
+  801065:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801069:	48 89 d6             	mov    %rdx,%rsi
+  80106c:	48 09 fe             	or     %rdi,%rsi
+  80106f:	48 09 ce             	or     %rcx,%rsi
+  801072:	40 f6 c6 07          	test   $0x7,%sil
+  801076:	75 12                	jne    80108a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801078:	48 83 ef 08          	sub    $0x8,%rdi
+  80107c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801080:	48 c1 e9 03          	shr    $0x3,%rcx
+  801084:	fd                   	std
+  801085:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801088:	fc                   	cld
+  801089:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80108a:	48 83 ef 01          	sub    $0x1,%rdi
+  80108e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801092:	fd                   	std
+  801093:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801095:	eb f1                	jmp    801088 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801097:	48 89 f2             	mov    %rsi,%rdx
+  80109a:	48 09 c2             	or     %rax,%rdx
+  80109d:	48 09 ca             	or     %rcx,%rdx
+  8010a0:	f6 c2 07             	test   $0x7,%dl
+  8010a3:	75 0c                	jne    8010b1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010a5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010a9:	48 89 c7             	mov    %rax,%rdi
+  8010ac:	fc                   	cld
+  8010ad:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010b0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010b1:	48 89 c7             	mov    %rax,%rdi
+  8010b4:	fc                   	cld
+  8010b5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010b7:	c3                   	ret
+
+00000000008010b8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010b8:	55                   	push   %rbp
+  8010b9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010bc:	48 b8 51 10 80 00 00 	movabs $0x801051,%rax
+  8010c3:	00 00 00 
+  8010c6:	ff d0                	call   *%rax
+}
+  8010c8:	5d                   	pop    %rbp
+  8010c9:	c3                   	ret
+
+00000000008010ca <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010ca:	55                   	push   %rbp
+  8010cb:	48 89 e5             	mov    %rsp,%rbp
+  8010ce:	41 57                	push   %r15
+  8010d0:	41 56                	push   %r14
+  8010d2:	41 55                	push   %r13
+  8010d4:	41 54                	push   %r12
+  8010d6:	53                   	push   %rbx
+  8010d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8010db:	49 89 fe             	mov    %rdi,%r14
+  8010de:	49 89 f7             	mov    %rsi,%r15
+  8010e1:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010e4:	48 89 f7             	mov    %rsi,%rdi
+  8010e7:	48 b8 85 0c 80 00 00 	movabs $0x800c85,%rax
+  8010ee:	00 00 00 
+  8010f1:	ff d0                	call   *%rax
+  8010f3:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010f6:	48 89 de             	mov    %rbx,%rsi
+  8010f9:	4c 89 f7             	mov    %r14,%rdi
+  8010fc:	48 b8 a0 0c 80 00 00 	movabs $0x800ca0,%rax
+  801103:	00 00 00 
+  801106:	ff d0                	call   *%rax
+  801108:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80110b:	48 39 c3             	cmp    %rax,%rbx
+  80110e:	74 36                	je     801146 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801110:	48 89 d8             	mov    %rbx,%rax
+  801113:	4c 29 e8             	sub    %r13,%rax
+  801116:	49 39 c4             	cmp    %rax,%r12
+  801119:	73 31                	jae    80114c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80111b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801120:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801124:	4c 89 fe             	mov    %r15,%rsi
+  801127:	48 b8 b8 10 80 00 00 	movabs $0x8010b8,%rax
+  80112e:	00 00 00 
+  801131:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801133:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801137:	48 83 c4 08          	add    $0x8,%rsp
+  80113b:	5b                   	pop    %rbx
+  80113c:	41 5c                	pop    %r12
+  80113e:	41 5d                	pop    %r13
+  801140:	41 5e                	pop    %r14
+  801142:	41 5f                	pop    %r15
+  801144:	5d                   	pop    %rbp
+  801145:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801146:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80114a:	eb eb                	jmp    801137 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80114c:	48 83 eb 01          	sub    $0x1,%rbx
+  801150:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801154:	48 89 da             	mov    %rbx,%rdx
+  801157:	4c 89 fe             	mov    %r15,%rsi
+  80115a:	48 b8 b8 10 80 00 00 	movabs $0x8010b8,%rax
+  801161:	00 00 00 
+  801164:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801166:	49 01 de             	add    %rbx,%r14
+  801169:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80116e:	eb c3                	jmp    801133 <strlcat+0x69>
+
+0000000000801170 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801170:	48 85 d2             	test   %rdx,%rdx
+  801173:	74 2d                	je     8011a2 <memcmp+0x32>
+  801175:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80117a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80117e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801183:	44 38 c1             	cmp    %r8b,%cl
+  801186:	75 0f                	jne    801197 <memcmp+0x27>
+    while (n-- > 0) {
+  801188:	48 83 c0 01          	add    $0x1,%rax
+  80118c:	48 39 c2             	cmp    %rax,%rdx
+  80118f:	75 e9                	jne    80117a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801191:	b8 00 00 00 00       	mov    $0x0,%eax
+  801196:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801197:	0f b6 c1             	movzbl %cl,%eax
+  80119a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80119e:	44 29 c0             	sub    %r8d,%eax
+  8011a1:	c3                   	ret
+    return 0;
+  8011a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a7:	c3                   	ret
+
+00000000008011a8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011a8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011ac:	48 39 c7             	cmp    %rax,%rdi
+  8011af:	73 0f                	jae    8011c0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011b1:	40 38 37             	cmp    %sil,(%rdi)
+  8011b4:	74 0e                	je     8011c4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8011b6:	48 83 c7 01          	add    $0x1,%rdi
+  8011ba:	48 39 f8             	cmp    %rdi,%rax
+  8011bd:	75 f2                	jne    8011b1 <memfind+0x9>
+  8011bf:	c3                   	ret
+  8011c0:	48 89 f8             	mov    %rdi,%rax
+  8011c3:	c3                   	ret
+  8011c4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011c7:	c3                   	ret
+
+00000000008011c8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011c8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011cb:	0f b6 37             	movzbl (%rdi),%esi
+  8011ce:	40 80 fe 20          	cmp    $0x20,%sil
+  8011d2:	74 06                	je     8011da <strtol+0x12>
+  8011d4:	40 80 fe 09          	cmp    $0x9,%sil
+  8011d8:	75 13                	jne    8011ed <strtol+0x25>
+  8011da:	48 83 c7 01          	add    $0x1,%rdi
+  8011de:	0f b6 37             	movzbl (%rdi),%esi
+  8011e1:	40 80 fe 20          	cmp    $0x20,%sil
+  8011e5:	74 f3                	je     8011da <strtol+0x12>
+  8011e7:	40 80 fe 09          	cmp    $0x9,%sil
+  8011eb:	74 ed                	je     8011da <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011ed:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011f0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011f3:	3c 01                	cmp    $0x1,%al
+  8011f5:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011f9:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011ff:	75 0f                	jne    801210 <strtol+0x48>
+  801201:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801204:	74 14                	je     80121a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801206:	85 d2                	test   %edx,%edx
+  801208:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80120d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801210:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801215:	4c 63 ca             	movslq %edx,%r9
+  801218:	eb 36                	jmp    801250 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80121a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80121e:	74 0f                	je     80122f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801220:	85 d2                	test   %edx,%edx
+  801222:	75 ec                	jne    801210 <strtol+0x48>
+        s++;
+  801224:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801228:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80122d:	eb e1                	jmp    801210 <strtol+0x48>
+        s += 2;
+  80122f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801233:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801238:	eb d6                	jmp    801210 <strtol+0x48>
+            dig -= '0';
+  80123a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80123d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801241:	41 39 d0             	cmp    %edx,%r8d
+  801244:	7d 21                	jge    801267 <strtol+0x9f>
+        val = val * base + dig;
+  801246:	49 0f af c1          	imul   %r9,%rax
+  80124a:	0f b6 c9             	movzbl %cl,%ecx
+  80124d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801250:	48 83 c7 01          	add    $0x1,%rdi
+  801254:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801258:	80 f9 39             	cmp    $0x39,%cl
+  80125b:	76 dd                	jbe    80123a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80125d:	80 f9 7b             	cmp    $0x7b,%cl
+  801260:	77 05                	ja     801267 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801262:	83 e9 57             	sub    $0x57,%ecx
+  801265:	eb d6                	jmp    80123d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801267:	4d 85 d2             	test   %r10,%r10
+  80126a:	74 03                	je     80126f <strtol+0xa7>
+  80126c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80126f:	48 89 c2             	mov    %rax,%rdx
+  801272:	48 f7 da             	neg    %rdx
+  801275:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801279:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80127d:	c3                   	ret
+
+000000000080127e <atoi>:
+int atoi(const char *str) {
+  80127e:	55                   	push   %rbp
+  80127f:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801282:	ba 00 00 00 00       	mov    $0x0,%edx
+  801287:	be 00 00 00 00       	mov    $0x0,%esi
+  80128c:	48 b8 c8 11 80 00 00 	movabs $0x8011c8,%rax
+  801293:	00 00 00 
+  801296:	ff d0                	call   *%rax
+}
+  801298:	5d                   	pop    %rbp
+  801299:	c3                   	ret
+
+000000000080129a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80129a:	55                   	push   %rbp
+  80129b:	48 89 e5             	mov    %rsp,%rbp
+  80129e:	53                   	push   %rbx
+  80129f:	48 89 fa             	mov    %rdi,%rdx
+  8012a2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a5:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012bf:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c5:	c9                   	leave
+  8012c6:	c3                   	ret
+
+00000000008012c7 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012c7:	55                   	push   %rbp
+  8012c8:	48 89 e5             	mov    %rsp,%rbp
+  8012cb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012cc:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f0:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f6:	c9                   	leave
+  8012f7:	c3                   	ret
+
+00000000008012f8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012f8:	55                   	push   %rbp
+  8012f9:	48 89 e5             	mov    %rsp,%rbp
+  8012fc:	53                   	push   %rbx
+  8012fd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801301:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801304:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801309:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80130e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801313:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801318:	be 00 00 00 00       	mov    $0x0,%esi
+  80131d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801323:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801325:	48 85 c0             	test   %rax,%rax
+  801328:	7f 06                	jg     801330 <sys_env_destroy+0x38>
+}
+  80132a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80132e:	c9                   	leave
+  80132f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801330:	49 89 c0             	mov    %rax,%r8
+  801333:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801338:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  80133f:	00 00 00 
+  801342:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801347:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  80134e:	00 00 00 
+  801351:	b8 00 00 00 00       	mov    $0x0,%eax
+  801356:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  80135d:	00 00 00 
+  801360:	41 ff d1             	call   *%r9
+
+0000000000801363 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801363:	55                   	push   %rbp
+  801364:	48 89 e5             	mov    %rsp,%rbp
+  801367:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801368:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80136d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801372:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801377:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801381:	be 00 00 00 00       	mov    $0x0,%esi
+  801386:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80138e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801392:	c9                   	leave
+  801393:	c3                   	ret
+
+0000000000801394 <sys_yield>:
+
+void
+sys_yield(void) {
+  801394:	55                   	push   %rbp
+  801395:	48 89 e5             	mov    %rsp,%rbp
+  801398:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801399:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80139e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013bd:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c3:	c9                   	leave
+  8013c4:	c3                   	ret
+
+00000000008013c5 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013c5:	55                   	push   %rbp
+  8013c6:	48 89 e5             	mov    %rsp,%rbp
+  8013c9:	53                   	push   %rbx
+  8013ca:	48 89 fa             	mov    %rdi,%rdx
+  8013cd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d5:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013dc:	00 00 00 
+  8013df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ef:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f5:	c9                   	leave
+  8013f6:	c3                   	ret
+
+00000000008013f7 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013f7:	55                   	push   %rbp
+  8013f8:	48 89 e5             	mov    %rsp,%rbp
+  8013fb:	53                   	push   %rbx
+  8013fc:	49 89 f8             	mov    %rdi,%r8
+  8013ff:	48 89 d3             	mov    %rdx,%rbx
+  801402:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801405:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140a:	4c 89 c2             	mov    %r8,%rdx
+  80140d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801410:	be 00 00 00 00       	mov    $0x0,%esi
+  801415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80141d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801421:	c9                   	leave
+  801422:	c3                   	ret
+
+0000000000801423 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801423:	55                   	push   %rbp
+  801424:	48 89 e5             	mov    %rsp,%rbp
+  801427:	53                   	push   %rbx
+  801428:	48 83 ec 08          	sub    $0x8,%rsp
+  80142c:	89 f8                	mov    %edi,%eax
+  80142e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801431:	48 63 f9             	movslq %ecx,%rdi
+  801434:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801437:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80143c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143f:	be 00 00 00 00       	mov    $0x0,%esi
+  801444:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144c:	48 85 c0             	test   %rax,%rax
+  80144f:	7f 06                	jg     801457 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801451:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801455:	c9                   	leave
+  801456:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801457:	49 89 c0             	mov    %rax,%r8
+  80145a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80145f:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801466:	00 00 00 
+  801469:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80146e:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801475:	00 00 00 
+  801478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147d:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  801484:	00 00 00 
+  801487:	41 ff d1             	call   *%r9
+
+000000000080148a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80148a:	55                   	push   %rbp
+  80148b:	48 89 e5             	mov    %rsp,%rbp
+  80148e:	53                   	push   %rbx
+  80148f:	48 83 ec 08          	sub    $0x8,%rsp
+  801493:	89 f8                	mov    %edi,%eax
+  801495:	49 89 f2             	mov    %rsi,%r10
+  801498:	48 89 cf             	mov    %rcx,%rdi
+  80149b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80149e:	48 63 da             	movslq %edx,%rbx
+  8014a1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a4:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a9:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ac:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014af:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b1:	48 85 c0             	test   %rax,%rax
+  8014b4:	7f 06                	jg     8014bc <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ba:	c9                   	leave
+  8014bb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014bc:	49 89 c0             	mov    %rax,%r8
+  8014bf:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014c4:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8014cb:	00 00 00 
+  8014ce:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014d3:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  8014da:	00 00 00 
+  8014dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e2:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  8014e9:	00 00 00 
+  8014ec:	41 ff d1             	call   *%r9
+
+00000000008014ef <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014ef:	55                   	push   %rbp
+  8014f0:	48 89 e5             	mov    %rsp,%rbp
+  8014f3:	53                   	push   %rbx
+  8014f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f8:	49 89 f9             	mov    %rdi,%r9
+  8014fb:	89 f0                	mov    %esi,%eax
+  8014fd:	48 89 d3             	mov    %rdx,%rbx
+  801500:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801503:	49 63 f0             	movslq %r8d,%rsi
+  801506:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801509:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80150e:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801511:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801517:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801519:	48 85 c0             	test   %rax,%rax
+  80151c:	7f 06                	jg     801524 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80151e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801522:	c9                   	leave
+  801523:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801524:	49 89 c0             	mov    %rax,%r8
+  801527:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80152c:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801533:	00 00 00 
+  801536:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80153b:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801542:	00 00 00 
+  801545:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154a:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  801551:	00 00 00 
+  801554:	41 ff d1             	call   *%r9
+
+0000000000801557 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801557:	55                   	push   %rbp
+  801558:	48 89 e5             	mov    %rsp,%rbp
+  80155b:	53                   	push   %rbx
+  80155c:	89 f8                	mov    %edi,%eax
+  80155e:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801561:	48 63 f9             	movslq %ecx,%rdi
+  801564:	48 63 da             	movslq %edx,%rbx
+  801567:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80156f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801572:	be 00 00 00 00       	mov    $0x0,%esi
+  801577:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157d:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80157f:	89 c2                	mov    %eax,%edx
+  801581:	48 85 c0             	test   %rax,%rax
+  801584:	78 0d                	js     801593 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801586:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80158b:	4d 85 c9             	test   %r9,%r9
+  80158e:	74 03                	je     801593 <sys_alloc_dma_region+0x3c>
+  801590:	49 89 01             	mov    %rax,(%r9)
+}
+  801593:	89 d0                	mov    %edx,%eax
+  801595:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801599:	c9                   	leave
+  80159a:	c3                   	ret
+
+000000000080159b <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80159b:	55                   	push   %rbp
+  80159c:	48 89 e5             	mov    %rsp,%rbp
+  80159f:	53                   	push   %rbx
+  8015a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a4:	48 89 f1             	mov    %rsi,%rcx
+  8015a7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ad:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c4:	48 85 c0             	test   %rax,%rax
+  8015c7:	7f 06                	jg     8015cf <sys_set_cache_region+0x34>
+}
+  8015c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cd:	c9                   	leave
+  8015ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015cf:	49 89 c0             	mov    %rax,%r8
+  8015d2:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8015d7:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8015de:	00 00 00 
+  8015e1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015e6:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  8015ed:	00 00 00 
+  8015f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f5:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  8015fc:	00 00 00 
+  8015ff:	41 ff d1             	call   *%r9
+
+0000000000801602 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801602:	55                   	push   %rbp
+  801603:	48 89 e5             	mov    %rsp,%rbp
+  801606:	53                   	push   %rbx
+  801607:	48 83 ec 08          	sub    $0x8,%rsp
+  80160b:	48 89 f1             	mov    %rsi,%rcx
+  80160e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801611:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801614:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801619:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80161e:	be 00 00 00 00       	mov    $0x0,%esi
+  801623:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801629:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80162b:	48 85 c0             	test   %rax,%rax
+  80162e:	7f 06                	jg     801636 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801630:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801634:	c9                   	leave
+  801635:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801636:	49 89 c0             	mov    %rax,%r8
+  801639:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80163e:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801645:	00 00 00 
+  801648:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80164d:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801654:	00 00 00 
+  801657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165c:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  801663:	00 00 00 
+  801666:	41 ff d1             	call   *%r9
+
+0000000000801669 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801669:	55                   	push   %rbp
+  80166a:	48 89 e5             	mov    %rsp,%rbp
+  80166d:	53                   	push   %rbx
+  80166e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801672:	48 63 ce             	movslq %esi,%rcx
+  801675:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801678:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801682:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801687:	be 00 00 00 00       	mov    $0x0,%esi
+  80168c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801692:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801694:	48 85 c0             	test   %rax,%rax
+  801697:	7f 06                	jg     80169f <sys_env_set_status+0x36>
+}
+  801699:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169d:	c9                   	leave
+  80169e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169f:	49 89 c0             	mov    %rax,%r8
+  8016a2:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8016a7:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8016ae:	00 00 00 
+  8016b1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016b6:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  8016bd:	00 00 00 
+  8016c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c5:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  8016cc:	00 00 00 
+  8016cf:	41 ff d1             	call   *%r9
+
+00000000008016d2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016d2:	55                   	push   %rbp
+  8016d3:	48 89 e5             	mov    %rsp,%rbp
+  8016d6:	53                   	push   %rbx
+  8016d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8016db:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016de:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016fd:	48 85 c0             	test   %rax,%rax
+  801700:	7f 06                	jg     801708 <sys_env_set_trapframe+0x36>
+}
+  801702:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801706:	c9                   	leave
+  801707:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801708:	49 89 c0             	mov    %rax,%r8
+  80170b:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801710:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801717:	00 00 00 
+  80171a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80171f:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801726:	00 00 00 
+  801729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172e:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  801735:	00 00 00 
+  801738:	41 ff d1             	call   *%r9
+
+000000000080173b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80173b:	55                   	push   %rbp
+  80173c:	48 89 e5             	mov    %rsp,%rbp
+  80173f:	53                   	push   %rbx
+  801740:	48 83 ec 08          	sub    $0x8,%rsp
+  801744:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801747:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80174a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801754:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801759:	be 00 00 00 00       	mov    $0x0,%esi
+  80175e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801764:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801766:	48 85 c0             	test   %rax,%rax
+  801769:	7f 06                	jg     801771 <sys_env_set_pgfault_upcall+0x36>
+}
+  80176b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176f:	c9                   	leave
+  801770:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801771:	49 89 c0             	mov    %rax,%r8
+  801774:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801779:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801780:	00 00 00 
+  801783:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801788:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  80178f:	00 00 00 
+  801792:	b8 00 00 00 00       	mov    $0x0,%eax
+  801797:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  80179e:	00 00 00 
+  8017a1:	41 ff d1             	call   *%r9
+
+00000000008017a4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017a4:	55                   	push   %rbp
+  8017a5:	48 89 e5             	mov    %rsp,%rbp
+  8017a8:	53                   	push   %rbx
+  8017a9:	89 f8                	mov    %edi,%eax
+  8017ab:	49 89 f1             	mov    %rsi,%r9
+  8017ae:	48 89 d3             	mov    %rdx,%rbx
+  8017b1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017b4:	49 63 f0             	movslq %r8d,%rsi
+  8017b7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ba:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017bf:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c8:	cd 30                	int    $0x30
+}
+  8017ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ce:	c9                   	leave
+  8017cf:	c3                   	ret
+
+00000000008017d0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017d0:	55                   	push   %rbp
+  8017d1:	48 89 e5             	mov    %rsp,%rbp
+  8017d4:	53                   	push   %rbx
+  8017d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d9:	48 89 fa             	mov    %rdi,%rdx
+  8017dc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017df:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017fb:	48 85 c0             	test   %rax,%rax
+  8017fe:	7f 06                	jg     801806 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801800:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801804:	c9                   	leave
+  801805:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801806:	49 89 c0             	mov    %rax,%r8
+  801809:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80180e:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801815:	00 00 00 
+  801818:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80181d:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801824:	00 00 00 
+  801827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182c:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  801833:	00 00 00 
+  801836:	41 ff d1             	call   *%r9
+
+0000000000801839 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801839:	55                   	push   %rbp
+  80183a:	48 89 e5             	mov    %rsp,%rbp
+  80183d:	53                   	push   %rbx
+  80183e:	48 89 fa             	mov    %rdi,%rdx
+  801841:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801844:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801849:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801853:	be 00 00 00 00       	mov    $0x0,%esi
+  801858:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80185e:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801860:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801864:	c9                   	leave
+  801865:	c3                   	ret
+
+0000000000801866 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801866:	55                   	push   %rbp
+  801867:	48 89 e5             	mov    %rsp,%rbp
+  80186a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80186b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801870:	ba 00 00 00 00       	mov    $0x0,%edx
+  801875:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80187a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801884:	be 00 00 00 00       	mov    $0x0,%esi
+  801889:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80188f:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801891:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801895:	c9                   	leave
+  801896:	c3                   	ret
+
+0000000000801897 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801897:	48 85 ff             	test   %rdi,%rdi
+  80189a:	0f 84 b6 01 00 00    	je     801a56 <malloc+0x1bf>
+malloc(size_t size) {
+  8018a0:	55                   	push   %rbp
+  8018a1:	48 89 e5             	mov    %rsp,%rbp
+  8018a4:	41 56                	push   %r14
+  8018a6:	41 55                	push   %r13
+  8018a8:	41 54                	push   %r12
+  8018aa:	53                   	push   %rbx
+  8018ab:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8018ae:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8018b5:	00 00 00 
+  8018b8:	4c 8b 20             	mov    (%rax),%r12
+  8018bb:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  8018c2:	0f 87 94 01 00 00    	ja     801a5c <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  8018c8:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8018cf:	00 00 00 
+  8018d2:	48 85 c0             	test   %rax,%rax
+  8018d5:	74 6b                	je     801942 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  8018d7:	4d 85 e4             	test   %r12,%r12
+  8018da:	74 66                	je     801942 <malloc+0xab>
+  8018dc:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  8018e3:	00 00 00 
+  8018e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018eb:	eb 0d                	jmp    8018fa <malloc+0x63>
+  8018ed:	48 83 c1 01          	add    $0x1,%rcx
+  8018f1:	48 83 c2 18          	add    $0x18,%rdx
+  8018f5:	49 39 cc             	cmp    %rcx,%r12
+  8018f8:	74 48                	je     801942 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  8018fa:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  8018ff:	74 ec                	je     8018ed <malloc+0x56>
+  801901:	48 39 1a             	cmp    %rbx,(%rdx)
+  801904:	72 e7                	jb     8018ed <malloc+0x56>
+                real_freep_size--;
+  801906:	48 83 e8 01          	sub    $0x1,%rax
+  80190a:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801911:	00 00 00 
+                freep[i].is_free = false;
+  801914:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80191b:	00 00 00 
+  80191e:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801922:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801926:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  80192a:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801931:	00 
+                freep[i].size = size;
+  801932:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801936:	48 01 c8             	add    %rcx,%rax
+  801939:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80193d:	e9 0b 01 00 00       	jmp    801a4d <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801942:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801949:	00 00 00 
+  80194c:	48 01 d8             	add    %rbx,%rax
+  80194f:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801955:	76 7c                	jbe    8019d3 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801957:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  80195e:	00 00 00 
+  801961:	4c 8b 30             	mov    (%rax),%r14
+  801964:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  80196b:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  80196e:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801975:	00 00 00 
+  801978:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  80197f:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801986:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80198c:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801990:	48 b8 63 13 80 00 00 	movabs $0x801363,%rax
+  801997:	00 00 00 
+  80199a:	ff d0                	call   *%rax
+  80199c:	89 c7                	mov    %eax,%edi
+  80199e:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8019a5:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8019ac:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  8019b3:	00 00 00 
+  8019b6:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  8019ba:	b9 26 00 00 00       	mov    $0x26,%ecx
+  8019bf:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  8019c6:	00 00 00 
+  8019c9:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  8019cb:	85 c0                	test   %eax,%eax
+  8019cd:	0f 88 90 00 00 00    	js     801a63 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  8019d3:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  8019da:	00 00 00 
+  8019dd:	48 8b 31             	mov    (%rcx),%rsi
+  8019e0:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  8019e7:	00 00 00 
+  8019ea:	4c 8b 07             	mov    (%rdi),%r8
+  8019ed:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  8019f1:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  8019f8:	00 00 00 
+  8019fb:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  8019ff:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801a03:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801a0a:	00 00 00 
+  801a0d:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801a11:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801a14:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801a18:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801a1f:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801a20:	48 89 d8             	mov    %rbx,%rax
+  801a23:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a28:	4c 01 c0             	add    %r8,%rax
+  801a2b:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801a2e:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801a35:	48 01 f3             	add    %rsi,%rbx
+  801a38:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801a3b:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801a40:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801a47:	00 00 00 
+  801a4a:	48 89 d0             	mov    %rdx,%rax
+}
+  801a4d:	5b                   	pop    %rbx
+  801a4e:	41 5c                	pop    %r12
+  801a50:	41 5d                	pop    %r13
+  801a52:	41 5e                	pop    %r14
+  801a54:	5d                   	pop    %rbp
+  801a55:	c3                   	ret
+        return NULL;
+  801a56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a5b:	c3                   	ret
+        return NULL;
+  801a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a61:	eb ea                	jmp    801a4d <malloc+0x1b6>
+            return NULL;
+  801a63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a68:	eb e3                	jmp    801a4d <malloc+0x1b6>
+
+0000000000801a6a <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801a6a:	55                   	push   %rbp
+  801a6b:	48 89 e5             	mov    %rsp,%rbp
+  801a6e:	53                   	push   %rbx
+  801a6f:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801a73:	48 89 fb             	mov    %rdi,%rbx
+  801a76:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801a7a:	48 89 df             	mov    %rbx,%rdi
+  801a7d:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801a84:	00 00 00 
+  801a87:	ff d0                	call   *%rax
+  801a89:	48 89 c7             	mov    %rax,%rdi
+  801a8c:	48 89 da             	mov    %rbx,%rdx
+  801a8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a94:	48 b8 a3 0f 80 00 00 	movabs $0x800fa3,%rax
+  801a9b:	00 00 00 
+  801a9e:	ff d0                	call   *%rax
+}
+  801aa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa4:	c9                   	leave
+  801aa5:	c3                   	ret
+
+0000000000801aa6 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801aa6:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801aad:	00 00 00 
+  801ab0:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801ab7:	00 00 00 
+  801aba:	48 3b 02             	cmp    (%rdx),%rax
+  801abd:	74 4d                	je     801b0c <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801abf:	48 85 c0             	test   %rax,%rax
+  801ac2:	74 4d                	je     801b11 <get_allocsize+0x6b>
+  801ac4:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801acb:	00 00 00 
+  801ace:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801ad3:	48 3b 39             	cmp    (%rcx),%rdi
+  801ad6:	74 13                	je     801aeb <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801ad8:	48 83 c2 01          	add    $0x1,%rdx
+  801adc:	48 83 c1 18          	add    $0x18,%rcx
+  801ae0:	48 39 d0             	cmp    %rdx,%rax
+  801ae3:	75 ee                	jne    801ad3 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aea:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801aeb:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801aef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af4:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801afb:	00 00 00 
+  801afe:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b04:	75 0b                	jne    801b11 <get_allocsize+0x6b>
+  801b06:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801b0b:	c3                   	ret
+        return 0;
+  801b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b11:	c3                   	ret
+
+0000000000801b12 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801b12:	48 85 ff             	test   %rdi,%rdi
+  801b15:	0f 84 01 01 00 00    	je     801c1c <free+0x10a>
+free(void *ptr) {
+  801b1b:	55                   	push   %rbp
+  801b1c:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801b1f:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801b26:	00 00 00 
+  801b29:	48 8b 30             	mov    (%rax),%rsi
+  801b2c:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801b33:	00 00 00 
+  801b36:	48 39 c6             	cmp    %rax,%rsi
+  801b39:	74 50                	je     801b8b <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801b3b:	48 85 f6             	test   %rsi,%rsi
+  801b3e:	74 21                	je     801b61 <free+0x4f>
+  801b40:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801b47:	00 00 00 
+  801b4a:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801b4f:	48 3b 39             	cmp    (%rcx),%rdi
+  801b52:	74 61                	je     801bb5 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801b54:	48 83 c2 01          	add    $0x1,%rdx
+  801b58:	48 83 c1 18          	add    $0x18,%rcx
+  801b5c:	48 39 d6             	cmp    %rdx,%rsi
+  801b5f:	75 ee                	jne    801b4f <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801b61:	48 ba 30 56 80 00 00 	movabs $0x805630,%rdx
+  801b68:	00 00 00 
+  801b6b:	be 12 01 00 00       	mov    $0x112,%esi
+  801b70:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801b77:	00 00 00 
+  801b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7f:	48 b9 fb 01 80 00 00 	movabs $0x8001fb,%rcx
+  801b86:	00 00 00 
+  801b89:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801b8b:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  801b92:	00 00 00 
+  801b95:	be 06 01 00 00       	mov    $0x106,%esi
+  801b9a:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801ba1:	00 00 00 
+  801ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba9:	48 b9 fb 01 80 00 00 	movabs $0x8001fb,%rcx
+  801bb0:	00 00 00 
+  801bb3:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801bb5:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801bb9:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801bc0:	00 00 00 
+  801bc3:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801bc9:	75 27                	jne    801bf2 <free+0xe0>
+            freep[i].is_free = true;
+  801bcb:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801bcf:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801bd6:	00 00 00 
+  801bd9:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801be0:	00 00 
+            real_freep_size++;
+  801be2:	48 83 c0 01          	add    $0x1,%rax
+  801be6:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801bed:	00 00 00 
+}
+  801bf0:	5d                   	pop    %rbp
+  801bf1:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801bf2:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  801bf9:	00 00 00 
+  801bfc:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801c01:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801c08:	00 00 00 
+  801c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c10:	48 b9 fb 01 80 00 00 	movabs $0x8001fb,%rcx
+  801c17:	00 00 00 
+  801c1a:	ff d1                	call   *%rcx
+  801c1c:	c3                   	ret
+
+0000000000801c1d <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801c1d:	55                   	push   %rbp
+  801c1e:	48 89 e5             	mov    %rsp,%rbp
+  801c21:	41 55                	push   %r13
+  801c23:	41 54                	push   %r12
+  801c25:	53                   	push   %rbx
+  801c26:	48 83 ec 08          	sub    $0x8,%rsp
+  801c2a:	48 89 fb             	mov    %rdi,%rbx
+  801c2d:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801c30:	48 b8 a6 1a 80 00 00 	movabs $0x801aa6,%rax
+  801c37:	00 00 00 
+  801c3a:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801c3c:	49 39 c5             	cmp    %rax,%r13
+  801c3f:	73 0e                	jae    801c4f <realloc+0x32>
+}
+  801c41:	48 89 d8             	mov    %rbx,%rax
+  801c44:	48 83 c4 08          	add    $0x8,%rsp
+  801c48:	5b                   	pop    %rbx
+  801c49:	41 5c                	pop    %r12
+  801c4b:	41 5d                	pop    %r13
+  801c4d:	5d                   	pop    %rbp
+  801c4e:	c3                   	ret
+  801c4f:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801c52:	4c 89 ef             	mov    %r13,%rdi
+  801c55:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+  801c61:	48 89 c7             	mov    %rax,%rdi
+  801c64:	4c 89 e2             	mov    %r12,%rdx
+  801c67:	48 89 de             	mov    %rbx,%rsi
+  801c6a:	48 b8 b8 10 80 00 00 	movabs $0x8010b8,%rax
+  801c71:	00 00 00 
+  801c74:	ff d0                	call   *%rax
+  801c76:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801c79:	48 89 df             	mov    %rbx,%rdi
+  801c7c:	48 b8 12 1b 80 00 00 	movabs $0x801b12,%rax
+  801c83:	00 00 00 
+  801c86:	ff d0                	call   *%rax
+    return newptr;
+  801c88:	4c 89 e3             	mov    %r12,%rbx
+  801c8b:	eb b4                	jmp    801c41 <realloc+0x24>
+
+0000000000801c8d <strdup>:
+
+char*
+strdup (const char *src) {
+  801c8d:	55                   	push   %rbp
+  801c8e:	48 89 e5             	mov    %rsp,%rbp
+  801c91:	41 54                	push   %r12
+  801c93:	53                   	push   %rbx
+  801c94:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801c97:	48 b8 85 0c 80 00 00 	movabs $0x800c85,%rax
+  801c9e:	00 00 00 
+  801ca1:	ff d0                	call   *%rax
+  801ca3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801ca7:	4c 89 e7             	mov    %r12,%rdi
+  801caa:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+  801cb6:	48 89 c7             	mov    %rax,%rdi
+  801cb9:	4c 89 e2             	mov    %r12,%rdx
+  801cbc:	48 89 de             	mov    %rbx,%rsi
+  801cbf:	48 b8 b8 10 80 00 00 	movabs $0x8010b8,%rax
+  801cc6:	00 00 00 
+  801cc9:	ff d0                	call   *%rax
+}
+  801ccb:	5b                   	pop    %rbx
+  801ccc:	41 5c                	pop    %r12
+  801cce:	5d                   	pop    %rbp
+  801ccf:	c3                   	ret
+
+0000000000801cd0 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801cd0:	55                   	push   %rbp
+  801cd1:	48 89 e5             	mov    %rsp,%rbp
+  801cd4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cd5:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ce4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cee:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cf9:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801cfb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cff:	c9                   	leave
+  801d00:	c3                   	ret
+
+0000000000801d01 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801d01:	55                   	push   %rbp
+  801d02:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801d05:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d0c:	00 00 00 
+  801d0f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d13:	74 26                	je     801d3b <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801d15:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d17:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d1b:	89 c0                	mov    %eax,%eax
+  801d1d:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801d20:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801d27:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801d2e:	00 00 00 
+  801d31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d36:	48 f7 31             	divq   (%rcx)
+}
+  801d39:	5d                   	pop    %rbp
+  801d3a:	c3                   	ret
+        freq = get_cpufreq();
+  801d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d40:	48 ba d0 1c 80 00 00 	movabs $0x801cd0,%rdx
+  801d47:	00 00 00 
+  801d4a:	ff d2                	call   *%rdx
+  801d4c:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801d53:	00 00 00 
+  801d56:	eb bd                	jmp    801d15 <get_ticks+0x14>
+
+0000000000801d58 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801d58:	55                   	push   %rbp
+  801d59:	48 89 e5             	mov    %rsp,%rbp
+  801d5c:	53                   	push   %rbx
+  801d5d:	48 83 ec 08          	sub    $0x8,%rsp
+  801d61:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801d64:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d6b:	00 00 00 
+  801d6e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d72:	74 50                	je     801dc4 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801d74:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d76:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d7a:	89 c0                	mov    %eax,%eax
+  801d7c:	48 89 d6             	mov    %rdx,%rsi
+  801d7f:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801d82:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d89:	00 00 00 
+  801d8c:	48 0f af 18          	imul   (%rax),%rbx
+  801d90:	48 c1 eb 03          	shr    $0x3,%rbx
+  801d94:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801d9b:	9b c4 20 
+  801d9e:	48 89 d8             	mov    %rbx,%rax
+  801da1:	48 f7 e2             	mul    %rdx
+  801da4:	48 89 d1             	mov    %rdx,%rcx
+  801da7:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801dab:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801dad:	48 c1 e2 20          	shl    $0x20,%rdx
+  801db1:	89 c0                	mov    %eax,%eax
+  801db3:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801db6:	48 29 f2             	sub    %rsi,%rdx
+  801db9:	48 39 ca             	cmp    %rcx,%rdx
+  801dbc:	72 ed                	jb     801dab <sleep+0x53>
+}
+  801dbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dc2:	c9                   	leave
+  801dc3:	c3                   	ret
+        freq = get_cpufreq();
+  801dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc9:	48 ba d0 1c 80 00 00 	movabs $0x801cd0,%rdx
+  801dd0:	00 00 00 
+  801dd3:	ff d2                	call   *%rdx
+  801dd5:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801ddc:	00 00 00 
+  801ddf:	eb 93                	jmp    801d74 <sleep+0x1c>
+
+0000000000801de1 <poll_kbd>:
+
+int poll_kbd() {
+  801de1:	55                   	push   %rbp
+  801de2:	48 89 e5             	mov    %rsp,%rbp
+  801de5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801de6:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801deb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801df5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dfa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dff:	be 00 00 00 00       	mov    $0x0,%esi
+  801e04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e0a:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e10:	c9                   	leave
+  801e11:	c3                   	ret
+
+0000000000801e12 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801e12:	55                   	push   %rbp
+  801e13:	48 89 e5             	mov    %rsp,%rbp
+  801e16:	53                   	push   %rbx
+  801e17:	49 89 fa             	mov    %rdi,%r10
+  801e1a:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801e1c:	44 89 c6             	mov    %r8d,%esi
+  801e1f:	89 cf                	mov    %ecx,%edi
+  801e21:	89 d3                	mov    %edx,%ebx
+  801e23:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801e25:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e2a:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e2d:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801e31:	cd 30                	int    $0x30
+  801e33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e37:	c9                   	leave
+  801e38:	c3                   	ret
+
+0000000000801e39 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  801e39:	55                   	push   %rbp
+  801e3a:	48 89 e5             	mov    %rsp,%rbp
+  801e3d:	41 56                	push   %r14
+  801e3f:	41 55                	push   %r13
+  801e41:	41 54                	push   %r12
+  801e43:	53                   	push   %rbx
+  801e44:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801e47:	48 b8 a8 70 98 00 00 	movabs $0x9870a8,%rax
+  801e4e:	00 00 00 
+  801e51:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801e55:	74 27                	je     801e7e <_handle_vectored_pagefault+0x45>
+  801e57:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  801e5c:	49 bd 60 70 98 00 00 	movabs $0x987060,%r13
+  801e63:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801e66:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  801e69:	4c 89 e7             	mov    %r12,%rdi
+  801e6c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  801e71:	84 c0                	test   %al,%al
+  801e73:	75 45                	jne    801eba <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801e75:	48 83 c3 01          	add    $0x1,%rbx
+  801e79:	49 3b 1e             	cmp    (%r14),%rbx
+  801e7c:	72 eb                	jb     801e69 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  801e7e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  801e85:	00 
+  801e86:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  801e8b:	4d 8b 04 24          	mov    (%r12),%r8
+  801e8f:	48 ba 68 56 80 00 00 	movabs $0x805668,%rdx
+  801e96:	00 00 00 
+  801e99:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801e9e:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801ea5:	00 00 00 
+  801ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ead:	49 ba fb 01 80 00 00 	movabs $0x8001fb,%r10
+  801eb4:	00 00 00 
+  801eb7:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801eba:	5b                   	pop    %rbx
+  801ebb:	41 5c                	pop    %r12
+  801ebd:	41 5d                	pop    %r13
+  801ebf:	41 5e                	pop    %r14
+  801ec1:	5d                   	pop    %rbp
+  801ec2:	c3                   	ret
+
+0000000000801ec3 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  801ec3:	55                   	push   %rbp
+  801ec4:	48 89 e5             	mov    %rsp,%rbp
+  801ec7:	41 54                	push   %r12
+  801ec9:	53                   	push   %rbx
+  801eca:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801ecd:	48 b8 a0 70 98 00 00 	movabs $0x9870a0,%rax
+  801ed4:	00 00 00 
+  801ed7:	80 38 00             	cmpb   $0x0,(%rax)
+  801eda:	74 64                	je     801f40 <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801edc:	48 b8 a8 70 98 00 00 	movabs $0x9870a8,%rax
+  801ee3:	00 00 00 
+  801ee6:	48 8b 10             	mov    (%rax),%rdx
+  801ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  801eee:	48 b9 60 70 98 00 00 	movabs $0x987060,%rcx
+  801ef5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801ef8:	48 85 d2             	test   %rdx,%rdx
+  801efb:	74 1d                	je     801f1a <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801efd:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  801f01:	0f 84 ee 00 00 00    	je     801ff5 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801f07:	48 83 c0 01          	add    $0x1,%rax
+  801f0b:	48 39 d0             	cmp    %rdx,%rax
+  801f0e:	75 ed                	jne    801efd <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  801f10:	48 83 fa 08          	cmp    $0x8,%rdx
+  801f14:	0f 84 a9 00 00 00    	je     801fc3 <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801f1a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801f1e:	48 a3 a8 70 98 00 00 	movabs %rax,0x9870a8
+  801f25:	00 00 00 
+  801f28:	48 b8 60 70 98 00 00 	movabs $0x987060,%rax
+  801f2f:	00 00 00 
+  801f32:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  801f36:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  801f3b:	5b                   	pop    %rbx
+  801f3c:	41 5c                	pop    %r12
+  801f3e:	5d                   	pop    %rbp
+  801f3f:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  801f40:	49 bc 63 13 80 00 00 	movabs $0x801363,%r12
+  801f47:	00 00 00 
+  801f4a:	41 ff d4             	call   *%r12
+  801f4d:	89 c7                	mov    %eax,%edi
+  801f4f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801f54:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f59:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  801f60:	00 00 00 
+  801f63:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  801f6a:	00 00 00 
+  801f6d:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801f6f:	48 ba a8 70 98 00 00 	movabs $0x9870a8,%rdx
+  801f76:	00 00 00 
+  801f79:	48 8b 02             	mov    (%rdx),%rax
+  801f7c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801f80:	48 89 0a             	mov    %rcx,(%rdx)
+  801f83:	48 ba 60 70 98 00 00 	movabs $0x987060,%rdx
+  801f8a:	00 00 00 
+  801f8d:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  801f91:	48 b8 a0 70 98 00 00 	movabs $0x9870a0,%rax
+  801f98:	00 00 00 
+  801f9b:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  801f9e:	41 ff d4             	call   *%r12
+  801fa1:	89 c7                	mov    %eax,%edi
+  801fa3:	48 be bb 20 80 00 00 	movabs $0x8020bb,%rsi
+  801faa:	00 00 00 
+  801fad:	48 b8 3b 17 80 00 00 	movabs $0x80173b,%rax
+  801fb4:	00 00 00 
+  801fb7:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	0f 89 7a ff ff ff    	jns    801f3b <add_pgfault_handler+0x78>
+  801fc1:	eb 05                	jmp    801fc8 <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  801fc3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801fc8:	89 c1                	mov    %eax,%ecx
+  801fca:	48 ba a6 56 80 00 00 	movabs $0x8056a6,%rdx
+  801fd1:	00 00 00 
+  801fd4:	be 3b 00 00 00       	mov    $0x3b,%esi
+  801fd9:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801fe0:	00 00 00 
+  801fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe8:	49 b8 fb 01 80 00 00 	movabs $0x8001fb,%r8
+  801fef:	00 00 00 
+  801ff2:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  801ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffa:	e9 3c ff ff ff       	jmp    801f3b <add_pgfault_handler+0x78>
+
+0000000000801fff <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801fff:	55                   	push   %rbp
+  802000:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  802003:	48 b8 a0 70 98 00 00 	movabs $0x9870a0,%rax
+  80200a:	00 00 00 
+  80200d:	80 38 00             	cmpb   $0x0,(%rax)
+  802010:	74 33                	je     802045 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802012:	48 a1 a8 70 98 00 00 	movabs 0x9870a8,%rax
+  802019:	00 00 00 
+  80201c:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  802021:	48 ba 60 70 98 00 00 	movabs $0x987060,%rdx
+  802028:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80202b:	48 85 c0             	test   %rax,%rax
+  80202e:	0f 84 85 00 00 00    	je     8020b9 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  802034:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  802038:	74 40                	je     80207a <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80203a:	48 83 c1 01          	add    $0x1,%rcx
+  80203e:	48 39 c1             	cmp    %rax,%rcx
+  802041:	75 f1                	jne    802034 <remove_pgfault_handler+0x35>
+  802043:	eb 74                	jmp    8020b9 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  802045:	48 b9 be 56 80 00 00 	movabs $0x8056be,%rcx
+  80204c:	00 00 00 
+  80204f:	48 ba d8 56 80 00 00 	movabs $0x8056d8,%rdx
+  802056:	00 00 00 
+  802059:	be 41 00 00 00       	mov    $0x41,%esi
+  80205e:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  802065:	00 00 00 
+  802068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206d:	49 b8 fb 01 80 00 00 	movabs $0x8001fb,%r8
+  802074:	00 00 00 
+  802077:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80207a:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  802081:	00 
+  802082:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802086:	48 29 ca             	sub    %rcx,%rdx
+  802089:	48 b8 60 70 98 00 00 	movabs $0x987060,%rax
+  802090:	00 00 00 
+  802093:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  802097:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80209c:	48 89 ce             	mov    %rcx,%rsi
+  80209f:	48 b8 51 10 80 00 00 	movabs $0x801051,%rax
+  8020a6:	00 00 00 
+  8020a9:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8020ab:	48 b8 a8 70 98 00 00 	movabs $0x9870a8,%rax
+  8020b2:	00 00 00 
+  8020b5:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8020b9:	5d                   	pop    %rbp
+  8020ba:	c3                   	ret
+
+00000000008020bb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8020bb:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8020be:	48 b8 39 1e 80 00 00 	movabs $0x801e39,%rax
+  8020c5:	00 00 00 
+    call *%rax
+  8020c8:	ff d0                	call   *%rax
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    popq %r15
+  8020ca:	41 5f                	pop    %r15
+    popq %r15
+  8020cc:	41 5f                	pop    %r15
+    popq %r15
+  8020ce:	41 5f                	pop    %r15
+    popq %r14
+  8020d0:	41 5e                	pop    %r14
+    popq %r13
+  8020d2:	41 5d                	pop    %r13
+    popq %r12
+  8020d4:	41 5c                	pop    %r12
+    popq %r11
+  8020d6:	41 5b                	pop    %r11
+    popq %r10
+  8020d8:	41 5a                	pop    %r10
+    popq %r9
+  8020da:	41 59                	pop    %r9
+    popq %r8
+  8020dc:	41 58                	pop    %r8
+    popq %rsi
+  8020de:	5e                   	pop    %rsi
+    popq %rdi
+  8020df:	5f                   	pop    %rdi
+    popq %rbp
+  8020e0:	5d                   	pop    %rbp
+    popq %rdx
+  8020e1:	5a                   	pop    %rdx
+    popq %rcx
+  8020e2:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  8020e3:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  8020e8:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  8020ed:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  8020f1:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  8020f4:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  8020f9:	5b                   	pop    %rbx
+    popq %rax
+  8020fa:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    pushq 8(%rsp)
+  8020fb:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  8020ff:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    movq 16(%rsp), %rsp
+  802100:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  802105:	c3                   	ret
+
+0000000000802106 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802106:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80210d:	ff ff ff 
+  802110:	48 01 f8             	add    %rdi,%rax
+  802113:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802117:	c3                   	ret
+
+0000000000802118 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802118:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80211f:	ff ff ff 
+  802122:	48 01 f8             	add    %rdi,%rax
+  802125:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802129:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80212f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802133:	c3                   	ret
+
+0000000000802134 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802134:	55                   	push   %rbp
+  802135:	48 89 e5             	mov    %rsp,%rbp
+  802138:	41 57                	push   %r15
+  80213a:	41 56                	push   %r14
+  80213c:	41 55                	push   %r13
+  80213e:	41 54                	push   %r12
+  802140:	53                   	push   %rbx
+  802141:	48 83 ec 08          	sub    $0x8,%rsp
+  802145:	49 89 ff             	mov    %rdi,%r15
+  802148:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80214d:	49 bd e8 3f 80 00 00 	movabs $0x803fe8,%r13
+  802154:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802157:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80215d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802160:	48 89 df             	mov    %rbx,%rdi
+  802163:	41 ff d5             	call   *%r13
+  802166:	83 e0 04             	and    $0x4,%eax
+  802169:	74 17                	je     802182 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80216b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802172:	4c 39 f3             	cmp    %r14,%rbx
+  802175:	75 e6                	jne    80215d <fd_alloc+0x29>
+  802177:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80217d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802182:	4d 89 27             	mov    %r12,(%r15)
+}
+  802185:	48 83 c4 08          	add    $0x8,%rsp
+  802189:	5b                   	pop    %rbx
+  80218a:	41 5c                	pop    %r12
+  80218c:	41 5d                	pop    %r13
+  80218e:	41 5e                	pop    %r14
+  802190:	41 5f                	pop    %r15
+  802192:	5d                   	pop    %rbp
+  802193:	c3                   	ret
+
+0000000000802194 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802194:	83 ff 1f             	cmp    $0x1f,%edi
+  802197:	77 39                	ja     8021d2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802199:	55                   	push   %rbp
+  80219a:	48 89 e5             	mov    %rsp,%rbp
+  80219d:	41 54                	push   %r12
+  80219f:	53                   	push   %rbx
+  8021a0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8021a3:	48 63 df             	movslq %edi,%rbx
+  8021a6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8021ad:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8021b1:	48 89 df             	mov    %rbx,%rdi
+  8021b4:	48 b8 e8 3f 80 00 00 	movabs $0x803fe8,%rax
+  8021bb:	00 00 00 
+  8021be:	ff d0                	call   *%rax
+  8021c0:	a8 04                	test   $0x4,%al
+  8021c2:	74 14                	je     8021d8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8021c4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8021c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021cd:	5b                   	pop    %rbx
+  8021ce:	41 5c                	pop    %r12
+  8021d0:	5d                   	pop    %rbp
+  8021d1:	c3                   	ret
+        return -E_INVAL;
+  8021d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8021d7:	c3                   	ret
+        return -E_INVAL;
+  8021d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021dd:	eb ee                	jmp    8021cd <fd_lookup+0x39>
+
+00000000008021df <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8021df:	55                   	push   %rbp
+  8021e0:	48 89 e5             	mov    %rsp,%rbp
+  8021e3:	41 54                	push   %r12
+  8021e5:	53                   	push   %rbx
+  8021e6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8021e9:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  8021f0:	00 00 00 
+  8021f3:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8021fa:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8021fd:	39 3b                	cmp    %edi,(%rbx)
+  8021ff:	74 47                	je     802248 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802201:	48 83 c0 08          	add    $0x8,%rax
+  802205:	48 8b 18             	mov    (%rax),%rbx
+  802208:	48 85 db             	test   %rbx,%rbx
+  80220b:	75 f0                	jne    8021fd <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80220d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802214:	00 00 00 
+  802217:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80221d:	89 fa                	mov    %edi,%edx
+  80221f:	48 bf f0 56 80 00 00 	movabs $0x8056f0,%rdi
+  802226:	00 00 00 
+  802229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222e:	48 b9 4b 03 80 00 00 	movabs $0x80034b,%rcx
+  802235:	00 00 00 
+  802238:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80223a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80223f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802243:	5b                   	pop    %rbx
+  802244:	41 5c                	pop    %r12
+  802246:	5d                   	pop    %rbp
+  802247:	c3                   	ret
+            return 0;
+  802248:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224d:	eb f0                	jmp    80223f <dev_lookup+0x60>
+
+000000000080224f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80224f:	55                   	push   %rbp
+  802250:	48 89 e5             	mov    %rsp,%rbp
+  802253:	41 55                	push   %r13
+  802255:	41 54                	push   %r12
+  802257:	53                   	push   %rbx
+  802258:	48 83 ec 18          	sub    $0x18,%rsp
+  80225c:	48 89 fb             	mov    %rdi,%rbx
+  80225f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802262:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802269:	ff ff ff 
+  80226c:	48 01 df             	add    %rbx,%rdi
+  80226f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802273:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802277:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  80227e:	00 00 00 
+  802281:	ff d0                	call   *%rax
+  802283:	41 89 c5             	mov    %eax,%r13d
+  802286:	85 c0                	test   %eax,%eax
+  802288:	78 06                	js     802290 <fd_close+0x41>
+  80228a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80228e:	74 1a                	je     8022aa <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802290:	45 84 e4             	test   %r12b,%r12b
+  802293:	b8 00 00 00 00       	mov    $0x0,%eax
+  802298:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80229c:	44 89 e8             	mov    %r13d,%eax
+  80229f:	48 83 c4 18          	add    $0x18,%rsp
+  8022a3:	5b                   	pop    %rbx
+  8022a4:	41 5c                	pop    %r12
+  8022a6:	41 5d                	pop    %r13
+  8022a8:	5d                   	pop    %rbp
+  8022a9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8022aa:	8b 3b                	mov    (%rbx),%edi
+  8022ac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022b0:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  8022b7:	00 00 00 
+  8022ba:	ff d0                	call   *%rax
+  8022bc:	41 89 c5             	mov    %eax,%r13d
+  8022bf:	85 c0                	test   %eax,%eax
+  8022c1:	78 1b                	js     8022de <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8022c3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022c7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8022cb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8022d1:	48 85 c0             	test   %rax,%rax
+  8022d4:	74 08                	je     8022de <fd_close+0x8f>
+  8022d6:	48 89 df             	mov    %rbx,%rdi
+  8022d9:	ff d0                	call   *%rax
+  8022db:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8022de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022e3:	48 89 de             	mov    %rbx,%rsi
+  8022e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022eb:	48 b8 02 16 80 00 00 	movabs $0x801602,%rax
+  8022f2:	00 00 00 
+  8022f5:	ff d0                	call   *%rax
+    return res;
+  8022f7:	eb a3                	jmp    80229c <fd_close+0x4d>
+
+00000000008022f9 <close>:
+
+int
+close(int fdnum) {
+  8022f9:	55                   	push   %rbp
+  8022fa:	48 89 e5             	mov    %rsp,%rbp
+  8022fd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802301:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802305:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  80230c:	00 00 00 
+  80230f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802311:	85 c0                	test   %eax,%eax
+  802313:	78 15                	js     80232a <close+0x31>
+
+    return fd_close(fd, 1);
+  802315:	be 01 00 00 00       	mov    $0x1,%esi
+  80231a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80231e:	48 b8 4f 22 80 00 00 	movabs $0x80224f,%rax
+  802325:	00 00 00 
+  802328:	ff d0                	call   *%rax
+}
+  80232a:	c9                   	leave
+  80232b:	c3                   	ret
+
+000000000080232c <close_all>:
+
+void
+close_all(void) {
+  80232c:	55                   	push   %rbp
+  80232d:	48 89 e5             	mov    %rsp,%rbp
+  802330:	41 54                	push   %r12
+  802332:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802333:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802338:	49 bc f9 22 80 00 00 	movabs $0x8022f9,%r12
+  80233f:	00 00 00 
+  802342:	89 df                	mov    %ebx,%edi
+  802344:	41 ff d4             	call   *%r12
+  802347:	83 c3 01             	add    $0x1,%ebx
+  80234a:	83 fb 20             	cmp    $0x20,%ebx
+  80234d:	75 f3                	jne    802342 <close_all+0x16>
+}
+  80234f:	5b                   	pop    %rbx
+  802350:	41 5c                	pop    %r12
+  802352:	5d                   	pop    %rbp
+  802353:	c3                   	ret
+
+0000000000802354 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802354:	55                   	push   %rbp
+  802355:	48 89 e5             	mov    %rsp,%rbp
+  802358:	41 57                	push   %r15
+  80235a:	41 56                	push   %r14
+  80235c:	41 55                	push   %r13
+  80235e:	41 54                	push   %r12
+  802360:	53                   	push   %rbx
+  802361:	48 83 ec 18          	sub    $0x18,%rsp
+  802365:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802368:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80236c:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  802373:	00 00 00 
+  802376:	ff d0                	call   *%rax
+  802378:	89 c3                	mov    %eax,%ebx
+  80237a:	85 c0                	test   %eax,%eax
+  80237c:	0f 88 b8 00 00 00    	js     80243a <dup+0xe6>
+    close(newfdnum);
+  802382:	44 89 e7             	mov    %r12d,%edi
+  802385:	48 b8 f9 22 80 00 00 	movabs $0x8022f9,%rax
+  80238c:	00 00 00 
+  80238f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802391:	4d 63 ec             	movslq %r12d,%r13
+  802394:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80239b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80239f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8023a3:	4c 89 ff             	mov    %r15,%rdi
+  8023a6:	49 be 18 21 80 00 00 	movabs $0x802118,%r14
+  8023ad:	00 00 00 
+  8023b0:	41 ff d6             	call   *%r14
+  8023b3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8023b6:	4c 89 ef             	mov    %r13,%rdi
+  8023b9:	41 ff d6             	call   *%r14
+  8023bc:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8023bf:	48 89 df             	mov    %rbx,%rdi
+  8023c2:	48 b8 e8 3f 80 00 00 	movabs $0x803fe8,%rax
+  8023c9:	00 00 00 
+  8023cc:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8023ce:	a8 04                	test   $0x4,%al
+  8023d0:	74 2b                	je     8023fd <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8023d2:	41 89 c1             	mov    %eax,%r9d
+  8023d5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023db:	4c 89 f1             	mov    %r14,%rcx
+  8023de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e3:	48 89 de             	mov    %rbx,%rsi
+  8023e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023eb:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  8023f2:	00 00 00 
+  8023f5:	ff d0                	call   *%rax
+  8023f7:	89 c3                	mov    %eax,%ebx
+  8023f9:	85 c0                	test   %eax,%eax
+  8023fb:	78 4e                	js     80244b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8023fd:	4c 89 ff             	mov    %r15,%rdi
+  802400:	48 b8 e8 3f 80 00 00 	movabs $0x803fe8,%rax
+  802407:	00 00 00 
+  80240a:	ff d0                	call   *%rax
+  80240c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80240f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802415:	4c 89 e9             	mov    %r13,%rcx
+  802418:	ba 00 00 00 00       	mov    $0x0,%edx
+  80241d:	4c 89 fe             	mov    %r15,%rsi
+  802420:	bf 00 00 00 00       	mov    $0x0,%edi
+  802425:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  80242c:	00 00 00 
+  80242f:	ff d0                	call   *%rax
+  802431:	89 c3                	mov    %eax,%ebx
+  802433:	85 c0                	test   %eax,%eax
+  802435:	78 14                	js     80244b <dup+0xf7>
+
+    return newfdnum;
+  802437:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80243a:	89 d8                	mov    %ebx,%eax
+  80243c:	48 83 c4 18          	add    $0x18,%rsp
+  802440:	5b                   	pop    %rbx
+  802441:	41 5c                	pop    %r12
+  802443:	41 5d                	pop    %r13
+  802445:	41 5e                	pop    %r14
+  802447:	41 5f                	pop    %r15
+  802449:	5d                   	pop    %rbp
+  80244a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80244b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802450:	4c 89 ee             	mov    %r13,%rsi
+  802453:	bf 00 00 00 00       	mov    $0x0,%edi
+  802458:	49 bc 02 16 80 00 00 	movabs $0x801602,%r12
+  80245f:	00 00 00 
+  802462:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802465:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80246a:	4c 89 f6             	mov    %r14,%rsi
+  80246d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802472:	41 ff d4             	call   *%r12
+    return res;
+  802475:	eb c3                	jmp    80243a <dup+0xe6>
+
+0000000000802477 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802477:	55                   	push   %rbp
+  802478:	48 89 e5             	mov    %rsp,%rbp
+  80247b:	41 56                	push   %r14
+  80247d:	41 55                	push   %r13
+  80247f:	41 54                	push   %r12
+  802481:	53                   	push   %rbx
+  802482:	48 83 ec 10          	sub    $0x10,%rsp
+  802486:	89 fb                	mov    %edi,%ebx
+  802488:	49 89 f4             	mov    %rsi,%r12
+  80248b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80248e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802492:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	78 4c                	js     8024ee <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024a2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8024a6:	41 8b 3e             	mov    (%r14),%edi
+  8024a9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024ad:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  8024b4:	00 00 00 
+  8024b7:	ff d0                	call   *%rax
+  8024b9:	85 c0                	test   %eax,%eax
+  8024bb:	78 35                	js     8024f2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8024bd:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8024c1:	83 e0 03             	and    $0x3,%eax
+  8024c4:	83 f8 01             	cmp    $0x1,%eax
+  8024c7:	74 2d                	je     8024f6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8024c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024cd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8024d1:	48 85 c0             	test   %rax,%rax
+  8024d4:	74 56                	je     80252c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8024d6:	4c 89 ea             	mov    %r13,%rdx
+  8024d9:	4c 89 e6             	mov    %r12,%rsi
+  8024dc:	4c 89 f7             	mov    %r14,%rdi
+  8024df:	ff d0                	call   *%rax
+}
+  8024e1:	48 83 c4 10          	add    $0x10,%rsp
+  8024e5:	5b                   	pop    %rbx
+  8024e6:	41 5c                	pop    %r12
+  8024e8:	41 5d                	pop    %r13
+  8024ea:	41 5e                	pop    %r14
+  8024ec:	5d                   	pop    %rbp
+  8024ed:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024ee:	48 98                	cltq
+  8024f0:	eb ef                	jmp    8024e1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024f2:	48 98                	cltq
+  8024f4:	eb eb                	jmp    8024e1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024f6:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8024fd:	00 00 00 
+  802500:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802506:	89 da                	mov    %ebx,%edx
+  802508:	48 bf 31 57 80 00 00 	movabs $0x805731,%rdi
+  80250f:	00 00 00 
+  802512:	b8 00 00 00 00       	mov    $0x0,%eax
+  802517:	48 b9 4b 03 80 00 00 	movabs $0x80034b,%rcx
+  80251e:	00 00 00 
+  802521:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802523:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80252a:	eb b5                	jmp    8024e1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80252c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802533:	eb ac                	jmp    8024e1 <read+0x6a>
+
+0000000000802535 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802535:	55                   	push   %rbp
+  802536:	48 89 e5             	mov    %rsp,%rbp
+  802539:	41 57                	push   %r15
+  80253b:	41 56                	push   %r14
+  80253d:	41 55                	push   %r13
+  80253f:	41 54                	push   %r12
+  802541:	53                   	push   %rbx
+  802542:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802546:	48 85 d2             	test   %rdx,%rdx
+  802549:	74 54                	je     80259f <readn+0x6a>
+  80254b:	41 89 fd             	mov    %edi,%r13d
+  80254e:	49 89 f6             	mov    %rsi,%r14
+  802551:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802554:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802559:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80255e:	49 bf 77 24 80 00 00 	movabs $0x802477,%r15
+  802565:	00 00 00 
+  802568:	4c 89 e2             	mov    %r12,%rdx
+  80256b:	48 29 f2             	sub    %rsi,%rdx
+  80256e:	4c 01 f6             	add    %r14,%rsi
+  802571:	44 89 ef             	mov    %r13d,%edi
+  802574:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802577:	85 c0                	test   %eax,%eax
+  802579:	78 20                	js     80259b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80257b:	01 c3                	add    %eax,%ebx
+  80257d:	85 c0                	test   %eax,%eax
+  80257f:	74 08                	je     802589 <readn+0x54>
+  802581:	48 63 f3             	movslq %ebx,%rsi
+  802584:	4c 39 e6             	cmp    %r12,%rsi
+  802587:	72 df                	jb     802568 <readn+0x33>
+    }
+    return res;
+  802589:	48 63 c3             	movslq %ebx,%rax
+}
+  80258c:	48 83 c4 08          	add    $0x8,%rsp
+  802590:	5b                   	pop    %rbx
+  802591:	41 5c                	pop    %r12
+  802593:	41 5d                	pop    %r13
+  802595:	41 5e                	pop    %r14
+  802597:	41 5f                	pop    %r15
+  802599:	5d                   	pop    %rbp
+  80259a:	c3                   	ret
+        if (inc < 0) return inc;
+  80259b:	48 98                	cltq
+  80259d:	eb ed                	jmp    80258c <readn+0x57>
+    int inc = 1, res = 0;
+  80259f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025a4:	eb e3                	jmp    802589 <readn+0x54>
+
+00000000008025a6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8025a6:	55                   	push   %rbp
+  8025a7:	48 89 e5             	mov    %rsp,%rbp
+  8025aa:	41 56                	push   %r14
+  8025ac:	41 55                	push   %r13
+  8025ae:	41 54                	push   %r12
+  8025b0:	53                   	push   %rbx
+  8025b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b5:	89 fb                	mov    %edi,%ebx
+  8025b7:	49 89 f4             	mov    %rsi,%r12
+  8025ba:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025bd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025c1:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  8025c8:	00 00 00 
+  8025cb:	ff d0                	call   *%rax
+  8025cd:	85 c0                	test   %eax,%eax
+  8025cf:	78 47                	js     802618 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025d1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8025d5:	41 8b 3e             	mov    (%r14),%edi
+  8025d8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025dc:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  8025e3:	00 00 00 
+  8025e6:	ff d0                	call   *%rax
+  8025e8:	85 c0                	test   %eax,%eax
+  8025ea:	78 30                	js     80261c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025ec:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8025f1:	74 2d                	je     802620 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8025f3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025f7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8025fb:	48 85 c0             	test   %rax,%rax
+  8025fe:	74 56                	je     802656 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802600:	4c 89 ea             	mov    %r13,%rdx
+  802603:	4c 89 e6             	mov    %r12,%rsi
+  802606:	4c 89 f7             	mov    %r14,%rdi
+  802609:	ff d0                	call   *%rax
+}
+  80260b:	48 83 c4 10          	add    $0x10,%rsp
+  80260f:	5b                   	pop    %rbx
+  802610:	41 5c                	pop    %r12
+  802612:	41 5d                	pop    %r13
+  802614:	41 5e                	pop    %r14
+  802616:	5d                   	pop    %rbp
+  802617:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802618:	48 98                	cltq
+  80261a:	eb ef                	jmp    80260b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80261c:	48 98                	cltq
+  80261e:	eb eb                	jmp    80260b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802620:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802627:	00 00 00 
+  80262a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802630:	89 da                	mov    %ebx,%edx
+  802632:	48 bf 4d 57 80 00 00 	movabs $0x80574d,%rdi
+  802639:	00 00 00 
+  80263c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802641:	48 b9 4b 03 80 00 00 	movabs $0x80034b,%rcx
+  802648:	00 00 00 
+  80264b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80264d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802654:	eb b5                	jmp    80260b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802656:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80265d:	eb ac                	jmp    80260b <write+0x65>
+
+000000000080265f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80265f:	55                   	push   %rbp
+  802660:	48 89 e5             	mov    %rsp,%rbp
+  802663:	53                   	push   %rbx
+  802664:	48 83 ec 18          	sub    $0x18,%rsp
+  802668:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80266a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80266e:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+  80267a:	85 c0                	test   %eax,%eax
+  80267c:	78 0c                	js     80268a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80267e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802682:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802685:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80268e:	c9                   	leave
+  80268f:	c3                   	ret
+
+0000000000802690 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802690:	55                   	push   %rbp
+  802691:	48 89 e5             	mov    %rsp,%rbp
+  802694:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802698:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80269c:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  8026a3:	00 00 00 
+  8026a6:	ff d0                	call   *%rax
+  8026a8:	85 c0                	test   %eax,%eax
+  8026aa:	78 07                	js     8026b3 <tell+0x23>
+    return fdes->fd_offset;
+  8026ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026b0:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8026b3:	c9                   	leave
+  8026b4:	c3                   	ret
+
+00000000008026b5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8026b5:	55                   	push   %rbp
+  8026b6:	48 89 e5             	mov    %rsp,%rbp
+  8026b9:	41 55                	push   %r13
+  8026bb:	41 54                	push   %r12
+  8026bd:	53                   	push   %rbx
+  8026be:	48 83 ec 18          	sub    $0x18,%rsp
+  8026c2:	89 fb                	mov    %edi,%ebx
+  8026c4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026c7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026cb:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  8026d2:	00 00 00 
+  8026d5:	ff d0                	call   *%rax
+  8026d7:	85 c0                	test   %eax,%eax
+  8026d9:	78 38                	js     802713 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026db:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8026df:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8026e3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026e7:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  8026ee:	00 00 00 
+  8026f1:	ff d0                	call   *%rax
+  8026f3:	85 c0                	test   %eax,%eax
+  8026f5:	78 1c                	js     802713 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026f7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8026fc:	74 20                	je     80271e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8026fe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802702:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802706:	48 85 c0             	test   %rax,%rax
+  802709:	74 47                	je     802752 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80270b:	44 89 e6             	mov    %r12d,%esi
+  80270e:	4c 89 ef             	mov    %r13,%rdi
+  802711:	ff d0                	call   *%rax
+}
+  802713:	48 83 c4 18          	add    $0x18,%rsp
+  802717:	5b                   	pop    %rbx
+  802718:	41 5c                	pop    %r12
+  80271a:	41 5d                	pop    %r13
+  80271c:	5d                   	pop    %rbp
+  80271d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80271e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802725:	00 00 00 
+  802728:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80272e:	89 da                	mov    %ebx,%edx
+  802730:	48 bf 10 57 80 00 00 	movabs $0x805710,%rdi
+  802737:	00 00 00 
+  80273a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273f:	48 b9 4b 03 80 00 00 	movabs $0x80034b,%rcx
+  802746:	00 00 00 
+  802749:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80274b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802750:	eb c1                	jmp    802713 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802752:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802757:	eb ba                	jmp    802713 <ftruncate+0x5e>
+
+0000000000802759 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802759:	55                   	push   %rbp
+  80275a:	48 89 e5             	mov    %rsp,%rbp
+  80275d:	41 54                	push   %r12
+  80275f:	53                   	push   %rbx
+  802760:	48 83 ec 10          	sub    $0x10,%rsp
+  802764:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802767:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80276b:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  802772:	00 00 00 
+  802775:	ff d0                	call   *%rax
+  802777:	85 c0                	test   %eax,%eax
+  802779:	78 4e                	js     8027c9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80277b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80277f:	41 8b 3c 24          	mov    (%r12),%edi
+  802783:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802787:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  80278e:	00 00 00 
+  802791:	ff d0                	call   *%rax
+  802793:	85 c0                	test   %eax,%eax
+  802795:	78 32                	js     8027c9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802797:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80279b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8027a0:	74 30                	je     8027d2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8027a2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8027a5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8027ac:	00 00 00 
+    stat->st_isdir = 0;
+  8027af:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027b6:	00 00 00 
+    stat->st_dev = dev;
+  8027b9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8027c0:	48 89 de             	mov    %rbx,%rsi
+  8027c3:	4c 89 e7             	mov    %r12,%rdi
+  8027c6:	ff 50 28             	call   *0x28(%rax)
+}
+  8027c9:	48 83 c4 10          	add    $0x10,%rsp
+  8027cd:	5b                   	pop    %rbx
+  8027ce:	41 5c                	pop    %r12
+  8027d0:	5d                   	pop    %rbp
+  8027d1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8027d2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027d7:	eb f0                	jmp    8027c9 <fstat+0x70>
+
+00000000008027d9 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8027d9:	55                   	push   %rbp
+  8027da:	48 89 e5             	mov    %rsp,%rbp
+  8027dd:	41 54                	push   %r12
+  8027df:	53                   	push   %rbx
+  8027e0:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8027e7:	41 89 fc             	mov    %edi,%r12d
+  8027ea:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027ec:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027f0:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  8027f7:	00 00 00 
+  8027fa:	ff d0                	call   *%rax
+  8027fc:	85 c0                	test   %eax,%eax
+  8027fe:	78 31                	js     802831 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802800:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802807:	44 89 e7             	mov    %r12d,%edi
+  80280a:	48 b8 59 27 80 00 00 	movabs $0x802759,%rax
+  802811:	00 00 00 
+  802814:	ff d0                	call   *%rax
+  802816:	85 c0                	test   %eax,%eax
+  802818:	78 17                	js     802831 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  80281a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80281e:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802821:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802824:	39 d3                	cmp    %edx,%ebx
+  802826:	0f 4f da             	cmovg  %edx,%ebx
+  802829:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80282c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802831:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802838:	5b                   	pop    %rbx
+  802839:	41 5c                	pop    %r12
+  80283b:	5d                   	pop    %rbp
+  80283c:	c3                   	ret
+
+000000000080283d <seektoend>:
+{
+  80283d:	55                   	push   %rbp
+  80283e:	48 89 e5             	mov    %rsp,%rbp
+  802841:	53                   	push   %rbx
+  802842:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802849:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80284b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80284f:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  802856:	00 00 00 
+  802859:	ff d0                	call   *%rax
+  80285b:	85 c0                	test   %eax,%eax
+  80285d:	78 28                	js     802887 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80285f:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802866:	89 df                	mov    %ebx,%edi
+  802868:	48 b8 59 27 80 00 00 	movabs $0x802759,%rax
+  80286f:	00 00 00 
+  802872:	ff d0                	call   *%rax
+  802874:	85 c0                	test   %eax,%eax
+  802876:	78 0f                	js     802887 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802878:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80287b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80287f:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802882:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802887:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80288b:	c9                   	leave
+  80288c:	c3                   	ret
+
+000000000080288d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80288d:	55                   	push   %rbp
+  80288e:	48 89 e5             	mov    %rsp,%rbp
+  802891:	41 54                	push   %r12
+  802893:	53                   	push   %rbx
+  802894:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802897:	be 00 00 00 00       	mov    $0x0,%esi
+  80289c:	48 b8 80 34 80 00 00 	movabs $0x803480,%rax
+  8028a3:	00 00 00 
+  8028a6:	ff d0                	call   *%rax
+  8028a8:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8028aa:	85 c0                	test   %eax,%eax
+  8028ac:	78 25                	js     8028d3 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8028ae:	4c 89 e6             	mov    %r12,%rsi
+  8028b1:	89 c7                	mov    %eax,%edi
+  8028b3:	48 b8 59 27 80 00 00 	movabs $0x802759,%rax
+  8028ba:	00 00 00 
+  8028bd:	ff d0                	call   *%rax
+  8028bf:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8028c2:	89 df                	mov    %ebx,%edi
+  8028c4:	48 b8 f9 22 80 00 00 	movabs $0x8022f9,%rax
+  8028cb:	00 00 00 
+  8028ce:	ff d0                	call   *%rax
+
+    return res;
+  8028d0:	44 89 e3             	mov    %r12d,%ebx
+}
+  8028d3:	89 d8                	mov    %ebx,%eax
+  8028d5:	5b                   	pop    %rbx
+  8028d6:	41 5c                	pop    %r12
+  8028d8:	5d                   	pop    %rbp
+  8028d9:	c3                   	ret
+
+00000000008028da <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8028da:	55                   	push   %rbp
+  8028db:	48 89 e5             	mov    %rsp,%rbp
+  8028de:	53                   	push   %rbx
+  8028df:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e3:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8028e6:	48 b8 06 21 80 00 00 	movabs $0x802106,%rax
+  8028ed:	00 00 00 
+  8028f0:	ff d0                	call   *%rax
+  8028f2:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8028f6:	0f 87 ea 00 00 00    	ja     8029e6 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8028fc:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802903:	00 00 00 
+  802906:	80 38 00             	cmpb   $0x0,(%rax)
+  802909:	75 35                	jne    802940 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  80290b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802910:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802915:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  80291a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80291f:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  802926:	00 00 00 
+  802929:	ff d0                	call   *%rax
+  80292b:	85 c0                	test   %eax,%eax
+  80292d:	0f 88 ba 00 00 00    	js     8029ed <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802933:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80293a:	00 00 00 
+  80293d:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802940:	48 89 df             	mov    %rbx,%rdi
+  802943:	48 b8 06 21 80 00 00 	movabs $0x802106,%rax
+  80294a:	00 00 00 
+  80294d:	ff d0                	call   *%rax
+  80294f:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802953:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80295a:	00 00 00 
+  80295d:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802961:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802964:	39 39                	cmp    %edi,(%rcx)
+  802966:	74 46                	je     8029ae <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802968:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80296c:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802973:	00 
+  802974:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80297b:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802982:	00 
+  802983:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80298a:	00 
+  80298b:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802992:	00 
+  802993:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80299a:	00 
+  80299b:	89 39                	mov    %edi,(%rcx)
+  80299d:	48 01 c6             	add    %rax,%rsi
+  8029a0:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8029a5:	48 89 c8             	mov    %rcx,%rax
+  8029a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ac:	c9                   	leave
+  8029ad:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  8029ae:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8029b2:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  8029b9:	00 00 00 
+  8029bc:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8029bf:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  8029c3:	74 e0                	je     8029a5 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  8029c5:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8029cc:	00 
+  8029cd:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8029d1:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8029d8:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8029da:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8029dd:	48 01 c2             	add    %rax,%rdx
+  8029e0:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8029e4:	eb bf                	jmp    8029a5 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8029e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029eb:	eb b8                	jmp    8029a5 <fbuf_get+0xcb>
+            return NULL;
+  8029ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029f2:	eb b1                	jmp    8029a5 <fbuf_get+0xcb>
+
+00000000008029f4 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8029f4:	55                   	push   %rbp
+  8029f5:	48 89 e5             	mov    %rsp,%rbp
+  8029f8:	53                   	push   %rbx
+  8029f9:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8029fd:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a04:	00 00 00 
+  802a07:	48 8b 18             	mov    (%rax),%rbx
+  802a0a:	48 85 db             	test   %rbx,%rbx
+  802a0d:	74 16                	je     802a25 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802a0f:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a16:	00 00 00 
+  802a19:	48 8b 18             	mov    (%rax),%rbx
+}
+  802a1c:	48 89 d8             	mov    %rbx,%rax
+  802a1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a23:	c9                   	leave
+  802a24:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802a25:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a2a:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802a2f:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802a34:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a39:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  802a40:	00 00 00 
+  802a43:	ff d0                	call   *%rax
+  802a45:	85 c0                	test   %eax,%eax
+  802a47:	78 d3                	js     802a1c <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802a49:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802a4e:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802a55:	00 00 00 
+  802a58:	eb b5                	jmp    802a0f <fsipc_bulk+0x1b>
+
+0000000000802a5a <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802a5a:	55                   	push   %rbp
+  802a5b:	48 89 e5             	mov    %rsp,%rbp
+  802a5e:	41 57                	push   %r15
+  802a60:	41 56                	push   %r14
+  802a62:	41 55                	push   %r13
+  802a64:	41 54                	push   %r12
+  802a66:	53                   	push   %rbx
+  802a67:	48 83 ec 08          	sub    $0x8,%rsp
+  802a6b:	41 89 fd             	mov    %edi,%r13d
+  802a6e:	49 89 f6             	mov    %rsi,%r14
+  802a71:	49 89 d7             	mov    %rdx,%r15
+  802a74:	48 89 cb             	mov    %rcx,%rbx
+  802a77:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a7a:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802a81:	00 00 00 
+  802a84:	83 38 00             	cmpl   $0x0,(%rax)
+  802a87:	74 52                	je     802adb <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802a89:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a8f:	4c 89 f9             	mov    %r15,%rcx
+  802a92:	4c 89 f2             	mov    %r14,%rdx
+  802a95:	44 89 ee             	mov    %r13d,%esi
+  802a98:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802a9f:	00 00 00 
+  802aa2:	8b 38                	mov    (%rax),%edi
+  802aa4:	48 b8 3f 45 80 00 00 	movabs $0x80453f,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802ab0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ab5:	4c 89 e2             	mov    %r12,%rdx
+  802ab8:	48 89 de             	mov    %rbx,%rsi
+  802abb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ac0:	48 b8 8f 43 80 00 00 	movabs $0x80438f,%rax
+  802ac7:	00 00 00 
+  802aca:	ff d0                	call   *%rax
+}
+  802acc:	48 83 c4 08          	add    $0x8,%rsp
+  802ad0:	5b                   	pop    %rbx
+  802ad1:	41 5c                	pop    %r12
+  802ad3:	41 5d                	pop    %r13
+  802ad5:	41 5e                	pop    %r14
+  802ad7:	41 5f                	pop    %r15
+  802ad9:	5d                   	pop    %rbp
+  802ada:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802adb:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ae0:	48 b8 e2 45 80 00 00 	movabs $0x8045e2,%rax
+  802ae7:	00 00 00 
+  802aea:	ff d0                	call   *%rax
+  802aec:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802af3:	00 00 
+  802af5:	eb 92                	jmp    802a89 <fsipc_region+0x2f>
+
+0000000000802af7 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802af7:	55                   	push   %rbp
+  802af8:	48 89 e5             	mov    %rsp,%rbp
+  802afb:	41 57                	push   %r15
+  802afd:	41 56                	push   %r14
+  802aff:	41 55                	push   %r13
+  802b01:	41 54                	push   %r12
+  802b03:	53                   	push   %rbx
+  802b04:	48 83 ec 28          	sub    $0x28,%rsp
+  802b08:	49 89 ff             	mov    %rdi,%r15
+  802b0b:	49 89 f6             	mov    %rsi,%r14
+  802b0e:	48 89 d3             	mov    %rdx,%rbx
+  802b11:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802b15:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802b18:	48 b8 f4 29 80 00 00 	movabs $0x8029f4,%rax
+  802b1f:	00 00 00 
+  802b22:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802b24:	48 85 c0             	test   %rax,%rax
+  802b27:	0f 84 cc 00 00 00    	je     802bf9 <devfile_write_direct+0x102>
+  802b2d:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802b30:	48 85 db             	test   %rbx,%rbx
+  802b33:	0f 84 ba 00 00 00    	je     802bf3 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802b39:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b3f:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802b46:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802b4a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802b4e:	4c 29 e3             	sub    %r12,%rbx
+  802b51:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802b56:	48 39 c3             	cmp    %rax,%rbx
+  802b59:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b5d:	48 89 da             	mov    %rbx,%rdx
+  802b60:	4c 89 f6             	mov    %r14,%rsi
+  802b63:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802b67:	48 b8 b8 10 80 00 00 	movabs $0x8010b8,%rax
+  802b6e:	00 00 00 
+  802b71:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802b73:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b77:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802b7b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802b7e:	44 01 e0             	add    %r12d,%eax
+  802b81:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802b85:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802b89:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802b90:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802b97:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802b9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ba4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ba9:	4c 89 ee             	mov    %r13,%rsi
+  802bac:	bf 04 00 00 00       	mov    $0x4,%edi
+  802bb1:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802bb8:	00 00 00 
+  802bbb:	ff d0                	call   *%rax
+        if (res < 0)
+  802bbd:	85 c0                	test   %eax,%eax
+  802bbf:	78 29                	js     802bea <devfile_write_direct+0xf3>
+        if (res == 0)
+  802bc1:	74 2b                	je     802bee <devfile_write_direct+0xf7>
+        i += res;
+  802bc3:	48 98                	cltq
+  802bc5:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802bc8:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802bcb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bcf:	49 39 c4             	cmp    %rax,%r12
+  802bd2:	0f 82 72 ff ff ff    	jb     802b4a <devfile_write_direct+0x53>
+    return i;
+  802bd8:	4c 89 e0             	mov    %r12,%rax
+}
+  802bdb:	48 83 c4 28          	add    $0x28,%rsp
+  802bdf:	5b                   	pop    %rbx
+  802be0:	41 5c                	pop    %r12
+  802be2:	41 5d                	pop    %r13
+  802be4:	41 5e                	pop    %r14
+  802be6:	41 5f                	pop    %r15
+  802be8:	5d                   	pop    %rbp
+  802be9:	c3                   	ret
+            return res;
+  802bea:	48 98                	cltq
+  802bec:	eb ed                	jmp    802bdb <devfile_write_direct+0xe4>
+            return i;
+  802bee:	4c 89 e0             	mov    %r12,%rax
+  802bf1:	eb e8                	jmp    802bdb <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802bf3:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802bf7:	eb df                	jmp    802bd8 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802bf9:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802c00:	eb d9                	jmp    802bdb <devfile_write_direct+0xe4>
+
+0000000000802c02 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802c02:	55                   	push   %rbp
+  802c03:	48 89 e5             	mov    %rsp,%rbp
+  802c06:	41 56                	push   %r14
+  802c08:	41 55                	push   %r13
+  802c0a:	41 54                	push   %r12
+  802c0c:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802c0d:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802c11:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1a:	4d 39 ee             	cmp    %r13,%r14
+  802c1d:	0f 84 99 00 00 00    	je     802cbc <fbuf_flush+0xba>
+  802c23:	49 89 fc             	mov    %rdi,%r12
+  802c26:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802c29:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c2c:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c30:	48 b8 06 21 80 00 00 	movabs $0x802106,%rax
+  802c37:	00 00 00 
+  802c3a:	ff d0                	call   *%rax
+  802c3c:	48 89 c2             	mov    %rax,%rdx
+  802c3f:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c43:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c47:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c4b:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802c50:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c53:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c57:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802c5e:	00 
+  802c5f:	44 89 f1             	mov    %r14d,%ecx
+  802c62:	4c 89 ea             	mov    %r13,%rdx
+  802c65:	4c 89 e7             	mov    %r12,%rdi
+  802c68:	48 b8 f7 2a 80 00 00 	movabs $0x802af7,%rax
+  802c6f:	00 00 00 
+  802c72:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c74:	48 85 c0             	test   %rax,%rax
+  802c77:	78 43                	js     802cbc <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802c79:	4c 39 e8             	cmp    %r13,%rax
+  802c7c:	72 47                	jb     802cc5 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802c7e:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802c83:	83 c0 01             	add    $0x1,%eax
+  802c86:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c8b:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802c8e:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802c92:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802c96:	72 0f                	jb     802ca7 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802c98:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802c9c:	48 39 c2             	cmp    %rax,%rdx
+  802c9f:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802ca3:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802ca7:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802cae:	00 
+  802caf:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802cb6:	00 
+    return 0;
+  802cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cbc:	5b                   	pop    %rbx
+  802cbd:	41 5c                	pop    %r12
+  802cbf:	41 5d                	pop    %r13
+  802cc1:	41 5e                	pop    %r14
+  802cc3:	5d                   	pop    %rbp
+  802cc4:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802cc5:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802cca:	eb f0                	jmp    802cbc <fbuf_flush+0xba>
+
+0000000000802ccc <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802ccc:	55                   	push   %rbp
+  802ccd:	48 89 e5             	mov    %rsp,%rbp
+  802cd0:	53                   	push   %rbx
+  802cd1:	48 83 ec 08          	sub    $0x8,%rsp
+  802cd5:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802cd8:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  802cdf:	00 00 00 
+  802ce2:	ff d0                	call   *%rax
+  802ce4:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cec:	48 85 f6             	test   %rsi,%rsi
+  802cef:	74 0f                	je     802d00 <devfile_sync+0x34>
+  802cf1:	48 89 df             	mov    %rbx,%rdi
+  802cf4:	48 b8 02 2c 80 00 00 	movabs $0x802c02,%rax
+  802cfb:	00 00 00 
+  802cfe:	ff d0                	call   *%rax
+}
+  802d00:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d04:	c9                   	leave
+  802d05:	c3                   	ret
+
+0000000000802d06 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802d06:	55                   	push   %rbp
+  802d07:	48 89 e5             	mov    %rsp,%rbp
+  802d0a:	48 83 ec 10          	sub    $0x10,%rsp
+  802d0e:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802d11:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802d18:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802d19:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802d1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d22:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802d29:	00 00 00 
+  802d2c:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+}
+  802d38:	c9                   	leave
+  802d39:	c3                   	ret
+
+0000000000802d3a <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d3a:	55                   	push   %rbp
+  802d3b:	48 89 e5             	mov    %rsp,%rbp
+  802d3e:	41 54                	push   %r12
+  802d40:	53                   	push   %rbx
+  802d41:	48 89 fb             	mov    %rdi,%rbx
+  802d44:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802d47:	48 b8 cc 2c 80 00 00 	movabs $0x802ccc,%rax
+  802d4e:	00 00 00 
+  802d51:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d53:	85 c0                	test   %eax,%eax
+  802d55:	78 63                	js     802dba <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d57:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d5a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802d61:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802d63:	be 00 00 00 00       	mov    $0x0,%esi
+  802d68:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d6d:	48 b8 06 2d 80 00 00 	movabs $0x802d06,%rax
+  802d74:	00 00 00 
+  802d77:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d79:	85 c0                	test   %eax,%eax
+  802d7b:	78 3d                	js     802dba <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802d7d:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802d84:	00 00 00 
+  802d87:	48 89 de             	mov    %rbx,%rsi
+  802d8a:	4c 89 e7             	mov    %r12,%rdi
+  802d8d:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  802d94:	00 00 00 
+  802d97:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802d99:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802d9f:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802da6:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802da7:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802dad:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802db4:	00 
+
+    return 0;
+  802db5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dba:	5b                   	pop    %rbx
+  802dbb:	41 5c                	pop    %r12
+  802dbd:	5d                   	pop    %rbp
+  802dbe:	c3                   	ret
+
+0000000000802dbf <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802dbf:	55                   	push   %rbp
+  802dc0:	48 89 e5             	mov    %rsp,%rbp
+  802dc3:	41 54                	push   %r12
+  802dc5:	53                   	push   %rbx
+  802dc6:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802dc9:	48 b8 cc 2c 80 00 00 	movabs $0x802ccc,%rax
+  802dd0:	00 00 00 
+  802dd3:	ff d0                	call   *%rax
+  802dd5:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802dd8:	48 89 df             	mov    %rbx,%rdi
+  802ddb:	48 b8 06 21 80 00 00 	movabs $0x802106,%rax
+  802de2:	00 00 00 
+  802de5:	ff d0                	call   *%rax
+  802de7:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802deb:	76 2e                	jbe    802e1b <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802ded:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802df0:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802df7:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802df9:	be 00 00 00 00       	mov    $0x0,%esi
+  802dfe:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802e03:	48 b8 06 2d 80 00 00 	movabs $0x802d06,%rax
+  802e0a:	00 00 00 
+  802e0d:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802e0f:	45 85 e4             	test   %r12d,%r12d
+  802e12:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802e16:	5b                   	pop    %rbx
+  802e17:	41 5c                	pop    %r12
+  802e19:	5d                   	pop    %rbp
+  802e1a:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802e1b:	48 89 df             	mov    %rbx,%rdi
+  802e1e:	48 b8 06 21 80 00 00 	movabs $0x802106,%rax
+  802e25:	00 00 00 
+  802e28:	ff d0                	call   *%rax
+  802e2a:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802e2e:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802e35:	00 00 00 
+  802e38:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802e3f:	48 89 df             	mov    %rbx,%rdi
+  802e42:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  802e49:	00 00 00 
+  802e4c:	ff d0                	call   *%rax
+  802e4e:	48 89 c6             	mov    %rax,%rsi
+  802e51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5b:	48 b8 02 16 80 00 00 	movabs $0x801602,%rax
+  802e62:	00 00 00 
+  802e65:	ff d0                	call   *%rax
+  802e67:	eb 84                	jmp    802ded <devfile_flush+0x2e>
+
+0000000000802e69 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e69:	55                   	push   %rbp
+  802e6a:	48 89 e5             	mov    %rsp,%rbp
+  802e6d:	41 55                	push   %r13
+  802e6f:	41 54                	push   %r12
+  802e71:	53                   	push   %rbx
+  802e72:	48 83 ec 08          	sub    $0x8,%rsp
+  802e76:	48 89 fb             	mov    %rdi,%rbx
+  802e79:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802e7c:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  802e83:	00 00 00 
+  802e86:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e88:	48 85 c0             	test   %rax,%rax
+  802e8b:	74 51                	je     802ede <devfile_trunc+0x75>
+  802e8d:	49 89 c4             	mov    %rax,%r12
+  802e90:	48 89 c6             	mov    %rax,%rsi
+  802e93:	48 89 df             	mov    %rbx,%rdi
+  802e96:	48 b8 02 2c 80 00 00 	movabs $0x802c02,%rax
+  802e9d:	00 00 00 
+  802ea0:	ff d0                	call   *%rax
+  802ea2:	85 c0                	test   %eax,%eax
+  802ea4:	78 2d                	js     802ed3 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802ea6:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802ead:	00 00 00 
+  802eb0:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802eb3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802eb5:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802eb9:	be 00 00 00 00       	mov    $0x0,%esi
+  802ebe:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ec3:	48 b8 06 2d 80 00 00 	movabs $0x802d06,%rax
+  802eca:	00 00 00 
+  802ecd:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ecf:	85 c0                	test   %eax,%eax
+  802ed1:	79 3e                	jns    802f11 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802ed3:	48 83 c4 08          	add    $0x8,%rsp
+  802ed7:	5b                   	pop    %rbx
+  802ed8:	41 5c                	pop    %r12
+  802eda:	41 5d                	pop    %r13
+  802edc:	5d                   	pop    %rbp
+  802edd:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802ede:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802ee5:	00 00 00 
+  802ee8:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802eeb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802eed:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ef1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef6:	bf 02 00 00 00       	mov    $0x2,%edi
+  802efb:	48 b8 06 2d 80 00 00 	movabs $0x802d06,%rax
+  802f02:	00 00 00 
+  802f05:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802f07:	85 c0                	test   %eax,%eax
+  802f09:	78 c8                	js     802ed3 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f0b:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f0f:	eb c2                	jmp    802ed3 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f11:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802f14:	8d 51 01             	lea    0x1(%rcx),%edx
+  802f17:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f1a:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802f1f:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f26:	00 00 
+  802f28:	eb a9                	jmp    802ed3 <devfile_trunc+0x6a>
+
+0000000000802f2a <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802f2a:	55                   	push   %rbp
+  802f2b:	48 89 e5             	mov    %rsp,%rbp
+  802f2e:	41 57                	push   %r15
+  802f30:	41 56                	push   %r14
+  802f32:	41 55                	push   %r13
+  802f34:	41 54                	push   %r12
+  802f36:	53                   	push   %rbx
+  802f37:	48 83 ec 28          	sub    $0x28,%rsp
+  802f3b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f3f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f43:	49 89 d7             	mov    %rdx,%r15
+  802f46:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f4a:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  802f51:	00 00 00 
+  802f54:	ff d0                	call   *%rax
+  802f56:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802f59:	48 85 c0             	test   %rax,%rax
+  802f5c:	74 31                	je     802f8f <devfile_write+0x65>
+  802f5e:	4c 89 f8             	mov    %r15,%rax
+  802f61:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802f68:	77 25                	ja     802f8f <devfile_write+0x65>
+    size_t i = 0;
+  802f6a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802f70:	48 85 c0             	test   %rax,%rax
+  802f73:	0f 85 64 01 00 00    	jne    8030dd <devfile_write+0x1b3>
+    size_t i = 0;
+  802f79:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802f7d:	4c 89 f8             	mov    %r15,%rax
+}
+  802f80:	48 83 c4 28          	add    $0x28,%rsp
+  802f84:	5b                   	pop    %rbx
+  802f85:	41 5c                	pop    %r12
+  802f87:	41 5d                	pop    %r13
+  802f89:	41 5e                	pop    %r14
+  802f8b:	41 5f                	pop    %r15
+  802f8d:	5d                   	pop    %rbp
+  802f8e:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f8f:	48 85 db             	test   %rbx,%rbx
+  802f92:	74 5b                	je     802fef <devfile_write+0xc5>
+  802f94:	48 89 de             	mov    %rbx,%rsi
+  802f97:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f9b:	48 b8 02 2c 80 00 00 	movabs $0x802c02,%rax
+  802fa2:	00 00 00 
+  802fa5:	ff d0                	call   *%rax
+  802fa7:	85 c0                	test   %eax,%eax
+  802fa9:	78 40                	js     802feb <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802fab:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802faf:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802fb2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fb6:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802fba:	48 b8 f7 2a 80 00 00 	movabs $0x802af7,%rax
+  802fc1:	00 00 00 
+  802fc4:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802fc6:	48 85 c0             	test   %rax,%rax
+  802fc9:	7e b5                	jle    802f80 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802fcb:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802fcf:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802fd2:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802fd5:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802fd8:	8d 51 01             	lea    0x1(%rcx),%edx
+  802fdb:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802fde:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802fe1:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802fe8:	00 
+  802fe9:	eb 95                	jmp    802f80 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802feb:	48 98                	cltq
+  802fed:	eb 91                	jmp    802f80 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802fef:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802ff3:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802ff6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ffa:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802ffe:	48 89 df             	mov    %rbx,%rdi
+  803001:	48 b8 f7 2a 80 00 00 	movabs $0x802af7,%rax
+  803008:	00 00 00 
+  80300b:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80300d:	48 85 c0             	test   %rax,%rax
+  803010:	0f 8e 6a ff ff ff    	jle    802f80 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803016:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803019:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80301d:	e9 5e ff ff ff       	jmp    802f80 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803022:	48 98                	cltq
+  803024:	4d 85 ff             	test   %r15,%r15
+  803027:	49 0f 45 c7          	cmovne %r15,%rax
+  80302b:	e9 50 ff ff ff       	jmp    802f80 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803030:	48 89 de             	mov    %rbx,%rsi
+  803033:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803037:	48 b8 02 2c 80 00 00 	movabs $0x802c02,%rax
+  80303e:	00 00 00 
+  803041:	ff d0                	call   *%rax
+  803043:	85 c0                	test   %eax,%eax
+  803045:	0f 88 2b 01 00 00    	js     803176 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80304b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80304f:	4c 01 f8             	add    %r15,%rax
+  803052:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803056:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80305a:	48 b9 06 21 80 00 00 	movabs $0x802106,%rcx
+  803061:	00 00 00 
+  803064:	ff d1                	call   *%rcx
+  803066:	48 89 c2             	mov    %rax,%rdx
+  803069:	48 c1 e2 04          	shl    $0x4,%rdx
+  80306d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803071:	48 c1 e0 0c          	shl    $0xc,%rax
+  803075:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  80307a:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80307d:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803084:	00 
+  803085:	4c 89 ea             	mov    %r13,%rdx
+  803088:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80308c:	48 b8 b8 10 80 00 00 	movabs $0x8010b8,%rax
+  803093:	00 00 00 
+  803096:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803098:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80309c:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8030a0:	48 39 c2             	cmp    %rax,%rdx
+  8030a3:	0f 84 db 00 00 00    	je     803184 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  8030a9:	4c 39 e2             	cmp    %r12,%rdx
+  8030ac:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  8030b0:	4d 01 ec             	add    %r13,%r12
+  8030b3:	49 39 c4             	cmp    %rax,%r12
+  8030b6:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  8030ba:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  8030be:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  8030c2:	45 01 ee             	add    %r13d,%r14d
+  8030c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030c9:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  8030cd:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  8030d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030d4:	49 39 c7             	cmp    %rax,%r15
+  8030d7:	0f 83 a0 fe ff ff    	jae    802f7d <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  8030dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030e1:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  8030e5:	8b 43 08             	mov    0x8(%rbx),%eax
+  8030e8:	44 39 f0             	cmp    %r14d,%eax
+  8030eb:	7f 10                	jg     8030fd <devfile_write+0x1d3>
+  8030ed:	48 98                	cltq
+  8030ef:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  8030f5:	49 63 d6             	movslq %r14d,%rdx
+  8030f8:	48 39 d0             	cmp    %rdx,%rax
+  8030fb:	7d 2d                	jge    80312a <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8030fd:	48 89 de             	mov    %rbx,%rsi
+  803100:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803104:	48 b8 02 2c 80 00 00 	movabs $0x802c02,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+  803110:	85 c0                	test   %eax,%eax
+  803112:	0f 88 0a ff ff ff    	js     803022 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803118:	44 89 f0             	mov    %r14d,%eax
+  80311b:	66 b8 00 00          	mov    $0x0,%ax
+  80311f:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803122:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803129:	00 
+        size_t off = pos - fb->fb_base;
+  80312a:	45 89 f4             	mov    %r14d,%r12d
+  80312d:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803131:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803134:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803138:	4d 29 fd             	sub    %r15,%r13
+  80313b:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803140:	4c 29 e0             	sub    %r12,%rax
+  803143:	49 39 c5             	cmp    %rax,%r13
+  803146:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  80314a:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80314e:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803152:	48 39 c2             	cmp    %rax,%rdx
+  803155:	0f 84 f0 fe ff ff    	je     80304b <devfile_write+0x121>
+  80315b:	4c 39 e0             	cmp    %r12,%rax
+  80315e:	0f 82 cc fe ff ff    	jb     803030 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803164:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803168:	48 39 d0             	cmp    %rdx,%rax
+  80316b:	0f 83 da fe ff ff    	jae    80304b <devfile_write+0x121>
+  803171:	e9 ba fe ff ff       	jmp    803030 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803176:	48 98                	cltq
+  803178:	4d 85 ff             	test   %r15,%r15
+  80317b:	49 0f 45 c7          	cmovne %r15,%rax
+  80317f:	e9 fc fd ff ff       	jmp    802f80 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803184:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803188:	4c 89 e2             	mov    %r12,%rdx
+  80318b:	e9 2a ff ff ff       	jmp    8030ba <devfile_write+0x190>
+
+0000000000803190 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803190:	55                   	push   %rbp
+  803191:	48 89 e5             	mov    %rsp,%rbp
+  803194:	41 57                	push   %r15
+  803196:	41 56                	push   %r14
+  803198:	41 55                	push   %r13
+  80319a:	41 54                	push   %r12
+  80319c:	53                   	push   %rbx
+  80319d:	48 83 ec 28          	sub    $0x28,%rsp
+  8031a1:	49 89 ff             	mov    %rdi,%r15
+  8031a4:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8031a8:	48 89 d3             	mov    %rdx,%rbx
+  8031ab:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8031af:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  8031b6:	00 00 00 
+  8031b9:	ff d0                	call   *%rax
+  8031bb:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8031be:	48 85 c0             	test   %rax,%rax
+  8031c1:	74 0d                	je     8031d0 <devfile_read+0x40>
+  8031c3:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8031ca:	0f 86 1a 01 00 00    	jbe    8032ea <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8031d0:	4d 85 e4             	test   %r12,%r12
+  8031d3:	74 1a                	je     8031ef <devfile_read+0x5f>
+  8031d5:	4c 89 e6             	mov    %r12,%rsi
+  8031d8:	4c 89 ff             	mov    %r15,%rdi
+  8031db:	48 b8 02 2c 80 00 00 	movabs $0x802c02,%rax
+  8031e2:	00 00 00 
+  8031e5:	ff d0                	call   *%rax
+  8031e7:	85 c0                	test   %eax,%eax
+  8031e9:	0f 88 e8 00 00 00    	js     8032d7 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8031ef:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8031f3:	48 b8 f4 29 80 00 00 	movabs $0x8029f4,%rax
+  8031fa:	00 00 00 
+  8031fd:	ff d0                	call   *%rax
+  8031ff:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803202:	48 85 c0             	test   %rax,%rax
+  803205:	0f 84 69 02 00 00    	je     803474 <devfile_read+0x2e4>
+    while (i < n) {
+  80320b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803210:	0f 84 ce 00 00 00    	je     8032e4 <devfile_read+0x154>
+    size_t i = 0;
+  803216:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80321b:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803222:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803226:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80322a:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  80322e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803232:	48 29 da             	sub    %rbx,%rdx
+  803235:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80323a:	48 39 c2             	cmp    %rax,%rdx
+  80323d:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803241:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803245:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803249:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80324c:	01 d8                	add    %ebx,%eax
+  80324e:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803252:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803256:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  80325d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803264:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80326b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803271:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803276:	4c 89 ee             	mov    %r13,%rsi
+  803279:	bf 03 00 00 00       	mov    $0x3,%edi
+  80327e:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  803285:	00 00 00 
+  803288:	ff d0                	call   *%rax
+        if (res < 0)
+  80328a:	85 c0                	test   %eax,%eax
+  80328c:	78 4d                	js     8032db <devfile_read+0x14b>
+        if (res == 0)
+  80328e:	74 4f                	je     8032df <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803290:	4c 63 e0             	movslq %eax,%r12
+  803293:	4c 89 e2             	mov    %r12,%rdx
+  803296:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80329a:	4c 89 f7             	mov    %r14,%rdi
+  80329d:	48 b8 b8 10 80 00 00 	movabs $0x8010b8,%rax
+  8032a4:	00 00 00 
+  8032a7:	ff d0                	call   *%rax
+        i += res;
+  8032a9:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8032ac:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8032af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032b3:	48 39 c3             	cmp    %rax,%rbx
+  8032b6:	0f 82 72 ff ff ff    	jb     80322e <devfile_read+0x9e>
+    return i;
+  8032bc:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8032bf:	48 85 c0             	test   %rax,%rax
+  8032c2:	7e 04                	jle    8032c8 <devfile_read+0x138>
+  8032c4:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8032c8:	48 83 c4 28          	add    $0x28,%rsp
+  8032cc:	5b                   	pop    %rbx
+  8032cd:	41 5c                	pop    %r12
+  8032cf:	41 5d                	pop    %r13
+  8032d1:	41 5e                	pop    %r14
+  8032d3:	41 5f                	pop    %r15
+  8032d5:	5d                   	pop    %rbp
+  8032d6:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8032d7:	48 98                	cltq
+  8032d9:	eb ed                	jmp    8032c8 <devfile_read+0x138>
+            return res;
+  8032db:	48 98                	cltq
+  8032dd:	eb e9                	jmp    8032c8 <devfile_read+0x138>
+            return i;
+  8032df:	48 89 d8             	mov    %rbx,%rax
+  8032e2:	eb db                	jmp    8032bf <devfile_read+0x12f>
+    size_t i = 0;
+  8032e4:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8032e8:	eb d2                	jmp    8032bc <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8032ea:	48 89 c6             	mov    %rax,%rsi
+  8032ed:	4c 89 ff             	mov    %r15,%rdi
+  8032f0:	48 b8 02 2c 80 00 00 	movabs $0x802c02,%rax
+  8032f7:	00 00 00 
+  8032fa:	ff d0                	call   *%rax
+  8032fc:	85 c0                	test   %eax,%eax
+  8032fe:	78 40                	js     803340 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803300:	4c 89 ff             	mov    %r15,%rdi
+  803303:	48 b8 06 21 80 00 00 	movabs $0x802106,%rax
+  80330a:	00 00 00 
+  80330d:	ff d0                	call   *%rax
+  80330f:	48 89 c2             	mov    %rax,%rdx
+  803312:	48 c1 e2 04          	shl    $0x4,%rdx
+  803316:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80331a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80331e:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803323:	48 01 d0             	add    %rdx,%rax
+  803326:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80332a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80332f:	0f 84 33 01 00 00    	je     803468 <devfile_read+0x2d8>
+    size_t i = 0;
+  803335:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80333b:	e9 f5 00 00 00       	jmp    803435 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803340:	48 98                	cltq
+  803342:	eb 84                	jmp    8032c8 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803344:	44 89 e8             	mov    %r13d,%eax
+  803347:	66 b8 00 00          	mov    $0x0,%ax
+  80334b:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803350:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803357:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803359:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80335d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803361:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803363:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803368:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80336b:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803372:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803373:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803379:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80337e:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803383:	bf 03 00 00 00       	mov    $0x3,%edi
+  803388:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  80338f:	00 00 00 
+  803392:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803394:	85 c0                	test   %eax,%eax
+  803396:	0f 88 be 00 00 00    	js     80345a <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80339c:	48 63 d0             	movslq %eax,%rdx
+  80339f:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8033a4:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8033a9:	44 39 e8             	cmp    %r13d,%eax
+  8033ac:	0f 8e ba 00 00 00    	jle    80346c <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8033b2:	49 63 c5             	movslq %r13d,%rax
+  8033b5:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8033ba:	48 29 c3             	sub    %rax,%rbx
+  8033bd:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8033c2:	48 01 c3             	add    %rax,%rbx
+  8033c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033c9:	4c 29 f0             	sub    %r14,%rax
+  8033cc:	48 39 c3             	cmp    %rax,%rbx
+  8033cf:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8033d3:	4c 89 ff             	mov    %r15,%rdi
+  8033d6:	48 b9 06 21 80 00 00 	movabs $0x802106,%rcx
+  8033dd:	00 00 00 
+  8033e0:	ff d1                	call   *%rcx
+  8033e2:	48 89 c2             	mov    %rax,%rdx
+  8033e5:	48 c1 e2 04          	shl    $0x4,%rdx
+  8033e9:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8033ed:	48 c1 e0 0c          	shl    $0xc,%rax
+  8033f1:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8033f6:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8033f9:	44 89 ea             	mov    %r13d,%edx
+  8033fc:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803401:	48 63 d2             	movslq %edx,%rdx
+  803404:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80340b:	00 
+  80340c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803410:	4c 01 f7             	add    %r14,%rdi
+  803413:	48 89 da             	mov    %rbx,%rdx
+  803416:	48 b9 b8 10 80 00 00 	movabs $0x8010b8,%rcx
+  80341d:	00 00 00 
+  803420:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803422:	41 01 dd             	add    %ebx,%r13d
+  803425:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803429:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80342c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803430:	49 39 c6             	cmp    %rax,%r14
+  803433:	73 37                	jae    80346c <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803435:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803439:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80343e:	44 39 e8             	cmp    %r13d,%eax
+  803441:	0f 8f fd fe ff ff    	jg     803344 <devfile_read+0x1b4>
+  803447:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80344c:	44 39 e8             	cmp    %r13d,%eax
+  80344f:	0f 8f 5d ff ff ff    	jg     8033b2 <devfile_read+0x222>
+  803455:	e9 ea fe ff ff       	jmp    803344 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80345a:	48 98                	cltq
+  80345c:	4d 85 f6             	test   %r14,%r14
+  80345f:	49 0f 45 c6          	cmovne %r14,%rax
+  803463:	e9 60 fe ff ff       	jmp    8032c8 <devfile_read+0x138>
+    size_t i = 0;
+  803468:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80346c:	4c 89 f0             	mov    %r14,%rax
+  80346f:	e9 54 fe ff ff       	jmp    8032c8 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803474:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80347b:	e9 48 fe ff ff       	jmp    8032c8 <devfile_read+0x138>
+
+0000000000803480 <open>:
+open(const char *path, int mode) {
+  803480:	55                   	push   %rbp
+  803481:	48 89 e5             	mov    %rsp,%rbp
+  803484:	41 55                	push   %r13
+  803486:	41 54                	push   %r12
+  803488:	53                   	push   %rbx
+  803489:	48 83 ec 18          	sub    $0x18,%rsp
+  80348d:	49 89 fc             	mov    %rdi,%r12
+  803490:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803493:	48 b8 85 0c 80 00 00 	movabs $0x800c85,%rax
+  80349a:	00 00 00 
+  80349d:	ff d0                	call   *%rax
+  80349f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8034a5:	0f 87 8a 00 00 00    	ja     803535 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8034ab:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8034af:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8034b6:	00 00 00 
+  8034b9:	ff d0                	call   *%rax
+  8034bb:	89 c3                	mov    %eax,%ebx
+  8034bd:	85 c0                	test   %eax,%eax
+  8034bf:	78 50                	js     803511 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8034c1:	4c 89 e6             	mov    %r12,%rsi
+  8034c4:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8034cb:	00 00 00 
+  8034ce:	48 89 df             	mov    %rbx,%rdi
+  8034d1:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  8034d8:	00 00 00 
+  8034db:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8034dd:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8034e4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8034e8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034ed:	48 b8 06 2d 80 00 00 	movabs $0x802d06,%rax
+  8034f4:	00 00 00 
+  8034f7:	ff d0                	call   *%rax
+  8034f9:	89 c3                	mov    %eax,%ebx
+  8034fb:	85 c0                	test   %eax,%eax
+  8034fd:	78 1f                	js     80351e <open+0x9e>
+    return fd2num(fd);
+  8034ff:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803503:	48 b8 06 21 80 00 00 	movabs $0x802106,%rax
+  80350a:	00 00 00 
+  80350d:	ff d0                	call   *%rax
+  80350f:	89 c3                	mov    %eax,%ebx
+}
+  803511:	89 d8                	mov    %ebx,%eax
+  803513:	48 83 c4 18          	add    $0x18,%rsp
+  803517:	5b                   	pop    %rbx
+  803518:	41 5c                	pop    %r12
+  80351a:	41 5d                	pop    %r13
+  80351c:	5d                   	pop    %rbp
+  80351d:	c3                   	ret
+        fd_close(fd, 0);
+  80351e:	be 00 00 00 00       	mov    $0x0,%esi
+  803523:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803527:	48 b8 4f 22 80 00 00 	movabs $0x80224f,%rax
+  80352e:	00 00 00 
+  803531:	ff d0                	call   *%rax
+        return res;
+  803533:	eb dc                	jmp    803511 <open+0x91>
+        return -E_BAD_PATH;
+  803535:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80353a:	eb d5                	jmp    803511 <open+0x91>
+
+000000000080353c <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80353c:	55                   	push   %rbp
+  80353d:	48 89 e5             	mov    %rsp,%rbp
+  803540:	41 57                	push   %r15
+  803542:	41 56                	push   %r14
+  803544:	41 55                	push   %r13
+  803546:	41 54                	push   %r12
+  803548:	53                   	push   %rbx
+  803549:	48 83 ec 18          	sub    $0x18,%rsp
+  80354d:	41 89 f6             	mov    %esi,%r14d
+  803550:	49 89 d7             	mov    %rdx,%r15
+  803553:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803556:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80355a:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  803561:	00 00 00 
+  803564:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803566:	85 c0                	test   %eax,%eax
+  803568:	0f 88 db 00 00 00    	js     803649 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80356e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803572:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803579:	00 00 00 
+  80357c:	8b 00                	mov    (%rax),%eax
+  80357e:	39 07                	cmp    %eax,(%rdi)
+  803580:	0f 85 db 00 00 00    	jne    803661 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803586:	45 85 f6             	test   %r14d,%r14d
+  803589:	0f 88 db 00 00 00    	js     80366a <fmap+0x12e>
+  80358f:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803596:	0f 85 d7 00 00 00    	jne    803673 <fmap+0x137>
+  80359c:	4c 89 fb             	mov    %r15,%rbx
+  80359f:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8035a5:	0f 85 d1 00 00 00    	jne    80367c <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8035ab:	48 b8 cc 2c 80 00 00 	movabs $0x802ccc,%rax
+  8035b2:	00 00 00 
+  8035b5:	ff d0                	call   *%rax
+  8035b7:	85 c0                	test   %eax,%eax
+  8035b9:	0f 88 8e 00 00 00    	js     80364d <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8035bf:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8035c6:	00 00 00 
+    while (i < n) {
+  8035c9:	4d 85 ed             	test   %r13,%r13
+  8035cc:	0f 84 8a 00 00 00    	je     80365c <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8035d2:	4c 89 ea             	mov    %r13,%rdx
+  8035d5:	48 29 da             	sub    %rbx,%rdx
+  8035d8:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8035df:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8035e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8035e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035ed:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035f0:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8035f4:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8035f8:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8035fd:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803602:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803606:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80360a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80360f:	4c 89 e6             	mov    %r12,%rsi
+  803612:	bf 09 00 00 00       	mov    $0x9,%edi
+  803617:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  80361e:	00 00 00 
+  803621:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803623:	85 c0                	test   %eax,%eax
+  803625:	78 2a                	js     803651 <fmap+0x115>
+        i += res;
+  803627:	48 98                	cltq
+  803629:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80362c:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803630:	72 05                	jb     803637 <fmap+0xfb>
+    while (i < n) {
+  803632:	4c 39 eb             	cmp    %r13,%rbx
+  803635:	72 9b                	jb     8035d2 <fmap+0x96>
+    }
+    return i;
+  803637:	48 89 d8             	mov    %rbx,%rax
+}
+  80363a:	48 83 c4 18          	add    $0x18,%rsp
+  80363e:	5b                   	pop    %rbx
+  80363f:	41 5c                	pop    %r12
+  803641:	41 5d                	pop    %r13
+  803643:	41 5e                	pop    %r14
+  803645:	41 5f                	pop    %r15
+  803647:	5d                   	pop    %rbp
+  803648:	c3                   	ret
+    if (res < 0) return res;
+  803649:	48 98                	cltq
+  80364b:	eb ed                	jmp    80363a <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80364d:	48 98                	cltq
+  80364f:	eb e9                	jmp    80363a <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803651:	48 98                	cltq
+  803653:	48 85 db             	test   %rbx,%rbx
+  803656:	48 0f 45 c3          	cmovne %rbx,%rax
+  80365a:	eb de                	jmp    80363a <fmap+0xfe>
+    size_t i = 0;
+  80365c:	4c 89 eb             	mov    %r13,%rbx
+  80365f:	eb d6                	jmp    803637 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803661:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803668:	eb d0                	jmp    80363a <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80366a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803671:	eb c7                	jmp    80363a <fmap+0xfe>
+  803673:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80367a:	eb be                	jmp    80363a <fmap+0xfe>
+  80367c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803683:	eb b5                	jmp    80363a <fmap+0xfe>
+
+0000000000803685 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803685:	55                   	push   %rbp
+  803686:	48 89 e5             	mov    %rsp,%rbp
+  803689:	41 56                	push   %r14
+  80368b:	41 55                	push   %r13
+  80368d:	41 54                	push   %r12
+  80368f:	53                   	push   %rbx
+  803690:	48 83 ec 10          	sub    $0x10,%rsp
+  803694:	89 fb                	mov    %edi,%ebx
+  803696:	41 89 f4             	mov    %esi,%r12d
+  803699:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80369c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036a0:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  8036a7:	00 00 00 
+  8036aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036ac:	85 c0                	test   %eax,%eax
+  8036ae:	78 63                	js     803713 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8036b0:	45 85 e4             	test   %r12d,%r12d
+  8036b3:	0f 88 80 00 00 00    	js     803739 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8036b9:	45 89 e6             	mov    %r12d,%r14d
+  8036bc:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8036c3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036c7:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  8036ce:	00 00 00 
+  8036d1:	ff d0                	call   *%rax
+  8036d3:	48 89 c2             	mov    %rax,%rdx
+  8036d6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036db:	44 89 f6             	mov    %r14d,%esi
+  8036de:	89 df                	mov    %ebx,%edi
+  8036e0:	48 b8 3c 35 80 00 00 	movabs $0x80353c,%rax
+  8036e7:	00 00 00 
+  8036ea:	ff d0                	call   *%rax
+  8036ec:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8036ef:	45 29 f4             	sub    %r14d,%r12d
+  8036f2:	4d 63 f4             	movslq %r12d,%r14
+  8036f5:	49 39 c6             	cmp    %rax,%r14
+  8036f8:	7c 1d                	jl     803717 <read_map+0x92>
+  8036fa:	48 85 c0             	test   %rax,%rax
+  8036fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803702:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803706:	48 83 c4 10          	add    $0x10,%rsp
+  80370a:	5b                   	pop    %rbx
+  80370b:	41 5c                	pop    %r12
+  80370d:	41 5d                	pop    %r13
+  80370f:	41 5e                	pop    %r14
+  803711:	5d                   	pop    %rbp
+  803712:	c3                   	ret
+    if (res < 0) return res;
+  803713:	48 98                	cltq
+  803715:	eb ef                	jmp    803706 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803717:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80371b:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  803722:	00 00 00 
+  803725:	ff d0                	call   *%rax
+  803727:	4d 63 e4             	movslq %r12d,%r12
+  80372a:	4c 01 e0             	add    %r12,%rax
+  80372d:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803731:	48 89 d8             	mov    %rbx,%rax
+  803734:	4c 29 f0             	sub    %r14,%rax
+  803737:	eb cd                	jmp    803706 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803739:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803740:	eb c4                	jmp    803706 <read_map+0x81>
+
+0000000000803742 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803742:	55                   	push   %rbp
+  803743:	48 89 e5             	mov    %rsp,%rbp
+  803746:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80374a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80374e:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  803755:	00 00 00 
+  803758:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80375a:	85 c0                	test   %eax,%eax
+  80375c:	78 4a                	js     8037a8 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80375e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803762:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803769:	00 00 00 
+  80376c:	8b 00                	mov    (%rax),%eax
+  80376e:	39 07                	cmp    %eax,(%rdi)
+  803770:	75 38                	jne    8037aa <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803772:	48 b8 cc 2c 80 00 00 	movabs $0x802ccc,%rax
+  803779:	00 00 00 
+  80377c:	ff d0                	call   *%rax
+  80377e:	85 c0                	test   %eax,%eax
+  803780:	78 26                	js     8037a8 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803782:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803786:	8b 40 0c             	mov    0xc(%rax),%eax
+  803789:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803790:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803792:	be 00 00 00 00       	mov    $0x0,%esi
+  803797:	bf 06 00 00 00       	mov    $0x6,%edi
+  80379c:	48 b8 06 2d 80 00 00 	movabs $0x802d06,%rax
+  8037a3:	00 00 00 
+  8037a6:	ff d0                	call   *%rax
+}
+  8037a8:	c9                   	leave
+  8037a9:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8037aa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8037af:	eb f7                	jmp    8037a8 <fsync+0x66>
+
+00000000008037b1 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8037b1:	55                   	push   %rbp
+  8037b2:	48 89 e5             	mov    %rsp,%rbp
+  8037b5:	41 57                	push   %r15
+  8037b7:	41 56                	push   %r14
+  8037b9:	41 55                	push   %r13
+  8037bb:	41 54                	push   %r12
+  8037bd:	53                   	push   %rbx
+  8037be:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8037c2:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8037c9:	00 00 00 
+  8037cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8037d1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8037d7:	49 bd 94 21 80 00 00 	movabs $0x802194,%r13
+  8037de:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8037e1:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8037e8:	00 00 00 
+  8037eb:	eb 0c                	jmp    8037f9 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8037ed:	83 c3 01             	add    $0x1,%ebx
+  8037f0:	49 83 c4 28          	add    $0x28,%r12
+  8037f4:	83 fb 20             	cmp    $0x20,%ebx
+  8037f7:	74 33                	je     80382c <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8037f9:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8037fe:	74 ed                	je     8037ed <flushall+0x3c>
+  803800:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803804:	89 df                	mov    %ebx,%edi
+  803806:	41 ff d5             	call   *%r13
+  803809:	85 c0                	test   %eax,%eax
+  80380b:	78 e0                	js     8037ed <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80380d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803811:	41 8b 06             	mov    (%r14),%eax
+  803814:	39 07                	cmp    %eax,(%rdi)
+  803816:	75 d5                	jne    8037ed <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803818:	48 b8 cc 2c 80 00 00 	movabs $0x802ccc,%rax
+  80381f:	00 00 00 
+  803822:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803824:	85 c0                	test   %eax,%eax
+  803826:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80382a:	eb c1                	jmp    8037ed <flushall+0x3c>
+    }
+    return res;
+}
+  80382c:	44 89 f8             	mov    %r15d,%eax
+  80382f:	48 83 c4 18          	add    $0x18,%rsp
+  803833:	5b                   	pop    %rbx
+  803834:	41 5c                	pop    %r12
+  803836:	41 5d                	pop    %r13
+  803838:	41 5e                	pop    %r14
+  80383a:	41 5f                	pop    %r15
+  80383c:	5d                   	pop    %rbp
+  80383d:	c3                   	ret
+
+000000000080383e <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80383e:	55                   	push   %rbp
+  80383f:	48 89 e5             	mov    %rsp,%rbp
+  803842:	53                   	push   %rbx
+  803843:	48 83 ec 08          	sub    $0x8,%rsp
+  803847:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80384a:	40 0f b6 c6          	movzbl %sil,%eax
+  80384e:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803855:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803857:	be 00 00 00 00       	mov    $0x0,%esi
+  80385c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803861:	48 b8 06 2d 80 00 00 	movabs $0x802d06,%rax
+  803868:	00 00 00 
+  80386b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80386d:	85 c0                	test   %eax,%eax
+  80386f:	78 23                	js     803894 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803871:	ba 58 06 00 00       	mov    $0x658,%edx
+  803876:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80387d:	00 00 00 
+  803880:	48 89 df             	mov    %rbx,%rdi
+  803883:	48 b8 b8 10 80 00 00 	movabs $0x8010b8,%rax
+  80388a:	00 00 00 
+  80388d:	ff d0                	call   *%rax
+    return 0;
+  80388f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803894:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803898:	c9                   	leave
+  803899:	c3                   	ret
+
+000000000080389a <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80389a:	55                   	push   %rbp
+  80389b:	48 89 e5             	mov    %rsp,%rbp
+  80389e:	53                   	push   %rbx
+  80389f:	48 83 ec 08          	sub    $0x8,%rsp
+  8038a3:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8038a6:	48 b8 85 0c 80 00 00 	movabs $0x800c85,%rax
+  8038ad:	00 00 00 
+  8038b0:	ff d0                	call   *%rax
+  8038b2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8038b8:	77 35                	ja     8038ef <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8038ba:	48 89 de             	mov    %rbx,%rsi
+  8038bd:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8038c4:	00 00 00 
+  8038c7:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  8038ce:	00 00 00 
+  8038d1:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8038d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8038d8:	bf 07 00 00 00       	mov    $0x7,%edi
+  8038dd:	48 b8 06 2d 80 00 00 	movabs $0x802d06,%rax
+  8038e4:	00 00 00 
+  8038e7:	ff d0                	call   *%rax
+}
+  8038e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038ed:	c9                   	leave
+  8038ee:	c3                   	ret
+        return -E_BAD_PATH;
+  8038ef:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8038f4:	eb f3                	jmp    8038e9 <remove+0x4f>
+
+00000000008038f6 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8038f6:	55                   	push   %rbp
+  8038f7:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8038fa:	48 b8 b1 37 80 00 00 	movabs $0x8037b1,%rax
+  803901:	00 00 00 
+  803904:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803906:	be 00 00 00 00       	mov    $0x0,%esi
+  80390b:	bf 08 00 00 00       	mov    $0x8,%edi
+  803910:	48 b8 06 2d 80 00 00 	movabs $0x802d06,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+}
+  80391c:	5d                   	pop    %rbp
+  80391d:	c3                   	ret
+
+000000000080391e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80391e:	55                   	push   %rbp
+  80391f:	48 89 e5             	mov    %rsp,%rbp
+  803922:	41 54                	push   %r12
+  803924:	53                   	push   %rbx
+  803925:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803928:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  80392f:	00 00 00 
+  803932:	ff d0                	call   *%rax
+  803934:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803937:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  80393e:	00 00 00 
+  803941:	48 89 df             	mov    %rbx,%rdi
+  803944:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  80394b:	00 00 00 
+  80394e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803950:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803955:	41 2b 04 24          	sub    (%r12),%eax
+  803959:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80395f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803966:	00 00 00 
+    stat->st_dev = &devpipe;
+  803969:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803970:	00 00 00 
+  803973:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80397a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80397f:	5b                   	pop    %rbx
+  803980:	41 5c                	pop    %r12
+  803982:	5d                   	pop    %rbp
+  803983:	c3                   	ret
+
+0000000000803984 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803984:	55                   	push   %rbp
+  803985:	48 89 e5             	mov    %rsp,%rbp
+  803988:	41 54                	push   %r12
+  80398a:	53                   	push   %rbx
+  80398b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80398e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803993:	48 89 fe             	mov    %rdi,%rsi
+  803996:	bf 00 00 00 00       	mov    $0x0,%edi
+  80399b:	49 bc 02 16 80 00 00 	movabs $0x801602,%r12
+  8039a2:	00 00 00 
+  8039a5:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8039a8:	48 89 df             	mov    %rbx,%rdi
+  8039ab:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  8039b2:	00 00 00 
+  8039b5:	ff d0                	call   *%rax
+  8039b7:	48 89 c6             	mov    %rax,%rsi
+  8039ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c4:	41 ff d4             	call   *%r12
+}
+  8039c7:	5b                   	pop    %rbx
+  8039c8:	41 5c                	pop    %r12
+  8039ca:	5d                   	pop    %rbp
+  8039cb:	c3                   	ret
+
+00000000008039cc <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039cc:	55                   	push   %rbp
+  8039cd:	48 89 e5             	mov    %rsp,%rbp
+  8039d0:	41 57                	push   %r15
+  8039d2:	41 56                	push   %r14
+  8039d4:	41 55                	push   %r13
+  8039d6:	41 54                	push   %r12
+  8039d8:	53                   	push   %rbx
+  8039d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8039dd:	49 89 fc             	mov    %rdi,%r12
+  8039e0:	49 89 f5             	mov    %rsi,%r13
+  8039e3:	49 89 d7             	mov    %rdx,%r15
+  8039e6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039ea:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  8039f1:	00 00 00 
+  8039f4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8039f6:	4d 85 ff             	test   %r15,%r15
+  8039f9:	0f 84 af 00 00 00    	je     803aae <devpipe_write+0xe2>
+  8039ff:	48 89 c3             	mov    %rax,%rbx
+  803a02:	4c 89 f8             	mov    %r15,%rax
+  803a05:	4d 89 ef             	mov    %r13,%r15
+  803a08:	4c 01 e8             	add    %r13,%rax
+  803a0b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a0f:	49 bd f7 13 80 00 00 	movabs $0x8013f7,%r13
+  803a16:	00 00 00 
+            sys_yield();
+  803a19:	49 be 94 13 80 00 00 	movabs $0x801394,%r14
+  803a20:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a23:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a26:	48 63 ce             	movslq %esi,%rcx
+  803a29:	48 63 03             	movslq (%rbx),%rax
+  803a2c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a32:	48 39 c1             	cmp    %rax,%rcx
+  803a35:	72 2e                	jb     803a65 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a37:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a3c:	48 89 da             	mov    %rbx,%rdx
+  803a3f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a44:	4c 89 e7             	mov    %r12,%rdi
+  803a47:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803a4a:	85 c0                	test   %eax,%eax
+  803a4c:	74 66                	je     803ab4 <devpipe_write+0xe8>
+            sys_yield();
+  803a4e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a51:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a54:	48 63 ce             	movslq %esi,%rcx
+  803a57:	48 63 03             	movslq (%rbx),%rax
+  803a5a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a60:	48 39 c1             	cmp    %rax,%rcx
+  803a63:	73 d2                	jae    803a37 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a65:	41 0f b6 3f          	movzbl (%r15),%edi
+  803a69:	48 89 ca             	mov    %rcx,%rdx
+  803a6c:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a70:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803a77:	08 10 20 
+  803a7a:	48 f7 e2             	mul    %rdx
+  803a7d:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a81:	48 89 d0             	mov    %rdx,%rax
+  803a84:	48 c1 e0 09          	shl    $0x9,%rax
+  803a88:	48 29 d0             	sub    %rdx,%rax
+  803a8b:	48 c1 e0 03          	shl    $0x3,%rax
+  803a8f:	48 29 c1             	sub    %rax,%rcx
+  803a92:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803a97:	83 c6 01             	add    $0x1,%esi
+  803a9a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a9d:	49 83 c7 01          	add    $0x1,%r15
+  803aa1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803aa5:	49 39 c7             	cmp    %rax,%r15
+  803aa8:	0f 85 75 ff ff ff    	jne    803a23 <devpipe_write+0x57>
+    return n;
+  803aae:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ab2:	eb 05                	jmp    803ab9 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ab9:	48 83 c4 18          	add    $0x18,%rsp
+  803abd:	5b                   	pop    %rbx
+  803abe:	41 5c                	pop    %r12
+  803ac0:	41 5d                	pop    %r13
+  803ac2:	41 5e                	pop    %r14
+  803ac4:	41 5f                	pop    %r15
+  803ac6:	5d                   	pop    %rbp
+  803ac7:	c3                   	ret
+
+0000000000803ac8 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ac8:	55                   	push   %rbp
+  803ac9:	48 89 e5             	mov    %rsp,%rbp
+  803acc:	41 57                	push   %r15
+  803ace:	41 56                	push   %r14
+  803ad0:	41 55                	push   %r13
+  803ad2:	41 54                	push   %r12
+  803ad4:	53                   	push   %rbx
+  803ad5:	48 83 ec 18          	sub    $0x18,%rsp
+  803ad9:	49 89 fc             	mov    %rdi,%r12
+  803adc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ae0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ae4:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  803aeb:	00 00 00 
+  803aee:	ff d0                	call   *%rax
+  803af0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803af3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803af9:	49 bd f7 13 80 00 00 	movabs $0x8013f7,%r13
+  803b00:	00 00 00 
+            sys_yield();
+  803b03:	49 be 94 13 80 00 00 	movabs $0x801394,%r14
+  803b0a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b0d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b12:	74 7d                	je     803b91 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b14:	8b 03                	mov    (%rbx),%eax
+  803b16:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b19:	75 26                	jne    803b41 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803b1b:	4d 85 ff             	test   %r15,%r15
+  803b1e:	75 77                	jne    803b97 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b20:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b25:	48 89 da             	mov    %rbx,%rdx
+  803b28:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b2d:	4c 89 e7             	mov    %r12,%rdi
+  803b30:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b33:	85 c0                	test   %eax,%eax
+  803b35:	74 72                	je     803ba9 <devpipe_read+0xe1>
+            sys_yield();
+  803b37:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b3a:	8b 03                	mov    (%rbx),%eax
+  803b3c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b3f:	74 df                	je     803b20 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b41:	48 63 c8             	movslq %eax,%rcx
+  803b44:	48 89 ca             	mov    %rcx,%rdx
+  803b47:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b4b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803b52:	08 10 20 
+  803b55:	48 89 d0             	mov    %rdx,%rax
+  803b58:	48 f7 e6             	mul    %rsi
+  803b5b:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b5f:	48 89 d0             	mov    %rdx,%rax
+  803b62:	48 c1 e0 09          	shl    $0x9,%rax
+  803b66:	48 29 d0             	sub    %rdx,%rax
+  803b69:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803b70:	00 
+  803b71:	48 89 c8             	mov    %rcx,%rax
+  803b74:	48 29 d0             	sub    %rdx,%rax
+  803b77:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803b7c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b80:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803b84:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b87:	49 83 c7 01          	add    $0x1,%r15
+  803b8b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803b8f:	75 83                	jne    803b14 <devpipe_read+0x4c>
+    return n;
+  803b91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b95:	eb 03                	jmp    803b9a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803b97:	4c 89 f8             	mov    %r15,%rax
+}
+  803b9a:	48 83 c4 18          	add    $0x18,%rsp
+  803b9e:	5b                   	pop    %rbx
+  803b9f:	41 5c                	pop    %r12
+  803ba1:	41 5d                	pop    %r13
+  803ba3:	41 5e                	pop    %r14
+  803ba5:	41 5f                	pop    %r15
+  803ba7:	5d                   	pop    %rbp
+  803ba8:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bae:	eb ea                	jmp    803b9a <devpipe_read+0xd2>
+
+0000000000803bb0 <pipe>:
+pipe(int pfd[2]) {
+  803bb0:	55                   	push   %rbp
+  803bb1:	48 89 e5             	mov    %rsp,%rbp
+  803bb4:	41 55                	push   %r13
+  803bb6:	41 54                	push   %r12
+  803bb8:	53                   	push   %rbx
+  803bb9:	48 83 ec 18          	sub    $0x18,%rsp
+  803bbd:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bc0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bc4:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  803bcb:	00 00 00 
+  803bce:	ff d0                	call   *%rax
+  803bd0:	89 c3                	mov    %eax,%ebx
+  803bd2:	85 c0                	test   %eax,%eax
+  803bd4:	0f 88 a0 01 00 00    	js     803d7a <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803bda:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bdf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803be4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803be8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bed:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  803bf4:	00 00 00 
+  803bf7:	ff d0                	call   *%rax
+  803bf9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bfb:	85 c0                	test   %eax,%eax
+  803bfd:	0f 88 77 01 00 00    	js     803d7a <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c03:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c07:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  803c0e:	00 00 00 
+  803c11:	ff d0                	call   *%rax
+  803c13:	89 c3                	mov    %eax,%ebx
+  803c15:	85 c0                	test   %eax,%eax
+  803c17:	0f 88 43 01 00 00    	js     803d60 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c1d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c22:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c27:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c30:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  803c37:	00 00 00 
+  803c3a:	ff d0                	call   *%rax
+  803c3c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c3e:	85 c0                	test   %eax,%eax
+  803c40:	0f 88 1a 01 00 00    	js     803d60 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803c46:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c4a:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  803c51:	00 00 00 
+  803c54:	ff d0                	call   *%rax
+  803c56:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c59:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c5e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c63:	48 89 c6             	mov    %rax,%rsi
+  803c66:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c6b:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  803c72:	00 00 00 
+  803c75:	ff d0                	call   *%rax
+  803c77:	89 c3                	mov    %eax,%ebx
+  803c79:	85 c0                	test   %eax,%eax
+  803c7b:	0f 88 c5 00 00 00    	js     803d46 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c81:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c85:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  803c8c:	00 00 00 
+  803c8f:	ff d0                	call   *%rax
+  803c91:	48 89 c1             	mov    %rax,%rcx
+  803c94:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c9a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803ca0:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ca5:	4c 89 ee             	mov    %r13,%rsi
+  803ca8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cad:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  803cb4:	00 00 00 
+  803cb7:	ff d0                	call   *%rax
+  803cb9:	89 c3                	mov    %eax,%ebx
+  803cbb:	85 c0                	test   %eax,%eax
+  803cbd:	78 6e                	js     803d2d <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803cbf:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cc4:	4c 89 ef             	mov    %r13,%rdi
+  803cc7:	48 b8 c5 13 80 00 00 	movabs $0x8013c5,%rax
+  803cce:	00 00 00 
+  803cd1:	ff d0                	call   *%rax
+  803cd3:	83 f8 02             	cmp    $0x2,%eax
+  803cd6:	0f 85 ab 00 00 00    	jne    803d87 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803cdc:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803ce3:	00 00 
+  803ce5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ce9:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803ceb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cef:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803cf6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803cfa:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803cfc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d00:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d07:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d0b:	48 bb 06 21 80 00 00 	movabs $0x802106,%rbx
+  803d12:	00 00 00 
+  803d15:	ff d3                	call   *%rbx
+  803d17:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d1b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d1f:	ff d3                	call   *%rbx
+  803d21:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d2b:	eb 4d                	jmp    803d7a <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d2d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d32:	4c 89 ee             	mov    %r13,%rsi
+  803d35:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d3a:	48 b8 02 16 80 00 00 	movabs $0x801602,%rax
+  803d41:	00 00 00 
+  803d44:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d4b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d54:	48 b8 02 16 80 00 00 	movabs $0x801602,%rax
+  803d5b:	00 00 00 
+  803d5e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d65:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d69:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d6e:	48 b8 02 16 80 00 00 	movabs $0x801602,%rax
+  803d75:	00 00 00 
+  803d78:	ff d0                	call   *%rax
+}
+  803d7a:	89 d8                	mov    %ebx,%eax
+  803d7c:	48 83 c4 18          	add    $0x18,%rsp
+  803d80:	5b                   	pop    %rbx
+  803d81:	41 5c                	pop    %r12
+  803d83:	41 5d                	pop    %r13
+  803d85:	5d                   	pop    %rbp
+  803d86:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d87:	48 b9 b8 57 80 00 00 	movabs $0x8057b8,%rcx
+  803d8e:	00 00 00 
+  803d91:	48 ba d8 56 80 00 00 	movabs $0x8056d8,%rdx
+  803d98:	00 00 00 
+  803d9b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803da0:	48 bf a7 57 80 00 00 	movabs $0x8057a7,%rdi
+  803da7:	00 00 00 
+  803daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803daf:	49 b8 fb 01 80 00 00 	movabs $0x8001fb,%r8
+  803db6:	00 00 00 
+  803db9:	41 ff d0             	call   *%r8
+
+0000000000803dbc <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803dbc:	55                   	push   %rbp
+  803dbd:	48 89 e5             	mov    %rsp,%rbp
+  803dc0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803dc4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803dc8:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  803dcf:	00 00 00 
+  803dd2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803dd4:	85 c0                	test   %eax,%eax
+  803dd6:	78 35                	js     803e0d <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803dd8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ddc:	48 b8 18 21 80 00 00 	movabs $0x802118,%rax
+  803de3:	00 00 00 
+  803de6:	ff d0                	call   *%rax
+  803de8:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803deb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803df0:	be 00 10 00 00       	mov    $0x1000,%esi
+  803df5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803df9:	48 b8 f7 13 80 00 00 	movabs $0x8013f7,%rax
+  803e00:	00 00 00 
+  803e03:	ff d0                	call   *%rax
+  803e05:	85 c0                	test   %eax,%eax
+  803e07:	0f 94 c0             	sete   %al
+  803e0a:	0f b6 c0             	movzbl %al,%eax
+}
+  803e0d:	c9                   	leave
+  803e0e:	c3                   	ret
+
+0000000000803e0f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e0f:	48 89 f8             	mov    %rdi,%rax
+  803e12:	48 c1 e8 27          	shr    $0x27,%rax
+  803e16:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e1d:	7f 00 00 
+  803e20:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e24:	f6 c2 01             	test   $0x1,%dl
+  803e27:	74 6d                	je     803e96 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e29:	48 89 f8             	mov    %rdi,%rax
+  803e2c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e30:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e37:	7f 00 00 
+  803e3a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e3e:	f6 c2 01             	test   $0x1,%dl
+  803e41:	74 62                	je     803ea5 <get_uvpt_entry+0x96>
+  803e43:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e4a:	7f 00 00 
+  803e4d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e51:	f6 c2 80             	test   $0x80,%dl
+  803e54:	75 4f                	jne    803ea5 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e56:	48 89 f8             	mov    %rdi,%rax
+  803e59:	48 c1 e8 15          	shr    $0x15,%rax
+  803e5d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e64:	7f 00 00 
+  803e67:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e6b:	f6 c2 01             	test   $0x1,%dl
+  803e6e:	74 44                	je     803eb4 <get_uvpt_entry+0xa5>
+  803e70:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e77:	7f 00 00 
+  803e7a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e7e:	f6 c2 80             	test   $0x80,%dl
+  803e81:	75 31                	jne    803eb4 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e83:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e87:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e8e:	7f 00 00 
+  803e91:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e95:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e96:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e9d:	7f 00 00 
+  803ea0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ea4:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ea5:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803eac:	7f 00 00 
+  803eaf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803eb3:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803eb4:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ebb:	7f 00 00 
+  803ebe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ec2:	c3                   	ret
+
+0000000000803ec3 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803ec3:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ec6:	48 89 f9             	mov    %rdi,%rcx
+  803ec9:	48 c1 e9 27          	shr    $0x27,%rcx
+  803ecd:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803ed4:	7f 00 00 
+  803ed7:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803edb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ee2:	f6 c1 01             	test   $0x1,%cl
+  803ee5:	0f 84 b2 00 00 00    	je     803f9d <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803eeb:	48 89 f9             	mov    %rdi,%rcx
+  803eee:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803ef2:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ef9:	7f 00 00 
+  803efc:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f00:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f07:	40 f6 c6 01          	test   $0x1,%sil
+  803f0b:	0f 84 8c 00 00 00    	je     803f9d <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803f11:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f18:	7f 00 00 
+  803f1b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f1f:	a8 80                	test   $0x80,%al
+  803f21:	75 7b                	jne    803f9e <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f23:	48 89 f9             	mov    %rdi,%rcx
+  803f26:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f2a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f31:	7f 00 00 
+  803f34:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f38:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f3f:	40 f6 c6 01          	test   $0x1,%sil
+  803f43:	74 58                	je     803f9d <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803f45:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f4c:	7f 00 00 
+  803f4f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f53:	a8 80                	test   $0x80,%al
+  803f55:	75 6c                	jne    803fc3 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f57:	48 89 f9             	mov    %rdi,%rcx
+  803f5a:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803f5e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f65:	7f 00 00 
+  803f68:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f6c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f73:	40 f6 c6 01          	test   $0x1,%sil
+  803f77:	74 24                	je     803f9d <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f79:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f80:	7f 00 00 
+  803f83:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f87:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f8e:	ff ff 7f 
+  803f91:	48 21 c8             	and    %rcx,%rax
+  803f94:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f9a:	48 09 d0             	or     %rdx,%rax
+}
+  803f9d:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f9e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fa5:	7f 00 00 
+  803fa8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fac:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fb3:	ff ff 7f 
+  803fb6:	48 21 c8             	and    %rcx,%rax
+  803fb9:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803fbf:	48 01 d0             	add    %rdx,%rax
+  803fc2:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803fc3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fca:	7f 00 00 
+  803fcd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fd1:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fd8:	ff ff 7f 
+  803fdb:	48 21 c8             	and    %rcx,%rax
+  803fde:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803fe4:	48 01 d0             	add    %rdx,%rax
+  803fe7:	c3                   	ret
+
+0000000000803fe8 <get_prot>:
+
+int
+get_prot(void *va) {
+  803fe8:	55                   	push   %rbp
+  803fe9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fec:	48 b8 0f 3e 80 00 00 	movabs $0x803e0f,%rax
+  803ff3:	00 00 00 
+  803ff6:	ff d0                	call   *%rax
+  803ff8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803ffb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804000:	89 c1                	mov    %eax,%ecx
+  804002:	83 c9 04             	or     $0x4,%ecx
+  804005:	f6 c2 01             	test   $0x1,%dl
+  804008:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80400b:	89 c1                	mov    %eax,%ecx
+  80400d:	83 c9 02             	or     $0x2,%ecx
+  804010:	f6 c2 02             	test   $0x2,%dl
+  804013:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804016:	89 c1                	mov    %eax,%ecx
+  804018:	83 c9 01             	or     $0x1,%ecx
+  80401b:	48 85 d2             	test   %rdx,%rdx
+  80401e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804021:	89 c1                	mov    %eax,%ecx
+  804023:	83 c9 40             	or     $0x40,%ecx
+  804026:	f6 c6 04             	test   $0x4,%dh
+  804029:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80402c:	5d                   	pop    %rbp
+  80402d:	c3                   	ret
+
+000000000080402e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80402e:	55                   	push   %rbp
+  80402f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804032:	48 b8 0f 3e 80 00 00 	movabs $0x803e0f,%rax
+  804039:	00 00 00 
+  80403c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80403e:	48 c1 e8 06          	shr    $0x6,%rax
+  804042:	83 e0 01             	and    $0x1,%eax
+}
+  804045:	5d                   	pop    %rbp
+  804046:	c3                   	ret
+
+0000000000804047 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804047:	55                   	push   %rbp
+  804048:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80404b:	48 b8 0f 3e 80 00 00 	movabs $0x803e0f,%rax
+  804052:	00 00 00 
+  804055:	ff d0                	call   *%rax
+  804057:	83 e0 01             	and    $0x1,%eax
+}
+  80405a:	5d                   	pop    %rbp
+  80405b:	c3                   	ret
+
+000000000080405c <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  80405c:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804063:	7f 00 00 
+  804066:	a8 01                	test   $0x1,%al
+  804068:	75 06                	jne    804070 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  80406a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80406f:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804070:	55                   	push   %rbp
+  804071:	48 89 e5             	mov    %rsp,%rbp
+  804074:	41 57                	push   %r15
+  804076:	41 56                	push   %r14
+  804078:	41 55                	push   %r13
+  80407a:	41 54                	push   %r12
+  80407c:	53                   	push   %rbx
+  80407d:	48 83 ec 18          	sub    $0x18,%rsp
+  804081:	49 89 fe             	mov    %rdi,%r14
+  804084:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804087:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80408e:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80408f:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804096:	7f 00 00 
+  804099:	e9 81 00 00 00       	jmp    80411f <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  80409e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040a5:	49 39 dd             	cmp    %rbx,%r13
+  8040a8:	74 2b                	je     8040d5 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8040aa:	48 89 d8             	mov    %rbx,%rax
+  8040ad:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040b1:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  8040b5:	f6 c2 01             	test   $0x1,%dl
+  8040b8:	74 e4                	je     80409e <foreach_shared_region+0x42>
+  8040ba:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  8040be:	f6 c4 04             	test   $0x4,%ah
+  8040c1:	74 db                	je     80409e <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  8040c3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040ca:	4c 89 fa             	mov    %r15,%rdx
+  8040cd:	48 89 df             	mov    %rbx,%rdi
+  8040d0:	41 ff d6             	call   *%r14
+  8040d3:	eb c9                	jmp    80409e <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8040d5:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  8040dc:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  8040e0:	74 22                	je     804104 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  8040e2:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  8040e9:	48 89 d8             	mov    %rbx,%rax
+  8040ec:	48 c1 e8 15          	shr    $0x15,%rax
+  8040f0:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  8040f7:	7f 00 00 
+  8040fa:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8040fe:	a8 01                	test   $0x1,%al
+  804100:	74 d3                	je     8040d5 <foreach_shared_region+0x79>
+  804102:	eb a6                	jmp    8040aa <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804104:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  80410b:	40 
+  80410c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804110:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804117:	00 00 00 
+  80411a:	48 39 c1             	cmp    %rax,%rcx
+  80411d:	74 31                	je     804150 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  80411f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804123:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804127:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  80412e:	7f 00 00 
+  804131:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804135:	a8 01                	test   $0x1,%al
+  804137:	74 cb                	je     804104 <foreach_shared_region+0xa8>
+  804139:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80413d:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804144:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  80414a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80414e:	eb 92                	jmp    8040e2 <foreach_shared_region+0x86>
+}
+  804150:	b8 00 00 00 00       	mov    $0x0,%eax
+  804155:	48 83 c4 18          	add    $0x18,%rsp
+  804159:	5b                   	pop    %rbx
+  80415a:	41 5c                	pop    %r12
+  80415c:	41 5d                	pop    %r13
+  80415e:	41 5e                	pop    %r14
+  804160:	41 5f                	pop    %r15
+  804162:	5d                   	pop    %rbp
+  804163:	c3                   	ret
+
+0000000000804164 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804164:	b8 00 00 00 00       	mov    $0x0,%eax
+  804169:	c3                   	ret
+
+000000000080416a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80416a:	55                   	push   %rbp
+  80416b:	48 89 e5             	mov    %rsp,%rbp
+  80416e:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804171:	48 be dc 57 80 00 00 	movabs $0x8057dc,%rsi
+  804178:	00 00 00 
+  80417b:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  804182:	00 00 00 
+  804185:	ff d0                	call   *%rax
+    return 0;
+}
+  804187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80418c:	5d                   	pop    %rbp
+  80418d:	c3                   	ret
+
+000000000080418e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80418e:	55                   	push   %rbp
+  80418f:	48 89 e5             	mov    %rsp,%rbp
+  804192:	41 57                	push   %r15
+  804194:	41 56                	push   %r14
+  804196:	41 55                	push   %r13
+  804198:	41 54                	push   %r12
+  80419a:	53                   	push   %rbx
+  80419b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8041a2:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8041a9:	48 85 d2             	test   %rdx,%rdx
+  8041ac:	74 7a                	je     804228 <devcons_write+0x9a>
+  8041ae:	49 89 d6             	mov    %rdx,%r14
+  8041b1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041b7:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8041bc:	49 bf 51 10 80 00 00 	movabs $0x801051,%r15
+  8041c3:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8041c6:	4c 89 f3             	mov    %r14,%rbx
+  8041c9:	48 29 f3             	sub    %rsi,%rbx
+  8041cc:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8041d1:	48 39 c3             	cmp    %rax,%rbx
+  8041d4:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8041d8:	4c 63 eb             	movslq %ebx,%r13
+  8041db:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8041e2:	48 01 c6             	add    %rax,%rsi
+  8041e5:	4c 89 ea             	mov    %r13,%rdx
+  8041e8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041ef:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8041f2:	4c 89 ee             	mov    %r13,%rsi
+  8041f5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041fc:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  804203:	00 00 00 
+  804206:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804208:	41 01 dc             	add    %ebx,%r12d
+  80420b:	49 63 f4             	movslq %r12d,%rsi
+  80420e:	4c 39 f6             	cmp    %r14,%rsi
+  804211:	72 b3                	jb     8041c6 <devcons_write+0x38>
+    return res;
+  804213:	49 63 c4             	movslq %r12d,%rax
+}
+  804216:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80421d:	5b                   	pop    %rbx
+  80421e:	41 5c                	pop    %r12
+  804220:	41 5d                	pop    %r13
+  804222:	41 5e                	pop    %r14
+  804224:	41 5f                	pop    %r15
+  804226:	5d                   	pop    %rbp
+  804227:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804228:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80422e:	eb e3                	jmp    804213 <devcons_write+0x85>
+
+0000000000804230 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804230:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804233:	ba 00 00 00 00       	mov    $0x0,%edx
+  804238:	48 85 c0             	test   %rax,%rax
+  80423b:	74 55                	je     804292 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80423d:	55                   	push   %rbp
+  80423e:	48 89 e5             	mov    %rsp,%rbp
+  804241:	41 55                	push   %r13
+  804243:	41 54                	push   %r12
+  804245:	53                   	push   %rbx
+  804246:	48 83 ec 08          	sub    $0x8,%rsp
+  80424a:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80424d:	48 bb c7 12 80 00 00 	movabs $0x8012c7,%rbx
+  804254:	00 00 00 
+  804257:	49 bc 94 13 80 00 00 	movabs $0x801394,%r12
+  80425e:	00 00 00 
+  804261:	eb 03                	jmp    804266 <devcons_read+0x36>
+  804263:	41 ff d4             	call   *%r12
+  804266:	ff d3                	call   *%rbx
+  804268:	85 c0                	test   %eax,%eax
+  80426a:	74 f7                	je     804263 <devcons_read+0x33>
+    if (c < 0) return c;
+  80426c:	48 63 d0             	movslq %eax,%rdx
+  80426f:	78 13                	js     804284 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804271:	ba 00 00 00 00       	mov    $0x0,%edx
+  804276:	83 f8 04             	cmp    $0x4,%eax
+  804279:	74 09                	je     804284 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80427b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80427f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804284:	48 89 d0             	mov    %rdx,%rax
+  804287:	48 83 c4 08          	add    $0x8,%rsp
+  80428b:	5b                   	pop    %rbx
+  80428c:	41 5c                	pop    %r12
+  80428e:	41 5d                	pop    %r13
+  804290:	5d                   	pop    %rbp
+  804291:	c3                   	ret
+  804292:	48 89 d0             	mov    %rdx,%rax
+  804295:	c3                   	ret
+
+0000000000804296 <cputchar>:
+cputchar(int ch) {
+  804296:	55                   	push   %rbp
+  804297:	48 89 e5             	mov    %rsp,%rbp
+  80429a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80429e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8042a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8042a7:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8042ab:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  8042b2:	00 00 00 
+  8042b5:	ff d0                	call   *%rax
+}
+  8042b7:	c9                   	leave
+  8042b8:	c3                   	ret
+
+00000000008042b9 <getchar>:
+getchar(void) {
+  8042b9:	55                   	push   %rbp
+  8042ba:	48 89 e5             	mov    %rsp,%rbp
+  8042bd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8042c1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042c6:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8042ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042cf:	48 b8 77 24 80 00 00 	movabs $0x802477,%rax
+  8042d6:	00 00 00 
+  8042d9:	ff d0                	call   *%rax
+  8042db:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8042dd:	85 c0                	test   %eax,%eax
+  8042df:	78 06                	js     8042e7 <getchar+0x2e>
+  8042e1:	74 08                	je     8042eb <getchar+0x32>
+  8042e3:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8042e7:	89 d0                	mov    %edx,%eax
+  8042e9:	c9                   	leave
+  8042ea:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8042eb:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8042f0:	eb f5                	jmp    8042e7 <getchar+0x2e>
+
+00000000008042f2 <iscons>:
+iscons(int fdnum) {
+  8042f2:	55                   	push   %rbp
+  8042f3:	48 89 e5             	mov    %rsp,%rbp
+  8042f6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8042fa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042fe:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  804305:	00 00 00 
+  804308:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80430a:	85 c0                	test   %eax,%eax
+  80430c:	78 18                	js     804326 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80430e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804312:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804319:	00 00 00 
+  80431c:	8b 00                	mov    (%rax),%eax
+  80431e:	39 02                	cmp    %eax,(%rdx)
+  804320:	0f 94 c0             	sete   %al
+  804323:	0f b6 c0             	movzbl %al,%eax
+}
+  804326:	c9                   	leave
+  804327:	c3                   	ret
+
+0000000000804328 <opencons>:
+opencons(void) {
+  804328:	55                   	push   %rbp
+  804329:	48 89 e5             	mov    %rsp,%rbp
+  80432c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804330:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804334:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80433b:	00 00 00 
+  80433e:	ff d0                	call   *%rax
+  804340:	85 c0                	test   %eax,%eax
+  804342:	78 49                	js     80438d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804344:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804349:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80434e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804352:	bf 00 00 00 00       	mov    $0x0,%edi
+  804357:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  80435e:	00 00 00 
+  804361:	ff d0                	call   *%rax
+  804363:	85 c0                	test   %eax,%eax
+  804365:	78 26                	js     80438d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804367:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80436b:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804372:	00 00 
+  804374:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804376:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80437a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804381:	48 b8 06 21 80 00 00 	movabs $0x802106,%rax
+  804388:	00 00 00 
+  80438b:	ff d0                	call   *%rax
+}
+  80438d:	c9                   	leave
+  80438e:	c3                   	ret
+
+000000000080438f <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80438f:	55                   	push   %rbp
+  804390:	48 89 e5             	mov    %rsp,%rbp
+  804393:	41 55                	push   %r13
+  804395:	41 54                	push   %r12
+  804397:	53                   	push   %rbx
+  804398:	48 83 ec 08          	sub    $0x8,%rsp
+  80439c:	49 89 fc             	mov    %rdi,%r12
+  80439f:	48 89 f7             	mov    %rsi,%rdi
+  8043a2:	48 89 d3             	mov    %rdx,%rbx
+  8043a5:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8043a8:	48 85 f6             	test   %rsi,%rsi
+  8043ab:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8043b2:	00 00 00 
+  8043b5:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8043b9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043be:	48 85 d2             	test   %rdx,%rdx
+  8043c1:	74 03                	je     8043c6 <ipc_recv+0x37>
+  8043c3:	48 8b 32             	mov    (%rdx),%rsi
+  8043c6:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  8043cd:	00 00 00 
+  8043d0:	ff d0                	call   *%rax
+    if (errno) {
+  8043d2:	85 c0                	test   %eax,%eax
+  8043d4:	74 1c                	je     8043f2 <ipc_recv+0x63>
+        if (from_env_store)
+  8043d6:	4d 85 e4             	test   %r12,%r12
+  8043d9:	74 08                	je     8043e3 <ipc_recv+0x54>
+            *from_env_store = 0;
+  8043db:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8043e2:	00 
+
+        if (perm_store)
+  8043e3:	4d 85 ed             	test   %r13,%r13
+  8043e6:	74 74                	je     80445c <ipc_recv+0xcd>
+            *perm_store = 0;
+  8043e8:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8043ef:	00 
+  8043f0:	eb 6a                	jmp    80445c <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8043f2:	4d 85 e4             	test   %r12,%r12
+  8043f5:	74 14                	je     80440b <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8043f7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8043fe:	00 00 00 
+  804401:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804407:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80440b:	48 85 db             	test   %rbx,%rbx
+  80440e:	74 23                	je     804433 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804410:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804417:	00 00 00 
+  80441a:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804420:	ba 00 00 00 00       	mov    $0x0,%edx
+  804425:	85 c9                	test   %ecx,%ecx
+  804427:	74 07                	je     804430 <ipc_recv+0xa1>
+  804429:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804430:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804433:	4d 85 ed             	test   %r13,%r13
+  804436:	74 14                	je     80444c <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804438:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80443f:	00 00 00 
+  804442:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804448:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  80444c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804453:	00 00 00 
+  804456:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  80445c:	48 83 c4 08          	add    $0x8,%rsp
+  804460:	5b                   	pop    %rbx
+  804461:	41 5c                	pop    %r12
+  804463:	41 5d                	pop    %r13
+  804465:	5d                   	pop    %rbp
+  804466:	c3                   	ret
+
+0000000000804467 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804467:	55                   	push   %rbp
+  804468:	48 89 e5             	mov    %rsp,%rbp
+  80446b:	41 55                	push   %r13
+  80446d:	41 54                	push   %r12
+  80446f:	53                   	push   %rbx
+  804470:	48 83 ec 08          	sub    $0x8,%rsp
+  804474:	49 89 fc             	mov    %rdi,%r12
+  804477:	48 89 f7             	mov    %rsi,%rdi
+  80447a:	48 89 d3             	mov    %rdx,%rbx
+  80447d:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804480:	48 85 f6             	test   %rsi,%rsi
+  804483:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80448a:	00 00 00 
+  80448d:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804491:	be 00 10 00 00       	mov    $0x1000,%esi
+  804496:	48 85 d2             	test   %rdx,%rdx
+  804499:	74 03                	je     80449e <ipc_try_recv+0x37>
+  80449b:	48 8b 32             	mov    (%rdx),%rsi
+  80449e:	48 b8 39 18 80 00 00 	movabs $0x801839,%rax
+  8044a5:	00 00 00 
+  8044a8:	ff d0                	call   *%rax
+    if (errno) {
+  8044aa:	85 c0                	test   %eax,%eax
+  8044ac:	75 75                	jne    804523 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8044ae:	4d 85 e4             	test   %r12,%r12
+  8044b1:	74 14                	je     8044c7 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8044b3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044ba:	00 00 00 
+  8044bd:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8044c3:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8044c7:	48 85 db             	test   %rbx,%rbx
+  8044ca:	74 23                	je     8044ef <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8044cc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044d3:	00 00 00 
+  8044d6:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8044dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044e1:	85 c9                	test   %ecx,%ecx
+  8044e3:	74 07                	je     8044ec <ipc_try_recv+0x85>
+  8044e5:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8044ec:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8044ef:	4d 85 ed             	test   %r13,%r13
+  8044f2:	74 14                	je     804508 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8044f4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044fb:	00 00 00 
+  8044fe:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804504:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804508:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80450f:	00 00 00 
+  804512:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804518:	48 83 c4 08          	add    $0x8,%rsp
+  80451c:	5b                   	pop    %rbx
+  80451d:	41 5c                	pop    %r12
+  80451f:	41 5d                	pop    %r13
+  804521:	5d                   	pop    %rbp
+  804522:	c3                   	ret
+        if (from_env_store)
+  804523:	4d 85 e4             	test   %r12,%r12
+  804526:	74 08                	je     804530 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804528:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80452f:	00 
+        if (perm_store)
+  804530:	4d 85 ed             	test   %r13,%r13
+  804533:	74 e3                	je     804518 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804535:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80453c:	00 
+  80453d:	eb d9                	jmp    804518 <ipc_try_recv+0xb1>
+
+000000000080453f <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80453f:	55                   	push   %rbp
+  804540:	48 89 e5             	mov    %rsp,%rbp
+  804543:	41 57                	push   %r15
+  804545:	41 56                	push   %r14
+  804547:	41 55                	push   %r13
+  804549:	41 54                	push   %r12
+  80454b:	53                   	push   %rbx
+  80454c:	48 83 ec 18          	sub    $0x18,%rsp
+  804550:	41 89 fd             	mov    %edi,%r13d
+  804553:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804556:	48 89 d3             	mov    %rdx,%rbx
+  804559:	49 89 cc             	mov    %rcx,%r12
+  80455c:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804560:	48 85 d2             	test   %rdx,%rdx
+  804563:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80456a:	00 00 00 
+  80456d:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804571:	49 be a4 17 80 00 00 	movabs $0x8017a4,%r14
+  804578:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  80457b:	49 bf 94 13 80 00 00 	movabs $0x801394,%r15
+  804582:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804585:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804588:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80458c:	4c 89 e1             	mov    %r12,%rcx
+  80458f:	48 89 da             	mov    %rbx,%rdx
+  804592:	44 89 ef             	mov    %r13d,%edi
+  804595:	41 ff d6             	call   *%r14
+  804598:	85 c0                	test   %eax,%eax
+  80459a:	74 37                	je     8045d3 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  80459c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80459f:	75 05                	jne    8045a6 <ipc_send+0x67>
+        sys_yield();
+  8045a1:	41 ff d7             	call   *%r15
+  8045a4:	eb df                	jmp    804585 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8045a6:	89 c1                	mov    %eax,%ecx
+  8045a8:	48 ba e8 57 80 00 00 	movabs $0x8057e8,%rdx
+  8045af:	00 00 00 
+  8045b2:	be 65 00 00 00       	mov    $0x65,%esi
+  8045b7:	48 bf 03 58 80 00 00 	movabs $0x805803,%rdi
+  8045be:	00 00 00 
+  8045c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045c6:	49 b8 fb 01 80 00 00 	movabs $0x8001fb,%r8
+  8045cd:	00 00 00 
+  8045d0:	41 ff d0             	call   *%r8
+    }
+}
+  8045d3:	48 83 c4 18          	add    $0x18,%rsp
+  8045d7:	5b                   	pop    %rbx
+  8045d8:	41 5c                	pop    %r12
+  8045da:	41 5d                	pop    %r13
+  8045dc:	41 5e                	pop    %r14
+  8045de:	41 5f                	pop    %r15
+  8045e0:	5d                   	pop    %rbp
+  8045e1:	c3                   	ret
+
+00000000008045e2 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8045e2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8045e7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8045ee:	00 00 00 
+  8045f1:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8045f8:	48 01 ca             	add    %rcx,%rdx
+  8045fb:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804601:	39 fa                	cmp    %edi,%edx
+  804603:	74 12                	je     804617 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804605:	48 83 c0 01          	add    $0x1,%rax
+  804609:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80460f:	75 e0                	jne    8045f1 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804611:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804616:	c3                   	ret
+            return envs[i].env_id;
+  804617:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80461e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804625:	00 00 00 
+  804628:	48 01 d0             	add    %rdx,%rax
+  80462b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804631:	c3                   	ret
+
+0000000000804632 <__text_end>:
+  804632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804639:	00 00 00 
+  80463c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804643:	00 00 00 
+  804646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464d:	00 00 00 
+  804650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804657:	00 00 00 
+  80465a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804661:	00 00 00 
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467f:	00 00 00 
+  804682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804689:	00 00 00 
+  80468c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804693:	00 00 00 
+  804696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469d:	00 00 00 
+  8046a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a7:	00 00 00 
+  8046aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b1:	00 00 00 
+  8046b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bb:	00 00 00 
+  8046be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c5:	00 00 00 
+  8046c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cf:	00 00 00 
+  8046d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d9:	00 00 00 
+  8046dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e3:	00 00 00 
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
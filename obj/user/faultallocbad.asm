@@ -0,0 +1,8309 @@
+
+obj/user/faultallocbad:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ea 00 00 00       	call   80010d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+ * doesn't work because we sys_cputs instead of cprintf (exercise: why?) */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 29 03 80 00 00 	movabs $0x800329,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba 50 50 80 00 00 	movabs $0x805050,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 26 0c 80 00 00 	movabs $0x800c26,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000bf:	48 bf 0b 50 80 00 00 	movabs $0x80500b,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  8000df:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e6:	00 00 00 
+  8000e9:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+    sys_cputs((char *)0xDEADBEEF, 4);
+  8000f5:	be 04 00 00 00       	mov    $0x4,%esi
+  8000fa:	bf ef be ad de       	mov    $0xdeadbeef,%edi
+  8000ff:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+}
+  80010b:	5d                   	pop    %rbp
+  80010c:	c3                   	ret
+
+000000000080010d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80010d:	55                   	push   %rbp
+  80010e:	48 89 e5             	mov    %rsp,%rbp
+  800111:	41 56                	push   %r14
+  800113:	41 55                	push   %r13
+  800115:	41 54                	push   %r12
+  800117:	53                   	push   %rbx
+  800118:	41 89 fd             	mov    %edi,%r13d
+  80011b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80011e:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800125:	00 00 00 
+  800128:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80012f:	00 00 00 
+  800132:	48 39 c2             	cmp    %rax,%rdx
+  800135:	73 17                	jae    80014e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800137:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80013a:	49 89 c4             	mov    %rax,%r12
+  80013d:	48 83 c3 08          	add    $0x8,%rbx
+  800141:	b8 00 00 00 00       	mov    $0x0,%eax
+  800146:	ff 53 f8             	call   *-0x8(%rbx)
+  800149:	4c 39 e3             	cmp    %r12,%rbx
+  80014c:	72 ef                	jb     80013d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80014e:	48 b8 41 13 80 00 00 	movabs $0x801341,%rax
+  800155:	00 00 00 
+  800158:	ff d0                	call   *%rax
+  80015a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80015f:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800166:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80016d:	00 00 00 
+  800170:	48 01 d0             	add    %rdx,%rax
+  800173:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  80017a:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80017d:	45 85 ed             	test   %r13d,%r13d
+  800180:	7e 0d                	jle    80018f <libmain+0x82>
+  800182:	49 8b 06             	mov    (%r14),%rax
+  800185:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80018c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80018f:	4c 89 f6             	mov    %r14,%rsi
+  800192:	44 89 ef             	mov    %r13d,%edi
+  800195:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  80019c:	00 00 00 
+  80019f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001a1:	48 b8 b6 01 80 00 00 	movabs $0x8001b6,%rax
+  8001a8:	00 00 00 
+  8001ab:	ff d0                	call   *%rax
+#endif
+}
+  8001ad:	5b                   	pop    %rbx
+  8001ae:	41 5c                	pop    %r12
+  8001b0:	41 5d                	pop    %r13
+  8001b2:	41 5e                	pop    %r14
+  8001b4:	5d                   	pop    %rbp
+  8001b5:	c3                   	ret
+
+00000000008001b6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001b6:	55                   	push   %rbp
+  8001b7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001ba:	48 b8 0a 23 80 00 00 	movabs $0x80230a,%rax
+  8001c1:	00 00 00 
+  8001c4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001cb:	48 b8 d6 12 80 00 00 	movabs $0x8012d6,%rax
+  8001d2:	00 00 00 
+  8001d5:	ff d0                	call   *%rax
+}
+  8001d7:	5d                   	pop    %rbp
+  8001d8:	c3                   	ret
+
+00000000008001d9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+  8001dd:	41 56                	push   %r14
+  8001df:	41 55                	push   %r13
+  8001e1:	41 54                	push   %r12
+  8001e3:	53                   	push   %rbx
+  8001e4:	48 83 ec 50          	sub    $0x50,%rsp
+  8001e8:	49 89 fc             	mov    %rdi,%r12
+  8001eb:	41 89 f5             	mov    %esi,%r13d
+  8001ee:	48 89 d3             	mov    %rdx,%rbx
+  8001f1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8001f5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8001f9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8001fd:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800204:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800208:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80020c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800210:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800214:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80021b:	00 00 00 
+  80021e:	4c 8b 30             	mov    (%rax),%r14
+  800221:	48 b8 41 13 80 00 00 	movabs $0x801341,%rax
+  800228:	00 00 00 
+  80022b:	ff d0                	call   *%rax
+  80022d:	89 c6                	mov    %eax,%esi
+  80022f:	45 89 e8             	mov    %r13d,%r8d
+  800232:	4c 89 e1             	mov    %r12,%rcx
+  800235:	4c 89 f2             	mov    %r14,%rdx
+  800238:	48 bf 80 50 80 00 00 	movabs $0x805080,%rdi
+  80023f:	00 00 00 
+  800242:	b8 00 00 00 00       	mov    $0x0,%eax
+  800247:	49 bc 29 03 80 00 00 	movabs $0x800329,%r12
+  80024e:	00 00 00 
+  800251:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800254:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800258:	48 89 df             	mov    %rbx,%rdi
+  80025b:	48 b8 c5 02 80 00 00 	movabs $0x8002c5,%rax
+  800262:	00 00 00 
+  800265:	ff d0                	call   *%rax
+    cprintf("\n");
+  800267:	48 bf 4b 57 80 00 00 	movabs $0x80574b,%rdi
+  80026e:	00 00 00 
+  800271:	b8 00 00 00 00       	mov    $0x0,%eax
+  800276:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800279:	cc                   	int3
+  80027a:	eb fd                	jmp    800279 <_panic+0xa0>
+
+000000000080027c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80027c:	55                   	push   %rbp
+  80027d:	48 89 e5             	mov    %rsp,%rbp
+  800280:	53                   	push   %rbx
+  800281:	48 83 ec 08          	sub    $0x8,%rsp
+  800285:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800288:	8b 06                	mov    (%rsi),%eax
+  80028a:	8d 50 01             	lea    0x1(%rax),%edx
+  80028d:	89 16                	mov    %edx,(%rsi)
+  80028f:	48 98                	cltq
+  800291:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800296:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80029c:	74 0a                	je     8002a8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80029e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a6:	c9                   	leave
+  8002a7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002a8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002ac:	be ff 00 00 00       	mov    $0xff,%esi
+  8002b1:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  8002b8:	00 00 00 
+  8002bb:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002bd:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002c3:	eb d9                	jmp    80029e <putch+0x22>
+
+00000000008002c5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002c5:	55                   	push   %rbp
+  8002c6:	48 89 e5             	mov    %rsp,%rbp
+  8002c9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002d0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002d3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002da:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002e7:	48 89 f1             	mov    %rsi,%rcx
+  8002ea:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002f1:	48 bf 7c 02 80 00 00 	movabs $0x80027c,%rdi
+  8002f8:	00 00 00 
+  8002fb:	48 b8 79 04 80 00 00 	movabs $0x800479,%rax
+  800302:	00 00 00 
+  800305:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800307:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80030e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800315:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  80031c:	00 00 00 
+  80031f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800321:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800327:	c9                   	leave
+  800328:	c3                   	ret
+
+0000000000800329 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800329:	55                   	push   %rbp
+  80032a:	48 89 e5             	mov    %rsp,%rbp
+  80032d:	48 83 ec 50          	sub    $0x50,%rsp
+  800331:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800335:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800339:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80033d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800341:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800345:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80034c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800350:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800354:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800358:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80035c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800360:	48 b8 c5 02 80 00 00 	movabs $0x8002c5,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80036c:	c9                   	leave
+  80036d:	c3                   	ret
+
+000000000080036e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80036e:	55                   	push   %rbp
+  80036f:	48 89 e5             	mov    %rsp,%rbp
+  800372:	41 57                	push   %r15
+  800374:	41 56                	push   %r14
+  800376:	41 55                	push   %r13
+  800378:	41 54                	push   %r12
+  80037a:	53                   	push   %rbx
+  80037b:	48 83 ec 18          	sub    $0x18,%rsp
+  80037f:	49 89 fc             	mov    %rdi,%r12
+  800382:	49 89 f5             	mov    %rsi,%r13
+  800385:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800389:	8b 45 10             	mov    0x10(%rbp),%eax
+  80038c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80038f:	41 89 cf             	mov    %ecx,%r15d
+  800392:	4c 39 fa             	cmp    %r15,%rdx
+  800395:	73 5b                	jae    8003f2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800397:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80039b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80039f:	85 db                	test   %ebx,%ebx
+  8003a1:	7e 0e                	jle    8003b1 <print_num+0x43>
+            putch(padc, put_arg);
+  8003a3:	4c 89 ee             	mov    %r13,%rsi
+  8003a6:	44 89 f7             	mov    %r14d,%edi
+  8003a9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003ac:	83 eb 01             	sub    $0x1,%ebx
+  8003af:	75 f2                	jne    8003a3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003b1:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003b5:	48 b9 b4 50 80 00 00 	movabs $0x8050b4,%rcx
+  8003bc:	00 00 00 
+  8003bf:	48 b8 a3 50 80 00 00 	movabs $0x8050a3,%rax
+  8003c6:	00 00 00 
+  8003c9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003d6:	49 f7 f7             	div    %r15
+  8003d9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003dd:	4c 89 ee             	mov    %r13,%rsi
+  8003e0:	41 ff d4             	call   *%r12
+}
+  8003e3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003e7:	5b                   	pop    %rbx
+  8003e8:	41 5c                	pop    %r12
+  8003ea:	41 5d                	pop    %r13
+  8003ec:	41 5e                	pop    %r14
+  8003ee:	41 5f                	pop    %r15
+  8003f0:	5d                   	pop    %rbp
+  8003f1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003fb:	49 f7 f7             	div    %r15
+  8003fe:	48 83 ec 08          	sub    $0x8,%rsp
+  800402:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800406:	52                   	push   %rdx
+  800407:	45 0f be c9          	movsbl %r9b,%r9d
+  80040b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80040f:	48 89 c2             	mov    %rax,%rdx
+  800412:	48 b8 6e 03 80 00 00 	movabs $0x80036e,%rax
+  800419:	00 00 00 
+  80041c:	ff d0                	call   *%rax
+  80041e:	48 83 c4 10          	add    $0x10,%rsp
+  800422:	eb 8d                	jmp    8003b1 <print_num+0x43>
+
+0000000000800424 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800424:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800428:	48 8b 06             	mov    (%rsi),%rax
+  80042b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80042f:	73 0a                	jae    80043b <sprintputch+0x17>
+        *state->start++ = ch;
+  800431:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800435:	48 89 16             	mov    %rdx,(%rsi)
+  800438:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80043b:	c3                   	ret
+
+000000000080043c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80043c:	55                   	push   %rbp
+  80043d:	48 89 e5             	mov    %rsp,%rbp
+  800440:	48 83 ec 50          	sub    $0x50,%rsp
+  800444:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800448:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80044c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800450:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800457:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80045b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80045f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800463:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800467:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80046b:	48 b8 79 04 80 00 00 	movabs $0x800479,%rax
+  800472:	00 00 00 
+  800475:	ff d0                	call   *%rax
+}
+  800477:	c9                   	leave
+  800478:	c3                   	ret
+
+0000000000800479 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800479:	55                   	push   %rbp
+  80047a:	48 89 e5             	mov    %rsp,%rbp
+  80047d:	41 57                	push   %r15
+  80047f:	41 56                	push   %r14
+  800481:	41 55                	push   %r13
+  800483:	41 54                	push   %r12
+  800485:	53                   	push   %rbx
+  800486:	48 83 ec 38          	sub    $0x38,%rsp
+  80048a:	49 89 fe             	mov    %rdi,%r14
+  80048d:	49 89 f5             	mov    %rsi,%r13
+  800490:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800493:	48 8b 01             	mov    (%rcx),%rax
+  800496:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80049a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80049e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004aa:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004ae:	0f b6 3b             	movzbl (%rbx),%edi
+  8004b1:	40 80 ff 25          	cmp    $0x25,%dil
+  8004b5:	74 18                	je     8004cf <vprintfmt+0x56>
+            if (!ch) return;
+  8004b7:	40 84 ff             	test   %dil,%dil
+  8004ba:	0f 84 04 07 00 00    	je     800bc4 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8004c0:	40 0f b6 ff          	movzbl %dil,%edi
+  8004c4:	4c 89 ee             	mov    %r13,%rsi
+  8004c7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004ca:	4c 89 e3             	mov    %r12,%rbx
+  8004cd:	eb db                	jmp    8004aa <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004d8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004dd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004e3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004ea:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004ee:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004f3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004f8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004fb:	83 e8 23             	sub    $0x23,%eax
+  8004fe:	3c 57                	cmp    $0x57,%al
+  800500:	0f 87 a4 06 00 00    	ja     800baa <vprintfmt+0x731>
+  800506:	0f b6 c0             	movzbl %al,%eax
+  800509:	48 b9 40 52 80 00 00 	movabs $0x805240,%rcx
+  800510:	00 00 00 
+  800513:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800516:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800519:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80051d:	eb cf                	jmp    8004ee <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80051f:	49 89 dc             	mov    %rbx,%r12
+  800522:	be 01 00 00 00       	mov    $0x1,%esi
+  800527:	eb c5                	jmp    8004ee <vprintfmt+0x75>
+            padc = ch;
+  800529:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80052d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800530:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800533:	eb b9                	jmp    8004ee <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800535:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800538:	83 f8 2f             	cmp    $0x2f,%eax
+  80053b:	77 24                	ja     800561 <vprintfmt+0xe8>
+  80053d:	89 c1                	mov    %eax,%ecx
+  80053f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800543:	83 c0 08             	add    $0x8,%eax
+  800546:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800549:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80054c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80054f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800553:	79 99                	jns    8004ee <vprintfmt+0x75>
+                width = precision;
+  800555:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800559:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80055f:	eb 8d                	jmp    8004ee <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800561:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800565:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800569:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056d:	eb da                	jmp    800549 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80056f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800574:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800578:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80057e:	3c 39                	cmp    $0x39,%al
+  800580:	77 1c                	ja     80059e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800582:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800586:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80058a:	0f b6 c0             	movzbl %al,%eax
+  80058d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800592:	0f b6 03             	movzbl (%rbx),%eax
+  800595:	3c 39                	cmp    $0x39,%al
+  800597:	76 e9                	jbe    800582 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800599:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80059c:	eb b1                	jmp    80054f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80059e:	49 89 dc             	mov    %rbx,%r12
+  8005a1:	eb ac                	jmp    80054f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005a3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005a6:	85 c9                	test   %ecx,%ecx
+  8005a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ad:	0f 49 c1             	cmovns %ecx,%eax
+  8005b0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005b3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005b6:	e9 33 ff ff ff       	jmp    8004ee <vprintfmt+0x75>
+            lflag++;
+  8005bb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005be:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005c1:	e9 28 ff ff ff       	jmp    8004ee <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8005cc:	77 19                	ja     8005e7 <vprintfmt+0x16e>
+  8005ce:	89 c2                	mov    %eax,%edx
+  8005d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d4:	83 c0 08             	add    $0x8,%eax
+  8005d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005da:	8b 3a                	mov    (%rdx),%edi
+  8005dc:	4c 89 ee             	mov    %r13,%rsi
+  8005df:	41 ff d6             	call   *%r14
+            break;
+  8005e2:	e9 c3 fe ff ff       	jmp    8004aa <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f3:	eb e5                	jmp    8005da <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005fb:	77 5a                	ja     800657 <vprintfmt+0x1de>
+  8005fd:	89 c2                	mov    %eax,%edx
+  8005ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800603:	83 c0 08             	add    $0x8,%eax
+  800606:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800609:	8b 02                	mov    (%rdx),%eax
+  80060b:	89 c1                	mov    %eax,%ecx
+  80060d:	f7 d9                	neg    %ecx
+  80060f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800612:	83 f9 13             	cmp    $0x13,%ecx
+  800615:	7f 4e                	jg     800665 <vprintfmt+0x1ec>
+  800617:	48 63 c1             	movslq %ecx,%rax
+  80061a:	48 ba 00 55 80 00 00 	movabs $0x805500,%rdx
+  800621:	00 00 00 
+  800624:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800628:	48 85 c0             	test   %rax,%rax
+  80062b:	74 38                	je     800665 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80062d:	48 89 c1             	mov    %rax,%rcx
+  800630:	48 ba ea 56 80 00 00 	movabs $0x8056ea,%rdx
+  800637:	00 00 00 
+  80063a:	4c 89 ee             	mov    %r13,%rsi
+  80063d:	4c 89 f7             	mov    %r14,%rdi
+  800640:	b8 00 00 00 00       	mov    $0x0,%eax
+  800645:	49 b8 3c 04 80 00 00 	movabs $0x80043c,%r8
+  80064c:	00 00 00 
+  80064f:	41 ff d0             	call   *%r8
+  800652:	e9 53 fe ff ff       	jmp    8004aa <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800657:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80065b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80065f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800663:	eb a4                	jmp    800609 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800665:	48 ba cc 50 80 00 00 	movabs $0x8050cc,%rdx
+  80066c:	00 00 00 
+  80066f:	4c 89 ee             	mov    %r13,%rsi
+  800672:	4c 89 f7             	mov    %r14,%rdi
+  800675:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067a:	49 b8 3c 04 80 00 00 	movabs $0x80043c,%r8
+  800681:	00 00 00 
+  800684:	41 ff d0             	call   *%r8
+  800687:	e9 1e fe ff ff       	jmp    8004aa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80068c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068f:	83 f8 2f             	cmp    $0x2f,%eax
+  800692:	77 36                	ja     8006ca <vprintfmt+0x251>
+  800694:	89 c2                	mov    %eax,%edx
+  800696:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069a:	83 c0 08             	add    $0x8,%eax
+  80069d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a0:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8006a3:	48 85 f6             	test   %rsi,%rsi
+  8006a6:	48 b8 c5 50 80 00 00 	movabs $0x8050c5,%rax
+  8006ad:	00 00 00 
+  8006b0:	48 0f 45 c6          	cmovne %rsi,%rax
+  8006b4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006b8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006bc:	7e 06                	jle    8006c4 <vprintfmt+0x24b>
+  8006be:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006c2:	75 14                	jne    8006d8 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006c4:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8006c8:	eb 5b                	jmp    800725 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8006ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d6:	eb c8                	jmp    8006a0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006d8:	49 63 f7             	movslq %r15d,%rsi
+  8006db:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006df:	48 b8 7e 0c 80 00 00 	movabs $0x800c7e,%rax
+  8006e6:	00 00 00 
+  8006e9:	ff d0                	call   *%rax
+  8006eb:	48 89 c2             	mov    %rax,%rdx
+  8006ee:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006f1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006f3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006f6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006f9:	85 c0                	test   %eax,%eax
+  8006fb:	7e c7                	jle    8006c4 <vprintfmt+0x24b>
+  8006fd:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800702:	4c 89 ee             	mov    %r13,%rsi
+  800705:	44 89 e7             	mov    %r12d,%edi
+  800708:	41 ff d6             	call   *%r14
+  80070b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80070f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800712:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800715:	75 eb                	jne    800702 <vprintfmt+0x289>
+  800717:	eb ab                	jmp    8006c4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800719:	0f b6 f8             	movzbl %al,%edi
+  80071c:	4c 89 ee             	mov    %r13,%rsi
+  80071f:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800722:	4c 89 e2             	mov    %r12,%rdx
+  800725:	45 85 ff             	test   %r15d,%r15d
+  800728:	78 06                	js     800730 <vprintfmt+0x2b7>
+  80072a:	41 83 ef 01          	sub    $0x1,%r15d
+  80072e:	78 23                	js     800753 <vprintfmt+0x2da>
+  800730:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800734:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80073a:	84 c0                	test   %al,%al
+  80073c:	74 15                	je     800753 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80073e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800742:	74 d5                	je     800719 <vprintfmt+0x2a0>
+  800744:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800747:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80074c:	80 fa 5e             	cmp    $0x5e,%dl
+  80074f:	77 cb                	ja     80071c <vprintfmt+0x2a3>
+  800751:	eb c6                	jmp    800719 <vprintfmt+0x2a0>
+  800753:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800756:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800759:	01 f0                	add    %esi,%eax
+  80075b:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80075d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800761:	85 c0                	test   %eax,%eax
+  800763:	0f 8e 41 fd ff ff    	jle    8004aa <vprintfmt+0x31>
+  800769:	4c 89 ee             	mov    %r13,%rsi
+  80076c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800771:	41 ff d6             	call   *%r14
+  800774:	41 83 ec 01          	sub    $0x1,%r12d
+  800778:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80077c:	75 eb                	jne    800769 <vprintfmt+0x2f0>
+  80077e:	e9 27 fd ff ff       	jmp    8004aa <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800783:	40 84 f6             	test   %sil,%sil
+  800786:	75 26                	jne    8007ae <vprintfmt+0x335>
+    switch (lflag) {
+  800788:	85 d2                	test   %edx,%edx
+  80078a:	74 59                	je     8007e5 <vprintfmt+0x36c>
+  80078c:	83 fa 01             	cmp    $0x1,%edx
+  80078f:	74 7b                	je     80080c <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800791:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800794:	83 f8 2f             	cmp    $0x2f,%eax
+  800797:	0f 87 96 00 00 00    	ja     800833 <vprintfmt+0x3ba>
+  80079d:	89 c2                	mov    %eax,%edx
+  80079f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a3:	83 c0 08             	add    $0x8,%eax
+  8007a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a9:	4c 8b 22             	mov    (%rdx),%r12
+  8007ac:	eb 17                	jmp    8007c5 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b4:	77 21                	ja     8007d7 <vprintfmt+0x35e>
+  8007b6:	89 c2                	mov    %eax,%edx
+  8007b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007bc:	83 c0 08             	add    $0x8,%eax
+  8007bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007c5:	4d 85 e4             	test   %r12,%r12
+  8007c8:	78 7a                	js     800844 <vprintfmt+0x3cb>
+            num = i;
+  8007ca:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007cd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007d2:	e9 b5 02 00 00       	jmp    800a8c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e3:	eb dd                	jmp    8007c2 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8007e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007eb:	77 11                	ja     8007fe <vprintfmt+0x385>
+  8007ed:	89 c2                	mov    %eax,%edx
+  8007ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f3:	83 c0 08             	add    $0x8,%eax
+  8007f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f9:	4c 63 22             	movslq (%rdx),%r12
+  8007fc:	eb c7                	jmp    8007c5 <vprintfmt+0x34c>
+  8007fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800802:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800806:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080a:	eb ed                	jmp    8007f9 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80080c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080f:	83 f8 2f             	cmp    $0x2f,%eax
+  800812:	77 11                	ja     800825 <vprintfmt+0x3ac>
+  800814:	89 c2                	mov    %eax,%edx
+  800816:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081a:	83 c0 08             	add    $0x8,%eax
+  80081d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800820:	4c 8b 22             	mov    (%rdx),%r12
+  800823:	eb a0                	jmp    8007c5 <vprintfmt+0x34c>
+  800825:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800829:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800831:	eb ed                	jmp    800820 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800833:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800837:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083f:	e9 65 ff ff ff       	jmp    8007a9 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800844:	4c 89 ee             	mov    %r13,%rsi
+  800847:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80084c:	41 ff d6             	call   *%r14
+                i = -i;
+  80084f:	49 f7 dc             	neg    %r12
+  800852:	e9 73 ff ff ff       	jmp    8007ca <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800857:	40 84 f6             	test   %sil,%sil
+  80085a:	75 32                	jne    80088e <vprintfmt+0x415>
+    switch (lflag) {
+  80085c:	85 d2                	test   %edx,%edx
+  80085e:	74 5d                	je     8008bd <vprintfmt+0x444>
+  800860:	83 fa 01             	cmp    $0x1,%edx
+  800863:	0f 84 82 00 00 00    	je     8008eb <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800869:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086c:	83 f8 2f             	cmp    $0x2f,%eax
+  80086f:	0f 87 a5 00 00 00    	ja     80091a <vprintfmt+0x4a1>
+  800875:	89 c2                	mov    %eax,%edx
+  800877:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087b:	83 c0 08             	add    $0x8,%eax
+  80087e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800881:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800884:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800889:	e9 fe 01 00 00       	jmp    800a8c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80088e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800891:	83 f8 2f             	cmp    $0x2f,%eax
+  800894:	77 19                	ja     8008af <vprintfmt+0x436>
+  800896:	89 c2                	mov    %eax,%edx
+  800898:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089c:	83 c0 08             	add    $0x8,%eax
+  80089f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008a5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008aa:	e9 dd 01 00 00       	jmp    800a8c <vprintfmt+0x613>
+  8008af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bb:	eb e5                	jmp    8008a2 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8008bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c3:	77 18                	ja     8008dd <vprintfmt+0x464>
+  8008c5:	89 c2                	mov    %eax,%edx
+  8008c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cb:	83 c0 08             	add    $0x8,%eax
+  8008ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008d3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008d8:	e9 af 01 00 00       	jmp    800a8c <vprintfmt+0x613>
+  8008dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e9:	eb e6                	jmp    8008d1 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8008eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f1:	77 19                	ja     80090c <vprintfmt+0x493>
+  8008f3:	89 c2                	mov    %eax,%edx
+  8008f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f9:	83 c0 08             	add    $0x8,%eax
+  8008fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ff:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800902:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800907:	e9 80 01 00 00       	jmp    800a8c <vprintfmt+0x613>
+  80090c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800910:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800914:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800918:	eb e5                	jmp    8008ff <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80091a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800922:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800926:	e9 56 ff ff ff       	jmp    800881 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80092b:	40 84 f6             	test   %sil,%sil
+  80092e:	75 2e                	jne    80095e <vprintfmt+0x4e5>
+    switch (lflag) {
+  800930:	85 d2                	test   %edx,%edx
+  800932:	0f 84 b3 00 00 00    	je     8009eb <vprintfmt+0x572>
+  800938:	83 fa 01             	cmp    $0x1,%edx
+  80093b:	0f 84 d3 00 00 00    	je     800a14 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800941:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800944:	83 f8 2f             	cmp    $0x2f,%eax
+  800947:	0f 87 f1 00 00 00    	ja     800a3e <vprintfmt+0x5c5>
+  80094d:	89 c2                	mov    %eax,%edx
+  80094f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800953:	83 c0 08             	add    $0x8,%eax
+  800956:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800959:	48 8b 02             	mov    (%rdx),%rax
+  80095c:	eb 17                	jmp    800975 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  80095e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800961:	83 f8 2f             	cmp    $0x2f,%eax
+  800964:	77 77                	ja     8009dd <vprintfmt+0x564>
+  800966:	89 c2                	mov    %eax,%edx
+  800968:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096c:	83 c0 08             	add    $0x8,%eax
+  80096f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800972:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800975:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800977:	83 f8 07             	cmp    $0x7,%eax
+  80097a:	0f 8e cf 00 00 00    	jle    800a4f <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800980:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800986:	44 89 e7             	mov    %r12d,%edi
+  800989:	41 c1 e4 03          	shl    $0x3,%r12d
+  80098d:	89 d1                	mov    %edx,%ecx
+  80098f:	8d 72 07             	lea    0x7(%rdx),%esi
+  800992:	85 d2                	test   %edx,%edx
+  800994:	0f 48 d6             	cmovs  %esi,%edx
+  800997:	c1 fa 03             	sar    $0x3,%edx
+  80099a:	83 f9 3f             	cmp    $0x3f,%ecx
+  80099d:	7f e7                	jg     800986 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80099f:	85 ff                	test   %edi,%edi
+  8009a1:	0f 84 03 fb ff ff    	je     8004aa <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8009a7:	49 63 f4             	movslq %r12d,%rsi
+  8009aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009af:	48 f7 f6             	div    %rsi
+  8009b2:	49 89 d7             	mov    %rdx,%r15
+  8009b5:	83 c0 30             	add    $0x30,%eax
+  8009b8:	0f be f8             	movsbl %al,%edi
+  8009bb:	4c 89 ee             	mov    %r13,%rsi
+  8009be:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  8009c1:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  8009c4:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  8009c9:	45 85 e4             	test   %r12d,%r12d
+  8009cc:	41 0f 49 d4          	cmovns %r12d,%edx
+  8009d0:	c1 fa 03             	sar    $0x3,%edx
+  8009d3:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  8009d6:	75 cf                	jne    8009a7 <vprintfmt+0x52e>
+  8009d8:	e9 cd fa ff ff       	jmp    8004aa <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8009dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e9:	eb 87                	jmp    800972 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  8009eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f1:	77 13                	ja     800a06 <vprintfmt+0x58d>
+  8009f3:	89 c2                	mov    %eax,%edx
+  8009f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f9:	83 c0 08             	add    $0x8,%eax
+  8009fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ff:	8b 02                	mov    (%rdx),%eax
+  800a01:	e9 6f ff ff ff       	jmp    800975 <vprintfmt+0x4fc>
+  800a06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a12:	eb eb                	jmp    8009ff <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800a14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a17:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1a:	77 14                	ja     800a30 <vprintfmt+0x5b7>
+  800a1c:	89 c2                	mov    %eax,%edx
+  800a1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a22:	83 c0 08             	add    $0x8,%eax
+  800a25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a28:	48 8b 02             	mov    (%rdx),%rax
+  800a2b:	e9 45 ff ff ff       	jmp    800975 <vprintfmt+0x4fc>
+  800a30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3c:	eb ea                	jmp    800a28 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800a3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4a:	e9 0a ff ff ff       	jmp    800959 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800a4f:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800a55:	e9 4d ff ff ff       	jmp    8009a7 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800a5a:	4c 89 ee             	mov    %r13,%rsi
+  800a5d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a62:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a65:	4c 89 ee             	mov    %r13,%rsi
+  800a68:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a6d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a73:	83 f8 2f             	cmp    $0x2f,%eax
+  800a76:	77 47                	ja     800abf <vprintfmt+0x646>
+  800a78:	89 c2                	mov    %eax,%edx
+  800a7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7e:	83 c0 08             	add    $0x8,%eax
+  800a81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a84:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a87:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a8c:	48 83 ec 08          	sub    $0x8,%rsp
+  800a90:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a94:	0f 94 c0             	sete   %al
+  800a97:	0f b6 c0             	movzbl %al,%eax
+  800a9a:	50                   	push   %rax
+  800a9b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800aa0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800aa4:	4c 89 ee             	mov    %r13,%rsi
+  800aa7:	4c 89 f7             	mov    %r14,%rdi
+  800aaa:	48 b8 6e 03 80 00 00 	movabs $0x80036e,%rax
+  800ab1:	00 00 00 
+  800ab4:	ff d0                	call   *%rax
+            break;
+  800ab6:	48 83 c4 10          	add    $0x10,%rsp
+  800aba:	e9 eb f9 ff ff       	jmp    8004aa <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800abf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800acb:	eb b7                	jmp    800a84 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800acd:	40 84 f6             	test   %sil,%sil
+  800ad0:	75 2b                	jne    800afd <vprintfmt+0x684>
+    switch (lflag) {
+  800ad2:	85 d2                	test   %edx,%edx
+  800ad4:	74 56                	je     800b2c <vprintfmt+0x6b3>
+  800ad6:	83 fa 01             	cmp    $0x1,%edx
+  800ad9:	74 7f                	je     800b5a <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800adb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ade:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae1:	0f 87 a2 00 00 00    	ja     800b89 <vprintfmt+0x710>
+  800ae7:	89 c2                	mov    %eax,%edx
+  800ae9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aed:	83 c0 08             	add    $0x8,%eax
+  800af0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800afb:	eb 8f                	jmp    800a8c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800afd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b00:	83 f8 2f             	cmp    $0x2f,%eax
+  800b03:	77 19                	ja     800b1e <vprintfmt+0x6a5>
+  800b05:	89 c2                	mov    %eax,%edx
+  800b07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0b:	83 c0 08             	add    $0x8,%eax
+  800b0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b11:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b14:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b19:	e9 6e ff ff ff       	jmp    800a8c <vprintfmt+0x613>
+  800b1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2a:	eb e5                	jmp    800b11 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800b2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b32:	77 18                	ja     800b4c <vprintfmt+0x6d3>
+  800b34:	89 c2                	mov    %eax,%edx
+  800b36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3a:	83 c0 08             	add    $0x8,%eax
+  800b3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b40:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b42:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b47:	e9 40 ff ff ff       	jmp    800a8c <vprintfmt+0x613>
+  800b4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b58:	eb e6                	jmp    800b40 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800b5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b60:	77 19                	ja     800b7b <vprintfmt+0x702>
+  800b62:	89 c2                	mov    %eax,%edx
+  800b64:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b68:	83 c0 08             	add    $0x8,%eax
+  800b6b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b71:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b76:	e9 11 ff ff ff       	jmp    800a8c <vprintfmt+0x613>
+  800b7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b87:	eb e5                	jmp    800b6e <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800b89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b95:	e9 59 ff ff ff       	jmp    800af3 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800b9a:	4c 89 ee             	mov    %r13,%rsi
+  800b9d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ba2:	41 ff d6             	call   *%r14
+            break;
+  800ba5:	e9 00 f9 ff ff       	jmp    8004aa <vprintfmt+0x31>
+            putch('%', put_arg);
+  800baa:	4c 89 ee             	mov    %r13,%rsi
+  800bad:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bb2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bb5:	48 83 eb 01          	sub    $0x1,%rbx
+  800bb9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bbd:	75 f6                	jne    800bb5 <vprintfmt+0x73c>
+  800bbf:	e9 e6 f8 ff ff       	jmp    8004aa <vprintfmt+0x31>
+}
+  800bc4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bc8:	5b                   	pop    %rbx
+  800bc9:	41 5c                	pop    %r12
+  800bcb:	41 5d                	pop    %r13
+  800bcd:	41 5e                	pop    %r14
+  800bcf:	41 5f                	pop    %r15
+  800bd1:	5d                   	pop    %rbp
+  800bd2:	c3                   	ret
+
+0000000000800bd3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bd3:	55                   	push   %rbp
+  800bd4:	48 89 e5             	mov    %rsp,%rbp
+  800bd7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bdb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bdf:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800be4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800be8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bef:	48 85 ff             	test   %rdi,%rdi
+  800bf2:	74 2b                	je     800c1f <vsnprintf+0x4c>
+  800bf4:	48 85 f6             	test   %rsi,%rsi
+  800bf7:	74 26                	je     800c1f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bf9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bfd:	48 bf 24 04 80 00 00 	movabs $0x800424,%rdi
+  800c04:	00 00 00 
+  800c07:	48 b8 79 04 80 00 00 	movabs $0x800479,%rax
+  800c0e:	00 00 00 
+  800c11:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c17:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c1a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c1d:	c9                   	leave
+  800c1e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c24:	eb f7                	jmp    800c1d <vsnprintf+0x4a>
+
+0000000000800c26 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c26:	55                   	push   %rbp
+  800c27:	48 89 e5             	mov    %rsp,%rbp
+  800c2a:	48 83 ec 50          	sub    $0x50,%rsp
+  800c2e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c32:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c36:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c3a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c41:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c49:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c4d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c51:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c55:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  800c5c:	00 00 00 
+  800c5f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c61:	c9                   	leave
+  800c62:	c3                   	ret
+
+0000000000800c63 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c63:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c66:	74 10                	je     800c78 <strlen+0x15>
+    size_t n = 0;
+  800c68:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c6d:	48 83 c0 01          	add    $0x1,%rax
+  800c71:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c75:	75 f6                	jne    800c6d <strlen+0xa>
+  800c77:	c3                   	ret
+    size_t n = 0;
+  800c78:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c7d:	c3                   	ret
+
+0000000000800c7e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c7e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c81:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c86:	48 85 f6             	test   %rsi,%rsi
+  800c89:	74 11                	je     800c9c <strnlen+0x1e>
+  800c8b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c8f:	74 0c                	je     800c9d <strnlen+0x1f>
+  800c91:	48 83 c2 01          	add    $0x1,%rdx
+  800c95:	48 39 d0             	cmp    %rdx,%rax
+  800c98:	75 f1                	jne    800c8b <strnlen+0xd>
+  800c9a:	eb 04                	jmp    800ca0 <strnlen+0x22>
+  800c9c:	c3                   	ret
+  800c9d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ca0:	c3                   	ret
+
+0000000000800ca1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ca1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ca4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cad:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cb0:	48 83 c2 01          	add    $0x1,%rdx
+  800cb4:	84 c9                	test   %cl,%cl
+  800cb6:	75 f1                	jne    800ca9 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cb8:	c3                   	ret
+
+0000000000800cb9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cb9:	55                   	push   %rbp
+  800cba:	48 89 e5             	mov    %rsp,%rbp
+  800cbd:	41 54                	push   %r12
+  800cbf:	53                   	push   %rbx
+  800cc0:	48 89 fb             	mov    %rdi,%rbx
+  800cc3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cc6:	48 b8 63 0c 80 00 00 	movabs $0x800c63,%rax
+  800ccd:	00 00 00 
+  800cd0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cd2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cd6:	4c 89 e6             	mov    %r12,%rsi
+  800cd9:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  800ce0:	00 00 00 
+  800ce3:	ff d0                	call   *%rax
+    return dst;
+}
+  800ce5:	48 89 d8             	mov    %rbx,%rax
+  800ce8:	5b                   	pop    %rbx
+  800ce9:	41 5c                	pop    %r12
+  800ceb:	5d                   	pop    %rbp
+  800cec:	c3                   	ret
+
+0000000000800ced <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ced:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cf0:	48 85 d2             	test   %rdx,%rdx
+  800cf3:	74 1f                	je     800d14 <strncpy+0x27>
+  800cf5:	48 01 fa             	add    %rdi,%rdx
+  800cf8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cfb:	48 83 c1 01          	add    $0x1,%rcx
+  800cff:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d03:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d07:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d0b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d0f:	48 39 ca             	cmp    %rcx,%rdx
+  800d12:	75 e7                	jne    800cfb <strncpy+0xe>
+    }
+    return ret;
+}
+  800d14:	c3                   	ret
+
+0000000000800d15 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d15:	48 89 f8             	mov    %rdi,%rax
+  800d18:	48 85 d2             	test   %rdx,%rdx
+  800d1b:	74 24                	je     800d41 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d1d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d21:	74 1b                	je     800d3e <strlcpy+0x29>
+  800d23:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d27:	0f b6 16             	movzbl (%rsi),%edx
+  800d2a:	84 d2                	test   %dl,%dl
+  800d2c:	74 10                	je     800d3e <strlcpy+0x29>
+            *dst++ = *src++;
+  800d2e:	48 83 c6 01          	add    $0x1,%rsi
+  800d32:	48 83 c0 01          	add    $0x1,%rax
+  800d36:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d39:	48 39 c8             	cmp    %rcx,%rax
+  800d3c:	75 e9                	jne    800d27 <strlcpy+0x12>
+        *dst = '\0';
+  800d3e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d41:	48 29 f8             	sub    %rdi,%rax
+}
+  800d44:	c3                   	ret
+
+0000000000800d45 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d45:	0f b6 07             	movzbl (%rdi),%eax
+  800d48:	84 c0                	test   %al,%al
+  800d4a:	74 13                	je     800d5f <strcmp+0x1a>
+  800d4c:	38 06                	cmp    %al,(%rsi)
+  800d4e:	75 0f                	jne    800d5f <strcmp+0x1a>
+  800d50:	48 83 c7 01          	add    $0x1,%rdi
+  800d54:	48 83 c6 01          	add    $0x1,%rsi
+  800d58:	0f b6 07             	movzbl (%rdi),%eax
+  800d5b:	84 c0                	test   %al,%al
+  800d5d:	75 ed                	jne    800d4c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d5f:	0f b6 c0             	movzbl %al,%eax
+  800d62:	0f b6 16             	movzbl (%rsi),%edx
+  800d65:	29 d0                	sub    %edx,%eax
+}
+  800d67:	c3                   	ret
+
+0000000000800d68 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d68:	48 85 d2             	test   %rdx,%rdx
+  800d6b:	74 1f                	je     800d8c <strncmp+0x24>
+  800d6d:	0f b6 07             	movzbl (%rdi),%eax
+  800d70:	84 c0                	test   %al,%al
+  800d72:	74 1e                	je     800d92 <strncmp+0x2a>
+  800d74:	3a 06                	cmp    (%rsi),%al
+  800d76:	75 1a                	jne    800d92 <strncmp+0x2a>
+  800d78:	48 83 c7 01          	add    $0x1,%rdi
+  800d7c:	48 83 c6 01          	add    $0x1,%rsi
+  800d80:	48 83 ea 01          	sub    $0x1,%rdx
+  800d84:	75 e7                	jne    800d6d <strncmp+0x5>
+
+    if (!n) return 0;
+  800d86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8b:	c3                   	ret
+  800d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d91:	c3                   	ret
+  800d92:	48 85 d2             	test   %rdx,%rdx
+  800d95:	74 09                	je     800da0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d97:	0f b6 07             	movzbl (%rdi),%eax
+  800d9a:	0f b6 16             	movzbl (%rsi),%edx
+  800d9d:	29 d0                	sub    %edx,%eax
+  800d9f:	c3                   	ret
+    if (!n) return 0;
+  800da0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da5:	c3                   	ret
+
+0000000000800da6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800da6:	0f b6 17             	movzbl (%rdi),%edx
+  800da9:	84 d2                	test   %dl,%dl
+  800dab:	74 18                	je     800dc5 <strchr+0x1f>
+        if (*str == c) {
+  800dad:	0f be d2             	movsbl %dl,%edx
+  800db0:	39 f2                	cmp    %esi,%edx
+  800db2:	74 17                	je     800dcb <strchr+0x25>
+    for (; *str; str++) {
+  800db4:	48 83 c7 01          	add    $0x1,%rdi
+  800db8:	0f b6 17             	movzbl (%rdi),%edx
+  800dbb:	84 d2                	test   %dl,%dl
+  800dbd:	75 ee                	jne    800dad <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc4:	c3                   	ret
+  800dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dca:	c3                   	ret
+  800dcb:	48 89 f8             	mov    %rdi,%rax
+}
+  800dce:	c3                   	ret
+
+0000000000800dcf <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dcf:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dd2:	0f b6 17             	movzbl (%rdi),%edx
+  800dd5:	84 d2                	test   %dl,%dl
+  800dd7:	74 13                	je     800dec <strfind+0x1d>
+  800dd9:	0f be d2             	movsbl %dl,%edx
+  800ddc:	39 f2                	cmp    %esi,%edx
+  800dde:	74 0b                	je     800deb <strfind+0x1c>
+  800de0:	48 83 c0 01          	add    $0x1,%rax
+  800de4:	0f b6 10             	movzbl (%rax),%edx
+  800de7:	84 d2                	test   %dl,%dl
+  800de9:	75 ee                	jne    800dd9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800deb:	c3                   	ret
+  800dec:	c3                   	ret
+
+0000000000800ded <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800ded:	55                   	push   %rbp
+  800dee:	48 89 e5             	mov    %rsp,%rbp
+  800df1:	41 57                	push   %r15
+  800df3:	41 56                	push   %r14
+  800df5:	41 55                	push   %r13
+  800df7:	41 54                	push   %r12
+  800df9:	53                   	push   %rbx
+  800dfa:	48 83 ec 08          	sub    $0x8,%rsp
+  800dfe:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800e01:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800e05:	45 84 ed             	test   %r13b,%r13b
+  800e08:	75 12                	jne    800e1c <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800e0a:	4c 89 f8             	mov    %r15,%rax
+  800e0d:	48 83 c4 08          	add    $0x8,%rsp
+  800e11:	5b                   	pop    %rbx
+  800e12:	41 5c                	pop    %r12
+  800e14:	41 5d                	pop    %r13
+  800e16:	41 5e                	pop    %r14
+  800e18:	41 5f                	pop    %r15
+  800e1a:	5d                   	pop    %rbp
+  800e1b:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800e1c:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800e20:	4c 89 e7             	mov    %r12,%rdi
+  800e23:	48 b8 63 0c 80 00 00 	movabs $0x800c63,%rax
+  800e2a:	00 00 00 
+  800e2d:	ff d0                	call   *%rax
+  800e2f:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800e32:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800e36:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800e3a:	49 bf 68 0d 80 00 00 	movabs $0x800d68,%r15
+  800e41:	00 00 00 
+				if ((sc = *s++) == 0)
+  800e44:	84 c0                	test   %al,%al
+  800e46:	75 14                	jne    800e5c <strstr+0x6f>
+					return NULL;
+  800e48:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e4e:	eb ba                	jmp    800e0a <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800e50:	48 83 c3 01          	add    $0x1,%rbx
+  800e54:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800e58:	84 c0                	test   %al,%al
+  800e5a:	74 1b                	je     800e77 <strstr+0x8a>
+			} while (sc != c);
+  800e5c:	41 38 c5             	cmp    %al,%r13b
+  800e5f:	75 ef                	jne    800e50 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800e61:	4c 89 f2             	mov    %r14,%rdx
+  800e64:	4c 89 e6             	mov    %r12,%rsi
+  800e67:	48 89 df             	mov    %rbx,%rdi
+  800e6a:	41 ff d7             	call   *%r15
+  800e6d:	85 c0                	test   %eax,%eax
+  800e6f:	75 df                	jne    800e50 <strstr+0x63>
+  800e71:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800e75:	eb 93                	jmp    800e0a <strstr+0x1d>
+					return NULL;
+  800e77:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e7d:	eb 8b                	jmp    800e0a <strstr+0x1d>
+
+0000000000800e7f <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800e7f:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800e81:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800e84:	8d 57 20             	lea    0x20(%rdi),%edx
+  800e87:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e8a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e8d:	c3                   	ret
+
+0000000000800e8e <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800e8e:	55                   	push   %rbp
+  800e8f:	48 89 e5             	mov    %rsp,%rbp
+  800e92:	41 57                	push   %r15
+  800e94:	41 56                	push   %r14
+  800e96:	41 55                	push   %r13
+  800e98:	41 54                	push   %r12
+  800e9a:	53                   	push   %rbx
+  800e9b:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800e9f:	48 39 f7             	cmp    %rsi,%rdi
+  800ea2:	74 49                	je     800eed <strcasecmp+0x5f>
+  800ea4:	49 89 fd             	mov    %rdi,%r13
+  800ea7:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800eaa:	49 bf 7f 0e 80 00 00 	movabs $0x800e7f,%r15
+  800eb1:	00 00 00 
+  800eb4:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800eb9:	41 0f b6 fe          	movzbl %r14b,%edi
+  800ebd:	41 ff d7             	call   *%r15
+  800ec0:	89 c3                	mov    %eax,%ebx
+  800ec2:	49 83 c4 01          	add    $0x1,%r12
+  800ec6:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800ecc:	41 ff d7             	call   *%r15
+  800ecf:	29 c3                	sub    %eax,%ebx
+  800ed1:	75 09                	jne    800edc <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800ed3:	49 83 c5 01          	add    $0x1,%r13
+  800ed7:	45 84 f6             	test   %r14b,%r14b
+  800eda:	75 d8                	jne    800eb4 <strcasecmp+0x26>
+}
+  800edc:	89 d8                	mov    %ebx,%eax
+  800ede:	48 83 c4 08          	add    $0x8,%rsp
+  800ee2:	5b                   	pop    %rbx
+  800ee3:	41 5c                	pop    %r12
+  800ee5:	41 5d                	pop    %r13
+  800ee7:	41 5e                	pop    %r14
+  800ee9:	41 5f                	pop    %r15
+  800eeb:	5d                   	pop    %rbp
+  800eec:	c3                   	ret
+        return 0;
+  800eed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef2:	eb e8                	jmp    800edc <strcasecmp+0x4e>
+
+0000000000800ef4 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800ef4:	55                   	push   %rbp
+  800ef5:	48 89 e5             	mov    %rsp,%rbp
+  800ef8:	41 57                	push   %r15
+  800efa:	41 56                	push   %r14
+  800efc:	41 55                	push   %r13
+  800efe:	41 54                	push   %r12
+  800f00:	53                   	push   %rbx
+  800f01:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800f05:	48 85 d2             	test   %rdx,%rdx
+  800f08:	74 4f                	je     800f59 <strncasecmp+0x65>
+  800f0a:	49 89 fc             	mov    %rdi,%r12
+  800f0d:	49 89 f5             	mov    %rsi,%r13
+  800f10:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800f14:	49 be 7f 0e 80 00 00 	movabs $0x800e7f,%r14
+  800f1b:	00 00 00 
+  800f1e:	49 83 c4 01          	add    $0x1,%r12
+  800f22:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800f28:	41 ff d6             	call   *%r14
+  800f2b:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800f2d:	49 83 c5 01          	add    $0x1,%r13
+  800f31:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800f36:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800f39:	29 c3                	sub    %eax,%ebx
+  800f3b:	85 c0                	test   %eax,%eax
+  800f3d:	74 09                	je     800f48 <strncasecmp+0x54>
+  800f3f:	85 db                	test   %ebx,%ebx
+  800f41:	75 05                	jne    800f48 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800f43:	4d 39 fc             	cmp    %r15,%r12
+  800f46:	75 d6                	jne    800f1e <strncasecmp+0x2a>
+}
+  800f48:	89 d8                	mov    %ebx,%eax
+  800f4a:	48 83 c4 08          	add    $0x8,%rsp
+  800f4e:	5b                   	pop    %rbx
+  800f4f:	41 5c                	pop    %r12
+  800f51:	41 5d                	pop    %r13
+  800f53:	41 5e                	pop    %r14
+  800f55:	41 5f                	pop    %r15
+  800f57:	5d                   	pop    %rbp
+  800f58:	c3                   	ret
+    int d = 0;
+  800f59:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800f5e:	eb e8                	jmp    800f48 <strncasecmp+0x54>
+
+0000000000800f60 <toupper>:
+
+int toupper(int c) {
+  800f60:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800f62:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800f65:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800f68:	83 f9 1a             	cmp    $0x1a,%ecx
+  800f6b:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800f6e:	c3                   	ret
+
+0000000000800f6f <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800f6f:	83 ff 20             	cmp    $0x20,%edi
+  800f72:	0f 94 c0             	sete   %al
+  800f75:	0f b6 c0             	movzbl %al,%eax
+}
+  800f78:	c3                   	ret
+
+0000000000800f79 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800f79:	89 f8                	mov    %edi,%eax
+  800f7b:	f7 d8                	neg    %eax
+  800f7d:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800f80:	c3                   	ret
+
+0000000000800f81 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f81:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f84:	48 89 f8             	mov    %rdi,%rax
+  800f87:	48 f7 d8             	neg    %rax
+  800f8a:	83 e0 07             	and    $0x7,%eax
+  800f8d:	49 89 d1             	mov    %rdx,%r9
+  800f90:	49 29 c1             	sub    %rax,%r9
+  800f93:	78 36                	js     800fcb <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f95:	40 0f b6 c6          	movzbl %sil,%eax
+  800f99:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fa0:	01 01 01 
+  800fa3:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fa7:	40 f6 c7 07          	test   $0x7,%dil
+  800fab:	75 38                	jne    800fe5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fad:	4c 89 c9             	mov    %r9,%rcx
+  800fb0:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fb4:	74 0c                	je     800fc2 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fb6:	fc                   	cld
+  800fb7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fba:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fbe:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fc2:	4d 85 c9             	test   %r9,%r9
+  800fc5:	75 45                	jne    80100c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fc7:	4c 89 c0             	mov    %r8,%rax
+  800fca:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fcb:	48 85 d2             	test   %rdx,%rdx
+  800fce:	74 f7                	je     800fc7 <memset+0x46>
+  800fd0:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fd3:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fd6:	48 83 c0 01          	add    $0x1,%rax
+  800fda:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fde:	48 39 c2             	cmp    %rax,%rdx
+  800fe1:	75 f3                	jne    800fd6 <memset+0x55>
+  800fe3:	eb e2                	jmp    800fc7 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fe5:	40 f6 c7 01          	test   $0x1,%dil
+  800fe9:	74 06                	je     800ff1 <memset+0x70>
+  800feb:	88 07                	mov    %al,(%rdi)
+  800fed:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ff1:	40 f6 c7 02          	test   $0x2,%dil
+  800ff5:	74 07                	je     800ffe <memset+0x7d>
+  800ff7:	66 89 07             	mov    %ax,(%rdi)
+  800ffa:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ffe:	40 f6 c7 04          	test   $0x4,%dil
+  801002:	74 a9                	je     800fad <memset+0x2c>
+  801004:	89 07                	mov    %eax,(%rdi)
+  801006:	48 83 c7 04          	add    $0x4,%rdi
+  80100a:	eb a1                	jmp    800fad <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80100c:	41 f6 c1 04          	test   $0x4,%r9b
+  801010:	74 06                	je     801018 <memset+0x97>
+  801012:	89 07                	mov    %eax,(%rdi)
+  801014:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801018:	41 f6 c1 02          	test   $0x2,%r9b
+  80101c:	74 07                	je     801025 <memset+0xa4>
+  80101e:	66 89 07             	mov    %ax,(%rdi)
+  801021:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801025:	41 f6 c1 01          	test   $0x1,%r9b
+  801029:	74 9c                	je     800fc7 <memset+0x46>
+  80102b:	88 07                	mov    %al,(%rdi)
+  80102d:	eb 98                	jmp    800fc7 <memset+0x46>
+
+000000000080102f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80102f:	48 89 f8             	mov    %rdi,%rax
+  801032:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801035:	48 39 fe             	cmp    %rdi,%rsi
+  801038:	73 3b                	jae    801075 <memmove+0x46>
+  80103a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80103e:	48 39 d7             	cmp    %rdx,%rdi
+  801041:	73 32                	jae    801075 <memmove+0x46>
+        s += n;
+        d += n;
+  801043:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801047:	48 89 d6             	mov    %rdx,%rsi
+  80104a:	48 09 fe             	or     %rdi,%rsi
+  80104d:	48 09 ce             	or     %rcx,%rsi
+  801050:	40 f6 c6 07          	test   $0x7,%sil
+  801054:	75 12                	jne    801068 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801056:	48 83 ef 08          	sub    $0x8,%rdi
+  80105a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80105e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801062:	fd                   	std
+  801063:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801066:	fc                   	cld
+  801067:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801068:	48 83 ef 01          	sub    $0x1,%rdi
+  80106c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801070:	fd                   	std
+  801071:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801073:	eb f1                	jmp    801066 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801075:	48 89 f2             	mov    %rsi,%rdx
+  801078:	48 09 c2             	or     %rax,%rdx
+  80107b:	48 09 ca             	or     %rcx,%rdx
+  80107e:	f6 c2 07             	test   $0x7,%dl
+  801081:	75 0c                	jne    80108f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801083:	48 c1 e9 03          	shr    $0x3,%rcx
+  801087:	48 89 c7             	mov    %rax,%rdi
+  80108a:	fc                   	cld
+  80108b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80108e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80108f:	48 89 c7             	mov    %rax,%rdi
+  801092:	fc                   	cld
+  801093:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801095:	c3                   	ret
+
+0000000000801096 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801096:	55                   	push   %rbp
+  801097:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80109a:	48 b8 2f 10 80 00 00 	movabs $0x80102f,%rax
+  8010a1:	00 00 00 
+  8010a4:	ff d0                	call   *%rax
+}
+  8010a6:	5d                   	pop    %rbp
+  8010a7:	c3                   	ret
+
+00000000008010a8 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010a8:	55                   	push   %rbp
+  8010a9:	48 89 e5             	mov    %rsp,%rbp
+  8010ac:	41 57                	push   %r15
+  8010ae:	41 56                	push   %r14
+  8010b0:	41 55                	push   %r13
+  8010b2:	41 54                	push   %r12
+  8010b4:	53                   	push   %rbx
+  8010b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b9:	49 89 fe             	mov    %rdi,%r14
+  8010bc:	49 89 f7             	mov    %rsi,%r15
+  8010bf:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010c2:	48 89 f7             	mov    %rsi,%rdi
+  8010c5:	48 b8 63 0c 80 00 00 	movabs $0x800c63,%rax
+  8010cc:	00 00 00 
+  8010cf:	ff d0                	call   *%rax
+  8010d1:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010d4:	48 89 de             	mov    %rbx,%rsi
+  8010d7:	4c 89 f7             	mov    %r14,%rdi
+  8010da:	48 b8 7e 0c 80 00 00 	movabs $0x800c7e,%rax
+  8010e1:	00 00 00 
+  8010e4:	ff d0                	call   *%rax
+  8010e6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010e9:	48 39 c3             	cmp    %rax,%rbx
+  8010ec:	74 36                	je     801124 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010ee:	48 89 d8             	mov    %rbx,%rax
+  8010f1:	4c 29 e8             	sub    %r13,%rax
+  8010f4:	49 39 c4             	cmp    %rax,%r12
+  8010f7:	73 31                	jae    80112a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010f9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010fe:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801102:	4c 89 fe             	mov    %r15,%rsi
+  801105:	48 b8 96 10 80 00 00 	movabs $0x801096,%rax
+  80110c:	00 00 00 
+  80110f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801111:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801115:	48 83 c4 08          	add    $0x8,%rsp
+  801119:	5b                   	pop    %rbx
+  80111a:	41 5c                	pop    %r12
+  80111c:	41 5d                	pop    %r13
+  80111e:	41 5e                	pop    %r14
+  801120:	41 5f                	pop    %r15
+  801122:	5d                   	pop    %rbp
+  801123:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801124:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801128:	eb eb                	jmp    801115 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80112a:	48 83 eb 01          	sub    $0x1,%rbx
+  80112e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801132:	48 89 da             	mov    %rbx,%rdx
+  801135:	4c 89 fe             	mov    %r15,%rsi
+  801138:	48 b8 96 10 80 00 00 	movabs $0x801096,%rax
+  80113f:	00 00 00 
+  801142:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801144:	49 01 de             	add    %rbx,%r14
+  801147:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80114c:	eb c3                	jmp    801111 <strlcat+0x69>
+
+000000000080114e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80114e:	48 85 d2             	test   %rdx,%rdx
+  801151:	74 2d                	je     801180 <memcmp+0x32>
+  801153:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801158:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80115c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801161:	44 38 c1             	cmp    %r8b,%cl
+  801164:	75 0f                	jne    801175 <memcmp+0x27>
+    while (n-- > 0) {
+  801166:	48 83 c0 01          	add    $0x1,%rax
+  80116a:	48 39 c2             	cmp    %rax,%rdx
+  80116d:	75 e9                	jne    801158 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80116f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801174:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801175:	0f b6 c1             	movzbl %cl,%eax
+  801178:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80117c:	44 29 c0             	sub    %r8d,%eax
+  80117f:	c3                   	ret
+    return 0;
+  801180:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801185:	c3                   	ret
+
+0000000000801186 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801186:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80118a:	48 39 c7             	cmp    %rax,%rdi
+  80118d:	73 0f                	jae    80119e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80118f:	40 38 37             	cmp    %sil,(%rdi)
+  801192:	74 0e                	je     8011a2 <memfind+0x1c>
+    for (; src < end; src++) {
+  801194:	48 83 c7 01          	add    $0x1,%rdi
+  801198:	48 39 f8             	cmp    %rdi,%rax
+  80119b:	75 f2                	jne    80118f <memfind+0x9>
+  80119d:	c3                   	ret
+  80119e:	48 89 f8             	mov    %rdi,%rax
+  8011a1:	c3                   	ret
+  8011a2:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011a5:	c3                   	ret
+
+00000000008011a6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011a6:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011a9:	0f b6 37             	movzbl (%rdi),%esi
+  8011ac:	40 80 fe 20          	cmp    $0x20,%sil
+  8011b0:	74 06                	je     8011b8 <strtol+0x12>
+  8011b2:	40 80 fe 09          	cmp    $0x9,%sil
+  8011b6:	75 13                	jne    8011cb <strtol+0x25>
+  8011b8:	48 83 c7 01          	add    $0x1,%rdi
+  8011bc:	0f b6 37             	movzbl (%rdi),%esi
+  8011bf:	40 80 fe 20          	cmp    $0x20,%sil
+  8011c3:	74 f3                	je     8011b8 <strtol+0x12>
+  8011c5:	40 80 fe 09          	cmp    $0x9,%sil
+  8011c9:	74 ed                	je     8011b8 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011cb:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011ce:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011d1:	3c 01                	cmp    $0x1,%al
+  8011d3:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011d7:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011dd:	75 0f                	jne    8011ee <strtol+0x48>
+  8011df:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011e2:	74 14                	je     8011f8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011e4:	85 d2                	test   %edx,%edx
+  8011e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011eb:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011ee:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011f3:	4c 63 ca             	movslq %edx,%r9
+  8011f6:	eb 36                	jmp    80122e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011f8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011fc:	74 0f                	je     80120d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011fe:	85 d2                	test   %edx,%edx
+  801200:	75 ec                	jne    8011ee <strtol+0x48>
+        s++;
+  801202:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801206:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80120b:	eb e1                	jmp    8011ee <strtol+0x48>
+        s += 2;
+  80120d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801211:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801216:	eb d6                	jmp    8011ee <strtol+0x48>
+            dig -= '0';
+  801218:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80121b:	44 0f b6 c1          	movzbl %cl,%r8d
+  80121f:	41 39 d0             	cmp    %edx,%r8d
+  801222:	7d 21                	jge    801245 <strtol+0x9f>
+        val = val * base + dig;
+  801224:	49 0f af c1          	imul   %r9,%rax
+  801228:	0f b6 c9             	movzbl %cl,%ecx
+  80122b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80122e:	48 83 c7 01          	add    $0x1,%rdi
+  801232:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801236:	80 f9 39             	cmp    $0x39,%cl
+  801239:	76 dd                	jbe    801218 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80123b:	80 f9 7b             	cmp    $0x7b,%cl
+  80123e:	77 05                	ja     801245 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801240:	83 e9 57             	sub    $0x57,%ecx
+  801243:	eb d6                	jmp    80121b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801245:	4d 85 d2             	test   %r10,%r10
+  801248:	74 03                	je     80124d <strtol+0xa7>
+  80124a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80124d:	48 89 c2             	mov    %rax,%rdx
+  801250:	48 f7 da             	neg    %rdx
+  801253:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801257:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80125b:	c3                   	ret
+
+000000000080125c <atoi>:
+int atoi(const char *str) {
+  80125c:	55                   	push   %rbp
+  80125d:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801260:	ba 00 00 00 00       	mov    $0x0,%edx
+  801265:	be 00 00 00 00       	mov    $0x0,%esi
+  80126a:	48 b8 a6 11 80 00 00 	movabs $0x8011a6,%rax
+  801271:	00 00 00 
+  801274:	ff d0                	call   *%rax
+}
+  801276:	5d                   	pop    %rbp
+  801277:	c3                   	ret
+
+0000000000801278 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801278:	55                   	push   %rbp
+  801279:	48 89 e5             	mov    %rsp,%rbp
+  80127c:	53                   	push   %rbx
+  80127d:	48 89 fa             	mov    %rdi,%rdx
+  801280:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801283:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801292:	be 00 00 00 00       	mov    $0x0,%esi
+  801297:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80129f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a3:	c9                   	leave
+  8012a4:	c3                   	ret
+
+00000000008012a5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012a5:	55                   	push   %rbp
+  8012a6:	48 89 e5             	mov    %rsp,%rbp
+  8012a9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012aa:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ce:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d4:	c9                   	leave
+  8012d5:	c3                   	ret
+
+00000000008012d6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012d6:	55                   	push   %rbp
+  8012d7:	48 89 e5             	mov    %rsp,%rbp
+  8012da:	53                   	push   %rbx
+  8012db:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801301:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801303:	48 85 c0             	test   %rax,%rax
+  801306:	7f 06                	jg     80130e <sys_env_destroy+0x38>
+}
+  801308:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130c:	c9                   	leave
+  80130d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80130e:	49 89 c0             	mov    %rax,%r8
+  801311:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801316:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  80131d:	00 00 00 
+  801320:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801325:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  80132c:	00 00 00 
+  80132f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801334:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  80133b:	00 00 00 
+  80133e:	41 ff d1             	call   *%r9
+
+0000000000801341 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801341:	55                   	push   %rbp
+  801342:	48 89 e5             	mov    %rsp,%rbp
+  801345:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801346:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80134b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801350:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801355:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80135f:	be 00 00 00 00       	mov    $0x0,%esi
+  801364:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80136a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80136c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801370:	c9                   	leave
+  801371:	c3                   	ret
+
+0000000000801372 <sys_yield>:
+
+void
+sys_yield(void) {
+  801372:	55                   	push   %rbp
+  801373:	48 89 e5             	mov    %rsp,%rbp
+  801376:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801377:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80137c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801381:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801386:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801390:	be 00 00 00 00       	mov    $0x0,%esi
+  801395:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80139d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a1:	c9                   	leave
+  8013a2:	c3                   	ret
+
+00000000008013a3 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013a3:	55                   	push   %rbp
+  8013a4:	48 89 e5             	mov    %rsp,%rbp
+  8013a7:	53                   	push   %rbx
+  8013a8:	48 89 fa             	mov    %rdi,%rdx
+  8013ab:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b3:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013ba:	00 00 00 
+  8013bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013cd:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d3:	c9                   	leave
+  8013d4:	c3                   	ret
+
+00000000008013d5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013d5:	55                   	push   %rbp
+  8013d6:	48 89 e5             	mov    %rsp,%rbp
+  8013d9:	53                   	push   %rbx
+  8013da:	49 89 f8             	mov    %rdi,%r8
+  8013dd:	48 89 d3             	mov    %rdx,%rbx
+  8013e0:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013e8:	4c 89 c2             	mov    %r8,%rdx
+  8013eb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ff:	c9                   	leave
+  801400:	c3                   	ret
+
+0000000000801401 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801401:	55                   	push   %rbp
+  801402:	48 89 e5             	mov    %rsp,%rbp
+  801405:	53                   	push   %rbx
+  801406:	48 83 ec 08          	sub    $0x8,%rsp
+  80140a:	89 f8                	mov    %edi,%eax
+  80140c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80140f:	48 63 f9             	movslq %ecx,%rdi
+  801412:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801415:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80141a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141d:	be 00 00 00 00       	mov    $0x0,%esi
+  801422:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801428:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142a:	48 85 c0             	test   %rax,%rax
+  80142d:	7f 06                	jg     801435 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80142f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801433:	c9                   	leave
+  801434:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801435:	49 89 c0             	mov    %rax,%r8
+  801438:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80143d:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801444:	00 00 00 
+  801447:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80144c:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801453:	00 00 00 
+  801456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145b:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  801462:	00 00 00 
+  801465:	41 ff d1             	call   *%r9
+
+0000000000801468 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801468:	55                   	push   %rbp
+  801469:	48 89 e5             	mov    %rsp,%rbp
+  80146c:	53                   	push   %rbx
+  80146d:	48 83 ec 08          	sub    $0x8,%rsp
+  801471:	89 f8                	mov    %edi,%eax
+  801473:	49 89 f2             	mov    %rsi,%r10
+  801476:	48 89 cf             	mov    %rcx,%rdi
+  801479:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80147c:	48 63 da             	movslq %edx,%rbx
+  80147f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801482:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801487:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80148d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80148f:	48 85 c0             	test   %rax,%rax
+  801492:	7f 06                	jg     80149a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801494:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801498:	c9                   	leave
+  801499:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80149a:	49 89 c0             	mov    %rax,%r8
+  80149d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014a2:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8014a9:	00 00 00 
+  8014ac:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014b1:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  8014b8:	00 00 00 
+  8014bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c0:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  8014c7:	00 00 00 
+  8014ca:	41 ff d1             	call   *%r9
+
+00000000008014cd <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014cd:	55                   	push   %rbp
+  8014ce:	48 89 e5             	mov    %rsp,%rbp
+  8014d1:	53                   	push   %rbx
+  8014d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d6:	49 89 f9             	mov    %rdi,%r9
+  8014d9:	89 f0                	mov    %esi,%eax
+  8014db:	48 89 d3             	mov    %rdx,%rbx
+  8014de:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8014e1:	49 63 f0             	movslq %r8d,%rsi
+  8014e4:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ec:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f7:	48 85 c0             	test   %rax,%rax
+  8014fa:	7f 06                	jg     801502 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801500:	c9                   	leave
+  801501:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801502:	49 89 c0             	mov    %rax,%r8
+  801505:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80150a:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801511:	00 00 00 
+  801514:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801519:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801520:	00 00 00 
+  801523:	b8 00 00 00 00       	mov    $0x0,%eax
+  801528:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  80152f:	00 00 00 
+  801532:	41 ff d1             	call   *%r9
+
+0000000000801535 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801535:	55                   	push   %rbp
+  801536:	48 89 e5             	mov    %rsp,%rbp
+  801539:	53                   	push   %rbx
+  80153a:	89 f8                	mov    %edi,%eax
+  80153c:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80153f:	48 63 f9             	movslq %ecx,%rdi
+  801542:	48 63 da             	movslq %edx,%rbx
+  801545:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801548:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80154d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801550:	be 00 00 00 00       	mov    $0x0,%esi
+  801555:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155b:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80155d:	89 c2                	mov    %eax,%edx
+  80155f:	48 85 c0             	test   %rax,%rax
+  801562:	78 0d                	js     801571 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801564:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801569:	4d 85 c9             	test   %r9,%r9
+  80156c:	74 03                	je     801571 <sys_alloc_dma_region+0x3c>
+  80156e:	49 89 01             	mov    %rax,(%r9)
+}
+  801571:	89 d0                	mov    %edx,%eax
+  801573:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801577:	c9                   	leave
+  801578:	c3                   	ret
+
+0000000000801579 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801579:	55                   	push   %rbp
+  80157a:	48 89 e5             	mov    %rsp,%rbp
+  80157d:	53                   	push   %rbx
+  80157e:	48 83 ec 08          	sub    $0x8,%rsp
+  801582:	48 89 f1             	mov    %rsi,%rcx
+  801585:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801588:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158b:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801590:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801595:	be 00 00 00 00       	mov    $0x0,%esi
+  80159a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a2:	48 85 c0             	test   %rax,%rax
+  8015a5:	7f 06                	jg     8015ad <sys_set_cache_region+0x34>
+}
+  8015a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ab:	c9                   	leave
+  8015ac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ad:	49 89 c0             	mov    %rax,%r8
+  8015b0:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8015b5:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8015bc:	00 00 00 
+  8015bf:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015c4:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  8015cb:	00 00 00 
+  8015ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d3:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  8015da:	00 00 00 
+  8015dd:	41 ff d1             	call   *%r9
+
+00000000008015e0 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015e0:	55                   	push   %rbp
+  8015e1:	48 89 e5             	mov    %rsp,%rbp
+  8015e4:	53                   	push   %rbx
+  8015e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e9:	48 89 f1             	mov    %rsi,%rcx
+  8015ec:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015ef:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801601:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801607:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801609:	48 85 c0             	test   %rax,%rax
+  80160c:	7f 06                	jg     801614 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80160e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801612:	c9                   	leave
+  801613:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801614:	49 89 c0             	mov    %rax,%r8
+  801617:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80161c:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801623:	00 00 00 
+  801626:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80162b:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801632:	00 00 00 
+  801635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163a:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  801641:	00 00 00 
+  801644:	41 ff d1             	call   *%r9
+
+0000000000801647 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801647:	55                   	push   %rbp
+  801648:	48 89 e5             	mov    %rsp,%rbp
+  80164b:	53                   	push   %rbx
+  80164c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801650:	48 63 ce             	movslq %esi,%rcx
+  801653:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801656:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801660:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801665:	be 00 00 00 00       	mov    $0x0,%esi
+  80166a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801670:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801672:	48 85 c0             	test   %rax,%rax
+  801675:	7f 06                	jg     80167d <sys_env_set_status+0x36>
+}
+  801677:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167b:	c9                   	leave
+  80167c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167d:	49 89 c0             	mov    %rax,%r8
+  801680:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801685:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  80168c:	00 00 00 
+  80168f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801694:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  80169b:	00 00 00 
+  80169e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a3:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  8016aa:	00 00 00 
+  8016ad:	41 ff d1             	call   *%r9
+
+00000000008016b0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016b0:	55                   	push   %rbp
+  8016b1:	48 89 e5             	mov    %rsp,%rbp
+  8016b4:	53                   	push   %rbx
+  8016b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016bf:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016db:	48 85 c0             	test   %rax,%rax
+  8016de:	7f 06                	jg     8016e6 <sys_env_set_trapframe+0x36>
+}
+  8016e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e6:	49 89 c0             	mov    %rax,%r8
+  8016e9:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8016ee:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8016f5:	00 00 00 
+  8016f8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016fd:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801704:	00 00 00 
+  801707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170c:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  801713:	00 00 00 
+  801716:	41 ff d1             	call   *%r9
+
+0000000000801719 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801719:	55                   	push   %rbp
+  80171a:	48 89 e5             	mov    %rsp,%rbp
+  80171d:	53                   	push   %rbx
+  80171e:	48 83 ec 08          	sub    $0x8,%rsp
+  801722:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801725:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801728:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80172d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801732:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801737:	be 00 00 00 00       	mov    $0x0,%esi
+  80173c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801742:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801744:	48 85 c0             	test   %rax,%rax
+  801747:	7f 06                	jg     80174f <sys_env_set_pgfault_upcall+0x36>
+}
+  801749:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174d:	c9                   	leave
+  80174e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80174f:	49 89 c0             	mov    %rax,%r8
+  801752:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801757:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  80175e:	00 00 00 
+  801761:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801766:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  80176d:	00 00 00 
+  801770:	b8 00 00 00 00       	mov    $0x0,%eax
+  801775:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  80177c:	00 00 00 
+  80177f:	41 ff d1             	call   *%r9
+
+0000000000801782 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801782:	55                   	push   %rbp
+  801783:	48 89 e5             	mov    %rsp,%rbp
+  801786:	53                   	push   %rbx
+  801787:	89 f8                	mov    %edi,%eax
+  801789:	49 89 f1             	mov    %rsi,%r9
+  80178c:	48 89 d3             	mov    %rdx,%rbx
+  80178f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801792:	49 63 f0             	movslq %r8d,%rsi
+  801795:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801798:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80179d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a6:	cd 30                	int    $0x30
+}
+  8017a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ac:	c9                   	leave
+  8017ad:	c3                   	ret
+
+00000000008017ae <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017ae:	55                   	push   %rbp
+  8017af:	48 89 e5             	mov    %rsp,%rbp
+  8017b2:	53                   	push   %rbx
+  8017b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8017b7:	48 89 fa             	mov    %rdi,%rdx
+  8017ba:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017bd:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017d9:	48 85 c0             	test   %rax,%rax
+  8017dc:	7f 06                	jg     8017e4 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e2:	c9                   	leave
+  8017e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017e4:	49 89 c0             	mov    %rax,%r8
+  8017e7:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8017ec:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8017f3:	00 00 00 
+  8017f6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017fb:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801802:	00 00 00 
+  801805:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180a:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  801811:	00 00 00 
+  801814:	41 ff d1             	call   *%r9
+
+0000000000801817 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801817:	55                   	push   %rbp
+  801818:	48 89 e5             	mov    %rsp,%rbp
+  80181b:	53                   	push   %rbx
+  80181c:	48 89 fa             	mov    %rdi,%rdx
+  80181f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801822:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801827:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801831:	be 00 00 00 00       	mov    $0x0,%esi
+  801836:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80183c:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80183e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801842:	c9                   	leave
+  801843:	c3                   	ret
+
+0000000000801844 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801844:	55                   	push   %rbp
+  801845:	48 89 e5             	mov    %rsp,%rbp
+  801848:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801849:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80184e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801853:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801858:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801862:	be 00 00 00 00       	mov    $0x0,%esi
+  801867:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80186d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80186f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801873:	c9                   	leave
+  801874:	c3                   	ret
+
+0000000000801875 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801875:	48 85 ff             	test   %rdi,%rdi
+  801878:	0f 84 b6 01 00 00    	je     801a34 <malloc+0x1bf>
+malloc(size_t size) {
+  80187e:	55                   	push   %rbp
+  80187f:	48 89 e5             	mov    %rsp,%rbp
+  801882:	41 56                	push   %r14
+  801884:	41 55                	push   %r13
+  801886:	41 54                	push   %r12
+  801888:	53                   	push   %rbx
+  801889:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80188c:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801893:	00 00 00 
+  801896:	4c 8b 20             	mov    (%rax),%r12
+  801899:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  8018a0:	0f 87 94 01 00 00    	ja     801a3a <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  8018a6:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8018ad:	00 00 00 
+  8018b0:	48 85 c0             	test   %rax,%rax
+  8018b3:	74 6b                	je     801920 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  8018b5:	4d 85 e4             	test   %r12,%r12
+  8018b8:	74 66                	je     801920 <malloc+0xab>
+  8018ba:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  8018c1:	00 00 00 
+  8018c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c9:	eb 0d                	jmp    8018d8 <malloc+0x63>
+  8018cb:	48 83 c1 01          	add    $0x1,%rcx
+  8018cf:	48 83 c2 18          	add    $0x18,%rdx
+  8018d3:	49 39 cc             	cmp    %rcx,%r12
+  8018d6:	74 48                	je     801920 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  8018d8:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  8018dd:	74 ec                	je     8018cb <malloc+0x56>
+  8018df:	48 39 1a             	cmp    %rbx,(%rdx)
+  8018e2:	72 e7                	jb     8018cb <malloc+0x56>
+                real_freep_size--;
+  8018e4:	48 83 e8 01          	sub    $0x1,%rax
+  8018e8:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  8018ef:	00 00 00 
+                freep[i].is_free = false;
+  8018f2:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8018f9:	00 00 00 
+  8018fc:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801900:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801904:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801908:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  80190f:	00 
+                freep[i].size = size;
+  801910:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801914:	48 01 c8             	add    %rcx,%rax
+  801917:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80191b:	e9 0b 01 00 00       	jmp    801a2b <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801920:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801927:	00 00 00 
+  80192a:	48 01 d8             	add    %rbx,%rax
+  80192d:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801933:	76 7c                	jbe    8019b1 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801935:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  80193c:	00 00 00 
+  80193f:	4c 8b 30             	mov    (%rax),%r14
+  801942:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801949:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  80194c:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801953:	00 00 00 
+  801956:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  80195d:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801964:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80196a:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80196e:	48 b8 41 13 80 00 00 	movabs $0x801341,%rax
+  801975:	00 00 00 
+  801978:	ff d0                	call   *%rax
+  80197a:	89 c7                	mov    %eax,%edi
+  80197c:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801983:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80198a:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801991:	00 00 00 
+  801994:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801998:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80199d:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  8019a4:	00 00 00 
+  8019a7:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  8019a9:	85 c0                	test   %eax,%eax
+  8019ab:	0f 88 90 00 00 00    	js     801a41 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  8019b1:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  8019b8:	00 00 00 
+  8019bb:	48 8b 31             	mov    (%rcx),%rsi
+  8019be:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  8019c5:	00 00 00 
+  8019c8:	4c 8b 07             	mov    (%rdi),%r8
+  8019cb:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  8019cf:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  8019d6:	00 00 00 
+  8019d9:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  8019dd:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  8019e1:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8019e8:	00 00 00 
+  8019eb:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  8019ef:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  8019f2:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8019f6:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8019fd:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8019fe:	48 89 d8             	mov    %rbx,%rax
+  801a01:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a06:	4c 01 c0             	add    %r8,%rax
+  801a09:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801a0c:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801a13:	48 01 f3             	add    %rsi,%rbx
+  801a16:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801a19:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801a1e:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801a25:	00 00 00 
+  801a28:	48 89 d0             	mov    %rdx,%rax
+}
+  801a2b:	5b                   	pop    %rbx
+  801a2c:	41 5c                	pop    %r12
+  801a2e:	41 5d                	pop    %r13
+  801a30:	41 5e                	pop    %r14
+  801a32:	5d                   	pop    %rbp
+  801a33:	c3                   	ret
+        return NULL;
+  801a34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a39:	c3                   	ret
+        return NULL;
+  801a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3f:	eb ea                	jmp    801a2b <malloc+0x1b6>
+            return NULL;
+  801a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a46:	eb e3                	jmp    801a2b <malloc+0x1b6>
+
+0000000000801a48 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801a48:	55                   	push   %rbp
+  801a49:	48 89 e5             	mov    %rsp,%rbp
+  801a4c:	53                   	push   %rbx
+  801a4d:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801a51:	48 89 fb             	mov    %rdi,%rbx
+  801a54:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801a58:	48 89 df             	mov    %rbx,%rdi
+  801a5b:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801a62:	00 00 00 
+  801a65:	ff d0                	call   *%rax
+  801a67:	48 89 c7             	mov    %rax,%rdi
+  801a6a:	48 89 da             	mov    %rbx,%rdx
+  801a6d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a72:	48 b8 81 0f 80 00 00 	movabs $0x800f81,%rax
+  801a79:	00 00 00 
+  801a7c:	ff d0                	call   *%rax
+}
+  801a7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a82:	c9                   	leave
+  801a83:	c3                   	ret
+
+0000000000801a84 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801a84:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801a8b:	00 00 00 
+  801a8e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801a95:	00 00 00 
+  801a98:	48 3b 02             	cmp    (%rdx),%rax
+  801a9b:	74 4d                	je     801aea <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801a9d:	48 85 c0             	test   %rax,%rax
+  801aa0:	74 4d                	je     801aef <get_allocsize+0x6b>
+  801aa2:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801aa9:	00 00 00 
+  801aac:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801ab1:	48 3b 39             	cmp    (%rcx),%rdi
+  801ab4:	74 13                	je     801ac9 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801ab6:	48 83 c2 01          	add    $0x1,%rdx
+  801aba:	48 83 c1 18          	add    $0x18,%rcx
+  801abe:	48 39 d0             	cmp    %rdx,%rax
+  801ac1:	75 ee                	jne    801ab1 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac8:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801ac9:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad2:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801ad9:	00 00 00 
+  801adc:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801ae2:	75 0b                	jne    801aef <get_allocsize+0x6b>
+  801ae4:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801ae9:	c3                   	ret
+        return 0;
+  801aea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aef:	c3                   	ret
+
+0000000000801af0 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801af0:	48 85 ff             	test   %rdi,%rdi
+  801af3:	0f 84 01 01 00 00    	je     801bfa <free+0x10a>
+free(void *ptr) {
+  801af9:	55                   	push   %rbp
+  801afa:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801afd:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801b04:	00 00 00 
+  801b07:	48 8b 30             	mov    (%rax),%rsi
+  801b0a:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801b11:	00 00 00 
+  801b14:	48 39 c6             	cmp    %rax,%rsi
+  801b17:	74 50                	je     801b69 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801b19:	48 85 f6             	test   %rsi,%rsi
+  801b1c:	74 21                	je     801b3f <free+0x4f>
+  801b1e:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801b25:	00 00 00 
+  801b28:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801b2d:	48 3b 39             	cmp    (%rcx),%rdi
+  801b30:	74 61                	je     801b93 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801b32:	48 83 c2 01          	add    $0x1,%rdx
+  801b36:	48 83 c1 18          	add    $0x18,%rcx
+  801b3a:	48 39 d6             	cmp    %rdx,%rsi
+  801b3d:	75 ee                	jne    801b2d <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801b3f:	48 ba 30 56 80 00 00 	movabs $0x805630,%rdx
+  801b46:	00 00 00 
+  801b49:	be 12 01 00 00       	mov    $0x112,%esi
+  801b4e:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801b55:	00 00 00 
+  801b58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5d:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  801b64:	00 00 00 
+  801b67:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801b69:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  801b70:	00 00 00 
+  801b73:	be 06 01 00 00       	mov    $0x106,%esi
+  801b78:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801b7f:	00 00 00 
+  801b82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b87:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  801b8e:	00 00 00 
+  801b91:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801b93:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b97:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801b9e:	00 00 00 
+  801ba1:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801ba7:	75 27                	jne    801bd0 <free+0xe0>
+            freep[i].is_free = true;
+  801ba9:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801bad:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801bb4:	00 00 00 
+  801bb7:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801bbe:	00 00 
+            real_freep_size++;
+  801bc0:	48 83 c0 01          	add    $0x1,%rax
+  801bc4:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801bcb:	00 00 00 
+}
+  801bce:	5d                   	pop    %rbp
+  801bcf:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801bd0:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  801bd7:	00 00 00 
+  801bda:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801bdf:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801be6:	00 00 00 
+  801be9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bee:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  801bf5:	00 00 00 
+  801bf8:	ff d1                	call   *%rcx
+  801bfa:	c3                   	ret
+
+0000000000801bfb <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801bfb:	55                   	push   %rbp
+  801bfc:	48 89 e5             	mov    %rsp,%rbp
+  801bff:	41 55                	push   %r13
+  801c01:	41 54                	push   %r12
+  801c03:	53                   	push   %rbx
+  801c04:	48 83 ec 08          	sub    $0x8,%rsp
+  801c08:	48 89 fb             	mov    %rdi,%rbx
+  801c0b:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801c0e:	48 b8 84 1a 80 00 00 	movabs $0x801a84,%rax
+  801c15:	00 00 00 
+  801c18:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801c1a:	49 39 c5             	cmp    %rax,%r13
+  801c1d:	73 0e                	jae    801c2d <realloc+0x32>
+}
+  801c1f:	48 89 d8             	mov    %rbx,%rax
+  801c22:	48 83 c4 08          	add    $0x8,%rsp
+  801c26:	5b                   	pop    %rbx
+  801c27:	41 5c                	pop    %r12
+  801c29:	41 5d                	pop    %r13
+  801c2b:	5d                   	pop    %rbp
+  801c2c:	c3                   	ret
+  801c2d:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801c30:	4c 89 ef             	mov    %r13,%rdi
+  801c33:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801c3a:	00 00 00 
+  801c3d:	ff d0                	call   *%rax
+  801c3f:	48 89 c7             	mov    %rax,%rdi
+  801c42:	4c 89 e2             	mov    %r12,%rdx
+  801c45:	48 89 de             	mov    %rbx,%rsi
+  801c48:	48 b8 96 10 80 00 00 	movabs $0x801096,%rax
+  801c4f:	00 00 00 
+  801c52:	ff d0                	call   *%rax
+  801c54:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801c57:	48 89 df             	mov    %rbx,%rdi
+  801c5a:	48 b8 f0 1a 80 00 00 	movabs $0x801af0,%rax
+  801c61:	00 00 00 
+  801c64:	ff d0                	call   *%rax
+    return newptr;
+  801c66:	4c 89 e3             	mov    %r12,%rbx
+  801c69:	eb b4                	jmp    801c1f <realloc+0x24>
+
+0000000000801c6b <strdup>:
+
+char*
+strdup (const char *src) {
+  801c6b:	55                   	push   %rbp
+  801c6c:	48 89 e5             	mov    %rsp,%rbp
+  801c6f:	41 54                	push   %r12
+  801c71:	53                   	push   %rbx
+  801c72:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801c75:	48 b8 63 0c 80 00 00 	movabs $0x800c63,%rax
+  801c7c:	00 00 00 
+  801c7f:	ff d0                	call   *%rax
+  801c81:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801c85:	4c 89 e7             	mov    %r12,%rdi
+  801c88:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801c8f:	00 00 00 
+  801c92:	ff d0                	call   *%rax
+  801c94:	48 89 c7             	mov    %rax,%rdi
+  801c97:	4c 89 e2             	mov    %r12,%rdx
+  801c9a:	48 89 de             	mov    %rbx,%rsi
+  801c9d:	48 b8 96 10 80 00 00 	movabs $0x801096,%rax
+  801ca4:	00 00 00 
+  801ca7:	ff d0                	call   *%rax
+}
+  801ca9:	5b                   	pop    %rbx
+  801caa:	41 5c                	pop    %r12
+  801cac:	5d                   	pop    %rbp
+  801cad:	c3                   	ret
+
+0000000000801cae <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801cae:	55                   	push   %rbp
+  801caf:	48 89 e5             	mov    %rsp,%rbp
+  801cb2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cb3:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cc7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ccc:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cd7:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801cd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cdd:	c9                   	leave
+  801cde:	c3                   	ret
+
+0000000000801cdf <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801cdf:	55                   	push   %rbp
+  801ce0:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801ce3:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801cea:	00 00 00 
+  801ced:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801cf1:	74 26                	je     801d19 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801cf3:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801cf5:	48 c1 e2 20          	shl    $0x20,%rdx
+  801cf9:	89 c0                	mov    %eax,%eax
+  801cfb:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801cfe:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801d05:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801d0c:	00 00 00 
+  801d0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d14:	48 f7 31             	divq   (%rcx)
+}
+  801d17:	5d                   	pop    %rbp
+  801d18:	c3                   	ret
+        freq = get_cpufreq();
+  801d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1e:	48 ba ae 1c 80 00 00 	movabs $0x801cae,%rdx
+  801d25:	00 00 00 
+  801d28:	ff d2                	call   *%rdx
+  801d2a:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801d31:	00 00 00 
+  801d34:	eb bd                	jmp    801cf3 <get_ticks+0x14>
+
+0000000000801d36 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801d36:	55                   	push   %rbp
+  801d37:	48 89 e5             	mov    %rsp,%rbp
+  801d3a:	53                   	push   %rbx
+  801d3b:	48 83 ec 08          	sub    $0x8,%rsp
+  801d3f:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801d42:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d49:	00 00 00 
+  801d4c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d50:	74 50                	je     801da2 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801d52:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d54:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d58:	89 c0                	mov    %eax,%eax
+  801d5a:	48 89 d6             	mov    %rdx,%rsi
+  801d5d:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801d60:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d67:	00 00 00 
+  801d6a:	48 0f af 18          	imul   (%rax),%rbx
+  801d6e:	48 c1 eb 03          	shr    $0x3,%rbx
+  801d72:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801d79:	9b c4 20 
+  801d7c:	48 89 d8             	mov    %rbx,%rax
+  801d7f:	48 f7 e2             	mul    %rdx
+  801d82:	48 89 d1             	mov    %rdx,%rcx
+  801d85:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801d89:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d8b:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d8f:	89 c0                	mov    %eax,%eax
+  801d91:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801d94:	48 29 f2             	sub    %rsi,%rdx
+  801d97:	48 39 ca             	cmp    %rcx,%rdx
+  801d9a:	72 ed                	jb     801d89 <sleep+0x53>
+}
+  801d9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801da0:	c9                   	leave
+  801da1:	c3                   	ret
+        freq = get_cpufreq();
+  801da2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da7:	48 ba ae 1c 80 00 00 	movabs $0x801cae,%rdx
+  801dae:	00 00 00 
+  801db1:	ff d2                	call   *%rdx
+  801db3:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801dba:	00 00 00 
+  801dbd:	eb 93                	jmp    801d52 <sleep+0x1c>
+
+0000000000801dbf <poll_kbd>:
+
+int poll_kbd() {
+  801dbf:	55                   	push   %rbp
+  801dc0:	48 89 e5             	mov    %rsp,%rbp
+  801dc3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801dc4:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dce:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801dd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ddd:	be 00 00 00 00       	mov    $0x0,%esi
+  801de2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801de8:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801dea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dee:	c9                   	leave
+  801def:	c3                   	ret
+
+0000000000801df0 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801df0:	55                   	push   %rbp
+  801df1:	48 89 e5             	mov    %rsp,%rbp
+  801df4:	53                   	push   %rbx
+  801df5:	49 89 fa             	mov    %rdi,%r10
+  801df8:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801dfa:	44 89 c6             	mov    %r8d,%esi
+  801dfd:	89 cf                	mov    %ecx,%edi
+  801dff:	89 d3                	mov    %edx,%ebx
+  801e01:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801e03:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e08:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e0b:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801e0f:	cd 30                	int    $0x30
+  801e11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e15:	c9                   	leave
+  801e16:	c3                   	ret
+
+0000000000801e17 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  801e17:	55                   	push   %rbp
+  801e18:	48 89 e5             	mov    %rsp,%rbp
+  801e1b:	41 56                	push   %r14
+  801e1d:	41 55                	push   %r13
+  801e1f:	41 54                	push   %r12
+  801e21:	53                   	push   %rbx
+  801e22:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801e25:	48 b8 a8 70 98 00 00 	movabs $0x9870a8,%rax
+  801e2c:	00 00 00 
+  801e2f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801e33:	74 27                	je     801e5c <_handle_vectored_pagefault+0x45>
+  801e35:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  801e3a:	49 bd 60 70 98 00 00 	movabs $0x987060,%r13
+  801e41:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801e44:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  801e47:	4c 89 e7             	mov    %r12,%rdi
+  801e4a:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  801e4f:	84 c0                	test   %al,%al
+  801e51:	75 45                	jne    801e98 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801e53:	48 83 c3 01          	add    $0x1,%rbx
+  801e57:	49 3b 1e             	cmp    (%r14),%rbx
+  801e5a:	72 eb                	jb     801e47 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  801e5c:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  801e63:	00 
+  801e64:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  801e69:	4d 8b 04 24          	mov    (%r12),%r8
+  801e6d:	48 ba 68 56 80 00 00 	movabs $0x805668,%rdx
+  801e74:	00 00 00 
+  801e77:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801e7c:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801e83:	00 00 00 
+  801e86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8b:	49 ba d9 01 80 00 00 	movabs $0x8001d9,%r10
+  801e92:	00 00 00 
+  801e95:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801e98:	5b                   	pop    %rbx
+  801e99:	41 5c                	pop    %r12
+  801e9b:	41 5d                	pop    %r13
+  801e9d:	41 5e                	pop    %r14
+  801e9f:	5d                   	pop    %rbp
+  801ea0:	c3                   	ret
+
+0000000000801ea1 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  801ea1:	55                   	push   %rbp
+  801ea2:	48 89 e5             	mov    %rsp,%rbp
+  801ea5:	41 54                	push   %r12
+  801ea7:	53                   	push   %rbx
+  801ea8:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801eab:	48 b8 a0 70 98 00 00 	movabs $0x9870a0,%rax
+  801eb2:	00 00 00 
+  801eb5:	80 38 00             	cmpb   $0x0,(%rax)
+  801eb8:	74 64                	je     801f1e <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801eba:	48 b8 a8 70 98 00 00 	movabs $0x9870a8,%rax
+  801ec1:	00 00 00 
+  801ec4:	48 8b 10             	mov    (%rax),%rdx
+  801ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  801ecc:	48 b9 60 70 98 00 00 	movabs $0x987060,%rcx
+  801ed3:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801ed6:	48 85 d2             	test   %rdx,%rdx
+  801ed9:	74 1d                	je     801ef8 <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801edb:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  801edf:	0f 84 ee 00 00 00    	je     801fd3 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801ee5:	48 83 c0 01          	add    $0x1,%rax
+  801ee9:	48 39 d0             	cmp    %rdx,%rax
+  801eec:	75 ed                	jne    801edb <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  801eee:	48 83 fa 08          	cmp    $0x8,%rdx
+  801ef2:	0f 84 a9 00 00 00    	je     801fa1 <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801ef8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801efc:	48 a3 a8 70 98 00 00 	movabs %rax,0x9870a8
+  801f03:	00 00 00 
+  801f06:	48 b8 60 70 98 00 00 	movabs $0x987060,%rax
+  801f0d:	00 00 00 
+  801f10:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  801f19:	5b                   	pop    %rbx
+  801f1a:	41 5c                	pop    %r12
+  801f1c:	5d                   	pop    %rbp
+  801f1d:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  801f1e:	49 bc 41 13 80 00 00 	movabs $0x801341,%r12
+  801f25:	00 00 00 
+  801f28:	41 ff d4             	call   *%r12
+  801f2b:	89 c7                	mov    %eax,%edi
+  801f2d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801f32:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f37:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  801f3e:	00 00 00 
+  801f41:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  801f48:	00 00 00 
+  801f4b:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801f4d:	48 ba a8 70 98 00 00 	movabs $0x9870a8,%rdx
+  801f54:	00 00 00 
+  801f57:	48 8b 02             	mov    (%rdx),%rax
+  801f5a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801f5e:	48 89 0a             	mov    %rcx,(%rdx)
+  801f61:	48 ba 60 70 98 00 00 	movabs $0x987060,%rdx
+  801f68:	00 00 00 
+  801f6b:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  801f6f:	48 b8 a0 70 98 00 00 	movabs $0x9870a0,%rax
+  801f76:	00 00 00 
+  801f79:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  801f7c:	41 ff d4             	call   *%r12
+  801f7f:	89 c7                	mov    %eax,%edi
+  801f81:	48 be 99 20 80 00 00 	movabs $0x802099,%rsi
+  801f88:	00 00 00 
+  801f8b:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801f92:	00 00 00 
+  801f95:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801f97:	85 c0                	test   %eax,%eax
+  801f99:	0f 89 7a ff ff ff    	jns    801f19 <add_pgfault_handler+0x78>
+  801f9f:	eb 05                	jmp    801fa6 <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  801fa1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801fa6:	89 c1                	mov    %eax,%ecx
+  801fa8:	48 ba a6 56 80 00 00 	movabs $0x8056a6,%rdx
+  801faf:	00 00 00 
+  801fb2:	be 3b 00 00 00       	mov    $0x3b,%esi
+  801fb7:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801fbe:	00 00 00 
+  801fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc6:	49 b8 d9 01 80 00 00 	movabs $0x8001d9,%r8
+  801fcd:	00 00 00 
+  801fd0:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  801fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd8:	e9 3c ff ff ff       	jmp    801f19 <add_pgfault_handler+0x78>
+
+0000000000801fdd <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801fdd:	55                   	push   %rbp
+  801fde:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  801fe1:	48 b8 a0 70 98 00 00 	movabs $0x9870a0,%rax
+  801fe8:	00 00 00 
+  801feb:	80 38 00             	cmpb   $0x0,(%rax)
+  801fee:	74 33                	je     802023 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801ff0:	48 a1 a8 70 98 00 00 	movabs 0x9870a8,%rax
+  801ff7:	00 00 00 
+  801ffa:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  801fff:	48 ba 60 70 98 00 00 	movabs $0x987060,%rdx
+  802006:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802009:	48 85 c0             	test   %rax,%rax
+  80200c:	0f 84 85 00 00 00    	je     802097 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  802012:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  802016:	74 40                	je     802058 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802018:	48 83 c1 01          	add    $0x1,%rcx
+  80201c:	48 39 c1             	cmp    %rax,%rcx
+  80201f:	75 f1                	jne    802012 <remove_pgfault_handler+0x35>
+  802021:	eb 74                	jmp    802097 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  802023:	48 b9 be 56 80 00 00 	movabs $0x8056be,%rcx
+  80202a:	00 00 00 
+  80202d:	48 ba d8 56 80 00 00 	movabs $0x8056d8,%rdx
+  802034:	00 00 00 
+  802037:	be 41 00 00 00       	mov    $0x41,%esi
+  80203c:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  802043:	00 00 00 
+  802046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204b:	49 b8 d9 01 80 00 00 	movabs $0x8001d9,%r8
+  802052:	00 00 00 
+  802055:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  802058:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80205f:	00 
+  802060:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802064:	48 29 ca             	sub    %rcx,%rdx
+  802067:	48 b8 60 70 98 00 00 	movabs $0x987060,%rax
+  80206e:	00 00 00 
+  802071:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  802075:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80207a:	48 89 ce             	mov    %rcx,%rsi
+  80207d:	48 b8 2f 10 80 00 00 	movabs $0x80102f,%rax
+  802084:	00 00 00 
+  802087:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  802089:	48 b8 a8 70 98 00 00 	movabs $0x9870a8,%rax
+  802090:	00 00 00 
+  802093:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  802097:	5d                   	pop    %rbp
+  802098:	c3                   	ret
+
+0000000000802099 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  802099:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80209c:	48 b8 17 1e 80 00 00 	movabs $0x801e17,%rax
+  8020a3:	00 00 00 
+    call *%rax
+  8020a6:	ff d0                	call   *%rax
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    popq %r15
+  8020a8:	41 5f                	pop    %r15
+    popq %r15
+  8020aa:	41 5f                	pop    %r15
+    popq %r15
+  8020ac:	41 5f                	pop    %r15
+    popq %r14
+  8020ae:	41 5e                	pop    %r14
+    popq %r13
+  8020b0:	41 5d                	pop    %r13
+    popq %r12
+  8020b2:	41 5c                	pop    %r12
+    popq %r11
+  8020b4:	41 5b                	pop    %r11
+    popq %r10
+  8020b6:	41 5a                	pop    %r10
+    popq %r9
+  8020b8:	41 59                	pop    %r9
+    popq %r8
+  8020ba:	41 58                	pop    %r8
+    popq %rsi
+  8020bc:	5e                   	pop    %rsi
+    popq %rdi
+  8020bd:	5f                   	pop    %rdi
+    popq %rbp
+  8020be:	5d                   	pop    %rbp
+    popq %rdx
+  8020bf:	5a                   	pop    %rdx
+    popq %rcx
+  8020c0:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  8020c1:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  8020c6:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  8020cb:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  8020cf:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  8020d2:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  8020d7:	5b                   	pop    %rbx
+    popq %rax
+  8020d8:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    pushq 8(%rsp)
+  8020d9:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  8020dd:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    movq 16(%rsp), %rsp
+  8020de:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8020e3:	c3                   	ret
+
+00000000008020e4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020e4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8020eb:	ff ff ff 
+  8020ee:	48 01 f8             	add    %rdi,%rax
+  8020f1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8020f5:	c3                   	ret
+
+00000000008020f6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020f6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8020fd:	ff ff ff 
+  802100:	48 01 f8             	add    %rdi,%rax
+  802103:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802107:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80210d:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802111:	c3                   	ret
+
+0000000000802112 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802112:	55                   	push   %rbp
+  802113:	48 89 e5             	mov    %rsp,%rbp
+  802116:	41 57                	push   %r15
+  802118:	41 56                	push   %r14
+  80211a:	41 55                	push   %r13
+  80211c:	41 54                	push   %r12
+  80211e:	53                   	push   %rbx
+  80211f:	48 83 ec 08          	sub    $0x8,%rsp
+  802123:	49 89 ff             	mov    %rdi,%r15
+  802126:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80212b:	49 bd c6 3f 80 00 00 	movabs $0x803fc6,%r13
+  802132:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802135:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80213b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80213e:	48 89 df             	mov    %rbx,%rdi
+  802141:	41 ff d5             	call   *%r13
+  802144:	83 e0 04             	and    $0x4,%eax
+  802147:	74 17                	je     802160 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802149:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802150:	4c 39 f3             	cmp    %r14,%rbx
+  802153:	75 e6                	jne    80213b <fd_alloc+0x29>
+  802155:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80215b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802160:	4d 89 27             	mov    %r12,(%r15)
+}
+  802163:	48 83 c4 08          	add    $0x8,%rsp
+  802167:	5b                   	pop    %rbx
+  802168:	41 5c                	pop    %r12
+  80216a:	41 5d                	pop    %r13
+  80216c:	41 5e                	pop    %r14
+  80216e:	41 5f                	pop    %r15
+  802170:	5d                   	pop    %rbp
+  802171:	c3                   	ret
+
+0000000000802172 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802172:	83 ff 1f             	cmp    $0x1f,%edi
+  802175:	77 39                	ja     8021b0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802177:	55                   	push   %rbp
+  802178:	48 89 e5             	mov    %rsp,%rbp
+  80217b:	41 54                	push   %r12
+  80217d:	53                   	push   %rbx
+  80217e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802181:	48 63 df             	movslq %edi,%rbx
+  802184:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80218b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80218f:	48 89 df             	mov    %rbx,%rdi
+  802192:	48 b8 c6 3f 80 00 00 	movabs $0x803fc6,%rax
+  802199:	00 00 00 
+  80219c:	ff d0                	call   *%rax
+  80219e:	a8 04                	test   $0x4,%al
+  8021a0:	74 14                	je     8021b6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8021a2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8021a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ab:	5b                   	pop    %rbx
+  8021ac:	41 5c                	pop    %r12
+  8021ae:	5d                   	pop    %rbp
+  8021af:	c3                   	ret
+        return -E_INVAL;
+  8021b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8021b5:	c3                   	ret
+        return -E_INVAL;
+  8021b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021bb:	eb ee                	jmp    8021ab <fd_lookup+0x39>
+
+00000000008021bd <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+  8021c1:	41 54                	push   %r12
+  8021c3:	53                   	push   %rbx
+  8021c4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8021c7:	48 b8 80 57 80 00 00 	movabs $0x805780,%rax
+  8021ce:	00 00 00 
+  8021d1:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8021d8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8021db:	39 3b                	cmp    %edi,(%rbx)
+  8021dd:	74 47                	je     802226 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8021df:	48 83 c0 08          	add    $0x8,%rax
+  8021e3:	48 8b 18             	mov    (%rax),%rbx
+  8021e6:	48 85 db             	test   %rbx,%rbx
+  8021e9:	75 f0                	jne    8021db <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8021eb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021f2:	00 00 00 
+  8021f5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021fb:	89 fa                	mov    %edi,%edx
+  8021fd:	48 bf f0 56 80 00 00 	movabs $0x8056f0,%rdi
+  802204:	00 00 00 
+  802207:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220c:	48 b9 29 03 80 00 00 	movabs $0x800329,%rcx
+  802213:	00 00 00 
+  802216:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802218:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80221d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802221:	5b                   	pop    %rbx
+  802222:	41 5c                	pop    %r12
+  802224:	5d                   	pop    %rbp
+  802225:	c3                   	ret
+            return 0;
+  802226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222b:	eb f0                	jmp    80221d <dev_lookup+0x60>
+
+000000000080222d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80222d:	55                   	push   %rbp
+  80222e:	48 89 e5             	mov    %rsp,%rbp
+  802231:	41 55                	push   %r13
+  802233:	41 54                	push   %r12
+  802235:	53                   	push   %rbx
+  802236:	48 83 ec 18          	sub    $0x18,%rsp
+  80223a:	48 89 fb             	mov    %rdi,%rbx
+  80223d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802240:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802247:	ff ff ff 
+  80224a:	48 01 df             	add    %rbx,%rdi
+  80224d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802251:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802255:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+  802261:	41 89 c5             	mov    %eax,%r13d
+  802264:	85 c0                	test   %eax,%eax
+  802266:	78 06                	js     80226e <fd_close+0x41>
+  802268:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80226c:	74 1a                	je     802288 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80226e:	45 84 e4             	test   %r12b,%r12b
+  802271:	b8 00 00 00 00       	mov    $0x0,%eax
+  802276:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80227a:	44 89 e8             	mov    %r13d,%eax
+  80227d:	48 83 c4 18          	add    $0x18,%rsp
+  802281:	5b                   	pop    %rbx
+  802282:	41 5c                	pop    %r12
+  802284:	41 5d                	pop    %r13
+  802286:	5d                   	pop    %rbp
+  802287:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802288:	8b 3b                	mov    (%rbx),%edi
+  80228a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80228e:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+  80229a:	41 89 c5             	mov    %eax,%r13d
+  80229d:	85 c0                	test   %eax,%eax
+  80229f:	78 1b                	js     8022bc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8022a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022a5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8022a9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8022af:	48 85 c0             	test   %rax,%rax
+  8022b2:	74 08                	je     8022bc <fd_close+0x8f>
+  8022b4:	48 89 df             	mov    %rbx,%rdi
+  8022b7:	ff d0                	call   *%rax
+  8022b9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8022bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022c1:	48 89 de             	mov    %rbx,%rsi
+  8022c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c9:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  8022d0:	00 00 00 
+  8022d3:	ff d0                	call   *%rax
+    return res;
+  8022d5:	eb a3                	jmp    80227a <fd_close+0x4d>
+
+00000000008022d7 <close>:
+
+int
+close(int fdnum) {
+  8022d7:	55                   	push   %rbp
+  8022d8:	48 89 e5             	mov    %rsp,%rbp
+  8022db:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022df:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022e3:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	78 15                	js     802308 <close+0x31>
+
+    return fd_close(fd, 1);
+  8022f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8022f8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8022fc:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+}
+  802308:	c9                   	leave
+  802309:	c3                   	ret
+
+000000000080230a <close_all>:
+
+void
+close_all(void) {
+  80230a:	55                   	push   %rbp
+  80230b:	48 89 e5             	mov    %rsp,%rbp
+  80230e:	41 54                	push   %r12
+  802310:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802311:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802316:	49 bc d7 22 80 00 00 	movabs $0x8022d7,%r12
+  80231d:	00 00 00 
+  802320:	89 df                	mov    %ebx,%edi
+  802322:	41 ff d4             	call   *%r12
+  802325:	83 c3 01             	add    $0x1,%ebx
+  802328:	83 fb 20             	cmp    $0x20,%ebx
+  80232b:	75 f3                	jne    802320 <close_all+0x16>
+}
+  80232d:	5b                   	pop    %rbx
+  80232e:	41 5c                	pop    %r12
+  802330:	5d                   	pop    %rbp
+  802331:	c3                   	ret
+
+0000000000802332 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802332:	55                   	push   %rbp
+  802333:	48 89 e5             	mov    %rsp,%rbp
+  802336:	41 57                	push   %r15
+  802338:	41 56                	push   %r14
+  80233a:	41 55                	push   %r13
+  80233c:	41 54                	push   %r12
+  80233e:	53                   	push   %rbx
+  80233f:	48 83 ec 18          	sub    $0x18,%rsp
+  802343:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802346:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80234a:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  802351:	00 00 00 
+  802354:	ff d0                	call   *%rax
+  802356:	89 c3                	mov    %eax,%ebx
+  802358:	85 c0                	test   %eax,%eax
+  80235a:	0f 88 b8 00 00 00    	js     802418 <dup+0xe6>
+    close(newfdnum);
+  802360:	44 89 e7             	mov    %r12d,%edi
+  802363:	48 b8 d7 22 80 00 00 	movabs $0x8022d7,%rax
+  80236a:	00 00 00 
+  80236d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80236f:	4d 63 ec             	movslq %r12d,%r13
+  802372:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802379:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80237d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802381:	4c 89 ff             	mov    %r15,%rdi
+  802384:	49 be f6 20 80 00 00 	movabs $0x8020f6,%r14
+  80238b:	00 00 00 
+  80238e:	41 ff d6             	call   *%r14
+  802391:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802394:	4c 89 ef             	mov    %r13,%rdi
+  802397:	41 ff d6             	call   *%r14
+  80239a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80239d:	48 89 df             	mov    %rbx,%rdi
+  8023a0:	48 b8 c6 3f 80 00 00 	movabs $0x803fc6,%rax
+  8023a7:	00 00 00 
+  8023aa:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8023ac:	a8 04                	test   $0x4,%al
+  8023ae:	74 2b                	je     8023db <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8023b0:	41 89 c1             	mov    %eax,%r9d
+  8023b3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023b9:	4c 89 f1             	mov    %r14,%rcx
+  8023bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c1:	48 89 de             	mov    %rbx,%rsi
+  8023c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023c9:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  8023d0:	00 00 00 
+  8023d3:	ff d0                	call   *%rax
+  8023d5:	89 c3                	mov    %eax,%ebx
+  8023d7:	85 c0                	test   %eax,%eax
+  8023d9:	78 4e                	js     802429 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8023db:	4c 89 ff             	mov    %r15,%rdi
+  8023de:	48 b8 c6 3f 80 00 00 	movabs $0x803fc6,%rax
+  8023e5:	00 00 00 
+  8023e8:	ff d0                	call   *%rax
+  8023ea:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8023ed:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023f3:	4c 89 e9             	mov    %r13,%rcx
+  8023f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023fb:	4c 89 fe             	mov    %r15,%rsi
+  8023fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802403:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  80240a:	00 00 00 
+  80240d:	ff d0                	call   *%rax
+  80240f:	89 c3                	mov    %eax,%ebx
+  802411:	85 c0                	test   %eax,%eax
+  802413:	78 14                	js     802429 <dup+0xf7>
+
+    return newfdnum;
+  802415:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802418:	89 d8                	mov    %ebx,%eax
+  80241a:	48 83 c4 18          	add    $0x18,%rsp
+  80241e:	5b                   	pop    %rbx
+  80241f:	41 5c                	pop    %r12
+  802421:	41 5d                	pop    %r13
+  802423:	41 5e                	pop    %r14
+  802425:	41 5f                	pop    %r15
+  802427:	5d                   	pop    %rbp
+  802428:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802429:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80242e:	4c 89 ee             	mov    %r13,%rsi
+  802431:	bf 00 00 00 00       	mov    $0x0,%edi
+  802436:	49 bc e0 15 80 00 00 	movabs $0x8015e0,%r12
+  80243d:	00 00 00 
+  802440:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802443:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802448:	4c 89 f6             	mov    %r14,%rsi
+  80244b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802450:	41 ff d4             	call   *%r12
+    return res;
+  802453:	eb c3                	jmp    802418 <dup+0xe6>
+
+0000000000802455 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802455:	55                   	push   %rbp
+  802456:	48 89 e5             	mov    %rsp,%rbp
+  802459:	41 56                	push   %r14
+  80245b:	41 55                	push   %r13
+  80245d:	41 54                	push   %r12
+  80245f:	53                   	push   %rbx
+  802460:	48 83 ec 10          	sub    $0x10,%rsp
+  802464:	89 fb                	mov    %edi,%ebx
+  802466:	49 89 f4             	mov    %rsi,%r12
+  802469:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80246c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802470:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  802477:	00 00 00 
+  80247a:	ff d0                	call   *%rax
+  80247c:	85 c0                	test   %eax,%eax
+  80247e:	78 4c                	js     8024cc <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802480:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802484:	41 8b 3e             	mov    (%r14),%edi
+  802487:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80248b:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  802492:	00 00 00 
+  802495:	ff d0                	call   *%rax
+  802497:	85 c0                	test   %eax,%eax
+  802499:	78 35                	js     8024d0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80249b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80249f:	83 e0 03             	and    $0x3,%eax
+  8024a2:	83 f8 01             	cmp    $0x1,%eax
+  8024a5:	74 2d                	je     8024d4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8024a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024ab:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8024af:	48 85 c0             	test   %rax,%rax
+  8024b2:	74 56                	je     80250a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8024b4:	4c 89 ea             	mov    %r13,%rdx
+  8024b7:	4c 89 e6             	mov    %r12,%rsi
+  8024ba:	4c 89 f7             	mov    %r14,%rdi
+  8024bd:	ff d0                	call   *%rax
+}
+  8024bf:	48 83 c4 10          	add    $0x10,%rsp
+  8024c3:	5b                   	pop    %rbx
+  8024c4:	41 5c                	pop    %r12
+  8024c6:	41 5d                	pop    %r13
+  8024c8:	41 5e                	pop    %r14
+  8024ca:	5d                   	pop    %rbp
+  8024cb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024cc:	48 98                	cltq
+  8024ce:	eb ef                	jmp    8024bf <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024d0:	48 98                	cltq
+  8024d2:	eb eb                	jmp    8024bf <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024d4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8024db:	00 00 00 
+  8024de:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8024e4:	89 da                	mov    %ebx,%edx
+  8024e6:	48 bf 31 57 80 00 00 	movabs $0x805731,%rdi
+  8024ed:	00 00 00 
+  8024f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f5:	48 b9 29 03 80 00 00 	movabs $0x800329,%rcx
+  8024fc:	00 00 00 
+  8024ff:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802501:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802508:	eb b5                	jmp    8024bf <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80250a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802511:	eb ac                	jmp    8024bf <read+0x6a>
+
+0000000000802513 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802513:	55                   	push   %rbp
+  802514:	48 89 e5             	mov    %rsp,%rbp
+  802517:	41 57                	push   %r15
+  802519:	41 56                	push   %r14
+  80251b:	41 55                	push   %r13
+  80251d:	41 54                	push   %r12
+  80251f:	53                   	push   %rbx
+  802520:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802524:	48 85 d2             	test   %rdx,%rdx
+  802527:	74 54                	je     80257d <readn+0x6a>
+  802529:	41 89 fd             	mov    %edi,%r13d
+  80252c:	49 89 f6             	mov    %rsi,%r14
+  80252f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802532:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802537:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80253c:	49 bf 55 24 80 00 00 	movabs $0x802455,%r15
+  802543:	00 00 00 
+  802546:	4c 89 e2             	mov    %r12,%rdx
+  802549:	48 29 f2             	sub    %rsi,%rdx
+  80254c:	4c 01 f6             	add    %r14,%rsi
+  80254f:	44 89 ef             	mov    %r13d,%edi
+  802552:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802555:	85 c0                	test   %eax,%eax
+  802557:	78 20                	js     802579 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802559:	01 c3                	add    %eax,%ebx
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	74 08                	je     802567 <readn+0x54>
+  80255f:	48 63 f3             	movslq %ebx,%rsi
+  802562:	4c 39 e6             	cmp    %r12,%rsi
+  802565:	72 df                	jb     802546 <readn+0x33>
+    }
+    return res;
+  802567:	48 63 c3             	movslq %ebx,%rax
+}
+  80256a:	48 83 c4 08          	add    $0x8,%rsp
+  80256e:	5b                   	pop    %rbx
+  80256f:	41 5c                	pop    %r12
+  802571:	41 5d                	pop    %r13
+  802573:	41 5e                	pop    %r14
+  802575:	41 5f                	pop    %r15
+  802577:	5d                   	pop    %rbp
+  802578:	c3                   	ret
+        if (inc < 0) return inc;
+  802579:	48 98                	cltq
+  80257b:	eb ed                	jmp    80256a <readn+0x57>
+    int inc = 1, res = 0;
+  80257d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802582:	eb e3                	jmp    802567 <readn+0x54>
+
+0000000000802584 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802584:	55                   	push   %rbp
+  802585:	48 89 e5             	mov    %rsp,%rbp
+  802588:	41 56                	push   %r14
+  80258a:	41 55                	push   %r13
+  80258c:	41 54                	push   %r12
+  80258e:	53                   	push   %rbx
+  80258f:	48 83 ec 10          	sub    $0x10,%rsp
+  802593:	89 fb                	mov    %edi,%ebx
+  802595:	49 89 f4             	mov    %rsi,%r12
+  802598:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80259b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80259f:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  8025a6:	00 00 00 
+  8025a9:	ff d0                	call   *%rax
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	78 47                	js     8025f6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025af:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8025b3:	41 8b 3e             	mov    (%r14),%edi
+  8025b6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025ba:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  8025c1:	00 00 00 
+  8025c4:	ff d0                	call   *%rax
+  8025c6:	85 c0                	test   %eax,%eax
+  8025c8:	78 30                	js     8025fa <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025ca:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8025cf:	74 2d                	je     8025fe <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8025d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025d5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8025d9:	48 85 c0             	test   %rax,%rax
+  8025dc:	74 56                	je     802634 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8025de:	4c 89 ea             	mov    %r13,%rdx
+  8025e1:	4c 89 e6             	mov    %r12,%rsi
+  8025e4:	4c 89 f7             	mov    %r14,%rdi
+  8025e7:	ff d0                	call   *%rax
+}
+  8025e9:	48 83 c4 10          	add    $0x10,%rsp
+  8025ed:	5b                   	pop    %rbx
+  8025ee:	41 5c                	pop    %r12
+  8025f0:	41 5d                	pop    %r13
+  8025f2:	41 5e                	pop    %r14
+  8025f4:	5d                   	pop    %rbp
+  8025f5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025f6:	48 98                	cltq
+  8025f8:	eb ef                	jmp    8025e9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025fa:	48 98                	cltq
+  8025fc:	eb eb                	jmp    8025e9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8025fe:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802605:	00 00 00 
+  802608:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80260e:	89 da                	mov    %ebx,%edx
+  802610:	48 bf 4d 57 80 00 00 	movabs $0x80574d,%rdi
+  802617:	00 00 00 
+  80261a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80261f:	48 b9 29 03 80 00 00 	movabs $0x800329,%rcx
+  802626:	00 00 00 
+  802629:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80262b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802632:	eb b5                	jmp    8025e9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802634:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80263b:	eb ac                	jmp    8025e9 <write+0x65>
+
+000000000080263d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80263d:	55                   	push   %rbp
+  80263e:	48 89 e5             	mov    %rsp,%rbp
+  802641:	53                   	push   %rbx
+  802642:	48 83 ec 18          	sub    $0x18,%rsp
+  802646:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802648:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80264c:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  802653:	00 00 00 
+  802656:	ff d0                	call   *%rax
+  802658:	85 c0                	test   %eax,%eax
+  80265a:	78 0c                	js     802668 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80265c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802660:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802663:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802668:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80266c:	c9                   	leave
+  80266d:	c3                   	ret
+
+000000000080266e <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80266e:	55                   	push   %rbp
+  80266f:	48 89 e5             	mov    %rsp,%rbp
+  802672:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802676:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80267a:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  802681:	00 00 00 
+  802684:	ff d0                	call   *%rax
+  802686:	85 c0                	test   %eax,%eax
+  802688:	78 07                	js     802691 <tell+0x23>
+    return fdes->fd_offset;
+  80268a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80268e:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802691:	c9                   	leave
+  802692:	c3                   	ret
+
+0000000000802693 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802693:	55                   	push   %rbp
+  802694:	48 89 e5             	mov    %rsp,%rbp
+  802697:	41 55                	push   %r13
+  802699:	41 54                	push   %r12
+  80269b:	53                   	push   %rbx
+  80269c:	48 83 ec 18          	sub    $0x18,%rsp
+  8026a0:	89 fb                	mov    %edi,%ebx
+  8026a2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026a5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026a9:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  8026b0:	00 00 00 
+  8026b3:	ff d0                	call   *%rax
+  8026b5:	85 c0                	test   %eax,%eax
+  8026b7:	78 38                	js     8026f1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026b9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8026bd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8026c1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026c5:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  8026cc:	00 00 00 
+  8026cf:	ff d0                	call   *%rax
+  8026d1:	85 c0                	test   %eax,%eax
+  8026d3:	78 1c                	js     8026f1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026d5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8026da:	74 20                	je     8026fc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8026dc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026e0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8026e4:	48 85 c0             	test   %rax,%rax
+  8026e7:	74 47                	je     802730 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8026e9:	44 89 e6             	mov    %r12d,%esi
+  8026ec:	4c 89 ef             	mov    %r13,%rdi
+  8026ef:	ff d0                	call   *%rax
+}
+  8026f1:	48 83 c4 18          	add    $0x18,%rsp
+  8026f5:	5b                   	pop    %rbx
+  8026f6:	41 5c                	pop    %r12
+  8026f8:	41 5d                	pop    %r13
+  8026fa:	5d                   	pop    %rbp
+  8026fb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8026fc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802703:	00 00 00 
+  802706:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80270c:	89 da                	mov    %ebx,%edx
+  80270e:	48 bf 10 57 80 00 00 	movabs $0x805710,%rdi
+  802715:	00 00 00 
+  802718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271d:	48 b9 29 03 80 00 00 	movabs $0x800329,%rcx
+  802724:	00 00 00 
+  802727:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802729:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80272e:	eb c1                	jmp    8026f1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802730:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802735:	eb ba                	jmp    8026f1 <ftruncate+0x5e>
+
+0000000000802737 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802737:	55                   	push   %rbp
+  802738:	48 89 e5             	mov    %rsp,%rbp
+  80273b:	41 54                	push   %r12
+  80273d:	53                   	push   %rbx
+  80273e:	48 83 ec 10          	sub    $0x10,%rsp
+  802742:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802745:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802749:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  802750:	00 00 00 
+  802753:	ff d0                	call   *%rax
+  802755:	85 c0                	test   %eax,%eax
+  802757:	78 4e                	js     8027a7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802759:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80275d:	41 8b 3c 24          	mov    (%r12),%edi
+  802761:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802765:	48 b8 bd 21 80 00 00 	movabs $0x8021bd,%rax
+  80276c:	00 00 00 
+  80276f:	ff d0                	call   *%rax
+  802771:	85 c0                	test   %eax,%eax
+  802773:	78 32                	js     8027a7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802775:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802779:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80277e:	74 30                	je     8027b0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802780:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802783:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80278a:	00 00 00 
+    stat->st_isdir = 0;
+  80278d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802794:	00 00 00 
+    stat->st_dev = dev;
+  802797:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80279e:	48 89 de             	mov    %rbx,%rsi
+  8027a1:	4c 89 e7             	mov    %r12,%rdi
+  8027a4:	ff 50 28             	call   *0x28(%rax)
+}
+  8027a7:	48 83 c4 10          	add    $0x10,%rsp
+  8027ab:	5b                   	pop    %rbx
+  8027ac:	41 5c                	pop    %r12
+  8027ae:	5d                   	pop    %rbp
+  8027af:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8027b0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027b5:	eb f0                	jmp    8027a7 <fstat+0x70>
+
+00000000008027b7 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8027b7:	55                   	push   %rbp
+  8027b8:	48 89 e5             	mov    %rsp,%rbp
+  8027bb:	41 54                	push   %r12
+  8027bd:	53                   	push   %rbx
+  8027be:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8027c5:	41 89 fc             	mov    %edi,%r12d
+  8027c8:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027ca:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027ce:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  8027d5:	00 00 00 
+  8027d8:	ff d0                	call   *%rax
+  8027da:	85 c0                	test   %eax,%eax
+  8027dc:	78 31                	js     80280f <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8027de:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8027e5:	44 89 e7             	mov    %r12d,%edi
+  8027e8:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  8027ef:	00 00 00 
+  8027f2:	ff d0                	call   *%rax
+  8027f4:	85 c0                	test   %eax,%eax
+  8027f6:	78 17                	js     80280f <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8027f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027fc:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8027ff:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802802:	39 d3                	cmp    %edx,%ebx
+  802804:	0f 4f da             	cmovg  %edx,%ebx
+  802807:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80280a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80280f:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802816:	5b                   	pop    %rbx
+  802817:	41 5c                	pop    %r12
+  802819:	5d                   	pop    %rbp
+  80281a:	c3                   	ret
+
+000000000080281b <seektoend>:
+{
+  80281b:	55                   	push   %rbp
+  80281c:	48 89 e5             	mov    %rsp,%rbp
+  80281f:	53                   	push   %rbx
+  802820:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802827:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802829:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80282d:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  802834:	00 00 00 
+  802837:	ff d0                	call   *%rax
+  802839:	85 c0                	test   %eax,%eax
+  80283b:	78 28                	js     802865 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80283d:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802844:	89 df                	mov    %ebx,%edi
+  802846:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  80284d:	00 00 00 
+  802850:	ff d0                	call   *%rax
+  802852:	85 c0                	test   %eax,%eax
+  802854:	78 0f                	js     802865 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802856:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802859:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80285d:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802860:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802865:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802869:	c9                   	leave
+  80286a:	c3                   	ret
+
+000000000080286b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80286b:	55                   	push   %rbp
+  80286c:	48 89 e5             	mov    %rsp,%rbp
+  80286f:	41 54                	push   %r12
+  802871:	53                   	push   %rbx
+  802872:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802875:	be 00 00 00 00       	mov    $0x0,%esi
+  80287a:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  802881:	00 00 00 
+  802884:	ff d0                	call   *%rax
+  802886:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802888:	85 c0                	test   %eax,%eax
+  80288a:	78 25                	js     8028b1 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80288c:	4c 89 e6             	mov    %r12,%rsi
+  80288f:	89 c7                	mov    %eax,%edi
+  802891:	48 b8 37 27 80 00 00 	movabs $0x802737,%rax
+  802898:	00 00 00 
+  80289b:	ff d0                	call   *%rax
+  80289d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8028a0:	89 df                	mov    %ebx,%edi
+  8028a2:	48 b8 d7 22 80 00 00 	movabs $0x8022d7,%rax
+  8028a9:	00 00 00 
+  8028ac:	ff d0                	call   *%rax
+
+    return res;
+  8028ae:	44 89 e3             	mov    %r12d,%ebx
+}
+  8028b1:	89 d8                	mov    %ebx,%eax
+  8028b3:	5b                   	pop    %rbx
+  8028b4:	41 5c                	pop    %r12
+  8028b6:	5d                   	pop    %rbp
+  8028b7:	c3                   	ret
+
+00000000008028b8 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8028b8:	55                   	push   %rbp
+  8028b9:	48 89 e5             	mov    %rsp,%rbp
+  8028bc:	53                   	push   %rbx
+  8028bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c1:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8028c4:	48 b8 e4 20 80 00 00 	movabs $0x8020e4,%rax
+  8028cb:	00 00 00 
+  8028ce:	ff d0                	call   *%rax
+  8028d0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8028d4:	0f 87 ea 00 00 00    	ja     8029c4 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8028da:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8028e1:	00 00 00 
+  8028e4:	80 38 00             	cmpb   $0x0,(%rax)
+  8028e7:	75 35                	jne    80291e <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8028e9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028ee:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8028f3:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8028f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fd:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  802904:	00 00 00 
+  802907:	ff d0                	call   *%rax
+  802909:	85 c0                	test   %eax,%eax
+  80290b:	0f 88 ba 00 00 00    	js     8029cb <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802911:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802918:	00 00 00 
+  80291b:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  80291e:	48 89 df             	mov    %rbx,%rdi
+  802921:	48 b8 e4 20 80 00 00 	movabs $0x8020e4,%rax
+  802928:	00 00 00 
+  80292b:	ff d0                	call   *%rax
+  80292d:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802931:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802938:	00 00 00 
+  80293b:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80293f:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802942:	39 39                	cmp    %edi,(%rcx)
+  802944:	74 46                	je     80298c <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802946:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80294a:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802951:	00 
+  802952:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802959:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802960:	00 
+  802961:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802968:	00 
+  802969:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802970:	00 
+  802971:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802978:	00 
+  802979:	89 39                	mov    %edi,(%rcx)
+  80297b:	48 01 c6             	add    %rax,%rsi
+  80297e:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802983:	48 89 c8             	mov    %rcx,%rax
+  802986:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80298c:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802990:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802997:	00 00 00 
+  80299a:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80299d:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  8029a1:	74 e0                	je     802983 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  8029a3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8029aa:	00 
+  8029ab:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8029af:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8029b6:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8029b8:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8029bb:	48 01 c2             	add    %rax,%rdx
+  8029be:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8029c2:	eb bf                	jmp    802983 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8029c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c9:	eb b8                	jmp    802983 <fbuf_get+0xcb>
+            return NULL;
+  8029cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029d0:	eb b1                	jmp    802983 <fbuf_get+0xcb>
+
+00000000008029d2 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8029d2:	55                   	push   %rbp
+  8029d3:	48 89 e5             	mov    %rsp,%rbp
+  8029d6:	53                   	push   %rbx
+  8029d7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8029db:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8029e2:	00 00 00 
+  8029e5:	48 8b 18             	mov    (%rax),%rbx
+  8029e8:	48 85 db             	test   %rbx,%rbx
+  8029eb:	74 16                	je     802a03 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8029ed:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8029f4:	00 00 00 
+  8029f7:	48 8b 18             	mov    (%rax),%rbx
+}
+  8029fa:	48 89 d8             	mov    %rbx,%rax
+  8029fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a01:	c9                   	leave
+  802a02:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802a03:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a08:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802a0d:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802a12:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a17:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  802a1e:	00 00 00 
+  802a21:	ff d0                	call   *%rax
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	78 d3                	js     8029fa <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802a27:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802a2c:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802a33:	00 00 00 
+  802a36:	eb b5                	jmp    8029ed <fsipc_bulk+0x1b>
+
+0000000000802a38 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802a38:	55                   	push   %rbp
+  802a39:	48 89 e5             	mov    %rsp,%rbp
+  802a3c:	41 57                	push   %r15
+  802a3e:	41 56                	push   %r14
+  802a40:	41 55                	push   %r13
+  802a42:	41 54                	push   %r12
+  802a44:	53                   	push   %rbx
+  802a45:	48 83 ec 08          	sub    $0x8,%rsp
+  802a49:	41 89 fd             	mov    %edi,%r13d
+  802a4c:	49 89 f6             	mov    %rsi,%r14
+  802a4f:	49 89 d7             	mov    %rdx,%r15
+  802a52:	48 89 cb             	mov    %rcx,%rbx
+  802a55:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a58:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802a5f:	00 00 00 
+  802a62:	83 38 00             	cmpl   $0x0,(%rax)
+  802a65:	74 52                	je     802ab9 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802a67:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a6d:	4c 89 f9             	mov    %r15,%rcx
+  802a70:	4c 89 f2             	mov    %r14,%rdx
+  802a73:	44 89 ee             	mov    %r13d,%esi
+  802a76:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802a7d:	00 00 00 
+  802a80:	8b 38                	mov    (%rax),%edi
+  802a82:	48 b8 1d 45 80 00 00 	movabs $0x80451d,%rax
+  802a89:	00 00 00 
+  802a8c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802a8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a93:	4c 89 e2             	mov    %r12,%rdx
+  802a96:	48 89 de             	mov    %rbx,%rsi
+  802a99:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a9e:	48 b8 6d 43 80 00 00 	movabs $0x80436d,%rax
+  802aa5:	00 00 00 
+  802aa8:	ff d0                	call   *%rax
+}
+  802aaa:	48 83 c4 08          	add    $0x8,%rsp
+  802aae:	5b                   	pop    %rbx
+  802aaf:	41 5c                	pop    %r12
+  802ab1:	41 5d                	pop    %r13
+  802ab3:	41 5e                	pop    %r14
+  802ab5:	41 5f                	pop    %r15
+  802ab7:	5d                   	pop    %rbp
+  802ab8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ab9:	bf 03 00 00 00       	mov    $0x3,%edi
+  802abe:	48 b8 c0 45 80 00 00 	movabs $0x8045c0,%rax
+  802ac5:	00 00 00 
+  802ac8:	ff d0                	call   *%rax
+  802aca:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802ad1:	00 00 
+  802ad3:	eb 92                	jmp    802a67 <fsipc_region+0x2f>
+
+0000000000802ad5 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802ad5:	55                   	push   %rbp
+  802ad6:	48 89 e5             	mov    %rsp,%rbp
+  802ad9:	41 57                	push   %r15
+  802adb:	41 56                	push   %r14
+  802add:	41 55                	push   %r13
+  802adf:	41 54                	push   %r12
+  802ae1:	53                   	push   %rbx
+  802ae2:	48 83 ec 28          	sub    $0x28,%rsp
+  802ae6:	49 89 ff             	mov    %rdi,%r15
+  802ae9:	49 89 f6             	mov    %rsi,%r14
+  802aec:	48 89 d3             	mov    %rdx,%rbx
+  802aef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802af3:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802af6:	48 b8 d2 29 80 00 00 	movabs $0x8029d2,%rax
+  802afd:	00 00 00 
+  802b00:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802b02:	48 85 c0             	test   %rax,%rax
+  802b05:	0f 84 cc 00 00 00    	je     802bd7 <devfile_write_direct+0x102>
+  802b0b:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802b0e:	48 85 db             	test   %rbx,%rbx
+  802b11:	0f 84 ba 00 00 00    	je     802bd1 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802b17:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b1d:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802b24:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802b28:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802b2c:	4c 29 e3             	sub    %r12,%rbx
+  802b2f:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802b34:	48 39 c3             	cmp    %rax,%rbx
+  802b37:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b3b:	48 89 da             	mov    %rbx,%rdx
+  802b3e:	4c 89 f6             	mov    %r14,%rsi
+  802b41:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802b45:	48 b8 96 10 80 00 00 	movabs $0x801096,%rax
+  802b4c:	00 00 00 
+  802b4f:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802b51:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b55:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802b59:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802b5c:	44 01 e0             	add    %r12d,%eax
+  802b5f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802b63:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802b67:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802b6e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802b75:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802b7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b82:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b87:	4c 89 ee             	mov    %r13,%rsi
+  802b8a:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b8f:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  802b96:	00 00 00 
+  802b99:	ff d0                	call   *%rax
+        if (res < 0)
+  802b9b:	85 c0                	test   %eax,%eax
+  802b9d:	78 29                	js     802bc8 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802b9f:	74 2b                	je     802bcc <devfile_write_direct+0xf7>
+        i += res;
+  802ba1:	48 98                	cltq
+  802ba3:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802ba6:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802ba9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bad:	49 39 c4             	cmp    %rax,%r12
+  802bb0:	0f 82 72 ff ff ff    	jb     802b28 <devfile_write_direct+0x53>
+    return i;
+  802bb6:	4c 89 e0             	mov    %r12,%rax
+}
+  802bb9:	48 83 c4 28          	add    $0x28,%rsp
+  802bbd:	5b                   	pop    %rbx
+  802bbe:	41 5c                	pop    %r12
+  802bc0:	41 5d                	pop    %r13
+  802bc2:	41 5e                	pop    %r14
+  802bc4:	41 5f                	pop    %r15
+  802bc6:	5d                   	pop    %rbp
+  802bc7:	c3                   	ret
+            return res;
+  802bc8:	48 98                	cltq
+  802bca:	eb ed                	jmp    802bb9 <devfile_write_direct+0xe4>
+            return i;
+  802bcc:	4c 89 e0             	mov    %r12,%rax
+  802bcf:	eb e8                	jmp    802bb9 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802bd1:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802bd5:	eb df                	jmp    802bb6 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802bd7:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802bde:	eb d9                	jmp    802bb9 <devfile_write_direct+0xe4>
+
+0000000000802be0 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802be0:	55                   	push   %rbp
+  802be1:	48 89 e5             	mov    %rsp,%rbp
+  802be4:	41 56                	push   %r14
+  802be6:	41 55                	push   %r13
+  802be8:	41 54                	push   %r12
+  802bea:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802beb:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802bef:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf8:	4d 39 ee             	cmp    %r13,%r14
+  802bfb:	0f 84 99 00 00 00    	je     802c9a <fbuf_flush+0xba>
+  802c01:	49 89 fc             	mov    %rdi,%r12
+  802c04:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802c07:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c0a:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c0e:	48 b8 e4 20 80 00 00 	movabs $0x8020e4,%rax
+  802c15:	00 00 00 
+  802c18:	ff d0                	call   *%rax
+  802c1a:	48 89 c2             	mov    %rax,%rdx
+  802c1d:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c21:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c25:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c29:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802c2e:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c31:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c35:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802c3c:	00 
+  802c3d:	44 89 f1             	mov    %r14d,%ecx
+  802c40:	4c 89 ea             	mov    %r13,%rdx
+  802c43:	4c 89 e7             	mov    %r12,%rdi
+  802c46:	48 b8 d5 2a 80 00 00 	movabs $0x802ad5,%rax
+  802c4d:	00 00 00 
+  802c50:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c52:	48 85 c0             	test   %rax,%rax
+  802c55:	78 43                	js     802c9a <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802c57:	4c 39 e8             	cmp    %r13,%rax
+  802c5a:	72 47                	jb     802ca3 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802c5c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802c61:	83 c0 01             	add    $0x1,%eax
+  802c64:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c69:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802c6c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802c70:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802c74:	72 0f                	jb     802c85 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802c76:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802c7a:	48 39 c2             	cmp    %rax,%rdx
+  802c7d:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802c81:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802c85:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802c8c:	00 
+  802c8d:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802c94:	00 
+    return 0;
+  802c95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c9a:	5b                   	pop    %rbx
+  802c9b:	41 5c                	pop    %r12
+  802c9d:	41 5d                	pop    %r13
+  802c9f:	41 5e                	pop    %r14
+  802ca1:	5d                   	pop    %rbp
+  802ca2:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802ca3:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802ca8:	eb f0                	jmp    802c9a <fbuf_flush+0xba>
+
+0000000000802caa <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802caa:	55                   	push   %rbp
+  802cab:	48 89 e5             	mov    %rsp,%rbp
+  802cae:	53                   	push   %rbx
+  802caf:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb3:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802cb6:	48 b8 b8 28 80 00 00 	movabs $0x8028b8,%rax
+  802cbd:	00 00 00 
+  802cc0:	ff d0                	call   *%rax
+  802cc2:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cca:	48 85 f6             	test   %rsi,%rsi
+  802ccd:	74 0f                	je     802cde <devfile_sync+0x34>
+  802ccf:	48 89 df             	mov    %rbx,%rdi
+  802cd2:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  802cd9:	00 00 00 
+  802cdc:	ff d0                	call   *%rax
+}
+  802cde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce2:	c9                   	leave
+  802ce3:	c3                   	ret
+
+0000000000802ce4 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802ce4:	55                   	push   %rbp
+  802ce5:	48 89 e5             	mov    %rsp,%rbp
+  802ce8:	48 83 ec 10          	sub    $0x10,%rsp
+  802cec:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802cef:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802cf6:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802cf7:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802cfb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d00:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802d07:	00 00 00 
+  802d0a:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  802d11:	00 00 00 
+  802d14:	ff d0                	call   *%rax
+}
+  802d16:	c9                   	leave
+  802d17:	c3                   	ret
+
+0000000000802d18 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d18:	55                   	push   %rbp
+  802d19:	48 89 e5             	mov    %rsp,%rbp
+  802d1c:	41 54                	push   %r12
+  802d1e:	53                   	push   %rbx
+  802d1f:	48 89 fb             	mov    %rdi,%rbx
+  802d22:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802d25:	48 b8 aa 2c 80 00 00 	movabs $0x802caa,%rax
+  802d2c:	00 00 00 
+  802d2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d31:	85 c0                	test   %eax,%eax
+  802d33:	78 63                	js     802d98 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d35:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d38:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802d3f:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802d41:	be 00 00 00 00       	mov    $0x0,%esi
+  802d46:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d4b:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  802d52:	00 00 00 
+  802d55:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	78 3d                	js     802d98 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802d5b:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802d62:	00 00 00 
+  802d65:	48 89 de             	mov    %rbx,%rsi
+  802d68:	4c 89 e7             	mov    %r12,%rdi
+  802d6b:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  802d72:	00 00 00 
+  802d75:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802d77:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802d7d:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802d84:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802d85:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802d8b:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802d92:	00 
+
+    return 0;
+  802d93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d98:	5b                   	pop    %rbx
+  802d99:	41 5c                	pop    %r12
+  802d9b:	5d                   	pop    %rbp
+  802d9c:	c3                   	ret
+
+0000000000802d9d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802d9d:	55                   	push   %rbp
+  802d9e:	48 89 e5             	mov    %rsp,%rbp
+  802da1:	41 54                	push   %r12
+  802da3:	53                   	push   %rbx
+  802da4:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802da7:	48 b8 aa 2c 80 00 00 	movabs $0x802caa,%rax
+  802dae:	00 00 00 
+  802db1:	ff d0                	call   *%rax
+  802db3:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802db6:	48 89 df             	mov    %rbx,%rdi
+  802db9:	48 b8 e4 20 80 00 00 	movabs $0x8020e4,%rax
+  802dc0:	00 00 00 
+  802dc3:	ff d0                	call   *%rax
+  802dc5:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802dc9:	76 2e                	jbe    802df9 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802dcb:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802dce:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802dd5:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802dd7:	be 00 00 00 00       	mov    $0x0,%esi
+  802ddc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802de1:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  802de8:	00 00 00 
+  802deb:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802ded:	45 85 e4             	test   %r12d,%r12d
+  802df0:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802df4:	5b                   	pop    %rbx
+  802df5:	41 5c                	pop    %r12
+  802df7:	5d                   	pop    %rbp
+  802df8:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802df9:	48 89 df             	mov    %rbx,%rdi
+  802dfc:	48 b8 e4 20 80 00 00 	movabs $0x8020e4,%rax
+  802e03:	00 00 00 
+  802e06:	ff d0                	call   *%rax
+  802e08:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802e0c:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802e13:	00 00 00 
+  802e16:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802e1d:	48 89 df             	mov    %rbx,%rdi
+  802e20:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  802e27:	00 00 00 
+  802e2a:	ff d0                	call   *%rax
+  802e2c:	48 89 c6             	mov    %rax,%rsi
+  802e2f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e34:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e39:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  802e40:	00 00 00 
+  802e43:	ff d0                	call   *%rax
+  802e45:	eb 84                	jmp    802dcb <devfile_flush+0x2e>
+
+0000000000802e47 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e47:	55                   	push   %rbp
+  802e48:	48 89 e5             	mov    %rsp,%rbp
+  802e4b:	41 55                	push   %r13
+  802e4d:	41 54                	push   %r12
+  802e4f:	53                   	push   %rbx
+  802e50:	48 83 ec 08          	sub    $0x8,%rsp
+  802e54:	48 89 fb             	mov    %rdi,%rbx
+  802e57:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802e5a:	48 b8 b8 28 80 00 00 	movabs $0x8028b8,%rax
+  802e61:	00 00 00 
+  802e64:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e66:	48 85 c0             	test   %rax,%rax
+  802e69:	74 51                	je     802ebc <devfile_trunc+0x75>
+  802e6b:	49 89 c4             	mov    %rax,%r12
+  802e6e:	48 89 c6             	mov    %rax,%rsi
+  802e71:	48 89 df             	mov    %rbx,%rdi
+  802e74:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  802e7b:	00 00 00 
+  802e7e:	ff d0                	call   *%rax
+  802e80:	85 c0                	test   %eax,%eax
+  802e82:	78 2d                	js     802eb1 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e84:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802e8b:	00 00 00 
+  802e8e:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802e91:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e93:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802e97:	be 00 00 00 00       	mov    $0x0,%esi
+  802e9c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ea1:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  802ea8:	00 00 00 
+  802eab:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ead:	85 c0                	test   %eax,%eax
+  802eaf:	79 3e                	jns    802eef <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802eb1:	48 83 c4 08          	add    $0x8,%rsp
+  802eb5:	5b                   	pop    %rbx
+  802eb6:	41 5c                	pop    %r12
+  802eb8:	41 5d                	pop    %r13
+  802eba:	5d                   	pop    %rbp
+  802ebb:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802ebc:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802ec3:	00 00 00 
+  802ec6:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802ec9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802ecb:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ecf:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed4:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ed9:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  802ee0:	00 00 00 
+  802ee3:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ee5:	85 c0                	test   %eax,%eax
+  802ee7:	78 c8                	js     802eb1 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ee9:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802eed:	eb c2                	jmp    802eb1 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802eef:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802ef2:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ef5:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ef8:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802efd:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f04:	00 00 
+  802f06:	eb a9                	jmp    802eb1 <devfile_trunc+0x6a>
+
+0000000000802f08 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802f08:	55                   	push   %rbp
+  802f09:	48 89 e5             	mov    %rsp,%rbp
+  802f0c:	41 57                	push   %r15
+  802f0e:	41 56                	push   %r14
+  802f10:	41 55                	push   %r13
+  802f12:	41 54                	push   %r12
+  802f14:	53                   	push   %rbx
+  802f15:	48 83 ec 28          	sub    $0x28,%rsp
+  802f19:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f1d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f21:	49 89 d7             	mov    %rdx,%r15
+  802f24:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f28:	48 b8 b8 28 80 00 00 	movabs $0x8028b8,%rax
+  802f2f:	00 00 00 
+  802f32:	ff d0                	call   *%rax
+  802f34:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802f37:	48 85 c0             	test   %rax,%rax
+  802f3a:	74 31                	je     802f6d <devfile_write+0x65>
+  802f3c:	4c 89 f8             	mov    %r15,%rax
+  802f3f:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802f46:	77 25                	ja     802f6d <devfile_write+0x65>
+    size_t i = 0;
+  802f48:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802f4e:	48 85 c0             	test   %rax,%rax
+  802f51:	0f 85 64 01 00 00    	jne    8030bb <devfile_write+0x1b3>
+    size_t i = 0;
+  802f57:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802f5b:	4c 89 f8             	mov    %r15,%rax
+}
+  802f5e:	48 83 c4 28          	add    $0x28,%rsp
+  802f62:	5b                   	pop    %rbx
+  802f63:	41 5c                	pop    %r12
+  802f65:	41 5d                	pop    %r13
+  802f67:	41 5e                	pop    %r14
+  802f69:	41 5f                	pop    %r15
+  802f6b:	5d                   	pop    %rbp
+  802f6c:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f6d:	48 85 db             	test   %rbx,%rbx
+  802f70:	74 5b                	je     802fcd <devfile_write+0xc5>
+  802f72:	48 89 de             	mov    %rbx,%rsi
+  802f75:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f79:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  802f80:	00 00 00 
+  802f83:	ff d0                	call   *%rax
+  802f85:	85 c0                	test   %eax,%eax
+  802f87:	78 40                	js     802fc9 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802f89:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f8d:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802f90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802f94:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802f98:	48 b8 d5 2a 80 00 00 	movabs $0x802ad5,%rax
+  802f9f:	00 00 00 
+  802fa2:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802fa4:	48 85 c0             	test   %rax,%rax
+  802fa7:	7e b5                	jle    802f5e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802fa9:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802fad:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802fb0:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802fb3:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802fb6:	8d 51 01             	lea    0x1(%rcx),%edx
+  802fb9:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802fbc:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802fbf:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802fc6:	00 
+  802fc7:	eb 95                	jmp    802f5e <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802fc9:	48 98                	cltq
+  802fcb:	eb 91                	jmp    802f5e <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802fcd:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802fd1:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802fd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fd8:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802fdc:	48 89 df             	mov    %rbx,%rdi
+  802fdf:	48 b8 d5 2a 80 00 00 	movabs $0x802ad5,%rax
+  802fe6:	00 00 00 
+  802fe9:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802feb:	48 85 c0             	test   %rax,%rax
+  802fee:	0f 8e 6a ff ff ff    	jle    802f5e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802ff4:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802ff7:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ffb:	e9 5e ff ff ff       	jmp    802f5e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803000:	48 98                	cltq
+  803002:	4d 85 ff             	test   %r15,%r15
+  803005:	49 0f 45 c7          	cmovne %r15,%rax
+  803009:	e9 50 ff ff ff       	jmp    802f5e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80300e:	48 89 de             	mov    %rbx,%rsi
+  803011:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803015:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  80301c:	00 00 00 
+  80301f:	ff d0                	call   *%rax
+  803021:	85 c0                	test   %eax,%eax
+  803023:	0f 88 2b 01 00 00    	js     803154 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803029:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80302d:	4c 01 f8             	add    %r15,%rax
+  803030:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803034:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803038:	48 b9 e4 20 80 00 00 	movabs $0x8020e4,%rcx
+  80303f:	00 00 00 
+  803042:	ff d1                	call   *%rcx
+  803044:	48 89 c2             	mov    %rax,%rdx
+  803047:	48 c1 e2 04          	shl    $0x4,%rdx
+  80304b:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80304f:	48 c1 e0 0c          	shl    $0xc,%rax
+  803053:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803058:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80305b:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803062:	00 
+  803063:	4c 89 ea             	mov    %r13,%rdx
+  803066:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80306a:	48 b8 96 10 80 00 00 	movabs $0x801096,%rax
+  803071:	00 00 00 
+  803074:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803076:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80307a:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80307e:	48 39 c2             	cmp    %rax,%rdx
+  803081:	0f 84 db 00 00 00    	je     803162 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803087:	4c 39 e2             	cmp    %r12,%rdx
+  80308a:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  80308e:	4d 01 ec             	add    %r13,%r12
+  803091:	49 39 c4             	cmp    %rax,%r12
+  803094:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803098:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  80309c:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  8030a0:	45 01 ee             	add    %r13d,%r14d
+  8030a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030a7:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  8030ab:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  8030ae:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030b2:	49 39 c7             	cmp    %rax,%r15
+  8030b5:	0f 83 a0 fe ff ff    	jae    802f5b <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  8030bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030bf:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  8030c3:	8b 43 08             	mov    0x8(%rbx),%eax
+  8030c6:	44 39 f0             	cmp    %r14d,%eax
+  8030c9:	7f 10                	jg     8030db <devfile_write+0x1d3>
+  8030cb:	48 98                	cltq
+  8030cd:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  8030d3:	49 63 d6             	movslq %r14d,%rdx
+  8030d6:	48 39 d0             	cmp    %rdx,%rax
+  8030d9:	7d 2d                	jge    803108 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8030db:	48 89 de             	mov    %rbx,%rsi
+  8030de:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030e2:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  8030e9:	00 00 00 
+  8030ec:	ff d0                	call   *%rax
+  8030ee:	85 c0                	test   %eax,%eax
+  8030f0:	0f 88 0a ff ff ff    	js     803000 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8030f6:	44 89 f0             	mov    %r14d,%eax
+  8030f9:	66 b8 00 00          	mov    $0x0,%ax
+  8030fd:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803100:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803107:	00 
+        size_t off = pos - fb->fb_base;
+  803108:	45 89 f4             	mov    %r14d,%r12d
+  80310b:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  80310f:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803112:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803116:	4d 29 fd             	sub    %r15,%r13
+  803119:	b8 00 00 01 00       	mov    $0x10000,%eax
+  80311e:	4c 29 e0             	sub    %r12,%rax
+  803121:	49 39 c5             	cmp    %rax,%r13
+  803124:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803128:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80312c:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803130:	48 39 c2             	cmp    %rax,%rdx
+  803133:	0f 84 f0 fe ff ff    	je     803029 <devfile_write+0x121>
+  803139:	4c 39 e0             	cmp    %r12,%rax
+  80313c:	0f 82 cc fe ff ff    	jb     80300e <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803142:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803146:	48 39 d0             	cmp    %rdx,%rax
+  803149:	0f 83 da fe ff ff    	jae    803029 <devfile_write+0x121>
+  80314f:	e9 ba fe ff ff       	jmp    80300e <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803154:	48 98                	cltq
+  803156:	4d 85 ff             	test   %r15,%r15
+  803159:	49 0f 45 c7          	cmovne %r15,%rax
+  80315d:	e9 fc fd ff ff       	jmp    802f5e <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803162:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803166:	4c 89 e2             	mov    %r12,%rdx
+  803169:	e9 2a ff ff ff       	jmp    803098 <devfile_write+0x190>
+
+000000000080316e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80316e:	55                   	push   %rbp
+  80316f:	48 89 e5             	mov    %rsp,%rbp
+  803172:	41 57                	push   %r15
+  803174:	41 56                	push   %r14
+  803176:	41 55                	push   %r13
+  803178:	41 54                	push   %r12
+  80317a:	53                   	push   %rbx
+  80317b:	48 83 ec 28          	sub    $0x28,%rsp
+  80317f:	49 89 ff             	mov    %rdi,%r15
+  803182:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803186:	48 89 d3             	mov    %rdx,%rbx
+  803189:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  80318d:	48 b8 b8 28 80 00 00 	movabs $0x8028b8,%rax
+  803194:	00 00 00 
+  803197:	ff d0                	call   *%rax
+  803199:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  80319c:	48 85 c0             	test   %rax,%rax
+  80319f:	74 0d                	je     8031ae <devfile_read+0x40>
+  8031a1:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8031a8:	0f 86 1a 01 00 00    	jbe    8032c8 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8031ae:	4d 85 e4             	test   %r12,%r12
+  8031b1:	74 1a                	je     8031cd <devfile_read+0x5f>
+  8031b3:	4c 89 e6             	mov    %r12,%rsi
+  8031b6:	4c 89 ff             	mov    %r15,%rdi
+  8031b9:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  8031c0:	00 00 00 
+  8031c3:	ff d0                	call   *%rax
+  8031c5:	85 c0                	test   %eax,%eax
+  8031c7:	0f 88 e8 00 00 00    	js     8032b5 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8031cd:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8031d1:	48 b8 d2 29 80 00 00 	movabs $0x8029d2,%rax
+  8031d8:	00 00 00 
+  8031db:	ff d0                	call   *%rax
+  8031dd:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  8031e0:	48 85 c0             	test   %rax,%rax
+  8031e3:	0f 84 69 02 00 00    	je     803452 <devfile_read+0x2e4>
+    while (i < n) {
+  8031e9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8031ee:	0f 84 ce 00 00 00    	je     8032c2 <devfile_read+0x154>
+    size_t i = 0;
+  8031f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8031f9:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803200:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803204:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803208:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  80320c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803210:	48 29 da             	sub    %rbx,%rdx
+  803213:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803218:	48 39 c2             	cmp    %rax,%rdx
+  80321b:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  80321f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803223:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803227:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80322a:	01 d8                	add    %ebx,%eax
+  80322c:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803230:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803234:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  80323b:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803242:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803249:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80324f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803254:	4c 89 ee             	mov    %r13,%rsi
+  803257:	bf 03 00 00 00       	mov    $0x3,%edi
+  80325c:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  803263:	00 00 00 
+  803266:	ff d0                	call   *%rax
+        if (res < 0)
+  803268:	85 c0                	test   %eax,%eax
+  80326a:	78 4d                	js     8032b9 <devfile_read+0x14b>
+        if (res == 0)
+  80326c:	74 4f                	je     8032bd <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80326e:	4c 63 e0             	movslq %eax,%r12
+  803271:	4c 89 e2             	mov    %r12,%rdx
+  803274:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803278:	4c 89 f7             	mov    %r14,%rdi
+  80327b:	48 b8 96 10 80 00 00 	movabs $0x801096,%rax
+  803282:	00 00 00 
+  803285:	ff d0                	call   *%rax
+        i += res;
+  803287:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  80328a:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  80328d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803291:	48 39 c3             	cmp    %rax,%rbx
+  803294:	0f 82 72 ff ff ff    	jb     80320c <devfile_read+0x9e>
+    return i;
+  80329a:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80329d:	48 85 c0             	test   %rax,%rax
+  8032a0:	7e 04                	jle    8032a6 <devfile_read+0x138>
+  8032a2:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8032a6:	48 83 c4 28          	add    $0x28,%rsp
+  8032aa:	5b                   	pop    %rbx
+  8032ab:	41 5c                	pop    %r12
+  8032ad:	41 5d                	pop    %r13
+  8032af:	41 5e                	pop    %r14
+  8032b1:	41 5f                	pop    %r15
+  8032b3:	5d                   	pop    %rbp
+  8032b4:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8032b5:	48 98                	cltq
+  8032b7:	eb ed                	jmp    8032a6 <devfile_read+0x138>
+            return res;
+  8032b9:	48 98                	cltq
+  8032bb:	eb e9                	jmp    8032a6 <devfile_read+0x138>
+            return i;
+  8032bd:	48 89 d8             	mov    %rbx,%rax
+  8032c0:	eb db                	jmp    80329d <devfile_read+0x12f>
+    size_t i = 0;
+  8032c2:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8032c6:	eb d2                	jmp    80329a <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8032c8:	48 89 c6             	mov    %rax,%rsi
+  8032cb:	4c 89 ff             	mov    %r15,%rdi
+  8032ce:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  8032d5:	00 00 00 
+  8032d8:	ff d0                	call   *%rax
+  8032da:	85 c0                	test   %eax,%eax
+  8032dc:	78 40                	js     80331e <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8032de:	4c 89 ff             	mov    %r15,%rdi
+  8032e1:	48 b8 e4 20 80 00 00 	movabs $0x8020e4,%rax
+  8032e8:	00 00 00 
+  8032eb:	ff d0                	call   *%rax
+  8032ed:	48 89 c2             	mov    %rax,%rdx
+  8032f0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8032f4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8032f8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8032fc:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803301:	48 01 d0             	add    %rdx,%rax
+  803304:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803308:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80330d:	0f 84 33 01 00 00    	je     803446 <devfile_read+0x2d8>
+    size_t i = 0;
+  803313:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803319:	e9 f5 00 00 00       	jmp    803413 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80331e:	48 98                	cltq
+  803320:	eb 84                	jmp    8032a6 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803322:	44 89 e8             	mov    %r13d,%eax
+  803325:	66 b8 00 00          	mov    $0x0,%ax
+  803329:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  80332e:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803335:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803337:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80333b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80333f:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803341:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803346:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803349:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803350:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803351:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803357:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80335c:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803361:	bf 03 00 00 00       	mov    $0x3,%edi
+  803366:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  80336d:	00 00 00 
+  803370:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803372:	85 c0                	test   %eax,%eax
+  803374:	0f 88 be 00 00 00    	js     803438 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80337a:	48 63 d0             	movslq %eax,%rdx
+  80337d:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803382:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803387:	44 39 e8             	cmp    %r13d,%eax
+  80338a:	0f 8e ba 00 00 00    	jle    80344a <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803390:	49 63 c5             	movslq %r13d,%rax
+  803393:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803398:	48 29 c3             	sub    %rax,%rbx
+  80339b:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8033a0:	48 01 c3             	add    %rax,%rbx
+  8033a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033a7:	4c 29 f0             	sub    %r14,%rax
+  8033aa:	48 39 c3             	cmp    %rax,%rbx
+  8033ad:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8033b1:	4c 89 ff             	mov    %r15,%rdi
+  8033b4:	48 b9 e4 20 80 00 00 	movabs $0x8020e4,%rcx
+  8033bb:	00 00 00 
+  8033be:	ff d1                	call   *%rcx
+  8033c0:	48 89 c2             	mov    %rax,%rdx
+  8033c3:	48 c1 e2 04          	shl    $0x4,%rdx
+  8033c7:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8033cb:	48 c1 e0 0c          	shl    $0xc,%rax
+  8033cf:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8033d4:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8033d7:	44 89 ea             	mov    %r13d,%edx
+  8033da:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8033df:	48 63 d2             	movslq %edx,%rdx
+  8033e2:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8033e9:	00 
+  8033ea:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8033ee:	4c 01 f7             	add    %r14,%rdi
+  8033f1:	48 89 da             	mov    %rbx,%rdx
+  8033f4:	48 b9 96 10 80 00 00 	movabs $0x801096,%rcx
+  8033fb:	00 00 00 
+  8033fe:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803400:	41 01 dd             	add    %ebx,%r13d
+  803403:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803407:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80340a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80340e:	49 39 c6             	cmp    %rax,%r14
+  803411:	73 37                	jae    80344a <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803413:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803417:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80341c:	44 39 e8             	cmp    %r13d,%eax
+  80341f:	0f 8f fd fe ff ff    	jg     803322 <devfile_read+0x1b4>
+  803425:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80342a:	44 39 e8             	cmp    %r13d,%eax
+  80342d:	0f 8f 5d ff ff ff    	jg     803390 <devfile_read+0x222>
+  803433:	e9 ea fe ff ff       	jmp    803322 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803438:	48 98                	cltq
+  80343a:	4d 85 f6             	test   %r14,%r14
+  80343d:	49 0f 45 c6          	cmovne %r14,%rax
+  803441:	e9 60 fe ff ff       	jmp    8032a6 <devfile_read+0x138>
+    size_t i = 0;
+  803446:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80344a:	4c 89 f0             	mov    %r14,%rax
+  80344d:	e9 54 fe ff ff       	jmp    8032a6 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803452:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803459:	e9 48 fe ff ff       	jmp    8032a6 <devfile_read+0x138>
+
+000000000080345e <open>:
+open(const char *path, int mode) {
+  80345e:	55                   	push   %rbp
+  80345f:	48 89 e5             	mov    %rsp,%rbp
+  803462:	41 55                	push   %r13
+  803464:	41 54                	push   %r12
+  803466:	53                   	push   %rbx
+  803467:	48 83 ec 18          	sub    $0x18,%rsp
+  80346b:	49 89 fc             	mov    %rdi,%r12
+  80346e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803471:	48 b8 63 0c 80 00 00 	movabs $0x800c63,%rax
+  803478:	00 00 00 
+  80347b:	ff d0                	call   *%rax
+  80347d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803483:	0f 87 8a 00 00 00    	ja     803513 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803489:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80348d:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  803494:	00 00 00 
+  803497:	ff d0                	call   *%rax
+  803499:	89 c3                	mov    %eax,%ebx
+  80349b:	85 c0                	test   %eax,%eax
+  80349d:	78 50                	js     8034ef <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80349f:	4c 89 e6             	mov    %r12,%rsi
+  8034a2:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8034a9:	00 00 00 
+  8034ac:	48 89 df             	mov    %rbx,%rdi
+  8034af:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  8034b6:	00 00 00 
+  8034b9:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8034bb:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8034c2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8034c6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034cb:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  8034d2:	00 00 00 
+  8034d5:	ff d0                	call   *%rax
+  8034d7:	89 c3                	mov    %eax,%ebx
+  8034d9:	85 c0                	test   %eax,%eax
+  8034db:	78 1f                	js     8034fc <open+0x9e>
+    return fd2num(fd);
+  8034dd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034e1:	48 b8 e4 20 80 00 00 	movabs $0x8020e4,%rax
+  8034e8:	00 00 00 
+  8034eb:	ff d0                	call   *%rax
+  8034ed:	89 c3                	mov    %eax,%ebx
+}
+  8034ef:	89 d8                	mov    %ebx,%eax
+  8034f1:	48 83 c4 18          	add    $0x18,%rsp
+  8034f5:	5b                   	pop    %rbx
+  8034f6:	41 5c                	pop    %r12
+  8034f8:	41 5d                	pop    %r13
+  8034fa:	5d                   	pop    %rbp
+  8034fb:	c3                   	ret
+        fd_close(fd, 0);
+  8034fc:	be 00 00 00 00       	mov    $0x0,%esi
+  803501:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803505:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  80350c:	00 00 00 
+  80350f:	ff d0                	call   *%rax
+        return res;
+  803511:	eb dc                	jmp    8034ef <open+0x91>
+        return -E_BAD_PATH;
+  803513:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803518:	eb d5                	jmp    8034ef <open+0x91>
+
+000000000080351a <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80351a:	55                   	push   %rbp
+  80351b:	48 89 e5             	mov    %rsp,%rbp
+  80351e:	41 57                	push   %r15
+  803520:	41 56                	push   %r14
+  803522:	41 55                	push   %r13
+  803524:	41 54                	push   %r12
+  803526:	53                   	push   %rbx
+  803527:	48 83 ec 18          	sub    $0x18,%rsp
+  80352b:	41 89 f6             	mov    %esi,%r14d
+  80352e:	49 89 d7             	mov    %rdx,%r15
+  803531:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803534:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803538:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803544:	85 c0                	test   %eax,%eax
+  803546:	0f 88 db 00 00 00    	js     803627 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80354c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803550:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803557:	00 00 00 
+  80355a:	8b 00                	mov    (%rax),%eax
+  80355c:	39 07                	cmp    %eax,(%rdi)
+  80355e:	0f 85 db 00 00 00    	jne    80363f <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803564:	45 85 f6             	test   %r14d,%r14d
+  803567:	0f 88 db 00 00 00    	js     803648 <fmap+0x12e>
+  80356d:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803574:	0f 85 d7 00 00 00    	jne    803651 <fmap+0x137>
+  80357a:	4c 89 fb             	mov    %r15,%rbx
+  80357d:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803583:	0f 85 d1 00 00 00    	jne    80365a <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803589:	48 b8 aa 2c 80 00 00 	movabs $0x802caa,%rax
+  803590:	00 00 00 
+  803593:	ff d0                	call   *%rax
+  803595:	85 c0                	test   %eax,%eax
+  803597:	0f 88 8e 00 00 00    	js     80362b <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80359d:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8035a4:	00 00 00 
+    while (i < n) {
+  8035a7:	4d 85 ed             	test   %r13,%r13
+  8035aa:	0f 84 8a 00 00 00    	je     80363a <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8035b0:	4c 89 ea             	mov    %r13,%rdx
+  8035b3:	48 29 da             	sub    %rbx,%rdx
+  8035b6:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8035bd:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8035c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8035c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035cb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035ce:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8035d2:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8035d6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8035db:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8035e0:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8035e4:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8035e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035ed:	4c 89 e6             	mov    %r12,%rsi
+  8035f0:	bf 09 00 00 00       	mov    $0x9,%edi
+  8035f5:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  8035fc:	00 00 00 
+  8035ff:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803601:	85 c0                	test   %eax,%eax
+  803603:	78 2a                	js     80362f <fmap+0x115>
+        i += res;
+  803605:	48 98                	cltq
+  803607:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80360a:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  80360e:	72 05                	jb     803615 <fmap+0xfb>
+    while (i < n) {
+  803610:	4c 39 eb             	cmp    %r13,%rbx
+  803613:	72 9b                	jb     8035b0 <fmap+0x96>
+    }
+    return i;
+  803615:	48 89 d8             	mov    %rbx,%rax
+}
+  803618:	48 83 c4 18          	add    $0x18,%rsp
+  80361c:	5b                   	pop    %rbx
+  80361d:	41 5c                	pop    %r12
+  80361f:	41 5d                	pop    %r13
+  803621:	41 5e                	pop    %r14
+  803623:	41 5f                	pop    %r15
+  803625:	5d                   	pop    %rbp
+  803626:	c3                   	ret
+    if (res < 0) return res;
+  803627:	48 98                	cltq
+  803629:	eb ed                	jmp    803618 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80362b:	48 98                	cltq
+  80362d:	eb e9                	jmp    803618 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  80362f:	48 98                	cltq
+  803631:	48 85 db             	test   %rbx,%rbx
+  803634:	48 0f 45 c3          	cmovne %rbx,%rax
+  803638:	eb de                	jmp    803618 <fmap+0xfe>
+    size_t i = 0;
+  80363a:	4c 89 eb             	mov    %r13,%rbx
+  80363d:	eb d6                	jmp    803615 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80363f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803646:	eb d0                	jmp    803618 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803648:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80364f:	eb c7                	jmp    803618 <fmap+0xfe>
+  803651:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803658:	eb be                	jmp    803618 <fmap+0xfe>
+  80365a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803661:	eb b5                	jmp    803618 <fmap+0xfe>
+
+0000000000803663 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803663:	55                   	push   %rbp
+  803664:	48 89 e5             	mov    %rsp,%rbp
+  803667:	41 56                	push   %r14
+  803669:	41 55                	push   %r13
+  80366b:	41 54                	push   %r12
+  80366d:	53                   	push   %rbx
+  80366e:	48 83 ec 10          	sub    $0x10,%rsp
+  803672:	89 fb                	mov    %edi,%ebx
+  803674:	41 89 f4             	mov    %esi,%r12d
+  803677:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80367a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80367e:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  803685:	00 00 00 
+  803688:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80368a:	85 c0                	test   %eax,%eax
+  80368c:	78 63                	js     8036f1 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80368e:	45 85 e4             	test   %r12d,%r12d
+  803691:	0f 88 80 00 00 00    	js     803717 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803697:	45 89 e6             	mov    %r12d,%r14d
+  80369a:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8036a1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036a5:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+  8036b1:	48 89 c2             	mov    %rax,%rdx
+  8036b4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036b9:	44 89 f6             	mov    %r14d,%esi
+  8036bc:	89 df                	mov    %ebx,%edi
+  8036be:	48 b8 1a 35 80 00 00 	movabs $0x80351a,%rax
+  8036c5:	00 00 00 
+  8036c8:	ff d0                	call   *%rax
+  8036ca:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8036cd:	45 29 f4             	sub    %r14d,%r12d
+  8036d0:	4d 63 f4             	movslq %r12d,%r14
+  8036d3:	49 39 c6             	cmp    %rax,%r14
+  8036d6:	7c 1d                	jl     8036f5 <read_map+0x92>
+  8036d8:	48 85 c0             	test   %rax,%rax
+  8036db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e0:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8036e4:	48 83 c4 10          	add    $0x10,%rsp
+  8036e8:	5b                   	pop    %rbx
+  8036e9:	41 5c                	pop    %r12
+  8036eb:	41 5d                	pop    %r13
+  8036ed:	41 5e                	pop    %r14
+  8036ef:	5d                   	pop    %rbp
+  8036f0:	c3                   	ret
+    if (res < 0) return res;
+  8036f1:	48 98                	cltq
+  8036f3:	eb ef                	jmp    8036e4 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8036f5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036f9:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  803700:	00 00 00 
+  803703:	ff d0                	call   *%rax
+  803705:	4d 63 e4             	movslq %r12d,%r12
+  803708:	4c 01 e0             	add    %r12,%rax
+  80370b:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  80370f:	48 89 d8             	mov    %rbx,%rax
+  803712:	4c 29 f0             	sub    %r14,%rax
+  803715:	eb cd                	jmp    8036e4 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803717:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80371e:	eb c4                	jmp    8036e4 <read_map+0x81>
+
+0000000000803720 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803720:	55                   	push   %rbp
+  803721:	48 89 e5             	mov    %rsp,%rbp
+  803724:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803728:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80372c:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  803733:	00 00 00 
+  803736:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803738:	85 c0                	test   %eax,%eax
+  80373a:	78 4a                	js     803786 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80373c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803740:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803747:	00 00 00 
+  80374a:	8b 00                	mov    (%rax),%eax
+  80374c:	39 07                	cmp    %eax,(%rdi)
+  80374e:	75 38                	jne    803788 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803750:	48 b8 aa 2c 80 00 00 	movabs $0x802caa,%rax
+  803757:	00 00 00 
+  80375a:	ff d0                	call   *%rax
+  80375c:	85 c0                	test   %eax,%eax
+  80375e:	78 26                	js     803786 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803760:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803764:	8b 40 0c             	mov    0xc(%rax),%eax
+  803767:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80376e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803770:	be 00 00 00 00       	mov    $0x0,%esi
+  803775:	bf 06 00 00 00       	mov    $0x6,%edi
+  80377a:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  803781:	00 00 00 
+  803784:	ff d0                	call   *%rax
+}
+  803786:	c9                   	leave
+  803787:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803788:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80378d:	eb f7                	jmp    803786 <fsync+0x66>
+
+000000000080378f <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80378f:	55                   	push   %rbp
+  803790:	48 89 e5             	mov    %rsp,%rbp
+  803793:	41 57                	push   %r15
+  803795:	41 56                	push   %r14
+  803797:	41 55                	push   %r13
+  803799:	41 54                	push   %r12
+  80379b:	53                   	push   %rbx
+  80379c:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8037a0:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8037a7:	00 00 00 
+  8037aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8037af:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8037b5:	49 bd 72 21 80 00 00 	movabs $0x802172,%r13
+  8037bc:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8037bf:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8037c6:	00 00 00 
+  8037c9:	eb 0c                	jmp    8037d7 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8037cb:	83 c3 01             	add    $0x1,%ebx
+  8037ce:	49 83 c4 28          	add    $0x28,%r12
+  8037d2:	83 fb 20             	cmp    $0x20,%ebx
+  8037d5:	74 33                	je     80380a <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8037d7:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8037dc:	74 ed                	je     8037cb <flushall+0x3c>
+  8037de:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8037e2:	89 df                	mov    %ebx,%edi
+  8037e4:	41 ff d5             	call   *%r13
+  8037e7:	85 c0                	test   %eax,%eax
+  8037e9:	78 e0                	js     8037cb <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8037eb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8037ef:	41 8b 06             	mov    (%r14),%eax
+  8037f2:	39 07                	cmp    %eax,(%rdi)
+  8037f4:	75 d5                	jne    8037cb <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8037f6:	48 b8 aa 2c 80 00 00 	movabs $0x802caa,%rax
+  8037fd:	00 00 00 
+  803800:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803802:	85 c0                	test   %eax,%eax
+  803804:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803808:	eb c1                	jmp    8037cb <flushall+0x3c>
+    }
+    return res;
+}
+  80380a:	44 89 f8             	mov    %r15d,%eax
+  80380d:	48 83 c4 18          	add    $0x18,%rsp
+  803811:	5b                   	pop    %rbx
+  803812:	41 5c                	pop    %r12
+  803814:	41 5d                	pop    %r13
+  803816:	41 5e                	pop    %r14
+  803818:	41 5f                	pop    %r15
+  80381a:	5d                   	pop    %rbp
+  80381b:	c3                   	ret
+
+000000000080381c <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80381c:	55                   	push   %rbp
+  80381d:	48 89 e5             	mov    %rsp,%rbp
+  803820:	53                   	push   %rbx
+  803821:	48 83 ec 08          	sub    $0x8,%rsp
+  803825:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803828:	40 0f b6 c6          	movzbl %sil,%eax
+  80382c:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803833:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803835:	be 00 00 00 00       	mov    $0x0,%esi
+  80383a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80383f:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  803846:	00 00 00 
+  803849:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80384b:	85 c0                	test   %eax,%eax
+  80384d:	78 23                	js     803872 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80384f:	ba 58 06 00 00       	mov    $0x658,%edx
+  803854:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80385b:	00 00 00 
+  80385e:	48 89 df             	mov    %rbx,%rdi
+  803861:	48 b8 96 10 80 00 00 	movabs $0x801096,%rax
+  803868:	00 00 00 
+  80386b:	ff d0                	call   *%rax
+    return 0;
+  80386d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803872:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803876:	c9                   	leave
+  803877:	c3                   	ret
+
+0000000000803878 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803878:	55                   	push   %rbp
+  803879:	48 89 e5             	mov    %rsp,%rbp
+  80387c:	53                   	push   %rbx
+  80387d:	48 83 ec 08          	sub    $0x8,%rsp
+  803881:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803884:	48 b8 63 0c 80 00 00 	movabs $0x800c63,%rax
+  80388b:	00 00 00 
+  80388e:	ff d0                	call   *%rax
+  803890:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803896:	77 35                	ja     8038cd <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803898:	48 89 de             	mov    %rbx,%rsi
+  80389b:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8038a2:	00 00 00 
+  8038a5:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  8038ac:	00 00 00 
+  8038af:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8038b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8038b6:	bf 07 00 00 00       	mov    $0x7,%edi
+  8038bb:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  8038c2:	00 00 00 
+  8038c5:	ff d0                	call   *%rax
+}
+  8038c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038cb:	c9                   	leave
+  8038cc:	c3                   	ret
+        return -E_BAD_PATH;
+  8038cd:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8038d2:	eb f3                	jmp    8038c7 <remove+0x4f>
+
+00000000008038d4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8038d4:	55                   	push   %rbp
+  8038d5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8038d8:	48 b8 8f 37 80 00 00 	movabs $0x80378f,%rax
+  8038df:	00 00 00 
+  8038e2:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8038e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8038e9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8038ee:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  8038f5:	00 00 00 
+  8038f8:	ff d0                	call   *%rax
+}
+  8038fa:	5d                   	pop    %rbp
+  8038fb:	c3                   	ret
+
+00000000008038fc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8038fc:	55                   	push   %rbp
+  8038fd:	48 89 e5             	mov    %rsp,%rbp
+  803900:	41 54                	push   %r12
+  803902:	53                   	push   %rbx
+  803903:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803906:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  80390d:	00 00 00 
+  803910:	ff d0                	call   *%rax
+  803912:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803915:	48 be a0 57 80 00 00 	movabs $0x8057a0,%rsi
+  80391c:	00 00 00 
+  80391f:	48 89 df             	mov    %rbx,%rdi
+  803922:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  803929:	00 00 00 
+  80392c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80392e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803933:	41 2b 04 24          	sub    (%r12),%eax
+  803937:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80393d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803944:	00 00 00 
+    stat->st_dev = &devpipe;
+  803947:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80394e:	00 00 00 
+  803951:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395d:	5b                   	pop    %rbx
+  80395e:	41 5c                	pop    %r12
+  803960:	5d                   	pop    %rbp
+  803961:	c3                   	ret
+
+0000000000803962 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803962:	55                   	push   %rbp
+  803963:	48 89 e5             	mov    %rsp,%rbp
+  803966:	41 54                	push   %r12
+  803968:	53                   	push   %rbx
+  803969:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80396c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803971:	48 89 fe             	mov    %rdi,%rsi
+  803974:	bf 00 00 00 00       	mov    $0x0,%edi
+  803979:	49 bc e0 15 80 00 00 	movabs $0x8015e0,%r12
+  803980:	00 00 00 
+  803983:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803986:	48 89 df             	mov    %rbx,%rdi
+  803989:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  803990:	00 00 00 
+  803993:	ff d0                	call   *%rax
+  803995:	48 89 c6             	mov    %rax,%rsi
+  803998:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80399d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039a2:	41 ff d4             	call   *%r12
+}
+  8039a5:	5b                   	pop    %rbx
+  8039a6:	41 5c                	pop    %r12
+  8039a8:	5d                   	pop    %rbp
+  8039a9:	c3                   	ret
+
+00000000008039aa <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039aa:	55                   	push   %rbp
+  8039ab:	48 89 e5             	mov    %rsp,%rbp
+  8039ae:	41 57                	push   %r15
+  8039b0:	41 56                	push   %r14
+  8039b2:	41 55                	push   %r13
+  8039b4:	41 54                	push   %r12
+  8039b6:	53                   	push   %rbx
+  8039b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8039bb:	49 89 fc             	mov    %rdi,%r12
+  8039be:	49 89 f5             	mov    %rsi,%r13
+  8039c1:	49 89 d7             	mov    %rdx,%r15
+  8039c4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039c8:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  8039cf:	00 00 00 
+  8039d2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8039d4:	4d 85 ff             	test   %r15,%r15
+  8039d7:	0f 84 af 00 00 00    	je     803a8c <devpipe_write+0xe2>
+  8039dd:	48 89 c3             	mov    %rax,%rbx
+  8039e0:	4c 89 f8             	mov    %r15,%rax
+  8039e3:	4d 89 ef             	mov    %r13,%r15
+  8039e6:	4c 01 e8             	add    %r13,%rax
+  8039e9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039ed:	49 bd d5 13 80 00 00 	movabs $0x8013d5,%r13
+  8039f4:	00 00 00 
+            sys_yield();
+  8039f7:	49 be 72 13 80 00 00 	movabs $0x801372,%r14
+  8039fe:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a01:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a04:	48 63 ce             	movslq %esi,%rcx
+  803a07:	48 63 03             	movslq (%rbx),%rax
+  803a0a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a10:	48 39 c1             	cmp    %rax,%rcx
+  803a13:	72 2e                	jb     803a43 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a15:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a1a:	48 89 da             	mov    %rbx,%rdx
+  803a1d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a22:	4c 89 e7             	mov    %r12,%rdi
+  803a25:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803a28:	85 c0                	test   %eax,%eax
+  803a2a:	74 66                	je     803a92 <devpipe_write+0xe8>
+            sys_yield();
+  803a2c:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a2f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a32:	48 63 ce             	movslq %esi,%rcx
+  803a35:	48 63 03             	movslq (%rbx),%rax
+  803a38:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a3e:	48 39 c1             	cmp    %rax,%rcx
+  803a41:	73 d2                	jae    803a15 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a43:	41 0f b6 3f          	movzbl (%r15),%edi
+  803a47:	48 89 ca             	mov    %rcx,%rdx
+  803a4a:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a4e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803a55:	08 10 20 
+  803a58:	48 f7 e2             	mul    %rdx
+  803a5b:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a5f:	48 89 d0             	mov    %rdx,%rax
+  803a62:	48 c1 e0 09          	shl    $0x9,%rax
+  803a66:	48 29 d0             	sub    %rdx,%rax
+  803a69:	48 c1 e0 03          	shl    $0x3,%rax
+  803a6d:	48 29 c1             	sub    %rax,%rcx
+  803a70:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803a75:	83 c6 01             	add    $0x1,%esi
+  803a78:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a7b:	49 83 c7 01          	add    $0x1,%r15
+  803a7f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a83:	49 39 c7             	cmp    %rax,%r15
+  803a86:	0f 85 75 ff ff ff    	jne    803a01 <devpipe_write+0x57>
+    return n;
+  803a8c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a90:	eb 05                	jmp    803a97 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a97:	48 83 c4 18          	add    $0x18,%rsp
+  803a9b:	5b                   	pop    %rbx
+  803a9c:	41 5c                	pop    %r12
+  803a9e:	41 5d                	pop    %r13
+  803aa0:	41 5e                	pop    %r14
+  803aa2:	41 5f                	pop    %r15
+  803aa4:	5d                   	pop    %rbp
+  803aa5:	c3                   	ret
+
+0000000000803aa6 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803aa6:	55                   	push   %rbp
+  803aa7:	48 89 e5             	mov    %rsp,%rbp
+  803aaa:	41 57                	push   %r15
+  803aac:	41 56                	push   %r14
+  803aae:	41 55                	push   %r13
+  803ab0:	41 54                	push   %r12
+  803ab2:	53                   	push   %rbx
+  803ab3:	48 83 ec 18          	sub    $0x18,%rsp
+  803ab7:	49 89 fc             	mov    %rdi,%r12
+  803aba:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803abe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ac2:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  803ac9:	00 00 00 
+  803acc:	ff d0                	call   *%rax
+  803ace:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ad1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ad7:	49 bd d5 13 80 00 00 	movabs $0x8013d5,%r13
+  803ade:	00 00 00 
+            sys_yield();
+  803ae1:	49 be 72 13 80 00 00 	movabs $0x801372,%r14
+  803ae8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803aeb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803af0:	74 7d                	je     803b6f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803af2:	8b 03                	mov    (%rbx),%eax
+  803af4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803af7:	75 26                	jne    803b1f <devpipe_read+0x79>
+            if (i > 0) return i;
+  803af9:	4d 85 ff             	test   %r15,%r15
+  803afc:	75 77                	jne    803b75 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803afe:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b03:	48 89 da             	mov    %rbx,%rdx
+  803b06:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b0b:	4c 89 e7             	mov    %r12,%rdi
+  803b0e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b11:	85 c0                	test   %eax,%eax
+  803b13:	74 72                	je     803b87 <devpipe_read+0xe1>
+            sys_yield();
+  803b15:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b18:	8b 03                	mov    (%rbx),%eax
+  803b1a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b1d:	74 df                	je     803afe <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b1f:	48 63 c8             	movslq %eax,%rcx
+  803b22:	48 89 ca             	mov    %rcx,%rdx
+  803b25:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b29:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803b30:	08 10 20 
+  803b33:	48 89 d0             	mov    %rdx,%rax
+  803b36:	48 f7 e6             	mul    %rsi
+  803b39:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b3d:	48 89 d0             	mov    %rdx,%rax
+  803b40:	48 c1 e0 09          	shl    $0x9,%rax
+  803b44:	48 29 d0             	sub    %rdx,%rax
+  803b47:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803b4e:	00 
+  803b4f:	48 89 c8             	mov    %rcx,%rax
+  803b52:	48 29 d0             	sub    %rdx,%rax
+  803b55:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803b5a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b5e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803b62:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b65:	49 83 c7 01          	add    $0x1,%r15
+  803b69:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803b6d:	75 83                	jne    803af2 <devpipe_read+0x4c>
+    return n;
+  803b6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b73:	eb 03                	jmp    803b78 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803b75:	4c 89 f8             	mov    %r15,%rax
+}
+  803b78:	48 83 c4 18          	add    $0x18,%rsp
+  803b7c:	5b                   	pop    %rbx
+  803b7d:	41 5c                	pop    %r12
+  803b7f:	41 5d                	pop    %r13
+  803b81:	41 5e                	pop    %r14
+  803b83:	41 5f                	pop    %r15
+  803b85:	5d                   	pop    %rbp
+  803b86:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803b87:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b8c:	eb ea                	jmp    803b78 <devpipe_read+0xd2>
+
+0000000000803b8e <pipe>:
+pipe(int pfd[2]) {
+  803b8e:	55                   	push   %rbp
+  803b8f:	48 89 e5             	mov    %rsp,%rbp
+  803b92:	41 55                	push   %r13
+  803b94:	41 54                	push   %r12
+  803b96:	53                   	push   %rbx
+  803b97:	48 83 ec 18          	sub    $0x18,%rsp
+  803b9b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b9e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ba2:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  803ba9:	00 00 00 
+  803bac:	ff d0                	call   *%rax
+  803bae:	89 c3                	mov    %eax,%ebx
+  803bb0:	85 c0                	test   %eax,%eax
+  803bb2:	0f 88 a0 01 00 00    	js     803d58 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803bb8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bbd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bc2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803bc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bcb:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  803bd2:	00 00 00 
+  803bd5:	ff d0                	call   *%rax
+  803bd7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bd9:	85 c0                	test   %eax,%eax
+  803bdb:	0f 88 77 01 00 00    	js     803d58 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803be1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803be5:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  803bec:	00 00 00 
+  803bef:	ff d0                	call   *%rax
+  803bf1:	89 c3                	mov    %eax,%ebx
+  803bf3:	85 c0                	test   %eax,%eax
+  803bf5:	0f 88 43 01 00 00    	js     803d3e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803bfb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c05:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c09:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c0e:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  803c15:	00 00 00 
+  803c18:	ff d0                	call   *%rax
+  803c1a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c1c:	85 c0                	test   %eax,%eax
+  803c1e:	0f 88 1a 01 00 00    	js     803d3e <pipe+0x1b0>
+    va = fd2data(fd0);
+  803c24:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c28:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  803c2f:	00 00 00 
+  803c32:	ff d0                	call   *%rax
+  803c34:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c37:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c3c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c41:	48 89 c6             	mov    %rax,%rsi
+  803c44:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c49:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  803c50:	00 00 00 
+  803c53:	ff d0                	call   *%rax
+  803c55:	89 c3                	mov    %eax,%ebx
+  803c57:	85 c0                	test   %eax,%eax
+  803c59:	0f 88 c5 00 00 00    	js     803d24 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c5f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c63:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  803c6a:	00 00 00 
+  803c6d:	ff d0                	call   *%rax
+  803c6f:	48 89 c1             	mov    %rax,%rcx
+  803c72:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c78:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803c7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c83:	4c 89 ee             	mov    %r13,%rsi
+  803c86:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c8b:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  803c92:	00 00 00 
+  803c95:	ff d0                	call   *%rax
+  803c97:	89 c3                	mov    %eax,%ebx
+  803c99:	85 c0                	test   %eax,%eax
+  803c9b:	78 6e                	js     803d0b <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c9d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ca2:	4c 89 ef             	mov    %r13,%rdi
+  803ca5:	48 b8 a3 13 80 00 00 	movabs $0x8013a3,%rax
+  803cac:	00 00 00 
+  803caf:	ff d0                	call   *%rax
+  803cb1:	83 f8 02             	cmp    $0x2,%eax
+  803cb4:	0f 85 ab 00 00 00    	jne    803d65 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803cba:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803cc1:	00 00 
+  803cc3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cc7:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803cc9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ccd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803cd4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803cd8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803cda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cde:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803ce5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ce9:	48 bb e4 20 80 00 00 	movabs $0x8020e4,%rbx
+  803cf0:	00 00 00 
+  803cf3:	ff d3                	call   *%rbx
+  803cf5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803cf9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803cfd:	ff d3                	call   *%rbx
+  803cff:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d09:	eb 4d                	jmp    803d58 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d10:	4c 89 ee             	mov    %r13,%rsi
+  803d13:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d18:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  803d1f:	00 00 00 
+  803d22:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d24:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d29:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d32:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  803d39:	00 00 00 
+  803d3c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d43:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d47:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d4c:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  803d53:	00 00 00 
+  803d56:	ff d0                	call   *%rax
+}
+  803d58:	89 d8                	mov    %ebx,%eax
+  803d5a:	48 83 c4 18          	add    $0x18,%rsp
+  803d5e:	5b                   	pop    %rbx
+  803d5f:	41 5c                	pop    %r12
+  803d61:	41 5d                	pop    %r13
+  803d63:	5d                   	pop    %rbp
+  803d64:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d65:	48 b9 b8 57 80 00 00 	movabs $0x8057b8,%rcx
+  803d6c:	00 00 00 
+  803d6f:	48 ba d8 56 80 00 00 	movabs $0x8056d8,%rdx
+  803d76:	00 00 00 
+  803d79:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803d7e:	48 bf a7 57 80 00 00 	movabs $0x8057a7,%rdi
+  803d85:	00 00 00 
+  803d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d8d:	49 b8 d9 01 80 00 00 	movabs $0x8001d9,%r8
+  803d94:	00 00 00 
+  803d97:	41 ff d0             	call   *%r8
+
+0000000000803d9a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d9a:	55                   	push   %rbp
+  803d9b:	48 89 e5             	mov    %rsp,%rbp
+  803d9e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803da2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803da6:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  803dad:	00 00 00 
+  803db0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803db2:	85 c0                	test   %eax,%eax
+  803db4:	78 35                	js     803deb <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803db6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dba:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  803dc1:	00 00 00 
+  803dc4:	ff d0                	call   *%rax
+  803dc6:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803dc9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803dce:	be 00 10 00 00       	mov    $0x1000,%esi
+  803dd3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dd7:	48 b8 d5 13 80 00 00 	movabs $0x8013d5,%rax
+  803dde:	00 00 00 
+  803de1:	ff d0                	call   *%rax
+  803de3:	85 c0                	test   %eax,%eax
+  803de5:	0f 94 c0             	sete   %al
+  803de8:	0f b6 c0             	movzbl %al,%eax
+}
+  803deb:	c9                   	leave
+  803dec:	c3                   	ret
+
+0000000000803ded <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ded:	48 89 f8             	mov    %rdi,%rax
+  803df0:	48 c1 e8 27          	shr    $0x27,%rax
+  803df4:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803dfb:	7f 00 00 
+  803dfe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e02:	f6 c2 01             	test   $0x1,%dl
+  803e05:	74 6d                	je     803e74 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e07:	48 89 f8             	mov    %rdi,%rax
+  803e0a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e0e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e15:	7f 00 00 
+  803e18:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e1c:	f6 c2 01             	test   $0x1,%dl
+  803e1f:	74 62                	je     803e83 <get_uvpt_entry+0x96>
+  803e21:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e28:	7f 00 00 
+  803e2b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e2f:	f6 c2 80             	test   $0x80,%dl
+  803e32:	75 4f                	jne    803e83 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e34:	48 89 f8             	mov    %rdi,%rax
+  803e37:	48 c1 e8 15          	shr    $0x15,%rax
+  803e3b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e42:	7f 00 00 
+  803e45:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e49:	f6 c2 01             	test   $0x1,%dl
+  803e4c:	74 44                	je     803e92 <get_uvpt_entry+0xa5>
+  803e4e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e55:	7f 00 00 
+  803e58:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e5c:	f6 c2 80             	test   $0x80,%dl
+  803e5f:	75 31                	jne    803e92 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e61:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e65:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e6c:	7f 00 00 
+  803e6f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e73:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e74:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e7b:	7f 00 00 
+  803e7e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e82:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e83:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e8a:	7f 00 00 
+  803e8d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e91:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e92:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e99:	7f 00 00 
+  803e9c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ea0:	c3                   	ret
+
+0000000000803ea1 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803ea1:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ea4:	48 89 f9             	mov    %rdi,%rcx
+  803ea7:	48 c1 e9 27          	shr    $0x27,%rcx
+  803eab:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803eb2:	7f 00 00 
+  803eb5:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803eb9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ec0:	f6 c1 01             	test   $0x1,%cl
+  803ec3:	0f 84 b2 00 00 00    	je     803f7b <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ec9:	48 89 f9             	mov    %rdi,%rcx
+  803ecc:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803ed0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ed7:	7f 00 00 
+  803eda:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ede:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ee5:	40 f6 c6 01          	test   $0x1,%sil
+  803ee9:	0f 84 8c 00 00 00    	je     803f7b <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803eef:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ef6:	7f 00 00 
+  803ef9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803efd:	a8 80                	test   $0x80,%al
+  803eff:	75 7b                	jne    803f7c <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f01:	48 89 f9             	mov    %rdi,%rcx
+  803f04:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f08:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f0f:	7f 00 00 
+  803f12:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f16:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f1d:	40 f6 c6 01          	test   $0x1,%sil
+  803f21:	74 58                	je     803f7b <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803f23:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f2a:	7f 00 00 
+  803f2d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f31:	a8 80                	test   $0x80,%al
+  803f33:	75 6c                	jne    803fa1 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f35:	48 89 f9             	mov    %rdi,%rcx
+  803f38:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803f3c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f43:	7f 00 00 
+  803f46:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f4a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f51:	40 f6 c6 01          	test   $0x1,%sil
+  803f55:	74 24                	je     803f7b <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f57:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f5e:	7f 00 00 
+  803f61:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f65:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f6c:	ff ff 7f 
+  803f6f:	48 21 c8             	and    %rcx,%rax
+  803f72:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f78:	48 09 d0             	or     %rdx,%rax
+}
+  803f7b:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803f7c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f83:	7f 00 00 
+  803f86:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f8a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f91:	ff ff 7f 
+  803f94:	48 21 c8             	and    %rcx,%rax
+  803f97:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803f9d:	48 01 d0             	add    %rdx,%rax
+  803fa0:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803fa1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fa8:	7f 00 00 
+  803fab:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803faf:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fb6:	ff ff 7f 
+  803fb9:	48 21 c8             	and    %rcx,%rax
+  803fbc:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803fc2:	48 01 d0             	add    %rdx,%rax
+  803fc5:	c3                   	ret
+
+0000000000803fc6 <get_prot>:
+
+int
+get_prot(void *va) {
+  803fc6:	55                   	push   %rbp
+  803fc7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fca:	48 b8 ed 3d 80 00 00 	movabs $0x803ded,%rax
+  803fd1:	00 00 00 
+  803fd4:	ff d0                	call   *%rax
+  803fd6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803fd9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803fde:	89 c1                	mov    %eax,%ecx
+  803fe0:	83 c9 04             	or     $0x4,%ecx
+  803fe3:	f6 c2 01             	test   $0x1,%dl
+  803fe6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803fe9:	89 c1                	mov    %eax,%ecx
+  803feb:	83 c9 02             	or     $0x2,%ecx
+  803fee:	f6 c2 02             	test   $0x2,%dl
+  803ff1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803ff4:	89 c1                	mov    %eax,%ecx
+  803ff6:	83 c9 01             	or     $0x1,%ecx
+  803ff9:	48 85 d2             	test   %rdx,%rdx
+  803ffc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803fff:	89 c1                	mov    %eax,%ecx
+  804001:	83 c9 40             	or     $0x40,%ecx
+  804004:	f6 c6 04             	test   $0x4,%dh
+  804007:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80400a:	5d                   	pop    %rbp
+  80400b:	c3                   	ret
+
+000000000080400c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80400c:	55                   	push   %rbp
+  80400d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804010:	48 b8 ed 3d 80 00 00 	movabs $0x803ded,%rax
+  804017:	00 00 00 
+  80401a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80401c:	48 c1 e8 06          	shr    $0x6,%rax
+  804020:	83 e0 01             	and    $0x1,%eax
+}
+  804023:	5d                   	pop    %rbp
+  804024:	c3                   	ret
+
+0000000000804025 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804025:	55                   	push   %rbp
+  804026:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804029:	48 b8 ed 3d 80 00 00 	movabs $0x803ded,%rax
+  804030:	00 00 00 
+  804033:	ff d0                	call   *%rax
+  804035:	83 e0 01             	and    $0x1,%eax
+}
+  804038:	5d                   	pop    %rbp
+  804039:	c3                   	ret
+
+000000000080403a <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  80403a:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804041:	7f 00 00 
+  804044:	a8 01                	test   $0x1,%al
+  804046:	75 06                	jne    80404e <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804048:	b8 00 00 00 00       	mov    $0x0,%eax
+  80404d:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80404e:	55                   	push   %rbp
+  80404f:	48 89 e5             	mov    %rsp,%rbp
+  804052:	41 57                	push   %r15
+  804054:	41 56                	push   %r14
+  804056:	41 55                	push   %r13
+  804058:	41 54                	push   %r12
+  80405a:	53                   	push   %rbx
+  80405b:	48 83 ec 18          	sub    $0x18,%rsp
+  80405f:	49 89 fe             	mov    %rdi,%r14
+  804062:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804065:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80406c:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80406d:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804074:	7f 00 00 
+  804077:	e9 81 00 00 00       	jmp    8040fd <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  80407c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804083:	49 39 dd             	cmp    %rbx,%r13
+  804086:	74 2b                	je     8040b3 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804088:	48 89 d8             	mov    %rbx,%rax
+  80408b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80408f:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804093:	f6 c2 01             	test   $0x1,%dl
+  804096:	74 e4                	je     80407c <foreach_shared_region+0x42>
+  804098:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  80409c:	f6 c4 04             	test   $0x4,%ah
+  80409f:	74 db                	je     80407c <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  8040a1:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040a8:	4c 89 fa             	mov    %r15,%rdx
+  8040ab:	48 89 df             	mov    %rbx,%rdi
+  8040ae:	41 ff d6             	call   *%r14
+  8040b1:	eb c9                	jmp    80407c <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8040b3:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  8040ba:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  8040be:	74 22                	je     8040e2 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  8040c0:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  8040c7:	48 89 d8             	mov    %rbx,%rax
+  8040ca:	48 c1 e8 15          	shr    $0x15,%rax
+  8040ce:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  8040d5:	7f 00 00 
+  8040d8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8040dc:	a8 01                	test   $0x1,%al
+  8040de:	74 d3                	je     8040b3 <foreach_shared_region+0x79>
+  8040e0:	eb a6                	jmp    804088 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8040e2:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  8040e9:	40 
+  8040ea:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8040ee:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040f5:	00 00 00 
+  8040f8:	48 39 c1             	cmp    %rax,%rcx
+  8040fb:	74 31                	je     80412e <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  8040fd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804101:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804105:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  80410c:	7f 00 00 
+  80410f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804113:	a8 01                	test   $0x1,%al
+  804115:	74 cb                	je     8040e2 <foreach_shared_region+0xa8>
+  804117:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80411b:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804122:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804128:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80412c:	eb 92                	jmp    8040c0 <foreach_shared_region+0x86>
+}
+  80412e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804133:	48 83 c4 18          	add    $0x18,%rsp
+  804137:	5b                   	pop    %rbx
+  804138:	41 5c                	pop    %r12
+  80413a:	41 5d                	pop    %r13
+  80413c:	41 5e                	pop    %r14
+  80413e:	41 5f                	pop    %r15
+  804140:	5d                   	pop    %rbp
+  804141:	c3                   	ret
+
+0000000000804142 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804142:	b8 00 00 00 00       	mov    $0x0,%eax
+  804147:	c3                   	ret
+
+0000000000804148 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804148:	55                   	push   %rbp
+  804149:	48 89 e5             	mov    %rsp,%rbp
+  80414c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80414f:	48 be dc 57 80 00 00 	movabs $0x8057dc,%rsi
+  804156:	00 00 00 
+  804159:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  804160:	00 00 00 
+  804163:	ff d0                	call   *%rax
+    return 0;
+}
+  804165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80416a:	5d                   	pop    %rbp
+  80416b:	c3                   	ret
+
+000000000080416c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80416c:	55                   	push   %rbp
+  80416d:	48 89 e5             	mov    %rsp,%rbp
+  804170:	41 57                	push   %r15
+  804172:	41 56                	push   %r14
+  804174:	41 55                	push   %r13
+  804176:	41 54                	push   %r12
+  804178:	53                   	push   %rbx
+  804179:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804180:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804187:	48 85 d2             	test   %rdx,%rdx
+  80418a:	74 7a                	je     804206 <devcons_write+0x9a>
+  80418c:	49 89 d6             	mov    %rdx,%r14
+  80418f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804195:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80419a:	49 bf 2f 10 80 00 00 	movabs $0x80102f,%r15
+  8041a1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8041a4:	4c 89 f3             	mov    %r14,%rbx
+  8041a7:	48 29 f3             	sub    %rsi,%rbx
+  8041aa:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8041af:	48 39 c3             	cmp    %rax,%rbx
+  8041b2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8041b6:	4c 63 eb             	movslq %ebx,%r13
+  8041b9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8041c0:	48 01 c6             	add    %rax,%rsi
+  8041c3:	4c 89 ea             	mov    %r13,%rdx
+  8041c6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041cd:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8041d0:	4c 89 ee             	mov    %r13,%rsi
+  8041d3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041da:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  8041e1:	00 00 00 
+  8041e4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8041e6:	41 01 dc             	add    %ebx,%r12d
+  8041e9:	49 63 f4             	movslq %r12d,%rsi
+  8041ec:	4c 39 f6             	cmp    %r14,%rsi
+  8041ef:	72 b3                	jb     8041a4 <devcons_write+0x38>
+    return res;
+  8041f1:	49 63 c4             	movslq %r12d,%rax
+}
+  8041f4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8041fb:	5b                   	pop    %rbx
+  8041fc:	41 5c                	pop    %r12
+  8041fe:	41 5d                	pop    %r13
+  804200:	41 5e                	pop    %r14
+  804202:	41 5f                	pop    %r15
+  804204:	5d                   	pop    %rbp
+  804205:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804206:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80420c:	eb e3                	jmp    8041f1 <devcons_write+0x85>
+
+000000000080420e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80420e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804211:	ba 00 00 00 00       	mov    $0x0,%edx
+  804216:	48 85 c0             	test   %rax,%rax
+  804219:	74 55                	je     804270 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80421b:	55                   	push   %rbp
+  80421c:	48 89 e5             	mov    %rsp,%rbp
+  80421f:	41 55                	push   %r13
+  804221:	41 54                	push   %r12
+  804223:	53                   	push   %rbx
+  804224:	48 83 ec 08          	sub    $0x8,%rsp
+  804228:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80422b:	48 bb a5 12 80 00 00 	movabs $0x8012a5,%rbx
+  804232:	00 00 00 
+  804235:	49 bc 72 13 80 00 00 	movabs $0x801372,%r12
+  80423c:	00 00 00 
+  80423f:	eb 03                	jmp    804244 <devcons_read+0x36>
+  804241:	41 ff d4             	call   *%r12
+  804244:	ff d3                	call   *%rbx
+  804246:	85 c0                	test   %eax,%eax
+  804248:	74 f7                	je     804241 <devcons_read+0x33>
+    if (c < 0) return c;
+  80424a:	48 63 d0             	movslq %eax,%rdx
+  80424d:	78 13                	js     804262 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80424f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804254:	83 f8 04             	cmp    $0x4,%eax
+  804257:	74 09                	je     804262 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804259:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80425d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804262:	48 89 d0             	mov    %rdx,%rax
+  804265:	48 83 c4 08          	add    $0x8,%rsp
+  804269:	5b                   	pop    %rbx
+  80426a:	41 5c                	pop    %r12
+  80426c:	41 5d                	pop    %r13
+  80426e:	5d                   	pop    %rbp
+  80426f:	c3                   	ret
+  804270:	48 89 d0             	mov    %rdx,%rax
+  804273:	c3                   	ret
+
+0000000000804274 <cputchar>:
+cputchar(int ch) {
+  804274:	55                   	push   %rbp
+  804275:	48 89 e5             	mov    %rsp,%rbp
+  804278:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80427c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804280:	be 01 00 00 00       	mov    $0x1,%esi
+  804285:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804289:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  804290:	00 00 00 
+  804293:	ff d0                	call   *%rax
+}
+  804295:	c9                   	leave
+  804296:	c3                   	ret
+
+0000000000804297 <getchar>:
+getchar(void) {
+  804297:	55                   	push   %rbp
+  804298:	48 89 e5             	mov    %rsp,%rbp
+  80429b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80429f:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042a4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8042a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ad:	48 b8 55 24 80 00 00 	movabs $0x802455,%rax
+  8042b4:	00 00 00 
+  8042b7:	ff d0                	call   *%rax
+  8042b9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8042bb:	85 c0                	test   %eax,%eax
+  8042bd:	78 06                	js     8042c5 <getchar+0x2e>
+  8042bf:	74 08                	je     8042c9 <getchar+0x32>
+  8042c1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8042c5:	89 d0                	mov    %edx,%eax
+  8042c7:	c9                   	leave
+  8042c8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8042c9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8042ce:	eb f5                	jmp    8042c5 <getchar+0x2e>
+
+00000000008042d0 <iscons>:
+iscons(int fdnum) {
+  8042d0:	55                   	push   %rbp
+  8042d1:	48 89 e5             	mov    %rsp,%rbp
+  8042d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8042d8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042dc:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  8042e3:	00 00 00 
+  8042e6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042e8:	85 c0                	test   %eax,%eax
+  8042ea:	78 18                	js     804304 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8042ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042f0:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8042f7:	00 00 00 
+  8042fa:	8b 00                	mov    (%rax),%eax
+  8042fc:	39 02                	cmp    %eax,(%rdx)
+  8042fe:	0f 94 c0             	sete   %al
+  804301:	0f b6 c0             	movzbl %al,%eax
+}
+  804304:	c9                   	leave
+  804305:	c3                   	ret
+
+0000000000804306 <opencons>:
+opencons(void) {
+  804306:	55                   	push   %rbp
+  804307:	48 89 e5             	mov    %rsp,%rbp
+  80430a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80430e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804312:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  804319:	00 00 00 
+  80431c:	ff d0                	call   *%rax
+  80431e:	85 c0                	test   %eax,%eax
+  804320:	78 49                	js     80436b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804322:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804327:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80432c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804330:	bf 00 00 00 00       	mov    $0x0,%edi
+  804335:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  80433c:	00 00 00 
+  80433f:	ff d0                	call   *%rax
+  804341:	85 c0                	test   %eax,%eax
+  804343:	78 26                	js     80436b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804345:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804349:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804350:	00 00 
+  804352:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804354:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804358:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80435f:	48 b8 e4 20 80 00 00 	movabs $0x8020e4,%rax
+  804366:	00 00 00 
+  804369:	ff d0                	call   *%rax
+}
+  80436b:	c9                   	leave
+  80436c:	c3                   	ret
+
+000000000080436d <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80436d:	55                   	push   %rbp
+  80436e:	48 89 e5             	mov    %rsp,%rbp
+  804371:	41 55                	push   %r13
+  804373:	41 54                	push   %r12
+  804375:	53                   	push   %rbx
+  804376:	48 83 ec 08          	sub    $0x8,%rsp
+  80437a:	49 89 fc             	mov    %rdi,%r12
+  80437d:	48 89 f7             	mov    %rsi,%rdi
+  804380:	48 89 d3             	mov    %rdx,%rbx
+  804383:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804386:	48 85 f6             	test   %rsi,%rsi
+  804389:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804390:	00 00 00 
+  804393:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804397:	be 00 10 00 00       	mov    $0x1000,%esi
+  80439c:	48 85 d2             	test   %rdx,%rdx
+  80439f:	74 03                	je     8043a4 <ipc_recv+0x37>
+  8043a1:	48 8b 32             	mov    (%rdx),%rsi
+  8043a4:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  8043ab:	00 00 00 
+  8043ae:	ff d0                	call   *%rax
+    if (errno) {
+  8043b0:	85 c0                	test   %eax,%eax
+  8043b2:	74 1c                	je     8043d0 <ipc_recv+0x63>
+        if (from_env_store)
+  8043b4:	4d 85 e4             	test   %r12,%r12
+  8043b7:	74 08                	je     8043c1 <ipc_recv+0x54>
+            *from_env_store = 0;
+  8043b9:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8043c0:	00 
+
+        if (perm_store)
+  8043c1:	4d 85 ed             	test   %r13,%r13
+  8043c4:	74 74                	je     80443a <ipc_recv+0xcd>
+            *perm_store = 0;
+  8043c6:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8043cd:	00 
+  8043ce:	eb 6a                	jmp    80443a <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8043d0:	4d 85 e4             	test   %r12,%r12
+  8043d3:	74 14                	je     8043e9 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8043d5:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8043dc:	00 00 00 
+  8043df:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8043e5:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  8043e9:	48 85 db             	test   %rbx,%rbx
+  8043ec:	74 23                	je     804411 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8043ee:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8043f5:	00 00 00 
+  8043f8:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8043fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  804403:	85 c9                	test   %ecx,%ecx
+  804405:	74 07                	je     80440e <ipc_recv+0xa1>
+  804407:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80440e:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804411:	4d 85 ed             	test   %r13,%r13
+  804414:	74 14                	je     80442a <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804416:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80441d:	00 00 00 
+  804420:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804426:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  80442a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804431:	00 00 00 
+  804434:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  80443a:	48 83 c4 08          	add    $0x8,%rsp
+  80443e:	5b                   	pop    %rbx
+  80443f:	41 5c                	pop    %r12
+  804441:	41 5d                	pop    %r13
+  804443:	5d                   	pop    %rbp
+  804444:	c3                   	ret
+
+0000000000804445 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804445:	55                   	push   %rbp
+  804446:	48 89 e5             	mov    %rsp,%rbp
+  804449:	41 55                	push   %r13
+  80444b:	41 54                	push   %r12
+  80444d:	53                   	push   %rbx
+  80444e:	48 83 ec 08          	sub    $0x8,%rsp
+  804452:	49 89 fc             	mov    %rdi,%r12
+  804455:	48 89 f7             	mov    %rsi,%rdi
+  804458:	48 89 d3             	mov    %rdx,%rbx
+  80445b:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80445e:	48 85 f6             	test   %rsi,%rsi
+  804461:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804468:	00 00 00 
+  80446b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  80446f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804474:	48 85 d2             	test   %rdx,%rdx
+  804477:	74 03                	je     80447c <ipc_try_recv+0x37>
+  804479:	48 8b 32             	mov    (%rdx),%rsi
+  80447c:	48 b8 17 18 80 00 00 	movabs $0x801817,%rax
+  804483:	00 00 00 
+  804486:	ff d0                	call   *%rax
+    if (errno) {
+  804488:	85 c0                	test   %eax,%eax
+  80448a:	75 75                	jne    804501 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80448c:	4d 85 e4             	test   %r12,%r12
+  80448f:	74 14                	je     8044a5 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804491:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804498:	00 00 00 
+  80449b:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8044a1:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8044a5:	48 85 db             	test   %rbx,%rbx
+  8044a8:	74 23                	je     8044cd <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8044aa:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044b1:	00 00 00 
+  8044b4:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8044ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044bf:	85 c9                	test   %ecx,%ecx
+  8044c1:	74 07                	je     8044ca <ipc_try_recv+0x85>
+  8044c3:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8044ca:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8044cd:	4d 85 ed             	test   %r13,%r13
+  8044d0:	74 14                	je     8044e6 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8044d2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044d9:	00 00 00 
+  8044dc:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8044e2:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8044e6:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044ed:	00 00 00 
+  8044f0:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  8044f6:	48 83 c4 08          	add    $0x8,%rsp
+  8044fa:	5b                   	pop    %rbx
+  8044fb:	41 5c                	pop    %r12
+  8044fd:	41 5d                	pop    %r13
+  8044ff:	5d                   	pop    %rbp
+  804500:	c3                   	ret
+        if (from_env_store)
+  804501:	4d 85 e4             	test   %r12,%r12
+  804504:	74 08                	je     80450e <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804506:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80450d:	00 
+        if (perm_store)
+  80450e:	4d 85 ed             	test   %r13,%r13
+  804511:	74 e3                	je     8044f6 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804513:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80451a:	00 
+  80451b:	eb d9                	jmp    8044f6 <ipc_try_recv+0xb1>
+
+000000000080451d <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80451d:	55                   	push   %rbp
+  80451e:	48 89 e5             	mov    %rsp,%rbp
+  804521:	41 57                	push   %r15
+  804523:	41 56                	push   %r14
+  804525:	41 55                	push   %r13
+  804527:	41 54                	push   %r12
+  804529:	53                   	push   %rbx
+  80452a:	48 83 ec 18          	sub    $0x18,%rsp
+  80452e:	41 89 fd             	mov    %edi,%r13d
+  804531:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804534:	48 89 d3             	mov    %rdx,%rbx
+  804537:	49 89 cc             	mov    %rcx,%r12
+  80453a:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80453e:	48 85 d2             	test   %rdx,%rdx
+  804541:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804548:	00 00 00 
+  80454b:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80454f:	49 be 82 17 80 00 00 	movabs $0x801782,%r14
+  804556:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804559:	49 bf 72 13 80 00 00 	movabs $0x801372,%r15
+  804560:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804563:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804566:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80456a:	4c 89 e1             	mov    %r12,%rcx
+  80456d:	48 89 da             	mov    %rbx,%rdx
+  804570:	44 89 ef             	mov    %r13d,%edi
+  804573:	41 ff d6             	call   *%r14
+  804576:	85 c0                	test   %eax,%eax
+  804578:	74 37                	je     8045b1 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  80457a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80457d:	75 05                	jne    804584 <ipc_send+0x67>
+        sys_yield();
+  80457f:	41 ff d7             	call   *%r15
+  804582:	eb df                	jmp    804563 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804584:	89 c1                	mov    %eax,%ecx
+  804586:	48 ba e8 57 80 00 00 	movabs $0x8057e8,%rdx
+  80458d:	00 00 00 
+  804590:	be 65 00 00 00       	mov    $0x65,%esi
+  804595:	48 bf 03 58 80 00 00 	movabs $0x805803,%rdi
+  80459c:	00 00 00 
+  80459f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a4:	49 b8 d9 01 80 00 00 	movabs $0x8001d9,%r8
+  8045ab:	00 00 00 
+  8045ae:	41 ff d0             	call   *%r8
+    }
+}
+  8045b1:	48 83 c4 18          	add    $0x18,%rsp
+  8045b5:	5b                   	pop    %rbx
+  8045b6:	41 5c                	pop    %r12
+  8045b8:	41 5d                	pop    %r13
+  8045ba:	41 5e                	pop    %r14
+  8045bc:	41 5f                	pop    %r15
+  8045be:	5d                   	pop    %rbp
+  8045bf:	c3                   	ret
+
+00000000008045c0 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8045c0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8045c5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8045cc:	00 00 00 
+  8045cf:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8045d6:	48 01 ca             	add    %rcx,%rdx
+  8045d9:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8045df:	39 fa                	cmp    %edi,%edx
+  8045e1:	74 12                	je     8045f5 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8045e3:	48 83 c0 01          	add    $0x1,%rax
+  8045e7:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8045ed:	75 e0                	jne    8045cf <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8045ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045f4:	c3                   	ret
+            return envs[i].env_id;
+  8045f5:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8045fc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804603:	00 00 00 
+  804606:	48 01 d0             	add    %rdx,%rax
+  804609:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80460f:	c3                   	ret
+
+0000000000804610 <__text_end>:
+  804610:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804617:	00 00 00 
+  80461a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804621:	00 00 00 
+  804624:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462b:	00 00 00 
+  80462e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804635:	00 00 00 
+  804638:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463f:	00 00 00 
+  804642:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804649:	00 00 00 
+  80464c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804653:	00 00 00 
+  804656:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465d:	00 00 00 
+  804660:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804667:	00 00 00 
+  80466a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804671:	00 00 00 
+  804674:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467b:	00 00 00 
+  80467e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804685:	00 00 00 
+  804688:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468f:	00 00 00 
+  804692:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804699:	00 00 00 
+  80469c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a3:	00 00 00 
+  8046a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ad:	00 00 00 
+  8046b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b7:	00 00 00 
+  8046ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c1:	00 00 00 
+  8046c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cb:	00 00 00 
+  8046ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d5:	00 00 00 
+  8046d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046df:	00 00 00 
+  8046e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e9:	00 00 00 
+  8046ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f3:	00 00 00 
+  8046f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fd:	00 00 00 
+  804700:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804707:	00 00 00 
+  80470a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804711:	00 00 00 
+  804714:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471b:	00 00 00 
+  80471e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804725:	00 00 00 
+  804728:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472f:	00 00 00 
+  804732:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804739:	00 00 00 
+  80473c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804743:	00 00 00 
+  804746:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474d:	00 00 00 
+  804750:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804757:	00 00 00 
+  80475a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804761:	00 00 00 
+  804764:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476b:	00 00 00 
+  80476e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804775:	00 00 00 
+  804778:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477f:	00 00 00 
+  804782:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804789:	00 00 00 
+  80478c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804793:	00 00 00 
+  804796:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479d:	00 00 00 
+  8047a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a7:	00 00 00 
+  8047aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b1:	00 00 00 
+  8047b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bb:	00 00 00 
+  8047be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c5:	00 00 00 
+  8047c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cf:	00 00 00 
+  8047d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d9:	00 00 00 
+  8047dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e3:	00 00 00 
+  8047e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ed:	00 00 00 
+  8047f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f7:	00 00 00 
+  8047fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804801:	00 00 00 
+  804804:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480b:	00 00 00 
+  80480e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804815:	00 00 00 
+  804818:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481f:	00 00 00 
+  804822:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804829:	00 00 00 
+  80482c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804833:	00 00 00 
+  804836:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483d:	00 00 00 
+  804840:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804847:	00 00 00 
+  80484a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804851:	00 00 00 
+  804854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485b:	00 00 00 
+  80485e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804865:	00 00 00 
+  804868:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486f:	00 00 00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,8102 @@
+
+obj/user/faultbadhandler:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4e 00 00 00       	call   800071 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * we outrun the stack with invocations of the user-level handler */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  800029:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80002e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800033:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80003a:	00 00 00 
+  80003d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800042:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  800049:	00 00 00 
+  80004c:	ff d0                	call   *%rax
+    sys_env_set_pgfault_upcall(0, (void *)0xDEADBEEF);
+  80004e:	be ef be ad de       	mov    $0xdeadbeef,%esi
+  800053:	bf 00 00 00 00       	mov    $0x0,%edi
+  800058:	48 b8 de 05 80 00 00 	movabs $0x8005de,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800064:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80006b:	00 00 00 00 
+#endif
+}
+  80006f:	5d                   	pop    %rbp
+  800070:	c3                   	ret
+
+0000000000800071 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800071:	55                   	push   %rbp
+  800072:	48 89 e5             	mov    %rsp,%rbp
+  800075:	41 56                	push   %r14
+  800077:	41 55                	push   %r13
+  800079:	41 54                	push   %r12
+  80007b:	53                   	push   %rbx
+  80007c:	41 89 fd             	mov    %edi,%r13d
+  80007f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800082:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800089:	00 00 00 
+  80008c:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800093:	00 00 00 
+  800096:	48 39 c2             	cmp    %rax,%rdx
+  800099:	73 17                	jae    8000b2 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80009b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009e:	49 89 c4             	mov    %rax,%r12
+  8000a1:	48 83 c3 08          	add    $0x8,%rbx
+  8000a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000aa:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ad:	4c 39 e3             	cmp    %r12,%rbx
+  8000b0:	72 ef                	jb     8000a1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000b2:	48 b8 06 02 80 00 00 	movabs $0x800206,%rax
+  8000b9:	00 00 00 
+  8000bc:	ff d0                	call   *%rax
+  8000be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c3:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000ca:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000d1:	00 00 00 
+  8000d4:	48 01 d0             	add    %rdx,%rax
+  8000d7:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000de:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000e1:	45 85 ed             	test   %r13d,%r13d
+  8000e4:	7e 0d                	jle    8000f3 <libmain+0x82>
+  8000e6:	49 8b 06             	mov    (%r14),%rax
+  8000e9:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000f0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f3:	4c 89 f6             	mov    %r14,%rsi
+  8000f6:	44 89 ef             	mov    %r13d,%edi
+  8000f9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800100:	00 00 00 
+  800103:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800105:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  80010c:	00 00 00 
+  80010f:	ff d0                	call   *%rax
+#endif
+}
+  800111:	5b                   	pop    %rbx
+  800112:	41 5c                	pop    %r12
+  800114:	41 5d                	pop    %r13
+  800116:	41 5e                	pop    %r14
+  800118:	5d                   	pop    %rbp
+  800119:	c3                   	ret
+
+000000000080011a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80011a:	55                   	push   %rbp
+  80011b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80011e:	48 b8 02 0f 80 00 00 	movabs $0x800f02,%rax
+  800125:	00 00 00 
+  800128:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80012a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012f:	48 b8 9b 01 80 00 00 	movabs $0x80019b,%rax
+  800136:	00 00 00 
+  800139:	ff d0                	call   *%rax
+}
+  80013b:	5d                   	pop    %rbp
+  80013c:	c3                   	ret
+
+000000000080013d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80013d:	55                   	push   %rbp
+  80013e:	48 89 e5             	mov    %rsp,%rbp
+  800141:	53                   	push   %rbx
+  800142:	48 89 fa             	mov    %rdi,%rdx
+  800145:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800148:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80014d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800152:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800157:	be 00 00 00 00       	mov    $0x0,%esi
+  80015c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800162:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800164:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800168:	c9                   	leave
+  800169:	c3                   	ret
+
+000000000080016a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80016a:	55                   	push   %rbp
+  80016b:	48 89 e5             	mov    %rsp,%rbp
+  80016e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80016f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800174:	ba 00 00 00 00       	mov    $0x0,%edx
+  800179:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80017e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800183:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800188:	be 00 00 00 00       	mov    $0x0,%esi
+  80018d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800193:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800195:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800199:	c9                   	leave
+  80019a:	c3                   	ret
+
+000000000080019b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80019b:	55                   	push   %rbp
+  80019c:	48 89 e5             	mov    %rsp,%rbp
+  80019f:	53                   	push   %rbx
+  8001a0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001a4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001a7:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001c8:	48 85 c0             	test   %rax,%rax
+  8001cb:	7f 06                	jg     8001d3 <sys_env_destroy+0x38>
+}
+  8001cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001d1:	c9                   	leave
+  8001d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001d3:	49 89 c0             	mov    %rax,%r8
+  8001d6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001db:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8001e2:	00 00 00 
+  8001e5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001ea:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8001f1:	00 00 00 
+  8001f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f9:	49 b9 65 2f 80 00 00 	movabs $0x802f65,%r9
+  800200:	00 00 00 
+  800203:	41 ff d1             	call   *%r9
+
+0000000000800206 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800206:	55                   	push   %rbp
+  800207:	48 89 e5             	mov    %rsp,%rbp
+  80020a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80020b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800210:	ba 00 00 00 00       	mov    $0x0,%edx
+  800215:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80021a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800224:	be 00 00 00 00       	mov    $0x0,%esi
+  800229:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80022f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800231:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800235:	c9                   	leave
+  800236:	c3                   	ret
+
+0000000000800237 <sys_yield>:
+
+void
+sys_yield(void) {
+  800237:	55                   	push   %rbp
+  800238:	48 89 e5             	mov    %rsp,%rbp
+  80023b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80023c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800241:	ba 00 00 00 00       	mov    $0x0,%edx
+  800246:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80024b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800250:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800255:	be 00 00 00 00       	mov    $0x0,%esi
+  80025a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800260:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800262:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800266:	c9                   	leave
+  800267:	c3                   	ret
+
+0000000000800268 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800268:	55                   	push   %rbp
+  800269:	48 89 e5             	mov    %rsp,%rbp
+  80026c:	53                   	push   %rbx
+  80026d:	48 89 fa             	mov    %rdi,%rdx
+  800270:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800273:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800278:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80027f:	00 00 00 
+  800282:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800287:	be 00 00 00 00       	mov    $0x0,%esi
+  80028c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800292:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800294:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800298:	c9                   	leave
+  800299:	c3                   	ret
+
+000000000080029a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80029a:	55                   	push   %rbp
+  80029b:	48 89 e5             	mov    %rsp,%rbp
+  80029e:	53                   	push   %rbx
+  80029f:	49 89 f8             	mov    %rdi,%r8
+  8002a2:	48 89 d3             	mov    %rdx,%rbx
+  8002a5:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002ad:	4c 89 c2             	mov    %r8,%rdx
+  8002b0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002be:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+
+00000000008002c6 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002c6:	55                   	push   %rbp
+  8002c7:	48 89 e5             	mov    %rsp,%rbp
+  8002ca:	53                   	push   %rbx
+  8002cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8002cf:	89 f8                	mov    %edi,%eax
+  8002d1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002d4:	48 63 f9             	movslq %ecx,%rdi
+  8002d7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002da:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002df:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ed:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002ef:	48 85 c0             	test   %rax,%rax
+  8002f2:	7f 06                	jg     8002fa <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f8:	c9                   	leave
+  8002f9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002fa:	49 89 c0             	mov    %rax,%r8
+  8002fd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800302:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800309:	00 00 00 
+  80030c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800311:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800318:	00 00 00 
+  80031b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800320:	49 b9 65 2f 80 00 00 	movabs $0x802f65,%r9
+  800327:	00 00 00 
+  80032a:	41 ff d1             	call   *%r9
+
+000000000080032d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  800331:	53                   	push   %rbx
+  800332:	48 83 ec 08          	sub    $0x8,%rsp
+  800336:	89 f8                	mov    %edi,%eax
+  800338:	49 89 f2             	mov    %rsi,%r10
+  80033b:	48 89 cf             	mov    %rcx,%rdi
+  80033e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800341:	48 63 da             	movslq %edx,%rbx
+  800344:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800347:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80034c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80034f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800352:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800354:	48 85 c0             	test   %rax,%rax
+  800357:	7f 06                	jg     80035f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800359:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80035d:	c9                   	leave
+  80035e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80035f:	49 89 c0             	mov    %rax,%r8
+  800362:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800367:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80036e:	00 00 00 
+  800371:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800376:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80037d:	00 00 00 
+  800380:	b8 00 00 00 00       	mov    $0x0,%eax
+  800385:	49 b9 65 2f 80 00 00 	movabs $0x802f65,%r9
+  80038c:	00 00 00 
+  80038f:	41 ff d1             	call   *%r9
+
+0000000000800392 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800392:	55                   	push   %rbp
+  800393:	48 89 e5             	mov    %rsp,%rbp
+  800396:	53                   	push   %rbx
+  800397:	48 83 ec 08          	sub    $0x8,%rsp
+  80039b:	49 89 f9             	mov    %rdi,%r9
+  80039e:	89 f0                	mov    %esi,%eax
+  8003a0:	48 89 d3             	mov    %rdx,%rbx
+  8003a3:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8003a6:	49 63 f0             	movslq %r8d,%rsi
+  8003a9:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003ac:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003b1:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003bc:	48 85 c0             	test   %rax,%rax
+  8003bf:	7f 06                	jg     8003c7 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003c5:	c9                   	leave
+  8003c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003c7:	49 89 c0             	mov    %rax,%r8
+  8003ca:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003cf:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8003d6:	00 00 00 
+  8003d9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8003de:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8003e5:	00 00 00 
+  8003e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ed:	49 b9 65 2f 80 00 00 	movabs $0x802f65,%r9
+  8003f4:	00 00 00 
+  8003f7:	41 ff d1             	call   *%r9
+
+00000000008003fa <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003fa:	55                   	push   %rbp
+  8003fb:	48 89 e5             	mov    %rsp,%rbp
+  8003fe:	53                   	push   %rbx
+  8003ff:	89 f8                	mov    %edi,%eax
+  800401:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  800404:	48 63 f9             	movslq %ecx,%rdi
+  800407:	48 63 da             	movslq %edx,%rbx
+  80040a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80040d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800412:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800415:	be 00 00 00 00       	mov    $0x0,%esi
+  80041a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800420:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  800422:	89 c2                	mov    %eax,%edx
+  800424:	48 85 c0             	test   %rax,%rax
+  800427:	78 0d                	js     800436 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  800429:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80042e:	4d 85 c9             	test   %r9,%r9
+  800431:	74 03                	je     800436 <sys_alloc_dma_region+0x3c>
+  800433:	49 89 01             	mov    %rax,(%r9)
+}
+  800436:	89 d0                	mov    %edx,%eax
+  800438:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80043c:	c9                   	leave
+  80043d:	c3                   	ret
+
+000000000080043e <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80043e:	55                   	push   %rbp
+  80043f:	48 89 e5             	mov    %rsp,%rbp
+  800442:	53                   	push   %rbx
+  800443:	48 83 ec 08          	sub    $0x8,%rsp
+  800447:	48 89 f1             	mov    %rsi,%rcx
+  80044a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80044d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800450:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800455:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80045a:	be 00 00 00 00       	mov    $0x0,%esi
+  80045f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800465:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800467:	48 85 c0             	test   %rax,%rax
+  80046a:	7f 06                	jg     800472 <sys_set_cache_region+0x34>
+}
+  80046c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800470:	c9                   	leave
+  800471:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800472:	49 89 c0             	mov    %rax,%r8
+  800475:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80047a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800481:	00 00 00 
+  800484:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800489:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800490:	00 00 00 
+  800493:	b8 00 00 00 00       	mov    $0x0,%eax
+  800498:	49 b9 65 2f 80 00 00 	movabs $0x802f65,%r9
+  80049f:	00 00 00 
+  8004a2:	41 ff d1             	call   *%r9
+
+00000000008004a5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8004a5:	55                   	push   %rbp
+  8004a6:	48 89 e5             	mov    %rsp,%rbp
+  8004a9:	53                   	push   %rbx
+  8004aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ae:	48 89 f1             	mov    %rsi,%rcx
+  8004b1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8004b4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004b7:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ce:	48 85 c0             	test   %rax,%rax
+  8004d1:	7f 06                	jg     8004d9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8004d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004d7:	c9                   	leave
+  8004d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004d9:	49 89 c0             	mov    %rax,%r8
+  8004dc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004e1:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8004e8:	00 00 00 
+  8004eb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004f0:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8004f7:	00 00 00 
+  8004fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ff:	49 b9 65 2f 80 00 00 	movabs $0x802f65,%r9
+  800506:	00 00 00 
+  800509:	41 ff d1             	call   *%r9
+
+000000000080050c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80050c:	55                   	push   %rbp
+  80050d:	48 89 e5             	mov    %rsp,%rbp
+  800510:	53                   	push   %rbx
+  800511:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800515:	48 63 ce             	movslq %esi,%rcx
+  800518:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80051b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800520:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800525:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80052a:	be 00 00 00 00       	mov    $0x0,%esi
+  80052f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800535:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800537:	48 85 c0             	test   %rax,%rax
+  80053a:	7f 06                	jg     800542 <sys_env_set_status+0x36>
+}
+  80053c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800540:	c9                   	leave
+  800541:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800542:	49 89 c0             	mov    %rax,%r8
+  800545:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80054a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800551:	00 00 00 
+  800554:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800559:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800560:	00 00 00 
+  800563:	b8 00 00 00 00       	mov    $0x0,%eax
+  800568:	49 b9 65 2f 80 00 00 	movabs $0x802f65,%r9
+  80056f:	00 00 00 
+  800572:	41 ff d1             	call   *%r9
+
+0000000000800575 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800575:	55                   	push   %rbp
+  800576:	48 89 e5             	mov    %rsp,%rbp
+  800579:	53                   	push   %rbx
+  80057a:	48 83 ec 08          	sub    $0x8,%rsp
+  80057e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800581:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800584:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800589:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80058e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800593:	be 00 00 00 00       	mov    $0x0,%esi
+  800598:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80059e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005a0:	48 85 c0             	test   %rax,%rax
+  8005a3:	7f 06                	jg     8005ab <sys_env_set_trapframe+0x36>
+}
+  8005a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005a9:	c9                   	leave
+  8005aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005ab:	49 89 c0             	mov    %rax,%r8
+  8005ae:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8005b3:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8005ba:	00 00 00 
+  8005bd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8005c2:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8005c9:	00 00 00 
+  8005cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d1:	49 b9 65 2f 80 00 00 	movabs $0x802f65,%r9
+  8005d8:	00 00 00 
+  8005db:	41 ff d1             	call   *%r9
+
+00000000008005de <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005de:	55                   	push   %rbp
+  8005df:	48 89 e5             	mov    %rsp,%rbp
+  8005e2:	53                   	push   %rbx
+  8005e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005e7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005ea:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800601:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800607:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800609:	48 85 c0             	test   %rax,%rax
+  80060c:	7f 06                	jg     800614 <sys_env_set_pgfault_upcall+0x36>
+}
+  80060e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800612:	c9                   	leave
+  800613:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800614:	49 89 c0             	mov    %rax,%r8
+  800617:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80061c:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800623:	00 00 00 
+  800626:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80062b:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800632:	00 00 00 
+  800635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063a:	49 b9 65 2f 80 00 00 	movabs $0x802f65,%r9
+  800641:	00 00 00 
+  800644:	41 ff d1             	call   *%r9
+
+0000000000800647 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800647:	55                   	push   %rbp
+  800648:	48 89 e5             	mov    %rsp,%rbp
+  80064b:	53                   	push   %rbx
+  80064c:	89 f8                	mov    %edi,%eax
+  80064e:	49 89 f1             	mov    %rsi,%r9
+  800651:	48 89 d3             	mov    %rdx,%rbx
+  800654:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800657:	49 63 f0             	movslq %r8d,%rsi
+  80065a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80065d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800662:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800665:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80066b:	cd 30                	int    $0x30
+}
+  80066d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800671:	c9                   	leave
+  800672:	c3                   	ret
+
+0000000000800673 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800673:	55                   	push   %rbp
+  800674:	48 89 e5             	mov    %rsp,%rbp
+  800677:	53                   	push   %rbx
+  800678:	48 83 ec 08          	sub    $0x8,%rsp
+  80067c:	48 89 fa             	mov    %rdi,%rdx
+  80067f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800682:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800687:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80068c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800691:	be 00 00 00 00       	mov    $0x0,%esi
+  800696:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80069c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80069e:	48 85 c0             	test   %rax,%rax
+  8006a1:	7f 06                	jg     8006a9 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006a7:	c9                   	leave
+  8006a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006a9:	49 89 c0             	mov    %rax,%r8
+  8006ac:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8006b1:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8006b8:	00 00 00 
+  8006bb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8006c0:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8006c7:	00 00 00 
+  8006ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006cf:	49 b9 65 2f 80 00 00 	movabs $0x802f65,%r9
+  8006d6:	00 00 00 
+  8006d9:	41 ff d1             	call   *%r9
+
+00000000008006dc <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8006dc:	55                   	push   %rbp
+  8006dd:	48 89 e5             	mov    %rsp,%rbp
+  8006e0:	53                   	push   %rbx
+  8006e1:	48 89 fa             	mov    %rdi,%rdx
+  8006e4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006e7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8006fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800701:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800703:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800707:	c9                   	leave
+  800708:	c3                   	ret
+
+0000000000800709 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800709:	55                   	push   %rbp
+  80070a:	48 89 e5             	mov    %rsp,%rbp
+  80070d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80070e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800713:	ba 00 00 00 00       	mov    $0x0,%edx
+  800718:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80071d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800722:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800727:	be 00 00 00 00       	mov    $0x0,%esi
+  80072c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800732:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800734:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800738:	c9                   	leave
+  800739:	c3                   	ret
+
+000000000080073a <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80073a:	48 85 ff             	test   %rdi,%rdi
+  80073d:	0f 84 b6 01 00 00    	je     8008f9 <malloc+0x1bf>
+malloc(size_t size) {
+  800743:	55                   	push   %rbp
+  800744:	48 89 e5             	mov    %rsp,%rbp
+  800747:	41 56                	push   %r14
+  800749:	41 55                	push   %r13
+  80074b:	41 54                	push   %r12
+  80074d:	53                   	push   %rbx
+  80074e:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800751:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800758:	00 00 00 
+  80075b:	4c 8b 20             	mov    (%rax),%r12
+  80075e:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  800765:	0f 87 94 01 00 00    	ja     8008ff <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  80076b:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800772:	00 00 00 
+  800775:	48 85 c0             	test   %rax,%rax
+  800778:	74 6b                	je     8007e5 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80077a:	4d 85 e4             	test   %r12,%r12
+  80077d:	74 66                	je     8007e5 <malloc+0xab>
+  80077f:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  800786:	00 00 00 
+  800789:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80078e:	eb 0d                	jmp    80079d <malloc+0x63>
+  800790:	48 83 c1 01          	add    $0x1,%rcx
+  800794:	48 83 c2 18          	add    $0x18,%rdx
+  800798:	49 39 cc             	cmp    %rcx,%r12
+  80079b:	74 48                	je     8007e5 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80079d:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  8007a2:	74 ec                	je     800790 <malloc+0x56>
+  8007a4:	48 39 1a             	cmp    %rbx,(%rdx)
+  8007a7:	72 e7                	jb     800790 <malloc+0x56>
+                real_freep_size--;
+  8007a9:	48 83 e8 01          	sub    $0x1,%rax
+  8007ad:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  8007b4:	00 00 00 
+                freep[i].is_free = false;
+  8007b7:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8007be:	00 00 00 
+  8007c1:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8007c5:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8007c9:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8007cd:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8007d4:	00 
+                freep[i].size = size;
+  8007d5:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8007d9:	48 01 c8             	add    %rcx,%rax
+  8007dc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007e0:	e9 0b 01 00 00       	jmp    8008f0 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8007e5:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8007ec:	00 00 00 
+  8007ef:	48 01 d8             	add    %rbx,%rax
+  8007f2:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007f8:	76 7c                	jbe    800876 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007fa:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  800801:	00 00 00 
+  800804:	4c 8b 30             	mov    (%rax),%r14
+  800807:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  80080e:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  800811:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800818:	00 00 00 
+  80081b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  800822:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  800829:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80082f:	4c 0f 45 eb          	cmovne %rbx,%r13
+  800833:	48 b8 06 02 80 00 00 	movabs $0x800206,%rax
+  80083a:	00 00 00 
+  80083d:	ff d0                	call   *%rax
+  80083f:	89 c7                	mov    %eax,%edi
+  800841:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  800848:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80084f:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  800856:	00 00 00 
+  800859:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80085d:	b9 26 00 00 00       	mov    $0x26,%ecx
+  800862:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  800869:	00 00 00 
+  80086c:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80086e:	85 c0                	test   %eax,%eax
+  800870:	0f 88 90 00 00 00    	js     800906 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  800876:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  80087d:	00 00 00 
+  800880:	48 8b 31             	mov    (%rcx),%rsi
+  800883:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  80088a:	00 00 00 
+  80088d:	4c 8b 07             	mov    (%rdi),%r8
+  800890:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  800894:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  80089b:	00 00 00 
+  80089e:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  8008a2:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  8008a6:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8008ad:	00 00 00 
+  8008b0:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  8008b4:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  8008b7:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8008bb:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8008c2:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8008c3:	48 89 d8             	mov    %rbx,%rax
+  8008c6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8008cb:	4c 01 c0             	add    %r8,%rax
+  8008ce:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8008d1:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8008d8:	48 01 f3             	add    %rsi,%rbx
+  8008db:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8008de:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8008e3:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008ea:	00 00 00 
+  8008ed:	48 89 d0             	mov    %rdx,%rax
+}
+  8008f0:	5b                   	pop    %rbx
+  8008f1:	41 5c                	pop    %r12
+  8008f3:	41 5d                	pop    %r13
+  8008f5:	41 5e                	pop    %r14
+  8008f7:	5d                   	pop    %rbp
+  8008f8:	c3                   	ret
+        return NULL;
+  8008f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008fe:	c3                   	ret
+        return NULL;
+  8008ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800904:	eb ea                	jmp    8008f0 <malloc+0x1b6>
+            return NULL;
+  800906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090b:	eb e3                	jmp    8008f0 <malloc+0x1b6>
+
+000000000080090d <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  80090d:	55                   	push   %rbp
+  80090e:	48 89 e5             	mov    %rsp,%rbp
+  800911:	53                   	push   %rbx
+  800912:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  800916:	48 89 fb             	mov    %rdi,%rbx
+  800919:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  80091d:	48 89 df             	mov    %rbx,%rdi
+  800920:	48 b8 3a 07 80 00 00 	movabs $0x80073a,%rax
+  800927:	00 00 00 
+  80092a:	ff d0                	call   *%rax
+  80092c:	48 89 c7             	mov    %rax,%rdi
+  80092f:	48 89 da             	mov    %rbx,%rdx
+  800932:	be 00 00 00 00       	mov    $0x0,%esi
+  800937:	48 b8 0d 3d 80 00 00 	movabs $0x803d0d,%rax
+  80093e:	00 00 00 
+  800941:	ff d0                	call   *%rax
+}
+  800943:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+
+0000000000800949 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  800949:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  800950:	00 00 00 
+  800953:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80095a:	00 00 00 
+  80095d:	48 3b 02             	cmp    (%rdx),%rax
+  800960:	74 4d                	je     8009af <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  800962:	48 85 c0             	test   %rax,%rax
+  800965:	74 4d                	je     8009b4 <get_allocsize+0x6b>
+  800967:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80096e:	00 00 00 
+  800971:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  800976:	48 3b 39             	cmp    (%rcx),%rdi
+  800979:	74 13                	je     80098e <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  80097b:	48 83 c2 01          	add    $0x1,%rdx
+  80097f:	48 83 c1 18          	add    $0x18,%rcx
+  800983:	48 39 d0             	cmp    %rdx,%rax
+  800986:	75 ee                	jne    800976 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  800988:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098d:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  80098e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800992:	b8 00 00 00 00       	mov    $0x0,%eax
+  800997:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  80099e:	00 00 00 
+  8009a1:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  8009a7:	75 0b                	jne    8009b4 <get_allocsize+0x6b>
+  8009a9:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  8009ae:	c3                   	ret
+        return 0;
+  8009af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009b4:	c3                   	ret
+
+00000000008009b5 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  8009b5:	48 85 ff             	test   %rdi,%rdi
+  8009b8:	0f 84 01 01 00 00    	je     800abf <free+0x10a>
+free(void *ptr) {
+  8009be:	55                   	push   %rbp
+  8009bf:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8009c2:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8009c9:	00 00 00 
+  8009cc:	48 8b 30             	mov    (%rax),%rsi
+  8009cf:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8009d6:	00 00 00 
+  8009d9:	48 39 c6             	cmp    %rax,%rsi
+  8009dc:	74 50                	je     800a2e <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8009de:	48 85 f6             	test   %rsi,%rsi
+  8009e1:	74 21                	je     800a04 <free+0x4f>
+  8009e3:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009ea:	00 00 00 
+  8009ed:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009f2:	48 3b 39             	cmp    (%rcx),%rdi
+  8009f5:	74 61                	je     800a58 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009f7:	48 83 c2 01          	add    $0x1,%rdx
+  8009fb:	48 83 c1 18          	add    $0x18,%rcx
+  8009ff:	48 39 d6             	cmp    %rdx,%rsi
+  800a02:	75 ee                	jne    8009f2 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  800a04:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  800a0b:	00 00 00 
+  800a0e:	be 12 01 00 00       	mov    $0x112,%esi
+  800a13:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a1a:	00 00 00 
+  800a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a22:	48 b9 65 2f 80 00 00 	movabs $0x802f65,%rcx
+  800a29:	00 00 00 
+  800a2c:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  800a2e:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  800a35:	00 00 00 
+  800a38:	be 06 01 00 00       	mov    $0x106,%esi
+  800a3d:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a44:	00 00 00 
+  800a47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4c:	48 b9 65 2f 80 00 00 	movabs $0x802f65,%rcx
+  800a53:	00 00 00 
+  800a56:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a58:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a5c:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a63:	00 00 00 
+  800a66:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a6c:	75 27                	jne    800a95 <free+0xe0>
+            freep[i].is_free = true;
+  800a6e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a72:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a79:	00 00 00 
+  800a7c:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a83:	00 00 
+            real_freep_size++;
+  800a85:	48 83 c0 01          	add    $0x1,%rax
+  800a89:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a90:	00 00 00 
+}
+  800a93:	5d                   	pop    %rbp
+  800a94:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a95:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a9c:	00 00 00 
+  800a9f:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800aa4:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800aab:	00 00 00 
+  800aae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab3:	48 b9 65 2f 80 00 00 	movabs $0x802f65,%rcx
+  800aba:	00 00 00 
+  800abd:	ff d1                	call   *%rcx
+  800abf:	c3                   	ret
+
+0000000000800ac0 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800ac0:	55                   	push   %rbp
+  800ac1:	48 89 e5             	mov    %rsp,%rbp
+  800ac4:	41 55                	push   %r13
+  800ac6:	41 54                	push   %r12
+  800ac8:	53                   	push   %rbx
+  800ac9:	48 83 ec 08          	sub    $0x8,%rsp
+  800acd:	48 89 fb             	mov    %rdi,%rbx
+  800ad0:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800ad3:	48 b8 49 09 80 00 00 	movabs $0x800949,%rax
+  800ada:	00 00 00 
+  800add:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800adf:	49 39 c5             	cmp    %rax,%r13
+  800ae2:	73 0e                	jae    800af2 <realloc+0x32>
+}
+  800ae4:	48 89 d8             	mov    %rbx,%rax
+  800ae7:	48 83 c4 08          	add    $0x8,%rsp
+  800aeb:	5b                   	pop    %rbx
+  800aec:	41 5c                	pop    %r12
+  800aee:	41 5d                	pop    %r13
+  800af0:	5d                   	pop    %rbp
+  800af1:	c3                   	ret
+  800af2:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800af5:	4c 89 ef             	mov    %r13,%rdi
+  800af8:	48 b8 3a 07 80 00 00 	movabs $0x80073a,%rax
+  800aff:	00 00 00 
+  800b02:	ff d0                	call   *%rax
+  800b04:	48 89 c7             	mov    %rax,%rdi
+  800b07:	4c 89 e2             	mov    %r12,%rdx
+  800b0a:	48 89 de             	mov    %rbx,%rsi
+  800b0d:	48 b8 22 3e 80 00 00 	movabs $0x803e22,%rax
+  800b14:	00 00 00 
+  800b17:	ff d0                	call   *%rax
+  800b19:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800b1c:	48 89 df             	mov    %rbx,%rdi
+  800b1f:	48 b8 b5 09 80 00 00 	movabs $0x8009b5,%rax
+  800b26:	00 00 00 
+  800b29:	ff d0                	call   *%rax
+    return newptr;
+  800b2b:	4c 89 e3             	mov    %r12,%rbx
+  800b2e:	eb b4                	jmp    800ae4 <realloc+0x24>
+
+0000000000800b30 <strdup>:
+
+char*
+strdup (const char *src) {
+  800b30:	55                   	push   %rbp
+  800b31:	48 89 e5             	mov    %rsp,%rbp
+  800b34:	41 54                	push   %r12
+  800b36:	53                   	push   %rbx
+  800b37:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800b3a:	48 b8 ef 39 80 00 00 	movabs $0x8039ef,%rax
+  800b41:	00 00 00 
+  800b44:	ff d0                	call   *%rax
+  800b46:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b4a:	4c 89 e7             	mov    %r12,%rdi
+  800b4d:	48 b8 3a 07 80 00 00 	movabs $0x80073a,%rax
+  800b54:	00 00 00 
+  800b57:	ff d0                	call   *%rax
+  800b59:	48 89 c7             	mov    %rax,%rdi
+  800b5c:	4c 89 e2             	mov    %r12,%rdx
+  800b5f:	48 89 de             	mov    %rbx,%rsi
+  800b62:	48 b8 22 3e 80 00 00 	movabs $0x803e22,%rax
+  800b69:	00 00 00 
+  800b6c:	ff d0                	call   *%rax
+}
+  800b6e:	5b                   	pop    %rbx
+  800b6f:	41 5c                	pop    %r12
+  800b71:	5d                   	pop    %rbp
+  800b72:	c3                   	ret
+
+0000000000800b73 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b73:	55                   	push   %rbp
+  800b74:	48 89 e5             	mov    %rsp,%rbp
+  800b77:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b78:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b82:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b8c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b91:	be 00 00 00 00       	mov    $0x0,%esi
+  800b96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b9c:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b9e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ba2:	c9                   	leave
+  800ba3:	c3                   	ret
+
+0000000000800ba4 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800ba4:	55                   	push   %rbp
+  800ba5:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800ba8:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800baf:	00 00 00 
+  800bb2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800bb6:	74 26                	je     800bde <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800bb8:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bba:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bbe:	89 c0                	mov    %eax,%eax
+  800bc0:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800bc3:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800bca:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800bd1:	00 00 00 
+  800bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd9:	48 f7 31             	divq   (%rcx)
+}
+  800bdc:	5d                   	pop    %rbp
+  800bdd:	c3                   	ret
+        freq = get_cpufreq();
+  800bde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be3:	48 ba 73 0b 80 00 00 	movabs $0x800b73,%rdx
+  800bea:	00 00 00 
+  800bed:	ff d2                	call   *%rdx
+  800bef:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bf6:	00 00 00 
+  800bf9:	eb bd                	jmp    800bb8 <get_ticks+0x14>
+
+0000000000800bfb <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bfb:	55                   	push   %rbp
+  800bfc:	48 89 e5             	mov    %rsp,%rbp
+  800bff:	53                   	push   %rbx
+  800c00:	48 83 ec 08          	sub    $0x8,%rsp
+  800c04:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800c07:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800c0e:	00 00 00 
+  800c11:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800c15:	74 50                	je     800c67 <sleep+0x6c>
+    asm volatile("rdtsc"
+  800c17:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c19:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c1d:	89 c0                	mov    %eax,%eax
+  800c1f:	48 89 d6             	mov    %rdx,%rsi
+  800c22:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800c25:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800c2c:	00 00 00 
+  800c2f:	48 0f af 18          	imul   (%rax),%rbx
+  800c33:	48 c1 eb 03          	shr    $0x3,%rbx
+  800c37:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800c3e:	9b c4 20 
+  800c41:	48 89 d8             	mov    %rbx,%rax
+  800c44:	48 f7 e2             	mul    %rdx
+  800c47:	48 89 d1             	mov    %rdx,%rcx
+  800c4a:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c4e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c50:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c54:	89 c0                	mov    %eax,%eax
+  800c56:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c59:	48 29 f2             	sub    %rsi,%rdx
+  800c5c:	48 39 ca             	cmp    %rcx,%rdx
+  800c5f:	72 ed                	jb     800c4e <sleep+0x53>
+}
+  800c61:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c65:	c9                   	leave
+  800c66:	c3                   	ret
+        freq = get_cpufreq();
+  800c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6c:	48 ba 73 0b 80 00 00 	movabs $0x800b73,%rdx
+  800c73:	00 00 00 
+  800c76:	ff d2                	call   *%rdx
+  800c78:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c7f:	00 00 00 
+  800c82:	eb 93                	jmp    800c17 <sleep+0x1c>
+
+0000000000800c84 <poll_kbd>:
+
+int poll_kbd() {
+  800c84:	55                   	push   %rbp
+  800c85:	48 89 e5             	mov    %rsp,%rbp
+  800c88:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c89:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c93:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c9d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ca2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ca7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800cad:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800caf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cb3:	c9                   	leave
+  800cb4:	c3                   	ret
+
+0000000000800cb5 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800cb5:	55                   	push   %rbp
+  800cb6:	48 89 e5             	mov    %rsp,%rbp
+  800cb9:	53                   	push   %rbx
+  800cba:	49 89 fa             	mov    %rdi,%r10
+  800cbd:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800cbf:	44 89 c6             	mov    %r8d,%esi
+  800cc2:	89 cf                	mov    %ecx,%edi
+  800cc4:	89 d3                	mov    %edx,%ebx
+  800cc6:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800cc8:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ccd:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800cd0:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800cd4:	cd 30                	int    $0x30
+  800cd6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cda:	c9                   	leave
+  800cdb:	c3                   	ret
+
+0000000000800cdc <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cdc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800ce3:	ff ff ff 
+  800ce6:	48 01 f8             	add    %rdi,%rax
+  800ce9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800ced:	c3                   	ret
+
+0000000000800cee <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cee:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cf5:	ff ff ff 
+  800cf8:	48 01 f8             	add    %rdi,%rax
+  800cfb:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800cff:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800d05:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800d09:	c3                   	ret
+
+0000000000800d0a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800d0a:	55                   	push   %rbp
+  800d0b:	48 89 e5             	mov    %rsp,%rbp
+  800d0e:	41 57                	push   %r15
+  800d10:	41 56                	push   %r14
+  800d12:	41 55                	push   %r13
+  800d14:	41 54                	push   %r12
+  800d16:	53                   	push   %rbx
+  800d17:	48 83 ec 08          	sub    $0x8,%rsp
+  800d1b:	49 89 ff             	mov    %rdi,%r15
+  800d1e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800d23:	49 bd be 2b 80 00 00 	movabs $0x802bbe,%r13
+  800d2a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800d2d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800d33:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800d36:	48 89 df             	mov    %rbx,%rdi
+  800d39:	41 ff d5             	call   *%r13
+  800d3c:	83 e0 04             	and    $0x4,%eax
+  800d3f:	74 17                	je     800d58 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800d41:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d48:	4c 39 f3             	cmp    %r14,%rbx
+  800d4b:	75 e6                	jne    800d33 <fd_alloc+0x29>
+  800d4d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d53:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d58:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d5b:	48 83 c4 08          	add    $0x8,%rsp
+  800d5f:	5b                   	pop    %rbx
+  800d60:	41 5c                	pop    %r12
+  800d62:	41 5d                	pop    %r13
+  800d64:	41 5e                	pop    %r14
+  800d66:	41 5f                	pop    %r15
+  800d68:	5d                   	pop    %rbp
+  800d69:	c3                   	ret
+
+0000000000800d6a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d6a:	83 ff 1f             	cmp    $0x1f,%edi
+  800d6d:	77 39                	ja     800da8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d6f:	55                   	push   %rbp
+  800d70:	48 89 e5             	mov    %rsp,%rbp
+  800d73:	41 54                	push   %r12
+  800d75:	53                   	push   %rbx
+  800d76:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d79:	48 63 df             	movslq %edi,%rbx
+  800d7c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d83:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d87:	48 89 df             	mov    %rbx,%rdi
+  800d8a:	48 b8 be 2b 80 00 00 	movabs $0x802bbe,%rax
+  800d91:	00 00 00 
+  800d94:	ff d0                	call   *%rax
+  800d96:	a8 04                	test   $0x4,%al
+  800d98:	74 14                	je     800dae <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d9a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da3:	5b                   	pop    %rbx
+  800da4:	41 5c                	pop    %r12
+  800da6:	5d                   	pop    %rbp
+  800da7:	c3                   	ret
+        return -E_INVAL;
+  800da8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800dad:	c3                   	ret
+        return -E_INVAL;
+  800dae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800db3:	eb ee                	jmp    800da3 <fd_lookup+0x39>
+
+0000000000800db5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800db5:	55                   	push   %rbp
+  800db6:	48 89 e5             	mov    %rsp,%rbp
+  800db9:	41 54                	push   %r12
+  800dbb:	53                   	push   %rbx
+  800dbc:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800dbf:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800dc6:	00 00 00 
+  800dc9:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800dd0:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800dd3:	39 3b                	cmp    %edi,(%rbx)
+  800dd5:	74 47                	je     800e1e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800dd7:	48 83 c0 08          	add    $0x8,%rax
+  800ddb:	48 8b 18             	mov    (%rax),%rbx
+  800dde:	48 85 db             	test   %rbx,%rbx
+  800de1:	75 f0                	jne    800dd3 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800de3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800dea:	00 00 00 
+  800ded:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800df3:	89 fa                	mov    %edi,%edx
+  800df5:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  800dfc:	00 00 00 
+  800dff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e04:	48 b9 b5 30 80 00 00 	movabs $0x8030b5,%rcx
+  800e0b:	00 00 00 
+  800e0e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800e10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800e15:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800e19:	5b                   	pop    %rbx
+  800e1a:	41 5c                	pop    %r12
+  800e1c:	5d                   	pop    %rbp
+  800e1d:	c3                   	ret
+            return 0;
+  800e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e23:	eb f0                	jmp    800e15 <dev_lookup+0x60>
+
+0000000000800e25 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800e25:	55                   	push   %rbp
+  800e26:	48 89 e5             	mov    %rsp,%rbp
+  800e29:	41 55                	push   %r13
+  800e2b:	41 54                	push   %r12
+  800e2d:	53                   	push   %rbx
+  800e2e:	48 83 ec 18          	sub    $0x18,%rsp
+  800e32:	48 89 fb             	mov    %rdi,%rbx
+  800e35:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800e38:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800e3f:	ff ff ff 
+  800e42:	48 01 df             	add    %rbx,%rdi
+  800e45:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800e49:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e4d:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  800e54:	00 00 00 
+  800e57:	ff d0                	call   *%rax
+  800e59:	41 89 c5             	mov    %eax,%r13d
+  800e5c:	85 c0                	test   %eax,%eax
+  800e5e:	78 06                	js     800e66 <fd_close+0x41>
+  800e60:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e64:	74 1a                	je     800e80 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e66:	45 84 e4             	test   %r12b,%r12b
+  800e69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e72:	44 89 e8             	mov    %r13d,%eax
+  800e75:	48 83 c4 18          	add    $0x18,%rsp
+  800e79:	5b                   	pop    %rbx
+  800e7a:	41 5c                	pop    %r12
+  800e7c:	41 5d                	pop    %r13
+  800e7e:	5d                   	pop    %rbp
+  800e7f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e80:	8b 3b                	mov    (%rbx),%edi
+  800e82:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e86:	48 b8 b5 0d 80 00 00 	movabs $0x800db5,%rax
+  800e8d:	00 00 00 
+  800e90:	ff d0                	call   *%rax
+  800e92:	41 89 c5             	mov    %eax,%r13d
+  800e95:	85 c0                	test   %eax,%eax
+  800e97:	78 1b                	js     800eb4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e99:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e9d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800ea1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800ea7:	48 85 c0             	test   %rax,%rax
+  800eaa:	74 08                	je     800eb4 <fd_close+0x8f>
+  800eac:	48 89 df             	mov    %rbx,%rdi
+  800eaf:	ff d0                	call   *%rax
+  800eb1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800eb4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800eb9:	48 89 de             	mov    %rbx,%rsi
+  800ebc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ec1:	48 b8 a5 04 80 00 00 	movabs $0x8004a5,%rax
+  800ec8:	00 00 00 
+  800ecb:	ff d0                	call   *%rax
+    return res;
+  800ecd:	eb a3                	jmp    800e72 <fd_close+0x4d>
+
+0000000000800ecf <close>:
+
+int
+close(int fdnum) {
+  800ecf:	55                   	push   %rbp
+  800ed0:	48 89 e5             	mov    %rsp,%rbp
+  800ed3:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800ed7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800edb:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  800ee2:	00 00 00 
+  800ee5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800ee7:	85 c0                	test   %eax,%eax
+  800ee9:	78 15                	js     800f00 <close+0x31>
+
+    return fd_close(fd, 1);
+  800eeb:	be 01 00 00 00       	mov    $0x1,%esi
+  800ef0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800ef4:	48 b8 25 0e 80 00 00 	movabs $0x800e25,%rax
+  800efb:	00 00 00 
+  800efe:	ff d0                	call   *%rax
+}
+  800f00:	c9                   	leave
+  800f01:	c3                   	ret
+
+0000000000800f02 <close_all>:
+
+void
+close_all(void) {
+  800f02:	55                   	push   %rbp
+  800f03:	48 89 e5             	mov    %rsp,%rbp
+  800f06:	41 54                	push   %r12
+  800f08:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800f09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0e:	49 bc cf 0e 80 00 00 	movabs $0x800ecf,%r12
+  800f15:	00 00 00 
+  800f18:	89 df                	mov    %ebx,%edi
+  800f1a:	41 ff d4             	call   *%r12
+  800f1d:	83 c3 01             	add    $0x1,%ebx
+  800f20:	83 fb 20             	cmp    $0x20,%ebx
+  800f23:	75 f3                	jne    800f18 <close_all+0x16>
+}
+  800f25:	5b                   	pop    %rbx
+  800f26:	41 5c                	pop    %r12
+  800f28:	5d                   	pop    %rbp
+  800f29:	c3                   	ret
+
+0000000000800f2a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800f2a:	55                   	push   %rbp
+  800f2b:	48 89 e5             	mov    %rsp,%rbp
+  800f2e:	41 57                	push   %r15
+  800f30:	41 56                	push   %r14
+  800f32:	41 55                	push   %r13
+  800f34:	41 54                	push   %r12
+  800f36:	53                   	push   %rbx
+  800f37:	48 83 ec 18          	sub    $0x18,%rsp
+  800f3b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800f3e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800f42:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  800f49:	00 00 00 
+  800f4c:	ff d0                	call   *%rax
+  800f4e:	89 c3                	mov    %eax,%ebx
+  800f50:	85 c0                	test   %eax,%eax
+  800f52:	0f 88 b8 00 00 00    	js     801010 <dup+0xe6>
+    close(newfdnum);
+  800f58:	44 89 e7             	mov    %r12d,%edi
+  800f5b:	48 b8 cf 0e 80 00 00 	movabs $0x800ecf,%rax
+  800f62:	00 00 00 
+  800f65:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f67:	4d 63 ec             	movslq %r12d,%r13
+  800f6a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f71:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f75:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f79:	4c 89 ff             	mov    %r15,%rdi
+  800f7c:	49 be ee 0c 80 00 00 	movabs $0x800cee,%r14
+  800f83:	00 00 00 
+  800f86:	41 ff d6             	call   *%r14
+  800f89:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f8c:	4c 89 ef             	mov    %r13,%rdi
+  800f8f:	41 ff d6             	call   *%r14
+  800f92:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f95:	48 89 df             	mov    %rbx,%rdi
+  800f98:	48 b8 be 2b 80 00 00 	movabs $0x802bbe,%rax
+  800f9f:	00 00 00 
+  800fa2:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800fa4:	a8 04                	test   $0x4,%al
+  800fa6:	74 2b                	je     800fd3 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800fa8:	41 89 c1             	mov    %eax,%r9d
+  800fab:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fb1:	4c 89 f1             	mov    %r14,%rcx
+  800fb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb9:	48 89 de             	mov    %rbx,%rsi
+  800fbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fc1:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  800fc8:	00 00 00 
+  800fcb:	ff d0                	call   *%rax
+  800fcd:	89 c3                	mov    %eax,%ebx
+  800fcf:	85 c0                	test   %eax,%eax
+  800fd1:	78 4e                	js     801021 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800fd3:	4c 89 ff             	mov    %r15,%rdi
+  800fd6:	48 b8 be 2b 80 00 00 	movabs $0x802bbe,%rax
+  800fdd:	00 00 00 
+  800fe0:	ff d0                	call   *%rax
+  800fe2:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800fe5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800feb:	4c 89 e9             	mov    %r13,%rcx
+  800fee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff3:	4c 89 fe             	mov    %r15,%rsi
+  800ff6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ffb:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  801002:	00 00 00 
+  801005:	ff d0                	call   *%rax
+  801007:	89 c3                	mov    %eax,%ebx
+  801009:	85 c0                	test   %eax,%eax
+  80100b:	78 14                	js     801021 <dup+0xf7>
+
+    return newfdnum;
+  80100d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801010:	89 d8                	mov    %ebx,%eax
+  801012:	48 83 c4 18          	add    $0x18,%rsp
+  801016:	5b                   	pop    %rbx
+  801017:	41 5c                	pop    %r12
+  801019:	41 5d                	pop    %r13
+  80101b:	41 5e                	pop    %r14
+  80101d:	41 5f                	pop    %r15
+  80101f:	5d                   	pop    %rbp
+  801020:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801021:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801026:	4c 89 ee             	mov    %r13,%rsi
+  801029:	bf 00 00 00 00       	mov    $0x0,%edi
+  80102e:	49 bc a5 04 80 00 00 	movabs $0x8004a5,%r12
+  801035:	00 00 00 
+  801038:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80103b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801040:	4c 89 f6             	mov    %r14,%rsi
+  801043:	bf 00 00 00 00       	mov    $0x0,%edi
+  801048:	41 ff d4             	call   *%r12
+    return res;
+  80104b:	eb c3                	jmp    801010 <dup+0xe6>
+
+000000000080104d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80104d:	55                   	push   %rbp
+  80104e:	48 89 e5             	mov    %rsp,%rbp
+  801051:	41 56                	push   %r14
+  801053:	41 55                	push   %r13
+  801055:	41 54                	push   %r12
+  801057:	53                   	push   %rbx
+  801058:	48 83 ec 10          	sub    $0x10,%rsp
+  80105c:	89 fb                	mov    %edi,%ebx
+  80105e:	49 89 f4             	mov    %rsi,%r12
+  801061:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801064:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801068:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  80106f:	00 00 00 
+  801072:	ff d0                	call   *%rax
+  801074:	85 c0                	test   %eax,%eax
+  801076:	78 4c                	js     8010c4 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801078:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80107c:	41 8b 3e             	mov    (%r14),%edi
+  80107f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801083:	48 b8 b5 0d 80 00 00 	movabs $0x800db5,%rax
+  80108a:	00 00 00 
+  80108d:	ff d0                	call   *%rax
+  80108f:	85 c0                	test   %eax,%eax
+  801091:	78 35                	js     8010c8 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801093:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801097:	83 e0 03             	and    $0x3,%eax
+  80109a:	83 f8 01             	cmp    $0x1,%eax
+  80109d:	74 2d                	je     8010cc <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80109f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010a3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8010a7:	48 85 c0             	test   %rax,%rax
+  8010aa:	74 56                	je     801102 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8010ac:	4c 89 ea             	mov    %r13,%rdx
+  8010af:	4c 89 e6             	mov    %r12,%rsi
+  8010b2:	4c 89 f7             	mov    %r14,%rdi
+  8010b5:	ff d0                	call   *%rax
+}
+  8010b7:	48 83 c4 10          	add    $0x10,%rsp
+  8010bb:	5b                   	pop    %rbx
+  8010bc:	41 5c                	pop    %r12
+  8010be:	41 5d                	pop    %r13
+  8010c0:	41 5e                	pop    %r14
+  8010c2:	5d                   	pop    %rbp
+  8010c3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8010c4:	48 98                	cltq
+  8010c6:	eb ef                	jmp    8010b7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010c8:	48 98                	cltq
+  8010ca:	eb eb                	jmp    8010b7 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8010cc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8010d3:	00 00 00 
+  8010d6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8010dc:	89 da                	mov    %ebx,%edx
+  8010de:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  8010e5:	00 00 00 
+  8010e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ed:	48 b9 b5 30 80 00 00 	movabs $0x8030b5,%rcx
+  8010f4:	00 00 00 
+  8010f7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010f9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801100:	eb b5                	jmp    8010b7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801102:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801109:	eb ac                	jmp    8010b7 <read+0x6a>
+
+000000000080110b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80110b:	55                   	push   %rbp
+  80110c:	48 89 e5             	mov    %rsp,%rbp
+  80110f:	41 57                	push   %r15
+  801111:	41 56                	push   %r14
+  801113:	41 55                	push   %r13
+  801115:	41 54                	push   %r12
+  801117:	53                   	push   %rbx
+  801118:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80111c:	48 85 d2             	test   %rdx,%rdx
+  80111f:	74 54                	je     801175 <readn+0x6a>
+  801121:	41 89 fd             	mov    %edi,%r13d
+  801124:	49 89 f6             	mov    %rsi,%r14
+  801127:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80112a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80112f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801134:	49 bf 4d 10 80 00 00 	movabs $0x80104d,%r15
+  80113b:	00 00 00 
+  80113e:	4c 89 e2             	mov    %r12,%rdx
+  801141:	48 29 f2             	sub    %rsi,%rdx
+  801144:	4c 01 f6             	add    %r14,%rsi
+  801147:	44 89 ef             	mov    %r13d,%edi
+  80114a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80114d:	85 c0                	test   %eax,%eax
+  80114f:	78 20                	js     801171 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801151:	01 c3                	add    %eax,%ebx
+  801153:	85 c0                	test   %eax,%eax
+  801155:	74 08                	je     80115f <readn+0x54>
+  801157:	48 63 f3             	movslq %ebx,%rsi
+  80115a:	4c 39 e6             	cmp    %r12,%rsi
+  80115d:	72 df                	jb     80113e <readn+0x33>
+    }
+    return res;
+  80115f:	48 63 c3             	movslq %ebx,%rax
+}
+  801162:	48 83 c4 08          	add    $0x8,%rsp
+  801166:	5b                   	pop    %rbx
+  801167:	41 5c                	pop    %r12
+  801169:	41 5d                	pop    %r13
+  80116b:	41 5e                	pop    %r14
+  80116d:	41 5f                	pop    %r15
+  80116f:	5d                   	pop    %rbp
+  801170:	c3                   	ret
+        if (inc < 0) return inc;
+  801171:	48 98                	cltq
+  801173:	eb ed                	jmp    801162 <readn+0x57>
+    int inc = 1, res = 0;
+  801175:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117a:	eb e3                	jmp    80115f <readn+0x54>
+
+000000000080117c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80117c:	55                   	push   %rbp
+  80117d:	48 89 e5             	mov    %rsp,%rbp
+  801180:	41 56                	push   %r14
+  801182:	41 55                	push   %r13
+  801184:	41 54                	push   %r12
+  801186:	53                   	push   %rbx
+  801187:	48 83 ec 10          	sub    $0x10,%rsp
+  80118b:	89 fb                	mov    %edi,%ebx
+  80118d:	49 89 f4             	mov    %rsi,%r12
+  801190:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801193:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801197:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  80119e:	00 00 00 
+  8011a1:	ff d0                	call   *%rax
+  8011a3:	85 c0                	test   %eax,%eax
+  8011a5:	78 47                	js     8011ee <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011a7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8011ab:	41 8b 3e             	mov    (%r14),%edi
+  8011ae:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8011b2:	48 b8 b5 0d 80 00 00 	movabs $0x800db5,%rax
+  8011b9:	00 00 00 
+  8011bc:	ff d0                	call   *%rax
+  8011be:	85 c0                	test   %eax,%eax
+  8011c0:	78 30                	js     8011f2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8011c2:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8011c7:	74 2d                	je     8011f6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8011c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011cd:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8011d1:	48 85 c0             	test   %rax,%rax
+  8011d4:	74 56                	je     80122c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8011d6:	4c 89 ea             	mov    %r13,%rdx
+  8011d9:	4c 89 e6             	mov    %r12,%rsi
+  8011dc:	4c 89 f7             	mov    %r14,%rdi
+  8011df:	ff d0                	call   *%rax
+}
+  8011e1:	48 83 c4 10          	add    $0x10,%rsp
+  8011e5:	5b                   	pop    %rbx
+  8011e6:	41 5c                	pop    %r12
+  8011e8:	41 5d                	pop    %r13
+  8011ea:	41 5e                	pop    %r14
+  8011ec:	5d                   	pop    %rbp
+  8011ed:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011ee:	48 98                	cltq
+  8011f0:	eb ef                	jmp    8011e1 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011f2:	48 98                	cltq
+  8011f4:	eb eb                	jmp    8011e1 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011f6:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8011fd:	00 00 00 
+  801200:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801206:	89 da                	mov    %ebx,%edx
+  801208:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  80120f:	00 00 00 
+  801212:	b8 00 00 00 00       	mov    $0x0,%eax
+  801217:	48 b9 b5 30 80 00 00 	movabs $0x8030b5,%rcx
+  80121e:	00 00 00 
+  801221:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801223:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80122a:	eb b5                	jmp    8011e1 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80122c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801233:	eb ac                	jmp    8011e1 <write+0x65>
+
+0000000000801235 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801235:	55                   	push   %rbp
+  801236:	48 89 e5             	mov    %rsp,%rbp
+  801239:	53                   	push   %rbx
+  80123a:	48 83 ec 18          	sub    $0x18,%rsp
+  80123e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801240:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801244:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  80124b:	00 00 00 
+  80124e:	ff d0                	call   *%rax
+  801250:	85 c0                	test   %eax,%eax
+  801252:	78 0c                	js     801260 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801254:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801258:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80125b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801260:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801264:	c9                   	leave
+  801265:	c3                   	ret
+
+0000000000801266 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  801266:	55                   	push   %rbp
+  801267:	48 89 e5             	mov    %rsp,%rbp
+  80126a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80126e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801272:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  801279:	00 00 00 
+  80127c:	ff d0                	call   *%rax
+  80127e:	85 c0                	test   %eax,%eax
+  801280:	78 07                	js     801289 <tell+0x23>
+    return fdes->fd_offset;
+  801282:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801286:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  801289:	c9                   	leave
+  80128a:	c3                   	ret
+
+000000000080128b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80128b:	55                   	push   %rbp
+  80128c:	48 89 e5             	mov    %rsp,%rbp
+  80128f:	41 55                	push   %r13
+  801291:	41 54                	push   %r12
+  801293:	53                   	push   %rbx
+  801294:	48 83 ec 18          	sub    $0x18,%rsp
+  801298:	89 fb                	mov    %edi,%ebx
+  80129a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80129d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8012a1:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  8012a8:	00 00 00 
+  8012ab:	ff d0                	call   *%rax
+  8012ad:	85 c0                	test   %eax,%eax
+  8012af:	78 38                	js     8012e9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8012b1:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8012b5:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8012b9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8012bd:	48 b8 b5 0d 80 00 00 	movabs $0x800db5,%rax
+  8012c4:	00 00 00 
+  8012c7:	ff d0                	call   *%rax
+  8012c9:	85 c0                	test   %eax,%eax
+  8012cb:	78 1c                	js     8012e9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012cd:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8012d2:	74 20                	je     8012f4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8012d8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8012dc:	48 85 c0             	test   %rax,%rax
+  8012df:	74 47                	je     801328 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8012e1:	44 89 e6             	mov    %r12d,%esi
+  8012e4:	4c 89 ef             	mov    %r13,%rdi
+  8012e7:	ff d0                	call   *%rax
+}
+  8012e9:	48 83 c4 18          	add    $0x18,%rsp
+  8012ed:	5b                   	pop    %rbx
+  8012ee:	41 5c                	pop    %r12
+  8012f0:	41 5d                	pop    %r13
+  8012f2:	5d                   	pop    %rbp
+  8012f3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8012f4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8012fb:	00 00 00 
+  8012fe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801304:	89 da                	mov    %ebx,%edx
+  801306:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  80130d:	00 00 00 
+  801310:	b8 00 00 00 00       	mov    $0x0,%eax
+  801315:	48 b9 b5 30 80 00 00 	movabs $0x8030b5,%rcx
+  80131c:	00 00 00 
+  80131f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801321:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801326:	eb c1                	jmp    8012e9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801328:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80132d:	eb ba                	jmp    8012e9 <ftruncate+0x5e>
+
+000000000080132f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80132f:	55                   	push   %rbp
+  801330:	48 89 e5             	mov    %rsp,%rbp
+  801333:	41 54                	push   %r12
+  801335:	53                   	push   %rbx
+  801336:	48 83 ec 10          	sub    $0x10,%rsp
+  80133a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80133d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801341:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  801348:	00 00 00 
+  80134b:	ff d0                	call   *%rax
+  80134d:	85 c0                	test   %eax,%eax
+  80134f:	78 4e                	js     80139f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801351:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801355:	41 8b 3c 24          	mov    (%r12),%edi
+  801359:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80135d:	48 b8 b5 0d 80 00 00 	movabs $0x800db5,%rax
+  801364:	00 00 00 
+  801367:	ff d0                	call   *%rax
+  801369:	85 c0                	test   %eax,%eax
+  80136b:	78 32                	js     80139f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80136d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801371:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801376:	74 30                	je     8013a8 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801378:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80137b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801382:	00 00 00 
+    stat->st_isdir = 0;
+  801385:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80138c:	00 00 00 
+    stat->st_dev = dev;
+  80138f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801396:	48 89 de             	mov    %rbx,%rsi
+  801399:	4c 89 e7             	mov    %r12,%rdi
+  80139c:	ff 50 28             	call   *0x28(%rax)
+}
+  80139f:	48 83 c4 10          	add    $0x10,%rsp
+  8013a3:	5b                   	pop    %rbx
+  8013a4:	41 5c                	pop    %r12
+  8013a6:	5d                   	pop    %rbp
+  8013a7:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8013a8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8013ad:	eb f0                	jmp    80139f <fstat+0x70>
+
+00000000008013af <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8013af:	55                   	push   %rbp
+  8013b0:	48 89 e5             	mov    %rsp,%rbp
+  8013b3:	41 54                	push   %r12
+  8013b5:	53                   	push   %rbx
+  8013b6:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8013bd:	41 89 fc             	mov    %edi,%r12d
+  8013c0:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8013c2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013c6:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  8013cd:	00 00 00 
+  8013d0:	ff d0                	call   *%rax
+  8013d2:	85 c0                	test   %eax,%eax
+  8013d4:	78 31                	js     801407 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8013d6:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8013dd:	44 89 e7             	mov    %r12d,%edi
+  8013e0:	48 b8 2f 13 80 00 00 	movabs $0x80132f,%rax
+  8013e7:	00 00 00 
+  8013ea:	ff d0                	call   *%rax
+  8013ec:	85 c0                	test   %eax,%eax
+  8013ee:	78 17                	js     801407 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8013f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013f4:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8013f7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8013fa:	39 d3                	cmp    %edx,%ebx
+  8013fc:	0f 4f da             	cmovg  %edx,%ebx
+  8013ff:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801402:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801407:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  80140e:	5b                   	pop    %rbx
+  80140f:	41 5c                	pop    %r12
+  801411:	5d                   	pop    %rbp
+  801412:	c3                   	ret
+
+0000000000801413 <seektoend>:
+{
+  801413:	55                   	push   %rbp
+  801414:	48 89 e5             	mov    %rsp,%rbp
+  801417:	53                   	push   %rbx
+  801418:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80141f:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801421:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801425:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  80142c:	00 00 00 
+  80142f:	ff d0                	call   *%rax
+  801431:	85 c0                	test   %eax,%eax
+  801433:	78 28                	js     80145d <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  801435:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80143c:	89 df                	mov    %ebx,%edi
+  80143e:	48 b8 2f 13 80 00 00 	movabs $0x80132f,%rax
+  801445:	00 00 00 
+  801448:	ff d0                	call   *%rax
+  80144a:	85 c0                	test   %eax,%eax
+  80144c:	78 0f                	js     80145d <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80144e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801451:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801455:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  801458:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80145d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801461:	c9                   	leave
+  801462:	c3                   	ret
+
+0000000000801463 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801463:	55                   	push   %rbp
+  801464:	48 89 e5             	mov    %rsp,%rbp
+  801467:	41 54                	push   %r12
+  801469:	53                   	push   %rbx
+  80146a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80146d:	be 00 00 00 00       	mov    $0x0,%esi
+  801472:	48 b8 56 20 80 00 00 	movabs $0x802056,%rax
+  801479:	00 00 00 
+  80147c:	ff d0                	call   *%rax
+  80147e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801480:	85 c0                	test   %eax,%eax
+  801482:	78 25                	js     8014a9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801484:	4c 89 e6             	mov    %r12,%rsi
+  801487:	89 c7                	mov    %eax,%edi
+  801489:	48 b8 2f 13 80 00 00 	movabs $0x80132f,%rax
+  801490:	00 00 00 
+  801493:	ff d0                	call   *%rax
+  801495:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801498:	89 df                	mov    %ebx,%edi
+  80149a:	48 b8 cf 0e 80 00 00 	movabs $0x800ecf,%rax
+  8014a1:	00 00 00 
+  8014a4:	ff d0                	call   *%rax
+
+    return res;
+  8014a6:	44 89 e3             	mov    %r12d,%ebx
+}
+  8014a9:	89 d8                	mov    %ebx,%eax
+  8014ab:	5b                   	pop    %rbx
+  8014ac:	41 5c                	pop    %r12
+  8014ae:	5d                   	pop    %rbp
+  8014af:	c3                   	ret
+
+00000000008014b0 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8014b0:	55                   	push   %rbp
+  8014b1:	48 89 e5             	mov    %rsp,%rbp
+  8014b4:	53                   	push   %rbx
+  8014b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b9:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8014bc:	48 b8 dc 0c 80 00 00 	movabs $0x800cdc,%rax
+  8014c3:	00 00 00 
+  8014c6:	ff d0                	call   *%rax
+  8014c8:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8014cc:	0f 87 ea 00 00 00    	ja     8015bc <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8014d2:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014d9:	00 00 00 
+  8014dc:	80 38 00             	cmpb   $0x0,(%rax)
+  8014df:	75 35                	jne    801516 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8014e1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014e6:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8014eb:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8014f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014f5:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  8014fc:	00 00 00 
+  8014ff:	ff d0                	call   *%rax
+  801501:	85 c0                	test   %eax,%eax
+  801503:	0f 88 ba 00 00 00    	js     8015c3 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  801509:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  801510:	00 00 00 
+  801513:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  801516:	48 89 df             	mov    %rbx,%rdi
+  801519:	48 b8 dc 0c 80 00 00 	movabs $0x800cdc,%rax
+  801520:	00 00 00 
+  801523:	ff d0                	call   *%rax
+  801525:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  801529:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  801530:	00 00 00 
+  801533:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  801537:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  80153a:	39 39                	cmp    %edi,(%rcx)
+  80153c:	74 46                	je     801584 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80153e:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  801542:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  801549:	00 
+  80154a:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  801551:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  801558:	00 
+  801559:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  801560:	00 
+  801561:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  801568:	00 
+  801569:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  801570:	00 
+  801571:	89 39                	mov    %edi,(%rcx)
+  801573:	48 01 c6             	add    %rax,%rsi
+  801576:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  80157b:	48 89 c8             	mov    %rcx,%rax
+  80157e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801582:	c9                   	leave
+  801583:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  801584:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  801588:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80158f:	00 00 00 
+  801592:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801595:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  801599:	74 e0                	je     80157b <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80159b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8015a2:	00 
+  8015a3:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8015a7:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8015ae:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8015b0:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8015b3:	48 01 c2             	add    %rax,%rdx
+  8015b6:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8015ba:	eb bf                	jmp    80157b <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8015bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c1:	eb b8                	jmp    80157b <fbuf_get+0xcb>
+            return NULL;
+  8015c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c8:	eb b1                	jmp    80157b <fbuf_get+0xcb>
+
+00000000008015ca <fsipc_bulk>:
+fsipc_bulk(void) {
+  8015ca:	55                   	push   %rbp
+  8015cb:	48 89 e5             	mov    %rsp,%rbp
+  8015ce:	53                   	push   %rbx
+  8015cf:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8015d3:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015da:	00 00 00 
+  8015dd:	48 8b 18             	mov    (%rax),%rbx
+  8015e0:	48 85 db             	test   %rbx,%rbx
+  8015e3:	74 16                	je     8015fb <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8015e5:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015ec:	00 00 00 
+  8015ef:	48 8b 18             	mov    (%rax),%rbx
+}
+  8015f2:	48 89 d8             	mov    %rbx,%rax
+  8015f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f9:	c9                   	leave
+  8015fa:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8015fb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801600:	ba 00 10 04 00       	mov    $0x41000,%edx
+  801605:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  80160a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80160f:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  801616:	00 00 00 
+  801619:	ff d0                	call   *%rax
+  80161b:	85 c0                	test   %eax,%eax
+  80161d:	78 d3                	js     8015f2 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  80161f:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  801624:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  80162b:	00 00 00 
+  80162e:	eb b5                	jmp    8015e5 <fsipc_bulk+0x1b>
+
+0000000000801630 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  801630:	55                   	push   %rbp
+  801631:	48 89 e5             	mov    %rsp,%rbp
+  801634:	41 57                	push   %r15
+  801636:	41 56                	push   %r14
+  801638:	41 55                	push   %r13
+  80163a:	41 54                	push   %r12
+  80163c:	53                   	push   %rbx
+  80163d:	48 83 ec 08          	sub    $0x8,%rsp
+  801641:	41 89 fd             	mov    %edi,%r13d
+  801644:	49 89 f6             	mov    %rsi,%r14
+  801647:	49 89 d7             	mov    %rdx,%r15
+  80164a:	48 89 cb             	mov    %rcx,%rbx
+  80164d:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801650:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801657:	00 00 00 
+  80165a:	83 38 00             	cmpl   $0x0,(%rax)
+  80165d:	74 52                	je     8016b1 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80165f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801665:	4c 89 f9             	mov    %r15,%rcx
+  801668:	4c 89 f2             	mov    %r14,%rdx
+  80166b:	44 89 ee             	mov    %r13d,%esi
+  80166e:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801675:	00 00 00 
+  801678:	8b 38                	mov    (%rax),%edi
+  80167a:	48 b8 b4 41 80 00 00 	movabs $0x8041b4,%rax
+  801681:	00 00 00 
+  801684:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  801686:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80168b:	4c 89 e2             	mov    %r12,%rdx
+  80168e:	48 89 de             	mov    %rbx,%rsi
+  801691:	bf 00 00 00 00       	mov    $0x0,%edi
+  801696:	48 b8 04 40 80 00 00 	movabs $0x804004,%rax
+  80169d:	00 00 00 
+  8016a0:	ff d0                	call   *%rax
+}
+  8016a2:	48 83 c4 08          	add    $0x8,%rsp
+  8016a6:	5b                   	pop    %rbx
+  8016a7:	41 5c                	pop    %r12
+  8016a9:	41 5d                	pop    %r13
+  8016ab:	41 5e                	pop    %r14
+  8016ad:	41 5f                	pop    %r15
+  8016af:	5d                   	pop    %rbp
+  8016b0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016b1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8016b6:	48 b8 57 42 80 00 00 	movabs $0x804257,%rax
+  8016bd:	00 00 00 
+  8016c0:	ff d0                	call   *%rax
+  8016c2:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8016c9:	00 00 
+  8016cb:	eb 92                	jmp    80165f <fsipc_region+0x2f>
+
+00000000008016cd <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8016cd:	55                   	push   %rbp
+  8016ce:	48 89 e5             	mov    %rsp,%rbp
+  8016d1:	41 57                	push   %r15
+  8016d3:	41 56                	push   %r14
+  8016d5:	41 55                	push   %r13
+  8016d7:	41 54                	push   %r12
+  8016d9:	53                   	push   %rbx
+  8016da:	48 83 ec 28          	sub    $0x28,%rsp
+  8016de:	49 89 ff             	mov    %rdi,%r15
+  8016e1:	49 89 f6             	mov    %rsi,%r14
+  8016e4:	48 89 d3             	mov    %rdx,%rbx
+  8016e7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016eb:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8016ee:	48 b8 ca 15 80 00 00 	movabs $0x8015ca,%rax
+  8016f5:	00 00 00 
+  8016f8:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8016fa:	48 85 c0             	test   %rax,%rax
+  8016fd:	0f 84 cc 00 00 00    	je     8017cf <devfile_write_direct+0x102>
+  801703:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  801706:	48 85 db             	test   %rbx,%rbx
+  801709:	0f 84 ba 00 00 00    	je     8017c9 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  80170f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  801715:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80171c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  801720:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801724:	4c 29 e3             	sub    %r12,%rbx
+  801727:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80172c:	48 39 c3             	cmp    %rax,%rbx
+  80172f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  801733:	48 89 da             	mov    %rbx,%rdx
+  801736:	4c 89 f6             	mov    %r14,%rsi
+  801739:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80173d:	48 b8 22 3e 80 00 00 	movabs $0x803e22,%rax
+  801744:	00 00 00 
+  801747:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  801749:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80174d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  801751:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801754:	44 01 e0             	add    %r12d,%eax
+  801757:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  80175b:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80175f:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  801766:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80176d:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  801774:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80177a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80177f:	4c 89 ee             	mov    %r13,%rsi
+  801782:	bf 04 00 00 00       	mov    $0x4,%edi
+  801787:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  80178e:	00 00 00 
+  801791:	ff d0                	call   *%rax
+        if (res < 0)
+  801793:	85 c0                	test   %eax,%eax
+  801795:	78 29                	js     8017c0 <devfile_write_direct+0xf3>
+        if (res == 0)
+  801797:	74 2b                	je     8017c4 <devfile_write_direct+0xf7>
+        i += res;
+  801799:	48 98                	cltq
+  80179b:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  80179e:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  8017a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017a5:	49 39 c4             	cmp    %rax,%r12
+  8017a8:	0f 82 72 ff ff ff    	jb     801720 <devfile_write_direct+0x53>
+    return i;
+  8017ae:	4c 89 e0             	mov    %r12,%rax
+}
+  8017b1:	48 83 c4 28          	add    $0x28,%rsp
+  8017b5:	5b                   	pop    %rbx
+  8017b6:	41 5c                	pop    %r12
+  8017b8:	41 5d                	pop    %r13
+  8017ba:	41 5e                	pop    %r14
+  8017bc:	41 5f                	pop    %r15
+  8017be:	5d                   	pop    %rbp
+  8017bf:	c3                   	ret
+            return res;
+  8017c0:	48 98                	cltq
+  8017c2:	eb ed                	jmp    8017b1 <devfile_write_direct+0xe4>
+            return i;
+  8017c4:	4c 89 e0             	mov    %r12,%rax
+  8017c7:	eb e8                	jmp    8017b1 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8017c9:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8017cd:	eb df                	jmp    8017ae <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8017cf:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8017d6:	eb d9                	jmp    8017b1 <devfile_write_direct+0xe4>
+
+00000000008017d8 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8017d8:	55                   	push   %rbp
+  8017d9:	48 89 e5             	mov    %rsp,%rbp
+  8017dc:	41 56                	push   %r14
+  8017de:	41 55                	push   %r13
+  8017e0:	41 54                	push   %r12
+  8017e2:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8017e3:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8017e7:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8017eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f0:	4d 39 ee             	cmp    %r13,%r14
+  8017f3:	0f 84 99 00 00 00    	je     801892 <fbuf_flush+0xba>
+  8017f9:	49 89 fc             	mov    %rdi,%r12
+  8017fc:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8017ff:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  801802:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801806:	48 b8 dc 0c 80 00 00 	movabs $0x800cdc,%rax
+  80180d:	00 00 00 
+  801810:	ff d0                	call   *%rax
+  801812:	48 89 c2             	mov    %rax,%rdx
+  801815:	48 c1 e2 04          	shl    $0x4,%rdx
+  801819:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80181d:	48 c1 e0 0c          	shl    $0xc,%rax
+  801821:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801826:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  801829:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80182d:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801834:	00 
+  801835:	44 89 f1             	mov    %r14d,%ecx
+  801838:	4c 89 ea             	mov    %r13,%rdx
+  80183b:	4c 89 e7             	mov    %r12,%rdi
+  80183e:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  801845:	00 00 00 
+  801848:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80184a:	48 85 c0             	test   %rax,%rax
+  80184d:	78 43                	js     801892 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80184f:	4c 39 e8             	cmp    %r13,%rax
+  801852:	72 47                	jb     80189b <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  801854:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  801859:	83 c0 01             	add    $0x1,%eax
+  80185c:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801861:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  801864:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801868:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  80186c:	72 0f                	jb     80187d <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  80186e:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  801872:	48 39 c2             	cmp    %rax,%rdx
+  801875:	48 0f 42 d0          	cmovb  %rax,%rdx
+  801879:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  80187d:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  801884:	00 
+  801885:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  80188c:	00 
+    return 0;
+  80188d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801892:	5b                   	pop    %rbx
+  801893:	41 5c                	pop    %r12
+  801895:	41 5d                	pop    %r13
+  801897:	41 5e                	pop    %r14
+  801899:	5d                   	pop    %rbp
+  80189a:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  80189b:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8018a0:	eb f0                	jmp    801892 <fbuf_flush+0xba>
+
+00000000008018a2 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  8018a2:	55                   	push   %rbp
+  8018a3:	48 89 e5             	mov    %rsp,%rbp
+  8018a6:	53                   	push   %rbx
+  8018a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ab:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  8018ae:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  8018b5:	00 00 00 
+  8018b8:	ff d0                	call   *%rax
+  8018ba:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  8018bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c2:	48 85 f6             	test   %rsi,%rsi
+  8018c5:	74 0f                	je     8018d6 <devfile_sync+0x34>
+  8018c7:	48 89 df             	mov    %rbx,%rdi
+  8018ca:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  8018d1:	00 00 00 
+  8018d4:	ff d0                	call   *%rax
+}
+  8018d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018da:	c9                   	leave
+  8018db:	c3                   	ret
+
+00000000008018dc <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8018dc:	55                   	push   %rbp
+  8018dd:	48 89 e5             	mov    %rsp,%rbp
+  8018e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8018e4:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8018e7:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8018ee:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8018ef:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8018f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018f8:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8018ff:	00 00 00 
+  801902:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  801909:	00 00 00 
+  80190c:	ff d0                	call   *%rax
+}
+  80190e:	c9                   	leave
+  80190f:	c3                   	ret
+
+0000000000801910 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801910:	55                   	push   %rbp
+  801911:	48 89 e5             	mov    %rsp,%rbp
+  801914:	41 54                	push   %r12
+  801916:	53                   	push   %rbx
+  801917:	48 89 fb             	mov    %rdi,%rbx
+  80191a:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  80191d:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  801924:	00 00 00 
+  801927:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801929:	85 c0                	test   %eax,%eax
+  80192b:	78 63                	js     801990 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80192d:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801930:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  801937:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  801939:	be 00 00 00 00       	mov    $0x0,%esi
+  80193e:	bf 05 00 00 00       	mov    $0x5,%edi
+  801943:	48 b8 dc 18 80 00 00 	movabs $0x8018dc,%rax
+  80194a:	00 00 00 
+  80194d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80194f:	85 c0                	test   %eax,%eax
+  801951:	78 3d                	js     801990 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801953:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80195a:	00 00 00 
+  80195d:	48 89 de             	mov    %rbx,%rsi
+  801960:	4c 89 e7             	mov    %r12,%rdi
+  801963:	48 b8 2d 3a 80 00 00 	movabs $0x803a2d,%rax
+  80196a:	00 00 00 
+  80196d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80196f:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  801975:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  80197c:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80197d:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  801983:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  80198a:	00 
+
+    return 0;
+  80198b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801990:	5b                   	pop    %rbx
+  801991:	41 5c                	pop    %r12
+  801993:	5d                   	pop    %rbp
+  801994:	c3                   	ret
+
+0000000000801995 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801995:	55                   	push   %rbp
+  801996:	48 89 e5             	mov    %rsp,%rbp
+  801999:	41 54                	push   %r12
+  80199b:	53                   	push   %rbx
+  80199c:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  80199f:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  8019a6:	00 00 00 
+  8019a9:	ff d0                	call   *%rax
+  8019ab:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  8019ae:	48 89 df             	mov    %rbx,%rdi
+  8019b1:	48 b8 dc 0c 80 00 00 	movabs $0x800cdc,%rax
+  8019b8:	00 00 00 
+  8019bb:	ff d0                	call   *%rax
+  8019bd:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8019c1:	76 2e                	jbe    8019f1 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  8019c3:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8019c6:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8019cd:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8019cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8019d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019d9:	48 b8 dc 18 80 00 00 	movabs $0x8018dc,%rax
+  8019e0:	00 00 00 
+  8019e3:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019e5:	45 85 e4             	test   %r12d,%r12d
+  8019e8:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019ec:	5b                   	pop    %rbx
+  8019ed:	41 5c                	pop    %r12
+  8019ef:	5d                   	pop    %rbp
+  8019f0:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8019f1:	48 89 df             	mov    %rbx,%rdi
+  8019f4:	48 b8 dc 0c 80 00 00 	movabs $0x800cdc,%rax
+  8019fb:	00 00 00 
+  8019fe:	ff d0                	call   *%rax
+  801a00:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  801a04:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  801a0b:	00 00 00 
+  801a0e:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  801a15:	48 89 df             	mov    %rbx,%rdi
+  801a18:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  801a1f:	00 00 00 
+  801a22:	ff d0                	call   *%rax
+  801a24:	48 89 c6             	mov    %rax,%rsi
+  801a27:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a31:	48 b8 a5 04 80 00 00 	movabs $0x8004a5,%rax
+  801a38:	00 00 00 
+  801a3b:	ff d0                	call   *%rax
+  801a3d:	eb 84                	jmp    8019c3 <devfile_flush+0x2e>
+
+0000000000801a3f <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801a3f:	55                   	push   %rbp
+  801a40:	48 89 e5             	mov    %rsp,%rbp
+  801a43:	41 55                	push   %r13
+  801a45:	41 54                	push   %r12
+  801a47:	53                   	push   %rbx
+  801a48:	48 83 ec 08          	sub    $0x8,%rsp
+  801a4c:	48 89 fb             	mov    %rdi,%rbx
+  801a4f:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a52:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  801a59:	00 00 00 
+  801a5c:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a5e:	48 85 c0             	test   %rax,%rax
+  801a61:	74 51                	je     801ab4 <devfile_trunc+0x75>
+  801a63:	49 89 c4             	mov    %rax,%r12
+  801a66:	48 89 c6             	mov    %rax,%rsi
+  801a69:	48 89 df             	mov    %rbx,%rdi
+  801a6c:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  801a73:	00 00 00 
+  801a76:	ff d0                	call   *%rax
+  801a78:	85 c0                	test   %eax,%eax
+  801a7a:	78 2d                	js     801aa9 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a7c:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a83:	00 00 00 
+  801a86:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a89:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a8b:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a94:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a99:	48 b8 dc 18 80 00 00 	movabs $0x8018dc,%rax
+  801aa0:	00 00 00 
+  801aa3:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801aa5:	85 c0                	test   %eax,%eax
+  801aa7:	79 3e                	jns    801ae7 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801aa9:	48 83 c4 08          	add    $0x8,%rsp
+  801aad:	5b                   	pop    %rbx
+  801aae:	41 5c                	pop    %r12
+  801ab0:	41 5d                	pop    %r13
+  801ab2:	5d                   	pop    %rbp
+  801ab3:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ab4:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801abb:	00 00 00 
+  801abe:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801ac1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801ac3:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801ac7:	be 00 00 00 00       	mov    $0x0,%esi
+  801acc:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ad1:	48 b8 dc 18 80 00 00 	movabs $0x8018dc,%rax
+  801ad8:	00 00 00 
+  801adb:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	78 c8                	js     801aa9 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801ae1:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801ae5:	eb c2                	jmp    801aa9 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801ae7:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801aea:	8d 51 01             	lea    0x1(%rcx),%edx
+  801aed:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801af0:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801af5:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801afc:	00 00 
+  801afe:	eb a9                	jmp    801aa9 <devfile_trunc+0x6a>
+
+0000000000801b00 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801b00:	55                   	push   %rbp
+  801b01:	48 89 e5             	mov    %rsp,%rbp
+  801b04:	41 57                	push   %r15
+  801b06:	41 56                	push   %r14
+  801b08:	41 55                	push   %r13
+  801b0a:	41 54                	push   %r12
+  801b0c:	53                   	push   %rbx
+  801b0d:	48 83 ec 28          	sub    $0x28,%rsp
+  801b11:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801b15:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801b19:	49 89 d7             	mov    %rdx,%r15
+  801b1c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801b20:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  801b27:	00 00 00 
+  801b2a:	ff d0                	call   *%rax
+  801b2c:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801b2f:	48 85 c0             	test   %rax,%rax
+  801b32:	74 31                	je     801b65 <devfile_write+0x65>
+  801b34:	4c 89 f8             	mov    %r15,%rax
+  801b37:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801b3e:	77 25                	ja     801b65 <devfile_write+0x65>
+    size_t i = 0;
+  801b40:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801b46:	48 85 c0             	test   %rax,%rax
+  801b49:	0f 85 64 01 00 00    	jne    801cb3 <devfile_write+0x1b3>
+    size_t i = 0;
+  801b4f:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b53:	4c 89 f8             	mov    %r15,%rax
+}
+  801b56:	48 83 c4 28          	add    $0x28,%rsp
+  801b5a:	5b                   	pop    %rbx
+  801b5b:	41 5c                	pop    %r12
+  801b5d:	41 5d                	pop    %r13
+  801b5f:	41 5e                	pop    %r14
+  801b61:	41 5f                	pop    %r15
+  801b63:	5d                   	pop    %rbp
+  801b64:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b65:	48 85 db             	test   %rbx,%rbx
+  801b68:	74 5b                	je     801bc5 <devfile_write+0xc5>
+  801b6a:	48 89 de             	mov    %rbx,%rsi
+  801b6d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b71:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  801b78:	00 00 00 
+  801b7b:	ff d0                	call   *%rax
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	78 40                	js     801bc1 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b81:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b85:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801b88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b8c:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b90:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  801b97:	00 00 00 
+  801b9a:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b9c:	48 85 c0             	test   %rax,%rax
+  801b9f:	7e b5                	jle    801b56 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801ba1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801ba5:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801ba8:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801bab:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801bae:	8d 51 01             	lea    0x1(%rcx),%edx
+  801bb1:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801bb4:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801bb7:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801bbe:	00 
+  801bbf:	eb 95                	jmp    801b56 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801bc1:	48 98                	cltq
+  801bc3:	eb 91                	jmp    801b56 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801bc5:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801bc9:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801bcc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bd0:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801bd4:	48 89 df             	mov    %rbx,%rdi
+  801bd7:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  801bde:	00 00 00 
+  801be1:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801be3:	48 85 c0             	test   %rax,%rax
+  801be6:	0f 8e 6a ff ff ff    	jle    801b56 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801bec:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801bef:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801bf3:	e9 5e ff ff ff       	jmp    801b56 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bf8:	48 98                	cltq
+  801bfa:	4d 85 ff             	test   %r15,%r15
+  801bfd:	49 0f 45 c7          	cmovne %r15,%rax
+  801c01:	e9 50 ff ff ff       	jmp    801b56 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801c06:	48 89 de             	mov    %rbx,%rsi
+  801c09:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c0d:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  801c14:	00 00 00 
+  801c17:	ff d0                	call   *%rax
+  801c19:	85 c0                	test   %eax,%eax
+  801c1b:	0f 88 2b 01 00 00    	js     801d4c <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c21:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801c25:	4c 01 f8             	add    %r15,%rax
+  801c28:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801c2c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c30:	48 b9 dc 0c 80 00 00 	movabs $0x800cdc,%rcx
+  801c37:	00 00 00 
+  801c3a:	ff d1                	call   *%rcx
+  801c3c:	48 89 c2             	mov    %rax,%rdx
+  801c3f:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c43:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801c47:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c4b:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c50:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c53:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c5a:	00 
+  801c5b:	4c 89 ea             	mov    %r13,%rdx
+  801c5e:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c62:	48 b8 22 3e 80 00 00 	movabs $0x803e22,%rax
+  801c69:	00 00 00 
+  801c6c:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c6e:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c72:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801c76:	48 39 c2             	cmp    %rax,%rdx
+  801c79:	0f 84 db 00 00 00    	je     801d5a <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801c7f:	4c 39 e2             	cmp    %r12,%rdx
+  801c82:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801c86:	4d 01 ec             	add    %r13,%r12
+  801c89:	49 39 c4             	cmp    %rax,%r12
+  801c8c:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801c90:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801c94:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801c98:	45 01 ee             	add    %r13d,%r14d
+  801c9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c9f:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801ca3:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801ca6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801caa:	49 39 c7             	cmp    %rax,%r15
+  801cad:	0f 83 a0 fe ff ff    	jae    801b53 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801cb3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cb7:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801cbb:	8b 43 08             	mov    0x8(%rbx),%eax
+  801cbe:	44 39 f0             	cmp    %r14d,%eax
+  801cc1:	7f 10                	jg     801cd3 <devfile_write+0x1d3>
+  801cc3:	48 98                	cltq
+  801cc5:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801ccb:	49 63 d6             	movslq %r14d,%rdx
+  801cce:	48 39 d0             	cmp    %rdx,%rax
+  801cd1:	7d 2d                	jge    801d00 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801cd3:	48 89 de             	mov    %rbx,%rsi
+  801cd6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801cda:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  801ce1:	00 00 00 
+  801ce4:	ff d0                	call   *%rax
+  801ce6:	85 c0                	test   %eax,%eax
+  801ce8:	0f 88 0a ff ff ff    	js     801bf8 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801cee:	44 89 f0             	mov    %r14d,%eax
+  801cf1:	66 b8 00 00          	mov    $0x0,%ax
+  801cf5:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801cf8:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801cff:	00 
+        size_t off = pos - fb->fb_base;
+  801d00:	45 89 f4             	mov    %r14d,%r12d
+  801d03:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801d07:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801d0a:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801d0e:	4d 29 fd             	sub    %r15,%r13
+  801d11:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801d16:	4c 29 e0             	sub    %r12,%rax
+  801d19:	49 39 c5             	cmp    %rax,%r13
+  801d1c:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801d20:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801d24:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801d28:	48 39 c2             	cmp    %rax,%rdx
+  801d2b:	0f 84 f0 fe ff ff    	je     801c21 <devfile_write+0x121>
+  801d31:	4c 39 e0             	cmp    %r12,%rax
+  801d34:	0f 82 cc fe ff ff    	jb     801c06 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801d3a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d3e:	48 39 d0             	cmp    %rdx,%rax
+  801d41:	0f 83 da fe ff ff    	jae    801c21 <devfile_write+0x121>
+  801d47:	e9 ba fe ff ff       	jmp    801c06 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d4c:	48 98                	cltq
+  801d4e:	4d 85 ff             	test   %r15,%r15
+  801d51:	49 0f 45 c7          	cmovne %r15,%rax
+  801d55:	e9 fc fd ff ff       	jmp    801b56 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d5a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d5e:	4c 89 e2             	mov    %r12,%rdx
+  801d61:	e9 2a ff ff ff       	jmp    801c90 <devfile_write+0x190>
+
+0000000000801d66 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d66:	55                   	push   %rbp
+  801d67:	48 89 e5             	mov    %rsp,%rbp
+  801d6a:	41 57                	push   %r15
+  801d6c:	41 56                	push   %r14
+  801d6e:	41 55                	push   %r13
+  801d70:	41 54                	push   %r12
+  801d72:	53                   	push   %rbx
+  801d73:	48 83 ec 28          	sub    $0x28,%rsp
+  801d77:	49 89 ff             	mov    %rdi,%r15
+  801d7a:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801d7e:	48 89 d3             	mov    %rdx,%rbx
+  801d81:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801d85:	48 b8 b0 14 80 00 00 	movabs $0x8014b0,%rax
+  801d8c:	00 00 00 
+  801d8f:	ff d0                	call   *%rax
+  801d91:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801d94:	48 85 c0             	test   %rax,%rax
+  801d97:	74 0d                	je     801da6 <devfile_read+0x40>
+  801d99:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801da0:	0f 86 1a 01 00 00    	jbe    801ec0 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801da6:	4d 85 e4             	test   %r12,%r12
+  801da9:	74 1a                	je     801dc5 <devfile_read+0x5f>
+  801dab:	4c 89 e6             	mov    %r12,%rsi
+  801dae:	4c 89 ff             	mov    %r15,%rdi
+  801db1:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  801db8:	00 00 00 
+  801dbb:	ff d0                	call   *%rax
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	0f 88 e8 00 00 00    	js     801ead <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801dc5:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801dc9:	48 b8 ca 15 80 00 00 	movabs $0x8015ca,%rax
+  801dd0:	00 00 00 
+  801dd3:	ff d0                	call   *%rax
+  801dd5:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801dd8:	48 85 c0             	test   %rax,%rax
+  801ddb:	0f 84 69 02 00 00    	je     80204a <devfile_read+0x2e4>
+    while (i < n) {
+  801de1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801de6:	0f 84 ce 00 00 00    	je     801eba <devfile_read+0x154>
+    size_t i = 0;
+  801dec:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801df1:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801df8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dfc:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801e00:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801e04:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e08:	48 29 da             	sub    %rbx,%rdx
+  801e0b:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801e10:	48 39 c2             	cmp    %rax,%rdx
+  801e13:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801e17:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801e1b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801e1f:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801e22:	01 d8                	add    %ebx,%eax
+  801e24:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801e28:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801e2c:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801e33:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801e3a:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801e41:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e4c:	4c 89 ee             	mov    %r13,%rsi
+  801e4f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e54:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  801e5b:	00 00 00 
+  801e5e:	ff d0                	call   *%rax
+        if (res < 0)
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	78 4d                	js     801eb1 <devfile_read+0x14b>
+        if (res == 0)
+  801e64:	74 4f                	je     801eb5 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e66:	4c 63 e0             	movslq %eax,%r12
+  801e69:	4c 89 e2             	mov    %r12,%rdx
+  801e6c:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e70:	4c 89 f7             	mov    %r14,%rdi
+  801e73:	48 b8 22 3e 80 00 00 	movabs $0x803e22,%rax
+  801e7a:	00 00 00 
+  801e7d:	ff d0                	call   *%rax
+        i += res;
+  801e7f:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801e82:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801e85:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e89:	48 39 c3             	cmp    %rax,%rbx
+  801e8c:	0f 82 72 ff ff ff    	jb     801e04 <devfile_read+0x9e>
+    return i;
+  801e92:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801e95:	48 85 c0             	test   %rax,%rax
+  801e98:	7e 04                	jle    801e9e <devfile_read+0x138>
+  801e9a:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801e9e:	48 83 c4 28          	add    $0x28,%rsp
+  801ea2:	5b                   	pop    %rbx
+  801ea3:	41 5c                	pop    %r12
+  801ea5:	41 5d                	pop    %r13
+  801ea7:	41 5e                	pop    %r14
+  801ea9:	41 5f                	pop    %r15
+  801eab:	5d                   	pop    %rbp
+  801eac:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801ead:	48 98                	cltq
+  801eaf:	eb ed                	jmp    801e9e <devfile_read+0x138>
+            return res;
+  801eb1:	48 98                	cltq
+  801eb3:	eb e9                	jmp    801e9e <devfile_read+0x138>
+            return i;
+  801eb5:	48 89 d8             	mov    %rbx,%rax
+  801eb8:	eb db                	jmp    801e95 <devfile_read+0x12f>
+    size_t i = 0;
+  801eba:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801ebe:	eb d2                	jmp    801e92 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801ec0:	48 89 c6             	mov    %rax,%rsi
+  801ec3:	4c 89 ff             	mov    %r15,%rdi
+  801ec6:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  801ecd:	00 00 00 
+  801ed0:	ff d0                	call   *%rax
+  801ed2:	85 c0                	test   %eax,%eax
+  801ed4:	78 40                	js     801f16 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801ed6:	4c 89 ff             	mov    %r15,%rdi
+  801ed9:	48 b8 dc 0c 80 00 00 	movabs $0x800cdc,%rax
+  801ee0:	00 00 00 
+  801ee3:	ff d0                	call   *%rax
+  801ee5:	48 89 c2             	mov    %rax,%rdx
+  801ee8:	48 c1 e2 04          	shl    $0x4,%rdx
+  801eec:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801ef0:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ef4:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801ef9:	48 01 d0             	add    %rdx,%rax
+  801efc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801f00:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801f05:	0f 84 33 01 00 00    	je     80203e <devfile_read+0x2d8>
+    size_t i = 0;
+  801f0b:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801f11:	e9 f5 00 00 00       	jmp    80200b <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801f16:	48 98                	cltq
+  801f18:	eb 84                	jmp    801e9e <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801f1a:	44 89 e8             	mov    %r13d,%eax
+  801f1d:	66 b8 00 00          	mov    $0x0,%ax
+  801f21:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801f26:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801f2d:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801f2f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801f33:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801f37:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801f39:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801f3e:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801f41:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801f48:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801f49:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f54:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f59:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f5e:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  801f65:	00 00 00 
+  801f68:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f6a:	85 c0                	test   %eax,%eax
+  801f6c:	0f 88 be 00 00 00    	js     802030 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f72:	48 63 d0             	movslq %eax,%rdx
+  801f75:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801f7a:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801f7f:	44 39 e8             	cmp    %r13d,%eax
+  801f82:	0f 8e ba 00 00 00    	jle    802042 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801f88:	49 63 c5             	movslq %r13d,%rax
+  801f8b:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801f90:	48 29 c3             	sub    %rax,%rbx
+  801f93:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801f98:	48 01 c3             	add    %rax,%rbx
+  801f9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f9f:	4c 29 f0             	sub    %r14,%rax
+  801fa2:	48 39 c3             	cmp    %rax,%rbx
+  801fa5:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801fa9:	4c 89 ff             	mov    %r15,%rdi
+  801fac:	48 b9 dc 0c 80 00 00 	movabs $0x800cdc,%rcx
+  801fb3:	00 00 00 
+  801fb6:	ff d1                	call   *%rcx
+  801fb8:	48 89 c2             	mov    %rax,%rdx
+  801fbb:	48 c1 e2 04          	shl    $0x4,%rdx
+  801fbf:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801fc3:	48 c1 e0 0c          	shl    $0xc,%rax
+  801fc7:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801fcc:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801fcf:	44 89 ea             	mov    %r13d,%edx
+  801fd2:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  801fd7:	48 63 d2             	movslq %edx,%rdx
+  801fda:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801fe1:	00 
+  801fe2:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801fe6:	4c 01 f7             	add    %r14,%rdi
+  801fe9:	48 89 da             	mov    %rbx,%rdx
+  801fec:	48 b9 22 3e 80 00 00 	movabs $0x803e22,%rcx
+  801ff3:	00 00 00 
+  801ff6:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  801ff8:	41 01 dd             	add    %ebx,%r13d
+  801ffb:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  801fff:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  802002:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802006:	49 39 c6             	cmp    %rax,%r14
+  802009:	73 37                	jae    802042 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  80200b:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  80200f:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802014:	44 39 e8             	cmp    %r13d,%eax
+  802017:	0f 8f fd fe ff ff    	jg     801f1a <devfile_read+0x1b4>
+  80201d:	41 03 44 24 10       	add    0x10(%r12),%eax
+  802022:	44 39 e8             	cmp    %r13d,%eax
+  802025:	0f 8f 5d ff ff ff    	jg     801f88 <devfile_read+0x222>
+  80202b:	e9 ea fe ff ff       	jmp    801f1a <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  802030:	48 98                	cltq
+  802032:	4d 85 f6             	test   %r14,%r14
+  802035:	49 0f 45 c6          	cmovne %r14,%rax
+  802039:	e9 60 fe ff ff       	jmp    801e9e <devfile_read+0x138>
+    size_t i = 0;
+  80203e:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  802042:	4c 89 f0             	mov    %r14,%rax
+  802045:	e9 54 fe ff ff       	jmp    801e9e <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80204a:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802051:	e9 48 fe ff ff       	jmp    801e9e <devfile_read+0x138>
+
+0000000000802056 <open>:
+open(const char *path, int mode) {
+  802056:	55                   	push   %rbp
+  802057:	48 89 e5             	mov    %rsp,%rbp
+  80205a:	41 55                	push   %r13
+  80205c:	41 54                	push   %r12
+  80205e:	53                   	push   %rbx
+  80205f:	48 83 ec 18          	sub    $0x18,%rsp
+  802063:	49 89 fc             	mov    %rdi,%r12
+  802066:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802069:	48 b8 ef 39 80 00 00 	movabs $0x8039ef,%rax
+  802070:	00 00 00 
+  802073:	ff d0                	call   *%rax
+  802075:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80207b:	0f 87 8a 00 00 00    	ja     80210b <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802081:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802085:	48 b8 0a 0d 80 00 00 	movabs $0x800d0a,%rax
+  80208c:	00 00 00 
+  80208f:	ff d0                	call   *%rax
+  802091:	89 c3                	mov    %eax,%ebx
+  802093:	85 c0                	test   %eax,%eax
+  802095:	78 50                	js     8020e7 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802097:	4c 89 e6             	mov    %r12,%rsi
+  80209a:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8020a1:	00 00 00 
+  8020a4:	48 89 df             	mov    %rbx,%rdi
+  8020a7:	48 b8 2d 3a 80 00 00 	movabs $0x803a2d,%rax
+  8020ae:	00 00 00 
+  8020b1:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8020b3:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020ba:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8020be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020c3:	48 b8 dc 18 80 00 00 	movabs $0x8018dc,%rax
+  8020ca:	00 00 00 
+  8020cd:	ff d0                	call   *%rax
+  8020cf:	89 c3                	mov    %eax,%ebx
+  8020d1:	85 c0                	test   %eax,%eax
+  8020d3:	78 1f                	js     8020f4 <open+0x9e>
+    return fd2num(fd);
+  8020d5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020d9:	48 b8 dc 0c 80 00 00 	movabs $0x800cdc,%rax
+  8020e0:	00 00 00 
+  8020e3:	ff d0                	call   *%rax
+  8020e5:	89 c3                	mov    %eax,%ebx
+}
+  8020e7:	89 d8                	mov    %ebx,%eax
+  8020e9:	48 83 c4 18          	add    $0x18,%rsp
+  8020ed:	5b                   	pop    %rbx
+  8020ee:	41 5c                	pop    %r12
+  8020f0:	41 5d                	pop    %r13
+  8020f2:	5d                   	pop    %rbp
+  8020f3:	c3                   	ret
+        fd_close(fd, 0);
+  8020f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020fd:	48 b8 25 0e 80 00 00 	movabs $0x800e25,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+        return res;
+  802109:	eb dc                	jmp    8020e7 <open+0x91>
+        return -E_BAD_PATH;
+  80210b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802110:	eb d5                	jmp    8020e7 <open+0x91>
+
+0000000000802112 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  802112:	55                   	push   %rbp
+  802113:	48 89 e5             	mov    %rsp,%rbp
+  802116:	41 57                	push   %r15
+  802118:	41 56                	push   %r14
+  80211a:	41 55                	push   %r13
+  80211c:	41 54                	push   %r12
+  80211e:	53                   	push   %rbx
+  80211f:	48 83 ec 18          	sub    $0x18,%rsp
+  802123:	41 89 f6             	mov    %esi,%r14d
+  802126:	49 89 d7             	mov    %rdx,%r15
+  802129:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80212c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802130:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  802137:	00 00 00 
+  80213a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80213c:	85 c0                	test   %eax,%eax
+  80213e:	0f 88 db 00 00 00    	js     80221f <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802144:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802148:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80214f:	00 00 00 
+  802152:	8b 00                	mov    (%rax),%eax
+  802154:	39 07                	cmp    %eax,(%rdi)
+  802156:	0f 85 db 00 00 00    	jne    802237 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80215c:	45 85 f6             	test   %r14d,%r14d
+  80215f:	0f 88 db 00 00 00    	js     802240 <fmap+0x12e>
+  802165:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80216c:	0f 85 d7 00 00 00    	jne    802249 <fmap+0x137>
+  802172:	4c 89 fb             	mov    %r15,%rbx
+  802175:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80217b:	0f 85 d1 00 00 00    	jne    802252 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802181:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  802188:	00 00 00 
+  80218b:	ff d0                	call   *%rax
+  80218d:	85 c0                	test   %eax,%eax
+  80218f:	0f 88 8e 00 00 00    	js     802223 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802195:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80219c:	00 00 00 
+    while (i < n) {
+  80219f:	4d 85 ed             	test   %r13,%r13
+  8021a2:	0f 84 8a 00 00 00    	je     802232 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8021a8:	4c 89 ea             	mov    %r13,%rdx
+  8021ab:	48 29 da             	sub    %rbx,%rdx
+  8021ae:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8021b5:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8021bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8021bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021c3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021c6:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8021ca:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8021ce:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8021d3:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8021d8:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8021dc:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8021e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021e5:	4c 89 e6             	mov    %r12,%rsi
+  8021e8:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021ed:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  8021f4:	00 00 00 
+  8021f7:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021f9:	85 c0                	test   %eax,%eax
+  8021fb:	78 2a                	js     802227 <fmap+0x115>
+        i += res;
+  8021fd:	48 98                	cltq
+  8021ff:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  802202:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  802206:	72 05                	jb     80220d <fmap+0xfb>
+    while (i < n) {
+  802208:	4c 39 eb             	cmp    %r13,%rbx
+  80220b:	72 9b                	jb     8021a8 <fmap+0x96>
+    }
+    return i;
+  80220d:	48 89 d8             	mov    %rbx,%rax
+}
+  802210:	48 83 c4 18          	add    $0x18,%rsp
+  802214:	5b                   	pop    %rbx
+  802215:	41 5c                	pop    %r12
+  802217:	41 5d                	pop    %r13
+  802219:	41 5e                	pop    %r14
+  80221b:	41 5f                	pop    %r15
+  80221d:	5d                   	pop    %rbp
+  80221e:	c3                   	ret
+    if (res < 0) return res;
+  80221f:	48 98                	cltq
+  802221:	eb ed                	jmp    802210 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802223:	48 98                	cltq
+  802225:	eb e9                	jmp    802210 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  802227:	48 98                	cltq
+  802229:	48 85 db             	test   %rbx,%rbx
+  80222c:	48 0f 45 c3          	cmovne %rbx,%rax
+  802230:	eb de                	jmp    802210 <fmap+0xfe>
+    size_t i = 0;
+  802232:	4c 89 eb             	mov    %r13,%rbx
+  802235:	eb d6                	jmp    80220d <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802237:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80223e:	eb d0                	jmp    802210 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802240:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802247:	eb c7                	jmp    802210 <fmap+0xfe>
+  802249:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802250:	eb be                	jmp    802210 <fmap+0xfe>
+  802252:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802259:	eb b5                	jmp    802210 <fmap+0xfe>
+
+000000000080225b <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80225b:	55                   	push   %rbp
+  80225c:	48 89 e5             	mov    %rsp,%rbp
+  80225f:	41 56                	push   %r14
+  802261:	41 55                	push   %r13
+  802263:	41 54                	push   %r12
+  802265:	53                   	push   %rbx
+  802266:	48 83 ec 10          	sub    $0x10,%rsp
+  80226a:	89 fb                	mov    %edi,%ebx
+  80226c:	41 89 f4             	mov    %esi,%r12d
+  80226f:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802272:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802276:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  80227d:	00 00 00 
+  802280:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802282:	85 c0                	test   %eax,%eax
+  802284:	78 63                	js     8022e9 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  802286:	45 85 e4             	test   %r12d,%r12d
+  802289:	0f 88 80 00 00 00    	js     80230f <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80228f:	45 89 e6             	mov    %r12d,%r14d
+  802292:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  802299:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80229d:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  8022a4:	00 00 00 
+  8022a7:	ff d0                	call   *%rax
+  8022a9:	48 89 c2             	mov    %rax,%rdx
+  8022ac:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022b1:	44 89 f6             	mov    %r14d,%esi
+  8022b4:	89 df                	mov    %ebx,%edi
+  8022b6:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  8022bd:	00 00 00 
+  8022c0:	ff d0                	call   *%rax
+  8022c2:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8022c5:	45 29 f4             	sub    %r14d,%r12d
+  8022c8:	4d 63 f4             	movslq %r12d,%r14
+  8022cb:	49 39 c6             	cmp    %rax,%r14
+  8022ce:	7c 1d                	jl     8022ed <read_map+0x92>
+  8022d0:	48 85 c0             	test   %rax,%rax
+  8022d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d8:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8022dc:	48 83 c4 10          	add    $0x10,%rsp
+  8022e0:	5b                   	pop    %rbx
+  8022e1:	41 5c                	pop    %r12
+  8022e3:	41 5d                	pop    %r13
+  8022e5:	41 5e                	pop    %r14
+  8022e7:	5d                   	pop    %rbp
+  8022e8:	c3                   	ret
+    if (res < 0) return res;
+  8022e9:	48 98                	cltq
+  8022eb:	eb ef                	jmp    8022dc <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8022ed:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022f1:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  8022f8:	00 00 00 
+  8022fb:	ff d0                	call   *%rax
+  8022fd:	4d 63 e4             	movslq %r12d,%r12
+  802300:	4c 01 e0             	add    %r12,%rax
+  802303:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  802307:	48 89 d8             	mov    %rbx,%rax
+  80230a:	4c 29 f0             	sub    %r14,%rax
+  80230d:	eb cd                	jmp    8022dc <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  80230f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802316:	eb c4                	jmp    8022dc <read_map+0x81>
+
+0000000000802318 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  802318:	55                   	push   %rbp
+  802319:	48 89 e5             	mov    %rsp,%rbp
+  80231c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802320:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802324:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802330:	85 c0                	test   %eax,%eax
+  802332:	78 4a                	js     80237e <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802334:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802338:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80233f:	00 00 00 
+  802342:	8b 00                	mov    (%rax),%eax
+  802344:	39 07                	cmp    %eax,(%rdi)
+  802346:	75 38                	jne    802380 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802348:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  80234f:	00 00 00 
+  802352:	ff d0                	call   *%rax
+  802354:	85 c0                	test   %eax,%eax
+  802356:	78 26                	js     80237e <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802358:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80235c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80235f:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802366:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802368:	be 00 00 00 00       	mov    $0x0,%esi
+  80236d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802372:	48 b8 dc 18 80 00 00 	movabs $0x8018dc,%rax
+  802379:	00 00 00 
+  80237c:	ff d0                	call   *%rax
+}
+  80237e:	c9                   	leave
+  80237f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802380:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802385:	eb f7                	jmp    80237e <fsync+0x66>
+
+0000000000802387 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  802387:	55                   	push   %rbp
+  802388:	48 89 e5             	mov    %rsp,%rbp
+  80238b:	41 57                	push   %r15
+  80238d:	41 56                	push   %r14
+  80238f:	41 55                	push   %r13
+  802391:	41 54                	push   %r12
+  802393:	53                   	push   %rbx
+  802394:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  802398:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80239f:	00 00 00 
+  8023a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8023a7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023ad:	49 bd 6a 0d 80 00 00 	movabs $0x800d6a,%r13
+  8023b4:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8023b7:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8023be:	00 00 00 
+  8023c1:	eb 0c                	jmp    8023cf <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8023c3:	83 c3 01             	add    $0x1,%ebx
+  8023c6:	49 83 c4 28          	add    $0x28,%r12
+  8023ca:	83 fb 20             	cmp    $0x20,%ebx
+  8023cd:	74 33                	je     802402 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023cf:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8023d4:	74 ed                	je     8023c3 <flushall+0x3c>
+  8023d6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8023da:	89 df                	mov    %ebx,%edi
+  8023dc:	41 ff d5             	call   *%r13
+  8023df:	85 c0                	test   %eax,%eax
+  8023e1:	78 e0                	js     8023c3 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8023e3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023e7:	41 8b 06             	mov    (%r14),%eax
+  8023ea:	39 07                	cmp    %eax,(%rdi)
+  8023ec:	75 d5                	jne    8023c3 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8023ee:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  8023f5:	00 00 00 
+  8023f8:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8023fa:	85 c0                	test   %eax,%eax
+  8023fc:	44 0f 48 f8          	cmovs  %eax,%r15d
+  802400:	eb c1                	jmp    8023c3 <flushall+0x3c>
+    }
+    return res;
+}
+  802402:	44 89 f8             	mov    %r15d,%eax
+  802405:	48 83 c4 18          	add    $0x18,%rsp
+  802409:	5b                   	pop    %rbx
+  80240a:	41 5c                	pop    %r12
+  80240c:	41 5d                	pop    %r13
+  80240e:	41 5e                	pop    %r14
+  802410:	41 5f                	pop    %r15
+  802412:	5d                   	pop    %rbp
+  802413:	c3                   	ret
+
+0000000000802414 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  802414:	55                   	push   %rbp
+  802415:	48 89 e5             	mov    %rsp,%rbp
+  802418:	53                   	push   %rbx
+  802419:	48 83 ec 08          	sub    $0x8,%rsp
+  80241d:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  802420:	40 0f b6 c6          	movzbl %sil,%eax
+  802424:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80242b:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  80242d:	be 00 00 00 00       	mov    $0x0,%esi
+  802432:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802437:	48 b8 dc 18 80 00 00 	movabs $0x8018dc,%rax
+  80243e:	00 00 00 
+  802441:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802443:	85 c0                	test   %eax,%eax
+  802445:	78 23                	js     80246a <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  802447:	ba 58 06 00 00       	mov    $0x658,%edx
+  80244c:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802453:	00 00 00 
+  802456:	48 89 df             	mov    %rbx,%rdi
+  802459:	48 b8 22 3e 80 00 00 	movabs $0x803e22,%rax
+  802460:	00 00 00 
+  802463:	ff d0                	call   *%rax
+    return 0;
+  802465:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80246a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80246e:	c9                   	leave
+  80246f:	c3                   	ret
+
+0000000000802470 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  802470:	55                   	push   %rbp
+  802471:	48 89 e5             	mov    %rsp,%rbp
+  802474:	53                   	push   %rbx
+  802475:	48 83 ec 08          	sub    $0x8,%rsp
+  802479:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  80247c:	48 b8 ef 39 80 00 00 	movabs $0x8039ef,%rax
+  802483:	00 00 00 
+  802486:	ff d0                	call   *%rax
+  802488:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80248e:	77 35                	ja     8024c5 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  802490:	48 89 de             	mov    %rbx,%rsi
+  802493:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80249a:	00 00 00 
+  80249d:	48 b8 2d 3a 80 00 00 	movabs $0x803a2d,%rax
+  8024a4:	00 00 00 
+  8024a7:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8024a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ae:	bf 07 00 00 00       	mov    $0x7,%edi
+  8024b3:	48 b8 dc 18 80 00 00 	movabs $0x8018dc,%rax
+  8024ba:	00 00 00 
+  8024bd:	ff d0                	call   *%rax
+}
+  8024bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024c3:	c9                   	leave
+  8024c4:	c3                   	ret
+        return -E_BAD_PATH;
+  8024c5:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8024ca:	eb f3                	jmp    8024bf <remove+0x4f>
+
+00000000008024cc <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024cc:	55                   	push   %rbp
+  8024cd:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8024d0:	48 b8 87 23 80 00 00 	movabs $0x802387,%rax
+  8024d7:	00 00 00 
+  8024da:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024e6:	48 b8 dc 18 80 00 00 	movabs $0x8018dc,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+}
+  8024f2:	5d                   	pop    %rbp
+  8024f3:	c3                   	ret
+
+00000000008024f4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024f4:	55                   	push   %rbp
+  8024f5:	48 89 e5             	mov    %rsp,%rbp
+  8024f8:	41 54                	push   %r12
+  8024fa:	53                   	push   %rbx
+  8024fb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024fe:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  802505:	00 00 00 
+  802508:	ff d0                	call   *%rax
+  80250a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80250d:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  802514:	00 00 00 
+  802517:	48 89 df             	mov    %rbx,%rdi
+  80251a:	48 b8 2d 3a 80 00 00 	movabs $0x803a2d,%rax
+  802521:	00 00 00 
+  802524:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802526:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80252b:	41 2b 04 24          	sub    (%r12),%eax
+  80252f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802535:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80253c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80253f:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802546:	00 00 00 
+  802549:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802550:	b8 00 00 00 00       	mov    $0x0,%eax
+  802555:	5b                   	pop    %rbx
+  802556:	41 5c                	pop    %r12
+  802558:	5d                   	pop    %rbp
+  802559:	c3                   	ret
+
+000000000080255a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80255a:	55                   	push   %rbp
+  80255b:	48 89 e5             	mov    %rsp,%rbp
+  80255e:	41 54                	push   %r12
+  802560:	53                   	push   %rbx
+  802561:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802564:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802569:	48 89 fe             	mov    %rdi,%rsi
+  80256c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802571:	49 bc a5 04 80 00 00 	movabs $0x8004a5,%r12
+  802578:	00 00 00 
+  80257b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80257e:	48 89 df             	mov    %rbx,%rdi
+  802581:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  802588:	00 00 00 
+  80258b:	ff d0                	call   *%rax
+  80258d:	48 89 c6             	mov    %rax,%rsi
+  802590:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802595:	bf 00 00 00 00       	mov    $0x0,%edi
+  80259a:	41 ff d4             	call   *%r12
+}
+  80259d:	5b                   	pop    %rbx
+  80259e:	41 5c                	pop    %r12
+  8025a0:	5d                   	pop    %rbp
+  8025a1:	c3                   	ret
+
+00000000008025a2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025a2:	55                   	push   %rbp
+  8025a3:	48 89 e5             	mov    %rsp,%rbp
+  8025a6:	41 57                	push   %r15
+  8025a8:	41 56                	push   %r14
+  8025aa:	41 55                	push   %r13
+  8025ac:	41 54                	push   %r12
+  8025ae:	53                   	push   %rbx
+  8025af:	48 83 ec 18          	sub    $0x18,%rsp
+  8025b3:	49 89 fc             	mov    %rdi,%r12
+  8025b6:	49 89 f5             	mov    %rsi,%r13
+  8025b9:	49 89 d7             	mov    %rdx,%r15
+  8025bc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025c0:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  8025c7:	00 00 00 
+  8025ca:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025cc:	4d 85 ff             	test   %r15,%r15
+  8025cf:	0f 84 af 00 00 00    	je     802684 <devpipe_write+0xe2>
+  8025d5:	48 89 c3             	mov    %rax,%rbx
+  8025d8:	4c 89 f8             	mov    %r15,%rax
+  8025db:	4d 89 ef             	mov    %r13,%r15
+  8025de:	4c 01 e8             	add    %r13,%rax
+  8025e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025e5:	49 bd 9a 02 80 00 00 	movabs $0x80029a,%r13
+  8025ec:	00 00 00 
+            sys_yield();
+  8025ef:	49 be 37 02 80 00 00 	movabs $0x800237,%r14
+  8025f6:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025f9:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025fc:	48 63 ce             	movslq %esi,%rcx
+  8025ff:	48 63 03             	movslq (%rbx),%rax
+  802602:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802608:	48 39 c1             	cmp    %rax,%rcx
+  80260b:	72 2e                	jb     80263b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80260d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802612:	48 89 da             	mov    %rbx,%rdx
+  802615:	be 00 10 00 00       	mov    $0x1000,%esi
+  80261a:	4c 89 e7             	mov    %r12,%rdi
+  80261d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802620:	85 c0                	test   %eax,%eax
+  802622:	74 66                	je     80268a <devpipe_write+0xe8>
+            sys_yield();
+  802624:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802627:	8b 73 04             	mov    0x4(%rbx),%esi
+  80262a:	48 63 ce             	movslq %esi,%rcx
+  80262d:	48 63 03             	movslq (%rbx),%rax
+  802630:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802636:	48 39 c1             	cmp    %rax,%rcx
+  802639:	73 d2                	jae    80260d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80263b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80263f:	48 89 ca             	mov    %rcx,%rdx
+  802642:	48 c1 ea 03          	shr    $0x3,%rdx
+  802646:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80264d:	08 10 20 
+  802650:	48 f7 e2             	mul    %rdx
+  802653:	48 c1 ea 06          	shr    $0x6,%rdx
+  802657:	48 89 d0             	mov    %rdx,%rax
+  80265a:	48 c1 e0 09          	shl    $0x9,%rax
+  80265e:	48 29 d0             	sub    %rdx,%rax
+  802661:	48 c1 e0 03          	shl    $0x3,%rax
+  802665:	48 29 c1             	sub    %rax,%rcx
+  802668:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80266d:	83 c6 01             	add    $0x1,%esi
+  802670:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802673:	49 83 c7 01          	add    $0x1,%r15
+  802677:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80267b:	49 39 c7             	cmp    %rax,%r15
+  80267e:	0f 85 75 ff ff ff    	jne    8025f9 <devpipe_write+0x57>
+    return n;
+  802684:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802688:	eb 05                	jmp    80268f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80268a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268f:	48 83 c4 18          	add    $0x18,%rsp
+  802693:	5b                   	pop    %rbx
+  802694:	41 5c                	pop    %r12
+  802696:	41 5d                	pop    %r13
+  802698:	41 5e                	pop    %r14
+  80269a:	41 5f                	pop    %r15
+  80269c:	5d                   	pop    %rbp
+  80269d:	c3                   	ret
+
+000000000080269e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80269e:	55                   	push   %rbp
+  80269f:	48 89 e5             	mov    %rsp,%rbp
+  8026a2:	41 57                	push   %r15
+  8026a4:	41 56                	push   %r14
+  8026a6:	41 55                	push   %r13
+  8026a8:	41 54                	push   %r12
+  8026aa:	53                   	push   %rbx
+  8026ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8026af:	49 89 fc             	mov    %rdi,%r12
+  8026b2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026b6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026ba:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  8026c1:	00 00 00 
+  8026c4:	ff d0                	call   *%rax
+  8026c6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026c9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026cf:	49 bd 9a 02 80 00 00 	movabs $0x80029a,%r13
+  8026d6:	00 00 00 
+            sys_yield();
+  8026d9:	49 be 37 02 80 00 00 	movabs $0x800237,%r14
+  8026e0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026e3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026e8:	74 7d                	je     802767 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026ea:	8b 03                	mov    (%rbx),%eax
+  8026ec:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026ef:	75 26                	jne    802717 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026f1:	4d 85 ff             	test   %r15,%r15
+  8026f4:	75 77                	jne    80276d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026f6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026fb:	48 89 da             	mov    %rbx,%rdx
+  8026fe:	be 00 10 00 00       	mov    $0x1000,%esi
+  802703:	4c 89 e7             	mov    %r12,%rdi
+  802706:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802709:	85 c0                	test   %eax,%eax
+  80270b:	74 72                	je     80277f <devpipe_read+0xe1>
+            sys_yield();
+  80270d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802710:	8b 03                	mov    (%rbx),%eax
+  802712:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802715:	74 df                	je     8026f6 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802717:	48 63 c8             	movslq %eax,%rcx
+  80271a:	48 89 ca             	mov    %rcx,%rdx
+  80271d:	48 c1 ea 03          	shr    $0x3,%rdx
+  802721:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802728:	08 10 20 
+  80272b:	48 89 d0             	mov    %rdx,%rax
+  80272e:	48 f7 e6             	mul    %rsi
+  802731:	48 c1 ea 06          	shr    $0x6,%rdx
+  802735:	48 89 d0             	mov    %rdx,%rax
+  802738:	48 c1 e0 09          	shl    $0x9,%rax
+  80273c:	48 29 d0             	sub    %rdx,%rax
+  80273f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802746:	00 
+  802747:	48 89 c8             	mov    %rcx,%rax
+  80274a:	48 29 d0             	sub    %rdx,%rax
+  80274d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802752:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802756:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80275a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80275d:	49 83 c7 01          	add    $0x1,%r15
+  802761:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802765:	75 83                	jne    8026ea <devpipe_read+0x4c>
+    return n;
+  802767:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80276b:	eb 03                	jmp    802770 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80276d:	4c 89 f8             	mov    %r15,%rax
+}
+  802770:	48 83 c4 18          	add    $0x18,%rsp
+  802774:	5b                   	pop    %rbx
+  802775:	41 5c                	pop    %r12
+  802777:	41 5d                	pop    %r13
+  802779:	41 5e                	pop    %r14
+  80277b:	41 5f                	pop    %r15
+  80277d:	5d                   	pop    %rbp
+  80277e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80277f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802784:	eb ea                	jmp    802770 <devpipe_read+0xd2>
+
+0000000000802786 <pipe>:
+pipe(int pfd[2]) {
+  802786:	55                   	push   %rbp
+  802787:	48 89 e5             	mov    %rsp,%rbp
+  80278a:	41 55                	push   %r13
+  80278c:	41 54                	push   %r12
+  80278e:	53                   	push   %rbx
+  80278f:	48 83 ec 18          	sub    $0x18,%rsp
+  802793:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802796:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80279a:	48 b8 0a 0d 80 00 00 	movabs $0x800d0a,%rax
+  8027a1:	00 00 00 
+  8027a4:	ff d0                	call   *%rax
+  8027a6:	89 c3                	mov    %eax,%ebx
+  8027a8:	85 c0                	test   %eax,%eax
+  8027aa:	0f 88 a0 01 00 00    	js     802950 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8027b0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027ba:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8027be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c3:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  8027ca:	00 00 00 
+  8027cd:	ff d0                	call   *%rax
+  8027cf:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027d1:	85 c0                	test   %eax,%eax
+  8027d3:	0f 88 77 01 00 00    	js     802950 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027d9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8027dd:	48 b8 0a 0d 80 00 00 	movabs $0x800d0a,%rax
+  8027e4:	00 00 00 
+  8027e7:	ff d0                	call   *%rax
+  8027e9:	89 c3                	mov    %eax,%ebx
+  8027eb:	85 c0                	test   %eax,%eax
+  8027ed:	0f 88 43 01 00 00    	js     802936 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027f3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027fd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802801:	bf 00 00 00 00       	mov    $0x0,%edi
+  802806:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  80280d:	00 00 00 
+  802810:	ff d0                	call   *%rax
+  802812:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802814:	85 c0                	test   %eax,%eax
+  802816:	0f 88 1a 01 00 00    	js     802936 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80281c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802820:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  802827:	00 00 00 
+  80282a:	ff d0                	call   *%rax
+  80282c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80282f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802834:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802839:	48 89 c6             	mov    %rax,%rsi
+  80283c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802841:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  802848:	00 00 00 
+  80284b:	ff d0                	call   *%rax
+  80284d:	89 c3                	mov    %eax,%ebx
+  80284f:	85 c0                	test   %eax,%eax
+  802851:	0f 88 c5 00 00 00    	js     80291c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802857:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80285b:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  802862:	00 00 00 
+  802865:	ff d0                	call   *%rax
+  802867:	48 89 c1             	mov    %rax,%rcx
+  80286a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802870:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80287b:	4c 89 ee             	mov    %r13,%rsi
+  80287e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802883:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  80288a:	00 00 00 
+  80288d:	ff d0                	call   *%rax
+  80288f:	89 c3                	mov    %eax,%ebx
+  802891:	85 c0                	test   %eax,%eax
+  802893:	78 6e                	js     802903 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802895:	be 00 10 00 00       	mov    $0x1000,%esi
+  80289a:	4c 89 ef             	mov    %r13,%rdi
+  80289d:	48 b8 68 02 80 00 00 	movabs $0x800268,%rax
+  8028a4:	00 00 00 
+  8028a7:	ff d0                	call   *%rax
+  8028a9:	83 f8 02             	cmp    $0x2,%eax
+  8028ac:	0f 85 ab 00 00 00    	jne    80295d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028b2:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8028b9:	00 00 
+  8028bb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028bf:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028c1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028c5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028cc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028d0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028d6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028dd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028e1:	48 bb dc 0c 80 00 00 	movabs $0x800cdc,%rbx
+  8028e8:	00 00 00 
+  8028eb:	ff d3                	call   *%rbx
+  8028ed:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028f1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028f5:	ff d3                	call   *%rbx
+  8028f7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802901:	eb 4d                	jmp    802950 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802903:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802908:	4c 89 ee             	mov    %r13,%rsi
+  80290b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802910:	48 b8 a5 04 80 00 00 	movabs $0x8004a5,%rax
+  802917:	00 00 00 
+  80291a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80291c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802921:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802925:	bf 00 00 00 00       	mov    $0x0,%edi
+  80292a:	48 b8 a5 04 80 00 00 	movabs $0x8004a5,%rax
+  802931:	00 00 00 
+  802934:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802936:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80293b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80293f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802944:	48 b8 a5 04 80 00 00 	movabs $0x8004a5,%rax
+  80294b:	00 00 00 
+  80294e:	ff d0                	call   *%rax
+}
+  802950:	89 d8                	mov    %ebx,%eax
+  802952:	48 83 c4 18          	add    $0x18,%rsp
+  802956:	5b                   	pop    %rbx
+  802957:	41 5c                	pop    %r12
+  802959:	41 5d                	pop    %r13
+  80295b:	5d                   	pop    %rbp
+  80295c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80295d:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  802964:	00 00 00 
+  802967:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  80296e:	00 00 00 
+  802971:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802976:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  80297d:	00 00 00 
+  802980:	b8 00 00 00 00       	mov    $0x0,%eax
+  802985:	49 b8 65 2f 80 00 00 	movabs $0x802f65,%r8
+  80298c:	00 00 00 
+  80298f:	41 ff d0             	call   *%r8
+
+0000000000802992 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802992:	55                   	push   %rbp
+  802993:	48 89 e5             	mov    %rsp,%rbp
+  802996:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80299a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80299e:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  8029a5:	00 00 00 
+  8029a8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029aa:	85 c0                	test   %eax,%eax
+  8029ac:	78 35                	js     8029e3 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029ae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029b2:	48 b8 ee 0c 80 00 00 	movabs $0x800cee,%rax
+  8029b9:	00 00 00 
+  8029bc:	ff d0                	call   *%rax
+  8029be:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029c1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029c6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029cb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029cf:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  8029d6:	00 00 00 
+  8029d9:	ff d0                	call   *%rax
+  8029db:	85 c0                	test   %eax,%eax
+  8029dd:	0f 94 c0             	sete   %al
+  8029e0:	0f b6 c0             	movzbl %al,%eax
+}
+  8029e3:	c9                   	leave
+  8029e4:	c3                   	ret
+
+00000000008029e5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029e5:	48 89 f8             	mov    %rdi,%rax
+  8029e8:	48 c1 e8 27          	shr    $0x27,%rax
+  8029ec:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8029f3:	7f 00 00 
+  8029f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029fa:	f6 c2 01             	test   $0x1,%dl
+  8029fd:	74 6d                	je     802a6c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029ff:	48 89 f8             	mov    %rdi,%rax
+  802a02:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a06:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a0d:	7f 00 00 
+  802a10:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a14:	f6 c2 01             	test   $0x1,%dl
+  802a17:	74 62                	je     802a7b <get_uvpt_entry+0x96>
+  802a19:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a20:	7f 00 00 
+  802a23:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a27:	f6 c2 80             	test   $0x80,%dl
+  802a2a:	75 4f                	jne    802a7b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a2c:	48 89 f8             	mov    %rdi,%rax
+  802a2f:	48 c1 e8 15          	shr    $0x15,%rax
+  802a33:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a3a:	7f 00 00 
+  802a3d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a41:	f6 c2 01             	test   $0x1,%dl
+  802a44:	74 44                	je     802a8a <get_uvpt_entry+0xa5>
+  802a46:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a4d:	7f 00 00 
+  802a50:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a54:	f6 c2 80             	test   $0x80,%dl
+  802a57:	75 31                	jne    802a8a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a59:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a5d:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a64:	7f 00 00 
+  802a67:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a6b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a6c:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a73:	7f 00 00 
+  802a76:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a7a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a7b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a82:	7f 00 00 
+  802a85:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a89:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a8a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a91:	7f 00 00 
+  802a94:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a98:	c3                   	ret
+
+0000000000802a99 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802a99:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a9c:	48 89 f9             	mov    %rdi,%rcx
+  802a9f:	48 c1 e9 27          	shr    $0x27,%rcx
+  802aa3:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802aaa:	7f 00 00 
+  802aad:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802ab1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802ab8:	f6 c1 01             	test   $0x1,%cl
+  802abb:	0f 84 b2 00 00 00    	je     802b73 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802ac1:	48 89 f9             	mov    %rdi,%rcx
+  802ac4:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802ac8:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802acf:	7f 00 00 
+  802ad2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802ad6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802add:	40 f6 c6 01          	test   $0x1,%sil
+  802ae1:	0f 84 8c 00 00 00    	je     802b73 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802ae7:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802aee:	7f 00 00 
+  802af1:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802af5:	a8 80                	test   $0x80,%al
+  802af7:	75 7b                	jne    802b74 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802af9:	48 89 f9             	mov    %rdi,%rcx
+  802afc:	48 c1 e9 15          	shr    $0x15,%rcx
+  802b00:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b07:	7f 00 00 
+  802b0a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b0e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802b15:	40 f6 c6 01          	test   $0x1,%sil
+  802b19:	74 58                	je     802b73 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802b1b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b22:	7f 00 00 
+  802b25:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b29:	a8 80                	test   $0x80,%al
+  802b2b:	75 6c                	jne    802b99 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b2d:	48 89 f9             	mov    %rdi,%rcx
+  802b30:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802b34:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b3b:	7f 00 00 
+  802b3e:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b42:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b49:	40 f6 c6 01          	test   $0x1,%sil
+  802b4d:	74 24                	je     802b73 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b4f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b56:	7f 00 00 
+  802b59:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b5d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b64:	ff ff 7f 
+  802b67:	48 21 c8             	and    %rcx,%rax
+  802b6a:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b70:	48 09 d0             	or     %rdx,%rax
+}
+  802b73:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b74:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b7b:	7f 00 00 
+  802b7e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b82:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b89:	ff ff 7f 
+  802b8c:	48 21 c8             	and    %rcx,%rax
+  802b8f:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802b95:	48 01 d0             	add    %rdx,%rax
+  802b98:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802b99:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802ba0:	7f 00 00 
+  802ba3:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802ba7:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802bae:	ff ff 7f 
+  802bb1:	48 21 c8             	and    %rcx,%rax
+  802bb4:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802bba:	48 01 d0             	add    %rdx,%rax
+  802bbd:	c3                   	ret
+
+0000000000802bbe <get_prot>:
+
+int
+get_prot(void *va) {
+  802bbe:	55                   	push   %rbp
+  802bbf:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bc2:	48 b8 e5 29 80 00 00 	movabs $0x8029e5,%rax
+  802bc9:	00 00 00 
+  802bcc:	ff d0                	call   *%rax
+  802bce:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802bd1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802bd6:	89 c1                	mov    %eax,%ecx
+  802bd8:	83 c9 04             	or     $0x4,%ecx
+  802bdb:	f6 c2 01             	test   $0x1,%dl
+  802bde:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802be1:	89 c1                	mov    %eax,%ecx
+  802be3:	83 c9 02             	or     $0x2,%ecx
+  802be6:	f6 c2 02             	test   $0x2,%dl
+  802be9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802bec:	89 c1                	mov    %eax,%ecx
+  802bee:	83 c9 01             	or     $0x1,%ecx
+  802bf1:	48 85 d2             	test   %rdx,%rdx
+  802bf4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bf7:	89 c1                	mov    %eax,%ecx
+  802bf9:	83 c9 40             	or     $0x40,%ecx
+  802bfc:	f6 c6 04             	test   $0x4,%dh
+  802bff:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802c02:	5d                   	pop    %rbp
+  802c03:	c3                   	ret
+
+0000000000802c04 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802c04:	55                   	push   %rbp
+  802c05:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802c08:	48 b8 e5 29 80 00 00 	movabs $0x8029e5,%rax
+  802c0f:	00 00 00 
+  802c12:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802c14:	48 c1 e8 06          	shr    $0x6,%rax
+  802c18:	83 e0 01             	and    $0x1,%eax
+}
+  802c1b:	5d                   	pop    %rbp
+  802c1c:	c3                   	ret
+
+0000000000802c1d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802c1d:	55                   	push   %rbp
+  802c1e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802c21:	48 b8 e5 29 80 00 00 	movabs $0x8029e5,%rax
+  802c28:	00 00 00 
+  802c2b:	ff d0                	call   *%rax
+  802c2d:	83 e0 01             	and    $0x1,%eax
+}
+  802c30:	5d                   	pop    %rbp
+  802c31:	c3                   	ret
+
+0000000000802c32 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802c32:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802c39:	7f 00 00 
+  802c3c:	a8 01                	test   $0x1,%al
+  802c3e:	75 06                	jne    802c46 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802c40:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c45:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c46:	55                   	push   %rbp
+  802c47:	48 89 e5             	mov    %rsp,%rbp
+  802c4a:	41 57                	push   %r15
+  802c4c:	41 56                	push   %r14
+  802c4e:	41 55                	push   %r13
+  802c50:	41 54                	push   %r12
+  802c52:	53                   	push   %rbx
+  802c53:	48 83 ec 18          	sub    $0x18,%rsp
+  802c57:	49 89 fe             	mov    %rdi,%r14
+  802c5a:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c5d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c64:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c65:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c6c:	7f 00 00 
+  802c6f:	e9 81 00 00 00       	jmp    802cf5 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c74:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c7b:	49 39 dd             	cmp    %rbx,%r13
+  802c7e:	74 2b                	je     802cab <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c80:	48 89 d8             	mov    %rbx,%rax
+  802c83:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c87:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802c8b:	f6 c2 01             	test   $0x1,%dl
+  802c8e:	74 e4                	je     802c74 <foreach_shared_region+0x42>
+  802c90:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802c94:	f6 c4 04             	test   $0x4,%ah
+  802c97:	74 db                	je     802c74 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802c99:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802ca0:	4c 89 fa             	mov    %r15,%rdx
+  802ca3:	48 89 df             	mov    %rbx,%rdi
+  802ca6:	41 ff d6             	call   *%r14
+  802ca9:	eb c9                	jmp    802c74 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cab:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802cb2:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802cb6:	74 22                	je     802cda <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802cb8:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802cbf:	48 89 d8             	mov    %rbx,%rax
+  802cc2:	48 c1 e8 15          	shr    $0x15,%rax
+  802cc6:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802ccd:	7f 00 00 
+  802cd0:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802cd4:	a8 01                	test   $0x1,%al
+  802cd6:	74 d3                	je     802cab <foreach_shared_region+0x79>
+  802cd8:	eb a6                	jmp    802c80 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802cda:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802ce1:	40 
+  802ce2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802ce6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ced:	00 00 00 
+  802cf0:	48 39 c1             	cmp    %rax,%rcx
+  802cf3:	74 31                	je     802d26 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802cf5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cf9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cfd:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802d04:	7f 00 00 
+  802d07:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802d0b:	a8 01                	test   $0x1,%al
+  802d0d:	74 cb                	je     802cda <foreach_shared_region+0xa8>
+  802d0f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d13:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802d1a:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802d20:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802d24:	eb 92                	jmp    802cb8 <foreach_shared_region+0x86>
+}
+  802d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2b:	48 83 c4 18          	add    $0x18,%rsp
+  802d2f:	5b                   	pop    %rbx
+  802d30:	41 5c                	pop    %r12
+  802d32:	41 5d                	pop    %r13
+  802d34:	41 5e                	pop    %r14
+  802d36:	41 5f                	pop    %r15
+  802d38:	5d                   	pop    %rbp
+  802d39:	c3                   	ret
+
+0000000000802d3a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d3f:	c3                   	ret
+
+0000000000802d40 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d40:	55                   	push   %rbp
+  802d41:	48 89 e5             	mov    %rsp,%rbp
+  802d44:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d47:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d4e:	00 00 00 
+  802d51:	48 b8 2d 3a 80 00 00 	movabs $0x803a2d,%rax
+  802d58:	00 00 00 
+  802d5b:	ff d0                	call   *%rax
+    return 0;
+}
+  802d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d62:	5d                   	pop    %rbp
+  802d63:	c3                   	ret
+
+0000000000802d64 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d64:	55                   	push   %rbp
+  802d65:	48 89 e5             	mov    %rsp,%rbp
+  802d68:	41 57                	push   %r15
+  802d6a:	41 56                	push   %r14
+  802d6c:	41 55                	push   %r13
+  802d6e:	41 54                	push   %r12
+  802d70:	53                   	push   %rbx
+  802d71:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d78:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d7f:	48 85 d2             	test   %rdx,%rdx
+  802d82:	74 7a                	je     802dfe <devcons_write+0x9a>
+  802d84:	49 89 d6             	mov    %rdx,%r14
+  802d87:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d8d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d92:	49 bf bb 3d 80 00 00 	movabs $0x803dbb,%r15
+  802d99:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d9c:	4c 89 f3             	mov    %r14,%rbx
+  802d9f:	48 29 f3             	sub    %rsi,%rbx
+  802da2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802da7:	48 39 c3             	cmp    %rax,%rbx
+  802daa:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802dae:	4c 63 eb             	movslq %ebx,%r13
+  802db1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802db8:	48 01 c6             	add    %rax,%rsi
+  802dbb:	4c 89 ea             	mov    %r13,%rdx
+  802dbe:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802dc5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802dc8:	4c 89 ee             	mov    %r13,%rsi
+  802dcb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802dd2:	48 b8 3d 01 80 00 00 	movabs $0x80013d,%rax
+  802dd9:	00 00 00 
+  802ddc:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802dde:	41 01 dc             	add    %ebx,%r12d
+  802de1:	49 63 f4             	movslq %r12d,%rsi
+  802de4:	4c 39 f6             	cmp    %r14,%rsi
+  802de7:	72 b3                	jb     802d9c <devcons_write+0x38>
+    return res;
+  802de9:	49 63 c4             	movslq %r12d,%rax
+}
+  802dec:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802df3:	5b                   	pop    %rbx
+  802df4:	41 5c                	pop    %r12
+  802df6:	41 5d                	pop    %r13
+  802df8:	41 5e                	pop    %r14
+  802dfa:	41 5f                	pop    %r15
+  802dfc:	5d                   	pop    %rbp
+  802dfd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802dfe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e04:	eb e3                	jmp    802de9 <devcons_write+0x85>
+
+0000000000802e06 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e06:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802e09:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e0e:	48 85 c0             	test   %rax,%rax
+  802e11:	74 55                	je     802e68 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e13:	55                   	push   %rbp
+  802e14:	48 89 e5             	mov    %rsp,%rbp
+  802e17:	41 55                	push   %r13
+  802e19:	41 54                	push   %r12
+  802e1b:	53                   	push   %rbx
+  802e1c:	48 83 ec 08          	sub    $0x8,%rsp
+  802e20:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802e23:	48 bb 6a 01 80 00 00 	movabs $0x80016a,%rbx
+  802e2a:	00 00 00 
+  802e2d:	49 bc 37 02 80 00 00 	movabs $0x800237,%r12
+  802e34:	00 00 00 
+  802e37:	eb 03                	jmp    802e3c <devcons_read+0x36>
+  802e39:	41 ff d4             	call   *%r12
+  802e3c:	ff d3                	call   *%rbx
+  802e3e:	85 c0                	test   %eax,%eax
+  802e40:	74 f7                	je     802e39 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e42:	48 63 d0             	movslq %eax,%rdx
+  802e45:	78 13                	js     802e5a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e47:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e4c:	83 f8 04             	cmp    $0x4,%eax
+  802e4f:	74 09                	je     802e5a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e51:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e55:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e5a:	48 89 d0             	mov    %rdx,%rax
+  802e5d:	48 83 c4 08          	add    $0x8,%rsp
+  802e61:	5b                   	pop    %rbx
+  802e62:	41 5c                	pop    %r12
+  802e64:	41 5d                	pop    %r13
+  802e66:	5d                   	pop    %rbp
+  802e67:	c3                   	ret
+  802e68:	48 89 d0             	mov    %rdx,%rax
+  802e6b:	c3                   	ret
+
+0000000000802e6c <cputchar>:
+cputchar(int ch) {
+  802e6c:	55                   	push   %rbp
+  802e6d:	48 89 e5             	mov    %rsp,%rbp
+  802e70:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e74:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e78:	be 01 00 00 00       	mov    $0x1,%esi
+  802e7d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e81:	48 b8 3d 01 80 00 00 	movabs $0x80013d,%rax
+  802e88:	00 00 00 
+  802e8b:	ff d0                	call   *%rax
+}
+  802e8d:	c9                   	leave
+  802e8e:	c3                   	ret
+
+0000000000802e8f <getchar>:
+getchar(void) {
+  802e8f:	55                   	push   %rbp
+  802e90:	48 89 e5             	mov    %rsp,%rbp
+  802e93:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e97:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e9c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802ea0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea5:	48 b8 4d 10 80 00 00 	movabs $0x80104d,%rax
+  802eac:	00 00 00 
+  802eaf:	ff d0                	call   *%rax
+  802eb1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802eb3:	85 c0                	test   %eax,%eax
+  802eb5:	78 06                	js     802ebd <getchar+0x2e>
+  802eb7:	74 08                	je     802ec1 <getchar+0x32>
+  802eb9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802ebd:	89 d0                	mov    %edx,%eax
+  802ebf:	c9                   	leave
+  802ec0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802ec1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802ec6:	eb f5                	jmp    802ebd <getchar+0x2e>
+
+0000000000802ec8 <iscons>:
+iscons(int fdnum) {
+  802ec8:	55                   	push   %rbp
+  802ec9:	48 89 e5             	mov    %rsp,%rbp
+  802ecc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ed0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ed4:	48 b8 6a 0d 80 00 00 	movabs $0x800d6a,%rax
+  802edb:	00 00 00 
+  802ede:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ee0:	85 c0                	test   %eax,%eax
+  802ee2:	78 18                	js     802efc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ee4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ee8:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802eef:	00 00 00 
+  802ef2:	8b 00                	mov    (%rax),%eax
+  802ef4:	39 02                	cmp    %eax,(%rdx)
+  802ef6:	0f 94 c0             	sete   %al
+  802ef9:	0f b6 c0             	movzbl %al,%eax
+}
+  802efc:	c9                   	leave
+  802efd:	c3                   	ret
+
+0000000000802efe <opencons>:
+opencons(void) {
+  802efe:	55                   	push   %rbp
+  802eff:	48 89 e5             	mov    %rsp,%rbp
+  802f02:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f06:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802f0a:	48 b8 0a 0d 80 00 00 	movabs $0x800d0a,%rax
+  802f11:	00 00 00 
+  802f14:	ff d0                	call   *%rax
+  802f16:	85 c0                	test   %eax,%eax
+  802f18:	78 49                	js     802f63 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802f1a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f1f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f24:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2d:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  802f34:	00 00 00 
+  802f37:	ff d0                	call   *%rax
+  802f39:	85 c0                	test   %eax,%eax
+  802f3b:	78 26                	js     802f63 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f3d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f41:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802f48:	00 00 
+  802f4a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f4c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f50:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f57:	48 b8 dc 0c 80 00 00 	movabs $0x800cdc,%rax
+  802f5e:	00 00 00 
+  802f61:	ff d0                	call   *%rax
+}
+  802f63:	c9                   	leave
+  802f64:	c3                   	ret
+
+0000000000802f65 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f65:	55                   	push   %rbp
+  802f66:	48 89 e5             	mov    %rsp,%rbp
+  802f69:	41 56                	push   %r14
+  802f6b:	41 55                	push   %r13
+  802f6d:	41 54                	push   %r12
+  802f6f:	53                   	push   %rbx
+  802f70:	48 83 ec 50          	sub    $0x50,%rsp
+  802f74:	49 89 fc             	mov    %rdi,%r12
+  802f77:	41 89 f5             	mov    %esi,%r13d
+  802f7a:	48 89 d3             	mov    %rdx,%rbx
+  802f7d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802f81:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802f85:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f89:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802f90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f94:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f98:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802f9c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fa0:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802fa7:	00 00 00 
+  802faa:	4c 8b 30             	mov    (%rax),%r14
+  802fad:	48 b8 06 02 80 00 00 	movabs $0x800206,%rax
+  802fb4:	00 00 00 
+  802fb7:	ff d0                	call   *%rax
+  802fb9:	89 c6                	mov    %eax,%esi
+  802fbb:	45 89 e8             	mov    %r13d,%r8d
+  802fbe:	4c 89 e1             	mov    %r12,%rcx
+  802fc1:	4c 89 f2             	mov    %r14,%rdx
+  802fc4:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802fcb:	00 00 00 
+  802fce:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd3:	49 bc b5 30 80 00 00 	movabs $0x8030b5,%r12
+  802fda:	00 00 00 
+  802fdd:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802fe0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802fe4:	48 89 df             	mov    %rbx,%rdi
+  802fe7:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  802fee:	00 00 00 
+  802ff1:	ff d0                	call   *%rax
+    cprintf("\n");
+  802ff3:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  802ffa:	00 00 00 
+  802ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803002:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803005:	cc                   	int3
+  803006:	eb fd                	jmp    803005 <_panic+0xa0>
+
+0000000000803008 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803008:	55                   	push   %rbp
+  803009:	48 89 e5             	mov    %rsp,%rbp
+  80300c:	53                   	push   %rbx
+  80300d:	48 83 ec 08          	sub    $0x8,%rsp
+  803011:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803014:	8b 06                	mov    (%rsi),%eax
+  803016:	8d 50 01             	lea    0x1(%rax),%edx
+  803019:	89 16                	mov    %edx,(%rsi)
+  80301b:	48 98                	cltq
+  80301d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803022:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803028:	74 0a                	je     803034 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80302a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80302e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803032:	c9                   	leave
+  803033:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803034:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803038:	be ff 00 00 00       	mov    $0xff,%esi
+  80303d:	48 b8 3d 01 80 00 00 	movabs $0x80013d,%rax
+  803044:	00 00 00 
+  803047:	ff d0                	call   *%rax
+        state->offset = 0;
+  803049:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80304f:	eb d9                	jmp    80302a <putch+0x22>
+
+0000000000803051 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803051:	55                   	push   %rbp
+  803052:	48 89 e5             	mov    %rsp,%rbp
+  803055:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80305c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80305f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803066:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80306b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803070:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803073:	48 89 f1             	mov    %rsi,%rcx
+  803076:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80307d:	48 bf 08 30 80 00 00 	movabs $0x803008,%rdi
+  803084:	00 00 00 
+  803087:	48 b8 05 32 80 00 00 	movabs $0x803205,%rax
+  80308e:	00 00 00 
+  803091:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803093:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80309a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8030a1:	48 b8 3d 01 80 00 00 	movabs $0x80013d,%rax
+  8030a8:	00 00 00 
+  8030ab:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8030ad:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8030b3:	c9                   	leave
+  8030b4:	c3                   	ret
+
+00000000008030b5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8030b5:	55                   	push   %rbp
+  8030b6:	48 89 e5             	mov    %rsp,%rbp
+  8030b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8030bd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8030c1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8030c5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8030c9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8030cd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8030d1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8030d8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030e0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030e4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8030e8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8030ec:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8030f8:	c9                   	leave
+  8030f9:	c3                   	ret
+
+00000000008030fa <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8030fa:	55                   	push   %rbp
+  8030fb:	48 89 e5             	mov    %rsp,%rbp
+  8030fe:	41 57                	push   %r15
+  803100:	41 56                	push   %r14
+  803102:	41 55                	push   %r13
+  803104:	41 54                	push   %r12
+  803106:	53                   	push   %rbx
+  803107:	48 83 ec 18          	sub    $0x18,%rsp
+  80310b:	49 89 fc             	mov    %rdi,%r12
+  80310e:	49 89 f5             	mov    %rsi,%r13
+  803111:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803115:	8b 45 10             	mov    0x10(%rbp),%eax
+  803118:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80311b:	41 89 cf             	mov    %ecx,%r15d
+  80311e:	4c 39 fa             	cmp    %r15,%rdx
+  803121:	73 5b                	jae    80317e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803123:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803127:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80312b:	85 db                	test   %ebx,%ebx
+  80312d:	7e 0e                	jle    80313d <print_num+0x43>
+            putch(padc, put_arg);
+  80312f:	4c 89 ee             	mov    %r13,%rsi
+  803132:	44 89 f7             	mov    %r14d,%edi
+  803135:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803138:	83 eb 01             	sub    $0x1,%ebx
+  80313b:	75 f2                	jne    80312f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80313d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803141:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  803148:	00 00 00 
+  80314b:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  803152:	00 00 00 
+  803155:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803159:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80315d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803162:	49 f7 f7             	div    %r15
+  803165:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803169:	4c 89 ee             	mov    %r13,%rsi
+  80316c:	41 ff d4             	call   *%r12
+}
+  80316f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803173:	5b                   	pop    %rbx
+  803174:	41 5c                	pop    %r12
+  803176:	41 5d                	pop    %r13
+  803178:	41 5e                	pop    %r14
+  80317a:	41 5f                	pop    %r15
+  80317c:	5d                   	pop    %rbp
+  80317d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80317e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803182:	ba 00 00 00 00       	mov    $0x0,%edx
+  803187:	49 f7 f7             	div    %r15
+  80318a:	48 83 ec 08          	sub    $0x8,%rsp
+  80318e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803192:	52                   	push   %rdx
+  803193:	45 0f be c9          	movsbl %r9b,%r9d
+  803197:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80319b:	48 89 c2             	mov    %rax,%rdx
+  80319e:	48 b8 fa 30 80 00 00 	movabs $0x8030fa,%rax
+  8031a5:	00 00 00 
+  8031a8:	ff d0                	call   *%rax
+  8031aa:	48 83 c4 10          	add    $0x10,%rsp
+  8031ae:	eb 8d                	jmp    80313d <print_num+0x43>
+
+00000000008031b0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8031b0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8031b4:	48 8b 06             	mov    (%rsi),%rax
+  8031b7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8031bb:	73 0a                	jae    8031c7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8031bd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8031c1:	48 89 16             	mov    %rdx,(%rsi)
+  8031c4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8031c7:	c3                   	ret
+
+00000000008031c8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8031c8:	55                   	push   %rbp
+  8031c9:	48 89 e5             	mov    %rsp,%rbp
+  8031cc:	48 83 ec 50          	sub    $0x50,%rsp
+  8031d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8031d4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8031d8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8031dc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8031e3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031eb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031ef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8031f3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8031f7:	48 b8 05 32 80 00 00 	movabs $0x803205,%rax
+  8031fe:	00 00 00 
+  803201:	ff d0                	call   *%rax
+}
+  803203:	c9                   	leave
+  803204:	c3                   	ret
+
+0000000000803205 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  803205:	55                   	push   %rbp
+  803206:	48 89 e5             	mov    %rsp,%rbp
+  803209:	41 57                	push   %r15
+  80320b:	41 56                	push   %r14
+  80320d:	41 55                	push   %r13
+  80320f:	41 54                	push   %r12
+  803211:	53                   	push   %rbx
+  803212:	48 83 ec 38          	sub    $0x38,%rsp
+  803216:	49 89 fe             	mov    %rdi,%r14
+  803219:	49 89 f5             	mov    %rsi,%r13
+  80321c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80321f:	48 8b 01             	mov    (%rcx),%rax
+  803222:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803226:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80322a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80322e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803232:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803236:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80323a:	0f b6 3b             	movzbl (%rbx),%edi
+  80323d:	40 80 ff 25          	cmp    $0x25,%dil
+  803241:	74 18                	je     80325b <vprintfmt+0x56>
+            if (!ch) return;
+  803243:	40 84 ff             	test   %dil,%dil
+  803246:	0f 84 04 07 00 00    	je     803950 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80324c:	40 0f b6 ff          	movzbl %dil,%edi
+  803250:	4c 89 ee             	mov    %r13,%rsi
+  803253:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803256:	4c 89 e3             	mov    %r12,%rbx
+  803259:	eb db                	jmp    803236 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80325b:	be 00 00 00 00       	mov    $0x0,%esi
+  803260:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803264:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803269:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80326f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803276:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80327a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80327f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803284:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803287:	83 e8 23             	sub    $0x23,%eax
+  80328a:	3c 57                	cmp    $0x57,%al
+  80328c:	0f 87 a4 06 00 00    	ja     803936 <vprintfmt+0x731>
+  803292:	0f b6 c0             	movzbl %al,%eax
+  803295:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  80329c:	00 00 00 
+  80329f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8032a2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8032a5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8032a9:	eb cf                	jmp    80327a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8032ab:	49 89 dc             	mov    %rbx,%r12
+  8032ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8032b3:	eb c5                	jmp    80327a <vprintfmt+0x75>
+            padc = ch;
+  8032b5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8032b9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8032bc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8032bf:	eb b9                	jmp    80327a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8032c7:	77 24                	ja     8032ed <vprintfmt+0xe8>
+  8032c9:	89 c1                	mov    %eax,%ecx
+  8032cb:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8032cf:	83 c0 08             	add    $0x8,%eax
+  8032d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032d5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8032d8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8032db:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8032df:	79 99                	jns    80327a <vprintfmt+0x75>
+                width = precision;
+  8032e1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8032e5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8032eb:	eb 8d                	jmp    80327a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032ed:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032f1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8032f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032f9:	eb da                	jmp    8032d5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8032fb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  803300:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803304:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80330a:	3c 39                	cmp    $0x39,%al
+  80330c:	77 1c                	ja     80332a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80330e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  803312:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803316:	0f b6 c0             	movzbl %al,%eax
+  803319:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80331e:	0f b6 03             	movzbl (%rbx),%eax
+  803321:	3c 39                	cmp    $0x39,%al
+  803323:	76 e9                	jbe    80330e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803325:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803328:	eb b1                	jmp    8032db <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80332a:	49 89 dc             	mov    %rbx,%r12
+  80332d:	eb ac                	jmp    8032db <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80332f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803332:	85 c9                	test   %ecx,%ecx
+  803334:	b8 00 00 00 00       	mov    $0x0,%eax
+  803339:	0f 49 c1             	cmovns %ecx,%eax
+  80333c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80333f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803342:	e9 33 ff ff ff       	jmp    80327a <vprintfmt+0x75>
+            lflag++;
+  803347:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80334a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80334d:	e9 28 ff ff ff       	jmp    80327a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803352:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803355:	83 f8 2f             	cmp    $0x2f,%eax
+  803358:	77 19                	ja     803373 <vprintfmt+0x16e>
+  80335a:	89 c2                	mov    %eax,%edx
+  80335c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803360:	83 c0 08             	add    $0x8,%eax
+  803363:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803366:	8b 3a                	mov    (%rdx),%edi
+  803368:	4c 89 ee             	mov    %r13,%rsi
+  80336b:	41 ff d6             	call   *%r14
+            break;
+  80336e:	e9 c3 fe ff ff       	jmp    803236 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803373:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803377:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80337b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80337f:	eb e5                	jmp    803366 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803381:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803384:	83 f8 2f             	cmp    $0x2f,%eax
+  803387:	77 5a                	ja     8033e3 <vprintfmt+0x1de>
+  803389:	89 c2                	mov    %eax,%edx
+  80338b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80338f:	83 c0 08             	add    $0x8,%eax
+  803392:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803395:	8b 02                	mov    (%rdx),%eax
+  803397:	89 c1                	mov    %eax,%ecx
+  803399:	f7 d9                	neg    %ecx
+  80339b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80339e:	83 f9 13             	cmp    $0x13,%ecx
+  8033a1:	7f 4e                	jg     8033f1 <vprintfmt+0x1ec>
+  8033a3:	48 63 c1             	movslq %ecx,%rax
+  8033a6:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  8033ad:	00 00 00 
+  8033b0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033b4:	48 85 c0             	test   %rax,%rax
+  8033b7:	74 38                	je     8033f1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8033b9:	48 89 c1             	mov    %rax,%rcx
+  8033bc:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  8033c3:	00 00 00 
+  8033c6:	4c 89 ee             	mov    %r13,%rsi
+  8033c9:	4c 89 f7             	mov    %r14,%rdi
+  8033cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d1:	49 b8 c8 31 80 00 00 	movabs $0x8031c8,%r8
+  8033d8:	00 00 00 
+  8033db:	41 ff d0             	call   *%r8
+  8033de:	e9 53 fe ff ff       	jmp    803236 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8033e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033ef:	eb a4                	jmp    803395 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8033f1:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  8033f8:	00 00 00 
+  8033fb:	4c 89 ee             	mov    %r13,%rsi
+  8033fe:	4c 89 f7             	mov    %r14,%rdi
+  803401:	b8 00 00 00 00       	mov    $0x0,%eax
+  803406:	49 b8 c8 31 80 00 00 	movabs $0x8031c8,%r8
+  80340d:	00 00 00 
+  803410:	41 ff d0             	call   *%r8
+  803413:	e9 1e fe ff ff       	jmp    803236 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803418:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80341b:	83 f8 2f             	cmp    $0x2f,%eax
+  80341e:	77 36                	ja     803456 <vprintfmt+0x251>
+  803420:	89 c2                	mov    %eax,%edx
+  803422:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803426:	83 c0 08             	add    $0x8,%eax
+  803429:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80342c:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80342f:	48 85 f6             	test   %rsi,%rsi
+  803432:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  803439:	00 00 00 
+  80343c:	48 0f 45 c6          	cmovne %rsi,%rax
+  803440:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803444:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803448:	7e 06                	jle    803450 <vprintfmt+0x24b>
+  80344a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80344e:	75 14                	jne    803464 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803450:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803454:	eb 5b                	jmp    8034b1 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  803456:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80345a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80345e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803462:	eb c8                	jmp    80342c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803464:	49 63 f7             	movslq %r15d,%rsi
+  803467:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80346b:	48 b8 0a 3a 80 00 00 	movabs $0x803a0a,%rax
+  803472:	00 00 00 
+  803475:	ff d0                	call   *%rax
+  803477:	48 89 c2             	mov    %rax,%rdx
+  80347a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80347d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80347f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803482:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803485:	85 c0                	test   %eax,%eax
+  803487:	7e c7                	jle    803450 <vprintfmt+0x24b>
+  803489:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80348e:	4c 89 ee             	mov    %r13,%rsi
+  803491:	44 89 e7             	mov    %r12d,%edi
+  803494:	41 ff d6             	call   *%r14
+  803497:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80349b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80349e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8034a1:	75 eb                	jne    80348e <vprintfmt+0x289>
+  8034a3:	eb ab                	jmp    803450 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8034a5:	0f b6 f8             	movzbl %al,%edi
+  8034a8:	4c 89 ee             	mov    %r13,%rsi
+  8034ab:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8034ae:	4c 89 e2             	mov    %r12,%rdx
+  8034b1:	45 85 ff             	test   %r15d,%r15d
+  8034b4:	78 06                	js     8034bc <vprintfmt+0x2b7>
+  8034b6:	41 83 ef 01          	sub    $0x1,%r15d
+  8034ba:	78 23                	js     8034df <vprintfmt+0x2da>
+  8034bc:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8034c0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8034c6:	84 c0                	test   %al,%al
+  8034c8:	74 15                	je     8034df <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8034ca:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8034ce:	74 d5                	je     8034a5 <vprintfmt+0x2a0>
+  8034d0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8034d3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8034d8:	80 fa 5e             	cmp    $0x5e,%dl
+  8034db:	77 cb                	ja     8034a8 <vprintfmt+0x2a3>
+  8034dd:	eb c6                	jmp    8034a5 <vprintfmt+0x2a0>
+  8034df:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8034e2:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8034e5:	01 f0                	add    %esi,%eax
+  8034e7:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8034e9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8034ed:	85 c0                	test   %eax,%eax
+  8034ef:	0f 8e 41 fd ff ff    	jle    803236 <vprintfmt+0x31>
+  8034f5:	4c 89 ee             	mov    %r13,%rsi
+  8034f8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8034fd:	41 ff d6             	call   *%r14
+  803500:	41 83 ec 01          	sub    $0x1,%r12d
+  803504:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803508:	75 eb                	jne    8034f5 <vprintfmt+0x2f0>
+  80350a:	e9 27 fd ff ff       	jmp    803236 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80350f:	40 84 f6             	test   %sil,%sil
+  803512:	75 26                	jne    80353a <vprintfmt+0x335>
+    switch (lflag) {
+  803514:	85 d2                	test   %edx,%edx
+  803516:	74 59                	je     803571 <vprintfmt+0x36c>
+  803518:	83 fa 01             	cmp    $0x1,%edx
+  80351b:	74 7b                	je     803598 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80351d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803520:	83 f8 2f             	cmp    $0x2f,%eax
+  803523:	0f 87 96 00 00 00    	ja     8035bf <vprintfmt+0x3ba>
+  803529:	89 c2                	mov    %eax,%edx
+  80352b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80352f:	83 c0 08             	add    $0x8,%eax
+  803532:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803535:	4c 8b 22             	mov    (%rdx),%r12
+  803538:	eb 17                	jmp    803551 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80353a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80353d:	83 f8 2f             	cmp    $0x2f,%eax
+  803540:	77 21                	ja     803563 <vprintfmt+0x35e>
+  803542:	89 c2                	mov    %eax,%edx
+  803544:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803548:	83 c0 08             	add    $0x8,%eax
+  80354b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80354e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803551:	4d 85 e4             	test   %r12,%r12
+  803554:	78 7a                	js     8035d0 <vprintfmt+0x3cb>
+            num = i;
+  803556:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803559:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80355e:	e9 b5 02 00 00       	jmp    803818 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803563:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803567:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80356b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80356f:	eb dd                	jmp    80354e <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  803571:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803574:	83 f8 2f             	cmp    $0x2f,%eax
+  803577:	77 11                	ja     80358a <vprintfmt+0x385>
+  803579:	89 c2                	mov    %eax,%edx
+  80357b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80357f:	83 c0 08             	add    $0x8,%eax
+  803582:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803585:	4c 63 22             	movslq (%rdx),%r12
+  803588:	eb c7                	jmp    803551 <vprintfmt+0x34c>
+  80358a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80358e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803592:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803596:	eb ed                	jmp    803585 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  803598:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80359b:	83 f8 2f             	cmp    $0x2f,%eax
+  80359e:	77 11                	ja     8035b1 <vprintfmt+0x3ac>
+  8035a0:	89 c2                	mov    %eax,%edx
+  8035a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035a6:	83 c0 08             	add    $0x8,%eax
+  8035a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035ac:	4c 8b 22             	mov    (%rdx),%r12
+  8035af:	eb a0                	jmp    803551 <vprintfmt+0x34c>
+  8035b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035bd:	eb ed                	jmp    8035ac <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8035bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035cb:	e9 65 ff ff ff       	jmp    803535 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8035d0:	4c 89 ee             	mov    %r13,%rsi
+  8035d3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8035d8:	41 ff d6             	call   *%r14
+                i = -i;
+  8035db:	49 f7 dc             	neg    %r12
+  8035de:	e9 73 ff ff ff       	jmp    803556 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8035e3:	40 84 f6             	test   %sil,%sil
+  8035e6:	75 32                	jne    80361a <vprintfmt+0x415>
+    switch (lflag) {
+  8035e8:	85 d2                	test   %edx,%edx
+  8035ea:	74 5d                	je     803649 <vprintfmt+0x444>
+  8035ec:	83 fa 01             	cmp    $0x1,%edx
+  8035ef:	0f 84 82 00 00 00    	je     803677 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8035f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8035fb:	0f 87 a5 00 00 00    	ja     8036a6 <vprintfmt+0x4a1>
+  803601:	89 c2                	mov    %eax,%edx
+  803603:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803607:	83 c0 08             	add    $0x8,%eax
+  80360a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80360d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803610:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803615:	e9 fe 01 00 00       	jmp    803818 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80361a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80361d:	83 f8 2f             	cmp    $0x2f,%eax
+  803620:	77 19                	ja     80363b <vprintfmt+0x436>
+  803622:	89 c2                	mov    %eax,%edx
+  803624:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803628:	83 c0 08             	add    $0x8,%eax
+  80362b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80362e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803631:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803636:	e9 dd 01 00 00       	jmp    803818 <vprintfmt+0x613>
+  80363b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80363f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803643:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803647:	eb e5                	jmp    80362e <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  803649:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80364c:	83 f8 2f             	cmp    $0x2f,%eax
+  80364f:	77 18                	ja     803669 <vprintfmt+0x464>
+  803651:	89 c2                	mov    %eax,%edx
+  803653:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803657:	83 c0 08             	add    $0x8,%eax
+  80365a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80365d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80365f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803664:	e9 af 01 00 00       	jmp    803818 <vprintfmt+0x613>
+  803669:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80366d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803671:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803675:	eb e6                	jmp    80365d <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  803677:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80367a:	83 f8 2f             	cmp    $0x2f,%eax
+  80367d:	77 19                	ja     803698 <vprintfmt+0x493>
+  80367f:	89 c2                	mov    %eax,%edx
+  803681:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803685:	83 c0 08             	add    $0x8,%eax
+  803688:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80368b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80368e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803693:	e9 80 01 00 00       	jmp    803818 <vprintfmt+0x613>
+  803698:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80369c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8036a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036a4:	eb e5                	jmp    80368b <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8036a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8036aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8036ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036b2:	e9 56 ff ff ff       	jmp    80360d <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8036b7:	40 84 f6             	test   %sil,%sil
+  8036ba:	75 2e                	jne    8036ea <vprintfmt+0x4e5>
+    switch (lflag) {
+  8036bc:	85 d2                	test   %edx,%edx
+  8036be:	0f 84 b3 00 00 00    	je     803777 <vprintfmt+0x572>
+  8036c4:	83 fa 01             	cmp    $0x1,%edx
+  8036c7:	0f 84 d3 00 00 00    	je     8037a0 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8036cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8036d3:	0f 87 f1 00 00 00    	ja     8037ca <vprintfmt+0x5c5>
+  8036d9:	89 c2                	mov    %eax,%edx
+  8036db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036df:	83 c0 08             	add    $0x8,%eax
+  8036e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036e5:	48 8b 02             	mov    (%rdx),%rax
+  8036e8:	eb 17                	jmp    803701 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8036f0:	77 77                	ja     803769 <vprintfmt+0x564>
+  8036f2:	89 c2                	mov    %eax,%edx
+  8036f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036f8:	83 c0 08             	add    $0x8,%eax
+  8036fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036fe:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  803701:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  803703:	83 f8 07             	cmp    $0x7,%eax
+  803706:	0f 8e cf 00 00 00    	jle    8037db <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  80370c:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  803712:	44 89 e7             	mov    %r12d,%edi
+  803715:	41 c1 e4 03          	shl    $0x3,%r12d
+  803719:	89 d1                	mov    %edx,%ecx
+  80371b:	8d 72 07             	lea    0x7(%rdx),%esi
+  80371e:	85 d2                	test   %edx,%edx
+  803720:	0f 48 d6             	cmovs  %esi,%edx
+  803723:	c1 fa 03             	sar    $0x3,%edx
+  803726:	83 f9 3f             	cmp    $0x3f,%ecx
+  803729:	7f e7                	jg     803712 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80372b:	85 ff                	test   %edi,%edi
+  80372d:	0f 84 03 fb ff ff    	je     803236 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  803733:	49 63 f4             	movslq %r12d,%rsi
+  803736:	ba 00 00 00 00       	mov    $0x0,%edx
+  80373b:	48 f7 f6             	div    %rsi
+  80373e:	49 89 d7             	mov    %rdx,%r15
+  803741:	83 c0 30             	add    $0x30,%eax
+  803744:	0f be f8             	movsbl %al,%edi
+  803747:	4c 89 ee             	mov    %r13,%rsi
+  80374a:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80374d:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  803750:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  803755:	45 85 e4             	test   %r12d,%r12d
+  803758:	41 0f 49 d4          	cmovns %r12d,%edx
+  80375c:	c1 fa 03             	sar    $0x3,%edx
+  80375f:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  803762:	75 cf                	jne    803733 <vprintfmt+0x52e>
+  803764:	e9 cd fa ff ff       	jmp    803236 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  803769:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80376d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803771:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803775:	eb 87                	jmp    8036fe <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  803777:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80377a:	83 f8 2f             	cmp    $0x2f,%eax
+  80377d:	77 13                	ja     803792 <vprintfmt+0x58d>
+  80377f:	89 c2                	mov    %eax,%edx
+  803781:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803785:	83 c0 08             	add    $0x8,%eax
+  803788:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80378b:	8b 02                	mov    (%rdx),%eax
+  80378d:	e9 6f ff ff ff       	jmp    803701 <vprintfmt+0x4fc>
+  803792:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803796:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80379a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80379e:	eb eb                	jmp    80378b <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8037a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8037a6:	77 14                	ja     8037bc <vprintfmt+0x5b7>
+  8037a8:	89 c2                	mov    %eax,%edx
+  8037aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037ae:	83 c0 08             	add    $0x8,%eax
+  8037b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037b4:	48 8b 02             	mov    (%rdx),%rax
+  8037b7:	e9 45 ff ff ff       	jmp    803701 <vprintfmt+0x4fc>
+  8037bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037c8:	eb ea                	jmp    8037b4 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8037ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037d6:	e9 0a ff ff ff       	jmp    8036e5 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8037db:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8037e1:	e9 4d ff ff ff       	jmp    803733 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8037e6:	4c 89 ee             	mov    %r13,%rsi
+  8037e9:	bf 30 00 00 00       	mov    $0x30,%edi
+  8037ee:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8037f1:	4c 89 ee             	mov    %r13,%rsi
+  8037f4:	bf 78 00 00 00       	mov    $0x78,%edi
+  8037f9:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8037fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037ff:	83 f8 2f             	cmp    $0x2f,%eax
+  803802:	77 47                	ja     80384b <vprintfmt+0x646>
+  803804:	89 c2                	mov    %eax,%edx
+  803806:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80380a:	83 c0 08             	add    $0x8,%eax
+  80380d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803810:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803813:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803818:	48 83 ec 08          	sub    $0x8,%rsp
+  80381c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803820:	0f 94 c0             	sete   %al
+  803823:	0f b6 c0             	movzbl %al,%eax
+  803826:	50                   	push   %rax
+  803827:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80382c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803830:	4c 89 ee             	mov    %r13,%rsi
+  803833:	4c 89 f7             	mov    %r14,%rdi
+  803836:	48 b8 fa 30 80 00 00 	movabs $0x8030fa,%rax
+  80383d:	00 00 00 
+  803840:	ff d0                	call   *%rax
+            break;
+  803842:	48 83 c4 10          	add    $0x10,%rsp
+  803846:	e9 eb f9 ff ff       	jmp    803236 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80384b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80384f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803853:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803857:	eb b7                	jmp    803810 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  803859:	40 84 f6             	test   %sil,%sil
+  80385c:	75 2b                	jne    803889 <vprintfmt+0x684>
+    switch (lflag) {
+  80385e:	85 d2                	test   %edx,%edx
+  803860:	74 56                	je     8038b8 <vprintfmt+0x6b3>
+  803862:	83 fa 01             	cmp    $0x1,%edx
+  803865:	74 7f                	je     8038e6 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  803867:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80386a:	83 f8 2f             	cmp    $0x2f,%eax
+  80386d:	0f 87 a2 00 00 00    	ja     803915 <vprintfmt+0x710>
+  803873:	89 c2                	mov    %eax,%edx
+  803875:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803879:	83 c0 08             	add    $0x8,%eax
+  80387c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80387f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803882:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803887:	eb 8f                	jmp    803818 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803889:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80388c:	83 f8 2f             	cmp    $0x2f,%eax
+  80388f:	77 19                	ja     8038aa <vprintfmt+0x6a5>
+  803891:	89 c2                	mov    %eax,%edx
+  803893:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803897:	83 c0 08             	add    $0x8,%eax
+  80389a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80389d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038a0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8038a5:	e9 6e ff ff ff       	jmp    803818 <vprintfmt+0x613>
+  8038aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038b6:	eb e5                	jmp    80389d <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8038b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8038be:	77 18                	ja     8038d8 <vprintfmt+0x6d3>
+  8038c0:	89 c2                	mov    %eax,%edx
+  8038c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038c6:	83 c0 08             	add    $0x8,%eax
+  8038c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038cc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8038ce:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8038d3:	e9 40 ff ff ff       	jmp    803818 <vprintfmt+0x613>
+  8038d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038e4:	eb e6                	jmp    8038cc <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8038e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8038ec:	77 19                	ja     803907 <vprintfmt+0x702>
+  8038ee:	89 c2                	mov    %eax,%edx
+  8038f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038f4:	83 c0 08             	add    $0x8,%eax
+  8038f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038fa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038fd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803902:	e9 11 ff ff ff       	jmp    803818 <vprintfmt+0x613>
+  803907:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80390b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80390f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803913:	eb e5                	jmp    8038fa <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  803915:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803919:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80391d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803921:	e9 59 ff ff ff       	jmp    80387f <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  803926:	4c 89 ee             	mov    %r13,%rsi
+  803929:	bf 25 00 00 00       	mov    $0x25,%edi
+  80392e:	41 ff d6             	call   *%r14
+            break;
+  803931:	e9 00 f9 ff ff       	jmp    803236 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803936:	4c 89 ee             	mov    %r13,%rsi
+  803939:	bf 25 00 00 00       	mov    $0x25,%edi
+  80393e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803941:	48 83 eb 01          	sub    $0x1,%rbx
+  803945:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803949:	75 f6                	jne    803941 <vprintfmt+0x73c>
+  80394b:	e9 e6 f8 ff ff       	jmp    803236 <vprintfmt+0x31>
+}
+  803950:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803954:	5b                   	pop    %rbx
+  803955:	41 5c                	pop    %r12
+  803957:	41 5d                	pop    %r13
+  803959:	41 5e                	pop    %r14
+  80395b:	41 5f                	pop    %r15
+  80395d:	5d                   	pop    %rbp
+  80395e:	c3                   	ret
+
+000000000080395f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80395f:	55                   	push   %rbp
+  803960:	48 89 e5             	mov    %rsp,%rbp
+  803963:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803967:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80396b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803970:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803974:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80397b:	48 85 ff             	test   %rdi,%rdi
+  80397e:	74 2b                	je     8039ab <vsnprintf+0x4c>
+  803980:	48 85 f6             	test   %rsi,%rsi
+  803983:	74 26                	je     8039ab <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803985:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803989:	48 bf b0 31 80 00 00 	movabs $0x8031b0,%rdi
+  803990:	00 00 00 
+  803993:	48 b8 05 32 80 00 00 	movabs $0x803205,%rax
+  80399a:	00 00 00 
+  80399d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80399f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039a3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8039a6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8039a9:	c9                   	leave
+  8039aa:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8039ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039b0:	eb f7                	jmp    8039a9 <vsnprintf+0x4a>
+
+00000000008039b2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8039b2:	55                   	push   %rbp
+  8039b3:	48 89 e5             	mov    %rsp,%rbp
+  8039b6:	48 83 ec 50          	sub    $0x50,%rsp
+  8039ba:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8039be:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8039c2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8039c6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8039cd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8039d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039d5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8039d9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8039dd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8039e1:	48 b8 5f 39 80 00 00 	movabs $0x80395f,%rax
+  8039e8:	00 00 00 
+  8039eb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8039ed:	c9                   	leave
+  8039ee:	c3                   	ret
+
+00000000008039ef <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8039ef:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8039f2:	74 10                	je     803a04 <strlen+0x15>
+    size_t n = 0;
+  8039f4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8039f9:	48 83 c0 01          	add    $0x1,%rax
+  8039fd:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803a01:	75 f6                	jne    8039f9 <strlen+0xa>
+  803a03:	c3                   	ret
+    size_t n = 0;
+  803a04:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803a09:	c3                   	ret
+
+0000000000803a0a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803a0a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803a0d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803a12:	48 85 f6             	test   %rsi,%rsi
+  803a15:	74 11                	je     803a28 <strnlen+0x1e>
+  803a17:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803a1b:	74 0c                	je     803a29 <strnlen+0x1f>
+  803a1d:	48 83 c2 01          	add    $0x1,%rdx
+  803a21:	48 39 d0             	cmp    %rdx,%rax
+  803a24:	75 f1                	jne    803a17 <strnlen+0xd>
+  803a26:	eb 04                	jmp    803a2c <strnlen+0x22>
+  803a28:	c3                   	ret
+  803a29:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803a2c:	c3                   	ret
+
+0000000000803a2d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803a2d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803a30:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a35:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803a39:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803a3c:	48 83 c2 01          	add    $0x1,%rdx
+  803a40:	84 c9                	test   %cl,%cl
+  803a42:	75 f1                	jne    803a35 <strcpy+0x8>
+        ;
+    return res;
+}
+  803a44:	c3                   	ret
+
+0000000000803a45 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803a45:	55                   	push   %rbp
+  803a46:	48 89 e5             	mov    %rsp,%rbp
+  803a49:	41 54                	push   %r12
+  803a4b:	53                   	push   %rbx
+  803a4c:	48 89 fb             	mov    %rdi,%rbx
+  803a4f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a52:	48 b8 ef 39 80 00 00 	movabs $0x8039ef,%rax
+  803a59:	00 00 00 
+  803a5c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a5e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a62:	4c 89 e6             	mov    %r12,%rsi
+  803a65:	48 b8 2d 3a 80 00 00 	movabs $0x803a2d,%rax
+  803a6c:	00 00 00 
+  803a6f:	ff d0                	call   *%rax
+    return dst;
+}
+  803a71:	48 89 d8             	mov    %rbx,%rax
+  803a74:	5b                   	pop    %rbx
+  803a75:	41 5c                	pop    %r12
+  803a77:	5d                   	pop    %rbp
+  803a78:	c3                   	ret
+
+0000000000803a79 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803a79:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803a7c:	48 85 d2             	test   %rdx,%rdx
+  803a7f:	74 1f                	je     803aa0 <strncpy+0x27>
+  803a81:	48 01 fa             	add    %rdi,%rdx
+  803a84:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803a87:	48 83 c1 01          	add    $0x1,%rcx
+  803a8b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803a8f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803a93:	41 80 f8 01          	cmp    $0x1,%r8b
+  803a97:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803a9b:	48 39 ca             	cmp    %rcx,%rdx
+  803a9e:	75 e7                	jne    803a87 <strncpy+0xe>
+    }
+    return ret;
+}
+  803aa0:	c3                   	ret
+
+0000000000803aa1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803aa1:	48 89 f8             	mov    %rdi,%rax
+  803aa4:	48 85 d2             	test   %rdx,%rdx
+  803aa7:	74 24                	je     803acd <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803aa9:	48 83 ea 01          	sub    $0x1,%rdx
+  803aad:	74 1b                	je     803aca <strlcpy+0x29>
+  803aaf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803ab3:	0f b6 16             	movzbl (%rsi),%edx
+  803ab6:	84 d2                	test   %dl,%dl
+  803ab8:	74 10                	je     803aca <strlcpy+0x29>
+            *dst++ = *src++;
+  803aba:	48 83 c6 01          	add    $0x1,%rsi
+  803abe:	48 83 c0 01          	add    $0x1,%rax
+  803ac2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803ac5:	48 39 c8             	cmp    %rcx,%rax
+  803ac8:	75 e9                	jne    803ab3 <strlcpy+0x12>
+        *dst = '\0';
+  803aca:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803acd:	48 29 f8             	sub    %rdi,%rax
+}
+  803ad0:	c3                   	ret
+
+0000000000803ad1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803ad1:	0f b6 07             	movzbl (%rdi),%eax
+  803ad4:	84 c0                	test   %al,%al
+  803ad6:	74 13                	je     803aeb <strcmp+0x1a>
+  803ad8:	38 06                	cmp    %al,(%rsi)
+  803ada:	75 0f                	jne    803aeb <strcmp+0x1a>
+  803adc:	48 83 c7 01          	add    $0x1,%rdi
+  803ae0:	48 83 c6 01          	add    $0x1,%rsi
+  803ae4:	0f b6 07             	movzbl (%rdi),%eax
+  803ae7:	84 c0                	test   %al,%al
+  803ae9:	75 ed                	jne    803ad8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803aeb:	0f b6 c0             	movzbl %al,%eax
+  803aee:	0f b6 16             	movzbl (%rsi),%edx
+  803af1:	29 d0                	sub    %edx,%eax
+}
+  803af3:	c3                   	ret
+
+0000000000803af4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803af4:	48 85 d2             	test   %rdx,%rdx
+  803af7:	74 1f                	je     803b18 <strncmp+0x24>
+  803af9:	0f b6 07             	movzbl (%rdi),%eax
+  803afc:	84 c0                	test   %al,%al
+  803afe:	74 1e                	je     803b1e <strncmp+0x2a>
+  803b00:	3a 06                	cmp    (%rsi),%al
+  803b02:	75 1a                	jne    803b1e <strncmp+0x2a>
+  803b04:	48 83 c7 01          	add    $0x1,%rdi
+  803b08:	48 83 c6 01          	add    $0x1,%rsi
+  803b0c:	48 83 ea 01          	sub    $0x1,%rdx
+  803b10:	75 e7                	jne    803af9 <strncmp+0x5>
+
+    if (!n) return 0;
+  803b12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b17:	c3                   	ret
+  803b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b1d:	c3                   	ret
+  803b1e:	48 85 d2             	test   %rdx,%rdx
+  803b21:	74 09                	je     803b2c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803b23:	0f b6 07             	movzbl (%rdi),%eax
+  803b26:	0f b6 16             	movzbl (%rsi),%edx
+  803b29:	29 d0                	sub    %edx,%eax
+  803b2b:	c3                   	ret
+    if (!n) return 0;
+  803b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b31:	c3                   	ret
+
+0000000000803b32 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803b32:	0f b6 17             	movzbl (%rdi),%edx
+  803b35:	84 d2                	test   %dl,%dl
+  803b37:	74 18                	je     803b51 <strchr+0x1f>
+        if (*str == c) {
+  803b39:	0f be d2             	movsbl %dl,%edx
+  803b3c:	39 f2                	cmp    %esi,%edx
+  803b3e:	74 17                	je     803b57 <strchr+0x25>
+    for (; *str; str++) {
+  803b40:	48 83 c7 01          	add    $0x1,%rdi
+  803b44:	0f b6 17             	movzbl (%rdi),%edx
+  803b47:	84 d2                	test   %dl,%dl
+  803b49:	75 ee                	jne    803b39 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b50:	c3                   	ret
+  803b51:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b56:	c3                   	ret
+  803b57:	48 89 f8             	mov    %rdi,%rax
+}
+  803b5a:	c3                   	ret
+
+0000000000803b5b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b5b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b5e:	0f b6 17             	movzbl (%rdi),%edx
+  803b61:	84 d2                	test   %dl,%dl
+  803b63:	74 13                	je     803b78 <strfind+0x1d>
+  803b65:	0f be d2             	movsbl %dl,%edx
+  803b68:	39 f2                	cmp    %esi,%edx
+  803b6a:	74 0b                	je     803b77 <strfind+0x1c>
+  803b6c:	48 83 c0 01          	add    $0x1,%rax
+  803b70:	0f b6 10             	movzbl (%rax),%edx
+  803b73:	84 d2                	test   %dl,%dl
+  803b75:	75 ee                	jne    803b65 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803b77:	c3                   	ret
+  803b78:	c3                   	ret
+
+0000000000803b79 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803b79:	55                   	push   %rbp
+  803b7a:	48 89 e5             	mov    %rsp,%rbp
+  803b7d:	41 57                	push   %r15
+  803b7f:	41 56                	push   %r14
+  803b81:	41 55                	push   %r13
+  803b83:	41 54                	push   %r12
+  803b85:	53                   	push   %rbx
+  803b86:	48 83 ec 08          	sub    $0x8,%rsp
+  803b8a:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803b8d:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803b91:	45 84 ed             	test   %r13b,%r13b
+  803b94:	75 12                	jne    803ba8 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803b96:	4c 89 f8             	mov    %r15,%rax
+  803b99:	48 83 c4 08          	add    $0x8,%rsp
+  803b9d:	5b                   	pop    %rbx
+  803b9e:	41 5c                	pop    %r12
+  803ba0:	41 5d                	pop    %r13
+  803ba2:	41 5e                	pop    %r14
+  803ba4:	41 5f                	pop    %r15
+  803ba6:	5d                   	pop    %rbp
+  803ba7:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803ba8:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803bac:	4c 89 e7             	mov    %r12,%rdi
+  803baf:	48 b8 ef 39 80 00 00 	movabs $0x8039ef,%rax
+  803bb6:	00 00 00 
+  803bb9:	ff d0                	call   *%rax
+  803bbb:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803bbe:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803bc2:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803bc6:	49 bf f4 3a 80 00 00 	movabs $0x803af4,%r15
+  803bcd:	00 00 00 
+				if ((sc = *s++) == 0)
+  803bd0:	84 c0                	test   %al,%al
+  803bd2:	75 14                	jne    803be8 <strstr+0x6f>
+					return NULL;
+  803bd4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bda:	eb ba                	jmp    803b96 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803bdc:	48 83 c3 01          	add    $0x1,%rbx
+  803be0:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803be4:	84 c0                	test   %al,%al
+  803be6:	74 1b                	je     803c03 <strstr+0x8a>
+			} while (sc != c);
+  803be8:	41 38 c5             	cmp    %al,%r13b
+  803beb:	75 ef                	jne    803bdc <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803bed:	4c 89 f2             	mov    %r14,%rdx
+  803bf0:	4c 89 e6             	mov    %r12,%rsi
+  803bf3:	48 89 df             	mov    %rbx,%rdi
+  803bf6:	41 ff d7             	call   *%r15
+  803bf9:	85 c0                	test   %eax,%eax
+  803bfb:	75 df                	jne    803bdc <strstr+0x63>
+  803bfd:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803c01:	eb 93                	jmp    803b96 <strstr+0x1d>
+					return NULL;
+  803c03:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803c09:	eb 8b                	jmp    803b96 <strstr+0x1d>
+
+0000000000803c0b <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803c0b:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803c0d:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803c10:	8d 57 20             	lea    0x20(%rdi),%edx
+  803c13:	83 f9 1a             	cmp    $0x1a,%ecx
+  803c16:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803c19:	c3                   	ret
+
+0000000000803c1a <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803c1a:	55                   	push   %rbp
+  803c1b:	48 89 e5             	mov    %rsp,%rbp
+  803c1e:	41 57                	push   %r15
+  803c20:	41 56                	push   %r14
+  803c22:	41 55                	push   %r13
+  803c24:	41 54                	push   %r12
+  803c26:	53                   	push   %rbx
+  803c27:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803c2b:	48 39 f7             	cmp    %rsi,%rdi
+  803c2e:	74 49                	je     803c79 <strcasecmp+0x5f>
+  803c30:	49 89 fd             	mov    %rdi,%r13
+  803c33:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803c36:	49 bf 0b 3c 80 00 00 	movabs $0x803c0b,%r15
+  803c3d:	00 00 00 
+  803c40:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803c45:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c49:	41 ff d7             	call   *%r15
+  803c4c:	89 c3                	mov    %eax,%ebx
+  803c4e:	49 83 c4 01          	add    $0x1,%r12
+  803c52:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c58:	41 ff d7             	call   *%r15
+  803c5b:	29 c3                	sub    %eax,%ebx
+  803c5d:	75 09                	jne    803c68 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c5f:	49 83 c5 01          	add    $0x1,%r13
+  803c63:	45 84 f6             	test   %r14b,%r14b
+  803c66:	75 d8                	jne    803c40 <strcasecmp+0x26>
+}
+  803c68:	89 d8                	mov    %ebx,%eax
+  803c6a:	48 83 c4 08          	add    $0x8,%rsp
+  803c6e:	5b                   	pop    %rbx
+  803c6f:	41 5c                	pop    %r12
+  803c71:	41 5d                	pop    %r13
+  803c73:	41 5e                	pop    %r14
+  803c75:	41 5f                	pop    %r15
+  803c77:	5d                   	pop    %rbp
+  803c78:	c3                   	ret
+        return 0;
+  803c79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c7e:	eb e8                	jmp    803c68 <strcasecmp+0x4e>
+
+0000000000803c80 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c80:	55                   	push   %rbp
+  803c81:	48 89 e5             	mov    %rsp,%rbp
+  803c84:	41 57                	push   %r15
+  803c86:	41 56                	push   %r14
+  803c88:	41 55                	push   %r13
+  803c8a:	41 54                	push   %r12
+  803c8c:	53                   	push   %rbx
+  803c8d:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803c91:	48 85 d2             	test   %rdx,%rdx
+  803c94:	74 4f                	je     803ce5 <strncasecmp+0x65>
+  803c96:	49 89 fc             	mov    %rdi,%r12
+  803c99:	49 89 f5             	mov    %rsi,%r13
+  803c9c:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803ca0:	49 be 0b 3c 80 00 00 	movabs $0x803c0b,%r14
+  803ca7:	00 00 00 
+  803caa:	49 83 c4 01          	add    $0x1,%r12
+  803cae:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803cb4:	41 ff d6             	call   *%r14
+  803cb7:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803cb9:	49 83 c5 01          	add    $0x1,%r13
+  803cbd:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803cc2:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803cc5:	29 c3                	sub    %eax,%ebx
+  803cc7:	85 c0                	test   %eax,%eax
+  803cc9:	74 09                	je     803cd4 <strncasecmp+0x54>
+  803ccb:	85 db                	test   %ebx,%ebx
+  803ccd:	75 05                	jne    803cd4 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803ccf:	4d 39 fc             	cmp    %r15,%r12
+  803cd2:	75 d6                	jne    803caa <strncasecmp+0x2a>
+}
+  803cd4:	89 d8                	mov    %ebx,%eax
+  803cd6:	48 83 c4 08          	add    $0x8,%rsp
+  803cda:	5b                   	pop    %rbx
+  803cdb:	41 5c                	pop    %r12
+  803cdd:	41 5d                	pop    %r13
+  803cdf:	41 5e                	pop    %r14
+  803ce1:	41 5f                	pop    %r15
+  803ce3:	5d                   	pop    %rbp
+  803ce4:	c3                   	ret
+    int d = 0;
+  803ce5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803cea:	eb e8                	jmp    803cd4 <strncasecmp+0x54>
+
+0000000000803cec <toupper>:
+
+int toupper(int c) {
+  803cec:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803cee:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803cf1:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803cf4:	83 f9 1a             	cmp    $0x1a,%ecx
+  803cf7:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803cfa:	c3                   	ret
+
+0000000000803cfb <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803cfb:	83 ff 20             	cmp    $0x20,%edi
+  803cfe:	0f 94 c0             	sete   %al
+  803d01:	0f b6 c0             	movzbl %al,%eax
+}
+  803d04:	c3                   	ret
+
+0000000000803d05 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803d05:	89 f8                	mov    %edi,%eax
+  803d07:	f7 d8                	neg    %eax
+  803d09:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803d0c:	c3                   	ret
+
+0000000000803d0d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803d0d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803d10:	48 89 f8             	mov    %rdi,%rax
+  803d13:	48 f7 d8             	neg    %rax
+  803d16:	83 e0 07             	and    $0x7,%eax
+  803d19:	49 89 d1             	mov    %rdx,%r9
+  803d1c:	49 29 c1             	sub    %rax,%r9
+  803d1f:	78 36                	js     803d57 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803d21:	40 0f b6 c6          	movzbl %sil,%eax
+  803d25:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803d2c:	01 01 01 
+  803d2f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803d33:	40 f6 c7 07          	test   $0x7,%dil
+  803d37:	75 38                	jne    803d71 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803d39:	4c 89 c9             	mov    %r9,%rcx
+  803d3c:	48 c1 f9 03          	sar    $0x3,%rcx
+  803d40:	74 0c                	je     803d4e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803d42:	fc                   	cld
+  803d43:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803d46:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d4a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d4e:	4d 85 c9             	test   %r9,%r9
+  803d51:	75 45                	jne    803d98 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d53:	4c 89 c0             	mov    %r8,%rax
+  803d56:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d57:	48 85 d2             	test   %rdx,%rdx
+  803d5a:	74 f7                	je     803d53 <memset+0x46>
+  803d5c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d5f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d62:	48 83 c0 01          	add    $0x1,%rax
+  803d66:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d6a:	48 39 c2             	cmp    %rax,%rdx
+  803d6d:	75 f3                	jne    803d62 <memset+0x55>
+  803d6f:	eb e2                	jmp    803d53 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d71:	40 f6 c7 01          	test   $0x1,%dil
+  803d75:	74 06                	je     803d7d <memset+0x70>
+  803d77:	88 07                	mov    %al,(%rdi)
+  803d79:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d7d:	40 f6 c7 02          	test   $0x2,%dil
+  803d81:	74 07                	je     803d8a <memset+0x7d>
+  803d83:	66 89 07             	mov    %ax,(%rdi)
+  803d86:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d8a:	40 f6 c7 04          	test   $0x4,%dil
+  803d8e:	74 a9                	je     803d39 <memset+0x2c>
+  803d90:	89 07                	mov    %eax,(%rdi)
+  803d92:	48 83 c7 04          	add    $0x4,%rdi
+  803d96:	eb a1                	jmp    803d39 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d98:	41 f6 c1 04          	test   $0x4,%r9b
+  803d9c:	74 06                	je     803da4 <memset+0x97>
+  803d9e:	89 07                	mov    %eax,(%rdi)
+  803da0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803da4:	41 f6 c1 02          	test   $0x2,%r9b
+  803da8:	74 07                	je     803db1 <memset+0xa4>
+  803daa:	66 89 07             	mov    %ax,(%rdi)
+  803dad:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803db1:	41 f6 c1 01          	test   $0x1,%r9b
+  803db5:	74 9c                	je     803d53 <memset+0x46>
+  803db7:	88 07                	mov    %al,(%rdi)
+  803db9:	eb 98                	jmp    803d53 <memset+0x46>
+
+0000000000803dbb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803dbb:	48 89 f8             	mov    %rdi,%rax
+  803dbe:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803dc1:	48 39 fe             	cmp    %rdi,%rsi
+  803dc4:	73 3b                	jae    803e01 <memmove+0x46>
+  803dc6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803dca:	48 39 d7             	cmp    %rdx,%rdi
+  803dcd:	73 32                	jae    803e01 <memmove+0x46>
+        s += n;
+        d += n;
+  803dcf:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803dd3:	48 89 d6             	mov    %rdx,%rsi
+  803dd6:	48 09 fe             	or     %rdi,%rsi
+  803dd9:	48 09 ce             	or     %rcx,%rsi
+  803ddc:	40 f6 c6 07          	test   $0x7,%sil
+  803de0:	75 12                	jne    803df4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803de2:	48 83 ef 08          	sub    $0x8,%rdi
+  803de6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803dea:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dee:	fd                   	std
+  803def:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803df2:	fc                   	cld
+  803df3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803df4:	48 83 ef 01          	sub    $0x1,%rdi
+  803df8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803dfc:	fd                   	std
+  803dfd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803dff:	eb f1                	jmp    803df2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803e01:	48 89 f2             	mov    %rsi,%rdx
+  803e04:	48 09 c2             	or     %rax,%rdx
+  803e07:	48 09 ca             	or     %rcx,%rdx
+  803e0a:	f6 c2 07             	test   $0x7,%dl
+  803e0d:	75 0c                	jne    803e1b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803e0f:	48 c1 e9 03          	shr    $0x3,%rcx
+  803e13:	48 89 c7             	mov    %rax,%rdi
+  803e16:	fc                   	cld
+  803e17:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803e1a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803e1b:	48 89 c7             	mov    %rax,%rdi
+  803e1e:	fc                   	cld
+  803e1f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803e21:	c3                   	ret
+
+0000000000803e22 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803e22:	55                   	push   %rbp
+  803e23:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803e26:	48 b8 bb 3d 80 00 00 	movabs $0x803dbb,%rax
+  803e2d:	00 00 00 
+  803e30:	ff d0                	call   *%rax
+}
+  803e32:	5d                   	pop    %rbp
+  803e33:	c3                   	ret
+
+0000000000803e34 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803e34:	55                   	push   %rbp
+  803e35:	48 89 e5             	mov    %rsp,%rbp
+  803e38:	41 57                	push   %r15
+  803e3a:	41 56                	push   %r14
+  803e3c:	41 55                	push   %r13
+  803e3e:	41 54                	push   %r12
+  803e40:	53                   	push   %rbx
+  803e41:	48 83 ec 08          	sub    $0x8,%rsp
+  803e45:	49 89 fe             	mov    %rdi,%r14
+  803e48:	49 89 f7             	mov    %rsi,%r15
+  803e4b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e4e:	48 89 f7             	mov    %rsi,%rdi
+  803e51:	48 b8 ef 39 80 00 00 	movabs $0x8039ef,%rax
+  803e58:	00 00 00 
+  803e5b:	ff d0                	call   *%rax
+  803e5d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e60:	48 89 de             	mov    %rbx,%rsi
+  803e63:	4c 89 f7             	mov    %r14,%rdi
+  803e66:	48 b8 0a 3a 80 00 00 	movabs $0x803a0a,%rax
+  803e6d:	00 00 00 
+  803e70:	ff d0                	call   *%rax
+  803e72:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e75:	48 39 c3             	cmp    %rax,%rbx
+  803e78:	74 36                	je     803eb0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e7a:	48 89 d8             	mov    %rbx,%rax
+  803e7d:	4c 29 e8             	sub    %r13,%rax
+  803e80:	49 39 c4             	cmp    %rax,%r12
+  803e83:	73 31                	jae    803eb6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803e85:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803e8a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e8e:	4c 89 fe             	mov    %r15,%rsi
+  803e91:	48 b8 22 3e 80 00 00 	movabs $0x803e22,%rax
+  803e98:	00 00 00 
+  803e9b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803e9d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803ea1:	48 83 c4 08          	add    $0x8,%rsp
+  803ea5:	5b                   	pop    %rbx
+  803ea6:	41 5c                	pop    %r12
+  803ea8:	41 5d                	pop    %r13
+  803eaa:	41 5e                	pop    %r14
+  803eac:	41 5f                	pop    %r15
+  803eae:	5d                   	pop    %rbp
+  803eaf:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803eb0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803eb4:	eb eb                	jmp    803ea1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803eb6:	48 83 eb 01          	sub    $0x1,%rbx
+  803eba:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803ebe:	48 89 da             	mov    %rbx,%rdx
+  803ec1:	4c 89 fe             	mov    %r15,%rsi
+  803ec4:	48 b8 22 3e 80 00 00 	movabs $0x803e22,%rax
+  803ecb:	00 00 00 
+  803ece:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803ed0:	49 01 de             	add    %rbx,%r14
+  803ed3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803ed8:	eb c3                	jmp    803e9d <strlcat+0x69>
+
+0000000000803eda <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803eda:	48 85 d2             	test   %rdx,%rdx
+  803edd:	74 2d                	je     803f0c <memcmp+0x32>
+  803edf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803ee4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803ee8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803eed:	44 38 c1             	cmp    %r8b,%cl
+  803ef0:	75 0f                	jne    803f01 <memcmp+0x27>
+    while (n-- > 0) {
+  803ef2:	48 83 c0 01          	add    $0x1,%rax
+  803ef6:	48 39 c2             	cmp    %rax,%rdx
+  803ef9:	75 e9                	jne    803ee4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f00:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803f01:	0f b6 c1             	movzbl %cl,%eax
+  803f04:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803f08:	44 29 c0             	sub    %r8d,%eax
+  803f0b:	c3                   	ret
+    return 0;
+  803f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f11:	c3                   	ret
+
+0000000000803f12 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803f12:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803f16:	48 39 c7             	cmp    %rax,%rdi
+  803f19:	73 0f                	jae    803f2a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803f1b:	40 38 37             	cmp    %sil,(%rdi)
+  803f1e:	74 0e                	je     803f2e <memfind+0x1c>
+    for (; src < end; src++) {
+  803f20:	48 83 c7 01          	add    $0x1,%rdi
+  803f24:	48 39 f8             	cmp    %rdi,%rax
+  803f27:	75 f2                	jne    803f1b <memfind+0x9>
+  803f29:	c3                   	ret
+  803f2a:	48 89 f8             	mov    %rdi,%rax
+  803f2d:	c3                   	ret
+  803f2e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803f31:	c3                   	ret
+
+0000000000803f32 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803f32:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803f35:	0f b6 37             	movzbl (%rdi),%esi
+  803f38:	40 80 fe 20          	cmp    $0x20,%sil
+  803f3c:	74 06                	je     803f44 <strtol+0x12>
+  803f3e:	40 80 fe 09          	cmp    $0x9,%sil
+  803f42:	75 13                	jne    803f57 <strtol+0x25>
+  803f44:	48 83 c7 01          	add    $0x1,%rdi
+  803f48:	0f b6 37             	movzbl (%rdi),%esi
+  803f4b:	40 80 fe 20          	cmp    $0x20,%sil
+  803f4f:	74 f3                	je     803f44 <strtol+0x12>
+  803f51:	40 80 fe 09          	cmp    $0x9,%sil
+  803f55:	74 ed                	je     803f44 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f57:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f5a:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f5d:	3c 01                	cmp    $0x1,%al
+  803f5f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f63:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f69:	75 0f                	jne    803f7a <strtol+0x48>
+  803f6b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f6e:	74 14                	je     803f84 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f70:	85 d2                	test   %edx,%edx
+  803f72:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f77:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803f7f:	4c 63 ca             	movslq %edx,%r9
+  803f82:	eb 36                	jmp    803fba <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f84:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803f88:	74 0f                	je     803f99 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803f8a:	85 d2                	test   %edx,%edx
+  803f8c:	75 ec                	jne    803f7a <strtol+0x48>
+        s++;
+  803f8e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803f92:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803f97:	eb e1                	jmp    803f7a <strtol+0x48>
+        s += 2;
+  803f99:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803f9d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803fa2:	eb d6                	jmp    803f7a <strtol+0x48>
+            dig -= '0';
+  803fa4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803fa7:	44 0f b6 c1          	movzbl %cl,%r8d
+  803fab:	41 39 d0             	cmp    %edx,%r8d
+  803fae:	7d 21                	jge    803fd1 <strtol+0x9f>
+        val = val * base + dig;
+  803fb0:	49 0f af c1          	imul   %r9,%rax
+  803fb4:	0f b6 c9             	movzbl %cl,%ecx
+  803fb7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803fba:	48 83 c7 01          	add    $0x1,%rdi
+  803fbe:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803fc2:	80 f9 39             	cmp    $0x39,%cl
+  803fc5:	76 dd                	jbe    803fa4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803fc7:	80 f9 7b             	cmp    $0x7b,%cl
+  803fca:	77 05                	ja     803fd1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803fcc:	83 e9 57             	sub    $0x57,%ecx
+  803fcf:	eb d6                	jmp    803fa7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803fd1:	4d 85 d2             	test   %r10,%r10
+  803fd4:	74 03                	je     803fd9 <strtol+0xa7>
+  803fd6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803fd9:	48 89 c2             	mov    %rax,%rdx
+  803fdc:	48 f7 da             	neg    %rdx
+  803fdf:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803fe3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803fe7:	c3                   	ret
+
+0000000000803fe8 <atoi>:
+int atoi(const char *str) {
+  803fe8:	55                   	push   %rbp
+  803fe9:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  803fec:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ff1:	be 00 00 00 00       	mov    $0x0,%esi
+  803ff6:	48 b8 32 3f 80 00 00 	movabs $0x803f32,%rax
+  803ffd:	00 00 00 
+  804000:	ff d0                	call   *%rax
+}
+  804002:	5d                   	pop    %rbp
+  804003:	c3                   	ret
+
+0000000000804004 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804004:	55                   	push   %rbp
+  804005:	48 89 e5             	mov    %rsp,%rbp
+  804008:	41 55                	push   %r13
+  80400a:	41 54                	push   %r12
+  80400c:	53                   	push   %rbx
+  80400d:	48 83 ec 08          	sub    $0x8,%rsp
+  804011:	49 89 fc             	mov    %rdi,%r12
+  804014:	48 89 f7             	mov    %rsi,%rdi
+  804017:	48 89 d3             	mov    %rdx,%rbx
+  80401a:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80401d:	48 85 f6             	test   %rsi,%rsi
+  804020:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804027:	00 00 00 
+  80402a:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80402e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804033:	48 85 d2             	test   %rdx,%rdx
+  804036:	74 03                	je     80403b <ipc_recv+0x37>
+  804038:	48 8b 32             	mov    (%rdx),%rsi
+  80403b:	48 b8 73 06 80 00 00 	movabs $0x800673,%rax
+  804042:	00 00 00 
+  804045:	ff d0                	call   *%rax
+    if (errno) {
+  804047:	85 c0                	test   %eax,%eax
+  804049:	74 1c                	je     804067 <ipc_recv+0x63>
+        if (from_env_store)
+  80404b:	4d 85 e4             	test   %r12,%r12
+  80404e:	74 08                	je     804058 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804050:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804057:	00 
+
+        if (perm_store)
+  804058:	4d 85 ed             	test   %r13,%r13
+  80405b:	74 74                	je     8040d1 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80405d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804064:	00 
+  804065:	eb 6a                	jmp    8040d1 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804067:	4d 85 e4             	test   %r12,%r12
+  80406a:	74 14                	je     804080 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80406c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804073:	00 00 00 
+  804076:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80407c:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804080:	48 85 db             	test   %rbx,%rbx
+  804083:	74 23                	je     8040a8 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804085:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80408c:	00 00 00 
+  80408f:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804095:	ba 00 00 00 00       	mov    $0x0,%edx
+  80409a:	85 c9                	test   %ecx,%ecx
+  80409c:	74 07                	je     8040a5 <ipc_recv+0xa1>
+  80409e:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8040a5:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8040a8:	4d 85 ed             	test   %r13,%r13
+  8040ab:	74 14                	je     8040c1 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8040ad:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040b4:	00 00 00 
+  8040b7:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8040bd:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8040c1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040c8:	00 00 00 
+  8040cb:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040d1:	48 83 c4 08          	add    $0x8,%rsp
+  8040d5:	5b                   	pop    %rbx
+  8040d6:	41 5c                	pop    %r12
+  8040d8:	41 5d                	pop    %r13
+  8040da:	5d                   	pop    %rbp
+  8040db:	c3                   	ret
+
+00000000008040dc <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040dc:	55                   	push   %rbp
+  8040dd:	48 89 e5             	mov    %rsp,%rbp
+  8040e0:	41 55                	push   %r13
+  8040e2:	41 54                	push   %r12
+  8040e4:	53                   	push   %rbx
+  8040e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8040e9:	49 89 fc             	mov    %rdi,%r12
+  8040ec:	48 89 f7             	mov    %rsi,%rdi
+  8040ef:	48 89 d3             	mov    %rdx,%rbx
+  8040f2:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040f5:	48 85 f6             	test   %rsi,%rsi
+  8040f8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040ff:	00 00 00 
+  804102:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804106:	be 00 10 00 00       	mov    $0x1000,%esi
+  80410b:	48 85 d2             	test   %rdx,%rdx
+  80410e:	74 03                	je     804113 <ipc_try_recv+0x37>
+  804110:	48 8b 32             	mov    (%rdx),%rsi
+  804113:	48 b8 dc 06 80 00 00 	movabs $0x8006dc,%rax
+  80411a:	00 00 00 
+  80411d:	ff d0                	call   *%rax
+    if (errno) {
+  80411f:	85 c0                	test   %eax,%eax
+  804121:	75 75                	jne    804198 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804123:	4d 85 e4             	test   %r12,%r12
+  804126:	74 14                	je     80413c <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804128:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80412f:	00 00 00 
+  804132:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804138:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80413c:	48 85 db             	test   %rbx,%rbx
+  80413f:	74 23                	je     804164 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804141:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804148:	00 00 00 
+  80414b:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804151:	ba 00 00 00 00       	mov    $0x0,%edx
+  804156:	85 c9                	test   %ecx,%ecx
+  804158:	74 07                	je     804161 <ipc_try_recv+0x85>
+  80415a:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804161:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804164:	4d 85 ed             	test   %r13,%r13
+  804167:	74 14                	je     80417d <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804169:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804170:	00 00 00 
+  804173:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804179:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80417d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804184:	00 00 00 
+  804187:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80418d:	48 83 c4 08          	add    $0x8,%rsp
+  804191:	5b                   	pop    %rbx
+  804192:	41 5c                	pop    %r12
+  804194:	41 5d                	pop    %r13
+  804196:	5d                   	pop    %rbp
+  804197:	c3                   	ret
+        if (from_env_store)
+  804198:	4d 85 e4             	test   %r12,%r12
+  80419b:	74 08                	je     8041a5 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80419d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8041a4:	00 
+        if (perm_store)
+  8041a5:	4d 85 ed             	test   %r13,%r13
+  8041a8:	74 e3                	je     80418d <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8041aa:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8041b1:	00 
+  8041b2:	eb d9                	jmp    80418d <ipc_try_recv+0xb1>
+
+00000000008041b4 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8041b4:	55                   	push   %rbp
+  8041b5:	48 89 e5             	mov    %rsp,%rbp
+  8041b8:	41 57                	push   %r15
+  8041ba:	41 56                	push   %r14
+  8041bc:	41 55                	push   %r13
+  8041be:	41 54                	push   %r12
+  8041c0:	53                   	push   %rbx
+  8041c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8041c5:	41 89 fd             	mov    %edi,%r13d
+  8041c8:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8041cb:	48 89 d3             	mov    %rdx,%rbx
+  8041ce:	49 89 cc             	mov    %rcx,%r12
+  8041d1:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041d5:	48 85 d2             	test   %rdx,%rdx
+  8041d8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041df:	00 00 00 
+  8041e2:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041e6:	49 be 47 06 80 00 00 	movabs $0x800647,%r14
+  8041ed:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041f0:	49 bf 37 02 80 00 00 	movabs $0x800237,%r15
+  8041f7:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041fa:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041fd:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804201:	4c 89 e1             	mov    %r12,%rcx
+  804204:	48 89 da             	mov    %rbx,%rdx
+  804207:	44 89 ef             	mov    %r13d,%edi
+  80420a:	41 ff d6             	call   *%r14
+  80420d:	85 c0                	test   %eax,%eax
+  80420f:	74 37                	je     804248 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804211:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804214:	75 05                	jne    80421b <ipc_send+0x67>
+        sys_yield();
+  804216:	41 ff d7             	call   *%r15
+  804219:	eb df                	jmp    8041fa <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80421b:	89 c1                	mov    %eax,%ecx
+  80421d:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  804224:	00 00 00 
+  804227:	be 65 00 00 00       	mov    $0x65,%esi
+  80422c:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  804233:	00 00 00 
+  804236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423b:	49 b8 65 2f 80 00 00 	movabs $0x802f65,%r8
+  804242:	00 00 00 
+  804245:	41 ff d0             	call   *%r8
+    }
+}
+  804248:	48 83 c4 18          	add    $0x18,%rsp
+  80424c:	5b                   	pop    %rbx
+  80424d:	41 5c                	pop    %r12
+  80424f:	41 5d                	pop    %r13
+  804251:	41 5e                	pop    %r14
+  804253:	41 5f                	pop    %r15
+  804255:	5d                   	pop    %rbp
+  804256:	c3                   	ret
+
+0000000000804257 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804257:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80425c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804263:	00 00 00 
+  804266:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80426d:	48 01 ca             	add    %rcx,%rdx
+  804270:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804276:	39 fa                	cmp    %edi,%edx
+  804278:	74 12                	je     80428c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80427a:	48 83 c0 01          	add    $0x1,%rax
+  80427e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804284:	75 e0                	jne    804266 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804286:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80428b:	c3                   	ret
+            return envs[i].env_id;
+  80428c:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804293:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80429a:	00 00 00 
+  80429d:	48 01 d0             	add    %rdx,%rax
+  8042a0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8042a6:	c3                   	ret
+
+00000000008042a7 <__text_end>:
+  8042a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ae:	00 00 00 
+  8042b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b8:	00 00 00 
+  8042bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c2:	00 00 00 
+  8042c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cc:	00 00 00 
+  8042cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d6:	00 00 00 
+  8042d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e0:	00 00 00 
+  8042e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ea:	00 00 00 
+  8042ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f4:	00 00 00 
+  8042f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fe:	00 00 00 
+  804301:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804308:	00 00 00 
+  80430b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804312:	00 00 00 
+  804315:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431c:	00 00 00 
+  80431f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804326:	00 00 00 
+  804329:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804330:	00 00 00 
+  804333:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433a:	00 00 00 
+  80433d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804344:	00 00 00 
+  804347:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434e:	00 00 00 
+  804351:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804358:	00 00 00 
+  80435b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804362:	00 00 00 
+  804365:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436c:	00 00 00 
+  80436f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804376:	00 00 00 
+  804379:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804380:	00 00 00 
+  804383:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438a:	00 00 00 
+  80438d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804394:	00 00 00 
+  804397:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439e:	00 00 00 
+  8043a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a8:	00 00 00 
+  8043ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b2:	00 00 00 
+  8043b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bc:	00 00 00 
+  8043bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c6:	00 00 00 
+  8043c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d0:	00 00 00 
+  8043d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043da:	00 00 00 
+  8043dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e4:	00 00 00 
+  8043e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ee:	00 00 00 
+  8043f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f8:	00 00 00 
+  8043fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804402:	00 00 00 
+  804405:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440c:	00 00 00 
+  80440f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804416:	00 00 00 
+  804419:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804420:	00 00 00 
+  804423:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442a:	00 00 00 
+  80442d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804434:	00 00 00 
+  804437:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443e:	00 00 00 
+  804441:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804448:	00 00 00 
+  80444b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804452:	00 00 00 
+  804455:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445c:	00 00 00 
+  80445f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804466:	00 00 00 
+  804469:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804470:	00 00 00 
+  804473:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447a:	00 00 00 
+  80447d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804484:	00 00 00 
+  804487:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448e:	00 00 00 
+  804491:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804498:	00 00 00 
+  80449b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a2:	00 00 00 
+  8044a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ac:	00 00 00 
+  8044af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b6:	00 00 00 
+  8044b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c0:	00 00 00 
+  8044c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ca:	00 00 00 
+  8044cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d4:	00 00 00 
+  8044d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044de:	00 00 00 
+  8044e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e8:	00 00 00 
+  8044eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f2:	00 00 00 
+  8044f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fc:	00 00 00 
+  8044ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804506:	00 00 00 
+  804509:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804510:	00 00 00 
+  804513:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451a:	00 00 00 
+  80451d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804524:	00 00 00 
+  804527:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452e:	00 00 00 
+  804531:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804538:	00 00 00 
+  80453b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804542:	00 00 00 
+  804545:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454c:	00 00 00 
+  80454f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804556:	00 00 00 
+  804559:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804560:	00 00 00 
+  804563:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456a:	00 00 00 
+  80456d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804574:	00 00 00 
+  804577:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457e:	00 00 00 
+  804581:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804588:	00 00 00 
+  80458b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804592:	00 00 00 
+  804595:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459c:	00 00 00 
+  80459f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a6:	00 00 00 
+  8045a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b0:	00 00 00 
+  8045b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ba:	00 00 00 
+  8045bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c4:	00 00 00 
+  8045c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ce:	00 00 00 
+  8045d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d8:	00 00 00 
+  8045db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e2:	00 00 00 
+  8045e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ec:	00 00 00 
+  8045ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f6:	00 00 00 
+  8045f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804600:	00 00 00 
+  804603:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460a:	00 00 00 
+  80460d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804614:	00 00 00 
+  804617:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461e:	00 00 00 
+  804621:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804628:	00 00 00 
+  80462b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804632:	00 00 00 
+  804635:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463c:	00 00 00 
+  80463f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804646:	00 00 00 
+  804649:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804650:	00 00 00 
+  804653:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465a:	00 00 00 
+  80465d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804664:	00 00 00 
+  804667:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466e:	00 00 00 
+  804671:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804678:	00 00 00 
+  80467b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804682:	00 00 00 
+  804685:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468c:	00 00 00 
+  80468f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804696:	00 00 00 
+  804699:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a0:	00 00 00 
+  8046a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046aa:	00 00 00 
+  8046ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b4:	00 00 00 
+  8046b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046be:	00 00 00 
+  8046c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c8:	00 00 00 
+  8046cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d2:	00 00 00 
+  8046d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dc:	00 00 00 
+  8046df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e6:	00 00 00 
+  8046e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f0:	00 00 00 
+  8046f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fa:	00 00 00 
+  8046fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804704:	00 00 00 
+  804707:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470e:	00 00 00 
+  804711:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804718:	00 00 00 
+  80471b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804722:	00 00 00 
+  804725:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472c:	00 00 00 
+  80472f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804736:	00 00 00 
+  804739:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804740:	00 00 00 
+  804743:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474a:	00 00 00 
+  80474d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804754:	00 00 00 
+  804757:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475e:	00 00 00 
+  804761:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804768:	00 00 00 
+  80476b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804772:	00 00 00 
+  804775:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477c:	00 00 00 
+  80477f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804786:	00 00 00 
+  804789:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804790:	00 00 00 
+  804793:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479a:	00 00 00 
+  80479d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a4:	00 00 00 
+  8047a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ae:	00 00 00 
+  8047b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b8:	00 00 00 
+  8047bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c2:	00 00 00 
+  8047c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cc:	00 00 00 
+  8047cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d6:	00 00 00 
+  8047d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e0:	00 00 00 
+  8047e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ea:	00 00 00 
+  8047ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f4:	00 00 00 
+  8047f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fe:	00 00 00 
+  804801:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804808:	00 00 00 
+  80480b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804812:	00 00 00 
+  804815:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481c:	00 00 00 
+  80481f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804826:	00 00 00 
+  804829:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804830:	00 00 00 
+  804833:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483a:	00 00 00 
+  80483d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804844:	00 00 00 
+  804847:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484e:	00 00 00 
+  804851:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804858:	00 00 00 
+  80485b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804862:	00 00 00 
+  804865:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486c:	00 00 00 
+  80486f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804876:	00 00 00 
+  804879:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804880:	00 00 00 
+  804883:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488a:	00 00 00 
+  80488d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804894:	00 00 00 
+  804897:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489e:	00 00 00 
+  8048a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a8:	00 00 00 
+  8048ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b2:	00 00 00 
+  8048b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bc:	00 00 00 
+  8048bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c6:	00 00 00 
+  8048c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d0:	00 00 00 
+  8048d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048da:	00 00 00 
+  8048dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e4:	00 00 00 
+  8048e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ee:	00 00 00 
+  8048f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f8:	00 00 00 
+  8048fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804902:	00 00 00 
+  804905:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490c:	00 00 00 
+  80490f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804916:	00 00 00 
+  804919:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804920:	00 00 00 
+  804923:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492a:	00 00 00 
+  80492d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804934:	00 00 00 
+  804937:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493e:	00 00 00 
+  804941:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804948:	00 00 00 
+  80494b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804952:	00 00 00 
+  804955:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495c:	00 00 00 
+  80495f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804966:	00 00 00 
+  804969:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804970:	00 00 00 
+  804973:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497a:	00 00 00 
+  80497d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804984:	00 00 00 
+  804987:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498e:	00 00 00 
+  804991:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804998:	00 00 00 
+  80499b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a2:	00 00 00 
+  8049a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ac:	00 00 00 
+  8049af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b6:	00 00 00 
+  8049b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c0:	00 00 00 
+  8049c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ca:	00 00 00 
+  8049cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d4:	00 00 00 
+  8049d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049de:	00 00 00 
+  8049e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e8:	00 00 00 
+  8049eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f2:	00 00 00 
+  8049f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fc:	00 00 00 
+  8049ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a06:	00 00 00 
+  804a09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a10:	00 00 00 
+  804a13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1a:	00 00 00 
+  804a1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a24:	00 00 00 
+  804a27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2e:	00 00 00 
+  804a31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a38:	00 00 00 
+  804a3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a42:	00 00 00 
+  804a45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4c:	00 00 00 
+  804a4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a56:	00 00 00 
+  804a59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a60:	00 00 00 
+  804a63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6a:	00 00 00 
+  804a6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a74:	00 00 00 
+  804a77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7e:	00 00 00 
+  804a81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a88:	00 00 00 
+  804a8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a92:	00 00 00 
+  804a95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9c:	00 00 00 
+  804a9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa6:	00 00 00 
+  804aa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab0:	00 00 00 
+  804ab3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aba:	00 00 00 
+  804abd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac4:	00 00 00 
+  804ac7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ace:	00 00 00 
+  804ad1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad8:	00 00 00 
+  804adb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae2:	00 00 00 
+  804ae5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aec:	00 00 00 
+  804aef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af6:	00 00 00 
+  804af9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b00:	00 00 00 
+  804b03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0a:	00 00 00 
+  804b0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b14:	00 00 00 
+  804b17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1e:	00 00 00 
+  804b21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b28:	00 00 00 
+  804b2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b32:	00 00 00 
+  804b35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3c:	00 00 00 
+  804b3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b46:	00 00 00 
+  804b49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b50:	00 00 00 
+  804b53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5a:	00 00 00 
+  804b5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b64:	00 00 00 
+  804b67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6e:	00 00 00 
+  804b71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b78:	00 00 00 
+  804b7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b82:	00 00 00 
+  804b85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8c:	00 00 00 
+  804b8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b96:	00 00 00 
+  804b99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba0:	00 00 00 
+  804ba3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baa:	00 00 00 
+  804bad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb4:	00 00 00 
+  804bb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbe:	00 00 00 
+  804bc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc8:	00 00 00 
+  804bcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd2:	00 00 00 
+  804bd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdc:	00 00 00 
+  804bdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be6:	00 00 00 
+  804be9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf0:	00 00 00 
+  804bf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfa:	00 00 00 
+  804bfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c04:	00 00 00 
+  804c07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0e:	00 00 00 
+  804c11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c18:	00 00 00 
+  804c1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c22:	00 00 00 
+  804c25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2c:	00 00 00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c40:	00 00 00 
+  804c43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4a:	00 00 00 
+  804c4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c54:	00 00 00 
+  804c57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5e:	00 00 00 
+  804c61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c68:	00 00 00 
+  804c6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c72:	00 00 00 
+  804c75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7c:	00 00 00 
+  804c7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c86:	00 00 00 
+  804c89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c90:	00 00 00 
+  804c93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9a:	00 00 00 
+  804c9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca4:	00 00 00 
+  804ca7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cae:	00 00 00 
+  804cb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb8:	00 00 00 
+  804cbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc2:	00 00 00 
+  804cc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccc:	00 00 00 
+  804ccf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd6:	00 00 00 
+  804cd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce0:	00 00 00 
+  804ce3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cea:	00 00 00 
+  804ced:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf4:	00 00 00 
+  804cf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfe:	00 00 00 
+  804d01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d08:	00 00 00 
+  804d0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d12:	00 00 00 
+  804d15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1c:	00 00 00 
+  804d1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d26:	00 00 00 
+  804d29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d30:	00 00 00 
+  804d33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3a:	00 00 00 
+  804d3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d44:	00 00 00 
+  804d47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4e:	00 00 00 
+  804d51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d58:	00 00 00 
+  804d5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d62:	00 00 00 
+  804d65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6c:	00 00 00 
+  804d6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d76:	00 00 00 
+  804d79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d80:	00 00 00 
+  804d83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8a:	00 00 00 
+  804d8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d94:	00 00 00 
+  804d97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9e:	00 00 00 
+  804da1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da8:	00 00 00 
+  804dab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db2:	00 00 00 
+  804db5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbc:	00 00 00 
+  804dbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc6:	00 00 00 
+  804dc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd0:	00 00 00 
+  804dd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dda:	00 00 00 
+  804ddd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de4:	00 00 00 
+  804de7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dee:	00 00 00 
+  804df1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df8:	00 00 00 
+  804dfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e02:	00 00 00 
+  804e05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0c:	00 00 00 
+  804e0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e16:	00 00 00 
+  804e19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e20:	00 00 00 
+  804e23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2a:	00 00 00 
+  804e2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e34:	00 00 00 
+  804e37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3e:	00 00 00 
+  804e41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e48:	00 00 00 
+  804e4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e52:	00 00 00 
+  804e55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5c:	00 00 00 
+  804e5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e66:	00 00 00 
+  804e69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e70:	00 00 00 
+  804e73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7a:	00 00 00 
+  804e7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e84:	00 00 00 
+  804e87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8e:	00 00 00 
+  804e91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e98:	00 00 00 
+  804e9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea2:	00 00 00 
+  804ea5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eac:	00 00 00 
+  804eaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb6:	00 00 00 
+  804eb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec0:	00 00 00 
+  804ec3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eca:	00 00 00 
+  804ecd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed4:	00 00 00 
+  804ed7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ede:	00 00 00 
+  804ee1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee8:	00 00 00 
+  804eeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef2:	00 00 00 
+  804ef5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efc:	00 00 00 
+  804eff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f06:	00 00 00 
+  804f09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f10:	00 00 00 
+  804f13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1a:	00 00 00 
+  804f1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f24:	00 00 00 
+  804f27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2e:	00 00 00 
+  804f31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f38:	00 00 00 
+  804f3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f42:	00 00 00 
+  804f45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4c:	00 00 00 
+  804f4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f56:	00 00 00 
+  804f59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f60:	00 00 00 
+  804f63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6a:	00 00 00 
+  804f6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f74:	00 00 00 
+  804f77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7e:	00 00 00 
+  804f81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f88:	00 00 00 
+  804f8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f92:	00 00 00 
+  804f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9c:	00 00 00 
+  804f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa6:	00 00 00 
+  804fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb0:	00 00 00 
+  804fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fba:	00 00 00 
+  804fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc4:	00 00 00 
+  804fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fce:	00 00 00 
+  804fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd8:	00 00 00 
+  804fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe2:	00 00 00 
+  804fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fec:	00 00 00 
+  804fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff6:	00 00 00 
+  804ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
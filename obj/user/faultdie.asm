@@ -0,0 +1,8301 @@
+
+obj/user/faultdie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 72 00 00 00       	call   800095 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- just exit when we fault */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = (void *)utf->utf_fault_va;
+    uint64_t err = utf->utf_err;
+    cprintf("i faulted at va %lx, err %x\n",
+  800029:	8b 57 08             	mov    0x8(%rdi),%edx
+  80002c:	83 e2 07             	and    $0x7,%edx
+  80002f:	48 8b 37             	mov    (%rdi),%rsi
+  800032:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  800048:	00 00 00 
+  80004b:	ff d1                	call   *%rcx
+            (unsigned long)addr, (unsigned)(err & 7));
+    sys_env_destroy(sys_getenvid());
+  80004d:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	89 c7                	mov    %eax,%edi
+  80005b:	48 b8 bb 11 80 00 00 	movabs $0x8011bb,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+    return 1;
+}
+  800067:	b8 01 00 00 00       	mov    $0x1,%eax
+  80006c:	5d                   	pop    %rbp
+  80006d:	c3                   	ret
+
+000000000080006e <umain>:
+
+void
+umain(int argc, char **argv) {
+  80006e:	55                   	push   %rbp
+  80006f:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  800072:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  800079:	00 00 00 
+  80007c:	48 b8 86 1d 80 00 00 	movabs $0x801d86,%rax
+  800083:	00 00 00 
+  800086:	ff d0                	call   *%rax
+    *(volatile int *)0xDEADBEEF = 0;
+  800088:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  80008d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800093:	5d                   	pop    %rbp
+  800094:	c3                   	ret
+
+0000000000800095 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800095:	55                   	push   %rbp
+  800096:	48 89 e5             	mov    %rsp,%rbp
+  800099:	41 56                	push   %r14
+  80009b:	41 55                	push   %r13
+  80009d:	41 54                	push   %r12
+  80009f:	53                   	push   %rbx
+  8000a0:	41 89 fd             	mov    %edi,%r13d
+  8000a3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000a6:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8000ad:	00 00 00 
+  8000b0:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8000b7:	00 00 00 
+  8000ba:	48 39 c2             	cmp    %rax,%rdx
+  8000bd:	73 17                	jae    8000d6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8000bf:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000c2:	49 89 c4             	mov    %rax,%r12
+  8000c5:	48 83 c3 08          	add    $0x8,%rbx
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	ff 53 f8             	call   *-0x8(%rbx)
+  8000d1:	4c 39 e3             	cmp    %r12,%rbx
+  8000d4:	72 ef                	jb     8000c5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000d6:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+  8000e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e7:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000ee:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000f5:	00 00 00 
+  8000f8:	48 01 d0             	add    %rdx,%rax
+  8000fb:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800102:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800105:	45 85 ed             	test   %r13d,%r13d
+  800108:	7e 0d                	jle    800117 <libmain+0x82>
+  80010a:	49 8b 06             	mov    (%r14),%rax
+  80010d:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800114:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800117:	4c 89 f6             	mov    %r14,%rsi
+  80011a:	44 89 ef             	mov    %r13d,%edi
+  80011d:	48 b8 6e 00 80 00 00 	movabs $0x80006e,%rax
+  800124:	00 00 00 
+  800127:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800129:	48 b8 3e 01 80 00 00 	movabs $0x80013e,%rax
+  800130:	00 00 00 
+  800133:	ff d0                	call   *%rax
+#endif
+}
+  800135:	5b                   	pop    %rbx
+  800136:	41 5c                	pop    %r12
+  800138:	41 5d                	pop    %r13
+  80013a:	41 5e                	pop    %r14
+  80013c:	5d                   	pop    %rbp
+  80013d:	c3                   	ret
+
+000000000080013e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80013e:	55                   	push   %rbp
+  80013f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800142:	48 b8 ef 21 80 00 00 	movabs $0x8021ef,%rax
+  800149:	00 00 00 
+  80014c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80014e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800153:	48 b8 bb 11 80 00 00 	movabs $0x8011bb,%rax
+  80015a:	00 00 00 
+  80015d:	ff d0                	call   *%rax
+}
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	53                   	push   %rbx
+  800166:	48 83 ec 08          	sub    $0x8,%rsp
+  80016a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80016d:	8b 06                	mov    (%rsi),%eax
+  80016f:	8d 50 01             	lea    0x1(%rax),%edx
+  800172:	89 16                	mov    %edx,(%rsi)
+  800174:	48 98                	cltq
+  800176:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80017b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800181:	74 0a                	je     80018d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800183:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800187:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018b:	c9                   	leave
+  80018c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80018d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800191:	be ff 00 00 00       	mov    $0xff,%esi
+  800196:	48 b8 5d 11 80 00 00 	movabs $0x80115d,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001a2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001a8:	eb d9                	jmp    800183 <putch+0x22>
+
+00000000008001aa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001aa:	55                   	push   %rbp
+  8001ab:	48 89 e5             	mov    %rsp,%rbp
+  8001ae:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001b5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001b8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001bf:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001cc:	48 89 f1             	mov    %rsi,%rcx
+  8001cf:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001d6:	48 bf 61 01 80 00 00 	movabs $0x800161,%rdi
+  8001dd:	00 00 00 
+  8001e0:	48 b8 5e 03 80 00 00 	movabs $0x80035e,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001ec:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001f3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001fa:	48 b8 5d 11 80 00 00 	movabs $0x80115d,%rax
+  800201:	00 00 00 
+  800204:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800206:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80020c:	c9                   	leave
+  80020d:	c3                   	ret
+
+000000000080020e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80020e:	55                   	push   %rbp
+  80020f:	48 89 e5             	mov    %rsp,%rbp
+  800212:	48 83 ec 50          	sub    $0x50,%rsp
+  800216:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80021a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80021e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800222:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800226:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80022a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800231:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800235:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800239:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80023d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800241:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800245:	48 b8 aa 01 80 00 00 	movabs $0x8001aa,%rax
+  80024c:	00 00 00 
+  80024f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800251:	c9                   	leave
+  800252:	c3                   	ret
+
+0000000000800253 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800253:	55                   	push   %rbp
+  800254:	48 89 e5             	mov    %rsp,%rbp
+  800257:	41 57                	push   %r15
+  800259:	41 56                	push   %r14
+  80025b:	41 55                	push   %r13
+  80025d:	41 54                	push   %r12
+  80025f:	53                   	push   %rbx
+  800260:	48 83 ec 18          	sub    $0x18,%rsp
+  800264:	49 89 fc             	mov    %rdi,%r12
+  800267:	49 89 f5             	mov    %rsi,%r13
+  80026a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80026e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800271:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800274:	41 89 cf             	mov    %ecx,%r15d
+  800277:	4c 39 fa             	cmp    %r15,%rdx
+  80027a:	73 5b                	jae    8002d7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80027c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800280:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800284:	85 db                	test   %ebx,%ebx
+  800286:	7e 0e                	jle    800296 <print_num+0x43>
+            putch(padc, put_arg);
+  800288:	4c 89 ee             	mov    %r13,%rsi
+  80028b:	44 89 f7             	mov    %r14d,%edi
+  80028e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800291:	83 eb 01             	sub    $0x1,%ebx
+  800294:	75 f2                	jne    800288 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800296:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80029a:	48 b9 38 50 80 00 00 	movabs $0x805038,%rcx
+  8002a1:	00 00 00 
+  8002a4:	48 b8 27 50 80 00 00 	movabs $0x805027,%rax
+  8002ab:	00 00 00 
+  8002ae:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002bb:	49 f7 f7             	div    %r15
+  8002be:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002c2:	4c 89 ee             	mov    %r13,%rsi
+  8002c5:	41 ff d4             	call   *%r12
+}
+  8002c8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002cc:	5b                   	pop    %rbx
+  8002cd:	41 5c                	pop    %r12
+  8002cf:	41 5d                	pop    %r13
+  8002d1:	41 5e                	pop    %r14
+  8002d3:	41 5f                	pop    %r15
+  8002d5:	5d                   	pop    %rbp
+  8002d6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e0:	49 f7 f7             	div    %r15
+  8002e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8002e7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002eb:	52                   	push   %rdx
+  8002ec:	45 0f be c9          	movsbl %r9b,%r9d
+  8002f0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002f4:	48 89 c2             	mov    %rax,%rdx
+  8002f7:	48 b8 53 02 80 00 00 	movabs $0x800253,%rax
+  8002fe:	00 00 00 
+  800301:	ff d0                	call   *%rax
+  800303:	48 83 c4 10          	add    $0x10,%rsp
+  800307:	eb 8d                	jmp    800296 <print_num+0x43>
+
+0000000000800309 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800309:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80030d:	48 8b 06             	mov    (%rsi),%rax
+  800310:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800314:	73 0a                	jae    800320 <sprintputch+0x17>
+        *state->start++ = ch;
+  800316:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80031a:	48 89 16             	mov    %rdx,(%rsi)
+  80031d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800320:	c3                   	ret
+
+0000000000800321 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800321:	55                   	push   %rbp
+  800322:	48 89 e5             	mov    %rsp,%rbp
+  800325:	48 83 ec 50          	sub    $0x50,%rsp
+  800329:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80032d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800331:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800335:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80033c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800340:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800344:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800348:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80034c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800350:	48 b8 5e 03 80 00 00 	movabs $0x80035e,%rax
+  800357:	00 00 00 
+  80035a:	ff d0                	call   *%rax
+}
+  80035c:	c9                   	leave
+  80035d:	c3                   	ret
+
+000000000080035e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80035e:	55                   	push   %rbp
+  80035f:	48 89 e5             	mov    %rsp,%rbp
+  800362:	41 57                	push   %r15
+  800364:	41 56                	push   %r14
+  800366:	41 55                	push   %r13
+  800368:	41 54                	push   %r12
+  80036a:	53                   	push   %rbx
+  80036b:	48 83 ec 38          	sub    $0x38,%rsp
+  80036f:	49 89 fe             	mov    %rdi,%r14
+  800372:	49 89 f5             	mov    %rsi,%r13
+  800375:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800378:	48 8b 01             	mov    (%rcx),%rax
+  80037b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80037f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800383:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800387:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80038b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80038f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800393:	0f b6 3b             	movzbl (%rbx),%edi
+  800396:	40 80 ff 25          	cmp    $0x25,%dil
+  80039a:	74 18                	je     8003b4 <vprintfmt+0x56>
+            if (!ch) return;
+  80039c:	40 84 ff             	test   %dil,%dil
+  80039f:	0f 84 04 07 00 00    	je     800aa9 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8003a5:	40 0f b6 ff          	movzbl %dil,%edi
+  8003a9:	4c 89 ee             	mov    %r13,%rsi
+  8003ac:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003af:	4c 89 e3             	mov    %r12,%rbx
+  8003b2:	eb db                	jmp    80038f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003bd:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003c2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003c8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003cf:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003d8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003dd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003e0:	83 e8 23             	sub    $0x23,%eax
+  8003e3:	3c 57                	cmp    $0x57,%al
+  8003e5:	0f 87 a4 06 00 00    	ja     800a8f <vprintfmt+0x731>
+  8003eb:	0f b6 c0             	movzbl %al,%eax
+  8003ee:	48 b9 c0 51 80 00 00 	movabs $0x8051c0,%rcx
+  8003f5:	00 00 00 
+  8003f8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003fb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003fe:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800402:	eb cf                	jmp    8003d3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800404:	49 89 dc             	mov    %rbx,%r12
+  800407:	be 01 00 00 00       	mov    $0x1,%esi
+  80040c:	eb c5                	jmp    8003d3 <vprintfmt+0x75>
+            padc = ch;
+  80040e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800412:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800415:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800418:	eb b9                	jmp    8003d3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80041a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80041d:	83 f8 2f             	cmp    $0x2f,%eax
+  800420:	77 24                	ja     800446 <vprintfmt+0xe8>
+  800422:	89 c1                	mov    %eax,%ecx
+  800424:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800428:	83 c0 08             	add    $0x8,%eax
+  80042b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80042e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800431:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800434:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800438:	79 99                	jns    8003d3 <vprintfmt+0x75>
+                width = precision;
+  80043a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80043e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800444:	eb 8d                	jmp    8003d3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800446:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80044a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80044e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800452:	eb da                	jmp    80042e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800454:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800459:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80045d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800463:	3c 39                	cmp    $0x39,%al
+  800465:	77 1c                	ja     800483 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800467:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80046b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80046f:	0f b6 c0             	movzbl %al,%eax
+  800472:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800477:	0f b6 03             	movzbl (%rbx),%eax
+  80047a:	3c 39                	cmp    $0x39,%al
+  80047c:	76 e9                	jbe    800467 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80047e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800481:	eb b1                	jmp    800434 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800483:	49 89 dc             	mov    %rbx,%r12
+  800486:	eb ac                	jmp    800434 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800488:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80048b:	85 c9                	test   %ecx,%ecx
+  80048d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800492:	0f 49 c1             	cmovns %ecx,%eax
+  800495:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800498:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80049b:	e9 33 ff ff ff       	jmp    8003d3 <vprintfmt+0x75>
+            lflag++;
+  8004a0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004a3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a6:	e9 28 ff ff ff       	jmp    8003d3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b1:	77 19                	ja     8004cc <vprintfmt+0x16e>
+  8004b3:	89 c2                	mov    %eax,%edx
+  8004b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b9:	83 c0 08             	add    $0x8,%eax
+  8004bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004bf:	8b 3a                	mov    (%rdx),%edi
+  8004c1:	4c 89 ee             	mov    %r13,%rsi
+  8004c4:	41 ff d6             	call   *%r14
+            break;
+  8004c7:	e9 c3 fe ff ff       	jmp    80038f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004d8:	eb e5                	jmp    8004bf <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8004e0:	77 5a                	ja     80053c <vprintfmt+0x1de>
+  8004e2:	89 c2                	mov    %eax,%edx
+  8004e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004e8:	83 c0 08             	add    $0x8,%eax
+  8004eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004ee:	8b 02                	mov    (%rdx),%eax
+  8004f0:	89 c1                	mov    %eax,%ecx
+  8004f2:	f7 d9                	neg    %ecx
+  8004f4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004f7:	83 f9 13             	cmp    $0x13,%ecx
+  8004fa:	7f 4e                	jg     80054a <vprintfmt+0x1ec>
+  8004fc:	48 63 c1             	movslq %ecx,%rax
+  8004ff:	48 ba 80 54 80 00 00 	movabs $0x805480,%rdx
+  800506:	00 00 00 
+  800509:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80050d:	48 85 c0             	test   %rax,%rax
+  800510:	74 38                	je     80054a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800512:	48 89 c1             	mov    %rax,%rcx
+  800515:	48 ba 6a 56 80 00 00 	movabs $0x80566a,%rdx
+  80051c:	00 00 00 
+  80051f:	4c 89 ee             	mov    %r13,%rsi
+  800522:	4c 89 f7             	mov    %r14,%rdi
+  800525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052a:	49 b8 21 03 80 00 00 	movabs $0x800321,%r8
+  800531:	00 00 00 
+  800534:	41 ff d0             	call   *%r8
+  800537:	e9 53 fe ff ff       	jmp    80038f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80053c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800540:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800544:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800548:	eb a4                	jmp    8004ee <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80054a:	48 ba 50 50 80 00 00 	movabs $0x805050,%rdx
+  800551:	00 00 00 
+  800554:	4c 89 ee             	mov    %r13,%rsi
+  800557:	4c 89 f7             	mov    %r14,%rdi
+  80055a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055f:	49 b8 21 03 80 00 00 	movabs $0x800321,%r8
+  800566:	00 00 00 
+  800569:	41 ff d0             	call   *%r8
+  80056c:	e9 1e fe ff ff       	jmp    80038f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800571:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800574:	83 f8 2f             	cmp    $0x2f,%eax
+  800577:	77 36                	ja     8005af <vprintfmt+0x251>
+  800579:	89 c2                	mov    %eax,%edx
+  80057b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80057f:	83 c0 08             	add    $0x8,%eax
+  800582:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800585:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800588:	48 85 f6             	test   %rsi,%rsi
+  80058b:	48 b8 49 50 80 00 00 	movabs $0x805049,%rax
+  800592:	00 00 00 
+  800595:	48 0f 45 c6          	cmovne %rsi,%rax
+  800599:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80059d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005a1:	7e 06                	jle    8005a9 <vprintfmt+0x24b>
+  8005a3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005a7:	75 14                	jne    8005bd <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005a9:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8005ad:	eb 5b                	jmp    80060a <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8005af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bb:	eb c8                	jmp    800585 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005bd:	49 63 f7             	movslq %r15d,%rsi
+  8005c0:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005c4:	48 b8 63 0b 80 00 00 	movabs $0x800b63,%rax
+  8005cb:	00 00 00 
+  8005ce:	ff d0                	call   *%rax
+  8005d0:	48 89 c2             	mov    %rax,%rdx
+  8005d3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005d6:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005d8:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005db:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005de:	85 c0                	test   %eax,%eax
+  8005e0:	7e c7                	jle    8005a9 <vprintfmt+0x24b>
+  8005e2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005e7:	4c 89 ee             	mov    %r13,%rsi
+  8005ea:	44 89 e7             	mov    %r12d,%edi
+  8005ed:	41 ff d6             	call   *%r14
+  8005f0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005f4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005f7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005fa:	75 eb                	jne    8005e7 <vprintfmt+0x289>
+  8005fc:	eb ab                	jmp    8005a9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005fe:	0f b6 f8             	movzbl %al,%edi
+  800601:	4c 89 ee             	mov    %r13,%rsi
+  800604:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800607:	4c 89 e2             	mov    %r12,%rdx
+  80060a:	45 85 ff             	test   %r15d,%r15d
+  80060d:	78 06                	js     800615 <vprintfmt+0x2b7>
+  80060f:	41 83 ef 01          	sub    $0x1,%r15d
+  800613:	78 23                	js     800638 <vprintfmt+0x2da>
+  800615:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800619:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80061f:	84 c0                	test   %al,%al
+  800621:	74 15                	je     800638 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800623:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800627:	74 d5                	je     8005fe <vprintfmt+0x2a0>
+  800629:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80062c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800631:	80 fa 5e             	cmp    $0x5e,%dl
+  800634:	77 cb                	ja     800601 <vprintfmt+0x2a3>
+  800636:	eb c6                	jmp    8005fe <vprintfmt+0x2a0>
+  800638:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80063b:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  80063e:	01 f0                	add    %esi,%eax
+  800640:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800642:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800646:	85 c0                	test   %eax,%eax
+  800648:	0f 8e 41 fd ff ff    	jle    80038f <vprintfmt+0x31>
+  80064e:	4c 89 ee             	mov    %r13,%rsi
+  800651:	bf 20 00 00 00       	mov    $0x20,%edi
+  800656:	41 ff d6             	call   *%r14
+  800659:	41 83 ec 01          	sub    $0x1,%r12d
+  80065d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800661:	75 eb                	jne    80064e <vprintfmt+0x2f0>
+  800663:	e9 27 fd ff ff       	jmp    80038f <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800668:	40 84 f6             	test   %sil,%sil
+  80066b:	75 26                	jne    800693 <vprintfmt+0x335>
+    switch (lflag) {
+  80066d:	85 d2                	test   %edx,%edx
+  80066f:	74 59                	je     8006ca <vprintfmt+0x36c>
+  800671:	83 fa 01             	cmp    $0x1,%edx
+  800674:	74 7b                	je     8006f1 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800676:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800679:	83 f8 2f             	cmp    $0x2f,%eax
+  80067c:	0f 87 96 00 00 00    	ja     800718 <vprintfmt+0x3ba>
+  800682:	89 c2                	mov    %eax,%edx
+  800684:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800688:	83 c0 08             	add    $0x8,%eax
+  80068b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80068e:	4c 8b 22             	mov    (%rdx),%r12
+  800691:	eb 17                	jmp    8006aa <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800693:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800696:	83 f8 2f             	cmp    $0x2f,%eax
+  800699:	77 21                	ja     8006bc <vprintfmt+0x35e>
+  80069b:	89 c2                	mov    %eax,%edx
+  80069d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a1:	83 c0 08             	add    $0x8,%eax
+  8006a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a7:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006aa:	4d 85 e4             	test   %r12,%r12
+  8006ad:	78 7a                	js     800729 <vprintfmt+0x3cb>
+            num = i;
+  8006af:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006b2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006b7:	e9 b5 02 00 00       	jmp    800971 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8006bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c8:	eb dd                	jmp    8006a7 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8006ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d0:	77 11                	ja     8006e3 <vprintfmt+0x385>
+  8006d2:	89 c2                	mov    %eax,%edx
+  8006d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d8:	83 c0 08             	add    $0x8,%eax
+  8006db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006de:	4c 63 22             	movslq (%rdx),%r12
+  8006e1:	eb c7                	jmp    8006aa <vprintfmt+0x34c>
+  8006e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ef:	eb ed                	jmp    8006de <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8006f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f7:	77 11                	ja     80070a <vprintfmt+0x3ac>
+  8006f9:	89 c2                	mov    %eax,%edx
+  8006fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ff:	83 c0 08             	add    $0x8,%eax
+  800702:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800705:	4c 8b 22             	mov    (%rdx),%r12
+  800708:	eb a0                	jmp    8006aa <vprintfmt+0x34c>
+  80070a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80070e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800712:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800716:	eb ed                	jmp    800705 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800718:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800720:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800724:	e9 65 ff ff ff       	jmp    80068e <vprintfmt+0x330>
+                putch('-', put_arg);
+  800729:	4c 89 ee             	mov    %r13,%rsi
+  80072c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800731:	41 ff d6             	call   *%r14
+                i = -i;
+  800734:	49 f7 dc             	neg    %r12
+  800737:	e9 73 ff ff ff       	jmp    8006af <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  80073c:	40 84 f6             	test   %sil,%sil
+  80073f:	75 32                	jne    800773 <vprintfmt+0x415>
+    switch (lflag) {
+  800741:	85 d2                	test   %edx,%edx
+  800743:	74 5d                	je     8007a2 <vprintfmt+0x444>
+  800745:	83 fa 01             	cmp    $0x1,%edx
+  800748:	0f 84 82 00 00 00    	je     8007d0 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  80074e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800751:	83 f8 2f             	cmp    $0x2f,%eax
+  800754:	0f 87 a5 00 00 00    	ja     8007ff <vprintfmt+0x4a1>
+  80075a:	89 c2                	mov    %eax,%edx
+  80075c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800760:	83 c0 08             	add    $0x8,%eax
+  800763:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800766:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800769:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80076e:	e9 fe 01 00 00       	jmp    800971 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800773:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800776:	83 f8 2f             	cmp    $0x2f,%eax
+  800779:	77 19                	ja     800794 <vprintfmt+0x436>
+  80077b:	89 c2                	mov    %eax,%edx
+  80077d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800781:	83 c0 08             	add    $0x8,%eax
+  800784:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800787:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80078a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80078f:	e9 dd 01 00 00       	jmp    800971 <vprintfmt+0x613>
+  800794:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800798:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a0:	eb e5                	jmp    800787 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8007a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a8:	77 18                	ja     8007c2 <vprintfmt+0x464>
+  8007aa:	89 c2                	mov    %eax,%edx
+  8007ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b0:	83 c0 08             	add    $0x8,%eax
+  8007b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b6:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007b8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007bd:	e9 af 01 00 00       	jmp    800971 <vprintfmt+0x613>
+  8007c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ce:	eb e6                	jmp    8007b6 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8007d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d6:	77 19                	ja     8007f1 <vprintfmt+0x493>
+  8007d8:	89 c2                	mov    %eax,%edx
+  8007da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007de:	83 c0 08             	add    $0x8,%eax
+  8007e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007e7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007ec:	e9 80 01 00 00       	jmp    800971 <vprintfmt+0x613>
+  8007f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fd:	eb e5                	jmp    8007e4 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8007ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800803:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800807:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080b:	e9 56 ff ff ff       	jmp    800766 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	40 84 f6             	test   %sil,%sil
+  800813:	75 2e                	jne    800843 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800815:	85 d2                	test   %edx,%edx
+  800817:	0f 84 b3 00 00 00    	je     8008d0 <vprintfmt+0x572>
+  80081d:	83 fa 01             	cmp    $0x1,%edx
+  800820:	0f 84 d3 00 00 00    	je     8008f9 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800826:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800829:	83 f8 2f             	cmp    $0x2f,%eax
+  80082c:	0f 87 f1 00 00 00    	ja     800923 <vprintfmt+0x5c5>
+  800832:	89 c2                	mov    %eax,%edx
+  800834:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800838:	83 c0 08             	add    $0x8,%eax
+  80083b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083e:	48 8b 02             	mov    (%rdx),%rax
+  800841:	eb 17                	jmp    80085a <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800843:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800846:	83 f8 2f             	cmp    $0x2f,%eax
+  800849:	77 77                	ja     8008c2 <vprintfmt+0x564>
+  80084b:	89 c2                	mov    %eax,%edx
+  80084d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800851:	83 c0 08             	add    $0x8,%eax
+  800854:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800857:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  80085a:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80085c:	83 f8 07             	cmp    $0x7,%eax
+  80085f:	0f 8e cf 00 00 00    	jle    800934 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800865:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80086b:	44 89 e7             	mov    %r12d,%edi
+  80086e:	41 c1 e4 03          	shl    $0x3,%r12d
+  800872:	89 d1                	mov    %edx,%ecx
+  800874:	8d 72 07             	lea    0x7(%rdx),%esi
+  800877:	85 d2                	test   %edx,%edx
+  800879:	0f 48 d6             	cmovs  %esi,%edx
+  80087c:	c1 fa 03             	sar    $0x3,%edx
+  80087f:	83 f9 3f             	cmp    $0x3f,%ecx
+  800882:	7f e7                	jg     80086b <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800884:	85 ff                	test   %edi,%edi
+  800886:	0f 84 03 fb ff ff    	je     80038f <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  80088c:	49 63 f4             	movslq %r12d,%rsi
+  80088f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800894:	48 f7 f6             	div    %rsi
+  800897:	49 89 d7             	mov    %rdx,%r15
+  80089a:	83 c0 30             	add    $0x30,%eax
+  80089d:	0f be f8             	movsbl %al,%edi
+  8008a0:	4c 89 ee             	mov    %r13,%rsi
+  8008a3:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  8008a6:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  8008a9:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  8008ae:	45 85 e4             	test   %r12d,%r12d
+  8008b1:	41 0f 49 d4          	cmovns %r12d,%edx
+  8008b5:	c1 fa 03             	sar    $0x3,%edx
+  8008b8:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  8008bb:	75 cf                	jne    80088c <vprintfmt+0x52e>
+  8008bd:	e9 cd fa ff ff       	jmp    80038f <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ce:	eb 87                	jmp    800857 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  8008d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d6:	77 13                	ja     8008eb <vprintfmt+0x58d>
+  8008d8:	89 c2                	mov    %eax,%edx
+  8008da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008de:	83 c0 08             	add    $0x8,%eax
+  8008e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e4:	8b 02                	mov    (%rdx),%eax
+  8008e6:	e9 6f ff ff ff       	jmp    80085a <vprintfmt+0x4fc>
+  8008eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f7:	eb eb                	jmp    8008e4 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8008f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ff:	77 14                	ja     800915 <vprintfmt+0x5b7>
+  800901:	89 c2                	mov    %eax,%edx
+  800903:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800907:	83 c0 08             	add    $0x8,%eax
+  80090a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090d:	48 8b 02             	mov    (%rdx),%rax
+  800910:	e9 45 ff ff ff       	jmp    80085a <vprintfmt+0x4fc>
+  800915:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800919:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800921:	eb ea                	jmp    80090d <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800923:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800927:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092f:	e9 0a ff ff ff       	jmp    80083e <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800934:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  80093a:	e9 4d ff ff ff       	jmp    80088c <vprintfmt+0x52e>
+            putch('0', put_arg);
+  80093f:	4c 89 ee             	mov    %r13,%rsi
+  800942:	bf 30 00 00 00       	mov    $0x30,%edi
+  800947:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80094a:	4c 89 ee             	mov    %r13,%rsi
+  80094d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800952:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800955:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800958:	83 f8 2f             	cmp    $0x2f,%eax
+  80095b:	77 47                	ja     8009a4 <vprintfmt+0x646>
+  80095d:	89 c2                	mov    %eax,%edx
+  80095f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800963:	83 c0 08             	add    $0x8,%eax
+  800966:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800969:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80096c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800971:	48 83 ec 08          	sub    $0x8,%rsp
+  800975:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800979:	0f 94 c0             	sete   %al
+  80097c:	0f b6 c0             	movzbl %al,%eax
+  80097f:	50                   	push   %rax
+  800980:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800985:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800989:	4c 89 ee             	mov    %r13,%rsi
+  80098c:	4c 89 f7             	mov    %r14,%rdi
+  80098f:	48 b8 53 02 80 00 00 	movabs $0x800253,%rax
+  800996:	00 00 00 
+  800999:	ff d0                	call   *%rax
+            break;
+  80099b:	48 83 c4 10          	add    $0x10,%rsp
+  80099f:	e9 eb f9 ff ff       	jmp    80038f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b0:	eb b7                	jmp    800969 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b2:	40 84 f6             	test   %sil,%sil
+  8009b5:	75 2b                	jne    8009e2 <vprintfmt+0x684>
+    switch (lflag) {
+  8009b7:	85 d2                	test   %edx,%edx
+  8009b9:	74 56                	je     800a11 <vprintfmt+0x6b3>
+  8009bb:	83 fa 01             	cmp    $0x1,%edx
+  8009be:	74 7f                	je     800a3f <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  8009c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c6:	0f 87 a2 00 00 00    	ja     800a6e <vprintfmt+0x710>
+  8009cc:	89 c2                	mov    %eax,%edx
+  8009ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d2:	83 c0 08             	add    $0x8,%eax
+  8009d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009db:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009e0:	eb 8f                	jmp    800971 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e8:	77 19                	ja     800a03 <vprintfmt+0x6a5>
+  8009ea:	89 c2                	mov    %eax,%edx
+  8009ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f0:	83 c0 08             	add    $0x8,%eax
+  8009f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009fe:	e9 6e ff ff ff       	jmp    800971 <vprintfmt+0x613>
+  800a03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0f:	eb e5                	jmp    8009f6 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800a11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a14:	83 f8 2f             	cmp    $0x2f,%eax
+  800a17:	77 18                	ja     800a31 <vprintfmt+0x6d3>
+  800a19:	89 c2                	mov    %eax,%edx
+  800a1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1f:	83 c0 08             	add    $0x8,%eax
+  800a22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a25:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a27:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a2c:	e9 40 ff ff ff       	jmp    800971 <vprintfmt+0x613>
+  800a31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3d:	eb e6                	jmp    800a25 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800a3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a42:	83 f8 2f             	cmp    $0x2f,%eax
+  800a45:	77 19                	ja     800a60 <vprintfmt+0x702>
+  800a47:	89 c2                	mov    %eax,%edx
+  800a49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4d:	83 c0 08             	add    $0x8,%eax
+  800a50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a53:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a56:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a5b:	e9 11 ff ff ff       	jmp    800971 <vprintfmt+0x613>
+  800a60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6c:	eb e5                	jmp    800a53 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800a6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7a:	e9 59 ff ff ff       	jmp    8009d8 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800a7f:	4c 89 ee             	mov    %r13,%rsi
+  800a82:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a87:	41 ff d6             	call   *%r14
+            break;
+  800a8a:	e9 00 f9 ff ff       	jmp    80038f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a8f:	4c 89 ee             	mov    %r13,%rsi
+  800a92:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a97:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a9a:	48 83 eb 01          	sub    $0x1,%rbx
+  800a9e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800aa2:	75 f6                	jne    800a9a <vprintfmt+0x73c>
+  800aa4:	e9 e6 f8 ff ff       	jmp    80038f <vprintfmt+0x31>
+}
+  800aa9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800aad:	5b                   	pop    %rbx
+  800aae:	41 5c                	pop    %r12
+  800ab0:	41 5d                	pop    %r13
+  800ab2:	41 5e                	pop    %r14
+  800ab4:	41 5f                	pop    %r15
+  800ab6:	5d                   	pop    %rbp
+  800ab7:	c3                   	ret
+
+0000000000800ab8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ab8:	55                   	push   %rbp
+  800ab9:	48 89 e5             	mov    %rsp,%rbp
+  800abc:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ac0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ac4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ac9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800acd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ad4:	48 85 ff             	test   %rdi,%rdi
+  800ad7:	74 2b                	je     800b04 <vsnprintf+0x4c>
+  800ad9:	48 85 f6             	test   %rsi,%rsi
+  800adc:	74 26                	je     800b04 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ade:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ae2:	48 bf 09 03 80 00 00 	movabs $0x800309,%rdi
+  800ae9:	00 00 00 
+  800aec:	48 b8 5e 03 80 00 00 	movabs $0x80035e,%rax
+  800af3:	00 00 00 
+  800af6:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800af8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800afc:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800aff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b02:	c9                   	leave
+  800b03:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b09:	eb f7                	jmp    800b02 <vsnprintf+0x4a>
+
+0000000000800b0b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b0b:	55                   	push   %rbp
+  800b0c:	48 89 e5             	mov    %rsp,%rbp
+  800b0f:	48 83 ec 50          	sub    $0x50,%rsp
+  800b13:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b17:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b1b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b1f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b26:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b32:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b36:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b3a:	48 b8 b8 0a 80 00 00 	movabs $0x800ab8,%rax
+  800b41:	00 00 00 
+  800b44:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b46:	c9                   	leave
+  800b47:	c3                   	ret
+
+0000000000800b48 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b48:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b4b:	74 10                	je     800b5d <strlen+0x15>
+    size_t n = 0;
+  800b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b52:	48 83 c0 01          	add    $0x1,%rax
+  800b56:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b5a:	75 f6                	jne    800b52 <strlen+0xa>
+  800b5c:	c3                   	ret
+    size_t n = 0;
+  800b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b62:	c3                   	ret
+
+0000000000800b63 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b63:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b66:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b6b:	48 85 f6             	test   %rsi,%rsi
+  800b6e:	74 11                	je     800b81 <strnlen+0x1e>
+  800b70:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b74:	74 0c                	je     800b82 <strnlen+0x1f>
+  800b76:	48 83 c2 01          	add    $0x1,%rdx
+  800b7a:	48 39 d0             	cmp    %rdx,%rax
+  800b7d:	75 f1                	jne    800b70 <strnlen+0xd>
+  800b7f:	eb 04                	jmp    800b85 <strnlen+0x22>
+  800b81:	c3                   	ret
+  800b82:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b85:	c3                   	ret
+
+0000000000800b86 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b86:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b92:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b95:	48 83 c2 01          	add    $0x1,%rdx
+  800b99:	84 c9                	test   %cl,%cl
+  800b9b:	75 f1                	jne    800b8e <strcpy+0x8>
+        ;
+    return res;
+}
+  800b9d:	c3                   	ret
+
+0000000000800b9e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b9e:	55                   	push   %rbp
+  800b9f:	48 89 e5             	mov    %rsp,%rbp
+  800ba2:	41 54                	push   %r12
+  800ba4:	53                   	push   %rbx
+  800ba5:	48 89 fb             	mov    %rdi,%rbx
+  800ba8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bab:	48 b8 48 0b 80 00 00 	movabs $0x800b48,%rax
+  800bb2:	00 00 00 
+  800bb5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bb7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bbb:	4c 89 e6             	mov    %r12,%rsi
+  800bbe:	48 b8 86 0b 80 00 00 	movabs $0x800b86,%rax
+  800bc5:	00 00 00 
+  800bc8:	ff d0                	call   *%rax
+    return dst;
+}
+  800bca:	48 89 d8             	mov    %rbx,%rax
+  800bcd:	5b                   	pop    %rbx
+  800bce:	41 5c                	pop    %r12
+  800bd0:	5d                   	pop    %rbp
+  800bd1:	c3                   	ret
+
+0000000000800bd2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bd2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bd5:	48 85 d2             	test   %rdx,%rdx
+  800bd8:	74 1f                	je     800bf9 <strncpy+0x27>
+  800bda:	48 01 fa             	add    %rdi,%rdx
+  800bdd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800be0:	48 83 c1 01          	add    $0x1,%rcx
+  800be4:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800be8:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bec:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bf0:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bf4:	48 39 ca             	cmp    %rcx,%rdx
+  800bf7:	75 e7                	jne    800be0 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bf9:	c3                   	ret
+
+0000000000800bfa <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bfa:	48 89 f8             	mov    %rdi,%rax
+  800bfd:	48 85 d2             	test   %rdx,%rdx
+  800c00:	74 24                	je     800c26 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c02:	48 83 ea 01          	sub    $0x1,%rdx
+  800c06:	74 1b                	je     800c23 <strlcpy+0x29>
+  800c08:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c0c:	0f b6 16             	movzbl (%rsi),%edx
+  800c0f:	84 d2                	test   %dl,%dl
+  800c11:	74 10                	je     800c23 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c13:	48 83 c6 01          	add    $0x1,%rsi
+  800c17:	48 83 c0 01          	add    $0x1,%rax
+  800c1b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c1e:	48 39 c8             	cmp    %rcx,%rax
+  800c21:	75 e9                	jne    800c0c <strlcpy+0x12>
+        *dst = '\0';
+  800c23:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c26:	48 29 f8             	sub    %rdi,%rax
+}
+  800c29:	c3                   	ret
+
+0000000000800c2a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c2a:	0f b6 07             	movzbl (%rdi),%eax
+  800c2d:	84 c0                	test   %al,%al
+  800c2f:	74 13                	je     800c44 <strcmp+0x1a>
+  800c31:	38 06                	cmp    %al,(%rsi)
+  800c33:	75 0f                	jne    800c44 <strcmp+0x1a>
+  800c35:	48 83 c7 01          	add    $0x1,%rdi
+  800c39:	48 83 c6 01          	add    $0x1,%rsi
+  800c3d:	0f b6 07             	movzbl (%rdi),%eax
+  800c40:	84 c0                	test   %al,%al
+  800c42:	75 ed                	jne    800c31 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c44:	0f b6 c0             	movzbl %al,%eax
+  800c47:	0f b6 16             	movzbl (%rsi),%edx
+  800c4a:	29 d0                	sub    %edx,%eax
+}
+  800c4c:	c3                   	ret
+
+0000000000800c4d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c4d:	48 85 d2             	test   %rdx,%rdx
+  800c50:	74 1f                	je     800c71 <strncmp+0x24>
+  800c52:	0f b6 07             	movzbl (%rdi),%eax
+  800c55:	84 c0                	test   %al,%al
+  800c57:	74 1e                	je     800c77 <strncmp+0x2a>
+  800c59:	3a 06                	cmp    (%rsi),%al
+  800c5b:	75 1a                	jne    800c77 <strncmp+0x2a>
+  800c5d:	48 83 c7 01          	add    $0x1,%rdi
+  800c61:	48 83 c6 01          	add    $0x1,%rsi
+  800c65:	48 83 ea 01          	sub    $0x1,%rdx
+  800c69:	75 e7                	jne    800c52 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c70:	c3                   	ret
+  800c71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c76:	c3                   	ret
+  800c77:	48 85 d2             	test   %rdx,%rdx
+  800c7a:	74 09                	je     800c85 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c7c:	0f b6 07             	movzbl (%rdi),%eax
+  800c7f:	0f b6 16             	movzbl (%rsi),%edx
+  800c82:	29 d0                	sub    %edx,%eax
+  800c84:	c3                   	ret
+    if (!n) return 0;
+  800c85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c8a:	c3                   	ret
+
+0000000000800c8b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c8b:	0f b6 17             	movzbl (%rdi),%edx
+  800c8e:	84 d2                	test   %dl,%dl
+  800c90:	74 18                	je     800caa <strchr+0x1f>
+        if (*str == c) {
+  800c92:	0f be d2             	movsbl %dl,%edx
+  800c95:	39 f2                	cmp    %esi,%edx
+  800c97:	74 17                	je     800cb0 <strchr+0x25>
+    for (; *str; str++) {
+  800c99:	48 83 c7 01          	add    $0x1,%rdi
+  800c9d:	0f b6 17             	movzbl (%rdi),%edx
+  800ca0:	84 d2                	test   %dl,%dl
+  800ca2:	75 ee                	jne    800c92 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca9:	c3                   	ret
+  800caa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800caf:	c3                   	ret
+  800cb0:	48 89 f8             	mov    %rdi,%rax
+}
+  800cb3:	c3                   	ret
+
+0000000000800cb4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cb4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cb7:	0f b6 17             	movzbl (%rdi),%edx
+  800cba:	84 d2                	test   %dl,%dl
+  800cbc:	74 13                	je     800cd1 <strfind+0x1d>
+  800cbe:	0f be d2             	movsbl %dl,%edx
+  800cc1:	39 f2                	cmp    %esi,%edx
+  800cc3:	74 0b                	je     800cd0 <strfind+0x1c>
+  800cc5:	48 83 c0 01          	add    $0x1,%rax
+  800cc9:	0f b6 10             	movzbl (%rax),%edx
+  800ccc:	84 d2                	test   %dl,%dl
+  800cce:	75 ee                	jne    800cbe <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cd0:	c3                   	ret
+  800cd1:	c3                   	ret
+
+0000000000800cd2 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800cd2:	55                   	push   %rbp
+  800cd3:	48 89 e5             	mov    %rsp,%rbp
+  800cd6:	41 57                	push   %r15
+  800cd8:	41 56                	push   %r14
+  800cda:	41 55                	push   %r13
+  800cdc:	41 54                	push   %r12
+  800cde:	53                   	push   %rbx
+  800cdf:	48 83 ec 08          	sub    $0x8,%rsp
+  800ce3:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800ce6:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800cea:	45 84 ed             	test   %r13b,%r13b
+  800ced:	75 12                	jne    800d01 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800cef:	4c 89 f8             	mov    %r15,%rax
+  800cf2:	48 83 c4 08          	add    $0x8,%rsp
+  800cf6:	5b                   	pop    %rbx
+  800cf7:	41 5c                	pop    %r12
+  800cf9:	41 5d                	pop    %r13
+  800cfb:	41 5e                	pop    %r14
+  800cfd:	41 5f                	pop    %r15
+  800cff:	5d                   	pop    %rbp
+  800d00:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800d01:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800d05:	4c 89 e7             	mov    %r12,%rdi
+  800d08:	48 b8 48 0b 80 00 00 	movabs $0x800b48,%rax
+  800d0f:	00 00 00 
+  800d12:	ff d0                	call   *%rax
+  800d14:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800d17:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800d1b:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800d1f:	49 bf 4d 0c 80 00 00 	movabs $0x800c4d,%r15
+  800d26:	00 00 00 
+				if ((sc = *s++) == 0)
+  800d29:	84 c0                	test   %al,%al
+  800d2b:	75 14                	jne    800d41 <strstr+0x6f>
+					return NULL;
+  800d2d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d33:	eb ba                	jmp    800cef <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800d35:	48 83 c3 01          	add    $0x1,%rbx
+  800d39:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800d3d:	84 c0                	test   %al,%al
+  800d3f:	74 1b                	je     800d5c <strstr+0x8a>
+			} while (sc != c);
+  800d41:	41 38 c5             	cmp    %al,%r13b
+  800d44:	75 ef                	jne    800d35 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800d46:	4c 89 f2             	mov    %r14,%rdx
+  800d49:	4c 89 e6             	mov    %r12,%rsi
+  800d4c:	48 89 df             	mov    %rbx,%rdi
+  800d4f:	41 ff d7             	call   *%r15
+  800d52:	85 c0                	test   %eax,%eax
+  800d54:	75 df                	jne    800d35 <strstr+0x63>
+  800d56:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800d5a:	eb 93                	jmp    800cef <strstr+0x1d>
+					return NULL;
+  800d5c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d62:	eb 8b                	jmp    800cef <strstr+0x1d>
+
+0000000000800d64 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800d64:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800d66:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800d69:	8d 57 20             	lea    0x20(%rdi),%edx
+  800d6c:	83 f9 1a             	cmp    $0x1a,%ecx
+  800d6f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800d72:	c3                   	ret
+
+0000000000800d73 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800d73:	55                   	push   %rbp
+  800d74:	48 89 e5             	mov    %rsp,%rbp
+  800d77:	41 57                	push   %r15
+  800d79:	41 56                	push   %r14
+  800d7b:	41 55                	push   %r13
+  800d7d:	41 54                	push   %r12
+  800d7f:	53                   	push   %rbx
+  800d80:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800d84:	48 39 f7             	cmp    %rsi,%rdi
+  800d87:	74 49                	je     800dd2 <strcasecmp+0x5f>
+  800d89:	49 89 fd             	mov    %rdi,%r13
+  800d8c:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800d8f:	49 bf 64 0d 80 00 00 	movabs $0x800d64,%r15
+  800d96:	00 00 00 
+  800d99:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800d9e:	41 0f b6 fe          	movzbl %r14b,%edi
+  800da2:	41 ff d7             	call   *%r15
+  800da5:	89 c3                	mov    %eax,%ebx
+  800da7:	49 83 c4 01          	add    $0x1,%r12
+  800dab:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800db1:	41 ff d7             	call   *%r15
+  800db4:	29 c3                	sub    %eax,%ebx
+  800db6:	75 09                	jne    800dc1 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800db8:	49 83 c5 01          	add    $0x1,%r13
+  800dbc:	45 84 f6             	test   %r14b,%r14b
+  800dbf:	75 d8                	jne    800d99 <strcasecmp+0x26>
+}
+  800dc1:	89 d8                	mov    %ebx,%eax
+  800dc3:	48 83 c4 08          	add    $0x8,%rsp
+  800dc7:	5b                   	pop    %rbx
+  800dc8:	41 5c                	pop    %r12
+  800dca:	41 5d                	pop    %r13
+  800dcc:	41 5e                	pop    %r14
+  800dce:	41 5f                	pop    %r15
+  800dd0:	5d                   	pop    %rbp
+  800dd1:	c3                   	ret
+        return 0;
+  800dd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd7:	eb e8                	jmp    800dc1 <strcasecmp+0x4e>
+
+0000000000800dd9 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800dd9:	55                   	push   %rbp
+  800dda:	48 89 e5             	mov    %rsp,%rbp
+  800ddd:	41 57                	push   %r15
+  800ddf:	41 56                	push   %r14
+  800de1:	41 55                	push   %r13
+  800de3:	41 54                	push   %r12
+  800de5:	53                   	push   %rbx
+  800de6:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800dea:	48 85 d2             	test   %rdx,%rdx
+  800ded:	74 4f                	je     800e3e <strncasecmp+0x65>
+  800def:	49 89 fc             	mov    %rdi,%r12
+  800df2:	49 89 f5             	mov    %rsi,%r13
+  800df5:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800df9:	49 be 64 0d 80 00 00 	movabs $0x800d64,%r14
+  800e00:	00 00 00 
+  800e03:	49 83 c4 01          	add    $0x1,%r12
+  800e07:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e0d:	41 ff d6             	call   *%r14
+  800e10:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800e12:	49 83 c5 01          	add    $0x1,%r13
+  800e16:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800e1b:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800e1e:	29 c3                	sub    %eax,%ebx
+  800e20:	85 c0                	test   %eax,%eax
+  800e22:	74 09                	je     800e2d <strncasecmp+0x54>
+  800e24:	85 db                	test   %ebx,%ebx
+  800e26:	75 05                	jne    800e2d <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800e28:	4d 39 fc             	cmp    %r15,%r12
+  800e2b:	75 d6                	jne    800e03 <strncasecmp+0x2a>
+}
+  800e2d:	89 d8                	mov    %ebx,%eax
+  800e2f:	48 83 c4 08          	add    $0x8,%rsp
+  800e33:	5b                   	pop    %rbx
+  800e34:	41 5c                	pop    %r12
+  800e36:	41 5d                	pop    %r13
+  800e38:	41 5e                	pop    %r14
+  800e3a:	41 5f                	pop    %r15
+  800e3c:	5d                   	pop    %rbp
+  800e3d:	c3                   	ret
+    int d = 0;
+  800e3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800e43:	eb e8                	jmp    800e2d <strncasecmp+0x54>
+
+0000000000800e45 <toupper>:
+
+int toupper(int c) {
+  800e45:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800e47:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800e4a:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800e4d:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e50:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e53:	c3                   	ret
+
+0000000000800e54 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800e54:	83 ff 20             	cmp    $0x20,%edi
+  800e57:	0f 94 c0             	sete   %al
+  800e5a:	0f b6 c0             	movzbl %al,%eax
+}
+  800e5d:	c3                   	ret
+
+0000000000800e5e <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800e5e:	89 f8                	mov    %edi,%eax
+  800e60:	f7 d8                	neg    %eax
+  800e62:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800e65:	c3                   	ret
+
+0000000000800e66 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e66:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e69:	48 89 f8             	mov    %rdi,%rax
+  800e6c:	48 f7 d8             	neg    %rax
+  800e6f:	83 e0 07             	and    $0x7,%eax
+  800e72:	49 89 d1             	mov    %rdx,%r9
+  800e75:	49 29 c1             	sub    %rax,%r9
+  800e78:	78 36                	js     800eb0 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e7a:	40 0f b6 c6          	movzbl %sil,%eax
+  800e7e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e85:	01 01 01 
+  800e88:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e8c:	40 f6 c7 07          	test   $0x7,%dil
+  800e90:	75 38                	jne    800eca <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e92:	4c 89 c9             	mov    %r9,%rcx
+  800e95:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e99:	74 0c                	je     800ea7 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e9b:	fc                   	cld
+  800e9c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e9f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ea3:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ea7:	4d 85 c9             	test   %r9,%r9
+  800eaa:	75 45                	jne    800ef1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800eac:	4c 89 c0             	mov    %r8,%rax
+  800eaf:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800eb0:	48 85 d2             	test   %rdx,%rdx
+  800eb3:	74 f7                	je     800eac <memset+0x46>
+  800eb5:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800eb8:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ebb:	48 83 c0 01          	add    $0x1,%rax
+  800ebf:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ec3:	48 39 c2             	cmp    %rax,%rdx
+  800ec6:	75 f3                	jne    800ebb <memset+0x55>
+  800ec8:	eb e2                	jmp    800eac <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800eca:	40 f6 c7 01          	test   $0x1,%dil
+  800ece:	74 06                	je     800ed6 <memset+0x70>
+  800ed0:	88 07                	mov    %al,(%rdi)
+  800ed2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ed6:	40 f6 c7 02          	test   $0x2,%dil
+  800eda:	74 07                	je     800ee3 <memset+0x7d>
+  800edc:	66 89 07             	mov    %ax,(%rdi)
+  800edf:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ee3:	40 f6 c7 04          	test   $0x4,%dil
+  800ee7:	74 a9                	je     800e92 <memset+0x2c>
+  800ee9:	89 07                	mov    %eax,(%rdi)
+  800eeb:	48 83 c7 04          	add    $0x4,%rdi
+  800eef:	eb a1                	jmp    800e92 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ef1:	41 f6 c1 04          	test   $0x4,%r9b
+  800ef5:	74 06                	je     800efd <memset+0x97>
+  800ef7:	89 07                	mov    %eax,(%rdi)
+  800ef9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800efd:	41 f6 c1 02          	test   $0x2,%r9b
+  800f01:	74 07                	je     800f0a <memset+0xa4>
+  800f03:	66 89 07             	mov    %ax,(%rdi)
+  800f06:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f0a:	41 f6 c1 01          	test   $0x1,%r9b
+  800f0e:	74 9c                	je     800eac <memset+0x46>
+  800f10:	88 07                	mov    %al,(%rdi)
+  800f12:	eb 98                	jmp    800eac <memset+0x46>
+
+0000000000800f14 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f14:	48 89 f8             	mov    %rdi,%rax
+  800f17:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f1a:	48 39 fe             	cmp    %rdi,%rsi
+  800f1d:	73 3b                	jae    800f5a <memmove+0x46>
+  800f1f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f23:	48 39 d7             	cmp    %rdx,%rdi
+  800f26:	73 32                	jae    800f5a <memmove+0x46>
+        s += n;
+        d += n;
+  800f28:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f2c:	48 89 d6             	mov    %rdx,%rsi
+  800f2f:	48 09 fe             	or     %rdi,%rsi
+  800f32:	48 09 ce             	or     %rcx,%rsi
+  800f35:	40 f6 c6 07          	test   $0x7,%sil
+  800f39:	75 12                	jne    800f4d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f3b:	48 83 ef 08          	sub    $0x8,%rdi
+  800f3f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f43:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f47:	fd                   	std
+  800f48:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f4b:	fc                   	cld
+  800f4c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f4d:	48 83 ef 01          	sub    $0x1,%rdi
+  800f51:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f55:	fd                   	std
+  800f56:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f58:	eb f1                	jmp    800f4b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f5a:	48 89 f2             	mov    %rsi,%rdx
+  800f5d:	48 09 c2             	or     %rax,%rdx
+  800f60:	48 09 ca             	or     %rcx,%rdx
+  800f63:	f6 c2 07             	test   $0x7,%dl
+  800f66:	75 0c                	jne    800f74 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f68:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f6c:	48 89 c7             	mov    %rax,%rdi
+  800f6f:	fc                   	cld
+  800f70:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f73:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f74:	48 89 c7             	mov    %rax,%rdi
+  800f77:	fc                   	cld
+  800f78:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f7a:	c3                   	ret
+
+0000000000800f7b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f7b:	55                   	push   %rbp
+  800f7c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f7f:	48 b8 14 0f 80 00 00 	movabs $0x800f14,%rax
+  800f86:	00 00 00 
+  800f89:	ff d0                	call   *%rax
+}
+  800f8b:	5d                   	pop    %rbp
+  800f8c:	c3                   	ret
+
+0000000000800f8d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f8d:	55                   	push   %rbp
+  800f8e:	48 89 e5             	mov    %rsp,%rbp
+  800f91:	41 57                	push   %r15
+  800f93:	41 56                	push   %r14
+  800f95:	41 55                	push   %r13
+  800f97:	41 54                	push   %r12
+  800f99:	53                   	push   %rbx
+  800f9a:	48 83 ec 08          	sub    $0x8,%rsp
+  800f9e:	49 89 fe             	mov    %rdi,%r14
+  800fa1:	49 89 f7             	mov    %rsi,%r15
+  800fa4:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fa7:	48 89 f7             	mov    %rsi,%rdi
+  800faa:	48 b8 48 0b 80 00 00 	movabs $0x800b48,%rax
+  800fb1:	00 00 00 
+  800fb4:	ff d0                	call   *%rax
+  800fb6:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fb9:	48 89 de             	mov    %rbx,%rsi
+  800fbc:	4c 89 f7             	mov    %r14,%rdi
+  800fbf:	48 b8 63 0b 80 00 00 	movabs $0x800b63,%rax
+  800fc6:	00 00 00 
+  800fc9:	ff d0                	call   *%rax
+  800fcb:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fce:	48 39 c3             	cmp    %rax,%rbx
+  800fd1:	74 36                	je     801009 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fd3:	48 89 d8             	mov    %rbx,%rax
+  800fd6:	4c 29 e8             	sub    %r13,%rax
+  800fd9:	49 39 c4             	cmp    %rax,%r12
+  800fdc:	73 31                	jae    80100f <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fde:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fe3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fe7:	4c 89 fe             	mov    %r15,%rsi
+  800fea:	48 b8 7b 0f 80 00 00 	movabs $0x800f7b,%rax
+  800ff1:	00 00 00 
+  800ff4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ff6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ffa:	48 83 c4 08          	add    $0x8,%rsp
+  800ffe:	5b                   	pop    %rbx
+  800fff:	41 5c                	pop    %r12
+  801001:	41 5d                	pop    %r13
+  801003:	41 5e                	pop    %r14
+  801005:	41 5f                	pop    %r15
+  801007:	5d                   	pop    %rbp
+  801008:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801009:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80100d:	eb eb                	jmp    800ffa <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80100f:	48 83 eb 01          	sub    $0x1,%rbx
+  801013:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801017:	48 89 da             	mov    %rbx,%rdx
+  80101a:	4c 89 fe             	mov    %r15,%rsi
+  80101d:	48 b8 7b 0f 80 00 00 	movabs $0x800f7b,%rax
+  801024:	00 00 00 
+  801027:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801029:	49 01 de             	add    %rbx,%r14
+  80102c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801031:	eb c3                	jmp    800ff6 <strlcat+0x69>
+
+0000000000801033 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801033:	48 85 d2             	test   %rdx,%rdx
+  801036:	74 2d                	je     801065 <memcmp+0x32>
+  801038:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80103d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801041:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801046:	44 38 c1             	cmp    %r8b,%cl
+  801049:	75 0f                	jne    80105a <memcmp+0x27>
+    while (n-- > 0) {
+  80104b:	48 83 c0 01          	add    $0x1,%rax
+  80104f:	48 39 c2             	cmp    %rax,%rdx
+  801052:	75 e9                	jne    80103d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801054:	b8 00 00 00 00       	mov    $0x0,%eax
+  801059:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80105a:	0f b6 c1             	movzbl %cl,%eax
+  80105d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801061:	44 29 c0             	sub    %r8d,%eax
+  801064:	c3                   	ret
+    return 0;
+  801065:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80106a:	c3                   	ret
+
+000000000080106b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80106b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80106f:	48 39 c7             	cmp    %rax,%rdi
+  801072:	73 0f                	jae    801083 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801074:	40 38 37             	cmp    %sil,(%rdi)
+  801077:	74 0e                	je     801087 <memfind+0x1c>
+    for (; src < end; src++) {
+  801079:	48 83 c7 01          	add    $0x1,%rdi
+  80107d:	48 39 f8             	cmp    %rdi,%rax
+  801080:	75 f2                	jne    801074 <memfind+0x9>
+  801082:	c3                   	ret
+  801083:	48 89 f8             	mov    %rdi,%rax
+  801086:	c3                   	ret
+  801087:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80108a:	c3                   	ret
+
+000000000080108b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80108b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80108e:	0f b6 37             	movzbl (%rdi),%esi
+  801091:	40 80 fe 20          	cmp    $0x20,%sil
+  801095:	74 06                	je     80109d <strtol+0x12>
+  801097:	40 80 fe 09          	cmp    $0x9,%sil
+  80109b:	75 13                	jne    8010b0 <strtol+0x25>
+  80109d:	48 83 c7 01          	add    $0x1,%rdi
+  8010a1:	0f b6 37             	movzbl (%rdi),%esi
+  8010a4:	40 80 fe 20          	cmp    $0x20,%sil
+  8010a8:	74 f3                	je     80109d <strtol+0x12>
+  8010aa:	40 80 fe 09          	cmp    $0x9,%sil
+  8010ae:	74 ed                	je     80109d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010b0:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010b3:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010b6:	3c 01                	cmp    $0x1,%al
+  8010b8:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010bc:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010c2:	75 0f                	jne    8010d3 <strtol+0x48>
+  8010c4:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010c7:	74 14                	je     8010dd <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010c9:	85 d2                	test   %edx,%edx
+  8010cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010d0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010d3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010d8:	4c 63 ca             	movslq %edx,%r9
+  8010db:	eb 36                	jmp    801113 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010dd:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010e1:	74 0f                	je     8010f2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010e3:	85 d2                	test   %edx,%edx
+  8010e5:	75 ec                	jne    8010d3 <strtol+0x48>
+        s++;
+  8010e7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010eb:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010f0:	eb e1                	jmp    8010d3 <strtol+0x48>
+        s += 2;
+  8010f2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010f6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010fb:	eb d6                	jmp    8010d3 <strtol+0x48>
+            dig -= '0';
+  8010fd:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801100:	44 0f b6 c1          	movzbl %cl,%r8d
+  801104:	41 39 d0             	cmp    %edx,%r8d
+  801107:	7d 21                	jge    80112a <strtol+0x9f>
+        val = val * base + dig;
+  801109:	49 0f af c1          	imul   %r9,%rax
+  80110d:	0f b6 c9             	movzbl %cl,%ecx
+  801110:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801113:	48 83 c7 01          	add    $0x1,%rdi
+  801117:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80111b:	80 f9 39             	cmp    $0x39,%cl
+  80111e:	76 dd                	jbe    8010fd <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801120:	80 f9 7b             	cmp    $0x7b,%cl
+  801123:	77 05                	ja     80112a <strtol+0x9f>
+            dig -= 'a' - 10;
+  801125:	83 e9 57             	sub    $0x57,%ecx
+  801128:	eb d6                	jmp    801100 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80112a:	4d 85 d2             	test   %r10,%r10
+  80112d:	74 03                	je     801132 <strtol+0xa7>
+  80112f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801132:	48 89 c2             	mov    %rax,%rdx
+  801135:	48 f7 da             	neg    %rdx
+  801138:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80113c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801140:	c3                   	ret
+
+0000000000801141 <atoi>:
+int atoi(const char *str) {
+  801141:	55                   	push   %rbp
+  801142:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801145:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114a:	be 00 00 00 00       	mov    $0x0,%esi
+  80114f:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  801156:	00 00 00 
+  801159:	ff d0                	call   *%rax
+}
+  80115b:	5d                   	pop    %rbp
+  80115c:	c3                   	ret
+
+000000000080115d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80115d:	55                   	push   %rbp
+  80115e:	48 89 e5             	mov    %rsp,%rbp
+  801161:	53                   	push   %rbx
+  801162:	48 89 fa             	mov    %rdi,%rdx
+  801165:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801168:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80116d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801172:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801177:	be 00 00 00 00       	mov    $0x0,%esi
+  80117c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801182:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801184:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801188:	c9                   	leave
+  801189:	c3                   	ret
+
+000000000080118a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80118a:	55                   	push   %rbp
+  80118b:	48 89 e5             	mov    %rsp,%rbp
+  80118e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80118f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801194:	ba 00 00 00 00       	mov    $0x0,%edx
+  801199:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80119e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b3:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b9:	c9                   	leave
+  8011ba:	c3                   	ret
+
+00000000008011bb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011bb:	55                   	push   %rbp
+  8011bc:	48 89 e5             	mov    %rsp,%rbp
+  8011bf:	53                   	push   %rbx
+  8011c0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c7:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011db:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011e8:	48 85 c0             	test   %rax,%rax
+  8011eb:	7f 06                	jg     8011f3 <sys_env_destroy+0x38>
+}
+  8011ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f1:	c9                   	leave
+  8011f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011f3:	49 89 c0             	mov    %rax,%r8
+  8011f6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011fb:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801202:	00 00 00 
+  801205:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80120a:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801211:	00 00 00 
+  801214:	b8 00 00 00 00       	mov    $0x0,%eax
+  801219:	49 b9 52 42 80 00 00 	movabs $0x804252,%r9
+  801220:	00 00 00 
+  801223:	41 ff d1             	call   *%r9
+
+0000000000801226 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801226:	55                   	push   %rbp
+  801227:	48 89 e5             	mov    %rsp,%rbp
+  80122a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80122b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801230:	ba 00 00 00 00       	mov    $0x0,%edx
+  801235:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80123a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801244:	be 00 00 00 00       	mov    $0x0,%esi
+  801249:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80124f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801251:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801255:	c9                   	leave
+  801256:	c3                   	ret
+
+0000000000801257 <sys_yield>:
+
+void
+sys_yield(void) {
+  801257:	55                   	push   %rbp
+  801258:	48 89 e5             	mov    %rsp,%rbp
+  80125b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80125c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801261:	ba 00 00 00 00       	mov    $0x0,%edx
+  801266:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80126b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801270:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801275:	be 00 00 00 00       	mov    $0x0,%esi
+  80127a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801280:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801282:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801286:	c9                   	leave
+  801287:	c3                   	ret
+
+0000000000801288 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801288:	55                   	push   %rbp
+  801289:	48 89 e5             	mov    %rsp,%rbp
+  80128c:	53                   	push   %rbx
+  80128d:	48 89 fa             	mov    %rdi,%rdx
+  801290:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801293:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801298:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80129f:	00 00 00 
+  8012a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b8:	c9                   	leave
+  8012b9:	c3                   	ret
+
+00000000008012ba <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012ba:	55                   	push   %rbp
+  8012bb:	48 89 e5             	mov    %rsp,%rbp
+  8012be:	53                   	push   %rbx
+  8012bf:	49 89 f8             	mov    %rdi,%r8
+  8012c2:	48 89 d3             	mov    %rdx,%rbx
+  8012c5:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012cd:	4c 89 c2             	mov    %r8,%rdx
+  8012d0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012de:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e4:	c9                   	leave
+  8012e5:	c3                   	ret
+
+00000000008012e6 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012e6:	55                   	push   %rbp
+  8012e7:	48 89 e5             	mov    %rsp,%rbp
+  8012ea:	53                   	push   %rbx
+  8012eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ef:	89 f8                	mov    %edi,%eax
+  8012f1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012f4:	48 63 f9             	movslq %ecx,%rdi
+  8012f7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fa:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ff:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801302:	be 00 00 00 00       	mov    $0x0,%esi
+  801307:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80130f:	48 85 c0             	test   %rax,%rax
+  801312:	7f 06                	jg     80131a <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801314:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801318:	c9                   	leave
+  801319:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80131a:	49 89 c0             	mov    %rax,%r8
+  80131d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801322:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801329:	00 00 00 
+  80132c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801331:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801338:	00 00 00 
+  80133b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801340:	49 b9 52 42 80 00 00 	movabs $0x804252,%r9
+  801347:	00 00 00 
+  80134a:	41 ff d1             	call   *%r9
+
+000000000080134d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80134d:	55                   	push   %rbp
+  80134e:	48 89 e5             	mov    %rsp,%rbp
+  801351:	53                   	push   %rbx
+  801352:	48 83 ec 08          	sub    $0x8,%rsp
+  801356:	89 f8                	mov    %edi,%eax
+  801358:	49 89 f2             	mov    %rsi,%r10
+  80135b:	48 89 cf             	mov    %rcx,%rdi
+  80135e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801361:	48 63 da             	movslq %edx,%rbx
+  801364:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801367:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80136c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801372:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801374:	48 85 c0             	test   %rax,%rax
+  801377:	7f 06                	jg     80137f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801379:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137d:	c9                   	leave
+  80137e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80137f:	49 89 c0             	mov    %rax,%r8
+  801382:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801387:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80138e:	00 00 00 
+  801391:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801396:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80139d:	00 00 00 
+  8013a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a5:	49 b9 52 42 80 00 00 	movabs $0x804252,%r9
+  8013ac:	00 00 00 
+  8013af:	41 ff d1             	call   *%r9
+
+00000000008013b2 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013b2:	55                   	push   %rbp
+  8013b3:	48 89 e5             	mov    %rsp,%rbp
+  8013b6:	53                   	push   %rbx
+  8013b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8013bb:	49 89 f9             	mov    %rdi,%r9
+  8013be:	89 f0                	mov    %esi,%eax
+  8013c0:	48 89 d3             	mov    %rdx,%rbx
+  8013c3:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8013c6:	49 63 f0             	movslq %r8d,%rsi
+  8013c9:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013cc:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d1:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013dc:	48 85 c0             	test   %rax,%rax
+  8013df:	7f 06                	jg     8013e7 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e5:	c9                   	leave
+  8013e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e7:	49 89 c0             	mov    %rax,%r8
+  8013ea:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013ef:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8013f6:	00 00 00 
+  8013f9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013fe:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801405:	00 00 00 
+  801408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140d:	49 b9 52 42 80 00 00 	movabs $0x804252,%r9
+  801414:	00 00 00 
+  801417:	41 ff d1             	call   *%r9
+
+000000000080141a <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  80141a:	55                   	push   %rbp
+  80141b:	48 89 e5             	mov    %rsp,%rbp
+  80141e:	53                   	push   %rbx
+  80141f:	89 f8                	mov    %edi,%eax
+  801421:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801424:	48 63 f9             	movslq %ecx,%rdi
+  801427:	48 63 da             	movslq %edx,%rbx
+  80142a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80142d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801432:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801435:	be 00 00 00 00       	mov    $0x0,%esi
+  80143a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801440:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  801442:	89 c2                	mov    %eax,%edx
+  801444:	48 85 c0             	test   %rax,%rax
+  801447:	78 0d                	js     801456 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801449:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80144e:	4d 85 c9             	test   %r9,%r9
+  801451:	74 03                	je     801456 <sys_alloc_dma_region+0x3c>
+  801453:	49 89 01             	mov    %rax,(%r9)
+}
+  801456:	89 d0                	mov    %edx,%eax
+  801458:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145c:	c9                   	leave
+  80145d:	c3                   	ret
+
+000000000080145e <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80145e:	55                   	push   %rbp
+  80145f:	48 89 e5             	mov    %rsp,%rbp
+  801462:	53                   	push   %rbx
+  801463:	48 83 ec 08          	sub    $0x8,%rsp
+  801467:	48 89 f1             	mov    %rsi,%rcx
+  80146a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80146d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801470:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801475:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147a:	be 00 00 00 00       	mov    $0x0,%esi
+  80147f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801485:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801487:	48 85 c0             	test   %rax,%rax
+  80148a:	7f 06                	jg     801492 <sys_set_cache_region+0x34>
+}
+  80148c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801490:	c9                   	leave
+  801491:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801492:	49 89 c0             	mov    %rax,%r8
+  801495:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80149a:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8014a1:	00 00 00 
+  8014a4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014a9:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8014b0:	00 00 00 
+  8014b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b8:	49 b9 52 42 80 00 00 	movabs $0x804252,%r9
+  8014bf:	00 00 00 
+  8014c2:	41 ff d1             	call   *%r9
+
+00000000008014c5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+  8014c9:	53                   	push   %rbx
+  8014ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ce:	48 89 f1             	mov    %rsi,%rcx
+  8014d1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014d4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d7:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ee:	48 85 c0             	test   %rax,%rax
+  8014f1:	7f 06                	jg     8014f9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f7:	c9                   	leave
+  8014f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f9:	49 89 c0             	mov    %rax,%r8
+  8014fc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801501:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801508:	00 00 00 
+  80150b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801510:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801517:	00 00 00 
+  80151a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151f:	49 b9 52 42 80 00 00 	movabs $0x804252,%r9
+  801526:	00 00 00 
+  801529:	41 ff d1             	call   *%r9
+
+000000000080152c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80152c:	55                   	push   %rbp
+  80152d:	48 89 e5             	mov    %rsp,%rbp
+  801530:	53                   	push   %rbx
+  801531:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801535:	48 63 ce             	movslq %esi,%rcx
+  801538:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80153b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801540:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801545:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154a:	be 00 00 00 00       	mov    $0x0,%esi
+  80154f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801555:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801557:	48 85 c0             	test   %rax,%rax
+  80155a:	7f 06                	jg     801562 <sys_env_set_status+0x36>
+}
+  80155c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801560:	c9                   	leave
+  801561:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801562:	49 89 c0             	mov    %rax,%r8
+  801565:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80156a:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801571:	00 00 00 
+  801574:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801579:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801580:	00 00 00 
+  801583:	b8 00 00 00 00       	mov    $0x0,%eax
+  801588:	49 b9 52 42 80 00 00 	movabs $0x804252,%r9
+  80158f:	00 00 00 
+  801592:	41 ff d1             	call   *%r9
+
+0000000000801595 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801595:	55                   	push   %rbp
+  801596:	48 89 e5             	mov    %rsp,%rbp
+  801599:	53                   	push   %rbx
+  80159a:	48 83 ec 08          	sub    $0x8,%rsp
+  80159e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015a1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a4:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c0:	48 85 c0             	test   %rax,%rax
+  8015c3:	7f 06                	jg     8015cb <sys_env_set_trapframe+0x36>
+}
+  8015c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c9:	c9                   	leave
+  8015ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015cb:	49 89 c0             	mov    %rax,%r8
+  8015ce:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8015d3:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8015da:	00 00 00 
+  8015dd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015e2:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8015e9:	00 00 00 
+  8015ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f1:	49 b9 52 42 80 00 00 	movabs $0x804252,%r9
+  8015f8:	00 00 00 
+  8015fb:	41 ff d1             	call   *%r9
+
+00000000008015fe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015fe:	55                   	push   %rbp
+  8015ff:	48 89 e5             	mov    %rsp,%rbp
+  801602:	53                   	push   %rbx
+  801603:	48 83 ec 08          	sub    $0x8,%rsp
+  801607:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80160a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80160d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801612:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801617:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80161c:	be 00 00 00 00       	mov    $0x0,%esi
+  801621:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801627:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801629:	48 85 c0             	test   %rax,%rax
+  80162c:	7f 06                	jg     801634 <sys_env_set_pgfault_upcall+0x36>
+}
+  80162e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801632:	c9                   	leave
+  801633:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801634:	49 89 c0             	mov    %rax,%r8
+  801637:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80163c:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801643:	00 00 00 
+  801646:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80164b:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801652:	00 00 00 
+  801655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165a:	49 b9 52 42 80 00 00 	movabs $0x804252,%r9
+  801661:	00 00 00 
+  801664:	41 ff d1             	call   *%r9
+
+0000000000801667 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801667:	55                   	push   %rbp
+  801668:	48 89 e5             	mov    %rsp,%rbp
+  80166b:	53                   	push   %rbx
+  80166c:	89 f8                	mov    %edi,%eax
+  80166e:	49 89 f1             	mov    %rsi,%r9
+  801671:	48 89 d3             	mov    %rdx,%rbx
+  801674:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801677:	49 63 f0             	movslq %r8d,%rsi
+  80167a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80167d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801682:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801685:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80168b:	cd 30                	int    $0x30
+}
+  80168d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801691:	c9                   	leave
+  801692:	c3                   	ret
+
+0000000000801693 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801693:	55                   	push   %rbp
+  801694:	48 89 e5             	mov    %rsp,%rbp
+  801697:	53                   	push   %rbx
+  801698:	48 83 ec 08          	sub    $0x8,%rsp
+  80169c:	48 89 fa             	mov    %rdi,%rdx
+  80169f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a2:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016be:	48 85 c0             	test   %rax,%rax
+  8016c1:	7f 06                	jg     8016c9 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c7:	c9                   	leave
+  8016c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c9:	49 89 c0             	mov    %rax,%r8
+  8016cc:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8016d1:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8016d8:	00 00 00 
+  8016db:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016e0:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8016e7:	00 00 00 
+  8016ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ef:	49 b9 52 42 80 00 00 	movabs $0x804252,%r9
+  8016f6:	00 00 00 
+  8016f9:	41 ff d1             	call   *%r9
+
+00000000008016fc <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8016fc:	55                   	push   %rbp
+  8016fd:	48 89 e5             	mov    %rsp,%rbp
+  801700:	53                   	push   %rbx
+  801701:	48 89 fa             	mov    %rdi,%rdx
+  801704:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801707:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80170c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801711:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801716:	be 00 00 00 00       	mov    $0x0,%esi
+  80171b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801721:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801723:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801727:	c9                   	leave
+  801728:	c3                   	ret
+
+0000000000801729 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801729:	55                   	push   %rbp
+  80172a:	48 89 e5             	mov    %rsp,%rbp
+  80172d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80172e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801733:	ba 00 00 00 00       	mov    $0x0,%edx
+  801738:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80173d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801742:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801747:	be 00 00 00 00       	mov    $0x0,%esi
+  80174c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801752:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801754:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801758:	c9                   	leave
+  801759:	c3                   	ret
+
+000000000080175a <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80175a:	48 85 ff             	test   %rdi,%rdi
+  80175d:	0f 84 b6 01 00 00    	je     801919 <malloc+0x1bf>
+malloc(size_t size) {
+  801763:	55                   	push   %rbp
+  801764:	48 89 e5             	mov    %rsp,%rbp
+  801767:	41 56                	push   %r14
+  801769:	41 55                	push   %r13
+  80176b:	41 54                	push   %r12
+  80176d:	53                   	push   %rbx
+  80176e:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801771:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801778:	00 00 00 
+  80177b:	4c 8b 20             	mov    (%rax),%r12
+  80177e:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801785:	0f 87 94 01 00 00    	ja     80191f <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  80178b:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801792:	00 00 00 
+  801795:	48 85 c0             	test   %rax,%rax
+  801798:	74 6b                	je     801805 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80179a:	4d 85 e4             	test   %r12,%r12
+  80179d:	74 66                	je     801805 <malloc+0xab>
+  80179f:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  8017a6:	00 00 00 
+  8017a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017ae:	eb 0d                	jmp    8017bd <malloc+0x63>
+  8017b0:	48 83 c1 01          	add    $0x1,%rcx
+  8017b4:	48 83 c2 18          	add    $0x18,%rdx
+  8017b8:	49 39 cc             	cmp    %rcx,%r12
+  8017bb:	74 48                	je     801805 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  8017bd:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  8017c2:	74 ec                	je     8017b0 <malloc+0x56>
+  8017c4:	48 39 1a             	cmp    %rbx,(%rdx)
+  8017c7:	72 e7                	jb     8017b0 <malloc+0x56>
+                real_freep_size--;
+  8017c9:	48 83 e8 01          	sub    $0x1,%rax
+  8017cd:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  8017d4:	00 00 00 
+                freep[i].is_free = false;
+  8017d7:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8017de:	00 00 00 
+  8017e1:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8017e5:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8017e9:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8017ed:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8017f4:	00 
+                freep[i].size = size;
+  8017f5:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8017f9:	48 01 c8             	add    %rcx,%rax
+  8017fc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801800:	e9 0b 01 00 00       	jmp    801910 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801805:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  80180c:	00 00 00 
+  80180f:	48 01 d8             	add    %rbx,%rax
+  801812:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801818:	76 7c                	jbe    801896 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  80181a:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801821:	00 00 00 
+  801824:	4c 8b 30             	mov    (%rax),%r14
+  801827:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  80182e:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801831:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801838:	00 00 00 
+  80183b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801842:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801849:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80184f:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801853:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  80185a:	00 00 00 
+  80185d:	ff d0                	call   *%rax
+  80185f:	89 c7                	mov    %eax,%edi
+  801861:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801868:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80186f:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801876:	00 00 00 
+  801879:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80187d:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801882:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  801889:	00 00 00 
+  80188c:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80188e:	85 c0                	test   %eax,%eax
+  801890:	0f 88 90 00 00 00    	js     801926 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801896:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  80189d:	00 00 00 
+  8018a0:	48 8b 31             	mov    (%rcx),%rsi
+  8018a3:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  8018aa:	00 00 00 
+  8018ad:	4c 8b 07             	mov    (%rdi),%r8
+  8018b0:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  8018b4:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  8018bb:	00 00 00 
+  8018be:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  8018c2:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  8018c6:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8018cd:	00 00 00 
+  8018d0:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  8018d4:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  8018d7:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8018db:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8018e2:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8018e3:	48 89 d8             	mov    %rbx,%rax
+  8018e6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8018eb:	4c 01 c0             	add    %r8,%rax
+  8018ee:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8018f1:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8018f8:	48 01 f3             	add    %rsi,%rbx
+  8018fb:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8018fe:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801903:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  80190a:	00 00 00 
+  80190d:	48 89 d0             	mov    %rdx,%rax
+}
+  801910:	5b                   	pop    %rbx
+  801911:	41 5c                	pop    %r12
+  801913:	41 5d                	pop    %r13
+  801915:	41 5e                	pop    %r14
+  801917:	5d                   	pop    %rbp
+  801918:	c3                   	ret
+        return NULL;
+  801919:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80191e:	c3                   	ret
+        return NULL;
+  80191f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801924:	eb ea                	jmp    801910 <malloc+0x1b6>
+            return NULL;
+  801926:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192b:	eb e3                	jmp    801910 <malloc+0x1b6>
+
+000000000080192d <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  80192d:	55                   	push   %rbp
+  80192e:	48 89 e5             	mov    %rsp,%rbp
+  801931:	53                   	push   %rbx
+  801932:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801936:	48 89 fb             	mov    %rdi,%rbx
+  801939:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  80193d:	48 89 df             	mov    %rbx,%rdi
+  801940:	48 b8 5a 17 80 00 00 	movabs $0x80175a,%rax
+  801947:	00 00 00 
+  80194a:	ff d0                	call   *%rax
+  80194c:	48 89 c7             	mov    %rax,%rdi
+  80194f:	48 89 da             	mov    %rbx,%rdx
+  801952:	be 00 00 00 00       	mov    $0x0,%esi
+  801957:	48 b8 66 0e 80 00 00 	movabs $0x800e66,%rax
+  80195e:	00 00 00 
+  801961:	ff d0                	call   *%rax
+}
+  801963:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801967:	c9                   	leave
+  801968:	c3                   	ret
+
+0000000000801969 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801969:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801970:	00 00 00 
+  801973:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80197a:	00 00 00 
+  80197d:	48 3b 02             	cmp    (%rdx),%rax
+  801980:	74 4d                	je     8019cf <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801982:	48 85 c0             	test   %rax,%rax
+  801985:	74 4d                	je     8019d4 <get_allocsize+0x6b>
+  801987:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80198e:	00 00 00 
+  801991:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801996:	48 3b 39             	cmp    (%rcx),%rdi
+  801999:	74 13                	je     8019ae <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  80199b:	48 83 c2 01          	add    $0x1,%rdx
+  80199f:	48 83 c1 18          	add    $0x18,%rcx
+  8019a3:	48 39 d0             	cmp    %rdx,%rax
+  8019a6:	75 ee                	jne    801996 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  8019a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ad:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  8019ae:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  8019b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b7:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  8019be:	00 00 00 
+  8019c1:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  8019c7:	75 0b                	jne    8019d4 <get_allocsize+0x6b>
+  8019c9:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  8019ce:	c3                   	ret
+        return 0;
+  8019cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019d4:	c3                   	ret
+
+00000000008019d5 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  8019d5:	48 85 ff             	test   %rdi,%rdi
+  8019d8:	0f 84 01 01 00 00    	je     801adf <free+0x10a>
+free(void *ptr) {
+  8019de:	55                   	push   %rbp
+  8019df:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8019e2:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8019e9:	00 00 00 
+  8019ec:	48 8b 30             	mov    (%rax),%rsi
+  8019ef:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8019f6:	00 00 00 
+  8019f9:	48 39 c6             	cmp    %rax,%rsi
+  8019fc:	74 50                	je     801a4e <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8019fe:	48 85 f6             	test   %rsi,%rsi
+  801a01:	74 21                	je     801a24 <free+0x4f>
+  801a03:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801a0a:	00 00 00 
+  801a0d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801a12:	48 3b 39             	cmp    (%rcx),%rdi
+  801a15:	74 61                	je     801a78 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801a17:	48 83 c2 01          	add    $0x1,%rdx
+  801a1b:	48 83 c1 18          	add    $0x18,%rcx
+  801a1f:	48 39 d6             	cmp    %rdx,%rsi
+  801a22:	75 ee                	jne    801a12 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801a24:	48 ba b0 55 80 00 00 	movabs $0x8055b0,%rdx
+  801a2b:	00 00 00 
+  801a2e:	be 12 01 00 00       	mov    $0x112,%esi
+  801a33:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801a3a:	00 00 00 
+  801a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a42:	48 b9 52 42 80 00 00 	movabs $0x804252,%rcx
+  801a49:	00 00 00 
+  801a4c:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801a4e:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801a55:	00 00 00 
+  801a58:	be 06 01 00 00       	mov    $0x106,%esi
+  801a5d:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801a64:	00 00 00 
+  801a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6c:	48 b9 52 42 80 00 00 	movabs $0x804252,%rcx
+  801a73:	00 00 00 
+  801a76:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801a78:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a7c:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a83:	00 00 00 
+  801a86:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a8c:	75 27                	jne    801ab5 <free+0xe0>
+            freep[i].is_free = true;
+  801a8e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a92:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801a99:	00 00 00 
+  801a9c:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801aa3:	00 00 
+            real_freep_size++;
+  801aa5:	48 83 c0 01          	add    $0x1,%rax
+  801aa9:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801ab0:	00 00 00 
+}
+  801ab3:	5d                   	pop    %rbp
+  801ab4:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801ab5:	48 ba 88 55 80 00 00 	movabs $0x805588,%rdx
+  801abc:	00 00 00 
+  801abf:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801ac4:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801acb:	00 00 00 
+  801ace:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad3:	48 b9 52 42 80 00 00 	movabs $0x804252,%rcx
+  801ada:	00 00 00 
+  801add:	ff d1                	call   *%rcx
+  801adf:	c3                   	ret
+
+0000000000801ae0 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801ae0:	55                   	push   %rbp
+  801ae1:	48 89 e5             	mov    %rsp,%rbp
+  801ae4:	41 55                	push   %r13
+  801ae6:	41 54                	push   %r12
+  801ae8:	53                   	push   %rbx
+  801ae9:	48 83 ec 08          	sub    $0x8,%rsp
+  801aed:	48 89 fb             	mov    %rdi,%rbx
+  801af0:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801af3:	48 b8 69 19 80 00 00 	movabs $0x801969,%rax
+  801afa:	00 00 00 
+  801afd:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801aff:	49 39 c5             	cmp    %rax,%r13
+  801b02:	73 0e                	jae    801b12 <realloc+0x32>
+}
+  801b04:	48 89 d8             	mov    %rbx,%rax
+  801b07:	48 83 c4 08          	add    $0x8,%rsp
+  801b0b:	5b                   	pop    %rbx
+  801b0c:	41 5c                	pop    %r12
+  801b0e:	41 5d                	pop    %r13
+  801b10:	5d                   	pop    %rbp
+  801b11:	c3                   	ret
+  801b12:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801b15:	4c 89 ef             	mov    %r13,%rdi
+  801b18:	48 b8 5a 17 80 00 00 	movabs $0x80175a,%rax
+  801b1f:	00 00 00 
+  801b22:	ff d0                	call   *%rax
+  801b24:	48 89 c7             	mov    %rax,%rdi
+  801b27:	4c 89 e2             	mov    %r12,%rdx
+  801b2a:	48 89 de             	mov    %rbx,%rsi
+  801b2d:	48 b8 7b 0f 80 00 00 	movabs $0x800f7b,%rax
+  801b34:	00 00 00 
+  801b37:	ff d0                	call   *%rax
+  801b39:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801b3c:	48 89 df             	mov    %rbx,%rdi
+  801b3f:	48 b8 d5 19 80 00 00 	movabs $0x8019d5,%rax
+  801b46:	00 00 00 
+  801b49:	ff d0                	call   *%rax
+    return newptr;
+  801b4b:	4c 89 e3             	mov    %r12,%rbx
+  801b4e:	eb b4                	jmp    801b04 <realloc+0x24>
+
+0000000000801b50 <strdup>:
+
+char*
+strdup (const char *src) {
+  801b50:	55                   	push   %rbp
+  801b51:	48 89 e5             	mov    %rsp,%rbp
+  801b54:	41 54                	push   %r12
+  801b56:	53                   	push   %rbx
+  801b57:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801b5a:	48 b8 48 0b 80 00 00 	movabs $0x800b48,%rax
+  801b61:	00 00 00 
+  801b64:	ff d0                	call   *%rax
+  801b66:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801b6a:	4c 89 e7             	mov    %r12,%rdi
+  801b6d:	48 b8 5a 17 80 00 00 	movabs $0x80175a,%rax
+  801b74:	00 00 00 
+  801b77:	ff d0                	call   *%rax
+  801b79:	48 89 c7             	mov    %rax,%rdi
+  801b7c:	4c 89 e2             	mov    %r12,%rdx
+  801b7f:	48 89 de             	mov    %rbx,%rsi
+  801b82:	48 b8 7b 0f 80 00 00 	movabs $0x800f7b,%rax
+  801b89:	00 00 00 
+  801b8c:	ff d0                	call   *%rax
+}
+  801b8e:	5b                   	pop    %rbx
+  801b8f:	41 5c                	pop    %r12
+  801b91:	5d                   	pop    %rbp
+  801b92:	c3                   	ret
+
+0000000000801b93 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801b93:	55                   	push   %rbp
+  801b94:	48 89 e5             	mov    %rsp,%rbp
+  801b97:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b98:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ba7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bb1:	be 00 00 00 00       	mov    $0x0,%esi
+  801bb6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bbc:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801bbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc2:	c9                   	leave
+  801bc3:	c3                   	ret
+
+0000000000801bc4 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801bc4:	55                   	push   %rbp
+  801bc5:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801bc8:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801bcf:	00 00 00 
+  801bd2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801bd6:	74 26                	je     801bfe <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801bd8:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801bda:	48 c1 e2 20          	shl    $0x20,%rdx
+  801bde:	89 c0                	mov    %eax,%eax
+  801be0:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801be3:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801bea:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801bf1:	00 00 00 
+  801bf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf9:	48 f7 31             	divq   (%rcx)
+}
+  801bfc:	5d                   	pop    %rbp
+  801bfd:	c3                   	ret
+        freq = get_cpufreq();
+  801bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c03:	48 ba 93 1b 80 00 00 	movabs $0x801b93,%rdx
+  801c0a:	00 00 00 
+  801c0d:	ff d2                	call   *%rdx
+  801c0f:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c16:	00 00 00 
+  801c19:	eb bd                	jmp    801bd8 <get_ticks+0x14>
+
+0000000000801c1b <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801c1b:	55                   	push   %rbp
+  801c1c:	48 89 e5             	mov    %rsp,%rbp
+  801c1f:	53                   	push   %rbx
+  801c20:	48 83 ec 08          	sub    $0x8,%rsp
+  801c24:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801c27:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c2e:	00 00 00 
+  801c31:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c35:	74 50                	je     801c87 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801c37:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c39:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c3d:	89 c0                	mov    %eax,%eax
+  801c3f:	48 89 d6             	mov    %rdx,%rsi
+  801c42:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801c45:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c4c:	00 00 00 
+  801c4f:	48 0f af 18          	imul   (%rax),%rbx
+  801c53:	48 c1 eb 03          	shr    $0x3,%rbx
+  801c57:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801c5e:	9b c4 20 
+  801c61:	48 89 d8             	mov    %rbx,%rax
+  801c64:	48 f7 e2             	mul    %rdx
+  801c67:	48 89 d1             	mov    %rdx,%rcx
+  801c6a:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801c6e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c70:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c74:	89 c0                	mov    %eax,%eax
+  801c76:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801c79:	48 29 f2             	sub    %rsi,%rdx
+  801c7c:	48 39 ca             	cmp    %rcx,%rdx
+  801c7f:	72 ed                	jb     801c6e <sleep+0x53>
+}
+  801c81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c85:	c9                   	leave
+  801c86:	c3                   	ret
+        freq = get_cpufreq();
+  801c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8c:	48 ba 93 1b 80 00 00 	movabs $0x801b93,%rdx
+  801c93:	00 00 00 
+  801c96:	ff d2                	call   *%rdx
+  801c98:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c9f:	00 00 00 
+  801ca2:	eb 93                	jmp    801c37 <sleep+0x1c>
+
+0000000000801ca4 <poll_kbd>:
+
+int poll_kbd() {
+  801ca4:	55                   	push   %rbp
+  801ca5:	48 89 e5             	mov    %rsp,%rbp
+  801ca8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ca9:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cae:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ccd:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ccf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cd3:	c9                   	leave
+  801cd4:	c3                   	ret
+
+0000000000801cd5 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801cd5:	55                   	push   %rbp
+  801cd6:	48 89 e5             	mov    %rsp,%rbp
+  801cd9:	53                   	push   %rbx
+  801cda:	49 89 fa             	mov    %rdi,%r10
+  801cdd:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801cdf:	44 89 c6             	mov    %r8d,%esi
+  801ce2:	89 cf                	mov    %ecx,%edi
+  801ce4:	89 d3                	mov    %edx,%ebx
+  801ce6:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ce8:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ced:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cf0:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801cf4:	cd 30                	int    $0x30
+  801cf6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cfa:	c9                   	leave
+  801cfb:	c3                   	ret
+
+0000000000801cfc <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  801cfc:	55                   	push   %rbp
+  801cfd:	48 89 e5             	mov    %rsp,%rbp
+  801d00:	41 56                	push   %r14
+  801d02:	41 55                	push   %r13
+  801d04:	41 54                	push   %r12
+  801d06:	53                   	push   %rbx
+  801d07:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801d0a:	48 b8 a8 70 98 00 00 	movabs $0x9870a8,%rax
+  801d11:	00 00 00 
+  801d14:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d18:	74 27                	je     801d41 <_handle_vectored_pagefault+0x45>
+  801d1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  801d1f:	49 bd 60 70 98 00 00 	movabs $0x987060,%r13
+  801d26:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801d29:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  801d2c:	4c 89 e7             	mov    %r12,%rdi
+  801d2f:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  801d34:	84 c0                	test   %al,%al
+  801d36:	75 45                	jne    801d7d <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801d38:	48 83 c3 01          	add    $0x1,%rbx
+  801d3c:	49 3b 1e             	cmp    (%r14),%rbx
+  801d3f:	72 eb                	jb     801d2c <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  801d41:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  801d48:	00 
+  801d49:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  801d4e:	4d 8b 04 24          	mov    (%r12),%r8
+  801d52:	48 ba e8 55 80 00 00 	movabs $0x8055e8,%rdx
+  801d59:	00 00 00 
+  801d5c:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801d61:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801d68:	00 00 00 
+  801d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d70:	49 ba 52 42 80 00 00 	movabs $0x804252,%r10
+  801d77:	00 00 00 
+  801d7a:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801d7d:	5b                   	pop    %rbx
+  801d7e:	41 5c                	pop    %r12
+  801d80:	41 5d                	pop    %r13
+  801d82:	41 5e                	pop    %r14
+  801d84:	5d                   	pop    %rbp
+  801d85:	c3                   	ret
+
+0000000000801d86 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  801d86:	55                   	push   %rbp
+  801d87:	48 89 e5             	mov    %rsp,%rbp
+  801d8a:	41 54                	push   %r12
+  801d8c:	53                   	push   %rbx
+  801d8d:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801d90:	48 b8 a0 70 98 00 00 	movabs $0x9870a0,%rax
+  801d97:	00 00 00 
+  801d9a:	80 38 00             	cmpb   $0x0,(%rax)
+  801d9d:	74 64                	je     801e03 <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801d9f:	48 b8 a8 70 98 00 00 	movabs $0x9870a8,%rax
+  801da6:	00 00 00 
+  801da9:	48 8b 10             	mov    (%rax),%rdx
+  801dac:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  801db1:	48 b9 60 70 98 00 00 	movabs $0x987060,%rcx
+  801db8:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801dbb:	48 85 d2             	test   %rdx,%rdx
+  801dbe:	74 1d                	je     801ddd <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801dc0:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  801dc4:	0f 84 ee 00 00 00    	je     801eb8 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801dca:	48 83 c0 01          	add    $0x1,%rax
+  801dce:	48 39 d0             	cmp    %rdx,%rax
+  801dd1:	75 ed                	jne    801dc0 <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  801dd3:	48 83 fa 08          	cmp    $0x8,%rdx
+  801dd7:	0f 84 a9 00 00 00    	je     801e86 <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801ddd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801de1:	48 a3 a8 70 98 00 00 	movabs %rax,0x9870a8
+  801de8:	00 00 00 
+  801deb:	48 b8 60 70 98 00 00 	movabs $0x987060,%rax
+  801df2:	00 00 00 
+  801df5:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  801df9:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  801dfe:	5b                   	pop    %rbx
+  801dff:	41 5c                	pop    %r12
+  801e01:	5d                   	pop    %rbp
+  801e02:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  801e03:	49 bc 26 12 80 00 00 	movabs $0x801226,%r12
+  801e0a:	00 00 00 
+  801e0d:	41 ff d4             	call   *%r12
+  801e10:	89 c7                	mov    %eax,%edi
+  801e12:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801e17:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e1c:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  801e23:	00 00 00 
+  801e26:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  801e2d:	00 00 00 
+  801e30:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801e32:	48 ba a8 70 98 00 00 	movabs $0x9870a8,%rdx
+  801e39:	00 00 00 
+  801e3c:	48 8b 02             	mov    (%rdx),%rax
+  801e3f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801e43:	48 89 0a             	mov    %rcx,(%rdx)
+  801e46:	48 ba 60 70 98 00 00 	movabs $0x987060,%rdx
+  801e4d:	00 00 00 
+  801e50:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  801e54:	48 b8 a0 70 98 00 00 	movabs $0x9870a0,%rax
+  801e5b:	00 00 00 
+  801e5e:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  801e61:	41 ff d4             	call   *%r12
+  801e64:	89 c7                	mov    %eax,%edi
+  801e66:	48 be 7e 1f 80 00 00 	movabs $0x801f7e,%rsi
+  801e6d:	00 00 00 
+  801e70:	48 b8 fe 15 80 00 00 	movabs $0x8015fe,%rax
+  801e77:	00 00 00 
+  801e7a:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	0f 89 7a ff ff ff    	jns    801dfe <add_pgfault_handler+0x78>
+  801e84:	eb 05                	jmp    801e8b <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  801e86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801e8b:	89 c1                	mov    %eax,%ecx
+  801e8d:	48 ba 26 56 80 00 00 	movabs $0x805626,%rdx
+  801e94:	00 00 00 
+  801e97:	be 3b 00 00 00       	mov    $0x3b,%esi
+  801e9c:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801ea3:	00 00 00 
+  801ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eab:	49 b8 52 42 80 00 00 	movabs $0x804252,%r8
+  801eb2:	00 00 00 
+  801eb5:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  801eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebd:	e9 3c ff ff ff       	jmp    801dfe <add_pgfault_handler+0x78>
+
+0000000000801ec2 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801ec2:	55                   	push   %rbp
+  801ec3:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  801ec6:	48 b8 a0 70 98 00 00 	movabs $0x9870a0,%rax
+  801ecd:	00 00 00 
+  801ed0:	80 38 00             	cmpb   $0x0,(%rax)
+  801ed3:	74 33                	je     801f08 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801ed5:	48 a1 a8 70 98 00 00 	movabs 0x9870a8,%rax
+  801edc:	00 00 00 
+  801edf:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  801ee4:	48 ba 60 70 98 00 00 	movabs $0x987060,%rdx
+  801eeb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801eee:	48 85 c0             	test   %rax,%rax
+  801ef1:	0f 84 85 00 00 00    	je     801f7c <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  801ef7:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  801efb:	74 40                	je     801f3d <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801efd:	48 83 c1 01          	add    $0x1,%rcx
+  801f01:	48 39 c1             	cmp    %rax,%rcx
+  801f04:	75 f1                	jne    801ef7 <remove_pgfault_handler+0x35>
+  801f06:	eb 74                	jmp    801f7c <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  801f08:	48 b9 3e 56 80 00 00 	movabs $0x80563e,%rcx
+  801f0f:	00 00 00 
+  801f12:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  801f19:	00 00 00 
+  801f1c:	be 41 00 00 00       	mov    $0x41,%esi
+  801f21:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801f28:	00 00 00 
+  801f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f30:	49 b8 52 42 80 00 00 	movabs $0x804252,%r8
+  801f37:	00 00 00 
+  801f3a:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801f3d:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  801f44:	00 
+  801f45:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f49:	48 29 ca             	sub    %rcx,%rdx
+  801f4c:	48 b8 60 70 98 00 00 	movabs $0x987060,%rax
+  801f53:	00 00 00 
+  801f56:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  801f5a:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  801f5f:	48 89 ce             	mov    %rcx,%rsi
+  801f62:	48 b8 14 0f 80 00 00 	movabs $0x800f14,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801f6e:	48 b8 a8 70 98 00 00 	movabs $0x9870a8,%rax
+  801f75:	00 00 00 
+  801f78:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  801f7c:	5d                   	pop    %rbp
+  801f7d:	c3                   	ret
+
+0000000000801f7e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  801f7e:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  801f81:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  801f88:	00 00 00 
+    call *%rax
+  801f8b:	ff d0                	call   *%rax
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    popq %r15
+  801f8d:	41 5f                	pop    %r15
+    popq %r15
+  801f8f:	41 5f                	pop    %r15
+    popq %r15
+  801f91:	41 5f                	pop    %r15
+    popq %r14
+  801f93:	41 5e                	pop    %r14
+    popq %r13
+  801f95:	41 5d                	pop    %r13
+    popq %r12
+  801f97:	41 5c                	pop    %r12
+    popq %r11
+  801f99:	41 5b                	pop    %r11
+    popq %r10
+  801f9b:	41 5a                	pop    %r10
+    popq %r9
+  801f9d:	41 59                	pop    %r9
+    popq %r8
+  801f9f:	41 58                	pop    %r8
+    popq %rsi
+  801fa1:	5e                   	pop    %rsi
+    popq %rdi
+  801fa2:	5f                   	pop    %rdi
+    popq %rbp
+  801fa3:	5d                   	pop    %rbp
+    popq %rdx
+  801fa4:	5a                   	pop    %rdx
+    popq %rcx
+  801fa5:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  801fa6:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  801fab:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  801fb0:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  801fb4:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  801fb7:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  801fbc:	5b                   	pop    %rbx
+    popq %rax
+  801fbd:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    pushq 8(%rsp)
+  801fbe:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  801fc2:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    movq 16(%rsp), %rsp
+  801fc3:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  801fc8:	c3                   	ret
+
+0000000000801fc9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801fc9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801fd0:	ff ff ff 
+  801fd3:	48 01 f8             	add    %rdi,%rax
+  801fd6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801fda:	c3                   	ret
+
+0000000000801fdb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801fdb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801fe2:	ff ff ff 
+  801fe5:	48 01 f8             	add    %rdi,%rax
+  801fe8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801fec:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801ff2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801ff6:	c3                   	ret
+
+0000000000801ff7 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ff7:	55                   	push   %rbp
+  801ff8:	48 89 e5             	mov    %rsp,%rbp
+  801ffb:	41 57                	push   %r15
+  801ffd:	41 56                	push   %r14
+  801fff:	41 55                	push   %r13
+  802001:	41 54                	push   %r12
+  802003:	53                   	push   %rbx
+  802004:	48 83 ec 08          	sub    $0x8,%rsp
+  802008:	49 89 ff             	mov    %rdi,%r15
+  80200b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802010:	49 bd ab 3e 80 00 00 	movabs $0x803eab,%r13
+  802017:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80201a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802020:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802023:	48 89 df             	mov    %rbx,%rdi
+  802026:	41 ff d5             	call   *%r13
+  802029:	83 e0 04             	and    $0x4,%eax
+  80202c:	74 17                	je     802045 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80202e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802035:	4c 39 f3             	cmp    %r14,%rbx
+  802038:	75 e6                	jne    802020 <fd_alloc+0x29>
+  80203a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802040:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802045:	4d 89 27             	mov    %r12,(%r15)
+}
+  802048:	48 83 c4 08          	add    $0x8,%rsp
+  80204c:	5b                   	pop    %rbx
+  80204d:	41 5c                	pop    %r12
+  80204f:	41 5d                	pop    %r13
+  802051:	41 5e                	pop    %r14
+  802053:	41 5f                	pop    %r15
+  802055:	5d                   	pop    %rbp
+  802056:	c3                   	ret
+
+0000000000802057 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802057:	83 ff 1f             	cmp    $0x1f,%edi
+  80205a:	77 39                	ja     802095 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80205c:	55                   	push   %rbp
+  80205d:	48 89 e5             	mov    %rsp,%rbp
+  802060:	41 54                	push   %r12
+  802062:	53                   	push   %rbx
+  802063:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802066:	48 63 df             	movslq %edi,%rbx
+  802069:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802070:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802074:	48 89 df             	mov    %rbx,%rdi
+  802077:	48 b8 ab 3e 80 00 00 	movabs $0x803eab,%rax
+  80207e:	00 00 00 
+  802081:	ff d0                	call   *%rax
+  802083:	a8 04                	test   $0x4,%al
+  802085:	74 14                	je     80209b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802087:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80208b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802090:	5b                   	pop    %rbx
+  802091:	41 5c                	pop    %r12
+  802093:	5d                   	pop    %rbp
+  802094:	c3                   	ret
+        return -E_INVAL;
+  802095:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80209a:	c3                   	ret
+        return -E_INVAL;
+  80209b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020a0:	eb ee                	jmp    802090 <fd_lookup+0x39>
+
+00000000008020a2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8020a2:	55                   	push   %rbp
+  8020a3:	48 89 e5             	mov    %rsp,%rbp
+  8020a6:	41 54                	push   %r12
+  8020a8:	53                   	push   %rbx
+  8020a9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8020ac:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  8020b3:	00 00 00 
+  8020b6:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8020bd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8020c0:	39 3b                	cmp    %edi,(%rbx)
+  8020c2:	74 47                	je     80210b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8020c4:	48 83 c0 08          	add    $0x8,%rax
+  8020c8:	48 8b 18             	mov    (%rax),%rbx
+  8020cb:	48 85 db             	test   %rbx,%rbx
+  8020ce:	75 f0                	jne    8020c0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8020d0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020d7:	00 00 00 
+  8020da:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020e0:	89 fa                	mov    %edi,%edx
+  8020e2:	48 bf 70 56 80 00 00 	movabs $0x805670,%rdi
+  8020e9:	00 00 00 
+  8020ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f1:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  8020f8:	00 00 00 
+  8020fb:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8020fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802102:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802106:	5b                   	pop    %rbx
+  802107:	41 5c                	pop    %r12
+  802109:	5d                   	pop    %rbp
+  80210a:	c3                   	ret
+            return 0;
+  80210b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802110:	eb f0                	jmp    802102 <dev_lookup+0x60>
+
+0000000000802112 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802112:	55                   	push   %rbp
+  802113:	48 89 e5             	mov    %rsp,%rbp
+  802116:	41 55                	push   %r13
+  802118:	41 54                	push   %r12
+  80211a:	53                   	push   %rbx
+  80211b:	48 83 ec 18          	sub    $0x18,%rsp
+  80211f:	48 89 fb             	mov    %rdi,%rbx
+  802122:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802125:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80212c:	ff ff ff 
+  80212f:	48 01 df             	add    %rbx,%rdi
+  802132:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802136:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80213a:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  802141:	00 00 00 
+  802144:	ff d0                	call   *%rax
+  802146:	41 89 c5             	mov    %eax,%r13d
+  802149:	85 c0                	test   %eax,%eax
+  80214b:	78 06                	js     802153 <fd_close+0x41>
+  80214d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802151:	74 1a                	je     80216d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802153:	45 84 e4             	test   %r12b,%r12b
+  802156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80215f:	44 89 e8             	mov    %r13d,%eax
+  802162:	48 83 c4 18          	add    $0x18,%rsp
+  802166:	5b                   	pop    %rbx
+  802167:	41 5c                	pop    %r12
+  802169:	41 5d                	pop    %r13
+  80216b:	5d                   	pop    %rbp
+  80216c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80216d:	8b 3b                	mov    (%rbx),%edi
+  80216f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802173:	48 b8 a2 20 80 00 00 	movabs $0x8020a2,%rax
+  80217a:	00 00 00 
+  80217d:	ff d0                	call   *%rax
+  80217f:	41 89 c5             	mov    %eax,%r13d
+  802182:	85 c0                	test   %eax,%eax
+  802184:	78 1b                	js     8021a1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802186:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80218a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80218e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802194:	48 85 c0             	test   %rax,%rax
+  802197:	74 08                	je     8021a1 <fd_close+0x8f>
+  802199:	48 89 df             	mov    %rbx,%rdi
+  80219c:	ff d0                	call   *%rax
+  80219e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8021a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021a6:	48 89 de             	mov    %rbx,%rsi
+  8021a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021ae:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  8021b5:	00 00 00 
+  8021b8:	ff d0                	call   *%rax
+    return res;
+  8021ba:	eb a3                	jmp    80215f <fd_close+0x4d>
+
+00000000008021bc <close>:
+
+int
+close(int fdnum) {
+  8021bc:	55                   	push   %rbp
+  8021bd:	48 89 e5             	mov    %rsp,%rbp
+  8021c0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8021c4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021c8:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  8021cf:	00 00 00 
+  8021d2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021d4:	85 c0                	test   %eax,%eax
+  8021d6:	78 15                	js     8021ed <close+0x31>
+
+    return fd_close(fd, 1);
+  8021d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8021dd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8021e1:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  8021e8:	00 00 00 
+  8021eb:	ff d0                	call   *%rax
+}
+  8021ed:	c9                   	leave
+  8021ee:	c3                   	ret
+
+00000000008021ef <close_all>:
+
+void
+close_all(void) {
+  8021ef:	55                   	push   %rbp
+  8021f0:	48 89 e5             	mov    %rsp,%rbp
+  8021f3:	41 54                	push   %r12
+  8021f5:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8021f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021fb:	49 bc bc 21 80 00 00 	movabs $0x8021bc,%r12
+  802202:	00 00 00 
+  802205:	89 df                	mov    %ebx,%edi
+  802207:	41 ff d4             	call   *%r12
+  80220a:	83 c3 01             	add    $0x1,%ebx
+  80220d:	83 fb 20             	cmp    $0x20,%ebx
+  802210:	75 f3                	jne    802205 <close_all+0x16>
+}
+  802212:	5b                   	pop    %rbx
+  802213:	41 5c                	pop    %r12
+  802215:	5d                   	pop    %rbp
+  802216:	c3                   	ret
+
+0000000000802217 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802217:	55                   	push   %rbp
+  802218:	48 89 e5             	mov    %rsp,%rbp
+  80221b:	41 57                	push   %r15
+  80221d:	41 56                	push   %r14
+  80221f:	41 55                	push   %r13
+  802221:	41 54                	push   %r12
+  802223:	53                   	push   %rbx
+  802224:	48 83 ec 18          	sub    $0x18,%rsp
+  802228:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80222b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80222f:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  802236:	00 00 00 
+  802239:	ff d0                	call   *%rax
+  80223b:	89 c3                	mov    %eax,%ebx
+  80223d:	85 c0                	test   %eax,%eax
+  80223f:	0f 88 b8 00 00 00    	js     8022fd <dup+0xe6>
+    close(newfdnum);
+  802245:	44 89 e7             	mov    %r12d,%edi
+  802248:	48 b8 bc 21 80 00 00 	movabs $0x8021bc,%rax
+  80224f:	00 00 00 
+  802252:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802254:	4d 63 ec             	movslq %r12d,%r13
+  802257:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80225e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802262:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802266:	4c 89 ff             	mov    %r15,%rdi
+  802269:	49 be db 1f 80 00 00 	movabs $0x801fdb,%r14
+  802270:	00 00 00 
+  802273:	41 ff d6             	call   *%r14
+  802276:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802279:	4c 89 ef             	mov    %r13,%rdi
+  80227c:	41 ff d6             	call   *%r14
+  80227f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802282:	48 89 df             	mov    %rbx,%rdi
+  802285:	48 b8 ab 3e 80 00 00 	movabs $0x803eab,%rax
+  80228c:	00 00 00 
+  80228f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802291:	a8 04                	test   $0x4,%al
+  802293:	74 2b                	je     8022c0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802295:	41 89 c1             	mov    %eax,%r9d
+  802298:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80229e:	4c 89 f1             	mov    %r14,%rcx
+  8022a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a6:	48 89 de             	mov    %rbx,%rsi
+  8022a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ae:	48 b8 4d 13 80 00 00 	movabs $0x80134d,%rax
+  8022b5:	00 00 00 
+  8022b8:	ff d0                	call   *%rax
+  8022ba:	89 c3                	mov    %eax,%ebx
+  8022bc:	85 c0                	test   %eax,%eax
+  8022be:	78 4e                	js     80230e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8022c0:	4c 89 ff             	mov    %r15,%rdi
+  8022c3:	48 b8 ab 3e 80 00 00 	movabs $0x803eab,%rax
+  8022ca:	00 00 00 
+  8022cd:	ff d0                	call   *%rax
+  8022cf:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8022d2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8022d8:	4c 89 e9             	mov    %r13,%rcx
+  8022db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e0:	4c 89 fe             	mov    %r15,%rsi
+  8022e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022e8:	48 b8 4d 13 80 00 00 	movabs $0x80134d,%rax
+  8022ef:	00 00 00 
+  8022f2:	ff d0                	call   *%rax
+  8022f4:	89 c3                	mov    %eax,%ebx
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	78 14                	js     80230e <dup+0xf7>
+
+    return newfdnum;
+  8022fa:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8022fd:	89 d8                	mov    %ebx,%eax
+  8022ff:	48 83 c4 18          	add    $0x18,%rsp
+  802303:	5b                   	pop    %rbx
+  802304:	41 5c                	pop    %r12
+  802306:	41 5d                	pop    %r13
+  802308:	41 5e                	pop    %r14
+  80230a:	41 5f                	pop    %r15
+  80230c:	5d                   	pop    %rbp
+  80230d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80230e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802313:	4c 89 ee             	mov    %r13,%rsi
+  802316:	bf 00 00 00 00       	mov    $0x0,%edi
+  80231b:	49 bc c5 14 80 00 00 	movabs $0x8014c5,%r12
+  802322:	00 00 00 
+  802325:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802328:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80232d:	4c 89 f6             	mov    %r14,%rsi
+  802330:	bf 00 00 00 00       	mov    $0x0,%edi
+  802335:	41 ff d4             	call   *%r12
+    return res;
+  802338:	eb c3                	jmp    8022fd <dup+0xe6>
+
+000000000080233a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80233a:	55                   	push   %rbp
+  80233b:	48 89 e5             	mov    %rsp,%rbp
+  80233e:	41 56                	push   %r14
+  802340:	41 55                	push   %r13
+  802342:	41 54                	push   %r12
+  802344:	53                   	push   %rbx
+  802345:	48 83 ec 10          	sub    $0x10,%rsp
+  802349:	89 fb                	mov    %edi,%ebx
+  80234b:	49 89 f4             	mov    %rsi,%r12
+  80234e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802351:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802355:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  80235c:	00 00 00 
+  80235f:	ff d0                	call   *%rax
+  802361:	85 c0                	test   %eax,%eax
+  802363:	78 4c                	js     8023b1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802365:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802369:	41 8b 3e             	mov    (%r14),%edi
+  80236c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802370:	48 b8 a2 20 80 00 00 	movabs $0x8020a2,%rax
+  802377:	00 00 00 
+  80237a:	ff d0                	call   *%rax
+  80237c:	85 c0                	test   %eax,%eax
+  80237e:	78 35                	js     8023b5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802380:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802384:	83 e0 03             	and    $0x3,%eax
+  802387:	83 f8 01             	cmp    $0x1,%eax
+  80238a:	74 2d                	je     8023b9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80238c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802390:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802394:	48 85 c0             	test   %rax,%rax
+  802397:	74 56                	je     8023ef <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802399:	4c 89 ea             	mov    %r13,%rdx
+  80239c:	4c 89 e6             	mov    %r12,%rsi
+  80239f:	4c 89 f7             	mov    %r14,%rdi
+  8023a2:	ff d0                	call   *%rax
+}
+  8023a4:	48 83 c4 10          	add    $0x10,%rsp
+  8023a8:	5b                   	pop    %rbx
+  8023a9:	41 5c                	pop    %r12
+  8023ab:	41 5d                	pop    %r13
+  8023ad:	41 5e                	pop    %r14
+  8023af:	5d                   	pop    %rbp
+  8023b0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023b1:	48 98                	cltq
+  8023b3:	eb ef                	jmp    8023a4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023b5:	48 98                	cltq
+  8023b7:	eb eb                	jmp    8023a4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023b9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8023c0:	00 00 00 
+  8023c3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023c9:	89 da                	mov    %ebx,%edx
+  8023cb:	48 bf b1 56 80 00 00 	movabs $0x8056b1,%rdi
+  8023d2:	00 00 00 
+  8023d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023da:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  8023e1:	00 00 00 
+  8023e4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023e6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023ed:	eb b5                	jmp    8023a4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8023ef:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8023f6:	eb ac                	jmp    8023a4 <read+0x6a>
+
+00000000008023f8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8023f8:	55                   	push   %rbp
+  8023f9:	48 89 e5             	mov    %rsp,%rbp
+  8023fc:	41 57                	push   %r15
+  8023fe:	41 56                	push   %r14
+  802400:	41 55                	push   %r13
+  802402:	41 54                	push   %r12
+  802404:	53                   	push   %rbx
+  802405:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802409:	48 85 d2             	test   %rdx,%rdx
+  80240c:	74 54                	je     802462 <readn+0x6a>
+  80240e:	41 89 fd             	mov    %edi,%r13d
+  802411:	49 89 f6             	mov    %rsi,%r14
+  802414:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802417:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80241c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802421:	49 bf 3a 23 80 00 00 	movabs $0x80233a,%r15
+  802428:	00 00 00 
+  80242b:	4c 89 e2             	mov    %r12,%rdx
+  80242e:	48 29 f2             	sub    %rsi,%rdx
+  802431:	4c 01 f6             	add    %r14,%rsi
+  802434:	44 89 ef             	mov    %r13d,%edi
+  802437:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80243a:	85 c0                	test   %eax,%eax
+  80243c:	78 20                	js     80245e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80243e:	01 c3                	add    %eax,%ebx
+  802440:	85 c0                	test   %eax,%eax
+  802442:	74 08                	je     80244c <readn+0x54>
+  802444:	48 63 f3             	movslq %ebx,%rsi
+  802447:	4c 39 e6             	cmp    %r12,%rsi
+  80244a:	72 df                	jb     80242b <readn+0x33>
+    }
+    return res;
+  80244c:	48 63 c3             	movslq %ebx,%rax
+}
+  80244f:	48 83 c4 08          	add    $0x8,%rsp
+  802453:	5b                   	pop    %rbx
+  802454:	41 5c                	pop    %r12
+  802456:	41 5d                	pop    %r13
+  802458:	41 5e                	pop    %r14
+  80245a:	41 5f                	pop    %r15
+  80245c:	5d                   	pop    %rbp
+  80245d:	c3                   	ret
+        if (inc < 0) return inc;
+  80245e:	48 98                	cltq
+  802460:	eb ed                	jmp    80244f <readn+0x57>
+    int inc = 1, res = 0;
+  802462:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802467:	eb e3                	jmp    80244c <readn+0x54>
+
+0000000000802469 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802469:	55                   	push   %rbp
+  80246a:	48 89 e5             	mov    %rsp,%rbp
+  80246d:	41 56                	push   %r14
+  80246f:	41 55                	push   %r13
+  802471:	41 54                	push   %r12
+  802473:	53                   	push   %rbx
+  802474:	48 83 ec 10          	sub    $0x10,%rsp
+  802478:	89 fb                	mov    %edi,%ebx
+  80247a:	49 89 f4             	mov    %rsi,%r12
+  80247d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802480:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802484:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  80248b:	00 00 00 
+  80248e:	ff d0                	call   *%rax
+  802490:	85 c0                	test   %eax,%eax
+  802492:	78 47                	js     8024db <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802494:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802498:	41 8b 3e             	mov    (%r14),%edi
+  80249b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80249f:	48 b8 a2 20 80 00 00 	movabs $0x8020a2,%rax
+  8024a6:	00 00 00 
+  8024a9:	ff d0                	call   *%rax
+  8024ab:	85 c0                	test   %eax,%eax
+  8024ad:	78 30                	js     8024df <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024af:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8024b4:	74 2d                	je     8024e3 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8024b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024ba:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8024be:	48 85 c0             	test   %rax,%rax
+  8024c1:	74 56                	je     802519 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8024c3:	4c 89 ea             	mov    %r13,%rdx
+  8024c6:	4c 89 e6             	mov    %r12,%rsi
+  8024c9:	4c 89 f7             	mov    %r14,%rdi
+  8024cc:	ff d0                	call   *%rax
+}
+  8024ce:	48 83 c4 10          	add    $0x10,%rsp
+  8024d2:	5b                   	pop    %rbx
+  8024d3:	41 5c                	pop    %r12
+  8024d5:	41 5d                	pop    %r13
+  8024d7:	41 5e                	pop    %r14
+  8024d9:	5d                   	pop    %rbp
+  8024da:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024db:	48 98                	cltq
+  8024dd:	eb ef                	jmp    8024ce <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024df:	48 98                	cltq
+  8024e1:	eb eb                	jmp    8024ce <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024e3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8024ea:	00 00 00 
+  8024ed:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8024f3:	89 da                	mov    %ebx,%edx
+  8024f5:	48 bf cd 56 80 00 00 	movabs $0x8056cd,%rdi
+  8024fc:	00 00 00 
+  8024ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802504:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  80250b:	00 00 00 
+  80250e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802510:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802517:	eb b5                	jmp    8024ce <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802519:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802520:	eb ac                	jmp    8024ce <write+0x65>
+
+0000000000802522 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802522:	55                   	push   %rbp
+  802523:	48 89 e5             	mov    %rsp,%rbp
+  802526:	53                   	push   %rbx
+  802527:	48 83 ec 18          	sub    $0x18,%rsp
+  80252b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80252d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802531:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  802538:	00 00 00 
+  80253b:	ff d0                	call   *%rax
+  80253d:	85 c0                	test   %eax,%eax
+  80253f:	78 0c                	js     80254d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802541:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802545:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802548:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80254d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802551:	c9                   	leave
+  802552:	c3                   	ret
+
+0000000000802553 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802553:	55                   	push   %rbp
+  802554:	48 89 e5             	mov    %rsp,%rbp
+  802557:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80255b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80255f:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  802566:	00 00 00 
+  802569:	ff d0                	call   *%rax
+  80256b:	85 c0                	test   %eax,%eax
+  80256d:	78 07                	js     802576 <tell+0x23>
+    return fdes->fd_offset;
+  80256f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802573:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802576:	c9                   	leave
+  802577:	c3                   	ret
+
+0000000000802578 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802578:	55                   	push   %rbp
+  802579:	48 89 e5             	mov    %rsp,%rbp
+  80257c:	41 55                	push   %r13
+  80257e:	41 54                	push   %r12
+  802580:	53                   	push   %rbx
+  802581:	48 83 ec 18          	sub    $0x18,%rsp
+  802585:	89 fb                	mov    %edi,%ebx
+  802587:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80258a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80258e:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  802595:	00 00 00 
+  802598:	ff d0                	call   *%rax
+  80259a:	85 c0                	test   %eax,%eax
+  80259c:	78 38                	js     8025d6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80259e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8025a2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8025a6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025aa:	48 b8 a2 20 80 00 00 	movabs $0x8020a2,%rax
+  8025b1:	00 00 00 
+  8025b4:	ff d0                	call   *%rax
+  8025b6:	85 c0                	test   %eax,%eax
+  8025b8:	78 1c                	js     8025d6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025ba:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8025bf:	74 20                	je     8025e1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8025c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025c5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8025c9:	48 85 c0             	test   %rax,%rax
+  8025cc:	74 47                	je     802615 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8025ce:	44 89 e6             	mov    %r12d,%esi
+  8025d1:	4c 89 ef             	mov    %r13,%rdi
+  8025d4:	ff d0                	call   *%rax
+}
+  8025d6:	48 83 c4 18          	add    $0x18,%rsp
+  8025da:	5b                   	pop    %rbx
+  8025db:	41 5c                	pop    %r12
+  8025dd:	41 5d                	pop    %r13
+  8025df:	5d                   	pop    %rbp
+  8025e0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8025e1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8025e8:	00 00 00 
+  8025eb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8025f1:	89 da                	mov    %ebx,%edx
+  8025f3:	48 bf 90 56 80 00 00 	movabs $0x805690,%rdi
+  8025fa:	00 00 00 
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802602:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  802609:	00 00 00 
+  80260c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80260e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802613:	eb c1                	jmp    8025d6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802615:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80261a:	eb ba                	jmp    8025d6 <ftruncate+0x5e>
+
+000000000080261c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80261c:	55                   	push   %rbp
+  80261d:	48 89 e5             	mov    %rsp,%rbp
+  802620:	41 54                	push   %r12
+  802622:	53                   	push   %rbx
+  802623:	48 83 ec 10          	sub    $0x10,%rsp
+  802627:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80262a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80262e:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  802635:	00 00 00 
+  802638:	ff d0                	call   *%rax
+  80263a:	85 c0                	test   %eax,%eax
+  80263c:	78 4e                	js     80268c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80263e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802642:	41 8b 3c 24          	mov    (%r12),%edi
+  802646:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80264a:	48 b8 a2 20 80 00 00 	movabs $0x8020a2,%rax
+  802651:	00 00 00 
+  802654:	ff d0                	call   *%rax
+  802656:	85 c0                	test   %eax,%eax
+  802658:	78 32                	js     80268c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80265a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80265e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802663:	74 30                	je     802695 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802665:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802668:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80266f:	00 00 00 
+    stat->st_isdir = 0;
+  802672:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802679:	00 00 00 
+    stat->st_dev = dev;
+  80267c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802683:	48 89 de             	mov    %rbx,%rsi
+  802686:	4c 89 e7             	mov    %r12,%rdi
+  802689:	ff 50 28             	call   *0x28(%rax)
+}
+  80268c:	48 83 c4 10          	add    $0x10,%rsp
+  802690:	5b                   	pop    %rbx
+  802691:	41 5c                	pop    %r12
+  802693:	5d                   	pop    %rbp
+  802694:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802695:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80269a:	eb f0                	jmp    80268c <fstat+0x70>
+
+000000000080269c <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80269c:	55                   	push   %rbp
+  80269d:	48 89 e5             	mov    %rsp,%rbp
+  8026a0:	41 54                	push   %r12
+  8026a2:	53                   	push   %rbx
+  8026a3:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8026aa:	41 89 fc             	mov    %edi,%r12d
+  8026ad:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026af:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026b3:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  8026ba:	00 00 00 
+  8026bd:	ff d0                	call   *%rax
+  8026bf:	85 c0                	test   %eax,%eax
+  8026c1:	78 31                	js     8026f4 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8026c3:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8026ca:	44 89 e7             	mov    %r12d,%edi
+  8026cd:	48 b8 1c 26 80 00 00 	movabs $0x80261c,%rax
+  8026d4:	00 00 00 
+  8026d7:	ff d0                	call   *%rax
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	78 17                	js     8026f4 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8026dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026e1:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8026e4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8026e7:	39 d3                	cmp    %edx,%ebx
+  8026e9:	0f 4f da             	cmovg  %edx,%ebx
+  8026ec:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8026ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026f4:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8026fb:	5b                   	pop    %rbx
+  8026fc:	41 5c                	pop    %r12
+  8026fe:	5d                   	pop    %rbp
+  8026ff:	c3                   	ret
+
+0000000000802700 <seektoend>:
+{
+  802700:	55                   	push   %rbp
+  802701:	48 89 e5             	mov    %rsp,%rbp
+  802704:	53                   	push   %rbx
+  802705:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80270c:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80270e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802712:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  802719:	00 00 00 
+  80271c:	ff d0                	call   *%rax
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	78 28                	js     80274a <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802722:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802729:	89 df                	mov    %ebx,%edi
+  80272b:	48 b8 1c 26 80 00 00 	movabs $0x80261c,%rax
+  802732:	00 00 00 
+  802735:	ff d0                	call   *%rax
+  802737:	85 c0                	test   %eax,%eax
+  802739:	78 0f                	js     80274a <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80273b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80273e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802742:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802745:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80274a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80274e:	c9                   	leave
+  80274f:	c3                   	ret
+
+0000000000802750 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802750:	55                   	push   %rbp
+  802751:	48 89 e5             	mov    %rsp,%rbp
+  802754:	41 54                	push   %r12
+  802756:	53                   	push   %rbx
+  802757:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80275a:	be 00 00 00 00       	mov    $0x0,%esi
+  80275f:	48 b8 43 33 80 00 00 	movabs $0x803343,%rax
+  802766:	00 00 00 
+  802769:	ff d0                	call   *%rax
+  80276b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80276d:	85 c0                	test   %eax,%eax
+  80276f:	78 25                	js     802796 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802771:	4c 89 e6             	mov    %r12,%rsi
+  802774:	89 c7                	mov    %eax,%edi
+  802776:	48 b8 1c 26 80 00 00 	movabs $0x80261c,%rax
+  80277d:	00 00 00 
+  802780:	ff d0                	call   *%rax
+  802782:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802785:	89 df                	mov    %ebx,%edi
+  802787:	48 b8 bc 21 80 00 00 	movabs $0x8021bc,%rax
+  80278e:	00 00 00 
+  802791:	ff d0                	call   *%rax
+
+    return res;
+  802793:	44 89 e3             	mov    %r12d,%ebx
+}
+  802796:	89 d8                	mov    %ebx,%eax
+  802798:	5b                   	pop    %rbx
+  802799:	41 5c                	pop    %r12
+  80279b:	5d                   	pop    %rbp
+  80279c:	c3                   	ret
+
+000000000080279d <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  80279d:	55                   	push   %rbp
+  80279e:	48 89 e5             	mov    %rsp,%rbp
+  8027a1:	53                   	push   %rbx
+  8027a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a6:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8027a9:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  8027b0:	00 00 00 
+  8027b3:	ff d0                	call   *%rax
+  8027b5:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8027b9:	0f 87 ea 00 00 00    	ja     8028a9 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8027bf:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8027c6:	00 00 00 
+  8027c9:	80 38 00             	cmpb   $0x0,(%rax)
+  8027cc:	75 35                	jne    802803 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8027ce:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027d3:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8027d8:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8027dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027e2:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  8027e9:	00 00 00 
+  8027ec:	ff d0                	call   *%rax
+  8027ee:	85 c0                	test   %eax,%eax
+  8027f0:	0f 88 ba 00 00 00    	js     8028b0 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8027f6:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8027fd:	00 00 00 
+  802800:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802803:	48 89 df             	mov    %rbx,%rdi
+  802806:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  80280d:	00 00 00 
+  802810:	ff d0                	call   *%rax
+  802812:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802816:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80281d:	00 00 00 
+  802820:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802824:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802827:	39 39                	cmp    %edi,(%rcx)
+  802829:	74 46                	je     802871 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80282b:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80282f:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802836:	00 
+  802837:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80283e:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802845:	00 
+  802846:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80284d:	00 
+  80284e:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802855:	00 
+  802856:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80285d:	00 
+  80285e:	89 39                	mov    %edi,(%rcx)
+  802860:	48 01 c6             	add    %rax,%rsi
+  802863:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802868:	48 89 c8             	mov    %rcx,%rax
+  80286b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80286f:	c9                   	leave
+  802870:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802871:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802875:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80287c:	00 00 00 
+  80287f:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802882:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802886:	74 e0                	je     802868 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802888:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80288f:	00 
+  802890:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802894:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  80289b:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80289d:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8028a0:	48 01 c2             	add    %rax,%rdx
+  8028a3:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8028a7:	eb bf                	jmp    802868 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8028a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ae:	eb b8                	jmp    802868 <fbuf_get+0xcb>
+            return NULL;
+  8028b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028b5:	eb b1                	jmp    802868 <fbuf_get+0xcb>
+
+00000000008028b7 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8028b7:	55                   	push   %rbp
+  8028b8:	48 89 e5             	mov    %rsp,%rbp
+  8028bb:	53                   	push   %rbx
+  8028bc:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8028c0:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8028c7:	00 00 00 
+  8028ca:	48 8b 18             	mov    (%rax),%rbx
+  8028cd:	48 85 db             	test   %rbx,%rbx
+  8028d0:	74 16                	je     8028e8 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8028d2:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8028d9:	00 00 00 
+  8028dc:	48 8b 18             	mov    (%rax),%rbx
+}
+  8028df:	48 89 d8             	mov    %rbx,%rax
+  8028e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028e6:	c9                   	leave
+  8028e7:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8028e8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028ed:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8028f2:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8028f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fc:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  802903:	00 00 00 
+  802906:	ff d0                	call   *%rax
+  802908:	85 c0                	test   %eax,%eax
+  80290a:	78 d3                	js     8028df <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  80290c:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802911:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802918:	00 00 00 
+  80291b:	eb b5                	jmp    8028d2 <fsipc_bulk+0x1b>
+
+000000000080291d <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80291d:	55                   	push   %rbp
+  80291e:	48 89 e5             	mov    %rsp,%rbp
+  802921:	41 57                	push   %r15
+  802923:	41 56                	push   %r14
+  802925:	41 55                	push   %r13
+  802927:	41 54                	push   %r12
+  802929:	53                   	push   %rbx
+  80292a:	48 83 ec 08          	sub    $0x8,%rsp
+  80292e:	41 89 fd             	mov    %edi,%r13d
+  802931:	49 89 f6             	mov    %rsi,%r14
+  802934:	49 89 d7             	mov    %rdx,%r15
+  802937:	48 89 cb             	mov    %rcx,%rbx
+  80293a:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80293d:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802944:	00 00 00 
+  802947:	83 38 00             	cmpl   $0x0,(%rax)
+  80294a:	74 52                	je     80299e <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80294c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802952:	4c 89 f9             	mov    %r15,%rcx
+  802955:	4c 89 f2             	mov    %r14,%rdx
+  802958:	44 89 ee             	mov    %r13d,%esi
+  80295b:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802962:	00 00 00 
+  802965:	8b 38                	mov    (%rax),%edi
+  802967:	48 b8 a5 44 80 00 00 	movabs $0x8044a5,%rax
+  80296e:	00 00 00 
+  802971:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802973:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802978:	4c 89 e2             	mov    %r12,%rdx
+  80297b:	48 89 de             	mov    %rbx,%rsi
+  80297e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802983:	48 b8 f5 42 80 00 00 	movabs $0x8042f5,%rax
+  80298a:	00 00 00 
+  80298d:	ff d0                	call   *%rax
+}
+  80298f:	48 83 c4 08          	add    $0x8,%rsp
+  802993:	5b                   	pop    %rbx
+  802994:	41 5c                	pop    %r12
+  802996:	41 5d                	pop    %r13
+  802998:	41 5e                	pop    %r14
+  80299a:	41 5f                	pop    %r15
+  80299c:	5d                   	pop    %rbp
+  80299d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80299e:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029a3:	48 b8 48 45 80 00 00 	movabs $0x804548,%rax
+  8029aa:	00 00 00 
+  8029ad:	ff d0                	call   *%rax
+  8029af:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8029b6:	00 00 
+  8029b8:	eb 92                	jmp    80294c <fsipc_region+0x2f>
+
+00000000008029ba <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8029ba:	55                   	push   %rbp
+  8029bb:	48 89 e5             	mov    %rsp,%rbp
+  8029be:	41 57                	push   %r15
+  8029c0:	41 56                	push   %r14
+  8029c2:	41 55                	push   %r13
+  8029c4:	41 54                	push   %r12
+  8029c6:	53                   	push   %rbx
+  8029c7:	48 83 ec 28          	sub    $0x28,%rsp
+  8029cb:	49 89 ff             	mov    %rdi,%r15
+  8029ce:	49 89 f6             	mov    %rsi,%r14
+  8029d1:	48 89 d3             	mov    %rdx,%rbx
+  8029d4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8029d8:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8029db:	48 b8 b7 28 80 00 00 	movabs $0x8028b7,%rax
+  8029e2:	00 00 00 
+  8029e5:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8029e7:	48 85 c0             	test   %rax,%rax
+  8029ea:	0f 84 cc 00 00 00    	je     802abc <devfile_write_direct+0x102>
+  8029f0:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8029f3:	48 85 db             	test   %rbx,%rbx
+  8029f6:	0f 84 ba 00 00 00    	je     802ab6 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8029fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802a02:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802a09:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802a0d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802a11:	4c 29 e3             	sub    %r12,%rbx
+  802a14:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802a19:	48 39 c3             	cmp    %rax,%rbx
+  802a1c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802a20:	48 89 da             	mov    %rbx,%rdx
+  802a23:	4c 89 f6             	mov    %r14,%rsi
+  802a26:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802a2a:	48 b8 7b 0f 80 00 00 	movabs $0x800f7b,%rax
+  802a31:	00 00 00 
+  802a34:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802a36:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a3a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802a3e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802a41:	44 01 e0             	add    %r12d,%eax
+  802a44:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802a48:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802a4c:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802a53:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802a5a:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802a61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a6c:	4c 89 ee             	mov    %r13,%rsi
+  802a6f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a74:	48 b8 1d 29 80 00 00 	movabs $0x80291d,%rax
+  802a7b:	00 00 00 
+  802a7e:	ff d0                	call   *%rax
+        if (res < 0)
+  802a80:	85 c0                	test   %eax,%eax
+  802a82:	78 29                	js     802aad <devfile_write_direct+0xf3>
+        if (res == 0)
+  802a84:	74 2b                	je     802ab1 <devfile_write_direct+0xf7>
+        i += res;
+  802a86:	48 98                	cltq
+  802a88:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802a8b:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802a8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a92:	49 39 c4             	cmp    %rax,%r12
+  802a95:	0f 82 72 ff ff ff    	jb     802a0d <devfile_write_direct+0x53>
+    return i;
+  802a9b:	4c 89 e0             	mov    %r12,%rax
+}
+  802a9e:	48 83 c4 28          	add    $0x28,%rsp
+  802aa2:	5b                   	pop    %rbx
+  802aa3:	41 5c                	pop    %r12
+  802aa5:	41 5d                	pop    %r13
+  802aa7:	41 5e                	pop    %r14
+  802aa9:	41 5f                	pop    %r15
+  802aab:	5d                   	pop    %rbp
+  802aac:	c3                   	ret
+            return res;
+  802aad:	48 98                	cltq
+  802aaf:	eb ed                	jmp    802a9e <devfile_write_direct+0xe4>
+            return i;
+  802ab1:	4c 89 e0             	mov    %r12,%rax
+  802ab4:	eb e8                	jmp    802a9e <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802ab6:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802aba:	eb df                	jmp    802a9b <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802abc:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802ac3:	eb d9                	jmp    802a9e <devfile_write_direct+0xe4>
+
+0000000000802ac5 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802ac5:	55                   	push   %rbp
+  802ac6:	48 89 e5             	mov    %rsp,%rbp
+  802ac9:	41 56                	push   %r14
+  802acb:	41 55                	push   %r13
+  802acd:	41 54                	push   %r12
+  802acf:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802ad0:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802ad4:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802add:	4d 39 ee             	cmp    %r13,%r14
+  802ae0:	0f 84 99 00 00 00    	je     802b7f <fbuf_flush+0xba>
+  802ae6:	49 89 fc             	mov    %rdi,%r12
+  802ae9:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802aec:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802aef:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802af3:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  802afa:	00 00 00 
+  802afd:	ff d0                	call   *%rax
+  802aff:	48 89 c2             	mov    %rax,%rdx
+  802b02:	48 c1 e2 04          	shl    $0x4,%rdx
+  802b06:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802b0a:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b0e:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802b13:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802b16:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802b1a:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802b21:	00 
+  802b22:	44 89 f1             	mov    %r14d,%ecx
+  802b25:	4c 89 ea             	mov    %r13,%rdx
+  802b28:	4c 89 e7             	mov    %r12,%rdi
+  802b2b:	48 b8 ba 29 80 00 00 	movabs $0x8029ba,%rax
+  802b32:	00 00 00 
+  802b35:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b37:	48 85 c0             	test   %rax,%rax
+  802b3a:	78 43                	js     802b7f <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802b3c:	4c 39 e8             	cmp    %r13,%rax
+  802b3f:	72 47                	jb     802b88 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802b41:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802b46:	83 c0 01             	add    $0x1,%eax
+  802b49:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802b4e:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802b51:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802b55:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802b59:	72 0f                	jb     802b6a <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802b5b:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802b5f:	48 39 c2             	cmp    %rax,%rdx
+  802b62:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802b66:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802b6a:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802b71:	00 
+  802b72:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802b79:	00 
+    return 0;
+  802b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b7f:	5b                   	pop    %rbx
+  802b80:	41 5c                	pop    %r12
+  802b82:	41 5d                	pop    %r13
+  802b84:	41 5e                	pop    %r14
+  802b86:	5d                   	pop    %rbp
+  802b87:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802b88:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802b8d:	eb f0                	jmp    802b7f <fbuf_flush+0xba>
+
+0000000000802b8f <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802b8f:	55                   	push   %rbp
+  802b90:	48 89 e5             	mov    %rsp,%rbp
+  802b93:	53                   	push   %rbx
+  802b94:	48 83 ec 08          	sub    $0x8,%rsp
+  802b98:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802b9b:	48 b8 9d 27 80 00 00 	movabs $0x80279d,%rax
+  802ba2:	00 00 00 
+  802ba5:	ff d0                	call   *%rax
+  802ba7:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802baa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802baf:	48 85 f6             	test   %rsi,%rsi
+  802bb2:	74 0f                	je     802bc3 <devfile_sync+0x34>
+  802bb4:	48 89 df             	mov    %rbx,%rdi
+  802bb7:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  802bbe:	00 00 00 
+  802bc1:	ff d0                	call   *%rax
+}
+  802bc3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bc7:	c9                   	leave
+  802bc8:	c3                   	ret
+
+0000000000802bc9 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802bc9:	55                   	push   %rbp
+  802bca:	48 89 e5             	mov    %rsp,%rbp
+  802bcd:	48 83 ec 10          	sub    $0x10,%rsp
+  802bd1:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802bd4:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802bdb:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802bdc:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802be0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802be5:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802bec:	00 00 00 
+  802bef:	48 b8 1d 29 80 00 00 	movabs $0x80291d,%rax
+  802bf6:	00 00 00 
+  802bf9:	ff d0                	call   *%rax
+}
+  802bfb:	c9                   	leave
+  802bfc:	c3                   	ret
+
+0000000000802bfd <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802bfd:	55                   	push   %rbp
+  802bfe:	48 89 e5             	mov    %rsp,%rbp
+  802c01:	41 54                	push   %r12
+  802c03:	53                   	push   %rbx
+  802c04:	48 89 fb             	mov    %rdi,%rbx
+  802c07:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802c0a:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  802c11:	00 00 00 
+  802c14:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c16:	85 c0                	test   %eax,%eax
+  802c18:	78 63                	js     802c7d <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802c1a:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c1d:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802c24:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802c26:	be 00 00 00 00       	mov    $0x0,%esi
+  802c2b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c30:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  802c37:	00 00 00 
+  802c3a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c3c:	85 c0                	test   %eax,%eax
+  802c3e:	78 3d                	js     802c7d <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802c40:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802c47:	00 00 00 
+  802c4a:	48 89 de             	mov    %rbx,%rsi
+  802c4d:	4c 89 e7             	mov    %r12,%rdi
+  802c50:	48 b8 86 0b 80 00 00 	movabs $0x800b86,%rax
+  802c57:	00 00 00 
+  802c5a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802c5c:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802c62:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802c69:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802c6a:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802c70:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802c77:	00 
+
+    return 0;
+  802c78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c7d:	5b                   	pop    %rbx
+  802c7e:	41 5c                	pop    %r12
+  802c80:	5d                   	pop    %rbp
+  802c81:	c3                   	ret
+
+0000000000802c82 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802c82:	55                   	push   %rbp
+  802c83:	48 89 e5             	mov    %rsp,%rbp
+  802c86:	41 54                	push   %r12
+  802c88:	53                   	push   %rbx
+  802c89:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802c8c:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  802c93:	00 00 00 
+  802c96:	ff d0                	call   *%rax
+  802c98:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802c9b:	48 89 df             	mov    %rbx,%rdi
+  802c9e:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+  802caa:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802cae:	76 2e                	jbe    802cde <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802cb0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802cb3:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802cba:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802cbc:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802cc6:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  802ccd:	00 00 00 
+  802cd0:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802cd2:	45 85 e4             	test   %r12d,%r12d
+  802cd5:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802cd9:	5b                   	pop    %rbx
+  802cda:	41 5c                	pop    %r12
+  802cdc:	5d                   	pop    %rbp
+  802cdd:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802cde:	48 89 df             	mov    %rbx,%rdi
+  802ce1:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  802ce8:	00 00 00 
+  802ceb:	ff d0                	call   *%rax
+  802ced:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802cf1:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802cf8:	00 00 00 
+  802cfb:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802d02:	48 89 df             	mov    %rbx,%rdi
+  802d05:	48 b8 db 1f 80 00 00 	movabs $0x801fdb,%rax
+  802d0c:	00 00 00 
+  802d0f:	ff d0                	call   *%rax
+  802d11:	48 89 c6             	mov    %rax,%rsi
+  802d14:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d19:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d1e:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  802d25:	00 00 00 
+  802d28:	ff d0                	call   *%rax
+  802d2a:	eb 84                	jmp    802cb0 <devfile_flush+0x2e>
+
+0000000000802d2c <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802d2c:	55                   	push   %rbp
+  802d2d:	48 89 e5             	mov    %rsp,%rbp
+  802d30:	41 55                	push   %r13
+  802d32:	41 54                	push   %r12
+  802d34:	53                   	push   %rbx
+  802d35:	48 83 ec 08          	sub    $0x8,%rsp
+  802d39:	48 89 fb             	mov    %rdi,%rbx
+  802d3c:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802d3f:	48 b8 9d 27 80 00 00 	movabs $0x80279d,%rax
+  802d46:	00 00 00 
+  802d49:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d4b:	48 85 c0             	test   %rax,%rax
+  802d4e:	74 51                	je     802da1 <devfile_trunc+0x75>
+  802d50:	49 89 c4             	mov    %rax,%r12
+  802d53:	48 89 c6             	mov    %rax,%rsi
+  802d56:	48 89 df             	mov    %rbx,%rdi
+  802d59:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  802d60:	00 00 00 
+  802d63:	ff d0                	call   *%rax
+  802d65:	85 c0                	test   %eax,%eax
+  802d67:	78 2d                	js     802d96 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802d69:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802d70:	00 00 00 
+  802d73:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802d76:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802d78:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802d7c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d81:	bf 02 00 00 00       	mov    $0x2,%edi
+  802d86:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  802d8d:	00 00 00 
+  802d90:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802d92:	85 c0                	test   %eax,%eax
+  802d94:	79 3e                	jns    802dd4 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802d96:	48 83 c4 08          	add    $0x8,%rsp
+  802d9a:	5b                   	pop    %rbx
+  802d9b:	41 5c                	pop    %r12
+  802d9d:	41 5d                	pop    %r13
+  802d9f:	5d                   	pop    %rbp
+  802da0:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802da1:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802da8:	00 00 00 
+  802dab:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802dae:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802db0:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802db4:	be 00 00 00 00       	mov    $0x0,%esi
+  802db9:	bf 02 00 00 00       	mov    $0x2,%edi
+  802dbe:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  802dc5:	00 00 00 
+  802dc8:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802dca:	85 c0                	test   %eax,%eax
+  802dcc:	78 c8                	js     802d96 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802dce:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802dd2:	eb c2                	jmp    802d96 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802dd4:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802dd7:	8d 51 01             	lea    0x1(%rcx),%edx
+  802dda:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ddd:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802de2:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802de9:	00 00 
+  802deb:	eb a9                	jmp    802d96 <devfile_trunc+0x6a>
+
+0000000000802ded <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802ded:	55                   	push   %rbp
+  802dee:	48 89 e5             	mov    %rsp,%rbp
+  802df1:	41 57                	push   %r15
+  802df3:	41 56                	push   %r14
+  802df5:	41 55                	push   %r13
+  802df7:	41 54                	push   %r12
+  802df9:	53                   	push   %rbx
+  802dfa:	48 83 ec 28          	sub    $0x28,%rsp
+  802dfe:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802e02:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802e06:	49 89 d7             	mov    %rdx,%r15
+  802e09:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802e0d:	48 b8 9d 27 80 00 00 	movabs $0x80279d,%rax
+  802e14:	00 00 00 
+  802e17:	ff d0                	call   *%rax
+  802e19:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802e1c:	48 85 c0             	test   %rax,%rax
+  802e1f:	74 31                	je     802e52 <devfile_write+0x65>
+  802e21:	4c 89 f8             	mov    %r15,%rax
+  802e24:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802e2b:	77 25                	ja     802e52 <devfile_write+0x65>
+    size_t i = 0;
+  802e2d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802e33:	48 85 c0             	test   %rax,%rax
+  802e36:	0f 85 64 01 00 00    	jne    802fa0 <devfile_write+0x1b3>
+    size_t i = 0;
+  802e3c:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802e40:	4c 89 f8             	mov    %r15,%rax
+}
+  802e43:	48 83 c4 28          	add    $0x28,%rsp
+  802e47:	5b                   	pop    %rbx
+  802e48:	41 5c                	pop    %r12
+  802e4a:	41 5d                	pop    %r13
+  802e4c:	41 5e                	pop    %r14
+  802e4e:	41 5f                	pop    %r15
+  802e50:	5d                   	pop    %rbp
+  802e51:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e52:	48 85 db             	test   %rbx,%rbx
+  802e55:	74 5b                	je     802eb2 <devfile_write+0xc5>
+  802e57:	48 89 de             	mov    %rbx,%rsi
+  802e5a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e5e:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  802e65:	00 00 00 
+  802e68:	ff d0                	call   *%rax
+  802e6a:	85 c0                	test   %eax,%eax
+  802e6c:	78 40                	js     802eae <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802e6e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e72:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802e75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e79:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802e7d:	48 b8 ba 29 80 00 00 	movabs $0x8029ba,%rax
+  802e84:	00 00 00 
+  802e87:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802e89:	48 85 c0             	test   %rax,%rax
+  802e8c:	7e b5                	jle    802e43 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802e8e:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802e92:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802e95:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802e98:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802e9b:	8d 51 01             	lea    0x1(%rcx),%edx
+  802e9e:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ea1:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802ea4:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802eab:	00 
+  802eac:	eb 95                	jmp    802e43 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802eae:	48 98                	cltq
+  802eb0:	eb 91                	jmp    802e43 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802eb2:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802eb6:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802eb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ebd:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802ec1:	48 89 df             	mov    %rbx,%rdi
+  802ec4:	48 b8 ba 29 80 00 00 	movabs $0x8029ba,%rax
+  802ecb:	00 00 00 
+  802ece:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802ed0:	48 85 c0             	test   %rax,%rax
+  802ed3:	0f 8e 6a ff ff ff    	jle    802e43 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802ed9:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802edc:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ee0:	e9 5e ff ff ff       	jmp    802e43 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802ee5:	48 98                	cltq
+  802ee7:	4d 85 ff             	test   %r15,%r15
+  802eea:	49 0f 45 c7          	cmovne %r15,%rax
+  802eee:	e9 50 ff ff ff       	jmp    802e43 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802ef3:	48 89 de             	mov    %rbx,%rsi
+  802ef6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802efa:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  802f01:	00 00 00 
+  802f04:	ff d0                	call   *%rax
+  802f06:	85 c0                	test   %eax,%eax
+  802f08:	0f 88 2b 01 00 00    	js     803039 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802f0e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f12:	4c 01 f8             	add    %r15,%rax
+  802f15:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802f19:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f1d:	48 b9 c9 1f 80 00 00 	movabs $0x801fc9,%rcx
+  802f24:	00 00 00 
+  802f27:	ff d1                	call   *%rcx
+  802f29:	48 89 c2             	mov    %rax,%rdx
+  802f2c:	48 c1 e2 04          	shl    $0x4,%rdx
+  802f30:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802f34:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f38:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802f3d:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802f40:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802f47:	00 
+  802f48:	4c 89 ea             	mov    %r13,%rdx
+  802f4b:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802f4f:	48 b8 7b 0f 80 00 00 	movabs $0x800f7b,%rax
+  802f56:	00 00 00 
+  802f59:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802f5b:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802f5f:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802f63:	48 39 c2             	cmp    %rax,%rdx
+  802f66:	0f 84 db 00 00 00    	je     803047 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802f6c:	4c 39 e2             	cmp    %r12,%rdx
+  802f6f:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802f73:	4d 01 ec             	add    %r13,%r12
+  802f76:	49 39 c4             	cmp    %rax,%r12
+  802f79:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802f7d:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802f81:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802f85:	45 01 ee             	add    %r13d,%r14d
+  802f88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f8c:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802f90:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802f93:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f97:	49 39 c7             	cmp    %rax,%r15
+  802f9a:	0f 83 a0 fe ff ff    	jae    802e40 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802fa0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fa4:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802fa8:	8b 43 08             	mov    0x8(%rbx),%eax
+  802fab:	44 39 f0             	cmp    %r14d,%eax
+  802fae:	7f 10                	jg     802fc0 <devfile_write+0x1d3>
+  802fb0:	48 98                	cltq
+  802fb2:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802fb8:	49 63 d6             	movslq %r14d,%rdx
+  802fbb:	48 39 d0             	cmp    %rdx,%rax
+  802fbe:	7d 2d                	jge    802fed <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802fc0:	48 89 de             	mov    %rbx,%rsi
+  802fc3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fc7:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  802fce:	00 00 00 
+  802fd1:	ff d0                	call   *%rax
+  802fd3:	85 c0                	test   %eax,%eax
+  802fd5:	0f 88 0a ff ff ff    	js     802ee5 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802fdb:	44 89 f0             	mov    %r14d,%eax
+  802fde:	66 b8 00 00          	mov    $0x0,%ax
+  802fe2:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802fe5:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802fec:	00 
+        size_t off = pos - fb->fb_base;
+  802fed:	45 89 f4             	mov    %r14d,%r12d
+  802ff0:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802ff4:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802ff7:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802ffb:	4d 29 fd             	sub    %r15,%r13
+  802ffe:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803003:	4c 29 e0             	sub    %r12,%rax
+  803006:	49 39 c5             	cmp    %rax,%r13
+  803009:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  80300d:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803011:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803015:	48 39 c2             	cmp    %rax,%rdx
+  803018:	0f 84 f0 fe ff ff    	je     802f0e <devfile_write+0x121>
+  80301e:	4c 39 e0             	cmp    %r12,%rax
+  803021:	0f 82 cc fe ff ff    	jb     802ef3 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803027:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80302b:	48 39 d0             	cmp    %rdx,%rax
+  80302e:	0f 83 da fe ff ff    	jae    802f0e <devfile_write+0x121>
+  803034:	e9 ba fe ff ff       	jmp    802ef3 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803039:	48 98                	cltq
+  80303b:	4d 85 ff             	test   %r15,%r15
+  80303e:	49 0f 45 c7          	cmovne %r15,%rax
+  803042:	e9 fc fd ff ff       	jmp    802e43 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803047:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80304b:	4c 89 e2             	mov    %r12,%rdx
+  80304e:	e9 2a ff ff ff       	jmp    802f7d <devfile_write+0x190>
+
+0000000000803053 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803053:	55                   	push   %rbp
+  803054:	48 89 e5             	mov    %rsp,%rbp
+  803057:	41 57                	push   %r15
+  803059:	41 56                	push   %r14
+  80305b:	41 55                	push   %r13
+  80305d:	41 54                	push   %r12
+  80305f:	53                   	push   %rbx
+  803060:	48 83 ec 28          	sub    $0x28,%rsp
+  803064:	49 89 ff             	mov    %rdi,%r15
+  803067:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80306b:	48 89 d3             	mov    %rdx,%rbx
+  80306e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803072:	48 b8 9d 27 80 00 00 	movabs $0x80279d,%rax
+  803079:	00 00 00 
+  80307c:	ff d0                	call   *%rax
+  80307e:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803081:	48 85 c0             	test   %rax,%rax
+  803084:	74 0d                	je     803093 <devfile_read+0x40>
+  803086:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  80308d:	0f 86 1a 01 00 00    	jbe    8031ad <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803093:	4d 85 e4             	test   %r12,%r12
+  803096:	74 1a                	je     8030b2 <devfile_read+0x5f>
+  803098:	4c 89 e6             	mov    %r12,%rsi
+  80309b:	4c 89 ff             	mov    %r15,%rdi
+  80309e:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  8030a5:	00 00 00 
+  8030a8:	ff d0                	call   *%rax
+  8030aa:	85 c0                	test   %eax,%eax
+  8030ac:	0f 88 e8 00 00 00    	js     80319a <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8030b2:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8030b6:	48 b8 b7 28 80 00 00 	movabs $0x8028b7,%rax
+  8030bd:	00 00 00 
+  8030c0:	ff d0                	call   *%rax
+  8030c2:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  8030c5:	48 85 c0             	test   %rax,%rax
+  8030c8:	0f 84 69 02 00 00    	je     803337 <devfile_read+0x2e4>
+    while (i < n) {
+  8030ce:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8030d3:	0f 84 ce 00 00 00    	je     8031a7 <devfile_read+0x154>
+    size_t i = 0;
+  8030d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8030de:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8030e5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8030e9:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  8030ed:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  8030f1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8030f5:	48 29 da             	sub    %rbx,%rdx
+  8030f8:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8030fd:	48 39 c2             	cmp    %rax,%rdx
+  803100:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803104:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803108:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  80310c:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80310f:	01 d8                	add    %ebx,%eax
+  803111:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803115:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803119:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803120:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803127:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80312e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803134:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803139:	4c 89 ee             	mov    %r13,%rsi
+  80313c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803141:	48 b8 1d 29 80 00 00 	movabs $0x80291d,%rax
+  803148:	00 00 00 
+  80314b:	ff d0                	call   *%rax
+        if (res < 0)
+  80314d:	85 c0                	test   %eax,%eax
+  80314f:	78 4d                	js     80319e <devfile_read+0x14b>
+        if (res == 0)
+  803151:	74 4f                	je     8031a2 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803153:	4c 63 e0             	movslq %eax,%r12
+  803156:	4c 89 e2             	mov    %r12,%rdx
+  803159:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80315d:	4c 89 f7             	mov    %r14,%rdi
+  803160:	48 b8 7b 0f 80 00 00 	movabs $0x800f7b,%rax
+  803167:	00 00 00 
+  80316a:	ff d0                	call   *%rax
+        i += res;
+  80316c:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  80316f:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803172:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803176:	48 39 c3             	cmp    %rax,%rbx
+  803179:	0f 82 72 ff ff ff    	jb     8030f1 <devfile_read+0x9e>
+    return i;
+  80317f:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803182:	48 85 c0             	test   %rax,%rax
+  803185:	7e 04                	jle    80318b <devfile_read+0x138>
+  803187:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  80318b:	48 83 c4 28          	add    $0x28,%rsp
+  80318f:	5b                   	pop    %rbx
+  803190:	41 5c                	pop    %r12
+  803192:	41 5d                	pop    %r13
+  803194:	41 5e                	pop    %r14
+  803196:	41 5f                	pop    %r15
+  803198:	5d                   	pop    %rbp
+  803199:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80319a:	48 98                	cltq
+  80319c:	eb ed                	jmp    80318b <devfile_read+0x138>
+            return res;
+  80319e:	48 98                	cltq
+  8031a0:	eb e9                	jmp    80318b <devfile_read+0x138>
+            return i;
+  8031a2:	48 89 d8             	mov    %rbx,%rax
+  8031a5:	eb db                	jmp    803182 <devfile_read+0x12f>
+    size_t i = 0;
+  8031a7:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8031ab:	eb d2                	jmp    80317f <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8031ad:	48 89 c6             	mov    %rax,%rsi
+  8031b0:	4c 89 ff             	mov    %r15,%rdi
+  8031b3:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  8031ba:	00 00 00 
+  8031bd:	ff d0                	call   *%rax
+  8031bf:	85 c0                	test   %eax,%eax
+  8031c1:	78 40                	js     803203 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8031c3:	4c 89 ff             	mov    %r15,%rdi
+  8031c6:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  8031cd:	00 00 00 
+  8031d0:	ff d0                	call   *%rax
+  8031d2:	48 89 c2             	mov    %rax,%rdx
+  8031d5:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031d9:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8031dd:	48 c1 e0 0c          	shl    $0xc,%rax
+  8031e1:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8031e6:	48 01 d0             	add    %rdx,%rax
+  8031e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8031ed:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8031f2:	0f 84 33 01 00 00    	je     80332b <devfile_read+0x2d8>
+    size_t i = 0;
+  8031f8:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8031fe:	e9 f5 00 00 00       	jmp    8032f8 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803203:	48 98                	cltq
+  803205:	eb 84                	jmp    80318b <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803207:	44 89 e8             	mov    %r13d,%eax
+  80320a:	66 b8 00 00          	mov    $0x0,%ax
+  80320e:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803213:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80321a:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  80321c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803220:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803224:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803226:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80322b:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80322e:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803235:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803236:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80323c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803241:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803246:	bf 03 00 00 00       	mov    $0x3,%edi
+  80324b:	48 b8 1d 29 80 00 00 	movabs $0x80291d,%rax
+  803252:	00 00 00 
+  803255:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803257:	85 c0                	test   %eax,%eax
+  803259:	0f 88 be 00 00 00    	js     80331d <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80325f:	48 63 d0             	movslq %eax,%rdx
+  803262:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803267:	41 03 44 24 08       	add    0x8(%r12),%eax
+  80326c:	44 39 e8             	cmp    %r13d,%eax
+  80326f:	0f 8e ba 00 00 00    	jle    80332f <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803275:	49 63 c5             	movslq %r13d,%rax
+  803278:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  80327d:	48 29 c3             	sub    %rax,%rbx
+  803280:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803285:	48 01 c3             	add    %rax,%rbx
+  803288:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80328c:	4c 29 f0             	sub    %r14,%rax
+  80328f:	48 39 c3             	cmp    %rax,%rbx
+  803292:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803296:	4c 89 ff             	mov    %r15,%rdi
+  803299:	48 b9 c9 1f 80 00 00 	movabs $0x801fc9,%rcx
+  8032a0:	00 00 00 
+  8032a3:	ff d1                	call   *%rcx
+  8032a5:	48 89 c2             	mov    %rax,%rdx
+  8032a8:	48 c1 e2 04          	shl    $0x4,%rdx
+  8032ac:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8032b0:	48 c1 e0 0c          	shl    $0xc,%rax
+  8032b4:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8032b9:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8032bc:	44 89 ea             	mov    %r13d,%edx
+  8032bf:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8032c4:	48 63 d2             	movslq %edx,%rdx
+  8032c7:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8032ce:	00 
+  8032cf:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8032d3:	4c 01 f7             	add    %r14,%rdi
+  8032d6:	48 89 da             	mov    %rbx,%rdx
+  8032d9:	48 b9 7b 0f 80 00 00 	movabs $0x800f7b,%rcx
+  8032e0:	00 00 00 
+  8032e3:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8032e5:	41 01 dd             	add    %ebx,%r13d
+  8032e8:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8032ec:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8032ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032f3:	49 39 c6             	cmp    %rax,%r14
+  8032f6:	73 37                	jae    80332f <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8032f8:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8032fc:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803301:	44 39 e8             	cmp    %r13d,%eax
+  803304:	0f 8f fd fe ff ff    	jg     803207 <devfile_read+0x1b4>
+  80330a:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80330f:	44 39 e8             	cmp    %r13d,%eax
+  803312:	0f 8f 5d ff ff ff    	jg     803275 <devfile_read+0x222>
+  803318:	e9 ea fe ff ff       	jmp    803207 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80331d:	48 98                	cltq
+  80331f:	4d 85 f6             	test   %r14,%r14
+  803322:	49 0f 45 c6          	cmovne %r14,%rax
+  803326:	e9 60 fe ff ff       	jmp    80318b <devfile_read+0x138>
+    size_t i = 0;
+  80332b:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80332f:	4c 89 f0             	mov    %r14,%rax
+  803332:	e9 54 fe ff ff       	jmp    80318b <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803337:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80333e:	e9 48 fe ff ff       	jmp    80318b <devfile_read+0x138>
+
+0000000000803343 <open>:
+open(const char *path, int mode) {
+  803343:	55                   	push   %rbp
+  803344:	48 89 e5             	mov    %rsp,%rbp
+  803347:	41 55                	push   %r13
+  803349:	41 54                	push   %r12
+  80334b:	53                   	push   %rbx
+  80334c:	48 83 ec 18          	sub    $0x18,%rsp
+  803350:	49 89 fc             	mov    %rdi,%r12
+  803353:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803356:	48 b8 48 0b 80 00 00 	movabs $0x800b48,%rax
+  80335d:	00 00 00 
+  803360:	ff d0                	call   *%rax
+  803362:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803368:	0f 87 8a 00 00 00    	ja     8033f8 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80336e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803372:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  803379:	00 00 00 
+  80337c:	ff d0                	call   *%rax
+  80337e:	89 c3                	mov    %eax,%ebx
+  803380:	85 c0                	test   %eax,%eax
+  803382:	78 50                	js     8033d4 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803384:	4c 89 e6             	mov    %r12,%rsi
+  803387:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80338e:	00 00 00 
+  803391:	48 89 df             	mov    %rbx,%rdi
+  803394:	48 b8 86 0b 80 00 00 	movabs $0x800b86,%rax
+  80339b:	00 00 00 
+  80339e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8033a0:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8033a7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8033ab:	bf 01 00 00 00       	mov    $0x1,%edi
+  8033b0:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  8033b7:	00 00 00 
+  8033ba:	ff d0                	call   *%rax
+  8033bc:	89 c3                	mov    %eax,%ebx
+  8033be:	85 c0                	test   %eax,%eax
+  8033c0:	78 1f                	js     8033e1 <open+0x9e>
+    return fd2num(fd);
+  8033c2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033c6:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  8033cd:	00 00 00 
+  8033d0:	ff d0                	call   *%rax
+  8033d2:	89 c3                	mov    %eax,%ebx
+}
+  8033d4:	89 d8                	mov    %ebx,%eax
+  8033d6:	48 83 c4 18          	add    $0x18,%rsp
+  8033da:	5b                   	pop    %rbx
+  8033db:	41 5c                	pop    %r12
+  8033dd:	41 5d                	pop    %r13
+  8033df:	5d                   	pop    %rbp
+  8033e0:	c3                   	ret
+        fd_close(fd, 0);
+  8033e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8033e6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033ea:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  8033f1:	00 00 00 
+  8033f4:	ff d0                	call   *%rax
+        return res;
+  8033f6:	eb dc                	jmp    8033d4 <open+0x91>
+        return -E_BAD_PATH;
+  8033f8:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8033fd:	eb d5                	jmp    8033d4 <open+0x91>
+
+00000000008033ff <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8033ff:	55                   	push   %rbp
+  803400:	48 89 e5             	mov    %rsp,%rbp
+  803403:	41 57                	push   %r15
+  803405:	41 56                	push   %r14
+  803407:	41 55                	push   %r13
+  803409:	41 54                	push   %r12
+  80340b:	53                   	push   %rbx
+  80340c:	48 83 ec 18          	sub    $0x18,%rsp
+  803410:	41 89 f6             	mov    %esi,%r14d
+  803413:	49 89 d7             	mov    %rdx,%r15
+  803416:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803419:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80341d:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  803424:	00 00 00 
+  803427:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803429:	85 c0                	test   %eax,%eax
+  80342b:	0f 88 db 00 00 00    	js     80350c <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803431:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803435:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80343c:	00 00 00 
+  80343f:	8b 00                	mov    (%rax),%eax
+  803441:	39 07                	cmp    %eax,(%rdi)
+  803443:	0f 85 db 00 00 00    	jne    803524 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803449:	45 85 f6             	test   %r14d,%r14d
+  80344c:	0f 88 db 00 00 00    	js     80352d <fmap+0x12e>
+  803452:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803459:	0f 85 d7 00 00 00    	jne    803536 <fmap+0x137>
+  80345f:	4c 89 fb             	mov    %r15,%rbx
+  803462:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803468:	0f 85 d1 00 00 00    	jne    80353f <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80346e:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  803475:	00 00 00 
+  803478:	ff d0                	call   *%rax
+  80347a:	85 c0                	test   %eax,%eax
+  80347c:	0f 88 8e 00 00 00    	js     803510 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803482:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803489:	00 00 00 
+    while (i < n) {
+  80348c:	4d 85 ed             	test   %r13,%r13
+  80348f:	0f 84 8a 00 00 00    	je     80351f <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803495:	4c 89 ea             	mov    %r13,%rdx
+  803498:	48 29 da             	sub    %rbx,%rdx
+  80349b:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8034a2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8034a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8034ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034b0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034b3:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8034b7:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8034bb:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8034c0:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8034c5:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8034c9:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8034cd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034d2:	4c 89 e6             	mov    %r12,%rsi
+  8034d5:	bf 09 00 00 00       	mov    $0x9,%edi
+  8034da:	48 b8 1d 29 80 00 00 	movabs $0x80291d,%rax
+  8034e1:	00 00 00 
+  8034e4:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8034e6:	85 c0                	test   %eax,%eax
+  8034e8:	78 2a                	js     803514 <fmap+0x115>
+        i += res;
+  8034ea:	48 98                	cltq
+  8034ec:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8034ef:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8034f3:	72 05                	jb     8034fa <fmap+0xfb>
+    while (i < n) {
+  8034f5:	4c 39 eb             	cmp    %r13,%rbx
+  8034f8:	72 9b                	jb     803495 <fmap+0x96>
+    }
+    return i;
+  8034fa:	48 89 d8             	mov    %rbx,%rax
+}
+  8034fd:	48 83 c4 18          	add    $0x18,%rsp
+  803501:	5b                   	pop    %rbx
+  803502:	41 5c                	pop    %r12
+  803504:	41 5d                	pop    %r13
+  803506:	41 5e                	pop    %r14
+  803508:	41 5f                	pop    %r15
+  80350a:	5d                   	pop    %rbp
+  80350b:	c3                   	ret
+    if (res < 0) return res;
+  80350c:	48 98                	cltq
+  80350e:	eb ed                	jmp    8034fd <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803510:	48 98                	cltq
+  803512:	eb e9                	jmp    8034fd <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803514:	48 98                	cltq
+  803516:	48 85 db             	test   %rbx,%rbx
+  803519:	48 0f 45 c3          	cmovne %rbx,%rax
+  80351d:	eb de                	jmp    8034fd <fmap+0xfe>
+    size_t i = 0;
+  80351f:	4c 89 eb             	mov    %r13,%rbx
+  803522:	eb d6                	jmp    8034fa <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803524:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80352b:	eb d0                	jmp    8034fd <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80352d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803534:	eb c7                	jmp    8034fd <fmap+0xfe>
+  803536:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80353d:	eb be                	jmp    8034fd <fmap+0xfe>
+  80353f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803546:	eb b5                	jmp    8034fd <fmap+0xfe>
+
+0000000000803548 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803548:	55                   	push   %rbp
+  803549:	48 89 e5             	mov    %rsp,%rbp
+  80354c:	41 56                	push   %r14
+  80354e:	41 55                	push   %r13
+  803550:	41 54                	push   %r12
+  803552:	53                   	push   %rbx
+  803553:	48 83 ec 10          	sub    $0x10,%rsp
+  803557:	89 fb                	mov    %edi,%ebx
+  803559:	41 89 f4             	mov    %esi,%r12d
+  80355c:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80355f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803563:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  80356a:	00 00 00 
+  80356d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80356f:	85 c0                	test   %eax,%eax
+  803571:	78 63                	js     8035d6 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803573:	45 85 e4             	test   %r12d,%r12d
+  803576:	0f 88 80 00 00 00    	js     8035fc <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80357c:	45 89 e6             	mov    %r12d,%r14d
+  80357f:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803586:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80358a:	48 b8 db 1f 80 00 00 	movabs $0x801fdb,%rax
+  803591:	00 00 00 
+  803594:	ff d0                	call   *%rax
+  803596:	48 89 c2             	mov    %rax,%rdx
+  803599:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80359e:	44 89 f6             	mov    %r14d,%esi
+  8035a1:	89 df                	mov    %ebx,%edi
+  8035a3:	48 b8 ff 33 80 00 00 	movabs $0x8033ff,%rax
+  8035aa:	00 00 00 
+  8035ad:	ff d0                	call   *%rax
+  8035af:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8035b2:	45 29 f4             	sub    %r14d,%r12d
+  8035b5:	4d 63 f4             	movslq %r12d,%r14
+  8035b8:	49 39 c6             	cmp    %rax,%r14
+  8035bb:	7c 1d                	jl     8035da <read_map+0x92>
+  8035bd:	48 85 c0             	test   %rax,%rax
+  8035c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c5:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8035c9:	48 83 c4 10          	add    $0x10,%rsp
+  8035cd:	5b                   	pop    %rbx
+  8035ce:	41 5c                	pop    %r12
+  8035d0:	41 5d                	pop    %r13
+  8035d2:	41 5e                	pop    %r14
+  8035d4:	5d                   	pop    %rbp
+  8035d5:	c3                   	ret
+    if (res < 0) return res;
+  8035d6:	48 98                	cltq
+  8035d8:	eb ef                	jmp    8035c9 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8035da:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035de:	48 b8 db 1f 80 00 00 	movabs $0x801fdb,%rax
+  8035e5:	00 00 00 
+  8035e8:	ff d0                	call   *%rax
+  8035ea:	4d 63 e4             	movslq %r12d,%r12
+  8035ed:	4c 01 e0             	add    %r12,%rax
+  8035f0:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8035f4:	48 89 d8             	mov    %rbx,%rax
+  8035f7:	4c 29 f0             	sub    %r14,%rax
+  8035fa:	eb cd                	jmp    8035c9 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8035fc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803603:	eb c4                	jmp    8035c9 <read_map+0x81>
+
+0000000000803605 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803605:	55                   	push   %rbp
+  803606:	48 89 e5             	mov    %rsp,%rbp
+  803609:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80360d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803611:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  803618:	00 00 00 
+  80361b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80361d:	85 c0                	test   %eax,%eax
+  80361f:	78 4a                	js     80366b <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803621:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803625:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80362c:	00 00 00 
+  80362f:	8b 00                	mov    (%rax),%eax
+  803631:	39 07                	cmp    %eax,(%rdi)
+  803633:	75 38                	jne    80366d <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803635:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  80363c:	00 00 00 
+  80363f:	ff d0                	call   *%rax
+  803641:	85 c0                	test   %eax,%eax
+  803643:	78 26                	js     80366b <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803645:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803649:	8b 40 0c             	mov    0xc(%rax),%eax
+  80364c:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803653:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803655:	be 00 00 00 00       	mov    $0x0,%esi
+  80365a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80365f:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  803666:	00 00 00 
+  803669:	ff d0                	call   *%rax
+}
+  80366b:	c9                   	leave
+  80366c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80366d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803672:	eb f7                	jmp    80366b <fsync+0x66>
+
+0000000000803674 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803674:	55                   	push   %rbp
+  803675:	48 89 e5             	mov    %rsp,%rbp
+  803678:	41 57                	push   %r15
+  80367a:	41 56                	push   %r14
+  80367c:	41 55                	push   %r13
+  80367e:	41 54                	push   %r12
+  803680:	53                   	push   %rbx
+  803681:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803685:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80368c:	00 00 00 
+  80368f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803694:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80369a:	49 bd 57 20 80 00 00 	movabs $0x802057,%r13
+  8036a1:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8036a4:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8036ab:	00 00 00 
+  8036ae:	eb 0c                	jmp    8036bc <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8036b0:	83 c3 01             	add    $0x1,%ebx
+  8036b3:	49 83 c4 28          	add    $0x28,%r12
+  8036b7:	83 fb 20             	cmp    $0x20,%ebx
+  8036ba:	74 33                	je     8036ef <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8036bc:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8036c1:	74 ed                	je     8036b0 <flushall+0x3c>
+  8036c3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8036c7:	89 df                	mov    %ebx,%edi
+  8036c9:	41 ff d5             	call   *%r13
+  8036cc:	85 c0                	test   %eax,%eax
+  8036ce:	78 e0                	js     8036b0 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8036d0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8036d4:	41 8b 06             	mov    (%r14),%eax
+  8036d7:	39 07                	cmp    %eax,(%rdi)
+  8036d9:	75 d5                	jne    8036b0 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8036db:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  8036e2:	00 00 00 
+  8036e5:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8036e7:	85 c0                	test   %eax,%eax
+  8036e9:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8036ed:	eb c1                	jmp    8036b0 <flushall+0x3c>
+    }
+    return res;
+}
+  8036ef:	44 89 f8             	mov    %r15d,%eax
+  8036f2:	48 83 c4 18          	add    $0x18,%rsp
+  8036f6:	5b                   	pop    %rbx
+  8036f7:	41 5c                	pop    %r12
+  8036f9:	41 5d                	pop    %r13
+  8036fb:	41 5e                	pop    %r14
+  8036fd:	41 5f                	pop    %r15
+  8036ff:	5d                   	pop    %rbp
+  803700:	c3                   	ret
+
+0000000000803701 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803701:	55                   	push   %rbp
+  803702:	48 89 e5             	mov    %rsp,%rbp
+  803705:	53                   	push   %rbx
+  803706:	48 83 ec 08          	sub    $0x8,%rsp
+  80370a:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80370d:	40 0f b6 c6          	movzbl %sil,%eax
+  803711:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803718:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  80371a:	be 00 00 00 00       	mov    $0x0,%esi
+  80371f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803724:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  80372b:	00 00 00 
+  80372e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803730:	85 c0                	test   %eax,%eax
+  803732:	78 23                	js     803757 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803734:	ba 58 06 00 00       	mov    $0x658,%edx
+  803739:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803740:	00 00 00 
+  803743:	48 89 df             	mov    %rbx,%rdi
+  803746:	48 b8 7b 0f 80 00 00 	movabs $0x800f7b,%rax
+  80374d:	00 00 00 
+  803750:	ff d0                	call   *%rax
+    return 0;
+  803752:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803757:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80375b:	c9                   	leave
+  80375c:	c3                   	ret
+
+000000000080375d <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80375d:	55                   	push   %rbp
+  80375e:	48 89 e5             	mov    %rsp,%rbp
+  803761:	53                   	push   %rbx
+  803762:	48 83 ec 08          	sub    $0x8,%rsp
+  803766:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803769:	48 b8 48 0b 80 00 00 	movabs $0x800b48,%rax
+  803770:	00 00 00 
+  803773:	ff d0                	call   *%rax
+  803775:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80377b:	77 35                	ja     8037b2 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80377d:	48 89 de             	mov    %rbx,%rsi
+  803780:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803787:	00 00 00 
+  80378a:	48 b8 86 0b 80 00 00 	movabs $0x800b86,%rax
+  803791:	00 00 00 
+  803794:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803796:	be 00 00 00 00       	mov    $0x0,%esi
+  80379b:	bf 07 00 00 00       	mov    $0x7,%edi
+  8037a0:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  8037a7:	00 00 00 
+  8037aa:	ff d0                	call   *%rax
+}
+  8037ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037b0:	c9                   	leave
+  8037b1:	c3                   	ret
+        return -E_BAD_PATH;
+  8037b2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8037b7:	eb f3                	jmp    8037ac <remove+0x4f>
+
+00000000008037b9 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8037b9:	55                   	push   %rbp
+  8037ba:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8037bd:	48 b8 74 36 80 00 00 	movabs $0x803674,%rax
+  8037c4:	00 00 00 
+  8037c7:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8037c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ce:	bf 08 00 00 00       	mov    $0x8,%edi
+  8037d3:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  8037da:	00 00 00 
+  8037dd:	ff d0                	call   *%rax
+}
+  8037df:	5d                   	pop    %rbp
+  8037e0:	c3                   	ret
+
+00000000008037e1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8037e1:	55                   	push   %rbp
+  8037e2:	48 89 e5             	mov    %rsp,%rbp
+  8037e5:	41 54                	push   %r12
+  8037e7:	53                   	push   %rbx
+  8037e8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037eb:	48 b8 db 1f 80 00 00 	movabs $0x801fdb,%rax
+  8037f2:	00 00 00 
+  8037f5:	ff d0                	call   *%rax
+  8037f7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8037fa:	48 be 20 57 80 00 00 	movabs $0x805720,%rsi
+  803801:	00 00 00 
+  803804:	48 89 df             	mov    %rbx,%rdi
+  803807:	48 b8 86 0b 80 00 00 	movabs $0x800b86,%rax
+  80380e:	00 00 00 
+  803811:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803813:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803818:	41 2b 04 24          	sub    (%r12),%eax
+  80381c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803822:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803829:	00 00 00 
+    stat->st_dev = &devpipe;
+  80382c:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803833:	00 00 00 
+  803836:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80383d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803842:	5b                   	pop    %rbx
+  803843:	41 5c                	pop    %r12
+  803845:	5d                   	pop    %rbp
+  803846:	c3                   	ret
+
+0000000000803847 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803847:	55                   	push   %rbp
+  803848:	48 89 e5             	mov    %rsp,%rbp
+  80384b:	41 54                	push   %r12
+  80384d:	53                   	push   %rbx
+  80384e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803851:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803856:	48 89 fe             	mov    %rdi,%rsi
+  803859:	bf 00 00 00 00       	mov    $0x0,%edi
+  80385e:	49 bc c5 14 80 00 00 	movabs $0x8014c5,%r12
+  803865:	00 00 00 
+  803868:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80386b:	48 89 df             	mov    %rbx,%rdi
+  80386e:	48 b8 db 1f 80 00 00 	movabs $0x801fdb,%rax
+  803875:	00 00 00 
+  803878:	ff d0                	call   *%rax
+  80387a:	48 89 c6             	mov    %rax,%rsi
+  80387d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803882:	bf 00 00 00 00       	mov    $0x0,%edi
+  803887:	41 ff d4             	call   *%r12
+}
+  80388a:	5b                   	pop    %rbx
+  80388b:	41 5c                	pop    %r12
+  80388d:	5d                   	pop    %rbp
+  80388e:	c3                   	ret
+
+000000000080388f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80388f:	55                   	push   %rbp
+  803890:	48 89 e5             	mov    %rsp,%rbp
+  803893:	41 57                	push   %r15
+  803895:	41 56                	push   %r14
+  803897:	41 55                	push   %r13
+  803899:	41 54                	push   %r12
+  80389b:	53                   	push   %rbx
+  80389c:	48 83 ec 18          	sub    $0x18,%rsp
+  8038a0:	49 89 fc             	mov    %rdi,%r12
+  8038a3:	49 89 f5             	mov    %rsi,%r13
+  8038a6:	49 89 d7             	mov    %rdx,%r15
+  8038a9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038ad:	48 b8 db 1f 80 00 00 	movabs $0x801fdb,%rax
+  8038b4:	00 00 00 
+  8038b7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8038b9:	4d 85 ff             	test   %r15,%r15
+  8038bc:	0f 84 af 00 00 00    	je     803971 <devpipe_write+0xe2>
+  8038c2:	48 89 c3             	mov    %rax,%rbx
+  8038c5:	4c 89 f8             	mov    %r15,%rax
+  8038c8:	4d 89 ef             	mov    %r13,%r15
+  8038cb:	4c 01 e8             	add    %r13,%rax
+  8038ce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8038d2:	49 bd ba 12 80 00 00 	movabs $0x8012ba,%r13
+  8038d9:	00 00 00 
+            sys_yield();
+  8038dc:	49 be 57 12 80 00 00 	movabs $0x801257,%r14
+  8038e3:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8038e6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8038e9:	48 63 ce             	movslq %esi,%rcx
+  8038ec:	48 63 03             	movslq (%rbx),%rax
+  8038ef:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8038f5:	48 39 c1             	cmp    %rax,%rcx
+  8038f8:	72 2e                	jb     803928 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8038fa:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8038ff:	48 89 da             	mov    %rbx,%rdx
+  803902:	be 00 10 00 00       	mov    $0x1000,%esi
+  803907:	4c 89 e7             	mov    %r12,%rdi
+  80390a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80390d:	85 c0                	test   %eax,%eax
+  80390f:	74 66                	je     803977 <devpipe_write+0xe8>
+            sys_yield();
+  803911:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803914:	8b 73 04             	mov    0x4(%rbx),%esi
+  803917:	48 63 ce             	movslq %esi,%rcx
+  80391a:	48 63 03             	movslq (%rbx),%rax
+  80391d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803923:	48 39 c1             	cmp    %rax,%rcx
+  803926:	73 d2                	jae    8038fa <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803928:	41 0f b6 3f          	movzbl (%r15),%edi
+  80392c:	48 89 ca             	mov    %rcx,%rdx
+  80392f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803933:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80393a:	08 10 20 
+  80393d:	48 f7 e2             	mul    %rdx
+  803940:	48 c1 ea 06          	shr    $0x6,%rdx
+  803944:	48 89 d0             	mov    %rdx,%rax
+  803947:	48 c1 e0 09          	shl    $0x9,%rax
+  80394b:	48 29 d0             	sub    %rdx,%rax
+  80394e:	48 c1 e0 03          	shl    $0x3,%rax
+  803952:	48 29 c1             	sub    %rax,%rcx
+  803955:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80395a:	83 c6 01             	add    $0x1,%esi
+  80395d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803960:	49 83 c7 01          	add    $0x1,%r15
+  803964:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803968:	49 39 c7             	cmp    %rax,%r15
+  80396b:	0f 85 75 ff ff ff    	jne    8038e6 <devpipe_write+0x57>
+    return n;
+  803971:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803975:	eb 05                	jmp    80397c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803977:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80397c:	48 83 c4 18          	add    $0x18,%rsp
+  803980:	5b                   	pop    %rbx
+  803981:	41 5c                	pop    %r12
+  803983:	41 5d                	pop    %r13
+  803985:	41 5e                	pop    %r14
+  803987:	41 5f                	pop    %r15
+  803989:	5d                   	pop    %rbp
+  80398a:	c3                   	ret
+
+000000000080398b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80398b:	55                   	push   %rbp
+  80398c:	48 89 e5             	mov    %rsp,%rbp
+  80398f:	41 57                	push   %r15
+  803991:	41 56                	push   %r14
+  803993:	41 55                	push   %r13
+  803995:	41 54                	push   %r12
+  803997:	53                   	push   %rbx
+  803998:	48 83 ec 18          	sub    $0x18,%rsp
+  80399c:	49 89 fc             	mov    %rdi,%r12
+  80399f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8039a3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039a7:	48 b8 db 1f 80 00 00 	movabs $0x801fdb,%rax
+  8039ae:	00 00 00 
+  8039b1:	ff d0                	call   *%rax
+  8039b3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8039b6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039bc:	49 bd ba 12 80 00 00 	movabs $0x8012ba,%r13
+  8039c3:	00 00 00 
+            sys_yield();
+  8039c6:	49 be 57 12 80 00 00 	movabs $0x801257,%r14
+  8039cd:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8039d0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8039d5:	74 7d                	je     803a54 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8039d7:	8b 03                	mov    (%rbx),%eax
+  8039d9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8039dc:	75 26                	jne    803a04 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8039de:	4d 85 ff             	test   %r15,%r15
+  8039e1:	75 77                	jne    803a5a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039e3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039e8:	48 89 da             	mov    %rbx,%rdx
+  8039eb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039f0:	4c 89 e7             	mov    %r12,%rdi
+  8039f3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8039f6:	85 c0                	test   %eax,%eax
+  8039f8:	74 72                	je     803a6c <devpipe_read+0xe1>
+            sys_yield();
+  8039fa:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8039fd:	8b 03                	mov    (%rbx),%eax
+  8039ff:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803a02:	74 df                	je     8039e3 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a04:	48 63 c8             	movslq %eax,%rcx
+  803a07:	48 89 ca             	mov    %rcx,%rdx
+  803a0a:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a0e:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803a15:	08 10 20 
+  803a18:	48 89 d0             	mov    %rdx,%rax
+  803a1b:	48 f7 e6             	mul    %rsi
+  803a1e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a22:	48 89 d0             	mov    %rdx,%rax
+  803a25:	48 c1 e0 09          	shl    $0x9,%rax
+  803a29:	48 29 d0             	sub    %rdx,%rax
+  803a2c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803a33:	00 
+  803a34:	48 89 c8             	mov    %rcx,%rax
+  803a37:	48 29 d0             	sub    %rdx,%rax
+  803a3a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803a3f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803a43:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803a47:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a4a:	49 83 c7 01          	add    $0x1,%r15
+  803a4e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803a52:	75 83                	jne    8039d7 <devpipe_read+0x4c>
+    return n;
+  803a54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a58:	eb 03                	jmp    803a5d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803a5a:	4c 89 f8             	mov    %r15,%rax
+}
+  803a5d:	48 83 c4 18          	add    $0x18,%rsp
+  803a61:	5b                   	pop    %rbx
+  803a62:	41 5c                	pop    %r12
+  803a64:	41 5d                	pop    %r13
+  803a66:	41 5e                	pop    %r14
+  803a68:	41 5f                	pop    %r15
+  803a6a:	5d                   	pop    %rbp
+  803a6b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a71:	eb ea                	jmp    803a5d <devpipe_read+0xd2>
+
+0000000000803a73 <pipe>:
+pipe(int pfd[2]) {
+  803a73:	55                   	push   %rbp
+  803a74:	48 89 e5             	mov    %rsp,%rbp
+  803a77:	41 55                	push   %r13
+  803a79:	41 54                	push   %r12
+  803a7b:	53                   	push   %rbx
+  803a7c:	48 83 ec 18          	sub    $0x18,%rsp
+  803a80:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803a83:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803a87:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  803a8e:	00 00 00 
+  803a91:	ff d0                	call   *%rax
+  803a93:	89 c3                	mov    %eax,%ebx
+  803a95:	85 c0                	test   %eax,%eax
+  803a97:	0f 88 a0 01 00 00    	js     803c3d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803a9d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803aa2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aa7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803aab:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ab0:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  803ab7:	00 00 00 
+  803aba:	ff d0                	call   *%rax
+  803abc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803abe:	85 c0                	test   %eax,%eax
+  803ac0:	0f 88 77 01 00 00    	js     803c3d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ac6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803aca:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  803ad1:	00 00 00 
+  803ad4:	ff d0                	call   *%rax
+  803ad6:	89 c3                	mov    %eax,%ebx
+  803ad8:	85 c0                	test   %eax,%eax
+  803ada:	0f 88 43 01 00 00    	js     803c23 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803ae0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ae5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aea:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803aee:	bf 00 00 00 00       	mov    $0x0,%edi
+  803af3:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  803afa:	00 00 00 
+  803afd:	ff d0                	call   *%rax
+  803aff:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b01:	85 c0                	test   %eax,%eax
+  803b03:	0f 88 1a 01 00 00    	js     803c23 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803b09:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b0d:	48 b8 db 1f 80 00 00 	movabs $0x801fdb,%rax
+  803b14:	00 00 00 
+  803b17:	ff d0                	call   *%rax
+  803b19:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803b1c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b21:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b26:	48 89 c6             	mov    %rax,%rsi
+  803b29:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b2e:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  803b35:	00 00 00 
+  803b38:	ff d0                	call   *%rax
+  803b3a:	89 c3                	mov    %eax,%ebx
+  803b3c:	85 c0                	test   %eax,%eax
+  803b3e:	0f 88 c5 00 00 00    	js     803c09 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803b44:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803b48:	48 b8 db 1f 80 00 00 	movabs $0x801fdb,%rax
+  803b4f:	00 00 00 
+  803b52:	ff d0                	call   *%rax
+  803b54:	48 89 c1             	mov    %rax,%rcx
+  803b57:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803b5d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803b63:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b68:	4c 89 ee             	mov    %r13,%rsi
+  803b6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b70:	48 b8 4d 13 80 00 00 	movabs $0x80134d,%rax
+  803b77:	00 00 00 
+  803b7a:	ff d0                	call   *%rax
+  803b7c:	89 c3                	mov    %eax,%ebx
+  803b7e:	85 c0                	test   %eax,%eax
+  803b80:	78 6e                	js     803bf0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b82:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b87:	4c 89 ef             	mov    %r13,%rdi
+  803b8a:	48 b8 88 12 80 00 00 	movabs $0x801288,%rax
+  803b91:	00 00 00 
+  803b94:	ff d0                	call   *%rax
+  803b96:	83 f8 02             	cmp    $0x2,%eax
+  803b99:	0f 85 ab 00 00 00    	jne    803c4a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803b9f:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803ba6:	00 00 
+  803ba8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803bac:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803bae:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803bb2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803bb9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803bbd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803bbf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bc3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803bca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803bce:	48 bb c9 1f 80 00 00 	movabs $0x801fc9,%rbx
+  803bd5:	00 00 00 
+  803bd8:	ff d3                	call   *%rbx
+  803bda:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803bde:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803be2:	ff d3                	call   *%rbx
+  803be4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803be9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bee:	eb 4d                	jmp    803c3d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803bf0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bf5:	4c 89 ee             	mov    %r13,%rsi
+  803bf8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bfd:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  803c04:	00 00 00 
+  803c07:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803c09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c0e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c12:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c17:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  803c1e:	00 00 00 
+  803c21:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803c23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c28:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c31:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  803c38:	00 00 00 
+  803c3b:	ff d0                	call   *%rax
+}
+  803c3d:	89 d8                	mov    %ebx,%eax
+  803c3f:	48 83 c4 18          	add    $0x18,%rsp
+  803c43:	5b                   	pop    %rbx
+  803c44:	41 5c                	pop    %r12
+  803c46:	41 5d                	pop    %r13
+  803c48:	5d                   	pop    %rbp
+  803c49:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c4a:	48 b9 38 57 80 00 00 	movabs $0x805738,%rcx
+  803c51:	00 00 00 
+  803c54:	48 ba 58 56 80 00 00 	movabs $0x805658,%rdx
+  803c5b:	00 00 00 
+  803c5e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803c63:	48 bf 27 57 80 00 00 	movabs $0x805727,%rdi
+  803c6a:	00 00 00 
+  803c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c72:	49 b8 52 42 80 00 00 	movabs $0x804252,%r8
+  803c79:	00 00 00 
+  803c7c:	41 ff d0             	call   *%r8
+
+0000000000803c7f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803c7f:	55                   	push   %rbp
+  803c80:	48 89 e5             	mov    %rsp,%rbp
+  803c83:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803c87:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803c8b:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  803c92:	00 00 00 
+  803c95:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c97:	85 c0                	test   %eax,%eax
+  803c99:	78 35                	js     803cd0 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803c9b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c9f:	48 b8 db 1f 80 00 00 	movabs $0x801fdb,%rax
+  803ca6:	00 00 00 
+  803ca9:	ff d0                	call   *%rax
+  803cab:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803cae:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803cb3:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cb8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803cbc:	48 b8 ba 12 80 00 00 	movabs $0x8012ba,%rax
+  803cc3:	00 00 00 
+  803cc6:	ff d0                	call   *%rax
+  803cc8:	85 c0                	test   %eax,%eax
+  803cca:	0f 94 c0             	sete   %al
+  803ccd:	0f b6 c0             	movzbl %al,%eax
+}
+  803cd0:	c9                   	leave
+  803cd1:	c3                   	ret
+
+0000000000803cd2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803cd2:	48 89 f8             	mov    %rdi,%rax
+  803cd5:	48 c1 e8 27          	shr    $0x27,%rax
+  803cd9:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803ce0:	7f 00 00 
+  803ce3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ce7:	f6 c2 01             	test   $0x1,%dl
+  803cea:	74 6d                	je     803d59 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803cec:	48 89 f8             	mov    %rdi,%rax
+  803cef:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803cf3:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803cfa:	7f 00 00 
+  803cfd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d01:	f6 c2 01             	test   $0x1,%dl
+  803d04:	74 62                	je     803d68 <get_uvpt_entry+0x96>
+  803d06:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d0d:	7f 00 00 
+  803d10:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d14:	f6 c2 80             	test   $0x80,%dl
+  803d17:	75 4f                	jne    803d68 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d19:	48 89 f8             	mov    %rdi,%rax
+  803d1c:	48 c1 e8 15          	shr    $0x15,%rax
+  803d20:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d27:	7f 00 00 
+  803d2a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d2e:	f6 c2 01             	test   $0x1,%dl
+  803d31:	74 44                	je     803d77 <get_uvpt_entry+0xa5>
+  803d33:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d3a:	7f 00 00 
+  803d3d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d41:	f6 c2 80             	test   $0x80,%dl
+  803d44:	75 31                	jne    803d77 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803d46:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803d4a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d51:	7f 00 00 
+  803d54:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803d58:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d59:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803d60:	7f 00 00 
+  803d63:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d67:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d68:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d6f:	7f 00 00 
+  803d72:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d76:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d77:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d7e:	7f 00 00 
+  803d81:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d85:	c3                   	ret
+
+0000000000803d86 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803d86:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803d89:	48 89 f9             	mov    %rdi,%rcx
+  803d8c:	48 c1 e9 27          	shr    $0x27,%rcx
+  803d90:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803d97:	7f 00 00 
+  803d9a:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803d9e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803da5:	f6 c1 01             	test   $0x1,%cl
+  803da8:	0f 84 b2 00 00 00    	je     803e60 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803dae:	48 89 f9             	mov    %rdi,%rcx
+  803db1:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803db5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803dbc:	7f 00 00 
+  803dbf:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803dc3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803dca:	40 f6 c6 01          	test   $0x1,%sil
+  803dce:	0f 84 8c 00 00 00    	je     803e60 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803dd4:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ddb:	7f 00 00 
+  803dde:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803de2:	a8 80                	test   $0x80,%al
+  803de4:	75 7b                	jne    803e61 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803de6:	48 89 f9             	mov    %rdi,%rcx
+  803de9:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ded:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803df4:	7f 00 00 
+  803df7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803dfb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803e02:	40 f6 c6 01          	test   $0x1,%sil
+  803e06:	74 58                	je     803e60 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803e08:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e0f:	7f 00 00 
+  803e12:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e16:	a8 80                	test   $0x80,%al
+  803e18:	75 6c                	jne    803e86 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e1a:	48 89 f9             	mov    %rdi,%rcx
+  803e1d:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803e21:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e28:	7f 00 00 
+  803e2b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803e2f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803e36:	40 f6 c6 01          	test   $0x1,%sil
+  803e3a:	74 24                	je     803e60 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803e3c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e43:	7f 00 00 
+  803e46:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e4a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e51:	ff ff 7f 
+  803e54:	48 21 c8             	and    %rcx,%rax
+  803e57:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803e5d:	48 09 d0             	or     %rdx,%rax
+}
+  803e60:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803e61:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803e68:	7f 00 00 
+  803e6b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e6f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e76:	ff ff 7f 
+  803e79:	48 21 c8             	and    %rcx,%rax
+  803e7c:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803e82:	48 01 d0             	add    %rdx,%rax
+  803e85:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803e86:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e8d:	7f 00 00 
+  803e90:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e94:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e9b:	ff ff 7f 
+  803e9e:	48 21 c8             	and    %rcx,%rax
+  803ea1:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803ea7:	48 01 d0             	add    %rdx,%rax
+  803eaa:	c3                   	ret
+
+0000000000803eab <get_prot>:
+
+int
+get_prot(void *va) {
+  803eab:	55                   	push   %rbp
+  803eac:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803eaf:	48 b8 d2 3c 80 00 00 	movabs $0x803cd2,%rax
+  803eb6:	00 00 00 
+  803eb9:	ff d0                	call   *%rax
+  803ebb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803ebe:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803ec3:	89 c1                	mov    %eax,%ecx
+  803ec5:	83 c9 04             	or     $0x4,%ecx
+  803ec8:	f6 c2 01             	test   $0x1,%dl
+  803ecb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803ece:	89 c1                	mov    %eax,%ecx
+  803ed0:	83 c9 02             	or     $0x2,%ecx
+  803ed3:	f6 c2 02             	test   $0x2,%dl
+  803ed6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803ed9:	89 c1                	mov    %eax,%ecx
+  803edb:	83 c9 01             	or     $0x1,%ecx
+  803ede:	48 85 d2             	test   %rdx,%rdx
+  803ee1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803ee4:	89 c1                	mov    %eax,%ecx
+  803ee6:	83 c9 40             	or     $0x40,%ecx
+  803ee9:	f6 c6 04             	test   $0x4,%dh
+  803eec:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803eef:	5d                   	pop    %rbp
+  803ef0:	c3                   	ret
+
+0000000000803ef1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803ef1:	55                   	push   %rbp
+  803ef2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ef5:	48 b8 d2 3c 80 00 00 	movabs $0x803cd2,%rax
+  803efc:	00 00 00 
+  803eff:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803f01:	48 c1 e8 06          	shr    $0x6,%rax
+  803f05:	83 e0 01             	and    $0x1,%eax
+}
+  803f08:	5d                   	pop    %rbp
+  803f09:	c3                   	ret
+
+0000000000803f0a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803f0a:	55                   	push   %rbp
+  803f0b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803f0e:	48 b8 d2 3c 80 00 00 	movabs $0x803cd2,%rax
+  803f15:	00 00 00 
+  803f18:	ff d0                	call   *%rax
+  803f1a:	83 e0 01             	and    $0x1,%eax
+}
+  803f1d:	5d                   	pop    %rbp
+  803f1e:	c3                   	ret
+
+0000000000803f1f <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803f1f:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803f26:	7f 00 00 
+  803f29:	a8 01                	test   $0x1,%al
+  803f2b:	75 06                	jne    803f33 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f32:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803f33:	55                   	push   %rbp
+  803f34:	48 89 e5             	mov    %rsp,%rbp
+  803f37:	41 57                	push   %r15
+  803f39:	41 56                	push   %r14
+  803f3b:	41 55                	push   %r13
+  803f3d:	41 54                	push   %r12
+  803f3f:	53                   	push   %rbx
+  803f40:	48 83 ec 18          	sub    $0x18,%rsp
+  803f44:	49 89 fe             	mov    %rdi,%r14
+  803f47:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803f4a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803f51:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803f52:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803f59:	7f 00 00 
+  803f5c:	e9 81 00 00 00       	jmp    803fe2 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803f61:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803f68:	49 39 dd             	cmp    %rbx,%r13
+  803f6b:	74 2b                	je     803f98 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803f6d:	48 89 d8             	mov    %rbx,%rax
+  803f70:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f74:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803f78:	f6 c2 01             	test   $0x1,%dl
+  803f7b:	74 e4                	je     803f61 <foreach_shared_region+0x42>
+  803f7d:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803f81:	f6 c4 04             	test   $0x4,%ah
+  803f84:	74 db                	je     803f61 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803f86:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803f8d:	4c 89 fa             	mov    %r15,%rdx
+  803f90:	48 89 df             	mov    %rbx,%rdi
+  803f93:	41 ff d6             	call   *%r14
+  803f96:	eb c9                	jmp    803f61 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803f98:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803f9f:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803fa3:	74 22                	je     803fc7 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803fa5:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803fac:	48 89 d8             	mov    %rbx,%rax
+  803faf:	48 c1 e8 15          	shr    $0x15,%rax
+  803fb3:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803fba:	7f 00 00 
+  803fbd:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803fc1:	a8 01                	test   $0x1,%al
+  803fc3:	74 d3                	je     803f98 <foreach_shared_region+0x79>
+  803fc5:	eb a6                	jmp    803f6d <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803fc7:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803fce:	40 
+  803fcf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803fd3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fda:	00 00 00 
+  803fdd:	48 39 c1             	cmp    %rax,%rcx
+  803fe0:	74 31                	je     804013 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803fe2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fe6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803fea:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803ff1:	7f 00 00 
+  803ff4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803ff8:	a8 01                	test   $0x1,%al
+  803ffa:	74 cb                	je     803fc7 <foreach_shared_region+0xa8>
+  803ffc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804000:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804007:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  80400d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804011:	eb 92                	jmp    803fa5 <foreach_shared_region+0x86>
+}
+  804013:	b8 00 00 00 00       	mov    $0x0,%eax
+  804018:	48 83 c4 18          	add    $0x18,%rsp
+  80401c:	5b                   	pop    %rbx
+  80401d:	41 5c                	pop    %r12
+  80401f:	41 5d                	pop    %r13
+  804021:	41 5e                	pop    %r14
+  804023:	41 5f                	pop    %r15
+  804025:	5d                   	pop    %rbp
+  804026:	c3                   	ret
+
+0000000000804027 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804027:	b8 00 00 00 00       	mov    $0x0,%eax
+  80402c:	c3                   	ret
+
+000000000080402d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80402d:	55                   	push   %rbp
+  80402e:	48 89 e5             	mov    %rsp,%rbp
+  804031:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804034:	48 be 5c 57 80 00 00 	movabs $0x80575c,%rsi
+  80403b:	00 00 00 
+  80403e:	48 b8 86 0b 80 00 00 	movabs $0x800b86,%rax
+  804045:	00 00 00 
+  804048:	ff d0                	call   *%rax
+    return 0;
+}
+  80404a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80404f:	5d                   	pop    %rbp
+  804050:	c3                   	ret
+
+0000000000804051 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804051:	55                   	push   %rbp
+  804052:	48 89 e5             	mov    %rsp,%rbp
+  804055:	41 57                	push   %r15
+  804057:	41 56                	push   %r14
+  804059:	41 55                	push   %r13
+  80405b:	41 54                	push   %r12
+  80405d:	53                   	push   %rbx
+  80405e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804065:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80406c:	48 85 d2             	test   %rdx,%rdx
+  80406f:	74 7a                	je     8040eb <devcons_write+0x9a>
+  804071:	49 89 d6             	mov    %rdx,%r14
+  804074:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80407a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80407f:	49 bf 14 0f 80 00 00 	movabs $0x800f14,%r15
+  804086:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804089:	4c 89 f3             	mov    %r14,%rbx
+  80408c:	48 29 f3             	sub    %rsi,%rbx
+  80408f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804094:	48 39 c3             	cmp    %rax,%rbx
+  804097:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80409b:	4c 63 eb             	movslq %ebx,%r13
+  80409e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8040a5:	48 01 c6             	add    %rax,%rsi
+  8040a8:	4c 89 ea             	mov    %r13,%rdx
+  8040ab:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8040b2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8040b5:	4c 89 ee             	mov    %r13,%rsi
+  8040b8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8040bf:	48 b8 5d 11 80 00 00 	movabs $0x80115d,%rax
+  8040c6:	00 00 00 
+  8040c9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8040cb:	41 01 dc             	add    %ebx,%r12d
+  8040ce:	49 63 f4             	movslq %r12d,%rsi
+  8040d1:	4c 39 f6             	cmp    %r14,%rsi
+  8040d4:	72 b3                	jb     804089 <devcons_write+0x38>
+    return res;
+  8040d6:	49 63 c4             	movslq %r12d,%rax
+}
+  8040d9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8040e0:	5b                   	pop    %rbx
+  8040e1:	41 5c                	pop    %r12
+  8040e3:	41 5d                	pop    %r13
+  8040e5:	41 5e                	pop    %r14
+  8040e7:	41 5f                	pop    %r15
+  8040e9:	5d                   	pop    %rbp
+  8040ea:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8040eb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8040f1:	eb e3                	jmp    8040d6 <devcons_write+0x85>
+
+00000000008040f3 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040f3:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8040f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040fb:	48 85 c0             	test   %rax,%rax
+  8040fe:	74 55                	je     804155 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804100:	55                   	push   %rbp
+  804101:	48 89 e5             	mov    %rsp,%rbp
+  804104:	41 55                	push   %r13
+  804106:	41 54                	push   %r12
+  804108:	53                   	push   %rbx
+  804109:	48 83 ec 08          	sub    $0x8,%rsp
+  80410d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804110:	48 bb 8a 11 80 00 00 	movabs $0x80118a,%rbx
+  804117:	00 00 00 
+  80411a:	49 bc 57 12 80 00 00 	movabs $0x801257,%r12
+  804121:	00 00 00 
+  804124:	eb 03                	jmp    804129 <devcons_read+0x36>
+  804126:	41 ff d4             	call   *%r12
+  804129:	ff d3                	call   *%rbx
+  80412b:	85 c0                	test   %eax,%eax
+  80412d:	74 f7                	je     804126 <devcons_read+0x33>
+    if (c < 0) return c;
+  80412f:	48 63 d0             	movslq %eax,%rdx
+  804132:	78 13                	js     804147 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804134:	ba 00 00 00 00       	mov    $0x0,%edx
+  804139:	83 f8 04             	cmp    $0x4,%eax
+  80413c:	74 09                	je     804147 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80413e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804142:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804147:	48 89 d0             	mov    %rdx,%rax
+  80414a:	48 83 c4 08          	add    $0x8,%rsp
+  80414e:	5b                   	pop    %rbx
+  80414f:	41 5c                	pop    %r12
+  804151:	41 5d                	pop    %r13
+  804153:	5d                   	pop    %rbp
+  804154:	c3                   	ret
+  804155:	48 89 d0             	mov    %rdx,%rax
+  804158:	c3                   	ret
+
+0000000000804159 <cputchar>:
+cputchar(int ch) {
+  804159:	55                   	push   %rbp
+  80415a:	48 89 e5             	mov    %rsp,%rbp
+  80415d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804161:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804165:	be 01 00 00 00       	mov    $0x1,%esi
+  80416a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80416e:	48 b8 5d 11 80 00 00 	movabs $0x80115d,%rax
+  804175:	00 00 00 
+  804178:	ff d0                	call   *%rax
+}
+  80417a:	c9                   	leave
+  80417b:	c3                   	ret
+
+000000000080417c <getchar>:
+getchar(void) {
+  80417c:	55                   	push   %rbp
+  80417d:	48 89 e5             	mov    %rsp,%rbp
+  804180:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804184:	ba 01 00 00 00       	mov    $0x1,%edx
+  804189:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80418d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804192:	48 b8 3a 23 80 00 00 	movabs $0x80233a,%rax
+  804199:	00 00 00 
+  80419c:	ff d0                	call   *%rax
+  80419e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8041a0:	85 c0                	test   %eax,%eax
+  8041a2:	78 06                	js     8041aa <getchar+0x2e>
+  8041a4:	74 08                	je     8041ae <getchar+0x32>
+  8041a6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8041aa:	89 d0                	mov    %edx,%eax
+  8041ac:	c9                   	leave
+  8041ad:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8041ae:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8041b3:	eb f5                	jmp    8041aa <getchar+0x2e>
+
+00000000008041b5 <iscons>:
+iscons(int fdnum) {
+  8041b5:	55                   	push   %rbp
+  8041b6:	48 89 e5             	mov    %rsp,%rbp
+  8041b9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041bd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041c1:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  8041c8:	00 00 00 
+  8041cb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041cd:	85 c0                	test   %eax,%eax
+  8041cf:	78 18                	js     8041e9 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8041d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041d5:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8041dc:	00 00 00 
+  8041df:	8b 00                	mov    (%rax),%eax
+  8041e1:	39 02                	cmp    %eax,(%rdx)
+  8041e3:	0f 94 c0             	sete   %al
+  8041e6:	0f b6 c0             	movzbl %al,%eax
+}
+  8041e9:	c9                   	leave
+  8041ea:	c3                   	ret
+
+00000000008041eb <opencons>:
+opencons(void) {
+  8041eb:	55                   	push   %rbp
+  8041ec:	48 89 e5             	mov    %rsp,%rbp
+  8041ef:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8041f3:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8041f7:	48 b8 f7 1f 80 00 00 	movabs $0x801ff7,%rax
+  8041fe:	00 00 00 
+  804201:	ff d0                	call   *%rax
+  804203:	85 c0                	test   %eax,%eax
+  804205:	78 49                	js     804250 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804207:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80420c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804211:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804215:	bf 00 00 00 00       	mov    $0x0,%edi
+  80421a:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  804221:	00 00 00 
+  804224:	ff d0                	call   *%rax
+  804226:	85 c0                	test   %eax,%eax
+  804228:	78 26                	js     804250 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80422a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80422e:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804235:	00 00 
+  804237:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804239:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80423d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804244:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  80424b:	00 00 00 
+  80424e:	ff d0                	call   *%rax
+}
+  804250:	c9                   	leave
+  804251:	c3                   	ret
+
+0000000000804252 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804252:	55                   	push   %rbp
+  804253:	48 89 e5             	mov    %rsp,%rbp
+  804256:	41 56                	push   %r14
+  804258:	41 55                	push   %r13
+  80425a:	41 54                	push   %r12
+  80425c:	53                   	push   %rbx
+  80425d:	48 83 ec 50          	sub    $0x50,%rsp
+  804261:	49 89 fc             	mov    %rdi,%r12
+  804264:	41 89 f5             	mov    %esi,%r13d
+  804267:	48 89 d3             	mov    %rdx,%rbx
+  80426a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80426e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  804272:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804276:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80427d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804281:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  804285:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804289:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80428d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804294:	00 00 00 
+  804297:	4c 8b 30             	mov    (%rax),%r14
+  80429a:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  8042a1:	00 00 00 
+  8042a4:	ff d0                	call   *%rax
+  8042a6:	89 c6                	mov    %eax,%esi
+  8042a8:	45 89 e8             	mov    %r13d,%r8d
+  8042ab:	4c 89 e1             	mov    %r12,%rcx
+  8042ae:	4c 89 f2             	mov    %r14,%rdx
+  8042b1:	48 bf 68 57 80 00 00 	movabs $0x805768,%rdi
+  8042b8:	00 00 00 
+  8042bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042c0:	49 bc 0e 02 80 00 00 	movabs $0x80020e,%r12
+  8042c7:	00 00 00 
+  8042ca:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8042cd:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8042d1:	48 89 df             	mov    %rbx,%rdi
+  8042d4:	48 b8 aa 01 80 00 00 	movabs $0x8001aa,%rax
+  8042db:	00 00 00 
+  8042de:	ff d0                	call   *%rax
+    cprintf("\n");
+  8042e0:	48 bf cb 56 80 00 00 	movabs $0x8056cb,%rdi
+  8042e7:	00 00 00 
+  8042ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ef:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8042f2:	cc                   	int3
+  8042f3:	eb fd                	jmp    8042f2 <_panic+0xa0>
+
+00000000008042f5 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8042f5:	55                   	push   %rbp
+  8042f6:	48 89 e5             	mov    %rsp,%rbp
+  8042f9:	41 55                	push   %r13
+  8042fb:	41 54                	push   %r12
+  8042fd:	53                   	push   %rbx
+  8042fe:	48 83 ec 08          	sub    $0x8,%rsp
+  804302:	49 89 fc             	mov    %rdi,%r12
+  804305:	48 89 f7             	mov    %rsi,%rdi
+  804308:	48 89 d3             	mov    %rdx,%rbx
+  80430b:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80430e:	48 85 f6             	test   %rsi,%rsi
+  804311:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804318:	00 00 00 
+  80431b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80431f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804324:	48 85 d2             	test   %rdx,%rdx
+  804327:	74 03                	je     80432c <ipc_recv+0x37>
+  804329:	48 8b 32             	mov    (%rdx),%rsi
+  80432c:	48 b8 93 16 80 00 00 	movabs $0x801693,%rax
+  804333:	00 00 00 
+  804336:	ff d0                	call   *%rax
+    if (errno) {
+  804338:	85 c0                	test   %eax,%eax
+  80433a:	74 1c                	je     804358 <ipc_recv+0x63>
+        if (from_env_store)
+  80433c:	4d 85 e4             	test   %r12,%r12
+  80433f:	74 08                	je     804349 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804341:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804348:	00 
+
+        if (perm_store)
+  804349:	4d 85 ed             	test   %r13,%r13
+  80434c:	74 74                	je     8043c2 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80434e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804355:	00 
+  804356:	eb 6a                	jmp    8043c2 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804358:	4d 85 e4             	test   %r12,%r12
+  80435b:	74 14                	je     804371 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80435d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804364:	00 00 00 
+  804367:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80436d:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804371:	48 85 db             	test   %rbx,%rbx
+  804374:	74 23                	je     804399 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804376:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80437d:	00 00 00 
+  804380:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804386:	ba 00 00 00 00       	mov    $0x0,%edx
+  80438b:	85 c9                	test   %ecx,%ecx
+  80438d:	74 07                	je     804396 <ipc_recv+0xa1>
+  80438f:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804396:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804399:	4d 85 ed             	test   %r13,%r13
+  80439c:	74 14                	je     8043b2 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80439e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8043a5:	00 00 00 
+  8043a8:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8043ae:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8043b2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8043b9:	00 00 00 
+  8043bc:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8043c2:	48 83 c4 08          	add    $0x8,%rsp
+  8043c6:	5b                   	pop    %rbx
+  8043c7:	41 5c                	pop    %r12
+  8043c9:	41 5d                	pop    %r13
+  8043cb:	5d                   	pop    %rbp
+  8043cc:	c3                   	ret
+
+00000000008043cd <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8043cd:	55                   	push   %rbp
+  8043ce:	48 89 e5             	mov    %rsp,%rbp
+  8043d1:	41 55                	push   %r13
+  8043d3:	41 54                	push   %r12
+  8043d5:	53                   	push   %rbx
+  8043d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8043da:	49 89 fc             	mov    %rdi,%r12
+  8043dd:	48 89 f7             	mov    %rsi,%rdi
+  8043e0:	48 89 d3             	mov    %rdx,%rbx
+  8043e3:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8043e6:	48 85 f6             	test   %rsi,%rsi
+  8043e9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8043f0:	00 00 00 
+  8043f3:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8043f7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043fc:	48 85 d2             	test   %rdx,%rdx
+  8043ff:	74 03                	je     804404 <ipc_try_recv+0x37>
+  804401:	48 8b 32             	mov    (%rdx),%rsi
+  804404:	48 b8 fc 16 80 00 00 	movabs $0x8016fc,%rax
+  80440b:	00 00 00 
+  80440e:	ff d0                	call   *%rax
+    if (errno) {
+  804410:	85 c0                	test   %eax,%eax
+  804412:	75 75                	jne    804489 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804414:	4d 85 e4             	test   %r12,%r12
+  804417:	74 14                	je     80442d <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804419:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804420:	00 00 00 
+  804423:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804429:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80442d:	48 85 db             	test   %rbx,%rbx
+  804430:	74 23                	je     804455 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804432:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804439:	00 00 00 
+  80443c:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804442:	ba 00 00 00 00       	mov    $0x0,%edx
+  804447:	85 c9                	test   %ecx,%ecx
+  804449:	74 07                	je     804452 <ipc_try_recv+0x85>
+  80444b:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804452:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804455:	4d 85 ed             	test   %r13,%r13
+  804458:	74 14                	je     80446e <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80445a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804461:	00 00 00 
+  804464:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80446a:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80446e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804475:	00 00 00 
+  804478:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80447e:	48 83 c4 08          	add    $0x8,%rsp
+  804482:	5b                   	pop    %rbx
+  804483:	41 5c                	pop    %r12
+  804485:	41 5d                	pop    %r13
+  804487:	5d                   	pop    %rbp
+  804488:	c3                   	ret
+        if (from_env_store)
+  804489:	4d 85 e4             	test   %r12,%r12
+  80448c:	74 08                	je     804496 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80448e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804495:	00 
+        if (perm_store)
+  804496:	4d 85 ed             	test   %r13,%r13
+  804499:	74 e3                	je     80447e <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80449b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8044a2:	00 
+  8044a3:	eb d9                	jmp    80447e <ipc_try_recv+0xb1>
+
+00000000008044a5 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8044a5:	55                   	push   %rbp
+  8044a6:	48 89 e5             	mov    %rsp,%rbp
+  8044a9:	41 57                	push   %r15
+  8044ab:	41 56                	push   %r14
+  8044ad:	41 55                	push   %r13
+  8044af:	41 54                	push   %r12
+  8044b1:	53                   	push   %rbx
+  8044b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8044b6:	41 89 fd             	mov    %edi,%r13d
+  8044b9:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8044bc:	48 89 d3             	mov    %rdx,%rbx
+  8044bf:	49 89 cc             	mov    %rcx,%r12
+  8044c2:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8044c6:	48 85 d2             	test   %rdx,%rdx
+  8044c9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044d0:	00 00 00 
+  8044d3:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8044d7:	49 be 67 16 80 00 00 	movabs $0x801667,%r14
+  8044de:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8044e1:	49 bf 57 12 80 00 00 	movabs $0x801257,%r15
+  8044e8:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8044eb:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8044ee:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8044f2:	4c 89 e1             	mov    %r12,%rcx
+  8044f5:	48 89 da             	mov    %rbx,%rdx
+  8044f8:	44 89 ef             	mov    %r13d,%edi
+  8044fb:	41 ff d6             	call   *%r14
+  8044fe:	85 c0                	test   %eax,%eax
+  804500:	74 37                	je     804539 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804502:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804505:	75 05                	jne    80450c <ipc_send+0x67>
+        sys_yield();
+  804507:	41 ff d7             	call   *%r15
+  80450a:	eb df                	jmp    8044eb <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80450c:	89 c1                	mov    %eax,%ecx
+  80450e:	48 ba 8b 57 80 00 00 	movabs $0x80578b,%rdx
+  804515:	00 00 00 
+  804518:	be 65 00 00 00       	mov    $0x65,%esi
+  80451d:	48 bf a6 57 80 00 00 	movabs $0x8057a6,%rdi
+  804524:	00 00 00 
+  804527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80452c:	49 b8 52 42 80 00 00 	movabs $0x804252,%r8
+  804533:	00 00 00 
+  804536:	41 ff d0             	call   *%r8
+    }
+}
+  804539:	48 83 c4 18          	add    $0x18,%rsp
+  80453d:	5b                   	pop    %rbx
+  80453e:	41 5c                	pop    %r12
+  804540:	41 5d                	pop    %r13
+  804542:	41 5e                	pop    %r14
+  804544:	41 5f                	pop    %r15
+  804546:	5d                   	pop    %rbp
+  804547:	c3                   	ret
+
+0000000000804548 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804548:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80454d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804554:	00 00 00 
+  804557:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80455e:	48 01 ca             	add    %rcx,%rdx
+  804561:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804567:	39 fa                	cmp    %edi,%edx
+  804569:	74 12                	je     80457d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80456b:	48 83 c0 01          	add    $0x1,%rax
+  80456f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804575:	75 e0                	jne    804557 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804577:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80457c:	c3                   	ret
+            return envs[i].env_id;
+  80457d:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804584:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80458b:	00 00 00 
+  80458e:	48 01 d0             	add    %rdx,%rax
+  804591:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804597:	c3                   	ret
+
+0000000000804598 <__text_end>:
+  804598:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459f:	00 00 00 
+  8045a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a9:	00 00 00 
+  8045ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b3:	00 00 00 
+  8045b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bd:	00 00 00 
+  8045c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c7:	00 00 00 
+  8045ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d1:	00 00 00 
+  8045d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045db:	00 00 00 
+  8045de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e5:	00 00 00 
+  8045e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ef:	00 00 00 
+  8045f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f9:	00 00 00 
+  8045fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804603:	00 00 00 
+  804606:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460d:	00 00 00 
+  804610:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804617:	00 00 00 
+  80461a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804621:	00 00 00 
+  804624:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462b:	00 00 00 
+  80462e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804635:	00 00 00 
+  804638:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463f:	00 00 00 
+  804642:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804649:	00 00 00 
+  80464c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804653:	00 00 00 
+  804656:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465d:	00 00 00 
+  804660:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804667:	00 00 00 
+  80466a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804671:	00 00 00 
+  804674:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467b:	00 00 00 
+  80467e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804685:	00 00 00 
+  804688:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468f:	00 00 00 
+  804692:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804699:	00 00 00 
+  80469c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a3:	00 00 00 
+  8046a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ad:	00 00 00 
+  8046b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b7:	00 00 00 
+  8046ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c1:	00 00 00 
+  8046c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cb:	00 00 00 
+  8046ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d5:	00 00 00 
+  8046d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046df:	00 00 00 
+  8046e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e9:	00 00 00 
+  8046ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f3:	00 00 00 
+  8046f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fd:	00 00 00 
+  804700:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804707:	00 00 00 
+  80470a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804711:	00 00 00 
+  804714:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471b:	00 00 00 
+  80471e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804725:	00 00 00 
+  804728:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472f:	00 00 00 
+  804732:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804739:	00 00 00 
+  80473c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804743:	00 00 00 
+  804746:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474d:	00 00 00 
+  804750:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804757:	00 00 00 
+  80475a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804761:	00 00 00 
+  804764:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476b:	00 00 00 
+  80476e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804775:	00 00 00 
+  804778:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477f:	00 00 00 
+  804782:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804789:	00 00 00 
+  80478c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804793:	00 00 00 
+  804796:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479d:	00 00 00 
+  8047a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a7:	00 00 00 
+  8047aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b1:	00 00 00 
+  8047b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bb:	00 00 00 
+  8047be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c5:	00 00 00 
+  8047c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cf:	00 00 00 
+  8047d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d9:	00 00 00 
+  8047dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e3:	00 00 00 
+  8047e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ed:	00 00 00 
+  8047f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f7:	00 00 00 
+  8047fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804801:	00 00 00 
+  804804:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480b:	00 00 00 
+  80480e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804815:	00 00 00 
+  804818:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481f:	00 00 00 
+  804822:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804829:	00 00 00 
+  80482c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804833:	00 00 00 
+  804836:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483d:	00 00 00 
+  804840:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804847:	00 00 00 
+  80484a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804851:	00 00 00 
+  804854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485b:	00 00 00 
+  80485e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804865:	00 00 00 
+  804868:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486f:	00 00 00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,8285 @@
+
+obj/user/faultnostack:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2e 00 00 00       	call   800051 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_env_set_pgfault_upcall(0, (void *)_pgfault_upcall);
+  800029:	48 be bc 0c 80 00 00 	movabs $0x800cbc,%rsi
+  800030:	00 00 00 
+  800033:	bf 00 00 00 00       	mov    $0x0,%edi
+  800038:	48 b8 be 05 80 00 00 	movabs $0x8005be,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800044:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80004b:	00 00 00 00 
+#endif
+}
+  80004f:	5d                   	pop    %rbp
+  800050:	c3                   	ret
+
+0000000000800051 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800051:	55                   	push   %rbp
+  800052:	48 89 e5             	mov    %rsp,%rbp
+  800055:	41 56                	push   %r14
+  800057:	41 55                	push   %r13
+  800059:	41 54                	push   %r12
+  80005b:	53                   	push   %rbx
+  80005c:	41 89 fd             	mov    %edi,%r13d
+  80005f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800062:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800069:	00 00 00 
+  80006c:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800073:	00 00 00 
+  800076:	48 39 c2             	cmp    %rax,%rdx
+  800079:	73 17                	jae    800092 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007e:	49 89 c4             	mov    %rax,%r12
+  800081:	48 83 c3 08          	add    $0x8,%rbx
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	ff 53 f8             	call   *-0x8(%rbx)
+  80008d:	4c 39 e3             	cmp    %r12,%rbx
+  800090:	72 ef                	jb     800081 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800092:	48 b8 e6 01 80 00 00 	movabs $0x8001e6,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a3:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000aa:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b1:	00 00 00 
+  8000b4:	48 01 d0             	add    %rdx,%rax
+  8000b7:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000be:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c1:	45 85 ed             	test   %r13d,%r13d
+  8000c4:	7e 0d                	jle    8000d3 <libmain+0x82>
+  8000c6:	49 8b 06             	mov    (%r14),%rax
+  8000c9:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000d0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d3:	4c 89 f6             	mov    %r14,%rsi
+  8000d6:	44 89 ef             	mov    %r13d,%edi
+  8000d9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e0:	00 00 00 
+  8000e3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e5:	48 b8 fa 00 80 00 00 	movabs $0x8000fa,%rax
+  8000ec:	00 00 00 
+  8000ef:	ff d0                	call   *%rax
+#endif
+}
+  8000f1:	5b                   	pop    %rbx
+  8000f2:	41 5c                	pop    %r12
+  8000f4:	41 5d                	pop    %r13
+  8000f6:	41 5e                	pop    %r14
+  8000f8:	5d                   	pop    %rbp
+  8000f9:	c3                   	ret
+
+00000000008000fa <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000fa:	55                   	push   %rbp
+  8000fb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fe:	48 b8 2d 0f 80 00 00 	movabs $0x800f2d,%rax
+  800105:	00 00 00 
+  800108:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80010a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010f:	48 b8 7b 01 80 00 00 	movabs $0x80017b,%rax
+  800116:	00 00 00 
+  800119:	ff d0                	call   *%rax
+}
+  80011b:	5d                   	pop    %rbp
+  80011c:	c3                   	ret
+
+000000000080011d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80011d:	55                   	push   %rbp
+  80011e:	48 89 e5             	mov    %rsp,%rbp
+  800121:	53                   	push   %rbx
+  800122:	48 89 fa             	mov    %rdi,%rdx
+  800125:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800128:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80012d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800132:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800137:	be 00 00 00 00       	mov    $0x0,%esi
+  80013c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800142:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800144:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800148:	c9                   	leave
+  800149:	c3                   	ret
+
+000000000080014a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80014a:	55                   	push   %rbp
+  80014b:	48 89 e5             	mov    %rsp,%rbp
+  80014e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80014f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800154:	ba 00 00 00 00       	mov    $0x0,%edx
+  800159:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80015e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800163:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800168:	be 00 00 00 00       	mov    $0x0,%esi
+  80016d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800173:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800175:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800179:	c9                   	leave
+  80017a:	c3                   	ret
+
+000000000080017b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80017b:	55                   	push   %rbp
+  80017c:	48 89 e5             	mov    %rsp,%rbp
+  80017f:	53                   	push   %rbx
+  800180:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800184:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800187:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80018c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800191:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800196:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80019b:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001a8:	48 85 c0             	test   %rax,%rax
+  8001ab:	7f 06                	jg     8001b3 <sys_env_destroy+0x38>
+}
+  8001ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001b1:	c9                   	leave
+  8001b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001b3:	49 89 c0             	mov    %rax,%r8
+  8001b6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001bb:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8001c2:	00 00 00 
+  8001c5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001ca:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8001d1:	00 00 00 
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	49 b9 90 2f 80 00 00 	movabs $0x802f90,%r9
+  8001e0:	00 00 00 
+  8001e3:	41 ff d1             	call   *%r9
+
+00000000008001e6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001e6:	55                   	push   %rbp
+  8001e7:	48 89 e5             	mov    %rsp,%rbp
+  8001ea:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001eb:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800204:	be 00 00 00 00       	mov    $0x0,%esi
+  800209:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80020f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800211:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800215:	c9                   	leave
+  800216:	c3                   	ret
+
+0000000000800217 <sys_yield>:
+
+void
+sys_yield(void) {
+  800217:	55                   	push   %rbp
+  800218:	48 89 e5             	mov    %rsp,%rbp
+  80021b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80021c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800221:	ba 00 00 00 00       	mov    $0x0,%edx
+  800226:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800230:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800235:	be 00 00 00 00       	mov    $0x0,%esi
+  80023a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800240:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800242:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800246:	c9                   	leave
+  800247:	c3                   	ret
+
+0000000000800248 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800248:	55                   	push   %rbp
+  800249:	48 89 e5             	mov    %rsp,%rbp
+  80024c:	53                   	push   %rbx
+  80024d:	48 89 fa             	mov    %rdi,%rdx
+  800250:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800253:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800258:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80025f:	00 00 00 
+  800262:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800267:	be 00 00 00 00       	mov    $0x0,%esi
+  80026c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800272:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800274:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800278:	c9                   	leave
+  800279:	c3                   	ret
+
+000000000080027a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80027a:	55                   	push   %rbp
+  80027b:	48 89 e5             	mov    %rsp,%rbp
+  80027e:	53                   	push   %rbx
+  80027f:	49 89 f8             	mov    %rdi,%r8
+  800282:	48 89 d3             	mov    %rdx,%rbx
+  800285:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800288:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80028d:	4c 89 c2             	mov    %r8,%rdx
+  800290:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800293:	be 00 00 00 00       	mov    $0x0,%esi
+  800298:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80029e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a4:	c9                   	leave
+  8002a5:	c3                   	ret
+
+00000000008002a6 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002a6:	55                   	push   %rbp
+  8002a7:	48 89 e5             	mov    %rsp,%rbp
+  8002aa:	53                   	push   %rbx
+  8002ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8002af:	89 f8                	mov    %edi,%eax
+  8002b1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002b4:	48 63 f9             	movslq %ecx,%rdi
+  8002b7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002ba:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002bf:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002cf:	48 85 c0             	test   %rax,%rax
+  8002d2:	7f 06                	jg     8002da <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d8:	c9                   	leave
+  8002d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002da:	49 89 c0             	mov    %rax,%r8
+  8002dd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002e2:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8002e9:	00 00 00 
+  8002ec:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002f1:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8002f8:	00 00 00 
+  8002fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800300:	49 b9 90 2f 80 00 00 	movabs $0x802f90,%r9
+  800307:	00 00 00 
+  80030a:	41 ff d1             	call   *%r9
+
+000000000080030d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80030d:	55                   	push   %rbp
+  80030e:	48 89 e5             	mov    %rsp,%rbp
+  800311:	53                   	push   %rbx
+  800312:	48 83 ec 08          	sub    $0x8,%rsp
+  800316:	89 f8                	mov    %edi,%eax
+  800318:	49 89 f2             	mov    %rsi,%r10
+  80031b:	48 89 cf             	mov    %rcx,%rdi
+  80031e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800321:	48 63 da             	movslq %edx,%rbx
+  800324:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800327:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80032c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80032f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800332:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800334:	48 85 c0             	test   %rax,%rax
+  800337:	7f 06                	jg     80033f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800339:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80033d:	c9                   	leave
+  80033e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80033f:	49 89 c0             	mov    %rax,%r8
+  800342:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800347:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80034e:	00 00 00 
+  800351:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800356:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80035d:	00 00 00 
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	49 b9 90 2f 80 00 00 	movabs $0x802f90,%r9
+  80036c:	00 00 00 
+  80036f:	41 ff d1             	call   *%r9
+
+0000000000800372 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800372:	55                   	push   %rbp
+  800373:	48 89 e5             	mov    %rsp,%rbp
+  800376:	53                   	push   %rbx
+  800377:	48 83 ec 08          	sub    $0x8,%rsp
+  80037b:	49 89 f9             	mov    %rdi,%r9
+  80037e:	89 f0                	mov    %esi,%eax
+  800380:	48 89 d3             	mov    %rdx,%rbx
+  800383:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  800386:	49 63 f0             	movslq %r8d,%rsi
+  800389:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80038c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800391:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800394:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80039a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80039c:	48 85 c0             	test   %rax,%rax
+  80039f:	7f 06                	jg     8003a7 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a5:	c9                   	leave
+  8003a6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003a7:	49 89 c0             	mov    %rax,%r8
+  8003aa:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003af:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8003b6:	00 00 00 
+  8003b9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8003be:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8003c5:	00 00 00 
+  8003c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cd:	49 b9 90 2f 80 00 00 	movabs $0x802f90,%r9
+  8003d4:	00 00 00 
+  8003d7:	41 ff d1             	call   *%r9
+
+00000000008003da <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003da:	55                   	push   %rbp
+  8003db:	48 89 e5             	mov    %rsp,%rbp
+  8003de:	53                   	push   %rbx
+  8003df:	89 f8                	mov    %edi,%eax
+  8003e1:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8003e4:	48 63 f9             	movslq %ecx,%rdi
+  8003e7:	48 63 da             	movslq %edx,%rbx
+  8003ea:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003ed:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003f2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8003fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800400:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  800402:	89 c2                	mov    %eax,%edx
+  800404:	48 85 c0             	test   %rax,%rax
+  800407:	78 0d                	js     800416 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  800409:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80040e:	4d 85 c9             	test   %r9,%r9
+  800411:	74 03                	je     800416 <sys_alloc_dma_region+0x3c>
+  800413:	49 89 01             	mov    %rax,(%r9)
+}
+  800416:	89 d0                	mov    %edx,%eax
+  800418:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80041c:	c9                   	leave
+  80041d:	c3                   	ret
+
+000000000080041e <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80041e:	55                   	push   %rbp
+  80041f:	48 89 e5             	mov    %rsp,%rbp
+  800422:	53                   	push   %rbx
+  800423:	48 83 ec 08          	sub    $0x8,%rsp
+  800427:	48 89 f1             	mov    %rsi,%rcx
+  80042a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80042d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800430:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800435:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80043a:	be 00 00 00 00       	mov    $0x0,%esi
+  80043f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800445:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800447:	48 85 c0             	test   %rax,%rax
+  80044a:	7f 06                	jg     800452 <sys_set_cache_region+0x34>
+}
+  80044c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800450:	c9                   	leave
+  800451:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800452:	49 89 c0             	mov    %rax,%r8
+  800455:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80045a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800461:	00 00 00 
+  800464:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800469:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800470:	00 00 00 
+  800473:	b8 00 00 00 00       	mov    $0x0,%eax
+  800478:	49 b9 90 2f 80 00 00 	movabs $0x802f90,%r9
+  80047f:	00 00 00 
+  800482:	41 ff d1             	call   *%r9
+
+0000000000800485 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800485:	55                   	push   %rbp
+  800486:	48 89 e5             	mov    %rsp,%rbp
+  800489:	53                   	push   %rbx
+  80048a:	48 83 ec 08          	sub    $0x8,%rsp
+  80048e:	48 89 f1             	mov    %rsi,%rcx
+  800491:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800494:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800497:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80049c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004ac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ae:	48 85 c0             	test   %rax,%rax
+  8004b1:	7f 06                	jg     8004b9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8004b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b7:	c9                   	leave
+  8004b8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004b9:	49 89 c0             	mov    %rax,%r8
+  8004bc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004c1:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8004c8:	00 00 00 
+  8004cb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004d0:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8004d7:	00 00 00 
+  8004da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004df:	49 b9 90 2f 80 00 00 	movabs $0x802f90,%r9
+  8004e6:	00 00 00 
+  8004e9:	41 ff d1             	call   *%r9
+
+00000000008004ec <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004ec:	55                   	push   %rbp
+  8004ed:	48 89 e5             	mov    %rsp,%rbp
+  8004f0:	53                   	push   %rbx
+  8004f1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004f5:	48 63 ce             	movslq %esi,%rcx
+  8004f8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800500:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800505:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80050a:	be 00 00 00 00       	mov    $0x0,%esi
+  80050f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800515:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800517:	48 85 c0             	test   %rax,%rax
+  80051a:	7f 06                	jg     800522 <sys_env_set_status+0x36>
+}
+  80051c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800520:	c9                   	leave
+  800521:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800522:	49 89 c0             	mov    %rax,%r8
+  800525:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80052a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800531:	00 00 00 
+  800534:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800539:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800540:	00 00 00 
+  800543:	b8 00 00 00 00       	mov    $0x0,%eax
+  800548:	49 b9 90 2f 80 00 00 	movabs $0x802f90,%r9
+  80054f:	00 00 00 
+  800552:	41 ff d1             	call   *%r9
+
+0000000000800555 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800555:	55                   	push   %rbp
+  800556:	48 89 e5             	mov    %rsp,%rbp
+  800559:	53                   	push   %rbx
+  80055a:	48 83 ec 08          	sub    $0x8,%rsp
+  80055e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800561:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800564:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800569:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80056e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800573:	be 00 00 00 00       	mov    $0x0,%esi
+  800578:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80057e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800580:	48 85 c0             	test   %rax,%rax
+  800583:	7f 06                	jg     80058b <sys_env_set_trapframe+0x36>
+}
+  800585:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800589:	c9                   	leave
+  80058a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80058b:	49 89 c0             	mov    %rax,%r8
+  80058e:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800593:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80059a:	00 00 00 
+  80059d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8005a2:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8005a9:	00 00 00 
+  8005ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b1:	49 b9 90 2f 80 00 00 	movabs $0x802f90,%r9
+  8005b8:	00 00 00 
+  8005bb:	41 ff d1             	call   *%r9
+
+00000000008005be <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+  8005c2:	53                   	push   %rbx
+  8005c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005ca:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005cd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005e9:	48 85 c0             	test   %rax,%rax
+  8005ec:	7f 06                	jg     8005f4 <sys_env_set_pgfault_upcall+0x36>
+}
+  8005ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f2:	c9                   	leave
+  8005f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005f4:	49 89 c0             	mov    %rax,%r8
+  8005f7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005fc:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800603:	00 00 00 
+  800606:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80060b:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800612:	00 00 00 
+  800615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061a:	49 b9 90 2f 80 00 00 	movabs $0x802f90,%r9
+  800621:	00 00 00 
+  800624:	41 ff d1             	call   *%r9
+
+0000000000800627 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800627:	55                   	push   %rbp
+  800628:	48 89 e5             	mov    %rsp,%rbp
+  80062b:	53                   	push   %rbx
+  80062c:	89 f8                	mov    %edi,%eax
+  80062e:	49 89 f1             	mov    %rsi,%r9
+  800631:	48 89 d3             	mov    %rdx,%rbx
+  800634:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800637:	49 63 f0             	movslq %r8d,%rsi
+  80063a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80063d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800642:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800645:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80064b:	cd 30                	int    $0x30
+}
+  80064d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800651:	c9                   	leave
+  800652:	c3                   	ret
+
+0000000000800653 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800653:	55                   	push   %rbp
+  800654:	48 89 e5             	mov    %rsp,%rbp
+  800657:	53                   	push   %rbx
+  800658:	48 83 ec 08          	sub    $0x8,%rsp
+  80065c:	48 89 fa             	mov    %rdi,%rdx
+  80065f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800662:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800667:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80066c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800671:	be 00 00 00 00       	mov    $0x0,%esi
+  800676:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80067c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80067e:	48 85 c0             	test   %rax,%rax
+  800681:	7f 06                	jg     800689 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800683:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800687:	c9                   	leave
+  800688:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800689:	49 89 c0             	mov    %rax,%r8
+  80068c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800691:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800698:	00 00 00 
+  80069b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8006a0:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8006a7:	00 00 00 
+  8006aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006af:	49 b9 90 2f 80 00 00 	movabs $0x802f90,%r9
+  8006b6:	00 00 00 
+  8006b9:	41 ff d1             	call   *%r9
+
+00000000008006bc <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8006bc:	55                   	push   %rbp
+  8006bd:	48 89 e5             	mov    %rsp,%rbp
+  8006c0:	53                   	push   %rbx
+  8006c1:	48 89 fa             	mov    %rdi,%rdx
+  8006c4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006c7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8006db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006e1:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006e7:	c9                   	leave
+  8006e8:	c3                   	ret
+
+00000000008006e9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006e9:	55                   	push   %rbp
+  8006ea:	48 89 e5             	mov    %rsp,%rbp
+  8006ed:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006ee:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800702:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800707:	be 00 00 00 00       	mov    $0x0,%esi
+  80070c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800712:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800714:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800718:	c9                   	leave
+  800719:	c3                   	ret
+
+000000000080071a <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80071a:	48 85 ff             	test   %rdi,%rdi
+  80071d:	0f 84 b6 01 00 00    	je     8008d9 <malloc+0x1bf>
+malloc(size_t size) {
+  800723:	55                   	push   %rbp
+  800724:	48 89 e5             	mov    %rsp,%rbp
+  800727:	41 56                	push   %r14
+  800729:	41 55                	push   %r13
+  80072b:	41 54                	push   %r12
+  80072d:	53                   	push   %rbx
+  80072e:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800731:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800738:	00 00 00 
+  80073b:	4c 8b 20             	mov    (%rax),%r12
+  80073e:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  800745:	0f 87 94 01 00 00    	ja     8008df <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  80074b:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800752:	00 00 00 
+  800755:	48 85 c0             	test   %rax,%rax
+  800758:	74 6b                	je     8007c5 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80075a:	4d 85 e4             	test   %r12,%r12
+  80075d:	74 66                	je     8007c5 <malloc+0xab>
+  80075f:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  800766:	00 00 00 
+  800769:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076e:	eb 0d                	jmp    80077d <malloc+0x63>
+  800770:	48 83 c1 01          	add    $0x1,%rcx
+  800774:	48 83 c2 18          	add    $0x18,%rdx
+  800778:	49 39 cc             	cmp    %rcx,%r12
+  80077b:	74 48                	je     8007c5 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80077d:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  800782:	74 ec                	je     800770 <malloc+0x56>
+  800784:	48 39 1a             	cmp    %rbx,(%rdx)
+  800787:	72 e7                	jb     800770 <malloc+0x56>
+                real_freep_size--;
+  800789:	48 83 e8 01          	sub    $0x1,%rax
+  80078d:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800794:	00 00 00 
+                freep[i].is_free = false;
+  800797:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80079e:	00 00 00 
+  8007a1:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8007a5:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8007a9:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8007ad:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8007b4:	00 
+                freep[i].size = size;
+  8007b5:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8007b9:	48 01 c8             	add    %rcx,%rax
+  8007bc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007c0:	e9 0b 01 00 00       	jmp    8008d0 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8007c5:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8007cc:	00 00 00 
+  8007cf:	48 01 d8             	add    %rbx,%rax
+  8007d2:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007d8:	76 7c                	jbe    800856 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007da:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8007e1:	00 00 00 
+  8007e4:	4c 8b 30             	mov    (%rax),%r14
+  8007e7:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8007ee:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8007f1:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8007f8:	00 00 00 
+  8007fb:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  800802:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  800809:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80080f:	4c 0f 45 eb          	cmovne %rbx,%r13
+  800813:	48 b8 e6 01 80 00 00 	movabs $0x8001e6,%rax
+  80081a:	00 00 00 
+  80081d:	ff d0                	call   *%rax
+  80081f:	89 c7                	mov    %eax,%edi
+  800821:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  800828:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80082f:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  800836:	00 00 00 
+  800839:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80083d:	b9 26 00 00 00       	mov    $0x26,%ecx
+  800842:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  800849:	00 00 00 
+  80084c:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80084e:	85 c0                	test   %eax,%eax
+  800850:	0f 88 90 00 00 00    	js     8008e6 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  800856:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  80085d:	00 00 00 
+  800860:	48 8b 31             	mov    (%rcx),%rsi
+  800863:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  80086a:	00 00 00 
+  80086d:	4c 8b 07             	mov    (%rdi),%r8
+  800870:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  800874:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  80087b:	00 00 00 
+  80087e:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  800882:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  800886:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80088d:	00 00 00 
+  800890:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  800894:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  800897:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  80089b:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8008a2:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8008a3:	48 89 d8             	mov    %rbx,%rax
+  8008a6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8008ab:	4c 01 c0             	add    %r8,%rax
+  8008ae:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8008b1:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8008b8:	48 01 f3             	add    %rsi,%rbx
+  8008bb:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8008be:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8008c3:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008ca:	00 00 00 
+  8008cd:	48 89 d0             	mov    %rdx,%rax
+}
+  8008d0:	5b                   	pop    %rbx
+  8008d1:	41 5c                	pop    %r12
+  8008d3:	41 5d                	pop    %r13
+  8008d5:	41 5e                	pop    %r14
+  8008d7:	5d                   	pop    %rbp
+  8008d8:	c3                   	ret
+        return NULL;
+  8008d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008de:	c3                   	ret
+        return NULL;
+  8008df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e4:	eb ea                	jmp    8008d0 <malloc+0x1b6>
+            return NULL;
+  8008e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008eb:	eb e3                	jmp    8008d0 <malloc+0x1b6>
+
+00000000008008ed <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8008ed:	55                   	push   %rbp
+  8008ee:	48 89 e5             	mov    %rsp,%rbp
+  8008f1:	53                   	push   %rbx
+  8008f2:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8008f6:	48 89 fb             	mov    %rdi,%rbx
+  8008f9:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8008fd:	48 89 df             	mov    %rbx,%rdi
+  800900:	48 b8 1a 07 80 00 00 	movabs $0x80071a,%rax
+  800907:	00 00 00 
+  80090a:	ff d0                	call   *%rax
+  80090c:	48 89 c7             	mov    %rax,%rdi
+  80090f:	48 89 da             	mov    %rbx,%rdx
+  800912:	be 00 00 00 00       	mov    $0x0,%esi
+  800917:	48 b8 38 3d 80 00 00 	movabs $0x803d38,%rax
+  80091e:	00 00 00 
+  800921:	ff d0                	call   *%rax
+}
+  800923:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800927:	c9                   	leave
+  800928:	c3                   	ret
+
+0000000000800929 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  800929:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  800930:	00 00 00 
+  800933:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80093a:	00 00 00 
+  80093d:	48 3b 02             	cmp    (%rdx),%rax
+  800940:	74 4d                	je     80098f <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  800942:	48 85 c0             	test   %rax,%rax
+  800945:	74 4d                	je     800994 <get_allocsize+0x6b>
+  800947:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80094e:	00 00 00 
+  800951:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  800956:	48 3b 39             	cmp    (%rcx),%rdi
+  800959:	74 13                	je     80096e <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  80095b:	48 83 c2 01          	add    $0x1,%rdx
+  80095f:	48 83 c1 18          	add    $0x18,%rcx
+  800963:	48 39 d0             	cmp    %rdx,%rax
+  800966:	75 ee                	jne    800956 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  800968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096d:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  80096e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800972:	b8 00 00 00 00       	mov    $0x0,%eax
+  800977:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  80097e:	00 00 00 
+  800981:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800987:	75 0b                	jne    800994 <get_allocsize+0x6b>
+  800989:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  80098e:	c3                   	ret
+        return 0;
+  80098f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800994:	c3                   	ret
+
+0000000000800995 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  800995:	48 85 ff             	test   %rdi,%rdi
+  800998:	0f 84 01 01 00 00    	je     800a9f <free+0x10a>
+free(void *ptr) {
+  80099e:	55                   	push   %rbp
+  80099f:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8009a2:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8009a9:	00 00 00 
+  8009ac:	48 8b 30             	mov    (%rax),%rsi
+  8009af:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8009b6:	00 00 00 
+  8009b9:	48 39 c6             	cmp    %rax,%rsi
+  8009bc:	74 50                	je     800a0e <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8009be:	48 85 f6             	test   %rsi,%rsi
+  8009c1:	74 21                	je     8009e4 <free+0x4f>
+  8009c3:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009ca:	00 00 00 
+  8009cd:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009d2:	48 3b 39             	cmp    (%rcx),%rdi
+  8009d5:	74 61                	je     800a38 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009d7:	48 83 c2 01          	add    $0x1,%rdx
+  8009db:	48 83 c1 18          	add    $0x18,%rcx
+  8009df:	48 39 d6             	cmp    %rdx,%rsi
+  8009e2:	75 ee                	jne    8009d2 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8009e4:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  8009eb:	00 00 00 
+  8009ee:	be 12 01 00 00       	mov    $0x112,%esi
+  8009f3:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009fa:	00 00 00 
+  8009fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a02:	48 b9 90 2f 80 00 00 	movabs $0x802f90,%rcx
+  800a09:	00 00 00 
+  800a0c:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  800a0e:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  800a15:	00 00 00 
+  800a18:	be 06 01 00 00       	mov    $0x106,%esi
+  800a1d:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a24:	00 00 00 
+  800a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2c:	48 b9 90 2f 80 00 00 	movabs $0x802f90,%rcx
+  800a33:	00 00 00 
+  800a36:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a38:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a3c:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a43:	00 00 00 
+  800a46:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a4c:	75 27                	jne    800a75 <free+0xe0>
+            freep[i].is_free = true;
+  800a4e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a52:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a59:	00 00 00 
+  800a5c:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a63:	00 00 
+            real_freep_size++;
+  800a65:	48 83 c0 01          	add    $0x1,%rax
+  800a69:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a70:	00 00 00 
+}
+  800a73:	5d                   	pop    %rbp
+  800a74:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a75:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a7c:	00 00 00 
+  800a7f:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800a84:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a8b:	00 00 00 
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a93:	48 b9 90 2f 80 00 00 	movabs $0x802f90,%rcx
+  800a9a:	00 00 00 
+  800a9d:	ff d1                	call   *%rcx
+  800a9f:	c3                   	ret
+
+0000000000800aa0 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800aa0:	55                   	push   %rbp
+  800aa1:	48 89 e5             	mov    %rsp,%rbp
+  800aa4:	41 55                	push   %r13
+  800aa6:	41 54                	push   %r12
+  800aa8:	53                   	push   %rbx
+  800aa9:	48 83 ec 08          	sub    $0x8,%rsp
+  800aad:	48 89 fb             	mov    %rdi,%rbx
+  800ab0:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800ab3:	48 b8 29 09 80 00 00 	movabs $0x800929,%rax
+  800aba:	00 00 00 
+  800abd:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800abf:	49 39 c5             	cmp    %rax,%r13
+  800ac2:	73 0e                	jae    800ad2 <realloc+0x32>
+}
+  800ac4:	48 89 d8             	mov    %rbx,%rax
+  800ac7:	48 83 c4 08          	add    $0x8,%rsp
+  800acb:	5b                   	pop    %rbx
+  800acc:	41 5c                	pop    %r12
+  800ace:	41 5d                	pop    %r13
+  800ad0:	5d                   	pop    %rbp
+  800ad1:	c3                   	ret
+  800ad2:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800ad5:	4c 89 ef             	mov    %r13,%rdi
+  800ad8:	48 b8 1a 07 80 00 00 	movabs $0x80071a,%rax
+  800adf:	00 00 00 
+  800ae2:	ff d0                	call   *%rax
+  800ae4:	48 89 c7             	mov    %rax,%rdi
+  800ae7:	4c 89 e2             	mov    %r12,%rdx
+  800aea:	48 89 de             	mov    %rbx,%rsi
+  800aed:	48 b8 4d 3e 80 00 00 	movabs $0x803e4d,%rax
+  800af4:	00 00 00 
+  800af7:	ff d0                	call   *%rax
+  800af9:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800afc:	48 89 df             	mov    %rbx,%rdi
+  800aff:	48 b8 95 09 80 00 00 	movabs $0x800995,%rax
+  800b06:	00 00 00 
+  800b09:	ff d0                	call   *%rax
+    return newptr;
+  800b0b:	4c 89 e3             	mov    %r12,%rbx
+  800b0e:	eb b4                	jmp    800ac4 <realloc+0x24>
+
+0000000000800b10 <strdup>:
+
+char*
+strdup (const char *src) {
+  800b10:	55                   	push   %rbp
+  800b11:	48 89 e5             	mov    %rsp,%rbp
+  800b14:	41 54                	push   %r12
+  800b16:	53                   	push   %rbx
+  800b17:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800b1a:	48 b8 1a 3a 80 00 00 	movabs $0x803a1a,%rax
+  800b21:	00 00 00 
+  800b24:	ff d0                	call   *%rax
+  800b26:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b2a:	4c 89 e7             	mov    %r12,%rdi
+  800b2d:	48 b8 1a 07 80 00 00 	movabs $0x80071a,%rax
+  800b34:	00 00 00 
+  800b37:	ff d0                	call   *%rax
+  800b39:	48 89 c7             	mov    %rax,%rdi
+  800b3c:	4c 89 e2             	mov    %r12,%rdx
+  800b3f:	48 89 de             	mov    %rbx,%rsi
+  800b42:	48 b8 4d 3e 80 00 00 	movabs $0x803e4d,%rax
+  800b49:	00 00 00 
+  800b4c:	ff d0                	call   *%rax
+}
+  800b4e:	5b                   	pop    %rbx
+  800b4f:	41 5c                	pop    %r12
+  800b51:	5d                   	pop    %rbp
+  800b52:	c3                   	ret
+
+0000000000800b53 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b53:	55                   	push   %rbp
+  800b54:	48 89 e5             	mov    %rsp,%rbp
+  800b57:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b58:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b62:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b6c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b71:	be 00 00 00 00       	mov    $0x0,%esi
+  800b76:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b7c:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b82:	c9                   	leave
+  800b83:	c3                   	ret
+
+0000000000800b84 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800b84:	55                   	push   %rbp
+  800b85:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800b88:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800b8f:	00 00 00 
+  800b92:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b96:	74 26                	je     800bbe <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800b98:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b9a:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b9e:	89 c0                	mov    %eax,%eax
+  800ba0:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800ba3:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800baa:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800bb1:	00 00 00 
+  800bb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb9:	48 f7 31             	divq   (%rcx)
+}
+  800bbc:	5d                   	pop    %rbp
+  800bbd:	c3                   	ret
+        freq = get_cpufreq();
+  800bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc3:	48 ba 53 0b 80 00 00 	movabs $0x800b53,%rdx
+  800bca:	00 00 00 
+  800bcd:	ff d2                	call   *%rdx
+  800bcf:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bd6:	00 00 00 
+  800bd9:	eb bd                	jmp    800b98 <get_ticks+0x14>
+
+0000000000800bdb <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bdb:	55                   	push   %rbp
+  800bdc:	48 89 e5             	mov    %rsp,%rbp
+  800bdf:	53                   	push   %rbx
+  800be0:	48 83 ec 08          	sub    $0x8,%rsp
+  800be4:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800be7:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bee:	00 00 00 
+  800bf1:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800bf5:	74 50                	je     800c47 <sleep+0x6c>
+    asm volatile("rdtsc"
+  800bf7:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bf9:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bfd:	89 c0                	mov    %eax,%eax
+  800bff:	48 89 d6             	mov    %rdx,%rsi
+  800c02:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800c05:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800c0c:	00 00 00 
+  800c0f:	48 0f af 18          	imul   (%rax),%rbx
+  800c13:	48 c1 eb 03          	shr    $0x3,%rbx
+  800c17:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800c1e:	9b c4 20 
+  800c21:	48 89 d8             	mov    %rbx,%rax
+  800c24:	48 f7 e2             	mul    %rdx
+  800c27:	48 89 d1             	mov    %rdx,%rcx
+  800c2a:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c2e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c30:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c34:	89 c0                	mov    %eax,%eax
+  800c36:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c39:	48 29 f2             	sub    %rsi,%rdx
+  800c3c:	48 39 ca             	cmp    %rcx,%rdx
+  800c3f:	72 ed                	jb     800c2e <sleep+0x53>
+}
+  800c41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c45:	c9                   	leave
+  800c46:	c3                   	ret
+        freq = get_cpufreq();
+  800c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4c:	48 ba 53 0b 80 00 00 	movabs $0x800b53,%rdx
+  800c53:	00 00 00 
+  800c56:	ff d2                	call   *%rdx
+  800c58:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c5f:	00 00 00 
+  800c62:	eb 93                	jmp    800bf7 <sleep+0x1c>
+
+0000000000800c64 <poll_kbd>:
+
+int poll_kbd() {
+  800c64:	55                   	push   %rbp
+  800c65:	48 89 e5             	mov    %rsp,%rbp
+  800c68:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c69:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c73:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c7d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c82:	be 00 00 00 00       	mov    $0x0,%esi
+  800c87:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c8d:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c93:	c9                   	leave
+  800c94:	c3                   	ret
+
+0000000000800c95 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800c95:	55                   	push   %rbp
+  800c96:	48 89 e5             	mov    %rsp,%rbp
+  800c99:	53                   	push   %rbx
+  800c9a:	49 89 fa             	mov    %rdi,%r10
+  800c9d:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800c9f:	44 89 c6             	mov    %r8d,%esi
+  800ca2:	89 cf                	mov    %ecx,%edi
+  800ca4:	89 d3                	mov    %edx,%ebx
+  800ca6:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800ca8:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800cad:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800cb0:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800cb4:	cd 30                	int    $0x30
+  800cb6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cba:	c9                   	leave
+  800cbb:	c3                   	ret
+
+0000000000800cbc <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  800cbc:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  800cbf:	48 b8 2f 40 80 00 00 	movabs $0x80402f,%rax
+  800cc6:	00 00 00 
+    call *%rax
+  800cc9:	ff d0                	call   *%rax
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    popq %r15
+  800ccb:	41 5f                	pop    %r15
+    popq %r15
+  800ccd:	41 5f                	pop    %r15
+    popq %r15
+  800ccf:	41 5f                	pop    %r15
+    popq %r14
+  800cd1:	41 5e                	pop    %r14
+    popq %r13
+  800cd3:	41 5d                	pop    %r13
+    popq %r12
+  800cd5:	41 5c                	pop    %r12
+    popq %r11
+  800cd7:	41 5b                	pop    %r11
+    popq %r10
+  800cd9:	41 5a                	pop    %r10
+    popq %r9
+  800cdb:	41 59                	pop    %r9
+    popq %r8
+  800cdd:	41 58                	pop    %r8
+    popq %rsi
+  800cdf:	5e                   	pop    %rsi
+    popq %rdi
+  800ce0:	5f                   	pop    %rdi
+    popq %rbp
+  800ce1:	5d                   	pop    %rbp
+    popq %rdx
+  800ce2:	5a                   	pop    %rdx
+    popq %rcx
+  800ce3:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  800ce4:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  800ce9:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  800cee:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  800cf2:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  800cf5:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  800cfa:	5b                   	pop    %rbx
+    popq %rax
+  800cfb:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    pushq 8(%rsp)
+  800cfc:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  800d00:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    movq 16(%rsp), %rsp
+  800d01:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  800d06:	c3                   	ret
+
+0000000000800d07 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800d07:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800d0e:	ff ff ff 
+  800d11:	48 01 f8             	add    %rdi,%rax
+  800d14:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800d18:	c3                   	ret
+
+0000000000800d19 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800d19:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800d20:	ff ff ff 
+  800d23:	48 01 f8             	add    %rdi,%rax
+  800d26:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800d2a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800d30:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800d34:	c3                   	ret
+
+0000000000800d35 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800d35:	55                   	push   %rbp
+  800d36:	48 89 e5             	mov    %rsp,%rbp
+  800d39:	41 57                	push   %r15
+  800d3b:	41 56                	push   %r14
+  800d3d:	41 55                	push   %r13
+  800d3f:	41 54                	push   %r12
+  800d41:	53                   	push   %rbx
+  800d42:	48 83 ec 08          	sub    $0x8,%rsp
+  800d46:	49 89 ff             	mov    %rdi,%r15
+  800d49:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800d4e:	49 bd e9 2b 80 00 00 	movabs $0x802be9,%r13
+  800d55:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800d58:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800d5e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800d61:	48 89 df             	mov    %rbx,%rdi
+  800d64:	41 ff d5             	call   *%r13
+  800d67:	83 e0 04             	and    $0x4,%eax
+  800d6a:	74 17                	je     800d83 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800d6c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d73:	4c 39 f3             	cmp    %r14,%rbx
+  800d76:	75 e6                	jne    800d5e <fd_alloc+0x29>
+  800d78:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d7e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d83:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d86:	48 83 c4 08          	add    $0x8,%rsp
+  800d8a:	5b                   	pop    %rbx
+  800d8b:	41 5c                	pop    %r12
+  800d8d:	41 5d                	pop    %r13
+  800d8f:	41 5e                	pop    %r14
+  800d91:	41 5f                	pop    %r15
+  800d93:	5d                   	pop    %rbp
+  800d94:	c3                   	ret
+
+0000000000800d95 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d95:	83 ff 1f             	cmp    $0x1f,%edi
+  800d98:	77 39                	ja     800dd3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d9a:	55                   	push   %rbp
+  800d9b:	48 89 e5             	mov    %rsp,%rbp
+  800d9e:	41 54                	push   %r12
+  800da0:	53                   	push   %rbx
+  800da1:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800da4:	48 63 df             	movslq %edi,%rbx
+  800da7:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800dae:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800db2:	48 89 df             	mov    %rbx,%rdi
+  800db5:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  800dbc:	00 00 00 
+  800dbf:	ff d0                	call   *%rax
+  800dc1:	a8 04                	test   $0x4,%al
+  800dc3:	74 14                	je     800dd9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800dc5:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dce:	5b                   	pop    %rbx
+  800dcf:	41 5c                	pop    %r12
+  800dd1:	5d                   	pop    %rbp
+  800dd2:	c3                   	ret
+        return -E_INVAL;
+  800dd3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800dd8:	c3                   	ret
+        return -E_INVAL;
+  800dd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dde:	eb ee                	jmp    800dce <fd_lookup+0x39>
+
+0000000000800de0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800de0:	55                   	push   %rbp
+  800de1:	48 89 e5             	mov    %rsp,%rbp
+  800de4:	41 54                	push   %r12
+  800de6:	53                   	push   %rbx
+  800de7:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800dea:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800df1:	00 00 00 
+  800df4:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800dfb:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800dfe:	39 3b                	cmp    %edi,(%rbx)
+  800e00:	74 47                	je     800e49 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800e02:	48 83 c0 08          	add    $0x8,%rax
+  800e06:	48 8b 18             	mov    (%rax),%rbx
+  800e09:	48 85 db             	test   %rbx,%rbx
+  800e0c:	75 f0                	jne    800dfe <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800e0e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800e15:	00 00 00 
+  800e18:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800e1e:	89 fa                	mov    %edi,%edx
+  800e20:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  800e27:	00 00 00 
+  800e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2f:	48 b9 e0 30 80 00 00 	movabs $0x8030e0,%rcx
+  800e36:	00 00 00 
+  800e39:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800e3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800e40:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800e44:	5b                   	pop    %rbx
+  800e45:	41 5c                	pop    %r12
+  800e47:	5d                   	pop    %rbp
+  800e48:	c3                   	ret
+            return 0;
+  800e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4e:	eb f0                	jmp    800e40 <dev_lookup+0x60>
+
+0000000000800e50 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800e50:	55                   	push   %rbp
+  800e51:	48 89 e5             	mov    %rsp,%rbp
+  800e54:	41 55                	push   %r13
+  800e56:	41 54                	push   %r12
+  800e58:	53                   	push   %rbx
+  800e59:	48 83 ec 18          	sub    $0x18,%rsp
+  800e5d:	48 89 fb             	mov    %rdi,%rbx
+  800e60:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800e63:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800e6a:	ff ff ff 
+  800e6d:	48 01 df             	add    %rbx,%rdi
+  800e70:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800e74:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e78:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  800e7f:	00 00 00 
+  800e82:	ff d0                	call   *%rax
+  800e84:	41 89 c5             	mov    %eax,%r13d
+  800e87:	85 c0                	test   %eax,%eax
+  800e89:	78 06                	js     800e91 <fd_close+0x41>
+  800e8b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e8f:	74 1a                	je     800eab <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e91:	45 84 e4             	test   %r12b,%r12b
+  800e94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e99:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e9d:	44 89 e8             	mov    %r13d,%eax
+  800ea0:	48 83 c4 18          	add    $0x18,%rsp
+  800ea4:	5b                   	pop    %rbx
+  800ea5:	41 5c                	pop    %r12
+  800ea7:	41 5d                	pop    %r13
+  800ea9:	5d                   	pop    %rbp
+  800eaa:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800eab:	8b 3b                	mov    (%rbx),%edi
+  800ead:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800eb1:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  800eb8:	00 00 00 
+  800ebb:	ff d0                	call   *%rax
+  800ebd:	41 89 c5             	mov    %eax,%r13d
+  800ec0:	85 c0                	test   %eax,%eax
+  800ec2:	78 1b                	js     800edf <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800ec4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ec8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800ecc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800ed2:	48 85 c0             	test   %rax,%rax
+  800ed5:	74 08                	je     800edf <fd_close+0x8f>
+  800ed7:	48 89 df             	mov    %rbx,%rdi
+  800eda:	ff d0                	call   *%rax
+  800edc:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800edf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ee4:	48 89 de             	mov    %rbx,%rsi
+  800ee7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eec:	48 b8 85 04 80 00 00 	movabs $0x800485,%rax
+  800ef3:	00 00 00 
+  800ef6:	ff d0                	call   *%rax
+    return res;
+  800ef8:	eb a3                	jmp    800e9d <fd_close+0x4d>
+
+0000000000800efa <close>:
+
+int
+close(int fdnum) {
+  800efa:	55                   	push   %rbp
+  800efb:	48 89 e5             	mov    %rsp,%rbp
+  800efe:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800f02:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800f06:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  800f0d:	00 00 00 
+  800f10:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800f12:	85 c0                	test   %eax,%eax
+  800f14:	78 15                	js     800f2b <close+0x31>
+
+    return fd_close(fd, 1);
+  800f16:	be 01 00 00 00       	mov    $0x1,%esi
+  800f1b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800f1f:	48 b8 50 0e 80 00 00 	movabs $0x800e50,%rax
+  800f26:	00 00 00 
+  800f29:	ff d0                	call   *%rax
+}
+  800f2b:	c9                   	leave
+  800f2c:	c3                   	ret
+
+0000000000800f2d <close_all>:
+
+void
+close_all(void) {
+  800f2d:	55                   	push   %rbp
+  800f2e:	48 89 e5             	mov    %rsp,%rbp
+  800f31:	41 54                	push   %r12
+  800f33:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800f34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f39:	49 bc fa 0e 80 00 00 	movabs $0x800efa,%r12
+  800f40:	00 00 00 
+  800f43:	89 df                	mov    %ebx,%edi
+  800f45:	41 ff d4             	call   *%r12
+  800f48:	83 c3 01             	add    $0x1,%ebx
+  800f4b:	83 fb 20             	cmp    $0x20,%ebx
+  800f4e:	75 f3                	jne    800f43 <close_all+0x16>
+}
+  800f50:	5b                   	pop    %rbx
+  800f51:	41 5c                	pop    %r12
+  800f53:	5d                   	pop    %rbp
+  800f54:	c3                   	ret
+
+0000000000800f55 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800f55:	55                   	push   %rbp
+  800f56:	48 89 e5             	mov    %rsp,%rbp
+  800f59:	41 57                	push   %r15
+  800f5b:	41 56                	push   %r14
+  800f5d:	41 55                	push   %r13
+  800f5f:	41 54                	push   %r12
+  800f61:	53                   	push   %rbx
+  800f62:	48 83 ec 18          	sub    $0x18,%rsp
+  800f66:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800f69:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800f6d:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  800f74:	00 00 00 
+  800f77:	ff d0                	call   *%rax
+  800f79:	89 c3                	mov    %eax,%ebx
+  800f7b:	85 c0                	test   %eax,%eax
+  800f7d:	0f 88 b8 00 00 00    	js     80103b <dup+0xe6>
+    close(newfdnum);
+  800f83:	44 89 e7             	mov    %r12d,%edi
+  800f86:	48 b8 fa 0e 80 00 00 	movabs $0x800efa,%rax
+  800f8d:	00 00 00 
+  800f90:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f92:	4d 63 ec             	movslq %r12d,%r13
+  800f95:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f9c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800fa0:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800fa4:	4c 89 ff             	mov    %r15,%rdi
+  800fa7:	49 be 19 0d 80 00 00 	movabs $0x800d19,%r14
+  800fae:	00 00 00 
+  800fb1:	41 ff d6             	call   *%r14
+  800fb4:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800fb7:	4c 89 ef             	mov    %r13,%rdi
+  800fba:	41 ff d6             	call   *%r14
+  800fbd:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800fc0:	48 89 df             	mov    %rbx,%rdi
+  800fc3:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  800fca:	00 00 00 
+  800fcd:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800fcf:	a8 04                	test   $0x4,%al
+  800fd1:	74 2b                	je     800ffe <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800fd3:	41 89 c1             	mov    %eax,%r9d
+  800fd6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fdc:	4c 89 f1             	mov    %r14,%rcx
+  800fdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe4:	48 89 de             	mov    %rbx,%rsi
+  800fe7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fec:	48 b8 0d 03 80 00 00 	movabs $0x80030d,%rax
+  800ff3:	00 00 00 
+  800ff6:	ff d0                	call   *%rax
+  800ff8:	89 c3                	mov    %eax,%ebx
+  800ffa:	85 c0                	test   %eax,%eax
+  800ffc:	78 4e                	js     80104c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800ffe:	4c 89 ff             	mov    %r15,%rdi
+  801001:	48 b8 e9 2b 80 00 00 	movabs $0x802be9,%rax
+  801008:	00 00 00 
+  80100b:	ff d0                	call   *%rax
+  80100d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801010:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801016:	4c 89 e9             	mov    %r13,%rcx
+  801019:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101e:	4c 89 fe             	mov    %r15,%rsi
+  801021:	bf 00 00 00 00       	mov    $0x0,%edi
+  801026:	48 b8 0d 03 80 00 00 	movabs $0x80030d,%rax
+  80102d:	00 00 00 
+  801030:	ff d0                	call   *%rax
+  801032:	89 c3                	mov    %eax,%ebx
+  801034:	85 c0                	test   %eax,%eax
+  801036:	78 14                	js     80104c <dup+0xf7>
+
+    return newfdnum;
+  801038:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80103b:	89 d8                	mov    %ebx,%eax
+  80103d:	48 83 c4 18          	add    $0x18,%rsp
+  801041:	5b                   	pop    %rbx
+  801042:	41 5c                	pop    %r12
+  801044:	41 5d                	pop    %r13
+  801046:	41 5e                	pop    %r14
+  801048:	41 5f                	pop    %r15
+  80104a:	5d                   	pop    %rbp
+  80104b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80104c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801051:	4c 89 ee             	mov    %r13,%rsi
+  801054:	bf 00 00 00 00       	mov    $0x0,%edi
+  801059:	49 bc 85 04 80 00 00 	movabs $0x800485,%r12
+  801060:	00 00 00 
+  801063:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801066:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80106b:	4c 89 f6             	mov    %r14,%rsi
+  80106e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801073:	41 ff d4             	call   *%r12
+    return res;
+  801076:	eb c3                	jmp    80103b <dup+0xe6>
+
+0000000000801078 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801078:	55                   	push   %rbp
+  801079:	48 89 e5             	mov    %rsp,%rbp
+  80107c:	41 56                	push   %r14
+  80107e:	41 55                	push   %r13
+  801080:	41 54                	push   %r12
+  801082:	53                   	push   %rbx
+  801083:	48 83 ec 10          	sub    $0x10,%rsp
+  801087:	89 fb                	mov    %edi,%ebx
+  801089:	49 89 f4             	mov    %rsi,%r12
+  80108c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80108f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801093:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  80109a:	00 00 00 
+  80109d:	ff d0                	call   *%rax
+  80109f:	85 c0                	test   %eax,%eax
+  8010a1:	78 4c                	js     8010ef <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010a3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8010a7:	41 8b 3e             	mov    (%r14),%edi
+  8010aa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8010ae:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  8010b5:	00 00 00 
+  8010b8:	ff d0                	call   *%rax
+  8010ba:	85 c0                	test   %eax,%eax
+  8010bc:	78 35                	js     8010f3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8010be:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8010c2:	83 e0 03             	and    $0x3,%eax
+  8010c5:	83 f8 01             	cmp    $0x1,%eax
+  8010c8:	74 2d                	je     8010f7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010ce:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8010d2:	48 85 c0             	test   %rax,%rax
+  8010d5:	74 56                	je     80112d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8010d7:	4c 89 ea             	mov    %r13,%rdx
+  8010da:	4c 89 e6             	mov    %r12,%rsi
+  8010dd:	4c 89 f7             	mov    %r14,%rdi
+  8010e0:	ff d0                	call   *%rax
+}
+  8010e2:	48 83 c4 10          	add    $0x10,%rsp
+  8010e6:	5b                   	pop    %rbx
+  8010e7:	41 5c                	pop    %r12
+  8010e9:	41 5d                	pop    %r13
+  8010eb:	41 5e                	pop    %r14
+  8010ed:	5d                   	pop    %rbp
+  8010ee:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8010ef:	48 98                	cltq
+  8010f1:	eb ef                	jmp    8010e2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010f3:	48 98                	cltq
+  8010f5:	eb eb                	jmp    8010e2 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8010f7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8010fe:	00 00 00 
+  801101:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801107:	89 da                	mov    %ebx,%edx
+  801109:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  801110:	00 00 00 
+  801113:	b8 00 00 00 00       	mov    $0x0,%eax
+  801118:	48 b9 e0 30 80 00 00 	movabs $0x8030e0,%rcx
+  80111f:	00 00 00 
+  801122:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801124:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80112b:	eb b5                	jmp    8010e2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80112d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801134:	eb ac                	jmp    8010e2 <read+0x6a>
+
+0000000000801136 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801136:	55                   	push   %rbp
+  801137:	48 89 e5             	mov    %rsp,%rbp
+  80113a:	41 57                	push   %r15
+  80113c:	41 56                	push   %r14
+  80113e:	41 55                	push   %r13
+  801140:	41 54                	push   %r12
+  801142:	53                   	push   %rbx
+  801143:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801147:	48 85 d2             	test   %rdx,%rdx
+  80114a:	74 54                	je     8011a0 <readn+0x6a>
+  80114c:	41 89 fd             	mov    %edi,%r13d
+  80114f:	49 89 f6             	mov    %rsi,%r14
+  801152:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801155:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80115a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80115f:	49 bf 78 10 80 00 00 	movabs $0x801078,%r15
+  801166:	00 00 00 
+  801169:	4c 89 e2             	mov    %r12,%rdx
+  80116c:	48 29 f2             	sub    %rsi,%rdx
+  80116f:	4c 01 f6             	add    %r14,%rsi
+  801172:	44 89 ef             	mov    %r13d,%edi
+  801175:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801178:	85 c0                	test   %eax,%eax
+  80117a:	78 20                	js     80119c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80117c:	01 c3                	add    %eax,%ebx
+  80117e:	85 c0                	test   %eax,%eax
+  801180:	74 08                	je     80118a <readn+0x54>
+  801182:	48 63 f3             	movslq %ebx,%rsi
+  801185:	4c 39 e6             	cmp    %r12,%rsi
+  801188:	72 df                	jb     801169 <readn+0x33>
+    }
+    return res;
+  80118a:	48 63 c3             	movslq %ebx,%rax
+}
+  80118d:	48 83 c4 08          	add    $0x8,%rsp
+  801191:	5b                   	pop    %rbx
+  801192:	41 5c                	pop    %r12
+  801194:	41 5d                	pop    %r13
+  801196:	41 5e                	pop    %r14
+  801198:	41 5f                	pop    %r15
+  80119a:	5d                   	pop    %rbp
+  80119b:	c3                   	ret
+        if (inc < 0) return inc;
+  80119c:	48 98                	cltq
+  80119e:	eb ed                	jmp    80118d <readn+0x57>
+    int inc = 1, res = 0;
+  8011a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a5:	eb e3                	jmp    80118a <readn+0x54>
+
+00000000008011a7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8011a7:	55                   	push   %rbp
+  8011a8:	48 89 e5             	mov    %rsp,%rbp
+  8011ab:	41 56                	push   %r14
+  8011ad:	41 55                	push   %r13
+  8011af:	41 54                	push   %r12
+  8011b1:	53                   	push   %rbx
+  8011b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8011b6:	89 fb                	mov    %edi,%ebx
+  8011b8:	49 89 f4             	mov    %rsi,%r12
+  8011bb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011be:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8011c2:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  8011c9:	00 00 00 
+  8011cc:	ff d0                	call   *%rax
+  8011ce:	85 c0                	test   %eax,%eax
+  8011d0:	78 47                	js     801219 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011d2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8011d6:	41 8b 3e             	mov    (%r14),%edi
+  8011d9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8011dd:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  8011e4:	00 00 00 
+  8011e7:	ff d0                	call   *%rax
+  8011e9:	85 c0                	test   %eax,%eax
+  8011eb:	78 30                	js     80121d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8011ed:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8011f2:	74 2d                	je     801221 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8011f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011f8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8011fc:	48 85 c0             	test   %rax,%rax
+  8011ff:	74 56                	je     801257 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801201:	4c 89 ea             	mov    %r13,%rdx
+  801204:	4c 89 e6             	mov    %r12,%rsi
+  801207:	4c 89 f7             	mov    %r14,%rdi
+  80120a:	ff d0                	call   *%rax
+}
+  80120c:	48 83 c4 10          	add    $0x10,%rsp
+  801210:	5b                   	pop    %rbx
+  801211:	41 5c                	pop    %r12
+  801213:	41 5d                	pop    %r13
+  801215:	41 5e                	pop    %r14
+  801217:	5d                   	pop    %rbp
+  801218:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801219:	48 98                	cltq
+  80121b:	eb ef                	jmp    80120c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80121d:	48 98                	cltq
+  80121f:	eb eb                	jmp    80120c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801221:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801228:	00 00 00 
+  80122b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801231:	89 da                	mov    %ebx,%edx
+  801233:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  80123a:	00 00 00 
+  80123d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801242:	48 b9 e0 30 80 00 00 	movabs $0x8030e0,%rcx
+  801249:	00 00 00 
+  80124c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80124e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801255:	eb b5                	jmp    80120c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801257:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80125e:	eb ac                	jmp    80120c <write+0x65>
+
+0000000000801260 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801260:	55                   	push   %rbp
+  801261:	48 89 e5             	mov    %rsp,%rbp
+  801264:	53                   	push   %rbx
+  801265:	48 83 ec 18          	sub    $0x18,%rsp
+  801269:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80126b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80126f:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  801276:	00 00 00 
+  801279:	ff d0                	call   *%rax
+  80127b:	85 c0                	test   %eax,%eax
+  80127d:	78 0c                	js     80128b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80127f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801283:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801286:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80128b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128f:	c9                   	leave
+  801290:	c3                   	ret
+
+0000000000801291 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  801291:	55                   	push   %rbp
+  801292:	48 89 e5             	mov    %rsp,%rbp
+  801295:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801299:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80129d:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  8012a4:	00 00 00 
+  8012a7:	ff d0                	call   *%rax
+  8012a9:	85 c0                	test   %eax,%eax
+  8012ab:	78 07                	js     8012b4 <tell+0x23>
+    return fdes->fd_offset;
+  8012ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012b1:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8012b4:	c9                   	leave
+  8012b5:	c3                   	ret
+
+00000000008012b6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8012b6:	55                   	push   %rbp
+  8012b7:	48 89 e5             	mov    %rsp,%rbp
+  8012ba:	41 55                	push   %r13
+  8012bc:	41 54                	push   %r12
+  8012be:	53                   	push   %rbx
+  8012bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8012c3:	89 fb                	mov    %edi,%ebx
+  8012c5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8012c8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8012cc:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  8012d3:	00 00 00 
+  8012d6:	ff d0                	call   *%rax
+  8012d8:	85 c0                	test   %eax,%eax
+  8012da:	78 38                	js     801314 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8012dc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8012e0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8012e4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8012e8:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  8012ef:	00 00 00 
+  8012f2:	ff d0                	call   *%rax
+  8012f4:	85 c0                	test   %eax,%eax
+  8012f6:	78 1c                	js     801314 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012f8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8012fd:	74 20                	je     80131f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801303:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801307:	48 85 c0             	test   %rax,%rax
+  80130a:	74 47                	je     801353 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80130c:	44 89 e6             	mov    %r12d,%esi
+  80130f:	4c 89 ef             	mov    %r13,%rdi
+  801312:	ff d0                	call   *%rax
+}
+  801314:	48 83 c4 18          	add    $0x18,%rsp
+  801318:	5b                   	pop    %rbx
+  801319:	41 5c                	pop    %r12
+  80131b:	41 5d                	pop    %r13
+  80131d:	5d                   	pop    %rbp
+  80131e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80131f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801326:	00 00 00 
+  801329:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80132f:	89 da                	mov    %ebx,%edx
+  801331:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  801338:	00 00 00 
+  80133b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801340:	48 b9 e0 30 80 00 00 	movabs $0x8030e0,%rcx
+  801347:	00 00 00 
+  80134a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80134c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801351:	eb c1                	jmp    801314 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801353:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801358:	eb ba                	jmp    801314 <ftruncate+0x5e>
+
+000000000080135a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80135a:	55                   	push   %rbp
+  80135b:	48 89 e5             	mov    %rsp,%rbp
+  80135e:	41 54                	push   %r12
+  801360:	53                   	push   %rbx
+  801361:	48 83 ec 10          	sub    $0x10,%rsp
+  801365:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801368:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80136c:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  801373:	00 00 00 
+  801376:	ff d0                	call   *%rax
+  801378:	85 c0                	test   %eax,%eax
+  80137a:	78 4e                	js     8013ca <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80137c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801380:	41 8b 3c 24          	mov    (%r12),%edi
+  801384:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801388:	48 b8 e0 0d 80 00 00 	movabs $0x800de0,%rax
+  80138f:	00 00 00 
+  801392:	ff d0                	call   *%rax
+  801394:	85 c0                	test   %eax,%eax
+  801396:	78 32                	js     8013ca <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801398:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80139c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8013a1:	74 30                	je     8013d3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8013a3:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8013a6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8013ad:	00 00 00 
+    stat->st_isdir = 0;
+  8013b0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8013b7:	00 00 00 
+    stat->st_dev = dev;
+  8013ba:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8013c1:	48 89 de             	mov    %rbx,%rsi
+  8013c4:	4c 89 e7             	mov    %r12,%rdi
+  8013c7:	ff 50 28             	call   *0x28(%rax)
+}
+  8013ca:	48 83 c4 10          	add    $0x10,%rsp
+  8013ce:	5b                   	pop    %rbx
+  8013cf:	41 5c                	pop    %r12
+  8013d1:	5d                   	pop    %rbp
+  8013d2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8013d3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8013d8:	eb f0                	jmp    8013ca <fstat+0x70>
+
+00000000008013da <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8013da:	55                   	push   %rbp
+  8013db:	48 89 e5             	mov    %rsp,%rbp
+  8013de:	41 54                	push   %r12
+  8013e0:	53                   	push   %rbx
+  8013e1:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8013e8:	41 89 fc             	mov    %edi,%r12d
+  8013eb:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8013ed:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013f1:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  8013f8:	00 00 00 
+  8013fb:	ff d0                	call   *%rax
+  8013fd:	85 c0                	test   %eax,%eax
+  8013ff:	78 31                	js     801432 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  801401:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801408:	44 89 e7             	mov    %r12d,%edi
+  80140b:	48 b8 5a 13 80 00 00 	movabs $0x80135a,%rax
+  801412:	00 00 00 
+  801415:	ff d0                	call   *%rax
+  801417:	85 c0                	test   %eax,%eax
+  801419:	78 17                	js     801432 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  80141b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80141f:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  801422:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801425:	39 d3                	cmp    %edx,%ebx
+  801427:	0f 4f da             	cmovg  %edx,%ebx
+  80142a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80142d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801432:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  801439:	5b                   	pop    %rbx
+  80143a:	41 5c                	pop    %r12
+  80143c:	5d                   	pop    %rbp
+  80143d:	c3                   	ret
+
+000000000080143e <seektoend>:
+{
+  80143e:	55                   	push   %rbp
+  80143f:	48 89 e5             	mov    %rsp,%rbp
+  801442:	53                   	push   %rbx
+  801443:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80144a:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80144c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801450:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  801457:	00 00 00 
+  80145a:	ff d0                	call   *%rax
+  80145c:	85 c0                	test   %eax,%eax
+  80145e:	78 28                	js     801488 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  801460:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801467:	89 df                	mov    %ebx,%edi
+  801469:	48 b8 5a 13 80 00 00 	movabs $0x80135a,%rax
+  801470:	00 00 00 
+  801473:	ff d0                	call   *%rax
+  801475:	85 c0                	test   %eax,%eax
+  801477:	78 0f                	js     801488 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  801479:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80147c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801480:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  801483:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801488:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148c:	c9                   	leave
+  80148d:	c3                   	ret
+
+000000000080148e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80148e:	55                   	push   %rbp
+  80148f:	48 89 e5             	mov    %rsp,%rbp
+  801492:	41 54                	push   %r12
+  801494:	53                   	push   %rbx
+  801495:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801498:	be 00 00 00 00       	mov    $0x0,%esi
+  80149d:	48 b8 81 20 80 00 00 	movabs $0x802081,%rax
+  8014a4:	00 00 00 
+  8014a7:	ff d0                	call   *%rax
+  8014a9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8014ab:	85 c0                	test   %eax,%eax
+  8014ad:	78 25                	js     8014d4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8014af:	4c 89 e6             	mov    %r12,%rsi
+  8014b2:	89 c7                	mov    %eax,%edi
+  8014b4:	48 b8 5a 13 80 00 00 	movabs $0x80135a,%rax
+  8014bb:	00 00 00 
+  8014be:	ff d0                	call   *%rax
+  8014c0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8014c3:	89 df                	mov    %ebx,%edi
+  8014c5:	48 b8 fa 0e 80 00 00 	movabs $0x800efa,%rax
+  8014cc:	00 00 00 
+  8014cf:	ff d0                	call   *%rax
+
+    return res;
+  8014d1:	44 89 e3             	mov    %r12d,%ebx
+}
+  8014d4:	89 d8                	mov    %ebx,%eax
+  8014d6:	5b                   	pop    %rbx
+  8014d7:	41 5c                	pop    %r12
+  8014d9:	5d                   	pop    %rbp
+  8014da:	c3                   	ret
+
+00000000008014db <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8014db:	55                   	push   %rbp
+  8014dc:	48 89 e5             	mov    %rsp,%rbp
+  8014df:	53                   	push   %rbx
+  8014e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e4:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8014e7:	48 b8 07 0d 80 00 00 	movabs $0x800d07,%rax
+  8014ee:	00 00 00 
+  8014f1:	ff d0                	call   *%rax
+  8014f3:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8014f7:	0f 87 ea 00 00 00    	ja     8015e7 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8014fd:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  801504:	00 00 00 
+  801507:	80 38 00             	cmpb   $0x0,(%rax)
+  80150a:	75 35                	jne    801541 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  80150c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801511:	ba 00 00 22 00       	mov    $0x220000,%edx
+  801516:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  80151b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801520:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  801527:	00 00 00 
+  80152a:	ff d0                	call   *%rax
+  80152c:	85 c0                	test   %eax,%eax
+  80152e:	0f 88 ba 00 00 00    	js     8015ee <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  801534:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80153b:	00 00 00 
+  80153e:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  801541:	48 89 df             	mov    %rbx,%rdi
+  801544:	48 b8 07 0d 80 00 00 	movabs $0x800d07,%rax
+  80154b:	00 00 00 
+  80154e:	ff d0                	call   *%rax
+  801550:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  801554:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80155b:	00 00 00 
+  80155e:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  801562:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  801565:	39 39                	cmp    %edi,(%rcx)
+  801567:	74 46                	je     8015af <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  801569:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80156d:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  801574:	00 
+  801575:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80157c:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  801583:	00 
+  801584:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80158b:	00 
+  80158c:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  801593:	00 
+  801594:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80159b:	00 
+  80159c:	89 39                	mov    %edi,(%rcx)
+  80159e:	48 01 c6             	add    %rax,%rsi
+  8015a1:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8015a6:	48 89 c8             	mov    %rcx,%rax
+  8015a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ad:	c9                   	leave
+  8015ae:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  8015af:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8015b3:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  8015ba:	00 00 00 
+  8015bd:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8015c0:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  8015c4:	74 e0                	je     8015a6 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  8015c6:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8015cd:	00 
+  8015ce:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8015d2:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8015d9:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8015db:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8015de:	48 01 c2             	add    %rax,%rdx
+  8015e1:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8015e5:	eb bf                	jmp    8015a6 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8015e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ec:	eb b8                	jmp    8015a6 <fbuf_get+0xcb>
+            return NULL;
+  8015ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f3:	eb b1                	jmp    8015a6 <fbuf_get+0xcb>
+
+00000000008015f5 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8015f5:	55                   	push   %rbp
+  8015f6:	48 89 e5             	mov    %rsp,%rbp
+  8015f9:	53                   	push   %rbx
+  8015fa:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8015fe:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  801605:	00 00 00 
+  801608:	48 8b 18             	mov    (%rax),%rbx
+  80160b:	48 85 db             	test   %rbx,%rbx
+  80160e:	74 16                	je     801626 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  801610:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  801617:	00 00 00 
+  80161a:	48 8b 18             	mov    (%rax),%rbx
+}
+  80161d:	48 89 d8             	mov    %rbx,%rax
+  801620:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801624:	c9                   	leave
+  801625:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  801626:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80162b:	ba 00 10 04 00       	mov    $0x41000,%edx
+  801630:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  801635:	bf 00 00 00 00       	mov    $0x0,%edi
+  80163a:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  801641:	00 00 00 
+  801644:	ff d0                	call   *%rax
+  801646:	85 c0                	test   %eax,%eax
+  801648:	78 d3                	js     80161d <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  80164a:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  80164f:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  801656:	00 00 00 
+  801659:	eb b5                	jmp    801610 <fsipc_bulk+0x1b>
+
+000000000080165b <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80165b:	55                   	push   %rbp
+  80165c:	48 89 e5             	mov    %rsp,%rbp
+  80165f:	41 57                	push   %r15
+  801661:	41 56                	push   %r14
+  801663:	41 55                	push   %r13
+  801665:	41 54                	push   %r12
+  801667:	53                   	push   %rbx
+  801668:	48 83 ec 08          	sub    $0x8,%rsp
+  80166c:	41 89 fd             	mov    %edi,%r13d
+  80166f:	49 89 f6             	mov    %rsi,%r14
+  801672:	49 89 d7             	mov    %rdx,%r15
+  801675:	48 89 cb             	mov    %rcx,%rbx
+  801678:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80167b:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801682:	00 00 00 
+  801685:	83 38 00             	cmpl   $0x0,(%rax)
+  801688:	74 52                	je     8016dc <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80168a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801690:	4c 89 f9             	mov    %r15,%rcx
+  801693:	4c 89 f2             	mov    %r14,%rdx
+  801696:	44 89 ee             	mov    %r13d,%esi
+  801699:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8016a0:	00 00 00 
+  8016a3:	8b 38                	mov    (%rax),%edi
+  8016a5:	48 b8 61 44 80 00 00 	movabs $0x804461,%rax
+  8016ac:	00 00 00 
+  8016af:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  8016b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016b6:	4c 89 e2             	mov    %r12,%rdx
+  8016b9:	48 89 de             	mov    %rbx,%rsi
+  8016bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016c1:	48 b8 b1 42 80 00 00 	movabs $0x8042b1,%rax
+  8016c8:	00 00 00 
+  8016cb:	ff d0                	call   *%rax
+}
+  8016cd:	48 83 c4 08          	add    $0x8,%rsp
+  8016d1:	5b                   	pop    %rbx
+  8016d2:	41 5c                	pop    %r12
+  8016d4:	41 5d                	pop    %r13
+  8016d6:	41 5e                	pop    %r14
+  8016d8:	41 5f                	pop    %r15
+  8016da:	5d                   	pop    %rbp
+  8016db:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016dc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8016e1:	48 b8 04 45 80 00 00 	movabs $0x804504,%rax
+  8016e8:	00 00 00 
+  8016eb:	ff d0                	call   *%rax
+  8016ed:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8016f4:	00 00 
+  8016f6:	eb 92                	jmp    80168a <fsipc_region+0x2f>
+
+00000000008016f8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8016f8:	55                   	push   %rbp
+  8016f9:	48 89 e5             	mov    %rsp,%rbp
+  8016fc:	41 57                	push   %r15
+  8016fe:	41 56                	push   %r14
+  801700:	41 55                	push   %r13
+  801702:	41 54                	push   %r12
+  801704:	53                   	push   %rbx
+  801705:	48 83 ec 28          	sub    $0x28,%rsp
+  801709:	49 89 ff             	mov    %rdi,%r15
+  80170c:	49 89 f6             	mov    %rsi,%r14
+  80170f:	48 89 d3             	mov    %rdx,%rbx
+  801712:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801716:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  801719:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  801720:	00 00 00 
+  801723:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  801725:	48 85 c0             	test   %rax,%rax
+  801728:	0f 84 cc 00 00 00    	je     8017fa <devfile_write_direct+0x102>
+  80172e:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  801731:	48 85 db             	test   %rbx,%rbx
+  801734:	0f 84 ba 00 00 00    	je     8017f4 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  80173a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  801740:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801747:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  80174b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80174f:	4c 29 e3             	sub    %r12,%rbx
+  801752:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801757:	48 39 c3             	cmp    %rax,%rbx
+  80175a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80175e:	48 89 da             	mov    %rbx,%rdx
+  801761:	4c 89 f6             	mov    %r14,%rsi
+  801764:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801768:	48 b8 4d 3e 80 00 00 	movabs $0x803e4d,%rax
+  80176f:	00 00 00 
+  801772:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  801774:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801778:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  80177c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80177f:	44 01 e0             	add    %r12d,%eax
+  801782:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  801786:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80178a:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  801791:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801798:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80179f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017aa:	4c 89 ee             	mov    %r13,%rsi
+  8017ad:	bf 04 00 00 00       	mov    $0x4,%edi
+  8017b2:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  8017b9:	00 00 00 
+  8017bc:	ff d0                	call   *%rax
+        if (res < 0)
+  8017be:	85 c0                	test   %eax,%eax
+  8017c0:	78 29                	js     8017eb <devfile_write_direct+0xf3>
+        if (res == 0)
+  8017c2:	74 2b                	je     8017ef <devfile_write_direct+0xf7>
+        i += res;
+  8017c4:	48 98                	cltq
+  8017c6:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  8017c9:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  8017cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017d0:	49 39 c4             	cmp    %rax,%r12
+  8017d3:	0f 82 72 ff ff ff    	jb     80174b <devfile_write_direct+0x53>
+    return i;
+  8017d9:	4c 89 e0             	mov    %r12,%rax
+}
+  8017dc:	48 83 c4 28          	add    $0x28,%rsp
+  8017e0:	5b                   	pop    %rbx
+  8017e1:	41 5c                	pop    %r12
+  8017e3:	41 5d                	pop    %r13
+  8017e5:	41 5e                	pop    %r14
+  8017e7:	41 5f                	pop    %r15
+  8017e9:	5d                   	pop    %rbp
+  8017ea:	c3                   	ret
+            return res;
+  8017eb:	48 98                	cltq
+  8017ed:	eb ed                	jmp    8017dc <devfile_write_direct+0xe4>
+            return i;
+  8017ef:	4c 89 e0             	mov    %r12,%rax
+  8017f2:	eb e8                	jmp    8017dc <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8017f4:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8017f8:	eb df                	jmp    8017d9 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8017fa:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  801801:	eb d9                	jmp    8017dc <devfile_write_direct+0xe4>
+
+0000000000801803 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  801803:	55                   	push   %rbp
+  801804:	48 89 e5             	mov    %rsp,%rbp
+  801807:	41 56                	push   %r14
+  801809:	41 55                	push   %r13
+  80180b:	41 54                	push   %r12
+  80180d:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  80180e:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  801812:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  801816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181b:	4d 39 ee             	cmp    %r13,%r14
+  80181e:	0f 84 99 00 00 00    	je     8018bd <fbuf_flush+0xba>
+  801824:	49 89 fc             	mov    %rdi,%r12
+  801827:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  80182a:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  80182d:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801831:	48 b8 07 0d 80 00 00 	movabs $0x800d07,%rax
+  801838:	00 00 00 
+  80183b:	ff d0                	call   *%rax
+  80183d:	48 89 c2             	mov    %rax,%rdx
+  801840:	48 c1 e2 04          	shl    $0x4,%rdx
+  801844:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801848:	48 c1 e0 0c          	shl    $0xc,%rax
+  80184c:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801851:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  801854:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801858:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80185f:	00 
+  801860:	44 89 f1             	mov    %r14d,%ecx
+  801863:	4c 89 ea             	mov    %r13,%rdx
+  801866:	4c 89 e7             	mov    %r12,%rdi
+  801869:	48 b8 f8 16 80 00 00 	movabs $0x8016f8,%rax
+  801870:	00 00 00 
+  801873:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801875:	48 85 c0             	test   %rax,%rax
+  801878:	78 43                	js     8018bd <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80187a:	4c 39 e8             	cmp    %r13,%rax
+  80187d:	72 47                	jb     8018c6 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80187f:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  801884:	83 c0 01             	add    $0x1,%eax
+  801887:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80188c:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80188f:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801893:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  801897:	72 0f                	jb     8018a8 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  801899:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80189d:	48 39 c2             	cmp    %rax,%rdx
+  8018a0:	48 0f 42 d0          	cmovb  %rax,%rdx
+  8018a4:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  8018a8:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  8018af:	00 
+  8018b0:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  8018b7:	00 
+    return 0;
+  8018b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018bd:	5b                   	pop    %rbx
+  8018be:	41 5c                	pop    %r12
+  8018c0:	41 5d                	pop    %r13
+  8018c2:	41 5e                	pop    %r14
+  8018c4:	5d                   	pop    %rbp
+  8018c5:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  8018c6:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8018cb:	eb f0                	jmp    8018bd <fbuf_flush+0xba>
+
+00000000008018cd <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  8018cd:	55                   	push   %rbp
+  8018ce:	48 89 e5             	mov    %rsp,%rbp
+  8018d1:	53                   	push   %rbx
+  8018d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8018d6:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  8018d9:	48 b8 db 14 80 00 00 	movabs $0x8014db,%rax
+  8018e0:	00 00 00 
+  8018e3:	ff d0                	call   *%rax
+  8018e5:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  8018e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ed:	48 85 f6             	test   %rsi,%rsi
+  8018f0:	74 0f                	je     801901 <devfile_sync+0x34>
+  8018f2:	48 89 df             	mov    %rbx,%rdi
+  8018f5:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  8018fc:	00 00 00 
+  8018ff:	ff d0                	call   *%rax
+}
+  801901:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801905:	c9                   	leave
+  801906:	c3                   	ret
+
+0000000000801907 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  801907:	55                   	push   %rbp
+  801908:	48 89 e5             	mov    %rsp,%rbp
+  80190b:	48 83 ec 10          	sub    $0x10,%rsp
+  80190f:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  801912:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  801919:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  80191a:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  80191e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801923:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80192a:	00 00 00 
+  80192d:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  801934:	00 00 00 
+  801937:	ff d0                	call   *%rax
+}
+  801939:	c9                   	leave
+  80193a:	c3                   	ret
+
+000000000080193b <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80193b:	55                   	push   %rbp
+  80193c:	48 89 e5             	mov    %rsp,%rbp
+  80193f:	41 54                	push   %r12
+  801941:	53                   	push   %rbx
+  801942:	48 89 fb             	mov    %rdi,%rbx
+  801945:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  801948:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  80194f:	00 00 00 
+  801952:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801954:	85 c0                	test   %eax,%eax
+  801956:	78 63                	js     8019bb <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801958:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80195b:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  801962:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  801964:	be 00 00 00 00       	mov    $0x0,%esi
+  801969:	bf 05 00 00 00       	mov    $0x5,%edi
+  80196e:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  801975:	00 00 00 
+  801978:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80197a:	85 c0                	test   %eax,%eax
+  80197c:	78 3d                	js     8019bb <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80197e:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  801985:	00 00 00 
+  801988:	48 89 de             	mov    %rbx,%rsi
+  80198b:	4c 89 e7             	mov    %r12,%rdi
+  80198e:	48 b8 58 3a 80 00 00 	movabs $0x803a58,%rax
+  801995:	00 00 00 
+  801998:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80199a:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  8019a0:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  8019a7:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019a8:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  8019ae:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  8019b5:	00 
+
+    return 0;
+  8019b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019bb:	5b                   	pop    %rbx
+  8019bc:	41 5c                	pop    %r12
+  8019be:	5d                   	pop    %rbp
+  8019bf:	c3                   	ret
+
+00000000008019c0 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8019c0:	55                   	push   %rbp
+  8019c1:	48 89 e5             	mov    %rsp,%rbp
+  8019c4:	41 54                	push   %r12
+  8019c6:	53                   	push   %rbx
+  8019c7:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  8019ca:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  8019d1:	00 00 00 
+  8019d4:	ff d0                	call   *%rax
+  8019d6:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  8019d9:	48 89 df             	mov    %rbx,%rdi
+  8019dc:	48 b8 07 0d 80 00 00 	movabs $0x800d07,%rax
+  8019e3:	00 00 00 
+  8019e6:	ff d0                	call   *%rax
+  8019e8:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8019ec:	76 2e                	jbe    801a1c <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  8019ee:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8019f1:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8019f8:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8019fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ff:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801a04:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  801a0b:	00 00 00 
+  801a0e:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  801a10:	45 85 e4             	test   %r12d,%r12d
+  801a13:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  801a17:	5b                   	pop    %rbx
+  801a18:	41 5c                	pop    %r12
+  801a1a:	5d                   	pop    %rbp
+  801a1b:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  801a1c:	48 89 df             	mov    %rbx,%rdi
+  801a1f:	48 b8 07 0d 80 00 00 	movabs $0x800d07,%rax
+  801a26:	00 00 00 
+  801a29:	ff d0                	call   *%rax
+  801a2b:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  801a2f:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  801a36:	00 00 00 
+  801a39:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  801a40:	48 89 df             	mov    %rbx,%rdi
+  801a43:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  801a4a:	00 00 00 
+  801a4d:	ff d0                	call   *%rax
+  801a4f:	48 89 c6             	mov    %rax,%rsi
+  801a52:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a57:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a5c:	48 b8 85 04 80 00 00 	movabs $0x800485,%rax
+  801a63:	00 00 00 
+  801a66:	ff d0                	call   *%rax
+  801a68:	eb 84                	jmp    8019ee <devfile_flush+0x2e>
+
+0000000000801a6a <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801a6a:	55                   	push   %rbp
+  801a6b:	48 89 e5             	mov    %rsp,%rbp
+  801a6e:	41 55                	push   %r13
+  801a70:	41 54                	push   %r12
+  801a72:	53                   	push   %rbx
+  801a73:	48 83 ec 08          	sub    $0x8,%rsp
+  801a77:	48 89 fb             	mov    %rdi,%rbx
+  801a7a:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a7d:	48 b8 db 14 80 00 00 	movabs $0x8014db,%rax
+  801a84:	00 00 00 
+  801a87:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a89:	48 85 c0             	test   %rax,%rax
+  801a8c:	74 51                	je     801adf <devfile_trunc+0x75>
+  801a8e:	49 89 c4             	mov    %rax,%r12
+  801a91:	48 89 c6             	mov    %rax,%rsi
+  801a94:	48 89 df             	mov    %rbx,%rdi
+  801a97:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  801a9e:	00 00 00 
+  801aa1:	ff d0                	call   *%rax
+  801aa3:	85 c0                	test   %eax,%eax
+  801aa5:	78 2d                	js     801ad4 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801aa7:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801aae:	00 00 00 
+  801ab1:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801ab4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801ab6:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801aba:	be 00 00 00 00       	mov    $0x0,%esi
+  801abf:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ac4:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  801acb:	00 00 00 
+  801ace:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	79 3e                	jns    801b12 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801ad4:	48 83 c4 08          	add    $0x8,%rsp
+  801ad8:	5b                   	pop    %rbx
+  801ad9:	41 5c                	pop    %r12
+  801adb:	41 5d                	pop    %r13
+  801add:	5d                   	pop    %rbp
+  801ade:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801adf:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801ae6:	00 00 00 
+  801ae9:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801aec:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801aee:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801af2:	be 00 00 00 00       	mov    $0x0,%esi
+  801af7:	bf 02 00 00 00       	mov    $0x2,%edi
+  801afc:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  801b03:	00 00 00 
+  801b06:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 c8                	js     801ad4 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801b0c:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b10:	eb c2                	jmp    801ad4 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801b12:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801b15:	8d 51 01             	lea    0x1(%rcx),%edx
+  801b18:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b1b:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801b20:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801b27:	00 00 
+  801b29:	eb a9                	jmp    801ad4 <devfile_trunc+0x6a>
+
+0000000000801b2b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801b2b:	55                   	push   %rbp
+  801b2c:	48 89 e5             	mov    %rsp,%rbp
+  801b2f:	41 57                	push   %r15
+  801b31:	41 56                	push   %r14
+  801b33:	41 55                	push   %r13
+  801b35:	41 54                	push   %r12
+  801b37:	53                   	push   %rbx
+  801b38:	48 83 ec 28          	sub    $0x28,%rsp
+  801b3c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801b40:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801b44:	49 89 d7             	mov    %rdx,%r15
+  801b47:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801b4b:	48 b8 db 14 80 00 00 	movabs $0x8014db,%rax
+  801b52:	00 00 00 
+  801b55:	ff d0                	call   *%rax
+  801b57:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801b5a:	48 85 c0             	test   %rax,%rax
+  801b5d:	74 31                	je     801b90 <devfile_write+0x65>
+  801b5f:	4c 89 f8             	mov    %r15,%rax
+  801b62:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801b69:	77 25                	ja     801b90 <devfile_write+0x65>
+    size_t i = 0;
+  801b6b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801b71:	48 85 c0             	test   %rax,%rax
+  801b74:	0f 85 64 01 00 00    	jne    801cde <devfile_write+0x1b3>
+    size_t i = 0;
+  801b7a:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b7e:	4c 89 f8             	mov    %r15,%rax
+}
+  801b81:	48 83 c4 28          	add    $0x28,%rsp
+  801b85:	5b                   	pop    %rbx
+  801b86:	41 5c                	pop    %r12
+  801b88:	41 5d                	pop    %r13
+  801b8a:	41 5e                	pop    %r14
+  801b8c:	41 5f                	pop    %r15
+  801b8e:	5d                   	pop    %rbp
+  801b8f:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b90:	48 85 db             	test   %rbx,%rbx
+  801b93:	74 5b                	je     801bf0 <devfile_write+0xc5>
+  801b95:	48 89 de             	mov    %rbx,%rsi
+  801b98:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b9c:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  801ba3:	00 00 00 
+  801ba6:	ff d0                	call   *%rax
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 40                	js     801bec <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801bac:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801bb0:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801bb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bb7:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801bbb:	48 b8 f8 16 80 00 00 	movabs $0x8016f8,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801bc7:	48 85 c0             	test   %rax,%rax
+  801bca:	7e b5                	jle    801b81 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801bcc:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801bd0:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801bd3:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801bd6:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801bd9:	8d 51 01             	lea    0x1(%rcx),%edx
+  801bdc:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801bdf:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801be2:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801be9:	00 
+  801bea:	eb 95                	jmp    801b81 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801bec:	48 98                	cltq
+  801bee:	eb 91                	jmp    801b81 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801bf0:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801bf4:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801bf7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bfb:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801bff:	48 89 df             	mov    %rbx,%rdi
+  801c02:	48 b8 f8 16 80 00 00 	movabs $0x8016f8,%rax
+  801c09:	00 00 00 
+  801c0c:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801c0e:	48 85 c0             	test   %rax,%rax
+  801c11:	0f 8e 6a ff ff ff    	jle    801b81 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801c17:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801c1a:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801c1e:	e9 5e ff ff ff       	jmp    801b81 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801c23:	48 98                	cltq
+  801c25:	4d 85 ff             	test   %r15,%r15
+  801c28:	49 0f 45 c7          	cmovne %r15,%rax
+  801c2c:	e9 50 ff ff ff       	jmp    801b81 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801c31:	48 89 de             	mov    %rbx,%rsi
+  801c34:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c38:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  801c3f:	00 00 00 
+  801c42:	ff d0                	call   *%rax
+  801c44:	85 c0                	test   %eax,%eax
+  801c46:	0f 88 2b 01 00 00    	js     801d77 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c4c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801c50:	4c 01 f8             	add    %r15,%rax
+  801c53:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801c57:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c5b:	48 b9 07 0d 80 00 00 	movabs $0x800d07,%rcx
+  801c62:	00 00 00 
+  801c65:	ff d1                	call   *%rcx
+  801c67:	48 89 c2             	mov    %rax,%rdx
+  801c6a:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c6e:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801c72:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c76:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c7b:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c7e:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c85:	00 
+  801c86:	4c 89 ea             	mov    %r13,%rdx
+  801c89:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c8d:	48 b8 4d 3e 80 00 00 	movabs $0x803e4d,%rax
+  801c94:	00 00 00 
+  801c97:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c99:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c9d:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801ca1:	48 39 c2             	cmp    %rax,%rdx
+  801ca4:	0f 84 db 00 00 00    	je     801d85 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801caa:	4c 39 e2             	cmp    %r12,%rdx
+  801cad:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801cb1:	4d 01 ec             	add    %r13,%r12
+  801cb4:	49 39 c4             	cmp    %rax,%r12
+  801cb7:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801cbb:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801cbf:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801cc3:	45 01 ee             	add    %r13d,%r14d
+  801cc6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cca:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801cce:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801cd1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cd5:	49 39 c7             	cmp    %rax,%r15
+  801cd8:	0f 83 a0 fe ff ff    	jae    801b7e <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801cde:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ce2:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801ce6:	8b 43 08             	mov    0x8(%rbx),%eax
+  801ce9:	44 39 f0             	cmp    %r14d,%eax
+  801cec:	7f 10                	jg     801cfe <devfile_write+0x1d3>
+  801cee:	48 98                	cltq
+  801cf0:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801cf6:	49 63 d6             	movslq %r14d,%rdx
+  801cf9:	48 39 d0             	cmp    %rdx,%rax
+  801cfc:	7d 2d                	jge    801d2b <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801cfe:	48 89 de             	mov    %rbx,%rsi
+  801d01:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801d05:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  801d0c:	00 00 00 
+  801d0f:	ff d0                	call   *%rax
+  801d11:	85 c0                	test   %eax,%eax
+  801d13:	0f 88 0a ff ff ff    	js     801c23 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801d19:	44 89 f0             	mov    %r14d,%eax
+  801d1c:	66 b8 00 00          	mov    $0x0,%ax
+  801d20:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801d23:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801d2a:	00 
+        size_t off = pos - fb->fb_base;
+  801d2b:	45 89 f4             	mov    %r14d,%r12d
+  801d2e:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801d32:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801d35:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801d39:	4d 29 fd             	sub    %r15,%r13
+  801d3c:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801d41:	4c 29 e0             	sub    %r12,%rax
+  801d44:	49 39 c5             	cmp    %rax,%r13
+  801d47:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801d4b:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801d4f:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801d53:	48 39 c2             	cmp    %rax,%rdx
+  801d56:	0f 84 f0 fe ff ff    	je     801c4c <devfile_write+0x121>
+  801d5c:	4c 39 e0             	cmp    %r12,%rax
+  801d5f:	0f 82 cc fe ff ff    	jb     801c31 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801d65:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d69:	48 39 d0             	cmp    %rdx,%rax
+  801d6c:	0f 83 da fe ff ff    	jae    801c4c <devfile_write+0x121>
+  801d72:	e9 ba fe ff ff       	jmp    801c31 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d77:	48 98                	cltq
+  801d79:	4d 85 ff             	test   %r15,%r15
+  801d7c:	49 0f 45 c7          	cmovne %r15,%rax
+  801d80:	e9 fc fd ff ff       	jmp    801b81 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d85:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d89:	4c 89 e2             	mov    %r12,%rdx
+  801d8c:	e9 2a ff ff ff       	jmp    801cbb <devfile_write+0x190>
+
+0000000000801d91 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d91:	55                   	push   %rbp
+  801d92:	48 89 e5             	mov    %rsp,%rbp
+  801d95:	41 57                	push   %r15
+  801d97:	41 56                	push   %r14
+  801d99:	41 55                	push   %r13
+  801d9b:	41 54                	push   %r12
+  801d9d:	53                   	push   %rbx
+  801d9e:	48 83 ec 28          	sub    $0x28,%rsp
+  801da2:	49 89 ff             	mov    %rdi,%r15
+  801da5:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801da9:	48 89 d3             	mov    %rdx,%rbx
+  801dac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801db0:	48 b8 db 14 80 00 00 	movabs $0x8014db,%rax
+  801db7:	00 00 00 
+  801dba:	ff d0                	call   *%rax
+  801dbc:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801dbf:	48 85 c0             	test   %rax,%rax
+  801dc2:	74 0d                	je     801dd1 <devfile_read+0x40>
+  801dc4:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801dcb:	0f 86 1a 01 00 00    	jbe    801eeb <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801dd1:	4d 85 e4             	test   %r12,%r12
+  801dd4:	74 1a                	je     801df0 <devfile_read+0x5f>
+  801dd6:	4c 89 e6             	mov    %r12,%rsi
+  801dd9:	4c 89 ff             	mov    %r15,%rdi
+  801ddc:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  801de3:	00 00 00 
+  801de6:	ff d0                	call   *%rax
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	0f 88 e8 00 00 00    	js     801ed8 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801df0:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801df4:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  801dfb:	00 00 00 
+  801dfe:	ff d0                	call   *%rax
+  801e00:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801e03:	48 85 c0             	test   %rax,%rax
+  801e06:	0f 84 69 02 00 00    	je     802075 <devfile_read+0x2e4>
+    while (i < n) {
+  801e0c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e11:	0f 84 ce 00 00 00    	je     801ee5 <devfile_read+0x154>
+    size_t i = 0;
+  801e17:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e1c:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801e23:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801e27:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801e2b:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801e2f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e33:	48 29 da             	sub    %rbx,%rdx
+  801e36:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801e3b:	48 39 c2             	cmp    %rax,%rdx
+  801e3e:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801e42:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801e46:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801e4a:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801e4d:	01 d8                	add    %ebx,%eax
+  801e4f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801e53:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801e57:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801e5e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801e65:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801e6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e77:	4c 89 ee             	mov    %r13,%rsi
+  801e7a:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e7f:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  801e86:	00 00 00 
+  801e89:	ff d0                	call   *%rax
+        if (res < 0)
+  801e8b:	85 c0                	test   %eax,%eax
+  801e8d:	78 4d                	js     801edc <devfile_read+0x14b>
+        if (res == 0)
+  801e8f:	74 4f                	je     801ee0 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e91:	4c 63 e0             	movslq %eax,%r12
+  801e94:	4c 89 e2             	mov    %r12,%rdx
+  801e97:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e9b:	4c 89 f7             	mov    %r14,%rdi
+  801e9e:	48 b8 4d 3e 80 00 00 	movabs $0x803e4d,%rax
+  801ea5:	00 00 00 
+  801ea8:	ff d0                	call   *%rax
+        i += res;
+  801eaa:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801ead:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801eb0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eb4:	48 39 c3             	cmp    %rax,%rbx
+  801eb7:	0f 82 72 ff ff ff    	jb     801e2f <devfile_read+0x9e>
+    return i;
+  801ebd:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801ec0:	48 85 c0             	test   %rax,%rax
+  801ec3:	7e 04                	jle    801ec9 <devfile_read+0x138>
+  801ec5:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801ec9:	48 83 c4 28          	add    $0x28,%rsp
+  801ecd:	5b                   	pop    %rbx
+  801ece:	41 5c                	pop    %r12
+  801ed0:	41 5d                	pop    %r13
+  801ed2:	41 5e                	pop    %r14
+  801ed4:	41 5f                	pop    %r15
+  801ed6:	5d                   	pop    %rbp
+  801ed7:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801ed8:	48 98                	cltq
+  801eda:	eb ed                	jmp    801ec9 <devfile_read+0x138>
+            return res;
+  801edc:	48 98                	cltq
+  801ede:	eb e9                	jmp    801ec9 <devfile_read+0x138>
+            return i;
+  801ee0:	48 89 d8             	mov    %rbx,%rax
+  801ee3:	eb db                	jmp    801ec0 <devfile_read+0x12f>
+    size_t i = 0;
+  801ee5:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801ee9:	eb d2                	jmp    801ebd <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801eeb:	48 89 c6             	mov    %rax,%rsi
+  801eee:	4c 89 ff             	mov    %r15,%rdi
+  801ef1:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  801ef8:	00 00 00 
+  801efb:	ff d0                	call   *%rax
+  801efd:	85 c0                	test   %eax,%eax
+  801eff:	78 40                	js     801f41 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801f01:	4c 89 ff             	mov    %r15,%rdi
+  801f04:	48 b8 07 0d 80 00 00 	movabs $0x800d07,%rax
+  801f0b:	00 00 00 
+  801f0e:	ff d0                	call   *%rax
+  801f10:	48 89 c2             	mov    %rax,%rdx
+  801f13:	48 c1 e2 04          	shl    $0x4,%rdx
+  801f17:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801f1b:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f1f:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801f24:	48 01 d0             	add    %rdx,%rax
+  801f27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801f2b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801f30:	0f 84 33 01 00 00    	je     802069 <devfile_read+0x2d8>
+    size_t i = 0;
+  801f36:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801f3c:	e9 f5 00 00 00       	jmp    802036 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801f41:	48 98                	cltq
+  801f43:	eb 84                	jmp    801ec9 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801f45:	44 89 e8             	mov    %r13d,%eax
+  801f48:	66 b8 00 00          	mov    $0x0,%ax
+  801f4c:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801f51:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801f58:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801f5a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801f5e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801f62:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801f64:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801f69:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801f6c:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801f73:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801f74:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f7f:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f84:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f89:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  801f90:	00 00 00 
+  801f93:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f95:	85 c0                	test   %eax,%eax
+  801f97:	0f 88 be 00 00 00    	js     80205b <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f9d:	48 63 d0             	movslq %eax,%rdx
+  801fa0:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801fa5:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801faa:	44 39 e8             	cmp    %r13d,%eax
+  801fad:	0f 8e ba 00 00 00    	jle    80206d <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801fb3:	49 63 c5             	movslq %r13d,%rax
+  801fb6:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801fbb:	48 29 c3             	sub    %rax,%rbx
+  801fbe:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801fc3:	48 01 c3             	add    %rax,%rbx
+  801fc6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fca:	4c 29 f0             	sub    %r14,%rax
+  801fcd:	48 39 c3             	cmp    %rax,%rbx
+  801fd0:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801fd4:	4c 89 ff             	mov    %r15,%rdi
+  801fd7:	48 b9 07 0d 80 00 00 	movabs $0x800d07,%rcx
+  801fde:	00 00 00 
+  801fe1:	ff d1                	call   *%rcx
+  801fe3:	48 89 c2             	mov    %rax,%rdx
+  801fe6:	48 c1 e2 04          	shl    $0x4,%rdx
+  801fea:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801fee:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ff2:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801ff7:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801ffa:	44 89 ea             	mov    %r13d,%edx
+  801ffd:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  802002:	48 63 d2             	movslq %edx,%rdx
+  802005:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80200c:	00 
+  80200d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802011:	4c 01 f7             	add    %r14,%rdi
+  802014:	48 89 da             	mov    %rbx,%rdx
+  802017:	48 b9 4d 3e 80 00 00 	movabs $0x803e4d,%rcx
+  80201e:	00 00 00 
+  802021:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  802023:	41 01 dd             	add    %ebx,%r13d
+  802026:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  80202a:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80202d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802031:	49 39 c6             	cmp    %rax,%r14
+  802034:	73 37                	jae    80206d <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  802036:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  80203a:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80203f:	44 39 e8             	cmp    %r13d,%eax
+  802042:	0f 8f fd fe ff ff    	jg     801f45 <devfile_read+0x1b4>
+  802048:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80204d:	44 39 e8             	cmp    %r13d,%eax
+  802050:	0f 8f 5d ff ff ff    	jg     801fb3 <devfile_read+0x222>
+  802056:	e9 ea fe ff ff       	jmp    801f45 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80205b:	48 98                	cltq
+  80205d:	4d 85 f6             	test   %r14,%r14
+  802060:	49 0f 45 c6          	cmovne %r14,%rax
+  802064:	e9 60 fe ff ff       	jmp    801ec9 <devfile_read+0x138>
+    size_t i = 0;
+  802069:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80206d:	4c 89 f0             	mov    %r14,%rax
+  802070:	e9 54 fe ff ff       	jmp    801ec9 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  802075:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80207c:	e9 48 fe ff ff       	jmp    801ec9 <devfile_read+0x138>
+
+0000000000802081 <open>:
+open(const char *path, int mode) {
+  802081:	55                   	push   %rbp
+  802082:	48 89 e5             	mov    %rsp,%rbp
+  802085:	41 55                	push   %r13
+  802087:	41 54                	push   %r12
+  802089:	53                   	push   %rbx
+  80208a:	48 83 ec 18          	sub    $0x18,%rsp
+  80208e:	49 89 fc             	mov    %rdi,%r12
+  802091:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802094:	48 b8 1a 3a 80 00 00 	movabs $0x803a1a,%rax
+  80209b:	00 00 00 
+  80209e:	ff d0                	call   *%rax
+  8020a0:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8020a6:	0f 87 8a 00 00 00    	ja     802136 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8020ac:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8020b0:	48 b8 35 0d 80 00 00 	movabs $0x800d35,%rax
+  8020b7:	00 00 00 
+  8020ba:	ff d0                	call   *%rax
+  8020bc:	89 c3                	mov    %eax,%ebx
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	78 50                	js     802112 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8020c2:	4c 89 e6             	mov    %r12,%rsi
+  8020c5:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8020cc:	00 00 00 
+  8020cf:	48 89 df             	mov    %rbx,%rdi
+  8020d2:	48 b8 58 3a 80 00 00 	movabs $0x803a58,%rax
+  8020d9:	00 00 00 
+  8020dc:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8020de:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020e5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8020e9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020ee:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  8020f5:	00 00 00 
+  8020f8:	ff d0                	call   *%rax
+  8020fa:	89 c3                	mov    %eax,%ebx
+  8020fc:	85 c0                	test   %eax,%eax
+  8020fe:	78 1f                	js     80211f <open+0x9e>
+    return fd2num(fd);
+  802100:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802104:	48 b8 07 0d 80 00 00 	movabs $0x800d07,%rax
+  80210b:	00 00 00 
+  80210e:	ff d0                	call   *%rax
+  802110:	89 c3                	mov    %eax,%ebx
+}
+  802112:	89 d8                	mov    %ebx,%eax
+  802114:	48 83 c4 18          	add    $0x18,%rsp
+  802118:	5b                   	pop    %rbx
+  802119:	41 5c                	pop    %r12
+  80211b:	41 5d                	pop    %r13
+  80211d:	5d                   	pop    %rbp
+  80211e:	c3                   	ret
+        fd_close(fd, 0);
+  80211f:	be 00 00 00 00       	mov    $0x0,%esi
+  802124:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802128:	48 b8 50 0e 80 00 00 	movabs $0x800e50,%rax
+  80212f:	00 00 00 
+  802132:	ff d0                	call   *%rax
+        return res;
+  802134:	eb dc                	jmp    802112 <open+0x91>
+        return -E_BAD_PATH;
+  802136:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80213b:	eb d5                	jmp    802112 <open+0x91>
+
+000000000080213d <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80213d:	55                   	push   %rbp
+  80213e:	48 89 e5             	mov    %rsp,%rbp
+  802141:	41 57                	push   %r15
+  802143:	41 56                	push   %r14
+  802145:	41 55                	push   %r13
+  802147:	41 54                	push   %r12
+  802149:	53                   	push   %rbx
+  80214a:	48 83 ec 18          	sub    $0x18,%rsp
+  80214e:	41 89 f6             	mov    %esi,%r14d
+  802151:	49 89 d7             	mov    %rdx,%r15
+  802154:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802157:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80215b:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  802162:	00 00 00 
+  802165:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802167:	85 c0                	test   %eax,%eax
+  802169:	0f 88 db 00 00 00    	js     80224a <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80216f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802173:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80217a:	00 00 00 
+  80217d:	8b 00                	mov    (%rax),%eax
+  80217f:	39 07                	cmp    %eax,(%rdi)
+  802181:	0f 85 db 00 00 00    	jne    802262 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802187:	45 85 f6             	test   %r14d,%r14d
+  80218a:	0f 88 db 00 00 00    	js     80226b <fmap+0x12e>
+  802190:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802197:	0f 85 d7 00 00 00    	jne    802274 <fmap+0x137>
+  80219d:	4c 89 fb             	mov    %r15,%rbx
+  8021a0:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8021a6:	0f 85 d1 00 00 00    	jne    80227d <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8021ac:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  8021b3:	00 00 00 
+  8021b6:	ff d0                	call   *%rax
+  8021b8:	85 c0                	test   %eax,%eax
+  8021ba:	0f 88 8e 00 00 00    	js     80224e <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8021c0:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8021c7:	00 00 00 
+    while (i < n) {
+  8021ca:	4d 85 ed             	test   %r13,%r13
+  8021cd:	0f 84 8a 00 00 00    	je     80225d <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8021d3:	4c 89 ea             	mov    %r13,%rdx
+  8021d6:	48 29 da             	sub    %rbx,%rdx
+  8021d9:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8021e0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8021e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8021ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021ee:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021f1:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8021f5:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8021f9:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8021fe:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  802203:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  802207:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80220b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802210:	4c 89 e6             	mov    %r12,%rsi
+  802213:	bf 09 00 00 00       	mov    $0x9,%edi
+  802218:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  802224:	85 c0                	test   %eax,%eax
+  802226:	78 2a                	js     802252 <fmap+0x115>
+        i += res;
+  802228:	48 98                	cltq
+  80222a:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80222d:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  802231:	72 05                	jb     802238 <fmap+0xfb>
+    while (i < n) {
+  802233:	4c 39 eb             	cmp    %r13,%rbx
+  802236:	72 9b                	jb     8021d3 <fmap+0x96>
+    }
+    return i;
+  802238:	48 89 d8             	mov    %rbx,%rax
+}
+  80223b:	48 83 c4 18          	add    $0x18,%rsp
+  80223f:	5b                   	pop    %rbx
+  802240:	41 5c                	pop    %r12
+  802242:	41 5d                	pop    %r13
+  802244:	41 5e                	pop    %r14
+  802246:	41 5f                	pop    %r15
+  802248:	5d                   	pop    %rbp
+  802249:	c3                   	ret
+    if (res < 0) return res;
+  80224a:	48 98                	cltq
+  80224c:	eb ed                	jmp    80223b <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80224e:	48 98                	cltq
+  802250:	eb e9                	jmp    80223b <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  802252:	48 98                	cltq
+  802254:	48 85 db             	test   %rbx,%rbx
+  802257:	48 0f 45 c3          	cmovne %rbx,%rax
+  80225b:	eb de                	jmp    80223b <fmap+0xfe>
+    size_t i = 0;
+  80225d:	4c 89 eb             	mov    %r13,%rbx
+  802260:	eb d6                	jmp    802238 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802262:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802269:	eb d0                	jmp    80223b <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80226b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802272:	eb c7                	jmp    80223b <fmap+0xfe>
+  802274:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80227b:	eb be                	jmp    80223b <fmap+0xfe>
+  80227d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802284:	eb b5                	jmp    80223b <fmap+0xfe>
+
+0000000000802286 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  802286:	55                   	push   %rbp
+  802287:	48 89 e5             	mov    %rsp,%rbp
+  80228a:	41 56                	push   %r14
+  80228c:	41 55                	push   %r13
+  80228e:	41 54                	push   %r12
+  802290:	53                   	push   %rbx
+  802291:	48 83 ec 10          	sub    $0x10,%rsp
+  802295:	89 fb                	mov    %edi,%ebx
+  802297:	41 89 f4             	mov    %esi,%r12d
+  80229a:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80229d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022a1:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  8022a8:	00 00 00 
+  8022ab:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022ad:	85 c0                	test   %eax,%eax
+  8022af:	78 63                	js     802314 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8022b1:	45 85 e4             	test   %r12d,%r12d
+  8022b4:	0f 88 80 00 00 00    	js     80233a <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8022ba:	45 89 e6             	mov    %r12d,%r14d
+  8022bd:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8022c4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022c8:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  8022cf:	00 00 00 
+  8022d2:	ff d0                	call   *%rax
+  8022d4:	48 89 c2             	mov    %rax,%rdx
+  8022d7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022dc:	44 89 f6             	mov    %r14d,%esi
+  8022df:	89 df                	mov    %ebx,%edi
+  8022e1:	48 b8 3d 21 80 00 00 	movabs $0x80213d,%rax
+  8022e8:	00 00 00 
+  8022eb:	ff d0                	call   *%rax
+  8022ed:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8022f0:	45 29 f4             	sub    %r14d,%r12d
+  8022f3:	4d 63 f4             	movslq %r12d,%r14
+  8022f6:	49 39 c6             	cmp    %rax,%r14
+  8022f9:	7c 1d                	jl     802318 <read_map+0x92>
+  8022fb:	48 85 c0             	test   %rax,%rax
+  8022fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802303:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  802307:	48 83 c4 10          	add    $0x10,%rsp
+  80230b:	5b                   	pop    %rbx
+  80230c:	41 5c                	pop    %r12
+  80230e:	41 5d                	pop    %r13
+  802310:	41 5e                	pop    %r14
+  802312:	5d                   	pop    %rbp
+  802313:	c3                   	ret
+    if (res < 0) return res;
+  802314:	48 98                	cltq
+  802316:	eb ef                	jmp    802307 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  802318:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80231c:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  802323:	00 00 00 
+  802326:	ff d0                	call   *%rax
+  802328:	4d 63 e4             	movslq %r12d,%r12
+  80232b:	4c 01 e0             	add    %r12,%rax
+  80232e:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  802332:	48 89 d8             	mov    %rbx,%rax
+  802335:	4c 29 f0             	sub    %r14,%rax
+  802338:	eb cd                	jmp    802307 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  80233a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802341:	eb c4                	jmp    802307 <read_map+0x81>
+
+0000000000802343 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  802343:	55                   	push   %rbp
+  802344:	48 89 e5             	mov    %rsp,%rbp
+  802347:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80234b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80234f:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  802356:	00 00 00 
+  802359:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80235b:	85 c0                	test   %eax,%eax
+  80235d:	78 4a                	js     8023a9 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80235f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802363:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80236a:	00 00 00 
+  80236d:	8b 00                	mov    (%rax),%eax
+  80236f:	39 07                	cmp    %eax,(%rdi)
+  802371:	75 38                	jne    8023ab <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802373:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  80237a:	00 00 00 
+  80237d:	ff d0                	call   *%rax
+  80237f:	85 c0                	test   %eax,%eax
+  802381:	78 26                	js     8023a9 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802383:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802387:	8b 40 0c             	mov    0xc(%rax),%eax
+  80238a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802391:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802393:	be 00 00 00 00       	mov    $0x0,%esi
+  802398:	bf 06 00 00 00       	mov    $0x6,%edi
+  80239d:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  8023a4:	00 00 00 
+  8023a7:	ff d0                	call   *%rax
+}
+  8023a9:	c9                   	leave
+  8023aa:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8023ab:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023b0:	eb f7                	jmp    8023a9 <fsync+0x66>
+
+00000000008023b2 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8023b2:	55                   	push   %rbp
+  8023b3:	48 89 e5             	mov    %rsp,%rbp
+  8023b6:	41 57                	push   %r15
+  8023b8:	41 56                	push   %r14
+  8023ba:	41 55                	push   %r13
+  8023bc:	41 54                	push   %r12
+  8023be:	53                   	push   %rbx
+  8023bf:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8023c3:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8023ca:	00 00 00 
+  8023cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8023d2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023d8:	49 bd 95 0d 80 00 00 	movabs $0x800d95,%r13
+  8023df:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8023e2:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8023e9:	00 00 00 
+  8023ec:	eb 0c                	jmp    8023fa <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8023ee:	83 c3 01             	add    $0x1,%ebx
+  8023f1:	49 83 c4 28          	add    $0x28,%r12
+  8023f5:	83 fb 20             	cmp    $0x20,%ebx
+  8023f8:	74 33                	je     80242d <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023fa:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8023ff:	74 ed                	je     8023ee <flushall+0x3c>
+  802401:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802405:	89 df                	mov    %ebx,%edi
+  802407:	41 ff d5             	call   *%r13
+  80240a:	85 c0                	test   %eax,%eax
+  80240c:	78 e0                	js     8023ee <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80240e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802412:	41 8b 06             	mov    (%r14),%eax
+  802415:	39 07                	cmp    %eax,(%rdi)
+  802417:	75 d5                	jne    8023ee <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  802419:	48 b8 cd 18 80 00 00 	movabs $0x8018cd,%rax
+  802420:	00 00 00 
+  802423:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  802425:	85 c0                	test   %eax,%eax
+  802427:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80242b:	eb c1                	jmp    8023ee <flushall+0x3c>
+    }
+    return res;
+}
+  80242d:	44 89 f8             	mov    %r15d,%eax
+  802430:	48 83 c4 18          	add    $0x18,%rsp
+  802434:	5b                   	pop    %rbx
+  802435:	41 5c                	pop    %r12
+  802437:	41 5d                	pop    %r13
+  802439:	41 5e                	pop    %r14
+  80243b:	41 5f                	pop    %r15
+  80243d:	5d                   	pop    %rbp
+  80243e:	c3                   	ret
+
+000000000080243f <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80243f:	55                   	push   %rbp
+  802440:	48 89 e5             	mov    %rsp,%rbp
+  802443:	53                   	push   %rbx
+  802444:	48 83 ec 08          	sub    $0x8,%rsp
+  802448:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80244b:	40 0f b6 c6          	movzbl %sil,%eax
+  80244f:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802456:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  802458:	be 00 00 00 00       	mov    $0x0,%esi
+  80245d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802462:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  802469:	00 00 00 
+  80246c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80246e:	85 c0                	test   %eax,%eax
+  802470:	78 23                	js     802495 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  802472:	ba 58 06 00 00       	mov    $0x658,%edx
+  802477:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80247e:	00 00 00 
+  802481:	48 89 df             	mov    %rbx,%rdi
+  802484:	48 b8 4d 3e 80 00 00 	movabs $0x803e4d,%rax
+  80248b:	00 00 00 
+  80248e:	ff d0                	call   *%rax
+    return 0;
+  802490:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802495:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802499:	c9                   	leave
+  80249a:	c3                   	ret
+
+000000000080249b <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80249b:	55                   	push   %rbp
+  80249c:	48 89 e5             	mov    %rsp,%rbp
+  80249f:	53                   	push   %rbx
+  8024a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024a4:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8024a7:	48 b8 1a 3a 80 00 00 	movabs $0x803a1a,%rax
+  8024ae:	00 00 00 
+  8024b1:	ff d0                	call   *%rax
+  8024b3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024b9:	77 35                	ja     8024f0 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8024bb:	48 89 de             	mov    %rbx,%rsi
+  8024be:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8024c5:	00 00 00 
+  8024c8:	48 b8 58 3a 80 00 00 	movabs $0x803a58,%rax
+  8024cf:	00 00 00 
+  8024d2:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8024d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d9:	bf 07 00 00 00       	mov    $0x7,%edi
+  8024de:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  8024e5:	00 00 00 
+  8024e8:	ff d0                	call   *%rax
+}
+  8024ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+        return -E_BAD_PATH;
+  8024f0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8024f5:	eb f3                	jmp    8024ea <remove+0x4f>
+
+00000000008024f7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024f7:	55                   	push   %rbp
+  8024f8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8024fb:	48 b8 b2 23 80 00 00 	movabs $0x8023b2,%rax
+  802502:	00 00 00 
+  802505:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802507:	be 00 00 00 00       	mov    $0x0,%esi
+  80250c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802511:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  802518:	00 00 00 
+  80251b:	ff d0                	call   *%rax
+}
+  80251d:	5d                   	pop    %rbp
+  80251e:	c3                   	ret
+
+000000000080251f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80251f:	55                   	push   %rbp
+  802520:	48 89 e5             	mov    %rsp,%rbp
+  802523:	41 54                	push   %r12
+  802525:	53                   	push   %rbx
+  802526:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802529:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  802530:	00 00 00 
+  802533:	ff d0                	call   *%rax
+  802535:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802538:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  80253f:	00 00 00 
+  802542:	48 89 df             	mov    %rbx,%rdi
+  802545:	48 b8 58 3a 80 00 00 	movabs $0x803a58,%rax
+  80254c:	00 00 00 
+  80254f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802551:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802556:	41 2b 04 24          	sub    (%r12),%eax
+  80255a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802560:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802567:	00 00 00 
+    stat->st_dev = &devpipe;
+  80256a:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802571:	00 00 00 
+  802574:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80257b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802580:	5b                   	pop    %rbx
+  802581:	41 5c                	pop    %r12
+  802583:	5d                   	pop    %rbp
+  802584:	c3                   	ret
+
+0000000000802585 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802585:	55                   	push   %rbp
+  802586:	48 89 e5             	mov    %rsp,%rbp
+  802589:	41 54                	push   %r12
+  80258b:	53                   	push   %rbx
+  80258c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80258f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802594:	48 89 fe             	mov    %rdi,%rsi
+  802597:	bf 00 00 00 00       	mov    $0x0,%edi
+  80259c:	49 bc 85 04 80 00 00 	movabs $0x800485,%r12
+  8025a3:	00 00 00 
+  8025a6:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8025a9:	48 89 df             	mov    %rbx,%rdi
+  8025ac:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  8025b3:	00 00 00 
+  8025b6:	ff d0                	call   *%rax
+  8025b8:	48 89 c6             	mov    %rax,%rsi
+  8025bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c5:	41 ff d4             	call   *%r12
+}
+  8025c8:	5b                   	pop    %rbx
+  8025c9:	41 5c                	pop    %r12
+  8025cb:	5d                   	pop    %rbp
+  8025cc:	c3                   	ret
+
+00000000008025cd <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025cd:	55                   	push   %rbp
+  8025ce:	48 89 e5             	mov    %rsp,%rbp
+  8025d1:	41 57                	push   %r15
+  8025d3:	41 56                	push   %r14
+  8025d5:	41 55                	push   %r13
+  8025d7:	41 54                	push   %r12
+  8025d9:	53                   	push   %rbx
+  8025da:	48 83 ec 18          	sub    $0x18,%rsp
+  8025de:	49 89 fc             	mov    %rdi,%r12
+  8025e1:	49 89 f5             	mov    %rsi,%r13
+  8025e4:	49 89 d7             	mov    %rdx,%r15
+  8025e7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025eb:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  8025f2:	00 00 00 
+  8025f5:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025f7:	4d 85 ff             	test   %r15,%r15
+  8025fa:	0f 84 af 00 00 00    	je     8026af <devpipe_write+0xe2>
+  802600:	48 89 c3             	mov    %rax,%rbx
+  802603:	4c 89 f8             	mov    %r15,%rax
+  802606:	4d 89 ef             	mov    %r13,%r15
+  802609:	4c 01 e8             	add    %r13,%rax
+  80260c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802610:	49 bd 7a 02 80 00 00 	movabs $0x80027a,%r13
+  802617:	00 00 00 
+            sys_yield();
+  80261a:	49 be 17 02 80 00 00 	movabs $0x800217,%r14
+  802621:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802624:	8b 73 04             	mov    0x4(%rbx),%esi
+  802627:	48 63 ce             	movslq %esi,%rcx
+  80262a:	48 63 03             	movslq (%rbx),%rax
+  80262d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802633:	48 39 c1             	cmp    %rax,%rcx
+  802636:	72 2e                	jb     802666 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802638:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80263d:	48 89 da             	mov    %rbx,%rdx
+  802640:	be 00 10 00 00       	mov    $0x1000,%esi
+  802645:	4c 89 e7             	mov    %r12,%rdi
+  802648:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80264b:	85 c0                	test   %eax,%eax
+  80264d:	74 66                	je     8026b5 <devpipe_write+0xe8>
+            sys_yield();
+  80264f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802652:	8b 73 04             	mov    0x4(%rbx),%esi
+  802655:	48 63 ce             	movslq %esi,%rcx
+  802658:	48 63 03             	movslq (%rbx),%rax
+  80265b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802661:	48 39 c1             	cmp    %rax,%rcx
+  802664:	73 d2                	jae    802638 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802666:	41 0f b6 3f          	movzbl (%r15),%edi
+  80266a:	48 89 ca             	mov    %rcx,%rdx
+  80266d:	48 c1 ea 03          	shr    $0x3,%rdx
+  802671:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802678:	08 10 20 
+  80267b:	48 f7 e2             	mul    %rdx
+  80267e:	48 c1 ea 06          	shr    $0x6,%rdx
+  802682:	48 89 d0             	mov    %rdx,%rax
+  802685:	48 c1 e0 09          	shl    $0x9,%rax
+  802689:	48 29 d0             	sub    %rdx,%rax
+  80268c:	48 c1 e0 03          	shl    $0x3,%rax
+  802690:	48 29 c1             	sub    %rax,%rcx
+  802693:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802698:	83 c6 01             	add    $0x1,%esi
+  80269b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80269e:	49 83 c7 01          	add    $0x1,%r15
+  8026a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026a6:	49 39 c7             	cmp    %rax,%r15
+  8026a9:	0f 85 75 ff ff ff    	jne    802624 <devpipe_write+0x57>
+    return n;
+  8026af:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026b3:	eb 05                	jmp    8026ba <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8026b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026ba:	48 83 c4 18          	add    $0x18,%rsp
+  8026be:	5b                   	pop    %rbx
+  8026bf:	41 5c                	pop    %r12
+  8026c1:	41 5d                	pop    %r13
+  8026c3:	41 5e                	pop    %r14
+  8026c5:	41 5f                	pop    %r15
+  8026c7:	5d                   	pop    %rbp
+  8026c8:	c3                   	ret
+
+00000000008026c9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8026c9:	55                   	push   %rbp
+  8026ca:	48 89 e5             	mov    %rsp,%rbp
+  8026cd:	41 57                	push   %r15
+  8026cf:	41 56                	push   %r14
+  8026d1:	41 55                	push   %r13
+  8026d3:	41 54                	push   %r12
+  8026d5:	53                   	push   %rbx
+  8026d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8026da:	49 89 fc             	mov    %rdi,%r12
+  8026dd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026e1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026e5:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  8026ec:	00 00 00 
+  8026ef:	ff d0                	call   *%rax
+  8026f1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026f4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026fa:	49 bd 7a 02 80 00 00 	movabs $0x80027a,%r13
+  802701:	00 00 00 
+            sys_yield();
+  802704:	49 be 17 02 80 00 00 	movabs $0x800217,%r14
+  80270b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80270e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802713:	74 7d                	je     802792 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802715:	8b 03                	mov    (%rbx),%eax
+  802717:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80271a:	75 26                	jne    802742 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80271c:	4d 85 ff             	test   %r15,%r15
+  80271f:	75 77                	jne    802798 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802721:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802726:	48 89 da             	mov    %rbx,%rdx
+  802729:	be 00 10 00 00       	mov    $0x1000,%esi
+  80272e:	4c 89 e7             	mov    %r12,%rdi
+  802731:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802734:	85 c0                	test   %eax,%eax
+  802736:	74 72                	je     8027aa <devpipe_read+0xe1>
+            sys_yield();
+  802738:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80273b:	8b 03                	mov    (%rbx),%eax
+  80273d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802740:	74 df                	je     802721 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802742:	48 63 c8             	movslq %eax,%rcx
+  802745:	48 89 ca             	mov    %rcx,%rdx
+  802748:	48 c1 ea 03          	shr    $0x3,%rdx
+  80274c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802753:	08 10 20 
+  802756:	48 89 d0             	mov    %rdx,%rax
+  802759:	48 f7 e6             	mul    %rsi
+  80275c:	48 c1 ea 06          	shr    $0x6,%rdx
+  802760:	48 89 d0             	mov    %rdx,%rax
+  802763:	48 c1 e0 09          	shl    $0x9,%rax
+  802767:	48 29 d0             	sub    %rdx,%rax
+  80276a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802771:	00 
+  802772:	48 89 c8             	mov    %rcx,%rax
+  802775:	48 29 d0             	sub    %rdx,%rax
+  802778:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80277d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802781:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802785:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802788:	49 83 c7 01          	add    $0x1,%r15
+  80278c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802790:	75 83                	jne    802715 <devpipe_read+0x4c>
+    return n;
+  802792:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802796:	eb 03                	jmp    80279b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802798:	4c 89 f8             	mov    %r15,%rax
+}
+  80279b:	48 83 c4 18          	add    $0x18,%rsp
+  80279f:	5b                   	pop    %rbx
+  8027a0:	41 5c                	pop    %r12
+  8027a2:	41 5d                	pop    %r13
+  8027a4:	41 5e                	pop    %r14
+  8027a6:	41 5f                	pop    %r15
+  8027a8:	5d                   	pop    %rbp
+  8027a9:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8027aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027af:	eb ea                	jmp    80279b <devpipe_read+0xd2>
+
+00000000008027b1 <pipe>:
+pipe(int pfd[2]) {
+  8027b1:	55                   	push   %rbp
+  8027b2:	48 89 e5             	mov    %rsp,%rbp
+  8027b5:	41 55                	push   %r13
+  8027b7:	41 54                	push   %r12
+  8027b9:	53                   	push   %rbx
+  8027ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8027be:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027c1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027c5:	48 b8 35 0d 80 00 00 	movabs $0x800d35,%rax
+  8027cc:	00 00 00 
+  8027cf:	ff d0                	call   *%rax
+  8027d1:	89 c3                	mov    %eax,%ebx
+  8027d3:	85 c0                	test   %eax,%eax
+  8027d5:	0f 88 a0 01 00 00    	js     80297b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8027db:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027e5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8027e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ee:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  8027f5:	00 00 00 
+  8027f8:	ff d0                	call   *%rax
+  8027fa:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027fc:	85 c0                	test   %eax,%eax
+  8027fe:	0f 88 77 01 00 00    	js     80297b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802804:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802808:	48 b8 35 0d 80 00 00 	movabs $0x800d35,%rax
+  80280f:	00 00 00 
+  802812:	ff d0                	call   *%rax
+  802814:	89 c3                	mov    %eax,%ebx
+  802816:	85 c0                	test   %eax,%eax
+  802818:	0f 88 43 01 00 00    	js     802961 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80281e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802823:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802828:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80282c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802831:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  802838:	00 00 00 
+  80283b:	ff d0                	call   *%rax
+  80283d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80283f:	85 c0                	test   %eax,%eax
+  802841:	0f 88 1a 01 00 00    	js     802961 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802847:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80284b:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  802852:	00 00 00 
+  802855:	ff d0                	call   *%rax
+  802857:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80285a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80285f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802864:	48 89 c6             	mov    %rax,%rsi
+  802867:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286c:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  802873:	00 00 00 
+  802876:	ff d0                	call   *%rax
+  802878:	89 c3                	mov    %eax,%ebx
+  80287a:	85 c0                	test   %eax,%eax
+  80287c:	0f 88 c5 00 00 00    	js     802947 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802882:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802886:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  80288d:	00 00 00 
+  802890:	ff d0                	call   *%rax
+  802892:	48 89 c1             	mov    %rax,%rcx
+  802895:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80289b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8028a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028a6:	4c 89 ee             	mov    %r13,%rsi
+  8028a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ae:	48 b8 0d 03 80 00 00 	movabs $0x80030d,%rax
+  8028b5:	00 00 00 
+  8028b8:	ff d0                	call   *%rax
+  8028ba:	89 c3                	mov    %eax,%ebx
+  8028bc:	85 c0                	test   %eax,%eax
+  8028be:	78 6e                	js     80292e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028c0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028c5:	4c 89 ef             	mov    %r13,%rdi
+  8028c8:	48 b8 48 02 80 00 00 	movabs $0x800248,%rax
+  8028cf:	00 00 00 
+  8028d2:	ff d0                	call   *%rax
+  8028d4:	83 f8 02             	cmp    $0x2,%eax
+  8028d7:	0f 85 ab 00 00 00    	jne    802988 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028dd:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8028e4:	00 00 
+  8028e6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028ea:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028ec:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028f0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028f7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028fb:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802901:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802908:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80290c:	48 bb 07 0d 80 00 00 	movabs $0x800d07,%rbx
+  802913:	00 00 00 
+  802916:	ff d3                	call   *%rbx
+  802918:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80291c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802920:	ff d3                	call   *%rbx
+  802922:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802927:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80292c:	eb 4d                	jmp    80297b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80292e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802933:	4c 89 ee             	mov    %r13,%rsi
+  802936:	bf 00 00 00 00       	mov    $0x0,%edi
+  80293b:	48 b8 85 04 80 00 00 	movabs $0x800485,%rax
+  802942:	00 00 00 
+  802945:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802947:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80294c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802950:	bf 00 00 00 00       	mov    $0x0,%edi
+  802955:	48 b8 85 04 80 00 00 	movabs $0x800485,%rax
+  80295c:	00 00 00 
+  80295f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802961:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802966:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80296a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80296f:	48 b8 85 04 80 00 00 	movabs $0x800485,%rax
+  802976:	00 00 00 
+  802979:	ff d0                	call   *%rax
+}
+  80297b:	89 d8                	mov    %ebx,%eax
+  80297d:	48 83 c4 18          	add    $0x18,%rsp
+  802981:	5b                   	pop    %rbx
+  802982:	41 5c                	pop    %r12
+  802984:	41 5d                	pop    %r13
+  802986:	5d                   	pop    %rbp
+  802987:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802988:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  80298f:	00 00 00 
+  802992:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  802999:	00 00 00 
+  80299c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8029a1:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  8029a8:	00 00 00 
+  8029ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b0:	49 b8 90 2f 80 00 00 	movabs $0x802f90,%r8
+  8029b7:	00 00 00 
+  8029ba:	41 ff d0             	call   *%r8
+
+00000000008029bd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8029bd:	55                   	push   %rbp
+  8029be:	48 89 e5             	mov    %rsp,%rbp
+  8029c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029c5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029c9:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  8029d0:	00 00 00 
+  8029d3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029d5:	85 c0                	test   %eax,%eax
+  8029d7:	78 35                	js     802a0e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029d9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029dd:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  8029e4:	00 00 00 
+  8029e7:	ff d0                	call   *%rax
+  8029e9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029ec:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029f1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029f6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029fa:	48 b8 7a 02 80 00 00 	movabs $0x80027a,%rax
+  802a01:	00 00 00 
+  802a04:	ff d0                	call   *%rax
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	0f 94 c0             	sete   %al
+  802a0b:	0f b6 c0             	movzbl %al,%eax
+}
+  802a0e:	c9                   	leave
+  802a0f:	c3                   	ret
+
+0000000000802a10 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a10:	48 89 f8             	mov    %rdi,%rax
+  802a13:	48 c1 e8 27          	shr    $0x27,%rax
+  802a17:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a1e:	7f 00 00 
+  802a21:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a25:	f6 c2 01             	test   $0x1,%dl
+  802a28:	74 6d                	je     802a97 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a2a:	48 89 f8             	mov    %rdi,%rax
+  802a2d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a31:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a38:	7f 00 00 
+  802a3b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a3f:	f6 c2 01             	test   $0x1,%dl
+  802a42:	74 62                	je     802aa6 <get_uvpt_entry+0x96>
+  802a44:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a4b:	7f 00 00 
+  802a4e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a52:	f6 c2 80             	test   $0x80,%dl
+  802a55:	75 4f                	jne    802aa6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a57:	48 89 f8             	mov    %rdi,%rax
+  802a5a:	48 c1 e8 15          	shr    $0x15,%rax
+  802a5e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a65:	7f 00 00 
+  802a68:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a6c:	f6 c2 01             	test   $0x1,%dl
+  802a6f:	74 44                	je     802ab5 <get_uvpt_entry+0xa5>
+  802a71:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a78:	7f 00 00 
+  802a7b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a7f:	f6 c2 80             	test   $0x80,%dl
+  802a82:	75 31                	jne    802ab5 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a84:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a88:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a8f:	7f 00 00 
+  802a92:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a96:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a97:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a9e:	7f 00 00 
+  802aa1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802aa5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802aa6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802aad:	7f 00 00 
+  802ab0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ab4:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802ab5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802abc:	7f 00 00 
+  802abf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ac3:	c3                   	ret
+
+0000000000802ac4 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802ac4:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802ac7:	48 89 f9             	mov    %rdi,%rcx
+  802aca:	48 c1 e9 27          	shr    $0x27,%rcx
+  802ace:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802ad5:	7f 00 00 
+  802ad8:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802adc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802ae3:	f6 c1 01             	test   $0x1,%cl
+  802ae6:	0f 84 b2 00 00 00    	je     802b9e <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802aec:	48 89 f9             	mov    %rdi,%rcx
+  802aef:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802af3:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802afa:	7f 00 00 
+  802afd:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b01:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802b08:	40 f6 c6 01          	test   $0x1,%sil
+  802b0c:	0f 84 8c 00 00 00    	je     802b9e <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802b12:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b19:	7f 00 00 
+  802b1c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b20:	a8 80                	test   $0x80,%al
+  802b22:	75 7b                	jne    802b9f <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802b24:	48 89 f9             	mov    %rdi,%rcx
+  802b27:	48 c1 e9 15          	shr    $0x15,%rcx
+  802b2b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b32:	7f 00 00 
+  802b35:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b39:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802b40:	40 f6 c6 01          	test   $0x1,%sil
+  802b44:	74 58                	je     802b9e <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802b46:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b4d:	7f 00 00 
+  802b50:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b54:	a8 80                	test   $0x80,%al
+  802b56:	75 6c                	jne    802bc4 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b58:	48 89 f9             	mov    %rdi,%rcx
+  802b5b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802b5f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b66:	7f 00 00 
+  802b69:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b6d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b74:	40 f6 c6 01          	test   $0x1,%sil
+  802b78:	74 24                	je     802b9e <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b7a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b81:	7f 00 00 
+  802b84:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b88:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b8f:	ff ff 7f 
+  802b92:	48 21 c8             	and    %rcx,%rax
+  802b95:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b9b:	48 09 d0             	or     %rdx,%rax
+}
+  802b9e:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b9f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802ba6:	7f 00 00 
+  802ba9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802bad:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802bb4:	ff ff 7f 
+  802bb7:	48 21 c8             	and    %rcx,%rax
+  802bba:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802bc0:	48 01 d0             	add    %rdx,%rax
+  802bc3:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802bc4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802bcb:	7f 00 00 
+  802bce:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802bd2:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802bd9:	ff ff 7f 
+  802bdc:	48 21 c8             	and    %rcx,%rax
+  802bdf:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802be5:	48 01 d0             	add    %rdx,%rax
+  802be8:	c3                   	ret
+
+0000000000802be9 <get_prot>:
+
+int
+get_prot(void *va) {
+  802be9:	55                   	push   %rbp
+  802bea:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bed:	48 b8 10 2a 80 00 00 	movabs $0x802a10,%rax
+  802bf4:	00 00 00 
+  802bf7:	ff d0                	call   *%rax
+  802bf9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802bfc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802c01:	89 c1                	mov    %eax,%ecx
+  802c03:	83 c9 04             	or     $0x4,%ecx
+  802c06:	f6 c2 01             	test   $0x1,%dl
+  802c09:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802c0c:	89 c1                	mov    %eax,%ecx
+  802c0e:	83 c9 02             	or     $0x2,%ecx
+  802c11:	f6 c2 02             	test   $0x2,%dl
+  802c14:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802c17:	89 c1                	mov    %eax,%ecx
+  802c19:	83 c9 01             	or     $0x1,%ecx
+  802c1c:	48 85 d2             	test   %rdx,%rdx
+  802c1f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802c22:	89 c1                	mov    %eax,%ecx
+  802c24:	83 c9 40             	or     $0x40,%ecx
+  802c27:	f6 c6 04             	test   $0x4,%dh
+  802c2a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802c2d:	5d                   	pop    %rbp
+  802c2e:	c3                   	ret
+
+0000000000802c2f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802c2f:	55                   	push   %rbp
+  802c30:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802c33:	48 b8 10 2a 80 00 00 	movabs $0x802a10,%rax
+  802c3a:	00 00 00 
+  802c3d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802c3f:	48 c1 e8 06          	shr    $0x6,%rax
+  802c43:	83 e0 01             	and    $0x1,%eax
+}
+  802c46:	5d                   	pop    %rbp
+  802c47:	c3                   	ret
+
+0000000000802c48 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802c48:	55                   	push   %rbp
+  802c49:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802c4c:	48 b8 10 2a 80 00 00 	movabs $0x802a10,%rax
+  802c53:	00 00 00 
+  802c56:	ff d0                	call   *%rax
+  802c58:	83 e0 01             	and    $0x1,%eax
+}
+  802c5b:	5d                   	pop    %rbp
+  802c5c:	c3                   	ret
+
+0000000000802c5d <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802c5d:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802c64:	7f 00 00 
+  802c67:	a8 01                	test   $0x1,%al
+  802c69:	75 06                	jne    802c71 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c70:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c71:	55                   	push   %rbp
+  802c72:	48 89 e5             	mov    %rsp,%rbp
+  802c75:	41 57                	push   %r15
+  802c77:	41 56                	push   %r14
+  802c79:	41 55                	push   %r13
+  802c7b:	41 54                	push   %r12
+  802c7d:	53                   	push   %rbx
+  802c7e:	48 83 ec 18          	sub    $0x18,%rsp
+  802c82:	49 89 fe             	mov    %rdi,%r14
+  802c85:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c88:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c8f:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c90:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c97:	7f 00 00 
+  802c9a:	e9 81 00 00 00       	jmp    802d20 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c9f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ca6:	49 39 dd             	cmp    %rbx,%r13
+  802ca9:	74 2b                	je     802cd6 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802cab:	48 89 d8             	mov    %rbx,%rax
+  802cae:	48 c1 e8 0c          	shr    $0xc,%rax
+  802cb2:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802cb6:	f6 c2 01             	test   $0x1,%dl
+  802cb9:	74 e4                	je     802c9f <foreach_shared_region+0x42>
+  802cbb:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802cbf:	f6 c4 04             	test   $0x4,%ah
+  802cc2:	74 db                	je     802c9f <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802cc4:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802ccb:	4c 89 fa             	mov    %r15,%rdx
+  802cce:	48 89 df             	mov    %rbx,%rdi
+  802cd1:	41 ff d6             	call   *%r14
+  802cd4:	eb c9                	jmp    802c9f <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cd6:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802cdd:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802ce1:	74 22                	je     802d05 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802ce3:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802cea:	48 89 d8             	mov    %rbx,%rax
+  802ced:	48 c1 e8 15          	shr    $0x15,%rax
+  802cf1:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802cf8:	7f 00 00 
+  802cfb:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802cff:	a8 01                	test   $0x1,%al
+  802d01:	74 d3                	je     802cd6 <foreach_shared_region+0x79>
+  802d03:	eb a6                	jmp    802cab <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802d05:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802d0c:	40 
+  802d0d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d11:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802d18:	00 00 00 
+  802d1b:	48 39 c1             	cmp    %rax,%rcx
+  802d1e:	74 31                	je     802d51 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802d20:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d24:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d28:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802d2f:	7f 00 00 
+  802d32:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802d36:	a8 01                	test   $0x1,%al
+  802d38:	74 cb                	je     802d05 <foreach_shared_region+0xa8>
+  802d3a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d3e:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802d45:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802d4b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802d4f:	eb 92                	jmp    802ce3 <foreach_shared_region+0x86>
+}
+  802d51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d56:	48 83 c4 18          	add    $0x18,%rsp
+  802d5a:	5b                   	pop    %rbx
+  802d5b:	41 5c                	pop    %r12
+  802d5d:	41 5d                	pop    %r13
+  802d5f:	41 5e                	pop    %r14
+  802d61:	41 5f                	pop    %r15
+  802d63:	5d                   	pop    %rbp
+  802d64:	c3                   	ret
+
+0000000000802d65 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d6a:	c3                   	ret
+
+0000000000802d6b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d6b:	55                   	push   %rbp
+  802d6c:	48 89 e5             	mov    %rsp,%rbp
+  802d6f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d72:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d79:	00 00 00 
+  802d7c:	48 b8 58 3a 80 00 00 	movabs $0x803a58,%rax
+  802d83:	00 00 00 
+  802d86:	ff d0                	call   *%rax
+    return 0;
+}
+  802d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8d:	5d                   	pop    %rbp
+  802d8e:	c3                   	ret
+
+0000000000802d8f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d8f:	55                   	push   %rbp
+  802d90:	48 89 e5             	mov    %rsp,%rbp
+  802d93:	41 57                	push   %r15
+  802d95:	41 56                	push   %r14
+  802d97:	41 55                	push   %r13
+  802d99:	41 54                	push   %r12
+  802d9b:	53                   	push   %rbx
+  802d9c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802da3:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802daa:	48 85 d2             	test   %rdx,%rdx
+  802dad:	74 7a                	je     802e29 <devcons_write+0x9a>
+  802daf:	49 89 d6             	mov    %rdx,%r14
+  802db2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802db8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802dbd:	49 bf e6 3d 80 00 00 	movabs $0x803de6,%r15
+  802dc4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802dc7:	4c 89 f3             	mov    %r14,%rbx
+  802dca:	48 29 f3             	sub    %rsi,%rbx
+  802dcd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802dd2:	48 39 c3             	cmp    %rax,%rbx
+  802dd5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802dd9:	4c 63 eb             	movslq %ebx,%r13
+  802ddc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802de3:	48 01 c6             	add    %rax,%rsi
+  802de6:	4c 89 ea             	mov    %r13,%rdx
+  802de9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802df0:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802df3:	4c 89 ee             	mov    %r13,%rsi
+  802df6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802dfd:	48 b8 1d 01 80 00 00 	movabs $0x80011d,%rax
+  802e04:	00 00 00 
+  802e07:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802e09:	41 01 dc             	add    %ebx,%r12d
+  802e0c:	49 63 f4             	movslq %r12d,%rsi
+  802e0f:	4c 39 f6             	cmp    %r14,%rsi
+  802e12:	72 b3                	jb     802dc7 <devcons_write+0x38>
+    return res;
+  802e14:	49 63 c4             	movslq %r12d,%rax
+}
+  802e17:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802e1e:	5b                   	pop    %rbx
+  802e1f:	41 5c                	pop    %r12
+  802e21:	41 5d                	pop    %r13
+  802e23:	41 5e                	pop    %r14
+  802e25:	41 5f                	pop    %r15
+  802e27:	5d                   	pop    %rbp
+  802e28:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802e29:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e2f:	eb e3                	jmp    802e14 <devcons_write+0x85>
+
+0000000000802e31 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e31:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e39:	48 85 c0             	test   %rax,%rax
+  802e3c:	74 55                	je     802e93 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e3e:	55                   	push   %rbp
+  802e3f:	48 89 e5             	mov    %rsp,%rbp
+  802e42:	41 55                	push   %r13
+  802e44:	41 54                	push   %r12
+  802e46:	53                   	push   %rbx
+  802e47:	48 83 ec 08          	sub    $0x8,%rsp
+  802e4b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802e4e:	48 bb 4a 01 80 00 00 	movabs $0x80014a,%rbx
+  802e55:	00 00 00 
+  802e58:	49 bc 17 02 80 00 00 	movabs $0x800217,%r12
+  802e5f:	00 00 00 
+  802e62:	eb 03                	jmp    802e67 <devcons_read+0x36>
+  802e64:	41 ff d4             	call   *%r12
+  802e67:	ff d3                	call   *%rbx
+  802e69:	85 c0                	test   %eax,%eax
+  802e6b:	74 f7                	je     802e64 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e6d:	48 63 d0             	movslq %eax,%rdx
+  802e70:	78 13                	js     802e85 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e72:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e77:	83 f8 04             	cmp    $0x4,%eax
+  802e7a:	74 09                	je     802e85 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e7c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e80:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e85:	48 89 d0             	mov    %rdx,%rax
+  802e88:	48 83 c4 08          	add    $0x8,%rsp
+  802e8c:	5b                   	pop    %rbx
+  802e8d:	41 5c                	pop    %r12
+  802e8f:	41 5d                	pop    %r13
+  802e91:	5d                   	pop    %rbp
+  802e92:	c3                   	ret
+  802e93:	48 89 d0             	mov    %rdx,%rax
+  802e96:	c3                   	ret
+
+0000000000802e97 <cputchar>:
+cputchar(int ch) {
+  802e97:	55                   	push   %rbp
+  802e98:	48 89 e5             	mov    %rsp,%rbp
+  802e9b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e9f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802ea3:	be 01 00 00 00       	mov    $0x1,%esi
+  802ea8:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802eac:	48 b8 1d 01 80 00 00 	movabs $0x80011d,%rax
+  802eb3:	00 00 00 
+  802eb6:	ff d0                	call   *%rax
+}
+  802eb8:	c9                   	leave
+  802eb9:	c3                   	ret
+
+0000000000802eba <getchar>:
+getchar(void) {
+  802eba:	55                   	push   %rbp
+  802ebb:	48 89 e5             	mov    %rsp,%rbp
+  802ebe:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802ec2:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ec7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802ecb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ed0:	48 b8 78 10 80 00 00 	movabs $0x801078,%rax
+  802ed7:	00 00 00 
+  802eda:	ff d0                	call   *%rax
+  802edc:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802ede:	85 c0                	test   %eax,%eax
+  802ee0:	78 06                	js     802ee8 <getchar+0x2e>
+  802ee2:	74 08                	je     802eec <getchar+0x32>
+  802ee4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802ee8:	89 d0                	mov    %edx,%eax
+  802eea:	c9                   	leave
+  802eeb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802eec:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802ef1:	eb f5                	jmp    802ee8 <getchar+0x2e>
+
+0000000000802ef3 <iscons>:
+iscons(int fdnum) {
+  802ef3:	55                   	push   %rbp
+  802ef4:	48 89 e5             	mov    %rsp,%rbp
+  802ef7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802efb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802eff:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  802f06:	00 00 00 
+  802f09:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f0b:	85 c0                	test   %eax,%eax
+  802f0d:	78 18                	js     802f27 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802f0f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f13:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802f1a:	00 00 00 
+  802f1d:	8b 00                	mov    (%rax),%eax
+  802f1f:	39 02                	cmp    %eax,(%rdx)
+  802f21:	0f 94 c0             	sete   %al
+  802f24:	0f b6 c0             	movzbl %al,%eax
+}
+  802f27:	c9                   	leave
+  802f28:	c3                   	ret
+
+0000000000802f29 <opencons>:
+opencons(void) {
+  802f29:	55                   	push   %rbp
+  802f2a:	48 89 e5             	mov    %rsp,%rbp
+  802f2d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f31:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802f35:	48 b8 35 0d 80 00 00 	movabs $0x800d35,%rax
+  802f3c:	00 00 00 
+  802f3f:	ff d0                	call   *%rax
+  802f41:	85 c0                	test   %eax,%eax
+  802f43:	78 49                	js     802f8e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802f45:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f4f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f53:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f58:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  802f5f:	00 00 00 
+  802f62:	ff d0                	call   *%rax
+  802f64:	85 c0                	test   %eax,%eax
+  802f66:	78 26                	js     802f8e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f68:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f6c:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802f73:	00 00 
+  802f75:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f77:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f7b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f82:	48 b8 07 0d 80 00 00 	movabs $0x800d07,%rax
+  802f89:	00 00 00 
+  802f8c:	ff d0                	call   *%rax
+}
+  802f8e:	c9                   	leave
+  802f8f:	c3                   	ret
+
+0000000000802f90 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f90:	55                   	push   %rbp
+  802f91:	48 89 e5             	mov    %rsp,%rbp
+  802f94:	41 56                	push   %r14
+  802f96:	41 55                	push   %r13
+  802f98:	41 54                	push   %r12
+  802f9a:	53                   	push   %rbx
+  802f9b:	48 83 ec 50          	sub    $0x50,%rsp
+  802f9f:	49 89 fc             	mov    %rdi,%r12
+  802fa2:	41 89 f5             	mov    %esi,%r13d
+  802fa5:	48 89 d3             	mov    %rdx,%rbx
+  802fa8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802fac:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802fb0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802fb4:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802fbb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802fbf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802fc3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802fc7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fcb:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802fd2:	00 00 00 
+  802fd5:	4c 8b 30             	mov    (%rax),%r14
+  802fd8:	48 b8 e6 01 80 00 00 	movabs $0x8001e6,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+  802fe4:	89 c6                	mov    %eax,%esi
+  802fe6:	45 89 e8             	mov    %r13d,%r8d
+  802fe9:	4c 89 e1             	mov    %r12,%rcx
+  802fec:	4c 89 f2             	mov    %r14,%rdx
+  802fef:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802ff6:	00 00 00 
+  802ff9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ffe:	49 bc e0 30 80 00 00 	movabs $0x8030e0,%r12
+  803005:	00 00 00 
+  803008:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80300b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80300f:	48 89 df             	mov    %rbx,%rdi
+  803012:	48 b8 7c 30 80 00 00 	movabs $0x80307c,%rax
+  803019:	00 00 00 
+  80301c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80301e:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  803025:	00 00 00 
+  803028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803030:	cc                   	int3
+  803031:	eb fd                	jmp    803030 <_panic+0xa0>
+
+0000000000803033 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803033:	55                   	push   %rbp
+  803034:	48 89 e5             	mov    %rsp,%rbp
+  803037:	53                   	push   %rbx
+  803038:	48 83 ec 08          	sub    $0x8,%rsp
+  80303c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80303f:	8b 06                	mov    (%rsi),%eax
+  803041:	8d 50 01             	lea    0x1(%rax),%edx
+  803044:	89 16                	mov    %edx,(%rsi)
+  803046:	48 98                	cltq
+  803048:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80304d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803053:	74 0a                	je     80305f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803055:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803059:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80305d:	c9                   	leave
+  80305e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80305f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803063:	be ff 00 00 00       	mov    $0xff,%esi
+  803068:	48 b8 1d 01 80 00 00 	movabs $0x80011d,%rax
+  80306f:	00 00 00 
+  803072:	ff d0                	call   *%rax
+        state->offset = 0;
+  803074:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80307a:	eb d9                	jmp    803055 <putch+0x22>
+
+000000000080307c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80307c:	55                   	push   %rbp
+  80307d:	48 89 e5             	mov    %rsp,%rbp
+  803080:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803087:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80308a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803091:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80309e:	48 89 f1             	mov    %rsi,%rcx
+  8030a1:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8030a8:	48 bf 33 30 80 00 00 	movabs $0x803033,%rdi
+  8030af:	00 00 00 
+  8030b2:	48 b8 30 32 80 00 00 	movabs $0x803230,%rax
+  8030b9:	00 00 00 
+  8030bc:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8030be:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8030c5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8030cc:	48 b8 1d 01 80 00 00 	movabs $0x80011d,%rax
+  8030d3:	00 00 00 
+  8030d6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8030d8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8030de:	c9                   	leave
+  8030df:	c3                   	ret
+
+00000000008030e0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8030e0:	55                   	push   %rbp
+  8030e1:	48 89 e5             	mov    %rsp,%rbp
+  8030e4:	48 83 ec 50          	sub    $0x50,%rsp
+  8030e8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8030ec:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8030f0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8030f4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8030f8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8030fc:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803103:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803107:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80310b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80310f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  803113:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  803117:	48 b8 7c 30 80 00 00 	movabs $0x80307c,%rax
+  80311e:	00 00 00 
+  803121:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  803123:	c9                   	leave
+  803124:	c3                   	ret
+
+0000000000803125 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  803125:	55                   	push   %rbp
+  803126:	48 89 e5             	mov    %rsp,%rbp
+  803129:	41 57                	push   %r15
+  80312b:	41 56                	push   %r14
+  80312d:	41 55                	push   %r13
+  80312f:	41 54                	push   %r12
+  803131:	53                   	push   %rbx
+  803132:	48 83 ec 18          	sub    $0x18,%rsp
+  803136:	49 89 fc             	mov    %rdi,%r12
+  803139:	49 89 f5             	mov    %rsi,%r13
+  80313c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803140:	8b 45 10             	mov    0x10(%rbp),%eax
+  803143:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803146:	41 89 cf             	mov    %ecx,%r15d
+  803149:	4c 39 fa             	cmp    %r15,%rdx
+  80314c:	73 5b                	jae    8031a9 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80314e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803152:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803156:	85 db                	test   %ebx,%ebx
+  803158:	7e 0e                	jle    803168 <print_num+0x43>
+            putch(padc, put_arg);
+  80315a:	4c 89 ee             	mov    %r13,%rsi
+  80315d:	44 89 f7             	mov    %r14d,%edi
+  803160:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803163:	83 eb 01             	sub    $0x1,%ebx
+  803166:	75 f2                	jne    80315a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803168:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80316c:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  803173:	00 00 00 
+  803176:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  80317d:	00 00 00 
+  803180:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803184:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803188:	ba 00 00 00 00       	mov    $0x0,%edx
+  80318d:	49 f7 f7             	div    %r15
+  803190:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803194:	4c 89 ee             	mov    %r13,%rsi
+  803197:	41 ff d4             	call   *%r12
+}
+  80319a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80319e:	5b                   	pop    %rbx
+  80319f:	41 5c                	pop    %r12
+  8031a1:	41 5d                	pop    %r13
+  8031a3:	41 5e                	pop    %r14
+  8031a5:	41 5f                	pop    %r15
+  8031a7:	5d                   	pop    %rbp
+  8031a8:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8031a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031b2:	49 f7 f7             	div    %r15
+  8031b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8031b9:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8031bd:	52                   	push   %rdx
+  8031be:	45 0f be c9          	movsbl %r9b,%r9d
+  8031c2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8031c6:	48 89 c2             	mov    %rax,%rdx
+  8031c9:	48 b8 25 31 80 00 00 	movabs $0x803125,%rax
+  8031d0:	00 00 00 
+  8031d3:	ff d0                	call   *%rax
+  8031d5:	48 83 c4 10          	add    $0x10,%rsp
+  8031d9:	eb 8d                	jmp    803168 <print_num+0x43>
+
+00000000008031db <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8031db:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8031df:	48 8b 06             	mov    (%rsi),%rax
+  8031e2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8031e6:	73 0a                	jae    8031f2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8031e8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8031ec:	48 89 16             	mov    %rdx,(%rsi)
+  8031ef:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8031f2:	c3                   	ret
+
+00000000008031f3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8031f3:	55                   	push   %rbp
+  8031f4:	48 89 e5             	mov    %rsp,%rbp
+  8031f7:	48 83 ec 50          	sub    $0x50,%rsp
+  8031fb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8031ff:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803203:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  803207:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80320e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803212:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803216:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80321a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80321e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803222:	48 b8 30 32 80 00 00 	movabs $0x803230,%rax
+  803229:	00 00 00 
+  80322c:	ff d0                	call   *%rax
+}
+  80322e:	c9                   	leave
+  80322f:	c3                   	ret
+
+0000000000803230 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  803230:	55                   	push   %rbp
+  803231:	48 89 e5             	mov    %rsp,%rbp
+  803234:	41 57                	push   %r15
+  803236:	41 56                	push   %r14
+  803238:	41 55                	push   %r13
+  80323a:	41 54                	push   %r12
+  80323c:	53                   	push   %rbx
+  80323d:	48 83 ec 38          	sub    $0x38,%rsp
+  803241:	49 89 fe             	mov    %rdi,%r14
+  803244:	49 89 f5             	mov    %rsi,%r13
+  803247:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80324a:	48 8b 01             	mov    (%rcx),%rax
+  80324d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803251:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803255:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803259:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80325d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803261:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803265:	0f b6 3b             	movzbl (%rbx),%edi
+  803268:	40 80 ff 25          	cmp    $0x25,%dil
+  80326c:	74 18                	je     803286 <vprintfmt+0x56>
+            if (!ch) return;
+  80326e:	40 84 ff             	test   %dil,%dil
+  803271:	0f 84 04 07 00 00    	je     80397b <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  803277:	40 0f b6 ff          	movzbl %dil,%edi
+  80327b:	4c 89 ee             	mov    %r13,%rsi
+  80327e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803281:	4c 89 e3             	mov    %r12,%rbx
+  803284:	eb db                	jmp    803261 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803286:	be 00 00 00 00       	mov    $0x0,%esi
+  80328b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80328f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803294:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80329a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8032a1:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8032a5:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8032aa:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8032af:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8032b2:	83 e8 23             	sub    $0x23,%eax
+  8032b5:	3c 57                	cmp    $0x57,%al
+  8032b7:	0f 87 a4 06 00 00    	ja     803961 <vprintfmt+0x731>
+  8032bd:	0f b6 c0             	movzbl %al,%eax
+  8032c0:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  8032c7:	00 00 00 
+  8032ca:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8032cd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8032d0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8032d4:	eb cf                	jmp    8032a5 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8032d6:	49 89 dc             	mov    %rbx,%r12
+  8032d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8032de:	eb c5                	jmp    8032a5 <vprintfmt+0x75>
+            padc = ch;
+  8032e0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8032e4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8032e7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8032ea:	eb b9                	jmp    8032a5 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8032f2:	77 24                	ja     803318 <vprintfmt+0xe8>
+  8032f4:	89 c1                	mov    %eax,%ecx
+  8032f6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8032fa:	83 c0 08             	add    $0x8,%eax
+  8032fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803300:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  803303:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  803306:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80330a:	79 99                	jns    8032a5 <vprintfmt+0x75>
+                width = precision;
+  80330c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  803310:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803316:	eb 8d                	jmp    8032a5 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803318:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80331c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  803320:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803324:	eb da                	jmp    803300 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  803326:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80332b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80332f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  803335:	3c 39                	cmp    $0x39,%al
+  803337:	77 1c                	ja     803355 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  803339:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80333d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803341:	0f b6 c0             	movzbl %al,%eax
+  803344:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803349:	0f b6 03             	movzbl (%rbx),%eax
+  80334c:	3c 39                	cmp    $0x39,%al
+  80334e:	76 e9                	jbe    803339 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803350:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803353:	eb b1                	jmp    803306 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803355:	49 89 dc             	mov    %rbx,%r12
+  803358:	eb ac                	jmp    803306 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80335a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80335d:	85 c9                	test   %ecx,%ecx
+  80335f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803364:	0f 49 c1             	cmovns %ecx,%eax
+  803367:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80336a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80336d:	e9 33 ff ff ff       	jmp    8032a5 <vprintfmt+0x75>
+            lflag++;
+  803372:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803375:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803378:	e9 28 ff ff ff       	jmp    8032a5 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80337d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803380:	83 f8 2f             	cmp    $0x2f,%eax
+  803383:	77 19                	ja     80339e <vprintfmt+0x16e>
+  803385:	89 c2                	mov    %eax,%edx
+  803387:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80338b:	83 c0 08             	add    $0x8,%eax
+  80338e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803391:	8b 3a                	mov    (%rdx),%edi
+  803393:	4c 89 ee             	mov    %r13,%rsi
+  803396:	41 ff d6             	call   *%r14
+            break;
+  803399:	e9 c3 fe ff ff       	jmp    803261 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80339e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033aa:	eb e5                	jmp    803391 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8033ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033af:	83 f8 2f             	cmp    $0x2f,%eax
+  8033b2:	77 5a                	ja     80340e <vprintfmt+0x1de>
+  8033b4:	89 c2                	mov    %eax,%edx
+  8033b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033ba:	83 c0 08             	add    $0x8,%eax
+  8033bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8033c0:	8b 02                	mov    (%rdx),%eax
+  8033c2:	89 c1                	mov    %eax,%ecx
+  8033c4:	f7 d9                	neg    %ecx
+  8033c6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8033c9:	83 f9 13             	cmp    $0x13,%ecx
+  8033cc:	7f 4e                	jg     80341c <vprintfmt+0x1ec>
+  8033ce:	48 63 c1             	movslq %ecx,%rax
+  8033d1:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  8033d8:	00 00 00 
+  8033db:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033df:	48 85 c0             	test   %rax,%rax
+  8033e2:	74 38                	je     80341c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8033e4:	48 89 c1             	mov    %rax,%rcx
+  8033e7:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  8033ee:	00 00 00 
+  8033f1:	4c 89 ee             	mov    %r13,%rsi
+  8033f4:	4c 89 f7             	mov    %r14,%rdi
+  8033f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033fc:	49 b8 f3 31 80 00 00 	movabs $0x8031f3,%r8
+  803403:	00 00 00 
+  803406:	41 ff d0             	call   *%r8
+  803409:	e9 53 fe ff ff       	jmp    803261 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80340e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803412:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803416:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80341a:	eb a4                	jmp    8033c0 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80341c:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  803423:	00 00 00 
+  803426:	4c 89 ee             	mov    %r13,%rsi
+  803429:	4c 89 f7             	mov    %r14,%rdi
+  80342c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803431:	49 b8 f3 31 80 00 00 	movabs $0x8031f3,%r8
+  803438:	00 00 00 
+  80343b:	41 ff d0             	call   *%r8
+  80343e:	e9 1e fe ff ff       	jmp    803261 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803443:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803446:	83 f8 2f             	cmp    $0x2f,%eax
+  803449:	77 36                	ja     803481 <vprintfmt+0x251>
+  80344b:	89 c2                	mov    %eax,%edx
+  80344d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803451:	83 c0 08             	add    $0x8,%eax
+  803454:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803457:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80345a:	48 85 f6             	test   %rsi,%rsi
+  80345d:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  803464:	00 00 00 
+  803467:	48 0f 45 c6          	cmovne %rsi,%rax
+  80346b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80346f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803473:	7e 06                	jle    80347b <vprintfmt+0x24b>
+  803475:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803479:	75 14                	jne    80348f <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80347b:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80347f:	eb 5b                	jmp    8034dc <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  803481:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803485:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803489:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80348d:	eb c8                	jmp    803457 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80348f:	49 63 f7             	movslq %r15d,%rsi
+  803492:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803496:	48 b8 35 3a 80 00 00 	movabs $0x803a35,%rax
+  80349d:	00 00 00 
+  8034a0:	ff d0                	call   *%rax
+  8034a2:	48 89 c2             	mov    %rax,%rdx
+  8034a5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8034a8:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8034aa:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8034ad:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8034b0:	85 c0                	test   %eax,%eax
+  8034b2:	7e c7                	jle    80347b <vprintfmt+0x24b>
+  8034b4:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8034b9:	4c 89 ee             	mov    %r13,%rsi
+  8034bc:	44 89 e7             	mov    %r12d,%edi
+  8034bf:	41 ff d6             	call   *%r14
+  8034c2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8034c6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8034c9:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8034cc:	75 eb                	jne    8034b9 <vprintfmt+0x289>
+  8034ce:	eb ab                	jmp    80347b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8034d0:	0f b6 f8             	movzbl %al,%edi
+  8034d3:	4c 89 ee             	mov    %r13,%rsi
+  8034d6:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8034d9:	4c 89 e2             	mov    %r12,%rdx
+  8034dc:	45 85 ff             	test   %r15d,%r15d
+  8034df:	78 06                	js     8034e7 <vprintfmt+0x2b7>
+  8034e1:	41 83 ef 01          	sub    $0x1,%r15d
+  8034e5:	78 23                	js     80350a <vprintfmt+0x2da>
+  8034e7:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8034eb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8034f1:	84 c0                	test   %al,%al
+  8034f3:	74 15                	je     80350a <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8034f5:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8034f9:	74 d5                	je     8034d0 <vprintfmt+0x2a0>
+  8034fb:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8034fe:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803503:	80 fa 5e             	cmp    $0x5e,%dl
+  803506:	77 cb                	ja     8034d3 <vprintfmt+0x2a3>
+  803508:	eb c6                	jmp    8034d0 <vprintfmt+0x2a0>
+  80350a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80350d:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  803510:	01 f0                	add    %esi,%eax
+  803512:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  803514:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803518:	85 c0                	test   %eax,%eax
+  80351a:	0f 8e 41 fd ff ff    	jle    803261 <vprintfmt+0x31>
+  803520:	4c 89 ee             	mov    %r13,%rsi
+  803523:	bf 20 00 00 00       	mov    $0x20,%edi
+  803528:	41 ff d6             	call   *%r14
+  80352b:	41 83 ec 01          	sub    $0x1,%r12d
+  80352f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803533:	75 eb                	jne    803520 <vprintfmt+0x2f0>
+  803535:	e9 27 fd ff ff       	jmp    803261 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80353a:	40 84 f6             	test   %sil,%sil
+  80353d:	75 26                	jne    803565 <vprintfmt+0x335>
+    switch (lflag) {
+  80353f:	85 d2                	test   %edx,%edx
+  803541:	74 59                	je     80359c <vprintfmt+0x36c>
+  803543:	83 fa 01             	cmp    $0x1,%edx
+  803546:	74 7b                	je     8035c3 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  803548:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80354b:	83 f8 2f             	cmp    $0x2f,%eax
+  80354e:	0f 87 96 00 00 00    	ja     8035ea <vprintfmt+0x3ba>
+  803554:	89 c2                	mov    %eax,%edx
+  803556:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80355a:	83 c0 08             	add    $0x8,%eax
+  80355d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803560:	4c 8b 22             	mov    (%rdx),%r12
+  803563:	eb 17                	jmp    80357c <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  803565:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803568:	83 f8 2f             	cmp    $0x2f,%eax
+  80356b:	77 21                	ja     80358e <vprintfmt+0x35e>
+  80356d:	89 c2                	mov    %eax,%edx
+  80356f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803573:	83 c0 08             	add    $0x8,%eax
+  803576:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803579:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80357c:	4d 85 e4             	test   %r12,%r12
+  80357f:	78 7a                	js     8035fb <vprintfmt+0x3cb>
+            num = i;
+  803581:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803584:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803589:	e9 b5 02 00 00       	jmp    803843 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80358e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803592:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803596:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80359a:	eb dd                	jmp    803579 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  80359c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80359f:	83 f8 2f             	cmp    $0x2f,%eax
+  8035a2:	77 11                	ja     8035b5 <vprintfmt+0x385>
+  8035a4:	89 c2                	mov    %eax,%edx
+  8035a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035aa:	83 c0 08             	add    $0x8,%eax
+  8035ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035b0:	4c 63 22             	movslq (%rdx),%r12
+  8035b3:	eb c7                	jmp    80357c <vprintfmt+0x34c>
+  8035b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035c1:	eb ed                	jmp    8035b0 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8035c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8035c9:	77 11                	ja     8035dc <vprintfmt+0x3ac>
+  8035cb:	89 c2                	mov    %eax,%edx
+  8035cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035d1:	83 c0 08             	add    $0x8,%eax
+  8035d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035d7:	4c 8b 22             	mov    (%rdx),%r12
+  8035da:	eb a0                	jmp    80357c <vprintfmt+0x34c>
+  8035dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035e8:	eb ed                	jmp    8035d7 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8035ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035f6:	e9 65 ff ff ff       	jmp    803560 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8035fb:	4c 89 ee             	mov    %r13,%rsi
+  8035fe:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803603:	41 ff d6             	call   *%r14
+                i = -i;
+  803606:	49 f7 dc             	neg    %r12
+  803609:	e9 73 ff ff ff       	jmp    803581 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  80360e:	40 84 f6             	test   %sil,%sil
+  803611:	75 32                	jne    803645 <vprintfmt+0x415>
+    switch (lflag) {
+  803613:	85 d2                	test   %edx,%edx
+  803615:	74 5d                	je     803674 <vprintfmt+0x444>
+  803617:	83 fa 01             	cmp    $0x1,%edx
+  80361a:	0f 84 82 00 00 00    	je     8036a2 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  803620:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803623:	83 f8 2f             	cmp    $0x2f,%eax
+  803626:	0f 87 a5 00 00 00    	ja     8036d1 <vprintfmt+0x4a1>
+  80362c:	89 c2                	mov    %eax,%edx
+  80362e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803632:	83 c0 08             	add    $0x8,%eax
+  803635:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803638:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80363b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803640:	e9 fe 01 00 00       	jmp    803843 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803645:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803648:	83 f8 2f             	cmp    $0x2f,%eax
+  80364b:	77 19                	ja     803666 <vprintfmt+0x436>
+  80364d:	89 c2                	mov    %eax,%edx
+  80364f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803653:	83 c0 08             	add    $0x8,%eax
+  803656:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803659:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80365c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803661:	e9 dd 01 00 00       	jmp    803843 <vprintfmt+0x613>
+  803666:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80366a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80366e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803672:	eb e5                	jmp    803659 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  803674:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803677:	83 f8 2f             	cmp    $0x2f,%eax
+  80367a:	77 18                	ja     803694 <vprintfmt+0x464>
+  80367c:	89 c2                	mov    %eax,%edx
+  80367e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803682:	83 c0 08             	add    $0x8,%eax
+  803685:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803688:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80368a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80368f:	e9 af 01 00 00       	jmp    803843 <vprintfmt+0x613>
+  803694:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803698:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80369c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036a0:	eb e6                	jmp    803688 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8036a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8036a8:	77 19                	ja     8036c3 <vprintfmt+0x493>
+  8036aa:	89 c2                	mov    %eax,%edx
+  8036ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036b0:	83 c0 08             	add    $0x8,%eax
+  8036b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036b6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8036b9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8036be:	e9 80 01 00 00       	jmp    803843 <vprintfmt+0x613>
+  8036c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8036c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8036cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036cf:	eb e5                	jmp    8036b6 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8036d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8036d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8036d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036dd:	e9 56 ff ff ff       	jmp    803638 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8036e2:	40 84 f6             	test   %sil,%sil
+  8036e5:	75 2e                	jne    803715 <vprintfmt+0x4e5>
+    switch (lflag) {
+  8036e7:	85 d2                	test   %edx,%edx
+  8036e9:	0f 84 b3 00 00 00    	je     8037a2 <vprintfmt+0x572>
+  8036ef:	83 fa 01             	cmp    $0x1,%edx
+  8036f2:	0f 84 d3 00 00 00    	je     8037cb <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8036f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8036fe:	0f 87 f1 00 00 00    	ja     8037f5 <vprintfmt+0x5c5>
+  803704:	89 c2                	mov    %eax,%edx
+  803706:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80370a:	83 c0 08             	add    $0x8,%eax
+  80370d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803710:	48 8b 02             	mov    (%rdx),%rax
+  803713:	eb 17                	jmp    80372c <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  803715:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803718:	83 f8 2f             	cmp    $0x2f,%eax
+  80371b:	77 77                	ja     803794 <vprintfmt+0x564>
+  80371d:	89 c2                	mov    %eax,%edx
+  80371f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803723:	83 c0 08             	add    $0x8,%eax
+  803726:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803729:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  80372c:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80372e:	83 f8 07             	cmp    $0x7,%eax
+  803731:	0f 8e cf 00 00 00    	jle    803806 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  803737:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80373d:	44 89 e7             	mov    %r12d,%edi
+  803740:	41 c1 e4 03          	shl    $0x3,%r12d
+  803744:	89 d1                	mov    %edx,%ecx
+  803746:	8d 72 07             	lea    0x7(%rdx),%esi
+  803749:	85 d2                	test   %edx,%edx
+  80374b:	0f 48 d6             	cmovs  %esi,%edx
+  80374e:	c1 fa 03             	sar    $0x3,%edx
+  803751:	83 f9 3f             	cmp    $0x3f,%ecx
+  803754:	7f e7                	jg     80373d <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  803756:	85 ff                	test   %edi,%edi
+  803758:	0f 84 03 fb ff ff    	je     803261 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  80375e:	49 63 f4             	movslq %r12d,%rsi
+  803761:	ba 00 00 00 00       	mov    $0x0,%edx
+  803766:	48 f7 f6             	div    %rsi
+  803769:	49 89 d7             	mov    %rdx,%r15
+  80376c:	83 c0 30             	add    $0x30,%eax
+  80376f:	0f be f8             	movsbl %al,%edi
+  803772:	4c 89 ee             	mov    %r13,%rsi
+  803775:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  803778:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  80377b:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  803780:	45 85 e4             	test   %r12d,%r12d
+  803783:	41 0f 49 d4          	cmovns %r12d,%edx
+  803787:	c1 fa 03             	sar    $0x3,%edx
+  80378a:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  80378d:	75 cf                	jne    80375e <vprintfmt+0x52e>
+  80378f:	e9 cd fa ff ff       	jmp    803261 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  803794:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803798:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80379c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037a0:	eb 87                	jmp    803729 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  8037a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8037a8:	77 13                	ja     8037bd <vprintfmt+0x58d>
+  8037aa:	89 c2                	mov    %eax,%edx
+  8037ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037b0:	83 c0 08             	add    $0x8,%eax
+  8037b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037b6:	8b 02                	mov    (%rdx),%eax
+  8037b8:	e9 6f ff ff ff       	jmp    80372c <vprintfmt+0x4fc>
+  8037bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037c9:	eb eb                	jmp    8037b6 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8037cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8037d1:	77 14                	ja     8037e7 <vprintfmt+0x5b7>
+  8037d3:	89 c2                	mov    %eax,%edx
+  8037d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037d9:	83 c0 08             	add    $0x8,%eax
+  8037dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037df:	48 8b 02             	mov    (%rdx),%rax
+  8037e2:	e9 45 ff ff ff       	jmp    80372c <vprintfmt+0x4fc>
+  8037e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037f3:	eb ea                	jmp    8037df <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8037f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803801:	e9 0a ff ff ff       	jmp    803710 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  803806:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  80380c:	e9 4d ff ff ff       	jmp    80375e <vprintfmt+0x52e>
+            putch('0', put_arg);
+  803811:	4c 89 ee             	mov    %r13,%rsi
+  803814:	bf 30 00 00 00       	mov    $0x30,%edi
+  803819:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80381c:	4c 89 ee             	mov    %r13,%rsi
+  80381f:	bf 78 00 00 00       	mov    $0x78,%edi
+  803824:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803827:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80382a:	83 f8 2f             	cmp    $0x2f,%eax
+  80382d:	77 47                	ja     803876 <vprintfmt+0x646>
+  80382f:	89 c2                	mov    %eax,%edx
+  803831:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803835:	83 c0 08             	add    $0x8,%eax
+  803838:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80383b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80383e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803843:	48 83 ec 08          	sub    $0x8,%rsp
+  803847:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80384b:	0f 94 c0             	sete   %al
+  80384e:	0f b6 c0             	movzbl %al,%eax
+  803851:	50                   	push   %rax
+  803852:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803857:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80385b:	4c 89 ee             	mov    %r13,%rsi
+  80385e:	4c 89 f7             	mov    %r14,%rdi
+  803861:	48 b8 25 31 80 00 00 	movabs $0x803125,%rax
+  803868:	00 00 00 
+  80386b:	ff d0                	call   *%rax
+            break;
+  80386d:	48 83 c4 10          	add    $0x10,%rsp
+  803871:	e9 eb f9 ff ff       	jmp    803261 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803876:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80387a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80387e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803882:	eb b7                	jmp    80383b <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  803884:	40 84 f6             	test   %sil,%sil
+  803887:	75 2b                	jne    8038b4 <vprintfmt+0x684>
+    switch (lflag) {
+  803889:	85 d2                	test   %edx,%edx
+  80388b:	74 56                	je     8038e3 <vprintfmt+0x6b3>
+  80388d:	83 fa 01             	cmp    $0x1,%edx
+  803890:	74 7f                	je     803911 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  803892:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803895:	83 f8 2f             	cmp    $0x2f,%eax
+  803898:	0f 87 a2 00 00 00    	ja     803940 <vprintfmt+0x710>
+  80389e:	89 c2                	mov    %eax,%edx
+  8038a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038a4:	83 c0 08             	add    $0x8,%eax
+  8038a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038aa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038ad:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8038b2:	eb 8f                	jmp    803843 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8038b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8038ba:	77 19                	ja     8038d5 <vprintfmt+0x6a5>
+  8038bc:	89 c2                	mov    %eax,%edx
+  8038be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038c2:	83 c0 08             	add    $0x8,%eax
+  8038c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038c8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038cb:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8038d0:	e9 6e ff ff ff       	jmp    803843 <vprintfmt+0x613>
+  8038d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038e1:	eb e5                	jmp    8038c8 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8038e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8038e9:	77 18                	ja     803903 <vprintfmt+0x6d3>
+  8038eb:	89 c2                	mov    %eax,%edx
+  8038ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038f1:	83 c0 08             	add    $0x8,%eax
+  8038f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038f7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8038f9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8038fe:	e9 40 ff ff ff       	jmp    803843 <vprintfmt+0x613>
+  803903:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803907:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80390b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80390f:	eb e6                	jmp    8038f7 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  803911:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803914:	83 f8 2f             	cmp    $0x2f,%eax
+  803917:	77 19                	ja     803932 <vprintfmt+0x702>
+  803919:	89 c2                	mov    %eax,%edx
+  80391b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80391f:	83 c0 08             	add    $0x8,%eax
+  803922:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803925:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803928:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80392d:	e9 11 ff ff ff       	jmp    803843 <vprintfmt+0x613>
+  803932:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803936:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80393a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80393e:	eb e5                	jmp    803925 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  803940:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803944:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803948:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80394c:	e9 59 ff ff ff       	jmp    8038aa <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  803951:	4c 89 ee             	mov    %r13,%rsi
+  803954:	bf 25 00 00 00       	mov    $0x25,%edi
+  803959:	41 ff d6             	call   *%r14
+            break;
+  80395c:	e9 00 f9 ff ff       	jmp    803261 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803961:	4c 89 ee             	mov    %r13,%rsi
+  803964:	bf 25 00 00 00       	mov    $0x25,%edi
+  803969:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80396c:	48 83 eb 01          	sub    $0x1,%rbx
+  803970:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803974:	75 f6                	jne    80396c <vprintfmt+0x73c>
+  803976:	e9 e6 f8 ff ff       	jmp    803261 <vprintfmt+0x31>
+}
+  80397b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80397f:	5b                   	pop    %rbx
+  803980:	41 5c                	pop    %r12
+  803982:	41 5d                	pop    %r13
+  803984:	41 5e                	pop    %r14
+  803986:	41 5f                	pop    %r15
+  803988:	5d                   	pop    %rbp
+  803989:	c3                   	ret
+
+000000000080398a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80398a:	55                   	push   %rbp
+  80398b:	48 89 e5             	mov    %rsp,%rbp
+  80398e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803992:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803996:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80399b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80399f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8039a6:	48 85 ff             	test   %rdi,%rdi
+  8039a9:	74 2b                	je     8039d6 <vsnprintf+0x4c>
+  8039ab:	48 85 f6             	test   %rsi,%rsi
+  8039ae:	74 26                	je     8039d6 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8039b0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8039b4:	48 bf db 31 80 00 00 	movabs $0x8031db,%rdi
+  8039bb:	00 00 00 
+  8039be:	48 b8 30 32 80 00 00 	movabs $0x803230,%rax
+  8039c5:	00 00 00 
+  8039c8:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8039ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039ce:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8039d1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8039d4:	c9                   	leave
+  8039d5:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8039d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039db:	eb f7                	jmp    8039d4 <vsnprintf+0x4a>
+
+00000000008039dd <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8039dd:	55                   	push   %rbp
+  8039de:	48 89 e5             	mov    %rsp,%rbp
+  8039e1:	48 83 ec 50          	sub    $0x50,%rsp
+  8039e5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8039e9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8039ed:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8039f1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8039f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8039fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a00:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803a04:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803a08:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803a0c:	48 b8 8a 39 80 00 00 	movabs $0x80398a,%rax
+  803a13:	00 00 00 
+  803a16:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803a18:	c9                   	leave
+  803a19:	c3                   	ret
+
+0000000000803a1a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803a1a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803a1d:	74 10                	je     803a2f <strlen+0x15>
+    size_t n = 0;
+  803a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803a24:	48 83 c0 01          	add    $0x1,%rax
+  803a28:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803a2c:	75 f6                	jne    803a24 <strlen+0xa>
+  803a2e:	c3                   	ret
+    size_t n = 0;
+  803a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803a34:	c3                   	ret
+
+0000000000803a35 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803a35:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803a38:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803a3d:	48 85 f6             	test   %rsi,%rsi
+  803a40:	74 11                	je     803a53 <strnlen+0x1e>
+  803a42:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803a46:	74 0c                	je     803a54 <strnlen+0x1f>
+  803a48:	48 83 c2 01          	add    $0x1,%rdx
+  803a4c:	48 39 d0             	cmp    %rdx,%rax
+  803a4f:	75 f1                	jne    803a42 <strnlen+0xd>
+  803a51:	eb 04                	jmp    803a57 <strnlen+0x22>
+  803a53:	c3                   	ret
+  803a54:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803a57:	c3                   	ret
+
+0000000000803a58 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803a58:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803a5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a60:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803a64:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803a67:	48 83 c2 01          	add    $0x1,%rdx
+  803a6b:	84 c9                	test   %cl,%cl
+  803a6d:	75 f1                	jne    803a60 <strcpy+0x8>
+        ;
+    return res;
+}
+  803a6f:	c3                   	ret
+
+0000000000803a70 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803a70:	55                   	push   %rbp
+  803a71:	48 89 e5             	mov    %rsp,%rbp
+  803a74:	41 54                	push   %r12
+  803a76:	53                   	push   %rbx
+  803a77:	48 89 fb             	mov    %rdi,%rbx
+  803a7a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a7d:	48 b8 1a 3a 80 00 00 	movabs $0x803a1a,%rax
+  803a84:	00 00 00 
+  803a87:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a89:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a8d:	4c 89 e6             	mov    %r12,%rsi
+  803a90:	48 b8 58 3a 80 00 00 	movabs $0x803a58,%rax
+  803a97:	00 00 00 
+  803a9a:	ff d0                	call   *%rax
+    return dst;
+}
+  803a9c:	48 89 d8             	mov    %rbx,%rax
+  803a9f:	5b                   	pop    %rbx
+  803aa0:	41 5c                	pop    %r12
+  803aa2:	5d                   	pop    %rbp
+  803aa3:	c3                   	ret
+
+0000000000803aa4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803aa4:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803aa7:	48 85 d2             	test   %rdx,%rdx
+  803aaa:	74 1f                	je     803acb <strncpy+0x27>
+  803aac:	48 01 fa             	add    %rdi,%rdx
+  803aaf:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803ab2:	48 83 c1 01          	add    $0x1,%rcx
+  803ab6:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803aba:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803abe:	41 80 f8 01          	cmp    $0x1,%r8b
+  803ac2:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803ac6:	48 39 ca             	cmp    %rcx,%rdx
+  803ac9:	75 e7                	jne    803ab2 <strncpy+0xe>
+    }
+    return ret;
+}
+  803acb:	c3                   	ret
+
+0000000000803acc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803acc:	48 89 f8             	mov    %rdi,%rax
+  803acf:	48 85 d2             	test   %rdx,%rdx
+  803ad2:	74 24                	je     803af8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803ad4:	48 83 ea 01          	sub    $0x1,%rdx
+  803ad8:	74 1b                	je     803af5 <strlcpy+0x29>
+  803ada:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803ade:	0f b6 16             	movzbl (%rsi),%edx
+  803ae1:	84 d2                	test   %dl,%dl
+  803ae3:	74 10                	je     803af5 <strlcpy+0x29>
+            *dst++ = *src++;
+  803ae5:	48 83 c6 01          	add    $0x1,%rsi
+  803ae9:	48 83 c0 01          	add    $0x1,%rax
+  803aed:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803af0:	48 39 c8             	cmp    %rcx,%rax
+  803af3:	75 e9                	jne    803ade <strlcpy+0x12>
+        *dst = '\0';
+  803af5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803af8:	48 29 f8             	sub    %rdi,%rax
+}
+  803afb:	c3                   	ret
+
+0000000000803afc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803afc:	0f b6 07             	movzbl (%rdi),%eax
+  803aff:	84 c0                	test   %al,%al
+  803b01:	74 13                	je     803b16 <strcmp+0x1a>
+  803b03:	38 06                	cmp    %al,(%rsi)
+  803b05:	75 0f                	jne    803b16 <strcmp+0x1a>
+  803b07:	48 83 c7 01          	add    $0x1,%rdi
+  803b0b:	48 83 c6 01          	add    $0x1,%rsi
+  803b0f:	0f b6 07             	movzbl (%rdi),%eax
+  803b12:	84 c0                	test   %al,%al
+  803b14:	75 ed                	jne    803b03 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803b16:	0f b6 c0             	movzbl %al,%eax
+  803b19:	0f b6 16             	movzbl (%rsi),%edx
+  803b1c:	29 d0                	sub    %edx,%eax
+}
+  803b1e:	c3                   	ret
+
+0000000000803b1f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803b1f:	48 85 d2             	test   %rdx,%rdx
+  803b22:	74 1f                	je     803b43 <strncmp+0x24>
+  803b24:	0f b6 07             	movzbl (%rdi),%eax
+  803b27:	84 c0                	test   %al,%al
+  803b29:	74 1e                	je     803b49 <strncmp+0x2a>
+  803b2b:	3a 06                	cmp    (%rsi),%al
+  803b2d:	75 1a                	jne    803b49 <strncmp+0x2a>
+  803b2f:	48 83 c7 01          	add    $0x1,%rdi
+  803b33:	48 83 c6 01          	add    $0x1,%rsi
+  803b37:	48 83 ea 01          	sub    $0x1,%rdx
+  803b3b:	75 e7                	jne    803b24 <strncmp+0x5>
+
+    if (!n) return 0;
+  803b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b42:	c3                   	ret
+  803b43:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b48:	c3                   	ret
+  803b49:	48 85 d2             	test   %rdx,%rdx
+  803b4c:	74 09                	je     803b57 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803b4e:	0f b6 07             	movzbl (%rdi),%eax
+  803b51:	0f b6 16             	movzbl (%rsi),%edx
+  803b54:	29 d0                	sub    %edx,%eax
+  803b56:	c3                   	ret
+    if (!n) return 0;
+  803b57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b5c:	c3                   	ret
+
+0000000000803b5d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803b5d:	0f b6 17             	movzbl (%rdi),%edx
+  803b60:	84 d2                	test   %dl,%dl
+  803b62:	74 18                	je     803b7c <strchr+0x1f>
+        if (*str == c) {
+  803b64:	0f be d2             	movsbl %dl,%edx
+  803b67:	39 f2                	cmp    %esi,%edx
+  803b69:	74 17                	je     803b82 <strchr+0x25>
+    for (; *str; str++) {
+  803b6b:	48 83 c7 01          	add    $0x1,%rdi
+  803b6f:	0f b6 17             	movzbl (%rdi),%edx
+  803b72:	84 d2                	test   %dl,%dl
+  803b74:	75 ee                	jne    803b64 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b76:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b7b:	c3                   	ret
+  803b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b81:	c3                   	ret
+  803b82:	48 89 f8             	mov    %rdi,%rax
+}
+  803b85:	c3                   	ret
+
+0000000000803b86 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b86:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b89:	0f b6 17             	movzbl (%rdi),%edx
+  803b8c:	84 d2                	test   %dl,%dl
+  803b8e:	74 13                	je     803ba3 <strfind+0x1d>
+  803b90:	0f be d2             	movsbl %dl,%edx
+  803b93:	39 f2                	cmp    %esi,%edx
+  803b95:	74 0b                	je     803ba2 <strfind+0x1c>
+  803b97:	48 83 c0 01          	add    $0x1,%rax
+  803b9b:	0f b6 10             	movzbl (%rax),%edx
+  803b9e:	84 d2                	test   %dl,%dl
+  803ba0:	75 ee                	jne    803b90 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803ba2:	c3                   	ret
+  803ba3:	c3                   	ret
+
+0000000000803ba4 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803ba4:	55                   	push   %rbp
+  803ba5:	48 89 e5             	mov    %rsp,%rbp
+  803ba8:	41 57                	push   %r15
+  803baa:	41 56                	push   %r14
+  803bac:	41 55                	push   %r13
+  803bae:	41 54                	push   %r12
+  803bb0:	53                   	push   %rbx
+  803bb1:	48 83 ec 08          	sub    $0x8,%rsp
+  803bb5:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803bb8:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803bbc:	45 84 ed             	test   %r13b,%r13b
+  803bbf:	75 12                	jne    803bd3 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803bc1:	4c 89 f8             	mov    %r15,%rax
+  803bc4:	48 83 c4 08          	add    $0x8,%rsp
+  803bc8:	5b                   	pop    %rbx
+  803bc9:	41 5c                	pop    %r12
+  803bcb:	41 5d                	pop    %r13
+  803bcd:	41 5e                	pop    %r14
+  803bcf:	41 5f                	pop    %r15
+  803bd1:	5d                   	pop    %rbp
+  803bd2:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803bd3:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803bd7:	4c 89 e7             	mov    %r12,%rdi
+  803bda:	48 b8 1a 3a 80 00 00 	movabs $0x803a1a,%rax
+  803be1:	00 00 00 
+  803be4:	ff d0                	call   *%rax
+  803be6:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803be9:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803bed:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803bf1:	49 bf 1f 3b 80 00 00 	movabs $0x803b1f,%r15
+  803bf8:	00 00 00 
+				if ((sc = *s++) == 0)
+  803bfb:	84 c0                	test   %al,%al
+  803bfd:	75 14                	jne    803c13 <strstr+0x6f>
+					return NULL;
+  803bff:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803c05:	eb ba                	jmp    803bc1 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803c07:	48 83 c3 01          	add    $0x1,%rbx
+  803c0b:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803c0f:	84 c0                	test   %al,%al
+  803c11:	74 1b                	je     803c2e <strstr+0x8a>
+			} while (sc != c);
+  803c13:	41 38 c5             	cmp    %al,%r13b
+  803c16:	75 ef                	jne    803c07 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803c18:	4c 89 f2             	mov    %r14,%rdx
+  803c1b:	4c 89 e6             	mov    %r12,%rsi
+  803c1e:	48 89 df             	mov    %rbx,%rdi
+  803c21:	41 ff d7             	call   *%r15
+  803c24:	85 c0                	test   %eax,%eax
+  803c26:	75 df                	jne    803c07 <strstr+0x63>
+  803c28:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803c2c:	eb 93                	jmp    803bc1 <strstr+0x1d>
+					return NULL;
+  803c2e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803c34:	eb 8b                	jmp    803bc1 <strstr+0x1d>
+
+0000000000803c36 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803c36:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803c38:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803c3b:	8d 57 20             	lea    0x20(%rdi),%edx
+  803c3e:	83 f9 1a             	cmp    $0x1a,%ecx
+  803c41:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803c44:	c3                   	ret
+
+0000000000803c45 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803c45:	55                   	push   %rbp
+  803c46:	48 89 e5             	mov    %rsp,%rbp
+  803c49:	41 57                	push   %r15
+  803c4b:	41 56                	push   %r14
+  803c4d:	41 55                	push   %r13
+  803c4f:	41 54                	push   %r12
+  803c51:	53                   	push   %rbx
+  803c52:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803c56:	48 39 f7             	cmp    %rsi,%rdi
+  803c59:	74 49                	je     803ca4 <strcasecmp+0x5f>
+  803c5b:	49 89 fd             	mov    %rdi,%r13
+  803c5e:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803c61:	49 bf 36 3c 80 00 00 	movabs $0x803c36,%r15
+  803c68:	00 00 00 
+  803c6b:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803c70:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c74:	41 ff d7             	call   *%r15
+  803c77:	89 c3                	mov    %eax,%ebx
+  803c79:	49 83 c4 01          	add    $0x1,%r12
+  803c7d:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c83:	41 ff d7             	call   *%r15
+  803c86:	29 c3                	sub    %eax,%ebx
+  803c88:	75 09                	jne    803c93 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c8a:	49 83 c5 01          	add    $0x1,%r13
+  803c8e:	45 84 f6             	test   %r14b,%r14b
+  803c91:	75 d8                	jne    803c6b <strcasecmp+0x26>
+}
+  803c93:	89 d8                	mov    %ebx,%eax
+  803c95:	48 83 c4 08          	add    $0x8,%rsp
+  803c99:	5b                   	pop    %rbx
+  803c9a:	41 5c                	pop    %r12
+  803c9c:	41 5d                	pop    %r13
+  803c9e:	41 5e                	pop    %r14
+  803ca0:	41 5f                	pop    %r15
+  803ca2:	5d                   	pop    %rbp
+  803ca3:	c3                   	ret
+        return 0;
+  803ca4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ca9:	eb e8                	jmp    803c93 <strcasecmp+0x4e>
+
+0000000000803cab <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803cab:	55                   	push   %rbp
+  803cac:	48 89 e5             	mov    %rsp,%rbp
+  803caf:	41 57                	push   %r15
+  803cb1:	41 56                	push   %r14
+  803cb3:	41 55                	push   %r13
+  803cb5:	41 54                	push   %r12
+  803cb7:	53                   	push   %rbx
+  803cb8:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803cbc:	48 85 d2             	test   %rdx,%rdx
+  803cbf:	74 4f                	je     803d10 <strncasecmp+0x65>
+  803cc1:	49 89 fc             	mov    %rdi,%r12
+  803cc4:	49 89 f5             	mov    %rsi,%r13
+  803cc7:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803ccb:	49 be 36 3c 80 00 00 	movabs $0x803c36,%r14
+  803cd2:	00 00 00 
+  803cd5:	49 83 c4 01          	add    $0x1,%r12
+  803cd9:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803cdf:	41 ff d6             	call   *%r14
+  803ce2:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803ce4:	49 83 c5 01          	add    $0x1,%r13
+  803ce8:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803ced:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803cf0:	29 c3                	sub    %eax,%ebx
+  803cf2:	85 c0                	test   %eax,%eax
+  803cf4:	74 09                	je     803cff <strncasecmp+0x54>
+  803cf6:	85 db                	test   %ebx,%ebx
+  803cf8:	75 05                	jne    803cff <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803cfa:	4d 39 fc             	cmp    %r15,%r12
+  803cfd:	75 d6                	jne    803cd5 <strncasecmp+0x2a>
+}
+  803cff:	89 d8                	mov    %ebx,%eax
+  803d01:	48 83 c4 08          	add    $0x8,%rsp
+  803d05:	5b                   	pop    %rbx
+  803d06:	41 5c                	pop    %r12
+  803d08:	41 5d                	pop    %r13
+  803d0a:	41 5e                	pop    %r14
+  803d0c:	41 5f                	pop    %r15
+  803d0e:	5d                   	pop    %rbp
+  803d0f:	c3                   	ret
+    int d = 0;
+  803d10:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803d15:	eb e8                	jmp    803cff <strncasecmp+0x54>
+
+0000000000803d17 <toupper>:
+
+int toupper(int c) {
+  803d17:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803d19:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803d1c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803d1f:	83 f9 1a             	cmp    $0x1a,%ecx
+  803d22:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803d25:	c3                   	ret
+
+0000000000803d26 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803d26:	83 ff 20             	cmp    $0x20,%edi
+  803d29:	0f 94 c0             	sete   %al
+  803d2c:	0f b6 c0             	movzbl %al,%eax
+}
+  803d2f:	c3                   	ret
+
+0000000000803d30 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803d30:	89 f8                	mov    %edi,%eax
+  803d32:	f7 d8                	neg    %eax
+  803d34:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803d37:	c3                   	ret
+
+0000000000803d38 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803d38:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803d3b:	48 89 f8             	mov    %rdi,%rax
+  803d3e:	48 f7 d8             	neg    %rax
+  803d41:	83 e0 07             	and    $0x7,%eax
+  803d44:	49 89 d1             	mov    %rdx,%r9
+  803d47:	49 29 c1             	sub    %rax,%r9
+  803d4a:	78 36                	js     803d82 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803d4c:	40 0f b6 c6          	movzbl %sil,%eax
+  803d50:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803d57:	01 01 01 
+  803d5a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803d5e:	40 f6 c7 07          	test   $0x7,%dil
+  803d62:	75 38                	jne    803d9c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803d64:	4c 89 c9             	mov    %r9,%rcx
+  803d67:	48 c1 f9 03          	sar    $0x3,%rcx
+  803d6b:	74 0c                	je     803d79 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803d6d:	fc                   	cld
+  803d6e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803d71:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d75:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d79:	4d 85 c9             	test   %r9,%r9
+  803d7c:	75 45                	jne    803dc3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d7e:	4c 89 c0             	mov    %r8,%rax
+  803d81:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d82:	48 85 d2             	test   %rdx,%rdx
+  803d85:	74 f7                	je     803d7e <memset+0x46>
+  803d87:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d8a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d8d:	48 83 c0 01          	add    $0x1,%rax
+  803d91:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d95:	48 39 c2             	cmp    %rax,%rdx
+  803d98:	75 f3                	jne    803d8d <memset+0x55>
+  803d9a:	eb e2                	jmp    803d7e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d9c:	40 f6 c7 01          	test   $0x1,%dil
+  803da0:	74 06                	je     803da8 <memset+0x70>
+  803da2:	88 07                	mov    %al,(%rdi)
+  803da4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803da8:	40 f6 c7 02          	test   $0x2,%dil
+  803dac:	74 07                	je     803db5 <memset+0x7d>
+  803dae:	66 89 07             	mov    %ax,(%rdi)
+  803db1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803db5:	40 f6 c7 04          	test   $0x4,%dil
+  803db9:	74 a9                	je     803d64 <memset+0x2c>
+  803dbb:	89 07                	mov    %eax,(%rdi)
+  803dbd:	48 83 c7 04          	add    $0x4,%rdi
+  803dc1:	eb a1                	jmp    803d64 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803dc3:	41 f6 c1 04          	test   $0x4,%r9b
+  803dc7:	74 06                	je     803dcf <memset+0x97>
+  803dc9:	89 07                	mov    %eax,(%rdi)
+  803dcb:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803dcf:	41 f6 c1 02          	test   $0x2,%r9b
+  803dd3:	74 07                	je     803ddc <memset+0xa4>
+  803dd5:	66 89 07             	mov    %ax,(%rdi)
+  803dd8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803ddc:	41 f6 c1 01          	test   $0x1,%r9b
+  803de0:	74 9c                	je     803d7e <memset+0x46>
+  803de2:	88 07                	mov    %al,(%rdi)
+  803de4:	eb 98                	jmp    803d7e <memset+0x46>
+
+0000000000803de6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803de6:	48 89 f8             	mov    %rdi,%rax
+  803de9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803dec:	48 39 fe             	cmp    %rdi,%rsi
+  803def:	73 3b                	jae    803e2c <memmove+0x46>
+  803df1:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803df5:	48 39 d7             	cmp    %rdx,%rdi
+  803df8:	73 32                	jae    803e2c <memmove+0x46>
+        s += n;
+        d += n;
+  803dfa:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803dfe:	48 89 d6             	mov    %rdx,%rsi
+  803e01:	48 09 fe             	or     %rdi,%rsi
+  803e04:	48 09 ce             	or     %rcx,%rsi
+  803e07:	40 f6 c6 07          	test   $0x7,%sil
+  803e0b:	75 12                	jne    803e1f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803e0d:	48 83 ef 08          	sub    $0x8,%rdi
+  803e11:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803e15:	48 c1 e9 03          	shr    $0x3,%rcx
+  803e19:	fd                   	std
+  803e1a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803e1d:	fc                   	cld
+  803e1e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803e1f:	48 83 ef 01          	sub    $0x1,%rdi
+  803e23:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803e27:	fd                   	std
+  803e28:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803e2a:	eb f1                	jmp    803e1d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803e2c:	48 89 f2             	mov    %rsi,%rdx
+  803e2f:	48 09 c2             	or     %rax,%rdx
+  803e32:	48 09 ca             	or     %rcx,%rdx
+  803e35:	f6 c2 07             	test   $0x7,%dl
+  803e38:	75 0c                	jne    803e46 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803e3a:	48 c1 e9 03          	shr    $0x3,%rcx
+  803e3e:	48 89 c7             	mov    %rax,%rdi
+  803e41:	fc                   	cld
+  803e42:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803e45:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803e46:	48 89 c7             	mov    %rax,%rdi
+  803e49:	fc                   	cld
+  803e4a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803e4c:	c3                   	ret
+
+0000000000803e4d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803e4d:	55                   	push   %rbp
+  803e4e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803e51:	48 b8 e6 3d 80 00 00 	movabs $0x803de6,%rax
+  803e58:	00 00 00 
+  803e5b:	ff d0                	call   *%rax
+}
+  803e5d:	5d                   	pop    %rbp
+  803e5e:	c3                   	ret
+
+0000000000803e5f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803e5f:	55                   	push   %rbp
+  803e60:	48 89 e5             	mov    %rsp,%rbp
+  803e63:	41 57                	push   %r15
+  803e65:	41 56                	push   %r14
+  803e67:	41 55                	push   %r13
+  803e69:	41 54                	push   %r12
+  803e6b:	53                   	push   %rbx
+  803e6c:	48 83 ec 08          	sub    $0x8,%rsp
+  803e70:	49 89 fe             	mov    %rdi,%r14
+  803e73:	49 89 f7             	mov    %rsi,%r15
+  803e76:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e79:	48 89 f7             	mov    %rsi,%rdi
+  803e7c:	48 b8 1a 3a 80 00 00 	movabs $0x803a1a,%rax
+  803e83:	00 00 00 
+  803e86:	ff d0                	call   *%rax
+  803e88:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e8b:	48 89 de             	mov    %rbx,%rsi
+  803e8e:	4c 89 f7             	mov    %r14,%rdi
+  803e91:	48 b8 35 3a 80 00 00 	movabs $0x803a35,%rax
+  803e98:	00 00 00 
+  803e9b:	ff d0                	call   *%rax
+  803e9d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803ea0:	48 39 c3             	cmp    %rax,%rbx
+  803ea3:	74 36                	je     803edb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803ea5:	48 89 d8             	mov    %rbx,%rax
+  803ea8:	4c 29 e8             	sub    %r13,%rax
+  803eab:	49 39 c4             	cmp    %rax,%r12
+  803eae:	73 31                	jae    803ee1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803eb0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803eb5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803eb9:	4c 89 fe             	mov    %r15,%rsi
+  803ebc:	48 b8 4d 3e 80 00 00 	movabs $0x803e4d,%rax
+  803ec3:	00 00 00 
+  803ec6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803ec8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803ecc:	48 83 c4 08          	add    $0x8,%rsp
+  803ed0:	5b                   	pop    %rbx
+  803ed1:	41 5c                	pop    %r12
+  803ed3:	41 5d                	pop    %r13
+  803ed5:	41 5e                	pop    %r14
+  803ed7:	41 5f                	pop    %r15
+  803ed9:	5d                   	pop    %rbp
+  803eda:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803edb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803edf:	eb eb                	jmp    803ecc <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803ee1:	48 83 eb 01          	sub    $0x1,%rbx
+  803ee5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803ee9:	48 89 da             	mov    %rbx,%rdx
+  803eec:	4c 89 fe             	mov    %r15,%rsi
+  803eef:	48 b8 4d 3e 80 00 00 	movabs $0x803e4d,%rax
+  803ef6:	00 00 00 
+  803ef9:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803efb:	49 01 de             	add    %rbx,%r14
+  803efe:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803f03:	eb c3                	jmp    803ec8 <strlcat+0x69>
+
+0000000000803f05 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803f05:	48 85 d2             	test   %rdx,%rdx
+  803f08:	74 2d                	je     803f37 <memcmp+0x32>
+  803f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803f0f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803f13:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803f18:	44 38 c1             	cmp    %r8b,%cl
+  803f1b:	75 0f                	jne    803f2c <memcmp+0x27>
+    while (n-- > 0) {
+  803f1d:	48 83 c0 01          	add    $0x1,%rax
+  803f21:	48 39 c2             	cmp    %rax,%rdx
+  803f24:	75 e9                	jne    803f0f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803f26:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f2b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803f2c:	0f b6 c1             	movzbl %cl,%eax
+  803f2f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803f33:	44 29 c0             	sub    %r8d,%eax
+  803f36:	c3                   	ret
+    return 0;
+  803f37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f3c:	c3                   	ret
+
+0000000000803f3d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803f3d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803f41:	48 39 c7             	cmp    %rax,%rdi
+  803f44:	73 0f                	jae    803f55 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803f46:	40 38 37             	cmp    %sil,(%rdi)
+  803f49:	74 0e                	je     803f59 <memfind+0x1c>
+    for (; src < end; src++) {
+  803f4b:	48 83 c7 01          	add    $0x1,%rdi
+  803f4f:	48 39 f8             	cmp    %rdi,%rax
+  803f52:	75 f2                	jne    803f46 <memfind+0x9>
+  803f54:	c3                   	ret
+  803f55:	48 89 f8             	mov    %rdi,%rax
+  803f58:	c3                   	ret
+  803f59:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803f5c:	c3                   	ret
+
+0000000000803f5d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803f5d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803f60:	0f b6 37             	movzbl (%rdi),%esi
+  803f63:	40 80 fe 20          	cmp    $0x20,%sil
+  803f67:	74 06                	je     803f6f <strtol+0x12>
+  803f69:	40 80 fe 09          	cmp    $0x9,%sil
+  803f6d:	75 13                	jne    803f82 <strtol+0x25>
+  803f6f:	48 83 c7 01          	add    $0x1,%rdi
+  803f73:	0f b6 37             	movzbl (%rdi),%esi
+  803f76:	40 80 fe 20          	cmp    $0x20,%sil
+  803f7a:	74 f3                	je     803f6f <strtol+0x12>
+  803f7c:	40 80 fe 09          	cmp    $0x9,%sil
+  803f80:	74 ed                	je     803f6f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f82:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f85:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f88:	3c 01                	cmp    $0x1,%al
+  803f8a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f8e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f94:	75 0f                	jne    803fa5 <strtol+0x48>
+  803f96:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f99:	74 14                	je     803faf <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f9b:	85 d2                	test   %edx,%edx
+  803f9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803fa2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803faa:	4c 63 ca             	movslq %edx,%r9
+  803fad:	eb 36                	jmp    803fe5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803faf:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803fb3:	74 0f                	je     803fc4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803fb5:	85 d2                	test   %edx,%edx
+  803fb7:	75 ec                	jne    803fa5 <strtol+0x48>
+        s++;
+  803fb9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803fbd:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803fc2:	eb e1                	jmp    803fa5 <strtol+0x48>
+        s += 2;
+  803fc4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803fc8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803fcd:	eb d6                	jmp    803fa5 <strtol+0x48>
+            dig -= '0';
+  803fcf:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803fd2:	44 0f b6 c1          	movzbl %cl,%r8d
+  803fd6:	41 39 d0             	cmp    %edx,%r8d
+  803fd9:	7d 21                	jge    803ffc <strtol+0x9f>
+        val = val * base + dig;
+  803fdb:	49 0f af c1          	imul   %r9,%rax
+  803fdf:	0f b6 c9             	movzbl %cl,%ecx
+  803fe2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803fe5:	48 83 c7 01          	add    $0x1,%rdi
+  803fe9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803fed:	80 f9 39             	cmp    $0x39,%cl
+  803ff0:	76 dd                	jbe    803fcf <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803ff2:	80 f9 7b             	cmp    $0x7b,%cl
+  803ff5:	77 05                	ja     803ffc <strtol+0x9f>
+            dig -= 'a' - 10;
+  803ff7:	83 e9 57             	sub    $0x57,%ecx
+  803ffa:	eb d6                	jmp    803fd2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803ffc:	4d 85 d2             	test   %r10,%r10
+  803fff:	74 03                	je     804004 <strtol+0xa7>
+  804001:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  804004:	48 89 c2             	mov    %rax,%rdx
+  804007:	48 f7 da             	neg    %rdx
+  80400a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80400e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  804012:	c3                   	ret
+
+0000000000804013 <atoi>:
+int atoi(const char *str) {
+  804013:	55                   	push   %rbp
+  804014:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  804017:	ba 00 00 00 00       	mov    $0x0,%edx
+  80401c:	be 00 00 00 00       	mov    $0x0,%esi
+  804021:	48 b8 5d 3f 80 00 00 	movabs $0x803f5d,%rax
+  804028:	00 00 00 
+  80402b:	ff d0                	call   *%rax
+}
+  80402d:	5d                   	pop    %rbp
+  80402e:	c3                   	ret
+
+000000000080402f <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80402f:	55                   	push   %rbp
+  804030:	48 89 e5             	mov    %rsp,%rbp
+  804033:	41 56                	push   %r14
+  804035:	41 55                	push   %r13
+  804037:	41 54                	push   %r12
+  804039:	53                   	push   %rbx
+  80403a:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80403d:	48 b8 88 95 98 00 00 	movabs $0x989588,%rax
+  804044:	00 00 00 
+  804047:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80404b:	74 27                	je     804074 <_handle_vectored_pagefault+0x45>
+  80404d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804052:	49 bd 40 95 98 00 00 	movabs $0x989540,%r13
+  804059:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80405c:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80405f:	4c 89 e7             	mov    %r12,%rdi
+  804062:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804067:	84 c0                	test   %al,%al
+  804069:	75 45                	jne    8040b0 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80406b:	48 83 c3 01          	add    $0x1,%rbx
+  80406f:	49 3b 1e             	cmp    (%r14),%rbx
+  804072:	72 eb                	jb     80405f <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804074:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80407b:	00 
+  80407c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804081:	4d 8b 04 24          	mov    (%r12),%r8
+  804085:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  80408c:	00 00 00 
+  80408f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804094:	48 bf 30 57 80 00 00 	movabs $0x805730,%rdi
+  80409b:	00 00 00 
+  80409e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040a3:	49 ba 90 2f 80 00 00 	movabs $0x802f90,%r10
+  8040aa:	00 00 00 
+  8040ad:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8040b0:	5b                   	pop    %rbx
+  8040b1:	41 5c                	pop    %r12
+  8040b3:	41 5d                	pop    %r13
+  8040b5:	41 5e                	pop    %r14
+  8040b7:	5d                   	pop    %rbp
+  8040b8:	c3                   	ret
+
+00000000008040b9 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8040b9:	55                   	push   %rbp
+  8040ba:	48 89 e5             	mov    %rsp,%rbp
+  8040bd:	41 54                	push   %r12
+  8040bf:	53                   	push   %rbx
+  8040c0:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8040c3:	48 b8 80 95 98 00 00 	movabs $0x989580,%rax
+  8040ca:	00 00 00 
+  8040cd:	80 38 00             	cmpb   $0x0,(%rax)
+  8040d0:	74 64                	je     804136 <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8040d2:	48 b8 88 95 98 00 00 	movabs $0x989588,%rax
+  8040d9:	00 00 00 
+  8040dc:	48 8b 10             	mov    (%rax),%rdx
+  8040df:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8040e4:	48 b9 40 95 98 00 00 	movabs $0x989540,%rcx
+  8040eb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8040ee:	48 85 d2             	test   %rdx,%rdx
+  8040f1:	74 1d                	je     804110 <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8040f3:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8040f7:	0f 84 ee 00 00 00    	je     8041eb <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8040fd:	48 83 c0 01          	add    $0x1,%rax
+  804101:	48 39 d0             	cmp    %rdx,%rax
+  804104:	75 ed                	jne    8040f3 <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804106:	48 83 fa 08          	cmp    $0x8,%rdx
+  80410a:	0f 84 a9 00 00 00    	je     8041b9 <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804110:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804114:	48 a3 88 95 98 00 00 	movabs %rax,0x989588
+  80411b:	00 00 00 
+  80411e:	48 b8 40 95 98 00 00 	movabs $0x989540,%rax
+  804125:	00 00 00 
+  804128:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  80412c:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  804131:	5b                   	pop    %rbx
+  804132:	41 5c                	pop    %r12
+  804134:	5d                   	pop    %rbp
+  804135:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804136:	49 bc e6 01 80 00 00 	movabs $0x8001e6,%r12
+  80413d:	00 00 00 
+  804140:	41 ff d4             	call   *%r12
+  804143:	89 c7                	mov    %eax,%edi
+  804145:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80414a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80414f:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804156:	00 00 00 
+  804159:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  804160:	00 00 00 
+  804163:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804165:	48 ba 88 95 98 00 00 	movabs $0x989588,%rdx
+  80416c:	00 00 00 
+  80416f:	48 8b 02             	mov    (%rdx),%rax
+  804172:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804176:	48 89 0a             	mov    %rcx,(%rdx)
+  804179:	48 ba 40 95 98 00 00 	movabs $0x989540,%rdx
+  804180:	00 00 00 
+  804183:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804187:	48 b8 80 95 98 00 00 	movabs $0x989580,%rax
+  80418e:	00 00 00 
+  804191:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804194:	41 ff d4             	call   *%r12
+  804197:	89 c7                	mov    %eax,%edi
+  804199:	48 be bc 0c 80 00 00 	movabs $0x800cbc,%rsi
+  8041a0:	00 00 00 
+  8041a3:	48 b8 be 05 80 00 00 	movabs $0x8005be,%rax
+  8041aa:	00 00 00 
+  8041ad:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8041af:	85 c0                	test   %eax,%eax
+  8041b1:	0f 89 7a ff ff ff    	jns    804131 <add_pgfault_handler+0x78>
+  8041b7:	eb 05                	jmp    8041be <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  8041b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8041be:	89 c1                	mov    %eax,%ecx
+  8041c0:	48 ba 3e 57 80 00 00 	movabs $0x80573e,%rdx
+  8041c7:	00 00 00 
+  8041ca:	be 3b 00 00 00       	mov    $0x3b,%esi
+  8041cf:	48 bf 30 57 80 00 00 	movabs $0x805730,%rdi
+  8041d6:	00 00 00 
+  8041d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041de:	49 b8 90 2f 80 00 00 	movabs $0x802f90,%r8
+  8041e5:	00 00 00 
+  8041e8:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8041eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f0:	e9 3c ff ff ff       	jmp    804131 <add_pgfault_handler+0x78>
+
+00000000008041f5 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8041f5:	55                   	push   %rbp
+  8041f6:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8041f9:	48 b8 80 95 98 00 00 	movabs $0x989580,%rax
+  804200:	00 00 00 
+  804203:	80 38 00             	cmpb   $0x0,(%rax)
+  804206:	74 33                	je     80423b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804208:	48 a1 88 95 98 00 00 	movabs 0x989588,%rax
+  80420f:	00 00 00 
+  804212:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804217:	48 ba 40 95 98 00 00 	movabs $0x989540,%rdx
+  80421e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804221:	48 85 c0             	test   %rax,%rax
+  804224:	0f 84 85 00 00 00    	je     8042af <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80422a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80422e:	74 40                	je     804270 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804230:	48 83 c1 01          	add    $0x1,%rcx
+  804234:	48 39 c1             	cmp    %rax,%rcx
+  804237:	75 f1                	jne    80422a <remove_pgfault_handler+0x35>
+  804239:	eb 74                	jmp    8042af <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80423b:	48 b9 56 57 80 00 00 	movabs $0x805756,%rcx
+  804242:	00 00 00 
+  804245:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  80424c:	00 00 00 
+  80424f:	be 41 00 00 00       	mov    $0x41,%esi
+  804254:	48 bf 30 57 80 00 00 	movabs $0x805730,%rdi
+  80425b:	00 00 00 
+  80425e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804263:	49 b8 90 2f 80 00 00 	movabs $0x802f90,%r8
+  80426a:	00 00 00 
+  80426d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804270:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804277:	00 
+  804278:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80427c:	48 29 ca             	sub    %rcx,%rdx
+  80427f:	48 b8 40 95 98 00 00 	movabs $0x989540,%rax
+  804286:	00 00 00 
+  804289:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80428d:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804292:	48 89 ce             	mov    %rcx,%rsi
+  804295:	48 b8 e6 3d 80 00 00 	movabs $0x803de6,%rax
+  80429c:	00 00 00 
+  80429f:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8042a1:	48 b8 88 95 98 00 00 	movabs $0x989588,%rax
+  8042a8:	00 00 00 
+  8042ab:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8042af:	5d                   	pop    %rbp
+  8042b0:	c3                   	ret
+
+00000000008042b1 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8042b1:	55                   	push   %rbp
+  8042b2:	48 89 e5             	mov    %rsp,%rbp
+  8042b5:	41 55                	push   %r13
+  8042b7:	41 54                	push   %r12
+  8042b9:	53                   	push   %rbx
+  8042ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8042be:	49 89 fc             	mov    %rdi,%r12
+  8042c1:	48 89 f7             	mov    %rsi,%rdi
+  8042c4:	48 89 d3             	mov    %rdx,%rbx
+  8042c7:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8042ca:	48 85 f6             	test   %rsi,%rsi
+  8042cd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8042d4:	00 00 00 
+  8042d7:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8042db:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042e0:	48 85 d2             	test   %rdx,%rdx
+  8042e3:	74 03                	je     8042e8 <ipc_recv+0x37>
+  8042e5:	48 8b 32             	mov    (%rdx),%rsi
+  8042e8:	48 b8 53 06 80 00 00 	movabs $0x800653,%rax
+  8042ef:	00 00 00 
+  8042f2:	ff d0                	call   *%rax
+    if (errno) {
+  8042f4:	85 c0                	test   %eax,%eax
+  8042f6:	74 1c                	je     804314 <ipc_recv+0x63>
+        if (from_env_store)
+  8042f8:	4d 85 e4             	test   %r12,%r12
+  8042fb:	74 08                	je     804305 <ipc_recv+0x54>
+            *from_env_store = 0;
+  8042fd:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804304:	00 
+
+        if (perm_store)
+  804305:	4d 85 ed             	test   %r13,%r13
+  804308:	74 74                	je     80437e <ipc_recv+0xcd>
+            *perm_store = 0;
+  80430a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804311:	00 
+  804312:	eb 6a                	jmp    80437e <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804314:	4d 85 e4             	test   %r12,%r12
+  804317:	74 14                	je     80432d <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804319:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804320:	00 00 00 
+  804323:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804329:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80432d:	48 85 db             	test   %rbx,%rbx
+  804330:	74 23                	je     804355 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804332:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804339:	00 00 00 
+  80433c:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804342:	ba 00 00 00 00       	mov    $0x0,%edx
+  804347:	85 c9                	test   %ecx,%ecx
+  804349:	74 07                	je     804352 <ipc_recv+0xa1>
+  80434b:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804352:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804355:	4d 85 ed             	test   %r13,%r13
+  804358:	74 14                	je     80436e <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80435a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804361:	00 00 00 
+  804364:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80436a:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  80436e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804375:	00 00 00 
+  804378:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  80437e:	48 83 c4 08          	add    $0x8,%rsp
+  804382:	5b                   	pop    %rbx
+  804383:	41 5c                	pop    %r12
+  804385:	41 5d                	pop    %r13
+  804387:	5d                   	pop    %rbp
+  804388:	c3                   	ret
+
+0000000000804389 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804389:	55                   	push   %rbp
+  80438a:	48 89 e5             	mov    %rsp,%rbp
+  80438d:	41 55                	push   %r13
+  80438f:	41 54                	push   %r12
+  804391:	53                   	push   %rbx
+  804392:	48 83 ec 08          	sub    $0x8,%rsp
+  804396:	49 89 fc             	mov    %rdi,%r12
+  804399:	48 89 f7             	mov    %rsi,%rdi
+  80439c:	48 89 d3             	mov    %rdx,%rbx
+  80439f:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8043a2:	48 85 f6             	test   %rsi,%rsi
+  8043a5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8043ac:	00 00 00 
+  8043af:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8043b3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043b8:	48 85 d2             	test   %rdx,%rdx
+  8043bb:	74 03                	je     8043c0 <ipc_try_recv+0x37>
+  8043bd:	48 8b 32             	mov    (%rdx),%rsi
+  8043c0:	48 b8 bc 06 80 00 00 	movabs $0x8006bc,%rax
+  8043c7:	00 00 00 
+  8043ca:	ff d0                	call   *%rax
+    if (errno) {
+  8043cc:	85 c0                	test   %eax,%eax
+  8043ce:	75 75                	jne    804445 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8043d0:	4d 85 e4             	test   %r12,%r12
+  8043d3:	74 14                	je     8043e9 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8043d5:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8043dc:	00 00 00 
+  8043df:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8043e5:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8043e9:	48 85 db             	test   %rbx,%rbx
+  8043ec:	74 23                	je     804411 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8043ee:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8043f5:	00 00 00 
+  8043f8:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8043fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  804403:	85 c9                	test   %ecx,%ecx
+  804405:	74 07                	je     80440e <ipc_try_recv+0x85>
+  804407:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80440e:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804411:	4d 85 ed             	test   %r13,%r13
+  804414:	74 14                	je     80442a <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804416:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80441d:	00 00 00 
+  804420:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804426:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80442a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804431:	00 00 00 
+  804434:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80443a:	48 83 c4 08          	add    $0x8,%rsp
+  80443e:	5b                   	pop    %rbx
+  80443f:	41 5c                	pop    %r12
+  804441:	41 5d                	pop    %r13
+  804443:	5d                   	pop    %rbp
+  804444:	c3                   	ret
+        if (from_env_store)
+  804445:	4d 85 e4             	test   %r12,%r12
+  804448:	74 08                	je     804452 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80444a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804451:	00 
+        if (perm_store)
+  804452:	4d 85 ed             	test   %r13,%r13
+  804455:	74 e3                	je     80443a <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804457:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80445e:	00 
+  80445f:	eb d9                	jmp    80443a <ipc_try_recv+0xb1>
+
+0000000000804461 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804461:	55                   	push   %rbp
+  804462:	48 89 e5             	mov    %rsp,%rbp
+  804465:	41 57                	push   %r15
+  804467:	41 56                	push   %r14
+  804469:	41 55                	push   %r13
+  80446b:	41 54                	push   %r12
+  80446d:	53                   	push   %rbx
+  80446e:	48 83 ec 18          	sub    $0x18,%rsp
+  804472:	41 89 fd             	mov    %edi,%r13d
+  804475:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804478:	48 89 d3             	mov    %rdx,%rbx
+  80447b:	49 89 cc             	mov    %rcx,%r12
+  80447e:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804482:	48 85 d2             	test   %rdx,%rdx
+  804485:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80448c:	00 00 00 
+  80448f:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804493:	49 be 27 06 80 00 00 	movabs $0x800627,%r14
+  80449a:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  80449d:	49 bf 17 02 80 00 00 	movabs $0x800217,%r15
+  8044a4:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8044a7:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8044aa:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8044ae:	4c 89 e1             	mov    %r12,%rcx
+  8044b1:	48 89 da             	mov    %rbx,%rdx
+  8044b4:	44 89 ef             	mov    %r13d,%edi
+  8044b7:	41 ff d6             	call   *%r14
+  8044ba:	85 c0                	test   %eax,%eax
+  8044bc:	74 37                	je     8044f5 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8044be:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8044c1:	75 05                	jne    8044c8 <ipc_send+0x67>
+        sys_yield();
+  8044c3:	41 ff d7             	call   *%r15
+  8044c6:	eb df                	jmp    8044a7 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8044c8:	89 c1                	mov    %eax,%ecx
+  8044ca:	48 ba 70 57 80 00 00 	movabs $0x805770,%rdx
+  8044d1:	00 00 00 
+  8044d4:	be 65 00 00 00       	mov    $0x65,%esi
+  8044d9:	48 bf 8b 57 80 00 00 	movabs $0x80578b,%rdi
+  8044e0:	00 00 00 
+  8044e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e8:	49 b8 90 2f 80 00 00 	movabs $0x802f90,%r8
+  8044ef:	00 00 00 
+  8044f2:	41 ff d0             	call   *%r8
+    }
+}
+  8044f5:	48 83 c4 18          	add    $0x18,%rsp
+  8044f9:	5b                   	pop    %rbx
+  8044fa:	41 5c                	pop    %r12
+  8044fc:	41 5d                	pop    %r13
+  8044fe:	41 5e                	pop    %r14
+  804500:	41 5f                	pop    %r15
+  804502:	5d                   	pop    %rbp
+  804503:	c3                   	ret
+
+0000000000804504 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804504:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804509:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804510:	00 00 00 
+  804513:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80451a:	48 01 ca             	add    %rcx,%rdx
+  80451d:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804523:	39 fa                	cmp    %edi,%edx
+  804525:	74 12                	je     804539 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804527:	48 83 c0 01          	add    $0x1,%rax
+  80452b:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804531:	75 e0                	jne    804513 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804533:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804538:	c3                   	ret
+            return envs[i].env_id;
+  804539:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804540:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804547:	00 00 00 
+  80454a:	48 01 d0             	add    %rdx,%rax
+  80454d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804553:	c3                   	ret
+
+0000000000804554 <__text_end>:
+  804554:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455b:	00 00 00 
+  80455e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804565:	00 00 00 
+  804568:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456f:	00 00 00 
+  804572:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804579:	00 00 00 
+  80457c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804583:	00 00 00 
+  804586:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458d:	00 00 00 
+  804590:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804597:	00 00 00 
+  80459a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a1:	00 00 00 
+  8045a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ab:	00 00 00 
+  8045ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b5:	00 00 00 
+  8045b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bf:	00 00 00 
+  8045c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c9:	00 00 00 
+  8045cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d3:	00 00 00 
+  8045d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045dd:	00 00 00 
+  8045e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e7:	00 00 00 
+  8045ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f1:	00 00 00 
+  8045f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fb:	00 00 00 
+  8045fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804605:	00 00 00 
+  804608:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460f:	00 00 00 
+  804612:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804619:	00 00 00 
+  80461c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804623:	00 00 00 
+  804626:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462d:	00 00 00 
+  804630:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804637:	00 00 00 
+  80463a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804641:	00 00 00 
+  804644:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464b:	00 00 00 
+  80464e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804655:	00 00 00 
+  804658:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465f:	00 00 00 
+  804662:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804669:	00 00 00 
+  80466c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804673:	00 00 00 
+  804676:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467d:	00 00 00 
+  804680:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804687:	00 00 00 
+  80468a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804691:	00 00 00 
+  804694:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469b:	00 00 00 
+  80469e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a5:	00 00 00 
+  8046a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046af:	00 00 00 
+  8046b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b9:	00 00 00 
+  8046bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c3:	00 00 00 
+  8046c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cd:	00 00 00 
+  8046d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d7:	00 00 00 
+  8046da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e1:	00 00 00 
+  8046e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046eb:	00 00 00 
+  8046ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f5:	00 00 00 
+  8046f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ff:	00 00 00 
+  804702:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804709:	00 00 00 
+  80470c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804713:	00 00 00 
+  804716:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471d:	00 00 00 
+  804720:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804727:	00 00 00 
+  80472a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804731:	00 00 00 
+  804734:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473b:	00 00 00 
+  80473e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804745:	00 00 00 
+  804748:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474f:	00 00 00 
+  804752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804759:	00 00 00 
+  80475c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804763:	00 00 00 
+  804766:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476d:	00 00 00 
+  804770:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804777:	00 00 00 
+  80477a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804781:	00 00 00 
+  804784:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478b:	00 00 00 
+  80478e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804795:	00 00 00 
+  804798:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479f:	00 00 00 
+  8047a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a9:	00 00 00 
+  8047ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b3:	00 00 00 
+  8047b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bd:	00 00 00 
+  8047c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c7:	00 00 00 
+  8047ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d1:	00 00 00 
+  8047d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047db:	00 00 00 
+  8047de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e5:	00 00 00 
+  8047e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ef:	00 00 00 
+  8047f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f9:	00 00 00 
+  8047fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804803:	00 00 00 
+  804806:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480d:	00 00 00 
+  804810:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804817:	00 00 00 
+  80481a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804821:	00 00 00 
+  804824:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482b:	00 00 00 
+  80482e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804835:	00 00 00 
+  804838:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483f:	00 00 00 
+  804842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804849:	00 00 00 
+  80484c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804853:	00 00 00 
+  804856:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485d:	00 00 00 
+  804860:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804867:	00 00 00 
+  80486a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804871:	00 00 00 
+  804874:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487b:	00 00 00 
+  80487e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804885:	00 00 00 
+  804888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488f:	00 00 00 
+  804892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804899:	00 00 00 
+  80489c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a3:	00 00 00 
+  8048a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ad:	00 00 00 
+  8048b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b7:	00 00 00 
+  8048ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c1:	00 00 00 
+  8048c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cb:	00 00 00 
+  8048ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d5:	00 00 00 
+  8048d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048df:	00 00 00 
+  8048e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e9:	00 00 00 
+  8048ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f3:	00 00 00 
+  8048f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fd:	00 00 00 
+  804900:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804907:	00 00 00 
+  80490a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804911:	00 00 00 
+  804914:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491b:	00 00 00 
+  80491e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804925:	00 00 00 
+  804928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492f:	00 00 00 
+  804932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804939:	00 00 00 
+  80493c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804943:	00 00 00 
+  804946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494d:	00 00 00 
+  804950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804957:	00 00 00 
+  80495a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804961:	00 00 00 
+  804964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496b:	00 00 00 
+  80496e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804975:	00 00 00 
+  804978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497f:	00 00 00 
+  804982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804989:	00 00 00 
+  80498c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804993:	00 00 00 
+  804996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499d:	00 00 00 
+  8049a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a7:	00 00 00 
+  8049aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b1:	00 00 00 
+  8049b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bb:	00 00 00 
+  8049be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c5:	00 00 00 
+  8049c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cf:	00 00 00 
+  8049d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d9:	00 00 00 
+  8049dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e3:	00 00 00 
+  8049e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ed:	00 00 00 
+  8049f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f7:	00 00 00 
+  8049fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a01:	00 00 00 
+  804a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0b:	00 00 00 
+  804a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a15:	00 00 00 
+  804a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1f:	00 00 00 
+  804a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a29:	00 00 00 
+  804a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a33:	00 00 00 
+  804a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3d:	00 00 00 
+  804a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a47:	00 00 00 
+  804a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a51:	00 00 00 
+  804a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5b:	00 00 00 
+  804a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a65:	00 00 00 
+  804a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6f:	00 00 00 
+  804a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a79:	00 00 00 
+  804a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a83:	00 00 00 
+  804a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8d:	00 00 00 
+  804a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a97:	00 00 00 
+  804a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa1:	00 00 00 
+  804aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aab:	00 00 00 
+  804aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab5:	00 00 00 
+  804ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abf:	00 00 00 
+  804ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac9:	00 00 00 
+  804acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad3:	00 00 00 
+  804ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804add:	00 00 00 
+  804ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae7:	00 00 00 
+  804aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af1:	00 00 00 
+  804af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afb:	00 00 00 
+  804afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b05:	00 00 00 
+  804b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0f:	00 00 00 
+  804b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b19:	00 00 00 
+  804b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b23:	00 00 00 
+  804b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2d:	00 00 00 
+  804b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b37:	00 00 00 
+  804b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b41:	00 00 00 
+  804b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4b:	00 00 00 
+  804b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b55:	00 00 00 
+  804b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5f:	00 00 00 
+  804b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b69:	00 00 00 
+  804b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b73:	00 00 00 
+  804b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7d:	00 00 00 
+  804b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b87:	00 00 00 
+  804b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b91:	00 00 00 
+  804b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9b:	00 00 00 
+  804b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba5:	00 00 00 
+  804ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baf:	00 00 00 
+  804bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb9:	00 00 00 
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8100 @@
+
+obj/user/faultread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2a 00 00 00       	call   80004d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from location zero */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    cprintf("I read %08x from location 0!\n", *(volatile unsigned *)0);
+  800029:	8b 34 25 00 00 00 00 	mov    0x0,%esi
+  800030:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800037:	00 00 00 
+  80003a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003f:	48 ba c6 01 80 00 00 	movabs $0x8001c6,%rdx
+  800046:	00 00 00 
+  800049:	ff d2                	call   *%rdx
+#endif
+}
+  80004b:	5d                   	pop    %rbp
+  80004c:	c3                   	ret
+
+000000000080004d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004d:	55                   	push   %rbp
+  80004e:	48 89 e5             	mov    %rsp,%rbp
+  800051:	41 56                	push   %r14
+  800053:	41 55                	push   %r13
+  800055:	41 54                	push   %r12
+  800057:	53                   	push   %rbx
+  800058:	41 89 fd             	mov    %edi,%r13d
+  80005b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005e:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800065:	00 00 00 
+  800068:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80006f:	00 00 00 
+  800072:	48 39 c2             	cmp    %rax,%rdx
+  800075:	73 17                	jae    80008e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800077:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007a:	49 89 c4             	mov    %rax,%r12
+  80007d:	48 83 c3 08          	add    $0x8,%rbx
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	ff 53 f8             	call   *-0x8(%rbx)
+  800089:	4c 39 e3             	cmp    %r12,%rbx
+  80008c:	72 ef                	jb     80007d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80008e:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009f:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000a6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ad:	00 00 00 
+  8000b0:	48 01 d0             	add    %rdx,%rax
+  8000b3:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000ba:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000bd:	45 85 ed             	test   %r13d,%r13d
+  8000c0:	7e 0d                	jle    8000cf <libmain+0x82>
+  8000c2:	49 8b 06             	mov    (%r14),%rax
+  8000c5:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000cc:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000cf:	4c 89 f6             	mov    %r14,%rsi
+  8000d2:	44 89 ef             	mov    %r13d,%edi
+  8000d5:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000dc:	00 00 00 
+  8000df:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e1:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8000e8:	00 00 00 
+  8000eb:	ff d0                	call   *%rax
+#endif
+}
+  8000ed:	5b                   	pop    %rbx
+  8000ee:	41 5c                	pop    %r12
+  8000f0:	41 5d                	pop    %r13
+  8000f2:	41 5e                	pop    %r14
+  8000f4:	5d                   	pop    %rbp
+  8000f5:	c3                   	ret
+
+00000000008000f6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f6:	55                   	push   %rbp
+  8000f7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fa:	48 b8 da 1e 80 00 00 	movabs $0x801eda,%rax
+  800101:	00 00 00 
+  800104:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800106:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010b:	48 b8 73 11 80 00 00 	movabs $0x801173,%rax
+  800112:	00 00 00 
+  800115:	ff d0                	call   *%rax
+}
+  800117:	5d                   	pop    %rbp
+  800118:	c3                   	ret
+
+0000000000800119 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800119:	55                   	push   %rbp
+  80011a:	48 89 e5             	mov    %rsp,%rbp
+  80011d:	53                   	push   %rbx
+  80011e:	48 83 ec 08          	sub    $0x8,%rsp
+  800122:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800125:	8b 06                	mov    (%rsi),%eax
+  800127:	8d 50 01             	lea    0x1(%rax),%edx
+  80012a:	89 16                	mov    %edx,(%rsi)
+  80012c:	48 98                	cltq
+  80012e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800133:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800139:	74 0a                	je     800145 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80013b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80013f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800143:	c9                   	leave
+  800144:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800145:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800149:	be ff 00 00 00       	mov    $0xff,%esi
+  80014e:	48 b8 15 11 80 00 00 	movabs $0x801115,%rax
+  800155:	00 00 00 
+  800158:	ff d0                	call   *%rax
+        state->offset = 0;
+  80015a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800160:	eb d9                	jmp    80013b <putch+0x22>
+
+0000000000800162 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800162:	55                   	push   %rbp
+  800163:	48 89 e5             	mov    %rsp,%rbp
+  800166:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80016d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800170:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800177:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80017c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800181:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800184:	48 89 f1             	mov    %rsi,%rcx
+  800187:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80018e:	48 bf 19 01 80 00 00 	movabs $0x800119,%rdi
+  800195:	00 00 00 
+  800198:	48 b8 16 03 80 00 00 	movabs $0x800316,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001ab:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001b2:	48 b8 15 11 80 00 00 	movabs $0x801115,%rax
+  8001b9:	00 00 00 
+  8001bc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001be:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c4:	c9                   	leave
+  8001c5:	c3                   	ret
+
+00000000008001c6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001c6:	55                   	push   %rbp
+  8001c7:	48 89 e5             	mov    %rsp,%rbp
+  8001ca:	48 83 ec 50          	sub    $0x50,%rsp
+  8001ce:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001d6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001da:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001de:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001e2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001e9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001f1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001f9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8001fd:	48 b8 62 01 80 00 00 	movabs $0x800162,%rax
+  800204:	00 00 00 
+  800207:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800209:	c9                   	leave
+  80020a:	c3                   	ret
+
+000000000080020b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80020b:	55                   	push   %rbp
+  80020c:	48 89 e5             	mov    %rsp,%rbp
+  80020f:	41 57                	push   %r15
+  800211:	41 56                	push   %r14
+  800213:	41 55                	push   %r13
+  800215:	41 54                	push   %r12
+  800217:	53                   	push   %rbx
+  800218:	48 83 ec 18          	sub    $0x18,%rsp
+  80021c:	49 89 fc             	mov    %rdi,%r12
+  80021f:	49 89 f5             	mov    %rsi,%r13
+  800222:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800226:	8b 45 10             	mov    0x10(%rbp),%eax
+  800229:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80022c:	41 89 cf             	mov    %ecx,%r15d
+  80022f:	4c 39 fa             	cmp    %r15,%rdx
+  800232:	73 5b                	jae    80028f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800234:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800238:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80023c:	85 db                	test   %ebx,%ebx
+  80023e:	7e 0e                	jle    80024e <print_num+0x43>
+            putch(padc, put_arg);
+  800240:	4c 89 ee             	mov    %r13,%rsi
+  800243:	44 89 f7             	mov    %r14d,%edi
+  800246:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800249:	83 eb 01             	sub    $0x1,%ebx
+  80024c:	75 f2                	jne    800240 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80024e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800252:	48 b9 39 50 80 00 00 	movabs $0x805039,%rcx
+  800259:	00 00 00 
+  80025c:	48 b8 28 50 80 00 00 	movabs $0x805028,%rax
+  800263:	00 00 00 
+  800266:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80026a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80026e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800273:	49 f7 f7             	div    %r15
+  800276:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80027a:	4c 89 ee             	mov    %r13,%rsi
+  80027d:	41 ff d4             	call   *%r12
+}
+  800280:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800284:	5b                   	pop    %rbx
+  800285:	41 5c                	pop    %r12
+  800287:	41 5d                	pop    %r13
+  800289:	41 5e                	pop    %r14
+  80028b:	41 5f                	pop    %r15
+  80028d:	5d                   	pop    %rbp
+  80028e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80028f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800293:	ba 00 00 00 00       	mov    $0x0,%edx
+  800298:	49 f7 f7             	div    %r15
+  80029b:	48 83 ec 08          	sub    $0x8,%rsp
+  80029f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002a3:	52                   	push   %rdx
+  8002a4:	45 0f be c9          	movsbl %r9b,%r9d
+  8002a8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002ac:	48 89 c2             	mov    %rax,%rdx
+  8002af:	48 b8 0b 02 80 00 00 	movabs $0x80020b,%rax
+  8002b6:	00 00 00 
+  8002b9:	ff d0                	call   *%rax
+  8002bb:	48 83 c4 10          	add    $0x10,%rsp
+  8002bf:	eb 8d                	jmp    80024e <print_num+0x43>
+
+00000000008002c1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002c1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002c5:	48 8b 06             	mov    (%rsi),%rax
+  8002c8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002cc:	73 0a                	jae    8002d8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002ce:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002d2:	48 89 16             	mov    %rdx,(%rsi)
+  8002d5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002d8:	c3                   	ret
+
+00000000008002d9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002d9:	55                   	push   %rbp
+  8002da:	48 89 e5             	mov    %rsp,%rbp
+  8002dd:	48 83 ec 50          	sub    $0x50,%rsp
+  8002e1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002e5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002e9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002ed:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002fc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800300:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800304:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800308:	48 b8 16 03 80 00 00 	movabs $0x800316,%rax
+  80030f:	00 00 00 
+  800312:	ff d0                	call   *%rax
+}
+  800314:	c9                   	leave
+  800315:	c3                   	ret
+
+0000000000800316 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800316:	55                   	push   %rbp
+  800317:	48 89 e5             	mov    %rsp,%rbp
+  80031a:	41 57                	push   %r15
+  80031c:	41 56                	push   %r14
+  80031e:	41 55                	push   %r13
+  800320:	41 54                	push   %r12
+  800322:	53                   	push   %rbx
+  800323:	48 83 ec 38          	sub    $0x38,%rsp
+  800327:	49 89 fe             	mov    %rdi,%r14
+  80032a:	49 89 f5             	mov    %rsi,%r13
+  80032d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800330:	48 8b 01             	mov    (%rcx),%rax
+  800333:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800337:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80033b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80033f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800343:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800347:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80034b:	0f b6 3b             	movzbl (%rbx),%edi
+  80034e:	40 80 ff 25          	cmp    $0x25,%dil
+  800352:	74 18                	je     80036c <vprintfmt+0x56>
+            if (!ch) return;
+  800354:	40 84 ff             	test   %dil,%dil
+  800357:	0f 84 04 07 00 00    	je     800a61 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80035d:	40 0f b6 ff          	movzbl %dil,%edi
+  800361:	4c 89 ee             	mov    %r13,%rsi
+  800364:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800367:	4c 89 e3             	mov    %r12,%rbx
+  80036a:	eb db                	jmp    800347 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80036c:	be 00 00 00 00       	mov    $0x0,%esi
+  800371:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800375:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80037a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800380:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800387:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80038b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800390:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800395:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800398:	83 e8 23             	sub    $0x23,%eax
+  80039b:	3c 57                	cmp    $0x57,%al
+  80039d:	0f 87 a4 06 00 00    	ja     800a47 <vprintfmt+0x731>
+  8003a3:	0f b6 c0             	movzbl %al,%eax
+  8003a6:	48 b9 c0 51 80 00 00 	movabs $0x8051c0,%rcx
+  8003ad:	00 00 00 
+  8003b0:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003b3:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003b6:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003ba:	eb cf                	jmp    80038b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003bc:	49 89 dc             	mov    %rbx,%r12
+  8003bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c4:	eb c5                	jmp    80038b <vprintfmt+0x75>
+            padc = ch;
+  8003c6:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003ca:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003cd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003d0:	eb b9                	jmp    80038b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8003d8:	77 24                	ja     8003fe <vprintfmt+0xe8>
+  8003da:	89 c1                	mov    %eax,%ecx
+  8003dc:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003e0:	83 c0 08             	add    $0x8,%eax
+  8003e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003e6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003e9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003ec:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003f0:	79 99                	jns    80038b <vprintfmt+0x75>
+                width = precision;
+  8003f2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003f6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003fc:	eb 8d                	jmp    80038b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003fe:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800402:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800406:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80040a:	eb da                	jmp    8003e6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80040c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800411:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800415:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80041b:	3c 39                	cmp    $0x39,%al
+  80041d:	77 1c                	ja     80043b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80041f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800423:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800427:	0f b6 c0             	movzbl %al,%eax
+  80042a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80042f:	0f b6 03             	movzbl (%rbx),%eax
+  800432:	3c 39                	cmp    $0x39,%al
+  800434:	76 e9                	jbe    80041f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800436:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800439:	eb b1                	jmp    8003ec <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80043b:	49 89 dc             	mov    %rbx,%r12
+  80043e:	eb ac                	jmp    8003ec <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800440:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800443:	85 c9                	test   %ecx,%ecx
+  800445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044a:	0f 49 c1             	cmovns %ecx,%eax
+  80044d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800450:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800453:	e9 33 ff ff ff       	jmp    80038b <vprintfmt+0x75>
+            lflag++;
+  800458:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80045b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80045e:	e9 28 ff ff ff       	jmp    80038b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800463:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800466:	83 f8 2f             	cmp    $0x2f,%eax
+  800469:	77 19                	ja     800484 <vprintfmt+0x16e>
+  80046b:	89 c2                	mov    %eax,%edx
+  80046d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800471:	83 c0 08             	add    $0x8,%eax
+  800474:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800477:	8b 3a                	mov    (%rdx),%edi
+  800479:	4c 89 ee             	mov    %r13,%rsi
+  80047c:	41 ff d6             	call   *%r14
+            break;
+  80047f:	e9 c3 fe ff ff       	jmp    800347 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800484:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800488:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80048c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800490:	eb e5                	jmp    800477 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800492:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800495:	83 f8 2f             	cmp    $0x2f,%eax
+  800498:	77 5a                	ja     8004f4 <vprintfmt+0x1de>
+  80049a:	89 c2                	mov    %eax,%edx
+  80049c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004a0:	83 c0 08             	add    $0x8,%eax
+  8004a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004a6:	8b 02                	mov    (%rdx),%eax
+  8004a8:	89 c1                	mov    %eax,%ecx
+  8004aa:	f7 d9                	neg    %ecx
+  8004ac:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004af:	83 f9 13             	cmp    $0x13,%ecx
+  8004b2:	7f 4e                	jg     800502 <vprintfmt+0x1ec>
+  8004b4:	48 63 c1             	movslq %ecx,%rax
+  8004b7:	48 ba 80 54 80 00 00 	movabs $0x805480,%rdx
+  8004be:	00 00 00 
+  8004c1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004c5:	48 85 c0             	test   %rax,%rax
+  8004c8:	74 38                	je     800502 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004ca:	48 89 c1             	mov    %rax,%rcx
+  8004cd:	48 ba b9 56 80 00 00 	movabs $0x8056b9,%rdx
+  8004d4:	00 00 00 
+  8004d7:	4c 89 ee             	mov    %r13,%rsi
+  8004da:	4c 89 f7             	mov    %r14,%rdi
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	49 b8 d9 02 80 00 00 	movabs $0x8002d9,%r8
+  8004e9:	00 00 00 
+  8004ec:	41 ff d0             	call   *%r8
+  8004ef:	e9 53 fe ff ff       	jmp    800347 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800500:	eb a4                	jmp    8004a6 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800502:	48 ba 51 50 80 00 00 	movabs $0x805051,%rdx
+  800509:	00 00 00 
+  80050c:	4c 89 ee             	mov    %r13,%rsi
+  80050f:	4c 89 f7             	mov    %r14,%rdi
+  800512:	b8 00 00 00 00       	mov    $0x0,%eax
+  800517:	49 b8 d9 02 80 00 00 	movabs $0x8002d9,%r8
+  80051e:	00 00 00 
+  800521:	41 ff d0             	call   *%r8
+  800524:	e9 1e fe ff ff       	jmp    800347 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800529:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052c:	83 f8 2f             	cmp    $0x2f,%eax
+  80052f:	77 36                	ja     800567 <vprintfmt+0x251>
+  800531:	89 c2                	mov    %eax,%edx
+  800533:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800537:	83 c0 08             	add    $0x8,%eax
+  80053a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80053d:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800540:	48 85 f6             	test   %rsi,%rsi
+  800543:	48 b8 4a 50 80 00 00 	movabs $0x80504a,%rax
+  80054a:	00 00 00 
+  80054d:	48 0f 45 c6          	cmovne %rsi,%rax
+  800551:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800555:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800559:	7e 06                	jle    800561 <vprintfmt+0x24b>
+  80055b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80055f:	75 14                	jne    800575 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800561:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800565:	eb 5b                	jmp    8005c2 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800567:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80056b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80056f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800573:	eb c8                	jmp    80053d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800575:	49 63 f7             	movslq %r15d,%rsi
+  800578:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80057c:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  800583:	00 00 00 
+  800586:	ff d0                	call   *%rax
+  800588:	48 89 c2             	mov    %rax,%rdx
+  80058b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80058e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800590:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800593:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800596:	85 c0                	test   %eax,%eax
+  800598:	7e c7                	jle    800561 <vprintfmt+0x24b>
+  80059a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80059f:	4c 89 ee             	mov    %r13,%rsi
+  8005a2:	44 89 e7             	mov    %r12d,%edi
+  8005a5:	41 ff d6             	call   *%r14
+  8005a8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005ac:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005af:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005b2:	75 eb                	jne    80059f <vprintfmt+0x289>
+  8005b4:	eb ab                	jmp    800561 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005b6:	0f b6 f8             	movzbl %al,%edi
+  8005b9:	4c 89 ee             	mov    %r13,%rsi
+  8005bc:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8005bf:	4c 89 e2             	mov    %r12,%rdx
+  8005c2:	45 85 ff             	test   %r15d,%r15d
+  8005c5:	78 06                	js     8005cd <vprintfmt+0x2b7>
+  8005c7:	41 83 ef 01          	sub    $0x1,%r15d
+  8005cb:	78 23                	js     8005f0 <vprintfmt+0x2da>
+  8005cd:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8005d1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8005d7:	84 c0                	test   %al,%al
+  8005d9:	74 15                	je     8005f0 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005db:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8005df:	74 d5                	je     8005b6 <vprintfmt+0x2a0>
+  8005e1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8005e4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8005e9:	80 fa 5e             	cmp    $0x5e,%dl
+  8005ec:	77 cb                	ja     8005b9 <vprintfmt+0x2a3>
+  8005ee:	eb c6                	jmp    8005b6 <vprintfmt+0x2a0>
+  8005f0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005f3:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8005f6:	01 f0                	add    %esi,%eax
+  8005f8:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8005fa:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005fe:	85 c0                	test   %eax,%eax
+  800600:	0f 8e 41 fd ff ff    	jle    800347 <vprintfmt+0x31>
+  800606:	4c 89 ee             	mov    %r13,%rsi
+  800609:	bf 20 00 00 00       	mov    $0x20,%edi
+  80060e:	41 ff d6             	call   *%r14
+  800611:	41 83 ec 01          	sub    $0x1,%r12d
+  800615:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800619:	75 eb                	jne    800606 <vprintfmt+0x2f0>
+  80061b:	e9 27 fd ff ff       	jmp    800347 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800620:	40 84 f6             	test   %sil,%sil
+  800623:	75 26                	jne    80064b <vprintfmt+0x335>
+    switch (lflag) {
+  800625:	85 d2                	test   %edx,%edx
+  800627:	74 59                	je     800682 <vprintfmt+0x36c>
+  800629:	83 fa 01             	cmp    $0x1,%edx
+  80062c:	74 7b                	je     8006a9 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80062e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800631:	83 f8 2f             	cmp    $0x2f,%eax
+  800634:	0f 87 96 00 00 00    	ja     8006d0 <vprintfmt+0x3ba>
+  80063a:	89 c2                	mov    %eax,%edx
+  80063c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800640:	83 c0 08             	add    $0x8,%eax
+  800643:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800646:	4c 8b 22             	mov    (%rdx),%r12
+  800649:	eb 17                	jmp    800662 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80064b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80064e:	83 f8 2f             	cmp    $0x2f,%eax
+  800651:	77 21                	ja     800674 <vprintfmt+0x35e>
+  800653:	89 c2                	mov    %eax,%edx
+  800655:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800659:	83 c0 08             	add    $0x8,%eax
+  80065c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80065f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800662:	4d 85 e4             	test   %r12,%r12
+  800665:	78 7a                	js     8006e1 <vprintfmt+0x3cb>
+            num = i;
+  800667:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80066a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80066f:	e9 b5 02 00 00       	jmp    800929 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800674:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800678:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80067c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800680:	eb dd                	jmp    80065f <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800682:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800685:	83 f8 2f             	cmp    $0x2f,%eax
+  800688:	77 11                	ja     80069b <vprintfmt+0x385>
+  80068a:	89 c2                	mov    %eax,%edx
+  80068c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800690:	83 c0 08             	add    $0x8,%eax
+  800693:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800696:	4c 63 22             	movslq (%rdx),%r12
+  800699:	eb c7                	jmp    800662 <vprintfmt+0x34c>
+  80069b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80069f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a7:	eb ed                	jmp    800696 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8006a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8006af:	77 11                	ja     8006c2 <vprintfmt+0x3ac>
+  8006b1:	89 c2                	mov    %eax,%edx
+  8006b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b7:	83 c0 08             	add    $0x8,%eax
+  8006ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006bd:	4c 8b 22             	mov    (%rdx),%r12
+  8006c0:	eb a0                	jmp    800662 <vprintfmt+0x34c>
+  8006c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ce:	eb ed                	jmp    8006bd <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8006d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006dc:	e9 65 ff ff ff       	jmp    800646 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8006e1:	4c 89 ee             	mov    %r13,%rsi
+  8006e4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006e9:	41 ff d6             	call   *%r14
+                i = -i;
+  8006ec:	49 f7 dc             	neg    %r12
+  8006ef:	e9 73 ff ff ff       	jmp    800667 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8006f4:	40 84 f6             	test   %sil,%sil
+  8006f7:	75 32                	jne    80072b <vprintfmt+0x415>
+    switch (lflag) {
+  8006f9:	85 d2                	test   %edx,%edx
+  8006fb:	74 5d                	je     80075a <vprintfmt+0x444>
+  8006fd:	83 fa 01             	cmp    $0x1,%edx
+  800700:	0f 84 82 00 00 00    	je     800788 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800706:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800709:	83 f8 2f             	cmp    $0x2f,%eax
+  80070c:	0f 87 a5 00 00 00    	ja     8007b7 <vprintfmt+0x4a1>
+  800712:	89 c2                	mov    %eax,%edx
+  800714:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800718:	83 c0 08             	add    $0x8,%eax
+  80071b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800721:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800726:	e9 fe 01 00 00       	jmp    800929 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80072b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072e:	83 f8 2f             	cmp    $0x2f,%eax
+  800731:	77 19                	ja     80074c <vprintfmt+0x436>
+  800733:	89 c2                	mov    %eax,%edx
+  800735:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800739:	83 c0 08             	add    $0x8,%eax
+  80073c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800742:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800747:	e9 dd 01 00 00       	jmp    800929 <vprintfmt+0x613>
+  80074c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800750:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800754:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800758:	eb e5                	jmp    80073f <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80075a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075d:	83 f8 2f             	cmp    $0x2f,%eax
+  800760:	77 18                	ja     80077a <vprintfmt+0x464>
+  800762:	89 c2                	mov    %eax,%edx
+  800764:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800768:	83 c0 08             	add    $0x8,%eax
+  80076b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800770:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800775:	e9 af 01 00 00       	jmp    800929 <vprintfmt+0x613>
+  80077a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800782:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800786:	eb e6                	jmp    80076e <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800788:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078b:	83 f8 2f             	cmp    $0x2f,%eax
+  80078e:	77 19                	ja     8007a9 <vprintfmt+0x493>
+  800790:	89 c2                	mov    %eax,%edx
+  800792:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800796:	83 c0 08             	add    $0x8,%eax
+  800799:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80079f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007a4:	e9 80 01 00 00       	jmp    800929 <vprintfmt+0x613>
+  8007a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b5:	eb e5                	jmp    80079c <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8007b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c3:	e9 56 ff ff ff       	jmp    80071e <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c8:	40 84 f6             	test   %sil,%sil
+  8007cb:	75 2e                	jne    8007fb <vprintfmt+0x4e5>
+    switch (lflag) {
+  8007cd:	85 d2                	test   %edx,%edx
+  8007cf:	0f 84 b3 00 00 00    	je     800888 <vprintfmt+0x572>
+  8007d5:	83 fa 01             	cmp    $0x1,%edx
+  8007d8:	0f 84 d3 00 00 00    	je     8008b1 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8007de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e4:	0f 87 f1 00 00 00    	ja     8008db <vprintfmt+0x5c5>
+  8007ea:	89 c2                	mov    %eax,%edx
+  8007ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f0:	83 c0 08             	add    $0x8,%eax
+  8007f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f6:	48 8b 02             	mov    (%rdx),%rax
+  8007f9:	eb 17                	jmp    800812 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8007fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800801:	77 77                	ja     80087a <vprintfmt+0x564>
+  800803:	89 c2                	mov    %eax,%edx
+  800805:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800809:	83 c0 08             	add    $0x8,%eax
+  80080c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080f:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800812:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800814:	83 f8 07             	cmp    $0x7,%eax
+  800817:	0f 8e cf 00 00 00    	jle    8008ec <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  80081d:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800823:	44 89 e7             	mov    %r12d,%edi
+  800826:	41 c1 e4 03          	shl    $0x3,%r12d
+  80082a:	89 d1                	mov    %edx,%ecx
+  80082c:	8d 72 07             	lea    0x7(%rdx),%esi
+  80082f:	85 d2                	test   %edx,%edx
+  800831:	0f 48 d6             	cmovs  %esi,%edx
+  800834:	c1 fa 03             	sar    $0x3,%edx
+  800837:	83 f9 3f             	cmp    $0x3f,%ecx
+  80083a:	7f e7                	jg     800823 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80083c:	85 ff                	test   %edi,%edi
+  80083e:	0f 84 03 fb ff ff    	je     800347 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800844:	49 63 f4             	movslq %r12d,%rsi
+  800847:	ba 00 00 00 00       	mov    $0x0,%edx
+  80084c:	48 f7 f6             	div    %rsi
+  80084f:	49 89 d7             	mov    %rdx,%r15
+  800852:	83 c0 30             	add    $0x30,%eax
+  800855:	0f be f8             	movsbl %al,%edi
+  800858:	4c 89 ee             	mov    %r13,%rsi
+  80085b:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80085e:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800861:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800866:	45 85 e4             	test   %r12d,%r12d
+  800869:	41 0f 49 d4          	cmovns %r12d,%edx
+  80086d:	c1 fa 03             	sar    $0x3,%edx
+  800870:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800873:	75 cf                	jne    800844 <vprintfmt+0x52e>
+  800875:	e9 cd fa ff ff       	jmp    800347 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80087a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800882:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800886:	eb 87                	jmp    80080f <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800888:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088b:	83 f8 2f             	cmp    $0x2f,%eax
+  80088e:	77 13                	ja     8008a3 <vprintfmt+0x58d>
+  800890:	89 c2                	mov    %eax,%edx
+  800892:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800896:	83 c0 08             	add    $0x8,%eax
+  800899:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089c:	8b 02                	mov    (%rdx),%eax
+  80089e:	e9 6f ff ff ff       	jmp    800812 <vprintfmt+0x4fc>
+  8008a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008af:	eb eb                	jmp    80089c <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8008b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b7:	77 14                	ja     8008cd <vprintfmt+0x5b7>
+  8008b9:	89 c2                	mov    %eax,%edx
+  8008bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bf:	83 c0 08             	add    $0x8,%eax
+  8008c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c5:	48 8b 02             	mov    (%rdx),%rax
+  8008c8:	e9 45 ff ff ff       	jmp    800812 <vprintfmt+0x4fc>
+  8008cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d9:	eb ea                	jmp    8008c5 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8008db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e7:	e9 0a ff ff ff       	jmp    8007f6 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8008ec:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8008f2:	e9 4d ff ff ff       	jmp    800844 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8008f7:	4c 89 ee             	mov    %r13,%rsi
+  8008fa:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008ff:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800902:	4c 89 ee             	mov    %r13,%rsi
+  800905:	bf 78 00 00 00       	mov    $0x78,%edi
+  80090a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80090d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800910:	83 f8 2f             	cmp    $0x2f,%eax
+  800913:	77 47                	ja     80095c <vprintfmt+0x646>
+  800915:	89 c2                	mov    %eax,%edx
+  800917:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091b:	83 c0 08             	add    $0x8,%eax
+  80091e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800921:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800924:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800929:	48 83 ec 08          	sub    $0x8,%rsp
+  80092d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800931:	0f 94 c0             	sete   %al
+  800934:	0f b6 c0             	movzbl %al,%eax
+  800937:	50                   	push   %rax
+  800938:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80093d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800941:	4c 89 ee             	mov    %r13,%rsi
+  800944:	4c 89 f7             	mov    %r14,%rdi
+  800947:	48 b8 0b 02 80 00 00 	movabs $0x80020b,%rax
+  80094e:	00 00 00 
+  800951:	ff d0                	call   *%rax
+            break;
+  800953:	48 83 c4 10          	add    $0x10,%rsp
+  800957:	e9 eb f9 ff ff       	jmp    800347 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80095c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800960:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800964:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800968:	eb b7                	jmp    800921 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  80096a:	40 84 f6             	test   %sil,%sil
+  80096d:	75 2b                	jne    80099a <vprintfmt+0x684>
+    switch (lflag) {
+  80096f:	85 d2                	test   %edx,%edx
+  800971:	74 56                	je     8009c9 <vprintfmt+0x6b3>
+  800973:	83 fa 01             	cmp    $0x1,%edx
+  800976:	74 7f                	je     8009f7 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800978:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097b:	83 f8 2f             	cmp    $0x2f,%eax
+  80097e:	0f 87 a2 00 00 00    	ja     800a26 <vprintfmt+0x710>
+  800984:	89 c2                	mov    %eax,%edx
+  800986:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098a:	83 c0 08             	add    $0x8,%eax
+  80098d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800990:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800993:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800998:	eb 8f                	jmp    800929 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80099a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099d:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a0:	77 19                	ja     8009bb <vprintfmt+0x6a5>
+  8009a2:	89 c2                	mov    %eax,%edx
+  8009a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a8:	83 c0 08             	add    $0x8,%eax
+  8009ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009b6:	e9 6e ff ff ff       	jmp    800929 <vprintfmt+0x613>
+  8009bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c7:	eb e5                	jmp    8009ae <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8009c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cf:	77 18                	ja     8009e9 <vprintfmt+0x6d3>
+  8009d1:	89 c2                	mov    %eax,%edx
+  8009d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d7:	83 c0 08             	add    $0x8,%eax
+  8009da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009dd:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009df:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009e4:	e9 40 ff ff ff       	jmp    800929 <vprintfmt+0x613>
+  8009e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f5:	eb e6                	jmp    8009dd <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8009f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fd:	77 19                	ja     800a18 <vprintfmt+0x702>
+  8009ff:	89 c2                	mov    %eax,%edx
+  800a01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a05:	83 c0 08             	add    $0x8,%eax
+  800a08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a0e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a13:	e9 11 ff ff ff       	jmp    800929 <vprintfmt+0x613>
+  800a18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a24:	eb e5                	jmp    800a0b <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800a26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a32:	e9 59 ff ff ff       	jmp    800990 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800a37:	4c 89 ee             	mov    %r13,%rsi
+  800a3a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a3f:	41 ff d6             	call   *%r14
+            break;
+  800a42:	e9 00 f9 ff ff       	jmp    800347 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a47:	4c 89 ee             	mov    %r13,%rsi
+  800a4a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a4f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a52:	48 83 eb 01          	sub    $0x1,%rbx
+  800a56:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a5a:	75 f6                	jne    800a52 <vprintfmt+0x73c>
+  800a5c:	e9 e6 f8 ff ff       	jmp    800347 <vprintfmt+0x31>
+}
+  800a61:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a65:	5b                   	pop    %rbx
+  800a66:	41 5c                	pop    %r12
+  800a68:	41 5d                	pop    %r13
+  800a6a:	41 5e                	pop    %r14
+  800a6c:	41 5f                	pop    %r15
+  800a6e:	5d                   	pop    %rbp
+  800a6f:	c3                   	ret
+
+0000000000800a70 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a70:	55                   	push   %rbp
+  800a71:	48 89 e5             	mov    %rsp,%rbp
+  800a74:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a78:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a7c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a81:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a85:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a8c:	48 85 ff             	test   %rdi,%rdi
+  800a8f:	74 2b                	je     800abc <vsnprintf+0x4c>
+  800a91:	48 85 f6             	test   %rsi,%rsi
+  800a94:	74 26                	je     800abc <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a96:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a9a:	48 bf c1 02 80 00 00 	movabs $0x8002c1,%rdi
+  800aa1:	00 00 00 
+  800aa4:	48 b8 16 03 80 00 00 	movabs $0x800316,%rax
+  800aab:	00 00 00 
+  800aae:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ab0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ab7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800aba:	c9                   	leave
+  800abb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800abc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac1:	eb f7                	jmp    800aba <vsnprintf+0x4a>
+
+0000000000800ac3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ac3:	55                   	push   %rbp
+  800ac4:	48 89 e5             	mov    %rsp,%rbp
+  800ac7:	48 83 ec 50          	sub    $0x50,%rsp
+  800acb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800acf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ad3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ad7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ade:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ae2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aee:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800af2:	48 b8 70 0a 80 00 00 	movabs $0x800a70,%rax
+  800af9:	00 00 00 
+  800afc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800afe:	c9                   	leave
+  800aff:	c3                   	ret
+
+0000000000800b00 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b00:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b03:	74 10                	je     800b15 <strlen+0x15>
+    size_t n = 0;
+  800b05:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b0a:	48 83 c0 01          	add    $0x1,%rax
+  800b0e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b12:	75 f6                	jne    800b0a <strlen+0xa>
+  800b14:	c3                   	ret
+    size_t n = 0;
+  800b15:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b1a:	c3                   	ret
+
+0000000000800b1b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b1b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b1e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b23:	48 85 f6             	test   %rsi,%rsi
+  800b26:	74 11                	je     800b39 <strnlen+0x1e>
+  800b28:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b2c:	74 0c                	je     800b3a <strnlen+0x1f>
+  800b2e:	48 83 c2 01          	add    $0x1,%rdx
+  800b32:	48 39 d0             	cmp    %rdx,%rax
+  800b35:	75 f1                	jne    800b28 <strnlen+0xd>
+  800b37:	eb 04                	jmp    800b3d <strnlen+0x22>
+  800b39:	c3                   	ret
+  800b3a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b3d:	c3                   	ret
+
+0000000000800b3e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b3e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b46:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b4a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b4d:	48 83 c2 01          	add    $0x1,%rdx
+  800b51:	84 c9                	test   %cl,%cl
+  800b53:	75 f1                	jne    800b46 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b55:	c3                   	ret
+
+0000000000800b56 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b56:	55                   	push   %rbp
+  800b57:	48 89 e5             	mov    %rsp,%rbp
+  800b5a:	41 54                	push   %r12
+  800b5c:	53                   	push   %rbx
+  800b5d:	48 89 fb             	mov    %rdi,%rbx
+  800b60:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b63:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  800b6a:	00 00 00 
+  800b6d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b6f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b73:	4c 89 e6             	mov    %r12,%rsi
+  800b76:	48 b8 3e 0b 80 00 00 	movabs $0x800b3e,%rax
+  800b7d:	00 00 00 
+  800b80:	ff d0                	call   *%rax
+    return dst;
+}
+  800b82:	48 89 d8             	mov    %rbx,%rax
+  800b85:	5b                   	pop    %rbx
+  800b86:	41 5c                	pop    %r12
+  800b88:	5d                   	pop    %rbp
+  800b89:	c3                   	ret
+
+0000000000800b8a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b8a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b8d:	48 85 d2             	test   %rdx,%rdx
+  800b90:	74 1f                	je     800bb1 <strncpy+0x27>
+  800b92:	48 01 fa             	add    %rdi,%rdx
+  800b95:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b98:	48 83 c1 01          	add    $0x1,%rcx
+  800b9c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ba0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ba4:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ba8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bac:	48 39 ca             	cmp    %rcx,%rdx
+  800baf:	75 e7                	jne    800b98 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bb1:	c3                   	ret
+
+0000000000800bb2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bb2:	48 89 f8             	mov    %rdi,%rax
+  800bb5:	48 85 d2             	test   %rdx,%rdx
+  800bb8:	74 24                	je     800bde <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bba:	48 83 ea 01          	sub    $0x1,%rdx
+  800bbe:	74 1b                	je     800bdb <strlcpy+0x29>
+  800bc0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bc4:	0f b6 16             	movzbl (%rsi),%edx
+  800bc7:	84 d2                	test   %dl,%dl
+  800bc9:	74 10                	je     800bdb <strlcpy+0x29>
+            *dst++ = *src++;
+  800bcb:	48 83 c6 01          	add    $0x1,%rsi
+  800bcf:	48 83 c0 01          	add    $0x1,%rax
+  800bd3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bd6:	48 39 c8             	cmp    %rcx,%rax
+  800bd9:	75 e9                	jne    800bc4 <strlcpy+0x12>
+        *dst = '\0';
+  800bdb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bde:	48 29 f8             	sub    %rdi,%rax
+}
+  800be1:	c3                   	ret
+
+0000000000800be2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800be2:	0f b6 07             	movzbl (%rdi),%eax
+  800be5:	84 c0                	test   %al,%al
+  800be7:	74 13                	je     800bfc <strcmp+0x1a>
+  800be9:	38 06                	cmp    %al,(%rsi)
+  800beb:	75 0f                	jne    800bfc <strcmp+0x1a>
+  800bed:	48 83 c7 01          	add    $0x1,%rdi
+  800bf1:	48 83 c6 01          	add    $0x1,%rsi
+  800bf5:	0f b6 07             	movzbl (%rdi),%eax
+  800bf8:	84 c0                	test   %al,%al
+  800bfa:	75 ed                	jne    800be9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bfc:	0f b6 c0             	movzbl %al,%eax
+  800bff:	0f b6 16             	movzbl (%rsi),%edx
+  800c02:	29 d0                	sub    %edx,%eax
+}
+  800c04:	c3                   	ret
+
+0000000000800c05 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c05:	48 85 d2             	test   %rdx,%rdx
+  800c08:	74 1f                	je     800c29 <strncmp+0x24>
+  800c0a:	0f b6 07             	movzbl (%rdi),%eax
+  800c0d:	84 c0                	test   %al,%al
+  800c0f:	74 1e                	je     800c2f <strncmp+0x2a>
+  800c11:	3a 06                	cmp    (%rsi),%al
+  800c13:	75 1a                	jne    800c2f <strncmp+0x2a>
+  800c15:	48 83 c7 01          	add    $0x1,%rdi
+  800c19:	48 83 c6 01          	add    $0x1,%rsi
+  800c1d:	48 83 ea 01          	sub    $0x1,%rdx
+  800c21:	75 e7                	jne    800c0a <strncmp+0x5>
+
+    if (!n) return 0;
+  800c23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c28:	c3                   	ret
+  800c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2e:	c3                   	ret
+  800c2f:	48 85 d2             	test   %rdx,%rdx
+  800c32:	74 09                	je     800c3d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c34:	0f b6 07             	movzbl (%rdi),%eax
+  800c37:	0f b6 16             	movzbl (%rsi),%edx
+  800c3a:	29 d0                	sub    %edx,%eax
+  800c3c:	c3                   	ret
+    if (!n) return 0;
+  800c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c42:	c3                   	ret
+
+0000000000800c43 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c43:	0f b6 17             	movzbl (%rdi),%edx
+  800c46:	84 d2                	test   %dl,%dl
+  800c48:	74 18                	je     800c62 <strchr+0x1f>
+        if (*str == c) {
+  800c4a:	0f be d2             	movsbl %dl,%edx
+  800c4d:	39 f2                	cmp    %esi,%edx
+  800c4f:	74 17                	je     800c68 <strchr+0x25>
+    for (; *str; str++) {
+  800c51:	48 83 c7 01          	add    $0x1,%rdi
+  800c55:	0f b6 17             	movzbl (%rdi),%edx
+  800c58:	84 d2                	test   %dl,%dl
+  800c5a:	75 ee                	jne    800c4a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c61:	c3                   	ret
+  800c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c67:	c3                   	ret
+  800c68:	48 89 f8             	mov    %rdi,%rax
+}
+  800c6b:	c3                   	ret
+
+0000000000800c6c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c6c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c6f:	0f b6 17             	movzbl (%rdi),%edx
+  800c72:	84 d2                	test   %dl,%dl
+  800c74:	74 13                	je     800c89 <strfind+0x1d>
+  800c76:	0f be d2             	movsbl %dl,%edx
+  800c79:	39 f2                	cmp    %esi,%edx
+  800c7b:	74 0b                	je     800c88 <strfind+0x1c>
+  800c7d:	48 83 c0 01          	add    $0x1,%rax
+  800c81:	0f b6 10             	movzbl (%rax),%edx
+  800c84:	84 d2                	test   %dl,%dl
+  800c86:	75 ee                	jne    800c76 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c88:	c3                   	ret
+  800c89:	c3                   	ret
+
+0000000000800c8a <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800c8a:	55                   	push   %rbp
+  800c8b:	48 89 e5             	mov    %rsp,%rbp
+  800c8e:	41 57                	push   %r15
+  800c90:	41 56                	push   %r14
+  800c92:	41 55                	push   %r13
+  800c94:	41 54                	push   %r12
+  800c96:	53                   	push   %rbx
+  800c97:	48 83 ec 08          	sub    $0x8,%rsp
+  800c9b:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800c9e:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800ca2:	45 84 ed             	test   %r13b,%r13b
+  800ca5:	75 12                	jne    800cb9 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800ca7:	4c 89 f8             	mov    %r15,%rax
+  800caa:	48 83 c4 08          	add    $0x8,%rsp
+  800cae:	5b                   	pop    %rbx
+  800caf:	41 5c                	pop    %r12
+  800cb1:	41 5d                	pop    %r13
+  800cb3:	41 5e                	pop    %r14
+  800cb5:	41 5f                	pop    %r15
+  800cb7:	5d                   	pop    %rbp
+  800cb8:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800cb9:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800cbd:	4c 89 e7             	mov    %r12,%rdi
+  800cc0:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  800cc7:	00 00 00 
+  800cca:	ff d0                	call   *%rax
+  800ccc:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800ccf:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800cd3:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800cd7:	49 bf 05 0c 80 00 00 	movabs $0x800c05,%r15
+  800cde:	00 00 00 
+				if ((sc = *s++) == 0)
+  800ce1:	84 c0                	test   %al,%al
+  800ce3:	75 14                	jne    800cf9 <strstr+0x6f>
+					return NULL;
+  800ce5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800ceb:	eb ba                	jmp    800ca7 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800ced:	48 83 c3 01          	add    $0x1,%rbx
+  800cf1:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800cf5:	84 c0                	test   %al,%al
+  800cf7:	74 1b                	je     800d14 <strstr+0x8a>
+			} while (sc != c);
+  800cf9:	41 38 c5             	cmp    %al,%r13b
+  800cfc:	75 ef                	jne    800ced <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800cfe:	4c 89 f2             	mov    %r14,%rdx
+  800d01:	4c 89 e6             	mov    %r12,%rsi
+  800d04:	48 89 df             	mov    %rbx,%rdi
+  800d07:	41 ff d7             	call   *%r15
+  800d0a:	85 c0                	test   %eax,%eax
+  800d0c:	75 df                	jne    800ced <strstr+0x63>
+  800d0e:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800d12:	eb 93                	jmp    800ca7 <strstr+0x1d>
+					return NULL;
+  800d14:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d1a:	eb 8b                	jmp    800ca7 <strstr+0x1d>
+
+0000000000800d1c <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800d1c:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800d1e:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800d21:	8d 57 20             	lea    0x20(%rdi),%edx
+  800d24:	83 f9 1a             	cmp    $0x1a,%ecx
+  800d27:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800d2a:	c3                   	ret
+
+0000000000800d2b <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800d2b:	55                   	push   %rbp
+  800d2c:	48 89 e5             	mov    %rsp,%rbp
+  800d2f:	41 57                	push   %r15
+  800d31:	41 56                	push   %r14
+  800d33:	41 55                	push   %r13
+  800d35:	41 54                	push   %r12
+  800d37:	53                   	push   %rbx
+  800d38:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800d3c:	48 39 f7             	cmp    %rsi,%rdi
+  800d3f:	74 49                	je     800d8a <strcasecmp+0x5f>
+  800d41:	49 89 fd             	mov    %rdi,%r13
+  800d44:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800d47:	49 bf 1c 0d 80 00 00 	movabs $0x800d1c,%r15
+  800d4e:	00 00 00 
+  800d51:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800d56:	41 0f b6 fe          	movzbl %r14b,%edi
+  800d5a:	41 ff d7             	call   *%r15
+  800d5d:	89 c3                	mov    %eax,%ebx
+  800d5f:	49 83 c4 01          	add    $0x1,%r12
+  800d63:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800d69:	41 ff d7             	call   *%r15
+  800d6c:	29 c3                	sub    %eax,%ebx
+  800d6e:	75 09                	jne    800d79 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800d70:	49 83 c5 01          	add    $0x1,%r13
+  800d74:	45 84 f6             	test   %r14b,%r14b
+  800d77:	75 d8                	jne    800d51 <strcasecmp+0x26>
+}
+  800d79:	89 d8                	mov    %ebx,%eax
+  800d7b:	48 83 c4 08          	add    $0x8,%rsp
+  800d7f:	5b                   	pop    %rbx
+  800d80:	41 5c                	pop    %r12
+  800d82:	41 5d                	pop    %r13
+  800d84:	41 5e                	pop    %r14
+  800d86:	41 5f                	pop    %r15
+  800d88:	5d                   	pop    %rbp
+  800d89:	c3                   	ret
+        return 0;
+  800d8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8f:	eb e8                	jmp    800d79 <strcasecmp+0x4e>
+
+0000000000800d91 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800d91:	55                   	push   %rbp
+  800d92:	48 89 e5             	mov    %rsp,%rbp
+  800d95:	41 57                	push   %r15
+  800d97:	41 56                	push   %r14
+  800d99:	41 55                	push   %r13
+  800d9b:	41 54                	push   %r12
+  800d9d:	53                   	push   %rbx
+  800d9e:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800da2:	48 85 d2             	test   %rdx,%rdx
+  800da5:	74 4f                	je     800df6 <strncasecmp+0x65>
+  800da7:	49 89 fc             	mov    %rdi,%r12
+  800daa:	49 89 f5             	mov    %rsi,%r13
+  800dad:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800db1:	49 be 1c 0d 80 00 00 	movabs $0x800d1c,%r14
+  800db8:	00 00 00 
+  800dbb:	49 83 c4 01          	add    $0x1,%r12
+  800dbf:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800dc5:	41 ff d6             	call   *%r14
+  800dc8:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800dca:	49 83 c5 01          	add    $0x1,%r13
+  800dce:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800dd3:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800dd6:	29 c3                	sub    %eax,%ebx
+  800dd8:	85 c0                	test   %eax,%eax
+  800dda:	74 09                	je     800de5 <strncasecmp+0x54>
+  800ddc:	85 db                	test   %ebx,%ebx
+  800dde:	75 05                	jne    800de5 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800de0:	4d 39 fc             	cmp    %r15,%r12
+  800de3:	75 d6                	jne    800dbb <strncasecmp+0x2a>
+}
+  800de5:	89 d8                	mov    %ebx,%eax
+  800de7:	48 83 c4 08          	add    $0x8,%rsp
+  800deb:	5b                   	pop    %rbx
+  800dec:	41 5c                	pop    %r12
+  800dee:	41 5d                	pop    %r13
+  800df0:	41 5e                	pop    %r14
+  800df2:	41 5f                	pop    %r15
+  800df4:	5d                   	pop    %rbp
+  800df5:	c3                   	ret
+    int d = 0;
+  800df6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800dfb:	eb e8                	jmp    800de5 <strncasecmp+0x54>
+
+0000000000800dfd <toupper>:
+
+int toupper(int c) {
+  800dfd:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800dff:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800e02:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800e05:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e08:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e0b:	c3                   	ret
+
+0000000000800e0c <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800e0c:	83 ff 20             	cmp    $0x20,%edi
+  800e0f:	0f 94 c0             	sete   %al
+  800e12:	0f b6 c0             	movzbl %al,%eax
+}
+  800e15:	c3                   	ret
+
+0000000000800e16 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800e16:	89 f8                	mov    %edi,%eax
+  800e18:	f7 d8                	neg    %eax
+  800e1a:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800e1d:	c3                   	ret
+
+0000000000800e1e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e1e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e21:	48 89 f8             	mov    %rdi,%rax
+  800e24:	48 f7 d8             	neg    %rax
+  800e27:	83 e0 07             	and    $0x7,%eax
+  800e2a:	49 89 d1             	mov    %rdx,%r9
+  800e2d:	49 29 c1             	sub    %rax,%r9
+  800e30:	78 36                	js     800e68 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e32:	40 0f b6 c6          	movzbl %sil,%eax
+  800e36:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e3d:	01 01 01 
+  800e40:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e44:	40 f6 c7 07          	test   $0x7,%dil
+  800e48:	75 38                	jne    800e82 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e4a:	4c 89 c9             	mov    %r9,%rcx
+  800e4d:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e51:	74 0c                	je     800e5f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e53:	fc                   	cld
+  800e54:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e57:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e5b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e5f:	4d 85 c9             	test   %r9,%r9
+  800e62:	75 45                	jne    800ea9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e64:	4c 89 c0             	mov    %r8,%rax
+  800e67:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e68:	48 85 d2             	test   %rdx,%rdx
+  800e6b:	74 f7                	je     800e64 <memset+0x46>
+  800e6d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e70:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e73:	48 83 c0 01          	add    $0x1,%rax
+  800e77:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e7b:	48 39 c2             	cmp    %rax,%rdx
+  800e7e:	75 f3                	jne    800e73 <memset+0x55>
+  800e80:	eb e2                	jmp    800e64 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e82:	40 f6 c7 01          	test   $0x1,%dil
+  800e86:	74 06                	je     800e8e <memset+0x70>
+  800e88:	88 07                	mov    %al,(%rdi)
+  800e8a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e8e:	40 f6 c7 02          	test   $0x2,%dil
+  800e92:	74 07                	je     800e9b <memset+0x7d>
+  800e94:	66 89 07             	mov    %ax,(%rdi)
+  800e97:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e9b:	40 f6 c7 04          	test   $0x4,%dil
+  800e9f:	74 a9                	je     800e4a <memset+0x2c>
+  800ea1:	89 07                	mov    %eax,(%rdi)
+  800ea3:	48 83 c7 04          	add    $0x4,%rdi
+  800ea7:	eb a1                	jmp    800e4a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ea9:	41 f6 c1 04          	test   $0x4,%r9b
+  800ead:	74 06                	je     800eb5 <memset+0x97>
+  800eaf:	89 07                	mov    %eax,(%rdi)
+  800eb1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eb5:	41 f6 c1 02          	test   $0x2,%r9b
+  800eb9:	74 07                	je     800ec2 <memset+0xa4>
+  800ebb:	66 89 07             	mov    %ax,(%rdi)
+  800ebe:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ec2:	41 f6 c1 01          	test   $0x1,%r9b
+  800ec6:	74 9c                	je     800e64 <memset+0x46>
+  800ec8:	88 07                	mov    %al,(%rdi)
+  800eca:	eb 98                	jmp    800e64 <memset+0x46>
+
+0000000000800ecc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ecc:	48 89 f8             	mov    %rdi,%rax
+  800ecf:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ed2:	48 39 fe             	cmp    %rdi,%rsi
+  800ed5:	73 3b                	jae    800f12 <memmove+0x46>
+  800ed7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800edb:	48 39 d7             	cmp    %rdx,%rdi
+  800ede:	73 32                	jae    800f12 <memmove+0x46>
+        s += n;
+        d += n;
+  800ee0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ee4:	48 89 d6             	mov    %rdx,%rsi
+  800ee7:	48 09 fe             	or     %rdi,%rsi
+  800eea:	48 09 ce             	or     %rcx,%rsi
+  800eed:	40 f6 c6 07          	test   $0x7,%sil
+  800ef1:	75 12                	jne    800f05 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ef3:	48 83 ef 08          	sub    $0x8,%rdi
+  800ef7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800efb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eff:	fd                   	std
+  800f00:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f03:	fc                   	cld
+  800f04:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f05:	48 83 ef 01          	sub    $0x1,%rdi
+  800f09:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f0d:	fd                   	std
+  800f0e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f10:	eb f1                	jmp    800f03 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f12:	48 89 f2             	mov    %rsi,%rdx
+  800f15:	48 09 c2             	or     %rax,%rdx
+  800f18:	48 09 ca             	or     %rcx,%rdx
+  800f1b:	f6 c2 07             	test   $0x7,%dl
+  800f1e:	75 0c                	jne    800f2c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f20:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f24:	48 89 c7             	mov    %rax,%rdi
+  800f27:	fc                   	cld
+  800f28:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f2b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f2c:	48 89 c7             	mov    %rax,%rdi
+  800f2f:	fc                   	cld
+  800f30:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f32:	c3                   	ret
+
+0000000000800f33 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f33:	55                   	push   %rbp
+  800f34:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f37:	48 b8 cc 0e 80 00 00 	movabs $0x800ecc,%rax
+  800f3e:	00 00 00 
+  800f41:	ff d0                	call   *%rax
+}
+  800f43:	5d                   	pop    %rbp
+  800f44:	c3                   	ret
+
+0000000000800f45 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f45:	55                   	push   %rbp
+  800f46:	48 89 e5             	mov    %rsp,%rbp
+  800f49:	41 57                	push   %r15
+  800f4b:	41 56                	push   %r14
+  800f4d:	41 55                	push   %r13
+  800f4f:	41 54                	push   %r12
+  800f51:	53                   	push   %rbx
+  800f52:	48 83 ec 08          	sub    $0x8,%rsp
+  800f56:	49 89 fe             	mov    %rdi,%r14
+  800f59:	49 89 f7             	mov    %rsi,%r15
+  800f5c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f5f:	48 89 f7             	mov    %rsi,%rdi
+  800f62:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  800f69:	00 00 00 
+  800f6c:	ff d0                	call   *%rax
+  800f6e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f71:	48 89 de             	mov    %rbx,%rsi
+  800f74:	4c 89 f7             	mov    %r14,%rdi
+  800f77:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  800f7e:	00 00 00 
+  800f81:	ff d0                	call   *%rax
+  800f83:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f86:	48 39 c3             	cmp    %rax,%rbx
+  800f89:	74 36                	je     800fc1 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f8b:	48 89 d8             	mov    %rbx,%rax
+  800f8e:	4c 29 e8             	sub    %r13,%rax
+  800f91:	49 39 c4             	cmp    %rax,%r12
+  800f94:	73 31                	jae    800fc7 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f96:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f9b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f9f:	4c 89 fe             	mov    %r15,%rsi
+  800fa2:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  800fa9:	00 00 00 
+  800fac:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fae:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fb2:	48 83 c4 08          	add    $0x8,%rsp
+  800fb6:	5b                   	pop    %rbx
+  800fb7:	41 5c                	pop    %r12
+  800fb9:	41 5d                	pop    %r13
+  800fbb:	41 5e                	pop    %r14
+  800fbd:	41 5f                	pop    %r15
+  800fbf:	5d                   	pop    %rbp
+  800fc0:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fc1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fc5:	eb eb                	jmp    800fb2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fc7:	48 83 eb 01          	sub    $0x1,%rbx
+  800fcb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fcf:	48 89 da             	mov    %rbx,%rdx
+  800fd2:	4c 89 fe             	mov    %r15,%rsi
+  800fd5:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  800fdc:	00 00 00 
+  800fdf:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fe1:	49 01 de             	add    %rbx,%r14
+  800fe4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fe9:	eb c3                	jmp    800fae <strlcat+0x69>
+
+0000000000800feb <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800feb:	48 85 d2             	test   %rdx,%rdx
+  800fee:	74 2d                	je     80101d <memcmp+0x32>
+  800ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ff5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ff9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ffe:	44 38 c1             	cmp    %r8b,%cl
+  801001:	75 0f                	jne    801012 <memcmp+0x27>
+    while (n-- > 0) {
+  801003:	48 83 c0 01          	add    $0x1,%rax
+  801007:	48 39 c2             	cmp    %rax,%rdx
+  80100a:	75 e9                	jne    800ff5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80100c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801011:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801012:	0f b6 c1             	movzbl %cl,%eax
+  801015:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801019:	44 29 c0             	sub    %r8d,%eax
+  80101c:	c3                   	ret
+    return 0;
+  80101d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801022:	c3                   	ret
+
+0000000000801023 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801023:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801027:	48 39 c7             	cmp    %rax,%rdi
+  80102a:	73 0f                	jae    80103b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80102c:	40 38 37             	cmp    %sil,(%rdi)
+  80102f:	74 0e                	je     80103f <memfind+0x1c>
+    for (; src < end; src++) {
+  801031:	48 83 c7 01          	add    $0x1,%rdi
+  801035:	48 39 f8             	cmp    %rdi,%rax
+  801038:	75 f2                	jne    80102c <memfind+0x9>
+  80103a:	c3                   	ret
+  80103b:	48 89 f8             	mov    %rdi,%rax
+  80103e:	c3                   	ret
+  80103f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801042:	c3                   	ret
+
+0000000000801043 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801043:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801046:	0f b6 37             	movzbl (%rdi),%esi
+  801049:	40 80 fe 20          	cmp    $0x20,%sil
+  80104d:	74 06                	je     801055 <strtol+0x12>
+  80104f:	40 80 fe 09          	cmp    $0x9,%sil
+  801053:	75 13                	jne    801068 <strtol+0x25>
+  801055:	48 83 c7 01          	add    $0x1,%rdi
+  801059:	0f b6 37             	movzbl (%rdi),%esi
+  80105c:	40 80 fe 20          	cmp    $0x20,%sil
+  801060:	74 f3                	je     801055 <strtol+0x12>
+  801062:	40 80 fe 09          	cmp    $0x9,%sil
+  801066:	74 ed                	je     801055 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801068:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80106b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80106e:	3c 01                	cmp    $0x1,%al
+  801070:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801074:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80107a:	75 0f                	jne    80108b <strtol+0x48>
+  80107c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80107f:	74 14                	je     801095 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801081:	85 d2                	test   %edx,%edx
+  801083:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801088:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80108b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801090:	4c 63 ca             	movslq %edx,%r9
+  801093:	eb 36                	jmp    8010cb <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801095:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801099:	74 0f                	je     8010aa <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80109b:	85 d2                	test   %edx,%edx
+  80109d:	75 ec                	jne    80108b <strtol+0x48>
+        s++;
+  80109f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010a3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010a8:	eb e1                	jmp    80108b <strtol+0x48>
+        s += 2;
+  8010aa:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010ae:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010b3:	eb d6                	jmp    80108b <strtol+0x48>
+            dig -= '0';
+  8010b5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010b8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010bc:	41 39 d0             	cmp    %edx,%r8d
+  8010bf:	7d 21                	jge    8010e2 <strtol+0x9f>
+        val = val * base + dig;
+  8010c1:	49 0f af c1          	imul   %r9,%rax
+  8010c5:	0f b6 c9             	movzbl %cl,%ecx
+  8010c8:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010cb:	48 83 c7 01          	add    $0x1,%rdi
+  8010cf:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010d3:	80 f9 39             	cmp    $0x39,%cl
+  8010d6:	76 dd                	jbe    8010b5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010d8:	80 f9 7b             	cmp    $0x7b,%cl
+  8010db:	77 05                	ja     8010e2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010dd:	83 e9 57             	sub    $0x57,%ecx
+  8010e0:	eb d6                	jmp    8010b8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010e2:	4d 85 d2             	test   %r10,%r10
+  8010e5:	74 03                	je     8010ea <strtol+0xa7>
+  8010e7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010ea:	48 89 c2             	mov    %rax,%rdx
+  8010ed:	48 f7 da             	neg    %rdx
+  8010f0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010f4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010f8:	c3                   	ret
+
+00000000008010f9 <atoi>:
+int atoi(const char *str) {
+  8010f9:	55                   	push   %rbp
+  8010fa:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8010fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801102:	be 00 00 00 00       	mov    $0x0,%esi
+  801107:	48 b8 43 10 80 00 00 	movabs $0x801043,%rax
+  80110e:	00 00 00 
+  801111:	ff d0                	call   *%rax
+}
+  801113:	5d                   	pop    %rbp
+  801114:	c3                   	ret
+
+0000000000801115 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801115:	55                   	push   %rbp
+  801116:	48 89 e5             	mov    %rsp,%rbp
+  801119:	53                   	push   %rbx
+  80111a:	48 89 fa             	mov    %rdi,%rdx
+  80111d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801120:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801125:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80112f:	be 00 00 00 00       	mov    $0x0,%esi
+  801134:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80113a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80113c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801140:	c9                   	leave
+  801141:	c3                   	ret
+
+0000000000801142 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801142:	55                   	push   %rbp
+  801143:	48 89 e5             	mov    %rsp,%rbp
+  801146:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801147:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80114c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801151:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801156:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801160:	be 00 00 00 00       	mov    $0x0,%esi
+  801165:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80116b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80116d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801171:	c9                   	leave
+  801172:	c3                   	ret
+
+0000000000801173 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801173:	55                   	push   %rbp
+  801174:	48 89 e5             	mov    %rsp,%rbp
+  801177:	53                   	push   %rbx
+  801178:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80117c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80117f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801184:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801189:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801193:	be 00 00 00 00       	mov    $0x0,%esi
+  801198:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011a0:	48 85 c0             	test   %rax,%rax
+  8011a3:	7f 06                	jg     8011ab <sys_env_destroy+0x38>
+}
+  8011a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a9:	c9                   	leave
+  8011aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ab:	49 89 c0             	mov    %rax,%r8
+  8011ae:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011b3:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8011ba:	00 00 00 
+  8011bd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8011c2:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8011c9:	00 00 00 
+  8011cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d1:	49 b9 3d 3f 80 00 00 	movabs $0x803f3d,%r9
+  8011d8:	00 00 00 
+  8011db:	41 ff d1             	call   *%r9
+
+00000000008011de <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011de:	55                   	push   %rbp
+  8011df:	48 89 e5             	mov    %rsp,%rbp
+  8011e2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801201:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801207:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801209:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120d:	c9                   	leave
+  80120e:	c3                   	ret
+
+000000000080120f <sys_yield>:
+
+void
+sys_yield(void) {
+  80120f:	55                   	push   %rbp
+  801210:	48 89 e5             	mov    %rsp,%rbp
+  801213:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801214:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801219:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801223:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801228:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122d:	be 00 00 00 00       	mov    $0x0,%esi
+  801232:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801238:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80123a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80123e:	c9                   	leave
+  80123f:	c3                   	ret
+
+0000000000801240 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801240:	55                   	push   %rbp
+  801241:	48 89 e5             	mov    %rsp,%rbp
+  801244:	53                   	push   %rbx
+  801245:	48 89 fa             	mov    %rdi,%rdx
+  801248:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80124b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801250:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801257:	00 00 00 
+  80125a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125f:	be 00 00 00 00       	mov    $0x0,%esi
+  801264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80126c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801270:	c9                   	leave
+  801271:	c3                   	ret
+
+0000000000801272 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801272:	55                   	push   %rbp
+  801273:	48 89 e5             	mov    %rsp,%rbp
+  801276:	53                   	push   %rbx
+  801277:	49 89 f8             	mov    %rdi,%r8
+  80127a:	48 89 d3             	mov    %rdx,%rbx
+  80127d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801280:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801285:	4c 89 c2             	mov    %r8,%rdx
+  801288:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80128b:	be 00 00 00 00       	mov    $0x0,%esi
+  801290:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801296:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801298:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129c:	c9                   	leave
+  80129d:	c3                   	ret
+
+000000000080129e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80129e:	55                   	push   %rbp
+  80129f:	48 89 e5             	mov    %rsp,%rbp
+  8012a2:	53                   	push   %rbx
+  8012a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8012a7:	89 f8                	mov    %edi,%eax
+  8012a9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012ac:	48 63 f9             	movslq %ecx,%rdi
+  8012af:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c7:	48 85 c0             	test   %rax,%rax
+  8012ca:	7f 06                	jg     8012d2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d0:	c9                   	leave
+  8012d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d2:	49 89 c0             	mov    %rax,%r8
+  8012d5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012da:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8012e1:	00 00 00 
+  8012e4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8012e9:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8012f0:	00 00 00 
+  8012f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f8:	49 b9 3d 3f 80 00 00 	movabs $0x803f3d,%r9
+  8012ff:	00 00 00 
+  801302:	41 ff d1             	call   *%r9
+
+0000000000801305 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801305:	55                   	push   %rbp
+  801306:	48 89 e5             	mov    %rsp,%rbp
+  801309:	53                   	push   %rbx
+  80130a:	48 83 ec 08          	sub    $0x8,%rsp
+  80130e:	89 f8                	mov    %edi,%eax
+  801310:	49 89 f2             	mov    %rsi,%r10
+  801313:	48 89 cf             	mov    %rcx,%rdi
+  801316:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801319:	48 63 da             	movslq %edx,%rbx
+  80131c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801324:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801327:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80132a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80132c:	48 85 c0             	test   %rax,%rax
+  80132f:	7f 06                	jg     801337 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801331:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801335:	c9                   	leave
+  801336:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801337:	49 89 c0             	mov    %rax,%r8
+  80133a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80133f:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801346:	00 00 00 
+  801349:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80134e:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801355:	00 00 00 
+  801358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135d:	49 b9 3d 3f 80 00 00 	movabs $0x803f3d,%r9
+  801364:	00 00 00 
+  801367:	41 ff d1             	call   *%r9
+
+000000000080136a <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80136a:	55                   	push   %rbp
+  80136b:	48 89 e5             	mov    %rsp,%rbp
+  80136e:	53                   	push   %rbx
+  80136f:	48 83 ec 08          	sub    $0x8,%rsp
+  801373:	49 89 f9             	mov    %rdi,%r9
+  801376:	89 f0                	mov    %esi,%eax
+  801378:	48 89 d3             	mov    %rdx,%rbx
+  80137b:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80137e:	49 63 f0             	movslq %r8d,%rsi
+  801381:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801384:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801389:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801392:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801394:	48 85 c0             	test   %rax,%rax
+  801397:	7f 06                	jg     80139f <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801399:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139d:	c9                   	leave
+  80139e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139f:	49 89 c0             	mov    %rax,%r8
+  8013a2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013a7:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8013ae:	00 00 00 
+  8013b1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013b6:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8013bd:	00 00 00 
+  8013c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c5:	49 b9 3d 3f 80 00 00 	movabs $0x803f3d,%r9
+  8013cc:	00 00 00 
+  8013cf:	41 ff d1             	call   *%r9
+
+00000000008013d2 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8013d2:	55                   	push   %rbp
+  8013d3:	48 89 e5             	mov    %rsp,%rbp
+  8013d6:	53                   	push   %rbx
+  8013d7:	89 f8                	mov    %edi,%eax
+  8013d9:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8013dc:	48 63 f9             	movslq %ecx,%rdi
+  8013df:	48 63 da             	movslq %edx,%rbx
+  8013e2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ea:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f8:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8013fa:	89 c2                	mov    %eax,%edx
+  8013fc:	48 85 c0             	test   %rax,%rax
+  8013ff:	78 0d                	js     80140e <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801401:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801406:	4d 85 c9             	test   %r9,%r9
+  801409:	74 03                	je     80140e <sys_alloc_dma_region+0x3c>
+  80140b:	49 89 01             	mov    %rax,(%r9)
+}
+  80140e:	89 d0                	mov    %edx,%eax
+  801410:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801414:	c9                   	leave
+  801415:	c3                   	ret
+
+0000000000801416 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801416:	55                   	push   %rbp
+  801417:	48 89 e5             	mov    %rsp,%rbp
+  80141a:	53                   	push   %rbx
+  80141b:	48 83 ec 08          	sub    $0x8,%rsp
+  80141f:	48 89 f1             	mov    %rsi,%rcx
+  801422:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801425:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801428:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801432:	be 00 00 00 00       	mov    $0x0,%esi
+  801437:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143f:	48 85 c0             	test   %rax,%rax
+  801442:	7f 06                	jg     80144a <sys_set_cache_region+0x34>
+}
+  801444:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801448:	c9                   	leave
+  801449:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144a:	49 89 c0             	mov    %rax,%r8
+  80144d:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801452:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801459:	00 00 00 
+  80145c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801461:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801468:	00 00 00 
+  80146b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801470:	49 b9 3d 3f 80 00 00 	movabs $0x803f3d,%r9
+  801477:	00 00 00 
+  80147a:	41 ff d1             	call   *%r9
+
+000000000080147d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80147d:	55                   	push   %rbp
+  80147e:	48 89 e5             	mov    %rsp,%rbp
+  801481:	53                   	push   %rbx
+  801482:	48 83 ec 08          	sub    $0x8,%rsp
+  801486:	48 89 f1             	mov    %rsi,%rcx
+  801489:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80148c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80148f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801494:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801499:	be 00 00 00 00       	mov    $0x0,%esi
+  80149e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a6:	48 85 c0             	test   %rax,%rax
+  8014a9:	7f 06                	jg     8014b1 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014af:	c9                   	leave
+  8014b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b1:	49 89 c0             	mov    %rax,%r8
+  8014b4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014b9:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8014c0:	00 00 00 
+  8014c3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014c8:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8014cf:	00 00 00 
+  8014d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d7:	49 b9 3d 3f 80 00 00 	movabs $0x803f3d,%r9
+  8014de:	00 00 00 
+  8014e1:	41 ff d1             	call   *%r9
+
+00000000008014e4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014e4:	55                   	push   %rbp
+  8014e5:	48 89 e5             	mov    %rsp,%rbp
+  8014e8:	53                   	push   %rbx
+  8014e9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014ed:	48 63 ce             	movslq %esi,%rcx
+  8014f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801502:	be 00 00 00 00       	mov    $0x0,%esi
+  801507:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150f:	48 85 c0             	test   %rax,%rax
+  801512:	7f 06                	jg     80151a <sys_env_set_status+0x36>
+}
+  801514:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801518:	c9                   	leave
+  801519:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80151a:	49 89 c0             	mov    %rax,%r8
+  80151d:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801522:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801529:	00 00 00 
+  80152c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801531:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801538:	00 00 00 
+  80153b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801540:	49 b9 3d 3f 80 00 00 	movabs $0x803f3d,%r9
+  801547:	00 00 00 
+  80154a:	41 ff d1             	call   *%r9
+
+000000000080154d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80154d:	55                   	push   %rbp
+  80154e:	48 89 e5             	mov    %rsp,%rbp
+  801551:	53                   	push   %rbx
+  801552:	48 83 ec 08          	sub    $0x8,%rsp
+  801556:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801559:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801561:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801566:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156b:	be 00 00 00 00       	mov    $0x0,%esi
+  801570:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801576:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801578:	48 85 c0             	test   %rax,%rax
+  80157b:	7f 06                	jg     801583 <sys_env_set_trapframe+0x36>
+}
+  80157d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801581:	c9                   	leave
+  801582:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801583:	49 89 c0             	mov    %rax,%r8
+  801586:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80158b:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801592:	00 00 00 
+  801595:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80159a:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8015a1:	00 00 00 
+  8015a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a9:	49 b9 3d 3f 80 00 00 	movabs $0x803f3d,%r9
+  8015b0:	00 00 00 
+  8015b3:	41 ff d1             	call   *%r9
+
+00000000008015b6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015b6:	55                   	push   %rbp
+  8015b7:	48 89 e5             	mov    %rsp,%rbp
+  8015ba:	53                   	push   %rbx
+  8015bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8015bf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015c2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c5:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e1:	48 85 c0             	test   %rax,%rax
+  8015e4:	7f 06                	jg     8015ec <sys_env_set_pgfault_upcall+0x36>
+}
+  8015e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ea:	c9                   	leave
+  8015eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ec:	49 89 c0             	mov    %rax,%r8
+  8015ef:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015f4:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8015fb:	00 00 00 
+  8015fe:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801603:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80160a:	00 00 00 
+  80160d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801612:	49 b9 3d 3f 80 00 00 	movabs $0x803f3d,%r9
+  801619:	00 00 00 
+  80161c:	41 ff d1             	call   *%r9
+
+000000000080161f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80161f:	55                   	push   %rbp
+  801620:	48 89 e5             	mov    %rsp,%rbp
+  801623:	53                   	push   %rbx
+  801624:	89 f8                	mov    %edi,%eax
+  801626:	49 89 f1             	mov    %rsi,%r9
+  801629:	48 89 d3             	mov    %rdx,%rbx
+  80162c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80162f:	49 63 f0             	movslq %r8d,%rsi
+  801632:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801635:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80163a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80163d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801643:	cd 30                	int    $0x30
+}
+  801645:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801649:	c9                   	leave
+  80164a:	c3                   	ret
+
+000000000080164b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80164b:	55                   	push   %rbp
+  80164c:	48 89 e5             	mov    %rsp,%rbp
+  80164f:	53                   	push   %rbx
+  801650:	48 83 ec 08          	sub    $0x8,%rsp
+  801654:	48 89 fa             	mov    %rdi,%rdx
+  801657:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80165a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801664:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801669:	be 00 00 00 00       	mov    $0x0,%esi
+  80166e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801674:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801676:	48 85 c0             	test   %rax,%rax
+  801679:	7f 06                	jg     801681 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80167b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167f:	c9                   	leave
+  801680:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801681:	49 89 c0             	mov    %rax,%r8
+  801684:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801689:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801690:	00 00 00 
+  801693:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801698:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80169f:	00 00 00 
+  8016a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a7:	49 b9 3d 3f 80 00 00 	movabs $0x803f3d,%r9
+  8016ae:	00 00 00 
+  8016b1:	41 ff d1             	call   *%r9
+
+00000000008016b4 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8016b4:	55                   	push   %rbp
+  8016b5:	48 89 e5             	mov    %rsp,%rbp
+  8016b8:	53                   	push   %rbx
+  8016b9:	48 89 fa             	mov    %rdi,%rdx
+  8016bc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016bf:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d9:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016df:	c9                   	leave
+  8016e0:	c3                   	ret
+
+00000000008016e1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016e1:	55                   	push   %rbp
+  8016e2:	48 89 e5             	mov    %rsp,%rbp
+  8016e5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801704:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80170c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801710:	c9                   	leave
+  801711:	c3                   	ret
+
+0000000000801712 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801712:	48 85 ff             	test   %rdi,%rdi
+  801715:	0f 84 b6 01 00 00    	je     8018d1 <malloc+0x1bf>
+malloc(size_t size) {
+  80171b:	55                   	push   %rbp
+  80171c:	48 89 e5             	mov    %rsp,%rbp
+  80171f:	41 56                	push   %r14
+  801721:	41 55                	push   %r13
+  801723:	41 54                	push   %r12
+  801725:	53                   	push   %rbx
+  801726:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801729:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801730:	00 00 00 
+  801733:	4c 8b 20             	mov    (%rax),%r12
+  801736:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80173d:	0f 87 94 01 00 00    	ja     8018d7 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801743:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80174a:	00 00 00 
+  80174d:	48 85 c0             	test   %rax,%rax
+  801750:	74 6b                	je     8017bd <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801752:	4d 85 e4             	test   %r12,%r12
+  801755:	74 66                	je     8017bd <malloc+0xab>
+  801757:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80175e:	00 00 00 
+  801761:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801766:	eb 0d                	jmp    801775 <malloc+0x63>
+  801768:	48 83 c1 01          	add    $0x1,%rcx
+  80176c:	48 83 c2 18          	add    $0x18,%rdx
+  801770:	49 39 cc             	cmp    %rcx,%r12
+  801773:	74 48                	je     8017bd <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801775:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80177a:	74 ec                	je     801768 <malloc+0x56>
+  80177c:	48 39 1a             	cmp    %rbx,(%rdx)
+  80177f:	72 e7                	jb     801768 <malloc+0x56>
+                real_freep_size--;
+  801781:	48 83 e8 01          	sub    $0x1,%rax
+  801785:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80178c:	00 00 00 
+                freep[i].is_free = false;
+  80178f:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801796:	00 00 00 
+  801799:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80179d:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8017a1:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8017a5:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8017ac:	00 
+                freep[i].size = size;
+  8017ad:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8017b1:	48 01 c8             	add    %rcx,%rax
+  8017b4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017b8:	e9 0b 01 00 00       	jmp    8018c8 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8017bd:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8017c4:	00 00 00 
+  8017c7:	48 01 d8             	add    %rbx,%rax
+  8017ca:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8017d0:	76 7c                	jbe    80184e <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8017d2:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8017d9:	00 00 00 
+  8017dc:	4c 8b 30             	mov    (%rax),%r14
+  8017df:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8017e6:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8017e9:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8017f0:	00 00 00 
+  8017f3:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8017fa:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801801:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801807:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80180b:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  801812:	00 00 00 
+  801815:	ff d0                	call   *%rax
+  801817:	89 c7                	mov    %eax,%edi
+  801819:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801820:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801827:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80182e:	00 00 00 
+  801831:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801835:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80183a:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  801841:	00 00 00 
+  801844:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801846:	85 c0                	test   %eax,%eax
+  801848:	0f 88 90 00 00 00    	js     8018de <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80184e:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801855:	00 00 00 
+  801858:	48 8b 31             	mov    (%rcx),%rsi
+  80185b:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801862:	00 00 00 
+  801865:	4c 8b 07             	mov    (%rdi),%r8
+  801868:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80186c:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801873:	00 00 00 
+  801876:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80187a:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80187e:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801885:	00 00 00 
+  801888:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80188c:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80188f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801893:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80189a:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  80189b:	48 89 d8             	mov    %rbx,%rax
+  80189e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8018a3:	4c 01 c0             	add    %r8,%rax
+  8018a6:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8018a9:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8018b0:	48 01 f3             	add    %rsi,%rbx
+  8018b3:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8018b6:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8018bb:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8018c2:	00 00 00 
+  8018c5:	48 89 d0             	mov    %rdx,%rax
+}
+  8018c8:	5b                   	pop    %rbx
+  8018c9:	41 5c                	pop    %r12
+  8018cb:	41 5d                	pop    %r13
+  8018cd:	41 5e                	pop    %r14
+  8018cf:	5d                   	pop    %rbp
+  8018d0:	c3                   	ret
+        return NULL;
+  8018d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018d6:	c3                   	ret
+        return NULL;
+  8018d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018dc:	eb ea                	jmp    8018c8 <malloc+0x1b6>
+            return NULL;
+  8018de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e3:	eb e3                	jmp    8018c8 <malloc+0x1b6>
+
+00000000008018e5 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8018e5:	55                   	push   %rbp
+  8018e6:	48 89 e5             	mov    %rsp,%rbp
+  8018e9:	53                   	push   %rbx
+  8018ea:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8018ee:	48 89 fb             	mov    %rdi,%rbx
+  8018f1:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8018f5:	48 89 df             	mov    %rbx,%rdi
+  8018f8:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  8018ff:	00 00 00 
+  801902:	ff d0                	call   *%rax
+  801904:	48 89 c7             	mov    %rax,%rdi
+  801907:	48 89 da             	mov    %rbx,%rdx
+  80190a:	be 00 00 00 00       	mov    $0x0,%esi
+  80190f:	48 b8 1e 0e 80 00 00 	movabs $0x800e1e,%rax
+  801916:	00 00 00 
+  801919:	ff d0                	call   *%rax
+}
+  80191b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80191f:	c9                   	leave
+  801920:	c3                   	ret
+
+0000000000801921 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801921:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801928:	00 00 00 
+  80192b:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801932:	00 00 00 
+  801935:	48 3b 02             	cmp    (%rdx),%rax
+  801938:	74 4d                	je     801987 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  80193a:	48 85 c0             	test   %rax,%rax
+  80193d:	74 4d                	je     80198c <get_allocsize+0x6b>
+  80193f:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801946:	00 00 00 
+  801949:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80194e:	48 3b 39             	cmp    (%rcx),%rdi
+  801951:	74 13                	je     801966 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801953:	48 83 c2 01          	add    $0x1,%rdx
+  801957:	48 83 c1 18          	add    $0x18,%rcx
+  80195b:	48 39 d0             	cmp    %rdx,%rax
+  80195e:	75 ee                	jne    80194e <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801960:	b8 00 00 00 00       	mov    $0x0,%eax
+  801965:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801966:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80196a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196f:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801976:	00 00 00 
+  801979:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80197f:	75 0b                	jne    80198c <get_allocsize+0x6b>
+  801981:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801986:	c3                   	ret
+        return 0;
+  801987:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80198c:	c3                   	ret
+
+000000000080198d <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80198d:	48 85 ff             	test   %rdi,%rdi
+  801990:	0f 84 01 01 00 00    	je     801a97 <free+0x10a>
+free(void *ptr) {
+  801996:	55                   	push   %rbp
+  801997:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  80199a:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8019a1:	00 00 00 
+  8019a4:	48 8b 30             	mov    (%rax),%rsi
+  8019a7:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8019ae:	00 00 00 
+  8019b1:	48 39 c6             	cmp    %rax,%rsi
+  8019b4:	74 50                	je     801a06 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8019b6:	48 85 f6             	test   %rsi,%rsi
+  8019b9:	74 21                	je     8019dc <free+0x4f>
+  8019bb:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8019c2:	00 00 00 
+  8019c5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8019ca:	48 3b 39             	cmp    (%rcx),%rdi
+  8019cd:	74 61                	je     801a30 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8019cf:	48 83 c2 01          	add    $0x1,%rdx
+  8019d3:	48 83 c1 18          	add    $0x18,%rcx
+  8019d7:	48 39 d6             	cmp    %rdx,%rsi
+  8019da:	75 ee                	jne    8019ca <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8019dc:	48 ba b0 55 80 00 00 	movabs $0x8055b0,%rdx
+  8019e3:	00 00 00 
+  8019e6:	be 12 01 00 00       	mov    $0x112,%esi
+  8019eb:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8019f2:	00 00 00 
+  8019f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fa:	48 b9 3d 3f 80 00 00 	movabs $0x803f3d,%rcx
+  801a01:	00 00 00 
+  801a04:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801a06:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801a0d:	00 00 00 
+  801a10:	be 06 01 00 00       	mov    $0x106,%esi
+  801a15:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801a1c:	00 00 00 
+  801a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a24:	48 b9 3d 3f 80 00 00 	movabs $0x803f3d,%rcx
+  801a2b:	00 00 00 
+  801a2e:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801a30:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a34:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a3b:	00 00 00 
+  801a3e:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a44:	75 27                	jne    801a6d <free+0xe0>
+            freep[i].is_free = true;
+  801a46:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a4a:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801a51:	00 00 00 
+  801a54:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801a5b:	00 00 
+            real_freep_size++;
+  801a5d:	48 83 c0 01          	add    $0x1,%rax
+  801a61:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801a68:	00 00 00 
+}
+  801a6b:	5d                   	pop    %rbp
+  801a6c:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801a6d:	48 ba 88 55 80 00 00 	movabs $0x805588,%rdx
+  801a74:	00 00 00 
+  801a77:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801a7c:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801a83:	00 00 00 
+  801a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a8b:	48 b9 3d 3f 80 00 00 	movabs $0x803f3d,%rcx
+  801a92:	00 00 00 
+  801a95:	ff d1                	call   *%rcx
+  801a97:	c3                   	ret
+
+0000000000801a98 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801a98:	55                   	push   %rbp
+  801a99:	48 89 e5             	mov    %rsp,%rbp
+  801a9c:	41 55                	push   %r13
+  801a9e:	41 54                	push   %r12
+  801aa0:	53                   	push   %rbx
+  801aa1:	48 83 ec 08          	sub    $0x8,%rsp
+  801aa5:	48 89 fb             	mov    %rdi,%rbx
+  801aa8:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801aab:	48 b8 21 19 80 00 00 	movabs $0x801921,%rax
+  801ab2:	00 00 00 
+  801ab5:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801ab7:	49 39 c5             	cmp    %rax,%r13
+  801aba:	73 0e                	jae    801aca <realloc+0x32>
+}
+  801abc:	48 89 d8             	mov    %rbx,%rax
+  801abf:	48 83 c4 08          	add    $0x8,%rsp
+  801ac3:	5b                   	pop    %rbx
+  801ac4:	41 5c                	pop    %r12
+  801ac6:	41 5d                	pop    %r13
+  801ac8:	5d                   	pop    %rbp
+  801ac9:	c3                   	ret
+  801aca:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801acd:	4c 89 ef             	mov    %r13,%rdi
+  801ad0:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  801ad7:	00 00 00 
+  801ada:	ff d0                	call   *%rax
+  801adc:	48 89 c7             	mov    %rax,%rdi
+  801adf:	4c 89 e2             	mov    %r12,%rdx
+  801ae2:	48 89 de             	mov    %rbx,%rsi
+  801ae5:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  801aec:	00 00 00 
+  801aef:	ff d0                	call   *%rax
+  801af1:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801af4:	48 89 df             	mov    %rbx,%rdi
+  801af7:	48 b8 8d 19 80 00 00 	movabs $0x80198d,%rax
+  801afe:	00 00 00 
+  801b01:	ff d0                	call   *%rax
+    return newptr;
+  801b03:	4c 89 e3             	mov    %r12,%rbx
+  801b06:	eb b4                	jmp    801abc <realloc+0x24>
+
+0000000000801b08 <strdup>:
+
+char*
+strdup (const char *src) {
+  801b08:	55                   	push   %rbp
+  801b09:	48 89 e5             	mov    %rsp,%rbp
+  801b0c:	41 54                	push   %r12
+  801b0e:	53                   	push   %rbx
+  801b0f:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801b12:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  801b19:	00 00 00 
+  801b1c:	ff d0                	call   *%rax
+  801b1e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801b22:	4c 89 e7             	mov    %r12,%rdi
+  801b25:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  801b2c:	00 00 00 
+  801b2f:	ff d0                	call   *%rax
+  801b31:	48 89 c7             	mov    %rax,%rdi
+  801b34:	4c 89 e2             	mov    %r12,%rdx
+  801b37:	48 89 de             	mov    %rbx,%rsi
+  801b3a:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  801b41:	00 00 00 
+  801b44:	ff d0                	call   *%rax
+}
+  801b46:	5b                   	pop    %rbx
+  801b47:	41 5c                	pop    %r12
+  801b49:	5d                   	pop    %rbp
+  801b4a:	c3                   	ret
+
+0000000000801b4b <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801b4b:	55                   	push   %rbp
+  801b4c:	48 89 e5             	mov    %rsp,%rbp
+  801b4f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b50:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b55:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b64:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b69:	be 00 00 00 00       	mov    $0x0,%esi
+  801b6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b74:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b7a:	c9                   	leave
+  801b7b:	c3                   	ret
+
+0000000000801b7c <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801b7c:	55                   	push   %rbp
+  801b7d:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801b80:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801b87:	00 00 00 
+  801b8a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801b8e:	74 26                	je     801bb6 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801b90:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801b92:	48 c1 e2 20          	shl    $0x20,%rdx
+  801b96:	89 c0                	mov    %eax,%eax
+  801b98:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801b9b:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801ba2:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801ba9:	00 00 00 
+  801bac:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb1:	48 f7 31             	divq   (%rcx)
+}
+  801bb4:	5d                   	pop    %rbp
+  801bb5:	c3                   	ret
+        freq = get_cpufreq();
+  801bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bbb:	48 ba 4b 1b 80 00 00 	movabs $0x801b4b,%rdx
+  801bc2:	00 00 00 
+  801bc5:	ff d2                	call   *%rdx
+  801bc7:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801bce:	00 00 00 
+  801bd1:	eb bd                	jmp    801b90 <get_ticks+0x14>
+
+0000000000801bd3 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801bd3:	55                   	push   %rbp
+  801bd4:	48 89 e5             	mov    %rsp,%rbp
+  801bd7:	53                   	push   %rbx
+  801bd8:	48 83 ec 08          	sub    $0x8,%rsp
+  801bdc:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801bdf:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801be6:	00 00 00 
+  801be9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801bed:	74 50                	je     801c3f <sleep+0x6c>
+    asm volatile("rdtsc"
+  801bef:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801bf1:	48 c1 e2 20          	shl    $0x20,%rdx
+  801bf5:	89 c0                	mov    %eax,%eax
+  801bf7:	48 89 d6             	mov    %rdx,%rsi
+  801bfa:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801bfd:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c04:	00 00 00 
+  801c07:	48 0f af 18          	imul   (%rax),%rbx
+  801c0b:	48 c1 eb 03          	shr    $0x3,%rbx
+  801c0f:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801c16:	9b c4 20 
+  801c19:	48 89 d8             	mov    %rbx,%rax
+  801c1c:	48 f7 e2             	mul    %rdx
+  801c1f:	48 89 d1             	mov    %rdx,%rcx
+  801c22:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801c26:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c28:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c2c:	89 c0                	mov    %eax,%eax
+  801c2e:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801c31:	48 29 f2             	sub    %rsi,%rdx
+  801c34:	48 39 ca             	cmp    %rcx,%rdx
+  801c37:	72 ed                	jb     801c26 <sleep+0x53>
+}
+  801c39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c3d:	c9                   	leave
+  801c3e:	c3                   	ret
+        freq = get_cpufreq();
+  801c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c44:	48 ba 4b 1b 80 00 00 	movabs $0x801b4b,%rdx
+  801c4b:	00 00 00 
+  801c4e:	ff d2                	call   *%rdx
+  801c50:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c57:	00 00 00 
+  801c5a:	eb 93                	jmp    801bef <sleep+0x1c>
+
+0000000000801c5c <poll_kbd>:
+
+int poll_kbd() {
+  801c5c:	55                   	push   %rbp
+  801c5d:	48 89 e5             	mov    %rsp,%rbp
+  801c60:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c61:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c75:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c7a:	be 00 00 00 00       	mov    $0x0,%esi
+  801c7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c85:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c8b:	c9                   	leave
+  801c8c:	c3                   	ret
+
+0000000000801c8d <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801c8d:	55                   	push   %rbp
+  801c8e:	48 89 e5             	mov    %rsp,%rbp
+  801c91:	53                   	push   %rbx
+  801c92:	49 89 fa             	mov    %rdi,%r10
+  801c95:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801c97:	44 89 c6             	mov    %r8d,%esi
+  801c9a:	89 cf                	mov    %ecx,%edi
+  801c9c:	89 d3                	mov    %edx,%ebx
+  801c9e:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ca0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ca5:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ca8:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801cac:	cd 30                	int    $0x30
+  801cae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cb2:	c9                   	leave
+  801cb3:	c3                   	ret
+
+0000000000801cb4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cb4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801cbb:	ff ff ff 
+  801cbe:	48 01 f8             	add    %rdi,%rax
+  801cc1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801cc5:	c3                   	ret
+
+0000000000801cc6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cc6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ccd:	ff ff ff 
+  801cd0:	48 01 f8             	add    %rdi,%rax
+  801cd3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801cd7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801cdd:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801ce1:	c3                   	ret
+
+0000000000801ce2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ce2:	55                   	push   %rbp
+  801ce3:	48 89 e5             	mov    %rsp,%rbp
+  801ce6:	41 57                	push   %r15
+  801ce8:	41 56                	push   %r14
+  801cea:	41 55                	push   %r13
+  801cec:	41 54                	push   %r12
+  801cee:	53                   	push   %rbx
+  801cef:	48 83 ec 08          	sub    $0x8,%rsp
+  801cf3:	49 89 ff             	mov    %rdi,%r15
+  801cf6:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801cfb:	49 bd 96 3b 80 00 00 	movabs $0x803b96,%r13
+  801d02:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801d05:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801d0b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801d0e:	48 89 df             	mov    %rbx,%rdi
+  801d11:	41 ff d5             	call   *%r13
+  801d14:	83 e0 04             	and    $0x4,%eax
+  801d17:	74 17                	je     801d30 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801d19:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d20:	4c 39 f3             	cmp    %r14,%rbx
+  801d23:	75 e6                	jne    801d0b <fd_alloc+0x29>
+  801d25:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801d2b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801d30:	4d 89 27             	mov    %r12,(%r15)
+}
+  801d33:	48 83 c4 08          	add    $0x8,%rsp
+  801d37:	5b                   	pop    %rbx
+  801d38:	41 5c                	pop    %r12
+  801d3a:	41 5d                	pop    %r13
+  801d3c:	41 5e                	pop    %r14
+  801d3e:	41 5f                	pop    %r15
+  801d40:	5d                   	pop    %rbp
+  801d41:	c3                   	ret
+
+0000000000801d42 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801d42:	83 ff 1f             	cmp    $0x1f,%edi
+  801d45:	77 39                	ja     801d80 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801d47:	55                   	push   %rbp
+  801d48:	48 89 e5             	mov    %rsp,%rbp
+  801d4b:	41 54                	push   %r12
+  801d4d:	53                   	push   %rbx
+  801d4e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801d51:	48 63 df             	movslq %edi,%rbx
+  801d54:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801d5b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801d5f:	48 89 df             	mov    %rbx,%rdi
+  801d62:	48 b8 96 3b 80 00 00 	movabs $0x803b96,%rax
+  801d69:	00 00 00 
+  801d6c:	ff d0                	call   *%rax
+  801d6e:	a8 04                	test   $0x4,%al
+  801d70:	74 14                	je     801d86 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d72:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d7b:	5b                   	pop    %rbx
+  801d7c:	41 5c                	pop    %r12
+  801d7e:	5d                   	pop    %rbp
+  801d7f:	c3                   	ret
+        return -E_INVAL;
+  801d80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d85:	c3                   	ret
+        return -E_INVAL;
+  801d86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d8b:	eb ee                	jmp    801d7b <fd_lookup+0x39>
+
+0000000000801d8d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d8d:	55                   	push   %rbp
+  801d8e:	48 89 e5             	mov    %rsp,%rbp
+  801d91:	41 54                	push   %r12
+  801d93:	53                   	push   %rbx
+  801d94:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d97:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  801d9e:	00 00 00 
+  801da1:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801da8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801dab:	39 3b                	cmp    %edi,(%rbx)
+  801dad:	74 47                	je     801df6 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801daf:	48 83 c0 08          	add    $0x8,%rax
+  801db3:	48 8b 18             	mov    (%rax),%rbx
+  801db6:	48 85 db             	test   %rbx,%rbx
+  801db9:	75 f0                	jne    801dab <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801dbb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801dc2:	00 00 00 
+  801dc5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dcb:	89 fa                	mov    %edi,%edx
+  801dcd:	48 bf e8 55 80 00 00 	movabs $0x8055e8,%rdi
+  801dd4:	00 00 00 
+  801dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ddc:	48 b9 c6 01 80 00 00 	movabs $0x8001c6,%rcx
+  801de3:	00 00 00 
+  801de6:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801de8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ded:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801df1:	5b                   	pop    %rbx
+  801df2:	41 5c                	pop    %r12
+  801df4:	5d                   	pop    %rbp
+  801df5:	c3                   	ret
+            return 0;
+  801df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dfb:	eb f0                	jmp    801ded <dev_lookup+0x60>
+
+0000000000801dfd <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801dfd:	55                   	push   %rbp
+  801dfe:	48 89 e5             	mov    %rsp,%rbp
+  801e01:	41 55                	push   %r13
+  801e03:	41 54                	push   %r12
+  801e05:	53                   	push   %rbx
+  801e06:	48 83 ec 18          	sub    $0x18,%rsp
+  801e0a:	48 89 fb             	mov    %rdi,%rbx
+  801e0d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e10:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801e17:	ff ff ff 
+  801e1a:	48 01 df             	add    %rbx,%rdi
+  801e1d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801e21:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e25:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  801e2c:	00 00 00 
+  801e2f:	ff d0                	call   *%rax
+  801e31:	41 89 c5             	mov    %eax,%r13d
+  801e34:	85 c0                	test   %eax,%eax
+  801e36:	78 06                	js     801e3e <fd_close+0x41>
+  801e38:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801e3c:	74 1a                	je     801e58 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801e3e:	45 84 e4             	test   %r12b,%r12b
+  801e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e46:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801e4a:	44 89 e8             	mov    %r13d,%eax
+  801e4d:	48 83 c4 18          	add    $0x18,%rsp
+  801e51:	5b                   	pop    %rbx
+  801e52:	41 5c                	pop    %r12
+  801e54:	41 5d                	pop    %r13
+  801e56:	5d                   	pop    %rbp
+  801e57:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e58:	8b 3b                	mov    (%rbx),%edi
+  801e5a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e5e:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  801e65:	00 00 00 
+  801e68:	ff d0                	call   *%rax
+  801e6a:	41 89 c5             	mov    %eax,%r13d
+  801e6d:	85 c0                	test   %eax,%eax
+  801e6f:	78 1b                	js     801e8c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e75:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e79:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e7f:	48 85 c0             	test   %rax,%rax
+  801e82:	74 08                	je     801e8c <fd_close+0x8f>
+  801e84:	48 89 df             	mov    %rbx,%rdi
+  801e87:	ff d0                	call   *%rax
+  801e89:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e91:	48 89 de             	mov    %rbx,%rsi
+  801e94:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e99:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  801ea0:	00 00 00 
+  801ea3:	ff d0                	call   *%rax
+    return res;
+  801ea5:	eb a3                	jmp    801e4a <fd_close+0x4d>
+
+0000000000801ea7 <close>:
+
+int
+close(int fdnum) {
+  801ea7:	55                   	push   %rbp
+  801ea8:	48 89 e5             	mov    %rsp,%rbp
+  801eab:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801eaf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801eb3:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  801eba:	00 00 00 
+  801ebd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ebf:	85 c0                	test   %eax,%eax
+  801ec1:	78 15                	js     801ed8 <close+0x31>
+
+    return fd_close(fd, 1);
+  801ec3:	be 01 00 00 00       	mov    $0x1,%esi
+  801ec8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ecc:	48 b8 fd 1d 80 00 00 	movabs $0x801dfd,%rax
+  801ed3:	00 00 00 
+  801ed6:	ff d0                	call   *%rax
+}
+  801ed8:	c9                   	leave
+  801ed9:	c3                   	ret
+
+0000000000801eda <close_all>:
+
+void
+close_all(void) {
+  801eda:	55                   	push   %rbp
+  801edb:	48 89 e5             	mov    %rsp,%rbp
+  801ede:	41 54                	push   %r12
+  801ee0:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ee1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ee6:	49 bc a7 1e 80 00 00 	movabs $0x801ea7,%r12
+  801eed:	00 00 00 
+  801ef0:	89 df                	mov    %ebx,%edi
+  801ef2:	41 ff d4             	call   *%r12
+  801ef5:	83 c3 01             	add    $0x1,%ebx
+  801ef8:	83 fb 20             	cmp    $0x20,%ebx
+  801efb:	75 f3                	jne    801ef0 <close_all+0x16>
+}
+  801efd:	5b                   	pop    %rbx
+  801efe:	41 5c                	pop    %r12
+  801f00:	5d                   	pop    %rbp
+  801f01:	c3                   	ret
+
+0000000000801f02 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801f02:	55                   	push   %rbp
+  801f03:	48 89 e5             	mov    %rsp,%rbp
+  801f06:	41 57                	push   %r15
+  801f08:	41 56                	push   %r14
+  801f0a:	41 55                	push   %r13
+  801f0c:	41 54                	push   %r12
+  801f0e:	53                   	push   %rbx
+  801f0f:	48 83 ec 18          	sub    $0x18,%rsp
+  801f13:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801f16:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801f1a:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  801f21:	00 00 00 
+  801f24:	ff d0                	call   *%rax
+  801f26:	89 c3                	mov    %eax,%ebx
+  801f28:	85 c0                	test   %eax,%eax
+  801f2a:	0f 88 b8 00 00 00    	js     801fe8 <dup+0xe6>
+    close(newfdnum);
+  801f30:	44 89 e7             	mov    %r12d,%edi
+  801f33:	48 b8 a7 1e 80 00 00 	movabs $0x801ea7,%rax
+  801f3a:	00 00 00 
+  801f3d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801f3f:	4d 63 ec             	movslq %r12d,%r13
+  801f42:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801f49:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801f4d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801f51:	4c 89 ff             	mov    %r15,%rdi
+  801f54:	49 be c6 1c 80 00 00 	movabs $0x801cc6,%r14
+  801f5b:	00 00 00 
+  801f5e:	41 ff d6             	call   *%r14
+  801f61:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801f64:	4c 89 ef             	mov    %r13,%rdi
+  801f67:	41 ff d6             	call   *%r14
+  801f6a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801f6d:	48 89 df             	mov    %rbx,%rdi
+  801f70:	48 b8 96 3b 80 00 00 	movabs $0x803b96,%rax
+  801f77:	00 00 00 
+  801f7a:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801f7c:	a8 04                	test   $0x4,%al
+  801f7e:	74 2b                	je     801fab <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801f80:	41 89 c1             	mov    %eax,%r9d
+  801f83:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f89:	4c 89 f1             	mov    %r14,%rcx
+  801f8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f91:	48 89 de             	mov    %rbx,%rsi
+  801f94:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f99:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  801fa0:	00 00 00 
+  801fa3:	ff d0                	call   *%rax
+  801fa5:	89 c3                	mov    %eax,%ebx
+  801fa7:	85 c0                	test   %eax,%eax
+  801fa9:	78 4e                	js     801ff9 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801fab:	4c 89 ff             	mov    %r15,%rdi
+  801fae:	48 b8 96 3b 80 00 00 	movabs $0x803b96,%rax
+  801fb5:	00 00 00 
+  801fb8:	ff d0                	call   *%rax
+  801fba:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801fbd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fc3:	4c 89 e9             	mov    %r13,%rcx
+  801fc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fcb:	4c 89 fe             	mov    %r15,%rsi
+  801fce:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fd3:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  801fda:	00 00 00 
+  801fdd:	ff d0                	call   *%rax
+  801fdf:	89 c3                	mov    %eax,%ebx
+  801fe1:	85 c0                	test   %eax,%eax
+  801fe3:	78 14                	js     801ff9 <dup+0xf7>
+
+    return newfdnum;
+  801fe5:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801fe8:	89 d8                	mov    %ebx,%eax
+  801fea:	48 83 c4 18          	add    $0x18,%rsp
+  801fee:	5b                   	pop    %rbx
+  801fef:	41 5c                	pop    %r12
+  801ff1:	41 5d                	pop    %r13
+  801ff3:	41 5e                	pop    %r14
+  801ff5:	41 5f                	pop    %r15
+  801ff7:	5d                   	pop    %rbp
+  801ff8:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ff9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ffe:	4c 89 ee             	mov    %r13,%rsi
+  802001:	bf 00 00 00 00       	mov    $0x0,%edi
+  802006:	49 bc 7d 14 80 00 00 	movabs $0x80147d,%r12
+  80200d:	00 00 00 
+  802010:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802013:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802018:	4c 89 f6             	mov    %r14,%rsi
+  80201b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802020:	41 ff d4             	call   *%r12
+    return res;
+  802023:	eb c3                	jmp    801fe8 <dup+0xe6>
+
+0000000000802025 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802025:	55                   	push   %rbp
+  802026:	48 89 e5             	mov    %rsp,%rbp
+  802029:	41 56                	push   %r14
+  80202b:	41 55                	push   %r13
+  80202d:	41 54                	push   %r12
+  80202f:	53                   	push   %rbx
+  802030:	48 83 ec 10          	sub    $0x10,%rsp
+  802034:	89 fb                	mov    %edi,%ebx
+  802036:	49 89 f4             	mov    %rsi,%r12
+  802039:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80203c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802040:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	78 4c                	js     80209c <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802050:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802054:	41 8b 3e             	mov    (%r14),%edi
+  802057:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80205b:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  802062:	00 00 00 
+  802065:	ff d0                	call   *%rax
+  802067:	85 c0                	test   %eax,%eax
+  802069:	78 35                	js     8020a0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80206b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80206f:	83 e0 03             	and    $0x3,%eax
+  802072:	83 f8 01             	cmp    $0x1,%eax
+  802075:	74 2d                	je     8020a4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802077:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80207b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80207f:	48 85 c0             	test   %rax,%rax
+  802082:	74 56                	je     8020da <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802084:	4c 89 ea             	mov    %r13,%rdx
+  802087:	4c 89 e6             	mov    %r12,%rsi
+  80208a:	4c 89 f7             	mov    %r14,%rdi
+  80208d:	ff d0                	call   *%rax
+}
+  80208f:	48 83 c4 10          	add    $0x10,%rsp
+  802093:	5b                   	pop    %rbx
+  802094:	41 5c                	pop    %r12
+  802096:	41 5d                	pop    %r13
+  802098:	41 5e                	pop    %r14
+  80209a:	5d                   	pop    %rbp
+  80209b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80209c:	48 98                	cltq
+  80209e:	eb ef                	jmp    80208f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020a0:	48 98                	cltq
+  8020a2:	eb eb                	jmp    80208f <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020a4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020ab:	00 00 00 
+  8020ae:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020b4:	89 da                	mov    %ebx,%edx
+  8020b6:	48 bf 29 56 80 00 00 	movabs $0x805629,%rdi
+  8020bd:	00 00 00 
+  8020c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c5:	48 b9 c6 01 80 00 00 	movabs $0x8001c6,%rcx
+  8020cc:	00 00 00 
+  8020cf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020d1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020d8:	eb b5                	jmp    80208f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020da:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020e1:	eb ac                	jmp    80208f <read+0x6a>
+
+00000000008020e3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8020e3:	55                   	push   %rbp
+  8020e4:	48 89 e5             	mov    %rsp,%rbp
+  8020e7:	41 57                	push   %r15
+  8020e9:	41 56                	push   %r14
+  8020eb:	41 55                	push   %r13
+  8020ed:	41 54                	push   %r12
+  8020ef:	53                   	push   %rbx
+  8020f0:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8020f4:	48 85 d2             	test   %rdx,%rdx
+  8020f7:	74 54                	je     80214d <readn+0x6a>
+  8020f9:	41 89 fd             	mov    %edi,%r13d
+  8020fc:	49 89 f6             	mov    %rsi,%r14
+  8020ff:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802102:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802107:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80210c:	49 bf 25 20 80 00 00 	movabs $0x802025,%r15
+  802113:	00 00 00 
+  802116:	4c 89 e2             	mov    %r12,%rdx
+  802119:	48 29 f2             	sub    %rsi,%rdx
+  80211c:	4c 01 f6             	add    %r14,%rsi
+  80211f:	44 89 ef             	mov    %r13d,%edi
+  802122:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802125:	85 c0                	test   %eax,%eax
+  802127:	78 20                	js     802149 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802129:	01 c3                	add    %eax,%ebx
+  80212b:	85 c0                	test   %eax,%eax
+  80212d:	74 08                	je     802137 <readn+0x54>
+  80212f:	48 63 f3             	movslq %ebx,%rsi
+  802132:	4c 39 e6             	cmp    %r12,%rsi
+  802135:	72 df                	jb     802116 <readn+0x33>
+    }
+    return res;
+  802137:	48 63 c3             	movslq %ebx,%rax
+}
+  80213a:	48 83 c4 08          	add    $0x8,%rsp
+  80213e:	5b                   	pop    %rbx
+  80213f:	41 5c                	pop    %r12
+  802141:	41 5d                	pop    %r13
+  802143:	41 5e                	pop    %r14
+  802145:	41 5f                	pop    %r15
+  802147:	5d                   	pop    %rbp
+  802148:	c3                   	ret
+        if (inc < 0) return inc;
+  802149:	48 98                	cltq
+  80214b:	eb ed                	jmp    80213a <readn+0x57>
+    int inc = 1, res = 0;
+  80214d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802152:	eb e3                	jmp    802137 <readn+0x54>
+
+0000000000802154 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802154:	55                   	push   %rbp
+  802155:	48 89 e5             	mov    %rsp,%rbp
+  802158:	41 56                	push   %r14
+  80215a:	41 55                	push   %r13
+  80215c:	41 54                	push   %r12
+  80215e:	53                   	push   %rbx
+  80215f:	48 83 ec 10          	sub    $0x10,%rsp
+  802163:	89 fb                	mov    %edi,%ebx
+  802165:	49 89 f4             	mov    %rsi,%r12
+  802168:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80216b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80216f:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  802176:	00 00 00 
+  802179:	ff d0                	call   *%rax
+  80217b:	85 c0                	test   %eax,%eax
+  80217d:	78 47                	js     8021c6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80217f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802183:	41 8b 3e             	mov    (%r14),%edi
+  802186:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80218a:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  802191:	00 00 00 
+  802194:	ff d0                	call   *%rax
+  802196:	85 c0                	test   %eax,%eax
+  802198:	78 30                	js     8021ca <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80219a:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80219f:	74 2d                	je     8021ce <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021a5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8021a9:	48 85 c0             	test   %rax,%rax
+  8021ac:	74 56                	je     802204 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8021ae:	4c 89 ea             	mov    %r13,%rdx
+  8021b1:	4c 89 e6             	mov    %r12,%rsi
+  8021b4:	4c 89 f7             	mov    %r14,%rdi
+  8021b7:	ff d0                	call   *%rax
+}
+  8021b9:	48 83 c4 10          	add    $0x10,%rsp
+  8021bd:	5b                   	pop    %rbx
+  8021be:	41 5c                	pop    %r12
+  8021c0:	41 5d                	pop    %r13
+  8021c2:	41 5e                	pop    %r14
+  8021c4:	5d                   	pop    %rbp
+  8021c5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021c6:	48 98                	cltq
+  8021c8:	eb ef                	jmp    8021b9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021ca:	48 98                	cltq
+  8021cc:	eb eb                	jmp    8021b9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021ce:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021d5:	00 00 00 
+  8021d8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021de:	89 da                	mov    %ebx,%edx
+  8021e0:	48 bf 45 56 80 00 00 	movabs $0x805645,%rdi
+  8021e7:	00 00 00 
+  8021ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ef:	48 b9 c6 01 80 00 00 	movabs $0x8001c6,%rcx
+  8021f6:	00 00 00 
+  8021f9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021fb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802202:	eb b5                	jmp    8021b9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802204:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80220b:	eb ac                	jmp    8021b9 <write+0x65>
+
+000000000080220d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80220d:	55                   	push   %rbp
+  80220e:	48 89 e5             	mov    %rsp,%rbp
+  802211:	53                   	push   %rbx
+  802212:	48 83 ec 18          	sub    $0x18,%rsp
+  802216:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802218:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80221c:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  802223:	00 00 00 
+  802226:	ff d0                	call   *%rax
+  802228:	85 c0                	test   %eax,%eax
+  80222a:	78 0c                	js     802238 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80222c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802230:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802233:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802238:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80223c:	c9                   	leave
+  80223d:	c3                   	ret
+
+000000000080223e <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80223e:	55                   	push   %rbp
+  80223f:	48 89 e5             	mov    %rsp,%rbp
+  802242:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802246:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80224a:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  802251:	00 00 00 
+  802254:	ff d0                	call   *%rax
+  802256:	85 c0                	test   %eax,%eax
+  802258:	78 07                	js     802261 <tell+0x23>
+    return fdes->fd_offset;
+  80225a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80225e:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802261:	c9                   	leave
+  802262:	c3                   	ret
+
+0000000000802263 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802263:	55                   	push   %rbp
+  802264:	48 89 e5             	mov    %rsp,%rbp
+  802267:	41 55                	push   %r13
+  802269:	41 54                	push   %r12
+  80226b:	53                   	push   %rbx
+  80226c:	48 83 ec 18          	sub    $0x18,%rsp
+  802270:	89 fb                	mov    %edi,%ebx
+  802272:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802275:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802279:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  802280:	00 00 00 
+  802283:	ff d0                	call   *%rax
+  802285:	85 c0                	test   %eax,%eax
+  802287:	78 38                	js     8022c1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802289:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80228d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802291:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802295:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  80229c:	00 00 00 
+  80229f:	ff d0                	call   *%rax
+  8022a1:	85 c0                	test   %eax,%eax
+  8022a3:	78 1c                	js     8022c1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022a5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8022aa:	74 20                	je     8022cc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022b0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8022b4:	48 85 c0             	test   %rax,%rax
+  8022b7:	74 47                	je     802300 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8022b9:	44 89 e6             	mov    %r12d,%esi
+  8022bc:	4c 89 ef             	mov    %r13,%rdi
+  8022bf:	ff d0                	call   *%rax
+}
+  8022c1:	48 83 c4 18          	add    $0x18,%rsp
+  8022c5:	5b                   	pop    %rbx
+  8022c6:	41 5c                	pop    %r12
+  8022c8:	41 5d                	pop    %r13
+  8022ca:	5d                   	pop    %rbp
+  8022cb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8022cc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022d3:	00 00 00 
+  8022d6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022dc:	89 da                	mov    %ebx,%edx
+  8022de:	48 bf 08 56 80 00 00 	movabs $0x805608,%rdi
+  8022e5:	00 00 00 
+  8022e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ed:	48 b9 c6 01 80 00 00 	movabs $0x8001c6,%rcx
+  8022f4:	00 00 00 
+  8022f7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022fe:	eb c1                	jmp    8022c1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802300:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802305:	eb ba                	jmp    8022c1 <ftruncate+0x5e>
+
+0000000000802307 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802307:	55                   	push   %rbp
+  802308:	48 89 e5             	mov    %rsp,%rbp
+  80230b:	41 54                	push   %r12
+  80230d:	53                   	push   %rbx
+  80230e:	48 83 ec 10          	sub    $0x10,%rsp
+  802312:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802315:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802319:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  802320:	00 00 00 
+  802323:	ff d0                	call   *%rax
+  802325:	85 c0                	test   %eax,%eax
+  802327:	78 4e                	js     802377 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802329:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80232d:	41 8b 3c 24          	mov    (%r12),%edi
+  802331:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802335:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  80233c:	00 00 00 
+  80233f:	ff d0                	call   *%rax
+  802341:	85 c0                	test   %eax,%eax
+  802343:	78 32                	js     802377 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802345:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802349:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80234e:	74 30                	je     802380 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802350:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802353:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80235a:	00 00 00 
+    stat->st_isdir = 0;
+  80235d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802364:	00 00 00 
+    stat->st_dev = dev;
+  802367:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80236e:	48 89 de             	mov    %rbx,%rsi
+  802371:	4c 89 e7             	mov    %r12,%rdi
+  802374:	ff 50 28             	call   *0x28(%rax)
+}
+  802377:	48 83 c4 10          	add    $0x10,%rsp
+  80237b:	5b                   	pop    %rbx
+  80237c:	41 5c                	pop    %r12
+  80237e:	5d                   	pop    %rbp
+  80237f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802380:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802385:	eb f0                	jmp    802377 <fstat+0x70>
+
+0000000000802387 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802387:	55                   	push   %rbp
+  802388:	48 89 e5             	mov    %rsp,%rbp
+  80238b:	41 54                	push   %r12
+  80238d:	53                   	push   %rbx
+  80238e:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802395:	41 89 fc             	mov    %edi,%r12d
+  802398:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80239a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80239e:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  8023a5:	00 00 00 
+  8023a8:	ff d0                	call   *%rax
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	78 31                	js     8023df <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8023ae:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8023b5:	44 89 e7             	mov    %r12d,%edi
+  8023b8:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  8023bf:	00 00 00 
+  8023c2:	ff d0                	call   *%rax
+  8023c4:	85 c0                	test   %eax,%eax
+  8023c6:	78 17                	js     8023df <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8023c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023cc:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8023cf:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8023d2:	39 d3                	cmp    %edx,%ebx
+  8023d4:	0f 4f da             	cmovg  %edx,%ebx
+  8023d7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023df:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8023e6:	5b                   	pop    %rbx
+  8023e7:	41 5c                	pop    %r12
+  8023e9:	5d                   	pop    %rbp
+  8023ea:	c3                   	ret
+
+00000000008023eb <seektoend>:
+{
+  8023eb:	55                   	push   %rbp
+  8023ec:	48 89 e5             	mov    %rsp,%rbp
+  8023ef:	53                   	push   %rbx
+  8023f0:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8023f7:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8023f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023fd:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  802404:	00 00 00 
+  802407:	ff d0                	call   *%rax
+  802409:	85 c0                	test   %eax,%eax
+  80240b:	78 28                	js     802435 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80240d:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802414:	89 df                	mov    %ebx,%edi
+  802416:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  80241d:	00 00 00 
+  802420:	ff d0                	call   *%rax
+  802422:	85 c0                	test   %eax,%eax
+  802424:	78 0f                	js     802435 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802426:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802429:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80242d:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802430:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802435:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+000000000080243b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80243b:	55                   	push   %rbp
+  80243c:	48 89 e5             	mov    %rsp,%rbp
+  80243f:	41 54                	push   %r12
+  802441:	53                   	push   %rbx
+  802442:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802445:	be 00 00 00 00       	mov    $0x0,%esi
+  80244a:	48 b8 2e 30 80 00 00 	movabs $0x80302e,%rax
+  802451:	00 00 00 
+  802454:	ff d0                	call   *%rax
+  802456:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	78 25                	js     802481 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80245c:	4c 89 e6             	mov    %r12,%rsi
+  80245f:	89 c7                	mov    %eax,%edi
+  802461:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  802468:	00 00 00 
+  80246b:	ff d0                	call   *%rax
+  80246d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802470:	89 df                	mov    %ebx,%edi
+  802472:	48 b8 a7 1e 80 00 00 	movabs $0x801ea7,%rax
+  802479:	00 00 00 
+  80247c:	ff d0                	call   *%rax
+
+    return res;
+  80247e:	44 89 e3             	mov    %r12d,%ebx
+}
+  802481:	89 d8                	mov    %ebx,%eax
+  802483:	5b                   	pop    %rbx
+  802484:	41 5c                	pop    %r12
+  802486:	5d                   	pop    %rbp
+  802487:	c3                   	ret
+
+0000000000802488 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802488:	55                   	push   %rbp
+  802489:	48 89 e5             	mov    %rsp,%rbp
+  80248c:	53                   	push   %rbx
+  80248d:	48 83 ec 08          	sub    $0x8,%rsp
+  802491:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802494:	48 b8 b4 1c 80 00 00 	movabs $0x801cb4,%rax
+  80249b:	00 00 00 
+  80249e:	ff d0                	call   *%rax
+  8024a0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8024a4:	0f 87 ea 00 00 00    	ja     802594 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8024aa:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024b1:	00 00 00 
+  8024b4:	80 38 00             	cmpb   $0x0,(%rax)
+  8024b7:	75 35                	jne    8024ee <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8024b9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8024be:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8024c3:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8024c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024cd:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  8024d4:	00 00 00 
+  8024d7:	ff d0                	call   *%rax
+  8024d9:	85 c0                	test   %eax,%eax
+  8024db:	0f 88 ba 00 00 00    	js     80259b <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8024e1:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024e8:	00 00 00 
+  8024eb:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8024ee:	48 89 df             	mov    %rbx,%rdi
+  8024f1:	48 b8 b4 1c 80 00 00 	movabs $0x801cb4,%rax
+  8024f8:	00 00 00 
+  8024fb:	ff d0                	call   *%rax
+  8024fd:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802501:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802508:	00 00 00 
+  80250b:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80250f:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802512:	39 39                	cmp    %edi,(%rcx)
+  802514:	74 46                	je     80255c <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802516:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80251a:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802521:	00 
+  802522:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802529:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802530:	00 
+  802531:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802538:	00 
+  802539:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802540:	00 
+  802541:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802548:	00 
+  802549:	89 39                	mov    %edi,(%rcx)
+  80254b:	48 01 c6             	add    %rax,%rsi
+  80254e:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802553:	48 89 c8             	mov    %rcx,%rax
+  802556:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80255a:	c9                   	leave
+  80255b:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80255c:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802560:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802567:	00 00 00 
+  80256a:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80256d:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802571:	74 e0                	je     802553 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802573:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80257a:	00 
+  80257b:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80257f:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802586:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802588:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80258b:	48 01 c2             	add    %rax,%rdx
+  80258e:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802592:	eb bf                	jmp    802553 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802594:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802599:	eb b8                	jmp    802553 <fbuf_get+0xcb>
+            return NULL;
+  80259b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a0:	eb b1                	jmp    802553 <fbuf_get+0xcb>
+
+00000000008025a2 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8025a2:	55                   	push   %rbp
+  8025a3:	48 89 e5             	mov    %rsp,%rbp
+  8025a6:	53                   	push   %rbx
+  8025a7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8025ab:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025b2:	00 00 00 
+  8025b5:	48 8b 18             	mov    (%rax),%rbx
+  8025b8:	48 85 db             	test   %rbx,%rbx
+  8025bb:	74 16                	je     8025d3 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8025bd:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025c4:	00 00 00 
+  8025c7:	48 8b 18             	mov    (%rax),%rbx
+}
+  8025ca:	48 89 d8             	mov    %rbx,%rax
+  8025cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025d1:	c9                   	leave
+  8025d2:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8025d3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8025d8:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8025dd:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8025e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025e7:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  8025ee:	00 00 00 
+  8025f1:	ff d0                	call   *%rax
+  8025f3:	85 c0                	test   %eax,%eax
+  8025f5:	78 d3                	js     8025ca <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8025f7:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8025fc:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802603:	00 00 00 
+  802606:	eb b5                	jmp    8025bd <fsipc_bulk+0x1b>
+
+0000000000802608 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802608:	55                   	push   %rbp
+  802609:	48 89 e5             	mov    %rsp,%rbp
+  80260c:	41 57                	push   %r15
+  80260e:	41 56                	push   %r14
+  802610:	41 55                	push   %r13
+  802612:	41 54                	push   %r12
+  802614:	53                   	push   %rbx
+  802615:	48 83 ec 08          	sub    $0x8,%rsp
+  802619:	41 89 fd             	mov    %edi,%r13d
+  80261c:	49 89 f6             	mov    %rsi,%r14
+  80261f:	49 89 d7             	mov    %rdx,%r15
+  802622:	48 89 cb             	mov    %rcx,%rbx
+  802625:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802628:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80262f:	00 00 00 
+  802632:	83 38 00             	cmpl   $0x0,(%rax)
+  802635:	74 52                	je     802689 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802637:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80263d:	4c 89 f9             	mov    %r15,%rcx
+  802640:	4c 89 f2             	mov    %r14,%rdx
+  802643:	44 89 ee             	mov    %r13d,%esi
+  802646:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80264d:	00 00 00 
+  802650:	8b 38                	mov    (%rax),%edi
+  802652:	48 b8 90 41 80 00 00 	movabs $0x804190,%rax
+  802659:	00 00 00 
+  80265c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80265e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802663:	4c 89 e2             	mov    %r12,%rdx
+  802666:	48 89 de             	mov    %rbx,%rsi
+  802669:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266e:	48 b8 e0 3f 80 00 00 	movabs $0x803fe0,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+}
+  80267a:	48 83 c4 08          	add    $0x8,%rsp
+  80267e:	5b                   	pop    %rbx
+  80267f:	41 5c                	pop    %r12
+  802681:	41 5d                	pop    %r13
+  802683:	41 5e                	pop    %r14
+  802685:	41 5f                	pop    %r15
+  802687:	5d                   	pop    %rbp
+  802688:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802689:	bf 03 00 00 00       	mov    $0x3,%edi
+  80268e:	48 b8 33 42 80 00 00 	movabs $0x804233,%rax
+  802695:	00 00 00 
+  802698:	ff d0                	call   *%rax
+  80269a:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8026a1:	00 00 
+  8026a3:	eb 92                	jmp    802637 <fsipc_region+0x2f>
+
+00000000008026a5 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8026a5:	55                   	push   %rbp
+  8026a6:	48 89 e5             	mov    %rsp,%rbp
+  8026a9:	41 57                	push   %r15
+  8026ab:	41 56                	push   %r14
+  8026ad:	41 55                	push   %r13
+  8026af:	41 54                	push   %r12
+  8026b1:	53                   	push   %rbx
+  8026b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8026b6:	49 89 ff             	mov    %rdi,%r15
+  8026b9:	49 89 f6             	mov    %rsi,%r14
+  8026bc:	48 89 d3             	mov    %rdx,%rbx
+  8026bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026c3:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8026c6:	48 b8 a2 25 80 00 00 	movabs $0x8025a2,%rax
+  8026cd:	00 00 00 
+  8026d0:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8026d2:	48 85 c0             	test   %rax,%rax
+  8026d5:	0f 84 cc 00 00 00    	je     8027a7 <devfile_write_direct+0x102>
+  8026db:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8026de:	48 85 db             	test   %rbx,%rbx
+  8026e1:	0f 84 ba 00 00 00    	je     8027a1 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8026e7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8026ed:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8026f4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8026f8:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8026fc:	4c 29 e3             	sub    %r12,%rbx
+  8026ff:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802704:	48 39 c3             	cmp    %rax,%rbx
+  802707:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80270b:	48 89 da             	mov    %rbx,%rdx
+  80270e:	4c 89 f6             	mov    %r14,%rsi
+  802711:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802715:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  80271c:	00 00 00 
+  80271f:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802721:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802725:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802729:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80272c:	44 01 e0             	add    %r12d,%eax
+  80272f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802733:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802737:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80273e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802745:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80274c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802752:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802757:	4c 89 ee             	mov    %r13,%rsi
+  80275a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80275f:	48 b8 08 26 80 00 00 	movabs $0x802608,%rax
+  802766:	00 00 00 
+  802769:	ff d0                	call   *%rax
+        if (res < 0)
+  80276b:	85 c0                	test   %eax,%eax
+  80276d:	78 29                	js     802798 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80276f:	74 2b                	je     80279c <devfile_write_direct+0xf7>
+        i += res;
+  802771:	48 98                	cltq
+  802773:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802776:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802779:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80277d:	49 39 c4             	cmp    %rax,%r12
+  802780:	0f 82 72 ff ff ff    	jb     8026f8 <devfile_write_direct+0x53>
+    return i;
+  802786:	4c 89 e0             	mov    %r12,%rax
+}
+  802789:	48 83 c4 28          	add    $0x28,%rsp
+  80278d:	5b                   	pop    %rbx
+  80278e:	41 5c                	pop    %r12
+  802790:	41 5d                	pop    %r13
+  802792:	41 5e                	pop    %r14
+  802794:	41 5f                	pop    %r15
+  802796:	5d                   	pop    %rbp
+  802797:	c3                   	ret
+            return res;
+  802798:	48 98                	cltq
+  80279a:	eb ed                	jmp    802789 <devfile_write_direct+0xe4>
+            return i;
+  80279c:	4c 89 e0             	mov    %r12,%rax
+  80279f:	eb e8                	jmp    802789 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8027a1:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8027a5:	eb df                	jmp    802786 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8027a7:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8027ae:	eb d9                	jmp    802789 <devfile_write_direct+0xe4>
+
+00000000008027b0 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8027b0:	55                   	push   %rbp
+  8027b1:	48 89 e5             	mov    %rsp,%rbp
+  8027b4:	41 56                	push   %r14
+  8027b6:	41 55                	push   %r13
+  8027b8:	41 54                	push   %r12
+  8027ba:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8027bb:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8027bf:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8027c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c8:	4d 39 ee             	cmp    %r13,%r14
+  8027cb:	0f 84 99 00 00 00    	je     80286a <fbuf_flush+0xba>
+  8027d1:	49 89 fc             	mov    %rdi,%r12
+  8027d4:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8027d7:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8027da:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8027de:	48 b8 b4 1c 80 00 00 	movabs $0x801cb4,%rax
+  8027e5:	00 00 00 
+  8027e8:	ff d0                	call   *%rax
+  8027ea:	48 89 c2             	mov    %rax,%rdx
+  8027ed:	48 c1 e2 04          	shl    $0x4,%rdx
+  8027f1:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8027f5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8027f9:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8027fe:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802801:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802805:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80280c:	00 
+  80280d:	44 89 f1             	mov    %r14d,%ecx
+  802810:	4c 89 ea             	mov    %r13,%rdx
+  802813:	4c 89 e7             	mov    %r12,%rdi
+  802816:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  80281d:	00 00 00 
+  802820:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802822:	48 85 c0             	test   %rax,%rax
+  802825:	78 43                	js     80286a <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802827:	4c 39 e8             	cmp    %r13,%rax
+  80282a:	72 47                	jb     802873 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80282c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802831:	83 c0 01             	add    $0x1,%eax
+  802834:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802839:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80283c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802840:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802844:	72 0f                	jb     802855 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802846:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80284a:	48 39 c2             	cmp    %rax,%rdx
+  80284d:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802851:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802855:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80285c:	00 
+  80285d:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802864:	00 
+    return 0;
+  802865:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80286a:	5b                   	pop    %rbx
+  80286b:	41 5c                	pop    %r12
+  80286d:	41 5d                	pop    %r13
+  80286f:	41 5e                	pop    %r14
+  802871:	5d                   	pop    %rbp
+  802872:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802873:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802878:	eb f0                	jmp    80286a <fbuf_flush+0xba>
+
+000000000080287a <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80287a:	55                   	push   %rbp
+  80287b:	48 89 e5             	mov    %rsp,%rbp
+  80287e:	53                   	push   %rbx
+  80287f:	48 83 ec 08          	sub    $0x8,%rsp
+  802883:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802886:	48 b8 88 24 80 00 00 	movabs $0x802488,%rax
+  80288d:	00 00 00 
+  802890:	ff d0                	call   *%rax
+  802892:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289a:	48 85 f6             	test   %rsi,%rsi
+  80289d:	74 0f                	je     8028ae <devfile_sync+0x34>
+  80289f:	48 89 df             	mov    %rbx,%rdi
+  8028a2:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  8028a9:	00 00 00 
+  8028ac:	ff d0                	call   *%rax
+}
+  8028ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b2:	c9                   	leave
+  8028b3:	c3                   	ret
+
+00000000008028b4 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8028b4:	55                   	push   %rbp
+  8028b5:	48 89 e5             	mov    %rsp,%rbp
+  8028b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8028bc:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8028bf:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8028c6:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8028c7:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8028cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028d0:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8028d7:	00 00 00 
+  8028da:	48 b8 08 26 80 00 00 	movabs $0x802608,%rax
+  8028e1:	00 00 00 
+  8028e4:	ff d0                	call   *%rax
+}
+  8028e6:	c9                   	leave
+  8028e7:	c3                   	ret
+
+00000000008028e8 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8028e8:	55                   	push   %rbp
+  8028e9:	48 89 e5             	mov    %rsp,%rbp
+  8028ec:	41 54                	push   %r12
+  8028ee:	53                   	push   %rbx
+  8028ef:	48 89 fb             	mov    %rdi,%rbx
+  8028f2:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8028f5:	48 b8 7a 28 80 00 00 	movabs $0x80287a,%rax
+  8028fc:	00 00 00 
+  8028ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802901:	85 c0                	test   %eax,%eax
+  802903:	78 63                	js     802968 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802905:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802908:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80290f:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802911:	be 00 00 00 00       	mov    $0x0,%esi
+  802916:	bf 05 00 00 00       	mov    $0x5,%edi
+  80291b:	48 b8 b4 28 80 00 00 	movabs $0x8028b4,%rax
+  802922:	00 00 00 
+  802925:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802927:	85 c0                	test   %eax,%eax
+  802929:	78 3d                	js     802968 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80292b:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802932:	00 00 00 
+  802935:	48 89 de             	mov    %rbx,%rsi
+  802938:	4c 89 e7             	mov    %r12,%rdi
+  80293b:	48 b8 3e 0b 80 00 00 	movabs $0x800b3e,%rax
+  802942:	00 00 00 
+  802945:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802947:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80294d:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802954:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802955:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80295b:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802962:	00 
+
+    return 0;
+  802963:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802968:	5b                   	pop    %rbx
+  802969:	41 5c                	pop    %r12
+  80296b:	5d                   	pop    %rbp
+  80296c:	c3                   	ret
+
+000000000080296d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80296d:	55                   	push   %rbp
+  80296e:	48 89 e5             	mov    %rsp,%rbp
+  802971:	41 54                	push   %r12
+  802973:	53                   	push   %rbx
+  802974:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802977:	48 b8 7a 28 80 00 00 	movabs $0x80287a,%rax
+  80297e:	00 00 00 
+  802981:	ff d0                	call   *%rax
+  802983:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802986:	48 89 df             	mov    %rbx,%rdi
+  802989:	48 b8 b4 1c 80 00 00 	movabs $0x801cb4,%rax
+  802990:	00 00 00 
+  802993:	ff d0                	call   *%rax
+  802995:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802999:	76 2e                	jbe    8029c9 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  80299b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80299e:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8029a5:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8029a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029b1:	48 b8 b4 28 80 00 00 	movabs $0x8028b4,%rax
+  8029b8:	00 00 00 
+  8029bb:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8029bd:	45 85 e4             	test   %r12d,%r12d
+  8029c0:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8029c4:	5b                   	pop    %rbx
+  8029c5:	41 5c                	pop    %r12
+  8029c7:	5d                   	pop    %rbp
+  8029c8:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8029c9:	48 89 df             	mov    %rbx,%rdi
+  8029cc:	48 b8 b4 1c 80 00 00 	movabs $0x801cb4,%rax
+  8029d3:	00 00 00 
+  8029d6:	ff d0                	call   *%rax
+  8029d8:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8029dc:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8029e3:	00 00 00 
+  8029e6:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8029ed:	48 89 df             	mov    %rbx,%rdi
+  8029f0:	48 b8 c6 1c 80 00 00 	movabs $0x801cc6,%rax
+  8029f7:	00 00 00 
+  8029fa:	ff d0                	call   *%rax
+  8029fc:	48 89 c6             	mov    %rax,%rsi
+  8029ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a04:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a09:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  802a10:	00 00 00 
+  802a13:	ff d0                	call   *%rax
+  802a15:	eb 84                	jmp    80299b <devfile_flush+0x2e>
+
+0000000000802a17 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802a17:	55                   	push   %rbp
+  802a18:	48 89 e5             	mov    %rsp,%rbp
+  802a1b:	41 55                	push   %r13
+  802a1d:	41 54                	push   %r12
+  802a1f:	53                   	push   %rbx
+  802a20:	48 83 ec 08          	sub    $0x8,%rsp
+  802a24:	48 89 fb             	mov    %rdi,%rbx
+  802a27:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802a2a:	48 b8 88 24 80 00 00 	movabs $0x802488,%rax
+  802a31:	00 00 00 
+  802a34:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802a36:	48 85 c0             	test   %rax,%rax
+  802a39:	74 51                	je     802a8c <devfile_trunc+0x75>
+  802a3b:	49 89 c4             	mov    %rax,%r12
+  802a3e:	48 89 c6             	mov    %rax,%rsi
+  802a41:	48 89 df             	mov    %rbx,%rdi
+  802a44:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  802a4b:	00 00 00 
+  802a4e:	ff d0                	call   *%rax
+  802a50:	85 c0                	test   %eax,%eax
+  802a52:	78 2d                	js     802a81 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a54:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802a5b:	00 00 00 
+  802a5e:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802a61:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802a63:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802a67:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a71:	48 b8 b4 28 80 00 00 	movabs $0x8028b4,%rax
+  802a78:	00 00 00 
+  802a7b:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802a7d:	85 c0                	test   %eax,%eax
+  802a7f:	79 3e                	jns    802abf <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802a81:	48 83 c4 08          	add    $0x8,%rsp
+  802a85:	5b                   	pop    %rbx
+  802a86:	41 5c                	pop    %r12
+  802a88:	41 5d                	pop    %r13
+  802a8a:	5d                   	pop    %rbp
+  802a8b:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a8c:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802a93:	00 00 00 
+  802a96:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802a99:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802a9b:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802a9f:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa4:	bf 02 00 00 00       	mov    $0x2,%edi
+  802aa9:	48 b8 b4 28 80 00 00 	movabs $0x8028b4,%rax
+  802ab0:	00 00 00 
+  802ab3:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ab5:	85 c0                	test   %eax,%eax
+  802ab7:	78 c8                	js     802a81 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ab9:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802abd:	eb c2                	jmp    802a81 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802abf:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802ac2:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ac5:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ac8:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802acd:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802ad4:	00 00 
+  802ad6:	eb a9                	jmp    802a81 <devfile_trunc+0x6a>
+
+0000000000802ad8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802ad8:	55                   	push   %rbp
+  802ad9:	48 89 e5             	mov    %rsp,%rbp
+  802adc:	41 57                	push   %r15
+  802ade:	41 56                	push   %r14
+  802ae0:	41 55                	push   %r13
+  802ae2:	41 54                	push   %r12
+  802ae4:	53                   	push   %rbx
+  802ae5:	48 83 ec 28          	sub    $0x28,%rsp
+  802ae9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802aed:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802af1:	49 89 d7             	mov    %rdx,%r15
+  802af4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802af8:	48 b8 88 24 80 00 00 	movabs $0x802488,%rax
+  802aff:	00 00 00 
+  802b02:	ff d0                	call   *%rax
+  802b04:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802b07:	48 85 c0             	test   %rax,%rax
+  802b0a:	74 31                	je     802b3d <devfile_write+0x65>
+  802b0c:	4c 89 f8             	mov    %r15,%rax
+  802b0f:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802b16:	77 25                	ja     802b3d <devfile_write+0x65>
+    size_t i = 0;
+  802b18:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802b1e:	48 85 c0             	test   %rax,%rax
+  802b21:	0f 85 64 01 00 00    	jne    802c8b <devfile_write+0x1b3>
+    size_t i = 0;
+  802b27:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802b2b:	4c 89 f8             	mov    %r15,%rax
+}
+  802b2e:	48 83 c4 28          	add    $0x28,%rsp
+  802b32:	5b                   	pop    %rbx
+  802b33:	41 5c                	pop    %r12
+  802b35:	41 5d                	pop    %r13
+  802b37:	41 5e                	pop    %r14
+  802b39:	41 5f                	pop    %r15
+  802b3b:	5d                   	pop    %rbp
+  802b3c:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802b3d:	48 85 db             	test   %rbx,%rbx
+  802b40:	74 5b                	je     802b9d <devfile_write+0xc5>
+  802b42:	48 89 de             	mov    %rbx,%rsi
+  802b45:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b49:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  802b50:	00 00 00 
+  802b53:	ff d0                	call   *%rax
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	78 40                	js     802b99 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802b59:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b5d:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802b60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b64:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802b68:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  802b6f:	00 00 00 
+  802b72:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802b74:	48 85 c0             	test   %rax,%rax
+  802b77:	7e b5                	jle    802b2e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802b79:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802b7d:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802b80:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802b83:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802b86:	8d 51 01             	lea    0x1(%rcx),%edx
+  802b89:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802b8c:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802b8f:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802b96:	00 
+  802b97:	eb 95                	jmp    802b2e <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802b99:	48 98                	cltq
+  802b9b:	eb 91                	jmp    802b2e <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802b9d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802ba1:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802ba4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ba8:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802bac:	48 89 df             	mov    %rbx,%rdi
+  802baf:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  802bb6:	00 00 00 
+  802bb9:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802bbb:	48 85 c0             	test   %rax,%rax
+  802bbe:	0f 8e 6a ff ff ff    	jle    802b2e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802bc4:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802bc7:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802bcb:	e9 5e ff ff ff       	jmp    802b2e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802bd0:	48 98                	cltq
+  802bd2:	4d 85 ff             	test   %r15,%r15
+  802bd5:	49 0f 45 c7          	cmovne %r15,%rax
+  802bd9:	e9 50 ff ff ff       	jmp    802b2e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802bde:	48 89 de             	mov    %rbx,%rsi
+  802be1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802be5:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  802bec:	00 00 00 
+  802bef:	ff d0                	call   *%rax
+  802bf1:	85 c0                	test   %eax,%eax
+  802bf3:	0f 88 2b 01 00 00    	js     802d24 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802bf9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802bfd:	4c 01 f8             	add    %r15,%rax
+  802c00:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c04:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c08:	48 b9 b4 1c 80 00 00 	movabs $0x801cb4,%rcx
+  802c0f:	00 00 00 
+  802c12:	ff d1                	call   *%rcx
+  802c14:	48 89 c2             	mov    %rax,%rdx
+  802c17:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c1b:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c1f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c23:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802c28:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802c2b:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802c32:	00 
+  802c33:	4c 89 ea             	mov    %r13,%rdx
+  802c36:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802c3a:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  802c41:	00 00 00 
+  802c44:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802c46:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c4a:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802c4e:	48 39 c2             	cmp    %rax,%rdx
+  802c51:	0f 84 db 00 00 00    	je     802d32 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802c57:	4c 39 e2             	cmp    %r12,%rdx
+  802c5a:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802c5e:	4d 01 ec             	add    %r13,%r12
+  802c61:	49 39 c4             	cmp    %rax,%r12
+  802c64:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802c68:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802c6c:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802c70:	45 01 ee             	add    %r13d,%r14d
+  802c73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c77:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802c7b:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802c7e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c82:	49 39 c7             	cmp    %rax,%r15
+  802c85:	0f 83 a0 fe ff ff    	jae    802b2b <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802c8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c8f:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802c93:	8b 43 08             	mov    0x8(%rbx),%eax
+  802c96:	44 39 f0             	cmp    %r14d,%eax
+  802c99:	7f 10                	jg     802cab <devfile_write+0x1d3>
+  802c9b:	48 98                	cltq
+  802c9d:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802ca3:	49 63 d6             	movslq %r14d,%rdx
+  802ca6:	48 39 d0             	cmp    %rdx,%rax
+  802ca9:	7d 2d                	jge    802cd8 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802cab:	48 89 de             	mov    %rbx,%rsi
+  802cae:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802cb2:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  802cb9:	00 00 00 
+  802cbc:	ff d0                	call   *%rax
+  802cbe:	85 c0                	test   %eax,%eax
+  802cc0:	0f 88 0a ff ff ff    	js     802bd0 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802cc6:	44 89 f0             	mov    %r14d,%eax
+  802cc9:	66 b8 00 00          	mov    $0x0,%ax
+  802ccd:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802cd0:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802cd7:	00 
+        size_t off = pos - fb->fb_base;
+  802cd8:	45 89 f4             	mov    %r14d,%r12d
+  802cdb:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802cdf:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802ce2:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802ce6:	4d 29 fd             	sub    %r15,%r13
+  802ce9:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802cee:	4c 29 e0             	sub    %r12,%rax
+  802cf1:	49 39 c5             	cmp    %rax,%r13
+  802cf4:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802cf8:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802cfc:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802d00:	48 39 c2             	cmp    %rax,%rdx
+  802d03:	0f 84 f0 fe ff ff    	je     802bf9 <devfile_write+0x121>
+  802d09:	4c 39 e0             	cmp    %r12,%rax
+  802d0c:	0f 82 cc fe ff ff    	jb     802bde <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802d12:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d16:	48 39 d0             	cmp    %rdx,%rax
+  802d19:	0f 83 da fe ff ff    	jae    802bf9 <devfile_write+0x121>
+  802d1f:	e9 ba fe ff ff       	jmp    802bde <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d24:	48 98                	cltq
+  802d26:	4d 85 ff             	test   %r15,%r15
+  802d29:	49 0f 45 c7          	cmovne %r15,%rax
+  802d2d:	e9 fc fd ff ff       	jmp    802b2e <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802d32:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d36:	4c 89 e2             	mov    %r12,%rdx
+  802d39:	e9 2a ff ff ff       	jmp    802c68 <devfile_write+0x190>
+
+0000000000802d3e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d3e:	55                   	push   %rbp
+  802d3f:	48 89 e5             	mov    %rsp,%rbp
+  802d42:	41 57                	push   %r15
+  802d44:	41 56                	push   %r14
+  802d46:	41 55                	push   %r13
+  802d48:	41 54                	push   %r12
+  802d4a:	53                   	push   %rbx
+  802d4b:	48 83 ec 28          	sub    $0x28,%rsp
+  802d4f:	49 89 ff             	mov    %rdi,%r15
+  802d52:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d56:	48 89 d3             	mov    %rdx,%rbx
+  802d59:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802d5d:	48 b8 88 24 80 00 00 	movabs $0x802488,%rax
+  802d64:	00 00 00 
+  802d67:	ff d0                	call   *%rax
+  802d69:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802d6c:	48 85 c0             	test   %rax,%rax
+  802d6f:	74 0d                	je     802d7e <devfile_read+0x40>
+  802d71:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802d78:	0f 86 1a 01 00 00    	jbe    802e98 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d7e:	4d 85 e4             	test   %r12,%r12
+  802d81:	74 1a                	je     802d9d <devfile_read+0x5f>
+  802d83:	4c 89 e6             	mov    %r12,%rsi
+  802d86:	4c 89 ff             	mov    %r15,%rdi
+  802d89:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  802d90:	00 00 00 
+  802d93:	ff d0                	call   *%rax
+  802d95:	85 c0                	test   %eax,%eax
+  802d97:	0f 88 e8 00 00 00    	js     802e85 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802d9d:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802da1:	48 b8 a2 25 80 00 00 	movabs $0x8025a2,%rax
+  802da8:	00 00 00 
+  802dab:	ff d0                	call   *%rax
+  802dad:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802db0:	48 85 c0             	test   %rax,%rax
+  802db3:	0f 84 69 02 00 00    	je     803022 <devfile_read+0x2e4>
+    while (i < n) {
+  802db9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802dbe:	0f 84 ce 00 00 00    	je     802e92 <devfile_read+0x154>
+    size_t i = 0;
+  802dc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802dc9:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802dd0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802dd4:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802dd8:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802ddc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802de0:	48 29 da             	sub    %rbx,%rdx
+  802de3:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802de8:	48 39 c2             	cmp    %rax,%rdx
+  802deb:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802def:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802df3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802df7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802dfa:	01 d8                	add    %ebx,%eax
+  802dfc:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802e00:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802e04:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802e0b:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e12:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802e19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e24:	4c 89 ee             	mov    %r13,%rsi
+  802e27:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e2c:	48 b8 08 26 80 00 00 	movabs $0x802608,%rax
+  802e33:	00 00 00 
+  802e36:	ff d0                	call   *%rax
+        if (res < 0)
+  802e38:	85 c0                	test   %eax,%eax
+  802e3a:	78 4d                	js     802e89 <devfile_read+0x14b>
+        if (res == 0)
+  802e3c:	74 4f                	je     802e8d <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802e3e:	4c 63 e0             	movslq %eax,%r12
+  802e41:	4c 89 e2             	mov    %r12,%rdx
+  802e44:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802e48:	4c 89 f7             	mov    %r14,%rdi
+  802e4b:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  802e52:	00 00 00 
+  802e55:	ff d0                	call   *%rax
+        i += res;
+  802e57:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  802e5a:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  802e5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e61:	48 39 c3             	cmp    %rax,%rbx
+  802e64:	0f 82 72 ff ff ff    	jb     802ddc <devfile_read+0x9e>
+    return i;
+  802e6a:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802e6d:	48 85 c0             	test   %rax,%rax
+  802e70:	7e 04                	jle    802e76 <devfile_read+0x138>
+  802e72:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  802e76:	48 83 c4 28          	add    $0x28,%rsp
+  802e7a:	5b                   	pop    %rbx
+  802e7b:	41 5c                	pop    %r12
+  802e7d:	41 5d                	pop    %r13
+  802e7f:	41 5e                	pop    %r14
+  802e81:	41 5f                	pop    %r15
+  802e83:	5d                   	pop    %rbp
+  802e84:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e85:	48 98                	cltq
+  802e87:	eb ed                	jmp    802e76 <devfile_read+0x138>
+            return res;
+  802e89:	48 98                	cltq
+  802e8b:	eb e9                	jmp    802e76 <devfile_read+0x138>
+            return i;
+  802e8d:	48 89 d8             	mov    %rbx,%rax
+  802e90:	eb db                	jmp    802e6d <devfile_read+0x12f>
+    size_t i = 0;
+  802e92:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802e96:	eb d2                	jmp    802e6a <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802e98:	48 89 c6             	mov    %rax,%rsi
+  802e9b:	4c 89 ff             	mov    %r15,%rdi
+  802e9e:	48 b8 b0 27 80 00 00 	movabs $0x8027b0,%rax
+  802ea5:	00 00 00 
+  802ea8:	ff d0                	call   *%rax
+  802eaa:	85 c0                	test   %eax,%eax
+  802eac:	78 40                	js     802eee <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802eae:	4c 89 ff             	mov    %r15,%rdi
+  802eb1:	48 b8 b4 1c 80 00 00 	movabs $0x801cb4,%rax
+  802eb8:	00 00 00 
+  802ebb:	ff d0                	call   *%rax
+  802ebd:	48 89 c2             	mov    %rax,%rdx
+  802ec0:	48 c1 e2 04          	shl    $0x4,%rdx
+  802ec4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802ec8:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ecc:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802ed1:	48 01 d0             	add    %rdx,%rax
+  802ed4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  802ed8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802edd:	0f 84 33 01 00 00    	je     803016 <devfile_read+0x2d8>
+    size_t i = 0;
+  802ee3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802ee9:	e9 f5 00 00 00       	jmp    802fe3 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802eee:	48 98                	cltq
+  802ef0:	eb 84                	jmp    802e76 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802ef2:	44 89 e8             	mov    %r13d,%eax
+  802ef5:	66 b8 00 00          	mov    $0x0,%ax
+  802ef9:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  802efe:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f05:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  802f07:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f0b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f0f:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  802f11:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802f16:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  802f19:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  802f20:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  802f21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f2c:	ba 00 10 01 00       	mov    $0x11000,%edx
+  802f31:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f36:	48 b8 08 26 80 00 00 	movabs $0x802608,%rax
+  802f3d:	00 00 00 
+  802f40:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  802f42:	85 c0                	test   %eax,%eax
+  802f44:	0f 88 be 00 00 00    	js     803008 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  802f4a:	48 63 d0             	movslq %eax,%rdx
+  802f4d:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  802f52:	41 03 44 24 08       	add    0x8(%r12),%eax
+  802f57:	44 39 e8             	cmp    %r13d,%eax
+  802f5a:	0f 8e ba 00 00 00    	jle    80301a <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  802f60:	49 63 c5             	movslq %r13d,%rax
+  802f63:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802f68:	48 29 c3             	sub    %rax,%rbx
+  802f6b:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  802f70:	48 01 c3             	add    %rax,%rbx
+  802f73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f77:	4c 29 f0             	sub    %r14,%rax
+  802f7a:	48 39 c3             	cmp    %rax,%rbx
+  802f7d:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802f81:	4c 89 ff             	mov    %r15,%rdi
+  802f84:	48 b9 b4 1c 80 00 00 	movabs $0x801cb4,%rcx
+  802f8b:	00 00 00 
+  802f8e:	ff d1                	call   *%rcx
+  802f90:	48 89 c2             	mov    %rax,%rdx
+  802f93:	48 c1 e2 04          	shl    $0x4,%rdx
+  802f97:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802f9b:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f9f:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  802fa4:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  802fa7:	44 89 ea             	mov    %r13d,%edx
+  802faa:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  802faf:	48 63 d2             	movslq %edx,%rdx
+  802fb2:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802fb9:	00 
+  802fba:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802fbe:	4c 01 f7             	add    %r14,%rdi
+  802fc1:	48 89 da             	mov    %rbx,%rdx
+  802fc4:	48 b9 33 0f 80 00 00 	movabs $0x800f33,%rcx
+  802fcb:	00 00 00 
+  802fce:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  802fd0:	41 01 dd             	add    %ebx,%r13d
+  802fd3:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  802fd7:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  802fda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fde:	49 39 c6             	cmp    %rax,%r14
+  802fe1:	73 37                	jae    80301a <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  802fe3:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  802fe7:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802fec:	44 39 e8             	cmp    %r13d,%eax
+  802fef:	0f 8f fd fe ff ff    	jg     802ef2 <devfile_read+0x1b4>
+  802ff5:	41 03 44 24 10       	add    0x10(%r12),%eax
+  802ffa:	44 39 e8             	cmp    %r13d,%eax
+  802ffd:	0f 8f 5d ff ff ff    	jg     802f60 <devfile_read+0x222>
+  803003:	e9 ea fe ff ff       	jmp    802ef2 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803008:	48 98                	cltq
+  80300a:	4d 85 f6             	test   %r14,%r14
+  80300d:	49 0f 45 c6          	cmovne %r14,%rax
+  803011:	e9 60 fe ff ff       	jmp    802e76 <devfile_read+0x138>
+    size_t i = 0;
+  803016:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80301a:	4c 89 f0             	mov    %r14,%rax
+  80301d:	e9 54 fe ff ff       	jmp    802e76 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803022:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803029:	e9 48 fe ff ff       	jmp    802e76 <devfile_read+0x138>
+
+000000000080302e <open>:
+open(const char *path, int mode) {
+  80302e:	55                   	push   %rbp
+  80302f:	48 89 e5             	mov    %rsp,%rbp
+  803032:	41 55                	push   %r13
+  803034:	41 54                	push   %r12
+  803036:	53                   	push   %rbx
+  803037:	48 83 ec 18          	sub    $0x18,%rsp
+  80303b:	49 89 fc             	mov    %rdi,%r12
+  80303e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803041:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  803048:	00 00 00 
+  80304b:	ff d0                	call   *%rax
+  80304d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803053:	0f 87 8a 00 00 00    	ja     8030e3 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803059:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80305d:	48 b8 e2 1c 80 00 00 	movabs $0x801ce2,%rax
+  803064:	00 00 00 
+  803067:	ff d0                	call   *%rax
+  803069:	89 c3                	mov    %eax,%ebx
+  80306b:	85 c0                	test   %eax,%eax
+  80306d:	78 50                	js     8030bf <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80306f:	4c 89 e6             	mov    %r12,%rsi
+  803072:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803079:	00 00 00 
+  80307c:	48 89 df             	mov    %rbx,%rdi
+  80307f:	48 b8 3e 0b 80 00 00 	movabs $0x800b3e,%rax
+  803086:	00 00 00 
+  803089:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80308b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803092:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803096:	bf 01 00 00 00       	mov    $0x1,%edi
+  80309b:	48 b8 b4 28 80 00 00 	movabs $0x8028b4,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+  8030a7:	89 c3                	mov    %eax,%ebx
+  8030a9:	85 c0                	test   %eax,%eax
+  8030ab:	78 1f                	js     8030cc <open+0x9e>
+    return fd2num(fd);
+  8030ad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030b1:	48 b8 b4 1c 80 00 00 	movabs $0x801cb4,%rax
+  8030b8:	00 00 00 
+  8030bb:	ff d0                	call   *%rax
+  8030bd:	89 c3                	mov    %eax,%ebx
+}
+  8030bf:	89 d8                	mov    %ebx,%eax
+  8030c1:	48 83 c4 18          	add    $0x18,%rsp
+  8030c5:	5b                   	pop    %rbx
+  8030c6:	41 5c                	pop    %r12
+  8030c8:	41 5d                	pop    %r13
+  8030ca:	5d                   	pop    %rbp
+  8030cb:	c3                   	ret
+        fd_close(fd, 0);
+  8030cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8030d1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030d5:	48 b8 fd 1d 80 00 00 	movabs $0x801dfd,%rax
+  8030dc:	00 00 00 
+  8030df:	ff d0                	call   *%rax
+        return res;
+  8030e1:	eb dc                	jmp    8030bf <open+0x91>
+        return -E_BAD_PATH;
+  8030e3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030e8:	eb d5                	jmp    8030bf <open+0x91>
+
+00000000008030ea <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8030ea:	55                   	push   %rbp
+  8030eb:	48 89 e5             	mov    %rsp,%rbp
+  8030ee:	41 57                	push   %r15
+  8030f0:	41 56                	push   %r14
+  8030f2:	41 55                	push   %r13
+  8030f4:	41 54                	push   %r12
+  8030f6:	53                   	push   %rbx
+  8030f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8030fb:	41 89 f6             	mov    %esi,%r14d
+  8030fe:	49 89 d7             	mov    %rdx,%r15
+  803101:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803104:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803108:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  80310f:	00 00 00 
+  803112:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803114:	85 c0                	test   %eax,%eax
+  803116:	0f 88 db 00 00 00    	js     8031f7 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80311c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803120:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803127:	00 00 00 
+  80312a:	8b 00                	mov    (%rax),%eax
+  80312c:	39 07                	cmp    %eax,(%rdi)
+  80312e:	0f 85 db 00 00 00    	jne    80320f <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803134:	45 85 f6             	test   %r14d,%r14d
+  803137:	0f 88 db 00 00 00    	js     803218 <fmap+0x12e>
+  80313d:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803144:	0f 85 d7 00 00 00    	jne    803221 <fmap+0x137>
+  80314a:	4c 89 fb             	mov    %r15,%rbx
+  80314d:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803153:	0f 85 d1 00 00 00    	jne    80322a <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803159:	48 b8 7a 28 80 00 00 	movabs $0x80287a,%rax
+  803160:	00 00 00 
+  803163:	ff d0                	call   *%rax
+  803165:	85 c0                	test   %eax,%eax
+  803167:	0f 88 8e 00 00 00    	js     8031fb <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80316d:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803174:	00 00 00 
+    while (i < n) {
+  803177:	4d 85 ed             	test   %r13,%r13
+  80317a:	0f 84 8a 00 00 00    	je     80320a <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803180:	4c 89 ea             	mov    %r13,%rdx
+  803183:	48 29 da             	sub    %rbx,%rdx
+  803186:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80318d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803193:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803197:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80319b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80319e:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8031a2:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8031a6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8031ab:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8031b0:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8031b4:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8031b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031bd:	4c 89 e6             	mov    %r12,%rsi
+  8031c0:	bf 09 00 00 00       	mov    $0x9,%edi
+  8031c5:	48 b8 08 26 80 00 00 	movabs $0x802608,%rax
+  8031cc:	00 00 00 
+  8031cf:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8031d1:	85 c0                	test   %eax,%eax
+  8031d3:	78 2a                	js     8031ff <fmap+0x115>
+        i += res;
+  8031d5:	48 98                	cltq
+  8031d7:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8031da:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8031de:	72 05                	jb     8031e5 <fmap+0xfb>
+    while (i < n) {
+  8031e0:	4c 39 eb             	cmp    %r13,%rbx
+  8031e3:	72 9b                	jb     803180 <fmap+0x96>
+    }
+    return i;
+  8031e5:	48 89 d8             	mov    %rbx,%rax
+}
+  8031e8:	48 83 c4 18          	add    $0x18,%rsp
+  8031ec:	5b                   	pop    %rbx
+  8031ed:	41 5c                	pop    %r12
+  8031ef:	41 5d                	pop    %r13
+  8031f1:	41 5e                	pop    %r14
+  8031f3:	41 5f                	pop    %r15
+  8031f5:	5d                   	pop    %rbp
+  8031f6:	c3                   	ret
+    if (res < 0) return res;
+  8031f7:	48 98                	cltq
+  8031f9:	eb ed                	jmp    8031e8 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8031fb:	48 98                	cltq
+  8031fd:	eb e9                	jmp    8031e8 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8031ff:	48 98                	cltq
+  803201:	48 85 db             	test   %rbx,%rbx
+  803204:	48 0f 45 c3          	cmovne %rbx,%rax
+  803208:	eb de                	jmp    8031e8 <fmap+0xfe>
+    size_t i = 0;
+  80320a:	4c 89 eb             	mov    %r13,%rbx
+  80320d:	eb d6                	jmp    8031e5 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80320f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803216:	eb d0                	jmp    8031e8 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803218:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80321f:	eb c7                	jmp    8031e8 <fmap+0xfe>
+  803221:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803228:	eb be                	jmp    8031e8 <fmap+0xfe>
+  80322a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803231:	eb b5                	jmp    8031e8 <fmap+0xfe>
+
+0000000000803233 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803233:	55                   	push   %rbp
+  803234:	48 89 e5             	mov    %rsp,%rbp
+  803237:	41 56                	push   %r14
+  803239:	41 55                	push   %r13
+  80323b:	41 54                	push   %r12
+  80323d:	53                   	push   %rbx
+  80323e:	48 83 ec 10          	sub    $0x10,%rsp
+  803242:	89 fb                	mov    %edi,%ebx
+  803244:	41 89 f4             	mov    %esi,%r12d
+  803247:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80324a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80324e:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  803255:	00 00 00 
+  803258:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80325a:	85 c0                	test   %eax,%eax
+  80325c:	78 63                	js     8032c1 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80325e:	45 85 e4             	test   %r12d,%r12d
+  803261:	0f 88 80 00 00 00    	js     8032e7 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803267:	45 89 e6             	mov    %r12d,%r14d
+  80326a:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803271:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803275:	48 b8 c6 1c 80 00 00 	movabs $0x801cc6,%rax
+  80327c:	00 00 00 
+  80327f:	ff d0                	call   *%rax
+  803281:	48 89 c2             	mov    %rax,%rdx
+  803284:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803289:	44 89 f6             	mov    %r14d,%esi
+  80328c:	89 df                	mov    %ebx,%edi
+  80328e:	48 b8 ea 30 80 00 00 	movabs $0x8030ea,%rax
+  803295:	00 00 00 
+  803298:	ff d0                	call   *%rax
+  80329a:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80329d:	45 29 f4             	sub    %r14d,%r12d
+  8032a0:	4d 63 f4             	movslq %r12d,%r14
+  8032a3:	49 39 c6             	cmp    %rax,%r14
+  8032a6:	7c 1d                	jl     8032c5 <read_map+0x92>
+  8032a8:	48 85 c0             	test   %rax,%rax
+  8032ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b0:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8032b4:	48 83 c4 10          	add    $0x10,%rsp
+  8032b8:	5b                   	pop    %rbx
+  8032b9:	41 5c                	pop    %r12
+  8032bb:	41 5d                	pop    %r13
+  8032bd:	41 5e                	pop    %r14
+  8032bf:	5d                   	pop    %rbp
+  8032c0:	c3                   	ret
+    if (res < 0) return res;
+  8032c1:	48 98                	cltq
+  8032c3:	eb ef                	jmp    8032b4 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8032c5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032c9:	48 b8 c6 1c 80 00 00 	movabs $0x801cc6,%rax
+  8032d0:	00 00 00 
+  8032d3:	ff d0                	call   *%rax
+  8032d5:	4d 63 e4             	movslq %r12d,%r12
+  8032d8:	4c 01 e0             	add    %r12,%rax
+  8032db:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8032df:	48 89 d8             	mov    %rbx,%rax
+  8032e2:	4c 29 f0             	sub    %r14,%rax
+  8032e5:	eb cd                	jmp    8032b4 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8032e7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032ee:	eb c4                	jmp    8032b4 <read_map+0x81>
+
+00000000008032f0 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8032f0:	55                   	push   %rbp
+  8032f1:	48 89 e5             	mov    %rsp,%rbp
+  8032f4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032f8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032fc:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  803303:	00 00 00 
+  803306:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803308:	85 c0                	test   %eax,%eax
+  80330a:	78 4a                	js     803356 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80330c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803310:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803317:	00 00 00 
+  80331a:	8b 00                	mov    (%rax),%eax
+  80331c:	39 07                	cmp    %eax,(%rdi)
+  80331e:	75 38                	jne    803358 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803320:	48 b8 7a 28 80 00 00 	movabs $0x80287a,%rax
+  803327:	00 00 00 
+  80332a:	ff d0                	call   *%rax
+  80332c:	85 c0                	test   %eax,%eax
+  80332e:	78 26                	js     803356 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803330:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803334:	8b 40 0c             	mov    0xc(%rax),%eax
+  803337:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80333e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803340:	be 00 00 00 00       	mov    $0x0,%esi
+  803345:	bf 06 00 00 00       	mov    $0x6,%edi
+  80334a:	48 b8 b4 28 80 00 00 	movabs $0x8028b4,%rax
+  803351:	00 00 00 
+  803354:	ff d0                	call   *%rax
+}
+  803356:	c9                   	leave
+  803357:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803358:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80335d:	eb f7                	jmp    803356 <fsync+0x66>
+
+000000000080335f <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80335f:	55                   	push   %rbp
+  803360:	48 89 e5             	mov    %rsp,%rbp
+  803363:	41 57                	push   %r15
+  803365:	41 56                	push   %r14
+  803367:	41 55                	push   %r13
+  803369:	41 54                	push   %r12
+  80336b:	53                   	push   %rbx
+  80336c:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803370:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803377:	00 00 00 
+  80337a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80337f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803385:	49 bd 42 1d 80 00 00 	movabs $0x801d42,%r13
+  80338c:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80338f:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803396:	00 00 00 
+  803399:	eb 0c                	jmp    8033a7 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80339b:	83 c3 01             	add    $0x1,%ebx
+  80339e:	49 83 c4 28          	add    $0x28,%r12
+  8033a2:	83 fb 20             	cmp    $0x20,%ebx
+  8033a5:	74 33                	je     8033da <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033a7:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8033ac:	74 ed                	je     80339b <flushall+0x3c>
+  8033ae:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033b2:	89 df                	mov    %ebx,%edi
+  8033b4:	41 ff d5             	call   *%r13
+  8033b7:	85 c0                	test   %eax,%eax
+  8033b9:	78 e0                	js     80339b <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8033bb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033bf:	41 8b 06             	mov    (%r14),%eax
+  8033c2:	39 07                	cmp    %eax,(%rdi)
+  8033c4:	75 d5                	jne    80339b <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8033c6:	48 b8 7a 28 80 00 00 	movabs $0x80287a,%rax
+  8033cd:	00 00 00 
+  8033d0:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8033d2:	85 c0                	test   %eax,%eax
+  8033d4:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8033d8:	eb c1                	jmp    80339b <flushall+0x3c>
+    }
+    return res;
+}
+  8033da:	44 89 f8             	mov    %r15d,%eax
+  8033dd:	48 83 c4 18          	add    $0x18,%rsp
+  8033e1:	5b                   	pop    %rbx
+  8033e2:	41 5c                	pop    %r12
+  8033e4:	41 5d                	pop    %r13
+  8033e6:	41 5e                	pop    %r14
+  8033e8:	41 5f                	pop    %r15
+  8033ea:	5d                   	pop    %rbp
+  8033eb:	c3                   	ret
+
+00000000008033ec <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8033ec:	55                   	push   %rbp
+  8033ed:	48 89 e5             	mov    %rsp,%rbp
+  8033f0:	53                   	push   %rbx
+  8033f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8033f5:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8033f8:	40 0f b6 c6          	movzbl %sil,%eax
+  8033fc:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803403:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803405:	be 00 00 00 00       	mov    $0x0,%esi
+  80340a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80340f:	48 b8 b4 28 80 00 00 	movabs $0x8028b4,%rax
+  803416:	00 00 00 
+  803419:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80341b:	85 c0                	test   %eax,%eax
+  80341d:	78 23                	js     803442 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80341f:	ba 58 06 00 00       	mov    $0x658,%edx
+  803424:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80342b:	00 00 00 
+  80342e:	48 89 df             	mov    %rbx,%rdi
+  803431:	48 b8 33 0f 80 00 00 	movabs $0x800f33,%rax
+  803438:	00 00 00 
+  80343b:	ff d0                	call   *%rax
+    return 0;
+  80343d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803442:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803446:	c9                   	leave
+  803447:	c3                   	ret
+
+0000000000803448 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803448:	55                   	push   %rbp
+  803449:	48 89 e5             	mov    %rsp,%rbp
+  80344c:	53                   	push   %rbx
+  80344d:	48 83 ec 08          	sub    $0x8,%rsp
+  803451:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803454:	48 b8 00 0b 80 00 00 	movabs $0x800b00,%rax
+  80345b:	00 00 00 
+  80345e:	ff d0                	call   *%rax
+  803460:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803466:	77 35                	ja     80349d <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803468:	48 89 de             	mov    %rbx,%rsi
+  80346b:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803472:	00 00 00 
+  803475:	48 b8 3e 0b 80 00 00 	movabs $0x800b3e,%rax
+  80347c:	00 00 00 
+  80347f:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803481:	be 00 00 00 00       	mov    $0x0,%esi
+  803486:	bf 07 00 00 00       	mov    $0x7,%edi
+  80348b:	48 b8 b4 28 80 00 00 	movabs $0x8028b4,%rax
+  803492:	00 00 00 
+  803495:	ff d0                	call   *%rax
+}
+  803497:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80349b:	c9                   	leave
+  80349c:	c3                   	ret
+        return -E_BAD_PATH;
+  80349d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034a2:	eb f3                	jmp    803497 <remove+0x4f>
+
+00000000008034a4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8034a4:	55                   	push   %rbp
+  8034a5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8034a8:	48 b8 5f 33 80 00 00 	movabs $0x80335f,%rax
+  8034af:	00 00 00 
+  8034b2:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8034b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8034be:	48 b8 b4 28 80 00 00 	movabs $0x8028b4,%rax
+  8034c5:	00 00 00 
+  8034c8:	ff d0                	call   *%rax
+}
+  8034ca:	5d                   	pop    %rbp
+  8034cb:	c3                   	ret
+
+00000000008034cc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8034cc:	55                   	push   %rbp
+  8034cd:	48 89 e5             	mov    %rsp,%rbp
+  8034d0:	41 54                	push   %r12
+  8034d2:	53                   	push   %rbx
+  8034d3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8034d6:	48 b8 c6 1c 80 00 00 	movabs $0x801cc6,%rax
+  8034dd:	00 00 00 
+  8034e0:	ff d0                	call   *%rax
+  8034e2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8034e5:	48 be a0 56 80 00 00 	movabs $0x8056a0,%rsi
+  8034ec:	00 00 00 
+  8034ef:	48 89 df             	mov    %rbx,%rdi
+  8034f2:	48 b8 3e 0b 80 00 00 	movabs $0x800b3e,%rax
+  8034f9:	00 00 00 
+  8034fc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8034fe:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803503:	41 2b 04 24          	sub    (%r12),%eax
+  803507:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80350d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803514:	00 00 00 
+    stat->st_dev = &devpipe;
+  803517:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80351e:	00 00 00 
+  803521:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352d:	5b                   	pop    %rbx
+  80352e:	41 5c                	pop    %r12
+  803530:	5d                   	pop    %rbp
+  803531:	c3                   	ret
+
+0000000000803532 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803532:	55                   	push   %rbp
+  803533:	48 89 e5             	mov    %rsp,%rbp
+  803536:	41 54                	push   %r12
+  803538:	53                   	push   %rbx
+  803539:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80353c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803541:	48 89 fe             	mov    %rdi,%rsi
+  803544:	bf 00 00 00 00       	mov    $0x0,%edi
+  803549:	49 bc 7d 14 80 00 00 	movabs $0x80147d,%r12
+  803550:	00 00 00 
+  803553:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803556:	48 89 df             	mov    %rbx,%rdi
+  803559:	48 b8 c6 1c 80 00 00 	movabs $0x801cc6,%rax
+  803560:	00 00 00 
+  803563:	ff d0                	call   *%rax
+  803565:	48 89 c6             	mov    %rax,%rsi
+  803568:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80356d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803572:	41 ff d4             	call   *%r12
+}
+  803575:	5b                   	pop    %rbx
+  803576:	41 5c                	pop    %r12
+  803578:	5d                   	pop    %rbp
+  803579:	c3                   	ret
+
+000000000080357a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80357a:	55                   	push   %rbp
+  80357b:	48 89 e5             	mov    %rsp,%rbp
+  80357e:	41 57                	push   %r15
+  803580:	41 56                	push   %r14
+  803582:	41 55                	push   %r13
+  803584:	41 54                	push   %r12
+  803586:	53                   	push   %rbx
+  803587:	48 83 ec 18          	sub    $0x18,%rsp
+  80358b:	49 89 fc             	mov    %rdi,%r12
+  80358e:	49 89 f5             	mov    %rsi,%r13
+  803591:	49 89 d7             	mov    %rdx,%r15
+  803594:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803598:	48 b8 c6 1c 80 00 00 	movabs $0x801cc6,%rax
+  80359f:	00 00 00 
+  8035a2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8035a4:	4d 85 ff             	test   %r15,%r15
+  8035a7:	0f 84 af 00 00 00    	je     80365c <devpipe_write+0xe2>
+  8035ad:	48 89 c3             	mov    %rax,%rbx
+  8035b0:	4c 89 f8             	mov    %r15,%rax
+  8035b3:	4d 89 ef             	mov    %r13,%r15
+  8035b6:	4c 01 e8             	add    %r13,%rax
+  8035b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035bd:	49 bd 72 12 80 00 00 	movabs $0x801272,%r13
+  8035c4:	00 00 00 
+            sys_yield();
+  8035c7:	49 be 0f 12 80 00 00 	movabs $0x80120f,%r14
+  8035ce:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8035d1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8035d4:	48 63 ce             	movslq %esi,%rcx
+  8035d7:	48 63 03             	movslq (%rbx),%rax
+  8035da:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8035e0:	48 39 c1             	cmp    %rax,%rcx
+  8035e3:	72 2e                	jb     803613 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035e5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8035ea:	48 89 da             	mov    %rbx,%rdx
+  8035ed:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035f2:	4c 89 e7             	mov    %r12,%rdi
+  8035f5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8035f8:	85 c0                	test   %eax,%eax
+  8035fa:	74 66                	je     803662 <devpipe_write+0xe8>
+            sys_yield();
+  8035fc:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8035ff:	8b 73 04             	mov    0x4(%rbx),%esi
+  803602:	48 63 ce             	movslq %esi,%rcx
+  803605:	48 63 03             	movslq (%rbx),%rax
+  803608:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80360e:	48 39 c1             	cmp    %rax,%rcx
+  803611:	73 d2                	jae    8035e5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803613:	41 0f b6 3f          	movzbl (%r15),%edi
+  803617:	48 89 ca             	mov    %rcx,%rdx
+  80361a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80361e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803625:	08 10 20 
+  803628:	48 f7 e2             	mul    %rdx
+  80362b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80362f:	48 89 d0             	mov    %rdx,%rax
+  803632:	48 c1 e0 09          	shl    $0x9,%rax
+  803636:	48 29 d0             	sub    %rdx,%rax
+  803639:	48 c1 e0 03          	shl    $0x3,%rax
+  80363d:	48 29 c1             	sub    %rax,%rcx
+  803640:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803645:	83 c6 01             	add    $0x1,%esi
+  803648:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80364b:	49 83 c7 01          	add    $0x1,%r15
+  80364f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803653:	49 39 c7             	cmp    %rax,%r15
+  803656:	0f 85 75 ff ff ff    	jne    8035d1 <devpipe_write+0x57>
+    return n;
+  80365c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803660:	eb 05                	jmp    803667 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803662:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803667:	48 83 c4 18          	add    $0x18,%rsp
+  80366b:	5b                   	pop    %rbx
+  80366c:	41 5c                	pop    %r12
+  80366e:	41 5d                	pop    %r13
+  803670:	41 5e                	pop    %r14
+  803672:	41 5f                	pop    %r15
+  803674:	5d                   	pop    %rbp
+  803675:	c3                   	ret
+
+0000000000803676 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803676:	55                   	push   %rbp
+  803677:	48 89 e5             	mov    %rsp,%rbp
+  80367a:	41 57                	push   %r15
+  80367c:	41 56                	push   %r14
+  80367e:	41 55                	push   %r13
+  803680:	41 54                	push   %r12
+  803682:	53                   	push   %rbx
+  803683:	48 83 ec 18          	sub    $0x18,%rsp
+  803687:	49 89 fc             	mov    %rdi,%r12
+  80368a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80368e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803692:	48 b8 c6 1c 80 00 00 	movabs $0x801cc6,%rax
+  803699:	00 00 00 
+  80369c:	ff d0                	call   *%rax
+  80369e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036a1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036a7:	49 bd 72 12 80 00 00 	movabs $0x801272,%r13
+  8036ae:	00 00 00 
+            sys_yield();
+  8036b1:	49 be 0f 12 80 00 00 	movabs $0x80120f,%r14
+  8036b8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8036bb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8036c0:	74 7d                	je     80373f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036c2:	8b 03                	mov    (%rbx),%eax
+  8036c4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036c7:	75 26                	jne    8036ef <devpipe_read+0x79>
+            if (i > 0) return i;
+  8036c9:	4d 85 ff             	test   %r15,%r15
+  8036cc:	75 77                	jne    803745 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036ce:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036d3:	48 89 da             	mov    %rbx,%rdx
+  8036d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036db:	4c 89 e7             	mov    %r12,%rdi
+  8036de:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8036e1:	85 c0                	test   %eax,%eax
+  8036e3:	74 72                	je     803757 <devpipe_read+0xe1>
+            sys_yield();
+  8036e5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036e8:	8b 03                	mov    (%rbx),%eax
+  8036ea:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036ed:	74 df                	je     8036ce <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8036ef:	48 63 c8             	movslq %eax,%rcx
+  8036f2:	48 89 ca             	mov    %rcx,%rdx
+  8036f5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8036f9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803700:	08 10 20 
+  803703:	48 89 d0             	mov    %rdx,%rax
+  803706:	48 f7 e6             	mul    %rsi
+  803709:	48 c1 ea 06          	shr    $0x6,%rdx
+  80370d:	48 89 d0             	mov    %rdx,%rax
+  803710:	48 c1 e0 09          	shl    $0x9,%rax
+  803714:	48 29 d0             	sub    %rdx,%rax
+  803717:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80371e:	00 
+  80371f:	48 89 c8             	mov    %rcx,%rax
+  803722:	48 29 d0             	sub    %rdx,%rax
+  803725:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80372a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80372e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803732:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803735:	49 83 c7 01          	add    $0x1,%r15
+  803739:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80373d:	75 83                	jne    8036c2 <devpipe_read+0x4c>
+    return n;
+  80373f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803743:	eb 03                	jmp    803748 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803745:	4c 89 f8             	mov    %r15,%rax
+}
+  803748:	48 83 c4 18          	add    $0x18,%rsp
+  80374c:	5b                   	pop    %rbx
+  80374d:	41 5c                	pop    %r12
+  80374f:	41 5d                	pop    %r13
+  803751:	41 5e                	pop    %r14
+  803753:	41 5f                	pop    %r15
+  803755:	5d                   	pop    %rbp
+  803756:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375c:	eb ea                	jmp    803748 <devpipe_read+0xd2>
+
+000000000080375e <pipe>:
+pipe(int pfd[2]) {
+  80375e:	55                   	push   %rbp
+  80375f:	48 89 e5             	mov    %rsp,%rbp
+  803762:	41 55                	push   %r13
+  803764:	41 54                	push   %r12
+  803766:	53                   	push   %rbx
+  803767:	48 83 ec 18          	sub    $0x18,%rsp
+  80376b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80376e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803772:	48 b8 e2 1c 80 00 00 	movabs $0x801ce2,%rax
+  803779:	00 00 00 
+  80377c:	ff d0                	call   *%rax
+  80377e:	89 c3                	mov    %eax,%ebx
+  803780:	85 c0                	test   %eax,%eax
+  803782:	0f 88 a0 01 00 00    	js     803928 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803788:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80378d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803792:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803796:	bf 00 00 00 00       	mov    $0x0,%edi
+  80379b:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  8037a2:	00 00 00 
+  8037a5:	ff d0                	call   *%rax
+  8037a7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8037a9:	85 c0                	test   %eax,%eax
+  8037ab:	0f 88 77 01 00 00    	js     803928 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037b1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8037b5:	48 b8 e2 1c 80 00 00 	movabs $0x801ce2,%rax
+  8037bc:	00 00 00 
+  8037bf:	ff d0                	call   *%rax
+  8037c1:	89 c3                	mov    %eax,%ebx
+  8037c3:	85 c0                	test   %eax,%eax
+  8037c5:	0f 88 43 01 00 00    	js     80390e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8037cb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037d5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8037d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037de:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  8037e5:	00 00 00 
+  8037e8:	ff d0                	call   *%rax
+  8037ea:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037ec:	85 c0                	test   %eax,%eax
+  8037ee:	0f 88 1a 01 00 00    	js     80390e <pipe+0x1b0>
+    va = fd2data(fd0);
+  8037f4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8037f8:	48 b8 c6 1c 80 00 00 	movabs $0x801cc6,%rax
+  8037ff:	00 00 00 
+  803802:	ff d0                	call   *%rax
+  803804:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803807:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80380c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803811:	48 89 c6             	mov    %rax,%rsi
+  803814:	bf 00 00 00 00       	mov    $0x0,%edi
+  803819:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  803820:	00 00 00 
+  803823:	ff d0                	call   *%rax
+  803825:	89 c3                	mov    %eax,%ebx
+  803827:	85 c0                	test   %eax,%eax
+  803829:	0f 88 c5 00 00 00    	js     8038f4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80382f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803833:	48 b8 c6 1c 80 00 00 	movabs $0x801cc6,%rax
+  80383a:	00 00 00 
+  80383d:	ff d0                	call   *%rax
+  80383f:	48 89 c1             	mov    %rax,%rcx
+  803842:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803848:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80384e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803853:	4c 89 ee             	mov    %r13,%rsi
+  803856:	bf 00 00 00 00       	mov    $0x0,%edi
+  80385b:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+  803867:	89 c3                	mov    %eax,%ebx
+  803869:	85 c0                	test   %eax,%eax
+  80386b:	78 6e                	js     8038db <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80386d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803872:	4c 89 ef             	mov    %r13,%rdi
+  803875:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  80387c:	00 00 00 
+  80387f:	ff d0                	call   *%rax
+  803881:	83 f8 02             	cmp    $0x2,%eax
+  803884:	0f 85 ab 00 00 00    	jne    803935 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80388a:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803891:	00 00 
+  803893:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803897:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803899:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80389d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8038a4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8038a8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8038aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038ae:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8038b5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8038b9:	48 bb b4 1c 80 00 00 	movabs $0x801cb4,%rbx
+  8038c0:	00 00 00 
+  8038c3:	ff d3                	call   *%rbx
+  8038c5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8038c9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8038cd:	ff d3                	call   *%rbx
+  8038cf:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8038d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038d9:	eb 4d                	jmp    803928 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8038db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038e0:	4c 89 ee             	mov    %r13,%rsi
+  8038e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038e8:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  8038ef:	00 00 00 
+  8038f2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8038f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038f9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8038fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803902:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  803909:	00 00 00 
+  80390c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80390e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803913:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803917:	bf 00 00 00 00       	mov    $0x0,%edi
+  80391c:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  803923:	00 00 00 
+  803926:	ff d0                	call   *%rax
+}
+  803928:	89 d8                	mov    %ebx,%eax
+  80392a:	48 83 c4 18          	add    $0x18,%rsp
+  80392e:	5b                   	pop    %rbx
+  80392f:	41 5c                	pop    %r12
+  803931:	41 5d                	pop    %r13
+  803933:	5d                   	pop    %rbp
+  803934:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803935:	48 b9 d0 56 80 00 00 	movabs $0x8056d0,%rcx
+  80393c:	00 00 00 
+  80393f:	48 ba a7 56 80 00 00 	movabs $0x8056a7,%rdx
+  803946:	00 00 00 
+  803949:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80394e:	48 bf bc 56 80 00 00 	movabs $0x8056bc,%rdi
+  803955:	00 00 00 
+  803958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395d:	49 b8 3d 3f 80 00 00 	movabs $0x803f3d,%r8
+  803964:	00 00 00 
+  803967:	41 ff d0             	call   *%r8
+
+000000000080396a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80396a:	55                   	push   %rbp
+  80396b:	48 89 e5             	mov    %rsp,%rbp
+  80396e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803972:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803976:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  80397d:	00 00 00 
+  803980:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803982:	85 c0                	test   %eax,%eax
+  803984:	78 35                	js     8039bb <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803986:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80398a:	48 b8 c6 1c 80 00 00 	movabs $0x801cc6,%rax
+  803991:	00 00 00 
+  803994:	ff d0                	call   *%rax
+  803996:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803999:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80399e:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039a3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039a7:	48 b8 72 12 80 00 00 	movabs $0x801272,%rax
+  8039ae:	00 00 00 
+  8039b1:	ff d0                	call   *%rax
+  8039b3:	85 c0                	test   %eax,%eax
+  8039b5:	0f 94 c0             	sete   %al
+  8039b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8039bb:	c9                   	leave
+  8039bc:	c3                   	ret
+
+00000000008039bd <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8039bd:	48 89 f8             	mov    %rdi,%rax
+  8039c0:	48 c1 e8 27          	shr    $0x27,%rax
+  8039c4:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8039cb:	7f 00 00 
+  8039ce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039d2:	f6 c2 01             	test   $0x1,%dl
+  8039d5:	74 6d                	je     803a44 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8039d7:	48 89 f8             	mov    %rdi,%rax
+  8039da:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039de:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039e5:	7f 00 00 
+  8039e8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039ec:	f6 c2 01             	test   $0x1,%dl
+  8039ef:	74 62                	je     803a53 <get_uvpt_entry+0x96>
+  8039f1:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039f8:	7f 00 00 
+  8039fb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039ff:	f6 c2 80             	test   $0x80,%dl
+  803a02:	75 4f                	jne    803a53 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a04:	48 89 f8             	mov    %rdi,%rax
+  803a07:	48 c1 e8 15          	shr    $0x15,%rax
+  803a0b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a12:	7f 00 00 
+  803a15:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a19:	f6 c2 01             	test   $0x1,%dl
+  803a1c:	74 44                	je     803a62 <get_uvpt_entry+0xa5>
+  803a1e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a25:	7f 00 00 
+  803a28:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a2c:	f6 c2 80             	test   $0x80,%dl
+  803a2f:	75 31                	jne    803a62 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803a31:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803a35:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a3c:	7f 00 00 
+  803a3f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803a43:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a44:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803a4b:	7f 00 00 
+  803a4e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a52:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a53:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a5a:	7f 00 00 
+  803a5d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a61:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a62:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a69:	7f 00 00 
+  803a6c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a70:	c3                   	ret
+
+0000000000803a71 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803a71:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a74:	48 89 f9             	mov    %rdi,%rcx
+  803a77:	48 c1 e9 27          	shr    $0x27,%rcx
+  803a7b:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803a82:	7f 00 00 
+  803a85:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803a89:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a90:	f6 c1 01             	test   $0x1,%cl
+  803a93:	0f 84 b2 00 00 00    	je     803b4b <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803a99:	48 89 f9             	mov    %rdi,%rcx
+  803a9c:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803aa0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803aa7:	7f 00 00 
+  803aaa:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803aae:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ab5:	40 f6 c6 01          	test   $0x1,%sil
+  803ab9:	0f 84 8c 00 00 00    	je     803b4b <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803abf:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ac6:	7f 00 00 
+  803ac9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803acd:	a8 80                	test   $0x80,%al
+  803acf:	75 7b                	jne    803b4c <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ad1:	48 89 f9             	mov    %rdi,%rcx
+  803ad4:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ad8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803adf:	7f 00 00 
+  803ae2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ae6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803aed:	40 f6 c6 01          	test   $0x1,%sil
+  803af1:	74 58                	je     803b4b <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803af3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803afa:	7f 00 00 
+  803afd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b01:	a8 80                	test   $0x80,%al
+  803b03:	75 6c                	jne    803b71 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b05:	48 89 f9             	mov    %rdi,%rcx
+  803b08:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803b0c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b13:	7f 00 00 
+  803b16:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b1a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b21:	40 f6 c6 01          	test   $0x1,%sil
+  803b25:	74 24                	je     803b4b <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803b27:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b2e:	7f 00 00 
+  803b31:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b35:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b3c:	ff ff 7f 
+  803b3f:	48 21 c8             	and    %rcx,%rax
+  803b42:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803b48:	48 09 d0             	or     %rdx,%rax
+}
+  803b4b:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803b4c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b53:	7f 00 00 
+  803b56:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b5a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b61:	ff ff 7f 
+  803b64:	48 21 c8             	and    %rcx,%rax
+  803b67:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803b6d:	48 01 d0             	add    %rdx,%rax
+  803b70:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803b71:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b78:	7f 00 00 
+  803b7b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b7f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b86:	ff ff 7f 
+  803b89:	48 21 c8             	and    %rcx,%rax
+  803b8c:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803b92:	48 01 d0             	add    %rdx,%rax
+  803b95:	c3                   	ret
+
+0000000000803b96 <get_prot>:
+
+int
+get_prot(void *va) {
+  803b96:	55                   	push   %rbp
+  803b97:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803b9a:	48 b8 bd 39 80 00 00 	movabs $0x8039bd,%rax
+  803ba1:	00 00 00 
+  803ba4:	ff d0                	call   *%rax
+  803ba6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803ba9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803bae:	89 c1                	mov    %eax,%ecx
+  803bb0:	83 c9 04             	or     $0x4,%ecx
+  803bb3:	f6 c2 01             	test   $0x1,%dl
+  803bb6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803bb9:	89 c1                	mov    %eax,%ecx
+  803bbb:	83 c9 02             	or     $0x2,%ecx
+  803bbe:	f6 c2 02             	test   $0x2,%dl
+  803bc1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803bc4:	89 c1                	mov    %eax,%ecx
+  803bc6:	83 c9 01             	or     $0x1,%ecx
+  803bc9:	48 85 d2             	test   %rdx,%rdx
+  803bcc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803bcf:	89 c1                	mov    %eax,%ecx
+  803bd1:	83 c9 40             	or     $0x40,%ecx
+  803bd4:	f6 c6 04             	test   $0x4,%dh
+  803bd7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803bda:	5d                   	pop    %rbp
+  803bdb:	c3                   	ret
+
+0000000000803bdc <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803bdc:	55                   	push   %rbp
+  803bdd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803be0:	48 b8 bd 39 80 00 00 	movabs $0x8039bd,%rax
+  803be7:	00 00 00 
+  803bea:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803bec:	48 c1 e8 06          	shr    $0x6,%rax
+  803bf0:	83 e0 01             	and    $0x1,%eax
+}
+  803bf3:	5d                   	pop    %rbp
+  803bf4:	c3                   	ret
+
+0000000000803bf5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803bf5:	55                   	push   %rbp
+  803bf6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803bf9:	48 b8 bd 39 80 00 00 	movabs $0x8039bd,%rax
+  803c00:	00 00 00 
+  803c03:	ff d0                	call   *%rax
+  803c05:	83 e0 01             	and    $0x1,%eax
+}
+  803c08:	5d                   	pop    %rbp
+  803c09:	c3                   	ret
+
+0000000000803c0a <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803c0a:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803c11:	7f 00 00 
+  803c14:	a8 01                	test   $0x1,%al
+  803c16:	75 06                	jne    803c1e <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c1d:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803c1e:	55                   	push   %rbp
+  803c1f:	48 89 e5             	mov    %rsp,%rbp
+  803c22:	41 57                	push   %r15
+  803c24:	41 56                	push   %r14
+  803c26:	41 55                	push   %r13
+  803c28:	41 54                	push   %r12
+  803c2a:	53                   	push   %rbx
+  803c2b:	48 83 ec 18          	sub    $0x18,%rsp
+  803c2f:	49 89 fe             	mov    %rdi,%r14
+  803c32:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803c35:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803c3c:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c3d:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803c44:	7f 00 00 
+  803c47:	e9 81 00 00 00       	jmp    803ccd <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803c4c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803c53:	49 39 dd             	cmp    %rbx,%r13
+  803c56:	74 2b                	je     803c83 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c58:	48 89 d8             	mov    %rbx,%rax
+  803c5b:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c5f:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803c63:	f6 c2 01             	test   $0x1,%dl
+  803c66:	74 e4                	je     803c4c <foreach_shared_region+0x42>
+  803c68:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803c6c:	f6 c4 04             	test   $0x4,%ah
+  803c6f:	74 db                	je     803c4c <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803c71:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803c78:	4c 89 fa             	mov    %r15,%rdx
+  803c7b:	48 89 df             	mov    %rbx,%rdi
+  803c7e:	41 ff d6             	call   *%r14
+  803c81:	eb c9                	jmp    803c4c <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803c83:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803c8a:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803c8e:	74 22                	je     803cb2 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803c90:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803c97:	48 89 d8             	mov    %rbx,%rax
+  803c9a:	48 c1 e8 15          	shr    $0x15,%rax
+  803c9e:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803ca5:	7f 00 00 
+  803ca8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803cac:	a8 01                	test   $0x1,%al
+  803cae:	74 d3                	je     803c83 <foreach_shared_region+0x79>
+  803cb0:	eb a6                	jmp    803c58 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803cb2:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803cb9:	40 
+  803cba:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803cbe:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cc5:	00 00 00 
+  803cc8:	48 39 c1             	cmp    %rax,%rcx
+  803ccb:	74 31                	je     803cfe <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803ccd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cd1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803cd5:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803cdc:	7f 00 00 
+  803cdf:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803ce3:	a8 01                	test   $0x1,%al
+  803ce5:	74 cb                	je     803cb2 <foreach_shared_region+0xa8>
+  803ce7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ceb:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803cf2:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803cf8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803cfc:	eb 92                	jmp    803c90 <foreach_shared_region+0x86>
+}
+  803cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d03:	48 83 c4 18          	add    $0x18,%rsp
+  803d07:	5b                   	pop    %rbx
+  803d08:	41 5c                	pop    %r12
+  803d0a:	41 5d                	pop    %r13
+  803d0c:	41 5e                	pop    %r14
+  803d0e:	41 5f                	pop    %r15
+  803d10:	5d                   	pop    %rbp
+  803d11:	c3                   	ret
+
+0000000000803d12 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d17:	c3                   	ret
+
+0000000000803d18 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803d18:	55                   	push   %rbp
+  803d19:	48 89 e5             	mov    %rsp,%rbp
+  803d1c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803d1f:	48 be f4 56 80 00 00 	movabs $0x8056f4,%rsi
+  803d26:	00 00 00 
+  803d29:	48 b8 3e 0b 80 00 00 	movabs $0x800b3e,%rax
+  803d30:	00 00 00 
+  803d33:	ff d0                	call   *%rax
+    return 0;
+}
+  803d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3a:	5d                   	pop    %rbp
+  803d3b:	c3                   	ret
+
+0000000000803d3c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d3c:	55                   	push   %rbp
+  803d3d:	48 89 e5             	mov    %rsp,%rbp
+  803d40:	41 57                	push   %r15
+  803d42:	41 56                	push   %r14
+  803d44:	41 55                	push   %r13
+  803d46:	41 54                	push   %r12
+  803d48:	53                   	push   %rbx
+  803d49:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803d50:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803d57:	48 85 d2             	test   %rdx,%rdx
+  803d5a:	74 7a                	je     803dd6 <devcons_write+0x9a>
+  803d5c:	49 89 d6             	mov    %rdx,%r14
+  803d5f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803d65:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803d6a:	49 bf cc 0e 80 00 00 	movabs $0x800ecc,%r15
+  803d71:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803d74:	4c 89 f3             	mov    %r14,%rbx
+  803d77:	48 29 f3             	sub    %rsi,%rbx
+  803d7a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803d7f:	48 39 c3             	cmp    %rax,%rbx
+  803d82:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803d86:	4c 63 eb             	movslq %ebx,%r13
+  803d89:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803d90:	48 01 c6             	add    %rax,%rsi
+  803d93:	4c 89 ea             	mov    %r13,%rdx
+  803d96:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803d9d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803da0:	4c 89 ee             	mov    %r13,%rsi
+  803da3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803daa:	48 b8 15 11 80 00 00 	movabs $0x801115,%rax
+  803db1:	00 00 00 
+  803db4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803db6:	41 01 dc             	add    %ebx,%r12d
+  803db9:	49 63 f4             	movslq %r12d,%rsi
+  803dbc:	4c 39 f6             	cmp    %r14,%rsi
+  803dbf:	72 b3                	jb     803d74 <devcons_write+0x38>
+    return res;
+  803dc1:	49 63 c4             	movslq %r12d,%rax
+}
+  803dc4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803dcb:	5b                   	pop    %rbx
+  803dcc:	41 5c                	pop    %r12
+  803dce:	41 5d                	pop    %r13
+  803dd0:	41 5e                	pop    %r14
+  803dd2:	41 5f                	pop    %r15
+  803dd4:	5d                   	pop    %rbp
+  803dd5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803dd6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803ddc:	eb e3                	jmp    803dc1 <devcons_write+0x85>
+
+0000000000803dde <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803dde:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803de1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803de6:	48 85 c0             	test   %rax,%rax
+  803de9:	74 55                	je     803e40 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803deb:	55                   	push   %rbp
+  803dec:	48 89 e5             	mov    %rsp,%rbp
+  803def:	41 55                	push   %r13
+  803df1:	41 54                	push   %r12
+  803df3:	53                   	push   %rbx
+  803df4:	48 83 ec 08          	sub    $0x8,%rsp
+  803df8:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803dfb:	48 bb 42 11 80 00 00 	movabs $0x801142,%rbx
+  803e02:	00 00 00 
+  803e05:	49 bc 0f 12 80 00 00 	movabs $0x80120f,%r12
+  803e0c:	00 00 00 
+  803e0f:	eb 03                	jmp    803e14 <devcons_read+0x36>
+  803e11:	41 ff d4             	call   *%r12
+  803e14:	ff d3                	call   *%rbx
+  803e16:	85 c0                	test   %eax,%eax
+  803e18:	74 f7                	je     803e11 <devcons_read+0x33>
+    if (c < 0) return c;
+  803e1a:	48 63 d0             	movslq %eax,%rdx
+  803e1d:	78 13                	js     803e32 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803e1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e24:	83 f8 04             	cmp    $0x4,%eax
+  803e27:	74 09                	je     803e32 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803e29:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803e2d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803e32:	48 89 d0             	mov    %rdx,%rax
+  803e35:	48 83 c4 08          	add    $0x8,%rsp
+  803e39:	5b                   	pop    %rbx
+  803e3a:	41 5c                	pop    %r12
+  803e3c:	41 5d                	pop    %r13
+  803e3e:	5d                   	pop    %rbp
+  803e3f:	c3                   	ret
+  803e40:	48 89 d0             	mov    %rdx,%rax
+  803e43:	c3                   	ret
+
+0000000000803e44 <cputchar>:
+cputchar(int ch) {
+  803e44:	55                   	push   %rbp
+  803e45:	48 89 e5             	mov    %rsp,%rbp
+  803e48:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803e4c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803e50:	be 01 00 00 00       	mov    $0x1,%esi
+  803e55:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803e59:	48 b8 15 11 80 00 00 	movabs $0x801115,%rax
+  803e60:	00 00 00 
+  803e63:	ff d0                	call   *%rax
+}
+  803e65:	c9                   	leave
+  803e66:	c3                   	ret
+
+0000000000803e67 <getchar>:
+getchar(void) {
+  803e67:	55                   	push   %rbp
+  803e68:	48 89 e5             	mov    %rsp,%rbp
+  803e6b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803e6f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e74:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803e78:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e7d:	48 b8 25 20 80 00 00 	movabs $0x802025,%rax
+  803e84:	00 00 00 
+  803e87:	ff d0                	call   *%rax
+  803e89:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803e8b:	85 c0                	test   %eax,%eax
+  803e8d:	78 06                	js     803e95 <getchar+0x2e>
+  803e8f:	74 08                	je     803e99 <getchar+0x32>
+  803e91:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803e95:	89 d0                	mov    %edx,%eax
+  803e97:	c9                   	leave
+  803e98:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803e99:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803e9e:	eb f5                	jmp    803e95 <getchar+0x2e>
+
+0000000000803ea0 <iscons>:
+iscons(int fdnum) {
+  803ea0:	55                   	push   %rbp
+  803ea1:	48 89 e5             	mov    %rsp,%rbp
+  803ea4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ea8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803eac:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  803eb3:	00 00 00 
+  803eb6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803eb8:	85 c0                	test   %eax,%eax
+  803eba:	78 18                	js     803ed4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803ebc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ec0:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803ec7:	00 00 00 
+  803eca:	8b 00                	mov    (%rax),%eax
+  803ecc:	39 02                	cmp    %eax,(%rdx)
+  803ece:	0f 94 c0             	sete   %al
+  803ed1:	0f b6 c0             	movzbl %al,%eax
+}
+  803ed4:	c9                   	leave
+  803ed5:	c3                   	ret
+
+0000000000803ed6 <opencons>:
+opencons(void) {
+  803ed6:	55                   	push   %rbp
+  803ed7:	48 89 e5             	mov    %rsp,%rbp
+  803eda:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803ede:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803ee2:	48 b8 e2 1c 80 00 00 	movabs $0x801ce2,%rax
+  803ee9:	00 00 00 
+  803eec:	ff d0                	call   *%rax
+  803eee:	85 c0                	test   %eax,%eax
+  803ef0:	78 49                	js     803f3b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803ef2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ef7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803efc:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803f00:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f05:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  803f0c:	00 00 00 
+  803f0f:	ff d0                	call   *%rax
+  803f11:	85 c0                	test   %eax,%eax
+  803f13:	78 26                	js     803f3b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803f15:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f19:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803f20:	00 00 
+  803f22:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803f24:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f28:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803f2f:	48 b8 b4 1c 80 00 00 	movabs $0x801cb4,%rax
+  803f36:	00 00 00 
+  803f39:	ff d0                	call   *%rax
+}
+  803f3b:	c9                   	leave
+  803f3c:	c3                   	ret
+
+0000000000803f3d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803f3d:	55                   	push   %rbp
+  803f3e:	48 89 e5             	mov    %rsp,%rbp
+  803f41:	41 56                	push   %r14
+  803f43:	41 55                	push   %r13
+  803f45:	41 54                	push   %r12
+  803f47:	53                   	push   %rbx
+  803f48:	48 83 ec 50          	sub    $0x50,%rsp
+  803f4c:	49 89 fc             	mov    %rdi,%r12
+  803f4f:	41 89 f5             	mov    %esi,%r13d
+  803f52:	48 89 d3             	mov    %rdx,%rbx
+  803f55:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f59:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803f5d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803f61:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803f68:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f6c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803f70:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803f74:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803f78:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803f7f:	00 00 00 
+  803f82:	4c 8b 30             	mov    (%rax),%r14
+  803f85:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  803f8c:	00 00 00 
+  803f8f:	ff d0                	call   *%rax
+  803f91:	89 c6                	mov    %eax,%esi
+  803f93:	45 89 e8             	mov    %r13d,%r8d
+  803f96:	4c 89 e1             	mov    %r12,%rcx
+  803f99:	4c 89 f2             	mov    %r14,%rdx
+  803f9c:	48 bf 00 57 80 00 00 	movabs $0x805700,%rdi
+  803fa3:	00 00 00 
+  803fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fab:	49 bc c6 01 80 00 00 	movabs $0x8001c6,%r12
+  803fb2:	00 00 00 
+  803fb5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803fb8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803fbc:	48 89 df             	mov    %rbx,%rdi
+  803fbf:	48 b8 62 01 80 00 00 	movabs $0x800162,%rax
+  803fc6:	00 00 00 
+  803fc9:	ff d0                	call   *%rax
+    cprintf("\n");
+  803fcb:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  803fd2:	00 00 00 
+  803fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fda:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803fdd:	cc                   	int3
+  803fde:	eb fd                	jmp    803fdd <_panic+0xa0>
+
+0000000000803fe0 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fe0:	55                   	push   %rbp
+  803fe1:	48 89 e5             	mov    %rsp,%rbp
+  803fe4:	41 55                	push   %r13
+  803fe6:	41 54                	push   %r12
+  803fe8:	53                   	push   %rbx
+  803fe9:	48 83 ec 08          	sub    $0x8,%rsp
+  803fed:	49 89 fc             	mov    %rdi,%r12
+  803ff0:	48 89 f7             	mov    %rsi,%rdi
+  803ff3:	48 89 d3             	mov    %rdx,%rbx
+  803ff6:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803ff9:	48 85 f6             	test   %rsi,%rsi
+  803ffc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804003:	00 00 00 
+  804006:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80400a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80400f:	48 85 d2             	test   %rdx,%rdx
+  804012:	74 03                	je     804017 <ipc_recv+0x37>
+  804014:	48 8b 32             	mov    (%rdx),%rsi
+  804017:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  80401e:	00 00 00 
+  804021:	ff d0                	call   *%rax
+    if (errno) {
+  804023:	85 c0                	test   %eax,%eax
+  804025:	74 1c                	je     804043 <ipc_recv+0x63>
+        if (from_env_store)
+  804027:	4d 85 e4             	test   %r12,%r12
+  80402a:	74 08                	je     804034 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80402c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804033:	00 
+
+        if (perm_store)
+  804034:	4d 85 ed             	test   %r13,%r13
+  804037:	74 74                	je     8040ad <ipc_recv+0xcd>
+            *perm_store = 0;
+  804039:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804040:	00 
+  804041:	eb 6a                	jmp    8040ad <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804043:	4d 85 e4             	test   %r12,%r12
+  804046:	74 14                	je     80405c <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804048:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80404f:	00 00 00 
+  804052:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804058:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80405c:	48 85 db             	test   %rbx,%rbx
+  80405f:	74 23                	je     804084 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804061:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804068:	00 00 00 
+  80406b:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804071:	ba 00 00 00 00       	mov    $0x0,%edx
+  804076:	85 c9                	test   %ecx,%ecx
+  804078:	74 07                	je     804081 <ipc_recv+0xa1>
+  80407a:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804081:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804084:	4d 85 ed             	test   %r13,%r13
+  804087:	74 14                	je     80409d <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804089:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804090:	00 00 00 
+  804093:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804099:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  80409d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040a4:	00 00 00 
+  8040a7:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040ad:	48 83 c4 08          	add    $0x8,%rsp
+  8040b1:	5b                   	pop    %rbx
+  8040b2:	41 5c                	pop    %r12
+  8040b4:	41 5d                	pop    %r13
+  8040b6:	5d                   	pop    %rbp
+  8040b7:	c3                   	ret
+
+00000000008040b8 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040b8:	55                   	push   %rbp
+  8040b9:	48 89 e5             	mov    %rsp,%rbp
+  8040bc:	41 55                	push   %r13
+  8040be:	41 54                	push   %r12
+  8040c0:	53                   	push   %rbx
+  8040c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8040c5:	49 89 fc             	mov    %rdi,%r12
+  8040c8:	48 89 f7             	mov    %rsi,%rdi
+  8040cb:	48 89 d3             	mov    %rdx,%rbx
+  8040ce:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040d1:	48 85 f6             	test   %rsi,%rsi
+  8040d4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040db:	00 00 00 
+  8040de:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040e2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040e7:	48 85 d2             	test   %rdx,%rdx
+  8040ea:	74 03                	je     8040ef <ipc_try_recv+0x37>
+  8040ec:	48 8b 32             	mov    (%rdx),%rsi
+  8040ef:	48 b8 b4 16 80 00 00 	movabs $0x8016b4,%rax
+  8040f6:	00 00 00 
+  8040f9:	ff d0                	call   *%rax
+    if (errno) {
+  8040fb:	85 c0                	test   %eax,%eax
+  8040fd:	75 75                	jne    804174 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8040ff:	4d 85 e4             	test   %r12,%r12
+  804102:	74 14                	je     804118 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804104:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80410b:	00 00 00 
+  80410e:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804114:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804118:	48 85 db             	test   %rbx,%rbx
+  80411b:	74 23                	je     804140 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80411d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804124:	00 00 00 
+  804127:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80412d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804132:	85 c9                	test   %ecx,%ecx
+  804134:	74 07                	je     80413d <ipc_try_recv+0x85>
+  804136:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80413d:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804140:	4d 85 ed             	test   %r13,%r13
+  804143:	74 14                	je     804159 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804145:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80414c:	00 00 00 
+  80414f:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804155:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804159:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804160:	00 00 00 
+  804163:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804169:	48 83 c4 08          	add    $0x8,%rsp
+  80416d:	5b                   	pop    %rbx
+  80416e:	41 5c                	pop    %r12
+  804170:	41 5d                	pop    %r13
+  804172:	5d                   	pop    %rbp
+  804173:	c3                   	ret
+        if (from_env_store)
+  804174:	4d 85 e4             	test   %r12,%r12
+  804177:	74 08                	je     804181 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804179:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804180:	00 
+        if (perm_store)
+  804181:	4d 85 ed             	test   %r13,%r13
+  804184:	74 e3                	je     804169 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804186:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80418d:	00 
+  80418e:	eb d9                	jmp    804169 <ipc_try_recv+0xb1>
+
+0000000000804190 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804190:	55                   	push   %rbp
+  804191:	48 89 e5             	mov    %rsp,%rbp
+  804194:	41 57                	push   %r15
+  804196:	41 56                	push   %r14
+  804198:	41 55                	push   %r13
+  80419a:	41 54                	push   %r12
+  80419c:	53                   	push   %rbx
+  80419d:	48 83 ec 18          	sub    $0x18,%rsp
+  8041a1:	41 89 fd             	mov    %edi,%r13d
+  8041a4:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8041a7:	48 89 d3             	mov    %rdx,%rbx
+  8041aa:	49 89 cc             	mov    %rcx,%r12
+  8041ad:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041b1:	48 85 d2             	test   %rdx,%rdx
+  8041b4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041bb:	00 00 00 
+  8041be:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041c2:	49 be 1f 16 80 00 00 	movabs $0x80161f,%r14
+  8041c9:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041cc:	49 bf 0f 12 80 00 00 	movabs $0x80120f,%r15
+  8041d3:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041d6:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041d9:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041dd:	4c 89 e1             	mov    %r12,%rcx
+  8041e0:	48 89 da             	mov    %rbx,%rdx
+  8041e3:	44 89 ef             	mov    %r13d,%edi
+  8041e6:	41 ff d6             	call   *%r14
+  8041e9:	85 c0                	test   %eax,%eax
+  8041eb:	74 37                	je     804224 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041ed:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041f0:	75 05                	jne    8041f7 <ipc_send+0x67>
+        sys_yield();
+  8041f2:	41 ff d7             	call   *%r15
+  8041f5:	eb df                	jmp    8041d6 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041f7:	89 c1                	mov    %eax,%ecx
+  8041f9:	48 ba 23 57 80 00 00 	movabs $0x805723,%rdx
+  804200:	00 00 00 
+  804203:	be 65 00 00 00       	mov    $0x65,%esi
+  804208:	48 bf 3e 57 80 00 00 	movabs $0x80573e,%rdi
+  80420f:	00 00 00 
+  804212:	b8 00 00 00 00       	mov    $0x0,%eax
+  804217:	49 b8 3d 3f 80 00 00 	movabs $0x803f3d,%r8
+  80421e:	00 00 00 
+  804221:	41 ff d0             	call   *%r8
+    }
+}
+  804224:	48 83 c4 18          	add    $0x18,%rsp
+  804228:	5b                   	pop    %rbx
+  804229:	41 5c                	pop    %r12
+  80422b:	41 5d                	pop    %r13
+  80422d:	41 5e                	pop    %r14
+  80422f:	41 5f                	pop    %r15
+  804231:	5d                   	pop    %rbp
+  804232:	c3                   	ret
+
+0000000000804233 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804233:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804238:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80423f:	00 00 00 
+  804242:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804249:	48 01 ca             	add    %rcx,%rdx
+  80424c:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804252:	39 fa                	cmp    %edi,%edx
+  804254:	74 12                	je     804268 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804256:	48 83 c0 01          	add    $0x1,%rax
+  80425a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804260:	75 e0                	jne    804242 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804262:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804267:	c3                   	ret
+            return envs[i].env_id;
+  804268:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80426f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804276:	00 00 00 
+  804279:	48 01 d0             	add    %rdx,%rax
+  80427c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804282:	c3                   	ret
+
+0000000000804283 <__text_end>:
+  804283:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428a:	00 00 00 
+  80428d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804294:	00 00 00 
+  804297:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429e:	00 00 00 
+  8042a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a8:	00 00 00 
+  8042ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b2:	00 00 00 
+  8042b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042bc:	00 00 00 
+  8042bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c6:	00 00 00 
+  8042c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d0:	00 00 00 
+  8042d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042da:	00 00 00 
+  8042dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e4:	00 00 00 
+  8042e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ee:	00 00 00 
+  8042f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f8:	00 00 00 
+  8042fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804302:	00 00 00 
+  804305:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430c:	00 00 00 
+  80430f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804316:	00 00 00 
+  804319:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804320:	00 00 00 
+  804323:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432a:	00 00 00 
+  80432d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804334:	00 00 00 
+  804337:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433e:	00 00 00 
+  804341:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804348:	00 00 00 
+  80434b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804352:	00 00 00 
+  804355:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435c:	00 00 00 
+  80435f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804366:	00 00 00 
+  804369:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804370:	00 00 00 
+  804373:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437a:	00 00 00 
+  80437d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804384:	00 00 00 
+  804387:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438e:	00 00 00 
+  804391:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804398:	00 00 00 
+  80439b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a2:	00 00 00 
+  8043a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ac:	00 00 00 
+  8043af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b6:	00 00 00 
+  8043b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c0:	00 00 00 
+  8043c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ca:	00 00 00 
+  8043cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d4:	00 00 00 
+  8043d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043de:	00 00 00 
+  8043e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e8:	00 00 00 
+  8043eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f2:	00 00 00 
+  8043f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fc:	00 00 00 
+  8043ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804406:	00 00 00 
+  804409:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804410:	00 00 00 
+  804413:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441a:	00 00 00 
+  80441d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804424:	00 00 00 
+  804427:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442e:	00 00 00 
+  804431:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804438:	00 00 00 
+  80443b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804442:	00 00 00 
+  804445:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444c:	00 00 00 
+  80444f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804456:	00 00 00 
+  804459:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804460:	00 00 00 
+  804463:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446a:	00 00 00 
+  80446d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804474:	00 00 00 
+  804477:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447e:	00 00 00 
+  804481:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804488:	00 00 00 
+  80448b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804492:	00 00 00 
+  804495:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449c:	00 00 00 
+  80449f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a6:	00 00 00 
+  8044a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b0:	00 00 00 
+  8044b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ba:	00 00 00 
+  8044bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c4:	00 00 00 
+  8044c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ce:	00 00 00 
+  8044d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d8:	00 00 00 
+  8044db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e2:	00 00 00 
+  8044e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ec:	00 00 00 
+  8044ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f6:	00 00 00 
+  8044f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804500:	00 00 00 
+  804503:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450a:	00 00 00 
+  80450d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804514:	00 00 00 
+  804517:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451e:	00 00 00 
+  804521:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804528:	00 00 00 
+  80452b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804532:	00 00 00 
+  804535:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453c:	00 00 00 
+  80453f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804546:	00 00 00 
+  804549:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804550:	00 00 00 
+  804553:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455a:	00 00 00 
+  80455d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804564:	00 00 00 
+  804567:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456e:	00 00 00 
+  804571:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804578:	00 00 00 
+  80457b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804582:	00 00 00 
+  804585:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458c:	00 00 00 
+  80458f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804596:	00 00 00 
+  804599:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a0:	00 00 00 
+  8045a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045aa:	00 00 00 
+  8045ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b4:	00 00 00 
+  8045b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045be:	00 00 00 
+  8045c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c8:	00 00 00 
+  8045cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d2:	00 00 00 
+  8045d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045dc:	00 00 00 
+  8045df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e6:	00 00 00 
+  8045e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f0:	00 00 00 
+  8045f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fa:	00 00 00 
+  8045fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804604:	00 00 00 
+  804607:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460e:	00 00 00 
+  804611:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804618:	00 00 00 
+  80461b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804622:	00 00 00 
+  804625:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462c:	00 00 00 
+  80462f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804636:	00 00 00 
+  804639:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804640:	00 00 00 
+  804643:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464a:	00 00 00 
+  80464d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804654:	00 00 00 
+  804657:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465e:	00 00 00 
+  804661:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804668:	00 00 00 
+  80466b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804672:	00 00 00 
+  804675:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467c:	00 00 00 
+  80467f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804686:	00 00 00 
+  804689:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804690:	00 00 00 
+  804693:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469a:	00 00 00 
+  80469d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a4:	00 00 00 
+  8046a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ae:	00 00 00 
+  8046b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b8:	00 00 00 
+  8046bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c2:	00 00 00 
+  8046c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cc:	00 00 00 
+  8046cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d6:	00 00 00 
+  8046d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e0:	00 00 00 
+  8046e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ea:	00 00 00 
+  8046ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f4:	00 00 00 
+  8046f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fe:	00 00 00 
+  804701:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804708:	00 00 00 
+  80470b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804712:	00 00 00 
+  804715:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471c:	00 00 00 
+  80471f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804726:	00 00 00 
+  804729:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804730:	00 00 00 
+  804733:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473a:	00 00 00 
+  80473d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804744:	00 00 00 
+  804747:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474e:	00 00 00 
+  804751:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804758:	00 00 00 
+  80475b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804762:	00 00 00 
+  804765:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476c:	00 00 00 
+  80476f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804776:	00 00 00 
+  804779:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804780:	00 00 00 
+  804783:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478a:	00 00 00 
+  80478d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804794:	00 00 00 
+  804797:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479e:	00 00 00 
+  8047a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a8:	00 00 00 
+  8047ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b2:	00 00 00 
+  8047b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bc:	00 00 00 
+  8047bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c6:	00 00 00 
+  8047c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d0:	00 00 00 
+  8047d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047da:	00 00 00 
+  8047dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e4:	00 00 00 
+  8047e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ee:	00 00 00 
+  8047f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f8:	00 00 00 
+  8047fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804802:	00 00 00 
+  804805:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480c:	00 00 00 
+  80480f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804816:	00 00 00 
+  804819:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804820:	00 00 00 
+  804823:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482a:	00 00 00 
+  80482d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804834:	00 00 00 
+  804837:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483e:	00 00 00 
+  804841:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804848:	00 00 00 
+  80484b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804852:	00 00 00 
+  804855:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485c:	00 00 00 
+  80485f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804866:	00 00 00 
+  804869:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804870:	00 00 00 
+  804873:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487a:	00 00 00 
+  80487d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804884:	00 00 00 
+  804887:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488e:	00 00 00 
+  804891:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804898:	00 00 00 
+  80489b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a2:	00 00 00 
+  8048a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ac:	00 00 00 
+  8048af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b6:	00 00 00 
+  8048b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c0:	00 00 00 
+  8048c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ca:	00 00 00 
+  8048cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d4:	00 00 00 
+  8048d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048de:	00 00 00 
+  8048e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e8:	00 00 00 
+  8048eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f2:	00 00 00 
+  8048f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fc:	00 00 00 
+  8048ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804906:	00 00 00 
+  804909:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804910:	00 00 00 
+  804913:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491a:	00 00 00 
+  80491d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804924:	00 00 00 
+  804927:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492e:	00 00 00 
+  804931:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804938:	00 00 00 
+  80493b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804942:	00 00 00 
+  804945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494c:	00 00 00 
+  80494f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804956:	00 00 00 
+  804959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804960:	00 00 00 
+  804963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496a:	00 00 00 
+  80496d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804974:	00 00 00 
+  804977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497e:	00 00 00 
+  804981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804988:	00 00 00 
+  80498b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804992:	00 00 00 
+  804995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499c:	00 00 00 
+  80499f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a6:	00 00 00 
+  8049a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b0:	00 00 00 
+  8049b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ba:	00 00 00 
+  8049bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c4:	00 00 00 
+  8049c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ce:	00 00 00 
+  8049d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d8:	00 00 00 
+  8049db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e2:	00 00 00 
+  8049e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ec:	00 00 00 
+  8049ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f6:	00 00 00 
+  8049f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a00:	00 00 00 
+  804a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0a:	00 00 00 
+  804a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a14:	00 00 00 
+  804a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1e:	00 00 00 
+  804a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a28:	00 00 00 
+  804a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a32:	00 00 00 
+  804a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3c:	00 00 00 
+  804a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a46:	00 00 00 
+  804a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a50:	00 00 00 
+  804a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5a:	00 00 00 
+  804a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a64:	00 00 00 
+  804a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6e:	00 00 00 
+  804a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a78:	00 00 00 
+  804a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a82:	00 00 00 
+  804a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8c:	00 00 00 
+  804a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a96:	00 00 00 
+  804a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa0:	00 00 00 
+  804aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaa:	00 00 00 
+  804aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab4:	00 00 00 
+  804ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abe:	00 00 00 
+  804ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac8:	00 00 00 
+  804acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad2:	00 00 00 
+  804ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adc:	00 00 00 
+  804adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae6:	00 00 00 
+  804ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af0:	00 00 00 
+  804af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afa:	00 00 00 
+  804afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b04:	00 00 00 
+  804b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0e:	00 00 00 
+  804b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b18:	00 00 00 
+  804b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b22:	00 00 00 
+  804b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2c:	00 00 00 
+  804b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b36:	00 00 00 
+  804b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b40:	00 00 00 
+  804b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4a:	00 00 00 
+  804b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b54:	00 00 00 
+  804b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5e:	00 00 00 
+  804b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b68:	00 00 00 
+  804b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b72:	00 00 00 
+  804b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7c:	00 00 00 
+  804b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b86:	00 00 00 
+  804b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b90:	00 00 00 
+  804b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9a:	00 00 00 
+  804b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba4:	00 00 00 
+  804ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bae:	00 00 00 
+  804bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb8:	00 00 00 
+  804bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc2:	00 00 00 
+  804bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcc:	00 00 00 
+  804bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd6:	00 00 00 
+  804bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be0:	00 00 00 
+  804be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bea:	00 00 00 
+  804bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf4:	00 00 00 
+  804bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfe:	00 00 00 
+  804c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c08:	00 00 00 
+  804c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c12:	00 00 00 
+  804c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1c:	00 00 00 
+  804c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c26:	00 00 00 
+  804c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c30:	00 00 00 
+  804c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3a:	00 00 00 
+  804c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c44:	00 00 00 
+  804c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4e:	00 00 00 
+  804c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c58:	00 00 00 
+  804c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c62:	00 00 00 
+  804c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6c:	00 00 00 
+  804c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c76:	00 00 00 
+  804c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c80:	00 00 00 
+  804c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8a:	00 00 00 
+  804c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c94:	00 00 00 
+  804c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9e:	00 00 00 
+  804ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca8:	00 00 00 
+  804cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb2:	00 00 00 
+  804cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbc:	00 00 00 
+  804cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc6:	00 00 00 
+  804cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd0:	00 00 00 
+  804cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cda:	00 00 00 
+  804cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce4:	00 00 00 
+  804ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cee:	00 00 00 
+  804cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf8:	00 00 00 
+  804cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d02:	00 00 00 
+  804d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0c:	00 00 00 
+  804d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d16:	00 00 00 
+  804d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d20:	00 00 00 
+  804d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2a:	00 00 00 
+  804d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d34:	00 00 00 
+  804d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3e:	00 00 00 
+  804d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d48:	00 00 00 
+  804d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d52:	00 00 00 
+  804d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5c:	00 00 00 
+  804d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d66:	00 00 00 
+  804d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d70:	00 00 00 
+  804d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7a:	00 00 00 
+  804d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d84:	00 00 00 
+  804d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8e:	00 00 00 
+  804d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d98:	00 00 00 
+  804d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da2:	00 00 00 
+  804da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dac:	00 00 00 
+  804daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db6:	00 00 00 
+  804db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc0:	00 00 00 
+  804dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dca:	00 00 00 
+  804dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd4:	00 00 00 
+  804dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dde:	00 00 00 
+  804de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de8:	00 00 00 
+  804deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df2:	00 00 00 
+  804df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfc:	00 00 00 
+  804dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e06:	00 00 00 
+  804e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e10:	00 00 00 
+  804e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1a:	00 00 00 
+  804e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e24:	00 00 00 
+  804e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2e:	00 00 00 
+  804e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e38:	00 00 00 
+  804e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e42:	00 00 00 
+  804e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4c:	00 00 00 
+  804e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e56:	00 00 00 
+  804e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e60:	00 00 00 
+  804e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6a:	00 00 00 
+  804e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e74:	00 00 00 
+  804e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7e:	00 00 00 
+  804e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e88:	00 00 00 
+  804e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e92:	00 00 00 
+  804e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9c:	00 00 00 
+  804e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea6:	00 00 00 
+  804ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb0:	00 00 00 
+  804eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eba:	00 00 00 
+  804ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec4:	00 00 00 
+  804ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ece:	00 00 00 
+  804ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed8:	00 00 00 
+  804edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee2:	00 00 00 
+  804ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eec:	00 00 00 
+  804eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef6:	00 00 00 
+  804ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f00:	00 00 00 
+  804f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0a:	00 00 00 
+  804f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f14:	00 00 00 
+  804f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1e:	00 00 00 
+  804f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f28:	00 00 00 
+  804f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f32:	00 00 00 
+  804f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3c:	00 00 00 
+  804f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f46:	00 00 00 
+  804f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f50:	00 00 00 
+  804f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5a:	00 00 00 
+  804f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f64:	00 00 00 
+  804f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6e:	00 00 00 
+  804f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f78:	00 00 00 
+  804f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f82:	00 00 00 
+  804f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8c:	00 00 00 
+  804f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f96:	00 00 00 
+  804f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa0:	00 00 00 
+  804fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faa:	00 00 00 
+  804fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb4:	00 00 00 
+  804fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbe:	00 00 00 
+  804fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc8:	00 00 00 
+  804fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd2:	00 00 00 
+  804fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdc:	00 00 00 
+  804fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe6:	00 00 00 
+  804fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff0:	00 00 00 
+  804ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffa:	00 00 00 
+  804ffd:	0f 1f 00             	nopl   (%rax)
@@ -0,0 +1,8099 @@
+
+obj/user/faultreadkernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2f 00 00 00       	call   800052 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from kernel space */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("I read %08x from location 0x8040000000!\n", *(unsigned *)0x8040000000);
+  800029:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  800030:	00 00 00 
+  800033:	8b 30                	mov    (%rax),%esi
+  800035:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003c:	00 00 00 
+  80003f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800044:	48 ba cb 01 80 00 00 	movabs $0x8001cb,%rdx
+  80004b:	00 00 00 
+  80004e:	ff d2                	call   *%rdx
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 56                	push   %r14
+  800058:	41 55                	push   %r13
+  80005a:	41 54                	push   %r12
+  80005c:	53                   	push   %rbx
+  80005d:	41 89 fd             	mov    %edi,%r13d
+  800060:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800063:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80006a:	00 00 00 
+  80006d:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800074:	00 00 00 
+  800077:	48 39 c2             	cmp    %rax,%rdx
+  80007a:	73 17                	jae    800093 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007f:	49 89 c4             	mov    %rax,%r12
+  800082:	48 83 c3 08          	add    $0x8,%rbx
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	ff 53 f8             	call   *-0x8(%rbx)
+  80008e:	4c 39 e3             	cmp    %r12,%rbx
+  800091:	72 ef                	jb     800082 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800093:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  80009f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a4:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000ab:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b2:	00 00 00 
+  8000b5:	48 01 d0             	add    %rdx,%rax
+  8000b8:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000bf:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c2:	45 85 ed             	test   %r13d,%r13d
+  8000c5:	7e 0d                	jle    8000d4 <libmain+0x82>
+  8000c7:	49 8b 06             	mov    (%r14),%rax
+  8000ca:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000d1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d4:	4c 89 f6             	mov    %r14,%rsi
+  8000d7:	44 89 ef             	mov    %r13d,%edi
+  8000da:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e1:	00 00 00 
+  8000e4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e6:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8000ed:	00 00 00 
+  8000f0:	ff d0                	call   *%rax
+#endif
+}
+  8000f2:	5b                   	pop    %rbx
+  8000f3:	41 5c                	pop    %r12
+  8000f5:	41 5d                	pop    %r13
+  8000f7:	41 5e                	pop    %r14
+  8000f9:	5d                   	pop    %rbp
+  8000fa:	c3                   	ret
+
+00000000008000fb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000fb:	55                   	push   %rbp
+  8000fc:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000ff:	48 b8 df 1e 80 00 00 	movabs $0x801edf,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80010b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800110:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  800117:	00 00 00 
+  80011a:	ff d0                	call   *%rax
+}
+  80011c:	5d                   	pop    %rbp
+  80011d:	c3                   	ret
+
+000000000080011e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80011e:	55                   	push   %rbp
+  80011f:	48 89 e5             	mov    %rsp,%rbp
+  800122:	53                   	push   %rbx
+  800123:	48 83 ec 08          	sub    $0x8,%rsp
+  800127:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80012a:	8b 06                	mov    (%rsi),%eax
+  80012c:	8d 50 01             	lea    0x1(%rax),%edx
+  80012f:	89 16                	mov    %edx,(%rsi)
+  800131:	48 98                	cltq
+  800133:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800138:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80013e:	74 0a                	je     80014a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800140:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800144:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800148:	c9                   	leave
+  800149:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80014a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80014e:	be ff 00 00 00       	mov    $0xff,%esi
+  800153:	48 b8 1a 11 80 00 00 	movabs $0x80111a,%rax
+  80015a:	00 00 00 
+  80015d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80015f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800165:	eb d9                	jmp    800140 <putch+0x22>
+
+0000000000800167 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800167:	55                   	push   %rbp
+  800168:	48 89 e5             	mov    %rsp,%rbp
+  80016b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800172:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800175:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80017c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800181:	b8 00 00 00 00       	mov    $0x0,%eax
+  800186:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800189:	48 89 f1             	mov    %rsi,%rcx
+  80018c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800193:	48 bf 1e 01 80 00 00 	movabs $0x80011e,%rdi
+  80019a:	00 00 00 
+  80019d:	48 b8 1b 03 80 00 00 	movabs $0x80031b,%rax
+  8001a4:	00 00 00 
+  8001a7:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a9:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001b0:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001b7:	48 b8 1a 11 80 00 00 	movabs $0x80111a,%rax
+  8001be:	00 00 00 
+  8001c1:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001c3:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c9:	c9                   	leave
+  8001ca:	c3                   	ret
+
+00000000008001cb <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+  8001cf:	48 83 ec 50          	sub    $0x50,%rsp
+  8001d3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001db:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001df:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001e3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001e7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001f6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001fe:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800202:	48 b8 67 01 80 00 00 	movabs $0x800167,%rax
+  800209:	00 00 00 
+  80020c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80020e:	c9                   	leave
+  80020f:	c3                   	ret
+
+0000000000800210 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800210:	55                   	push   %rbp
+  800211:	48 89 e5             	mov    %rsp,%rbp
+  800214:	41 57                	push   %r15
+  800216:	41 56                	push   %r14
+  800218:	41 55                	push   %r13
+  80021a:	41 54                	push   %r12
+  80021c:	53                   	push   %rbx
+  80021d:	48 83 ec 18          	sub    $0x18,%rsp
+  800221:	49 89 fc             	mov    %rdi,%r12
+  800224:	49 89 f5             	mov    %rsi,%r13
+  800227:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80022b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80022e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800231:	41 89 cf             	mov    %ecx,%r15d
+  800234:	4c 39 fa             	cmp    %r15,%rdx
+  800237:	73 5b                	jae    800294 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800239:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80023d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800241:	85 db                	test   %ebx,%ebx
+  800243:	7e 0e                	jle    800253 <print_num+0x43>
+            putch(padc, put_arg);
+  800245:	4c 89 ee             	mov    %r13,%rsi
+  800248:	44 89 f7             	mov    %r14d,%edi
+  80024b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80024e:	83 eb 01             	sub    $0x1,%ebx
+  800251:	75 f2                	jne    800245 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800253:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800257:	48 b9 44 50 80 00 00 	movabs $0x805044,%rcx
+  80025e:	00 00 00 
+  800261:	48 b8 33 50 80 00 00 	movabs $0x805033,%rax
+  800268:	00 00 00 
+  80026b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80026f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800273:	ba 00 00 00 00       	mov    $0x0,%edx
+  800278:	49 f7 f7             	div    %r15
+  80027b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80027f:	4c 89 ee             	mov    %r13,%rsi
+  800282:	41 ff d4             	call   *%r12
+}
+  800285:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800289:	5b                   	pop    %rbx
+  80028a:	41 5c                	pop    %r12
+  80028c:	41 5d                	pop    %r13
+  80028e:	41 5e                	pop    %r14
+  800290:	41 5f                	pop    %r15
+  800292:	5d                   	pop    %rbp
+  800293:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800294:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800298:	ba 00 00 00 00       	mov    $0x0,%edx
+  80029d:	49 f7 f7             	div    %r15
+  8002a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a4:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002a8:	52                   	push   %rdx
+  8002a9:	45 0f be c9          	movsbl %r9b,%r9d
+  8002ad:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002b1:	48 89 c2             	mov    %rax,%rdx
+  8002b4:	48 b8 10 02 80 00 00 	movabs $0x800210,%rax
+  8002bb:	00 00 00 
+  8002be:	ff d0                	call   *%rax
+  8002c0:	48 83 c4 10          	add    $0x10,%rsp
+  8002c4:	eb 8d                	jmp    800253 <print_num+0x43>
+
+00000000008002c6 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002c6:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002ca:	48 8b 06             	mov    (%rsi),%rax
+  8002cd:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002d1:	73 0a                	jae    8002dd <sprintputch+0x17>
+        *state->start++ = ch;
+  8002d3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002d7:	48 89 16             	mov    %rdx,(%rsi)
+  8002da:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002dd:	c3                   	ret
+
+00000000008002de <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002de:	55                   	push   %rbp
+  8002df:	48 89 e5             	mov    %rsp,%rbp
+  8002e2:	48 83 ec 50          	sub    $0x50,%rsp
+  8002e6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002ea:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002ee:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002f2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800301:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800305:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800309:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80030d:	48 b8 1b 03 80 00 00 	movabs $0x80031b,%rax
+  800314:	00 00 00 
+  800317:	ff d0                	call   *%rax
+}
+  800319:	c9                   	leave
+  80031a:	c3                   	ret
+
+000000000080031b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80031b:	55                   	push   %rbp
+  80031c:	48 89 e5             	mov    %rsp,%rbp
+  80031f:	41 57                	push   %r15
+  800321:	41 56                	push   %r14
+  800323:	41 55                	push   %r13
+  800325:	41 54                	push   %r12
+  800327:	53                   	push   %rbx
+  800328:	48 83 ec 38          	sub    $0x38,%rsp
+  80032c:	49 89 fe             	mov    %rdi,%r14
+  80032f:	49 89 f5             	mov    %rsi,%r13
+  800332:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800335:	48 8b 01             	mov    (%rcx),%rax
+  800338:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80033c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800340:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800344:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800348:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80034c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800350:	0f b6 3b             	movzbl (%rbx),%edi
+  800353:	40 80 ff 25          	cmp    $0x25,%dil
+  800357:	74 18                	je     800371 <vprintfmt+0x56>
+            if (!ch) return;
+  800359:	40 84 ff             	test   %dil,%dil
+  80035c:	0f 84 04 07 00 00    	je     800a66 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800362:	40 0f b6 ff          	movzbl %dil,%edi
+  800366:	4c 89 ee             	mov    %r13,%rsi
+  800369:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80036c:	4c 89 e3             	mov    %r12,%rbx
+  80036f:	eb db                	jmp    80034c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800371:	be 00 00 00 00       	mov    $0x0,%esi
+  800376:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80037a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80037f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800385:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80038c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800390:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800395:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80039a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80039d:	83 e8 23             	sub    $0x23,%eax
+  8003a0:	3c 57                	cmp    $0x57,%al
+  8003a2:	0f 87 a4 06 00 00    	ja     800a4c <vprintfmt+0x731>
+  8003a8:	0f b6 c0             	movzbl %al,%eax
+  8003ab:	48 b9 e0 51 80 00 00 	movabs $0x8051e0,%rcx
+  8003b2:	00 00 00 
+  8003b5:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003b8:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003bb:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003bf:	eb cf                	jmp    800390 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003c1:	49 89 dc             	mov    %rbx,%r12
+  8003c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c9:	eb c5                	jmp    800390 <vprintfmt+0x75>
+            padc = ch;
+  8003cb:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003cf:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003d5:	eb b9                	jmp    800390 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003da:	83 f8 2f             	cmp    $0x2f,%eax
+  8003dd:	77 24                	ja     800403 <vprintfmt+0xe8>
+  8003df:	89 c1                	mov    %eax,%ecx
+  8003e1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003e5:	83 c0 08             	add    $0x8,%eax
+  8003e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003eb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003ee:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003f5:	79 99                	jns    800390 <vprintfmt+0x75>
+                width = precision;
+  8003f7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003fb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800401:	eb 8d                	jmp    800390 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800403:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800407:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80040b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80040f:	eb da                	jmp    8003eb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800411:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800416:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80041a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800420:	3c 39                	cmp    $0x39,%al
+  800422:	77 1c                	ja     800440 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800424:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800428:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80042c:	0f b6 c0             	movzbl %al,%eax
+  80042f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800434:	0f b6 03             	movzbl (%rbx),%eax
+  800437:	3c 39                	cmp    $0x39,%al
+  800439:	76 e9                	jbe    800424 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80043b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80043e:	eb b1                	jmp    8003f1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800440:	49 89 dc             	mov    %rbx,%r12
+  800443:	eb ac                	jmp    8003f1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800445:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800448:	85 c9                	test   %ecx,%ecx
+  80044a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044f:	0f 49 c1             	cmovns %ecx,%eax
+  800452:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800455:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800458:	e9 33 ff ff ff       	jmp    800390 <vprintfmt+0x75>
+            lflag++;
+  80045d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800460:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800463:	e9 28 ff ff ff       	jmp    800390 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800468:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80046b:	83 f8 2f             	cmp    $0x2f,%eax
+  80046e:	77 19                	ja     800489 <vprintfmt+0x16e>
+  800470:	89 c2                	mov    %eax,%edx
+  800472:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800476:	83 c0 08             	add    $0x8,%eax
+  800479:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80047c:	8b 3a                	mov    (%rdx),%edi
+  80047e:	4c 89 ee             	mov    %r13,%rsi
+  800481:	41 ff d6             	call   *%r14
+            break;
+  800484:	e9 c3 fe ff ff       	jmp    80034c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800489:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80048d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800491:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800495:	eb e5                	jmp    80047c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800497:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80049a:	83 f8 2f             	cmp    $0x2f,%eax
+  80049d:	77 5a                	ja     8004f9 <vprintfmt+0x1de>
+  80049f:	89 c2                	mov    %eax,%edx
+  8004a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004a5:	83 c0 08             	add    $0x8,%eax
+  8004a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004ab:	8b 02                	mov    (%rdx),%eax
+  8004ad:	89 c1                	mov    %eax,%ecx
+  8004af:	f7 d9                	neg    %ecx
+  8004b1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004b4:	83 f9 13             	cmp    $0x13,%ecx
+  8004b7:	7f 4e                	jg     800507 <vprintfmt+0x1ec>
+  8004b9:	48 63 c1             	movslq %ecx,%rax
+  8004bc:	48 ba a0 54 80 00 00 	movabs $0x8054a0,%rdx
+  8004c3:	00 00 00 
+  8004c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004ca:	48 85 c0             	test   %rax,%rax
+  8004cd:	74 38                	je     800507 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004cf:	48 89 c1             	mov    %rax,%rcx
+  8004d2:	48 ba d9 56 80 00 00 	movabs $0x8056d9,%rdx
+  8004d9:	00 00 00 
+  8004dc:	4c 89 ee             	mov    %r13,%rsi
+  8004df:	4c 89 f7             	mov    %r14,%rdi
+  8004e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e7:	49 b8 de 02 80 00 00 	movabs $0x8002de,%r8
+  8004ee:	00 00 00 
+  8004f1:	41 ff d0             	call   *%r8
+  8004f4:	e9 53 fe ff ff       	jmp    80034c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800501:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800505:	eb a4                	jmp    8004ab <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800507:	48 ba 5c 50 80 00 00 	movabs $0x80505c,%rdx
+  80050e:	00 00 00 
+  800511:	4c 89 ee             	mov    %r13,%rsi
+  800514:	4c 89 f7             	mov    %r14,%rdi
+  800517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051c:	49 b8 de 02 80 00 00 	movabs $0x8002de,%r8
+  800523:	00 00 00 
+  800526:	41 ff d0             	call   *%r8
+  800529:	e9 1e fe ff ff       	jmp    80034c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80052e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800531:	83 f8 2f             	cmp    $0x2f,%eax
+  800534:	77 36                	ja     80056c <vprintfmt+0x251>
+  800536:	89 c2                	mov    %eax,%edx
+  800538:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80053c:	83 c0 08             	add    $0x8,%eax
+  80053f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800542:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800545:	48 85 f6             	test   %rsi,%rsi
+  800548:	48 b8 55 50 80 00 00 	movabs $0x805055,%rax
+  80054f:	00 00 00 
+  800552:	48 0f 45 c6          	cmovne %rsi,%rax
+  800556:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80055a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80055e:	7e 06                	jle    800566 <vprintfmt+0x24b>
+  800560:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800564:	75 14                	jne    80057a <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800566:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80056a:	eb 5b                	jmp    8005c7 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80056c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800570:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800574:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800578:	eb c8                	jmp    800542 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80057a:	49 63 f7             	movslq %r15d,%rsi
+  80057d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800581:	48 b8 20 0b 80 00 00 	movabs $0x800b20,%rax
+  800588:	00 00 00 
+  80058b:	ff d0                	call   *%rax
+  80058d:	48 89 c2             	mov    %rax,%rdx
+  800590:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800593:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800595:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800598:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80059b:	85 c0                	test   %eax,%eax
+  80059d:	7e c7                	jle    800566 <vprintfmt+0x24b>
+  80059f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005a4:	4c 89 ee             	mov    %r13,%rsi
+  8005a7:	44 89 e7             	mov    %r12d,%edi
+  8005aa:	41 ff d6             	call   *%r14
+  8005ad:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005b1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005b4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005b7:	75 eb                	jne    8005a4 <vprintfmt+0x289>
+  8005b9:	eb ab                	jmp    800566 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005bb:	0f b6 f8             	movzbl %al,%edi
+  8005be:	4c 89 ee             	mov    %r13,%rsi
+  8005c1:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8005c4:	4c 89 e2             	mov    %r12,%rdx
+  8005c7:	45 85 ff             	test   %r15d,%r15d
+  8005ca:	78 06                	js     8005d2 <vprintfmt+0x2b7>
+  8005cc:	41 83 ef 01          	sub    $0x1,%r15d
+  8005d0:	78 23                	js     8005f5 <vprintfmt+0x2da>
+  8005d2:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8005d6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8005dc:	84 c0                	test   %al,%al
+  8005de:	74 15                	je     8005f5 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005e0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8005e4:	74 d5                	je     8005bb <vprintfmt+0x2a0>
+  8005e6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8005e9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8005ee:	80 fa 5e             	cmp    $0x5e,%dl
+  8005f1:	77 cb                	ja     8005be <vprintfmt+0x2a3>
+  8005f3:	eb c6                	jmp    8005bb <vprintfmt+0x2a0>
+  8005f5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005f8:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8005fb:	01 f0                	add    %esi,%eax
+  8005fd:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8005ff:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800603:	85 c0                	test   %eax,%eax
+  800605:	0f 8e 41 fd ff ff    	jle    80034c <vprintfmt+0x31>
+  80060b:	4c 89 ee             	mov    %r13,%rsi
+  80060e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800613:	41 ff d6             	call   *%r14
+  800616:	41 83 ec 01          	sub    $0x1,%r12d
+  80061a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80061e:	75 eb                	jne    80060b <vprintfmt+0x2f0>
+  800620:	e9 27 fd ff ff       	jmp    80034c <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800625:	40 84 f6             	test   %sil,%sil
+  800628:	75 26                	jne    800650 <vprintfmt+0x335>
+    switch (lflag) {
+  80062a:	85 d2                	test   %edx,%edx
+  80062c:	74 59                	je     800687 <vprintfmt+0x36c>
+  80062e:	83 fa 01             	cmp    $0x1,%edx
+  800631:	74 7b                	je     8006ae <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800633:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800636:	83 f8 2f             	cmp    $0x2f,%eax
+  800639:	0f 87 96 00 00 00    	ja     8006d5 <vprintfmt+0x3ba>
+  80063f:	89 c2                	mov    %eax,%edx
+  800641:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800645:	83 c0 08             	add    $0x8,%eax
+  800648:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80064b:	4c 8b 22             	mov    (%rdx),%r12
+  80064e:	eb 17                	jmp    800667 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800650:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800653:	83 f8 2f             	cmp    $0x2f,%eax
+  800656:	77 21                	ja     800679 <vprintfmt+0x35e>
+  800658:	89 c2                	mov    %eax,%edx
+  80065a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80065e:	83 c0 08             	add    $0x8,%eax
+  800661:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800664:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800667:	4d 85 e4             	test   %r12,%r12
+  80066a:	78 7a                	js     8006e6 <vprintfmt+0x3cb>
+            num = i;
+  80066c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80066f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800674:	e9 b5 02 00 00       	jmp    80092e <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800679:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80067d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800681:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800685:	eb dd                	jmp    800664 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800687:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068a:	83 f8 2f             	cmp    $0x2f,%eax
+  80068d:	77 11                	ja     8006a0 <vprintfmt+0x385>
+  80068f:	89 c2                	mov    %eax,%edx
+  800691:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800695:	83 c0 08             	add    $0x8,%eax
+  800698:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069b:	4c 63 22             	movslq (%rdx),%r12
+  80069e:	eb c7                	jmp    800667 <vprintfmt+0x34c>
+  8006a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ac:	eb ed                	jmp    80069b <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8006ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b4:	77 11                	ja     8006c7 <vprintfmt+0x3ac>
+  8006b6:	89 c2                	mov    %eax,%edx
+  8006b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bc:	83 c0 08             	add    $0x8,%eax
+  8006bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c2:	4c 8b 22             	mov    (%rdx),%r12
+  8006c5:	eb a0                	jmp    800667 <vprintfmt+0x34c>
+  8006c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d3:	eb ed                	jmp    8006c2 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8006d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e1:	e9 65 ff ff ff       	jmp    80064b <vprintfmt+0x330>
+                putch('-', put_arg);
+  8006e6:	4c 89 ee             	mov    %r13,%rsi
+  8006e9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006ee:	41 ff d6             	call   *%r14
+                i = -i;
+  8006f1:	49 f7 dc             	neg    %r12
+  8006f4:	e9 73 ff ff ff       	jmp    80066c <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8006f9:	40 84 f6             	test   %sil,%sil
+  8006fc:	75 32                	jne    800730 <vprintfmt+0x415>
+    switch (lflag) {
+  8006fe:	85 d2                	test   %edx,%edx
+  800700:	74 5d                	je     80075f <vprintfmt+0x444>
+  800702:	83 fa 01             	cmp    $0x1,%edx
+  800705:	0f 84 82 00 00 00    	je     80078d <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  80070b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070e:	83 f8 2f             	cmp    $0x2f,%eax
+  800711:	0f 87 a5 00 00 00    	ja     8007bc <vprintfmt+0x4a1>
+  800717:	89 c2                	mov    %eax,%edx
+  800719:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80071d:	83 c0 08             	add    $0x8,%eax
+  800720:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800723:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80072b:	e9 fe 01 00 00       	jmp    80092e <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800730:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800733:	83 f8 2f             	cmp    $0x2f,%eax
+  800736:	77 19                	ja     800751 <vprintfmt+0x436>
+  800738:	89 c2                	mov    %eax,%edx
+  80073a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073e:	83 c0 08             	add    $0x8,%eax
+  800741:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800744:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800747:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80074c:	e9 dd 01 00 00       	jmp    80092e <vprintfmt+0x613>
+  800751:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800755:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800759:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075d:	eb e5                	jmp    800744 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80075f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800762:	83 f8 2f             	cmp    $0x2f,%eax
+  800765:	77 18                	ja     80077f <vprintfmt+0x464>
+  800767:	89 c2                	mov    %eax,%edx
+  800769:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076d:	83 c0 08             	add    $0x8,%eax
+  800770:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800773:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800775:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80077a:	e9 af 01 00 00       	jmp    80092e <vprintfmt+0x613>
+  80077f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800783:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800787:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078b:	eb e6                	jmp    800773 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80078d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800790:	83 f8 2f             	cmp    $0x2f,%eax
+  800793:	77 19                	ja     8007ae <vprintfmt+0x493>
+  800795:	89 c2                	mov    %eax,%edx
+  800797:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079b:	83 c0 08             	add    $0x8,%eax
+  80079e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007a4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007a9:	e9 80 01 00 00       	jmp    80092e <vprintfmt+0x613>
+  8007ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ba:	eb e5                	jmp    8007a1 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8007bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c8:	e9 56 ff ff ff       	jmp    800723 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8007cd:	40 84 f6             	test   %sil,%sil
+  8007d0:	75 2e                	jne    800800 <vprintfmt+0x4e5>
+    switch (lflag) {
+  8007d2:	85 d2                	test   %edx,%edx
+  8007d4:	0f 84 b3 00 00 00    	je     80088d <vprintfmt+0x572>
+  8007da:	83 fa 01             	cmp    $0x1,%edx
+  8007dd:	0f 84 d3 00 00 00    	je     8008b6 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8007e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e9:	0f 87 f1 00 00 00    	ja     8008e0 <vprintfmt+0x5c5>
+  8007ef:	89 c2                	mov    %eax,%edx
+  8007f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f5:	83 c0 08             	add    $0x8,%eax
+  8007f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007fb:	48 8b 02             	mov    (%rdx),%rax
+  8007fe:	eb 17                	jmp    800817 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800800:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800803:	83 f8 2f             	cmp    $0x2f,%eax
+  800806:	77 77                	ja     80087f <vprintfmt+0x564>
+  800808:	89 c2                	mov    %eax,%edx
+  80080a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080e:	83 c0 08             	add    $0x8,%eax
+  800811:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800814:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800817:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800819:	83 f8 07             	cmp    $0x7,%eax
+  80081c:	0f 8e cf 00 00 00    	jle    8008f1 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800822:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800828:	44 89 e7             	mov    %r12d,%edi
+  80082b:	41 c1 e4 03          	shl    $0x3,%r12d
+  80082f:	89 d1                	mov    %edx,%ecx
+  800831:	8d 72 07             	lea    0x7(%rdx),%esi
+  800834:	85 d2                	test   %edx,%edx
+  800836:	0f 48 d6             	cmovs  %esi,%edx
+  800839:	c1 fa 03             	sar    $0x3,%edx
+  80083c:	83 f9 3f             	cmp    $0x3f,%ecx
+  80083f:	7f e7                	jg     800828 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800841:	85 ff                	test   %edi,%edi
+  800843:	0f 84 03 fb ff ff    	je     80034c <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800849:	49 63 f4             	movslq %r12d,%rsi
+  80084c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800851:	48 f7 f6             	div    %rsi
+  800854:	49 89 d7             	mov    %rdx,%r15
+  800857:	83 c0 30             	add    $0x30,%eax
+  80085a:	0f be f8             	movsbl %al,%edi
+  80085d:	4c 89 ee             	mov    %r13,%rsi
+  800860:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800863:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800866:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  80086b:	45 85 e4             	test   %r12d,%r12d
+  80086e:	41 0f 49 d4          	cmovns %r12d,%edx
+  800872:	c1 fa 03             	sar    $0x3,%edx
+  800875:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800878:	75 cf                	jne    800849 <vprintfmt+0x52e>
+  80087a:	e9 cd fa ff ff       	jmp    80034c <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80087f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800883:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800887:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088b:	eb 87                	jmp    800814 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80088d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800890:	83 f8 2f             	cmp    $0x2f,%eax
+  800893:	77 13                	ja     8008a8 <vprintfmt+0x58d>
+  800895:	89 c2                	mov    %eax,%edx
+  800897:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089b:	83 c0 08             	add    $0x8,%eax
+  80089e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a1:	8b 02                	mov    (%rdx),%eax
+  8008a3:	e9 6f ff ff ff       	jmp    800817 <vprintfmt+0x4fc>
+  8008a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b4:	eb eb                	jmp    8008a1 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8008b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bc:	77 14                	ja     8008d2 <vprintfmt+0x5b7>
+  8008be:	89 c2                	mov    %eax,%edx
+  8008c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c4:	83 c0 08             	add    $0x8,%eax
+  8008c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ca:	48 8b 02             	mov    (%rdx),%rax
+  8008cd:	e9 45 ff ff ff       	jmp    800817 <vprintfmt+0x4fc>
+  8008d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008de:	eb ea                	jmp    8008ca <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8008e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ec:	e9 0a ff ff ff       	jmp    8007fb <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8008f1:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8008f7:	e9 4d ff ff ff       	jmp    800849 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8008fc:	4c 89 ee             	mov    %r13,%rsi
+  8008ff:	bf 30 00 00 00       	mov    $0x30,%edi
+  800904:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800907:	4c 89 ee             	mov    %r13,%rsi
+  80090a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80090f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800912:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800915:	83 f8 2f             	cmp    $0x2f,%eax
+  800918:	77 47                	ja     800961 <vprintfmt+0x646>
+  80091a:	89 c2                	mov    %eax,%edx
+  80091c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800920:	83 c0 08             	add    $0x8,%eax
+  800923:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800926:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800929:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80092e:	48 83 ec 08          	sub    $0x8,%rsp
+  800932:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800936:	0f 94 c0             	sete   %al
+  800939:	0f b6 c0             	movzbl %al,%eax
+  80093c:	50                   	push   %rax
+  80093d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800942:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800946:	4c 89 ee             	mov    %r13,%rsi
+  800949:	4c 89 f7             	mov    %r14,%rdi
+  80094c:	48 b8 10 02 80 00 00 	movabs $0x800210,%rax
+  800953:	00 00 00 
+  800956:	ff d0                	call   *%rax
+            break;
+  800958:	48 83 c4 10          	add    $0x10,%rsp
+  80095c:	e9 eb f9 ff ff       	jmp    80034c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800961:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800965:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800969:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096d:	eb b7                	jmp    800926 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  80096f:	40 84 f6             	test   %sil,%sil
+  800972:	75 2b                	jne    80099f <vprintfmt+0x684>
+    switch (lflag) {
+  800974:	85 d2                	test   %edx,%edx
+  800976:	74 56                	je     8009ce <vprintfmt+0x6b3>
+  800978:	83 fa 01             	cmp    $0x1,%edx
+  80097b:	74 7f                	je     8009fc <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  80097d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800980:	83 f8 2f             	cmp    $0x2f,%eax
+  800983:	0f 87 a2 00 00 00    	ja     800a2b <vprintfmt+0x710>
+  800989:	89 c2                	mov    %eax,%edx
+  80098b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098f:	83 c0 08             	add    $0x8,%eax
+  800992:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800995:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800998:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80099d:	eb 8f                	jmp    80092e <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80099f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a5:	77 19                	ja     8009c0 <vprintfmt+0x6a5>
+  8009a7:	89 c2                	mov    %eax,%edx
+  8009a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ad:	83 c0 08             	add    $0x8,%eax
+  8009b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009bb:	e9 6e ff ff ff       	jmp    80092e <vprintfmt+0x613>
+  8009c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cc:	eb e5                	jmp    8009b3 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8009ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d4:	77 18                	ja     8009ee <vprintfmt+0x6d3>
+  8009d6:	89 c2                	mov    %eax,%edx
+  8009d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009dc:	83 c0 08             	add    $0x8,%eax
+  8009df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009e4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009e9:	e9 40 ff ff ff       	jmp    80092e <vprintfmt+0x613>
+  8009ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fa:	eb e6                	jmp    8009e2 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8009fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800a02:	77 19                	ja     800a1d <vprintfmt+0x702>
+  800a04:	89 c2                	mov    %eax,%edx
+  800a06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0a:	83 c0 08             	add    $0x8,%eax
+  800a0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a13:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a18:	e9 11 ff ff ff       	jmp    80092e <vprintfmt+0x613>
+  800a1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a29:	eb e5                	jmp    800a10 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800a2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a37:	e9 59 ff ff ff       	jmp    800995 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800a3c:	4c 89 ee             	mov    %r13,%rsi
+  800a3f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a44:	41 ff d6             	call   *%r14
+            break;
+  800a47:	e9 00 f9 ff ff       	jmp    80034c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a4c:	4c 89 ee             	mov    %r13,%rsi
+  800a4f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a54:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a57:	48 83 eb 01          	sub    $0x1,%rbx
+  800a5b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a5f:	75 f6                	jne    800a57 <vprintfmt+0x73c>
+  800a61:	e9 e6 f8 ff ff       	jmp    80034c <vprintfmt+0x31>
+}
+  800a66:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a6a:	5b                   	pop    %rbx
+  800a6b:	41 5c                	pop    %r12
+  800a6d:	41 5d                	pop    %r13
+  800a6f:	41 5e                	pop    %r14
+  800a71:	41 5f                	pop    %r15
+  800a73:	5d                   	pop    %rbp
+  800a74:	c3                   	ret
+
+0000000000800a75 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a75:	55                   	push   %rbp
+  800a76:	48 89 e5             	mov    %rsp,%rbp
+  800a79:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a7d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a81:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a86:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a8a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a91:	48 85 ff             	test   %rdi,%rdi
+  800a94:	74 2b                	je     800ac1 <vsnprintf+0x4c>
+  800a96:	48 85 f6             	test   %rsi,%rsi
+  800a99:	74 26                	je     800ac1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a9b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a9f:	48 bf c6 02 80 00 00 	movabs $0x8002c6,%rdi
+  800aa6:	00 00 00 
+  800aa9:	48 b8 1b 03 80 00 00 	movabs $0x80031b,%rax
+  800ab0:	00 00 00 
+  800ab3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ab5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800abc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800abf:	c9                   	leave
+  800ac0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ac1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac6:	eb f7                	jmp    800abf <vsnprintf+0x4a>
+
+0000000000800ac8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ac8:	55                   	push   %rbp
+  800ac9:	48 89 e5             	mov    %rsp,%rbp
+  800acc:	48 83 ec 50          	sub    $0x50,%rsp
+  800ad0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ad4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ad8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800adc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ae3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ae7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aeb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800af3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800af7:	48 b8 75 0a 80 00 00 	movabs $0x800a75,%rax
+  800afe:	00 00 00 
+  800b01:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b03:	c9                   	leave
+  800b04:	c3                   	ret
+
+0000000000800b05 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b05:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b08:	74 10                	je     800b1a <strlen+0x15>
+    size_t n = 0;
+  800b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b0f:	48 83 c0 01          	add    $0x1,%rax
+  800b13:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b17:	75 f6                	jne    800b0f <strlen+0xa>
+  800b19:	c3                   	ret
+    size_t n = 0;
+  800b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b1f:	c3                   	ret
+
+0000000000800b20 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b20:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b23:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b28:	48 85 f6             	test   %rsi,%rsi
+  800b2b:	74 11                	je     800b3e <strnlen+0x1e>
+  800b2d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b31:	74 0c                	je     800b3f <strnlen+0x1f>
+  800b33:	48 83 c2 01          	add    $0x1,%rdx
+  800b37:	48 39 d0             	cmp    %rdx,%rax
+  800b3a:	75 f1                	jne    800b2d <strnlen+0xd>
+  800b3c:	eb 04                	jmp    800b42 <strnlen+0x22>
+  800b3e:	c3                   	ret
+  800b3f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b42:	c3                   	ret
+
+0000000000800b43 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b43:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b4f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b52:	48 83 c2 01          	add    $0x1,%rdx
+  800b56:	84 c9                	test   %cl,%cl
+  800b58:	75 f1                	jne    800b4b <strcpy+0x8>
+        ;
+    return res;
+}
+  800b5a:	c3                   	ret
+
+0000000000800b5b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b5b:	55                   	push   %rbp
+  800b5c:	48 89 e5             	mov    %rsp,%rbp
+  800b5f:	41 54                	push   %r12
+  800b61:	53                   	push   %rbx
+  800b62:	48 89 fb             	mov    %rdi,%rbx
+  800b65:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b68:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  800b6f:	00 00 00 
+  800b72:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b74:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b78:	4c 89 e6             	mov    %r12,%rsi
+  800b7b:	48 b8 43 0b 80 00 00 	movabs $0x800b43,%rax
+  800b82:	00 00 00 
+  800b85:	ff d0                	call   *%rax
+    return dst;
+}
+  800b87:	48 89 d8             	mov    %rbx,%rax
+  800b8a:	5b                   	pop    %rbx
+  800b8b:	41 5c                	pop    %r12
+  800b8d:	5d                   	pop    %rbp
+  800b8e:	c3                   	ret
+
+0000000000800b8f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b8f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b92:	48 85 d2             	test   %rdx,%rdx
+  800b95:	74 1f                	je     800bb6 <strncpy+0x27>
+  800b97:	48 01 fa             	add    %rdi,%rdx
+  800b9a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b9d:	48 83 c1 01          	add    $0x1,%rcx
+  800ba1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ba5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ba9:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bad:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bb1:	48 39 ca             	cmp    %rcx,%rdx
+  800bb4:	75 e7                	jne    800b9d <strncpy+0xe>
+    }
+    return ret;
+}
+  800bb6:	c3                   	ret
+
+0000000000800bb7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bb7:	48 89 f8             	mov    %rdi,%rax
+  800bba:	48 85 d2             	test   %rdx,%rdx
+  800bbd:	74 24                	je     800be3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bbf:	48 83 ea 01          	sub    $0x1,%rdx
+  800bc3:	74 1b                	je     800be0 <strlcpy+0x29>
+  800bc5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bc9:	0f b6 16             	movzbl (%rsi),%edx
+  800bcc:	84 d2                	test   %dl,%dl
+  800bce:	74 10                	je     800be0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800bd0:	48 83 c6 01          	add    $0x1,%rsi
+  800bd4:	48 83 c0 01          	add    $0x1,%rax
+  800bd8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bdb:	48 39 c8             	cmp    %rcx,%rax
+  800bde:	75 e9                	jne    800bc9 <strlcpy+0x12>
+        *dst = '\0';
+  800be0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800be3:	48 29 f8             	sub    %rdi,%rax
+}
+  800be6:	c3                   	ret
+
+0000000000800be7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800be7:	0f b6 07             	movzbl (%rdi),%eax
+  800bea:	84 c0                	test   %al,%al
+  800bec:	74 13                	je     800c01 <strcmp+0x1a>
+  800bee:	38 06                	cmp    %al,(%rsi)
+  800bf0:	75 0f                	jne    800c01 <strcmp+0x1a>
+  800bf2:	48 83 c7 01          	add    $0x1,%rdi
+  800bf6:	48 83 c6 01          	add    $0x1,%rsi
+  800bfa:	0f b6 07             	movzbl (%rdi),%eax
+  800bfd:	84 c0                	test   %al,%al
+  800bff:	75 ed                	jne    800bee <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c01:	0f b6 c0             	movzbl %al,%eax
+  800c04:	0f b6 16             	movzbl (%rsi),%edx
+  800c07:	29 d0                	sub    %edx,%eax
+}
+  800c09:	c3                   	ret
+
+0000000000800c0a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c0a:	48 85 d2             	test   %rdx,%rdx
+  800c0d:	74 1f                	je     800c2e <strncmp+0x24>
+  800c0f:	0f b6 07             	movzbl (%rdi),%eax
+  800c12:	84 c0                	test   %al,%al
+  800c14:	74 1e                	je     800c34 <strncmp+0x2a>
+  800c16:	3a 06                	cmp    (%rsi),%al
+  800c18:	75 1a                	jne    800c34 <strncmp+0x2a>
+  800c1a:	48 83 c7 01          	add    $0x1,%rdi
+  800c1e:	48 83 c6 01          	add    $0x1,%rsi
+  800c22:	48 83 ea 01          	sub    $0x1,%rdx
+  800c26:	75 e7                	jne    800c0f <strncmp+0x5>
+
+    if (!n) return 0;
+  800c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2d:	c3                   	ret
+  800c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c33:	c3                   	ret
+  800c34:	48 85 d2             	test   %rdx,%rdx
+  800c37:	74 09                	je     800c42 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c39:	0f b6 07             	movzbl (%rdi),%eax
+  800c3c:	0f b6 16             	movzbl (%rsi),%edx
+  800c3f:	29 d0                	sub    %edx,%eax
+  800c41:	c3                   	ret
+    if (!n) return 0;
+  800c42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c47:	c3                   	ret
+
+0000000000800c48 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c48:	0f b6 17             	movzbl (%rdi),%edx
+  800c4b:	84 d2                	test   %dl,%dl
+  800c4d:	74 18                	je     800c67 <strchr+0x1f>
+        if (*str == c) {
+  800c4f:	0f be d2             	movsbl %dl,%edx
+  800c52:	39 f2                	cmp    %esi,%edx
+  800c54:	74 17                	je     800c6d <strchr+0x25>
+    for (; *str; str++) {
+  800c56:	48 83 c7 01          	add    $0x1,%rdi
+  800c5a:	0f b6 17             	movzbl (%rdi),%edx
+  800c5d:	84 d2                	test   %dl,%dl
+  800c5f:	75 ee                	jne    800c4f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c66:	c3                   	ret
+  800c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6c:	c3                   	ret
+  800c6d:	48 89 f8             	mov    %rdi,%rax
+}
+  800c70:	c3                   	ret
+
+0000000000800c71 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c71:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c74:	0f b6 17             	movzbl (%rdi),%edx
+  800c77:	84 d2                	test   %dl,%dl
+  800c79:	74 13                	je     800c8e <strfind+0x1d>
+  800c7b:	0f be d2             	movsbl %dl,%edx
+  800c7e:	39 f2                	cmp    %esi,%edx
+  800c80:	74 0b                	je     800c8d <strfind+0x1c>
+  800c82:	48 83 c0 01          	add    $0x1,%rax
+  800c86:	0f b6 10             	movzbl (%rax),%edx
+  800c89:	84 d2                	test   %dl,%dl
+  800c8b:	75 ee                	jne    800c7b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c8d:	c3                   	ret
+  800c8e:	c3                   	ret
+
+0000000000800c8f <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800c8f:	55                   	push   %rbp
+  800c90:	48 89 e5             	mov    %rsp,%rbp
+  800c93:	41 57                	push   %r15
+  800c95:	41 56                	push   %r14
+  800c97:	41 55                	push   %r13
+  800c99:	41 54                	push   %r12
+  800c9b:	53                   	push   %rbx
+  800c9c:	48 83 ec 08          	sub    $0x8,%rsp
+  800ca0:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800ca3:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800ca7:	45 84 ed             	test   %r13b,%r13b
+  800caa:	75 12                	jne    800cbe <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800cac:	4c 89 f8             	mov    %r15,%rax
+  800caf:	48 83 c4 08          	add    $0x8,%rsp
+  800cb3:	5b                   	pop    %rbx
+  800cb4:	41 5c                	pop    %r12
+  800cb6:	41 5d                	pop    %r13
+  800cb8:	41 5e                	pop    %r14
+  800cba:	41 5f                	pop    %r15
+  800cbc:	5d                   	pop    %rbp
+  800cbd:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800cbe:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800cc2:	4c 89 e7             	mov    %r12,%rdi
+  800cc5:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  800ccc:	00 00 00 
+  800ccf:	ff d0                	call   *%rax
+  800cd1:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800cd4:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800cd8:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800cdc:	49 bf 0a 0c 80 00 00 	movabs $0x800c0a,%r15
+  800ce3:	00 00 00 
+				if ((sc = *s++) == 0)
+  800ce6:	84 c0                	test   %al,%al
+  800ce8:	75 14                	jne    800cfe <strstr+0x6f>
+					return NULL;
+  800cea:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800cf0:	eb ba                	jmp    800cac <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800cf2:	48 83 c3 01          	add    $0x1,%rbx
+  800cf6:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800cfa:	84 c0                	test   %al,%al
+  800cfc:	74 1b                	je     800d19 <strstr+0x8a>
+			} while (sc != c);
+  800cfe:	41 38 c5             	cmp    %al,%r13b
+  800d01:	75 ef                	jne    800cf2 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800d03:	4c 89 f2             	mov    %r14,%rdx
+  800d06:	4c 89 e6             	mov    %r12,%rsi
+  800d09:	48 89 df             	mov    %rbx,%rdi
+  800d0c:	41 ff d7             	call   *%r15
+  800d0f:	85 c0                	test   %eax,%eax
+  800d11:	75 df                	jne    800cf2 <strstr+0x63>
+  800d13:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800d17:	eb 93                	jmp    800cac <strstr+0x1d>
+					return NULL;
+  800d19:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d1f:	eb 8b                	jmp    800cac <strstr+0x1d>
+
+0000000000800d21 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800d21:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800d23:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800d26:	8d 57 20             	lea    0x20(%rdi),%edx
+  800d29:	83 f9 1a             	cmp    $0x1a,%ecx
+  800d2c:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800d2f:	c3                   	ret
+
+0000000000800d30 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800d30:	55                   	push   %rbp
+  800d31:	48 89 e5             	mov    %rsp,%rbp
+  800d34:	41 57                	push   %r15
+  800d36:	41 56                	push   %r14
+  800d38:	41 55                	push   %r13
+  800d3a:	41 54                	push   %r12
+  800d3c:	53                   	push   %rbx
+  800d3d:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800d41:	48 39 f7             	cmp    %rsi,%rdi
+  800d44:	74 49                	je     800d8f <strcasecmp+0x5f>
+  800d46:	49 89 fd             	mov    %rdi,%r13
+  800d49:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800d4c:	49 bf 21 0d 80 00 00 	movabs $0x800d21,%r15
+  800d53:	00 00 00 
+  800d56:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800d5b:	41 0f b6 fe          	movzbl %r14b,%edi
+  800d5f:	41 ff d7             	call   *%r15
+  800d62:	89 c3                	mov    %eax,%ebx
+  800d64:	49 83 c4 01          	add    $0x1,%r12
+  800d68:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800d6e:	41 ff d7             	call   *%r15
+  800d71:	29 c3                	sub    %eax,%ebx
+  800d73:	75 09                	jne    800d7e <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800d75:	49 83 c5 01          	add    $0x1,%r13
+  800d79:	45 84 f6             	test   %r14b,%r14b
+  800d7c:	75 d8                	jne    800d56 <strcasecmp+0x26>
+}
+  800d7e:	89 d8                	mov    %ebx,%eax
+  800d80:	48 83 c4 08          	add    $0x8,%rsp
+  800d84:	5b                   	pop    %rbx
+  800d85:	41 5c                	pop    %r12
+  800d87:	41 5d                	pop    %r13
+  800d89:	41 5e                	pop    %r14
+  800d8b:	41 5f                	pop    %r15
+  800d8d:	5d                   	pop    %rbp
+  800d8e:	c3                   	ret
+        return 0;
+  800d8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d94:	eb e8                	jmp    800d7e <strcasecmp+0x4e>
+
+0000000000800d96 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800d96:	55                   	push   %rbp
+  800d97:	48 89 e5             	mov    %rsp,%rbp
+  800d9a:	41 57                	push   %r15
+  800d9c:	41 56                	push   %r14
+  800d9e:	41 55                	push   %r13
+  800da0:	41 54                	push   %r12
+  800da2:	53                   	push   %rbx
+  800da3:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800da7:	48 85 d2             	test   %rdx,%rdx
+  800daa:	74 4f                	je     800dfb <strncasecmp+0x65>
+  800dac:	49 89 fc             	mov    %rdi,%r12
+  800daf:	49 89 f5             	mov    %rsi,%r13
+  800db2:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800db6:	49 be 21 0d 80 00 00 	movabs $0x800d21,%r14
+  800dbd:	00 00 00 
+  800dc0:	49 83 c4 01          	add    $0x1,%r12
+  800dc4:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800dca:	41 ff d6             	call   *%r14
+  800dcd:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800dcf:	49 83 c5 01          	add    $0x1,%r13
+  800dd3:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800dd8:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800ddb:	29 c3                	sub    %eax,%ebx
+  800ddd:	85 c0                	test   %eax,%eax
+  800ddf:	74 09                	je     800dea <strncasecmp+0x54>
+  800de1:	85 db                	test   %ebx,%ebx
+  800de3:	75 05                	jne    800dea <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800de5:	4d 39 fc             	cmp    %r15,%r12
+  800de8:	75 d6                	jne    800dc0 <strncasecmp+0x2a>
+}
+  800dea:	89 d8                	mov    %ebx,%eax
+  800dec:	48 83 c4 08          	add    $0x8,%rsp
+  800df0:	5b                   	pop    %rbx
+  800df1:	41 5c                	pop    %r12
+  800df3:	41 5d                	pop    %r13
+  800df5:	41 5e                	pop    %r14
+  800df7:	41 5f                	pop    %r15
+  800df9:	5d                   	pop    %rbp
+  800dfa:	c3                   	ret
+    int d = 0;
+  800dfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800e00:	eb e8                	jmp    800dea <strncasecmp+0x54>
+
+0000000000800e02 <toupper>:
+
+int toupper(int c) {
+  800e02:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800e04:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800e07:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800e0a:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e0d:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e10:	c3                   	ret
+
+0000000000800e11 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800e11:	83 ff 20             	cmp    $0x20,%edi
+  800e14:	0f 94 c0             	sete   %al
+  800e17:	0f b6 c0             	movzbl %al,%eax
+}
+  800e1a:	c3                   	ret
+
+0000000000800e1b <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800e1b:	89 f8                	mov    %edi,%eax
+  800e1d:	f7 d8                	neg    %eax
+  800e1f:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800e22:	c3                   	ret
+
+0000000000800e23 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e23:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e26:	48 89 f8             	mov    %rdi,%rax
+  800e29:	48 f7 d8             	neg    %rax
+  800e2c:	83 e0 07             	and    $0x7,%eax
+  800e2f:	49 89 d1             	mov    %rdx,%r9
+  800e32:	49 29 c1             	sub    %rax,%r9
+  800e35:	78 36                	js     800e6d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e37:	40 0f b6 c6          	movzbl %sil,%eax
+  800e3b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e42:	01 01 01 
+  800e45:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e49:	40 f6 c7 07          	test   $0x7,%dil
+  800e4d:	75 38                	jne    800e87 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e4f:	4c 89 c9             	mov    %r9,%rcx
+  800e52:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e56:	74 0c                	je     800e64 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e58:	fc                   	cld
+  800e59:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e5c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e60:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e64:	4d 85 c9             	test   %r9,%r9
+  800e67:	75 45                	jne    800eae <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e69:	4c 89 c0             	mov    %r8,%rax
+  800e6c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e6d:	48 85 d2             	test   %rdx,%rdx
+  800e70:	74 f7                	je     800e69 <memset+0x46>
+  800e72:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e75:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e78:	48 83 c0 01          	add    $0x1,%rax
+  800e7c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e80:	48 39 c2             	cmp    %rax,%rdx
+  800e83:	75 f3                	jne    800e78 <memset+0x55>
+  800e85:	eb e2                	jmp    800e69 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e87:	40 f6 c7 01          	test   $0x1,%dil
+  800e8b:	74 06                	je     800e93 <memset+0x70>
+  800e8d:	88 07                	mov    %al,(%rdi)
+  800e8f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e93:	40 f6 c7 02          	test   $0x2,%dil
+  800e97:	74 07                	je     800ea0 <memset+0x7d>
+  800e99:	66 89 07             	mov    %ax,(%rdi)
+  800e9c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ea0:	40 f6 c7 04          	test   $0x4,%dil
+  800ea4:	74 a9                	je     800e4f <memset+0x2c>
+  800ea6:	89 07                	mov    %eax,(%rdi)
+  800ea8:	48 83 c7 04          	add    $0x4,%rdi
+  800eac:	eb a1                	jmp    800e4f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eae:	41 f6 c1 04          	test   $0x4,%r9b
+  800eb2:	74 06                	je     800eba <memset+0x97>
+  800eb4:	89 07                	mov    %eax,(%rdi)
+  800eb6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eba:	41 f6 c1 02          	test   $0x2,%r9b
+  800ebe:	74 07                	je     800ec7 <memset+0xa4>
+  800ec0:	66 89 07             	mov    %ax,(%rdi)
+  800ec3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ec7:	41 f6 c1 01          	test   $0x1,%r9b
+  800ecb:	74 9c                	je     800e69 <memset+0x46>
+  800ecd:	88 07                	mov    %al,(%rdi)
+  800ecf:	eb 98                	jmp    800e69 <memset+0x46>
+
+0000000000800ed1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ed1:	48 89 f8             	mov    %rdi,%rax
+  800ed4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ed7:	48 39 fe             	cmp    %rdi,%rsi
+  800eda:	73 3b                	jae    800f17 <memmove+0x46>
+  800edc:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ee0:	48 39 d7             	cmp    %rdx,%rdi
+  800ee3:	73 32                	jae    800f17 <memmove+0x46>
+        s += n;
+        d += n;
+  800ee5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ee9:	48 89 d6             	mov    %rdx,%rsi
+  800eec:	48 09 fe             	or     %rdi,%rsi
+  800eef:	48 09 ce             	or     %rcx,%rsi
+  800ef2:	40 f6 c6 07          	test   $0x7,%sil
+  800ef6:	75 12                	jne    800f0a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ef8:	48 83 ef 08          	sub    $0x8,%rdi
+  800efc:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f00:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f04:	fd                   	std
+  800f05:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f08:	fc                   	cld
+  800f09:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f0a:	48 83 ef 01          	sub    $0x1,%rdi
+  800f0e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f12:	fd                   	std
+  800f13:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f15:	eb f1                	jmp    800f08 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f17:	48 89 f2             	mov    %rsi,%rdx
+  800f1a:	48 09 c2             	or     %rax,%rdx
+  800f1d:	48 09 ca             	or     %rcx,%rdx
+  800f20:	f6 c2 07             	test   $0x7,%dl
+  800f23:	75 0c                	jne    800f31 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f25:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f29:	48 89 c7             	mov    %rax,%rdi
+  800f2c:	fc                   	cld
+  800f2d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f30:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f31:	48 89 c7             	mov    %rax,%rdi
+  800f34:	fc                   	cld
+  800f35:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f37:	c3                   	ret
+
+0000000000800f38 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f38:	55                   	push   %rbp
+  800f39:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f3c:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  800f43:	00 00 00 
+  800f46:	ff d0                	call   *%rax
+}
+  800f48:	5d                   	pop    %rbp
+  800f49:	c3                   	ret
+
+0000000000800f4a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f4a:	55                   	push   %rbp
+  800f4b:	48 89 e5             	mov    %rsp,%rbp
+  800f4e:	41 57                	push   %r15
+  800f50:	41 56                	push   %r14
+  800f52:	41 55                	push   %r13
+  800f54:	41 54                	push   %r12
+  800f56:	53                   	push   %rbx
+  800f57:	48 83 ec 08          	sub    $0x8,%rsp
+  800f5b:	49 89 fe             	mov    %rdi,%r14
+  800f5e:	49 89 f7             	mov    %rsi,%r15
+  800f61:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f64:	48 89 f7             	mov    %rsi,%rdi
+  800f67:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  800f6e:	00 00 00 
+  800f71:	ff d0                	call   *%rax
+  800f73:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f76:	48 89 de             	mov    %rbx,%rsi
+  800f79:	4c 89 f7             	mov    %r14,%rdi
+  800f7c:	48 b8 20 0b 80 00 00 	movabs $0x800b20,%rax
+  800f83:	00 00 00 
+  800f86:	ff d0                	call   *%rax
+  800f88:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f8b:	48 39 c3             	cmp    %rax,%rbx
+  800f8e:	74 36                	je     800fc6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f90:	48 89 d8             	mov    %rbx,%rax
+  800f93:	4c 29 e8             	sub    %r13,%rax
+  800f96:	49 39 c4             	cmp    %rax,%r12
+  800f99:	73 31                	jae    800fcc <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f9b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fa0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fa4:	4c 89 fe             	mov    %r15,%rsi
+  800fa7:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  800fae:	00 00 00 
+  800fb1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fb3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fb7:	48 83 c4 08          	add    $0x8,%rsp
+  800fbb:	5b                   	pop    %rbx
+  800fbc:	41 5c                	pop    %r12
+  800fbe:	41 5d                	pop    %r13
+  800fc0:	41 5e                	pop    %r14
+  800fc2:	41 5f                	pop    %r15
+  800fc4:	5d                   	pop    %rbp
+  800fc5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fc6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fca:	eb eb                	jmp    800fb7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fcc:	48 83 eb 01          	sub    $0x1,%rbx
+  800fd0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fd4:	48 89 da             	mov    %rbx,%rdx
+  800fd7:	4c 89 fe             	mov    %r15,%rsi
+  800fda:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  800fe1:	00 00 00 
+  800fe4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fe6:	49 01 de             	add    %rbx,%r14
+  800fe9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fee:	eb c3                	jmp    800fb3 <strlcat+0x69>
+
+0000000000800ff0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ff0:	48 85 d2             	test   %rdx,%rdx
+  800ff3:	74 2d                	je     801022 <memcmp+0x32>
+  800ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ffa:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ffe:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801003:	44 38 c1             	cmp    %r8b,%cl
+  801006:	75 0f                	jne    801017 <memcmp+0x27>
+    while (n-- > 0) {
+  801008:	48 83 c0 01          	add    $0x1,%rax
+  80100c:	48 39 c2             	cmp    %rax,%rdx
+  80100f:	75 e9                	jne    800ffa <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801011:	b8 00 00 00 00       	mov    $0x0,%eax
+  801016:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801017:	0f b6 c1             	movzbl %cl,%eax
+  80101a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80101e:	44 29 c0             	sub    %r8d,%eax
+  801021:	c3                   	ret
+    return 0;
+  801022:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801027:	c3                   	ret
+
+0000000000801028 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801028:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80102c:	48 39 c7             	cmp    %rax,%rdi
+  80102f:	73 0f                	jae    801040 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801031:	40 38 37             	cmp    %sil,(%rdi)
+  801034:	74 0e                	je     801044 <memfind+0x1c>
+    for (; src < end; src++) {
+  801036:	48 83 c7 01          	add    $0x1,%rdi
+  80103a:	48 39 f8             	cmp    %rdi,%rax
+  80103d:	75 f2                	jne    801031 <memfind+0x9>
+  80103f:	c3                   	ret
+  801040:	48 89 f8             	mov    %rdi,%rax
+  801043:	c3                   	ret
+  801044:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801047:	c3                   	ret
+
+0000000000801048 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801048:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80104b:	0f b6 37             	movzbl (%rdi),%esi
+  80104e:	40 80 fe 20          	cmp    $0x20,%sil
+  801052:	74 06                	je     80105a <strtol+0x12>
+  801054:	40 80 fe 09          	cmp    $0x9,%sil
+  801058:	75 13                	jne    80106d <strtol+0x25>
+  80105a:	48 83 c7 01          	add    $0x1,%rdi
+  80105e:	0f b6 37             	movzbl (%rdi),%esi
+  801061:	40 80 fe 20          	cmp    $0x20,%sil
+  801065:	74 f3                	je     80105a <strtol+0x12>
+  801067:	40 80 fe 09          	cmp    $0x9,%sil
+  80106b:	74 ed                	je     80105a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80106d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801070:	83 e0 fd             	and    $0xfffffffd,%eax
+  801073:	3c 01                	cmp    $0x1,%al
+  801075:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801079:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80107f:	75 0f                	jne    801090 <strtol+0x48>
+  801081:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801084:	74 14                	je     80109a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801086:	85 d2                	test   %edx,%edx
+  801088:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80108d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801090:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801095:	4c 63 ca             	movslq %edx,%r9
+  801098:	eb 36                	jmp    8010d0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80109a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80109e:	74 0f                	je     8010af <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010a0:	85 d2                	test   %edx,%edx
+  8010a2:	75 ec                	jne    801090 <strtol+0x48>
+        s++;
+  8010a4:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010a8:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010ad:	eb e1                	jmp    801090 <strtol+0x48>
+        s += 2;
+  8010af:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010b3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010b8:	eb d6                	jmp    801090 <strtol+0x48>
+            dig -= '0';
+  8010ba:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010bd:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010c1:	41 39 d0             	cmp    %edx,%r8d
+  8010c4:	7d 21                	jge    8010e7 <strtol+0x9f>
+        val = val * base + dig;
+  8010c6:	49 0f af c1          	imul   %r9,%rax
+  8010ca:	0f b6 c9             	movzbl %cl,%ecx
+  8010cd:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010d0:	48 83 c7 01          	add    $0x1,%rdi
+  8010d4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010d8:	80 f9 39             	cmp    $0x39,%cl
+  8010db:	76 dd                	jbe    8010ba <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010dd:	80 f9 7b             	cmp    $0x7b,%cl
+  8010e0:	77 05                	ja     8010e7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010e2:	83 e9 57             	sub    $0x57,%ecx
+  8010e5:	eb d6                	jmp    8010bd <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010e7:	4d 85 d2             	test   %r10,%r10
+  8010ea:	74 03                	je     8010ef <strtol+0xa7>
+  8010ec:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010ef:	48 89 c2             	mov    %rax,%rdx
+  8010f2:	48 f7 da             	neg    %rdx
+  8010f5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010f9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010fd:	c3                   	ret
+
+00000000008010fe <atoi>:
+int atoi(const char *str) {
+  8010fe:	55                   	push   %rbp
+  8010ff:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801102:	ba 00 00 00 00       	mov    $0x0,%edx
+  801107:	be 00 00 00 00       	mov    $0x0,%esi
+  80110c:	48 b8 48 10 80 00 00 	movabs $0x801048,%rax
+  801113:	00 00 00 
+  801116:	ff d0                	call   *%rax
+}
+  801118:	5d                   	pop    %rbp
+  801119:	c3                   	ret
+
+000000000080111a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80111a:	55                   	push   %rbp
+  80111b:	48 89 e5             	mov    %rsp,%rbp
+  80111e:	53                   	push   %rbx
+  80111f:	48 89 fa             	mov    %rdi,%rdx
+  801122:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801125:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80112a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801134:	be 00 00 00 00       	mov    $0x0,%esi
+  801139:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80113f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801141:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801145:	c9                   	leave
+  801146:	c3                   	ret
+
+0000000000801147 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801147:	55                   	push   %rbp
+  801148:	48 89 e5             	mov    %rsp,%rbp
+  80114b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80114c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801151:	ba 00 00 00 00       	mov    $0x0,%edx
+  801156:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80115b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801160:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801165:	be 00 00 00 00       	mov    $0x0,%esi
+  80116a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801170:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801172:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801176:	c9                   	leave
+  801177:	c3                   	ret
+
+0000000000801178 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801178:	55                   	push   %rbp
+  801179:	48 89 e5             	mov    %rsp,%rbp
+  80117c:	53                   	push   %rbx
+  80117d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801181:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801184:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801189:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80118e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801193:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801198:	be 00 00 00 00       	mov    $0x0,%esi
+  80119d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011a5:	48 85 c0             	test   %rax,%rax
+  8011a8:	7f 06                	jg     8011b0 <sys_env_destroy+0x38>
+}
+  8011aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ae:	c9                   	leave
+  8011af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011b0:	49 89 c0             	mov    %rax,%r8
+  8011b3:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011b8:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8011bf:	00 00 00 
+  8011c2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8011c7:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8011ce:	00 00 00 
+  8011d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d6:	49 b9 42 3f 80 00 00 	movabs $0x803f42,%r9
+  8011dd:	00 00 00 
+  8011e0:	41 ff d1             	call   *%r9
+
+00000000008011e3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011e3:	55                   	push   %rbp
+  8011e4:	48 89 e5             	mov    %rsp,%rbp
+  8011e7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e8:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801201:	be 00 00 00 00       	mov    $0x0,%esi
+  801206:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80120c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80120e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801212:	c9                   	leave
+  801213:	c3                   	ret
+
+0000000000801214 <sys_yield>:
+
+void
+sys_yield(void) {
+  801214:	55                   	push   %rbp
+  801215:	48 89 e5             	mov    %rsp,%rbp
+  801218:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801219:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80121e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801223:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801228:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801232:	be 00 00 00 00       	mov    $0x0,%esi
+  801237:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123d:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80123f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801243:	c9                   	leave
+  801244:	c3                   	ret
+
+0000000000801245 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801245:	55                   	push   %rbp
+  801246:	48 89 e5             	mov    %rsp,%rbp
+  801249:	53                   	push   %rbx
+  80124a:	48 89 fa             	mov    %rdi,%rdx
+  80124d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801250:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801255:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80125c:	00 00 00 
+  80125f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801264:	be 00 00 00 00       	mov    $0x0,%esi
+  801269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801271:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801275:	c9                   	leave
+  801276:	c3                   	ret
+
+0000000000801277 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801277:	55                   	push   %rbp
+  801278:	48 89 e5             	mov    %rsp,%rbp
+  80127b:	53                   	push   %rbx
+  80127c:	49 89 f8             	mov    %rdi,%r8
+  80127f:	48 89 d3             	mov    %rdx,%rbx
+  801282:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801285:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80128a:	4c 89 c2             	mov    %r8,%rdx
+  80128d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801290:	be 00 00 00 00       	mov    $0x0,%esi
+  801295:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80129d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a1:	c9                   	leave
+  8012a2:	c3                   	ret
+
+00000000008012a3 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012a3:	55                   	push   %rbp
+  8012a4:	48 89 e5             	mov    %rsp,%rbp
+  8012a7:	53                   	push   %rbx
+  8012a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ac:	89 f8                	mov    %edi,%eax
+  8012ae:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012b1:	48 63 f9             	movslq %ecx,%rdi
+  8012b4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b7:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012bc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012cc:	48 85 c0             	test   %rax,%rax
+  8012cf:	7f 06                	jg     8012d7 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d5:	c9                   	leave
+  8012d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d7:	49 89 c0             	mov    %rax,%r8
+  8012da:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012df:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8012e6:	00 00 00 
+  8012e9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8012ee:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8012f5:	00 00 00 
+  8012f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fd:	49 b9 42 3f 80 00 00 	movabs $0x803f42,%r9
+  801304:	00 00 00 
+  801307:	41 ff d1             	call   *%r9
+
+000000000080130a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80130a:	55                   	push   %rbp
+  80130b:	48 89 e5             	mov    %rsp,%rbp
+  80130e:	53                   	push   %rbx
+  80130f:	48 83 ec 08          	sub    $0x8,%rsp
+  801313:	89 f8                	mov    %edi,%eax
+  801315:	49 89 f2             	mov    %rsi,%r10
+  801318:	48 89 cf             	mov    %rcx,%rdi
+  80131b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80131e:	48 63 da             	movslq %edx,%rbx
+  801321:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801324:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801329:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132c:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80132f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801331:	48 85 c0             	test   %rax,%rax
+  801334:	7f 06                	jg     80133c <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801336:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133a:	c9                   	leave
+  80133b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80133c:	49 89 c0             	mov    %rax,%r8
+  80133f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801344:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80134b:	00 00 00 
+  80134e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801353:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80135a:	00 00 00 
+  80135d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801362:	49 b9 42 3f 80 00 00 	movabs $0x803f42,%r9
+  801369:	00 00 00 
+  80136c:	41 ff d1             	call   *%r9
+
+000000000080136f <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80136f:	55                   	push   %rbp
+  801370:	48 89 e5             	mov    %rsp,%rbp
+  801373:	53                   	push   %rbx
+  801374:	48 83 ec 08          	sub    $0x8,%rsp
+  801378:	49 89 f9             	mov    %rdi,%r9
+  80137b:	89 f0                	mov    %esi,%eax
+  80137d:	48 89 d3             	mov    %rdx,%rbx
+  801380:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801383:	49 63 f0             	movslq %r8d,%rsi
+  801386:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801389:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80138e:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801391:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801397:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801399:	48 85 c0             	test   %rax,%rax
+  80139c:	7f 06                	jg     8013a4 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80139e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a2:	c9                   	leave
+  8013a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a4:	49 89 c0             	mov    %rax,%r8
+  8013a7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013ac:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8013b3:	00 00 00 
+  8013b6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013bb:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8013c2:	00 00 00 
+  8013c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ca:	49 b9 42 3f 80 00 00 	movabs $0x803f42,%r9
+  8013d1:	00 00 00 
+  8013d4:	41 ff d1             	call   *%r9
+
+00000000008013d7 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8013d7:	55                   	push   %rbp
+  8013d8:	48 89 e5             	mov    %rsp,%rbp
+  8013db:	53                   	push   %rbx
+  8013dc:	89 f8                	mov    %edi,%eax
+  8013de:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8013e1:	48 63 f9             	movslq %ecx,%rdi
+  8013e4:	48 63 da             	movslq %edx,%rbx
+  8013e7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ea:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ef:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013fd:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8013ff:	89 c2                	mov    %eax,%edx
+  801401:	48 85 c0             	test   %rax,%rax
+  801404:	78 0d                	js     801413 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801406:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80140b:	4d 85 c9             	test   %r9,%r9
+  80140e:	74 03                	je     801413 <sys_alloc_dma_region+0x3c>
+  801410:	49 89 01             	mov    %rax,(%r9)
+}
+  801413:	89 d0                	mov    %edx,%eax
+  801415:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801419:	c9                   	leave
+  80141a:	c3                   	ret
+
+000000000080141b <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80141b:	55                   	push   %rbp
+  80141c:	48 89 e5             	mov    %rsp,%rbp
+  80141f:	53                   	push   %rbx
+  801420:	48 83 ec 08          	sub    $0x8,%rsp
+  801424:	48 89 f1             	mov    %rsi,%rcx
+  801427:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80142a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80142d:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801432:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801437:	be 00 00 00 00       	mov    $0x0,%esi
+  80143c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801442:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801444:	48 85 c0             	test   %rax,%rax
+  801447:	7f 06                	jg     80144f <sys_set_cache_region+0x34>
+}
+  801449:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144d:	c9                   	leave
+  80144e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144f:	49 89 c0             	mov    %rax,%r8
+  801452:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801457:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80145e:	00 00 00 
+  801461:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801466:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80146d:	00 00 00 
+  801470:	b8 00 00 00 00       	mov    $0x0,%eax
+  801475:	49 b9 42 3f 80 00 00 	movabs $0x803f42,%r9
+  80147c:	00 00 00 
+  80147f:	41 ff d1             	call   *%r9
+
+0000000000801482 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801482:	55                   	push   %rbp
+  801483:	48 89 e5             	mov    %rsp,%rbp
+  801486:	53                   	push   %rbx
+  801487:	48 83 ec 08          	sub    $0x8,%rsp
+  80148b:	48 89 f1             	mov    %rsi,%rcx
+  80148e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801491:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801494:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801499:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149e:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ab:	48 85 c0             	test   %rax,%rax
+  8014ae:	7f 06                	jg     8014b6 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b4:	c9                   	leave
+  8014b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b6:	49 89 c0             	mov    %rax,%r8
+  8014b9:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014be:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8014c5:	00 00 00 
+  8014c8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014cd:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8014d4:	00 00 00 
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014dc:	49 b9 42 3f 80 00 00 	movabs $0x803f42,%r9
+  8014e3:	00 00 00 
+  8014e6:	41 ff d1             	call   *%r9
+
+00000000008014e9 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014e9:	55                   	push   %rbp
+  8014ea:	48 89 e5             	mov    %rsp,%rbp
+  8014ed:	53                   	push   %rbx
+  8014ee:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014f2:	48 63 ce             	movslq %esi,%rcx
+  8014f5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f8:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801502:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801507:	be 00 00 00 00       	mov    $0x0,%esi
+  80150c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801512:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801514:	48 85 c0             	test   %rax,%rax
+  801517:	7f 06                	jg     80151f <sys_env_set_status+0x36>
+}
+  801519:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151d:	c9                   	leave
+  80151e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80151f:	49 89 c0             	mov    %rax,%r8
+  801522:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801527:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80152e:	00 00 00 
+  801531:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801536:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80153d:	00 00 00 
+  801540:	b8 00 00 00 00       	mov    $0x0,%eax
+  801545:	49 b9 42 3f 80 00 00 	movabs $0x803f42,%r9
+  80154c:	00 00 00 
+  80154f:	41 ff d1             	call   *%r9
+
+0000000000801552 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801552:	55                   	push   %rbp
+  801553:	48 89 e5             	mov    %rsp,%rbp
+  801556:	53                   	push   %rbx
+  801557:	48 83 ec 08          	sub    $0x8,%rsp
+  80155b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80155e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801561:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801566:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801570:	be 00 00 00 00       	mov    $0x0,%esi
+  801575:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80157d:	48 85 c0             	test   %rax,%rax
+  801580:	7f 06                	jg     801588 <sys_env_set_trapframe+0x36>
+}
+  801582:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801586:	c9                   	leave
+  801587:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801588:	49 89 c0             	mov    %rax,%r8
+  80158b:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801590:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801597:	00 00 00 
+  80159a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80159f:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8015a6:	00 00 00 
+  8015a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ae:	49 b9 42 3f 80 00 00 	movabs $0x803f42,%r9
+  8015b5:	00 00 00 
+  8015b8:	41 ff d1             	call   *%r9
+
+00000000008015bb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015bb:	55                   	push   %rbp
+  8015bc:	48 89 e5             	mov    %rsp,%rbp
+  8015bf:	53                   	push   %rbx
+  8015c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8015c4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015c7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ca:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e6:	48 85 c0             	test   %rax,%rax
+  8015e9:	7f 06                	jg     8015f1 <sys_env_set_pgfault_upcall+0x36>
+}
+  8015eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ef:	c9                   	leave
+  8015f0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f1:	49 89 c0             	mov    %rax,%r8
+  8015f4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015f9:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801600:	00 00 00 
+  801603:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801608:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80160f:	00 00 00 
+  801612:	b8 00 00 00 00       	mov    $0x0,%eax
+  801617:	49 b9 42 3f 80 00 00 	movabs $0x803f42,%r9
+  80161e:	00 00 00 
+  801621:	41 ff d1             	call   *%r9
+
+0000000000801624 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801624:	55                   	push   %rbp
+  801625:	48 89 e5             	mov    %rsp,%rbp
+  801628:	53                   	push   %rbx
+  801629:	89 f8                	mov    %edi,%eax
+  80162b:	49 89 f1             	mov    %rsi,%r9
+  80162e:	48 89 d3             	mov    %rdx,%rbx
+  801631:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801634:	49 63 f0             	movslq %r8d,%rsi
+  801637:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80163a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80163f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801642:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801648:	cd 30                	int    $0x30
+}
+  80164a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164e:	c9                   	leave
+  80164f:	c3                   	ret
+
+0000000000801650 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801650:	55                   	push   %rbp
+  801651:	48 89 e5             	mov    %rsp,%rbp
+  801654:	53                   	push   %rbx
+  801655:	48 83 ec 08          	sub    $0x8,%rsp
+  801659:	48 89 fa             	mov    %rdi,%rdx
+  80165c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80165f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801664:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801669:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166e:	be 00 00 00 00       	mov    $0x0,%esi
+  801673:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801679:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80167b:	48 85 c0             	test   %rax,%rax
+  80167e:	7f 06                	jg     801686 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801680:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801684:	c9                   	leave
+  801685:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801686:	49 89 c0             	mov    %rax,%r8
+  801689:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80168e:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801695:	00 00 00 
+  801698:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80169d:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8016a4:	00 00 00 
+  8016a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ac:	49 b9 42 3f 80 00 00 	movabs $0x803f42,%r9
+  8016b3:	00 00 00 
+  8016b6:	41 ff d1             	call   *%r9
+
+00000000008016b9 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8016b9:	55                   	push   %rbp
+  8016ba:	48 89 e5             	mov    %rsp,%rbp
+  8016bd:	53                   	push   %rbx
+  8016be:	48 89 fa             	mov    %rdi,%rdx
+  8016c1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c4:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016de:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+
+00000000008016e6 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016e6:	55                   	push   %rbp
+  8016e7:	48 89 e5             	mov    %rsp,%rbp
+  8016ea:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016eb:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801704:	be 00 00 00 00       	mov    $0x0,%esi
+  801709:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170f:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801711:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801715:	c9                   	leave
+  801716:	c3                   	ret
+
+0000000000801717 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801717:	48 85 ff             	test   %rdi,%rdi
+  80171a:	0f 84 b6 01 00 00    	je     8018d6 <malloc+0x1bf>
+malloc(size_t size) {
+  801720:	55                   	push   %rbp
+  801721:	48 89 e5             	mov    %rsp,%rbp
+  801724:	41 56                	push   %r14
+  801726:	41 55                	push   %r13
+  801728:	41 54                	push   %r12
+  80172a:	53                   	push   %rbx
+  80172b:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80172e:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801735:	00 00 00 
+  801738:	4c 8b 20             	mov    (%rax),%r12
+  80173b:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801742:	0f 87 94 01 00 00    	ja     8018dc <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801748:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80174f:	00 00 00 
+  801752:	48 85 c0             	test   %rax,%rax
+  801755:	74 6b                	je     8017c2 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801757:	4d 85 e4             	test   %r12,%r12
+  80175a:	74 66                	je     8017c2 <malloc+0xab>
+  80175c:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801763:	00 00 00 
+  801766:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80176b:	eb 0d                	jmp    80177a <malloc+0x63>
+  80176d:	48 83 c1 01          	add    $0x1,%rcx
+  801771:	48 83 c2 18          	add    $0x18,%rdx
+  801775:	49 39 cc             	cmp    %rcx,%r12
+  801778:	74 48                	je     8017c2 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80177a:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80177f:	74 ec                	je     80176d <malloc+0x56>
+  801781:	48 39 1a             	cmp    %rbx,(%rdx)
+  801784:	72 e7                	jb     80176d <malloc+0x56>
+                real_freep_size--;
+  801786:	48 83 e8 01          	sub    $0x1,%rax
+  80178a:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801791:	00 00 00 
+                freep[i].is_free = false;
+  801794:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80179b:	00 00 00 
+  80179e:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8017a2:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8017a6:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8017aa:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8017b1:	00 
+                freep[i].size = size;
+  8017b2:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8017b6:	48 01 c8             	add    %rcx,%rax
+  8017b9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017bd:	e9 0b 01 00 00       	jmp    8018cd <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8017c2:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8017c9:	00 00 00 
+  8017cc:	48 01 d8             	add    %rbx,%rax
+  8017cf:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8017d5:	76 7c                	jbe    801853 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8017d7:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8017de:	00 00 00 
+  8017e1:	4c 8b 30             	mov    (%rax),%r14
+  8017e4:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8017eb:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8017ee:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8017f5:	00 00 00 
+  8017f8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8017ff:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801806:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80180c:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801810:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  801817:	00 00 00 
+  80181a:	ff d0                	call   *%rax
+  80181c:	89 c7                	mov    %eax,%edi
+  80181e:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801825:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80182c:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801833:	00 00 00 
+  801836:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80183a:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80183f:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  801846:	00 00 00 
+  801849:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	0f 88 90 00 00 00    	js     8018e3 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801853:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  80185a:	00 00 00 
+  80185d:	48 8b 31             	mov    (%rcx),%rsi
+  801860:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801867:	00 00 00 
+  80186a:	4c 8b 07             	mov    (%rdi),%r8
+  80186d:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801871:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801878:	00 00 00 
+  80187b:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80187f:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801883:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80188a:	00 00 00 
+  80188d:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801891:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801894:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801898:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80189f:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8018a0:	48 89 d8             	mov    %rbx,%rax
+  8018a3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8018a8:	4c 01 c0             	add    %r8,%rax
+  8018ab:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8018ae:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8018b5:	48 01 f3             	add    %rsi,%rbx
+  8018b8:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8018bb:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8018c0:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8018c7:	00 00 00 
+  8018ca:	48 89 d0             	mov    %rdx,%rax
+}
+  8018cd:	5b                   	pop    %rbx
+  8018ce:	41 5c                	pop    %r12
+  8018d0:	41 5d                	pop    %r13
+  8018d2:	41 5e                	pop    %r14
+  8018d4:	5d                   	pop    %rbp
+  8018d5:	c3                   	ret
+        return NULL;
+  8018d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018db:	c3                   	ret
+        return NULL;
+  8018dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e1:	eb ea                	jmp    8018cd <malloc+0x1b6>
+            return NULL;
+  8018e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e8:	eb e3                	jmp    8018cd <malloc+0x1b6>
+
+00000000008018ea <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8018ea:	55                   	push   %rbp
+  8018eb:	48 89 e5             	mov    %rsp,%rbp
+  8018ee:	53                   	push   %rbx
+  8018ef:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8018f3:	48 89 fb             	mov    %rdi,%rbx
+  8018f6:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8018fa:	48 89 df             	mov    %rbx,%rdi
+  8018fd:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  801904:	00 00 00 
+  801907:	ff d0                	call   *%rax
+  801909:	48 89 c7             	mov    %rax,%rdi
+  80190c:	48 89 da             	mov    %rbx,%rdx
+  80190f:	be 00 00 00 00       	mov    $0x0,%esi
+  801914:	48 b8 23 0e 80 00 00 	movabs $0x800e23,%rax
+  80191b:	00 00 00 
+  80191e:	ff d0                	call   *%rax
+}
+  801920:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801924:	c9                   	leave
+  801925:	c3                   	ret
+
+0000000000801926 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801926:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  80192d:	00 00 00 
+  801930:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801937:	00 00 00 
+  80193a:	48 3b 02             	cmp    (%rdx),%rax
+  80193d:	74 4d                	je     80198c <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  80193f:	48 85 c0             	test   %rax,%rax
+  801942:	74 4d                	je     801991 <get_allocsize+0x6b>
+  801944:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80194b:	00 00 00 
+  80194e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801953:	48 3b 39             	cmp    (%rcx),%rdi
+  801956:	74 13                	je     80196b <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801958:	48 83 c2 01          	add    $0x1,%rdx
+  80195c:	48 83 c1 18          	add    $0x18,%rcx
+  801960:	48 39 d0             	cmp    %rdx,%rax
+  801963:	75 ee                	jne    801953 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801965:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196a:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  80196b:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80196f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801974:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  80197b:	00 00 00 
+  80197e:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801984:	75 0b                	jne    801991 <get_allocsize+0x6b>
+  801986:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  80198b:	c3                   	ret
+        return 0;
+  80198c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801991:	c3                   	ret
+
+0000000000801992 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801992:	48 85 ff             	test   %rdi,%rdi
+  801995:	0f 84 01 01 00 00    	je     801a9c <free+0x10a>
+free(void *ptr) {
+  80199b:	55                   	push   %rbp
+  80199c:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  80199f:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8019a6:	00 00 00 
+  8019a9:	48 8b 30             	mov    (%rax),%rsi
+  8019ac:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8019b3:	00 00 00 
+  8019b6:	48 39 c6             	cmp    %rax,%rsi
+  8019b9:	74 50                	je     801a0b <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8019bb:	48 85 f6             	test   %rsi,%rsi
+  8019be:	74 21                	je     8019e1 <free+0x4f>
+  8019c0:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8019c7:	00 00 00 
+  8019ca:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8019cf:	48 3b 39             	cmp    (%rcx),%rdi
+  8019d2:	74 61                	je     801a35 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8019d4:	48 83 c2 01          	add    $0x1,%rdx
+  8019d8:	48 83 c1 18          	add    $0x18,%rcx
+  8019dc:	48 39 d6             	cmp    %rdx,%rsi
+  8019df:	75 ee                	jne    8019cf <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8019e1:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  8019e8:	00 00 00 
+  8019eb:	be 12 01 00 00       	mov    $0x112,%esi
+  8019f0:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8019f7:	00 00 00 
+  8019fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ff:	48 b9 42 3f 80 00 00 	movabs $0x803f42,%rcx
+  801a06:	00 00 00 
+  801a09:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801a0b:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801a12:	00 00 00 
+  801a15:	be 06 01 00 00       	mov    $0x106,%esi
+  801a1a:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801a21:	00 00 00 
+  801a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a29:	48 b9 42 3f 80 00 00 	movabs $0x803f42,%rcx
+  801a30:	00 00 00 
+  801a33:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801a35:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a39:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a40:	00 00 00 
+  801a43:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a49:	75 27                	jne    801a72 <free+0xe0>
+            freep[i].is_free = true;
+  801a4b:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a4f:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801a56:	00 00 00 
+  801a59:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801a60:	00 00 
+            real_freep_size++;
+  801a62:	48 83 c0 01          	add    $0x1,%rax
+  801a66:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801a6d:	00 00 00 
+}
+  801a70:	5d                   	pop    %rbp
+  801a71:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801a72:	48 ba a8 55 80 00 00 	movabs $0x8055a8,%rdx
+  801a79:	00 00 00 
+  801a7c:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801a81:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801a88:	00 00 00 
+  801a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a90:	48 b9 42 3f 80 00 00 	movabs $0x803f42,%rcx
+  801a97:	00 00 00 
+  801a9a:	ff d1                	call   *%rcx
+  801a9c:	c3                   	ret
+
+0000000000801a9d <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801a9d:	55                   	push   %rbp
+  801a9e:	48 89 e5             	mov    %rsp,%rbp
+  801aa1:	41 55                	push   %r13
+  801aa3:	41 54                	push   %r12
+  801aa5:	53                   	push   %rbx
+  801aa6:	48 83 ec 08          	sub    $0x8,%rsp
+  801aaa:	48 89 fb             	mov    %rdi,%rbx
+  801aad:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801ab0:	48 b8 26 19 80 00 00 	movabs $0x801926,%rax
+  801ab7:	00 00 00 
+  801aba:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801abc:	49 39 c5             	cmp    %rax,%r13
+  801abf:	73 0e                	jae    801acf <realloc+0x32>
+}
+  801ac1:	48 89 d8             	mov    %rbx,%rax
+  801ac4:	48 83 c4 08          	add    $0x8,%rsp
+  801ac8:	5b                   	pop    %rbx
+  801ac9:	41 5c                	pop    %r12
+  801acb:	41 5d                	pop    %r13
+  801acd:	5d                   	pop    %rbp
+  801ace:	c3                   	ret
+  801acf:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801ad2:	4c 89 ef             	mov    %r13,%rdi
+  801ad5:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  801adc:	00 00 00 
+  801adf:	ff d0                	call   *%rax
+  801ae1:	48 89 c7             	mov    %rax,%rdi
+  801ae4:	4c 89 e2             	mov    %r12,%rdx
+  801ae7:	48 89 de             	mov    %rbx,%rsi
+  801aea:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  801af1:	00 00 00 
+  801af4:	ff d0                	call   *%rax
+  801af6:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801af9:	48 89 df             	mov    %rbx,%rdi
+  801afc:	48 b8 92 19 80 00 00 	movabs $0x801992,%rax
+  801b03:	00 00 00 
+  801b06:	ff d0                	call   *%rax
+    return newptr;
+  801b08:	4c 89 e3             	mov    %r12,%rbx
+  801b0b:	eb b4                	jmp    801ac1 <realloc+0x24>
+
+0000000000801b0d <strdup>:
+
+char*
+strdup (const char *src) {
+  801b0d:	55                   	push   %rbp
+  801b0e:	48 89 e5             	mov    %rsp,%rbp
+  801b11:	41 54                	push   %r12
+  801b13:	53                   	push   %rbx
+  801b14:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801b17:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  801b1e:	00 00 00 
+  801b21:	ff d0                	call   *%rax
+  801b23:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801b27:	4c 89 e7             	mov    %r12,%rdi
+  801b2a:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  801b31:	00 00 00 
+  801b34:	ff d0                	call   *%rax
+  801b36:	48 89 c7             	mov    %rax,%rdi
+  801b39:	4c 89 e2             	mov    %r12,%rdx
+  801b3c:	48 89 de             	mov    %rbx,%rsi
+  801b3f:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  801b46:	00 00 00 
+  801b49:	ff d0                	call   *%rax
+}
+  801b4b:	5b                   	pop    %rbx
+  801b4c:	41 5c                	pop    %r12
+  801b4e:	5d                   	pop    %rbp
+  801b4f:	c3                   	ret
+
+0000000000801b50 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801b50:	55                   	push   %rbp
+  801b51:	48 89 e5             	mov    %rsp,%rbp
+  801b54:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b55:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b69:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b6e:	be 00 00 00 00       	mov    $0x0,%esi
+  801b73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b79:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b7f:	c9                   	leave
+  801b80:	c3                   	ret
+
+0000000000801b81 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801b81:	55                   	push   %rbp
+  801b82:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801b85:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801b8c:	00 00 00 
+  801b8f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801b93:	74 26                	je     801bbb <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801b95:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801b97:	48 c1 e2 20          	shl    $0x20,%rdx
+  801b9b:	89 c0                	mov    %eax,%eax
+  801b9d:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801ba0:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801ba7:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801bae:	00 00 00 
+  801bb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb6:	48 f7 31             	divq   (%rcx)
+}
+  801bb9:	5d                   	pop    %rbp
+  801bba:	c3                   	ret
+        freq = get_cpufreq();
+  801bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc0:	48 ba 50 1b 80 00 00 	movabs $0x801b50,%rdx
+  801bc7:	00 00 00 
+  801bca:	ff d2                	call   *%rdx
+  801bcc:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801bd3:	00 00 00 
+  801bd6:	eb bd                	jmp    801b95 <get_ticks+0x14>
+
+0000000000801bd8 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801bd8:	55                   	push   %rbp
+  801bd9:	48 89 e5             	mov    %rsp,%rbp
+  801bdc:	53                   	push   %rbx
+  801bdd:	48 83 ec 08          	sub    $0x8,%rsp
+  801be1:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801be4:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801beb:	00 00 00 
+  801bee:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801bf2:	74 50                	je     801c44 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801bf4:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801bf6:	48 c1 e2 20          	shl    $0x20,%rdx
+  801bfa:	89 c0                	mov    %eax,%eax
+  801bfc:	48 89 d6             	mov    %rdx,%rsi
+  801bff:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801c02:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c09:	00 00 00 
+  801c0c:	48 0f af 18          	imul   (%rax),%rbx
+  801c10:	48 c1 eb 03          	shr    $0x3,%rbx
+  801c14:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801c1b:	9b c4 20 
+  801c1e:	48 89 d8             	mov    %rbx,%rax
+  801c21:	48 f7 e2             	mul    %rdx
+  801c24:	48 89 d1             	mov    %rdx,%rcx
+  801c27:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801c2b:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c2d:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c31:	89 c0                	mov    %eax,%eax
+  801c33:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801c36:	48 29 f2             	sub    %rsi,%rdx
+  801c39:	48 39 ca             	cmp    %rcx,%rdx
+  801c3c:	72 ed                	jb     801c2b <sleep+0x53>
+}
+  801c3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c42:	c9                   	leave
+  801c43:	c3                   	ret
+        freq = get_cpufreq();
+  801c44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c49:	48 ba 50 1b 80 00 00 	movabs $0x801b50,%rdx
+  801c50:	00 00 00 
+  801c53:	ff d2                	call   *%rdx
+  801c55:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c5c:	00 00 00 
+  801c5f:	eb 93                	jmp    801bf4 <sleep+0x1c>
+
+0000000000801c61 <poll_kbd>:
+
+int poll_kbd() {
+  801c61:	55                   	push   %rbp
+  801c62:	48 89 e5             	mov    %rsp,%rbp
+  801c65:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c66:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c70:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c7a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c7f:	be 00 00 00 00       	mov    $0x0,%esi
+  801c84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c8a:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c8c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c90:	c9                   	leave
+  801c91:	c3                   	ret
+
+0000000000801c92 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801c92:	55                   	push   %rbp
+  801c93:	48 89 e5             	mov    %rsp,%rbp
+  801c96:	53                   	push   %rbx
+  801c97:	49 89 fa             	mov    %rdi,%r10
+  801c9a:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801c9c:	44 89 c6             	mov    %r8d,%esi
+  801c9f:	89 cf                	mov    %ecx,%edi
+  801ca1:	89 d3                	mov    %edx,%ebx
+  801ca3:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ca5:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801caa:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cad:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801cb1:	cd 30                	int    $0x30
+  801cb3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cb7:	c9                   	leave
+  801cb8:	c3                   	ret
+
+0000000000801cb9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cb9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801cc0:	ff ff ff 
+  801cc3:	48 01 f8             	add    %rdi,%rax
+  801cc6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801cca:	c3                   	ret
+
+0000000000801ccb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ccb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801cd2:	ff ff ff 
+  801cd5:	48 01 f8             	add    %rdi,%rax
+  801cd8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801cdc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801ce2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801ce6:	c3                   	ret
+
+0000000000801ce7 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ce7:	55                   	push   %rbp
+  801ce8:	48 89 e5             	mov    %rsp,%rbp
+  801ceb:	41 57                	push   %r15
+  801ced:	41 56                	push   %r14
+  801cef:	41 55                	push   %r13
+  801cf1:	41 54                	push   %r12
+  801cf3:	53                   	push   %rbx
+  801cf4:	48 83 ec 08          	sub    $0x8,%rsp
+  801cf8:	49 89 ff             	mov    %rdi,%r15
+  801cfb:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801d00:	49 bd 9b 3b 80 00 00 	movabs $0x803b9b,%r13
+  801d07:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801d0a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801d10:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801d13:	48 89 df             	mov    %rbx,%rdi
+  801d16:	41 ff d5             	call   *%r13
+  801d19:	83 e0 04             	and    $0x4,%eax
+  801d1c:	74 17                	je     801d35 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801d1e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d25:	4c 39 f3             	cmp    %r14,%rbx
+  801d28:	75 e6                	jne    801d10 <fd_alloc+0x29>
+  801d2a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801d30:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801d35:	4d 89 27             	mov    %r12,(%r15)
+}
+  801d38:	48 83 c4 08          	add    $0x8,%rsp
+  801d3c:	5b                   	pop    %rbx
+  801d3d:	41 5c                	pop    %r12
+  801d3f:	41 5d                	pop    %r13
+  801d41:	41 5e                	pop    %r14
+  801d43:	41 5f                	pop    %r15
+  801d45:	5d                   	pop    %rbp
+  801d46:	c3                   	ret
+
+0000000000801d47 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801d47:	83 ff 1f             	cmp    $0x1f,%edi
+  801d4a:	77 39                	ja     801d85 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801d4c:	55                   	push   %rbp
+  801d4d:	48 89 e5             	mov    %rsp,%rbp
+  801d50:	41 54                	push   %r12
+  801d52:	53                   	push   %rbx
+  801d53:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801d56:	48 63 df             	movslq %edi,%rbx
+  801d59:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801d60:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801d64:	48 89 df             	mov    %rbx,%rdi
+  801d67:	48 b8 9b 3b 80 00 00 	movabs $0x803b9b,%rax
+  801d6e:	00 00 00 
+  801d71:	ff d0                	call   *%rax
+  801d73:	a8 04                	test   $0x4,%al
+  801d75:	74 14                	je     801d8b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d77:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d80:	5b                   	pop    %rbx
+  801d81:	41 5c                	pop    %r12
+  801d83:	5d                   	pop    %rbp
+  801d84:	c3                   	ret
+        return -E_INVAL;
+  801d85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d8a:	c3                   	ret
+        return -E_INVAL;
+  801d8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d90:	eb ee                	jmp    801d80 <fd_lookup+0x39>
+
+0000000000801d92 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d92:	55                   	push   %rbp
+  801d93:	48 89 e5             	mov    %rsp,%rbp
+  801d96:	41 54                	push   %r12
+  801d98:	53                   	push   %rbx
+  801d99:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d9c:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801da3:	00 00 00 
+  801da6:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801dad:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801db0:	39 3b                	cmp    %edi,(%rbx)
+  801db2:	74 47                	je     801dfb <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801db4:	48 83 c0 08          	add    $0x8,%rax
+  801db8:	48 8b 18             	mov    (%rax),%rbx
+  801dbb:	48 85 db             	test   %rbx,%rbx
+  801dbe:	75 f0                	jne    801db0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801dc0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801dc7:	00 00 00 
+  801dca:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dd0:	89 fa                	mov    %edi,%edx
+  801dd2:	48 bf 08 56 80 00 00 	movabs $0x805608,%rdi
+  801dd9:	00 00 00 
+  801ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de1:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  801de8:	00 00 00 
+  801deb:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ded:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801df2:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801df6:	5b                   	pop    %rbx
+  801df7:	41 5c                	pop    %r12
+  801df9:	5d                   	pop    %rbp
+  801dfa:	c3                   	ret
+            return 0;
+  801dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e00:	eb f0                	jmp    801df2 <dev_lookup+0x60>
+
+0000000000801e02 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801e02:	55                   	push   %rbp
+  801e03:	48 89 e5             	mov    %rsp,%rbp
+  801e06:	41 55                	push   %r13
+  801e08:	41 54                	push   %r12
+  801e0a:	53                   	push   %rbx
+  801e0b:	48 83 ec 18          	sub    $0x18,%rsp
+  801e0f:	48 89 fb             	mov    %rdi,%rbx
+  801e12:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e15:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801e1c:	ff ff ff 
+  801e1f:	48 01 df             	add    %rbx,%rdi
+  801e22:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801e26:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e2a:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  801e31:	00 00 00 
+  801e34:	ff d0                	call   *%rax
+  801e36:	41 89 c5             	mov    %eax,%r13d
+  801e39:	85 c0                	test   %eax,%eax
+  801e3b:	78 06                	js     801e43 <fd_close+0x41>
+  801e3d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801e41:	74 1a                	je     801e5d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801e43:	45 84 e4             	test   %r12b,%r12b
+  801e46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801e4f:	44 89 e8             	mov    %r13d,%eax
+  801e52:	48 83 c4 18          	add    $0x18,%rsp
+  801e56:	5b                   	pop    %rbx
+  801e57:	41 5c                	pop    %r12
+  801e59:	41 5d                	pop    %r13
+  801e5b:	5d                   	pop    %rbp
+  801e5c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e5d:	8b 3b                	mov    (%rbx),%edi
+  801e5f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e63:	48 b8 92 1d 80 00 00 	movabs $0x801d92,%rax
+  801e6a:	00 00 00 
+  801e6d:	ff d0                	call   *%rax
+  801e6f:	41 89 c5             	mov    %eax,%r13d
+  801e72:	85 c0                	test   %eax,%eax
+  801e74:	78 1b                	js     801e91 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e76:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e7a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e7e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e84:	48 85 c0             	test   %rax,%rax
+  801e87:	74 08                	je     801e91 <fd_close+0x8f>
+  801e89:	48 89 df             	mov    %rbx,%rdi
+  801e8c:	ff d0                	call   *%rax
+  801e8e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e96:	48 89 de             	mov    %rbx,%rsi
+  801e99:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e9e:	48 b8 82 14 80 00 00 	movabs $0x801482,%rax
+  801ea5:	00 00 00 
+  801ea8:	ff d0                	call   *%rax
+    return res;
+  801eaa:	eb a3                	jmp    801e4f <fd_close+0x4d>
+
+0000000000801eac <close>:
+
+int
+close(int fdnum) {
+  801eac:	55                   	push   %rbp
+  801ead:	48 89 e5             	mov    %rsp,%rbp
+  801eb0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801eb4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801eb8:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ec4:	85 c0                	test   %eax,%eax
+  801ec6:	78 15                	js     801edd <close+0x31>
+
+    return fd_close(fd, 1);
+  801ec8:	be 01 00 00 00       	mov    $0x1,%esi
+  801ecd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ed1:	48 b8 02 1e 80 00 00 	movabs $0x801e02,%rax
+  801ed8:	00 00 00 
+  801edb:	ff d0                	call   *%rax
+}
+  801edd:	c9                   	leave
+  801ede:	c3                   	ret
+
+0000000000801edf <close_all>:
+
+void
+close_all(void) {
+  801edf:	55                   	push   %rbp
+  801ee0:	48 89 e5             	mov    %rsp,%rbp
+  801ee3:	41 54                	push   %r12
+  801ee5:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ee6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eeb:	49 bc ac 1e 80 00 00 	movabs $0x801eac,%r12
+  801ef2:	00 00 00 
+  801ef5:	89 df                	mov    %ebx,%edi
+  801ef7:	41 ff d4             	call   *%r12
+  801efa:	83 c3 01             	add    $0x1,%ebx
+  801efd:	83 fb 20             	cmp    $0x20,%ebx
+  801f00:	75 f3                	jne    801ef5 <close_all+0x16>
+}
+  801f02:	5b                   	pop    %rbx
+  801f03:	41 5c                	pop    %r12
+  801f05:	5d                   	pop    %rbp
+  801f06:	c3                   	ret
+
+0000000000801f07 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801f07:	55                   	push   %rbp
+  801f08:	48 89 e5             	mov    %rsp,%rbp
+  801f0b:	41 57                	push   %r15
+  801f0d:	41 56                	push   %r14
+  801f0f:	41 55                	push   %r13
+  801f11:	41 54                	push   %r12
+  801f13:	53                   	push   %rbx
+  801f14:	48 83 ec 18          	sub    $0x18,%rsp
+  801f18:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801f1b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801f1f:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  801f26:	00 00 00 
+  801f29:	ff d0                	call   *%rax
+  801f2b:	89 c3                	mov    %eax,%ebx
+  801f2d:	85 c0                	test   %eax,%eax
+  801f2f:	0f 88 b8 00 00 00    	js     801fed <dup+0xe6>
+    close(newfdnum);
+  801f35:	44 89 e7             	mov    %r12d,%edi
+  801f38:	48 b8 ac 1e 80 00 00 	movabs $0x801eac,%rax
+  801f3f:	00 00 00 
+  801f42:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801f44:	4d 63 ec             	movslq %r12d,%r13
+  801f47:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801f4e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801f52:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801f56:	4c 89 ff             	mov    %r15,%rdi
+  801f59:	49 be cb 1c 80 00 00 	movabs $0x801ccb,%r14
+  801f60:	00 00 00 
+  801f63:	41 ff d6             	call   *%r14
+  801f66:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801f69:	4c 89 ef             	mov    %r13,%rdi
+  801f6c:	41 ff d6             	call   *%r14
+  801f6f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801f72:	48 89 df             	mov    %rbx,%rdi
+  801f75:	48 b8 9b 3b 80 00 00 	movabs $0x803b9b,%rax
+  801f7c:	00 00 00 
+  801f7f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801f81:	a8 04                	test   $0x4,%al
+  801f83:	74 2b                	je     801fb0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801f85:	41 89 c1             	mov    %eax,%r9d
+  801f88:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f8e:	4c 89 f1             	mov    %r14,%rcx
+  801f91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f96:	48 89 de             	mov    %rbx,%rsi
+  801f99:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f9e:	48 b8 0a 13 80 00 00 	movabs $0x80130a,%rax
+  801fa5:	00 00 00 
+  801fa8:	ff d0                	call   *%rax
+  801faa:	89 c3                	mov    %eax,%ebx
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	78 4e                	js     801ffe <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801fb0:	4c 89 ff             	mov    %r15,%rdi
+  801fb3:	48 b8 9b 3b 80 00 00 	movabs $0x803b9b,%rax
+  801fba:	00 00 00 
+  801fbd:	ff d0                	call   *%rax
+  801fbf:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801fc2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fc8:	4c 89 e9             	mov    %r13,%rcx
+  801fcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd0:	4c 89 fe             	mov    %r15,%rsi
+  801fd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fd8:	48 b8 0a 13 80 00 00 	movabs $0x80130a,%rax
+  801fdf:	00 00 00 
+  801fe2:	ff d0                	call   *%rax
+  801fe4:	89 c3                	mov    %eax,%ebx
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	78 14                	js     801ffe <dup+0xf7>
+
+    return newfdnum;
+  801fea:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801fed:	89 d8                	mov    %ebx,%eax
+  801fef:	48 83 c4 18          	add    $0x18,%rsp
+  801ff3:	5b                   	pop    %rbx
+  801ff4:	41 5c                	pop    %r12
+  801ff6:	41 5d                	pop    %r13
+  801ff8:	41 5e                	pop    %r14
+  801ffa:	41 5f                	pop    %r15
+  801ffc:	5d                   	pop    %rbp
+  801ffd:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ffe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802003:	4c 89 ee             	mov    %r13,%rsi
+  802006:	bf 00 00 00 00       	mov    $0x0,%edi
+  80200b:	49 bc 82 14 80 00 00 	movabs $0x801482,%r12
+  802012:	00 00 00 
+  802015:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802018:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80201d:	4c 89 f6             	mov    %r14,%rsi
+  802020:	bf 00 00 00 00       	mov    $0x0,%edi
+  802025:	41 ff d4             	call   *%r12
+    return res;
+  802028:	eb c3                	jmp    801fed <dup+0xe6>
+
+000000000080202a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80202a:	55                   	push   %rbp
+  80202b:	48 89 e5             	mov    %rsp,%rbp
+  80202e:	41 56                	push   %r14
+  802030:	41 55                	push   %r13
+  802032:	41 54                	push   %r12
+  802034:	53                   	push   %rbx
+  802035:	48 83 ec 10          	sub    $0x10,%rsp
+  802039:	89 fb                	mov    %edi,%ebx
+  80203b:	49 89 f4             	mov    %rsi,%r12
+  80203e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802041:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802045:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  80204c:	00 00 00 
+  80204f:	ff d0                	call   *%rax
+  802051:	85 c0                	test   %eax,%eax
+  802053:	78 4c                	js     8020a1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802055:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802059:	41 8b 3e             	mov    (%r14),%edi
+  80205c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802060:	48 b8 92 1d 80 00 00 	movabs $0x801d92,%rax
+  802067:	00 00 00 
+  80206a:	ff d0                	call   *%rax
+  80206c:	85 c0                	test   %eax,%eax
+  80206e:	78 35                	js     8020a5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802070:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802074:	83 e0 03             	and    $0x3,%eax
+  802077:	83 f8 01             	cmp    $0x1,%eax
+  80207a:	74 2d                	je     8020a9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80207c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802080:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802084:	48 85 c0             	test   %rax,%rax
+  802087:	74 56                	je     8020df <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802089:	4c 89 ea             	mov    %r13,%rdx
+  80208c:	4c 89 e6             	mov    %r12,%rsi
+  80208f:	4c 89 f7             	mov    %r14,%rdi
+  802092:	ff d0                	call   *%rax
+}
+  802094:	48 83 c4 10          	add    $0x10,%rsp
+  802098:	5b                   	pop    %rbx
+  802099:	41 5c                	pop    %r12
+  80209b:	41 5d                	pop    %r13
+  80209d:	41 5e                	pop    %r14
+  80209f:	5d                   	pop    %rbp
+  8020a0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020a1:	48 98                	cltq
+  8020a3:	eb ef                	jmp    802094 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020a5:	48 98                	cltq
+  8020a7:	eb eb                	jmp    802094 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020a9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020b0:	00 00 00 
+  8020b3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020b9:	89 da                	mov    %ebx,%edx
+  8020bb:	48 bf 49 56 80 00 00 	movabs $0x805649,%rdi
+  8020c2:	00 00 00 
+  8020c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ca:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  8020d1:	00 00 00 
+  8020d4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020d6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020dd:	eb b5                	jmp    802094 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020df:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020e6:	eb ac                	jmp    802094 <read+0x6a>
+
+00000000008020e8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8020e8:	55                   	push   %rbp
+  8020e9:	48 89 e5             	mov    %rsp,%rbp
+  8020ec:	41 57                	push   %r15
+  8020ee:	41 56                	push   %r14
+  8020f0:	41 55                	push   %r13
+  8020f2:	41 54                	push   %r12
+  8020f4:	53                   	push   %rbx
+  8020f5:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8020f9:	48 85 d2             	test   %rdx,%rdx
+  8020fc:	74 54                	je     802152 <readn+0x6a>
+  8020fe:	41 89 fd             	mov    %edi,%r13d
+  802101:	49 89 f6             	mov    %rsi,%r14
+  802104:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802107:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80210c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802111:	49 bf 2a 20 80 00 00 	movabs $0x80202a,%r15
+  802118:	00 00 00 
+  80211b:	4c 89 e2             	mov    %r12,%rdx
+  80211e:	48 29 f2             	sub    %rsi,%rdx
+  802121:	4c 01 f6             	add    %r14,%rsi
+  802124:	44 89 ef             	mov    %r13d,%edi
+  802127:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80212a:	85 c0                	test   %eax,%eax
+  80212c:	78 20                	js     80214e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80212e:	01 c3                	add    %eax,%ebx
+  802130:	85 c0                	test   %eax,%eax
+  802132:	74 08                	je     80213c <readn+0x54>
+  802134:	48 63 f3             	movslq %ebx,%rsi
+  802137:	4c 39 e6             	cmp    %r12,%rsi
+  80213a:	72 df                	jb     80211b <readn+0x33>
+    }
+    return res;
+  80213c:	48 63 c3             	movslq %ebx,%rax
+}
+  80213f:	48 83 c4 08          	add    $0x8,%rsp
+  802143:	5b                   	pop    %rbx
+  802144:	41 5c                	pop    %r12
+  802146:	41 5d                	pop    %r13
+  802148:	41 5e                	pop    %r14
+  80214a:	41 5f                	pop    %r15
+  80214c:	5d                   	pop    %rbp
+  80214d:	c3                   	ret
+        if (inc < 0) return inc;
+  80214e:	48 98                	cltq
+  802150:	eb ed                	jmp    80213f <readn+0x57>
+    int inc = 1, res = 0;
+  802152:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802157:	eb e3                	jmp    80213c <readn+0x54>
+
+0000000000802159 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802159:	55                   	push   %rbp
+  80215a:	48 89 e5             	mov    %rsp,%rbp
+  80215d:	41 56                	push   %r14
+  80215f:	41 55                	push   %r13
+  802161:	41 54                	push   %r12
+  802163:	53                   	push   %rbx
+  802164:	48 83 ec 10          	sub    $0x10,%rsp
+  802168:	89 fb                	mov    %edi,%ebx
+  80216a:	49 89 f4             	mov    %rsi,%r12
+  80216d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802170:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802174:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  80217b:	00 00 00 
+  80217e:	ff d0                	call   *%rax
+  802180:	85 c0                	test   %eax,%eax
+  802182:	78 47                	js     8021cb <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802184:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802188:	41 8b 3e             	mov    (%r14),%edi
+  80218b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80218f:	48 b8 92 1d 80 00 00 	movabs $0x801d92,%rax
+  802196:	00 00 00 
+  802199:	ff d0                	call   *%rax
+  80219b:	85 c0                	test   %eax,%eax
+  80219d:	78 30                	js     8021cf <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80219f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8021a4:	74 2d                	je     8021d3 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021aa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8021ae:	48 85 c0             	test   %rax,%rax
+  8021b1:	74 56                	je     802209 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8021b3:	4c 89 ea             	mov    %r13,%rdx
+  8021b6:	4c 89 e6             	mov    %r12,%rsi
+  8021b9:	4c 89 f7             	mov    %r14,%rdi
+  8021bc:	ff d0                	call   *%rax
+}
+  8021be:	48 83 c4 10          	add    $0x10,%rsp
+  8021c2:	5b                   	pop    %rbx
+  8021c3:	41 5c                	pop    %r12
+  8021c5:	41 5d                	pop    %r13
+  8021c7:	41 5e                	pop    %r14
+  8021c9:	5d                   	pop    %rbp
+  8021ca:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021cb:	48 98                	cltq
+  8021cd:	eb ef                	jmp    8021be <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021cf:	48 98                	cltq
+  8021d1:	eb eb                	jmp    8021be <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021d3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021da:	00 00 00 
+  8021dd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021e3:	89 da                	mov    %ebx,%edx
+  8021e5:	48 bf 65 56 80 00 00 	movabs $0x805665,%rdi
+  8021ec:	00 00 00 
+  8021ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f4:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  8021fb:	00 00 00 
+  8021fe:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802200:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802207:	eb b5                	jmp    8021be <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802209:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802210:	eb ac                	jmp    8021be <write+0x65>
+
+0000000000802212 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802212:	55                   	push   %rbp
+  802213:	48 89 e5             	mov    %rsp,%rbp
+  802216:	53                   	push   %rbx
+  802217:	48 83 ec 18          	sub    $0x18,%rsp
+  80221b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80221d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802221:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  802228:	00 00 00 
+  80222b:	ff d0                	call   *%rax
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	78 0c                	js     80223d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802231:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802235:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802238:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80223d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802241:	c9                   	leave
+  802242:	c3                   	ret
+
+0000000000802243 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802243:	55                   	push   %rbp
+  802244:	48 89 e5             	mov    %rsp,%rbp
+  802247:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80224b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80224f:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  802256:	00 00 00 
+  802259:	ff d0                	call   *%rax
+  80225b:	85 c0                	test   %eax,%eax
+  80225d:	78 07                	js     802266 <tell+0x23>
+    return fdes->fd_offset;
+  80225f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802263:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802266:	c9                   	leave
+  802267:	c3                   	ret
+
+0000000000802268 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802268:	55                   	push   %rbp
+  802269:	48 89 e5             	mov    %rsp,%rbp
+  80226c:	41 55                	push   %r13
+  80226e:	41 54                	push   %r12
+  802270:	53                   	push   %rbx
+  802271:	48 83 ec 18          	sub    $0x18,%rsp
+  802275:	89 fb                	mov    %edi,%ebx
+  802277:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80227a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80227e:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  802285:	00 00 00 
+  802288:	ff d0                	call   *%rax
+  80228a:	85 c0                	test   %eax,%eax
+  80228c:	78 38                	js     8022c6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80228e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802292:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802296:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80229a:	48 b8 92 1d 80 00 00 	movabs $0x801d92,%rax
+  8022a1:	00 00 00 
+  8022a4:	ff d0                	call   *%rax
+  8022a6:	85 c0                	test   %eax,%eax
+  8022a8:	78 1c                	js     8022c6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022aa:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8022af:	74 20                	je     8022d1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022b5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8022b9:	48 85 c0             	test   %rax,%rax
+  8022bc:	74 47                	je     802305 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8022be:	44 89 e6             	mov    %r12d,%esi
+  8022c1:	4c 89 ef             	mov    %r13,%rdi
+  8022c4:	ff d0                	call   *%rax
+}
+  8022c6:	48 83 c4 18          	add    $0x18,%rsp
+  8022ca:	5b                   	pop    %rbx
+  8022cb:	41 5c                	pop    %r12
+  8022cd:	41 5d                	pop    %r13
+  8022cf:	5d                   	pop    %rbp
+  8022d0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8022d1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022d8:	00 00 00 
+  8022db:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022e1:	89 da                	mov    %ebx,%edx
+  8022e3:	48 bf 28 56 80 00 00 	movabs $0x805628,%rdi
+  8022ea:	00 00 00 
+  8022ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f2:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  8022f9:	00 00 00 
+  8022fc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802303:	eb c1                	jmp    8022c6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802305:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80230a:	eb ba                	jmp    8022c6 <ftruncate+0x5e>
+
+000000000080230c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80230c:	55                   	push   %rbp
+  80230d:	48 89 e5             	mov    %rsp,%rbp
+  802310:	41 54                	push   %r12
+  802312:	53                   	push   %rbx
+  802313:	48 83 ec 10          	sub    $0x10,%rsp
+  802317:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80231a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80231e:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  802325:	00 00 00 
+  802328:	ff d0                	call   *%rax
+  80232a:	85 c0                	test   %eax,%eax
+  80232c:	78 4e                	js     80237c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80232e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802332:	41 8b 3c 24          	mov    (%r12),%edi
+  802336:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80233a:	48 b8 92 1d 80 00 00 	movabs $0x801d92,%rax
+  802341:	00 00 00 
+  802344:	ff d0                	call   *%rax
+  802346:	85 c0                	test   %eax,%eax
+  802348:	78 32                	js     80237c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80234a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80234e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802353:	74 30                	je     802385 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802355:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802358:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80235f:	00 00 00 
+    stat->st_isdir = 0;
+  802362:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802369:	00 00 00 
+    stat->st_dev = dev;
+  80236c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802373:	48 89 de             	mov    %rbx,%rsi
+  802376:	4c 89 e7             	mov    %r12,%rdi
+  802379:	ff 50 28             	call   *0x28(%rax)
+}
+  80237c:	48 83 c4 10          	add    $0x10,%rsp
+  802380:	5b                   	pop    %rbx
+  802381:	41 5c                	pop    %r12
+  802383:	5d                   	pop    %rbp
+  802384:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802385:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80238a:	eb f0                	jmp    80237c <fstat+0x70>
+
+000000000080238c <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80238c:	55                   	push   %rbp
+  80238d:	48 89 e5             	mov    %rsp,%rbp
+  802390:	41 54                	push   %r12
+  802392:	53                   	push   %rbx
+  802393:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80239a:	41 89 fc             	mov    %edi,%r12d
+  80239d:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80239f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023a3:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  8023aa:	00 00 00 
+  8023ad:	ff d0                	call   *%rax
+  8023af:	85 c0                	test   %eax,%eax
+  8023b1:	78 31                	js     8023e4 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8023b3:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8023ba:	44 89 e7             	mov    %r12d,%edi
+  8023bd:	48 b8 0c 23 80 00 00 	movabs $0x80230c,%rax
+  8023c4:	00 00 00 
+  8023c7:	ff d0                	call   *%rax
+  8023c9:	85 c0                	test   %eax,%eax
+  8023cb:	78 17                	js     8023e4 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8023cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023d1:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8023d4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8023d7:	39 d3                	cmp    %edx,%ebx
+  8023d9:	0f 4f da             	cmovg  %edx,%ebx
+  8023dc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e4:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8023eb:	5b                   	pop    %rbx
+  8023ec:	41 5c                	pop    %r12
+  8023ee:	5d                   	pop    %rbp
+  8023ef:	c3                   	ret
+
+00000000008023f0 <seektoend>:
+{
+  8023f0:	55                   	push   %rbp
+  8023f1:	48 89 e5             	mov    %rsp,%rbp
+  8023f4:	53                   	push   %rbx
+  8023f5:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8023fc:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8023fe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802402:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  802409:	00 00 00 
+  80240c:	ff d0                	call   *%rax
+  80240e:	85 c0                	test   %eax,%eax
+  802410:	78 28                	js     80243a <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802412:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802419:	89 df                	mov    %ebx,%edi
+  80241b:	48 b8 0c 23 80 00 00 	movabs $0x80230c,%rax
+  802422:	00 00 00 
+  802425:	ff d0                	call   *%rax
+  802427:	85 c0                	test   %eax,%eax
+  802429:	78 0f                	js     80243a <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80242b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80242e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802432:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802435:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80243a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80243e:	c9                   	leave
+  80243f:	c3                   	ret
+
+0000000000802440 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802440:	55                   	push   %rbp
+  802441:	48 89 e5             	mov    %rsp,%rbp
+  802444:	41 54                	push   %r12
+  802446:	53                   	push   %rbx
+  802447:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80244a:	be 00 00 00 00       	mov    $0x0,%esi
+  80244f:	48 b8 33 30 80 00 00 	movabs $0x803033,%rax
+  802456:	00 00 00 
+  802459:	ff d0                	call   *%rax
+  80245b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	78 25                	js     802486 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802461:	4c 89 e6             	mov    %r12,%rsi
+  802464:	89 c7                	mov    %eax,%edi
+  802466:	48 b8 0c 23 80 00 00 	movabs $0x80230c,%rax
+  80246d:	00 00 00 
+  802470:	ff d0                	call   *%rax
+  802472:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802475:	89 df                	mov    %ebx,%edi
+  802477:	48 b8 ac 1e 80 00 00 	movabs $0x801eac,%rax
+  80247e:	00 00 00 
+  802481:	ff d0                	call   *%rax
+
+    return res;
+  802483:	44 89 e3             	mov    %r12d,%ebx
+}
+  802486:	89 d8                	mov    %ebx,%eax
+  802488:	5b                   	pop    %rbx
+  802489:	41 5c                	pop    %r12
+  80248b:	5d                   	pop    %rbp
+  80248c:	c3                   	ret
+
+000000000080248d <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  80248d:	55                   	push   %rbp
+  80248e:	48 89 e5             	mov    %rsp,%rbp
+  802491:	53                   	push   %rbx
+  802492:	48 83 ec 08          	sub    $0x8,%rsp
+  802496:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802499:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  8024a0:	00 00 00 
+  8024a3:	ff d0                	call   *%rax
+  8024a5:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8024a9:	0f 87 ea 00 00 00    	ja     802599 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8024af:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024b6:	00 00 00 
+  8024b9:	80 38 00             	cmpb   $0x0,(%rax)
+  8024bc:	75 35                	jne    8024f3 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8024be:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8024c3:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8024c8:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8024cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024d2:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  8024d9:	00 00 00 
+  8024dc:	ff d0                	call   *%rax
+  8024de:	85 c0                	test   %eax,%eax
+  8024e0:	0f 88 ba 00 00 00    	js     8025a0 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8024e6:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024ed:	00 00 00 
+  8024f0:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8024f3:	48 89 df             	mov    %rbx,%rdi
+  8024f6:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  8024fd:	00 00 00 
+  802500:	ff d0                	call   *%rax
+  802502:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802506:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80250d:	00 00 00 
+  802510:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802514:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802517:	39 39                	cmp    %edi,(%rcx)
+  802519:	74 46                	je     802561 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80251b:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80251f:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802526:	00 
+  802527:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80252e:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802535:	00 
+  802536:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80253d:	00 
+  80253e:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802545:	00 
+  802546:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80254d:	00 
+  80254e:	89 39                	mov    %edi,(%rcx)
+  802550:	48 01 c6             	add    %rax,%rsi
+  802553:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802558:	48 89 c8             	mov    %rcx,%rax
+  80255b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80255f:	c9                   	leave
+  802560:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802561:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802565:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80256c:	00 00 00 
+  80256f:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802572:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802576:	74 e0                	je     802558 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802578:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80257f:	00 
+  802580:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802584:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  80258b:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80258d:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802590:	48 01 c2             	add    %rax,%rdx
+  802593:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802597:	eb bf                	jmp    802558 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802599:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80259e:	eb b8                	jmp    802558 <fbuf_get+0xcb>
+            return NULL;
+  8025a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a5:	eb b1                	jmp    802558 <fbuf_get+0xcb>
+
+00000000008025a7 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8025a7:	55                   	push   %rbp
+  8025a8:	48 89 e5             	mov    %rsp,%rbp
+  8025ab:	53                   	push   %rbx
+  8025ac:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8025b0:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025b7:	00 00 00 
+  8025ba:	48 8b 18             	mov    (%rax),%rbx
+  8025bd:	48 85 db             	test   %rbx,%rbx
+  8025c0:	74 16                	je     8025d8 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8025c2:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025c9:	00 00 00 
+  8025cc:	48 8b 18             	mov    (%rax),%rbx
+}
+  8025cf:	48 89 d8             	mov    %rbx,%rax
+  8025d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025d6:	c9                   	leave
+  8025d7:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8025d8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8025dd:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8025e2:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8025e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ec:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  8025f3:	00 00 00 
+  8025f6:	ff d0                	call   *%rax
+  8025f8:	85 c0                	test   %eax,%eax
+  8025fa:	78 d3                	js     8025cf <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8025fc:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802601:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802608:	00 00 00 
+  80260b:	eb b5                	jmp    8025c2 <fsipc_bulk+0x1b>
+
+000000000080260d <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80260d:	55                   	push   %rbp
+  80260e:	48 89 e5             	mov    %rsp,%rbp
+  802611:	41 57                	push   %r15
+  802613:	41 56                	push   %r14
+  802615:	41 55                	push   %r13
+  802617:	41 54                	push   %r12
+  802619:	53                   	push   %rbx
+  80261a:	48 83 ec 08          	sub    $0x8,%rsp
+  80261e:	41 89 fd             	mov    %edi,%r13d
+  802621:	49 89 f6             	mov    %rsi,%r14
+  802624:	49 89 d7             	mov    %rdx,%r15
+  802627:	48 89 cb             	mov    %rcx,%rbx
+  80262a:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80262d:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802634:	00 00 00 
+  802637:	83 38 00             	cmpl   $0x0,(%rax)
+  80263a:	74 52                	je     80268e <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80263c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802642:	4c 89 f9             	mov    %r15,%rcx
+  802645:	4c 89 f2             	mov    %r14,%rdx
+  802648:	44 89 ee             	mov    %r13d,%esi
+  80264b:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802652:	00 00 00 
+  802655:	8b 38                	mov    (%rax),%edi
+  802657:	48 b8 95 41 80 00 00 	movabs $0x804195,%rax
+  80265e:	00 00 00 
+  802661:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802663:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802668:	4c 89 e2             	mov    %r12,%rdx
+  80266b:	48 89 de             	mov    %rbx,%rsi
+  80266e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802673:	48 b8 e5 3f 80 00 00 	movabs $0x803fe5,%rax
+  80267a:	00 00 00 
+  80267d:	ff d0                	call   *%rax
+}
+  80267f:	48 83 c4 08          	add    $0x8,%rsp
+  802683:	5b                   	pop    %rbx
+  802684:	41 5c                	pop    %r12
+  802686:	41 5d                	pop    %r13
+  802688:	41 5e                	pop    %r14
+  80268a:	41 5f                	pop    %r15
+  80268c:	5d                   	pop    %rbp
+  80268d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80268e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802693:	48 b8 38 42 80 00 00 	movabs $0x804238,%rax
+  80269a:	00 00 00 
+  80269d:	ff d0                	call   *%rax
+  80269f:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8026a6:	00 00 
+  8026a8:	eb 92                	jmp    80263c <fsipc_region+0x2f>
+
+00000000008026aa <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8026aa:	55                   	push   %rbp
+  8026ab:	48 89 e5             	mov    %rsp,%rbp
+  8026ae:	41 57                	push   %r15
+  8026b0:	41 56                	push   %r14
+  8026b2:	41 55                	push   %r13
+  8026b4:	41 54                	push   %r12
+  8026b6:	53                   	push   %rbx
+  8026b7:	48 83 ec 28          	sub    $0x28,%rsp
+  8026bb:	49 89 ff             	mov    %rdi,%r15
+  8026be:	49 89 f6             	mov    %rsi,%r14
+  8026c1:	48 89 d3             	mov    %rdx,%rbx
+  8026c4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026c8:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8026cb:	48 b8 a7 25 80 00 00 	movabs $0x8025a7,%rax
+  8026d2:	00 00 00 
+  8026d5:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8026d7:	48 85 c0             	test   %rax,%rax
+  8026da:	0f 84 cc 00 00 00    	je     8027ac <devfile_write_direct+0x102>
+  8026e0:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8026e3:	48 85 db             	test   %rbx,%rbx
+  8026e6:	0f 84 ba 00 00 00    	je     8027a6 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8026ec:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8026f2:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8026f9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8026fd:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802701:	4c 29 e3             	sub    %r12,%rbx
+  802704:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802709:	48 39 c3             	cmp    %rax,%rbx
+  80270c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802710:	48 89 da             	mov    %rbx,%rdx
+  802713:	4c 89 f6             	mov    %r14,%rsi
+  802716:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80271a:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  802721:	00 00 00 
+  802724:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802726:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80272a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  80272e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802731:	44 01 e0             	add    %r12d,%eax
+  802734:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802738:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80273c:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802743:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80274a:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802751:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802757:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80275c:	4c 89 ee             	mov    %r13,%rsi
+  80275f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802764:	48 b8 0d 26 80 00 00 	movabs $0x80260d,%rax
+  80276b:	00 00 00 
+  80276e:	ff d0                	call   *%rax
+        if (res < 0)
+  802770:	85 c0                	test   %eax,%eax
+  802772:	78 29                	js     80279d <devfile_write_direct+0xf3>
+        if (res == 0)
+  802774:	74 2b                	je     8027a1 <devfile_write_direct+0xf7>
+        i += res;
+  802776:	48 98                	cltq
+  802778:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  80277b:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  80277e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802782:	49 39 c4             	cmp    %rax,%r12
+  802785:	0f 82 72 ff ff ff    	jb     8026fd <devfile_write_direct+0x53>
+    return i;
+  80278b:	4c 89 e0             	mov    %r12,%rax
+}
+  80278e:	48 83 c4 28          	add    $0x28,%rsp
+  802792:	5b                   	pop    %rbx
+  802793:	41 5c                	pop    %r12
+  802795:	41 5d                	pop    %r13
+  802797:	41 5e                	pop    %r14
+  802799:	41 5f                	pop    %r15
+  80279b:	5d                   	pop    %rbp
+  80279c:	c3                   	ret
+            return res;
+  80279d:	48 98                	cltq
+  80279f:	eb ed                	jmp    80278e <devfile_write_direct+0xe4>
+            return i;
+  8027a1:	4c 89 e0             	mov    %r12,%rax
+  8027a4:	eb e8                	jmp    80278e <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8027a6:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8027aa:	eb df                	jmp    80278b <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8027ac:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8027b3:	eb d9                	jmp    80278e <devfile_write_direct+0xe4>
+
+00000000008027b5 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8027b5:	55                   	push   %rbp
+  8027b6:	48 89 e5             	mov    %rsp,%rbp
+  8027b9:	41 56                	push   %r14
+  8027bb:	41 55                	push   %r13
+  8027bd:	41 54                	push   %r12
+  8027bf:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8027c0:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8027c4:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8027c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027cd:	4d 39 ee             	cmp    %r13,%r14
+  8027d0:	0f 84 99 00 00 00    	je     80286f <fbuf_flush+0xba>
+  8027d6:	49 89 fc             	mov    %rdi,%r12
+  8027d9:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8027dc:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8027df:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8027e3:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  8027ea:	00 00 00 
+  8027ed:	ff d0                	call   *%rax
+  8027ef:	48 89 c2             	mov    %rax,%rdx
+  8027f2:	48 c1 e2 04          	shl    $0x4,%rdx
+  8027f6:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8027fa:	48 c1 e0 0c          	shl    $0xc,%rax
+  8027fe:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802803:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802806:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80280a:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802811:	00 
+  802812:	44 89 f1             	mov    %r14d,%ecx
+  802815:	4c 89 ea             	mov    %r13,%rdx
+  802818:	4c 89 e7             	mov    %r12,%rdi
+  80281b:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  802822:	00 00 00 
+  802825:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802827:	48 85 c0             	test   %rax,%rax
+  80282a:	78 43                	js     80286f <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80282c:	4c 39 e8             	cmp    %r13,%rax
+  80282f:	72 47                	jb     802878 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802831:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802836:	83 c0 01             	add    $0x1,%eax
+  802839:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80283e:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802841:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802845:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802849:	72 0f                	jb     80285a <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  80284b:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80284f:	48 39 c2             	cmp    %rax,%rdx
+  802852:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802856:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  80285a:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802861:	00 
+  802862:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802869:	00 
+    return 0;
+  80286a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80286f:	5b                   	pop    %rbx
+  802870:	41 5c                	pop    %r12
+  802872:	41 5d                	pop    %r13
+  802874:	41 5e                	pop    %r14
+  802876:	5d                   	pop    %rbp
+  802877:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802878:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80287d:	eb f0                	jmp    80286f <fbuf_flush+0xba>
+
+000000000080287f <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80287f:	55                   	push   %rbp
+  802880:	48 89 e5             	mov    %rsp,%rbp
+  802883:	53                   	push   %rbx
+  802884:	48 83 ec 08          	sub    $0x8,%rsp
+  802888:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  80288b:	48 b8 8d 24 80 00 00 	movabs $0x80248d,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+  802897:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  80289a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289f:	48 85 f6             	test   %rsi,%rsi
+  8028a2:	74 0f                	je     8028b3 <devfile_sync+0x34>
+  8028a4:	48 89 df             	mov    %rbx,%rdi
+  8028a7:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  8028ae:	00 00 00 
+  8028b1:	ff d0                	call   *%rax
+}
+  8028b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b7:	c9                   	leave
+  8028b8:	c3                   	ret
+
+00000000008028b9 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8028b9:	55                   	push   %rbp
+  8028ba:	48 89 e5             	mov    %rsp,%rbp
+  8028bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8028c1:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8028c4:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8028cb:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8028cc:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8028d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028d5:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8028dc:	00 00 00 
+  8028df:	48 b8 0d 26 80 00 00 	movabs $0x80260d,%rax
+  8028e6:	00 00 00 
+  8028e9:	ff d0                	call   *%rax
+}
+  8028eb:	c9                   	leave
+  8028ec:	c3                   	ret
+
+00000000008028ed <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8028ed:	55                   	push   %rbp
+  8028ee:	48 89 e5             	mov    %rsp,%rbp
+  8028f1:	41 54                	push   %r12
+  8028f3:	53                   	push   %rbx
+  8028f4:	48 89 fb             	mov    %rdi,%rbx
+  8028f7:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8028fa:	48 b8 7f 28 80 00 00 	movabs $0x80287f,%rax
+  802901:	00 00 00 
+  802904:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802906:	85 c0                	test   %eax,%eax
+  802908:	78 63                	js     80296d <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80290a:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80290d:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802914:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802916:	be 00 00 00 00       	mov    $0x0,%esi
+  80291b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802920:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  802927:	00 00 00 
+  80292a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80292c:	85 c0                	test   %eax,%eax
+  80292e:	78 3d                	js     80296d <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802930:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802937:	00 00 00 
+  80293a:	48 89 de             	mov    %rbx,%rsi
+  80293d:	4c 89 e7             	mov    %r12,%rdi
+  802940:	48 b8 43 0b 80 00 00 	movabs $0x800b43,%rax
+  802947:	00 00 00 
+  80294a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80294c:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802952:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802959:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80295a:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802960:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802967:	00 
+
+    return 0;
+  802968:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80296d:	5b                   	pop    %rbx
+  80296e:	41 5c                	pop    %r12
+  802970:	5d                   	pop    %rbp
+  802971:	c3                   	ret
+
+0000000000802972 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802972:	55                   	push   %rbp
+  802973:	48 89 e5             	mov    %rsp,%rbp
+  802976:	41 54                	push   %r12
+  802978:	53                   	push   %rbx
+  802979:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  80297c:	48 b8 7f 28 80 00 00 	movabs $0x80287f,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+  802988:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  80298b:	48 89 df             	mov    %rbx,%rdi
+  80298e:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  802995:	00 00 00 
+  802998:	ff d0                	call   *%rax
+  80299a:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80299e:	76 2e                	jbe    8029ce <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  8029a0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8029a3:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8029aa:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8029ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029b6:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  8029bd:	00 00 00 
+  8029c0:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8029c2:	45 85 e4             	test   %r12d,%r12d
+  8029c5:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8029c9:	5b                   	pop    %rbx
+  8029ca:	41 5c                	pop    %r12
+  8029cc:	5d                   	pop    %rbp
+  8029cd:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8029ce:	48 89 df             	mov    %rbx,%rdi
+  8029d1:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+  8029dd:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8029e1:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8029e8:	00 00 00 
+  8029eb:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8029f2:	48 89 df             	mov    %rbx,%rdi
+  8029f5:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  8029fc:	00 00 00 
+  8029ff:	ff d0                	call   *%rax
+  802a01:	48 89 c6             	mov    %rax,%rsi
+  802a04:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a09:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a0e:	48 b8 82 14 80 00 00 	movabs $0x801482,%rax
+  802a15:	00 00 00 
+  802a18:	ff d0                	call   *%rax
+  802a1a:	eb 84                	jmp    8029a0 <devfile_flush+0x2e>
+
+0000000000802a1c <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802a1c:	55                   	push   %rbp
+  802a1d:	48 89 e5             	mov    %rsp,%rbp
+  802a20:	41 55                	push   %r13
+  802a22:	41 54                	push   %r12
+  802a24:	53                   	push   %rbx
+  802a25:	48 83 ec 08          	sub    $0x8,%rsp
+  802a29:	48 89 fb             	mov    %rdi,%rbx
+  802a2c:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802a2f:	48 b8 8d 24 80 00 00 	movabs $0x80248d,%rax
+  802a36:	00 00 00 
+  802a39:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802a3b:	48 85 c0             	test   %rax,%rax
+  802a3e:	74 51                	je     802a91 <devfile_trunc+0x75>
+  802a40:	49 89 c4             	mov    %rax,%r12
+  802a43:	48 89 c6             	mov    %rax,%rsi
+  802a46:	48 89 df             	mov    %rbx,%rdi
+  802a49:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  802a50:	00 00 00 
+  802a53:	ff d0                	call   *%rax
+  802a55:	85 c0                	test   %eax,%eax
+  802a57:	78 2d                	js     802a86 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a59:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802a60:	00 00 00 
+  802a63:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802a66:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802a68:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802a6c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a71:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a76:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  802a7d:	00 00 00 
+  802a80:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802a82:	85 c0                	test   %eax,%eax
+  802a84:	79 3e                	jns    802ac4 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802a86:	48 83 c4 08          	add    $0x8,%rsp
+  802a8a:	5b                   	pop    %rbx
+  802a8b:	41 5c                	pop    %r12
+  802a8d:	41 5d                	pop    %r13
+  802a8f:	5d                   	pop    %rbp
+  802a90:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a91:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802a98:	00 00 00 
+  802a9b:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802a9e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802aa0:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802aa4:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa9:	bf 02 00 00 00       	mov    $0x2,%edi
+  802aae:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  802ab5:	00 00 00 
+  802ab8:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802aba:	85 c0                	test   %eax,%eax
+  802abc:	78 c8                	js     802a86 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802abe:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ac2:	eb c2                	jmp    802a86 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ac4:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802ac7:	8d 51 01             	lea    0x1(%rcx),%edx
+  802aca:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802acd:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802ad2:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802ad9:	00 00 
+  802adb:	eb a9                	jmp    802a86 <devfile_trunc+0x6a>
+
+0000000000802add <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802add:	55                   	push   %rbp
+  802ade:	48 89 e5             	mov    %rsp,%rbp
+  802ae1:	41 57                	push   %r15
+  802ae3:	41 56                	push   %r14
+  802ae5:	41 55                	push   %r13
+  802ae7:	41 54                	push   %r12
+  802ae9:	53                   	push   %rbx
+  802aea:	48 83 ec 28          	sub    $0x28,%rsp
+  802aee:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802af2:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802af6:	49 89 d7             	mov    %rdx,%r15
+  802af9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802afd:	48 b8 8d 24 80 00 00 	movabs $0x80248d,%rax
+  802b04:	00 00 00 
+  802b07:	ff d0                	call   *%rax
+  802b09:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802b0c:	48 85 c0             	test   %rax,%rax
+  802b0f:	74 31                	je     802b42 <devfile_write+0x65>
+  802b11:	4c 89 f8             	mov    %r15,%rax
+  802b14:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802b1b:	77 25                	ja     802b42 <devfile_write+0x65>
+    size_t i = 0;
+  802b1d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802b23:	48 85 c0             	test   %rax,%rax
+  802b26:	0f 85 64 01 00 00    	jne    802c90 <devfile_write+0x1b3>
+    size_t i = 0;
+  802b2c:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802b30:	4c 89 f8             	mov    %r15,%rax
+}
+  802b33:	48 83 c4 28          	add    $0x28,%rsp
+  802b37:	5b                   	pop    %rbx
+  802b38:	41 5c                	pop    %r12
+  802b3a:	41 5d                	pop    %r13
+  802b3c:	41 5e                	pop    %r14
+  802b3e:	41 5f                	pop    %r15
+  802b40:	5d                   	pop    %rbp
+  802b41:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802b42:	48 85 db             	test   %rbx,%rbx
+  802b45:	74 5b                	je     802ba2 <devfile_write+0xc5>
+  802b47:	48 89 de             	mov    %rbx,%rsi
+  802b4a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b4e:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  802b55:	00 00 00 
+  802b58:	ff d0                	call   *%rax
+  802b5a:	85 c0                	test   %eax,%eax
+  802b5c:	78 40                	js     802b9e <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802b5e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b62:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802b65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b69:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802b6d:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  802b74:	00 00 00 
+  802b77:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802b79:	48 85 c0             	test   %rax,%rax
+  802b7c:	7e b5                	jle    802b33 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802b7e:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802b82:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802b85:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802b88:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802b8b:	8d 51 01             	lea    0x1(%rcx),%edx
+  802b8e:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802b91:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802b94:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802b9b:	00 
+  802b9c:	eb 95                	jmp    802b33 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802b9e:	48 98                	cltq
+  802ba0:	eb 91                	jmp    802b33 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802ba2:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802ba6:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802ba9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bad:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802bb1:	48 89 df             	mov    %rbx,%rdi
+  802bb4:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  802bbb:	00 00 00 
+  802bbe:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802bc0:	48 85 c0             	test   %rax,%rax
+  802bc3:	0f 8e 6a ff ff ff    	jle    802b33 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802bc9:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802bcc:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802bd0:	e9 5e ff ff ff       	jmp    802b33 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802bd5:	48 98                	cltq
+  802bd7:	4d 85 ff             	test   %r15,%r15
+  802bda:	49 0f 45 c7          	cmovne %r15,%rax
+  802bde:	e9 50 ff ff ff       	jmp    802b33 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802be3:	48 89 de             	mov    %rbx,%rsi
+  802be6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802bea:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+  802bf6:	85 c0                	test   %eax,%eax
+  802bf8:	0f 88 2b 01 00 00    	js     802d29 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802bfe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c02:	4c 01 f8             	add    %r15,%rax
+  802c05:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c09:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c0d:	48 b9 b9 1c 80 00 00 	movabs $0x801cb9,%rcx
+  802c14:	00 00 00 
+  802c17:	ff d1                	call   *%rcx
+  802c19:	48 89 c2             	mov    %rax,%rdx
+  802c1c:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c20:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c24:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c28:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802c2d:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802c30:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802c37:	00 
+  802c38:	4c 89 ea             	mov    %r13,%rdx
+  802c3b:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802c3f:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  802c46:	00 00 00 
+  802c49:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802c4b:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c4f:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802c53:	48 39 c2             	cmp    %rax,%rdx
+  802c56:	0f 84 db 00 00 00    	je     802d37 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802c5c:	4c 39 e2             	cmp    %r12,%rdx
+  802c5f:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802c63:	4d 01 ec             	add    %r13,%r12
+  802c66:	49 39 c4             	cmp    %rax,%r12
+  802c69:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802c6d:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802c71:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802c75:	45 01 ee             	add    %r13d,%r14d
+  802c78:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c7c:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802c80:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802c83:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c87:	49 39 c7             	cmp    %rax,%r15
+  802c8a:	0f 83 a0 fe ff ff    	jae    802b30 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802c90:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c94:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802c98:	8b 43 08             	mov    0x8(%rbx),%eax
+  802c9b:	44 39 f0             	cmp    %r14d,%eax
+  802c9e:	7f 10                	jg     802cb0 <devfile_write+0x1d3>
+  802ca0:	48 98                	cltq
+  802ca2:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802ca8:	49 63 d6             	movslq %r14d,%rdx
+  802cab:	48 39 d0             	cmp    %rdx,%rax
+  802cae:	7d 2d                	jge    802cdd <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802cb0:	48 89 de             	mov    %rbx,%rsi
+  802cb3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802cb7:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  802cbe:	00 00 00 
+  802cc1:	ff d0                	call   *%rax
+  802cc3:	85 c0                	test   %eax,%eax
+  802cc5:	0f 88 0a ff ff ff    	js     802bd5 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802ccb:	44 89 f0             	mov    %r14d,%eax
+  802cce:	66 b8 00 00          	mov    $0x0,%ax
+  802cd2:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802cd5:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802cdc:	00 
+        size_t off = pos - fb->fb_base;
+  802cdd:	45 89 f4             	mov    %r14d,%r12d
+  802ce0:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802ce4:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802ce7:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802ceb:	4d 29 fd             	sub    %r15,%r13
+  802cee:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802cf3:	4c 29 e0             	sub    %r12,%rax
+  802cf6:	49 39 c5             	cmp    %rax,%r13
+  802cf9:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802cfd:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802d01:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802d05:	48 39 c2             	cmp    %rax,%rdx
+  802d08:	0f 84 f0 fe ff ff    	je     802bfe <devfile_write+0x121>
+  802d0e:	4c 39 e0             	cmp    %r12,%rax
+  802d11:	0f 82 cc fe ff ff    	jb     802be3 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802d17:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d1b:	48 39 d0             	cmp    %rdx,%rax
+  802d1e:	0f 83 da fe ff ff    	jae    802bfe <devfile_write+0x121>
+  802d24:	e9 ba fe ff ff       	jmp    802be3 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d29:	48 98                	cltq
+  802d2b:	4d 85 ff             	test   %r15,%r15
+  802d2e:	49 0f 45 c7          	cmovne %r15,%rax
+  802d32:	e9 fc fd ff ff       	jmp    802b33 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802d37:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d3b:	4c 89 e2             	mov    %r12,%rdx
+  802d3e:	e9 2a ff ff ff       	jmp    802c6d <devfile_write+0x190>
+
+0000000000802d43 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d43:	55                   	push   %rbp
+  802d44:	48 89 e5             	mov    %rsp,%rbp
+  802d47:	41 57                	push   %r15
+  802d49:	41 56                	push   %r14
+  802d4b:	41 55                	push   %r13
+  802d4d:	41 54                	push   %r12
+  802d4f:	53                   	push   %rbx
+  802d50:	48 83 ec 28          	sub    $0x28,%rsp
+  802d54:	49 89 ff             	mov    %rdi,%r15
+  802d57:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d5b:	48 89 d3             	mov    %rdx,%rbx
+  802d5e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802d62:	48 b8 8d 24 80 00 00 	movabs $0x80248d,%rax
+  802d69:	00 00 00 
+  802d6c:	ff d0                	call   *%rax
+  802d6e:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802d71:	48 85 c0             	test   %rax,%rax
+  802d74:	74 0d                	je     802d83 <devfile_read+0x40>
+  802d76:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802d7d:	0f 86 1a 01 00 00    	jbe    802e9d <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d83:	4d 85 e4             	test   %r12,%r12
+  802d86:	74 1a                	je     802da2 <devfile_read+0x5f>
+  802d88:	4c 89 e6             	mov    %r12,%rsi
+  802d8b:	4c 89 ff             	mov    %r15,%rdi
+  802d8e:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  802d95:	00 00 00 
+  802d98:	ff d0                	call   *%rax
+  802d9a:	85 c0                	test   %eax,%eax
+  802d9c:	0f 88 e8 00 00 00    	js     802e8a <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802da2:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802da6:	48 b8 a7 25 80 00 00 	movabs $0x8025a7,%rax
+  802dad:	00 00 00 
+  802db0:	ff d0                	call   *%rax
+  802db2:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802db5:	48 85 c0             	test   %rax,%rax
+  802db8:	0f 84 69 02 00 00    	je     803027 <devfile_read+0x2e4>
+    while (i < n) {
+  802dbe:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802dc3:	0f 84 ce 00 00 00    	je     802e97 <devfile_read+0x154>
+    size_t i = 0;
+  802dc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802dce:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802dd5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802dd9:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802ddd:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802de1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802de5:	48 29 da             	sub    %rbx,%rdx
+  802de8:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802ded:	48 39 c2             	cmp    %rax,%rdx
+  802df0:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802df4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802df8:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802dfc:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802dff:	01 d8                	add    %ebx,%eax
+  802e01:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802e05:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802e09:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802e10:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e17:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802e1e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e29:	4c 89 ee             	mov    %r13,%rsi
+  802e2c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e31:	48 b8 0d 26 80 00 00 	movabs $0x80260d,%rax
+  802e38:	00 00 00 
+  802e3b:	ff d0                	call   *%rax
+        if (res < 0)
+  802e3d:	85 c0                	test   %eax,%eax
+  802e3f:	78 4d                	js     802e8e <devfile_read+0x14b>
+        if (res == 0)
+  802e41:	74 4f                	je     802e92 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802e43:	4c 63 e0             	movslq %eax,%r12
+  802e46:	4c 89 e2             	mov    %r12,%rdx
+  802e49:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802e4d:	4c 89 f7             	mov    %r14,%rdi
+  802e50:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  802e57:	00 00 00 
+  802e5a:	ff d0                	call   *%rax
+        i += res;
+  802e5c:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  802e5f:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  802e62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e66:	48 39 c3             	cmp    %rax,%rbx
+  802e69:	0f 82 72 ff ff ff    	jb     802de1 <devfile_read+0x9e>
+    return i;
+  802e6f:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802e72:	48 85 c0             	test   %rax,%rax
+  802e75:	7e 04                	jle    802e7b <devfile_read+0x138>
+  802e77:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  802e7b:	48 83 c4 28          	add    $0x28,%rsp
+  802e7f:	5b                   	pop    %rbx
+  802e80:	41 5c                	pop    %r12
+  802e82:	41 5d                	pop    %r13
+  802e84:	41 5e                	pop    %r14
+  802e86:	41 5f                	pop    %r15
+  802e88:	5d                   	pop    %rbp
+  802e89:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e8a:	48 98                	cltq
+  802e8c:	eb ed                	jmp    802e7b <devfile_read+0x138>
+            return res;
+  802e8e:	48 98                	cltq
+  802e90:	eb e9                	jmp    802e7b <devfile_read+0x138>
+            return i;
+  802e92:	48 89 d8             	mov    %rbx,%rax
+  802e95:	eb db                	jmp    802e72 <devfile_read+0x12f>
+    size_t i = 0;
+  802e97:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802e9b:	eb d2                	jmp    802e6f <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802e9d:	48 89 c6             	mov    %rax,%rsi
+  802ea0:	4c 89 ff             	mov    %r15,%rdi
+  802ea3:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  802eaa:	00 00 00 
+  802ead:	ff d0                	call   *%rax
+  802eaf:	85 c0                	test   %eax,%eax
+  802eb1:	78 40                	js     802ef3 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802eb3:	4c 89 ff             	mov    %r15,%rdi
+  802eb6:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  802ebd:	00 00 00 
+  802ec0:	ff d0                	call   *%rax
+  802ec2:	48 89 c2             	mov    %rax,%rdx
+  802ec5:	48 c1 e2 04          	shl    $0x4,%rdx
+  802ec9:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802ecd:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ed1:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802ed6:	48 01 d0             	add    %rdx,%rax
+  802ed9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  802edd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802ee2:	0f 84 33 01 00 00    	je     80301b <devfile_read+0x2d8>
+    size_t i = 0;
+  802ee8:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802eee:	e9 f5 00 00 00       	jmp    802fe8 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802ef3:	48 98                	cltq
+  802ef5:	eb 84                	jmp    802e7b <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802ef7:	44 89 e8             	mov    %r13d,%eax
+  802efa:	66 b8 00 00          	mov    $0x0,%ax
+  802efe:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  802f03:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f0a:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  802f0c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f10:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f14:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  802f16:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802f1b:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  802f1e:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  802f25:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  802f26:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f31:	ba 00 10 01 00       	mov    $0x11000,%edx
+  802f36:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f3b:	48 b8 0d 26 80 00 00 	movabs $0x80260d,%rax
+  802f42:	00 00 00 
+  802f45:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  802f47:	85 c0                	test   %eax,%eax
+  802f49:	0f 88 be 00 00 00    	js     80300d <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  802f4f:	48 63 d0             	movslq %eax,%rdx
+  802f52:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  802f57:	41 03 44 24 08       	add    0x8(%r12),%eax
+  802f5c:	44 39 e8             	cmp    %r13d,%eax
+  802f5f:	0f 8e ba 00 00 00    	jle    80301f <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  802f65:	49 63 c5             	movslq %r13d,%rax
+  802f68:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802f6d:	48 29 c3             	sub    %rax,%rbx
+  802f70:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  802f75:	48 01 c3             	add    %rax,%rbx
+  802f78:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f7c:	4c 29 f0             	sub    %r14,%rax
+  802f7f:	48 39 c3             	cmp    %rax,%rbx
+  802f82:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802f86:	4c 89 ff             	mov    %r15,%rdi
+  802f89:	48 b9 b9 1c 80 00 00 	movabs $0x801cb9,%rcx
+  802f90:	00 00 00 
+  802f93:	ff d1                	call   *%rcx
+  802f95:	48 89 c2             	mov    %rax,%rdx
+  802f98:	48 c1 e2 04          	shl    $0x4,%rdx
+  802f9c:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802fa0:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fa4:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  802fa9:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  802fac:	44 89 ea             	mov    %r13d,%edx
+  802faf:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  802fb4:	48 63 d2             	movslq %edx,%rdx
+  802fb7:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802fbe:	00 
+  802fbf:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802fc3:	4c 01 f7             	add    %r14,%rdi
+  802fc6:	48 89 da             	mov    %rbx,%rdx
+  802fc9:	48 b9 38 0f 80 00 00 	movabs $0x800f38,%rcx
+  802fd0:	00 00 00 
+  802fd3:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  802fd5:	41 01 dd             	add    %ebx,%r13d
+  802fd8:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  802fdc:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  802fdf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fe3:	49 39 c6             	cmp    %rax,%r14
+  802fe6:	73 37                	jae    80301f <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  802fe8:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  802fec:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802ff1:	44 39 e8             	cmp    %r13d,%eax
+  802ff4:	0f 8f fd fe ff ff    	jg     802ef7 <devfile_read+0x1b4>
+  802ffa:	41 03 44 24 10       	add    0x10(%r12),%eax
+  802fff:	44 39 e8             	cmp    %r13d,%eax
+  803002:	0f 8f 5d ff ff ff    	jg     802f65 <devfile_read+0x222>
+  803008:	e9 ea fe ff ff       	jmp    802ef7 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80300d:	48 98                	cltq
+  80300f:	4d 85 f6             	test   %r14,%r14
+  803012:	49 0f 45 c6          	cmovne %r14,%rax
+  803016:	e9 60 fe ff ff       	jmp    802e7b <devfile_read+0x138>
+    size_t i = 0;
+  80301b:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80301f:	4c 89 f0             	mov    %r14,%rax
+  803022:	e9 54 fe ff ff       	jmp    802e7b <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803027:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80302e:	e9 48 fe ff ff       	jmp    802e7b <devfile_read+0x138>
+
+0000000000803033 <open>:
+open(const char *path, int mode) {
+  803033:	55                   	push   %rbp
+  803034:	48 89 e5             	mov    %rsp,%rbp
+  803037:	41 55                	push   %r13
+  803039:	41 54                	push   %r12
+  80303b:	53                   	push   %rbx
+  80303c:	48 83 ec 18          	sub    $0x18,%rsp
+  803040:	49 89 fc             	mov    %rdi,%r12
+  803043:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803046:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+  803052:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803058:	0f 87 8a 00 00 00    	ja     8030e8 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80305e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803062:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  803069:	00 00 00 
+  80306c:	ff d0                	call   *%rax
+  80306e:	89 c3                	mov    %eax,%ebx
+  803070:	85 c0                	test   %eax,%eax
+  803072:	78 50                	js     8030c4 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803074:	4c 89 e6             	mov    %r12,%rsi
+  803077:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80307e:	00 00 00 
+  803081:	48 89 df             	mov    %rbx,%rdi
+  803084:	48 b8 43 0b 80 00 00 	movabs $0x800b43,%rax
+  80308b:	00 00 00 
+  80308e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803090:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803097:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80309b:	bf 01 00 00 00       	mov    $0x1,%edi
+  8030a0:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  8030a7:	00 00 00 
+  8030aa:	ff d0                	call   *%rax
+  8030ac:	89 c3                	mov    %eax,%ebx
+  8030ae:	85 c0                	test   %eax,%eax
+  8030b0:	78 1f                	js     8030d1 <open+0x9e>
+    return fd2num(fd);
+  8030b2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030b6:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  8030bd:	00 00 00 
+  8030c0:	ff d0                	call   *%rax
+  8030c2:	89 c3                	mov    %eax,%ebx
+}
+  8030c4:	89 d8                	mov    %ebx,%eax
+  8030c6:	48 83 c4 18          	add    $0x18,%rsp
+  8030ca:	5b                   	pop    %rbx
+  8030cb:	41 5c                	pop    %r12
+  8030cd:	41 5d                	pop    %r13
+  8030cf:	5d                   	pop    %rbp
+  8030d0:	c3                   	ret
+        fd_close(fd, 0);
+  8030d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8030d6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030da:	48 b8 02 1e 80 00 00 	movabs $0x801e02,%rax
+  8030e1:	00 00 00 
+  8030e4:	ff d0                	call   *%rax
+        return res;
+  8030e6:	eb dc                	jmp    8030c4 <open+0x91>
+        return -E_BAD_PATH;
+  8030e8:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030ed:	eb d5                	jmp    8030c4 <open+0x91>
+
+00000000008030ef <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8030ef:	55                   	push   %rbp
+  8030f0:	48 89 e5             	mov    %rsp,%rbp
+  8030f3:	41 57                	push   %r15
+  8030f5:	41 56                	push   %r14
+  8030f7:	41 55                	push   %r13
+  8030f9:	41 54                	push   %r12
+  8030fb:	53                   	push   %rbx
+  8030fc:	48 83 ec 18          	sub    $0x18,%rsp
+  803100:	41 89 f6             	mov    %esi,%r14d
+  803103:	49 89 d7             	mov    %rdx,%r15
+  803106:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803109:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80310d:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  803114:	00 00 00 
+  803117:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803119:	85 c0                	test   %eax,%eax
+  80311b:	0f 88 db 00 00 00    	js     8031fc <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803121:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803125:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80312c:	00 00 00 
+  80312f:	8b 00                	mov    (%rax),%eax
+  803131:	39 07                	cmp    %eax,(%rdi)
+  803133:	0f 85 db 00 00 00    	jne    803214 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803139:	45 85 f6             	test   %r14d,%r14d
+  80313c:	0f 88 db 00 00 00    	js     80321d <fmap+0x12e>
+  803142:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803149:	0f 85 d7 00 00 00    	jne    803226 <fmap+0x137>
+  80314f:	4c 89 fb             	mov    %r15,%rbx
+  803152:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803158:	0f 85 d1 00 00 00    	jne    80322f <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80315e:	48 b8 7f 28 80 00 00 	movabs $0x80287f,%rax
+  803165:	00 00 00 
+  803168:	ff d0                	call   *%rax
+  80316a:	85 c0                	test   %eax,%eax
+  80316c:	0f 88 8e 00 00 00    	js     803200 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803172:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803179:	00 00 00 
+    while (i < n) {
+  80317c:	4d 85 ed             	test   %r13,%r13
+  80317f:	0f 84 8a 00 00 00    	je     80320f <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803185:	4c 89 ea             	mov    %r13,%rdx
+  803188:	48 29 da             	sub    %rbx,%rdx
+  80318b:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803192:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803198:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80319c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031a0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8031a3:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8031a7:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8031ab:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8031b0:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8031b5:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8031b9:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8031bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031c2:	4c 89 e6             	mov    %r12,%rsi
+  8031c5:	bf 09 00 00 00       	mov    $0x9,%edi
+  8031ca:	48 b8 0d 26 80 00 00 	movabs $0x80260d,%rax
+  8031d1:	00 00 00 
+  8031d4:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8031d6:	85 c0                	test   %eax,%eax
+  8031d8:	78 2a                	js     803204 <fmap+0x115>
+        i += res;
+  8031da:	48 98                	cltq
+  8031dc:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8031df:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8031e3:	72 05                	jb     8031ea <fmap+0xfb>
+    while (i < n) {
+  8031e5:	4c 39 eb             	cmp    %r13,%rbx
+  8031e8:	72 9b                	jb     803185 <fmap+0x96>
+    }
+    return i;
+  8031ea:	48 89 d8             	mov    %rbx,%rax
+}
+  8031ed:	48 83 c4 18          	add    $0x18,%rsp
+  8031f1:	5b                   	pop    %rbx
+  8031f2:	41 5c                	pop    %r12
+  8031f4:	41 5d                	pop    %r13
+  8031f6:	41 5e                	pop    %r14
+  8031f8:	41 5f                	pop    %r15
+  8031fa:	5d                   	pop    %rbp
+  8031fb:	c3                   	ret
+    if (res < 0) return res;
+  8031fc:	48 98                	cltq
+  8031fe:	eb ed                	jmp    8031ed <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803200:	48 98                	cltq
+  803202:	eb e9                	jmp    8031ed <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803204:	48 98                	cltq
+  803206:	48 85 db             	test   %rbx,%rbx
+  803209:	48 0f 45 c3          	cmovne %rbx,%rax
+  80320d:	eb de                	jmp    8031ed <fmap+0xfe>
+    size_t i = 0;
+  80320f:	4c 89 eb             	mov    %r13,%rbx
+  803212:	eb d6                	jmp    8031ea <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803214:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80321b:	eb d0                	jmp    8031ed <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80321d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803224:	eb c7                	jmp    8031ed <fmap+0xfe>
+  803226:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80322d:	eb be                	jmp    8031ed <fmap+0xfe>
+  80322f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803236:	eb b5                	jmp    8031ed <fmap+0xfe>
+
+0000000000803238 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803238:	55                   	push   %rbp
+  803239:	48 89 e5             	mov    %rsp,%rbp
+  80323c:	41 56                	push   %r14
+  80323e:	41 55                	push   %r13
+  803240:	41 54                	push   %r12
+  803242:	53                   	push   %rbx
+  803243:	48 83 ec 10          	sub    $0x10,%rsp
+  803247:	89 fb                	mov    %edi,%ebx
+  803249:	41 89 f4             	mov    %esi,%r12d
+  80324c:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80324f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803253:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  80325a:	00 00 00 
+  80325d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80325f:	85 c0                	test   %eax,%eax
+  803261:	78 63                	js     8032c6 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803263:	45 85 e4             	test   %r12d,%r12d
+  803266:	0f 88 80 00 00 00    	js     8032ec <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80326c:	45 89 e6             	mov    %r12d,%r14d
+  80326f:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803276:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80327a:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  803281:	00 00 00 
+  803284:	ff d0                	call   *%rax
+  803286:	48 89 c2             	mov    %rax,%rdx
+  803289:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80328e:	44 89 f6             	mov    %r14d,%esi
+  803291:	89 df                	mov    %ebx,%edi
+  803293:	48 b8 ef 30 80 00 00 	movabs $0x8030ef,%rax
+  80329a:	00 00 00 
+  80329d:	ff d0                	call   *%rax
+  80329f:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8032a2:	45 29 f4             	sub    %r14d,%r12d
+  8032a5:	4d 63 f4             	movslq %r12d,%r14
+  8032a8:	49 39 c6             	cmp    %rax,%r14
+  8032ab:	7c 1d                	jl     8032ca <read_map+0x92>
+  8032ad:	48 85 c0             	test   %rax,%rax
+  8032b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b5:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8032b9:	48 83 c4 10          	add    $0x10,%rsp
+  8032bd:	5b                   	pop    %rbx
+  8032be:	41 5c                	pop    %r12
+  8032c0:	41 5d                	pop    %r13
+  8032c2:	41 5e                	pop    %r14
+  8032c4:	5d                   	pop    %rbp
+  8032c5:	c3                   	ret
+    if (res < 0) return res;
+  8032c6:	48 98                	cltq
+  8032c8:	eb ef                	jmp    8032b9 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8032ca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032ce:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  8032d5:	00 00 00 
+  8032d8:	ff d0                	call   *%rax
+  8032da:	4d 63 e4             	movslq %r12d,%r12
+  8032dd:	4c 01 e0             	add    %r12,%rax
+  8032e0:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8032e4:	48 89 d8             	mov    %rbx,%rax
+  8032e7:	4c 29 f0             	sub    %r14,%rax
+  8032ea:	eb cd                	jmp    8032b9 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8032ec:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032f3:	eb c4                	jmp    8032b9 <read_map+0x81>
+
+00000000008032f5 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8032f5:	55                   	push   %rbp
+  8032f6:	48 89 e5             	mov    %rsp,%rbp
+  8032f9:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032fd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803301:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  803308:	00 00 00 
+  80330b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80330d:	85 c0                	test   %eax,%eax
+  80330f:	78 4a                	js     80335b <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803311:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803315:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80331c:	00 00 00 
+  80331f:	8b 00                	mov    (%rax),%eax
+  803321:	39 07                	cmp    %eax,(%rdi)
+  803323:	75 38                	jne    80335d <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803325:	48 b8 7f 28 80 00 00 	movabs $0x80287f,%rax
+  80332c:	00 00 00 
+  80332f:	ff d0                	call   *%rax
+  803331:	85 c0                	test   %eax,%eax
+  803333:	78 26                	js     80335b <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803335:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803339:	8b 40 0c             	mov    0xc(%rax),%eax
+  80333c:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803343:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803345:	be 00 00 00 00       	mov    $0x0,%esi
+  80334a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80334f:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  803356:	00 00 00 
+  803359:	ff d0                	call   *%rax
+}
+  80335b:	c9                   	leave
+  80335c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80335d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803362:	eb f7                	jmp    80335b <fsync+0x66>
+
+0000000000803364 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803364:	55                   	push   %rbp
+  803365:	48 89 e5             	mov    %rsp,%rbp
+  803368:	41 57                	push   %r15
+  80336a:	41 56                	push   %r14
+  80336c:	41 55                	push   %r13
+  80336e:	41 54                	push   %r12
+  803370:	53                   	push   %rbx
+  803371:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803375:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80337c:	00 00 00 
+  80337f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803384:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80338a:	49 bd 47 1d 80 00 00 	movabs $0x801d47,%r13
+  803391:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803394:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  80339b:	00 00 00 
+  80339e:	eb 0c                	jmp    8033ac <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8033a0:	83 c3 01             	add    $0x1,%ebx
+  8033a3:	49 83 c4 28          	add    $0x28,%r12
+  8033a7:	83 fb 20             	cmp    $0x20,%ebx
+  8033aa:	74 33                	je     8033df <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033ac:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8033b1:	74 ed                	je     8033a0 <flushall+0x3c>
+  8033b3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033b7:	89 df                	mov    %ebx,%edi
+  8033b9:	41 ff d5             	call   *%r13
+  8033bc:	85 c0                	test   %eax,%eax
+  8033be:	78 e0                	js     8033a0 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8033c0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033c4:	41 8b 06             	mov    (%r14),%eax
+  8033c7:	39 07                	cmp    %eax,(%rdi)
+  8033c9:	75 d5                	jne    8033a0 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8033cb:	48 b8 7f 28 80 00 00 	movabs $0x80287f,%rax
+  8033d2:	00 00 00 
+  8033d5:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8033d7:	85 c0                	test   %eax,%eax
+  8033d9:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8033dd:	eb c1                	jmp    8033a0 <flushall+0x3c>
+    }
+    return res;
+}
+  8033df:	44 89 f8             	mov    %r15d,%eax
+  8033e2:	48 83 c4 18          	add    $0x18,%rsp
+  8033e6:	5b                   	pop    %rbx
+  8033e7:	41 5c                	pop    %r12
+  8033e9:	41 5d                	pop    %r13
+  8033eb:	41 5e                	pop    %r14
+  8033ed:	41 5f                	pop    %r15
+  8033ef:	5d                   	pop    %rbp
+  8033f0:	c3                   	ret
+
+00000000008033f1 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8033f1:	55                   	push   %rbp
+  8033f2:	48 89 e5             	mov    %rsp,%rbp
+  8033f5:	53                   	push   %rbx
+  8033f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8033fa:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8033fd:	40 0f b6 c6          	movzbl %sil,%eax
+  803401:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803408:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  80340a:	be 00 00 00 00       	mov    $0x0,%esi
+  80340f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803414:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  80341b:	00 00 00 
+  80341e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803420:	85 c0                	test   %eax,%eax
+  803422:	78 23                	js     803447 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803424:	ba 58 06 00 00       	mov    $0x658,%edx
+  803429:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803430:	00 00 00 
+  803433:	48 89 df             	mov    %rbx,%rdi
+  803436:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  80343d:	00 00 00 
+  803440:	ff d0                	call   *%rax
+    return 0;
+  803442:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803447:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80344b:	c9                   	leave
+  80344c:	c3                   	ret
+
+000000000080344d <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80344d:	55                   	push   %rbp
+  80344e:	48 89 e5             	mov    %rsp,%rbp
+  803451:	53                   	push   %rbx
+  803452:	48 83 ec 08          	sub    $0x8,%rsp
+  803456:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803459:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  803460:	00 00 00 
+  803463:	ff d0                	call   *%rax
+  803465:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80346b:	77 35                	ja     8034a2 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80346d:	48 89 de             	mov    %rbx,%rsi
+  803470:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803477:	00 00 00 
+  80347a:	48 b8 43 0b 80 00 00 	movabs $0x800b43,%rax
+  803481:	00 00 00 
+  803484:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803486:	be 00 00 00 00       	mov    $0x0,%esi
+  80348b:	bf 07 00 00 00       	mov    $0x7,%edi
+  803490:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  803497:	00 00 00 
+  80349a:	ff d0                	call   *%rax
+}
+  80349c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034a0:	c9                   	leave
+  8034a1:	c3                   	ret
+        return -E_BAD_PATH;
+  8034a2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034a7:	eb f3                	jmp    80349c <remove+0x4f>
+
+00000000008034a9 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8034a9:	55                   	push   %rbp
+  8034aa:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8034ad:	48 b8 64 33 80 00 00 	movabs $0x803364,%rax
+  8034b4:	00 00 00 
+  8034b7:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8034b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8034be:	bf 08 00 00 00       	mov    $0x8,%edi
+  8034c3:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  8034ca:	00 00 00 
+  8034cd:	ff d0                	call   *%rax
+}
+  8034cf:	5d                   	pop    %rbp
+  8034d0:	c3                   	ret
+
+00000000008034d1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8034d1:	55                   	push   %rbp
+  8034d2:	48 89 e5             	mov    %rsp,%rbp
+  8034d5:	41 54                	push   %r12
+  8034d7:	53                   	push   %rbx
+  8034d8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8034db:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  8034e2:	00 00 00 
+  8034e5:	ff d0                	call   *%rax
+  8034e7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8034ea:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  8034f1:	00 00 00 
+  8034f4:	48 89 df             	mov    %rbx,%rdi
+  8034f7:	48 b8 43 0b 80 00 00 	movabs $0x800b43,%rax
+  8034fe:	00 00 00 
+  803501:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803503:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803508:	41 2b 04 24          	sub    (%r12),%eax
+  80350c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803512:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803519:	00 00 00 
+    stat->st_dev = &devpipe;
+  80351c:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803523:	00 00 00 
+  803526:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80352d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803532:	5b                   	pop    %rbx
+  803533:	41 5c                	pop    %r12
+  803535:	5d                   	pop    %rbp
+  803536:	c3                   	ret
+
+0000000000803537 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803537:	55                   	push   %rbp
+  803538:	48 89 e5             	mov    %rsp,%rbp
+  80353b:	41 54                	push   %r12
+  80353d:	53                   	push   %rbx
+  80353e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803541:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803546:	48 89 fe             	mov    %rdi,%rsi
+  803549:	bf 00 00 00 00       	mov    $0x0,%edi
+  80354e:	49 bc 82 14 80 00 00 	movabs $0x801482,%r12
+  803555:	00 00 00 
+  803558:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80355b:	48 89 df             	mov    %rbx,%rdi
+  80355e:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  803565:	00 00 00 
+  803568:	ff d0                	call   *%rax
+  80356a:	48 89 c6             	mov    %rax,%rsi
+  80356d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803572:	bf 00 00 00 00       	mov    $0x0,%edi
+  803577:	41 ff d4             	call   *%r12
+}
+  80357a:	5b                   	pop    %rbx
+  80357b:	41 5c                	pop    %r12
+  80357d:	5d                   	pop    %rbp
+  80357e:	c3                   	ret
+
+000000000080357f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80357f:	55                   	push   %rbp
+  803580:	48 89 e5             	mov    %rsp,%rbp
+  803583:	41 57                	push   %r15
+  803585:	41 56                	push   %r14
+  803587:	41 55                	push   %r13
+  803589:	41 54                	push   %r12
+  80358b:	53                   	push   %rbx
+  80358c:	48 83 ec 18          	sub    $0x18,%rsp
+  803590:	49 89 fc             	mov    %rdi,%r12
+  803593:	49 89 f5             	mov    %rsi,%r13
+  803596:	49 89 d7             	mov    %rdx,%r15
+  803599:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80359d:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  8035a4:	00 00 00 
+  8035a7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8035a9:	4d 85 ff             	test   %r15,%r15
+  8035ac:	0f 84 af 00 00 00    	je     803661 <devpipe_write+0xe2>
+  8035b2:	48 89 c3             	mov    %rax,%rbx
+  8035b5:	4c 89 f8             	mov    %r15,%rax
+  8035b8:	4d 89 ef             	mov    %r13,%r15
+  8035bb:	4c 01 e8             	add    %r13,%rax
+  8035be:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035c2:	49 bd 77 12 80 00 00 	movabs $0x801277,%r13
+  8035c9:	00 00 00 
+            sys_yield();
+  8035cc:	49 be 14 12 80 00 00 	movabs $0x801214,%r14
+  8035d3:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8035d6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8035d9:	48 63 ce             	movslq %esi,%rcx
+  8035dc:	48 63 03             	movslq (%rbx),%rax
+  8035df:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8035e5:	48 39 c1             	cmp    %rax,%rcx
+  8035e8:	72 2e                	jb     803618 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035ea:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8035ef:	48 89 da             	mov    %rbx,%rdx
+  8035f2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035f7:	4c 89 e7             	mov    %r12,%rdi
+  8035fa:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8035fd:	85 c0                	test   %eax,%eax
+  8035ff:	74 66                	je     803667 <devpipe_write+0xe8>
+            sys_yield();
+  803601:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803604:	8b 73 04             	mov    0x4(%rbx),%esi
+  803607:	48 63 ce             	movslq %esi,%rcx
+  80360a:	48 63 03             	movslq (%rbx),%rax
+  80360d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803613:	48 39 c1             	cmp    %rax,%rcx
+  803616:	73 d2                	jae    8035ea <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803618:	41 0f b6 3f          	movzbl (%r15),%edi
+  80361c:	48 89 ca             	mov    %rcx,%rdx
+  80361f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803623:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80362a:	08 10 20 
+  80362d:	48 f7 e2             	mul    %rdx
+  803630:	48 c1 ea 06          	shr    $0x6,%rdx
+  803634:	48 89 d0             	mov    %rdx,%rax
+  803637:	48 c1 e0 09          	shl    $0x9,%rax
+  80363b:	48 29 d0             	sub    %rdx,%rax
+  80363e:	48 c1 e0 03          	shl    $0x3,%rax
+  803642:	48 29 c1             	sub    %rax,%rcx
+  803645:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80364a:	83 c6 01             	add    $0x1,%esi
+  80364d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803650:	49 83 c7 01          	add    $0x1,%r15
+  803654:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803658:	49 39 c7             	cmp    %rax,%r15
+  80365b:	0f 85 75 ff ff ff    	jne    8035d6 <devpipe_write+0x57>
+    return n;
+  803661:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803665:	eb 05                	jmp    80366c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803667:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80366c:	48 83 c4 18          	add    $0x18,%rsp
+  803670:	5b                   	pop    %rbx
+  803671:	41 5c                	pop    %r12
+  803673:	41 5d                	pop    %r13
+  803675:	41 5e                	pop    %r14
+  803677:	41 5f                	pop    %r15
+  803679:	5d                   	pop    %rbp
+  80367a:	c3                   	ret
+
+000000000080367b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80367b:	55                   	push   %rbp
+  80367c:	48 89 e5             	mov    %rsp,%rbp
+  80367f:	41 57                	push   %r15
+  803681:	41 56                	push   %r14
+  803683:	41 55                	push   %r13
+  803685:	41 54                	push   %r12
+  803687:	53                   	push   %rbx
+  803688:	48 83 ec 18          	sub    $0x18,%rsp
+  80368c:	49 89 fc             	mov    %rdi,%r12
+  80368f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803693:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803697:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  80369e:	00 00 00 
+  8036a1:	ff d0                	call   *%rax
+  8036a3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036a6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036ac:	49 bd 77 12 80 00 00 	movabs $0x801277,%r13
+  8036b3:	00 00 00 
+            sys_yield();
+  8036b6:	49 be 14 12 80 00 00 	movabs $0x801214,%r14
+  8036bd:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8036c0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8036c5:	74 7d                	je     803744 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036c7:	8b 03                	mov    (%rbx),%eax
+  8036c9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036cc:	75 26                	jne    8036f4 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8036ce:	4d 85 ff             	test   %r15,%r15
+  8036d1:	75 77                	jne    80374a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036d3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036d8:	48 89 da             	mov    %rbx,%rdx
+  8036db:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036e0:	4c 89 e7             	mov    %r12,%rdi
+  8036e3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8036e6:	85 c0                	test   %eax,%eax
+  8036e8:	74 72                	je     80375c <devpipe_read+0xe1>
+            sys_yield();
+  8036ea:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036ed:	8b 03                	mov    (%rbx),%eax
+  8036ef:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036f2:	74 df                	je     8036d3 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8036f4:	48 63 c8             	movslq %eax,%rcx
+  8036f7:	48 89 ca             	mov    %rcx,%rdx
+  8036fa:	48 c1 ea 03          	shr    $0x3,%rdx
+  8036fe:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803705:	08 10 20 
+  803708:	48 89 d0             	mov    %rdx,%rax
+  80370b:	48 f7 e6             	mul    %rsi
+  80370e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803712:	48 89 d0             	mov    %rdx,%rax
+  803715:	48 c1 e0 09          	shl    $0x9,%rax
+  803719:	48 29 d0             	sub    %rdx,%rax
+  80371c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803723:	00 
+  803724:	48 89 c8             	mov    %rcx,%rax
+  803727:	48 29 d0             	sub    %rdx,%rax
+  80372a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80372f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803733:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803737:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80373a:	49 83 c7 01          	add    $0x1,%r15
+  80373e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803742:	75 83                	jne    8036c7 <devpipe_read+0x4c>
+    return n;
+  803744:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803748:	eb 03                	jmp    80374d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80374a:	4c 89 f8             	mov    %r15,%rax
+}
+  80374d:	48 83 c4 18          	add    $0x18,%rsp
+  803751:	5b                   	pop    %rbx
+  803752:	41 5c                	pop    %r12
+  803754:	41 5d                	pop    %r13
+  803756:	41 5e                	pop    %r14
+  803758:	41 5f                	pop    %r15
+  80375a:	5d                   	pop    %rbp
+  80375b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80375c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803761:	eb ea                	jmp    80374d <devpipe_read+0xd2>
+
+0000000000803763 <pipe>:
+pipe(int pfd[2]) {
+  803763:	55                   	push   %rbp
+  803764:	48 89 e5             	mov    %rsp,%rbp
+  803767:	41 55                	push   %r13
+  803769:	41 54                	push   %r12
+  80376b:	53                   	push   %rbx
+  80376c:	48 83 ec 18          	sub    $0x18,%rsp
+  803770:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803773:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803777:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  80377e:	00 00 00 
+  803781:	ff d0                	call   *%rax
+  803783:	89 c3                	mov    %eax,%ebx
+  803785:	85 c0                	test   %eax,%eax
+  803787:	0f 88 a0 01 00 00    	js     80392d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80378d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803792:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803797:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80379b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037a0:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  8037a7:	00 00 00 
+  8037aa:	ff d0                	call   *%rax
+  8037ac:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8037ae:	85 c0                	test   %eax,%eax
+  8037b0:	0f 88 77 01 00 00    	js     80392d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037b6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8037ba:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  8037c1:	00 00 00 
+  8037c4:	ff d0                	call   *%rax
+  8037c6:	89 c3                	mov    %eax,%ebx
+  8037c8:	85 c0                	test   %eax,%eax
+  8037ca:	0f 88 43 01 00 00    	js     803913 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8037d0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037da:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8037de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037e3:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  8037ea:	00 00 00 
+  8037ed:	ff d0                	call   *%rax
+  8037ef:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037f1:	85 c0                	test   %eax,%eax
+  8037f3:	0f 88 1a 01 00 00    	js     803913 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8037f9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8037fd:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  803804:	00 00 00 
+  803807:	ff d0                	call   *%rax
+  803809:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80380c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803811:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803816:	48 89 c6             	mov    %rax,%rsi
+  803819:	bf 00 00 00 00       	mov    $0x0,%edi
+  80381e:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  803825:	00 00 00 
+  803828:	ff d0                	call   *%rax
+  80382a:	89 c3                	mov    %eax,%ebx
+  80382c:	85 c0                	test   %eax,%eax
+  80382e:	0f 88 c5 00 00 00    	js     8038f9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803834:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803838:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  80383f:	00 00 00 
+  803842:	ff d0                	call   *%rax
+  803844:	48 89 c1             	mov    %rax,%rcx
+  803847:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80384d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803853:	ba 00 00 00 00       	mov    $0x0,%edx
+  803858:	4c 89 ee             	mov    %r13,%rsi
+  80385b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803860:	48 b8 0a 13 80 00 00 	movabs $0x80130a,%rax
+  803867:	00 00 00 
+  80386a:	ff d0                	call   *%rax
+  80386c:	89 c3                	mov    %eax,%ebx
+  80386e:	85 c0                	test   %eax,%eax
+  803870:	78 6e                	js     8038e0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803872:	be 00 10 00 00       	mov    $0x1000,%esi
+  803877:	4c 89 ef             	mov    %r13,%rdi
+  80387a:	48 b8 45 12 80 00 00 	movabs $0x801245,%rax
+  803881:	00 00 00 
+  803884:	ff d0                	call   *%rax
+  803886:	83 f8 02             	cmp    $0x2,%eax
+  803889:	0f 85 ab 00 00 00    	jne    80393a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80388f:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803896:	00 00 
+  803898:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80389c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80389e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038a2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8038a9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8038ad:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8038af:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038b3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8038ba:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8038be:	48 bb b9 1c 80 00 00 	movabs $0x801cb9,%rbx
+  8038c5:	00 00 00 
+  8038c8:	ff d3                	call   *%rbx
+  8038ca:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8038ce:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8038d2:	ff d3                	call   *%rbx
+  8038d4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8038d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038de:	eb 4d                	jmp    80392d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8038e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038e5:	4c 89 ee             	mov    %r13,%rsi
+  8038e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ed:	48 b8 82 14 80 00 00 	movabs $0x801482,%rax
+  8038f4:	00 00 00 
+  8038f7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8038f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038fe:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803902:	bf 00 00 00 00       	mov    $0x0,%edi
+  803907:	48 b8 82 14 80 00 00 	movabs $0x801482,%rax
+  80390e:	00 00 00 
+  803911:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803913:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803918:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80391c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803921:	48 b8 82 14 80 00 00 	movabs $0x801482,%rax
+  803928:	00 00 00 
+  80392b:	ff d0                	call   *%rax
+}
+  80392d:	89 d8                	mov    %ebx,%eax
+  80392f:	48 83 c4 18          	add    $0x18,%rsp
+  803933:	5b                   	pop    %rbx
+  803934:	41 5c                	pop    %r12
+  803936:	41 5d                	pop    %r13
+  803938:	5d                   	pop    %rbp
+  803939:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80393a:	48 b9 f0 56 80 00 00 	movabs $0x8056f0,%rcx
+  803941:	00 00 00 
+  803944:	48 ba c7 56 80 00 00 	movabs $0x8056c7,%rdx
+  80394b:	00 00 00 
+  80394e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803953:	48 bf dc 56 80 00 00 	movabs $0x8056dc,%rdi
+  80395a:	00 00 00 
+  80395d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803962:	49 b8 42 3f 80 00 00 	movabs $0x803f42,%r8
+  803969:	00 00 00 
+  80396c:	41 ff d0             	call   *%r8
+
+000000000080396f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80396f:	55                   	push   %rbp
+  803970:	48 89 e5             	mov    %rsp,%rbp
+  803973:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803977:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80397b:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  803982:	00 00 00 
+  803985:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803987:	85 c0                	test   %eax,%eax
+  803989:	78 35                	js     8039c0 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80398b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80398f:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  803996:	00 00 00 
+  803999:	ff d0                	call   *%rax
+  80399b:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80399e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039a3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039a8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039ac:	48 b8 77 12 80 00 00 	movabs $0x801277,%rax
+  8039b3:	00 00 00 
+  8039b6:	ff d0                	call   *%rax
+  8039b8:	85 c0                	test   %eax,%eax
+  8039ba:	0f 94 c0             	sete   %al
+  8039bd:	0f b6 c0             	movzbl %al,%eax
+}
+  8039c0:	c9                   	leave
+  8039c1:	c3                   	ret
+
+00000000008039c2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8039c2:	48 89 f8             	mov    %rdi,%rax
+  8039c5:	48 c1 e8 27          	shr    $0x27,%rax
+  8039c9:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8039d0:	7f 00 00 
+  8039d3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039d7:	f6 c2 01             	test   $0x1,%dl
+  8039da:	74 6d                	je     803a49 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8039dc:	48 89 f8             	mov    %rdi,%rax
+  8039df:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039e3:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039ea:	7f 00 00 
+  8039ed:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039f1:	f6 c2 01             	test   $0x1,%dl
+  8039f4:	74 62                	je     803a58 <get_uvpt_entry+0x96>
+  8039f6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039fd:	7f 00 00 
+  803a00:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a04:	f6 c2 80             	test   $0x80,%dl
+  803a07:	75 4f                	jne    803a58 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a09:	48 89 f8             	mov    %rdi,%rax
+  803a0c:	48 c1 e8 15          	shr    $0x15,%rax
+  803a10:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a17:	7f 00 00 
+  803a1a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a1e:	f6 c2 01             	test   $0x1,%dl
+  803a21:	74 44                	je     803a67 <get_uvpt_entry+0xa5>
+  803a23:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a2a:	7f 00 00 
+  803a2d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a31:	f6 c2 80             	test   $0x80,%dl
+  803a34:	75 31                	jne    803a67 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803a36:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803a3a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a41:	7f 00 00 
+  803a44:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803a48:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a49:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803a50:	7f 00 00 
+  803a53:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a57:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a58:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a5f:	7f 00 00 
+  803a62:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a66:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a67:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a6e:	7f 00 00 
+  803a71:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a75:	c3                   	ret
+
+0000000000803a76 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803a76:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a79:	48 89 f9             	mov    %rdi,%rcx
+  803a7c:	48 c1 e9 27          	shr    $0x27,%rcx
+  803a80:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803a87:	7f 00 00 
+  803a8a:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803a8e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a95:	f6 c1 01             	test   $0x1,%cl
+  803a98:	0f 84 b2 00 00 00    	je     803b50 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803a9e:	48 89 f9             	mov    %rdi,%rcx
+  803aa1:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803aa5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803aac:	7f 00 00 
+  803aaf:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ab3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803aba:	40 f6 c6 01          	test   $0x1,%sil
+  803abe:	0f 84 8c 00 00 00    	je     803b50 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803ac4:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803acb:	7f 00 00 
+  803ace:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ad2:	a8 80                	test   $0x80,%al
+  803ad4:	75 7b                	jne    803b51 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ad6:	48 89 f9             	mov    %rdi,%rcx
+  803ad9:	48 c1 e9 15          	shr    $0x15,%rcx
+  803add:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ae4:	7f 00 00 
+  803ae7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803aeb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803af2:	40 f6 c6 01          	test   $0x1,%sil
+  803af6:	74 58                	je     803b50 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803af8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803aff:	7f 00 00 
+  803b02:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b06:	a8 80                	test   $0x80,%al
+  803b08:	75 6c                	jne    803b76 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b0a:	48 89 f9             	mov    %rdi,%rcx
+  803b0d:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803b11:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b18:	7f 00 00 
+  803b1b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b1f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b26:	40 f6 c6 01          	test   $0x1,%sil
+  803b2a:	74 24                	je     803b50 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803b2c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b33:	7f 00 00 
+  803b36:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b3a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b41:	ff ff 7f 
+  803b44:	48 21 c8             	and    %rcx,%rax
+  803b47:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803b4d:	48 09 d0             	or     %rdx,%rax
+}
+  803b50:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803b51:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b58:	7f 00 00 
+  803b5b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b5f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b66:	ff ff 7f 
+  803b69:	48 21 c8             	and    %rcx,%rax
+  803b6c:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803b72:	48 01 d0             	add    %rdx,%rax
+  803b75:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803b76:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b7d:	7f 00 00 
+  803b80:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b84:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b8b:	ff ff 7f 
+  803b8e:	48 21 c8             	and    %rcx,%rax
+  803b91:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803b97:	48 01 d0             	add    %rdx,%rax
+  803b9a:	c3                   	ret
+
+0000000000803b9b <get_prot>:
+
+int
+get_prot(void *va) {
+  803b9b:	55                   	push   %rbp
+  803b9c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803b9f:	48 b8 c2 39 80 00 00 	movabs $0x8039c2,%rax
+  803ba6:	00 00 00 
+  803ba9:	ff d0                	call   *%rax
+  803bab:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803bae:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803bb3:	89 c1                	mov    %eax,%ecx
+  803bb5:	83 c9 04             	or     $0x4,%ecx
+  803bb8:	f6 c2 01             	test   $0x1,%dl
+  803bbb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803bbe:	89 c1                	mov    %eax,%ecx
+  803bc0:	83 c9 02             	or     $0x2,%ecx
+  803bc3:	f6 c2 02             	test   $0x2,%dl
+  803bc6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803bc9:	89 c1                	mov    %eax,%ecx
+  803bcb:	83 c9 01             	or     $0x1,%ecx
+  803bce:	48 85 d2             	test   %rdx,%rdx
+  803bd1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803bd4:	89 c1                	mov    %eax,%ecx
+  803bd6:	83 c9 40             	or     $0x40,%ecx
+  803bd9:	f6 c6 04             	test   $0x4,%dh
+  803bdc:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803bdf:	5d                   	pop    %rbp
+  803be0:	c3                   	ret
+
+0000000000803be1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803be1:	55                   	push   %rbp
+  803be2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803be5:	48 b8 c2 39 80 00 00 	movabs $0x8039c2,%rax
+  803bec:	00 00 00 
+  803bef:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803bf1:	48 c1 e8 06          	shr    $0x6,%rax
+  803bf5:	83 e0 01             	and    $0x1,%eax
+}
+  803bf8:	5d                   	pop    %rbp
+  803bf9:	c3                   	ret
+
+0000000000803bfa <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803bfa:	55                   	push   %rbp
+  803bfb:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803bfe:	48 b8 c2 39 80 00 00 	movabs $0x8039c2,%rax
+  803c05:	00 00 00 
+  803c08:	ff d0                	call   *%rax
+  803c0a:	83 e0 01             	and    $0x1,%eax
+}
+  803c0d:	5d                   	pop    %rbp
+  803c0e:	c3                   	ret
+
+0000000000803c0f <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803c0f:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803c16:	7f 00 00 
+  803c19:	a8 01                	test   $0x1,%al
+  803c1b:	75 06                	jne    803c23 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c22:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803c23:	55                   	push   %rbp
+  803c24:	48 89 e5             	mov    %rsp,%rbp
+  803c27:	41 57                	push   %r15
+  803c29:	41 56                	push   %r14
+  803c2b:	41 55                	push   %r13
+  803c2d:	41 54                	push   %r12
+  803c2f:	53                   	push   %rbx
+  803c30:	48 83 ec 18          	sub    $0x18,%rsp
+  803c34:	49 89 fe             	mov    %rdi,%r14
+  803c37:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803c3a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803c41:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c42:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803c49:	7f 00 00 
+  803c4c:	e9 81 00 00 00       	jmp    803cd2 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803c51:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803c58:	49 39 dd             	cmp    %rbx,%r13
+  803c5b:	74 2b                	je     803c88 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c5d:	48 89 d8             	mov    %rbx,%rax
+  803c60:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c64:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803c68:	f6 c2 01             	test   $0x1,%dl
+  803c6b:	74 e4                	je     803c51 <foreach_shared_region+0x42>
+  803c6d:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803c71:	f6 c4 04             	test   $0x4,%ah
+  803c74:	74 db                	je     803c51 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803c76:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803c7d:	4c 89 fa             	mov    %r15,%rdx
+  803c80:	48 89 df             	mov    %rbx,%rdi
+  803c83:	41 ff d6             	call   *%r14
+  803c86:	eb c9                	jmp    803c51 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803c88:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803c8f:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803c93:	74 22                	je     803cb7 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803c95:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803c9c:	48 89 d8             	mov    %rbx,%rax
+  803c9f:	48 c1 e8 15          	shr    $0x15,%rax
+  803ca3:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803caa:	7f 00 00 
+  803cad:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803cb1:	a8 01                	test   $0x1,%al
+  803cb3:	74 d3                	je     803c88 <foreach_shared_region+0x79>
+  803cb5:	eb a6                	jmp    803c5d <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803cb7:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803cbe:	40 
+  803cbf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803cc3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cca:	00 00 00 
+  803ccd:	48 39 c1             	cmp    %rax,%rcx
+  803cd0:	74 31                	je     803d03 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803cd2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cd6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803cda:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803ce1:	7f 00 00 
+  803ce4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803ce8:	a8 01                	test   $0x1,%al
+  803cea:	74 cb                	je     803cb7 <foreach_shared_region+0xa8>
+  803cec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cf0:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803cf7:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803cfd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d01:	eb 92                	jmp    803c95 <foreach_shared_region+0x86>
+}
+  803d03:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d08:	48 83 c4 18          	add    $0x18,%rsp
+  803d0c:	5b                   	pop    %rbx
+  803d0d:	41 5c                	pop    %r12
+  803d0f:	41 5d                	pop    %r13
+  803d11:	41 5e                	pop    %r14
+  803d13:	41 5f                	pop    %r15
+  803d15:	5d                   	pop    %rbp
+  803d16:	c3                   	ret
+
+0000000000803d17 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d1c:	c3                   	ret
+
+0000000000803d1d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803d1d:	55                   	push   %rbp
+  803d1e:	48 89 e5             	mov    %rsp,%rbp
+  803d21:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803d24:	48 be 14 57 80 00 00 	movabs $0x805714,%rsi
+  803d2b:	00 00 00 
+  803d2e:	48 b8 43 0b 80 00 00 	movabs $0x800b43,%rax
+  803d35:	00 00 00 
+  803d38:	ff d0                	call   *%rax
+    return 0;
+}
+  803d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3f:	5d                   	pop    %rbp
+  803d40:	c3                   	ret
+
+0000000000803d41 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d41:	55                   	push   %rbp
+  803d42:	48 89 e5             	mov    %rsp,%rbp
+  803d45:	41 57                	push   %r15
+  803d47:	41 56                	push   %r14
+  803d49:	41 55                	push   %r13
+  803d4b:	41 54                	push   %r12
+  803d4d:	53                   	push   %rbx
+  803d4e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803d55:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803d5c:	48 85 d2             	test   %rdx,%rdx
+  803d5f:	74 7a                	je     803ddb <devcons_write+0x9a>
+  803d61:	49 89 d6             	mov    %rdx,%r14
+  803d64:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803d6a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803d6f:	49 bf d1 0e 80 00 00 	movabs $0x800ed1,%r15
+  803d76:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803d79:	4c 89 f3             	mov    %r14,%rbx
+  803d7c:	48 29 f3             	sub    %rsi,%rbx
+  803d7f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803d84:	48 39 c3             	cmp    %rax,%rbx
+  803d87:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803d8b:	4c 63 eb             	movslq %ebx,%r13
+  803d8e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803d95:	48 01 c6             	add    %rax,%rsi
+  803d98:	4c 89 ea             	mov    %r13,%rdx
+  803d9b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803da2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803da5:	4c 89 ee             	mov    %r13,%rsi
+  803da8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803daf:	48 b8 1a 11 80 00 00 	movabs $0x80111a,%rax
+  803db6:	00 00 00 
+  803db9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803dbb:	41 01 dc             	add    %ebx,%r12d
+  803dbe:	49 63 f4             	movslq %r12d,%rsi
+  803dc1:	4c 39 f6             	cmp    %r14,%rsi
+  803dc4:	72 b3                	jb     803d79 <devcons_write+0x38>
+    return res;
+  803dc6:	49 63 c4             	movslq %r12d,%rax
+}
+  803dc9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803dd0:	5b                   	pop    %rbx
+  803dd1:	41 5c                	pop    %r12
+  803dd3:	41 5d                	pop    %r13
+  803dd5:	41 5e                	pop    %r14
+  803dd7:	41 5f                	pop    %r15
+  803dd9:	5d                   	pop    %rbp
+  803dda:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803ddb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803de1:	eb e3                	jmp    803dc6 <devcons_write+0x85>
+
+0000000000803de3 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803de3:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803de6:	ba 00 00 00 00       	mov    $0x0,%edx
+  803deb:	48 85 c0             	test   %rax,%rax
+  803dee:	74 55                	je     803e45 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803df0:	55                   	push   %rbp
+  803df1:	48 89 e5             	mov    %rsp,%rbp
+  803df4:	41 55                	push   %r13
+  803df6:	41 54                	push   %r12
+  803df8:	53                   	push   %rbx
+  803df9:	48 83 ec 08          	sub    $0x8,%rsp
+  803dfd:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803e00:	48 bb 47 11 80 00 00 	movabs $0x801147,%rbx
+  803e07:	00 00 00 
+  803e0a:	49 bc 14 12 80 00 00 	movabs $0x801214,%r12
+  803e11:	00 00 00 
+  803e14:	eb 03                	jmp    803e19 <devcons_read+0x36>
+  803e16:	41 ff d4             	call   *%r12
+  803e19:	ff d3                	call   *%rbx
+  803e1b:	85 c0                	test   %eax,%eax
+  803e1d:	74 f7                	je     803e16 <devcons_read+0x33>
+    if (c < 0) return c;
+  803e1f:	48 63 d0             	movslq %eax,%rdx
+  803e22:	78 13                	js     803e37 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803e24:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e29:	83 f8 04             	cmp    $0x4,%eax
+  803e2c:	74 09                	je     803e37 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803e2e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803e32:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803e37:	48 89 d0             	mov    %rdx,%rax
+  803e3a:	48 83 c4 08          	add    $0x8,%rsp
+  803e3e:	5b                   	pop    %rbx
+  803e3f:	41 5c                	pop    %r12
+  803e41:	41 5d                	pop    %r13
+  803e43:	5d                   	pop    %rbp
+  803e44:	c3                   	ret
+  803e45:	48 89 d0             	mov    %rdx,%rax
+  803e48:	c3                   	ret
+
+0000000000803e49 <cputchar>:
+cputchar(int ch) {
+  803e49:	55                   	push   %rbp
+  803e4a:	48 89 e5             	mov    %rsp,%rbp
+  803e4d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803e51:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803e55:	be 01 00 00 00       	mov    $0x1,%esi
+  803e5a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803e5e:	48 b8 1a 11 80 00 00 	movabs $0x80111a,%rax
+  803e65:	00 00 00 
+  803e68:	ff d0                	call   *%rax
+}
+  803e6a:	c9                   	leave
+  803e6b:	c3                   	ret
+
+0000000000803e6c <getchar>:
+getchar(void) {
+  803e6c:	55                   	push   %rbp
+  803e6d:	48 89 e5             	mov    %rsp,%rbp
+  803e70:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803e74:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e79:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803e7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e82:	48 b8 2a 20 80 00 00 	movabs $0x80202a,%rax
+  803e89:	00 00 00 
+  803e8c:	ff d0                	call   *%rax
+  803e8e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803e90:	85 c0                	test   %eax,%eax
+  803e92:	78 06                	js     803e9a <getchar+0x2e>
+  803e94:	74 08                	je     803e9e <getchar+0x32>
+  803e96:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803e9a:	89 d0                	mov    %edx,%eax
+  803e9c:	c9                   	leave
+  803e9d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803e9e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803ea3:	eb f5                	jmp    803e9a <getchar+0x2e>
+
+0000000000803ea5 <iscons>:
+iscons(int fdnum) {
+  803ea5:	55                   	push   %rbp
+  803ea6:	48 89 e5             	mov    %rsp,%rbp
+  803ea9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ead:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803eb1:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  803eb8:	00 00 00 
+  803ebb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ebd:	85 c0                	test   %eax,%eax
+  803ebf:	78 18                	js     803ed9 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803ec1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ec5:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803ecc:	00 00 00 
+  803ecf:	8b 00                	mov    (%rax),%eax
+  803ed1:	39 02                	cmp    %eax,(%rdx)
+  803ed3:	0f 94 c0             	sete   %al
+  803ed6:	0f b6 c0             	movzbl %al,%eax
+}
+  803ed9:	c9                   	leave
+  803eda:	c3                   	ret
+
+0000000000803edb <opencons>:
+opencons(void) {
+  803edb:	55                   	push   %rbp
+  803edc:	48 89 e5             	mov    %rsp,%rbp
+  803edf:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803ee3:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803ee7:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  803eee:	00 00 00 
+  803ef1:	ff d0                	call   *%rax
+  803ef3:	85 c0                	test   %eax,%eax
+  803ef5:	78 49                	js     803f40 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803ef7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803efc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f01:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803f05:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f0a:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  803f11:	00 00 00 
+  803f14:	ff d0                	call   *%rax
+  803f16:	85 c0                	test   %eax,%eax
+  803f18:	78 26                	js     803f40 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803f1a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f1e:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803f25:	00 00 
+  803f27:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803f29:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f2d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803f34:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  803f3b:	00 00 00 
+  803f3e:	ff d0                	call   *%rax
+}
+  803f40:	c9                   	leave
+  803f41:	c3                   	ret
+
+0000000000803f42 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803f42:	55                   	push   %rbp
+  803f43:	48 89 e5             	mov    %rsp,%rbp
+  803f46:	41 56                	push   %r14
+  803f48:	41 55                	push   %r13
+  803f4a:	41 54                	push   %r12
+  803f4c:	53                   	push   %rbx
+  803f4d:	48 83 ec 50          	sub    $0x50,%rsp
+  803f51:	49 89 fc             	mov    %rdi,%r12
+  803f54:	41 89 f5             	mov    %esi,%r13d
+  803f57:	48 89 d3             	mov    %rdx,%rbx
+  803f5a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f5e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803f62:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803f66:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803f6d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f71:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803f75:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803f79:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803f7d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803f84:	00 00 00 
+  803f87:	4c 8b 30             	mov    (%rax),%r14
+  803f8a:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  803f91:	00 00 00 
+  803f94:	ff d0                	call   *%rax
+  803f96:	89 c6                	mov    %eax,%esi
+  803f98:	45 89 e8             	mov    %r13d,%r8d
+  803f9b:	4c 89 e1             	mov    %r12,%rcx
+  803f9e:	4c 89 f2             	mov    %r14,%rdx
+  803fa1:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  803fa8:	00 00 00 
+  803fab:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb0:	49 bc cb 01 80 00 00 	movabs $0x8001cb,%r12
+  803fb7:	00 00 00 
+  803fba:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803fbd:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803fc1:	48 89 df             	mov    %rbx,%rdi
+  803fc4:	48 b8 67 01 80 00 00 	movabs $0x800167,%rax
+  803fcb:	00 00 00 
+  803fce:	ff d0                	call   *%rax
+    cprintf("\n");
+  803fd0:	48 bf 63 56 80 00 00 	movabs $0x805663,%rdi
+  803fd7:	00 00 00 
+  803fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fdf:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803fe2:	cc                   	int3
+  803fe3:	eb fd                	jmp    803fe2 <_panic+0xa0>
+
+0000000000803fe5 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fe5:	55                   	push   %rbp
+  803fe6:	48 89 e5             	mov    %rsp,%rbp
+  803fe9:	41 55                	push   %r13
+  803feb:	41 54                	push   %r12
+  803fed:	53                   	push   %rbx
+  803fee:	48 83 ec 08          	sub    $0x8,%rsp
+  803ff2:	49 89 fc             	mov    %rdi,%r12
+  803ff5:	48 89 f7             	mov    %rsi,%rdi
+  803ff8:	48 89 d3             	mov    %rdx,%rbx
+  803ffb:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803ffe:	48 85 f6             	test   %rsi,%rsi
+  804001:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804008:	00 00 00 
+  80400b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80400f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804014:	48 85 d2             	test   %rdx,%rdx
+  804017:	74 03                	je     80401c <ipc_recv+0x37>
+  804019:	48 8b 32             	mov    (%rdx),%rsi
+  80401c:	48 b8 50 16 80 00 00 	movabs $0x801650,%rax
+  804023:	00 00 00 
+  804026:	ff d0                	call   *%rax
+    if (errno) {
+  804028:	85 c0                	test   %eax,%eax
+  80402a:	74 1c                	je     804048 <ipc_recv+0x63>
+        if (from_env_store)
+  80402c:	4d 85 e4             	test   %r12,%r12
+  80402f:	74 08                	je     804039 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804031:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804038:	00 
+
+        if (perm_store)
+  804039:	4d 85 ed             	test   %r13,%r13
+  80403c:	74 74                	je     8040b2 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80403e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804045:	00 
+  804046:	eb 6a                	jmp    8040b2 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804048:	4d 85 e4             	test   %r12,%r12
+  80404b:	74 14                	je     804061 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80404d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804054:	00 00 00 
+  804057:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80405d:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804061:	48 85 db             	test   %rbx,%rbx
+  804064:	74 23                	je     804089 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804066:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80406d:	00 00 00 
+  804070:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804076:	ba 00 00 00 00       	mov    $0x0,%edx
+  80407b:	85 c9                	test   %ecx,%ecx
+  80407d:	74 07                	je     804086 <ipc_recv+0xa1>
+  80407f:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804086:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804089:	4d 85 ed             	test   %r13,%r13
+  80408c:	74 14                	je     8040a2 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80408e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804095:	00 00 00 
+  804098:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80409e:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8040a2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040a9:	00 00 00 
+  8040ac:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040b2:	48 83 c4 08          	add    $0x8,%rsp
+  8040b6:	5b                   	pop    %rbx
+  8040b7:	41 5c                	pop    %r12
+  8040b9:	41 5d                	pop    %r13
+  8040bb:	5d                   	pop    %rbp
+  8040bc:	c3                   	ret
+
+00000000008040bd <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040bd:	55                   	push   %rbp
+  8040be:	48 89 e5             	mov    %rsp,%rbp
+  8040c1:	41 55                	push   %r13
+  8040c3:	41 54                	push   %r12
+  8040c5:	53                   	push   %rbx
+  8040c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8040ca:	49 89 fc             	mov    %rdi,%r12
+  8040cd:	48 89 f7             	mov    %rsi,%rdi
+  8040d0:	48 89 d3             	mov    %rdx,%rbx
+  8040d3:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040d6:	48 85 f6             	test   %rsi,%rsi
+  8040d9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040e0:	00 00 00 
+  8040e3:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040e7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040ec:	48 85 d2             	test   %rdx,%rdx
+  8040ef:	74 03                	je     8040f4 <ipc_try_recv+0x37>
+  8040f1:	48 8b 32             	mov    (%rdx),%rsi
+  8040f4:	48 b8 b9 16 80 00 00 	movabs $0x8016b9,%rax
+  8040fb:	00 00 00 
+  8040fe:	ff d0                	call   *%rax
+    if (errno) {
+  804100:	85 c0                	test   %eax,%eax
+  804102:	75 75                	jne    804179 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804104:	4d 85 e4             	test   %r12,%r12
+  804107:	74 14                	je     80411d <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804109:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804110:	00 00 00 
+  804113:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804119:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80411d:	48 85 db             	test   %rbx,%rbx
+  804120:	74 23                	je     804145 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804122:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804129:	00 00 00 
+  80412c:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804132:	ba 00 00 00 00       	mov    $0x0,%edx
+  804137:	85 c9                	test   %ecx,%ecx
+  804139:	74 07                	je     804142 <ipc_try_recv+0x85>
+  80413b:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804142:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804145:	4d 85 ed             	test   %r13,%r13
+  804148:	74 14                	je     80415e <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80414a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804151:	00 00 00 
+  804154:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80415a:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80415e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804165:	00 00 00 
+  804168:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80416e:	48 83 c4 08          	add    $0x8,%rsp
+  804172:	5b                   	pop    %rbx
+  804173:	41 5c                	pop    %r12
+  804175:	41 5d                	pop    %r13
+  804177:	5d                   	pop    %rbp
+  804178:	c3                   	ret
+        if (from_env_store)
+  804179:	4d 85 e4             	test   %r12,%r12
+  80417c:	74 08                	je     804186 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80417e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804185:	00 
+        if (perm_store)
+  804186:	4d 85 ed             	test   %r13,%r13
+  804189:	74 e3                	je     80416e <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80418b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804192:	00 
+  804193:	eb d9                	jmp    80416e <ipc_try_recv+0xb1>
+
+0000000000804195 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804195:	55                   	push   %rbp
+  804196:	48 89 e5             	mov    %rsp,%rbp
+  804199:	41 57                	push   %r15
+  80419b:	41 56                	push   %r14
+  80419d:	41 55                	push   %r13
+  80419f:	41 54                	push   %r12
+  8041a1:	53                   	push   %rbx
+  8041a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8041a6:	41 89 fd             	mov    %edi,%r13d
+  8041a9:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8041ac:	48 89 d3             	mov    %rdx,%rbx
+  8041af:	49 89 cc             	mov    %rcx,%r12
+  8041b2:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041b6:	48 85 d2             	test   %rdx,%rdx
+  8041b9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041c0:	00 00 00 
+  8041c3:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041c7:	49 be 24 16 80 00 00 	movabs $0x801624,%r14
+  8041ce:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041d1:	49 bf 14 12 80 00 00 	movabs $0x801214,%r15
+  8041d8:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041db:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041de:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041e2:	4c 89 e1             	mov    %r12,%rcx
+  8041e5:	48 89 da             	mov    %rbx,%rdx
+  8041e8:	44 89 ef             	mov    %r13d,%edi
+  8041eb:	41 ff d6             	call   *%r14
+  8041ee:	85 c0                	test   %eax,%eax
+  8041f0:	74 37                	je     804229 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041f2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041f5:	75 05                	jne    8041fc <ipc_send+0x67>
+        sys_yield();
+  8041f7:	41 ff d7             	call   *%r15
+  8041fa:	eb df                	jmp    8041db <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041fc:	89 c1                	mov    %eax,%ecx
+  8041fe:	48 ba 43 57 80 00 00 	movabs $0x805743,%rdx
+  804205:	00 00 00 
+  804208:	be 65 00 00 00       	mov    $0x65,%esi
+  80420d:	48 bf 5e 57 80 00 00 	movabs $0x80575e,%rdi
+  804214:	00 00 00 
+  804217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80421c:	49 b8 42 3f 80 00 00 	movabs $0x803f42,%r8
+  804223:	00 00 00 
+  804226:	41 ff d0             	call   *%r8
+    }
+}
+  804229:	48 83 c4 18          	add    $0x18,%rsp
+  80422d:	5b                   	pop    %rbx
+  80422e:	41 5c                	pop    %r12
+  804230:	41 5d                	pop    %r13
+  804232:	41 5e                	pop    %r14
+  804234:	41 5f                	pop    %r15
+  804236:	5d                   	pop    %rbp
+  804237:	c3                   	ret
+
+0000000000804238 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804238:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80423d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804244:	00 00 00 
+  804247:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80424e:	48 01 ca             	add    %rcx,%rdx
+  804251:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804257:	39 fa                	cmp    %edi,%edx
+  804259:	74 12                	je     80426d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80425b:	48 83 c0 01          	add    $0x1,%rax
+  80425f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804265:	75 e0                	jne    804247 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804267:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80426c:	c3                   	ret
+            return envs[i].env_id;
+  80426d:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804274:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80427b:	00 00 00 
+  80427e:	48 01 d0             	add    %rdx,%rax
+  804281:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804287:	c3                   	ret
+
+0000000000804288 <__text_end>:
+  804288:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428f:	00 00 00 
+  804292:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804299:	00 00 00 
+  80429c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a3:	00 00 00 
+  8042a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ad:	00 00 00 
+  8042b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b7:	00 00 00 
+  8042ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c1:	00 00 00 
+  8042c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cb:	00 00 00 
+  8042ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d5:	00 00 00 
+  8042d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042df:	00 00 00 
+  8042e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e9:	00 00 00 
+  8042ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f3:	00 00 00 
+  8042f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fd:	00 00 00 
+  804300:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804307:	00 00 00 
+  80430a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804311:	00 00 00 
+  804314:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431b:	00 00 00 
+  80431e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804325:	00 00 00 
+  804328:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432f:	00 00 00 
+  804332:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804339:	00 00 00 
+  80433c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804343:	00 00 00 
+  804346:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434d:	00 00 00 
+  804350:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804357:	00 00 00 
+  80435a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804361:	00 00 00 
+  804364:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436b:	00 00 00 
+  80436e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804375:	00 00 00 
+  804378:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437f:	00 00 00 
+  804382:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804389:	00 00 00 
+  80438c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804393:	00 00 00 
+  804396:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439d:	00 00 00 
+  8043a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a7:	00 00 00 
+  8043aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b1:	00 00 00 
+  8043b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bb:	00 00 00 
+  8043be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c5:	00 00 00 
+  8043c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cf:	00 00 00 
+  8043d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d9:	00 00 00 
+  8043dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e3:	00 00 00 
+  8043e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ed:	00 00 00 
+  8043f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f7:	00 00 00 
+  8043fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804401:	00 00 00 
+  804404:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440b:	00 00 00 
+  80440e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804415:	00 00 00 
+  804418:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441f:	00 00 00 
+  804422:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804429:	00 00 00 
+  80442c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804433:	00 00 00 
+  804436:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443d:	00 00 00 
+  804440:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804447:	00 00 00 
+  80444a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804451:	00 00 00 
+  804454:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445b:	00 00 00 
+  80445e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804465:	00 00 00 
+  804468:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446f:	00 00 00 
+  804472:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804479:	00 00 00 
+  80447c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804483:	00 00 00 
+  804486:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448d:	00 00 00 
+  804490:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804497:	00 00 00 
+  80449a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a1:	00 00 00 
+  8044a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ab:	00 00 00 
+  8044ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b5:	00 00 00 
+  8044b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bf:	00 00 00 
+  8044c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c9:	00 00 00 
+  8044cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d3:	00 00 00 
+  8044d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044dd:	00 00 00 
+  8044e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e7:	00 00 00 
+  8044ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f1:	00 00 00 
+  8044f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fb:	00 00 00 
+  8044fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804505:	00 00 00 
+  804508:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450f:	00 00 00 
+  804512:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804519:	00 00 00 
+  80451c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804523:	00 00 00 
+  804526:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452d:	00 00 00 
+  804530:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804537:	00 00 00 
+  80453a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804541:	00 00 00 
+  804544:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454b:	00 00 00 
+  80454e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804555:	00 00 00 
+  804558:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455f:	00 00 00 
+  804562:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804569:	00 00 00 
+  80456c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804573:	00 00 00 
+  804576:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457d:	00 00 00 
+  804580:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804587:	00 00 00 
+  80458a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804591:	00 00 00 
+  804594:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459b:	00 00 00 
+  80459e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a5:	00 00 00 
+  8045a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045af:	00 00 00 
+  8045b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b9:	00 00 00 
+  8045bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c3:	00 00 00 
+  8045c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cd:	00 00 00 
+  8045d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d7:	00 00 00 
+  8045da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e1:	00 00 00 
+  8045e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045eb:	00 00 00 
+  8045ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f5:	00 00 00 
+  8045f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ff:	00 00 00 
+  804602:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804609:	00 00 00 
+  80460c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804613:	00 00 00 
+  804616:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461d:	00 00 00 
+  804620:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804627:	00 00 00 
+  80462a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804631:	00 00 00 
+  804634:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463b:	00 00 00 
+  80463e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804645:	00 00 00 
+  804648:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464f:	00 00 00 
+  804652:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804659:	00 00 00 
+  80465c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804663:	00 00 00 
+  804666:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466d:	00 00 00 
+  804670:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804677:	00 00 00 
+  80467a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804681:	00 00 00 
+  804684:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468b:	00 00 00 
+  80468e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804695:	00 00 00 
+  804698:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469f:	00 00 00 
+  8046a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a9:	00 00 00 
+  8046ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b3:	00 00 00 
+  8046b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bd:	00 00 00 
+  8046c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c7:	00 00 00 
+  8046ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d1:	00 00 00 
+  8046d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046db:	00 00 00 
+  8046de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e5:	00 00 00 
+  8046e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ef:	00 00 00 
+  8046f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f9:	00 00 00 
+  8046fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804703:	00 00 00 
+  804706:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470d:	00 00 00 
+  804710:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804717:	00 00 00 
+  80471a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804721:	00 00 00 
+  804724:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472b:	00 00 00 
+  80472e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804735:	00 00 00 
+  804738:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473f:	00 00 00 
+  804742:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804749:	00 00 00 
+  80474c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804753:	00 00 00 
+  804756:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475d:	00 00 00 
+  804760:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804767:	00 00 00 
+  80476a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804771:	00 00 00 
+  804774:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477b:	00 00 00 
+  80477e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804785:	00 00 00 
+  804788:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478f:	00 00 00 
+  804792:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804799:	00 00 00 
+  80479c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a3:	00 00 00 
+  8047a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ad:	00 00 00 
+  8047b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b7:	00 00 00 
+  8047ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c1:	00 00 00 
+  8047c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cb:	00 00 00 
+  8047ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d5:	00 00 00 
+  8047d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047df:	00 00 00 
+  8047e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e9:	00 00 00 
+  8047ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f3:	00 00 00 
+  8047f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fd:	00 00 00 
+  804800:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804807:	00 00 00 
+  80480a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804811:	00 00 00 
+  804814:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481b:	00 00 00 
+  80481e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804825:	00 00 00 
+  804828:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482f:	00 00 00 
+  804832:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804839:	00 00 00 
+  80483c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804843:	00 00 00 
+  804846:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484d:	00 00 00 
+  804850:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804857:	00 00 00 
+  80485a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804861:	00 00 00 
+  804864:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486b:	00 00 00 
+  80486e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804875:	00 00 00 
+  804878:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487f:	00 00 00 
+  804882:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804889:	00 00 00 
+  80488c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804893:	00 00 00 
+  804896:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489d:	00 00 00 
+  8048a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a7:	00 00 00 
+  8048aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b1:	00 00 00 
+  8048b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bb:	00 00 00 
+  8048be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c5:	00 00 00 
+  8048c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cf:	00 00 00 
+  8048d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d9:	00 00 00 
+  8048dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e3:	00 00 00 
+  8048e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ed:	00 00 00 
+  8048f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f7:	00 00 00 
+  8048fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804901:	00 00 00 
+  804904:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490b:	00 00 00 
+  80490e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804915:	00 00 00 
+  804918:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491f:	00 00 00 
+  804922:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804929:	00 00 00 
+  80492c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804933:	00 00 00 
+  804936:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493d:	00 00 00 
+  804940:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804947:	00 00 00 
+  80494a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804951:	00 00 00 
+  804954:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495b:	00 00 00 
+  80495e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804965:	00 00 00 
+  804968:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496f:	00 00 00 
+  804972:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804979:	00 00 00 
+  80497c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804983:	00 00 00 
+  804986:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498d:	00 00 00 
+  804990:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804997:	00 00 00 
+  80499a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a1:	00 00 00 
+  8049a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ab:	00 00 00 
+  8049ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b5:	00 00 00 
+  8049b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bf:	00 00 00 
+  8049c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c9:	00 00 00 
+  8049cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d3:	00 00 00 
+  8049d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049dd:	00 00 00 
+  8049e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e7:	00 00 00 
+  8049ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f1:	00 00 00 
+  8049f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fb:	00 00 00 
+  8049fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a05:	00 00 00 
+  804a08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0f:	00 00 00 
+  804a12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a19:	00 00 00 
+  804a1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a23:	00 00 00 
+  804a26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2d:	00 00 00 
+  804a30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a37:	00 00 00 
+  804a3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a41:	00 00 00 
+  804a44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4b:	00 00 00 
+  804a4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a55:	00 00 00 
+  804a58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5f:	00 00 00 
+  804a62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a69:	00 00 00 
+  804a6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a73:	00 00 00 
+  804a76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7d:	00 00 00 
+  804a80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a87:	00 00 00 
+  804a8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a91:	00 00 00 
+  804a94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9b:	00 00 00 
+  804a9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa5:	00 00 00 
+  804aa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaf:	00 00 00 
+  804ab2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab9:	00 00 00 
+  804abc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac3:	00 00 00 
+  804ac6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acd:	00 00 00 
+  804ad0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad7:	00 00 00 
+  804ada:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae1:	00 00 00 
+  804ae4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aeb:	00 00 00 
+  804aee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af5:	00 00 00 
+  804af8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aff:	00 00 00 
+  804b02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b09:	00 00 00 
+  804b0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b13:	00 00 00 
+  804b16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1d:	00 00 00 
+  804b20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b27:	00 00 00 
+  804b2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b31:	00 00 00 
+  804b34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3b:	00 00 00 
+  804b3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b45:	00 00 00 
+  804b48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4f:	00 00 00 
+  804b52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b59:	00 00 00 
+  804b5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b63:	00 00 00 
+  804b66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6d:	00 00 00 
+  804b70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b77:	00 00 00 
+  804b7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b81:	00 00 00 
+  804b84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8b:	00 00 00 
+  804b8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b95:	00 00 00 
+  804b98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9f:	00 00 00 
+  804ba2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba9:	00 00 00 
+  804bac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb3:	00 00 00 
+  804bb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbd:	00 00 00 
+  804bc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc7:	00 00 00 
+  804bca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd1:	00 00 00 
+  804bd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdb:	00 00 00 
+  804bde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be5:	00 00 00 
+  804be8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bef:	00 00 00 
+  804bf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf9:	00 00 00 
+  804bfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c03:	00 00 00 
+  804c06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0d:	00 00 00 
+  804c10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c17:	00 00 00 
+  804c1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c21:	00 00 00 
+  804c24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2b:	00 00 00 
+  804c2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c35:	00 00 00 
+  804c38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3f:	00 00 00 
+  804c42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c49:	00 00 00 
+  804c4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c53:	00 00 00 
+  804c56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5d:	00 00 00 
+  804c60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c67:	00 00 00 
+  804c6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c71:	00 00 00 
+  804c74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7b:	00 00 00 
+  804c7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c85:	00 00 00 
+  804c88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8f:	00 00 00 
+  804c92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c99:	00 00 00 
+  804c9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca3:	00 00 00 
+  804ca6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cad:	00 00 00 
+  804cb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb7:	00 00 00 
+  804cba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc1:	00 00 00 
+  804cc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccb:	00 00 00 
+  804cce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd5:	00 00 00 
+  804cd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdf:	00 00 00 
+  804ce2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce9:	00 00 00 
+  804cec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf3:	00 00 00 
+  804cf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfd:	00 00 00 
+  804d00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d07:	00 00 00 
+  804d0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d11:	00 00 00 
+  804d14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1b:	00 00 00 
+  804d1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d25:	00 00 00 
+  804d28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2f:	00 00 00 
+  804d32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d39:	00 00 00 
+  804d3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d43:	00 00 00 
+  804d46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4d:	00 00 00 
+  804d50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d57:	00 00 00 
+  804d5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d61:	00 00 00 
+  804d64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6b:	00 00 00 
+  804d6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d75:	00 00 00 
+  804d78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7f:	00 00 00 
+  804d82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d89:	00 00 00 
+  804d8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d93:	00 00 00 
+  804d96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9d:	00 00 00 
+  804da0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da7:	00 00 00 
+  804daa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db1:	00 00 00 
+  804db4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbb:	00 00 00 
+  804dbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc5:	00 00 00 
+  804dc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcf:	00 00 00 
+  804dd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd9:	00 00 00 
+  804ddc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de3:	00 00 00 
+  804de6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ded:	00 00 00 
+  804df0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df7:	00 00 00 
+  804dfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e01:	00 00 00 
+  804e04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0b:	00 00 00 
+  804e0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e15:	00 00 00 
+  804e18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1f:	00 00 00 
+  804e22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e29:	00 00 00 
+  804e2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e33:	00 00 00 
+  804e36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3d:	00 00 00 
+  804e40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e47:	00 00 00 
+  804e4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e51:	00 00 00 
+  804e54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5b:	00 00 00 
+  804e5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e65:	00 00 00 
+  804e68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6f:	00 00 00 
+  804e72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e79:	00 00 00 
+  804e7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e83:	00 00 00 
+  804e86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8d:	00 00 00 
+  804e90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e97:	00 00 00 
+  804e9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea1:	00 00 00 
+  804ea4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eab:	00 00 00 
+  804eae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb5:	00 00 00 
+  804eb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebf:	00 00 00 
+  804ec2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec9:	00 00 00 
+  804ecc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed3:	00 00 00 
+  804ed6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edd:	00 00 00 
+  804ee0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee7:	00 00 00 
+  804eea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef1:	00 00 00 
+  804ef4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efb:	00 00 00 
+  804efe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f05:	00 00 00 
+  804f08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0f:	00 00 00 
+  804f12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f19:	00 00 00 
+  804f1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f23:	00 00 00 
+  804f26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2d:	00 00 00 
+  804f30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f37:	00 00 00 
+  804f3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f41:	00 00 00 
+  804f44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4b:	00 00 00 
+  804f4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f55:	00 00 00 
+  804f58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5f:	00 00 00 
+  804f62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f69:	00 00 00 
+  804f6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f73:	00 00 00 
+  804f76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7d:	00 00 00 
+  804f80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f87:	00 00 00 
+  804f8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f91:	00 00 00 
+  804f94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9b:	00 00 00 
+  804f9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa5:	00 00 00 
+  804fa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faf:	00 00 00 
+  804fb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb9:	00 00 00 
+  804fbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc3:	00 00 00 
+  804fc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcd:	00 00 00 
+  804fd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd7:	00 00 00 
+  804fda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe1:	00 00 00 
+  804fe4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804feb:	00 00 00 
+  804fee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff5:	00 00 00 
+  804ff8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804fff:	00 
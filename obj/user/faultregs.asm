@@ -0,0 +1,9276 @@
+
+obj/user/faultregs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ba 0c 00 00       	call   800cdd <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <check_regs>:
+
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs *a, const char *an, struct regs *b, const char *bn,
+           const char *testname) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+  800036:	49 89 fc             	mov    %rdi,%r12
+  800039:	48 89 d3             	mov    %rdx,%rbx
+  80003c:	4d 89 c6             	mov    %r8,%r14
+    int mismatch = 0;
+
+    cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  80003f:	48 89 f2             	mov    %rsi,%rdx
+  800042:	48 be 33 60 80 00 00 	movabs $0x806033,%rsi
+  800049:	00 00 00 
+  80004c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  800053:	00 00 00 
+  800056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005b:	49 bd f9 0e 80 00 00 	movabs $0x800ef9,%r13
+  800062:	00 00 00 
+  800065:	41 ff d5             	call   *%r13
+            cprintf("MISMATCH\n");                                                             \
+            mismatch = 1;                                                                      \
+        }                                                                                      \
+    } while (0)
+
+    CHECK(r14, regs.reg_r14);
+  800068:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  80006c:	49 8b 54 24 08       	mov    0x8(%r12),%rdx
+  800071:	48 be 10 60 80 00 00 	movabs $0x806010,%rsi
+  800078:	00 00 00 
+  80007b:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	41 ff d5             	call   *%r13
+  80008d:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  800091:	49 39 44 24 08       	cmp    %rax,0x8(%r12)
+  800096:	0f 84 48 06 00 00    	je     8006e4 <check_regs+0x6bf>
+  80009c:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  8000a3:	00 00 00 
+  8000a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ab:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8000b2:	00 00 00 
+  8000b5:	ff d2                	call   *%rdx
+  8000b7:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r13, regs.reg_r13);
+  8000bd:	48 8b 4b 10          	mov    0x10(%rbx),%rcx
+  8000c1:	49 8b 54 24 10       	mov    0x10(%r12),%rdx
+  8000c6:	48 be 34 60 80 00 00 	movabs $0x806034,%rsi
+  8000cd:	00 00 00 
+  8000d0:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  8000d7:	00 00 00 
+  8000da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000df:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8000e6:	00 00 00 
+  8000e9:	41 ff d0             	call   *%r8
+  8000ec:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8000f0:	49 39 44 24 10       	cmp    %rax,0x10(%r12)
+  8000f5:	0f 84 06 06 00 00    	je     800701 <check_regs+0x6dc>
+  8000fb:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  800102:	00 00 00 
+  800105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010a:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800111:	00 00 00 
+  800114:	ff d2                	call   *%rdx
+  800116:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r12, regs.reg_r12);
+  80011c:	48 8b 4b 18          	mov    0x18(%rbx),%rcx
+  800120:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  800125:	48 be 38 60 80 00 00 	movabs $0x806038,%rsi
+  80012c:	00 00 00 
+  80012f:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  800145:	00 00 00 
+  800148:	41 ff d0             	call   *%r8
+  80014b:	48 8b 43 18          	mov    0x18(%rbx),%rax
+  80014f:	49 39 44 24 18       	cmp    %rax,0x18(%r12)
+  800154:	0f 84 c7 05 00 00    	je     800721 <check_regs+0x6fc>
+  80015a:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  800161:	00 00 00 
+  800164:	b8 00 00 00 00       	mov    $0x0,%eax
+  800169:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800170:	00 00 00 
+  800173:	ff d2                	call   *%rdx
+  800175:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r11, regs.reg_r11);
+  80017b:	48 8b 4b 20          	mov    0x20(%rbx),%rcx
+  80017f:	49 8b 54 24 20       	mov    0x20(%r12),%rdx
+  800184:	48 be 3c 60 80 00 00 	movabs $0x80603c,%rsi
+  80018b:	00 00 00 
+  80018e:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8001a4:	00 00 00 
+  8001a7:	41 ff d0             	call   *%r8
+  8001aa:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8001ae:	49 39 44 24 20       	cmp    %rax,0x20(%r12)
+  8001b3:	0f 84 88 05 00 00    	je     800741 <check_regs+0x71c>
+  8001b9:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  8001c0:	00 00 00 
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8001cf:	00 00 00 
+  8001d2:	ff d2                	call   *%rdx
+  8001d4:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r10, regs.reg_r10);
+  8001da:	48 8b 4b 28          	mov    0x28(%rbx),%rcx
+  8001de:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8001e3:	48 be 40 60 80 00 00 	movabs $0x806040,%rsi
+  8001ea:	00 00 00 
+  8001ed:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  8001f4:	00 00 00 
+  8001f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fc:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  800203:	00 00 00 
+  800206:	41 ff d0             	call   *%r8
+  800209:	48 8b 43 28          	mov    0x28(%rbx),%rax
+  80020d:	49 39 44 24 28       	cmp    %rax,0x28(%r12)
+  800212:	0f 84 49 05 00 00    	je     800761 <check_regs+0x73c>
+  800218:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  80021f:	00 00 00 
+  800222:	b8 00 00 00 00       	mov    $0x0,%eax
+  800227:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  80022e:	00 00 00 
+  800231:	ff d2                	call   *%rdx
+  800233:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800239:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80023d:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  800242:	48 be 44 60 80 00 00 	movabs $0x806044,%rsi
+  800249:	00 00 00 
+  80024c:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  800253:	00 00 00 
+  800256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025b:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  800262:	00 00 00 
+  800265:	41 ff d0             	call   *%r8
+  800268:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  80026c:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  800271:	0f 84 0a 05 00 00    	je     800781 <check_regs+0x75c>
+  800277:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  80027e:	00 00 00 
+  800281:	b8 00 00 00 00       	mov    $0x0,%eax
+  800286:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  80028d:	00 00 00 
+  800290:	ff d2                	call   *%rdx
+  800292:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  800298:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  80029c:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  8002a1:	48 be 48 60 80 00 00 	movabs $0x806048,%rsi
+  8002a8:	00 00 00 
+  8002ab:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  8002b2:	00 00 00 
+  8002b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ba:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8002c1:	00 00 00 
+  8002c4:	41 ff d0             	call   *%r8
+  8002c7:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  8002cb:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  8002d0:	0f 84 cb 04 00 00    	je     8007a1 <check_regs+0x77c>
+  8002d6:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8002ec:	00 00 00 
+  8002ef:	ff d2                	call   *%rdx
+  8002f1:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  8002f7:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  8002fb:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  800300:	48 be 48 60 80 00 00 	movabs $0x806048,%rsi
+  800307:	00 00 00 
+  80030a:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  800311:	00 00 00 
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  800320:	00 00 00 
+  800323:	41 ff d0             	call   *%r8
+  800326:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  80032a:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  80032f:	0f 84 8c 04 00 00    	je     8007c1 <check_regs+0x79c>
+  800335:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  80033c:	00 00 00 
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  80034b:	00 00 00 
+  80034e:	ff d2                	call   *%rdx
+  800350:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800356:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80035a:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  80035f:	48 be 44 60 80 00 00 	movabs $0x806044,%rsi
+  800366:	00 00 00 
+  800369:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  800370:	00 00 00 
+  800373:	b8 00 00 00 00       	mov    $0x0,%eax
+  800378:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  80037f:	00 00 00 
+  800382:	41 ff d0             	call   *%r8
+  800385:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  800389:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  80038e:	0f 84 4d 04 00 00    	je     8007e1 <check_regs+0x7bc>
+  800394:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  80039b:	00 00 00 
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8003aa:	00 00 00 
+  8003ad:	ff d2                	call   *%rdx
+  8003af:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbp, regs.reg_rbp);
+  8003b5:	48 8b 4b 50          	mov    0x50(%rbx),%rcx
+  8003b9:	49 8b 54 24 50       	mov    0x50(%r12),%rdx
+  8003be:	48 be 4c 60 80 00 00 	movabs $0x80604c,%rsi
+  8003c5:	00 00 00 
+  8003c8:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  8003cf:	00 00 00 
+  8003d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d7:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8003de:	00 00 00 
+  8003e1:	41 ff d0             	call   *%r8
+  8003e4:	48 8b 43 50          	mov    0x50(%rbx),%rax
+  8003e8:	49 39 44 24 50       	cmp    %rax,0x50(%r12)
+  8003ed:	0f 84 0e 04 00 00    	je     800801 <check_regs+0x7dc>
+  8003f3:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  8003fa:	00 00 00 
+  8003fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800402:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800409:	00 00 00 
+  80040c:	ff d2                	call   *%rdx
+  80040e:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbx, regs.reg_rbx);
+  800414:	48 8b 4b 68          	mov    0x68(%rbx),%rcx
+  800418:	49 8b 54 24 68       	mov    0x68(%r12),%rdx
+  80041d:	48 be 50 60 80 00 00 	movabs $0x806050,%rsi
+  800424:	00 00 00 
+  800427:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+  800443:	48 8b 43 68          	mov    0x68(%rbx),%rax
+  800447:	49 39 44 24 68       	cmp    %rax,0x68(%r12)
+  80044c:	0f 84 cf 03 00 00    	je     800821 <check_regs+0x7fc>
+  800452:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  800459:	00 00 00 
+  80045c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800461:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800468:	00 00 00 
+  80046b:	ff d2                	call   *%rdx
+  80046d:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdx, regs.reg_rdx);
+  800473:	48 8b 4b 58          	mov    0x58(%rbx),%rcx
+  800477:	49 8b 54 24 58       	mov    0x58(%r12),%rdx
+  80047c:	48 be 54 60 80 00 00 	movabs $0x806054,%rsi
+  800483:	00 00 00 
+  800486:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  80048d:	00 00 00 
+  800490:	b8 00 00 00 00       	mov    $0x0,%eax
+  800495:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  80049c:	00 00 00 
+  80049f:	41 ff d0             	call   *%r8
+  8004a2:	48 8b 43 58          	mov    0x58(%rbx),%rax
+  8004a6:	49 39 44 24 58       	cmp    %rax,0x58(%r12)
+  8004ab:	0f 84 90 03 00 00    	je     800841 <check_regs+0x81c>
+  8004b1:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  8004b8:	00 00 00 
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8004c7:	00 00 00 
+  8004ca:	ff d2                	call   *%rdx
+  8004cc:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rcx, regs.reg_rcx);
+  8004d2:	48 8b 4b 60          	mov    0x60(%rbx),%rcx
+  8004d6:	49 8b 54 24 60       	mov    0x60(%r12),%rdx
+  8004db:	48 be 58 60 80 00 00 	movabs $0x806058,%rsi
+  8004e2:	00 00 00 
+  8004e5:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  8004ec:	00 00 00 
+  8004ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f4:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8004fb:	00 00 00 
+  8004fe:	41 ff d0             	call   *%r8
+  800501:	48 8b 43 60          	mov    0x60(%rbx),%rax
+  800505:	49 39 44 24 60       	cmp    %rax,0x60(%r12)
+  80050a:	0f 84 51 03 00 00    	je     800861 <check_regs+0x83c>
+  800510:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  800517:	00 00 00 
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800526:	00 00 00 
+  800529:	ff d2                	call   *%rdx
+  80052b:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rax, regs.reg_rax);
+  800531:	48 8b 4b 70          	mov    0x70(%rbx),%rcx
+  800535:	49 8b 54 24 70       	mov    0x70(%r12),%rdx
+  80053a:	48 be 5c 60 80 00 00 	movabs $0x80605c,%rsi
+  800541:	00 00 00 
+  800544:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  80054b:	00 00 00 
+  80054e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800553:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  80055a:	00 00 00 
+  80055d:	41 ff d0             	call   *%r8
+  800560:	48 8b 43 70          	mov    0x70(%rbx),%rax
+  800564:	49 39 44 24 70       	cmp    %rax,0x70(%r12)
+  800569:	0f 84 12 03 00 00    	je     800881 <check_regs+0x85c>
+  80056f:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  800576:	00 00 00 
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800585:	00 00 00 
+  800588:	ff d2                	call   *%rdx
+  80058a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rip, rip);
+  800590:	48 8b 4b 78          	mov    0x78(%rbx),%rcx
+  800594:	49 8b 54 24 78       	mov    0x78(%r12),%rdx
+  800599:	48 be 60 60 80 00 00 	movabs $0x806060,%rsi
+  8005a0:	00 00 00 
+  8005a3:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  8005aa:	00 00 00 
+  8005ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b2:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8005b9:	00 00 00 
+  8005bc:	41 ff d0             	call   *%r8
+  8005bf:	48 8b 43 78          	mov    0x78(%rbx),%rax
+  8005c3:	49 39 44 24 78       	cmp    %rax,0x78(%r12)
+  8005c8:	0f 84 d3 02 00 00    	je     8008a1 <check_regs+0x87c>
+  8005ce:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  8005d5:	00 00 00 
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8005e4:	00 00 00 
+  8005e7:	ff d2                	call   *%rdx
+  8005e9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rflags, rflags);
+  8005ef:	48 8b 8b 80 00 00 00 	mov    0x80(%rbx),%rcx
+  8005f6:	49 8b 94 24 80 00 00 	mov    0x80(%r12),%rdx
+  8005fd:	00 
+  8005fe:	48 be 64 60 80 00 00 	movabs $0x806064,%rsi
+  800605:	00 00 00 
+  800608:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  80060f:	00 00 00 
+  800612:	b8 00 00 00 00       	mov    $0x0,%eax
+  800617:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  80061e:	00 00 00 
+  800621:	41 ff d0             	call   *%r8
+  800624:	48 8b 83 80 00 00 00 	mov    0x80(%rbx),%rax
+  80062b:	49 39 84 24 80 00 00 	cmp    %rax,0x80(%r12)
+  800632:	00 
+  800633:	0f 84 88 02 00 00    	je     8008c1 <check_regs+0x89c>
+  800639:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  800640:	00 00 00 
+  800643:	b8 00 00 00 00       	mov    $0x0,%eax
+  800648:	49 bd f9 0e 80 00 00 	movabs $0x800ef9,%r13
+  80064f:	00 00 00 
+  800652:	41 ff d5             	call   *%r13
+    CHECK(rsp, rsp);
+  800655:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  80065c:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  800663:	00 
+  800664:	48 be 6b 60 80 00 00 	movabs $0x80606b,%rsi
+  80066b:	00 00 00 
+  80066e:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  800675:	00 00 00 
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	41 ff d5             	call   *%r13
+  800680:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  800687:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  80068e:	00 
+  80068f:	0f 84 ea 02 00 00    	je     80097f <check_regs+0x95a>
+  800695:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  80069c:	00 00 00 
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	48 bb f9 0e 80 00 00 	movabs $0x800ef9,%rbx
+  8006ab:	00 00 00 
+  8006ae:	ff d3                	call   *%rbx
+
+#undef CHECK
+
+    cprintf("Registers %s ", testname);
+  8006b0:	4c 89 f6             	mov    %r14,%rsi
+  8006b3:	48 bf 6f 60 80 00 00 	movabs $0x80606f,%rdi
+  8006ba:	00 00 00 
+  8006bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c2:	ff d3                	call   *%rbx
+    if (!mismatch)
+        cprintf("OK\n");
+    else
+        cprintf("MISMATCH\n");
+  8006c4:	48 bf 2a 60 80 00 00 	movabs $0x80602a,%rdi
+  8006cb:	00 00 00 
+  8006ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d3:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8006da:	00 00 00 
+  8006dd:	ff d2                	call   *%rdx
+}
+  8006df:	e9 8c 02 00 00       	jmp    800970 <check_regs+0x94b>
+    CHECK(r14, regs.reg_r14);
+  8006e4:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  8006eb:	00 00 00 
+  8006ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f3:	41 ff d5             	call   *%r13
+    int mismatch = 0;
+  8006f6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8006fc:	e9 bc f9 ff ff       	jmp    8000bd <check_regs+0x98>
+    CHECK(r13, regs.reg_r13);
+  800701:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800708:	00 00 00 
+  80070b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800710:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800717:	00 00 00 
+  80071a:	ff d2                	call   *%rdx
+  80071c:	e9 fb f9 ff ff       	jmp    80011c <check_regs+0xf7>
+    CHECK(r12, regs.reg_r12);
+  800721:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800728:	00 00 00 
+  80072b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800730:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800737:	00 00 00 
+  80073a:	ff d2                	call   *%rdx
+  80073c:	e9 3a fa ff ff       	jmp    80017b <check_regs+0x156>
+    CHECK(r11, regs.reg_r11);
+  800741:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800748:	00 00 00 
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800757:	00 00 00 
+  80075a:	ff d2                	call   *%rdx
+  80075c:	e9 79 fa ff ff       	jmp    8001da <check_regs+0x1b5>
+    CHECK(r10, regs.reg_r10);
+  800761:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800768:	00 00 00 
+  80076b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800770:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800777:	00 00 00 
+  80077a:	ff d2                	call   *%rdx
+  80077c:	e9 b8 fa ff ff       	jmp    800239 <check_regs+0x214>
+    CHECK(rsi, regs.reg_rsi);
+  800781:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800788:	00 00 00 
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800797:	00 00 00 
+  80079a:	ff d2                	call   *%rdx
+  80079c:	e9 f7 fa ff ff       	jmp    800298 <check_regs+0x273>
+    CHECK(rdi, regs.reg_rdi);
+  8007a1:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  8007a8:	00 00 00 
+  8007ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b0:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8007b7:	00 00 00 
+  8007ba:	ff d2                	call   *%rdx
+  8007bc:	e9 36 fb ff ff       	jmp    8002f7 <check_regs+0x2d2>
+    CHECK(rdi, regs.reg_rdi);
+  8007c1:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  8007c8:	00 00 00 
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8007d7:	00 00 00 
+  8007da:	ff d2                	call   *%rdx
+  8007dc:	e9 75 fb ff ff       	jmp    800356 <check_regs+0x331>
+    CHECK(rsi, regs.reg_rsi);
+  8007e1:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  8007e8:	00 00 00 
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8007f7:	00 00 00 
+  8007fa:	ff d2                	call   *%rdx
+  8007fc:	e9 b4 fb ff ff       	jmp    8003b5 <check_regs+0x390>
+    CHECK(rbp, regs.reg_rbp);
+  800801:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800808:	00 00 00 
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800817:	00 00 00 
+  80081a:	ff d2                	call   *%rdx
+  80081c:	e9 f3 fb ff ff       	jmp    800414 <check_regs+0x3ef>
+    CHECK(rbx, regs.reg_rbx);
+  800821:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800828:	00 00 00 
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800837:	00 00 00 
+  80083a:	ff d2                	call   *%rdx
+  80083c:	e9 32 fc ff ff       	jmp    800473 <check_regs+0x44e>
+    CHECK(rdx, regs.reg_rdx);
+  800841:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800848:	00 00 00 
+  80084b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800850:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800857:	00 00 00 
+  80085a:	ff d2                	call   *%rdx
+  80085c:	e9 71 fc ff ff       	jmp    8004d2 <check_regs+0x4ad>
+    CHECK(rcx, regs.reg_rcx);
+  800861:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800868:	00 00 00 
+  80086b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800870:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800877:	00 00 00 
+  80087a:	ff d2                	call   *%rdx
+  80087c:	e9 b0 fc ff ff       	jmp    800531 <check_regs+0x50c>
+    CHECK(rax, regs.reg_rax);
+  800881:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800888:	00 00 00 
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800897:	00 00 00 
+  80089a:	ff d2                	call   *%rdx
+  80089c:	e9 ef fc ff ff       	jmp    800590 <check_regs+0x56b>
+    CHECK(rip, rip);
+  8008a1:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  8008a8:	00 00 00 
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8008b7:	00 00 00 
+  8008ba:	ff d2                	call   *%rdx
+  8008bc:	e9 2e fd ff ff       	jmp    8005ef <check_regs+0x5ca>
+    CHECK(rflags, rflags);
+  8008c1:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  8008c8:	00 00 00 
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	49 bf f9 0e 80 00 00 	movabs $0x800ef9,%r15
+  8008d7:	00 00 00 
+  8008da:	41 ff d7             	call   *%r15
+    CHECK(rsp, rsp);
+  8008dd:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  8008e4:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  8008eb:	00 
+  8008ec:	48 be 6b 60 80 00 00 	movabs $0x80606b,%rsi
+  8008f3:	00 00 00 
+  8008f6:	48 bf 14 60 80 00 00 	movabs $0x806014,%rdi
+  8008fd:	00 00 00 
+  800900:	b8 00 00 00 00       	mov    $0x0,%eax
+  800905:	41 ff d7             	call   *%r15
+  800908:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  80090f:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  800916:	00 
+  800917:	0f 85 78 fd ff ff    	jne    800695 <check_regs+0x670>
+  80091d:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800924:	00 00 00 
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	48 bb f9 0e 80 00 00 	movabs $0x800ef9,%rbx
+  800933:	00 00 00 
+  800936:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  800938:	4c 89 f6             	mov    %r14,%rsi
+  80093b:	48 bf 6f 60 80 00 00 	movabs $0x80606f,%rdi
+  800942:	00 00 00 
+  800945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094a:	ff d3                	call   *%rbx
+    if (!mismatch)
+  80094c:	45 85 ed             	test   %r13d,%r13d
+  80094f:	0f 85 6f fd ff ff    	jne    8006c4 <check_regs+0x69f>
+        cprintf("OK\n");
+  800955:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  80095c:	00 00 00 
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800964:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  80096b:	00 00 00 
+  80096e:	ff d2                	call   *%rdx
+}
+  800970:	48 83 c4 08          	add    $0x8,%rsp
+  800974:	5b                   	pop    %rbx
+  800975:	41 5c                	pop    %r12
+  800977:	41 5d                	pop    %r13
+  800979:	41 5e                	pop    %r14
+  80097b:	41 5f                	pop    %r15
+  80097d:	5d                   	pop    %rbp
+  80097e:	c3                   	ret
+    CHECK(rsp, rsp);
+  80097f:	48 bf 26 60 80 00 00 	movabs $0x806026,%rdi
+  800986:	00 00 00 
+  800989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098e:	48 bb f9 0e 80 00 00 	movabs $0x800ef9,%rbx
+  800995:	00 00 00 
+  800998:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  80099a:	4c 89 f6             	mov    %r14,%rsi
+  80099d:	48 bf 6f 60 80 00 00 	movabs $0x80606f,%rdi
+  8009a4:	00 00 00 
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ac:	ff d3                	call   *%rbx
+    if (!mismatch)
+  8009ae:	e9 11 fd ff ff       	jmp    8006c4 <check_regs+0x69f>
+
+00000000008009b3 <pgfault>:
+
+static bool
+pgfault(struct UTrapframe *utf) {
+  8009b3:	55                   	push   %rbp
+  8009b4:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+
+    if (utf->utf_fault_va != (uint64_t)UTEMP)
+  8009b7:	48 8b 0f             	mov    (%rdi),%rcx
+  8009ba:	48 81 f9 00 00 40 00 	cmp    $0x400000,%rcx
+  8009c1:	0f 85 13 01 00 00    	jne    800ada <pgfault+0x127>
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+              (unsigned long)utf->utf_fault_va, (unsigned long)utf->utf_rip);
+
+    /* Check registers in UTrapframe */
+    during.regs = utf->utf_regs;
+  8009c7:	48 be a0 80 80 00 00 	movabs $0x8080a0,%rsi
+  8009ce:	00 00 00 
+  8009d1:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+  8009d5:	48 89 16             	mov    %rdx,(%rsi)
+  8009d8:	48 8b 57 18          	mov    0x18(%rdi),%rdx
+  8009dc:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  8009e0:	48 8b 57 20          	mov    0x20(%rdi),%rdx
+  8009e4:	48 89 56 10          	mov    %rdx,0x10(%rsi)
+  8009e8:	48 8b 57 28          	mov    0x28(%rdi),%rdx
+  8009ec:	48 89 56 18          	mov    %rdx,0x18(%rsi)
+  8009f0:	48 8b 57 30          	mov    0x30(%rdi),%rdx
+  8009f4:	48 89 56 20          	mov    %rdx,0x20(%rsi)
+  8009f8:	48 8b 57 38          	mov    0x38(%rdi),%rdx
+  8009fc:	48 89 56 28          	mov    %rdx,0x28(%rsi)
+  800a00:	48 8b 57 40          	mov    0x40(%rdi),%rdx
+  800a04:	48 89 56 30          	mov    %rdx,0x30(%rsi)
+  800a08:	48 8b 57 48          	mov    0x48(%rdi),%rdx
+  800a0c:	48 89 56 38          	mov    %rdx,0x38(%rsi)
+  800a10:	48 8b 57 50          	mov    0x50(%rdi),%rdx
+  800a14:	48 89 56 40          	mov    %rdx,0x40(%rsi)
+  800a18:	48 8b 57 58          	mov    0x58(%rdi),%rdx
+  800a1c:	48 89 56 48          	mov    %rdx,0x48(%rsi)
+  800a20:	48 8b 57 60          	mov    0x60(%rdi),%rdx
+  800a24:	48 89 56 50          	mov    %rdx,0x50(%rsi)
+  800a28:	48 8b 57 68          	mov    0x68(%rdi),%rdx
+  800a2c:	48 89 56 58          	mov    %rdx,0x58(%rsi)
+  800a30:	48 8b 57 70          	mov    0x70(%rdi),%rdx
+  800a34:	48 89 56 60          	mov    %rdx,0x60(%rsi)
+  800a38:	48 8b 57 78          	mov    0x78(%rdi),%rdx
+  800a3c:	48 89 56 68          	mov    %rdx,0x68(%rsi)
+  800a40:	48 8b 97 80 00 00 00 	mov    0x80(%rdi),%rdx
+  800a47:	48 89 56 70          	mov    %rdx,0x70(%rsi)
+    during.rip = utf->utf_rip;
+  800a4b:	48 8b 97 88 00 00 00 	mov    0x88(%rdi),%rdx
+  800a52:	48 89 56 78          	mov    %rdx,0x78(%rsi)
+    during.rflags = utf->utf_rflags & 0xfff;
+  800a56:	48 8b 97 90 00 00 00 	mov    0x90(%rdi),%rdx
+  800a5d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  800a63:	48 89 96 80 00 00 00 	mov    %rdx,0x80(%rsi)
+    during.rsp = utf->utf_rsp;
+  800a6a:	48 8b 87 98 00 00 00 	mov    0x98(%rdi),%rax
+  800a71:	48 89 86 88 00 00 00 	mov    %rax,0x88(%rsi)
+    check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800a78:	49 b8 8e 60 80 00 00 	movabs $0x80608e,%r8
+  800a7f:	00 00 00 
+  800a82:	48 b9 9c 60 80 00 00 	movabs $0x80609c,%rcx
+  800a89:	00 00 00 
+  800a8c:	48 89 f2             	mov    %rsi,%rdx
+  800a8f:	48 be a3 60 80 00 00 	movabs $0x8060a3,%rsi
+  800a96:	00 00 00 
+  800a99:	48 bf 40 81 80 00 00 	movabs $0x808140,%rdi
+  800aa0:	00 00 00 
+  800aa3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+    ;
+
+    /* Map UTEMP so the write succeeds */
+    if ((r = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW)) < 0)
+  800aaf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800ab4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ab9:	be 00 00 40 00       	mov    $0x400000,%esi
+  800abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac3:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  800aca:	00 00 00 
+  800acd:	ff d0                	call   *%rax
+  800acf:	85 c0                	test   %eax,%eax
+  800ad1:	78 39                	js     800b0c <pgfault+0x159>
+        panic("sys_page_alloc: %i", r);
+    return 1;
+}
+  800ad3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ad8:	5d                   	pop    %rbp
+  800ad9:	c3                   	ret
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+  800ada:	4c 8b 87 88 00 00 00 	mov    0x88(%rdi),%r8
+  800ae1:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800ae8:	00 00 00 
+  800aeb:	be 62 00 00 00       	mov    $0x62,%esi
+  800af0:	48 bf 7d 60 80 00 00 	movabs $0x80607d,%rdi
+  800af7:	00 00 00 
+  800afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aff:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  800b06:	00 00 00 
+  800b09:	41 ff d1             	call   *%r9
+        panic("sys_page_alloc: %i", r);
+  800b0c:	89 c1                	mov    %eax,%ecx
+  800b0e:	48 ba aa 60 80 00 00 	movabs $0x8060aa,%rdx
+  800b15:	00 00 00 
+  800b18:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800b1d:	48 bf 7d 60 80 00 00 	movabs $0x80607d,%rdi
+  800b24:	00 00 00 
+  800b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2c:	49 b8 a9 0d 80 00 00 	movabs $0x800da9,%r8
+  800b33:	00 00 00 
+  800b36:	41 ff d0             	call   *%r8
+
+0000000000800b39 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800b39:	55                   	push   %rbp
+  800b3a:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(pgfault);
+  800b3d:	48 bf b3 09 80 00 00 	movabs $0x8009b3,%rdi
+  800b44:	00 00 00 
+  800b47:	48 b8 71 2a 80 00 00 	movabs $0x802a71,%rax
+  800b4e:	00 00 00 
+  800b51:	ff d0                	call   *%rax
+
+    __asm __volatile(
+  800b53:	48 b8 40 81 80 00 00 	movabs $0x808140,%rax
+  800b5a:	00 00 00 
+  800b5d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800b64:	00 00 00 
+  800b67:	50                   	push   %rax
+  800b68:	52                   	push   %rdx
+  800b69:	50                   	push   %rax
+  800b6a:	9c                   	pushf
+  800b6b:	58                   	pop    %rax
+  800b6c:	48 0d d4 08 00 00    	or     $0x8d4,%rax
+  800b72:	50                   	push   %rax
+  800b73:	9d                   	popf
+  800b74:	4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+  800b79:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800b80:	48 8d 04 25 cc 0b 80 	lea    0x800bcc,%rax
+  800b87:	00 
+  800b88:	49 89 47 78          	mov    %rax,0x78(%r15)
+  800b8c:	58                   	pop    %rax
+  800b8d:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800b91:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800b95:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800b99:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800b9d:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800ba1:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800ba5:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800ba9:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bad:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bb1:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800bb5:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800bb9:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800bbd:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800bc1:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800bc5:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800bcc:	c7 04 25 00 00 40 00 	movl   $0x2a,0x400000
+  800bd3:	2a 00 00 00 
+  800bd7:	4c 8b 3c 24          	mov    (%rsp),%r15
+  800bdb:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800bdf:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800be3:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800be7:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800beb:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800bef:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800bf3:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800bf7:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bfb:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bff:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800c03:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800c07:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800c0b:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800c0f:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800c13:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800c1a:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c1f:	4d 8b 77 08          	mov    0x8(%r15),%r14
+  800c23:	4d 8b 6f 10          	mov    0x10(%r15),%r13
+  800c27:	4d 8b 67 18          	mov    0x18(%r15),%r12
+  800c2b:	4d 8b 5f 20          	mov    0x20(%r15),%r11
+  800c2f:	4d 8b 57 28          	mov    0x28(%r15),%r10
+  800c33:	4d 8b 4f 30          	mov    0x30(%r15),%r9
+  800c37:	4d 8b 47 38          	mov    0x38(%r15),%r8
+  800c3b:	49 8b 77 40          	mov    0x40(%r15),%rsi
+  800c3f:	49 8b 7f 48          	mov    0x48(%r15),%rdi
+  800c43:	49 8b 6f 50          	mov    0x50(%r15),%rbp
+  800c47:	49 8b 57 58          	mov    0x58(%r15),%rdx
+  800c4b:	49 8b 4f 60          	mov    0x60(%r15),%rcx
+  800c4f:	49 8b 5f 68          	mov    0x68(%r15),%rbx
+  800c53:	49 8b 47 70          	mov    0x70(%r15),%rax
+  800c57:	49 8b a7 88 00 00 00 	mov    0x88(%r15),%rsp
+  800c5e:	50                   	push   %rax
+  800c5f:	9c                   	pushf
+  800c60:	58                   	pop    %rax
+  800c61:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c66:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800c6d:	58                   	pop    %rax
+            : "memory", "cc");
+
+    /* Check UTEMP to roughly determine that EIP was restored
+     * correctly (of course, we probably wouldn't get this far if
+     * it weren't) */
+    if (*(int *)UTEMP != 42)
+  800c6e:	83 3c 25 00 00 40 00 	cmpl   $0x2a,0x400000
+  800c75:	2a 
+  800c76:	75 48                	jne    800cc0 <umain+0x187>
+        cprintf("RIP after page-fault MISMATCH\n");
+    after.rip = before.rip;
+  800c78:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800c7f:	00 00 00 
+  800c82:	48 bf 40 81 80 00 00 	movabs $0x808140,%rdi
+  800c89:	00 00 00 
+  800c8c:	48 8b 47 78          	mov    0x78(%rdi),%rax
+  800c90:	48 89 42 78          	mov    %rax,0x78(%rdx)
+
+    check_regs(&before, "before", &after, "after", "after page-fault");
+  800c94:	49 b8 bd 60 80 00 00 	movabs $0x8060bd,%r8
+  800c9b:	00 00 00 
+  800c9e:	48 b9 ce 60 80 00 00 	movabs $0x8060ce,%rcx
+  800ca5:	00 00 00 
+  800ca8:	48 be a3 60 80 00 00 	movabs $0x8060a3,%rsi
+  800caf:	00 00 00 
+  800cb2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800cb9:	00 00 00 
+  800cbc:	ff d0                	call   *%rax
+}
+  800cbe:	5d                   	pop    %rbp
+  800cbf:	c3                   	ret
+        cprintf("RIP after page-fault MISMATCH\n");
+  800cc0:	48 bf 10 61 80 00 00 	movabs $0x806110,%rdi
+  800cc7:	00 00 00 
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccf:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800cd6:	00 00 00 
+  800cd9:	ff d2                	call   *%rdx
+  800cdb:	eb 9b                	jmp    800c78 <umain+0x13f>
+
+0000000000800cdd <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800cdd:	55                   	push   %rbp
+  800cde:	48 89 e5             	mov    %rsp,%rbp
+  800ce1:	41 56                	push   %r14
+  800ce3:	41 55                	push   %r13
+  800ce5:	41 54                	push   %r12
+  800ce7:	53                   	push   %rbx
+  800ce8:	41 89 fd             	mov    %edi,%r13d
+  800ceb:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800cee:	48 ba d8 70 80 00 00 	movabs $0x8070d8,%rdx
+  800cf5:	00 00 00 
+  800cf8:	48 b8 d8 70 80 00 00 	movabs $0x8070d8,%rax
+  800cff:	00 00 00 
+  800d02:	48 39 c2             	cmp    %rax,%rdx
+  800d05:	73 17                	jae    800d1e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800d07:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800d0a:	49 89 c4             	mov    %rax,%r12
+  800d0d:	48 83 c3 08          	add    $0x8,%rbx
+  800d11:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d16:	ff 53 f8             	call   *-0x8(%rbx)
+  800d19:	4c 39 e3             	cmp    %r12,%rbx
+  800d1c:	72 ef                	jb     800d0d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800d1e:	48 b8 11 1f 80 00 00 	movabs $0x801f11,%rax
+  800d25:	00 00 00 
+  800d28:	ff d0                	call   *%rax
+  800d2a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800d2f:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800d36:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800d3d:	00 00 00 
+  800d40:	48 01 d0             	add    %rdx,%rax
+  800d43:	48 a3 d0 81 80 00 00 	movabs %rax,0x8081d0
+  800d4a:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800d4d:	45 85 ed             	test   %r13d,%r13d
+  800d50:	7e 0d                	jle    800d5f <libmain+0x82>
+  800d52:	49 8b 06             	mov    (%r14),%rax
+  800d55:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800d5c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800d5f:	4c 89 f6             	mov    %r14,%rsi
+  800d62:	44 89 ef             	mov    %r13d,%edi
+  800d65:	48 b8 39 0b 80 00 00 	movabs $0x800b39,%rax
+  800d6c:	00 00 00 
+  800d6f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800d71:	48 b8 86 0d 80 00 00 	movabs $0x800d86,%rax
+  800d78:	00 00 00 
+  800d7b:	ff d0                	call   *%rax
+#endif
+}
+  800d7d:	5b                   	pop    %rbx
+  800d7e:	41 5c                	pop    %r12
+  800d80:	41 5d                	pop    %r13
+  800d82:	41 5e                	pop    %r14
+  800d84:	5d                   	pop    %rbp
+  800d85:	c3                   	ret
+
+0000000000800d86 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800d86:	55                   	push   %rbp
+  800d87:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800d8a:	48 b8 da 2e 80 00 00 	movabs $0x802eda,%rax
+  800d91:	00 00 00 
+  800d94:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800d96:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d9b:	48 b8 a6 1e 80 00 00 	movabs $0x801ea6,%rax
+  800da2:	00 00 00 
+  800da5:	ff d0                	call   *%rax
+}
+  800da7:	5d                   	pop    %rbp
+  800da8:	c3                   	ret
+
+0000000000800da9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800da9:	55                   	push   %rbp
+  800daa:	48 89 e5             	mov    %rsp,%rbp
+  800dad:	41 56                	push   %r14
+  800daf:	41 55                	push   %r13
+  800db1:	41 54                	push   %r12
+  800db3:	53                   	push   %rbx
+  800db4:	48 83 ec 50          	sub    $0x50,%rsp
+  800db8:	49 89 fc             	mov    %rdi,%r12
+  800dbb:	41 89 f5             	mov    %esi,%r13d
+  800dbe:	48 89 d3             	mov    %rdx,%rbx
+  800dc1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800dc5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800dc9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dcd:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800dd4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dd8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800ddc:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800de0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800de4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800deb:	00 00 00 
+  800dee:	4c 8b 30             	mov    (%rax),%r14
+  800df1:	48 b8 11 1f 80 00 00 	movabs $0x801f11,%rax
+  800df8:	00 00 00 
+  800dfb:	ff d0                	call   *%rax
+  800dfd:	89 c6                	mov    %eax,%esi
+  800dff:	45 89 e8             	mov    %r13d,%r8d
+  800e02:	4c 89 e1             	mov    %r12,%rcx
+  800e05:	4c 89 f2             	mov    %r14,%rdx
+  800e08:	48 bf 40 61 80 00 00 	movabs $0x806140,%rdi
+  800e0f:	00 00 00 
+  800e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e17:	49 bc f9 0e 80 00 00 	movabs $0x800ef9,%r12
+  800e1e:	00 00 00 
+  800e21:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800e24:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800e28:	48 89 df             	mov    %rbx,%rdi
+  800e2b:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  800e32:	00 00 00 
+  800e35:	ff d0                	call   *%rax
+    cprintf("\n");
+  800e37:	48 bf 32 60 80 00 00 	movabs $0x806032,%rdi
+  800e3e:	00 00 00 
+  800e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e46:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800e49:	cc                   	int3
+  800e4a:	eb fd                	jmp    800e49 <_panic+0xa0>
+
+0000000000800e4c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800e4c:	55                   	push   %rbp
+  800e4d:	48 89 e5             	mov    %rsp,%rbp
+  800e50:	53                   	push   %rbx
+  800e51:	48 83 ec 08          	sub    $0x8,%rsp
+  800e55:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800e58:	8b 06                	mov    (%rsi),%eax
+  800e5a:	8d 50 01             	lea    0x1(%rax),%edx
+  800e5d:	89 16                	mov    %edx,(%rsi)
+  800e5f:	48 98                	cltq
+  800e61:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800e66:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800e6c:	74 0a                	je     800e78 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800e6e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800e72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e76:	c9                   	leave
+  800e77:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800e78:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800e7c:	be ff 00 00 00       	mov    $0xff,%esi
+  800e81:	48 b8 48 1e 80 00 00 	movabs $0x801e48,%rax
+  800e88:	00 00 00 
+  800e8b:	ff d0                	call   *%rax
+        state->offset = 0;
+  800e8d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800e93:	eb d9                	jmp    800e6e <putch+0x22>
+
+0000000000800e95 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800e95:	55                   	push   %rbp
+  800e96:	48 89 e5             	mov    %rsp,%rbp
+  800e99:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800ea0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800ea3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800eaa:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800eb7:	48 89 f1             	mov    %rsi,%rcx
+  800eba:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800ec1:	48 bf 4c 0e 80 00 00 	movabs $0x800e4c,%rdi
+  800ec8:	00 00 00 
+  800ecb:	48 b8 49 10 80 00 00 	movabs $0x801049,%rax
+  800ed2:	00 00 00 
+  800ed5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800ed7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800ede:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800ee5:	48 b8 48 1e 80 00 00 	movabs $0x801e48,%rax
+  800eec:	00 00 00 
+  800eef:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800ef1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800ef7:	c9                   	leave
+  800ef8:	c3                   	ret
+
+0000000000800ef9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800ef9:	55                   	push   %rbp
+  800efa:	48 89 e5             	mov    %rsp,%rbp
+  800efd:	48 83 ec 50          	sub    $0x50,%rsp
+  800f01:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800f05:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800f09:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f0d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f11:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800f15:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800f1c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f24:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f28:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800f2c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800f30:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  800f37:	00 00 00 
+  800f3a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800f3c:	c9                   	leave
+  800f3d:	c3                   	ret
+
+0000000000800f3e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800f3e:	55                   	push   %rbp
+  800f3f:	48 89 e5             	mov    %rsp,%rbp
+  800f42:	41 57                	push   %r15
+  800f44:	41 56                	push   %r14
+  800f46:	41 55                	push   %r13
+  800f48:	41 54                	push   %r12
+  800f4a:	53                   	push   %rbx
+  800f4b:	48 83 ec 18          	sub    $0x18,%rsp
+  800f4f:	49 89 fc             	mov    %rdi,%r12
+  800f52:	49 89 f5             	mov    %rsi,%r13
+  800f55:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f59:	8b 45 10             	mov    0x10(%rbp),%eax
+  800f5c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800f5f:	41 89 cf             	mov    %ecx,%r15d
+  800f62:	4c 39 fa             	cmp    %r15,%rdx
+  800f65:	73 5b                	jae    800fc2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800f67:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800f6b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800f6f:	85 db                	test   %ebx,%ebx
+  800f71:	7e 0e                	jle    800f81 <print_num+0x43>
+            putch(padc, put_arg);
+  800f73:	4c 89 ee             	mov    %r13,%rsi
+  800f76:	44 89 f7             	mov    %r14d,%edi
+  800f79:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800f7c:	83 eb 01             	sub    $0x1,%ebx
+  800f7f:	75 f2                	jne    800f73 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800f81:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800f85:	48 b9 74 61 80 00 00 	movabs $0x806174,%rcx
+  800f8c:	00 00 00 
+  800f8f:	48 b8 63 61 80 00 00 	movabs $0x806163,%rax
+  800f96:	00 00 00 
+  800f99:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800f9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa6:	49 f7 f7             	div    %r15
+  800fa9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800fad:	4c 89 ee             	mov    %r13,%rsi
+  800fb0:	41 ff d4             	call   *%r12
+}
+  800fb3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fb7:	5b                   	pop    %rbx
+  800fb8:	41 5c                	pop    %r12
+  800fba:	41 5d                	pop    %r13
+  800fbc:	41 5e                	pop    %r14
+  800fbe:	41 5f                	pop    %r15
+  800fc0:	5d                   	pop    %rbp
+  800fc1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800fc2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fcb:	49 f7 f7             	div    %r15
+  800fce:	48 83 ec 08          	sub    $0x8,%rsp
+  800fd2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800fd6:	52                   	push   %rdx
+  800fd7:	45 0f be c9          	movsbl %r9b,%r9d
+  800fdb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800fdf:	48 89 c2             	mov    %rax,%rdx
+  800fe2:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  800fe9:	00 00 00 
+  800fec:	ff d0                	call   *%rax
+  800fee:	48 83 c4 10          	add    $0x10,%rsp
+  800ff2:	eb 8d                	jmp    800f81 <print_num+0x43>
+
+0000000000800ff4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800ff4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800ff8:	48 8b 06             	mov    (%rsi),%rax
+  800ffb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800fff:	73 0a                	jae    80100b <sprintputch+0x17>
+        *state->start++ = ch;
+  801001:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801005:	48 89 16             	mov    %rdx,(%rsi)
+  801008:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80100b:	c3                   	ret
+
+000000000080100c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80100c:	55                   	push   %rbp
+  80100d:	48 89 e5             	mov    %rsp,%rbp
+  801010:	48 83 ec 50          	sub    $0x50,%rsp
+  801014:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801018:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80101c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801020:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801027:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80102b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80102f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801033:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801037:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80103b:	48 b8 49 10 80 00 00 	movabs $0x801049,%rax
+  801042:	00 00 00 
+  801045:	ff d0                	call   *%rax
+}
+  801047:	c9                   	leave
+  801048:	c3                   	ret
+
+0000000000801049 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801049:	55                   	push   %rbp
+  80104a:	48 89 e5             	mov    %rsp,%rbp
+  80104d:	41 57                	push   %r15
+  80104f:	41 56                	push   %r14
+  801051:	41 55                	push   %r13
+  801053:	41 54                	push   %r12
+  801055:	53                   	push   %rbx
+  801056:	48 83 ec 38          	sub    $0x38,%rsp
+  80105a:	49 89 fe             	mov    %rdi,%r14
+  80105d:	49 89 f5             	mov    %rsi,%r13
+  801060:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801063:	48 8b 01             	mov    (%rcx),%rax
+  801066:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80106a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80106e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801072:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801076:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80107a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80107e:	0f b6 3b             	movzbl (%rbx),%edi
+  801081:	40 80 ff 25          	cmp    $0x25,%dil
+  801085:	74 18                	je     80109f <vprintfmt+0x56>
+            if (!ch) return;
+  801087:	40 84 ff             	test   %dil,%dil
+  80108a:	0f 84 04 07 00 00    	je     801794 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  801090:	40 0f b6 ff          	movzbl %dil,%edi
+  801094:	4c 89 ee             	mov    %r13,%rsi
+  801097:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80109a:	4c 89 e3             	mov    %r12,%rbx
+  80109d:	eb db                	jmp    80107a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80109f:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8010a8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8010ad:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8010b3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8010ba:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8010be:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8010c3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8010c8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8010cb:	83 e8 23             	sub    $0x23,%eax
+  8010ce:	3c 57                	cmp    $0x57,%al
+  8010d0:	0f 87 a4 06 00 00    	ja     80177a <vprintfmt+0x731>
+  8010d6:	0f b6 c0             	movzbl %al,%eax
+  8010d9:	48 b9 00 63 80 00 00 	movabs $0x806300,%rcx
+  8010e0:	00 00 00 
+  8010e3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8010e6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8010e9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8010ed:	eb cf                	jmp    8010be <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8010ef:	49 89 dc             	mov    %rbx,%r12
+  8010f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8010f7:	eb c5                	jmp    8010be <vprintfmt+0x75>
+            padc = ch;
+  8010f9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8010fd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801100:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801103:	eb b9                	jmp    8010be <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801105:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801108:	83 f8 2f             	cmp    $0x2f,%eax
+  80110b:	77 24                	ja     801131 <vprintfmt+0xe8>
+  80110d:	89 c1                	mov    %eax,%ecx
+  80110f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801113:	83 c0 08             	add    $0x8,%eax
+  801116:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801119:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80111c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80111f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801123:	79 99                	jns    8010be <vprintfmt+0x75>
+                width = precision;
+  801125:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801129:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80112f:	eb 8d                	jmp    8010be <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801131:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801135:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801139:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80113d:	eb da                	jmp    801119 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80113f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801144:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801148:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80114e:	3c 39                	cmp    $0x39,%al
+  801150:	77 1c                	ja     80116e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801152:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801156:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80115a:	0f b6 c0             	movzbl %al,%eax
+  80115d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801162:	0f b6 03             	movzbl (%rbx),%eax
+  801165:	3c 39                	cmp    $0x39,%al
+  801167:	76 e9                	jbe    801152 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801169:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80116c:	eb b1                	jmp    80111f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80116e:	49 89 dc             	mov    %rbx,%r12
+  801171:	eb ac                	jmp    80111f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801173:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801176:	85 c9                	test   %ecx,%ecx
+  801178:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117d:	0f 49 c1             	cmovns %ecx,%eax
+  801180:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801183:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801186:	e9 33 ff ff ff       	jmp    8010be <vprintfmt+0x75>
+            lflag++;
+  80118b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80118e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801191:	e9 28 ff ff ff       	jmp    8010be <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801196:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801199:	83 f8 2f             	cmp    $0x2f,%eax
+  80119c:	77 19                	ja     8011b7 <vprintfmt+0x16e>
+  80119e:	89 c2                	mov    %eax,%edx
+  8011a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011a4:	83 c0 08             	add    $0x8,%eax
+  8011a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011aa:	8b 3a                	mov    (%rdx),%edi
+  8011ac:	4c 89 ee             	mov    %r13,%rsi
+  8011af:	41 ff d6             	call   *%r14
+            break;
+  8011b2:	e9 c3 fe ff ff       	jmp    80107a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8011b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011c3:	eb e5                	jmp    8011aa <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8011c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8011cb:	77 5a                	ja     801227 <vprintfmt+0x1de>
+  8011cd:	89 c2                	mov    %eax,%edx
+  8011cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011d3:	83 c0 08             	add    $0x8,%eax
+  8011d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8011d9:	8b 02                	mov    (%rdx),%eax
+  8011db:	89 c1                	mov    %eax,%ecx
+  8011dd:	f7 d9                	neg    %ecx
+  8011df:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8011e2:	83 f9 13             	cmp    $0x13,%ecx
+  8011e5:	7f 4e                	jg     801235 <vprintfmt+0x1ec>
+  8011e7:	48 63 c1             	movslq %ecx,%rax
+  8011ea:	48 ba c0 65 80 00 00 	movabs $0x8065c0,%rdx
+  8011f1:	00 00 00 
+  8011f4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8011f8:	48 85 c0             	test   %rax,%rax
+  8011fb:	74 38                	je     801235 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8011fd:	48 89 c1             	mov    %rax,%rcx
+  801200:	48 ba aa 67 80 00 00 	movabs $0x8067aa,%rdx
+  801207:	00 00 00 
+  80120a:	4c 89 ee             	mov    %r13,%rsi
+  80120d:	4c 89 f7             	mov    %r14,%rdi
+  801210:	b8 00 00 00 00       	mov    $0x0,%eax
+  801215:	49 b8 0c 10 80 00 00 	movabs $0x80100c,%r8
+  80121c:	00 00 00 
+  80121f:	41 ff d0             	call   *%r8
+  801222:	e9 53 fe ff ff       	jmp    80107a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801227:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80122b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80122f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801233:	eb a4                	jmp    8011d9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801235:	48 ba 8c 61 80 00 00 	movabs $0x80618c,%rdx
+  80123c:	00 00 00 
+  80123f:	4c 89 ee             	mov    %r13,%rsi
+  801242:	4c 89 f7             	mov    %r14,%rdi
+  801245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124a:	49 b8 0c 10 80 00 00 	movabs $0x80100c,%r8
+  801251:	00 00 00 
+  801254:	41 ff d0             	call   *%r8
+  801257:	e9 1e fe ff ff       	jmp    80107a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80125c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80125f:	83 f8 2f             	cmp    $0x2f,%eax
+  801262:	77 36                	ja     80129a <vprintfmt+0x251>
+  801264:	89 c2                	mov    %eax,%edx
+  801266:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80126a:	83 c0 08             	add    $0x8,%eax
+  80126d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801270:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801273:	48 85 f6             	test   %rsi,%rsi
+  801276:	48 b8 85 61 80 00 00 	movabs $0x806185,%rax
+  80127d:	00 00 00 
+  801280:	48 0f 45 c6          	cmovne %rsi,%rax
+  801284:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801288:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80128c:	7e 06                	jle    801294 <vprintfmt+0x24b>
+  80128e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801292:	75 14                	jne    8012a8 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801294:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801298:	eb 5b                	jmp    8012f5 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80129a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80129e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012a6:	eb c8                	jmp    801270 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8012a8:	49 63 f7             	movslq %r15d,%rsi
+  8012ab:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8012af:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  8012b6:	00 00 00 
+  8012b9:	ff d0                	call   *%rax
+  8012bb:	48 89 c2             	mov    %rax,%rdx
+  8012be:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8012c1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8012c3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8012c6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8012c9:	85 c0                	test   %eax,%eax
+  8012cb:	7e c7                	jle    801294 <vprintfmt+0x24b>
+  8012cd:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8012d2:	4c 89 ee             	mov    %r13,%rsi
+  8012d5:	44 89 e7             	mov    %r12d,%edi
+  8012d8:	41 ff d6             	call   *%r14
+  8012db:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8012df:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8012e2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8012e5:	75 eb                	jne    8012d2 <vprintfmt+0x289>
+  8012e7:	eb ab                	jmp    801294 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8012e9:	0f b6 f8             	movzbl %al,%edi
+  8012ec:	4c 89 ee             	mov    %r13,%rsi
+  8012ef:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8012f2:	4c 89 e2             	mov    %r12,%rdx
+  8012f5:	45 85 ff             	test   %r15d,%r15d
+  8012f8:	78 06                	js     801300 <vprintfmt+0x2b7>
+  8012fa:	41 83 ef 01          	sub    $0x1,%r15d
+  8012fe:	78 23                	js     801323 <vprintfmt+0x2da>
+  801300:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  801304:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80130a:	84 c0                	test   %al,%al
+  80130c:	74 15                	je     801323 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80130e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801312:	74 d5                	je     8012e9 <vprintfmt+0x2a0>
+  801314:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801317:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80131c:	80 fa 5e             	cmp    $0x5e,%dl
+  80131f:	77 cb                	ja     8012ec <vprintfmt+0x2a3>
+  801321:	eb c6                	jmp    8012e9 <vprintfmt+0x2a0>
+  801323:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801326:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  801329:	01 f0                	add    %esi,%eax
+  80132b:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80132d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801331:	85 c0                	test   %eax,%eax
+  801333:	0f 8e 41 fd ff ff    	jle    80107a <vprintfmt+0x31>
+  801339:	4c 89 ee             	mov    %r13,%rsi
+  80133c:	bf 20 00 00 00       	mov    $0x20,%edi
+  801341:	41 ff d6             	call   *%r14
+  801344:	41 83 ec 01          	sub    $0x1,%r12d
+  801348:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80134c:	75 eb                	jne    801339 <vprintfmt+0x2f0>
+  80134e:	e9 27 fd ff ff       	jmp    80107a <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  801353:	40 84 f6             	test   %sil,%sil
+  801356:	75 26                	jne    80137e <vprintfmt+0x335>
+    switch (lflag) {
+  801358:	85 d2                	test   %edx,%edx
+  80135a:	74 59                	je     8013b5 <vprintfmt+0x36c>
+  80135c:	83 fa 01             	cmp    $0x1,%edx
+  80135f:	74 7b                	je     8013dc <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  801361:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801364:	83 f8 2f             	cmp    $0x2f,%eax
+  801367:	0f 87 96 00 00 00    	ja     801403 <vprintfmt+0x3ba>
+  80136d:	89 c2                	mov    %eax,%edx
+  80136f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801373:	83 c0 08             	add    $0x8,%eax
+  801376:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801379:	4c 8b 22             	mov    (%rdx),%r12
+  80137c:	eb 17                	jmp    801395 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80137e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801381:	83 f8 2f             	cmp    $0x2f,%eax
+  801384:	77 21                	ja     8013a7 <vprintfmt+0x35e>
+  801386:	89 c2                	mov    %eax,%edx
+  801388:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80138c:	83 c0 08             	add    $0x8,%eax
+  80138f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801392:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801395:	4d 85 e4             	test   %r12,%r12
+  801398:	78 7a                	js     801414 <vprintfmt+0x3cb>
+            num = i;
+  80139a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80139d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8013a2:	e9 b5 02 00 00       	jmp    80165c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8013a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013b3:	eb dd                	jmp    801392 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8013b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8013bb:	77 11                	ja     8013ce <vprintfmt+0x385>
+  8013bd:	89 c2                	mov    %eax,%edx
+  8013bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013c3:	83 c0 08             	add    $0x8,%eax
+  8013c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013c9:	4c 63 22             	movslq (%rdx),%r12
+  8013cc:	eb c7                	jmp    801395 <vprintfmt+0x34c>
+  8013ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013da:	eb ed                	jmp    8013c9 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8013dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013df:	83 f8 2f             	cmp    $0x2f,%eax
+  8013e2:	77 11                	ja     8013f5 <vprintfmt+0x3ac>
+  8013e4:	89 c2                	mov    %eax,%edx
+  8013e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013ea:	83 c0 08             	add    $0x8,%eax
+  8013ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013f0:	4c 8b 22             	mov    (%rdx),%r12
+  8013f3:	eb a0                	jmp    801395 <vprintfmt+0x34c>
+  8013f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801401:	eb ed                	jmp    8013f0 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  801403:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801407:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80140b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80140f:	e9 65 ff ff ff       	jmp    801379 <vprintfmt+0x330>
+                putch('-', put_arg);
+  801414:	4c 89 ee             	mov    %r13,%rsi
+  801417:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80141c:	41 ff d6             	call   *%r14
+                i = -i;
+  80141f:	49 f7 dc             	neg    %r12
+  801422:	e9 73 ff ff ff       	jmp    80139a <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  801427:	40 84 f6             	test   %sil,%sil
+  80142a:	75 32                	jne    80145e <vprintfmt+0x415>
+    switch (lflag) {
+  80142c:	85 d2                	test   %edx,%edx
+  80142e:	74 5d                	je     80148d <vprintfmt+0x444>
+  801430:	83 fa 01             	cmp    $0x1,%edx
+  801433:	0f 84 82 00 00 00    	je     8014bb <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  801439:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80143c:	83 f8 2f             	cmp    $0x2f,%eax
+  80143f:	0f 87 a5 00 00 00    	ja     8014ea <vprintfmt+0x4a1>
+  801445:	89 c2                	mov    %eax,%edx
+  801447:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80144b:	83 c0 08             	add    $0x8,%eax
+  80144e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801451:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801454:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801459:	e9 fe 01 00 00       	jmp    80165c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80145e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801461:	83 f8 2f             	cmp    $0x2f,%eax
+  801464:	77 19                	ja     80147f <vprintfmt+0x436>
+  801466:	89 c2                	mov    %eax,%edx
+  801468:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80146c:	83 c0 08             	add    $0x8,%eax
+  80146f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801472:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801475:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80147a:	e9 dd 01 00 00       	jmp    80165c <vprintfmt+0x613>
+  80147f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801483:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801487:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80148b:	eb e5                	jmp    801472 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80148d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801490:	83 f8 2f             	cmp    $0x2f,%eax
+  801493:	77 18                	ja     8014ad <vprintfmt+0x464>
+  801495:	89 c2                	mov    %eax,%edx
+  801497:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80149b:	83 c0 08             	add    $0x8,%eax
+  80149e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014a1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8014a3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8014a8:	e9 af 01 00 00       	jmp    80165c <vprintfmt+0x613>
+  8014ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014b9:	eb e6                	jmp    8014a1 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8014bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014be:	83 f8 2f             	cmp    $0x2f,%eax
+  8014c1:	77 19                	ja     8014dc <vprintfmt+0x493>
+  8014c3:	89 c2                	mov    %eax,%edx
+  8014c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014c9:	83 c0 08             	add    $0x8,%eax
+  8014cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014cf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8014d2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8014d7:	e9 80 01 00 00       	jmp    80165c <vprintfmt+0x613>
+  8014dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014e8:	eb e5                	jmp    8014cf <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8014ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014f6:	e9 56 ff ff ff       	jmp    801451 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8014fb:	40 84 f6             	test   %sil,%sil
+  8014fe:	75 2e                	jne    80152e <vprintfmt+0x4e5>
+    switch (lflag) {
+  801500:	85 d2                	test   %edx,%edx
+  801502:	0f 84 b3 00 00 00    	je     8015bb <vprintfmt+0x572>
+  801508:	83 fa 01             	cmp    $0x1,%edx
+  80150b:	0f 84 d3 00 00 00    	je     8015e4 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  801511:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801514:	83 f8 2f             	cmp    $0x2f,%eax
+  801517:	0f 87 f1 00 00 00    	ja     80160e <vprintfmt+0x5c5>
+  80151d:	89 c2                	mov    %eax,%edx
+  80151f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801523:	83 c0 08             	add    $0x8,%eax
+  801526:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801529:	48 8b 02             	mov    (%rdx),%rax
+  80152c:	eb 17                	jmp    801545 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  80152e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801531:	83 f8 2f             	cmp    $0x2f,%eax
+  801534:	77 77                	ja     8015ad <vprintfmt+0x564>
+  801536:	89 c2                	mov    %eax,%edx
+  801538:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80153c:	83 c0 08             	add    $0x8,%eax
+  80153f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801542:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  801545:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  801547:	83 f8 07             	cmp    $0x7,%eax
+  80154a:	0f 8e cf 00 00 00    	jle    80161f <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  801550:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  801556:	44 89 e7             	mov    %r12d,%edi
+  801559:	41 c1 e4 03          	shl    $0x3,%r12d
+  80155d:	89 d1                	mov    %edx,%ecx
+  80155f:	8d 72 07             	lea    0x7(%rdx),%esi
+  801562:	85 d2                	test   %edx,%edx
+  801564:	0f 48 d6             	cmovs  %esi,%edx
+  801567:	c1 fa 03             	sar    $0x3,%edx
+  80156a:	83 f9 3f             	cmp    $0x3f,%ecx
+  80156d:	7f e7                	jg     801556 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80156f:	85 ff                	test   %edi,%edi
+  801571:	0f 84 03 fb ff ff    	je     80107a <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  801577:	49 63 f4             	movslq %r12d,%rsi
+  80157a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80157f:	48 f7 f6             	div    %rsi
+  801582:	49 89 d7             	mov    %rdx,%r15
+  801585:	83 c0 30             	add    $0x30,%eax
+  801588:	0f be f8             	movsbl %al,%edi
+  80158b:	4c 89 ee             	mov    %r13,%rsi
+  80158e:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  801591:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  801594:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  801599:	45 85 e4             	test   %r12d,%r12d
+  80159c:	41 0f 49 d4          	cmovns %r12d,%edx
+  8015a0:	c1 fa 03             	sar    $0x3,%edx
+  8015a3:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  8015a6:	75 cf                	jne    801577 <vprintfmt+0x52e>
+  8015a8:	e9 cd fa ff ff       	jmp    80107a <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8015ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015b9:	eb 87                	jmp    801542 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  8015bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015be:	83 f8 2f             	cmp    $0x2f,%eax
+  8015c1:	77 13                	ja     8015d6 <vprintfmt+0x58d>
+  8015c3:	89 c2                	mov    %eax,%edx
+  8015c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015c9:	83 c0 08             	add    $0x8,%eax
+  8015cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015cf:	8b 02                	mov    (%rdx),%eax
+  8015d1:	e9 6f ff ff ff       	jmp    801545 <vprintfmt+0x4fc>
+  8015d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015e2:	eb eb                	jmp    8015cf <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8015e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8015ea:	77 14                	ja     801600 <vprintfmt+0x5b7>
+  8015ec:	89 c2                	mov    %eax,%edx
+  8015ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015f2:	83 c0 08             	add    $0x8,%eax
+  8015f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015f8:	48 8b 02             	mov    (%rdx),%rax
+  8015fb:	e9 45 ff ff ff       	jmp    801545 <vprintfmt+0x4fc>
+  801600:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801604:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801608:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80160c:	eb ea                	jmp    8015f8 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  80160e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801612:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801616:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80161a:	e9 0a ff ff ff       	jmp    801529 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  80161f:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  801625:	e9 4d ff ff ff       	jmp    801577 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  80162a:	4c 89 ee             	mov    %r13,%rsi
+  80162d:	bf 30 00 00 00       	mov    $0x30,%edi
+  801632:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801635:	4c 89 ee             	mov    %r13,%rsi
+  801638:	bf 78 00 00 00       	mov    $0x78,%edi
+  80163d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801640:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801643:	83 f8 2f             	cmp    $0x2f,%eax
+  801646:	77 47                	ja     80168f <vprintfmt+0x646>
+  801648:	89 c2                	mov    %eax,%edx
+  80164a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80164e:	83 c0 08             	add    $0x8,%eax
+  801651:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801654:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801657:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80165c:	48 83 ec 08          	sub    $0x8,%rsp
+  801660:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801664:	0f 94 c0             	sete   %al
+  801667:	0f b6 c0             	movzbl %al,%eax
+  80166a:	50                   	push   %rax
+  80166b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801670:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801674:	4c 89 ee             	mov    %r13,%rsi
+  801677:	4c 89 f7             	mov    %r14,%rdi
+  80167a:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  801681:	00 00 00 
+  801684:	ff d0                	call   *%rax
+            break;
+  801686:	48 83 c4 10          	add    $0x10,%rsp
+  80168a:	e9 eb f9 ff ff       	jmp    80107a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80168f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801693:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801697:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80169b:	eb b7                	jmp    801654 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  80169d:	40 84 f6             	test   %sil,%sil
+  8016a0:	75 2b                	jne    8016cd <vprintfmt+0x684>
+    switch (lflag) {
+  8016a2:	85 d2                	test   %edx,%edx
+  8016a4:	74 56                	je     8016fc <vprintfmt+0x6b3>
+  8016a6:	83 fa 01             	cmp    $0x1,%edx
+  8016a9:	74 7f                	je     80172a <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  8016ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8016b1:	0f 87 a2 00 00 00    	ja     801759 <vprintfmt+0x710>
+  8016b7:	89 c2                	mov    %eax,%edx
+  8016b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016bd:	83 c0 08             	add    $0x8,%eax
+  8016c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016c3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8016c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8016cb:	eb 8f                	jmp    80165c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8016cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8016d3:	77 19                	ja     8016ee <vprintfmt+0x6a5>
+  8016d5:	89 c2                	mov    %eax,%edx
+  8016d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016db:	83 c0 08             	add    $0x8,%eax
+  8016de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016e1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8016e4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8016e9:	e9 6e ff ff ff       	jmp    80165c <vprintfmt+0x613>
+  8016ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016fa:	eb e5                	jmp    8016e1 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8016fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016ff:	83 f8 2f             	cmp    $0x2f,%eax
+  801702:	77 18                	ja     80171c <vprintfmt+0x6d3>
+  801704:	89 c2                	mov    %eax,%edx
+  801706:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80170a:	83 c0 08             	add    $0x8,%eax
+  80170d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801710:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801712:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801717:	e9 40 ff ff ff       	jmp    80165c <vprintfmt+0x613>
+  80171c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801720:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801724:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801728:	eb e6                	jmp    801710 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  80172a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80172d:	83 f8 2f             	cmp    $0x2f,%eax
+  801730:	77 19                	ja     80174b <vprintfmt+0x702>
+  801732:	89 c2                	mov    %eax,%edx
+  801734:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801738:	83 c0 08             	add    $0x8,%eax
+  80173b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80173e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801741:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801746:	e9 11 ff ff ff       	jmp    80165c <vprintfmt+0x613>
+  80174b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80174f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801753:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801757:	eb e5                	jmp    80173e <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  801759:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80175d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801761:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801765:	e9 59 ff ff ff       	jmp    8016c3 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  80176a:	4c 89 ee             	mov    %r13,%rsi
+  80176d:	bf 25 00 00 00       	mov    $0x25,%edi
+  801772:	41 ff d6             	call   *%r14
+            break;
+  801775:	e9 00 f9 ff ff       	jmp    80107a <vprintfmt+0x31>
+            putch('%', put_arg);
+  80177a:	4c 89 ee             	mov    %r13,%rsi
+  80177d:	bf 25 00 00 00       	mov    $0x25,%edi
+  801782:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801785:	48 83 eb 01          	sub    $0x1,%rbx
+  801789:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80178d:	75 f6                	jne    801785 <vprintfmt+0x73c>
+  80178f:	e9 e6 f8 ff ff       	jmp    80107a <vprintfmt+0x31>
+}
+  801794:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801798:	5b                   	pop    %rbx
+  801799:	41 5c                	pop    %r12
+  80179b:	41 5d                	pop    %r13
+  80179d:	41 5e                	pop    %r14
+  80179f:	41 5f                	pop    %r15
+  8017a1:	5d                   	pop    %rbp
+  8017a2:	c3                   	ret
+
+00000000008017a3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8017a3:	55                   	push   %rbp
+  8017a4:	48 89 e5             	mov    %rsp,%rbp
+  8017a7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8017ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017af:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8017b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8017b8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8017bf:	48 85 ff             	test   %rdi,%rdi
+  8017c2:	74 2b                	je     8017ef <vsnprintf+0x4c>
+  8017c4:	48 85 f6             	test   %rsi,%rsi
+  8017c7:	74 26                	je     8017ef <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8017c9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8017cd:	48 bf f4 0f 80 00 00 	movabs $0x800ff4,%rdi
+  8017d4:	00 00 00 
+  8017d7:	48 b8 49 10 80 00 00 	movabs $0x801049,%rax
+  8017de:	00 00 00 
+  8017e1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8017e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017e7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8017ea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8017ed:	c9                   	leave
+  8017ee:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8017ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f4:	eb f7                	jmp    8017ed <vsnprintf+0x4a>
+
+00000000008017f6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8017f6:	55                   	push   %rbp
+  8017f7:	48 89 e5             	mov    %rsp,%rbp
+  8017fa:	48 83 ec 50          	sub    $0x50,%rsp
+  8017fe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801802:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801806:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80180a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801811:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801815:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801819:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80181d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801821:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801825:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  80182c:	00 00 00 
+  80182f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801831:	c9                   	leave
+  801832:	c3                   	ret
+
+0000000000801833 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801833:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801836:	74 10                	je     801848 <strlen+0x15>
+    size_t n = 0;
+  801838:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80183d:	48 83 c0 01          	add    $0x1,%rax
+  801841:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801845:	75 f6                	jne    80183d <strlen+0xa>
+  801847:	c3                   	ret
+    size_t n = 0;
+  801848:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80184d:	c3                   	ret
+
+000000000080184e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80184e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801851:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801856:	48 85 f6             	test   %rsi,%rsi
+  801859:	74 11                	je     80186c <strnlen+0x1e>
+  80185b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80185f:	74 0c                	je     80186d <strnlen+0x1f>
+  801861:	48 83 c2 01          	add    $0x1,%rdx
+  801865:	48 39 d0             	cmp    %rdx,%rax
+  801868:	75 f1                	jne    80185b <strnlen+0xd>
+  80186a:	eb 04                	jmp    801870 <strnlen+0x22>
+  80186c:	c3                   	ret
+  80186d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801870:	c3                   	ret
+
+0000000000801871 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801871:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801874:	ba 00 00 00 00       	mov    $0x0,%edx
+  801879:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80187d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801880:	48 83 c2 01          	add    $0x1,%rdx
+  801884:	84 c9                	test   %cl,%cl
+  801886:	75 f1                	jne    801879 <strcpy+0x8>
+        ;
+    return res;
+}
+  801888:	c3                   	ret
+
+0000000000801889 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801889:	55                   	push   %rbp
+  80188a:	48 89 e5             	mov    %rsp,%rbp
+  80188d:	41 54                	push   %r12
+  80188f:	53                   	push   %rbx
+  801890:	48 89 fb             	mov    %rdi,%rbx
+  801893:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801896:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  80189d:	00 00 00 
+  8018a0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8018a2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8018a6:	4c 89 e6             	mov    %r12,%rsi
+  8018a9:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  8018b0:	00 00 00 
+  8018b3:	ff d0                	call   *%rax
+    return dst;
+}
+  8018b5:	48 89 d8             	mov    %rbx,%rax
+  8018b8:	5b                   	pop    %rbx
+  8018b9:	41 5c                	pop    %r12
+  8018bb:	5d                   	pop    %rbp
+  8018bc:	c3                   	ret
+
+00000000008018bd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8018bd:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8018c0:	48 85 d2             	test   %rdx,%rdx
+  8018c3:	74 1f                	je     8018e4 <strncpy+0x27>
+  8018c5:	48 01 fa             	add    %rdi,%rdx
+  8018c8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8018cb:	48 83 c1 01          	add    $0x1,%rcx
+  8018cf:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8018d3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8018d7:	41 80 f8 01          	cmp    $0x1,%r8b
+  8018db:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8018df:	48 39 ca             	cmp    %rcx,%rdx
+  8018e2:	75 e7                	jne    8018cb <strncpy+0xe>
+    }
+    return ret;
+}
+  8018e4:	c3                   	ret
+
+00000000008018e5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8018e5:	48 89 f8             	mov    %rdi,%rax
+  8018e8:	48 85 d2             	test   %rdx,%rdx
+  8018eb:	74 24                	je     801911 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8018ed:	48 83 ea 01          	sub    $0x1,%rdx
+  8018f1:	74 1b                	je     80190e <strlcpy+0x29>
+  8018f3:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8018f7:	0f b6 16             	movzbl (%rsi),%edx
+  8018fa:	84 d2                	test   %dl,%dl
+  8018fc:	74 10                	je     80190e <strlcpy+0x29>
+            *dst++ = *src++;
+  8018fe:	48 83 c6 01          	add    $0x1,%rsi
+  801902:	48 83 c0 01          	add    $0x1,%rax
+  801906:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801909:	48 39 c8             	cmp    %rcx,%rax
+  80190c:	75 e9                	jne    8018f7 <strlcpy+0x12>
+        *dst = '\0';
+  80190e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801911:	48 29 f8             	sub    %rdi,%rax
+}
+  801914:	c3                   	ret
+
+0000000000801915 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801915:	0f b6 07             	movzbl (%rdi),%eax
+  801918:	84 c0                	test   %al,%al
+  80191a:	74 13                	je     80192f <strcmp+0x1a>
+  80191c:	38 06                	cmp    %al,(%rsi)
+  80191e:	75 0f                	jne    80192f <strcmp+0x1a>
+  801920:	48 83 c7 01          	add    $0x1,%rdi
+  801924:	48 83 c6 01          	add    $0x1,%rsi
+  801928:	0f b6 07             	movzbl (%rdi),%eax
+  80192b:	84 c0                	test   %al,%al
+  80192d:	75 ed                	jne    80191c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80192f:	0f b6 c0             	movzbl %al,%eax
+  801932:	0f b6 16             	movzbl (%rsi),%edx
+  801935:	29 d0                	sub    %edx,%eax
+}
+  801937:	c3                   	ret
+
+0000000000801938 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801938:	48 85 d2             	test   %rdx,%rdx
+  80193b:	74 1f                	je     80195c <strncmp+0x24>
+  80193d:	0f b6 07             	movzbl (%rdi),%eax
+  801940:	84 c0                	test   %al,%al
+  801942:	74 1e                	je     801962 <strncmp+0x2a>
+  801944:	3a 06                	cmp    (%rsi),%al
+  801946:	75 1a                	jne    801962 <strncmp+0x2a>
+  801948:	48 83 c7 01          	add    $0x1,%rdi
+  80194c:	48 83 c6 01          	add    $0x1,%rsi
+  801950:	48 83 ea 01          	sub    $0x1,%rdx
+  801954:	75 e7                	jne    80193d <strncmp+0x5>
+
+    if (!n) return 0;
+  801956:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195b:	c3                   	ret
+  80195c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801961:	c3                   	ret
+  801962:	48 85 d2             	test   %rdx,%rdx
+  801965:	74 09                	je     801970 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801967:	0f b6 07             	movzbl (%rdi),%eax
+  80196a:	0f b6 16             	movzbl (%rsi),%edx
+  80196d:	29 d0                	sub    %edx,%eax
+  80196f:	c3                   	ret
+    if (!n) return 0;
+  801970:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801975:	c3                   	ret
+
+0000000000801976 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801976:	0f b6 17             	movzbl (%rdi),%edx
+  801979:	84 d2                	test   %dl,%dl
+  80197b:	74 18                	je     801995 <strchr+0x1f>
+        if (*str == c) {
+  80197d:	0f be d2             	movsbl %dl,%edx
+  801980:	39 f2                	cmp    %esi,%edx
+  801982:	74 17                	je     80199b <strchr+0x25>
+    for (; *str; str++) {
+  801984:	48 83 c7 01          	add    $0x1,%rdi
+  801988:	0f b6 17             	movzbl (%rdi),%edx
+  80198b:	84 d2                	test   %dl,%dl
+  80198d:	75 ee                	jne    80197d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80198f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801994:	c3                   	ret
+  801995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199a:	c3                   	ret
+  80199b:	48 89 f8             	mov    %rdi,%rax
+}
+  80199e:	c3                   	ret
+
+000000000080199f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80199f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8019a2:	0f b6 17             	movzbl (%rdi),%edx
+  8019a5:	84 d2                	test   %dl,%dl
+  8019a7:	74 13                	je     8019bc <strfind+0x1d>
+  8019a9:	0f be d2             	movsbl %dl,%edx
+  8019ac:	39 f2                	cmp    %esi,%edx
+  8019ae:	74 0b                	je     8019bb <strfind+0x1c>
+  8019b0:	48 83 c0 01          	add    $0x1,%rax
+  8019b4:	0f b6 10             	movzbl (%rax),%edx
+  8019b7:	84 d2                	test   %dl,%dl
+  8019b9:	75 ee                	jne    8019a9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8019bb:	c3                   	ret
+  8019bc:	c3                   	ret
+
+00000000008019bd <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  8019bd:	55                   	push   %rbp
+  8019be:	48 89 e5             	mov    %rsp,%rbp
+  8019c1:	41 57                	push   %r15
+  8019c3:	41 56                	push   %r14
+  8019c5:	41 55                	push   %r13
+  8019c7:	41 54                	push   %r12
+  8019c9:	53                   	push   %rbx
+  8019ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8019ce:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  8019d1:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  8019d5:	45 84 ed             	test   %r13b,%r13b
+  8019d8:	75 12                	jne    8019ec <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  8019da:	4c 89 f8             	mov    %r15,%rax
+  8019dd:	48 83 c4 08          	add    $0x8,%rsp
+  8019e1:	5b                   	pop    %rbx
+  8019e2:	41 5c                	pop    %r12
+  8019e4:	41 5d                	pop    %r13
+  8019e6:	41 5e                	pop    %r14
+  8019e8:	41 5f                	pop    %r15
+  8019ea:	5d                   	pop    %rbp
+  8019eb:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  8019ec:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  8019f0:	4c 89 e7             	mov    %r12,%rdi
+  8019f3:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  8019fa:	00 00 00 
+  8019fd:	ff d0                	call   *%rax
+  8019ff:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  801a02:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  801a06:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  801a0a:	49 bf 38 19 80 00 00 	movabs $0x801938,%r15
+  801a11:	00 00 00 
+				if ((sc = *s++) == 0)
+  801a14:	84 c0                	test   %al,%al
+  801a16:	75 14                	jne    801a2c <strstr+0x6f>
+					return NULL;
+  801a18:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801a1e:	eb ba                	jmp    8019da <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  801a20:	48 83 c3 01          	add    $0x1,%rbx
+  801a24:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  801a28:	84 c0                	test   %al,%al
+  801a2a:	74 1b                	je     801a47 <strstr+0x8a>
+			} while (sc != c);
+  801a2c:	41 38 c5             	cmp    %al,%r13b
+  801a2f:	75 ef                	jne    801a20 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  801a31:	4c 89 f2             	mov    %r14,%rdx
+  801a34:	4c 89 e6             	mov    %r12,%rsi
+  801a37:	48 89 df             	mov    %rbx,%rdi
+  801a3a:	41 ff d7             	call   *%r15
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	75 df                	jne    801a20 <strstr+0x63>
+  801a41:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  801a45:	eb 93                	jmp    8019da <strstr+0x1d>
+					return NULL;
+  801a47:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801a4d:	eb 8b                	jmp    8019da <strstr+0x1d>
+
+0000000000801a4f <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  801a4f:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  801a51:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  801a54:	8d 57 20             	lea    0x20(%rdi),%edx
+  801a57:	83 f9 1a             	cmp    $0x1a,%ecx
+  801a5a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801a5d:	c3                   	ret
+
+0000000000801a5e <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  801a5e:	55                   	push   %rbp
+  801a5f:	48 89 e5             	mov    %rsp,%rbp
+  801a62:	41 57                	push   %r15
+  801a64:	41 56                	push   %r14
+  801a66:	41 55                	push   %r13
+  801a68:	41 54                	push   %r12
+  801a6a:	53                   	push   %rbx
+  801a6b:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  801a6f:	48 39 f7             	cmp    %rsi,%rdi
+  801a72:	74 49                	je     801abd <strcasecmp+0x5f>
+  801a74:	49 89 fd             	mov    %rdi,%r13
+  801a77:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  801a7a:	49 bf 4f 1a 80 00 00 	movabs $0x801a4f,%r15
+  801a81:	00 00 00 
+  801a84:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801a89:	41 0f b6 fe          	movzbl %r14b,%edi
+  801a8d:	41 ff d7             	call   *%r15
+  801a90:	89 c3                	mov    %eax,%ebx
+  801a92:	49 83 c4 01          	add    $0x1,%r12
+  801a96:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801a9c:	41 ff d7             	call   *%r15
+  801a9f:	29 c3                	sub    %eax,%ebx
+  801aa1:	75 09                	jne    801aac <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  801aa3:	49 83 c5 01          	add    $0x1,%r13
+  801aa7:	45 84 f6             	test   %r14b,%r14b
+  801aaa:	75 d8                	jne    801a84 <strcasecmp+0x26>
+}
+  801aac:	89 d8                	mov    %ebx,%eax
+  801aae:	48 83 c4 08          	add    $0x8,%rsp
+  801ab2:	5b                   	pop    %rbx
+  801ab3:	41 5c                	pop    %r12
+  801ab5:	41 5d                	pop    %r13
+  801ab7:	41 5e                	pop    %r14
+  801ab9:	41 5f                	pop    %r15
+  801abb:	5d                   	pop    %rbp
+  801abc:	c3                   	ret
+        return 0;
+  801abd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac2:	eb e8                	jmp    801aac <strcasecmp+0x4e>
+
+0000000000801ac4 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  801ac4:	55                   	push   %rbp
+  801ac5:	48 89 e5             	mov    %rsp,%rbp
+  801ac8:	41 57                	push   %r15
+  801aca:	41 56                	push   %r14
+  801acc:	41 55                	push   %r13
+  801ace:	41 54                	push   %r12
+  801ad0:	53                   	push   %rbx
+  801ad1:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  801ad5:	48 85 d2             	test   %rdx,%rdx
+  801ad8:	74 4f                	je     801b29 <strncasecmp+0x65>
+  801ada:	49 89 fc             	mov    %rdi,%r12
+  801add:	49 89 f5             	mov    %rsi,%r13
+  801ae0:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  801ae4:	49 be 4f 1a 80 00 00 	movabs $0x801a4f,%r14
+  801aeb:	00 00 00 
+  801aee:	49 83 c4 01          	add    $0x1,%r12
+  801af2:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801af8:	41 ff d6             	call   *%r14
+  801afb:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  801afd:	49 83 c5 01          	add    $0x1,%r13
+  801b01:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801b06:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801b09:	29 c3                	sub    %eax,%ebx
+  801b0b:	85 c0                	test   %eax,%eax
+  801b0d:	74 09                	je     801b18 <strncasecmp+0x54>
+  801b0f:	85 db                	test   %ebx,%ebx
+  801b11:	75 05                	jne    801b18 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  801b13:	4d 39 fc             	cmp    %r15,%r12
+  801b16:	75 d6                	jne    801aee <strncasecmp+0x2a>
+}
+  801b18:	89 d8                	mov    %ebx,%eax
+  801b1a:	48 83 c4 08          	add    $0x8,%rsp
+  801b1e:	5b                   	pop    %rbx
+  801b1f:	41 5c                	pop    %r12
+  801b21:	41 5d                	pop    %r13
+  801b23:	41 5e                	pop    %r14
+  801b25:	41 5f                	pop    %r15
+  801b27:	5d                   	pop    %rbp
+  801b28:	c3                   	ret
+    int d = 0;
+  801b29:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  801b2e:	eb e8                	jmp    801b18 <strncasecmp+0x54>
+
+0000000000801b30 <toupper>:
+
+int toupper(int c) {
+  801b30:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  801b32:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801b35:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801b38:	83 f9 1a             	cmp    $0x1a,%ecx
+  801b3b:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801b3e:	c3                   	ret
+
+0000000000801b3f <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  801b3f:	83 ff 20             	cmp    $0x20,%edi
+  801b42:	0f 94 c0             	sete   %al
+  801b45:	0f b6 c0             	movzbl %al,%eax
+}
+  801b48:	c3                   	ret
+
+0000000000801b49 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  801b49:	89 f8                	mov    %edi,%eax
+  801b4b:	f7 d8                	neg    %eax
+  801b4d:	0f 48 c7             	cmovs  %edi,%eax
+}
+  801b50:	c3                   	ret
+
+0000000000801b51 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801b51:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801b54:	48 89 f8             	mov    %rdi,%rax
+  801b57:	48 f7 d8             	neg    %rax
+  801b5a:	83 e0 07             	and    $0x7,%eax
+  801b5d:	49 89 d1             	mov    %rdx,%r9
+  801b60:	49 29 c1             	sub    %rax,%r9
+  801b63:	78 36                	js     801b9b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801b65:	40 0f b6 c6          	movzbl %sil,%eax
+  801b69:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801b70:	01 01 01 
+  801b73:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801b77:	40 f6 c7 07          	test   $0x7,%dil
+  801b7b:	75 38                	jne    801bb5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801b7d:	4c 89 c9             	mov    %r9,%rcx
+  801b80:	48 c1 f9 03          	sar    $0x3,%rcx
+  801b84:	74 0c                	je     801b92 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801b86:	fc                   	cld
+  801b87:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801b8a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801b8e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801b92:	4d 85 c9             	test   %r9,%r9
+  801b95:	75 45                	jne    801bdc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801b97:	4c 89 c0             	mov    %r8,%rax
+  801b9a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801b9b:	48 85 d2             	test   %rdx,%rdx
+  801b9e:	74 f7                	je     801b97 <memset+0x46>
+  801ba0:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801ba3:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801ba6:	48 83 c0 01          	add    $0x1,%rax
+  801baa:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801bae:	48 39 c2             	cmp    %rax,%rdx
+  801bb1:	75 f3                	jne    801ba6 <memset+0x55>
+  801bb3:	eb e2                	jmp    801b97 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801bb5:	40 f6 c7 01          	test   $0x1,%dil
+  801bb9:	74 06                	je     801bc1 <memset+0x70>
+  801bbb:	88 07                	mov    %al,(%rdi)
+  801bbd:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801bc1:	40 f6 c7 02          	test   $0x2,%dil
+  801bc5:	74 07                	je     801bce <memset+0x7d>
+  801bc7:	66 89 07             	mov    %ax,(%rdi)
+  801bca:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801bce:	40 f6 c7 04          	test   $0x4,%dil
+  801bd2:	74 a9                	je     801b7d <memset+0x2c>
+  801bd4:	89 07                	mov    %eax,(%rdi)
+  801bd6:	48 83 c7 04          	add    $0x4,%rdi
+  801bda:	eb a1                	jmp    801b7d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801bdc:	41 f6 c1 04          	test   $0x4,%r9b
+  801be0:	74 06                	je     801be8 <memset+0x97>
+  801be2:	89 07                	mov    %eax,(%rdi)
+  801be4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801be8:	41 f6 c1 02          	test   $0x2,%r9b
+  801bec:	74 07                	je     801bf5 <memset+0xa4>
+  801bee:	66 89 07             	mov    %ax,(%rdi)
+  801bf1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801bf5:	41 f6 c1 01          	test   $0x1,%r9b
+  801bf9:	74 9c                	je     801b97 <memset+0x46>
+  801bfb:	88 07                	mov    %al,(%rdi)
+  801bfd:	eb 98                	jmp    801b97 <memset+0x46>
+
+0000000000801bff <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801bff:	48 89 f8             	mov    %rdi,%rax
+  801c02:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801c05:	48 39 fe             	cmp    %rdi,%rsi
+  801c08:	73 3b                	jae    801c45 <memmove+0x46>
+  801c0a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801c0e:	48 39 d7             	cmp    %rdx,%rdi
+  801c11:	73 32                	jae    801c45 <memmove+0x46>
+        s += n;
+        d += n;
+  801c13:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801c17:	48 89 d6             	mov    %rdx,%rsi
+  801c1a:	48 09 fe             	or     %rdi,%rsi
+  801c1d:	48 09 ce             	or     %rcx,%rsi
+  801c20:	40 f6 c6 07          	test   $0x7,%sil
+  801c24:	75 12                	jne    801c38 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801c26:	48 83 ef 08          	sub    $0x8,%rdi
+  801c2a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801c2e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801c32:	fd                   	std
+  801c33:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801c36:	fc                   	cld
+  801c37:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801c38:	48 83 ef 01          	sub    $0x1,%rdi
+  801c3c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801c40:	fd                   	std
+  801c41:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801c43:	eb f1                	jmp    801c36 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801c45:	48 89 f2             	mov    %rsi,%rdx
+  801c48:	48 09 c2             	or     %rax,%rdx
+  801c4b:	48 09 ca             	or     %rcx,%rdx
+  801c4e:	f6 c2 07             	test   $0x7,%dl
+  801c51:	75 0c                	jne    801c5f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801c53:	48 c1 e9 03          	shr    $0x3,%rcx
+  801c57:	48 89 c7             	mov    %rax,%rdi
+  801c5a:	fc                   	cld
+  801c5b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c5e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801c5f:	48 89 c7             	mov    %rax,%rdi
+  801c62:	fc                   	cld
+  801c63:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801c65:	c3                   	ret
+
+0000000000801c66 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801c66:	55                   	push   %rbp
+  801c67:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801c6a:	48 b8 ff 1b 80 00 00 	movabs $0x801bff,%rax
+  801c71:	00 00 00 
+  801c74:	ff d0                	call   *%rax
+}
+  801c76:	5d                   	pop    %rbp
+  801c77:	c3                   	ret
+
+0000000000801c78 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801c78:	55                   	push   %rbp
+  801c79:	48 89 e5             	mov    %rsp,%rbp
+  801c7c:	41 57                	push   %r15
+  801c7e:	41 56                	push   %r14
+  801c80:	41 55                	push   %r13
+  801c82:	41 54                	push   %r12
+  801c84:	53                   	push   %rbx
+  801c85:	48 83 ec 08          	sub    $0x8,%rsp
+  801c89:	49 89 fe             	mov    %rdi,%r14
+  801c8c:	49 89 f7             	mov    %rsi,%r15
+  801c8f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801c92:	48 89 f7             	mov    %rsi,%rdi
+  801c95:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  801c9c:	00 00 00 
+  801c9f:	ff d0                	call   *%rax
+  801ca1:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801ca4:	48 89 de             	mov    %rbx,%rsi
+  801ca7:	4c 89 f7             	mov    %r14,%rdi
+  801caa:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+  801cb6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801cb9:	48 39 c3             	cmp    %rax,%rbx
+  801cbc:	74 36                	je     801cf4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801cbe:	48 89 d8             	mov    %rbx,%rax
+  801cc1:	4c 29 e8             	sub    %r13,%rax
+  801cc4:	49 39 c4             	cmp    %rax,%r12
+  801cc7:	73 31                	jae    801cfa <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801cc9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801cce:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801cd2:	4c 89 fe             	mov    %r15,%rsi
+  801cd5:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  801cdc:	00 00 00 
+  801cdf:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801ce1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801ce5:	48 83 c4 08          	add    $0x8,%rsp
+  801ce9:	5b                   	pop    %rbx
+  801cea:	41 5c                	pop    %r12
+  801cec:	41 5d                	pop    %r13
+  801cee:	41 5e                	pop    %r14
+  801cf0:	41 5f                	pop    %r15
+  801cf2:	5d                   	pop    %rbp
+  801cf3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801cf4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801cf8:	eb eb                	jmp    801ce5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801cfa:	48 83 eb 01          	sub    $0x1,%rbx
+  801cfe:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801d02:	48 89 da             	mov    %rbx,%rdx
+  801d05:	4c 89 fe             	mov    %r15,%rsi
+  801d08:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  801d0f:	00 00 00 
+  801d12:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801d14:	49 01 de             	add    %rbx,%r14
+  801d17:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801d1c:	eb c3                	jmp    801ce1 <strlcat+0x69>
+
+0000000000801d1e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801d1e:	48 85 d2             	test   %rdx,%rdx
+  801d21:	74 2d                	je     801d50 <memcmp+0x32>
+  801d23:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801d28:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801d2c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801d31:	44 38 c1             	cmp    %r8b,%cl
+  801d34:	75 0f                	jne    801d45 <memcmp+0x27>
+    while (n-- > 0) {
+  801d36:	48 83 c0 01          	add    $0x1,%rax
+  801d3a:	48 39 c2             	cmp    %rax,%rdx
+  801d3d:	75 e9                	jne    801d28 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d44:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801d45:	0f b6 c1             	movzbl %cl,%eax
+  801d48:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801d4c:	44 29 c0             	sub    %r8d,%eax
+  801d4f:	c3                   	ret
+    return 0;
+  801d50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d55:	c3                   	ret
+
+0000000000801d56 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801d56:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801d5a:	48 39 c7             	cmp    %rax,%rdi
+  801d5d:	73 0f                	jae    801d6e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801d5f:	40 38 37             	cmp    %sil,(%rdi)
+  801d62:	74 0e                	je     801d72 <memfind+0x1c>
+    for (; src < end; src++) {
+  801d64:	48 83 c7 01          	add    $0x1,%rdi
+  801d68:	48 39 f8             	cmp    %rdi,%rax
+  801d6b:	75 f2                	jne    801d5f <memfind+0x9>
+  801d6d:	c3                   	ret
+  801d6e:	48 89 f8             	mov    %rdi,%rax
+  801d71:	c3                   	ret
+  801d72:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801d75:	c3                   	ret
+
+0000000000801d76 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801d76:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801d79:	0f b6 37             	movzbl (%rdi),%esi
+  801d7c:	40 80 fe 20          	cmp    $0x20,%sil
+  801d80:	74 06                	je     801d88 <strtol+0x12>
+  801d82:	40 80 fe 09          	cmp    $0x9,%sil
+  801d86:	75 13                	jne    801d9b <strtol+0x25>
+  801d88:	48 83 c7 01          	add    $0x1,%rdi
+  801d8c:	0f b6 37             	movzbl (%rdi),%esi
+  801d8f:	40 80 fe 20          	cmp    $0x20,%sil
+  801d93:	74 f3                	je     801d88 <strtol+0x12>
+  801d95:	40 80 fe 09          	cmp    $0x9,%sil
+  801d99:	74 ed                	je     801d88 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801d9b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801d9e:	83 e0 fd             	and    $0xfffffffd,%eax
+  801da1:	3c 01                	cmp    $0x1,%al
+  801da3:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801da7:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801dad:	75 0f                	jne    801dbe <strtol+0x48>
+  801daf:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801db2:	74 14                	je     801dc8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801db4:	85 d2                	test   %edx,%edx
+  801db6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801dbb:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801dc3:	4c 63 ca             	movslq %edx,%r9
+  801dc6:	eb 36                	jmp    801dfe <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801dc8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801dcc:	74 0f                	je     801ddd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801dce:	85 d2                	test   %edx,%edx
+  801dd0:	75 ec                	jne    801dbe <strtol+0x48>
+        s++;
+  801dd2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801dd6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801ddb:	eb e1                	jmp    801dbe <strtol+0x48>
+        s += 2;
+  801ddd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801de1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801de6:	eb d6                	jmp    801dbe <strtol+0x48>
+            dig -= '0';
+  801de8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801deb:	44 0f b6 c1          	movzbl %cl,%r8d
+  801def:	41 39 d0             	cmp    %edx,%r8d
+  801df2:	7d 21                	jge    801e15 <strtol+0x9f>
+        val = val * base + dig;
+  801df4:	49 0f af c1          	imul   %r9,%rax
+  801df8:	0f b6 c9             	movzbl %cl,%ecx
+  801dfb:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801dfe:	48 83 c7 01          	add    $0x1,%rdi
+  801e02:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801e06:	80 f9 39             	cmp    $0x39,%cl
+  801e09:	76 dd                	jbe    801de8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801e0b:	80 f9 7b             	cmp    $0x7b,%cl
+  801e0e:	77 05                	ja     801e15 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801e10:	83 e9 57             	sub    $0x57,%ecx
+  801e13:	eb d6                	jmp    801deb <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801e15:	4d 85 d2             	test   %r10,%r10
+  801e18:	74 03                	je     801e1d <strtol+0xa7>
+  801e1a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801e1d:	48 89 c2             	mov    %rax,%rdx
+  801e20:	48 f7 da             	neg    %rdx
+  801e23:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801e27:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801e2b:	c3                   	ret
+
+0000000000801e2c <atoi>:
+int atoi(const char *str) {
+  801e2c:	55                   	push   %rbp
+  801e2d:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801e30:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e35:	be 00 00 00 00       	mov    $0x0,%esi
+  801e3a:	48 b8 76 1d 80 00 00 	movabs $0x801d76,%rax
+  801e41:	00 00 00 
+  801e44:	ff d0                	call   *%rax
+}
+  801e46:	5d                   	pop    %rbp
+  801e47:	c3                   	ret
+
+0000000000801e48 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801e48:	55                   	push   %rbp
+  801e49:	48 89 e5             	mov    %rsp,%rbp
+  801e4c:	53                   	push   %rbx
+  801e4d:	48 89 fa             	mov    %rdi,%rdx
+  801e50:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801e53:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e5d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e62:	be 00 00 00 00       	mov    $0x0,%esi
+  801e67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e6d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801e6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e73:	c9                   	leave
+  801e74:	c3                   	ret
+
+0000000000801e75 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801e75:	55                   	push   %rbp
+  801e76:	48 89 e5             	mov    %rsp,%rbp
+  801e79:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e7a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e84:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e8e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e93:	be 00 00 00 00       	mov    $0x0,%esi
+  801e98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e9e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ea0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea4:	c9                   	leave
+  801ea5:	c3                   	ret
+
+0000000000801ea6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801ea6:	55                   	push   %rbp
+  801ea7:	48 89 e5             	mov    %rsp,%rbp
+  801eaa:	53                   	push   %rbx
+  801eab:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801eaf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801eb2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801eb7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ebc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ec1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ec6:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ed1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ed3:	48 85 c0             	test   %rax,%rax
+  801ed6:	7f 06                	jg     801ede <sys_env_destroy+0x38>
+}
+  801ed8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801edc:	c9                   	leave
+  801edd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ede:	49 89 c0             	mov    %rax,%r8
+  801ee1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801ee6:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  801eed:	00 00 00 
+  801ef0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801ef5:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  801efc:	00 00 00 
+  801eff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f04:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  801f0b:	00 00 00 
+  801f0e:	41 ff d1             	call   *%r9
+
+0000000000801f11 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801f11:	55                   	push   %rbp
+  801f12:	48 89 e5             	mov    %rsp,%rbp
+  801f15:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f16:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f20:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f2a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f2f:	be 00 00 00 00       	mov    $0x0,%esi
+  801f34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f3a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f40:	c9                   	leave
+  801f41:	c3                   	ret
+
+0000000000801f42 <sys_yield>:
+
+void
+sys_yield(void) {
+  801f42:	55                   	push   %rbp
+  801f43:	48 89 e5             	mov    %rsp,%rbp
+  801f46:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f47:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f51:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f5b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f60:	be 00 00 00 00       	mov    $0x0,%esi
+  801f65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f6b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f71:	c9                   	leave
+  801f72:	c3                   	ret
+
+0000000000801f73 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801f73:	55                   	push   %rbp
+  801f74:	48 89 e5             	mov    %rsp,%rbp
+  801f77:	53                   	push   %rbx
+  801f78:	48 89 fa             	mov    %rdi,%rdx
+  801f7b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f7e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f83:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801f8a:	00 00 00 
+  801f8d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f92:	be 00 00 00 00       	mov    $0x0,%esi
+  801f97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f9d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801f9f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa3:	c9                   	leave
+  801fa4:	c3                   	ret
+
+0000000000801fa5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801fa5:	55                   	push   %rbp
+  801fa6:	48 89 e5             	mov    %rsp,%rbp
+  801fa9:	53                   	push   %rbx
+  801faa:	49 89 f8             	mov    %rdi,%r8
+  801fad:	48 89 d3             	mov    %rdx,%rbx
+  801fb0:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801fb3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fb8:	4c 89 c2             	mov    %r8,%rdx
+  801fbb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fbe:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fc9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801fcb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fcf:	c9                   	leave
+  801fd0:	c3                   	ret
+
+0000000000801fd1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801fd1:	55                   	push   %rbp
+  801fd2:	48 89 e5             	mov    %rsp,%rbp
+  801fd5:	53                   	push   %rbx
+  801fd6:	48 83 ec 08          	sub    $0x8,%rsp
+  801fda:	89 f8                	mov    %edi,%eax
+  801fdc:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801fdf:	48 63 f9             	movslq %ecx,%rdi
+  801fe2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fe5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fea:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fed:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ff8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ffa:	48 85 c0             	test   %rax,%rax
+  801ffd:	7f 06                	jg     802005 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801fff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802003:	c9                   	leave
+  802004:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802005:	49 89 c0             	mov    %rax,%r8
+  802008:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80200d:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  802014:	00 00 00 
+  802017:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80201c:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  802023:	00 00 00 
+  802026:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202b:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  802032:	00 00 00 
+  802035:	41 ff d1             	call   *%r9
+
+0000000000802038 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802038:	55                   	push   %rbp
+  802039:	48 89 e5             	mov    %rsp,%rbp
+  80203c:	53                   	push   %rbx
+  80203d:	48 83 ec 08          	sub    $0x8,%rsp
+  802041:	89 f8                	mov    %edi,%eax
+  802043:	49 89 f2             	mov    %rsi,%r10
+  802046:	48 89 cf             	mov    %rcx,%rdi
+  802049:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80204c:	48 63 da             	movslq %edx,%rbx
+  80204f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802052:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802057:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80205a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80205d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80205f:	48 85 c0             	test   %rax,%rax
+  802062:	7f 06                	jg     80206a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802064:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802068:	c9                   	leave
+  802069:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80206a:	49 89 c0             	mov    %rax,%r8
+  80206d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802072:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  802079:	00 00 00 
+  80207c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802081:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  802088:	00 00 00 
+  80208b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802090:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  802097:	00 00 00 
+  80209a:	41 ff d1             	call   *%r9
+
+000000000080209d <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80209d:	55                   	push   %rbp
+  80209e:	48 89 e5             	mov    %rsp,%rbp
+  8020a1:	53                   	push   %rbx
+  8020a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8020a6:	49 89 f9             	mov    %rdi,%r9
+  8020a9:	89 f0                	mov    %esi,%eax
+  8020ab:	48 89 d3             	mov    %rdx,%rbx
+  8020ae:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8020b1:	49 63 f0             	movslq %r8d,%rsi
+  8020b4:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8020b7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8020bc:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020c7:	48 85 c0             	test   %rax,%rax
+  8020ca:	7f 06                	jg     8020d2 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8020cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020d0:	c9                   	leave
+  8020d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020d2:	49 89 c0             	mov    %rax,%r8
+  8020d5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8020da:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  8020e1:	00 00 00 
+  8020e4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8020e9:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  8020f0:	00 00 00 
+  8020f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f8:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  8020ff:	00 00 00 
+  802102:	41 ff d1             	call   *%r9
+
+0000000000802105 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  802105:	55                   	push   %rbp
+  802106:	48 89 e5             	mov    %rsp,%rbp
+  802109:	53                   	push   %rbx
+  80210a:	89 f8                	mov    %edi,%eax
+  80210c:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80210f:	48 63 f9             	movslq %ecx,%rdi
+  802112:	48 63 da             	movslq %edx,%rbx
+  802115:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802118:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80211d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802120:	be 00 00 00 00       	mov    $0x0,%esi
+  802125:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80212b:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80212d:	89 c2                	mov    %eax,%edx
+  80212f:	48 85 c0             	test   %rax,%rax
+  802132:	78 0d                	js     802141 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  802134:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  802139:	4d 85 c9             	test   %r9,%r9
+  80213c:	74 03                	je     802141 <sys_alloc_dma_region+0x3c>
+  80213e:	49 89 01             	mov    %rax,(%r9)
+}
+  802141:	89 d0                	mov    %edx,%eax
+  802143:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802147:	c9                   	leave
+  802148:	c3                   	ret
+
+0000000000802149 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  802149:	55                   	push   %rbp
+  80214a:	48 89 e5             	mov    %rsp,%rbp
+  80214d:	53                   	push   %rbx
+  80214e:	48 83 ec 08          	sub    $0x8,%rsp
+  802152:	48 89 f1             	mov    %rsi,%rcx
+  802155:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  802158:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80215b:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802160:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802165:	be 00 00 00 00       	mov    $0x0,%esi
+  80216a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802170:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802172:	48 85 c0             	test   %rax,%rax
+  802175:	7f 06                	jg     80217d <sys_set_cache_region+0x34>
+}
+  802177:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80217b:	c9                   	leave
+  80217c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80217d:	49 89 c0             	mov    %rax,%r8
+  802180:	b9 08 00 00 00       	mov    $0x8,%ecx
+  802185:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  80218c:	00 00 00 
+  80218f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802194:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  80219b:	00 00 00 
+  80219e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a3:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  8021aa:	00 00 00 
+  8021ad:	41 ff d1             	call   *%r9
+
+00000000008021b0 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8021b0:	55                   	push   %rbp
+  8021b1:	48 89 e5             	mov    %rsp,%rbp
+  8021b4:	53                   	push   %rbx
+  8021b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b9:	48 89 f1             	mov    %rsi,%rcx
+  8021bc:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8021bf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8021c2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8021d9:	48 85 c0             	test   %rax,%rax
+  8021dc:	7f 06                	jg     8021e4 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8021de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021e2:	c9                   	leave
+  8021e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8021e4:	49 89 c0             	mov    %rax,%r8
+  8021e7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8021ec:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  8021f3:	00 00 00 
+  8021f6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8021fb:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  802202:	00 00 00 
+  802205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220a:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  802211:	00 00 00 
+  802214:	41 ff d1             	call   *%r9
+
+0000000000802217 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802217:	55                   	push   %rbp
+  802218:	48 89 e5             	mov    %rsp,%rbp
+  80221b:	53                   	push   %rbx
+  80221c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  802220:	48 63 ce             	movslq %esi,%rcx
+  802223:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802226:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80222b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802230:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802235:	be 00 00 00 00       	mov    $0x0,%esi
+  80223a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802240:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802242:	48 85 c0             	test   %rax,%rax
+  802245:	7f 06                	jg     80224d <sys_env_set_status+0x36>
+}
+  802247:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80224b:	c9                   	leave
+  80224c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80224d:	49 89 c0             	mov    %rax,%r8
+  802250:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  802255:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  80225c:	00 00 00 
+  80225f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802264:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  80226b:	00 00 00 
+  80226e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802273:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  80227a:	00 00 00 
+  80227d:	41 ff d1             	call   *%r9
+
+0000000000802280 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802280:	55                   	push   %rbp
+  802281:	48 89 e5             	mov    %rsp,%rbp
+  802284:	53                   	push   %rbx
+  802285:	48 83 ec 08          	sub    $0x8,%rsp
+  802289:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80228c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80228f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802294:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802299:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80229e:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8022a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8022ab:	48 85 c0             	test   %rax,%rax
+  8022ae:	7f 06                	jg     8022b6 <sys_env_set_trapframe+0x36>
+}
+  8022b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022b4:	c9                   	leave
+  8022b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8022b6:	49 89 c0             	mov    %rax,%r8
+  8022b9:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8022be:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  8022c5:	00 00 00 
+  8022c8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8022cd:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  8022d4:	00 00 00 
+  8022d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022dc:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  8022e3:	00 00 00 
+  8022e6:	41 ff d1             	call   *%r9
+
+00000000008022e9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8022e9:	55                   	push   %rbp
+  8022ea:	48 89 e5             	mov    %rsp,%rbp
+  8022ed:	53                   	push   %rbx
+  8022ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8022f2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8022f5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8022f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8022fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802302:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802307:	be 00 00 00 00       	mov    $0x0,%esi
+  80230c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802312:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802314:	48 85 c0             	test   %rax,%rax
+  802317:	7f 06                	jg     80231f <sys_env_set_pgfault_upcall+0x36>
+}
+  802319:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80231d:	c9                   	leave
+  80231e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80231f:	49 89 c0             	mov    %rax,%r8
+  802322:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  802327:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  80232e:	00 00 00 
+  802331:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802336:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  80233d:	00 00 00 
+  802340:	b8 00 00 00 00       	mov    $0x0,%eax
+  802345:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  80234c:	00 00 00 
+  80234f:	41 ff d1             	call   *%r9
+
+0000000000802352 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802352:	55                   	push   %rbp
+  802353:	48 89 e5             	mov    %rsp,%rbp
+  802356:	53                   	push   %rbx
+  802357:	89 f8                	mov    %edi,%eax
+  802359:	49 89 f1             	mov    %rsi,%r9
+  80235c:	48 89 d3             	mov    %rdx,%rbx
+  80235f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  802362:	49 63 f0             	movslq %r8d,%rsi
+  802365:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802368:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80236d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802370:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802376:	cd 30                	int    $0x30
+}
+  802378:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80237c:	c9                   	leave
+  80237d:	c3                   	ret
+
+000000000080237e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80237e:	55                   	push   %rbp
+  80237f:	48 89 e5             	mov    %rsp,%rbp
+  802382:	53                   	push   %rbx
+  802383:	48 83 ec 08          	sub    $0x8,%rsp
+  802387:	48 89 fa             	mov    %rdi,%rdx
+  80238a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80238d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802392:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802397:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80239c:	be 00 00 00 00       	mov    $0x0,%esi
+  8023a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023a7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8023a9:	48 85 c0             	test   %rax,%rax
+  8023ac:	7f 06                	jg     8023b4 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8023ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023b2:	c9                   	leave
+  8023b3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8023b4:	49 89 c0             	mov    %rax,%r8
+  8023b7:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8023bc:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  8023c3:	00 00 00 
+  8023c6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8023cb:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  8023d2:	00 00 00 
+  8023d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023da:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  8023e1:	00 00 00 
+  8023e4:	41 ff d1             	call   *%r9
+
+00000000008023e7 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8023e7:	55                   	push   %rbp
+  8023e8:	48 89 e5             	mov    %rsp,%rbp
+  8023eb:	53                   	push   %rbx
+  8023ec:	48 89 fa             	mov    %rdi,%rdx
+  8023ef:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8023f2:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802401:	be 00 00 00 00       	mov    $0x0,%esi
+  802406:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80240c:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80240e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802412:	c9                   	leave
+  802413:	c3                   	ret
+
+0000000000802414 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802414:	55                   	push   %rbp
+  802415:	48 89 e5             	mov    %rsp,%rbp
+  802418:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802419:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80241e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802423:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80242d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802432:	be 00 00 00 00       	mov    $0x0,%esi
+  802437:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80243d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80243f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802443:	c9                   	leave
+  802444:	c3                   	ret
+
+0000000000802445 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  802445:	48 85 ff             	test   %rdi,%rdi
+  802448:	0f 84 b6 01 00 00    	je     802604 <malloc+0x1bf>
+malloc(size_t size) {
+  80244e:	55                   	push   %rbp
+  80244f:	48 89 e5             	mov    %rsp,%rbp
+  802452:	41 56                	push   %r14
+  802454:	41 55                	push   %r13
+  802456:	41 54                	push   %r12
+  802458:	53                   	push   %rbx
+  802459:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80245c:	48 b8 e8 81 80 00 00 	movabs $0x8081e8,%rax
+  802463:	00 00 00 
+  802466:	4c 8b 20             	mov    (%rax),%r12
+  802469:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  802470:	0f 87 94 01 00 00    	ja     80260a <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  802476:	48 a1 e0 81 80 00 00 	movabs 0x8081e0,%rax
+  80247d:	00 00 00 
+  802480:	48 85 c0             	test   %rax,%rax
+  802483:	74 6b                	je     8024f0 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  802485:	4d 85 e4             	test   %r12,%r12
+  802488:	74 66                	je     8024f0 <malloc+0xab>
+  80248a:	48 ba 08 82 80 00 00 	movabs $0x808208,%rdx
+  802491:	00 00 00 
+  802494:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802499:	eb 0d                	jmp    8024a8 <malloc+0x63>
+  80249b:	48 83 c1 01          	add    $0x1,%rcx
+  80249f:	48 83 c2 18          	add    $0x18,%rdx
+  8024a3:	49 39 cc             	cmp    %rcx,%r12
+  8024a6:	74 48                	je     8024f0 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  8024a8:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  8024ad:	74 ec                	je     80249b <malloc+0x56>
+  8024af:	48 39 1a             	cmp    %rbx,(%rdx)
+  8024b2:	72 e7                	jb     80249b <malloc+0x56>
+                real_freep_size--;
+  8024b4:	48 83 e8 01          	sub    $0x1,%rax
+  8024b8:	48 a3 e0 81 80 00 00 	movabs %rax,0x8081e0
+  8024bf:	00 00 00 
+                freep[i].is_free = false;
+  8024c2:	48 ba 00 82 80 00 00 	movabs $0x808200,%rdx
+  8024c9:	00 00 00 
+  8024cc:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8024d0:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8024d4:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8024d8:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8024df:	00 
+                freep[i].size = size;
+  8024e0:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8024e4:	48 01 c8             	add    %rcx,%rax
+  8024e7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8024eb:	e9 0b 01 00 00       	jmp    8025fb <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8024f0:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8024f7:	00 00 00 
+  8024fa:	48 01 d8             	add    %rbx,%rax
+  8024fd:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  802503:	76 7c                	jbe    802581 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  802505:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  80250c:	00 00 00 
+  80250f:	4c 8b 30             	mov    (%rax),%r14
+  802512:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  802519:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  80251c:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  802523:	00 00 00 
+  802526:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  80252d:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  802534:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80253a:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80253e:	48 b8 11 1f 80 00 00 	movabs $0x801f11,%rax
+  802545:	00 00 00 
+  802548:	ff d0                	call   *%rax
+  80254a:	89 c7                	mov    %eax,%edi
+  80254c:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802553:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80255a:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  802561:	00 00 00 
+  802564:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  802568:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80256d:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  802574:	00 00 00 
+  802577:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  802579:	85 c0                	test   %eax,%eax
+  80257b:	0f 88 90 00 00 00    	js     802611 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  802581:	48 b9 10 70 80 00 00 	movabs $0x807010,%rcx
+  802588:	00 00 00 
+  80258b:	48 8b 31             	mov    (%rcx),%rsi
+  80258e:	48 bf 08 70 80 00 00 	movabs $0x807008,%rdi
+  802595:	00 00 00 
+  802598:	4c 8b 07             	mov    (%rdi),%r8
+  80259b:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80259f:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  8025a6:	00 00 00 
+  8025a9:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  8025ad:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  8025b1:	48 b8 00 82 80 00 00 	movabs $0x808200,%rax
+  8025b8:	00 00 00 
+  8025bb:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  8025bf:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  8025c2:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8025c6:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8025cd:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8025ce:	48 89 d8             	mov    %rbx,%rax
+  8025d1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8025d6:	4c 01 c0             	add    %r8,%rax
+  8025d9:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8025dc:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8025e3:	48 01 f3             	add    %rsi,%rbx
+  8025e6:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8025e9:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8025ee:	48 a3 e8 81 80 00 00 	movabs %rax,0x8081e8
+  8025f5:	00 00 00 
+  8025f8:	48 89 d0             	mov    %rdx,%rax
+}
+  8025fb:	5b                   	pop    %rbx
+  8025fc:	41 5c                	pop    %r12
+  8025fe:	41 5d                	pop    %r13
+  802600:	41 5e                	pop    %r14
+  802602:	5d                   	pop    %rbp
+  802603:	c3                   	ret
+        return NULL;
+  802604:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802609:	c3                   	ret
+        return NULL;
+  80260a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80260f:	eb ea                	jmp    8025fb <malloc+0x1b6>
+            return NULL;
+  802611:	b8 00 00 00 00       	mov    $0x0,%eax
+  802616:	eb e3                	jmp    8025fb <malloc+0x1b6>
+
+0000000000802618 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  802618:	55                   	push   %rbp
+  802619:	48 89 e5             	mov    %rsp,%rbp
+  80261c:	53                   	push   %rbx
+  80261d:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  802621:	48 89 fb             	mov    %rdi,%rbx
+  802624:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  802628:	48 89 df             	mov    %rbx,%rdi
+  80262b:	48 b8 45 24 80 00 00 	movabs $0x802445,%rax
+  802632:	00 00 00 
+  802635:	ff d0                	call   *%rax
+  802637:	48 89 c7             	mov    %rax,%rdi
+  80263a:	48 89 da             	mov    %rbx,%rdx
+  80263d:	be 00 00 00 00       	mov    $0x0,%esi
+  802642:	48 b8 51 1b 80 00 00 	movabs $0x801b51,%rax
+  802649:	00 00 00 
+  80264c:	ff d0                	call   *%rax
+}
+  80264e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802652:	c9                   	leave
+  802653:	c3                   	ret
+
+0000000000802654 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  802654:	48 a1 e8 81 80 00 00 	movabs 0x8081e8,%rax
+  80265b:	00 00 00 
+  80265e:	48 ba e0 81 80 00 00 	movabs $0x8081e0,%rdx
+  802665:	00 00 00 
+  802668:	48 3b 02             	cmp    (%rdx),%rax
+  80266b:	74 4d                	je     8026ba <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  80266d:	48 85 c0             	test   %rax,%rax
+  802670:	74 4d                	je     8026bf <get_allocsize+0x6b>
+  802672:	48 b9 00 82 80 00 00 	movabs $0x808200,%rcx
+  802679:	00 00 00 
+  80267c:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  802681:	48 3b 39             	cmp    (%rcx),%rdi
+  802684:	74 13                	je     802699 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  802686:	48 83 c2 01          	add    $0x1,%rdx
+  80268a:	48 83 c1 18          	add    $0x18,%rcx
+  80268e:	48 39 d0             	cmp    %rdx,%rax
+  802691:	75 ee                	jne    802681 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  802693:	b8 00 00 00 00       	mov    $0x0,%eax
+  802698:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  802699:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80269d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a2:	48 be 00 82 80 00 00 	movabs $0x808200,%rsi
+  8026a9:	00 00 00 
+  8026ac:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  8026b2:	75 0b                	jne    8026bf <get_allocsize+0x6b>
+  8026b4:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  8026b9:	c3                   	ret
+        return 0;
+  8026ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026bf:	c3                   	ret
+
+00000000008026c0 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  8026c0:	48 85 ff             	test   %rdi,%rdi
+  8026c3:	0f 84 01 01 00 00    	je     8027ca <free+0x10a>
+free(void *ptr) {
+  8026c9:	55                   	push   %rbp
+  8026ca:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8026cd:	48 b8 e8 81 80 00 00 	movabs $0x8081e8,%rax
+  8026d4:	00 00 00 
+  8026d7:	48 8b 30             	mov    (%rax),%rsi
+  8026da:	48 a1 e0 81 80 00 00 	movabs 0x8081e0,%rax
+  8026e1:	00 00 00 
+  8026e4:	48 39 c6             	cmp    %rax,%rsi
+  8026e7:	74 50                	je     802739 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8026e9:	48 85 f6             	test   %rsi,%rsi
+  8026ec:	74 21                	je     80270f <free+0x4f>
+  8026ee:	48 b9 00 82 80 00 00 	movabs $0x808200,%rcx
+  8026f5:	00 00 00 
+  8026f8:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8026fd:	48 3b 39             	cmp    (%rcx),%rdi
+  802700:	74 61                	je     802763 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  802702:	48 83 c2 01          	add    $0x1,%rdx
+  802706:	48 83 c1 18          	add    $0x18,%rcx
+  80270a:	48 39 d6             	cmp    %rdx,%rsi
+  80270d:	75 ee                	jne    8026fd <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  80270f:	48 ba f0 66 80 00 00 	movabs $0x8066f0,%rdx
+  802716:	00 00 00 
+  802719:	be 12 01 00 00       	mov    $0x112,%esi
+  80271e:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  802725:	00 00 00 
+  802728:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272d:	48 b9 a9 0d 80 00 00 	movabs $0x800da9,%rcx
+  802734:	00 00 00 
+  802737:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  802739:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  802740:	00 00 00 
+  802743:	be 06 01 00 00       	mov    $0x106,%esi
+  802748:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  80274f:	00 00 00 
+  802752:	b8 00 00 00 00       	mov    $0x0,%eax
+  802757:	48 b9 a9 0d 80 00 00 	movabs $0x800da9,%rcx
+  80275e:	00 00 00 
+  802761:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  802763:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  802767:	48 be 00 82 80 00 00 	movabs $0x808200,%rsi
+  80276e:	00 00 00 
+  802771:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  802777:	75 27                	jne    8027a0 <free+0xe0>
+            freep[i].is_free = true;
+  802779:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80277d:	48 ba 00 82 80 00 00 	movabs $0x808200,%rdx
+  802784:	00 00 00 
+  802787:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  80278e:	00 00 
+            real_freep_size++;
+  802790:	48 83 c0 01          	add    $0x1,%rax
+  802794:	48 a3 e0 81 80 00 00 	movabs %rax,0x8081e0
+  80279b:	00 00 00 
+}
+  80279e:	5d                   	pop    %rbp
+  80279f:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  8027a0:	48 ba c8 66 80 00 00 	movabs $0x8066c8,%rdx
+  8027a7:	00 00 00 
+  8027aa:	be 0b 01 00 00       	mov    $0x10b,%esi
+  8027af:	48 bf 18 67 80 00 00 	movabs $0x806718,%rdi
+  8027b6:	00 00 00 
+  8027b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027be:	48 b9 a9 0d 80 00 00 	movabs $0x800da9,%rcx
+  8027c5:	00 00 00 
+  8027c8:	ff d1                	call   *%rcx
+  8027ca:	c3                   	ret
+
+00000000008027cb <realloc>:
+realloc(void *ptr, size_t newsize) {
+  8027cb:	55                   	push   %rbp
+  8027cc:	48 89 e5             	mov    %rsp,%rbp
+  8027cf:	41 55                	push   %r13
+  8027d1:	41 54                	push   %r12
+  8027d3:	53                   	push   %rbx
+  8027d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d8:	48 89 fb             	mov    %rdi,%rbx
+  8027db:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  8027de:	48 b8 54 26 80 00 00 	movabs $0x802654,%rax
+  8027e5:	00 00 00 
+  8027e8:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  8027ea:	49 39 c5             	cmp    %rax,%r13
+  8027ed:	73 0e                	jae    8027fd <realloc+0x32>
+}
+  8027ef:	48 89 d8             	mov    %rbx,%rax
+  8027f2:	48 83 c4 08          	add    $0x8,%rsp
+  8027f6:	5b                   	pop    %rbx
+  8027f7:	41 5c                	pop    %r12
+  8027f9:	41 5d                	pop    %r13
+  8027fb:	5d                   	pop    %rbp
+  8027fc:	c3                   	ret
+  8027fd:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  802800:	4c 89 ef             	mov    %r13,%rdi
+  802803:	48 b8 45 24 80 00 00 	movabs $0x802445,%rax
+  80280a:	00 00 00 
+  80280d:	ff d0                	call   *%rax
+  80280f:	48 89 c7             	mov    %rax,%rdi
+  802812:	4c 89 e2             	mov    %r12,%rdx
+  802815:	48 89 de             	mov    %rbx,%rsi
+  802818:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  80281f:	00 00 00 
+  802822:	ff d0                	call   *%rax
+  802824:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  802827:	48 89 df             	mov    %rbx,%rdi
+  80282a:	48 b8 c0 26 80 00 00 	movabs $0x8026c0,%rax
+  802831:	00 00 00 
+  802834:	ff d0                	call   *%rax
+    return newptr;
+  802836:	4c 89 e3             	mov    %r12,%rbx
+  802839:	eb b4                	jmp    8027ef <realloc+0x24>
+
+000000000080283b <strdup>:
+
+char*
+strdup (const char *src) {
+  80283b:	55                   	push   %rbp
+  80283c:	48 89 e5             	mov    %rsp,%rbp
+  80283f:	41 54                	push   %r12
+  802841:	53                   	push   %rbx
+  802842:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  802845:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  80284c:	00 00 00 
+  80284f:	ff d0                	call   *%rax
+  802851:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  802855:	4c 89 e7             	mov    %r12,%rdi
+  802858:	48 b8 45 24 80 00 00 	movabs $0x802445,%rax
+  80285f:	00 00 00 
+  802862:	ff d0                	call   *%rax
+  802864:	48 89 c7             	mov    %rax,%rdi
+  802867:	4c 89 e2             	mov    %r12,%rdx
+  80286a:	48 89 de             	mov    %rbx,%rsi
+  80286d:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  802874:	00 00 00 
+  802877:	ff d0                	call   *%rax
+}
+  802879:	5b                   	pop    %rbx
+  80287a:	41 5c                	pop    %r12
+  80287c:	5d                   	pop    %rbp
+  80287d:	c3                   	ret
+
+000000000080287e <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  80287e:	55                   	push   %rbp
+  80287f:	48 89 e5             	mov    %rsp,%rbp
+  802882:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802883:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802888:	ba 00 00 00 00       	mov    $0x0,%edx
+  80288d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802892:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802897:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80289c:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8028a7:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028ad:	c9                   	leave
+  8028ae:	c3                   	ret
+
+00000000008028af <get_ticks>:
+
+uint64_t
+get_ticks() {
+  8028af:	55                   	push   %rbp
+  8028b0:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  8028b3:	48 b8 00 82 98 00 00 	movabs $0x988200,%rax
+  8028ba:	00 00 00 
+  8028bd:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8028c1:	74 26                	je     8028e9 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8028c3:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8028c5:	48 c1 e2 20          	shl    $0x20,%rdx
+  8028c9:	89 c0                	mov    %eax,%eax
+  8028cb:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  8028ce:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  8028d5:	48 b9 00 82 98 00 00 	movabs $0x988200,%rcx
+  8028dc:	00 00 00 
+  8028df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e4:	48 f7 31             	divq   (%rcx)
+}
+  8028e7:	5d                   	pop    %rbp
+  8028e8:	c3                   	ret
+        freq = get_cpufreq();
+  8028e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ee:	48 ba 7e 28 80 00 00 	movabs $0x80287e,%rdx
+  8028f5:	00 00 00 
+  8028f8:	ff d2                	call   *%rdx
+  8028fa:	48 a3 00 82 98 00 00 	movabs %rax,0x988200
+  802901:	00 00 00 
+  802904:	eb bd                	jmp    8028c3 <get_ticks+0x14>
+
+0000000000802906 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  802906:	55                   	push   %rbp
+  802907:	48 89 e5             	mov    %rsp,%rbp
+  80290a:	53                   	push   %rbx
+  80290b:	48 83 ec 08          	sub    $0x8,%rsp
+  80290f:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  802912:	48 b8 00 82 98 00 00 	movabs $0x988200,%rax
+  802919:	00 00 00 
+  80291c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802920:	74 50                	je     802972 <sleep+0x6c>
+    asm volatile("rdtsc"
+  802922:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802924:	48 c1 e2 20          	shl    $0x20,%rdx
+  802928:	89 c0                	mov    %eax,%eax
+  80292a:	48 89 d6             	mov    %rdx,%rsi
+  80292d:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  802930:	48 b8 00 82 98 00 00 	movabs $0x988200,%rax
+  802937:	00 00 00 
+  80293a:	48 0f af 18          	imul   (%rax),%rbx
+  80293e:	48 c1 eb 03          	shr    $0x3,%rbx
+  802942:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  802949:	9b c4 20 
+  80294c:	48 89 d8             	mov    %rbx,%rax
+  80294f:	48 f7 e2             	mul    %rdx
+  802952:	48 89 d1             	mov    %rdx,%rcx
+  802955:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  802959:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80295b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80295f:	89 c0                	mov    %eax,%eax
+  802961:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  802964:	48 29 f2             	sub    %rsi,%rdx
+  802967:	48 39 ca             	cmp    %rcx,%rdx
+  80296a:	72 ed                	jb     802959 <sleep+0x53>
+}
+  80296c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802970:	c9                   	leave
+  802971:	c3                   	ret
+        freq = get_cpufreq();
+  802972:	b8 00 00 00 00       	mov    $0x0,%eax
+  802977:	48 ba 7e 28 80 00 00 	movabs $0x80287e,%rdx
+  80297e:	00 00 00 
+  802981:	ff d2                	call   *%rdx
+  802983:	48 a3 00 82 98 00 00 	movabs %rax,0x988200
+  80298a:	00 00 00 
+  80298d:	eb 93                	jmp    802922 <sleep+0x1c>
+
+000000000080298f <poll_kbd>:
+
+int poll_kbd() {
+  80298f:	55                   	push   %rbp
+  802990:	48 89 e5             	mov    %rsp,%rbp
+  802993:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802994:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802999:	ba 00 00 00 00       	mov    $0x0,%edx
+  80299e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8029ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8029b8:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  8029ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029be:	c9                   	leave
+  8029bf:	c3                   	ret
+
+00000000008029c0 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  8029c0:	55                   	push   %rbp
+  8029c1:	48 89 e5             	mov    %rsp,%rbp
+  8029c4:	53                   	push   %rbx
+  8029c5:	49 89 fa             	mov    %rdi,%r10
+  8029c8:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  8029ca:	44 89 c6             	mov    %r8d,%esi
+  8029cd:	89 cf                	mov    %ecx,%edi
+  8029cf:	89 d3                	mov    %edx,%ebx
+  8029d1:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d3:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029d8:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8029db:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  8029df:	cd 30                	int    $0x30
+  8029e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029e5:	c9                   	leave
+  8029e6:	c3                   	ret
+
+00000000008029e7 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8029e7:	55                   	push   %rbp
+  8029e8:	48 89 e5             	mov    %rsp,%rbp
+  8029eb:	41 56                	push   %r14
+  8029ed:	41 55                	push   %r13
+  8029ef:	41 54                	push   %r12
+  8029f1:	53                   	push   %rbx
+  8029f2:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8029f5:	48 b8 68 82 98 00 00 	movabs $0x988268,%rax
+  8029fc:	00 00 00 
+  8029ff:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802a03:	74 27                	je     802a2c <_handle_vectored_pagefault+0x45>
+  802a05:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  802a0a:	49 bd 20 82 98 00 00 	movabs $0x988220,%r13
+  802a11:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802a14:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  802a17:	4c 89 e7             	mov    %r12,%rdi
+  802a1a:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  802a1f:	84 c0                	test   %al,%al
+  802a21:	75 45                	jne    802a68 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802a23:	48 83 c3 01          	add    $0x1,%rbx
+  802a27:	49 3b 1e             	cmp    (%r14),%rbx
+  802a2a:	72 eb                	jb     802a17 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  802a2c:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  802a33:	00 
+  802a34:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  802a39:	4d 8b 04 24          	mov    (%r12),%r8
+  802a3d:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802a44:	00 00 00 
+  802a47:	be 1d 00 00 00       	mov    $0x1d,%esi
+  802a4c:	48 bf 58 67 80 00 00 	movabs $0x806758,%rdi
+  802a53:	00 00 00 
+  802a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5b:	49 ba a9 0d 80 00 00 	movabs $0x800da9,%r10
+  802a62:	00 00 00 
+  802a65:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  802a68:	5b                   	pop    %rbx
+  802a69:	41 5c                	pop    %r12
+  802a6b:	41 5d                	pop    %r13
+  802a6d:	41 5e                	pop    %r14
+  802a6f:	5d                   	pop    %rbp
+  802a70:	c3                   	ret
+
+0000000000802a71 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  802a71:	55                   	push   %rbp
+  802a72:	48 89 e5             	mov    %rsp,%rbp
+  802a75:	41 54                	push   %r12
+  802a77:	53                   	push   %rbx
+  802a78:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  802a7b:	48 b8 60 82 98 00 00 	movabs $0x988260,%rax
+  802a82:	00 00 00 
+  802a85:	80 38 00             	cmpb   $0x0,(%rax)
+  802a88:	74 64                	je     802aee <add_pgfault_handler+0x7d>
+        _pfhandler_inititiallized = 1;
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802a8a:	48 b8 68 82 98 00 00 	movabs $0x988268,%rax
+  802a91:	00 00 00 
+  802a94:	48 8b 10             	mov    (%rax),%rdx
+  802a97:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  802a9c:	48 b9 20 82 98 00 00 	movabs $0x988220,%rcx
+  802aa3:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802aa6:	48 85 d2             	test   %rdx,%rdx
+  802aa9:	74 1d                	je     802ac8 <add_pgfault_handler+0x57>
+        if (handler == _pfhandler_vec[i]) return 0;
+  802aab:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  802aaf:	0f 84 ee 00 00 00    	je     802ba3 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802ab5:	48 83 c0 01          	add    $0x1,%rax
+  802ab9:	48 39 d0             	cmp    %rdx,%rax
+  802abc:	75 ed                	jne    802aab <add_pgfault_handler+0x3a>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  802abe:	48 83 fa 08          	cmp    $0x8,%rdx
+  802ac2:	0f 84 a9 00 00 00    	je     802b71 <add_pgfault_handler+0x100>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802ac8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802acc:	48 a3 68 82 98 00 00 	movabs %rax,0x988268
+  802ad3:	00 00 00 
+  802ad6:	48 b8 20 82 98 00 00 	movabs $0x988220,%rax
+  802add:	00 00 00 
+  802ae0:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+    int res = 0;
+  802ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+    return res;
+}
+  802ae9:	5b                   	pop    %rbx
+  802aea:	41 5c                	pop    %r12
+  802aec:	5d                   	pop    %rbp
+  802aed:	c3                   	ret
+        sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  802aee:	49 bc 11 1f 80 00 00 	movabs $0x801f11,%r12
+  802af5:	00 00 00 
+  802af8:	41 ff d4             	call   *%r12
+  802afb:	89 c7                	mov    %eax,%edi
+  802afd:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b02:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b07:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  802b0e:	00 00 00 
+  802b11:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  802b18:	00 00 00 
+  802b1b:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802b1d:	48 ba 68 82 98 00 00 	movabs $0x988268,%rdx
+  802b24:	00 00 00 
+  802b27:	48 8b 02             	mov    (%rdx),%rax
+  802b2a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802b2e:	48 89 0a             	mov    %rcx,(%rdx)
+  802b31:	48 ba 20 82 98 00 00 	movabs $0x988220,%rdx
+  802b38:	00 00 00 
+  802b3b:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  802b3f:	48 b8 60 82 98 00 00 	movabs $0x988260,%rax
+  802b46:	00 00 00 
+  802b49:	c6 00 01             	movb   $0x1,(%rax)
+        res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  802b4c:	41 ff d4             	call   *%r12
+  802b4f:	89 c7                	mov    %eax,%edi
+  802b51:	48 be 69 2c 80 00 00 	movabs $0x802c69,%rsi
+  802b58:	00 00 00 
+  802b5b:	48 b8 e9 22 80 00 00 	movabs $0x8022e9,%rax
+  802b62:	00 00 00 
+  802b65:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  802b67:	85 c0                	test   %eax,%eax
+  802b69:	0f 89 7a ff ff ff    	jns    802ae9 <add_pgfault_handler+0x78>
+  802b6f:	eb 05                	jmp    802b76 <add_pgfault_handler+0x105>
+        res = -E_INVAL;
+  802b71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  802b76:	89 c1                	mov    %eax,%ecx
+  802b78:	48 ba 66 67 80 00 00 	movabs $0x806766,%rdx
+  802b7f:	00 00 00 
+  802b82:	be 3b 00 00 00       	mov    $0x3b,%esi
+  802b87:	48 bf 58 67 80 00 00 	movabs $0x806758,%rdi
+  802b8e:	00 00 00 
+  802b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b96:	49 b8 a9 0d 80 00 00 	movabs $0x800da9,%r8
+  802b9d:	00 00 00 
+  802ba0:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  802ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba8:	e9 3c ff ff ff       	jmp    802ae9 <add_pgfault_handler+0x78>
+
+0000000000802bad <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  802bad:	55                   	push   %rbp
+  802bae:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  802bb1:	48 b8 60 82 98 00 00 	movabs $0x988260,%rax
+  802bb8:	00 00 00 
+  802bbb:	80 38 00             	cmpb   $0x0,(%rax)
+  802bbe:	74 33                	je     802bf3 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802bc0:	48 a1 68 82 98 00 00 	movabs 0x988268,%rax
+  802bc7:	00 00 00 
+  802bca:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  802bcf:	48 ba 20 82 98 00 00 	movabs $0x988220,%rdx
+  802bd6:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802bd9:	48 85 c0             	test   %rax,%rax
+  802bdc:	0f 84 85 00 00 00    	je     802c67 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  802be2:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  802be6:	74 40                	je     802c28 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802be8:	48 83 c1 01          	add    $0x1,%rcx
+  802bec:	48 39 c1             	cmp    %rax,%rcx
+  802bef:	75 f1                	jne    802be2 <remove_pgfault_handler+0x35>
+  802bf1:	eb 74                	jmp    802c67 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  802bf3:	48 b9 7e 67 80 00 00 	movabs $0x80677e,%rcx
+  802bfa:	00 00 00 
+  802bfd:	48 ba 98 67 80 00 00 	movabs $0x806798,%rdx
+  802c04:	00 00 00 
+  802c07:	be 41 00 00 00       	mov    $0x41,%esi
+  802c0c:	48 bf 58 67 80 00 00 	movabs $0x806758,%rdi
+  802c13:	00 00 00 
+  802c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1b:	49 b8 a9 0d 80 00 00 	movabs $0x800da9,%r8
+  802c22:	00 00 00 
+  802c25:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  802c28:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  802c2f:	00 
+  802c30:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802c34:	48 29 ca             	sub    %rcx,%rdx
+  802c37:	48 b8 20 82 98 00 00 	movabs $0x988220,%rax
+  802c3e:	00 00 00 
+  802c41:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  802c45:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  802c4a:	48 89 ce             	mov    %rcx,%rsi
+  802c4d:	48 b8 ff 1b 80 00 00 	movabs $0x801bff,%rax
+  802c54:	00 00 00 
+  802c57:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  802c59:	48 b8 68 82 98 00 00 	movabs $0x988268,%rax
+  802c60:	00 00 00 
+  802c63:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  802c67:	5d                   	pop    %rbp
+  802c68:	c3                   	ret
+
+0000000000802c69 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  802c69:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  802c6c:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  802c73:	00 00 00 
+    call *%rax
+  802c76:	ff d0                	call   *%rax
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (use POPA macro).
+    popq %r15
+  802c78:	41 5f                	pop    %r15
+    popq %r15
+  802c7a:	41 5f                	pop    %r15
+    popq %r15
+  802c7c:	41 5f                	pop    %r15
+    popq %r14
+  802c7e:	41 5e                	pop    %r14
+    popq %r13
+  802c80:	41 5d                	pop    %r13
+    popq %r12
+  802c82:	41 5c                	pop    %r12
+    popq %r11
+  802c84:	41 5b                	pop    %r11
+    popq %r10
+  802c86:	41 5a                	pop    %r10
+    popq %r9
+  802c88:	41 59                	pop    %r9
+    popq %r8
+  802c8a:	41 58                	pop    %r8
+    popq %rsi
+  802c8c:	5e                   	pop    %rsi
+    popq %rdi
+  802c8d:	5f                   	pop    %rdi
+    popq %rbp
+  802c8e:	5d                   	pop    %rbp
+    popq %rdx
+  802c8f:	5a                   	pop    %rdx
+    popq %rcx
+  802c90:	59                   	pop    %rcx
+
+    movq 32(%rsp), %rbx
+  802c91:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+    movq 16(%rsp), %rax
+  802c96:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    subq $8, %rbx
+  802c9b:	48 83 eb 08          	sub    $0x8,%rbx
+    movq %rax, (%rbx)
+  802c9f:	48 89 03             	mov    %rax,(%rbx)
+    movq %rbx, 32(%rsp)
+  802ca2:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+    popq %rbx
+  802ca7:	5b                   	pop    %rbx
+    popq %rax
+  802ca8:	58                   	pop    %rax
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    pushq 8(%rsp)
+  802ca9:	ff 74 24 08          	push   0x8(%rsp)
+    popfq
+  802cad:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    movq 16(%rsp), %rsp
+  802cae:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  802cb3:	c3                   	ret
+
+0000000000802cb4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802cb4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802cbb:	ff ff ff 
+  802cbe:	48 01 f8             	add    %rdi,%rax
+  802cc1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802cc5:	c3                   	ret
+
+0000000000802cc6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802cc6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802ccd:	ff ff ff 
+  802cd0:	48 01 f8             	add    %rdi,%rax
+  802cd3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802cd7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802cdd:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802ce1:	c3                   	ret
+
+0000000000802ce2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802ce2:	55                   	push   %rbp
+  802ce3:	48 89 e5             	mov    %rsp,%rbp
+  802ce6:	41 57                	push   %r15
+  802ce8:	41 56                	push   %r14
+  802cea:	41 55                	push   %r13
+  802cec:	41 54                	push   %r12
+  802cee:	53                   	push   %rbx
+  802cef:	48 83 ec 08          	sub    $0x8,%rsp
+  802cf3:	49 89 ff             	mov    %rdi,%r15
+  802cf6:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802cfb:	49 bd 96 4b 80 00 00 	movabs $0x804b96,%r13
+  802d02:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802d05:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802d0b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802d0e:	48 89 df             	mov    %rbx,%rdi
+  802d11:	41 ff d5             	call   *%r13
+  802d14:	83 e0 04             	and    $0x4,%eax
+  802d17:	74 17                	je     802d30 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802d19:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d20:	4c 39 f3             	cmp    %r14,%rbx
+  802d23:	75 e6                	jne    802d0b <fd_alloc+0x29>
+  802d25:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802d2b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802d30:	4d 89 27             	mov    %r12,(%r15)
+}
+  802d33:	48 83 c4 08          	add    $0x8,%rsp
+  802d37:	5b                   	pop    %rbx
+  802d38:	41 5c                	pop    %r12
+  802d3a:	41 5d                	pop    %r13
+  802d3c:	41 5e                	pop    %r14
+  802d3e:	41 5f                	pop    %r15
+  802d40:	5d                   	pop    %rbp
+  802d41:	c3                   	ret
+
+0000000000802d42 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802d42:	83 ff 1f             	cmp    $0x1f,%edi
+  802d45:	77 39                	ja     802d80 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802d47:	55                   	push   %rbp
+  802d48:	48 89 e5             	mov    %rsp,%rbp
+  802d4b:	41 54                	push   %r12
+  802d4d:	53                   	push   %rbx
+  802d4e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802d51:	48 63 df             	movslq %edi,%rbx
+  802d54:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802d5b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802d5f:	48 89 df             	mov    %rbx,%rdi
+  802d62:	48 b8 96 4b 80 00 00 	movabs $0x804b96,%rax
+  802d69:	00 00 00 
+  802d6c:	ff d0                	call   *%rax
+  802d6e:	a8 04                	test   $0x4,%al
+  802d70:	74 14                	je     802d86 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802d72:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802d76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d7b:	5b                   	pop    %rbx
+  802d7c:	41 5c                	pop    %r12
+  802d7e:	5d                   	pop    %rbp
+  802d7f:	c3                   	ret
+        return -E_INVAL;
+  802d80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d85:	c3                   	ret
+        return -E_INVAL;
+  802d86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d8b:	eb ee                	jmp    802d7b <fd_lookup+0x39>
+
+0000000000802d8d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802d8d:	55                   	push   %rbp
+  802d8e:	48 89 e5             	mov    %rsp,%rbp
+  802d91:	41 54                	push   %r12
+  802d93:	53                   	push   %rbx
+  802d94:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802d97:	48 b8 40 68 80 00 00 	movabs $0x806840,%rax
+  802d9e:	00 00 00 
+  802da1:	48 bb 20 70 80 00 00 	movabs $0x807020,%rbx
+  802da8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802dab:	39 3b                	cmp    %edi,(%rbx)
+  802dad:	74 47                	je     802df6 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802daf:	48 83 c0 08          	add    $0x8,%rax
+  802db3:	48 8b 18             	mov    (%rax),%rbx
+  802db6:	48 85 db             	test   %rbx,%rbx
+  802db9:	75 f0                	jne    802dab <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802dbb:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  802dc2:	00 00 00 
+  802dc5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802dcb:	89 fa                	mov    %edi,%edx
+  802dcd:	48 bf b0 67 80 00 00 	movabs $0x8067b0,%rdi
+  802dd4:	00 00 00 
+  802dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ddc:	48 b9 f9 0e 80 00 00 	movabs $0x800ef9,%rcx
+  802de3:	00 00 00 
+  802de6:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802de8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ded:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802df1:	5b                   	pop    %rbx
+  802df2:	41 5c                	pop    %r12
+  802df4:	5d                   	pop    %rbp
+  802df5:	c3                   	ret
+            return 0;
+  802df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfb:	eb f0                	jmp    802ded <dev_lookup+0x60>
+
+0000000000802dfd <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802dfd:	55                   	push   %rbp
+  802dfe:	48 89 e5             	mov    %rsp,%rbp
+  802e01:	41 55                	push   %r13
+  802e03:	41 54                	push   %r12
+  802e05:	53                   	push   %rbx
+  802e06:	48 83 ec 18          	sub    $0x18,%rsp
+  802e0a:	48 89 fb             	mov    %rdi,%rbx
+  802e0d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802e10:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802e17:	ff ff ff 
+  802e1a:	48 01 df             	add    %rbx,%rdi
+  802e1d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802e21:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802e25:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  802e2c:	00 00 00 
+  802e2f:	ff d0                	call   *%rax
+  802e31:	41 89 c5             	mov    %eax,%r13d
+  802e34:	85 c0                	test   %eax,%eax
+  802e36:	78 06                	js     802e3e <fd_close+0x41>
+  802e38:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802e3c:	74 1a                	je     802e58 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802e3e:	45 84 e4             	test   %r12b,%r12b
+  802e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e46:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802e4a:	44 89 e8             	mov    %r13d,%eax
+  802e4d:	48 83 c4 18          	add    $0x18,%rsp
+  802e51:	5b                   	pop    %rbx
+  802e52:	41 5c                	pop    %r12
+  802e54:	41 5d                	pop    %r13
+  802e56:	5d                   	pop    %rbp
+  802e57:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802e58:	8b 3b                	mov    (%rbx),%edi
+  802e5a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802e5e:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  802e65:	00 00 00 
+  802e68:	ff d0                	call   *%rax
+  802e6a:	41 89 c5             	mov    %eax,%r13d
+  802e6d:	85 c0                	test   %eax,%eax
+  802e6f:	78 1b                	js     802e8c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802e71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e75:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802e79:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802e7f:	48 85 c0             	test   %rax,%rax
+  802e82:	74 08                	je     802e8c <fd_close+0x8f>
+  802e84:	48 89 df             	mov    %rbx,%rdi
+  802e87:	ff d0                	call   *%rax
+  802e89:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802e8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e91:	48 89 de             	mov    %rbx,%rsi
+  802e94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e99:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  802ea0:	00 00 00 
+  802ea3:	ff d0                	call   *%rax
+    return res;
+  802ea5:	eb a3                	jmp    802e4a <fd_close+0x4d>
+
+0000000000802ea7 <close>:
+
+int
+close(int fdnum) {
+  802ea7:	55                   	push   %rbp
+  802ea8:	48 89 e5             	mov    %rsp,%rbp
+  802eab:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802eaf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802eb3:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  802eba:	00 00 00 
+  802ebd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ebf:	85 c0                	test   %eax,%eax
+  802ec1:	78 15                	js     802ed8 <close+0x31>
+
+    return fd_close(fd, 1);
+  802ec3:	be 01 00 00 00       	mov    $0x1,%esi
+  802ec8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ecc:	48 b8 fd 2d 80 00 00 	movabs $0x802dfd,%rax
+  802ed3:	00 00 00 
+  802ed6:	ff d0                	call   *%rax
+}
+  802ed8:	c9                   	leave
+  802ed9:	c3                   	ret
+
+0000000000802eda <close_all>:
+
+void
+close_all(void) {
+  802eda:	55                   	push   %rbp
+  802edb:	48 89 e5             	mov    %rsp,%rbp
+  802ede:	41 54                	push   %r12
+  802ee0:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802ee1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ee6:	49 bc a7 2e 80 00 00 	movabs $0x802ea7,%r12
+  802eed:	00 00 00 
+  802ef0:	89 df                	mov    %ebx,%edi
+  802ef2:	41 ff d4             	call   *%r12
+  802ef5:	83 c3 01             	add    $0x1,%ebx
+  802ef8:	83 fb 20             	cmp    $0x20,%ebx
+  802efb:	75 f3                	jne    802ef0 <close_all+0x16>
+}
+  802efd:	5b                   	pop    %rbx
+  802efe:	41 5c                	pop    %r12
+  802f00:	5d                   	pop    %rbp
+  802f01:	c3                   	ret
+
+0000000000802f02 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802f02:	55                   	push   %rbp
+  802f03:	48 89 e5             	mov    %rsp,%rbp
+  802f06:	41 57                	push   %r15
+  802f08:	41 56                	push   %r14
+  802f0a:	41 55                	push   %r13
+  802f0c:	41 54                	push   %r12
+  802f0e:	53                   	push   %rbx
+  802f0f:	48 83 ec 18          	sub    $0x18,%rsp
+  802f13:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802f16:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802f1a:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  802f21:	00 00 00 
+  802f24:	ff d0                	call   *%rax
+  802f26:	89 c3                	mov    %eax,%ebx
+  802f28:	85 c0                	test   %eax,%eax
+  802f2a:	0f 88 b8 00 00 00    	js     802fe8 <dup+0xe6>
+    close(newfdnum);
+  802f30:	44 89 e7             	mov    %r12d,%edi
+  802f33:	48 b8 a7 2e 80 00 00 	movabs $0x802ea7,%rax
+  802f3a:	00 00 00 
+  802f3d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802f3f:	4d 63 ec             	movslq %r12d,%r13
+  802f42:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802f49:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802f4d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802f51:	4c 89 ff             	mov    %r15,%rdi
+  802f54:	49 be c6 2c 80 00 00 	movabs $0x802cc6,%r14
+  802f5b:	00 00 00 
+  802f5e:	41 ff d6             	call   *%r14
+  802f61:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802f64:	4c 89 ef             	mov    %r13,%rdi
+  802f67:	41 ff d6             	call   *%r14
+  802f6a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802f6d:	48 89 df             	mov    %rbx,%rdi
+  802f70:	48 b8 96 4b 80 00 00 	movabs $0x804b96,%rax
+  802f77:	00 00 00 
+  802f7a:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802f7c:	a8 04                	test   $0x4,%al
+  802f7e:	74 2b                	je     802fab <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802f80:	41 89 c1             	mov    %eax,%r9d
+  802f83:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802f89:	4c 89 f1             	mov    %r14,%rcx
+  802f8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f91:	48 89 de             	mov    %rbx,%rsi
+  802f94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f99:	48 b8 38 20 80 00 00 	movabs $0x802038,%rax
+  802fa0:	00 00 00 
+  802fa3:	ff d0                	call   *%rax
+  802fa5:	89 c3                	mov    %eax,%ebx
+  802fa7:	85 c0                	test   %eax,%eax
+  802fa9:	78 4e                	js     802ff9 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802fab:	4c 89 ff             	mov    %r15,%rdi
+  802fae:	48 b8 96 4b 80 00 00 	movabs $0x804b96,%rax
+  802fb5:	00 00 00 
+  802fb8:	ff d0                	call   *%rax
+  802fba:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802fbd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802fc3:	4c 89 e9             	mov    %r13,%rcx
+  802fc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fcb:	4c 89 fe             	mov    %r15,%rsi
+  802fce:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd3:	48 b8 38 20 80 00 00 	movabs $0x802038,%rax
+  802fda:	00 00 00 
+  802fdd:	ff d0                	call   *%rax
+  802fdf:	89 c3                	mov    %eax,%ebx
+  802fe1:	85 c0                	test   %eax,%eax
+  802fe3:	78 14                	js     802ff9 <dup+0xf7>
+
+    return newfdnum;
+  802fe5:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802fe8:	89 d8                	mov    %ebx,%eax
+  802fea:	48 83 c4 18          	add    $0x18,%rsp
+  802fee:	5b                   	pop    %rbx
+  802fef:	41 5c                	pop    %r12
+  802ff1:	41 5d                	pop    %r13
+  802ff3:	41 5e                	pop    %r14
+  802ff5:	41 5f                	pop    %r15
+  802ff7:	5d                   	pop    %rbp
+  802ff8:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802ff9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ffe:	4c 89 ee             	mov    %r13,%rsi
+  803001:	bf 00 00 00 00       	mov    $0x0,%edi
+  803006:	49 bc b0 21 80 00 00 	movabs $0x8021b0,%r12
+  80300d:	00 00 00 
+  803010:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803013:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803018:	4c 89 f6             	mov    %r14,%rsi
+  80301b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803020:	41 ff d4             	call   *%r12
+    return res;
+  803023:	eb c3                	jmp    802fe8 <dup+0xe6>
+
+0000000000803025 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803025:	55                   	push   %rbp
+  803026:	48 89 e5             	mov    %rsp,%rbp
+  803029:	41 56                	push   %r14
+  80302b:	41 55                	push   %r13
+  80302d:	41 54                	push   %r12
+  80302f:	53                   	push   %rbx
+  803030:	48 83 ec 10          	sub    $0x10,%rsp
+  803034:	89 fb                	mov    %edi,%ebx
+  803036:	49 89 f4             	mov    %rsi,%r12
+  803039:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80303c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803040:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  803047:	00 00 00 
+  80304a:	ff d0                	call   *%rax
+  80304c:	85 c0                	test   %eax,%eax
+  80304e:	78 4c                	js     80309c <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803050:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803054:	41 8b 3e             	mov    (%r14),%edi
+  803057:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80305b:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  803062:	00 00 00 
+  803065:	ff d0                	call   *%rax
+  803067:	85 c0                	test   %eax,%eax
+  803069:	78 35                	js     8030a0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80306b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80306f:	83 e0 03             	and    $0x3,%eax
+  803072:	83 f8 01             	cmp    $0x1,%eax
+  803075:	74 2d                	je     8030a4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803077:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80307b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80307f:	48 85 c0             	test   %rax,%rax
+  803082:	74 56                	je     8030da <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803084:	4c 89 ea             	mov    %r13,%rdx
+  803087:	4c 89 e6             	mov    %r12,%rsi
+  80308a:	4c 89 f7             	mov    %r14,%rdi
+  80308d:	ff d0                	call   *%rax
+}
+  80308f:	48 83 c4 10          	add    $0x10,%rsp
+  803093:	5b                   	pop    %rbx
+  803094:	41 5c                	pop    %r12
+  803096:	41 5d                	pop    %r13
+  803098:	41 5e                	pop    %r14
+  80309a:	5d                   	pop    %rbp
+  80309b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80309c:	48 98                	cltq
+  80309e:	eb ef                	jmp    80308f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8030a0:	48 98                	cltq
+  8030a2:	eb eb                	jmp    80308f <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8030a4:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  8030ab:	00 00 00 
+  8030ae:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8030b4:	89 da                	mov    %ebx,%edx
+  8030b6:	48 bf f1 67 80 00 00 	movabs $0x8067f1,%rdi
+  8030bd:	00 00 00 
+  8030c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c5:	48 b9 f9 0e 80 00 00 	movabs $0x800ef9,%rcx
+  8030cc:	00 00 00 
+  8030cf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8030d1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8030d8:	eb b5                	jmp    80308f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8030da:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8030e1:	eb ac                	jmp    80308f <read+0x6a>
+
+00000000008030e3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8030e3:	55                   	push   %rbp
+  8030e4:	48 89 e5             	mov    %rsp,%rbp
+  8030e7:	41 57                	push   %r15
+  8030e9:	41 56                	push   %r14
+  8030eb:	41 55                	push   %r13
+  8030ed:	41 54                	push   %r12
+  8030ef:	53                   	push   %rbx
+  8030f0:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8030f4:	48 85 d2             	test   %rdx,%rdx
+  8030f7:	74 54                	je     80314d <readn+0x6a>
+  8030f9:	41 89 fd             	mov    %edi,%r13d
+  8030fc:	49 89 f6             	mov    %rsi,%r14
+  8030ff:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803102:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803107:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80310c:	49 bf 25 30 80 00 00 	movabs $0x803025,%r15
+  803113:	00 00 00 
+  803116:	4c 89 e2             	mov    %r12,%rdx
+  803119:	48 29 f2             	sub    %rsi,%rdx
+  80311c:	4c 01 f6             	add    %r14,%rsi
+  80311f:	44 89 ef             	mov    %r13d,%edi
+  803122:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803125:	85 c0                	test   %eax,%eax
+  803127:	78 20                	js     803149 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803129:	01 c3                	add    %eax,%ebx
+  80312b:	85 c0                	test   %eax,%eax
+  80312d:	74 08                	je     803137 <readn+0x54>
+  80312f:	48 63 f3             	movslq %ebx,%rsi
+  803132:	4c 39 e6             	cmp    %r12,%rsi
+  803135:	72 df                	jb     803116 <readn+0x33>
+    }
+    return res;
+  803137:	48 63 c3             	movslq %ebx,%rax
+}
+  80313a:	48 83 c4 08          	add    $0x8,%rsp
+  80313e:	5b                   	pop    %rbx
+  80313f:	41 5c                	pop    %r12
+  803141:	41 5d                	pop    %r13
+  803143:	41 5e                	pop    %r14
+  803145:	41 5f                	pop    %r15
+  803147:	5d                   	pop    %rbp
+  803148:	c3                   	ret
+        if (inc < 0) return inc;
+  803149:	48 98                	cltq
+  80314b:	eb ed                	jmp    80313a <readn+0x57>
+    int inc = 1, res = 0;
+  80314d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803152:	eb e3                	jmp    803137 <readn+0x54>
+
+0000000000803154 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803154:	55                   	push   %rbp
+  803155:	48 89 e5             	mov    %rsp,%rbp
+  803158:	41 56                	push   %r14
+  80315a:	41 55                	push   %r13
+  80315c:	41 54                	push   %r12
+  80315e:	53                   	push   %rbx
+  80315f:	48 83 ec 10          	sub    $0x10,%rsp
+  803163:	89 fb                	mov    %edi,%ebx
+  803165:	49 89 f4             	mov    %rsi,%r12
+  803168:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80316b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80316f:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  803176:	00 00 00 
+  803179:	ff d0                	call   *%rax
+  80317b:	85 c0                	test   %eax,%eax
+  80317d:	78 47                	js     8031c6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80317f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803183:	41 8b 3e             	mov    (%r14),%edi
+  803186:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80318a:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  803191:	00 00 00 
+  803194:	ff d0                	call   *%rax
+  803196:	85 c0                	test   %eax,%eax
+  803198:	78 30                	js     8031ca <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80319a:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80319f:	74 2d                	je     8031ce <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8031a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031a5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8031a9:	48 85 c0             	test   %rax,%rax
+  8031ac:	74 56                	je     803204 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8031ae:	4c 89 ea             	mov    %r13,%rdx
+  8031b1:	4c 89 e6             	mov    %r12,%rsi
+  8031b4:	4c 89 f7             	mov    %r14,%rdi
+  8031b7:	ff d0                	call   *%rax
+}
+  8031b9:	48 83 c4 10          	add    $0x10,%rsp
+  8031bd:	5b                   	pop    %rbx
+  8031be:	41 5c                	pop    %r12
+  8031c0:	41 5d                	pop    %r13
+  8031c2:	41 5e                	pop    %r14
+  8031c4:	5d                   	pop    %rbp
+  8031c5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8031c6:	48 98                	cltq
+  8031c8:	eb ef                	jmp    8031b9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8031ca:	48 98                	cltq
+  8031cc:	eb eb                	jmp    8031b9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031ce:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  8031d5:	00 00 00 
+  8031d8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8031de:	89 da                	mov    %ebx,%edx
+  8031e0:	48 bf 0d 68 80 00 00 	movabs $0x80680d,%rdi
+  8031e7:	00 00 00 
+  8031ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ef:	48 b9 f9 0e 80 00 00 	movabs $0x800ef9,%rcx
+  8031f6:	00 00 00 
+  8031f9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031fb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803202:	eb b5                	jmp    8031b9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803204:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80320b:	eb ac                	jmp    8031b9 <write+0x65>
+
+000000000080320d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80320d:	55                   	push   %rbp
+  80320e:	48 89 e5             	mov    %rsp,%rbp
+  803211:	53                   	push   %rbx
+  803212:	48 83 ec 18          	sub    $0x18,%rsp
+  803216:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803218:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80321c:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  803223:	00 00 00 
+  803226:	ff d0                	call   *%rax
+  803228:	85 c0                	test   %eax,%eax
+  80322a:	78 0c                	js     803238 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80322c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803230:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803233:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803238:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80323c:	c9                   	leave
+  80323d:	c3                   	ret
+
+000000000080323e <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80323e:	55                   	push   %rbp
+  80323f:	48 89 e5             	mov    %rsp,%rbp
+  803242:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  803246:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80324a:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  803251:	00 00 00 
+  803254:	ff d0                	call   *%rax
+  803256:	85 c0                	test   %eax,%eax
+  803258:	78 07                	js     803261 <tell+0x23>
+    return fdes->fd_offset;
+  80325a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80325e:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803261:	c9                   	leave
+  803262:	c3                   	ret
+
+0000000000803263 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803263:	55                   	push   %rbp
+  803264:	48 89 e5             	mov    %rsp,%rbp
+  803267:	41 55                	push   %r13
+  803269:	41 54                	push   %r12
+  80326b:	53                   	push   %rbx
+  80326c:	48 83 ec 18          	sub    $0x18,%rsp
+  803270:	89 fb                	mov    %edi,%ebx
+  803272:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803275:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803279:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  803280:	00 00 00 
+  803283:	ff d0                	call   *%rax
+  803285:	85 c0                	test   %eax,%eax
+  803287:	78 38                	js     8032c1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803289:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80328d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803291:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803295:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  80329c:	00 00 00 
+  80329f:	ff d0                	call   *%rax
+  8032a1:	85 c0                	test   %eax,%eax
+  8032a3:	78 1c                	js     8032c1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8032a5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8032aa:	74 20                	je     8032cc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8032ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032b0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8032b4:	48 85 c0             	test   %rax,%rax
+  8032b7:	74 47                	je     803300 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8032b9:	44 89 e6             	mov    %r12d,%esi
+  8032bc:	4c 89 ef             	mov    %r13,%rdi
+  8032bf:	ff d0                	call   *%rax
+}
+  8032c1:	48 83 c4 18          	add    $0x18,%rsp
+  8032c5:	5b                   	pop    %rbx
+  8032c6:	41 5c                	pop    %r12
+  8032c8:	41 5d                	pop    %r13
+  8032ca:	5d                   	pop    %rbp
+  8032cb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8032cc:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  8032d3:	00 00 00 
+  8032d6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8032dc:	89 da                	mov    %ebx,%edx
+  8032de:	48 bf d0 67 80 00 00 	movabs $0x8067d0,%rdi
+  8032e5:	00 00 00 
+  8032e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ed:	48 b9 f9 0e 80 00 00 	movabs $0x800ef9,%rcx
+  8032f4:	00 00 00 
+  8032f7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032fe:	eb c1                	jmp    8032c1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803300:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803305:	eb ba                	jmp    8032c1 <ftruncate+0x5e>
+
+0000000000803307 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803307:	55                   	push   %rbp
+  803308:	48 89 e5             	mov    %rsp,%rbp
+  80330b:	41 54                	push   %r12
+  80330d:	53                   	push   %rbx
+  80330e:	48 83 ec 10          	sub    $0x10,%rsp
+  803312:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803315:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803319:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  803320:	00 00 00 
+  803323:	ff d0                	call   *%rax
+  803325:	85 c0                	test   %eax,%eax
+  803327:	78 4e                	js     803377 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803329:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80332d:	41 8b 3c 24          	mov    (%r12),%edi
+  803331:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803335:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  80333c:	00 00 00 
+  80333f:	ff d0                	call   *%rax
+  803341:	85 c0                	test   %eax,%eax
+  803343:	78 32                	js     803377 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803345:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803349:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80334e:	74 30                	je     803380 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  803350:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803353:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80335a:	00 00 00 
+    stat->st_isdir = 0;
+  80335d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803364:	00 00 00 
+    stat->st_dev = dev;
+  803367:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80336e:	48 89 de             	mov    %rbx,%rsi
+  803371:	4c 89 e7             	mov    %r12,%rdi
+  803374:	ff 50 28             	call   *0x28(%rax)
+}
+  803377:	48 83 c4 10          	add    $0x10,%rsp
+  80337b:	5b                   	pop    %rbx
+  80337c:	41 5c                	pop    %r12
+  80337e:	5d                   	pop    %rbp
+  80337f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803380:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803385:	eb f0                	jmp    803377 <fstat+0x70>
+
+0000000000803387 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  803387:	55                   	push   %rbp
+  803388:	48 89 e5             	mov    %rsp,%rbp
+  80338b:	41 54                	push   %r12
+  80338d:	53                   	push   %rbx
+  80338e:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  803395:	41 89 fc             	mov    %edi,%r12d
+  803398:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80339a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80339e:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  8033a5:	00 00 00 
+  8033a8:	ff d0                	call   *%rax
+  8033aa:	85 c0                	test   %eax,%eax
+  8033ac:	78 31                	js     8033df <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8033ae:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8033b5:	44 89 e7             	mov    %r12d,%edi
+  8033b8:	48 b8 07 33 80 00 00 	movabs $0x803307,%rax
+  8033bf:	00 00 00 
+  8033c2:	ff d0                	call   *%rax
+  8033c4:	85 c0                	test   %eax,%eax
+  8033c6:	78 17                	js     8033df <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8033c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033cc:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8033cf:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8033d2:	39 d3                	cmp    %edx,%ebx
+  8033d4:	0f 4f da             	cmovg  %edx,%ebx
+  8033d7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8033da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033df:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8033e6:	5b                   	pop    %rbx
+  8033e7:	41 5c                	pop    %r12
+  8033e9:	5d                   	pop    %rbp
+  8033ea:	c3                   	ret
+
+00000000008033eb <seektoend>:
+{
+  8033eb:	55                   	push   %rbp
+  8033ec:	48 89 e5             	mov    %rsp,%rbp
+  8033ef:	53                   	push   %rbx
+  8033f0:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8033f7:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8033f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033fd:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  803404:	00 00 00 
+  803407:	ff d0                	call   *%rax
+  803409:	85 c0                	test   %eax,%eax
+  80340b:	78 28                	js     803435 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80340d:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  803414:	89 df                	mov    %ebx,%edi
+  803416:	48 b8 07 33 80 00 00 	movabs $0x803307,%rax
+  80341d:	00 00 00 
+  803420:	ff d0                	call   *%rax
+  803422:	85 c0                	test   %eax,%eax
+  803424:	78 0f                	js     803435 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  803426:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803429:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80342d:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  803430:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803435:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803439:	c9                   	leave
+  80343a:	c3                   	ret
+
+000000000080343b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80343b:	55                   	push   %rbp
+  80343c:	48 89 e5             	mov    %rsp,%rbp
+  80343f:	41 54                	push   %r12
+  803441:	53                   	push   %rbx
+  803442:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803445:	be 00 00 00 00       	mov    $0x0,%esi
+  80344a:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  803451:	00 00 00 
+  803454:	ff d0                	call   *%rax
+  803456:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803458:	85 c0                	test   %eax,%eax
+  80345a:	78 25                	js     803481 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80345c:	4c 89 e6             	mov    %r12,%rsi
+  80345f:	89 c7                	mov    %eax,%edi
+  803461:	48 b8 07 33 80 00 00 	movabs $0x803307,%rax
+  803468:	00 00 00 
+  80346b:	ff d0                	call   *%rax
+  80346d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803470:	89 df                	mov    %ebx,%edi
+  803472:	48 b8 a7 2e 80 00 00 	movabs $0x802ea7,%rax
+  803479:	00 00 00 
+  80347c:	ff d0                	call   *%rax
+
+    return res;
+  80347e:	44 89 e3             	mov    %r12d,%ebx
+}
+  803481:	89 d8                	mov    %ebx,%eax
+  803483:	5b                   	pop    %rbx
+  803484:	41 5c                	pop    %r12
+  803486:	5d                   	pop    %rbp
+  803487:	c3                   	ret
+
+0000000000803488 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  803488:	55                   	push   %rbp
+  803489:	48 89 e5             	mov    %rsp,%rbp
+  80348c:	53                   	push   %rbx
+  80348d:	48 83 ec 08          	sub    $0x8,%rsp
+  803491:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  803494:	48 b8 b4 2c 80 00 00 	movabs $0x802cb4,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+  8034a0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8034a4:	0f 87 ea 00 00 00    	ja     803594 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8034aa:	48 b8 04 a0 98 00 00 	movabs $0x98a004,%rax
+  8034b1:	00 00 00 
+  8034b4:	80 38 00             	cmpb   $0x0,(%rax)
+  8034b7:	75 35                	jne    8034ee <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8034b9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8034be:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8034c3:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8034c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034cd:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8034d4:	00 00 00 
+  8034d7:	ff d0                	call   *%rax
+  8034d9:	85 c0                	test   %eax,%eax
+  8034db:	0f 88 ba 00 00 00    	js     80359b <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8034e1:	48 b8 04 a0 98 00 00 	movabs $0x98a004,%rax
+  8034e8:	00 00 00 
+  8034eb:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8034ee:	48 89 df             	mov    %rbx,%rdi
+  8034f1:	48 b8 b4 2c 80 00 00 	movabs $0x802cb4,%rax
+  8034f8:	00 00 00 
+  8034fb:	ff d0                	call   *%rax
+  8034fd:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  803501:	48 ba 20 a0 98 00 00 	movabs $0x98a020,%rdx
+  803508:	00 00 00 
+  80350b:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80350f:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  803512:	39 39                	cmp    %edi,(%rcx)
+  803514:	74 46                	je     80355c <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  803516:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80351a:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  803521:	00 
+  803522:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  803529:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  803530:	00 
+  803531:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  803538:	00 
+  803539:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  803540:	00 
+  803541:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  803548:	00 
+  803549:	89 39                	mov    %edi,(%rcx)
+  80354b:	48 01 c6             	add    %rax,%rsi
+  80354e:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  803553:	48 89 c8             	mov    %rcx,%rax
+  803556:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80355a:	c9                   	leave
+  80355b:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80355c:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  803560:	48 be 20 a0 98 00 00 	movabs $0x98a020,%rsi
+  803567:	00 00 00 
+  80356a:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80356d:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  803571:	74 e0                	je     803553 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  803573:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80357a:	00 
+  80357b:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80357f:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  803586:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  803588:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80358b:	48 01 c2             	add    %rax,%rdx
+  80358e:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  803592:	eb bf                	jmp    803553 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  803594:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803599:	eb b8                	jmp    803553 <fbuf_get+0xcb>
+            return NULL;
+  80359b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035a0:	eb b1                	jmp    803553 <fbuf_get+0xcb>
+
+00000000008035a2 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8035a2:	55                   	push   %rbp
+  8035a3:	48 89 e5             	mov    %rsp,%rbp
+  8035a6:	53                   	push   %rbx
+  8035a7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8035ab:	48 b8 20 a5 98 00 00 	movabs $0x98a520,%rax
+  8035b2:	00 00 00 
+  8035b5:	48 8b 18             	mov    (%rax),%rbx
+  8035b8:	48 85 db             	test   %rbx,%rbx
+  8035bb:	74 16                	je     8035d3 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8035bd:	48 b8 20 a5 98 00 00 	movabs $0x98a520,%rax
+  8035c4:	00 00 00 
+  8035c7:	48 8b 18             	mov    (%rax),%rbx
+}
+  8035ca:	48 89 d8             	mov    %rbx,%rax
+  8035cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035d1:	c9                   	leave
+  8035d2:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8035d3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8035d8:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8035dd:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8035e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e7:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8035ee:	00 00 00 
+  8035f1:	ff d0                	call   *%rax
+  8035f3:	85 c0                	test   %eax,%eax
+  8035f5:	78 d3                	js     8035ca <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8035f7:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8035fc:	48 a3 20 a5 98 00 00 	movabs %rax,0x98a520
+  803603:	00 00 00 
+  803606:	eb b5                	jmp    8035bd <fsipc_bulk+0x1b>
+
+0000000000803608 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  803608:	55                   	push   %rbp
+  803609:	48 89 e5             	mov    %rsp,%rbp
+  80360c:	41 57                	push   %r15
+  80360e:	41 56                	push   %r14
+  803610:	41 55                	push   %r13
+  803612:	41 54                	push   %r12
+  803614:	53                   	push   %rbx
+  803615:	48 83 ec 08          	sub    $0x8,%rsp
+  803619:	41 89 fd             	mov    %edi,%r13d
+  80361c:	49 89 f6             	mov    %rsi,%r14
+  80361f:	49 89 d7             	mov    %rdx,%r15
+  803622:	48 89 cb             	mov    %rcx,%rbx
+  803625:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803628:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  80362f:	00 00 00 
+  803632:	83 38 00             	cmpl   $0x0,(%rax)
+  803635:	74 52                	je     803689 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  803637:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80363d:	4c 89 f9             	mov    %r15,%rcx
+  803640:	4c 89 f2             	mov    %r14,%rdx
+  803643:	44 89 ee             	mov    %r13d,%esi
+  803646:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  80364d:	00 00 00 
+  803650:	8b 38                	mov    (%rax),%edi
+  803652:	48 b8 ed 50 80 00 00 	movabs $0x8050ed,%rax
+  803659:	00 00 00 
+  80365c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80365e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803663:	4c 89 e2             	mov    %r12,%rdx
+  803666:	48 89 de             	mov    %rbx,%rsi
+  803669:	bf 00 00 00 00       	mov    $0x0,%edi
+  80366e:	48 b8 3d 4f 80 00 00 	movabs $0x804f3d,%rax
+  803675:	00 00 00 
+  803678:	ff d0                	call   *%rax
+}
+  80367a:	48 83 c4 08          	add    $0x8,%rsp
+  80367e:	5b                   	pop    %rbx
+  80367f:	41 5c                	pop    %r12
+  803681:	41 5d                	pop    %r13
+  803683:	41 5e                	pop    %r14
+  803685:	41 5f                	pop    %r15
+  803687:	5d                   	pop    %rbp
+  803688:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803689:	bf 03 00 00 00       	mov    $0x3,%edi
+  80368e:	48 b8 90 51 80 00 00 	movabs $0x805190,%rax
+  803695:	00 00 00 
+  803698:	ff d0                	call   *%rax
+  80369a:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  8036a1:	00 00 
+  8036a3:	eb 92                	jmp    803637 <fsipc_region+0x2f>
+
+00000000008036a5 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8036a5:	55                   	push   %rbp
+  8036a6:	48 89 e5             	mov    %rsp,%rbp
+  8036a9:	41 57                	push   %r15
+  8036ab:	41 56                	push   %r14
+  8036ad:	41 55                	push   %r13
+  8036af:	41 54                	push   %r12
+  8036b1:	53                   	push   %rbx
+  8036b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8036b6:	49 89 ff             	mov    %rdi,%r15
+  8036b9:	49 89 f6             	mov    %rsi,%r14
+  8036bc:	48 89 d3             	mov    %rdx,%rbx
+  8036bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8036c3:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8036c6:	48 b8 a2 35 80 00 00 	movabs $0x8035a2,%rax
+  8036cd:	00 00 00 
+  8036d0:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8036d2:	48 85 c0             	test   %rax,%rax
+  8036d5:	0f 84 cc 00 00 00    	je     8037a7 <devfile_write_direct+0x102>
+  8036db:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8036de:	48 85 db             	test   %rbx,%rbx
+  8036e1:	0f 84 ba 00 00 00    	je     8037a1 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8036e7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8036ed:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8036f4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8036f8:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8036fc:	4c 29 e3             	sub    %r12,%rbx
+  8036ff:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803704:	48 39 c3             	cmp    %rax,%rbx
+  803707:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80370b:	48 89 da             	mov    %rbx,%rdx
+  80370e:	4c 89 f6             	mov    %r14,%rsi
+  803711:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803715:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  80371c:	00 00 00 
+  80371f:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  803721:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803725:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  803729:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80372c:	44 01 e0             	add    %r12d,%eax
+  80372f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  803733:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  803737:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80373e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803745:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80374c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803752:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803757:	4c 89 ee             	mov    %r13,%rsi
+  80375a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80375f:	48 b8 08 36 80 00 00 	movabs $0x803608,%rax
+  803766:	00 00 00 
+  803769:	ff d0                	call   *%rax
+        if (res < 0)
+  80376b:	85 c0                	test   %eax,%eax
+  80376d:	78 29                	js     803798 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80376f:	74 2b                	je     80379c <devfile_write_direct+0xf7>
+        i += res;
+  803771:	48 98                	cltq
+  803773:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  803776:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  803779:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80377d:	49 39 c4             	cmp    %rax,%r12
+  803780:	0f 82 72 ff ff ff    	jb     8036f8 <devfile_write_direct+0x53>
+    return i;
+  803786:	4c 89 e0             	mov    %r12,%rax
+}
+  803789:	48 83 c4 28          	add    $0x28,%rsp
+  80378d:	5b                   	pop    %rbx
+  80378e:	41 5c                	pop    %r12
+  803790:	41 5d                	pop    %r13
+  803792:	41 5e                	pop    %r14
+  803794:	41 5f                	pop    %r15
+  803796:	5d                   	pop    %rbp
+  803797:	c3                   	ret
+            return res;
+  803798:	48 98                	cltq
+  80379a:	eb ed                	jmp    803789 <devfile_write_direct+0xe4>
+            return i;
+  80379c:	4c 89 e0             	mov    %r12,%rax
+  80379f:	eb e8                	jmp    803789 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8037a1:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8037a5:	eb df                	jmp    803786 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8037a7:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8037ae:	eb d9                	jmp    803789 <devfile_write_direct+0xe4>
+
+00000000008037b0 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8037b0:	55                   	push   %rbp
+  8037b1:	48 89 e5             	mov    %rsp,%rbp
+  8037b4:	41 56                	push   %r14
+  8037b6:	41 55                	push   %r13
+  8037b8:	41 54                	push   %r12
+  8037ba:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8037bb:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8037bf:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8037c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c8:	4d 39 ee             	cmp    %r13,%r14
+  8037cb:	0f 84 99 00 00 00    	je     80386a <fbuf_flush+0xba>
+  8037d1:	49 89 fc             	mov    %rdi,%r12
+  8037d4:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8037d7:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8037da:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8037de:	48 b8 b4 2c 80 00 00 	movabs $0x802cb4,%rax
+  8037e5:	00 00 00 
+  8037e8:	ff d0                	call   *%rax
+  8037ea:	48 89 c2             	mov    %rax,%rdx
+  8037ed:	48 c1 e2 04          	shl    $0x4,%rdx
+  8037f1:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8037f5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8037f9:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8037fe:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  803801:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803805:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80380c:	00 
+  80380d:	44 89 f1             	mov    %r14d,%ecx
+  803810:	4c 89 ea             	mov    %r13,%rdx
+  803813:	4c 89 e7             	mov    %r12,%rdi
+  803816:	48 b8 a5 36 80 00 00 	movabs $0x8036a5,%rax
+  80381d:	00 00 00 
+  803820:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803822:	48 85 c0             	test   %rax,%rax
+  803825:	78 43                	js     80386a <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  803827:	4c 39 e8             	cmp    %r13,%rax
+  80382a:	72 47                	jb     803873 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80382c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  803831:	83 c0 01             	add    $0x1,%eax
+  803834:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803839:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80383c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  803840:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  803844:	72 0f                	jb     803855 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  803846:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80384a:	48 39 c2             	cmp    %rax,%rdx
+  80384d:	48 0f 42 d0          	cmovb  %rax,%rdx
+  803851:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  803855:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80385c:	00 
+  80385d:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  803864:	00 
+    return 0;
+  803865:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80386a:	5b                   	pop    %rbx
+  80386b:	41 5c                	pop    %r12
+  80386d:	41 5d                	pop    %r13
+  80386f:	41 5e                	pop    %r14
+  803871:	5d                   	pop    %rbp
+  803872:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  803873:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803878:	eb f0                	jmp    80386a <fbuf_flush+0xba>
+
+000000000080387a <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80387a:	55                   	push   %rbp
+  80387b:	48 89 e5             	mov    %rsp,%rbp
+  80387e:	53                   	push   %rbx
+  80387f:	48 83 ec 08          	sub    $0x8,%rsp
+  803883:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  803886:	48 b8 88 34 80 00 00 	movabs $0x803488,%rax
+  80388d:	00 00 00 
+  803890:	ff d0                	call   *%rax
+  803892:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  803895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80389a:	48 85 f6             	test   %rsi,%rsi
+  80389d:	74 0f                	je     8038ae <devfile_sync+0x34>
+  80389f:	48 89 df             	mov    %rbx,%rdi
+  8038a2:	48 b8 b0 37 80 00 00 	movabs $0x8037b0,%rax
+  8038a9:	00 00 00 
+  8038ac:	ff d0                	call   *%rax
+}
+  8038ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038b2:	c9                   	leave
+  8038b3:	c3                   	ret
+
+00000000008038b4 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8038b4:	55                   	push   %rbp
+  8038b5:	48 89 e5             	mov    %rsp,%rbp
+  8038b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8038bc:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8038bf:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8038c6:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8038c7:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8038cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038d0:	48 be 00 90 98 00 00 	movabs $0x989000,%rsi
+  8038d7:	00 00 00 
+  8038da:	48 b8 08 36 80 00 00 	movabs $0x803608,%rax
+  8038e1:	00 00 00 
+  8038e4:	ff d0                	call   *%rax
+}
+  8038e6:	c9                   	leave
+  8038e7:	c3                   	ret
+
+00000000008038e8 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8038e8:	55                   	push   %rbp
+  8038e9:	48 89 e5             	mov    %rsp,%rbp
+  8038ec:	41 54                	push   %r12
+  8038ee:	53                   	push   %rbx
+  8038ef:	48 89 fb             	mov    %rdi,%rbx
+  8038f2:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8038f5:	48 b8 7a 38 80 00 00 	movabs $0x80387a,%rax
+  8038fc:	00 00 00 
+  8038ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803901:	85 c0                	test   %eax,%eax
+  803903:	78 63                	js     803968 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803905:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803908:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80390f:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  803911:	be 00 00 00 00       	mov    $0x0,%esi
+  803916:	bf 05 00 00 00       	mov    $0x5,%edi
+  80391b:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  803922:	00 00 00 
+  803925:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803927:	85 c0                	test   %eax,%eax
+  803929:	78 3d                	js     803968 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80392b:	48 bb 00 90 98 00 00 	movabs $0x989000,%rbx
+  803932:	00 00 00 
+  803935:	48 89 de             	mov    %rbx,%rsi
+  803938:	4c 89 e7             	mov    %r12,%rdi
+  80393b:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  803942:	00 00 00 
+  803945:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803947:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80394d:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  803954:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803955:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80395b:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  803962:	00 
+
+    return 0;
+  803963:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803968:	5b                   	pop    %rbx
+  803969:	41 5c                	pop    %r12
+  80396b:	5d                   	pop    %rbp
+  80396c:	c3                   	ret
+
+000000000080396d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80396d:	55                   	push   %rbp
+  80396e:	48 89 e5             	mov    %rsp,%rbp
+  803971:	41 54                	push   %r12
+  803973:	53                   	push   %rbx
+  803974:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  803977:	48 b8 7a 38 80 00 00 	movabs $0x80387a,%rax
+  80397e:	00 00 00 
+  803981:	ff d0                	call   *%rax
+  803983:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  803986:	48 89 df             	mov    %rbx,%rdi
+  803989:	48 b8 b4 2c 80 00 00 	movabs $0x802cb4,%rax
+  803990:	00 00 00 
+  803993:	ff d0                	call   *%rax
+  803995:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803999:	76 2e                	jbe    8039c9 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  80399b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80399e:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8039a5:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8039a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8039b1:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  8039b8:	00 00 00 
+  8039bb:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8039bd:	45 85 e4             	test   %r12d,%r12d
+  8039c0:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8039c4:	5b                   	pop    %rbx
+  8039c5:	41 5c                	pop    %r12
+  8039c7:	5d                   	pop    %rbp
+  8039c8:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8039c9:	48 89 df             	mov    %rbx,%rdi
+  8039cc:	48 b8 b4 2c 80 00 00 	movabs $0x802cb4,%rax
+  8039d3:	00 00 00 
+  8039d6:	ff d0                	call   *%rax
+  8039d8:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8039dc:	48 b8 20 a0 98 00 00 	movabs $0x98a020,%rax
+  8039e3:	00 00 00 
+  8039e6:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8039ed:	48 89 df             	mov    %rbx,%rdi
+  8039f0:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  8039f7:	00 00 00 
+  8039fa:	ff d0                	call   *%rax
+  8039fc:	48 89 c6             	mov    %rax,%rsi
+  8039ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a04:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a09:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+  803a15:	eb 84                	jmp    80399b <devfile_flush+0x2e>
+
+0000000000803a17 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a17:	55                   	push   %rbp
+  803a18:	48 89 e5             	mov    %rsp,%rbp
+  803a1b:	41 55                	push   %r13
+  803a1d:	41 54                	push   %r12
+  803a1f:	53                   	push   %rbx
+  803a20:	48 83 ec 08          	sub    $0x8,%rsp
+  803a24:	48 89 fb             	mov    %rdi,%rbx
+  803a27:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  803a2a:	48 b8 88 34 80 00 00 	movabs $0x803488,%rax
+  803a31:	00 00 00 
+  803a34:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803a36:	48 85 c0             	test   %rax,%rax
+  803a39:	74 51                	je     803a8c <devfile_trunc+0x75>
+  803a3b:	49 89 c4             	mov    %rax,%r12
+  803a3e:	48 89 c6             	mov    %rax,%rsi
+  803a41:	48 89 df             	mov    %rbx,%rdi
+  803a44:	48 b8 b0 37 80 00 00 	movabs $0x8037b0,%rax
+  803a4b:	00 00 00 
+  803a4e:	ff d0                	call   *%rax
+  803a50:	85 c0                	test   %eax,%eax
+  803a52:	78 2d                	js     803a81 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803a54:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  803a5b:	00 00 00 
+  803a5e:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803a61:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803a63:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803a67:	be 00 00 00 00       	mov    $0x0,%esi
+  803a6c:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a71:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  803a78:	00 00 00 
+  803a7b:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803a7d:	85 c0                	test   %eax,%eax
+  803a7f:	79 3e                	jns    803abf <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  803a81:	48 83 c4 08          	add    $0x8,%rsp
+  803a85:	5b                   	pop    %rbx
+  803a86:	41 5c                	pop    %r12
+  803a88:	41 5d                	pop    %r13
+  803a8a:	5d                   	pop    %rbp
+  803a8b:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803a8c:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  803a93:	00 00 00 
+  803a96:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803a99:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803a9b:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803a9f:	be 00 00 00 00       	mov    $0x0,%esi
+  803aa4:	bf 02 00 00 00       	mov    $0x2,%edi
+  803aa9:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  803ab0:	00 00 00 
+  803ab3:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803ab5:	85 c0                	test   %eax,%eax
+  803ab7:	78 c8                	js     803a81 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803ab9:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803abd:	eb c2                	jmp    803a81 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803abf:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  803ac2:	8d 51 01             	lea    0x1(%rcx),%edx
+  803ac5:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803ac8:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  803acd:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803ad4:	00 00 
+  803ad6:	eb a9                	jmp    803a81 <devfile_trunc+0x6a>
+
+0000000000803ad8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803ad8:	55                   	push   %rbp
+  803ad9:	48 89 e5             	mov    %rsp,%rbp
+  803adc:	41 57                	push   %r15
+  803ade:	41 56                	push   %r14
+  803ae0:	41 55                	push   %r13
+  803ae2:	41 54                	push   %r12
+  803ae4:	53                   	push   %rbx
+  803ae5:	48 83 ec 28          	sub    $0x28,%rsp
+  803ae9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803aed:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803af1:	49 89 d7             	mov    %rdx,%r15
+  803af4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803af8:	48 b8 88 34 80 00 00 	movabs $0x803488,%rax
+  803aff:	00 00 00 
+  803b02:	ff d0                	call   *%rax
+  803b04:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  803b07:	48 85 c0             	test   %rax,%rax
+  803b0a:	74 31                	je     803b3d <devfile_write+0x65>
+  803b0c:	4c 89 f8             	mov    %r15,%rax
+  803b0f:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  803b16:	77 25                	ja     803b3d <devfile_write+0x65>
+    size_t i = 0;
+  803b18:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  803b1e:	48 85 c0             	test   %rax,%rax
+  803b21:	0f 85 64 01 00 00    	jne    803c8b <devfile_write+0x1b3>
+    size_t i = 0;
+  803b27:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  803b2b:	4c 89 f8             	mov    %r15,%rax
+}
+  803b2e:	48 83 c4 28          	add    $0x28,%rsp
+  803b32:	5b                   	pop    %rbx
+  803b33:	41 5c                	pop    %r12
+  803b35:	41 5d                	pop    %r13
+  803b37:	41 5e                	pop    %r14
+  803b39:	41 5f                	pop    %r15
+  803b3b:	5d                   	pop    %rbp
+  803b3c:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803b3d:	48 85 db             	test   %rbx,%rbx
+  803b40:	74 5b                	je     803b9d <devfile_write+0xc5>
+  803b42:	48 89 de             	mov    %rbx,%rsi
+  803b45:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b49:	48 b8 b0 37 80 00 00 	movabs $0x8037b0,%rax
+  803b50:	00 00 00 
+  803b53:	ff d0                	call   *%rax
+  803b55:	85 c0                	test   %eax,%eax
+  803b57:	78 40                	js     803b99 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803b59:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b5d:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  803b60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b64:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803b68:	48 b8 a5 36 80 00 00 	movabs $0x8036a5,%rax
+  803b6f:	00 00 00 
+  803b72:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803b74:	48 85 c0             	test   %rax,%rax
+  803b77:	7e b5                	jle    803b2e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803b79:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803b7d:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  803b80:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  803b83:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803b86:	8d 51 01             	lea    0x1(%rcx),%edx
+  803b89:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803b8c:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  803b8f:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803b96:	00 
+  803b97:	eb 95                	jmp    803b2e <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803b99:	48 98                	cltq
+  803b9b:	eb 91                	jmp    803b2e <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803b9d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803ba1:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  803ba4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ba8:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803bac:	48 89 df             	mov    %rbx,%rdi
+  803baf:	48 b8 a5 36 80 00 00 	movabs $0x8036a5,%rax
+  803bb6:	00 00 00 
+  803bb9:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803bbb:	48 85 c0             	test   %rax,%rax
+  803bbe:	0f 8e 6a ff ff ff    	jle    803b2e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803bc4:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803bc7:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803bcb:	e9 5e ff ff ff       	jmp    803b2e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803bd0:	48 98                	cltq
+  803bd2:	4d 85 ff             	test   %r15,%r15
+  803bd5:	49 0f 45 c7          	cmovne %r15,%rax
+  803bd9:	e9 50 ff ff ff       	jmp    803b2e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803bde:	48 89 de             	mov    %rbx,%rsi
+  803be1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803be5:	48 b8 b0 37 80 00 00 	movabs $0x8037b0,%rax
+  803bec:	00 00 00 
+  803bef:	ff d0                	call   *%rax
+  803bf1:	85 c0                	test   %eax,%eax
+  803bf3:	0f 88 2b 01 00 00    	js     803d24 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803bf9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803bfd:	4c 01 f8             	add    %r15,%rax
+  803c00:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803c04:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c08:	48 b9 b4 2c 80 00 00 	movabs $0x802cb4,%rcx
+  803c0f:	00 00 00 
+  803c12:	ff d1                	call   *%rcx
+  803c14:	48 89 c2             	mov    %rax,%rdx
+  803c17:	48 c1 e2 04          	shl    $0x4,%rdx
+  803c1b:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803c1f:	48 c1 e0 0c          	shl    $0xc,%rax
+  803c23:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803c28:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803c2b:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803c32:	00 
+  803c33:	4c 89 ea             	mov    %r13,%rdx
+  803c36:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803c3a:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  803c41:	00 00 00 
+  803c44:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803c46:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803c4a:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803c4e:	48 39 c2             	cmp    %rax,%rdx
+  803c51:	0f 84 db 00 00 00    	je     803d32 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803c57:	4c 39 e2             	cmp    %r12,%rdx
+  803c5a:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  803c5e:	4d 01 ec             	add    %r13,%r12
+  803c61:	49 39 c4             	cmp    %rax,%r12
+  803c64:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803c68:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803c6c:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  803c70:	45 01 ee             	add    %r13d,%r14d
+  803c73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c77:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803c7b:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803c7e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c82:	49 39 c7             	cmp    %rax,%r15
+  803c85:	0f 83 a0 fe ff ff    	jae    803b2b <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803c8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c8f:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  803c93:	8b 43 08             	mov    0x8(%rbx),%eax
+  803c96:	44 39 f0             	cmp    %r14d,%eax
+  803c99:	7f 10                	jg     803cab <devfile_write+0x1d3>
+  803c9b:	48 98                	cltq
+  803c9d:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  803ca3:	49 63 d6             	movslq %r14d,%rdx
+  803ca6:	48 39 d0             	cmp    %rdx,%rax
+  803ca9:	7d 2d                	jge    803cd8 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803cab:	48 89 de             	mov    %rbx,%rsi
+  803cae:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cb2:	48 b8 b0 37 80 00 00 	movabs $0x8037b0,%rax
+  803cb9:	00 00 00 
+  803cbc:	ff d0                	call   *%rax
+  803cbe:	85 c0                	test   %eax,%eax
+  803cc0:	0f 88 0a ff ff ff    	js     803bd0 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803cc6:	44 89 f0             	mov    %r14d,%eax
+  803cc9:	66 b8 00 00          	mov    $0x0,%ax
+  803ccd:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803cd0:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803cd7:	00 
+        size_t off = pos - fb->fb_base;
+  803cd8:	45 89 f4             	mov    %r14d,%r12d
+  803cdb:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803cdf:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803ce2:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803ce6:	4d 29 fd             	sub    %r15,%r13
+  803ce9:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803cee:	4c 29 e0             	sub    %r12,%rax
+  803cf1:	49 39 c5             	cmp    %rax,%r13
+  803cf4:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803cf8:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803cfc:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803d00:	48 39 c2             	cmp    %rax,%rdx
+  803d03:	0f 84 f0 fe ff ff    	je     803bf9 <devfile_write+0x121>
+  803d09:	4c 39 e0             	cmp    %r12,%rax
+  803d0c:	0f 82 cc fe ff ff    	jb     803bde <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803d12:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803d16:	48 39 d0             	cmp    %rdx,%rax
+  803d19:	0f 83 da fe ff ff    	jae    803bf9 <devfile_write+0x121>
+  803d1f:	e9 ba fe ff ff       	jmp    803bde <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803d24:	48 98                	cltq
+  803d26:	4d 85 ff             	test   %r15,%r15
+  803d29:	49 0f 45 c7          	cmovne %r15,%rax
+  803d2d:	e9 fc fd ff ff       	jmp    803b2e <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803d32:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803d36:	4c 89 e2             	mov    %r12,%rdx
+  803d39:	e9 2a ff ff ff       	jmp    803c68 <devfile_write+0x190>
+
+0000000000803d3e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803d3e:	55                   	push   %rbp
+  803d3f:	48 89 e5             	mov    %rsp,%rbp
+  803d42:	41 57                	push   %r15
+  803d44:	41 56                	push   %r14
+  803d46:	41 55                	push   %r13
+  803d48:	41 54                	push   %r12
+  803d4a:	53                   	push   %rbx
+  803d4b:	48 83 ec 28          	sub    $0x28,%rsp
+  803d4f:	49 89 ff             	mov    %rdi,%r15
+  803d52:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803d56:	48 89 d3             	mov    %rdx,%rbx
+  803d59:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803d5d:	48 b8 88 34 80 00 00 	movabs $0x803488,%rax
+  803d64:	00 00 00 
+  803d67:	ff d0                	call   *%rax
+  803d69:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803d6c:	48 85 c0             	test   %rax,%rax
+  803d6f:	74 0d                	je     803d7e <devfile_read+0x40>
+  803d71:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803d78:	0f 86 1a 01 00 00    	jbe    803e98 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803d7e:	4d 85 e4             	test   %r12,%r12
+  803d81:	74 1a                	je     803d9d <devfile_read+0x5f>
+  803d83:	4c 89 e6             	mov    %r12,%rsi
+  803d86:	4c 89 ff             	mov    %r15,%rdi
+  803d89:	48 b8 b0 37 80 00 00 	movabs $0x8037b0,%rax
+  803d90:	00 00 00 
+  803d93:	ff d0                	call   *%rax
+  803d95:	85 c0                	test   %eax,%eax
+  803d97:	0f 88 e8 00 00 00    	js     803e85 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803d9d:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  803da1:	48 b8 a2 35 80 00 00 	movabs $0x8035a2,%rax
+  803da8:	00 00 00 
+  803dab:	ff d0                	call   *%rax
+  803dad:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803db0:	48 85 c0             	test   %rax,%rax
+  803db3:	0f 84 69 02 00 00    	je     804022 <devfile_read+0x2e4>
+    while (i < n) {
+  803db9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803dbe:	0f 84 ce 00 00 00    	je     803e92 <devfile_read+0x154>
+    size_t i = 0;
+  803dc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803dc9:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803dd0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803dd4:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803dd8:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803ddc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803de0:	48 29 da             	sub    %rbx,%rdx
+  803de3:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803de8:	48 39 c2             	cmp    %rax,%rdx
+  803deb:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803def:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803df3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803df7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803dfa:	01 d8                	add    %ebx,%eax
+  803dfc:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803e00:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803e04:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803e0b:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803e12:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803e19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803e1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e24:	4c 89 ee             	mov    %r13,%rsi
+  803e27:	bf 03 00 00 00       	mov    $0x3,%edi
+  803e2c:	48 b8 08 36 80 00 00 	movabs $0x803608,%rax
+  803e33:	00 00 00 
+  803e36:	ff d0                	call   *%rax
+        if (res < 0)
+  803e38:	85 c0                	test   %eax,%eax
+  803e3a:	78 4d                	js     803e89 <devfile_read+0x14b>
+        if (res == 0)
+  803e3c:	74 4f                	je     803e8d <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803e3e:	4c 63 e0             	movslq %eax,%r12
+  803e41:	4c 89 e2             	mov    %r12,%rdx
+  803e44:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803e48:	4c 89 f7             	mov    %r14,%rdi
+  803e4b:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  803e52:	00 00 00 
+  803e55:	ff d0                	call   *%rax
+        i += res;
+  803e57:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803e5a:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803e5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e61:	48 39 c3             	cmp    %rax,%rbx
+  803e64:	0f 82 72 ff ff ff    	jb     803ddc <devfile_read+0x9e>
+    return i;
+  803e6a:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803e6d:	48 85 c0             	test   %rax,%rax
+  803e70:	7e 04                	jle    803e76 <devfile_read+0x138>
+  803e72:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803e76:	48 83 c4 28          	add    $0x28,%rsp
+  803e7a:	5b                   	pop    %rbx
+  803e7b:	41 5c                	pop    %r12
+  803e7d:	41 5d                	pop    %r13
+  803e7f:	41 5e                	pop    %r14
+  803e81:	41 5f                	pop    %r15
+  803e83:	5d                   	pop    %rbp
+  803e84:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803e85:	48 98                	cltq
+  803e87:	eb ed                	jmp    803e76 <devfile_read+0x138>
+            return res;
+  803e89:	48 98                	cltq
+  803e8b:	eb e9                	jmp    803e76 <devfile_read+0x138>
+            return i;
+  803e8d:	48 89 d8             	mov    %rbx,%rax
+  803e90:	eb db                	jmp    803e6d <devfile_read+0x12f>
+    size_t i = 0;
+  803e92:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803e96:	eb d2                	jmp    803e6a <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803e98:	48 89 c6             	mov    %rax,%rsi
+  803e9b:	4c 89 ff             	mov    %r15,%rdi
+  803e9e:	48 b8 b0 37 80 00 00 	movabs $0x8037b0,%rax
+  803ea5:	00 00 00 
+  803ea8:	ff d0                	call   *%rax
+  803eaa:	85 c0                	test   %eax,%eax
+  803eac:	78 40                	js     803eee <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803eae:	4c 89 ff             	mov    %r15,%rdi
+  803eb1:	48 b8 b4 2c 80 00 00 	movabs $0x802cb4,%rax
+  803eb8:	00 00 00 
+  803ebb:	ff d0                	call   *%rax
+  803ebd:	48 89 c2             	mov    %rax,%rdx
+  803ec0:	48 c1 e2 04          	shl    $0x4,%rdx
+  803ec4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803ec8:	48 c1 e0 0c          	shl    $0xc,%rax
+  803ecc:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803ed1:	48 01 d0             	add    %rdx,%rax
+  803ed4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803ed8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803edd:	0f 84 33 01 00 00    	je     804016 <devfile_read+0x2d8>
+    size_t i = 0;
+  803ee3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803ee9:	e9 f5 00 00 00       	jmp    803fe3 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803eee:	48 98                	cltq
+  803ef0:	eb 84                	jmp    803e76 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803ef2:	44 89 e8             	mov    %r13d,%eax
+  803ef5:	66 b8 00 00          	mov    $0x0,%ax
+  803ef9:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803efe:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803f05:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803f07:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803f0b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803f0f:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803f11:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803f16:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803f19:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803f20:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803f21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803f27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803f2c:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803f31:	bf 03 00 00 00       	mov    $0x3,%edi
+  803f36:	48 b8 08 36 80 00 00 	movabs $0x803608,%rax
+  803f3d:	00 00 00 
+  803f40:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803f42:	85 c0                	test   %eax,%eax
+  803f44:	0f 88 be 00 00 00    	js     804008 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803f4a:	48 63 d0             	movslq %eax,%rdx
+  803f4d:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803f52:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803f57:	44 39 e8             	cmp    %r13d,%eax
+  803f5a:	0f 8e ba 00 00 00    	jle    80401a <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803f60:	49 63 c5             	movslq %r13d,%rax
+  803f63:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803f68:	48 29 c3             	sub    %rax,%rbx
+  803f6b:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803f70:	48 01 c3             	add    %rax,%rbx
+  803f73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f77:	4c 29 f0             	sub    %r14,%rax
+  803f7a:	48 39 c3             	cmp    %rax,%rbx
+  803f7d:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803f81:	4c 89 ff             	mov    %r15,%rdi
+  803f84:	48 b9 b4 2c 80 00 00 	movabs $0x802cb4,%rcx
+  803f8b:	00 00 00 
+  803f8e:	ff d1                	call   *%rcx
+  803f90:	48 89 c2             	mov    %rax,%rdx
+  803f93:	48 c1 e2 04          	shl    $0x4,%rdx
+  803f97:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803f9b:	48 c1 e0 0c          	shl    $0xc,%rax
+  803f9f:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803fa4:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803fa7:	44 89 ea             	mov    %r13d,%edx
+  803faa:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803faf:	48 63 d2             	movslq %edx,%rdx
+  803fb2:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803fb9:	00 
+  803fba:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803fbe:	4c 01 f7             	add    %r14,%rdi
+  803fc1:	48 89 da             	mov    %rbx,%rdx
+  803fc4:	48 b9 66 1c 80 00 00 	movabs $0x801c66,%rcx
+  803fcb:	00 00 00 
+  803fce:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803fd0:	41 01 dd             	add    %ebx,%r13d
+  803fd3:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803fd7:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803fda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fde:	49 39 c6             	cmp    %rax,%r14
+  803fe1:	73 37                	jae    80401a <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803fe3:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803fe7:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803fec:	44 39 e8             	cmp    %r13d,%eax
+  803fef:	0f 8f fd fe ff ff    	jg     803ef2 <devfile_read+0x1b4>
+  803ff5:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803ffa:	44 39 e8             	cmp    %r13d,%eax
+  803ffd:	0f 8f 5d ff ff ff    	jg     803f60 <devfile_read+0x222>
+  804003:	e9 ea fe ff ff       	jmp    803ef2 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  804008:	48 98                	cltq
+  80400a:	4d 85 f6             	test   %r14,%r14
+  80400d:	49 0f 45 c6          	cmovne %r14,%rax
+  804011:	e9 60 fe ff ff       	jmp    803e76 <devfile_read+0x138>
+    size_t i = 0;
+  804016:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80401a:	4c 89 f0             	mov    %r14,%rax
+  80401d:	e9 54 fe ff ff       	jmp    803e76 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  804022:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  804029:	e9 48 fe ff ff       	jmp    803e76 <devfile_read+0x138>
+
+000000000080402e <open>:
+open(const char *path, int mode) {
+  80402e:	55                   	push   %rbp
+  80402f:	48 89 e5             	mov    %rsp,%rbp
+  804032:	41 55                	push   %r13
+  804034:	41 54                	push   %r12
+  804036:	53                   	push   %rbx
+  804037:	48 83 ec 18          	sub    $0x18,%rsp
+  80403b:	49 89 fc             	mov    %rdi,%r12
+  80403e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  804041:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  804048:	00 00 00 
+  80404b:	ff d0                	call   *%rax
+  80404d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804053:	0f 87 8a 00 00 00    	ja     8040e3 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804059:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80405d:	48 b8 e2 2c 80 00 00 	movabs $0x802ce2,%rax
+  804064:	00 00 00 
+  804067:	ff d0                	call   *%rax
+  804069:	89 c3                	mov    %eax,%ebx
+  80406b:	85 c0                	test   %eax,%eax
+  80406d:	78 50                	js     8040bf <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80406f:	4c 89 e6             	mov    %r12,%rsi
+  804072:	48 bb 00 90 98 00 00 	movabs $0x989000,%rbx
+  804079:	00 00 00 
+  80407c:	48 89 df             	mov    %rbx,%rdi
+  80407f:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  804086:	00 00 00 
+  804089:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80408b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804092:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804096:	bf 01 00 00 00       	mov    $0x1,%edi
+  80409b:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  8040a2:	00 00 00 
+  8040a5:	ff d0                	call   *%rax
+  8040a7:	89 c3                	mov    %eax,%ebx
+  8040a9:	85 c0                	test   %eax,%eax
+  8040ab:	78 1f                	js     8040cc <open+0x9e>
+    return fd2num(fd);
+  8040ad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040b1:	48 b8 b4 2c 80 00 00 	movabs $0x802cb4,%rax
+  8040b8:	00 00 00 
+  8040bb:	ff d0                	call   *%rax
+  8040bd:	89 c3                	mov    %eax,%ebx
+}
+  8040bf:	89 d8                	mov    %ebx,%eax
+  8040c1:	48 83 c4 18          	add    $0x18,%rsp
+  8040c5:	5b                   	pop    %rbx
+  8040c6:	41 5c                	pop    %r12
+  8040c8:	41 5d                	pop    %r13
+  8040ca:	5d                   	pop    %rbp
+  8040cb:	c3                   	ret
+        fd_close(fd, 0);
+  8040cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8040d1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040d5:	48 b8 fd 2d 80 00 00 	movabs $0x802dfd,%rax
+  8040dc:	00 00 00 
+  8040df:	ff d0                	call   *%rax
+        return res;
+  8040e1:	eb dc                	jmp    8040bf <open+0x91>
+        return -E_BAD_PATH;
+  8040e3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8040e8:	eb d5                	jmp    8040bf <open+0x91>
+
+00000000008040ea <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8040ea:	55                   	push   %rbp
+  8040eb:	48 89 e5             	mov    %rsp,%rbp
+  8040ee:	41 57                	push   %r15
+  8040f0:	41 56                	push   %r14
+  8040f2:	41 55                	push   %r13
+  8040f4:	41 54                	push   %r12
+  8040f6:	53                   	push   %rbx
+  8040f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8040fb:	41 89 f6             	mov    %esi,%r14d
+  8040fe:	49 89 d7             	mov    %rdx,%r15
+  804101:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804104:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804108:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  80410f:	00 00 00 
+  804112:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804114:	85 c0                	test   %eax,%eax
+  804116:	0f 88 db 00 00 00    	js     8041f7 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80411c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804120:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  804127:	00 00 00 
+  80412a:	8b 00                	mov    (%rax),%eax
+  80412c:	39 07                	cmp    %eax,(%rdi)
+  80412e:	0f 85 db 00 00 00    	jne    80420f <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  804134:	45 85 f6             	test   %r14d,%r14d
+  804137:	0f 88 db 00 00 00    	js     804218 <fmap+0x12e>
+  80413d:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  804144:	0f 85 d7 00 00 00    	jne    804221 <fmap+0x137>
+  80414a:	4c 89 fb             	mov    %r15,%rbx
+  80414d:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  804153:	0f 85 d1 00 00 00    	jne    80422a <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  804159:	48 b8 7a 38 80 00 00 	movabs $0x80387a,%rax
+  804160:	00 00 00 
+  804163:	ff d0                	call   *%rax
+  804165:	85 c0                	test   %eax,%eax
+  804167:	0f 88 8e 00 00 00    	js     8041fb <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80416d:	49 bc 00 90 98 00 00 	movabs $0x989000,%r12
+  804174:	00 00 00 
+    while (i < n) {
+  804177:	4d 85 ed             	test   %r13,%r13
+  80417a:	0f 84 8a 00 00 00    	je     80420a <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  804180:	4c 89 ea             	mov    %r13,%rdx
+  804183:	48 29 da             	sub    %rbx,%rdx
+  804186:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80418d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  804193:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804197:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80419b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80419e:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8041a2:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8041a6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8041ab:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8041b0:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8041b4:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8041b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041bd:	4c 89 e6             	mov    %r12,%rsi
+  8041c0:	bf 09 00 00 00       	mov    $0x9,%edi
+  8041c5:	48 b8 08 36 80 00 00 	movabs $0x803608,%rax
+  8041cc:	00 00 00 
+  8041cf:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8041d1:	85 c0                	test   %eax,%eax
+  8041d3:	78 2a                	js     8041ff <fmap+0x115>
+        i += res;
+  8041d5:	48 98                	cltq
+  8041d7:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8041da:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8041de:	72 05                	jb     8041e5 <fmap+0xfb>
+    while (i < n) {
+  8041e0:	4c 39 eb             	cmp    %r13,%rbx
+  8041e3:	72 9b                	jb     804180 <fmap+0x96>
+    }
+    return i;
+  8041e5:	48 89 d8             	mov    %rbx,%rax
+}
+  8041e8:	48 83 c4 18          	add    $0x18,%rsp
+  8041ec:	5b                   	pop    %rbx
+  8041ed:	41 5c                	pop    %r12
+  8041ef:	41 5d                	pop    %r13
+  8041f1:	41 5e                	pop    %r14
+  8041f3:	41 5f                	pop    %r15
+  8041f5:	5d                   	pop    %rbp
+  8041f6:	c3                   	ret
+    if (res < 0) return res;
+  8041f7:	48 98                	cltq
+  8041f9:	eb ed                	jmp    8041e8 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8041fb:	48 98                	cltq
+  8041fd:	eb e9                	jmp    8041e8 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8041ff:	48 98                	cltq
+  804201:	48 85 db             	test   %rbx,%rbx
+  804204:	48 0f 45 c3          	cmovne %rbx,%rax
+  804208:	eb de                	jmp    8041e8 <fmap+0xfe>
+    size_t i = 0;
+  80420a:	4c 89 eb             	mov    %r13,%rbx
+  80420d:	eb d6                	jmp    8041e5 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80420f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  804216:	eb d0                	jmp    8041e8 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  804218:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80421f:	eb c7                	jmp    8041e8 <fmap+0xfe>
+  804221:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804228:	eb be                	jmp    8041e8 <fmap+0xfe>
+  80422a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804231:	eb b5                	jmp    8041e8 <fmap+0xfe>
+
+0000000000804233 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  804233:	55                   	push   %rbp
+  804234:	48 89 e5             	mov    %rsp,%rbp
+  804237:	41 56                	push   %r14
+  804239:	41 55                	push   %r13
+  80423b:	41 54                	push   %r12
+  80423d:	53                   	push   %rbx
+  80423e:	48 83 ec 10          	sub    $0x10,%rsp
+  804242:	89 fb                	mov    %edi,%ebx
+  804244:	41 89 f4             	mov    %esi,%r12d
+  804247:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80424a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80424e:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  804255:	00 00 00 
+  804258:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80425a:	85 c0                	test   %eax,%eax
+  80425c:	78 63                	js     8042c1 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80425e:	45 85 e4             	test   %r12d,%r12d
+  804261:	0f 88 80 00 00 00    	js     8042e7 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  804267:	45 89 e6             	mov    %r12d,%r14d
+  80426a:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  804271:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804275:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  80427c:	00 00 00 
+  80427f:	ff d0                	call   *%rax
+  804281:	48 89 c2             	mov    %rax,%rdx
+  804284:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804289:	44 89 f6             	mov    %r14d,%esi
+  80428c:	89 df                	mov    %ebx,%edi
+  80428e:	48 b8 ea 40 80 00 00 	movabs $0x8040ea,%rax
+  804295:	00 00 00 
+  804298:	ff d0                	call   *%rax
+  80429a:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80429d:	45 29 f4             	sub    %r14d,%r12d
+  8042a0:	4d 63 f4             	movslq %r12d,%r14
+  8042a3:	49 39 c6             	cmp    %rax,%r14
+  8042a6:	7c 1d                	jl     8042c5 <read_map+0x92>
+  8042a8:	48 85 c0             	test   %rax,%rax
+  8042ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b0:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8042b4:	48 83 c4 10          	add    $0x10,%rsp
+  8042b8:	5b                   	pop    %rbx
+  8042b9:	41 5c                	pop    %r12
+  8042bb:	41 5d                	pop    %r13
+  8042bd:	41 5e                	pop    %r14
+  8042bf:	5d                   	pop    %rbp
+  8042c0:	c3                   	ret
+    if (res < 0) return res;
+  8042c1:	48 98                	cltq
+  8042c3:	eb ef                	jmp    8042b4 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8042c5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8042c9:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  8042d0:	00 00 00 
+  8042d3:	ff d0                	call   *%rax
+  8042d5:	4d 63 e4             	movslq %r12d,%r12
+  8042d8:	4c 01 e0             	add    %r12,%rax
+  8042db:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8042df:	48 89 d8             	mov    %rbx,%rax
+  8042e2:	4c 29 f0             	sub    %r14,%rax
+  8042e5:	eb cd                	jmp    8042b4 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8042e7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8042ee:	eb c4                	jmp    8042b4 <read_map+0x81>
+
+00000000008042f0 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8042f0:	55                   	push   %rbp
+  8042f1:	48 89 e5             	mov    %rsp,%rbp
+  8042f4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8042f8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042fc:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  804303:	00 00 00 
+  804306:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804308:	85 c0                	test   %eax,%eax
+  80430a:	78 4a                	js     804356 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80430c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804310:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  804317:	00 00 00 
+  80431a:	8b 00                	mov    (%rax),%eax
+  80431c:	39 07                	cmp    %eax,(%rdi)
+  80431e:	75 38                	jne    804358 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  804320:	48 b8 7a 38 80 00 00 	movabs $0x80387a,%rax
+  804327:	00 00 00 
+  80432a:	ff d0                	call   *%rax
+  80432c:	85 c0                	test   %eax,%eax
+  80432e:	78 26                	js     804356 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804330:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804334:	8b 40 0c             	mov    0xc(%rax),%eax
+  804337:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80433e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  804340:	be 00 00 00 00       	mov    $0x0,%esi
+  804345:	bf 06 00 00 00       	mov    $0x6,%edi
+  80434a:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  804351:	00 00 00 
+  804354:	ff d0                	call   *%rax
+}
+  804356:	c9                   	leave
+  804357:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804358:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80435d:	eb f7                	jmp    804356 <fsync+0x66>
+
+000000000080435f <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80435f:	55                   	push   %rbp
+  804360:	48 89 e5             	mov    %rsp,%rbp
+  804363:	41 57                	push   %r15
+  804365:	41 56                	push   %r14
+  804367:	41 55                	push   %r13
+  804369:	41 54                	push   %r12
+  80436b:	53                   	push   %rbx
+  80436c:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  804370:	49 bc 20 a0 98 00 00 	movabs $0x98a020,%r12
+  804377:	00 00 00 
+  80437a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80437f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  804385:	49 bd 42 2d 80 00 00 	movabs $0x802d42,%r13
+  80438c:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80438f:	49 be 20 70 80 00 00 	movabs $0x807020,%r14
+  804396:	00 00 00 
+  804399:	eb 0c                	jmp    8043a7 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80439b:	83 c3 01             	add    $0x1,%ebx
+  80439e:	49 83 c4 28          	add    $0x28,%r12
+  8043a2:	83 fb 20             	cmp    $0x20,%ebx
+  8043a5:	74 33                	je     8043da <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8043a7:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8043ac:	74 ed                	je     80439b <flushall+0x3c>
+  8043ae:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8043b2:	89 df                	mov    %ebx,%edi
+  8043b4:	41 ff d5             	call   *%r13
+  8043b7:	85 c0                	test   %eax,%eax
+  8043b9:	78 e0                	js     80439b <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8043bb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8043bf:	41 8b 06             	mov    (%r14),%eax
+  8043c2:	39 07                	cmp    %eax,(%rdi)
+  8043c4:	75 d5                	jne    80439b <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8043c6:	48 b8 7a 38 80 00 00 	movabs $0x80387a,%rax
+  8043cd:	00 00 00 
+  8043d0:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8043d2:	85 c0                	test   %eax,%eax
+  8043d4:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8043d8:	eb c1                	jmp    80439b <flushall+0x3c>
+    }
+    return res;
+}
+  8043da:	44 89 f8             	mov    %r15d,%eax
+  8043dd:	48 83 c4 18          	add    $0x18,%rsp
+  8043e1:	5b                   	pop    %rbx
+  8043e2:	41 5c                	pop    %r12
+  8043e4:	41 5d                	pop    %r13
+  8043e6:	41 5e                	pop    %r14
+  8043e8:	41 5f                	pop    %r15
+  8043ea:	5d                   	pop    %rbp
+  8043eb:	c3                   	ret
+
+00000000008043ec <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8043ec:	55                   	push   %rbp
+  8043ed:	48 89 e5             	mov    %rsp,%rbp
+  8043f0:	53                   	push   %rbx
+  8043f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8043f5:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8043f8:	40 0f b6 c6          	movzbl %sil,%eax
+  8043fc:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  804403:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  804405:	be 00 00 00 00       	mov    $0x0,%esi
+  80440a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80440f:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  804416:	00 00 00 
+  804419:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80441b:	85 c0                	test   %eax,%eax
+  80441d:	78 23                	js     804442 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80441f:	ba 58 06 00 00       	mov    $0x658,%edx
+  804424:	48 be 00 90 98 00 00 	movabs $0x989000,%rsi
+  80442b:	00 00 00 
+  80442e:	48 89 df             	mov    %rbx,%rdi
+  804431:	48 b8 66 1c 80 00 00 	movabs $0x801c66,%rax
+  804438:	00 00 00 
+  80443b:	ff d0                	call   *%rax
+    return 0;
+  80443d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804442:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804446:	c9                   	leave
+  804447:	c3                   	ret
+
+0000000000804448 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  804448:	55                   	push   %rbp
+  804449:	48 89 e5             	mov    %rsp,%rbp
+  80444c:	53                   	push   %rbx
+  80444d:	48 83 ec 08          	sub    $0x8,%rsp
+  804451:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  804454:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  80445b:	00 00 00 
+  80445e:	ff d0                	call   *%rax
+  804460:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804466:	77 35                	ja     80449d <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  804468:	48 89 de             	mov    %rbx,%rsi
+  80446b:	48 bf 00 90 98 00 00 	movabs $0x989000,%rdi
+  804472:	00 00 00 
+  804475:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  80447c:	00 00 00 
+  80447f:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  804481:	be 00 00 00 00       	mov    $0x0,%esi
+  804486:	bf 07 00 00 00       	mov    $0x7,%edi
+  80448b:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  804492:	00 00 00 
+  804495:	ff d0                	call   *%rax
+}
+  804497:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80449b:	c9                   	leave
+  80449c:	c3                   	ret
+        return -E_BAD_PATH;
+  80449d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8044a2:	eb f3                	jmp    804497 <remove+0x4f>
+
+00000000008044a4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8044a4:	55                   	push   %rbp
+  8044a5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8044a8:	48 b8 5f 43 80 00 00 	movabs $0x80435f,%rax
+  8044af:	00 00 00 
+  8044b2:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8044b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8044b9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8044be:	48 b8 b4 38 80 00 00 	movabs $0x8038b4,%rax
+  8044c5:	00 00 00 
+  8044c8:	ff d0                	call   *%rax
+}
+  8044ca:	5d                   	pop    %rbp
+  8044cb:	c3                   	ret
+
+00000000008044cc <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8044cc:	55                   	push   %rbp
+  8044cd:	48 89 e5             	mov    %rsp,%rbp
+  8044d0:	41 54                	push   %r12
+  8044d2:	53                   	push   %rbx
+  8044d3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044d6:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  8044dd:	00 00 00 
+  8044e0:	ff d0                	call   *%rax
+  8044e2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8044e5:	48 be 60 68 80 00 00 	movabs $0x806860,%rsi
+  8044ec:	00 00 00 
+  8044ef:	48 89 df             	mov    %rbx,%rdi
+  8044f2:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  8044f9:	00 00 00 
+  8044fc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8044fe:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804503:	41 2b 04 24          	sub    (%r12),%eax
+  804507:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80450d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804514:	00 00 00 
+    stat->st_dev = &devpipe;
+  804517:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  80451e:	00 00 00 
+  804521:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  804528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80452d:	5b                   	pop    %rbx
+  80452e:	41 5c                	pop    %r12
+  804530:	5d                   	pop    %rbp
+  804531:	c3                   	ret
+
+0000000000804532 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804532:	55                   	push   %rbp
+  804533:	48 89 e5             	mov    %rsp,%rbp
+  804536:	41 54                	push   %r12
+  804538:	53                   	push   %rbx
+  804539:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80453c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804541:	48 89 fe             	mov    %rdi,%rsi
+  804544:	bf 00 00 00 00       	mov    $0x0,%edi
+  804549:	49 bc b0 21 80 00 00 	movabs $0x8021b0,%r12
+  804550:	00 00 00 
+  804553:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804556:	48 89 df             	mov    %rbx,%rdi
+  804559:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  804560:	00 00 00 
+  804563:	ff d0                	call   *%rax
+  804565:	48 89 c6             	mov    %rax,%rsi
+  804568:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80456d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804572:	41 ff d4             	call   *%r12
+}
+  804575:	5b                   	pop    %rbx
+  804576:	41 5c                	pop    %r12
+  804578:	5d                   	pop    %rbp
+  804579:	c3                   	ret
+
+000000000080457a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80457a:	55                   	push   %rbp
+  80457b:	48 89 e5             	mov    %rsp,%rbp
+  80457e:	41 57                	push   %r15
+  804580:	41 56                	push   %r14
+  804582:	41 55                	push   %r13
+  804584:	41 54                	push   %r12
+  804586:	53                   	push   %rbx
+  804587:	48 83 ec 18          	sub    $0x18,%rsp
+  80458b:	49 89 fc             	mov    %rdi,%r12
+  80458e:	49 89 f5             	mov    %rsi,%r13
+  804591:	49 89 d7             	mov    %rdx,%r15
+  804594:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804598:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  80459f:	00 00 00 
+  8045a2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8045a4:	4d 85 ff             	test   %r15,%r15
+  8045a7:	0f 84 af 00 00 00    	je     80465c <devpipe_write+0xe2>
+  8045ad:	48 89 c3             	mov    %rax,%rbx
+  8045b0:	4c 89 f8             	mov    %r15,%rax
+  8045b3:	4d 89 ef             	mov    %r13,%r15
+  8045b6:	4c 01 e8             	add    %r13,%rax
+  8045b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8045bd:	49 bd a5 1f 80 00 00 	movabs $0x801fa5,%r13
+  8045c4:	00 00 00 
+            sys_yield();
+  8045c7:	49 be 42 1f 80 00 00 	movabs $0x801f42,%r14
+  8045ce:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8045d1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8045d4:	48 63 ce             	movslq %esi,%rcx
+  8045d7:	48 63 03             	movslq (%rbx),%rax
+  8045da:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8045e0:	48 39 c1             	cmp    %rax,%rcx
+  8045e3:	72 2e                	jb     804613 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8045e5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8045ea:	48 89 da             	mov    %rbx,%rdx
+  8045ed:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045f2:	4c 89 e7             	mov    %r12,%rdi
+  8045f5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8045f8:	85 c0                	test   %eax,%eax
+  8045fa:	74 66                	je     804662 <devpipe_write+0xe8>
+            sys_yield();
+  8045fc:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8045ff:	8b 73 04             	mov    0x4(%rbx),%esi
+  804602:	48 63 ce             	movslq %esi,%rcx
+  804605:	48 63 03             	movslq (%rbx),%rax
+  804608:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80460e:	48 39 c1             	cmp    %rax,%rcx
+  804611:	73 d2                	jae    8045e5 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804613:	41 0f b6 3f          	movzbl (%r15),%edi
+  804617:	48 89 ca             	mov    %rcx,%rdx
+  80461a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80461e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804625:	08 10 20 
+  804628:	48 f7 e2             	mul    %rdx
+  80462b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80462f:	48 89 d0             	mov    %rdx,%rax
+  804632:	48 c1 e0 09          	shl    $0x9,%rax
+  804636:	48 29 d0             	sub    %rdx,%rax
+  804639:	48 c1 e0 03          	shl    $0x3,%rax
+  80463d:	48 29 c1             	sub    %rax,%rcx
+  804640:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804645:	83 c6 01             	add    $0x1,%esi
+  804648:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80464b:	49 83 c7 01          	add    $0x1,%r15
+  80464f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804653:	49 39 c7             	cmp    %rax,%r15
+  804656:	0f 85 75 ff ff ff    	jne    8045d1 <devpipe_write+0x57>
+    return n;
+  80465c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804660:	eb 05                	jmp    804667 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804662:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804667:	48 83 c4 18          	add    $0x18,%rsp
+  80466b:	5b                   	pop    %rbx
+  80466c:	41 5c                	pop    %r12
+  80466e:	41 5d                	pop    %r13
+  804670:	41 5e                	pop    %r14
+  804672:	41 5f                	pop    %r15
+  804674:	5d                   	pop    %rbp
+  804675:	c3                   	ret
+
+0000000000804676 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804676:	55                   	push   %rbp
+  804677:	48 89 e5             	mov    %rsp,%rbp
+  80467a:	41 57                	push   %r15
+  80467c:	41 56                	push   %r14
+  80467e:	41 55                	push   %r13
+  804680:	41 54                	push   %r12
+  804682:	53                   	push   %rbx
+  804683:	48 83 ec 18          	sub    $0x18,%rsp
+  804687:	49 89 fc             	mov    %rdi,%r12
+  80468a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80468e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804692:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  804699:	00 00 00 
+  80469c:	ff d0                	call   *%rax
+  80469e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8046a1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8046a7:	49 bd a5 1f 80 00 00 	movabs $0x801fa5,%r13
+  8046ae:	00 00 00 
+            sys_yield();
+  8046b1:	49 be 42 1f 80 00 00 	movabs $0x801f42,%r14
+  8046b8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8046bb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8046c0:	74 7d                	je     80473f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8046c2:	8b 03                	mov    (%rbx),%eax
+  8046c4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8046c7:	75 26                	jne    8046ef <devpipe_read+0x79>
+            if (i > 0) return i;
+  8046c9:	4d 85 ff             	test   %r15,%r15
+  8046cc:	75 77                	jne    804745 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8046ce:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8046d3:	48 89 da             	mov    %rbx,%rdx
+  8046d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046db:	4c 89 e7             	mov    %r12,%rdi
+  8046de:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8046e1:	85 c0                	test   %eax,%eax
+  8046e3:	74 72                	je     804757 <devpipe_read+0xe1>
+            sys_yield();
+  8046e5:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8046e8:	8b 03                	mov    (%rbx),%eax
+  8046ea:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8046ed:	74 df                	je     8046ce <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8046ef:	48 63 c8             	movslq %eax,%rcx
+  8046f2:	48 89 ca             	mov    %rcx,%rdx
+  8046f5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8046f9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804700:	08 10 20 
+  804703:	48 89 d0             	mov    %rdx,%rax
+  804706:	48 f7 e6             	mul    %rsi
+  804709:	48 c1 ea 06          	shr    $0x6,%rdx
+  80470d:	48 89 d0             	mov    %rdx,%rax
+  804710:	48 c1 e0 09          	shl    $0x9,%rax
+  804714:	48 29 d0             	sub    %rdx,%rax
+  804717:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80471e:	00 
+  80471f:	48 89 c8             	mov    %rcx,%rax
+  804722:	48 29 d0             	sub    %rdx,%rax
+  804725:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80472a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80472e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804732:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804735:	49 83 c7 01          	add    $0x1,%r15
+  804739:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80473d:	75 83                	jne    8046c2 <devpipe_read+0x4c>
+    return n;
+  80473f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804743:	eb 03                	jmp    804748 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804745:	4c 89 f8             	mov    %r15,%rax
+}
+  804748:	48 83 c4 18          	add    $0x18,%rsp
+  80474c:	5b                   	pop    %rbx
+  80474d:	41 5c                	pop    %r12
+  80474f:	41 5d                	pop    %r13
+  804751:	41 5e                	pop    %r14
+  804753:	41 5f                	pop    %r15
+  804755:	5d                   	pop    %rbp
+  804756:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80475c:	eb ea                	jmp    804748 <devpipe_read+0xd2>
+
+000000000080475e <pipe>:
+pipe(int pfd[2]) {
+  80475e:	55                   	push   %rbp
+  80475f:	48 89 e5             	mov    %rsp,%rbp
+  804762:	41 55                	push   %r13
+  804764:	41 54                	push   %r12
+  804766:	53                   	push   %rbx
+  804767:	48 83 ec 18          	sub    $0x18,%rsp
+  80476b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80476e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804772:	48 b8 e2 2c 80 00 00 	movabs $0x802ce2,%rax
+  804779:	00 00 00 
+  80477c:	ff d0                	call   *%rax
+  80477e:	89 c3                	mov    %eax,%ebx
+  804780:	85 c0                	test   %eax,%eax
+  804782:	0f 88 a0 01 00 00    	js     804928 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804788:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80478d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804792:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804796:	bf 00 00 00 00       	mov    $0x0,%edi
+  80479b:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8047a2:	00 00 00 
+  8047a5:	ff d0                	call   *%rax
+  8047a7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8047a9:	85 c0                	test   %eax,%eax
+  8047ab:	0f 88 77 01 00 00    	js     804928 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8047b1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8047b5:	48 b8 e2 2c 80 00 00 	movabs $0x802ce2,%rax
+  8047bc:	00 00 00 
+  8047bf:	ff d0                	call   *%rax
+  8047c1:	89 c3                	mov    %eax,%ebx
+  8047c3:	85 c0                	test   %eax,%eax
+  8047c5:	0f 88 43 01 00 00    	js     80490e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8047cb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8047d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047d5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8047d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047de:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8047e5:	00 00 00 
+  8047e8:	ff d0                	call   *%rax
+  8047ea:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8047ec:	85 c0                	test   %eax,%eax
+  8047ee:	0f 88 1a 01 00 00    	js     80490e <pipe+0x1b0>
+    va = fd2data(fd0);
+  8047f4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8047f8:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  8047ff:	00 00 00 
+  804802:	ff d0                	call   *%rax
+  804804:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804807:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80480c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804811:	48 89 c6             	mov    %rax,%rsi
+  804814:	bf 00 00 00 00       	mov    $0x0,%edi
+  804819:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  804820:	00 00 00 
+  804823:	ff d0                	call   *%rax
+  804825:	89 c3                	mov    %eax,%ebx
+  804827:	85 c0                	test   %eax,%eax
+  804829:	0f 88 c5 00 00 00    	js     8048f4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80482f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804833:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  80483a:	00 00 00 
+  80483d:	ff d0                	call   *%rax
+  80483f:	48 89 c1             	mov    %rax,%rcx
+  804842:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804848:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80484e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804853:	4c 89 ee             	mov    %r13,%rsi
+  804856:	bf 00 00 00 00       	mov    $0x0,%edi
+  80485b:	48 b8 38 20 80 00 00 	movabs $0x802038,%rax
+  804862:	00 00 00 
+  804865:	ff d0                	call   *%rax
+  804867:	89 c3                	mov    %eax,%ebx
+  804869:	85 c0                	test   %eax,%eax
+  80486b:	78 6e                	js     8048db <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80486d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804872:	4c 89 ef             	mov    %r13,%rdi
+  804875:	48 b8 73 1f 80 00 00 	movabs $0x801f73,%rax
+  80487c:	00 00 00 
+  80487f:	ff d0                	call   *%rax
+  804881:	83 f8 02             	cmp    $0x2,%eax
+  804884:	0f 85 ab 00 00 00    	jne    804935 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80488a:	a1 60 70 80 00 00 00 	movabs 0x807060,%eax
+  804891:	00 00 
+  804893:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804897:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804899:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80489d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8048a4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8048a8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8048aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048ae:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8048b5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8048b9:	48 bb b4 2c 80 00 00 	movabs $0x802cb4,%rbx
+  8048c0:	00 00 00 
+  8048c3:	ff d3                	call   *%rbx
+  8048c5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8048c9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8048cd:	ff d3                	call   *%rbx
+  8048cf:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8048d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8048d9:	eb 4d                	jmp    804928 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8048db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048e0:	4c 89 ee             	mov    %r13,%rsi
+  8048e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048e8:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  8048ef:	00 00 00 
+  8048f2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8048f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048f9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8048fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804902:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  804909:	00 00 00 
+  80490c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80490e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804913:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804917:	bf 00 00 00 00       	mov    $0x0,%edi
+  80491c:	48 b8 b0 21 80 00 00 	movabs $0x8021b0,%rax
+  804923:	00 00 00 
+  804926:	ff d0                	call   *%rax
+}
+  804928:	89 d8                	mov    %ebx,%eax
+  80492a:	48 83 c4 18          	add    $0x18,%rsp
+  80492e:	5b                   	pop    %rbx
+  80492f:	41 5c                	pop    %r12
+  804931:	41 5d                	pop    %r13
+  804933:	5d                   	pop    %rbp
+  804934:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804935:	48 b9 78 68 80 00 00 	movabs $0x806878,%rcx
+  80493c:	00 00 00 
+  80493f:	48 ba 98 67 80 00 00 	movabs $0x806798,%rdx
+  804946:	00 00 00 
+  804949:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80494e:	48 bf 67 68 80 00 00 	movabs $0x806867,%rdi
+  804955:	00 00 00 
+  804958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80495d:	49 b8 a9 0d 80 00 00 	movabs $0x800da9,%r8
+  804964:	00 00 00 
+  804967:	41 ff d0             	call   *%r8
+
+000000000080496a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80496a:	55                   	push   %rbp
+  80496b:	48 89 e5             	mov    %rsp,%rbp
+  80496e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804972:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804976:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  80497d:	00 00 00 
+  804980:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804982:	85 c0                	test   %eax,%eax
+  804984:	78 35                	js     8049bb <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804986:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80498a:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  804991:	00 00 00 
+  804994:	ff d0                	call   *%rax
+  804996:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804999:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80499e:	be 00 10 00 00       	mov    $0x1000,%esi
+  8049a3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8049a7:	48 b8 a5 1f 80 00 00 	movabs $0x801fa5,%rax
+  8049ae:	00 00 00 
+  8049b1:	ff d0                	call   *%rax
+  8049b3:	85 c0                	test   %eax,%eax
+  8049b5:	0f 94 c0             	sete   %al
+  8049b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8049bb:	c9                   	leave
+  8049bc:	c3                   	ret
+
+00000000008049bd <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8049bd:	48 89 f8             	mov    %rdi,%rax
+  8049c0:	48 c1 e8 27          	shr    $0x27,%rax
+  8049c4:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8049cb:	7f 00 00 
+  8049ce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8049d2:	f6 c2 01             	test   $0x1,%dl
+  8049d5:	74 6d                	je     804a44 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8049d7:	48 89 f8             	mov    %rdi,%rax
+  8049da:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8049de:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8049e5:	7f 00 00 
+  8049e8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8049ec:	f6 c2 01             	test   $0x1,%dl
+  8049ef:	74 62                	je     804a53 <get_uvpt_entry+0x96>
+  8049f1:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8049f8:	7f 00 00 
+  8049fb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8049ff:	f6 c2 80             	test   $0x80,%dl
+  804a02:	75 4f                	jne    804a53 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804a04:	48 89 f8             	mov    %rdi,%rax
+  804a07:	48 c1 e8 15          	shr    $0x15,%rax
+  804a0b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804a12:	7f 00 00 
+  804a15:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a19:	f6 c2 01             	test   $0x1,%dl
+  804a1c:	74 44                	je     804a62 <get_uvpt_entry+0xa5>
+  804a1e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804a25:	7f 00 00 
+  804a28:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a2c:	f6 c2 80             	test   $0x80,%dl
+  804a2f:	75 31                	jne    804a62 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804a31:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804a35:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804a3c:	7f 00 00 
+  804a3f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804a43:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804a44:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804a4b:	7f 00 00 
+  804a4e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804a52:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804a53:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804a5a:	7f 00 00 
+  804a5d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804a61:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804a62:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804a69:	7f 00 00 
+  804a6c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804a70:	c3                   	ret
+
+0000000000804a71 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  804a71:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804a74:	48 89 f9             	mov    %rdi,%rcx
+  804a77:	48 c1 e9 27          	shr    $0x27,%rcx
+  804a7b:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804a82:	7f 00 00 
+  804a85:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  804a89:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804a90:	f6 c1 01             	test   $0x1,%cl
+  804a93:	0f 84 b2 00 00 00    	je     804b4b <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804a99:	48 89 f9             	mov    %rdi,%rcx
+  804a9c:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804aa0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804aa7:	7f 00 00 
+  804aaa:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804aae:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804ab5:	40 f6 c6 01          	test   $0x1,%sil
+  804ab9:	0f 84 8c 00 00 00    	je     804b4b <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804abf:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804ac6:	7f 00 00 
+  804ac9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804acd:	a8 80                	test   $0x80,%al
+  804acf:	75 7b                	jne    804b4c <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804ad1:	48 89 f9             	mov    %rdi,%rcx
+  804ad4:	48 c1 e9 15          	shr    $0x15,%rcx
+  804ad8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804adf:	7f 00 00 
+  804ae2:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804ae6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804aed:	40 f6 c6 01          	test   $0x1,%sil
+  804af1:	74 58                	je     804b4b <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  804af3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804afa:	7f 00 00 
+  804afd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804b01:	a8 80                	test   $0x80,%al
+  804b03:	75 6c                	jne    804b71 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804b05:	48 89 f9             	mov    %rdi,%rcx
+  804b08:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804b0c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804b13:	7f 00 00 
+  804b16:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804b1a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804b21:	40 f6 c6 01          	test   $0x1,%sil
+  804b25:	74 24                	je     804b4b <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804b27:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804b2e:	7f 00 00 
+  804b31:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804b35:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804b3c:	ff ff 7f 
+  804b3f:	48 21 c8             	and    %rcx,%rax
+  804b42:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804b48:	48 09 d0             	or     %rdx,%rax
+}
+  804b4b:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804b4c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804b53:	7f 00 00 
+  804b56:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804b5a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804b61:	ff ff 7f 
+  804b64:	48 21 c8             	and    %rcx,%rax
+  804b67:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804b6d:	48 01 d0             	add    %rdx,%rax
+  804b70:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804b71:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804b78:	7f 00 00 
+  804b7b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804b7f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804b86:	ff ff 7f 
+  804b89:	48 21 c8             	and    %rcx,%rax
+  804b8c:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804b92:	48 01 d0             	add    %rdx,%rax
+  804b95:	c3                   	ret
+
+0000000000804b96 <get_prot>:
+
+int
+get_prot(void *va) {
+  804b96:	55                   	push   %rbp
+  804b97:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804b9a:	48 b8 bd 49 80 00 00 	movabs $0x8049bd,%rax
+  804ba1:	00 00 00 
+  804ba4:	ff d0                	call   *%rax
+  804ba6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804ba9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804bae:	89 c1                	mov    %eax,%ecx
+  804bb0:	83 c9 04             	or     $0x4,%ecx
+  804bb3:	f6 c2 01             	test   $0x1,%dl
+  804bb6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804bb9:	89 c1                	mov    %eax,%ecx
+  804bbb:	83 c9 02             	or     $0x2,%ecx
+  804bbe:	f6 c2 02             	test   $0x2,%dl
+  804bc1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804bc4:	89 c1                	mov    %eax,%ecx
+  804bc6:	83 c9 01             	or     $0x1,%ecx
+  804bc9:	48 85 d2             	test   %rdx,%rdx
+  804bcc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804bcf:	89 c1                	mov    %eax,%ecx
+  804bd1:	83 c9 40             	or     $0x40,%ecx
+  804bd4:	f6 c6 04             	test   $0x4,%dh
+  804bd7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804bda:	5d                   	pop    %rbp
+  804bdb:	c3                   	ret
+
+0000000000804bdc <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804bdc:	55                   	push   %rbp
+  804bdd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804be0:	48 b8 bd 49 80 00 00 	movabs $0x8049bd,%rax
+  804be7:	00 00 00 
+  804bea:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804bec:	48 c1 e8 06          	shr    $0x6,%rax
+  804bf0:	83 e0 01             	and    $0x1,%eax
+}
+  804bf3:	5d                   	pop    %rbp
+  804bf4:	c3                   	ret
+
+0000000000804bf5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804bf5:	55                   	push   %rbp
+  804bf6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804bf9:	48 b8 bd 49 80 00 00 	movabs $0x8049bd,%rax
+  804c00:	00 00 00 
+  804c03:	ff d0                	call   *%rax
+  804c05:	83 e0 01             	and    $0x1,%eax
+}
+  804c08:	5d                   	pop    %rbp
+  804c09:	c3                   	ret
+
+0000000000804c0a <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804c0a:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804c11:	7f 00 00 
+  804c14:	a8 01                	test   $0x1,%al
+  804c16:	75 06                	jne    804c1e <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c1d:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804c1e:	55                   	push   %rbp
+  804c1f:	48 89 e5             	mov    %rsp,%rbp
+  804c22:	41 57                	push   %r15
+  804c24:	41 56                	push   %r14
+  804c26:	41 55                	push   %r13
+  804c28:	41 54                	push   %r12
+  804c2a:	53                   	push   %rbx
+  804c2b:	48 83 ec 18          	sub    $0x18,%rsp
+  804c2f:	49 89 fe             	mov    %rdi,%r14
+  804c32:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804c35:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804c3c:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804c3d:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804c44:	7f 00 00 
+  804c47:	e9 81 00 00 00       	jmp    804ccd <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804c4c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804c53:	49 39 dd             	cmp    %rbx,%r13
+  804c56:	74 2b                	je     804c83 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804c58:	48 89 d8             	mov    %rbx,%rax
+  804c5b:	48 c1 e8 0c          	shr    $0xc,%rax
+  804c5f:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804c63:	f6 c2 01             	test   $0x1,%dl
+  804c66:	74 e4                	je     804c4c <foreach_shared_region+0x42>
+  804c68:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804c6c:	f6 c4 04             	test   $0x4,%ah
+  804c6f:	74 db                	je     804c4c <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804c71:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804c78:	4c 89 fa             	mov    %r15,%rdx
+  804c7b:	48 89 df             	mov    %rbx,%rdi
+  804c7e:	41 ff d6             	call   *%r14
+  804c81:	eb c9                	jmp    804c4c <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804c83:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804c8a:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804c8e:	74 22                	je     804cb2 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804c90:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804c97:	48 89 d8             	mov    %rbx,%rax
+  804c9a:	48 c1 e8 15          	shr    $0x15,%rax
+  804c9e:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804ca5:	7f 00 00 
+  804ca8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804cac:	a8 01                	test   $0x1,%al
+  804cae:	74 d3                	je     804c83 <foreach_shared_region+0x79>
+  804cb0:	eb a6                	jmp    804c58 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804cb2:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804cb9:	40 
+  804cba:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804cbe:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804cc5:	00 00 00 
+  804cc8:	48 39 c1             	cmp    %rax,%rcx
+  804ccb:	74 31                	je     804cfe <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804ccd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804cd1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804cd5:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804cdc:	7f 00 00 
+  804cdf:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804ce3:	a8 01                	test   $0x1,%al
+  804ce5:	74 cb                	je     804cb2 <foreach_shared_region+0xa8>
+  804ce7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ceb:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804cf2:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804cf8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804cfc:	eb 92                	jmp    804c90 <foreach_shared_region+0x86>
+}
+  804cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d03:	48 83 c4 18          	add    $0x18,%rsp
+  804d07:	5b                   	pop    %rbx
+  804d08:	41 5c                	pop    %r12
+  804d0a:	41 5d                	pop    %r13
+  804d0c:	41 5e                	pop    %r14
+  804d0e:	41 5f                	pop    %r15
+  804d10:	5d                   	pop    %rbp
+  804d11:	c3                   	ret
+
+0000000000804d12 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d17:	c3                   	ret
+
+0000000000804d18 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804d18:	55                   	push   %rbp
+  804d19:	48 89 e5             	mov    %rsp,%rbp
+  804d1c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804d1f:	48 be 9c 68 80 00 00 	movabs $0x80689c,%rsi
+  804d26:	00 00 00 
+  804d29:	48 b8 71 18 80 00 00 	movabs $0x801871,%rax
+  804d30:	00 00 00 
+  804d33:	ff d0                	call   *%rax
+    return 0;
+}
+  804d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d3a:	5d                   	pop    %rbp
+  804d3b:	c3                   	ret
+
+0000000000804d3c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804d3c:	55                   	push   %rbp
+  804d3d:	48 89 e5             	mov    %rsp,%rbp
+  804d40:	41 57                	push   %r15
+  804d42:	41 56                	push   %r14
+  804d44:	41 55                	push   %r13
+  804d46:	41 54                	push   %r12
+  804d48:	53                   	push   %rbx
+  804d49:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804d50:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804d57:	48 85 d2             	test   %rdx,%rdx
+  804d5a:	74 7a                	je     804dd6 <devcons_write+0x9a>
+  804d5c:	49 89 d6             	mov    %rdx,%r14
+  804d5f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804d65:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804d6a:	49 bf ff 1b 80 00 00 	movabs $0x801bff,%r15
+  804d71:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804d74:	4c 89 f3             	mov    %r14,%rbx
+  804d77:	48 29 f3             	sub    %rsi,%rbx
+  804d7a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804d7f:	48 39 c3             	cmp    %rax,%rbx
+  804d82:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804d86:	4c 63 eb             	movslq %ebx,%r13
+  804d89:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804d90:	48 01 c6             	add    %rax,%rsi
+  804d93:	4c 89 ea             	mov    %r13,%rdx
+  804d96:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804d9d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804da0:	4c 89 ee             	mov    %r13,%rsi
+  804da3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804daa:	48 b8 48 1e 80 00 00 	movabs $0x801e48,%rax
+  804db1:	00 00 00 
+  804db4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804db6:	41 01 dc             	add    %ebx,%r12d
+  804db9:	49 63 f4             	movslq %r12d,%rsi
+  804dbc:	4c 39 f6             	cmp    %r14,%rsi
+  804dbf:	72 b3                	jb     804d74 <devcons_write+0x38>
+    return res;
+  804dc1:	49 63 c4             	movslq %r12d,%rax
+}
+  804dc4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804dcb:	5b                   	pop    %rbx
+  804dcc:	41 5c                	pop    %r12
+  804dce:	41 5d                	pop    %r13
+  804dd0:	41 5e                	pop    %r14
+  804dd2:	41 5f                	pop    %r15
+  804dd4:	5d                   	pop    %rbp
+  804dd5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804dd6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804ddc:	eb e3                	jmp    804dc1 <devcons_write+0x85>
+
+0000000000804dde <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804dde:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804de1:	ba 00 00 00 00       	mov    $0x0,%edx
+  804de6:	48 85 c0             	test   %rax,%rax
+  804de9:	74 55                	je     804e40 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804deb:	55                   	push   %rbp
+  804dec:	48 89 e5             	mov    %rsp,%rbp
+  804def:	41 55                	push   %r13
+  804df1:	41 54                	push   %r12
+  804df3:	53                   	push   %rbx
+  804df4:	48 83 ec 08          	sub    $0x8,%rsp
+  804df8:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804dfb:	48 bb 75 1e 80 00 00 	movabs $0x801e75,%rbx
+  804e02:	00 00 00 
+  804e05:	49 bc 42 1f 80 00 00 	movabs $0x801f42,%r12
+  804e0c:	00 00 00 
+  804e0f:	eb 03                	jmp    804e14 <devcons_read+0x36>
+  804e11:	41 ff d4             	call   *%r12
+  804e14:	ff d3                	call   *%rbx
+  804e16:	85 c0                	test   %eax,%eax
+  804e18:	74 f7                	je     804e11 <devcons_read+0x33>
+    if (c < 0) return c;
+  804e1a:	48 63 d0             	movslq %eax,%rdx
+  804e1d:	78 13                	js     804e32 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804e1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e24:	83 f8 04             	cmp    $0x4,%eax
+  804e27:	74 09                	je     804e32 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804e29:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804e2d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804e32:	48 89 d0             	mov    %rdx,%rax
+  804e35:	48 83 c4 08          	add    $0x8,%rsp
+  804e39:	5b                   	pop    %rbx
+  804e3a:	41 5c                	pop    %r12
+  804e3c:	41 5d                	pop    %r13
+  804e3e:	5d                   	pop    %rbp
+  804e3f:	c3                   	ret
+  804e40:	48 89 d0             	mov    %rdx,%rax
+  804e43:	c3                   	ret
+
+0000000000804e44 <cputchar>:
+cputchar(int ch) {
+  804e44:	55                   	push   %rbp
+  804e45:	48 89 e5             	mov    %rsp,%rbp
+  804e48:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804e4c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804e50:	be 01 00 00 00       	mov    $0x1,%esi
+  804e55:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804e59:	48 b8 48 1e 80 00 00 	movabs $0x801e48,%rax
+  804e60:	00 00 00 
+  804e63:	ff d0                	call   *%rax
+}
+  804e65:	c9                   	leave
+  804e66:	c3                   	ret
+
+0000000000804e67 <getchar>:
+getchar(void) {
+  804e67:	55                   	push   %rbp
+  804e68:	48 89 e5             	mov    %rsp,%rbp
+  804e6b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804e6f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804e74:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804e78:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e7d:	48 b8 25 30 80 00 00 	movabs $0x803025,%rax
+  804e84:	00 00 00 
+  804e87:	ff d0                	call   *%rax
+  804e89:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804e8b:	85 c0                	test   %eax,%eax
+  804e8d:	78 06                	js     804e95 <getchar+0x2e>
+  804e8f:	74 08                	je     804e99 <getchar+0x32>
+  804e91:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804e95:	89 d0                	mov    %edx,%eax
+  804e97:	c9                   	leave
+  804e98:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804e99:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804e9e:	eb f5                	jmp    804e95 <getchar+0x2e>
+
+0000000000804ea0 <iscons>:
+iscons(int fdnum) {
+  804ea0:	55                   	push   %rbp
+  804ea1:	48 89 e5             	mov    %rsp,%rbp
+  804ea4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804ea8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804eac:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  804eb3:	00 00 00 
+  804eb6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804eb8:	85 c0                	test   %eax,%eax
+  804eba:	78 18                	js     804ed4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804ebc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ec0:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  804ec7:	00 00 00 
+  804eca:	8b 00                	mov    (%rax),%eax
+  804ecc:	39 02                	cmp    %eax,(%rdx)
+  804ece:	0f 94 c0             	sete   %al
+  804ed1:	0f b6 c0             	movzbl %al,%eax
+}
+  804ed4:	c9                   	leave
+  804ed5:	c3                   	ret
+
+0000000000804ed6 <opencons>:
+opencons(void) {
+  804ed6:	55                   	push   %rbp
+  804ed7:	48 89 e5             	mov    %rsp,%rbp
+  804eda:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804ede:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804ee2:	48 b8 e2 2c 80 00 00 	movabs $0x802ce2,%rax
+  804ee9:	00 00 00 
+  804eec:	ff d0                	call   *%rax
+  804eee:	85 c0                	test   %eax,%eax
+  804ef0:	78 49                	js     804f3b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804ef2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804ef7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804efc:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804f00:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f05:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  804f0c:	00 00 00 
+  804f0f:	ff d0                	call   *%rax
+  804f11:	85 c0                	test   %eax,%eax
+  804f13:	78 26                	js     804f3b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804f15:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f19:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  804f20:	00 00 
+  804f22:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804f24:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804f28:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804f2f:	48 b8 b4 2c 80 00 00 	movabs $0x802cb4,%rax
+  804f36:	00 00 00 
+  804f39:	ff d0                	call   *%rax
+}
+  804f3b:	c9                   	leave
+  804f3c:	c3                   	ret
+
+0000000000804f3d <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804f3d:	55                   	push   %rbp
+  804f3e:	48 89 e5             	mov    %rsp,%rbp
+  804f41:	41 55                	push   %r13
+  804f43:	41 54                	push   %r12
+  804f45:	53                   	push   %rbx
+  804f46:	48 83 ec 08          	sub    $0x8,%rsp
+  804f4a:	49 89 fc             	mov    %rdi,%r12
+  804f4d:	48 89 f7             	mov    %rsi,%rdi
+  804f50:	48 89 d3             	mov    %rdx,%rbx
+  804f53:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804f56:	48 85 f6             	test   %rsi,%rsi
+  804f59:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804f60:	00 00 00 
+  804f63:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804f67:	be 00 10 00 00       	mov    $0x1000,%esi
+  804f6c:	48 85 d2             	test   %rdx,%rdx
+  804f6f:	74 03                	je     804f74 <ipc_recv+0x37>
+  804f71:	48 8b 32             	mov    (%rdx),%rsi
+  804f74:	48 b8 7e 23 80 00 00 	movabs $0x80237e,%rax
+  804f7b:	00 00 00 
+  804f7e:	ff d0                	call   *%rax
+    if (errno) {
+  804f80:	85 c0                	test   %eax,%eax
+  804f82:	74 1c                	je     804fa0 <ipc_recv+0x63>
+        if (from_env_store)
+  804f84:	4d 85 e4             	test   %r12,%r12
+  804f87:	74 08                	je     804f91 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804f89:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804f90:	00 
+
+        if (perm_store)
+  804f91:	4d 85 ed             	test   %r13,%r13
+  804f94:	74 74                	je     80500a <ipc_recv+0xcd>
+            *perm_store = 0;
+  804f96:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804f9d:	00 
+  804f9e:	eb 6a                	jmp    80500a <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804fa0:	4d 85 e4             	test   %r12,%r12
+  804fa3:	74 14                	je     804fb9 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804fa5:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  804fac:	00 00 00 
+  804faf:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804fb5:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804fb9:	48 85 db             	test   %rbx,%rbx
+  804fbc:	74 23                	je     804fe1 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804fbe:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  804fc5:	00 00 00 
+  804fc8:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804fce:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fd3:	85 c9                	test   %ecx,%ecx
+  804fd5:	74 07                	je     804fde <ipc_recv+0xa1>
+  804fd7:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804fde:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804fe1:	4d 85 ed             	test   %r13,%r13
+  804fe4:	74 14                	je     804ffa <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804fe6:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  804fed:	00 00 00 
+  804ff0:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804ff6:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804ffa:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  805001:	00 00 00 
+  805004:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  80500a:	48 83 c4 08          	add    $0x8,%rsp
+  80500e:	5b                   	pop    %rbx
+  80500f:	41 5c                	pop    %r12
+  805011:	41 5d                	pop    %r13
+  805013:	5d                   	pop    %rbp
+  805014:	c3                   	ret
+
+0000000000805015 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805015:	55                   	push   %rbp
+  805016:	48 89 e5             	mov    %rsp,%rbp
+  805019:	41 55                	push   %r13
+  80501b:	41 54                	push   %r12
+  80501d:	53                   	push   %rbx
+  80501e:	48 83 ec 08          	sub    $0x8,%rsp
+  805022:	49 89 fc             	mov    %rdi,%r12
+  805025:	48 89 f7             	mov    %rsi,%rdi
+  805028:	48 89 d3             	mov    %rdx,%rbx
+  80502b:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80502e:	48 85 f6             	test   %rsi,%rsi
+  805031:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805038:	00 00 00 
+  80503b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  80503f:	be 00 10 00 00       	mov    $0x1000,%esi
+  805044:	48 85 d2             	test   %rdx,%rdx
+  805047:	74 03                	je     80504c <ipc_try_recv+0x37>
+  805049:	48 8b 32             	mov    (%rdx),%rsi
+  80504c:	48 b8 e7 23 80 00 00 	movabs $0x8023e7,%rax
+  805053:	00 00 00 
+  805056:	ff d0                	call   *%rax
+    if (errno) {
+  805058:	85 c0                	test   %eax,%eax
+  80505a:	75 75                	jne    8050d1 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80505c:	4d 85 e4             	test   %r12,%r12
+  80505f:	74 14                	je     805075 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  805061:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  805068:	00 00 00 
+  80506b:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  805071:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  805075:	48 85 db             	test   %rbx,%rbx
+  805078:	74 23                	je     80509d <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80507a:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  805081:	00 00 00 
+  805084:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80508a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80508f:	85 c9                	test   %ecx,%ecx
+  805091:	74 07                	je     80509a <ipc_try_recv+0x85>
+  805093:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80509a:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80509d:	4d 85 ed             	test   %r13,%r13
+  8050a0:	74 14                	je     8050b6 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8050a2:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  8050a9:	00 00 00 
+  8050ac:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8050b2:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8050b6:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  8050bd:	00 00 00 
+  8050c0:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  8050c6:	48 83 c4 08          	add    $0x8,%rsp
+  8050ca:	5b                   	pop    %rbx
+  8050cb:	41 5c                	pop    %r12
+  8050cd:	41 5d                	pop    %r13
+  8050cf:	5d                   	pop    %rbp
+  8050d0:	c3                   	ret
+        if (from_env_store)
+  8050d1:	4d 85 e4             	test   %r12,%r12
+  8050d4:	74 08                	je     8050de <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8050d6:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8050dd:	00 
+        if (perm_store)
+  8050de:	4d 85 ed             	test   %r13,%r13
+  8050e1:	74 e3                	je     8050c6 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8050e3:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8050ea:	00 
+  8050eb:	eb d9                	jmp    8050c6 <ipc_try_recv+0xb1>
+
+00000000008050ed <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8050ed:	55                   	push   %rbp
+  8050ee:	48 89 e5             	mov    %rsp,%rbp
+  8050f1:	41 57                	push   %r15
+  8050f3:	41 56                	push   %r14
+  8050f5:	41 55                	push   %r13
+  8050f7:	41 54                	push   %r12
+  8050f9:	53                   	push   %rbx
+  8050fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8050fe:	41 89 fd             	mov    %edi,%r13d
+  805101:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  805104:	48 89 d3             	mov    %rdx,%rbx
+  805107:	49 89 cc             	mov    %rcx,%r12
+  80510a:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80510e:	48 85 d2             	test   %rdx,%rdx
+  805111:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805118:	00 00 00 
+  80511b:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80511f:	49 be 52 23 80 00 00 	movabs $0x802352,%r14
+  805126:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  805129:	49 bf 42 1f 80 00 00 	movabs $0x801f42,%r15
+  805130:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  805133:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  805136:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80513a:	4c 89 e1             	mov    %r12,%rcx
+  80513d:	48 89 da             	mov    %rbx,%rdx
+  805140:	44 89 ef             	mov    %r13d,%edi
+  805143:	41 ff d6             	call   *%r14
+  805146:	85 c0                	test   %eax,%eax
+  805148:	74 37                	je     805181 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  80514a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80514d:	75 05                	jne    805154 <ipc_send+0x67>
+        sys_yield();
+  80514f:	41 ff d7             	call   *%r15
+  805152:	eb df                	jmp    805133 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  805154:	89 c1                	mov    %eax,%ecx
+  805156:	48 ba a8 68 80 00 00 	movabs $0x8068a8,%rdx
+  80515d:	00 00 00 
+  805160:	be 65 00 00 00       	mov    $0x65,%esi
+  805165:	48 bf c3 68 80 00 00 	movabs $0x8068c3,%rdi
+  80516c:	00 00 00 
+  80516f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805174:	49 b8 a9 0d 80 00 00 	movabs $0x800da9,%r8
+  80517b:	00 00 00 
+  80517e:	41 ff d0             	call   *%r8
+    }
+}
+  805181:	48 83 c4 18          	add    $0x18,%rsp
+  805185:	5b                   	pop    %rbx
+  805186:	41 5c                	pop    %r12
+  805188:	41 5d                	pop    %r13
+  80518a:	41 5e                	pop    %r14
+  80518c:	41 5f                	pop    %r15
+  80518e:	5d                   	pop    %rbp
+  80518f:	c3                   	ret
+
+0000000000805190 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805190:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805195:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80519c:	00 00 00 
+  80519f:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8051a6:	48 01 ca             	add    %rcx,%rdx
+  8051a9:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8051af:	39 fa                	cmp    %edi,%edx
+  8051b1:	74 12                	je     8051c5 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8051b3:	48 83 c0 01          	add    $0x1,%rax
+  8051b7:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8051bd:	75 e0                	jne    80519f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8051bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051c4:	c3                   	ret
+            return envs[i].env_id;
+  8051c5:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8051cc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8051d3:	00 00 00 
+  8051d6:	48 01 d0             	add    %rdx,%rax
+  8051d9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8051df:	c3                   	ret
+
+00000000008051e0 <__text_end>:
+  8051e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051e7:	00 00 00 
+  8051ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051f1:	00 00 00 
+  8051f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8051fb:	00 00 00 
+  8051fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805205:	00 00 00 
+  805208:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80520f:	00 00 00 
+  805212:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805219:	00 00 00 
+  80521c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805223:	00 00 00 
+  805226:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80522d:	00 00 00 
+  805230:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805237:	00 00 00 
+  80523a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805241:	00 00 00 
+  805244:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80524b:	00 00 00 
+  80524e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805255:	00 00 00 
+  805258:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80525f:	00 00 00 
+  805262:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805269:	00 00 00 
+  80526c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805273:	00 00 00 
+  805276:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80527d:	00 00 00 
+  805280:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805287:	00 00 00 
+  80528a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805291:	00 00 00 
+  805294:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80529b:	00 00 00 
+  80529e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052a5:	00 00 00 
+  8052a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052af:	00 00 00 
+  8052b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052b9:	00 00 00 
+  8052bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052c3:	00 00 00 
+  8052c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052cd:	00 00 00 
+  8052d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052d7:	00 00 00 
+  8052da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052e1:	00 00 00 
+  8052e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052eb:	00 00 00 
+  8052ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052f5:	00 00 00 
+  8052f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052ff:	00 00 00 
+  805302:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805309:	00 00 00 
+  80530c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805313:	00 00 00 
+  805316:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80531d:	00 00 00 
+  805320:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805327:	00 00 00 
+  80532a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805331:	00 00 00 
+  805334:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80533b:	00 00 00 
+  80533e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805345:	00 00 00 
+  805348:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80534f:	00 00 00 
+  805352:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805359:	00 00 00 
+  80535c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805363:	00 00 00 
+  805366:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80536d:	00 00 00 
+  805370:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805377:	00 00 00 
+  80537a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805381:	00 00 00 
+  805384:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80538b:	00 00 00 
+  80538e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805395:	00 00 00 
+  805398:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80539f:	00 00 00 
+  8053a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053a9:	00 00 00 
+  8053ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053b3:	00 00 00 
+  8053b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053bd:	00 00 00 
+  8053c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053c7:	00 00 00 
+  8053ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053d1:	00 00 00 
+  8053d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053db:	00 00 00 
+  8053de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053e5:	00 00 00 
+  8053e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053ef:	00 00 00 
+  8053f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053f9:	00 00 00 
+  8053fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805403:	00 00 00 
+  805406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80540d:	00 00 00 
+  805410:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805417:	00 00 00 
+  80541a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805421:	00 00 00 
+  805424:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80542b:	00 00 00 
+  80542e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805435:	00 00 00 
+  805438:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80543f:	00 00 00 
+  805442:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805449:	00 00 00 
+  80544c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805453:	00 00 00 
+  805456:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80545d:	00 00 00 
+  805460:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805467:	00 00 00 
+  80546a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805471:	00 00 00 
+  805474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80547b:	00 00 00 
+  80547e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805485:	00 00 00 
+  805488:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80548f:	00 00 00 
+  805492:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805499:	00 00 00 
+  80549c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054a3:	00 00 00 
+  8054a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054ad:	00 00 00 
+  8054b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054b7:	00 00 00 
+  8054ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054c1:	00 00 00 
+  8054c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054cb:	00 00 00 
+  8054ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054d5:	00 00 00 
+  8054d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054df:	00 00 00 
+  8054e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054e9:	00 00 00 
+  8054ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054f3:	00 00 00 
+  8054f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054fd:	00 00 00 
+  805500:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805507:	00 00 00 
+  80550a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805511:	00 00 00 
+  805514:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80551b:	00 00 00 
+  80551e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805525:	00 00 00 
+  805528:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80552f:	00 00 00 
+  805532:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805539:	00 00 00 
+  80553c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805543:	00 00 00 
+  805546:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80554d:	00 00 00 
+  805550:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805557:	00 00 00 
+  80555a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805561:	00 00 00 
+  805564:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80556b:	00 00 00 
+  80556e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805575:	00 00 00 
+  805578:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80557f:	00 00 00 
+  805582:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805589:	00 00 00 
+  80558c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805593:	00 00 00 
+  805596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80559d:	00 00 00 
+  8055a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055a7:	00 00 00 
+  8055aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055b1:	00 00 00 
+  8055b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055bb:	00 00 00 
+  8055be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055c5:	00 00 00 
+  8055c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055cf:	00 00 00 
+  8055d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055d9:	00 00 00 
+  8055dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055e3:	00 00 00 
+  8055e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055ed:	00 00 00 
+  8055f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055f7:	00 00 00 
+  8055fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805601:	00 00 00 
+  805604:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80560b:	00 00 00 
+  80560e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805615:	00 00 00 
+  805618:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80561f:	00 00 00 
+  805622:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805629:	00 00 00 
+  80562c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805633:	00 00 00 
+  805636:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80563d:	00 00 00 
+  805640:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805647:	00 00 00 
+  80564a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805651:	00 00 00 
+  805654:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80565b:	00 00 00 
+  80565e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805665:	00 00 00 
+  805668:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80566f:	00 00 00 
+  805672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805679:	00 00 00 
+  80567c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805683:	00 00 00 
+  805686:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80568d:	00 00 00 
+  805690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805697:	00 00 00 
+  80569a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056a1:	00 00 00 
+  8056a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056ab:	00 00 00 
+  8056ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056b5:	00 00 00 
+  8056b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056bf:	00 00 00 
+  8056c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056c9:	00 00 00 
+  8056cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056d3:	00 00 00 
+  8056d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056dd:	00 00 00 
+  8056e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056e7:	00 00 00 
+  8056ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056f1:	00 00 00 
+  8056f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056fb:	00 00 00 
+  8056fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805705:	00 00 00 
+  805708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80570f:	00 00 00 
+  805712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805719:	00 00 00 
+  80571c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805723:	00 00 00 
+  805726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80572d:	00 00 00 
+  805730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805737:	00 00 00 
+  80573a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805741:	00 00 00 
+  805744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80574b:	00 00 00 
+  80574e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805755:	00 00 00 
+  805758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80575f:	00 00 00 
+  805762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805769:	00 00 00 
+  80576c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805773:	00 00 00 
+  805776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80577d:	00 00 00 
+  805780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805787:	00 00 00 
+  80578a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805791:	00 00 00 
+  805794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80579b:	00 00 00 
+  80579e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057a5:	00 00 00 
+  8057a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057af:	00 00 00 
+  8057b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057b9:	00 00 00 
+  8057bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057c3:	00 00 00 
+  8057c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057cd:	00 00 00 
+  8057d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057d7:	00 00 00 
+  8057da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057e1:	00 00 00 
+  8057e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057eb:	00 00 00 
+  8057ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057f5:	00 00 00 
+  8057f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057ff:	00 00 00 
+  805802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805809:	00 00 00 
+  80580c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805813:	00 00 00 
+  805816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80581d:	00 00 00 
+  805820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805827:	00 00 00 
+  80582a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805831:	00 00 00 
+  805834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80583b:	00 00 00 
+  80583e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805845:	00 00 00 
+  805848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80584f:	00 00 00 
+  805852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805859:	00 00 00 
+  80585c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805863:	00 00 00 
+  805866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80586d:	00 00 00 
+  805870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805877:	00 00 00 
+  80587a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805881:	00 00 00 
+  805884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80588b:	00 00 00 
+  80588e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805895:	00 00 00 
+  805898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80589f:	00 00 00 
+  8058a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058a9:	00 00 00 
+  8058ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058b3:	00 00 00 
+  8058b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058bd:	00 00 00 
+  8058c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058c7:	00 00 00 
+  8058ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058d1:	00 00 00 
+  8058d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058db:	00 00 00 
+  8058de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058e5:	00 00 00 
+  8058e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058ef:	00 00 00 
+  8058f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058f9:	00 00 00 
+  8058fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805903:	00 00 00 
+  805906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80590d:	00 00 00 
+  805910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805917:	00 00 00 
+  80591a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805921:	00 00 00 
+  805924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80592b:	00 00 00 
+  80592e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805935:	00 00 00 
+  805938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80593f:	00 00 00 
+  805942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805949:	00 00 00 
+  80594c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805953:	00 00 00 
+  805956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80595d:	00 00 00 
+  805960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805967:	00 00 00 
+  80596a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805971:	00 00 00 
+  805974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80597b:	00 00 00 
+  80597e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805985:	00 00 00 
+  805988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80598f:	00 00 00 
+  805992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805999:	00 00 00 
+  80599c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059a3:	00 00 00 
+  8059a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059ad:	00 00 00 
+  8059b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059b7:	00 00 00 
+  8059ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059c1:	00 00 00 
+  8059c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059cb:	00 00 00 
+  8059ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059d5:	00 00 00 
+  8059d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059df:	00 00 00 
+  8059e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059e9:	00 00 00 
+  8059ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059f3:	00 00 00 
+  8059f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059fd:	00 00 00 
+  805a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a07:	00 00 00 
+  805a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a11:	00 00 00 
+  805a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a1b:	00 00 00 
+  805a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a25:	00 00 00 
+  805a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a2f:	00 00 00 
+  805a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a39:	00 00 00 
+  805a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a43:	00 00 00 
+  805a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a4d:	00 00 00 
+  805a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a57:	00 00 00 
+  805a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a61:	00 00 00 
+  805a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a6b:	00 00 00 
+  805a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a75:	00 00 00 
+  805a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a7f:	00 00 00 
+  805a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a89:	00 00 00 
+  805a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a93:	00 00 00 
+  805a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a9d:	00 00 00 
+  805aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aa7:	00 00 00 
+  805aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ab1:	00 00 00 
+  805ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805abb:	00 00 00 
+  805abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ac5:	00 00 00 
+  805ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805acf:	00 00 00 
+  805ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ad9:	00 00 00 
+  805adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ae3:	00 00 00 
+  805ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aed:	00 00 00 
+  805af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805af7:	00 00 00 
+  805afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b01:	00 00 00 
+  805b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b0b:	00 00 00 
+  805b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b15:	00 00 00 
+  805b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b1f:	00 00 00 
+  805b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b29:	00 00 00 
+  805b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b33:	00 00 00 
+  805b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b3d:	00 00 00 
+  805b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b47:	00 00 00 
+  805b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b51:	00 00 00 
+  805b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b5b:	00 00 00 
+  805b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b65:	00 00 00 
+  805b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b6f:	00 00 00 
+  805b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b79:	00 00 00 
+  805b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b83:	00 00 00 
+  805b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b8d:	00 00 00 
+  805b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b97:	00 00 00 
+  805b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ba1:	00 00 00 
+  805ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bab:	00 00 00 
+  805bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bb5:	00 00 00 
+  805bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bbf:	00 00 00 
+  805bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bc9:	00 00 00 
+  805bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bd3:	00 00 00 
+  805bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bdd:	00 00 00 
+  805be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805be7:	00 00 00 
+  805bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bf1:	00 00 00 
+  805bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bfb:	00 00 00 
+  805bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c05:	00 00 00 
+  805c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c0f:	00 00 00 
+  805c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c19:	00 00 00 
+  805c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c23:	00 00 00 
+  805c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c2d:	00 00 00 
+  805c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c37:	00 00 00 
+  805c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c41:	00 00 00 
+  805c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c4b:	00 00 00 
+  805c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c55:	00 00 00 
+  805c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c5f:	00 00 00 
+  805c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c69:	00 00 00 
+  805c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c73:	00 00 00 
+  805c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c7d:	00 00 00 
+  805c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c87:	00 00 00 
+  805c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c91:	00 00 00 
+  805c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c9b:	00 00 00 
+  805c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ca5:	00 00 00 
+  805ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805caf:	00 00 00 
+  805cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cb9:	00 00 00 
+  805cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cc3:	00 00 00 
+  805cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ccd:	00 00 00 
+  805cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cd7:	00 00 00 
+  805cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ce1:	00 00 00 
+  805ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ceb:	00 00 00 
+  805cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cf5:	00 00 00 
+  805cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cff:	00 00 00 
+  805d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d09:	00 00 00 
+  805d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d13:	00 00 00 
+  805d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d1d:	00 00 00 
+  805d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d27:	00 00 00 
+  805d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d31:	00 00 00 
+  805d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d3b:	00 00 00 
+  805d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d45:	00 00 00 
+  805d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d4f:	00 00 00 
+  805d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d59:	00 00 00 
+  805d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d63:	00 00 00 
+  805d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d6d:	00 00 00 
+  805d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d77:	00 00 00 
+  805d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d81:	00 00 00 
+  805d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d8b:	00 00 00 
+  805d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d95:	00 00 00 
+  805d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d9f:	00 00 00 
+  805da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805da9:	00 00 00 
+  805dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805db3:	00 00 00 
+  805db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dbd:	00 00 00 
+  805dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dc7:	00 00 00 
+  805dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dd1:	00 00 00 
+  805dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ddb:	00 00 00 
+  805dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805de5:	00 00 00 
+  805de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805def:	00 00 00 
+  805df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805df9:	00 00 00 
+  805dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e03:	00 00 00 
+  805e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e0d:	00 00 00 
+  805e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e17:	00 00 00 
+  805e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e21:	00 00 00 
+  805e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e2b:	00 00 00 
+  805e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e35:	00 00 00 
+  805e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e3f:	00 00 00 
+  805e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e49:	00 00 00 
+  805e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e53:	00 00 00 
+  805e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e5d:	00 00 00 
+  805e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e67:	00 00 00 
+  805e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e71:	00 00 00 
+  805e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e7b:	00 00 00 
+  805e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e85:	00 00 00 
+  805e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e8f:	00 00 00 
+  805e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e99:	00 00 00 
+  805e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ea3:	00 00 00 
+  805ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ead:	00 00 00 
+  805eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eb7:	00 00 00 
+  805eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ec1:	00 00 00 
+  805ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ecb:	00 00 00 
+  805ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ed5:	00 00 00 
+  805ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805edf:	00 00 00 
+  805ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ee9:	00 00 00 
+  805eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ef3:	00 00 00 
+  805ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805efd:	00 00 00 
+  805f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f07:	00 00 00 
+  805f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f11:	00 00 00 
+  805f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f1b:	00 00 00 
+  805f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f25:	00 00 00 
+  805f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f2f:	00 00 00 
+  805f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f39:	00 00 00 
+  805f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f43:	00 00 00 
+  805f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f4d:	00 00 00 
+  805f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f57:	00 00 00 
+  805f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f61:	00 00 00 
+  805f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f6b:	00 00 00 
+  805f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f75:	00 00 00 
+  805f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f7f:	00 00 00 
+  805f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f89:	00 00 00 
+  805f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f93:	00 00 00 
+  805f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f9d:	00 00 00 
+  805fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fa7:	00 00 00 
+  805faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fb1:	00 00 00 
+  805fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fbb:	00 00 00 
+  805fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fc5:	00 00 00 
+  805fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fcf:	00 00 00 
+  805fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fd9:	00 00 00 
+  805fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fe3:	00 00 00 
+  805fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fed:	00 00 00 
+  805ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ff7:	00 00 00 
+  805ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
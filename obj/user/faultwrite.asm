@@ -0,0 +1,8096 @@
+
+obj/user/faultwrite:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0e 00 00 00       	call   800031 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+#ifndef __clang_analyzer__
+    *(volatile unsigned *)0 = 0;
+  800025:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80002c:	00 00 00 00 
+#endif
+}
+  800030:	c3                   	ret
+
+0000000000800031 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800031:	55                   	push   %rbp
+  800032:	48 89 e5             	mov    %rsp,%rbp
+  800035:	41 56                	push   %r14
+  800037:	41 55                	push   %r13
+  800039:	41 54                	push   %r12
+  80003b:	53                   	push   %rbx
+  80003c:	41 89 fd             	mov    %edi,%r13d
+  80003f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800042:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800049:	00 00 00 
+  80004c:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800053:	00 00 00 
+  800056:	48 39 c2             	cmp    %rax,%rdx
+  800059:	73 17                	jae    800072 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80005b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005e:	49 89 c4             	mov    %rax,%r12
+  800061:	48 83 c3 08          	add    $0x8,%rbx
+  800065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006a:	ff 53 f8             	call   *-0x8(%rbx)
+  80006d:	4c 39 e3             	cmp    %r12,%rbx
+  800070:	72 ef                	jb     800061 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800072:	48 b8 c6 01 80 00 00 	movabs $0x8001c6,%rax
+  800079:	00 00 00 
+  80007c:	ff d0                	call   *%rax
+  80007e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800083:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80008a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800091:	00 00 00 
+  800094:	48 01 d0             	add    %rdx,%rax
+  800097:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  80009e:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000a1:	45 85 ed             	test   %r13d,%r13d
+  8000a4:	7e 0d                	jle    8000b3 <libmain+0x82>
+  8000a6:	49 8b 06             	mov    (%r14),%rax
+  8000a9:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000b0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b3:	4c 89 f6             	mov    %r14,%rsi
+  8000b6:	44 89 ef             	mov    %r13d,%edi
+  8000b9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000c0:	00 00 00 
+  8000c3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c5:	48 b8 da 00 80 00 00 	movabs $0x8000da,%rax
+  8000cc:	00 00 00 
+  8000cf:	ff d0                	call   *%rax
+#endif
+}
+  8000d1:	5b                   	pop    %rbx
+  8000d2:	41 5c                	pop    %r12
+  8000d4:	41 5d                	pop    %r13
+  8000d6:	41 5e                	pop    %r14
+  8000d8:	5d                   	pop    %rbp
+  8000d9:	c3                   	ret
+
+00000000008000da <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000da:	55                   	push   %rbp
+  8000db:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000de:	48 b8 c2 0e 80 00 00 	movabs $0x800ec2,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ef:	48 b8 5b 01 80 00 00 	movabs $0x80015b,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+}
+  8000fb:	5d                   	pop    %rbp
+  8000fc:	c3                   	ret
+
+00000000008000fd <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000fd:	55                   	push   %rbp
+  8000fe:	48 89 e5             	mov    %rsp,%rbp
+  800101:	53                   	push   %rbx
+  800102:	48 89 fa             	mov    %rdi,%rdx
+  800105:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800108:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80010d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800112:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800117:	be 00 00 00 00       	mov    $0x0,%esi
+  80011c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800122:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800124:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800128:	c9                   	leave
+  800129:	c3                   	ret
+
+000000000080012a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80012a:	55                   	push   %rbp
+  80012b:	48 89 e5             	mov    %rsp,%rbp
+  80012e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80012f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800134:	ba 00 00 00 00       	mov    $0x0,%edx
+  800139:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80013e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800143:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800148:	be 00 00 00 00       	mov    $0x0,%esi
+  80014d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800153:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800155:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800159:	c9                   	leave
+  80015a:	c3                   	ret
+
+000000000080015b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80015b:	55                   	push   %rbp
+  80015c:	48 89 e5             	mov    %rsp,%rbp
+  80015f:	53                   	push   %rbx
+  800160:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800164:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800167:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80016c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800171:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800176:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80017b:	be 00 00 00 00       	mov    $0x0,%esi
+  800180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800186:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800188:	48 85 c0             	test   %rax,%rax
+  80018b:	7f 06                	jg     800193 <sys_env_destroy+0x38>
+}
+  80018d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800191:	c9                   	leave
+  800192:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800193:	49 89 c0             	mov    %rax,%r8
+  800196:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80019b:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8001a2:	00 00 00 
+  8001a5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001aa:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8001b1:	00 00 00 
+  8001b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b9:	49 b9 25 2f 80 00 00 	movabs $0x802f25,%r9
+  8001c0:	00 00 00 
+  8001c3:	41 ff d1             	call   *%r9
+
+00000000008001c6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001c6:	55                   	push   %rbp
+  8001c7:	48 89 e5             	mov    %rsp,%rbp
+  8001ca:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001cb:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ef:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f5:	c9                   	leave
+  8001f6:	c3                   	ret
+
+00000000008001f7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8001f7:	55                   	push   %rbp
+  8001f8:	48 89 e5             	mov    %rsp,%rbp
+  8001fb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800201:	ba 00 00 00 00       	mov    $0x0,%edx
+  800206:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80020b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800210:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800215:	be 00 00 00 00       	mov    $0x0,%esi
+  80021a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800220:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800222:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800226:	c9                   	leave
+  800227:	c3                   	ret
+
+0000000000800228 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800228:	55                   	push   %rbp
+  800229:	48 89 e5             	mov    %rsp,%rbp
+  80022c:	53                   	push   %rbx
+  80022d:	48 89 fa             	mov    %rdi,%rdx
+  800230:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800233:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800238:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80023f:	00 00 00 
+  800242:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800247:	be 00 00 00 00       	mov    $0x0,%esi
+  80024c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800252:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800254:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800258:	c9                   	leave
+  800259:	c3                   	ret
+
+000000000080025a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80025a:	55                   	push   %rbp
+  80025b:	48 89 e5             	mov    %rsp,%rbp
+  80025e:	53                   	push   %rbx
+  80025f:	49 89 f8             	mov    %rdi,%r8
+  800262:	48 89 d3             	mov    %rdx,%rbx
+  800265:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800268:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80026d:	4c 89 c2             	mov    %r8,%rdx
+  800270:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800273:	be 00 00 00 00       	mov    $0x0,%esi
+  800278:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80027e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800280:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800284:	c9                   	leave
+  800285:	c3                   	ret
+
+0000000000800286 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800286:	55                   	push   %rbp
+  800287:	48 89 e5             	mov    %rsp,%rbp
+  80028a:	53                   	push   %rbx
+  80028b:	48 83 ec 08          	sub    $0x8,%rsp
+  80028f:	89 f8                	mov    %edi,%eax
+  800291:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800294:	48 63 f9             	movslq %ecx,%rdi
+  800297:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80029a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80029f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002af:	48 85 c0             	test   %rax,%rax
+  8002b2:	7f 06                	jg     8002ba <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002ba:	49 89 c0             	mov    %rax,%r8
+  8002bd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002c2:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8002c9:	00 00 00 
+  8002cc:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002d1:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8002d8:	00 00 00 
+  8002db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e0:	49 b9 25 2f 80 00 00 	movabs $0x802f25,%r9
+  8002e7:	00 00 00 
+  8002ea:	41 ff d1             	call   *%r9
+
+00000000008002ed <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002ed:	55                   	push   %rbp
+  8002ee:	48 89 e5             	mov    %rsp,%rbp
+  8002f1:	53                   	push   %rbx
+  8002f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f6:	89 f8                	mov    %edi,%eax
+  8002f8:	49 89 f2             	mov    %rsi,%r10
+  8002fb:	48 89 cf             	mov    %rcx,%rdi
+  8002fe:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800301:	48 63 da             	movslq %edx,%rbx
+  800304:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800307:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80030c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80030f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800312:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800314:	48 85 c0             	test   %rax,%rax
+  800317:	7f 06                	jg     80031f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800319:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80031d:	c9                   	leave
+  80031e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031f:	49 89 c0             	mov    %rax,%r8
+  800322:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800327:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80032e:	00 00 00 
+  800331:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800336:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80033d:	00 00 00 
+  800340:	b8 00 00 00 00       	mov    $0x0,%eax
+  800345:	49 b9 25 2f 80 00 00 	movabs $0x802f25,%r9
+  80034c:	00 00 00 
+  80034f:	41 ff d1             	call   *%r9
+
+0000000000800352 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800352:	55                   	push   %rbp
+  800353:	48 89 e5             	mov    %rsp,%rbp
+  800356:	53                   	push   %rbx
+  800357:	48 83 ec 08          	sub    $0x8,%rsp
+  80035b:	49 89 f9             	mov    %rdi,%r9
+  80035e:	89 f0                	mov    %esi,%eax
+  800360:	48 89 d3             	mov    %rdx,%rbx
+  800363:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  800366:	49 63 f0             	movslq %r8d,%rsi
+  800369:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80036c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800371:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800374:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80037a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80037c:	48 85 c0             	test   %rax,%rax
+  80037f:	7f 06                	jg     800387 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800381:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800385:	c9                   	leave
+  800386:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800387:	49 89 c0             	mov    %rax,%r8
+  80038a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80038f:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800396:	00 00 00 
+  800399:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80039e:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8003a5:	00 00 00 
+  8003a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ad:	49 b9 25 2f 80 00 00 	movabs $0x802f25,%r9
+  8003b4:	00 00 00 
+  8003b7:	41 ff d1             	call   *%r9
+
+00000000008003ba <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003ba:	55                   	push   %rbp
+  8003bb:	48 89 e5             	mov    %rsp,%rbp
+  8003be:	53                   	push   %rbx
+  8003bf:	89 f8                	mov    %edi,%eax
+  8003c1:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8003c4:	48 63 f9             	movslq %ecx,%rdi
+  8003c7:	48 63 da             	movslq %edx,%rbx
+  8003ca:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003cd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003d2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8003da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003e0:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8003e2:	89 c2                	mov    %eax,%edx
+  8003e4:	48 85 c0             	test   %rax,%rax
+  8003e7:	78 0d                	js     8003f6 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8003e9:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8003ee:	4d 85 c9             	test   %r9,%r9
+  8003f1:	74 03                	je     8003f6 <sys_alloc_dma_region+0x3c>
+  8003f3:	49 89 01             	mov    %rax,(%r9)
+}
+  8003f6:	89 d0                	mov    %edx,%eax
+  8003f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003fc:	c9                   	leave
+  8003fd:	c3                   	ret
+
+00000000008003fe <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8003fe:	55                   	push   %rbp
+  8003ff:	48 89 e5             	mov    %rsp,%rbp
+  800402:	53                   	push   %rbx
+  800403:	48 83 ec 08          	sub    $0x8,%rsp
+  800407:	48 89 f1             	mov    %rsi,%rcx
+  80040a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80040d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800410:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800415:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80041a:	be 00 00 00 00       	mov    $0x0,%esi
+  80041f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800425:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800427:	48 85 c0             	test   %rax,%rax
+  80042a:	7f 06                	jg     800432 <sys_set_cache_region+0x34>
+}
+  80042c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800430:	c9                   	leave
+  800431:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800432:	49 89 c0             	mov    %rax,%r8
+  800435:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80043a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800441:	00 00 00 
+  800444:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800449:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800450:	00 00 00 
+  800453:	b8 00 00 00 00       	mov    $0x0,%eax
+  800458:	49 b9 25 2f 80 00 00 	movabs $0x802f25,%r9
+  80045f:	00 00 00 
+  800462:	41 ff d1             	call   *%r9
+
+0000000000800465 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800465:	55                   	push   %rbp
+  800466:	48 89 e5             	mov    %rsp,%rbp
+  800469:	53                   	push   %rbx
+  80046a:	48 83 ec 08          	sub    $0x8,%rsp
+  80046e:	48 89 f1             	mov    %rsi,%rcx
+  800471:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800474:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800477:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80047c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800481:	be 00 00 00 00       	mov    $0x0,%esi
+  800486:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80048c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80048e:	48 85 c0             	test   %rax,%rax
+  800491:	7f 06                	jg     800499 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800493:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800499:	49 89 c0             	mov    %rax,%r8
+  80049c:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004a1:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8004a8:	00 00 00 
+  8004ab:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004b0:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8004b7:	00 00 00 
+  8004ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bf:	49 b9 25 2f 80 00 00 	movabs $0x802f25,%r9
+  8004c6:	00 00 00 
+  8004c9:	41 ff d1             	call   *%r9
+
+00000000008004cc <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004cc:	55                   	push   %rbp
+  8004cd:	48 89 e5             	mov    %rsp,%rbp
+  8004d0:	53                   	push   %rbx
+  8004d1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004d5:	48 63 ce             	movslq %esi,%rcx
+  8004d8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004db:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004f7:	48 85 c0             	test   %rax,%rax
+  8004fa:	7f 06                	jg     800502 <sys_env_set_status+0x36>
+}
+  8004fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800500:	c9                   	leave
+  800501:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800502:	49 89 c0             	mov    %rax,%r8
+  800505:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80050a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800511:	00 00 00 
+  800514:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800519:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800520:	00 00 00 
+  800523:	b8 00 00 00 00       	mov    $0x0,%eax
+  800528:	49 b9 25 2f 80 00 00 	movabs $0x802f25,%r9
+  80052f:	00 00 00 
+  800532:	41 ff d1             	call   *%r9
+
+0000000000800535 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800535:	55                   	push   %rbp
+  800536:	48 89 e5             	mov    %rsp,%rbp
+  800539:	53                   	push   %rbx
+  80053a:	48 83 ec 08          	sub    $0x8,%rsp
+  80053e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800541:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800544:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800549:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80054e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800553:	be 00 00 00 00       	mov    $0x0,%esi
+  800558:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80055e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800560:	48 85 c0             	test   %rax,%rax
+  800563:	7f 06                	jg     80056b <sys_env_set_trapframe+0x36>
+}
+  800565:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800569:	c9                   	leave
+  80056a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80056b:	49 89 c0             	mov    %rax,%r8
+  80056e:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800573:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80057a:	00 00 00 
+  80057d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800582:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800589:	00 00 00 
+  80058c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800591:	49 b9 25 2f 80 00 00 	movabs $0x802f25,%r9
+  800598:	00 00 00 
+  80059b:	41 ff d1             	call   *%r9
+
+000000000080059e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80059e:	55                   	push   %rbp
+  80059f:	48 89 e5             	mov    %rsp,%rbp
+  8005a2:	53                   	push   %rbx
+  8005a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005a7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005ad:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005c9:	48 85 c0             	test   %rax,%rax
+  8005cc:	7f 06                	jg     8005d4 <sys_env_set_pgfault_upcall+0x36>
+}
+  8005ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005d2:	c9                   	leave
+  8005d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005d4:	49 89 c0             	mov    %rax,%r8
+  8005d7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005dc:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8005e3:	00 00 00 
+  8005e6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8005eb:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8005f2:	00 00 00 
+  8005f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fa:	49 b9 25 2f 80 00 00 	movabs $0x802f25,%r9
+  800601:	00 00 00 
+  800604:	41 ff d1             	call   *%r9
+
+0000000000800607 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800607:	55                   	push   %rbp
+  800608:	48 89 e5             	mov    %rsp,%rbp
+  80060b:	53                   	push   %rbx
+  80060c:	89 f8                	mov    %edi,%eax
+  80060e:	49 89 f1             	mov    %rsi,%r9
+  800611:	48 89 d3             	mov    %rdx,%rbx
+  800614:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800617:	49 63 f0             	movslq %r8d,%rsi
+  80061a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80061d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800622:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800625:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80062b:	cd 30                	int    $0x30
+}
+  80062d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800631:	c9                   	leave
+  800632:	c3                   	ret
+
+0000000000800633 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800633:	55                   	push   %rbp
+  800634:	48 89 e5             	mov    %rsp,%rbp
+  800637:	53                   	push   %rbx
+  800638:	48 83 ec 08          	sub    $0x8,%rsp
+  80063c:	48 89 fa             	mov    %rdi,%rdx
+  80063f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800642:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800647:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80064c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800651:	be 00 00 00 00       	mov    $0x0,%esi
+  800656:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80065c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80065e:	48 85 c0             	test   %rax,%rax
+  800661:	7f 06                	jg     800669 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800663:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800667:	c9                   	leave
+  800668:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800669:	49 89 c0             	mov    %rax,%r8
+  80066c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800671:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800678:	00 00 00 
+  80067b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800680:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800687:	00 00 00 
+  80068a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068f:	49 b9 25 2f 80 00 00 	movabs $0x802f25,%r9
+  800696:	00 00 00 
+  800699:	41 ff d1             	call   *%r9
+
+000000000080069c <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  80069c:	55                   	push   %rbp
+  80069d:	48 89 e5             	mov    %rsp,%rbp
+  8006a0:	53                   	push   %rbx
+  8006a1:	48 89 fa             	mov    %rdi,%rdx
+  8006a4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006a7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8006bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006c1:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006c7:	c9                   	leave
+  8006c8:	c3                   	ret
+
+00000000008006c9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006c9:	55                   	push   %rbp
+  8006ca:	48 89 e5             	mov    %rsp,%rbp
+  8006cd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006ce:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006f2:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8006f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006f8:	c9                   	leave
+  8006f9:	c3                   	ret
+
+00000000008006fa <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8006fa:	48 85 ff             	test   %rdi,%rdi
+  8006fd:	0f 84 b6 01 00 00    	je     8008b9 <malloc+0x1bf>
+malloc(size_t size) {
+  800703:	55                   	push   %rbp
+  800704:	48 89 e5             	mov    %rsp,%rbp
+  800707:	41 56                	push   %r14
+  800709:	41 55                	push   %r13
+  80070b:	41 54                	push   %r12
+  80070d:	53                   	push   %rbx
+  80070e:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800711:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800718:	00 00 00 
+  80071b:	4c 8b 20             	mov    (%rax),%r12
+  80071e:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  800725:	0f 87 94 01 00 00    	ja     8008bf <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  80072b:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800732:	00 00 00 
+  800735:	48 85 c0             	test   %rax,%rax
+  800738:	74 6b                	je     8007a5 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80073a:	4d 85 e4             	test   %r12,%r12
+  80073d:	74 66                	je     8007a5 <malloc+0xab>
+  80073f:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  800746:	00 00 00 
+  800749:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074e:	eb 0d                	jmp    80075d <malloc+0x63>
+  800750:	48 83 c1 01          	add    $0x1,%rcx
+  800754:	48 83 c2 18          	add    $0x18,%rdx
+  800758:	49 39 cc             	cmp    %rcx,%r12
+  80075b:	74 48                	je     8007a5 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80075d:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  800762:	74 ec                	je     800750 <malloc+0x56>
+  800764:	48 39 1a             	cmp    %rbx,(%rdx)
+  800767:	72 e7                	jb     800750 <malloc+0x56>
+                real_freep_size--;
+  800769:	48 83 e8 01          	sub    $0x1,%rax
+  80076d:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800774:	00 00 00 
+                freep[i].is_free = false;
+  800777:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80077e:	00 00 00 
+  800781:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  800785:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  800789:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  80078d:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  800794:	00 
+                freep[i].size = size;
+  800795:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  800799:	48 01 c8             	add    %rcx,%rax
+  80079c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007a0:	e9 0b 01 00 00       	jmp    8008b0 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8007a5:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8007ac:	00 00 00 
+  8007af:	48 01 d8             	add    %rbx,%rax
+  8007b2:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007b8:	76 7c                	jbe    800836 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007ba:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8007c1:	00 00 00 
+  8007c4:	4c 8b 30             	mov    (%rax),%r14
+  8007c7:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8007ce:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8007d1:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8007d8:	00 00 00 
+  8007db:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8007e2:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8007e9:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8007ef:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8007f3:	48 b8 c6 01 80 00 00 	movabs $0x8001c6,%rax
+  8007fa:	00 00 00 
+  8007fd:	ff d0                	call   *%rax
+  8007ff:	89 c7                	mov    %eax,%edi
+  800801:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  800808:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80080f:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  800816:	00 00 00 
+  800819:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80081d:	b9 26 00 00 00       	mov    $0x26,%ecx
+  800822:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  800829:	00 00 00 
+  80082c:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80082e:	85 c0                	test   %eax,%eax
+  800830:	0f 88 90 00 00 00    	js     8008c6 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  800836:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  80083d:	00 00 00 
+  800840:	48 8b 31             	mov    (%rcx),%rsi
+  800843:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  80084a:	00 00 00 
+  80084d:	4c 8b 07             	mov    (%rdi),%r8
+  800850:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  800854:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  80085b:	00 00 00 
+  80085e:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  800862:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  800866:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80086d:	00 00 00 
+  800870:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  800874:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  800877:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  80087b:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  800882:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  800883:	48 89 d8             	mov    %rbx,%rax
+  800886:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80088b:	4c 01 c0             	add    %r8,%rax
+  80088e:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  800891:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  800898:	48 01 f3             	add    %rsi,%rbx
+  80089b:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  80089e:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8008a3:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008aa:	00 00 00 
+  8008ad:	48 89 d0             	mov    %rdx,%rax
+}
+  8008b0:	5b                   	pop    %rbx
+  8008b1:	41 5c                	pop    %r12
+  8008b3:	41 5d                	pop    %r13
+  8008b5:	41 5e                	pop    %r14
+  8008b7:	5d                   	pop    %rbp
+  8008b8:	c3                   	ret
+        return NULL;
+  8008b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008be:	c3                   	ret
+        return NULL;
+  8008bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c4:	eb ea                	jmp    8008b0 <malloc+0x1b6>
+            return NULL;
+  8008c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cb:	eb e3                	jmp    8008b0 <malloc+0x1b6>
+
+00000000008008cd <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8008cd:	55                   	push   %rbp
+  8008ce:	48 89 e5             	mov    %rsp,%rbp
+  8008d1:	53                   	push   %rbx
+  8008d2:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8008d6:	48 89 fb             	mov    %rdi,%rbx
+  8008d9:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8008dd:	48 89 df             	mov    %rbx,%rdi
+  8008e0:	48 b8 fa 06 80 00 00 	movabs $0x8006fa,%rax
+  8008e7:	00 00 00 
+  8008ea:	ff d0                	call   *%rax
+  8008ec:	48 89 c7             	mov    %rax,%rdi
+  8008ef:	48 89 da             	mov    %rbx,%rdx
+  8008f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8008f7:	48 b8 cd 3c 80 00 00 	movabs $0x803ccd,%rax
+  8008fe:	00 00 00 
+  800901:	ff d0                	call   *%rax
+}
+  800903:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800907:	c9                   	leave
+  800908:	c3                   	ret
+
+0000000000800909 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  800909:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  800910:	00 00 00 
+  800913:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80091a:	00 00 00 
+  80091d:	48 3b 02             	cmp    (%rdx),%rax
+  800920:	74 4d                	je     80096f <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  800922:	48 85 c0             	test   %rax,%rax
+  800925:	74 4d                	je     800974 <get_allocsize+0x6b>
+  800927:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80092e:	00 00 00 
+  800931:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  800936:	48 3b 39             	cmp    (%rcx),%rdi
+  800939:	74 13                	je     80094e <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  80093b:	48 83 c2 01          	add    $0x1,%rdx
+  80093f:	48 83 c1 18          	add    $0x18,%rcx
+  800943:	48 39 d0             	cmp    %rdx,%rax
+  800946:	75 ee                	jne    800936 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  800948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094d:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  80094e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800952:	b8 00 00 00 00       	mov    $0x0,%eax
+  800957:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  80095e:	00 00 00 
+  800961:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800967:	75 0b                	jne    800974 <get_allocsize+0x6b>
+  800969:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  80096e:	c3                   	ret
+        return 0;
+  80096f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800974:	c3                   	ret
+
+0000000000800975 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  800975:	48 85 ff             	test   %rdi,%rdi
+  800978:	0f 84 01 01 00 00    	je     800a7f <free+0x10a>
+free(void *ptr) {
+  80097e:	55                   	push   %rbp
+  80097f:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  800982:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800989:	00 00 00 
+  80098c:	48 8b 30             	mov    (%rax),%rsi
+  80098f:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800996:	00 00 00 
+  800999:	48 39 c6             	cmp    %rax,%rsi
+  80099c:	74 50                	je     8009ee <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  80099e:	48 85 f6             	test   %rsi,%rsi
+  8009a1:	74 21                	je     8009c4 <free+0x4f>
+  8009a3:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009aa:	00 00 00 
+  8009ad:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009b2:	48 3b 39             	cmp    (%rcx),%rdi
+  8009b5:	74 61                	je     800a18 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009b7:	48 83 c2 01          	add    $0x1,%rdx
+  8009bb:	48 83 c1 18          	add    $0x18,%rcx
+  8009bf:	48 39 d6             	cmp    %rdx,%rsi
+  8009c2:	75 ee                	jne    8009b2 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8009c4:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  8009cb:	00 00 00 
+  8009ce:	be 12 01 00 00       	mov    $0x112,%esi
+  8009d3:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009da:	00 00 00 
+  8009dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e2:	48 b9 25 2f 80 00 00 	movabs $0x802f25,%rcx
+  8009e9:	00 00 00 
+  8009ec:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  8009ee:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  8009f5:	00 00 00 
+  8009f8:	be 06 01 00 00       	mov    $0x106,%esi
+  8009fd:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a04:	00 00 00 
+  800a07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0c:	48 b9 25 2f 80 00 00 	movabs $0x802f25,%rcx
+  800a13:	00 00 00 
+  800a16:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a18:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a1c:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a23:	00 00 00 
+  800a26:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a2c:	75 27                	jne    800a55 <free+0xe0>
+            freep[i].is_free = true;
+  800a2e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a32:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a39:	00 00 00 
+  800a3c:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a43:	00 00 
+            real_freep_size++;
+  800a45:	48 83 c0 01          	add    $0x1,%rax
+  800a49:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a50:	00 00 00 
+}
+  800a53:	5d                   	pop    %rbp
+  800a54:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a55:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a5c:	00 00 00 
+  800a5f:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800a64:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a6b:	00 00 00 
+  800a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a73:	48 b9 25 2f 80 00 00 	movabs $0x802f25,%rcx
+  800a7a:	00 00 00 
+  800a7d:	ff d1                	call   *%rcx
+  800a7f:	c3                   	ret
+
+0000000000800a80 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800a80:	55                   	push   %rbp
+  800a81:	48 89 e5             	mov    %rsp,%rbp
+  800a84:	41 55                	push   %r13
+  800a86:	41 54                	push   %r12
+  800a88:	53                   	push   %rbx
+  800a89:	48 83 ec 08          	sub    $0x8,%rsp
+  800a8d:	48 89 fb             	mov    %rdi,%rbx
+  800a90:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800a93:	48 b8 09 09 80 00 00 	movabs $0x800909,%rax
+  800a9a:	00 00 00 
+  800a9d:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800a9f:	49 39 c5             	cmp    %rax,%r13
+  800aa2:	73 0e                	jae    800ab2 <realloc+0x32>
+}
+  800aa4:	48 89 d8             	mov    %rbx,%rax
+  800aa7:	48 83 c4 08          	add    $0x8,%rsp
+  800aab:	5b                   	pop    %rbx
+  800aac:	41 5c                	pop    %r12
+  800aae:	41 5d                	pop    %r13
+  800ab0:	5d                   	pop    %rbp
+  800ab1:	c3                   	ret
+  800ab2:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800ab5:	4c 89 ef             	mov    %r13,%rdi
+  800ab8:	48 b8 fa 06 80 00 00 	movabs $0x8006fa,%rax
+  800abf:	00 00 00 
+  800ac2:	ff d0                	call   *%rax
+  800ac4:	48 89 c7             	mov    %rax,%rdi
+  800ac7:	4c 89 e2             	mov    %r12,%rdx
+  800aca:	48 89 de             	mov    %rbx,%rsi
+  800acd:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  800ad4:	00 00 00 
+  800ad7:	ff d0                	call   *%rax
+  800ad9:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800adc:	48 89 df             	mov    %rbx,%rdi
+  800adf:	48 b8 75 09 80 00 00 	movabs $0x800975,%rax
+  800ae6:	00 00 00 
+  800ae9:	ff d0                	call   *%rax
+    return newptr;
+  800aeb:	4c 89 e3             	mov    %r12,%rbx
+  800aee:	eb b4                	jmp    800aa4 <realloc+0x24>
+
+0000000000800af0 <strdup>:
+
+char*
+strdup (const char *src) {
+  800af0:	55                   	push   %rbp
+  800af1:	48 89 e5             	mov    %rsp,%rbp
+  800af4:	41 54                	push   %r12
+  800af6:	53                   	push   %rbx
+  800af7:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800afa:	48 b8 af 39 80 00 00 	movabs $0x8039af,%rax
+  800b01:	00 00 00 
+  800b04:	ff d0                	call   *%rax
+  800b06:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b0a:	4c 89 e7             	mov    %r12,%rdi
+  800b0d:	48 b8 fa 06 80 00 00 	movabs $0x8006fa,%rax
+  800b14:	00 00 00 
+  800b17:	ff d0                	call   *%rax
+  800b19:	48 89 c7             	mov    %rax,%rdi
+  800b1c:	4c 89 e2             	mov    %r12,%rdx
+  800b1f:	48 89 de             	mov    %rbx,%rsi
+  800b22:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  800b29:	00 00 00 
+  800b2c:	ff d0                	call   *%rax
+}
+  800b2e:	5b                   	pop    %rbx
+  800b2f:	41 5c                	pop    %r12
+  800b31:	5d                   	pop    %rbp
+  800b32:	c3                   	ret
+
+0000000000800b33 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b33:	55                   	push   %rbp
+  800b34:	48 89 e5             	mov    %rsp,%rbp
+  800b37:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b38:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b42:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b4c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b51:	be 00 00 00 00       	mov    $0x0,%esi
+  800b56:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b5c:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b5e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b62:	c9                   	leave
+  800b63:	c3                   	ret
+
+0000000000800b64 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800b64:	55                   	push   %rbp
+  800b65:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800b68:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800b6f:	00 00 00 
+  800b72:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b76:	74 26                	je     800b9e <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800b78:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b7a:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b7e:	89 c0                	mov    %eax,%eax
+  800b80:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800b83:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800b8a:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800b91:	00 00 00 
+  800b94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b99:	48 f7 31             	divq   (%rcx)
+}
+  800b9c:	5d                   	pop    %rbp
+  800b9d:	c3                   	ret
+        freq = get_cpufreq();
+  800b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba3:	48 ba 33 0b 80 00 00 	movabs $0x800b33,%rdx
+  800baa:	00 00 00 
+  800bad:	ff d2                	call   *%rdx
+  800baf:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bb6:	00 00 00 
+  800bb9:	eb bd                	jmp    800b78 <get_ticks+0x14>
+
+0000000000800bbb <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bbb:	55                   	push   %rbp
+  800bbc:	48 89 e5             	mov    %rsp,%rbp
+  800bbf:	53                   	push   %rbx
+  800bc0:	48 83 ec 08          	sub    $0x8,%rsp
+  800bc4:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800bc7:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bce:	00 00 00 
+  800bd1:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800bd5:	74 50                	je     800c27 <sleep+0x6c>
+    asm volatile("rdtsc"
+  800bd7:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bd9:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bdd:	89 c0                	mov    %eax,%eax
+  800bdf:	48 89 d6             	mov    %rdx,%rsi
+  800be2:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800be5:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bec:	00 00 00 
+  800bef:	48 0f af 18          	imul   (%rax),%rbx
+  800bf3:	48 c1 eb 03          	shr    $0x3,%rbx
+  800bf7:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800bfe:	9b c4 20 
+  800c01:	48 89 d8             	mov    %rbx,%rax
+  800c04:	48 f7 e2             	mul    %rdx
+  800c07:	48 89 d1             	mov    %rdx,%rcx
+  800c0a:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c0e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c10:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c14:	89 c0                	mov    %eax,%eax
+  800c16:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c19:	48 29 f2             	sub    %rsi,%rdx
+  800c1c:	48 39 ca             	cmp    %rcx,%rdx
+  800c1f:	72 ed                	jb     800c0e <sleep+0x53>
+}
+  800c21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c25:	c9                   	leave
+  800c26:	c3                   	ret
+        freq = get_cpufreq();
+  800c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2c:	48 ba 33 0b 80 00 00 	movabs $0x800b33,%rdx
+  800c33:	00 00 00 
+  800c36:	ff d2                	call   *%rdx
+  800c38:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c3f:	00 00 00 
+  800c42:	eb 93                	jmp    800bd7 <sleep+0x1c>
+
+0000000000800c44 <poll_kbd>:
+
+int poll_kbd() {
+  800c44:	55                   	push   %rbp
+  800c45:	48 89 e5             	mov    %rsp,%rbp
+  800c48:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c49:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c53:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c5d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c62:	be 00 00 00 00       	mov    $0x0,%esi
+  800c67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c6d:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c73:	c9                   	leave
+  800c74:	c3                   	ret
+
+0000000000800c75 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800c75:	55                   	push   %rbp
+  800c76:	48 89 e5             	mov    %rsp,%rbp
+  800c79:	53                   	push   %rbx
+  800c7a:	49 89 fa             	mov    %rdi,%r10
+  800c7d:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800c7f:	44 89 c6             	mov    %r8d,%esi
+  800c82:	89 cf                	mov    %ecx,%edi
+  800c84:	89 d3                	mov    %edx,%ebx
+  800c86:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800c88:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c8d:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c90:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800c94:	cd 30                	int    $0x30
+  800c96:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c9a:	c9                   	leave
+  800c9b:	c3                   	ret
+
+0000000000800c9c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800c9c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800ca3:	ff ff ff 
+  800ca6:	48 01 f8             	add    %rdi,%rax
+  800ca9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800cad:	c3                   	ret
+
+0000000000800cae <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cae:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cb5:	ff ff ff 
+  800cb8:	48 01 f8             	add    %rdi,%rax
+  800cbb:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800cbf:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800cc5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800cc9:	c3                   	ret
+
+0000000000800cca <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800cca:	55                   	push   %rbp
+  800ccb:	48 89 e5             	mov    %rsp,%rbp
+  800cce:	41 57                	push   %r15
+  800cd0:	41 56                	push   %r14
+  800cd2:	41 55                	push   %r13
+  800cd4:	41 54                	push   %r12
+  800cd6:	53                   	push   %rbx
+  800cd7:	48 83 ec 08          	sub    $0x8,%rsp
+  800cdb:	49 89 ff             	mov    %rdi,%r15
+  800cde:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800ce3:	49 bd 7e 2b 80 00 00 	movabs $0x802b7e,%r13
+  800cea:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800ced:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800cf3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800cf6:	48 89 df             	mov    %rbx,%rdi
+  800cf9:	41 ff d5             	call   *%r13
+  800cfc:	83 e0 04             	and    $0x4,%eax
+  800cff:	74 17                	je     800d18 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800d01:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d08:	4c 39 f3             	cmp    %r14,%rbx
+  800d0b:	75 e6                	jne    800cf3 <fd_alloc+0x29>
+  800d0d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d13:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d18:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d1b:	48 83 c4 08          	add    $0x8,%rsp
+  800d1f:	5b                   	pop    %rbx
+  800d20:	41 5c                	pop    %r12
+  800d22:	41 5d                	pop    %r13
+  800d24:	41 5e                	pop    %r14
+  800d26:	41 5f                	pop    %r15
+  800d28:	5d                   	pop    %rbp
+  800d29:	c3                   	ret
+
+0000000000800d2a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d2a:	83 ff 1f             	cmp    $0x1f,%edi
+  800d2d:	77 39                	ja     800d68 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d2f:	55                   	push   %rbp
+  800d30:	48 89 e5             	mov    %rsp,%rbp
+  800d33:	41 54                	push   %r12
+  800d35:	53                   	push   %rbx
+  800d36:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d39:	48 63 df             	movslq %edi,%rbx
+  800d3c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d43:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d47:	48 89 df             	mov    %rbx,%rdi
+  800d4a:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  800d51:	00 00 00 
+  800d54:	ff d0                	call   *%rax
+  800d56:	a8 04                	test   $0x4,%al
+  800d58:	74 14                	je     800d6e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d5a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d63:	5b                   	pop    %rbx
+  800d64:	41 5c                	pop    %r12
+  800d66:	5d                   	pop    %rbp
+  800d67:	c3                   	ret
+        return -E_INVAL;
+  800d68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d6d:	c3                   	ret
+        return -E_INVAL;
+  800d6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d73:	eb ee                	jmp    800d63 <fd_lookup+0x39>
+
+0000000000800d75 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d75:	55                   	push   %rbp
+  800d76:	48 89 e5             	mov    %rsp,%rbp
+  800d79:	41 54                	push   %r12
+  800d7b:	53                   	push   %rbx
+  800d7c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800d7f:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800d86:	00 00 00 
+  800d89:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800d90:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800d93:	39 3b                	cmp    %edi,(%rbx)
+  800d95:	74 47                	je     800dde <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800d97:	48 83 c0 08          	add    $0x8,%rax
+  800d9b:	48 8b 18             	mov    (%rax),%rbx
+  800d9e:	48 85 db             	test   %rbx,%rbx
+  800da1:	75 f0                	jne    800d93 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800da3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800daa:	00 00 00 
+  800dad:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800db3:	89 fa                	mov    %edi,%edx
+  800db5:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  800dbc:	00 00 00 
+  800dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc4:	48 b9 75 30 80 00 00 	movabs $0x803075,%rcx
+  800dcb:	00 00 00 
+  800dce:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800dd0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800dd5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800dd9:	5b                   	pop    %rbx
+  800dda:	41 5c                	pop    %r12
+  800ddc:	5d                   	pop    %rbp
+  800ddd:	c3                   	ret
+            return 0;
+  800dde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de3:	eb f0                	jmp    800dd5 <dev_lookup+0x60>
+
+0000000000800de5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800de5:	55                   	push   %rbp
+  800de6:	48 89 e5             	mov    %rsp,%rbp
+  800de9:	41 55                	push   %r13
+  800deb:	41 54                	push   %r12
+  800ded:	53                   	push   %rbx
+  800dee:	48 83 ec 18          	sub    $0x18,%rsp
+  800df2:	48 89 fb             	mov    %rdi,%rbx
+  800df5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800df8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800dff:	ff ff ff 
+  800e02:	48 01 df             	add    %rbx,%rdi
+  800e05:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800e09:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e0d:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  800e14:	00 00 00 
+  800e17:	ff d0                	call   *%rax
+  800e19:	41 89 c5             	mov    %eax,%r13d
+  800e1c:	85 c0                	test   %eax,%eax
+  800e1e:	78 06                	js     800e26 <fd_close+0x41>
+  800e20:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e24:	74 1a                	je     800e40 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e26:	45 84 e4             	test   %r12b,%r12b
+  800e29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e32:	44 89 e8             	mov    %r13d,%eax
+  800e35:	48 83 c4 18          	add    $0x18,%rsp
+  800e39:	5b                   	pop    %rbx
+  800e3a:	41 5c                	pop    %r12
+  800e3c:	41 5d                	pop    %r13
+  800e3e:	5d                   	pop    %rbp
+  800e3f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e40:	8b 3b                	mov    (%rbx),%edi
+  800e42:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e46:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  800e4d:	00 00 00 
+  800e50:	ff d0                	call   *%rax
+  800e52:	41 89 c5             	mov    %eax,%r13d
+  800e55:	85 c0                	test   %eax,%eax
+  800e57:	78 1b                	js     800e74 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e5d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800e61:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e67:	48 85 c0             	test   %rax,%rax
+  800e6a:	74 08                	je     800e74 <fd_close+0x8f>
+  800e6c:	48 89 df             	mov    %rbx,%rdi
+  800e6f:	ff d0                	call   *%rax
+  800e71:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800e74:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e79:	48 89 de             	mov    %rbx,%rsi
+  800e7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e81:	48 b8 65 04 80 00 00 	movabs $0x800465,%rax
+  800e88:	00 00 00 
+  800e8b:	ff d0                	call   *%rax
+    return res;
+  800e8d:	eb a3                	jmp    800e32 <fd_close+0x4d>
+
+0000000000800e8f <close>:
+
+int
+close(int fdnum) {
+  800e8f:	55                   	push   %rbp
+  800e90:	48 89 e5             	mov    %rsp,%rbp
+  800e93:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800e97:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e9b:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  800ea2:	00 00 00 
+  800ea5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800ea7:	85 c0                	test   %eax,%eax
+  800ea9:	78 15                	js     800ec0 <close+0x31>
+
+    return fd_close(fd, 1);
+  800eab:	be 01 00 00 00       	mov    $0x1,%esi
+  800eb0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800eb4:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  800ebb:	00 00 00 
+  800ebe:	ff d0                	call   *%rax
+}
+  800ec0:	c9                   	leave
+  800ec1:	c3                   	ret
+
+0000000000800ec2 <close_all>:
+
+void
+close_all(void) {
+  800ec2:	55                   	push   %rbp
+  800ec3:	48 89 e5             	mov    %rsp,%rbp
+  800ec6:	41 54                	push   %r12
+  800ec8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800ec9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ece:	49 bc 8f 0e 80 00 00 	movabs $0x800e8f,%r12
+  800ed5:	00 00 00 
+  800ed8:	89 df                	mov    %ebx,%edi
+  800eda:	41 ff d4             	call   *%r12
+  800edd:	83 c3 01             	add    $0x1,%ebx
+  800ee0:	83 fb 20             	cmp    $0x20,%ebx
+  800ee3:	75 f3                	jne    800ed8 <close_all+0x16>
+}
+  800ee5:	5b                   	pop    %rbx
+  800ee6:	41 5c                	pop    %r12
+  800ee8:	5d                   	pop    %rbp
+  800ee9:	c3                   	ret
+
+0000000000800eea <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800eea:	55                   	push   %rbp
+  800eeb:	48 89 e5             	mov    %rsp,%rbp
+  800eee:	41 57                	push   %r15
+  800ef0:	41 56                	push   %r14
+  800ef2:	41 55                	push   %r13
+  800ef4:	41 54                	push   %r12
+  800ef6:	53                   	push   %rbx
+  800ef7:	48 83 ec 18          	sub    $0x18,%rsp
+  800efb:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800efe:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800f02:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  800f09:	00 00 00 
+  800f0c:	ff d0                	call   *%rax
+  800f0e:	89 c3                	mov    %eax,%ebx
+  800f10:	85 c0                	test   %eax,%eax
+  800f12:	0f 88 b8 00 00 00    	js     800fd0 <dup+0xe6>
+    close(newfdnum);
+  800f18:	44 89 e7             	mov    %r12d,%edi
+  800f1b:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  800f22:	00 00 00 
+  800f25:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f27:	4d 63 ec             	movslq %r12d,%r13
+  800f2a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f31:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f35:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f39:	4c 89 ff             	mov    %r15,%rdi
+  800f3c:	49 be ae 0c 80 00 00 	movabs $0x800cae,%r14
+  800f43:	00 00 00 
+  800f46:	41 ff d6             	call   *%r14
+  800f49:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f4c:	4c 89 ef             	mov    %r13,%rdi
+  800f4f:	41 ff d6             	call   *%r14
+  800f52:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f55:	48 89 df             	mov    %rbx,%rdi
+  800f58:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  800f5f:	00 00 00 
+  800f62:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800f64:	a8 04                	test   $0x4,%al
+  800f66:	74 2b                	je     800f93 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800f68:	41 89 c1             	mov    %eax,%r9d
+  800f6b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f71:	4c 89 f1             	mov    %r14,%rcx
+  800f74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f79:	48 89 de             	mov    %rbx,%rsi
+  800f7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f81:	48 b8 ed 02 80 00 00 	movabs $0x8002ed,%rax
+  800f88:	00 00 00 
+  800f8b:	ff d0                	call   *%rax
+  800f8d:	89 c3                	mov    %eax,%ebx
+  800f8f:	85 c0                	test   %eax,%eax
+  800f91:	78 4e                	js     800fe1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800f93:	4c 89 ff             	mov    %r15,%rdi
+  800f96:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  800f9d:	00 00 00 
+  800fa0:	ff d0                	call   *%rax
+  800fa2:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800fa5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fab:	4c 89 e9             	mov    %r13,%rcx
+  800fae:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb3:	4c 89 fe             	mov    %r15,%rsi
+  800fb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fbb:	48 b8 ed 02 80 00 00 	movabs $0x8002ed,%rax
+  800fc2:	00 00 00 
+  800fc5:	ff d0                	call   *%rax
+  800fc7:	89 c3                	mov    %eax,%ebx
+  800fc9:	85 c0                	test   %eax,%eax
+  800fcb:	78 14                	js     800fe1 <dup+0xf7>
+
+    return newfdnum;
+  800fcd:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800fd0:	89 d8                	mov    %ebx,%eax
+  800fd2:	48 83 c4 18          	add    $0x18,%rsp
+  800fd6:	5b                   	pop    %rbx
+  800fd7:	41 5c                	pop    %r12
+  800fd9:	41 5d                	pop    %r13
+  800fdb:	41 5e                	pop    %r14
+  800fdd:	41 5f                	pop    %r15
+  800fdf:	5d                   	pop    %rbp
+  800fe0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800fe1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800fe6:	4c 89 ee             	mov    %r13,%rsi
+  800fe9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fee:	49 bc 65 04 80 00 00 	movabs $0x800465,%r12
+  800ff5:	00 00 00 
+  800ff8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800ffb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801000:	4c 89 f6             	mov    %r14,%rsi
+  801003:	bf 00 00 00 00       	mov    $0x0,%edi
+  801008:	41 ff d4             	call   *%r12
+    return res;
+  80100b:	eb c3                	jmp    800fd0 <dup+0xe6>
+
+000000000080100d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80100d:	55                   	push   %rbp
+  80100e:	48 89 e5             	mov    %rsp,%rbp
+  801011:	41 56                	push   %r14
+  801013:	41 55                	push   %r13
+  801015:	41 54                	push   %r12
+  801017:	53                   	push   %rbx
+  801018:	48 83 ec 10          	sub    $0x10,%rsp
+  80101c:	89 fb                	mov    %edi,%ebx
+  80101e:	49 89 f4             	mov    %rsi,%r12
+  801021:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801024:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801028:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  80102f:	00 00 00 
+  801032:	ff d0                	call   *%rax
+  801034:	85 c0                	test   %eax,%eax
+  801036:	78 4c                	js     801084 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801038:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80103c:	41 8b 3e             	mov    (%r14),%edi
+  80103f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801043:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  80104a:	00 00 00 
+  80104d:	ff d0                	call   *%rax
+  80104f:	85 c0                	test   %eax,%eax
+  801051:	78 35                	js     801088 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801053:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801057:	83 e0 03             	and    $0x3,%eax
+  80105a:	83 f8 01             	cmp    $0x1,%eax
+  80105d:	74 2d                	je     80108c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80105f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801063:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801067:	48 85 c0             	test   %rax,%rax
+  80106a:	74 56                	je     8010c2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80106c:	4c 89 ea             	mov    %r13,%rdx
+  80106f:	4c 89 e6             	mov    %r12,%rsi
+  801072:	4c 89 f7             	mov    %r14,%rdi
+  801075:	ff d0                	call   *%rax
+}
+  801077:	48 83 c4 10          	add    $0x10,%rsp
+  80107b:	5b                   	pop    %rbx
+  80107c:	41 5c                	pop    %r12
+  80107e:	41 5d                	pop    %r13
+  801080:	41 5e                	pop    %r14
+  801082:	5d                   	pop    %rbp
+  801083:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801084:	48 98                	cltq
+  801086:	eb ef                	jmp    801077 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801088:	48 98                	cltq
+  80108a:	eb eb                	jmp    801077 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80108c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801093:	00 00 00 
+  801096:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80109c:	89 da                	mov    %ebx,%edx
+  80109e:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  8010a5:	00 00 00 
+  8010a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ad:	48 b9 75 30 80 00 00 	movabs $0x803075,%rcx
+  8010b4:	00 00 00 
+  8010b7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010b9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8010c0:	eb b5                	jmp    801077 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010c2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8010c9:	eb ac                	jmp    801077 <read+0x6a>
+
+00000000008010cb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8010cb:	55                   	push   %rbp
+  8010cc:	48 89 e5             	mov    %rsp,%rbp
+  8010cf:	41 57                	push   %r15
+  8010d1:	41 56                	push   %r14
+  8010d3:	41 55                	push   %r13
+  8010d5:	41 54                	push   %r12
+  8010d7:	53                   	push   %rbx
+  8010d8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8010dc:	48 85 d2             	test   %rdx,%rdx
+  8010df:	74 54                	je     801135 <readn+0x6a>
+  8010e1:	41 89 fd             	mov    %edi,%r13d
+  8010e4:	49 89 f6             	mov    %rsi,%r14
+  8010e7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8010ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8010ef:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8010f4:	49 bf 0d 10 80 00 00 	movabs $0x80100d,%r15
+  8010fb:	00 00 00 
+  8010fe:	4c 89 e2             	mov    %r12,%rdx
+  801101:	48 29 f2             	sub    %rsi,%rdx
+  801104:	4c 01 f6             	add    %r14,%rsi
+  801107:	44 89 ef             	mov    %r13d,%edi
+  80110a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80110d:	85 c0                	test   %eax,%eax
+  80110f:	78 20                	js     801131 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801111:	01 c3                	add    %eax,%ebx
+  801113:	85 c0                	test   %eax,%eax
+  801115:	74 08                	je     80111f <readn+0x54>
+  801117:	48 63 f3             	movslq %ebx,%rsi
+  80111a:	4c 39 e6             	cmp    %r12,%rsi
+  80111d:	72 df                	jb     8010fe <readn+0x33>
+    }
+    return res;
+  80111f:	48 63 c3             	movslq %ebx,%rax
+}
+  801122:	48 83 c4 08          	add    $0x8,%rsp
+  801126:	5b                   	pop    %rbx
+  801127:	41 5c                	pop    %r12
+  801129:	41 5d                	pop    %r13
+  80112b:	41 5e                	pop    %r14
+  80112d:	41 5f                	pop    %r15
+  80112f:	5d                   	pop    %rbp
+  801130:	c3                   	ret
+        if (inc < 0) return inc;
+  801131:	48 98                	cltq
+  801133:	eb ed                	jmp    801122 <readn+0x57>
+    int inc = 1, res = 0;
+  801135:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113a:	eb e3                	jmp    80111f <readn+0x54>
+
+000000000080113c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80113c:	55                   	push   %rbp
+  80113d:	48 89 e5             	mov    %rsp,%rbp
+  801140:	41 56                	push   %r14
+  801142:	41 55                	push   %r13
+  801144:	41 54                	push   %r12
+  801146:	53                   	push   %rbx
+  801147:	48 83 ec 10          	sub    $0x10,%rsp
+  80114b:	89 fb                	mov    %edi,%ebx
+  80114d:	49 89 f4             	mov    %rsi,%r12
+  801150:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801153:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801157:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  80115e:	00 00 00 
+  801161:	ff d0                	call   *%rax
+  801163:	85 c0                	test   %eax,%eax
+  801165:	78 47                	js     8011ae <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801167:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80116b:	41 8b 3e             	mov    (%r14),%edi
+  80116e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801172:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  801179:	00 00 00 
+  80117c:	ff d0                	call   *%rax
+  80117e:	85 c0                	test   %eax,%eax
+  801180:	78 30                	js     8011b2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801182:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801187:	74 2d                	je     8011b6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801189:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80118d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801191:	48 85 c0             	test   %rax,%rax
+  801194:	74 56                	je     8011ec <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801196:	4c 89 ea             	mov    %r13,%rdx
+  801199:	4c 89 e6             	mov    %r12,%rsi
+  80119c:	4c 89 f7             	mov    %r14,%rdi
+  80119f:	ff d0                	call   *%rax
+}
+  8011a1:	48 83 c4 10          	add    $0x10,%rsp
+  8011a5:	5b                   	pop    %rbx
+  8011a6:	41 5c                	pop    %r12
+  8011a8:	41 5d                	pop    %r13
+  8011aa:	41 5e                	pop    %r14
+  8011ac:	5d                   	pop    %rbp
+  8011ad:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011ae:	48 98                	cltq
+  8011b0:	eb ef                	jmp    8011a1 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011b2:	48 98                	cltq
+  8011b4:	eb eb                	jmp    8011a1 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011b6:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8011bd:	00 00 00 
+  8011c0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8011c6:	89 da                	mov    %ebx,%edx
+  8011c8:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  8011cf:	00 00 00 
+  8011d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d7:	48 b9 75 30 80 00 00 	movabs $0x803075,%rcx
+  8011de:	00 00 00 
+  8011e1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8011e3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011ea:	eb b5                	jmp    8011a1 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8011ec:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8011f3:	eb ac                	jmp    8011a1 <write+0x65>
+
+00000000008011f5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8011f5:	55                   	push   %rbp
+  8011f6:	48 89 e5             	mov    %rsp,%rbp
+  8011f9:	53                   	push   %rbx
+  8011fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8011fe:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801200:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801204:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  80120b:	00 00 00 
+  80120e:	ff d0                	call   *%rax
+  801210:	85 c0                	test   %eax,%eax
+  801212:	78 0c                	js     801220 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801214:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801218:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80121b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801220:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801224:	c9                   	leave
+  801225:	c3                   	ret
+
+0000000000801226 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  801226:	55                   	push   %rbp
+  801227:	48 89 e5             	mov    %rsp,%rbp
+  80122a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80122e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801232:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  801239:	00 00 00 
+  80123c:	ff d0                	call   *%rax
+  80123e:	85 c0                	test   %eax,%eax
+  801240:	78 07                	js     801249 <tell+0x23>
+    return fdes->fd_offset;
+  801242:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801246:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  801249:	c9                   	leave
+  80124a:	c3                   	ret
+
+000000000080124b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80124b:	55                   	push   %rbp
+  80124c:	48 89 e5             	mov    %rsp,%rbp
+  80124f:	41 55                	push   %r13
+  801251:	41 54                	push   %r12
+  801253:	53                   	push   %rbx
+  801254:	48 83 ec 18          	sub    $0x18,%rsp
+  801258:	89 fb                	mov    %edi,%ebx
+  80125a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80125d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801261:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  801268:	00 00 00 
+  80126b:	ff d0                	call   *%rax
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	78 38                	js     8012a9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801271:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801275:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801279:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80127d:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  801284:	00 00 00 
+  801287:	ff d0                	call   *%rax
+  801289:	85 c0                	test   %eax,%eax
+  80128b:	78 1c                	js     8012a9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80128d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801292:	74 20                	je     8012b4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801294:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801298:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80129c:	48 85 c0             	test   %rax,%rax
+  80129f:	74 47                	je     8012e8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8012a1:	44 89 e6             	mov    %r12d,%esi
+  8012a4:	4c 89 ef             	mov    %r13,%rdi
+  8012a7:	ff d0                	call   *%rax
+}
+  8012a9:	48 83 c4 18          	add    $0x18,%rsp
+  8012ad:	5b                   	pop    %rbx
+  8012ae:	41 5c                	pop    %r12
+  8012b0:	41 5d                	pop    %r13
+  8012b2:	5d                   	pop    %rbp
+  8012b3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8012b4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8012bb:	00 00 00 
+  8012be:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012c4:	89 da                	mov    %ebx,%edx
+  8012c6:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  8012cd:	00 00 00 
+  8012d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d5:	48 b9 75 30 80 00 00 	movabs $0x803075,%rcx
+  8012dc:	00 00 00 
+  8012df:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8012e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e6:	eb c1                	jmp    8012a9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012e8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8012ed:	eb ba                	jmp    8012a9 <ftruncate+0x5e>
+
+00000000008012ef <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8012ef:	55                   	push   %rbp
+  8012f0:	48 89 e5             	mov    %rsp,%rbp
+  8012f3:	41 54                	push   %r12
+  8012f5:	53                   	push   %rbx
+  8012f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8012fa:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8012fd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801301:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  801308:	00 00 00 
+  80130b:	ff d0                	call   *%rax
+  80130d:	85 c0                	test   %eax,%eax
+  80130f:	78 4e                	js     80135f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801311:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801315:	41 8b 3c 24          	mov    (%r12),%edi
+  801319:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80131d:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  801324:	00 00 00 
+  801327:	ff d0                	call   *%rax
+  801329:	85 c0                	test   %eax,%eax
+  80132b:	78 32                	js     80135f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80132d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801331:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801336:	74 30                	je     801368 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801338:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80133b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801342:	00 00 00 
+    stat->st_isdir = 0;
+  801345:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80134c:	00 00 00 
+    stat->st_dev = dev;
+  80134f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801356:	48 89 de             	mov    %rbx,%rsi
+  801359:	4c 89 e7             	mov    %r12,%rdi
+  80135c:	ff 50 28             	call   *0x28(%rax)
+}
+  80135f:	48 83 c4 10          	add    $0x10,%rsp
+  801363:	5b                   	pop    %rbx
+  801364:	41 5c                	pop    %r12
+  801366:	5d                   	pop    %rbp
+  801367:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801368:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80136d:	eb f0                	jmp    80135f <fstat+0x70>
+
+000000000080136f <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80136f:	55                   	push   %rbp
+  801370:	48 89 e5             	mov    %rsp,%rbp
+  801373:	41 54                	push   %r12
+  801375:	53                   	push   %rbx
+  801376:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80137d:	41 89 fc             	mov    %edi,%r12d
+  801380:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801382:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801386:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  80138d:	00 00 00 
+  801390:	ff d0                	call   *%rax
+  801392:	85 c0                	test   %eax,%eax
+  801394:	78 31                	js     8013c7 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  801396:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80139d:	44 89 e7             	mov    %r12d,%edi
+  8013a0:	48 b8 ef 12 80 00 00 	movabs $0x8012ef,%rax
+  8013a7:	00 00 00 
+  8013aa:	ff d0                	call   *%rax
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	78 17                	js     8013c7 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8013b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013b4:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8013b7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8013ba:	39 d3                	cmp    %edx,%ebx
+  8013bc:	0f 4f da             	cmovg  %edx,%ebx
+  8013bf:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8013c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013c7:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8013ce:	5b                   	pop    %rbx
+  8013cf:	41 5c                	pop    %r12
+  8013d1:	5d                   	pop    %rbp
+  8013d2:	c3                   	ret
+
+00000000008013d3 <seektoend>:
+{
+  8013d3:	55                   	push   %rbp
+  8013d4:	48 89 e5             	mov    %rsp,%rbp
+  8013d7:	53                   	push   %rbx
+  8013d8:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8013df:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8013e1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013e5:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  8013ec:	00 00 00 
+  8013ef:	ff d0                	call   *%rax
+  8013f1:	85 c0                	test   %eax,%eax
+  8013f3:	78 28                	js     80141d <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8013f5:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8013fc:	89 df                	mov    %ebx,%edi
+  8013fe:	48 b8 ef 12 80 00 00 	movabs $0x8012ef,%rax
+  801405:	00 00 00 
+  801408:	ff d0                	call   *%rax
+  80140a:	85 c0                	test   %eax,%eax
+  80140c:	78 0f                	js     80141d <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80140e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801411:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801415:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  801418:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80141d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801421:	c9                   	leave
+  801422:	c3                   	ret
+
+0000000000801423 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801423:	55                   	push   %rbp
+  801424:	48 89 e5             	mov    %rsp,%rbp
+  801427:	41 54                	push   %r12
+  801429:	53                   	push   %rbx
+  80142a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80142d:	be 00 00 00 00       	mov    $0x0,%esi
+  801432:	48 b8 16 20 80 00 00 	movabs $0x802016,%rax
+  801439:	00 00 00 
+  80143c:	ff d0                	call   *%rax
+  80143e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801440:	85 c0                	test   %eax,%eax
+  801442:	78 25                	js     801469 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801444:	4c 89 e6             	mov    %r12,%rsi
+  801447:	89 c7                	mov    %eax,%edi
+  801449:	48 b8 ef 12 80 00 00 	movabs $0x8012ef,%rax
+  801450:	00 00 00 
+  801453:	ff d0                	call   *%rax
+  801455:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801458:	89 df                	mov    %ebx,%edi
+  80145a:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  801461:	00 00 00 
+  801464:	ff d0                	call   *%rax
+
+    return res;
+  801466:	44 89 e3             	mov    %r12d,%ebx
+}
+  801469:	89 d8                	mov    %ebx,%eax
+  80146b:	5b                   	pop    %rbx
+  80146c:	41 5c                	pop    %r12
+  80146e:	5d                   	pop    %rbp
+  80146f:	c3                   	ret
+
+0000000000801470 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  801470:	55                   	push   %rbp
+  801471:	48 89 e5             	mov    %rsp,%rbp
+  801474:	53                   	push   %rbx
+  801475:	48 83 ec 08          	sub    $0x8,%rsp
+  801479:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80147c:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  801483:	00 00 00 
+  801486:	ff d0                	call   *%rax
+  801488:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80148c:	0f 87 ea 00 00 00    	ja     80157c <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  801492:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  801499:	00 00 00 
+  80149c:	80 38 00             	cmpb   $0x0,(%rax)
+  80149f:	75 35                	jne    8014d6 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8014a1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014a6:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8014ab:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8014b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014b5:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  8014bc:	00 00 00 
+  8014bf:	ff d0                	call   *%rax
+  8014c1:	85 c0                	test   %eax,%eax
+  8014c3:	0f 88 ba 00 00 00    	js     801583 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8014c9:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014d0:	00 00 00 
+  8014d3:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8014d6:	48 89 df             	mov    %rbx,%rdi
+  8014d9:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  8014e0:	00 00 00 
+  8014e3:	ff d0                	call   *%rax
+  8014e5:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8014e9:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8014f0:	00 00 00 
+  8014f3:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8014f7:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8014fa:	39 39                	cmp    %edi,(%rcx)
+  8014fc:	74 46                	je     801544 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8014fe:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  801502:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  801509:	00 
+  80150a:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  801511:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  801518:	00 
+  801519:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  801520:	00 
+  801521:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  801528:	00 
+  801529:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  801530:	00 
+  801531:	89 39                	mov    %edi,(%rcx)
+  801533:	48 01 c6             	add    %rax,%rsi
+  801536:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  80153b:	48 89 c8             	mov    %rcx,%rax
+  80153e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801542:	c9                   	leave
+  801543:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  801544:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  801548:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80154f:	00 00 00 
+  801552:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801555:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  801559:	74 e0                	je     80153b <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80155b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  801562:	00 
+  801563:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  801567:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  80156e:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  801570:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801573:	48 01 c2             	add    %rax,%rdx
+  801576:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80157a:	eb bf                	jmp    80153b <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80157c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801581:	eb b8                	jmp    80153b <fbuf_get+0xcb>
+            return NULL;
+  801583:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801588:	eb b1                	jmp    80153b <fbuf_get+0xcb>
+
+000000000080158a <fsipc_bulk>:
+fsipc_bulk(void) {
+  80158a:	55                   	push   %rbp
+  80158b:	48 89 e5             	mov    %rsp,%rbp
+  80158e:	53                   	push   %rbx
+  80158f:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  801593:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  80159a:	00 00 00 
+  80159d:	48 8b 18             	mov    (%rax),%rbx
+  8015a0:	48 85 db             	test   %rbx,%rbx
+  8015a3:	74 16                	je     8015bb <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8015a5:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015ac:	00 00 00 
+  8015af:	48 8b 18             	mov    (%rax),%rbx
+}
+  8015b2:	48 89 d8             	mov    %rbx,%rax
+  8015b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b9:	c9                   	leave
+  8015ba:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8015bb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015c0:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8015c5:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8015ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015cf:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  8015d6:	00 00 00 
+  8015d9:	ff d0                	call   *%rax
+  8015db:	85 c0                	test   %eax,%eax
+  8015dd:	78 d3                	js     8015b2 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8015df:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8015e4:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8015eb:	00 00 00 
+  8015ee:	eb b5                	jmp    8015a5 <fsipc_bulk+0x1b>
+
+00000000008015f0 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8015f0:	55                   	push   %rbp
+  8015f1:	48 89 e5             	mov    %rsp,%rbp
+  8015f4:	41 57                	push   %r15
+  8015f6:	41 56                	push   %r14
+  8015f8:	41 55                	push   %r13
+  8015fa:	41 54                	push   %r12
+  8015fc:	53                   	push   %rbx
+  8015fd:	48 83 ec 08          	sub    $0x8,%rsp
+  801601:	41 89 fd             	mov    %edi,%r13d
+  801604:	49 89 f6             	mov    %rsi,%r14
+  801607:	49 89 d7             	mov    %rdx,%r15
+  80160a:	48 89 cb             	mov    %rcx,%rbx
+  80160d:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801610:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801617:	00 00 00 
+  80161a:	83 38 00             	cmpl   $0x0,(%rax)
+  80161d:	74 52                	je     801671 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80161f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801625:	4c 89 f9             	mov    %r15,%rcx
+  801628:	4c 89 f2             	mov    %r14,%rdx
+  80162b:	44 89 ee             	mov    %r13d,%esi
+  80162e:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801635:	00 00 00 
+  801638:	8b 38                	mov    (%rax),%edi
+  80163a:	48 b8 74 41 80 00 00 	movabs $0x804174,%rax
+  801641:	00 00 00 
+  801644:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  801646:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80164b:	4c 89 e2             	mov    %r12,%rdx
+  80164e:	48 89 de             	mov    %rbx,%rsi
+  801651:	bf 00 00 00 00       	mov    $0x0,%edi
+  801656:	48 b8 c4 3f 80 00 00 	movabs $0x803fc4,%rax
+  80165d:	00 00 00 
+  801660:	ff d0                	call   *%rax
+}
+  801662:	48 83 c4 08          	add    $0x8,%rsp
+  801666:	5b                   	pop    %rbx
+  801667:	41 5c                	pop    %r12
+  801669:	41 5d                	pop    %r13
+  80166b:	41 5e                	pop    %r14
+  80166d:	41 5f                	pop    %r15
+  80166f:	5d                   	pop    %rbp
+  801670:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801671:	bf 03 00 00 00       	mov    $0x3,%edi
+  801676:	48 b8 17 42 80 00 00 	movabs $0x804217,%rax
+  80167d:	00 00 00 
+  801680:	ff d0                	call   *%rax
+  801682:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  801689:	00 00 
+  80168b:	eb 92                	jmp    80161f <fsipc_region+0x2f>
+
+000000000080168d <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80168d:	55                   	push   %rbp
+  80168e:	48 89 e5             	mov    %rsp,%rbp
+  801691:	41 57                	push   %r15
+  801693:	41 56                	push   %r14
+  801695:	41 55                	push   %r13
+  801697:	41 54                	push   %r12
+  801699:	53                   	push   %rbx
+  80169a:	48 83 ec 28          	sub    $0x28,%rsp
+  80169e:	49 89 ff             	mov    %rdi,%r15
+  8016a1:	49 89 f6             	mov    %rsi,%r14
+  8016a4:	48 89 d3             	mov    %rdx,%rbx
+  8016a7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016ab:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8016ae:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  8016b5:	00 00 00 
+  8016b8:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8016ba:	48 85 c0             	test   %rax,%rax
+  8016bd:	0f 84 cc 00 00 00    	je     80178f <devfile_write_direct+0x102>
+  8016c3:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8016c6:	48 85 db             	test   %rbx,%rbx
+  8016c9:	0f 84 ba 00 00 00    	je     801789 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8016cf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016d5:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8016dc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8016e0:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8016e4:	4c 29 e3             	sub    %r12,%rbx
+  8016e7:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8016ec:	48 39 c3             	cmp    %rax,%rbx
+  8016ef:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016f3:	48 89 da             	mov    %rbx,%rdx
+  8016f6:	4c 89 f6             	mov    %r14,%rsi
+  8016f9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8016fd:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  801704:	00 00 00 
+  801707:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  801709:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80170d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  801711:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801714:	44 01 e0             	add    %r12d,%eax
+  801717:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  80171b:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80171f:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  801726:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80172d:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  801734:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80173a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80173f:	4c 89 ee             	mov    %r13,%rsi
+  801742:	bf 04 00 00 00       	mov    $0x4,%edi
+  801747:	48 b8 f0 15 80 00 00 	movabs $0x8015f0,%rax
+  80174e:	00 00 00 
+  801751:	ff d0                	call   *%rax
+        if (res < 0)
+  801753:	85 c0                	test   %eax,%eax
+  801755:	78 29                	js     801780 <devfile_write_direct+0xf3>
+        if (res == 0)
+  801757:	74 2b                	je     801784 <devfile_write_direct+0xf7>
+        i += res;
+  801759:	48 98                	cltq
+  80175b:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  80175e:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  801761:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801765:	49 39 c4             	cmp    %rax,%r12
+  801768:	0f 82 72 ff ff ff    	jb     8016e0 <devfile_write_direct+0x53>
+    return i;
+  80176e:	4c 89 e0             	mov    %r12,%rax
+}
+  801771:	48 83 c4 28          	add    $0x28,%rsp
+  801775:	5b                   	pop    %rbx
+  801776:	41 5c                	pop    %r12
+  801778:	41 5d                	pop    %r13
+  80177a:	41 5e                	pop    %r14
+  80177c:	41 5f                	pop    %r15
+  80177e:	5d                   	pop    %rbp
+  80177f:	c3                   	ret
+            return res;
+  801780:	48 98                	cltq
+  801782:	eb ed                	jmp    801771 <devfile_write_direct+0xe4>
+            return i;
+  801784:	4c 89 e0             	mov    %r12,%rax
+  801787:	eb e8                	jmp    801771 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  801789:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  80178d:	eb df                	jmp    80176e <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  80178f:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  801796:	eb d9                	jmp    801771 <devfile_write_direct+0xe4>
+
+0000000000801798 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  801798:	55                   	push   %rbp
+  801799:	48 89 e5             	mov    %rsp,%rbp
+  80179c:	41 56                	push   %r14
+  80179e:	41 55                	push   %r13
+  8017a0:	41 54                	push   %r12
+  8017a2:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8017a3:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8017a7:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8017ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b0:	4d 39 ee             	cmp    %r13,%r14
+  8017b3:	0f 84 99 00 00 00    	je     801852 <fbuf_flush+0xba>
+  8017b9:	49 89 fc             	mov    %rdi,%r12
+  8017bc:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8017bf:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017c2:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8017c6:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  8017cd:	00 00 00 
+  8017d0:	ff d0                	call   *%rax
+  8017d2:	48 89 c2             	mov    %rax,%rdx
+  8017d5:	48 c1 e2 04          	shl    $0x4,%rdx
+  8017d9:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8017dd:	48 c1 e0 0c          	shl    $0xc,%rax
+  8017e1:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8017e6:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017e9:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8017ed:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8017f4:	00 
+  8017f5:	44 89 f1             	mov    %r14d,%ecx
+  8017f8:	4c 89 ea             	mov    %r13,%rdx
+  8017fb:	4c 89 e7             	mov    %r12,%rdi
+  8017fe:	48 b8 8d 16 80 00 00 	movabs $0x80168d,%rax
+  801805:	00 00 00 
+  801808:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80180a:	48 85 c0             	test   %rax,%rax
+  80180d:	78 43                	js     801852 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80180f:	4c 39 e8             	cmp    %r13,%rax
+  801812:	72 47                	jb     80185b <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  801814:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  801819:	83 c0 01             	add    $0x1,%eax
+  80181c:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801821:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  801824:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801828:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  80182c:	72 0f                	jb     80183d <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  80182e:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  801832:	48 39 c2             	cmp    %rax,%rdx
+  801835:	48 0f 42 d0          	cmovb  %rax,%rdx
+  801839:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  80183d:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  801844:	00 
+  801845:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  80184c:	00 
+    return 0;
+  80184d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801852:	5b                   	pop    %rbx
+  801853:	41 5c                	pop    %r12
+  801855:	41 5d                	pop    %r13
+  801857:	41 5e                	pop    %r14
+  801859:	5d                   	pop    %rbp
+  80185a:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  80185b:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801860:	eb f0                	jmp    801852 <fbuf_flush+0xba>
+
+0000000000801862 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  801862:	55                   	push   %rbp
+  801863:	48 89 e5             	mov    %rsp,%rbp
+  801866:	53                   	push   %rbx
+  801867:	48 83 ec 08          	sub    $0x8,%rsp
+  80186b:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  80186e:	48 b8 70 14 80 00 00 	movabs $0x801470,%rax
+  801875:	00 00 00 
+  801878:	ff d0                	call   *%rax
+  80187a:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  80187d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801882:	48 85 f6             	test   %rsi,%rsi
+  801885:	74 0f                	je     801896 <devfile_sync+0x34>
+  801887:	48 89 df             	mov    %rbx,%rdi
+  80188a:	48 b8 98 17 80 00 00 	movabs $0x801798,%rax
+  801891:	00 00 00 
+  801894:	ff d0                	call   *%rax
+}
+  801896:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80189a:	c9                   	leave
+  80189b:	c3                   	ret
+
+000000000080189c <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80189c:	55                   	push   %rbp
+  80189d:	48 89 e5             	mov    %rsp,%rbp
+  8018a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8018a4:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8018a7:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8018ae:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8018af:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8018b3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018b8:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8018bf:	00 00 00 
+  8018c2:	48 b8 f0 15 80 00 00 	movabs $0x8015f0,%rax
+  8018c9:	00 00 00 
+  8018cc:	ff d0                	call   *%rax
+}
+  8018ce:	c9                   	leave
+  8018cf:	c3                   	ret
+
+00000000008018d0 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018d0:	55                   	push   %rbp
+  8018d1:	48 89 e5             	mov    %rsp,%rbp
+  8018d4:	41 54                	push   %r12
+  8018d6:	53                   	push   %rbx
+  8018d7:	48 89 fb             	mov    %rdi,%rbx
+  8018da:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8018dd:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  8018e4:	00 00 00 
+  8018e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	78 63                	js     801950 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018ed:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8018f0:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8018f7:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  8018f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8018fe:	bf 05 00 00 00       	mov    $0x5,%edi
+  801903:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  80190a:	00 00 00 
+  80190d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80190f:	85 c0                	test   %eax,%eax
+  801911:	78 3d                	js     801950 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801913:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80191a:	00 00 00 
+  80191d:	48 89 de             	mov    %rbx,%rsi
+  801920:	4c 89 e7             	mov    %r12,%rdi
+  801923:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  80192a:	00 00 00 
+  80192d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80192f:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  801935:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  80193c:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80193d:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  801943:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  80194a:	00 
+
+    return 0;
+  80194b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801950:	5b                   	pop    %rbx
+  801951:	41 5c                	pop    %r12
+  801953:	5d                   	pop    %rbp
+  801954:	c3                   	ret
+
+0000000000801955 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801955:	55                   	push   %rbp
+  801956:	48 89 e5             	mov    %rsp,%rbp
+  801959:	41 54                	push   %r12
+  80195b:	53                   	push   %rbx
+  80195c:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  80195f:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  801966:	00 00 00 
+  801969:	ff d0                	call   *%rax
+  80196b:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  80196e:	48 89 df             	mov    %rbx,%rdi
+  801971:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  801978:	00 00 00 
+  80197b:	ff d0                	call   *%rax
+  80197d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801981:	76 2e                	jbe    8019b1 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  801983:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801986:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80198d:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  80198f:	be 00 00 00 00       	mov    $0x0,%esi
+  801994:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801999:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  8019a0:	00 00 00 
+  8019a3:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019a5:	45 85 e4             	test   %r12d,%r12d
+  8019a8:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019ac:	5b                   	pop    %rbx
+  8019ad:	41 5c                	pop    %r12
+  8019af:	5d                   	pop    %rbp
+  8019b0:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8019b1:	48 89 df             	mov    %rbx,%rdi
+  8019b4:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  8019bb:	00 00 00 
+  8019be:	ff d0                	call   *%rax
+  8019c0:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8019c4:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8019cb:	00 00 00 
+  8019ce:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8019d5:	48 89 df             	mov    %rbx,%rdi
+  8019d8:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  8019df:	00 00 00 
+  8019e2:	ff d0                	call   *%rax
+  8019e4:	48 89 c6             	mov    %rax,%rsi
+  8019e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019f1:	48 b8 65 04 80 00 00 	movabs $0x800465,%rax
+  8019f8:	00 00 00 
+  8019fb:	ff d0                	call   *%rax
+  8019fd:	eb 84                	jmp    801983 <devfile_flush+0x2e>
+
+00000000008019ff <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8019ff:	55                   	push   %rbp
+  801a00:	48 89 e5             	mov    %rsp,%rbp
+  801a03:	41 55                	push   %r13
+  801a05:	41 54                	push   %r12
+  801a07:	53                   	push   %rbx
+  801a08:	48 83 ec 08          	sub    $0x8,%rsp
+  801a0c:	48 89 fb             	mov    %rdi,%rbx
+  801a0f:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a12:	48 b8 70 14 80 00 00 	movabs $0x801470,%rax
+  801a19:	00 00 00 
+  801a1c:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a1e:	48 85 c0             	test   %rax,%rax
+  801a21:	74 51                	je     801a74 <devfile_trunc+0x75>
+  801a23:	49 89 c4             	mov    %rax,%r12
+  801a26:	48 89 c6             	mov    %rax,%rsi
+  801a29:	48 89 df             	mov    %rbx,%rdi
+  801a2c:	48 b8 98 17 80 00 00 	movabs $0x801798,%rax
+  801a33:	00 00 00 
+  801a36:	ff d0                	call   *%rax
+  801a38:	85 c0                	test   %eax,%eax
+  801a3a:	78 2d                	js     801a69 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a3c:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a43:	00 00 00 
+  801a46:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a49:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a4b:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a4f:	be 00 00 00 00       	mov    $0x0,%esi
+  801a54:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a59:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  801a60:	00 00 00 
+  801a63:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a65:	85 c0                	test   %eax,%eax
+  801a67:	79 3e                	jns    801aa7 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801a69:	48 83 c4 08          	add    $0x8,%rsp
+  801a6d:	5b                   	pop    %rbx
+  801a6e:	41 5c                	pop    %r12
+  801a70:	41 5d                	pop    %r13
+  801a72:	5d                   	pop    %rbp
+  801a73:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a74:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a7b:	00 00 00 
+  801a7e:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a81:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a83:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a87:	be 00 00 00 00       	mov    $0x0,%esi
+  801a8c:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a91:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  801a98:	00 00 00 
+  801a9b:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	78 c8                	js     801a69 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801aa1:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801aa5:	eb c2                	jmp    801a69 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801aa7:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801aaa:	8d 51 01             	lea    0x1(%rcx),%edx
+  801aad:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801ab0:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801ab5:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801abc:	00 00 
+  801abe:	eb a9                	jmp    801a69 <devfile_trunc+0x6a>
+
+0000000000801ac0 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801ac0:	55                   	push   %rbp
+  801ac1:	48 89 e5             	mov    %rsp,%rbp
+  801ac4:	41 57                	push   %r15
+  801ac6:	41 56                	push   %r14
+  801ac8:	41 55                	push   %r13
+  801aca:	41 54                	push   %r12
+  801acc:	53                   	push   %rbx
+  801acd:	48 83 ec 28          	sub    $0x28,%rsp
+  801ad1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ad5:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801ad9:	49 89 d7             	mov    %rdx,%r15
+  801adc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801ae0:	48 b8 70 14 80 00 00 	movabs $0x801470,%rax
+  801ae7:	00 00 00 
+  801aea:	ff d0                	call   *%rax
+  801aec:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801aef:	48 85 c0             	test   %rax,%rax
+  801af2:	74 31                	je     801b25 <devfile_write+0x65>
+  801af4:	4c 89 f8             	mov    %r15,%rax
+  801af7:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801afe:	77 25                	ja     801b25 <devfile_write+0x65>
+    size_t i = 0;
+  801b00:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801b06:	48 85 c0             	test   %rax,%rax
+  801b09:	0f 85 64 01 00 00    	jne    801c73 <devfile_write+0x1b3>
+    size_t i = 0;
+  801b0f:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b13:	4c 89 f8             	mov    %r15,%rax
+}
+  801b16:	48 83 c4 28          	add    $0x28,%rsp
+  801b1a:	5b                   	pop    %rbx
+  801b1b:	41 5c                	pop    %r12
+  801b1d:	41 5d                	pop    %r13
+  801b1f:	41 5e                	pop    %r14
+  801b21:	41 5f                	pop    %r15
+  801b23:	5d                   	pop    %rbp
+  801b24:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b25:	48 85 db             	test   %rbx,%rbx
+  801b28:	74 5b                	je     801b85 <devfile_write+0xc5>
+  801b2a:	48 89 de             	mov    %rbx,%rsi
+  801b2d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b31:	48 b8 98 17 80 00 00 	movabs $0x801798,%rax
+  801b38:	00 00 00 
+  801b3b:	ff d0                	call   *%rax
+  801b3d:	85 c0                	test   %eax,%eax
+  801b3f:	78 40                	js     801b81 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b41:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b45:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801b48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b4c:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b50:	48 b8 8d 16 80 00 00 	movabs $0x80168d,%rax
+  801b57:	00 00 00 
+  801b5a:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b5c:	48 85 c0             	test   %rax,%rax
+  801b5f:	7e b5                	jle    801b16 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801b61:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801b65:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801b68:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801b6b:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801b6e:	8d 51 01             	lea    0x1(%rcx),%edx
+  801b71:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b74:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801b77:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801b7e:	00 
+  801b7f:	eb 95                	jmp    801b16 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b81:	48 98                	cltq
+  801b83:	eb 91                	jmp    801b16 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b85:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801b89:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801b8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b90:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b94:	48 89 df             	mov    %rbx,%rdi
+  801b97:	48 b8 8d 16 80 00 00 	movabs $0x80168d,%rax
+  801b9e:	00 00 00 
+  801ba1:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801ba3:	48 85 c0             	test   %rax,%rax
+  801ba6:	0f 8e 6a ff ff ff    	jle    801b16 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801bac:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801baf:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801bb3:	e9 5e ff ff ff       	jmp    801b16 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bb8:	48 98                	cltq
+  801bba:	4d 85 ff             	test   %r15,%r15
+  801bbd:	49 0f 45 c7          	cmovne %r15,%rax
+  801bc1:	e9 50 ff ff ff       	jmp    801b16 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bc6:	48 89 de             	mov    %rbx,%rsi
+  801bc9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801bcd:	48 b8 98 17 80 00 00 	movabs $0x801798,%rax
+  801bd4:	00 00 00 
+  801bd7:	ff d0                	call   *%rax
+  801bd9:	85 c0                	test   %eax,%eax
+  801bdb:	0f 88 2b 01 00 00    	js     801d0c <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801be1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801be5:	4c 01 f8             	add    %r15,%rax
+  801be8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801bec:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801bf0:	48 b9 9c 0c 80 00 00 	movabs $0x800c9c,%rcx
+  801bf7:	00 00 00 
+  801bfa:	ff d1                	call   *%rcx
+  801bfc:	48 89 c2             	mov    %rax,%rdx
+  801bff:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c03:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801c07:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c0b:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c10:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c13:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c1a:	00 
+  801c1b:	4c 89 ea             	mov    %r13,%rdx
+  801c1e:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c22:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  801c29:	00 00 00 
+  801c2c:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c2e:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c32:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801c36:	48 39 c2             	cmp    %rax,%rdx
+  801c39:	0f 84 db 00 00 00    	je     801d1a <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801c3f:	4c 39 e2             	cmp    %r12,%rdx
+  801c42:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801c46:	4d 01 ec             	add    %r13,%r12
+  801c49:	49 39 c4             	cmp    %rax,%r12
+  801c4c:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801c50:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801c54:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801c58:	45 01 ee             	add    %r13d,%r14d
+  801c5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c5f:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801c63:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801c66:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c6a:	49 39 c7             	cmp    %rax,%r15
+  801c6d:	0f 83 a0 fe ff ff    	jae    801b13 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801c73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c77:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801c7b:	8b 43 08             	mov    0x8(%rbx),%eax
+  801c7e:	44 39 f0             	cmp    %r14d,%eax
+  801c81:	7f 10                	jg     801c93 <devfile_write+0x1d3>
+  801c83:	48 98                	cltq
+  801c85:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801c8b:	49 63 d6             	movslq %r14d,%rdx
+  801c8e:	48 39 d0             	cmp    %rdx,%rax
+  801c91:	7d 2d                	jge    801cc0 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801c93:	48 89 de             	mov    %rbx,%rsi
+  801c96:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c9a:	48 b8 98 17 80 00 00 	movabs $0x801798,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+  801ca6:	85 c0                	test   %eax,%eax
+  801ca8:	0f 88 0a ff ff ff    	js     801bb8 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801cae:	44 89 f0             	mov    %r14d,%eax
+  801cb1:	66 b8 00 00          	mov    $0x0,%ax
+  801cb5:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801cb8:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801cbf:	00 
+        size_t off = pos - fb->fb_base;
+  801cc0:	45 89 f4             	mov    %r14d,%r12d
+  801cc3:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801cc7:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801cca:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801cce:	4d 29 fd             	sub    %r15,%r13
+  801cd1:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801cd6:	4c 29 e0             	sub    %r12,%rax
+  801cd9:	49 39 c5             	cmp    %rax,%r13
+  801cdc:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801ce0:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801ce4:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801ce8:	48 39 c2             	cmp    %rax,%rdx
+  801ceb:	0f 84 f0 fe ff ff    	je     801be1 <devfile_write+0x121>
+  801cf1:	4c 39 e0             	cmp    %r12,%rax
+  801cf4:	0f 82 cc fe ff ff    	jb     801bc6 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801cfa:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801cfe:	48 39 d0             	cmp    %rdx,%rax
+  801d01:	0f 83 da fe ff ff    	jae    801be1 <devfile_write+0x121>
+  801d07:	e9 ba fe ff ff       	jmp    801bc6 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d0c:	48 98                	cltq
+  801d0e:	4d 85 ff             	test   %r15,%r15
+  801d11:	49 0f 45 c7          	cmovne %r15,%rax
+  801d15:	e9 fc fd ff ff       	jmp    801b16 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d1a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d1e:	4c 89 e2             	mov    %r12,%rdx
+  801d21:	e9 2a ff ff ff       	jmp    801c50 <devfile_write+0x190>
+
+0000000000801d26 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d26:	55                   	push   %rbp
+  801d27:	48 89 e5             	mov    %rsp,%rbp
+  801d2a:	41 57                	push   %r15
+  801d2c:	41 56                	push   %r14
+  801d2e:	41 55                	push   %r13
+  801d30:	41 54                	push   %r12
+  801d32:	53                   	push   %rbx
+  801d33:	48 83 ec 28          	sub    $0x28,%rsp
+  801d37:	49 89 ff             	mov    %rdi,%r15
+  801d3a:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801d3e:	48 89 d3             	mov    %rdx,%rbx
+  801d41:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801d45:	48 b8 70 14 80 00 00 	movabs $0x801470,%rax
+  801d4c:	00 00 00 
+  801d4f:	ff d0                	call   *%rax
+  801d51:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801d54:	48 85 c0             	test   %rax,%rax
+  801d57:	74 0d                	je     801d66 <devfile_read+0x40>
+  801d59:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801d60:	0f 86 1a 01 00 00    	jbe    801e80 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801d66:	4d 85 e4             	test   %r12,%r12
+  801d69:	74 1a                	je     801d85 <devfile_read+0x5f>
+  801d6b:	4c 89 e6             	mov    %r12,%rsi
+  801d6e:	4c 89 ff             	mov    %r15,%rdi
+  801d71:	48 b8 98 17 80 00 00 	movabs $0x801798,%rax
+  801d78:	00 00 00 
+  801d7b:	ff d0                	call   *%rax
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	0f 88 e8 00 00 00    	js     801e6d <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801d85:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801d89:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  801d90:	00 00 00 
+  801d93:	ff d0                	call   *%rax
+  801d95:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801d98:	48 85 c0             	test   %rax,%rax
+  801d9b:	0f 84 69 02 00 00    	je     80200a <devfile_read+0x2e4>
+    while (i < n) {
+  801da1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801da6:	0f 84 ce 00 00 00    	je     801e7a <devfile_read+0x154>
+    size_t i = 0;
+  801dac:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801db1:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801db8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dbc:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801dc0:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801dc4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801dc8:	48 29 da             	sub    %rbx,%rdx
+  801dcb:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801dd0:	48 39 c2             	cmp    %rax,%rdx
+  801dd3:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801dd7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801ddb:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801ddf:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801de2:	01 d8                	add    %ebx,%eax
+  801de4:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801de8:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801dec:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801df3:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801dfa:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801e01:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e0c:	4c 89 ee             	mov    %r13,%rsi
+  801e0f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e14:	48 b8 f0 15 80 00 00 	movabs $0x8015f0,%rax
+  801e1b:	00 00 00 
+  801e1e:	ff d0                	call   *%rax
+        if (res < 0)
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	78 4d                	js     801e71 <devfile_read+0x14b>
+        if (res == 0)
+  801e24:	74 4f                	je     801e75 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e26:	4c 63 e0             	movslq %eax,%r12
+  801e29:	4c 89 e2             	mov    %r12,%rdx
+  801e2c:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e30:	4c 89 f7             	mov    %r14,%rdi
+  801e33:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  801e3a:	00 00 00 
+  801e3d:	ff d0                	call   *%rax
+        i += res;
+  801e3f:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801e42:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801e45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e49:	48 39 c3             	cmp    %rax,%rbx
+  801e4c:	0f 82 72 ff ff ff    	jb     801dc4 <devfile_read+0x9e>
+    return i;
+  801e52:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801e55:	48 85 c0             	test   %rax,%rax
+  801e58:	7e 04                	jle    801e5e <devfile_read+0x138>
+  801e5a:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801e5e:	48 83 c4 28          	add    $0x28,%rsp
+  801e62:	5b                   	pop    %rbx
+  801e63:	41 5c                	pop    %r12
+  801e65:	41 5d                	pop    %r13
+  801e67:	41 5e                	pop    %r14
+  801e69:	41 5f                	pop    %r15
+  801e6b:	5d                   	pop    %rbp
+  801e6c:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801e6d:	48 98                	cltq
+  801e6f:	eb ed                	jmp    801e5e <devfile_read+0x138>
+            return res;
+  801e71:	48 98                	cltq
+  801e73:	eb e9                	jmp    801e5e <devfile_read+0x138>
+            return i;
+  801e75:	48 89 d8             	mov    %rbx,%rax
+  801e78:	eb db                	jmp    801e55 <devfile_read+0x12f>
+    size_t i = 0;
+  801e7a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801e7e:	eb d2                	jmp    801e52 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801e80:	48 89 c6             	mov    %rax,%rsi
+  801e83:	4c 89 ff             	mov    %r15,%rdi
+  801e86:	48 b8 98 17 80 00 00 	movabs $0x801798,%rax
+  801e8d:	00 00 00 
+  801e90:	ff d0                	call   *%rax
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	78 40                	js     801ed6 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801e96:	4c 89 ff             	mov    %r15,%rdi
+  801e99:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  801ea0:	00 00 00 
+  801ea3:	ff d0                	call   *%rax
+  801ea5:	48 89 c2             	mov    %rax,%rdx
+  801ea8:	48 c1 e2 04          	shl    $0x4,%rdx
+  801eac:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801eb0:	48 c1 e0 0c          	shl    $0xc,%rax
+  801eb4:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801eb9:	48 01 d0             	add    %rdx,%rax
+  801ebc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801ec0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ec5:	0f 84 33 01 00 00    	je     801ffe <devfile_read+0x2d8>
+    size_t i = 0;
+  801ecb:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801ed1:	e9 f5 00 00 00       	jmp    801fcb <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801ed6:	48 98                	cltq
+  801ed8:	eb 84                	jmp    801e5e <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801eda:	44 89 e8             	mov    %r13d,%eax
+  801edd:	66 b8 00 00          	mov    $0x0,%ax
+  801ee1:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801ee6:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801eed:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801eef:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801ef3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801ef7:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801ef9:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801efe:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801f01:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801f08:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801f09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f14:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f19:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f1e:	48 b8 f0 15 80 00 00 	movabs $0x8015f0,%rax
+  801f25:	00 00 00 
+  801f28:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f2a:	85 c0                	test   %eax,%eax
+  801f2c:	0f 88 be 00 00 00    	js     801ff0 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f32:	48 63 d0             	movslq %eax,%rdx
+  801f35:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801f3a:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801f3f:	44 39 e8             	cmp    %r13d,%eax
+  801f42:	0f 8e ba 00 00 00    	jle    802002 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801f48:	49 63 c5             	movslq %r13d,%rax
+  801f4b:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801f50:	48 29 c3             	sub    %rax,%rbx
+  801f53:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801f58:	48 01 c3             	add    %rax,%rbx
+  801f5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f5f:	4c 29 f0             	sub    %r14,%rax
+  801f62:	48 39 c3             	cmp    %rax,%rbx
+  801f65:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801f69:	4c 89 ff             	mov    %r15,%rdi
+  801f6c:	48 b9 9c 0c 80 00 00 	movabs $0x800c9c,%rcx
+  801f73:	00 00 00 
+  801f76:	ff d1                	call   *%rcx
+  801f78:	48 89 c2             	mov    %rax,%rdx
+  801f7b:	48 c1 e2 04          	shl    $0x4,%rdx
+  801f7f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801f83:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f87:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801f8c:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801f8f:	44 89 ea             	mov    %r13d,%edx
+  801f92:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  801f97:	48 63 d2             	movslq %edx,%rdx
+  801f9a:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801fa1:	00 
+  801fa2:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801fa6:	4c 01 f7             	add    %r14,%rdi
+  801fa9:	48 89 da             	mov    %rbx,%rdx
+  801fac:	48 b9 e2 3d 80 00 00 	movabs $0x803de2,%rcx
+  801fb3:	00 00 00 
+  801fb6:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  801fb8:	41 01 dd             	add    %ebx,%r13d
+  801fbb:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  801fbf:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  801fc2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fc6:	49 39 c6             	cmp    %rax,%r14
+  801fc9:	73 37                	jae    802002 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  801fcb:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  801fcf:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801fd4:	44 39 e8             	cmp    %r13d,%eax
+  801fd7:	0f 8f fd fe ff ff    	jg     801eda <devfile_read+0x1b4>
+  801fdd:	41 03 44 24 10       	add    0x10(%r12),%eax
+  801fe2:	44 39 e8             	cmp    %r13d,%eax
+  801fe5:	0f 8f 5d ff ff ff    	jg     801f48 <devfile_read+0x222>
+  801feb:	e9 ea fe ff ff       	jmp    801eda <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  801ff0:	48 98                	cltq
+  801ff2:	4d 85 f6             	test   %r14,%r14
+  801ff5:	49 0f 45 c6          	cmovne %r14,%rax
+  801ff9:	e9 60 fe ff ff       	jmp    801e5e <devfile_read+0x138>
+    size_t i = 0;
+  801ffe:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  802002:	4c 89 f0             	mov    %r14,%rax
+  802005:	e9 54 fe ff ff       	jmp    801e5e <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80200a:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802011:	e9 48 fe ff ff       	jmp    801e5e <devfile_read+0x138>
+
+0000000000802016 <open>:
+open(const char *path, int mode) {
+  802016:	55                   	push   %rbp
+  802017:	48 89 e5             	mov    %rsp,%rbp
+  80201a:	41 55                	push   %r13
+  80201c:	41 54                	push   %r12
+  80201e:	53                   	push   %rbx
+  80201f:	48 83 ec 18          	sub    $0x18,%rsp
+  802023:	49 89 fc             	mov    %rdi,%r12
+  802026:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802029:	48 b8 af 39 80 00 00 	movabs $0x8039af,%rax
+  802030:	00 00 00 
+  802033:	ff d0                	call   *%rax
+  802035:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80203b:	0f 87 8a 00 00 00    	ja     8020cb <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802041:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802045:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  80204c:	00 00 00 
+  80204f:	ff d0                	call   *%rax
+  802051:	89 c3                	mov    %eax,%ebx
+  802053:	85 c0                	test   %eax,%eax
+  802055:	78 50                	js     8020a7 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802057:	4c 89 e6             	mov    %r12,%rsi
+  80205a:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802061:	00 00 00 
+  802064:	48 89 df             	mov    %rbx,%rdi
+  802067:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  80206e:	00 00 00 
+  802071:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802073:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80207a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80207e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802083:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  80208a:	00 00 00 
+  80208d:	ff d0                	call   *%rax
+  80208f:	89 c3                	mov    %eax,%ebx
+  802091:	85 c0                	test   %eax,%eax
+  802093:	78 1f                	js     8020b4 <open+0x9e>
+    return fd2num(fd);
+  802095:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802099:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  8020a0:	00 00 00 
+  8020a3:	ff d0                	call   *%rax
+  8020a5:	89 c3                	mov    %eax,%ebx
+}
+  8020a7:	89 d8                	mov    %ebx,%eax
+  8020a9:	48 83 c4 18          	add    $0x18,%rsp
+  8020ad:	5b                   	pop    %rbx
+  8020ae:	41 5c                	pop    %r12
+  8020b0:	41 5d                	pop    %r13
+  8020b2:	5d                   	pop    %rbp
+  8020b3:	c3                   	ret
+        fd_close(fd, 0);
+  8020b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020bd:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  8020c4:	00 00 00 
+  8020c7:	ff d0                	call   *%rax
+        return res;
+  8020c9:	eb dc                	jmp    8020a7 <open+0x91>
+        return -E_BAD_PATH;
+  8020cb:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020d0:	eb d5                	jmp    8020a7 <open+0x91>
+
+00000000008020d2 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8020d2:	55                   	push   %rbp
+  8020d3:	48 89 e5             	mov    %rsp,%rbp
+  8020d6:	41 57                	push   %r15
+  8020d8:	41 56                	push   %r14
+  8020da:	41 55                	push   %r13
+  8020dc:	41 54                	push   %r12
+  8020de:	53                   	push   %rbx
+  8020df:	48 83 ec 18          	sub    $0x18,%rsp
+  8020e3:	41 89 f6             	mov    %esi,%r14d
+  8020e6:	49 89 d7             	mov    %rdx,%r15
+  8020e9:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020ec:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8020f0:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  8020f7:	00 00 00 
+  8020fa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020fc:	85 c0                	test   %eax,%eax
+  8020fe:	0f 88 db 00 00 00    	js     8021df <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802104:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802108:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80210f:	00 00 00 
+  802112:	8b 00                	mov    (%rax),%eax
+  802114:	39 07                	cmp    %eax,(%rdi)
+  802116:	0f 85 db 00 00 00    	jne    8021f7 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80211c:	45 85 f6             	test   %r14d,%r14d
+  80211f:	0f 88 db 00 00 00    	js     802200 <fmap+0x12e>
+  802125:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80212c:	0f 85 d7 00 00 00    	jne    802209 <fmap+0x137>
+  802132:	4c 89 fb             	mov    %r15,%rbx
+  802135:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80213b:	0f 85 d1 00 00 00    	jne    802212 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802141:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  802148:	00 00 00 
+  80214b:	ff d0                	call   *%rax
+  80214d:	85 c0                	test   %eax,%eax
+  80214f:	0f 88 8e 00 00 00    	js     8021e3 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802155:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80215c:	00 00 00 
+    while (i < n) {
+  80215f:	4d 85 ed             	test   %r13,%r13
+  802162:	0f 84 8a 00 00 00    	je     8021f2 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  802168:	4c 89 ea             	mov    %r13,%rdx
+  80216b:	48 29 da             	sub    %rbx,%rdx
+  80216e:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  802175:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80217b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80217f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802183:	8b 40 0c             	mov    0xc(%rax),%eax
+  802186:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80218a:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  80218e:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  802193:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  802198:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80219c:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8021a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021a5:	4c 89 e6             	mov    %r12,%rsi
+  8021a8:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021ad:	48 b8 f0 15 80 00 00 	movabs $0x8015f0,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021b9:	85 c0                	test   %eax,%eax
+  8021bb:	78 2a                	js     8021e7 <fmap+0x115>
+        i += res;
+  8021bd:	48 98                	cltq
+  8021bf:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8021c2:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8021c6:	72 05                	jb     8021cd <fmap+0xfb>
+    while (i < n) {
+  8021c8:	4c 39 eb             	cmp    %r13,%rbx
+  8021cb:	72 9b                	jb     802168 <fmap+0x96>
+    }
+    return i;
+  8021cd:	48 89 d8             	mov    %rbx,%rax
+}
+  8021d0:	48 83 c4 18          	add    $0x18,%rsp
+  8021d4:	5b                   	pop    %rbx
+  8021d5:	41 5c                	pop    %r12
+  8021d7:	41 5d                	pop    %r13
+  8021d9:	41 5e                	pop    %r14
+  8021db:	41 5f                	pop    %r15
+  8021dd:	5d                   	pop    %rbp
+  8021de:	c3                   	ret
+    if (res < 0) return res;
+  8021df:	48 98                	cltq
+  8021e1:	eb ed                	jmp    8021d0 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8021e3:	48 98                	cltq
+  8021e5:	eb e9                	jmp    8021d0 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021e7:	48 98                	cltq
+  8021e9:	48 85 db             	test   %rbx,%rbx
+  8021ec:	48 0f 45 c3          	cmovne %rbx,%rax
+  8021f0:	eb de                	jmp    8021d0 <fmap+0xfe>
+    size_t i = 0;
+  8021f2:	4c 89 eb             	mov    %r13,%rbx
+  8021f5:	eb d6                	jmp    8021cd <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8021f7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8021fe:	eb d0                	jmp    8021d0 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802200:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802207:	eb c7                	jmp    8021d0 <fmap+0xfe>
+  802209:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802210:	eb be                	jmp    8021d0 <fmap+0xfe>
+  802212:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802219:	eb b5                	jmp    8021d0 <fmap+0xfe>
+
+000000000080221b <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80221b:	55                   	push   %rbp
+  80221c:	48 89 e5             	mov    %rsp,%rbp
+  80221f:	41 56                	push   %r14
+  802221:	41 55                	push   %r13
+  802223:	41 54                	push   %r12
+  802225:	53                   	push   %rbx
+  802226:	48 83 ec 10          	sub    $0x10,%rsp
+  80222a:	89 fb                	mov    %edi,%ebx
+  80222c:	41 89 f4             	mov    %esi,%r12d
+  80222f:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802232:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802236:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  80223d:	00 00 00 
+  802240:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802242:	85 c0                	test   %eax,%eax
+  802244:	78 63                	js     8022a9 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  802246:	45 85 e4             	test   %r12d,%r12d
+  802249:	0f 88 80 00 00 00    	js     8022cf <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80224f:	45 89 e6             	mov    %r12d,%r14d
+  802252:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  802259:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80225d:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  802264:	00 00 00 
+  802267:	ff d0                	call   *%rax
+  802269:	48 89 c2             	mov    %rax,%rdx
+  80226c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802271:	44 89 f6             	mov    %r14d,%esi
+  802274:	89 df                	mov    %ebx,%edi
+  802276:	48 b8 d2 20 80 00 00 	movabs $0x8020d2,%rax
+  80227d:	00 00 00 
+  802280:	ff d0                	call   *%rax
+  802282:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  802285:	45 29 f4             	sub    %r14d,%r12d
+  802288:	4d 63 f4             	movslq %r12d,%r14
+  80228b:	49 39 c6             	cmp    %rax,%r14
+  80228e:	7c 1d                	jl     8022ad <read_map+0x92>
+  802290:	48 85 c0             	test   %rax,%rax
+  802293:	b8 00 00 00 00       	mov    $0x0,%eax
+  802298:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80229c:	48 83 c4 10          	add    $0x10,%rsp
+  8022a0:	5b                   	pop    %rbx
+  8022a1:	41 5c                	pop    %r12
+  8022a3:	41 5d                	pop    %r13
+  8022a5:	41 5e                	pop    %r14
+  8022a7:	5d                   	pop    %rbp
+  8022a8:	c3                   	ret
+    if (res < 0) return res;
+  8022a9:	48 98                	cltq
+  8022ab:	eb ef                	jmp    80229c <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8022ad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022b1:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  8022b8:	00 00 00 
+  8022bb:	ff d0                	call   *%rax
+  8022bd:	4d 63 e4             	movslq %r12d,%r12
+  8022c0:	4c 01 e0             	add    %r12,%rax
+  8022c3:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8022c7:	48 89 d8             	mov    %rbx,%rax
+  8022ca:	4c 29 f0             	sub    %r14,%rax
+  8022cd:	eb cd                	jmp    80229c <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8022cf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022d6:	eb c4                	jmp    80229c <read_map+0x81>
+
+00000000008022d8 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8022d8:	55                   	push   %rbp
+  8022d9:	48 89 e5             	mov    %rsp,%rbp
+  8022dc:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022e0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022e4:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  8022eb:	00 00 00 
+  8022ee:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022f0:	85 c0                	test   %eax,%eax
+  8022f2:	78 4a                	js     80233e <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8022f4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8022f8:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8022ff:	00 00 00 
+  802302:	8b 00                	mov    (%rax),%eax
+  802304:	39 07                	cmp    %eax,(%rdi)
+  802306:	75 38                	jne    802340 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802308:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  80230f:	00 00 00 
+  802312:	ff d0                	call   *%rax
+  802314:	85 c0                	test   %eax,%eax
+  802316:	78 26                	js     80233e <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802318:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80231c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80231f:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802326:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802328:	be 00 00 00 00       	mov    $0x0,%esi
+  80232d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802332:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  802339:	00 00 00 
+  80233c:	ff d0                	call   *%rax
+}
+  80233e:	c9                   	leave
+  80233f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802340:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802345:	eb f7                	jmp    80233e <fsync+0x66>
+
+0000000000802347 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  802347:	55                   	push   %rbp
+  802348:	48 89 e5             	mov    %rsp,%rbp
+  80234b:	41 57                	push   %r15
+  80234d:	41 56                	push   %r14
+  80234f:	41 55                	push   %r13
+  802351:	41 54                	push   %r12
+  802353:	53                   	push   %rbx
+  802354:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  802358:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80235f:	00 00 00 
+  802362:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  802367:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80236d:	49 bd 2a 0d 80 00 00 	movabs $0x800d2a,%r13
+  802374:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  802377:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  80237e:	00 00 00 
+  802381:	eb 0c                	jmp    80238f <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  802383:	83 c3 01             	add    $0x1,%ebx
+  802386:	49 83 c4 28          	add    $0x28,%r12
+  80238a:	83 fb 20             	cmp    $0x20,%ebx
+  80238d:	74 33                	je     8023c2 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80238f:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  802394:	74 ed                	je     802383 <flushall+0x3c>
+  802396:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80239a:	89 df                	mov    %ebx,%edi
+  80239c:	41 ff d5             	call   *%r13
+  80239f:	85 c0                	test   %eax,%eax
+  8023a1:	78 e0                	js     802383 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8023a3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023a7:	41 8b 06             	mov    (%r14),%eax
+  8023aa:	39 07                	cmp    %eax,(%rdi)
+  8023ac:	75 d5                	jne    802383 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8023ae:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  8023b5:	00 00 00 
+  8023b8:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8023ba:	85 c0                	test   %eax,%eax
+  8023bc:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8023c0:	eb c1                	jmp    802383 <flushall+0x3c>
+    }
+    return res;
+}
+  8023c2:	44 89 f8             	mov    %r15d,%eax
+  8023c5:	48 83 c4 18          	add    $0x18,%rsp
+  8023c9:	5b                   	pop    %rbx
+  8023ca:	41 5c                	pop    %r12
+  8023cc:	41 5d                	pop    %r13
+  8023ce:	41 5e                	pop    %r14
+  8023d0:	41 5f                	pop    %r15
+  8023d2:	5d                   	pop    %rbp
+  8023d3:	c3                   	ret
+
+00000000008023d4 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8023d4:	55                   	push   %rbp
+  8023d5:	48 89 e5             	mov    %rsp,%rbp
+  8023d8:	53                   	push   %rbx
+  8023d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8023dd:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8023e0:	40 0f b6 c6          	movzbl %sil,%eax
+  8023e4:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8023eb:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8023ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8023f7:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  8023fe:	00 00 00 
+  802401:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802403:	85 c0                	test   %eax,%eax
+  802405:	78 23                	js     80242a <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  802407:	ba 58 06 00 00       	mov    $0x658,%edx
+  80240c:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802413:	00 00 00 
+  802416:	48 89 df             	mov    %rbx,%rdi
+  802419:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  802420:	00 00 00 
+  802423:	ff d0                	call   *%rax
+    return 0;
+  802425:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80242a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80242e:	c9                   	leave
+  80242f:	c3                   	ret
+
+0000000000802430 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  802430:	55                   	push   %rbp
+  802431:	48 89 e5             	mov    %rsp,%rbp
+  802434:	53                   	push   %rbx
+  802435:	48 83 ec 08          	sub    $0x8,%rsp
+  802439:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  80243c:	48 b8 af 39 80 00 00 	movabs $0x8039af,%rax
+  802443:	00 00 00 
+  802446:	ff d0                	call   *%rax
+  802448:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80244e:	77 35                	ja     802485 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  802450:	48 89 de             	mov    %rbx,%rsi
+  802453:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80245a:	00 00 00 
+  80245d:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  802464:	00 00 00 
+  802467:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  802469:	be 00 00 00 00       	mov    $0x0,%esi
+  80246e:	bf 07 00 00 00       	mov    $0x7,%edi
+  802473:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  80247a:	00 00 00 
+  80247d:	ff d0                	call   *%rax
+}
+  80247f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802483:	c9                   	leave
+  802484:	c3                   	ret
+        return -E_BAD_PATH;
+  802485:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80248a:	eb f3                	jmp    80247f <remove+0x4f>
+
+000000000080248c <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80248c:	55                   	push   %rbp
+  80248d:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  802490:	48 b8 47 23 80 00 00 	movabs $0x802347,%rax
+  802497:	00 00 00 
+  80249a:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80249c:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024a6:	48 b8 9c 18 80 00 00 	movabs $0x80189c,%rax
+  8024ad:	00 00 00 
+  8024b0:	ff d0                	call   *%rax
+}
+  8024b2:	5d                   	pop    %rbp
+  8024b3:	c3                   	ret
+
+00000000008024b4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024b4:	55                   	push   %rbp
+  8024b5:	48 89 e5             	mov    %rsp,%rbp
+  8024b8:	41 54                	push   %r12
+  8024ba:	53                   	push   %rbx
+  8024bb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024be:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+  8024ca:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024cd:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  8024d4:	00 00 00 
+  8024d7:	48 89 df             	mov    %rbx,%rdi
+  8024da:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  8024e1:	00 00 00 
+  8024e4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024e6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024eb:	41 2b 04 24          	sub    (%r12),%eax
+  8024ef:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024f5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024fc:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024ff:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802506:	00 00 00 
+  802509:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802510:	b8 00 00 00 00       	mov    $0x0,%eax
+  802515:	5b                   	pop    %rbx
+  802516:	41 5c                	pop    %r12
+  802518:	5d                   	pop    %rbp
+  802519:	c3                   	ret
+
+000000000080251a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80251a:	55                   	push   %rbp
+  80251b:	48 89 e5             	mov    %rsp,%rbp
+  80251e:	41 54                	push   %r12
+  802520:	53                   	push   %rbx
+  802521:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802524:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802529:	48 89 fe             	mov    %rdi,%rsi
+  80252c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802531:	49 bc 65 04 80 00 00 	movabs $0x800465,%r12
+  802538:	00 00 00 
+  80253b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80253e:	48 89 df             	mov    %rbx,%rdi
+  802541:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+  80254d:	48 89 c6             	mov    %rax,%rsi
+  802550:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802555:	bf 00 00 00 00       	mov    $0x0,%edi
+  80255a:	41 ff d4             	call   *%r12
+}
+  80255d:	5b                   	pop    %rbx
+  80255e:	41 5c                	pop    %r12
+  802560:	5d                   	pop    %rbp
+  802561:	c3                   	ret
+
+0000000000802562 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802562:	55                   	push   %rbp
+  802563:	48 89 e5             	mov    %rsp,%rbp
+  802566:	41 57                	push   %r15
+  802568:	41 56                	push   %r14
+  80256a:	41 55                	push   %r13
+  80256c:	41 54                	push   %r12
+  80256e:	53                   	push   %rbx
+  80256f:	48 83 ec 18          	sub    $0x18,%rsp
+  802573:	49 89 fc             	mov    %rdi,%r12
+  802576:	49 89 f5             	mov    %rsi,%r13
+  802579:	49 89 d7             	mov    %rdx,%r15
+  80257c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802580:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  802587:	00 00 00 
+  80258a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80258c:	4d 85 ff             	test   %r15,%r15
+  80258f:	0f 84 af 00 00 00    	je     802644 <devpipe_write+0xe2>
+  802595:	48 89 c3             	mov    %rax,%rbx
+  802598:	4c 89 f8             	mov    %r15,%rax
+  80259b:	4d 89 ef             	mov    %r13,%r15
+  80259e:	4c 01 e8             	add    %r13,%rax
+  8025a1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025a5:	49 bd 5a 02 80 00 00 	movabs $0x80025a,%r13
+  8025ac:	00 00 00 
+            sys_yield();
+  8025af:	49 be f7 01 80 00 00 	movabs $0x8001f7,%r14
+  8025b6:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025b9:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025bc:	48 63 ce             	movslq %esi,%rcx
+  8025bf:	48 63 03             	movslq (%rbx),%rax
+  8025c2:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025c8:	48 39 c1             	cmp    %rax,%rcx
+  8025cb:	72 2e                	jb     8025fb <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025cd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025d2:	48 89 da             	mov    %rbx,%rdx
+  8025d5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025da:	4c 89 e7             	mov    %r12,%rdi
+  8025dd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025e0:	85 c0                	test   %eax,%eax
+  8025e2:	74 66                	je     80264a <devpipe_write+0xe8>
+            sys_yield();
+  8025e4:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025e7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025ea:	48 63 ce             	movslq %esi,%rcx
+  8025ed:	48 63 03             	movslq (%rbx),%rax
+  8025f0:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025f6:	48 39 c1             	cmp    %rax,%rcx
+  8025f9:	73 d2                	jae    8025cd <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025fb:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025ff:	48 89 ca             	mov    %rcx,%rdx
+  802602:	48 c1 ea 03          	shr    $0x3,%rdx
+  802606:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80260d:	08 10 20 
+  802610:	48 f7 e2             	mul    %rdx
+  802613:	48 c1 ea 06          	shr    $0x6,%rdx
+  802617:	48 89 d0             	mov    %rdx,%rax
+  80261a:	48 c1 e0 09          	shl    $0x9,%rax
+  80261e:	48 29 d0             	sub    %rdx,%rax
+  802621:	48 c1 e0 03          	shl    $0x3,%rax
+  802625:	48 29 c1             	sub    %rax,%rcx
+  802628:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80262d:	83 c6 01             	add    $0x1,%esi
+  802630:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802633:	49 83 c7 01          	add    $0x1,%r15
+  802637:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80263b:	49 39 c7             	cmp    %rax,%r15
+  80263e:	0f 85 75 ff ff ff    	jne    8025b9 <devpipe_write+0x57>
+    return n;
+  802644:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802648:	eb 05                	jmp    80264f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80264a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80264f:	48 83 c4 18          	add    $0x18,%rsp
+  802653:	5b                   	pop    %rbx
+  802654:	41 5c                	pop    %r12
+  802656:	41 5d                	pop    %r13
+  802658:	41 5e                	pop    %r14
+  80265a:	41 5f                	pop    %r15
+  80265c:	5d                   	pop    %rbp
+  80265d:	c3                   	ret
+
+000000000080265e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80265e:	55                   	push   %rbp
+  80265f:	48 89 e5             	mov    %rsp,%rbp
+  802662:	41 57                	push   %r15
+  802664:	41 56                	push   %r14
+  802666:	41 55                	push   %r13
+  802668:	41 54                	push   %r12
+  80266a:	53                   	push   %rbx
+  80266b:	48 83 ec 18          	sub    $0x18,%rsp
+  80266f:	49 89 fc             	mov    %rdi,%r12
+  802672:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802676:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80267a:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  802681:	00 00 00 
+  802684:	ff d0                	call   *%rax
+  802686:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802689:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80268f:	49 bd 5a 02 80 00 00 	movabs $0x80025a,%r13
+  802696:	00 00 00 
+            sys_yield();
+  802699:	49 be f7 01 80 00 00 	movabs $0x8001f7,%r14
+  8026a0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026a3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026a8:	74 7d                	je     802727 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026aa:	8b 03                	mov    (%rbx),%eax
+  8026ac:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026af:	75 26                	jne    8026d7 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026b1:	4d 85 ff             	test   %r15,%r15
+  8026b4:	75 77                	jne    80272d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026b6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026bb:	48 89 da             	mov    %rbx,%rdx
+  8026be:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026c3:	4c 89 e7             	mov    %r12,%rdi
+  8026c6:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026c9:	85 c0                	test   %eax,%eax
+  8026cb:	74 72                	je     80273f <devpipe_read+0xe1>
+            sys_yield();
+  8026cd:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026d0:	8b 03                	mov    (%rbx),%eax
+  8026d2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026d5:	74 df                	je     8026b6 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026d7:	48 63 c8             	movslq %eax,%rcx
+  8026da:	48 89 ca             	mov    %rcx,%rdx
+  8026dd:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026e1:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026e8:	08 10 20 
+  8026eb:	48 89 d0             	mov    %rdx,%rax
+  8026ee:	48 f7 e6             	mul    %rsi
+  8026f1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026f5:	48 89 d0             	mov    %rdx,%rax
+  8026f8:	48 c1 e0 09          	shl    $0x9,%rax
+  8026fc:	48 29 d0             	sub    %rdx,%rax
+  8026ff:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802706:	00 
+  802707:	48 89 c8             	mov    %rcx,%rax
+  80270a:	48 29 d0             	sub    %rdx,%rax
+  80270d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802712:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802716:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80271a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80271d:	49 83 c7 01          	add    $0x1,%r15
+  802721:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802725:	75 83                	jne    8026aa <devpipe_read+0x4c>
+    return n;
+  802727:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80272b:	eb 03                	jmp    802730 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80272d:	4c 89 f8             	mov    %r15,%rax
+}
+  802730:	48 83 c4 18          	add    $0x18,%rsp
+  802734:	5b                   	pop    %rbx
+  802735:	41 5c                	pop    %r12
+  802737:	41 5d                	pop    %r13
+  802739:	41 5e                	pop    %r14
+  80273b:	41 5f                	pop    %r15
+  80273d:	5d                   	pop    %rbp
+  80273e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80273f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802744:	eb ea                	jmp    802730 <devpipe_read+0xd2>
+
+0000000000802746 <pipe>:
+pipe(int pfd[2]) {
+  802746:	55                   	push   %rbp
+  802747:	48 89 e5             	mov    %rsp,%rbp
+  80274a:	41 55                	push   %r13
+  80274c:	41 54                	push   %r12
+  80274e:	53                   	push   %rbx
+  80274f:	48 83 ec 18          	sub    $0x18,%rsp
+  802753:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802756:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80275a:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  802761:	00 00 00 
+  802764:	ff d0                	call   *%rax
+  802766:	89 c3                	mov    %eax,%ebx
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	0f 88 a0 01 00 00    	js     802910 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802770:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802775:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80277a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80277e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802783:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  80278a:	00 00 00 
+  80278d:	ff d0                	call   *%rax
+  80278f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802791:	85 c0                	test   %eax,%eax
+  802793:	0f 88 77 01 00 00    	js     802910 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802799:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80279d:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  8027a4:	00 00 00 
+  8027a7:	ff d0                	call   *%rax
+  8027a9:	89 c3                	mov    %eax,%ebx
+  8027ab:	85 c0                	test   %eax,%eax
+  8027ad:	0f 88 43 01 00 00    	js     8028f6 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027b3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027bd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c6:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  8027cd:	00 00 00 
+  8027d0:	ff d0                	call   *%rax
+  8027d2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027d4:	85 c0                	test   %eax,%eax
+  8027d6:	0f 88 1a 01 00 00    	js     8028f6 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027dc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027e0:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  8027e7:	00 00 00 
+  8027ea:	ff d0                	call   *%rax
+  8027ec:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027ef:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027f9:	48 89 c6             	mov    %rax,%rsi
+  8027fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802801:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  802808:	00 00 00 
+  80280b:	ff d0                	call   *%rax
+  80280d:	89 c3                	mov    %eax,%ebx
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	0f 88 c5 00 00 00    	js     8028dc <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802817:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80281b:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  802822:	00 00 00 
+  802825:	ff d0                	call   *%rax
+  802827:	48 89 c1             	mov    %rax,%rcx
+  80282a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802830:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802836:	ba 00 00 00 00       	mov    $0x0,%edx
+  80283b:	4c 89 ee             	mov    %r13,%rsi
+  80283e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802843:	48 b8 ed 02 80 00 00 	movabs $0x8002ed,%rax
+  80284a:	00 00 00 
+  80284d:	ff d0                	call   *%rax
+  80284f:	89 c3                	mov    %eax,%ebx
+  802851:	85 c0                	test   %eax,%eax
+  802853:	78 6e                	js     8028c3 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802855:	be 00 10 00 00       	mov    $0x1000,%esi
+  80285a:	4c 89 ef             	mov    %r13,%rdi
+  80285d:	48 b8 28 02 80 00 00 	movabs $0x800228,%rax
+  802864:	00 00 00 
+  802867:	ff d0                	call   *%rax
+  802869:	83 f8 02             	cmp    $0x2,%eax
+  80286c:	0f 85 ab 00 00 00    	jne    80291d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802872:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  802879:	00 00 
+  80287b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80287f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802881:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802885:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80288c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802890:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802892:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802896:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80289d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028a1:	48 bb 9c 0c 80 00 00 	movabs $0x800c9c,%rbx
+  8028a8:	00 00 00 
+  8028ab:	ff d3                	call   *%rbx
+  8028ad:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028b1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028b5:	ff d3                	call   *%rbx
+  8028b7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028c1:	eb 4d                	jmp    802910 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8028c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028c8:	4c 89 ee             	mov    %r13,%rsi
+  8028cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d0:	48 b8 65 04 80 00 00 	movabs $0x800465,%rax
+  8028d7:	00 00 00 
+  8028da:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028e1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ea:	48 b8 65 04 80 00 00 	movabs $0x800465,%rax
+  8028f1:	00 00 00 
+  8028f4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8028f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028fb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802904:	48 b8 65 04 80 00 00 	movabs $0x800465,%rax
+  80290b:	00 00 00 
+  80290e:	ff d0                	call   *%rax
+}
+  802910:	89 d8                	mov    %ebx,%eax
+  802912:	48 83 c4 18          	add    $0x18,%rsp
+  802916:	5b                   	pop    %rbx
+  802917:	41 5c                	pop    %r12
+  802919:	41 5d                	pop    %r13
+  80291b:	5d                   	pop    %rbp
+  80291c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80291d:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  802924:	00 00 00 
+  802927:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  80292e:	00 00 00 
+  802931:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802936:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  80293d:	00 00 00 
+  802940:	b8 00 00 00 00       	mov    $0x0,%eax
+  802945:	49 b8 25 2f 80 00 00 	movabs $0x802f25,%r8
+  80294c:	00 00 00 
+  80294f:	41 ff d0             	call   *%r8
+
+0000000000802952 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802952:	55                   	push   %rbp
+  802953:	48 89 e5             	mov    %rsp,%rbp
+  802956:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80295a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80295e:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  802965:	00 00 00 
+  802968:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80296a:	85 c0                	test   %eax,%eax
+  80296c:	78 35                	js     8029a3 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80296e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802972:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  802979:	00 00 00 
+  80297c:	ff d0                	call   *%rax
+  80297e:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802981:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802986:	be 00 10 00 00       	mov    $0x1000,%esi
+  80298b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80298f:	48 b8 5a 02 80 00 00 	movabs $0x80025a,%rax
+  802996:	00 00 00 
+  802999:	ff d0                	call   *%rax
+  80299b:	85 c0                	test   %eax,%eax
+  80299d:	0f 94 c0             	sete   %al
+  8029a0:	0f b6 c0             	movzbl %al,%eax
+}
+  8029a3:	c9                   	leave
+  8029a4:	c3                   	ret
+
+00000000008029a5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029a5:	48 89 f8             	mov    %rdi,%rax
+  8029a8:	48 c1 e8 27          	shr    $0x27,%rax
+  8029ac:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8029b3:	7f 00 00 
+  8029b6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ba:	f6 c2 01             	test   $0x1,%dl
+  8029bd:	74 6d                	je     802a2c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029bf:	48 89 f8             	mov    %rdi,%rax
+  8029c2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029c6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029cd:	7f 00 00 
+  8029d0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029d4:	f6 c2 01             	test   $0x1,%dl
+  8029d7:	74 62                	je     802a3b <get_uvpt_entry+0x96>
+  8029d9:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029e0:	7f 00 00 
+  8029e3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029e7:	f6 c2 80             	test   $0x80,%dl
+  8029ea:	75 4f                	jne    802a3b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029ec:	48 89 f8             	mov    %rdi,%rax
+  8029ef:	48 c1 e8 15          	shr    $0x15,%rax
+  8029f3:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8029fa:	7f 00 00 
+  8029fd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a01:	f6 c2 01             	test   $0x1,%dl
+  802a04:	74 44                	je     802a4a <get_uvpt_entry+0xa5>
+  802a06:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a0d:	7f 00 00 
+  802a10:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a14:	f6 c2 80             	test   $0x80,%dl
+  802a17:	75 31                	jne    802a4a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a19:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a1d:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a24:	7f 00 00 
+  802a27:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a2b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a2c:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a33:	7f 00 00 
+  802a36:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a3a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a3b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a42:	7f 00 00 
+  802a45:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a49:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a4a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a51:	7f 00 00 
+  802a54:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a58:	c3                   	ret
+
+0000000000802a59 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802a59:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a5c:	48 89 f9             	mov    %rdi,%rcx
+  802a5f:	48 c1 e9 27          	shr    $0x27,%rcx
+  802a63:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802a6a:	7f 00 00 
+  802a6d:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802a71:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a78:	f6 c1 01             	test   $0x1,%cl
+  802a7b:	0f 84 b2 00 00 00    	je     802b33 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a81:	48 89 f9             	mov    %rdi,%rcx
+  802a84:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802a88:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802a8f:	7f 00 00 
+  802a92:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802a96:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a9d:	40 f6 c6 01          	test   $0x1,%sil
+  802aa1:	0f 84 8c 00 00 00    	je     802b33 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802aa7:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802aae:	7f 00 00 
+  802ab1:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802ab5:	a8 80                	test   $0x80,%al
+  802ab7:	75 7b                	jne    802b34 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ab9:	48 89 f9             	mov    %rdi,%rcx
+  802abc:	48 c1 e9 15          	shr    $0x15,%rcx
+  802ac0:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802ac7:	7f 00 00 
+  802aca:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802ace:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ad5:	40 f6 c6 01          	test   $0x1,%sil
+  802ad9:	74 58                	je     802b33 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802adb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802ae2:	7f 00 00 
+  802ae5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802ae9:	a8 80                	test   $0x80,%al
+  802aeb:	75 6c                	jne    802b59 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802aed:	48 89 f9             	mov    %rdi,%rcx
+  802af0:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802af4:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802afb:	7f 00 00 
+  802afe:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b02:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b09:	40 f6 c6 01          	test   $0x1,%sil
+  802b0d:	74 24                	je     802b33 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b0f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b16:	7f 00 00 
+  802b19:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b1d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b24:	ff ff 7f 
+  802b27:	48 21 c8             	and    %rcx,%rax
+  802b2a:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b30:	48 09 d0             	or     %rdx,%rax
+}
+  802b33:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b34:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b3b:	7f 00 00 
+  802b3e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b42:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b49:	ff ff 7f 
+  802b4c:	48 21 c8             	and    %rcx,%rax
+  802b4f:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802b55:	48 01 d0             	add    %rdx,%rax
+  802b58:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802b59:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b60:	7f 00 00 
+  802b63:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b67:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b6e:	ff ff 7f 
+  802b71:	48 21 c8             	and    %rcx,%rax
+  802b74:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802b7a:	48 01 d0             	add    %rdx,%rax
+  802b7d:	c3                   	ret
+
+0000000000802b7e <get_prot>:
+
+int
+get_prot(void *va) {
+  802b7e:	55                   	push   %rbp
+  802b7f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b82:	48 b8 a5 29 80 00 00 	movabs $0x8029a5,%rax
+  802b89:	00 00 00 
+  802b8c:	ff d0                	call   *%rax
+  802b8e:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b91:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b96:	89 c1                	mov    %eax,%ecx
+  802b98:	83 c9 04             	or     $0x4,%ecx
+  802b9b:	f6 c2 01             	test   $0x1,%dl
+  802b9e:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802ba1:	89 c1                	mov    %eax,%ecx
+  802ba3:	83 c9 02             	or     $0x2,%ecx
+  802ba6:	f6 c2 02             	test   $0x2,%dl
+  802ba9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802bac:	89 c1                	mov    %eax,%ecx
+  802bae:	83 c9 01             	or     $0x1,%ecx
+  802bb1:	48 85 d2             	test   %rdx,%rdx
+  802bb4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bb7:	89 c1                	mov    %eax,%ecx
+  802bb9:	83 c9 40             	or     $0x40,%ecx
+  802bbc:	f6 c6 04             	test   $0x4,%dh
+  802bbf:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802bc2:	5d                   	pop    %rbp
+  802bc3:	c3                   	ret
+
+0000000000802bc4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802bc4:	55                   	push   %rbp
+  802bc5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bc8:	48 b8 a5 29 80 00 00 	movabs $0x8029a5,%rax
+  802bcf:	00 00 00 
+  802bd2:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802bd4:	48 c1 e8 06          	shr    $0x6,%rax
+  802bd8:	83 e0 01             	and    $0x1,%eax
+}
+  802bdb:	5d                   	pop    %rbp
+  802bdc:	c3                   	ret
+
+0000000000802bdd <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bdd:	55                   	push   %rbp
+  802bde:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802be1:	48 b8 a5 29 80 00 00 	movabs $0x8029a5,%rax
+  802be8:	00 00 00 
+  802beb:	ff d0                	call   *%rax
+  802bed:	83 e0 01             	and    $0x1,%eax
+}
+  802bf0:	5d                   	pop    %rbp
+  802bf1:	c3                   	ret
+
+0000000000802bf2 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802bf2:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802bf9:	7f 00 00 
+  802bfc:	a8 01                	test   $0x1,%al
+  802bfe:	75 06                	jne    802c06 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c05:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c06:	55                   	push   %rbp
+  802c07:	48 89 e5             	mov    %rsp,%rbp
+  802c0a:	41 57                	push   %r15
+  802c0c:	41 56                	push   %r14
+  802c0e:	41 55                	push   %r13
+  802c10:	41 54                	push   %r12
+  802c12:	53                   	push   %rbx
+  802c13:	48 83 ec 18          	sub    $0x18,%rsp
+  802c17:	49 89 fe             	mov    %rdi,%r14
+  802c1a:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c1d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c24:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c25:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c2c:	7f 00 00 
+  802c2f:	e9 81 00 00 00       	jmp    802cb5 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c34:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c3b:	49 39 dd             	cmp    %rbx,%r13
+  802c3e:	74 2b                	je     802c6b <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c40:	48 89 d8             	mov    %rbx,%rax
+  802c43:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c47:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802c4b:	f6 c2 01             	test   $0x1,%dl
+  802c4e:	74 e4                	je     802c34 <foreach_shared_region+0x42>
+  802c50:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802c54:	f6 c4 04             	test   $0x4,%ah
+  802c57:	74 db                	je     802c34 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802c59:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802c60:	4c 89 fa             	mov    %r15,%rdx
+  802c63:	48 89 df             	mov    %rbx,%rdi
+  802c66:	41 ff d6             	call   *%r14
+  802c69:	eb c9                	jmp    802c34 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802c6b:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802c72:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802c76:	74 22                	je     802c9a <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802c78:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802c7f:	48 89 d8             	mov    %rbx,%rax
+  802c82:	48 c1 e8 15          	shr    $0x15,%rax
+  802c86:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802c8d:	7f 00 00 
+  802c90:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802c94:	a8 01                	test   $0x1,%al
+  802c96:	74 d3                	je     802c6b <foreach_shared_region+0x79>
+  802c98:	eb a6                	jmp    802c40 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c9a:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802ca1:	40 
+  802ca2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802ca6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802cad:	00 00 00 
+  802cb0:	48 39 c1             	cmp    %rax,%rcx
+  802cb3:	74 31                	je     802ce6 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802cb5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cb9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cbd:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802cc4:	7f 00 00 
+  802cc7:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802ccb:	a8 01                	test   $0x1,%al
+  802ccd:	74 cb                	je     802c9a <foreach_shared_region+0xa8>
+  802ccf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cd3:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cda:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802ce0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802ce4:	eb 92                	jmp    802c78 <foreach_shared_region+0x86>
+}
+  802ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ceb:	48 83 c4 18          	add    $0x18,%rsp
+  802cef:	5b                   	pop    %rbx
+  802cf0:	41 5c                	pop    %r12
+  802cf2:	41 5d                	pop    %r13
+  802cf4:	41 5e                	pop    %r14
+  802cf6:	41 5f                	pop    %r15
+  802cf8:	5d                   	pop    %rbp
+  802cf9:	c3                   	ret
+
+0000000000802cfa <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cff:	c3                   	ret
+
+0000000000802d00 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d00:	55                   	push   %rbp
+  802d01:	48 89 e5             	mov    %rsp,%rbp
+  802d04:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d07:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d0e:	00 00 00 
+  802d11:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  802d18:	00 00 00 
+  802d1b:	ff d0                	call   *%rax
+    return 0;
+}
+  802d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d22:	5d                   	pop    %rbp
+  802d23:	c3                   	ret
+
+0000000000802d24 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d24:	55                   	push   %rbp
+  802d25:	48 89 e5             	mov    %rsp,%rbp
+  802d28:	41 57                	push   %r15
+  802d2a:	41 56                	push   %r14
+  802d2c:	41 55                	push   %r13
+  802d2e:	41 54                	push   %r12
+  802d30:	53                   	push   %rbx
+  802d31:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d38:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d3f:	48 85 d2             	test   %rdx,%rdx
+  802d42:	74 7a                	je     802dbe <devcons_write+0x9a>
+  802d44:	49 89 d6             	mov    %rdx,%r14
+  802d47:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d4d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d52:	49 bf 7b 3d 80 00 00 	movabs $0x803d7b,%r15
+  802d59:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d5c:	4c 89 f3             	mov    %r14,%rbx
+  802d5f:	48 29 f3             	sub    %rsi,%rbx
+  802d62:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d67:	48 39 c3             	cmp    %rax,%rbx
+  802d6a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d6e:	4c 63 eb             	movslq %ebx,%r13
+  802d71:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d78:	48 01 c6             	add    %rax,%rsi
+  802d7b:	4c 89 ea             	mov    %r13,%rdx
+  802d7e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d85:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d88:	4c 89 ee             	mov    %r13,%rsi
+  802d8b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d92:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  802d99:	00 00 00 
+  802d9c:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d9e:	41 01 dc             	add    %ebx,%r12d
+  802da1:	49 63 f4             	movslq %r12d,%rsi
+  802da4:	4c 39 f6             	cmp    %r14,%rsi
+  802da7:	72 b3                	jb     802d5c <devcons_write+0x38>
+    return res;
+  802da9:	49 63 c4             	movslq %r12d,%rax
+}
+  802dac:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802db3:	5b                   	pop    %rbx
+  802db4:	41 5c                	pop    %r12
+  802db6:	41 5d                	pop    %r13
+  802db8:	41 5e                	pop    %r14
+  802dba:	41 5f                	pop    %r15
+  802dbc:	5d                   	pop    %rbp
+  802dbd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802dbe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dc4:	eb e3                	jmp    802da9 <devcons_write+0x85>
+
+0000000000802dc6 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dc6:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dce:	48 85 c0             	test   %rax,%rax
+  802dd1:	74 55                	je     802e28 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dd3:	55                   	push   %rbp
+  802dd4:	48 89 e5             	mov    %rsp,%rbp
+  802dd7:	41 55                	push   %r13
+  802dd9:	41 54                	push   %r12
+  802ddb:	53                   	push   %rbx
+  802ddc:	48 83 ec 08          	sub    $0x8,%rsp
+  802de0:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802de3:	48 bb 2a 01 80 00 00 	movabs $0x80012a,%rbx
+  802dea:	00 00 00 
+  802ded:	49 bc f7 01 80 00 00 	movabs $0x8001f7,%r12
+  802df4:	00 00 00 
+  802df7:	eb 03                	jmp    802dfc <devcons_read+0x36>
+  802df9:	41 ff d4             	call   *%r12
+  802dfc:	ff d3                	call   *%rbx
+  802dfe:	85 c0                	test   %eax,%eax
+  802e00:	74 f7                	je     802df9 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e02:	48 63 d0             	movslq %eax,%rdx
+  802e05:	78 13                	js     802e1a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e07:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e0c:	83 f8 04             	cmp    $0x4,%eax
+  802e0f:	74 09                	je     802e1a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e11:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e15:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e1a:	48 89 d0             	mov    %rdx,%rax
+  802e1d:	48 83 c4 08          	add    $0x8,%rsp
+  802e21:	5b                   	pop    %rbx
+  802e22:	41 5c                	pop    %r12
+  802e24:	41 5d                	pop    %r13
+  802e26:	5d                   	pop    %rbp
+  802e27:	c3                   	ret
+  802e28:	48 89 d0             	mov    %rdx,%rax
+  802e2b:	c3                   	ret
+
+0000000000802e2c <cputchar>:
+cputchar(int ch) {
+  802e2c:	55                   	push   %rbp
+  802e2d:	48 89 e5             	mov    %rsp,%rbp
+  802e30:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e34:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e38:	be 01 00 00 00       	mov    $0x1,%esi
+  802e3d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e41:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  802e48:	00 00 00 
+  802e4b:	ff d0                	call   *%rax
+}
+  802e4d:	c9                   	leave
+  802e4e:	c3                   	ret
+
+0000000000802e4f <getchar>:
+getchar(void) {
+  802e4f:	55                   	push   %rbp
+  802e50:	48 89 e5             	mov    %rsp,%rbp
+  802e53:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e57:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e5c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e60:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e65:	48 b8 0d 10 80 00 00 	movabs $0x80100d,%rax
+  802e6c:	00 00 00 
+  802e6f:	ff d0                	call   *%rax
+  802e71:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e73:	85 c0                	test   %eax,%eax
+  802e75:	78 06                	js     802e7d <getchar+0x2e>
+  802e77:	74 08                	je     802e81 <getchar+0x32>
+  802e79:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e7d:	89 d0                	mov    %edx,%eax
+  802e7f:	c9                   	leave
+  802e80:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e81:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e86:	eb f5                	jmp    802e7d <getchar+0x2e>
+
+0000000000802e88 <iscons>:
+iscons(int fdnum) {
+  802e88:	55                   	push   %rbp
+  802e89:	48 89 e5             	mov    %rsp,%rbp
+  802e8c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e90:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e94:	48 b8 2a 0d 80 00 00 	movabs $0x800d2a,%rax
+  802e9b:	00 00 00 
+  802e9e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ea0:	85 c0                	test   %eax,%eax
+  802ea2:	78 18                	js     802ebc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ea4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ea8:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802eaf:	00 00 00 
+  802eb2:	8b 00                	mov    (%rax),%eax
+  802eb4:	39 02                	cmp    %eax,(%rdx)
+  802eb6:	0f 94 c0             	sete   %al
+  802eb9:	0f b6 c0             	movzbl %al,%eax
+}
+  802ebc:	c9                   	leave
+  802ebd:	c3                   	ret
+
+0000000000802ebe <opencons>:
+opencons(void) {
+  802ebe:	55                   	push   %rbp
+  802ebf:	48 89 e5             	mov    %rsp,%rbp
+  802ec2:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ec6:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802eca:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  802ed1:	00 00 00 
+  802ed4:	ff d0                	call   *%rax
+  802ed6:	85 c0                	test   %eax,%eax
+  802ed8:	78 49                	js     802f23 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802eda:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802edf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ee4:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802ee8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eed:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  802ef4:	00 00 00 
+  802ef7:	ff d0                	call   *%rax
+  802ef9:	85 c0                	test   %eax,%eax
+  802efb:	78 26                	js     802f23 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802efd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f01:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802f08:	00 00 
+  802f0a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f0c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f10:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f17:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  802f1e:	00 00 00 
+  802f21:	ff d0                	call   *%rax
+}
+  802f23:	c9                   	leave
+  802f24:	c3                   	ret
+
+0000000000802f25 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f25:	55                   	push   %rbp
+  802f26:	48 89 e5             	mov    %rsp,%rbp
+  802f29:	41 56                	push   %r14
+  802f2b:	41 55                	push   %r13
+  802f2d:	41 54                	push   %r12
+  802f2f:	53                   	push   %rbx
+  802f30:	48 83 ec 50          	sub    $0x50,%rsp
+  802f34:	49 89 fc             	mov    %rdi,%r12
+  802f37:	41 89 f5             	mov    %esi,%r13d
+  802f3a:	48 89 d3             	mov    %rdx,%rbx
+  802f3d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802f41:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802f45:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f49:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802f50:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f54:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f58:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802f5c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f60:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802f67:	00 00 00 
+  802f6a:	4c 8b 30             	mov    (%rax),%r14
+  802f6d:	48 b8 c6 01 80 00 00 	movabs $0x8001c6,%rax
+  802f74:	00 00 00 
+  802f77:	ff d0                	call   *%rax
+  802f79:	89 c6                	mov    %eax,%esi
+  802f7b:	45 89 e8             	mov    %r13d,%r8d
+  802f7e:	4c 89 e1             	mov    %r12,%rcx
+  802f81:	4c 89 f2             	mov    %r14,%rdx
+  802f84:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802f8b:	00 00 00 
+  802f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f93:	49 bc 75 30 80 00 00 	movabs $0x803075,%r12
+  802f9a:	00 00 00 
+  802f9d:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802fa0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802fa4:	48 89 df             	mov    %rbx,%rdi
+  802fa7:	48 b8 11 30 80 00 00 	movabs $0x803011,%rax
+  802fae:	00 00 00 
+  802fb1:	ff d0                	call   *%rax
+    cprintf("\n");
+  802fb3:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  802fba:	00 00 00 
+  802fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc2:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802fc5:	cc                   	int3
+  802fc6:	eb fd                	jmp    802fc5 <_panic+0xa0>
+
+0000000000802fc8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802fc8:	55                   	push   %rbp
+  802fc9:	48 89 e5             	mov    %rsp,%rbp
+  802fcc:	53                   	push   %rbx
+  802fcd:	48 83 ec 08          	sub    $0x8,%rsp
+  802fd1:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802fd4:	8b 06                	mov    (%rsi),%eax
+  802fd6:	8d 50 01             	lea    0x1(%rax),%edx
+  802fd9:	89 16                	mov    %edx,(%rsi)
+  802fdb:	48 98                	cltq
+  802fdd:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802fe2:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802fe8:	74 0a                	je     802ff4 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802fea:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802fee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff2:	c9                   	leave
+  802ff3:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802ff4:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802ff8:	be ff 00 00 00       	mov    $0xff,%esi
+  802ffd:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  803004:	00 00 00 
+  803007:	ff d0                	call   *%rax
+        state->offset = 0;
+  803009:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80300f:	eb d9                	jmp    802fea <putch+0x22>
+
+0000000000803011 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803011:	55                   	push   %rbp
+  803012:	48 89 e5             	mov    %rsp,%rbp
+  803015:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80301c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80301f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803026:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80302b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803030:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803033:	48 89 f1             	mov    %rsi,%rcx
+  803036:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80303d:	48 bf c8 2f 80 00 00 	movabs $0x802fc8,%rdi
+  803044:	00 00 00 
+  803047:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  80304e:	00 00 00 
+  803051:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803053:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80305a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803061:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  803068:	00 00 00 
+  80306b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80306d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  803073:	c9                   	leave
+  803074:	c3                   	ret
+
+0000000000803075 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803075:	55                   	push   %rbp
+  803076:	48 89 e5             	mov    %rsp,%rbp
+  803079:	48 83 ec 50          	sub    $0x50,%rsp
+  80307d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803081:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803085:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803089:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80308d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803091:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803098:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80309c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030a0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030a4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8030a8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8030ac:	48 b8 11 30 80 00 00 	movabs $0x803011,%rax
+  8030b3:	00 00 00 
+  8030b6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8030b8:	c9                   	leave
+  8030b9:	c3                   	ret
+
+00000000008030ba <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8030ba:	55                   	push   %rbp
+  8030bb:	48 89 e5             	mov    %rsp,%rbp
+  8030be:	41 57                	push   %r15
+  8030c0:	41 56                	push   %r14
+  8030c2:	41 55                	push   %r13
+  8030c4:	41 54                	push   %r12
+  8030c6:	53                   	push   %rbx
+  8030c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8030cb:	49 89 fc             	mov    %rdi,%r12
+  8030ce:	49 89 f5             	mov    %rsi,%r13
+  8030d1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8030d5:	8b 45 10             	mov    0x10(%rbp),%eax
+  8030d8:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8030db:	41 89 cf             	mov    %ecx,%r15d
+  8030de:	4c 39 fa             	cmp    %r15,%rdx
+  8030e1:	73 5b                	jae    80313e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8030e3:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8030e7:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8030eb:	85 db                	test   %ebx,%ebx
+  8030ed:	7e 0e                	jle    8030fd <print_num+0x43>
+            putch(padc, put_arg);
+  8030ef:	4c 89 ee             	mov    %r13,%rsi
+  8030f2:	44 89 f7             	mov    %r14d,%edi
+  8030f5:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8030f8:	83 eb 01             	sub    $0x1,%ebx
+  8030fb:	75 f2                	jne    8030ef <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8030fd:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803101:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  803108:	00 00 00 
+  80310b:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  803112:	00 00 00 
+  803115:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803119:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80311d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803122:	49 f7 f7             	div    %r15
+  803125:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803129:	4c 89 ee             	mov    %r13,%rsi
+  80312c:	41 ff d4             	call   *%r12
+}
+  80312f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803133:	5b                   	pop    %rbx
+  803134:	41 5c                	pop    %r12
+  803136:	41 5d                	pop    %r13
+  803138:	41 5e                	pop    %r14
+  80313a:	41 5f                	pop    %r15
+  80313c:	5d                   	pop    %rbp
+  80313d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80313e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803142:	ba 00 00 00 00       	mov    $0x0,%edx
+  803147:	49 f7 f7             	div    %r15
+  80314a:	48 83 ec 08          	sub    $0x8,%rsp
+  80314e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803152:	52                   	push   %rdx
+  803153:	45 0f be c9          	movsbl %r9b,%r9d
+  803157:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80315b:	48 89 c2             	mov    %rax,%rdx
+  80315e:	48 b8 ba 30 80 00 00 	movabs $0x8030ba,%rax
+  803165:	00 00 00 
+  803168:	ff d0                	call   *%rax
+  80316a:	48 83 c4 10          	add    $0x10,%rsp
+  80316e:	eb 8d                	jmp    8030fd <print_num+0x43>
+
+0000000000803170 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803170:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  803174:	48 8b 06             	mov    (%rsi),%rax
+  803177:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80317b:	73 0a                	jae    803187 <sprintputch+0x17>
+        *state->start++ = ch;
+  80317d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803181:	48 89 16             	mov    %rdx,(%rsi)
+  803184:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  803187:	c3                   	ret
+
+0000000000803188 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803188:	55                   	push   %rbp
+  803189:	48 89 e5             	mov    %rsp,%rbp
+  80318c:	48 83 ec 50          	sub    $0x50,%rsp
+  803190:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803194:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803198:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80319c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8031a3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031ab:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031af:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8031b3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8031b7:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  8031be:	00 00 00 
+  8031c1:	ff d0                	call   *%rax
+}
+  8031c3:	c9                   	leave
+  8031c4:	c3                   	ret
+
+00000000008031c5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8031c5:	55                   	push   %rbp
+  8031c6:	48 89 e5             	mov    %rsp,%rbp
+  8031c9:	41 57                	push   %r15
+  8031cb:	41 56                	push   %r14
+  8031cd:	41 55                	push   %r13
+  8031cf:	41 54                	push   %r12
+  8031d1:	53                   	push   %rbx
+  8031d2:	48 83 ec 38          	sub    $0x38,%rsp
+  8031d6:	49 89 fe             	mov    %rdi,%r14
+  8031d9:	49 89 f5             	mov    %rsi,%r13
+  8031dc:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8031df:	48 8b 01             	mov    (%rcx),%rax
+  8031e2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031e6:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8031ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031ee:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8031f2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8031f6:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8031fa:	0f b6 3b             	movzbl (%rbx),%edi
+  8031fd:	40 80 ff 25          	cmp    $0x25,%dil
+  803201:	74 18                	je     80321b <vprintfmt+0x56>
+            if (!ch) return;
+  803203:	40 84 ff             	test   %dil,%dil
+  803206:	0f 84 04 07 00 00    	je     803910 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80320c:	40 0f b6 ff          	movzbl %dil,%edi
+  803210:	4c 89 ee             	mov    %r13,%rsi
+  803213:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803216:	4c 89 e3             	mov    %r12,%rbx
+  803219:	eb db                	jmp    8031f6 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80321b:	be 00 00 00 00       	mov    $0x0,%esi
+  803220:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803224:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803229:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80322f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803236:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80323a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80323f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803244:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803247:	83 e8 23             	sub    $0x23,%eax
+  80324a:	3c 57                	cmp    $0x57,%al
+  80324c:	0f 87 a4 06 00 00    	ja     8038f6 <vprintfmt+0x731>
+  803252:	0f b6 c0             	movzbl %al,%eax
+  803255:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  80325c:	00 00 00 
+  80325f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803262:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803265:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803269:	eb cf                	jmp    80323a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80326b:	49 89 dc             	mov    %rbx,%r12
+  80326e:	be 01 00 00 00       	mov    $0x1,%esi
+  803273:	eb c5                	jmp    80323a <vprintfmt+0x75>
+            padc = ch;
+  803275:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  803279:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80327c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80327f:	eb b9                	jmp    80323a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803281:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803284:	83 f8 2f             	cmp    $0x2f,%eax
+  803287:	77 24                	ja     8032ad <vprintfmt+0xe8>
+  803289:	89 c1                	mov    %eax,%ecx
+  80328b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80328f:	83 c0 08             	add    $0x8,%eax
+  803292:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803295:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  803298:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80329b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80329f:	79 99                	jns    80323a <vprintfmt+0x75>
+                width = precision;
+  8032a1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8032a5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8032ab:	eb 8d                	jmp    80323a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032ad:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032b1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8032b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032b9:	eb da                	jmp    803295 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8032bb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8032c0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032c4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8032ca:	3c 39                	cmp    $0x39,%al
+  8032cc:	77 1c                	ja     8032ea <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8032ce:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8032d2:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8032d6:	0f b6 c0             	movzbl %al,%eax
+  8032d9:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032de:	0f b6 03             	movzbl (%rbx),%eax
+  8032e1:	3c 39                	cmp    $0x39,%al
+  8032e3:	76 e9                	jbe    8032ce <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8032e5:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8032e8:	eb b1                	jmp    80329b <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8032ea:	49 89 dc             	mov    %rbx,%r12
+  8032ed:	eb ac                	jmp    80329b <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8032ef:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8032f2:	85 c9                	test   %ecx,%ecx
+  8032f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f9:	0f 49 c1             	cmovns %ecx,%eax
+  8032fc:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8032ff:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803302:	e9 33 ff ff ff       	jmp    80323a <vprintfmt+0x75>
+            lflag++;
+  803307:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80330a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80330d:	e9 28 ff ff ff       	jmp    80323a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803312:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803315:	83 f8 2f             	cmp    $0x2f,%eax
+  803318:	77 19                	ja     803333 <vprintfmt+0x16e>
+  80331a:	89 c2                	mov    %eax,%edx
+  80331c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803320:	83 c0 08             	add    $0x8,%eax
+  803323:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803326:	8b 3a                	mov    (%rdx),%edi
+  803328:	4c 89 ee             	mov    %r13,%rsi
+  80332b:	41 ff d6             	call   *%r14
+            break;
+  80332e:	e9 c3 fe ff ff       	jmp    8031f6 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803333:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803337:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80333b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80333f:	eb e5                	jmp    803326 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803341:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803344:	83 f8 2f             	cmp    $0x2f,%eax
+  803347:	77 5a                	ja     8033a3 <vprintfmt+0x1de>
+  803349:	89 c2                	mov    %eax,%edx
+  80334b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80334f:	83 c0 08             	add    $0x8,%eax
+  803352:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803355:	8b 02                	mov    (%rdx),%eax
+  803357:	89 c1                	mov    %eax,%ecx
+  803359:	f7 d9                	neg    %ecx
+  80335b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80335e:	83 f9 13             	cmp    $0x13,%ecx
+  803361:	7f 4e                	jg     8033b1 <vprintfmt+0x1ec>
+  803363:	48 63 c1             	movslq %ecx,%rax
+  803366:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  80336d:	00 00 00 
+  803370:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803374:	48 85 c0             	test   %rax,%rax
+  803377:	74 38                	je     8033b1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803379:	48 89 c1             	mov    %rax,%rcx
+  80337c:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  803383:	00 00 00 
+  803386:	4c 89 ee             	mov    %r13,%rsi
+  803389:	4c 89 f7             	mov    %r14,%rdi
+  80338c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803391:	49 b8 88 31 80 00 00 	movabs $0x803188,%r8
+  803398:	00 00 00 
+  80339b:	41 ff d0             	call   *%r8
+  80339e:	e9 53 fe ff ff       	jmp    8031f6 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8033a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033af:	eb a4                	jmp    803355 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8033b1:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  8033b8:	00 00 00 
+  8033bb:	4c 89 ee             	mov    %r13,%rsi
+  8033be:	4c 89 f7             	mov    %r14,%rdi
+  8033c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c6:	49 b8 88 31 80 00 00 	movabs $0x803188,%r8
+  8033cd:	00 00 00 
+  8033d0:	41 ff d0             	call   *%r8
+  8033d3:	e9 1e fe ff ff       	jmp    8031f6 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8033d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033db:	83 f8 2f             	cmp    $0x2f,%eax
+  8033de:	77 36                	ja     803416 <vprintfmt+0x251>
+  8033e0:	89 c2                	mov    %eax,%edx
+  8033e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033e6:	83 c0 08             	add    $0x8,%eax
+  8033e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033ec:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8033ef:	48 85 f6             	test   %rsi,%rsi
+  8033f2:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  8033f9:	00 00 00 
+  8033fc:	48 0f 45 c6          	cmovne %rsi,%rax
+  803400:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803404:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803408:	7e 06                	jle    803410 <vprintfmt+0x24b>
+  80340a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80340e:	75 14                	jne    803424 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803410:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803414:	eb 5b                	jmp    803471 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  803416:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80341a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80341e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803422:	eb c8                	jmp    8033ec <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803424:	49 63 f7             	movslq %r15d,%rsi
+  803427:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80342b:	48 b8 ca 39 80 00 00 	movabs $0x8039ca,%rax
+  803432:	00 00 00 
+  803435:	ff d0                	call   *%rax
+  803437:	48 89 c2             	mov    %rax,%rdx
+  80343a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80343d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80343f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803442:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803445:	85 c0                	test   %eax,%eax
+  803447:	7e c7                	jle    803410 <vprintfmt+0x24b>
+  803449:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80344e:	4c 89 ee             	mov    %r13,%rsi
+  803451:	44 89 e7             	mov    %r12d,%edi
+  803454:	41 ff d6             	call   *%r14
+  803457:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80345b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80345e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803461:	75 eb                	jne    80344e <vprintfmt+0x289>
+  803463:	eb ab                	jmp    803410 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803465:	0f b6 f8             	movzbl %al,%edi
+  803468:	4c 89 ee             	mov    %r13,%rsi
+  80346b:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  80346e:	4c 89 e2             	mov    %r12,%rdx
+  803471:	45 85 ff             	test   %r15d,%r15d
+  803474:	78 06                	js     80347c <vprintfmt+0x2b7>
+  803476:	41 83 ef 01          	sub    $0x1,%r15d
+  80347a:	78 23                	js     80349f <vprintfmt+0x2da>
+  80347c:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  803480:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803486:	84 c0                	test   %al,%al
+  803488:	74 15                	je     80349f <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80348a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80348e:	74 d5                	je     803465 <vprintfmt+0x2a0>
+  803490:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803493:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803498:	80 fa 5e             	cmp    $0x5e,%dl
+  80349b:	77 cb                	ja     803468 <vprintfmt+0x2a3>
+  80349d:	eb c6                	jmp    803465 <vprintfmt+0x2a0>
+  80349f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8034a2:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8034a5:	01 f0                	add    %esi,%eax
+  8034a7:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8034a9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8034ad:	85 c0                	test   %eax,%eax
+  8034af:	0f 8e 41 fd ff ff    	jle    8031f6 <vprintfmt+0x31>
+  8034b5:	4c 89 ee             	mov    %r13,%rsi
+  8034b8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8034bd:	41 ff d6             	call   *%r14
+  8034c0:	41 83 ec 01          	sub    $0x1,%r12d
+  8034c4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8034c8:	75 eb                	jne    8034b5 <vprintfmt+0x2f0>
+  8034ca:	e9 27 fd ff ff       	jmp    8031f6 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8034cf:	40 84 f6             	test   %sil,%sil
+  8034d2:	75 26                	jne    8034fa <vprintfmt+0x335>
+    switch (lflag) {
+  8034d4:	85 d2                	test   %edx,%edx
+  8034d6:	74 59                	je     803531 <vprintfmt+0x36c>
+  8034d8:	83 fa 01             	cmp    $0x1,%edx
+  8034db:	74 7b                	je     803558 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8034dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8034e3:	0f 87 96 00 00 00    	ja     80357f <vprintfmt+0x3ba>
+  8034e9:	89 c2                	mov    %eax,%edx
+  8034eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034ef:	83 c0 08             	add    $0x8,%eax
+  8034f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034f5:	4c 8b 22             	mov    (%rdx),%r12
+  8034f8:	eb 17                	jmp    803511 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8034fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034fd:	83 f8 2f             	cmp    $0x2f,%eax
+  803500:	77 21                	ja     803523 <vprintfmt+0x35e>
+  803502:	89 c2                	mov    %eax,%edx
+  803504:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803508:	83 c0 08             	add    $0x8,%eax
+  80350b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80350e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803511:	4d 85 e4             	test   %r12,%r12
+  803514:	78 7a                	js     803590 <vprintfmt+0x3cb>
+            num = i;
+  803516:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803519:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80351e:	e9 b5 02 00 00       	jmp    8037d8 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803523:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803527:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80352b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80352f:	eb dd                	jmp    80350e <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  803531:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803534:	83 f8 2f             	cmp    $0x2f,%eax
+  803537:	77 11                	ja     80354a <vprintfmt+0x385>
+  803539:	89 c2                	mov    %eax,%edx
+  80353b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80353f:	83 c0 08             	add    $0x8,%eax
+  803542:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803545:	4c 63 22             	movslq (%rdx),%r12
+  803548:	eb c7                	jmp    803511 <vprintfmt+0x34c>
+  80354a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80354e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803552:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803556:	eb ed                	jmp    803545 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  803558:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80355b:	83 f8 2f             	cmp    $0x2f,%eax
+  80355e:	77 11                	ja     803571 <vprintfmt+0x3ac>
+  803560:	89 c2                	mov    %eax,%edx
+  803562:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803566:	83 c0 08             	add    $0x8,%eax
+  803569:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80356c:	4c 8b 22             	mov    (%rdx),%r12
+  80356f:	eb a0                	jmp    803511 <vprintfmt+0x34c>
+  803571:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803575:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803579:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80357d:	eb ed                	jmp    80356c <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  80357f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803583:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803587:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80358b:	e9 65 ff ff ff       	jmp    8034f5 <vprintfmt+0x330>
+                putch('-', put_arg);
+  803590:	4c 89 ee             	mov    %r13,%rsi
+  803593:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803598:	41 ff d6             	call   *%r14
+                i = -i;
+  80359b:	49 f7 dc             	neg    %r12
+  80359e:	e9 73 ff ff ff       	jmp    803516 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8035a3:	40 84 f6             	test   %sil,%sil
+  8035a6:	75 32                	jne    8035da <vprintfmt+0x415>
+    switch (lflag) {
+  8035a8:	85 d2                	test   %edx,%edx
+  8035aa:	74 5d                	je     803609 <vprintfmt+0x444>
+  8035ac:	83 fa 01             	cmp    $0x1,%edx
+  8035af:	0f 84 82 00 00 00    	je     803637 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8035b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8035bb:	0f 87 a5 00 00 00    	ja     803666 <vprintfmt+0x4a1>
+  8035c1:	89 c2                	mov    %eax,%edx
+  8035c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035c7:	83 c0 08             	add    $0x8,%eax
+  8035ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035cd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035d0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8035d5:	e9 fe 01 00 00       	jmp    8037d8 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8035da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8035e0:	77 19                	ja     8035fb <vprintfmt+0x436>
+  8035e2:	89 c2                	mov    %eax,%edx
+  8035e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035e8:	83 c0 08             	add    $0x8,%eax
+  8035eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035ee:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035f1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8035f6:	e9 dd 01 00 00       	jmp    8037d8 <vprintfmt+0x613>
+  8035fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803603:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803607:	eb e5                	jmp    8035ee <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  803609:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80360c:	83 f8 2f             	cmp    $0x2f,%eax
+  80360f:	77 18                	ja     803629 <vprintfmt+0x464>
+  803611:	89 c2                	mov    %eax,%edx
+  803613:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803617:	83 c0 08             	add    $0x8,%eax
+  80361a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80361d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80361f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803624:	e9 af 01 00 00       	jmp    8037d8 <vprintfmt+0x613>
+  803629:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80362d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803631:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803635:	eb e6                	jmp    80361d <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  803637:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80363a:	83 f8 2f             	cmp    $0x2f,%eax
+  80363d:	77 19                	ja     803658 <vprintfmt+0x493>
+  80363f:	89 c2                	mov    %eax,%edx
+  803641:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803645:	83 c0 08             	add    $0x8,%eax
+  803648:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80364b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80364e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803653:	e9 80 01 00 00       	jmp    8037d8 <vprintfmt+0x613>
+  803658:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80365c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803660:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803664:	eb e5                	jmp    80364b <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  803666:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80366a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80366e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803672:	e9 56 ff ff ff       	jmp    8035cd <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  803677:	40 84 f6             	test   %sil,%sil
+  80367a:	75 2e                	jne    8036aa <vprintfmt+0x4e5>
+    switch (lflag) {
+  80367c:	85 d2                	test   %edx,%edx
+  80367e:	0f 84 b3 00 00 00    	je     803737 <vprintfmt+0x572>
+  803684:	83 fa 01             	cmp    $0x1,%edx
+  803687:	0f 84 d3 00 00 00    	je     803760 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  80368d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803690:	83 f8 2f             	cmp    $0x2f,%eax
+  803693:	0f 87 f1 00 00 00    	ja     80378a <vprintfmt+0x5c5>
+  803699:	89 c2                	mov    %eax,%edx
+  80369b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80369f:	83 c0 08             	add    $0x8,%eax
+  8036a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036a5:	48 8b 02             	mov    (%rdx),%rax
+  8036a8:	eb 17                	jmp    8036c1 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8036b0:	77 77                	ja     803729 <vprintfmt+0x564>
+  8036b2:	89 c2                	mov    %eax,%edx
+  8036b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036b8:	83 c0 08             	add    $0x8,%eax
+  8036bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036be:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8036c1:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036c3:	83 f8 07             	cmp    $0x7,%eax
+  8036c6:	0f 8e cf 00 00 00    	jle    80379b <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8036cc:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036d2:	44 89 e7             	mov    %r12d,%edi
+  8036d5:	41 c1 e4 03          	shl    $0x3,%r12d
+  8036d9:	89 d1                	mov    %edx,%ecx
+  8036db:	8d 72 07             	lea    0x7(%rdx),%esi
+  8036de:	85 d2                	test   %edx,%edx
+  8036e0:	0f 48 d6             	cmovs  %esi,%edx
+  8036e3:	c1 fa 03             	sar    $0x3,%edx
+  8036e6:	83 f9 3f             	cmp    $0x3f,%ecx
+  8036e9:	7f e7                	jg     8036d2 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8036eb:	85 ff                	test   %edi,%edi
+  8036ed:	0f 84 03 fb ff ff    	je     8031f6 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8036f3:	49 63 f4             	movslq %r12d,%rsi
+  8036f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036fb:	48 f7 f6             	div    %rsi
+  8036fe:	49 89 d7             	mov    %rdx,%r15
+  803701:	83 c0 30             	add    $0x30,%eax
+  803704:	0f be f8             	movsbl %al,%edi
+  803707:	4c 89 ee             	mov    %r13,%rsi
+  80370a:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80370d:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  803710:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  803715:	45 85 e4             	test   %r12d,%r12d
+  803718:	41 0f 49 d4          	cmovns %r12d,%edx
+  80371c:	c1 fa 03             	sar    $0x3,%edx
+  80371f:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  803722:	75 cf                	jne    8036f3 <vprintfmt+0x52e>
+  803724:	e9 cd fa ff ff       	jmp    8031f6 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  803729:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80372d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803731:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803735:	eb 87                	jmp    8036be <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  803737:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80373a:	83 f8 2f             	cmp    $0x2f,%eax
+  80373d:	77 13                	ja     803752 <vprintfmt+0x58d>
+  80373f:	89 c2                	mov    %eax,%edx
+  803741:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803745:	83 c0 08             	add    $0x8,%eax
+  803748:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80374b:	8b 02                	mov    (%rdx),%eax
+  80374d:	e9 6f ff ff ff       	jmp    8036c1 <vprintfmt+0x4fc>
+  803752:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803756:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80375a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80375e:	eb eb                	jmp    80374b <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  803760:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803763:	83 f8 2f             	cmp    $0x2f,%eax
+  803766:	77 14                	ja     80377c <vprintfmt+0x5b7>
+  803768:	89 c2                	mov    %eax,%edx
+  80376a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80376e:	83 c0 08             	add    $0x8,%eax
+  803771:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803774:	48 8b 02             	mov    (%rdx),%rax
+  803777:	e9 45 ff ff ff       	jmp    8036c1 <vprintfmt+0x4fc>
+  80377c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803780:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803784:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803788:	eb ea                	jmp    803774 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  80378a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80378e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803792:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803796:	e9 0a ff ff ff       	jmp    8036a5 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  80379b:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8037a1:	e9 4d ff ff ff       	jmp    8036f3 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8037a6:	4c 89 ee             	mov    %r13,%rsi
+  8037a9:	bf 30 00 00 00       	mov    $0x30,%edi
+  8037ae:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8037b1:	4c 89 ee             	mov    %r13,%rsi
+  8037b4:	bf 78 00 00 00       	mov    $0x78,%edi
+  8037b9:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8037bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8037c2:	77 47                	ja     80380b <vprintfmt+0x646>
+  8037c4:	89 c2                	mov    %eax,%edx
+  8037c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037ca:	83 c0 08             	add    $0x8,%eax
+  8037cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037d0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8037d3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8037d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8037dc:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8037e0:	0f 94 c0             	sete   %al
+  8037e3:	0f b6 c0             	movzbl %al,%eax
+  8037e6:	50                   	push   %rax
+  8037e7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8037ec:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8037f0:	4c 89 ee             	mov    %r13,%rsi
+  8037f3:	4c 89 f7             	mov    %r14,%rdi
+  8037f6:	48 b8 ba 30 80 00 00 	movabs $0x8030ba,%rax
+  8037fd:	00 00 00 
+  803800:	ff d0                	call   *%rax
+            break;
+  803802:	48 83 c4 10          	add    $0x10,%rsp
+  803806:	e9 eb f9 ff ff       	jmp    8031f6 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80380b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80380f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803813:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803817:	eb b7                	jmp    8037d0 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  803819:	40 84 f6             	test   %sil,%sil
+  80381c:	75 2b                	jne    803849 <vprintfmt+0x684>
+    switch (lflag) {
+  80381e:	85 d2                	test   %edx,%edx
+  803820:	74 56                	je     803878 <vprintfmt+0x6b3>
+  803822:	83 fa 01             	cmp    $0x1,%edx
+  803825:	74 7f                	je     8038a6 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  803827:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80382a:	83 f8 2f             	cmp    $0x2f,%eax
+  80382d:	0f 87 a2 00 00 00    	ja     8038d5 <vprintfmt+0x710>
+  803833:	89 c2                	mov    %eax,%edx
+  803835:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803839:	83 c0 08             	add    $0x8,%eax
+  80383c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80383f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803842:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803847:	eb 8f                	jmp    8037d8 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803849:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80384c:	83 f8 2f             	cmp    $0x2f,%eax
+  80384f:	77 19                	ja     80386a <vprintfmt+0x6a5>
+  803851:	89 c2                	mov    %eax,%edx
+  803853:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803857:	83 c0 08             	add    $0x8,%eax
+  80385a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80385d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803860:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803865:	e9 6e ff ff ff       	jmp    8037d8 <vprintfmt+0x613>
+  80386a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80386e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803872:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803876:	eb e5                	jmp    80385d <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  803878:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80387b:	83 f8 2f             	cmp    $0x2f,%eax
+  80387e:	77 18                	ja     803898 <vprintfmt+0x6d3>
+  803880:	89 c2                	mov    %eax,%edx
+  803882:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803886:	83 c0 08             	add    $0x8,%eax
+  803889:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80388c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80388e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803893:	e9 40 ff ff ff       	jmp    8037d8 <vprintfmt+0x613>
+  803898:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80389c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038a4:	eb e6                	jmp    80388c <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8038a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8038ac:	77 19                	ja     8038c7 <vprintfmt+0x702>
+  8038ae:	89 c2                	mov    %eax,%edx
+  8038b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038b4:	83 c0 08             	add    $0x8,%eax
+  8038b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038ba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038bd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8038c2:	e9 11 ff ff ff       	jmp    8037d8 <vprintfmt+0x613>
+  8038c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038d3:	eb e5                	jmp    8038ba <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  8038d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038e1:	e9 59 ff ff ff       	jmp    80383f <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8038e6:	4c 89 ee             	mov    %r13,%rsi
+  8038e9:	bf 25 00 00 00       	mov    $0x25,%edi
+  8038ee:	41 ff d6             	call   *%r14
+            break;
+  8038f1:	e9 00 f9 ff ff       	jmp    8031f6 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8038f6:	4c 89 ee             	mov    %r13,%rsi
+  8038f9:	bf 25 00 00 00       	mov    $0x25,%edi
+  8038fe:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803901:	48 83 eb 01          	sub    $0x1,%rbx
+  803905:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803909:	75 f6                	jne    803901 <vprintfmt+0x73c>
+  80390b:	e9 e6 f8 ff ff       	jmp    8031f6 <vprintfmt+0x31>
+}
+  803910:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803914:	5b                   	pop    %rbx
+  803915:	41 5c                	pop    %r12
+  803917:	41 5d                	pop    %r13
+  803919:	41 5e                	pop    %r14
+  80391b:	41 5f                	pop    %r15
+  80391d:	5d                   	pop    %rbp
+  80391e:	c3                   	ret
+
+000000000080391f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80391f:	55                   	push   %rbp
+  803920:	48 89 e5             	mov    %rsp,%rbp
+  803923:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803927:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80392b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803930:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803934:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80393b:	48 85 ff             	test   %rdi,%rdi
+  80393e:	74 2b                	je     80396b <vsnprintf+0x4c>
+  803940:	48 85 f6             	test   %rsi,%rsi
+  803943:	74 26                	je     80396b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803945:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803949:	48 bf 70 31 80 00 00 	movabs $0x803170,%rdi
+  803950:	00 00 00 
+  803953:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  80395a:	00 00 00 
+  80395d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80395f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803963:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803966:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803969:	c9                   	leave
+  80396a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80396b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803970:	eb f7                	jmp    803969 <vsnprintf+0x4a>
+
+0000000000803972 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803972:	55                   	push   %rbp
+  803973:	48 89 e5             	mov    %rsp,%rbp
+  803976:	48 83 ec 50          	sub    $0x50,%rsp
+  80397a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80397e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803982:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803986:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80398d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803991:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803995:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803999:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80399d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8039a1:	48 b8 1f 39 80 00 00 	movabs $0x80391f,%rax
+  8039a8:	00 00 00 
+  8039ab:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8039ad:	c9                   	leave
+  8039ae:	c3                   	ret
+
+00000000008039af <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8039af:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8039b2:	74 10                	je     8039c4 <strlen+0x15>
+    size_t n = 0;
+  8039b4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8039b9:	48 83 c0 01          	add    $0x1,%rax
+  8039bd:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8039c1:	75 f6                	jne    8039b9 <strlen+0xa>
+  8039c3:	c3                   	ret
+    size_t n = 0;
+  8039c4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8039c9:	c3                   	ret
+
+00000000008039ca <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8039ca:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8039cd:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8039d2:	48 85 f6             	test   %rsi,%rsi
+  8039d5:	74 11                	je     8039e8 <strnlen+0x1e>
+  8039d7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8039db:	74 0c                	je     8039e9 <strnlen+0x1f>
+  8039dd:	48 83 c2 01          	add    $0x1,%rdx
+  8039e1:	48 39 d0             	cmp    %rdx,%rax
+  8039e4:	75 f1                	jne    8039d7 <strnlen+0xd>
+  8039e6:	eb 04                	jmp    8039ec <strnlen+0x22>
+  8039e8:	c3                   	ret
+  8039e9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8039ec:	c3                   	ret
+
+00000000008039ed <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8039ed:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8039f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039f5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8039f9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8039fc:	48 83 c2 01          	add    $0x1,%rdx
+  803a00:	84 c9                	test   %cl,%cl
+  803a02:	75 f1                	jne    8039f5 <strcpy+0x8>
+        ;
+    return res;
+}
+  803a04:	c3                   	ret
+
+0000000000803a05 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803a05:	55                   	push   %rbp
+  803a06:	48 89 e5             	mov    %rsp,%rbp
+  803a09:	41 54                	push   %r12
+  803a0b:	53                   	push   %rbx
+  803a0c:	48 89 fb             	mov    %rdi,%rbx
+  803a0f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a12:	48 b8 af 39 80 00 00 	movabs $0x8039af,%rax
+  803a19:	00 00 00 
+  803a1c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a1e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a22:	4c 89 e6             	mov    %r12,%rsi
+  803a25:	48 b8 ed 39 80 00 00 	movabs $0x8039ed,%rax
+  803a2c:	00 00 00 
+  803a2f:	ff d0                	call   *%rax
+    return dst;
+}
+  803a31:	48 89 d8             	mov    %rbx,%rax
+  803a34:	5b                   	pop    %rbx
+  803a35:	41 5c                	pop    %r12
+  803a37:	5d                   	pop    %rbp
+  803a38:	c3                   	ret
+
+0000000000803a39 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803a39:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803a3c:	48 85 d2             	test   %rdx,%rdx
+  803a3f:	74 1f                	je     803a60 <strncpy+0x27>
+  803a41:	48 01 fa             	add    %rdi,%rdx
+  803a44:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803a47:	48 83 c1 01          	add    $0x1,%rcx
+  803a4b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803a4f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803a53:	41 80 f8 01          	cmp    $0x1,%r8b
+  803a57:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803a5b:	48 39 ca             	cmp    %rcx,%rdx
+  803a5e:	75 e7                	jne    803a47 <strncpy+0xe>
+    }
+    return ret;
+}
+  803a60:	c3                   	ret
+
+0000000000803a61 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803a61:	48 89 f8             	mov    %rdi,%rax
+  803a64:	48 85 d2             	test   %rdx,%rdx
+  803a67:	74 24                	je     803a8d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803a69:	48 83 ea 01          	sub    $0x1,%rdx
+  803a6d:	74 1b                	je     803a8a <strlcpy+0x29>
+  803a6f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803a73:	0f b6 16             	movzbl (%rsi),%edx
+  803a76:	84 d2                	test   %dl,%dl
+  803a78:	74 10                	je     803a8a <strlcpy+0x29>
+            *dst++ = *src++;
+  803a7a:	48 83 c6 01          	add    $0x1,%rsi
+  803a7e:	48 83 c0 01          	add    $0x1,%rax
+  803a82:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803a85:	48 39 c8             	cmp    %rcx,%rax
+  803a88:	75 e9                	jne    803a73 <strlcpy+0x12>
+        *dst = '\0';
+  803a8a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803a8d:	48 29 f8             	sub    %rdi,%rax
+}
+  803a90:	c3                   	ret
+
+0000000000803a91 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803a91:	0f b6 07             	movzbl (%rdi),%eax
+  803a94:	84 c0                	test   %al,%al
+  803a96:	74 13                	je     803aab <strcmp+0x1a>
+  803a98:	38 06                	cmp    %al,(%rsi)
+  803a9a:	75 0f                	jne    803aab <strcmp+0x1a>
+  803a9c:	48 83 c7 01          	add    $0x1,%rdi
+  803aa0:	48 83 c6 01          	add    $0x1,%rsi
+  803aa4:	0f b6 07             	movzbl (%rdi),%eax
+  803aa7:	84 c0                	test   %al,%al
+  803aa9:	75 ed                	jne    803a98 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803aab:	0f b6 c0             	movzbl %al,%eax
+  803aae:	0f b6 16             	movzbl (%rsi),%edx
+  803ab1:	29 d0                	sub    %edx,%eax
+}
+  803ab3:	c3                   	ret
+
+0000000000803ab4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803ab4:	48 85 d2             	test   %rdx,%rdx
+  803ab7:	74 1f                	je     803ad8 <strncmp+0x24>
+  803ab9:	0f b6 07             	movzbl (%rdi),%eax
+  803abc:	84 c0                	test   %al,%al
+  803abe:	74 1e                	je     803ade <strncmp+0x2a>
+  803ac0:	3a 06                	cmp    (%rsi),%al
+  803ac2:	75 1a                	jne    803ade <strncmp+0x2a>
+  803ac4:	48 83 c7 01          	add    $0x1,%rdi
+  803ac8:	48 83 c6 01          	add    $0x1,%rsi
+  803acc:	48 83 ea 01          	sub    $0x1,%rdx
+  803ad0:	75 e7                	jne    803ab9 <strncmp+0x5>
+
+    if (!n) return 0;
+  803ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad7:	c3                   	ret
+  803ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803add:	c3                   	ret
+  803ade:	48 85 d2             	test   %rdx,%rdx
+  803ae1:	74 09                	je     803aec <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ae3:	0f b6 07             	movzbl (%rdi),%eax
+  803ae6:	0f b6 16             	movzbl (%rsi),%edx
+  803ae9:	29 d0                	sub    %edx,%eax
+  803aeb:	c3                   	ret
+    if (!n) return 0;
+  803aec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803af1:	c3                   	ret
+
+0000000000803af2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803af2:	0f b6 17             	movzbl (%rdi),%edx
+  803af5:	84 d2                	test   %dl,%dl
+  803af7:	74 18                	je     803b11 <strchr+0x1f>
+        if (*str == c) {
+  803af9:	0f be d2             	movsbl %dl,%edx
+  803afc:	39 f2                	cmp    %esi,%edx
+  803afe:	74 17                	je     803b17 <strchr+0x25>
+    for (; *str; str++) {
+  803b00:	48 83 c7 01          	add    $0x1,%rdi
+  803b04:	0f b6 17             	movzbl (%rdi),%edx
+  803b07:	84 d2                	test   %dl,%dl
+  803b09:	75 ee                	jne    803af9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b10:	c3                   	ret
+  803b11:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b16:	c3                   	ret
+  803b17:	48 89 f8             	mov    %rdi,%rax
+}
+  803b1a:	c3                   	ret
+
+0000000000803b1b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b1b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b1e:	0f b6 17             	movzbl (%rdi),%edx
+  803b21:	84 d2                	test   %dl,%dl
+  803b23:	74 13                	je     803b38 <strfind+0x1d>
+  803b25:	0f be d2             	movsbl %dl,%edx
+  803b28:	39 f2                	cmp    %esi,%edx
+  803b2a:	74 0b                	je     803b37 <strfind+0x1c>
+  803b2c:	48 83 c0 01          	add    $0x1,%rax
+  803b30:	0f b6 10             	movzbl (%rax),%edx
+  803b33:	84 d2                	test   %dl,%dl
+  803b35:	75 ee                	jne    803b25 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803b37:	c3                   	ret
+  803b38:	c3                   	ret
+
+0000000000803b39 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803b39:	55                   	push   %rbp
+  803b3a:	48 89 e5             	mov    %rsp,%rbp
+  803b3d:	41 57                	push   %r15
+  803b3f:	41 56                	push   %r14
+  803b41:	41 55                	push   %r13
+  803b43:	41 54                	push   %r12
+  803b45:	53                   	push   %rbx
+  803b46:	48 83 ec 08          	sub    $0x8,%rsp
+  803b4a:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803b4d:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803b51:	45 84 ed             	test   %r13b,%r13b
+  803b54:	75 12                	jne    803b68 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803b56:	4c 89 f8             	mov    %r15,%rax
+  803b59:	48 83 c4 08          	add    $0x8,%rsp
+  803b5d:	5b                   	pop    %rbx
+  803b5e:	41 5c                	pop    %r12
+  803b60:	41 5d                	pop    %r13
+  803b62:	41 5e                	pop    %r14
+  803b64:	41 5f                	pop    %r15
+  803b66:	5d                   	pop    %rbp
+  803b67:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803b68:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803b6c:	4c 89 e7             	mov    %r12,%rdi
+  803b6f:	48 b8 af 39 80 00 00 	movabs $0x8039af,%rax
+  803b76:	00 00 00 
+  803b79:	ff d0                	call   *%rax
+  803b7b:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803b7e:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803b82:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803b86:	49 bf b4 3a 80 00 00 	movabs $0x803ab4,%r15
+  803b8d:	00 00 00 
+				if ((sc = *s++) == 0)
+  803b90:	84 c0                	test   %al,%al
+  803b92:	75 14                	jne    803ba8 <strstr+0x6f>
+					return NULL;
+  803b94:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803b9a:	eb ba                	jmp    803b56 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803b9c:	48 83 c3 01          	add    $0x1,%rbx
+  803ba0:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803ba4:	84 c0                	test   %al,%al
+  803ba6:	74 1b                	je     803bc3 <strstr+0x8a>
+			} while (sc != c);
+  803ba8:	41 38 c5             	cmp    %al,%r13b
+  803bab:	75 ef                	jne    803b9c <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803bad:	4c 89 f2             	mov    %r14,%rdx
+  803bb0:	4c 89 e6             	mov    %r12,%rsi
+  803bb3:	48 89 df             	mov    %rbx,%rdi
+  803bb6:	41 ff d7             	call   *%r15
+  803bb9:	85 c0                	test   %eax,%eax
+  803bbb:	75 df                	jne    803b9c <strstr+0x63>
+  803bbd:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803bc1:	eb 93                	jmp    803b56 <strstr+0x1d>
+					return NULL;
+  803bc3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bc9:	eb 8b                	jmp    803b56 <strstr+0x1d>
+
+0000000000803bcb <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803bcb:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803bcd:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803bd0:	8d 57 20             	lea    0x20(%rdi),%edx
+  803bd3:	83 f9 1a             	cmp    $0x1a,%ecx
+  803bd6:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803bd9:	c3                   	ret
+
+0000000000803bda <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803bda:	55                   	push   %rbp
+  803bdb:	48 89 e5             	mov    %rsp,%rbp
+  803bde:	41 57                	push   %r15
+  803be0:	41 56                	push   %r14
+  803be2:	41 55                	push   %r13
+  803be4:	41 54                	push   %r12
+  803be6:	53                   	push   %rbx
+  803be7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803beb:	48 39 f7             	cmp    %rsi,%rdi
+  803bee:	74 49                	je     803c39 <strcasecmp+0x5f>
+  803bf0:	49 89 fd             	mov    %rdi,%r13
+  803bf3:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803bf6:	49 bf cb 3b 80 00 00 	movabs $0x803bcb,%r15
+  803bfd:	00 00 00 
+  803c00:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803c05:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c09:	41 ff d7             	call   *%r15
+  803c0c:	89 c3                	mov    %eax,%ebx
+  803c0e:	49 83 c4 01          	add    $0x1,%r12
+  803c12:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c18:	41 ff d7             	call   *%r15
+  803c1b:	29 c3                	sub    %eax,%ebx
+  803c1d:	75 09                	jne    803c28 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c1f:	49 83 c5 01          	add    $0x1,%r13
+  803c23:	45 84 f6             	test   %r14b,%r14b
+  803c26:	75 d8                	jne    803c00 <strcasecmp+0x26>
+}
+  803c28:	89 d8                	mov    %ebx,%eax
+  803c2a:	48 83 c4 08          	add    $0x8,%rsp
+  803c2e:	5b                   	pop    %rbx
+  803c2f:	41 5c                	pop    %r12
+  803c31:	41 5d                	pop    %r13
+  803c33:	41 5e                	pop    %r14
+  803c35:	41 5f                	pop    %r15
+  803c37:	5d                   	pop    %rbp
+  803c38:	c3                   	ret
+        return 0;
+  803c39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c3e:	eb e8                	jmp    803c28 <strcasecmp+0x4e>
+
+0000000000803c40 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c40:	55                   	push   %rbp
+  803c41:	48 89 e5             	mov    %rsp,%rbp
+  803c44:	41 57                	push   %r15
+  803c46:	41 56                	push   %r14
+  803c48:	41 55                	push   %r13
+  803c4a:	41 54                	push   %r12
+  803c4c:	53                   	push   %rbx
+  803c4d:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803c51:	48 85 d2             	test   %rdx,%rdx
+  803c54:	74 4f                	je     803ca5 <strncasecmp+0x65>
+  803c56:	49 89 fc             	mov    %rdi,%r12
+  803c59:	49 89 f5             	mov    %rsi,%r13
+  803c5c:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803c60:	49 be cb 3b 80 00 00 	movabs $0x803bcb,%r14
+  803c67:	00 00 00 
+  803c6a:	49 83 c4 01          	add    $0x1,%r12
+  803c6e:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c74:	41 ff d6             	call   *%r14
+  803c77:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803c79:	49 83 c5 01          	add    $0x1,%r13
+  803c7d:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803c82:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803c85:	29 c3                	sub    %eax,%ebx
+  803c87:	85 c0                	test   %eax,%eax
+  803c89:	74 09                	je     803c94 <strncasecmp+0x54>
+  803c8b:	85 db                	test   %ebx,%ebx
+  803c8d:	75 05                	jne    803c94 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803c8f:	4d 39 fc             	cmp    %r15,%r12
+  803c92:	75 d6                	jne    803c6a <strncasecmp+0x2a>
+}
+  803c94:	89 d8                	mov    %ebx,%eax
+  803c96:	48 83 c4 08          	add    $0x8,%rsp
+  803c9a:	5b                   	pop    %rbx
+  803c9b:	41 5c                	pop    %r12
+  803c9d:	41 5d                	pop    %r13
+  803c9f:	41 5e                	pop    %r14
+  803ca1:	41 5f                	pop    %r15
+  803ca3:	5d                   	pop    %rbp
+  803ca4:	c3                   	ret
+    int d = 0;
+  803ca5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803caa:	eb e8                	jmp    803c94 <strncasecmp+0x54>
+
+0000000000803cac <toupper>:
+
+int toupper(int c) {
+  803cac:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803cae:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803cb1:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803cb4:	83 f9 1a             	cmp    $0x1a,%ecx
+  803cb7:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803cba:	c3                   	ret
+
+0000000000803cbb <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803cbb:	83 ff 20             	cmp    $0x20,%edi
+  803cbe:	0f 94 c0             	sete   %al
+  803cc1:	0f b6 c0             	movzbl %al,%eax
+}
+  803cc4:	c3                   	ret
+
+0000000000803cc5 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803cc5:	89 f8                	mov    %edi,%eax
+  803cc7:	f7 d8                	neg    %eax
+  803cc9:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803ccc:	c3                   	ret
+
+0000000000803ccd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803ccd:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803cd0:	48 89 f8             	mov    %rdi,%rax
+  803cd3:	48 f7 d8             	neg    %rax
+  803cd6:	83 e0 07             	and    $0x7,%eax
+  803cd9:	49 89 d1             	mov    %rdx,%r9
+  803cdc:	49 29 c1             	sub    %rax,%r9
+  803cdf:	78 36                	js     803d17 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803ce1:	40 0f b6 c6          	movzbl %sil,%eax
+  803ce5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803cec:	01 01 01 
+  803cef:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803cf3:	40 f6 c7 07          	test   $0x7,%dil
+  803cf7:	75 38                	jne    803d31 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803cf9:	4c 89 c9             	mov    %r9,%rcx
+  803cfc:	48 c1 f9 03          	sar    $0x3,%rcx
+  803d00:	74 0c                	je     803d0e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803d02:	fc                   	cld
+  803d03:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803d06:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d0a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d0e:	4d 85 c9             	test   %r9,%r9
+  803d11:	75 45                	jne    803d58 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d13:	4c 89 c0             	mov    %r8,%rax
+  803d16:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d17:	48 85 d2             	test   %rdx,%rdx
+  803d1a:	74 f7                	je     803d13 <memset+0x46>
+  803d1c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d1f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d22:	48 83 c0 01          	add    $0x1,%rax
+  803d26:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d2a:	48 39 c2             	cmp    %rax,%rdx
+  803d2d:	75 f3                	jne    803d22 <memset+0x55>
+  803d2f:	eb e2                	jmp    803d13 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d31:	40 f6 c7 01          	test   $0x1,%dil
+  803d35:	74 06                	je     803d3d <memset+0x70>
+  803d37:	88 07                	mov    %al,(%rdi)
+  803d39:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d3d:	40 f6 c7 02          	test   $0x2,%dil
+  803d41:	74 07                	je     803d4a <memset+0x7d>
+  803d43:	66 89 07             	mov    %ax,(%rdi)
+  803d46:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d4a:	40 f6 c7 04          	test   $0x4,%dil
+  803d4e:	74 a9                	je     803cf9 <memset+0x2c>
+  803d50:	89 07                	mov    %eax,(%rdi)
+  803d52:	48 83 c7 04          	add    $0x4,%rdi
+  803d56:	eb a1                	jmp    803cf9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d58:	41 f6 c1 04          	test   $0x4,%r9b
+  803d5c:	74 06                	je     803d64 <memset+0x97>
+  803d5e:	89 07                	mov    %eax,(%rdi)
+  803d60:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d64:	41 f6 c1 02          	test   $0x2,%r9b
+  803d68:	74 07                	je     803d71 <memset+0xa4>
+  803d6a:	66 89 07             	mov    %ax,(%rdi)
+  803d6d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803d71:	41 f6 c1 01          	test   $0x1,%r9b
+  803d75:	74 9c                	je     803d13 <memset+0x46>
+  803d77:	88 07                	mov    %al,(%rdi)
+  803d79:	eb 98                	jmp    803d13 <memset+0x46>
+
+0000000000803d7b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803d7b:	48 89 f8             	mov    %rdi,%rax
+  803d7e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803d81:	48 39 fe             	cmp    %rdi,%rsi
+  803d84:	73 3b                	jae    803dc1 <memmove+0x46>
+  803d86:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803d8a:	48 39 d7             	cmp    %rdx,%rdi
+  803d8d:	73 32                	jae    803dc1 <memmove+0x46>
+        s += n;
+        d += n;
+  803d8f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803d93:	48 89 d6             	mov    %rdx,%rsi
+  803d96:	48 09 fe             	or     %rdi,%rsi
+  803d99:	48 09 ce             	or     %rcx,%rsi
+  803d9c:	40 f6 c6 07          	test   $0x7,%sil
+  803da0:	75 12                	jne    803db4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803da2:	48 83 ef 08          	sub    $0x8,%rdi
+  803da6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803daa:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dae:	fd                   	std
+  803daf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803db2:	fc                   	cld
+  803db3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803db4:	48 83 ef 01          	sub    $0x1,%rdi
+  803db8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803dbc:	fd                   	std
+  803dbd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803dbf:	eb f1                	jmp    803db2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803dc1:	48 89 f2             	mov    %rsi,%rdx
+  803dc4:	48 09 c2             	or     %rax,%rdx
+  803dc7:	48 09 ca             	or     %rcx,%rdx
+  803dca:	f6 c2 07             	test   $0x7,%dl
+  803dcd:	75 0c                	jne    803ddb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803dcf:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dd3:	48 89 c7             	mov    %rax,%rdi
+  803dd6:	fc                   	cld
+  803dd7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803dda:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803ddb:	48 89 c7             	mov    %rax,%rdi
+  803dde:	fc                   	cld
+  803ddf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803de1:	c3                   	ret
+
+0000000000803de2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803de2:	55                   	push   %rbp
+  803de3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803de6:	48 b8 7b 3d 80 00 00 	movabs $0x803d7b,%rax
+  803ded:	00 00 00 
+  803df0:	ff d0                	call   *%rax
+}
+  803df2:	5d                   	pop    %rbp
+  803df3:	c3                   	ret
+
+0000000000803df4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803df4:	55                   	push   %rbp
+  803df5:	48 89 e5             	mov    %rsp,%rbp
+  803df8:	41 57                	push   %r15
+  803dfa:	41 56                	push   %r14
+  803dfc:	41 55                	push   %r13
+  803dfe:	41 54                	push   %r12
+  803e00:	53                   	push   %rbx
+  803e01:	48 83 ec 08          	sub    $0x8,%rsp
+  803e05:	49 89 fe             	mov    %rdi,%r14
+  803e08:	49 89 f7             	mov    %rsi,%r15
+  803e0b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e0e:	48 89 f7             	mov    %rsi,%rdi
+  803e11:	48 b8 af 39 80 00 00 	movabs $0x8039af,%rax
+  803e18:	00 00 00 
+  803e1b:	ff d0                	call   *%rax
+  803e1d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e20:	48 89 de             	mov    %rbx,%rsi
+  803e23:	4c 89 f7             	mov    %r14,%rdi
+  803e26:	48 b8 ca 39 80 00 00 	movabs $0x8039ca,%rax
+  803e2d:	00 00 00 
+  803e30:	ff d0                	call   *%rax
+  803e32:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e35:	48 39 c3             	cmp    %rax,%rbx
+  803e38:	74 36                	je     803e70 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e3a:	48 89 d8             	mov    %rbx,%rax
+  803e3d:	4c 29 e8             	sub    %r13,%rax
+  803e40:	49 39 c4             	cmp    %rax,%r12
+  803e43:	73 31                	jae    803e76 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803e45:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803e4a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e4e:	4c 89 fe             	mov    %r15,%rsi
+  803e51:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  803e58:	00 00 00 
+  803e5b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803e5d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803e61:	48 83 c4 08          	add    $0x8,%rsp
+  803e65:	5b                   	pop    %rbx
+  803e66:	41 5c                	pop    %r12
+  803e68:	41 5d                	pop    %r13
+  803e6a:	41 5e                	pop    %r14
+  803e6c:	41 5f                	pop    %r15
+  803e6e:	5d                   	pop    %rbp
+  803e6f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e70:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803e74:	eb eb                	jmp    803e61 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803e76:	48 83 eb 01          	sub    $0x1,%rbx
+  803e7a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e7e:	48 89 da             	mov    %rbx,%rdx
+  803e81:	4c 89 fe             	mov    %r15,%rsi
+  803e84:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  803e8b:	00 00 00 
+  803e8e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803e90:	49 01 de             	add    %rbx,%r14
+  803e93:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803e98:	eb c3                	jmp    803e5d <strlcat+0x69>
+
+0000000000803e9a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803e9a:	48 85 d2             	test   %rdx,%rdx
+  803e9d:	74 2d                	je     803ecc <memcmp+0x32>
+  803e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803ea4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803ea8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803ead:	44 38 c1             	cmp    %r8b,%cl
+  803eb0:	75 0f                	jne    803ec1 <memcmp+0x27>
+    while (n-- > 0) {
+  803eb2:	48 83 c0 01          	add    $0x1,%rax
+  803eb6:	48 39 c2             	cmp    %rax,%rdx
+  803eb9:	75 e9                	jne    803ea4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803ec1:	0f b6 c1             	movzbl %cl,%eax
+  803ec4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803ec8:	44 29 c0             	sub    %r8d,%eax
+  803ecb:	c3                   	ret
+    return 0;
+  803ecc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed1:	c3                   	ret
+
+0000000000803ed2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803ed2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803ed6:	48 39 c7             	cmp    %rax,%rdi
+  803ed9:	73 0f                	jae    803eea <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803edb:	40 38 37             	cmp    %sil,(%rdi)
+  803ede:	74 0e                	je     803eee <memfind+0x1c>
+    for (; src < end; src++) {
+  803ee0:	48 83 c7 01          	add    $0x1,%rdi
+  803ee4:	48 39 f8             	cmp    %rdi,%rax
+  803ee7:	75 f2                	jne    803edb <memfind+0x9>
+  803ee9:	c3                   	ret
+  803eea:	48 89 f8             	mov    %rdi,%rax
+  803eed:	c3                   	ret
+  803eee:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803ef1:	c3                   	ret
+
+0000000000803ef2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803ef2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803ef5:	0f b6 37             	movzbl (%rdi),%esi
+  803ef8:	40 80 fe 20          	cmp    $0x20,%sil
+  803efc:	74 06                	je     803f04 <strtol+0x12>
+  803efe:	40 80 fe 09          	cmp    $0x9,%sil
+  803f02:	75 13                	jne    803f17 <strtol+0x25>
+  803f04:	48 83 c7 01          	add    $0x1,%rdi
+  803f08:	0f b6 37             	movzbl (%rdi),%esi
+  803f0b:	40 80 fe 20          	cmp    $0x20,%sil
+  803f0f:	74 f3                	je     803f04 <strtol+0x12>
+  803f11:	40 80 fe 09          	cmp    $0x9,%sil
+  803f15:	74 ed                	je     803f04 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f17:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f1a:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f1d:	3c 01                	cmp    $0x1,%al
+  803f1f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f23:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f29:	75 0f                	jne    803f3a <strtol+0x48>
+  803f2b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f2e:	74 14                	je     803f44 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f30:	85 d2                	test   %edx,%edx
+  803f32:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f37:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803f3f:	4c 63 ca             	movslq %edx,%r9
+  803f42:	eb 36                	jmp    803f7a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f44:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803f48:	74 0f                	je     803f59 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803f4a:	85 d2                	test   %edx,%edx
+  803f4c:	75 ec                	jne    803f3a <strtol+0x48>
+        s++;
+  803f4e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803f52:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803f57:	eb e1                	jmp    803f3a <strtol+0x48>
+        s += 2;
+  803f59:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803f5d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803f62:	eb d6                	jmp    803f3a <strtol+0x48>
+            dig -= '0';
+  803f64:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803f67:	44 0f b6 c1          	movzbl %cl,%r8d
+  803f6b:	41 39 d0             	cmp    %edx,%r8d
+  803f6e:	7d 21                	jge    803f91 <strtol+0x9f>
+        val = val * base + dig;
+  803f70:	49 0f af c1          	imul   %r9,%rax
+  803f74:	0f b6 c9             	movzbl %cl,%ecx
+  803f77:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803f7a:	48 83 c7 01          	add    $0x1,%rdi
+  803f7e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803f82:	80 f9 39             	cmp    $0x39,%cl
+  803f85:	76 dd                	jbe    803f64 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803f87:	80 f9 7b             	cmp    $0x7b,%cl
+  803f8a:	77 05                	ja     803f91 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803f8c:	83 e9 57             	sub    $0x57,%ecx
+  803f8f:	eb d6                	jmp    803f67 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803f91:	4d 85 d2             	test   %r10,%r10
+  803f94:	74 03                	je     803f99 <strtol+0xa7>
+  803f96:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803f99:	48 89 c2             	mov    %rax,%rdx
+  803f9c:	48 f7 da             	neg    %rdx
+  803f9f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803fa3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803fa7:	c3                   	ret
+
+0000000000803fa8 <atoi>:
+int atoi(const char *str) {
+  803fa8:	55                   	push   %rbp
+  803fa9:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  803fac:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fb1:	be 00 00 00 00       	mov    $0x0,%esi
+  803fb6:	48 b8 f2 3e 80 00 00 	movabs $0x803ef2,%rax
+  803fbd:	00 00 00 
+  803fc0:	ff d0                	call   *%rax
+}
+  803fc2:	5d                   	pop    %rbp
+  803fc3:	c3                   	ret
+
+0000000000803fc4 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fc4:	55                   	push   %rbp
+  803fc5:	48 89 e5             	mov    %rsp,%rbp
+  803fc8:	41 55                	push   %r13
+  803fca:	41 54                	push   %r12
+  803fcc:	53                   	push   %rbx
+  803fcd:	48 83 ec 08          	sub    $0x8,%rsp
+  803fd1:	49 89 fc             	mov    %rdi,%r12
+  803fd4:	48 89 f7             	mov    %rsi,%rdi
+  803fd7:	48 89 d3             	mov    %rdx,%rbx
+  803fda:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803fdd:	48 85 f6             	test   %rsi,%rsi
+  803fe0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fe7:	00 00 00 
+  803fea:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  803fee:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ff3:	48 85 d2             	test   %rdx,%rdx
+  803ff6:	74 03                	je     803ffb <ipc_recv+0x37>
+  803ff8:	48 8b 32             	mov    (%rdx),%rsi
+  803ffb:	48 b8 33 06 80 00 00 	movabs $0x800633,%rax
+  804002:	00 00 00 
+  804005:	ff d0                	call   *%rax
+    if (errno) {
+  804007:	85 c0                	test   %eax,%eax
+  804009:	74 1c                	je     804027 <ipc_recv+0x63>
+        if (from_env_store)
+  80400b:	4d 85 e4             	test   %r12,%r12
+  80400e:	74 08                	je     804018 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804010:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804017:	00 
+
+        if (perm_store)
+  804018:	4d 85 ed             	test   %r13,%r13
+  80401b:	74 74                	je     804091 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80401d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804024:	00 
+  804025:	eb 6a                	jmp    804091 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804027:	4d 85 e4             	test   %r12,%r12
+  80402a:	74 14                	je     804040 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80402c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804033:	00 00 00 
+  804036:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80403c:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804040:	48 85 db             	test   %rbx,%rbx
+  804043:	74 23                	je     804068 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804045:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80404c:	00 00 00 
+  80404f:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804055:	ba 00 00 00 00       	mov    $0x0,%edx
+  80405a:	85 c9                	test   %ecx,%ecx
+  80405c:	74 07                	je     804065 <ipc_recv+0xa1>
+  80405e:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804065:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804068:	4d 85 ed             	test   %r13,%r13
+  80406b:	74 14                	je     804081 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80406d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804074:	00 00 00 
+  804077:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80407d:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804081:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804088:	00 00 00 
+  80408b:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804091:	48 83 c4 08          	add    $0x8,%rsp
+  804095:	5b                   	pop    %rbx
+  804096:	41 5c                	pop    %r12
+  804098:	41 5d                	pop    %r13
+  80409a:	5d                   	pop    %rbp
+  80409b:	c3                   	ret
+
+000000000080409c <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+  8040a0:	41 55                	push   %r13
+  8040a2:	41 54                	push   %r12
+  8040a4:	53                   	push   %rbx
+  8040a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8040a9:	49 89 fc             	mov    %rdi,%r12
+  8040ac:	48 89 f7             	mov    %rsi,%rdi
+  8040af:	48 89 d3             	mov    %rdx,%rbx
+  8040b2:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040b5:	48 85 f6             	test   %rsi,%rsi
+  8040b8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040bf:	00 00 00 
+  8040c2:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040c6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040cb:	48 85 d2             	test   %rdx,%rdx
+  8040ce:	74 03                	je     8040d3 <ipc_try_recv+0x37>
+  8040d0:	48 8b 32             	mov    (%rdx),%rsi
+  8040d3:	48 b8 9c 06 80 00 00 	movabs $0x80069c,%rax
+  8040da:	00 00 00 
+  8040dd:	ff d0                	call   *%rax
+    if (errno) {
+  8040df:	85 c0                	test   %eax,%eax
+  8040e1:	75 75                	jne    804158 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8040e3:	4d 85 e4             	test   %r12,%r12
+  8040e6:	74 14                	je     8040fc <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8040e8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040ef:	00 00 00 
+  8040f2:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8040f8:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8040fc:	48 85 db             	test   %rbx,%rbx
+  8040ff:	74 23                	je     804124 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804101:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804108:	00 00 00 
+  80410b:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804111:	ba 00 00 00 00       	mov    $0x0,%edx
+  804116:	85 c9                	test   %ecx,%ecx
+  804118:	74 07                	je     804121 <ipc_try_recv+0x85>
+  80411a:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804121:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804124:	4d 85 ed             	test   %r13,%r13
+  804127:	74 14                	je     80413d <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804129:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804130:	00 00 00 
+  804133:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804139:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80413d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804144:	00 00 00 
+  804147:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80414d:	48 83 c4 08          	add    $0x8,%rsp
+  804151:	5b                   	pop    %rbx
+  804152:	41 5c                	pop    %r12
+  804154:	41 5d                	pop    %r13
+  804156:	5d                   	pop    %rbp
+  804157:	c3                   	ret
+        if (from_env_store)
+  804158:	4d 85 e4             	test   %r12,%r12
+  80415b:	74 08                	je     804165 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80415d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804164:	00 
+        if (perm_store)
+  804165:	4d 85 ed             	test   %r13,%r13
+  804168:	74 e3                	je     80414d <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80416a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804171:	00 
+  804172:	eb d9                	jmp    80414d <ipc_try_recv+0xb1>
+
+0000000000804174 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804174:	55                   	push   %rbp
+  804175:	48 89 e5             	mov    %rsp,%rbp
+  804178:	41 57                	push   %r15
+  80417a:	41 56                	push   %r14
+  80417c:	41 55                	push   %r13
+  80417e:	41 54                	push   %r12
+  804180:	53                   	push   %rbx
+  804181:	48 83 ec 18          	sub    $0x18,%rsp
+  804185:	41 89 fd             	mov    %edi,%r13d
+  804188:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80418b:	48 89 d3             	mov    %rdx,%rbx
+  80418e:	49 89 cc             	mov    %rcx,%r12
+  804191:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804195:	48 85 d2             	test   %rdx,%rdx
+  804198:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80419f:	00 00 00 
+  8041a2:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041a6:	49 be 07 06 80 00 00 	movabs $0x800607,%r14
+  8041ad:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041b0:	49 bf f7 01 80 00 00 	movabs $0x8001f7,%r15
+  8041b7:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041ba:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041bd:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041c1:	4c 89 e1             	mov    %r12,%rcx
+  8041c4:	48 89 da             	mov    %rbx,%rdx
+  8041c7:	44 89 ef             	mov    %r13d,%edi
+  8041ca:	41 ff d6             	call   *%r14
+  8041cd:	85 c0                	test   %eax,%eax
+  8041cf:	74 37                	je     804208 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041d1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041d4:	75 05                	jne    8041db <ipc_send+0x67>
+        sys_yield();
+  8041d6:	41 ff d7             	call   *%r15
+  8041d9:	eb df                	jmp    8041ba <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041db:	89 c1                	mov    %eax,%ecx
+  8041dd:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  8041e4:	00 00 00 
+  8041e7:	be 65 00 00 00       	mov    $0x65,%esi
+  8041ec:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  8041f3:	00 00 00 
+  8041f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041fb:	49 b8 25 2f 80 00 00 	movabs $0x802f25,%r8
+  804202:	00 00 00 
+  804205:	41 ff d0             	call   *%r8
+    }
+}
+  804208:	48 83 c4 18          	add    $0x18,%rsp
+  80420c:	5b                   	pop    %rbx
+  80420d:	41 5c                	pop    %r12
+  80420f:	41 5d                	pop    %r13
+  804211:	41 5e                	pop    %r14
+  804213:	41 5f                	pop    %r15
+  804215:	5d                   	pop    %rbp
+  804216:	c3                   	ret
+
+0000000000804217 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804217:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80421c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804223:	00 00 00 
+  804226:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80422d:	48 01 ca             	add    %rcx,%rdx
+  804230:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804236:	39 fa                	cmp    %edi,%edx
+  804238:	74 12                	je     80424c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80423a:	48 83 c0 01          	add    $0x1,%rax
+  80423e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804244:	75 e0                	jne    804226 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804246:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80424b:	c3                   	ret
+            return envs[i].env_id;
+  80424c:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804253:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80425a:	00 00 00 
+  80425d:	48 01 d0             	add    %rdx,%rax
+  804260:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804266:	c3                   	ret
+
+0000000000804267 <__text_end>:
+  804267:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80426e:	00 00 00 
+  804271:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804278:	00 00 00 
+  80427b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804282:	00 00 00 
+  804285:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428c:	00 00 00 
+  80428f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804296:	00 00 00 
+  804299:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a0:	00 00 00 
+  8042a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042aa:	00 00 00 
+  8042ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b4:	00 00 00 
+  8042b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042be:	00 00 00 
+  8042c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c8:	00 00 00 
+  8042cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d2:	00 00 00 
+  8042d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042dc:	00 00 00 
+  8042df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e6:	00 00 00 
+  8042e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f0:	00 00 00 
+  8042f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fa:	00 00 00 
+  8042fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804304:	00 00 00 
+  804307:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430e:	00 00 00 
+  804311:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804318:	00 00 00 
+  80431b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804322:	00 00 00 
+  804325:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432c:	00 00 00 
+  80432f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804336:	00 00 00 
+  804339:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804340:	00 00 00 
+  804343:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434a:	00 00 00 
+  80434d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804354:	00 00 00 
+  804357:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435e:	00 00 00 
+  804361:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804368:	00 00 00 
+  80436b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804372:	00 00 00 
+  804375:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437c:	00 00 00 
+  80437f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804386:	00 00 00 
+  804389:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804390:	00 00 00 
+  804393:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439a:	00 00 00 
+  80439d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a4:	00 00 00 
+  8043a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ae:	00 00 00 
+  8043b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b8:	00 00 00 
+  8043bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c2:	00 00 00 
+  8043c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cc:	00 00 00 
+  8043cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d6:	00 00 00 
+  8043d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e0:	00 00 00 
+  8043e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ea:	00 00 00 
+  8043ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f4:	00 00 00 
+  8043f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fe:	00 00 00 
+  804401:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804408:	00 00 00 
+  80440b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804412:	00 00 00 
+  804415:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441c:	00 00 00 
+  80441f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804426:	00 00 00 
+  804429:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804430:	00 00 00 
+  804433:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443a:	00 00 00 
+  80443d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804444:	00 00 00 
+  804447:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444e:	00 00 00 
+  804451:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804458:	00 00 00 
+  80445b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804462:	00 00 00 
+  804465:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446c:	00 00 00 
+  80446f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804476:	00 00 00 
+  804479:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804480:	00 00 00 
+  804483:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448a:	00 00 00 
+  80448d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804494:	00 00 00 
+  804497:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449e:	00 00 00 
+  8044a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a8:	00 00 00 
+  8044ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b2:	00 00 00 
+  8044b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bc:	00 00 00 
+  8044bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c6:	00 00 00 
+  8044c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d0:	00 00 00 
+  8044d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044da:	00 00 00 
+  8044dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e4:	00 00 00 
+  8044e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ee:	00 00 00 
+  8044f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f8:	00 00 00 
+  8044fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804502:	00 00 00 
+  804505:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450c:	00 00 00 
+  80450f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804516:	00 00 00 
+  804519:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804520:	00 00 00 
+  804523:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452a:	00 00 00 
+  80452d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804534:	00 00 00 
+  804537:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453e:	00 00 00 
+  804541:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804548:	00 00 00 
+  80454b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804552:	00 00 00 
+  804555:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455c:	00 00 00 
+  80455f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804566:	00 00 00 
+  804569:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804570:	00 00 00 
+  804573:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457a:	00 00 00 
+  80457d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804584:	00 00 00 
+  804587:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458e:	00 00 00 
+  804591:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804598:	00 00 00 
+  80459b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a2:	00 00 00 
+  8045a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ac:	00 00 00 
+  8045af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b6:	00 00 00 
+  8045b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c0:	00 00 00 
+  8045c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ca:	00 00 00 
+  8045cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d4:	00 00 00 
+  8045d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045de:	00 00 00 
+  8045e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e8:	00 00 00 
+  8045eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f2:	00 00 00 
+  8045f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fc:	00 00 00 
+  8045ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804606:	00 00 00 
+  804609:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804610:	00 00 00 
+  804613:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461a:	00 00 00 
+  80461d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804624:	00 00 00 
+  804627:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462e:	00 00 00 
+  804631:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804638:	00 00 00 
+  80463b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804642:	00 00 00 
+  804645:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464c:	00 00 00 
+  80464f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804656:	00 00 00 
+  804659:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804660:	00 00 00 
+  804663:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466a:	00 00 00 
+  80466d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804674:	00 00 00 
+  804677:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467e:	00 00 00 
+  804681:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804688:	00 00 00 
+  80468b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804692:	00 00 00 
+  804695:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469c:	00 00 00 
+  80469f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a6:	00 00 00 
+  8046a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b0:	00 00 00 
+  8046b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ba:	00 00 00 
+  8046bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c4:	00 00 00 
+  8046c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ce:	00 00 00 
+  8046d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d8:	00 00 00 
+  8046db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e2:	00 00 00 
+  8046e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ec:	00 00 00 
+  8046ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f6:	00 00 00 
+  8046f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804700:	00 00 00 
+  804703:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470a:	00 00 00 
+  80470d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804714:	00 00 00 
+  804717:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471e:	00 00 00 
+  804721:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804728:	00 00 00 
+  80472b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804732:	00 00 00 
+  804735:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473c:	00 00 00 
+  80473f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804746:	00 00 00 
+  804749:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804750:	00 00 00 
+  804753:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475a:	00 00 00 
+  80475d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804764:	00 00 00 
+  804767:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476e:	00 00 00 
+  804771:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804778:	00 00 00 
+  80477b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804782:	00 00 00 
+  804785:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478c:	00 00 00 
+  80478f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804796:	00 00 00 
+  804799:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a0:	00 00 00 
+  8047a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047aa:	00 00 00 
+  8047ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b4:	00 00 00 
+  8047b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047be:	00 00 00 
+  8047c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c8:	00 00 00 
+  8047cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d2:	00 00 00 
+  8047d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dc:	00 00 00 
+  8047df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e6:	00 00 00 
+  8047e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f0:	00 00 00 
+  8047f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fa:	00 00 00 
+  8047fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804804:	00 00 00 
+  804807:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480e:	00 00 00 
+  804811:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804818:	00 00 00 
+  80481b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804822:	00 00 00 
+  804825:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482c:	00 00 00 
+  80482f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804836:	00 00 00 
+  804839:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804840:	00 00 00 
+  804843:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484a:	00 00 00 
+  80484d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804854:	00 00 00 
+  804857:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485e:	00 00 00 
+  804861:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804868:	00 00 00 
+  80486b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804872:	00 00 00 
+  804875:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487c:	00 00 00 
+  80487f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804886:	00 00 00 
+  804889:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804890:	00 00 00 
+  804893:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489a:	00 00 00 
+  80489d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a4:	00 00 00 
+  8048a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ae:	00 00 00 
+  8048b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b8:	00 00 00 
+  8048bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c2:	00 00 00 
+  8048c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cc:	00 00 00 
+  8048cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d6:	00 00 00 
+  8048d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e0:	00 00 00 
+  8048e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ea:	00 00 00 
+  8048ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f4:	00 00 00 
+  8048f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fe:	00 00 00 
+  804901:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804908:	00 00 00 
+  80490b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804912:	00 00 00 
+  804915:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491c:	00 00 00 
+  80491f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804926:	00 00 00 
+  804929:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804930:	00 00 00 
+  804933:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493a:	00 00 00 
+  80493d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804944:	00 00 00 
+  804947:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494e:	00 00 00 
+  804951:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804958:	00 00 00 
+  80495b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804962:	00 00 00 
+  804965:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496c:	00 00 00 
+  80496f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804976:	00 00 00 
+  804979:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804980:	00 00 00 
+  804983:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498a:	00 00 00 
+  80498d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804994:	00 00 00 
+  804997:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499e:	00 00 00 
+  8049a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a8:	00 00 00 
+  8049ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b2:	00 00 00 
+  8049b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bc:	00 00 00 
+  8049bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c6:	00 00 00 
+  8049c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d0:	00 00 00 
+  8049d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049da:	00 00 00 
+  8049dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e4:	00 00 00 
+  8049e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ee:	00 00 00 
+  8049f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f8:	00 00 00 
+  8049fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a02:	00 00 00 
+  804a05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0c:	00 00 00 
+  804a0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a16:	00 00 00 
+  804a19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a20:	00 00 00 
+  804a23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2a:	00 00 00 
+  804a2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a34:	00 00 00 
+  804a37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3e:	00 00 00 
+  804a41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a48:	00 00 00 
+  804a4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a52:	00 00 00 
+  804a55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5c:	00 00 00 
+  804a5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a66:	00 00 00 
+  804a69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a70:	00 00 00 
+  804a73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7a:	00 00 00 
+  804a7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a84:	00 00 00 
+  804a87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8e:	00 00 00 
+  804a91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a98:	00 00 00 
+  804a9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa2:	00 00 00 
+  804aa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aac:	00 00 00 
+  804aaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab6:	00 00 00 
+  804ab9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac0:	00 00 00 
+  804ac3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aca:	00 00 00 
+  804acd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad4:	00 00 00 
+  804ad7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ade:	00 00 00 
+  804ae1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae8:	00 00 00 
+  804aeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af2:	00 00 00 
+  804af5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afc:	00 00 00 
+  804aff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b06:	00 00 00 
+  804b09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b10:	00 00 00 
+  804b13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1a:	00 00 00 
+  804b1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b24:	00 00 00 
+  804b27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2e:	00 00 00 
+  804b31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b38:	00 00 00 
+  804b3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b42:	00 00 00 
+  804b45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4c:	00 00 00 
+  804b4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b56:	00 00 00 
+  804b59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b60:	00 00 00 
+  804b63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6a:	00 00 00 
+  804b6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b74:	00 00 00 
+  804b77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7e:	00 00 00 
+  804b81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b88:	00 00 00 
+  804b8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b92:	00 00 00 
+  804b95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9c:	00 00 00 
+  804b9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba6:	00 00 00 
+  804ba9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb0:	00 00 00 
+  804bb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bba:	00 00 00 
+  804bbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc4:	00 00 00 
+  804bc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bce:	00 00 00 
+  804bd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd8:	00 00 00 
+  804bdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be2:	00 00 00 
+  804be5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bec:	00 00 00 
+  804bef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf6:	00 00 00 
+  804bf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c00:	00 00 00 
+  804c03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0a:	00 00 00 
+  804c0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c14:	00 00 00 
+  804c17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1e:	00 00 00 
+  804c21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c28:	00 00 00 
+  804c2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c32:	00 00 00 
+  804c35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3c:	00 00 00 
+  804c3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c46:	00 00 00 
+  804c49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c50:	00 00 00 
+  804c53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5a:	00 00 00 
+  804c5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c64:	00 00 00 
+  804c67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6e:	00 00 00 
+  804c71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c78:	00 00 00 
+  804c7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c82:	00 00 00 
+  804c85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8c:	00 00 00 
+  804c8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c96:	00 00 00 
+  804c99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca0:	00 00 00 
+  804ca3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caa:	00 00 00 
+  804cad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb4:	00 00 00 
+  804cb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbe:	00 00 00 
+  804cc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc8:	00 00 00 
+  804ccb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd2:	00 00 00 
+  804cd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdc:	00 00 00 
+  804cdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce6:	00 00 00 
+  804ce9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf0:	00 00 00 
+  804cf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfa:	00 00 00 
+  804cfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d04:	00 00 00 
+  804d07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0e:	00 00 00 
+  804d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d18:	00 00 00 
+  804d1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d22:	00 00 00 
+  804d25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2c:	00 00 00 
+  804d2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d36:	00 00 00 
+  804d39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d40:	00 00 00 
+  804d43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4a:	00 00 00 
+  804d4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d54:	00 00 00 
+  804d57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5e:	00 00 00 
+  804d61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d68:	00 00 00 
+  804d6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d72:	00 00 00 
+  804d75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7c:	00 00 00 
+  804d7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d86:	00 00 00 
+  804d89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d90:	00 00 00 
+  804d93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9a:	00 00 00 
+  804d9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da4:	00 00 00 
+  804da7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dae:	00 00 00 
+  804db1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db8:	00 00 00 
+  804dbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc2:	00 00 00 
+  804dc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcc:	00 00 00 
+  804dcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd6:	00 00 00 
+  804dd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de0:	00 00 00 
+  804de3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dea:	00 00 00 
+  804ded:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df4:	00 00 00 
+  804df7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfe:	00 00 00 
+  804e01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e08:	00 00 00 
+  804e0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e12:	00 00 00 
+  804e15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1c:	00 00 00 
+  804e1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e26:	00 00 00 
+  804e29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e30:	00 00 00 
+  804e33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3a:	00 00 00 
+  804e3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e44:	00 00 00 
+  804e47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4e:	00 00 00 
+  804e51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e58:	00 00 00 
+  804e5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e62:	00 00 00 
+  804e65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6c:	00 00 00 
+  804e6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e76:	00 00 00 
+  804e79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e80:	00 00 00 
+  804e83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8a:	00 00 00 
+  804e8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e94:	00 00 00 
+  804e97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9e:	00 00 00 
+  804ea1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea8:	00 00 00 
+  804eab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb2:	00 00 00 
+  804eb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebc:	00 00 00 
+  804ebf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec6:	00 00 00 
+  804ec9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed0:	00 00 00 
+  804ed3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eda:	00 00 00 
+  804edd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee4:	00 00 00 
+  804ee7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eee:	00 00 00 
+  804ef1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef8:	00 00 00 
+  804efb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f02:	00 00 00 
+  804f05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0c:	00 00 00 
+  804f0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f16:	00 00 00 
+  804f19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f20:	00 00 00 
+  804f23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2a:	00 00 00 
+  804f2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f34:	00 00 00 
+  804f37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3e:	00 00 00 
+  804f41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f48:	00 00 00 
+  804f4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f52:	00 00 00 
+  804f55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5c:	00 00 00 
+  804f5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f66:	00 00 00 
+  804f69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f70:	00 00 00 
+  804f73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7a:	00 00 00 
+  804f7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f84:	00 00 00 
+  804f87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8e:	00 00 00 
+  804f91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f98:	00 00 00 
+  804f9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa2:	00 00 00 
+  804fa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fac:	00 00 00 
+  804faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb6:	00 00 00 
+  804fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc0:	00 00 00 
+  804fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fca:	00 00 00 
+  804fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd4:	00 00 00 
+  804fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fde:	00 00 00 
+  804fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe8:	00 00 00 
+  804feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff2:	00 00 00 
+  804ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffc:	00 00 00 
+  804fff:	90                   	nop
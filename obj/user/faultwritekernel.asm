@@ -0,0 +1,8094 @@
+
+obj/user/faultwritekernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 00 00 00       	call   800036 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    *(volatile unsigned *)0x8040000000 = 0;
+  800025:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80002c:	00 00 00 
+  80002f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800035:	c3                   	ret
+
+0000000000800036 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800036:	55                   	push   %rbp
+  800037:	48 89 e5             	mov    %rsp,%rbp
+  80003a:	41 56                	push   %r14
+  80003c:	41 55                	push   %r13
+  80003e:	41 54                	push   %r12
+  800040:	53                   	push   %rbx
+  800041:	41 89 fd             	mov    %edi,%r13d
+  800044:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800047:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80004e:	00 00 00 
+  800051:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800058:	00 00 00 
+  80005b:	48 39 c2             	cmp    %rax,%rdx
+  80005e:	73 17                	jae    800077 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800060:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800063:	49 89 c4             	mov    %rax,%r12
+  800066:	48 83 c3 08          	add    $0x8,%rbx
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006f:	ff 53 f8             	call   *-0x8(%rbx)
+  800072:	4c 39 e3             	cmp    %r12,%rbx
+  800075:	72 ef                	jb     800066 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800077:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  80007e:	00 00 00 
+  800081:	ff d0                	call   *%rax
+  800083:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800088:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80008f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800096:	00 00 00 
+  800099:	48 01 d0             	add    %rdx,%rax
+  80009c:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000a3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000a6:	45 85 ed             	test   %r13d,%r13d
+  8000a9:	7e 0d                	jle    8000b8 <libmain+0x82>
+  8000ab:	49 8b 06             	mov    (%r14),%rax
+  8000ae:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000b5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b8:	4c 89 f6             	mov    %r14,%rsi
+  8000bb:	44 89 ef             	mov    %r13d,%edi
+  8000be:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000c5:	00 00 00 
+  8000c8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000ca:	48 b8 df 00 80 00 00 	movabs $0x8000df,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+#endif
+}
+  8000d6:	5b                   	pop    %rbx
+  8000d7:	41 5c                	pop    %r12
+  8000d9:	41 5d                	pop    %r13
+  8000db:	41 5e                	pop    %r14
+  8000dd:	5d                   	pop    %rbp
+  8000de:	c3                   	ret
+
+00000000008000df <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000df:	55                   	push   %rbp
+  8000e0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000e3:	48 b8 c7 0e 80 00 00 	movabs $0x800ec7,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f4:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  8000fb:	00 00 00 
+  8000fe:	ff d0                	call   *%rax
+}
+  800100:	5d                   	pop    %rbp
+  800101:	c3                   	ret
+
+0000000000800102 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800102:	55                   	push   %rbp
+  800103:	48 89 e5             	mov    %rsp,%rbp
+  800106:	53                   	push   %rbx
+  800107:	48 89 fa             	mov    %rdi,%rdx
+  80010a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80010d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800112:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800117:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80011c:	be 00 00 00 00       	mov    $0x0,%esi
+  800121:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800127:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800129:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80012d:	c9                   	leave
+  80012e:	c3                   	ret
+
+000000000080012f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+  800133:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800134:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800143:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800148:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80014d:	be 00 00 00 00       	mov    $0x0,%esi
+  800152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800158:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80015a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80015e:	c9                   	leave
+  80015f:	c3                   	ret
+
+0000000000800160 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800160:	55                   	push   %rbp
+  800161:	48 89 e5             	mov    %rsp,%rbp
+  800164:	53                   	push   %rbx
+  800165:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800169:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80016c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800171:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800176:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80017b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800180:	be 00 00 00 00       	mov    $0x0,%esi
+  800185:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80018b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80018d:	48 85 c0             	test   %rax,%rax
+  800190:	7f 06                	jg     800198 <sys_env_destroy+0x38>
+}
+  800192:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800196:	c9                   	leave
+  800197:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800198:	49 89 c0             	mov    %rax,%r8
+  80019b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001a0:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8001a7:	00 00 00 
+  8001aa:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001af:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8001b6:	00 00 00 
+  8001b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001be:	49 b9 2a 2f 80 00 00 	movabs $0x802f2a,%r9
+  8001c5:	00 00 00 
+  8001c8:	41 ff d1             	call   *%r9
+
+00000000008001cb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+  8001cf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001d0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001da:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001f4:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001fa:	c9                   	leave
+  8001fb:	c3                   	ret
+
+00000000008001fc <sys_yield>:
+
+void
+sys_yield(void) {
+  8001fc:	55                   	push   %rbp
+  8001fd:	48 89 e5             	mov    %rsp,%rbp
+  800200:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800201:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800206:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800215:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80021a:	be 00 00 00 00       	mov    $0x0,%esi
+  80021f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800225:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800227:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80022b:	c9                   	leave
+  80022c:	c3                   	ret
+
+000000000080022d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80022d:	55                   	push   %rbp
+  80022e:	48 89 e5             	mov    %rsp,%rbp
+  800231:	53                   	push   %rbx
+  800232:	48 89 fa             	mov    %rdi,%rdx
+  800235:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800238:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80023d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800244:	00 00 00 
+  800247:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80024c:	be 00 00 00 00       	mov    $0x0,%esi
+  800251:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800257:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800259:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80025d:	c9                   	leave
+  80025e:	c3                   	ret
+
+000000000080025f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80025f:	55                   	push   %rbp
+  800260:	48 89 e5             	mov    %rsp,%rbp
+  800263:	53                   	push   %rbx
+  800264:	49 89 f8             	mov    %rdi,%r8
+  800267:	48 89 d3             	mov    %rdx,%rbx
+  80026a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80026d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800272:	4c 89 c2             	mov    %r8,%rdx
+  800275:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800278:	be 00 00 00 00       	mov    $0x0,%esi
+  80027d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800283:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800285:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800289:	c9                   	leave
+  80028a:	c3                   	ret
+
+000000000080028b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80028b:	55                   	push   %rbp
+  80028c:	48 89 e5             	mov    %rsp,%rbp
+  80028f:	53                   	push   %rbx
+  800290:	48 83 ec 08          	sub    $0x8,%rsp
+  800294:	89 f8                	mov    %edi,%eax
+  800296:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800299:	48 63 f9             	movslq %ecx,%rdi
+  80029c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80029f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002a4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002b4:	48 85 c0             	test   %rax,%rax
+  8002b7:	7f 06                	jg     8002bf <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002bd:	c9                   	leave
+  8002be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002bf:	49 89 c0             	mov    %rax,%r8
+  8002c2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002c7:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8002ce:	00 00 00 
+  8002d1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002d6:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	49 b9 2a 2f 80 00 00 	movabs $0x802f2a,%r9
+  8002ec:	00 00 00 
+  8002ef:	41 ff d1             	call   *%r9
+
+00000000008002f2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002f2:	55                   	push   %rbp
+  8002f3:	48 89 e5             	mov    %rsp,%rbp
+  8002f6:	53                   	push   %rbx
+  8002f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8002fb:	89 f8                	mov    %edi,%eax
+  8002fd:	49 89 f2             	mov    %rsi,%r10
+  800300:	48 89 cf             	mov    %rcx,%rdi
+  800303:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800306:	48 63 da             	movslq %edx,%rbx
+  800309:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80030c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800311:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800314:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800317:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800319:	48 85 c0             	test   %rax,%rax
+  80031c:	7f 06                	jg     800324 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80031e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800324:	49 89 c0             	mov    %rax,%r8
+  800327:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80032c:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800333:	00 00 00 
+  800336:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80033b:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800342:	00 00 00 
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	49 b9 2a 2f 80 00 00 	movabs $0x802f2a,%r9
+  800351:	00 00 00 
+  800354:	41 ff d1             	call   *%r9
+
+0000000000800357 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800357:	55                   	push   %rbp
+  800358:	48 89 e5             	mov    %rsp,%rbp
+  80035b:	53                   	push   %rbx
+  80035c:	48 83 ec 08          	sub    $0x8,%rsp
+  800360:	49 89 f9             	mov    %rdi,%r9
+  800363:	89 f0                	mov    %esi,%eax
+  800365:	48 89 d3             	mov    %rdx,%rbx
+  800368:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80036b:	49 63 f0             	movslq %r8d,%rsi
+  80036e:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800371:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800376:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800379:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80037f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800381:	48 85 c0             	test   %rax,%rax
+  800384:	7f 06                	jg     80038c <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800386:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80038a:	c9                   	leave
+  80038b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80038c:	49 89 c0             	mov    %rax,%r8
+  80038f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800394:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80039b:	00 00 00 
+  80039e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8003a3:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8003aa:	00 00 00 
+  8003ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b2:	49 b9 2a 2f 80 00 00 	movabs $0x802f2a,%r9
+  8003b9:	00 00 00 
+  8003bc:	41 ff d1             	call   *%r9
+
+00000000008003bf <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003bf:	55                   	push   %rbp
+  8003c0:	48 89 e5             	mov    %rsp,%rbp
+  8003c3:	53                   	push   %rbx
+  8003c4:	89 f8                	mov    %edi,%eax
+  8003c6:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8003c9:	48 63 f9             	movslq %ecx,%rdi
+  8003cc:	48 63 da             	movslq %edx,%rbx
+  8003cf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003d2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003d7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003da:	be 00 00 00 00       	mov    $0x0,%esi
+  8003df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003e5:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8003e7:	89 c2                	mov    %eax,%edx
+  8003e9:	48 85 c0             	test   %rax,%rax
+  8003ec:	78 0d                	js     8003fb <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8003ee:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8003f3:	4d 85 c9             	test   %r9,%r9
+  8003f6:	74 03                	je     8003fb <sys_alloc_dma_region+0x3c>
+  8003f8:	49 89 01             	mov    %rax,(%r9)
+}
+  8003fb:	89 d0                	mov    %edx,%eax
+  8003fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800401:	c9                   	leave
+  800402:	c3                   	ret
+
+0000000000800403 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  800403:	55                   	push   %rbp
+  800404:	48 89 e5             	mov    %rsp,%rbp
+  800407:	53                   	push   %rbx
+  800408:	48 83 ec 08          	sub    $0x8,%rsp
+  80040c:	48 89 f1             	mov    %rsi,%rcx
+  80040f:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800412:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800415:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80041a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80041f:	be 00 00 00 00       	mov    $0x0,%esi
+  800424:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80042a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80042c:	48 85 c0             	test   %rax,%rax
+  80042f:	7f 06                	jg     800437 <sys_set_cache_region+0x34>
+}
+  800431:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800435:	c9                   	leave
+  800436:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800437:	49 89 c0             	mov    %rax,%r8
+  80043a:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80043f:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800446:	00 00 00 
+  800449:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80044e:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800455:	00 00 00 
+  800458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045d:	49 b9 2a 2f 80 00 00 	movabs $0x802f2a,%r9
+  800464:	00 00 00 
+  800467:	41 ff d1             	call   *%r9
+
+000000000080046a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80046a:	55                   	push   %rbp
+  80046b:	48 89 e5             	mov    %rsp,%rbp
+  80046e:	53                   	push   %rbx
+  80046f:	48 83 ec 08          	sub    $0x8,%rsp
+  800473:	48 89 f1             	mov    %rsi,%rcx
+  800476:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800479:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80047c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800481:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800486:	be 00 00 00 00       	mov    $0x0,%esi
+  80048b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800491:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800493:	48 85 c0             	test   %rax,%rax
+  800496:	7f 06                	jg     80049e <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800498:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80049c:	c9                   	leave
+  80049d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80049e:	49 89 c0             	mov    %rax,%r8
+  8004a1:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004a6:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8004ad:	00 00 00 
+  8004b0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004b5:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8004bc:	00 00 00 
+  8004bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c4:	49 b9 2a 2f 80 00 00 	movabs $0x802f2a,%r9
+  8004cb:	00 00 00 
+  8004ce:	41 ff d1             	call   *%r9
+
+00000000008004d1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004d1:	55                   	push   %rbp
+  8004d2:	48 89 e5             	mov    %rsp,%rbp
+  8004d5:	53                   	push   %rbx
+  8004d6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004da:	48 63 ce             	movslq %esi,%rcx
+  8004dd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004fc:	48 85 c0             	test   %rax,%rax
+  8004ff:	7f 06                	jg     800507 <sys_env_set_status+0x36>
+}
+  800501:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800505:	c9                   	leave
+  800506:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800507:	49 89 c0             	mov    %rax,%r8
+  80050a:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80050f:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800516:	00 00 00 
+  800519:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80051e:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800525:	00 00 00 
+  800528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052d:	49 b9 2a 2f 80 00 00 	movabs $0x802f2a,%r9
+  800534:	00 00 00 
+  800537:	41 ff d1             	call   *%r9
+
+000000000080053a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80053a:	55                   	push   %rbp
+  80053b:	48 89 e5             	mov    %rsp,%rbp
+  80053e:	53                   	push   %rbx
+  80053f:	48 83 ec 08          	sub    $0x8,%rsp
+  800543:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800546:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800549:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80054e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800553:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800558:	be 00 00 00 00       	mov    $0x0,%esi
+  80055d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800563:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800565:	48 85 c0             	test   %rax,%rax
+  800568:	7f 06                	jg     800570 <sys_env_set_trapframe+0x36>
+}
+  80056a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80056e:	c9                   	leave
+  80056f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800570:	49 89 c0             	mov    %rax,%r8
+  800573:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800578:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80057f:	00 00 00 
+  800582:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800587:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80058e:	00 00 00 
+  800591:	b8 00 00 00 00       	mov    $0x0,%eax
+  800596:	49 b9 2a 2f 80 00 00 	movabs $0x802f2a,%r9
+  80059d:	00 00 00 
+  8005a0:	41 ff d1             	call   *%r9
+
+00000000008005a3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005a3:	55                   	push   %rbp
+  8005a4:	48 89 e5             	mov    %rsp,%rbp
+  8005a7:	53                   	push   %rbx
+  8005a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005ac:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005b2:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005ce:	48 85 c0             	test   %rax,%rax
+  8005d1:	7f 06                	jg     8005d9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8005d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005d7:	c9                   	leave
+  8005d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005d9:	49 89 c0             	mov    %rax,%r8
+  8005dc:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005e1:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8005e8:	00 00 00 
+  8005eb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8005f0:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8005f7:	00 00 00 
+  8005fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ff:	49 b9 2a 2f 80 00 00 	movabs $0x802f2a,%r9
+  800606:	00 00 00 
+  800609:	41 ff d1             	call   *%r9
+
+000000000080060c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80060c:	55                   	push   %rbp
+  80060d:	48 89 e5             	mov    %rsp,%rbp
+  800610:	53                   	push   %rbx
+  800611:	89 f8                	mov    %edi,%eax
+  800613:	49 89 f1             	mov    %rsi,%r9
+  800616:	48 89 d3             	mov    %rdx,%rbx
+  800619:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80061c:	49 63 f0             	movslq %r8d,%rsi
+  80061f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800622:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800627:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80062a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800630:	cd 30                	int    $0x30
+}
+  800632:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800636:	c9                   	leave
+  800637:	c3                   	ret
+
+0000000000800638 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800638:	55                   	push   %rbp
+  800639:	48 89 e5             	mov    %rsp,%rbp
+  80063c:	53                   	push   %rbx
+  80063d:	48 83 ec 08          	sub    $0x8,%rsp
+  800641:	48 89 fa             	mov    %rdi,%rdx
+  800644:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800647:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80064c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800651:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800656:	be 00 00 00 00       	mov    $0x0,%esi
+  80065b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800661:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800663:	48 85 c0             	test   %rax,%rax
+  800666:	7f 06                	jg     80066e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800668:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80066c:	c9                   	leave
+  80066d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80066e:	49 89 c0             	mov    %rax,%r8
+  800671:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800676:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80067d:	00 00 00 
+  800680:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800685:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80068c:	00 00 00 
+  80068f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800694:	49 b9 2a 2f 80 00 00 	movabs $0x802f2a,%r9
+  80069b:	00 00 00 
+  80069e:	41 ff d1             	call   *%r9
+
+00000000008006a1 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8006a1:	55                   	push   %rbp
+  8006a2:	48 89 e5             	mov    %rsp,%rbp
+  8006a5:	53                   	push   %rbx
+  8006a6:	48 89 fa             	mov    %rdi,%rdx
+  8006a9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006ac:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8006c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006c6:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006cc:	c9                   	leave
+  8006cd:	c3                   	ret
+
+00000000008006ce <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006ce:	55                   	push   %rbp
+  8006cf:	48 89 e5             	mov    %rsp,%rbp
+  8006d2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006d3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8006f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006f7:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8006f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006fd:	c9                   	leave
+  8006fe:	c3                   	ret
+
+00000000008006ff <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8006ff:	48 85 ff             	test   %rdi,%rdi
+  800702:	0f 84 b6 01 00 00    	je     8008be <malloc+0x1bf>
+malloc(size_t size) {
+  800708:	55                   	push   %rbp
+  800709:	48 89 e5             	mov    %rsp,%rbp
+  80070c:	41 56                	push   %r14
+  80070e:	41 55                	push   %r13
+  800710:	41 54                	push   %r12
+  800712:	53                   	push   %rbx
+  800713:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800716:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80071d:	00 00 00 
+  800720:	4c 8b 20             	mov    (%rax),%r12
+  800723:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80072a:	0f 87 94 01 00 00    	ja     8008c4 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  800730:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800737:	00 00 00 
+  80073a:	48 85 c0             	test   %rax,%rax
+  80073d:	74 6b                	je     8007aa <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80073f:	4d 85 e4             	test   %r12,%r12
+  800742:	74 66                	je     8007aa <malloc+0xab>
+  800744:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80074b:	00 00 00 
+  80074e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800753:	eb 0d                	jmp    800762 <malloc+0x63>
+  800755:	48 83 c1 01          	add    $0x1,%rcx
+  800759:	48 83 c2 18          	add    $0x18,%rdx
+  80075d:	49 39 cc             	cmp    %rcx,%r12
+  800760:	74 48                	je     8007aa <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  800762:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  800767:	74 ec                	je     800755 <malloc+0x56>
+  800769:	48 39 1a             	cmp    %rbx,(%rdx)
+  80076c:	72 e7                	jb     800755 <malloc+0x56>
+                real_freep_size--;
+  80076e:	48 83 e8 01          	sub    $0x1,%rax
+  800772:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800779:	00 00 00 
+                freep[i].is_free = false;
+  80077c:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800783:	00 00 00 
+  800786:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80078a:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  80078e:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  800792:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  800799:	00 
+                freep[i].size = size;
+  80079a:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  80079e:	48 01 c8             	add    %rcx,%rax
+  8007a1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007a5:	e9 0b 01 00 00       	jmp    8008b5 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8007aa:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8007b1:	00 00 00 
+  8007b4:	48 01 d8             	add    %rbx,%rax
+  8007b7:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007bd:	76 7c                	jbe    80083b <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007bf:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8007c6:	00 00 00 
+  8007c9:	4c 8b 30             	mov    (%rax),%r14
+  8007cc:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8007d3:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8007d6:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8007dd:	00 00 00 
+  8007e0:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8007e7:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8007ee:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8007f4:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8007f8:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  8007ff:	00 00 00 
+  800802:	ff d0                	call   *%rax
+  800804:	89 c7                	mov    %eax,%edi
+  800806:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80080d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  800814:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80081b:	00 00 00 
+  80081e:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  800822:	b9 26 00 00 00       	mov    $0x26,%ecx
+  800827:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  80082e:	00 00 00 
+  800831:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  800833:	85 c0                	test   %eax,%eax
+  800835:	0f 88 90 00 00 00    	js     8008cb <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80083b:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  800842:	00 00 00 
+  800845:	48 8b 31             	mov    (%rcx),%rsi
+  800848:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  80084f:	00 00 00 
+  800852:	4c 8b 07             	mov    (%rdi),%r8
+  800855:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  800859:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  800860:	00 00 00 
+  800863:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  800867:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80086b:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800872:	00 00 00 
+  800875:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  800879:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80087c:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  800880:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  800887:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  800888:	48 89 d8             	mov    %rbx,%rax
+  80088b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800890:	4c 01 c0             	add    %r8,%rax
+  800893:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  800896:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80089d:	48 01 f3             	add    %rsi,%rbx
+  8008a0:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8008a3:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8008a8:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008af:	00 00 00 
+  8008b2:	48 89 d0             	mov    %rdx,%rax
+}
+  8008b5:	5b                   	pop    %rbx
+  8008b6:	41 5c                	pop    %r12
+  8008b8:	41 5d                	pop    %r13
+  8008ba:	41 5e                	pop    %r14
+  8008bc:	5d                   	pop    %rbp
+  8008bd:	c3                   	ret
+        return NULL;
+  8008be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008c3:	c3                   	ret
+        return NULL;
+  8008c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c9:	eb ea                	jmp    8008b5 <malloc+0x1b6>
+            return NULL;
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	eb e3                	jmp    8008b5 <malloc+0x1b6>
+
+00000000008008d2 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8008d2:	55                   	push   %rbp
+  8008d3:	48 89 e5             	mov    %rsp,%rbp
+  8008d6:	53                   	push   %rbx
+  8008d7:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8008db:	48 89 fb             	mov    %rdi,%rbx
+  8008de:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8008e2:	48 89 df             	mov    %rbx,%rdi
+  8008e5:	48 b8 ff 06 80 00 00 	movabs $0x8006ff,%rax
+  8008ec:	00 00 00 
+  8008ef:	ff d0                	call   *%rax
+  8008f1:	48 89 c7             	mov    %rax,%rdi
+  8008f4:	48 89 da             	mov    %rbx,%rdx
+  8008f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8008fc:	48 b8 d2 3c 80 00 00 	movabs $0x803cd2,%rax
+  800903:	00 00 00 
+  800906:	ff d0                	call   *%rax
+}
+  800908:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80090c:	c9                   	leave
+  80090d:	c3                   	ret
+
+000000000080090e <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  80090e:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  800915:	00 00 00 
+  800918:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80091f:	00 00 00 
+  800922:	48 3b 02             	cmp    (%rdx),%rax
+  800925:	74 4d                	je     800974 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  800927:	48 85 c0             	test   %rax,%rax
+  80092a:	74 4d                	je     800979 <get_allocsize+0x6b>
+  80092c:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  800933:	00 00 00 
+  800936:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80093b:	48 3b 39             	cmp    (%rcx),%rdi
+  80093e:	74 13                	je     800953 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  800940:	48 83 c2 01          	add    $0x1,%rdx
+  800944:	48 83 c1 18          	add    $0x18,%rcx
+  800948:	48 39 d0             	cmp    %rdx,%rax
+  80094b:	75 ee                	jne    80093b <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  80094d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800952:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  800953:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800957:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095c:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800963:	00 00 00 
+  800966:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80096c:	75 0b                	jne    800979 <get_allocsize+0x6b>
+  80096e:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  800973:	c3                   	ret
+        return 0;
+  800974:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800979:	c3                   	ret
+
+000000000080097a <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80097a:	48 85 ff             	test   %rdi,%rdi
+  80097d:	0f 84 01 01 00 00    	je     800a84 <free+0x10a>
+free(void *ptr) {
+  800983:	55                   	push   %rbp
+  800984:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  800987:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80098e:	00 00 00 
+  800991:	48 8b 30             	mov    (%rax),%rsi
+  800994:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80099b:	00 00 00 
+  80099e:	48 39 c6             	cmp    %rax,%rsi
+  8009a1:	74 50                	je     8009f3 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8009a3:	48 85 f6             	test   %rsi,%rsi
+  8009a6:	74 21                	je     8009c9 <free+0x4f>
+  8009a8:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009af:	00 00 00 
+  8009b2:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009b7:	48 3b 39             	cmp    (%rcx),%rdi
+  8009ba:	74 61                	je     800a1d <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009bc:	48 83 c2 01          	add    $0x1,%rdx
+  8009c0:	48 83 c1 18          	add    $0x18,%rcx
+  8009c4:	48 39 d6             	cmp    %rdx,%rsi
+  8009c7:	75 ee                	jne    8009b7 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8009c9:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  8009d0:	00 00 00 
+  8009d3:	be 12 01 00 00       	mov    $0x112,%esi
+  8009d8:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009df:	00 00 00 
+  8009e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e7:	48 b9 2a 2f 80 00 00 	movabs $0x802f2a,%rcx
+  8009ee:	00 00 00 
+  8009f1:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  8009f3:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  8009fa:	00 00 00 
+  8009fd:	be 06 01 00 00       	mov    $0x106,%esi
+  800a02:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a09:	00 00 00 
+  800a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a11:	48 b9 2a 2f 80 00 00 	movabs $0x802f2a,%rcx
+  800a18:	00 00 00 
+  800a1b:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a1d:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a21:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a28:	00 00 00 
+  800a2b:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a31:	75 27                	jne    800a5a <free+0xe0>
+            freep[i].is_free = true;
+  800a33:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a37:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a3e:	00 00 00 
+  800a41:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a48:	00 00 
+            real_freep_size++;
+  800a4a:	48 83 c0 01          	add    $0x1,%rax
+  800a4e:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a55:	00 00 00 
+}
+  800a58:	5d                   	pop    %rbp
+  800a59:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a5a:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a61:	00 00 00 
+  800a64:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800a69:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a70:	00 00 00 
+  800a73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a78:	48 b9 2a 2f 80 00 00 	movabs $0x802f2a,%rcx
+  800a7f:	00 00 00 
+  800a82:	ff d1                	call   *%rcx
+  800a84:	c3                   	ret
+
+0000000000800a85 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800a85:	55                   	push   %rbp
+  800a86:	48 89 e5             	mov    %rsp,%rbp
+  800a89:	41 55                	push   %r13
+  800a8b:	41 54                	push   %r12
+  800a8d:	53                   	push   %rbx
+  800a8e:	48 83 ec 08          	sub    $0x8,%rsp
+  800a92:	48 89 fb             	mov    %rdi,%rbx
+  800a95:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800a98:	48 b8 0e 09 80 00 00 	movabs $0x80090e,%rax
+  800a9f:	00 00 00 
+  800aa2:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800aa4:	49 39 c5             	cmp    %rax,%r13
+  800aa7:	73 0e                	jae    800ab7 <realloc+0x32>
+}
+  800aa9:	48 89 d8             	mov    %rbx,%rax
+  800aac:	48 83 c4 08          	add    $0x8,%rsp
+  800ab0:	5b                   	pop    %rbx
+  800ab1:	41 5c                	pop    %r12
+  800ab3:	41 5d                	pop    %r13
+  800ab5:	5d                   	pop    %rbp
+  800ab6:	c3                   	ret
+  800ab7:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800aba:	4c 89 ef             	mov    %r13,%rdi
+  800abd:	48 b8 ff 06 80 00 00 	movabs $0x8006ff,%rax
+  800ac4:	00 00 00 
+  800ac7:	ff d0                	call   *%rax
+  800ac9:	48 89 c7             	mov    %rax,%rdi
+  800acc:	4c 89 e2             	mov    %r12,%rdx
+  800acf:	48 89 de             	mov    %rbx,%rsi
+  800ad2:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  800ad9:	00 00 00 
+  800adc:	ff d0                	call   *%rax
+  800ade:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800ae1:	48 89 df             	mov    %rbx,%rdi
+  800ae4:	48 b8 7a 09 80 00 00 	movabs $0x80097a,%rax
+  800aeb:	00 00 00 
+  800aee:	ff d0                	call   *%rax
+    return newptr;
+  800af0:	4c 89 e3             	mov    %r12,%rbx
+  800af3:	eb b4                	jmp    800aa9 <realloc+0x24>
+
+0000000000800af5 <strdup>:
+
+char*
+strdup (const char *src) {
+  800af5:	55                   	push   %rbp
+  800af6:	48 89 e5             	mov    %rsp,%rbp
+  800af9:	41 54                	push   %r12
+  800afb:	53                   	push   %rbx
+  800afc:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800aff:	48 b8 b4 39 80 00 00 	movabs $0x8039b4,%rax
+  800b06:	00 00 00 
+  800b09:	ff d0                	call   *%rax
+  800b0b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b0f:	4c 89 e7             	mov    %r12,%rdi
+  800b12:	48 b8 ff 06 80 00 00 	movabs $0x8006ff,%rax
+  800b19:	00 00 00 
+  800b1c:	ff d0                	call   *%rax
+  800b1e:	48 89 c7             	mov    %rax,%rdi
+  800b21:	4c 89 e2             	mov    %r12,%rdx
+  800b24:	48 89 de             	mov    %rbx,%rsi
+  800b27:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  800b2e:	00 00 00 
+  800b31:	ff d0                	call   *%rax
+}
+  800b33:	5b                   	pop    %rbx
+  800b34:	41 5c                	pop    %r12
+  800b36:	5d                   	pop    %rbp
+  800b37:	c3                   	ret
+
+0000000000800b38 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b38:	55                   	push   %rbp
+  800b39:	48 89 e5             	mov    %rsp,%rbp
+  800b3c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b3d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b47:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b51:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b56:	be 00 00 00 00       	mov    $0x0,%esi
+  800b5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b61:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b67:	c9                   	leave
+  800b68:	c3                   	ret
+
+0000000000800b69 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800b69:	55                   	push   %rbp
+  800b6a:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800b6d:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800b74:	00 00 00 
+  800b77:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b7b:	74 26                	je     800ba3 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800b7d:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b7f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b83:	89 c0                	mov    %eax,%eax
+  800b85:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800b88:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800b8f:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800b96:	00 00 00 
+  800b99:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9e:	48 f7 31             	divq   (%rcx)
+}
+  800ba1:	5d                   	pop    %rbp
+  800ba2:	c3                   	ret
+        freq = get_cpufreq();
+  800ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba8:	48 ba 38 0b 80 00 00 	movabs $0x800b38,%rdx
+  800baf:	00 00 00 
+  800bb2:	ff d2                	call   *%rdx
+  800bb4:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bbb:	00 00 00 
+  800bbe:	eb bd                	jmp    800b7d <get_ticks+0x14>
+
+0000000000800bc0 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bc0:	55                   	push   %rbp
+  800bc1:	48 89 e5             	mov    %rsp,%rbp
+  800bc4:	53                   	push   %rbx
+  800bc5:	48 83 ec 08          	sub    $0x8,%rsp
+  800bc9:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800bcc:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bd3:	00 00 00 
+  800bd6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800bda:	74 50                	je     800c2c <sleep+0x6c>
+    asm volatile("rdtsc"
+  800bdc:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bde:	48 c1 e2 20          	shl    $0x20,%rdx
+  800be2:	89 c0                	mov    %eax,%eax
+  800be4:	48 89 d6             	mov    %rdx,%rsi
+  800be7:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800bea:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bf1:	00 00 00 
+  800bf4:	48 0f af 18          	imul   (%rax),%rbx
+  800bf8:	48 c1 eb 03          	shr    $0x3,%rbx
+  800bfc:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800c03:	9b c4 20 
+  800c06:	48 89 d8             	mov    %rbx,%rax
+  800c09:	48 f7 e2             	mul    %rdx
+  800c0c:	48 89 d1             	mov    %rdx,%rcx
+  800c0f:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c13:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c15:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c19:	89 c0                	mov    %eax,%eax
+  800c1b:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c1e:	48 29 f2             	sub    %rsi,%rdx
+  800c21:	48 39 ca             	cmp    %rcx,%rdx
+  800c24:	72 ed                	jb     800c13 <sleep+0x53>
+}
+  800c26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c2a:	c9                   	leave
+  800c2b:	c3                   	ret
+        freq = get_cpufreq();
+  800c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c31:	48 ba 38 0b 80 00 00 	movabs $0x800b38,%rdx
+  800c38:	00 00 00 
+  800c3b:	ff d2                	call   *%rdx
+  800c3d:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c44:	00 00 00 
+  800c47:	eb 93                	jmp    800bdc <sleep+0x1c>
+
+0000000000800c49 <poll_kbd>:
+
+int poll_kbd() {
+  800c49:	55                   	push   %rbp
+  800c4a:	48 89 e5             	mov    %rsp,%rbp
+  800c4d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c4e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c58:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c62:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c67:	be 00 00 00 00       	mov    $0x0,%esi
+  800c6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c72:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c78:	c9                   	leave
+  800c79:	c3                   	ret
+
+0000000000800c7a <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800c7a:	55                   	push   %rbp
+  800c7b:	48 89 e5             	mov    %rsp,%rbp
+  800c7e:	53                   	push   %rbx
+  800c7f:	49 89 fa             	mov    %rdi,%r10
+  800c82:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800c84:	44 89 c6             	mov    %r8d,%esi
+  800c87:	89 cf                	mov    %ecx,%edi
+  800c89:	89 d3                	mov    %edx,%ebx
+  800c8b:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800c8d:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c92:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c95:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800c99:	cd 30                	int    $0x30
+  800c9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c9f:	c9                   	leave
+  800ca0:	c3                   	ret
+
+0000000000800ca1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800ca1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800ca8:	ff ff ff 
+  800cab:	48 01 f8             	add    %rdi,%rax
+  800cae:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800cb2:	c3                   	ret
+
+0000000000800cb3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cb3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cba:	ff ff ff 
+  800cbd:	48 01 f8             	add    %rdi,%rax
+  800cc0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800cc4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800cca:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800cce:	c3                   	ret
+
+0000000000800ccf <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800ccf:	55                   	push   %rbp
+  800cd0:	48 89 e5             	mov    %rsp,%rbp
+  800cd3:	41 57                	push   %r15
+  800cd5:	41 56                	push   %r14
+  800cd7:	41 55                	push   %r13
+  800cd9:	41 54                	push   %r12
+  800cdb:	53                   	push   %rbx
+  800cdc:	48 83 ec 08          	sub    $0x8,%rsp
+  800ce0:	49 89 ff             	mov    %rdi,%r15
+  800ce3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800ce8:	49 bd 83 2b 80 00 00 	movabs $0x802b83,%r13
+  800cef:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800cf2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800cf8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800cfb:	48 89 df             	mov    %rbx,%rdi
+  800cfe:	41 ff d5             	call   *%r13
+  800d01:	83 e0 04             	and    $0x4,%eax
+  800d04:	74 17                	je     800d1d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800d06:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d0d:	4c 39 f3             	cmp    %r14,%rbx
+  800d10:	75 e6                	jne    800cf8 <fd_alloc+0x29>
+  800d12:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d18:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d1d:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d20:	48 83 c4 08          	add    $0x8,%rsp
+  800d24:	5b                   	pop    %rbx
+  800d25:	41 5c                	pop    %r12
+  800d27:	41 5d                	pop    %r13
+  800d29:	41 5e                	pop    %r14
+  800d2b:	41 5f                	pop    %r15
+  800d2d:	5d                   	pop    %rbp
+  800d2e:	c3                   	ret
+
+0000000000800d2f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d2f:	83 ff 1f             	cmp    $0x1f,%edi
+  800d32:	77 39                	ja     800d6d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d34:	55                   	push   %rbp
+  800d35:	48 89 e5             	mov    %rsp,%rbp
+  800d38:	41 54                	push   %r12
+  800d3a:	53                   	push   %rbx
+  800d3b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d3e:	48 63 df             	movslq %edi,%rbx
+  800d41:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d48:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d4c:	48 89 df             	mov    %rbx,%rdi
+  800d4f:	48 b8 83 2b 80 00 00 	movabs $0x802b83,%rax
+  800d56:	00 00 00 
+  800d59:	ff d0                	call   *%rax
+  800d5b:	a8 04                	test   $0x4,%al
+  800d5d:	74 14                	je     800d73 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d5f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d68:	5b                   	pop    %rbx
+  800d69:	41 5c                	pop    %r12
+  800d6b:	5d                   	pop    %rbp
+  800d6c:	c3                   	ret
+        return -E_INVAL;
+  800d6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d72:	c3                   	ret
+        return -E_INVAL;
+  800d73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d78:	eb ee                	jmp    800d68 <fd_lookup+0x39>
+
+0000000000800d7a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d7a:	55                   	push   %rbp
+  800d7b:	48 89 e5             	mov    %rsp,%rbp
+  800d7e:	41 54                	push   %r12
+  800d80:	53                   	push   %rbx
+  800d81:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800d84:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800d8b:	00 00 00 
+  800d8e:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800d95:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800d98:	39 3b                	cmp    %edi,(%rbx)
+  800d9a:	74 47                	je     800de3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800d9c:	48 83 c0 08          	add    $0x8,%rax
+  800da0:	48 8b 18             	mov    (%rax),%rbx
+  800da3:	48 85 db             	test   %rbx,%rbx
+  800da6:	75 f0                	jne    800d98 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800da8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800daf:	00 00 00 
+  800db2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800db8:	89 fa                	mov    %edi,%edx
+  800dba:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  800dc1:	00 00 00 
+  800dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc9:	48 b9 7a 30 80 00 00 	movabs $0x80307a,%rcx
+  800dd0:	00 00 00 
+  800dd3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800dd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800dda:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800dde:	5b                   	pop    %rbx
+  800ddf:	41 5c                	pop    %r12
+  800de1:	5d                   	pop    %rbp
+  800de2:	c3                   	ret
+            return 0;
+  800de3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de8:	eb f0                	jmp    800dda <dev_lookup+0x60>
+
+0000000000800dea <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800dea:	55                   	push   %rbp
+  800deb:	48 89 e5             	mov    %rsp,%rbp
+  800dee:	41 55                	push   %r13
+  800df0:	41 54                	push   %r12
+  800df2:	53                   	push   %rbx
+  800df3:	48 83 ec 18          	sub    $0x18,%rsp
+  800df7:	48 89 fb             	mov    %rdi,%rbx
+  800dfa:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800dfd:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800e04:	ff ff ff 
+  800e07:	48 01 df             	add    %rbx,%rdi
+  800e0a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800e0e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e12:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  800e19:	00 00 00 
+  800e1c:	ff d0                	call   *%rax
+  800e1e:	41 89 c5             	mov    %eax,%r13d
+  800e21:	85 c0                	test   %eax,%eax
+  800e23:	78 06                	js     800e2b <fd_close+0x41>
+  800e25:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e29:	74 1a                	je     800e45 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e2b:	45 84 e4             	test   %r12b,%r12b
+  800e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e33:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e37:	44 89 e8             	mov    %r13d,%eax
+  800e3a:	48 83 c4 18          	add    $0x18,%rsp
+  800e3e:	5b                   	pop    %rbx
+  800e3f:	41 5c                	pop    %r12
+  800e41:	41 5d                	pop    %r13
+  800e43:	5d                   	pop    %rbp
+  800e44:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e45:	8b 3b                	mov    (%rbx),%edi
+  800e47:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e4b:	48 b8 7a 0d 80 00 00 	movabs $0x800d7a,%rax
+  800e52:	00 00 00 
+  800e55:	ff d0                	call   *%rax
+  800e57:	41 89 c5             	mov    %eax,%r13d
+  800e5a:	85 c0                	test   %eax,%eax
+  800e5c:	78 1b                	js     800e79 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e62:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800e66:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e6c:	48 85 c0             	test   %rax,%rax
+  800e6f:	74 08                	je     800e79 <fd_close+0x8f>
+  800e71:	48 89 df             	mov    %rbx,%rdi
+  800e74:	ff d0                	call   *%rax
+  800e76:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800e79:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e7e:	48 89 de             	mov    %rbx,%rsi
+  800e81:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e86:	48 b8 6a 04 80 00 00 	movabs $0x80046a,%rax
+  800e8d:	00 00 00 
+  800e90:	ff d0                	call   *%rax
+    return res;
+  800e92:	eb a3                	jmp    800e37 <fd_close+0x4d>
+
+0000000000800e94 <close>:
+
+int
+close(int fdnum) {
+  800e94:	55                   	push   %rbp
+  800e95:	48 89 e5             	mov    %rsp,%rbp
+  800e98:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800e9c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800ea0:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  800ea7:	00 00 00 
+  800eaa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	78 15                	js     800ec5 <close+0x31>
+
+    return fd_close(fd, 1);
+  800eb0:	be 01 00 00 00       	mov    $0x1,%esi
+  800eb5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800eb9:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  800ec0:	00 00 00 
+  800ec3:	ff d0                	call   *%rax
+}
+  800ec5:	c9                   	leave
+  800ec6:	c3                   	ret
+
+0000000000800ec7 <close_all>:
+
+void
+close_all(void) {
+  800ec7:	55                   	push   %rbp
+  800ec8:	48 89 e5             	mov    %rsp,%rbp
+  800ecb:	41 54                	push   %r12
+  800ecd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800ece:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed3:	49 bc 94 0e 80 00 00 	movabs $0x800e94,%r12
+  800eda:	00 00 00 
+  800edd:	89 df                	mov    %ebx,%edi
+  800edf:	41 ff d4             	call   *%r12
+  800ee2:	83 c3 01             	add    $0x1,%ebx
+  800ee5:	83 fb 20             	cmp    $0x20,%ebx
+  800ee8:	75 f3                	jne    800edd <close_all+0x16>
+}
+  800eea:	5b                   	pop    %rbx
+  800eeb:	41 5c                	pop    %r12
+  800eed:	5d                   	pop    %rbp
+  800eee:	c3                   	ret
+
+0000000000800eef <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800eef:	55                   	push   %rbp
+  800ef0:	48 89 e5             	mov    %rsp,%rbp
+  800ef3:	41 57                	push   %r15
+  800ef5:	41 56                	push   %r14
+  800ef7:	41 55                	push   %r13
+  800ef9:	41 54                	push   %r12
+  800efb:	53                   	push   %rbx
+  800efc:	48 83 ec 18          	sub    $0x18,%rsp
+  800f00:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800f03:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800f07:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  800f0e:	00 00 00 
+  800f11:	ff d0                	call   *%rax
+  800f13:	89 c3                	mov    %eax,%ebx
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	0f 88 b8 00 00 00    	js     800fd5 <dup+0xe6>
+    close(newfdnum);
+  800f1d:	44 89 e7             	mov    %r12d,%edi
+  800f20:	48 b8 94 0e 80 00 00 	movabs $0x800e94,%rax
+  800f27:	00 00 00 
+  800f2a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f2c:	4d 63 ec             	movslq %r12d,%r13
+  800f2f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f36:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f3a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f3e:	4c 89 ff             	mov    %r15,%rdi
+  800f41:	49 be b3 0c 80 00 00 	movabs $0x800cb3,%r14
+  800f48:	00 00 00 
+  800f4b:	41 ff d6             	call   *%r14
+  800f4e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f51:	4c 89 ef             	mov    %r13,%rdi
+  800f54:	41 ff d6             	call   *%r14
+  800f57:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f5a:	48 89 df             	mov    %rbx,%rdi
+  800f5d:	48 b8 83 2b 80 00 00 	movabs $0x802b83,%rax
+  800f64:	00 00 00 
+  800f67:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800f69:	a8 04                	test   $0x4,%al
+  800f6b:	74 2b                	je     800f98 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800f6d:	41 89 c1             	mov    %eax,%r9d
+  800f70:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f76:	4c 89 f1             	mov    %r14,%rcx
+  800f79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7e:	48 89 de             	mov    %rbx,%rsi
+  800f81:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f86:	48 b8 f2 02 80 00 00 	movabs $0x8002f2,%rax
+  800f8d:	00 00 00 
+  800f90:	ff d0                	call   *%rax
+  800f92:	89 c3                	mov    %eax,%ebx
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	78 4e                	js     800fe6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800f98:	4c 89 ff             	mov    %r15,%rdi
+  800f9b:	48 b8 83 2b 80 00 00 	movabs $0x802b83,%rax
+  800fa2:	00 00 00 
+  800fa5:	ff d0                	call   *%rax
+  800fa7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800faa:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fb0:	4c 89 e9             	mov    %r13,%rcx
+  800fb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb8:	4c 89 fe             	mov    %r15,%rsi
+  800fbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fc0:	48 b8 f2 02 80 00 00 	movabs $0x8002f2,%rax
+  800fc7:	00 00 00 
+  800fca:	ff d0                	call   *%rax
+  800fcc:	89 c3                	mov    %eax,%ebx
+  800fce:	85 c0                	test   %eax,%eax
+  800fd0:	78 14                	js     800fe6 <dup+0xf7>
+
+    return newfdnum;
+  800fd2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800fd5:	89 d8                	mov    %ebx,%eax
+  800fd7:	48 83 c4 18          	add    $0x18,%rsp
+  800fdb:	5b                   	pop    %rbx
+  800fdc:	41 5c                	pop    %r12
+  800fde:	41 5d                	pop    %r13
+  800fe0:	41 5e                	pop    %r14
+  800fe2:	41 5f                	pop    %r15
+  800fe4:	5d                   	pop    %rbp
+  800fe5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800fe6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800feb:	4c 89 ee             	mov    %r13,%rsi
+  800fee:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff3:	49 bc 6a 04 80 00 00 	movabs $0x80046a,%r12
+  800ffa:	00 00 00 
+  800ffd:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801000:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801005:	4c 89 f6             	mov    %r14,%rsi
+  801008:	bf 00 00 00 00       	mov    $0x0,%edi
+  80100d:	41 ff d4             	call   *%r12
+    return res;
+  801010:	eb c3                	jmp    800fd5 <dup+0xe6>
+
+0000000000801012 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801012:	55                   	push   %rbp
+  801013:	48 89 e5             	mov    %rsp,%rbp
+  801016:	41 56                	push   %r14
+  801018:	41 55                	push   %r13
+  80101a:	41 54                	push   %r12
+  80101c:	53                   	push   %rbx
+  80101d:	48 83 ec 10          	sub    $0x10,%rsp
+  801021:	89 fb                	mov    %edi,%ebx
+  801023:	49 89 f4             	mov    %rsi,%r12
+  801026:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801029:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80102d:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  801034:	00 00 00 
+  801037:	ff d0                	call   *%rax
+  801039:	85 c0                	test   %eax,%eax
+  80103b:	78 4c                	js     801089 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80103d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801041:	41 8b 3e             	mov    (%r14),%edi
+  801044:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801048:	48 b8 7a 0d 80 00 00 	movabs $0x800d7a,%rax
+  80104f:	00 00 00 
+  801052:	ff d0                	call   *%rax
+  801054:	85 c0                	test   %eax,%eax
+  801056:	78 35                	js     80108d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801058:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80105c:	83 e0 03             	and    $0x3,%eax
+  80105f:	83 f8 01             	cmp    $0x1,%eax
+  801062:	74 2d                	je     801091 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801064:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801068:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80106c:	48 85 c0             	test   %rax,%rax
+  80106f:	74 56                	je     8010c7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801071:	4c 89 ea             	mov    %r13,%rdx
+  801074:	4c 89 e6             	mov    %r12,%rsi
+  801077:	4c 89 f7             	mov    %r14,%rdi
+  80107a:	ff d0                	call   *%rax
+}
+  80107c:	48 83 c4 10          	add    $0x10,%rsp
+  801080:	5b                   	pop    %rbx
+  801081:	41 5c                	pop    %r12
+  801083:	41 5d                	pop    %r13
+  801085:	41 5e                	pop    %r14
+  801087:	5d                   	pop    %rbp
+  801088:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801089:	48 98                	cltq
+  80108b:	eb ef                	jmp    80107c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80108d:	48 98                	cltq
+  80108f:	eb eb                	jmp    80107c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801091:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801098:	00 00 00 
+  80109b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8010a1:	89 da                	mov    %ebx,%edx
+  8010a3:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  8010aa:	00 00 00 
+  8010ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b2:	48 b9 7a 30 80 00 00 	movabs $0x80307a,%rcx
+  8010b9:	00 00 00 
+  8010bc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010be:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8010c5:	eb b5                	jmp    80107c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010c7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8010ce:	eb ac                	jmp    80107c <read+0x6a>
+
+00000000008010d0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8010d0:	55                   	push   %rbp
+  8010d1:	48 89 e5             	mov    %rsp,%rbp
+  8010d4:	41 57                	push   %r15
+  8010d6:	41 56                	push   %r14
+  8010d8:	41 55                	push   %r13
+  8010da:	41 54                	push   %r12
+  8010dc:	53                   	push   %rbx
+  8010dd:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8010e1:	48 85 d2             	test   %rdx,%rdx
+  8010e4:	74 54                	je     80113a <readn+0x6a>
+  8010e6:	41 89 fd             	mov    %edi,%r13d
+  8010e9:	49 89 f6             	mov    %rsi,%r14
+  8010ec:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8010ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8010f4:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8010f9:	49 bf 12 10 80 00 00 	movabs $0x801012,%r15
+  801100:	00 00 00 
+  801103:	4c 89 e2             	mov    %r12,%rdx
+  801106:	48 29 f2             	sub    %rsi,%rdx
+  801109:	4c 01 f6             	add    %r14,%rsi
+  80110c:	44 89 ef             	mov    %r13d,%edi
+  80110f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801112:	85 c0                	test   %eax,%eax
+  801114:	78 20                	js     801136 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801116:	01 c3                	add    %eax,%ebx
+  801118:	85 c0                	test   %eax,%eax
+  80111a:	74 08                	je     801124 <readn+0x54>
+  80111c:	48 63 f3             	movslq %ebx,%rsi
+  80111f:	4c 39 e6             	cmp    %r12,%rsi
+  801122:	72 df                	jb     801103 <readn+0x33>
+    }
+    return res;
+  801124:	48 63 c3             	movslq %ebx,%rax
+}
+  801127:	48 83 c4 08          	add    $0x8,%rsp
+  80112b:	5b                   	pop    %rbx
+  80112c:	41 5c                	pop    %r12
+  80112e:	41 5d                	pop    %r13
+  801130:	41 5e                	pop    %r14
+  801132:	41 5f                	pop    %r15
+  801134:	5d                   	pop    %rbp
+  801135:	c3                   	ret
+        if (inc < 0) return inc;
+  801136:	48 98                	cltq
+  801138:	eb ed                	jmp    801127 <readn+0x57>
+    int inc = 1, res = 0;
+  80113a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113f:	eb e3                	jmp    801124 <readn+0x54>
+
+0000000000801141 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801141:	55                   	push   %rbp
+  801142:	48 89 e5             	mov    %rsp,%rbp
+  801145:	41 56                	push   %r14
+  801147:	41 55                	push   %r13
+  801149:	41 54                	push   %r12
+  80114b:	53                   	push   %rbx
+  80114c:	48 83 ec 10          	sub    $0x10,%rsp
+  801150:	89 fb                	mov    %edi,%ebx
+  801152:	49 89 f4             	mov    %rsi,%r12
+  801155:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801158:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80115c:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  801163:	00 00 00 
+  801166:	ff d0                	call   *%rax
+  801168:	85 c0                	test   %eax,%eax
+  80116a:	78 47                	js     8011b3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80116c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801170:	41 8b 3e             	mov    (%r14),%edi
+  801173:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801177:	48 b8 7a 0d 80 00 00 	movabs $0x800d7a,%rax
+  80117e:	00 00 00 
+  801181:	ff d0                	call   *%rax
+  801183:	85 c0                	test   %eax,%eax
+  801185:	78 30                	js     8011b7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801187:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80118c:	74 2d                	je     8011bb <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80118e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801192:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801196:	48 85 c0             	test   %rax,%rax
+  801199:	74 56                	je     8011f1 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80119b:	4c 89 ea             	mov    %r13,%rdx
+  80119e:	4c 89 e6             	mov    %r12,%rsi
+  8011a1:	4c 89 f7             	mov    %r14,%rdi
+  8011a4:	ff d0                	call   *%rax
+}
+  8011a6:	48 83 c4 10          	add    $0x10,%rsp
+  8011aa:	5b                   	pop    %rbx
+  8011ab:	41 5c                	pop    %r12
+  8011ad:	41 5d                	pop    %r13
+  8011af:	41 5e                	pop    %r14
+  8011b1:	5d                   	pop    %rbp
+  8011b2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011b3:	48 98                	cltq
+  8011b5:	eb ef                	jmp    8011a6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011b7:	48 98                	cltq
+  8011b9:	eb eb                	jmp    8011a6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011bb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8011c2:	00 00 00 
+  8011c5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8011cb:	89 da                	mov    %ebx,%edx
+  8011cd:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  8011d4:	00 00 00 
+  8011d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011dc:	48 b9 7a 30 80 00 00 	movabs $0x80307a,%rcx
+  8011e3:	00 00 00 
+  8011e6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8011e8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011ef:	eb b5                	jmp    8011a6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8011f1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8011f8:	eb ac                	jmp    8011a6 <write+0x65>
+
+00000000008011fa <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8011fa:	55                   	push   %rbp
+  8011fb:	48 89 e5             	mov    %rsp,%rbp
+  8011fe:	53                   	push   %rbx
+  8011ff:	48 83 ec 18          	sub    $0x18,%rsp
+  801203:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801205:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801209:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  801210:	00 00 00 
+  801213:	ff d0                	call   *%rax
+  801215:	85 c0                	test   %eax,%eax
+  801217:	78 0c                	js     801225 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801219:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80121d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801220:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801225:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801229:	c9                   	leave
+  80122a:	c3                   	ret
+
+000000000080122b <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80122b:	55                   	push   %rbp
+  80122c:	48 89 e5             	mov    %rsp,%rbp
+  80122f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801233:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801237:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  80123e:	00 00 00 
+  801241:	ff d0                	call   *%rax
+  801243:	85 c0                	test   %eax,%eax
+  801245:	78 07                	js     80124e <tell+0x23>
+    return fdes->fd_offset;
+  801247:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80124b:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80124e:	c9                   	leave
+  80124f:	c3                   	ret
+
+0000000000801250 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801250:	55                   	push   %rbp
+  801251:	48 89 e5             	mov    %rsp,%rbp
+  801254:	41 55                	push   %r13
+  801256:	41 54                	push   %r12
+  801258:	53                   	push   %rbx
+  801259:	48 83 ec 18          	sub    $0x18,%rsp
+  80125d:	89 fb                	mov    %edi,%ebx
+  80125f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801262:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801266:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  80126d:	00 00 00 
+  801270:	ff d0                	call   *%rax
+  801272:	85 c0                	test   %eax,%eax
+  801274:	78 38                	js     8012ae <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801276:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80127a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80127e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801282:	48 b8 7a 0d 80 00 00 	movabs $0x800d7a,%rax
+  801289:	00 00 00 
+  80128c:	ff d0                	call   *%rax
+  80128e:	85 c0                	test   %eax,%eax
+  801290:	78 1c                	js     8012ae <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801292:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801297:	74 20                	je     8012b9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801299:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80129d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8012a1:	48 85 c0             	test   %rax,%rax
+  8012a4:	74 47                	je     8012ed <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8012a6:	44 89 e6             	mov    %r12d,%esi
+  8012a9:	4c 89 ef             	mov    %r13,%rdi
+  8012ac:	ff d0                	call   *%rax
+}
+  8012ae:	48 83 c4 18          	add    $0x18,%rsp
+  8012b2:	5b                   	pop    %rbx
+  8012b3:	41 5c                	pop    %r12
+  8012b5:	41 5d                	pop    %r13
+  8012b7:	5d                   	pop    %rbp
+  8012b8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8012b9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8012c0:	00 00 00 
+  8012c3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012c9:	89 da                	mov    %ebx,%edx
+  8012cb:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  8012d2:	00 00 00 
+  8012d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012da:	48 b9 7a 30 80 00 00 	movabs $0x80307a,%rcx
+  8012e1:	00 00 00 
+  8012e4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8012e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012eb:	eb c1                	jmp    8012ae <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012ed:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8012f2:	eb ba                	jmp    8012ae <ftruncate+0x5e>
+
+00000000008012f4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8012f4:	55                   	push   %rbp
+  8012f5:	48 89 e5             	mov    %rsp,%rbp
+  8012f8:	41 54                	push   %r12
+  8012fa:	53                   	push   %rbx
+  8012fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8012ff:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801302:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801306:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  80130d:	00 00 00 
+  801310:	ff d0                	call   *%rax
+  801312:	85 c0                	test   %eax,%eax
+  801314:	78 4e                	js     801364 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801316:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80131a:	41 8b 3c 24          	mov    (%r12),%edi
+  80131e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801322:	48 b8 7a 0d 80 00 00 	movabs $0x800d7a,%rax
+  801329:	00 00 00 
+  80132c:	ff d0                	call   *%rax
+  80132e:	85 c0                	test   %eax,%eax
+  801330:	78 32                	js     801364 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801332:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801336:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80133b:	74 30                	je     80136d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80133d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801340:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801347:	00 00 00 
+    stat->st_isdir = 0;
+  80134a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801351:	00 00 00 
+    stat->st_dev = dev;
+  801354:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80135b:	48 89 de             	mov    %rbx,%rsi
+  80135e:	4c 89 e7             	mov    %r12,%rdi
+  801361:	ff 50 28             	call   *0x28(%rax)
+}
+  801364:	48 83 c4 10          	add    $0x10,%rsp
+  801368:	5b                   	pop    %rbx
+  801369:	41 5c                	pop    %r12
+  80136b:	5d                   	pop    %rbp
+  80136c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80136d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801372:	eb f0                	jmp    801364 <fstat+0x70>
+
+0000000000801374 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  801374:	55                   	push   %rbp
+  801375:	48 89 e5             	mov    %rsp,%rbp
+  801378:	41 54                	push   %r12
+  80137a:	53                   	push   %rbx
+  80137b:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  801382:	41 89 fc             	mov    %edi,%r12d
+  801385:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801387:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80138b:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  801392:	00 00 00 
+  801395:	ff d0                	call   *%rax
+  801397:	85 c0                	test   %eax,%eax
+  801399:	78 31                	js     8013cc <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  80139b:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8013a2:	44 89 e7             	mov    %r12d,%edi
+  8013a5:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  8013ac:	00 00 00 
+  8013af:	ff d0                	call   *%rax
+  8013b1:	85 c0                	test   %eax,%eax
+  8013b3:	78 17                	js     8013cc <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8013b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013b9:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8013bc:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8013bf:	39 d3                	cmp    %edx,%ebx
+  8013c1:	0f 4f da             	cmovg  %edx,%ebx
+  8013c4:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8013c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013cc:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8013d3:	5b                   	pop    %rbx
+  8013d4:	41 5c                	pop    %r12
+  8013d6:	5d                   	pop    %rbp
+  8013d7:	c3                   	ret
+
+00000000008013d8 <seektoend>:
+{
+  8013d8:	55                   	push   %rbp
+  8013d9:	48 89 e5             	mov    %rsp,%rbp
+  8013dc:	53                   	push   %rbx
+  8013dd:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8013e4:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8013e6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013ea:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  8013f1:	00 00 00 
+  8013f4:	ff d0                	call   *%rax
+  8013f6:	85 c0                	test   %eax,%eax
+  8013f8:	78 28                	js     801422 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8013fa:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801401:	89 df                	mov    %ebx,%edi
+  801403:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  80140a:	00 00 00 
+  80140d:	ff d0                	call   *%rax
+  80140f:	85 c0                	test   %eax,%eax
+  801411:	78 0f                	js     801422 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  801413:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801416:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80141a:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80141d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801422:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801426:	c9                   	leave
+  801427:	c3                   	ret
+
+0000000000801428 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801428:	55                   	push   %rbp
+  801429:	48 89 e5             	mov    %rsp,%rbp
+  80142c:	41 54                	push   %r12
+  80142e:	53                   	push   %rbx
+  80142f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801432:	be 00 00 00 00       	mov    $0x0,%esi
+  801437:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  80143e:	00 00 00 
+  801441:	ff d0                	call   *%rax
+  801443:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801445:	85 c0                	test   %eax,%eax
+  801447:	78 25                	js     80146e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801449:	4c 89 e6             	mov    %r12,%rsi
+  80144c:	89 c7                	mov    %eax,%edi
+  80144e:	48 b8 f4 12 80 00 00 	movabs $0x8012f4,%rax
+  801455:	00 00 00 
+  801458:	ff d0                	call   *%rax
+  80145a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80145d:	89 df                	mov    %ebx,%edi
+  80145f:	48 b8 94 0e 80 00 00 	movabs $0x800e94,%rax
+  801466:	00 00 00 
+  801469:	ff d0                	call   *%rax
+
+    return res;
+  80146b:	44 89 e3             	mov    %r12d,%ebx
+}
+  80146e:	89 d8                	mov    %ebx,%eax
+  801470:	5b                   	pop    %rbx
+  801471:	41 5c                	pop    %r12
+  801473:	5d                   	pop    %rbp
+  801474:	c3                   	ret
+
+0000000000801475 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  801475:	55                   	push   %rbp
+  801476:	48 89 e5             	mov    %rsp,%rbp
+  801479:	53                   	push   %rbx
+  80147a:	48 83 ec 08          	sub    $0x8,%rsp
+  80147e:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801481:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  801488:	00 00 00 
+  80148b:	ff d0                	call   *%rax
+  80148d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801491:	0f 87 ea 00 00 00    	ja     801581 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  801497:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80149e:	00 00 00 
+  8014a1:	80 38 00             	cmpb   $0x0,(%rax)
+  8014a4:	75 35                	jne    8014db <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8014a6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014ab:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8014b0:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8014b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ba:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  8014c1:	00 00 00 
+  8014c4:	ff d0                	call   *%rax
+  8014c6:	85 c0                	test   %eax,%eax
+  8014c8:	0f 88 ba 00 00 00    	js     801588 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8014ce:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014d5:	00 00 00 
+  8014d8:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8014db:	48 89 df             	mov    %rbx,%rdi
+  8014de:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  8014e5:	00 00 00 
+  8014e8:	ff d0                	call   *%rax
+  8014ea:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8014ee:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8014f5:	00 00 00 
+  8014f8:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8014fc:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8014ff:	39 39                	cmp    %edi,(%rcx)
+  801501:	74 46                	je     801549 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  801503:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  801507:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  80150e:	00 
+  80150f:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  801516:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  80151d:	00 
+  80151e:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  801525:	00 
+  801526:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  80152d:	00 
+  80152e:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  801535:	00 
+  801536:	89 39                	mov    %edi,(%rcx)
+  801538:	48 01 c6             	add    %rax,%rsi
+  80153b:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  801540:	48 89 c8             	mov    %rcx,%rax
+  801543:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801547:	c9                   	leave
+  801548:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  801549:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80154d:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  801554:	00 00 00 
+  801557:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80155a:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80155e:	74 e0                	je     801540 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  801560:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  801567:	00 
+  801568:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80156c:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  801573:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  801575:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801578:	48 01 c2             	add    %rax,%rdx
+  80157b:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80157f:	eb bf                	jmp    801540 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801581:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801586:	eb b8                	jmp    801540 <fbuf_get+0xcb>
+            return NULL;
+  801588:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158d:	eb b1                	jmp    801540 <fbuf_get+0xcb>
+
+000000000080158f <fsipc_bulk>:
+fsipc_bulk(void) {
+  80158f:	55                   	push   %rbp
+  801590:	48 89 e5             	mov    %rsp,%rbp
+  801593:	53                   	push   %rbx
+  801594:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  801598:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  80159f:	00 00 00 
+  8015a2:	48 8b 18             	mov    (%rax),%rbx
+  8015a5:	48 85 db             	test   %rbx,%rbx
+  8015a8:	74 16                	je     8015c0 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8015aa:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015b1:	00 00 00 
+  8015b4:	48 8b 18             	mov    (%rax),%rbx
+}
+  8015b7:	48 89 d8             	mov    %rbx,%rax
+  8015ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015be:	c9                   	leave
+  8015bf:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8015c0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015c5:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8015ca:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8015cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015d4:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  8015db:	00 00 00 
+  8015de:	ff d0                	call   *%rax
+  8015e0:	85 c0                	test   %eax,%eax
+  8015e2:	78 d3                	js     8015b7 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8015e4:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8015e9:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8015f0:	00 00 00 
+  8015f3:	eb b5                	jmp    8015aa <fsipc_bulk+0x1b>
+
+00000000008015f5 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8015f5:	55                   	push   %rbp
+  8015f6:	48 89 e5             	mov    %rsp,%rbp
+  8015f9:	41 57                	push   %r15
+  8015fb:	41 56                	push   %r14
+  8015fd:	41 55                	push   %r13
+  8015ff:	41 54                	push   %r12
+  801601:	53                   	push   %rbx
+  801602:	48 83 ec 08          	sub    $0x8,%rsp
+  801606:	41 89 fd             	mov    %edi,%r13d
+  801609:	49 89 f6             	mov    %rsi,%r14
+  80160c:	49 89 d7             	mov    %rdx,%r15
+  80160f:	48 89 cb             	mov    %rcx,%rbx
+  801612:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801615:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80161c:	00 00 00 
+  80161f:	83 38 00             	cmpl   $0x0,(%rax)
+  801622:	74 52                	je     801676 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  801624:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80162a:	4c 89 f9             	mov    %r15,%rcx
+  80162d:	4c 89 f2             	mov    %r14,%rdx
+  801630:	44 89 ee             	mov    %r13d,%esi
+  801633:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80163a:	00 00 00 
+  80163d:	8b 38                	mov    (%rax),%edi
+  80163f:	48 b8 79 41 80 00 00 	movabs $0x804179,%rax
+  801646:	00 00 00 
+  801649:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80164b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801650:	4c 89 e2             	mov    %r12,%rdx
+  801653:	48 89 de             	mov    %rbx,%rsi
+  801656:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165b:	48 b8 c9 3f 80 00 00 	movabs $0x803fc9,%rax
+  801662:	00 00 00 
+  801665:	ff d0                	call   *%rax
+}
+  801667:	48 83 c4 08          	add    $0x8,%rsp
+  80166b:	5b                   	pop    %rbx
+  80166c:	41 5c                	pop    %r12
+  80166e:	41 5d                	pop    %r13
+  801670:	41 5e                	pop    %r14
+  801672:	41 5f                	pop    %r15
+  801674:	5d                   	pop    %rbp
+  801675:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801676:	bf 03 00 00 00       	mov    $0x3,%edi
+  80167b:	48 b8 1c 42 80 00 00 	movabs $0x80421c,%rax
+  801682:	00 00 00 
+  801685:	ff d0                	call   *%rax
+  801687:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80168e:	00 00 
+  801690:	eb 92                	jmp    801624 <fsipc_region+0x2f>
+
+0000000000801692 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  801692:	55                   	push   %rbp
+  801693:	48 89 e5             	mov    %rsp,%rbp
+  801696:	41 57                	push   %r15
+  801698:	41 56                	push   %r14
+  80169a:	41 55                	push   %r13
+  80169c:	41 54                	push   %r12
+  80169e:	53                   	push   %rbx
+  80169f:	48 83 ec 28          	sub    $0x28,%rsp
+  8016a3:	49 89 ff             	mov    %rdi,%r15
+  8016a6:	49 89 f6             	mov    %rsi,%r14
+  8016a9:	48 89 d3             	mov    %rdx,%rbx
+  8016ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016b0:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8016b3:	48 b8 8f 15 80 00 00 	movabs $0x80158f,%rax
+  8016ba:	00 00 00 
+  8016bd:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8016bf:	48 85 c0             	test   %rax,%rax
+  8016c2:	0f 84 cc 00 00 00    	je     801794 <devfile_write_direct+0x102>
+  8016c8:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8016cb:	48 85 db             	test   %rbx,%rbx
+  8016ce:	0f 84 ba 00 00 00    	je     80178e <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8016d4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016da:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8016e1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8016e5:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8016e9:	4c 29 e3             	sub    %r12,%rbx
+  8016ec:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8016f1:	48 39 c3             	cmp    %rax,%rbx
+  8016f4:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016f8:	48 89 da             	mov    %rbx,%rdx
+  8016fb:	4c 89 f6             	mov    %r14,%rsi
+  8016fe:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801702:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  801709:	00 00 00 
+  80170c:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  80170e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801712:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  801716:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801719:	44 01 e0             	add    %r12d,%eax
+  80171c:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  801720:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  801724:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80172b:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801732:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  801739:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80173f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801744:	4c 89 ee             	mov    %r13,%rsi
+  801747:	bf 04 00 00 00       	mov    $0x4,%edi
+  80174c:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  801753:	00 00 00 
+  801756:	ff d0                	call   *%rax
+        if (res < 0)
+  801758:	85 c0                	test   %eax,%eax
+  80175a:	78 29                	js     801785 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80175c:	74 2b                	je     801789 <devfile_write_direct+0xf7>
+        i += res;
+  80175e:	48 98                	cltq
+  801760:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  801763:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  801766:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80176a:	49 39 c4             	cmp    %rax,%r12
+  80176d:	0f 82 72 ff ff ff    	jb     8016e5 <devfile_write_direct+0x53>
+    return i;
+  801773:	4c 89 e0             	mov    %r12,%rax
+}
+  801776:	48 83 c4 28          	add    $0x28,%rsp
+  80177a:	5b                   	pop    %rbx
+  80177b:	41 5c                	pop    %r12
+  80177d:	41 5d                	pop    %r13
+  80177f:	41 5e                	pop    %r14
+  801781:	41 5f                	pop    %r15
+  801783:	5d                   	pop    %rbp
+  801784:	c3                   	ret
+            return res;
+  801785:	48 98                	cltq
+  801787:	eb ed                	jmp    801776 <devfile_write_direct+0xe4>
+            return i;
+  801789:	4c 89 e0             	mov    %r12,%rax
+  80178c:	eb e8                	jmp    801776 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80178e:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  801792:	eb df                	jmp    801773 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  801794:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  80179b:	eb d9                	jmp    801776 <devfile_write_direct+0xe4>
+
+000000000080179d <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  80179d:	55                   	push   %rbp
+  80179e:	48 89 e5             	mov    %rsp,%rbp
+  8017a1:	41 56                	push   %r14
+  8017a3:	41 55                	push   %r13
+  8017a5:	41 54                	push   %r12
+  8017a7:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8017a8:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8017ac:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8017b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b5:	4d 39 ee             	cmp    %r13,%r14
+  8017b8:	0f 84 99 00 00 00    	je     801857 <fbuf_flush+0xba>
+  8017be:	49 89 fc             	mov    %rdi,%r12
+  8017c1:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8017c4:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017c7:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8017cb:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  8017d2:	00 00 00 
+  8017d5:	ff d0                	call   *%rax
+  8017d7:	48 89 c2             	mov    %rax,%rdx
+  8017da:	48 c1 e2 04          	shl    $0x4,%rdx
+  8017de:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8017e2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8017e6:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8017eb:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017ee:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8017f2:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8017f9:	00 
+  8017fa:	44 89 f1             	mov    %r14d,%ecx
+  8017fd:	4c 89 ea             	mov    %r13,%rdx
+  801800:	4c 89 e7             	mov    %r12,%rdi
+  801803:	48 b8 92 16 80 00 00 	movabs $0x801692,%rax
+  80180a:	00 00 00 
+  80180d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80180f:	48 85 c0             	test   %rax,%rax
+  801812:	78 43                	js     801857 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  801814:	4c 39 e8             	cmp    %r13,%rax
+  801817:	72 47                	jb     801860 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  801819:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80181e:	83 c0 01             	add    $0x1,%eax
+  801821:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801826:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  801829:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80182d:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  801831:	72 0f                	jb     801842 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  801833:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  801837:	48 39 c2             	cmp    %rax,%rdx
+  80183a:	48 0f 42 d0          	cmovb  %rax,%rdx
+  80183e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  801842:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  801849:	00 
+  80184a:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  801851:	00 
+    return 0;
+  801852:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801857:	5b                   	pop    %rbx
+  801858:	41 5c                	pop    %r12
+  80185a:	41 5d                	pop    %r13
+  80185c:	41 5e                	pop    %r14
+  80185e:	5d                   	pop    %rbp
+  80185f:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  801860:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801865:	eb f0                	jmp    801857 <fbuf_flush+0xba>
+
+0000000000801867 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  801867:	55                   	push   %rbp
+  801868:	48 89 e5             	mov    %rsp,%rbp
+  80186b:	53                   	push   %rbx
+  80186c:	48 83 ec 08          	sub    $0x8,%rsp
+  801870:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  801873:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  80187a:	00 00 00 
+  80187d:	ff d0                	call   *%rax
+  80187f:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  801882:	b8 00 00 00 00       	mov    $0x0,%eax
+  801887:	48 85 f6             	test   %rsi,%rsi
+  80188a:	74 0f                	je     80189b <devfile_sync+0x34>
+  80188c:	48 89 df             	mov    %rbx,%rdi
+  80188f:	48 b8 9d 17 80 00 00 	movabs $0x80179d,%rax
+  801896:	00 00 00 
+  801899:	ff d0                	call   *%rax
+}
+  80189b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80189f:	c9                   	leave
+  8018a0:	c3                   	ret
+
+00000000008018a1 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8018a1:	55                   	push   %rbp
+  8018a2:	48 89 e5             	mov    %rsp,%rbp
+  8018a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8018a9:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8018ac:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8018b3:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8018b4:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8018b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018bd:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8018c4:	00 00 00 
+  8018c7:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  8018ce:	00 00 00 
+  8018d1:	ff d0                	call   *%rax
+}
+  8018d3:	c9                   	leave
+  8018d4:	c3                   	ret
+
+00000000008018d5 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018d5:	55                   	push   %rbp
+  8018d6:	48 89 e5             	mov    %rsp,%rbp
+  8018d9:	41 54                	push   %r12
+  8018db:	53                   	push   %rbx
+  8018dc:	48 89 fb             	mov    %rdi,%rbx
+  8018df:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8018e2:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	78 63                	js     801955 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018f2:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8018f5:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8018fc:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  8018fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801903:	bf 05 00 00 00       	mov    $0x5,%edi
+  801908:	48 b8 a1 18 80 00 00 	movabs $0x8018a1,%rax
+  80190f:	00 00 00 
+  801912:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801914:	85 c0                	test   %eax,%eax
+  801916:	78 3d                	js     801955 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801918:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80191f:	00 00 00 
+  801922:	48 89 de             	mov    %rbx,%rsi
+  801925:	4c 89 e7             	mov    %r12,%rdi
+  801928:	48 b8 f2 39 80 00 00 	movabs $0x8039f2,%rax
+  80192f:	00 00 00 
+  801932:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801934:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80193a:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  801941:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801942:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  801948:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  80194f:	00 
+
+    return 0;
+  801950:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801955:	5b                   	pop    %rbx
+  801956:	41 5c                	pop    %r12
+  801958:	5d                   	pop    %rbp
+  801959:	c3                   	ret
+
+000000000080195a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80195a:	55                   	push   %rbp
+  80195b:	48 89 e5             	mov    %rsp,%rbp
+  80195e:	41 54                	push   %r12
+  801960:	53                   	push   %rbx
+  801961:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  801964:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  80196b:	00 00 00 
+  80196e:	ff d0                	call   *%rax
+  801970:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  801973:	48 89 df             	mov    %rbx,%rdi
+  801976:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  80197d:	00 00 00 
+  801980:	ff d0                	call   *%rax
+  801982:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801986:	76 2e                	jbe    8019b6 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  801988:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80198b:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  801992:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  801994:	be 00 00 00 00       	mov    $0x0,%esi
+  801999:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80199e:	48 b8 a1 18 80 00 00 	movabs $0x8018a1,%rax
+  8019a5:	00 00 00 
+  8019a8:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019aa:	45 85 e4             	test   %r12d,%r12d
+  8019ad:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019b1:	5b                   	pop    %rbx
+  8019b2:	41 5c                	pop    %r12
+  8019b4:	5d                   	pop    %rbp
+  8019b5:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8019b6:	48 89 df             	mov    %rbx,%rdi
+  8019b9:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  8019c0:	00 00 00 
+  8019c3:	ff d0                	call   *%rax
+  8019c5:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8019c9:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8019d0:	00 00 00 
+  8019d3:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8019da:	48 89 df             	mov    %rbx,%rdi
+  8019dd:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  8019e4:	00 00 00 
+  8019e7:	ff d0                	call   *%rax
+  8019e9:	48 89 c6             	mov    %rax,%rsi
+  8019ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019f6:	48 b8 6a 04 80 00 00 	movabs $0x80046a,%rax
+  8019fd:	00 00 00 
+  801a00:	ff d0                	call   *%rax
+  801a02:	eb 84                	jmp    801988 <devfile_flush+0x2e>
+
+0000000000801a04 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801a04:	55                   	push   %rbp
+  801a05:	48 89 e5             	mov    %rsp,%rbp
+  801a08:	41 55                	push   %r13
+  801a0a:	41 54                	push   %r12
+  801a0c:	53                   	push   %rbx
+  801a0d:	48 83 ec 08          	sub    $0x8,%rsp
+  801a11:	48 89 fb             	mov    %rdi,%rbx
+  801a14:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a17:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  801a1e:	00 00 00 
+  801a21:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a23:	48 85 c0             	test   %rax,%rax
+  801a26:	74 51                	je     801a79 <devfile_trunc+0x75>
+  801a28:	49 89 c4             	mov    %rax,%r12
+  801a2b:	48 89 c6             	mov    %rax,%rsi
+  801a2e:	48 89 df             	mov    %rbx,%rdi
+  801a31:	48 b8 9d 17 80 00 00 	movabs $0x80179d,%rax
+  801a38:	00 00 00 
+  801a3b:	ff d0                	call   *%rax
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	78 2d                	js     801a6e <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a41:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a48:	00 00 00 
+  801a4b:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a4e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a50:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a54:	be 00 00 00 00       	mov    $0x0,%esi
+  801a59:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a5e:	48 b8 a1 18 80 00 00 	movabs $0x8018a1,%rax
+  801a65:	00 00 00 
+  801a68:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	79 3e                	jns    801aac <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801a6e:	48 83 c4 08          	add    $0x8,%rsp
+  801a72:	5b                   	pop    %rbx
+  801a73:	41 5c                	pop    %r12
+  801a75:	41 5d                	pop    %r13
+  801a77:	5d                   	pop    %rbp
+  801a78:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a79:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a80:	00 00 00 
+  801a83:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a86:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a88:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a8c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a91:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a96:	48 b8 a1 18 80 00 00 	movabs $0x8018a1,%rax
+  801a9d:	00 00 00 
+  801aa0:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801aa2:	85 c0                	test   %eax,%eax
+  801aa4:	78 c8                	js     801a6e <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801aa6:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801aaa:	eb c2                	jmp    801a6e <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801aac:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801aaf:	8d 51 01             	lea    0x1(%rcx),%edx
+  801ab2:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801ab5:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801aba:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801ac1:	00 00 
+  801ac3:	eb a9                	jmp    801a6e <devfile_trunc+0x6a>
+
+0000000000801ac5 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801ac5:	55                   	push   %rbp
+  801ac6:	48 89 e5             	mov    %rsp,%rbp
+  801ac9:	41 57                	push   %r15
+  801acb:	41 56                	push   %r14
+  801acd:	41 55                	push   %r13
+  801acf:	41 54                	push   %r12
+  801ad1:	53                   	push   %rbx
+  801ad2:	48 83 ec 28          	sub    $0x28,%rsp
+  801ad6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ada:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801ade:	49 89 d7             	mov    %rdx,%r15
+  801ae1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801ae5:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  801aec:	00 00 00 
+  801aef:	ff d0                	call   *%rax
+  801af1:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801af4:	48 85 c0             	test   %rax,%rax
+  801af7:	74 31                	je     801b2a <devfile_write+0x65>
+  801af9:	4c 89 f8             	mov    %r15,%rax
+  801afc:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801b03:	77 25                	ja     801b2a <devfile_write+0x65>
+    size_t i = 0;
+  801b05:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801b0b:	48 85 c0             	test   %rax,%rax
+  801b0e:	0f 85 64 01 00 00    	jne    801c78 <devfile_write+0x1b3>
+    size_t i = 0;
+  801b14:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b18:	4c 89 f8             	mov    %r15,%rax
+}
+  801b1b:	48 83 c4 28          	add    $0x28,%rsp
+  801b1f:	5b                   	pop    %rbx
+  801b20:	41 5c                	pop    %r12
+  801b22:	41 5d                	pop    %r13
+  801b24:	41 5e                	pop    %r14
+  801b26:	41 5f                	pop    %r15
+  801b28:	5d                   	pop    %rbp
+  801b29:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b2a:	48 85 db             	test   %rbx,%rbx
+  801b2d:	74 5b                	je     801b8a <devfile_write+0xc5>
+  801b2f:	48 89 de             	mov    %rbx,%rsi
+  801b32:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b36:	48 b8 9d 17 80 00 00 	movabs $0x80179d,%rax
+  801b3d:	00 00 00 
+  801b40:	ff d0                	call   *%rax
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	78 40                	js     801b86 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b46:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b4a:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801b4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b51:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b55:	48 b8 92 16 80 00 00 	movabs $0x801692,%rax
+  801b5c:	00 00 00 
+  801b5f:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b61:	48 85 c0             	test   %rax,%rax
+  801b64:	7e b5                	jle    801b1b <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801b66:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801b6a:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801b6d:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801b70:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801b73:	8d 51 01             	lea    0x1(%rcx),%edx
+  801b76:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b79:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801b7c:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801b83:	00 
+  801b84:	eb 95                	jmp    801b1b <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b86:	48 98                	cltq
+  801b88:	eb 91                	jmp    801b1b <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b8a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801b8e:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801b91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b95:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b99:	48 89 df             	mov    %rbx,%rdi
+  801b9c:	48 b8 92 16 80 00 00 	movabs $0x801692,%rax
+  801ba3:	00 00 00 
+  801ba6:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801ba8:	48 85 c0             	test   %rax,%rax
+  801bab:	0f 8e 6a ff ff ff    	jle    801b1b <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801bb1:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801bb4:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801bb8:	e9 5e ff ff ff       	jmp    801b1b <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bbd:	48 98                	cltq
+  801bbf:	4d 85 ff             	test   %r15,%r15
+  801bc2:	49 0f 45 c7          	cmovne %r15,%rax
+  801bc6:	e9 50 ff ff ff       	jmp    801b1b <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bcb:	48 89 de             	mov    %rbx,%rsi
+  801bce:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801bd2:	48 b8 9d 17 80 00 00 	movabs $0x80179d,%rax
+  801bd9:	00 00 00 
+  801bdc:	ff d0                	call   *%rax
+  801bde:	85 c0                	test   %eax,%eax
+  801be0:	0f 88 2b 01 00 00    	js     801d11 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801be6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801bea:	4c 01 f8             	add    %r15,%rax
+  801bed:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801bf1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801bf5:	48 b9 a1 0c 80 00 00 	movabs $0x800ca1,%rcx
+  801bfc:	00 00 00 
+  801bff:	ff d1                	call   *%rcx
+  801c01:	48 89 c2             	mov    %rax,%rdx
+  801c04:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c08:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801c0c:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c10:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c15:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c18:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c1f:	00 
+  801c20:	4c 89 ea             	mov    %r13,%rdx
+  801c23:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c27:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  801c2e:	00 00 00 
+  801c31:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c33:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c37:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801c3b:	48 39 c2             	cmp    %rax,%rdx
+  801c3e:	0f 84 db 00 00 00    	je     801d1f <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801c44:	4c 39 e2             	cmp    %r12,%rdx
+  801c47:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801c4b:	4d 01 ec             	add    %r13,%r12
+  801c4e:	49 39 c4             	cmp    %rax,%r12
+  801c51:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801c55:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801c59:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801c5d:	45 01 ee             	add    %r13d,%r14d
+  801c60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c64:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801c68:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801c6b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c6f:	49 39 c7             	cmp    %rax,%r15
+  801c72:	0f 83 a0 fe ff ff    	jae    801b18 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801c78:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c7c:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801c80:	8b 43 08             	mov    0x8(%rbx),%eax
+  801c83:	44 39 f0             	cmp    %r14d,%eax
+  801c86:	7f 10                	jg     801c98 <devfile_write+0x1d3>
+  801c88:	48 98                	cltq
+  801c8a:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801c90:	49 63 d6             	movslq %r14d,%rdx
+  801c93:	48 39 d0             	cmp    %rdx,%rax
+  801c96:	7d 2d                	jge    801cc5 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801c98:	48 89 de             	mov    %rbx,%rsi
+  801c9b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c9f:	48 b8 9d 17 80 00 00 	movabs $0x80179d,%rax
+  801ca6:	00 00 00 
+  801ca9:	ff d0                	call   *%rax
+  801cab:	85 c0                	test   %eax,%eax
+  801cad:	0f 88 0a ff ff ff    	js     801bbd <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801cb3:	44 89 f0             	mov    %r14d,%eax
+  801cb6:	66 b8 00 00          	mov    $0x0,%ax
+  801cba:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801cbd:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801cc4:	00 
+        size_t off = pos - fb->fb_base;
+  801cc5:	45 89 f4             	mov    %r14d,%r12d
+  801cc8:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801ccc:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801ccf:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801cd3:	4d 29 fd             	sub    %r15,%r13
+  801cd6:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801cdb:	4c 29 e0             	sub    %r12,%rax
+  801cde:	49 39 c5             	cmp    %rax,%r13
+  801ce1:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801ce5:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801ce9:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801ced:	48 39 c2             	cmp    %rax,%rdx
+  801cf0:	0f 84 f0 fe ff ff    	je     801be6 <devfile_write+0x121>
+  801cf6:	4c 39 e0             	cmp    %r12,%rax
+  801cf9:	0f 82 cc fe ff ff    	jb     801bcb <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801cff:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d03:	48 39 d0             	cmp    %rdx,%rax
+  801d06:	0f 83 da fe ff ff    	jae    801be6 <devfile_write+0x121>
+  801d0c:	e9 ba fe ff ff       	jmp    801bcb <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d11:	48 98                	cltq
+  801d13:	4d 85 ff             	test   %r15,%r15
+  801d16:	49 0f 45 c7          	cmovne %r15,%rax
+  801d1a:	e9 fc fd ff ff       	jmp    801b1b <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d1f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d23:	4c 89 e2             	mov    %r12,%rdx
+  801d26:	e9 2a ff ff ff       	jmp    801c55 <devfile_write+0x190>
+
+0000000000801d2b <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d2b:	55                   	push   %rbp
+  801d2c:	48 89 e5             	mov    %rsp,%rbp
+  801d2f:	41 57                	push   %r15
+  801d31:	41 56                	push   %r14
+  801d33:	41 55                	push   %r13
+  801d35:	41 54                	push   %r12
+  801d37:	53                   	push   %rbx
+  801d38:	48 83 ec 28          	sub    $0x28,%rsp
+  801d3c:	49 89 ff             	mov    %rdi,%r15
+  801d3f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801d43:	48 89 d3             	mov    %rdx,%rbx
+  801d46:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801d4a:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801d59:	48 85 c0             	test   %rax,%rax
+  801d5c:	74 0d                	je     801d6b <devfile_read+0x40>
+  801d5e:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801d65:	0f 86 1a 01 00 00    	jbe    801e85 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801d6b:	4d 85 e4             	test   %r12,%r12
+  801d6e:	74 1a                	je     801d8a <devfile_read+0x5f>
+  801d70:	4c 89 e6             	mov    %r12,%rsi
+  801d73:	4c 89 ff             	mov    %r15,%rdi
+  801d76:	48 b8 9d 17 80 00 00 	movabs $0x80179d,%rax
+  801d7d:	00 00 00 
+  801d80:	ff d0                	call   *%rax
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	0f 88 e8 00 00 00    	js     801e72 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801d8a:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801d8e:	48 b8 8f 15 80 00 00 	movabs $0x80158f,%rax
+  801d95:	00 00 00 
+  801d98:	ff d0                	call   *%rax
+  801d9a:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801d9d:	48 85 c0             	test   %rax,%rax
+  801da0:	0f 84 69 02 00 00    	je     80200f <devfile_read+0x2e4>
+    while (i < n) {
+  801da6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801dab:	0f 84 ce 00 00 00    	je     801e7f <devfile_read+0x154>
+    size_t i = 0;
+  801db1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801db6:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801dbd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801dc1:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801dc5:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801dc9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801dcd:	48 29 da             	sub    %rbx,%rdx
+  801dd0:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801dd5:	48 39 c2             	cmp    %rax,%rdx
+  801dd8:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801ddc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801de0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801de4:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801de7:	01 d8                	add    %ebx,%eax
+  801de9:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801ded:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801df1:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801df8:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801dff:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801e06:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e11:	4c 89 ee             	mov    %r13,%rsi
+  801e14:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e19:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  801e20:	00 00 00 
+  801e23:	ff d0                	call   *%rax
+        if (res < 0)
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	78 4d                	js     801e76 <devfile_read+0x14b>
+        if (res == 0)
+  801e29:	74 4f                	je     801e7a <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e2b:	4c 63 e0             	movslq %eax,%r12
+  801e2e:	4c 89 e2             	mov    %r12,%rdx
+  801e31:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e35:	4c 89 f7             	mov    %r14,%rdi
+  801e38:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  801e3f:	00 00 00 
+  801e42:	ff d0                	call   *%rax
+        i += res;
+  801e44:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801e47:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801e4a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e4e:	48 39 c3             	cmp    %rax,%rbx
+  801e51:	0f 82 72 ff ff ff    	jb     801dc9 <devfile_read+0x9e>
+    return i;
+  801e57:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801e5a:	48 85 c0             	test   %rax,%rax
+  801e5d:	7e 04                	jle    801e63 <devfile_read+0x138>
+  801e5f:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801e63:	48 83 c4 28          	add    $0x28,%rsp
+  801e67:	5b                   	pop    %rbx
+  801e68:	41 5c                	pop    %r12
+  801e6a:	41 5d                	pop    %r13
+  801e6c:	41 5e                	pop    %r14
+  801e6e:	41 5f                	pop    %r15
+  801e70:	5d                   	pop    %rbp
+  801e71:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801e72:	48 98                	cltq
+  801e74:	eb ed                	jmp    801e63 <devfile_read+0x138>
+            return res;
+  801e76:	48 98                	cltq
+  801e78:	eb e9                	jmp    801e63 <devfile_read+0x138>
+            return i;
+  801e7a:	48 89 d8             	mov    %rbx,%rax
+  801e7d:	eb db                	jmp    801e5a <devfile_read+0x12f>
+    size_t i = 0;
+  801e7f:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801e83:	eb d2                	jmp    801e57 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801e85:	48 89 c6             	mov    %rax,%rsi
+  801e88:	4c 89 ff             	mov    %r15,%rdi
+  801e8b:	48 b8 9d 17 80 00 00 	movabs $0x80179d,%rax
+  801e92:	00 00 00 
+  801e95:	ff d0                	call   *%rax
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	78 40                	js     801edb <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801e9b:	4c 89 ff             	mov    %r15,%rdi
+  801e9e:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  801ea5:	00 00 00 
+  801ea8:	ff d0                	call   *%rax
+  801eaa:	48 89 c2             	mov    %rax,%rdx
+  801ead:	48 c1 e2 04          	shl    $0x4,%rdx
+  801eb1:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801eb5:	48 c1 e0 0c          	shl    $0xc,%rax
+  801eb9:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801ebe:	48 01 d0             	add    %rdx,%rax
+  801ec1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801ec5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801eca:	0f 84 33 01 00 00    	je     802003 <devfile_read+0x2d8>
+    size_t i = 0;
+  801ed0:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801ed6:	e9 f5 00 00 00       	jmp    801fd0 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801edb:	48 98                	cltq
+  801edd:	eb 84                	jmp    801e63 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801edf:	44 89 e8             	mov    %r13d,%eax
+  801ee2:	66 b8 00 00          	mov    $0x0,%ax
+  801ee6:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801eeb:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801ef2:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801ef4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801ef8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801efc:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801efe:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801f03:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801f06:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801f0d:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801f0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f19:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f1e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f23:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  801f2a:	00 00 00 
+  801f2d:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f2f:	85 c0                	test   %eax,%eax
+  801f31:	0f 88 be 00 00 00    	js     801ff5 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f37:	48 63 d0             	movslq %eax,%rdx
+  801f3a:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801f3f:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801f44:	44 39 e8             	cmp    %r13d,%eax
+  801f47:	0f 8e ba 00 00 00    	jle    802007 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801f4d:	49 63 c5             	movslq %r13d,%rax
+  801f50:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801f55:	48 29 c3             	sub    %rax,%rbx
+  801f58:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801f5d:	48 01 c3             	add    %rax,%rbx
+  801f60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f64:	4c 29 f0             	sub    %r14,%rax
+  801f67:	48 39 c3             	cmp    %rax,%rbx
+  801f6a:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801f6e:	4c 89 ff             	mov    %r15,%rdi
+  801f71:	48 b9 a1 0c 80 00 00 	movabs $0x800ca1,%rcx
+  801f78:	00 00 00 
+  801f7b:	ff d1                	call   *%rcx
+  801f7d:	48 89 c2             	mov    %rax,%rdx
+  801f80:	48 c1 e2 04          	shl    $0x4,%rdx
+  801f84:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801f88:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f8c:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801f91:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801f94:	44 89 ea             	mov    %r13d,%edx
+  801f97:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  801f9c:	48 63 d2             	movslq %edx,%rdx
+  801f9f:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801fa6:	00 
+  801fa7:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801fab:	4c 01 f7             	add    %r14,%rdi
+  801fae:	48 89 da             	mov    %rbx,%rdx
+  801fb1:	48 b9 e7 3d 80 00 00 	movabs $0x803de7,%rcx
+  801fb8:	00 00 00 
+  801fbb:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  801fbd:	41 01 dd             	add    %ebx,%r13d
+  801fc0:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  801fc4:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  801fc7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fcb:	49 39 c6             	cmp    %rax,%r14
+  801fce:	73 37                	jae    802007 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  801fd0:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  801fd4:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801fd9:	44 39 e8             	cmp    %r13d,%eax
+  801fdc:	0f 8f fd fe ff ff    	jg     801edf <devfile_read+0x1b4>
+  801fe2:	41 03 44 24 10       	add    0x10(%r12),%eax
+  801fe7:	44 39 e8             	cmp    %r13d,%eax
+  801fea:	0f 8f 5d ff ff ff    	jg     801f4d <devfile_read+0x222>
+  801ff0:	e9 ea fe ff ff       	jmp    801edf <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  801ff5:	48 98                	cltq
+  801ff7:	4d 85 f6             	test   %r14,%r14
+  801ffa:	49 0f 45 c6          	cmovne %r14,%rax
+  801ffe:	e9 60 fe ff ff       	jmp    801e63 <devfile_read+0x138>
+    size_t i = 0;
+  802003:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  802007:	4c 89 f0             	mov    %r14,%rax
+  80200a:	e9 54 fe ff ff       	jmp    801e63 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80200f:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802016:	e9 48 fe ff ff       	jmp    801e63 <devfile_read+0x138>
+
+000000000080201b <open>:
+open(const char *path, int mode) {
+  80201b:	55                   	push   %rbp
+  80201c:	48 89 e5             	mov    %rsp,%rbp
+  80201f:	41 55                	push   %r13
+  802021:	41 54                	push   %r12
+  802023:	53                   	push   %rbx
+  802024:	48 83 ec 18          	sub    $0x18,%rsp
+  802028:	49 89 fc             	mov    %rdi,%r12
+  80202b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80202e:	48 b8 b4 39 80 00 00 	movabs $0x8039b4,%rax
+  802035:	00 00 00 
+  802038:	ff d0                	call   *%rax
+  80203a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802040:	0f 87 8a 00 00 00    	ja     8020d0 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802046:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80204a:	48 b8 cf 0c 80 00 00 	movabs $0x800ccf,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+  802056:	89 c3                	mov    %eax,%ebx
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	78 50                	js     8020ac <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80205c:	4c 89 e6             	mov    %r12,%rsi
+  80205f:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802066:	00 00 00 
+  802069:	48 89 df             	mov    %rbx,%rdi
+  80206c:	48 b8 f2 39 80 00 00 	movabs $0x8039f2,%rax
+  802073:	00 00 00 
+  802076:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802078:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80207f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802083:	bf 01 00 00 00       	mov    $0x1,%edi
+  802088:	48 b8 a1 18 80 00 00 	movabs $0x8018a1,%rax
+  80208f:	00 00 00 
+  802092:	ff d0                	call   *%rax
+  802094:	89 c3                	mov    %eax,%ebx
+  802096:	85 c0                	test   %eax,%eax
+  802098:	78 1f                	js     8020b9 <open+0x9e>
+    return fd2num(fd);
+  80209a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80209e:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  8020a5:	00 00 00 
+  8020a8:	ff d0                	call   *%rax
+  8020aa:	89 c3                	mov    %eax,%ebx
+}
+  8020ac:	89 d8                	mov    %ebx,%eax
+  8020ae:	48 83 c4 18          	add    $0x18,%rsp
+  8020b2:	5b                   	pop    %rbx
+  8020b3:	41 5c                	pop    %r12
+  8020b5:	41 5d                	pop    %r13
+  8020b7:	5d                   	pop    %rbp
+  8020b8:	c3                   	ret
+        fd_close(fd, 0);
+  8020b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020be:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020c2:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  8020c9:	00 00 00 
+  8020cc:	ff d0                	call   *%rax
+        return res;
+  8020ce:	eb dc                	jmp    8020ac <open+0x91>
+        return -E_BAD_PATH;
+  8020d0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020d5:	eb d5                	jmp    8020ac <open+0x91>
+
+00000000008020d7 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8020d7:	55                   	push   %rbp
+  8020d8:	48 89 e5             	mov    %rsp,%rbp
+  8020db:	41 57                	push   %r15
+  8020dd:	41 56                	push   %r14
+  8020df:	41 55                	push   %r13
+  8020e1:	41 54                	push   %r12
+  8020e3:	53                   	push   %rbx
+  8020e4:	48 83 ec 18          	sub    $0x18,%rsp
+  8020e8:	41 89 f6             	mov    %esi,%r14d
+  8020eb:	49 89 d7             	mov    %rdx,%r15
+  8020ee:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020f1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8020f5:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  8020fc:	00 00 00 
+  8020ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802101:	85 c0                	test   %eax,%eax
+  802103:	0f 88 db 00 00 00    	js     8021e4 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802109:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80210d:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802114:	00 00 00 
+  802117:	8b 00                	mov    (%rax),%eax
+  802119:	39 07                	cmp    %eax,(%rdi)
+  80211b:	0f 85 db 00 00 00    	jne    8021fc <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802121:	45 85 f6             	test   %r14d,%r14d
+  802124:	0f 88 db 00 00 00    	js     802205 <fmap+0x12e>
+  80212a:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802131:	0f 85 d7 00 00 00    	jne    80220e <fmap+0x137>
+  802137:	4c 89 fb             	mov    %r15,%rbx
+  80213a:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802140:	0f 85 d1 00 00 00    	jne    802217 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802146:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  80214d:	00 00 00 
+  802150:	ff d0                	call   *%rax
+  802152:	85 c0                	test   %eax,%eax
+  802154:	0f 88 8e 00 00 00    	js     8021e8 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80215a:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  802161:	00 00 00 
+    while (i < n) {
+  802164:	4d 85 ed             	test   %r13,%r13
+  802167:	0f 84 8a 00 00 00    	je     8021f7 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80216d:	4c 89 ea             	mov    %r13,%rdx
+  802170:	48 29 da             	sub    %rbx,%rdx
+  802173:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80217a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802180:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802184:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802188:	8b 40 0c             	mov    0xc(%rax),%eax
+  80218b:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80218f:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  802193:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  802198:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80219d:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8021a1:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8021a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021aa:	4c 89 e6             	mov    %r12,%rsi
+  8021ad:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021b2:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  8021b9:	00 00 00 
+  8021bc:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021be:	85 c0                	test   %eax,%eax
+  8021c0:	78 2a                	js     8021ec <fmap+0x115>
+        i += res;
+  8021c2:	48 98                	cltq
+  8021c4:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8021c7:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8021cb:	72 05                	jb     8021d2 <fmap+0xfb>
+    while (i < n) {
+  8021cd:	4c 39 eb             	cmp    %r13,%rbx
+  8021d0:	72 9b                	jb     80216d <fmap+0x96>
+    }
+    return i;
+  8021d2:	48 89 d8             	mov    %rbx,%rax
+}
+  8021d5:	48 83 c4 18          	add    $0x18,%rsp
+  8021d9:	5b                   	pop    %rbx
+  8021da:	41 5c                	pop    %r12
+  8021dc:	41 5d                	pop    %r13
+  8021de:	41 5e                	pop    %r14
+  8021e0:	41 5f                	pop    %r15
+  8021e2:	5d                   	pop    %rbp
+  8021e3:	c3                   	ret
+    if (res < 0) return res;
+  8021e4:	48 98                	cltq
+  8021e6:	eb ed                	jmp    8021d5 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8021e8:	48 98                	cltq
+  8021ea:	eb e9                	jmp    8021d5 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021ec:	48 98                	cltq
+  8021ee:	48 85 db             	test   %rbx,%rbx
+  8021f1:	48 0f 45 c3          	cmovne %rbx,%rax
+  8021f5:	eb de                	jmp    8021d5 <fmap+0xfe>
+    size_t i = 0;
+  8021f7:	4c 89 eb             	mov    %r13,%rbx
+  8021fa:	eb d6                	jmp    8021d2 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8021fc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802203:	eb d0                	jmp    8021d5 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802205:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80220c:	eb c7                	jmp    8021d5 <fmap+0xfe>
+  80220e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802215:	eb be                	jmp    8021d5 <fmap+0xfe>
+  802217:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80221e:	eb b5                	jmp    8021d5 <fmap+0xfe>
+
+0000000000802220 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  802220:	55                   	push   %rbp
+  802221:	48 89 e5             	mov    %rsp,%rbp
+  802224:	41 56                	push   %r14
+  802226:	41 55                	push   %r13
+  802228:	41 54                	push   %r12
+  80222a:	53                   	push   %rbx
+  80222b:	48 83 ec 10          	sub    $0x10,%rsp
+  80222f:	89 fb                	mov    %edi,%ebx
+  802231:	41 89 f4             	mov    %esi,%r12d
+  802234:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802237:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80223b:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  802242:	00 00 00 
+  802245:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802247:	85 c0                	test   %eax,%eax
+  802249:	78 63                	js     8022ae <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80224b:	45 85 e4             	test   %r12d,%r12d
+  80224e:	0f 88 80 00 00 00    	js     8022d4 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  802254:	45 89 e6             	mov    %r12d,%r14d
+  802257:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80225e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802262:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  802269:	00 00 00 
+  80226c:	ff d0                	call   *%rax
+  80226e:	48 89 c2             	mov    %rax,%rdx
+  802271:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802276:	44 89 f6             	mov    %r14d,%esi
+  802279:	89 df                	mov    %ebx,%edi
+  80227b:	48 b8 d7 20 80 00 00 	movabs $0x8020d7,%rax
+  802282:	00 00 00 
+  802285:	ff d0                	call   *%rax
+  802287:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80228a:	45 29 f4             	sub    %r14d,%r12d
+  80228d:	4d 63 f4             	movslq %r12d,%r14
+  802290:	49 39 c6             	cmp    %rax,%r14
+  802293:	7c 1d                	jl     8022b2 <read_map+0x92>
+  802295:	48 85 c0             	test   %rax,%rax
+  802298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229d:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8022a1:	48 83 c4 10          	add    $0x10,%rsp
+  8022a5:	5b                   	pop    %rbx
+  8022a6:	41 5c                	pop    %r12
+  8022a8:	41 5d                	pop    %r13
+  8022aa:	41 5e                	pop    %r14
+  8022ac:	5d                   	pop    %rbp
+  8022ad:	c3                   	ret
+    if (res < 0) return res;
+  8022ae:	48 98                	cltq
+  8022b0:	eb ef                	jmp    8022a1 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8022b2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022b6:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  8022bd:	00 00 00 
+  8022c0:	ff d0                	call   *%rax
+  8022c2:	4d 63 e4             	movslq %r12d,%r12
+  8022c5:	4c 01 e0             	add    %r12,%rax
+  8022c8:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8022cc:	48 89 d8             	mov    %rbx,%rax
+  8022cf:	4c 29 f0             	sub    %r14,%rax
+  8022d2:	eb cd                	jmp    8022a1 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8022d4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022db:	eb c4                	jmp    8022a1 <read_map+0x81>
+
+00000000008022dd <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8022dd:	55                   	push   %rbp
+  8022de:	48 89 e5             	mov    %rsp,%rbp
+  8022e1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022e5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022e9:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  8022f0:	00 00 00 
+  8022f3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022f5:	85 c0                	test   %eax,%eax
+  8022f7:	78 4a                	js     802343 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8022f9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8022fd:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802304:	00 00 00 
+  802307:	8b 00                	mov    (%rax),%eax
+  802309:	39 07                	cmp    %eax,(%rdi)
+  80230b:	75 38                	jne    802345 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80230d:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  802314:	00 00 00 
+  802317:	ff d0                	call   *%rax
+  802319:	85 c0                	test   %eax,%eax
+  80231b:	78 26                	js     802343 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80231d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802321:	8b 40 0c             	mov    0xc(%rax),%eax
+  802324:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80232b:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80232d:	be 00 00 00 00       	mov    $0x0,%esi
+  802332:	bf 06 00 00 00       	mov    $0x6,%edi
+  802337:	48 b8 a1 18 80 00 00 	movabs $0x8018a1,%rax
+  80233e:	00 00 00 
+  802341:	ff d0                	call   *%rax
+}
+  802343:	c9                   	leave
+  802344:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802345:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80234a:	eb f7                	jmp    802343 <fsync+0x66>
+
+000000000080234c <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80234c:	55                   	push   %rbp
+  80234d:	48 89 e5             	mov    %rsp,%rbp
+  802350:	41 57                	push   %r15
+  802352:	41 56                	push   %r14
+  802354:	41 55                	push   %r13
+  802356:	41 54                	push   %r12
+  802358:	53                   	push   %rbx
+  802359:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80235d:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  802364:	00 00 00 
+  802367:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80236c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802372:	49 bd 2f 0d 80 00 00 	movabs $0x800d2f,%r13
+  802379:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80237c:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  802383:	00 00 00 
+  802386:	eb 0c                	jmp    802394 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  802388:	83 c3 01             	add    $0x1,%ebx
+  80238b:	49 83 c4 28          	add    $0x28,%r12
+  80238f:	83 fb 20             	cmp    $0x20,%ebx
+  802392:	74 33                	je     8023c7 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802394:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  802399:	74 ed                	je     802388 <flushall+0x3c>
+  80239b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80239f:	89 df                	mov    %ebx,%edi
+  8023a1:	41 ff d5             	call   *%r13
+  8023a4:	85 c0                	test   %eax,%eax
+  8023a6:	78 e0                	js     802388 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8023a8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023ac:	41 8b 06             	mov    (%r14),%eax
+  8023af:	39 07                	cmp    %eax,(%rdi)
+  8023b1:	75 d5                	jne    802388 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8023b3:	48 b8 67 18 80 00 00 	movabs $0x801867,%rax
+  8023ba:	00 00 00 
+  8023bd:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8023bf:	85 c0                	test   %eax,%eax
+  8023c1:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8023c5:	eb c1                	jmp    802388 <flushall+0x3c>
+    }
+    return res;
+}
+  8023c7:	44 89 f8             	mov    %r15d,%eax
+  8023ca:	48 83 c4 18          	add    $0x18,%rsp
+  8023ce:	5b                   	pop    %rbx
+  8023cf:	41 5c                	pop    %r12
+  8023d1:	41 5d                	pop    %r13
+  8023d3:	41 5e                	pop    %r14
+  8023d5:	41 5f                	pop    %r15
+  8023d7:	5d                   	pop    %rbp
+  8023d8:	c3                   	ret
+
+00000000008023d9 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8023d9:	55                   	push   %rbp
+  8023da:	48 89 e5             	mov    %rsp,%rbp
+  8023dd:	53                   	push   %rbx
+  8023de:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e2:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8023e5:	40 0f b6 c6          	movzbl %sil,%eax
+  8023e9:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8023f0:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8023f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8023fc:	48 b8 a1 18 80 00 00 	movabs $0x8018a1,%rax
+  802403:	00 00 00 
+  802406:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802408:	85 c0                	test   %eax,%eax
+  80240a:	78 23                	js     80242f <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80240c:	ba 58 06 00 00       	mov    $0x658,%edx
+  802411:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802418:	00 00 00 
+  80241b:	48 89 df             	mov    %rbx,%rdi
+  80241e:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  802425:	00 00 00 
+  802428:	ff d0                	call   *%rax
+    return 0;
+  80242a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80242f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802433:	c9                   	leave
+  802434:	c3                   	ret
+
+0000000000802435 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  802435:	55                   	push   %rbp
+  802436:	48 89 e5             	mov    %rsp,%rbp
+  802439:	53                   	push   %rbx
+  80243a:	48 83 ec 08          	sub    $0x8,%rsp
+  80243e:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  802441:	48 b8 b4 39 80 00 00 	movabs $0x8039b4,%rax
+  802448:	00 00 00 
+  80244b:	ff d0                	call   *%rax
+  80244d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802453:	77 35                	ja     80248a <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  802455:	48 89 de             	mov    %rbx,%rsi
+  802458:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80245f:	00 00 00 
+  802462:	48 b8 f2 39 80 00 00 	movabs $0x8039f2,%rax
+  802469:	00 00 00 
+  80246c:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80246e:	be 00 00 00 00       	mov    $0x0,%esi
+  802473:	bf 07 00 00 00       	mov    $0x7,%edi
+  802478:	48 b8 a1 18 80 00 00 	movabs $0x8018a1,%rax
+  80247f:	00 00 00 
+  802482:	ff d0                	call   *%rax
+}
+  802484:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802488:	c9                   	leave
+  802489:	c3                   	ret
+        return -E_BAD_PATH;
+  80248a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80248f:	eb f3                	jmp    802484 <remove+0x4f>
+
+0000000000802491 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802491:	55                   	push   %rbp
+  802492:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  802495:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  80249c:	00 00 00 
+  80249f:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024ab:	48 b8 a1 18 80 00 00 	movabs $0x8018a1,%rax
+  8024b2:	00 00 00 
+  8024b5:	ff d0                	call   *%rax
+}
+  8024b7:	5d                   	pop    %rbp
+  8024b8:	c3                   	ret
+
+00000000008024b9 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024b9:	55                   	push   %rbp
+  8024ba:	48 89 e5             	mov    %rsp,%rbp
+  8024bd:	41 54                	push   %r12
+  8024bf:	53                   	push   %rbx
+  8024c0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024c3:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  8024ca:	00 00 00 
+  8024cd:	ff d0                	call   *%rax
+  8024cf:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024d2:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  8024d9:	00 00 00 
+  8024dc:	48 89 df             	mov    %rbx,%rdi
+  8024df:	48 b8 f2 39 80 00 00 	movabs $0x8039f2,%rax
+  8024e6:	00 00 00 
+  8024e9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024eb:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024f0:	41 2b 04 24          	sub    (%r12),%eax
+  8024f4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024fa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802501:	00 00 00 
+    stat->st_dev = &devpipe;
+  802504:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80250b:	00 00 00 
+  80250e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80251a:	5b                   	pop    %rbx
+  80251b:	41 5c                	pop    %r12
+  80251d:	5d                   	pop    %rbp
+  80251e:	c3                   	ret
+
+000000000080251f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80251f:	55                   	push   %rbp
+  802520:	48 89 e5             	mov    %rsp,%rbp
+  802523:	41 54                	push   %r12
+  802525:	53                   	push   %rbx
+  802526:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802529:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80252e:	48 89 fe             	mov    %rdi,%rsi
+  802531:	bf 00 00 00 00       	mov    $0x0,%edi
+  802536:	49 bc 6a 04 80 00 00 	movabs $0x80046a,%r12
+  80253d:	00 00 00 
+  802540:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802543:	48 89 df             	mov    %rbx,%rdi
+  802546:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  80254d:	00 00 00 
+  802550:	ff d0                	call   *%rax
+  802552:	48 89 c6             	mov    %rax,%rsi
+  802555:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80255a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80255f:	41 ff d4             	call   *%r12
+}
+  802562:	5b                   	pop    %rbx
+  802563:	41 5c                	pop    %r12
+  802565:	5d                   	pop    %rbp
+  802566:	c3                   	ret
+
+0000000000802567 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802567:	55                   	push   %rbp
+  802568:	48 89 e5             	mov    %rsp,%rbp
+  80256b:	41 57                	push   %r15
+  80256d:	41 56                	push   %r14
+  80256f:	41 55                	push   %r13
+  802571:	41 54                	push   %r12
+  802573:	53                   	push   %rbx
+  802574:	48 83 ec 18          	sub    $0x18,%rsp
+  802578:	49 89 fc             	mov    %rdi,%r12
+  80257b:	49 89 f5             	mov    %rsi,%r13
+  80257e:	49 89 d7             	mov    %rdx,%r15
+  802581:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802585:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  80258c:	00 00 00 
+  80258f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802591:	4d 85 ff             	test   %r15,%r15
+  802594:	0f 84 af 00 00 00    	je     802649 <devpipe_write+0xe2>
+  80259a:	48 89 c3             	mov    %rax,%rbx
+  80259d:	4c 89 f8             	mov    %r15,%rax
+  8025a0:	4d 89 ef             	mov    %r13,%r15
+  8025a3:	4c 01 e8             	add    %r13,%rax
+  8025a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025aa:	49 bd 5f 02 80 00 00 	movabs $0x80025f,%r13
+  8025b1:	00 00 00 
+            sys_yield();
+  8025b4:	49 be fc 01 80 00 00 	movabs $0x8001fc,%r14
+  8025bb:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025be:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025c1:	48 63 ce             	movslq %esi,%rcx
+  8025c4:	48 63 03             	movslq (%rbx),%rax
+  8025c7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025cd:	48 39 c1             	cmp    %rax,%rcx
+  8025d0:	72 2e                	jb     802600 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025d2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025d7:	48 89 da             	mov    %rbx,%rdx
+  8025da:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025df:	4c 89 e7             	mov    %r12,%rdi
+  8025e2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025e5:	85 c0                	test   %eax,%eax
+  8025e7:	74 66                	je     80264f <devpipe_write+0xe8>
+            sys_yield();
+  8025e9:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025ec:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025ef:	48 63 ce             	movslq %esi,%rcx
+  8025f2:	48 63 03             	movslq (%rbx),%rax
+  8025f5:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025fb:	48 39 c1             	cmp    %rax,%rcx
+  8025fe:	73 d2                	jae    8025d2 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802600:	41 0f b6 3f          	movzbl (%r15),%edi
+  802604:	48 89 ca             	mov    %rcx,%rdx
+  802607:	48 c1 ea 03          	shr    $0x3,%rdx
+  80260b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802612:	08 10 20 
+  802615:	48 f7 e2             	mul    %rdx
+  802618:	48 c1 ea 06          	shr    $0x6,%rdx
+  80261c:	48 89 d0             	mov    %rdx,%rax
+  80261f:	48 c1 e0 09          	shl    $0x9,%rax
+  802623:	48 29 d0             	sub    %rdx,%rax
+  802626:	48 c1 e0 03          	shl    $0x3,%rax
+  80262a:	48 29 c1             	sub    %rax,%rcx
+  80262d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802632:	83 c6 01             	add    $0x1,%esi
+  802635:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802638:	49 83 c7 01          	add    $0x1,%r15
+  80263c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802640:	49 39 c7             	cmp    %rax,%r15
+  802643:	0f 85 75 ff ff ff    	jne    8025be <devpipe_write+0x57>
+    return n;
+  802649:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80264d:	eb 05                	jmp    802654 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80264f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802654:	48 83 c4 18          	add    $0x18,%rsp
+  802658:	5b                   	pop    %rbx
+  802659:	41 5c                	pop    %r12
+  80265b:	41 5d                	pop    %r13
+  80265d:	41 5e                	pop    %r14
+  80265f:	41 5f                	pop    %r15
+  802661:	5d                   	pop    %rbp
+  802662:	c3                   	ret
+
+0000000000802663 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802663:	55                   	push   %rbp
+  802664:	48 89 e5             	mov    %rsp,%rbp
+  802667:	41 57                	push   %r15
+  802669:	41 56                	push   %r14
+  80266b:	41 55                	push   %r13
+  80266d:	41 54                	push   %r12
+  80266f:	53                   	push   %rbx
+  802670:	48 83 ec 18          	sub    $0x18,%rsp
+  802674:	49 89 fc             	mov    %rdi,%r12
+  802677:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80267b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80267f:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  802686:	00 00 00 
+  802689:	ff d0                	call   *%rax
+  80268b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80268e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802694:	49 bd 5f 02 80 00 00 	movabs $0x80025f,%r13
+  80269b:	00 00 00 
+            sys_yield();
+  80269e:	49 be fc 01 80 00 00 	movabs $0x8001fc,%r14
+  8026a5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026a8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026ad:	74 7d                	je     80272c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026af:	8b 03                	mov    (%rbx),%eax
+  8026b1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026b4:	75 26                	jne    8026dc <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026b6:	4d 85 ff             	test   %r15,%r15
+  8026b9:	75 77                	jne    802732 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026bb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026c0:	48 89 da             	mov    %rbx,%rdx
+  8026c3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026c8:	4c 89 e7             	mov    %r12,%rdi
+  8026cb:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026ce:	85 c0                	test   %eax,%eax
+  8026d0:	74 72                	je     802744 <devpipe_read+0xe1>
+            sys_yield();
+  8026d2:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026d5:	8b 03                	mov    (%rbx),%eax
+  8026d7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026da:	74 df                	je     8026bb <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026dc:	48 63 c8             	movslq %eax,%rcx
+  8026df:	48 89 ca             	mov    %rcx,%rdx
+  8026e2:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026e6:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026ed:	08 10 20 
+  8026f0:	48 89 d0             	mov    %rdx,%rax
+  8026f3:	48 f7 e6             	mul    %rsi
+  8026f6:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026fa:	48 89 d0             	mov    %rdx,%rax
+  8026fd:	48 c1 e0 09          	shl    $0x9,%rax
+  802701:	48 29 d0             	sub    %rdx,%rax
+  802704:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80270b:	00 
+  80270c:	48 89 c8             	mov    %rcx,%rax
+  80270f:	48 29 d0             	sub    %rdx,%rax
+  802712:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802717:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80271b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80271f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802722:	49 83 c7 01          	add    $0x1,%r15
+  802726:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80272a:	75 83                	jne    8026af <devpipe_read+0x4c>
+    return n;
+  80272c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802730:	eb 03                	jmp    802735 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802732:	4c 89 f8             	mov    %r15,%rax
+}
+  802735:	48 83 c4 18          	add    $0x18,%rsp
+  802739:	5b                   	pop    %rbx
+  80273a:	41 5c                	pop    %r12
+  80273c:	41 5d                	pop    %r13
+  80273e:	41 5e                	pop    %r14
+  802740:	41 5f                	pop    %r15
+  802742:	5d                   	pop    %rbp
+  802743:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802744:	b8 00 00 00 00       	mov    $0x0,%eax
+  802749:	eb ea                	jmp    802735 <devpipe_read+0xd2>
+
+000000000080274b <pipe>:
+pipe(int pfd[2]) {
+  80274b:	55                   	push   %rbp
+  80274c:	48 89 e5             	mov    %rsp,%rbp
+  80274f:	41 55                	push   %r13
+  802751:	41 54                	push   %r12
+  802753:	53                   	push   %rbx
+  802754:	48 83 ec 18          	sub    $0x18,%rsp
+  802758:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80275b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80275f:	48 b8 cf 0c 80 00 00 	movabs $0x800ccf,%rax
+  802766:	00 00 00 
+  802769:	ff d0                	call   *%rax
+  80276b:	89 c3                	mov    %eax,%ebx
+  80276d:	85 c0                	test   %eax,%eax
+  80276f:	0f 88 a0 01 00 00    	js     802915 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802775:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80277a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80277f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802783:	bf 00 00 00 00       	mov    $0x0,%edi
+  802788:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  80278f:	00 00 00 
+  802792:	ff d0                	call   *%rax
+  802794:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802796:	85 c0                	test   %eax,%eax
+  802798:	0f 88 77 01 00 00    	js     802915 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80279e:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8027a2:	48 b8 cf 0c 80 00 00 	movabs $0x800ccf,%rax
+  8027a9:	00 00 00 
+  8027ac:	ff d0                	call   *%rax
+  8027ae:	89 c3                	mov    %eax,%ebx
+  8027b0:	85 c0                	test   %eax,%eax
+  8027b2:	0f 88 43 01 00 00    	js     8028fb <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027b8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027c2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027cb:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  8027d2:	00 00 00 
+  8027d5:	ff d0                	call   *%rax
+  8027d7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027d9:	85 c0                	test   %eax,%eax
+  8027db:	0f 88 1a 01 00 00    	js     8028fb <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027e1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027e5:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  8027ec:	00 00 00 
+  8027ef:	ff d0                	call   *%rax
+  8027f1:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027f4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027fe:	48 89 c6             	mov    %rax,%rsi
+  802801:	bf 00 00 00 00       	mov    $0x0,%edi
+  802806:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  80280d:	00 00 00 
+  802810:	ff d0                	call   *%rax
+  802812:	89 c3                	mov    %eax,%ebx
+  802814:	85 c0                	test   %eax,%eax
+  802816:	0f 88 c5 00 00 00    	js     8028e1 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80281c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802820:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  802827:	00 00 00 
+  80282a:	ff d0                	call   *%rax
+  80282c:	48 89 c1             	mov    %rax,%rcx
+  80282f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802835:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80283b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802840:	4c 89 ee             	mov    %r13,%rsi
+  802843:	bf 00 00 00 00       	mov    $0x0,%edi
+  802848:	48 b8 f2 02 80 00 00 	movabs $0x8002f2,%rax
+  80284f:	00 00 00 
+  802852:	ff d0                	call   *%rax
+  802854:	89 c3                	mov    %eax,%ebx
+  802856:	85 c0                	test   %eax,%eax
+  802858:	78 6e                	js     8028c8 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80285a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80285f:	4c 89 ef             	mov    %r13,%rdi
+  802862:	48 b8 2d 02 80 00 00 	movabs $0x80022d,%rax
+  802869:	00 00 00 
+  80286c:	ff d0                	call   *%rax
+  80286e:	83 f8 02             	cmp    $0x2,%eax
+  802871:	0f 85 ab 00 00 00    	jne    802922 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802877:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80287e:	00 00 
+  802880:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802884:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802886:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80288a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802891:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802895:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802897:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80289b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028a2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028a6:	48 bb a1 0c 80 00 00 	movabs $0x800ca1,%rbx
+  8028ad:	00 00 00 
+  8028b0:	ff d3                	call   *%rbx
+  8028b2:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028b6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028ba:	ff d3                	call   *%rbx
+  8028bc:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028c6:	eb 4d                	jmp    802915 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8028c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028cd:	4c 89 ee             	mov    %r13,%rsi
+  8028d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d5:	48 b8 6a 04 80 00 00 	movabs $0x80046a,%rax
+  8028dc:	00 00 00 
+  8028df:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028e6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ef:	48 b8 6a 04 80 00 00 	movabs $0x80046a,%rax
+  8028f6:	00 00 00 
+  8028f9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8028fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802900:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802904:	bf 00 00 00 00       	mov    $0x0,%edi
+  802909:	48 b8 6a 04 80 00 00 	movabs $0x80046a,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+}
+  802915:	89 d8                	mov    %ebx,%eax
+  802917:	48 83 c4 18          	add    $0x18,%rsp
+  80291b:	5b                   	pop    %rbx
+  80291c:	41 5c                	pop    %r12
+  80291e:	41 5d                	pop    %r13
+  802920:	5d                   	pop    %rbp
+  802921:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802922:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  802929:	00 00 00 
+  80292c:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  802933:	00 00 00 
+  802936:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80293b:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  802942:	00 00 00 
+  802945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294a:	49 b8 2a 2f 80 00 00 	movabs $0x802f2a,%r8
+  802951:	00 00 00 
+  802954:	41 ff d0             	call   *%r8
+
+0000000000802957 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802957:	55                   	push   %rbp
+  802958:	48 89 e5             	mov    %rsp,%rbp
+  80295b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80295f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802963:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  80296a:	00 00 00 
+  80296d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80296f:	85 c0                	test   %eax,%eax
+  802971:	78 35                	js     8029a8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802973:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802977:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  80297e:	00 00 00 
+  802981:	ff d0                	call   *%rax
+  802983:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802986:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80298b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802990:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802994:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  80299b:	00 00 00 
+  80299e:	ff d0                	call   *%rax
+  8029a0:	85 c0                	test   %eax,%eax
+  8029a2:	0f 94 c0             	sete   %al
+  8029a5:	0f b6 c0             	movzbl %al,%eax
+}
+  8029a8:	c9                   	leave
+  8029a9:	c3                   	ret
+
+00000000008029aa <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029aa:	48 89 f8             	mov    %rdi,%rax
+  8029ad:	48 c1 e8 27          	shr    $0x27,%rax
+  8029b1:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8029b8:	7f 00 00 
+  8029bb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029bf:	f6 c2 01             	test   $0x1,%dl
+  8029c2:	74 6d                	je     802a31 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029c4:	48 89 f8             	mov    %rdi,%rax
+  8029c7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029cb:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029d2:	7f 00 00 
+  8029d5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029d9:	f6 c2 01             	test   $0x1,%dl
+  8029dc:	74 62                	je     802a40 <get_uvpt_entry+0x96>
+  8029de:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029e5:	7f 00 00 
+  8029e8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ec:	f6 c2 80             	test   $0x80,%dl
+  8029ef:	75 4f                	jne    802a40 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029f1:	48 89 f8             	mov    %rdi,%rax
+  8029f4:	48 c1 e8 15          	shr    $0x15,%rax
+  8029f8:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8029ff:	7f 00 00 
+  802a02:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a06:	f6 c2 01             	test   $0x1,%dl
+  802a09:	74 44                	je     802a4f <get_uvpt_entry+0xa5>
+  802a0b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a12:	7f 00 00 
+  802a15:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a19:	f6 c2 80             	test   $0x80,%dl
+  802a1c:	75 31                	jne    802a4f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a1e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a22:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a29:	7f 00 00 
+  802a2c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a30:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a31:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a38:	7f 00 00 
+  802a3b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a3f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a40:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a47:	7f 00 00 
+  802a4a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a4e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a4f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a56:	7f 00 00 
+  802a59:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a5d:	c3                   	ret
+
+0000000000802a5e <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802a5e:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a61:	48 89 f9             	mov    %rdi,%rcx
+  802a64:	48 c1 e9 27          	shr    $0x27,%rcx
+  802a68:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802a6f:	7f 00 00 
+  802a72:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802a76:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a7d:	f6 c1 01             	test   $0x1,%cl
+  802a80:	0f 84 b2 00 00 00    	je     802b38 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a86:	48 89 f9             	mov    %rdi,%rcx
+  802a89:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802a8d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802a94:	7f 00 00 
+  802a97:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802a9b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802aa2:	40 f6 c6 01          	test   $0x1,%sil
+  802aa6:	0f 84 8c 00 00 00    	je     802b38 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802aac:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802ab3:	7f 00 00 
+  802ab6:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802aba:	a8 80                	test   $0x80,%al
+  802abc:	75 7b                	jne    802b39 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802abe:	48 89 f9             	mov    %rdi,%rcx
+  802ac1:	48 c1 e9 15          	shr    $0x15,%rcx
+  802ac5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802acc:	7f 00 00 
+  802acf:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802ad3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ada:	40 f6 c6 01          	test   $0x1,%sil
+  802ade:	74 58                	je     802b38 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802ae0:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802ae7:	7f 00 00 
+  802aea:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802aee:	a8 80                	test   $0x80,%al
+  802af0:	75 6c                	jne    802b5e <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802af2:	48 89 f9             	mov    %rdi,%rcx
+  802af5:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802af9:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b00:	7f 00 00 
+  802b03:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b07:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b0e:	40 f6 c6 01          	test   $0x1,%sil
+  802b12:	74 24                	je     802b38 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b14:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b1b:	7f 00 00 
+  802b1e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b22:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b29:	ff ff 7f 
+  802b2c:	48 21 c8             	and    %rcx,%rax
+  802b2f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b35:	48 09 d0             	or     %rdx,%rax
+}
+  802b38:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b39:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b40:	7f 00 00 
+  802b43:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b47:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b4e:	ff ff 7f 
+  802b51:	48 21 c8             	and    %rcx,%rax
+  802b54:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802b5a:	48 01 d0             	add    %rdx,%rax
+  802b5d:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802b5e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b65:	7f 00 00 
+  802b68:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b6c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b73:	ff ff 7f 
+  802b76:	48 21 c8             	and    %rcx,%rax
+  802b79:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802b7f:	48 01 d0             	add    %rdx,%rax
+  802b82:	c3                   	ret
+
+0000000000802b83 <get_prot>:
+
+int
+get_prot(void *va) {
+  802b83:	55                   	push   %rbp
+  802b84:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b87:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  802b8e:	00 00 00 
+  802b91:	ff d0                	call   *%rax
+  802b93:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b96:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b9b:	89 c1                	mov    %eax,%ecx
+  802b9d:	83 c9 04             	or     $0x4,%ecx
+  802ba0:	f6 c2 01             	test   $0x1,%dl
+  802ba3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802ba6:	89 c1                	mov    %eax,%ecx
+  802ba8:	83 c9 02             	or     $0x2,%ecx
+  802bab:	f6 c2 02             	test   $0x2,%dl
+  802bae:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802bb1:	89 c1                	mov    %eax,%ecx
+  802bb3:	83 c9 01             	or     $0x1,%ecx
+  802bb6:	48 85 d2             	test   %rdx,%rdx
+  802bb9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bbc:	89 c1                	mov    %eax,%ecx
+  802bbe:	83 c9 40             	or     $0x40,%ecx
+  802bc1:	f6 c6 04             	test   $0x4,%dh
+  802bc4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802bc7:	5d                   	pop    %rbp
+  802bc8:	c3                   	ret
+
+0000000000802bc9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802bc9:	55                   	push   %rbp
+  802bca:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bcd:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802bd9:	48 c1 e8 06          	shr    $0x6,%rax
+  802bdd:	83 e0 01             	and    $0x1,%eax
+}
+  802be0:	5d                   	pop    %rbp
+  802be1:	c3                   	ret
+
+0000000000802be2 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802be2:	55                   	push   %rbp
+  802be3:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802be6:	48 b8 aa 29 80 00 00 	movabs $0x8029aa,%rax
+  802bed:	00 00 00 
+  802bf0:	ff d0                	call   *%rax
+  802bf2:	83 e0 01             	and    $0x1,%eax
+}
+  802bf5:	5d                   	pop    %rbp
+  802bf6:	c3                   	ret
+
+0000000000802bf7 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802bf7:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802bfe:	7f 00 00 
+  802c01:	a8 01                	test   $0x1,%al
+  802c03:	75 06                	jne    802c0b <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0a:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c0b:	55                   	push   %rbp
+  802c0c:	48 89 e5             	mov    %rsp,%rbp
+  802c0f:	41 57                	push   %r15
+  802c11:	41 56                	push   %r14
+  802c13:	41 55                	push   %r13
+  802c15:	41 54                	push   %r12
+  802c17:	53                   	push   %rbx
+  802c18:	48 83 ec 18          	sub    $0x18,%rsp
+  802c1c:	49 89 fe             	mov    %rdi,%r14
+  802c1f:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c22:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c29:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c2a:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c31:	7f 00 00 
+  802c34:	e9 81 00 00 00       	jmp    802cba <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c39:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c40:	49 39 dd             	cmp    %rbx,%r13
+  802c43:	74 2b                	je     802c70 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c45:	48 89 d8             	mov    %rbx,%rax
+  802c48:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c4c:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802c50:	f6 c2 01             	test   $0x1,%dl
+  802c53:	74 e4                	je     802c39 <foreach_shared_region+0x42>
+  802c55:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802c59:	f6 c4 04             	test   $0x4,%ah
+  802c5c:	74 db                	je     802c39 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802c5e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802c65:	4c 89 fa             	mov    %r15,%rdx
+  802c68:	48 89 df             	mov    %rbx,%rdi
+  802c6b:	41 ff d6             	call   *%r14
+  802c6e:	eb c9                	jmp    802c39 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802c70:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802c77:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802c7b:	74 22                	je     802c9f <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802c7d:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802c84:	48 89 d8             	mov    %rbx,%rax
+  802c87:	48 c1 e8 15          	shr    $0x15,%rax
+  802c8b:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802c92:	7f 00 00 
+  802c95:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802c99:	a8 01                	test   $0x1,%al
+  802c9b:	74 d3                	je     802c70 <foreach_shared_region+0x79>
+  802c9d:	eb a6                	jmp    802c45 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c9f:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802ca6:	40 
+  802ca7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802cab:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802cb2:	00 00 00 
+  802cb5:	48 39 c1             	cmp    %rax,%rcx
+  802cb8:	74 31                	je     802ceb <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802cba:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cbe:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cc2:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802cc9:	7f 00 00 
+  802ccc:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802cd0:	a8 01                	test   $0x1,%al
+  802cd2:	74 cb                	je     802c9f <foreach_shared_region+0xa8>
+  802cd4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cd8:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cdf:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802ce5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802ce9:	eb 92                	jmp    802c7d <foreach_shared_region+0x86>
+}
+  802ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf0:	48 83 c4 18          	add    $0x18,%rsp
+  802cf4:	5b                   	pop    %rbx
+  802cf5:	41 5c                	pop    %r12
+  802cf7:	41 5d                	pop    %r13
+  802cf9:	41 5e                	pop    %r14
+  802cfb:	41 5f                	pop    %r15
+  802cfd:	5d                   	pop    %rbp
+  802cfe:	c3                   	ret
+
+0000000000802cff <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802cff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d04:	c3                   	ret
+
+0000000000802d05 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d05:	55                   	push   %rbp
+  802d06:	48 89 e5             	mov    %rsp,%rbp
+  802d09:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d0c:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d13:	00 00 00 
+  802d16:	48 b8 f2 39 80 00 00 	movabs $0x8039f2,%rax
+  802d1d:	00 00 00 
+  802d20:	ff d0                	call   *%rax
+    return 0;
+}
+  802d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d27:	5d                   	pop    %rbp
+  802d28:	c3                   	ret
+
+0000000000802d29 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d29:	55                   	push   %rbp
+  802d2a:	48 89 e5             	mov    %rsp,%rbp
+  802d2d:	41 57                	push   %r15
+  802d2f:	41 56                	push   %r14
+  802d31:	41 55                	push   %r13
+  802d33:	41 54                	push   %r12
+  802d35:	53                   	push   %rbx
+  802d36:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d3d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d44:	48 85 d2             	test   %rdx,%rdx
+  802d47:	74 7a                	je     802dc3 <devcons_write+0x9a>
+  802d49:	49 89 d6             	mov    %rdx,%r14
+  802d4c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d52:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d57:	49 bf 80 3d 80 00 00 	movabs $0x803d80,%r15
+  802d5e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d61:	4c 89 f3             	mov    %r14,%rbx
+  802d64:	48 29 f3             	sub    %rsi,%rbx
+  802d67:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d6c:	48 39 c3             	cmp    %rax,%rbx
+  802d6f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d73:	4c 63 eb             	movslq %ebx,%r13
+  802d76:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d7d:	48 01 c6             	add    %rax,%rsi
+  802d80:	4c 89 ea             	mov    %r13,%rdx
+  802d83:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d8a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d8d:	4c 89 ee             	mov    %r13,%rsi
+  802d90:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d97:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  802d9e:	00 00 00 
+  802da1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802da3:	41 01 dc             	add    %ebx,%r12d
+  802da6:	49 63 f4             	movslq %r12d,%rsi
+  802da9:	4c 39 f6             	cmp    %r14,%rsi
+  802dac:	72 b3                	jb     802d61 <devcons_write+0x38>
+    return res;
+  802dae:	49 63 c4             	movslq %r12d,%rax
+}
+  802db1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802db8:	5b                   	pop    %rbx
+  802db9:	41 5c                	pop    %r12
+  802dbb:	41 5d                	pop    %r13
+  802dbd:	41 5e                	pop    %r14
+  802dbf:	41 5f                	pop    %r15
+  802dc1:	5d                   	pop    %rbp
+  802dc2:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802dc3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dc9:	eb e3                	jmp    802dae <devcons_write+0x85>
+
+0000000000802dcb <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dcb:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802dce:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dd3:	48 85 c0             	test   %rax,%rax
+  802dd6:	74 55                	je     802e2d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dd8:	55                   	push   %rbp
+  802dd9:	48 89 e5             	mov    %rsp,%rbp
+  802ddc:	41 55                	push   %r13
+  802dde:	41 54                	push   %r12
+  802de0:	53                   	push   %rbx
+  802de1:	48 83 ec 08          	sub    $0x8,%rsp
+  802de5:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802de8:	48 bb 2f 01 80 00 00 	movabs $0x80012f,%rbx
+  802def:	00 00 00 
+  802df2:	49 bc fc 01 80 00 00 	movabs $0x8001fc,%r12
+  802df9:	00 00 00 
+  802dfc:	eb 03                	jmp    802e01 <devcons_read+0x36>
+  802dfe:	41 ff d4             	call   *%r12
+  802e01:	ff d3                	call   *%rbx
+  802e03:	85 c0                	test   %eax,%eax
+  802e05:	74 f7                	je     802dfe <devcons_read+0x33>
+    if (c < 0) return c;
+  802e07:	48 63 d0             	movslq %eax,%rdx
+  802e0a:	78 13                	js     802e1f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e11:	83 f8 04             	cmp    $0x4,%eax
+  802e14:	74 09                	je     802e1f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e16:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e1a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e1f:	48 89 d0             	mov    %rdx,%rax
+  802e22:	48 83 c4 08          	add    $0x8,%rsp
+  802e26:	5b                   	pop    %rbx
+  802e27:	41 5c                	pop    %r12
+  802e29:	41 5d                	pop    %r13
+  802e2b:	5d                   	pop    %rbp
+  802e2c:	c3                   	ret
+  802e2d:	48 89 d0             	mov    %rdx,%rax
+  802e30:	c3                   	ret
+
+0000000000802e31 <cputchar>:
+cputchar(int ch) {
+  802e31:	55                   	push   %rbp
+  802e32:	48 89 e5             	mov    %rsp,%rbp
+  802e35:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e39:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e3d:	be 01 00 00 00       	mov    $0x1,%esi
+  802e42:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e46:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  802e4d:	00 00 00 
+  802e50:	ff d0                	call   *%rax
+}
+  802e52:	c9                   	leave
+  802e53:	c3                   	ret
+
+0000000000802e54 <getchar>:
+getchar(void) {
+  802e54:	55                   	push   %rbp
+  802e55:	48 89 e5             	mov    %rsp,%rbp
+  802e58:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e5c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e61:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e6a:	48 b8 12 10 80 00 00 	movabs $0x801012,%rax
+  802e71:	00 00 00 
+  802e74:	ff d0                	call   *%rax
+  802e76:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e78:	85 c0                	test   %eax,%eax
+  802e7a:	78 06                	js     802e82 <getchar+0x2e>
+  802e7c:	74 08                	je     802e86 <getchar+0x32>
+  802e7e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e82:	89 d0                	mov    %edx,%eax
+  802e84:	c9                   	leave
+  802e85:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e86:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e8b:	eb f5                	jmp    802e82 <getchar+0x2e>
+
+0000000000802e8d <iscons>:
+iscons(int fdnum) {
+  802e8d:	55                   	push   %rbp
+  802e8e:	48 89 e5             	mov    %rsp,%rbp
+  802e91:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e95:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e99:	48 b8 2f 0d 80 00 00 	movabs $0x800d2f,%rax
+  802ea0:	00 00 00 
+  802ea3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ea5:	85 c0                	test   %eax,%eax
+  802ea7:	78 18                	js     802ec1 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ea9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ead:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802eb4:	00 00 00 
+  802eb7:	8b 00                	mov    (%rax),%eax
+  802eb9:	39 02                	cmp    %eax,(%rdx)
+  802ebb:	0f 94 c0             	sete   %al
+  802ebe:	0f b6 c0             	movzbl %al,%eax
+}
+  802ec1:	c9                   	leave
+  802ec2:	c3                   	ret
+
+0000000000802ec3 <opencons>:
+opencons(void) {
+  802ec3:	55                   	push   %rbp
+  802ec4:	48 89 e5             	mov    %rsp,%rbp
+  802ec7:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ecb:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ecf:	48 b8 cf 0c 80 00 00 	movabs $0x800ccf,%rax
+  802ed6:	00 00 00 
+  802ed9:	ff d0                	call   *%rax
+  802edb:	85 c0                	test   %eax,%eax
+  802edd:	78 49                	js     802f28 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802edf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ee4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ee9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802eed:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef2:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  802ef9:	00 00 00 
+  802efc:	ff d0                	call   *%rax
+  802efe:	85 c0                	test   %eax,%eax
+  802f00:	78 26                	js     802f28 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f02:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f06:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802f0d:	00 00 
+  802f0f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f11:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f15:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f1c:	48 b8 a1 0c 80 00 00 	movabs $0x800ca1,%rax
+  802f23:	00 00 00 
+  802f26:	ff d0                	call   *%rax
+}
+  802f28:	c9                   	leave
+  802f29:	c3                   	ret
+
+0000000000802f2a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f2a:	55                   	push   %rbp
+  802f2b:	48 89 e5             	mov    %rsp,%rbp
+  802f2e:	41 56                	push   %r14
+  802f30:	41 55                	push   %r13
+  802f32:	41 54                	push   %r12
+  802f34:	53                   	push   %rbx
+  802f35:	48 83 ec 50          	sub    $0x50,%rsp
+  802f39:	49 89 fc             	mov    %rdi,%r12
+  802f3c:	41 89 f5             	mov    %esi,%r13d
+  802f3f:	48 89 d3             	mov    %rdx,%rbx
+  802f42:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802f46:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802f4a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f4e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802f55:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f59:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f5d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802f61:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f65:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802f6c:	00 00 00 
+  802f6f:	4c 8b 30             	mov    (%rax),%r14
+  802f72:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  802f79:	00 00 00 
+  802f7c:	ff d0                	call   *%rax
+  802f7e:	89 c6                	mov    %eax,%esi
+  802f80:	45 89 e8             	mov    %r13d,%r8d
+  802f83:	4c 89 e1             	mov    %r12,%rcx
+  802f86:	4c 89 f2             	mov    %r14,%rdx
+  802f89:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802f90:	00 00 00 
+  802f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f98:	49 bc 7a 30 80 00 00 	movabs $0x80307a,%r12
+  802f9f:	00 00 00 
+  802fa2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802fa5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802fa9:	48 89 df             	mov    %rbx,%rdi
+  802fac:	48 b8 16 30 80 00 00 	movabs $0x803016,%rax
+  802fb3:	00 00 00 
+  802fb6:	ff d0                	call   *%rax
+    cprintf("\n");
+  802fb8:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  802fbf:	00 00 00 
+  802fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc7:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802fca:	cc                   	int3
+  802fcb:	eb fd                	jmp    802fca <_panic+0xa0>
+
+0000000000802fcd <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802fcd:	55                   	push   %rbp
+  802fce:	48 89 e5             	mov    %rsp,%rbp
+  802fd1:	53                   	push   %rbx
+  802fd2:	48 83 ec 08          	sub    $0x8,%rsp
+  802fd6:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802fd9:	8b 06                	mov    (%rsi),%eax
+  802fdb:	8d 50 01             	lea    0x1(%rax),%edx
+  802fde:	89 16                	mov    %edx,(%rsi)
+  802fe0:	48 98                	cltq
+  802fe2:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802fe7:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802fed:	74 0a                	je     802ff9 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802fef:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802ff3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff7:	c9                   	leave
+  802ff8:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802ff9:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802ffd:	be ff 00 00 00       	mov    $0xff,%esi
+  803002:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  803009:	00 00 00 
+  80300c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80300e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803014:	eb d9                	jmp    802fef <putch+0x22>
+
+0000000000803016 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803016:	55                   	push   %rbp
+  803017:	48 89 e5             	mov    %rsp,%rbp
+  80301a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803021:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803024:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80302b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803030:	b8 00 00 00 00       	mov    $0x0,%eax
+  803035:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803038:	48 89 f1             	mov    %rsi,%rcx
+  80303b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803042:	48 bf cd 2f 80 00 00 	movabs $0x802fcd,%rdi
+  803049:	00 00 00 
+  80304c:	48 b8 ca 31 80 00 00 	movabs $0x8031ca,%rax
+  803053:	00 00 00 
+  803056:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803058:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80305f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803066:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  80306d:	00 00 00 
+  803070:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  803072:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  803078:	c9                   	leave
+  803079:	c3                   	ret
+
+000000000080307a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80307a:	55                   	push   %rbp
+  80307b:	48 89 e5             	mov    %rsp,%rbp
+  80307e:	48 83 ec 50          	sub    $0x50,%rsp
+  803082:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803086:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80308a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80308e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803092:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803096:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80309d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030a5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030a9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8030ad:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8030b1:	48 b8 16 30 80 00 00 	movabs $0x803016,%rax
+  8030b8:	00 00 00 
+  8030bb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8030bd:	c9                   	leave
+  8030be:	c3                   	ret
+
+00000000008030bf <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8030bf:	55                   	push   %rbp
+  8030c0:	48 89 e5             	mov    %rsp,%rbp
+  8030c3:	41 57                	push   %r15
+  8030c5:	41 56                	push   %r14
+  8030c7:	41 55                	push   %r13
+  8030c9:	41 54                	push   %r12
+  8030cb:	53                   	push   %rbx
+  8030cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8030d0:	49 89 fc             	mov    %rdi,%r12
+  8030d3:	49 89 f5             	mov    %rsi,%r13
+  8030d6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8030da:	8b 45 10             	mov    0x10(%rbp),%eax
+  8030dd:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8030e0:	41 89 cf             	mov    %ecx,%r15d
+  8030e3:	4c 39 fa             	cmp    %r15,%rdx
+  8030e6:	73 5b                	jae    803143 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8030e8:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8030ec:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8030f0:	85 db                	test   %ebx,%ebx
+  8030f2:	7e 0e                	jle    803102 <print_num+0x43>
+            putch(padc, put_arg);
+  8030f4:	4c 89 ee             	mov    %r13,%rsi
+  8030f7:	44 89 f7             	mov    %r14d,%edi
+  8030fa:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8030fd:	83 eb 01             	sub    $0x1,%ebx
+  803100:	75 f2                	jne    8030f4 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803102:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803106:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  80310d:	00 00 00 
+  803110:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  803117:	00 00 00 
+  80311a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80311e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803122:	ba 00 00 00 00       	mov    $0x0,%edx
+  803127:	49 f7 f7             	div    %r15
+  80312a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80312e:	4c 89 ee             	mov    %r13,%rsi
+  803131:	41 ff d4             	call   *%r12
+}
+  803134:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803138:	5b                   	pop    %rbx
+  803139:	41 5c                	pop    %r12
+  80313b:	41 5d                	pop    %r13
+  80313d:	41 5e                	pop    %r14
+  80313f:	41 5f                	pop    %r15
+  803141:	5d                   	pop    %rbp
+  803142:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803143:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803147:	ba 00 00 00 00       	mov    $0x0,%edx
+  80314c:	49 f7 f7             	div    %r15
+  80314f:	48 83 ec 08          	sub    $0x8,%rsp
+  803153:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803157:	52                   	push   %rdx
+  803158:	45 0f be c9          	movsbl %r9b,%r9d
+  80315c:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803160:	48 89 c2             	mov    %rax,%rdx
+  803163:	48 b8 bf 30 80 00 00 	movabs $0x8030bf,%rax
+  80316a:	00 00 00 
+  80316d:	ff d0                	call   *%rax
+  80316f:	48 83 c4 10          	add    $0x10,%rsp
+  803173:	eb 8d                	jmp    803102 <print_num+0x43>
+
+0000000000803175 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803175:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  803179:	48 8b 06             	mov    (%rsi),%rax
+  80317c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  803180:	73 0a                	jae    80318c <sprintputch+0x17>
+        *state->start++ = ch;
+  803182:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803186:	48 89 16             	mov    %rdx,(%rsi)
+  803189:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80318c:	c3                   	ret
+
+000000000080318d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80318d:	55                   	push   %rbp
+  80318e:	48 89 e5             	mov    %rsp,%rbp
+  803191:	48 83 ec 50          	sub    $0x50,%rsp
+  803195:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803199:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80319d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8031a1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8031a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031b0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031b4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8031b8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8031bc:	48 b8 ca 31 80 00 00 	movabs $0x8031ca,%rax
+  8031c3:	00 00 00 
+  8031c6:	ff d0                	call   *%rax
+}
+  8031c8:	c9                   	leave
+  8031c9:	c3                   	ret
+
+00000000008031ca <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8031ca:	55                   	push   %rbp
+  8031cb:	48 89 e5             	mov    %rsp,%rbp
+  8031ce:	41 57                	push   %r15
+  8031d0:	41 56                	push   %r14
+  8031d2:	41 55                	push   %r13
+  8031d4:	41 54                	push   %r12
+  8031d6:	53                   	push   %rbx
+  8031d7:	48 83 ec 38          	sub    $0x38,%rsp
+  8031db:	49 89 fe             	mov    %rdi,%r14
+  8031de:	49 89 f5             	mov    %rsi,%r13
+  8031e1:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8031e4:	48 8b 01             	mov    (%rcx),%rax
+  8031e7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031eb:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8031ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031f3:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8031f7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8031fb:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8031ff:	0f b6 3b             	movzbl (%rbx),%edi
+  803202:	40 80 ff 25          	cmp    $0x25,%dil
+  803206:	74 18                	je     803220 <vprintfmt+0x56>
+            if (!ch) return;
+  803208:	40 84 ff             	test   %dil,%dil
+  80320b:	0f 84 04 07 00 00    	je     803915 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  803211:	40 0f b6 ff          	movzbl %dil,%edi
+  803215:	4c 89 ee             	mov    %r13,%rsi
+  803218:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80321b:	4c 89 e3             	mov    %r12,%rbx
+  80321e:	eb db                	jmp    8031fb <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803220:	be 00 00 00 00       	mov    $0x0,%esi
+  803225:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803229:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80322e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803234:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80323b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80323f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803244:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803249:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80324c:	83 e8 23             	sub    $0x23,%eax
+  80324f:	3c 57                	cmp    $0x57,%al
+  803251:	0f 87 a4 06 00 00    	ja     8038fb <vprintfmt+0x731>
+  803257:	0f b6 c0             	movzbl %al,%eax
+  80325a:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  803261:	00 00 00 
+  803264:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803267:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80326a:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80326e:	eb cf                	jmp    80323f <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  803270:	49 89 dc             	mov    %rbx,%r12
+  803273:	be 01 00 00 00       	mov    $0x1,%esi
+  803278:	eb c5                	jmp    80323f <vprintfmt+0x75>
+            padc = ch;
+  80327a:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80327e:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803281:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803284:	eb b9                	jmp    80323f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803286:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803289:	83 f8 2f             	cmp    $0x2f,%eax
+  80328c:	77 24                	ja     8032b2 <vprintfmt+0xe8>
+  80328e:	89 c1                	mov    %eax,%ecx
+  803290:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  803294:	83 c0 08             	add    $0x8,%eax
+  803297:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80329a:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80329d:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8032a0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8032a4:	79 99                	jns    80323f <vprintfmt+0x75>
+                width = precision;
+  8032a6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8032aa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8032b0:	eb 8d                	jmp    80323f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032b2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032b6:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8032ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032be:	eb da                	jmp    80329a <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8032c0:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8032c5:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032c9:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8032cf:	3c 39                	cmp    $0x39,%al
+  8032d1:	77 1c                	ja     8032ef <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8032d3:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8032d7:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8032db:	0f b6 c0             	movzbl %al,%eax
+  8032de:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032e3:	0f b6 03             	movzbl (%rbx),%eax
+  8032e6:	3c 39                	cmp    $0x39,%al
+  8032e8:	76 e9                	jbe    8032d3 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8032ea:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8032ed:	eb b1                	jmp    8032a0 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8032ef:	49 89 dc             	mov    %rbx,%r12
+  8032f2:	eb ac                	jmp    8032a0 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8032f4:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8032f7:	85 c9                	test   %ecx,%ecx
+  8032f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032fe:	0f 49 c1             	cmovns %ecx,%eax
+  803301:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803304:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803307:	e9 33 ff ff ff       	jmp    80323f <vprintfmt+0x75>
+            lflag++;
+  80330c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80330f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803312:	e9 28 ff ff ff       	jmp    80323f <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803317:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80331a:	83 f8 2f             	cmp    $0x2f,%eax
+  80331d:	77 19                	ja     803338 <vprintfmt+0x16e>
+  80331f:	89 c2                	mov    %eax,%edx
+  803321:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803325:	83 c0 08             	add    $0x8,%eax
+  803328:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80332b:	8b 3a                	mov    (%rdx),%edi
+  80332d:	4c 89 ee             	mov    %r13,%rsi
+  803330:	41 ff d6             	call   *%r14
+            break;
+  803333:	e9 c3 fe ff ff       	jmp    8031fb <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803338:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80333c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803340:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803344:	eb e5                	jmp    80332b <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803346:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803349:	83 f8 2f             	cmp    $0x2f,%eax
+  80334c:	77 5a                	ja     8033a8 <vprintfmt+0x1de>
+  80334e:	89 c2                	mov    %eax,%edx
+  803350:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803354:	83 c0 08             	add    $0x8,%eax
+  803357:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80335a:	8b 02                	mov    (%rdx),%eax
+  80335c:	89 c1                	mov    %eax,%ecx
+  80335e:	f7 d9                	neg    %ecx
+  803360:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803363:	83 f9 13             	cmp    $0x13,%ecx
+  803366:	7f 4e                	jg     8033b6 <vprintfmt+0x1ec>
+  803368:	48 63 c1             	movslq %ecx,%rax
+  80336b:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  803372:	00 00 00 
+  803375:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803379:	48 85 c0             	test   %rax,%rax
+  80337c:	74 38                	je     8033b6 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80337e:	48 89 c1             	mov    %rax,%rcx
+  803381:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  803388:	00 00 00 
+  80338b:	4c 89 ee             	mov    %r13,%rsi
+  80338e:	4c 89 f7             	mov    %r14,%rdi
+  803391:	b8 00 00 00 00       	mov    $0x0,%eax
+  803396:	49 b8 8d 31 80 00 00 	movabs $0x80318d,%r8
+  80339d:	00 00 00 
+  8033a0:	41 ff d0             	call   *%r8
+  8033a3:	e9 53 fe ff ff       	jmp    8031fb <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8033a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033b4:	eb a4                	jmp    80335a <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8033b6:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  8033bd:	00 00 00 
+  8033c0:	4c 89 ee             	mov    %r13,%rsi
+  8033c3:	4c 89 f7             	mov    %r14,%rdi
+  8033c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033cb:	49 b8 8d 31 80 00 00 	movabs $0x80318d,%r8
+  8033d2:	00 00 00 
+  8033d5:	41 ff d0             	call   *%r8
+  8033d8:	e9 1e fe ff ff       	jmp    8031fb <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8033dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8033e3:	77 36                	ja     80341b <vprintfmt+0x251>
+  8033e5:	89 c2                	mov    %eax,%edx
+  8033e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033eb:	83 c0 08             	add    $0x8,%eax
+  8033ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033f1:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8033f4:	48 85 f6             	test   %rsi,%rsi
+  8033f7:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  8033fe:	00 00 00 
+  803401:	48 0f 45 c6          	cmovne %rsi,%rax
+  803405:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803409:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80340d:	7e 06                	jle    803415 <vprintfmt+0x24b>
+  80340f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803413:	75 14                	jne    803429 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803415:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803419:	eb 5b                	jmp    803476 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80341b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80341f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803423:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803427:	eb c8                	jmp    8033f1 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803429:	49 63 f7             	movslq %r15d,%rsi
+  80342c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803430:	48 b8 cf 39 80 00 00 	movabs $0x8039cf,%rax
+  803437:	00 00 00 
+  80343a:	ff d0                	call   *%rax
+  80343c:	48 89 c2             	mov    %rax,%rdx
+  80343f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803442:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803444:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803447:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80344a:	85 c0                	test   %eax,%eax
+  80344c:	7e c7                	jle    803415 <vprintfmt+0x24b>
+  80344e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803453:	4c 89 ee             	mov    %r13,%rsi
+  803456:	44 89 e7             	mov    %r12d,%edi
+  803459:	41 ff d6             	call   *%r14
+  80345c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803460:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803463:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803466:	75 eb                	jne    803453 <vprintfmt+0x289>
+  803468:	eb ab                	jmp    803415 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80346a:	0f b6 f8             	movzbl %al,%edi
+  80346d:	4c 89 ee             	mov    %r13,%rsi
+  803470:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  803473:	4c 89 e2             	mov    %r12,%rdx
+  803476:	45 85 ff             	test   %r15d,%r15d
+  803479:	78 06                	js     803481 <vprintfmt+0x2b7>
+  80347b:	41 83 ef 01          	sub    $0x1,%r15d
+  80347f:	78 23                	js     8034a4 <vprintfmt+0x2da>
+  803481:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  803485:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80348b:	84 c0                	test   %al,%al
+  80348d:	74 15                	je     8034a4 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80348f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803493:	74 d5                	je     80346a <vprintfmt+0x2a0>
+  803495:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803498:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80349d:	80 fa 5e             	cmp    $0x5e,%dl
+  8034a0:	77 cb                	ja     80346d <vprintfmt+0x2a3>
+  8034a2:	eb c6                	jmp    80346a <vprintfmt+0x2a0>
+  8034a4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8034a7:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8034aa:	01 f0                	add    %esi,%eax
+  8034ac:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8034ae:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8034b2:	85 c0                	test   %eax,%eax
+  8034b4:	0f 8e 41 fd ff ff    	jle    8031fb <vprintfmt+0x31>
+  8034ba:	4c 89 ee             	mov    %r13,%rsi
+  8034bd:	bf 20 00 00 00       	mov    $0x20,%edi
+  8034c2:	41 ff d6             	call   *%r14
+  8034c5:	41 83 ec 01          	sub    $0x1,%r12d
+  8034c9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8034cd:	75 eb                	jne    8034ba <vprintfmt+0x2f0>
+  8034cf:	e9 27 fd ff ff       	jmp    8031fb <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8034d4:	40 84 f6             	test   %sil,%sil
+  8034d7:	75 26                	jne    8034ff <vprintfmt+0x335>
+    switch (lflag) {
+  8034d9:	85 d2                	test   %edx,%edx
+  8034db:	74 59                	je     803536 <vprintfmt+0x36c>
+  8034dd:	83 fa 01             	cmp    $0x1,%edx
+  8034e0:	74 7b                	je     80355d <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8034e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8034e8:	0f 87 96 00 00 00    	ja     803584 <vprintfmt+0x3ba>
+  8034ee:	89 c2                	mov    %eax,%edx
+  8034f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034f4:	83 c0 08             	add    $0x8,%eax
+  8034f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034fa:	4c 8b 22             	mov    (%rdx),%r12
+  8034fd:	eb 17                	jmp    803516 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8034ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803502:	83 f8 2f             	cmp    $0x2f,%eax
+  803505:	77 21                	ja     803528 <vprintfmt+0x35e>
+  803507:	89 c2                	mov    %eax,%edx
+  803509:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80350d:	83 c0 08             	add    $0x8,%eax
+  803510:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803513:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803516:	4d 85 e4             	test   %r12,%r12
+  803519:	78 7a                	js     803595 <vprintfmt+0x3cb>
+            num = i;
+  80351b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80351e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803523:	e9 b5 02 00 00       	jmp    8037dd <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803528:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80352c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803530:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803534:	eb dd                	jmp    803513 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  803536:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803539:	83 f8 2f             	cmp    $0x2f,%eax
+  80353c:	77 11                	ja     80354f <vprintfmt+0x385>
+  80353e:	89 c2                	mov    %eax,%edx
+  803540:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803544:	83 c0 08             	add    $0x8,%eax
+  803547:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80354a:	4c 63 22             	movslq (%rdx),%r12
+  80354d:	eb c7                	jmp    803516 <vprintfmt+0x34c>
+  80354f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803553:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803557:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80355b:	eb ed                	jmp    80354a <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80355d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803560:	83 f8 2f             	cmp    $0x2f,%eax
+  803563:	77 11                	ja     803576 <vprintfmt+0x3ac>
+  803565:	89 c2                	mov    %eax,%edx
+  803567:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80356b:	83 c0 08             	add    $0x8,%eax
+  80356e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803571:	4c 8b 22             	mov    (%rdx),%r12
+  803574:	eb a0                	jmp    803516 <vprintfmt+0x34c>
+  803576:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80357a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80357e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803582:	eb ed                	jmp    803571 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  803584:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803588:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80358c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803590:	e9 65 ff ff ff       	jmp    8034fa <vprintfmt+0x330>
+                putch('-', put_arg);
+  803595:	4c 89 ee             	mov    %r13,%rsi
+  803598:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80359d:	41 ff d6             	call   *%r14
+                i = -i;
+  8035a0:	49 f7 dc             	neg    %r12
+  8035a3:	e9 73 ff ff ff       	jmp    80351b <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8035a8:	40 84 f6             	test   %sil,%sil
+  8035ab:	75 32                	jne    8035df <vprintfmt+0x415>
+    switch (lflag) {
+  8035ad:	85 d2                	test   %edx,%edx
+  8035af:	74 5d                	je     80360e <vprintfmt+0x444>
+  8035b1:	83 fa 01             	cmp    $0x1,%edx
+  8035b4:	0f 84 82 00 00 00    	je     80363c <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8035ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8035c0:	0f 87 a5 00 00 00    	ja     80366b <vprintfmt+0x4a1>
+  8035c6:	89 c2                	mov    %eax,%edx
+  8035c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035cc:	83 c0 08             	add    $0x8,%eax
+  8035cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035d2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035d5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8035da:	e9 fe 01 00 00       	jmp    8037dd <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8035df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8035e5:	77 19                	ja     803600 <vprintfmt+0x436>
+  8035e7:	89 c2                	mov    %eax,%edx
+  8035e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035ed:	83 c0 08             	add    $0x8,%eax
+  8035f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035f3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8035fb:	e9 dd 01 00 00       	jmp    8037dd <vprintfmt+0x613>
+  803600:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803604:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803608:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80360c:	eb e5                	jmp    8035f3 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80360e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803611:	83 f8 2f             	cmp    $0x2f,%eax
+  803614:	77 18                	ja     80362e <vprintfmt+0x464>
+  803616:	89 c2                	mov    %eax,%edx
+  803618:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80361c:	83 c0 08             	add    $0x8,%eax
+  80361f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803622:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803624:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803629:	e9 af 01 00 00       	jmp    8037dd <vprintfmt+0x613>
+  80362e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803632:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803636:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80363a:	eb e6                	jmp    803622 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80363c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80363f:	83 f8 2f             	cmp    $0x2f,%eax
+  803642:	77 19                	ja     80365d <vprintfmt+0x493>
+  803644:	89 c2                	mov    %eax,%edx
+  803646:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80364a:	83 c0 08             	add    $0x8,%eax
+  80364d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803650:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803653:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803658:	e9 80 01 00 00       	jmp    8037dd <vprintfmt+0x613>
+  80365d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803661:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803665:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803669:	eb e5                	jmp    803650 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80366b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80366f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803673:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803677:	e9 56 ff ff ff       	jmp    8035d2 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80367c:	40 84 f6             	test   %sil,%sil
+  80367f:	75 2e                	jne    8036af <vprintfmt+0x4e5>
+    switch (lflag) {
+  803681:	85 d2                	test   %edx,%edx
+  803683:	0f 84 b3 00 00 00    	je     80373c <vprintfmt+0x572>
+  803689:	83 fa 01             	cmp    $0x1,%edx
+  80368c:	0f 84 d3 00 00 00    	je     803765 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  803692:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803695:	83 f8 2f             	cmp    $0x2f,%eax
+  803698:	0f 87 f1 00 00 00    	ja     80378f <vprintfmt+0x5c5>
+  80369e:	89 c2                	mov    %eax,%edx
+  8036a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036a4:	83 c0 08             	add    $0x8,%eax
+  8036a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036aa:	48 8b 02             	mov    (%rdx),%rax
+  8036ad:	eb 17                	jmp    8036c6 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8036b5:	77 77                	ja     80372e <vprintfmt+0x564>
+  8036b7:	89 c2                	mov    %eax,%edx
+  8036b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036bd:	83 c0 08             	add    $0x8,%eax
+  8036c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036c3:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8036c6:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036c8:	83 f8 07             	cmp    $0x7,%eax
+  8036cb:	0f 8e cf 00 00 00    	jle    8037a0 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8036d1:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036d7:	44 89 e7             	mov    %r12d,%edi
+  8036da:	41 c1 e4 03          	shl    $0x3,%r12d
+  8036de:	89 d1                	mov    %edx,%ecx
+  8036e0:	8d 72 07             	lea    0x7(%rdx),%esi
+  8036e3:	85 d2                	test   %edx,%edx
+  8036e5:	0f 48 d6             	cmovs  %esi,%edx
+  8036e8:	c1 fa 03             	sar    $0x3,%edx
+  8036eb:	83 f9 3f             	cmp    $0x3f,%ecx
+  8036ee:	7f e7                	jg     8036d7 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8036f0:	85 ff                	test   %edi,%edi
+  8036f2:	0f 84 03 fb ff ff    	je     8031fb <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8036f8:	49 63 f4             	movslq %r12d,%rsi
+  8036fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803700:	48 f7 f6             	div    %rsi
+  803703:	49 89 d7             	mov    %rdx,%r15
+  803706:	83 c0 30             	add    $0x30,%eax
+  803709:	0f be f8             	movsbl %al,%edi
+  80370c:	4c 89 ee             	mov    %r13,%rsi
+  80370f:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  803712:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  803715:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  80371a:	45 85 e4             	test   %r12d,%r12d
+  80371d:	41 0f 49 d4          	cmovns %r12d,%edx
+  803721:	c1 fa 03             	sar    $0x3,%edx
+  803724:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  803727:	75 cf                	jne    8036f8 <vprintfmt+0x52e>
+  803729:	e9 cd fa ff ff       	jmp    8031fb <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80372e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803732:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803736:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80373a:	eb 87                	jmp    8036c3 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80373c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80373f:	83 f8 2f             	cmp    $0x2f,%eax
+  803742:	77 13                	ja     803757 <vprintfmt+0x58d>
+  803744:	89 c2                	mov    %eax,%edx
+  803746:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80374a:	83 c0 08             	add    $0x8,%eax
+  80374d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803750:	8b 02                	mov    (%rdx),%eax
+  803752:	e9 6f ff ff ff       	jmp    8036c6 <vprintfmt+0x4fc>
+  803757:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80375b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80375f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803763:	eb eb                	jmp    803750 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  803765:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803768:	83 f8 2f             	cmp    $0x2f,%eax
+  80376b:	77 14                	ja     803781 <vprintfmt+0x5b7>
+  80376d:	89 c2                	mov    %eax,%edx
+  80376f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803773:	83 c0 08             	add    $0x8,%eax
+  803776:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803779:	48 8b 02             	mov    (%rdx),%rax
+  80377c:	e9 45 ff ff ff       	jmp    8036c6 <vprintfmt+0x4fc>
+  803781:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803785:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803789:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80378d:	eb ea                	jmp    803779 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  80378f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803793:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803797:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80379b:	e9 0a ff ff ff       	jmp    8036aa <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8037a0:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8037a6:	e9 4d ff ff ff       	jmp    8036f8 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8037ab:	4c 89 ee             	mov    %r13,%rsi
+  8037ae:	bf 30 00 00 00       	mov    $0x30,%edi
+  8037b3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8037b6:	4c 89 ee             	mov    %r13,%rsi
+  8037b9:	bf 78 00 00 00       	mov    $0x78,%edi
+  8037be:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8037c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8037c7:	77 47                	ja     803810 <vprintfmt+0x646>
+  8037c9:	89 c2                	mov    %eax,%edx
+  8037cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037cf:	83 c0 08             	add    $0x8,%eax
+  8037d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037d5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8037d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8037dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8037e1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8037e5:	0f 94 c0             	sete   %al
+  8037e8:	0f b6 c0             	movzbl %al,%eax
+  8037eb:	50                   	push   %rax
+  8037ec:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8037f1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8037f5:	4c 89 ee             	mov    %r13,%rsi
+  8037f8:	4c 89 f7             	mov    %r14,%rdi
+  8037fb:	48 b8 bf 30 80 00 00 	movabs $0x8030bf,%rax
+  803802:	00 00 00 
+  803805:	ff d0                	call   *%rax
+            break;
+  803807:	48 83 c4 10          	add    $0x10,%rsp
+  80380b:	e9 eb f9 ff ff       	jmp    8031fb <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803810:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803814:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803818:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80381c:	eb b7                	jmp    8037d5 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  80381e:	40 84 f6             	test   %sil,%sil
+  803821:	75 2b                	jne    80384e <vprintfmt+0x684>
+    switch (lflag) {
+  803823:	85 d2                	test   %edx,%edx
+  803825:	74 56                	je     80387d <vprintfmt+0x6b3>
+  803827:	83 fa 01             	cmp    $0x1,%edx
+  80382a:	74 7f                	je     8038ab <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  80382c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80382f:	83 f8 2f             	cmp    $0x2f,%eax
+  803832:	0f 87 a2 00 00 00    	ja     8038da <vprintfmt+0x710>
+  803838:	89 c2                	mov    %eax,%edx
+  80383a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80383e:	83 c0 08             	add    $0x8,%eax
+  803841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803844:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803847:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80384c:	eb 8f                	jmp    8037dd <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80384e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803851:	83 f8 2f             	cmp    $0x2f,%eax
+  803854:	77 19                	ja     80386f <vprintfmt+0x6a5>
+  803856:	89 c2                	mov    %eax,%edx
+  803858:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80385c:	83 c0 08             	add    $0x8,%eax
+  80385f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803862:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803865:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80386a:	e9 6e ff ff ff       	jmp    8037dd <vprintfmt+0x613>
+  80386f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803873:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803877:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80387b:	eb e5                	jmp    803862 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  80387d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803880:	83 f8 2f             	cmp    $0x2f,%eax
+  803883:	77 18                	ja     80389d <vprintfmt+0x6d3>
+  803885:	89 c2                	mov    %eax,%edx
+  803887:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80388b:	83 c0 08             	add    $0x8,%eax
+  80388e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803891:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803893:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803898:	e9 40 ff ff ff       	jmp    8037dd <vprintfmt+0x613>
+  80389d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038a9:	eb e6                	jmp    803891 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8038ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8038b1:	77 19                	ja     8038cc <vprintfmt+0x702>
+  8038b3:	89 c2                	mov    %eax,%edx
+  8038b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038b9:	83 c0 08             	add    $0x8,%eax
+  8038bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038bf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038c2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8038c7:	e9 11 ff ff ff       	jmp    8037dd <vprintfmt+0x613>
+  8038cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038d8:	eb e5                	jmp    8038bf <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  8038da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038e6:	e9 59 ff ff ff       	jmp    803844 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8038eb:	4c 89 ee             	mov    %r13,%rsi
+  8038ee:	bf 25 00 00 00       	mov    $0x25,%edi
+  8038f3:	41 ff d6             	call   *%r14
+            break;
+  8038f6:	e9 00 f9 ff ff       	jmp    8031fb <vprintfmt+0x31>
+            putch('%', put_arg);
+  8038fb:	4c 89 ee             	mov    %r13,%rsi
+  8038fe:	bf 25 00 00 00       	mov    $0x25,%edi
+  803903:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803906:	48 83 eb 01          	sub    $0x1,%rbx
+  80390a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80390e:	75 f6                	jne    803906 <vprintfmt+0x73c>
+  803910:	e9 e6 f8 ff ff       	jmp    8031fb <vprintfmt+0x31>
+}
+  803915:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803919:	5b                   	pop    %rbx
+  80391a:	41 5c                	pop    %r12
+  80391c:	41 5d                	pop    %r13
+  80391e:	41 5e                	pop    %r14
+  803920:	41 5f                	pop    %r15
+  803922:	5d                   	pop    %rbp
+  803923:	c3                   	ret
+
+0000000000803924 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803924:	55                   	push   %rbp
+  803925:	48 89 e5             	mov    %rsp,%rbp
+  803928:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80392c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803930:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803935:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803939:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803940:	48 85 ff             	test   %rdi,%rdi
+  803943:	74 2b                	je     803970 <vsnprintf+0x4c>
+  803945:	48 85 f6             	test   %rsi,%rsi
+  803948:	74 26                	je     803970 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80394a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80394e:	48 bf 75 31 80 00 00 	movabs $0x803175,%rdi
+  803955:	00 00 00 
+  803958:	48 b8 ca 31 80 00 00 	movabs $0x8031ca,%rax
+  80395f:	00 00 00 
+  803962:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803964:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803968:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80396b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80396e:	c9                   	leave
+  80396f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803970:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803975:	eb f7                	jmp    80396e <vsnprintf+0x4a>
+
+0000000000803977 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803977:	55                   	push   %rbp
+  803978:	48 89 e5             	mov    %rsp,%rbp
+  80397b:	48 83 ec 50          	sub    $0x50,%rsp
+  80397f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803983:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803987:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80398b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803992:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803996:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80399a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80399e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8039a2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8039a6:	48 b8 24 39 80 00 00 	movabs $0x803924,%rax
+  8039ad:	00 00 00 
+  8039b0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8039b2:	c9                   	leave
+  8039b3:	c3                   	ret
+
+00000000008039b4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8039b4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8039b7:	74 10                	je     8039c9 <strlen+0x15>
+    size_t n = 0;
+  8039b9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8039be:	48 83 c0 01          	add    $0x1,%rax
+  8039c2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8039c6:	75 f6                	jne    8039be <strlen+0xa>
+  8039c8:	c3                   	ret
+    size_t n = 0;
+  8039c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8039ce:	c3                   	ret
+
+00000000008039cf <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8039cf:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8039d2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8039d7:	48 85 f6             	test   %rsi,%rsi
+  8039da:	74 11                	je     8039ed <strnlen+0x1e>
+  8039dc:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8039e0:	74 0c                	je     8039ee <strnlen+0x1f>
+  8039e2:	48 83 c2 01          	add    $0x1,%rdx
+  8039e6:	48 39 d0             	cmp    %rdx,%rax
+  8039e9:	75 f1                	jne    8039dc <strnlen+0xd>
+  8039eb:	eb 04                	jmp    8039f1 <strnlen+0x22>
+  8039ed:	c3                   	ret
+  8039ee:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8039f1:	c3                   	ret
+
+00000000008039f2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8039f2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8039f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039fa:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8039fe:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803a01:	48 83 c2 01          	add    $0x1,%rdx
+  803a05:	84 c9                	test   %cl,%cl
+  803a07:	75 f1                	jne    8039fa <strcpy+0x8>
+        ;
+    return res;
+}
+  803a09:	c3                   	ret
+
+0000000000803a0a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803a0a:	55                   	push   %rbp
+  803a0b:	48 89 e5             	mov    %rsp,%rbp
+  803a0e:	41 54                	push   %r12
+  803a10:	53                   	push   %rbx
+  803a11:	48 89 fb             	mov    %rdi,%rbx
+  803a14:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a17:	48 b8 b4 39 80 00 00 	movabs $0x8039b4,%rax
+  803a1e:	00 00 00 
+  803a21:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a23:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a27:	4c 89 e6             	mov    %r12,%rsi
+  803a2a:	48 b8 f2 39 80 00 00 	movabs $0x8039f2,%rax
+  803a31:	00 00 00 
+  803a34:	ff d0                	call   *%rax
+    return dst;
+}
+  803a36:	48 89 d8             	mov    %rbx,%rax
+  803a39:	5b                   	pop    %rbx
+  803a3a:	41 5c                	pop    %r12
+  803a3c:	5d                   	pop    %rbp
+  803a3d:	c3                   	ret
+
+0000000000803a3e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803a3e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803a41:	48 85 d2             	test   %rdx,%rdx
+  803a44:	74 1f                	je     803a65 <strncpy+0x27>
+  803a46:	48 01 fa             	add    %rdi,%rdx
+  803a49:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803a4c:	48 83 c1 01          	add    $0x1,%rcx
+  803a50:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803a54:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803a58:	41 80 f8 01          	cmp    $0x1,%r8b
+  803a5c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803a60:	48 39 ca             	cmp    %rcx,%rdx
+  803a63:	75 e7                	jne    803a4c <strncpy+0xe>
+    }
+    return ret;
+}
+  803a65:	c3                   	ret
+
+0000000000803a66 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803a66:	48 89 f8             	mov    %rdi,%rax
+  803a69:	48 85 d2             	test   %rdx,%rdx
+  803a6c:	74 24                	je     803a92 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803a6e:	48 83 ea 01          	sub    $0x1,%rdx
+  803a72:	74 1b                	je     803a8f <strlcpy+0x29>
+  803a74:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803a78:	0f b6 16             	movzbl (%rsi),%edx
+  803a7b:	84 d2                	test   %dl,%dl
+  803a7d:	74 10                	je     803a8f <strlcpy+0x29>
+            *dst++ = *src++;
+  803a7f:	48 83 c6 01          	add    $0x1,%rsi
+  803a83:	48 83 c0 01          	add    $0x1,%rax
+  803a87:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803a8a:	48 39 c8             	cmp    %rcx,%rax
+  803a8d:	75 e9                	jne    803a78 <strlcpy+0x12>
+        *dst = '\0';
+  803a8f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803a92:	48 29 f8             	sub    %rdi,%rax
+}
+  803a95:	c3                   	ret
+
+0000000000803a96 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803a96:	0f b6 07             	movzbl (%rdi),%eax
+  803a99:	84 c0                	test   %al,%al
+  803a9b:	74 13                	je     803ab0 <strcmp+0x1a>
+  803a9d:	38 06                	cmp    %al,(%rsi)
+  803a9f:	75 0f                	jne    803ab0 <strcmp+0x1a>
+  803aa1:	48 83 c7 01          	add    $0x1,%rdi
+  803aa5:	48 83 c6 01          	add    $0x1,%rsi
+  803aa9:	0f b6 07             	movzbl (%rdi),%eax
+  803aac:	84 c0                	test   %al,%al
+  803aae:	75 ed                	jne    803a9d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ab0:	0f b6 c0             	movzbl %al,%eax
+  803ab3:	0f b6 16             	movzbl (%rsi),%edx
+  803ab6:	29 d0                	sub    %edx,%eax
+}
+  803ab8:	c3                   	ret
+
+0000000000803ab9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803ab9:	48 85 d2             	test   %rdx,%rdx
+  803abc:	74 1f                	je     803add <strncmp+0x24>
+  803abe:	0f b6 07             	movzbl (%rdi),%eax
+  803ac1:	84 c0                	test   %al,%al
+  803ac3:	74 1e                	je     803ae3 <strncmp+0x2a>
+  803ac5:	3a 06                	cmp    (%rsi),%al
+  803ac7:	75 1a                	jne    803ae3 <strncmp+0x2a>
+  803ac9:	48 83 c7 01          	add    $0x1,%rdi
+  803acd:	48 83 c6 01          	add    $0x1,%rsi
+  803ad1:	48 83 ea 01          	sub    $0x1,%rdx
+  803ad5:	75 e7                	jne    803abe <strncmp+0x5>
+
+    if (!n) return 0;
+  803ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803adc:	c3                   	ret
+  803add:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae2:	c3                   	ret
+  803ae3:	48 85 d2             	test   %rdx,%rdx
+  803ae6:	74 09                	je     803af1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ae8:	0f b6 07             	movzbl (%rdi),%eax
+  803aeb:	0f b6 16             	movzbl (%rsi),%edx
+  803aee:	29 d0                	sub    %edx,%eax
+  803af0:	c3                   	ret
+    if (!n) return 0;
+  803af1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803af6:	c3                   	ret
+
+0000000000803af7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803af7:	0f b6 17             	movzbl (%rdi),%edx
+  803afa:	84 d2                	test   %dl,%dl
+  803afc:	74 18                	je     803b16 <strchr+0x1f>
+        if (*str == c) {
+  803afe:	0f be d2             	movsbl %dl,%edx
+  803b01:	39 f2                	cmp    %esi,%edx
+  803b03:	74 17                	je     803b1c <strchr+0x25>
+    for (; *str; str++) {
+  803b05:	48 83 c7 01          	add    $0x1,%rdi
+  803b09:	0f b6 17             	movzbl (%rdi),%edx
+  803b0c:	84 d2                	test   %dl,%dl
+  803b0e:	75 ee                	jne    803afe <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b15:	c3                   	ret
+  803b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b1b:	c3                   	ret
+  803b1c:	48 89 f8             	mov    %rdi,%rax
+}
+  803b1f:	c3                   	ret
+
+0000000000803b20 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b20:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b23:	0f b6 17             	movzbl (%rdi),%edx
+  803b26:	84 d2                	test   %dl,%dl
+  803b28:	74 13                	je     803b3d <strfind+0x1d>
+  803b2a:	0f be d2             	movsbl %dl,%edx
+  803b2d:	39 f2                	cmp    %esi,%edx
+  803b2f:	74 0b                	je     803b3c <strfind+0x1c>
+  803b31:	48 83 c0 01          	add    $0x1,%rax
+  803b35:	0f b6 10             	movzbl (%rax),%edx
+  803b38:	84 d2                	test   %dl,%dl
+  803b3a:	75 ee                	jne    803b2a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803b3c:	c3                   	ret
+  803b3d:	c3                   	ret
+
+0000000000803b3e <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803b3e:	55                   	push   %rbp
+  803b3f:	48 89 e5             	mov    %rsp,%rbp
+  803b42:	41 57                	push   %r15
+  803b44:	41 56                	push   %r14
+  803b46:	41 55                	push   %r13
+  803b48:	41 54                	push   %r12
+  803b4a:	53                   	push   %rbx
+  803b4b:	48 83 ec 08          	sub    $0x8,%rsp
+  803b4f:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803b52:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803b56:	45 84 ed             	test   %r13b,%r13b
+  803b59:	75 12                	jne    803b6d <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803b5b:	4c 89 f8             	mov    %r15,%rax
+  803b5e:	48 83 c4 08          	add    $0x8,%rsp
+  803b62:	5b                   	pop    %rbx
+  803b63:	41 5c                	pop    %r12
+  803b65:	41 5d                	pop    %r13
+  803b67:	41 5e                	pop    %r14
+  803b69:	41 5f                	pop    %r15
+  803b6b:	5d                   	pop    %rbp
+  803b6c:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803b6d:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803b71:	4c 89 e7             	mov    %r12,%rdi
+  803b74:	48 b8 b4 39 80 00 00 	movabs $0x8039b4,%rax
+  803b7b:	00 00 00 
+  803b7e:	ff d0                	call   *%rax
+  803b80:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803b83:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803b87:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803b8b:	49 bf b9 3a 80 00 00 	movabs $0x803ab9,%r15
+  803b92:	00 00 00 
+				if ((sc = *s++) == 0)
+  803b95:	84 c0                	test   %al,%al
+  803b97:	75 14                	jne    803bad <strstr+0x6f>
+					return NULL;
+  803b99:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803b9f:	eb ba                	jmp    803b5b <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803ba1:	48 83 c3 01          	add    $0x1,%rbx
+  803ba5:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803ba9:	84 c0                	test   %al,%al
+  803bab:	74 1b                	je     803bc8 <strstr+0x8a>
+			} while (sc != c);
+  803bad:	41 38 c5             	cmp    %al,%r13b
+  803bb0:	75 ef                	jne    803ba1 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803bb2:	4c 89 f2             	mov    %r14,%rdx
+  803bb5:	4c 89 e6             	mov    %r12,%rsi
+  803bb8:	48 89 df             	mov    %rbx,%rdi
+  803bbb:	41 ff d7             	call   *%r15
+  803bbe:	85 c0                	test   %eax,%eax
+  803bc0:	75 df                	jne    803ba1 <strstr+0x63>
+  803bc2:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803bc6:	eb 93                	jmp    803b5b <strstr+0x1d>
+					return NULL;
+  803bc8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bce:	eb 8b                	jmp    803b5b <strstr+0x1d>
+
+0000000000803bd0 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803bd0:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803bd2:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803bd5:	8d 57 20             	lea    0x20(%rdi),%edx
+  803bd8:	83 f9 1a             	cmp    $0x1a,%ecx
+  803bdb:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803bde:	c3                   	ret
+
+0000000000803bdf <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803bdf:	55                   	push   %rbp
+  803be0:	48 89 e5             	mov    %rsp,%rbp
+  803be3:	41 57                	push   %r15
+  803be5:	41 56                	push   %r14
+  803be7:	41 55                	push   %r13
+  803be9:	41 54                	push   %r12
+  803beb:	53                   	push   %rbx
+  803bec:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803bf0:	48 39 f7             	cmp    %rsi,%rdi
+  803bf3:	74 49                	je     803c3e <strcasecmp+0x5f>
+  803bf5:	49 89 fd             	mov    %rdi,%r13
+  803bf8:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803bfb:	49 bf d0 3b 80 00 00 	movabs $0x803bd0,%r15
+  803c02:	00 00 00 
+  803c05:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803c0a:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c0e:	41 ff d7             	call   *%r15
+  803c11:	89 c3                	mov    %eax,%ebx
+  803c13:	49 83 c4 01          	add    $0x1,%r12
+  803c17:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c1d:	41 ff d7             	call   *%r15
+  803c20:	29 c3                	sub    %eax,%ebx
+  803c22:	75 09                	jne    803c2d <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c24:	49 83 c5 01          	add    $0x1,%r13
+  803c28:	45 84 f6             	test   %r14b,%r14b
+  803c2b:	75 d8                	jne    803c05 <strcasecmp+0x26>
+}
+  803c2d:	89 d8                	mov    %ebx,%eax
+  803c2f:	48 83 c4 08          	add    $0x8,%rsp
+  803c33:	5b                   	pop    %rbx
+  803c34:	41 5c                	pop    %r12
+  803c36:	41 5d                	pop    %r13
+  803c38:	41 5e                	pop    %r14
+  803c3a:	41 5f                	pop    %r15
+  803c3c:	5d                   	pop    %rbp
+  803c3d:	c3                   	ret
+        return 0;
+  803c3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c43:	eb e8                	jmp    803c2d <strcasecmp+0x4e>
+
+0000000000803c45 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c45:	55                   	push   %rbp
+  803c46:	48 89 e5             	mov    %rsp,%rbp
+  803c49:	41 57                	push   %r15
+  803c4b:	41 56                	push   %r14
+  803c4d:	41 55                	push   %r13
+  803c4f:	41 54                	push   %r12
+  803c51:	53                   	push   %rbx
+  803c52:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803c56:	48 85 d2             	test   %rdx,%rdx
+  803c59:	74 4f                	je     803caa <strncasecmp+0x65>
+  803c5b:	49 89 fc             	mov    %rdi,%r12
+  803c5e:	49 89 f5             	mov    %rsi,%r13
+  803c61:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803c65:	49 be d0 3b 80 00 00 	movabs $0x803bd0,%r14
+  803c6c:	00 00 00 
+  803c6f:	49 83 c4 01          	add    $0x1,%r12
+  803c73:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c79:	41 ff d6             	call   *%r14
+  803c7c:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803c7e:	49 83 c5 01          	add    $0x1,%r13
+  803c82:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803c87:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803c8a:	29 c3                	sub    %eax,%ebx
+  803c8c:	85 c0                	test   %eax,%eax
+  803c8e:	74 09                	je     803c99 <strncasecmp+0x54>
+  803c90:	85 db                	test   %ebx,%ebx
+  803c92:	75 05                	jne    803c99 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803c94:	4d 39 fc             	cmp    %r15,%r12
+  803c97:	75 d6                	jne    803c6f <strncasecmp+0x2a>
+}
+  803c99:	89 d8                	mov    %ebx,%eax
+  803c9b:	48 83 c4 08          	add    $0x8,%rsp
+  803c9f:	5b                   	pop    %rbx
+  803ca0:	41 5c                	pop    %r12
+  803ca2:	41 5d                	pop    %r13
+  803ca4:	41 5e                	pop    %r14
+  803ca6:	41 5f                	pop    %r15
+  803ca8:	5d                   	pop    %rbp
+  803ca9:	c3                   	ret
+    int d = 0;
+  803caa:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803caf:	eb e8                	jmp    803c99 <strncasecmp+0x54>
+
+0000000000803cb1 <toupper>:
+
+int toupper(int c) {
+  803cb1:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803cb3:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803cb6:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803cb9:	83 f9 1a             	cmp    $0x1a,%ecx
+  803cbc:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803cbf:	c3                   	ret
+
+0000000000803cc0 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803cc0:	83 ff 20             	cmp    $0x20,%edi
+  803cc3:	0f 94 c0             	sete   %al
+  803cc6:	0f b6 c0             	movzbl %al,%eax
+}
+  803cc9:	c3                   	ret
+
+0000000000803cca <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803cca:	89 f8                	mov    %edi,%eax
+  803ccc:	f7 d8                	neg    %eax
+  803cce:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803cd1:	c3                   	ret
+
+0000000000803cd2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803cd2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803cd5:	48 89 f8             	mov    %rdi,%rax
+  803cd8:	48 f7 d8             	neg    %rax
+  803cdb:	83 e0 07             	and    $0x7,%eax
+  803cde:	49 89 d1             	mov    %rdx,%r9
+  803ce1:	49 29 c1             	sub    %rax,%r9
+  803ce4:	78 36                	js     803d1c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803ce6:	40 0f b6 c6          	movzbl %sil,%eax
+  803cea:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803cf1:	01 01 01 
+  803cf4:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803cf8:	40 f6 c7 07          	test   $0x7,%dil
+  803cfc:	75 38                	jne    803d36 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803cfe:	4c 89 c9             	mov    %r9,%rcx
+  803d01:	48 c1 f9 03          	sar    $0x3,%rcx
+  803d05:	74 0c                	je     803d13 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803d07:	fc                   	cld
+  803d08:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803d0b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d0f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d13:	4d 85 c9             	test   %r9,%r9
+  803d16:	75 45                	jne    803d5d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d18:	4c 89 c0             	mov    %r8,%rax
+  803d1b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d1c:	48 85 d2             	test   %rdx,%rdx
+  803d1f:	74 f7                	je     803d18 <memset+0x46>
+  803d21:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d24:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d27:	48 83 c0 01          	add    $0x1,%rax
+  803d2b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d2f:	48 39 c2             	cmp    %rax,%rdx
+  803d32:	75 f3                	jne    803d27 <memset+0x55>
+  803d34:	eb e2                	jmp    803d18 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d36:	40 f6 c7 01          	test   $0x1,%dil
+  803d3a:	74 06                	je     803d42 <memset+0x70>
+  803d3c:	88 07                	mov    %al,(%rdi)
+  803d3e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d42:	40 f6 c7 02          	test   $0x2,%dil
+  803d46:	74 07                	je     803d4f <memset+0x7d>
+  803d48:	66 89 07             	mov    %ax,(%rdi)
+  803d4b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d4f:	40 f6 c7 04          	test   $0x4,%dil
+  803d53:	74 a9                	je     803cfe <memset+0x2c>
+  803d55:	89 07                	mov    %eax,(%rdi)
+  803d57:	48 83 c7 04          	add    $0x4,%rdi
+  803d5b:	eb a1                	jmp    803cfe <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d5d:	41 f6 c1 04          	test   $0x4,%r9b
+  803d61:	74 06                	je     803d69 <memset+0x97>
+  803d63:	89 07                	mov    %eax,(%rdi)
+  803d65:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d69:	41 f6 c1 02          	test   $0x2,%r9b
+  803d6d:	74 07                	je     803d76 <memset+0xa4>
+  803d6f:	66 89 07             	mov    %ax,(%rdi)
+  803d72:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803d76:	41 f6 c1 01          	test   $0x1,%r9b
+  803d7a:	74 9c                	je     803d18 <memset+0x46>
+  803d7c:	88 07                	mov    %al,(%rdi)
+  803d7e:	eb 98                	jmp    803d18 <memset+0x46>
+
+0000000000803d80 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803d80:	48 89 f8             	mov    %rdi,%rax
+  803d83:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803d86:	48 39 fe             	cmp    %rdi,%rsi
+  803d89:	73 3b                	jae    803dc6 <memmove+0x46>
+  803d8b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803d8f:	48 39 d7             	cmp    %rdx,%rdi
+  803d92:	73 32                	jae    803dc6 <memmove+0x46>
+        s += n;
+        d += n;
+  803d94:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803d98:	48 89 d6             	mov    %rdx,%rsi
+  803d9b:	48 09 fe             	or     %rdi,%rsi
+  803d9e:	48 09 ce             	or     %rcx,%rsi
+  803da1:	40 f6 c6 07          	test   $0x7,%sil
+  803da5:	75 12                	jne    803db9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803da7:	48 83 ef 08          	sub    $0x8,%rdi
+  803dab:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803daf:	48 c1 e9 03          	shr    $0x3,%rcx
+  803db3:	fd                   	std
+  803db4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803db7:	fc                   	cld
+  803db8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803db9:	48 83 ef 01          	sub    $0x1,%rdi
+  803dbd:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803dc1:	fd                   	std
+  803dc2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803dc4:	eb f1                	jmp    803db7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803dc6:	48 89 f2             	mov    %rsi,%rdx
+  803dc9:	48 09 c2             	or     %rax,%rdx
+  803dcc:	48 09 ca             	or     %rcx,%rdx
+  803dcf:	f6 c2 07             	test   $0x7,%dl
+  803dd2:	75 0c                	jne    803de0 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803dd4:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dd8:	48 89 c7             	mov    %rax,%rdi
+  803ddb:	fc                   	cld
+  803ddc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803ddf:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803de0:	48 89 c7             	mov    %rax,%rdi
+  803de3:	fc                   	cld
+  803de4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803de6:	c3                   	ret
+
+0000000000803de7 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803de7:	55                   	push   %rbp
+  803de8:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803deb:	48 b8 80 3d 80 00 00 	movabs $0x803d80,%rax
+  803df2:	00 00 00 
+  803df5:	ff d0                	call   *%rax
+}
+  803df7:	5d                   	pop    %rbp
+  803df8:	c3                   	ret
+
+0000000000803df9 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803df9:	55                   	push   %rbp
+  803dfa:	48 89 e5             	mov    %rsp,%rbp
+  803dfd:	41 57                	push   %r15
+  803dff:	41 56                	push   %r14
+  803e01:	41 55                	push   %r13
+  803e03:	41 54                	push   %r12
+  803e05:	53                   	push   %rbx
+  803e06:	48 83 ec 08          	sub    $0x8,%rsp
+  803e0a:	49 89 fe             	mov    %rdi,%r14
+  803e0d:	49 89 f7             	mov    %rsi,%r15
+  803e10:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e13:	48 89 f7             	mov    %rsi,%rdi
+  803e16:	48 b8 b4 39 80 00 00 	movabs $0x8039b4,%rax
+  803e1d:	00 00 00 
+  803e20:	ff d0                	call   *%rax
+  803e22:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e25:	48 89 de             	mov    %rbx,%rsi
+  803e28:	4c 89 f7             	mov    %r14,%rdi
+  803e2b:	48 b8 cf 39 80 00 00 	movabs $0x8039cf,%rax
+  803e32:	00 00 00 
+  803e35:	ff d0                	call   *%rax
+  803e37:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e3a:	48 39 c3             	cmp    %rax,%rbx
+  803e3d:	74 36                	je     803e75 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e3f:	48 89 d8             	mov    %rbx,%rax
+  803e42:	4c 29 e8             	sub    %r13,%rax
+  803e45:	49 39 c4             	cmp    %rax,%r12
+  803e48:	73 31                	jae    803e7b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803e4a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803e4f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e53:	4c 89 fe             	mov    %r15,%rsi
+  803e56:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  803e5d:	00 00 00 
+  803e60:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803e62:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803e66:	48 83 c4 08          	add    $0x8,%rsp
+  803e6a:	5b                   	pop    %rbx
+  803e6b:	41 5c                	pop    %r12
+  803e6d:	41 5d                	pop    %r13
+  803e6f:	41 5e                	pop    %r14
+  803e71:	41 5f                	pop    %r15
+  803e73:	5d                   	pop    %rbp
+  803e74:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e75:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803e79:	eb eb                	jmp    803e66 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803e7b:	48 83 eb 01          	sub    $0x1,%rbx
+  803e7f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e83:	48 89 da             	mov    %rbx,%rdx
+  803e86:	4c 89 fe             	mov    %r15,%rsi
+  803e89:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  803e90:	00 00 00 
+  803e93:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803e95:	49 01 de             	add    %rbx,%r14
+  803e98:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803e9d:	eb c3                	jmp    803e62 <strlcat+0x69>
+
+0000000000803e9f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803e9f:	48 85 d2             	test   %rdx,%rdx
+  803ea2:	74 2d                	je     803ed1 <memcmp+0x32>
+  803ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803ea9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803ead:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803eb2:	44 38 c1             	cmp    %r8b,%cl
+  803eb5:	75 0f                	jne    803ec6 <memcmp+0x27>
+    while (n-- > 0) {
+  803eb7:	48 83 c0 01          	add    $0x1,%rax
+  803ebb:	48 39 c2             	cmp    %rax,%rdx
+  803ebe:	75 e9                	jne    803ea9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803ec6:	0f b6 c1             	movzbl %cl,%eax
+  803ec9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803ecd:	44 29 c0             	sub    %r8d,%eax
+  803ed0:	c3                   	ret
+    return 0;
+  803ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed6:	c3                   	ret
+
+0000000000803ed7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803ed7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803edb:	48 39 c7             	cmp    %rax,%rdi
+  803ede:	73 0f                	jae    803eef <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803ee0:	40 38 37             	cmp    %sil,(%rdi)
+  803ee3:	74 0e                	je     803ef3 <memfind+0x1c>
+    for (; src < end; src++) {
+  803ee5:	48 83 c7 01          	add    $0x1,%rdi
+  803ee9:	48 39 f8             	cmp    %rdi,%rax
+  803eec:	75 f2                	jne    803ee0 <memfind+0x9>
+  803eee:	c3                   	ret
+  803eef:	48 89 f8             	mov    %rdi,%rax
+  803ef2:	c3                   	ret
+  803ef3:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803ef6:	c3                   	ret
+
+0000000000803ef7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803ef7:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803efa:	0f b6 37             	movzbl (%rdi),%esi
+  803efd:	40 80 fe 20          	cmp    $0x20,%sil
+  803f01:	74 06                	je     803f09 <strtol+0x12>
+  803f03:	40 80 fe 09          	cmp    $0x9,%sil
+  803f07:	75 13                	jne    803f1c <strtol+0x25>
+  803f09:	48 83 c7 01          	add    $0x1,%rdi
+  803f0d:	0f b6 37             	movzbl (%rdi),%esi
+  803f10:	40 80 fe 20          	cmp    $0x20,%sil
+  803f14:	74 f3                	je     803f09 <strtol+0x12>
+  803f16:	40 80 fe 09          	cmp    $0x9,%sil
+  803f1a:	74 ed                	je     803f09 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f1c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f1f:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f22:	3c 01                	cmp    $0x1,%al
+  803f24:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f28:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f2e:	75 0f                	jne    803f3f <strtol+0x48>
+  803f30:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f33:	74 14                	je     803f49 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f35:	85 d2                	test   %edx,%edx
+  803f37:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f3c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803f44:	4c 63 ca             	movslq %edx,%r9
+  803f47:	eb 36                	jmp    803f7f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f49:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803f4d:	74 0f                	je     803f5e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803f4f:	85 d2                	test   %edx,%edx
+  803f51:	75 ec                	jne    803f3f <strtol+0x48>
+        s++;
+  803f53:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803f57:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803f5c:	eb e1                	jmp    803f3f <strtol+0x48>
+        s += 2;
+  803f5e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803f62:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803f67:	eb d6                	jmp    803f3f <strtol+0x48>
+            dig -= '0';
+  803f69:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803f6c:	44 0f b6 c1          	movzbl %cl,%r8d
+  803f70:	41 39 d0             	cmp    %edx,%r8d
+  803f73:	7d 21                	jge    803f96 <strtol+0x9f>
+        val = val * base + dig;
+  803f75:	49 0f af c1          	imul   %r9,%rax
+  803f79:	0f b6 c9             	movzbl %cl,%ecx
+  803f7c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803f7f:	48 83 c7 01          	add    $0x1,%rdi
+  803f83:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803f87:	80 f9 39             	cmp    $0x39,%cl
+  803f8a:	76 dd                	jbe    803f69 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803f8c:	80 f9 7b             	cmp    $0x7b,%cl
+  803f8f:	77 05                	ja     803f96 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803f91:	83 e9 57             	sub    $0x57,%ecx
+  803f94:	eb d6                	jmp    803f6c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803f96:	4d 85 d2             	test   %r10,%r10
+  803f99:	74 03                	je     803f9e <strtol+0xa7>
+  803f9b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803f9e:	48 89 c2             	mov    %rax,%rdx
+  803fa1:	48 f7 da             	neg    %rdx
+  803fa4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803fa8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803fac:	c3                   	ret
+
+0000000000803fad <atoi>:
+int atoi(const char *str) {
+  803fad:	55                   	push   %rbp
+  803fae:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  803fb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fb6:	be 00 00 00 00       	mov    $0x0,%esi
+  803fbb:	48 b8 f7 3e 80 00 00 	movabs $0x803ef7,%rax
+  803fc2:	00 00 00 
+  803fc5:	ff d0                	call   *%rax
+}
+  803fc7:	5d                   	pop    %rbp
+  803fc8:	c3                   	ret
+
+0000000000803fc9 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fc9:	55                   	push   %rbp
+  803fca:	48 89 e5             	mov    %rsp,%rbp
+  803fcd:	41 55                	push   %r13
+  803fcf:	41 54                	push   %r12
+  803fd1:	53                   	push   %rbx
+  803fd2:	48 83 ec 08          	sub    $0x8,%rsp
+  803fd6:	49 89 fc             	mov    %rdi,%r12
+  803fd9:	48 89 f7             	mov    %rsi,%rdi
+  803fdc:	48 89 d3             	mov    %rdx,%rbx
+  803fdf:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803fe2:	48 85 f6             	test   %rsi,%rsi
+  803fe5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fec:	00 00 00 
+  803fef:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  803ff3:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ff8:	48 85 d2             	test   %rdx,%rdx
+  803ffb:	74 03                	je     804000 <ipc_recv+0x37>
+  803ffd:	48 8b 32             	mov    (%rdx),%rsi
+  804000:	48 b8 38 06 80 00 00 	movabs $0x800638,%rax
+  804007:	00 00 00 
+  80400a:	ff d0                	call   *%rax
+    if (errno) {
+  80400c:	85 c0                	test   %eax,%eax
+  80400e:	74 1c                	je     80402c <ipc_recv+0x63>
+        if (from_env_store)
+  804010:	4d 85 e4             	test   %r12,%r12
+  804013:	74 08                	je     80401d <ipc_recv+0x54>
+            *from_env_store = 0;
+  804015:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80401c:	00 
+
+        if (perm_store)
+  80401d:	4d 85 ed             	test   %r13,%r13
+  804020:	74 74                	je     804096 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804022:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804029:	00 
+  80402a:	eb 6a                	jmp    804096 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80402c:	4d 85 e4             	test   %r12,%r12
+  80402f:	74 14                	je     804045 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804031:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804038:	00 00 00 
+  80403b:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804041:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804045:	48 85 db             	test   %rbx,%rbx
+  804048:	74 23                	je     80406d <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80404a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804051:	00 00 00 
+  804054:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80405a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80405f:	85 c9                	test   %ecx,%ecx
+  804061:	74 07                	je     80406a <ipc_recv+0xa1>
+  804063:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80406a:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80406d:	4d 85 ed             	test   %r13,%r13
+  804070:	74 14                	je     804086 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804072:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804079:	00 00 00 
+  80407c:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804082:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804086:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80408d:	00 00 00 
+  804090:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804096:	48 83 c4 08          	add    $0x8,%rsp
+  80409a:	5b                   	pop    %rbx
+  80409b:	41 5c                	pop    %r12
+  80409d:	41 5d                	pop    %r13
+  80409f:	5d                   	pop    %rbp
+  8040a0:	c3                   	ret
+
+00000000008040a1 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040a1:	55                   	push   %rbp
+  8040a2:	48 89 e5             	mov    %rsp,%rbp
+  8040a5:	41 55                	push   %r13
+  8040a7:	41 54                	push   %r12
+  8040a9:	53                   	push   %rbx
+  8040aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8040ae:	49 89 fc             	mov    %rdi,%r12
+  8040b1:	48 89 f7             	mov    %rsi,%rdi
+  8040b4:	48 89 d3             	mov    %rdx,%rbx
+  8040b7:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040ba:	48 85 f6             	test   %rsi,%rsi
+  8040bd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040c4:	00 00 00 
+  8040c7:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040cb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040d0:	48 85 d2             	test   %rdx,%rdx
+  8040d3:	74 03                	je     8040d8 <ipc_try_recv+0x37>
+  8040d5:	48 8b 32             	mov    (%rdx),%rsi
+  8040d8:	48 b8 a1 06 80 00 00 	movabs $0x8006a1,%rax
+  8040df:	00 00 00 
+  8040e2:	ff d0                	call   *%rax
+    if (errno) {
+  8040e4:	85 c0                	test   %eax,%eax
+  8040e6:	75 75                	jne    80415d <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8040e8:	4d 85 e4             	test   %r12,%r12
+  8040eb:	74 14                	je     804101 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8040ed:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040f4:	00 00 00 
+  8040f7:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8040fd:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804101:	48 85 db             	test   %rbx,%rbx
+  804104:	74 23                	je     804129 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804106:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80410d:	00 00 00 
+  804110:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80411b:	85 c9                	test   %ecx,%ecx
+  80411d:	74 07                	je     804126 <ipc_try_recv+0x85>
+  80411f:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804126:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804129:	4d 85 ed             	test   %r13,%r13
+  80412c:	74 14                	je     804142 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80412e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804135:	00 00 00 
+  804138:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80413e:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804142:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804149:	00 00 00 
+  80414c:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804152:	48 83 c4 08          	add    $0x8,%rsp
+  804156:	5b                   	pop    %rbx
+  804157:	41 5c                	pop    %r12
+  804159:	41 5d                	pop    %r13
+  80415b:	5d                   	pop    %rbp
+  80415c:	c3                   	ret
+        if (from_env_store)
+  80415d:	4d 85 e4             	test   %r12,%r12
+  804160:	74 08                	je     80416a <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804162:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804169:	00 
+        if (perm_store)
+  80416a:	4d 85 ed             	test   %r13,%r13
+  80416d:	74 e3                	je     804152 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80416f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804176:	00 
+  804177:	eb d9                	jmp    804152 <ipc_try_recv+0xb1>
+
+0000000000804179 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804179:	55                   	push   %rbp
+  80417a:	48 89 e5             	mov    %rsp,%rbp
+  80417d:	41 57                	push   %r15
+  80417f:	41 56                	push   %r14
+  804181:	41 55                	push   %r13
+  804183:	41 54                	push   %r12
+  804185:	53                   	push   %rbx
+  804186:	48 83 ec 18          	sub    $0x18,%rsp
+  80418a:	41 89 fd             	mov    %edi,%r13d
+  80418d:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804190:	48 89 d3             	mov    %rdx,%rbx
+  804193:	49 89 cc             	mov    %rcx,%r12
+  804196:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80419a:	48 85 d2             	test   %rdx,%rdx
+  80419d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041a4:	00 00 00 
+  8041a7:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041ab:	49 be 0c 06 80 00 00 	movabs $0x80060c,%r14
+  8041b2:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041b5:	49 bf fc 01 80 00 00 	movabs $0x8001fc,%r15
+  8041bc:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041bf:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041c2:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041c6:	4c 89 e1             	mov    %r12,%rcx
+  8041c9:	48 89 da             	mov    %rbx,%rdx
+  8041cc:	44 89 ef             	mov    %r13d,%edi
+  8041cf:	41 ff d6             	call   *%r14
+  8041d2:	85 c0                	test   %eax,%eax
+  8041d4:	74 37                	je     80420d <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041d6:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041d9:	75 05                	jne    8041e0 <ipc_send+0x67>
+        sys_yield();
+  8041db:	41 ff d7             	call   *%r15
+  8041de:	eb df                	jmp    8041bf <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041e0:	89 c1                	mov    %eax,%ecx
+  8041e2:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  8041e9:	00 00 00 
+  8041ec:	be 65 00 00 00       	mov    $0x65,%esi
+  8041f1:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  8041f8:	00 00 00 
+  8041fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804200:	49 b8 2a 2f 80 00 00 	movabs $0x802f2a,%r8
+  804207:	00 00 00 
+  80420a:	41 ff d0             	call   *%r8
+    }
+}
+  80420d:	48 83 c4 18          	add    $0x18,%rsp
+  804211:	5b                   	pop    %rbx
+  804212:	41 5c                	pop    %r12
+  804214:	41 5d                	pop    %r13
+  804216:	41 5e                	pop    %r14
+  804218:	41 5f                	pop    %r15
+  80421a:	5d                   	pop    %rbp
+  80421b:	c3                   	ret
+
+000000000080421c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80421c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804221:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804228:	00 00 00 
+  80422b:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804232:	48 01 ca             	add    %rcx,%rdx
+  804235:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80423b:	39 fa                	cmp    %edi,%edx
+  80423d:	74 12                	je     804251 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80423f:	48 83 c0 01          	add    $0x1,%rax
+  804243:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804249:	75 e0                	jne    80422b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80424b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804250:	c3                   	ret
+            return envs[i].env_id;
+  804251:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804258:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80425f:	00 00 00 
+  804262:	48 01 d0             	add    %rdx,%rax
+  804265:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80426b:	c3                   	ret
+
+000000000080426c <__text_end>:
+  80426c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804273:	00 00 00 
+  804276:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80427d:	00 00 00 
+  804280:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804287:	00 00 00 
+  80428a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804291:	00 00 00 
+  804294:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429b:	00 00 00 
+  80429e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a5:	00 00 00 
+  8042a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042af:	00 00 00 
+  8042b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b9:	00 00 00 
+  8042bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c3:	00 00 00 
+  8042c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cd:	00 00 00 
+  8042d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d7:	00 00 00 
+  8042da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e1:	00 00 00 
+  8042e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042eb:	00 00 00 
+  8042ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f5:	00 00 00 
+  8042f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ff:	00 00 00 
+  804302:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804309:	00 00 00 
+  80430c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804313:	00 00 00 
+  804316:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431d:	00 00 00 
+  804320:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804327:	00 00 00 
+  80432a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804331:	00 00 00 
+  804334:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433b:	00 00 00 
+  80433e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804345:	00 00 00 
+  804348:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434f:	00 00 00 
+  804352:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804359:	00 00 00 
+  80435c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804363:	00 00 00 
+  804366:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436d:	00 00 00 
+  804370:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804377:	00 00 00 
+  80437a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804381:	00 00 00 
+  804384:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438b:	00 00 00 
+  80438e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804395:	00 00 00 
+  804398:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439f:	00 00 00 
+  8043a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a9:	00 00 00 
+  8043ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b3:	00 00 00 
+  8043b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bd:	00 00 00 
+  8043c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c7:	00 00 00 
+  8043ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d1:	00 00 00 
+  8043d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043db:	00 00 00 
+  8043de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e5:	00 00 00 
+  8043e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ef:	00 00 00 
+  8043f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f9:	00 00 00 
+  8043fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804403:	00 00 00 
+  804406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440d:	00 00 00 
+  804410:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804417:	00 00 00 
+  80441a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804421:	00 00 00 
+  804424:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442b:	00 00 00 
+  80442e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804435:	00 00 00 
+  804438:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443f:	00 00 00 
+  804442:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804449:	00 00 00 
+  80444c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804453:	00 00 00 
+  804456:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445d:	00 00 00 
+  804460:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804467:	00 00 00 
+  80446a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804471:	00 00 00 
+  804474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447b:	00 00 00 
+  80447e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804485:	00 00 00 
+  804488:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448f:	00 00 00 
+  804492:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804499:	00 00 00 
+  80449c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a3:	00 00 00 
+  8044a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ad:	00 00 00 
+  8044b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b7:	00 00 00 
+  8044ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c1:	00 00 00 
+  8044c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cb:	00 00 00 
+  8044ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d5:	00 00 00 
+  8044d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044df:	00 00 00 
+  8044e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e9:	00 00 00 
+  8044ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f3:	00 00 00 
+  8044f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fd:	00 00 00 
+  804500:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804507:	00 00 00 
+  80450a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804511:	00 00 00 
+  804514:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451b:	00 00 00 
+  80451e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804525:	00 00 00 
+  804528:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452f:	00 00 00 
+  804532:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804539:	00 00 00 
+  80453c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804543:	00 00 00 
+  804546:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454d:	00 00 00 
+  804550:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804557:	00 00 00 
+  80455a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804561:	00 00 00 
+  804564:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456b:	00 00 00 
+  80456e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804575:	00 00 00 
+  804578:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457f:	00 00 00 
+  804582:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804589:	00 00 00 
+  80458c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804593:	00 00 00 
+  804596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459d:	00 00 00 
+  8045a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a7:	00 00 00 
+  8045aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b1:	00 00 00 
+  8045b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bb:	00 00 00 
+  8045be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c5:	00 00 00 
+  8045c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cf:	00 00 00 
+  8045d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d9:	00 00 00 
+  8045dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e3:	00 00 00 
+  8045e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ed:	00 00 00 
+  8045f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f7:	00 00 00 
+  8045fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804601:	00 00 00 
+  804604:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460b:	00 00 00 
+  80460e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804615:	00 00 00 
+  804618:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461f:	00 00 00 
+  804622:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804629:	00 00 00 
+  80462c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804633:	00 00 00 
+  804636:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463d:	00 00 00 
+  804640:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804647:	00 00 00 
+  80464a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804651:	00 00 00 
+  804654:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465b:	00 00 00 
+  80465e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804665:	00 00 00 
+  804668:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466f:	00 00 00 
+  804672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804679:	00 00 00 
+  80467c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804683:	00 00 00 
+  804686:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468d:	00 00 00 
+  804690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804697:	00 00 00 
+  80469a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a1:	00 00 00 
+  8046a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ab:	00 00 00 
+  8046ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b5:	00 00 00 
+  8046b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bf:	00 00 00 
+  8046c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c9:	00 00 00 
+  8046cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d3:	00 00 00 
+  8046d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dd:	00 00 00 
+  8046e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e7:	00 00 00 
+  8046ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f1:	00 00 00 
+  8046f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fb:	00 00 00 
+  8046fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804705:	00 00 00 
+  804708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470f:	00 00 00 
+  804712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804719:	00 00 00 
+  80471c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804723:	00 00 00 
+  804726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472d:	00 00 00 
+  804730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804737:	00 00 00 
+  80473a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804741:	00 00 00 
+  804744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474b:	00 00 00 
+  80474e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804755:	00 00 00 
+  804758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475f:	00 00 00 
+  804762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804769:	00 00 00 
+  80476c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804773:	00 00 00 
+  804776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477d:	00 00 00 
+  804780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804787:	00 00 00 
+  80478a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804791:	00 00 00 
+  804794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479b:	00 00 00 
+  80479e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a5:	00 00 00 
+  8047a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047af:	00 00 00 
+  8047b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b9:	00 00 00 
+  8047bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c3:	00 00 00 
+  8047c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cd:	00 00 00 
+  8047d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d7:	00 00 00 
+  8047da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e1:	00 00 00 
+  8047e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047eb:	00 00 00 
+  8047ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f5:	00 00 00 
+  8047f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ff:	00 00 00 
+  804802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804809:	00 00 00 
+  80480c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804813:	00 00 00 
+  804816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481d:	00 00 00 
+  804820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804827:	00 00 00 
+  80482a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804831:	00 00 00 
+  804834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483b:	00 00 00 
+  80483e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804845:	00 00 00 
+  804848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484f:	00 00 00 
+  804852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804859:	00 00 00 
+  80485c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804863:	00 00 00 
+  804866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486d:	00 00 00 
+  804870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804877:	00 00 00 
+  80487a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804881:	00 00 00 
+  804884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488b:	00 00 00 
+  80488e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804895:	00 00 00 
+  804898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489f:	00 00 00 
+  8048a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a9:	00 00 00 
+  8048ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b3:	00 00 00 
+  8048b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bd:	00 00 00 
+  8048c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c7:	00 00 00 
+  8048ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d1:	00 00 00 
+  8048d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048db:	00 00 00 
+  8048de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e5:	00 00 00 
+  8048e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ef:	00 00 00 
+  8048f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f9:	00 00 00 
+  8048fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804903:	00 00 00 
+  804906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490d:	00 00 00 
+  804910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804917:	00 00 00 
+  80491a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804921:	00 00 00 
+  804924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492b:	00 00 00 
+  80492e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804935:	00 00 00 
+  804938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493f:	00 00 00 
+  804942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804949:	00 00 00 
+  80494c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804953:	00 00 00 
+  804956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495d:	00 00 00 
+  804960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804967:	00 00 00 
+  80496a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804971:	00 00 00 
+  804974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497b:	00 00 00 
+  80497e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804985:	00 00 00 
+  804988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498f:	00 00 00 
+  804992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804999:	00 00 00 
+  80499c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a3:	00 00 00 
+  8049a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ad:	00 00 00 
+  8049b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b7:	00 00 00 
+  8049ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c1:	00 00 00 
+  8049c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cb:	00 00 00 
+  8049ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d5:	00 00 00 
+  8049d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049df:	00 00 00 
+  8049e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e9:	00 00 00 
+  8049ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f3:	00 00 00 
+  8049f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fd:	00 00 00 
+  804a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a07:	00 00 00 
+  804a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a11:	00 00 00 
+  804a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1b:	00 00 00 
+  804a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a25:	00 00 00 
+  804a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2f:	00 00 00 
+  804a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a39:	00 00 00 
+  804a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a43:	00 00 00 
+  804a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4d:	00 00 00 
+  804a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a57:	00 00 00 
+  804a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a61:	00 00 00 
+  804a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6b:	00 00 00 
+  804a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a75:	00 00 00 
+  804a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7f:	00 00 00 
+  804a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a89:	00 00 00 
+  804a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a93:	00 00 00 
+  804a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9d:	00 00 00 
+  804aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa7:	00 00 00 
+  804aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab1:	00 00 00 
+  804ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abb:	00 00 00 
+  804abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac5:	00 00 00 
+  804ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acf:	00 00 00 
+  804ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad9:	00 00 00 
+  804adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae3:	00 00 00 
+  804ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aed:	00 00 00 
+  804af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af7:	00 00 00 
+  804afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b01:	00 00 00 
+  804b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0b:	00 00 00 
+  804b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b15:	00 00 00 
+  804b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1f:	00 00 00 
+  804b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b29:	00 00 00 
+  804b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b33:	00 00 00 
+  804b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3d:	00 00 00 
+  804b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b47:	00 00 00 
+  804b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b51:	00 00 00 
+  804b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5b:	00 00 00 
+  804b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b65:	00 00 00 
+  804b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6f:	00 00 00 
+  804b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b79:	00 00 00 
+  804b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b83:	00 00 00 
+  804b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8d:	00 00 00 
+  804b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b97:	00 00 00 
+  804b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba1:	00 00 00 
+  804ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bab:	00 00 00 
+  804bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb5:	00 00 00 
+  804bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbf:	00 00 00 
+  804bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc9:	00 00 00 
+  804bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd3:	00 00 00 
+  804bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdd:	00 00 00 
+  804be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be7:	00 00 00 
+  804bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf1:	00 00 00 
+  804bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfb:	00 00 00 
+  804bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c05:	00 00 00 
+  804c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0f:	00 00 00 
+  804c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c19:	00 00 00 
+  804c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c23:	00 00 00 
+  804c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2d:	00 00 00 
+  804c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c37:	00 00 00 
+  804c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c41:	00 00 00 
+  804c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4b:	00 00 00 
+  804c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c55:	00 00 00 
+  804c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5f:	00 00 00 
+  804c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c69:	00 00 00 
+  804c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c73:	00 00 00 
+  804c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7d:	00 00 00 
+  804c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c87:	00 00 00 
+  804c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c91:	00 00 00 
+  804c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9b:	00 00 00 
+  804c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca5:	00 00 00 
+  804ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caf:	00 00 00 
+  804cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb9:	00 00 00 
+  804cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc3:	00 00 00 
+  804cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccd:	00 00 00 
+  804cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd7:	00 00 00 
+  804cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce1:	00 00 00 
+  804ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ceb:	00 00 00 
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cff:	00 00 00 
+  804d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d09:	00 00 00 
+  804d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d13:	00 00 00 
+  804d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1d:	00 00 00 
+  804d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d27:	00 00 00 
+  804d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d31:	00 00 00 
+  804d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3b:	00 00 00 
+  804d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d45:	00 00 00 
+  804d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4f:	00 00 00 
+  804d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d59:	00 00 00 
+  804d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d63:	00 00 00 
+  804d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6d:	00 00 00 
+  804d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d77:	00 00 00 
+  804d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d81:	00 00 00 
+  804d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8b:	00 00 00 
+  804d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d95:	00 00 00 
+  804d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9f:	00 00 00 
+  804da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da9:	00 00 00 
+  804dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db3:	00 00 00 
+  804db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbd:	00 00 00 
+  804dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc7:	00 00 00 
+  804dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd1:	00 00 00 
+  804dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddb:	00 00 00 
+  804dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de5:	00 00 00 
+  804de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804def:	00 00 00 
+  804df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df9:	00 00 00 
+  804dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e03:	00 00 00 
+  804e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0d:	00 00 00 
+  804e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e17:	00 00 00 
+  804e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e21:	00 00 00 
+  804e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2b:	00 00 00 
+  804e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e35:	00 00 00 
+  804e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3f:	00 00 00 
+  804e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e49:	00 00 00 
+  804e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e53:	00 00 00 
+  804e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5d:	00 00 00 
+  804e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e67:	00 00 00 
+  804e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e71:	00 00 00 
+  804e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7b:	00 00 00 
+  804e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e85:	00 00 00 
+  804e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8f:	00 00 00 
+  804e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e99:	00 00 00 
+  804e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea3:	00 00 00 
+  804ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ead:	00 00 00 
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
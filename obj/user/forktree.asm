@@ -0,0 +1,8200 @@
+
+obj/user/forktree:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ff 00 00 00       	call   800122 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <forktree>:
+        exit();
+    }
+}
+
+void
+forktree(const char *cur) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 89 fb             	mov    %rdi,%rbx
+    cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80002f:	48 b8 b3 12 80 00 00 	movabs $0x8012b3,%rax
+  800036:	00 00 00 
+  800039:	ff d0                	call   *%rax
+  80003b:	89 c6                	mov    %eax,%esi
+  80003d:	48 89 da             	mov    %rbx,%rdx
+  800040:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 b9 9b 02 80 00 00 	movabs $0x80029b,%rcx
+  800056:	00 00 00 
+  800059:	ff d1                	call   *%rcx
+
+    forkchild(cur, '0');
+  80005b:	be 30 00 00 00       	mov    $0x30,%esi
+  800060:	48 89 df             	mov    %rbx,%rdi
+  800063:	49 bc 80 00 80 00 00 	movabs $0x800080,%r12
+  80006a:	00 00 00 
+  80006d:	41 ff d4             	call   *%r12
+    forkchild(cur, '1');
+  800070:	be 31 00 00 00       	mov    $0x31,%esi
+  800075:	48 89 df             	mov    %rbx,%rdi
+  800078:	41 ff d4             	call   *%r12
+}
+  80007b:	5b                   	pop    %rbx
+  80007c:	41 5c                	pop    %r12
+  80007e:	5d                   	pop    %rbp
+  80007f:	c3                   	ret
+
+0000000000800080 <forkchild>:
+forkchild(const char *cur, char branch) {
+  800080:	55                   	push   %rbp
+  800081:	48 89 e5             	mov    %rsp,%rbp
+  800084:	41 54                	push   %r12
+  800086:	53                   	push   %rbx
+  800087:	48 83 ec 10          	sub    $0x10,%rsp
+  80008b:	48 89 fb             	mov    %rdi,%rbx
+  80008e:	41 89 f4             	mov    %esi,%r12d
+    if (strlen(cur) >= DEPTH)
+  800091:	48 b8 d5 0b 80 00 00 	movabs $0x800bd5,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	48 83 f8 02          	cmp    $0x2,%rax
+  8000a1:	76 09                	jbe    8000ac <forkchild+0x2c>
+}
+  8000a3:	48 83 c4 10          	add    $0x10,%rsp
+  8000a7:	5b                   	pop    %rbx
+  8000a8:	41 5c                	pop    %r12
+  8000aa:	5d                   	pop    %rbp
+  8000ab:	c3                   	ret
+    snprintf(nxt, DEPTH + 1, "%s%c", cur, branch);
+  8000ac:	45 0f be c4          	movsbl %r12b,%r8d
+  8000b0:	48 89 d9             	mov    %rbx,%rcx
+  8000b3:	48 ba 11 50 80 00 00 	movabs $0x805011,%rdx
+  8000ba:	00 00 00 
+  8000bd:	be 04 00 00 00       	mov    $0x4,%esi
+  8000c2:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cb:	49 b9 98 0b 80 00 00 	movabs $0x800b98,%r9
+  8000d2:	00 00 00 
+  8000d5:	41 ff d1             	call   *%r9
+    if (fork() == 0) {
+  8000d8:	48 b8 89 1d 80 00 00 	movabs $0x801d89,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	75 bb                	jne    8000a3 <forkchild+0x23>
+        forktree(nxt);
+  8000e8:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000ec:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        exit();
+  8000f8:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+  800104:	eb 9d                	jmp    8000a3 <forkchild+0x23>
+
+0000000000800106 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800106:	55                   	push   %rbp
+  800107:	48 89 e5             	mov    %rsp,%rbp
+    forktree("");
+  80010a:	48 bf 10 50 80 00 00 	movabs $0x805010,%rdi
+  800111:	00 00 00 
+  800114:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+}
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+
+0000000000800122 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800122:	55                   	push   %rbp
+  800123:	48 89 e5             	mov    %rsp,%rbp
+  800126:	41 56                	push   %r14
+  800128:	41 55                	push   %r13
+  80012a:	41 54                	push   %r12
+  80012c:	53                   	push   %rbx
+  80012d:	41 89 fd             	mov    %edi,%r13d
+  800130:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800133:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80013a:	00 00 00 
+  80013d:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800144:	00 00 00 
+  800147:	48 39 c2             	cmp    %rax,%rdx
+  80014a:	73 17                	jae    800163 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80014c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80014f:	49 89 c4             	mov    %rax,%r12
+  800152:	48 83 c3 08          	add    $0x8,%rbx
+  800156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015b:	ff 53 f8             	call   *-0x8(%rbx)
+  80015e:	4c 39 e3             	cmp    %r12,%rbx
+  800161:	72 ef                	jb     800152 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800163:	48 b8 b3 12 80 00 00 	movabs $0x8012b3,%rax
+  80016a:	00 00 00 
+  80016d:	ff d0                	call   *%rax
+  80016f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800174:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80017b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800182:	00 00 00 
+  800185:	48 01 d0             	add    %rdx,%rax
+  800188:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  80018f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800192:	45 85 ed             	test   %r13d,%r13d
+  800195:	7e 0d                	jle    8001a4 <libmain+0x82>
+  800197:	49 8b 06             	mov    (%r14),%rax
+  80019a:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001a1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001a4:	4c 89 f6             	mov    %r14,%rsi
+  8001a7:	44 89 ef             	mov    %r13d,%edi
+  8001aa:	48 b8 06 01 80 00 00 	movabs $0x800106,%rax
+  8001b1:	00 00 00 
+  8001b4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001b6:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  8001bd:	00 00 00 
+  8001c0:	ff d0                	call   *%rax
+#endif
+}
+  8001c2:	5b                   	pop    %rbx
+  8001c3:	41 5c                	pop    %r12
+  8001c5:	41 5d                	pop    %r13
+  8001c7:	41 5e                	pop    %r14
+  8001c9:	5d                   	pop    %rbp
+  8001ca:	c3                   	ret
+
+00000000008001cb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001cf:	48 b8 bd 20 80 00 00 	movabs $0x8020bd,%rax
+  8001d6:	00 00 00 
+  8001d9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e0:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+}
+  8001ec:	5d                   	pop    %rbp
+  8001ed:	c3                   	ret
+
+00000000008001ee <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001ee:	55                   	push   %rbp
+  8001ef:	48 89 e5             	mov    %rsp,%rbp
+  8001f2:	53                   	push   %rbx
+  8001f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8001f7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001fa:	8b 06                	mov    (%rsi),%eax
+  8001fc:	8d 50 01             	lea    0x1(%rax),%edx
+  8001ff:	89 16                	mov    %edx,(%rsi)
+  800201:	48 98                	cltq
+  800203:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800208:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80020e:	74 0a                	je     80021a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800210:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800214:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800218:	c9                   	leave
+  800219:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80021a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80021e:	be ff 00 00 00       	mov    $0xff,%esi
+  800223:	48 b8 ea 11 80 00 00 	movabs $0x8011ea,%rax
+  80022a:	00 00 00 
+  80022d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80022f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800235:	eb d9                	jmp    800210 <putch+0x22>
+
+0000000000800237 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800237:	55                   	push   %rbp
+  800238:	48 89 e5             	mov    %rsp,%rbp
+  80023b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800242:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800245:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80024c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800251:	b8 00 00 00 00       	mov    $0x0,%eax
+  800256:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800259:	48 89 f1             	mov    %rsi,%rcx
+  80025c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800263:	48 bf ee 01 80 00 00 	movabs $0x8001ee,%rdi
+  80026a:	00 00 00 
+  80026d:	48 b8 eb 03 80 00 00 	movabs $0x8003eb,%rax
+  800274:	00 00 00 
+  800277:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800279:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800280:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800287:	48 b8 ea 11 80 00 00 	movabs $0x8011ea,%rax
+  80028e:	00 00 00 
+  800291:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800293:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+
+000000000080029b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	48 83 ec 50          	sub    $0x50,%rsp
+  8002a3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002a7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002ab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002af:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002b3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002b7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002ce:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002d2:	48 b8 37 02 80 00 00 	movabs $0x800237,%rax
+  8002d9:	00 00 00 
+  8002dc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002de:	c9                   	leave
+  8002df:	c3                   	ret
+
+00000000008002e0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002e0:	55                   	push   %rbp
+  8002e1:	48 89 e5             	mov    %rsp,%rbp
+  8002e4:	41 57                	push   %r15
+  8002e6:	41 56                	push   %r14
+  8002e8:	41 55                	push   %r13
+  8002ea:	41 54                	push   %r12
+  8002ec:	53                   	push   %rbx
+  8002ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8002f1:	49 89 fc             	mov    %rdi,%r12
+  8002f4:	49 89 f5             	mov    %rsi,%r13
+  8002f7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002fb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002fe:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800301:	41 89 cf             	mov    %ecx,%r15d
+  800304:	4c 39 fa             	cmp    %r15,%rdx
+  800307:	73 5b                	jae    800364 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800309:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80030d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800311:	85 db                	test   %ebx,%ebx
+  800313:	7e 0e                	jle    800323 <print_num+0x43>
+            putch(padc, put_arg);
+  800315:	4c 89 ee             	mov    %r13,%rsi
+  800318:	44 89 f7             	mov    %r14d,%edi
+  80031b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80031e:	83 eb 01             	sub    $0x1,%ebx
+  800321:	75 f2                	jne    800315 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800323:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800327:	48 b9 31 50 80 00 00 	movabs $0x805031,%rcx
+  80032e:	00 00 00 
+  800331:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  800338:	00 00 00 
+  80033b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80033f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800343:	ba 00 00 00 00       	mov    $0x0,%edx
+  800348:	49 f7 f7             	div    %r15
+  80034b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80034f:	4c 89 ee             	mov    %r13,%rsi
+  800352:	41 ff d4             	call   *%r12
+}
+  800355:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800359:	5b                   	pop    %rbx
+  80035a:	41 5c                	pop    %r12
+  80035c:	41 5d                	pop    %r13
+  80035e:	41 5e                	pop    %r14
+  800360:	41 5f                	pop    %r15
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800364:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800368:	ba 00 00 00 00       	mov    $0x0,%edx
+  80036d:	49 f7 f7             	div    %r15
+  800370:	48 83 ec 08          	sub    $0x8,%rsp
+  800374:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800378:	52                   	push   %rdx
+  800379:	45 0f be c9          	movsbl %r9b,%r9d
+  80037d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800381:	48 89 c2             	mov    %rax,%rdx
+  800384:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  80038b:	00 00 00 
+  80038e:	ff d0                	call   *%rax
+  800390:	48 83 c4 10          	add    $0x10,%rsp
+  800394:	eb 8d                	jmp    800323 <print_num+0x43>
+
+0000000000800396 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800396:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80039a:	48 8b 06             	mov    (%rsi),%rax
+  80039d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003a1:	73 0a                	jae    8003ad <sprintputch+0x17>
+        *state->start++ = ch;
+  8003a3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003a7:	48 89 16             	mov    %rdx,(%rsi)
+  8003aa:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003ad:	c3                   	ret
+
+00000000008003ae <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003ae:	55                   	push   %rbp
+  8003af:	48 89 e5             	mov    %rsp,%rbp
+  8003b2:	48 83 ec 50          	sub    $0x50,%rsp
+  8003b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003ba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003be:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003c2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003d9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003dd:	48 b8 eb 03 80 00 00 	movabs $0x8003eb,%rax
+  8003e4:	00 00 00 
+  8003e7:	ff d0                	call   *%rax
+}
+  8003e9:	c9                   	leave
+  8003ea:	c3                   	ret
+
+00000000008003eb <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003eb:	55                   	push   %rbp
+  8003ec:	48 89 e5             	mov    %rsp,%rbp
+  8003ef:	41 57                	push   %r15
+  8003f1:	41 56                	push   %r14
+  8003f3:	41 55                	push   %r13
+  8003f5:	41 54                	push   %r12
+  8003f7:	53                   	push   %rbx
+  8003f8:	48 83 ec 38          	sub    $0x38,%rsp
+  8003fc:	49 89 fe             	mov    %rdi,%r14
+  8003ff:	49 89 f5             	mov    %rsi,%r13
+  800402:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800405:	48 8b 01             	mov    (%rcx),%rax
+  800408:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80040c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800410:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800414:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800418:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80041c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800420:	0f b6 3b             	movzbl (%rbx),%edi
+  800423:	40 80 ff 25          	cmp    $0x25,%dil
+  800427:	74 18                	je     800441 <vprintfmt+0x56>
+            if (!ch) return;
+  800429:	40 84 ff             	test   %dil,%dil
+  80042c:	0f 84 04 07 00 00    	je     800b36 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800432:	40 0f b6 ff          	movzbl %dil,%edi
+  800436:	4c 89 ee             	mov    %r13,%rsi
+  800439:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80043c:	4c 89 e3             	mov    %r12,%rbx
+  80043f:	eb db                	jmp    80041c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800441:	be 00 00 00 00       	mov    $0x0,%esi
+  800446:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80044a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80044f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800455:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80045c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800460:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800465:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80046a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80046d:	83 e8 23             	sub    $0x23,%eax
+  800470:	3c 57                	cmp    $0x57,%al
+  800472:	0f 87 a4 06 00 00    	ja     800b1c <vprintfmt+0x731>
+  800478:	0f b6 c0             	movzbl %al,%eax
+  80047b:	48 b9 c0 51 80 00 00 	movabs $0x8051c0,%rcx
+  800482:	00 00 00 
+  800485:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800488:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80048b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80048f:	eb cf                	jmp    800460 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800491:	49 89 dc             	mov    %rbx,%r12
+  800494:	be 01 00 00 00       	mov    $0x1,%esi
+  800499:	eb c5                	jmp    800460 <vprintfmt+0x75>
+            padc = ch;
+  80049b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80049f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a5:	eb b9                	jmp    800460 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ad:	77 24                	ja     8004d3 <vprintfmt+0xe8>
+  8004af:	89 c1                	mov    %eax,%ecx
+  8004b1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004b5:	83 c0 08             	add    $0x8,%eax
+  8004b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004bb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004be:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004c1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004c5:	79 99                	jns    800460 <vprintfmt+0x75>
+                width = precision;
+  8004c7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004cb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004d1:	eb 8d                	jmp    800460 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004d3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004d7:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004df:	eb da                	jmp    8004bb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004e1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004e6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004ea:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004f0:	3c 39                	cmp    $0x39,%al
+  8004f2:	77 1c                	ja     800510 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004f4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004f8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004fc:	0f b6 c0             	movzbl %al,%eax
+  8004ff:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800504:	0f b6 03             	movzbl (%rbx),%eax
+  800507:	3c 39                	cmp    $0x39,%al
+  800509:	76 e9                	jbe    8004f4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80050b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80050e:	eb b1                	jmp    8004c1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800510:	49 89 dc             	mov    %rbx,%r12
+  800513:	eb ac                	jmp    8004c1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800515:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800518:	85 c9                	test   %ecx,%ecx
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	0f 49 c1             	cmovns %ecx,%eax
+  800522:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800525:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800528:	e9 33 ff ff ff       	jmp    800460 <vprintfmt+0x75>
+            lflag++;
+  80052d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800530:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800533:	e9 28 ff ff ff       	jmp    800460 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800538:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053b:	83 f8 2f             	cmp    $0x2f,%eax
+  80053e:	77 19                	ja     800559 <vprintfmt+0x16e>
+  800540:	89 c2                	mov    %eax,%edx
+  800542:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800546:	83 c0 08             	add    $0x8,%eax
+  800549:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80054c:	8b 3a                	mov    (%rdx),%edi
+  80054e:	4c 89 ee             	mov    %r13,%rsi
+  800551:	41 ff d6             	call   *%r14
+            break;
+  800554:	e9 c3 fe ff ff       	jmp    80041c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800559:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80055d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800561:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800565:	eb e5                	jmp    80054c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800567:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80056a:	83 f8 2f             	cmp    $0x2f,%eax
+  80056d:	77 5a                	ja     8005c9 <vprintfmt+0x1de>
+  80056f:	89 c2                	mov    %eax,%edx
+  800571:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800575:	83 c0 08             	add    $0x8,%eax
+  800578:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80057b:	8b 02                	mov    (%rdx),%eax
+  80057d:	89 c1                	mov    %eax,%ecx
+  80057f:	f7 d9                	neg    %ecx
+  800581:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800584:	83 f9 13             	cmp    $0x13,%ecx
+  800587:	7f 4e                	jg     8005d7 <vprintfmt+0x1ec>
+  800589:	48 63 c1             	movslq %ecx,%rax
+  80058c:	48 ba 80 54 80 00 00 	movabs $0x805480,%rdx
+  800593:	00 00 00 
+  800596:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80059a:	48 85 c0             	test   %rax,%rax
+  80059d:	74 38                	je     8005d7 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80059f:	48 89 c1             	mov    %rax,%rcx
+  8005a2:	48 ba d9 56 80 00 00 	movabs $0x8056d9,%rdx
+  8005a9:	00 00 00 
+  8005ac:	4c 89 ee             	mov    %r13,%rsi
+  8005af:	4c 89 f7             	mov    %r14,%rdi
+  8005b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b7:	49 b8 ae 03 80 00 00 	movabs $0x8003ae,%r8
+  8005be:	00 00 00 
+  8005c1:	41 ff d0             	call   *%r8
+  8005c4:	e9 53 fe ff ff       	jmp    80041c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d5:	eb a4                	jmp    80057b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005d7:	48 ba 49 50 80 00 00 	movabs $0x805049,%rdx
+  8005de:	00 00 00 
+  8005e1:	4c 89 ee             	mov    %r13,%rsi
+  8005e4:	4c 89 f7             	mov    %r14,%rdi
+  8005e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ec:	49 b8 ae 03 80 00 00 	movabs $0x8003ae,%r8
+  8005f3:	00 00 00 
+  8005f6:	41 ff d0             	call   *%r8
+  8005f9:	e9 1e fe ff ff       	jmp    80041c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800601:	83 f8 2f             	cmp    $0x2f,%eax
+  800604:	77 36                	ja     80063c <vprintfmt+0x251>
+  800606:	89 c2                	mov    %eax,%edx
+  800608:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80060c:	83 c0 08             	add    $0x8,%eax
+  80060f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800612:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800615:	48 85 f6             	test   %rsi,%rsi
+  800618:	48 b8 42 50 80 00 00 	movabs $0x805042,%rax
+  80061f:	00 00 00 
+  800622:	48 0f 45 c6          	cmovne %rsi,%rax
+  800626:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80062a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80062e:	7e 06                	jle    800636 <vprintfmt+0x24b>
+  800630:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800634:	75 14                	jne    80064a <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800636:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80063a:	eb 5b                	jmp    800697 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80063c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800640:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800644:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800648:	eb c8                	jmp    800612 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80064a:	49 63 f7             	movslq %r15d,%rsi
+  80064d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800651:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  800658:	00 00 00 
+  80065b:	ff d0                	call   *%rax
+  80065d:	48 89 c2             	mov    %rax,%rdx
+  800660:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800663:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800665:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800668:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80066b:	85 c0                	test   %eax,%eax
+  80066d:	7e c7                	jle    800636 <vprintfmt+0x24b>
+  80066f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800674:	4c 89 ee             	mov    %r13,%rsi
+  800677:	44 89 e7             	mov    %r12d,%edi
+  80067a:	41 ff d6             	call   *%r14
+  80067d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800681:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800684:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800687:	75 eb                	jne    800674 <vprintfmt+0x289>
+  800689:	eb ab                	jmp    800636 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80068b:	0f b6 f8             	movzbl %al,%edi
+  80068e:	4c 89 ee             	mov    %r13,%rsi
+  800691:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800694:	4c 89 e2             	mov    %r12,%rdx
+  800697:	45 85 ff             	test   %r15d,%r15d
+  80069a:	78 06                	js     8006a2 <vprintfmt+0x2b7>
+  80069c:	41 83 ef 01          	sub    $0x1,%r15d
+  8006a0:	78 23                	js     8006c5 <vprintfmt+0x2da>
+  8006a2:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8006a6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006ac:	84 c0                	test   %al,%al
+  8006ae:	74 15                	je     8006c5 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006b0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006b4:	74 d5                	je     80068b <vprintfmt+0x2a0>
+  8006b6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006b9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006be:	80 fa 5e             	cmp    $0x5e,%dl
+  8006c1:	77 cb                	ja     80068e <vprintfmt+0x2a3>
+  8006c3:	eb c6                	jmp    80068b <vprintfmt+0x2a0>
+  8006c5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006c8:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8006cb:	01 f0                	add    %esi,%eax
+  8006cd:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8006cf:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006d3:	85 c0                	test   %eax,%eax
+  8006d5:	0f 8e 41 fd ff ff    	jle    80041c <vprintfmt+0x31>
+  8006db:	4c 89 ee             	mov    %r13,%rsi
+  8006de:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006e3:	41 ff d6             	call   *%r14
+  8006e6:	41 83 ec 01          	sub    $0x1,%r12d
+  8006ea:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006ee:	75 eb                	jne    8006db <vprintfmt+0x2f0>
+  8006f0:	e9 27 fd ff ff       	jmp    80041c <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8006f5:	40 84 f6             	test   %sil,%sil
+  8006f8:	75 26                	jne    800720 <vprintfmt+0x335>
+    switch (lflag) {
+  8006fa:	85 d2                	test   %edx,%edx
+  8006fc:	74 59                	je     800757 <vprintfmt+0x36c>
+  8006fe:	83 fa 01             	cmp    $0x1,%edx
+  800701:	74 7b                	je     80077e <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800703:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800706:	83 f8 2f             	cmp    $0x2f,%eax
+  800709:	0f 87 96 00 00 00    	ja     8007a5 <vprintfmt+0x3ba>
+  80070f:	89 c2                	mov    %eax,%edx
+  800711:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800715:	83 c0 08             	add    $0x8,%eax
+  800718:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071b:	4c 8b 22             	mov    (%rdx),%r12
+  80071e:	eb 17                	jmp    800737 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800720:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800723:	83 f8 2f             	cmp    $0x2f,%eax
+  800726:	77 21                	ja     800749 <vprintfmt+0x35e>
+  800728:	89 c2                	mov    %eax,%edx
+  80072a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072e:	83 c0 08             	add    $0x8,%eax
+  800731:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800734:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800737:	4d 85 e4             	test   %r12,%r12
+  80073a:	78 7a                	js     8007b6 <vprintfmt+0x3cb>
+            num = i;
+  80073c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80073f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800744:	e9 b5 02 00 00       	jmp    8009fe <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800749:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800751:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800755:	eb dd                	jmp    800734 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800757:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075a:	83 f8 2f             	cmp    $0x2f,%eax
+  80075d:	77 11                	ja     800770 <vprintfmt+0x385>
+  80075f:	89 c2                	mov    %eax,%edx
+  800761:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800765:	83 c0 08             	add    $0x8,%eax
+  800768:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076b:	4c 63 22             	movslq (%rdx),%r12
+  80076e:	eb c7                	jmp    800737 <vprintfmt+0x34c>
+  800770:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800774:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800778:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077c:	eb ed                	jmp    80076b <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80077e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800781:	83 f8 2f             	cmp    $0x2f,%eax
+  800784:	77 11                	ja     800797 <vprintfmt+0x3ac>
+  800786:	89 c2                	mov    %eax,%edx
+  800788:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078c:	83 c0 08             	add    $0x8,%eax
+  80078f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800792:	4c 8b 22             	mov    (%rdx),%r12
+  800795:	eb a0                	jmp    800737 <vprintfmt+0x34c>
+  800797:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a3:	eb ed                	jmp    800792 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8007a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b1:	e9 65 ff ff ff       	jmp    80071b <vprintfmt+0x330>
+                putch('-', put_arg);
+  8007b6:	4c 89 ee             	mov    %r13,%rsi
+  8007b9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007be:	41 ff d6             	call   *%r14
+                i = -i;
+  8007c1:	49 f7 dc             	neg    %r12
+  8007c4:	e9 73 ff ff ff       	jmp    80073c <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c9:	40 84 f6             	test   %sil,%sil
+  8007cc:	75 32                	jne    800800 <vprintfmt+0x415>
+    switch (lflag) {
+  8007ce:	85 d2                	test   %edx,%edx
+  8007d0:	74 5d                	je     80082f <vprintfmt+0x444>
+  8007d2:	83 fa 01             	cmp    $0x1,%edx
+  8007d5:	0f 84 82 00 00 00    	je     80085d <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8007db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007de:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e1:	0f 87 a5 00 00 00    	ja     80088c <vprintfmt+0x4a1>
+  8007e7:	89 c2                	mov    %eax,%edx
+  8007e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ed:	83 c0 08             	add    $0x8,%eax
+  8007f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007fb:	e9 fe 01 00 00       	jmp    8009fe <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800800:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800803:	83 f8 2f             	cmp    $0x2f,%eax
+  800806:	77 19                	ja     800821 <vprintfmt+0x436>
+  800808:	89 c2                	mov    %eax,%edx
+  80080a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080e:	83 c0 08             	add    $0x8,%eax
+  800811:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800814:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800817:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80081c:	e9 dd 01 00 00       	jmp    8009fe <vprintfmt+0x613>
+  800821:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800825:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800829:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082d:	eb e5                	jmp    800814 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80082f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800832:	83 f8 2f             	cmp    $0x2f,%eax
+  800835:	77 18                	ja     80084f <vprintfmt+0x464>
+  800837:	89 c2                	mov    %eax,%edx
+  800839:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083d:	83 c0 08             	add    $0x8,%eax
+  800840:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800843:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800845:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80084a:	e9 af 01 00 00       	jmp    8009fe <vprintfmt+0x613>
+  80084f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800853:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800857:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085b:	eb e6                	jmp    800843 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80085d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800860:	83 f8 2f             	cmp    $0x2f,%eax
+  800863:	77 19                	ja     80087e <vprintfmt+0x493>
+  800865:	89 c2                	mov    %eax,%edx
+  800867:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086b:	83 c0 08             	add    $0x8,%eax
+  80086e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800871:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800874:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800879:	e9 80 01 00 00       	jmp    8009fe <vprintfmt+0x613>
+  80087e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800882:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800886:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088a:	eb e5                	jmp    800871 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80088c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800890:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800894:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800898:	e9 56 ff ff ff       	jmp    8007f3 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80089d:	40 84 f6             	test   %sil,%sil
+  8008a0:	75 2e                	jne    8008d0 <vprintfmt+0x4e5>
+    switch (lflag) {
+  8008a2:	85 d2                	test   %edx,%edx
+  8008a4:	0f 84 b3 00 00 00    	je     80095d <vprintfmt+0x572>
+  8008aa:	83 fa 01             	cmp    $0x1,%edx
+  8008ad:	0f 84 d3 00 00 00    	je     800986 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8008b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b9:	0f 87 f1 00 00 00    	ja     8009b0 <vprintfmt+0x5c5>
+  8008bf:	89 c2                	mov    %eax,%edx
+  8008c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c5:	83 c0 08             	add    $0x8,%eax
+  8008c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cb:	48 8b 02             	mov    (%rdx),%rax
+  8008ce:	eb 17                	jmp    8008e7 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8008d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d6:	77 77                	ja     80094f <vprintfmt+0x564>
+  8008d8:	89 c2                	mov    %eax,%edx
+  8008da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008de:	83 c0 08             	add    $0x8,%eax
+  8008e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e4:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8008e7:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8008e9:	83 f8 07             	cmp    $0x7,%eax
+  8008ec:	0f 8e cf 00 00 00    	jle    8009c1 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8008f2:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8008f8:	44 89 e7             	mov    %r12d,%edi
+  8008fb:	41 c1 e4 03          	shl    $0x3,%r12d
+  8008ff:	89 d1                	mov    %edx,%ecx
+  800901:	8d 72 07             	lea    0x7(%rdx),%esi
+  800904:	85 d2                	test   %edx,%edx
+  800906:	0f 48 d6             	cmovs  %esi,%edx
+  800909:	c1 fa 03             	sar    $0x3,%edx
+  80090c:	83 f9 3f             	cmp    $0x3f,%ecx
+  80090f:	7f e7                	jg     8008f8 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800911:	85 ff                	test   %edi,%edi
+  800913:	0f 84 03 fb ff ff    	je     80041c <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800919:	49 63 f4             	movslq %r12d,%rsi
+  80091c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800921:	48 f7 f6             	div    %rsi
+  800924:	49 89 d7             	mov    %rdx,%r15
+  800927:	83 c0 30             	add    $0x30,%eax
+  80092a:	0f be f8             	movsbl %al,%edi
+  80092d:	4c 89 ee             	mov    %r13,%rsi
+  800930:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800933:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800936:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  80093b:	45 85 e4             	test   %r12d,%r12d
+  80093e:	41 0f 49 d4          	cmovns %r12d,%edx
+  800942:	c1 fa 03             	sar    $0x3,%edx
+  800945:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800948:	75 cf                	jne    800919 <vprintfmt+0x52e>
+  80094a:	e9 cd fa ff ff       	jmp    80041c <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80094f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800953:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800957:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095b:	eb 87                	jmp    8008e4 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80095d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800960:	83 f8 2f             	cmp    $0x2f,%eax
+  800963:	77 13                	ja     800978 <vprintfmt+0x58d>
+  800965:	89 c2                	mov    %eax,%edx
+  800967:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096b:	83 c0 08             	add    $0x8,%eax
+  80096e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800971:	8b 02                	mov    (%rdx),%eax
+  800973:	e9 6f ff ff ff       	jmp    8008e7 <vprintfmt+0x4fc>
+  800978:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800984:	eb eb                	jmp    800971 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	77 14                	ja     8009a2 <vprintfmt+0x5b7>
+  80098e:	89 c2                	mov    %eax,%edx
+  800990:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800994:	83 c0 08             	add    $0x8,%eax
+  800997:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099a:	48 8b 02             	mov    (%rdx),%rax
+  80099d:	e9 45 ff ff ff       	jmp    8008e7 <vprintfmt+0x4fc>
+  8009a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ae:	eb ea                	jmp    80099a <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8009b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bc:	e9 0a ff ff ff       	jmp    8008cb <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8009c1:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8009c7:	e9 4d ff ff ff       	jmp    800919 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8009cc:	4c 89 ee             	mov    %r13,%rsi
+  8009cf:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009d4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009d7:	4c 89 ee             	mov    %r13,%rsi
+  8009da:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009df:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e8:	77 47                	ja     800a31 <vprintfmt+0x646>
+  8009ea:	89 c2                	mov    %eax,%edx
+  8009ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f0:	83 c0 08             	add    $0x8,%eax
+  8009f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009fe:	48 83 ec 08          	sub    $0x8,%rsp
+  800a02:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a06:	0f 94 c0             	sete   %al
+  800a09:	0f b6 c0             	movzbl %al,%eax
+  800a0c:	50                   	push   %rax
+  800a0d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a12:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a16:	4c 89 ee             	mov    %r13,%rsi
+  800a19:	4c 89 f7             	mov    %r14,%rdi
+  800a1c:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  800a23:	00 00 00 
+  800a26:	ff d0                	call   *%rax
+            break;
+  800a28:	48 83 c4 10          	add    $0x10,%rsp
+  800a2c:	e9 eb f9 ff ff       	jmp    80041c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3d:	eb b7                	jmp    8009f6 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3f:	40 84 f6             	test   %sil,%sil
+  800a42:	75 2b                	jne    800a6f <vprintfmt+0x684>
+    switch (lflag) {
+  800a44:	85 d2                	test   %edx,%edx
+  800a46:	74 56                	je     800a9e <vprintfmt+0x6b3>
+  800a48:	83 fa 01             	cmp    $0x1,%edx
+  800a4b:	74 7f                	je     800acc <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800a4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a50:	83 f8 2f             	cmp    $0x2f,%eax
+  800a53:	0f 87 a2 00 00 00    	ja     800afb <vprintfmt+0x710>
+  800a59:	89 c2                	mov    %eax,%edx
+  800a5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5f:	83 c0 08             	add    $0x8,%eax
+  800a62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a65:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a68:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a6d:	eb 8f                	jmp    8009fe <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a72:	83 f8 2f             	cmp    $0x2f,%eax
+  800a75:	77 19                	ja     800a90 <vprintfmt+0x6a5>
+  800a77:	89 c2                	mov    %eax,%edx
+  800a79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7d:	83 c0 08             	add    $0x8,%eax
+  800a80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a83:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a86:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a8b:	e9 6e ff ff ff       	jmp    8009fe <vprintfmt+0x613>
+  800a90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9c:	eb e5                	jmp    800a83 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800a9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa1:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa4:	77 18                	ja     800abe <vprintfmt+0x6d3>
+  800aa6:	89 c2                	mov    %eax,%edx
+  800aa8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aac:	83 c0 08             	add    $0x8,%eax
+  800aaf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ab4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ab9:	e9 40 ff ff ff       	jmp    8009fe <vprintfmt+0x613>
+  800abe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aca:	eb e6                	jmp    800ab2 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800acc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad2:	77 19                	ja     800aed <vprintfmt+0x702>
+  800ad4:	89 c2                	mov    %eax,%edx
+  800ad6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ada:	83 c0 08             	add    $0x8,%eax
+  800add:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ae3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ae8:	e9 11 ff ff ff       	jmp    8009fe <vprintfmt+0x613>
+  800aed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af9:	eb e5                	jmp    800ae0 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800afb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b07:	e9 59 ff ff ff       	jmp    800a65 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800b0c:	4c 89 ee             	mov    %r13,%rsi
+  800b0f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b14:	41 ff d6             	call   *%r14
+            break;
+  800b17:	e9 00 f9 ff ff       	jmp    80041c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b1c:	4c 89 ee             	mov    %r13,%rsi
+  800b1f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b24:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b27:	48 83 eb 01          	sub    $0x1,%rbx
+  800b2b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b2f:	75 f6                	jne    800b27 <vprintfmt+0x73c>
+  800b31:	e9 e6 f8 ff ff       	jmp    80041c <vprintfmt+0x31>
+}
+  800b36:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b3a:	5b                   	pop    %rbx
+  800b3b:	41 5c                	pop    %r12
+  800b3d:	41 5d                	pop    %r13
+  800b3f:	41 5e                	pop    %r14
+  800b41:	41 5f                	pop    %r15
+  800b43:	5d                   	pop    %rbp
+  800b44:	c3                   	ret
+
+0000000000800b45 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b45:	55                   	push   %rbp
+  800b46:	48 89 e5             	mov    %rsp,%rbp
+  800b49:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b4d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b51:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b56:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b5a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b61:	48 85 ff             	test   %rdi,%rdi
+  800b64:	74 2b                	je     800b91 <vsnprintf+0x4c>
+  800b66:	48 85 f6             	test   %rsi,%rsi
+  800b69:	74 26                	je     800b91 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b6b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b6f:	48 bf 96 03 80 00 00 	movabs $0x800396,%rdi
+  800b76:	00 00 00 
+  800b79:	48 b8 eb 03 80 00 00 	movabs $0x8003eb,%rax
+  800b80:	00 00 00 
+  800b83:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b89:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b8c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b8f:	c9                   	leave
+  800b90:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b96:	eb f7                	jmp    800b8f <vsnprintf+0x4a>
+
+0000000000800b98 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b98:	55                   	push   %rbp
+  800b99:	48 89 e5             	mov    %rsp,%rbp
+  800b9c:	48 83 ec 50          	sub    $0x50,%rsp
+  800ba0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ba4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ba8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bac:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bb3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bbf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bc3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800bc7:	48 b8 45 0b 80 00 00 	movabs $0x800b45,%rax
+  800bce:	00 00 00 
+  800bd1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bd3:	c9                   	leave
+  800bd4:	c3                   	ret
+
+0000000000800bd5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bd5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bd8:	74 10                	je     800bea <strlen+0x15>
+    size_t n = 0;
+  800bda:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bdf:	48 83 c0 01          	add    $0x1,%rax
+  800be3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800be7:	75 f6                	jne    800bdf <strlen+0xa>
+  800be9:	c3                   	ret
+    size_t n = 0;
+  800bea:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bef:	c3                   	ret
+
+0000000000800bf0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bf0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bf3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bf8:	48 85 f6             	test   %rsi,%rsi
+  800bfb:	74 11                	je     800c0e <strnlen+0x1e>
+  800bfd:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c01:	74 0c                	je     800c0f <strnlen+0x1f>
+  800c03:	48 83 c2 01          	add    $0x1,%rdx
+  800c07:	48 39 d0             	cmp    %rdx,%rax
+  800c0a:	75 f1                	jne    800bfd <strnlen+0xd>
+  800c0c:	eb 04                	jmp    800c12 <strnlen+0x22>
+  800c0e:	c3                   	ret
+  800c0f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c12:	c3                   	ret
+
+0000000000800c13 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c13:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c1f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c22:	48 83 c2 01          	add    $0x1,%rdx
+  800c26:	84 c9                	test   %cl,%cl
+  800c28:	75 f1                	jne    800c1b <strcpy+0x8>
+        ;
+    return res;
+}
+  800c2a:	c3                   	ret
+
+0000000000800c2b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c2b:	55                   	push   %rbp
+  800c2c:	48 89 e5             	mov    %rsp,%rbp
+  800c2f:	41 54                	push   %r12
+  800c31:	53                   	push   %rbx
+  800c32:	48 89 fb             	mov    %rdi,%rbx
+  800c35:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c38:	48 b8 d5 0b 80 00 00 	movabs $0x800bd5,%rax
+  800c3f:	00 00 00 
+  800c42:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c44:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c48:	4c 89 e6             	mov    %r12,%rsi
+  800c4b:	48 b8 13 0c 80 00 00 	movabs $0x800c13,%rax
+  800c52:	00 00 00 
+  800c55:	ff d0                	call   *%rax
+    return dst;
+}
+  800c57:	48 89 d8             	mov    %rbx,%rax
+  800c5a:	5b                   	pop    %rbx
+  800c5b:	41 5c                	pop    %r12
+  800c5d:	5d                   	pop    %rbp
+  800c5e:	c3                   	ret
+
+0000000000800c5f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c5f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c62:	48 85 d2             	test   %rdx,%rdx
+  800c65:	74 1f                	je     800c86 <strncpy+0x27>
+  800c67:	48 01 fa             	add    %rdi,%rdx
+  800c6a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c6d:	48 83 c1 01          	add    $0x1,%rcx
+  800c71:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c75:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c79:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c7d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c81:	48 39 ca             	cmp    %rcx,%rdx
+  800c84:	75 e7                	jne    800c6d <strncpy+0xe>
+    }
+    return ret;
+}
+  800c86:	c3                   	ret
+
+0000000000800c87 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c87:	48 89 f8             	mov    %rdi,%rax
+  800c8a:	48 85 d2             	test   %rdx,%rdx
+  800c8d:	74 24                	je     800cb3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c8f:	48 83 ea 01          	sub    $0x1,%rdx
+  800c93:	74 1b                	je     800cb0 <strlcpy+0x29>
+  800c95:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c99:	0f b6 16             	movzbl (%rsi),%edx
+  800c9c:	84 d2                	test   %dl,%dl
+  800c9e:	74 10                	je     800cb0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ca0:	48 83 c6 01          	add    $0x1,%rsi
+  800ca4:	48 83 c0 01          	add    $0x1,%rax
+  800ca8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cab:	48 39 c8             	cmp    %rcx,%rax
+  800cae:	75 e9                	jne    800c99 <strlcpy+0x12>
+        *dst = '\0';
+  800cb0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cb3:	48 29 f8             	sub    %rdi,%rax
+}
+  800cb6:	c3                   	ret
+
+0000000000800cb7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cb7:	0f b6 07             	movzbl (%rdi),%eax
+  800cba:	84 c0                	test   %al,%al
+  800cbc:	74 13                	je     800cd1 <strcmp+0x1a>
+  800cbe:	38 06                	cmp    %al,(%rsi)
+  800cc0:	75 0f                	jne    800cd1 <strcmp+0x1a>
+  800cc2:	48 83 c7 01          	add    $0x1,%rdi
+  800cc6:	48 83 c6 01          	add    $0x1,%rsi
+  800cca:	0f b6 07             	movzbl (%rdi),%eax
+  800ccd:	84 c0                	test   %al,%al
+  800ccf:	75 ed                	jne    800cbe <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cd1:	0f b6 c0             	movzbl %al,%eax
+  800cd4:	0f b6 16             	movzbl (%rsi),%edx
+  800cd7:	29 d0                	sub    %edx,%eax
+}
+  800cd9:	c3                   	ret
+
+0000000000800cda <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cda:	48 85 d2             	test   %rdx,%rdx
+  800cdd:	74 1f                	je     800cfe <strncmp+0x24>
+  800cdf:	0f b6 07             	movzbl (%rdi),%eax
+  800ce2:	84 c0                	test   %al,%al
+  800ce4:	74 1e                	je     800d04 <strncmp+0x2a>
+  800ce6:	3a 06                	cmp    (%rsi),%al
+  800ce8:	75 1a                	jne    800d04 <strncmp+0x2a>
+  800cea:	48 83 c7 01          	add    $0x1,%rdi
+  800cee:	48 83 c6 01          	add    $0x1,%rsi
+  800cf2:	48 83 ea 01          	sub    $0x1,%rdx
+  800cf6:	75 e7                	jne    800cdf <strncmp+0x5>
+
+    if (!n) return 0;
+  800cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfd:	c3                   	ret
+  800cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d03:	c3                   	ret
+  800d04:	48 85 d2             	test   %rdx,%rdx
+  800d07:	74 09                	je     800d12 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d09:	0f b6 07             	movzbl (%rdi),%eax
+  800d0c:	0f b6 16             	movzbl (%rsi),%edx
+  800d0f:	29 d0                	sub    %edx,%eax
+  800d11:	c3                   	ret
+    if (!n) return 0;
+  800d12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d17:	c3                   	ret
+
+0000000000800d18 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d18:	0f b6 17             	movzbl (%rdi),%edx
+  800d1b:	84 d2                	test   %dl,%dl
+  800d1d:	74 18                	je     800d37 <strchr+0x1f>
+        if (*str == c) {
+  800d1f:	0f be d2             	movsbl %dl,%edx
+  800d22:	39 f2                	cmp    %esi,%edx
+  800d24:	74 17                	je     800d3d <strchr+0x25>
+    for (; *str; str++) {
+  800d26:	48 83 c7 01          	add    $0x1,%rdi
+  800d2a:	0f b6 17             	movzbl (%rdi),%edx
+  800d2d:	84 d2                	test   %dl,%dl
+  800d2f:	75 ee                	jne    800d1f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d36:	c3                   	ret
+  800d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3c:	c3                   	ret
+  800d3d:	48 89 f8             	mov    %rdi,%rax
+}
+  800d40:	c3                   	ret
+
+0000000000800d41 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d41:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d44:	0f b6 17             	movzbl (%rdi),%edx
+  800d47:	84 d2                	test   %dl,%dl
+  800d49:	74 13                	je     800d5e <strfind+0x1d>
+  800d4b:	0f be d2             	movsbl %dl,%edx
+  800d4e:	39 f2                	cmp    %esi,%edx
+  800d50:	74 0b                	je     800d5d <strfind+0x1c>
+  800d52:	48 83 c0 01          	add    $0x1,%rax
+  800d56:	0f b6 10             	movzbl (%rax),%edx
+  800d59:	84 d2                	test   %dl,%dl
+  800d5b:	75 ee                	jne    800d4b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d5d:	c3                   	ret
+  800d5e:	c3                   	ret
+
+0000000000800d5f <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800d5f:	55                   	push   %rbp
+  800d60:	48 89 e5             	mov    %rsp,%rbp
+  800d63:	41 57                	push   %r15
+  800d65:	41 56                	push   %r14
+  800d67:	41 55                	push   %r13
+  800d69:	41 54                	push   %r12
+  800d6b:	53                   	push   %rbx
+  800d6c:	48 83 ec 08          	sub    $0x8,%rsp
+  800d70:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800d73:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800d77:	45 84 ed             	test   %r13b,%r13b
+  800d7a:	75 12                	jne    800d8e <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800d7c:	4c 89 f8             	mov    %r15,%rax
+  800d7f:	48 83 c4 08          	add    $0x8,%rsp
+  800d83:	5b                   	pop    %rbx
+  800d84:	41 5c                	pop    %r12
+  800d86:	41 5d                	pop    %r13
+  800d88:	41 5e                	pop    %r14
+  800d8a:	41 5f                	pop    %r15
+  800d8c:	5d                   	pop    %rbp
+  800d8d:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800d8e:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800d92:	4c 89 e7             	mov    %r12,%rdi
+  800d95:	48 b8 d5 0b 80 00 00 	movabs $0x800bd5,%rax
+  800d9c:	00 00 00 
+  800d9f:	ff d0                	call   *%rax
+  800da1:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800da4:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800da8:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800dac:	49 bf da 0c 80 00 00 	movabs $0x800cda,%r15
+  800db3:	00 00 00 
+				if ((sc = *s++) == 0)
+  800db6:	84 c0                	test   %al,%al
+  800db8:	75 14                	jne    800dce <strstr+0x6f>
+					return NULL;
+  800dba:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800dc0:	eb ba                	jmp    800d7c <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800dc2:	48 83 c3 01          	add    $0x1,%rbx
+  800dc6:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800dca:	84 c0                	test   %al,%al
+  800dcc:	74 1b                	je     800de9 <strstr+0x8a>
+			} while (sc != c);
+  800dce:	41 38 c5             	cmp    %al,%r13b
+  800dd1:	75 ef                	jne    800dc2 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800dd3:	4c 89 f2             	mov    %r14,%rdx
+  800dd6:	4c 89 e6             	mov    %r12,%rsi
+  800dd9:	48 89 df             	mov    %rbx,%rdi
+  800ddc:	41 ff d7             	call   *%r15
+  800ddf:	85 c0                	test   %eax,%eax
+  800de1:	75 df                	jne    800dc2 <strstr+0x63>
+  800de3:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800de7:	eb 93                	jmp    800d7c <strstr+0x1d>
+					return NULL;
+  800de9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800def:	eb 8b                	jmp    800d7c <strstr+0x1d>
+
+0000000000800df1 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800df1:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800df3:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800df6:	8d 57 20             	lea    0x20(%rdi),%edx
+  800df9:	83 f9 1a             	cmp    $0x1a,%ecx
+  800dfc:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800dff:	c3                   	ret
+
+0000000000800e00 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800e00:	55                   	push   %rbp
+  800e01:	48 89 e5             	mov    %rsp,%rbp
+  800e04:	41 57                	push   %r15
+  800e06:	41 56                	push   %r14
+  800e08:	41 55                	push   %r13
+  800e0a:	41 54                	push   %r12
+  800e0c:	53                   	push   %rbx
+  800e0d:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800e11:	48 39 f7             	cmp    %rsi,%rdi
+  800e14:	74 49                	je     800e5f <strcasecmp+0x5f>
+  800e16:	49 89 fd             	mov    %rdi,%r13
+  800e19:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800e1c:	49 bf f1 0d 80 00 00 	movabs $0x800df1,%r15
+  800e23:	00 00 00 
+  800e26:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800e2b:	41 0f b6 fe          	movzbl %r14b,%edi
+  800e2f:	41 ff d7             	call   *%r15
+  800e32:	89 c3                	mov    %eax,%ebx
+  800e34:	49 83 c4 01          	add    $0x1,%r12
+  800e38:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e3e:	41 ff d7             	call   *%r15
+  800e41:	29 c3                	sub    %eax,%ebx
+  800e43:	75 09                	jne    800e4e <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800e45:	49 83 c5 01          	add    $0x1,%r13
+  800e49:	45 84 f6             	test   %r14b,%r14b
+  800e4c:	75 d8                	jne    800e26 <strcasecmp+0x26>
+}
+  800e4e:	89 d8                	mov    %ebx,%eax
+  800e50:	48 83 c4 08          	add    $0x8,%rsp
+  800e54:	5b                   	pop    %rbx
+  800e55:	41 5c                	pop    %r12
+  800e57:	41 5d                	pop    %r13
+  800e59:	41 5e                	pop    %r14
+  800e5b:	41 5f                	pop    %r15
+  800e5d:	5d                   	pop    %rbp
+  800e5e:	c3                   	ret
+        return 0;
+  800e5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e64:	eb e8                	jmp    800e4e <strcasecmp+0x4e>
+
+0000000000800e66 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800e66:	55                   	push   %rbp
+  800e67:	48 89 e5             	mov    %rsp,%rbp
+  800e6a:	41 57                	push   %r15
+  800e6c:	41 56                	push   %r14
+  800e6e:	41 55                	push   %r13
+  800e70:	41 54                	push   %r12
+  800e72:	53                   	push   %rbx
+  800e73:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800e77:	48 85 d2             	test   %rdx,%rdx
+  800e7a:	74 4f                	je     800ecb <strncasecmp+0x65>
+  800e7c:	49 89 fc             	mov    %rdi,%r12
+  800e7f:	49 89 f5             	mov    %rsi,%r13
+  800e82:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800e86:	49 be f1 0d 80 00 00 	movabs $0x800df1,%r14
+  800e8d:	00 00 00 
+  800e90:	49 83 c4 01          	add    $0x1,%r12
+  800e94:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e9a:	41 ff d6             	call   *%r14
+  800e9d:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800e9f:	49 83 c5 01          	add    $0x1,%r13
+  800ea3:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800ea8:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800eab:	29 c3                	sub    %eax,%ebx
+  800ead:	85 c0                	test   %eax,%eax
+  800eaf:	74 09                	je     800eba <strncasecmp+0x54>
+  800eb1:	85 db                	test   %ebx,%ebx
+  800eb3:	75 05                	jne    800eba <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800eb5:	4d 39 fc             	cmp    %r15,%r12
+  800eb8:	75 d6                	jne    800e90 <strncasecmp+0x2a>
+}
+  800eba:	89 d8                	mov    %ebx,%eax
+  800ebc:	48 83 c4 08          	add    $0x8,%rsp
+  800ec0:	5b                   	pop    %rbx
+  800ec1:	41 5c                	pop    %r12
+  800ec3:	41 5d                	pop    %r13
+  800ec5:	41 5e                	pop    %r14
+  800ec7:	41 5f                	pop    %r15
+  800ec9:	5d                   	pop    %rbp
+  800eca:	c3                   	ret
+    int d = 0;
+  800ecb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800ed0:	eb e8                	jmp    800eba <strncasecmp+0x54>
+
+0000000000800ed2 <toupper>:
+
+int toupper(int c) {
+  800ed2:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800ed4:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800ed7:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800eda:	83 f9 1a             	cmp    $0x1a,%ecx
+  800edd:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800ee0:	c3                   	ret
+
+0000000000800ee1 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800ee1:	83 ff 20             	cmp    $0x20,%edi
+  800ee4:	0f 94 c0             	sete   %al
+  800ee7:	0f b6 c0             	movzbl %al,%eax
+}
+  800eea:	c3                   	ret
+
+0000000000800eeb <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800eeb:	89 f8                	mov    %edi,%eax
+  800eed:	f7 d8                	neg    %eax
+  800eef:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800ef2:	c3                   	ret
+
+0000000000800ef3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ef3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ef6:	48 89 f8             	mov    %rdi,%rax
+  800ef9:	48 f7 d8             	neg    %rax
+  800efc:	83 e0 07             	and    $0x7,%eax
+  800eff:	49 89 d1             	mov    %rdx,%r9
+  800f02:	49 29 c1             	sub    %rax,%r9
+  800f05:	78 36                	js     800f3d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f07:	40 0f b6 c6          	movzbl %sil,%eax
+  800f0b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f12:	01 01 01 
+  800f15:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f19:	40 f6 c7 07          	test   $0x7,%dil
+  800f1d:	75 38                	jne    800f57 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f1f:	4c 89 c9             	mov    %r9,%rcx
+  800f22:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f26:	74 0c                	je     800f34 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f28:	fc                   	cld
+  800f29:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f2c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f30:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f34:	4d 85 c9             	test   %r9,%r9
+  800f37:	75 45                	jne    800f7e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f39:	4c 89 c0             	mov    %r8,%rax
+  800f3c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f3d:	48 85 d2             	test   %rdx,%rdx
+  800f40:	74 f7                	je     800f39 <memset+0x46>
+  800f42:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f45:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f48:	48 83 c0 01          	add    $0x1,%rax
+  800f4c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f50:	48 39 c2             	cmp    %rax,%rdx
+  800f53:	75 f3                	jne    800f48 <memset+0x55>
+  800f55:	eb e2                	jmp    800f39 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f57:	40 f6 c7 01          	test   $0x1,%dil
+  800f5b:	74 06                	je     800f63 <memset+0x70>
+  800f5d:	88 07                	mov    %al,(%rdi)
+  800f5f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f63:	40 f6 c7 02          	test   $0x2,%dil
+  800f67:	74 07                	je     800f70 <memset+0x7d>
+  800f69:	66 89 07             	mov    %ax,(%rdi)
+  800f6c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f70:	40 f6 c7 04          	test   $0x4,%dil
+  800f74:	74 a9                	je     800f1f <memset+0x2c>
+  800f76:	89 07                	mov    %eax,(%rdi)
+  800f78:	48 83 c7 04          	add    $0x4,%rdi
+  800f7c:	eb a1                	jmp    800f1f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f7e:	41 f6 c1 04          	test   $0x4,%r9b
+  800f82:	74 06                	je     800f8a <memset+0x97>
+  800f84:	89 07                	mov    %eax,(%rdi)
+  800f86:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f8a:	41 f6 c1 02          	test   $0x2,%r9b
+  800f8e:	74 07                	je     800f97 <memset+0xa4>
+  800f90:	66 89 07             	mov    %ax,(%rdi)
+  800f93:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f97:	41 f6 c1 01          	test   $0x1,%r9b
+  800f9b:	74 9c                	je     800f39 <memset+0x46>
+  800f9d:	88 07                	mov    %al,(%rdi)
+  800f9f:	eb 98                	jmp    800f39 <memset+0x46>
+
+0000000000800fa1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fa1:	48 89 f8             	mov    %rdi,%rax
+  800fa4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fa7:	48 39 fe             	cmp    %rdi,%rsi
+  800faa:	73 3b                	jae    800fe7 <memmove+0x46>
+  800fac:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fb0:	48 39 d7             	cmp    %rdx,%rdi
+  800fb3:	73 32                	jae    800fe7 <memmove+0x46>
+        s += n;
+        d += n;
+  800fb5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fb9:	48 89 d6             	mov    %rdx,%rsi
+  800fbc:	48 09 fe             	or     %rdi,%rsi
+  800fbf:	48 09 ce             	or     %rcx,%rsi
+  800fc2:	40 f6 c6 07          	test   $0x7,%sil
+  800fc6:	75 12                	jne    800fda <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fc8:	48 83 ef 08          	sub    $0x8,%rdi
+  800fcc:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fd0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fd4:	fd                   	std
+  800fd5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fd8:	fc                   	cld
+  800fd9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fda:	48 83 ef 01          	sub    $0x1,%rdi
+  800fde:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fe2:	fd                   	std
+  800fe3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fe5:	eb f1                	jmp    800fd8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fe7:	48 89 f2             	mov    %rsi,%rdx
+  800fea:	48 09 c2             	or     %rax,%rdx
+  800fed:	48 09 ca             	or     %rcx,%rdx
+  800ff0:	f6 c2 07             	test   $0x7,%dl
+  800ff3:	75 0c                	jne    801001 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ff5:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ff9:	48 89 c7             	mov    %rax,%rdi
+  800ffc:	fc                   	cld
+  800ffd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801000:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801001:	48 89 c7             	mov    %rax,%rdi
+  801004:	fc                   	cld
+  801005:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801007:	c3                   	ret
+
+0000000000801008 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801008:	55                   	push   %rbp
+  801009:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80100c:	48 b8 a1 0f 80 00 00 	movabs $0x800fa1,%rax
+  801013:	00 00 00 
+  801016:	ff d0                	call   *%rax
+}
+  801018:	5d                   	pop    %rbp
+  801019:	c3                   	ret
+
+000000000080101a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80101a:	55                   	push   %rbp
+  80101b:	48 89 e5             	mov    %rsp,%rbp
+  80101e:	41 57                	push   %r15
+  801020:	41 56                	push   %r14
+  801022:	41 55                	push   %r13
+  801024:	41 54                	push   %r12
+  801026:	53                   	push   %rbx
+  801027:	48 83 ec 08          	sub    $0x8,%rsp
+  80102b:	49 89 fe             	mov    %rdi,%r14
+  80102e:	49 89 f7             	mov    %rsi,%r15
+  801031:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801034:	48 89 f7             	mov    %rsi,%rdi
+  801037:	48 b8 d5 0b 80 00 00 	movabs $0x800bd5,%rax
+  80103e:	00 00 00 
+  801041:	ff d0                	call   *%rax
+  801043:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801046:	48 89 de             	mov    %rbx,%rsi
+  801049:	4c 89 f7             	mov    %r14,%rdi
+  80104c:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  801053:	00 00 00 
+  801056:	ff d0                	call   *%rax
+  801058:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80105b:	48 39 c3             	cmp    %rax,%rbx
+  80105e:	74 36                	je     801096 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801060:	48 89 d8             	mov    %rbx,%rax
+  801063:	4c 29 e8             	sub    %r13,%rax
+  801066:	49 39 c4             	cmp    %rax,%r12
+  801069:	73 31                	jae    80109c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80106b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801070:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801074:	4c 89 fe             	mov    %r15,%rsi
+  801077:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  80107e:	00 00 00 
+  801081:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801083:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801087:	48 83 c4 08          	add    $0x8,%rsp
+  80108b:	5b                   	pop    %rbx
+  80108c:	41 5c                	pop    %r12
+  80108e:	41 5d                	pop    %r13
+  801090:	41 5e                	pop    %r14
+  801092:	41 5f                	pop    %r15
+  801094:	5d                   	pop    %rbp
+  801095:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801096:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80109a:	eb eb                	jmp    801087 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80109c:	48 83 eb 01          	sub    $0x1,%rbx
+  8010a0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010a4:	48 89 da             	mov    %rbx,%rdx
+  8010a7:	4c 89 fe             	mov    %r15,%rsi
+  8010aa:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  8010b1:	00 00 00 
+  8010b4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010b6:	49 01 de             	add    %rbx,%r14
+  8010b9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010be:	eb c3                	jmp    801083 <strlcat+0x69>
+
+00000000008010c0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010c0:	48 85 d2             	test   %rdx,%rdx
+  8010c3:	74 2d                	je     8010f2 <memcmp+0x32>
+  8010c5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010ca:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010ce:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010d3:	44 38 c1             	cmp    %r8b,%cl
+  8010d6:	75 0f                	jne    8010e7 <memcmp+0x27>
+    while (n-- > 0) {
+  8010d8:	48 83 c0 01          	add    $0x1,%rax
+  8010dc:	48 39 c2             	cmp    %rax,%rdx
+  8010df:	75 e9                	jne    8010ca <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010e7:	0f b6 c1             	movzbl %cl,%eax
+  8010ea:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010ee:	44 29 c0             	sub    %r8d,%eax
+  8010f1:	c3                   	ret
+    return 0;
+  8010f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010f7:	c3                   	ret
+
+00000000008010f8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010f8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010fc:	48 39 c7             	cmp    %rax,%rdi
+  8010ff:	73 0f                	jae    801110 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801101:	40 38 37             	cmp    %sil,(%rdi)
+  801104:	74 0e                	je     801114 <memfind+0x1c>
+    for (; src < end; src++) {
+  801106:	48 83 c7 01          	add    $0x1,%rdi
+  80110a:	48 39 f8             	cmp    %rdi,%rax
+  80110d:	75 f2                	jne    801101 <memfind+0x9>
+  80110f:	c3                   	ret
+  801110:	48 89 f8             	mov    %rdi,%rax
+  801113:	c3                   	ret
+  801114:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801117:	c3                   	ret
+
+0000000000801118 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801118:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80111b:	0f b6 37             	movzbl (%rdi),%esi
+  80111e:	40 80 fe 20          	cmp    $0x20,%sil
+  801122:	74 06                	je     80112a <strtol+0x12>
+  801124:	40 80 fe 09          	cmp    $0x9,%sil
+  801128:	75 13                	jne    80113d <strtol+0x25>
+  80112a:	48 83 c7 01          	add    $0x1,%rdi
+  80112e:	0f b6 37             	movzbl (%rdi),%esi
+  801131:	40 80 fe 20          	cmp    $0x20,%sil
+  801135:	74 f3                	je     80112a <strtol+0x12>
+  801137:	40 80 fe 09          	cmp    $0x9,%sil
+  80113b:	74 ed                	je     80112a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80113d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801140:	83 e0 fd             	and    $0xfffffffd,%eax
+  801143:	3c 01                	cmp    $0x1,%al
+  801145:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801149:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80114f:	75 0f                	jne    801160 <strtol+0x48>
+  801151:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801154:	74 14                	je     80116a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801156:	85 d2                	test   %edx,%edx
+  801158:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80115d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801160:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801165:	4c 63 ca             	movslq %edx,%r9
+  801168:	eb 36                	jmp    8011a0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80116a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80116e:	74 0f                	je     80117f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801170:	85 d2                	test   %edx,%edx
+  801172:	75 ec                	jne    801160 <strtol+0x48>
+        s++;
+  801174:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801178:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80117d:	eb e1                	jmp    801160 <strtol+0x48>
+        s += 2;
+  80117f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801183:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801188:	eb d6                	jmp    801160 <strtol+0x48>
+            dig -= '0';
+  80118a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80118d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801191:	41 39 d0             	cmp    %edx,%r8d
+  801194:	7d 21                	jge    8011b7 <strtol+0x9f>
+        val = val * base + dig;
+  801196:	49 0f af c1          	imul   %r9,%rax
+  80119a:	0f b6 c9             	movzbl %cl,%ecx
+  80119d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011a0:	48 83 c7 01          	add    $0x1,%rdi
+  8011a4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011a8:	80 f9 39             	cmp    $0x39,%cl
+  8011ab:	76 dd                	jbe    80118a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011ad:	80 f9 7b             	cmp    $0x7b,%cl
+  8011b0:	77 05                	ja     8011b7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011b2:	83 e9 57             	sub    $0x57,%ecx
+  8011b5:	eb d6                	jmp    80118d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011b7:	4d 85 d2             	test   %r10,%r10
+  8011ba:	74 03                	je     8011bf <strtol+0xa7>
+  8011bc:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011bf:	48 89 c2             	mov    %rax,%rdx
+  8011c2:	48 f7 da             	neg    %rdx
+  8011c5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011c9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011cd:	c3                   	ret
+
+00000000008011ce <atoi>:
+int atoi(const char *str) {
+  8011ce:	55                   	push   %rbp
+  8011cf:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8011d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011dc:	48 b8 18 11 80 00 00 	movabs $0x801118,%rax
+  8011e3:	00 00 00 
+  8011e6:	ff d0                	call   *%rax
+}
+  8011e8:	5d                   	pop    %rbp
+  8011e9:	c3                   	ret
+
+00000000008011ea <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011ea:	55                   	push   %rbp
+  8011eb:	48 89 e5             	mov    %rsp,%rbp
+  8011ee:	53                   	push   %rbx
+  8011ef:	48 89 fa             	mov    %rdi,%rdx
+  8011f2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f5:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801204:	be 00 00 00 00       	mov    $0x0,%esi
+  801209:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80120f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801211:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801215:	c9                   	leave
+  801216:	c3                   	ret
+
+0000000000801217 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801217:	55                   	push   %rbp
+  801218:	48 89 e5             	mov    %rsp,%rbp
+  80121b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80121c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801221:	ba 00 00 00 00       	mov    $0x0,%edx
+  801226:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80122b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801230:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801235:	be 00 00 00 00       	mov    $0x0,%esi
+  80123a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801240:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801242:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801246:	c9                   	leave
+  801247:	c3                   	ret
+
+0000000000801248 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801248:	55                   	push   %rbp
+  801249:	48 89 e5             	mov    %rsp,%rbp
+  80124c:	53                   	push   %rbx
+  80124d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801251:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801254:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801259:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80125e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801263:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801268:	be 00 00 00 00       	mov    $0x0,%esi
+  80126d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801273:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801275:	48 85 c0             	test   %rax,%rax
+  801278:	7f 06                	jg     801280 <sys_env_destroy+0x38>
+}
+  80127a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127e:	c9                   	leave
+  80127f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801280:	49 89 c0             	mov    %rax,%r8
+  801283:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801288:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80128f:	00 00 00 
+  801292:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801297:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80129e:	00 00 00 
+  8012a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a6:	49 b9 20 41 80 00 00 	movabs $0x804120,%r9
+  8012ad:	00 00 00 
+  8012b0:	41 ff d1             	call   *%r9
+
+00000000008012b3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012b3:	55                   	push   %rbp
+  8012b4:	48 89 e5             	mov    %rsp,%rbp
+  8012b7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b8:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012dc:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e2:	c9                   	leave
+  8012e3:	c3                   	ret
+
+00000000008012e4 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012e4:	55                   	push   %rbp
+  8012e5:	48 89 e5             	mov    %rsp,%rbp
+  8012e8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e9:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801302:	be 00 00 00 00       	mov    $0x0,%esi
+  801307:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130d:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80130f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801313:	c9                   	leave
+  801314:	c3                   	ret
+
+0000000000801315 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801315:	55                   	push   %rbp
+  801316:	48 89 e5             	mov    %rsp,%rbp
+  801319:	53                   	push   %rbx
+  80131a:	48 89 fa             	mov    %rdi,%rdx
+  80131d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801320:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801325:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80132c:	00 00 00 
+  80132f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801334:	be 00 00 00 00       	mov    $0x0,%esi
+  801339:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801341:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+
+0000000000801347 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801347:	55                   	push   %rbp
+  801348:	48 89 e5             	mov    %rsp,%rbp
+  80134b:	53                   	push   %rbx
+  80134c:	49 89 f8             	mov    %rdi,%r8
+  80134f:	48 89 d3             	mov    %rdx,%rbx
+  801352:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801355:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80135a:	4c 89 c2             	mov    %r8,%rdx
+  80135d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801360:	be 00 00 00 00       	mov    $0x0,%esi
+  801365:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80136b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80136d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801371:	c9                   	leave
+  801372:	c3                   	ret
+
+0000000000801373 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801373:	55                   	push   %rbp
+  801374:	48 89 e5             	mov    %rsp,%rbp
+  801377:	53                   	push   %rbx
+  801378:	48 83 ec 08          	sub    $0x8,%rsp
+  80137c:	89 f8                	mov    %edi,%eax
+  80137e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801381:	48 63 f9             	movslq %ecx,%rdi
+  801384:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801387:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80138c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138f:	be 00 00 00 00       	mov    $0x0,%esi
+  801394:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80139c:	48 85 c0             	test   %rax,%rax
+  80139f:	7f 06                	jg     8013a7 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a5:	c9                   	leave
+  8013a6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a7:	49 89 c0             	mov    %rax,%r8
+  8013aa:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013af:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8013b6:	00 00 00 
+  8013b9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013be:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8013c5:	00 00 00 
+  8013c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cd:	49 b9 20 41 80 00 00 	movabs $0x804120,%r9
+  8013d4:	00 00 00 
+  8013d7:	41 ff d1             	call   *%r9
+
+00000000008013da <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013da:	55                   	push   %rbp
+  8013db:	48 89 e5             	mov    %rsp,%rbp
+  8013de:	53                   	push   %rbx
+  8013df:	48 83 ec 08          	sub    $0x8,%rsp
+  8013e3:	89 f8                	mov    %edi,%eax
+  8013e5:	49 89 f2             	mov    %rsi,%r10
+  8013e8:	48 89 cf             	mov    %rcx,%rdi
+  8013eb:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013ee:	48 63 da             	movslq %edx,%rbx
+  8013f1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f4:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f9:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fc:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013ff:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801401:	48 85 c0             	test   %rax,%rax
+  801404:	7f 06                	jg     80140c <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801406:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140a:	c9                   	leave
+  80140b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80140c:	49 89 c0             	mov    %rax,%r8
+  80140f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801414:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80141b:	00 00 00 
+  80141e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801423:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80142a:	00 00 00 
+  80142d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801432:	49 b9 20 41 80 00 00 	movabs $0x804120,%r9
+  801439:	00 00 00 
+  80143c:	41 ff d1             	call   *%r9
+
+000000000080143f <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80143f:	55                   	push   %rbp
+  801440:	48 89 e5             	mov    %rsp,%rbp
+  801443:	53                   	push   %rbx
+  801444:	48 83 ec 08          	sub    $0x8,%rsp
+  801448:	49 89 f9             	mov    %rdi,%r9
+  80144b:	89 f0                	mov    %esi,%eax
+  80144d:	48 89 d3             	mov    %rdx,%rbx
+  801450:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801453:	49 63 f0             	movslq %r8d,%rsi
+  801456:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801459:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80145e:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801461:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801467:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801469:	48 85 c0             	test   %rax,%rax
+  80146c:	7f 06                	jg     801474 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80146e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801472:	c9                   	leave
+  801473:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801474:	49 89 c0             	mov    %rax,%r8
+  801477:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80147c:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801483:	00 00 00 
+  801486:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80148b:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801492:	00 00 00 
+  801495:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149a:	49 b9 20 41 80 00 00 	movabs $0x804120,%r9
+  8014a1:	00 00 00 
+  8014a4:	41 ff d1             	call   *%r9
+
+00000000008014a7 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8014a7:	55                   	push   %rbp
+  8014a8:	48 89 e5             	mov    %rsp,%rbp
+  8014ab:	53                   	push   %rbx
+  8014ac:	89 f8                	mov    %edi,%eax
+  8014ae:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8014b1:	48 63 f9             	movslq %ecx,%rdi
+  8014b4:	48 63 da             	movslq %edx,%rbx
+  8014b7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ba:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014bf:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014cd:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8014cf:	89 c2                	mov    %eax,%edx
+  8014d1:	48 85 c0             	test   %rax,%rax
+  8014d4:	78 0d                	js     8014e3 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8014d6:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8014db:	4d 85 c9             	test   %r9,%r9
+  8014de:	74 03                	je     8014e3 <sys_alloc_dma_region+0x3c>
+  8014e0:	49 89 01             	mov    %rax,(%r9)
+}
+  8014e3:	89 d0                	mov    %edx,%eax
+  8014e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+
+00000000008014eb <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8014eb:	55                   	push   %rbp
+  8014ec:	48 89 e5             	mov    %rsp,%rbp
+  8014ef:	53                   	push   %rbx
+  8014f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f4:	48 89 f1             	mov    %rsi,%rcx
+  8014f7:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014fa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fd:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801502:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801507:	be 00 00 00 00       	mov    $0x0,%esi
+  80150c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801512:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801514:	48 85 c0             	test   %rax,%rax
+  801517:	7f 06                	jg     80151f <sys_set_cache_region+0x34>
+}
+  801519:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151d:	c9                   	leave
+  80151e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80151f:	49 89 c0             	mov    %rax,%r8
+  801522:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801527:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80152e:	00 00 00 
+  801531:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801536:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80153d:	00 00 00 
+  801540:	b8 00 00 00 00       	mov    $0x0,%eax
+  801545:	49 b9 20 41 80 00 00 	movabs $0x804120,%r9
+  80154c:	00 00 00 
+  80154f:	41 ff d1             	call   *%r9
+
+0000000000801552 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801552:	55                   	push   %rbp
+  801553:	48 89 e5             	mov    %rsp,%rbp
+  801556:	53                   	push   %rbx
+  801557:	48 83 ec 08          	sub    $0x8,%rsp
+  80155b:	48 89 f1             	mov    %rsi,%rcx
+  80155e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801561:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801564:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801569:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156e:	be 00 00 00 00       	mov    $0x0,%esi
+  801573:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801579:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80157b:	48 85 c0             	test   %rax,%rax
+  80157e:	7f 06                	jg     801586 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801580:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801584:	c9                   	leave
+  801585:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801586:	49 89 c0             	mov    %rax,%r8
+  801589:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80158e:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801595:	00 00 00 
+  801598:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80159d:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8015a4:	00 00 00 
+  8015a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ac:	49 b9 20 41 80 00 00 	movabs $0x804120,%r9
+  8015b3:	00 00 00 
+  8015b6:	41 ff d1             	call   *%r9
+
+00000000008015b9 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015b9:	55                   	push   %rbp
+  8015ba:	48 89 e5             	mov    %rsp,%rbp
+  8015bd:	53                   	push   %rbx
+  8015be:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015c2:	48 63 ce             	movslq %esi,%rcx
+  8015c5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c8:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e4:	48 85 c0             	test   %rax,%rax
+  8015e7:	7f 06                	jg     8015ef <sys_env_set_status+0x36>
+}
+  8015e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ed:	c9                   	leave
+  8015ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ef:	49 89 c0             	mov    %rax,%r8
+  8015f2:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8015f7:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8015fe:	00 00 00 
+  801601:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801606:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80160d:	00 00 00 
+  801610:	b8 00 00 00 00       	mov    $0x0,%eax
+  801615:	49 b9 20 41 80 00 00 	movabs $0x804120,%r9
+  80161c:	00 00 00 
+  80161f:	41 ff d1             	call   *%r9
+
+0000000000801622 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801622:	55                   	push   %rbp
+  801623:	48 89 e5             	mov    %rsp,%rbp
+  801626:	53                   	push   %rbx
+  801627:	48 83 ec 08          	sub    $0x8,%rsp
+  80162b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80162e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801631:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801636:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801640:	be 00 00 00 00       	mov    $0x0,%esi
+  801645:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80164b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80164d:	48 85 c0             	test   %rax,%rax
+  801650:	7f 06                	jg     801658 <sys_env_set_trapframe+0x36>
+}
+  801652:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801656:	c9                   	leave
+  801657:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801658:	49 89 c0             	mov    %rax,%r8
+  80165b:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801660:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801667:	00 00 00 
+  80166a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80166f:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801676:	00 00 00 
+  801679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167e:	49 b9 20 41 80 00 00 	movabs $0x804120,%r9
+  801685:	00 00 00 
+  801688:	41 ff d1             	call   *%r9
+
+000000000080168b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80168b:	55                   	push   %rbp
+  80168c:	48 89 e5             	mov    %rsp,%rbp
+  80168f:	53                   	push   %rbx
+  801690:	48 83 ec 08          	sub    $0x8,%rsp
+  801694:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801697:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80169a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80169f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016b6:	48 85 c0             	test   %rax,%rax
+  8016b9:	7f 06                	jg     8016c1 <sys_env_set_pgfault_upcall+0x36>
+}
+  8016bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016bf:	c9                   	leave
+  8016c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c1:	49 89 c0             	mov    %rax,%r8
+  8016c4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016c9:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8016d0:	00 00 00 
+  8016d3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016d8:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8016df:	00 00 00 
+  8016e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e7:	49 b9 20 41 80 00 00 	movabs $0x804120,%r9
+  8016ee:	00 00 00 
+  8016f1:	41 ff d1             	call   *%r9
+
+00000000008016f4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016f4:	55                   	push   %rbp
+  8016f5:	48 89 e5             	mov    %rsp,%rbp
+  8016f8:	53                   	push   %rbx
+  8016f9:	89 f8                	mov    %edi,%eax
+  8016fb:	49 89 f1             	mov    %rsi,%r9
+  8016fe:	48 89 d3             	mov    %rdx,%rbx
+  801701:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801704:	49 63 f0             	movslq %r8d,%rsi
+  801707:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80170a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80170f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801712:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801718:	cd 30                	int    $0x30
+}
+  80171a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171e:	c9                   	leave
+  80171f:	c3                   	ret
+
+0000000000801720 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801720:	55                   	push   %rbp
+  801721:	48 89 e5             	mov    %rsp,%rbp
+  801724:	53                   	push   %rbx
+  801725:	48 83 ec 08          	sub    $0x8,%rsp
+  801729:	48 89 fa             	mov    %rdi,%rdx
+  80172c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80172f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801734:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801739:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173e:	be 00 00 00 00       	mov    $0x0,%esi
+  801743:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801749:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80174b:	48 85 c0             	test   %rax,%rax
+  80174e:	7f 06                	jg     801756 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801750:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801754:	c9                   	leave
+  801755:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801756:	49 89 c0             	mov    %rax,%r8
+  801759:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80175e:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801765:	00 00 00 
+  801768:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80176d:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801774:	00 00 00 
+  801777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177c:	49 b9 20 41 80 00 00 	movabs $0x804120,%r9
+  801783:	00 00 00 
+  801786:	41 ff d1             	call   *%r9
+
+0000000000801789 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801789:	55                   	push   %rbp
+  80178a:	48 89 e5             	mov    %rsp,%rbp
+  80178d:	53                   	push   %rbx
+  80178e:	48 89 fa             	mov    %rdi,%rdx
+  801791:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801794:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801799:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ae:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+
+00000000008017b6 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017b6:	55                   	push   %rbp
+  8017b7:	48 89 e5             	mov    %rsp,%rbp
+  8017ba:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017bb:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017df:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e5:	c9                   	leave
+  8017e6:	c3                   	ret
+
+00000000008017e7 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8017e7:	48 85 ff             	test   %rdi,%rdi
+  8017ea:	0f 84 b6 01 00 00    	je     8019a6 <malloc+0x1bf>
+malloc(size_t size) {
+  8017f0:	55                   	push   %rbp
+  8017f1:	48 89 e5             	mov    %rsp,%rbp
+  8017f4:	41 56                	push   %r14
+  8017f6:	41 55                	push   %r13
+  8017f8:	41 54                	push   %r12
+  8017fa:	53                   	push   %rbx
+  8017fb:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8017fe:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801805:	00 00 00 
+  801808:	4c 8b 20             	mov    (%rax),%r12
+  80180b:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801812:	0f 87 94 01 00 00    	ja     8019ac <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801818:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80181f:	00 00 00 
+  801822:	48 85 c0             	test   %rax,%rax
+  801825:	74 6b                	je     801892 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801827:	4d 85 e4             	test   %r12,%r12
+  80182a:	74 66                	je     801892 <malloc+0xab>
+  80182c:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801833:	00 00 00 
+  801836:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80183b:	eb 0d                	jmp    80184a <malloc+0x63>
+  80183d:	48 83 c1 01          	add    $0x1,%rcx
+  801841:	48 83 c2 18          	add    $0x18,%rdx
+  801845:	49 39 cc             	cmp    %rcx,%r12
+  801848:	74 48                	je     801892 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80184a:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80184f:	74 ec                	je     80183d <malloc+0x56>
+  801851:	48 39 1a             	cmp    %rbx,(%rdx)
+  801854:	72 e7                	jb     80183d <malloc+0x56>
+                real_freep_size--;
+  801856:	48 83 e8 01          	sub    $0x1,%rax
+  80185a:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801861:	00 00 00 
+                freep[i].is_free = false;
+  801864:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80186b:	00 00 00 
+  80186e:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801872:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801876:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  80187a:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801881:	00 
+                freep[i].size = size;
+  801882:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801886:	48 01 c8             	add    %rcx,%rax
+  801889:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80188d:	e9 0b 01 00 00       	jmp    80199d <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801892:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801899:	00 00 00 
+  80189c:	48 01 d8             	add    %rbx,%rax
+  80189f:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8018a5:	76 7c                	jbe    801923 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8018a7:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8018ae:	00 00 00 
+  8018b1:	4c 8b 30             	mov    (%rax),%r14
+  8018b4:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8018bb:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8018be:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8018c5:	00 00 00 
+  8018c8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8018cf:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8018d6:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8018dc:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8018e0:	48 b8 b3 12 80 00 00 	movabs $0x8012b3,%rax
+  8018e7:	00 00 00 
+  8018ea:	ff d0                	call   *%rax
+  8018ec:	89 c7                	mov    %eax,%edi
+  8018ee:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8018f5:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8018fc:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801903:	00 00 00 
+  801906:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80190a:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80190f:	48 b8 73 13 80 00 00 	movabs $0x801373,%rax
+  801916:	00 00 00 
+  801919:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	0f 88 90 00 00 00    	js     8019b3 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801923:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  80192a:	00 00 00 
+  80192d:	48 8b 31             	mov    (%rcx),%rsi
+  801930:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801937:	00 00 00 
+  80193a:	4c 8b 07             	mov    (%rdi),%r8
+  80193d:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801941:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801948:	00 00 00 
+  80194b:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80194f:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801953:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80195a:	00 00 00 
+  80195d:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801961:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801964:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801968:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80196f:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801970:	48 89 d8             	mov    %rbx,%rax
+  801973:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801978:	4c 01 c0             	add    %r8,%rax
+  80197b:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  80197e:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801985:	48 01 f3             	add    %rsi,%rbx
+  801988:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  80198b:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801990:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801997:	00 00 00 
+  80199a:	48 89 d0             	mov    %rdx,%rax
+}
+  80199d:	5b                   	pop    %rbx
+  80199e:	41 5c                	pop    %r12
+  8019a0:	41 5d                	pop    %r13
+  8019a2:	41 5e                	pop    %r14
+  8019a4:	5d                   	pop    %rbp
+  8019a5:	c3                   	ret
+        return NULL;
+  8019a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ab:	c3                   	ret
+        return NULL;
+  8019ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b1:	eb ea                	jmp    80199d <malloc+0x1b6>
+            return NULL;
+  8019b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b8:	eb e3                	jmp    80199d <malloc+0x1b6>
+
+00000000008019ba <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8019ba:	55                   	push   %rbp
+  8019bb:	48 89 e5             	mov    %rsp,%rbp
+  8019be:	53                   	push   %rbx
+  8019bf:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8019c3:	48 89 fb             	mov    %rdi,%rbx
+  8019c6:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8019ca:	48 89 df             	mov    %rbx,%rdi
+  8019cd:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  8019d4:	00 00 00 
+  8019d7:	ff d0                	call   *%rax
+  8019d9:	48 89 c7             	mov    %rax,%rdi
+  8019dc:	48 89 da             	mov    %rbx,%rdx
+  8019df:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e4:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  8019eb:	00 00 00 
+  8019ee:	ff d0                	call   *%rax
+}
+  8019f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019f4:	c9                   	leave
+  8019f5:	c3                   	ret
+
+00000000008019f6 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  8019f6:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  8019fd:	00 00 00 
+  801a00:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801a07:	00 00 00 
+  801a0a:	48 3b 02             	cmp    (%rdx),%rax
+  801a0d:	74 4d                	je     801a5c <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801a0f:	48 85 c0             	test   %rax,%rax
+  801a12:	74 4d                	je     801a61 <get_allocsize+0x6b>
+  801a14:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801a1b:	00 00 00 
+  801a1e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801a23:	48 3b 39             	cmp    (%rcx),%rdi
+  801a26:	74 13                	je     801a3b <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801a28:	48 83 c2 01          	add    $0x1,%rdx
+  801a2c:	48 83 c1 18          	add    $0x18,%rcx
+  801a30:	48 39 d0             	cmp    %rdx,%rax
+  801a33:	75 ee                	jne    801a23 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801a35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3a:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801a3b:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a44:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a4b:	00 00 00 
+  801a4e:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a54:	75 0b                	jne    801a61 <get_allocsize+0x6b>
+  801a56:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801a5b:	c3                   	ret
+        return 0;
+  801a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a61:	c3                   	ret
+
+0000000000801a62 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801a62:	48 85 ff             	test   %rdi,%rdi
+  801a65:	0f 84 01 01 00 00    	je     801b6c <free+0x10a>
+free(void *ptr) {
+  801a6b:	55                   	push   %rbp
+  801a6c:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801a6f:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801a76:	00 00 00 
+  801a79:	48 8b 30             	mov    (%rax),%rsi
+  801a7c:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801a83:	00 00 00 
+  801a86:	48 39 c6             	cmp    %rax,%rsi
+  801a89:	74 50                	je     801adb <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801a8b:	48 85 f6             	test   %rsi,%rsi
+  801a8e:	74 21                	je     801ab1 <free+0x4f>
+  801a90:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801a97:	00 00 00 
+  801a9a:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801a9f:	48 3b 39             	cmp    (%rcx),%rdi
+  801aa2:	74 61                	je     801b05 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801aa4:	48 83 c2 01          	add    $0x1,%rdx
+  801aa8:	48 83 c1 18          	add    $0x18,%rcx
+  801aac:	48 39 d6             	cmp    %rdx,%rsi
+  801aaf:	75 ee                	jne    801a9f <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801ab1:	48 ba b0 55 80 00 00 	movabs $0x8055b0,%rdx
+  801ab8:	00 00 00 
+  801abb:	be 12 01 00 00       	mov    $0x112,%esi
+  801ac0:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801ac7:	00 00 00 
+  801aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acf:	48 b9 20 41 80 00 00 	movabs $0x804120,%rcx
+  801ad6:	00 00 00 
+  801ad9:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801adb:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801ae2:	00 00 00 
+  801ae5:	be 06 01 00 00       	mov    $0x106,%esi
+  801aea:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801af1:	00 00 00 
+  801af4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af9:	48 b9 20 41 80 00 00 	movabs $0x804120,%rcx
+  801b00:	00 00 00 
+  801b03:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801b05:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b09:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801b10:	00 00 00 
+  801b13:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b19:	75 27                	jne    801b42 <free+0xe0>
+            freep[i].is_free = true;
+  801b1b:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b1f:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801b26:	00 00 00 
+  801b29:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801b30:	00 00 
+            real_freep_size++;
+  801b32:	48 83 c0 01          	add    $0x1,%rax
+  801b36:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801b3d:	00 00 00 
+}
+  801b40:	5d                   	pop    %rbp
+  801b41:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801b42:	48 ba 88 55 80 00 00 	movabs $0x805588,%rdx
+  801b49:	00 00 00 
+  801b4c:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801b51:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801b58:	00 00 00 
+  801b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b60:	48 b9 20 41 80 00 00 	movabs $0x804120,%rcx
+  801b67:	00 00 00 
+  801b6a:	ff d1                	call   *%rcx
+  801b6c:	c3                   	ret
+
+0000000000801b6d <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801b6d:	55                   	push   %rbp
+  801b6e:	48 89 e5             	mov    %rsp,%rbp
+  801b71:	41 55                	push   %r13
+  801b73:	41 54                	push   %r12
+  801b75:	53                   	push   %rbx
+  801b76:	48 83 ec 08          	sub    $0x8,%rsp
+  801b7a:	48 89 fb             	mov    %rdi,%rbx
+  801b7d:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801b80:	48 b8 f6 19 80 00 00 	movabs $0x8019f6,%rax
+  801b87:	00 00 00 
+  801b8a:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801b8c:	49 39 c5             	cmp    %rax,%r13
+  801b8f:	73 0e                	jae    801b9f <realloc+0x32>
+}
+  801b91:	48 89 d8             	mov    %rbx,%rax
+  801b94:	48 83 c4 08          	add    $0x8,%rsp
+  801b98:	5b                   	pop    %rbx
+  801b99:	41 5c                	pop    %r12
+  801b9b:	41 5d                	pop    %r13
+  801b9d:	5d                   	pop    %rbp
+  801b9e:	c3                   	ret
+  801b9f:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801ba2:	4c 89 ef             	mov    %r13,%rdi
+  801ba5:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  801bac:	00 00 00 
+  801baf:	ff d0                	call   *%rax
+  801bb1:	48 89 c7             	mov    %rax,%rdi
+  801bb4:	4c 89 e2             	mov    %r12,%rdx
+  801bb7:	48 89 de             	mov    %rbx,%rsi
+  801bba:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  801bc1:	00 00 00 
+  801bc4:	ff d0                	call   *%rax
+  801bc6:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801bc9:	48 89 df             	mov    %rbx,%rdi
+  801bcc:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  801bd3:	00 00 00 
+  801bd6:	ff d0                	call   *%rax
+    return newptr;
+  801bd8:	4c 89 e3             	mov    %r12,%rbx
+  801bdb:	eb b4                	jmp    801b91 <realloc+0x24>
+
+0000000000801bdd <strdup>:
+
+char*
+strdup (const char *src) {
+  801bdd:	55                   	push   %rbp
+  801bde:	48 89 e5             	mov    %rsp,%rbp
+  801be1:	41 54                	push   %r12
+  801be3:	53                   	push   %rbx
+  801be4:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801be7:	48 b8 d5 0b 80 00 00 	movabs $0x800bd5,%rax
+  801bee:	00 00 00 
+  801bf1:	ff d0                	call   *%rax
+  801bf3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801bf7:	4c 89 e7             	mov    %r12,%rdi
+  801bfa:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  801c01:	00 00 00 
+  801c04:	ff d0                	call   *%rax
+  801c06:	48 89 c7             	mov    %rax,%rdi
+  801c09:	4c 89 e2             	mov    %r12,%rdx
+  801c0c:	48 89 de             	mov    %rbx,%rsi
+  801c0f:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  801c16:	00 00 00 
+  801c19:	ff d0                	call   *%rax
+}
+  801c1b:	5b                   	pop    %rbx
+  801c1c:	41 5c                	pop    %r12
+  801c1e:	5d                   	pop    %rbp
+  801c1f:	c3                   	ret
+
+0000000000801c20 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801c20:	55                   	push   %rbp
+  801c21:	48 89 e5             	mov    %rsp,%rbp
+  801c24:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c25:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c39:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c3e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c49:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c4b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c4f:	c9                   	leave
+  801c50:	c3                   	ret
+
+0000000000801c51 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801c51:	55                   	push   %rbp
+  801c52:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801c55:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c5c:	00 00 00 
+  801c5f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c63:	74 26                	je     801c8b <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801c65:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c67:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c6b:	89 c0                	mov    %eax,%eax
+  801c6d:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801c70:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801c77:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801c7e:	00 00 00 
+  801c81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c86:	48 f7 31             	divq   (%rcx)
+}
+  801c89:	5d                   	pop    %rbp
+  801c8a:	c3                   	ret
+        freq = get_cpufreq();
+  801c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c90:	48 ba 20 1c 80 00 00 	movabs $0x801c20,%rdx
+  801c97:	00 00 00 
+  801c9a:	ff d2                	call   *%rdx
+  801c9c:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801ca3:	00 00 00 
+  801ca6:	eb bd                	jmp    801c65 <get_ticks+0x14>
+
+0000000000801ca8 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801ca8:	55                   	push   %rbp
+  801ca9:	48 89 e5             	mov    %rsp,%rbp
+  801cac:	53                   	push   %rbx
+  801cad:	48 83 ec 08          	sub    $0x8,%rsp
+  801cb1:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801cb4:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801cbb:	00 00 00 
+  801cbe:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801cc2:	74 50                	je     801d14 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801cc4:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801cc6:	48 c1 e2 20          	shl    $0x20,%rdx
+  801cca:	89 c0                	mov    %eax,%eax
+  801ccc:	48 89 d6             	mov    %rdx,%rsi
+  801ccf:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801cd2:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801cd9:	00 00 00 
+  801cdc:	48 0f af 18          	imul   (%rax),%rbx
+  801ce0:	48 c1 eb 03          	shr    $0x3,%rbx
+  801ce4:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801ceb:	9b c4 20 
+  801cee:	48 89 d8             	mov    %rbx,%rax
+  801cf1:	48 f7 e2             	mul    %rdx
+  801cf4:	48 89 d1             	mov    %rdx,%rcx
+  801cf7:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801cfb:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801cfd:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d01:	89 c0                	mov    %eax,%eax
+  801d03:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801d06:	48 29 f2             	sub    %rsi,%rdx
+  801d09:	48 39 ca             	cmp    %rcx,%rdx
+  801d0c:	72 ed                	jb     801cfb <sleep+0x53>
+}
+  801d0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d12:	c9                   	leave
+  801d13:	c3                   	ret
+        freq = get_cpufreq();
+  801d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d19:	48 ba 20 1c 80 00 00 	movabs $0x801c20,%rdx
+  801d20:	00 00 00 
+  801d23:	ff d2                	call   *%rdx
+  801d25:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801d2c:	00 00 00 
+  801d2f:	eb 93                	jmp    801cc4 <sleep+0x1c>
+
+0000000000801d31 <poll_kbd>:
+
+int poll_kbd() {
+  801d31:	55                   	push   %rbp
+  801d32:	48 89 e5             	mov    %rsp,%rbp
+  801d35:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d36:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d40:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d4a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d4f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d54:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d5a:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d60:	c9                   	leave
+  801d61:	c3                   	ret
+
+0000000000801d62 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801d62:	55                   	push   %rbp
+  801d63:	48 89 e5             	mov    %rsp,%rbp
+  801d66:	53                   	push   %rbx
+  801d67:	49 89 fa             	mov    %rdi,%r10
+  801d6a:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801d6c:	44 89 c6             	mov    %r8d,%esi
+  801d6f:	89 cf                	mov    %ecx,%edi
+  801d71:	89 d3                	mov    %edx,%ebx
+  801d73:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801d75:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d7a:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d7d:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801d81:	cd 30                	int    $0x30
+  801d83:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d87:	c9                   	leave
+  801d88:	c3                   	ret
+
+0000000000801d89 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801d89:	55                   	push   %rbp
+  801d8a:	48 89 e5             	mov    %rsp,%rbp
+  801d8d:	41 54                	push   %r12
+  801d8f:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  801d90:	48 b8 42 35 80 00 00 	movabs $0x803542,%rax
+  801d97:	00 00 00 
+  801d9a:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801d9c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801da1:	cd 30                	int    $0x30
+  801da3:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801da6:	85 c0                	test   %eax,%eax
+  801da8:	78 76                	js     801e20 <fork+0x97>
+        return envid;
+    if (!envid) {
+  801daa:	74 7c                	je     801e28 <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801dac:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801db2:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801db9:	00 00 00 
+  801dbc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dc1:	89 c2                	mov    %eax,%edx
+  801dc3:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dcd:	48 b8 da 13 80 00 00 	movabs $0x8013da,%rax
+  801dd4:	00 00 00 
+  801dd7:	ff d0                	call   *%rax
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	75 7c                	jne    801e59 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801ddd:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801de4:	00 00 00 
+  801de7:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801dee:	44 89 e7             	mov    %r12d,%edi
+  801df1:	48 b8 8b 16 80 00 00 	movabs $0x80168b,%rax
+  801df8:	00 00 00 
+  801dfb:	ff d0                	call   *%rax
+  801dfd:	85 c0                	test   %eax,%eax
+  801dff:	75 60                	jne    801e61 <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  801e01:	be 02 00 00 00       	mov    $0x2,%esi
+  801e06:	44 89 e7             	mov    %r12d,%edi
+  801e09:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  801e10:	00 00 00 
+  801e13:	ff d0                	call   *%rax
+        return -1;
+  801e15:	85 c0                	test   %eax,%eax
+  801e17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801e1c:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  801e20:	44 89 e0             	mov    %r12d,%eax
+  801e23:	5b                   	pop    %rbx
+  801e24:	41 5c                	pop    %r12
+  801e26:	5d                   	pop    %rbp
+  801e27:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801e28:	48 b8 b3 12 80 00 00 	movabs $0x8012b3,%rax
+  801e2f:	00 00 00 
+  801e32:	ff d0                	call   *%rax
+  801e34:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e39:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  801e40:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801e47:	00 00 00 
+  801e4a:	48 01 d0             	add    %rdx,%rax
+  801e4d:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  801e54:	00 00 00 
+        return 0;
+  801e57:	eb c7                	jmp    801e20 <fork+0x97>
+        return -1;
+  801e59:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e5f:	eb bf                	jmp    801e20 <fork+0x97>
+  801e61:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e67:	eb b7                	jmp    801e20 <fork+0x97>
+
+0000000000801e69 <sfork>:
+
+envid_t
+sfork() {
+  801e69:	55                   	push   %rbp
+  801e6a:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801e6d:	48 ba e6 55 80 00 00 	movabs $0x8055e6,%rdx
+  801e74:	00 00 00 
+  801e77:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801e7c:	48 bf 01 56 80 00 00 	movabs $0x805601,%rdi
+  801e83:	00 00 00 
+  801e86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8b:	48 b9 20 41 80 00 00 	movabs $0x804120,%rcx
+  801e92:	00 00 00 
+  801e95:	ff d1                	call   *%rcx
+
+0000000000801e97 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e97:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e9e:	ff ff ff 
+  801ea1:	48 01 f8             	add    %rdi,%rax
+  801ea4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ea8:	c3                   	ret
+
+0000000000801ea9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ea9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801eb0:	ff ff ff 
+  801eb3:	48 01 f8             	add    %rdi,%rax
+  801eb6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801eba:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801ec0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801ec4:	c3                   	ret
+
+0000000000801ec5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ec5:	55                   	push   %rbp
+  801ec6:	48 89 e5             	mov    %rsp,%rbp
+  801ec9:	41 57                	push   %r15
+  801ecb:	41 56                	push   %r14
+  801ecd:	41 55                	push   %r13
+  801ecf:	41 54                	push   %r12
+  801ed1:	53                   	push   %rbx
+  801ed2:	48 83 ec 08          	sub    $0x8,%rsp
+  801ed6:	49 89 ff             	mov    %rdi,%r15
+  801ed9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ede:	49 bd 79 3d 80 00 00 	movabs $0x803d79,%r13
+  801ee5:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ee8:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801eee:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801ef1:	48 89 df             	mov    %rbx,%rdi
+  801ef4:	41 ff d5             	call   *%r13
+  801ef7:	83 e0 04             	and    $0x4,%eax
+  801efa:	74 17                	je     801f13 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801efc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801f03:	4c 39 f3             	cmp    %r14,%rbx
+  801f06:	75 e6                	jne    801eee <fd_alloc+0x29>
+  801f08:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801f0e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801f13:	4d 89 27             	mov    %r12,(%r15)
+}
+  801f16:	48 83 c4 08          	add    $0x8,%rsp
+  801f1a:	5b                   	pop    %rbx
+  801f1b:	41 5c                	pop    %r12
+  801f1d:	41 5d                	pop    %r13
+  801f1f:	41 5e                	pop    %r14
+  801f21:	41 5f                	pop    %r15
+  801f23:	5d                   	pop    %rbp
+  801f24:	c3                   	ret
+
+0000000000801f25 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801f25:	83 ff 1f             	cmp    $0x1f,%edi
+  801f28:	77 39                	ja     801f63 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801f2a:	55                   	push   %rbp
+  801f2b:	48 89 e5             	mov    %rsp,%rbp
+  801f2e:	41 54                	push   %r12
+  801f30:	53                   	push   %rbx
+  801f31:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801f34:	48 63 df             	movslq %edi,%rbx
+  801f37:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801f3e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801f42:	48 89 df             	mov    %rbx,%rdi
+  801f45:	48 b8 79 3d 80 00 00 	movabs $0x803d79,%rax
+  801f4c:	00 00 00 
+  801f4f:	ff d0                	call   *%rax
+  801f51:	a8 04                	test   $0x4,%al
+  801f53:	74 14                	je     801f69 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801f55:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801f59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f5e:	5b                   	pop    %rbx
+  801f5f:	41 5c                	pop    %r12
+  801f61:	5d                   	pop    %rbp
+  801f62:	c3                   	ret
+        return -E_INVAL;
+  801f63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801f68:	c3                   	ret
+        return -E_INVAL;
+  801f69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f6e:	eb ee                	jmp    801f5e <fd_lookup+0x39>
+
+0000000000801f70 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801f70:	55                   	push   %rbp
+  801f71:	48 89 e5             	mov    %rsp,%rbp
+  801f74:	41 54                	push   %r12
+  801f76:	53                   	push   %rbx
+  801f77:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801f7a:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  801f81:	00 00 00 
+  801f84:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801f8b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801f8e:	39 3b                	cmp    %edi,(%rbx)
+  801f90:	74 47                	je     801fd9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801f92:	48 83 c0 08          	add    $0x8,%rax
+  801f96:	48 8b 18             	mov    (%rax),%rbx
+  801f99:	48 85 db             	test   %rbx,%rbx
+  801f9c:	75 f0                	jne    801f8e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801f9e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801fa5:	00 00 00 
+  801fa8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fae:	89 fa                	mov    %edi,%edx
+  801fb0:	48 bf 10 56 80 00 00 	movabs $0x805610,%rdi
+  801fb7:	00 00 00 
+  801fba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbf:	48 b9 9b 02 80 00 00 	movabs $0x80029b,%rcx
+  801fc6:	00 00 00 
+  801fc9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801fcb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801fd0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801fd4:	5b                   	pop    %rbx
+  801fd5:	41 5c                	pop    %r12
+  801fd7:	5d                   	pop    %rbp
+  801fd8:	c3                   	ret
+            return 0;
+  801fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fde:	eb f0                	jmp    801fd0 <dev_lookup+0x60>
+
+0000000000801fe0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801fe0:	55                   	push   %rbp
+  801fe1:	48 89 e5             	mov    %rsp,%rbp
+  801fe4:	41 55                	push   %r13
+  801fe6:	41 54                	push   %r12
+  801fe8:	53                   	push   %rbx
+  801fe9:	48 83 ec 18          	sub    $0x18,%rsp
+  801fed:	48 89 fb             	mov    %rdi,%rbx
+  801ff0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ff3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ffa:	ff ff ff 
+  801ffd:	48 01 df             	add    %rbx,%rdi
+  802000:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802004:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802008:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  80200f:	00 00 00 
+  802012:	ff d0                	call   *%rax
+  802014:	41 89 c5             	mov    %eax,%r13d
+  802017:	85 c0                	test   %eax,%eax
+  802019:	78 06                	js     802021 <fd_close+0x41>
+  80201b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80201f:	74 1a                	je     80203b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802021:	45 84 e4             	test   %r12b,%r12b
+  802024:	b8 00 00 00 00       	mov    $0x0,%eax
+  802029:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80202d:	44 89 e8             	mov    %r13d,%eax
+  802030:	48 83 c4 18          	add    $0x18,%rsp
+  802034:	5b                   	pop    %rbx
+  802035:	41 5c                	pop    %r12
+  802037:	41 5d                	pop    %r13
+  802039:	5d                   	pop    %rbp
+  80203a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80203b:	8b 3b                	mov    (%rbx),%edi
+  80203d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802041:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  802048:	00 00 00 
+  80204b:	ff d0                	call   *%rax
+  80204d:	41 89 c5             	mov    %eax,%r13d
+  802050:	85 c0                	test   %eax,%eax
+  802052:	78 1b                	js     80206f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802054:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802058:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80205c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802062:	48 85 c0             	test   %rax,%rax
+  802065:	74 08                	je     80206f <fd_close+0x8f>
+  802067:	48 89 df             	mov    %rbx,%rdi
+  80206a:	ff d0                	call   *%rax
+  80206c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80206f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802074:	48 89 de             	mov    %rbx,%rsi
+  802077:	bf 00 00 00 00       	mov    $0x0,%edi
+  80207c:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  802083:	00 00 00 
+  802086:	ff d0                	call   *%rax
+    return res;
+  802088:	eb a3                	jmp    80202d <fd_close+0x4d>
+
+000000000080208a <close>:
+
+int
+close(int fdnum) {
+  80208a:	55                   	push   %rbp
+  80208b:	48 89 e5             	mov    %rsp,%rbp
+  80208e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802092:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802096:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  80209d:	00 00 00 
+  8020a0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020a2:	85 c0                	test   %eax,%eax
+  8020a4:	78 15                	js     8020bb <close+0x31>
+
+    return fd_close(fd, 1);
+  8020a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8020ab:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8020af:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8020b6:	00 00 00 
+  8020b9:	ff d0                	call   *%rax
+}
+  8020bb:	c9                   	leave
+  8020bc:	c3                   	ret
+
+00000000008020bd <close_all>:
+
+void
+close_all(void) {
+  8020bd:	55                   	push   %rbp
+  8020be:	48 89 e5             	mov    %rsp,%rbp
+  8020c1:	41 54                	push   %r12
+  8020c3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8020c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020c9:	49 bc 8a 20 80 00 00 	movabs $0x80208a,%r12
+  8020d0:	00 00 00 
+  8020d3:	89 df                	mov    %ebx,%edi
+  8020d5:	41 ff d4             	call   *%r12
+  8020d8:	83 c3 01             	add    $0x1,%ebx
+  8020db:	83 fb 20             	cmp    $0x20,%ebx
+  8020de:	75 f3                	jne    8020d3 <close_all+0x16>
+}
+  8020e0:	5b                   	pop    %rbx
+  8020e1:	41 5c                	pop    %r12
+  8020e3:	5d                   	pop    %rbp
+  8020e4:	c3                   	ret
+
+00000000008020e5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8020e5:	55                   	push   %rbp
+  8020e6:	48 89 e5             	mov    %rsp,%rbp
+  8020e9:	41 57                	push   %r15
+  8020eb:	41 56                	push   %r14
+  8020ed:	41 55                	push   %r13
+  8020ef:	41 54                	push   %r12
+  8020f1:	53                   	push   %rbx
+  8020f2:	48 83 ec 18          	sub    $0x18,%rsp
+  8020f6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8020f9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8020fd:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+  802109:	89 c3                	mov    %eax,%ebx
+  80210b:	85 c0                	test   %eax,%eax
+  80210d:	0f 88 b8 00 00 00    	js     8021cb <dup+0xe6>
+    close(newfdnum);
+  802113:	44 89 e7             	mov    %r12d,%edi
+  802116:	48 b8 8a 20 80 00 00 	movabs $0x80208a,%rax
+  80211d:	00 00 00 
+  802120:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802122:	4d 63 ec             	movslq %r12d,%r13
+  802125:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80212c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802130:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802134:	4c 89 ff             	mov    %r15,%rdi
+  802137:	49 be a9 1e 80 00 00 	movabs $0x801ea9,%r14
+  80213e:	00 00 00 
+  802141:	41 ff d6             	call   *%r14
+  802144:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802147:	4c 89 ef             	mov    %r13,%rdi
+  80214a:	41 ff d6             	call   *%r14
+  80214d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802150:	48 89 df             	mov    %rbx,%rdi
+  802153:	48 b8 79 3d 80 00 00 	movabs $0x803d79,%rax
+  80215a:	00 00 00 
+  80215d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80215f:	a8 04                	test   $0x4,%al
+  802161:	74 2b                	je     80218e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802163:	41 89 c1             	mov    %eax,%r9d
+  802166:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80216c:	4c 89 f1             	mov    %r14,%rcx
+  80216f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802174:	48 89 de             	mov    %rbx,%rsi
+  802177:	bf 00 00 00 00       	mov    $0x0,%edi
+  80217c:	48 b8 da 13 80 00 00 	movabs $0x8013da,%rax
+  802183:	00 00 00 
+  802186:	ff d0                	call   *%rax
+  802188:	89 c3                	mov    %eax,%ebx
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 4e                	js     8021dc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80218e:	4c 89 ff             	mov    %r15,%rdi
+  802191:	48 b8 79 3d 80 00 00 	movabs $0x803d79,%rax
+  802198:	00 00 00 
+  80219b:	ff d0                	call   *%rax
+  80219d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8021a0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8021a6:	4c 89 e9             	mov    %r13,%rcx
+  8021a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ae:	4c 89 fe             	mov    %r15,%rsi
+  8021b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b6:	48 b8 da 13 80 00 00 	movabs $0x8013da,%rax
+  8021bd:	00 00 00 
+  8021c0:	ff d0                	call   *%rax
+  8021c2:	89 c3                	mov    %eax,%ebx
+  8021c4:	85 c0                	test   %eax,%eax
+  8021c6:	78 14                	js     8021dc <dup+0xf7>
+
+    return newfdnum;
+  8021c8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8021cb:	89 d8                	mov    %ebx,%eax
+  8021cd:	48 83 c4 18          	add    $0x18,%rsp
+  8021d1:	5b                   	pop    %rbx
+  8021d2:	41 5c                	pop    %r12
+  8021d4:	41 5d                	pop    %r13
+  8021d6:	41 5e                	pop    %r14
+  8021d8:	41 5f                	pop    %r15
+  8021da:	5d                   	pop    %rbp
+  8021db:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8021dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021e1:	4c 89 ee             	mov    %r13,%rsi
+  8021e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021e9:	49 bc 52 15 80 00 00 	movabs $0x801552,%r12
+  8021f0:	00 00 00 
+  8021f3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8021f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021fb:	4c 89 f6             	mov    %r14,%rsi
+  8021fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802203:	41 ff d4             	call   *%r12
+    return res;
+  802206:	eb c3                	jmp    8021cb <dup+0xe6>
+
+0000000000802208 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802208:	55                   	push   %rbp
+  802209:	48 89 e5             	mov    %rsp,%rbp
+  80220c:	41 56                	push   %r14
+  80220e:	41 55                	push   %r13
+  802210:	41 54                	push   %r12
+  802212:	53                   	push   %rbx
+  802213:	48 83 ec 10          	sub    $0x10,%rsp
+  802217:	89 fb                	mov    %edi,%ebx
+  802219:	49 89 f4             	mov    %rsi,%r12
+  80221c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80221f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802223:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  80222a:	00 00 00 
+  80222d:	ff d0                	call   *%rax
+  80222f:	85 c0                	test   %eax,%eax
+  802231:	78 4c                	js     80227f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802233:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802237:	41 8b 3e             	mov    (%r14),%edi
+  80223a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80223e:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  802245:	00 00 00 
+  802248:	ff d0                	call   *%rax
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	78 35                	js     802283 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80224e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802252:	83 e0 03             	and    $0x3,%eax
+  802255:	83 f8 01             	cmp    $0x1,%eax
+  802258:	74 2d                	je     802287 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80225a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80225e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802262:	48 85 c0             	test   %rax,%rax
+  802265:	74 56                	je     8022bd <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802267:	4c 89 ea             	mov    %r13,%rdx
+  80226a:	4c 89 e6             	mov    %r12,%rsi
+  80226d:	4c 89 f7             	mov    %r14,%rdi
+  802270:	ff d0                	call   *%rax
+}
+  802272:	48 83 c4 10          	add    $0x10,%rsp
+  802276:	5b                   	pop    %rbx
+  802277:	41 5c                	pop    %r12
+  802279:	41 5d                	pop    %r13
+  80227b:	41 5e                	pop    %r14
+  80227d:	5d                   	pop    %rbp
+  80227e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80227f:	48 98                	cltq
+  802281:	eb ef                	jmp    802272 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802283:	48 98                	cltq
+  802285:	eb eb                	jmp    802272 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802287:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80228e:	00 00 00 
+  802291:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802297:	89 da                	mov    %ebx,%edx
+  802299:	48 bf 51 56 80 00 00 	movabs $0x805651,%rdi
+  8022a0:	00 00 00 
+  8022a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a8:	48 b9 9b 02 80 00 00 	movabs $0x80029b,%rcx
+  8022af:	00 00 00 
+  8022b2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022bb:	eb b5                	jmp    802272 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8022bd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8022c4:	eb ac                	jmp    802272 <read+0x6a>
+
+00000000008022c6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8022c6:	55                   	push   %rbp
+  8022c7:	48 89 e5             	mov    %rsp,%rbp
+  8022ca:	41 57                	push   %r15
+  8022cc:	41 56                	push   %r14
+  8022ce:	41 55                	push   %r13
+  8022d0:	41 54                	push   %r12
+  8022d2:	53                   	push   %rbx
+  8022d3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8022d7:	48 85 d2             	test   %rdx,%rdx
+  8022da:	74 54                	je     802330 <readn+0x6a>
+  8022dc:	41 89 fd             	mov    %edi,%r13d
+  8022df:	49 89 f6             	mov    %rsi,%r14
+  8022e2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8022e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8022ea:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8022ef:	49 bf 08 22 80 00 00 	movabs $0x802208,%r15
+  8022f6:	00 00 00 
+  8022f9:	4c 89 e2             	mov    %r12,%rdx
+  8022fc:	48 29 f2             	sub    %rsi,%rdx
+  8022ff:	4c 01 f6             	add    %r14,%rsi
+  802302:	44 89 ef             	mov    %r13d,%edi
+  802305:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802308:	85 c0                	test   %eax,%eax
+  80230a:	78 20                	js     80232c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80230c:	01 c3                	add    %eax,%ebx
+  80230e:	85 c0                	test   %eax,%eax
+  802310:	74 08                	je     80231a <readn+0x54>
+  802312:	48 63 f3             	movslq %ebx,%rsi
+  802315:	4c 39 e6             	cmp    %r12,%rsi
+  802318:	72 df                	jb     8022f9 <readn+0x33>
+    }
+    return res;
+  80231a:	48 63 c3             	movslq %ebx,%rax
+}
+  80231d:	48 83 c4 08          	add    $0x8,%rsp
+  802321:	5b                   	pop    %rbx
+  802322:	41 5c                	pop    %r12
+  802324:	41 5d                	pop    %r13
+  802326:	41 5e                	pop    %r14
+  802328:	41 5f                	pop    %r15
+  80232a:	5d                   	pop    %rbp
+  80232b:	c3                   	ret
+        if (inc < 0) return inc;
+  80232c:	48 98                	cltq
+  80232e:	eb ed                	jmp    80231d <readn+0x57>
+    int inc = 1, res = 0;
+  802330:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802335:	eb e3                	jmp    80231a <readn+0x54>
+
+0000000000802337 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802337:	55                   	push   %rbp
+  802338:	48 89 e5             	mov    %rsp,%rbp
+  80233b:	41 56                	push   %r14
+  80233d:	41 55                	push   %r13
+  80233f:	41 54                	push   %r12
+  802341:	53                   	push   %rbx
+  802342:	48 83 ec 10          	sub    $0x10,%rsp
+  802346:	89 fb                	mov    %edi,%ebx
+  802348:	49 89 f4             	mov    %rsi,%r12
+  80234b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80234e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802352:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  802359:	00 00 00 
+  80235c:	ff d0                	call   *%rax
+  80235e:	85 c0                	test   %eax,%eax
+  802360:	78 47                	js     8023a9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802362:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802366:	41 8b 3e             	mov    (%r14),%edi
+  802369:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80236d:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  802374:	00 00 00 
+  802377:	ff d0                	call   *%rax
+  802379:	85 c0                	test   %eax,%eax
+  80237b:	78 30                	js     8023ad <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80237d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802382:	74 2d                	je     8023b1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802384:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802388:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80238c:	48 85 c0             	test   %rax,%rax
+  80238f:	74 56                	je     8023e7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802391:	4c 89 ea             	mov    %r13,%rdx
+  802394:	4c 89 e6             	mov    %r12,%rsi
+  802397:	4c 89 f7             	mov    %r14,%rdi
+  80239a:	ff d0                	call   *%rax
+}
+  80239c:	48 83 c4 10          	add    $0x10,%rsp
+  8023a0:	5b                   	pop    %rbx
+  8023a1:	41 5c                	pop    %r12
+  8023a3:	41 5d                	pop    %r13
+  8023a5:	41 5e                	pop    %r14
+  8023a7:	5d                   	pop    %rbp
+  8023a8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023a9:	48 98                	cltq
+  8023ab:	eb ef                	jmp    80239c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023ad:	48 98                	cltq
+  8023af:	eb eb                	jmp    80239c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023b1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8023b8:	00 00 00 
+  8023bb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023c1:	89 da                	mov    %ebx,%edx
+  8023c3:	48 bf 6d 56 80 00 00 	movabs $0x80566d,%rdi
+  8023ca:	00 00 00 
+  8023cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d2:	48 b9 9b 02 80 00 00 	movabs $0x80029b,%rcx
+  8023d9:	00 00 00 
+  8023dc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023de:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023e5:	eb b5                	jmp    80239c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023e7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8023ee:	eb ac                	jmp    80239c <write+0x65>
+
+00000000008023f0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8023f0:	55                   	push   %rbp
+  8023f1:	48 89 e5             	mov    %rsp,%rbp
+  8023f4:	53                   	push   %rbx
+  8023f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8023f9:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023fb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023ff:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  802406:	00 00 00 
+  802409:	ff d0                	call   *%rax
+  80240b:	85 c0                	test   %eax,%eax
+  80240d:	78 0c                	js     80241b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80240f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802413:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802416:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80241b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80241f:	c9                   	leave
+  802420:	c3                   	ret
+
+0000000000802421 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802421:	55                   	push   %rbp
+  802422:	48 89 e5             	mov    %rsp,%rbp
+  802425:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802429:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80242d:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  802434:	00 00 00 
+  802437:	ff d0                	call   *%rax
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	78 07                	js     802444 <tell+0x23>
+    return fdes->fd_offset;
+  80243d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802441:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802444:	c9                   	leave
+  802445:	c3                   	ret
+
+0000000000802446 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802446:	55                   	push   %rbp
+  802447:	48 89 e5             	mov    %rsp,%rbp
+  80244a:	41 55                	push   %r13
+  80244c:	41 54                	push   %r12
+  80244e:	53                   	push   %rbx
+  80244f:	48 83 ec 18          	sub    $0x18,%rsp
+  802453:	89 fb                	mov    %edi,%ebx
+  802455:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802458:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80245c:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  802463:	00 00 00 
+  802466:	ff d0                	call   *%rax
+  802468:	85 c0                	test   %eax,%eax
+  80246a:	78 38                	js     8024a4 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80246c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802470:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802474:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802478:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  80247f:	00 00 00 
+  802482:	ff d0                	call   *%rax
+  802484:	85 c0                	test   %eax,%eax
+  802486:	78 1c                	js     8024a4 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802488:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80248d:	74 20                	je     8024af <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80248f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802493:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802497:	48 85 c0             	test   %rax,%rax
+  80249a:	74 47                	je     8024e3 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80249c:	44 89 e6             	mov    %r12d,%esi
+  80249f:	4c 89 ef             	mov    %r13,%rdi
+  8024a2:	ff d0                	call   *%rax
+}
+  8024a4:	48 83 c4 18          	add    $0x18,%rsp
+  8024a8:	5b                   	pop    %rbx
+  8024a9:	41 5c                	pop    %r12
+  8024ab:	41 5d                	pop    %r13
+  8024ad:	5d                   	pop    %rbp
+  8024ae:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8024af:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8024b6:	00 00 00 
+  8024b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8024bf:	89 da                	mov    %ebx,%edx
+  8024c1:	48 bf 30 56 80 00 00 	movabs $0x805630,%rdi
+  8024c8:	00 00 00 
+  8024cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d0:	48 b9 9b 02 80 00 00 	movabs $0x80029b,%rcx
+  8024d7:	00 00 00 
+  8024da:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8024dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024e1:	eb c1                	jmp    8024a4 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024e3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024e8:	eb ba                	jmp    8024a4 <ftruncate+0x5e>
+
+00000000008024ea <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8024ea:	55                   	push   %rbp
+  8024eb:	48 89 e5             	mov    %rsp,%rbp
+  8024ee:	41 54                	push   %r12
+  8024f0:	53                   	push   %rbx
+  8024f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8024f5:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024f8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024fc:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  802503:	00 00 00 
+  802506:	ff d0                	call   *%rax
+  802508:	85 c0                	test   %eax,%eax
+  80250a:	78 4e                	js     80255a <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80250c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802510:	41 8b 3c 24          	mov    (%r12),%edi
+  802514:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802518:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  80251f:	00 00 00 
+  802522:	ff d0                	call   *%rax
+  802524:	85 c0                	test   %eax,%eax
+  802526:	78 32                	js     80255a <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802528:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80252c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802531:	74 30                	je     802563 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802533:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802536:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80253d:	00 00 00 
+    stat->st_isdir = 0;
+  802540:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802547:	00 00 00 
+    stat->st_dev = dev;
+  80254a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802551:	48 89 de             	mov    %rbx,%rsi
+  802554:	4c 89 e7             	mov    %r12,%rdi
+  802557:	ff 50 28             	call   *0x28(%rax)
+}
+  80255a:	48 83 c4 10          	add    $0x10,%rsp
+  80255e:	5b                   	pop    %rbx
+  80255f:	41 5c                	pop    %r12
+  802561:	5d                   	pop    %rbp
+  802562:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802563:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802568:	eb f0                	jmp    80255a <fstat+0x70>
+
+000000000080256a <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80256a:	55                   	push   %rbp
+  80256b:	48 89 e5             	mov    %rsp,%rbp
+  80256e:	41 54                	push   %r12
+  802570:	53                   	push   %rbx
+  802571:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802578:	41 89 fc             	mov    %edi,%r12d
+  80257b:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80257d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802581:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  802588:	00 00 00 
+  80258b:	ff d0                	call   *%rax
+  80258d:	85 c0                	test   %eax,%eax
+  80258f:	78 31                	js     8025c2 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802591:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802598:	44 89 e7             	mov    %r12d,%edi
+  80259b:	48 b8 ea 24 80 00 00 	movabs $0x8024ea,%rax
+  8025a2:	00 00 00 
+  8025a5:	ff d0                	call   *%rax
+  8025a7:	85 c0                	test   %eax,%eax
+  8025a9:	78 17                	js     8025c2 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8025ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025af:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8025b2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8025b5:	39 d3                	cmp    %edx,%ebx
+  8025b7:	0f 4f da             	cmovg  %edx,%ebx
+  8025ba:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8025bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025c2:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8025c9:	5b                   	pop    %rbx
+  8025ca:	41 5c                	pop    %r12
+  8025cc:	5d                   	pop    %rbp
+  8025cd:	c3                   	ret
+
+00000000008025ce <seektoend>:
+{
+  8025ce:	55                   	push   %rbp
+  8025cf:	48 89 e5             	mov    %rsp,%rbp
+  8025d2:	53                   	push   %rbx
+  8025d3:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8025da:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8025dc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025e0:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  8025e7:	00 00 00 
+  8025ea:	ff d0                	call   *%rax
+  8025ec:	85 c0                	test   %eax,%eax
+  8025ee:	78 28                	js     802618 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8025f0:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8025f7:	89 df                	mov    %ebx,%edi
+  8025f9:	48 b8 ea 24 80 00 00 	movabs $0x8024ea,%rax
+  802600:	00 00 00 
+  802603:	ff d0                	call   *%rax
+  802605:	85 c0                	test   %eax,%eax
+  802607:	78 0f                	js     802618 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802609:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80260c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802610:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802613:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802618:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80261c:	c9                   	leave
+  80261d:	c3                   	ret
+
+000000000080261e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80261e:	55                   	push   %rbp
+  80261f:	48 89 e5             	mov    %rsp,%rbp
+  802622:	41 54                	push   %r12
+  802624:	53                   	push   %rbx
+  802625:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802628:	be 00 00 00 00       	mov    $0x0,%esi
+  80262d:	48 b8 11 32 80 00 00 	movabs $0x803211,%rax
+  802634:	00 00 00 
+  802637:	ff d0                	call   *%rax
+  802639:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80263b:	85 c0                	test   %eax,%eax
+  80263d:	78 25                	js     802664 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80263f:	4c 89 e6             	mov    %r12,%rsi
+  802642:	89 c7                	mov    %eax,%edi
+  802644:	48 b8 ea 24 80 00 00 	movabs $0x8024ea,%rax
+  80264b:	00 00 00 
+  80264e:	ff d0                	call   *%rax
+  802650:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802653:	89 df                	mov    %ebx,%edi
+  802655:	48 b8 8a 20 80 00 00 	movabs $0x80208a,%rax
+  80265c:	00 00 00 
+  80265f:	ff d0                	call   *%rax
+
+    return res;
+  802661:	44 89 e3             	mov    %r12d,%ebx
+}
+  802664:	89 d8                	mov    %ebx,%eax
+  802666:	5b                   	pop    %rbx
+  802667:	41 5c                	pop    %r12
+  802669:	5d                   	pop    %rbp
+  80266a:	c3                   	ret
+
+000000000080266b <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  80266b:	55                   	push   %rbp
+  80266c:	48 89 e5             	mov    %rsp,%rbp
+  80266f:	53                   	push   %rbx
+  802670:	48 83 ec 08          	sub    $0x8,%rsp
+  802674:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802677:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80267e:	00 00 00 
+  802681:	ff d0                	call   *%rax
+  802683:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802687:	0f 87 ea 00 00 00    	ja     802777 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  80268d:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802694:	00 00 00 
+  802697:	80 38 00             	cmpb   $0x0,(%rax)
+  80269a:	75 35                	jne    8026d1 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  80269c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8026a1:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8026a6:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8026ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026b0:	48 b8 73 13 80 00 00 	movabs $0x801373,%rax
+  8026b7:	00 00 00 
+  8026ba:	ff d0                	call   *%rax
+  8026bc:	85 c0                	test   %eax,%eax
+  8026be:	0f 88 ba 00 00 00    	js     80277e <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8026c4:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8026cb:	00 00 00 
+  8026ce:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8026d1:	48 89 df             	mov    %rbx,%rdi
+  8026d4:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  8026db:	00 00 00 
+  8026de:	ff d0                	call   *%rax
+  8026e0:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8026e4:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8026eb:	00 00 00 
+  8026ee:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8026f2:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8026f5:	39 39                	cmp    %edi,(%rcx)
+  8026f7:	74 46                	je     80273f <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8026f9:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8026fd:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802704:	00 
+  802705:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80270c:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802713:	00 
+  802714:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80271b:	00 
+  80271c:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802723:	00 
+  802724:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80272b:	00 
+  80272c:	89 39                	mov    %edi,(%rcx)
+  80272e:	48 01 c6             	add    %rax,%rsi
+  802731:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802736:	48 89 c8             	mov    %rcx,%rax
+  802739:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80273d:	c9                   	leave
+  80273e:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80273f:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802743:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80274a:	00 00 00 
+  80274d:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802750:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802754:	74 e0                	je     802736 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802756:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80275d:	00 
+  80275e:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802762:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802769:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80276b:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80276e:	48 01 c2             	add    %rax,%rdx
+  802771:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802775:	eb bf                	jmp    802736 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802777:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80277c:	eb b8                	jmp    802736 <fbuf_get+0xcb>
+            return NULL;
+  80277e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802783:	eb b1                	jmp    802736 <fbuf_get+0xcb>
+
+0000000000802785 <fsipc_bulk>:
+fsipc_bulk(void) {
+  802785:	55                   	push   %rbp
+  802786:	48 89 e5             	mov    %rsp,%rbp
+  802789:	53                   	push   %rbx
+  80278a:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  80278e:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802795:	00 00 00 
+  802798:	48 8b 18             	mov    (%rax),%rbx
+  80279b:	48 85 db             	test   %rbx,%rbx
+  80279e:	74 16                	je     8027b6 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8027a0:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8027a7:	00 00 00 
+  8027aa:	48 8b 18             	mov    (%rax),%rbx
+}
+  8027ad:	48 89 d8             	mov    %rbx,%rax
+  8027b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027b4:	c9                   	leave
+  8027b5:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8027b6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027bb:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8027c0:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8027c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ca:	48 b8 73 13 80 00 00 	movabs $0x801373,%rax
+  8027d1:	00 00 00 
+  8027d4:	ff d0                	call   *%rax
+  8027d6:	85 c0                	test   %eax,%eax
+  8027d8:	78 d3                	js     8027ad <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8027da:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8027df:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8027e6:	00 00 00 
+  8027e9:	eb b5                	jmp    8027a0 <fsipc_bulk+0x1b>
+
+00000000008027eb <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8027eb:	55                   	push   %rbp
+  8027ec:	48 89 e5             	mov    %rsp,%rbp
+  8027ef:	41 57                	push   %r15
+  8027f1:	41 56                	push   %r14
+  8027f3:	41 55                	push   %r13
+  8027f5:	41 54                	push   %r12
+  8027f7:	53                   	push   %rbx
+  8027f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8027fc:	41 89 fd             	mov    %edi,%r13d
+  8027ff:	49 89 f6             	mov    %rsi,%r14
+  802802:	49 89 d7             	mov    %rdx,%r15
+  802805:	48 89 cb             	mov    %rcx,%rbx
+  802808:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80280b:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802812:	00 00 00 
+  802815:	83 38 00             	cmpl   $0x0,(%rax)
+  802818:	74 52                	je     80286c <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80281a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802820:	4c 89 f9             	mov    %r15,%rcx
+  802823:	4c 89 f2             	mov    %r14,%rdx
+  802826:	44 89 ee             	mov    %r13d,%esi
+  802829:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802830:	00 00 00 
+  802833:	8b 38                	mov    (%rax),%edi
+  802835:	48 b8 73 43 80 00 00 	movabs $0x804373,%rax
+  80283c:	00 00 00 
+  80283f:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802841:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802846:	4c 89 e2             	mov    %r12,%rdx
+  802849:	48 89 de             	mov    %rbx,%rsi
+  80284c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802851:	48 b8 c3 41 80 00 00 	movabs $0x8041c3,%rax
+  802858:	00 00 00 
+  80285b:	ff d0                	call   *%rax
+}
+  80285d:	48 83 c4 08          	add    $0x8,%rsp
+  802861:	5b                   	pop    %rbx
+  802862:	41 5c                	pop    %r12
+  802864:	41 5d                	pop    %r13
+  802866:	41 5e                	pop    %r14
+  802868:	41 5f                	pop    %r15
+  80286a:	5d                   	pop    %rbp
+  80286b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80286c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802871:	48 b8 16 44 80 00 00 	movabs $0x804416,%rax
+  802878:	00 00 00 
+  80287b:	ff d0                	call   *%rax
+  80287d:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802884:	00 00 
+  802886:	eb 92                	jmp    80281a <fsipc_region+0x2f>
+
+0000000000802888 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802888:	55                   	push   %rbp
+  802889:	48 89 e5             	mov    %rsp,%rbp
+  80288c:	41 57                	push   %r15
+  80288e:	41 56                	push   %r14
+  802890:	41 55                	push   %r13
+  802892:	41 54                	push   %r12
+  802894:	53                   	push   %rbx
+  802895:	48 83 ec 28          	sub    $0x28,%rsp
+  802899:	49 89 ff             	mov    %rdi,%r15
+  80289c:	49 89 f6             	mov    %rsi,%r14
+  80289f:	48 89 d3             	mov    %rdx,%rbx
+  8028a2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8028a6:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8028a9:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  8028b0:	00 00 00 
+  8028b3:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8028b5:	48 85 c0             	test   %rax,%rax
+  8028b8:	0f 84 cc 00 00 00    	je     80298a <devfile_write_direct+0x102>
+  8028be:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8028c1:	48 85 db             	test   %rbx,%rbx
+  8028c4:	0f 84 ba 00 00 00    	je     802984 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8028ca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8028d0:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8028d7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8028db:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8028df:	4c 29 e3             	sub    %r12,%rbx
+  8028e2:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8028e7:	48 39 c3             	cmp    %rax,%rbx
+  8028ea:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8028ee:	48 89 da             	mov    %rbx,%rdx
+  8028f1:	4c 89 f6             	mov    %r14,%rsi
+  8028f4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8028f8:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  8028ff:	00 00 00 
+  802902:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802904:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802908:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  80290c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80290f:	44 01 e0             	add    %r12d,%eax
+  802912:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802916:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80291a:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802921:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802928:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80292f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802935:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80293a:	4c 89 ee             	mov    %r13,%rsi
+  80293d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802942:	48 b8 eb 27 80 00 00 	movabs $0x8027eb,%rax
+  802949:	00 00 00 
+  80294c:	ff d0                	call   *%rax
+        if (res < 0)
+  80294e:	85 c0                	test   %eax,%eax
+  802950:	78 29                	js     80297b <devfile_write_direct+0xf3>
+        if (res == 0)
+  802952:	74 2b                	je     80297f <devfile_write_direct+0xf7>
+        i += res;
+  802954:	48 98                	cltq
+  802956:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802959:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  80295c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802960:	49 39 c4             	cmp    %rax,%r12
+  802963:	0f 82 72 ff ff ff    	jb     8028db <devfile_write_direct+0x53>
+    return i;
+  802969:	4c 89 e0             	mov    %r12,%rax
+}
+  80296c:	48 83 c4 28          	add    $0x28,%rsp
+  802970:	5b                   	pop    %rbx
+  802971:	41 5c                	pop    %r12
+  802973:	41 5d                	pop    %r13
+  802975:	41 5e                	pop    %r14
+  802977:	41 5f                	pop    %r15
+  802979:	5d                   	pop    %rbp
+  80297a:	c3                   	ret
+            return res;
+  80297b:	48 98                	cltq
+  80297d:	eb ed                	jmp    80296c <devfile_write_direct+0xe4>
+            return i;
+  80297f:	4c 89 e0             	mov    %r12,%rax
+  802982:	eb e8                	jmp    80296c <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802984:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802988:	eb df                	jmp    802969 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  80298a:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802991:	eb d9                	jmp    80296c <devfile_write_direct+0xe4>
+
+0000000000802993 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802993:	55                   	push   %rbp
+  802994:	48 89 e5             	mov    %rsp,%rbp
+  802997:	41 56                	push   %r14
+  802999:	41 55                	push   %r13
+  80299b:	41 54                	push   %r12
+  80299d:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  80299e:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8029a2:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8029a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ab:	4d 39 ee             	cmp    %r13,%r14
+  8029ae:	0f 84 99 00 00 00    	je     802a4d <fbuf_flush+0xba>
+  8029b4:	49 89 fc             	mov    %rdi,%r12
+  8029b7:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8029ba:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8029bd:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8029c1:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  8029c8:	00 00 00 
+  8029cb:	ff d0                	call   *%rax
+  8029cd:	48 89 c2             	mov    %rax,%rdx
+  8029d0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8029d4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8029d8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8029dc:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8029e1:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8029e4:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8029e8:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8029ef:	00 
+  8029f0:	44 89 f1             	mov    %r14d,%ecx
+  8029f3:	4c 89 ea             	mov    %r13,%rdx
+  8029f6:	4c 89 e7             	mov    %r12,%rdi
+  8029f9:	48 b8 88 28 80 00 00 	movabs $0x802888,%rax
+  802a00:	00 00 00 
+  802a03:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a05:	48 85 c0             	test   %rax,%rax
+  802a08:	78 43                	js     802a4d <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802a0a:	4c 39 e8             	cmp    %r13,%rax
+  802a0d:	72 47                	jb     802a56 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802a0f:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802a14:	83 c0 01             	add    $0x1,%eax
+  802a17:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802a1c:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802a1f:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802a23:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802a27:	72 0f                	jb     802a38 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802a29:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802a2d:	48 39 c2             	cmp    %rax,%rdx
+  802a30:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802a34:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802a38:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802a3f:	00 
+  802a40:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802a47:	00 
+    return 0;
+  802a48:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a4d:	5b                   	pop    %rbx
+  802a4e:	41 5c                	pop    %r12
+  802a50:	41 5d                	pop    %r13
+  802a52:	41 5e                	pop    %r14
+  802a54:	5d                   	pop    %rbp
+  802a55:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802a56:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802a5b:	eb f0                	jmp    802a4d <fbuf_flush+0xba>
+
+0000000000802a5d <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802a5d:	55                   	push   %rbp
+  802a5e:	48 89 e5             	mov    %rsp,%rbp
+  802a61:	53                   	push   %rbx
+  802a62:	48 83 ec 08          	sub    $0x8,%rsp
+  802a66:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802a69:	48 b8 6b 26 80 00 00 	movabs $0x80266b,%rax
+  802a70:	00 00 00 
+  802a73:	ff d0                	call   *%rax
+  802a75:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7d:	48 85 f6             	test   %rsi,%rsi
+  802a80:	74 0f                	je     802a91 <devfile_sync+0x34>
+  802a82:	48 89 df             	mov    %rbx,%rdi
+  802a85:	48 b8 93 29 80 00 00 	movabs $0x802993,%rax
+  802a8c:	00 00 00 
+  802a8f:	ff d0                	call   *%rax
+}
+  802a91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a95:	c9                   	leave
+  802a96:	c3                   	ret
+
+0000000000802a97 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802a97:	55                   	push   %rbp
+  802a98:	48 89 e5             	mov    %rsp,%rbp
+  802a9b:	48 83 ec 10          	sub    $0x10,%rsp
+  802a9f:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802aa2:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802aa9:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802aaa:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802aae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ab3:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802aba:	00 00 00 
+  802abd:	48 b8 eb 27 80 00 00 	movabs $0x8027eb,%rax
+  802ac4:	00 00 00 
+  802ac7:	ff d0                	call   *%rax
+}
+  802ac9:	c9                   	leave
+  802aca:	c3                   	ret
+
+0000000000802acb <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802acb:	55                   	push   %rbp
+  802acc:	48 89 e5             	mov    %rsp,%rbp
+  802acf:	41 54                	push   %r12
+  802ad1:	53                   	push   %rbx
+  802ad2:	48 89 fb             	mov    %rdi,%rbx
+  802ad5:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802ad8:	48 b8 5d 2a 80 00 00 	movabs $0x802a5d,%rax
+  802adf:	00 00 00 
+  802ae2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ae4:	85 c0                	test   %eax,%eax
+  802ae6:	78 63                	js     802b4b <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ae8:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802aeb:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802af2:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802af4:	be 00 00 00 00       	mov    $0x0,%esi
+  802af9:	bf 05 00 00 00       	mov    $0x5,%edi
+  802afe:	48 b8 97 2a 80 00 00 	movabs $0x802a97,%rax
+  802b05:	00 00 00 
+  802b08:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b0a:	85 c0                	test   %eax,%eax
+  802b0c:	78 3d                	js     802b4b <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b0e:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802b15:	00 00 00 
+  802b18:	48 89 de             	mov    %rbx,%rsi
+  802b1b:	4c 89 e7             	mov    %r12,%rdi
+  802b1e:	48 b8 13 0c 80 00 00 	movabs $0x800c13,%rax
+  802b25:	00 00 00 
+  802b28:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b2a:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802b30:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802b37:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b38:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802b3e:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802b45:	00 
+
+    return 0;
+  802b46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b4b:	5b                   	pop    %rbx
+  802b4c:	41 5c                	pop    %r12
+  802b4e:	5d                   	pop    %rbp
+  802b4f:	c3                   	ret
+
+0000000000802b50 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b50:	55                   	push   %rbp
+  802b51:	48 89 e5             	mov    %rsp,%rbp
+  802b54:	41 54                	push   %r12
+  802b56:	53                   	push   %rbx
+  802b57:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802b5a:	48 b8 5d 2a 80 00 00 	movabs $0x802a5d,%rax
+  802b61:	00 00 00 
+  802b64:	ff d0                	call   *%rax
+  802b66:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802b69:	48 89 df             	mov    %rbx,%rdi
+  802b6c:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  802b73:	00 00 00 
+  802b76:	ff d0                	call   *%rax
+  802b78:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802b7c:	76 2e                	jbe    802bac <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802b7e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b81:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802b88:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802b8a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b8f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802b94:	48 b8 97 2a 80 00 00 	movabs $0x802a97,%rax
+  802b9b:	00 00 00 
+  802b9e:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802ba0:	45 85 e4             	test   %r12d,%r12d
+  802ba3:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802ba7:	5b                   	pop    %rbx
+  802ba8:	41 5c                	pop    %r12
+  802baa:	5d                   	pop    %rbp
+  802bab:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802bac:	48 89 df             	mov    %rbx,%rdi
+  802baf:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  802bb6:	00 00 00 
+  802bb9:	ff d0                	call   *%rax
+  802bbb:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802bbf:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802bc6:	00 00 00 
+  802bc9:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802bd0:	48 89 df             	mov    %rbx,%rdi
+  802bd3:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  802bda:	00 00 00 
+  802bdd:	ff d0                	call   *%rax
+  802bdf:	48 89 c6             	mov    %rax,%rsi
+  802be2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802be7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bec:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  802bf3:	00 00 00 
+  802bf6:	ff d0                	call   *%rax
+  802bf8:	eb 84                	jmp    802b7e <devfile_flush+0x2e>
+
+0000000000802bfa <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802bfa:	55                   	push   %rbp
+  802bfb:	48 89 e5             	mov    %rsp,%rbp
+  802bfe:	41 55                	push   %r13
+  802c00:	41 54                	push   %r12
+  802c02:	53                   	push   %rbx
+  802c03:	48 83 ec 08          	sub    $0x8,%rsp
+  802c07:	48 89 fb             	mov    %rdi,%rbx
+  802c0a:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802c0d:	48 b8 6b 26 80 00 00 	movabs $0x80266b,%rax
+  802c14:	00 00 00 
+  802c17:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802c19:	48 85 c0             	test   %rax,%rax
+  802c1c:	74 51                	je     802c6f <devfile_trunc+0x75>
+  802c1e:	49 89 c4             	mov    %rax,%r12
+  802c21:	48 89 c6             	mov    %rax,%rsi
+  802c24:	48 89 df             	mov    %rbx,%rdi
+  802c27:	48 b8 93 29 80 00 00 	movabs $0x802993,%rax
+  802c2e:	00 00 00 
+  802c31:	ff d0                	call   *%rax
+  802c33:	85 c0                	test   %eax,%eax
+  802c35:	78 2d                	js     802c64 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802c37:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802c3e:	00 00 00 
+  802c41:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802c44:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802c46:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802c4a:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c54:	48 b8 97 2a 80 00 00 	movabs $0x802a97,%rax
+  802c5b:	00 00 00 
+  802c5e:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802c60:	85 c0                	test   %eax,%eax
+  802c62:	79 3e                	jns    802ca2 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802c64:	48 83 c4 08          	add    $0x8,%rsp
+  802c68:	5b                   	pop    %rbx
+  802c69:	41 5c                	pop    %r12
+  802c6b:	41 5d                	pop    %r13
+  802c6d:	5d                   	pop    %rbp
+  802c6e:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802c6f:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802c76:	00 00 00 
+  802c79:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802c7c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802c7e:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802c82:	be 00 00 00 00       	mov    $0x0,%esi
+  802c87:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c8c:	48 b8 97 2a 80 00 00 	movabs $0x802a97,%rax
+  802c93:	00 00 00 
+  802c96:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802c98:	85 c0                	test   %eax,%eax
+  802c9a:	78 c8                	js     802c64 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802c9c:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ca0:	eb c2                	jmp    802c64 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ca2:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802ca5:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ca8:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802cab:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802cb0:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802cb7:	00 00 
+  802cb9:	eb a9                	jmp    802c64 <devfile_trunc+0x6a>
+
+0000000000802cbb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802cbb:	55                   	push   %rbp
+  802cbc:	48 89 e5             	mov    %rsp,%rbp
+  802cbf:	41 57                	push   %r15
+  802cc1:	41 56                	push   %r14
+  802cc3:	41 55                	push   %r13
+  802cc5:	41 54                	push   %r12
+  802cc7:	53                   	push   %rbx
+  802cc8:	48 83 ec 28          	sub    $0x28,%rsp
+  802ccc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802cd0:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802cd4:	49 89 d7             	mov    %rdx,%r15
+  802cd7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802cdb:	48 b8 6b 26 80 00 00 	movabs $0x80266b,%rax
+  802ce2:	00 00 00 
+  802ce5:	ff d0                	call   *%rax
+  802ce7:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802cea:	48 85 c0             	test   %rax,%rax
+  802ced:	74 31                	je     802d20 <devfile_write+0x65>
+  802cef:	4c 89 f8             	mov    %r15,%rax
+  802cf2:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802cf9:	77 25                	ja     802d20 <devfile_write+0x65>
+    size_t i = 0;
+  802cfb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802d01:	48 85 c0             	test   %rax,%rax
+  802d04:	0f 85 64 01 00 00    	jne    802e6e <devfile_write+0x1b3>
+    size_t i = 0;
+  802d0a:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802d0e:	4c 89 f8             	mov    %r15,%rax
+}
+  802d11:	48 83 c4 28          	add    $0x28,%rsp
+  802d15:	5b                   	pop    %rbx
+  802d16:	41 5c                	pop    %r12
+  802d18:	41 5d                	pop    %r13
+  802d1a:	41 5e                	pop    %r14
+  802d1c:	41 5f                	pop    %r15
+  802d1e:	5d                   	pop    %rbp
+  802d1f:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d20:	48 85 db             	test   %rbx,%rbx
+  802d23:	74 5b                	je     802d80 <devfile_write+0xc5>
+  802d25:	48 89 de             	mov    %rbx,%rsi
+  802d28:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d2c:	48 b8 93 29 80 00 00 	movabs $0x802993,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+  802d38:	85 c0                	test   %eax,%eax
+  802d3a:	78 40                	js     802d7c <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802d3c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d40:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802d43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d47:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802d4b:	48 b8 88 28 80 00 00 	movabs $0x802888,%rax
+  802d52:	00 00 00 
+  802d55:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802d57:	48 85 c0             	test   %rax,%rax
+  802d5a:	7e b5                	jle    802d11 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802d5c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802d60:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802d63:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802d66:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802d69:	8d 51 01             	lea    0x1(%rcx),%edx
+  802d6c:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d6f:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802d72:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802d79:	00 
+  802d7a:	eb 95                	jmp    802d11 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d7c:	48 98                	cltq
+  802d7e:	eb 91                	jmp    802d11 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802d80:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802d84:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802d87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d8b:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802d8f:	48 89 df             	mov    %rbx,%rdi
+  802d92:	48 b8 88 28 80 00 00 	movabs $0x802888,%rax
+  802d99:	00 00 00 
+  802d9c:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802d9e:	48 85 c0             	test   %rax,%rax
+  802da1:	0f 8e 6a ff ff ff    	jle    802d11 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802da7:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802daa:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802dae:	e9 5e ff ff ff       	jmp    802d11 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802db3:	48 98                	cltq
+  802db5:	4d 85 ff             	test   %r15,%r15
+  802db8:	49 0f 45 c7          	cmovne %r15,%rax
+  802dbc:	e9 50 ff ff ff       	jmp    802d11 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802dc1:	48 89 de             	mov    %rbx,%rsi
+  802dc4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802dc8:	48 b8 93 29 80 00 00 	movabs $0x802993,%rax
+  802dcf:	00 00 00 
+  802dd2:	ff d0                	call   *%rax
+  802dd4:	85 c0                	test   %eax,%eax
+  802dd6:	0f 88 2b 01 00 00    	js     802f07 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802ddc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802de0:	4c 01 f8             	add    %r15,%rax
+  802de3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802de7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802deb:	48 b9 97 1e 80 00 00 	movabs $0x801e97,%rcx
+  802df2:	00 00 00 
+  802df5:	ff d1                	call   *%rcx
+  802df7:	48 89 c2             	mov    %rax,%rdx
+  802dfa:	48 c1 e2 04          	shl    $0x4,%rdx
+  802dfe:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802e02:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e06:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802e0b:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802e0e:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802e15:	00 
+  802e16:	4c 89 ea             	mov    %r13,%rdx
+  802e19:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802e1d:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  802e24:	00 00 00 
+  802e27:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802e29:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802e2d:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802e31:	48 39 c2             	cmp    %rax,%rdx
+  802e34:	0f 84 db 00 00 00    	je     802f15 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802e3a:	4c 39 e2             	cmp    %r12,%rdx
+  802e3d:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802e41:	4d 01 ec             	add    %r13,%r12
+  802e44:	49 39 c4             	cmp    %rax,%r12
+  802e47:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802e4b:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802e4f:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802e53:	45 01 ee             	add    %r13d,%r14d
+  802e56:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e5a:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802e5e:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802e61:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e65:	49 39 c7             	cmp    %rax,%r15
+  802e68:	0f 83 a0 fe ff ff    	jae    802d0e <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802e6e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e72:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802e76:	8b 43 08             	mov    0x8(%rbx),%eax
+  802e79:	44 39 f0             	cmp    %r14d,%eax
+  802e7c:	7f 10                	jg     802e8e <devfile_write+0x1d3>
+  802e7e:	48 98                	cltq
+  802e80:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802e86:	49 63 d6             	movslq %r14d,%rdx
+  802e89:	48 39 d0             	cmp    %rdx,%rax
+  802e8c:	7d 2d                	jge    802ebb <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e8e:	48 89 de             	mov    %rbx,%rsi
+  802e91:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e95:	48 b8 93 29 80 00 00 	movabs $0x802993,%rax
+  802e9c:	00 00 00 
+  802e9f:	ff d0                	call   *%rax
+  802ea1:	85 c0                	test   %eax,%eax
+  802ea3:	0f 88 0a ff ff ff    	js     802db3 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802ea9:	44 89 f0             	mov    %r14d,%eax
+  802eac:	66 b8 00 00          	mov    $0x0,%ax
+  802eb0:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802eb3:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802eba:	00 
+        size_t off = pos - fb->fb_base;
+  802ebb:	45 89 f4             	mov    %r14d,%r12d
+  802ebe:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802ec2:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802ec5:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802ec9:	4d 29 fd             	sub    %r15,%r13
+  802ecc:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802ed1:	4c 29 e0             	sub    %r12,%rax
+  802ed4:	49 39 c5             	cmp    %rax,%r13
+  802ed7:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802edb:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802edf:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802ee3:	48 39 c2             	cmp    %rax,%rdx
+  802ee6:	0f 84 f0 fe ff ff    	je     802ddc <devfile_write+0x121>
+  802eec:	4c 39 e0             	cmp    %r12,%rax
+  802eef:	0f 82 cc fe ff ff    	jb     802dc1 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802ef5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802ef9:	48 39 d0             	cmp    %rdx,%rax
+  802efc:	0f 83 da fe ff ff    	jae    802ddc <devfile_write+0x121>
+  802f02:	e9 ba fe ff ff       	jmp    802dc1 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f07:	48 98                	cltq
+  802f09:	4d 85 ff             	test   %r15,%r15
+  802f0c:	49 0f 45 c7          	cmovne %r15,%rax
+  802f10:	e9 fc fd ff ff       	jmp    802d11 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802f15:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802f19:	4c 89 e2             	mov    %r12,%rdx
+  802f1c:	e9 2a ff ff ff       	jmp    802e4b <devfile_write+0x190>
+
+0000000000802f21 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802f21:	55                   	push   %rbp
+  802f22:	48 89 e5             	mov    %rsp,%rbp
+  802f25:	41 57                	push   %r15
+  802f27:	41 56                	push   %r14
+  802f29:	41 55                	push   %r13
+  802f2b:	41 54                	push   %r12
+  802f2d:	53                   	push   %rbx
+  802f2e:	48 83 ec 28          	sub    $0x28,%rsp
+  802f32:	49 89 ff             	mov    %rdi,%r15
+  802f35:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f39:	48 89 d3             	mov    %rdx,%rbx
+  802f3c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f40:	48 b8 6b 26 80 00 00 	movabs $0x80266b,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+  802f4c:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802f4f:	48 85 c0             	test   %rax,%rax
+  802f52:	74 0d                	je     802f61 <devfile_read+0x40>
+  802f54:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802f5b:	0f 86 1a 01 00 00    	jbe    80307b <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f61:	4d 85 e4             	test   %r12,%r12
+  802f64:	74 1a                	je     802f80 <devfile_read+0x5f>
+  802f66:	4c 89 e6             	mov    %r12,%rsi
+  802f69:	4c 89 ff             	mov    %r15,%rdi
+  802f6c:	48 b8 93 29 80 00 00 	movabs $0x802993,%rax
+  802f73:	00 00 00 
+  802f76:	ff d0                	call   *%rax
+  802f78:	85 c0                	test   %eax,%eax
+  802f7a:	0f 88 e8 00 00 00    	js     803068 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802f80:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802f84:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  802f8b:	00 00 00 
+  802f8e:	ff d0                	call   *%rax
+  802f90:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802f93:	48 85 c0             	test   %rax,%rax
+  802f96:	0f 84 69 02 00 00    	je     803205 <devfile_read+0x2e4>
+    while (i < n) {
+  802f9c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802fa1:	0f 84 ce 00 00 00    	je     803075 <devfile_read+0x154>
+    size_t i = 0;
+  802fa7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802fac:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802fb3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802fb7:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802fbb:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802fbf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802fc3:	48 29 da             	sub    %rbx,%rdx
+  802fc6:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802fcb:	48 39 c2             	cmp    %rax,%rdx
+  802fce:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802fd2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802fd6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802fda:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802fdd:	01 d8                	add    %ebx,%eax
+  802fdf:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802fe3:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802fe7:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802fee:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802ff5:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802ffc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803002:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803007:	4c 89 ee             	mov    %r13,%rsi
+  80300a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80300f:	48 b8 eb 27 80 00 00 	movabs $0x8027eb,%rax
+  803016:	00 00 00 
+  803019:	ff d0                	call   *%rax
+        if (res < 0)
+  80301b:	85 c0                	test   %eax,%eax
+  80301d:	78 4d                	js     80306c <devfile_read+0x14b>
+        if (res == 0)
+  80301f:	74 4f                	je     803070 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803021:	4c 63 e0             	movslq %eax,%r12
+  803024:	4c 89 e2             	mov    %r12,%rdx
+  803027:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80302b:	4c 89 f7             	mov    %r14,%rdi
+  80302e:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  803035:	00 00 00 
+  803038:	ff d0                	call   *%rax
+        i += res;
+  80303a:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  80303d:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803040:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803044:	48 39 c3             	cmp    %rax,%rbx
+  803047:	0f 82 72 ff ff ff    	jb     802fbf <devfile_read+0x9e>
+    return i;
+  80304d:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803050:	48 85 c0             	test   %rax,%rax
+  803053:	7e 04                	jle    803059 <devfile_read+0x138>
+  803055:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803059:	48 83 c4 28          	add    $0x28,%rsp
+  80305d:	5b                   	pop    %rbx
+  80305e:	41 5c                	pop    %r12
+  803060:	41 5d                	pop    %r13
+  803062:	41 5e                	pop    %r14
+  803064:	41 5f                	pop    %r15
+  803066:	5d                   	pop    %rbp
+  803067:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803068:	48 98                	cltq
+  80306a:	eb ed                	jmp    803059 <devfile_read+0x138>
+            return res;
+  80306c:	48 98                	cltq
+  80306e:	eb e9                	jmp    803059 <devfile_read+0x138>
+            return i;
+  803070:	48 89 d8             	mov    %rbx,%rax
+  803073:	eb db                	jmp    803050 <devfile_read+0x12f>
+    size_t i = 0;
+  803075:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803079:	eb d2                	jmp    80304d <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80307b:	48 89 c6             	mov    %rax,%rsi
+  80307e:	4c 89 ff             	mov    %r15,%rdi
+  803081:	48 b8 93 29 80 00 00 	movabs $0x802993,%rax
+  803088:	00 00 00 
+  80308b:	ff d0                	call   *%rax
+  80308d:	85 c0                	test   %eax,%eax
+  80308f:	78 40                	js     8030d1 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803091:	4c 89 ff             	mov    %r15,%rdi
+  803094:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80309b:	00 00 00 
+  80309e:	ff d0                	call   *%rax
+  8030a0:	48 89 c2             	mov    %rax,%rdx
+  8030a3:	48 c1 e2 04          	shl    $0x4,%rdx
+  8030a7:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8030ab:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030af:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8030b4:	48 01 d0             	add    %rdx,%rax
+  8030b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8030bb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8030c0:	0f 84 33 01 00 00    	je     8031f9 <devfile_read+0x2d8>
+    size_t i = 0;
+  8030c6:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8030cc:	e9 f5 00 00 00       	jmp    8031c6 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8030d1:	48 98                	cltq
+  8030d3:	eb 84                	jmp    803059 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8030d5:	44 89 e8             	mov    %r13d,%eax
+  8030d8:	66 b8 00 00          	mov    $0x0,%ax
+  8030dc:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8030e1:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8030e8:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8030ea:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8030ee:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8030f2:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8030f4:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8030f9:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8030fc:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803103:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803104:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80310a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80310f:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803114:	bf 03 00 00 00       	mov    $0x3,%edi
+  803119:	48 b8 eb 27 80 00 00 	movabs $0x8027eb,%rax
+  803120:	00 00 00 
+  803123:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803125:	85 c0                	test   %eax,%eax
+  803127:	0f 88 be 00 00 00    	js     8031eb <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80312d:	48 63 d0             	movslq %eax,%rdx
+  803130:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803135:	41 03 44 24 08       	add    0x8(%r12),%eax
+  80313a:	44 39 e8             	cmp    %r13d,%eax
+  80313d:	0f 8e ba 00 00 00    	jle    8031fd <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803143:	49 63 c5             	movslq %r13d,%rax
+  803146:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  80314b:	48 29 c3             	sub    %rax,%rbx
+  80314e:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803153:	48 01 c3             	add    %rax,%rbx
+  803156:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80315a:	4c 29 f0             	sub    %r14,%rax
+  80315d:	48 39 c3             	cmp    %rax,%rbx
+  803160:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803164:	4c 89 ff             	mov    %r15,%rdi
+  803167:	48 b9 97 1e 80 00 00 	movabs $0x801e97,%rcx
+  80316e:	00 00 00 
+  803171:	ff d1                	call   *%rcx
+  803173:	48 89 c2             	mov    %rax,%rdx
+  803176:	48 c1 e2 04          	shl    $0x4,%rdx
+  80317a:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80317e:	48 c1 e0 0c          	shl    $0xc,%rax
+  803182:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803187:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  80318a:	44 89 ea             	mov    %r13d,%edx
+  80318d:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803192:	48 63 d2             	movslq %edx,%rdx
+  803195:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80319c:	00 
+  80319d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8031a1:	4c 01 f7             	add    %r14,%rdi
+  8031a4:	48 89 da             	mov    %rbx,%rdx
+  8031a7:	48 b9 08 10 80 00 00 	movabs $0x801008,%rcx
+  8031ae:	00 00 00 
+  8031b1:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8031b3:	41 01 dd             	add    %ebx,%r13d
+  8031b6:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8031ba:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8031bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031c1:	49 39 c6             	cmp    %rax,%r14
+  8031c4:	73 37                	jae    8031fd <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8031c6:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8031ca:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8031cf:	44 39 e8             	cmp    %r13d,%eax
+  8031d2:	0f 8f fd fe ff ff    	jg     8030d5 <devfile_read+0x1b4>
+  8031d8:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8031dd:	44 39 e8             	cmp    %r13d,%eax
+  8031e0:	0f 8f 5d ff ff ff    	jg     803143 <devfile_read+0x222>
+  8031e6:	e9 ea fe ff ff       	jmp    8030d5 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8031eb:	48 98                	cltq
+  8031ed:	4d 85 f6             	test   %r14,%r14
+  8031f0:	49 0f 45 c6          	cmovne %r14,%rax
+  8031f4:	e9 60 fe ff ff       	jmp    803059 <devfile_read+0x138>
+    size_t i = 0;
+  8031f9:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8031fd:	4c 89 f0             	mov    %r14,%rax
+  803200:	e9 54 fe ff ff       	jmp    803059 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803205:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80320c:	e9 48 fe ff ff       	jmp    803059 <devfile_read+0x138>
+
+0000000000803211 <open>:
+open(const char *path, int mode) {
+  803211:	55                   	push   %rbp
+  803212:	48 89 e5             	mov    %rsp,%rbp
+  803215:	41 55                	push   %r13
+  803217:	41 54                	push   %r12
+  803219:	53                   	push   %rbx
+  80321a:	48 83 ec 18          	sub    $0x18,%rsp
+  80321e:	49 89 fc             	mov    %rdi,%r12
+  803221:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803224:	48 b8 d5 0b 80 00 00 	movabs $0x800bd5,%rax
+  80322b:	00 00 00 
+  80322e:	ff d0                	call   *%rax
+  803230:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803236:	0f 87 8a 00 00 00    	ja     8032c6 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80323c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803240:	48 b8 c5 1e 80 00 00 	movabs $0x801ec5,%rax
+  803247:	00 00 00 
+  80324a:	ff d0                	call   *%rax
+  80324c:	89 c3                	mov    %eax,%ebx
+  80324e:	85 c0                	test   %eax,%eax
+  803250:	78 50                	js     8032a2 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803252:	4c 89 e6             	mov    %r12,%rsi
+  803255:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80325c:	00 00 00 
+  80325f:	48 89 df             	mov    %rbx,%rdi
+  803262:	48 b8 13 0c 80 00 00 	movabs $0x800c13,%rax
+  803269:	00 00 00 
+  80326c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80326e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803275:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803279:	bf 01 00 00 00       	mov    $0x1,%edi
+  80327e:	48 b8 97 2a 80 00 00 	movabs $0x802a97,%rax
+  803285:	00 00 00 
+  803288:	ff d0                	call   *%rax
+  80328a:	89 c3                	mov    %eax,%ebx
+  80328c:	85 c0                	test   %eax,%eax
+  80328e:	78 1f                	js     8032af <open+0x9e>
+    return fd2num(fd);
+  803290:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803294:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80329b:	00 00 00 
+  80329e:	ff d0                	call   *%rax
+  8032a0:	89 c3                	mov    %eax,%ebx
+}
+  8032a2:	89 d8                	mov    %ebx,%eax
+  8032a4:	48 83 c4 18          	add    $0x18,%rsp
+  8032a8:	5b                   	pop    %rbx
+  8032a9:	41 5c                	pop    %r12
+  8032ab:	41 5d                	pop    %r13
+  8032ad:	5d                   	pop    %rbp
+  8032ae:	c3                   	ret
+        fd_close(fd, 0);
+  8032af:	be 00 00 00 00       	mov    $0x0,%esi
+  8032b4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032b8:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8032bf:	00 00 00 
+  8032c2:	ff d0                	call   *%rax
+        return res;
+  8032c4:	eb dc                	jmp    8032a2 <open+0x91>
+        return -E_BAD_PATH;
+  8032c6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8032cb:	eb d5                	jmp    8032a2 <open+0x91>
+
+00000000008032cd <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8032cd:	55                   	push   %rbp
+  8032ce:	48 89 e5             	mov    %rsp,%rbp
+  8032d1:	41 57                	push   %r15
+  8032d3:	41 56                	push   %r14
+  8032d5:	41 55                	push   %r13
+  8032d7:	41 54                	push   %r12
+  8032d9:	53                   	push   %rbx
+  8032da:	48 83 ec 18          	sub    $0x18,%rsp
+  8032de:	41 89 f6             	mov    %esi,%r14d
+  8032e1:	49 89 d7             	mov    %rdx,%r15
+  8032e4:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032e7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8032eb:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  8032f2:	00 00 00 
+  8032f5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032f7:	85 c0                	test   %eax,%eax
+  8032f9:	0f 88 db 00 00 00    	js     8033da <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8032ff:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803303:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80330a:	00 00 00 
+  80330d:	8b 00                	mov    (%rax),%eax
+  80330f:	39 07                	cmp    %eax,(%rdi)
+  803311:	0f 85 db 00 00 00    	jne    8033f2 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803317:	45 85 f6             	test   %r14d,%r14d
+  80331a:	0f 88 db 00 00 00    	js     8033fb <fmap+0x12e>
+  803320:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803327:	0f 85 d7 00 00 00    	jne    803404 <fmap+0x137>
+  80332d:	4c 89 fb             	mov    %r15,%rbx
+  803330:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803336:	0f 85 d1 00 00 00    	jne    80340d <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80333c:	48 b8 5d 2a 80 00 00 	movabs $0x802a5d,%rax
+  803343:	00 00 00 
+  803346:	ff d0                	call   *%rax
+  803348:	85 c0                	test   %eax,%eax
+  80334a:	0f 88 8e 00 00 00    	js     8033de <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803350:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803357:	00 00 00 
+    while (i < n) {
+  80335a:	4d 85 ed             	test   %r13,%r13
+  80335d:	0f 84 8a 00 00 00    	je     8033ed <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803363:	4c 89 ea             	mov    %r13,%rdx
+  803366:	48 29 da             	sub    %rbx,%rdx
+  803369:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803370:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803376:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80337a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80337e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803381:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  803385:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803389:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  80338e:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803393:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803397:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80339b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033a0:	4c 89 e6             	mov    %r12,%rsi
+  8033a3:	bf 09 00 00 00       	mov    $0x9,%edi
+  8033a8:	48 b8 eb 27 80 00 00 	movabs $0x8027eb,%rax
+  8033af:	00 00 00 
+  8033b2:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8033b4:	85 c0                	test   %eax,%eax
+  8033b6:	78 2a                	js     8033e2 <fmap+0x115>
+        i += res;
+  8033b8:	48 98                	cltq
+  8033ba:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8033bd:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8033c1:	72 05                	jb     8033c8 <fmap+0xfb>
+    while (i < n) {
+  8033c3:	4c 39 eb             	cmp    %r13,%rbx
+  8033c6:	72 9b                	jb     803363 <fmap+0x96>
+    }
+    return i;
+  8033c8:	48 89 d8             	mov    %rbx,%rax
+}
+  8033cb:	48 83 c4 18          	add    $0x18,%rsp
+  8033cf:	5b                   	pop    %rbx
+  8033d0:	41 5c                	pop    %r12
+  8033d2:	41 5d                	pop    %r13
+  8033d4:	41 5e                	pop    %r14
+  8033d6:	41 5f                	pop    %r15
+  8033d8:	5d                   	pop    %rbp
+  8033d9:	c3                   	ret
+    if (res < 0) return res;
+  8033da:	48 98                	cltq
+  8033dc:	eb ed                	jmp    8033cb <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8033de:	48 98                	cltq
+  8033e0:	eb e9                	jmp    8033cb <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8033e2:	48 98                	cltq
+  8033e4:	48 85 db             	test   %rbx,%rbx
+  8033e7:	48 0f 45 c3          	cmovne %rbx,%rax
+  8033eb:	eb de                	jmp    8033cb <fmap+0xfe>
+    size_t i = 0;
+  8033ed:	4c 89 eb             	mov    %r13,%rbx
+  8033f0:	eb d6                	jmp    8033c8 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8033f2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8033f9:	eb d0                	jmp    8033cb <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8033fb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803402:	eb c7                	jmp    8033cb <fmap+0xfe>
+  803404:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80340b:	eb be                	jmp    8033cb <fmap+0xfe>
+  80340d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803414:	eb b5                	jmp    8033cb <fmap+0xfe>
+
+0000000000803416 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803416:	55                   	push   %rbp
+  803417:	48 89 e5             	mov    %rsp,%rbp
+  80341a:	41 56                	push   %r14
+  80341c:	41 55                	push   %r13
+  80341e:	41 54                	push   %r12
+  803420:	53                   	push   %rbx
+  803421:	48 83 ec 10          	sub    $0x10,%rsp
+  803425:	89 fb                	mov    %edi,%ebx
+  803427:	41 89 f4             	mov    %esi,%r12d
+  80342a:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80342d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803431:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  803438:	00 00 00 
+  80343b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80343d:	85 c0                	test   %eax,%eax
+  80343f:	78 63                	js     8034a4 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803441:	45 85 e4             	test   %r12d,%r12d
+  803444:	0f 88 80 00 00 00    	js     8034ca <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80344a:	45 89 e6             	mov    %r12d,%r14d
+  80344d:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803454:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803458:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  80345f:	00 00 00 
+  803462:	ff d0                	call   *%rax
+  803464:	48 89 c2             	mov    %rax,%rdx
+  803467:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80346c:	44 89 f6             	mov    %r14d,%esi
+  80346f:	89 df                	mov    %ebx,%edi
+  803471:	48 b8 cd 32 80 00 00 	movabs $0x8032cd,%rax
+  803478:	00 00 00 
+  80347b:	ff d0                	call   *%rax
+  80347d:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803480:	45 29 f4             	sub    %r14d,%r12d
+  803483:	4d 63 f4             	movslq %r12d,%r14
+  803486:	49 39 c6             	cmp    %rax,%r14
+  803489:	7c 1d                	jl     8034a8 <read_map+0x92>
+  80348b:	48 85 c0             	test   %rax,%rax
+  80348e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803493:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803497:	48 83 c4 10          	add    $0x10,%rsp
+  80349b:	5b                   	pop    %rbx
+  80349c:	41 5c                	pop    %r12
+  80349e:	41 5d                	pop    %r13
+  8034a0:	41 5e                	pop    %r14
+  8034a2:	5d                   	pop    %rbp
+  8034a3:	c3                   	ret
+    if (res < 0) return res;
+  8034a4:	48 98                	cltq
+  8034a6:	eb ef                	jmp    803497 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8034a8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034ac:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  8034b3:	00 00 00 
+  8034b6:	ff d0                	call   *%rax
+  8034b8:	4d 63 e4             	movslq %r12d,%r12
+  8034bb:	4c 01 e0             	add    %r12,%rax
+  8034be:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8034c2:	48 89 d8             	mov    %rbx,%rax
+  8034c5:	4c 29 f0             	sub    %r14,%rax
+  8034c8:	eb cd                	jmp    803497 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8034ca:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034d1:	eb c4                	jmp    803497 <read_map+0x81>
+
+00000000008034d3 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8034d3:	55                   	push   %rbp
+  8034d4:	48 89 e5             	mov    %rsp,%rbp
+  8034d7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034db:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034df:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  8034e6:	00 00 00 
+  8034e9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034eb:	85 c0                	test   %eax,%eax
+  8034ed:	78 4a                	js     803539 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8034ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034f3:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8034fa:	00 00 00 
+  8034fd:	8b 00                	mov    (%rax),%eax
+  8034ff:	39 07                	cmp    %eax,(%rdi)
+  803501:	75 38                	jne    80353b <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803503:	48 b8 5d 2a 80 00 00 	movabs $0x802a5d,%rax
+  80350a:	00 00 00 
+  80350d:	ff d0                	call   *%rax
+  80350f:	85 c0                	test   %eax,%eax
+  803511:	78 26                	js     803539 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803513:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803517:	8b 40 0c             	mov    0xc(%rax),%eax
+  80351a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803521:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803523:	be 00 00 00 00       	mov    $0x0,%esi
+  803528:	bf 06 00 00 00       	mov    $0x6,%edi
+  80352d:	48 b8 97 2a 80 00 00 	movabs $0x802a97,%rax
+  803534:	00 00 00 
+  803537:	ff d0                	call   *%rax
+}
+  803539:	c9                   	leave
+  80353a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80353b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803540:	eb f7                	jmp    803539 <fsync+0x66>
+
+0000000000803542 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803542:	55                   	push   %rbp
+  803543:	48 89 e5             	mov    %rsp,%rbp
+  803546:	41 57                	push   %r15
+  803548:	41 56                	push   %r14
+  80354a:	41 55                	push   %r13
+  80354c:	41 54                	push   %r12
+  80354e:	53                   	push   %rbx
+  80354f:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803553:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80355a:	00 00 00 
+  80355d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803562:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803568:	49 bd 25 1f 80 00 00 	movabs $0x801f25,%r13
+  80356f:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803572:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803579:	00 00 00 
+  80357c:	eb 0c                	jmp    80358a <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80357e:	83 c3 01             	add    $0x1,%ebx
+  803581:	49 83 c4 28          	add    $0x28,%r12
+  803585:	83 fb 20             	cmp    $0x20,%ebx
+  803588:	74 33                	je     8035bd <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80358a:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80358f:	74 ed                	je     80357e <flushall+0x3c>
+  803591:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803595:	89 df                	mov    %ebx,%edi
+  803597:	41 ff d5             	call   *%r13
+  80359a:	85 c0                	test   %eax,%eax
+  80359c:	78 e0                	js     80357e <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80359e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8035a2:	41 8b 06             	mov    (%r14),%eax
+  8035a5:	39 07                	cmp    %eax,(%rdi)
+  8035a7:	75 d5                	jne    80357e <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8035a9:	48 b8 5d 2a 80 00 00 	movabs $0x802a5d,%rax
+  8035b0:	00 00 00 
+  8035b3:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8035b5:	85 c0                	test   %eax,%eax
+  8035b7:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8035bb:	eb c1                	jmp    80357e <flushall+0x3c>
+    }
+    return res;
+}
+  8035bd:	44 89 f8             	mov    %r15d,%eax
+  8035c0:	48 83 c4 18          	add    $0x18,%rsp
+  8035c4:	5b                   	pop    %rbx
+  8035c5:	41 5c                	pop    %r12
+  8035c7:	41 5d                	pop    %r13
+  8035c9:	41 5e                	pop    %r14
+  8035cb:	41 5f                	pop    %r15
+  8035cd:	5d                   	pop    %rbp
+  8035ce:	c3                   	ret
+
+00000000008035cf <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8035cf:	55                   	push   %rbp
+  8035d0:	48 89 e5             	mov    %rsp,%rbp
+  8035d3:	53                   	push   %rbx
+  8035d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8035d8:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8035db:	40 0f b6 c6          	movzbl %sil,%eax
+  8035df:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8035e6:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8035e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8035ed:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8035f2:	48 b8 97 2a 80 00 00 	movabs $0x802a97,%rax
+  8035f9:	00 00 00 
+  8035fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035fe:	85 c0                	test   %eax,%eax
+  803600:	78 23                	js     803625 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803602:	ba 58 06 00 00       	mov    $0x658,%edx
+  803607:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80360e:	00 00 00 
+  803611:	48 89 df             	mov    %rbx,%rdi
+  803614:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  80361b:	00 00 00 
+  80361e:	ff d0                	call   *%rax
+    return 0;
+  803620:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803625:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803629:	c9                   	leave
+  80362a:	c3                   	ret
+
+000000000080362b <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80362b:	55                   	push   %rbp
+  80362c:	48 89 e5             	mov    %rsp,%rbp
+  80362f:	53                   	push   %rbx
+  803630:	48 83 ec 08          	sub    $0x8,%rsp
+  803634:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803637:	48 b8 d5 0b 80 00 00 	movabs $0x800bd5,%rax
+  80363e:	00 00 00 
+  803641:	ff d0                	call   *%rax
+  803643:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803649:	77 35                	ja     803680 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80364b:	48 89 de             	mov    %rbx,%rsi
+  80364e:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803655:	00 00 00 
+  803658:	48 b8 13 0c 80 00 00 	movabs $0x800c13,%rax
+  80365f:	00 00 00 
+  803662:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803664:	be 00 00 00 00       	mov    $0x0,%esi
+  803669:	bf 07 00 00 00       	mov    $0x7,%edi
+  80366e:	48 b8 97 2a 80 00 00 	movabs $0x802a97,%rax
+  803675:	00 00 00 
+  803678:	ff d0                	call   *%rax
+}
+  80367a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80367e:	c9                   	leave
+  80367f:	c3                   	ret
+        return -E_BAD_PATH;
+  803680:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803685:	eb f3                	jmp    80367a <remove+0x4f>
+
+0000000000803687 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803687:	55                   	push   %rbp
+  803688:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  80368b:	48 b8 42 35 80 00 00 	movabs $0x803542,%rax
+  803692:	00 00 00 
+  803695:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803697:	be 00 00 00 00       	mov    $0x0,%esi
+  80369c:	bf 08 00 00 00       	mov    $0x8,%edi
+  8036a1:	48 b8 97 2a 80 00 00 	movabs $0x802a97,%rax
+  8036a8:	00 00 00 
+  8036ab:	ff d0                	call   *%rax
+}
+  8036ad:	5d                   	pop    %rbp
+  8036ae:	c3                   	ret
+
+00000000008036af <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8036af:	55                   	push   %rbp
+  8036b0:	48 89 e5             	mov    %rsp,%rbp
+  8036b3:	41 54                	push   %r12
+  8036b5:	53                   	push   %rbx
+  8036b6:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036b9:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  8036c0:	00 00 00 
+  8036c3:	ff d0                	call   *%rax
+  8036c5:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8036c8:	48 be c0 56 80 00 00 	movabs $0x8056c0,%rsi
+  8036cf:	00 00 00 
+  8036d2:	48 89 df             	mov    %rbx,%rdi
+  8036d5:	48 b8 13 0c 80 00 00 	movabs $0x800c13,%rax
+  8036dc:	00 00 00 
+  8036df:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8036e1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8036e6:	41 2b 04 24          	sub    (%r12),%eax
+  8036ea:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8036f0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8036f7:	00 00 00 
+    stat->st_dev = &devpipe;
+  8036fa:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803701:	00 00 00 
+  803704:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80370b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803710:	5b                   	pop    %rbx
+  803711:	41 5c                	pop    %r12
+  803713:	5d                   	pop    %rbp
+  803714:	c3                   	ret
+
+0000000000803715 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803715:	55                   	push   %rbp
+  803716:	48 89 e5             	mov    %rsp,%rbp
+  803719:	41 54                	push   %r12
+  80371b:	53                   	push   %rbx
+  80371c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80371f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803724:	48 89 fe             	mov    %rdi,%rsi
+  803727:	bf 00 00 00 00       	mov    $0x0,%edi
+  80372c:	49 bc 52 15 80 00 00 	movabs $0x801552,%r12
+  803733:	00 00 00 
+  803736:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803739:	48 89 df             	mov    %rbx,%rdi
+  80373c:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  803743:	00 00 00 
+  803746:	ff d0                	call   *%rax
+  803748:	48 89 c6             	mov    %rax,%rsi
+  80374b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803750:	bf 00 00 00 00       	mov    $0x0,%edi
+  803755:	41 ff d4             	call   *%r12
+}
+  803758:	5b                   	pop    %rbx
+  803759:	41 5c                	pop    %r12
+  80375b:	5d                   	pop    %rbp
+  80375c:	c3                   	ret
+
+000000000080375d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80375d:	55                   	push   %rbp
+  80375e:	48 89 e5             	mov    %rsp,%rbp
+  803761:	41 57                	push   %r15
+  803763:	41 56                	push   %r14
+  803765:	41 55                	push   %r13
+  803767:	41 54                	push   %r12
+  803769:	53                   	push   %rbx
+  80376a:	48 83 ec 18          	sub    $0x18,%rsp
+  80376e:	49 89 fc             	mov    %rdi,%r12
+  803771:	49 89 f5             	mov    %rsi,%r13
+  803774:	49 89 d7             	mov    %rdx,%r15
+  803777:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80377b:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  803782:	00 00 00 
+  803785:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803787:	4d 85 ff             	test   %r15,%r15
+  80378a:	0f 84 af 00 00 00    	je     80383f <devpipe_write+0xe2>
+  803790:	48 89 c3             	mov    %rax,%rbx
+  803793:	4c 89 f8             	mov    %r15,%rax
+  803796:	4d 89 ef             	mov    %r13,%r15
+  803799:	4c 01 e8             	add    %r13,%rax
+  80379c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8037a0:	49 bd 47 13 80 00 00 	movabs $0x801347,%r13
+  8037a7:	00 00 00 
+            sys_yield();
+  8037aa:	49 be e4 12 80 00 00 	movabs $0x8012e4,%r14
+  8037b1:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8037b4:	8b 73 04             	mov    0x4(%rbx),%esi
+  8037b7:	48 63 ce             	movslq %esi,%rcx
+  8037ba:	48 63 03             	movslq (%rbx),%rax
+  8037bd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8037c3:	48 39 c1             	cmp    %rax,%rcx
+  8037c6:	72 2e                	jb     8037f6 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8037c8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8037cd:	48 89 da             	mov    %rbx,%rdx
+  8037d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037d5:	4c 89 e7             	mov    %r12,%rdi
+  8037d8:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8037db:	85 c0                	test   %eax,%eax
+  8037dd:	74 66                	je     803845 <devpipe_write+0xe8>
+            sys_yield();
+  8037df:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8037e2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8037e5:	48 63 ce             	movslq %esi,%rcx
+  8037e8:	48 63 03             	movslq (%rbx),%rax
+  8037eb:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8037f1:	48 39 c1             	cmp    %rax,%rcx
+  8037f4:	73 d2                	jae    8037c8 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8037f6:	41 0f b6 3f          	movzbl (%r15),%edi
+  8037fa:	48 89 ca             	mov    %rcx,%rdx
+  8037fd:	48 c1 ea 03          	shr    $0x3,%rdx
+  803801:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803808:	08 10 20 
+  80380b:	48 f7 e2             	mul    %rdx
+  80380e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803812:	48 89 d0             	mov    %rdx,%rax
+  803815:	48 c1 e0 09          	shl    $0x9,%rax
+  803819:	48 29 d0             	sub    %rdx,%rax
+  80381c:	48 c1 e0 03          	shl    $0x3,%rax
+  803820:	48 29 c1             	sub    %rax,%rcx
+  803823:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803828:	83 c6 01             	add    $0x1,%esi
+  80382b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80382e:	49 83 c7 01          	add    $0x1,%r15
+  803832:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803836:	49 39 c7             	cmp    %rax,%r15
+  803839:	0f 85 75 ff ff ff    	jne    8037b4 <devpipe_write+0x57>
+    return n;
+  80383f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803843:	eb 05                	jmp    80384a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803845:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80384a:	48 83 c4 18          	add    $0x18,%rsp
+  80384e:	5b                   	pop    %rbx
+  80384f:	41 5c                	pop    %r12
+  803851:	41 5d                	pop    %r13
+  803853:	41 5e                	pop    %r14
+  803855:	41 5f                	pop    %r15
+  803857:	5d                   	pop    %rbp
+  803858:	c3                   	ret
+
+0000000000803859 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803859:	55                   	push   %rbp
+  80385a:	48 89 e5             	mov    %rsp,%rbp
+  80385d:	41 57                	push   %r15
+  80385f:	41 56                	push   %r14
+  803861:	41 55                	push   %r13
+  803863:	41 54                	push   %r12
+  803865:	53                   	push   %rbx
+  803866:	48 83 ec 18          	sub    $0x18,%rsp
+  80386a:	49 89 fc             	mov    %rdi,%r12
+  80386d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803871:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803875:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  80387c:	00 00 00 
+  80387f:	ff d0                	call   *%rax
+  803881:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803884:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80388a:	49 bd 47 13 80 00 00 	movabs $0x801347,%r13
+  803891:	00 00 00 
+            sys_yield();
+  803894:	49 be e4 12 80 00 00 	movabs $0x8012e4,%r14
+  80389b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80389e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8038a3:	74 7d                	je     803922 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8038a5:	8b 03                	mov    (%rbx),%eax
+  8038a7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8038aa:	75 26                	jne    8038d2 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8038ac:	4d 85 ff             	test   %r15,%r15
+  8038af:	75 77                	jne    803928 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8038b1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8038b6:	48 89 da             	mov    %rbx,%rdx
+  8038b9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8038be:	4c 89 e7             	mov    %r12,%rdi
+  8038c1:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8038c4:	85 c0                	test   %eax,%eax
+  8038c6:	74 72                	je     80393a <devpipe_read+0xe1>
+            sys_yield();
+  8038c8:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8038cb:	8b 03                	mov    (%rbx),%eax
+  8038cd:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8038d0:	74 df                	je     8038b1 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8038d2:	48 63 c8             	movslq %eax,%rcx
+  8038d5:	48 89 ca             	mov    %rcx,%rdx
+  8038d8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8038dc:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8038e3:	08 10 20 
+  8038e6:	48 89 d0             	mov    %rdx,%rax
+  8038e9:	48 f7 e6             	mul    %rsi
+  8038ec:	48 c1 ea 06          	shr    $0x6,%rdx
+  8038f0:	48 89 d0             	mov    %rdx,%rax
+  8038f3:	48 c1 e0 09          	shl    $0x9,%rax
+  8038f7:	48 29 d0             	sub    %rdx,%rax
+  8038fa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803901:	00 
+  803902:	48 89 c8             	mov    %rcx,%rax
+  803905:	48 29 d0             	sub    %rdx,%rax
+  803908:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80390d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803911:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803915:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803918:	49 83 c7 01          	add    $0x1,%r15
+  80391c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803920:	75 83                	jne    8038a5 <devpipe_read+0x4c>
+    return n;
+  803922:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803926:	eb 03                	jmp    80392b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803928:	4c 89 f8             	mov    %r15,%rax
+}
+  80392b:	48 83 c4 18          	add    $0x18,%rsp
+  80392f:	5b                   	pop    %rbx
+  803930:	41 5c                	pop    %r12
+  803932:	41 5d                	pop    %r13
+  803934:	41 5e                	pop    %r14
+  803936:	41 5f                	pop    %r15
+  803938:	5d                   	pop    %rbp
+  803939:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80393a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80393f:	eb ea                	jmp    80392b <devpipe_read+0xd2>
+
+0000000000803941 <pipe>:
+pipe(int pfd[2]) {
+  803941:	55                   	push   %rbp
+  803942:	48 89 e5             	mov    %rsp,%rbp
+  803945:	41 55                	push   %r13
+  803947:	41 54                	push   %r12
+  803949:	53                   	push   %rbx
+  80394a:	48 83 ec 18          	sub    $0x18,%rsp
+  80394e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803951:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803955:	48 b8 c5 1e 80 00 00 	movabs $0x801ec5,%rax
+  80395c:	00 00 00 
+  80395f:	ff d0                	call   *%rax
+  803961:	89 c3                	mov    %eax,%ebx
+  803963:	85 c0                	test   %eax,%eax
+  803965:	0f 88 a0 01 00 00    	js     803b0b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80396b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803970:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803975:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803979:	bf 00 00 00 00       	mov    $0x0,%edi
+  80397e:	48 b8 73 13 80 00 00 	movabs $0x801373,%rax
+  803985:	00 00 00 
+  803988:	ff d0                	call   *%rax
+  80398a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80398c:	85 c0                	test   %eax,%eax
+  80398e:	0f 88 77 01 00 00    	js     803b0b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803994:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803998:	48 b8 c5 1e 80 00 00 	movabs $0x801ec5,%rax
+  80399f:	00 00 00 
+  8039a2:	ff d0                	call   *%rax
+  8039a4:	89 c3                	mov    %eax,%ebx
+  8039a6:	85 c0                	test   %eax,%eax
+  8039a8:	0f 88 43 01 00 00    	js     803af1 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8039ae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039b3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039b8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8039bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c1:	48 b8 73 13 80 00 00 	movabs $0x801373,%rax
+  8039c8:	00 00 00 
+  8039cb:	ff d0                	call   *%rax
+  8039cd:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039cf:	85 c0                	test   %eax,%eax
+  8039d1:	0f 88 1a 01 00 00    	js     803af1 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8039d7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8039db:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  8039e2:	00 00 00 
+  8039e5:	ff d0                	call   *%rax
+  8039e7:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8039ea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039f4:	48 89 c6             	mov    %rax,%rsi
+  8039f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039fc:	48 b8 73 13 80 00 00 	movabs $0x801373,%rax
+  803a03:	00 00 00 
+  803a06:	ff d0                	call   *%rax
+  803a08:	89 c3                	mov    %eax,%ebx
+  803a0a:	85 c0                	test   %eax,%eax
+  803a0c:	0f 88 c5 00 00 00    	js     803ad7 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803a12:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a16:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  803a1d:	00 00 00 
+  803a20:	ff d0                	call   *%rax
+  803a22:	48 89 c1             	mov    %rax,%rcx
+  803a25:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803a2b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803a31:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a36:	4c 89 ee             	mov    %r13,%rsi
+  803a39:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a3e:	48 b8 da 13 80 00 00 	movabs $0x8013da,%rax
+  803a45:	00 00 00 
+  803a48:	ff d0                	call   *%rax
+  803a4a:	89 c3                	mov    %eax,%ebx
+  803a4c:	85 c0                	test   %eax,%eax
+  803a4e:	78 6e                	js     803abe <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a50:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a55:	4c 89 ef             	mov    %r13,%rdi
+  803a58:	48 b8 15 13 80 00 00 	movabs $0x801315,%rax
+  803a5f:	00 00 00 
+  803a62:	ff d0                	call   *%rax
+  803a64:	83 f8 02             	cmp    $0x2,%eax
+  803a67:	0f 85 ab 00 00 00    	jne    803b18 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a6d:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803a74:	00 00 
+  803a76:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a7a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a7c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a80:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a87:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a8b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803a8d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a91:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803a98:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a9c:	48 bb 97 1e 80 00 00 	movabs $0x801e97,%rbx
+  803aa3:	00 00 00 
+  803aa6:	ff d3                	call   *%rbx
+  803aa8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803aac:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ab0:	ff d3                	call   *%rbx
+  803ab2:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803ab7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803abc:	eb 4d                	jmp    803b0b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803abe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ac3:	4c 89 ee             	mov    %r13,%rsi
+  803ac6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803acb:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  803ad2:	00 00 00 
+  803ad5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803ad7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803adc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ae0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae5:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  803aec:	00 00 00 
+  803aef:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803af1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803af6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803afa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aff:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  803b06:	00 00 00 
+  803b09:	ff d0                	call   *%rax
+}
+  803b0b:	89 d8                	mov    %ebx,%eax
+  803b0d:	48 83 c4 18          	add    $0x18,%rsp
+  803b11:	5b                   	pop    %rbx
+  803b12:	41 5c                	pop    %r12
+  803b14:	41 5d                	pop    %r13
+  803b16:	5d                   	pop    %rbp
+  803b17:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b18:	48 b9 f0 56 80 00 00 	movabs $0x8056f0,%rcx
+  803b1f:	00 00 00 
+  803b22:	48 ba c7 56 80 00 00 	movabs $0x8056c7,%rdx
+  803b29:	00 00 00 
+  803b2c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803b31:	48 bf dc 56 80 00 00 	movabs $0x8056dc,%rdi
+  803b38:	00 00 00 
+  803b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b40:	49 b8 20 41 80 00 00 	movabs $0x804120,%r8
+  803b47:	00 00 00 
+  803b4a:	41 ff d0             	call   *%r8
+
+0000000000803b4d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b4d:	55                   	push   %rbp
+  803b4e:	48 89 e5             	mov    %rsp,%rbp
+  803b51:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b55:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b59:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  803b60:	00 00 00 
+  803b63:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b65:	85 c0                	test   %eax,%eax
+  803b67:	78 35                	js     803b9e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b69:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b6d:	48 b8 a9 1e 80 00 00 	movabs $0x801ea9,%rax
+  803b74:	00 00 00 
+  803b77:	ff d0                	call   *%rax
+  803b79:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b7c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b81:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b86:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b8a:	48 b8 47 13 80 00 00 	movabs $0x801347,%rax
+  803b91:	00 00 00 
+  803b94:	ff d0                	call   *%rax
+  803b96:	85 c0                	test   %eax,%eax
+  803b98:	0f 94 c0             	sete   %al
+  803b9b:	0f b6 c0             	movzbl %al,%eax
+}
+  803b9e:	c9                   	leave
+  803b9f:	c3                   	ret
+
+0000000000803ba0 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ba0:	48 89 f8             	mov    %rdi,%rax
+  803ba3:	48 c1 e8 27          	shr    $0x27,%rax
+  803ba7:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803bae:	7f 00 00 
+  803bb1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bb5:	f6 c2 01             	test   $0x1,%dl
+  803bb8:	74 6d                	je     803c27 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803bba:	48 89 f8             	mov    %rdi,%rax
+  803bbd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bc1:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803bc8:	7f 00 00 
+  803bcb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bcf:	f6 c2 01             	test   $0x1,%dl
+  803bd2:	74 62                	je     803c36 <get_uvpt_entry+0x96>
+  803bd4:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803bdb:	7f 00 00 
+  803bde:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803be2:	f6 c2 80             	test   $0x80,%dl
+  803be5:	75 4f                	jne    803c36 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803be7:	48 89 f8             	mov    %rdi,%rax
+  803bea:	48 c1 e8 15          	shr    $0x15,%rax
+  803bee:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803bf5:	7f 00 00 
+  803bf8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bfc:	f6 c2 01             	test   $0x1,%dl
+  803bff:	74 44                	je     803c45 <get_uvpt_entry+0xa5>
+  803c01:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803c08:	7f 00 00 
+  803c0b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c0f:	f6 c2 80             	test   $0x80,%dl
+  803c12:	75 31                	jne    803c45 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803c14:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803c18:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803c1f:	7f 00 00 
+  803c22:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803c26:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c27:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803c2e:	7f 00 00 
+  803c31:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c35:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c36:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c3d:	7f 00 00 
+  803c40:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c44:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c45:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803c4c:	7f 00 00 
+  803c4f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c53:	c3                   	ret
+
+0000000000803c54 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803c54:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803c57:	48 89 f9             	mov    %rdi,%rcx
+  803c5a:	48 c1 e9 27          	shr    $0x27,%rcx
+  803c5e:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803c65:	7f 00 00 
+  803c68:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803c6c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803c73:	f6 c1 01             	test   $0x1,%cl
+  803c76:	0f 84 b2 00 00 00    	je     803d2e <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803c7c:	48 89 f9             	mov    %rdi,%rcx
+  803c7f:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803c83:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803c8a:	7f 00 00 
+  803c8d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803c91:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803c98:	40 f6 c6 01          	test   $0x1,%sil
+  803c9c:	0f 84 8c 00 00 00    	je     803d2e <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803ca2:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ca9:	7f 00 00 
+  803cac:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803cb0:	a8 80                	test   $0x80,%al
+  803cb2:	75 7b                	jne    803d2f <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803cb4:	48 89 f9             	mov    %rdi,%rcx
+  803cb7:	48 c1 e9 15          	shr    $0x15,%rcx
+  803cbb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803cc2:	7f 00 00 
+  803cc5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803cc9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803cd0:	40 f6 c6 01          	test   $0x1,%sil
+  803cd4:	74 58                	je     803d2e <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803cd6:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803cdd:	7f 00 00 
+  803ce0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ce4:	a8 80                	test   $0x80,%al
+  803ce6:	75 6c                	jne    803d54 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803ce8:	48 89 f9             	mov    %rdi,%rcx
+  803ceb:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803cef:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803cf6:	7f 00 00 
+  803cf9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803cfd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803d04:	40 f6 c6 01          	test   $0x1,%sil
+  803d08:	74 24                	je     803d2e <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803d0a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803d11:	7f 00 00 
+  803d14:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d18:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d1f:	ff ff 7f 
+  803d22:	48 21 c8             	and    %rcx,%rax
+  803d25:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803d2b:	48 09 d0             	or     %rdx,%rax
+}
+  803d2e:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803d2f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803d36:	7f 00 00 
+  803d39:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d3d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d44:	ff ff 7f 
+  803d47:	48 21 c8             	and    %rcx,%rax
+  803d4a:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803d50:	48 01 d0             	add    %rdx,%rax
+  803d53:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803d54:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803d5b:	7f 00 00 
+  803d5e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d62:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d69:	ff ff 7f 
+  803d6c:	48 21 c8             	and    %rcx,%rax
+  803d6f:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803d75:	48 01 d0             	add    %rdx,%rax
+  803d78:	c3                   	ret
+
+0000000000803d79 <get_prot>:
+
+int
+get_prot(void *va) {
+  803d79:	55                   	push   %rbp
+  803d7a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803d7d:	48 b8 a0 3b 80 00 00 	movabs $0x803ba0,%rax
+  803d84:	00 00 00 
+  803d87:	ff d0                	call   *%rax
+  803d89:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803d8c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803d91:	89 c1                	mov    %eax,%ecx
+  803d93:	83 c9 04             	or     $0x4,%ecx
+  803d96:	f6 c2 01             	test   $0x1,%dl
+  803d99:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803d9c:	89 c1                	mov    %eax,%ecx
+  803d9e:	83 c9 02             	or     $0x2,%ecx
+  803da1:	f6 c2 02             	test   $0x2,%dl
+  803da4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803da7:	89 c1                	mov    %eax,%ecx
+  803da9:	83 c9 01             	or     $0x1,%ecx
+  803dac:	48 85 d2             	test   %rdx,%rdx
+  803daf:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803db2:	89 c1                	mov    %eax,%ecx
+  803db4:	83 c9 40             	or     $0x40,%ecx
+  803db7:	f6 c6 04             	test   $0x4,%dh
+  803dba:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803dbd:	5d                   	pop    %rbp
+  803dbe:	c3                   	ret
+
+0000000000803dbf <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803dbf:	55                   	push   %rbp
+  803dc0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803dc3:	48 b8 a0 3b 80 00 00 	movabs $0x803ba0,%rax
+  803dca:	00 00 00 
+  803dcd:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803dcf:	48 c1 e8 06          	shr    $0x6,%rax
+  803dd3:	83 e0 01             	and    $0x1,%eax
+}
+  803dd6:	5d                   	pop    %rbp
+  803dd7:	c3                   	ret
+
+0000000000803dd8 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803dd8:	55                   	push   %rbp
+  803dd9:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803ddc:	48 b8 a0 3b 80 00 00 	movabs $0x803ba0,%rax
+  803de3:	00 00 00 
+  803de6:	ff d0                	call   *%rax
+  803de8:	83 e0 01             	and    $0x1,%eax
+}
+  803deb:	5d                   	pop    %rbp
+  803dec:	c3                   	ret
+
+0000000000803ded <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803ded:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803df4:	7f 00 00 
+  803df7:	a8 01                	test   $0x1,%al
+  803df9:	75 06                	jne    803e01 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e00:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803e01:	55                   	push   %rbp
+  803e02:	48 89 e5             	mov    %rsp,%rbp
+  803e05:	41 57                	push   %r15
+  803e07:	41 56                	push   %r14
+  803e09:	41 55                	push   %r13
+  803e0b:	41 54                	push   %r12
+  803e0d:	53                   	push   %rbx
+  803e0e:	48 83 ec 18          	sub    $0x18,%rsp
+  803e12:	49 89 fe             	mov    %rdi,%r14
+  803e15:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803e18:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803e1f:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803e20:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803e27:	7f 00 00 
+  803e2a:	e9 81 00 00 00       	jmp    803eb0 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803e2f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803e36:	49 39 dd             	cmp    %rbx,%r13
+  803e39:	74 2b                	je     803e66 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803e3b:	48 89 d8             	mov    %rbx,%rax
+  803e3e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803e42:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803e46:	f6 c2 01             	test   $0x1,%dl
+  803e49:	74 e4                	je     803e2f <foreach_shared_region+0x42>
+  803e4b:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803e4f:	f6 c4 04             	test   $0x4,%ah
+  803e52:	74 db                	je     803e2f <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803e54:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803e5b:	4c 89 fa             	mov    %r15,%rdx
+  803e5e:	48 89 df             	mov    %rbx,%rdi
+  803e61:	41 ff d6             	call   *%r14
+  803e64:	eb c9                	jmp    803e2f <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803e66:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803e6d:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803e71:	74 22                	je     803e95 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803e73:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803e7a:	48 89 d8             	mov    %rbx,%rax
+  803e7d:	48 c1 e8 15          	shr    $0x15,%rax
+  803e81:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803e88:	7f 00 00 
+  803e8b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803e8f:	a8 01                	test   $0x1,%al
+  803e91:	74 d3                	je     803e66 <foreach_shared_region+0x79>
+  803e93:	eb a6                	jmp    803e3b <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803e95:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803e9c:	40 
+  803e9d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803ea1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ea8:	00 00 00 
+  803eab:	48 39 c1             	cmp    %rax,%rcx
+  803eae:	74 31                	je     803ee1 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803eb0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803eb4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803eb8:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803ebf:	7f 00 00 
+  803ec2:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803ec6:	a8 01                	test   $0x1,%al
+  803ec8:	74 cb                	je     803e95 <foreach_shared_region+0xa8>
+  803eca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ece:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803ed5:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803edb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803edf:	eb 92                	jmp    803e73 <foreach_shared_region+0x86>
+}
+  803ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee6:	48 83 c4 18          	add    $0x18,%rsp
+  803eea:	5b                   	pop    %rbx
+  803eeb:	41 5c                	pop    %r12
+  803eed:	41 5d                	pop    %r13
+  803eef:	41 5e                	pop    %r14
+  803ef1:	41 5f                	pop    %r15
+  803ef3:	5d                   	pop    %rbp
+  803ef4:	c3                   	ret
+
+0000000000803ef5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efa:	c3                   	ret
+
+0000000000803efb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803efb:	55                   	push   %rbp
+  803efc:	48 89 e5             	mov    %rsp,%rbp
+  803eff:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f02:	48 be 14 57 80 00 00 	movabs $0x805714,%rsi
+  803f09:	00 00 00 
+  803f0c:	48 b8 13 0c 80 00 00 	movabs $0x800c13,%rax
+  803f13:	00 00 00 
+  803f16:	ff d0                	call   *%rax
+    return 0;
+}
+  803f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f1d:	5d                   	pop    %rbp
+  803f1e:	c3                   	ret
+
+0000000000803f1f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f1f:	55                   	push   %rbp
+  803f20:	48 89 e5             	mov    %rsp,%rbp
+  803f23:	41 57                	push   %r15
+  803f25:	41 56                	push   %r14
+  803f27:	41 55                	push   %r13
+  803f29:	41 54                	push   %r12
+  803f2b:	53                   	push   %rbx
+  803f2c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803f33:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803f3a:	48 85 d2             	test   %rdx,%rdx
+  803f3d:	74 7a                	je     803fb9 <devcons_write+0x9a>
+  803f3f:	49 89 d6             	mov    %rdx,%r14
+  803f42:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f48:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803f4d:	49 bf a1 0f 80 00 00 	movabs $0x800fa1,%r15
+  803f54:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803f57:	4c 89 f3             	mov    %r14,%rbx
+  803f5a:	48 29 f3             	sub    %rsi,%rbx
+  803f5d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803f62:	48 39 c3             	cmp    %rax,%rbx
+  803f65:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803f69:	4c 63 eb             	movslq %ebx,%r13
+  803f6c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803f73:	48 01 c6             	add    %rax,%rsi
+  803f76:	4c 89 ea             	mov    %r13,%rdx
+  803f79:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803f80:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803f83:	4c 89 ee             	mov    %r13,%rsi
+  803f86:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803f8d:	48 b8 ea 11 80 00 00 	movabs $0x8011ea,%rax
+  803f94:	00 00 00 
+  803f97:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803f99:	41 01 dc             	add    %ebx,%r12d
+  803f9c:	49 63 f4             	movslq %r12d,%rsi
+  803f9f:	4c 39 f6             	cmp    %r14,%rsi
+  803fa2:	72 b3                	jb     803f57 <devcons_write+0x38>
+    return res;
+  803fa4:	49 63 c4             	movslq %r12d,%rax
+}
+  803fa7:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803fae:	5b                   	pop    %rbx
+  803faf:	41 5c                	pop    %r12
+  803fb1:	41 5d                	pop    %r13
+  803fb3:	41 5e                	pop    %r14
+  803fb5:	41 5f                	pop    %r15
+  803fb7:	5d                   	pop    %rbp
+  803fb8:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803fb9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803fbf:	eb e3                	jmp    803fa4 <devcons_write+0x85>
+
+0000000000803fc1 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803fc1:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803fc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fc9:	48 85 c0             	test   %rax,%rax
+  803fcc:	74 55                	je     804023 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803fce:	55                   	push   %rbp
+  803fcf:	48 89 e5             	mov    %rsp,%rbp
+  803fd2:	41 55                	push   %r13
+  803fd4:	41 54                	push   %r12
+  803fd6:	53                   	push   %rbx
+  803fd7:	48 83 ec 08          	sub    $0x8,%rsp
+  803fdb:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803fde:	48 bb 17 12 80 00 00 	movabs $0x801217,%rbx
+  803fe5:	00 00 00 
+  803fe8:	49 bc e4 12 80 00 00 	movabs $0x8012e4,%r12
+  803fef:	00 00 00 
+  803ff2:	eb 03                	jmp    803ff7 <devcons_read+0x36>
+  803ff4:	41 ff d4             	call   *%r12
+  803ff7:	ff d3                	call   *%rbx
+  803ff9:	85 c0                	test   %eax,%eax
+  803ffb:	74 f7                	je     803ff4 <devcons_read+0x33>
+    if (c < 0) return c;
+  803ffd:	48 63 d0             	movslq %eax,%rdx
+  804000:	78 13                	js     804015 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804002:	ba 00 00 00 00       	mov    $0x0,%edx
+  804007:	83 f8 04             	cmp    $0x4,%eax
+  80400a:	74 09                	je     804015 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80400c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804010:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804015:	48 89 d0             	mov    %rdx,%rax
+  804018:	48 83 c4 08          	add    $0x8,%rsp
+  80401c:	5b                   	pop    %rbx
+  80401d:	41 5c                	pop    %r12
+  80401f:	41 5d                	pop    %r13
+  804021:	5d                   	pop    %rbp
+  804022:	c3                   	ret
+  804023:	48 89 d0             	mov    %rdx,%rax
+  804026:	c3                   	ret
+
+0000000000804027 <cputchar>:
+cputchar(int ch) {
+  804027:	55                   	push   %rbp
+  804028:	48 89 e5             	mov    %rsp,%rbp
+  80402b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80402f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804033:	be 01 00 00 00       	mov    $0x1,%esi
+  804038:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80403c:	48 b8 ea 11 80 00 00 	movabs $0x8011ea,%rax
+  804043:	00 00 00 
+  804046:	ff d0                	call   *%rax
+}
+  804048:	c9                   	leave
+  804049:	c3                   	ret
+
+000000000080404a <getchar>:
+getchar(void) {
+  80404a:	55                   	push   %rbp
+  80404b:	48 89 e5             	mov    %rsp,%rbp
+  80404e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804052:	ba 01 00 00 00       	mov    $0x1,%edx
+  804057:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80405b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804060:	48 b8 08 22 80 00 00 	movabs $0x802208,%rax
+  804067:	00 00 00 
+  80406a:	ff d0                	call   *%rax
+  80406c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80406e:	85 c0                	test   %eax,%eax
+  804070:	78 06                	js     804078 <getchar+0x2e>
+  804072:	74 08                	je     80407c <getchar+0x32>
+  804074:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804078:	89 d0                	mov    %edx,%eax
+  80407a:	c9                   	leave
+  80407b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80407c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804081:	eb f5                	jmp    804078 <getchar+0x2e>
+
+0000000000804083 <iscons>:
+iscons(int fdnum) {
+  804083:	55                   	push   %rbp
+  804084:	48 89 e5             	mov    %rsp,%rbp
+  804087:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80408b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80408f:	48 b8 25 1f 80 00 00 	movabs $0x801f25,%rax
+  804096:	00 00 00 
+  804099:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80409b:	85 c0                	test   %eax,%eax
+  80409d:	78 18                	js     8040b7 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80409f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040a3:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8040aa:	00 00 00 
+  8040ad:	8b 00                	mov    (%rax),%eax
+  8040af:	39 02                	cmp    %eax,(%rdx)
+  8040b1:	0f 94 c0             	sete   %al
+  8040b4:	0f b6 c0             	movzbl %al,%eax
+}
+  8040b7:	c9                   	leave
+  8040b8:	c3                   	ret
+
+00000000008040b9 <opencons>:
+opencons(void) {
+  8040b9:	55                   	push   %rbp
+  8040ba:	48 89 e5             	mov    %rsp,%rbp
+  8040bd:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8040c1:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8040c5:	48 b8 c5 1e 80 00 00 	movabs $0x801ec5,%rax
+  8040cc:	00 00 00 
+  8040cf:	ff d0                	call   *%rax
+  8040d1:	85 c0                	test   %eax,%eax
+  8040d3:	78 49                	js     80411e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8040d5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040df:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8040e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040e8:	48 b8 73 13 80 00 00 	movabs $0x801373,%rax
+  8040ef:	00 00 00 
+  8040f2:	ff d0                	call   *%rax
+  8040f4:	85 c0                	test   %eax,%eax
+  8040f6:	78 26                	js     80411e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8040f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040fc:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804103:	00 00 
+  804105:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804107:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80410b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804112:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  804119:	00 00 00 
+  80411c:	ff d0                	call   *%rax
+}
+  80411e:	c9                   	leave
+  80411f:	c3                   	ret
+
+0000000000804120 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804120:	55                   	push   %rbp
+  804121:	48 89 e5             	mov    %rsp,%rbp
+  804124:	41 56                	push   %r14
+  804126:	41 55                	push   %r13
+  804128:	41 54                	push   %r12
+  80412a:	53                   	push   %rbx
+  80412b:	48 83 ec 50          	sub    $0x50,%rsp
+  80412f:	49 89 fc             	mov    %rdi,%r12
+  804132:	41 89 f5             	mov    %esi,%r13d
+  804135:	48 89 d3             	mov    %rdx,%rbx
+  804138:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80413c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  804140:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804144:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80414b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80414f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  804153:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804157:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80415b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804162:	00 00 00 
+  804165:	4c 8b 30             	mov    (%rax),%r14
+  804168:	48 b8 b3 12 80 00 00 	movabs $0x8012b3,%rax
+  80416f:	00 00 00 
+  804172:	ff d0                	call   *%rax
+  804174:	89 c6                	mov    %eax,%esi
+  804176:	45 89 e8             	mov    %r13d,%r8d
+  804179:	4c 89 e1             	mov    %r12,%rcx
+  80417c:	4c 89 f2             	mov    %r14,%rdx
+  80417f:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  804186:	00 00 00 
+  804189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80418e:	49 bc 9b 02 80 00 00 	movabs $0x80029b,%r12
+  804195:	00 00 00 
+  804198:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80419b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80419f:	48 89 df             	mov    %rbx,%rdi
+  8041a2:	48 b8 37 02 80 00 00 	movabs $0x800237,%rax
+  8041a9:	00 00 00 
+  8041ac:	ff d0                	call   *%rax
+    cprintf("\n");
+  8041ae:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  8041b5:	00 00 00 
+  8041b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041bd:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8041c0:	cc                   	int3
+  8041c1:	eb fd                	jmp    8041c0 <_panic+0xa0>
+
+00000000008041c3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8041c3:	55                   	push   %rbp
+  8041c4:	48 89 e5             	mov    %rsp,%rbp
+  8041c7:	41 55                	push   %r13
+  8041c9:	41 54                	push   %r12
+  8041cb:	53                   	push   %rbx
+  8041cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8041d0:	49 89 fc             	mov    %rdi,%r12
+  8041d3:	48 89 f7             	mov    %rsi,%rdi
+  8041d6:	48 89 d3             	mov    %rdx,%rbx
+  8041d9:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041dc:	48 85 f6             	test   %rsi,%rsi
+  8041df:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041e6:	00 00 00 
+  8041e9:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8041ed:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041f2:	48 85 d2             	test   %rdx,%rdx
+  8041f5:	74 03                	je     8041fa <ipc_recv+0x37>
+  8041f7:	48 8b 32             	mov    (%rdx),%rsi
+  8041fa:	48 b8 20 17 80 00 00 	movabs $0x801720,%rax
+  804201:	00 00 00 
+  804204:	ff d0                	call   *%rax
+    if (errno) {
+  804206:	85 c0                	test   %eax,%eax
+  804208:	74 1c                	je     804226 <ipc_recv+0x63>
+        if (from_env_store)
+  80420a:	4d 85 e4             	test   %r12,%r12
+  80420d:	74 08                	je     804217 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80420f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804216:	00 
+
+        if (perm_store)
+  804217:	4d 85 ed             	test   %r13,%r13
+  80421a:	74 74                	je     804290 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80421c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804223:	00 
+  804224:	eb 6a                	jmp    804290 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804226:	4d 85 e4             	test   %r12,%r12
+  804229:	74 14                	je     80423f <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80422b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804232:	00 00 00 
+  804235:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80423b:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80423f:	48 85 db             	test   %rbx,%rbx
+  804242:	74 23                	je     804267 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804244:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80424b:	00 00 00 
+  80424e:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804254:	ba 00 00 00 00       	mov    $0x0,%edx
+  804259:	85 c9                	test   %ecx,%ecx
+  80425b:	74 07                	je     804264 <ipc_recv+0xa1>
+  80425d:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804264:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804267:	4d 85 ed             	test   %r13,%r13
+  80426a:	74 14                	je     804280 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80426c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804273:	00 00 00 
+  804276:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80427c:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804280:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804287:	00 00 00 
+  80428a:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804290:	48 83 c4 08          	add    $0x8,%rsp
+  804294:	5b                   	pop    %rbx
+  804295:	41 5c                	pop    %r12
+  804297:	41 5d                	pop    %r13
+  804299:	5d                   	pop    %rbp
+  80429a:	c3                   	ret
+
+000000000080429b <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80429b:	55                   	push   %rbp
+  80429c:	48 89 e5             	mov    %rsp,%rbp
+  80429f:	41 55                	push   %r13
+  8042a1:	41 54                	push   %r12
+  8042a3:	53                   	push   %rbx
+  8042a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8042a8:	49 89 fc             	mov    %rdi,%r12
+  8042ab:	48 89 f7             	mov    %rsi,%rdi
+  8042ae:	48 89 d3             	mov    %rdx,%rbx
+  8042b1:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8042b4:	48 85 f6             	test   %rsi,%rsi
+  8042b7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8042be:	00 00 00 
+  8042c1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8042c5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042ca:	48 85 d2             	test   %rdx,%rdx
+  8042cd:	74 03                	je     8042d2 <ipc_try_recv+0x37>
+  8042cf:	48 8b 32             	mov    (%rdx),%rsi
+  8042d2:	48 b8 89 17 80 00 00 	movabs $0x801789,%rax
+  8042d9:	00 00 00 
+  8042dc:	ff d0                	call   *%rax
+    if (errno) {
+  8042de:	85 c0                	test   %eax,%eax
+  8042e0:	75 75                	jne    804357 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8042e2:	4d 85 e4             	test   %r12,%r12
+  8042e5:	74 14                	je     8042fb <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8042e7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8042ee:	00 00 00 
+  8042f1:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8042f7:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8042fb:	48 85 db             	test   %rbx,%rbx
+  8042fe:	74 23                	je     804323 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804300:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804307:	00 00 00 
+  80430a:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804310:	ba 00 00 00 00       	mov    $0x0,%edx
+  804315:	85 c9                	test   %ecx,%ecx
+  804317:	74 07                	je     804320 <ipc_try_recv+0x85>
+  804319:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804320:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804323:	4d 85 ed             	test   %r13,%r13
+  804326:	74 14                	je     80433c <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804328:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80432f:	00 00 00 
+  804332:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804338:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80433c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804343:	00 00 00 
+  804346:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80434c:	48 83 c4 08          	add    $0x8,%rsp
+  804350:	5b                   	pop    %rbx
+  804351:	41 5c                	pop    %r12
+  804353:	41 5d                	pop    %r13
+  804355:	5d                   	pop    %rbp
+  804356:	c3                   	ret
+        if (from_env_store)
+  804357:	4d 85 e4             	test   %r12,%r12
+  80435a:	74 08                	je     804364 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80435c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804363:	00 
+        if (perm_store)
+  804364:	4d 85 ed             	test   %r13,%r13
+  804367:	74 e3                	je     80434c <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804369:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804370:	00 
+  804371:	eb d9                	jmp    80434c <ipc_try_recv+0xb1>
+
+0000000000804373 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804373:	55                   	push   %rbp
+  804374:	48 89 e5             	mov    %rsp,%rbp
+  804377:	41 57                	push   %r15
+  804379:	41 56                	push   %r14
+  80437b:	41 55                	push   %r13
+  80437d:	41 54                	push   %r12
+  80437f:	53                   	push   %rbx
+  804380:	48 83 ec 18          	sub    $0x18,%rsp
+  804384:	41 89 fd             	mov    %edi,%r13d
+  804387:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80438a:	48 89 d3             	mov    %rdx,%rbx
+  80438d:	49 89 cc             	mov    %rcx,%r12
+  804390:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804394:	48 85 d2             	test   %rdx,%rdx
+  804397:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80439e:	00 00 00 
+  8043a1:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8043a5:	49 be f4 16 80 00 00 	movabs $0x8016f4,%r14
+  8043ac:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8043af:	49 bf e4 12 80 00 00 	movabs $0x8012e4,%r15
+  8043b6:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8043b9:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8043bc:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8043c0:	4c 89 e1             	mov    %r12,%rcx
+  8043c3:	48 89 da             	mov    %rbx,%rdx
+  8043c6:	44 89 ef             	mov    %r13d,%edi
+  8043c9:	41 ff d6             	call   *%r14
+  8043cc:	85 c0                	test   %eax,%eax
+  8043ce:	74 37                	je     804407 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8043d0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8043d3:	75 05                	jne    8043da <ipc_send+0x67>
+        sys_yield();
+  8043d5:	41 ff d7             	call   *%r15
+  8043d8:	eb df                	jmp    8043b9 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8043da:	89 c1                	mov    %eax,%ecx
+  8043dc:	48 ba 43 57 80 00 00 	movabs $0x805743,%rdx
+  8043e3:	00 00 00 
+  8043e6:	be 65 00 00 00       	mov    $0x65,%esi
+  8043eb:	48 bf 5e 57 80 00 00 	movabs $0x80575e,%rdi
+  8043f2:	00 00 00 
+  8043f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043fa:	49 b8 20 41 80 00 00 	movabs $0x804120,%r8
+  804401:	00 00 00 
+  804404:	41 ff d0             	call   *%r8
+    }
+}
+  804407:	48 83 c4 18          	add    $0x18,%rsp
+  80440b:	5b                   	pop    %rbx
+  80440c:	41 5c                	pop    %r12
+  80440e:	41 5d                	pop    %r13
+  804410:	41 5e                	pop    %r14
+  804412:	41 5f                	pop    %r15
+  804414:	5d                   	pop    %rbp
+  804415:	c3                   	ret
+
+0000000000804416 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804416:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80441b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804422:	00 00 00 
+  804425:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80442c:	48 01 ca             	add    %rcx,%rdx
+  80442f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804435:	39 fa                	cmp    %edi,%edx
+  804437:	74 12                	je     80444b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804439:	48 83 c0 01          	add    $0x1,%rax
+  80443d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804443:	75 e0                	jne    804425 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804445:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80444a:	c3                   	ret
+            return envs[i].env_id;
+  80444b:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804452:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804459:	00 00 00 
+  80445c:	48 01 d0             	add    %rdx,%rax
+  80445f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804465:	c3                   	ret
+
+0000000000804466 <__text_end>:
+  804466:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446d:	00 00 00 
+  804470:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804477:	00 00 00 
+  80447a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804481:	00 00 00 
+  804484:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448b:	00 00 00 
+  80448e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804495:	00 00 00 
+  804498:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449f:	00 00 00 
+  8044a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a9:	00 00 00 
+  8044ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b3:	00 00 00 
+  8044b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bd:	00 00 00 
+  8044c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c7:	00 00 00 
+  8044ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d1:	00 00 00 
+  8044d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044db:	00 00 00 
+  8044de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e5:	00 00 00 
+  8044e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ef:	00 00 00 
+  8044f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f9:	00 00 00 
+  8044fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804503:	00 00 00 
+  804506:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450d:	00 00 00 
+  804510:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804517:	00 00 00 
+  80451a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804521:	00 00 00 
+  804524:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452b:	00 00 00 
+  80452e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804535:	00 00 00 
+  804538:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453f:	00 00 00 
+  804542:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804549:	00 00 00 
+  80454c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804553:	00 00 00 
+  804556:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455d:	00 00 00 
+  804560:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804567:	00 00 00 
+  80456a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804571:	00 00 00 
+  804574:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457b:	00 00 00 
+  80457e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804585:	00 00 00 
+  804588:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458f:	00 00 00 
+  804592:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804599:	00 00 00 
+  80459c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a3:	00 00 00 
+  8045a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ad:	00 00 00 
+  8045b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b7:	00 00 00 
+  8045ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c1:	00 00 00 
+  8045c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cb:	00 00 00 
+  8045ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d5:	00 00 00 
+  8045d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045df:	00 00 00 
+  8045e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e9:	00 00 00 
+  8045ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f3:	00 00 00 
+  8045f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fd:	00 00 00 
+  804600:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804607:	00 00 00 
+  80460a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804611:	00 00 00 
+  804614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461b:	00 00 00 
+  80461e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804625:	00 00 00 
+  804628:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462f:	00 00 00 
+  804632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804639:	00 00 00 
+  80463c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804643:	00 00 00 
+  804646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464d:	00 00 00 
+  804650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804657:	00 00 00 
+  80465a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804661:	00 00 00 
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467f:	00 00 00 
+  804682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804689:	00 00 00 
+  80468c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804693:	00 00 00 
+  804696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469d:	00 00 00 
+  8046a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a7:	00 00 00 
+  8046aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b1:	00 00 00 
+  8046b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bb:	00 00 00 
+  8046be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c5:	00 00 00 
+  8046c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cf:	00 00 00 
+  8046d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d9:	00 00 00 
+  8046dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e3:	00 00 00 
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
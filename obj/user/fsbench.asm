@@ -0,0 +1,9554 @@
+
+obj/user/fsbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 86 0e 00 00       	call   800ea9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <sample>:
+    return cycles * 1000000 / cpufreq;
+}
+
+static void
+sample(uint64_t cycles) {
+    if (nsamples < MAXSAMPLES) samples[nsamples++] = cycles;
+  800025:	48 b8 28 80 84 00 00 	movabs $0x848028,%rax
+  80002c:	00 00 00 
+  80002f:	48 8b 10             	mov    (%rax),%rdx
+  800032:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+  800039:	77 1c                	ja     800057 <sample+0x32>
+  80003b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80003f:	48 a3 28 80 84 00 00 	movabs %rax,0x848028
+  800046:	00 00 00 
+  800049:	48 b8 40 80 84 00 00 	movabs $0x848040,%rax
+  800050:	00 00 00 
+  800053:	48 89 3c d0          	mov    %rdi,(%rax,%rdx,8)
+}
+  800057:	c3                   	ret
+
+0000000000800058 <percentile>:
+    }
+}
+
+static uint64_t
+percentile(unsigned pct) {
+    return nsamples ? cycles_to_us(samples[(nsamples - 1) * pct / 100]) : 0;
+  800058:	48 a1 28 80 84 00 00 	movabs 0x848028,%rax
+  80005f:	00 00 00 
+  800062:	48 85 c0             	test   %rax,%rax
+  800065:	74 46                	je     8000ad <percentile+0x55>
+  800067:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80006b:	89 ff                	mov    %edi,%edi
+  80006d:	48 0f af d7          	imul   %rdi,%rdx
+  800071:	48 c1 ea 02          	shr    $0x2,%rdx
+  800075:	48 b9 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rcx
+  80007c:	c2 f5 28 
+  80007f:	48 89 d0             	mov    %rdx,%rax
+  800082:	48 f7 e1             	mul    %rcx
+  800085:	48 c1 ea 02          	shr    $0x2,%rdx
+    return cycles * 1000000 / cpufreq;
+  800089:	48 b8 40 80 84 00 00 	movabs $0x848040,%rax
+  800090:	00 00 00 
+  800093:	48 69 04 d0 40 42 0f 	imul   $0xf4240,(%rax,%rdx,8),%rax
+  80009a:	00 
+  80009b:	48 be 20 80 84 00 00 	movabs $0x848020,%rsi
+  8000a2:	00 00 00 
+  8000a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000aa:	48 f7 36             	divq   (%rsi)
+}
+  8000ad:	c3                   	ret
+
+00000000008000ae <do_remove>:
+    int res = stat(path, &st);
+    if (res < 0) panic("stat %s: %i", path, res);
+}
+
+static void
+do_remove(const char *path) {
+  8000ae:	55                   	push   %rbp
+  8000af:	48 89 e5             	mov    %rsp,%rbp
+  8000b2:	53                   	push   %rbx
+  8000b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8000b7:	48 89 fb             	mov    %rdi,%rbx
+    int res = remove(path);
+  8000ba:	48 b8 c1 44 80 00 00 	movabs $0x8044c1,%rax
+  8000c1:	00 00 00 
+  8000c4:	ff d0                	call   *%rax
+    if (res < 0) panic("remove %s: %i", path, res);
+  8000c6:	85 c0                	test   %eax,%eax
+  8000c8:	78 06                	js     8000d0 <do_remove+0x22>
+}
+  8000ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000ce:	c9                   	leave
+  8000cf:	c3                   	ret
+    if (res < 0) panic("remove %s: %i", path, res);
+  8000d0:	41 89 c0             	mov    %eax,%r8d
+  8000d3:	48 89 d9             	mov    %rbx,%rcx
+  8000d6:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000dd:	00 00 00 
+  8000e0:	be cd 00 00 00       	mov    $0xcd,%esi
+  8000e5:	48 bf 0e 60 80 00 00 	movabs $0x80600e,%rdi
+  8000ec:	00 00 00 
+  8000ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f4:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  8000fb:	00 00 00 
+  8000fe:	41 ff d1             	call   *%r9
+
+0000000000800101 <do_stat>:
+do_stat(const char *path) {
+  800101:	55                   	push   %rbp
+  800102:	48 89 e5             	mov    %rsp,%rbp
+  800105:	53                   	push   %rbx
+  800106:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80010d:	48 89 fb             	mov    %rdi,%rbx
+    int res = stat(path, &st);
+  800110:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  800117:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  80011e:	00 00 00 
+  800121:	ff d0                	call   *%rax
+    if (res < 0) panic("stat %s: %i", path, res);
+  800123:	85 c0                	test   %eax,%eax
+  800125:	78 06                	js     80012d <do_stat+0x2c>
+}
+  800127:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80012b:	c9                   	leave
+  80012c:	c3                   	ret
+    if (res < 0) panic("stat %s: %i", path, res);
+  80012d:	41 89 c0             	mov    %eax,%r8d
+  800130:	48 89 d9             	mov    %rbx,%rcx
+  800133:	48 ba 1d 60 80 00 00 	movabs $0x80601d,%rdx
+  80013a:	00 00 00 
+  80013d:	be c7 00 00 00       	mov    $0xc7,%esi
+  800142:	48 bf 0e 60 80 00 00 	movabs $0x80600e,%rdi
+  800149:	00 00 00 
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800151:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  800158:	00 00 00 
+  80015b:	41 ff d1             	call   *%r9
+
+000000000080015e <xopen>:
+xopen(const char *path, int mode) {
+  80015e:	55                   	push   %rbp
+  80015f:	48 89 e5             	mov    %rsp,%rbp
+  800162:	53                   	push   %rbx
+  800163:	48 83 ec 08          	sub    $0x8,%rsp
+  800167:	48 89 fb             	mov    %rdi,%rbx
+    int fd = open(path, mode);
+  80016a:	48 b8 a7 40 80 00 00 	movabs $0x8040a7,%rax
+  800171:	00 00 00 
+  800174:	ff d0                	call   *%rax
+    if (fd < 0) panic("open %s: %i", path, fd);
+  800176:	85 c0                	test   %eax,%eax
+  800178:	78 06                	js     800180 <xopen+0x22>
+}
+  80017a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80017e:	c9                   	leave
+  80017f:	c3                   	ret
+    if (fd < 0) panic("open %s: %i", path, fd);
+  800180:	41 89 c0             	mov    %eax,%r8d
+  800183:	48 89 d9             	mov    %rbx,%rcx
+  800186:	48 ba 29 60 80 00 00 	movabs $0x806029,%rdx
+  80018d:	00 00 00 
+  800190:	be 5f 00 00 00       	mov    $0x5f,%esi
+  800195:	48 bf 0e 60 80 00 00 	movabs $0x80600e,%rdi
+  80019c:	00 00 00 
+  80019f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a4:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  8001ab:	00 00 00 
+  8001ae:	41 ff d1             	call   *%r9
+
+00000000008001b1 <do_open>:
+do_open(const char *path) {
+  8001b1:	55                   	push   %rbp
+  8001b2:	48 89 e5             	mov    %rsp,%rbp
+    close(xopen(path, O_RDONLY));
+  8001b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ba:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  8001c1:	00 00 00 
+  8001c4:	ff d0                	call   *%rax
+  8001c6:	89 c7                	mov    %eax,%edi
+  8001c8:	48 b8 20 2f 80 00 00 	movabs $0x802f20,%rax
+  8001cf:	00 00 00 
+  8001d2:	ff d0                	call   *%rax
+}
+  8001d4:	5d                   	pop    %rbp
+  8001d5:	c3                   	ret
+
+00000000008001d6 <do_create>:
+do_create(const char *path) {
+  8001d6:	55                   	push   %rbp
+  8001d7:	48 89 e5             	mov    %rsp,%rbp
+    close(xopen(path, O_WRONLY | O_CREAT | O_TRUNC));
+  8001da:	be 01 03 00 00       	mov    $0x301,%esi
+  8001df:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  8001e6:	00 00 00 
+  8001e9:	ff d0                	call   *%rax
+  8001eb:	89 c7                	mov    %eax,%edi
+  8001ed:	48 b8 20 2f 80 00 00 	movabs $0x802f20,%rax
+  8001f4:	00 00 00 
+  8001f7:	ff d0                	call   *%rax
+}
+  8001f9:	5d                   	pop    %rbp
+  8001fa:	c3                   	ret
+
+00000000008001fb <enabled>:
+    return !only || !strcmp(only, test);
+  8001fb:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800202:	00 00 00 
+  800205:	ba 01 00 00 00       	mov    $0x1,%edx
+  80020a:	48 85 c0             	test   %rax,%rax
+  80020d:	74 25                	je     800234 <enabled+0x39>
+enabled(const char *test) {
+  80020f:	55                   	push   %rbp
+  800210:	48 89 e5             	mov    %rsp,%rbp
+    return !only || !strcmp(only, test);
+  800213:	48 89 fe             	mov    %rdi,%rsi
+  800216:	48 89 c7             	mov    %rax,%rdi
+  800219:	48 b8 e1 1a 80 00 00 	movabs $0x801ae1,%rax
+  800220:	00 00 00 
+  800223:	ff d0                	call   *%rax
+  800225:	85 c0                	test   %eax,%eax
+  800227:	0f 94 c2             	sete   %dl
+  80022a:	0f b6 d2             	movzbl %dl,%edx
+  80022d:	89 d0                	mov    %edx,%eax
+  80022f:	83 e0 01             	and    $0x1,%eax
+}
+  800232:	5d                   	pop    %rbp
+  800233:	c3                   	ret
+    return !only || !strcmp(only, test);
+  800234:	89 d0                	mov    %edx,%eax
+  800236:	83 e0 01             	and    $0x1,%eax
+}
+  800239:	c3                   	ret
+
+000000000080023a <report>:
+report(const char *test, size_t bs, size_t ops, uint64_t total) {
+  80023a:	55                   	push   %rbp
+  80023b:	48 89 e5             	mov    %rsp,%rbp
+  80023e:	41 57                	push   %r15
+  800240:	41 56                	push   %r14
+  800242:	41 55                	push   %r13
+  800244:	41 54                	push   %r12
+  800246:	53                   	push   %rbx
+  800247:	48 83 ec 28          	sub    $0x28,%rsp
+  80024b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80024f:	49 89 f6             	mov    %rsi,%r14
+  800252:	49 89 d5             	mov    %rdx,%r13
+    for (size_t gap = nsamples / 2; gap; gap /= 2) {
+  800255:	48 a1 28 80 84 00 00 	movabs 0x848028,%rax
+  80025c:	00 00 00 
+  80025f:	49 89 c0             	mov    %rax,%r8
+  800262:	49 d1 e8             	shr    %r8
+  800265:	48 83 f8 01          	cmp    $0x1,%rax
+  800269:	76 7d                	jbe    8002e8 <report+0xae>
+  80026b:	49 bc 40 80 84 00 00 	movabs $0x848040,%r12
+  800272:	00 00 00 
+  800275:	49 89 c9             	mov    %rcx,%r9
+  800278:	48 89 c1             	mov    %rax,%rcx
+  80027b:	eb 50                	jmp    8002cd <report+0x93>
+            for (; j >= gap && samples[j - gap] > v; j -= gap)
+  80027d:	4c 89 ff             	mov    %r15,%rdi
+            samples[j] = v;
+  800280:	4d 89 1c fc          	mov    %r11,(%r12,%rdi,8)
+        for (size_t i = gap; i < nsamples; i++) {
+  800284:	48 83 c2 01          	add    $0x1,%rdx
+  800288:	48 83 c6 08          	add    $0x8,%rsi
+  80028c:	48 39 d1             	cmp    %rdx,%rcx
+  80028f:	74 2d                	je     8002be <report+0x84>
+            uint64_t v = samples[i];
+  800291:	4c 8b 1e             	mov    (%rsi),%r11
+            for (; j >= gap && samples[j - gap] > v; j -= gap)
+  800294:	49 89 f2             	mov    %rsi,%r10
+  800297:	48 89 d7             	mov    %rdx,%rdi
+  80029a:	4c 39 c2             	cmp    %r8,%rdx
+  80029d:	72 e1                	jb     800280 <report+0x46>
+  80029f:	49 89 ff             	mov    %rdi,%r15
+  8002a2:	4d 29 c7             	sub    %r8,%r15
+  8002a5:	49 8b 1c 02          	mov    (%r10,%rax,1),%rbx
+  8002a9:	49 39 db             	cmp    %rbx,%r11
+  8002ac:	73 d2                	jae    800280 <report+0x46>
+                samples[j] = samples[j - gap];
+  8002ae:	49 89 1a             	mov    %rbx,(%r10)
+            for (; j >= gap && samples[j - gap] > v; j -= gap)
+  8002b1:	49 01 c2             	add    %rax,%r10
+  8002b4:	4d 39 c7             	cmp    %r8,%r15
+  8002b7:	72 c4                	jb     80027d <report+0x43>
+  8002b9:	4c 89 ff             	mov    %r15,%rdi
+  8002bc:	eb e1                	jmp    80029f <report+0x65>
+    for (size_t gap = nsamples / 2; gap; gap /= 2) {
+  8002be:	4c 89 c0             	mov    %r8,%rax
+  8002c1:	48 d1 e8             	shr    %rax
+  8002c4:	49 83 f8 01          	cmp    $0x1,%r8
+  8002c8:	76 1b                	jbe    8002e5 <report+0xab>
+  8002ca:	49 89 c0             	mov    %rax,%r8
+        for (size_t i = gap; i < nsamples; i++) {
+  8002cd:	49 39 c8             	cmp    %rcx,%r8
+  8002d0:	73 ec                	jae    8002be <report+0x84>
+  8002d2:	4b 8d 34 c4          	lea    (%r12,%r8,8),%rsi
+  8002d6:	4c 89 c0             	mov    %r8,%rax
+  8002d9:	48 f7 d8             	neg    %rax
+  8002dc:	48 c1 e0 03          	shl    $0x3,%rax
+  8002e0:	4c 89 c2             	mov    %r8,%rdx
+  8002e3:	eb ac                	jmp    800291 <report+0x57>
+  8002e5:	4c 89 c9             	mov    %r9,%rcx
+    return cycles * 1000000 / cpufreq;
+  8002e8:	48 69 c1 40 42 0f 00 	imul   $0xf4240,%rcx,%rax
+  8002ef:	48 bb 20 80 84 00 00 	movabs $0x848020,%rbx
+  8002f6:	00 00 00 
+  8002f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002fe:	48 f7 33             	divq   (%rbx)
+  800301:	48 85 c0             	test   %rax,%rax
+  800304:	ba 01 00 00 00       	mov    $0x1,%edx
+  800309:	48 89 d3             	mov    %rdx,%rbx
+  80030c:	48 0f 45 d8          	cmovne %rax,%rbx
+            (unsigned long)percentile(99), (unsigned long)percentile(100));
+  800310:	bf 64 00 00 00       	mov    $0x64,%edi
+  800315:	49 bc 58 00 80 00 00 	movabs $0x800058,%r12
+  80031c:	00 00 00 
+  80031f:	41 ff d4             	call   *%r12
+  800322:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800326:	bf 63 00 00 00       	mov    $0x63,%edi
+  80032b:	41 ff d4             	call   *%r12
+  80032e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            (unsigned long)percentile(50), (unsigned long)percentile(90),
+  800332:	bf 5a 00 00 00       	mov    $0x5a,%edi
+  800337:	41 ff d4             	call   *%r12
+  80033a:	49 89 c7             	mov    %rax,%r15
+  80033d:	bf 32 00 00 00       	mov    $0x32,%edi
+  800342:	41 ff d4             	call   *%r12
+  800345:	48 89 c1             	mov    %rax,%rcx
+            (unsigned long)((uint64_t)ops * 1000000 / us),
+  800348:	49 69 c5 40 42 0f 00 	imul   $0xf4240,%r13,%rax
+    cprintf("fsbench test=%s bs=%zu ops=%zu kbps=%lu opsps=%lu p50=%lu p90=%lu p99=%lu max=%lu\n",
+  80034f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800354:	48 f7 f3             	div    %rbx
+  800357:	49 89 c1             	mov    %rax,%r9
+            (unsigned long)((uint64_t)bs * ops * 1000000 / KB / us),
+  80035a:	4c 89 ef             	mov    %r13,%rdi
+  80035d:	49 0f af fe          	imul   %r14,%rdi
+  800361:	48 69 c7 40 42 0f 00 	imul   $0xf4240,%rdi,%rax
+  800368:	48 c1 e8 0a          	shr    $0xa,%rax
+    cprintf("fsbench test=%s bs=%zu ops=%zu kbps=%lu opsps=%lu p50=%lu p90=%lu p99=%lu max=%lu\n",
+  80036c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800371:	48 f7 f3             	div    %rbx
+  800374:	ff 75 c8             	push   -0x38(%rbp)
+  800377:	ff 75 c0             	push   -0x40(%rbp)
+  80037a:	41 57                	push   %r15
+  80037c:	51                   	push   %rcx
+  80037d:	49 89 c0             	mov    %rax,%r8
+  800380:	4c 89 e9             	mov    %r13,%rcx
+  800383:	4c 89 f2             	mov    %r14,%rdx
+  800386:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80038a:	48 bf a8 60 80 00 00 	movabs $0x8060a8,%rdi
+  800391:	00 00 00 
+  800394:	b8 00 00 00 00       	mov    $0x0,%eax
+  800399:	49 ba c5 10 80 00 00 	movabs $0x8010c5,%r10
+  8003a0:	00 00 00 
+  8003a3:	41 ff d2             	call   *%r10
+    nsamples = 0;
+  8003a6:	48 b8 28 80 84 00 00 	movabs $0x848028,%rax
+  8003ad:	00 00 00 
+  8003b0:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+}
+  8003b7:	48 83 c4 20          	add    $0x20,%rsp
+  8003bb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003bf:	5b                   	pop    %rbx
+  8003c0:	41 5c                	pop    %r12
+  8003c2:	41 5d                	pop    %r13
+  8003c4:	41 5e                	pop    %r14
+  8003c6:	41 5f                	pop    %r15
+  8003c8:	5d                   	pop    %rbp
+  8003c9:	c3                   	ret
+
+00000000008003ca <file_storm>:
+file_storm(const char *test, void (*op)(const char *path)) {
+  8003ca:	55                   	push   %rbp
+  8003cb:	48 89 e5             	mov    %rsp,%rbp
+  8003ce:	41 57                	push   %r15
+  8003d0:	41 56                	push   %r14
+  8003d2:	41 55                	push   %r13
+  8003d4:	41 54                	push   %r12
+  8003d6:	53                   	push   %rbx
+  8003d7:	48 81 ec 28 04 00 00 	sub    $0x428,%rsp
+  8003de:	48 89 bd b8 fb ff ff 	mov    %rdi,-0x448(%rbp)
+  8003e5:	48 89 b5 c8 fb ff ff 	mov    %rsi,-0x438(%rbp)
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8003ec:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8003ee:	48 c1 e2 20          	shl    $0x20,%rdx
+  8003f2:	89 c0                	mov    %eax,%eax
+  8003f4:	48 09 c2             	or     %rax,%rdx
+  8003f7:	48 89 95 c0 fb ff ff 	mov    %rdx,-0x440(%rbp)
+    for (size_t i = 0; i < nops; i++) {
+  8003fe:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800405:	00 00 00 
+  800408:	48 8b 30             	mov    (%rax),%rsi
+  80040b:	48 85 f6             	test   %rsi,%rsi
+  80040e:	74 7d                	je     80048d <file_storm+0xc3>
+  800410:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        snprintf(path, sizeof(path), BENCH_PREFIX "%zu", i);
+  800416:	49 bf c2 19 80 00 00 	movabs $0x8019c2,%r15
+  80041d:	00 00 00 
+        sample(read_tsc() - t);
+  800420:	49 be 25 00 80 00 00 	movabs $0x800025,%r14
+  800427:	00 00 00 
+    for (size_t i = 0; i < nops; i++) {
+  80042a:	49 89 c5             	mov    %rax,%r13
+        snprintf(path, sizeof(path), BENCH_PREFIX "%zu", i);
+  80042d:	4c 89 e1             	mov    %r12,%rcx
+  800430:	48 ba 35 60 80 00 00 	movabs $0x806035,%rdx
+  800437:	00 00 00 
+  80043a:	be 00 04 00 00       	mov    $0x400,%esi
+  80043f:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  800446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044b:	41 ff d7             	call   *%r15
+    asm volatile("rdtsc"
+  80044e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800450:	48 c1 e2 20          	shl    $0x20,%rdx
+  800454:	89 c0                	mov    %eax,%eax
+  800456:	48 89 d3             	mov    %rdx,%rbx
+  800459:	48 09 c3             	or     %rax,%rbx
+        op(path);
+  80045c:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  800463:	48 8b 85 c8 fb ff ff 	mov    -0x438(%rbp),%rax
+  80046a:	ff d0                	call   *%rax
+    asm volatile("rdtsc"
+  80046c:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80046e:	48 c1 e2 20          	shl    $0x20,%rdx
+  800472:	89 c0                	mov    %eax,%eax
+  800474:	48 09 c2             	or     %rax,%rdx
+        sample(read_tsc() - t);
+  800477:	48 89 d7             	mov    %rdx,%rdi
+  80047a:	48 29 df             	sub    %rbx,%rdi
+  80047d:	41 ff d6             	call   *%r14
+    for (size_t i = 0; i < nops; i++) {
+  800480:	49 83 c4 01          	add    $0x1,%r12
+  800484:	49 8b 75 00          	mov    0x0(%r13),%rsi
+  800488:	49 39 f4             	cmp    %rsi,%r12
+  80048b:	72 a0                	jb     80042d <file_storm+0x63>
+    asm volatile("rdtsc"
+  80048d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80048f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800493:	89 c0                	mov    %eax,%eax
+  800495:	48 09 c2             	or     %rax,%rdx
+    uint64_t total = read_tsc() - start;
+  800498:	48 89 d1             	mov    %rdx,%rcx
+  80049b:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  8004a2:	48 29 c1             	sub    %rax,%rcx
+    report(test, 0, nops, total);
+  8004a5:	48 89 f2             	mov    %rsi,%rdx
+  8004a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ad:	48 8b bd b8 fb ff ff 	mov    -0x448(%rbp),%rdi
+  8004b4:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8004bb:	00 00 00 
+  8004be:	ff d0                	call   *%rax
+}
+  8004c0:	48 81 c4 28 04 00 00 	add    $0x428,%rsp
+  8004c7:	5b                   	pop    %rbx
+  8004c8:	41 5c                	pop    %r12
+  8004ca:	41 5d                	pop    %r13
+  8004cc:	41 5e                	pop    %r14
+  8004ce:	41 5f                	pop    %r15
+  8004d0:	5d                   	pop    %rbp
+  8004d1:	c3                   	ret
+
+00000000008004d2 <usage>:
+usage(void) {
+  8004d2:	55                   	push   %rbp
+  8004d3:	48 89 e5             	mov    %rsp,%rbp
+  8004d6:	53                   	push   %rbx
+  8004d7:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("usage: fsbench [-t test] [-s fileKB] [-n count]\n");
+  8004db:	48 bf 00 61 80 00 00 	movabs $0x806100,%rdi
+  8004e2:	00 00 00 
+  8004e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ea:	48 bb c5 10 80 00 00 	movabs $0x8010c5,%rbx
+  8004f1:	00 00 00 
+  8004f4:	ff d3                	call   *%rbx
+    cprintf("tests: seqwrite seqread randread create open stat remove sync\n");
+  8004f6:	48 bf 38 61 80 00 00 	movabs $0x806138,%rdi
+  8004fd:	00 00 00 
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	ff d3                	call   *%rbx
+    exit();
+  800507:	48 b8 52 0f 80 00 00 	movabs $0x800f52,%rax
+  80050e:	00 00 00 
+  800511:	ff d0                	call   *%rax
+}
+  800513:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800517:	c9                   	leave
+  800518:	c3                   	ret
+
+0000000000800519 <umain>:
+    close(fd);
+    report("sync", bs, rounds, total);
+}
+
+void
+umain(int argc, char **argv) {
+  800519:	55                   	push   %rbp
+  80051a:	48 89 e5             	mov    %rsp,%rbp
+  80051d:	41 57                	push   %r15
+  80051f:	41 56                	push   %r14
+  800521:	41 55                	push   %r13
+  800523:	41 54                	push   %r12
+  800525:	53                   	push   %rbx
+  800526:	48 83 ec 48          	sub    $0x48,%rsp
+  80052a:	89 7d ac             	mov    %edi,-0x54(%rbp)
+    static const size_t sizes[] = {4 * KB, 64 * KB, MAXBS};
+    int i;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80052d:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  800531:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  800535:	48 b8 b3 2b 80 00 00 	movabs $0x802bb3,%rax
+  80053c:	00 00 00 
+  80053f:	ff d0                	call   *%rax
+    while ((i = argnext(&args)) >= 0) {
+  800541:	48 bb e0 2b 80 00 00 	movabs $0x802be0,%rbx
+  800548:	00 00 00 
+        else if (i == 's' && argvalue(&args))
+            file_size = strtol(argvalue(&args), NULL, 0) * KB;
+        else if (i == 'n' && argvalue(&args))
+            nops = strtol(argvalue(&args), NULL, 0);
+        else
+            usage();
+  80054b:	49 bd d2 04 80 00 00 	movabs $0x8004d2,%r13
+  800552:	00 00 00 
+        else if (i == 'n' && argvalue(&args))
+  800555:	49 bc 11 2d 80 00 00 	movabs $0x802d11,%r12
+  80055c:	00 00 00 
+            nops = strtol(argvalue(&args), NULL, 0);
+  80055f:	49 be 42 1f 80 00 00 	movabs $0x801f42,%r14
+  800566:	00 00 00 
+    while ((i = argnext(&args)) >= 0) {
+  800569:	eb 70                	jmp    8005db <umain+0xc2>
+        if (i == 't' && argvalue(&args))
+  80056b:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  80056f:	41 ff d4             	call   *%r12
+  800572:	48 85 c0             	test   %rax,%rax
+  800575:	74 61                	je     8005d8 <umain+0xbf>
+            only = argvalue(&args);
+  800577:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  80057b:	48 b8 11 2d 80 00 00 	movabs $0x802d11,%rax
+  800582:	00 00 00 
+  800585:	ff d0                	call   *%rax
+  800587:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  80058e:	00 00 00 
+  800591:	eb 48                	jmp    8005db <umain+0xc2>
+        else if (i == 's' && argvalue(&args))
+  800593:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  800597:	41 ff d4             	call   *%r12
+  80059a:	48 85 c0             	test   %rax,%rax
+  80059d:	74 39                	je     8005d8 <umain+0xbf>
+            file_size = strtol(argvalue(&args), NULL, 0) * KB;
+  80059f:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8005a3:	48 b8 11 2d 80 00 00 	movabs $0x802d11,%rax
+  8005aa:	00 00 00 
+  8005ad:	ff d0                	call   *%rax
+  8005af:	48 89 c7             	mov    %rax,%rdi
+  8005b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8005bc:	48 b8 42 1f 80 00 00 	movabs $0x801f42,%rax
+  8005c3:	00 00 00 
+  8005c6:	ff d0                	call   *%rax
+  8005c8:	48 c1 e0 0a          	shl    $0xa,%rax
+  8005cc:	48 a3 10 70 80 00 00 	movabs %rax,0x807010
+  8005d3:	00 00 00 
+  8005d6:	eb 03                	jmp    8005db <umain+0xc2>
+            usage();
+  8005d8:	41 ff d5             	call   *%r13
+    while ((i = argnext(&args)) >= 0) {
+  8005db:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8005df:	ff d3                	call   *%rbx
+  8005e1:	85 c0                	test   %eax,%eax
+  8005e3:	78 3e                	js     800623 <umain+0x10a>
+        if (i == 't' && argvalue(&args))
+  8005e5:	83 f8 74             	cmp    $0x74,%eax
+  8005e8:	74 81                	je     80056b <umain+0x52>
+        else if (i == 's' && argvalue(&args))
+  8005ea:	83 f8 73             	cmp    $0x73,%eax
+  8005ed:	74 a4                	je     800593 <umain+0x7a>
+        else if (i == 'n' && argvalue(&args))
+  8005ef:	83 f8 6e             	cmp    $0x6e,%eax
+  8005f2:	75 e4                	jne    8005d8 <umain+0xbf>
+  8005f4:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8005f8:	41 ff d4             	call   *%r12
+  8005fb:	48 85 c0             	test   %rax,%rax
+  8005fe:	74 d8                	je     8005d8 <umain+0xbf>
+            nops = strtol(argvalue(&args), NULL, 0);
+  800600:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  800604:	41 ff d4             	call   *%r12
+  800607:	48 89 c7             	mov    %rax,%rdi
+  80060a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80060f:	be 00 00 00 00       	mov    $0x0,%esi
+  800614:	41 ff d6             	call   *%r14
+  800617:	48 a3 08 70 80 00 00 	movabs %rax,0x807008
+  80061e:	00 00 00 
+  800621:	eb b8                	jmp    8005db <umain+0xc2>
+    }
+    if (file_size < MAXBS || !nops) usage();
+  800623:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  80062a:	00 00 00 
+  80062d:	48 81 38 ff ff 03 00 	cmpq   $0x3ffff,(%rax)
+  800634:	76 10                	jbe    800646 <umain+0x12d>
+  800636:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80063d:	00 00 00 
+  800640:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800644:	75 0c                	jne    800652 <umain+0x139>
+  800646:	48 b8 d2 04 80 00 00 	movabs $0x8004d2,%rax
+  80064d:	00 00 00 
+  800650:	ff d0                	call   *%rax
+
+    cpufreq = get_cpufreq();
+  800652:	b8 00 00 00 00       	mov    $0x0,%eax
+  800657:	48 ba 4a 2a 80 00 00 	movabs $0x802a4a,%rdx
+  80065e:	00 00 00 
+  800661:	ff d2                	call   *%rdx
+  800663:	48 a3 20 80 84 00 00 	movabs %rax,0x848020
+  80066a:	00 00 00 
+
+    /* Read tests need the data file */
+    if (enabled("seqwrite") || enabled("seqread") || enabled("randread") || enabled("sync")) {
+  80066d:	48 bf 42 60 80 00 00 	movabs $0x806042,%rdi
+  800674:	00 00 00 
+  800677:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  80067e:	00 00 00 
+  800681:	ff d0                	call   *%rax
+  800683:	84 c0                	test   %al,%al
+  800685:	74 0d                	je     800694 <umain+0x17b>
+umain(int argc, char **argv) {
+  800687:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80068e:	00 
+  80068f:	e9 05 04 00 00       	jmp    800a99 <umain+0x580>
+    if (enabled("seqwrite") || enabled("seqread") || enabled("randread") || enabled("sync")) {
+  800694:	48 bf 4b 60 80 00 00 	movabs $0x80604b,%rdi
+  80069b:	00 00 00 
+  80069e:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  8006a5:	00 00 00 
+  8006a8:	ff d0                	call   *%rax
+  8006aa:	84 c0                	test   %al,%al
+  8006ac:	75 d9                	jne    800687 <umain+0x16e>
+  8006ae:	48 bf 53 60 80 00 00 	movabs $0x806053,%rdi
+  8006b5:	00 00 00 
+  8006b8:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  8006bf:	00 00 00 
+  8006c2:	ff d0                	call   *%rax
+  8006c4:	84 c0                	test   %al,%al
+  8006c6:	75 bf                	jne    800687 <umain+0x16e>
+  8006c8:	48 bf 74 60 80 00 00 	movabs $0x806074,%rdi
+  8006cf:	00 00 00 
+  8006d2:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  8006d9:	00 00 00 
+  8006dc:	ff d0                	call   *%rax
+  8006de:	84 c0                	test   %al,%al
+  8006e0:	75 a5                	jne    800687 <umain+0x16e>
+        for (size_t k = 0; k < sizeof(sizes) / sizeof(*sizes); k++) {
+            if (enabled("seqwrite") || k == 0) seq_write(sizes[k]);
+        }
+    }
+    if (enabled("seqread")) {
+  8006e2:	48 bf 4b 60 80 00 00 	movabs $0x80604b,%rdi
+  8006e9:	00 00 00 
+  8006ec:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  8006f3:	00 00 00 
+  8006f6:	ff d0                	call   *%rax
+  8006f8:	84 c0                	test   %al,%al
+  8006fa:	0f 84 20 01 00 00    	je     800820 <umain+0x307>
+  800700:	48 b8 80 61 80 00 00 	movabs $0x806180,%rax
+  800707:	00 00 00 
+  80070a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+        for (size_t k = 0; k < sizeof(sizes) / sizeof(*sizes); k++)
+            seq_read(sizes[k]);
+  80070e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800712:	4c 8b 28             	mov    (%rax),%r13
+    int fd = xopen(BENCH_FILE, O_RDONLY);
+  800715:	be 00 00 00 00       	mov    $0x0,%esi
+  80071a:	48 bf 5c 60 80 00 00 	movabs $0x80605c,%rdi
+  800721:	00 00 00 
+  800724:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  80072b:	00 00 00 
+  80072e:	ff d0                	call   *%rax
+  800730:	41 89 c6             	mov    %eax,%r14d
+    size_t ops = file_size / bs;
+  800733:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  80073a:	00 00 00 
+  80073d:	48 8b 08             	mov    (%rax),%rcx
+  800740:	48 89 c8             	mov    %rcx,%rax
+  800743:	ba 00 00 00 00       	mov    $0x0,%edx
+  800748:	49 f7 f5             	div    %r13
+  80074b:	49 89 c7             	mov    %rax,%r15
+    asm volatile("rdtsc"
+  80074e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800750:	48 c1 e2 20          	shl    $0x20,%rdx
+  800754:	89 c0                	mov    %eax,%eax
+  800756:	48 09 c2             	or     %rax,%rdx
+  800759:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+    for (size_t i = 0; i < ops; i++) {
+  80075d:	4c 39 e9             	cmp    %r13,%rcx
+  800760:	72 5f                	jb     8007c1 <umain+0x2a8>
+  800762:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    asm volatile("rdtsc"
+  800768:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80076a:	48 c1 e2 20          	shl    $0x20,%rdx
+  80076e:	89 c0                	mov    %eax,%eax
+  800770:	48 89 d3             	mov    %rdx,%rbx
+  800773:	48 09 c3             	or     %rax,%rbx
+        ssize_t res = readn(fd, buf, bs);
+  800776:	4c 89 ea             	mov    %r13,%rdx
+  800779:	48 be 20 80 80 00 00 	movabs $0x808020,%rsi
+  800780:	00 00 00 
+  800783:	44 89 f7             	mov    %r14d,%edi
+  800786:	48 b8 5c 31 80 00 00 	movabs $0x80315c,%rax
+  80078d:	00 00 00 
+  800790:	ff d0                	call   *%rax
+        if (res != (ssize_t)bs) panic("read: %i", (int)res);
+  800792:	4c 39 e8             	cmp    %r13,%rax
+  800795:	0f 85 7f 03 00 00    	jne    800b1a <umain+0x601>
+    asm volatile("rdtsc"
+  80079b:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80079d:	48 c1 e2 20          	shl    $0x20,%rdx
+  8007a1:	89 c0                	mov    %eax,%eax
+  8007a3:	48 09 c2             	or     %rax,%rdx
+        sample(read_tsc() - t);
+  8007a6:	48 89 d7             	mov    %rdx,%rdi
+  8007a9:	48 29 df             	sub    %rbx,%rdi
+  8007ac:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8007b3:	00 00 00 
+  8007b6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < ops; i++) {
+  8007b8:	49 83 c4 01          	add    $0x1,%r12
+  8007bc:	4d 39 fc             	cmp    %r15,%r12
+  8007bf:	72 a7                	jb     800768 <umain+0x24f>
+    asm volatile("rdtsc"
+  8007c1:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8007c3:	48 c1 e2 20          	shl    $0x20,%rdx
+  8007c7:	89 c0                	mov    %eax,%eax
+  8007c9:	48 09 c2             	or     %rax,%rdx
+    uint64_t total = read_tsc() - start;
+  8007cc:	48 89 d3             	mov    %rdx,%rbx
+  8007cf:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007d3:	48 29 c3             	sub    %rax,%rbx
+    close(fd);
+  8007d6:	44 89 f7             	mov    %r14d,%edi
+  8007d9:	48 b8 20 2f 80 00 00 	movabs $0x802f20,%rax
+  8007e0:	00 00 00 
+  8007e3:	ff d0                	call   *%rax
+    report("seqread", bs, ops, total);
+  8007e5:	48 89 d9             	mov    %rbx,%rcx
+  8007e8:	4c 89 fa             	mov    %r15,%rdx
+  8007eb:	4c 89 ee             	mov    %r13,%rsi
+  8007ee:	48 bf 4b 60 80 00 00 	movabs $0x80604b,%rdi
+  8007f5:	00 00 00 
+  8007f8:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8007ff:	00 00 00 
+  800802:	ff d0                	call   *%rax
+        for (size_t k = 0; k < sizeof(sizes) / sizeof(*sizes); k++)
+  800804:	48 83 45 a0 08       	addq   $0x8,-0x60(%rbp)
+  800809:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80080d:	48 b9 98 61 80 00 00 	movabs $0x806198,%rcx
+  800814:	00 00 00 
+  800817:	48 39 c8             	cmp    %rcx,%rax
+  80081a:	0f 85 ee fe ff ff    	jne    80070e <umain+0x1f5>
+    }
+    if (enabled("randread")) rand_read();
+  800820:	48 bf 53 60 80 00 00 	movabs $0x806053,%rdi
+  800827:	00 00 00 
+  80082a:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  800831:	00 00 00 
+  800834:	ff d0                	call   *%rax
+  800836:	84 c0                	test   %al,%al
+  800838:	0f 85 09 03 00 00    	jne    800b47 <umain+0x62e>
+    if (enabled("sync")) sync_cost();
+  80083e:	48 bf 74 60 80 00 00 	movabs $0x806074,%rdi
+  800845:	00 00 00 
+  800848:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  80084f:	00 00 00 
+  800852:	ff d0                	call   *%rax
+  800854:	84 c0                	test   %al,%al
+  800856:	0f 85 76 04 00 00    	jne    800cd2 <umain+0x7b9>
+
+    /* Metadata tests work on the files made by create */
+    if (enabled("create") || enabled("open") || enabled("stat") || enabled("remove")) {
+  80085c:	48 bf 82 60 80 00 00 	movabs $0x806082,%rdi
+  800863:	00 00 00 
+  800866:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  80086d:	00 00 00 
+  800870:	ff d0                	call   *%rax
+  800872:	84 c0                	test   %al,%al
+  800874:	75 1e                	jne    800894 <umain+0x37b>
+  800876:	48 bf 04 63 80 00 00 	movabs $0x806304,%rdi
+  80087d:	00 00 00 
+  800880:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  800887:	00 00 00 
+  80088a:	ff d0                	call   *%rax
+  80088c:	84 c0                	test   %al,%al
+  80088e:	0f 84 8a 05 00 00    	je     800e1e <umain+0x905>
+        file_storm("create", do_create);
+  800894:	48 be d6 01 80 00 00 	movabs $0x8001d6,%rsi
+  80089b:	00 00 00 
+  80089e:	48 bf 82 60 80 00 00 	movabs $0x806082,%rdi
+  8008a5:	00 00 00 
+  8008a8:	48 b8 ca 03 80 00 00 	movabs $0x8003ca,%rax
+  8008af:	00 00 00 
+  8008b2:	ff d0                	call   *%rax
+        if (enabled("open")) file_storm("open", do_open);
+  8008b4:	48 bf 04 63 80 00 00 	movabs $0x806304,%rdi
+  8008bb:	00 00 00 
+  8008be:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  8008c5:	00 00 00 
+  8008c8:	ff d0                	call   *%rax
+  8008ca:	84 c0                	test   %al,%al
+  8008cc:	0f 85 8d 05 00 00    	jne    800e5f <umain+0x946>
+        if (enabled("stat")) file_storm("stat", do_stat);
+  8008d2:	48 bf 89 60 80 00 00 	movabs $0x806089,%rdi
+  8008d9:	00 00 00 
+  8008dc:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  8008e3:	00 00 00 
+  8008e6:	ff d0                	call   *%rax
+  8008e8:	84 c0                	test   %al,%al
+  8008ea:	0f 85 94 05 00 00    	jne    800e84 <umain+0x96b>
+        file_storm("remove", do_remove);
+  8008f0:	48 be ae 00 80 00 00 	movabs $0x8000ae,%rsi
+  8008f7:	00 00 00 
+  8008fa:	48 bf 8e 60 80 00 00 	movabs $0x80608e,%rdi
+  800901:	00 00 00 
+  800904:	48 b8 ca 03 80 00 00 	movabs $0x8003ca,%rax
+  80090b:	00 00 00 
+  80090e:	ff d0                	call   *%rax
+    }
+
+    remove(BENCH_FILE);
+  800910:	48 bf 5c 60 80 00 00 	movabs $0x80605c,%rdi
+  800917:	00 00 00 
+  80091a:	48 b8 c1 44 80 00 00 	movabs $0x8044c1,%rax
+  800921:	00 00 00 
+  800924:	ff d0                	call   *%rax
+    cprintf("fsbench done\n");
+  800926:	48 bf 95 60 80 00 00 	movabs $0x806095,%rdi
+  80092d:	00 00 00 
+  800930:	b8 00 00 00 00       	mov    $0x0,%eax
+  800935:	48 ba c5 10 80 00 00 	movabs $0x8010c5,%rdx
+  80093c:	00 00 00 
+  80093f:	ff d2                	call   *%rdx
+}
+  800941:	48 83 c4 48          	add    $0x48,%rsp
+  800945:	5b                   	pop    %rbx
+  800946:	41 5c                	pop    %r12
+  800948:	41 5d                	pop    %r13
+  80094a:	41 5e                	pop    %r14
+  80094c:	41 5f                	pop    %r15
+  80094e:	5d                   	pop    %rbp
+  80094f:	c3                   	ret
+            if (enabled("seqwrite") || k == 0) seq_write(sizes[k]);
+  800950:	48 b8 80 61 80 00 00 	movabs $0x806180,%rax
+  800957:	00 00 00 
+  80095a:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80095e:	4c 8b 2c c8          	mov    (%rax,%rcx,8),%r13
+    int fd = xopen(BENCH_FILE, O_WRONLY | O_CREAT | O_TRUNC);
+  800962:	be 01 03 00 00       	mov    $0x301,%esi
+  800967:	48 bf 5c 60 80 00 00 	movabs $0x80605c,%rdi
+  80096e:	00 00 00 
+  800971:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  800978:	00 00 00 
+  80097b:	ff d0                	call   *%rax
+  80097d:	41 89 c6             	mov    %eax,%r14d
+    size_t ops = file_size / bs;
+  800980:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  800987:	00 00 00 
+  80098a:	48 8b 18             	mov    (%rax),%rbx
+  80098d:	48 89 d8             	mov    %rbx,%rax
+  800990:	ba 00 00 00 00       	mov    $0x0,%edx
+  800995:	49 f7 f5             	div    %r13
+  800998:	49 89 c7             	mov    %rax,%r15
+    memset(buf, 0xA5, bs);
+  80099b:	4c 89 ea             	mov    %r13,%rdx
+  80099e:	be a5 00 00 00       	mov    $0xa5,%esi
+  8009a3:	48 bf 20 80 80 00 00 	movabs $0x808020,%rdi
+  8009aa:	00 00 00 
+  8009ad:	48 b8 1d 1d 80 00 00 	movabs $0x801d1d,%rax
+  8009b4:	00 00 00 
+  8009b7:	ff d0                	call   *%rax
+    asm volatile("rdtsc"
+  8009b9:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8009bb:	48 c1 e2 20          	shl    $0x20,%rdx
+  8009bf:	89 c0                	mov    %eax,%eax
+  8009c1:	48 09 c2             	or     %rax,%rdx
+  8009c4:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+    for (size_t i = 0; i < ops; i++) {
+  8009c8:	4c 39 eb             	cmp    %r13,%rbx
+  8009cb:	72 5f                	jb     800a2c <umain+0x513>
+  8009cd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    asm volatile("rdtsc"
+  8009d3:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8009d5:	48 c1 e2 20          	shl    $0x20,%rdx
+  8009d9:	89 c0                	mov    %eax,%eax
+  8009db:	48 89 d3             	mov    %rdx,%rbx
+  8009de:	48 09 c3             	or     %rax,%rbx
+        ssize_t res = write(fd, buf, bs);
+  8009e1:	4c 89 ea             	mov    %r13,%rdx
+  8009e4:	48 be 20 80 80 00 00 	movabs $0x808020,%rsi
+  8009eb:	00 00 00 
+  8009ee:	44 89 f7             	mov    %r14d,%edi
+  8009f1:	48 b8 cd 31 80 00 00 	movabs $0x8031cd,%rax
+  8009f8:	00 00 00 
+  8009fb:	ff d0                	call   *%rax
+        if (res != (ssize_t)bs) panic("write: %i", (int)res);
+  8009fd:	4c 39 e8             	cmp    %r13,%rax
+  800a00:	0f 85 bd 00 00 00    	jne    800ac3 <umain+0x5aa>
+    asm volatile("rdtsc"
+  800a06:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800a08:	48 c1 e2 20          	shl    $0x20,%rdx
+  800a0c:	89 c0                	mov    %eax,%eax
+  800a0e:	48 09 c2             	or     %rax,%rdx
+        sample(read_tsc() - t);
+  800a11:	48 89 d7             	mov    %rdx,%rdi
+  800a14:	48 29 df             	sub    %rbx,%rdi
+  800a17:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800a1e:	00 00 00 
+  800a21:	ff d0                	call   *%rax
+    for (size_t i = 0; i < ops; i++) {
+  800a23:	49 83 c4 01          	add    $0x1,%r12
+  800a27:	4d 39 fc             	cmp    %r15,%r12
+  800a2a:	72 a7                	jb     8009d3 <umain+0x4ba>
+    if (fsync(fd) < 0) panic("fsync");
+  800a2c:	44 89 f7             	mov    %r14d,%edi
+  800a2f:	48 b8 69 43 80 00 00 	movabs $0x804369,%rax
+  800a36:	00 00 00 
+  800a39:	ff d0                	call   *%rax
+  800a3b:	85 c0                	test   %eax,%eax
+  800a3d:	0f 88 ad 00 00 00    	js     800af0 <umain+0x5d7>
+    asm volatile("rdtsc"
+  800a43:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800a45:	48 c1 e2 20          	shl    $0x20,%rdx
+  800a49:	89 c0                	mov    %eax,%eax
+  800a4b:	48 09 c2             	or     %rax,%rdx
+    uint64_t total = read_tsc() - start;
+  800a4e:	48 89 d3             	mov    %rdx,%rbx
+  800a51:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a55:	48 29 c3             	sub    %rax,%rbx
+    close(fd);
+  800a58:	44 89 f7             	mov    %r14d,%edi
+  800a5b:	48 b8 20 2f 80 00 00 	movabs $0x802f20,%rax
+  800a62:	00 00 00 
+  800a65:	ff d0                	call   *%rax
+    report("seqwrite", bs, ops, total);
+  800a67:	48 89 d9             	mov    %rbx,%rcx
+  800a6a:	4c 89 fa             	mov    %r15,%rdx
+  800a6d:	4c 89 ee             	mov    %r13,%rsi
+  800a70:	48 bf 42 60 80 00 00 	movabs $0x806042,%rdi
+  800a77:	00 00 00 
+  800a7a:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  800a81:	00 00 00 
+  800a84:	ff d0                	call   *%rax
+        for (size_t k = 0; k < sizeof(sizes) / sizeof(*sizes); k++) {
+  800a86:	48 83 45 a0 01       	addq   $0x1,-0x60(%rbp)
+  800a8b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a8f:	48 83 f8 03          	cmp    $0x3,%rax
+  800a93:	0f 84 49 fc ff ff    	je     8006e2 <umain+0x1c9>
+            if (enabled("seqwrite") || k == 0) seq_write(sizes[k]);
+  800a99:	48 bf 42 60 80 00 00 	movabs $0x806042,%rdi
+  800aa0:	00 00 00 
+  800aa3:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+  800aaf:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  800ab4:	0f 84 96 fe ff ff    	je     800950 <umain+0x437>
+  800aba:	84 c0                	test   %al,%al
+  800abc:	74 c8                	je     800a86 <umain+0x56d>
+  800abe:	e9 8d fe ff ff       	jmp    800950 <umain+0x437>
+        if (res != (ssize_t)bs) panic("write: %i", (int)res);
+  800ac3:	89 c1                	mov    %eax,%ecx
+  800ac5:	48 ba 69 60 80 00 00 	movabs $0x806069,%rdx
+  800acc:	00 00 00 
+  800acf:	be 6d 00 00 00       	mov    $0x6d,%esi
+  800ad4:	48 bf 0e 60 80 00 00 	movabs $0x80600e,%rdi
+  800adb:	00 00 00 
+  800ade:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae3:	49 b8 75 0f 80 00 00 	movabs $0x800f75,%r8
+  800aea:	00 00 00 
+  800aed:	41 ff d0             	call   *%r8
+    if (fsync(fd) < 0) panic("fsync");
+  800af0:	48 ba 73 60 80 00 00 	movabs $0x806073,%rdx
+  800af7:	00 00 00 
+  800afa:	be 71 00 00 00       	mov    $0x71,%esi
+  800aff:	48 bf 0e 60 80 00 00 	movabs $0x80600e,%rdi
+  800b06:	00 00 00 
+  800b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0e:	48 b9 75 0f 80 00 00 	movabs $0x800f75,%rcx
+  800b15:	00 00 00 
+  800b18:	ff d1                	call   *%rcx
+        if (res != (ssize_t)bs) panic("read: %i", (int)res);
+  800b1a:	89 c1                	mov    %eax,%ecx
+  800b1c:	48 ba 79 60 80 00 00 	movabs $0x806079,%rdx
+  800b23:	00 00 00 
+  800b26:	be 81 00 00 00       	mov    $0x81,%esi
+  800b2b:	48 bf 0e 60 80 00 00 	movabs $0x80600e,%rdi
+  800b32:	00 00 00 
+  800b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3a:	49 b8 75 0f 80 00 00 	movabs $0x800f75,%r8
+  800b41:	00 00 00 
+  800b44:	41 ff d0             	call   *%r8
+    size_t nblocks = file_size / bs;
+  800b47:	48 a1 10 70 80 00 00 	movabs 0x807010,%rax
+  800b4e:	00 00 00 
+  800b51:	48 c1 e8 0c          	shr    $0xc,%rax
+  800b55:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    int fd = xopen(BENCH_FILE, O_RDONLY);
+  800b59:	be 00 00 00 00       	mov    $0x0,%esi
+  800b5e:	48 bf 5c 60 80 00 00 	movabs $0x80605c,%rdi
+  800b65:	00 00 00 
+  800b68:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  800b6f:	00 00 00 
+  800b72:	ff d0                	call   *%rax
+  800b74:	41 89 c5             	mov    %eax,%r13d
+    asm volatile("rdtsc"
+  800b77:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b79:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b7d:	89 c0                	mov    %eax,%eax
+  800b7f:	48 09 c2             	or     %rax,%rdx
+  800b82:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+    for (size_t i = 0; i < nops; i++) {
+  800b86:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800b8d:	00 00 00 
+  800b90:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b94:	0f 84 b7 00 00 00    	je     800c51 <umain+0x738>
+  800b9a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    state ^= state << 13;
+  800ba0:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  800ba7:	00 00 00 
+        seek(fd, (off_t)(xorshift() % nblocks) * bs);
+  800baa:	49 bf 86 32 80 00 00 	movabs $0x803286,%r15
+  800bb1:	00 00 00 
+    asm volatile("rdtsc"
+  800bb4:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bb6:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bba:	89 c0                	mov    %eax,%eax
+  800bbc:	48 89 d3             	mov    %rdx,%rbx
+  800bbf:	48 09 c3             	or     %rax,%rbx
+    state ^= state << 13;
+  800bc2:	41 8b 16             	mov    (%r14),%edx
+  800bc5:	89 d0                	mov    %edx,%eax
+  800bc7:	c1 e0 0d             	shl    $0xd,%eax
+  800bca:	31 d0                	xor    %edx,%eax
+    state ^= state >> 17;
+  800bcc:	89 c2                	mov    %eax,%edx
+  800bce:	c1 ea 11             	shr    $0x11,%edx
+  800bd1:	31 c2                	xor    %eax,%edx
+    state ^= state << 5;
+  800bd3:	89 d0                	mov    %edx,%eax
+  800bd5:	c1 e0 05             	shl    $0x5,%eax
+  800bd8:	31 d0                	xor    %edx,%eax
+  800bda:	41 89 06             	mov    %eax,(%r14)
+        seek(fd, (off_t)(xorshift() % nblocks) * bs);
+  800bdd:	89 c0                	mov    %eax,%eax
+  800bdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be4:	48 f7 75 a0          	divq   -0x60(%rbp)
+  800be8:	89 d6                	mov    %edx,%esi
+  800bea:	c1 e6 0c             	shl    $0xc,%esi
+  800bed:	44 89 ef             	mov    %r13d,%edi
+  800bf0:	41 ff d7             	call   *%r15
+        ssize_t res = readn(fd, buf, bs);
+  800bf3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800bf8:	48 be 20 80 80 00 00 	movabs $0x808020,%rsi
+  800bff:	00 00 00 
+  800c02:	44 89 ef             	mov    %r13d,%edi
+  800c05:	48 b8 5c 31 80 00 00 	movabs $0x80315c,%rax
+  800c0c:	00 00 00 
+  800c0f:	ff d0                	call   *%rax
+        if (res != (ssize_t)bs) panic("read: %i", (int)res);
+  800c11:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  800c17:	0f 85 88 00 00 00    	jne    800ca5 <umain+0x78c>
+    asm volatile("rdtsc"
+  800c1d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c1f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c23:	89 c0                	mov    %eax,%eax
+  800c25:	48 09 c2             	or     %rax,%rdx
+        sample(read_tsc() - t);
+  800c28:	48 89 d7             	mov    %rdx,%rdi
+  800c2b:	48 29 df             	sub    %rbx,%rdi
+  800c2e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800c35:	00 00 00 
+  800c38:	ff d0                	call   *%rax
+    for (size_t i = 0; i < nops; i++) {
+  800c3a:	49 83 c4 01          	add    $0x1,%r12
+  800c3e:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800c45:	00 00 00 
+  800c48:	4c 3b 20             	cmp    (%rax),%r12
+  800c4b:	0f 82 63 ff ff ff    	jb     800bb4 <umain+0x69b>
+    asm volatile("rdtsc"
+  800c51:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c53:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c57:	89 c0                	mov    %eax,%eax
+  800c59:	48 09 c2             	or     %rax,%rdx
+    uint64_t total = read_tsc() - start;
+  800c5c:	48 89 d3             	mov    %rdx,%rbx
+  800c5f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c63:	48 29 c3             	sub    %rax,%rbx
+    close(fd);
+  800c66:	44 89 ef             	mov    %r13d,%edi
+  800c69:	48 b8 20 2f 80 00 00 	movabs $0x802f20,%rax
+  800c70:	00 00 00 
+  800c73:	ff d0                	call   *%rax
+    report("randread", bs, nops, total);
+  800c75:	48 89 d9             	mov    %rbx,%rcx
+  800c78:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800c7f:	00 00 00 
+  800c82:	48 8b 10             	mov    (%rax),%rdx
+  800c85:	be 00 10 00 00       	mov    $0x1000,%esi
+  800c8a:	48 bf 53 60 80 00 00 	movabs $0x806053,%rdi
+  800c91:	00 00 00 
+  800c94:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  800c9b:	00 00 00 
+  800c9e:	ff d0                	call   *%rax
+}
+  800ca0:	e9 99 fb ff ff       	jmp    80083e <umain+0x325>
+        if (res != (ssize_t)bs) panic("read: %i", (int)res);
+  800ca5:	89 c1                	mov    %eax,%ecx
+  800ca7:	48 ba 79 60 80 00 00 	movabs $0x806079,%rdx
+  800cae:	00 00 00 
+  800cb1:	be 9f 00 00 00       	mov    $0x9f,%esi
+  800cb6:	48 bf 0e 60 80 00 00 	movabs $0x80600e,%rdi
+  800cbd:	00 00 00 
+  800cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc5:	49 b8 75 0f 80 00 00 	movabs $0x800f75,%r8
+  800ccc:	00 00 00 
+  800ccf:	41 ff d0             	call   *%r8
+    int fd = xopen(BENCH_FILE, O_WRONLY);
+  800cd2:	be 01 00 00 00       	mov    $0x1,%esi
+  800cd7:	48 bf 5c 60 80 00 00 	movabs $0x80605c,%rdi
+  800cde:	00 00 00 
+  800ce1:	48 b8 5e 01 80 00 00 	movabs $0x80015e,%rax
+  800ce8:	00 00 00 
+  800ceb:	ff d0                	call   *%rax
+  800ced:	41 89 c6             	mov    %eax,%r14d
+    memset(buf, 0x5A, bs);
+  800cf0:	ba 00 00 01 00       	mov    $0x10000,%edx
+  800cf5:	be 5a 00 00 00       	mov    $0x5a,%esi
+  800cfa:	48 bf 20 80 80 00 00 	movabs $0x808020,%rdi
+  800d01:	00 00 00 
+  800d04:	48 b8 1d 1d 80 00 00 	movabs $0x801d1d,%rax
+  800d0b:	00 00 00 
+  800d0e:	ff d0                	call   *%rax
+  800d10:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    uint64_t total = 0;
+  800d16:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        seek(fd, (off_t)(i * bs) % file_size);
+  800d1c:	48 b9 10 70 80 00 00 	movabs $0x807010,%rcx
+  800d23:	00 00 00 
+  800d26:	4c 89 e8             	mov    %r13,%rax
+  800d29:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2e:	48 f7 31             	divq   (%rcx)
+  800d31:	89 d6                	mov    %edx,%esi
+  800d33:	44 89 f7             	mov    %r14d,%edi
+  800d36:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  800d3d:	00 00 00 
+  800d40:	ff d0                	call   *%rax
+        if (write(fd, buf, bs) != (ssize_t)bs) panic("write");
+  800d42:	ba 00 00 01 00       	mov    $0x10000,%edx
+  800d47:	48 be 20 80 80 00 00 	movabs $0x808020,%rsi
+  800d4e:	00 00 00 
+  800d51:	44 89 f7             	mov    %r14d,%edi
+  800d54:	48 b8 cd 31 80 00 00 	movabs $0x8031cd,%rax
+  800d5b:	00 00 00 
+  800d5e:	ff d0                	call   *%rax
+  800d60:	48 3d 00 00 01 00    	cmp    $0x10000,%rax
+  800d66:	0f 85 88 00 00 00    	jne    800df4 <umain+0x8db>
+    asm volatile("rdtsc"
+  800d6c:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800d6e:	48 c1 e2 20          	shl    $0x20,%rdx
+  800d72:	89 c0                	mov    %eax,%eax
+  800d74:	48 09 c2             	or     %rax,%rdx
+  800d77:	49 89 d4             	mov    %rdx,%r12
+        sync();
+  800d7a:	48 b8 1d 45 80 00 00 	movabs $0x80451d,%rax
+  800d81:	00 00 00 
+  800d84:	ff d0                	call   *%rax
+    asm volatile("rdtsc"
+  800d86:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800d88:	48 c1 e2 20          	shl    $0x20,%rdx
+  800d8c:	89 c0                	mov    %eax,%eax
+  800d8e:	48 09 c2             	or     %rax,%rdx
+        t = read_tsc() - t;
+  800d91:	48 89 d3             	mov    %rdx,%rbx
+  800d94:	4c 29 e3             	sub    %r12,%rbx
+        sample(t);
+  800d97:	48 89 df             	mov    %rbx,%rdi
+  800d9a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800da1:	00 00 00 
+  800da4:	ff d0                	call   *%rax
+        total += t;
+  800da6:	49 01 df             	add    %rbx,%r15
+    for (size_t i = 0; i < rounds; i++) {
+  800da9:	49 81 c5 00 00 01 00 	add    $0x10000,%r13
+  800db0:	49 81 fd 00 00 10 00 	cmp    $0x100000,%r13
+  800db7:	0f 85 5f ff ff ff    	jne    800d1c <umain+0x803>
+    close(fd);
+  800dbd:	44 89 f7             	mov    %r14d,%edi
+  800dc0:	48 b8 20 2f 80 00 00 	movabs $0x802f20,%rax
+  800dc7:	00 00 00 
+  800dca:	ff d0                	call   *%rax
+    report("sync", bs, rounds, total);
+  800dcc:	4c 89 f9             	mov    %r15,%rcx
+  800dcf:	ba 10 00 00 00       	mov    $0x10,%edx
+  800dd4:	be 00 00 01 00       	mov    $0x10000,%esi
+  800dd9:	48 bf 74 60 80 00 00 	movabs $0x806074,%rdi
+  800de0:	00 00 00 
+  800de3:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  800dea:	00 00 00 
+  800ded:	ff d0                	call   *%rax
+}
+  800def:	e9 68 fa ff ff       	jmp    80085c <umain+0x343>
+        if (write(fd, buf, bs) != (ssize_t)bs) panic("write");
+  800df4:	48 ba 45 60 80 00 00 	movabs $0x806045,%rdx
+  800dfb:	00 00 00 
+  800dfe:	be da 00 00 00       	mov    $0xda,%esi
+  800e03:	48 bf 0e 60 80 00 00 	movabs $0x80600e,%rdi
+  800e0a:	00 00 00 
+  800e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e12:	48 b9 75 0f 80 00 00 	movabs $0x800f75,%rcx
+  800e19:	00 00 00 
+  800e1c:	ff d1                	call   *%rcx
+    if (enabled("create") || enabled("open") || enabled("stat") || enabled("remove")) {
+  800e1e:	48 bf 89 60 80 00 00 	movabs $0x806089,%rdi
+  800e25:	00 00 00 
+  800e28:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  800e2f:	00 00 00 
+  800e32:	ff d0                	call   *%rax
+  800e34:	84 c0                	test   %al,%al
+  800e36:	0f 85 58 fa ff ff    	jne    800894 <umain+0x37b>
+  800e3c:	48 bf 8e 60 80 00 00 	movabs $0x80608e,%rdi
+  800e43:	00 00 00 
+  800e46:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  800e4d:	00 00 00 
+  800e50:	ff d0                	call   *%rax
+  800e52:	84 c0                	test   %al,%al
+  800e54:	0f 84 b6 fa ff ff    	je     800910 <umain+0x3f7>
+  800e5a:	e9 35 fa ff ff       	jmp    800894 <umain+0x37b>
+        if (enabled("open")) file_storm("open", do_open);
+  800e5f:	48 be b1 01 80 00 00 	movabs $0x8001b1,%rsi
+  800e66:	00 00 00 
+  800e69:	48 bf 04 63 80 00 00 	movabs $0x806304,%rdi
+  800e70:	00 00 00 
+  800e73:	48 b8 ca 03 80 00 00 	movabs $0x8003ca,%rax
+  800e7a:	00 00 00 
+  800e7d:	ff d0                	call   *%rax
+  800e7f:	e9 4e fa ff ff       	jmp    8008d2 <umain+0x3b9>
+        if (enabled("stat")) file_storm("stat", do_stat);
+  800e84:	48 be 01 01 80 00 00 	movabs $0x800101,%rsi
+  800e8b:	00 00 00 
+  800e8e:	48 bf 89 60 80 00 00 	movabs $0x806089,%rdi
+  800e95:	00 00 00 
+  800e98:	48 b8 ca 03 80 00 00 	movabs $0x8003ca,%rax
+  800e9f:	00 00 00 
+  800ea2:	ff d0                	call   *%rax
+  800ea4:	e9 47 fa ff ff       	jmp    8008f0 <umain+0x3d7>
+
+0000000000800ea9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800ea9:	55                   	push   %rbp
+  800eaa:	48 89 e5             	mov    %rsp,%rbp
+  800ead:	41 56                	push   %r14
+  800eaf:	41 55                	push   %r13
+  800eb1:	41 54                	push   %r12
+  800eb3:	53                   	push   %rbx
+  800eb4:	41 89 fd             	mov    %edi,%r13d
+  800eb7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800eba:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  800ec1:	00 00 00 
+  800ec4:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  800ecb:	00 00 00 
+  800ece:	48 39 c2             	cmp    %rax,%rdx
+  800ed1:	73 17                	jae    800eea <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800ed3:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ed6:	49 89 c4             	mov    %rax,%r12
+  800ed9:	48 83 c3 08          	add    $0x8,%rbx
+  800edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee2:	ff 53 f8             	call   *-0x8(%rbx)
+  800ee5:	4c 39 e3             	cmp    %r12,%rbx
+  800ee8:	72 ef                	jb     800ed9 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800eea:	48 b8 dd 20 80 00 00 	movabs $0x8020dd,%rax
+  800ef1:	00 00 00 
+  800ef4:	ff d0                	call   *%rax
+  800ef6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800efb:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800f02:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800f09:	00 00 00 
+  800f0c:	48 01 d0             	add    %rdx,%rax
+  800f0f:	48 a3 40 00 85 00 00 	movabs %rax,0x850040
+  800f16:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800f19:	45 85 ed             	test   %r13d,%r13d
+  800f1c:	7e 0d                	jle    800f2b <libmain+0x82>
+  800f1e:	49 8b 06             	mov    (%r14),%rax
+  800f21:	48 a3 18 70 80 00 00 	movabs %rax,0x807018
+  800f28:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800f2b:	4c 89 f6             	mov    %r14,%rsi
+  800f2e:	44 89 ef             	mov    %r13d,%edi
+  800f31:	48 b8 19 05 80 00 00 	movabs $0x800519,%rax
+  800f38:	00 00 00 
+  800f3b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800f3d:	48 b8 52 0f 80 00 00 	movabs $0x800f52,%rax
+  800f44:	00 00 00 
+  800f47:	ff d0                	call   *%rax
+#endif
+}
+  800f49:	5b                   	pop    %rbx
+  800f4a:	41 5c                	pop    %r12
+  800f4c:	41 5d                	pop    %r13
+  800f4e:	41 5e                	pop    %r14
+  800f50:	5d                   	pop    %rbp
+  800f51:	c3                   	ret
+
+0000000000800f52 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800f52:	55                   	push   %rbp
+  800f53:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800f56:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  800f5d:	00 00 00 
+  800f60:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800f62:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f67:	48 b8 72 20 80 00 00 	movabs $0x802072,%rax
+  800f6e:	00 00 00 
+  800f71:	ff d0                	call   *%rax
+}
+  800f73:	5d                   	pop    %rbp
+  800f74:	c3                   	ret
+
+0000000000800f75 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800f75:	55                   	push   %rbp
+  800f76:	48 89 e5             	mov    %rsp,%rbp
+  800f79:	41 56                	push   %r14
+  800f7b:	41 55                	push   %r13
+  800f7d:	41 54                	push   %r12
+  800f7f:	53                   	push   %rbx
+  800f80:	48 83 ec 50          	sub    $0x50,%rsp
+  800f84:	49 89 fc             	mov    %rdi,%r12
+  800f87:	41 89 f5             	mov    %esi,%r13d
+  800f8a:	48 89 d3             	mov    %rdx,%rbx
+  800f8d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800f91:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800f95:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f99:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800fa0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fa4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800fa8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800fac:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800fb0:	48 b8 18 70 80 00 00 	movabs $0x807018,%rax
+  800fb7:	00 00 00 
+  800fba:	4c 8b 30             	mov    (%rax),%r14
+  800fbd:	48 b8 dd 20 80 00 00 	movabs $0x8020dd,%rax
+  800fc4:	00 00 00 
+  800fc7:	ff d0                	call   *%rax
+  800fc9:	89 c6                	mov    %eax,%esi
+  800fcb:	45 89 e8             	mov    %r13d,%r8d
+  800fce:	4c 89 e1             	mov    %r12,%rcx
+  800fd1:	4c 89 f2             	mov    %r14,%rdx
+  800fd4:	48 bf a8 61 80 00 00 	movabs $0x8061a8,%rdi
+  800fdb:	00 00 00 
+  800fde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe3:	49 bc c5 10 80 00 00 	movabs $0x8010c5,%r12
+  800fea:	00 00 00 
+  800fed:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800ff0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800ff4:	48 89 df             	mov    %rbx,%rdi
+  800ff7:	48 b8 61 10 80 00 00 	movabs $0x801061,%rax
+  800ffe:	00 00 00 
+  801001:	ff d0                	call   *%rax
+    cprintf("\n");
+  801003:	48 bf e3 67 80 00 00 	movabs $0x8067e3,%rdi
+  80100a:	00 00 00 
+  80100d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801012:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801015:	cc                   	int3
+  801016:	eb fd                	jmp    801015 <_panic+0xa0>
+
+0000000000801018 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801018:	55                   	push   %rbp
+  801019:	48 89 e5             	mov    %rsp,%rbp
+  80101c:	53                   	push   %rbx
+  80101d:	48 83 ec 08          	sub    $0x8,%rsp
+  801021:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801024:	8b 06                	mov    (%rsi),%eax
+  801026:	8d 50 01             	lea    0x1(%rax),%edx
+  801029:	89 16                	mov    %edx,(%rsi)
+  80102b:	48 98                	cltq
+  80102d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801032:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801038:	74 0a                	je     801044 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80103a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80103e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801042:	c9                   	leave
+  801043:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801044:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801048:	be ff 00 00 00       	mov    $0xff,%esi
+  80104d:	48 b8 14 20 80 00 00 	movabs $0x802014,%rax
+  801054:	00 00 00 
+  801057:	ff d0                	call   *%rax
+        state->offset = 0;
+  801059:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80105f:	eb d9                	jmp    80103a <putch+0x22>
+
+0000000000801061 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801061:	55                   	push   %rbp
+  801062:	48 89 e5             	mov    %rsp,%rbp
+  801065:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80106c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80106f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801076:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80107b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801080:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801083:	48 89 f1             	mov    %rsi,%rcx
+  801086:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80108d:	48 bf 18 10 80 00 00 	movabs $0x801018,%rdi
+  801094:	00 00 00 
+  801097:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  80109e:	00 00 00 
+  8010a1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8010a3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8010aa:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8010b1:	48 b8 14 20 80 00 00 	movabs $0x802014,%rax
+  8010b8:	00 00 00 
+  8010bb:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8010bd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8010c3:	c9                   	leave
+  8010c4:	c3                   	ret
+
+00000000008010c5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8010c5:	55                   	push   %rbp
+  8010c6:	48 89 e5             	mov    %rsp,%rbp
+  8010c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8010cd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8010d1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8010d5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8010d9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8010dd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8010e1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8010e8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010f0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8010f4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8010f8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8010fc:	48 b8 61 10 80 00 00 	movabs $0x801061,%rax
+  801103:	00 00 00 
+  801106:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801108:	c9                   	leave
+  801109:	c3                   	ret
+
+000000000080110a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80110a:	55                   	push   %rbp
+  80110b:	48 89 e5             	mov    %rsp,%rbp
+  80110e:	41 57                	push   %r15
+  801110:	41 56                	push   %r14
+  801112:	41 55                	push   %r13
+  801114:	41 54                	push   %r12
+  801116:	53                   	push   %rbx
+  801117:	48 83 ec 18          	sub    $0x18,%rsp
+  80111b:	49 89 fc             	mov    %rdi,%r12
+  80111e:	49 89 f5             	mov    %rsi,%r13
+  801121:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801125:	8b 45 10             	mov    0x10(%rbp),%eax
+  801128:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80112b:	41 89 cf             	mov    %ecx,%r15d
+  80112e:	4c 39 fa             	cmp    %r15,%rdx
+  801131:	73 5b                	jae    80118e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801133:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801137:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80113b:	85 db                	test   %ebx,%ebx
+  80113d:	7e 0e                	jle    80114d <print_num+0x43>
+            putch(padc, put_arg);
+  80113f:	4c 89 ee             	mov    %r13,%rsi
+  801142:	44 89 f7             	mov    %r14d,%edi
+  801145:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801148:	83 eb 01             	sub    $0x1,%ebx
+  80114b:	75 f2                	jne    80113f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80114d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801151:	48 b9 dc 61 80 00 00 	movabs $0x8061dc,%rcx
+  801158:	00 00 00 
+  80115b:	48 b8 cb 61 80 00 00 	movabs $0x8061cb,%rax
+  801162:	00 00 00 
+  801165:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801169:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80116d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801172:	49 f7 f7             	div    %r15
+  801175:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801179:	4c 89 ee             	mov    %r13,%rsi
+  80117c:	41 ff d4             	call   *%r12
+}
+  80117f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801183:	5b                   	pop    %rbx
+  801184:	41 5c                	pop    %r12
+  801186:	41 5d                	pop    %r13
+  801188:	41 5e                	pop    %r14
+  80118a:	41 5f                	pop    %r15
+  80118c:	5d                   	pop    %rbp
+  80118d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80118e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801192:	ba 00 00 00 00       	mov    $0x0,%edx
+  801197:	49 f7 f7             	div    %r15
+  80119a:	48 83 ec 08          	sub    $0x8,%rsp
+  80119e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8011a2:	52                   	push   %rdx
+  8011a3:	45 0f be c9          	movsbl %r9b,%r9d
+  8011a7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8011ab:	48 89 c2             	mov    %rax,%rdx
+  8011ae:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  8011b5:	00 00 00 
+  8011b8:	ff d0                	call   *%rax
+  8011ba:	48 83 c4 10          	add    $0x10,%rsp
+  8011be:	eb 8d                	jmp    80114d <print_num+0x43>
+
+00000000008011c0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8011c0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8011c4:	48 8b 06             	mov    (%rsi),%rax
+  8011c7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8011cb:	73 0a                	jae    8011d7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8011cd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8011d1:	48 89 16             	mov    %rdx,(%rsi)
+  8011d4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8011d7:	c3                   	ret
+
+00000000008011d8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8011d8:	55                   	push   %rbp
+  8011d9:	48 89 e5             	mov    %rsp,%rbp
+  8011dc:	48 83 ec 50          	sub    $0x50,%rsp
+  8011e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011e4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8011e8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8011ec:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8011f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011fb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8011ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801203:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801207:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  80120e:	00 00 00 
+  801211:	ff d0                	call   *%rax
+}
+  801213:	c9                   	leave
+  801214:	c3                   	ret
+
+0000000000801215 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801215:	55                   	push   %rbp
+  801216:	48 89 e5             	mov    %rsp,%rbp
+  801219:	41 57                	push   %r15
+  80121b:	41 56                	push   %r14
+  80121d:	41 55                	push   %r13
+  80121f:	41 54                	push   %r12
+  801221:	53                   	push   %rbx
+  801222:	48 83 ec 38          	sub    $0x38,%rsp
+  801226:	49 89 fe             	mov    %rdi,%r14
+  801229:	49 89 f5             	mov    %rsi,%r13
+  80122c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80122f:	48 8b 01             	mov    (%rcx),%rax
+  801232:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801236:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80123a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80123e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801242:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801246:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80124a:	0f b6 3b             	movzbl (%rbx),%edi
+  80124d:	40 80 ff 25          	cmp    $0x25,%dil
+  801251:	74 18                	je     80126b <vprintfmt+0x56>
+            if (!ch) return;
+  801253:	40 84 ff             	test   %dil,%dil
+  801256:	0f 84 04 07 00 00    	je     801960 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80125c:	40 0f b6 ff          	movzbl %dil,%edi
+  801260:	4c 89 ee             	mov    %r13,%rsi
+  801263:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801266:	4c 89 e3             	mov    %r12,%rbx
+  801269:	eb db                	jmp    801246 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80126b:	be 00 00 00 00       	mov    $0x0,%esi
+  801270:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801274:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801279:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80127f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801286:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80128a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80128f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801294:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801297:	83 e8 23             	sub    $0x23,%eax
+  80129a:	3c 57                	cmp    $0x57,%al
+  80129c:	0f 87 a4 06 00 00    	ja     801946 <vprintfmt+0x731>
+  8012a2:	0f b6 c0             	movzbl %al,%eax
+  8012a5:	48 b9 60 63 80 00 00 	movabs $0x806360,%rcx
+  8012ac:	00 00 00 
+  8012af:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8012b2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8012b5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8012b9:	eb cf                	jmp    80128a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8012bb:	49 89 dc             	mov    %rbx,%r12
+  8012be:	be 01 00 00 00       	mov    $0x1,%esi
+  8012c3:	eb c5                	jmp    80128a <vprintfmt+0x75>
+            padc = ch;
+  8012c5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8012c9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8012cc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8012cf:	eb b9                	jmp    80128a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8012d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8012d7:	77 24                	ja     8012fd <vprintfmt+0xe8>
+  8012d9:	89 c1                	mov    %eax,%ecx
+  8012db:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8012df:	83 c0 08             	add    $0x8,%eax
+  8012e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012e5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8012e8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8012eb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8012ef:	79 99                	jns    80128a <vprintfmt+0x75>
+                width = precision;
+  8012f1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8012f5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8012fb:	eb 8d                	jmp    80128a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8012fd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801301:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801305:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801309:	eb da                	jmp    8012e5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80130b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801310:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801314:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80131a:	3c 39                	cmp    $0x39,%al
+  80131c:	77 1c                	ja     80133a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80131e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801322:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801326:	0f b6 c0             	movzbl %al,%eax
+  801329:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80132e:	0f b6 03             	movzbl (%rbx),%eax
+  801331:	3c 39                	cmp    $0x39,%al
+  801333:	76 e9                	jbe    80131e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801335:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801338:	eb b1                	jmp    8012eb <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80133a:	49 89 dc             	mov    %rbx,%r12
+  80133d:	eb ac                	jmp    8012eb <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80133f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801342:	85 c9                	test   %ecx,%ecx
+  801344:	b8 00 00 00 00       	mov    $0x0,%eax
+  801349:	0f 49 c1             	cmovns %ecx,%eax
+  80134c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80134f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801352:	e9 33 ff ff ff       	jmp    80128a <vprintfmt+0x75>
+            lflag++;
+  801357:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80135a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80135d:	e9 28 ff ff ff       	jmp    80128a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801362:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801365:	83 f8 2f             	cmp    $0x2f,%eax
+  801368:	77 19                	ja     801383 <vprintfmt+0x16e>
+  80136a:	89 c2                	mov    %eax,%edx
+  80136c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801370:	83 c0 08             	add    $0x8,%eax
+  801373:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801376:	8b 3a                	mov    (%rdx),%edi
+  801378:	4c 89 ee             	mov    %r13,%rsi
+  80137b:	41 ff d6             	call   *%r14
+            break;
+  80137e:	e9 c3 fe ff ff       	jmp    801246 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  801383:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801387:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80138b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80138f:	eb e5                	jmp    801376 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  801391:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801394:	83 f8 2f             	cmp    $0x2f,%eax
+  801397:	77 5a                	ja     8013f3 <vprintfmt+0x1de>
+  801399:	89 c2                	mov    %eax,%edx
+  80139b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80139f:	83 c0 08             	add    $0x8,%eax
+  8013a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8013a5:	8b 02                	mov    (%rdx),%eax
+  8013a7:	89 c1                	mov    %eax,%ecx
+  8013a9:	f7 d9                	neg    %ecx
+  8013ab:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8013ae:	83 f9 13             	cmp    $0x13,%ecx
+  8013b1:	7f 4e                	jg     801401 <vprintfmt+0x1ec>
+  8013b3:	48 63 c1             	movslq %ecx,%rax
+  8013b6:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  8013bd:	00 00 00 
+  8013c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8013c4:	48 85 c0             	test   %rax,%rax
+  8013c7:	74 38                	je     801401 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8013c9:	48 89 c1             	mov    %rax,%rcx
+  8013cc:	48 ba 59 68 80 00 00 	movabs $0x806859,%rdx
+  8013d3:	00 00 00 
+  8013d6:	4c 89 ee             	mov    %r13,%rsi
+  8013d9:	4c 89 f7             	mov    %r14,%rdi
+  8013dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e1:	49 b8 d8 11 80 00 00 	movabs $0x8011d8,%r8
+  8013e8:	00 00 00 
+  8013eb:	41 ff d0             	call   *%r8
+  8013ee:	e9 53 fe ff ff       	jmp    801246 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8013f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013ff:	eb a4                	jmp    8013a5 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801401:	48 ba f4 61 80 00 00 	movabs $0x8061f4,%rdx
+  801408:	00 00 00 
+  80140b:	4c 89 ee             	mov    %r13,%rsi
+  80140e:	4c 89 f7             	mov    %r14,%rdi
+  801411:	b8 00 00 00 00       	mov    $0x0,%eax
+  801416:	49 b8 d8 11 80 00 00 	movabs $0x8011d8,%r8
+  80141d:	00 00 00 
+  801420:	41 ff d0             	call   *%r8
+  801423:	e9 1e fe ff ff       	jmp    801246 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801428:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80142b:	83 f8 2f             	cmp    $0x2f,%eax
+  80142e:	77 36                	ja     801466 <vprintfmt+0x251>
+  801430:	89 c2                	mov    %eax,%edx
+  801432:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801436:	83 c0 08             	add    $0x8,%eax
+  801439:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80143c:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80143f:	48 85 f6             	test   %rsi,%rsi
+  801442:	48 b8 ed 61 80 00 00 	movabs $0x8061ed,%rax
+  801449:	00 00 00 
+  80144c:	48 0f 45 c6          	cmovne %rsi,%rax
+  801450:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801454:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801458:	7e 06                	jle    801460 <vprintfmt+0x24b>
+  80145a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80145e:	75 14                	jne    801474 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801460:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801464:	eb 5b                	jmp    8014c1 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  801466:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80146a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80146e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801472:	eb c8                	jmp    80143c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  801474:	49 63 f7             	movslq %r15d,%rsi
+  801477:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80147b:	48 b8 1a 1a 80 00 00 	movabs $0x801a1a,%rax
+  801482:	00 00 00 
+  801485:	ff d0                	call   *%rax
+  801487:	48 89 c2             	mov    %rax,%rdx
+  80148a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80148d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80148f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  801492:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  801495:	85 c0                	test   %eax,%eax
+  801497:	7e c7                	jle    801460 <vprintfmt+0x24b>
+  801499:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80149e:	4c 89 ee             	mov    %r13,%rsi
+  8014a1:	44 89 e7             	mov    %r12d,%edi
+  8014a4:	41 ff d6             	call   *%r14
+  8014a7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8014ab:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8014ae:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8014b1:	75 eb                	jne    80149e <vprintfmt+0x289>
+  8014b3:	eb ab                	jmp    801460 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8014b5:	0f b6 f8             	movzbl %al,%edi
+  8014b8:	4c 89 ee             	mov    %r13,%rsi
+  8014bb:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8014be:	4c 89 e2             	mov    %r12,%rdx
+  8014c1:	45 85 ff             	test   %r15d,%r15d
+  8014c4:	78 06                	js     8014cc <vprintfmt+0x2b7>
+  8014c6:	41 83 ef 01          	sub    $0x1,%r15d
+  8014ca:	78 23                	js     8014ef <vprintfmt+0x2da>
+  8014cc:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8014d0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8014d6:	84 c0                	test   %al,%al
+  8014d8:	74 15                	je     8014ef <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8014da:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8014de:	74 d5                	je     8014b5 <vprintfmt+0x2a0>
+  8014e0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8014e3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8014e8:	80 fa 5e             	cmp    $0x5e,%dl
+  8014eb:	77 cb                	ja     8014b8 <vprintfmt+0x2a3>
+  8014ed:	eb c6                	jmp    8014b5 <vprintfmt+0x2a0>
+  8014ef:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8014f2:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8014f5:	01 f0                	add    %esi,%eax
+  8014f7:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8014f9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	0f 8e 41 fd ff ff    	jle    801246 <vprintfmt+0x31>
+  801505:	4c 89 ee             	mov    %r13,%rsi
+  801508:	bf 20 00 00 00       	mov    $0x20,%edi
+  80150d:	41 ff d6             	call   *%r14
+  801510:	41 83 ec 01          	sub    $0x1,%r12d
+  801514:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801518:	75 eb                	jne    801505 <vprintfmt+0x2f0>
+  80151a:	e9 27 fd ff ff       	jmp    801246 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80151f:	40 84 f6             	test   %sil,%sil
+  801522:	75 26                	jne    80154a <vprintfmt+0x335>
+    switch (lflag) {
+  801524:	85 d2                	test   %edx,%edx
+  801526:	74 59                	je     801581 <vprintfmt+0x36c>
+  801528:	83 fa 01             	cmp    $0x1,%edx
+  80152b:	74 7b                	je     8015a8 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80152d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801530:	83 f8 2f             	cmp    $0x2f,%eax
+  801533:	0f 87 96 00 00 00    	ja     8015cf <vprintfmt+0x3ba>
+  801539:	89 c2                	mov    %eax,%edx
+  80153b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80153f:	83 c0 08             	add    $0x8,%eax
+  801542:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801545:	4c 8b 22             	mov    (%rdx),%r12
+  801548:	eb 17                	jmp    801561 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80154a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80154d:	83 f8 2f             	cmp    $0x2f,%eax
+  801550:	77 21                	ja     801573 <vprintfmt+0x35e>
+  801552:	89 c2                	mov    %eax,%edx
+  801554:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801558:	83 c0 08             	add    $0x8,%eax
+  80155b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80155e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801561:	4d 85 e4             	test   %r12,%r12
+  801564:	78 7a                	js     8015e0 <vprintfmt+0x3cb>
+            num = i;
+  801566:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801569:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80156e:	e9 b5 02 00 00       	jmp    801828 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  801573:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801577:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80157b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80157f:	eb dd                	jmp    80155e <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  801581:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801584:	83 f8 2f             	cmp    $0x2f,%eax
+  801587:	77 11                	ja     80159a <vprintfmt+0x385>
+  801589:	89 c2                	mov    %eax,%edx
+  80158b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80158f:	83 c0 08             	add    $0x8,%eax
+  801592:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801595:	4c 63 22             	movslq (%rdx),%r12
+  801598:	eb c7                	jmp    801561 <vprintfmt+0x34c>
+  80159a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80159e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015a6:	eb ed                	jmp    801595 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8015a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8015ae:	77 11                	ja     8015c1 <vprintfmt+0x3ac>
+  8015b0:	89 c2                	mov    %eax,%edx
+  8015b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015b6:	83 c0 08             	add    $0x8,%eax
+  8015b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015bc:	4c 8b 22             	mov    (%rdx),%r12
+  8015bf:	eb a0                	jmp    801561 <vprintfmt+0x34c>
+  8015c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015cd:	eb ed                	jmp    8015bc <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8015cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015db:	e9 65 ff ff ff       	jmp    801545 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8015e0:	4c 89 ee             	mov    %r13,%rsi
+  8015e3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8015e8:	41 ff d6             	call   *%r14
+                i = -i;
+  8015eb:	49 f7 dc             	neg    %r12
+  8015ee:	e9 73 ff ff ff       	jmp    801566 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8015f3:	40 84 f6             	test   %sil,%sil
+  8015f6:	75 32                	jne    80162a <vprintfmt+0x415>
+    switch (lflag) {
+  8015f8:	85 d2                	test   %edx,%edx
+  8015fa:	74 5d                	je     801659 <vprintfmt+0x444>
+  8015fc:	83 fa 01             	cmp    $0x1,%edx
+  8015ff:	0f 84 82 00 00 00    	je     801687 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  801605:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801608:	83 f8 2f             	cmp    $0x2f,%eax
+  80160b:	0f 87 a5 00 00 00    	ja     8016b6 <vprintfmt+0x4a1>
+  801611:	89 c2                	mov    %eax,%edx
+  801613:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801617:	83 c0 08             	add    $0x8,%eax
+  80161a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80161d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801620:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801625:	e9 fe 01 00 00       	jmp    801828 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80162a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80162d:	83 f8 2f             	cmp    $0x2f,%eax
+  801630:	77 19                	ja     80164b <vprintfmt+0x436>
+  801632:	89 c2                	mov    %eax,%edx
+  801634:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801638:	83 c0 08             	add    $0x8,%eax
+  80163b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80163e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801641:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801646:	e9 dd 01 00 00       	jmp    801828 <vprintfmt+0x613>
+  80164b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80164f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801653:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801657:	eb e5                	jmp    80163e <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  801659:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80165c:	83 f8 2f             	cmp    $0x2f,%eax
+  80165f:	77 18                	ja     801679 <vprintfmt+0x464>
+  801661:	89 c2                	mov    %eax,%edx
+  801663:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801667:	83 c0 08             	add    $0x8,%eax
+  80166a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80166d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80166f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801674:	e9 af 01 00 00       	jmp    801828 <vprintfmt+0x613>
+  801679:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80167d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801681:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801685:	eb e6                	jmp    80166d <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  801687:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80168a:	83 f8 2f             	cmp    $0x2f,%eax
+  80168d:	77 19                	ja     8016a8 <vprintfmt+0x493>
+  80168f:	89 c2                	mov    %eax,%edx
+  801691:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801695:	83 c0 08             	add    $0x8,%eax
+  801698:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80169b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80169e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8016a3:	e9 80 01 00 00       	jmp    801828 <vprintfmt+0x613>
+  8016a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016b4:	eb e5                	jmp    80169b <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8016b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016c2:	e9 56 ff ff ff       	jmp    80161d <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8016c7:	40 84 f6             	test   %sil,%sil
+  8016ca:	75 2e                	jne    8016fa <vprintfmt+0x4e5>
+    switch (lflag) {
+  8016cc:	85 d2                	test   %edx,%edx
+  8016ce:	0f 84 b3 00 00 00    	je     801787 <vprintfmt+0x572>
+  8016d4:	83 fa 01             	cmp    $0x1,%edx
+  8016d7:	0f 84 d3 00 00 00    	je     8017b0 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8016dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8016e3:	0f 87 f1 00 00 00    	ja     8017da <vprintfmt+0x5c5>
+  8016e9:	89 c2                	mov    %eax,%edx
+  8016eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016ef:	83 c0 08             	add    $0x8,%eax
+  8016f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016f5:	48 8b 02             	mov    (%rdx),%rax
+  8016f8:	eb 17                	jmp    801711 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8016fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016fd:	83 f8 2f             	cmp    $0x2f,%eax
+  801700:	77 77                	ja     801779 <vprintfmt+0x564>
+  801702:	89 c2                	mov    %eax,%edx
+  801704:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801708:	83 c0 08             	add    $0x8,%eax
+  80170b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80170e:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  801711:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  801713:	83 f8 07             	cmp    $0x7,%eax
+  801716:	0f 8e cf 00 00 00    	jle    8017eb <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  80171c:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  801722:	44 89 e7             	mov    %r12d,%edi
+  801725:	41 c1 e4 03          	shl    $0x3,%r12d
+  801729:	89 d1                	mov    %edx,%ecx
+  80172b:	8d 72 07             	lea    0x7(%rdx),%esi
+  80172e:	85 d2                	test   %edx,%edx
+  801730:	0f 48 d6             	cmovs  %esi,%edx
+  801733:	c1 fa 03             	sar    $0x3,%edx
+  801736:	83 f9 3f             	cmp    $0x3f,%ecx
+  801739:	7f e7                	jg     801722 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80173b:	85 ff                	test   %edi,%edi
+  80173d:	0f 84 03 fb ff ff    	je     801246 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  801743:	49 63 f4             	movslq %r12d,%rsi
+  801746:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174b:	48 f7 f6             	div    %rsi
+  80174e:	49 89 d7             	mov    %rdx,%r15
+  801751:	83 c0 30             	add    $0x30,%eax
+  801754:	0f be f8             	movsbl %al,%edi
+  801757:	4c 89 ee             	mov    %r13,%rsi
+  80175a:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80175d:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  801760:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  801765:	45 85 e4             	test   %r12d,%r12d
+  801768:	41 0f 49 d4          	cmovns %r12d,%edx
+  80176c:	c1 fa 03             	sar    $0x3,%edx
+  80176f:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  801772:	75 cf                	jne    801743 <vprintfmt+0x52e>
+  801774:	e9 cd fa ff ff       	jmp    801246 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  801779:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80177d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801781:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801785:	eb 87                	jmp    80170e <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  801787:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80178a:	83 f8 2f             	cmp    $0x2f,%eax
+  80178d:	77 13                	ja     8017a2 <vprintfmt+0x58d>
+  80178f:	89 c2                	mov    %eax,%edx
+  801791:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801795:	83 c0 08             	add    $0x8,%eax
+  801798:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80179b:	8b 02                	mov    (%rdx),%eax
+  80179d:	e9 6f ff ff ff       	jmp    801711 <vprintfmt+0x4fc>
+  8017a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8017a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8017aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017ae:	eb eb                	jmp    80179b <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8017b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8017b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8017b6:	77 14                	ja     8017cc <vprintfmt+0x5b7>
+  8017b8:	89 c2                	mov    %eax,%edx
+  8017ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8017be:	83 c0 08             	add    $0x8,%eax
+  8017c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8017c4:	48 8b 02             	mov    (%rdx),%rax
+  8017c7:	e9 45 ff ff ff       	jmp    801711 <vprintfmt+0x4fc>
+  8017cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8017d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8017d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017d8:	eb ea                	jmp    8017c4 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8017da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8017de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8017e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017e6:	e9 0a ff ff ff       	jmp    8016f5 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8017eb:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8017f1:	e9 4d ff ff ff       	jmp    801743 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8017f6:	4c 89 ee             	mov    %r13,%rsi
+  8017f9:	bf 30 00 00 00       	mov    $0x30,%edi
+  8017fe:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801801:	4c 89 ee             	mov    %r13,%rsi
+  801804:	bf 78 00 00 00       	mov    $0x78,%edi
+  801809:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80180c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80180f:	83 f8 2f             	cmp    $0x2f,%eax
+  801812:	77 47                	ja     80185b <vprintfmt+0x646>
+  801814:	89 c2                	mov    %eax,%edx
+  801816:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80181a:	83 c0 08             	add    $0x8,%eax
+  80181d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801820:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801823:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801828:	48 83 ec 08          	sub    $0x8,%rsp
+  80182c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801830:	0f 94 c0             	sete   %al
+  801833:	0f b6 c0             	movzbl %al,%eax
+  801836:	50                   	push   %rax
+  801837:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80183c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801840:	4c 89 ee             	mov    %r13,%rsi
+  801843:	4c 89 f7             	mov    %r14,%rdi
+  801846:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  80184d:	00 00 00 
+  801850:	ff d0                	call   *%rax
+            break;
+  801852:	48 83 c4 10          	add    $0x10,%rsp
+  801856:	e9 eb f9 ff ff       	jmp    801246 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80185b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80185f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801863:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801867:	eb b7                	jmp    801820 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  801869:	40 84 f6             	test   %sil,%sil
+  80186c:	75 2b                	jne    801899 <vprintfmt+0x684>
+    switch (lflag) {
+  80186e:	85 d2                	test   %edx,%edx
+  801870:	74 56                	je     8018c8 <vprintfmt+0x6b3>
+  801872:	83 fa 01             	cmp    $0x1,%edx
+  801875:	74 7f                	je     8018f6 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  801877:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80187a:	83 f8 2f             	cmp    $0x2f,%eax
+  80187d:	0f 87 a2 00 00 00    	ja     801925 <vprintfmt+0x710>
+  801883:	89 c2                	mov    %eax,%edx
+  801885:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801889:	83 c0 08             	add    $0x8,%eax
+  80188c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80188f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801892:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801897:	eb 8f                	jmp    801828 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  801899:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80189c:	83 f8 2f             	cmp    $0x2f,%eax
+  80189f:	77 19                	ja     8018ba <vprintfmt+0x6a5>
+  8018a1:	89 c2                	mov    %eax,%edx
+  8018a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8018a7:	83 c0 08             	add    $0x8,%eax
+  8018aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018ad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8018b0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8018b5:	e9 6e ff ff ff       	jmp    801828 <vprintfmt+0x613>
+  8018ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8018be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8018c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018c6:	eb e5                	jmp    8018ad <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8018c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8018ce:	77 18                	ja     8018e8 <vprintfmt+0x6d3>
+  8018d0:	89 c2                	mov    %eax,%edx
+  8018d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8018d6:	83 c0 08             	add    $0x8,%eax
+  8018d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018dc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8018de:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8018e3:	e9 40 ff ff ff       	jmp    801828 <vprintfmt+0x613>
+  8018e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8018ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8018f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018f4:	eb e6                	jmp    8018dc <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8018f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8018fc:	77 19                	ja     801917 <vprintfmt+0x702>
+  8018fe:	89 c2                	mov    %eax,%edx
+  801900:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801904:	83 c0 08             	add    $0x8,%eax
+  801907:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80190a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80190d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801912:	e9 11 ff ff ff       	jmp    801828 <vprintfmt+0x613>
+  801917:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80191b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80191f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801923:	eb e5                	jmp    80190a <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  801925:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801929:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80192d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801931:	e9 59 ff ff ff       	jmp    80188f <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  801936:	4c 89 ee             	mov    %r13,%rsi
+  801939:	bf 25 00 00 00       	mov    $0x25,%edi
+  80193e:	41 ff d6             	call   *%r14
+            break;
+  801941:	e9 00 f9 ff ff       	jmp    801246 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801946:	4c 89 ee             	mov    %r13,%rsi
+  801949:	bf 25 00 00 00       	mov    $0x25,%edi
+  80194e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801951:	48 83 eb 01          	sub    $0x1,%rbx
+  801955:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801959:	75 f6                	jne    801951 <vprintfmt+0x73c>
+  80195b:	e9 e6 f8 ff ff       	jmp    801246 <vprintfmt+0x31>
+}
+  801960:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801964:	5b                   	pop    %rbx
+  801965:	41 5c                	pop    %r12
+  801967:	41 5d                	pop    %r13
+  801969:	41 5e                	pop    %r14
+  80196b:	41 5f                	pop    %r15
+  80196d:	5d                   	pop    %rbp
+  80196e:	c3                   	ret
+
+000000000080196f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80196f:	55                   	push   %rbp
+  801970:	48 89 e5             	mov    %rsp,%rbp
+  801973:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801977:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80197b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801980:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801984:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80198b:	48 85 ff             	test   %rdi,%rdi
+  80198e:	74 2b                	je     8019bb <vsnprintf+0x4c>
+  801990:	48 85 f6             	test   %rsi,%rsi
+  801993:	74 26                	je     8019bb <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801995:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801999:	48 bf c0 11 80 00 00 	movabs $0x8011c0,%rdi
+  8019a0:	00 00 00 
+  8019a3:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  8019aa:	00 00 00 
+  8019ad:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8019af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019b3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8019b6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8019b9:	c9                   	leave
+  8019ba:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8019bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019c0:	eb f7                	jmp    8019b9 <vsnprintf+0x4a>
+
+00000000008019c2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8019c2:	55                   	push   %rbp
+  8019c3:	48 89 e5             	mov    %rsp,%rbp
+  8019c6:	48 83 ec 50          	sub    $0x50,%rsp
+  8019ca:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8019ce:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8019d2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8019d6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8019dd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019e5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8019e9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8019ed:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8019f1:	48 b8 6f 19 80 00 00 	movabs $0x80196f,%rax
+  8019f8:	00 00 00 
+  8019fb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8019fd:	c9                   	leave
+  8019fe:	c3                   	ret
+
+00000000008019ff <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8019ff:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801a02:	74 10                	je     801a14 <strlen+0x15>
+    size_t n = 0;
+  801a04:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801a09:	48 83 c0 01          	add    $0x1,%rax
+  801a0d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801a11:	75 f6                	jne    801a09 <strlen+0xa>
+  801a13:	c3                   	ret
+    size_t n = 0;
+  801a14:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801a19:	c3                   	ret
+
+0000000000801a1a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801a1a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801a1d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801a22:	48 85 f6             	test   %rsi,%rsi
+  801a25:	74 11                	je     801a38 <strnlen+0x1e>
+  801a27:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801a2b:	74 0c                	je     801a39 <strnlen+0x1f>
+  801a2d:	48 83 c2 01          	add    $0x1,%rdx
+  801a31:	48 39 d0             	cmp    %rdx,%rax
+  801a34:	75 f1                	jne    801a27 <strnlen+0xd>
+  801a36:	eb 04                	jmp    801a3c <strnlen+0x22>
+  801a38:	c3                   	ret
+  801a39:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801a3c:	c3                   	ret
+
+0000000000801a3d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801a3d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801a40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a45:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801a49:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801a4c:	48 83 c2 01          	add    $0x1,%rdx
+  801a50:	84 c9                	test   %cl,%cl
+  801a52:	75 f1                	jne    801a45 <strcpy+0x8>
+        ;
+    return res;
+}
+  801a54:	c3                   	ret
+
+0000000000801a55 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801a55:	55                   	push   %rbp
+  801a56:	48 89 e5             	mov    %rsp,%rbp
+  801a59:	41 54                	push   %r12
+  801a5b:	53                   	push   %rbx
+  801a5c:	48 89 fb             	mov    %rdi,%rbx
+  801a5f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801a62:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801a69:	00 00 00 
+  801a6c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801a6e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801a72:	4c 89 e6             	mov    %r12,%rsi
+  801a75:	48 b8 3d 1a 80 00 00 	movabs $0x801a3d,%rax
+  801a7c:	00 00 00 
+  801a7f:	ff d0                	call   *%rax
+    return dst;
+}
+  801a81:	48 89 d8             	mov    %rbx,%rax
+  801a84:	5b                   	pop    %rbx
+  801a85:	41 5c                	pop    %r12
+  801a87:	5d                   	pop    %rbp
+  801a88:	c3                   	ret
+
+0000000000801a89 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801a89:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801a8c:	48 85 d2             	test   %rdx,%rdx
+  801a8f:	74 1f                	je     801ab0 <strncpy+0x27>
+  801a91:	48 01 fa             	add    %rdi,%rdx
+  801a94:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801a97:	48 83 c1 01          	add    $0x1,%rcx
+  801a9b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801a9f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801aa3:	41 80 f8 01          	cmp    $0x1,%r8b
+  801aa7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801aab:	48 39 ca             	cmp    %rcx,%rdx
+  801aae:	75 e7                	jne    801a97 <strncpy+0xe>
+    }
+    return ret;
+}
+  801ab0:	c3                   	ret
+
+0000000000801ab1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801ab1:	48 89 f8             	mov    %rdi,%rax
+  801ab4:	48 85 d2             	test   %rdx,%rdx
+  801ab7:	74 24                	je     801add <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801ab9:	48 83 ea 01          	sub    $0x1,%rdx
+  801abd:	74 1b                	je     801ada <strlcpy+0x29>
+  801abf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801ac3:	0f b6 16             	movzbl (%rsi),%edx
+  801ac6:	84 d2                	test   %dl,%dl
+  801ac8:	74 10                	je     801ada <strlcpy+0x29>
+            *dst++ = *src++;
+  801aca:	48 83 c6 01          	add    $0x1,%rsi
+  801ace:	48 83 c0 01          	add    $0x1,%rax
+  801ad2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801ad5:	48 39 c8             	cmp    %rcx,%rax
+  801ad8:	75 e9                	jne    801ac3 <strlcpy+0x12>
+        *dst = '\0';
+  801ada:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801add:	48 29 f8             	sub    %rdi,%rax
+}
+  801ae0:	c3                   	ret
+
+0000000000801ae1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801ae1:	0f b6 07             	movzbl (%rdi),%eax
+  801ae4:	84 c0                	test   %al,%al
+  801ae6:	74 13                	je     801afb <strcmp+0x1a>
+  801ae8:	38 06                	cmp    %al,(%rsi)
+  801aea:	75 0f                	jne    801afb <strcmp+0x1a>
+  801aec:	48 83 c7 01          	add    $0x1,%rdi
+  801af0:	48 83 c6 01          	add    $0x1,%rsi
+  801af4:	0f b6 07             	movzbl (%rdi),%eax
+  801af7:	84 c0                	test   %al,%al
+  801af9:	75 ed                	jne    801ae8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801afb:	0f b6 c0             	movzbl %al,%eax
+  801afe:	0f b6 16             	movzbl (%rsi),%edx
+  801b01:	29 d0                	sub    %edx,%eax
+}
+  801b03:	c3                   	ret
+
+0000000000801b04 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801b04:	48 85 d2             	test   %rdx,%rdx
+  801b07:	74 1f                	je     801b28 <strncmp+0x24>
+  801b09:	0f b6 07             	movzbl (%rdi),%eax
+  801b0c:	84 c0                	test   %al,%al
+  801b0e:	74 1e                	je     801b2e <strncmp+0x2a>
+  801b10:	3a 06                	cmp    (%rsi),%al
+  801b12:	75 1a                	jne    801b2e <strncmp+0x2a>
+  801b14:	48 83 c7 01          	add    $0x1,%rdi
+  801b18:	48 83 c6 01          	add    $0x1,%rsi
+  801b1c:	48 83 ea 01          	sub    $0x1,%rdx
+  801b20:	75 e7                	jne    801b09 <strncmp+0x5>
+
+    if (!n) return 0;
+  801b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b27:	c3                   	ret
+  801b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2d:	c3                   	ret
+  801b2e:	48 85 d2             	test   %rdx,%rdx
+  801b31:	74 09                	je     801b3c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801b33:	0f b6 07             	movzbl (%rdi),%eax
+  801b36:	0f b6 16             	movzbl (%rsi),%edx
+  801b39:	29 d0                	sub    %edx,%eax
+  801b3b:	c3                   	ret
+    if (!n) return 0;
+  801b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b41:	c3                   	ret
+
+0000000000801b42 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801b42:	0f b6 17             	movzbl (%rdi),%edx
+  801b45:	84 d2                	test   %dl,%dl
+  801b47:	74 18                	je     801b61 <strchr+0x1f>
+        if (*str == c) {
+  801b49:	0f be d2             	movsbl %dl,%edx
+  801b4c:	39 f2                	cmp    %esi,%edx
+  801b4e:	74 17                	je     801b67 <strchr+0x25>
+    for (; *str; str++) {
+  801b50:	48 83 c7 01          	add    $0x1,%rdi
+  801b54:	0f b6 17             	movzbl (%rdi),%edx
+  801b57:	84 d2                	test   %dl,%dl
+  801b59:	75 ee                	jne    801b49 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b60:	c3                   	ret
+  801b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b66:	c3                   	ret
+  801b67:	48 89 f8             	mov    %rdi,%rax
+}
+  801b6a:	c3                   	ret
+
+0000000000801b6b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801b6b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801b6e:	0f b6 17             	movzbl (%rdi),%edx
+  801b71:	84 d2                	test   %dl,%dl
+  801b73:	74 13                	je     801b88 <strfind+0x1d>
+  801b75:	0f be d2             	movsbl %dl,%edx
+  801b78:	39 f2                	cmp    %esi,%edx
+  801b7a:	74 0b                	je     801b87 <strfind+0x1c>
+  801b7c:	48 83 c0 01          	add    $0x1,%rax
+  801b80:	0f b6 10             	movzbl (%rax),%edx
+  801b83:	84 d2                	test   %dl,%dl
+  801b85:	75 ee                	jne    801b75 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801b87:	c3                   	ret
+  801b88:	c3                   	ret
+
+0000000000801b89 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  801b89:	55                   	push   %rbp
+  801b8a:	48 89 e5             	mov    %rsp,%rbp
+  801b8d:	41 57                	push   %r15
+  801b8f:	41 56                	push   %r14
+  801b91:	41 55                	push   %r13
+  801b93:	41 54                	push   %r12
+  801b95:	53                   	push   %rbx
+  801b96:	48 83 ec 08          	sub    $0x8,%rsp
+  801b9a:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  801b9d:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  801ba1:	45 84 ed             	test   %r13b,%r13b
+  801ba4:	75 12                	jne    801bb8 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  801ba6:	4c 89 f8             	mov    %r15,%rax
+  801ba9:	48 83 c4 08          	add    $0x8,%rsp
+  801bad:	5b                   	pop    %rbx
+  801bae:	41 5c                	pop    %r12
+  801bb0:	41 5d                	pop    %r13
+  801bb2:	41 5e                	pop    %r14
+  801bb4:	41 5f                	pop    %r15
+  801bb6:	5d                   	pop    %rbp
+  801bb7:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  801bb8:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  801bbc:	4c 89 e7             	mov    %r12,%rdi
+  801bbf:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801bc6:	00 00 00 
+  801bc9:	ff d0                	call   *%rax
+  801bcb:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  801bce:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  801bd2:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  801bd6:	49 bf 04 1b 80 00 00 	movabs $0x801b04,%r15
+  801bdd:	00 00 00 
+				if ((sc = *s++) == 0)
+  801be0:	84 c0                	test   %al,%al
+  801be2:	75 14                	jne    801bf8 <strstr+0x6f>
+					return NULL;
+  801be4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801bea:	eb ba                	jmp    801ba6 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  801bec:	48 83 c3 01          	add    $0x1,%rbx
+  801bf0:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  801bf4:	84 c0                	test   %al,%al
+  801bf6:	74 1b                	je     801c13 <strstr+0x8a>
+			} while (sc != c);
+  801bf8:	41 38 c5             	cmp    %al,%r13b
+  801bfb:	75 ef                	jne    801bec <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  801bfd:	4c 89 f2             	mov    %r14,%rdx
+  801c00:	4c 89 e6             	mov    %r12,%rsi
+  801c03:	48 89 df             	mov    %rbx,%rdi
+  801c06:	41 ff d7             	call   *%r15
+  801c09:	85 c0                	test   %eax,%eax
+  801c0b:	75 df                	jne    801bec <strstr+0x63>
+  801c0d:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  801c11:	eb 93                	jmp    801ba6 <strstr+0x1d>
+					return NULL;
+  801c13:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801c19:	eb 8b                	jmp    801ba6 <strstr+0x1d>
+
+0000000000801c1b <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  801c1b:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  801c1d:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  801c20:	8d 57 20             	lea    0x20(%rdi),%edx
+  801c23:	83 f9 1a             	cmp    $0x1a,%ecx
+  801c26:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801c29:	c3                   	ret
+
+0000000000801c2a <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  801c2a:	55                   	push   %rbp
+  801c2b:	48 89 e5             	mov    %rsp,%rbp
+  801c2e:	41 57                	push   %r15
+  801c30:	41 56                	push   %r14
+  801c32:	41 55                	push   %r13
+  801c34:	41 54                	push   %r12
+  801c36:	53                   	push   %rbx
+  801c37:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  801c3b:	48 39 f7             	cmp    %rsi,%rdi
+  801c3e:	74 49                	je     801c89 <strcasecmp+0x5f>
+  801c40:	49 89 fd             	mov    %rdi,%r13
+  801c43:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  801c46:	49 bf 1b 1c 80 00 00 	movabs $0x801c1b,%r15
+  801c4d:	00 00 00 
+  801c50:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801c55:	41 0f b6 fe          	movzbl %r14b,%edi
+  801c59:	41 ff d7             	call   *%r15
+  801c5c:	89 c3                	mov    %eax,%ebx
+  801c5e:	49 83 c4 01          	add    $0x1,%r12
+  801c62:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801c68:	41 ff d7             	call   *%r15
+  801c6b:	29 c3                	sub    %eax,%ebx
+  801c6d:	75 09                	jne    801c78 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  801c6f:	49 83 c5 01          	add    $0x1,%r13
+  801c73:	45 84 f6             	test   %r14b,%r14b
+  801c76:	75 d8                	jne    801c50 <strcasecmp+0x26>
+}
+  801c78:	89 d8                	mov    %ebx,%eax
+  801c7a:	48 83 c4 08          	add    $0x8,%rsp
+  801c7e:	5b                   	pop    %rbx
+  801c7f:	41 5c                	pop    %r12
+  801c81:	41 5d                	pop    %r13
+  801c83:	41 5e                	pop    %r14
+  801c85:	41 5f                	pop    %r15
+  801c87:	5d                   	pop    %rbp
+  801c88:	c3                   	ret
+        return 0;
+  801c89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8e:	eb e8                	jmp    801c78 <strcasecmp+0x4e>
+
+0000000000801c90 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  801c90:	55                   	push   %rbp
+  801c91:	48 89 e5             	mov    %rsp,%rbp
+  801c94:	41 57                	push   %r15
+  801c96:	41 56                	push   %r14
+  801c98:	41 55                	push   %r13
+  801c9a:	41 54                	push   %r12
+  801c9c:	53                   	push   %rbx
+  801c9d:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  801ca1:	48 85 d2             	test   %rdx,%rdx
+  801ca4:	74 4f                	je     801cf5 <strncasecmp+0x65>
+  801ca6:	49 89 fc             	mov    %rdi,%r12
+  801ca9:	49 89 f5             	mov    %rsi,%r13
+  801cac:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  801cb0:	49 be 1b 1c 80 00 00 	movabs $0x801c1b,%r14
+  801cb7:	00 00 00 
+  801cba:	49 83 c4 01          	add    $0x1,%r12
+  801cbe:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801cc4:	41 ff d6             	call   *%r14
+  801cc7:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  801cc9:	49 83 c5 01          	add    $0x1,%r13
+  801ccd:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801cd2:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801cd5:	29 c3                	sub    %eax,%ebx
+  801cd7:	85 c0                	test   %eax,%eax
+  801cd9:	74 09                	je     801ce4 <strncasecmp+0x54>
+  801cdb:	85 db                	test   %ebx,%ebx
+  801cdd:	75 05                	jne    801ce4 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  801cdf:	4d 39 fc             	cmp    %r15,%r12
+  801ce2:	75 d6                	jne    801cba <strncasecmp+0x2a>
+}
+  801ce4:	89 d8                	mov    %ebx,%eax
+  801ce6:	48 83 c4 08          	add    $0x8,%rsp
+  801cea:	5b                   	pop    %rbx
+  801ceb:	41 5c                	pop    %r12
+  801ced:	41 5d                	pop    %r13
+  801cef:	41 5e                	pop    %r14
+  801cf1:	41 5f                	pop    %r15
+  801cf3:	5d                   	pop    %rbp
+  801cf4:	c3                   	ret
+    int d = 0;
+  801cf5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  801cfa:	eb e8                	jmp    801ce4 <strncasecmp+0x54>
+
+0000000000801cfc <toupper>:
+
+int toupper(int c) {
+  801cfc:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  801cfe:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801d01:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801d04:	83 f9 1a             	cmp    $0x1a,%ecx
+  801d07:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801d0a:	c3                   	ret
+
+0000000000801d0b <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  801d0b:	83 ff 20             	cmp    $0x20,%edi
+  801d0e:	0f 94 c0             	sete   %al
+  801d11:	0f b6 c0             	movzbl %al,%eax
+}
+  801d14:	c3                   	ret
+
+0000000000801d15 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  801d15:	89 f8                	mov    %edi,%eax
+  801d17:	f7 d8                	neg    %eax
+  801d19:	0f 48 c7             	cmovs  %edi,%eax
+}
+  801d1c:	c3                   	ret
+
+0000000000801d1d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801d1d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801d20:	48 89 f8             	mov    %rdi,%rax
+  801d23:	48 f7 d8             	neg    %rax
+  801d26:	83 e0 07             	and    $0x7,%eax
+  801d29:	49 89 d1             	mov    %rdx,%r9
+  801d2c:	49 29 c1             	sub    %rax,%r9
+  801d2f:	78 36                	js     801d67 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801d31:	40 0f b6 c6          	movzbl %sil,%eax
+  801d35:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801d3c:	01 01 01 
+  801d3f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801d43:	40 f6 c7 07          	test   $0x7,%dil
+  801d47:	75 38                	jne    801d81 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801d49:	4c 89 c9             	mov    %r9,%rcx
+  801d4c:	48 c1 f9 03          	sar    $0x3,%rcx
+  801d50:	74 0c                	je     801d5e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801d52:	fc                   	cld
+  801d53:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801d56:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801d5a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801d5e:	4d 85 c9             	test   %r9,%r9
+  801d61:	75 45                	jne    801da8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801d63:	4c 89 c0             	mov    %r8,%rax
+  801d66:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801d67:	48 85 d2             	test   %rdx,%rdx
+  801d6a:	74 f7                	je     801d63 <memset+0x46>
+  801d6c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801d6f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801d72:	48 83 c0 01          	add    $0x1,%rax
+  801d76:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801d7a:	48 39 c2             	cmp    %rax,%rdx
+  801d7d:	75 f3                	jne    801d72 <memset+0x55>
+  801d7f:	eb e2                	jmp    801d63 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801d81:	40 f6 c7 01          	test   $0x1,%dil
+  801d85:	74 06                	je     801d8d <memset+0x70>
+  801d87:	88 07                	mov    %al,(%rdi)
+  801d89:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801d8d:	40 f6 c7 02          	test   $0x2,%dil
+  801d91:	74 07                	je     801d9a <memset+0x7d>
+  801d93:	66 89 07             	mov    %ax,(%rdi)
+  801d96:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801d9a:	40 f6 c7 04          	test   $0x4,%dil
+  801d9e:	74 a9                	je     801d49 <memset+0x2c>
+  801da0:	89 07                	mov    %eax,(%rdi)
+  801da2:	48 83 c7 04          	add    $0x4,%rdi
+  801da6:	eb a1                	jmp    801d49 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801da8:	41 f6 c1 04          	test   $0x4,%r9b
+  801dac:	74 06                	je     801db4 <memset+0x97>
+  801dae:	89 07                	mov    %eax,(%rdi)
+  801db0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801db4:	41 f6 c1 02          	test   $0x2,%r9b
+  801db8:	74 07                	je     801dc1 <memset+0xa4>
+  801dba:	66 89 07             	mov    %ax,(%rdi)
+  801dbd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801dc1:	41 f6 c1 01          	test   $0x1,%r9b
+  801dc5:	74 9c                	je     801d63 <memset+0x46>
+  801dc7:	88 07                	mov    %al,(%rdi)
+  801dc9:	eb 98                	jmp    801d63 <memset+0x46>
+
+0000000000801dcb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801dcb:	48 89 f8             	mov    %rdi,%rax
+  801dce:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801dd1:	48 39 fe             	cmp    %rdi,%rsi
+  801dd4:	73 3b                	jae    801e11 <memmove+0x46>
+  801dd6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801dda:	48 39 d7             	cmp    %rdx,%rdi
+  801ddd:	73 32                	jae    801e11 <memmove+0x46>
+        s += n;
+        d += n;
+  801ddf:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801de3:	48 89 d6             	mov    %rdx,%rsi
+  801de6:	48 09 fe             	or     %rdi,%rsi
+  801de9:	48 09 ce             	or     %rcx,%rsi
+  801dec:	40 f6 c6 07          	test   $0x7,%sil
+  801df0:	75 12                	jne    801e04 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801df2:	48 83 ef 08          	sub    $0x8,%rdi
+  801df6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801dfa:	48 c1 e9 03          	shr    $0x3,%rcx
+  801dfe:	fd                   	std
+  801dff:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801e02:	fc                   	cld
+  801e03:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801e04:	48 83 ef 01          	sub    $0x1,%rdi
+  801e08:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801e0c:	fd                   	std
+  801e0d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801e0f:	eb f1                	jmp    801e02 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801e11:	48 89 f2             	mov    %rsi,%rdx
+  801e14:	48 09 c2             	or     %rax,%rdx
+  801e17:	48 09 ca             	or     %rcx,%rdx
+  801e1a:	f6 c2 07             	test   $0x7,%dl
+  801e1d:	75 0c                	jne    801e2b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801e1f:	48 c1 e9 03          	shr    $0x3,%rcx
+  801e23:	48 89 c7             	mov    %rax,%rdi
+  801e26:	fc                   	cld
+  801e27:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801e2a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801e2b:	48 89 c7             	mov    %rax,%rdi
+  801e2e:	fc                   	cld
+  801e2f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801e31:	c3                   	ret
+
+0000000000801e32 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801e32:	55                   	push   %rbp
+  801e33:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801e36:	48 b8 cb 1d 80 00 00 	movabs $0x801dcb,%rax
+  801e3d:	00 00 00 
+  801e40:	ff d0                	call   *%rax
+}
+  801e42:	5d                   	pop    %rbp
+  801e43:	c3                   	ret
+
+0000000000801e44 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801e44:	55                   	push   %rbp
+  801e45:	48 89 e5             	mov    %rsp,%rbp
+  801e48:	41 57                	push   %r15
+  801e4a:	41 56                	push   %r14
+  801e4c:	41 55                	push   %r13
+  801e4e:	41 54                	push   %r12
+  801e50:	53                   	push   %rbx
+  801e51:	48 83 ec 08          	sub    $0x8,%rsp
+  801e55:	49 89 fe             	mov    %rdi,%r14
+  801e58:	49 89 f7             	mov    %rsi,%r15
+  801e5b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801e5e:	48 89 f7             	mov    %rsi,%rdi
+  801e61:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801e68:	00 00 00 
+  801e6b:	ff d0                	call   *%rax
+  801e6d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801e70:	48 89 de             	mov    %rbx,%rsi
+  801e73:	4c 89 f7             	mov    %r14,%rdi
+  801e76:	48 b8 1a 1a 80 00 00 	movabs $0x801a1a,%rax
+  801e7d:	00 00 00 
+  801e80:	ff d0                	call   *%rax
+  801e82:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801e85:	48 39 c3             	cmp    %rax,%rbx
+  801e88:	74 36                	je     801ec0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801e8a:	48 89 d8             	mov    %rbx,%rax
+  801e8d:	4c 29 e8             	sub    %r13,%rax
+  801e90:	49 39 c4             	cmp    %rax,%r12
+  801e93:	73 31                	jae    801ec6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801e95:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801e9a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801e9e:	4c 89 fe             	mov    %r15,%rsi
+  801ea1:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  801ea8:	00 00 00 
+  801eab:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801ead:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801eb1:	48 83 c4 08          	add    $0x8,%rsp
+  801eb5:	5b                   	pop    %rbx
+  801eb6:	41 5c                	pop    %r12
+  801eb8:	41 5d                	pop    %r13
+  801eba:	41 5e                	pop    %r14
+  801ebc:	41 5f                	pop    %r15
+  801ebe:	5d                   	pop    %rbp
+  801ebf:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801ec0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801ec4:	eb eb                	jmp    801eb1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801ec6:	48 83 eb 01          	sub    $0x1,%rbx
+  801eca:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801ece:	48 89 da             	mov    %rbx,%rdx
+  801ed1:	4c 89 fe             	mov    %r15,%rsi
+  801ed4:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  801edb:	00 00 00 
+  801ede:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801ee0:	49 01 de             	add    %rbx,%r14
+  801ee3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801ee8:	eb c3                	jmp    801ead <strlcat+0x69>
+
+0000000000801eea <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801eea:	48 85 d2             	test   %rdx,%rdx
+  801eed:	74 2d                	je     801f1c <memcmp+0x32>
+  801eef:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801ef4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801ef8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801efd:	44 38 c1             	cmp    %r8b,%cl
+  801f00:	75 0f                	jne    801f11 <memcmp+0x27>
+    while (n-- > 0) {
+  801f02:	48 83 c0 01          	add    $0x1,%rax
+  801f06:	48 39 c2             	cmp    %rax,%rdx
+  801f09:	75 e9                	jne    801ef4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f10:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801f11:	0f b6 c1             	movzbl %cl,%eax
+  801f14:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801f18:	44 29 c0             	sub    %r8d,%eax
+  801f1b:	c3                   	ret
+    return 0;
+  801f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f21:	c3                   	ret
+
+0000000000801f22 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801f22:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801f26:	48 39 c7             	cmp    %rax,%rdi
+  801f29:	73 0f                	jae    801f3a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801f2b:	40 38 37             	cmp    %sil,(%rdi)
+  801f2e:	74 0e                	je     801f3e <memfind+0x1c>
+    for (; src < end; src++) {
+  801f30:	48 83 c7 01          	add    $0x1,%rdi
+  801f34:	48 39 f8             	cmp    %rdi,%rax
+  801f37:	75 f2                	jne    801f2b <memfind+0x9>
+  801f39:	c3                   	ret
+  801f3a:	48 89 f8             	mov    %rdi,%rax
+  801f3d:	c3                   	ret
+  801f3e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801f41:	c3                   	ret
+
+0000000000801f42 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801f42:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801f45:	0f b6 37             	movzbl (%rdi),%esi
+  801f48:	40 80 fe 20          	cmp    $0x20,%sil
+  801f4c:	74 06                	je     801f54 <strtol+0x12>
+  801f4e:	40 80 fe 09          	cmp    $0x9,%sil
+  801f52:	75 13                	jne    801f67 <strtol+0x25>
+  801f54:	48 83 c7 01          	add    $0x1,%rdi
+  801f58:	0f b6 37             	movzbl (%rdi),%esi
+  801f5b:	40 80 fe 20          	cmp    $0x20,%sil
+  801f5f:	74 f3                	je     801f54 <strtol+0x12>
+  801f61:	40 80 fe 09          	cmp    $0x9,%sil
+  801f65:	74 ed                	je     801f54 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801f67:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801f6a:	83 e0 fd             	and    $0xfffffffd,%eax
+  801f6d:	3c 01                	cmp    $0x1,%al
+  801f6f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801f73:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801f79:	75 0f                	jne    801f8a <strtol+0x48>
+  801f7b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801f7e:	74 14                	je     801f94 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801f80:	85 d2                	test   %edx,%edx
+  801f82:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801f87:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801f8f:	4c 63 ca             	movslq %edx,%r9
+  801f92:	eb 36                	jmp    801fca <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801f94:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801f98:	74 0f                	je     801fa9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801f9a:	85 d2                	test   %edx,%edx
+  801f9c:	75 ec                	jne    801f8a <strtol+0x48>
+        s++;
+  801f9e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801fa2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801fa7:	eb e1                	jmp    801f8a <strtol+0x48>
+        s += 2;
+  801fa9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801fad:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801fb2:	eb d6                	jmp    801f8a <strtol+0x48>
+            dig -= '0';
+  801fb4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801fb7:	44 0f b6 c1          	movzbl %cl,%r8d
+  801fbb:	41 39 d0             	cmp    %edx,%r8d
+  801fbe:	7d 21                	jge    801fe1 <strtol+0x9f>
+        val = val * base + dig;
+  801fc0:	49 0f af c1          	imul   %r9,%rax
+  801fc4:	0f b6 c9             	movzbl %cl,%ecx
+  801fc7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801fca:	48 83 c7 01          	add    $0x1,%rdi
+  801fce:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801fd2:	80 f9 39             	cmp    $0x39,%cl
+  801fd5:	76 dd                	jbe    801fb4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801fd7:	80 f9 7b             	cmp    $0x7b,%cl
+  801fda:	77 05                	ja     801fe1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801fdc:	83 e9 57             	sub    $0x57,%ecx
+  801fdf:	eb d6                	jmp    801fb7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801fe1:	4d 85 d2             	test   %r10,%r10
+  801fe4:	74 03                	je     801fe9 <strtol+0xa7>
+  801fe6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801fe9:	48 89 c2             	mov    %rax,%rdx
+  801fec:	48 f7 da             	neg    %rdx
+  801fef:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801ff3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801ff7:	c3                   	ret
+
+0000000000801ff8 <atoi>:
+int atoi(const char *str) {
+  801ff8:	55                   	push   %rbp
+  801ff9:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801ffc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802001:	be 00 00 00 00       	mov    $0x0,%esi
+  802006:	48 b8 42 1f 80 00 00 	movabs $0x801f42,%rax
+  80200d:	00 00 00 
+  802010:	ff d0                	call   *%rax
+}
+  802012:	5d                   	pop    %rbp
+  802013:	c3                   	ret
+
+0000000000802014 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802014:	55                   	push   %rbp
+  802015:	48 89 e5             	mov    %rsp,%rbp
+  802018:	53                   	push   %rbx
+  802019:	48 89 fa             	mov    %rdi,%rdx
+  80201c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80201f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802024:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802029:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80202e:	be 00 00 00 00       	mov    $0x0,%esi
+  802033:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802039:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80203b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80203f:	c9                   	leave
+  802040:	c3                   	ret
+
+0000000000802041 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802041:	55                   	push   %rbp
+  802042:	48 89 e5             	mov    %rsp,%rbp
+  802045:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802046:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80204b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802050:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802055:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80205a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80205f:	be 00 00 00 00       	mov    $0x0,%esi
+  802064:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80206a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80206c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802070:	c9                   	leave
+  802071:	c3                   	ret
+
+0000000000802072 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802072:	55                   	push   %rbp
+  802073:	48 89 e5             	mov    %rsp,%rbp
+  802076:	53                   	push   %rbx
+  802077:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80207b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80207e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802083:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802088:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80208d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802092:	be 00 00 00 00       	mov    $0x0,%esi
+  802097:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80209d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80209f:	48 85 c0             	test   %rax,%rax
+  8020a2:	7f 06                	jg     8020aa <sys_env_destroy+0x38>
+}
+  8020a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020a8:	c9                   	leave
+  8020a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020aa:	49 89 c0             	mov    %rax,%r8
+  8020ad:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8020b2:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  8020b9:	00 00 00 
+  8020bc:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8020c1:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  8020c8:	00 00 00 
+  8020cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d0:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  8020d7:	00 00 00 
+  8020da:	41 ff d1             	call   *%r9
+
+00000000008020dd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8020dd:	55                   	push   %rbp
+  8020de:	48 89 e5             	mov    %rsp,%rbp
+  8020e1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8020e2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8020e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802100:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802106:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  802108:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80210c:	c9                   	leave
+  80210d:	c3                   	ret
+
+000000000080210e <sys_yield>:
+
+void
+sys_yield(void) {
+  80210e:	55                   	push   %rbp
+  80210f:	48 89 e5             	mov    %rsp,%rbp
+  802112:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802113:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802122:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802127:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80212c:	be 00 00 00 00       	mov    $0x0,%esi
+  802131:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802137:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  802139:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80213d:	c9                   	leave
+  80213e:	c3                   	ret
+
+000000000080213f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80213f:	55                   	push   %rbp
+  802140:	48 89 e5             	mov    %rsp,%rbp
+  802143:	53                   	push   %rbx
+  802144:	48 89 fa             	mov    %rdi,%rdx
+  802147:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80214a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80214f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802156:	00 00 00 
+  802159:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80215e:	be 00 00 00 00       	mov    $0x0,%esi
+  802163:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802169:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80216b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80216f:	c9                   	leave
+  802170:	c3                   	ret
+
+0000000000802171 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802171:	55                   	push   %rbp
+  802172:	48 89 e5             	mov    %rsp,%rbp
+  802175:	53                   	push   %rbx
+  802176:	49 89 f8             	mov    %rdi,%r8
+  802179:	48 89 d3             	mov    %rdx,%rbx
+  80217c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80217f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802184:	4c 89 c2             	mov    %r8,%rdx
+  802187:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80218a:	be 00 00 00 00       	mov    $0x0,%esi
+  80218f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802195:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  802197:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80219b:	c9                   	leave
+  80219c:	c3                   	ret
+
+000000000080219d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80219d:	55                   	push   %rbp
+  80219e:	48 89 e5             	mov    %rsp,%rbp
+  8021a1:	53                   	push   %rbx
+  8021a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a6:	89 f8                	mov    %edi,%eax
+  8021a8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8021ab:	48 63 f9             	movslq %ecx,%rdi
+  8021ae:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8021b1:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8021b6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8021c6:	48 85 c0             	test   %rax,%rax
+  8021c9:	7f 06                	jg     8021d1 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8021cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021cf:	c9                   	leave
+  8021d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8021d1:	49 89 c0             	mov    %rax,%r8
+  8021d4:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8021d9:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  8021e0:	00 00 00 
+  8021e3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8021e8:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  8021ef:	00 00 00 
+  8021f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f7:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  8021fe:	00 00 00 
+  802201:	41 ff d1             	call   *%r9
+
+0000000000802204 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802204:	55                   	push   %rbp
+  802205:	48 89 e5             	mov    %rsp,%rbp
+  802208:	53                   	push   %rbx
+  802209:	48 83 ec 08          	sub    $0x8,%rsp
+  80220d:	89 f8                	mov    %edi,%eax
+  80220f:	49 89 f2             	mov    %rsi,%r10
+  802212:	48 89 cf             	mov    %rcx,%rdi
+  802215:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  802218:	48 63 da             	movslq %edx,%rbx
+  80221b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80221e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802223:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802226:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  802229:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80222b:	48 85 c0             	test   %rax,%rax
+  80222e:	7f 06                	jg     802236 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802230:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802234:	c9                   	leave
+  802235:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802236:	49 89 c0             	mov    %rax,%r8
+  802239:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80223e:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  802245:	00 00 00 
+  802248:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80224d:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  802254:	00 00 00 
+  802257:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225c:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  802263:	00 00 00 
+  802266:	41 ff d1             	call   *%r9
+
+0000000000802269 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802269:	55                   	push   %rbp
+  80226a:	48 89 e5             	mov    %rsp,%rbp
+  80226d:	53                   	push   %rbx
+  80226e:	48 83 ec 08          	sub    $0x8,%rsp
+  802272:	49 89 f9             	mov    %rdi,%r9
+  802275:	89 f0                	mov    %esi,%eax
+  802277:	48 89 d3             	mov    %rdx,%rbx
+  80227a:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80227d:	49 63 f0             	movslq %r8d,%rsi
+  802280:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802283:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802288:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80228b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802291:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802293:	48 85 c0             	test   %rax,%rax
+  802296:	7f 06                	jg     80229e <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802298:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80229c:	c9                   	leave
+  80229d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80229e:	49 89 c0             	mov    %rax,%r8
+  8022a1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8022a6:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  8022ad:	00 00 00 
+  8022b0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8022b5:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  8022bc:	00 00 00 
+  8022bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c4:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  8022cb:	00 00 00 
+  8022ce:	41 ff d1             	call   *%r9
+
+00000000008022d1 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8022d1:	55                   	push   %rbp
+  8022d2:	48 89 e5             	mov    %rsp,%rbp
+  8022d5:	53                   	push   %rbx
+  8022d6:	89 f8                	mov    %edi,%eax
+  8022d8:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8022db:	48 63 f9             	movslq %ecx,%rdi
+  8022de:	48 63 da             	movslq %edx,%rbx
+  8022e1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8022e4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8022e9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8022ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8022f7:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8022f9:	89 c2                	mov    %eax,%edx
+  8022fb:	48 85 c0             	test   %rax,%rax
+  8022fe:	78 0d                	js     80230d <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  802300:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  802305:	4d 85 c9             	test   %r9,%r9
+  802308:	74 03                	je     80230d <sys_alloc_dma_region+0x3c>
+  80230a:	49 89 01             	mov    %rax,(%r9)
+}
+  80230d:	89 d0                	mov    %edx,%eax
+  80230f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802313:	c9                   	leave
+  802314:	c3                   	ret
+
+0000000000802315 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  802315:	55                   	push   %rbp
+  802316:	48 89 e5             	mov    %rsp,%rbp
+  802319:	53                   	push   %rbx
+  80231a:	48 83 ec 08          	sub    $0x8,%rsp
+  80231e:	48 89 f1             	mov    %rsi,%rcx
+  802321:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  802324:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802327:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80232c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802331:	be 00 00 00 00       	mov    $0x0,%esi
+  802336:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80233c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80233e:	48 85 c0             	test   %rax,%rax
+  802341:	7f 06                	jg     802349 <sys_set_cache_region+0x34>
+}
+  802343:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802347:	c9                   	leave
+  802348:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802349:	49 89 c0             	mov    %rax,%r8
+  80234c:	b9 08 00 00 00       	mov    $0x8,%ecx
+  802351:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  802358:	00 00 00 
+  80235b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802360:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  802367:	00 00 00 
+  80236a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236f:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  802376:	00 00 00 
+  802379:	41 ff d1             	call   *%r9
+
+000000000080237c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80237c:	55                   	push   %rbp
+  80237d:	48 89 e5             	mov    %rsp,%rbp
+  802380:	53                   	push   %rbx
+  802381:	48 83 ec 08          	sub    $0x8,%rsp
+  802385:	48 89 f1             	mov    %rsi,%rcx
+  802388:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80238b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80238e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802393:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802398:	be 00 00 00 00       	mov    $0x0,%esi
+  80239d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8023a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8023a5:	48 85 c0             	test   %rax,%rax
+  8023a8:	7f 06                	jg     8023b0 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8023aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023ae:	c9                   	leave
+  8023af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8023b0:	49 89 c0             	mov    %rax,%r8
+  8023b3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8023b8:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  8023bf:	00 00 00 
+  8023c2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8023c7:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  8023ce:	00 00 00 
+  8023d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d6:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  8023dd:	00 00 00 
+  8023e0:	41 ff d1             	call   *%r9
+
+00000000008023e3 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8023e3:	55                   	push   %rbp
+  8023e4:	48 89 e5             	mov    %rsp,%rbp
+  8023e7:	53                   	push   %rbx
+  8023e8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8023ec:	48 63 ce             	movslq %esi,%rcx
+  8023ef:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8023f2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8023f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802401:	be 00 00 00 00       	mov    $0x0,%esi
+  802406:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80240c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80240e:	48 85 c0             	test   %rax,%rax
+  802411:	7f 06                	jg     802419 <sys_env_set_status+0x36>
+}
+  802413:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802417:	c9                   	leave
+  802418:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802419:	49 89 c0             	mov    %rax,%r8
+  80241c:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  802421:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  802428:	00 00 00 
+  80242b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802430:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  802437:	00 00 00 
+  80243a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243f:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  802446:	00 00 00 
+  802449:	41 ff d1             	call   *%r9
+
+000000000080244c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80244c:	55                   	push   %rbp
+  80244d:	48 89 e5             	mov    %rsp,%rbp
+  802450:	53                   	push   %rbx
+  802451:	48 83 ec 08          	sub    $0x8,%rsp
+  802455:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  802458:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80245b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802460:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802465:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80246a:	be 00 00 00 00       	mov    $0x0,%esi
+  80246f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802475:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802477:	48 85 c0             	test   %rax,%rax
+  80247a:	7f 06                	jg     802482 <sys_env_set_trapframe+0x36>
+}
+  80247c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802480:	c9                   	leave
+  802481:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802482:	49 89 c0             	mov    %rax,%r8
+  802485:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80248a:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  802491:	00 00 00 
+  802494:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802499:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  8024a0:	00 00 00 
+  8024a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a8:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  8024af:	00 00 00 
+  8024b2:	41 ff d1             	call   *%r9
+
+00000000008024b5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8024b5:	55                   	push   %rbp
+  8024b6:	48 89 e5             	mov    %rsp,%rbp
+  8024b9:	53                   	push   %rbx
+  8024ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8024be:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8024c1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8024c4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8024c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8024d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8024de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8024e0:	48 85 c0             	test   %rax,%rax
+  8024e3:	7f 06                	jg     8024eb <sys_env_set_pgfault_upcall+0x36>
+}
+  8024e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024e9:	c9                   	leave
+  8024ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8024eb:	49 89 c0             	mov    %rax,%r8
+  8024ee:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8024f3:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  8024fa:	00 00 00 
+  8024fd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802502:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  802509:	00 00 00 
+  80250c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802511:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  802518:	00 00 00 
+  80251b:	41 ff d1             	call   *%r9
+
+000000000080251e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80251e:	55                   	push   %rbp
+  80251f:	48 89 e5             	mov    %rsp,%rbp
+  802522:	53                   	push   %rbx
+  802523:	89 f8                	mov    %edi,%eax
+  802525:	49 89 f1             	mov    %rsi,%r9
+  802528:	48 89 d3             	mov    %rdx,%rbx
+  80252b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80252e:	49 63 f0             	movslq %r8d,%rsi
+  802531:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802534:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802539:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80253c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802542:	cd 30                	int    $0x30
+}
+  802544:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802548:	c9                   	leave
+  802549:	c3                   	ret
+
+000000000080254a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80254a:	55                   	push   %rbp
+  80254b:	48 89 e5             	mov    %rsp,%rbp
+  80254e:	53                   	push   %rbx
+  80254f:	48 83 ec 08          	sub    $0x8,%rsp
+  802553:	48 89 fa             	mov    %rdi,%rdx
+  802556:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802559:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80255e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802563:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802568:	be 00 00 00 00       	mov    $0x0,%esi
+  80256d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802573:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802575:	48 85 c0             	test   %rax,%rax
+  802578:	7f 06                	jg     802580 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80257a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80257e:	c9                   	leave
+  80257f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802580:	49 89 c0             	mov    %rax,%r8
+  802583:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802588:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  80258f:	00 00 00 
+  802592:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802597:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  80259e:	00 00 00 
+  8025a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a6:	49 b9 75 0f 80 00 00 	movabs $0x800f75,%r9
+  8025ad:	00 00 00 
+  8025b0:	41 ff d1             	call   *%r9
+
+00000000008025b3 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8025b3:	55                   	push   %rbp
+  8025b4:	48 89 e5             	mov    %rsp,%rbp
+  8025b7:	53                   	push   %rbx
+  8025b8:	48 89 fa             	mov    %rdi,%rdx
+  8025bb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8025be:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8025cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8025d8:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8025da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025de:	c9                   	leave
+  8025df:	c3                   	ret
+
+00000000008025e0 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8025e0:	55                   	push   %rbp
+  8025e1:	48 89 e5             	mov    %rsp,%rbp
+  8025e4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8025e5:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8025fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802603:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802609:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80260b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80260f:	c9                   	leave
+  802610:	c3                   	ret
+
+0000000000802611 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  802611:	48 85 ff             	test   %rdi,%rdi
+  802614:	0f 84 b6 01 00 00    	je     8027d0 <malloc+0x1bf>
+malloc(size_t size) {
+  80261a:	55                   	push   %rbp
+  80261b:	48 89 e5             	mov    %rsp,%rbp
+  80261e:	41 56                	push   %r14
+  802620:	41 55                	push   %r13
+  802622:	41 54                	push   %r12
+  802624:	53                   	push   %rbx
+  802625:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  802628:	48 b8 68 00 85 00 00 	movabs $0x850068,%rax
+  80262f:	00 00 00 
+  802632:	4c 8b 20             	mov    (%rax),%r12
+  802635:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80263c:	0f 87 94 01 00 00    	ja     8027d6 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  802642:	48 a1 60 00 85 00 00 	movabs 0x850060,%rax
+  802649:	00 00 00 
+  80264c:	48 85 c0             	test   %rax,%rax
+  80264f:	74 6b                	je     8026bc <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  802651:	4d 85 e4             	test   %r12,%r12
+  802654:	74 66                	je     8026bc <malloc+0xab>
+  802656:	48 ba 88 00 85 00 00 	movabs $0x850088,%rdx
+  80265d:	00 00 00 
+  802660:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802665:	eb 0d                	jmp    802674 <malloc+0x63>
+  802667:	48 83 c1 01          	add    $0x1,%rcx
+  80266b:	48 83 c2 18          	add    $0x18,%rdx
+  80266f:	49 39 cc             	cmp    %rcx,%r12
+  802672:	74 48                	je     8026bc <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  802674:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  802679:	74 ec                	je     802667 <malloc+0x56>
+  80267b:	48 39 1a             	cmp    %rbx,(%rdx)
+  80267e:	72 e7                	jb     802667 <malloc+0x56>
+                real_freep_size--;
+  802680:	48 83 e8 01          	sub    $0x1,%rax
+  802684:	48 a3 60 00 85 00 00 	movabs %rax,0x850060
+  80268b:	00 00 00 
+                freep[i].is_free = false;
+  80268e:	48 ba 80 00 85 00 00 	movabs $0x850080,%rdx
+  802695:	00 00 00 
+  802698:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80269c:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8026a0:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8026a4:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8026ab:	00 
+                freep[i].size = size;
+  8026ac:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8026b0:	48 01 c8             	add    %rcx,%rax
+  8026b3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8026b7:	e9 0b 01 00 00       	jmp    8027c7 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8026bc:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8026c3:	00 00 00 
+  8026c6:	48 01 d8             	add    %rbx,%rax
+  8026c9:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8026cf:	76 7c                	jbe    80274d <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8026d1:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8026d8:	00 00 00 
+  8026db:	4c 8b 30             	mov    (%rax),%r14
+  8026de:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8026e5:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8026e8:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8026ef:	00 00 00 
+  8026f2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8026f9:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  802700:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802706:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80270a:	48 b8 dd 20 80 00 00 	movabs $0x8020dd,%rax
+  802711:	00 00 00 
+  802714:	ff d0                	call   *%rax
+  802716:	89 c7                	mov    %eax,%edi
+  802718:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80271f:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802726:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80272d:	00 00 00 
+  802730:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  802734:	b9 26 00 00 00       	mov    $0x26,%ecx
+  802739:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  802740:	00 00 00 
+  802743:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  802745:	85 c0                	test   %eax,%eax
+  802747:	0f 88 90 00 00 00    	js     8027dd <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80274d:	48 b9 28 70 80 00 00 	movabs $0x807028,%rcx
+  802754:	00 00 00 
+  802757:	48 8b 31             	mov    (%rcx),%rsi
+  80275a:	48 bf 20 70 80 00 00 	movabs $0x807020,%rdi
+  802761:	00 00 00 
+  802764:	4c 8b 07             	mov    (%rdi),%r8
+  802767:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80276b:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  802772:	00 00 00 
+  802775:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  802779:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80277d:	48 b8 80 00 85 00 00 	movabs $0x850080,%rax
+  802784:	00 00 00 
+  802787:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80278b:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80278e:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  802792:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802799:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  80279a:	48 89 d8             	mov    %rbx,%rax
+  80279d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8027a2:	4c 01 c0             	add    %r8,%rax
+  8027a5:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8027a8:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8027af:	48 01 f3             	add    %rsi,%rbx
+  8027b2:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8027b5:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8027ba:	48 a3 68 00 85 00 00 	movabs %rax,0x850068
+  8027c1:	00 00 00 
+  8027c4:	48 89 d0             	mov    %rdx,%rax
+}
+  8027c7:	5b                   	pop    %rbx
+  8027c8:	41 5c                	pop    %r12
+  8027ca:	41 5d                	pop    %r13
+  8027cc:	41 5e                	pop    %r14
+  8027ce:	5d                   	pop    %rbp
+  8027cf:	c3                   	ret
+        return NULL;
+  8027d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027d5:	c3                   	ret
+        return NULL;
+  8027d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027db:	eb ea                	jmp    8027c7 <malloc+0x1b6>
+            return NULL;
+  8027dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e2:	eb e3                	jmp    8027c7 <malloc+0x1b6>
+
+00000000008027e4 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8027e4:	55                   	push   %rbp
+  8027e5:	48 89 e5             	mov    %rsp,%rbp
+  8027e8:	53                   	push   %rbx
+  8027e9:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8027ed:	48 89 fb             	mov    %rdi,%rbx
+  8027f0:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8027f4:	48 89 df             	mov    %rbx,%rdi
+  8027f7:	48 b8 11 26 80 00 00 	movabs $0x802611,%rax
+  8027fe:	00 00 00 
+  802801:	ff d0                	call   *%rax
+  802803:	48 89 c7             	mov    %rax,%rdi
+  802806:	48 89 da             	mov    %rbx,%rdx
+  802809:	be 00 00 00 00       	mov    $0x0,%esi
+  80280e:	48 b8 1d 1d 80 00 00 	movabs $0x801d1d,%rax
+  802815:	00 00 00 
+  802818:	ff d0                	call   *%rax
+}
+  80281a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80281e:	c9                   	leave
+  80281f:	c3                   	ret
+
+0000000000802820 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  802820:	48 a1 68 00 85 00 00 	movabs 0x850068,%rax
+  802827:	00 00 00 
+  80282a:	48 ba 60 00 85 00 00 	movabs $0x850060,%rdx
+  802831:	00 00 00 
+  802834:	48 3b 02             	cmp    (%rdx),%rax
+  802837:	74 4d                	je     802886 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  802839:	48 85 c0             	test   %rax,%rax
+  80283c:	74 4d                	je     80288b <get_allocsize+0x6b>
+  80283e:	48 b9 80 00 85 00 00 	movabs $0x850080,%rcx
+  802845:	00 00 00 
+  802848:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80284d:	48 3b 39             	cmp    (%rcx),%rdi
+  802850:	74 13                	je     802865 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  802852:	48 83 c2 01          	add    $0x1,%rdx
+  802856:	48 83 c1 18          	add    $0x18,%rcx
+  80285a:	48 39 d0             	cmp    %rdx,%rax
+  80285d:	75 ee                	jne    80284d <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  80285f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802864:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  802865:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  802869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286e:	48 be 80 00 85 00 00 	movabs $0x850080,%rsi
+  802875:	00 00 00 
+  802878:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80287e:	75 0b                	jne    80288b <get_allocsize+0x6b>
+  802880:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  802885:	c3                   	ret
+        return 0;
+  802886:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288b:	c3                   	ret
+
+000000000080288c <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80288c:	48 85 ff             	test   %rdi,%rdi
+  80288f:	0f 84 01 01 00 00    	je     802996 <free+0x10a>
+free(void *ptr) {
+  802895:	55                   	push   %rbp
+  802896:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  802899:	48 b8 68 00 85 00 00 	movabs $0x850068,%rax
+  8028a0:	00 00 00 
+  8028a3:	48 8b 30             	mov    (%rax),%rsi
+  8028a6:	48 a1 60 00 85 00 00 	movabs 0x850060,%rax
+  8028ad:	00 00 00 
+  8028b0:	48 39 c6             	cmp    %rax,%rsi
+  8028b3:	74 50                	je     802905 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8028b5:	48 85 f6             	test   %rsi,%rsi
+  8028b8:	74 21                	je     8028db <free+0x4f>
+  8028ba:	48 b9 80 00 85 00 00 	movabs $0x850080,%rcx
+  8028c1:	00 00 00 
+  8028c4:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8028c9:	48 3b 39             	cmp    (%rcx),%rdi
+  8028cc:	74 61                	je     80292f <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8028ce:	48 83 c2 01          	add    $0x1,%rdx
+  8028d2:	48 83 c1 18          	add    $0x18,%rcx
+  8028d6:	48 39 d6             	cmp    %rdx,%rsi
+  8028d9:	75 ee                	jne    8028c9 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8028db:	48 ba 50 67 80 00 00 	movabs $0x806750,%rdx
+  8028e2:	00 00 00 
+  8028e5:	be 12 01 00 00       	mov    $0x112,%esi
+  8028ea:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  8028f1:	00 00 00 
+  8028f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f9:	48 b9 75 0f 80 00 00 	movabs $0x800f75,%rcx
+  802900:	00 00 00 
+  802903:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  802905:	48 ba 00 67 80 00 00 	movabs $0x806700,%rdx
+  80290c:	00 00 00 
+  80290f:	be 06 01 00 00       	mov    $0x106,%esi
+  802914:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  80291b:	00 00 00 
+  80291e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802923:	48 b9 75 0f 80 00 00 	movabs $0x800f75,%rcx
+  80292a:	00 00 00 
+  80292d:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  80292f:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  802933:	48 be 80 00 85 00 00 	movabs $0x850080,%rsi
+  80293a:	00 00 00 
+  80293d:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  802943:	75 27                	jne    80296c <free+0xe0>
+            freep[i].is_free = true;
+  802945:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  802949:	48 ba 80 00 85 00 00 	movabs $0x850080,%rdx
+  802950:	00 00 00 
+  802953:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  80295a:	00 00 
+            real_freep_size++;
+  80295c:	48 83 c0 01          	add    $0x1,%rax
+  802960:	48 a3 60 00 85 00 00 	movabs %rax,0x850060
+  802967:	00 00 00 
+}
+  80296a:	5d                   	pop    %rbp
+  80296b:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  80296c:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802973:	00 00 00 
+  802976:	be 0b 01 00 00       	mov    $0x10b,%esi
+  80297b:	48 bf 78 67 80 00 00 	movabs $0x806778,%rdi
+  802982:	00 00 00 
+  802985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298a:	48 b9 75 0f 80 00 00 	movabs $0x800f75,%rcx
+  802991:	00 00 00 
+  802994:	ff d1                	call   *%rcx
+  802996:	c3                   	ret
+
+0000000000802997 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  802997:	55                   	push   %rbp
+  802998:	48 89 e5             	mov    %rsp,%rbp
+  80299b:	41 55                	push   %r13
+  80299d:	41 54                	push   %r12
+  80299f:	53                   	push   %rbx
+  8029a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8029a4:	48 89 fb             	mov    %rdi,%rbx
+  8029a7:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  8029aa:	48 b8 20 28 80 00 00 	movabs $0x802820,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  8029b6:	49 39 c5             	cmp    %rax,%r13
+  8029b9:	73 0e                	jae    8029c9 <realloc+0x32>
+}
+  8029bb:	48 89 d8             	mov    %rbx,%rax
+  8029be:	48 83 c4 08          	add    $0x8,%rsp
+  8029c2:	5b                   	pop    %rbx
+  8029c3:	41 5c                	pop    %r12
+  8029c5:	41 5d                	pop    %r13
+  8029c7:	5d                   	pop    %rbp
+  8029c8:	c3                   	ret
+  8029c9:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  8029cc:	4c 89 ef             	mov    %r13,%rdi
+  8029cf:	48 b8 11 26 80 00 00 	movabs $0x802611,%rax
+  8029d6:	00 00 00 
+  8029d9:	ff d0                	call   *%rax
+  8029db:	48 89 c7             	mov    %rax,%rdi
+  8029de:	4c 89 e2             	mov    %r12,%rdx
+  8029e1:	48 89 de             	mov    %rbx,%rsi
+  8029e4:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  8029eb:	00 00 00 
+  8029ee:	ff d0                	call   *%rax
+  8029f0:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  8029f3:	48 89 df             	mov    %rbx,%rdi
+  8029f6:	48 b8 8c 28 80 00 00 	movabs $0x80288c,%rax
+  8029fd:	00 00 00 
+  802a00:	ff d0                	call   *%rax
+    return newptr;
+  802a02:	4c 89 e3             	mov    %r12,%rbx
+  802a05:	eb b4                	jmp    8029bb <realloc+0x24>
+
+0000000000802a07 <strdup>:
+
+char*
+strdup (const char *src) {
+  802a07:	55                   	push   %rbp
+  802a08:	48 89 e5             	mov    %rsp,%rbp
+  802a0b:	41 54                	push   %r12
+  802a0d:	53                   	push   %rbx
+  802a0e:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  802a11:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  802a18:	00 00 00 
+  802a1b:	ff d0                	call   *%rax
+  802a1d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  802a21:	4c 89 e7             	mov    %r12,%rdi
+  802a24:	48 b8 11 26 80 00 00 	movabs $0x802611,%rax
+  802a2b:	00 00 00 
+  802a2e:	ff d0                	call   *%rax
+  802a30:	48 89 c7             	mov    %rax,%rdi
+  802a33:	4c 89 e2             	mov    %r12,%rdx
+  802a36:	48 89 de             	mov    %rbx,%rsi
+  802a39:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  802a40:	00 00 00 
+  802a43:	ff d0                	call   *%rax
+}
+  802a45:	5b                   	pop    %rbx
+  802a46:	41 5c                	pop    %r12
+  802a48:	5d                   	pop    %rbp
+  802a49:	c3                   	ret
+
+0000000000802a4a <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  802a4a:	55                   	push   %rbp
+  802a4b:	48 89 e5             	mov    %rsp,%rbp
+  802a4e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a4f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a54:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a59:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a63:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802a68:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802a73:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a75:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a79:	c9                   	leave
+  802a7a:	c3                   	ret
+
+0000000000802a7b <get_ticks>:
+
+uint64_t
+get_ticks() {
+  802a7b:	55                   	push   %rbp
+  802a7c:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  802a7f:	48 b8 80 00 9d 00 00 	movabs $0x9d0080,%rax
+  802a86:	00 00 00 
+  802a89:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802a8d:	74 26                	je     802ab5 <get_ticks+0x3a>
+    asm volatile("rdtsc"
+  802a8f:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802a91:	48 c1 e2 20          	shl    $0x20,%rdx
+  802a95:	89 c0                	mov    %eax,%eax
+  802a97:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  802a9a:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  802aa1:	48 b9 80 00 9d 00 00 	movabs $0x9d0080,%rcx
+  802aa8:	00 00 00 
+  802aab:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab0:	48 f7 31             	divq   (%rcx)
+}
+  802ab3:	5d                   	pop    %rbp
+  802ab4:	c3                   	ret
+        freq = get_cpufreq();
+  802ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aba:	48 ba 4a 2a 80 00 00 	movabs $0x802a4a,%rdx
+  802ac1:	00 00 00 
+  802ac4:	ff d2                	call   *%rdx
+  802ac6:	48 a3 80 00 9d 00 00 	movabs %rax,0x9d0080
+  802acd:	00 00 00 
+  802ad0:	eb bd                	jmp    802a8f <get_ticks+0x14>
+
+0000000000802ad2 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  802ad2:	55                   	push   %rbp
+  802ad3:	48 89 e5             	mov    %rsp,%rbp
+  802ad6:	53                   	push   %rbx
+  802ad7:	48 83 ec 08          	sub    $0x8,%rsp
+  802adb:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  802ade:	48 b8 80 00 9d 00 00 	movabs $0x9d0080,%rax
+  802ae5:	00 00 00 
+  802ae8:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802aec:	74 50                	je     802b3e <sleep+0x6c>
+    asm volatile("rdtsc"
+  802aee:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802af0:	48 c1 e2 20          	shl    $0x20,%rdx
+  802af4:	89 c0                	mov    %eax,%eax
+  802af6:	48 89 d6             	mov    %rdx,%rsi
+  802af9:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  802afc:	48 b8 80 00 9d 00 00 	movabs $0x9d0080,%rax
+  802b03:	00 00 00 
+  802b06:	48 0f af 18          	imul   (%rax),%rbx
+  802b0a:	48 c1 eb 03          	shr    $0x3,%rbx
+  802b0e:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  802b15:	9b c4 20 
+  802b18:	48 89 d8             	mov    %rbx,%rax
+  802b1b:	48 f7 e2             	mul    %rdx
+  802b1e:	48 89 d1             	mov    %rdx,%rcx
+  802b21:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  802b25:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802b27:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b2b:	89 c0                	mov    %eax,%eax
+  802b2d:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  802b30:	48 29 f2             	sub    %rsi,%rdx
+  802b33:	48 39 ca             	cmp    %rcx,%rdx
+  802b36:	72 ed                	jb     802b25 <sleep+0x53>
+}
+  802b38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b3c:	c9                   	leave
+  802b3d:	c3                   	ret
+        freq = get_cpufreq();
+  802b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b43:	48 ba 4a 2a 80 00 00 	movabs $0x802a4a,%rdx
+  802b4a:	00 00 00 
+  802b4d:	ff d2                	call   *%rdx
+  802b4f:	48 a3 80 00 9d 00 00 	movabs %rax,0x9d0080
+  802b56:	00 00 00 
+  802b59:	eb 93                	jmp    802aee <sleep+0x1c>
+
+0000000000802b5b <poll_kbd>:
+
+int poll_kbd() {
+  802b5b:	55                   	push   %rbp
+  802b5c:	48 89 e5             	mov    %rsp,%rbp
+  802b5f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802b60:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b65:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b74:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802b79:	be 00 00 00 00       	mov    $0x0,%esi
+  802b7e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802b84:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  802b86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b8a:	c9                   	leave
+  802b8b:	c3                   	ret
+
+0000000000802b8c <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  802b8c:	55                   	push   %rbp
+  802b8d:	48 89 e5             	mov    %rsp,%rbp
+  802b90:	53                   	push   %rbx
+  802b91:	49 89 fa             	mov    %rdi,%r10
+  802b94:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  802b96:	44 89 c6             	mov    %r8d,%esi
+  802b99:	89 cf                	mov    %ecx,%edi
+  802b9b:	89 d3                	mov    %edx,%ebx
+  802b9d:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  802b9f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ba4:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802ba7:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  802bab:	cd 30                	int    $0x30
+  802bad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bb1:	c9                   	leave
+  802bb2:	c3                   	ret
+
+0000000000802bb3 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  802bb3:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  802bb6:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  802bba:	83 3f 01             	cmpl   $0x1,(%rdi)
+  802bbd:	7e 0f                	jle    802bce <argstart+0x1b>
+  802bbf:	48 b8 e4 67 80 00 00 	movabs $0x8067e4,%rax
+  802bc6:	00 00 00 
+  802bc9:	48 85 f6             	test   %rsi,%rsi
+  802bcc:	75 05                	jne    802bd3 <argstart+0x20>
+  802bce:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd3:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  802bd7:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  802bde:	00 
+}
+  802bdf:	c3                   	ret
+
+0000000000802be0 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  802be0:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802be7:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  802be8:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802bec:	48 85 c0             	test   %rax,%rax
+  802bef:	0f 84 8f 00 00 00    	je     802c84 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  802bf5:	55                   	push   %rbp
+  802bf6:	48 89 e5             	mov    %rsp,%rbp
+  802bf9:	53                   	push   %rbx
+  802bfa:	48 83 ec 08          	sub    $0x8,%rsp
+  802bfe:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  802c01:	80 38 00             	cmpb   $0x0,(%rax)
+  802c04:	75 52                	jne    802c58 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  802c06:	48 8b 17             	mov    (%rdi),%rdx
+  802c09:	83 3a 01             	cmpl   $0x1,(%rdx)
+  802c0c:	74 67                	je     802c75 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802c0e:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802c12:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  802c16:	80 38 2d             	cmpb   $0x2d,(%rax)
+  802c19:	75 5a                	jne    802c75 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802c1b:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802c1f:	74 54                	je     802c75 <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  802c21:	48 83 c0 01          	add    $0x1,%rax
+  802c25:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802c29:	8b 12                	mov    (%rdx),%edx
+  802c2b:	83 ea 01             	sub    $0x1,%edx
+  802c2e:	48 63 d2             	movslq %edx,%rdx
+  802c31:	48 c1 e2 03          	shl    $0x3,%rdx
+  802c35:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  802c39:	48 83 c7 08          	add    $0x8,%rdi
+  802c3d:	48 b8 cb 1d 80 00 00 	movabs $0x801dcb,%rax
+  802c44:	00 00 00 
+  802c47:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  802c49:	48 8b 03             	mov    (%rbx),%rax
+  802c4c:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  802c4f:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802c53:	80 38 2d             	cmpb   $0x2d,(%rax)
+  802c56:	74 17                	je     802c6f <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  802c58:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802c5c:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  802c5f:	48 83 c0 01          	add    $0x1,%rax
+  802c63:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  802c67:	89 d0                	mov    %edx,%eax
+  802c69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c6d:	c9                   	leave
+  802c6e:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  802c6f:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802c73:	75 e3                	jne    802c58 <argnext+0x78>
+    args->curarg = 0;
+  802c75:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802c7c:	00 
+    return -1;
+  802c7d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802c82:	eb e3                	jmp    802c67 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  802c84:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  802c89:	89 d0                	mov    %edx,%eax
+  802c8b:	c3                   	ret
+
+0000000000802c8c <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  802c8c:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802c90:	48 85 c0             	test   %rax,%rax
+  802c93:	74 7b                	je     802d10 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  802c95:	55                   	push   %rbp
+  802c96:	48 89 e5             	mov    %rsp,%rbp
+  802c99:	53                   	push   %rbx
+  802c9a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c9e:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  802ca1:	80 38 00             	cmpb   $0x0,(%rax)
+  802ca4:	74 1c                	je     802cc2 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  802ca6:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  802caa:	48 b8 e4 67 80 00 00 	movabs $0x8067e4,%rax
+  802cb1:	00 00 00 
+  802cb4:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  802cb8:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  802cbc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc0:	c9                   	leave
+  802cc1:	c3                   	ret
+    } else if (*args->argc > 1) {
+  802cc2:	48 8b 07             	mov    (%rdi),%rax
+  802cc5:	83 38 01             	cmpl   $0x1,(%rax)
+  802cc8:	7f 12                	jg     802cdc <argnextvalue+0x50>
+        args->argvalue = 0;
+  802cca:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802cd1:	00 
+        args->curarg = 0;
+  802cd2:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  802cd9:	00 
+  802cda:	eb dc                	jmp    802cb8 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  802cdc:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802ce0:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802ce4:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802ce8:	8b 10                	mov    (%rax),%edx
+  802cea:	83 ea 01             	sub    $0x1,%edx
+  802ced:	48 63 d2             	movslq %edx,%rdx
+  802cf0:	48 c1 e2 03          	shl    $0x3,%rdx
+  802cf4:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  802cf8:	48 83 c7 08          	add    $0x8,%rdi
+  802cfc:	48 b8 cb 1d 80 00 00 	movabs $0x801dcb,%rax
+  802d03:	00 00 00 
+  802d06:	ff d0                	call   *%rax
+        (*args->argc)--;
+  802d08:	48 8b 03             	mov    (%rbx),%rax
+  802d0b:	83 28 01             	subl   $0x1,(%rax)
+  802d0e:	eb a8                	jmp    802cb8 <argnextvalue+0x2c>
+}
+  802d10:	c3                   	ret
+
+0000000000802d11 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802d11:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  802d15:	48 85 c0             	test   %rax,%rax
+  802d18:	74 01                	je     802d1b <argvalue+0xa>
+}
+  802d1a:	c3                   	ret
+argvalue(struct Argstate *args) {
+  802d1b:	55                   	push   %rbp
+  802d1c:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802d1f:	48 b8 8c 2c 80 00 00 	movabs $0x802c8c,%rax
+  802d26:	00 00 00 
+  802d29:	ff d0                	call   *%rax
+}
+  802d2b:	5d                   	pop    %rbp
+  802d2c:	c3                   	ret
+
+0000000000802d2d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d2d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d34:	ff ff ff 
+  802d37:	48 01 f8             	add    %rdi,%rax
+  802d3a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802d3e:	c3                   	ret
+
+0000000000802d3f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d3f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802d46:	ff ff ff 
+  802d49:	48 01 f8             	add    %rdi,%rax
+  802d4c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802d50:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802d56:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802d5a:	c3                   	ret
+
+0000000000802d5b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802d5b:	55                   	push   %rbp
+  802d5c:	48 89 e5             	mov    %rsp,%rbp
+  802d5f:	41 57                	push   %r15
+  802d61:	41 56                	push   %r14
+  802d63:	41 55                	push   %r13
+  802d65:	41 54                	push   %r12
+  802d67:	53                   	push   %rbx
+  802d68:	48 83 ec 08          	sub    $0x8,%rsp
+  802d6c:	49 89 ff             	mov    %rdi,%r15
+  802d6f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802d74:	49 bd 0f 4c 80 00 00 	movabs $0x804c0f,%r13
+  802d7b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802d7e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802d84:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802d87:	48 89 df             	mov    %rbx,%rdi
+  802d8a:	41 ff d5             	call   *%r13
+  802d8d:	83 e0 04             	and    $0x4,%eax
+  802d90:	74 17                	je     802da9 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802d92:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d99:	4c 39 f3             	cmp    %r14,%rbx
+  802d9c:	75 e6                	jne    802d84 <fd_alloc+0x29>
+  802d9e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802da4:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802da9:	4d 89 27             	mov    %r12,(%r15)
+}
+  802dac:	48 83 c4 08          	add    $0x8,%rsp
+  802db0:	5b                   	pop    %rbx
+  802db1:	41 5c                	pop    %r12
+  802db3:	41 5d                	pop    %r13
+  802db5:	41 5e                	pop    %r14
+  802db7:	41 5f                	pop    %r15
+  802db9:	5d                   	pop    %rbp
+  802dba:	c3                   	ret
+
+0000000000802dbb <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802dbb:	83 ff 1f             	cmp    $0x1f,%edi
+  802dbe:	77 39                	ja     802df9 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802dc0:	55                   	push   %rbp
+  802dc1:	48 89 e5             	mov    %rsp,%rbp
+  802dc4:	41 54                	push   %r12
+  802dc6:	53                   	push   %rbx
+  802dc7:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802dca:	48 63 df             	movslq %edi,%rbx
+  802dcd:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802dd4:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802dd8:	48 89 df             	mov    %rbx,%rdi
+  802ddb:	48 b8 0f 4c 80 00 00 	movabs $0x804c0f,%rax
+  802de2:	00 00 00 
+  802de5:	ff d0                	call   *%rax
+  802de7:	a8 04                	test   $0x4,%al
+  802de9:	74 14                	je     802dff <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802deb:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802def:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802df4:	5b                   	pop    %rbx
+  802df5:	41 5c                	pop    %r12
+  802df7:	5d                   	pop    %rbp
+  802df8:	c3                   	ret
+        return -E_INVAL;
+  802df9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802dfe:	c3                   	ret
+        return -E_INVAL;
+  802dff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e04:	eb ee                	jmp    802df4 <fd_lookup+0x39>
+
+0000000000802e06 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e06:	55                   	push   %rbp
+  802e07:	48 89 e5             	mov    %rsp,%rbp
+  802e0a:	41 54                	push   %r12
+  802e0c:	53                   	push   %rbx
+  802e0d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e10:	48 b8 20 68 80 00 00 	movabs $0x806820,%rax
+  802e17:	00 00 00 
+  802e1a:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e21:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e24:	39 3b                	cmp    %edi,(%rbx)
+  802e26:	74 47                	je     802e6f <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e28:	48 83 c0 08          	add    $0x8,%rax
+  802e2c:	48 8b 18             	mov    (%rax),%rbx
+  802e2f:	48 85 db             	test   %rbx,%rbx
+  802e32:	75 f0                	jne    802e24 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e34:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  802e3b:	00 00 00 
+  802e3e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802e44:	89 fa                	mov    %edi,%edx
+  802e46:	48 bf 88 67 80 00 00 	movabs $0x806788,%rdi
+  802e4d:	00 00 00 
+  802e50:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e55:	48 b9 c5 10 80 00 00 	movabs $0x8010c5,%rcx
+  802e5c:	00 00 00 
+  802e5f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802e61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802e66:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802e6a:	5b                   	pop    %rbx
+  802e6b:	41 5c                	pop    %r12
+  802e6d:	5d                   	pop    %rbp
+  802e6e:	c3                   	ret
+            return 0;
+  802e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e74:	eb f0                	jmp    802e66 <dev_lookup+0x60>
+
+0000000000802e76 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802e76:	55                   	push   %rbp
+  802e77:	48 89 e5             	mov    %rsp,%rbp
+  802e7a:	41 55                	push   %r13
+  802e7c:	41 54                	push   %r12
+  802e7e:	53                   	push   %rbx
+  802e7f:	48 83 ec 18          	sub    $0x18,%rsp
+  802e83:	48 89 fb             	mov    %rdi,%rbx
+  802e86:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802e89:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802e90:	ff ff ff 
+  802e93:	48 01 df             	add    %rbx,%rdi
+  802e96:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802e9a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802e9e:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  802ea5:	00 00 00 
+  802ea8:	ff d0                	call   *%rax
+  802eaa:	41 89 c5             	mov    %eax,%r13d
+  802ead:	85 c0                	test   %eax,%eax
+  802eaf:	78 06                	js     802eb7 <fd_close+0x41>
+  802eb1:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802eb5:	74 1a                	je     802ed1 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802eb7:	45 84 e4             	test   %r12b,%r12b
+  802eba:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebf:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802ec3:	44 89 e8             	mov    %r13d,%eax
+  802ec6:	48 83 c4 18          	add    $0x18,%rsp
+  802eca:	5b                   	pop    %rbx
+  802ecb:	41 5c                	pop    %r12
+  802ecd:	41 5d                	pop    %r13
+  802ecf:	5d                   	pop    %rbp
+  802ed0:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802ed1:	8b 3b                	mov    (%rbx),%edi
+  802ed3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802ed7:	48 b8 06 2e 80 00 00 	movabs $0x802e06,%rax
+  802ede:	00 00 00 
+  802ee1:	ff d0                	call   *%rax
+  802ee3:	41 89 c5             	mov    %eax,%r13d
+  802ee6:	85 c0                	test   %eax,%eax
+  802ee8:	78 1b                	js     802f05 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802eea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802eee:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802ef2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802ef8:	48 85 c0             	test   %rax,%rax
+  802efb:	74 08                	je     802f05 <fd_close+0x8f>
+  802efd:	48 89 df             	mov    %rbx,%rdi
+  802f00:	ff d0                	call   *%rax
+  802f02:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f05:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f0a:	48 89 de             	mov    %rbx,%rsi
+  802f0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f12:	48 b8 7c 23 80 00 00 	movabs $0x80237c,%rax
+  802f19:	00 00 00 
+  802f1c:	ff d0                	call   *%rax
+    return res;
+  802f1e:	eb a3                	jmp    802ec3 <fd_close+0x4d>
+
+0000000000802f20 <close>:
+
+int
+close(int fdnum) {
+  802f20:	55                   	push   %rbp
+  802f21:	48 89 e5             	mov    %rsp,%rbp
+  802f24:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f28:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f2c:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  802f33:	00 00 00 
+  802f36:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f38:	85 c0                	test   %eax,%eax
+  802f3a:	78 15                	js     802f51 <close+0x31>
+
+    return fd_close(fd, 1);
+  802f3c:	be 01 00 00 00       	mov    $0x1,%esi
+  802f41:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f45:	48 b8 76 2e 80 00 00 	movabs $0x802e76,%rax
+  802f4c:	00 00 00 
+  802f4f:	ff d0                	call   *%rax
+}
+  802f51:	c9                   	leave
+  802f52:	c3                   	ret
+
+0000000000802f53 <close_all>:
+
+void
+close_all(void) {
+  802f53:	55                   	push   %rbp
+  802f54:	48 89 e5             	mov    %rsp,%rbp
+  802f57:	41 54                	push   %r12
+  802f59:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802f5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f5f:	49 bc 20 2f 80 00 00 	movabs $0x802f20,%r12
+  802f66:	00 00 00 
+  802f69:	89 df                	mov    %ebx,%edi
+  802f6b:	41 ff d4             	call   *%r12
+  802f6e:	83 c3 01             	add    $0x1,%ebx
+  802f71:	83 fb 20             	cmp    $0x20,%ebx
+  802f74:	75 f3                	jne    802f69 <close_all+0x16>
+}
+  802f76:	5b                   	pop    %rbx
+  802f77:	41 5c                	pop    %r12
+  802f79:	5d                   	pop    %rbp
+  802f7a:	c3                   	ret
+
+0000000000802f7b <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802f7b:	55                   	push   %rbp
+  802f7c:	48 89 e5             	mov    %rsp,%rbp
+  802f7f:	41 57                	push   %r15
+  802f81:	41 56                	push   %r14
+  802f83:	41 55                	push   %r13
+  802f85:	41 54                	push   %r12
+  802f87:	53                   	push   %rbx
+  802f88:	48 83 ec 18          	sub    $0x18,%rsp
+  802f8c:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802f8f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802f93:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  802f9a:	00 00 00 
+  802f9d:	ff d0                	call   *%rax
+  802f9f:	89 c3                	mov    %eax,%ebx
+  802fa1:	85 c0                	test   %eax,%eax
+  802fa3:	0f 88 b8 00 00 00    	js     803061 <dup+0xe6>
+    close(newfdnum);
+  802fa9:	44 89 e7             	mov    %r12d,%edi
+  802fac:	48 b8 20 2f 80 00 00 	movabs $0x802f20,%rax
+  802fb3:	00 00 00 
+  802fb6:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802fb8:	4d 63 ec             	movslq %r12d,%r13
+  802fbb:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802fc2:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802fc6:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802fca:	4c 89 ff             	mov    %r15,%rdi
+  802fcd:	49 be 3f 2d 80 00 00 	movabs $0x802d3f,%r14
+  802fd4:	00 00 00 
+  802fd7:	41 ff d6             	call   *%r14
+  802fda:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802fdd:	4c 89 ef             	mov    %r13,%rdi
+  802fe0:	41 ff d6             	call   *%r14
+  802fe3:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802fe6:	48 89 df             	mov    %rbx,%rdi
+  802fe9:	48 b8 0f 4c 80 00 00 	movabs $0x804c0f,%rax
+  802ff0:	00 00 00 
+  802ff3:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802ff5:	a8 04                	test   $0x4,%al
+  802ff7:	74 2b                	je     803024 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802ff9:	41 89 c1             	mov    %eax,%r9d
+  802ffc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803002:	4c 89 f1             	mov    %r14,%rcx
+  803005:	ba 00 00 00 00       	mov    $0x0,%edx
+  80300a:	48 89 de             	mov    %rbx,%rsi
+  80300d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803012:	48 b8 04 22 80 00 00 	movabs $0x802204,%rax
+  803019:	00 00 00 
+  80301c:	ff d0                	call   *%rax
+  80301e:	89 c3                	mov    %eax,%ebx
+  803020:	85 c0                	test   %eax,%eax
+  803022:	78 4e                	js     803072 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803024:	4c 89 ff             	mov    %r15,%rdi
+  803027:	48 b8 0f 4c 80 00 00 	movabs $0x804c0f,%rax
+  80302e:	00 00 00 
+  803031:	ff d0                	call   *%rax
+  803033:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803036:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80303c:	4c 89 e9             	mov    %r13,%rcx
+  80303f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803044:	4c 89 fe             	mov    %r15,%rsi
+  803047:	bf 00 00 00 00       	mov    $0x0,%edi
+  80304c:	48 b8 04 22 80 00 00 	movabs $0x802204,%rax
+  803053:	00 00 00 
+  803056:	ff d0                	call   *%rax
+  803058:	89 c3                	mov    %eax,%ebx
+  80305a:	85 c0                	test   %eax,%eax
+  80305c:	78 14                	js     803072 <dup+0xf7>
+
+    return newfdnum;
+  80305e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803061:	89 d8                	mov    %ebx,%eax
+  803063:	48 83 c4 18          	add    $0x18,%rsp
+  803067:	5b                   	pop    %rbx
+  803068:	41 5c                	pop    %r12
+  80306a:	41 5d                	pop    %r13
+  80306c:	41 5e                	pop    %r14
+  80306e:	41 5f                	pop    %r15
+  803070:	5d                   	pop    %rbp
+  803071:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803072:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803077:	4c 89 ee             	mov    %r13,%rsi
+  80307a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80307f:	49 bc 7c 23 80 00 00 	movabs $0x80237c,%r12
+  803086:	00 00 00 
+  803089:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80308c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803091:	4c 89 f6             	mov    %r14,%rsi
+  803094:	bf 00 00 00 00       	mov    $0x0,%edi
+  803099:	41 ff d4             	call   *%r12
+    return res;
+  80309c:	eb c3                	jmp    803061 <dup+0xe6>
+
+000000000080309e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80309e:	55                   	push   %rbp
+  80309f:	48 89 e5             	mov    %rsp,%rbp
+  8030a2:	41 56                	push   %r14
+  8030a4:	41 55                	push   %r13
+  8030a6:	41 54                	push   %r12
+  8030a8:	53                   	push   %rbx
+  8030a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8030ad:	89 fb                	mov    %edi,%ebx
+  8030af:	49 89 f4             	mov    %rsi,%r12
+  8030b2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8030b5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8030b9:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  8030c0:	00 00 00 
+  8030c3:	ff d0                	call   *%rax
+  8030c5:	85 c0                	test   %eax,%eax
+  8030c7:	78 4c                	js     803115 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8030c9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8030cd:	41 8b 3e             	mov    (%r14),%edi
+  8030d0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8030d4:	48 b8 06 2e 80 00 00 	movabs $0x802e06,%rax
+  8030db:	00 00 00 
+  8030de:	ff d0                	call   *%rax
+  8030e0:	85 c0                	test   %eax,%eax
+  8030e2:	78 35                	js     803119 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8030e4:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8030e8:	83 e0 03             	and    $0x3,%eax
+  8030eb:	83 f8 01             	cmp    $0x1,%eax
+  8030ee:	74 2d                	je     80311d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8030f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030f4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8030f8:	48 85 c0             	test   %rax,%rax
+  8030fb:	74 56                	je     803153 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8030fd:	4c 89 ea             	mov    %r13,%rdx
+  803100:	4c 89 e6             	mov    %r12,%rsi
+  803103:	4c 89 f7             	mov    %r14,%rdi
+  803106:	ff d0                	call   *%rax
+}
+  803108:	48 83 c4 10          	add    $0x10,%rsp
+  80310c:	5b                   	pop    %rbx
+  80310d:	41 5c                	pop    %r12
+  80310f:	41 5d                	pop    %r13
+  803111:	41 5e                	pop    %r14
+  803113:	5d                   	pop    %rbp
+  803114:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803115:	48 98                	cltq
+  803117:	eb ef                	jmp    803108 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803119:	48 98                	cltq
+  80311b:	eb eb                	jmp    803108 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80311d:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  803124:	00 00 00 
+  803127:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80312d:	89 da                	mov    %ebx,%edx
+  80312f:	48 bf c9 67 80 00 00 	movabs $0x8067c9,%rdi
+  803136:	00 00 00 
+  803139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313e:	48 b9 c5 10 80 00 00 	movabs $0x8010c5,%rcx
+  803145:	00 00 00 
+  803148:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80314a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803151:	eb b5                	jmp    803108 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803153:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80315a:	eb ac                	jmp    803108 <read+0x6a>
+
+000000000080315c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80315c:	55                   	push   %rbp
+  80315d:	48 89 e5             	mov    %rsp,%rbp
+  803160:	41 57                	push   %r15
+  803162:	41 56                	push   %r14
+  803164:	41 55                	push   %r13
+  803166:	41 54                	push   %r12
+  803168:	53                   	push   %rbx
+  803169:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80316d:	48 85 d2             	test   %rdx,%rdx
+  803170:	74 54                	je     8031c6 <readn+0x6a>
+  803172:	41 89 fd             	mov    %edi,%r13d
+  803175:	49 89 f6             	mov    %rsi,%r14
+  803178:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80317b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803180:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803185:	49 bf 9e 30 80 00 00 	movabs $0x80309e,%r15
+  80318c:	00 00 00 
+  80318f:	4c 89 e2             	mov    %r12,%rdx
+  803192:	48 29 f2             	sub    %rsi,%rdx
+  803195:	4c 01 f6             	add    %r14,%rsi
+  803198:	44 89 ef             	mov    %r13d,%edi
+  80319b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80319e:	85 c0                	test   %eax,%eax
+  8031a0:	78 20                	js     8031c2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8031a2:	01 c3                	add    %eax,%ebx
+  8031a4:	85 c0                	test   %eax,%eax
+  8031a6:	74 08                	je     8031b0 <readn+0x54>
+  8031a8:	48 63 f3             	movslq %ebx,%rsi
+  8031ab:	4c 39 e6             	cmp    %r12,%rsi
+  8031ae:	72 df                	jb     80318f <readn+0x33>
+    }
+    return res;
+  8031b0:	48 63 c3             	movslq %ebx,%rax
+}
+  8031b3:	48 83 c4 08          	add    $0x8,%rsp
+  8031b7:	5b                   	pop    %rbx
+  8031b8:	41 5c                	pop    %r12
+  8031ba:	41 5d                	pop    %r13
+  8031bc:	41 5e                	pop    %r14
+  8031be:	41 5f                	pop    %r15
+  8031c0:	5d                   	pop    %rbp
+  8031c1:	c3                   	ret
+        if (inc < 0) return inc;
+  8031c2:	48 98                	cltq
+  8031c4:	eb ed                	jmp    8031b3 <readn+0x57>
+    int inc = 1, res = 0;
+  8031c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031cb:	eb e3                	jmp    8031b0 <readn+0x54>
+
+00000000008031cd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8031cd:	55                   	push   %rbp
+  8031ce:	48 89 e5             	mov    %rsp,%rbp
+  8031d1:	41 56                	push   %r14
+  8031d3:	41 55                	push   %r13
+  8031d5:	41 54                	push   %r12
+  8031d7:	53                   	push   %rbx
+  8031d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8031dc:	89 fb                	mov    %edi,%ebx
+  8031de:	49 89 f4             	mov    %rsi,%r12
+  8031e1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8031e4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8031e8:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  8031ef:	00 00 00 
+  8031f2:	ff d0                	call   *%rax
+  8031f4:	85 c0                	test   %eax,%eax
+  8031f6:	78 47                	js     80323f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8031f8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8031fc:	41 8b 3e             	mov    (%r14),%edi
+  8031ff:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803203:	48 b8 06 2e 80 00 00 	movabs $0x802e06,%rax
+  80320a:	00 00 00 
+  80320d:	ff d0                	call   *%rax
+  80320f:	85 c0                	test   %eax,%eax
+  803211:	78 30                	js     803243 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803213:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803218:	74 2d                	je     803247 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80321a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80321e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803222:	48 85 c0             	test   %rax,%rax
+  803225:	74 56                	je     80327d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803227:	4c 89 ea             	mov    %r13,%rdx
+  80322a:	4c 89 e6             	mov    %r12,%rsi
+  80322d:	4c 89 f7             	mov    %r14,%rdi
+  803230:	ff d0                	call   *%rax
+}
+  803232:	48 83 c4 10          	add    $0x10,%rsp
+  803236:	5b                   	pop    %rbx
+  803237:	41 5c                	pop    %r12
+  803239:	41 5d                	pop    %r13
+  80323b:	41 5e                	pop    %r14
+  80323d:	5d                   	pop    %rbp
+  80323e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80323f:	48 98                	cltq
+  803241:	eb ef                	jmp    803232 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803243:	48 98                	cltq
+  803245:	eb eb                	jmp    803232 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803247:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  80324e:	00 00 00 
+  803251:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803257:	89 da                	mov    %ebx,%edx
+  803259:	48 bf e5 67 80 00 00 	movabs $0x8067e5,%rdi
+  803260:	00 00 00 
+  803263:	b8 00 00 00 00       	mov    $0x0,%eax
+  803268:	48 b9 c5 10 80 00 00 	movabs $0x8010c5,%rcx
+  80326f:	00 00 00 
+  803272:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803274:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80327b:	eb b5                	jmp    803232 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80327d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803284:	eb ac                	jmp    803232 <write+0x65>
+
+0000000000803286 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803286:	55                   	push   %rbp
+  803287:	48 89 e5             	mov    %rsp,%rbp
+  80328a:	53                   	push   %rbx
+  80328b:	48 83 ec 18          	sub    $0x18,%rsp
+  80328f:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803291:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803295:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  80329c:	00 00 00 
+  80329f:	ff d0                	call   *%rax
+  8032a1:	85 c0                	test   %eax,%eax
+  8032a3:	78 0c                	js     8032b1 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8032a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032a9:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8032ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032b5:	c9                   	leave
+  8032b6:	c3                   	ret
+
+00000000008032b7 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8032b7:	55                   	push   %rbp
+  8032b8:	48 89 e5             	mov    %rsp,%rbp
+  8032bb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8032bf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032c3:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  8032ca:	00 00 00 
+  8032cd:	ff d0                	call   *%rax
+  8032cf:	85 c0                	test   %eax,%eax
+  8032d1:	78 07                	js     8032da <tell+0x23>
+    return fdes->fd_offset;
+  8032d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032d7:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8032da:	c9                   	leave
+  8032db:	c3                   	ret
+
+00000000008032dc <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8032dc:	55                   	push   %rbp
+  8032dd:	48 89 e5             	mov    %rsp,%rbp
+  8032e0:	41 55                	push   %r13
+  8032e2:	41 54                	push   %r12
+  8032e4:	53                   	push   %rbx
+  8032e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8032e9:	89 fb                	mov    %edi,%ebx
+  8032eb:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032ee:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8032f2:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  8032f9:	00 00 00 
+  8032fc:	ff d0                	call   *%rax
+  8032fe:	85 c0                	test   %eax,%eax
+  803300:	78 38                	js     80333a <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803302:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803306:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80330a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80330e:	48 b8 06 2e 80 00 00 	movabs $0x802e06,%rax
+  803315:	00 00 00 
+  803318:	ff d0                	call   *%rax
+  80331a:	85 c0                	test   %eax,%eax
+  80331c:	78 1c                	js     80333a <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80331e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803323:	74 20                	je     803345 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803325:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803329:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80332d:	48 85 c0             	test   %rax,%rax
+  803330:	74 47                	je     803379 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803332:	44 89 e6             	mov    %r12d,%esi
+  803335:	4c 89 ef             	mov    %r13,%rdi
+  803338:	ff d0                	call   *%rax
+}
+  80333a:	48 83 c4 18          	add    $0x18,%rsp
+  80333e:	5b                   	pop    %rbx
+  80333f:	41 5c                	pop    %r12
+  803341:	41 5d                	pop    %r13
+  803343:	5d                   	pop    %rbp
+  803344:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803345:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  80334c:	00 00 00 
+  80334f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803355:	89 da                	mov    %ebx,%edx
+  803357:	48 bf a8 67 80 00 00 	movabs $0x8067a8,%rdi
+  80335e:	00 00 00 
+  803361:	b8 00 00 00 00       	mov    $0x0,%eax
+  803366:	48 b9 c5 10 80 00 00 	movabs $0x8010c5,%rcx
+  80336d:	00 00 00 
+  803370:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803372:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803377:	eb c1                	jmp    80333a <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803379:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80337e:	eb ba                	jmp    80333a <ftruncate+0x5e>
+
+0000000000803380 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803380:	55                   	push   %rbp
+  803381:	48 89 e5             	mov    %rsp,%rbp
+  803384:	41 54                	push   %r12
+  803386:	53                   	push   %rbx
+  803387:	48 83 ec 10          	sub    $0x10,%rsp
+  80338b:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80338e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803392:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+  80339e:	85 c0                	test   %eax,%eax
+  8033a0:	78 4e                	js     8033f0 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033a2:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8033a6:	41 8b 3c 24          	mov    (%r12),%edi
+  8033aa:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8033ae:	48 b8 06 2e 80 00 00 	movabs $0x802e06,%rax
+  8033b5:	00 00 00 
+  8033b8:	ff d0                	call   *%rax
+  8033ba:	85 c0                	test   %eax,%eax
+  8033bc:	78 32                	js     8033f0 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8033be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033c2:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8033c7:	74 30                	je     8033f9 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8033c9:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8033cc:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8033d3:	00 00 00 
+    stat->st_isdir = 0;
+  8033d6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8033dd:	00 00 00 
+    stat->st_dev = dev;
+  8033e0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8033e7:	48 89 de             	mov    %rbx,%rsi
+  8033ea:	4c 89 e7             	mov    %r12,%rdi
+  8033ed:	ff 50 28             	call   *0x28(%rax)
+}
+  8033f0:	48 83 c4 10          	add    $0x10,%rsp
+  8033f4:	5b                   	pop    %rbx
+  8033f5:	41 5c                	pop    %r12
+  8033f7:	5d                   	pop    %rbp
+  8033f8:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8033f9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033fe:	eb f0                	jmp    8033f0 <fstat+0x70>
+
+0000000000803400 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  803400:	55                   	push   %rbp
+  803401:	48 89 e5             	mov    %rsp,%rbp
+  803404:	41 54                	push   %r12
+  803406:	53                   	push   %rbx
+  803407:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80340e:	41 89 fc             	mov    %edi,%r12d
+  803411:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803413:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803417:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  80341e:	00 00 00 
+  803421:	ff d0                	call   *%rax
+  803423:	85 c0                	test   %eax,%eax
+  803425:	78 31                	js     803458 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  803427:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80342e:	44 89 e7             	mov    %r12d,%edi
+  803431:	48 b8 80 33 80 00 00 	movabs $0x803380,%rax
+  803438:	00 00 00 
+  80343b:	ff d0                	call   *%rax
+  80343d:	85 c0                	test   %eax,%eax
+  80343f:	78 17                	js     803458 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  803441:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803445:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  803448:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80344b:	39 d3                	cmp    %edx,%ebx
+  80344d:	0f 4f da             	cmovg  %edx,%ebx
+  803450:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803453:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803458:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  80345f:	5b                   	pop    %rbx
+  803460:	41 5c                	pop    %r12
+  803462:	5d                   	pop    %rbp
+  803463:	c3                   	ret
+
+0000000000803464 <seektoend>:
+{
+  803464:	55                   	push   %rbp
+  803465:	48 89 e5             	mov    %rsp,%rbp
+  803468:	53                   	push   %rbx
+  803469:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  803470:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  803472:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803476:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  80347d:	00 00 00 
+  803480:	ff d0                	call   *%rax
+  803482:	85 c0                	test   %eax,%eax
+  803484:	78 28                	js     8034ae <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  803486:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80348d:	89 df                	mov    %ebx,%edi
+  80348f:	48 b8 80 33 80 00 00 	movabs $0x803380,%rax
+  803496:	00 00 00 
+  803499:	ff d0                	call   *%rax
+  80349b:	85 c0                	test   %eax,%eax
+  80349d:	78 0f                	js     8034ae <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80349f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8034a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034a6:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8034a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034b2:	c9                   	leave
+  8034b3:	c3                   	ret
+
+00000000008034b4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8034b4:	55                   	push   %rbp
+  8034b5:	48 89 e5             	mov    %rsp,%rbp
+  8034b8:	41 54                	push   %r12
+  8034ba:	53                   	push   %rbx
+  8034bb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8034be:	be 00 00 00 00       	mov    $0x0,%esi
+  8034c3:	48 b8 a7 40 80 00 00 	movabs $0x8040a7,%rax
+  8034ca:	00 00 00 
+  8034cd:	ff d0                	call   *%rax
+  8034cf:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8034d1:	85 c0                	test   %eax,%eax
+  8034d3:	78 25                	js     8034fa <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8034d5:	4c 89 e6             	mov    %r12,%rsi
+  8034d8:	89 c7                	mov    %eax,%edi
+  8034da:	48 b8 80 33 80 00 00 	movabs $0x803380,%rax
+  8034e1:	00 00 00 
+  8034e4:	ff d0                	call   *%rax
+  8034e6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034e9:	89 df                	mov    %ebx,%edi
+  8034eb:	48 b8 20 2f 80 00 00 	movabs $0x802f20,%rax
+  8034f2:	00 00 00 
+  8034f5:	ff d0                	call   *%rax
+
+    return res;
+  8034f7:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034fa:	89 d8                	mov    %ebx,%eax
+  8034fc:	5b                   	pop    %rbx
+  8034fd:	41 5c                	pop    %r12
+  8034ff:	5d                   	pop    %rbp
+  803500:	c3                   	ret
+
+0000000000803501 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  803501:	55                   	push   %rbp
+  803502:	48 89 e5             	mov    %rsp,%rbp
+  803505:	53                   	push   %rbx
+  803506:	48 83 ec 08          	sub    $0x8,%rsp
+  80350a:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80350d:	48 b8 2d 2d 80 00 00 	movabs $0x802d2d,%rax
+  803514:	00 00 00 
+  803517:	ff d0                	call   *%rax
+  803519:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80351d:	0f 87 ea 00 00 00    	ja     80360d <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  803523:	48 b8 04 20 9d 00 00 	movabs $0x9d2004,%rax
+  80352a:	00 00 00 
+  80352d:	80 38 00             	cmpb   $0x0,(%rax)
+  803530:	75 35                	jne    803567 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  803532:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803537:	ba 00 00 22 00       	mov    $0x220000,%edx
+  80353c:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  803541:	bf 00 00 00 00       	mov    $0x0,%edi
+  803546:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  80354d:	00 00 00 
+  803550:	ff d0                	call   *%rax
+  803552:	85 c0                	test   %eax,%eax
+  803554:	0f 88 ba 00 00 00    	js     803614 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80355a:	48 b8 04 20 9d 00 00 	movabs $0x9d2004,%rax
+  803561:	00 00 00 
+  803564:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  803567:	48 89 df             	mov    %rbx,%rdi
+  80356a:	48 b8 2d 2d 80 00 00 	movabs $0x802d2d,%rax
+  803571:	00 00 00 
+  803574:	ff d0                	call   *%rax
+  803576:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  80357a:	48 ba 20 20 9d 00 00 	movabs $0x9d2020,%rdx
+  803581:	00 00 00 
+  803584:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  803588:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  80358b:	39 39                	cmp    %edi,(%rcx)
+  80358d:	74 46                	je     8035d5 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80358f:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  803593:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  80359a:	00 
+  80359b:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8035a2:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8035a9:	00 
+  8035aa:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8035b1:	00 
+  8035b2:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8035b9:	00 
+  8035ba:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8035c1:	00 
+  8035c2:	89 39                	mov    %edi,(%rcx)
+  8035c4:	48 01 c6             	add    %rax,%rsi
+  8035c7:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8035cc:	48 89 c8             	mov    %rcx,%rax
+  8035cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035d3:	c9                   	leave
+  8035d4:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  8035d5:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8035d9:	48 be 20 20 9d 00 00 	movabs $0x9d2020,%rsi
+  8035e0:	00 00 00 
+  8035e3:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8035e6:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  8035ea:	74 e0                	je     8035cc <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  8035ec:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8035f3:	00 
+  8035f4:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8035f8:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8035ff:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  803601:	8b 7b 10             	mov    0x10(%rbx),%edi
+  803604:	48 01 c2             	add    %rax,%rdx
+  803607:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80360b:	eb bf                	jmp    8035cc <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80360d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803612:	eb b8                	jmp    8035cc <fbuf_get+0xcb>
+            return NULL;
+  803614:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803619:	eb b1                	jmp    8035cc <fbuf_get+0xcb>
+
+000000000080361b <fsipc_bulk>:
+fsipc_bulk(void) {
+  80361b:	55                   	push   %rbp
+  80361c:	48 89 e5             	mov    %rsp,%rbp
+  80361f:	53                   	push   %rbx
+  803620:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  803624:	48 b8 20 25 9d 00 00 	movabs $0x9d2520,%rax
+  80362b:	00 00 00 
+  80362e:	48 8b 18             	mov    (%rax),%rbx
+  803631:	48 85 db             	test   %rbx,%rbx
+  803634:	74 16                	je     80364c <fsipc_bulk+0x31>
+    return fsipcbulk;
+  803636:	48 b8 20 25 9d 00 00 	movabs $0x9d2520,%rax
+  80363d:	00 00 00 
+  803640:	48 8b 18             	mov    (%rax),%rbx
+}
+  803643:	48 89 d8             	mov    %rbx,%rax
+  803646:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80364a:	c9                   	leave
+  80364b:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  80364c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803651:	ba 00 10 04 00       	mov    $0x41000,%edx
+  803656:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  80365b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803660:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  803667:	00 00 00 
+  80366a:	ff d0                	call   *%rax
+  80366c:	85 c0                	test   %eax,%eax
+  80366e:	78 d3                	js     803643 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  803670:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  803675:	48 a3 20 25 9d 00 00 	movabs %rax,0x9d2520
+  80367c:	00 00 00 
+  80367f:	eb b5                	jmp    803636 <fsipc_bulk+0x1b>
+
+0000000000803681 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  803681:	55                   	push   %rbp
+  803682:	48 89 e5             	mov    %rsp,%rbp
+  803685:	41 57                	push   %r15
+  803687:	41 56                	push   %r14
+  803689:	41 55                	push   %r13
+  80368b:	41 54                	push   %r12
+  80368d:	53                   	push   %rbx
+  80368e:	48 83 ec 08          	sub    $0x8,%rsp
+  803692:	41 89 fd             	mov    %edi,%r13d
+  803695:	49 89 f6             	mov    %rsi,%r14
+  803698:	49 89 d7             	mov    %rdx,%r15
+  80369b:	48 89 cb             	mov    %rcx,%rbx
+  80369e:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036a1:	48 b8 00 20 9d 00 00 	movabs $0x9d2000,%rax
+  8036a8:	00 00 00 
+  8036ab:	83 38 00             	cmpl   $0x0,(%rax)
+  8036ae:	74 52                	je     803702 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  8036b0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8036b6:	4c 89 f9             	mov    %r15,%rcx
+  8036b9:	4c 89 f2             	mov    %r14,%rdx
+  8036bc:	44 89 ee             	mov    %r13d,%esi
+  8036bf:	48 b8 00 20 9d 00 00 	movabs $0x9d2000,%rax
+  8036c6:	00 00 00 
+  8036c9:	8b 38                	mov    (%rax),%edi
+  8036cb:	48 b8 66 51 80 00 00 	movabs $0x805166,%rax
+  8036d2:	00 00 00 
+  8036d5:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  8036d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036dc:	4c 89 e2             	mov    %r12,%rdx
+  8036df:	48 89 de             	mov    %rbx,%rsi
+  8036e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036e7:	48 b8 b6 4f 80 00 00 	movabs $0x804fb6,%rax
+  8036ee:	00 00 00 
+  8036f1:	ff d0                	call   *%rax
+}
+  8036f3:	48 83 c4 08          	add    $0x8,%rsp
+  8036f7:	5b                   	pop    %rbx
+  8036f8:	41 5c                	pop    %r12
+  8036fa:	41 5d                	pop    %r13
+  8036fc:	41 5e                	pop    %r14
+  8036fe:	41 5f                	pop    %r15
+  803700:	5d                   	pop    %rbp
+  803701:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803702:	bf 03 00 00 00       	mov    $0x3,%edi
+  803707:	48 b8 09 52 80 00 00 	movabs $0x805209,%rax
+  80370e:	00 00 00 
+  803711:	ff d0                	call   *%rax
+  803713:	a3 00 20 9d 00 00 00 	movabs %eax,0x9d2000
+  80371a:	00 00 
+  80371c:	eb 92                	jmp    8036b0 <fsipc_region+0x2f>
+
+000000000080371e <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80371e:	55                   	push   %rbp
+  80371f:	48 89 e5             	mov    %rsp,%rbp
+  803722:	41 57                	push   %r15
+  803724:	41 56                	push   %r14
+  803726:	41 55                	push   %r13
+  803728:	41 54                	push   %r12
+  80372a:	53                   	push   %rbx
+  80372b:	48 83 ec 28          	sub    $0x28,%rsp
+  80372f:	49 89 ff             	mov    %rdi,%r15
+  803732:	49 89 f6             	mov    %rsi,%r14
+  803735:	48 89 d3             	mov    %rdx,%rbx
+  803738:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80373c:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  80373f:	48 b8 1b 36 80 00 00 	movabs $0x80361b,%rax
+  803746:	00 00 00 
+  803749:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  80374b:	48 85 c0             	test   %rax,%rax
+  80374e:	0f 84 cc 00 00 00    	je     803820 <devfile_write_direct+0x102>
+  803754:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  803757:	48 85 db             	test   %rbx,%rbx
+  80375a:	0f 84 ba 00 00 00    	je     80381a <devfile_write_direct+0xfc>
+    size_t i = 0;
+  803760:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  803766:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80376d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  803771:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803775:	4c 29 e3             	sub    %r12,%rbx
+  803778:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80377d:	48 39 c3             	cmp    %rax,%rbx
+  803780:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  803784:	48 89 da             	mov    %rbx,%rdx
+  803787:	4c 89 f6             	mov    %r14,%rsi
+  80378a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80378e:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  803795:	00 00 00 
+  803798:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  80379a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80379e:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  8037a2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8037a5:	44 01 e0             	add    %r12d,%eax
+  8037a8:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  8037ac:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  8037b0:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  8037b7:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8037be:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  8037c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8037cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037d0:	4c 89 ee             	mov    %r13,%rsi
+  8037d3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8037d8:	48 b8 81 36 80 00 00 	movabs $0x803681,%rax
+  8037df:	00 00 00 
+  8037e2:	ff d0                	call   *%rax
+        if (res < 0)
+  8037e4:	85 c0                	test   %eax,%eax
+  8037e6:	78 29                	js     803811 <devfile_write_direct+0xf3>
+        if (res == 0)
+  8037e8:	74 2b                	je     803815 <devfile_write_direct+0xf7>
+        i += res;
+  8037ea:	48 98                	cltq
+  8037ec:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  8037ef:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  8037f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037f6:	49 39 c4             	cmp    %rax,%r12
+  8037f9:	0f 82 72 ff ff ff    	jb     803771 <devfile_write_direct+0x53>
+    return i;
+  8037ff:	4c 89 e0             	mov    %r12,%rax
+}
+  803802:	48 83 c4 28          	add    $0x28,%rsp
+  803806:	5b                   	pop    %rbx
+  803807:	41 5c                	pop    %r12
+  803809:	41 5d                	pop    %r13
+  80380b:	41 5e                	pop    %r14
+  80380d:	41 5f                	pop    %r15
+  80380f:	5d                   	pop    %rbp
+  803810:	c3                   	ret
+            return res;
+  803811:	48 98                	cltq
+  803813:	eb ed                	jmp    803802 <devfile_write_direct+0xe4>
+            return i;
+  803815:	4c 89 e0             	mov    %r12,%rax
+  803818:	eb e8                	jmp    803802 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80381a:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  80381e:	eb df                	jmp    8037ff <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  803820:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  803827:	eb d9                	jmp    803802 <devfile_write_direct+0xe4>
+
+0000000000803829 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  803829:	55                   	push   %rbp
+  80382a:	48 89 e5             	mov    %rsp,%rbp
+  80382d:	41 56                	push   %r14
+  80382f:	41 55                	push   %r13
+  803831:	41 54                	push   %r12
+  803833:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  803834:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  803838:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  80383c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803841:	4d 39 ee             	cmp    %r13,%r14
+  803844:	0f 84 99 00 00 00    	je     8038e3 <fbuf_flush+0xba>
+  80384a:	49 89 fc             	mov    %rdi,%r12
+  80384d:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  803850:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  803853:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803857:	48 b8 2d 2d 80 00 00 	movabs $0x802d2d,%rax
+  80385e:	00 00 00 
+  803861:	ff d0                	call   *%rax
+  803863:	48 89 c2             	mov    %rax,%rdx
+  803866:	48 c1 e2 04          	shl    $0x4,%rdx
+  80386a:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80386e:	48 c1 e0 0c          	shl    $0xc,%rax
+  803872:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803877:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  80387a:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80387e:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803885:	00 
+  803886:	44 89 f1             	mov    %r14d,%ecx
+  803889:	4c 89 ea             	mov    %r13,%rdx
+  80388c:	4c 89 e7             	mov    %r12,%rdi
+  80388f:	48 b8 1e 37 80 00 00 	movabs $0x80371e,%rax
+  803896:	00 00 00 
+  803899:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80389b:	48 85 c0             	test   %rax,%rax
+  80389e:	78 43                	js     8038e3 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  8038a0:	4c 39 e8             	cmp    %r13,%rax
+  8038a3:	72 47                	jb     8038ec <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  8038a5:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8038aa:	83 c0 01             	add    $0x1,%eax
+  8038ad:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8038b2:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  8038b5:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8038b9:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  8038bd:	72 0f                	jb     8038ce <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  8038bf:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8038c3:	48 39 c2             	cmp    %rax,%rdx
+  8038c6:	48 0f 42 d0          	cmovb  %rax,%rdx
+  8038ca:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  8038ce:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  8038d5:	00 
+  8038d6:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  8038dd:	00 
+    return 0;
+  8038de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038e3:	5b                   	pop    %rbx
+  8038e4:	41 5c                	pop    %r12
+  8038e6:	41 5d                	pop    %r13
+  8038e8:	41 5e                	pop    %r14
+  8038ea:	5d                   	pop    %rbp
+  8038eb:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  8038ec:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8038f1:	eb f0                	jmp    8038e3 <fbuf_flush+0xba>
+
+00000000008038f3 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  8038f3:	55                   	push   %rbp
+  8038f4:	48 89 e5             	mov    %rsp,%rbp
+  8038f7:	53                   	push   %rbx
+  8038f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8038fc:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  8038ff:	48 b8 01 35 80 00 00 	movabs $0x803501,%rax
+  803906:	00 00 00 
+  803909:	ff d0                	call   *%rax
+  80390b:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  80390e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803913:	48 85 f6             	test   %rsi,%rsi
+  803916:	74 0f                	je     803927 <devfile_sync+0x34>
+  803918:	48 89 df             	mov    %rbx,%rdi
+  80391b:	48 b8 29 38 80 00 00 	movabs $0x803829,%rax
+  803922:	00 00 00 
+  803925:	ff d0                	call   *%rax
+}
+  803927:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80392b:	c9                   	leave
+  80392c:	c3                   	ret
+
+000000000080392d <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80392d:	55                   	push   %rbp
+  80392e:	48 89 e5             	mov    %rsp,%rbp
+  803931:	48 83 ec 10          	sub    $0x10,%rsp
+  803935:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  803938:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80393f:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  803940:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  803944:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803949:	48 be 00 10 9d 00 00 	movabs $0x9d1000,%rsi
+  803950:	00 00 00 
+  803953:	48 b8 81 36 80 00 00 	movabs $0x803681,%rax
+  80395a:	00 00 00 
+  80395d:	ff d0                	call   *%rax
+}
+  80395f:	c9                   	leave
+  803960:	c3                   	ret
+
+0000000000803961 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803961:	55                   	push   %rbp
+  803962:	48 89 e5             	mov    %rsp,%rbp
+  803965:	41 54                	push   %r12
+  803967:	53                   	push   %rbx
+  803968:	48 89 fb             	mov    %rdi,%rbx
+  80396b:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  80396e:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803975:	00 00 00 
+  803978:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80397a:	85 c0                	test   %eax,%eax
+  80397c:	78 63                	js     8039e1 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80397e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803981:	a3 00 10 9d 00 00 00 	movabs %eax,0x9d1000
+  803988:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  80398a:	be 00 00 00 00       	mov    $0x0,%esi
+  80398f:	bf 05 00 00 00       	mov    $0x5,%edi
+  803994:	48 b8 2d 39 80 00 00 	movabs $0x80392d,%rax
+  80399b:	00 00 00 
+  80399e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039a0:	85 c0                	test   %eax,%eax
+  8039a2:	78 3d                	js     8039e1 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039a4:	48 bb 00 10 9d 00 00 	movabs $0x9d1000,%rbx
+  8039ab:	00 00 00 
+  8039ae:	48 89 de             	mov    %rbx,%rsi
+  8039b1:	4c 89 e7             	mov    %r12,%rdi
+  8039b4:	48 b8 3d 1a 80 00 00 	movabs $0x801a3d,%rax
+  8039bb:	00 00 00 
+  8039be:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8039c0:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  8039c6:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  8039cd:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8039ce:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  8039d4:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  8039db:	00 
+
+    return 0;
+  8039dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039e1:	5b                   	pop    %rbx
+  8039e2:	41 5c                	pop    %r12
+  8039e4:	5d                   	pop    %rbp
+  8039e5:	c3                   	ret
+
+00000000008039e6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8039e6:	55                   	push   %rbp
+  8039e7:	48 89 e5             	mov    %rsp,%rbp
+  8039ea:	41 54                	push   %r12
+  8039ec:	53                   	push   %rbx
+  8039ed:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  8039f0:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  8039f7:	00 00 00 
+  8039fa:	ff d0                	call   *%rax
+  8039fc:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  8039ff:	48 89 df             	mov    %rbx,%rdi
+  803a02:	48 b8 2d 2d 80 00 00 	movabs $0x802d2d,%rax
+  803a09:	00 00 00 
+  803a0c:	ff d0                	call   *%rax
+  803a0e:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803a12:	76 2e                	jbe    803a42 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  803a14:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803a17:	a3 00 10 9d 00 00 00 	movabs %eax,0x9d1000
+  803a1e:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  803a20:	be 00 00 00 00       	mov    $0x0,%esi
+  803a25:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803a2a:	48 b8 2d 39 80 00 00 	movabs $0x80392d,%rax
+  803a31:	00 00 00 
+  803a34:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  803a36:	45 85 e4             	test   %r12d,%r12d
+  803a39:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  803a3d:	5b                   	pop    %rbx
+  803a3e:	41 5c                	pop    %r12
+  803a40:	5d                   	pop    %rbp
+  803a41:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  803a42:	48 89 df             	mov    %rbx,%rdi
+  803a45:	48 b8 2d 2d 80 00 00 	movabs $0x802d2d,%rax
+  803a4c:	00 00 00 
+  803a4f:	ff d0                	call   *%rax
+  803a51:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  803a55:	48 b8 20 20 9d 00 00 	movabs $0x9d2020,%rax
+  803a5c:	00 00 00 
+  803a5f:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  803a66:	48 89 df             	mov    %rbx,%rdi
+  803a69:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  803a70:	00 00 00 
+  803a73:	ff d0                	call   *%rax
+  803a75:	48 89 c6             	mov    %rax,%rsi
+  803a78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a82:	48 b8 7c 23 80 00 00 	movabs $0x80237c,%rax
+  803a89:	00 00 00 
+  803a8c:	ff d0                	call   *%rax
+  803a8e:	eb 84                	jmp    803a14 <devfile_flush+0x2e>
+
+0000000000803a90 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a90:	55                   	push   %rbp
+  803a91:	48 89 e5             	mov    %rsp,%rbp
+  803a94:	41 55                	push   %r13
+  803a96:	41 54                	push   %r12
+  803a98:	53                   	push   %rbx
+  803a99:	48 83 ec 08          	sub    $0x8,%rsp
+  803a9d:	48 89 fb             	mov    %rdi,%rbx
+  803aa0:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  803aa3:	48 b8 01 35 80 00 00 	movabs $0x803501,%rax
+  803aaa:	00 00 00 
+  803aad:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803aaf:	48 85 c0             	test   %rax,%rax
+  803ab2:	74 51                	je     803b05 <devfile_trunc+0x75>
+  803ab4:	49 89 c4             	mov    %rax,%r12
+  803ab7:	48 89 c6             	mov    %rax,%rsi
+  803aba:	48 89 df             	mov    %rbx,%rdi
+  803abd:	48 b8 29 38 80 00 00 	movabs $0x803829,%rax
+  803ac4:	00 00 00 
+  803ac7:	ff d0                	call   *%rax
+  803ac9:	85 c0                	test   %eax,%eax
+  803acb:	78 2d                	js     803afa <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803acd:	48 b8 00 10 9d 00 00 	movabs $0x9d1000,%rax
+  803ad4:	00 00 00 
+  803ad7:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803ada:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803adc:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803ae0:	be 00 00 00 00       	mov    $0x0,%esi
+  803ae5:	bf 02 00 00 00       	mov    $0x2,%edi
+  803aea:	48 b8 2d 39 80 00 00 	movabs $0x80392d,%rax
+  803af1:	00 00 00 
+  803af4:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803af6:	85 c0                	test   %eax,%eax
+  803af8:	79 3e                	jns    803b38 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  803afa:	48 83 c4 08          	add    $0x8,%rsp
+  803afe:	5b                   	pop    %rbx
+  803aff:	41 5c                	pop    %r12
+  803b01:	41 5d                	pop    %r13
+  803b03:	5d                   	pop    %rbp
+  803b04:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803b05:	48 b8 00 10 9d 00 00 	movabs $0x9d1000,%rax
+  803b0c:	00 00 00 
+  803b0f:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803b12:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803b14:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803b18:	be 00 00 00 00       	mov    $0x0,%esi
+  803b1d:	bf 02 00 00 00       	mov    $0x2,%edi
+  803b22:	48 b8 2d 39 80 00 00 	movabs $0x80392d,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803b2e:	85 c0                	test   %eax,%eax
+  803b30:	78 c8                	js     803afa <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803b32:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803b36:	eb c2                	jmp    803afa <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803b38:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  803b3b:	8d 51 01             	lea    0x1(%rcx),%edx
+  803b3e:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803b41:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  803b46:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803b4d:	00 00 
+  803b4f:	eb a9                	jmp    803afa <devfile_trunc+0x6a>
+
+0000000000803b51 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803b51:	55                   	push   %rbp
+  803b52:	48 89 e5             	mov    %rsp,%rbp
+  803b55:	41 57                	push   %r15
+  803b57:	41 56                	push   %r14
+  803b59:	41 55                	push   %r13
+  803b5b:	41 54                	push   %r12
+  803b5d:	53                   	push   %rbx
+  803b5e:	48 83 ec 28          	sub    $0x28,%rsp
+  803b62:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b66:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803b6a:	49 89 d7             	mov    %rdx,%r15
+  803b6d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803b71:	48 b8 01 35 80 00 00 	movabs $0x803501,%rax
+  803b78:	00 00 00 
+  803b7b:	ff d0                	call   *%rax
+  803b7d:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  803b80:	48 85 c0             	test   %rax,%rax
+  803b83:	74 31                	je     803bb6 <devfile_write+0x65>
+  803b85:	4c 89 f8             	mov    %r15,%rax
+  803b88:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  803b8f:	77 25                	ja     803bb6 <devfile_write+0x65>
+    size_t i = 0;
+  803b91:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  803b97:	48 85 c0             	test   %rax,%rax
+  803b9a:	0f 85 64 01 00 00    	jne    803d04 <devfile_write+0x1b3>
+    size_t i = 0;
+  803ba0:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  803ba4:	4c 89 f8             	mov    %r15,%rax
+}
+  803ba7:	48 83 c4 28          	add    $0x28,%rsp
+  803bab:	5b                   	pop    %rbx
+  803bac:	41 5c                	pop    %r12
+  803bae:	41 5d                	pop    %r13
+  803bb0:	41 5e                	pop    %r14
+  803bb2:	41 5f                	pop    %r15
+  803bb4:	5d                   	pop    %rbp
+  803bb5:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803bb6:	48 85 db             	test   %rbx,%rbx
+  803bb9:	74 5b                	je     803c16 <devfile_write+0xc5>
+  803bbb:	48 89 de             	mov    %rbx,%rsi
+  803bbe:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bc2:	48 b8 29 38 80 00 00 	movabs $0x803829,%rax
+  803bc9:	00 00 00 
+  803bcc:	ff d0                	call   *%rax
+  803bce:	85 c0                	test   %eax,%eax
+  803bd0:	78 40                	js     803c12 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803bd2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bd6:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  803bd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bdd:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803be1:	48 b8 1e 37 80 00 00 	movabs $0x80371e,%rax
+  803be8:	00 00 00 
+  803beb:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803bed:	48 85 c0             	test   %rax,%rax
+  803bf0:	7e b5                	jle    803ba7 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803bf2:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803bf6:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  803bf9:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  803bfc:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803bff:	8d 51 01             	lea    0x1(%rcx),%edx
+  803c02:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803c05:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  803c08:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803c0f:	00 
+  803c10:	eb 95                	jmp    803ba7 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803c12:	48 98                	cltq
+  803c14:	eb 91                	jmp    803ba7 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803c16:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803c1a:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  803c1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c21:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803c25:	48 89 df             	mov    %rbx,%rdi
+  803c28:	48 b8 1e 37 80 00 00 	movabs $0x80371e,%rax
+  803c2f:	00 00 00 
+  803c32:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803c34:	48 85 c0             	test   %rax,%rax
+  803c37:	0f 8e 6a ff ff ff    	jle    803ba7 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803c3d:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803c40:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803c44:	e9 5e ff ff ff       	jmp    803ba7 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803c49:	48 98                	cltq
+  803c4b:	4d 85 ff             	test   %r15,%r15
+  803c4e:	49 0f 45 c7          	cmovne %r15,%rax
+  803c52:	e9 50 ff ff ff       	jmp    803ba7 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803c57:	48 89 de             	mov    %rbx,%rsi
+  803c5a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c5e:	48 b8 29 38 80 00 00 	movabs $0x803829,%rax
+  803c65:	00 00 00 
+  803c68:	ff d0                	call   *%rax
+  803c6a:	85 c0                	test   %eax,%eax
+  803c6c:	0f 88 2b 01 00 00    	js     803d9d <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803c72:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803c76:	4c 01 f8             	add    %r15,%rax
+  803c79:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803c7d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c81:	48 b9 2d 2d 80 00 00 	movabs $0x802d2d,%rcx
+  803c88:	00 00 00 
+  803c8b:	ff d1                	call   *%rcx
+  803c8d:	48 89 c2             	mov    %rax,%rdx
+  803c90:	48 c1 e2 04          	shl    $0x4,%rdx
+  803c94:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803c98:	48 c1 e0 0c          	shl    $0xc,%rax
+  803c9c:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803ca1:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803ca4:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803cab:	00 
+  803cac:	4c 89 ea             	mov    %r13,%rdx
+  803caf:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803cb3:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  803cba:	00 00 00 
+  803cbd:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803cbf:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803cc3:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803cc7:	48 39 c2             	cmp    %rax,%rdx
+  803cca:	0f 84 db 00 00 00    	je     803dab <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803cd0:	4c 39 e2             	cmp    %r12,%rdx
+  803cd3:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  803cd7:	4d 01 ec             	add    %r13,%r12
+  803cda:	49 39 c4             	cmp    %rax,%r12
+  803cdd:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803ce1:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803ce5:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  803ce9:	45 01 ee             	add    %r13d,%r14d
+  803cec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cf0:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803cf4:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803cf7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cfb:	49 39 c7             	cmp    %rax,%r15
+  803cfe:	0f 83 a0 fe ff ff    	jae    803ba4 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803d04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d08:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  803d0c:	8b 43 08             	mov    0x8(%rbx),%eax
+  803d0f:	44 39 f0             	cmp    %r14d,%eax
+  803d12:	7f 10                	jg     803d24 <devfile_write+0x1d3>
+  803d14:	48 98                	cltq
+  803d16:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  803d1c:	49 63 d6             	movslq %r14d,%rdx
+  803d1f:	48 39 d0             	cmp    %rdx,%rax
+  803d22:	7d 2d                	jge    803d51 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803d24:	48 89 de             	mov    %rbx,%rsi
+  803d27:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803d2b:	48 b8 29 38 80 00 00 	movabs $0x803829,%rax
+  803d32:	00 00 00 
+  803d35:	ff d0                	call   *%rax
+  803d37:	85 c0                	test   %eax,%eax
+  803d39:	0f 88 0a ff ff ff    	js     803c49 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803d3f:	44 89 f0             	mov    %r14d,%eax
+  803d42:	66 b8 00 00          	mov    $0x0,%ax
+  803d46:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803d49:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803d50:	00 
+        size_t off = pos - fb->fb_base;
+  803d51:	45 89 f4             	mov    %r14d,%r12d
+  803d54:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803d58:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803d5b:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803d5f:	4d 29 fd             	sub    %r15,%r13
+  803d62:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803d67:	4c 29 e0             	sub    %r12,%rax
+  803d6a:	49 39 c5             	cmp    %rax,%r13
+  803d6d:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803d71:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803d75:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803d79:	48 39 c2             	cmp    %rax,%rdx
+  803d7c:	0f 84 f0 fe ff ff    	je     803c72 <devfile_write+0x121>
+  803d82:	4c 39 e0             	cmp    %r12,%rax
+  803d85:	0f 82 cc fe ff ff    	jb     803c57 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803d8b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803d8f:	48 39 d0             	cmp    %rdx,%rax
+  803d92:	0f 83 da fe ff ff    	jae    803c72 <devfile_write+0x121>
+  803d98:	e9 ba fe ff ff       	jmp    803c57 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803d9d:	48 98                	cltq
+  803d9f:	4d 85 ff             	test   %r15,%r15
+  803da2:	49 0f 45 c7          	cmovne %r15,%rax
+  803da6:	e9 fc fd ff ff       	jmp    803ba7 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803dab:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803daf:	4c 89 e2             	mov    %r12,%rdx
+  803db2:	e9 2a ff ff ff       	jmp    803ce1 <devfile_write+0x190>
+
+0000000000803db7 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803db7:	55                   	push   %rbp
+  803db8:	48 89 e5             	mov    %rsp,%rbp
+  803dbb:	41 57                	push   %r15
+  803dbd:	41 56                	push   %r14
+  803dbf:	41 55                	push   %r13
+  803dc1:	41 54                	push   %r12
+  803dc3:	53                   	push   %rbx
+  803dc4:	48 83 ec 28          	sub    $0x28,%rsp
+  803dc8:	49 89 ff             	mov    %rdi,%r15
+  803dcb:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803dcf:	48 89 d3             	mov    %rdx,%rbx
+  803dd2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803dd6:	48 b8 01 35 80 00 00 	movabs $0x803501,%rax
+  803ddd:	00 00 00 
+  803de0:	ff d0                	call   *%rax
+  803de2:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803de5:	48 85 c0             	test   %rax,%rax
+  803de8:	74 0d                	je     803df7 <devfile_read+0x40>
+  803dea:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803df1:	0f 86 1a 01 00 00    	jbe    803f11 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803df7:	4d 85 e4             	test   %r12,%r12
+  803dfa:	74 1a                	je     803e16 <devfile_read+0x5f>
+  803dfc:	4c 89 e6             	mov    %r12,%rsi
+  803dff:	4c 89 ff             	mov    %r15,%rdi
+  803e02:	48 b8 29 38 80 00 00 	movabs $0x803829,%rax
+  803e09:	00 00 00 
+  803e0c:	ff d0                	call   *%rax
+  803e0e:	85 c0                	test   %eax,%eax
+  803e10:	0f 88 e8 00 00 00    	js     803efe <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803e16:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  803e1a:	48 b8 1b 36 80 00 00 	movabs $0x80361b,%rax
+  803e21:	00 00 00 
+  803e24:	ff d0                	call   *%rax
+  803e26:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803e29:	48 85 c0             	test   %rax,%rax
+  803e2c:	0f 84 69 02 00 00    	je     80409b <devfile_read+0x2e4>
+    while (i < n) {
+  803e32:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803e37:	0f 84 ce 00 00 00    	je     803f0b <devfile_read+0x154>
+    size_t i = 0;
+  803e3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803e42:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803e49:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803e4d:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803e51:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803e55:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803e59:	48 29 da             	sub    %rbx,%rdx
+  803e5c:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803e61:	48 39 c2             	cmp    %rax,%rdx
+  803e64:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803e68:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803e6c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803e70:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803e73:	01 d8                	add    %ebx,%eax
+  803e75:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803e79:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803e7d:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803e84:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803e8b:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803e92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803e98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e9d:	4c 89 ee             	mov    %r13,%rsi
+  803ea0:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ea5:	48 b8 81 36 80 00 00 	movabs $0x803681,%rax
+  803eac:	00 00 00 
+  803eaf:	ff d0                	call   *%rax
+        if (res < 0)
+  803eb1:	85 c0                	test   %eax,%eax
+  803eb3:	78 4d                	js     803f02 <devfile_read+0x14b>
+        if (res == 0)
+  803eb5:	74 4f                	je     803f06 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803eb7:	4c 63 e0             	movslq %eax,%r12
+  803eba:	4c 89 e2             	mov    %r12,%rdx
+  803ebd:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803ec1:	4c 89 f7             	mov    %r14,%rdi
+  803ec4:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  803ecb:	00 00 00 
+  803ece:	ff d0                	call   *%rax
+        i += res;
+  803ed0:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803ed3:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803ed6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eda:	48 39 c3             	cmp    %rax,%rbx
+  803edd:	0f 82 72 ff ff ff    	jb     803e55 <devfile_read+0x9e>
+    return i;
+  803ee3:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803ee6:	48 85 c0             	test   %rax,%rax
+  803ee9:	7e 04                	jle    803eef <devfile_read+0x138>
+  803eeb:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803eef:	48 83 c4 28          	add    $0x28,%rsp
+  803ef3:	5b                   	pop    %rbx
+  803ef4:	41 5c                	pop    %r12
+  803ef6:	41 5d                	pop    %r13
+  803ef8:	41 5e                	pop    %r14
+  803efa:	41 5f                	pop    %r15
+  803efc:	5d                   	pop    %rbp
+  803efd:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803efe:	48 98                	cltq
+  803f00:	eb ed                	jmp    803eef <devfile_read+0x138>
+            return res;
+  803f02:	48 98                	cltq
+  803f04:	eb e9                	jmp    803eef <devfile_read+0x138>
+            return i;
+  803f06:	48 89 d8             	mov    %rbx,%rax
+  803f09:	eb db                	jmp    803ee6 <devfile_read+0x12f>
+    size_t i = 0;
+  803f0b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803f0f:	eb d2                	jmp    803ee3 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803f11:	48 89 c6             	mov    %rax,%rsi
+  803f14:	4c 89 ff             	mov    %r15,%rdi
+  803f17:	48 b8 29 38 80 00 00 	movabs $0x803829,%rax
+  803f1e:	00 00 00 
+  803f21:	ff d0                	call   *%rax
+  803f23:	85 c0                	test   %eax,%eax
+  803f25:	78 40                	js     803f67 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803f27:	4c 89 ff             	mov    %r15,%rdi
+  803f2a:	48 b8 2d 2d 80 00 00 	movabs $0x802d2d,%rax
+  803f31:	00 00 00 
+  803f34:	ff d0                	call   *%rax
+  803f36:	48 89 c2             	mov    %rax,%rdx
+  803f39:	48 c1 e2 04          	shl    $0x4,%rdx
+  803f3d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803f41:	48 c1 e0 0c          	shl    $0xc,%rax
+  803f45:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803f4a:	48 01 d0             	add    %rdx,%rax
+  803f4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803f51:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f56:	0f 84 33 01 00 00    	je     80408f <devfile_read+0x2d8>
+    size_t i = 0;
+  803f5c:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803f62:	e9 f5 00 00 00       	jmp    80405c <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803f67:	48 98                	cltq
+  803f69:	eb 84                	jmp    803eef <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803f6b:	44 89 e8             	mov    %r13d,%eax
+  803f6e:	66 b8 00 00          	mov    $0x0,%ax
+  803f72:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803f77:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803f7e:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803f80:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803f84:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803f88:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803f8a:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803f8f:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803f92:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803f99:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803f9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803fa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803fa5:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803faa:	bf 03 00 00 00       	mov    $0x3,%edi
+  803faf:	48 b8 81 36 80 00 00 	movabs $0x803681,%rax
+  803fb6:	00 00 00 
+  803fb9:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803fbb:	85 c0                	test   %eax,%eax
+  803fbd:	0f 88 be 00 00 00    	js     804081 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803fc3:	48 63 d0             	movslq %eax,%rdx
+  803fc6:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803fcb:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803fd0:	44 39 e8             	cmp    %r13d,%eax
+  803fd3:	0f 8e ba 00 00 00    	jle    804093 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803fd9:	49 63 c5             	movslq %r13d,%rax
+  803fdc:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803fe1:	48 29 c3             	sub    %rax,%rbx
+  803fe4:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803fe9:	48 01 c3             	add    %rax,%rbx
+  803fec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ff0:	4c 29 f0             	sub    %r14,%rax
+  803ff3:	48 39 c3             	cmp    %rax,%rbx
+  803ff6:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803ffa:	4c 89 ff             	mov    %r15,%rdi
+  803ffd:	48 b9 2d 2d 80 00 00 	movabs $0x802d2d,%rcx
+  804004:	00 00 00 
+  804007:	ff d1                	call   *%rcx
+  804009:	48 89 c2             	mov    %rax,%rdx
+  80400c:	48 c1 e2 04          	shl    $0x4,%rdx
+  804010:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  804014:	48 c1 e0 0c          	shl    $0xc,%rax
+  804018:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  80401d:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  804020:	44 89 ea             	mov    %r13d,%edx
+  804023:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  804028:	48 63 d2             	movslq %edx,%rdx
+  80402b:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  804032:	00 
+  804033:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  804037:	4c 01 f7             	add    %r14,%rdi
+  80403a:	48 89 da             	mov    %rbx,%rdx
+  80403d:	48 b9 32 1e 80 00 00 	movabs $0x801e32,%rcx
+  804044:	00 00 00 
+  804047:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  804049:	41 01 dd             	add    %ebx,%r13d
+  80404c:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  804050:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  804053:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804057:	49 39 c6             	cmp    %rax,%r14
+  80405a:	73 37                	jae    804093 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  80405c:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  804060:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  804065:	44 39 e8             	cmp    %r13d,%eax
+  804068:	0f 8f fd fe ff ff    	jg     803f6b <devfile_read+0x1b4>
+  80406e:	41 03 44 24 10       	add    0x10(%r12),%eax
+  804073:	44 39 e8             	cmp    %r13d,%eax
+  804076:	0f 8f 5d ff ff ff    	jg     803fd9 <devfile_read+0x222>
+  80407c:	e9 ea fe ff ff       	jmp    803f6b <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  804081:	48 98                	cltq
+  804083:	4d 85 f6             	test   %r14,%r14
+  804086:	49 0f 45 c6          	cmovne %r14,%rax
+  80408a:	e9 60 fe ff ff       	jmp    803eef <devfile_read+0x138>
+    size_t i = 0;
+  80408f:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  804093:	4c 89 f0             	mov    %r14,%rax
+  804096:	e9 54 fe ff ff       	jmp    803eef <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80409b:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8040a2:	e9 48 fe ff ff       	jmp    803eef <devfile_read+0x138>
+
+00000000008040a7 <open>:
+open(const char *path, int mode) {
+  8040a7:	55                   	push   %rbp
+  8040a8:	48 89 e5             	mov    %rsp,%rbp
+  8040ab:	41 55                	push   %r13
+  8040ad:	41 54                	push   %r12
+  8040af:	53                   	push   %rbx
+  8040b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8040b4:	49 89 fc             	mov    %rdi,%r12
+  8040b7:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8040ba:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  8040c1:	00 00 00 
+  8040c4:	ff d0                	call   *%rax
+  8040c6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8040cc:	0f 87 8a 00 00 00    	ja     80415c <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8040d2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8040d6:	48 b8 5b 2d 80 00 00 	movabs $0x802d5b,%rax
+  8040dd:	00 00 00 
+  8040e0:	ff d0                	call   *%rax
+  8040e2:	89 c3                	mov    %eax,%ebx
+  8040e4:	85 c0                	test   %eax,%eax
+  8040e6:	78 50                	js     804138 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8040e8:	4c 89 e6             	mov    %r12,%rsi
+  8040eb:	48 bb 00 10 9d 00 00 	movabs $0x9d1000,%rbx
+  8040f2:	00 00 00 
+  8040f5:	48 89 df             	mov    %rbx,%rdi
+  8040f8:	48 b8 3d 1a 80 00 00 	movabs $0x801a3d,%rax
+  8040ff:	00 00 00 
+  804102:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  804104:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80410b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80410f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804114:	48 b8 2d 39 80 00 00 	movabs $0x80392d,%rax
+  80411b:	00 00 00 
+  80411e:	ff d0                	call   *%rax
+  804120:	89 c3                	mov    %eax,%ebx
+  804122:	85 c0                	test   %eax,%eax
+  804124:	78 1f                	js     804145 <open+0x9e>
+    return fd2num(fd);
+  804126:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80412a:	48 b8 2d 2d 80 00 00 	movabs $0x802d2d,%rax
+  804131:	00 00 00 
+  804134:	ff d0                	call   *%rax
+  804136:	89 c3                	mov    %eax,%ebx
+}
+  804138:	89 d8                	mov    %ebx,%eax
+  80413a:	48 83 c4 18          	add    $0x18,%rsp
+  80413e:	5b                   	pop    %rbx
+  80413f:	41 5c                	pop    %r12
+  804141:	41 5d                	pop    %r13
+  804143:	5d                   	pop    %rbp
+  804144:	c3                   	ret
+        fd_close(fd, 0);
+  804145:	be 00 00 00 00       	mov    $0x0,%esi
+  80414a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80414e:	48 b8 76 2e 80 00 00 	movabs $0x802e76,%rax
+  804155:	00 00 00 
+  804158:	ff d0                	call   *%rax
+        return res;
+  80415a:	eb dc                	jmp    804138 <open+0x91>
+        return -E_BAD_PATH;
+  80415c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804161:	eb d5                	jmp    804138 <open+0x91>
+
+0000000000804163 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  804163:	55                   	push   %rbp
+  804164:	48 89 e5             	mov    %rsp,%rbp
+  804167:	41 57                	push   %r15
+  804169:	41 56                	push   %r14
+  80416b:	41 55                	push   %r13
+  80416d:	41 54                	push   %r12
+  80416f:	53                   	push   %rbx
+  804170:	48 83 ec 18          	sub    $0x18,%rsp
+  804174:	41 89 f6             	mov    %esi,%r14d
+  804177:	49 89 d7             	mov    %rdx,%r15
+  80417a:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80417d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804181:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  804188:	00 00 00 
+  80418b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80418d:	85 c0                	test   %eax,%eax
+  80418f:	0f 88 db 00 00 00    	js     804270 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804195:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804199:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8041a0:	00 00 00 
+  8041a3:	8b 00                	mov    (%rax),%eax
+  8041a5:	39 07                	cmp    %eax,(%rdi)
+  8041a7:	0f 85 db 00 00 00    	jne    804288 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8041ad:	45 85 f6             	test   %r14d,%r14d
+  8041b0:	0f 88 db 00 00 00    	js     804291 <fmap+0x12e>
+  8041b6:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8041bd:	0f 85 d7 00 00 00    	jne    80429a <fmap+0x137>
+  8041c3:	4c 89 fb             	mov    %r15,%rbx
+  8041c6:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8041cc:	0f 85 d1 00 00 00    	jne    8042a3 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8041d2:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  8041d9:	00 00 00 
+  8041dc:	ff d0                	call   *%rax
+  8041de:	85 c0                	test   %eax,%eax
+  8041e0:	0f 88 8e 00 00 00    	js     804274 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8041e6:	49 bc 00 10 9d 00 00 	movabs $0x9d1000,%r12
+  8041ed:	00 00 00 
+    while (i < n) {
+  8041f0:	4d 85 ed             	test   %r13,%r13
+  8041f3:	0f 84 8a 00 00 00    	je     804283 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8041f9:	4c 89 ea             	mov    %r13,%rdx
+  8041fc:	48 29 da             	sub    %rbx,%rdx
+  8041ff:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  804206:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80420c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804210:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804214:	8b 40 0c             	mov    0xc(%rax),%eax
+  804217:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80421b:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  80421f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  804224:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  804229:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80422d:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  804231:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804236:	4c 89 e6             	mov    %r12,%rsi
+  804239:	bf 09 00 00 00       	mov    $0x9,%edi
+  80423e:	48 b8 81 36 80 00 00 	movabs $0x803681,%rax
+  804245:	00 00 00 
+  804248:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80424a:	85 c0                	test   %eax,%eax
+  80424c:	78 2a                	js     804278 <fmap+0x115>
+        i += res;
+  80424e:	48 98                	cltq
+  804250:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  804253:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  804257:	72 05                	jb     80425e <fmap+0xfb>
+    while (i < n) {
+  804259:	4c 39 eb             	cmp    %r13,%rbx
+  80425c:	72 9b                	jb     8041f9 <fmap+0x96>
+    }
+    return i;
+  80425e:	48 89 d8             	mov    %rbx,%rax
+}
+  804261:	48 83 c4 18          	add    $0x18,%rsp
+  804265:	5b                   	pop    %rbx
+  804266:	41 5c                	pop    %r12
+  804268:	41 5d                	pop    %r13
+  80426a:	41 5e                	pop    %r14
+  80426c:	41 5f                	pop    %r15
+  80426e:	5d                   	pop    %rbp
+  80426f:	c3                   	ret
+    if (res < 0) return res;
+  804270:	48 98                	cltq
+  804272:	eb ed                	jmp    804261 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  804274:	48 98                	cltq
+  804276:	eb e9                	jmp    804261 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  804278:	48 98                	cltq
+  80427a:	48 85 db             	test   %rbx,%rbx
+  80427d:	48 0f 45 c3          	cmovne %rbx,%rax
+  804281:	eb de                	jmp    804261 <fmap+0xfe>
+    size_t i = 0;
+  804283:	4c 89 eb             	mov    %r13,%rbx
+  804286:	eb d6                	jmp    80425e <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804288:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80428f:	eb d0                	jmp    804261 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  804291:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804298:	eb c7                	jmp    804261 <fmap+0xfe>
+  80429a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8042a1:	eb be                	jmp    804261 <fmap+0xfe>
+  8042a3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8042aa:	eb b5                	jmp    804261 <fmap+0xfe>
+
+00000000008042ac <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8042ac:	55                   	push   %rbp
+  8042ad:	48 89 e5             	mov    %rsp,%rbp
+  8042b0:	41 56                	push   %r14
+  8042b2:	41 55                	push   %r13
+  8042b4:	41 54                	push   %r12
+  8042b6:	53                   	push   %rbx
+  8042b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8042bb:	89 fb                	mov    %edi,%ebx
+  8042bd:	41 89 f4             	mov    %esi,%r12d
+  8042c0:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8042c3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8042c7:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  8042ce:	00 00 00 
+  8042d1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042d3:	85 c0                	test   %eax,%eax
+  8042d5:	78 63                	js     80433a <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8042d7:	45 85 e4             	test   %r12d,%r12d
+  8042da:	0f 88 80 00 00 00    	js     804360 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8042e0:	45 89 e6             	mov    %r12d,%r14d
+  8042e3:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8042ea:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8042ee:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  8042f5:	00 00 00 
+  8042f8:	ff d0                	call   *%rax
+  8042fa:	48 89 c2             	mov    %rax,%rdx
+  8042fd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804302:	44 89 f6             	mov    %r14d,%esi
+  804305:	89 df                	mov    %ebx,%edi
+  804307:	48 b8 63 41 80 00 00 	movabs $0x804163,%rax
+  80430e:	00 00 00 
+  804311:	ff d0                	call   *%rax
+  804313:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  804316:	45 29 f4             	sub    %r14d,%r12d
+  804319:	4d 63 f4             	movslq %r12d,%r14
+  80431c:	49 39 c6             	cmp    %rax,%r14
+  80431f:	7c 1d                	jl     80433e <read_map+0x92>
+  804321:	48 85 c0             	test   %rax,%rax
+  804324:	b8 00 00 00 00       	mov    $0x0,%eax
+  804329:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80432d:	48 83 c4 10          	add    $0x10,%rsp
+  804331:	5b                   	pop    %rbx
+  804332:	41 5c                	pop    %r12
+  804334:	41 5d                	pop    %r13
+  804336:	41 5e                	pop    %r14
+  804338:	5d                   	pop    %rbp
+  804339:	c3                   	ret
+    if (res < 0) return res;
+  80433a:	48 98                	cltq
+  80433c:	eb ef                	jmp    80432d <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  80433e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804342:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  804349:	00 00 00 
+  80434c:	ff d0                	call   *%rax
+  80434e:	4d 63 e4             	movslq %r12d,%r12
+  804351:	4c 01 e0             	add    %r12,%rax
+  804354:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  804358:	48 89 d8             	mov    %rbx,%rax
+  80435b:	4c 29 f0             	sub    %r14,%rax
+  80435e:	eb cd                	jmp    80432d <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  804360:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804367:	eb c4                	jmp    80432d <read_map+0x81>
+
+0000000000804369 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  804369:	55                   	push   %rbp
+  80436a:	48 89 e5             	mov    %rsp,%rbp
+  80436d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804371:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804375:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  80437c:	00 00 00 
+  80437f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804381:	85 c0                	test   %eax,%eax
+  804383:	78 4a                	js     8043cf <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804385:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804389:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  804390:	00 00 00 
+  804393:	8b 00                	mov    (%rax),%eax
+  804395:	39 07                	cmp    %eax,(%rdi)
+  804397:	75 38                	jne    8043d1 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  804399:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  8043a0:	00 00 00 
+  8043a3:	ff d0                	call   *%rax
+  8043a5:	85 c0                	test   %eax,%eax
+  8043a7:	78 26                	js     8043cf <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8043a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ad:	8b 40 0c             	mov    0xc(%rax),%eax
+  8043b0:	a3 00 10 9d 00 00 00 	movabs %eax,0x9d1000
+  8043b7:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8043b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8043be:	bf 06 00 00 00       	mov    $0x6,%edi
+  8043c3:	48 b8 2d 39 80 00 00 	movabs $0x80392d,%rax
+  8043ca:	00 00 00 
+  8043cd:	ff d0                	call   *%rax
+}
+  8043cf:	c9                   	leave
+  8043d0:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8043d1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8043d6:	eb f7                	jmp    8043cf <fsync+0x66>
+
+00000000008043d8 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8043d8:	55                   	push   %rbp
+  8043d9:	48 89 e5             	mov    %rsp,%rbp
+  8043dc:	41 57                	push   %r15
+  8043de:	41 56                	push   %r14
+  8043e0:	41 55                	push   %r13
+  8043e2:	41 54                	push   %r12
+  8043e4:	53                   	push   %rbx
+  8043e5:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8043e9:	49 bc 20 20 9d 00 00 	movabs $0x9d2020,%r12
+  8043f0:	00 00 00 
+  8043f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8043f8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8043fe:	49 bd bb 2d 80 00 00 	movabs $0x802dbb,%r13
+  804405:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  804408:	49 be 40 70 80 00 00 	movabs $0x807040,%r14
+  80440f:	00 00 00 
+  804412:	eb 0c                	jmp    804420 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  804414:	83 c3 01             	add    $0x1,%ebx
+  804417:	49 83 c4 28          	add    $0x28,%r12
+  80441b:	83 fb 20             	cmp    $0x20,%ebx
+  80441e:	74 33                	je     804453 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  804420:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  804425:	74 ed                	je     804414 <flushall+0x3c>
+  804427:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80442b:	89 df                	mov    %ebx,%edi
+  80442d:	41 ff d5             	call   *%r13
+  804430:	85 c0                	test   %eax,%eax
+  804432:	78 e0                	js     804414 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  804434:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  804438:	41 8b 06             	mov    (%r14),%eax
+  80443b:	39 07                	cmp    %eax,(%rdi)
+  80443d:	75 d5                	jne    804414 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  80443f:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  804446:	00 00 00 
+  804449:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80444b:	85 c0                	test   %eax,%eax
+  80444d:	44 0f 48 f8          	cmovs  %eax,%r15d
+  804451:	eb c1                	jmp    804414 <flushall+0x3c>
+    }
+    return res;
+}
+  804453:	44 89 f8             	mov    %r15d,%eax
+  804456:	48 83 c4 18          	add    $0x18,%rsp
+  80445a:	5b                   	pop    %rbx
+  80445b:	41 5c                	pop    %r12
+  80445d:	41 5d                	pop    %r13
+  80445f:	41 5e                	pop    %r14
+  804461:	41 5f                	pop    %r15
+  804463:	5d                   	pop    %rbp
+  804464:	c3                   	ret
+
+0000000000804465 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  804465:	55                   	push   %rbp
+  804466:	48 89 e5             	mov    %rsp,%rbp
+  804469:	53                   	push   %rbx
+  80446a:	48 83 ec 08          	sub    $0x8,%rsp
+  80446e:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  804471:	40 0f b6 c6          	movzbl %sil,%eax
+  804475:	a3 00 10 9d 00 00 00 	movabs %eax,0x9d1000
+  80447c:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  80447e:	be 00 00 00 00       	mov    $0x0,%esi
+  804483:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804488:	48 b8 2d 39 80 00 00 	movabs $0x80392d,%rax
+  80448f:	00 00 00 
+  804492:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804494:	85 c0                	test   %eax,%eax
+  804496:	78 23                	js     8044bb <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  804498:	ba 58 06 00 00       	mov    $0x658,%edx
+  80449d:	48 be 00 10 9d 00 00 	movabs $0x9d1000,%rsi
+  8044a4:	00 00 00 
+  8044a7:	48 89 df             	mov    %rbx,%rdi
+  8044aa:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  8044b1:	00 00 00 
+  8044b4:	ff d0                	call   *%rax
+    return 0;
+  8044b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8044bf:	c9                   	leave
+  8044c0:	c3                   	ret
+
+00000000008044c1 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8044c1:	55                   	push   %rbp
+  8044c2:	48 89 e5             	mov    %rsp,%rbp
+  8044c5:	53                   	push   %rbx
+  8044c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8044ca:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8044cd:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  8044d4:	00 00 00 
+  8044d7:	ff d0                	call   *%rax
+  8044d9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8044df:	77 35                	ja     804516 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8044e1:	48 89 de             	mov    %rbx,%rsi
+  8044e4:	48 bf 00 10 9d 00 00 	movabs $0x9d1000,%rdi
+  8044eb:	00 00 00 
+  8044ee:	48 b8 3d 1a 80 00 00 	movabs $0x801a3d,%rax
+  8044f5:	00 00 00 
+  8044f8:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8044fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8044ff:	bf 07 00 00 00       	mov    $0x7,%edi
+  804504:	48 b8 2d 39 80 00 00 	movabs $0x80392d,%rax
+  80450b:	00 00 00 
+  80450e:	ff d0                	call   *%rax
+}
+  804510:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804514:	c9                   	leave
+  804515:	c3                   	ret
+        return -E_BAD_PATH;
+  804516:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80451b:	eb f3                	jmp    804510 <remove+0x4f>
+
+000000000080451d <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80451d:	55                   	push   %rbp
+  80451e:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  804521:	48 b8 d8 43 80 00 00 	movabs $0x8043d8,%rax
+  804528:	00 00 00 
+  80452b:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80452d:	be 00 00 00 00       	mov    $0x0,%esi
+  804532:	bf 08 00 00 00       	mov    $0x8,%edi
+  804537:	48 b8 2d 39 80 00 00 	movabs $0x80392d,%rax
+  80453e:	00 00 00 
+  804541:	ff d0                	call   *%rax
+}
+  804543:	5d                   	pop    %rbp
+  804544:	c3                   	ret
+
+0000000000804545 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804545:	55                   	push   %rbp
+  804546:	48 89 e5             	mov    %rsp,%rbp
+  804549:	41 54                	push   %r12
+  80454b:	53                   	push   %rbx
+  80454c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80454f:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  804556:	00 00 00 
+  804559:	ff d0                	call   *%rax
+  80455b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80455e:	48 be 40 68 80 00 00 	movabs $0x806840,%rsi
+  804565:	00 00 00 
+  804568:	48 89 df             	mov    %rbx,%rdi
+  80456b:	48 b8 3d 1a 80 00 00 	movabs $0x801a3d,%rax
+  804572:	00 00 00 
+  804575:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804577:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80457c:	41 2b 04 24          	sub    (%r12),%eax
+  804580:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804586:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80458d:	00 00 00 
+    stat->st_dev = &devpipe;
+  804590:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804597:	00 00 00 
+  80459a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8045a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a6:	5b                   	pop    %rbx
+  8045a7:	41 5c                	pop    %r12
+  8045a9:	5d                   	pop    %rbp
+  8045aa:	c3                   	ret
+
+00000000008045ab <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8045ab:	55                   	push   %rbp
+  8045ac:	48 89 e5             	mov    %rsp,%rbp
+  8045af:	41 54                	push   %r12
+  8045b1:	53                   	push   %rbx
+  8045b2:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8045b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045ba:	48 89 fe             	mov    %rdi,%rsi
+  8045bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045c2:	49 bc 7c 23 80 00 00 	movabs $0x80237c,%r12
+  8045c9:	00 00 00 
+  8045cc:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8045cf:	48 89 df             	mov    %rbx,%rdi
+  8045d2:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  8045d9:	00 00 00 
+  8045dc:	ff d0                	call   *%rax
+  8045de:	48 89 c6             	mov    %rax,%rsi
+  8045e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045eb:	41 ff d4             	call   *%r12
+}
+  8045ee:	5b                   	pop    %rbx
+  8045ef:	41 5c                	pop    %r12
+  8045f1:	5d                   	pop    %rbp
+  8045f2:	c3                   	ret
+
+00000000008045f3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8045f3:	55                   	push   %rbp
+  8045f4:	48 89 e5             	mov    %rsp,%rbp
+  8045f7:	41 57                	push   %r15
+  8045f9:	41 56                	push   %r14
+  8045fb:	41 55                	push   %r13
+  8045fd:	41 54                	push   %r12
+  8045ff:	53                   	push   %rbx
+  804600:	48 83 ec 18          	sub    $0x18,%rsp
+  804604:	49 89 fc             	mov    %rdi,%r12
+  804607:	49 89 f5             	mov    %rsi,%r13
+  80460a:	49 89 d7             	mov    %rdx,%r15
+  80460d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804611:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  804618:	00 00 00 
+  80461b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80461d:	4d 85 ff             	test   %r15,%r15
+  804620:	0f 84 af 00 00 00    	je     8046d5 <devpipe_write+0xe2>
+  804626:	48 89 c3             	mov    %rax,%rbx
+  804629:	4c 89 f8             	mov    %r15,%rax
+  80462c:	4d 89 ef             	mov    %r13,%r15
+  80462f:	4c 01 e8             	add    %r13,%rax
+  804632:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804636:	49 bd 71 21 80 00 00 	movabs $0x802171,%r13
+  80463d:	00 00 00 
+            sys_yield();
+  804640:	49 be 0e 21 80 00 00 	movabs $0x80210e,%r14
+  804647:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80464a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80464d:	48 63 ce             	movslq %esi,%rcx
+  804650:	48 63 03             	movslq (%rbx),%rax
+  804653:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804659:	48 39 c1             	cmp    %rax,%rcx
+  80465c:	72 2e                	jb     80468c <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80465e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804663:	48 89 da             	mov    %rbx,%rdx
+  804666:	be 00 10 00 00       	mov    $0x1000,%esi
+  80466b:	4c 89 e7             	mov    %r12,%rdi
+  80466e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804671:	85 c0                	test   %eax,%eax
+  804673:	74 66                	je     8046db <devpipe_write+0xe8>
+            sys_yield();
+  804675:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804678:	8b 73 04             	mov    0x4(%rbx),%esi
+  80467b:	48 63 ce             	movslq %esi,%rcx
+  80467e:	48 63 03             	movslq (%rbx),%rax
+  804681:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804687:	48 39 c1             	cmp    %rax,%rcx
+  80468a:	73 d2                	jae    80465e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80468c:	41 0f b6 3f          	movzbl (%r15),%edi
+  804690:	48 89 ca             	mov    %rcx,%rdx
+  804693:	48 c1 ea 03          	shr    $0x3,%rdx
+  804697:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80469e:	08 10 20 
+  8046a1:	48 f7 e2             	mul    %rdx
+  8046a4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8046a8:	48 89 d0             	mov    %rdx,%rax
+  8046ab:	48 c1 e0 09          	shl    $0x9,%rax
+  8046af:	48 29 d0             	sub    %rdx,%rax
+  8046b2:	48 c1 e0 03          	shl    $0x3,%rax
+  8046b6:	48 29 c1             	sub    %rax,%rcx
+  8046b9:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8046be:	83 c6 01             	add    $0x1,%esi
+  8046c1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8046c4:	49 83 c7 01          	add    $0x1,%r15
+  8046c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046cc:	49 39 c7             	cmp    %rax,%r15
+  8046cf:	0f 85 75 ff ff ff    	jne    80464a <devpipe_write+0x57>
+    return n;
+  8046d5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046d9:	eb 05                	jmp    8046e0 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8046db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046e0:	48 83 c4 18          	add    $0x18,%rsp
+  8046e4:	5b                   	pop    %rbx
+  8046e5:	41 5c                	pop    %r12
+  8046e7:	41 5d                	pop    %r13
+  8046e9:	41 5e                	pop    %r14
+  8046eb:	41 5f                	pop    %r15
+  8046ed:	5d                   	pop    %rbp
+  8046ee:	c3                   	ret
+
+00000000008046ef <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8046ef:	55                   	push   %rbp
+  8046f0:	48 89 e5             	mov    %rsp,%rbp
+  8046f3:	41 57                	push   %r15
+  8046f5:	41 56                	push   %r14
+  8046f7:	41 55                	push   %r13
+  8046f9:	41 54                	push   %r12
+  8046fb:	53                   	push   %rbx
+  8046fc:	48 83 ec 18          	sub    $0x18,%rsp
+  804700:	49 89 fc             	mov    %rdi,%r12
+  804703:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804707:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80470b:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  804712:	00 00 00 
+  804715:	ff d0                	call   *%rax
+  804717:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80471a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804720:	49 bd 71 21 80 00 00 	movabs $0x802171,%r13
+  804727:	00 00 00 
+            sys_yield();
+  80472a:	49 be 0e 21 80 00 00 	movabs $0x80210e,%r14
+  804731:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804734:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804739:	74 7d                	je     8047b8 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80473b:	8b 03                	mov    (%rbx),%eax
+  80473d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804740:	75 26                	jne    804768 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804742:	4d 85 ff             	test   %r15,%r15
+  804745:	75 77                	jne    8047be <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804747:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80474c:	48 89 da             	mov    %rbx,%rdx
+  80474f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804754:	4c 89 e7             	mov    %r12,%rdi
+  804757:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80475a:	85 c0                	test   %eax,%eax
+  80475c:	74 72                	je     8047d0 <devpipe_read+0xe1>
+            sys_yield();
+  80475e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804761:	8b 03                	mov    (%rbx),%eax
+  804763:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804766:	74 df                	je     804747 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804768:	48 63 c8             	movslq %eax,%rcx
+  80476b:	48 89 ca             	mov    %rcx,%rdx
+  80476e:	48 c1 ea 03          	shr    $0x3,%rdx
+  804772:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804779:	08 10 20 
+  80477c:	48 89 d0             	mov    %rdx,%rax
+  80477f:	48 f7 e6             	mul    %rsi
+  804782:	48 c1 ea 06          	shr    $0x6,%rdx
+  804786:	48 89 d0             	mov    %rdx,%rax
+  804789:	48 c1 e0 09          	shl    $0x9,%rax
+  80478d:	48 29 d0             	sub    %rdx,%rax
+  804790:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804797:	00 
+  804798:	48 89 c8             	mov    %rcx,%rax
+  80479b:	48 29 d0             	sub    %rdx,%rax
+  80479e:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8047a3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8047a7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8047ab:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8047ae:	49 83 c7 01          	add    $0x1,%r15
+  8047b2:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8047b6:	75 83                	jne    80473b <devpipe_read+0x4c>
+    return n;
+  8047b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047bc:	eb 03                	jmp    8047c1 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8047be:	4c 89 f8             	mov    %r15,%rax
+}
+  8047c1:	48 83 c4 18          	add    $0x18,%rsp
+  8047c5:	5b                   	pop    %rbx
+  8047c6:	41 5c                	pop    %r12
+  8047c8:	41 5d                	pop    %r13
+  8047ca:	41 5e                	pop    %r14
+  8047cc:	41 5f                	pop    %r15
+  8047ce:	5d                   	pop    %rbp
+  8047cf:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8047d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047d5:	eb ea                	jmp    8047c1 <devpipe_read+0xd2>
+
+00000000008047d7 <pipe>:
+pipe(int pfd[2]) {
+  8047d7:	55                   	push   %rbp
+  8047d8:	48 89 e5             	mov    %rsp,%rbp
+  8047db:	41 55                	push   %r13
+  8047dd:	41 54                	push   %r12
+  8047df:	53                   	push   %rbx
+  8047e0:	48 83 ec 18          	sub    $0x18,%rsp
+  8047e4:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8047e7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8047eb:	48 b8 5b 2d 80 00 00 	movabs $0x802d5b,%rax
+  8047f2:	00 00 00 
+  8047f5:	ff d0                	call   *%rax
+  8047f7:	89 c3                	mov    %eax,%ebx
+  8047f9:	85 c0                	test   %eax,%eax
+  8047fb:	0f 88 a0 01 00 00    	js     8049a1 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804801:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804806:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80480b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80480f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804814:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  80481b:	00 00 00 
+  80481e:	ff d0                	call   *%rax
+  804820:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804822:	85 c0                	test   %eax,%eax
+  804824:	0f 88 77 01 00 00    	js     8049a1 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80482a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80482e:	48 b8 5b 2d 80 00 00 	movabs $0x802d5b,%rax
+  804835:	00 00 00 
+  804838:	ff d0                	call   *%rax
+  80483a:	89 c3                	mov    %eax,%ebx
+  80483c:	85 c0                	test   %eax,%eax
+  80483e:	0f 88 43 01 00 00    	js     804987 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804844:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804849:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80484e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804852:	bf 00 00 00 00       	mov    $0x0,%edi
+  804857:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  80485e:	00 00 00 
+  804861:	ff d0                	call   *%rax
+  804863:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804865:	85 c0                	test   %eax,%eax
+  804867:	0f 88 1a 01 00 00    	js     804987 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80486d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804871:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  804878:	00 00 00 
+  80487b:	ff d0                	call   *%rax
+  80487d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804880:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804885:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80488a:	48 89 c6             	mov    %rax,%rsi
+  80488d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804892:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  804899:	00 00 00 
+  80489c:	ff d0                	call   *%rax
+  80489e:	89 c3                	mov    %eax,%ebx
+  8048a0:	85 c0                	test   %eax,%eax
+  8048a2:	0f 88 c5 00 00 00    	js     80496d <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8048a8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8048ac:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  8048b3:	00 00 00 
+  8048b6:	ff d0                	call   *%rax
+  8048b8:	48 89 c1             	mov    %rax,%rcx
+  8048bb:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8048c1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8048c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048cc:	4c 89 ee             	mov    %r13,%rsi
+  8048cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048d4:	48 b8 04 22 80 00 00 	movabs $0x802204,%rax
+  8048db:	00 00 00 
+  8048de:	ff d0                	call   *%rax
+  8048e0:	89 c3                	mov    %eax,%ebx
+  8048e2:	85 c0                	test   %eax,%eax
+  8048e4:	78 6e                	js     804954 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8048e6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8048eb:	4c 89 ef             	mov    %r13,%rdi
+  8048ee:	48 b8 3f 21 80 00 00 	movabs $0x80213f,%rax
+  8048f5:	00 00 00 
+  8048f8:	ff d0                	call   *%rax
+  8048fa:	83 f8 02             	cmp    $0x2,%eax
+  8048fd:	0f 85 ab 00 00 00    	jne    8049ae <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804903:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  80490a:	00 00 
+  80490c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804910:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804912:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804916:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80491d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804921:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804923:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804927:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80492e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804932:	48 bb 2d 2d 80 00 00 	movabs $0x802d2d,%rbx
+  804939:	00 00 00 
+  80493c:	ff d3                	call   *%rbx
+  80493e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804942:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804946:	ff d3                	call   *%rbx
+  804948:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80494d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804952:	eb 4d                	jmp    8049a1 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804954:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804959:	4c 89 ee             	mov    %r13,%rsi
+  80495c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804961:	48 b8 7c 23 80 00 00 	movabs $0x80237c,%rax
+  804968:	00 00 00 
+  80496b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80496d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804972:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804976:	bf 00 00 00 00       	mov    $0x0,%edi
+  80497b:	48 b8 7c 23 80 00 00 	movabs $0x80237c,%rax
+  804982:	00 00 00 
+  804985:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804987:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80498c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804990:	bf 00 00 00 00       	mov    $0x0,%edi
+  804995:	48 b8 7c 23 80 00 00 	movabs $0x80237c,%rax
+  80499c:	00 00 00 
+  80499f:	ff d0                	call   *%rax
+}
+  8049a1:	89 d8                	mov    %ebx,%eax
+  8049a3:	48 83 c4 18          	add    $0x18,%rsp
+  8049a7:	5b                   	pop    %rbx
+  8049a8:	41 5c                	pop    %r12
+  8049aa:	41 5d                	pop    %r13
+  8049ac:	5d                   	pop    %rbp
+  8049ad:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8049ae:	48 b9 70 68 80 00 00 	movabs $0x806870,%rcx
+  8049b5:	00 00 00 
+  8049b8:	48 ba 47 68 80 00 00 	movabs $0x806847,%rdx
+  8049bf:	00 00 00 
+  8049c2:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8049c7:	48 bf 5c 68 80 00 00 	movabs $0x80685c,%rdi
+  8049ce:	00 00 00 
+  8049d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049d6:	49 b8 75 0f 80 00 00 	movabs $0x800f75,%r8
+  8049dd:	00 00 00 
+  8049e0:	41 ff d0             	call   *%r8
+
+00000000008049e3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8049e3:	55                   	push   %rbp
+  8049e4:	48 89 e5             	mov    %rsp,%rbp
+  8049e7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8049eb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8049ef:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  8049f6:	00 00 00 
+  8049f9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8049fb:	85 c0                	test   %eax,%eax
+  8049fd:	78 35                	js     804a34 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8049ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a03:	48 b8 3f 2d 80 00 00 	movabs $0x802d3f,%rax
+  804a0a:	00 00 00 
+  804a0d:	ff d0                	call   *%rax
+  804a0f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804a12:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804a17:	be 00 10 00 00       	mov    $0x1000,%esi
+  804a1c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a20:	48 b8 71 21 80 00 00 	movabs $0x802171,%rax
+  804a27:	00 00 00 
+  804a2a:	ff d0                	call   *%rax
+  804a2c:	85 c0                	test   %eax,%eax
+  804a2e:	0f 94 c0             	sete   %al
+  804a31:	0f b6 c0             	movzbl %al,%eax
+}
+  804a34:	c9                   	leave
+  804a35:	c3                   	ret
+
+0000000000804a36 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804a36:	48 89 f8             	mov    %rdi,%rax
+  804a39:	48 c1 e8 27          	shr    $0x27,%rax
+  804a3d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804a44:	7f 00 00 
+  804a47:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a4b:	f6 c2 01             	test   $0x1,%dl
+  804a4e:	74 6d                	je     804abd <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804a50:	48 89 f8             	mov    %rdi,%rax
+  804a53:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804a57:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804a5e:	7f 00 00 
+  804a61:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a65:	f6 c2 01             	test   $0x1,%dl
+  804a68:	74 62                	je     804acc <get_uvpt_entry+0x96>
+  804a6a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804a71:	7f 00 00 
+  804a74:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a78:	f6 c2 80             	test   $0x80,%dl
+  804a7b:	75 4f                	jne    804acc <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804a7d:	48 89 f8             	mov    %rdi,%rax
+  804a80:	48 c1 e8 15          	shr    $0x15,%rax
+  804a84:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804a8b:	7f 00 00 
+  804a8e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a92:	f6 c2 01             	test   $0x1,%dl
+  804a95:	74 44                	je     804adb <get_uvpt_entry+0xa5>
+  804a97:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804a9e:	7f 00 00 
+  804aa1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804aa5:	f6 c2 80             	test   $0x80,%dl
+  804aa8:	75 31                	jne    804adb <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804aaa:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804aae:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804ab5:	7f 00 00 
+  804ab8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804abc:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804abd:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804ac4:	7f 00 00 
+  804ac7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804acb:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804acc:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804ad3:	7f 00 00 
+  804ad6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804ada:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804adb:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804ae2:	7f 00 00 
+  804ae5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804ae9:	c3                   	ret
+
+0000000000804aea <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  804aea:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804aed:	48 89 f9             	mov    %rdi,%rcx
+  804af0:	48 c1 e9 27          	shr    $0x27,%rcx
+  804af4:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804afb:	7f 00 00 
+  804afe:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  804b02:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804b09:	f6 c1 01             	test   $0x1,%cl
+  804b0c:	0f 84 b2 00 00 00    	je     804bc4 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804b12:	48 89 f9             	mov    %rdi,%rcx
+  804b15:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804b19:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804b20:	7f 00 00 
+  804b23:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804b27:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804b2e:	40 f6 c6 01          	test   $0x1,%sil
+  804b32:	0f 84 8c 00 00 00    	je     804bc4 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804b38:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804b3f:	7f 00 00 
+  804b42:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804b46:	a8 80                	test   $0x80,%al
+  804b48:	75 7b                	jne    804bc5 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804b4a:	48 89 f9             	mov    %rdi,%rcx
+  804b4d:	48 c1 e9 15          	shr    $0x15,%rcx
+  804b51:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804b58:	7f 00 00 
+  804b5b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804b5f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804b66:	40 f6 c6 01          	test   $0x1,%sil
+  804b6a:	74 58                	je     804bc4 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  804b6c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804b73:	7f 00 00 
+  804b76:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804b7a:	a8 80                	test   $0x80,%al
+  804b7c:	75 6c                	jne    804bea <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804b7e:	48 89 f9             	mov    %rdi,%rcx
+  804b81:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804b85:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804b8c:	7f 00 00 
+  804b8f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804b93:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804b9a:	40 f6 c6 01          	test   $0x1,%sil
+  804b9e:	74 24                	je     804bc4 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804ba0:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804ba7:	7f 00 00 
+  804baa:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804bae:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804bb5:	ff ff 7f 
+  804bb8:	48 21 c8             	and    %rcx,%rax
+  804bbb:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804bc1:	48 09 d0             	or     %rdx,%rax
+}
+  804bc4:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804bc5:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804bcc:	7f 00 00 
+  804bcf:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804bd3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804bda:	ff ff 7f 
+  804bdd:	48 21 c8             	and    %rcx,%rax
+  804be0:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804be6:	48 01 d0             	add    %rdx,%rax
+  804be9:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804bea:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804bf1:	7f 00 00 
+  804bf4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804bf8:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804bff:	ff ff 7f 
+  804c02:	48 21 c8             	and    %rcx,%rax
+  804c05:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804c0b:	48 01 d0             	add    %rdx,%rax
+  804c0e:	c3                   	ret
+
+0000000000804c0f <get_prot>:
+
+int
+get_prot(void *va) {
+  804c0f:	55                   	push   %rbp
+  804c10:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804c13:	48 b8 36 4a 80 00 00 	movabs $0x804a36,%rax
+  804c1a:	00 00 00 
+  804c1d:	ff d0                	call   *%rax
+  804c1f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804c22:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804c27:	89 c1                	mov    %eax,%ecx
+  804c29:	83 c9 04             	or     $0x4,%ecx
+  804c2c:	f6 c2 01             	test   $0x1,%dl
+  804c2f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804c32:	89 c1                	mov    %eax,%ecx
+  804c34:	83 c9 02             	or     $0x2,%ecx
+  804c37:	f6 c2 02             	test   $0x2,%dl
+  804c3a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804c3d:	89 c1                	mov    %eax,%ecx
+  804c3f:	83 c9 01             	or     $0x1,%ecx
+  804c42:	48 85 d2             	test   %rdx,%rdx
+  804c45:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804c48:	89 c1                	mov    %eax,%ecx
+  804c4a:	83 c9 40             	or     $0x40,%ecx
+  804c4d:	f6 c6 04             	test   $0x4,%dh
+  804c50:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804c53:	5d                   	pop    %rbp
+  804c54:	c3                   	ret
+
+0000000000804c55 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804c55:	55                   	push   %rbp
+  804c56:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804c59:	48 b8 36 4a 80 00 00 	movabs $0x804a36,%rax
+  804c60:	00 00 00 
+  804c63:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804c65:	48 c1 e8 06          	shr    $0x6,%rax
+  804c69:	83 e0 01             	and    $0x1,%eax
+}
+  804c6c:	5d                   	pop    %rbp
+  804c6d:	c3                   	ret
+
+0000000000804c6e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804c6e:	55                   	push   %rbp
+  804c6f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804c72:	48 b8 36 4a 80 00 00 	movabs $0x804a36,%rax
+  804c79:	00 00 00 
+  804c7c:	ff d0                	call   *%rax
+  804c7e:	83 e0 01             	and    $0x1,%eax
+}
+  804c81:	5d                   	pop    %rbp
+  804c82:	c3                   	ret
+
+0000000000804c83 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804c83:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804c8a:	7f 00 00 
+  804c8d:	a8 01                	test   $0x1,%al
+  804c8f:	75 06                	jne    804c97 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804c91:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c96:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804c97:	55                   	push   %rbp
+  804c98:	48 89 e5             	mov    %rsp,%rbp
+  804c9b:	41 57                	push   %r15
+  804c9d:	41 56                	push   %r14
+  804c9f:	41 55                	push   %r13
+  804ca1:	41 54                	push   %r12
+  804ca3:	53                   	push   %rbx
+  804ca4:	48 83 ec 18          	sub    $0x18,%rsp
+  804ca8:	49 89 fe             	mov    %rdi,%r14
+  804cab:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804cae:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804cb5:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804cb6:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804cbd:	7f 00 00 
+  804cc0:	e9 81 00 00 00       	jmp    804d46 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804cc5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804ccc:	49 39 dd             	cmp    %rbx,%r13
+  804ccf:	74 2b                	je     804cfc <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804cd1:	48 89 d8             	mov    %rbx,%rax
+  804cd4:	48 c1 e8 0c          	shr    $0xc,%rax
+  804cd8:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804cdc:	f6 c2 01             	test   $0x1,%dl
+  804cdf:	74 e4                	je     804cc5 <foreach_shared_region+0x42>
+  804ce1:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804ce5:	f6 c4 04             	test   $0x4,%ah
+  804ce8:	74 db                	je     804cc5 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804cea:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804cf1:	4c 89 fa             	mov    %r15,%rdx
+  804cf4:	48 89 df             	mov    %rbx,%rdi
+  804cf7:	41 ff d6             	call   *%r14
+  804cfa:	eb c9                	jmp    804cc5 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804cfc:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804d03:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804d07:	74 22                	je     804d2b <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804d09:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804d10:	48 89 d8             	mov    %rbx,%rax
+  804d13:	48 c1 e8 15          	shr    $0x15,%rax
+  804d17:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804d1e:	7f 00 00 
+  804d21:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804d25:	a8 01                	test   $0x1,%al
+  804d27:	74 d3                	je     804cfc <foreach_shared_region+0x79>
+  804d29:	eb a6                	jmp    804cd1 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804d2b:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804d32:	40 
+  804d33:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804d37:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d3e:	00 00 00 
+  804d41:	48 39 c1             	cmp    %rax,%rcx
+  804d44:	74 31                	je     804d77 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804d46:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d4a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804d4e:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804d55:	7f 00 00 
+  804d58:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804d5c:	a8 01                	test   $0x1,%al
+  804d5e:	74 cb                	je     804d2b <foreach_shared_region+0xa8>
+  804d60:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d64:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804d6b:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804d71:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804d75:	eb 92                	jmp    804d09 <foreach_shared_region+0x86>
+}
+  804d77:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d7c:	48 83 c4 18          	add    $0x18,%rsp
+  804d80:	5b                   	pop    %rbx
+  804d81:	41 5c                	pop    %r12
+  804d83:	41 5d                	pop    %r13
+  804d85:	41 5e                	pop    %r14
+  804d87:	41 5f                	pop    %r15
+  804d89:	5d                   	pop    %rbp
+  804d8a:	c3                   	ret
+
+0000000000804d8b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d90:	c3                   	ret
+
+0000000000804d91 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804d91:	55                   	push   %rbp
+  804d92:	48 89 e5             	mov    %rsp,%rbp
+  804d95:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804d98:	48 be 94 68 80 00 00 	movabs $0x806894,%rsi
+  804d9f:	00 00 00 
+  804da2:	48 b8 3d 1a 80 00 00 	movabs $0x801a3d,%rax
+  804da9:	00 00 00 
+  804dac:	ff d0                	call   *%rax
+    return 0;
+}
+  804dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  804db3:	5d                   	pop    %rbp
+  804db4:	c3                   	ret
+
+0000000000804db5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804db5:	55                   	push   %rbp
+  804db6:	48 89 e5             	mov    %rsp,%rbp
+  804db9:	41 57                	push   %r15
+  804dbb:	41 56                	push   %r14
+  804dbd:	41 55                	push   %r13
+  804dbf:	41 54                	push   %r12
+  804dc1:	53                   	push   %rbx
+  804dc2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804dc9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804dd0:	48 85 d2             	test   %rdx,%rdx
+  804dd3:	74 7a                	je     804e4f <devcons_write+0x9a>
+  804dd5:	49 89 d6             	mov    %rdx,%r14
+  804dd8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804dde:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804de3:	49 bf cb 1d 80 00 00 	movabs $0x801dcb,%r15
+  804dea:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ded:	4c 89 f3             	mov    %r14,%rbx
+  804df0:	48 29 f3             	sub    %rsi,%rbx
+  804df3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804df8:	48 39 c3             	cmp    %rax,%rbx
+  804dfb:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804dff:	4c 63 eb             	movslq %ebx,%r13
+  804e02:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804e09:	48 01 c6             	add    %rax,%rsi
+  804e0c:	4c 89 ea             	mov    %r13,%rdx
+  804e0f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804e16:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804e19:	4c 89 ee             	mov    %r13,%rsi
+  804e1c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804e23:	48 b8 14 20 80 00 00 	movabs $0x802014,%rax
+  804e2a:	00 00 00 
+  804e2d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804e2f:	41 01 dc             	add    %ebx,%r12d
+  804e32:	49 63 f4             	movslq %r12d,%rsi
+  804e35:	4c 39 f6             	cmp    %r14,%rsi
+  804e38:	72 b3                	jb     804ded <devcons_write+0x38>
+    return res;
+  804e3a:	49 63 c4             	movslq %r12d,%rax
+}
+  804e3d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804e44:	5b                   	pop    %rbx
+  804e45:	41 5c                	pop    %r12
+  804e47:	41 5d                	pop    %r13
+  804e49:	41 5e                	pop    %r14
+  804e4b:	41 5f                	pop    %r15
+  804e4d:	5d                   	pop    %rbp
+  804e4e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804e4f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804e55:	eb e3                	jmp    804e3a <devcons_write+0x85>
+
+0000000000804e57 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804e57:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804e5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e5f:	48 85 c0             	test   %rax,%rax
+  804e62:	74 55                	je     804eb9 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804e64:	55                   	push   %rbp
+  804e65:	48 89 e5             	mov    %rsp,%rbp
+  804e68:	41 55                	push   %r13
+  804e6a:	41 54                	push   %r12
+  804e6c:	53                   	push   %rbx
+  804e6d:	48 83 ec 08          	sub    $0x8,%rsp
+  804e71:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804e74:	48 bb 41 20 80 00 00 	movabs $0x802041,%rbx
+  804e7b:	00 00 00 
+  804e7e:	49 bc 0e 21 80 00 00 	movabs $0x80210e,%r12
+  804e85:	00 00 00 
+  804e88:	eb 03                	jmp    804e8d <devcons_read+0x36>
+  804e8a:	41 ff d4             	call   *%r12
+  804e8d:	ff d3                	call   *%rbx
+  804e8f:	85 c0                	test   %eax,%eax
+  804e91:	74 f7                	je     804e8a <devcons_read+0x33>
+    if (c < 0) return c;
+  804e93:	48 63 d0             	movslq %eax,%rdx
+  804e96:	78 13                	js     804eab <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804e98:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e9d:	83 f8 04             	cmp    $0x4,%eax
+  804ea0:	74 09                	je     804eab <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804ea2:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804ea6:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804eab:	48 89 d0             	mov    %rdx,%rax
+  804eae:	48 83 c4 08          	add    $0x8,%rsp
+  804eb2:	5b                   	pop    %rbx
+  804eb3:	41 5c                	pop    %r12
+  804eb5:	41 5d                	pop    %r13
+  804eb7:	5d                   	pop    %rbp
+  804eb8:	c3                   	ret
+  804eb9:	48 89 d0             	mov    %rdx,%rax
+  804ebc:	c3                   	ret
+
+0000000000804ebd <cputchar>:
+cputchar(int ch) {
+  804ebd:	55                   	push   %rbp
+  804ebe:	48 89 e5             	mov    %rsp,%rbp
+  804ec1:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804ec5:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804ec9:	be 01 00 00 00       	mov    $0x1,%esi
+  804ece:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804ed2:	48 b8 14 20 80 00 00 	movabs $0x802014,%rax
+  804ed9:	00 00 00 
+  804edc:	ff d0                	call   *%rax
+}
+  804ede:	c9                   	leave
+  804edf:	c3                   	ret
+
+0000000000804ee0 <getchar>:
+getchar(void) {
+  804ee0:	55                   	push   %rbp
+  804ee1:	48 89 e5             	mov    %rsp,%rbp
+  804ee4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804ee8:	ba 01 00 00 00       	mov    $0x1,%edx
+  804eed:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804ef1:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ef6:	48 b8 9e 30 80 00 00 	movabs $0x80309e,%rax
+  804efd:	00 00 00 
+  804f00:	ff d0                	call   *%rax
+  804f02:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804f04:	85 c0                	test   %eax,%eax
+  804f06:	78 06                	js     804f0e <getchar+0x2e>
+  804f08:	74 08                	je     804f12 <getchar+0x32>
+  804f0a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804f0e:	89 d0                	mov    %edx,%eax
+  804f10:	c9                   	leave
+  804f11:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804f12:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804f17:	eb f5                	jmp    804f0e <getchar+0x2e>
+
+0000000000804f19 <iscons>:
+iscons(int fdnum) {
+  804f19:	55                   	push   %rbp
+  804f1a:	48 89 e5             	mov    %rsp,%rbp
+  804f1d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804f21:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804f25:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  804f2c:	00 00 00 
+  804f2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804f31:	85 c0                	test   %eax,%eax
+  804f33:	78 18                	js     804f4d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804f35:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f39:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  804f40:	00 00 00 
+  804f43:	8b 00                	mov    (%rax),%eax
+  804f45:	39 02                	cmp    %eax,(%rdx)
+  804f47:	0f 94 c0             	sete   %al
+  804f4a:	0f b6 c0             	movzbl %al,%eax
+}
+  804f4d:	c9                   	leave
+  804f4e:	c3                   	ret
+
+0000000000804f4f <opencons>:
+opencons(void) {
+  804f4f:	55                   	push   %rbp
+  804f50:	48 89 e5             	mov    %rsp,%rbp
+  804f53:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804f57:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804f5b:	48 b8 5b 2d 80 00 00 	movabs $0x802d5b,%rax
+  804f62:	00 00 00 
+  804f65:	ff d0                	call   *%rax
+  804f67:	85 c0                	test   %eax,%eax
+  804f69:	78 49                	js     804fb4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804f6b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804f70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f75:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804f79:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f7e:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  804f85:	00 00 00 
+  804f88:	ff d0                	call   *%rax
+  804f8a:	85 c0                	test   %eax,%eax
+  804f8c:	78 26                	js     804fb4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804f8e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f92:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  804f99:	00 00 
+  804f9b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804f9d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804fa1:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804fa8:	48 b8 2d 2d 80 00 00 	movabs $0x802d2d,%rax
+  804faf:	00 00 00 
+  804fb2:	ff d0                	call   *%rax
+}
+  804fb4:	c9                   	leave
+  804fb5:	c3                   	ret
+
+0000000000804fb6 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804fb6:	55                   	push   %rbp
+  804fb7:	48 89 e5             	mov    %rsp,%rbp
+  804fba:	41 55                	push   %r13
+  804fbc:	41 54                	push   %r12
+  804fbe:	53                   	push   %rbx
+  804fbf:	48 83 ec 08          	sub    $0x8,%rsp
+  804fc3:	49 89 fc             	mov    %rdi,%r12
+  804fc6:	48 89 f7             	mov    %rsi,%rdi
+  804fc9:	48 89 d3             	mov    %rdx,%rbx
+  804fcc:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804fcf:	48 85 f6             	test   %rsi,%rsi
+  804fd2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804fd9:	00 00 00 
+  804fdc:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804fe0:	be 00 10 00 00       	mov    $0x1000,%esi
+  804fe5:	48 85 d2             	test   %rdx,%rdx
+  804fe8:	74 03                	je     804fed <ipc_recv+0x37>
+  804fea:	48 8b 32             	mov    (%rdx),%rsi
+  804fed:	48 b8 4a 25 80 00 00 	movabs $0x80254a,%rax
+  804ff4:	00 00 00 
+  804ff7:	ff d0                	call   *%rax
+    if (errno) {
+  804ff9:	85 c0                	test   %eax,%eax
+  804ffb:	74 1c                	je     805019 <ipc_recv+0x63>
+        if (from_env_store)
+  804ffd:	4d 85 e4             	test   %r12,%r12
+  805000:	74 08                	je     80500a <ipc_recv+0x54>
+            *from_env_store = 0;
+  805002:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  805009:	00 
+
+        if (perm_store)
+  80500a:	4d 85 ed             	test   %r13,%r13
+  80500d:	74 74                	je     805083 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80500f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  805016:	00 
+  805017:	eb 6a                	jmp    805083 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  805019:	4d 85 e4             	test   %r12,%r12
+  80501c:	74 14                	je     805032 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80501e:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  805025:	00 00 00 
+  805028:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80502e:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  805032:	48 85 db             	test   %rbx,%rbx
+  805035:	74 23                	je     80505a <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  805037:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  80503e:	00 00 00 
+  805041:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  805047:	ba 00 00 00 00       	mov    $0x0,%edx
+  80504c:	85 c9                	test   %ecx,%ecx
+  80504e:	74 07                	je     805057 <ipc_recv+0xa1>
+  805050:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  805057:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80505a:	4d 85 ed             	test   %r13,%r13
+  80505d:	74 14                	je     805073 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80505f:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  805066:	00 00 00 
+  805069:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80506f:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  805073:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  80507a:	00 00 00 
+  80507d:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  805083:	48 83 c4 08          	add    $0x8,%rsp
+  805087:	5b                   	pop    %rbx
+  805088:	41 5c                	pop    %r12
+  80508a:	41 5d                	pop    %r13
+  80508c:	5d                   	pop    %rbp
+  80508d:	c3                   	ret
+
+000000000080508e <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80508e:	55                   	push   %rbp
+  80508f:	48 89 e5             	mov    %rsp,%rbp
+  805092:	41 55                	push   %r13
+  805094:	41 54                	push   %r12
+  805096:	53                   	push   %rbx
+  805097:	48 83 ec 08          	sub    $0x8,%rsp
+  80509b:	49 89 fc             	mov    %rdi,%r12
+  80509e:	48 89 f7             	mov    %rsi,%rdi
+  8050a1:	48 89 d3             	mov    %rdx,%rbx
+  8050a4:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8050a7:	48 85 f6             	test   %rsi,%rsi
+  8050aa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8050b1:	00 00 00 
+  8050b4:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8050b8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8050bd:	48 85 d2             	test   %rdx,%rdx
+  8050c0:	74 03                	je     8050c5 <ipc_try_recv+0x37>
+  8050c2:	48 8b 32             	mov    (%rdx),%rsi
+  8050c5:	48 b8 b3 25 80 00 00 	movabs $0x8025b3,%rax
+  8050cc:	00 00 00 
+  8050cf:	ff d0                	call   *%rax
+    if (errno) {
+  8050d1:	85 c0                	test   %eax,%eax
+  8050d3:	75 75                	jne    80514a <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8050d5:	4d 85 e4             	test   %r12,%r12
+  8050d8:	74 14                	je     8050ee <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8050da:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  8050e1:	00 00 00 
+  8050e4:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8050ea:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8050ee:	48 85 db             	test   %rbx,%rbx
+  8050f1:	74 23                	je     805116 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8050f3:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  8050fa:	00 00 00 
+  8050fd:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  805103:	ba 00 00 00 00       	mov    $0x0,%edx
+  805108:	85 c9                	test   %ecx,%ecx
+  80510a:	74 07                	je     805113 <ipc_try_recv+0x85>
+  80510c:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  805113:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  805116:	4d 85 ed             	test   %r13,%r13
+  805119:	74 14                	je     80512f <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80511b:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  805122:	00 00 00 
+  805125:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80512b:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80512f:	48 a1 40 00 85 00 00 	movabs 0x850040,%rax
+  805136:	00 00 00 
+  805139:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80513f:	48 83 c4 08          	add    $0x8,%rsp
+  805143:	5b                   	pop    %rbx
+  805144:	41 5c                	pop    %r12
+  805146:	41 5d                	pop    %r13
+  805148:	5d                   	pop    %rbp
+  805149:	c3                   	ret
+        if (from_env_store)
+  80514a:	4d 85 e4             	test   %r12,%r12
+  80514d:	74 08                	je     805157 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80514f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  805156:	00 
+        if (perm_store)
+  805157:	4d 85 ed             	test   %r13,%r13
+  80515a:	74 e3                	je     80513f <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80515c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  805163:	00 
+  805164:	eb d9                	jmp    80513f <ipc_try_recv+0xb1>
+
+0000000000805166 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805166:	55                   	push   %rbp
+  805167:	48 89 e5             	mov    %rsp,%rbp
+  80516a:	41 57                	push   %r15
+  80516c:	41 56                	push   %r14
+  80516e:	41 55                	push   %r13
+  805170:	41 54                	push   %r12
+  805172:	53                   	push   %rbx
+  805173:	48 83 ec 18          	sub    $0x18,%rsp
+  805177:	41 89 fd             	mov    %edi,%r13d
+  80517a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80517d:	48 89 d3             	mov    %rdx,%rbx
+  805180:	49 89 cc             	mov    %rcx,%r12
+  805183:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  805187:	48 85 d2             	test   %rdx,%rdx
+  80518a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805191:	00 00 00 
+  805194:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  805198:	49 be 1e 25 80 00 00 	movabs $0x80251e,%r14
+  80519f:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8051a2:	49 bf 0e 21 80 00 00 	movabs $0x80210e,%r15
+  8051a9:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8051ac:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8051af:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8051b3:	4c 89 e1             	mov    %r12,%rcx
+  8051b6:	48 89 da             	mov    %rbx,%rdx
+  8051b9:	44 89 ef             	mov    %r13d,%edi
+  8051bc:	41 ff d6             	call   *%r14
+  8051bf:	85 c0                	test   %eax,%eax
+  8051c1:	74 37                	je     8051fa <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8051c3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8051c6:	75 05                	jne    8051cd <ipc_send+0x67>
+        sys_yield();
+  8051c8:	41 ff d7             	call   *%r15
+  8051cb:	eb df                	jmp    8051ac <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8051cd:	89 c1                	mov    %eax,%ecx
+  8051cf:	48 ba a0 68 80 00 00 	movabs $0x8068a0,%rdx
+  8051d6:	00 00 00 
+  8051d9:	be 65 00 00 00       	mov    $0x65,%esi
+  8051de:	48 bf bb 68 80 00 00 	movabs $0x8068bb,%rdi
+  8051e5:	00 00 00 
+  8051e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051ed:	49 b8 75 0f 80 00 00 	movabs $0x800f75,%r8
+  8051f4:	00 00 00 
+  8051f7:	41 ff d0             	call   *%r8
+    }
+}
+  8051fa:	48 83 c4 18          	add    $0x18,%rsp
+  8051fe:	5b                   	pop    %rbx
+  8051ff:	41 5c                	pop    %r12
+  805201:	41 5d                	pop    %r13
+  805203:	41 5e                	pop    %r14
+  805205:	41 5f                	pop    %r15
+  805207:	5d                   	pop    %rbp
+  805208:	c3                   	ret
+
+0000000000805209 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805209:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80520e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805215:	00 00 00 
+  805218:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80521f:	48 01 ca             	add    %rcx,%rdx
+  805222:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  805228:	39 fa                	cmp    %edi,%edx
+  80522a:	74 12                	je     80523e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80522c:	48 83 c0 01          	add    $0x1,%rax
+  805230:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805236:	75 e0                	jne    805218 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805238:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80523d:	c3                   	ret
+            return envs[i].env_id;
+  80523e:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  805245:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80524c:	00 00 00 
+  80524f:	48 01 d0             	add    %rdx,%rax
+  805252:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805258:	c3                   	ret
+
+0000000000805259 <__text_end>:
+  805259:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805260:	00 00 00 
+  805263:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80526a:	00 00 00 
+  80526d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805274:	00 00 00 
+  805277:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80527e:	00 00 00 
+  805281:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805288:	00 00 00 
+  80528b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805292:	00 00 00 
+  805295:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80529c:	00 00 00 
+  80529f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052a6:	00 00 00 
+  8052a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052b0:	00 00 00 
+  8052b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052ba:	00 00 00 
+  8052bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052c4:	00 00 00 
+  8052c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052ce:	00 00 00 
+  8052d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052d8:	00 00 00 
+  8052db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052e2:	00 00 00 
+  8052e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052ec:	00 00 00 
+  8052ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8052f6:	00 00 00 
+  8052f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805300:	00 00 00 
+  805303:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80530a:	00 00 00 
+  80530d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805314:	00 00 00 
+  805317:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80531e:	00 00 00 
+  805321:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805328:	00 00 00 
+  80532b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805332:	00 00 00 
+  805335:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80533c:	00 00 00 
+  80533f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805346:	00 00 00 
+  805349:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805350:	00 00 00 
+  805353:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80535a:	00 00 00 
+  80535d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805364:	00 00 00 
+  805367:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80536e:	00 00 00 
+  805371:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805378:	00 00 00 
+  80537b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805382:	00 00 00 
+  805385:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80538c:	00 00 00 
+  80538f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805396:	00 00 00 
+  805399:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053a0:	00 00 00 
+  8053a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053aa:	00 00 00 
+  8053ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053b4:	00 00 00 
+  8053b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053be:	00 00 00 
+  8053c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053c8:	00 00 00 
+  8053cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053d2:	00 00 00 
+  8053d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053dc:	00 00 00 
+  8053df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053e6:	00 00 00 
+  8053e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053f0:	00 00 00 
+  8053f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8053fa:	00 00 00 
+  8053fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805404:	00 00 00 
+  805407:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80540e:	00 00 00 
+  805411:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805418:	00 00 00 
+  80541b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805422:	00 00 00 
+  805425:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80542c:	00 00 00 
+  80542f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805436:	00 00 00 
+  805439:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805440:	00 00 00 
+  805443:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80544a:	00 00 00 
+  80544d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805454:	00 00 00 
+  805457:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80545e:	00 00 00 
+  805461:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805468:	00 00 00 
+  80546b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805472:	00 00 00 
+  805475:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80547c:	00 00 00 
+  80547f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805486:	00 00 00 
+  805489:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805490:	00 00 00 
+  805493:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80549a:	00 00 00 
+  80549d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054a4:	00 00 00 
+  8054a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054ae:	00 00 00 
+  8054b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054b8:	00 00 00 
+  8054bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054c2:	00 00 00 
+  8054c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054cc:	00 00 00 
+  8054cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054d6:	00 00 00 
+  8054d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054e0:	00 00 00 
+  8054e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054ea:	00 00 00 
+  8054ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054f4:	00 00 00 
+  8054f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8054fe:	00 00 00 
+  805501:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805508:	00 00 00 
+  80550b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805512:	00 00 00 
+  805515:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80551c:	00 00 00 
+  80551f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805526:	00 00 00 
+  805529:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805530:	00 00 00 
+  805533:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80553a:	00 00 00 
+  80553d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805544:	00 00 00 
+  805547:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80554e:	00 00 00 
+  805551:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805558:	00 00 00 
+  80555b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805562:	00 00 00 
+  805565:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80556c:	00 00 00 
+  80556f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805576:	00 00 00 
+  805579:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805580:	00 00 00 
+  805583:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80558a:	00 00 00 
+  80558d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805594:	00 00 00 
+  805597:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80559e:	00 00 00 
+  8055a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055a8:	00 00 00 
+  8055ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055b2:	00 00 00 
+  8055b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055bc:	00 00 00 
+  8055bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055c6:	00 00 00 
+  8055c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055d0:	00 00 00 
+  8055d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055da:	00 00 00 
+  8055dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055e4:	00 00 00 
+  8055e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055ee:	00 00 00 
+  8055f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8055f8:	00 00 00 
+  8055fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805602:	00 00 00 
+  805605:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80560c:	00 00 00 
+  80560f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805616:	00 00 00 
+  805619:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805620:	00 00 00 
+  805623:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80562a:	00 00 00 
+  80562d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805634:	00 00 00 
+  805637:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80563e:	00 00 00 
+  805641:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805648:	00 00 00 
+  80564b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805652:	00 00 00 
+  805655:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80565c:	00 00 00 
+  80565f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805666:	00 00 00 
+  805669:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805670:	00 00 00 
+  805673:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80567a:	00 00 00 
+  80567d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805684:	00 00 00 
+  805687:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80568e:	00 00 00 
+  805691:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805698:	00 00 00 
+  80569b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056a2:	00 00 00 
+  8056a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056ac:	00 00 00 
+  8056af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056b6:	00 00 00 
+  8056b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056c0:	00 00 00 
+  8056c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056ca:	00 00 00 
+  8056cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056d4:	00 00 00 
+  8056d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056de:	00 00 00 
+  8056e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056e8:	00 00 00 
+  8056eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056f2:	00 00 00 
+  8056f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8056fc:	00 00 00 
+  8056ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805706:	00 00 00 
+  805709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805710:	00 00 00 
+  805713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80571a:	00 00 00 
+  80571d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805724:	00 00 00 
+  805727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80572e:	00 00 00 
+  805731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805738:	00 00 00 
+  80573b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805742:	00 00 00 
+  805745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80574c:	00 00 00 
+  80574f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805756:	00 00 00 
+  805759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805760:	00 00 00 
+  805763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80576a:	00 00 00 
+  80576d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805774:	00 00 00 
+  805777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80577e:	00 00 00 
+  805781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805788:	00 00 00 
+  80578b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805792:	00 00 00 
+  805795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80579c:	00 00 00 
+  80579f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057a6:	00 00 00 
+  8057a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057b0:	00 00 00 
+  8057b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057ba:	00 00 00 
+  8057bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057c4:	00 00 00 
+  8057c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057ce:	00 00 00 
+  8057d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057d8:	00 00 00 
+  8057db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057e2:	00 00 00 
+  8057e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057ec:	00 00 00 
+  8057ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8057f6:	00 00 00 
+  8057f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805800:	00 00 00 
+  805803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80580a:	00 00 00 
+  80580d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805814:	00 00 00 
+  805817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80581e:	00 00 00 
+  805821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805828:	00 00 00 
+  80582b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805832:	00 00 00 
+  805835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80583c:	00 00 00 
+  80583f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805846:	00 00 00 
+  805849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805850:	00 00 00 
+  805853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80585a:	00 00 00 
+  80585d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805864:	00 00 00 
+  805867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80586e:	00 00 00 
+  805871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805878:	00 00 00 
+  80587b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805882:	00 00 00 
+  805885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80588c:	00 00 00 
+  80588f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805896:	00 00 00 
+  805899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058a0:	00 00 00 
+  8058a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058aa:	00 00 00 
+  8058ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058b4:	00 00 00 
+  8058b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058be:	00 00 00 
+  8058c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058c8:	00 00 00 
+  8058cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058d2:	00 00 00 
+  8058d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058dc:	00 00 00 
+  8058df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058e6:	00 00 00 
+  8058e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058f0:	00 00 00 
+  8058f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8058fa:	00 00 00 
+  8058fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805904:	00 00 00 
+  805907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80590e:	00 00 00 
+  805911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805918:	00 00 00 
+  80591b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805922:	00 00 00 
+  805925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80592c:	00 00 00 
+  80592f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805936:	00 00 00 
+  805939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805940:	00 00 00 
+  805943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80594a:	00 00 00 
+  80594d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805954:	00 00 00 
+  805957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80595e:	00 00 00 
+  805961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805968:	00 00 00 
+  80596b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805972:	00 00 00 
+  805975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80597c:	00 00 00 
+  80597f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805986:	00 00 00 
+  805989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805990:	00 00 00 
+  805993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80599a:	00 00 00 
+  80599d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059a4:	00 00 00 
+  8059a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059ae:	00 00 00 
+  8059b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059b8:	00 00 00 
+  8059bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059c2:	00 00 00 
+  8059c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059cc:	00 00 00 
+  8059cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059d6:	00 00 00 
+  8059d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059e0:	00 00 00 
+  8059e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059ea:	00 00 00 
+  8059ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059f4:	00 00 00 
+  8059f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059fe:	00 00 00 
+  805a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a08:	00 00 00 
+  805a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a12:	00 00 00 
+  805a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a1c:	00 00 00 
+  805a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a26:	00 00 00 
+  805a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a30:	00 00 00 
+  805a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a3a:	00 00 00 
+  805a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a44:	00 00 00 
+  805a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a4e:	00 00 00 
+  805a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a58:	00 00 00 
+  805a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a62:	00 00 00 
+  805a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a6c:	00 00 00 
+  805a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a76:	00 00 00 
+  805a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a80:	00 00 00 
+  805a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a8a:	00 00 00 
+  805a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a94:	00 00 00 
+  805a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a9e:	00 00 00 
+  805aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aa8:	00 00 00 
+  805aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ab2:	00 00 00 
+  805ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805abc:	00 00 00 
+  805abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ac6:	00 00 00 
+  805ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ad0:	00 00 00 
+  805ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ada:	00 00 00 
+  805add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ae4:	00 00 00 
+  805ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aee:	00 00 00 
+  805af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805af8:	00 00 00 
+  805afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b02:	00 00 00 
+  805b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b0c:	00 00 00 
+  805b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b16:	00 00 00 
+  805b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b20:	00 00 00 
+  805b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b2a:	00 00 00 
+  805b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b34:	00 00 00 
+  805b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b3e:	00 00 00 
+  805b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b48:	00 00 00 
+  805b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b52:	00 00 00 
+  805b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b5c:	00 00 00 
+  805b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b66:	00 00 00 
+  805b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b70:	00 00 00 
+  805b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b7a:	00 00 00 
+  805b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b84:	00 00 00 
+  805b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b8e:	00 00 00 
+  805b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b98:	00 00 00 
+  805b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ba2:	00 00 00 
+  805ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bac:	00 00 00 
+  805baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bb6:	00 00 00 
+  805bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bc0:	00 00 00 
+  805bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bca:	00 00 00 
+  805bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bd4:	00 00 00 
+  805bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bde:	00 00 00 
+  805be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805be8:	00 00 00 
+  805beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bf2:	00 00 00 
+  805bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bfc:	00 00 00 
+  805bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c06:	00 00 00 
+  805c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c10:	00 00 00 
+  805c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c1a:	00 00 00 
+  805c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c24:	00 00 00 
+  805c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c2e:	00 00 00 
+  805c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c38:	00 00 00 
+  805c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c42:	00 00 00 
+  805c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c4c:	00 00 00 
+  805c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c56:	00 00 00 
+  805c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c60:	00 00 00 
+  805c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c6a:	00 00 00 
+  805c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c74:	00 00 00 
+  805c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c7e:	00 00 00 
+  805c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c88:	00 00 00 
+  805c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c92:	00 00 00 
+  805c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c9c:	00 00 00 
+  805c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ca6:	00 00 00 
+  805ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cb0:	00 00 00 
+  805cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cba:	00 00 00 
+  805cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cc4:	00 00 00 
+  805cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cce:	00 00 00 
+  805cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cd8:	00 00 00 
+  805cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ce2:	00 00 00 
+  805ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cec:	00 00 00 
+  805cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cf6:	00 00 00 
+  805cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d00:	00 00 00 
+  805d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d0a:	00 00 00 
+  805d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d14:	00 00 00 
+  805d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d1e:	00 00 00 
+  805d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d28:	00 00 00 
+  805d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d32:	00 00 00 
+  805d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d3c:	00 00 00 
+  805d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d46:	00 00 00 
+  805d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d50:	00 00 00 
+  805d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d5a:	00 00 00 
+  805d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d64:	00 00 00 
+  805d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d6e:	00 00 00 
+  805d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d78:	00 00 00 
+  805d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d82:	00 00 00 
+  805d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d8c:	00 00 00 
+  805d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d96:	00 00 00 
+  805d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805da0:	00 00 00 
+  805da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805daa:	00 00 00 
+  805dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805db4:	00 00 00 
+  805db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dbe:	00 00 00 
+  805dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dc8:	00 00 00 
+  805dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dd2:	00 00 00 
+  805dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ddc:	00 00 00 
+  805ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805de6:	00 00 00 
+  805de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805df0:	00 00 00 
+  805df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dfa:	00 00 00 
+  805dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e04:	00 00 00 
+  805e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e0e:	00 00 00 
+  805e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e18:	00 00 00 
+  805e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e22:	00 00 00 
+  805e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e2c:	00 00 00 
+  805e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e36:	00 00 00 
+  805e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e40:	00 00 00 
+  805e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e4a:	00 00 00 
+  805e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e54:	00 00 00 
+  805e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e5e:	00 00 00 
+  805e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e68:	00 00 00 
+  805e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e72:	00 00 00 
+  805e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e7c:	00 00 00 
+  805e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e86:	00 00 00 
+  805e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e90:	00 00 00 
+  805e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e9a:	00 00 00 
+  805e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ea4:	00 00 00 
+  805ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eae:	00 00 00 
+  805eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eb8:	00 00 00 
+  805ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ec2:	00 00 00 
+  805ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ecc:	00 00 00 
+  805ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ed6:	00 00 00 
+  805ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ee0:	00 00 00 
+  805ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eea:	00 00 00 
+  805eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ef4:	00 00 00 
+  805ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805efe:	00 00 00 
+  805f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f08:	00 00 00 
+  805f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f12:	00 00 00 
+  805f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f1c:	00 00 00 
+  805f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f26:	00 00 00 
+  805f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f30:	00 00 00 
+  805f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f3a:	00 00 00 
+  805f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f44:	00 00 00 
+  805f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f4e:	00 00 00 
+  805f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f58:	00 00 00 
+  805f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f62:	00 00 00 
+  805f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f6c:	00 00 00 
+  805f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f76:	00 00 00 
+  805f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f80:	00 00 00 
+  805f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f8a:	00 00 00 
+  805f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f94:	00 00 00 
+  805f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f9e:	00 00 00 
+  805fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fa8:	00 00 00 
+  805fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fb2:	00 00 00 
+  805fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fbc:	00 00 00 
+  805fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fc6:	00 00 00 
+  805fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fd0:	00 00 00 
+  805fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fda:	00 00 00 
+  805fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fe4:	00 00 00 
+  805fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fee:	00 00 00 
+  805ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ff8:	00 00 00 
+  805ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
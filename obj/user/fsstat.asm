@@ -0,0 +1,8365 @@
+
+obj/user/fsstat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ed 03 00 00       	call   800410 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <usage>:
+};
+
+static uint64_t tsc_khz;
+
+void
+usage(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: fsstat [-h] [-r]\n");
+  800029:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba 89 05 80 00 00 	movabs $0x800589,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+    exit();
+  800044:	48 b8 b9 04 80 00 00 	movabs $0x8004b9,%rax
+  80004b:	00 00 00 
+  80004e:	ff d0                	call   *%rax
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <umain>:
+                    (unsigned long)cycles_to_us(1ULL << (FSSTAT_SHIFT + b)), st->hist[b]);
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 83 ec 48          	sub    $0x48,%rsp
+  800063:	89 7d ac             	mov    %edi,-0x54(%rbp)
+    int i, hist = 0, reset = 0;
+    struct Argstate args;
+    static struct Fsret_stats st;
+
+    argstart(&argc, argv, &args);
+  800066:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  80006a:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  80006e:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  800075:	00 00 00 
+  800078:	ff d0                	call   *%rax
+    int i, hist = 0, reset = 0;
+  80007a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800080:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+    while ((i = argnext(&args)) >= 0) {
+  800087:	48 bb a4 20 80 00 00 	movabs $0x8020a4,%rbx
+  80008e:	00 00 00 
+        if (i == 'h')
+            hist = 1;
+  800091:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+        else if (i == 'r')
+            reset = 1;
+        else
+            usage();
+  800097:	49 be 25 00 80 00 00 	movabs $0x800025,%r14
+  80009e:	00 00 00 
+    while ((i = argnext(&args)) >= 0) {
+  8000a1:	eb 09                	jmp    8000ac <umain+0x5a>
+            usage();
+  8000a3:	41 ff d6             	call   *%r14
+  8000a6:	eb 04                	jmp    8000ac <umain+0x5a>
+            hist = 1;
+  8000a8:	44 89 6d a8          	mov    %r13d,-0x58(%rbp)
+    while ((i = argnext(&args)) >= 0) {
+  8000ac:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8000b0:	ff d3                	call   *%rbx
+  8000b2:	85 c0                	test   %eax,%eax
+  8000b4:	78 0f                	js     8000c5 <umain+0x73>
+        if (i == 'h')
+  8000b6:	83 f8 68             	cmp    $0x68,%eax
+  8000b9:	74 ed                	je     8000a8 <umain+0x56>
+        else if (i == 'r')
+  8000bb:	83 f8 72             	cmp    $0x72,%eax
+  8000be:	75 e3                	jne    8000a3 <umain+0x51>
+            reset = 1;
+  8000c0:	45 89 ec             	mov    %r13d,%r12d
+  8000c3:	eb e7                	jmp    8000ac <umain+0x5a>
+    }
+
+    int res = fsstats(&st, reset);
+  8000c5:	44 89 e6             	mov    %r12d,%esi
+  8000c8:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  8000cf:	00 00 00 
+  8000d2:	48 b8 29 39 80 00 00 	movabs $0x803929,%rax
+  8000d9:	00 00 00 
+  8000dc:	ff d0                	call   *%rax
+    if (res < 0) {
+  8000de:	85 c0                	test   %eax,%eax
+  8000e0:	0f 88 b9 00 00 00    	js     80019f <umain+0x14d>
+        cprintf("fsstat: %i\n", res);
+        exit();
+    }
+    tsc_khz = st.ret_tsc_freq / 1000;
+  8000e6:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8000ed:	00 00 00 
+  8000f0:	48 8b 93 00 06 00 00 	mov    0x600(%rbx),%rdx
+  8000f7:	48 c1 ea 03          	shr    $0x3,%rdx
+  8000fb:	48 b9 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rcx
+  800102:	9b c4 20 
+  800105:	48 89 d0             	mov    %rdx,%rax
+  800108:	48 f7 e1             	mul    %rcx
+  80010b:	48 89 d0             	mov    %rdx,%rax
+  80010e:	48 c1 e8 04          	shr    $0x4,%rax
+  800112:	48 a3 58 76 80 00 00 	movabs %rax,0x807658
+  800119:	00 00 00 
+
+    cprintf("%-9s %8s %10s %9s %9s\n", "REQUEST", "COUNT", "BYTES(K)", "AVG(us)", "MAX(us)");
+  80011c:	49 b9 27 50 80 00 00 	movabs $0x805027,%r9
+  800123:	00 00 00 
+  800126:	49 b8 2f 50 80 00 00 	movabs $0x80502f,%r8
+  80012d:	00 00 00 
+  800130:	48 b9 37 50 80 00 00 	movabs $0x805037,%rcx
+  800137:	00 00 00 
+  80013a:	48 ba 40 50 80 00 00 	movabs $0x805040,%rdx
+  800141:	00 00 00 
+  800144:	48 be 46 50 80 00 00 	movabs $0x805046,%rsi
+  80014b:	00 00 00 
+  80014e:	48 bf 4e 50 80 00 00 	movabs $0x80504e,%rdi
+  800155:	00 00 00 
+  800158:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015d:	49 ba 89 05 80 00 00 	movabs $0x800589,%r10
+  800164:	00 00 00 
+  800167:	41 ff d2             	call   *%r10
+    for (int t = 0; t < NFSREQ; t++) {
+  80016a:	48 89 5d a0          	mov    %rbx,-0x60(%rbp)
+  80016e:	48 b8 80 51 80 00 00 	movabs $0x805180,%rax
+  800175:	00 00 00 
+  800178:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+    cprintf("%-9s %8s %10s %9s %9s\n", "REQUEST", "COUNT", "BYTES(K)", "AVG(us)", "MAX(us)");
+  80017c:	49 89 c4             	mov    %rax,%r12
+    return tsc_khz ? cycles * 1000 / tsc_khz : 0;
+  80017f:	49 bd 58 76 80 00 00 	movabs $0x807658,%r13
+  800186:	00 00 00 
+        const struct FsReqStat *r = &st.ret_req[t];
+        if (!r->count) continue;
+
+        cprintf("%-9s %8lu %10lu %9lu %9lu\n", req_names[t] ? req_names[t] : "?",
+  800189:	49 bf 19 50 80 00 00 	movabs $0x805019,%r15
+  800190:	00 00 00 
+  800193:	49 be 89 05 80 00 00 	movabs $0x800589,%r14
+  80019a:	00 00 00 
+  80019d:	eb 6d                	jmp    80020c <umain+0x1ba>
+        cprintf("fsstat: %i\n", res);
+  80019f:	89 c6                	mov    %eax,%esi
+  8001a1:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  8001a8:	00 00 00 
+  8001ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b0:	48 ba 89 05 80 00 00 	movabs $0x800589,%rdx
+  8001b7:	00 00 00 
+  8001ba:	ff d2                	call   *%rdx
+        exit();
+  8001bc:	48 b8 b9 04 80 00 00 	movabs $0x8004b9,%rax
+  8001c3:	00 00 00 
+  8001c6:	ff d0                	call   *%rax
+  8001c8:	e9 19 ff ff ff       	jmp    8000e6 <umain+0x94>
+                (unsigned long)r->count, (unsigned long)(r->bytes / KB),
+  8001cd:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  8001d1:	48 c1 e9 0a          	shr    $0xa,%rcx
+        cprintf("%-9s %8lu %10lu %9lu %9lu\n", req_names[t] ? req_names[t] : "?",
+  8001d5:	49 8b 34 24          	mov    (%r12),%rsi
+  8001d9:	48 85 f6             	test   %rsi,%rsi
+  8001dc:	49 0f 44 f7          	cmove  %r15,%rsi
+  8001e0:	48 89 fa             	mov    %rdi,%rdx
+  8001e3:	48 bf 65 50 80 00 00 	movabs $0x805065,%rdi
+  8001ea:	00 00 00 
+  8001ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f2:	41 ff d6             	call   *%r14
+    for (int t = 0; t < NFSREQ; t++) {
+  8001f5:	48 83 eb 80          	sub    $0xffffffffffffff80,%rbx
+  8001f9:	49 83 c4 08          	add    $0x8,%r12
+  8001fd:	48 b8 00 76 80 00 00 	movabs $0x807600,%rax
+  800204:	00 00 00 
+  800207:	48 39 c3             	cmp    %rax,%rbx
+  80020a:	74 50                	je     80025c <umain+0x20a>
+        if (!r->count) continue;
+  80020c:	48 89 d9             	mov    %rbx,%rcx
+  80020f:	48 8b 3b             	mov    (%rbx),%rdi
+  800212:	48 85 ff             	test   %rdi,%rdi
+  800215:	74 de                	je     8001f5 <umain+0x1a3>
+                (unsigned long)cycles_to_us(r->cycles / r->count),
+                (unsigned long)cycles_to_us(r->max_cycles));
+  800217:	48 8b 43 18          	mov    0x18(%rbx),%rax
+    return tsc_khz ? cycles * 1000 / tsc_khz : 0;
+  80021b:	4d 8b 45 00          	mov    0x0(%r13),%r8
+  80021f:	4d 89 c1             	mov    %r8,%r9
+  800222:	4d 85 c0             	test   %r8,%r8
+  800225:	74 a6                	je     8001cd <umain+0x17b>
+  800227:	48 69 c0 e8 03 00 00 	imul   $0x3e8,%rax,%rax
+  80022e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800233:	49 f7 f0             	div    %r8
+  800236:	49 89 c1             	mov    %rax,%r9
+                (unsigned long)cycles_to_us(r->cycles / r->count),
+  800239:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80023d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800242:	48 f7 f7             	div    %rdi
+    return tsc_khz ? cycles * 1000 / tsc_khz : 0;
+  800245:	48 69 c0 e8 03 00 00 	imul   $0x3e8,%rax,%rax
+  80024c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800251:	49 f7 f0             	div    %r8
+  800254:	49 89 c0             	mov    %rax,%r8
+  800257:	e9 71 ff ff ff       	jmp    8001cd <umain+0x17b>
+    }
+
+    cprintf("Cache: %lu hits, %lu misses, %lu read ahead, %lu evicted, %lu resident, %lu suspended\n",
+            (unsigned long)st.ret_bc_hits, (unsigned long)st.ret_bc_misses,
+            (unsigned long)st.ret_bc_readahead, (unsigned long)st.ret_bc_evictions,
+            (unsigned long)st.ret_bc_resident, (unsigned long)st.ret_suspended);
+  80025c:	48 8d 98 00 fa ff ff 	lea    -0x600(%rax),%rbx
+    cprintf("Cache: %lu hits, %lu misses, %lu read ahead, %lu evicted, %lu resident, %lu suspended\n",
+  800263:	48 8b 8b 20 06 00 00 	mov    0x620(%rbx),%rcx
+  80026a:	48 8b 93 18 06 00 00 	mov    0x618(%rbx),%rdx
+  800271:	48 8b b3 10 06 00 00 	mov    0x610(%rbx),%rsi
+  800278:	48 83 ec 08          	sub    $0x8,%rsp
+  80027c:	ff b3 08 06 00 00    	push   0x608(%rbx)
+  800282:	4c 8b 8b 30 06 00 00 	mov    0x630(%rbx),%r9
+  800289:	4c 8b 83 28 06 00 00 	mov    0x628(%rbx),%r8
+  800290:	48 bf f0 50 80 00 00 	movabs $0x8050f0,%rdi
+  800297:	00 00 00 
+  80029a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029f:	49 bc 89 05 80 00 00 	movabs $0x800589,%r12
+  8002a6:	00 00 00 
+  8002a9:	41 ff d4             	call   *%r12
+    cprintf("Disk: %lu reads %luK, %lu writes %luK\n",
+            (unsigned long)st.ret_disk_reads, (unsigned long)(st.ret_disk_read_bytes / KB),
+            (unsigned long)st.ret_disk_writes, (unsigned long)(st.ret_disk_write_bytes / KB));
+  8002ac:	4c 8b 83 50 06 00 00 	mov    0x650(%rbx),%r8
+    cprintf("Disk: %lu reads %luK, %lu writes %luK\n",
+  8002b3:	48 8b 8b 40 06 00 00 	mov    0x640(%rbx),%rcx
+            (unsigned long)st.ret_disk_reads, (unsigned long)(st.ret_disk_read_bytes / KB),
+  8002ba:	48 8b 93 48 06 00 00 	mov    0x648(%rbx),%rdx
+  8002c1:	48 c1 ea 0a          	shr    $0xa,%rdx
+    cprintf("Disk: %lu reads %luK, %lu writes %luK\n",
+  8002c5:	48 8b b3 38 06 00 00 	mov    0x638(%rbx),%rsi
+  8002cc:	49 c1 e8 0a          	shr    $0xa,%r8
+  8002d0:	48 bf 48 51 80 00 00 	movabs $0x805148,%rdi
+  8002d7:	00 00 00 
+  8002da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002df:	41 ff d4             	call   *%r12
+
+    if (hist) {
+  8002e2:	48 83 c4 10          	add    $0x10,%rsp
+  8002e6:	83 7d a8 00          	cmpl   $0x0,-0x58(%rbp)
+  8002ea:	0f 84 11 01 00 00    	je     800401 <umain+0x3af>
+    return tsc_khz ? cycles * 1000 / tsc_khz : 0;
+  8002f0:	49 bd 58 76 80 00 00 	movabs $0x807658,%r13
+  8002f7:	00 00 00 
+  8002fa:	eb 5c                	jmp    800358 <umain+0x306>
+  8002fc:	49 8b 75 00          	mov    0x0(%r13),%rsi
+  800300:	48 85 f6             	test   %rsi,%rsi
+  800303:	74 15                	je     80031a <umain+0x2c8>
+  800305:	48 b8 00 00 00 00 e8 	movabs $0x3e800000000,%rax
+  80030c:	03 00 00 
+  80030f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800314:	48 f7 f6             	div    %rsi
+  800317:	48 89 c6             	mov    %rax,%rsi
+            cprintf("  >= %9lu us %8u\n",
+  80031a:	89 fa                	mov    %edi,%edx
+  80031c:	48 bf 8d 50 80 00 00 	movabs $0x80508d,%rdi
+  800323:	00 00 00 
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	48 b9 89 05 80 00 00 	movabs $0x800589,%rcx
+  800332:	00 00 00 
+  800335:	ff d1                	call   *%rcx
+        for (int t = 0; t < NFSREQ; t++)
+  800337:	48 83 6d a0 80       	subq   $0xffffffffffffff80,-0x60(%rbp)
+  80033c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800340:	48 83 45 98 08       	addq   $0x8,-0x68(%rbp)
+  800345:	48 ba 00 76 80 00 00 	movabs $0x807600,%rdx
+  80034c:	00 00 00 
+  80034f:	48 39 d0             	cmp    %rdx,%rax
+  800352:	0f 84 a9 00 00 00    	je     800401 <umain+0x3af>
+            if (st.ret_req[t].count) show_hist(req_names[t] ? req_names[t] : "?", &st.ret_req[t]);
+  800358:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80035c:	49 89 c4             	mov    %rax,%r12
+  80035f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800363:	74 d2                	je     800337 <umain+0x2e5>
+  800365:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800369:	48 8b 30             	mov    (%rax),%rsi
+  80036c:	48 85 f6             	test   %rsi,%rsi
+  80036f:	48 b8 19 50 80 00 00 	movabs $0x805019,%rax
+  800376:	00 00 00 
+  800379:	48 0f 44 f0          	cmove  %rax,%rsi
+    cprintf("%s latency:\n", name);
+  80037d:	48 bf 80 50 80 00 00 	movabs $0x805080,%rdi
+  800384:	00 00 00 
+  800387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038c:	48 ba 89 05 80 00 00 	movabs $0x800589,%rdx
+  800393:	00 00 00 
+  800396:	ff d2                	call   *%rdx
+  800398:	bb 00 00 00 00       	mov    $0x0,%ebx
+            cprintf("  <  %9lu us %8u\n",
+  80039d:	49 bf 9f 50 80 00 00 	movabs $0x80509f,%r15
+  8003a4:	00 00 00 
+  8003a7:	49 be 89 05 80 00 00 	movabs $0x800589,%r14
+  8003ae:	00 00 00 
+  8003b1:	eb 1b                	jmp    8003ce <umain+0x37c>
+  8003b3:	89 fa                	mov    %edi,%edx
+  8003b5:	4c 89 ff             	mov    %r15,%rdi
+  8003b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bd:	41 ff d6             	call   *%r14
+    for (int b = 0; b < FSSTAT_BUCKETS; b++) {
+  8003c0:	48 83 c3 01          	add    $0x1,%rbx
+  8003c4:	48 83 fb 18          	cmp    $0x18,%rbx
+  8003c8:	0f 84 69 ff ff ff    	je     800337 <umain+0x2e5>
+        if (!st->hist[b]) continue;
+  8003ce:	41 8b 7c 9c 20       	mov    0x20(%r12,%rbx,4),%edi
+  8003d3:	85 ff                	test   %edi,%edi
+  8003d5:	74 e9                	je     8003c0 <umain+0x36e>
+        if (b == FSSTAT_BUCKETS - 1)
+  8003d7:	83 fb 17             	cmp    $0x17,%ebx
+  8003da:	0f 84 1c ff ff ff    	je     8002fc <umain+0x2aa>
+    return tsc_khz ? cycles * 1000 / tsc_khz : 0;
+  8003e0:	49 8b 75 00          	mov    0x0(%r13),%rsi
+  8003e4:	48 85 f6             	test   %rsi,%rsi
+  8003e7:	74 ca                	je     8003b3 <umain+0x361>
+                    (unsigned long)cycles_to_us(1ULL << (FSSTAT_SHIFT + b)), st->hist[b]);
+  8003e9:	8d 4b 0a             	lea    0xa(%rbx),%ecx
+    return tsc_khz ? cycles * 1000 / tsc_khz : 0;
+  8003ec:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+  8003f1:	48 d3 e0             	shl    %cl,%rax
+  8003f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f9:	48 f7 f6             	div    %rsi
+  8003fc:	48 89 c6             	mov    %rax,%rsi
+  8003ff:	eb b2                	jmp    8003b3 <umain+0x361>
+    }
+}
+  800401:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800405:	5b                   	pop    %rbx
+  800406:	41 5c                	pop    %r12
+  800408:	41 5d                	pop    %r13
+  80040a:	41 5e                	pop    %r14
+  80040c:	41 5f                	pop    %r15
+  80040e:	5d                   	pop    %rbp
+  80040f:	c3                   	ret
+
+0000000000800410 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800410:	55                   	push   %rbp
+  800411:	48 89 e5             	mov    %rsp,%rbp
+  800414:	41 56                	push   %r14
+  800416:	41 55                	push   %r13
+  800418:	41 54                	push   %r12
+  80041a:	53                   	push   %rbx
+  80041b:	41 89 fd             	mov    %edi,%r13d
+  80041e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800421:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800428:	00 00 00 
+  80042b:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800432:	00 00 00 
+  800435:	48 39 c2             	cmp    %rax,%rdx
+  800438:	73 17                	jae    800451 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80043a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80043d:	49 89 c4             	mov    %rax,%r12
+  800440:	48 83 c3 08          	add    $0x8,%rbx
+  800444:	b8 00 00 00 00       	mov    $0x0,%eax
+  800449:	ff 53 f8             	call   *-0x8(%rbx)
+  80044c:	4c 39 e3             	cmp    %r12,%rbx
+  80044f:	72 ef                	jb     800440 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800451:	48 b8 a1 15 80 00 00 	movabs $0x8015a1,%rax
+  800458:	00 00 00 
+  80045b:	ff d0                	call   *%rax
+  80045d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800462:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800469:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800470:	00 00 00 
+  800473:	48 01 d0             	add    %rdx,%rax
+  800476:	48 a3 60 76 80 00 00 	movabs %rax,0x807660
+  80047d:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800480:	45 85 ed             	test   %r13d,%r13d
+  800483:	7e 0d                	jle    800492 <libmain+0x82>
+  800485:	49 8b 06             	mov    (%r14),%rax
+  800488:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80048f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800492:	4c 89 f6             	mov    %r14,%rsi
+  800495:	44 89 ef             	mov    %r13d,%edi
+  800498:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  80049f:	00 00 00 
+  8004a2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8004a4:	48 b8 b9 04 80 00 00 	movabs $0x8004b9,%rax
+  8004ab:	00 00 00 
+  8004ae:	ff d0                	call   *%rax
+#endif
+}
+  8004b0:	5b                   	pop    %rbx
+  8004b1:	41 5c                	pop    %r12
+  8004b3:	41 5d                	pop    %r13
+  8004b5:	41 5e                	pop    %r14
+  8004b7:	5d                   	pop    %rbp
+  8004b8:	c3                   	ret
+
+00000000008004b9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004b9:	55                   	push   %rbp
+  8004ba:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8004bd:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  8004c4:	00 00 00 
+  8004c7:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8004c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004ce:	48 b8 36 15 80 00 00 	movabs $0x801536,%rax
+  8004d5:	00 00 00 
+  8004d8:	ff d0                	call   *%rax
+}
+  8004da:	5d                   	pop    %rbp
+  8004db:	c3                   	ret
+
+00000000008004dc <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004dc:	55                   	push   %rbp
+  8004dd:	48 89 e5             	mov    %rsp,%rbp
+  8004e0:	53                   	push   %rbx
+  8004e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8004e5:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004e8:	8b 06                	mov    (%rsi),%eax
+  8004ea:	8d 50 01             	lea    0x1(%rax),%edx
+  8004ed:	89 16                	mov    %edx,(%rsi)
+  8004ef:	48 98                	cltq
+  8004f1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004f6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004fc:	74 0a                	je     800508 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004fe:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800502:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800506:	c9                   	leave
+  800507:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800508:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80050c:	be ff 00 00 00       	mov    $0xff,%esi
+  800511:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  800518:	00 00 00 
+  80051b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80051d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800523:	eb d9                	jmp    8004fe <putch+0x22>
+
+0000000000800525 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800525:	55                   	push   %rbp
+  800526:	48 89 e5             	mov    %rsp,%rbp
+  800529:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800530:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800533:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80053a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80053f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800544:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800547:	48 89 f1             	mov    %rsi,%rcx
+  80054a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800551:	48 bf dc 04 80 00 00 	movabs $0x8004dc,%rdi
+  800558:	00 00 00 
+  80055b:	48 b8 d9 06 80 00 00 	movabs $0x8006d9,%rax
+  800562:	00 00 00 
+  800565:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800567:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80056e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800575:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  80057c:	00 00 00 
+  80057f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800581:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800587:	c9                   	leave
+  800588:	c3                   	ret
+
+0000000000800589 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800589:	55                   	push   %rbp
+  80058a:	48 89 e5             	mov    %rsp,%rbp
+  80058d:	48 83 ec 50          	sub    $0x50,%rsp
+  800591:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800595:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800599:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80059d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005a1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005a5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005ac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005bc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005c0:	48 b8 25 05 80 00 00 	movabs $0x800525,%rax
+  8005c7:	00 00 00 
+  8005ca:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005cc:	c9                   	leave
+  8005cd:	c3                   	ret
+
+00000000008005ce <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005ce:	55                   	push   %rbp
+  8005cf:	48 89 e5             	mov    %rsp,%rbp
+  8005d2:	41 57                	push   %r15
+  8005d4:	41 56                	push   %r14
+  8005d6:	41 55                	push   %r13
+  8005d8:	41 54                	push   %r12
+  8005da:	53                   	push   %rbx
+  8005db:	48 83 ec 18          	sub    $0x18,%rsp
+  8005df:	49 89 fc             	mov    %rdi,%r12
+  8005e2:	49 89 f5             	mov    %rsi,%r13
+  8005e5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005e9:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005ec:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005ef:	41 89 cf             	mov    %ecx,%r15d
+  8005f2:	4c 39 fa             	cmp    %r15,%rdx
+  8005f5:	73 5b                	jae    800652 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005f7:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005fb:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005ff:	85 db                	test   %ebx,%ebx
+  800601:	7e 0e                	jle    800611 <print_num+0x43>
+            putch(padc, put_arg);
+  800603:	4c 89 ee             	mov    %r13,%rsi
+  800606:	44 89 f7             	mov    %r14d,%edi
+  800609:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80060c:	83 eb 01             	sub    $0x1,%ebx
+  80060f:	75 f2                	jne    800603 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800611:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800615:	48 b9 fb 51 80 00 00 	movabs $0x8051fb,%rcx
+  80061c:	00 00 00 
+  80061f:	48 b8 ea 51 80 00 00 	movabs $0x8051ea,%rax
+  800626:	00 00 00 
+  800629:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80062d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800631:	ba 00 00 00 00       	mov    $0x0,%edx
+  800636:	49 f7 f7             	div    %r15
+  800639:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80063d:	4c 89 ee             	mov    %r13,%rsi
+  800640:	41 ff d4             	call   *%r12
+}
+  800643:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800647:	5b                   	pop    %rbx
+  800648:	41 5c                	pop    %r12
+  80064a:	41 5d                	pop    %r13
+  80064c:	41 5e                	pop    %r14
+  80064e:	41 5f                	pop    %r15
+  800650:	5d                   	pop    %rbp
+  800651:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800652:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800656:	ba 00 00 00 00       	mov    $0x0,%edx
+  80065b:	49 f7 f7             	div    %r15
+  80065e:	48 83 ec 08          	sub    $0x8,%rsp
+  800662:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800666:	52                   	push   %rdx
+  800667:	45 0f be c9          	movsbl %r9b,%r9d
+  80066b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80066f:	48 89 c2             	mov    %rax,%rdx
+  800672:	48 b8 ce 05 80 00 00 	movabs $0x8005ce,%rax
+  800679:	00 00 00 
+  80067c:	ff d0                	call   *%rax
+  80067e:	48 83 c4 10          	add    $0x10,%rsp
+  800682:	eb 8d                	jmp    800611 <print_num+0x43>
+
+0000000000800684 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800684:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800688:	48 8b 06             	mov    (%rsi),%rax
+  80068b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80068f:	73 0a                	jae    80069b <sprintputch+0x17>
+        *state->start++ = ch;
+  800691:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800695:	48 89 16             	mov    %rdx,(%rsi)
+  800698:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80069b:	c3                   	ret
+
+000000000080069c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80069c:	55                   	push   %rbp
+  80069d:	48 89 e5             	mov    %rsp,%rbp
+  8006a0:	48 83 ec 50          	sub    $0x50,%rsp
+  8006a4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006a8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006ac:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006b0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006b7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006bf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006c3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006c7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006cb:	48 b8 d9 06 80 00 00 	movabs $0x8006d9,%rax
+  8006d2:	00 00 00 
+  8006d5:	ff d0                	call   *%rax
+}
+  8006d7:	c9                   	leave
+  8006d8:	c3                   	ret
+
+00000000008006d9 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006d9:	55                   	push   %rbp
+  8006da:	48 89 e5             	mov    %rsp,%rbp
+  8006dd:	41 57                	push   %r15
+  8006df:	41 56                	push   %r14
+  8006e1:	41 55                	push   %r13
+  8006e3:	41 54                	push   %r12
+  8006e5:	53                   	push   %rbx
+  8006e6:	48 83 ec 38          	sub    $0x38,%rsp
+  8006ea:	49 89 fe             	mov    %rdi,%r14
+  8006ed:	49 89 f5             	mov    %rsi,%r13
+  8006f0:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006f3:	48 8b 01             	mov    (%rcx),%rax
+  8006f6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006fa:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800702:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800706:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80070a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80070e:	0f b6 3b             	movzbl (%rbx),%edi
+  800711:	40 80 ff 25          	cmp    $0x25,%dil
+  800715:	74 18                	je     80072f <vprintfmt+0x56>
+            if (!ch) return;
+  800717:	40 84 ff             	test   %dil,%dil
+  80071a:	0f 84 04 07 00 00    	je     800e24 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800720:	40 0f b6 ff          	movzbl %dil,%edi
+  800724:	4c 89 ee             	mov    %r13,%rsi
+  800727:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80072a:	4c 89 e3             	mov    %r12,%rbx
+  80072d:	eb db                	jmp    80070a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80072f:	be 00 00 00 00       	mov    $0x0,%esi
+  800734:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800738:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80073d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800743:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80074a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80074e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800753:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800758:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80075b:	83 e8 23             	sub    $0x23,%eax
+  80075e:	3c 57                	cmp    $0x57,%al
+  800760:	0f 87 a4 06 00 00    	ja     800e0a <vprintfmt+0x731>
+  800766:	0f b6 c0             	movzbl %al,%eax
+  800769:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  800770:	00 00 00 
+  800773:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800776:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800779:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80077d:	eb cf                	jmp    80074e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80077f:	49 89 dc             	mov    %rbx,%r12
+  800782:	be 01 00 00 00       	mov    $0x1,%esi
+  800787:	eb c5                	jmp    80074e <vprintfmt+0x75>
+            padc = ch;
+  800789:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80078d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800790:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800793:	eb b9                	jmp    80074e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800795:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800798:	83 f8 2f             	cmp    $0x2f,%eax
+  80079b:	77 24                	ja     8007c1 <vprintfmt+0xe8>
+  80079d:	89 c1                	mov    %eax,%ecx
+  80079f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007a3:	83 c0 08             	add    $0x8,%eax
+  8007a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007ac:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007af:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007b3:	79 99                	jns    80074e <vprintfmt+0x75>
+                width = precision;
+  8007b5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007b9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007bf:	eb 8d                	jmp    80074e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007c1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007c5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cd:	eb da                	jmp    8007a9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007cf:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007d4:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007d8:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007de:	3c 39                	cmp    $0x39,%al
+  8007e0:	77 1c                	ja     8007fe <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007e2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007e6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007ea:	0f b6 c0             	movzbl %al,%eax
+  8007ed:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007f2:	0f b6 03             	movzbl (%rbx),%eax
+  8007f5:	3c 39                	cmp    $0x39,%al
+  8007f7:	76 e9                	jbe    8007e2 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007f9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007fc:	eb b1                	jmp    8007af <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007fe:	49 89 dc             	mov    %rbx,%r12
+  800801:	eb ac                	jmp    8007af <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800803:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800806:	85 c9                	test   %ecx,%ecx
+  800808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080d:	0f 49 c1             	cmovns %ecx,%eax
+  800810:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800813:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800816:	e9 33 ff ff ff       	jmp    80074e <vprintfmt+0x75>
+            lflag++;
+  80081b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80081e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800821:	e9 28 ff ff ff       	jmp    80074e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800826:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800829:	83 f8 2f             	cmp    $0x2f,%eax
+  80082c:	77 19                	ja     800847 <vprintfmt+0x16e>
+  80082e:	89 c2                	mov    %eax,%edx
+  800830:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800834:	83 c0 08             	add    $0x8,%eax
+  800837:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083a:	8b 3a                	mov    (%rdx),%edi
+  80083c:	4c 89 ee             	mov    %r13,%rsi
+  80083f:	41 ff d6             	call   *%r14
+            break;
+  800842:	e9 c3 fe ff ff       	jmp    80070a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800847:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800853:	eb e5                	jmp    80083a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800855:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800858:	83 f8 2f             	cmp    $0x2f,%eax
+  80085b:	77 5a                	ja     8008b7 <vprintfmt+0x1de>
+  80085d:	89 c2                	mov    %eax,%edx
+  80085f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800863:	83 c0 08             	add    $0x8,%eax
+  800866:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800869:	8b 02                	mov    (%rdx),%eax
+  80086b:	89 c1                	mov    %eax,%ecx
+  80086d:	f7 d9                	neg    %ecx
+  80086f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800872:	83 f9 13             	cmp    $0x13,%ecx
+  800875:	7f 4e                	jg     8008c5 <vprintfmt+0x1ec>
+  800877:	48 63 c1             	movslq %ecx,%rax
+  80087a:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  800881:	00 00 00 
+  800884:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800888:	48 85 c0             	test   %rax,%rax
+  80088b:	74 38                	je     8008c5 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80088d:	48 89 c1             	mov    %rax,%rcx
+  800890:	48 ba 79 58 80 00 00 	movabs $0x805879,%rdx
+  800897:	00 00 00 
+  80089a:	4c 89 ee             	mov    %r13,%rsi
+  80089d:	4c 89 f7             	mov    %r14,%rdi
+  8008a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a5:	49 b8 9c 06 80 00 00 	movabs $0x80069c,%r8
+  8008ac:	00 00 00 
+  8008af:	41 ff d0             	call   *%r8
+  8008b2:	e9 53 fe ff ff       	jmp    80070a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c3:	eb a4                	jmp    800869 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008c5:	48 ba 13 52 80 00 00 	movabs $0x805213,%rdx
+  8008cc:	00 00 00 
+  8008cf:	4c 89 ee             	mov    %r13,%rsi
+  8008d2:	4c 89 f7             	mov    %r14,%rdi
+  8008d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008da:	49 b8 9c 06 80 00 00 	movabs $0x80069c,%r8
+  8008e1:	00 00 00 
+  8008e4:	41 ff d0             	call   *%r8
+  8008e7:	e9 1e fe ff ff       	jmp    80070a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f2:	77 36                	ja     80092a <vprintfmt+0x251>
+  8008f4:	89 c2                	mov    %eax,%edx
+  8008f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fa:	83 c0 08             	add    $0x8,%eax
+  8008fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800900:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800903:	48 85 f6             	test   %rsi,%rsi
+  800906:	48 b8 0c 52 80 00 00 	movabs $0x80520c,%rax
+  80090d:	00 00 00 
+  800910:	48 0f 45 c6          	cmovne %rsi,%rax
+  800914:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800918:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80091c:	7e 06                	jle    800924 <vprintfmt+0x24b>
+  80091e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800922:	75 14                	jne    800938 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800924:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800928:	eb 5b                	jmp    800985 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80092a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800932:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800936:	eb c8                	jmp    800900 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800938:	49 63 f7             	movslq %r15d,%rsi
+  80093b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80093f:	48 b8 de 0e 80 00 00 	movabs $0x800ede,%rax
+  800946:	00 00 00 
+  800949:	ff d0                	call   *%rax
+  80094b:	48 89 c2             	mov    %rax,%rdx
+  80094e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800951:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800953:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800956:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800959:	85 c0                	test   %eax,%eax
+  80095b:	7e c7                	jle    800924 <vprintfmt+0x24b>
+  80095d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800962:	4c 89 ee             	mov    %r13,%rsi
+  800965:	44 89 e7             	mov    %r12d,%edi
+  800968:	41 ff d6             	call   *%r14
+  80096b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80096f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800972:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800975:	75 eb                	jne    800962 <vprintfmt+0x289>
+  800977:	eb ab                	jmp    800924 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800979:	0f b6 f8             	movzbl %al,%edi
+  80097c:	4c 89 ee             	mov    %r13,%rsi
+  80097f:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800982:	4c 89 e2             	mov    %r12,%rdx
+  800985:	45 85 ff             	test   %r15d,%r15d
+  800988:	78 06                	js     800990 <vprintfmt+0x2b7>
+  80098a:	41 83 ef 01          	sub    $0x1,%r15d
+  80098e:	78 23                	js     8009b3 <vprintfmt+0x2da>
+  800990:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800994:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80099a:	84 c0                	test   %al,%al
+  80099c:	74 15                	je     8009b3 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80099e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009a2:	74 d5                	je     800979 <vprintfmt+0x2a0>
+  8009a4:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009a7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009ac:	80 fa 5e             	cmp    $0x5e,%dl
+  8009af:	77 cb                	ja     80097c <vprintfmt+0x2a3>
+  8009b1:	eb c6                	jmp    800979 <vprintfmt+0x2a0>
+  8009b3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b6:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8009b9:	01 f0                	add    %esi,%eax
+  8009bb:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8009bd:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009c1:	85 c0                	test   %eax,%eax
+  8009c3:	0f 8e 41 fd ff ff    	jle    80070a <vprintfmt+0x31>
+  8009c9:	4c 89 ee             	mov    %r13,%rsi
+  8009cc:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009d1:	41 ff d6             	call   *%r14
+  8009d4:	41 83 ec 01          	sub    $0x1,%r12d
+  8009d8:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009dc:	75 eb                	jne    8009c9 <vprintfmt+0x2f0>
+  8009de:	e9 27 fd ff ff       	jmp    80070a <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e3:	40 84 f6             	test   %sil,%sil
+  8009e6:	75 26                	jne    800a0e <vprintfmt+0x335>
+    switch (lflag) {
+  8009e8:	85 d2                	test   %edx,%edx
+  8009ea:	74 59                	je     800a45 <vprintfmt+0x36c>
+  8009ec:	83 fa 01             	cmp    $0x1,%edx
+  8009ef:	74 7b                	je     800a6c <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8009f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f7:	0f 87 96 00 00 00    	ja     800a93 <vprintfmt+0x3ba>
+  8009fd:	89 c2                	mov    %eax,%edx
+  8009ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a03:	83 c0 08             	add    $0x8,%eax
+  800a06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a09:	4c 8b 22             	mov    (%rdx),%r12
+  800a0c:	eb 17                	jmp    800a25 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800a0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a11:	83 f8 2f             	cmp    $0x2f,%eax
+  800a14:	77 21                	ja     800a37 <vprintfmt+0x35e>
+  800a16:	89 c2                	mov    %eax,%edx
+  800a18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1c:	83 c0 08             	add    $0x8,%eax
+  800a1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a22:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a25:	4d 85 e4             	test   %r12,%r12
+  800a28:	78 7a                	js     800aa4 <vprintfmt+0x3cb>
+            num = i;
+  800a2a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a2d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a32:	e9 b5 02 00 00       	jmp    800cec <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a43:	eb dd                	jmp    800a22 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800a45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a48:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4b:	77 11                	ja     800a5e <vprintfmt+0x385>
+  800a4d:	89 c2                	mov    %eax,%edx
+  800a4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a53:	83 c0 08             	add    $0x8,%eax
+  800a56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a59:	4c 63 22             	movslq (%rdx),%r12
+  800a5c:	eb c7                	jmp    800a25 <vprintfmt+0x34c>
+  800a5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6a:	eb ed                	jmp    800a59 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800a6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a72:	77 11                	ja     800a85 <vprintfmt+0x3ac>
+  800a74:	89 c2                	mov    %eax,%edx
+  800a76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7a:	83 c0 08             	add    $0x8,%eax
+  800a7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a80:	4c 8b 22             	mov    (%rdx),%r12
+  800a83:	eb a0                	jmp    800a25 <vprintfmt+0x34c>
+  800a85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a91:	eb ed                	jmp    800a80 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800a93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9f:	e9 65 ff ff ff       	jmp    800a09 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800aa4:	4c 89 ee             	mov    %r13,%rsi
+  800aa7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800aac:	41 ff d6             	call   *%r14
+                i = -i;
+  800aaf:	49 f7 dc             	neg    %r12
+  800ab2:	e9 73 ff ff ff       	jmp    800a2a <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab7:	40 84 f6             	test   %sil,%sil
+  800aba:	75 32                	jne    800aee <vprintfmt+0x415>
+    switch (lflag) {
+  800abc:	85 d2                	test   %edx,%edx
+  800abe:	74 5d                	je     800b1d <vprintfmt+0x444>
+  800ac0:	83 fa 01             	cmp    $0x1,%edx
+  800ac3:	0f 84 82 00 00 00    	je     800b4b <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800ac9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acc:	83 f8 2f             	cmp    $0x2f,%eax
+  800acf:	0f 87 a5 00 00 00    	ja     800b7a <vprintfmt+0x4a1>
+  800ad5:	89 c2                	mov    %eax,%edx
+  800ad7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800adb:	83 c0 08             	add    $0x8,%eax
+  800ade:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ae9:	e9 fe 01 00 00       	jmp    800cec <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800aee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af1:	83 f8 2f             	cmp    $0x2f,%eax
+  800af4:	77 19                	ja     800b0f <vprintfmt+0x436>
+  800af6:	89 c2                	mov    %eax,%edx
+  800af8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800afc:	83 c0 08             	add    $0x8,%eax
+  800aff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b02:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b05:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b0a:	e9 dd 01 00 00       	jmp    800cec <vprintfmt+0x613>
+  800b0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1b:	eb e5                	jmp    800b02 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800b1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b20:	83 f8 2f             	cmp    $0x2f,%eax
+  800b23:	77 18                	ja     800b3d <vprintfmt+0x464>
+  800b25:	89 c2                	mov    %eax,%edx
+  800b27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2b:	83 c0 08             	add    $0x8,%eax
+  800b2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b31:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b33:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b38:	e9 af 01 00 00       	jmp    800cec <vprintfmt+0x613>
+  800b3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b49:	eb e6                	jmp    800b31 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800b4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b51:	77 19                	ja     800b6c <vprintfmt+0x493>
+  800b53:	89 c2                	mov    %eax,%edx
+  800b55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b59:	83 c0 08             	add    $0x8,%eax
+  800b5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b62:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b67:	e9 80 01 00 00       	jmp    800cec <vprintfmt+0x613>
+  800b6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b78:	eb e5                	jmp    800b5f <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800b7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b86:	e9 56 ff ff ff       	jmp    800ae1 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800b8b:	40 84 f6             	test   %sil,%sil
+  800b8e:	75 2e                	jne    800bbe <vprintfmt+0x4e5>
+    switch (lflag) {
+  800b90:	85 d2                	test   %edx,%edx
+  800b92:	0f 84 b3 00 00 00    	je     800c4b <vprintfmt+0x572>
+  800b98:	83 fa 01             	cmp    $0x1,%edx
+  800b9b:	0f 84 d3 00 00 00    	je     800c74 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800ba1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba7:	0f 87 f1 00 00 00    	ja     800c9e <vprintfmt+0x5c5>
+  800bad:	89 c2                	mov    %eax,%edx
+  800baf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb3:	83 c0 08             	add    $0x8,%eax
+  800bb6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb9:	48 8b 02             	mov    (%rdx),%rax
+  800bbc:	eb 17                	jmp    800bd5 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800bbe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc4:	77 77                	ja     800c3d <vprintfmt+0x564>
+  800bc6:	89 c2                	mov    %eax,%edx
+  800bc8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcc:	83 c0 08             	add    $0x8,%eax
+  800bcf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd2:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800bd5:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800bd7:	83 f8 07             	cmp    $0x7,%eax
+  800bda:	0f 8e cf 00 00 00    	jle    800caf <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800be0:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800be6:	44 89 e7             	mov    %r12d,%edi
+  800be9:	41 c1 e4 03          	shl    $0x3,%r12d
+  800bed:	89 d1                	mov    %edx,%ecx
+  800bef:	8d 72 07             	lea    0x7(%rdx),%esi
+  800bf2:	85 d2                	test   %edx,%edx
+  800bf4:	0f 48 d6             	cmovs  %esi,%edx
+  800bf7:	c1 fa 03             	sar    $0x3,%edx
+  800bfa:	83 f9 3f             	cmp    $0x3f,%ecx
+  800bfd:	7f e7                	jg     800be6 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800bff:	85 ff                	test   %edi,%edi
+  800c01:	0f 84 03 fb ff ff    	je     80070a <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800c07:	49 63 f4             	movslq %r12d,%rsi
+  800c0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0f:	48 f7 f6             	div    %rsi
+  800c12:	49 89 d7             	mov    %rdx,%r15
+  800c15:	83 c0 30             	add    $0x30,%eax
+  800c18:	0f be f8             	movsbl %al,%edi
+  800c1b:	4c 89 ee             	mov    %r13,%rsi
+  800c1e:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800c21:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800c24:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800c29:	45 85 e4             	test   %r12d,%r12d
+  800c2c:	41 0f 49 d4          	cmovns %r12d,%edx
+  800c30:	c1 fa 03             	sar    $0x3,%edx
+  800c33:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800c36:	75 cf                	jne    800c07 <vprintfmt+0x52e>
+  800c38:	e9 cd fa ff ff       	jmp    80070a <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800c3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c49:	eb 87                	jmp    800bd2 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800c4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c51:	77 13                	ja     800c66 <vprintfmt+0x58d>
+  800c53:	89 c2                	mov    %eax,%edx
+  800c55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c59:	83 c0 08             	add    $0x8,%eax
+  800c5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5f:	8b 02                	mov    (%rdx),%eax
+  800c61:	e9 6f ff ff ff       	jmp    800bd5 <vprintfmt+0x4fc>
+  800c66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c72:	eb eb                	jmp    800c5f <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800c74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c77:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7a:	77 14                	ja     800c90 <vprintfmt+0x5b7>
+  800c7c:	89 c2                	mov    %eax,%edx
+  800c7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c82:	83 c0 08             	add    $0x8,%eax
+  800c85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c88:	48 8b 02             	mov    (%rdx),%rax
+  800c8b:	e9 45 ff ff ff       	jmp    800bd5 <vprintfmt+0x4fc>
+  800c90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9c:	eb ea                	jmp    800c88 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800c9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800caa:	e9 0a ff ff ff       	jmp    800bb9 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800caf:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800cb5:	e9 4d ff ff ff       	jmp    800c07 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800cba:	4c 89 ee             	mov    %r13,%rsi
+  800cbd:	bf 30 00 00 00       	mov    $0x30,%edi
+  800cc2:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800cc5:	4c 89 ee             	mov    %r13,%rsi
+  800cc8:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ccd:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cd0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd3:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd6:	77 47                	ja     800d1f <vprintfmt+0x646>
+  800cd8:	89 c2                	mov    %eax,%edx
+  800cda:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cde:	83 c0 08             	add    $0x8,%eax
+  800ce1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ce7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cec:	48 83 ec 08          	sub    $0x8,%rsp
+  800cf0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cf4:	0f 94 c0             	sete   %al
+  800cf7:	0f b6 c0             	movzbl %al,%eax
+  800cfa:	50                   	push   %rax
+  800cfb:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d00:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d04:	4c 89 ee             	mov    %r13,%rsi
+  800d07:	4c 89 f7             	mov    %r14,%rdi
+  800d0a:	48 b8 ce 05 80 00 00 	movabs $0x8005ce,%rax
+  800d11:	00 00 00 
+  800d14:	ff d0                	call   *%rax
+            break;
+  800d16:	48 83 c4 10          	add    $0x10,%rsp
+  800d1a:	e9 eb f9 ff ff       	jmp    80070a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2b:	eb b7                	jmp    800ce4 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800d2d:	40 84 f6             	test   %sil,%sil
+  800d30:	75 2b                	jne    800d5d <vprintfmt+0x684>
+    switch (lflag) {
+  800d32:	85 d2                	test   %edx,%edx
+  800d34:	74 56                	je     800d8c <vprintfmt+0x6b3>
+  800d36:	83 fa 01             	cmp    $0x1,%edx
+  800d39:	74 7f                	je     800dba <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800d3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d41:	0f 87 a2 00 00 00    	ja     800de9 <vprintfmt+0x710>
+  800d47:	89 c2                	mov    %eax,%edx
+  800d49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4d:	83 c0 08             	add    $0x8,%eax
+  800d50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d53:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d56:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d5b:	eb 8f                	jmp    800cec <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800d5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d60:	83 f8 2f             	cmp    $0x2f,%eax
+  800d63:	77 19                	ja     800d7e <vprintfmt+0x6a5>
+  800d65:	89 c2                	mov    %eax,%edx
+  800d67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d6b:	83 c0 08             	add    $0x8,%eax
+  800d6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d71:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d74:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d79:	e9 6e ff ff ff       	jmp    800cec <vprintfmt+0x613>
+  800d7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8a:	eb e5                	jmp    800d71 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800d8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d92:	77 18                	ja     800dac <vprintfmt+0x6d3>
+  800d94:	89 c2                	mov    %eax,%edx
+  800d96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d9a:	83 c0 08             	add    $0x8,%eax
+  800d9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da0:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800da2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800da7:	e9 40 ff ff ff       	jmp    800cec <vprintfmt+0x613>
+  800dac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800db4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db8:	eb e6                	jmp    800da0 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800dba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dbd:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc0:	77 19                	ja     800ddb <vprintfmt+0x702>
+  800dc2:	89 c2                	mov    %eax,%edx
+  800dc4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc8:	83 c0 08             	add    $0x8,%eax
+  800dcb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dd1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800dd6:	e9 11 ff ff ff       	jmp    800cec <vprintfmt+0x613>
+  800ddb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ddf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800de3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de7:	eb e5                	jmp    800dce <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800de9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ded:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800df1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800df5:	e9 59 ff ff ff       	jmp    800d53 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800dfa:	4c 89 ee             	mov    %r13,%rsi
+  800dfd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e02:	41 ff d6             	call   *%r14
+            break;
+  800e05:	e9 00 f9 ff ff       	jmp    80070a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e0a:	4c 89 ee             	mov    %r13,%rsi
+  800e0d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e12:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e15:	48 83 eb 01          	sub    $0x1,%rbx
+  800e19:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e1d:	75 f6                	jne    800e15 <vprintfmt+0x73c>
+  800e1f:	e9 e6 f8 ff ff       	jmp    80070a <vprintfmt+0x31>
+}
+  800e24:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e28:	5b                   	pop    %rbx
+  800e29:	41 5c                	pop    %r12
+  800e2b:	41 5d                	pop    %r13
+  800e2d:	41 5e                	pop    %r14
+  800e2f:	41 5f                	pop    %r15
+  800e31:	5d                   	pop    %rbp
+  800e32:	c3                   	ret
+
+0000000000800e33 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e33:	55                   	push   %rbp
+  800e34:	48 89 e5             	mov    %rsp,%rbp
+  800e37:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e3b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e3f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e44:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e48:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e4f:	48 85 ff             	test   %rdi,%rdi
+  800e52:	74 2b                	je     800e7f <vsnprintf+0x4c>
+  800e54:	48 85 f6             	test   %rsi,%rsi
+  800e57:	74 26                	je     800e7f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e59:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e5d:	48 bf 84 06 80 00 00 	movabs $0x800684,%rdi
+  800e64:	00 00 00 
+  800e67:	48 b8 d9 06 80 00 00 	movabs $0x8006d9,%rax
+  800e6e:	00 00 00 
+  800e71:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e77:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e7a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e7d:	c9                   	leave
+  800e7e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e84:	eb f7                	jmp    800e7d <vsnprintf+0x4a>
+
+0000000000800e86 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e86:	55                   	push   %rbp
+  800e87:	48 89 e5             	mov    %rsp,%rbp
+  800e8a:	48 83 ec 50          	sub    $0x50,%rsp
+  800e8e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e92:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e96:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e9a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ea1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ea5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ead:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800eb1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800eb5:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  800ebc:	00 00 00 
+  800ebf:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ec1:	c9                   	leave
+  800ec2:	c3                   	ret
+
+0000000000800ec3 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ec3:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ec6:	74 10                	je     800ed8 <strlen+0x15>
+    size_t n = 0;
+  800ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ecd:	48 83 c0 01          	add    $0x1,%rax
+  800ed1:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ed5:	75 f6                	jne    800ecd <strlen+0xa>
+  800ed7:	c3                   	ret
+    size_t n = 0;
+  800ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800edd:	c3                   	ret
+
+0000000000800ede <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ede:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ee1:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ee6:	48 85 f6             	test   %rsi,%rsi
+  800ee9:	74 11                	je     800efc <strnlen+0x1e>
+  800eeb:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800eef:	74 0c                	je     800efd <strnlen+0x1f>
+  800ef1:	48 83 c2 01          	add    $0x1,%rdx
+  800ef5:	48 39 d0             	cmp    %rdx,%rax
+  800ef8:	75 f1                	jne    800eeb <strnlen+0xd>
+  800efa:	eb 04                	jmp    800f00 <strnlen+0x22>
+  800efc:	c3                   	ret
+  800efd:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f00:	c3                   	ret
+
+0000000000800f01 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f01:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f04:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f09:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f0d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f10:	48 83 c2 01          	add    $0x1,%rdx
+  800f14:	84 c9                	test   %cl,%cl
+  800f16:	75 f1                	jne    800f09 <strcpy+0x8>
+        ;
+    return res;
+}
+  800f18:	c3                   	ret
+
+0000000000800f19 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f19:	55                   	push   %rbp
+  800f1a:	48 89 e5             	mov    %rsp,%rbp
+  800f1d:	41 54                	push   %r12
+  800f1f:	53                   	push   %rbx
+  800f20:	48 89 fb             	mov    %rdi,%rbx
+  800f23:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f26:	48 b8 c3 0e 80 00 00 	movabs $0x800ec3,%rax
+  800f2d:	00 00 00 
+  800f30:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f32:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f36:	4c 89 e6             	mov    %r12,%rsi
+  800f39:	48 b8 01 0f 80 00 00 	movabs $0x800f01,%rax
+  800f40:	00 00 00 
+  800f43:	ff d0                	call   *%rax
+    return dst;
+}
+  800f45:	48 89 d8             	mov    %rbx,%rax
+  800f48:	5b                   	pop    %rbx
+  800f49:	41 5c                	pop    %r12
+  800f4b:	5d                   	pop    %rbp
+  800f4c:	c3                   	ret
+
+0000000000800f4d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f4d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f50:	48 85 d2             	test   %rdx,%rdx
+  800f53:	74 1f                	je     800f74 <strncpy+0x27>
+  800f55:	48 01 fa             	add    %rdi,%rdx
+  800f58:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f5b:	48 83 c1 01          	add    $0x1,%rcx
+  800f5f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f63:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f67:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f6b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f6f:	48 39 ca             	cmp    %rcx,%rdx
+  800f72:	75 e7                	jne    800f5b <strncpy+0xe>
+    }
+    return ret;
+}
+  800f74:	c3                   	ret
+
+0000000000800f75 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f75:	48 89 f8             	mov    %rdi,%rax
+  800f78:	48 85 d2             	test   %rdx,%rdx
+  800f7b:	74 24                	je     800fa1 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f7d:	48 83 ea 01          	sub    $0x1,%rdx
+  800f81:	74 1b                	je     800f9e <strlcpy+0x29>
+  800f83:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f87:	0f b6 16             	movzbl (%rsi),%edx
+  800f8a:	84 d2                	test   %dl,%dl
+  800f8c:	74 10                	je     800f9e <strlcpy+0x29>
+            *dst++ = *src++;
+  800f8e:	48 83 c6 01          	add    $0x1,%rsi
+  800f92:	48 83 c0 01          	add    $0x1,%rax
+  800f96:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f99:	48 39 c8             	cmp    %rcx,%rax
+  800f9c:	75 e9                	jne    800f87 <strlcpy+0x12>
+        *dst = '\0';
+  800f9e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800fa1:	48 29 f8             	sub    %rdi,%rax
+}
+  800fa4:	c3                   	ret
+
+0000000000800fa5 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800fa5:	0f b6 07             	movzbl (%rdi),%eax
+  800fa8:	84 c0                	test   %al,%al
+  800faa:	74 13                	je     800fbf <strcmp+0x1a>
+  800fac:	38 06                	cmp    %al,(%rsi)
+  800fae:	75 0f                	jne    800fbf <strcmp+0x1a>
+  800fb0:	48 83 c7 01          	add    $0x1,%rdi
+  800fb4:	48 83 c6 01          	add    $0x1,%rsi
+  800fb8:	0f b6 07             	movzbl (%rdi),%eax
+  800fbb:	84 c0                	test   %al,%al
+  800fbd:	75 ed                	jne    800fac <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fbf:	0f b6 c0             	movzbl %al,%eax
+  800fc2:	0f b6 16             	movzbl (%rsi),%edx
+  800fc5:	29 d0                	sub    %edx,%eax
+}
+  800fc7:	c3                   	ret
+
+0000000000800fc8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fc8:	48 85 d2             	test   %rdx,%rdx
+  800fcb:	74 1f                	je     800fec <strncmp+0x24>
+  800fcd:	0f b6 07             	movzbl (%rdi),%eax
+  800fd0:	84 c0                	test   %al,%al
+  800fd2:	74 1e                	je     800ff2 <strncmp+0x2a>
+  800fd4:	3a 06                	cmp    (%rsi),%al
+  800fd6:	75 1a                	jne    800ff2 <strncmp+0x2a>
+  800fd8:	48 83 c7 01          	add    $0x1,%rdi
+  800fdc:	48 83 c6 01          	add    $0x1,%rsi
+  800fe0:	48 83 ea 01          	sub    $0x1,%rdx
+  800fe4:	75 e7                	jne    800fcd <strncmp+0x5>
+
+    if (!n) return 0;
+  800fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800feb:	c3                   	ret
+  800fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff1:	c3                   	ret
+  800ff2:	48 85 d2             	test   %rdx,%rdx
+  800ff5:	74 09                	je     801000 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ff7:	0f b6 07             	movzbl (%rdi),%eax
+  800ffa:	0f b6 16             	movzbl (%rsi),%edx
+  800ffd:	29 d0                	sub    %edx,%eax
+  800fff:	c3                   	ret
+    if (!n) return 0;
+  801000:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801005:	c3                   	ret
+
+0000000000801006 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801006:	0f b6 17             	movzbl (%rdi),%edx
+  801009:	84 d2                	test   %dl,%dl
+  80100b:	74 18                	je     801025 <strchr+0x1f>
+        if (*str == c) {
+  80100d:	0f be d2             	movsbl %dl,%edx
+  801010:	39 f2                	cmp    %esi,%edx
+  801012:	74 17                	je     80102b <strchr+0x25>
+    for (; *str; str++) {
+  801014:	48 83 c7 01          	add    $0x1,%rdi
+  801018:	0f b6 17             	movzbl (%rdi),%edx
+  80101b:	84 d2                	test   %dl,%dl
+  80101d:	75 ee                	jne    80100d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80101f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801024:	c3                   	ret
+  801025:	b8 00 00 00 00       	mov    $0x0,%eax
+  80102a:	c3                   	ret
+  80102b:	48 89 f8             	mov    %rdi,%rax
+}
+  80102e:	c3                   	ret
+
+000000000080102f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80102f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801032:	0f b6 17             	movzbl (%rdi),%edx
+  801035:	84 d2                	test   %dl,%dl
+  801037:	74 13                	je     80104c <strfind+0x1d>
+  801039:	0f be d2             	movsbl %dl,%edx
+  80103c:	39 f2                	cmp    %esi,%edx
+  80103e:	74 0b                	je     80104b <strfind+0x1c>
+  801040:	48 83 c0 01          	add    $0x1,%rax
+  801044:	0f b6 10             	movzbl (%rax),%edx
+  801047:	84 d2                	test   %dl,%dl
+  801049:	75 ee                	jne    801039 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80104b:	c3                   	ret
+  80104c:	c3                   	ret
+
+000000000080104d <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  80104d:	55                   	push   %rbp
+  80104e:	48 89 e5             	mov    %rsp,%rbp
+  801051:	41 57                	push   %r15
+  801053:	41 56                	push   %r14
+  801055:	41 55                	push   %r13
+  801057:	41 54                	push   %r12
+  801059:	53                   	push   %rbx
+  80105a:	48 83 ec 08          	sub    $0x8,%rsp
+  80105e:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  801061:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  801065:	45 84 ed             	test   %r13b,%r13b
+  801068:	75 12                	jne    80107c <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  80106a:	4c 89 f8             	mov    %r15,%rax
+  80106d:	48 83 c4 08          	add    $0x8,%rsp
+  801071:	5b                   	pop    %rbx
+  801072:	41 5c                	pop    %r12
+  801074:	41 5d                	pop    %r13
+  801076:	41 5e                	pop    %r14
+  801078:	41 5f                	pop    %r15
+  80107a:	5d                   	pop    %rbp
+  80107b:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  80107c:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  801080:	4c 89 e7             	mov    %r12,%rdi
+  801083:	48 b8 c3 0e 80 00 00 	movabs $0x800ec3,%rax
+  80108a:	00 00 00 
+  80108d:	ff d0                	call   *%rax
+  80108f:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  801092:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  801096:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  80109a:	49 bf c8 0f 80 00 00 	movabs $0x800fc8,%r15
+  8010a1:	00 00 00 
+				if ((sc = *s++) == 0)
+  8010a4:	84 c0                	test   %al,%al
+  8010a6:	75 14                	jne    8010bc <strstr+0x6f>
+					return NULL;
+  8010a8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8010ae:	eb ba                	jmp    80106a <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  8010b0:	48 83 c3 01          	add    $0x1,%rbx
+  8010b4:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010b8:	84 c0                	test   %al,%al
+  8010ba:	74 1b                	je     8010d7 <strstr+0x8a>
+			} while (sc != c);
+  8010bc:	41 38 c5             	cmp    %al,%r13b
+  8010bf:	75 ef                	jne    8010b0 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  8010c1:	4c 89 f2             	mov    %r14,%rdx
+  8010c4:	4c 89 e6             	mov    %r12,%rsi
+  8010c7:	48 89 df             	mov    %rbx,%rdi
+  8010ca:	41 ff d7             	call   *%r15
+  8010cd:	85 c0                	test   %eax,%eax
+  8010cf:	75 df                	jne    8010b0 <strstr+0x63>
+  8010d1:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  8010d5:	eb 93                	jmp    80106a <strstr+0x1d>
+					return NULL;
+  8010d7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8010dd:	eb 8b                	jmp    80106a <strstr+0x1d>
+
+00000000008010df <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  8010df:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  8010e1:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  8010e4:	8d 57 20             	lea    0x20(%rdi),%edx
+  8010e7:	83 f9 1a             	cmp    $0x1a,%ecx
+  8010ea:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8010ed:	c3                   	ret
+
+00000000008010ee <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  8010ee:	55                   	push   %rbp
+  8010ef:	48 89 e5             	mov    %rsp,%rbp
+  8010f2:	41 57                	push   %r15
+  8010f4:	41 56                	push   %r14
+  8010f6:	41 55                	push   %r13
+  8010f8:	41 54                	push   %r12
+  8010fa:	53                   	push   %rbx
+  8010fb:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  8010ff:	48 39 f7             	cmp    %rsi,%rdi
+  801102:	74 49                	je     80114d <strcasecmp+0x5f>
+  801104:	49 89 fd             	mov    %rdi,%r13
+  801107:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  80110a:	49 bf df 10 80 00 00 	movabs $0x8010df,%r15
+  801111:	00 00 00 
+  801114:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801119:	41 0f b6 fe          	movzbl %r14b,%edi
+  80111d:	41 ff d7             	call   *%r15
+  801120:	89 c3                	mov    %eax,%ebx
+  801122:	49 83 c4 01          	add    $0x1,%r12
+  801126:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  80112c:	41 ff d7             	call   *%r15
+  80112f:	29 c3                	sub    %eax,%ebx
+  801131:	75 09                	jne    80113c <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  801133:	49 83 c5 01          	add    $0x1,%r13
+  801137:	45 84 f6             	test   %r14b,%r14b
+  80113a:	75 d8                	jne    801114 <strcasecmp+0x26>
+}
+  80113c:	89 d8                	mov    %ebx,%eax
+  80113e:	48 83 c4 08          	add    $0x8,%rsp
+  801142:	5b                   	pop    %rbx
+  801143:	41 5c                	pop    %r12
+  801145:	41 5d                	pop    %r13
+  801147:	41 5e                	pop    %r14
+  801149:	41 5f                	pop    %r15
+  80114b:	5d                   	pop    %rbp
+  80114c:	c3                   	ret
+        return 0;
+  80114d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801152:	eb e8                	jmp    80113c <strcasecmp+0x4e>
+
+0000000000801154 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  801154:	55                   	push   %rbp
+  801155:	48 89 e5             	mov    %rsp,%rbp
+  801158:	41 57                	push   %r15
+  80115a:	41 56                	push   %r14
+  80115c:	41 55                	push   %r13
+  80115e:	41 54                	push   %r12
+  801160:	53                   	push   %rbx
+  801161:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  801165:	48 85 d2             	test   %rdx,%rdx
+  801168:	74 4f                	je     8011b9 <strncasecmp+0x65>
+  80116a:	49 89 fc             	mov    %rdi,%r12
+  80116d:	49 89 f5             	mov    %rsi,%r13
+  801170:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  801174:	49 be df 10 80 00 00 	movabs $0x8010df,%r14
+  80117b:	00 00 00 
+  80117e:	49 83 c4 01          	add    $0x1,%r12
+  801182:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801188:	41 ff d6             	call   *%r14
+  80118b:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  80118d:	49 83 c5 01          	add    $0x1,%r13
+  801191:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801196:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801199:	29 c3                	sub    %eax,%ebx
+  80119b:	85 c0                	test   %eax,%eax
+  80119d:	74 09                	je     8011a8 <strncasecmp+0x54>
+  80119f:	85 db                	test   %ebx,%ebx
+  8011a1:	75 05                	jne    8011a8 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8011a3:	4d 39 fc             	cmp    %r15,%r12
+  8011a6:	75 d6                	jne    80117e <strncasecmp+0x2a>
+}
+  8011a8:	89 d8                	mov    %ebx,%eax
+  8011aa:	48 83 c4 08          	add    $0x8,%rsp
+  8011ae:	5b                   	pop    %rbx
+  8011af:	41 5c                	pop    %r12
+  8011b1:	41 5d                	pop    %r13
+  8011b3:	41 5e                	pop    %r14
+  8011b5:	41 5f                	pop    %r15
+  8011b7:	5d                   	pop    %rbp
+  8011b8:	c3                   	ret
+    int d = 0;
+  8011b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  8011be:	eb e8                	jmp    8011a8 <strncasecmp+0x54>
+
+00000000008011c0 <toupper>:
+
+int toupper(int c) {
+  8011c0:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  8011c2:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  8011c5:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8011c8:	83 f9 1a             	cmp    $0x1a,%ecx
+  8011cb:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8011ce:	c3                   	ret
+
+00000000008011cf <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  8011cf:	83 ff 20             	cmp    $0x20,%edi
+  8011d2:	0f 94 c0             	sete   %al
+  8011d5:	0f b6 c0             	movzbl %al,%eax
+}
+  8011d8:	c3                   	ret
+
+00000000008011d9 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  8011d9:	89 f8                	mov    %edi,%eax
+  8011db:	f7 d8                	neg    %eax
+  8011dd:	0f 48 c7             	cmovs  %edi,%eax
+}
+  8011e0:	c3                   	ret
+
+00000000008011e1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8011e1:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8011e4:	48 89 f8             	mov    %rdi,%rax
+  8011e7:	48 f7 d8             	neg    %rax
+  8011ea:	83 e0 07             	and    $0x7,%eax
+  8011ed:	49 89 d1             	mov    %rdx,%r9
+  8011f0:	49 29 c1             	sub    %rax,%r9
+  8011f3:	78 36                	js     80122b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8011f5:	40 0f b6 c6          	movzbl %sil,%eax
+  8011f9:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801200:	01 01 01 
+  801203:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801207:	40 f6 c7 07          	test   $0x7,%dil
+  80120b:	75 38                	jne    801245 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80120d:	4c 89 c9             	mov    %r9,%rcx
+  801210:	48 c1 f9 03          	sar    $0x3,%rcx
+  801214:	74 0c                	je     801222 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801216:	fc                   	cld
+  801217:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80121a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80121e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801222:	4d 85 c9             	test   %r9,%r9
+  801225:	75 45                	jne    80126c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801227:	4c 89 c0             	mov    %r8,%rax
+  80122a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80122b:	48 85 d2             	test   %rdx,%rdx
+  80122e:	74 f7                	je     801227 <memset+0x46>
+  801230:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801233:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801236:	48 83 c0 01          	add    $0x1,%rax
+  80123a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80123e:	48 39 c2             	cmp    %rax,%rdx
+  801241:	75 f3                	jne    801236 <memset+0x55>
+  801243:	eb e2                	jmp    801227 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801245:	40 f6 c7 01          	test   $0x1,%dil
+  801249:	74 06                	je     801251 <memset+0x70>
+  80124b:	88 07                	mov    %al,(%rdi)
+  80124d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801251:	40 f6 c7 02          	test   $0x2,%dil
+  801255:	74 07                	je     80125e <memset+0x7d>
+  801257:	66 89 07             	mov    %ax,(%rdi)
+  80125a:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80125e:	40 f6 c7 04          	test   $0x4,%dil
+  801262:	74 a9                	je     80120d <memset+0x2c>
+  801264:	89 07                	mov    %eax,(%rdi)
+  801266:	48 83 c7 04          	add    $0x4,%rdi
+  80126a:	eb a1                	jmp    80120d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80126c:	41 f6 c1 04          	test   $0x4,%r9b
+  801270:	74 06                	je     801278 <memset+0x97>
+  801272:	89 07                	mov    %eax,(%rdi)
+  801274:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801278:	41 f6 c1 02          	test   $0x2,%r9b
+  80127c:	74 07                	je     801285 <memset+0xa4>
+  80127e:	66 89 07             	mov    %ax,(%rdi)
+  801281:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801285:	41 f6 c1 01          	test   $0x1,%r9b
+  801289:	74 9c                	je     801227 <memset+0x46>
+  80128b:	88 07                	mov    %al,(%rdi)
+  80128d:	eb 98                	jmp    801227 <memset+0x46>
+
+000000000080128f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80128f:	48 89 f8             	mov    %rdi,%rax
+  801292:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801295:	48 39 fe             	cmp    %rdi,%rsi
+  801298:	73 3b                	jae    8012d5 <memmove+0x46>
+  80129a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80129e:	48 39 d7             	cmp    %rdx,%rdi
+  8012a1:	73 32                	jae    8012d5 <memmove+0x46>
+        s += n;
+        d += n;
+  8012a3:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012a7:	48 89 d6             	mov    %rdx,%rsi
+  8012aa:	48 09 fe             	or     %rdi,%rsi
+  8012ad:	48 09 ce             	or     %rcx,%rsi
+  8012b0:	40 f6 c6 07          	test   $0x7,%sil
+  8012b4:	75 12                	jne    8012c8 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8012b6:	48 83 ef 08          	sub    $0x8,%rdi
+  8012ba:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8012be:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012c2:	fd                   	std
+  8012c3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012c6:	fc                   	cld
+  8012c7:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012c8:	48 83 ef 01          	sub    $0x1,%rdi
+  8012cc:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8012d0:	fd                   	std
+  8012d1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8012d3:	eb f1                	jmp    8012c6 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012d5:	48 89 f2             	mov    %rsi,%rdx
+  8012d8:	48 09 c2             	or     %rax,%rdx
+  8012db:	48 09 ca             	or     %rcx,%rdx
+  8012de:	f6 c2 07             	test   $0x7,%dl
+  8012e1:	75 0c                	jne    8012ef <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8012e3:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012e7:	48 89 c7             	mov    %rax,%rdi
+  8012ea:	fc                   	cld
+  8012eb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8012ee:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8012ef:	48 89 c7             	mov    %rax,%rdi
+  8012f2:	fc                   	cld
+  8012f3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8012f5:	c3                   	ret
+
+00000000008012f6 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8012f6:	55                   	push   %rbp
+  8012f7:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8012fa:	48 b8 8f 12 80 00 00 	movabs $0x80128f,%rax
+  801301:	00 00 00 
+  801304:	ff d0                	call   *%rax
+}
+  801306:	5d                   	pop    %rbp
+  801307:	c3                   	ret
+
+0000000000801308 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	41 57                	push   %r15
+  80130e:	41 56                	push   %r14
+  801310:	41 55                	push   %r13
+  801312:	41 54                	push   %r12
+  801314:	53                   	push   %rbx
+  801315:	48 83 ec 08          	sub    $0x8,%rsp
+  801319:	49 89 fe             	mov    %rdi,%r14
+  80131c:	49 89 f7             	mov    %rsi,%r15
+  80131f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801322:	48 89 f7             	mov    %rsi,%rdi
+  801325:	48 b8 c3 0e 80 00 00 	movabs $0x800ec3,%rax
+  80132c:	00 00 00 
+  80132f:	ff d0                	call   *%rax
+  801331:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801334:	48 89 de             	mov    %rbx,%rsi
+  801337:	4c 89 f7             	mov    %r14,%rdi
+  80133a:	48 b8 de 0e 80 00 00 	movabs $0x800ede,%rax
+  801341:	00 00 00 
+  801344:	ff d0                	call   *%rax
+  801346:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801349:	48 39 c3             	cmp    %rax,%rbx
+  80134c:	74 36                	je     801384 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80134e:	48 89 d8             	mov    %rbx,%rax
+  801351:	4c 29 e8             	sub    %r13,%rax
+  801354:	49 39 c4             	cmp    %rax,%r12
+  801357:	73 31                	jae    80138a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801359:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80135e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801362:	4c 89 fe             	mov    %r15,%rsi
+  801365:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  80136c:	00 00 00 
+  80136f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801371:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801375:	48 83 c4 08          	add    $0x8,%rsp
+  801379:	5b                   	pop    %rbx
+  80137a:	41 5c                	pop    %r12
+  80137c:	41 5d                	pop    %r13
+  80137e:	41 5e                	pop    %r14
+  801380:	41 5f                	pop    %r15
+  801382:	5d                   	pop    %rbp
+  801383:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801384:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801388:	eb eb                	jmp    801375 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80138a:	48 83 eb 01          	sub    $0x1,%rbx
+  80138e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801392:	48 89 da             	mov    %rbx,%rdx
+  801395:	4c 89 fe             	mov    %r15,%rsi
+  801398:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  80139f:	00 00 00 
+  8013a2:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8013a4:	49 01 de             	add    %rbx,%r14
+  8013a7:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8013ac:	eb c3                	jmp    801371 <strlcat+0x69>
+
+00000000008013ae <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8013ae:	48 85 d2             	test   %rdx,%rdx
+  8013b1:	74 2d                	je     8013e0 <memcmp+0x32>
+  8013b3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8013b8:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8013bc:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013c1:	44 38 c1             	cmp    %r8b,%cl
+  8013c4:	75 0f                	jne    8013d5 <memcmp+0x27>
+    while (n-- > 0) {
+  8013c6:	48 83 c0 01          	add    $0x1,%rax
+  8013ca:	48 39 c2             	cmp    %rax,%rdx
+  8013cd:	75 e9                	jne    8013b8 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8013cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d4:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8013d5:	0f b6 c1             	movzbl %cl,%eax
+  8013d8:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8013dc:	44 29 c0             	sub    %r8d,%eax
+  8013df:	c3                   	ret
+    return 0;
+  8013e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e5:	c3                   	ret
+
+00000000008013e6 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8013e6:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8013ea:	48 39 c7             	cmp    %rax,%rdi
+  8013ed:	73 0f                	jae    8013fe <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8013ef:	40 38 37             	cmp    %sil,(%rdi)
+  8013f2:	74 0e                	je     801402 <memfind+0x1c>
+    for (; src < end; src++) {
+  8013f4:	48 83 c7 01          	add    $0x1,%rdi
+  8013f8:	48 39 f8             	cmp    %rdi,%rax
+  8013fb:	75 f2                	jne    8013ef <memfind+0x9>
+  8013fd:	c3                   	ret
+  8013fe:	48 89 f8             	mov    %rdi,%rax
+  801401:	c3                   	ret
+  801402:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801405:	c3                   	ret
+
+0000000000801406 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801406:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801409:	0f b6 37             	movzbl (%rdi),%esi
+  80140c:	40 80 fe 20          	cmp    $0x20,%sil
+  801410:	74 06                	je     801418 <strtol+0x12>
+  801412:	40 80 fe 09          	cmp    $0x9,%sil
+  801416:	75 13                	jne    80142b <strtol+0x25>
+  801418:	48 83 c7 01          	add    $0x1,%rdi
+  80141c:	0f b6 37             	movzbl (%rdi),%esi
+  80141f:	40 80 fe 20          	cmp    $0x20,%sil
+  801423:	74 f3                	je     801418 <strtol+0x12>
+  801425:	40 80 fe 09          	cmp    $0x9,%sil
+  801429:	74 ed                	je     801418 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80142b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80142e:	83 e0 fd             	and    $0xfffffffd,%eax
+  801431:	3c 01                	cmp    $0x1,%al
+  801433:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801437:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80143d:	75 0f                	jne    80144e <strtol+0x48>
+  80143f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801442:	74 14                	je     801458 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801444:	85 d2                	test   %edx,%edx
+  801446:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80144b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80144e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801453:	4c 63 ca             	movslq %edx,%r9
+  801456:	eb 36                	jmp    80148e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801458:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80145c:	74 0f                	je     80146d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80145e:	85 d2                	test   %edx,%edx
+  801460:	75 ec                	jne    80144e <strtol+0x48>
+        s++;
+  801462:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801466:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80146b:	eb e1                	jmp    80144e <strtol+0x48>
+        s += 2;
+  80146d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801471:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801476:	eb d6                	jmp    80144e <strtol+0x48>
+            dig -= '0';
+  801478:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80147b:	44 0f b6 c1          	movzbl %cl,%r8d
+  80147f:	41 39 d0             	cmp    %edx,%r8d
+  801482:	7d 21                	jge    8014a5 <strtol+0x9f>
+        val = val * base + dig;
+  801484:	49 0f af c1          	imul   %r9,%rax
+  801488:	0f b6 c9             	movzbl %cl,%ecx
+  80148b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80148e:	48 83 c7 01          	add    $0x1,%rdi
+  801492:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801496:	80 f9 39             	cmp    $0x39,%cl
+  801499:	76 dd                	jbe    801478 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80149b:	80 f9 7b             	cmp    $0x7b,%cl
+  80149e:	77 05                	ja     8014a5 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8014a0:	83 e9 57             	sub    $0x57,%ecx
+  8014a3:	eb d6                	jmp    80147b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8014a5:	4d 85 d2             	test   %r10,%r10
+  8014a8:	74 03                	je     8014ad <strtol+0xa7>
+  8014aa:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8014ad:	48 89 c2             	mov    %rax,%rdx
+  8014b0:	48 f7 da             	neg    %rdx
+  8014b3:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8014b7:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8014bb:	c3                   	ret
+
+00000000008014bc <atoi>:
+int atoi(const char *str) {
+  8014bc:	55                   	push   %rbp
+  8014bd:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8014c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ca:	48 b8 06 14 80 00 00 	movabs $0x801406,%rax
+  8014d1:	00 00 00 
+  8014d4:	ff d0                	call   *%rax
+}
+  8014d6:	5d                   	pop    %rbp
+  8014d7:	c3                   	ret
+
+00000000008014d8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8014d8:	55                   	push   %rbp
+  8014d9:	48 89 e5             	mov    %rsp,%rbp
+  8014dc:	53                   	push   %rbx
+  8014dd:	48 89 fa             	mov    %rdi,%rdx
+  8014e0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e3:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014fd:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8014ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801503:	c9                   	leave
+  801504:	c3                   	ret
+
+0000000000801505 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801505:	55                   	push   %rbp
+  801506:	48 89 e5             	mov    %rsp,%rbp
+  801509:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80150a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80150f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801514:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801519:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801523:	be 00 00 00 00       	mov    $0x0,%esi
+  801528:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801530:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801534:	c9                   	leave
+  801535:	c3                   	ret
+
+0000000000801536 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801536:	55                   	push   %rbp
+  801537:	48 89 e5             	mov    %rsp,%rbp
+  80153a:	53                   	push   %rbx
+  80153b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80153f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801542:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801547:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80154c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801551:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801556:	be 00 00 00 00       	mov    $0x0,%esi
+  80155b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801561:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801563:	48 85 c0             	test   %rax,%rax
+  801566:	7f 06                	jg     80156e <sys_env_destroy+0x38>
+}
+  801568:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156c:	c9                   	leave
+  80156d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80156e:	49 89 c0             	mov    %rax,%r8
+  801571:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801576:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  80157d:	00 00 00 
+  801580:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801585:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  80158c:	00 00 00 
+  80158f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801594:	49 b9 7a 44 80 00 00 	movabs $0x80447a,%r9
+  80159b:	00 00 00 
+  80159e:	41 ff d1             	call   *%r9
+
+00000000008015a1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8015a1:	55                   	push   %rbp
+  8015a2:	48 89 e5             	mov    %rsp,%rbp
+  8015a5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ca:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d0:	c9                   	leave
+  8015d1:	c3                   	ret
+
+00000000008015d2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8015d2:	55                   	push   %rbp
+  8015d3:	48 89 e5             	mov    %rsp,%rbp
+  8015d6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d7:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fb:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801601:	c9                   	leave
+  801602:	c3                   	ret
+
+0000000000801603 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801603:	55                   	push   %rbp
+  801604:	48 89 e5             	mov    %rsp,%rbp
+  801607:	53                   	push   %rbx
+  801608:	48 89 fa             	mov    %rdi,%rdx
+  80160b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80160e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801613:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80161a:	00 00 00 
+  80161d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801622:	be 00 00 00 00       	mov    $0x0,%esi
+  801627:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80162f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801633:	c9                   	leave
+  801634:	c3                   	ret
+
+0000000000801635 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801635:	55                   	push   %rbp
+  801636:	48 89 e5             	mov    %rsp,%rbp
+  801639:	53                   	push   %rbx
+  80163a:	49 89 f8             	mov    %rdi,%r8
+  80163d:	48 89 d3             	mov    %rdx,%rbx
+  801640:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801643:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801648:	4c 89 c2             	mov    %r8,%rdx
+  80164b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80164e:	be 00 00 00 00       	mov    $0x0,%esi
+  801653:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801659:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80165b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80165f:	c9                   	leave
+  801660:	c3                   	ret
+
+0000000000801661 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801661:	55                   	push   %rbp
+  801662:	48 89 e5             	mov    %rsp,%rbp
+  801665:	53                   	push   %rbx
+  801666:	48 83 ec 08          	sub    $0x8,%rsp
+  80166a:	89 f8                	mov    %edi,%eax
+  80166c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80166f:	48 63 f9             	movslq %ecx,%rdi
+  801672:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801675:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80167a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167d:	be 00 00 00 00       	mov    $0x0,%esi
+  801682:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801688:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80168a:	48 85 c0             	test   %rax,%rax
+  80168d:	7f 06                	jg     801695 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80168f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801693:	c9                   	leave
+  801694:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801695:	49 89 c0             	mov    %rax,%r8
+  801698:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80169d:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  8016a4:	00 00 00 
+  8016a7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016ac:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  8016b3:	00 00 00 
+  8016b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bb:	49 b9 7a 44 80 00 00 	movabs $0x80447a,%r9
+  8016c2:	00 00 00 
+  8016c5:	41 ff d1             	call   *%r9
+
+00000000008016c8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016c8:	55                   	push   %rbp
+  8016c9:	48 89 e5             	mov    %rsp,%rbp
+  8016cc:	53                   	push   %rbx
+  8016cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d1:	89 f8                	mov    %edi,%eax
+  8016d3:	49 89 f2             	mov    %rsi,%r10
+  8016d6:	48 89 cf             	mov    %rcx,%rdi
+  8016d9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8016dc:	48 63 da             	movslq %edx,%rbx
+  8016df:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e2:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016e7:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ea:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8016ed:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ef:	48 85 c0             	test   %rax,%rax
+  8016f2:	7f 06                	jg     8016fa <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f8:	c9                   	leave
+  8016f9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016fa:	49 89 c0             	mov    %rax,%r8
+  8016fd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801702:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  801709:	00 00 00 
+  80170c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801711:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  801718:	00 00 00 
+  80171b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801720:	49 b9 7a 44 80 00 00 	movabs $0x80447a,%r9
+  801727:	00 00 00 
+  80172a:	41 ff d1             	call   *%r9
+
+000000000080172d <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80172d:	55                   	push   %rbp
+  80172e:	48 89 e5             	mov    %rsp,%rbp
+  801731:	53                   	push   %rbx
+  801732:	48 83 ec 08          	sub    $0x8,%rsp
+  801736:	49 89 f9             	mov    %rdi,%r9
+  801739:	89 f0                	mov    %esi,%eax
+  80173b:	48 89 d3             	mov    %rdx,%rbx
+  80173e:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801741:	49 63 f0             	movslq %r8d,%rsi
+  801744:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801747:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80174c:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801755:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801757:	48 85 c0             	test   %rax,%rax
+  80175a:	7f 06                	jg     801762 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80175c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801760:	c9                   	leave
+  801761:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801762:	49 89 c0             	mov    %rax,%r8
+  801765:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80176a:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  801771:	00 00 00 
+  801774:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801779:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  801780:	00 00 00 
+  801783:	b8 00 00 00 00       	mov    $0x0,%eax
+  801788:	49 b9 7a 44 80 00 00 	movabs $0x80447a,%r9
+  80178f:	00 00 00 
+  801792:	41 ff d1             	call   *%r9
+
+0000000000801795 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801795:	55                   	push   %rbp
+  801796:	48 89 e5             	mov    %rsp,%rbp
+  801799:	53                   	push   %rbx
+  80179a:	89 f8                	mov    %edi,%eax
+  80179c:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80179f:	48 63 f9             	movslq %ecx,%rdi
+  8017a2:	48 63 da             	movslq %edx,%rbx
+  8017a5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017ad:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017bb:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8017bd:	89 c2                	mov    %eax,%edx
+  8017bf:	48 85 c0             	test   %rax,%rax
+  8017c2:	78 0d                	js     8017d1 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8017c4:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8017c9:	4d 85 c9             	test   %r9,%r9
+  8017cc:	74 03                	je     8017d1 <sys_alloc_dma_region+0x3c>
+  8017ce:	49 89 01             	mov    %rax,(%r9)
+}
+  8017d1:	89 d0                	mov    %edx,%eax
+  8017d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d7:	c9                   	leave
+  8017d8:	c3                   	ret
+
+00000000008017d9 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8017d9:	55                   	push   %rbp
+  8017da:	48 89 e5             	mov    %rsp,%rbp
+  8017dd:	53                   	push   %rbx
+  8017de:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e2:	48 89 f1             	mov    %rsi,%rcx
+  8017e5:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017e8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017eb:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801800:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801802:	48 85 c0             	test   %rax,%rax
+  801805:	7f 06                	jg     80180d <sys_set_cache_region+0x34>
+}
+  801807:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80180b:	c9                   	leave
+  80180c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80180d:	49 89 c0             	mov    %rax,%r8
+  801810:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801815:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  80181c:	00 00 00 
+  80181f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801824:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  80182b:	00 00 00 
+  80182e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801833:	49 b9 7a 44 80 00 00 	movabs $0x80447a,%r9
+  80183a:	00 00 00 
+  80183d:	41 ff d1             	call   *%r9
+
+0000000000801840 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801840:	55                   	push   %rbp
+  801841:	48 89 e5             	mov    %rsp,%rbp
+  801844:	53                   	push   %rbx
+  801845:	48 83 ec 08          	sub    $0x8,%rsp
+  801849:	48 89 f1             	mov    %rsi,%rcx
+  80184c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80184f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801852:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801857:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80185c:	be 00 00 00 00       	mov    $0x0,%esi
+  801861:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801867:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801869:	48 85 c0             	test   %rax,%rax
+  80186c:	7f 06                	jg     801874 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80186e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801872:	c9                   	leave
+  801873:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801874:	49 89 c0             	mov    %rax,%r8
+  801877:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80187c:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  801883:	00 00 00 
+  801886:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80188b:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  801892:	00 00 00 
+  801895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189a:	49 b9 7a 44 80 00 00 	movabs $0x80447a,%r9
+  8018a1:	00 00 00 
+  8018a4:	41 ff d1             	call   *%r9
+
+00000000008018a7 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8018a7:	55                   	push   %rbp
+  8018a8:	48 89 e5             	mov    %rsp,%rbp
+  8018ab:	53                   	push   %rbx
+  8018ac:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8018b0:	48 63 ce             	movslq %esi,%rcx
+  8018b3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b6:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018d2:	48 85 c0             	test   %rax,%rax
+  8018d5:	7f 06                	jg     8018dd <sys_env_set_status+0x36>
+}
+  8018d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018db:	c9                   	leave
+  8018dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018dd:	49 89 c0             	mov    %rax,%r8
+  8018e0:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8018e5:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  8018ec:	00 00 00 
+  8018ef:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018f4:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  8018fb:	00 00 00 
+  8018fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801903:	49 b9 7a 44 80 00 00 	movabs $0x80447a,%r9
+  80190a:	00 00 00 
+  80190d:	41 ff d1             	call   *%r9
+
+0000000000801910 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801910:	55                   	push   %rbp
+  801911:	48 89 e5             	mov    %rsp,%rbp
+  801914:	53                   	push   %rbx
+  801915:	48 83 ec 08          	sub    $0x8,%rsp
+  801919:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80191c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80191f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801924:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801929:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80192e:	be 00 00 00 00       	mov    $0x0,%esi
+  801933:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801939:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80193b:	48 85 c0             	test   %rax,%rax
+  80193e:	7f 06                	jg     801946 <sys_env_set_trapframe+0x36>
+}
+  801940:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801944:	c9                   	leave
+  801945:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801946:	49 89 c0             	mov    %rax,%r8
+  801949:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80194e:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  801955:	00 00 00 
+  801958:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80195d:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  801964:	00 00 00 
+  801967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196c:	49 b9 7a 44 80 00 00 	movabs $0x80447a,%r9
+  801973:	00 00 00 
+  801976:	41 ff d1             	call   *%r9
+
+0000000000801979 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801979:	55                   	push   %rbp
+  80197a:	48 89 e5             	mov    %rsp,%rbp
+  80197d:	53                   	push   %rbx
+  80197e:	48 83 ec 08          	sub    $0x8,%rsp
+  801982:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801985:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801988:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80198d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801992:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801997:	be 00 00 00 00       	mov    $0x0,%esi
+  80199c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019a4:	48 85 c0             	test   %rax,%rax
+  8019a7:	7f 06                	jg     8019af <sys_env_set_pgfault_upcall+0x36>
+}
+  8019a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ad:	c9                   	leave
+  8019ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019af:	49 89 c0             	mov    %rax,%r8
+  8019b2:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8019b7:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  8019be:	00 00 00 
+  8019c1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019c6:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  8019cd:	00 00 00 
+  8019d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d5:	49 b9 7a 44 80 00 00 	movabs $0x80447a,%r9
+  8019dc:	00 00 00 
+  8019df:	41 ff d1             	call   *%r9
+
+00000000008019e2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019e2:	55                   	push   %rbp
+  8019e3:	48 89 e5             	mov    %rsp,%rbp
+  8019e6:	53                   	push   %rbx
+  8019e7:	89 f8                	mov    %edi,%eax
+  8019e9:	49 89 f1             	mov    %rsi,%r9
+  8019ec:	48 89 d3             	mov    %rdx,%rbx
+  8019ef:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019f2:	49 63 f0             	movslq %r8d,%rsi
+  8019f5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019f8:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019fd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a06:	cd 30                	int    $0x30
+}
+  801a08:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a0c:	c9                   	leave
+  801a0d:	c3                   	ret
+
+0000000000801a0e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801a0e:	55                   	push   %rbp
+  801a0f:	48 89 e5             	mov    %rsp,%rbp
+  801a12:	53                   	push   %rbx
+  801a13:	48 83 ec 08          	sub    $0x8,%rsp
+  801a17:	48 89 fa             	mov    %rdi,%rdx
+  801a1a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a1d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a37:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a39:	48 85 c0             	test   %rax,%rax
+  801a3c:	7f 06                	jg     801a44 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a42:	c9                   	leave
+  801a43:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a44:	49 89 c0             	mov    %rax,%r8
+  801a47:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801a4c:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  801a53:	00 00 00 
+  801a56:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a5b:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  801a62:	00 00 00 
+  801a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6a:	49 b9 7a 44 80 00 00 	movabs $0x80447a,%r9
+  801a71:	00 00 00 
+  801a74:	41 ff d1             	call   *%r9
+
+0000000000801a77 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801a77:	55                   	push   %rbp
+  801a78:	48 89 e5             	mov    %rsp,%rbp
+  801a7b:	53                   	push   %rbx
+  801a7c:	48 89 fa             	mov    %rdi,%rdx
+  801a7f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a82:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a8c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a91:	be 00 00 00 00       	mov    $0x0,%esi
+  801a96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a9c:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a9e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa2:	c9                   	leave
+  801aa3:	c3                   	ret
+
+0000000000801aa4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801aa4:	55                   	push   %rbp
+  801aa5:	48 89 e5             	mov    %rsp,%rbp
+  801aa8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801aa9:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801aae:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ab8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801abd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ac2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801acd:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801acf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad3:	c9                   	leave
+  801ad4:	c3                   	ret
+
+0000000000801ad5 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801ad5:	48 85 ff             	test   %rdi,%rdi
+  801ad8:	0f 84 b6 01 00 00    	je     801c94 <malloc+0x1bf>
+malloc(size_t size) {
+  801ade:	55                   	push   %rbp
+  801adf:	48 89 e5             	mov    %rsp,%rbp
+  801ae2:	41 56                	push   %r14
+  801ae4:	41 55                	push   %r13
+  801ae6:	41 54                	push   %r12
+  801ae8:	53                   	push   %rbx
+  801ae9:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801aec:	48 b8 88 76 80 00 00 	movabs $0x807688,%rax
+  801af3:	00 00 00 
+  801af6:	4c 8b 20             	mov    (%rax),%r12
+  801af9:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801b00:	0f 87 94 01 00 00    	ja     801c9a <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801b06:	48 a1 80 76 80 00 00 	movabs 0x807680,%rax
+  801b0d:	00 00 00 
+  801b10:	48 85 c0             	test   %rax,%rax
+  801b13:	74 6b                	je     801b80 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801b15:	4d 85 e4             	test   %r12,%r12
+  801b18:	74 66                	je     801b80 <malloc+0xab>
+  801b1a:	48 ba a8 76 80 00 00 	movabs $0x8076a8,%rdx
+  801b21:	00 00 00 
+  801b24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b29:	eb 0d                	jmp    801b38 <malloc+0x63>
+  801b2b:	48 83 c1 01          	add    $0x1,%rcx
+  801b2f:	48 83 c2 18          	add    $0x18,%rdx
+  801b33:	49 39 cc             	cmp    %rcx,%r12
+  801b36:	74 48                	je     801b80 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801b38:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801b3d:	74 ec                	je     801b2b <malloc+0x56>
+  801b3f:	48 39 1a             	cmp    %rbx,(%rdx)
+  801b42:	72 e7                	jb     801b2b <malloc+0x56>
+                real_freep_size--;
+  801b44:	48 83 e8 01          	sub    $0x1,%rax
+  801b48:	48 a3 80 76 80 00 00 	movabs %rax,0x807680
+  801b4f:	00 00 00 
+                freep[i].is_free = false;
+  801b52:	48 ba a0 76 80 00 00 	movabs $0x8076a0,%rdx
+  801b59:	00 00 00 
+  801b5c:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801b60:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801b64:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801b68:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801b6f:	00 
+                freep[i].size = size;
+  801b70:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801b74:	48 01 c8             	add    %rcx,%rax
+  801b77:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b7b:	e9 0b 01 00 00       	jmp    801c8b <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801b80:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801b87:	00 00 00 
+  801b8a:	48 01 d8             	add    %rbx,%rax
+  801b8d:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801b93:	76 7c                	jbe    801c11 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801b95:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801b9c:	00 00 00 
+  801b9f:	4c 8b 30             	mov    (%rax),%r14
+  801ba2:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801ba9:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801bac:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801bb3:	00 00 00 
+  801bb6:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801bbd:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801bc4:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801bca:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801bce:	48 b8 a1 15 80 00 00 	movabs $0x8015a1,%rax
+  801bd5:	00 00 00 
+  801bd8:	ff d0                	call   *%rax
+  801bda:	89 c7                	mov    %eax,%edi
+  801bdc:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801be3:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801bea:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801bf1:	00 00 00 
+  801bf4:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801bf8:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801bfd:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  801c04:	00 00 00 
+  801c07:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801c09:	85 c0                	test   %eax,%eax
+  801c0b:	0f 88 90 00 00 00    	js     801ca1 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801c11:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801c18:	00 00 00 
+  801c1b:	48 8b 31             	mov    (%rcx),%rsi
+  801c1e:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801c25:	00 00 00 
+  801c28:	4c 8b 07             	mov    (%rdi),%r8
+  801c2b:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801c2f:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801c36:	00 00 00 
+  801c39:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801c3d:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801c41:	48 b8 a0 76 80 00 00 	movabs $0x8076a0,%rax
+  801c48:	00 00 00 
+  801c4b:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801c4f:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801c52:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801c56:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801c5d:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801c5e:	48 89 d8             	mov    %rbx,%rax
+  801c61:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c66:	4c 01 c0             	add    %r8,%rax
+  801c69:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801c6c:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801c73:	48 01 f3             	add    %rsi,%rbx
+  801c76:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801c79:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801c7e:	48 a3 88 76 80 00 00 	movabs %rax,0x807688
+  801c85:	00 00 00 
+  801c88:	48 89 d0             	mov    %rdx,%rax
+}
+  801c8b:	5b                   	pop    %rbx
+  801c8c:	41 5c                	pop    %r12
+  801c8e:	41 5d                	pop    %r13
+  801c90:	41 5e                	pop    %r14
+  801c92:	5d                   	pop    %rbp
+  801c93:	c3                   	ret
+        return NULL;
+  801c94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c99:	c3                   	ret
+        return NULL;
+  801c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9f:	eb ea                	jmp    801c8b <malloc+0x1b6>
+            return NULL;
+  801ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca6:	eb e3                	jmp    801c8b <malloc+0x1b6>
+
+0000000000801ca8 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801ca8:	55                   	push   %rbp
+  801ca9:	48 89 e5             	mov    %rsp,%rbp
+  801cac:	53                   	push   %rbx
+  801cad:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801cb1:	48 89 fb             	mov    %rdi,%rbx
+  801cb4:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801cb8:	48 89 df             	mov    %rbx,%rdi
+  801cbb:	48 b8 d5 1a 80 00 00 	movabs $0x801ad5,%rax
+  801cc2:	00 00 00 
+  801cc5:	ff d0                	call   *%rax
+  801cc7:	48 89 c7             	mov    %rax,%rdi
+  801cca:	48 89 da             	mov    %rbx,%rdx
+  801ccd:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd2:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  801cd9:	00 00 00 
+  801cdc:	ff d0                	call   *%rax
+}
+  801cde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ce2:	c9                   	leave
+  801ce3:	c3                   	ret
+
+0000000000801ce4 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801ce4:	48 a1 88 76 80 00 00 	movabs 0x807688,%rax
+  801ceb:	00 00 00 
+  801cee:	48 ba 80 76 80 00 00 	movabs $0x807680,%rdx
+  801cf5:	00 00 00 
+  801cf8:	48 3b 02             	cmp    (%rdx),%rax
+  801cfb:	74 4d                	je     801d4a <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801cfd:	48 85 c0             	test   %rax,%rax
+  801d00:	74 4d                	je     801d4f <get_allocsize+0x6b>
+  801d02:	48 b9 a0 76 80 00 00 	movabs $0x8076a0,%rcx
+  801d09:	00 00 00 
+  801d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801d11:	48 3b 39             	cmp    (%rcx),%rdi
+  801d14:	74 13                	je     801d29 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801d16:	48 83 c2 01          	add    $0x1,%rdx
+  801d1a:	48 83 c1 18          	add    $0x18,%rcx
+  801d1e:	48 39 d0             	cmp    %rdx,%rax
+  801d21:	75 ee                	jne    801d11 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d28:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801d29:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d32:	48 be a0 76 80 00 00 	movabs $0x8076a0,%rsi
+  801d39:	00 00 00 
+  801d3c:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801d42:	75 0b                	jne    801d4f <get_allocsize+0x6b>
+  801d44:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801d49:	c3                   	ret
+        return 0;
+  801d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d4f:	c3                   	ret
+
+0000000000801d50 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801d50:	48 85 ff             	test   %rdi,%rdi
+  801d53:	0f 84 01 01 00 00    	je     801e5a <free+0x10a>
+free(void *ptr) {
+  801d59:	55                   	push   %rbp
+  801d5a:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801d5d:	48 b8 88 76 80 00 00 	movabs $0x807688,%rax
+  801d64:	00 00 00 
+  801d67:	48 8b 30             	mov    (%rax),%rsi
+  801d6a:	48 a1 80 76 80 00 00 	movabs 0x807680,%rax
+  801d71:	00 00 00 
+  801d74:	48 39 c6             	cmp    %rax,%rsi
+  801d77:	74 50                	je     801dc9 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801d79:	48 85 f6             	test   %rsi,%rsi
+  801d7c:	74 21                	je     801d9f <free+0x4f>
+  801d7e:	48 b9 a0 76 80 00 00 	movabs $0x8076a0,%rcx
+  801d85:	00 00 00 
+  801d88:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801d8d:	48 3b 39             	cmp    (%rcx),%rdi
+  801d90:	74 61                	je     801df3 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801d92:	48 83 c2 01          	add    $0x1,%rdx
+  801d96:	48 83 c1 18          	add    $0x18,%rcx
+  801d9a:	48 39 d6             	cmp    %rdx,%rsi
+  801d9d:	75 ee                	jne    801d8d <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801d9f:	48 ba 70 57 80 00 00 	movabs $0x805770,%rdx
+  801da6:	00 00 00 
+  801da9:	be 12 01 00 00       	mov    $0x112,%esi
+  801dae:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  801db5:	00 00 00 
+  801db8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dbd:	48 b9 7a 44 80 00 00 	movabs $0x80447a,%rcx
+  801dc4:	00 00 00 
+  801dc7:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801dc9:	48 ba 20 57 80 00 00 	movabs $0x805720,%rdx
+  801dd0:	00 00 00 
+  801dd3:	be 06 01 00 00       	mov    $0x106,%esi
+  801dd8:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  801ddf:	00 00 00 
+  801de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de7:	48 b9 7a 44 80 00 00 	movabs $0x80447a,%rcx
+  801dee:	00 00 00 
+  801df1:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801df3:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801df7:	48 be a0 76 80 00 00 	movabs $0x8076a0,%rsi
+  801dfe:	00 00 00 
+  801e01:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801e07:	75 27                	jne    801e30 <free+0xe0>
+            freep[i].is_free = true;
+  801e09:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801e0d:	48 ba a0 76 80 00 00 	movabs $0x8076a0,%rdx
+  801e14:	00 00 00 
+  801e17:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801e1e:	00 00 
+            real_freep_size++;
+  801e20:	48 83 c0 01          	add    $0x1,%rax
+  801e24:	48 a3 80 76 80 00 00 	movabs %rax,0x807680
+  801e2b:	00 00 00 
+}
+  801e2e:	5d                   	pop    %rbp
+  801e2f:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801e30:	48 ba 48 57 80 00 00 	movabs $0x805748,%rdx
+  801e37:	00 00 00 
+  801e3a:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801e3f:	48 bf 98 57 80 00 00 	movabs $0x805798,%rdi
+  801e46:	00 00 00 
+  801e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4e:	48 b9 7a 44 80 00 00 	movabs $0x80447a,%rcx
+  801e55:	00 00 00 
+  801e58:	ff d1                	call   *%rcx
+  801e5a:	c3                   	ret
+
+0000000000801e5b <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801e5b:	55                   	push   %rbp
+  801e5c:	48 89 e5             	mov    %rsp,%rbp
+  801e5f:	41 55                	push   %r13
+  801e61:	41 54                	push   %r12
+  801e63:	53                   	push   %rbx
+  801e64:	48 83 ec 08          	sub    $0x8,%rsp
+  801e68:	48 89 fb             	mov    %rdi,%rbx
+  801e6b:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801e6e:	48 b8 e4 1c 80 00 00 	movabs $0x801ce4,%rax
+  801e75:	00 00 00 
+  801e78:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801e7a:	49 39 c5             	cmp    %rax,%r13
+  801e7d:	73 0e                	jae    801e8d <realloc+0x32>
+}
+  801e7f:	48 89 d8             	mov    %rbx,%rax
+  801e82:	48 83 c4 08          	add    $0x8,%rsp
+  801e86:	5b                   	pop    %rbx
+  801e87:	41 5c                	pop    %r12
+  801e89:	41 5d                	pop    %r13
+  801e8b:	5d                   	pop    %rbp
+  801e8c:	c3                   	ret
+  801e8d:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801e90:	4c 89 ef             	mov    %r13,%rdi
+  801e93:	48 b8 d5 1a 80 00 00 	movabs $0x801ad5,%rax
+  801e9a:	00 00 00 
+  801e9d:	ff d0                	call   *%rax
+  801e9f:	48 89 c7             	mov    %rax,%rdi
+  801ea2:	4c 89 e2             	mov    %r12,%rdx
+  801ea5:	48 89 de             	mov    %rbx,%rsi
+  801ea8:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  801eaf:	00 00 00 
+  801eb2:	ff d0                	call   *%rax
+  801eb4:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801eb7:	48 89 df             	mov    %rbx,%rdi
+  801eba:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  801ec1:	00 00 00 
+  801ec4:	ff d0                	call   *%rax
+    return newptr;
+  801ec6:	4c 89 e3             	mov    %r12,%rbx
+  801ec9:	eb b4                	jmp    801e7f <realloc+0x24>
+
+0000000000801ecb <strdup>:
+
+char*
+strdup (const char *src) {
+  801ecb:	55                   	push   %rbp
+  801ecc:	48 89 e5             	mov    %rsp,%rbp
+  801ecf:	41 54                	push   %r12
+  801ed1:	53                   	push   %rbx
+  801ed2:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801ed5:	48 b8 c3 0e 80 00 00 	movabs $0x800ec3,%rax
+  801edc:	00 00 00 
+  801edf:	ff d0                	call   *%rax
+  801ee1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801ee5:	4c 89 e7             	mov    %r12,%rdi
+  801ee8:	48 b8 d5 1a 80 00 00 	movabs $0x801ad5,%rax
+  801eef:	00 00 00 
+  801ef2:	ff d0                	call   *%rax
+  801ef4:	48 89 c7             	mov    %rax,%rdi
+  801ef7:	4c 89 e2             	mov    %r12,%rdx
+  801efa:	48 89 de             	mov    %rbx,%rsi
+  801efd:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  801f04:	00 00 00 
+  801f07:	ff d0                	call   *%rax
+}
+  801f09:	5b                   	pop    %rbx
+  801f0a:	41 5c                	pop    %r12
+  801f0c:	5d                   	pop    %rbp
+  801f0d:	c3                   	ret
+
+0000000000801f0e <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801f0e:	55                   	push   %rbp
+  801f0f:	48 89 e5             	mov    %rsp,%rbp
+  801f12:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f13:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f37:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f3d:	c9                   	leave
+  801f3e:	c3                   	ret
+
+0000000000801f3f <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801f3f:	55                   	push   %rbp
+  801f40:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801f43:	48 b8 a0 76 98 00 00 	movabs $0x9876a0,%rax
+  801f4a:	00 00 00 
+  801f4d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801f51:	74 26                	je     801f79 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801f53:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f55:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f59:	89 c0                	mov    %eax,%eax
+  801f5b:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801f5e:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801f65:	48 b9 a0 76 98 00 00 	movabs $0x9876a0,%rcx
+  801f6c:	00 00 00 
+  801f6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f74:	48 f7 31             	divq   (%rcx)
+}
+  801f77:	5d                   	pop    %rbp
+  801f78:	c3                   	ret
+        freq = get_cpufreq();
+  801f79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7e:	48 ba 0e 1f 80 00 00 	movabs $0x801f0e,%rdx
+  801f85:	00 00 00 
+  801f88:	ff d2                	call   *%rdx
+  801f8a:	48 a3 a0 76 98 00 00 	movabs %rax,0x9876a0
+  801f91:	00 00 00 
+  801f94:	eb bd                	jmp    801f53 <get_ticks+0x14>
+
+0000000000801f96 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801f96:	55                   	push   %rbp
+  801f97:	48 89 e5             	mov    %rsp,%rbp
+  801f9a:	53                   	push   %rbx
+  801f9b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f9f:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801fa2:	48 b8 a0 76 98 00 00 	movabs $0x9876a0,%rax
+  801fa9:	00 00 00 
+  801fac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801fb0:	74 50                	je     802002 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801fb2:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fb4:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fb8:	89 c0                	mov    %eax,%eax
+  801fba:	48 89 d6             	mov    %rdx,%rsi
+  801fbd:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801fc0:	48 b8 a0 76 98 00 00 	movabs $0x9876a0,%rax
+  801fc7:	00 00 00 
+  801fca:	48 0f af 18          	imul   (%rax),%rbx
+  801fce:	48 c1 eb 03          	shr    $0x3,%rbx
+  801fd2:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801fd9:	9b c4 20 
+  801fdc:	48 89 d8             	mov    %rbx,%rax
+  801fdf:	48 f7 e2             	mul    %rdx
+  801fe2:	48 89 d1             	mov    %rdx,%rcx
+  801fe5:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801fe9:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801feb:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fef:	89 c0                	mov    %eax,%eax
+  801ff1:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801ff4:	48 29 f2             	sub    %rsi,%rdx
+  801ff7:	48 39 ca             	cmp    %rcx,%rdx
+  801ffa:	72 ed                	jb     801fe9 <sleep+0x53>
+}
+  801ffc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802000:	c9                   	leave
+  802001:	c3                   	ret
+        freq = get_cpufreq();
+  802002:	b8 00 00 00 00       	mov    $0x0,%eax
+  802007:	48 ba 0e 1f 80 00 00 	movabs $0x801f0e,%rdx
+  80200e:	00 00 00 
+  802011:	ff d2                	call   *%rdx
+  802013:	48 a3 a0 76 98 00 00 	movabs %rax,0x9876a0
+  80201a:	00 00 00 
+  80201d:	eb 93                	jmp    801fb2 <sleep+0x1c>
+
+000000000080201f <poll_kbd>:
+
+int poll_kbd() {
+  80201f:	55                   	push   %rbp
+  802020:	48 89 e5             	mov    %rsp,%rbp
+  802023:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802024:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802029:	ba 00 00 00 00       	mov    $0x0,%edx
+  80202e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802033:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802038:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80203d:	be 00 00 00 00       	mov    $0x0,%esi
+  802042:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802048:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  80204a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80204e:	c9                   	leave
+  80204f:	c3                   	ret
+
+0000000000802050 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  802050:	55                   	push   %rbp
+  802051:	48 89 e5             	mov    %rsp,%rbp
+  802054:	53                   	push   %rbx
+  802055:	49 89 fa             	mov    %rdi,%r10
+  802058:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  80205a:	44 89 c6             	mov    %r8d,%esi
+  80205d:	89 cf                	mov    %ecx,%edi
+  80205f:	89 d3                	mov    %edx,%ebx
+  802061:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  802063:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802068:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80206b:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  80206f:	cd 30                	int    $0x30
+  802071:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+
+0000000000802077 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  802077:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  80207a:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  80207e:	83 3f 01             	cmpl   $0x1,(%rdi)
+  802081:	7e 0f                	jle    802092 <argstart+0x1b>
+  802083:	48 b8 8c 50 80 00 00 	movabs $0x80508c,%rax
+  80208a:	00 00 00 
+  80208d:	48 85 f6             	test   %rsi,%rsi
+  802090:	75 05                	jne    802097 <argstart+0x20>
+  802092:	b8 00 00 00 00       	mov    $0x0,%eax
+  802097:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  80209b:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  8020a2:	00 
+}
+  8020a3:	c3                   	ret
+
+00000000008020a4 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  8020a4:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8020ab:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  8020ac:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  8020b0:	48 85 c0             	test   %rax,%rax
+  8020b3:	0f 84 8f 00 00 00    	je     802148 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  8020b9:	55                   	push   %rbp
+  8020ba:	48 89 e5             	mov    %rsp,%rbp
+  8020bd:	53                   	push   %rbx
+  8020be:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c2:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  8020c5:	80 38 00             	cmpb   $0x0,(%rax)
+  8020c8:	75 52                	jne    80211c <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  8020ca:	48 8b 17             	mov    (%rdi),%rdx
+  8020cd:	83 3a 01             	cmpl   $0x1,(%rdx)
+  8020d0:	74 67                	je     802139 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  8020d2:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8020d6:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  8020da:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8020dd:	75 5a                	jne    802139 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  8020df:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  8020e3:	74 54                	je     802139 <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  8020e5:	48 83 c0 01          	add    $0x1,%rax
+  8020e9:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8020ed:	8b 12                	mov    (%rdx),%edx
+  8020ef:	83 ea 01             	sub    $0x1,%edx
+  8020f2:	48 63 d2             	movslq %edx,%rdx
+  8020f5:	48 c1 e2 03          	shl    $0x3,%rdx
+  8020f9:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8020fd:	48 83 c7 08          	add    $0x8,%rdi
+  802101:	48 b8 8f 12 80 00 00 	movabs $0x80128f,%rax
+  802108:	00 00 00 
+  80210b:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  80210d:	48 8b 03             	mov    (%rbx),%rax
+  802110:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  802113:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802117:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80211a:	74 17                	je     802133 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  80211c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802120:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  802123:	48 83 c0 01          	add    $0x1,%rax
+  802127:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  80212b:	89 d0                	mov    %edx,%eax
+  80212d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802131:	c9                   	leave
+  802132:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  802133:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802137:	75 e3                	jne    80211c <argnext+0x78>
+    args->curarg = 0;
+  802139:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802140:	00 
+    return -1;
+  802141:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802146:	eb e3                	jmp    80212b <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  802148:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  80214d:	89 d0                	mov    %edx,%eax
+  80214f:	c3                   	ret
+
+0000000000802150 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  802150:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802154:	48 85 c0             	test   %rax,%rax
+  802157:	74 7b                	je     8021d4 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  802159:	55                   	push   %rbp
+  80215a:	48 89 e5             	mov    %rsp,%rbp
+  80215d:	53                   	push   %rbx
+  80215e:	48 83 ec 08          	sub    $0x8,%rsp
+  802162:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  802165:	80 38 00             	cmpb   $0x0,(%rax)
+  802168:	74 1c                	je     802186 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  80216a:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  80216e:	48 b8 8c 50 80 00 00 	movabs $0x80508c,%rax
+  802175:	00 00 00 
+  802178:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  80217c:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  802180:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802184:	c9                   	leave
+  802185:	c3                   	ret
+    } else if (*args->argc > 1) {
+  802186:	48 8b 07             	mov    (%rdi),%rax
+  802189:	83 38 01             	cmpl   $0x1,(%rax)
+  80218c:	7f 12                	jg     8021a0 <argnextvalue+0x50>
+        args->argvalue = 0;
+  80218e:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802195:	00 
+        args->curarg = 0;
+  802196:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  80219d:	00 
+  80219e:	eb dc                	jmp    80217c <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  8021a0:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8021a4:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8021a8:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8021ac:	8b 10                	mov    (%rax),%edx
+  8021ae:	83 ea 01             	sub    $0x1,%edx
+  8021b1:	48 63 d2             	movslq %edx,%rdx
+  8021b4:	48 c1 e2 03          	shl    $0x3,%rdx
+  8021b8:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8021bc:	48 83 c7 08          	add    $0x8,%rdi
+  8021c0:	48 b8 8f 12 80 00 00 	movabs $0x80128f,%rax
+  8021c7:	00 00 00 
+  8021ca:	ff d0                	call   *%rax
+        (*args->argc)--;
+  8021cc:	48 8b 03             	mov    (%rbx),%rax
+  8021cf:	83 28 01             	subl   $0x1,(%rax)
+  8021d2:	eb a8                	jmp    80217c <argnextvalue+0x2c>
+}
+  8021d4:	c3                   	ret
+
+00000000008021d5 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  8021d5:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  8021d9:	48 85 c0             	test   %rax,%rax
+  8021dc:	74 01                	je     8021df <argvalue+0xa>
+}
+  8021de:	c3                   	ret
+argvalue(struct Argstate *args) {
+  8021df:	55                   	push   %rbp
+  8021e0:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  8021e3:	48 b8 50 21 80 00 00 	movabs $0x802150,%rax
+  8021ea:	00 00 00 
+  8021ed:	ff d0                	call   *%rax
+}
+  8021ef:	5d                   	pop    %rbp
+  8021f0:	c3                   	ret
+
+00000000008021f1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8021f1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8021f8:	ff ff ff 
+  8021fb:	48 01 f8             	add    %rdi,%rax
+  8021fe:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802202:	c3                   	ret
+
+0000000000802203 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802203:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80220a:	ff ff ff 
+  80220d:	48 01 f8             	add    %rdi,%rax
+  802210:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802214:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80221a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80221e:	c3                   	ret
+
+000000000080221f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80221f:	55                   	push   %rbp
+  802220:	48 89 e5             	mov    %rsp,%rbp
+  802223:	41 57                	push   %r15
+  802225:	41 56                	push   %r14
+  802227:	41 55                	push   %r13
+  802229:	41 54                	push   %r12
+  80222b:	53                   	push   %rbx
+  80222c:	48 83 ec 08          	sub    $0x8,%rsp
+  802230:	49 89 ff             	mov    %rdi,%r15
+  802233:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802238:	49 bd d3 40 80 00 00 	movabs $0x8040d3,%r13
+  80223f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802242:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802248:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80224b:	48 89 df             	mov    %rbx,%rdi
+  80224e:	41 ff d5             	call   *%r13
+  802251:	83 e0 04             	and    $0x4,%eax
+  802254:	74 17                	je     80226d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802256:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80225d:	4c 39 f3             	cmp    %r14,%rbx
+  802260:	75 e6                	jne    802248 <fd_alloc+0x29>
+  802262:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802268:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80226d:	4d 89 27             	mov    %r12,(%r15)
+}
+  802270:	48 83 c4 08          	add    $0x8,%rsp
+  802274:	5b                   	pop    %rbx
+  802275:	41 5c                	pop    %r12
+  802277:	41 5d                	pop    %r13
+  802279:	41 5e                	pop    %r14
+  80227b:	41 5f                	pop    %r15
+  80227d:	5d                   	pop    %rbp
+  80227e:	c3                   	ret
+
+000000000080227f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80227f:	83 ff 1f             	cmp    $0x1f,%edi
+  802282:	77 39                	ja     8022bd <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802284:	55                   	push   %rbp
+  802285:	48 89 e5             	mov    %rsp,%rbp
+  802288:	41 54                	push   %r12
+  80228a:	53                   	push   %rbx
+  80228b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80228e:	48 63 df             	movslq %edi,%rbx
+  802291:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802298:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80229c:	48 89 df             	mov    %rbx,%rdi
+  80229f:	48 b8 d3 40 80 00 00 	movabs $0x8040d3,%rax
+  8022a6:	00 00 00 
+  8022a9:	ff d0                	call   *%rax
+  8022ab:	a8 04                	test   $0x4,%al
+  8022ad:	74 14                	je     8022c3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8022af:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8022b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022b8:	5b                   	pop    %rbx
+  8022b9:	41 5c                	pop    %r12
+  8022bb:	5d                   	pop    %rbp
+  8022bc:	c3                   	ret
+        return -E_INVAL;
+  8022bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8022c2:	c3                   	ret
+        return -E_INVAL;
+  8022c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022c8:	eb ee                	jmp    8022b8 <fd_lookup+0x39>
+
+00000000008022ca <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8022ca:	55                   	push   %rbp
+  8022cb:	48 89 e5             	mov    %rsp,%rbp
+  8022ce:	41 54                	push   %r12
+  8022d0:	53                   	push   %rbx
+  8022d1:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8022d4:	48 b8 40 58 80 00 00 	movabs $0x805840,%rax
+  8022db:	00 00 00 
+  8022de:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8022e5:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8022e8:	39 3b                	cmp    %edi,(%rbx)
+  8022ea:	74 47                	je     802333 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8022ec:	48 83 c0 08          	add    $0x8,%rax
+  8022f0:	48 8b 18             	mov    (%rax),%rbx
+  8022f3:	48 85 db             	test   %rbx,%rbx
+  8022f6:	75 f0                	jne    8022e8 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8022f8:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  8022ff:	00 00 00 
+  802302:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802308:	89 fa                	mov    %edi,%edx
+  80230a:	48 bf a8 57 80 00 00 	movabs $0x8057a8,%rdi
+  802311:	00 00 00 
+  802314:	b8 00 00 00 00       	mov    $0x0,%eax
+  802319:	48 b9 89 05 80 00 00 	movabs $0x800589,%rcx
+  802320:	00 00 00 
+  802323:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802325:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80232a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80232e:	5b                   	pop    %rbx
+  80232f:	41 5c                	pop    %r12
+  802331:	5d                   	pop    %rbp
+  802332:	c3                   	ret
+            return 0;
+  802333:	b8 00 00 00 00       	mov    $0x0,%eax
+  802338:	eb f0                	jmp    80232a <dev_lookup+0x60>
+
+000000000080233a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80233a:	55                   	push   %rbp
+  80233b:	48 89 e5             	mov    %rsp,%rbp
+  80233e:	41 55                	push   %r13
+  802340:	41 54                	push   %r12
+  802342:	53                   	push   %rbx
+  802343:	48 83 ec 18          	sub    $0x18,%rsp
+  802347:	48 89 fb             	mov    %rdi,%rbx
+  80234a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80234d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802354:	ff ff ff 
+  802357:	48 01 df             	add    %rbx,%rdi
+  80235a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80235e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802362:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802369:	00 00 00 
+  80236c:	ff d0                	call   *%rax
+  80236e:	41 89 c5             	mov    %eax,%r13d
+  802371:	85 c0                	test   %eax,%eax
+  802373:	78 06                	js     80237b <fd_close+0x41>
+  802375:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802379:	74 1a                	je     802395 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80237b:	45 84 e4             	test   %r12b,%r12b
+  80237e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802383:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802387:	44 89 e8             	mov    %r13d,%eax
+  80238a:	48 83 c4 18          	add    $0x18,%rsp
+  80238e:	5b                   	pop    %rbx
+  80238f:	41 5c                	pop    %r12
+  802391:	41 5d                	pop    %r13
+  802393:	5d                   	pop    %rbp
+  802394:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802395:	8b 3b                	mov    (%rbx),%edi
+  802397:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80239b:	48 b8 ca 22 80 00 00 	movabs $0x8022ca,%rax
+  8023a2:	00 00 00 
+  8023a5:	ff d0                	call   *%rax
+  8023a7:	41 89 c5             	mov    %eax,%r13d
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	78 1b                	js     8023c9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8023ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023b2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8023b6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8023bc:	48 85 c0             	test   %rax,%rax
+  8023bf:	74 08                	je     8023c9 <fd_close+0x8f>
+  8023c1:	48 89 df             	mov    %rbx,%rdi
+  8023c4:	ff d0                	call   *%rax
+  8023c6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8023c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023ce:	48 89 de             	mov    %rbx,%rsi
+  8023d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d6:	48 b8 40 18 80 00 00 	movabs $0x801840,%rax
+  8023dd:	00 00 00 
+  8023e0:	ff d0                	call   *%rax
+    return res;
+  8023e2:	eb a3                	jmp    802387 <fd_close+0x4d>
+
+00000000008023e4 <close>:
+
+int
+close(int fdnum) {
+  8023e4:	55                   	push   %rbp
+  8023e5:	48 89 e5             	mov    %rsp,%rbp
+  8023e8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8023ec:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023f0:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  8023f7:	00 00 00 
+  8023fa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023fc:	85 c0                	test   %eax,%eax
+  8023fe:	78 15                	js     802415 <close+0x31>
+
+    return fd_close(fd, 1);
+  802400:	be 01 00 00 00       	mov    $0x1,%esi
+  802405:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802409:	48 b8 3a 23 80 00 00 	movabs $0x80233a,%rax
+  802410:	00 00 00 
+  802413:	ff d0                	call   *%rax
+}
+  802415:	c9                   	leave
+  802416:	c3                   	ret
+
+0000000000802417 <close_all>:
+
+void
+close_all(void) {
+  802417:	55                   	push   %rbp
+  802418:	48 89 e5             	mov    %rsp,%rbp
+  80241b:	41 54                	push   %r12
+  80241d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80241e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802423:	49 bc e4 23 80 00 00 	movabs $0x8023e4,%r12
+  80242a:	00 00 00 
+  80242d:	89 df                	mov    %ebx,%edi
+  80242f:	41 ff d4             	call   *%r12
+  802432:	83 c3 01             	add    $0x1,%ebx
+  802435:	83 fb 20             	cmp    $0x20,%ebx
+  802438:	75 f3                	jne    80242d <close_all+0x16>
+}
+  80243a:	5b                   	pop    %rbx
+  80243b:	41 5c                	pop    %r12
+  80243d:	5d                   	pop    %rbp
+  80243e:	c3                   	ret
+
+000000000080243f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80243f:	55                   	push   %rbp
+  802440:	48 89 e5             	mov    %rsp,%rbp
+  802443:	41 57                	push   %r15
+  802445:	41 56                	push   %r14
+  802447:	41 55                	push   %r13
+  802449:	41 54                	push   %r12
+  80244b:	53                   	push   %rbx
+  80244c:	48 83 ec 18          	sub    $0x18,%rsp
+  802450:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802453:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802457:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  80245e:	00 00 00 
+  802461:	ff d0                	call   *%rax
+  802463:	89 c3                	mov    %eax,%ebx
+  802465:	85 c0                	test   %eax,%eax
+  802467:	0f 88 b8 00 00 00    	js     802525 <dup+0xe6>
+    close(newfdnum);
+  80246d:	44 89 e7             	mov    %r12d,%edi
+  802470:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  802477:	00 00 00 
+  80247a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80247c:	4d 63 ec             	movslq %r12d,%r13
+  80247f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802486:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80248a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80248e:	4c 89 ff             	mov    %r15,%rdi
+  802491:	49 be 03 22 80 00 00 	movabs $0x802203,%r14
+  802498:	00 00 00 
+  80249b:	41 ff d6             	call   *%r14
+  80249e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8024a1:	4c 89 ef             	mov    %r13,%rdi
+  8024a4:	41 ff d6             	call   *%r14
+  8024a7:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8024aa:	48 89 df             	mov    %rbx,%rdi
+  8024ad:	48 b8 d3 40 80 00 00 	movabs $0x8040d3,%rax
+  8024b4:	00 00 00 
+  8024b7:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8024b9:	a8 04                	test   $0x4,%al
+  8024bb:	74 2b                	je     8024e8 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8024bd:	41 89 c1             	mov    %eax,%r9d
+  8024c0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024c6:	4c 89 f1             	mov    %r14,%rcx
+  8024c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ce:	48 89 de             	mov    %rbx,%rsi
+  8024d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024d6:	48 b8 c8 16 80 00 00 	movabs $0x8016c8,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+  8024e2:	89 c3                	mov    %eax,%ebx
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	78 4e                	js     802536 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8024e8:	4c 89 ff             	mov    %r15,%rdi
+  8024eb:	48 b8 d3 40 80 00 00 	movabs $0x8040d3,%rax
+  8024f2:	00 00 00 
+  8024f5:	ff d0                	call   *%rax
+  8024f7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8024fa:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802500:	4c 89 e9             	mov    %r13,%rcx
+  802503:	ba 00 00 00 00       	mov    $0x0,%edx
+  802508:	4c 89 fe             	mov    %r15,%rsi
+  80250b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802510:	48 b8 c8 16 80 00 00 	movabs $0x8016c8,%rax
+  802517:	00 00 00 
+  80251a:	ff d0                	call   *%rax
+  80251c:	89 c3                	mov    %eax,%ebx
+  80251e:	85 c0                	test   %eax,%eax
+  802520:	78 14                	js     802536 <dup+0xf7>
+
+    return newfdnum;
+  802522:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802525:	89 d8                	mov    %ebx,%eax
+  802527:	48 83 c4 18          	add    $0x18,%rsp
+  80252b:	5b                   	pop    %rbx
+  80252c:	41 5c                	pop    %r12
+  80252e:	41 5d                	pop    %r13
+  802530:	41 5e                	pop    %r14
+  802532:	41 5f                	pop    %r15
+  802534:	5d                   	pop    %rbp
+  802535:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802536:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80253b:	4c 89 ee             	mov    %r13,%rsi
+  80253e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802543:	49 bc 40 18 80 00 00 	movabs $0x801840,%r12
+  80254a:	00 00 00 
+  80254d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802550:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802555:	4c 89 f6             	mov    %r14,%rsi
+  802558:	bf 00 00 00 00       	mov    $0x0,%edi
+  80255d:	41 ff d4             	call   *%r12
+    return res;
+  802560:	eb c3                	jmp    802525 <dup+0xe6>
+
+0000000000802562 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802562:	55                   	push   %rbp
+  802563:	48 89 e5             	mov    %rsp,%rbp
+  802566:	41 56                	push   %r14
+  802568:	41 55                	push   %r13
+  80256a:	41 54                	push   %r12
+  80256c:	53                   	push   %rbx
+  80256d:	48 83 ec 10          	sub    $0x10,%rsp
+  802571:	89 fb                	mov    %edi,%ebx
+  802573:	49 89 f4             	mov    %rsi,%r12
+  802576:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802579:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80257d:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802584:	00 00 00 
+  802587:	ff d0                	call   *%rax
+  802589:	85 c0                	test   %eax,%eax
+  80258b:	78 4c                	js     8025d9 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80258d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802591:	41 8b 3e             	mov    (%r14),%edi
+  802594:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802598:	48 b8 ca 22 80 00 00 	movabs $0x8022ca,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+  8025a4:	85 c0                	test   %eax,%eax
+  8025a6:	78 35                	js     8025dd <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8025a8:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8025ac:	83 e0 03             	and    $0x3,%eax
+  8025af:	83 f8 01             	cmp    $0x1,%eax
+  8025b2:	74 2d                	je     8025e1 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8025b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025b8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8025bc:	48 85 c0             	test   %rax,%rax
+  8025bf:	74 56                	je     802617 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8025c1:	4c 89 ea             	mov    %r13,%rdx
+  8025c4:	4c 89 e6             	mov    %r12,%rsi
+  8025c7:	4c 89 f7             	mov    %r14,%rdi
+  8025ca:	ff d0                	call   *%rax
+}
+  8025cc:	48 83 c4 10          	add    $0x10,%rsp
+  8025d0:	5b                   	pop    %rbx
+  8025d1:	41 5c                	pop    %r12
+  8025d3:	41 5d                	pop    %r13
+  8025d5:	41 5e                	pop    %r14
+  8025d7:	5d                   	pop    %rbp
+  8025d8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025d9:	48 98                	cltq
+  8025db:	eb ef                	jmp    8025cc <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025dd:	48 98                	cltq
+  8025df:	eb eb                	jmp    8025cc <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8025e1:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  8025e8:	00 00 00 
+  8025eb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8025f1:	89 da                	mov    %ebx,%edx
+  8025f3:	48 bf e9 57 80 00 00 	movabs $0x8057e9,%rdi
+  8025fa:	00 00 00 
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802602:	48 b9 89 05 80 00 00 	movabs $0x800589,%rcx
+  802609:	00 00 00 
+  80260c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80260e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802615:	eb b5                	jmp    8025cc <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802617:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80261e:	eb ac                	jmp    8025cc <read+0x6a>
+
+0000000000802620 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802620:	55                   	push   %rbp
+  802621:	48 89 e5             	mov    %rsp,%rbp
+  802624:	41 57                	push   %r15
+  802626:	41 56                	push   %r14
+  802628:	41 55                	push   %r13
+  80262a:	41 54                	push   %r12
+  80262c:	53                   	push   %rbx
+  80262d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802631:	48 85 d2             	test   %rdx,%rdx
+  802634:	74 54                	je     80268a <readn+0x6a>
+  802636:	41 89 fd             	mov    %edi,%r13d
+  802639:	49 89 f6             	mov    %rsi,%r14
+  80263c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80263f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802644:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802649:	49 bf 62 25 80 00 00 	movabs $0x802562,%r15
+  802650:	00 00 00 
+  802653:	4c 89 e2             	mov    %r12,%rdx
+  802656:	48 29 f2             	sub    %rsi,%rdx
+  802659:	4c 01 f6             	add    %r14,%rsi
+  80265c:	44 89 ef             	mov    %r13d,%edi
+  80265f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802662:	85 c0                	test   %eax,%eax
+  802664:	78 20                	js     802686 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802666:	01 c3                	add    %eax,%ebx
+  802668:	85 c0                	test   %eax,%eax
+  80266a:	74 08                	je     802674 <readn+0x54>
+  80266c:	48 63 f3             	movslq %ebx,%rsi
+  80266f:	4c 39 e6             	cmp    %r12,%rsi
+  802672:	72 df                	jb     802653 <readn+0x33>
+    }
+    return res;
+  802674:	48 63 c3             	movslq %ebx,%rax
+}
+  802677:	48 83 c4 08          	add    $0x8,%rsp
+  80267b:	5b                   	pop    %rbx
+  80267c:	41 5c                	pop    %r12
+  80267e:	41 5d                	pop    %r13
+  802680:	41 5e                	pop    %r14
+  802682:	41 5f                	pop    %r15
+  802684:	5d                   	pop    %rbp
+  802685:	c3                   	ret
+        if (inc < 0) return inc;
+  802686:	48 98                	cltq
+  802688:	eb ed                	jmp    802677 <readn+0x57>
+    int inc = 1, res = 0;
+  80268a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80268f:	eb e3                	jmp    802674 <readn+0x54>
+
+0000000000802691 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802691:	55                   	push   %rbp
+  802692:	48 89 e5             	mov    %rsp,%rbp
+  802695:	41 56                	push   %r14
+  802697:	41 55                	push   %r13
+  802699:	41 54                	push   %r12
+  80269b:	53                   	push   %rbx
+  80269c:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a0:	89 fb                	mov    %edi,%ebx
+  8026a2:	49 89 f4             	mov    %rsi,%r12
+  8026a5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026a8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026ac:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  8026b3:	00 00 00 
+  8026b6:	ff d0                	call   *%rax
+  8026b8:	85 c0                	test   %eax,%eax
+  8026ba:	78 47                	js     802703 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026bc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8026c0:	41 8b 3e             	mov    (%r14),%edi
+  8026c3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026c7:	48 b8 ca 22 80 00 00 	movabs $0x8022ca,%rax
+  8026ce:	00 00 00 
+  8026d1:	ff d0                	call   *%rax
+  8026d3:	85 c0                	test   %eax,%eax
+  8026d5:	78 30                	js     802707 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026d7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8026dc:	74 2d                	je     80270b <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8026de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026e2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8026e6:	48 85 c0             	test   %rax,%rax
+  8026e9:	74 56                	je     802741 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8026eb:	4c 89 ea             	mov    %r13,%rdx
+  8026ee:	4c 89 e6             	mov    %r12,%rsi
+  8026f1:	4c 89 f7             	mov    %r14,%rdi
+  8026f4:	ff d0                	call   *%rax
+}
+  8026f6:	48 83 c4 10          	add    $0x10,%rsp
+  8026fa:	5b                   	pop    %rbx
+  8026fb:	41 5c                	pop    %r12
+  8026fd:	41 5d                	pop    %r13
+  8026ff:	41 5e                	pop    %r14
+  802701:	5d                   	pop    %rbp
+  802702:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802703:	48 98                	cltq
+  802705:	eb ef                	jmp    8026f6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802707:	48 98                	cltq
+  802709:	eb eb                	jmp    8026f6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80270b:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  802712:	00 00 00 
+  802715:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80271b:	89 da                	mov    %ebx,%edx
+  80271d:	48 bf 05 58 80 00 00 	movabs $0x805805,%rdi
+  802724:	00 00 00 
+  802727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272c:	48 b9 89 05 80 00 00 	movabs $0x800589,%rcx
+  802733:	00 00 00 
+  802736:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802738:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80273f:	eb b5                	jmp    8026f6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802741:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802748:	eb ac                	jmp    8026f6 <write+0x65>
+
+000000000080274a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80274a:	55                   	push   %rbp
+  80274b:	48 89 e5             	mov    %rsp,%rbp
+  80274e:	53                   	push   %rbx
+  80274f:	48 83 ec 18          	sub    $0x18,%rsp
+  802753:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802755:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802759:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802760:	00 00 00 
+  802763:	ff d0                	call   *%rax
+  802765:	85 c0                	test   %eax,%eax
+  802767:	78 0c                	js     802775 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802769:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80276d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802770:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802775:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802779:	c9                   	leave
+  80277a:	c3                   	ret
+
+000000000080277b <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80277b:	55                   	push   %rbp
+  80277c:	48 89 e5             	mov    %rsp,%rbp
+  80277f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802783:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802787:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  80278e:	00 00 00 
+  802791:	ff d0                	call   *%rax
+  802793:	85 c0                	test   %eax,%eax
+  802795:	78 07                	js     80279e <tell+0x23>
+    return fdes->fd_offset;
+  802797:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80279b:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80279e:	c9                   	leave
+  80279f:	c3                   	ret
+
+00000000008027a0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8027a0:	55                   	push   %rbp
+  8027a1:	48 89 e5             	mov    %rsp,%rbp
+  8027a4:	41 55                	push   %r13
+  8027a6:	41 54                	push   %r12
+  8027a8:	53                   	push   %rbx
+  8027a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8027ad:	89 fb                	mov    %edi,%ebx
+  8027af:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027b2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027b6:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  8027bd:	00 00 00 
+  8027c0:	ff d0                	call   *%rax
+  8027c2:	85 c0                	test   %eax,%eax
+  8027c4:	78 38                	js     8027fe <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027c6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8027ca:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8027ce:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027d2:	48 b8 ca 22 80 00 00 	movabs $0x8022ca,%rax
+  8027d9:	00 00 00 
+  8027dc:	ff d0                	call   *%rax
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	78 1c                	js     8027fe <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027e2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8027e7:	74 20                	je     802809 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8027e9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027ed:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8027f1:	48 85 c0             	test   %rax,%rax
+  8027f4:	74 47                	je     80283d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8027f6:	44 89 e6             	mov    %r12d,%esi
+  8027f9:	4c 89 ef             	mov    %r13,%rdi
+  8027fc:	ff d0                	call   *%rax
+}
+  8027fe:	48 83 c4 18          	add    $0x18,%rsp
+  802802:	5b                   	pop    %rbx
+  802803:	41 5c                	pop    %r12
+  802805:	41 5d                	pop    %r13
+  802807:	5d                   	pop    %rbp
+  802808:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802809:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  802810:	00 00 00 
+  802813:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802819:	89 da                	mov    %ebx,%edx
+  80281b:	48 bf c8 57 80 00 00 	movabs $0x8057c8,%rdi
+  802822:	00 00 00 
+  802825:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282a:	48 b9 89 05 80 00 00 	movabs $0x800589,%rcx
+  802831:	00 00 00 
+  802834:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802836:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80283b:	eb c1                	jmp    8027fe <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80283d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802842:	eb ba                	jmp    8027fe <ftruncate+0x5e>
+
+0000000000802844 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802844:	55                   	push   %rbp
+  802845:	48 89 e5             	mov    %rsp,%rbp
+  802848:	41 54                	push   %r12
+  80284a:	53                   	push   %rbx
+  80284b:	48 83 ec 10          	sub    $0x10,%rsp
+  80284f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802852:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802856:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+  802862:	85 c0                	test   %eax,%eax
+  802864:	78 4e                	js     8028b4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802866:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80286a:	41 8b 3c 24          	mov    (%r12),%edi
+  80286e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802872:	48 b8 ca 22 80 00 00 	movabs $0x8022ca,%rax
+  802879:	00 00 00 
+  80287c:	ff d0                	call   *%rax
+  80287e:	85 c0                	test   %eax,%eax
+  802880:	78 32                	js     8028b4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802882:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802886:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80288b:	74 30                	je     8028bd <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80288d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802890:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802897:	00 00 00 
+    stat->st_isdir = 0;
+  80289a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8028a1:	00 00 00 
+    stat->st_dev = dev;
+  8028a4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8028ab:	48 89 de             	mov    %rbx,%rsi
+  8028ae:	4c 89 e7             	mov    %r12,%rdi
+  8028b1:	ff 50 28             	call   *0x28(%rax)
+}
+  8028b4:	48 83 c4 10          	add    $0x10,%rsp
+  8028b8:	5b                   	pop    %rbx
+  8028b9:	41 5c                	pop    %r12
+  8028bb:	5d                   	pop    %rbp
+  8028bc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8028bd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8028c2:	eb f0                	jmp    8028b4 <fstat+0x70>
+
+00000000008028c4 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	41 54                	push   %r12
+  8028ca:	53                   	push   %rbx
+  8028cb:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8028d2:	41 89 fc             	mov    %edi,%r12d
+  8028d5:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028d7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028db:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  8028e2:	00 00 00 
+  8028e5:	ff d0                	call   *%rax
+  8028e7:	85 c0                	test   %eax,%eax
+  8028e9:	78 31                	js     80291c <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8028eb:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8028f2:	44 89 e7             	mov    %r12d,%edi
+  8028f5:	48 b8 44 28 80 00 00 	movabs $0x802844,%rax
+  8028fc:	00 00 00 
+  8028ff:	ff d0                	call   *%rax
+  802901:	85 c0                	test   %eax,%eax
+  802903:	78 17                	js     80291c <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802905:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802909:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  80290c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80290f:	39 d3                	cmp    %edx,%ebx
+  802911:	0f 4f da             	cmovg  %edx,%ebx
+  802914:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802917:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80291c:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802923:	5b                   	pop    %rbx
+  802924:	41 5c                	pop    %r12
+  802926:	5d                   	pop    %rbp
+  802927:	c3                   	ret
+
+0000000000802928 <seektoend>:
+{
+  802928:	55                   	push   %rbp
+  802929:	48 89 e5             	mov    %rsp,%rbp
+  80292c:	53                   	push   %rbx
+  80292d:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802934:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802936:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80293a:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802941:	00 00 00 
+  802944:	ff d0                	call   *%rax
+  802946:	85 c0                	test   %eax,%eax
+  802948:	78 28                	js     802972 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80294a:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802951:	89 df                	mov    %ebx,%edi
+  802953:	48 b8 44 28 80 00 00 	movabs $0x802844,%rax
+  80295a:	00 00 00 
+  80295d:	ff d0                	call   *%rax
+  80295f:	85 c0                	test   %eax,%eax
+  802961:	78 0f                	js     802972 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802963:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802966:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80296a:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80296d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802972:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802976:	c9                   	leave
+  802977:	c3                   	ret
+
+0000000000802978 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802978:	55                   	push   %rbp
+  802979:	48 89 e5             	mov    %rsp,%rbp
+  80297c:	41 54                	push   %r12
+  80297e:	53                   	push   %rbx
+  80297f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802982:	be 00 00 00 00       	mov    $0x0,%esi
+  802987:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  80298e:	00 00 00 
+  802991:	ff d0                	call   *%rax
+  802993:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802995:	85 c0                	test   %eax,%eax
+  802997:	78 25                	js     8029be <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802999:	4c 89 e6             	mov    %r12,%rsi
+  80299c:	89 c7                	mov    %eax,%edi
+  80299e:	48 b8 44 28 80 00 00 	movabs $0x802844,%rax
+  8029a5:	00 00 00 
+  8029a8:	ff d0                	call   *%rax
+  8029aa:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8029ad:	89 df                	mov    %ebx,%edi
+  8029af:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  8029b6:	00 00 00 
+  8029b9:	ff d0                	call   *%rax
+
+    return res;
+  8029bb:	44 89 e3             	mov    %r12d,%ebx
+}
+  8029be:	89 d8                	mov    %ebx,%eax
+  8029c0:	5b                   	pop    %rbx
+  8029c1:	41 5c                	pop    %r12
+  8029c3:	5d                   	pop    %rbp
+  8029c4:	c3                   	ret
+
+00000000008029c5 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8029c5:	55                   	push   %rbp
+  8029c6:	48 89 e5             	mov    %rsp,%rbp
+  8029c9:	53                   	push   %rbx
+  8029ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ce:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8029d1:	48 b8 f1 21 80 00 00 	movabs $0x8021f1,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+  8029dd:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8029e1:	0f 87 ea 00 00 00    	ja     802ad1 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8029e7:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8029ee:	00 00 00 
+  8029f1:	80 38 00             	cmpb   $0x0,(%rax)
+  8029f4:	75 35                	jne    802a2b <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8029f6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029fb:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802a00:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802a05:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a0a:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  802a11:	00 00 00 
+  802a14:	ff d0                	call   *%rax
+  802a16:	85 c0                	test   %eax,%eax
+  802a18:	0f 88 ba 00 00 00    	js     802ad8 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802a1e:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802a25:	00 00 00 
+  802a28:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802a2b:	48 89 df             	mov    %rbx,%rdi
+  802a2e:	48 b8 f1 21 80 00 00 	movabs $0x8021f1,%rax
+  802a35:	00 00 00 
+  802a38:	ff d0                	call   *%rax
+  802a3a:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802a3e:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802a45:	00 00 00 
+  802a48:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802a4c:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802a4f:	39 39                	cmp    %edi,(%rcx)
+  802a51:	74 46                	je     802a99 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802a53:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802a57:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802a5e:	00 
+  802a5f:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802a66:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802a6d:	00 
+  802a6e:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802a75:	00 
+  802a76:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802a7d:	00 
+  802a7e:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802a85:	00 
+  802a86:	89 39                	mov    %edi,(%rcx)
+  802a88:	48 01 c6             	add    %rax,%rsi
+  802a8b:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802a90:	48 89 c8             	mov    %rcx,%rax
+  802a93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a97:	c9                   	leave
+  802a98:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802a99:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802a9d:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802aa4:	00 00 00 
+  802aa7:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802aaa:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802aae:	74 e0                	je     802a90 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802ab0:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802ab7:	00 
+  802ab8:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802abc:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802ac3:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802ac5:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802ac8:	48 01 c2             	add    %rax,%rdx
+  802acb:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802acf:	eb bf                	jmp    802a90 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802ad1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ad6:	eb b8                	jmp    802a90 <fbuf_get+0xcb>
+            return NULL;
+  802ad8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802add:	eb b1                	jmp    802a90 <fbuf_get+0xcb>
+
+0000000000802adf <fsipc_bulk>:
+fsipc_bulk(void) {
+  802adf:	55                   	push   %rbp
+  802ae0:	48 89 e5             	mov    %rsp,%rbp
+  802ae3:	53                   	push   %rbx
+  802ae4:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802ae8:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802aef:	00 00 00 
+  802af2:	48 8b 18             	mov    (%rax),%rbx
+  802af5:	48 85 db             	test   %rbx,%rbx
+  802af8:	74 16                	je     802b10 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802afa:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802b01:	00 00 00 
+  802b04:	48 8b 18             	mov    (%rax),%rbx
+}
+  802b07:	48 89 d8             	mov    %rbx,%rax
+  802b0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b0e:	c9                   	leave
+  802b0f:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802b10:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b15:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802b1a:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802b1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b24:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  802b2b:	00 00 00 
+  802b2e:	ff d0                	call   *%rax
+  802b30:	85 c0                	test   %eax,%eax
+  802b32:	78 d3                	js     802b07 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802b34:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802b39:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802b40:	00 00 00 
+  802b43:	eb b5                	jmp    802afa <fsipc_bulk+0x1b>
+
+0000000000802b45 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802b45:	55                   	push   %rbp
+  802b46:	48 89 e5             	mov    %rsp,%rbp
+  802b49:	41 57                	push   %r15
+  802b4b:	41 56                	push   %r14
+  802b4d:	41 55                	push   %r13
+  802b4f:	41 54                	push   %r12
+  802b51:	53                   	push   %rbx
+  802b52:	48 83 ec 08          	sub    $0x8,%rsp
+  802b56:	41 89 fd             	mov    %edi,%r13d
+  802b59:	49 89 f6             	mov    %rsi,%r14
+  802b5c:	49 89 d7             	mov    %rdx,%r15
+  802b5f:	48 89 cb             	mov    %rcx,%rbx
+  802b62:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b65:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802b6c:	00 00 00 
+  802b6f:	83 38 00             	cmpl   $0x0,(%rax)
+  802b72:	74 52                	je     802bc6 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802b74:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b7a:	4c 89 f9             	mov    %r15,%rcx
+  802b7d:	4c 89 f2             	mov    %r14,%rdx
+  802b80:	44 89 ee             	mov    %r13d,%esi
+  802b83:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802b8a:	00 00 00 
+  802b8d:	8b 38                	mov    (%rax),%edi
+  802b8f:	48 b8 cd 46 80 00 00 	movabs $0x8046cd,%rax
+  802b96:	00 00 00 
+  802b99:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802b9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ba0:	4c 89 e2             	mov    %r12,%rdx
+  802ba3:	48 89 de             	mov    %rbx,%rsi
+  802ba6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bab:	48 b8 1d 45 80 00 00 	movabs $0x80451d,%rax
+  802bb2:	00 00 00 
+  802bb5:	ff d0                	call   *%rax
+}
+  802bb7:	48 83 c4 08          	add    $0x8,%rsp
+  802bbb:	5b                   	pop    %rbx
+  802bbc:	41 5c                	pop    %r12
+  802bbe:	41 5d                	pop    %r13
+  802bc0:	41 5e                	pop    %r14
+  802bc2:	41 5f                	pop    %r15
+  802bc4:	5d                   	pop    %rbp
+  802bc5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bc6:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bcb:	48 b8 70 47 80 00 00 	movabs $0x804770,%rax
+  802bd2:	00 00 00 
+  802bd5:	ff d0                	call   *%rax
+  802bd7:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802bde:	00 00 
+  802be0:	eb 92                	jmp    802b74 <fsipc_region+0x2f>
+
+0000000000802be2 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802be2:	55                   	push   %rbp
+  802be3:	48 89 e5             	mov    %rsp,%rbp
+  802be6:	41 57                	push   %r15
+  802be8:	41 56                	push   %r14
+  802bea:	41 55                	push   %r13
+  802bec:	41 54                	push   %r12
+  802bee:	53                   	push   %rbx
+  802bef:	48 83 ec 28          	sub    $0x28,%rsp
+  802bf3:	49 89 ff             	mov    %rdi,%r15
+  802bf6:	49 89 f6             	mov    %rsi,%r14
+  802bf9:	48 89 d3             	mov    %rdx,%rbx
+  802bfc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802c00:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802c03:	48 b8 df 2a 80 00 00 	movabs $0x802adf,%rax
+  802c0a:	00 00 00 
+  802c0d:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802c0f:	48 85 c0             	test   %rax,%rax
+  802c12:	0f 84 cc 00 00 00    	je     802ce4 <devfile_write_direct+0x102>
+  802c18:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802c1b:	48 85 db             	test   %rbx,%rbx
+  802c1e:	0f 84 ba 00 00 00    	je     802cde <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802c24:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802c2a:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802c31:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802c35:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802c39:	4c 29 e3             	sub    %r12,%rbx
+  802c3c:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802c41:	48 39 c3             	cmp    %rax,%rbx
+  802c44:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802c48:	48 89 da             	mov    %rbx,%rdx
+  802c4b:	4c 89 f6             	mov    %r14,%rsi
+  802c4e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802c52:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  802c59:	00 00 00 
+  802c5c:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802c5e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802c62:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802c66:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802c69:	44 01 e0             	add    %r12d,%eax
+  802c6c:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802c70:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802c74:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802c7b:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802c82:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802c89:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c94:	4c 89 ee             	mov    %r13,%rsi
+  802c97:	bf 04 00 00 00       	mov    $0x4,%edi
+  802c9c:	48 b8 45 2b 80 00 00 	movabs $0x802b45,%rax
+  802ca3:	00 00 00 
+  802ca6:	ff d0                	call   *%rax
+        if (res < 0)
+  802ca8:	85 c0                	test   %eax,%eax
+  802caa:	78 29                	js     802cd5 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802cac:	74 2b                	je     802cd9 <devfile_write_direct+0xf7>
+        i += res;
+  802cae:	48 98                	cltq
+  802cb0:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802cb3:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802cb6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cba:	49 39 c4             	cmp    %rax,%r12
+  802cbd:	0f 82 72 ff ff ff    	jb     802c35 <devfile_write_direct+0x53>
+    return i;
+  802cc3:	4c 89 e0             	mov    %r12,%rax
+}
+  802cc6:	48 83 c4 28          	add    $0x28,%rsp
+  802cca:	5b                   	pop    %rbx
+  802ccb:	41 5c                	pop    %r12
+  802ccd:	41 5d                	pop    %r13
+  802ccf:	41 5e                	pop    %r14
+  802cd1:	41 5f                	pop    %r15
+  802cd3:	5d                   	pop    %rbp
+  802cd4:	c3                   	ret
+            return res;
+  802cd5:	48 98                	cltq
+  802cd7:	eb ed                	jmp    802cc6 <devfile_write_direct+0xe4>
+            return i;
+  802cd9:	4c 89 e0             	mov    %r12,%rax
+  802cdc:	eb e8                	jmp    802cc6 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802cde:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802ce2:	eb df                	jmp    802cc3 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802ce4:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802ceb:	eb d9                	jmp    802cc6 <devfile_write_direct+0xe4>
+
+0000000000802ced <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802ced:	55                   	push   %rbp
+  802cee:	48 89 e5             	mov    %rsp,%rbp
+  802cf1:	41 56                	push   %r14
+  802cf3:	41 55                	push   %r13
+  802cf5:	41 54                	push   %r12
+  802cf7:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802cf8:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802cfc:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802d00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d05:	4d 39 ee             	cmp    %r13,%r14
+  802d08:	0f 84 99 00 00 00    	je     802da7 <fbuf_flush+0xba>
+  802d0e:	49 89 fc             	mov    %rdi,%r12
+  802d11:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802d14:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802d17:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802d1b:	48 b8 f1 21 80 00 00 	movabs $0x8021f1,%rax
+  802d22:	00 00 00 
+  802d25:	ff d0                	call   *%rax
+  802d27:	48 89 c2             	mov    %rax,%rdx
+  802d2a:	48 c1 e2 04          	shl    $0x4,%rdx
+  802d2e:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802d32:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d36:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802d3b:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802d3e:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802d42:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802d49:	00 
+  802d4a:	44 89 f1             	mov    %r14d,%ecx
+  802d4d:	4c 89 ea             	mov    %r13,%rdx
+  802d50:	4c 89 e7             	mov    %r12,%rdi
+  802d53:	48 b8 e2 2b 80 00 00 	movabs $0x802be2,%rax
+  802d5a:	00 00 00 
+  802d5d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d5f:	48 85 c0             	test   %rax,%rax
+  802d62:	78 43                	js     802da7 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802d64:	4c 39 e8             	cmp    %r13,%rax
+  802d67:	72 47                	jb     802db0 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802d69:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802d6e:	83 c0 01             	add    $0x1,%eax
+  802d71:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d76:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802d79:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802d7d:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802d81:	72 0f                	jb     802d92 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802d83:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802d87:	48 39 c2             	cmp    %rax,%rdx
+  802d8a:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802d8e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802d92:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802d99:	00 
+  802d9a:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802da1:	00 
+    return 0;
+  802da2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802da7:	5b                   	pop    %rbx
+  802da8:	41 5c                	pop    %r12
+  802daa:	41 5d                	pop    %r13
+  802dac:	41 5e                	pop    %r14
+  802dae:	5d                   	pop    %rbp
+  802daf:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802db0:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802db5:	eb f0                	jmp    802da7 <fbuf_flush+0xba>
+
+0000000000802db7 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802db7:	55                   	push   %rbp
+  802db8:	48 89 e5             	mov    %rsp,%rbp
+  802dbb:	53                   	push   %rbx
+  802dbc:	48 83 ec 08          	sub    $0x8,%rsp
+  802dc0:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802dc3:	48 b8 c5 29 80 00 00 	movabs $0x8029c5,%rax
+  802dca:	00 00 00 
+  802dcd:	ff d0                	call   *%rax
+  802dcf:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802dd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd7:	48 85 f6             	test   %rsi,%rsi
+  802dda:	74 0f                	je     802deb <devfile_sync+0x34>
+  802ddc:	48 89 df             	mov    %rbx,%rdi
+  802ddf:	48 b8 ed 2c 80 00 00 	movabs $0x802ced,%rax
+  802de6:	00 00 00 
+  802de9:	ff d0                	call   *%rax
+}
+  802deb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802def:	c9                   	leave
+  802df0:	c3                   	ret
+
+0000000000802df1 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802df1:	55                   	push   %rbp
+  802df2:	48 89 e5             	mov    %rsp,%rbp
+  802df5:	48 83 ec 10          	sub    $0x10,%rsp
+  802df9:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802dfc:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802e03:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802e04:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802e08:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e0d:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802e14:	00 00 00 
+  802e17:	48 b8 45 2b 80 00 00 	movabs $0x802b45,%rax
+  802e1e:	00 00 00 
+  802e21:	ff d0                	call   *%rax
+}
+  802e23:	c9                   	leave
+  802e24:	c3                   	ret
+
+0000000000802e25 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e25:	55                   	push   %rbp
+  802e26:	48 89 e5             	mov    %rsp,%rbp
+  802e29:	41 54                	push   %r12
+  802e2b:	53                   	push   %rbx
+  802e2c:	48 89 fb             	mov    %rdi,%rbx
+  802e2f:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802e32:	48 b8 b7 2d 80 00 00 	movabs $0x802db7,%rax
+  802e39:	00 00 00 
+  802e3c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e3e:	85 c0                	test   %eax,%eax
+  802e40:	78 63                	js     802ea5 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e42:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e45:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802e4c:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802e4e:	be 00 00 00 00       	mov    $0x0,%esi
+  802e53:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e58:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  802e5f:	00 00 00 
+  802e62:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e64:	85 c0                	test   %eax,%eax
+  802e66:	78 3d                	js     802ea5 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e68:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802e6f:	00 00 00 
+  802e72:	48 89 de             	mov    %rbx,%rsi
+  802e75:	4c 89 e7             	mov    %r12,%rdi
+  802e78:	48 b8 01 0f 80 00 00 	movabs $0x800f01,%rax
+  802e7f:	00 00 00 
+  802e82:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802e84:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802e8a:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802e91:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802e92:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802e98:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802e9f:	00 
+
+    return 0;
+  802ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ea5:	5b                   	pop    %rbx
+  802ea6:	41 5c                	pop    %r12
+  802ea8:	5d                   	pop    %rbp
+  802ea9:	c3                   	ret
+
+0000000000802eaa <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802eaa:	55                   	push   %rbp
+  802eab:	48 89 e5             	mov    %rsp,%rbp
+  802eae:	41 54                	push   %r12
+  802eb0:	53                   	push   %rbx
+  802eb1:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802eb4:	48 b8 b7 2d 80 00 00 	movabs $0x802db7,%rax
+  802ebb:	00 00 00 
+  802ebe:	ff d0                	call   *%rax
+  802ec0:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802ec3:	48 89 df             	mov    %rbx,%rdi
+  802ec6:	48 b8 f1 21 80 00 00 	movabs $0x8021f1,%rax
+  802ecd:	00 00 00 
+  802ed0:	ff d0                	call   *%rax
+  802ed2:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802ed6:	76 2e                	jbe    802f06 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802ed8:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802edb:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802ee2:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802ee4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ee9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802eee:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  802ef5:	00 00 00 
+  802ef8:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802efa:	45 85 e4             	test   %r12d,%r12d
+  802efd:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802f01:	5b                   	pop    %rbx
+  802f02:	41 5c                	pop    %r12
+  802f04:	5d                   	pop    %rbp
+  802f05:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802f06:	48 89 df             	mov    %rbx,%rdi
+  802f09:	48 b8 f1 21 80 00 00 	movabs $0x8021f1,%rax
+  802f10:	00 00 00 
+  802f13:	ff d0                	call   *%rax
+  802f15:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802f19:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802f20:	00 00 00 
+  802f23:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802f2a:	48 89 df             	mov    %rbx,%rdi
+  802f2d:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  802f34:	00 00 00 
+  802f37:	ff d0                	call   *%rax
+  802f39:	48 89 c6             	mov    %rax,%rsi
+  802f3c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f41:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f46:	48 b8 40 18 80 00 00 	movabs $0x801840,%rax
+  802f4d:	00 00 00 
+  802f50:	ff d0                	call   *%rax
+  802f52:	eb 84                	jmp    802ed8 <devfile_flush+0x2e>
+
+0000000000802f54 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802f54:	55                   	push   %rbp
+  802f55:	48 89 e5             	mov    %rsp,%rbp
+  802f58:	41 55                	push   %r13
+  802f5a:	41 54                	push   %r12
+  802f5c:	53                   	push   %rbx
+  802f5d:	48 83 ec 08          	sub    $0x8,%rsp
+  802f61:	48 89 fb             	mov    %rdi,%rbx
+  802f64:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802f67:	48 b8 c5 29 80 00 00 	movabs $0x8029c5,%rax
+  802f6e:	00 00 00 
+  802f71:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f73:	48 85 c0             	test   %rax,%rax
+  802f76:	74 51                	je     802fc9 <devfile_trunc+0x75>
+  802f78:	49 89 c4             	mov    %rax,%r12
+  802f7b:	48 89 c6             	mov    %rax,%rsi
+  802f7e:	48 89 df             	mov    %rbx,%rdi
+  802f81:	48 b8 ed 2c 80 00 00 	movabs $0x802ced,%rax
+  802f88:	00 00 00 
+  802f8b:	ff d0                	call   *%rax
+  802f8d:	85 c0                	test   %eax,%eax
+  802f8f:	78 2d                	js     802fbe <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f91:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802f98:	00 00 00 
+  802f9b:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f9e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802fa0:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802fa4:	be 00 00 00 00       	mov    $0x0,%esi
+  802fa9:	bf 02 00 00 00       	mov    $0x2,%edi
+  802fae:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  802fb5:	00 00 00 
+  802fb8:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802fba:	85 c0                	test   %eax,%eax
+  802fbc:	79 3e                	jns    802ffc <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802fbe:	48 83 c4 08          	add    $0x8,%rsp
+  802fc2:	5b                   	pop    %rbx
+  802fc3:	41 5c                	pop    %r12
+  802fc5:	41 5d                	pop    %r13
+  802fc7:	5d                   	pop    %rbp
+  802fc8:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802fc9:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802fd0:	00 00 00 
+  802fd3:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802fd6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802fd8:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802fdc:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe1:	bf 02 00 00 00       	mov    $0x2,%edi
+  802fe6:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  802fed:	00 00 00 
+  802ff0:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ff2:	85 c0                	test   %eax,%eax
+  802ff4:	78 c8                	js     802fbe <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ff6:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ffa:	eb c2                	jmp    802fbe <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ffc:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802fff:	8d 51 01             	lea    0x1(%rcx),%edx
+  803002:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803005:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  80300a:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803011:	00 00 
+  803013:	eb a9                	jmp    802fbe <devfile_trunc+0x6a>
+
+0000000000803015 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803015:	55                   	push   %rbp
+  803016:	48 89 e5             	mov    %rsp,%rbp
+  803019:	41 57                	push   %r15
+  80301b:	41 56                	push   %r14
+  80301d:	41 55                	push   %r13
+  80301f:	41 54                	push   %r12
+  803021:	53                   	push   %rbx
+  803022:	48 83 ec 28          	sub    $0x28,%rsp
+  803026:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80302a:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80302e:	49 89 d7             	mov    %rdx,%r15
+  803031:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803035:	48 b8 c5 29 80 00 00 	movabs $0x8029c5,%rax
+  80303c:	00 00 00 
+  80303f:	ff d0                	call   *%rax
+  803041:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  803044:	48 85 c0             	test   %rax,%rax
+  803047:	74 31                	je     80307a <devfile_write+0x65>
+  803049:	4c 89 f8             	mov    %r15,%rax
+  80304c:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  803053:	77 25                	ja     80307a <devfile_write+0x65>
+    size_t i = 0;
+  803055:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  80305b:	48 85 c0             	test   %rax,%rax
+  80305e:	0f 85 64 01 00 00    	jne    8031c8 <devfile_write+0x1b3>
+    size_t i = 0;
+  803064:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  803068:	4c 89 f8             	mov    %r15,%rax
+}
+  80306b:	48 83 c4 28          	add    $0x28,%rsp
+  80306f:	5b                   	pop    %rbx
+  803070:	41 5c                	pop    %r12
+  803072:	41 5d                	pop    %r13
+  803074:	41 5e                	pop    %r14
+  803076:	41 5f                	pop    %r15
+  803078:	5d                   	pop    %rbp
+  803079:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80307a:	48 85 db             	test   %rbx,%rbx
+  80307d:	74 5b                	je     8030da <devfile_write+0xc5>
+  80307f:	48 89 de             	mov    %rbx,%rsi
+  803082:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803086:	48 b8 ed 2c 80 00 00 	movabs $0x802ced,%rax
+  80308d:	00 00 00 
+  803090:	ff d0                	call   *%rax
+  803092:	85 c0                	test   %eax,%eax
+  803094:	78 40                	js     8030d6 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803096:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80309a:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  80309d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8030a1:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8030a5:	48 b8 e2 2b 80 00 00 	movabs $0x802be2,%rax
+  8030ac:	00 00 00 
+  8030af:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8030b1:	48 85 c0             	test   %rax,%rax
+  8030b4:	7e b5                	jle    80306b <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8030b6:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8030ba:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  8030bd:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  8030c0:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  8030c3:	8d 51 01             	lea    0x1(%rcx),%edx
+  8030c6:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8030c9:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  8030cc:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8030d3:	00 
+  8030d4:	eb 95                	jmp    80306b <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8030d6:	48 98                	cltq
+  8030d8:	eb 91                	jmp    80306b <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  8030da:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8030de:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  8030e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8030e5:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8030e9:	48 89 df             	mov    %rbx,%rdi
+  8030ec:	48 b8 e2 2b 80 00 00 	movabs $0x802be2,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8030f8:	48 85 c0             	test   %rax,%rax
+  8030fb:	0f 8e 6a ff ff ff    	jle    80306b <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803101:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803104:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803108:	e9 5e ff ff ff       	jmp    80306b <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80310d:	48 98                	cltq
+  80310f:	4d 85 ff             	test   %r15,%r15
+  803112:	49 0f 45 c7          	cmovne %r15,%rax
+  803116:	e9 50 ff ff ff       	jmp    80306b <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80311b:	48 89 de             	mov    %rbx,%rsi
+  80311e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803122:	48 b8 ed 2c 80 00 00 	movabs $0x802ced,%rax
+  803129:	00 00 00 
+  80312c:	ff d0                	call   *%rax
+  80312e:	85 c0                	test   %eax,%eax
+  803130:	0f 88 2b 01 00 00    	js     803261 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803136:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80313a:	4c 01 f8             	add    %r15,%rax
+  80313d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803141:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803145:	48 b9 f1 21 80 00 00 	movabs $0x8021f1,%rcx
+  80314c:	00 00 00 
+  80314f:	ff d1                	call   *%rcx
+  803151:	48 89 c2             	mov    %rax,%rdx
+  803154:	48 c1 e2 04          	shl    $0x4,%rdx
+  803158:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80315c:	48 c1 e0 0c          	shl    $0xc,%rax
+  803160:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803165:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803168:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80316f:	00 
+  803170:	4c 89 ea             	mov    %r13,%rdx
+  803173:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803177:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  80317e:	00 00 00 
+  803181:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803183:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803187:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80318b:	48 39 c2             	cmp    %rax,%rdx
+  80318e:	0f 84 db 00 00 00    	je     80326f <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803194:	4c 39 e2             	cmp    %r12,%rdx
+  803197:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  80319b:	4d 01 ec             	add    %r13,%r12
+  80319e:	49 39 c4             	cmp    %rax,%r12
+  8031a1:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  8031a5:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  8031a9:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  8031ad:	45 01 ee             	add    %r13d,%r14d
+  8031b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031b4:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  8031b8:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  8031bb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8031bf:	49 39 c7             	cmp    %rax,%r15
+  8031c2:	0f 83 a0 fe ff ff    	jae    803068 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  8031c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031cc:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  8031d0:	8b 43 08             	mov    0x8(%rbx),%eax
+  8031d3:	44 39 f0             	cmp    %r14d,%eax
+  8031d6:	7f 10                	jg     8031e8 <devfile_write+0x1d3>
+  8031d8:	48 98                	cltq
+  8031da:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  8031e0:	49 63 d6             	movslq %r14d,%rdx
+  8031e3:	48 39 d0             	cmp    %rdx,%rax
+  8031e6:	7d 2d                	jge    803215 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8031e8:	48 89 de             	mov    %rbx,%rsi
+  8031eb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031ef:	48 b8 ed 2c 80 00 00 	movabs $0x802ced,%rax
+  8031f6:	00 00 00 
+  8031f9:	ff d0                	call   *%rax
+  8031fb:	85 c0                	test   %eax,%eax
+  8031fd:	0f 88 0a ff ff ff    	js     80310d <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803203:	44 89 f0             	mov    %r14d,%eax
+  803206:	66 b8 00 00          	mov    $0x0,%ax
+  80320a:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  80320d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803214:	00 
+        size_t off = pos - fb->fb_base;
+  803215:	45 89 f4             	mov    %r14d,%r12d
+  803218:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  80321c:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  80321f:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803223:	4d 29 fd             	sub    %r15,%r13
+  803226:	b8 00 00 01 00       	mov    $0x10000,%eax
+  80322b:	4c 29 e0             	sub    %r12,%rax
+  80322e:	49 39 c5             	cmp    %rax,%r13
+  803231:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803235:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803239:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80323d:	48 39 c2             	cmp    %rax,%rdx
+  803240:	0f 84 f0 fe ff ff    	je     803136 <devfile_write+0x121>
+  803246:	4c 39 e0             	cmp    %r12,%rax
+  803249:	0f 82 cc fe ff ff    	jb     80311b <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  80324f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803253:	48 39 d0             	cmp    %rdx,%rax
+  803256:	0f 83 da fe ff ff    	jae    803136 <devfile_write+0x121>
+  80325c:	e9 ba fe ff ff       	jmp    80311b <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803261:	48 98                	cltq
+  803263:	4d 85 ff             	test   %r15,%r15
+  803266:	49 0f 45 c7          	cmovne %r15,%rax
+  80326a:	e9 fc fd ff ff       	jmp    80306b <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  80326f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803273:	4c 89 e2             	mov    %r12,%rdx
+  803276:	e9 2a ff ff ff       	jmp    8031a5 <devfile_write+0x190>
+
+000000000080327b <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80327b:	55                   	push   %rbp
+  80327c:	48 89 e5             	mov    %rsp,%rbp
+  80327f:	41 57                	push   %r15
+  803281:	41 56                	push   %r14
+  803283:	41 55                	push   %r13
+  803285:	41 54                	push   %r12
+  803287:	53                   	push   %rbx
+  803288:	48 83 ec 28          	sub    $0x28,%rsp
+  80328c:	49 89 ff             	mov    %rdi,%r15
+  80328f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803293:	48 89 d3             	mov    %rdx,%rbx
+  803296:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  80329a:	48 b8 c5 29 80 00 00 	movabs $0x8029c5,%rax
+  8032a1:	00 00 00 
+  8032a4:	ff d0                	call   *%rax
+  8032a6:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8032a9:	48 85 c0             	test   %rax,%rax
+  8032ac:	74 0d                	je     8032bb <devfile_read+0x40>
+  8032ae:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8032b5:	0f 86 1a 01 00 00    	jbe    8033d5 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8032bb:	4d 85 e4             	test   %r12,%r12
+  8032be:	74 1a                	je     8032da <devfile_read+0x5f>
+  8032c0:	4c 89 e6             	mov    %r12,%rsi
+  8032c3:	4c 89 ff             	mov    %r15,%rdi
+  8032c6:	48 b8 ed 2c 80 00 00 	movabs $0x802ced,%rax
+  8032cd:	00 00 00 
+  8032d0:	ff d0                	call   *%rax
+  8032d2:	85 c0                	test   %eax,%eax
+  8032d4:	0f 88 e8 00 00 00    	js     8033c2 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8032da:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8032de:	48 b8 df 2a 80 00 00 	movabs $0x802adf,%rax
+  8032e5:	00 00 00 
+  8032e8:	ff d0                	call   *%rax
+  8032ea:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  8032ed:	48 85 c0             	test   %rax,%rax
+  8032f0:	0f 84 69 02 00 00    	je     80355f <devfile_read+0x2e4>
+    while (i < n) {
+  8032f6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8032fb:	0f 84 ce 00 00 00    	je     8033cf <devfile_read+0x154>
+    size_t i = 0;
+  803301:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803306:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80330d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803311:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803315:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803319:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80331d:	48 29 da             	sub    %rbx,%rdx
+  803320:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803325:	48 39 c2             	cmp    %rax,%rdx
+  803328:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  80332c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803330:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803334:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803337:	01 d8                	add    %ebx,%eax
+  803339:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  80333d:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803341:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803348:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80334f:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803356:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80335c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803361:	4c 89 ee             	mov    %r13,%rsi
+  803364:	bf 03 00 00 00       	mov    $0x3,%edi
+  803369:	48 b8 45 2b 80 00 00 	movabs $0x802b45,%rax
+  803370:	00 00 00 
+  803373:	ff d0                	call   *%rax
+        if (res < 0)
+  803375:	85 c0                	test   %eax,%eax
+  803377:	78 4d                	js     8033c6 <devfile_read+0x14b>
+        if (res == 0)
+  803379:	74 4f                	je     8033ca <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80337b:	4c 63 e0             	movslq %eax,%r12
+  80337e:	4c 89 e2             	mov    %r12,%rdx
+  803381:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803385:	4c 89 f7             	mov    %r14,%rdi
+  803388:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  80338f:	00 00 00 
+  803392:	ff d0                	call   *%rax
+        i += res;
+  803394:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803397:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  80339a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80339e:	48 39 c3             	cmp    %rax,%rbx
+  8033a1:	0f 82 72 ff ff ff    	jb     803319 <devfile_read+0x9e>
+    return i;
+  8033a7:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8033aa:	48 85 c0             	test   %rax,%rax
+  8033ad:	7e 04                	jle    8033b3 <devfile_read+0x138>
+  8033af:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8033b3:	48 83 c4 28          	add    $0x28,%rsp
+  8033b7:	5b                   	pop    %rbx
+  8033b8:	41 5c                	pop    %r12
+  8033ba:	41 5d                	pop    %r13
+  8033bc:	41 5e                	pop    %r14
+  8033be:	41 5f                	pop    %r15
+  8033c0:	5d                   	pop    %rbp
+  8033c1:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8033c2:	48 98                	cltq
+  8033c4:	eb ed                	jmp    8033b3 <devfile_read+0x138>
+            return res;
+  8033c6:	48 98                	cltq
+  8033c8:	eb e9                	jmp    8033b3 <devfile_read+0x138>
+            return i;
+  8033ca:	48 89 d8             	mov    %rbx,%rax
+  8033cd:	eb db                	jmp    8033aa <devfile_read+0x12f>
+    size_t i = 0;
+  8033cf:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8033d3:	eb d2                	jmp    8033a7 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8033d5:	48 89 c6             	mov    %rax,%rsi
+  8033d8:	4c 89 ff             	mov    %r15,%rdi
+  8033db:	48 b8 ed 2c 80 00 00 	movabs $0x802ced,%rax
+  8033e2:	00 00 00 
+  8033e5:	ff d0                	call   *%rax
+  8033e7:	85 c0                	test   %eax,%eax
+  8033e9:	78 40                	js     80342b <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8033eb:	4c 89 ff             	mov    %r15,%rdi
+  8033ee:	48 b8 f1 21 80 00 00 	movabs $0x8021f1,%rax
+  8033f5:	00 00 00 
+  8033f8:	ff d0                	call   *%rax
+  8033fa:	48 89 c2             	mov    %rax,%rdx
+  8033fd:	48 c1 e2 04          	shl    $0x4,%rdx
+  803401:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803405:	48 c1 e0 0c          	shl    $0xc,%rax
+  803409:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80340e:	48 01 d0             	add    %rdx,%rax
+  803411:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803415:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80341a:	0f 84 33 01 00 00    	je     803553 <devfile_read+0x2d8>
+    size_t i = 0;
+  803420:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803426:	e9 f5 00 00 00       	jmp    803520 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80342b:	48 98                	cltq
+  80342d:	eb 84                	jmp    8033b3 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80342f:	44 89 e8             	mov    %r13d,%eax
+  803432:	66 b8 00 00          	mov    $0x0,%ax
+  803436:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  80343b:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803442:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803444:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803448:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80344c:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  80344e:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803453:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803456:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  80345d:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  80345e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803464:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803469:	ba 00 10 01 00       	mov    $0x11000,%edx
+  80346e:	bf 03 00 00 00       	mov    $0x3,%edi
+  803473:	48 b8 45 2b 80 00 00 	movabs $0x802b45,%rax
+  80347a:	00 00 00 
+  80347d:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  80347f:	85 c0                	test   %eax,%eax
+  803481:	0f 88 be 00 00 00    	js     803545 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803487:	48 63 d0             	movslq %eax,%rdx
+  80348a:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  80348f:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803494:	44 39 e8             	cmp    %r13d,%eax
+  803497:	0f 8e ba 00 00 00    	jle    803557 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80349d:	49 63 c5             	movslq %r13d,%rax
+  8034a0:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8034a5:	48 29 c3             	sub    %rax,%rbx
+  8034a8:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8034ad:	48 01 c3             	add    %rax,%rbx
+  8034b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034b4:	4c 29 f0             	sub    %r14,%rax
+  8034b7:	48 39 c3             	cmp    %rax,%rbx
+  8034ba:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8034be:	4c 89 ff             	mov    %r15,%rdi
+  8034c1:	48 b9 f1 21 80 00 00 	movabs $0x8021f1,%rcx
+  8034c8:	00 00 00 
+  8034cb:	ff d1                	call   *%rcx
+  8034cd:	48 89 c2             	mov    %rax,%rdx
+  8034d0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8034d4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8034d8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8034dc:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8034e1:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8034e4:	44 89 ea             	mov    %r13d,%edx
+  8034e7:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8034ec:	48 63 d2             	movslq %edx,%rdx
+  8034ef:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8034f6:	00 
+  8034f7:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8034fb:	4c 01 f7             	add    %r14,%rdi
+  8034fe:	48 89 da             	mov    %rbx,%rdx
+  803501:	48 b9 f6 12 80 00 00 	movabs $0x8012f6,%rcx
+  803508:	00 00 00 
+  80350b:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80350d:	41 01 dd             	add    %ebx,%r13d
+  803510:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803514:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803517:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80351b:	49 39 c6             	cmp    %rax,%r14
+  80351e:	73 37                	jae    803557 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803520:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803524:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803529:	44 39 e8             	cmp    %r13d,%eax
+  80352c:	0f 8f fd fe ff ff    	jg     80342f <devfile_read+0x1b4>
+  803532:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803537:	44 39 e8             	cmp    %r13d,%eax
+  80353a:	0f 8f 5d ff ff ff    	jg     80349d <devfile_read+0x222>
+  803540:	e9 ea fe ff ff       	jmp    80342f <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803545:	48 98                	cltq
+  803547:	4d 85 f6             	test   %r14,%r14
+  80354a:	49 0f 45 c6          	cmovne %r14,%rax
+  80354e:	e9 60 fe ff ff       	jmp    8033b3 <devfile_read+0x138>
+    size_t i = 0;
+  803553:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803557:	4c 89 f0             	mov    %r14,%rax
+  80355a:	e9 54 fe ff ff       	jmp    8033b3 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80355f:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803566:	e9 48 fe ff ff       	jmp    8033b3 <devfile_read+0x138>
+
+000000000080356b <open>:
+open(const char *path, int mode) {
+  80356b:	55                   	push   %rbp
+  80356c:	48 89 e5             	mov    %rsp,%rbp
+  80356f:	41 55                	push   %r13
+  803571:	41 54                	push   %r12
+  803573:	53                   	push   %rbx
+  803574:	48 83 ec 18          	sub    $0x18,%rsp
+  803578:	49 89 fc             	mov    %rdi,%r12
+  80357b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80357e:	48 b8 c3 0e 80 00 00 	movabs $0x800ec3,%rax
+  803585:	00 00 00 
+  803588:	ff d0                	call   *%rax
+  80358a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803590:	0f 87 8a 00 00 00    	ja     803620 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803596:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80359a:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  8035a1:	00 00 00 
+  8035a4:	ff d0                	call   *%rax
+  8035a6:	89 c3                	mov    %eax,%ebx
+  8035a8:	85 c0                	test   %eax,%eax
+  8035aa:	78 50                	js     8035fc <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8035ac:	4c 89 e6             	mov    %r12,%rsi
+  8035af:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8035b6:	00 00 00 
+  8035b9:	48 89 df             	mov    %rbx,%rdi
+  8035bc:	48 b8 01 0f 80 00 00 	movabs $0x800f01,%rax
+  8035c3:	00 00 00 
+  8035c6:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8035c8:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8035cf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8035d3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035d8:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  8035df:	00 00 00 
+  8035e2:	ff d0                	call   *%rax
+  8035e4:	89 c3                	mov    %eax,%ebx
+  8035e6:	85 c0                	test   %eax,%eax
+  8035e8:	78 1f                	js     803609 <open+0x9e>
+    return fd2num(fd);
+  8035ea:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035ee:	48 b8 f1 21 80 00 00 	movabs $0x8021f1,%rax
+  8035f5:	00 00 00 
+  8035f8:	ff d0                	call   *%rax
+  8035fa:	89 c3                	mov    %eax,%ebx
+}
+  8035fc:	89 d8                	mov    %ebx,%eax
+  8035fe:	48 83 c4 18          	add    $0x18,%rsp
+  803602:	5b                   	pop    %rbx
+  803603:	41 5c                	pop    %r12
+  803605:	41 5d                	pop    %r13
+  803607:	5d                   	pop    %rbp
+  803608:	c3                   	ret
+        fd_close(fd, 0);
+  803609:	be 00 00 00 00       	mov    $0x0,%esi
+  80360e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803612:	48 b8 3a 23 80 00 00 	movabs $0x80233a,%rax
+  803619:	00 00 00 
+  80361c:	ff d0                	call   *%rax
+        return res;
+  80361e:	eb dc                	jmp    8035fc <open+0x91>
+        return -E_BAD_PATH;
+  803620:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803625:	eb d5                	jmp    8035fc <open+0x91>
+
+0000000000803627 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803627:	55                   	push   %rbp
+  803628:	48 89 e5             	mov    %rsp,%rbp
+  80362b:	41 57                	push   %r15
+  80362d:	41 56                	push   %r14
+  80362f:	41 55                	push   %r13
+  803631:	41 54                	push   %r12
+  803633:	53                   	push   %rbx
+  803634:	48 83 ec 18          	sub    $0x18,%rsp
+  803638:	41 89 f6             	mov    %esi,%r14d
+  80363b:	49 89 d7             	mov    %rdx,%r15
+  80363e:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803641:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803645:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  80364c:	00 00 00 
+  80364f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803651:	85 c0                	test   %eax,%eax
+  803653:	0f 88 db 00 00 00    	js     803734 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803659:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80365d:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803664:	00 00 00 
+  803667:	8b 00                	mov    (%rax),%eax
+  803669:	39 07                	cmp    %eax,(%rdi)
+  80366b:	0f 85 db 00 00 00    	jne    80374c <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803671:	45 85 f6             	test   %r14d,%r14d
+  803674:	0f 88 db 00 00 00    	js     803755 <fmap+0x12e>
+  80367a:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803681:	0f 85 d7 00 00 00    	jne    80375e <fmap+0x137>
+  803687:	4c 89 fb             	mov    %r15,%rbx
+  80368a:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803690:	0f 85 d1 00 00 00    	jne    803767 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803696:	48 b8 b7 2d 80 00 00 	movabs $0x802db7,%rax
+  80369d:	00 00 00 
+  8036a0:	ff d0                	call   *%rax
+  8036a2:	85 c0                	test   %eax,%eax
+  8036a4:	0f 88 8e 00 00 00    	js     803738 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8036aa:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8036b1:	00 00 00 
+    while (i < n) {
+  8036b4:	4d 85 ed             	test   %r13,%r13
+  8036b7:	0f 84 8a 00 00 00    	je     803747 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8036bd:	4c 89 ea             	mov    %r13,%rdx
+  8036c0:	48 29 da             	sub    %rbx,%rdx
+  8036c3:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8036ca:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8036d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8036d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036d8:	8b 40 0c             	mov    0xc(%rax),%eax
+  8036db:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8036df:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8036e3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8036e8:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8036ed:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8036f1:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8036f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036fa:	4c 89 e6             	mov    %r12,%rsi
+  8036fd:	bf 09 00 00 00       	mov    $0x9,%edi
+  803702:	48 b8 45 2b 80 00 00 	movabs $0x802b45,%rax
+  803709:	00 00 00 
+  80370c:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80370e:	85 c0                	test   %eax,%eax
+  803710:	78 2a                	js     80373c <fmap+0x115>
+        i += res;
+  803712:	48 98                	cltq
+  803714:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803717:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  80371b:	72 05                	jb     803722 <fmap+0xfb>
+    while (i < n) {
+  80371d:	4c 39 eb             	cmp    %r13,%rbx
+  803720:	72 9b                	jb     8036bd <fmap+0x96>
+    }
+    return i;
+  803722:	48 89 d8             	mov    %rbx,%rax
+}
+  803725:	48 83 c4 18          	add    $0x18,%rsp
+  803729:	5b                   	pop    %rbx
+  80372a:	41 5c                	pop    %r12
+  80372c:	41 5d                	pop    %r13
+  80372e:	41 5e                	pop    %r14
+  803730:	41 5f                	pop    %r15
+  803732:	5d                   	pop    %rbp
+  803733:	c3                   	ret
+    if (res < 0) return res;
+  803734:	48 98                	cltq
+  803736:	eb ed                	jmp    803725 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803738:	48 98                	cltq
+  80373a:	eb e9                	jmp    803725 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  80373c:	48 98                	cltq
+  80373e:	48 85 db             	test   %rbx,%rbx
+  803741:	48 0f 45 c3          	cmovne %rbx,%rax
+  803745:	eb de                	jmp    803725 <fmap+0xfe>
+    size_t i = 0;
+  803747:	4c 89 eb             	mov    %r13,%rbx
+  80374a:	eb d6                	jmp    803722 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80374c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803753:	eb d0                	jmp    803725 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803755:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80375c:	eb c7                	jmp    803725 <fmap+0xfe>
+  80375e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803765:	eb be                	jmp    803725 <fmap+0xfe>
+  803767:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80376e:	eb b5                	jmp    803725 <fmap+0xfe>
+
+0000000000803770 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803770:	55                   	push   %rbp
+  803771:	48 89 e5             	mov    %rsp,%rbp
+  803774:	41 56                	push   %r14
+  803776:	41 55                	push   %r13
+  803778:	41 54                	push   %r12
+  80377a:	53                   	push   %rbx
+  80377b:	48 83 ec 10          	sub    $0x10,%rsp
+  80377f:	89 fb                	mov    %edi,%ebx
+  803781:	41 89 f4             	mov    %esi,%r12d
+  803784:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803787:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80378b:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  803792:	00 00 00 
+  803795:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803797:	85 c0                	test   %eax,%eax
+  803799:	78 63                	js     8037fe <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80379b:	45 85 e4             	test   %r12d,%r12d
+  80379e:	0f 88 80 00 00 00    	js     803824 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8037a4:	45 89 e6             	mov    %r12d,%r14d
+  8037a7:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8037ae:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8037b2:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  8037b9:	00 00 00 
+  8037bc:	ff d0                	call   *%rax
+  8037be:	48 89 c2             	mov    %rax,%rdx
+  8037c1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8037c6:	44 89 f6             	mov    %r14d,%esi
+  8037c9:	89 df                	mov    %ebx,%edi
+  8037cb:	48 b8 27 36 80 00 00 	movabs $0x803627,%rax
+  8037d2:	00 00 00 
+  8037d5:	ff d0                	call   *%rax
+  8037d7:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8037da:	45 29 f4             	sub    %r14d,%r12d
+  8037dd:	4d 63 f4             	movslq %r12d,%r14
+  8037e0:	49 39 c6             	cmp    %rax,%r14
+  8037e3:	7c 1d                	jl     803802 <read_map+0x92>
+  8037e5:	48 85 c0             	test   %rax,%rax
+  8037e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ed:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8037f1:	48 83 c4 10          	add    $0x10,%rsp
+  8037f5:	5b                   	pop    %rbx
+  8037f6:	41 5c                	pop    %r12
+  8037f8:	41 5d                	pop    %r13
+  8037fa:	41 5e                	pop    %r14
+  8037fc:	5d                   	pop    %rbp
+  8037fd:	c3                   	ret
+    if (res < 0) return res;
+  8037fe:	48 98                	cltq
+  803800:	eb ef                	jmp    8037f1 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803802:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803806:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  80380d:	00 00 00 
+  803810:	ff d0                	call   *%rax
+  803812:	4d 63 e4             	movslq %r12d,%r12
+  803815:	4c 01 e0             	add    %r12,%rax
+  803818:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  80381c:	48 89 d8             	mov    %rbx,%rax
+  80381f:	4c 29 f0             	sub    %r14,%rax
+  803822:	eb cd                	jmp    8037f1 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803824:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80382b:	eb c4                	jmp    8037f1 <read_map+0x81>
+
+000000000080382d <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  80382d:	55                   	push   %rbp
+  80382e:	48 89 e5             	mov    %rsp,%rbp
+  803831:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803835:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803839:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  803840:	00 00 00 
+  803843:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803845:	85 c0                	test   %eax,%eax
+  803847:	78 4a                	js     803893 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803849:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80384d:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803854:	00 00 00 
+  803857:	8b 00                	mov    (%rax),%eax
+  803859:	39 07                	cmp    %eax,(%rdi)
+  80385b:	75 38                	jne    803895 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80385d:	48 b8 b7 2d 80 00 00 	movabs $0x802db7,%rax
+  803864:	00 00 00 
+  803867:	ff d0                	call   *%rax
+  803869:	85 c0                	test   %eax,%eax
+  80386b:	78 26                	js     803893 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80386d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803871:	8b 40 0c             	mov    0xc(%rax),%eax
+  803874:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80387b:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80387d:	be 00 00 00 00       	mov    $0x0,%esi
+  803882:	bf 06 00 00 00       	mov    $0x6,%edi
+  803887:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  80388e:	00 00 00 
+  803891:	ff d0                	call   *%rax
+}
+  803893:	c9                   	leave
+  803894:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803895:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80389a:	eb f7                	jmp    803893 <fsync+0x66>
+
+000000000080389c <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80389c:	55                   	push   %rbp
+  80389d:	48 89 e5             	mov    %rsp,%rbp
+  8038a0:	41 57                	push   %r15
+  8038a2:	41 56                	push   %r14
+  8038a4:	41 55                	push   %r13
+  8038a6:	41 54                	push   %r12
+  8038a8:	53                   	push   %rbx
+  8038a9:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8038ad:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8038b4:	00 00 00 
+  8038b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8038bc:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8038c2:	49 bd 7f 22 80 00 00 	movabs $0x80227f,%r13
+  8038c9:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8038cc:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8038d3:	00 00 00 
+  8038d6:	eb 0c                	jmp    8038e4 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8038d8:	83 c3 01             	add    $0x1,%ebx
+  8038db:	49 83 c4 28          	add    $0x28,%r12
+  8038df:	83 fb 20             	cmp    $0x20,%ebx
+  8038e2:	74 33                	je     803917 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8038e4:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8038e9:	74 ed                	je     8038d8 <flushall+0x3c>
+  8038eb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8038ef:	89 df                	mov    %ebx,%edi
+  8038f1:	41 ff d5             	call   *%r13
+  8038f4:	85 c0                	test   %eax,%eax
+  8038f6:	78 e0                	js     8038d8 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8038f8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8038fc:	41 8b 06             	mov    (%r14),%eax
+  8038ff:	39 07                	cmp    %eax,(%rdi)
+  803901:	75 d5                	jne    8038d8 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803903:	48 b8 b7 2d 80 00 00 	movabs $0x802db7,%rax
+  80390a:	00 00 00 
+  80390d:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80390f:	85 c0                	test   %eax,%eax
+  803911:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803915:	eb c1                	jmp    8038d8 <flushall+0x3c>
+    }
+    return res;
+}
+  803917:	44 89 f8             	mov    %r15d,%eax
+  80391a:	48 83 c4 18          	add    $0x18,%rsp
+  80391e:	5b                   	pop    %rbx
+  80391f:	41 5c                	pop    %r12
+  803921:	41 5d                	pop    %r13
+  803923:	41 5e                	pop    %r14
+  803925:	41 5f                	pop    %r15
+  803927:	5d                   	pop    %rbp
+  803928:	c3                   	ret
+
+0000000000803929 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803929:	55                   	push   %rbp
+  80392a:	48 89 e5             	mov    %rsp,%rbp
+  80392d:	53                   	push   %rbx
+  80392e:	48 83 ec 08          	sub    $0x8,%rsp
+  803932:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803935:	40 0f b6 c6          	movzbl %sil,%eax
+  803939:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803940:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803942:	be 00 00 00 00       	mov    $0x0,%esi
+  803947:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80394c:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  803953:	00 00 00 
+  803956:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803958:	85 c0                	test   %eax,%eax
+  80395a:	78 23                	js     80397f <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80395c:	ba 58 06 00 00       	mov    $0x658,%edx
+  803961:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803968:	00 00 00 
+  80396b:	48 89 df             	mov    %rbx,%rdi
+  80396e:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  803975:	00 00 00 
+  803978:	ff d0                	call   *%rax
+    return 0;
+  80397a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80397f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803983:	c9                   	leave
+  803984:	c3                   	ret
+
+0000000000803985 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803985:	55                   	push   %rbp
+  803986:	48 89 e5             	mov    %rsp,%rbp
+  803989:	53                   	push   %rbx
+  80398a:	48 83 ec 08          	sub    $0x8,%rsp
+  80398e:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803991:	48 b8 c3 0e 80 00 00 	movabs $0x800ec3,%rax
+  803998:	00 00 00 
+  80399b:	ff d0                	call   *%rax
+  80399d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039a3:	77 35                	ja     8039da <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8039a5:	48 89 de             	mov    %rbx,%rsi
+  8039a8:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8039af:	00 00 00 
+  8039b2:	48 b8 01 0f 80 00 00 	movabs $0x800f01,%rax
+  8039b9:	00 00 00 
+  8039bc:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8039be:	be 00 00 00 00       	mov    $0x0,%esi
+  8039c3:	bf 07 00 00 00       	mov    $0x7,%edi
+  8039c8:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  8039cf:	00 00 00 
+  8039d2:	ff d0                	call   *%rax
+}
+  8039d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039d8:	c9                   	leave
+  8039d9:	c3                   	ret
+        return -E_BAD_PATH;
+  8039da:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8039df:	eb f3                	jmp    8039d4 <remove+0x4f>
+
+00000000008039e1 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8039e1:	55                   	push   %rbp
+  8039e2:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8039e5:	48 b8 9c 38 80 00 00 	movabs $0x80389c,%rax
+  8039ec:	00 00 00 
+  8039ef:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8039f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8039f6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8039fb:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  803a02:	00 00 00 
+  803a05:	ff d0                	call   *%rax
+}
+  803a07:	5d                   	pop    %rbp
+  803a08:	c3                   	ret
+
+0000000000803a09 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803a09:	55                   	push   %rbp
+  803a0a:	48 89 e5             	mov    %rsp,%rbp
+  803a0d:	41 54                	push   %r12
+  803a0f:	53                   	push   %rbx
+  803a10:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a13:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  803a1a:	00 00 00 
+  803a1d:	ff d0                	call   *%rax
+  803a1f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803a22:	48 be 60 58 80 00 00 	movabs $0x805860,%rsi
+  803a29:	00 00 00 
+  803a2c:	48 89 df             	mov    %rbx,%rdi
+  803a2f:	48 b8 01 0f 80 00 00 	movabs $0x800f01,%rax
+  803a36:	00 00 00 
+  803a39:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803a3b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803a40:	41 2b 04 24          	sub    (%r12),%eax
+  803a44:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803a4a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a51:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a54:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803a5b:	00 00 00 
+  803a5e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a6a:	5b                   	pop    %rbx
+  803a6b:	41 5c                	pop    %r12
+  803a6d:	5d                   	pop    %rbp
+  803a6e:	c3                   	ret
+
+0000000000803a6f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a6f:	55                   	push   %rbp
+  803a70:	48 89 e5             	mov    %rsp,%rbp
+  803a73:	41 54                	push   %r12
+  803a75:	53                   	push   %rbx
+  803a76:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a79:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a7e:	48 89 fe             	mov    %rdi,%rsi
+  803a81:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a86:	49 bc 40 18 80 00 00 	movabs $0x801840,%r12
+  803a8d:	00 00 00 
+  803a90:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803a93:	48 89 df             	mov    %rbx,%rdi
+  803a96:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  803a9d:	00 00 00 
+  803aa0:	ff d0                	call   *%rax
+  803aa2:	48 89 c6             	mov    %rax,%rsi
+  803aa5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aaf:	41 ff d4             	call   *%r12
+}
+  803ab2:	5b                   	pop    %rbx
+  803ab3:	41 5c                	pop    %r12
+  803ab5:	5d                   	pop    %rbp
+  803ab6:	c3                   	ret
+
+0000000000803ab7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803ab7:	55                   	push   %rbp
+  803ab8:	48 89 e5             	mov    %rsp,%rbp
+  803abb:	41 57                	push   %r15
+  803abd:	41 56                	push   %r14
+  803abf:	41 55                	push   %r13
+  803ac1:	41 54                	push   %r12
+  803ac3:	53                   	push   %rbx
+  803ac4:	48 83 ec 18          	sub    $0x18,%rsp
+  803ac8:	49 89 fc             	mov    %rdi,%r12
+  803acb:	49 89 f5             	mov    %rsi,%r13
+  803ace:	49 89 d7             	mov    %rdx,%r15
+  803ad1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ad5:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  803adc:	00 00 00 
+  803adf:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803ae1:	4d 85 ff             	test   %r15,%r15
+  803ae4:	0f 84 af 00 00 00    	je     803b99 <devpipe_write+0xe2>
+  803aea:	48 89 c3             	mov    %rax,%rbx
+  803aed:	4c 89 f8             	mov    %r15,%rax
+  803af0:	4d 89 ef             	mov    %r13,%r15
+  803af3:	4c 01 e8             	add    %r13,%rax
+  803af6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803afa:	49 bd 35 16 80 00 00 	movabs $0x801635,%r13
+  803b01:	00 00 00 
+            sys_yield();
+  803b04:	49 be d2 15 80 00 00 	movabs $0x8015d2,%r14
+  803b0b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b0e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b11:	48 63 ce             	movslq %esi,%rcx
+  803b14:	48 63 03             	movslq (%rbx),%rax
+  803b17:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803b1d:	48 39 c1             	cmp    %rax,%rcx
+  803b20:	72 2e                	jb     803b50 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b22:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b27:	48 89 da             	mov    %rbx,%rdx
+  803b2a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b2f:	4c 89 e7             	mov    %r12,%rdi
+  803b32:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b35:	85 c0                	test   %eax,%eax
+  803b37:	74 66                	je     803b9f <devpipe_write+0xe8>
+            sys_yield();
+  803b39:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b3c:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b3f:	48 63 ce             	movslq %esi,%rcx
+  803b42:	48 63 03             	movslq (%rbx),%rax
+  803b45:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803b4b:	48 39 c1             	cmp    %rax,%rcx
+  803b4e:	73 d2                	jae    803b22 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803b50:	41 0f b6 3f          	movzbl (%r15),%edi
+  803b54:	48 89 ca             	mov    %rcx,%rdx
+  803b57:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b5b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803b62:	08 10 20 
+  803b65:	48 f7 e2             	mul    %rdx
+  803b68:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b6c:	48 89 d0             	mov    %rdx,%rax
+  803b6f:	48 c1 e0 09          	shl    $0x9,%rax
+  803b73:	48 29 d0             	sub    %rdx,%rax
+  803b76:	48 c1 e0 03          	shl    $0x3,%rax
+  803b7a:	48 29 c1             	sub    %rax,%rcx
+  803b7d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803b82:	83 c6 01             	add    $0x1,%esi
+  803b85:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b88:	49 83 c7 01          	add    $0x1,%r15
+  803b8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b90:	49 39 c7             	cmp    %rax,%r15
+  803b93:	0f 85 75 ff ff ff    	jne    803b0e <devpipe_write+0x57>
+    return n;
+  803b99:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b9d:	eb 05                	jmp    803ba4 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ba4:	48 83 c4 18          	add    $0x18,%rsp
+  803ba8:	5b                   	pop    %rbx
+  803ba9:	41 5c                	pop    %r12
+  803bab:	41 5d                	pop    %r13
+  803bad:	41 5e                	pop    %r14
+  803baf:	41 5f                	pop    %r15
+  803bb1:	5d                   	pop    %rbp
+  803bb2:	c3                   	ret
+
+0000000000803bb3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803bb3:	55                   	push   %rbp
+  803bb4:	48 89 e5             	mov    %rsp,%rbp
+  803bb7:	41 57                	push   %r15
+  803bb9:	41 56                	push   %r14
+  803bbb:	41 55                	push   %r13
+  803bbd:	41 54                	push   %r12
+  803bbf:	53                   	push   %rbx
+  803bc0:	48 83 ec 18          	sub    $0x18,%rsp
+  803bc4:	49 89 fc             	mov    %rdi,%r12
+  803bc7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803bcb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803bcf:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  803bd6:	00 00 00 
+  803bd9:	ff d0                	call   *%rax
+  803bdb:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803bde:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803be4:	49 bd 35 16 80 00 00 	movabs $0x801635,%r13
+  803beb:	00 00 00 
+            sys_yield();
+  803bee:	49 be d2 15 80 00 00 	movabs $0x8015d2,%r14
+  803bf5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803bf8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803bfd:	74 7d                	je     803c7c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803bff:	8b 03                	mov    (%rbx),%eax
+  803c01:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c04:	75 26                	jne    803c2c <devpipe_read+0x79>
+            if (i > 0) return i;
+  803c06:	4d 85 ff             	test   %r15,%r15
+  803c09:	75 77                	jne    803c82 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803c0b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c10:	48 89 da             	mov    %rbx,%rdx
+  803c13:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c18:	4c 89 e7             	mov    %r12,%rdi
+  803c1b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803c1e:	85 c0                	test   %eax,%eax
+  803c20:	74 72                	je     803c94 <devpipe_read+0xe1>
+            sys_yield();
+  803c22:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803c25:	8b 03                	mov    (%rbx),%eax
+  803c27:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c2a:	74 df                	je     803c0b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803c2c:	48 63 c8             	movslq %eax,%rcx
+  803c2f:	48 89 ca             	mov    %rcx,%rdx
+  803c32:	48 c1 ea 03          	shr    $0x3,%rdx
+  803c36:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803c3d:	08 10 20 
+  803c40:	48 89 d0             	mov    %rdx,%rax
+  803c43:	48 f7 e6             	mul    %rsi
+  803c46:	48 c1 ea 06          	shr    $0x6,%rdx
+  803c4a:	48 89 d0             	mov    %rdx,%rax
+  803c4d:	48 c1 e0 09          	shl    $0x9,%rax
+  803c51:	48 29 d0             	sub    %rdx,%rax
+  803c54:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803c5b:	00 
+  803c5c:	48 89 c8             	mov    %rcx,%rax
+  803c5f:	48 29 d0             	sub    %rdx,%rax
+  803c62:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803c67:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803c6b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803c6f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c72:	49 83 c7 01          	add    $0x1,%r15
+  803c76:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803c7a:	75 83                	jne    803bff <devpipe_read+0x4c>
+    return n;
+  803c7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c80:	eb 03                	jmp    803c85 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803c82:	4c 89 f8             	mov    %r15,%rax
+}
+  803c85:	48 83 c4 18          	add    $0x18,%rsp
+  803c89:	5b                   	pop    %rbx
+  803c8a:	41 5c                	pop    %r12
+  803c8c:	41 5d                	pop    %r13
+  803c8e:	41 5e                	pop    %r14
+  803c90:	41 5f                	pop    %r15
+  803c92:	5d                   	pop    %rbp
+  803c93:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c99:	eb ea                	jmp    803c85 <devpipe_read+0xd2>
+
+0000000000803c9b <pipe>:
+pipe(int pfd[2]) {
+  803c9b:	55                   	push   %rbp
+  803c9c:	48 89 e5             	mov    %rsp,%rbp
+  803c9f:	41 55                	push   %r13
+  803ca1:	41 54                	push   %r12
+  803ca3:	53                   	push   %rbx
+  803ca4:	48 83 ec 18          	sub    $0x18,%rsp
+  803ca8:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803cab:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803caf:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  803cb6:	00 00 00 
+  803cb9:	ff d0                	call   *%rax
+  803cbb:	89 c3                	mov    %eax,%ebx
+  803cbd:	85 c0                	test   %eax,%eax
+  803cbf:	0f 88 a0 01 00 00    	js     803e65 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803cc5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ccf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803cd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd8:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  803cdf:	00 00 00 
+  803ce2:	ff d0                	call   *%rax
+  803ce4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ce6:	85 c0                	test   %eax,%eax
+  803ce8:	0f 88 77 01 00 00    	js     803e65 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803cee:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803cf2:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  803cf9:	00 00 00 
+  803cfc:	ff d0                	call   *%rax
+  803cfe:	89 c3                	mov    %eax,%ebx
+  803d00:	85 c0                	test   %eax,%eax
+  803d02:	0f 88 43 01 00 00    	js     803e4b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803d08:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d0d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d12:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d16:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d1b:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  803d22:	00 00 00 
+  803d25:	ff d0                	call   *%rax
+  803d27:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803d29:	85 c0                	test   %eax,%eax
+  803d2b:	0f 88 1a 01 00 00    	js     803e4b <pipe+0x1b0>
+    va = fd2data(fd0);
+  803d31:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d35:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  803d3c:	00 00 00 
+  803d3f:	ff d0                	call   *%rax
+  803d41:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803d44:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d4e:	48 89 c6             	mov    %rax,%rsi
+  803d51:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d56:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  803d5d:	00 00 00 
+  803d60:	ff d0                	call   *%rax
+  803d62:	89 c3                	mov    %eax,%ebx
+  803d64:	85 c0                	test   %eax,%eax
+  803d66:	0f 88 c5 00 00 00    	js     803e31 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803d6c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d70:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  803d77:	00 00 00 
+  803d7a:	ff d0                	call   *%rax
+  803d7c:	48 89 c1             	mov    %rax,%rcx
+  803d7f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803d85:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803d8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d90:	4c 89 ee             	mov    %r13,%rsi
+  803d93:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d98:	48 b8 c8 16 80 00 00 	movabs $0x8016c8,%rax
+  803d9f:	00 00 00 
+  803da2:	ff d0                	call   *%rax
+  803da4:	89 c3                	mov    %eax,%ebx
+  803da6:	85 c0                	test   %eax,%eax
+  803da8:	78 6e                	js     803e18 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803daa:	be 00 10 00 00       	mov    $0x1000,%esi
+  803daf:	4c 89 ef             	mov    %r13,%rdi
+  803db2:	48 b8 03 16 80 00 00 	movabs $0x801603,%rax
+  803db9:	00 00 00 
+  803dbc:	ff d0                	call   *%rax
+  803dbe:	83 f8 02             	cmp    $0x2,%eax
+  803dc1:	0f 85 ab 00 00 00    	jne    803e72 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803dc7:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803dce:	00 00 
+  803dd0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803dd4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803dd6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803dda:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803de1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803de5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803de7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803deb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803df2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803df6:	48 bb f1 21 80 00 00 	movabs $0x8021f1,%rbx
+  803dfd:	00 00 00 
+  803e00:	ff d3                	call   *%rbx
+  803e02:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803e06:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e0a:	ff d3                	call   *%rbx
+  803e0c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803e11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e16:	eb 4d                	jmp    803e65 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803e18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e1d:	4c 89 ee             	mov    %r13,%rsi
+  803e20:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e25:	48 b8 40 18 80 00 00 	movabs $0x801840,%rax
+  803e2c:	00 00 00 
+  803e2f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803e31:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e36:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e3f:	48 b8 40 18 80 00 00 	movabs $0x801840,%rax
+  803e46:	00 00 00 
+  803e49:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803e4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e50:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e54:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e59:	48 b8 40 18 80 00 00 	movabs $0x801840,%rax
+  803e60:	00 00 00 
+  803e63:	ff d0                	call   *%rax
+}
+  803e65:	89 d8                	mov    %ebx,%eax
+  803e67:	48 83 c4 18          	add    $0x18,%rsp
+  803e6b:	5b                   	pop    %rbx
+  803e6c:	41 5c                	pop    %r12
+  803e6e:	41 5d                	pop    %r13
+  803e70:	5d                   	pop    %rbp
+  803e71:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e72:	48 b9 90 58 80 00 00 	movabs $0x805890,%rcx
+  803e79:	00 00 00 
+  803e7c:	48 ba 67 58 80 00 00 	movabs $0x805867,%rdx
+  803e83:	00 00 00 
+  803e86:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803e8b:	48 bf 7c 58 80 00 00 	movabs $0x80587c,%rdi
+  803e92:	00 00 00 
+  803e95:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e9a:	49 b8 7a 44 80 00 00 	movabs $0x80447a,%r8
+  803ea1:	00 00 00 
+  803ea4:	41 ff d0             	call   *%r8
+
+0000000000803ea7 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803ea7:	55                   	push   %rbp
+  803ea8:	48 89 e5             	mov    %rsp,%rbp
+  803eab:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803eaf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803eb3:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  803eba:	00 00 00 
+  803ebd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ebf:	85 c0                	test   %eax,%eax
+  803ec1:	78 35                	js     803ef8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803ec3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ec7:	48 b8 03 22 80 00 00 	movabs $0x802203,%rax
+  803ece:	00 00 00 
+  803ed1:	ff d0                	call   *%rax
+  803ed3:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ed6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803edb:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ee0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ee4:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  803eeb:	00 00 00 
+  803eee:	ff d0                	call   *%rax
+  803ef0:	85 c0                	test   %eax,%eax
+  803ef2:	0f 94 c0             	sete   %al
+  803ef5:	0f b6 c0             	movzbl %al,%eax
+}
+  803ef8:	c9                   	leave
+  803ef9:	c3                   	ret
+
+0000000000803efa <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803efa:	48 89 f8             	mov    %rdi,%rax
+  803efd:	48 c1 e8 27          	shr    $0x27,%rax
+  803f01:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803f08:	7f 00 00 
+  803f0b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f0f:	f6 c2 01             	test   $0x1,%dl
+  803f12:	74 6d                	je     803f81 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f14:	48 89 f8             	mov    %rdi,%rax
+  803f17:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f1b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f22:	7f 00 00 
+  803f25:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f29:	f6 c2 01             	test   $0x1,%dl
+  803f2c:	74 62                	je     803f90 <get_uvpt_entry+0x96>
+  803f2e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f35:	7f 00 00 
+  803f38:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f3c:	f6 c2 80             	test   $0x80,%dl
+  803f3f:	75 4f                	jne    803f90 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f41:	48 89 f8             	mov    %rdi,%rax
+  803f44:	48 c1 e8 15          	shr    $0x15,%rax
+  803f48:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f4f:	7f 00 00 
+  803f52:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f56:	f6 c2 01             	test   $0x1,%dl
+  803f59:	74 44                	je     803f9f <get_uvpt_entry+0xa5>
+  803f5b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f62:	7f 00 00 
+  803f65:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f69:	f6 c2 80             	test   $0x80,%dl
+  803f6c:	75 31                	jne    803f9f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803f6e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803f72:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f79:	7f 00 00 
+  803f7c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803f80:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f81:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803f88:	7f 00 00 
+  803f8b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f8f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f90:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f97:	7f 00 00 
+  803f9a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f9e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f9f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803fa6:	7f 00 00 
+  803fa9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803fad:	c3                   	ret
+
+0000000000803fae <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803fae:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803fb1:	48 89 f9             	mov    %rdi,%rcx
+  803fb4:	48 c1 e9 27          	shr    $0x27,%rcx
+  803fb8:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803fbf:	7f 00 00 
+  803fc2:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803fc6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803fcd:	f6 c1 01             	test   $0x1,%cl
+  803fd0:	0f 84 b2 00 00 00    	je     804088 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803fd6:	48 89 f9             	mov    %rdi,%rcx
+  803fd9:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803fdd:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fe4:	7f 00 00 
+  803fe7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803feb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ff2:	40 f6 c6 01          	test   $0x1,%sil
+  803ff6:	0f 84 8c 00 00 00    	je     804088 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803ffc:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804003:	7f 00 00 
+  804006:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80400a:	a8 80                	test   $0x80,%al
+  80400c:	75 7b                	jne    804089 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80400e:	48 89 f9             	mov    %rdi,%rcx
+  804011:	48 c1 e9 15          	shr    $0x15,%rcx
+  804015:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80401c:	7f 00 00 
+  80401f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804023:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80402a:	40 f6 c6 01          	test   $0x1,%sil
+  80402e:	74 58                	je     804088 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  804030:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804037:	7f 00 00 
+  80403a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80403e:	a8 80                	test   $0x80,%al
+  804040:	75 6c                	jne    8040ae <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804042:	48 89 f9             	mov    %rdi,%rcx
+  804045:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804049:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804050:	7f 00 00 
+  804053:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804057:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80405e:	40 f6 c6 01          	test   $0x1,%sil
+  804062:	74 24                	je     804088 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804064:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80406b:	7f 00 00 
+  80406e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804072:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804079:	ff ff 7f 
+  80407c:	48 21 c8             	and    %rcx,%rax
+  80407f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804085:	48 09 d0             	or     %rdx,%rax
+}
+  804088:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804089:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804090:	7f 00 00 
+  804093:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804097:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80409e:	ff ff 7f 
+  8040a1:	48 21 c8             	and    %rcx,%rax
+  8040a4:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8040aa:	48 01 d0             	add    %rdx,%rax
+  8040ad:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8040ae:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8040b5:	7f 00 00 
+  8040b8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8040bc:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8040c3:	ff ff 7f 
+  8040c6:	48 21 c8             	and    %rcx,%rax
+  8040c9:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8040cf:	48 01 d0             	add    %rdx,%rax
+  8040d2:	c3                   	ret
+
+00000000008040d3 <get_prot>:
+
+int
+get_prot(void *va) {
+  8040d3:	55                   	push   %rbp
+  8040d4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040d7:	48 b8 fa 3e 80 00 00 	movabs $0x803efa,%rax
+  8040de:	00 00 00 
+  8040e1:	ff d0                	call   *%rax
+  8040e3:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8040e6:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8040eb:	89 c1                	mov    %eax,%ecx
+  8040ed:	83 c9 04             	or     $0x4,%ecx
+  8040f0:	f6 c2 01             	test   $0x1,%dl
+  8040f3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8040f6:	89 c1                	mov    %eax,%ecx
+  8040f8:	83 c9 02             	or     $0x2,%ecx
+  8040fb:	f6 c2 02             	test   $0x2,%dl
+  8040fe:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804101:	89 c1                	mov    %eax,%ecx
+  804103:	83 c9 01             	or     $0x1,%ecx
+  804106:	48 85 d2             	test   %rdx,%rdx
+  804109:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80410c:	89 c1                	mov    %eax,%ecx
+  80410e:	83 c9 40             	or     $0x40,%ecx
+  804111:	f6 c6 04             	test   $0x4,%dh
+  804114:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804117:	5d                   	pop    %rbp
+  804118:	c3                   	ret
+
+0000000000804119 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804119:	55                   	push   %rbp
+  80411a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80411d:	48 b8 fa 3e 80 00 00 	movabs $0x803efa,%rax
+  804124:	00 00 00 
+  804127:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804129:	48 c1 e8 06          	shr    $0x6,%rax
+  80412d:	83 e0 01             	and    $0x1,%eax
+}
+  804130:	5d                   	pop    %rbp
+  804131:	c3                   	ret
+
+0000000000804132 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804132:	55                   	push   %rbp
+  804133:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804136:	48 b8 fa 3e 80 00 00 	movabs $0x803efa,%rax
+  80413d:	00 00 00 
+  804140:	ff d0                	call   *%rax
+  804142:	83 e0 01             	and    $0x1,%eax
+}
+  804145:	5d                   	pop    %rbp
+  804146:	c3                   	ret
+
+0000000000804147 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804147:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80414e:	7f 00 00 
+  804151:	a8 01                	test   $0x1,%al
+  804153:	75 06                	jne    80415b <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80415a:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80415b:	55                   	push   %rbp
+  80415c:	48 89 e5             	mov    %rsp,%rbp
+  80415f:	41 57                	push   %r15
+  804161:	41 56                	push   %r14
+  804163:	41 55                	push   %r13
+  804165:	41 54                	push   %r12
+  804167:	53                   	push   %rbx
+  804168:	48 83 ec 18          	sub    $0x18,%rsp
+  80416c:	49 89 fe             	mov    %rdi,%r14
+  80416f:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804172:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804179:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80417a:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804181:	7f 00 00 
+  804184:	e9 81 00 00 00       	jmp    80420a <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804189:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804190:	49 39 dd             	cmp    %rbx,%r13
+  804193:	74 2b                	je     8041c0 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804195:	48 89 d8             	mov    %rbx,%rax
+  804198:	48 c1 e8 0c          	shr    $0xc,%rax
+  80419c:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  8041a0:	f6 c2 01             	test   $0x1,%dl
+  8041a3:	74 e4                	je     804189 <foreach_shared_region+0x42>
+  8041a5:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  8041a9:	f6 c4 04             	test   $0x4,%ah
+  8041ac:	74 db                	je     804189 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  8041ae:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8041b5:	4c 89 fa             	mov    %r15,%rdx
+  8041b8:	48 89 df             	mov    %rbx,%rdi
+  8041bb:	41 ff d6             	call   *%r14
+  8041be:	eb c9                	jmp    804189 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8041c0:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  8041c7:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  8041cb:	74 22                	je     8041ef <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  8041cd:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  8041d4:	48 89 d8             	mov    %rbx,%rax
+  8041d7:	48 c1 e8 15          	shr    $0x15,%rax
+  8041db:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  8041e2:	7f 00 00 
+  8041e5:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041e9:	a8 01                	test   $0x1,%al
+  8041eb:	74 d3                	je     8041c0 <foreach_shared_region+0x79>
+  8041ed:	eb a6                	jmp    804195 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8041ef:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  8041f6:	40 
+  8041f7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8041fb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804202:	00 00 00 
+  804205:	48 39 c1             	cmp    %rax,%rcx
+  804208:	74 31                	je     80423b <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  80420a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80420e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804212:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804219:	7f 00 00 
+  80421c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804220:	a8 01                	test   $0x1,%al
+  804222:	74 cb                	je     8041ef <foreach_shared_region+0xa8>
+  804224:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804228:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80422f:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804235:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804239:	eb 92                	jmp    8041cd <foreach_shared_region+0x86>
+}
+  80423b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804240:	48 83 c4 18          	add    $0x18,%rsp
+  804244:	5b                   	pop    %rbx
+  804245:	41 5c                	pop    %r12
+  804247:	41 5d                	pop    %r13
+  804249:	41 5e                	pop    %r14
+  80424b:	41 5f                	pop    %r15
+  80424d:	5d                   	pop    %rbp
+  80424e:	c3                   	ret
+
+000000000080424f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80424f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804254:	c3                   	ret
+
+0000000000804255 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804255:	55                   	push   %rbp
+  804256:	48 89 e5             	mov    %rsp,%rbp
+  804259:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80425c:	48 be b4 58 80 00 00 	movabs $0x8058b4,%rsi
+  804263:	00 00 00 
+  804266:	48 b8 01 0f 80 00 00 	movabs $0x800f01,%rax
+  80426d:	00 00 00 
+  804270:	ff d0                	call   *%rax
+    return 0;
+}
+  804272:	b8 00 00 00 00       	mov    $0x0,%eax
+  804277:	5d                   	pop    %rbp
+  804278:	c3                   	ret
+
+0000000000804279 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804279:	55                   	push   %rbp
+  80427a:	48 89 e5             	mov    %rsp,%rbp
+  80427d:	41 57                	push   %r15
+  80427f:	41 56                	push   %r14
+  804281:	41 55                	push   %r13
+  804283:	41 54                	push   %r12
+  804285:	53                   	push   %rbx
+  804286:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80428d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804294:	48 85 d2             	test   %rdx,%rdx
+  804297:	74 7a                	je     804313 <devcons_write+0x9a>
+  804299:	49 89 d6             	mov    %rdx,%r14
+  80429c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042a2:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042a7:	49 bf 8f 12 80 00 00 	movabs $0x80128f,%r15
+  8042ae:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8042b1:	4c 89 f3             	mov    %r14,%rbx
+  8042b4:	48 29 f3             	sub    %rsi,%rbx
+  8042b7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042bc:	48 39 c3             	cmp    %rax,%rbx
+  8042bf:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8042c3:	4c 63 eb             	movslq %ebx,%r13
+  8042c6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8042cd:	48 01 c6             	add    %rax,%rsi
+  8042d0:	4c 89 ea             	mov    %r13,%rdx
+  8042d3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042da:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8042dd:	4c 89 ee             	mov    %r13,%rsi
+  8042e0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042e7:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  8042ee:	00 00 00 
+  8042f1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8042f3:	41 01 dc             	add    %ebx,%r12d
+  8042f6:	49 63 f4             	movslq %r12d,%rsi
+  8042f9:	4c 39 f6             	cmp    %r14,%rsi
+  8042fc:	72 b3                	jb     8042b1 <devcons_write+0x38>
+    return res;
+  8042fe:	49 63 c4             	movslq %r12d,%rax
+}
+  804301:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804308:	5b                   	pop    %rbx
+  804309:	41 5c                	pop    %r12
+  80430b:	41 5d                	pop    %r13
+  80430d:	41 5e                	pop    %r14
+  80430f:	41 5f                	pop    %r15
+  804311:	5d                   	pop    %rbp
+  804312:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804313:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804319:	eb e3                	jmp    8042fe <devcons_write+0x85>
+
+000000000080431b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80431b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80431e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804323:	48 85 c0             	test   %rax,%rax
+  804326:	74 55                	je     80437d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804328:	55                   	push   %rbp
+  804329:	48 89 e5             	mov    %rsp,%rbp
+  80432c:	41 55                	push   %r13
+  80432e:	41 54                	push   %r12
+  804330:	53                   	push   %rbx
+  804331:	48 83 ec 08          	sub    $0x8,%rsp
+  804335:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804338:	48 bb 05 15 80 00 00 	movabs $0x801505,%rbx
+  80433f:	00 00 00 
+  804342:	49 bc d2 15 80 00 00 	movabs $0x8015d2,%r12
+  804349:	00 00 00 
+  80434c:	eb 03                	jmp    804351 <devcons_read+0x36>
+  80434e:	41 ff d4             	call   *%r12
+  804351:	ff d3                	call   *%rbx
+  804353:	85 c0                	test   %eax,%eax
+  804355:	74 f7                	je     80434e <devcons_read+0x33>
+    if (c < 0) return c;
+  804357:	48 63 d0             	movslq %eax,%rdx
+  80435a:	78 13                	js     80436f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80435c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804361:	83 f8 04             	cmp    $0x4,%eax
+  804364:	74 09                	je     80436f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804366:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80436a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80436f:	48 89 d0             	mov    %rdx,%rax
+  804372:	48 83 c4 08          	add    $0x8,%rsp
+  804376:	5b                   	pop    %rbx
+  804377:	41 5c                	pop    %r12
+  804379:	41 5d                	pop    %r13
+  80437b:	5d                   	pop    %rbp
+  80437c:	c3                   	ret
+  80437d:	48 89 d0             	mov    %rdx,%rax
+  804380:	c3                   	ret
+
+0000000000804381 <cputchar>:
+cputchar(int ch) {
+  804381:	55                   	push   %rbp
+  804382:	48 89 e5             	mov    %rsp,%rbp
+  804385:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804389:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80438d:	be 01 00 00 00       	mov    $0x1,%esi
+  804392:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804396:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  80439d:	00 00 00 
+  8043a0:	ff d0                	call   *%rax
+}
+  8043a2:	c9                   	leave
+  8043a3:	c3                   	ret
+
+00000000008043a4 <getchar>:
+getchar(void) {
+  8043a4:	55                   	push   %rbp
+  8043a5:	48 89 e5             	mov    %rsp,%rbp
+  8043a8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8043ac:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043b1:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8043b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043ba:	48 b8 62 25 80 00 00 	movabs $0x802562,%rax
+  8043c1:	00 00 00 
+  8043c4:	ff d0                	call   *%rax
+  8043c6:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8043c8:	85 c0                	test   %eax,%eax
+  8043ca:	78 06                	js     8043d2 <getchar+0x2e>
+  8043cc:	74 08                	je     8043d6 <getchar+0x32>
+  8043ce:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8043d2:	89 d0                	mov    %edx,%eax
+  8043d4:	c9                   	leave
+  8043d5:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8043d6:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8043db:	eb f5                	jmp    8043d2 <getchar+0x2e>
+
+00000000008043dd <iscons>:
+iscons(int fdnum) {
+  8043dd:	55                   	push   %rbp
+  8043de:	48 89 e5             	mov    %rsp,%rbp
+  8043e1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043e5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043e9:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  8043f0:	00 00 00 
+  8043f3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8043f5:	85 c0                	test   %eax,%eax
+  8043f7:	78 18                	js     804411 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8043f9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043fd:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804404:	00 00 00 
+  804407:	8b 00                	mov    (%rax),%eax
+  804409:	39 02                	cmp    %eax,(%rdx)
+  80440b:	0f 94 c0             	sete   %al
+  80440e:	0f b6 c0             	movzbl %al,%eax
+}
+  804411:	c9                   	leave
+  804412:	c3                   	ret
+
+0000000000804413 <opencons>:
+opencons(void) {
+  804413:	55                   	push   %rbp
+  804414:	48 89 e5             	mov    %rsp,%rbp
+  804417:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80441b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80441f:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  804426:	00 00 00 
+  804429:	ff d0                	call   *%rax
+  80442b:	85 c0                	test   %eax,%eax
+  80442d:	78 49                	js     804478 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80442f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804434:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804439:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80443d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804442:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  804449:	00 00 00 
+  80444c:	ff d0                	call   *%rax
+  80444e:	85 c0                	test   %eax,%eax
+  804450:	78 26                	js     804478 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804452:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804456:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80445d:	00 00 
+  80445f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804461:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804465:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80446c:	48 b8 f1 21 80 00 00 	movabs $0x8021f1,%rax
+  804473:	00 00 00 
+  804476:	ff d0                	call   *%rax
+}
+  804478:	c9                   	leave
+  804479:	c3                   	ret
+
+000000000080447a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80447a:	55                   	push   %rbp
+  80447b:	48 89 e5             	mov    %rsp,%rbp
+  80447e:	41 56                	push   %r14
+  804480:	41 55                	push   %r13
+  804482:	41 54                	push   %r12
+  804484:	53                   	push   %rbx
+  804485:	48 83 ec 50          	sub    $0x50,%rsp
+  804489:	49 89 fc             	mov    %rdi,%r12
+  80448c:	41 89 f5             	mov    %esi,%r13d
+  80448f:	48 89 d3             	mov    %rdx,%rbx
+  804492:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804496:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80449a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80449e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8044a5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044a9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8044ad:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8044b1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8044b5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8044bc:	00 00 00 
+  8044bf:	4c 8b 30             	mov    (%rax),%r14
+  8044c2:	48 b8 a1 15 80 00 00 	movabs $0x8015a1,%rax
+  8044c9:	00 00 00 
+  8044cc:	ff d0                	call   *%rax
+  8044ce:	89 c6                	mov    %eax,%esi
+  8044d0:	45 89 e8             	mov    %r13d,%r8d
+  8044d3:	4c 89 e1             	mov    %r12,%rcx
+  8044d6:	4c 89 f2             	mov    %r14,%rdx
+  8044d9:	48 bf c0 58 80 00 00 	movabs $0x8058c0,%rdi
+  8044e0:	00 00 00 
+  8044e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e8:	49 bc 89 05 80 00 00 	movabs $0x800589,%r12
+  8044ef:	00 00 00 
+  8044f2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8044f5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8044f9:	48 89 df             	mov    %rbx,%rdi
+  8044fc:	48 b8 25 05 80 00 00 	movabs $0x800525,%rax
+  804503:	00 00 00 
+  804506:	ff d0                	call   *%rax
+    cprintf("\n");
+  804508:	48 bf 8b 50 80 00 00 	movabs $0x80508b,%rdi
+  80450f:	00 00 00 
+  804512:	b8 00 00 00 00       	mov    $0x0,%eax
+  804517:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80451a:	cc                   	int3
+  80451b:	eb fd                	jmp    80451a <_panic+0xa0>
+
+000000000080451d <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80451d:	55                   	push   %rbp
+  80451e:	48 89 e5             	mov    %rsp,%rbp
+  804521:	41 55                	push   %r13
+  804523:	41 54                	push   %r12
+  804525:	53                   	push   %rbx
+  804526:	48 83 ec 08          	sub    $0x8,%rsp
+  80452a:	49 89 fc             	mov    %rdi,%r12
+  80452d:	48 89 f7             	mov    %rsi,%rdi
+  804530:	48 89 d3             	mov    %rdx,%rbx
+  804533:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804536:	48 85 f6             	test   %rsi,%rsi
+  804539:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804540:	00 00 00 
+  804543:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804547:	be 00 10 00 00       	mov    $0x1000,%esi
+  80454c:	48 85 d2             	test   %rdx,%rdx
+  80454f:	74 03                	je     804554 <ipc_recv+0x37>
+  804551:	48 8b 32             	mov    (%rdx),%rsi
+  804554:	48 b8 0e 1a 80 00 00 	movabs $0x801a0e,%rax
+  80455b:	00 00 00 
+  80455e:	ff d0                	call   *%rax
+    if (errno) {
+  804560:	85 c0                	test   %eax,%eax
+  804562:	74 1c                	je     804580 <ipc_recv+0x63>
+        if (from_env_store)
+  804564:	4d 85 e4             	test   %r12,%r12
+  804567:	74 08                	je     804571 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804569:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804570:	00 
+
+        if (perm_store)
+  804571:	4d 85 ed             	test   %r13,%r13
+  804574:	74 74                	je     8045ea <ipc_recv+0xcd>
+            *perm_store = 0;
+  804576:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80457d:	00 
+  80457e:	eb 6a                	jmp    8045ea <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804580:	4d 85 e4             	test   %r12,%r12
+  804583:	74 14                	je     804599 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804585:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  80458c:	00 00 00 
+  80458f:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804595:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804599:	48 85 db             	test   %rbx,%rbx
+  80459c:	74 23                	je     8045c1 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80459e:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  8045a5:	00 00 00 
+  8045a8:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8045ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045b3:	85 c9                	test   %ecx,%ecx
+  8045b5:	74 07                	je     8045be <ipc_recv+0xa1>
+  8045b7:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8045be:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8045c1:	4d 85 ed             	test   %r13,%r13
+  8045c4:	74 14                	je     8045da <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8045c6:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  8045cd:	00 00 00 
+  8045d0:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8045d6:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8045da:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  8045e1:	00 00 00 
+  8045e4:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8045ea:	48 83 c4 08          	add    $0x8,%rsp
+  8045ee:	5b                   	pop    %rbx
+  8045ef:	41 5c                	pop    %r12
+  8045f1:	41 5d                	pop    %r13
+  8045f3:	5d                   	pop    %rbp
+  8045f4:	c3                   	ret
+
+00000000008045f5 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045f5:	55                   	push   %rbp
+  8045f6:	48 89 e5             	mov    %rsp,%rbp
+  8045f9:	41 55                	push   %r13
+  8045fb:	41 54                	push   %r12
+  8045fd:	53                   	push   %rbx
+  8045fe:	48 83 ec 08          	sub    $0x8,%rsp
+  804602:	49 89 fc             	mov    %rdi,%r12
+  804605:	48 89 f7             	mov    %rsi,%rdi
+  804608:	48 89 d3             	mov    %rdx,%rbx
+  80460b:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80460e:	48 85 f6             	test   %rsi,%rsi
+  804611:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804618:	00 00 00 
+  80461b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  80461f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804624:	48 85 d2             	test   %rdx,%rdx
+  804627:	74 03                	je     80462c <ipc_try_recv+0x37>
+  804629:	48 8b 32             	mov    (%rdx),%rsi
+  80462c:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  804633:	00 00 00 
+  804636:	ff d0                	call   *%rax
+    if (errno) {
+  804638:	85 c0                	test   %eax,%eax
+  80463a:	75 75                	jne    8046b1 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80463c:	4d 85 e4             	test   %r12,%r12
+  80463f:	74 14                	je     804655 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804641:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  804648:	00 00 00 
+  80464b:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804651:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804655:	48 85 db             	test   %rbx,%rbx
+  804658:	74 23                	je     80467d <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80465a:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  804661:	00 00 00 
+  804664:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80466a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80466f:	85 c9                	test   %ecx,%ecx
+  804671:	74 07                	je     80467a <ipc_try_recv+0x85>
+  804673:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80467a:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80467d:	4d 85 ed             	test   %r13,%r13
+  804680:	74 14                	je     804696 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804682:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  804689:	00 00 00 
+  80468c:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804692:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804696:	48 a1 60 76 80 00 00 	movabs 0x807660,%rax
+  80469d:	00 00 00 
+  8046a0:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  8046a6:	48 83 c4 08          	add    $0x8,%rsp
+  8046aa:	5b                   	pop    %rbx
+  8046ab:	41 5c                	pop    %r12
+  8046ad:	41 5d                	pop    %r13
+  8046af:	5d                   	pop    %rbp
+  8046b0:	c3                   	ret
+        if (from_env_store)
+  8046b1:	4d 85 e4             	test   %r12,%r12
+  8046b4:	74 08                	je     8046be <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8046b6:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8046bd:	00 
+        if (perm_store)
+  8046be:	4d 85 ed             	test   %r13,%r13
+  8046c1:	74 e3                	je     8046a6 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8046c3:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8046ca:	00 
+  8046cb:	eb d9                	jmp    8046a6 <ipc_try_recv+0xb1>
+
+00000000008046cd <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8046cd:	55                   	push   %rbp
+  8046ce:	48 89 e5             	mov    %rsp,%rbp
+  8046d1:	41 57                	push   %r15
+  8046d3:	41 56                	push   %r14
+  8046d5:	41 55                	push   %r13
+  8046d7:	41 54                	push   %r12
+  8046d9:	53                   	push   %rbx
+  8046da:	48 83 ec 18          	sub    $0x18,%rsp
+  8046de:	41 89 fd             	mov    %edi,%r13d
+  8046e1:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8046e4:	48 89 d3             	mov    %rdx,%rbx
+  8046e7:	49 89 cc             	mov    %rcx,%r12
+  8046ea:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8046ee:	48 85 d2             	test   %rdx,%rdx
+  8046f1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046f8:	00 00 00 
+  8046fb:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8046ff:	49 be e2 19 80 00 00 	movabs $0x8019e2,%r14
+  804706:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804709:	49 bf d2 15 80 00 00 	movabs $0x8015d2,%r15
+  804710:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804713:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804716:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80471a:	4c 89 e1             	mov    %r12,%rcx
+  80471d:	48 89 da             	mov    %rbx,%rdx
+  804720:	44 89 ef             	mov    %r13d,%edi
+  804723:	41 ff d6             	call   *%r14
+  804726:	85 c0                	test   %eax,%eax
+  804728:	74 37                	je     804761 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  80472a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80472d:	75 05                	jne    804734 <ipc_send+0x67>
+        sys_yield();
+  80472f:	41 ff d7             	call   *%r15
+  804732:	eb df                	jmp    804713 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804734:	89 c1                	mov    %eax,%ecx
+  804736:	48 ba e3 58 80 00 00 	movabs $0x8058e3,%rdx
+  80473d:	00 00 00 
+  804740:	be 65 00 00 00       	mov    $0x65,%esi
+  804745:	48 bf fe 58 80 00 00 	movabs $0x8058fe,%rdi
+  80474c:	00 00 00 
+  80474f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804754:	49 b8 7a 44 80 00 00 	movabs $0x80447a,%r8
+  80475b:	00 00 00 
+  80475e:	41 ff d0             	call   *%r8
+    }
+}
+  804761:	48 83 c4 18          	add    $0x18,%rsp
+  804765:	5b                   	pop    %rbx
+  804766:	41 5c                	pop    %r12
+  804768:	41 5d                	pop    %r13
+  80476a:	41 5e                	pop    %r14
+  80476c:	41 5f                	pop    %r15
+  80476e:	5d                   	pop    %rbp
+  80476f:	c3                   	ret
+
+0000000000804770 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804770:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804775:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80477c:	00 00 00 
+  80477f:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804786:	48 01 ca             	add    %rcx,%rdx
+  804789:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80478f:	39 fa                	cmp    %edi,%edx
+  804791:	74 12                	je     8047a5 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804793:	48 83 c0 01          	add    $0x1,%rax
+  804797:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80479d:	75 e0                	jne    80477f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80479f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047a4:	c3                   	ret
+            return envs[i].env_id;
+  8047a5:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8047ac:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8047b3:	00 00 00 
+  8047b6:	48 01 d0             	add    %rdx,%rax
+  8047b9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8047bf:	c3                   	ret
+
+00000000008047c0 <__text_end>:
+  8047c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c7:	00 00 00 
+  8047ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d1:	00 00 00 
+  8047d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047db:	00 00 00 
+  8047de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e5:	00 00 00 
+  8047e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ef:	00 00 00 
+  8047f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f9:	00 00 00 
+  8047fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804803:	00 00 00 
+  804806:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480d:	00 00 00 
+  804810:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804817:	00 00 00 
+  80481a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804821:	00 00 00 
+  804824:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482b:	00 00 00 
+  80482e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804835:	00 00 00 
+  804838:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483f:	00 00 00 
+  804842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804849:	00 00 00 
+  80484c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804853:	00 00 00 
+  804856:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485d:	00 00 00 
+  804860:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804867:	00 00 00 
+  80486a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804871:	00 00 00 
+  804874:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487b:	00 00 00 
+  80487e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804885:	00 00 00 
+  804888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488f:	00 00 00 
+  804892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804899:	00 00 00 
+  80489c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a3:	00 00 00 
+  8048a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ad:	00 00 00 
+  8048b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b7:	00 00 00 
+  8048ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c1:	00 00 00 
+  8048c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cb:	00 00 00 
+  8048ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d5:	00 00 00 
+  8048d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048df:	00 00 00 
+  8048e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e9:	00 00 00 
+  8048ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f3:	00 00 00 
+  8048f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fd:	00 00 00 
+  804900:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804907:	00 00 00 
+  80490a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804911:	00 00 00 
+  804914:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491b:	00 00 00 
+  80491e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804925:	00 00 00 
+  804928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492f:	00 00 00 
+  804932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804939:	00 00 00 
+  80493c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804943:	00 00 00 
+  804946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494d:	00 00 00 
+  804950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804957:	00 00 00 
+  80495a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804961:	00 00 00 
+  804964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496b:	00 00 00 
+  80496e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804975:	00 00 00 
+  804978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497f:	00 00 00 
+  804982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804989:	00 00 00 
+  80498c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804993:	00 00 00 
+  804996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499d:	00 00 00 
+  8049a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a7:	00 00 00 
+  8049aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b1:	00 00 00 
+  8049b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bb:	00 00 00 
+  8049be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c5:	00 00 00 
+  8049c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cf:	00 00 00 
+  8049d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d9:	00 00 00 
+  8049dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e3:	00 00 00 
+  8049e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ed:	00 00 00 
+  8049f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f7:	00 00 00 
+  8049fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a01:	00 00 00 
+  804a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0b:	00 00 00 
+  804a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a15:	00 00 00 
+  804a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1f:	00 00 00 
+  804a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a29:	00 00 00 
+  804a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a33:	00 00 00 
+  804a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3d:	00 00 00 
+  804a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a47:	00 00 00 
+  804a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a51:	00 00 00 
+  804a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5b:	00 00 00 
+  804a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a65:	00 00 00 
+  804a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6f:	00 00 00 
+  804a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a79:	00 00 00 
+  804a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a83:	00 00 00 
+  804a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8d:	00 00 00 
+  804a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a97:	00 00 00 
+  804a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa1:	00 00 00 
+  804aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aab:	00 00 00 
+  804aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab5:	00 00 00 
+  804ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abf:	00 00 00 
+  804ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac9:	00 00 00 
+  804acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad3:	00 00 00 
+  804ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804add:	00 00 00 
+  804ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae7:	00 00 00 
+  804aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af1:	00 00 00 
+  804af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afb:	00 00 00 
+  804afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b05:	00 00 00 
+  804b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0f:	00 00 00 
+  804b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b19:	00 00 00 
+  804b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b23:	00 00 00 
+  804b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2d:	00 00 00 
+  804b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b37:	00 00 00 
+  804b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b41:	00 00 00 
+  804b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4b:	00 00 00 
+  804b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b55:	00 00 00 
+  804b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5f:	00 00 00 
+  804b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b69:	00 00 00 
+  804b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b73:	00 00 00 
+  804b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7d:	00 00 00 
+  804b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b87:	00 00 00 
+  804b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b91:	00 00 00 
+  804b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9b:	00 00 00 
+  804b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba5:	00 00 00 
+  804ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baf:	00 00 00 
+  804bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb9:	00 00 00 
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
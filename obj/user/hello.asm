@@ -0,0 +1,8100 @@
+
+obj/user/hello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4d 00 00 00       	call   800070 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* hello, world */
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("hello, world\n");
+  80002e:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 bb e9 01 80 00 00 	movabs $0x8001e9,%rbx
+  800044:	00 00 00 
+  800047:	ff d3                	call   *%rbx
+    cprintf("i am environment %08x\n", thisenv->env_id);
+  800049:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800050:	00 00 00 
+  800053:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800059:	48 bf 0e 50 80 00 00 	movabs $0x80500e,%rdi
+  800060:	00 00 00 
+  800063:	b8 00 00 00 00       	mov    $0x0,%eax
+  800068:	ff d3                	call   *%rbx
+}
+  80006a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80006e:	c9                   	leave
+  80006f:	c3                   	ret
+
+0000000000800070 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800070:	55                   	push   %rbp
+  800071:	48 89 e5             	mov    %rsp,%rbp
+  800074:	41 56                	push   %r14
+  800076:	41 55                	push   %r13
+  800078:	41 54                	push   %r12
+  80007a:	53                   	push   %rbx
+  80007b:	41 89 fd             	mov    %edi,%r13d
+  80007e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800081:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800088:	00 00 00 
+  80008b:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800092:	00 00 00 
+  800095:	48 39 c2             	cmp    %rax,%rdx
+  800098:	73 17                	jae    8000b1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80009a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009d:	49 89 c4             	mov    %rax,%r12
+  8000a0:	48 83 c3 08          	add    $0x8,%rbx
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ac:	4c 39 e3             	cmp    %r12,%rbx
+  8000af:	72 ef                	jb     8000a0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000b1:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  8000b8:	00 00 00 
+  8000bb:	ff d0                	call   *%rax
+  8000bd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c2:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000c9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000d0:	00 00 00 
+  8000d3:	48 01 d0             	add    %rdx,%rax
+  8000d6:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000dd:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000e0:	45 85 ed             	test   %r13d,%r13d
+  8000e3:	7e 0d                	jle    8000f2 <libmain+0x82>
+  8000e5:	49 8b 06             	mov    (%r14),%rax
+  8000e8:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000ef:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f2:	4c 89 f6             	mov    %r14,%rsi
+  8000f5:	44 89 ef             	mov    %r13d,%edi
+  8000f8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800104:	48 b8 19 01 80 00 00 	movabs $0x800119,%rax
+  80010b:	00 00 00 
+  80010e:	ff d0                	call   *%rax
+#endif
+}
+  800110:	5b                   	pop    %rbx
+  800111:	41 5c                	pop    %r12
+  800113:	41 5d                	pop    %r13
+  800115:	41 5e                	pop    %r14
+  800117:	5d                   	pop    %rbp
+  800118:	c3                   	ret
+
+0000000000800119 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800119:	55                   	push   %rbp
+  80011a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80011d:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  800124:	00 00 00 
+  800127:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800129:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012e:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  800135:	00 00 00 
+  800138:	ff d0                	call   *%rax
+}
+  80013a:	5d                   	pop    %rbp
+  80013b:	c3                   	ret
+
+000000000080013c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80013c:	55                   	push   %rbp
+  80013d:	48 89 e5             	mov    %rsp,%rbp
+  800140:	53                   	push   %rbx
+  800141:	48 83 ec 08          	sub    $0x8,%rsp
+  800145:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800148:	8b 06                	mov    (%rsi),%eax
+  80014a:	8d 50 01             	lea    0x1(%rax),%edx
+  80014d:	89 16                	mov    %edx,(%rsi)
+  80014f:	48 98                	cltq
+  800151:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800156:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80015c:	74 0a                	je     800168 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80015e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800162:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800166:	c9                   	leave
+  800167:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800168:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80016c:	be ff 00 00 00       	mov    $0xff,%esi
+  800171:	48 b8 38 11 80 00 00 	movabs $0x801138,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80017d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800183:	eb d9                	jmp    80015e <putch+0x22>
+
+0000000000800185 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800185:	55                   	push   %rbp
+  800186:	48 89 e5             	mov    %rsp,%rbp
+  800189:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800190:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800193:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80019a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80019f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001a7:	48 89 f1             	mov    %rsi,%rcx
+  8001aa:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001b1:	48 bf 3c 01 80 00 00 	movabs $0x80013c,%rdi
+  8001b8:	00 00 00 
+  8001bb:	48 b8 39 03 80 00 00 	movabs $0x800339,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001c7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001ce:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001d5:	48 b8 38 11 80 00 00 	movabs $0x801138,%rax
+  8001dc:	00 00 00 
+  8001df:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001e1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001e7:	c9                   	leave
+  8001e8:	c3                   	ret
+
+00000000008001e9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001e9:	55                   	push   %rbp
+  8001ea:	48 89 e5             	mov    %rsp,%rbp
+  8001ed:	48 83 ec 50          	sub    $0x50,%rsp
+  8001f1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001f5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001f9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001fd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800201:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800205:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80020c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800210:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800214:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800218:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80021c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800220:	48 b8 85 01 80 00 00 	movabs $0x800185,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80022c:	c9                   	leave
+  80022d:	c3                   	ret
+
+000000000080022e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80022e:	55                   	push   %rbp
+  80022f:	48 89 e5             	mov    %rsp,%rbp
+  800232:	41 57                	push   %r15
+  800234:	41 56                	push   %r14
+  800236:	41 55                	push   %r13
+  800238:	41 54                	push   %r12
+  80023a:	53                   	push   %rbx
+  80023b:	48 83 ec 18          	sub    $0x18,%rsp
+  80023f:	49 89 fc             	mov    %rdi,%r12
+  800242:	49 89 f5             	mov    %rsi,%r13
+  800245:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800249:	8b 45 10             	mov    0x10(%rbp),%eax
+  80024c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80024f:	41 89 cf             	mov    %ecx,%r15d
+  800252:	4c 39 fa             	cmp    %r15,%rdx
+  800255:	73 5b                	jae    8002b2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800257:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80025b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80025f:	85 db                	test   %ebx,%ebx
+  800261:	7e 0e                	jle    800271 <print_num+0x43>
+            putch(padc, put_arg);
+  800263:	4c 89 ee             	mov    %r13,%rsi
+  800266:	44 89 f7             	mov    %r14d,%edi
+  800269:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80026c:	83 eb 01             	sub    $0x1,%ebx
+  80026f:	75 f2                	jne    800263 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800271:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800275:	48 b9 40 50 80 00 00 	movabs $0x805040,%rcx
+  80027c:	00 00 00 
+  80027f:	48 b8 2f 50 80 00 00 	movabs $0x80502f,%rax
+  800286:	00 00 00 
+  800289:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80028d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800291:	ba 00 00 00 00       	mov    $0x0,%edx
+  800296:	49 f7 f7             	div    %r15
+  800299:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80029d:	4c 89 ee             	mov    %r13,%rsi
+  8002a0:	41 ff d4             	call   *%r12
+}
+  8002a3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002a7:	5b                   	pop    %rbx
+  8002a8:	41 5c                	pop    %r12
+  8002aa:	41 5d                	pop    %r13
+  8002ac:	41 5e                	pop    %r14
+  8002ae:	41 5f                	pop    %r15
+  8002b0:	5d                   	pop    %rbp
+  8002b1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002bb:	49 f7 f7             	div    %r15
+  8002be:	48 83 ec 08          	sub    $0x8,%rsp
+  8002c2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002c6:	52                   	push   %rdx
+  8002c7:	45 0f be c9          	movsbl %r9b,%r9d
+  8002cb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002cf:	48 89 c2             	mov    %rax,%rdx
+  8002d2:	48 b8 2e 02 80 00 00 	movabs $0x80022e,%rax
+  8002d9:	00 00 00 
+  8002dc:	ff d0                	call   *%rax
+  8002de:	48 83 c4 10          	add    $0x10,%rsp
+  8002e2:	eb 8d                	jmp    800271 <print_num+0x43>
+
+00000000008002e4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002e4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002e8:	48 8b 06             	mov    (%rsi),%rax
+  8002eb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002ef:	73 0a                	jae    8002fb <sprintputch+0x17>
+        *state->start++ = ch;
+  8002f1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002f5:	48 89 16             	mov    %rdx,(%rsi)
+  8002f8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002fb:	c3                   	ret
+
+00000000008002fc <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002fc:	55                   	push   %rbp
+  8002fd:	48 89 e5             	mov    %rsp,%rbp
+  800300:	48 83 ec 50          	sub    $0x50,%rsp
+  800304:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800308:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80030c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800310:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800317:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80031b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80031f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800323:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800327:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80032b:	48 b8 39 03 80 00 00 	movabs $0x800339,%rax
+  800332:	00 00 00 
+  800335:	ff d0                	call   *%rax
+}
+  800337:	c9                   	leave
+  800338:	c3                   	ret
+
+0000000000800339 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800339:	55                   	push   %rbp
+  80033a:	48 89 e5             	mov    %rsp,%rbp
+  80033d:	41 57                	push   %r15
+  80033f:	41 56                	push   %r14
+  800341:	41 55                	push   %r13
+  800343:	41 54                	push   %r12
+  800345:	53                   	push   %rbx
+  800346:	48 83 ec 38          	sub    $0x38,%rsp
+  80034a:	49 89 fe             	mov    %rdi,%r14
+  80034d:	49 89 f5             	mov    %rsi,%r13
+  800350:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800353:	48 8b 01             	mov    (%rcx),%rax
+  800356:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80035a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80035e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800362:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800366:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80036a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80036e:	0f b6 3b             	movzbl (%rbx),%edi
+  800371:	40 80 ff 25          	cmp    $0x25,%dil
+  800375:	74 18                	je     80038f <vprintfmt+0x56>
+            if (!ch) return;
+  800377:	40 84 ff             	test   %dil,%dil
+  80037a:	0f 84 04 07 00 00    	je     800a84 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800380:	40 0f b6 ff          	movzbl %dil,%edi
+  800384:	4c 89 ee             	mov    %r13,%rsi
+  800387:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80038a:	4c 89 e3             	mov    %r12,%rbx
+  80038d:	eb db                	jmp    80036a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80038f:	be 00 00 00 00       	mov    $0x0,%esi
+  800394:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800398:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80039d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003a3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003aa:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003ae:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003b3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003b8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003bb:	83 e8 23             	sub    $0x23,%eax
+  8003be:	3c 57                	cmp    $0x57,%al
+  8003c0:	0f 87 a4 06 00 00    	ja     800a6a <vprintfmt+0x731>
+  8003c6:	0f b6 c0             	movzbl %al,%eax
+  8003c9:	48 b9 c0 51 80 00 00 	movabs $0x8051c0,%rcx
+  8003d0:	00 00 00 
+  8003d3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003d6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003d9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003dd:	eb cf                	jmp    8003ae <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003df:	49 89 dc             	mov    %rbx,%r12
+  8003e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8003e7:	eb c5                	jmp    8003ae <vprintfmt+0x75>
+            padc = ch;
+  8003e9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003ed:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003f0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003f3:	eb b9                	jmp    8003ae <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8003fb:	77 24                	ja     800421 <vprintfmt+0xe8>
+  8003fd:	89 c1                	mov    %eax,%ecx
+  8003ff:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800403:	83 c0 08             	add    $0x8,%eax
+  800406:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800409:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80040c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80040f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800413:	79 99                	jns    8003ae <vprintfmt+0x75>
+                width = precision;
+  800415:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800419:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80041f:	eb 8d                	jmp    8003ae <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800421:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800425:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800429:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80042d:	eb da                	jmp    800409 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80042f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800434:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800438:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80043e:	3c 39                	cmp    $0x39,%al
+  800440:	77 1c                	ja     80045e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800442:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800446:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80044a:	0f b6 c0             	movzbl %al,%eax
+  80044d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800452:	0f b6 03             	movzbl (%rbx),%eax
+  800455:	3c 39                	cmp    $0x39,%al
+  800457:	76 e9                	jbe    800442 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800459:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80045c:	eb b1                	jmp    80040f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80045e:	49 89 dc             	mov    %rbx,%r12
+  800461:	eb ac                	jmp    80040f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800463:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800466:	85 c9                	test   %ecx,%ecx
+  800468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046d:	0f 49 c1             	cmovns %ecx,%eax
+  800470:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800473:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800476:	e9 33 ff ff ff       	jmp    8003ae <vprintfmt+0x75>
+            lflag++;
+  80047b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80047e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800481:	e9 28 ff ff ff       	jmp    8003ae <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800486:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800489:	83 f8 2f             	cmp    $0x2f,%eax
+  80048c:	77 19                	ja     8004a7 <vprintfmt+0x16e>
+  80048e:	89 c2                	mov    %eax,%edx
+  800490:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800494:	83 c0 08             	add    $0x8,%eax
+  800497:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80049a:	8b 3a                	mov    (%rdx),%edi
+  80049c:	4c 89 ee             	mov    %r13,%rsi
+  80049f:	41 ff d6             	call   *%r14
+            break;
+  8004a2:	e9 c3 fe ff ff       	jmp    80036a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004b3:	eb e5                	jmp    80049a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004bb:	77 5a                	ja     800517 <vprintfmt+0x1de>
+  8004bd:	89 c2                	mov    %eax,%edx
+  8004bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004c3:	83 c0 08             	add    $0x8,%eax
+  8004c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004c9:	8b 02                	mov    (%rdx),%eax
+  8004cb:	89 c1                	mov    %eax,%ecx
+  8004cd:	f7 d9                	neg    %ecx
+  8004cf:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004d2:	83 f9 13             	cmp    $0x13,%ecx
+  8004d5:	7f 4e                	jg     800525 <vprintfmt+0x1ec>
+  8004d7:	48 63 c1             	movslq %ecx,%rax
+  8004da:	48 ba 80 54 80 00 00 	movabs $0x805480,%rdx
+  8004e1:	00 00 00 
+  8004e4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004e8:	48 85 c0             	test   %rax,%rax
+  8004eb:	74 38                	je     800525 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004ed:	48 89 c1             	mov    %rax,%rcx
+  8004f0:	48 ba b9 56 80 00 00 	movabs $0x8056b9,%rdx
+  8004f7:	00 00 00 
+  8004fa:	4c 89 ee             	mov    %r13,%rsi
+  8004fd:	4c 89 f7             	mov    %r14,%rdi
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  80050c:	00 00 00 
+  80050f:	41 ff d0             	call   *%r8
+  800512:	e9 53 fe ff ff       	jmp    80036a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800517:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80051b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80051f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800523:	eb a4                	jmp    8004c9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800525:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  80052c:	00 00 00 
+  80052f:	4c 89 ee             	mov    %r13,%rsi
+  800532:	4c 89 f7             	mov    %r14,%rdi
+  800535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053a:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  800541:	00 00 00 
+  800544:	41 ff d0             	call   *%r8
+  800547:	e9 1e fe ff ff       	jmp    80036a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80054c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80054f:	83 f8 2f             	cmp    $0x2f,%eax
+  800552:	77 36                	ja     80058a <vprintfmt+0x251>
+  800554:	89 c2                	mov    %eax,%edx
+  800556:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055a:	83 c0 08             	add    $0x8,%eax
+  80055d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800560:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800563:	48 85 f6             	test   %rsi,%rsi
+  800566:	48 b8 51 50 80 00 00 	movabs $0x805051,%rax
+  80056d:	00 00 00 
+  800570:	48 0f 45 c6          	cmovne %rsi,%rax
+  800574:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800578:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80057c:	7e 06                	jle    800584 <vprintfmt+0x24b>
+  80057e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800582:	75 14                	jne    800598 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800584:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800588:	eb 5b                	jmp    8005e5 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80058a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80058e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800592:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800596:	eb c8                	jmp    800560 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800598:	49 63 f7             	movslq %r15d,%rsi
+  80059b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80059f:	48 b8 3e 0b 80 00 00 	movabs $0x800b3e,%rax
+  8005a6:	00 00 00 
+  8005a9:	ff d0                	call   *%rax
+  8005ab:	48 89 c2             	mov    %rax,%rdx
+  8005ae:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005b1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005b3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005b6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005b9:	85 c0                	test   %eax,%eax
+  8005bb:	7e c7                	jle    800584 <vprintfmt+0x24b>
+  8005bd:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005c2:	4c 89 ee             	mov    %r13,%rsi
+  8005c5:	44 89 e7             	mov    %r12d,%edi
+  8005c8:	41 ff d6             	call   *%r14
+  8005cb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005cf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005d2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005d5:	75 eb                	jne    8005c2 <vprintfmt+0x289>
+  8005d7:	eb ab                	jmp    800584 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005d9:	0f b6 f8             	movzbl %al,%edi
+  8005dc:	4c 89 ee             	mov    %r13,%rsi
+  8005df:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8005e2:	4c 89 e2             	mov    %r12,%rdx
+  8005e5:	45 85 ff             	test   %r15d,%r15d
+  8005e8:	78 06                	js     8005f0 <vprintfmt+0x2b7>
+  8005ea:	41 83 ef 01          	sub    $0x1,%r15d
+  8005ee:	78 23                	js     800613 <vprintfmt+0x2da>
+  8005f0:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8005f4:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8005fa:	84 c0                	test   %al,%al
+  8005fc:	74 15                	je     800613 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005fe:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800602:	74 d5                	je     8005d9 <vprintfmt+0x2a0>
+  800604:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800607:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80060c:	80 fa 5e             	cmp    $0x5e,%dl
+  80060f:	77 cb                	ja     8005dc <vprintfmt+0x2a3>
+  800611:	eb c6                	jmp    8005d9 <vprintfmt+0x2a0>
+  800613:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800616:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800619:	01 f0                	add    %esi,%eax
+  80061b:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80061d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800621:	85 c0                	test   %eax,%eax
+  800623:	0f 8e 41 fd ff ff    	jle    80036a <vprintfmt+0x31>
+  800629:	4c 89 ee             	mov    %r13,%rsi
+  80062c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800631:	41 ff d6             	call   *%r14
+  800634:	41 83 ec 01          	sub    $0x1,%r12d
+  800638:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80063c:	75 eb                	jne    800629 <vprintfmt+0x2f0>
+  80063e:	e9 27 fd ff ff       	jmp    80036a <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800643:	40 84 f6             	test   %sil,%sil
+  800646:	75 26                	jne    80066e <vprintfmt+0x335>
+    switch (lflag) {
+  800648:	85 d2                	test   %edx,%edx
+  80064a:	74 59                	je     8006a5 <vprintfmt+0x36c>
+  80064c:	83 fa 01             	cmp    $0x1,%edx
+  80064f:	74 7b                	je     8006cc <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800651:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800654:	83 f8 2f             	cmp    $0x2f,%eax
+  800657:	0f 87 96 00 00 00    	ja     8006f3 <vprintfmt+0x3ba>
+  80065d:	89 c2                	mov    %eax,%edx
+  80065f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800663:	83 c0 08             	add    $0x8,%eax
+  800666:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800669:	4c 8b 22             	mov    (%rdx),%r12
+  80066c:	eb 17                	jmp    800685 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80066e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800671:	83 f8 2f             	cmp    $0x2f,%eax
+  800674:	77 21                	ja     800697 <vprintfmt+0x35e>
+  800676:	89 c2                	mov    %eax,%edx
+  800678:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067c:	83 c0 08             	add    $0x8,%eax
+  80067f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800682:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800685:	4d 85 e4             	test   %r12,%r12
+  800688:	78 7a                	js     800704 <vprintfmt+0x3cb>
+            num = i;
+  80068a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80068d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800692:	e9 b5 02 00 00       	jmp    80094c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800697:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80069b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80069f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a3:	eb dd                	jmp    800682 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8006a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ab:	77 11                	ja     8006be <vprintfmt+0x385>
+  8006ad:	89 c2                	mov    %eax,%edx
+  8006af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b3:	83 c0 08             	add    $0x8,%eax
+  8006b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b9:	4c 63 22             	movslq (%rdx),%r12
+  8006bc:	eb c7                	jmp    800685 <vprintfmt+0x34c>
+  8006be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ca:	eb ed                	jmp    8006b9 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8006cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d2:	77 11                	ja     8006e5 <vprintfmt+0x3ac>
+  8006d4:	89 c2                	mov    %eax,%edx
+  8006d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006da:	83 c0 08             	add    $0x8,%eax
+  8006dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e0:	4c 8b 22             	mov    (%rdx),%r12
+  8006e3:	eb a0                	jmp    800685 <vprintfmt+0x34c>
+  8006e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f1:	eb ed                	jmp    8006e0 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8006f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ff:	e9 65 ff ff ff       	jmp    800669 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800704:	4c 89 ee             	mov    %r13,%rsi
+  800707:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80070c:	41 ff d6             	call   *%r14
+                i = -i;
+  80070f:	49 f7 dc             	neg    %r12
+  800712:	e9 73 ff ff ff       	jmp    80068a <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800717:	40 84 f6             	test   %sil,%sil
+  80071a:	75 32                	jne    80074e <vprintfmt+0x415>
+    switch (lflag) {
+  80071c:	85 d2                	test   %edx,%edx
+  80071e:	74 5d                	je     80077d <vprintfmt+0x444>
+  800720:	83 fa 01             	cmp    $0x1,%edx
+  800723:	0f 84 82 00 00 00    	je     8007ab <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800729:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072c:	83 f8 2f             	cmp    $0x2f,%eax
+  80072f:	0f 87 a5 00 00 00    	ja     8007da <vprintfmt+0x4a1>
+  800735:	89 c2                	mov    %eax,%edx
+  800737:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073b:	83 c0 08             	add    $0x8,%eax
+  80073e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800741:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800744:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800749:	e9 fe 01 00 00       	jmp    80094c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80074e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800751:	83 f8 2f             	cmp    $0x2f,%eax
+  800754:	77 19                	ja     80076f <vprintfmt+0x436>
+  800756:	89 c2                	mov    %eax,%edx
+  800758:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075c:	83 c0 08             	add    $0x8,%eax
+  80075f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800762:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800765:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80076a:	e9 dd 01 00 00       	jmp    80094c <vprintfmt+0x613>
+  80076f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800773:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800777:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077b:	eb e5                	jmp    800762 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80077d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800780:	83 f8 2f             	cmp    $0x2f,%eax
+  800783:	77 18                	ja     80079d <vprintfmt+0x464>
+  800785:	89 c2                	mov    %eax,%edx
+  800787:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078b:	83 c0 08             	add    $0x8,%eax
+  80078e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800791:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800793:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800798:	e9 af 01 00 00       	jmp    80094c <vprintfmt+0x613>
+  80079d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a9:	eb e6                	jmp    800791 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8007ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b1:	77 19                	ja     8007cc <vprintfmt+0x493>
+  8007b3:	89 c2                	mov    %eax,%edx
+  8007b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b9:	83 c0 08             	add    $0x8,%eax
+  8007bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007c2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007c7:	e9 80 01 00 00       	jmp    80094c <vprintfmt+0x613>
+  8007cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d8:	eb e5                	jmp    8007bf <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8007da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e6:	e9 56 ff ff ff       	jmp    800741 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8007eb:	40 84 f6             	test   %sil,%sil
+  8007ee:	75 2e                	jne    80081e <vprintfmt+0x4e5>
+    switch (lflag) {
+  8007f0:	85 d2                	test   %edx,%edx
+  8007f2:	0f 84 b3 00 00 00    	je     8008ab <vprintfmt+0x572>
+  8007f8:	83 fa 01             	cmp    $0x1,%edx
+  8007fb:	0f 84 d3 00 00 00    	je     8008d4 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800801:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800804:	83 f8 2f             	cmp    $0x2f,%eax
+  800807:	0f 87 f1 00 00 00    	ja     8008fe <vprintfmt+0x5c5>
+  80080d:	89 c2                	mov    %eax,%edx
+  80080f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800813:	83 c0 08             	add    $0x8,%eax
+  800816:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800819:	48 8b 02             	mov    (%rdx),%rax
+  80081c:	eb 17                	jmp    800835 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  80081e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800821:	83 f8 2f             	cmp    $0x2f,%eax
+  800824:	77 77                	ja     80089d <vprintfmt+0x564>
+  800826:	89 c2                	mov    %eax,%edx
+  800828:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082c:	83 c0 08             	add    $0x8,%eax
+  80082f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800832:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800835:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800837:	83 f8 07             	cmp    $0x7,%eax
+  80083a:	0f 8e cf 00 00 00    	jle    80090f <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800840:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800846:	44 89 e7             	mov    %r12d,%edi
+  800849:	41 c1 e4 03          	shl    $0x3,%r12d
+  80084d:	89 d1                	mov    %edx,%ecx
+  80084f:	8d 72 07             	lea    0x7(%rdx),%esi
+  800852:	85 d2                	test   %edx,%edx
+  800854:	0f 48 d6             	cmovs  %esi,%edx
+  800857:	c1 fa 03             	sar    $0x3,%edx
+  80085a:	83 f9 3f             	cmp    $0x3f,%ecx
+  80085d:	7f e7                	jg     800846 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80085f:	85 ff                	test   %edi,%edi
+  800861:	0f 84 03 fb ff ff    	je     80036a <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800867:	49 63 f4             	movslq %r12d,%rsi
+  80086a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80086f:	48 f7 f6             	div    %rsi
+  800872:	49 89 d7             	mov    %rdx,%r15
+  800875:	83 c0 30             	add    $0x30,%eax
+  800878:	0f be f8             	movsbl %al,%edi
+  80087b:	4c 89 ee             	mov    %r13,%rsi
+  80087e:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800881:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800884:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800889:	45 85 e4             	test   %r12d,%r12d
+  80088c:	41 0f 49 d4          	cmovns %r12d,%edx
+  800890:	c1 fa 03             	sar    $0x3,%edx
+  800893:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800896:	75 cf                	jne    800867 <vprintfmt+0x52e>
+  800898:	e9 cd fa ff ff       	jmp    80036a <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80089d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a9:	eb 87                	jmp    800832 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  8008ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b1:	77 13                	ja     8008c6 <vprintfmt+0x58d>
+  8008b3:	89 c2                	mov    %eax,%edx
+  8008b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b9:	83 c0 08             	add    $0x8,%eax
+  8008bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bf:	8b 02                	mov    (%rdx),%eax
+  8008c1:	e9 6f ff ff ff       	jmp    800835 <vprintfmt+0x4fc>
+  8008c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d2:	eb eb                	jmp    8008bf <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8008d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008da:	77 14                	ja     8008f0 <vprintfmt+0x5b7>
+  8008dc:	89 c2                	mov    %eax,%edx
+  8008de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e2:	83 c0 08             	add    $0x8,%eax
+  8008e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e8:	48 8b 02             	mov    (%rdx),%rax
+  8008eb:	e9 45 ff ff ff       	jmp    800835 <vprintfmt+0x4fc>
+  8008f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fc:	eb ea                	jmp    8008e8 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8008fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800902:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800906:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090a:	e9 0a ff ff ff       	jmp    800819 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  80090f:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800915:	e9 4d ff ff ff       	jmp    800867 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  80091a:	4c 89 ee             	mov    %r13,%rsi
+  80091d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800922:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800925:	4c 89 ee             	mov    %r13,%rsi
+  800928:	bf 78 00 00 00       	mov    $0x78,%edi
+  80092d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800930:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800933:	83 f8 2f             	cmp    $0x2f,%eax
+  800936:	77 47                	ja     80097f <vprintfmt+0x646>
+  800938:	89 c2                	mov    %eax,%edx
+  80093a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093e:	83 c0 08             	add    $0x8,%eax
+  800941:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800944:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800947:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80094c:	48 83 ec 08          	sub    $0x8,%rsp
+  800950:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800954:	0f 94 c0             	sete   %al
+  800957:	0f b6 c0             	movzbl %al,%eax
+  80095a:	50                   	push   %rax
+  80095b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800960:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800964:	4c 89 ee             	mov    %r13,%rsi
+  800967:	4c 89 f7             	mov    %r14,%rdi
+  80096a:	48 b8 2e 02 80 00 00 	movabs $0x80022e,%rax
+  800971:	00 00 00 
+  800974:	ff d0                	call   *%rax
+            break;
+  800976:	48 83 c4 10          	add    $0x10,%rsp
+  80097a:	e9 eb f9 ff ff       	jmp    80036a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80097f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800983:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800987:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098b:	eb b7                	jmp    800944 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  80098d:	40 84 f6             	test   %sil,%sil
+  800990:	75 2b                	jne    8009bd <vprintfmt+0x684>
+    switch (lflag) {
+  800992:	85 d2                	test   %edx,%edx
+  800994:	74 56                	je     8009ec <vprintfmt+0x6b3>
+  800996:	83 fa 01             	cmp    $0x1,%edx
+  800999:	74 7f                	je     800a1a <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  80099b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099e:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a1:	0f 87 a2 00 00 00    	ja     800a49 <vprintfmt+0x710>
+  8009a7:	89 c2                	mov    %eax,%edx
+  8009a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ad:	83 c0 08             	add    $0x8,%eax
+  8009b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009bb:	eb 8f                	jmp    80094c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c3:	77 19                	ja     8009de <vprintfmt+0x6a5>
+  8009c5:	89 c2                	mov    %eax,%edx
+  8009c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cb:	83 c0 08             	add    $0x8,%eax
+  8009ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009d9:	e9 6e ff ff ff       	jmp    80094c <vprintfmt+0x613>
+  8009de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ea:	eb e5                	jmp    8009d1 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8009ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f2:	77 18                	ja     800a0c <vprintfmt+0x6d3>
+  8009f4:	89 c2                	mov    %eax,%edx
+  8009f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fa:	83 c0 08             	add    $0x8,%eax
+  8009fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a00:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a02:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a07:	e9 40 ff ff ff       	jmp    80094c <vprintfmt+0x613>
+  800a0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a18:	eb e6                	jmp    800a00 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a20:	77 19                	ja     800a3b <vprintfmt+0x702>
+  800a22:	89 c2                	mov    %eax,%edx
+  800a24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a28:	83 c0 08             	add    $0x8,%eax
+  800a2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a31:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a36:	e9 11 ff ff ff       	jmp    80094c <vprintfmt+0x613>
+  800a3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a47:	eb e5                	jmp    800a2e <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800a49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a55:	e9 59 ff ff ff       	jmp    8009b3 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800a5a:	4c 89 ee             	mov    %r13,%rsi
+  800a5d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a62:	41 ff d6             	call   *%r14
+            break;
+  800a65:	e9 00 f9 ff ff       	jmp    80036a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a6a:	4c 89 ee             	mov    %r13,%rsi
+  800a6d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a72:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a75:	48 83 eb 01          	sub    $0x1,%rbx
+  800a79:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a7d:	75 f6                	jne    800a75 <vprintfmt+0x73c>
+  800a7f:	e9 e6 f8 ff ff       	jmp    80036a <vprintfmt+0x31>
+}
+  800a84:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a88:	5b                   	pop    %rbx
+  800a89:	41 5c                	pop    %r12
+  800a8b:	41 5d                	pop    %r13
+  800a8d:	41 5e                	pop    %r14
+  800a8f:	41 5f                	pop    %r15
+  800a91:	5d                   	pop    %rbp
+  800a92:	c3                   	ret
+
+0000000000800a93 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a93:	55                   	push   %rbp
+  800a94:	48 89 e5             	mov    %rsp,%rbp
+  800a97:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a9b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a9f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800aa4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800aa8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800aaf:	48 85 ff             	test   %rdi,%rdi
+  800ab2:	74 2b                	je     800adf <vsnprintf+0x4c>
+  800ab4:	48 85 f6             	test   %rsi,%rsi
+  800ab7:	74 26                	je     800adf <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ab9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800abd:	48 bf e4 02 80 00 00 	movabs $0x8002e4,%rdi
+  800ac4:	00 00 00 
+  800ac7:	48 b8 39 03 80 00 00 	movabs $0x800339,%rax
+  800ace:	00 00 00 
+  800ad1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ad3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ada:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800add:	c9                   	leave
+  800ade:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800adf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae4:	eb f7                	jmp    800add <vsnprintf+0x4a>
+
+0000000000800ae6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ae6:	55                   	push   %rbp
+  800ae7:	48 89 e5             	mov    %rsp,%rbp
+  800aea:	48 83 ec 50          	sub    $0x50,%rsp
+  800aee:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800af2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800af6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800afa:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b01:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b09:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b0d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b11:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b15:	48 b8 93 0a 80 00 00 	movabs $0x800a93,%rax
+  800b1c:	00 00 00 
+  800b1f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b21:	c9                   	leave
+  800b22:	c3                   	ret
+
+0000000000800b23 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b23:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b26:	74 10                	je     800b38 <strlen+0x15>
+    size_t n = 0;
+  800b28:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b2d:	48 83 c0 01          	add    $0x1,%rax
+  800b31:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b35:	75 f6                	jne    800b2d <strlen+0xa>
+  800b37:	c3                   	ret
+    size_t n = 0;
+  800b38:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b3d:	c3                   	ret
+
+0000000000800b3e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b3e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b41:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b46:	48 85 f6             	test   %rsi,%rsi
+  800b49:	74 11                	je     800b5c <strnlen+0x1e>
+  800b4b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b4f:	74 0c                	je     800b5d <strnlen+0x1f>
+  800b51:	48 83 c2 01          	add    $0x1,%rdx
+  800b55:	48 39 d0             	cmp    %rdx,%rax
+  800b58:	75 f1                	jne    800b4b <strnlen+0xd>
+  800b5a:	eb 04                	jmp    800b60 <strnlen+0x22>
+  800b5c:	c3                   	ret
+  800b5d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b60:	c3                   	ret
+
+0000000000800b61 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b61:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b69:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b6d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b70:	48 83 c2 01          	add    $0x1,%rdx
+  800b74:	84 c9                	test   %cl,%cl
+  800b76:	75 f1                	jne    800b69 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b78:	c3                   	ret
+
+0000000000800b79 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b79:	55                   	push   %rbp
+  800b7a:	48 89 e5             	mov    %rsp,%rbp
+  800b7d:	41 54                	push   %r12
+  800b7f:	53                   	push   %rbx
+  800b80:	48 89 fb             	mov    %rdi,%rbx
+  800b83:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b86:	48 b8 23 0b 80 00 00 	movabs $0x800b23,%rax
+  800b8d:	00 00 00 
+  800b90:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b92:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b96:	4c 89 e6             	mov    %r12,%rsi
+  800b99:	48 b8 61 0b 80 00 00 	movabs $0x800b61,%rax
+  800ba0:	00 00 00 
+  800ba3:	ff d0                	call   *%rax
+    return dst;
+}
+  800ba5:	48 89 d8             	mov    %rbx,%rax
+  800ba8:	5b                   	pop    %rbx
+  800ba9:	41 5c                	pop    %r12
+  800bab:	5d                   	pop    %rbp
+  800bac:	c3                   	ret
+
+0000000000800bad <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bad:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bb0:	48 85 d2             	test   %rdx,%rdx
+  800bb3:	74 1f                	je     800bd4 <strncpy+0x27>
+  800bb5:	48 01 fa             	add    %rdi,%rdx
+  800bb8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bbb:	48 83 c1 01          	add    $0x1,%rcx
+  800bbf:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bc3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bc7:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bcb:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bcf:	48 39 ca             	cmp    %rcx,%rdx
+  800bd2:	75 e7                	jne    800bbb <strncpy+0xe>
+    }
+    return ret;
+}
+  800bd4:	c3                   	ret
+
+0000000000800bd5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bd5:	48 89 f8             	mov    %rdi,%rax
+  800bd8:	48 85 d2             	test   %rdx,%rdx
+  800bdb:	74 24                	je     800c01 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bdd:	48 83 ea 01          	sub    $0x1,%rdx
+  800be1:	74 1b                	je     800bfe <strlcpy+0x29>
+  800be3:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800be7:	0f b6 16             	movzbl (%rsi),%edx
+  800bea:	84 d2                	test   %dl,%dl
+  800bec:	74 10                	je     800bfe <strlcpy+0x29>
+            *dst++ = *src++;
+  800bee:	48 83 c6 01          	add    $0x1,%rsi
+  800bf2:	48 83 c0 01          	add    $0x1,%rax
+  800bf6:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bf9:	48 39 c8             	cmp    %rcx,%rax
+  800bfc:	75 e9                	jne    800be7 <strlcpy+0x12>
+        *dst = '\0';
+  800bfe:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c01:	48 29 f8             	sub    %rdi,%rax
+}
+  800c04:	c3                   	ret
+
+0000000000800c05 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c05:	0f b6 07             	movzbl (%rdi),%eax
+  800c08:	84 c0                	test   %al,%al
+  800c0a:	74 13                	je     800c1f <strcmp+0x1a>
+  800c0c:	38 06                	cmp    %al,(%rsi)
+  800c0e:	75 0f                	jne    800c1f <strcmp+0x1a>
+  800c10:	48 83 c7 01          	add    $0x1,%rdi
+  800c14:	48 83 c6 01          	add    $0x1,%rsi
+  800c18:	0f b6 07             	movzbl (%rdi),%eax
+  800c1b:	84 c0                	test   %al,%al
+  800c1d:	75 ed                	jne    800c0c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c1f:	0f b6 c0             	movzbl %al,%eax
+  800c22:	0f b6 16             	movzbl (%rsi),%edx
+  800c25:	29 d0                	sub    %edx,%eax
+}
+  800c27:	c3                   	ret
+
+0000000000800c28 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c28:	48 85 d2             	test   %rdx,%rdx
+  800c2b:	74 1f                	je     800c4c <strncmp+0x24>
+  800c2d:	0f b6 07             	movzbl (%rdi),%eax
+  800c30:	84 c0                	test   %al,%al
+  800c32:	74 1e                	je     800c52 <strncmp+0x2a>
+  800c34:	3a 06                	cmp    (%rsi),%al
+  800c36:	75 1a                	jne    800c52 <strncmp+0x2a>
+  800c38:	48 83 c7 01          	add    $0x1,%rdi
+  800c3c:	48 83 c6 01          	add    $0x1,%rsi
+  800c40:	48 83 ea 01          	sub    $0x1,%rdx
+  800c44:	75 e7                	jne    800c2d <strncmp+0x5>
+
+    if (!n) return 0;
+  800c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4b:	c3                   	ret
+  800c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c51:	c3                   	ret
+  800c52:	48 85 d2             	test   %rdx,%rdx
+  800c55:	74 09                	je     800c60 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c57:	0f b6 07             	movzbl (%rdi),%eax
+  800c5a:	0f b6 16             	movzbl (%rsi),%edx
+  800c5d:	29 d0                	sub    %edx,%eax
+  800c5f:	c3                   	ret
+    if (!n) return 0;
+  800c60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c65:	c3                   	ret
+
+0000000000800c66 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c66:	0f b6 17             	movzbl (%rdi),%edx
+  800c69:	84 d2                	test   %dl,%dl
+  800c6b:	74 18                	je     800c85 <strchr+0x1f>
+        if (*str == c) {
+  800c6d:	0f be d2             	movsbl %dl,%edx
+  800c70:	39 f2                	cmp    %esi,%edx
+  800c72:	74 17                	je     800c8b <strchr+0x25>
+    for (; *str; str++) {
+  800c74:	48 83 c7 01          	add    $0x1,%rdi
+  800c78:	0f b6 17             	movzbl (%rdi),%edx
+  800c7b:	84 d2                	test   %dl,%dl
+  800c7d:	75 ee                	jne    800c6d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c84:	c3                   	ret
+  800c85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8a:	c3                   	ret
+  800c8b:	48 89 f8             	mov    %rdi,%rax
+}
+  800c8e:	c3                   	ret
+
+0000000000800c8f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c8f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c92:	0f b6 17             	movzbl (%rdi),%edx
+  800c95:	84 d2                	test   %dl,%dl
+  800c97:	74 13                	je     800cac <strfind+0x1d>
+  800c99:	0f be d2             	movsbl %dl,%edx
+  800c9c:	39 f2                	cmp    %esi,%edx
+  800c9e:	74 0b                	je     800cab <strfind+0x1c>
+  800ca0:	48 83 c0 01          	add    $0x1,%rax
+  800ca4:	0f b6 10             	movzbl (%rax),%edx
+  800ca7:	84 d2                	test   %dl,%dl
+  800ca9:	75 ee                	jne    800c99 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cab:	c3                   	ret
+  800cac:	c3                   	ret
+
+0000000000800cad <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800cad:	55                   	push   %rbp
+  800cae:	48 89 e5             	mov    %rsp,%rbp
+  800cb1:	41 57                	push   %r15
+  800cb3:	41 56                	push   %r14
+  800cb5:	41 55                	push   %r13
+  800cb7:	41 54                	push   %r12
+  800cb9:	53                   	push   %rbx
+  800cba:	48 83 ec 08          	sub    $0x8,%rsp
+  800cbe:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800cc1:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800cc5:	45 84 ed             	test   %r13b,%r13b
+  800cc8:	75 12                	jne    800cdc <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800cca:	4c 89 f8             	mov    %r15,%rax
+  800ccd:	48 83 c4 08          	add    $0x8,%rsp
+  800cd1:	5b                   	pop    %rbx
+  800cd2:	41 5c                	pop    %r12
+  800cd4:	41 5d                	pop    %r13
+  800cd6:	41 5e                	pop    %r14
+  800cd8:	41 5f                	pop    %r15
+  800cda:	5d                   	pop    %rbp
+  800cdb:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800cdc:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800ce0:	4c 89 e7             	mov    %r12,%rdi
+  800ce3:	48 b8 23 0b 80 00 00 	movabs $0x800b23,%rax
+  800cea:	00 00 00 
+  800ced:	ff d0                	call   *%rax
+  800cef:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800cf2:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800cf6:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800cfa:	49 bf 28 0c 80 00 00 	movabs $0x800c28,%r15
+  800d01:	00 00 00 
+				if ((sc = *s++) == 0)
+  800d04:	84 c0                	test   %al,%al
+  800d06:	75 14                	jne    800d1c <strstr+0x6f>
+					return NULL;
+  800d08:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d0e:	eb ba                	jmp    800cca <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800d10:	48 83 c3 01          	add    $0x1,%rbx
+  800d14:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800d18:	84 c0                	test   %al,%al
+  800d1a:	74 1b                	je     800d37 <strstr+0x8a>
+			} while (sc != c);
+  800d1c:	41 38 c5             	cmp    %al,%r13b
+  800d1f:	75 ef                	jne    800d10 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800d21:	4c 89 f2             	mov    %r14,%rdx
+  800d24:	4c 89 e6             	mov    %r12,%rsi
+  800d27:	48 89 df             	mov    %rbx,%rdi
+  800d2a:	41 ff d7             	call   *%r15
+  800d2d:	85 c0                	test   %eax,%eax
+  800d2f:	75 df                	jne    800d10 <strstr+0x63>
+  800d31:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800d35:	eb 93                	jmp    800cca <strstr+0x1d>
+					return NULL;
+  800d37:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d3d:	eb 8b                	jmp    800cca <strstr+0x1d>
+
+0000000000800d3f <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800d3f:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800d41:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800d44:	8d 57 20             	lea    0x20(%rdi),%edx
+  800d47:	83 f9 1a             	cmp    $0x1a,%ecx
+  800d4a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800d4d:	c3                   	ret
+
+0000000000800d4e <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800d4e:	55                   	push   %rbp
+  800d4f:	48 89 e5             	mov    %rsp,%rbp
+  800d52:	41 57                	push   %r15
+  800d54:	41 56                	push   %r14
+  800d56:	41 55                	push   %r13
+  800d58:	41 54                	push   %r12
+  800d5a:	53                   	push   %rbx
+  800d5b:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800d5f:	48 39 f7             	cmp    %rsi,%rdi
+  800d62:	74 49                	je     800dad <strcasecmp+0x5f>
+  800d64:	49 89 fd             	mov    %rdi,%r13
+  800d67:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800d6a:	49 bf 3f 0d 80 00 00 	movabs $0x800d3f,%r15
+  800d71:	00 00 00 
+  800d74:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800d79:	41 0f b6 fe          	movzbl %r14b,%edi
+  800d7d:	41 ff d7             	call   *%r15
+  800d80:	89 c3                	mov    %eax,%ebx
+  800d82:	49 83 c4 01          	add    $0x1,%r12
+  800d86:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800d8c:	41 ff d7             	call   *%r15
+  800d8f:	29 c3                	sub    %eax,%ebx
+  800d91:	75 09                	jne    800d9c <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800d93:	49 83 c5 01          	add    $0x1,%r13
+  800d97:	45 84 f6             	test   %r14b,%r14b
+  800d9a:	75 d8                	jne    800d74 <strcasecmp+0x26>
+}
+  800d9c:	89 d8                	mov    %ebx,%eax
+  800d9e:	48 83 c4 08          	add    $0x8,%rsp
+  800da2:	5b                   	pop    %rbx
+  800da3:	41 5c                	pop    %r12
+  800da5:	41 5d                	pop    %r13
+  800da7:	41 5e                	pop    %r14
+  800da9:	41 5f                	pop    %r15
+  800dab:	5d                   	pop    %rbp
+  800dac:	c3                   	ret
+        return 0;
+  800dad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db2:	eb e8                	jmp    800d9c <strcasecmp+0x4e>
+
+0000000000800db4 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800db4:	55                   	push   %rbp
+  800db5:	48 89 e5             	mov    %rsp,%rbp
+  800db8:	41 57                	push   %r15
+  800dba:	41 56                	push   %r14
+  800dbc:	41 55                	push   %r13
+  800dbe:	41 54                	push   %r12
+  800dc0:	53                   	push   %rbx
+  800dc1:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800dc5:	48 85 d2             	test   %rdx,%rdx
+  800dc8:	74 4f                	je     800e19 <strncasecmp+0x65>
+  800dca:	49 89 fc             	mov    %rdi,%r12
+  800dcd:	49 89 f5             	mov    %rsi,%r13
+  800dd0:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800dd4:	49 be 3f 0d 80 00 00 	movabs $0x800d3f,%r14
+  800ddb:	00 00 00 
+  800dde:	49 83 c4 01          	add    $0x1,%r12
+  800de2:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800de8:	41 ff d6             	call   *%r14
+  800deb:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800ded:	49 83 c5 01          	add    $0x1,%r13
+  800df1:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800df6:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800df9:	29 c3                	sub    %eax,%ebx
+  800dfb:	85 c0                	test   %eax,%eax
+  800dfd:	74 09                	je     800e08 <strncasecmp+0x54>
+  800dff:	85 db                	test   %ebx,%ebx
+  800e01:	75 05                	jne    800e08 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800e03:	4d 39 fc             	cmp    %r15,%r12
+  800e06:	75 d6                	jne    800dde <strncasecmp+0x2a>
+}
+  800e08:	89 d8                	mov    %ebx,%eax
+  800e0a:	48 83 c4 08          	add    $0x8,%rsp
+  800e0e:	5b                   	pop    %rbx
+  800e0f:	41 5c                	pop    %r12
+  800e11:	41 5d                	pop    %r13
+  800e13:	41 5e                	pop    %r14
+  800e15:	41 5f                	pop    %r15
+  800e17:	5d                   	pop    %rbp
+  800e18:	c3                   	ret
+    int d = 0;
+  800e19:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800e1e:	eb e8                	jmp    800e08 <strncasecmp+0x54>
+
+0000000000800e20 <toupper>:
+
+int toupper(int c) {
+  800e20:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800e22:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800e25:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800e28:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e2b:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e2e:	c3                   	ret
+
+0000000000800e2f <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800e2f:	83 ff 20             	cmp    $0x20,%edi
+  800e32:	0f 94 c0             	sete   %al
+  800e35:	0f b6 c0             	movzbl %al,%eax
+}
+  800e38:	c3                   	ret
+
+0000000000800e39 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800e39:	89 f8                	mov    %edi,%eax
+  800e3b:	f7 d8                	neg    %eax
+  800e3d:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800e40:	c3                   	ret
+
+0000000000800e41 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e41:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e44:	48 89 f8             	mov    %rdi,%rax
+  800e47:	48 f7 d8             	neg    %rax
+  800e4a:	83 e0 07             	and    $0x7,%eax
+  800e4d:	49 89 d1             	mov    %rdx,%r9
+  800e50:	49 29 c1             	sub    %rax,%r9
+  800e53:	78 36                	js     800e8b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e55:	40 0f b6 c6          	movzbl %sil,%eax
+  800e59:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e60:	01 01 01 
+  800e63:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e67:	40 f6 c7 07          	test   $0x7,%dil
+  800e6b:	75 38                	jne    800ea5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e6d:	4c 89 c9             	mov    %r9,%rcx
+  800e70:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e74:	74 0c                	je     800e82 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e76:	fc                   	cld
+  800e77:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e7a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e7e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e82:	4d 85 c9             	test   %r9,%r9
+  800e85:	75 45                	jne    800ecc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e87:	4c 89 c0             	mov    %r8,%rax
+  800e8a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e8b:	48 85 d2             	test   %rdx,%rdx
+  800e8e:	74 f7                	je     800e87 <memset+0x46>
+  800e90:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e93:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e96:	48 83 c0 01          	add    $0x1,%rax
+  800e9a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e9e:	48 39 c2             	cmp    %rax,%rdx
+  800ea1:	75 f3                	jne    800e96 <memset+0x55>
+  800ea3:	eb e2                	jmp    800e87 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ea5:	40 f6 c7 01          	test   $0x1,%dil
+  800ea9:	74 06                	je     800eb1 <memset+0x70>
+  800eab:	88 07                	mov    %al,(%rdi)
+  800ead:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eb1:	40 f6 c7 02          	test   $0x2,%dil
+  800eb5:	74 07                	je     800ebe <memset+0x7d>
+  800eb7:	66 89 07             	mov    %ax,(%rdi)
+  800eba:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ebe:	40 f6 c7 04          	test   $0x4,%dil
+  800ec2:	74 a9                	je     800e6d <memset+0x2c>
+  800ec4:	89 07                	mov    %eax,(%rdi)
+  800ec6:	48 83 c7 04          	add    $0x4,%rdi
+  800eca:	eb a1                	jmp    800e6d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ecc:	41 f6 c1 04          	test   $0x4,%r9b
+  800ed0:	74 06                	je     800ed8 <memset+0x97>
+  800ed2:	89 07                	mov    %eax,(%rdi)
+  800ed4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ed8:	41 f6 c1 02          	test   $0x2,%r9b
+  800edc:	74 07                	je     800ee5 <memset+0xa4>
+  800ede:	66 89 07             	mov    %ax,(%rdi)
+  800ee1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ee5:	41 f6 c1 01          	test   $0x1,%r9b
+  800ee9:	74 9c                	je     800e87 <memset+0x46>
+  800eeb:	88 07                	mov    %al,(%rdi)
+  800eed:	eb 98                	jmp    800e87 <memset+0x46>
+
+0000000000800eef <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800eef:	48 89 f8             	mov    %rdi,%rax
+  800ef2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ef5:	48 39 fe             	cmp    %rdi,%rsi
+  800ef8:	73 3b                	jae    800f35 <memmove+0x46>
+  800efa:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800efe:	48 39 d7             	cmp    %rdx,%rdi
+  800f01:	73 32                	jae    800f35 <memmove+0x46>
+        s += n;
+        d += n;
+  800f03:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f07:	48 89 d6             	mov    %rdx,%rsi
+  800f0a:	48 09 fe             	or     %rdi,%rsi
+  800f0d:	48 09 ce             	or     %rcx,%rsi
+  800f10:	40 f6 c6 07          	test   $0x7,%sil
+  800f14:	75 12                	jne    800f28 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f16:	48 83 ef 08          	sub    $0x8,%rdi
+  800f1a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f1e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f22:	fd                   	std
+  800f23:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f26:	fc                   	cld
+  800f27:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f28:	48 83 ef 01          	sub    $0x1,%rdi
+  800f2c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f30:	fd                   	std
+  800f31:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f33:	eb f1                	jmp    800f26 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f35:	48 89 f2             	mov    %rsi,%rdx
+  800f38:	48 09 c2             	or     %rax,%rdx
+  800f3b:	48 09 ca             	or     %rcx,%rdx
+  800f3e:	f6 c2 07             	test   $0x7,%dl
+  800f41:	75 0c                	jne    800f4f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f43:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f47:	48 89 c7             	mov    %rax,%rdi
+  800f4a:	fc                   	cld
+  800f4b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f4e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f4f:	48 89 c7             	mov    %rax,%rdi
+  800f52:	fc                   	cld
+  800f53:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f55:	c3                   	ret
+
+0000000000800f56 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f56:	55                   	push   %rbp
+  800f57:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f5a:	48 b8 ef 0e 80 00 00 	movabs $0x800eef,%rax
+  800f61:	00 00 00 
+  800f64:	ff d0                	call   *%rax
+}
+  800f66:	5d                   	pop    %rbp
+  800f67:	c3                   	ret
+
+0000000000800f68 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f68:	55                   	push   %rbp
+  800f69:	48 89 e5             	mov    %rsp,%rbp
+  800f6c:	41 57                	push   %r15
+  800f6e:	41 56                	push   %r14
+  800f70:	41 55                	push   %r13
+  800f72:	41 54                	push   %r12
+  800f74:	53                   	push   %rbx
+  800f75:	48 83 ec 08          	sub    $0x8,%rsp
+  800f79:	49 89 fe             	mov    %rdi,%r14
+  800f7c:	49 89 f7             	mov    %rsi,%r15
+  800f7f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f82:	48 89 f7             	mov    %rsi,%rdi
+  800f85:	48 b8 23 0b 80 00 00 	movabs $0x800b23,%rax
+  800f8c:	00 00 00 
+  800f8f:	ff d0                	call   *%rax
+  800f91:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f94:	48 89 de             	mov    %rbx,%rsi
+  800f97:	4c 89 f7             	mov    %r14,%rdi
+  800f9a:	48 b8 3e 0b 80 00 00 	movabs $0x800b3e,%rax
+  800fa1:	00 00 00 
+  800fa4:	ff d0                	call   *%rax
+  800fa6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fa9:	48 39 c3             	cmp    %rax,%rbx
+  800fac:	74 36                	je     800fe4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fae:	48 89 d8             	mov    %rbx,%rax
+  800fb1:	4c 29 e8             	sub    %r13,%rax
+  800fb4:	49 39 c4             	cmp    %rax,%r12
+  800fb7:	73 31                	jae    800fea <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fb9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fbe:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fc2:	4c 89 fe             	mov    %r15,%rsi
+  800fc5:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  800fcc:	00 00 00 
+  800fcf:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fd1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fd5:	48 83 c4 08          	add    $0x8,%rsp
+  800fd9:	5b                   	pop    %rbx
+  800fda:	41 5c                	pop    %r12
+  800fdc:	41 5d                	pop    %r13
+  800fde:	41 5e                	pop    %r14
+  800fe0:	41 5f                	pop    %r15
+  800fe2:	5d                   	pop    %rbp
+  800fe3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fe4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fe8:	eb eb                	jmp    800fd5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fea:	48 83 eb 01          	sub    $0x1,%rbx
+  800fee:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ff2:	48 89 da             	mov    %rbx,%rdx
+  800ff5:	4c 89 fe             	mov    %r15,%rsi
+  800ff8:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  800fff:	00 00 00 
+  801002:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801004:	49 01 de             	add    %rbx,%r14
+  801007:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80100c:	eb c3                	jmp    800fd1 <strlcat+0x69>
+
+000000000080100e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80100e:	48 85 d2             	test   %rdx,%rdx
+  801011:	74 2d                	je     801040 <memcmp+0x32>
+  801013:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801018:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80101c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801021:	44 38 c1             	cmp    %r8b,%cl
+  801024:	75 0f                	jne    801035 <memcmp+0x27>
+    while (n-- > 0) {
+  801026:	48 83 c0 01          	add    $0x1,%rax
+  80102a:	48 39 c2             	cmp    %rax,%rdx
+  80102d:	75 e9                	jne    801018 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80102f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801034:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801035:	0f b6 c1             	movzbl %cl,%eax
+  801038:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80103c:	44 29 c0             	sub    %r8d,%eax
+  80103f:	c3                   	ret
+    return 0;
+  801040:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801045:	c3                   	ret
+
+0000000000801046 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801046:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80104a:	48 39 c7             	cmp    %rax,%rdi
+  80104d:	73 0f                	jae    80105e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80104f:	40 38 37             	cmp    %sil,(%rdi)
+  801052:	74 0e                	je     801062 <memfind+0x1c>
+    for (; src < end; src++) {
+  801054:	48 83 c7 01          	add    $0x1,%rdi
+  801058:	48 39 f8             	cmp    %rdi,%rax
+  80105b:	75 f2                	jne    80104f <memfind+0x9>
+  80105d:	c3                   	ret
+  80105e:	48 89 f8             	mov    %rdi,%rax
+  801061:	c3                   	ret
+  801062:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801065:	c3                   	ret
+
+0000000000801066 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801066:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801069:	0f b6 37             	movzbl (%rdi),%esi
+  80106c:	40 80 fe 20          	cmp    $0x20,%sil
+  801070:	74 06                	je     801078 <strtol+0x12>
+  801072:	40 80 fe 09          	cmp    $0x9,%sil
+  801076:	75 13                	jne    80108b <strtol+0x25>
+  801078:	48 83 c7 01          	add    $0x1,%rdi
+  80107c:	0f b6 37             	movzbl (%rdi),%esi
+  80107f:	40 80 fe 20          	cmp    $0x20,%sil
+  801083:	74 f3                	je     801078 <strtol+0x12>
+  801085:	40 80 fe 09          	cmp    $0x9,%sil
+  801089:	74 ed                	je     801078 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80108b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80108e:	83 e0 fd             	and    $0xfffffffd,%eax
+  801091:	3c 01                	cmp    $0x1,%al
+  801093:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801097:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80109d:	75 0f                	jne    8010ae <strtol+0x48>
+  80109f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010a2:	74 14                	je     8010b8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010a4:	85 d2                	test   %edx,%edx
+  8010a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ab:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010ae:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010b3:	4c 63 ca             	movslq %edx,%r9
+  8010b6:	eb 36                	jmp    8010ee <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010b8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010bc:	74 0f                	je     8010cd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010be:	85 d2                	test   %edx,%edx
+  8010c0:	75 ec                	jne    8010ae <strtol+0x48>
+        s++;
+  8010c2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010c6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010cb:	eb e1                	jmp    8010ae <strtol+0x48>
+        s += 2;
+  8010cd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010d1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010d6:	eb d6                	jmp    8010ae <strtol+0x48>
+            dig -= '0';
+  8010d8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010db:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010df:	41 39 d0             	cmp    %edx,%r8d
+  8010e2:	7d 21                	jge    801105 <strtol+0x9f>
+        val = val * base + dig;
+  8010e4:	49 0f af c1          	imul   %r9,%rax
+  8010e8:	0f b6 c9             	movzbl %cl,%ecx
+  8010eb:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010ee:	48 83 c7 01          	add    $0x1,%rdi
+  8010f2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010f6:	80 f9 39             	cmp    $0x39,%cl
+  8010f9:	76 dd                	jbe    8010d8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010fb:	80 f9 7b             	cmp    $0x7b,%cl
+  8010fe:	77 05                	ja     801105 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801100:	83 e9 57             	sub    $0x57,%ecx
+  801103:	eb d6                	jmp    8010db <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801105:	4d 85 d2             	test   %r10,%r10
+  801108:	74 03                	je     80110d <strtol+0xa7>
+  80110a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80110d:	48 89 c2             	mov    %rax,%rdx
+  801110:	48 f7 da             	neg    %rdx
+  801113:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801117:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80111b:	c3                   	ret
+
+000000000080111c <atoi>:
+int atoi(const char *str) {
+  80111c:	55                   	push   %rbp
+  80111d:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801120:	ba 00 00 00 00       	mov    $0x0,%edx
+  801125:	be 00 00 00 00       	mov    $0x0,%esi
+  80112a:	48 b8 66 10 80 00 00 	movabs $0x801066,%rax
+  801131:	00 00 00 
+  801134:	ff d0                	call   *%rax
+}
+  801136:	5d                   	pop    %rbp
+  801137:	c3                   	ret
+
+0000000000801138 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801138:	55                   	push   %rbp
+  801139:	48 89 e5             	mov    %rsp,%rbp
+  80113c:	53                   	push   %rbx
+  80113d:	48 89 fa             	mov    %rdi,%rdx
+  801140:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801143:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801148:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801152:	be 00 00 00 00       	mov    $0x0,%esi
+  801157:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80115f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801163:	c9                   	leave
+  801164:	c3                   	ret
+
+0000000000801165 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801165:	55                   	push   %rbp
+  801166:	48 89 e5             	mov    %rsp,%rbp
+  801169:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80116a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80116f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801174:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801179:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801183:	be 00 00 00 00       	mov    $0x0,%esi
+  801188:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80118e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801190:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801194:	c9                   	leave
+  801195:	c3                   	ret
+
+0000000000801196 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801196:	55                   	push   %rbp
+  801197:	48 89 e5             	mov    %rsp,%rbp
+  80119a:	53                   	push   %rbx
+  80119b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80119f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011c3:	48 85 c0             	test   %rax,%rax
+  8011c6:	7f 06                	jg     8011ce <sys_env_destroy+0x38>
+}
+  8011c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011cc:	c9                   	leave
+  8011cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ce:	49 89 c0             	mov    %rax,%r8
+  8011d1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011d6:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8011dd:	00 00 00 
+  8011e0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8011e5:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8011ec:	00 00 00 
+  8011ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f4:	49 b9 60 3f 80 00 00 	movabs $0x803f60,%r9
+  8011fb:	00 00 00 
+  8011fe:	41 ff d1             	call   *%r9
+
+0000000000801201 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801201:	55                   	push   %rbp
+  801202:	48 89 e5             	mov    %rsp,%rbp
+  801205:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801206:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80120b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801210:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121f:	be 00 00 00 00       	mov    $0x0,%esi
+  801224:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80122a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80122c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801230:	c9                   	leave
+  801231:	c3                   	ret
+
+0000000000801232 <sys_yield>:
+
+void
+sys_yield(void) {
+  801232:	55                   	push   %rbp
+  801233:	48 89 e5             	mov    %rsp,%rbp
+  801236:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801237:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80123c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801241:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801246:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801250:	be 00 00 00 00       	mov    $0x0,%esi
+  801255:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80125d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801261:	c9                   	leave
+  801262:	c3                   	ret
+
+0000000000801263 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801263:	55                   	push   %rbp
+  801264:	48 89 e5             	mov    %rsp,%rbp
+  801267:	53                   	push   %rbx
+  801268:	48 89 fa             	mov    %rdi,%rdx
+  80126b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80126e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801273:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80127a:	00 00 00 
+  80127d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801282:	be 00 00 00 00       	mov    $0x0,%esi
+  801287:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80128f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801293:	c9                   	leave
+  801294:	c3                   	ret
+
+0000000000801295 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801295:	55                   	push   %rbp
+  801296:	48 89 e5             	mov    %rsp,%rbp
+  801299:	53                   	push   %rbx
+  80129a:	49 89 f8             	mov    %rdi,%r8
+  80129d:	48 89 d3             	mov    %rdx,%rbx
+  8012a0:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012a3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a8:	4c 89 c2             	mov    %r8,%rdx
+  8012ab:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012bf:	c9                   	leave
+  8012c0:	c3                   	ret
+
+00000000008012c1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012c1:	55                   	push   %rbp
+  8012c2:	48 89 e5             	mov    %rsp,%rbp
+  8012c5:	53                   	push   %rbx
+  8012c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ca:	89 f8                	mov    %edi,%eax
+  8012cc:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012cf:	48 63 f9             	movslq %ecx,%rdi
+  8012d2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012da:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ea:	48 85 c0             	test   %rax,%rax
+  8012ed:	7f 06                	jg     8012f5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f3:	c9                   	leave
+  8012f4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f5:	49 89 c0             	mov    %rax,%r8
+  8012f8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012fd:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801304:	00 00 00 
+  801307:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80130c:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801313:	00 00 00 
+  801316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131b:	49 b9 60 3f 80 00 00 	movabs $0x803f60,%r9
+  801322:	00 00 00 
+  801325:	41 ff d1             	call   *%r9
+
+0000000000801328 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801328:	55                   	push   %rbp
+  801329:	48 89 e5             	mov    %rsp,%rbp
+  80132c:	53                   	push   %rbx
+  80132d:	48 83 ec 08          	sub    $0x8,%rsp
+  801331:	89 f8                	mov    %edi,%eax
+  801333:	49 89 f2             	mov    %rsi,%r10
+  801336:	48 89 cf             	mov    %rcx,%rdi
+  801339:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80133c:	48 63 da             	movslq %edx,%rbx
+  80133f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801342:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801347:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80134d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134f:	48 85 c0             	test   %rax,%rax
+  801352:	7f 06                	jg     80135a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801354:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801358:	c9                   	leave
+  801359:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135a:	49 89 c0             	mov    %rax,%r8
+  80135d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801362:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801369:	00 00 00 
+  80136c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801371:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801378:	00 00 00 
+  80137b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801380:	49 b9 60 3f 80 00 00 	movabs $0x803f60,%r9
+  801387:	00 00 00 
+  80138a:	41 ff d1             	call   *%r9
+
+000000000080138d <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80138d:	55                   	push   %rbp
+  80138e:	48 89 e5             	mov    %rsp,%rbp
+  801391:	53                   	push   %rbx
+  801392:	48 83 ec 08          	sub    $0x8,%rsp
+  801396:	49 89 f9             	mov    %rdi,%r9
+  801399:	89 f0                	mov    %esi,%eax
+  80139b:	48 89 d3             	mov    %rdx,%rbx
+  80139e:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8013a1:	49 63 f0             	movslq %r8d,%rsi
+  8013a4:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ac:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b7:	48 85 c0             	test   %rax,%rax
+  8013ba:	7f 06                	jg     8013c2 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c0:	c9                   	leave
+  8013c1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c2:	49 89 c0             	mov    %rax,%r8
+  8013c5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013ca:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8013d1:	00 00 00 
+  8013d4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013d9:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8013e0:	00 00 00 
+  8013e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e8:	49 b9 60 3f 80 00 00 	movabs $0x803f60,%r9
+  8013ef:	00 00 00 
+  8013f2:	41 ff d1             	call   *%r9
+
+00000000008013f5 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8013f5:	55                   	push   %rbp
+  8013f6:	48 89 e5             	mov    %rsp,%rbp
+  8013f9:	53                   	push   %rbx
+  8013fa:	89 f8                	mov    %edi,%eax
+  8013fc:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8013ff:	48 63 f9             	movslq %ecx,%rdi
+  801402:	48 63 da             	movslq %edx,%rbx
+  801405:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801408:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801410:	be 00 00 00 00       	mov    $0x0,%esi
+  801415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80141b:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80141d:	89 c2                	mov    %eax,%edx
+  80141f:	48 85 c0             	test   %rax,%rax
+  801422:	78 0d                	js     801431 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801424:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801429:	4d 85 c9             	test   %r9,%r9
+  80142c:	74 03                	je     801431 <sys_alloc_dma_region+0x3c>
+  80142e:	49 89 01             	mov    %rax,(%r9)
+}
+  801431:	89 d0                	mov    %edx,%eax
+  801433:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801437:	c9                   	leave
+  801438:	c3                   	ret
+
+0000000000801439 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801439:	55                   	push   %rbp
+  80143a:	48 89 e5             	mov    %rsp,%rbp
+  80143d:	53                   	push   %rbx
+  80143e:	48 83 ec 08          	sub    $0x8,%rsp
+  801442:	48 89 f1             	mov    %rsi,%rcx
+  801445:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801448:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80144b:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801450:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801455:	be 00 00 00 00       	mov    $0x0,%esi
+  80145a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801460:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801462:	48 85 c0             	test   %rax,%rax
+  801465:	7f 06                	jg     80146d <sys_set_cache_region+0x34>
+}
+  801467:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146b:	c9                   	leave
+  80146c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80146d:	49 89 c0             	mov    %rax,%r8
+  801470:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801475:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80147c:	00 00 00 
+  80147f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801484:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80148b:	00 00 00 
+  80148e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801493:	49 b9 60 3f 80 00 00 	movabs $0x803f60,%r9
+  80149a:	00 00 00 
+  80149d:	41 ff d1             	call   *%r9
+
+00000000008014a0 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014a0:	55                   	push   %rbp
+  8014a1:	48 89 e5             	mov    %rsp,%rbp
+  8014a4:	53                   	push   %rbx
+  8014a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a9:	48 89 f1             	mov    %rsi,%rcx
+  8014ac:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c9:	48 85 c0             	test   %rax,%rax
+  8014cc:	7f 06                	jg     8014d4 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d2:	c9                   	leave
+  8014d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d4:	49 89 c0             	mov    %rax,%r8
+  8014d7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014dc:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8014e3:	00 00 00 
+  8014e6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014eb:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8014f2:	00 00 00 
+  8014f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fa:	49 b9 60 3f 80 00 00 	movabs $0x803f60,%r9
+  801501:	00 00 00 
+  801504:	41 ff d1             	call   *%r9
+
+0000000000801507 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801507:	55                   	push   %rbp
+  801508:	48 89 e5             	mov    %rsp,%rbp
+  80150b:	53                   	push   %rbx
+  80150c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801510:	48 63 ce             	movslq %esi,%rcx
+  801513:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801516:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801520:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801525:	be 00 00 00 00       	mov    $0x0,%esi
+  80152a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801530:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801532:	48 85 c0             	test   %rax,%rax
+  801535:	7f 06                	jg     80153d <sys_env_set_status+0x36>
+}
+  801537:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153b:	c9                   	leave
+  80153c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153d:	49 89 c0             	mov    %rax,%r8
+  801540:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801545:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80154c:	00 00 00 
+  80154f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801554:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80155b:	00 00 00 
+  80155e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801563:	49 b9 60 3f 80 00 00 	movabs $0x803f60,%r9
+  80156a:	00 00 00 
+  80156d:	41 ff d1             	call   *%r9
+
+0000000000801570 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801570:	55                   	push   %rbp
+  801571:	48 89 e5             	mov    %rsp,%rbp
+  801574:	53                   	push   %rbx
+  801575:	48 83 ec 08          	sub    $0x8,%rsp
+  801579:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80157c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80157f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801584:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801589:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158e:	be 00 00 00 00       	mov    $0x0,%esi
+  801593:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801599:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80159b:	48 85 c0             	test   %rax,%rax
+  80159e:	7f 06                	jg     8015a6 <sys_env_set_trapframe+0x36>
+}
+  8015a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a4:	c9                   	leave
+  8015a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a6:	49 89 c0             	mov    %rax,%r8
+  8015a9:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8015ae:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8015b5:	00 00 00 
+  8015b8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015bd:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8015c4:	00 00 00 
+  8015c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cc:	49 b9 60 3f 80 00 00 	movabs $0x803f60,%r9
+  8015d3:	00 00 00 
+  8015d6:	41 ff d1             	call   *%r9
+
+00000000008015d9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015d9:	55                   	push   %rbp
+  8015da:	48 89 e5             	mov    %rsp,%rbp
+  8015dd:	53                   	push   %rbx
+  8015de:	48 83 ec 08          	sub    $0x8,%rsp
+  8015e2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015e5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801602:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801604:	48 85 c0             	test   %rax,%rax
+  801607:	7f 06                	jg     80160f <sys_env_set_pgfault_upcall+0x36>
+}
+  801609:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80160d:	c9                   	leave
+  80160e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80160f:	49 89 c0             	mov    %rax,%r8
+  801612:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801617:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80161e:	00 00 00 
+  801621:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801626:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  80162d:	00 00 00 
+  801630:	b8 00 00 00 00       	mov    $0x0,%eax
+  801635:	49 b9 60 3f 80 00 00 	movabs $0x803f60,%r9
+  80163c:	00 00 00 
+  80163f:	41 ff d1             	call   *%r9
+
+0000000000801642 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801642:	55                   	push   %rbp
+  801643:	48 89 e5             	mov    %rsp,%rbp
+  801646:	53                   	push   %rbx
+  801647:	89 f8                	mov    %edi,%eax
+  801649:	49 89 f1             	mov    %rsi,%r9
+  80164c:	48 89 d3             	mov    %rdx,%rbx
+  80164f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801652:	49 63 f0             	movslq %r8d,%rsi
+  801655:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801658:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80165d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801660:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801666:	cd 30                	int    $0x30
+}
+  801668:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166c:	c9                   	leave
+  80166d:	c3                   	ret
+
+000000000080166e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+  801672:	53                   	push   %rbx
+  801673:	48 83 ec 08          	sub    $0x8,%rsp
+  801677:	48 89 fa             	mov    %rdi,%rdx
+  80167a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80167d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801682:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801687:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168c:	be 00 00 00 00       	mov    $0x0,%esi
+  801691:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801697:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801699:	48 85 c0             	test   %rax,%rax
+  80169c:	7f 06                	jg     8016a4 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80169e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a2:	c9                   	leave
+  8016a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a4:	49 89 c0             	mov    %rax,%r8
+  8016a7:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8016ac:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  8016b3:	00 00 00 
+  8016b6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016bb:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  8016c2:	00 00 00 
+  8016c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ca:	49 b9 60 3f 80 00 00 	movabs $0x803f60,%r9
+  8016d1:	00 00 00 
+  8016d4:	41 ff d1             	call   *%r9
+
+00000000008016d7 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8016d7:	55                   	push   %rbp
+  8016d8:	48 89 e5             	mov    %rsp,%rbp
+  8016db:	53                   	push   %rbx
+  8016dc:	48 89 fa             	mov    %rdi,%rdx
+  8016df:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e2:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016fc:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801702:	c9                   	leave
+  801703:	c3                   	ret
+
+0000000000801704 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801704:	55                   	push   %rbp
+  801705:	48 89 e5             	mov    %rsp,%rbp
+  801708:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801709:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80170e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801713:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801718:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801722:	be 00 00 00 00       	mov    $0x0,%esi
+  801727:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80172f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801733:	c9                   	leave
+  801734:	c3                   	ret
+
+0000000000801735 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801735:	48 85 ff             	test   %rdi,%rdi
+  801738:	0f 84 b6 01 00 00    	je     8018f4 <malloc+0x1bf>
+malloc(size_t size) {
+  80173e:	55                   	push   %rbp
+  80173f:	48 89 e5             	mov    %rsp,%rbp
+  801742:	41 56                	push   %r14
+  801744:	41 55                	push   %r13
+  801746:	41 54                	push   %r12
+  801748:	53                   	push   %rbx
+  801749:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80174c:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801753:	00 00 00 
+  801756:	4c 8b 20             	mov    (%rax),%r12
+  801759:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801760:	0f 87 94 01 00 00    	ja     8018fa <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801766:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80176d:	00 00 00 
+  801770:	48 85 c0             	test   %rax,%rax
+  801773:	74 6b                	je     8017e0 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801775:	4d 85 e4             	test   %r12,%r12
+  801778:	74 66                	je     8017e0 <malloc+0xab>
+  80177a:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801781:	00 00 00 
+  801784:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801789:	eb 0d                	jmp    801798 <malloc+0x63>
+  80178b:	48 83 c1 01          	add    $0x1,%rcx
+  80178f:	48 83 c2 18          	add    $0x18,%rdx
+  801793:	49 39 cc             	cmp    %rcx,%r12
+  801796:	74 48                	je     8017e0 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801798:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80179d:	74 ec                	je     80178b <malloc+0x56>
+  80179f:	48 39 1a             	cmp    %rbx,(%rdx)
+  8017a2:	72 e7                	jb     80178b <malloc+0x56>
+                real_freep_size--;
+  8017a4:	48 83 e8 01          	sub    $0x1,%rax
+  8017a8:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  8017af:	00 00 00 
+                freep[i].is_free = false;
+  8017b2:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8017b9:	00 00 00 
+  8017bc:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8017c0:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8017c4:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8017c8:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8017cf:	00 
+                freep[i].size = size;
+  8017d0:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8017d4:	48 01 c8             	add    %rcx,%rax
+  8017d7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017db:	e9 0b 01 00 00       	jmp    8018eb <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8017e0:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8017e7:	00 00 00 
+  8017ea:	48 01 d8             	add    %rbx,%rax
+  8017ed:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8017f3:	76 7c                	jbe    801871 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8017f5:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8017fc:	00 00 00 
+  8017ff:	4c 8b 30             	mov    (%rax),%r14
+  801802:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801809:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  80180c:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801813:	00 00 00 
+  801816:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  80181d:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801824:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80182a:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80182e:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  801835:	00 00 00 
+  801838:	ff d0                	call   *%rax
+  80183a:	89 c7                	mov    %eax,%edi
+  80183c:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801843:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80184a:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801851:	00 00 00 
+  801854:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801858:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80185d:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  801864:	00 00 00 
+  801867:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801869:	85 c0                	test   %eax,%eax
+  80186b:	0f 88 90 00 00 00    	js     801901 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801871:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801878:	00 00 00 
+  80187b:	48 8b 31             	mov    (%rcx),%rsi
+  80187e:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801885:	00 00 00 
+  801888:	4c 8b 07             	mov    (%rdi),%r8
+  80188b:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80188f:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801896:	00 00 00 
+  801899:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80189d:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  8018a1:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8018a8:	00 00 00 
+  8018ab:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  8018af:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  8018b2:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8018b6:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8018bd:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8018be:	48 89 d8             	mov    %rbx,%rax
+  8018c1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8018c6:	4c 01 c0             	add    %r8,%rax
+  8018c9:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8018cc:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8018d3:	48 01 f3             	add    %rsi,%rbx
+  8018d6:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8018d9:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8018de:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8018e5:	00 00 00 
+  8018e8:	48 89 d0             	mov    %rdx,%rax
+}
+  8018eb:	5b                   	pop    %rbx
+  8018ec:	41 5c                	pop    %r12
+  8018ee:	41 5d                	pop    %r13
+  8018f0:	41 5e                	pop    %r14
+  8018f2:	5d                   	pop    %rbp
+  8018f3:	c3                   	ret
+        return NULL;
+  8018f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018f9:	c3                   	ret
+        return NULL;
+  8018fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ff:	eb ea                	jmp    8018eb <malloc+0x1b6>
+            return NULL;
+  801901:	b8 00 00 00 00       	mov    $0x0,%eax
+  801906:	eb e3                	jmp    8018eb <malloc+0x1b6>
+
+0000000000801908 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801908:	55                   	push   %rbp
+  801909:	48 89 e5             	mov    %rsp,%rbp
+  80190c:	53                   	push   %rbx
+  80190d:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801911:	48 89 fb             	mov    %rdi,%rbx
+  801914:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801918:	48 89 df             	mov    %rbx,%rdi
+  80191b:	48 b8 35 17 80 00 00 	movabs $0x801735,%rax
+  801922:	00 00 00 
+  801925:	ff d0                	call   *%rax
+  801927:	48 89 c7             	mov    %rax,%rdi
+  80192a:	48 89 da             	mov    %rbx,%rdx
+  80192d:	be 00 00 00 00       	mov    $0x0,%esi
+  801932:	48 b8 41 0e 80 00 00 	movabs $0x800e41,%rax
+  801939:	00 00 00 
+  80193c:	ff d0                	call   *%rax
+}
+  80193e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801942:	c9                   	leave
+  801943:	c3                   	ret
+
+0000000000801944 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801944:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  80194b:	00 00 00 
+  80194e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801955:	00 00 00 
+  801958:	48 3b 02             	cmp    (%rdx),%rax
+  80195b:	74 4d                	je     8019aa <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  80195d:	48 85 c0             	test   %rax,%rax
+  801960:	74 4d                	je     8019af <get_allocsize+0x6b>
+  801962:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801969:	00 00 00 
+  80196c:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801971:	48 3b 39             	cmp    (%rcx),%rdi
+  801974:	74 13                	je     801989 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801976:	48 83 c2 01          	add    $0x1,%rdx
+  80197a:	48 83 c1 18          	add    $0x18,%rcx
+  80197e:	48 39 d0             	cmp    %rdx,%rax
+  801981:	75 ee                	jne    801971 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801983:	b8 00 00 00 00       	mov    $0x0,%eax
+  801988:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801989:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80198d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801992:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801999:	00 00 00 
+  80199c:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  8019a2:	75 0b                	jne    8019af <get_allocsize+0x6b>
+  8019a4:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  8019a9:	c3                   	ret
+        return 0;
+  8019aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019af:	c3                   	ret
+
+00000000008019b0 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  8019b0:	48 85 ff             	test   %rdi,%rdi
+  8019b3:	0f 84 01 01 00 00    	je     801aba <free+0x10a>
+free(void *ptr) {
+  8019b9:	55                   	push   %rbp
+  8019ba:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8019bd:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8019c4:	00 00 00 
+  8019c7:	48 8b 30             	mov    (%rax),%rsi
+  8019ca:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8019d1:	00 00 00 
+  8019d4:	48 39 c6             	cmp    %rax,%rsi
+  8019d7:	74 50                	je     801a29 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8019d9:	48 85 f6             	test   %rsi,%rsi
+  8019dc:	74 21                	je     8019ff <free+0x4f>
+  8019de:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8019e5:	00 00 00 
+  8019e8:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8019ed:	48 3b 39             	cmp    (%rcx),%rdi
+  8019f0:	74 61                	je     801a53 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8019f2:	48 83 c2 01          	add    $0x1,%rdx
+  8019f6:	48 83 c1 18          	add    $0x18,%rcx
+  8019fa:	48 39 d6             	cmp    %rdx,%rsi
+  8019fd:	75 ee                	jne    8019ed <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8019ff:	48 ba b0 55 80 00 00 	movabs $0x8055b0,%rdx
+  801a06:	00 00 00 
+  801a09:	be 12 01 00 00       	mov    $0x112,%esi
+  801a0e:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801a15:	00 00 00 
+  801a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1d:	48 b9 60 3f 80 00 00 	movabs $0x803f60,%rcx
+  801a24:	00 00 00 
+  801a27:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801a29:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801a30:	00 00 00 
+  801a33:	be 06 01 00 00       	mov    $0x106,%esi
+  801a38:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801a3f:	00 00 00 
+  801a42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a47:	48 b9 60 3f 80 00 00 	movabs $0x803f60,%rcx
+  801a4e:	00 00 00 
+  801a51:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801a53:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a57:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a5e:	00 00 00 
+  801a61:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a67:	75 27                	jne    801a90 <free+0xe0>
+            freep[i].is_free = true;
+  801a69:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a6d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801a74:	00 00 00 
+  801a77:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801a7e:	00 00 
+            real_freep_size++;
+  801a80:	48 83 c0 01          	add    $0x1,%rax
+  801a84:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801a8b:	00 00 00 
+}
+  801a8e:	5d                   	pop    %rbp
+  801a8f:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801a90:	48 ba 88 55 80 00 00 	movabs $0x805588,%rdx
+  801a97:	00 00 00 
+  801a9a:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801a9f:	48 bf d8 55 80 00 00 	movabs $0x8055d8,%rdi
+  801aa6:	00 00 00 
+  801aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aae:	48 b9 60 3f 80 00 00 	movabs $0x803f60,%rcx
+  801ab5:	00 00 00 
+  801ab8:	ff d1                	call   *%rcx
+  801aba:	c3                   	ret
+
+0000000000801abb <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801abb:	55                   	push   %rbp
+  801abc:	48 89 e5             	mov    %rsp,%rbp
+  801abf:	41 55                	push   %r13
+  801ac1:	41 54                	push   %r12
+  801ac3:	53                   	push   %rbx
+  801ac4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ac8:	48 89 fb             	mov    %rdi,%rbx
+  801acb:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801ace:	48 b8 44 19 80 00 00 	movabs $0x801944,%rax
+  801ad5:	00 00 00 
+  801ad8:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801ada:	49 39 c5             	cmp    %rax,%r13
+  801add:	73 0e                	jae    801aed <realloc+0x32>
+}
+  801adf:	48 89 d8             	mov    %rbx,%rax
+  801ae2:	48 83 c4 08          	add    $0x8,%rsp
+  801ae6:	5b                   	pop    %rbx
+  801ae7:	41 5c                	pop    %r12
+  801ae9:	41 5d                	pop    %r13
+  801aeb:	5d                   	pop    %rbp
+  801aec:	c3                   	ret
+  801aed:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801af0:	4c 89 ef             	mov    %r13,%rdi
+  801af3:	48 b8 35 17 80 00 00 	movabs $0x801735,%rax
+  801afa:	00 00 00 
+  801afd:	ff d0                	call   *%rax
+  801aff:	48 89 c7             	mov    %rax,%rdi
+  801b02:	4c 89 e2             	mov    %r12,%rdx
+  801b05:	48 89 de             	mov    %rbx,%rsi
+  801b08:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  801b0f:	00 00 00 
+  801b12:	ff d0                	call   *%rax
+  801b14:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801b17:	48 89 df             	mov    %rbx,%rdi
+  801b1a:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  801b21:	00 00 00 
+  801b24:	ff d0                	call   *%rax
+    return newptr;
+  801b26:	4c 89 e3             	mov    %r12,%rbx
+  801b29:	eb b4                	jmp    801adf <realloc+0x24>
+
+0000000000801b2b <strdup>:
+
+char*
+strdup (const char *src) {
+  801b2b:	55                   	push   %rbp
+  801b2c:	48 89 e5             	mov    %rsp,%rbp
+  801b2f:	41 54                	push   %r12
+  801b31:	53                   	push   %rbx
+  801b32:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801b35:	48 b8 23 0b 80 00 00 	movabs $0x800b23,%rax
+  801b3c:	00 00 00 
+  801b3f:	ff d0                	call   *%rax
+  801b41:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801b45:	4c 89 e7             	mov    %r12,%rdi
+  801b48:	48 b8 35 17 80 00 00 	movabs $0x801735,%rax
+  801b4f:	00 00 00 
+  801b52:	ff d0                	call   *%rax
+  801b54:	48 89 c7             	mov    %rax,%rdi
+  801b57:	4c 89 e2             	mov    %r12,%rdx
+  801b5a:	48 89 de             	mov    %rbx,%rsi
+  801b5d:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  801b64:	00 00 00 
+  801b67:	ff d0                	call   *%rax
+}
+  801b69:	5b                   	pop    %rbx
+  801b6a:	41 5c                	pop    %r12
+  801b6c:	5d                   	pop    %rbp
+  801b6d:	c3                   	ret
+
+0000000000801b6e <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801b6e:	55                   	push   %rbp
+  801b6f:	48 89 e5             	mov    %rsp,%rbp
+  801b72:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b73:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b87:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b8c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b97:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b9d:	c9                   	leave
+  801b9e:	c3                   	ret
+
+0000000000801b9f <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801b9f:	55                   	push   %rbp
+  801ba0:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801ba3:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801baa:	00 00 00 
+  801bad:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801bb1:	74 26                	je     801bd9 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801bb3:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801bb5:	48 c1 e2 20          	shl    $0x20,%rdx
+  801bb9:	89 c0                	mov    %eax,%eax
+  801bbb:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801bbe:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801bc5:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801bcc:	00 00 00 
+  801bcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd4:	48 f7 31             	divq   (%rcx)
+}
+  801bd7:	5d                   	pop    %rbp
+  801bd8:	c3                   	ret
+        freq = get_cpufreq();
+  801bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bde:	48 ba 6e 1b 80 00 00 	movabs $0x801b6e,%rdx
+  801be5:	00 00 00 
+  801be8:	ff d2                	call   *%rdx
+  801bea:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801bf1:	00 00 00 
+  801bf4:	eb bd                	jmp    801bb3 <get_ticks+0x14>
+
+0000000000801bf6 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801bf6:	55                   	push   %rbp
+  801bf7:	48 89 e5             	mov    %rsp,%rbp
+  801bfa:	53                   	push   %rbx
+  801bfb:	48 83 ec 08          	sub    $0x8,%rsp
+  801bff:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801c02:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c09:	00 00 00 
+  801c0c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c10:	74 50                	je     801c62 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801c12:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c14:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c18:	89 c0                	mov    %eax,%eax
+  801c1a:	48 89 d6             	mov    %rdx,%rsi
+  801c1d:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801c20:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c27:	00 00 00 
+  801c2a:	48 0f af 18          	imul   (%rax),%rbx
+  801c2e:	48 c1 eb 03          	shr    $0x3,%rbx
+  801c32:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801c39:	9b c4 20 
+  801c3c:	48 89 d8             	mov    %rbx,%rax
+  801c3f:	48 f7 e2             	mul    %rdx
+  801c42:	48 89 d1             	mov    %rdx,%rcx
+  801c45:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801c49:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c4b:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c4f:	89 c0                	mov    %eax,%eax
+  801c51:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801c54:	48 29 f2             	sub    %rsi,%rdx
+  801c57:	48 39 ca             	cmp    %rcx,%rdx
+  801c5a:	72 ed                	jb     801c49 <sleep+0x53>
+}
+  801c5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c60:	c9                   	leave
+  801c61:	c3                   	ret
+        freq = get_cpufreq();
+  801c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c67:	48 ba 6e 1b 80 00 00 	movabs $0x801b6e,%rdx
+  801c6e:	00 00 00 
+  801c71:	ff d2                	call   *%rdx
+  801c73:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c7a:	00 00 00 
+  801c7d:	eb 93                	jmp    801c12 <sleep+0x1c>
+
+0000000000801c7f <poll_kbd>:
+
+int poll_kbd() {
+  801c7f:	55                   	push   %rbp
+  801c80:	48 89 e5             	mov    %rsp,%rbp
+  801c83:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c84:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c98:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c9d:	be 00 00 00 00       	mov    $0x0,%esi
+  801ca2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ca8:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801caa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cae:	c9                   	leave
+  801caf:	c3                   	ret
+
+0000000000801cb0 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801cb0:	55                   	push   %rbp
+  801cb1:	48 89 e5             	mov    %rsp,%rbp
+  801cb4:	53                   	push   %rbx
+  801cb5:	49 89 fa             	mov    %rdi,%r10
+  801cb8:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801cba:	44 89 c6             	mov    %r8d,%esi
+  801cbd:	89 cf                	mov    %ecx,%edi
+  801cbf:	89 d3                	mov    %edx,%ebx
+  801cc1:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801cc3:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cc8:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ccb:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801ccf:	cd 30                	int    $0x30
+  801cd1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cd5:	c9                   	leave
+  801cd6:	c3                   	ret
+
+0000000000801cd7 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cd7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801cde:	ff ff ff 
+  801ce1:	48 01 f8             	add    %rdi,%rax
+  801ce4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ce8:	c3                   	ret
+
+0000000000801ce9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ce9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801cf0:	ff ff ff 
+  801cf3:	48 01 f8             	add    %rdi,%rax
+  801cf6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801cfa:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801d00:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801d04:	c3                   	ret
+
+0000000000801d05 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801d05:	55                   	push   %rbp
+  801d06:	48 89 e5             	mov    %rsp,%rbp
+  801d09:	41 57                	push   %r15
+  801d0b:	41 56                	push   %r14
+  801d0d:	41 55                	push   %r13
+  801d0f:	41 54                	push   %r12
+  801d11:	53                   	push   %rbx
+  801d12:	48 83 ec 08          	sub    $0x8,%rsp
+  801d16:	49 89 ff             	mov    %rdi,%r15
+  801d19:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801d1e:	49 bd b9 3b 80 00 00 	movabs $0x803bb9,%r13
+  801d25:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801d28:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801d2e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801d31:	48 89 df             	mov    %rbx,%rdi
+  801d34:	41 ff d5             	call   *%r13
+  801d37:	83 e0 04             	and    $0x4,%eax
+  801d3a:	74 17                	je     801d53 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801d3c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d43:	4c 39 f3             	cmp    %r14,%rbx
+  801d46:	75 e6                	jne    801d2e <fd_alloc+0x29>
+  801d48:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801d4e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801d53:	4d 89 27             	mov    %r12,(%r15)
+}
+  801d56:	48 83 c4 08          	add    $0x8,%rsp
+  801d5a:	5b                   	pop    %rbx
+  801d5b:	41 5c                	pop    %r12
+  801d5d:	41 5d                	pop    %r13
+  801d5f:	41 5e                	pop    %r14
+  801d61:	41 5f                	pop    %r15
+  801d63:	5d                   	pop    %rbp
+  801d64:	c3                   	ret
+
+0000000000801d65 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801d65:	83 ff 1f             	cmp    $0x1f,%edi
+  801d68:	77 39                	ja     801da3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801d6a:	55                   	push   %rbp
+  801d6b:	48 89 e5             	mov    %rsp,%rbp
+  801d6e:	41 54                	push   %r12
+  801d70:	53                   	push   %rbx
+  801d71:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801d74:	48 63 df             	movslq %edi,%rbx
+  801d77:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801d7e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801d82:	48 89 df             	mov    %rbx,%rdi
+  801d85:	48 b8 b9 3b 80 00 00 	movabs $0x803bb9,%rax
+  801d8c:	00 00 00 
+  801d8f:	ff d0                	call   *%rax
+  801d91:	a8 04                	test   $0x4,%al
+  801d93:	74 14                	je     801da9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d95:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d9e:	5b                   	pop    %rbx
+  801d9f:	41 5c                	pop    %r12
+  801da1:	5d                   	pop    %rbp
+  801da2:	c3                   	ret
+        return -E_INVAL;
+  801da3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801da8:	c3                   	ret
+        return -E_INVAL;
+  801da9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dae:	eb ee                	jmp    801d9e <fd_lookup+0x39>
+
+0000000000801db0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801db0:	55                   	push   %rbp
+  801db1:	48 89 e5             	mov    %rsp,%rbp
+  801db4:	41 54                	push   %r12
+  801db6:	53                   	push   %rbx
+  801db7:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801dba:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  801dc1:	00 00 00 
+  801dc4:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801dcb:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801dce:	39 3b                	cmp    %edi,(%rbx)
+  801dd0:	74 47                	je     801e19 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801dd2:	48 83 c0 08          	add    $0x8,%rax
+  801dd6:	48 8b 18             	mov    (%rax),%rbx
+  801dd9:	48 85 db             	test   %rbx,%rbx
+  801ddc:	75 f0                	jne    801dce <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801dde:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801de5:	00 00 00 
+  801de8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dee:	89 fa                	mov    %edi,%edx
+  801df0:	48 bf e8 55 80 00 00 	movabs $0x8055e8,%rdi
+  801df7:	00 00 00 
+  801dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dff:	48 b9 e9 01 80 00 00 	movabs $0x8001e9,%rcx
+  801e06:	00 00 00 
+  801e09:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801e0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801e10:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801e14:	5b                   	pop    %rbx
+  801e15:	41 5c                	pop    %r12
+  801e17:	5d                   	pop    %rbp
+  801e18:	c3                   	ret
+            return 0;
+  801e19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1e:	eb f0                	jmp    801e10 <dev_lookup+0x60>
+
+0000000000801e20 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801e20:	55                   	push   %rbp
+  801e21:	48 89 e5             	mov    %rsp,%rbp
+  801e24:	41 55                	push   %r13
+  801e26:	41 54                	push   %r12
+  801e28:	53                   	push   %rbx
+  801e29:	48 83 ec 18          	sub    $0x18,%rsp
+  801e2d:	48 89 fb             	mov    %rdi,%rbx
+  801e30:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e33:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801e3a:	ff ff ff 
+  801e3d:	48 01 df             	add    %rbx,%rdi
+  801e40:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801e44:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e48:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  801e4f:	00 00 00 
+  801e52:	ff d0                	call   *%rax
+  801e54:	41 89 c5             	mov    %eax,%r13d
+  801e57:	85 c0                	test   %eax,%eax
+  801e59:	78 06                	js     801e61 <fd_close+0x41>
+  801e5b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801e5f:	74 1a                	je     801e7b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801e61:	45 84 e4             	test   %r12b,%r12b
+  801e64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e69:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801e6d:	44 89 e8             	mov    %r13d,%eax
+  801e70:	48 83 c4 18          	add    $0x18,%rsp
+  801e74:	5b                   	pop    %rbx
+  801e75:	41 5c                	pop    %r12
+  801e77:	41 5d                	pop    %r13
+  801e79:	5d                   	pop    %rbp
+  801e7a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e7b:	8b 3b                	mov    (%rbx),%edi
+  801e7d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e81:	48 b8 b0 1d 80 00 00 	movabs $0x801db0,%rax
+  801e88:	00 00 00 
+  801e8b:	ff d0                	call   *%rax
+  801e8d:	41 89 c5             	mov    %eax,%r13d
+  801e90:	85 c0                	test   %eax,%eax
+  801e92:	78 1b                	js     801eaf <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e98:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e9c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ea2:	48 85 c0             	test   %rax,%rax
+  801ea5:	74 08                	je     801eaf <fd_close+0x8f>
+  801ea7:	48 89 df             	mov    %rbx,%rdi
+  801eaa:	ff d0                	call   *%rax
+  801eac:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801eaf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801eb4:	48 89 de             	mov    %rbx,%rsi
+  801eb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ebc:	48 b8 a0 14 80 00 00 	movabs $0x8014a0,%rax
+  801ec3:	00 00 00 
+  801ec6:	ff d0                	call   *%rax
+    return res;
+  801ec8:	eb a3                	jmp    801e6d <fd_close+0x4d>
+
+0000000000801eca <close>:
+
+int
+close(int fdnum) {
+  801eca:	55                   	push   %rbp
+  801ecb:	48 89 e5             	mov    %rsp,%rbp
+  801ece:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ed2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ed6:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  801edd:	00 00 00 
+  801ee0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ee2:	85 c0                	test   %eax,%eax
+  801ee4:	78 15                	js     801efb <close+0x31>
+
+    return fd_close(fd, 1);
+  801ee6:	be 01 00 00 00       	mov    $0x1,%esi
+  801eeb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801eef:	48 b8 20 1e 80 00 00 	movabs $0x801e20,%rax
+  801ef6:	00 00 00 
+  801ef9:	ff d0                	call   *%rax
+}
+  801efb:	c9                   	leave
+  801efc:	c3                   	ret
+
+0000000000801efd <close_all>:
+
+void
+close_all(void) {
+  801efd:	55                   	push   %rbp
+  801efe:	48 89 e5             	mov    %rsp,%rbp
+  801f01:	41 54                	push   %r12
+  801f03:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801f04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f09:	49 bc ca 1e 80 00 00 	movabs $0x801eca,%r12
+  801f10:	00 00 00 
+  801f13:	89 df                	mov    %ebx,%edi
+  801f15:	41 ff d4             	call   *%r12
+  801f18:	83 c3 01             	add    $0x1,%ebx
+  801f1b:	83 fb 20             	cmp    $0x20,%ebx
+  801f1e:	75 f3                	jne    801f13 <close_all+0x16>
+}
+  801f20:	5b                   	pop    %rbx
+  801f21:	41 5c                	pop    %r12
+  801f23:	5d                   	pop    %rbp
+  801f24:	c3                   	ret
+
+0000000000801f25 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801f25:	55                   	push   %rbp
+  801f26:	48 89 e5             	mov    %rsp,%rbp
+  801f29:	41 57                	push   %r15
+  801f2b:	41 56                	push   %r14
+  801f2d:	41 55                	push   %r13
+  801f2f:	41 54                	push   %r12
+  801f31:	53                   	push   %rbx
+  801f32:	48 83 ec 18          	sub    $0x18,%rsp
+  801f36:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801f39:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801f3d:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  801f44:	00 00 00 
+  801f47:	ff d0                	call   *%rax
+  801f49:	89 c3                	mov    %eax,%ebx
+  801f4b:	85 c0                	test   %eax,%eax
+  801f4d:	0f 88 b8 00 00 00    	js     80200b <dup+0xe6>
+    close(newfdnum);
+  801f53:	44 89 e7             	mov    %r12d,%edi
+  801f56:	48 b8 ca 1e 80 00 00 	movabs $0x801eca,%rax
+  801f5d:	00 00 00 
+  801f60:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801f62:	4d 63 ec             	movslq %r12d,%r13
+  801f65:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801f6c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801f70:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801f74:	4c 89 ff             	mov    %r15,%rdi
+  801f77:	49 be e9 1c 80 00 00 	movabs $0x801ce9,%r14
+  801f7e:	00 00 00 
+  801f81:	41 ff d6             	call   *%r14
+  801f84:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801f87:	4c 89 ef             	mov    %r13,%rdi
+  801f8a:	41 ff d6             	call   *%r14
+  801f8d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801f90:	48 89 df             	mov    %rbx,%rdi
+  801f93:	48 b8 b9 3b 80 00 00 	movabs $0x803bb9,%rax
+  801f9a:	00 00 00 
+  801f9d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801f9f:	a8 04                	test   $0x4,%al
+  801fa1:	74 2b                	je     801fce <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801fa3:	41 89 c1             	mov    %eax,%r9d
+  801fa6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fac:	4c 89 f1             	mov    %r14,%rcx
+  801faf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb4:	48 89 de             	mov    %rbx,%rsi
+  801fb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fbc:	48 b8 28 13 80 00 00 	movabs $0x801328,%rax
+  801fc3:	00 00 00 
+  801fc6:	ff d0                	call   *%rax
+  801fc8:	89 c3                	mov    %eax,%ebx
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	78 4e                	js     80201c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801fce:	4c 89 ff             	mov    %r15,%rdi
+  801fd1:	48 b8 b9 3b 80 00 00 	movabs $0x803bb9,%rax
+  801fd8:	00 00 00 
+  801fdb:	ff d0                	call   *%rax
+  801fdd:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801fe0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fe6:	4c 89 e9             	mov    %r13,%rcx
+  801fe9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fee:	4c 89 fe             	mov    %r15,%rsi
+  801ff1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ff6:	48 b8 28 13 80 00 00 	movabs $0x801328,%rax
+  801ffd:	00 00 00 
+  802000:	ff d0                	call   *%rax
+  802002:	89 c3                	mov    %eax,%ebx
+  802004:	85 c0                	test   %eax,%eax
+  802006:	78 14                	js     80201c <dup+0xf7>
+
+    return newfdnum;
+  802008:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80200b:	89 d8                	mov    %ebx,%eax
+  80200d:	48 83 c4 18          	add    $0x18,%rsp
+  802011:	5b                   	pop    %rbx
+  802012:	41 5c                	pop    %r12
+  802014:	41 5d                	pop    %r13
+  802016:	41 5e                	pop    %r14
+  802018:	41 5f                	pop    %r15
+  80201a:	5d                   	pop    %rbp
+  80201b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80201c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802021:	4c 89 ee             	mov    %r13,%rsi
+  802024:	bf 00 00 00 00       	mov    $0x0,%edi
+  802029:	49 bc a0 14 80 00 00 	movabs $0x8014a0,%r12
+  802030:	00 00 00 
+  802033:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802036:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80203b:	4c 89 f6             	mov    %r14,%rsi
+  80203e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802043:	41 ff d4             	call   *%r12
+    return res;
+  802046:	eb c3                	jmp    80200b <dup+0xe6>
+
+0000000000802048 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802048:	55                   	push   %rbp
+  802049:	48 89 e5             	mov    %rsp,%rbp
+  80204c:	41 56                	push   %r14
+  80204e:	41 55                	push   %r13
+  802050:	41 54                	push   %r12
+  802052:	53                   	push   %rbx
+  802053:	48 83 ec 10          	sub    $0x10,%rsp
+  802057:	89 fb                	mov    %edi,%ebx
+  802059:	49 89 f4             	mov    %rsi,%r12
+  80205c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80205f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802063:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  80206a:	00 00 00 
+  80206d:	ff d0                	call   *%rax
+  80206f:	85 c0                	test   %eax,%eax
+  802071:	78 4c                	js     8020bf <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802073:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802077:	41 8b 3e             	mov    (%r14),%edi
+  80207a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80207e:	48 b8 b0 1d 80 00 00 	movabs $0x801db0,%rax
+  802085:	00 00 00 
+  802088:	ff d0                	call   *%rax
+  80208a:	85 c0                	test   %eax,%eax
+  80208c:	78 35                	js     8020c3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80208e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802092:	83 e0 03             	and    $0x3,%eax
+  802095:	83 f8 01             	cmp    $0x1,%eax
+  802098:	74 2d                	je     8020c7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80209a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80209e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8020a2:	48 85 c0             	test   %rax,%rax
+  8020a5:	74 56                	je     8020fd <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8020a7:	4c 89 ea             	mov    %r13,%rdx
+  8020aa:	4c 89 e6             	mov    %r12,%rsi
+  8020ad:	4c 89 f7             	mov    %r14,%rdi
+  8020b0:	ff d0                	call   *%rax
+}
+  8020b2:	48 83 c4 10          	add    $0x10,%rsp
+  8020b6:	5b                   	pop    %rbx
+  8020b7:	41 5c                	pop    %r12
+  8020b9:	41 5d                	pop    %r13
+  8020bb:	41 5e                	pop    %r14
+  8020bd:	5d                   	pop    %rbp
+  8020be:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020bf:	48 98                	cltq
+  8020c1:	eb ef                	jmp    8020b2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020c3:	48 98                	cltq
+  8020c5:	eb eb                	jmp    8020b2 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020c7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020ce:	00 00 00 
+  8020d1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020d7:	89 da                	mov    %ebx,%edx
+  8020d9:	48 bf 29 56 80 00 00 	movabs $0x805629,%rdi
+  8020e0:	00 00 00 
+  8020e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e8:	48 b9 e9 01 80 00 00 	movabs $0x8001e9,%rcx
+  8020ef:	00 00 00 
+  8020f2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020f4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020fb:	eb b5                	jmp    8020b2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020fd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802104:	eb ac                	jmp    8020b2 <read+0x6a>
+
+0000000000802106 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802106:	55                   	push   %rbp
+  802107:	48 89 e5             	mov    %rsp,%rbp
+  80210a:	41 57                	push   %r15
+  80210c:	41 56                	push   %r14
+  80210e:	41 55                	push   %r13
+  802110:	41 54                	push   %r12
+  802112:	53                   	push   %rbx
+  802113:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802117:	48 85 d2             	test   %rdx,%rdx
+  80211a:	74 54                	je     802170 <readn+0x6a>
+  80211c:	41 89 fd             	mov    %edi,%r13d
+  80211f:	49 89 f6             	mov    %rsi,%r14
+  802122:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802125:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80212a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80212f:	49 bf 48 20 80 00 00 	movabs $0x802048,%r15
+  802136:	00 00 00 
+  802139:	4c 89 e2             	mov    %r12,%rdx
+  80213c:	48 29 f2             	sub    %rsi,%rdx
+  80213f:	4c 01 f6             	add    %r14,%rsi
+  802142:	44 89 ef             	mov    %r13d,%edi
+  802145:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	78 20                	js     80216c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80214c:	01 c3                	add    %eax,%ebx
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	74 08                	je     80215a <readn+0x54>
+  802152:	48 63 f3             	movslq %ebx,%rsi
+  802155:	4c 39 e6             	cmp    %r12,%rsi
+  802158:	72 df                	jb     802139 <readn+0x33>
+    }
+    return res;
+  80215a:	48 63 c3             	movslq %ebx,%rax
+}
+  80215d:	48 83 c4 08          	add    $0x8,%rsp
+  802161:	5b                   	pop    %rbx
+  802162:	41 5c                	pop    %r12
+  802164:	41 5d                	pop    %r13
+  802166:	41 5e                	pop    %r14
+  802168:	41 5f                	pop    %r15
+  80216a:	5d                   	pop    %rbp
+  80216b:	c3                   	ret
+        if (inc < 0) return inc;
+  80216c:	48 98                	cltq
+  80216e:	eb ed                	jmp    80215d <readn+0x57>
+    int inc = 1, res = 0;
+  802170:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802175:	eb e3                	jmp    80215a <readn+0x54>
+
+0000000000802177 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802177:	55                   	push   %rbp
+  802178:	48 89 e5             	mov    %rsp,%rbp
+  80217b:	41 56                	push   %r14
+  80217d:	41 55                	push   %r13
+  80217f:	41 54                	push   %r12
+  802181:	53                   	push   %rbx
+  802182:	48 83 ec 10          	sub    $0x10,%rsp
+  802186:	89 fb                	mov    %edi,%ebx
+  802188:	49 89 f4             	mov    %rsi,%r12
+  80218b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80218e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802192:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  802199:	00 00 00 
+  80219c:	ff d0                	call   *%rax
+  80219e:	85 c0                	test   %eax,%eax
+  8021a0:	78 47                	js     8021e9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021a2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8021a6:	41 8b 3e             	mov    (%r14),%edi
+  8021a9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021ad:	48 b8 b0 1d 80 00 00 	movabs $0x801db0,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+  8021b9:	85 c0                	test   %eax,%eax
+  8021bb:	78 30                	js     8021ed <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021bd:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8021c2:	74 2d                	je     8021f1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021c8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8021cc:	48 85 c0             	test   %rax,%rax
+  8021cf:	74 56                	je     802227 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8021d1:	4c 89 ea             	mov    %r13,%rdx
+  8021d4:	4c 89 e6             	mov    %r12,%rsi
+  8021d7:	4c 89 f7             	mov    %r14,%rdi
+  8021da:	ff d0                	call   *%rax
+}
+  8021dc:	48 83 c4 10          	add    $0x10,%rsp
+  8021e0:	5b                   	pop    %rbx
+  8021e1:	41 5c                	pop    %r12
+  8021e3:	41 5d                	pop    %r13
+  8021e5:	41 5e                	pop    %r14
+  8021e7:	5d                   	pop    %rbp
+  8021e8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021e9:	48 98                	cltq
+  8021eb:	eb ef                	jmp    8021dc <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021ed:	48 98                	cltq
+  8021ef:	eb eb                	jmp    8021dc <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021f1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021f8:	00 00 00 
+  8021fb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802201:	89 da                	mov    %ebx,%edx
+  802203:	48 bf 45 56 80 00 00 	movabs $0x805645,%rdi
+  80220a:	00 00 00 
+  80220d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802212:	48 b9 e9 01 80 00 00 	movabs $0x8001e9,%rcx
+  802219:	00 00 00 
+  80221c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80221e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802225:	eb b5                	jmp    8021dc <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802227:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80222e:	eb ac                	jmp    8021dc <write+0x65>
+
+0000000000802230 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802230:	55                   	push   %rbp
+  802231:	48 89 e5             	mov    %rsp,%rbp
+  802234:	53                   	push   %rbx
+  802235:	48 83 ec 18          	sub    $0x18,%rsp
+  802239:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80223b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80223f:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  802246:	00 00 00 
+  802249:	ff d0                	call   *%rax
+  80224b:	85 c0                	test   %eax,%eax
+  80224d:	78 0c                	js     80225b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80224f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802253:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802256:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80225b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80225f:	c9                   	leave
+  802260:	c3                   	ret
+
+0000000000802261 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802261:	55                   	push   %rbp
+  802262:	48 89 e5             	mov    %rsp,%rbp
+  802265:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802269:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80226d:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  802274:	00 00 00 
+  802277:	ff d0                	call   *%rax
+  802279:	85 c0                	test   %eax,%eax
+  80227b:	78 07                	js     802284 <tell+0x23>
+    return fdes->fd_offset;
+  80227d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802281:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802284:	c9                   	leave
+  802285:	c3                   	ret
+
+0000000000802286 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802286:	55                   	push   %rbp
+  802287:	48 89 e5             	mov    %rsp,%rbp
+  80228a:	41 55                	push   %r13
+  80228c:	41 54                	push   %r12
+  80228e:	53                   	push   %rbx
+  80228f:	48 83 ec 18          	sub    $0x18,%rsp
+  802293:	89 fb                	mov    %edi,%ebx
+  802295:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802298:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80229c:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  8022a3:	00 00 00 
+  8022a6:	ff d0                	call   *%rax
+  8022a8:	85 c0                	test   %eax,%eax
+  8022aa:	78 38                	js     8022e4 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022ac:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8022b0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8022b4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022b8:	48 b8 b0 1d 80 00 00 	movabs $0x801db0,%rax
+  8022bf:	00 00 00 
+  8022c2:	ff d0                	call   *%rax
+  8022c4:	85 c0                	test   %eax,%eax
+  8022c6:	78 1c                	js     8022e4 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022c8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8022cd:	74 20                	je     8022ef <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022cf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022d3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8022d7:	48 85 c0             	test   %rax,%rax
+  8022da:	74 47                	je     802323 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8022dc:	44 89 e6             	mov    %r12d,%esi
+  8022df:	4c 89 ef             	mov    %r13,%rdi
+  8022e2:	ff d0                	call   *%rax
+}
+  8022e4:	48 83 c4 18          	add    $0x18,%rsp
+  8022e8:	5b                   	pop    %rbx
+  8022e9:	41 5c                	pop    %r12
+  8022eb:	41 5d                	pop    %r13
+  8022ed:	5d                   	pop    %rbp
+  8022ee:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8022ef:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022f6:	00 00 00 
+  8022f9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022ff:	89 da                	mov    %ebx,%edx
+  802301:	48 bf 08 56 80 00 00 	movabs $0x805608,%rdi
+  802308:	00 00 00 
+  80230b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802310:	48 b9 e9 01 80 00 00 	movabs $0x8001e9,%rcx
+  802317:	00 00 00 
+  80231a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80231c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802321:	eb c1                	jmp    8022e4 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802323:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802328:	eb ba                	jmp    8022e4 <ftruncate+0x5e>
+
+000000000080232a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80232a:	55                   	push   %rbp
+  80232b:	48 89 e5             	mov    %rsp,%rbp
+  80232e:	41 54                	push   %r12
+  802330:	53                   	push   %rbx
+  802331:	48 83 ec 10          	sub    $0x10,%rsp
+  802335:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802338:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80233c:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  802343:	00 00 00 
+  802346:	ff d0                	call   *%rax
+  802348:	85 c0                	test   %eax,%eax
+  80234a:	78 4e                	js     80239a <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80234c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802350:	41 8b 3c 24          	mov    (%r12),%edi
+  802354:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802358:	48 b8 b0 1d 80 00 00 	movabs $0x801db0,%rax
+  80235f:	00 00 00 
+  802362:	ff d0                	call   *%rax
+  802364:	85 c0                	test   %eax,%eax
+  802366:	78 32                	js     80239a <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802368:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80236c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802371:	74 30                	je     8023a3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802373:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802376:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80237d:	00 00 00 
+    stat->st_isdir = 0;
+  802380:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802387:	00 00 00 
+    stat->st_dev = dev;
+  80238a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802391:	48 89 de             	mov    %rbx,%rsi
+  802394:	4c 89 e7             	mov    %r12,%rdi
+  802397:	ff 50 28             	call   *0x28(%rax)
+}
+  80239a:	48 83 c4 10          	add    $0x10,%rsp
+  80239e:	5b                   	pop    %rbx
+  80239f:	41 5c                	pop    %r12
+  8023a1:	5d                   	pop    %rbp
+  8023a2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8023a3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023a8:	eb f0                	jmp    80239a <fstat+0x70>
+
+00000000008023aa <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8023aa:	55                   	push   %rbp
+  8023ab:	48 89 e5             	mov    %rsp,%rbp
+  8023ae:	41 54                	push   %r12
+  8023b0:	53                   	push   %rbx
+  8023b1:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8023b8:	41 89 fc             	mov    %edi,%r12d
+  8023bb:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023bd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023c1:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  8023c8:	00 00 00 
+  8023cb:	ff d0                	call   *%rax
+  8023cd:	85 c0                	test   %eax,%eax
+  8023cf:	78 31                	js     802402 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8023d1:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8023d8:	44 89 e7             	mov    %r12d,%edi
+  8023db:	48 b8 2a 23 80 00 00 	movabs $0x80232a,%rax
+  8023e2:	00 00 00 
+  8023e5:	ff d0                	call   *%rax
+  8023e7:	85 c0                	test   %eax,%eax
+  8023e9:	78 17                	js     802402 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8023eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023ef:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8023f2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8023f5:	39 d3                	cmp    %edx,%ebx
+  8023f7:	0f 4f da             	cmovg  %edx,%ebx
+  8023fa:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802402:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802409:	5b                   	pop    %rbx
+  80240a:	41 5c                	pop    %r12
+  80240c:	5d                   	pop    %rbp
+  80240d:	c3                   	ret
+
+000000000080240e <seektoend>:
+{
+  80240e:	55                   	push   %rbp
+  80240f:	48 89 e5             	mov    %rsp,%rbp
+  802412:	53                   	push   %rbx
+  802413:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80241a:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80241c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802420:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  802427:	00 00 00 
+  80242a:	ff d0                	call   *%rax
+  80242c:	85 c0                	test   %eax,%eax
+  80242e:	78 28                	js     802458 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802430:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802437:	89 df                	mov    %ebx,%edi
+  802439:	48 b8 2a 23 80 00 00 	movabs $0x80232a,%rax
+  802440:	00 00 00 
+  802443:	ff d0                	call   *%rax
+  802445:	85 c0                	test   %eax,%eax
+  802447:	78 0f                	js     802458 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802449:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80244c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802450:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802453:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802458:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80245c:	c9                   	leave
+  80245d:	c3                   	ret
+
+000000000080245e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80245e:	55                   	push   %rbp
+  80245f:	48 89 e5             	mov    %rsp,%rbp
+  802462:	41 54                	push   %r12
+  802464:	53                   	push   %rbx
+  802465:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802468:	be 00 00 00 00       	mov    $0x0,%esi
+  80246d:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  802474:	00 00 00 
+  802477:	ff d0                	call   *%rax
+  802479:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	78 25                	js     8024a4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80247f:	4c 89 e6             	mov    %r12,%rsi
+  802482:	89 c7                	mov    %eax,%edi
+  802484:	48 b8 2a 23 80 00 00 	movabs $0x80232a,%rax
+  80248b:	00 00 00 
+  80248e:	ff d0                	call   *%rax
+  802490:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802493:	89 df                	mov    %ebx,%edi
+  802495:	48 b8 ca 1e 80 00 00 	movabs $0x801eca,%rax
+  80249c:	00 00 00 
+  80249f:	ff d0                	call   *%rax
+
+    return res;
+  8024a1:	44 89 e3             	mov    %r12d,%ebx
+}
+  8024a4:	89 d8                	mov    %ebx,%eax
+  8024a6:	5b                   	pop    %rbx
+  8024a7:	41 5c                	pop    %r12
+  8024a9:	5d                   	pop    %rbp
+  8024aa:	c3                   	ret
+
+00000000008024ab <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8024ab:	55                   	push   %rbp
+  8024ac:	48 89 e5             	mov    %rsp,%rbp
+  8024af:	53                   	push   %rbx
+  8024b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b4:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8024b7:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  8024be:	00 00 00 
+  8024c1:	ff d0                	call   *%rax
+  8024c3:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8024c7:	0f 87 ea 00 00 00    	ja     8025b7 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8024cd:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024d4:	00 00 00 
+  8024d7:	80 38 00             	cmpb   $0x0,(%rax)
+  8024da:	75 35                	jne    802511 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8024dc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8024e1:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8024e6:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8024eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024f0:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  8024f7:	00 00 00 
+  8024fa:	ff d0                	call   *%rax
+  8024fc:	85 c0                	test   %eax,%eax
+  8024fe:	0f 88 ba 00 00 00    	js     8025be <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802504:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80250b:	00 00 00 
+  80250e:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802511:	48 89 df             	mov    %rbx,%rdi
+  802514:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  80251b:	00 00 00 
+  80251e:	ff d0                	call   *%rax
+  802520:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802524:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80252b:	00 00 00 
+  80252e:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802532:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802535:	39 39                	cmp    %edi,(%rcx)
+  802537:	74 46                	je     80257f <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802539:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80253d:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802544:	00 
+  802545:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80254c:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802553:	00 
+  802554:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80255b:	00 
+  80255c:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802563:	00 
+  802564:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80256b:	00 
+  80256c:	89 39                	mov    %edi,(%rcx)
+  80256e:	48 01 c6             	add    %rax,%rsi
+  802571:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802576:	48 89 c8             	mov    %rcx,%rax
+  802579:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80257d:	c9                   	leave
+  80257e:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80257f:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802583:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80258a:	00 00 00 
+  80258d:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802590:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802594:	74 e0                	je     802576 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802596:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80259d:	00 
+  80259e:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8025a2:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8025a9:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8025ab:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8025ae:	48 01 c2             	add    %rax,%rdx
+  8025b1:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8025b5:	eb bf                	jmp    802576 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8025b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025bc:	eb b8                	jmp    802576 <fbuf_get+0xcb>
+            return NULL;
+  8025be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025c3:	eb b1                	jmp    802576 <fbuf_get+0xcb>
+
+00000000008025c5 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8025c5:	55                   	push   %rbp
+  8025c6:	48 89 e5             	mov    %rsp,%rbp
+  8025c9:	53                   	push   %rbx
+  8025ca:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8025ce:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025d5:	00 00 00 
+  8025d8:	48 8b 18             	mov    (%rax),%rbx
+  8025db:	48 85 db             	test   %rbx,%rbx
+  8025de:	74 16                	je     8025f6 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8025e0:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025e7:	00 00 00 
+  8025ea:	48 8b 18             	mov    (%rax),%rbx
+}
+  8025ed:	48 89 d8             	mov    %rbx,%rax
+  8025f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025f4:	c9                   	leave
+  8025f5:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8025f6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8025fb:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802600:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802605:	bf 00 00 00 00       	mov    $0x0,%edi
+  80260a:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  802611:	00 00 00 
+  802614:	ff d0                	call   *%rax
+  802616:	85 c0                	test   %eax,%eax
+  802618:	78 d3                	js     8025ed <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  80261a:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  80261f:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802626:	00 00 00 
+  802629:	eb b5                	jmp    8025e0 <fsipc_bulk+0x1b>
+
+000000000080262b <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80262b:	55                   	push   %rbp
+  80262c:	48 89 e5             	mov    %rsp,%rbp
+  80262f:	41 57                	push   %r15
+  802631:	41 56                	push   %r14
+  802633:	41 55                	push   %r13
+  802635:	41 54                	push   %r12
+  802637:	53                   	push   %rbx
+  802638:	48 83 ec 08          	sub    $0x8,%rsp
+  80263c:	41 89 fd             	mov    %edi,%r13d
+  80263f:	49 89 f6             	mov    %rsi,%r14
+  802642:	49 89 d7             	mov    %rdx,%r15
+  802645:	48 89 cb             	mov    %rcx,%rbx
+  802648:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80264b:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802652:	00 00 00 
+  802655:	83 38 00             	cmpl   $0x0,(%rax)
+  802658:	74 52                	je     8026ac <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80265a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802660:	4c 89 f9             	mov    %r15,%rcx
+  802663:	4c 89 f2             	mov    %r14,%rdx
+  802666:	44 89 ee             	mov    %r13d,%esi
+  802669:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802670:	00 00 00 
+  802673:	8b 38                	mov    (%rax),%edi
+  802675:	48 b8 b3 41 80 00 00 	movabs $0x8041b3,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802681:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802686:	4c 89 e2             	mov    %r12,%rdx
+  802689:	48 89 de             	mov    %rbx,%rsi
+  80268c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802691:	48 b8 03 40 80 00 00 	movabs $0x804003,%rax
+  802698:	00 00 00 
+  80269b:	ff d0                	call   *%rax
+}
+  80269d:	48 83 c4 08          	add    $0x8,%rsp
+  8026a1:	5b                   	pop    %rbx
+  8026a2:	41 5c                	pop    %r12
+  8026a4:	41 5d                	pop    %r13
+  8026a6:	41 5e                	pop    %r14
+  8026a8:	41 5f                	pop    %r15
+  8026aa:	5d                   	pop    %rbp
+  8026ab:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026ac:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026b1:	48 b8 56 42 80 00 00 	movabs $0x804256,%rax
+  8026b8:	00 00 00 
+  8026bb:	ff d0                	call   *%rax
+  8026bd:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8026c4:	00 00 
+  8026c6:	eb 92                	jmp    80265a <fsipc_region+0x2f>
+
+00000000008026c8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8026c8:	55                   	push   %rbp
+  8026c9:	48 89 e5             	mov    %rsp,%rbp
+  8026cc:	41 57                	push   %r15
+  8026ce:	41 56                	push   %r14
+  8026d0:	41 55                	push   %r13
+  8026d2:	41 54                	push   %r12
+  8026d4:	53                   	push   %rbx
+  8026d5:	48 83 ec 28          	sub    $0x28,%rsp
+  8026d9:	49 89 ff             	mov    %rdi,%r15
+  8026dc:	49 89 f6             	mov    %rsi,%r14
+  8026df:	48 89 d3             	mov    %rdx,%rbx
+  8026e2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026e6:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8026e9:	48 b8 c5 25 80 00 00 	movabs $0x8025c5,%rax
+  8026f0:	00 00 00 
+  8026f3:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8026f5:	48 85 c0             	test   %rax,%rax
+  8026f8:	0f 84 cc 00 00 00    	je     8027ca <devfile_write_direct+0x102>
+  8026fe:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802701:	48 85 db             	test   %rbx,%rbx
+  802704:	0f 84 ba 00 00 00    	je     8027c4 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  80270a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802710:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802717:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  80271b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80271f:	4c 29 e3             	sub    %r12,%rbx
+  802722:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802727:	48 39 c3             	cmp    %rax,%rbx
+  80272a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80272e:	48 89 da             	mov    %rbx,%rdx
+  802731:	4c 89 f6             	mov    %r14,%rsi
+  802734:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802738:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  80273f:	00 00 00 
+  802742:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802744:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802748:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  80274c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80274f:	44 01 e0             	add    %r12d,%eax
+  802752:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802756:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80275a:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802761:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802768:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80276f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802775:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80277a:	4c 89 ee             	mov    %r13,%rsi
+  80277d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802782:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802789:	00 00 00 
+  80278c:	ff d0                	call   *%rax
+        if (res < 0)
+  80278e:	85 c0                	test   %eax,%eax
+  802790:	78 29                	js     8027bb <devfile_write_direct+0xf3>
+        if (res == 0)
+  802792:	74 2b                	je     8027bf <devfile_write_direct+0xf7>
+        i += res;
+  802794:	48 98                	cltq
+  802796:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802799:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  80279c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027a0:	49 39 c4             	cmp    %rax,%r12
+  8027a3:	0f 82 72 ff ff ff    	jb     80271b <devfile_write_direct+0x53>
+    return i;
+  8027a9:	4c 89 e0             	mov    %r12,%rax
+}
+  8027ac:	48 83 c4 28          	add    $0x28,%rsp
+  8027b0:	5b                   	pop    %rbx
+  8027b1:	41 5c                	pop    %r12
+  8027b3:	41 5d                	pop    %r13
+  8027b5:	41 5e                	pop    %r14
+  8027b7:	41 5f                	pop    %r15
+  8027b9:	5d                   	pop    %rbp
+  8027ba:	c3                   	ret
+            return res;
+  8027bb:	48 98                	cltq
+  8027bd:	eb ed                	jmp    8027ac <devfile_write_direct+0xe4>
+            return i;
+  8027bf:	4c 89 e0             	mov    %r12,%rax
+  8027c2:	eb e8                	jmp    8027ac <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8027c4:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8027c8:	eb df                	jmp    8027a9 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8027ca:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8027d1:	eb d9                	jmp    8027ac <devfile_write_direct+0xe4>
+
+00000000008027d3 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8027d3:	55                   	push   %rbp
+  8027d4:	48 89 e5             	mov    %rsp,%rbp
+  8027d7:	41 56                	push   %r14
+  8027d9:	41 55                	push   %r13
+  8027db:	41 54                	push   %r12
+  8027dd:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8027de:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8027e2:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8027e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027eb:	4d 39 ee             	cmp    %r13,%r14
+  8027ee:	0f 84 99 00 00 00    	je     80288d <fbuf_flush+0xba>
+  8027f4:	49 89 fc             	mov    %rdi,%r12
+  8027f7:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8027fa:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8027fd:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802801:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  802808:	00 00 00 
+  80280b:	ff d0                	call   *%rax
+  80280d:	48 89 c2             	mov    %rax,%rdx
+  802810:	48 c1 e2 04          	shl    $0x4,%rdx
+  802814:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802818:	48 c1 e0 0c          	shl    $0xc,%rax
+  80281c:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802821:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802824:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802828:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80282f:	00 
+  802830:	44 89 f1             	mov    %r14d,%ecx
+  802833:	4c 89 ea             	mov    %r13,%rdx
+  802836:	4c 89 e7             	mov    %r12,%rdi
+  802839:	48 b8 c8 26 80 00 00 	movabs $0x8026c8,%rax
+  802840:	00 00 00 
+  802843:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802845:	48 85 c0             	test   %rax,%rax
+  802848:	78 43                	js     80288d <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80284a:	4c 39 e8             	cmp    %r13,%rax
+  80284d:	72 47                	jb     802896 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80284f:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802854:	83 c0 01             	add    $0x1,%eax
+  802857:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80285c:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80285f:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802863:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802867:	72 0f                	jb     802878 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802869:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80286d:	48 39 c2             	cmp    %rax,%rdx
+  802870:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802874:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802878:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80287f:	00 
+  802880:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802887:	00 
+    return 0;
+  802888:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288d:	5b                   	pop    %rbx
+  80288e:	41 5c                	pop    %r12
+  802890:	41 5d                	pop    %r13
+  802892:	41 5e                	pop    %r14
+  802894:	5d                   	pop    %rbp
+  802895:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802896:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80289b:	eb f0                	jmp    80288d <fbuf_flush+0xba>
+
+000000000080289d <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80289d:	55                   	push   %rbp
+  80289e:	48 89 e5             	mov    %rsp,%rbp
+  8028a1:	53                   	push   %rbx
+  8028a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a6:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  8028a9:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  8028b0:	00 00 00 
+  8028b3:	ff d0                	call   *%rax
+  8028b5:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  8028b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bd:	48 85 f6             	test   %rsi,%rsi
+  8028c0:	74 0f                	je     8028d1 <devfile_sync+0x34>
+  8028c2:	48 89 df             	mov    %rbx,%rdi
+  8028c5:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  8028cc:	00 00 00 
+  8028cf:	ff d0                	call   *%rax
+}
+  8028d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028d5:	c9                   	leave
+  8028d6:	c3                   	ret
+
+00000000008028d7 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8028d7:	55                   	push   %rbp
+  8028d8:	48 89 e5             	mov    %rsp,%rbp
+  8028db:	48 83 ec 10          	sub    $0x10,%rsp
+  8028df:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8028e2:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8028e9:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8028ea:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8028ee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028f3:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8028fa:	00 00 00 
+  8028fd:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802904:	00 00 00 
+  802907:	ff d0                	call   *%rax
+}
+  802909:	c9                   	leave
+  80290a:	c3                   	ret
+
+000000000080290b <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80290b:	55                   	push   %rbp
+  80290c:	48 89 e5             	mov    %rsp,%rbp
+  80290f:	41 54                	push   %r12
+  802911:	53                   	push   %rbx
+  802912:	48 89 fb             	mov    %rdi,%rbx
+  802915:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802918:	48 b8 9d 28 80 00 00 	movabs $0x80289d,%rax
+  80291f:	00 00 00 
+  802922:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802924:	85 c0                	test   %eax,%eax
+  802926:	78 63                	js     80298b <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802928:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80292b:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802932:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802934:	be 00 00 00 00       	mov    $0x0,%esi
+  802939:	bf 05 00 00 00       	mov    $0x5,%edi
+  80293e:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  802945:	00 00 00 
+  802948:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80294a:	85 c0                	test   %eax,%eax
+  80294c:	78 3d                	js     80298b <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80294e:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802955:	00 00 00 
+  802958:	48 89 de             	mov    %rbx,%rsi
+  80295b:	4c 89 e7             	mov    %r12,%rdi
+  80295e:	48 b8 61 0b 80 00 00 	movabs $0x800b61,%rax
+  802965:	00 00 00 
+  802968:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80296a:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802970:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802977:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802978:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80297e:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802985:	00 
+
+    return 0;
+  802986:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80298b:	5b                   	pop    %rbx
+  80298c:	41 5c                	pop    %r12
+  80298e:	5d                   	pop    %rbp
+  80298f:	c3                   	ret
+
+0000000000802990 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802990:	55                   	push   %rbp
+  802991:	48 89 e5             	mov    %rsp,%rbp
+  802994:	41 54                	push   %r12
+  802996:	53                   	push   %rbx
+  802997:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  80299a:	48 b8 9d 28 80 00 00 	movabs $0x80289d,%rax
+  8029a1:	00 00 00 
+  8029a4:	ff d0                	call   *%rax
+  8029a6:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  8029a9:	48 89 df             	mov    %rbx,%rdi
+  8029ac:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  8029b3:	00 00 00 
+  8029b6:	ff d0                	call   *%rax
+  8029b8:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8029bc:	76 2e                	jbe    8029ec <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  8029be:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8029c1:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8029c8:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8029ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8029cf:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029d4:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  8029db:	00 00 00 
+  8029de:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8029e0:	45 85 e4             	test   %r12d,%r12d
+  8029e3:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8029e7:	5b                   	pop    %rbx
+  8029e8:	41 5c                	pop    %r12
+  8029ea:	5d                   	pop    %rbp
+  8029eb:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8029ec:	48 89 df             	mov    %rbx,%rdi
+  8029ef:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  8029f6:	00 00 00 
+  8029f9:	ff d0                	call   *%rax
+  8029fb:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8029ff:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802a06:	00 00 00 
+  802a09:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802a10:	48 89 df             	mov    %rbx,%rdi
+  802a13:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  802a1a:	00 00 00 
+  802a1d:	ff d0                	call   *%rax
+  802a1f:	48 89 c6             	mov    %rax,%rsi
+  802a22:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a27:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a2c:	48 b8 a0 14 80 00 00 	movabs $0x8014a0,%rax
+  802a33:	00 00 00 
+  802a36:	ff d0                	call   *%rax
+  802a38:	eb 84                	jmp    8029be <devfile_flush+0x2e>
+
+0000000000802a3a <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	41 55                	push   %r13
+  802a40:	41 54                	push   %r12
+  802a42:	53                   	push   %rbx
+  802a43:	48 83 ec 08          	sub    $0x8,%rsp
+  802a47:	48 89 fb             	mov    %rdi,%rbx
+  802a4a:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802a4d:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  802a54:	00 00 00 
+  802a57:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802a59:	48 85 c0             	test   %rax,%rax
+  802a5c:	74 51                	je     802aaf <devfile_trunc+0x75>
+  802a5e:	49 89 c4             	mov    %rax,%r12
+  802a61:	48 89 c6             	mov    %rax,%rsi
+  802a64:	48 89 df             	mov    %rbx,%rdi
+  802a67:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  802a6e:	00 00 00 
+  802a71:	ff d0                	call   *%rax
+  802a73:	85 c0                	test   %eax,%eax
+  802a75:	78 2d                	js     802aa4 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a77:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802a7e:	00 00 00 
+  802a81:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802a84:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802a86:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802a8a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a8f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a94:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  802a9b:	00 00 00 
+  802a9e:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802aa0:	85 c0                	test   %eax,%eax
+  802aa2:	79 3e                	jns    802ae2 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802aa4:	48 83 c4 08          	add    $0x8,%rsp
+  802aa8:	5b                   	pop    %rbx
+  802aa9:	41 5c                	pop    %r12
+  802aab:	41 5d                	pop    %r13
+  802aad:	5d                   	pop    %rbp
+  802aae:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802aaf:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802ab6:	00 00 00 
+  802ab9:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802abc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802abe:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ac2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac7:	bf 02 00 00 00       	mov    $0x2,%edi
+  802acc:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  802ad3:	00 00 00 
+  802ad6:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ad8:	85 c0                	test   %eax,%eax
+  802ada:	78 c8                	js     802aa4 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802adc:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ae0:	eb c2                	jmp    802aa4 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ae2:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802ae5:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ae8:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802aeb:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802af0:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802af7:	00 00 
+  802af9:	eb a9                	jmp    802aa4 <devfile_trunc+0x6a>
+
+0000000000802afb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802afb:	55                   	push   %rbp
+  802afc:	48 89 e5             	mov    %rsp,%rbp
+  802aff:	41 57                	push   %r15
+  802b01:	41 56                	push   %r14
+  802b03:	41 55                	push   %r13
+  802b05:	41 54                	push   %r12
+  802b07:	53                   	push   %rbx
+  802b08:	48 83 ec 28          	sub    $0x28,%rsp
+  802b0c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802b10:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802b14:	49 89 d7             	mov    %rdx,%r15
+  802b17:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802b1b:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  802b22:	00 00 00 
+  802b25:	ff d0                	call   *%rax
+  802b27:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802b2a:	48 85 c0             	test   %rax,%rax
+  802b2d:	74 31                	je     802b60 <devfile_write+0x65>
+  802b2f:	4c 89 f8             	mov    %r15,%rax
+  802b32:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802b39:	77 25                	ja     802b60 <devfile_write+0x65>
+    size_t i = 0;
+  802b3b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802b41:	48 85 c0             	test   %rax,%rax
+  802b44:	0f 85 64 01 00 00    	jne    802cae <devfile_write+0x1b3>
+    size_t i = 0;
+  802b4a:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802b4e:	4c 89 f8             	mov    %r15,%rax
+}
+  802b51:	48 83 c4 28          	add    $0x28,%rsp
+  802b55:	5b                   	pop    %rbx
+  802b56:	41 5c                	pop    %r12
+  802b58:	41 5d                	pop    %r13
+  802b5a:	41 5e                	pop    %r14
+  802b5c:	41 5f                	pop    %r15
+  802b5e:	5d                   	pop    %rbp
+  802b5f:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802b60:	48 85 db             	test   %rbx,%rbx
+  802b63:	74 5b                	je     802bc0 <devfile_write+0xc5>
+  802b65:	48 89 de             	mov    %rbx,%rsi
+  802b68:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b6c:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  802b73:	00 00 00 
+  802b76:	ff d0                	call   *%rax
+  802b78:	85 c0                	test   %eax,%eax
+  802b7a:	78 40                	js     802bbc <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802b7c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b80:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802b83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b87:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802b8b:	48 b8 c8 26 80 00 00 	movabs $0x8026c8,%rax
+  802b92:	00 00 00 
+  802b95:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802b97:	48 85 c0             	test   %rax,%rax
+  802b9a:	7e b5                	jle    802b51 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802b9c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802ba0:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802ba3:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802ba6:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802ba9:	8d 51 01             	lea    0x1(%rcx),%edx
+  802bac:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802baf:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802bb2:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802bb9:	00 
+  802bba:	eb 95                	jmp    802b51 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802bbc:	48 98                	cltq
+  802bbe:	eb 91                	jmp    802b51 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802bc0:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802bc4:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802bc7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bcb:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802bcf:	48 89 df             	mov    %rbx,%rdi
+  802bd2:	48 b8 c8 26 80 00 00 	movabs $0x8026c8,%rax
+  802bd9:	00 00 00 
+  802bdc:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802bde:	48 85 c0             	test   %rax,%rax
+  802be1:	0f 8e 6a ff ff ff    	jle    802b51 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802be7:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802bea:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802bee:	e9 5e ff ff ff       	jmp    802b51 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802bf3:	48 98                	cltq
+  802bf5:	4d 85 ff             	test   %r15,%r15
+  802bf8:	49 0f 45 c7          	cmovne %r15,%rax
+  802bfc:	e9 50 ff ff ff       	jmp    802b51 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802c01:	48 89 de             	mov    %rbx,%rsi
+  802c04:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c08:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  802c0f:	00 00 00 
+  802c12:	ff d0                	call   *%rax
+  802c14:	85 c0                	test   %eax,%eax
+  802c16:	0f 88 2b 01 00 00    	js     802d47 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802c1c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c20:	4c 01 f8             	add    %r15,%rax
+  802c23:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c27:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c2b:	48 b9 d7 1c 80 00 00 	movabs $0x801cd7,%rcx
+  802c32:	00 00 00 
+  802c35:	ff d1                	call   *%rcx
+  802c37:	48 89 c2             	mov    %rax,%rdx
+  802c3a:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c3e:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c42:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c46:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802c4b:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802c4e:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802c55:	00 
+  802c56:	4c 89 ea             	mov    %r13,%rdx
+  802c59:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802c5d:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  802c64:	00 00 00 
+  802c67:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802c69:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c6d:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802c71:	48 39 c2             	cmp    %rax,%rdx
+  802c74:	0f 84 db 00 00 00    	je     802d55 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802c7a:	4c 39 e2             	cmp    %r12,%rdx
+  802c7d:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802c81:	4d 01 ec             	add    %r13,%r12
+  802c84:	49 39 c4             	cmp    %rax,%r12
+  802c87:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802c8b:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802c8f:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802c93:	45 01 ee             	add    %r13d,%r14d
+  802c96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c9a:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802c9e:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802ca1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ca5:	49 39 c7             	cmp    %rax,%r15
+  802ca8:	0f 83 a0 fe ff ff    	jae    802b4e <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802cae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cb2:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802cb6:	8b 43 08             	mov    0x8(%rbx),%eax
+  802cb9:	44 39 f0             	cmp    %r14d,%eax
+  802cbc:	7f 10                	jg     802cce <devfile_write+0x1d3>
+  802cbe:	48 98                	cltq
+  802cc0:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802cc6:	49 63 d6             	movslq %r14d,%rdx
+  802cc9:	48 39 d0             	cmp    %rdx,%rax
+  802ccc:	7d 2d                	jge    802cfb <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802cce:	48 89 de             	mov    %rbx,%rsi
+  802cd1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802cd5:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  802cdc:	00 00 00 
+  802cdf:	ff d0                	call   *%rax
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	0f 88 0a ff ff ff    	js     802bf3 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802ce9:	44 89 f0             	mov    %r14d,%eax
+  802cec:	66 b8 00 00          	mov    $0x0,%ax
+  802cf0:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802cf3:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802cfa:	00 
+        size_t off = pos - fb->fb_base;
+  802cfb:	45 89 f4             	mov    %r14d,%r12d
+  802cfe:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802d02:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802d05:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802d09:	4d 29 fd             	sub    %r15,%r13
+  802d0c:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802d11:	4c 29 e0             	sub    %r12,%rax
+  802d14:	49 39 c5             	cmp    %rax,%r13
+  802d17:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802d1b:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802d1f:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802d23:	48 39 c2             	cmp    %rax,%rdx
+  802d26:	0f 84 f0 fe ff ff    	je     802c1c <devfile_write+0x121>
+  802d2c:	4c 39 e0             	cmp    %r12,%rax
+  802d2f:	0f 82 cc fe ff ff    	jb     802c01 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802d35:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d39:	48 39 d0             	cmp    %rdx,%rax
+  802d3c:	0f 83 da fe ff ff    	jae    802c1c <devfile_write+0x121>
+  802d42:	e9 ba fe ff ff       	jmp    802c01 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d47:	48 98                	cltq
+  802d49:	4d 85 ff             	test   %r15,%r15
+  802d4c:	49 0f 45 c7          	cmovne %r15,%rax
+  802d50:	e9 fc fd ff ff       	jmp    802b51 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802d55:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d59:	4c 89 e2             	mov    %r12,%rdx
+  802d5c:	e9 2a ff ff ff       	jmp    802c8b <devfile_write+0x190>
+
+0000000000802d61 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d61:	55                   	push   %rbp
+  802d62:	48 89 e5             	mov    %rsp,%rbp
+  802d65:	41 57                	push   %r15
+  802d67:	41 56                	push   %r14
+  802d69:	41 55                	push   %r13
+  802d6b:	41 54                	push   %r12
+  802d6d:	53                   	push   %rbx
+  802d6e:	48 83 ec 28          	sub    $0x28,%rsp
+  802d72:	49 89 ff             	mov    %rdi,%r15
+  802d75:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d79:	48 89 d3             	mov    %rdx,%rbx
+  802d7c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802d80:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  802d87:	00 00 00 
+  802d8a:	ff d0                	call   *%rax
+  802d8c:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802d8f:	48 85 c0             	test   %rax,%rax
+  802d92:	74 0d                	je     802da1 <devfile_read+0x40>
+  802d94:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802d9b:	0f 86 1a 01 00 00    	jbe    802ebb <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802da1:	4d 85 e4             	test   %r12,%r12
+  802da4:	74 1a                	je     802dc0 <devfile_read+0x5f>
+  802da6:	4c 89 e6             	mov    %r12,%rsi
+  802da9:	4c 89 ff             	mov    %r15,%rdi
+  802dac:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  802db3:	00 00 00 
+  802db6:	ff d0                	call   *%rax
+  802db8:	85 c0                	test   %eax,%eax
+  802dba:	0f 88 e8 00 00 00    	js     802ea8 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802dc0:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802dc4:	48 b8 c5 25 80 00 00 	movabs $0x8025c5,%rax
+  802dcb:	00 00 00 
+  802dce:	ff d0                	call   *%rax
+  802dd0:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802dd3:	48 85 c0             	test   %rax,%rax
+  802dd6:	0f 84 69 02 00 00    	je     803045 <devfile_read+0x2e4>
+    while (i < n) {
+  802ddc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802de1:	0f 84 ce 00 00 00    	je     802eb5 <devfile_read+0x154>
+    size_t i = 0;
+  802de7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802dec:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802df3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802df7:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802dfb:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802dff:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802e03:	48 29 da             	sub    %rbx,%rdx
+  802e06:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802e0b:	48 39 c2             	cmp    %rax,%rdx
+  802e0e:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802e12:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e16:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802e1a:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802e1d:	01 d8                	add    %ebx,%eax
+  802e1f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802e23:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802e27:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802e2e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e35:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802e3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e47:	4c 89 ee             	mov    %r13,%rsi
+  802e4a:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e4f:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802e56:	00 00 00 
+  802e59:	ff d0                	call   *%rax
+        if (res < 0)
+  802e5b:	85 c0                	test   %eax,%eax
+  802e5d:	78 4d                	js     802eac <devfile_read+0x14b>
+        if (res == 0)
+  802e5f:	74 4f                	je     802eb0 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802e61:	4c 63 e0             	movslq %eax,%r12
+  802e64:	4c 89 e2             	mov    %r12,%rdx
+  802e67:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802e6b:	4c 89 f7             	mov    %r14,%rdi
+  802e6e:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  802e75:	00 00 00 
+  802e78:	ff d0                	call   *%rax
+        i += res;
+  802e7a:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  802e7d:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  802e80:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e84:	48 39 c3             	cmp    %rax,%rbx
+  802e87:	0f 82 72 ff ff ff    	jb     802dff <devfile_read+0x9e>
+    return i;
+  802e8d:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802e90:	48 85 c0             	test   %rax,%rax
+  802e93:	7e 04                	jle    802e99 <devfile_read+0x138>
+  802e95:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  802e99:	48 83 c4 28          	add    $0x28,%rsp
+  802e9d:	5b                   	pop    %rbx
+  802e9e:	41 5c                	pop    %r12
+  802ea0:	41 5d                	pop    %r13
+  802ea2:	41 5e                	pop    %r14
+  802ea4:	41 5f                	pop    %r15
+  802ea6:	5d                   	pop    %rbp
+  802ea7:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ea8:	48 98                	cltq
+  802eaa:	eb ed                	jmp    802e99 <devfile_read+0x138>
+            return res;
+  802eac:	48 98                	cltq
+  802eae:	eb e9                	jmp    802e99 <devfile_read+0x138>
+            return i;
+  802eb0:	48 89 d8             	mov    %rbx,%rax
+  802eb3:	eb db                	jmp    802e90 <devfile_read+0x12f>
+    size_t i = 0;
+  802eb5:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802eb9:	eb d2                	jmp    802e8d <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802ebb:	48 89 c6             	mov    %rax,%rsi
+  802ebe:	4c 89 ff             	mov    %r15,%rdi
+  802ec1:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  802ec8:	00 00 00 
+  802ecb:	ff d0                	call   *%rax
+  802ecd:	85 c0                	test   %eax,%eax
+  802ecf:	78 40                	js     802f11 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802ed1:	4c 89 ff             	mov    %r15,%rdi
+  802ed4:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  802edb:	00 00 00 
+  802ede:	ff d0                	call   *%rax
+  802ee0:	48 89 c2             	mov    %rax,%rdx
+  802ee3:	48 c1 e2 04          	shl    $0x4,%rdx
+  802ee7:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802eeb:	48 c1 e0 0c          	shl    $0xc,%rax
+  802eef:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802ef4:	48 01 d0             	add    %rdx,%rax
+  802ef7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  802efb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802f00:	0f 84 33 01 00 00    	je     803039 <devfile_read+0x2d8>
+    size_t i = 0;
+  802f06:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802f0c:	e9 f5 00 00 00       	jmp    803006 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802f11:	48 98                	cltq
+  802f13:	eb 84                	jmp    802e99 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802f15:	44 89 e8             	mov    %r13d,%eax
+  802f18:	66 b8 00 00          	mov    $0x0,%ax
+  802f1c:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  802f21:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f28:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  802f2a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f2e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f32:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  802f34:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802f39:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  802f3c:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  802f43:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  802f44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f4f:	ba 00 10 01 00       	mov    $0x11000,%edx
+  802f54:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f59:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  802f60:	00 00 00 
+  802f63:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  802f65:	85 c0                	test   %eax,%eax
+  802f67:	0f 88 be 00 00 00    	js     80302b <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  802f6d:	48 63 d0             	movslq %eax,%rdx
+  802f70:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  802f75:	41 03 44 24 08       	add    0x8(%r12),%eax
+  802f7a:	44 39 e8             	cmp    %r13d,%eax
+  802f7d:	0f 8e ba 00 00 00    	jle    80303d <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  802f83:	49 63 c5             	movslq %r13d,%rax
+  802f86:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802f8b:	48 29 c3             	sub    %rax,%rbx
+  802f8e:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  802f93:	48 01 c3             	add    %rax,%rbx
+  802f96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f9a:	4c 29 f0             	sub    %r14,%rax
+  802f9d:	48 39 c3             	cmp    %rax,%rbx
+  802fa0:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802fa4:	4c 89 ff             	mov    %r15,%rdi
+  802fa7:	48 b9 d7 1c 80 00 00 	movabs $0x801cd7,%rcx
+  802fae:	00 00 00 
+  802fb1:	ff d1                	call   *%rcx
+  802fb3:	48 89 c2             	mov    %rax,%rdx
+  802fb6:	48 c1 e2 04          	shl    $0x4,%rdx
+  802fba:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802fbe:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fc2:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  802fc7:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  802fca:	44 89 ea             	mov    %r13d,%edx
+  802fcd:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  802fd2:	48 63 d2             	movslq %edx,%rdx
+  802fd5:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802fdc:	00 
+  802fdd:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802fe1:	4c 01 f7             	add    %r14,%rdi
+  802fe4:	48 89 da             	mov    %rbx,%rdx
+  802fe7:	48 b9 56 0f 80 00 00 	movabs $0x800f56,%rcx
+  802fee:	00 00 00 
+  802ff1:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  802ff3:	41 01 dd             	add    %ebx,%r13d
+  802ff6:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  802ffa:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  802ffd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803001:	49 39 c6             	cmp    %rax,%r14
+  803004:	73 37                	jae    80303d <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803006:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  80300a:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80300f:	44 39 e8             	cmp    %r13d,%eax
+  803012:	0f 8f fd fe ff ff    	jg     802f15 <devfile_read+0x1b4>
+  803018:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80301d:	44 39 e8             	cmp    %r13d,%eax
+  803020:	0f 8f 5d ff ff ff    	jg     802f83 <devfile_read+0x222>
+  803026:	e9 ea fe ff ff       	jmp    802f15 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80302b:	48 98                	cltq
+  80302d:	4d 85 f6             	test   %r14,%r14
+  803030:	49 0f 45 c6          	cmovne %r14,%rax
+  803034:	e9 60 fe ff ff       	jmp    802e99 <devfile_read+0x138>
+    size_t i = 0;
+  803039:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80303d:	4c 89 f0             	mov    %r14,%rax
+  803040:	e9 54 fe ff ff       	jmp    802e99 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803045:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80304c:	e9 48 fe ff ff       	jmp    802e99 <devfile_read+0x138>
+
+0000000000803051 <open>:
+open(const char *path, int mode) {
+  803051:	55                   	push   %rbp
+  803052:	48 89 e5             	mov    %rsp,%rbp
+  803055:	41 55                	push   %r13
+  803057:	41 54                	push   %r12
+  803059:	53                   	push   %rbx
+  80305a:	48 83 ec 18          	sub    $0x18,%rsp
+  80305e:	49 89 fc             	mov    %rdi,%r12
+  803061:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803064:	48 b8 23 0b 80 00 00 	movabs $0x800b23,%rax
+  80306b:	00 00 00 
+  80306e:	ff d0                	call   *%rax
+  803070:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803076:	0f 87 8a 00 00 00    	ja     803106 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80307c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803080:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  803087:	00 00 00 
+  80308a:	ff d0                	call   *%rax
+  80308c:	89 c3                	mov    %eax,%ebx
+  80308e:	85 c0                	test   %eax,%eax
+  803090:	78 50                	js     8030e2 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803092:	4c 89 e6             	mov    %r12,%rsi
+  803095:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80309c:	00 00 00 
+  80309f:	48 89 df             	mov    %rbx,%rdi
+  8030a2:	48 b8 61 0b 80 00 00 	movabs $0x800b61,%rax
+  8030a9:	00 00 00 
+  8030ac:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8030ae:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8030b5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030b9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8030be:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  8030c5:	00 00 00 
+  8030c8:	ff d0                	call   *%rax
+  8030ca:	89 c3                	mov    %eax,%ebx
+  8030cc:	85 c0                	test   %eax,%eax
+  8030ce:	78 1f                	js     8030ef <open+0x9e>
+    return fd2num(fd);
+  8030d0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030d4:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  8030db:	00 00 00 
+  8030de:	ff d0                	call   *%rax
+  8030e0:	89 c3                	mov    %eax,%ebx
+}
+  8030e2:	89 d8                	mov    %ebx,%eax
+  8030e4:	48 83 c4 18          	add    $0x18,%rsp
+  8030e8:	5b                   	pop    %rbx
+  8030e9:	41 5c                	pop    %r12
+  8030eb:	41 5d                	pop    %r13
+  8030ed:	5d                   	pop    %rbp
+  8030ee:	c3                   	ret
+        fd_close(fd, 0);
+  8030ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8030f4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030f8:	48 b8 20 1e 80 00 00 	movabs $0x801e20,%rax
+  8030ff:	00 00 00 
+  803102:	ff d0                	call   *%rax
+        return res;
+  803104:	eb dc                	jmp    8030e2 <open+0x91>
+        return -E_BAD_PATH;
+  803106:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80310b:	eb d5                	jmp    8030e2 <open+0x91>
+
+000000000080310d <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80310d:	55                   	push   %rbp
+  80310e:	48 89 e5             	mov    %rsp,%rbp
+  803111:	41 57                	push   %r15
+  803113:	41 56                	push   %r14
+  803115:	41 55                	push   %r13
+  803117:	41 54                	push   %r12
+  803119:	53                   	push   %rbx
+  80311a:	48 83 ec 18          	sub    $0x18,%rsp
+  80311e:	41 89 f6             	mov    %esi,%r14d
+  803121:	49 89 d7             	mov    %rdx,%r15
+  803124:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803127:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80312b:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  803132:	00 00 00 
+  803135:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803137:	85 c0                	test   %eax,%eax
+  803139:	0f 88 db 00 00 00    	js     80321a <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80313f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803143:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80314a:	00 00 00 
+  80314d:	8b 00                	mov    (%rax),%eax
+  80314f:	39 07                	cmp    %eax,(%rdi)
+  803151:	0f 85 db 00 00 00    	jne    803232 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803157:	45 85 f6             	test   %r14d,%r14d
+  80315a:	0f 88 db 00 00 00    	js     80323b <fmap+0x12e>
+  803160:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803167:	0f 85 d7 00 00 00    	jne    803244 <fmap+0x137>
+  80316d:	4c 89 fb             	mov    %r15,%rbx
+  803170:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803176:	0f 85 d1 00 00 00    	jne    80324d <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80317c:	48 b8 9d 28 80 00 00 	movabs $0x80289d,%rax
+  803183:	00 00 00 
+  803186:	ff d0                	call   *%rax
+  803188:	85 c0                	test   %eax,%eax
+  80318a:	0f 88 8e 00 00 00    	js     80321e <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803190:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803197:	00 00 00 
+    while (i < n) {
+  80319a:	4d 85 ed             	test   %r13,%r13
+  80319d:	0f 84 8a 00 00 00    	je     80322d <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8031a3:	4c 89 ea             	mov    %r13,%rdx
+  8031a6:	48 29 da             	sub    %rbx,%rdx
+  8031a9:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8031b0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8031ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031be:	8b 40 0c             	mov    0xc(%rax),%eax
+  8031c1:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8031c5:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8031c9:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8031ce:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8031d3:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8031d7:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8031db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031e0:	4c 89 e6             	mov    %r12,%rsi
+  8031e3:	bf 09 00 00 00       	mov    $0x9,%edi
+  8031e8:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  8031ef:	00 00 00 
+  8031f2:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8031f4:	85 c0                	test   %eax,%eax
+  8031f6:	78 2a                	js     803222 <fmap+0x115>
+        i += res;
+  8031f8:	48 98                	cltq
+  8031fa:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8031fd:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803201:	72 05                	jb     803208 <fmap+0xfb>
+    while (i < n) {
+  803203:	4c 39 eb             	cmp    %r13,%rbx
+  803206:	72 9b                	jb     8031a3 <fmap+0x96>
+    }
+    return i;
+  803208:	48 89 d8             	mov    %rbx,%rax
+}
+  80320b:	48 83 c4 18          	add    $0x18,%rsp
+  80320f:	5b                   	pop    %rbx
+  803210:	41 5c                	pop    %r12
+  803212:	41 5d                	pop    %r13
+  803214:	41 5e                	pop    %r14
+  803216:	41 5f                	pop    %r15
+  803218:	5d                   	pop    %rbp
+  803219:	c3                   	ret
+    if (res < 0) return res;
+  80321a:	48 98                	cltq
+  80321c:	eb ed                	jmp    80320b <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80321e:	48 98                	cltq
+  803220:	eb e9                	jmp    80320b <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803222:	48 98                	cltq
+  803224:	48 85 db             	test   %rbx,%rbx
+  803227:	48 0f 45 c3          	cmovne %rbx,%rax
+  80322b:	eb de                	jmp    80320b <fmap+0xfe>
+    size_t i = 0;
+  80322d:	4c 89 eb             	mov    %r13,%rbx
+  803230:	eb d6                	jmp    803208 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803232:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803239:	eb d0                	jmp    80320b <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80323b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803242:	eb c7                	jmp    80320b <fmap+0xfe>
+  803244:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80324b:	eb be                	jmp    80320b <fmap+0xfe>
+  80324d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803254:	eb b5                	jmp    80320b <fmap+0xfe>
+
+0000000000803256 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803256:	55                   	push   %rbp
+  803257:	48 89 e5             	mov    %rsp,%rbp
+  80325a:	41 56                	push   %r14
+  80325c:	41 55                	push   %r13
+  80325e:	41 54                	push   %r12
+  803260:	53                   	push   %rbx
+  803261:	48 83 ec 10          	sub    $0x10,%rsp
+  803265:	89 fb                	mov    %edi,%ebx
+  803267:	41 89 f4             	mov    %esi,%r12d
+  80326a:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80326d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803271:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  803278:	00 00 00 
+  80327b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80327d:	85 c0                	test   %eax,%eax
+  80327f:	78 63                	js     8032e4 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803281:	45 85 e4             	test   %r12d,%r12d
+  803284:	0f 88 80 00 00 00    	js     80330a <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80328a:	45 89 e6             	mov    %r12d,%r14d
+  80328d:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803294:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803298:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+  8032a4:	48 89 c2             	mov    %rax,%rdx
+  8032a7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8032ac:	44 89 f6             	mov    %r14d,%esi
+  8032af:	89 df                	mov    %ebx,%edi
+  8032b1:	48 b8 0d 31 80 00 00 	movabs $0x80310d,%rax
+  8032b8:	00 00 00 
+  8032bb:	ff d0                	call   *%rax
+  8032bd:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8032c0:	45 29 f4             	sub    %r14d,%r12d
+  8032c3:	4d 63 f4             	movslq %r12d,%r14
+  8032c6:	49 39 c6             	cmp    %rax,%r14
+  8032c9:	7c 1d                	jl     8032e8 <read_map+0x92>
+  8032cb:	48 85 c0             	test   %rax,%rax
+  8032ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d3:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8032d7:	48 83 c4 10          	add    $0x10,%rsp
+  8032db:	5b                   	pop    %rbx
+  8032dc:	41 5c                	pop    %r12
+  8032de:	41 5d                	pop    %r13
+  8032e0:	41 5e                	pop    %r14
+  8032e2:	5d                   	pop    %rbp
+  8032e3:	c3                   	ret
+    if (res < 0) return res;
+  8032e4:	48 98                	cltq
+  8032e6:	eb ef                	jmp    8032d7 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8032e8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032ec:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  8032f3:	00 00 00 
+  8032f6:	ff d0                	call   *%rax
+  8032f8:	4d 63 e4             	movslq %r12d,%r12
+  8032fb:	4c 01 e0             	add    %r12,%rax
+  8032fe:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803302:	48 89 d8             	mov    %rbx,%rax
+  803305:	4c 29 f0             	sub    %r14,%rax
+  803308:	eb cd                	jmp    8032d7 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  80330a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803311:	eb c4                	jmp    8032d7 <read_map+0x81>
+
+0000000000803313 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803313:	55                   	push   %rbp
+  803314:	48 89 e5             	mov    %rsp,%rbp
+  803317:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80331b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80331f:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  803326:	00 00 00 
+  803329:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80332b:	85 c0                	test   %eax,%eax
+  80332d:	78 4a                	js     803379 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80332f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803333:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80333a:	00 00 00 
+  80333d:	8b 00                	mov    (%rax),%eax
+  80333f:	39 07                	cmp    %eax,(%rdi)
+  803341:	75 38                	jne    80337b <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803343:	48 b8 9d 28 80 00 00 	movabs $0x80289d,%rax
+  80334a:	00 00 00 
+  80334d:	ff d0                	call   *%rax
+  80334f:	85 c0                	test   %eax,%eax
+  803351:	78 26                	js     803379 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803353:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803357:	8b 40 0c             	mov    0xc(%rax),%eax
+  80335a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803361:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803363:	be 00 00 00 00       	mov    $0x0,%esi
+  803368:	bf 06 00 00 00       	mov    $0x6,%edi
+  80336d:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  803374:	00 00 00 
+  803377:	ff d0                	call   *%rax
+}
+  803379:	c9                   	leave
+  80337a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80337b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803380:	eb f7                	jmp    803379 <fsync+0x66>
+
+0000000000803382 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803382:	55                   	push   %rbp
+  803383:	48 89 e5             	mov    %rsp,%rbp
+  803386:	41 57                	push   %r15
+  803388:	41 56                	push   %r14
+  80338a:	41 55                	push   %r13
+  80338c:	41 54                	push   %r12
+  80338e:	53                   	push   %rbx
+  80338f:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803393:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80339a:	00 00 00 
+  80339d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8033a2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033a8:	49 bd 65 1d 80 00 00 	movabs $0x801d65,%r13
+  8033af:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8033b2:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8033b9:	00 00 00 
+  8033bc:	eb 0c                	jmp    8033ca <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8033be:	83 c3 01             	add    $0x1,%ebx
+  8033c1:	49 83 c4 28          	add    $0x28,%r12
+  8033c5:	83 fb 20             	cmp    $0x20,%ebx
+  8033c8:	74 33                	je     8033fd <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033ca:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8033cf:	74 ed                	je     8033be <flushall+0x3c>
+  8033d1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033d5:	89 df                	mov    %ebx,%edi
+  8033d7:	41 ff d5             	call   *%r13
+  8033da:	85 c0                	test   %eax,%eax
+  8033dc:	78 e0                	js     8033be <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8033de:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033e2:	41 8b 06             	mov    (%r14),%eax
+  8033e5:	39 07                	cmp    %eax,(%rdi)
+  8033e7:	75 d5                	jne    8033be <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8033e9:	48 b8 9d 28 80 00 00 	movabs $0x80289d,%rax
+  8033f0:	00 00 00 
+  8033f3:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8033f5:	85 c0                	test   %eax,%eax
+  8033f7:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8033fb:	eb c1                	jmp    8033be <flushall+0x3c>
+    }
+    return res;
+}
+  8033fd:	44 89 f8             	mov    %r15d,%eax
+  803400:	48 83 c4 18          	add    $0x18,%rsp
+  803404:	5b                   	pop    %rbx
+  803405:	41 5c                	pop    %r12
+  803407:	41 5d                	pop    %r13
+  803409:	41 5e                	pop    %r14
+  80340b:	41 5f                	pop    %r15
+  80340d:	5d                   	pop    %rbp
+  80340e:	c3                   	ret
+
+000000000080340f <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80340f:	55                   	push   %rbp
+  803410:	48 89 e5             	mov    %rsp,%rbp
+  803413:	53                   	push   %rbx
+  803414:	48 83 ec 08          	sub    $0x8,%rsp
+  803418:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80341b:	40 0f b6 c6          	movzbl %sil,%eax
+  80341f:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803426:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803428:	be 00 00 00 00       	mov    $0x0,%esi
+  80342d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803432:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  803439:	00 00 00 
+  80343c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80343e:	85 c0                	test   %eax,%eax
+  803440:	78 23                	js     803465 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803442:	ba 58 06 00 00       	mov    $0x658,%edx
+  803447:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80344e:	00 00 00 
+  803451:	48 89 df             	mov    %rbx,%rdi
+  803454:	48 b8 56 0f 80 00 00 	movabs $0x800f56,%rax
+  80345b:	00 00 00 
+  80345e:	ff d0                	call   *%rax
+    return 0;
+  803460:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803465:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803469:	c9                   	leave
+  80346a:	c3                   	ret
+
+000000000080346b <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80346b:	55                   	push   %rbp
+  80346c:	48 89 e5             	mov    %rsp,%rbp
+  80346f:	53                   	push   %rbx
+  803470:	48 83 ec 08          	sub    $0x8,%rsp
+  803474:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803477:	48 b8 23 0b 80 00 00 	movabs $0x800b23,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+  803483:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803489:	77 35                	ja     8034c0 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80348b:	48 89 de             	mov    %rbx,%rsi
+  80348e:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803495:	00 00 00 
+  803498:	48 b8 61 0b 80 00 00 	movabs $0x800b61,%rax
+  80349f:	00 00 00 
+  8034a2:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8034a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a9:	bf 07 00 00 00       	mov    $0x7,%edi
+  8034ae:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  8034b5:	00 00 00 
+  8034b8:	ff d0                	call   *%rax
+}
+  8034ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034be:	c9                   	leave
+  8034bf:	c3                   	ret
+        return -E_BAD_PATH;
+  8034c0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034c5:	eb f3                	jmp    8034ba <remove+0x4f>
+
+00000000008034c7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8034c7:	55                   	push   %rbp
+  8034c8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8034cb:	48 b8 82 33 80 00 00 	movabs $0x803382,%rax
+  8034d2:	00 00 00 
+  8034d5:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8034d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8034dc:	bf 08 00 00 00       	mov    $0x8,%edi
+  8034e1:	48 b8 d7 28 80 00 00 	movabs $0x8028d7,%rax
+  8034e8:	00 00 00 
+  8034eb:	ff d0                	call   *%rax
+}
+  8034ed:	5d                   	pop    %rbp
+  8034ee:	c3                   	ret
+
+00000000008034ef <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8034ef:	55                   	push   %rbp
+  8034f0:	48 89 e5             	mov    %rsp,%rbp
+  8034f3:	41 54                	push   %r12
+  8034f5:	53                   	push   %rbx
+  8034f6:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8034f9:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  803500:	00 00 00 
+  803503:	ff d0                	call   *%rax
+  803505:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803508:	48 be a0 56 80 00 00 	movabs $0x8056a0,%rsi
+  80350f:	00 00 00 
+  803512:	48 89 df             	mov    %rbx,%rdi
+  803515:	48 b8 61 0b 80 00 00 	movabs $0x800b61,%rax
+  80351c:	00 00 00 
+  80351f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803521:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803526:	41 2b 04 24          	sub    (%r12),%eax
+  80352a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803530:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803537:	00 00 00 
+    stat->st_dev = &devpipe;
+  80353a:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803541:	00 00 00 
+  803544:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80354b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803550:	5b                   	pop    %rbx
+  803551:	41 5c                	pop    %r12
+  803553:	5d                   	pop    %rbp
+  803554:	c3                   	ret
+
+0000000000803555 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803555:	55                   	push   %rbp
+  803556:	48 89 e5             	mov    %rsp,%rbp
+  803559:	41 54                	push   %r12
+  80355b:	53                   	push   %rbx
+  80355c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80355f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803564:	48 89 fe             	mov    %rdi,%rsi
+  803567:	bf 00 00 00 00       	mov    $0x0,%edi
+  80356c:	49 bc a0 14 80 00 00 	movabs $0x8014a0,%r12
+  803573:	00 00 00 
+  803576:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803579:	48 89 df             	mov    %rbx,%rdi
+  80357c:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  803583:	00 00 00 
+  803586:	ff d0                	call   *%rax
+  803588:	48 89 c6             	mov    %rax,%rsi
+  80358b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803590:	bf 00 00 00 00       	mov    $0x0,%edi
+  803595:	41 ff d4             	call   *%r12
+}
+  803598:	5b                   	pop    %rbx
+  803599:	41 5c                	pop    %r12
+  80359b:	5d                   	pop    %rbp
+  80359c:	c3                   	ret
+
+000000000080359d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80359d:	55                   	push   %rbp
+  80359e:	48 89 e5             	mov    %rsp,%rbp
+  8035a1:	41 57                	push   %r15
+  8035a3:	41 56                	push   %r14
+  8035a5:	41 55                	push   %r13
+  8035a7:	41 54                	push   %r12
+  8035a9:	53                   	push   %rbx
+  8035aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8035ae:	49 89 fc             	mov    %rdi,%r12
+  8035b1:	49 89 f5             	mov    %rsi,%r13
+  8035b4:	49 89 d7             	mov    %rdx,%r15
+  8035b7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8035bb:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  8035c2:	00 00 00 
+  8035c5:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8035c7:	4d 85 ff             	test   %r15,%r15
+  8035ca:	0f 84 af 00 00 00    	je     80367f <devpipe_write+0xe2>
+  8035d0:	48 89 c3             	mov    %rax,%rbx
+  8035d3:	4c 89 f8             	mov    %r15,%rax
+  8035d6:	4d 89 ef             	mov    %r13,%r15
+  8035d9:	4c 01 e8             	add    %r13,%rax
+  8035dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035e0:	49 bd 95 12 80 00 00 	movabs $0x801295,%r13
+  8035e7:	00 00 00 
+            sys_yield();
+  8035ea:	49 be 32 12 80 00 00 	movabs $0x801232,%r14
+  8035f1:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8035f4:	8b 73 04             	mov    0x4(%rbx),%esi
+  8035f7:	48 63 ce             	movslq %esi,%rcx
+  8035fa:	48 63 03             	movslq (%rbx),%rax
+  8035fd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803603:	48 39 c1             	cmp    %rax,%rcx
+  803606:	72 2e                	jb     803636 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803608:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80360d:	48 89 da             	mov    %rbx,%rdx
+  803610:	be 00 10 00 00       	mov    $0x1000,%esi
+  803615:	4c 89 e7             	mov    %r12,%rdi
+  803618:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80361b:	85 c0                	test   %eax,%eax
+  80361d:	74 66                	je     803685 <devpipe_write+0xe8>
+            sys_yield();
+  80361f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803622:	8b 73 04             	mov    0x4(%rbx),%esi
+  803625:	48 63 ce             	movslq %esi,%rcx
+  803628:	48 63 03             	movslq (%rbx),%rax
+  80362b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803631:	48 39 c1             	cmp    %rax,%rcx
+  803634:	73 d2                	jae    803608 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803636:	41 0f b6 3f          	movzbl (%r15),%edi
+  80363a:	48 89 ca             	mov    %rcx,%rdx
+  80363d:	48 c1 ea 03          	shr    $0x3,%rdx
+  803641:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803648:	08 10 20 
+  80364b:	48 f7 e2             	mul    %rdx
+  80364e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803652:	48 89 d0             	mov    %rdx,%rax
+  803655:	48 c1 e0 09          	shl    $0x9,%rax
+  803659:	48 29 d0             	sub    %rdx,%rax
+  80365c:	48 c1 e0 03          	shl    $0x3,%rax
+  803660:	48 29 c1             	sub    %rax,%rcx
+  803663:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803668:	83 c6 01             	add    $0x1,%esi
+  80366b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80366e:	49 83 c7 01          	add    $0x1,%r15
+  803672:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803676:	49 39 c7             	cmp    %rax,%r15
+  803679:	0f 85 75 ff ff ff    	jne    8035f4 <devpipe_write+0x57>
+    return n;
+  80367f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803683:	eb 05                	jmp    80368a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803685:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80368a:	48 83 c4 18          	add    $0x18,%rsp
+  80368e:	5b                   	pop    %rbx
+  80368f:	41 5c                	pop    %r12
+  803691:	41 5d                	pop    %r13
+  803693:	41 5e                	pop    %r14
+  803695:	41 5f                	pop    %r15
+  803697:	5d                   	pop    %rbp
+  803698:	c3                   	ret
+
+0000000000803699 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803699:	55                   	push   %rbp
+  80369a:	48 89 e5             	mov    %rsp,%rbp
+  80369d:	41 57                	push   %r15
+  80369f:	41 56                	push   %r14
+  8036a1:	41 55                	push   %r13
+  8036a3:	41 54                	push   %r12
+  8036a5:	53                   	push   %rbx
+  8036a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8036aa:	49 89 fc             	mov    %rdi,%r12
+  8036ad:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8036b1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036b5:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  8036bc:	00 00 00 
+  8036bf:	ff d0                	call   *%rax
+  8036c1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036c4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036ca:	49 bd 95 12 80 00 00 	movabs $0x801295,%r13
+  8036d1:	00 00 00 
+            sys_yield();
+  8036d4:	49 be 32 12 80 00 00 	movabs $0x801232,%r14
+  8036db:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8036de:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8036e3:	74 7d                	je     803762 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036e5:	8b 03                	mov    (%rbx),%eax
+  8036e7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036ea:	75 26                	jne    803712 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8036ec:	4d 85 ff             	test   %r15,%r15
+  8036ef:	75 77                	jne    803768 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036f1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036f6:	48 89 da             	mov    %rbx,%rdx
+  8036f9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036fe:	4c 89 e7             	mov    %r12,%rdi
+  803701:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803704:	85 c0                	test   %eax,%eax
+  803706:	74 72                	je     80377a <devpipe_read+0xe1>
+            sys_yield();
+  803708:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80370b:	8b 03                	mov    (%rbx),%eax
+  80370d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803710:	74 df                	je     8036f1 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803712:	48 63 c8             	movslq %eax,%rcx
+  803715:	48 89 ca             	mov    %rcx,%rdx
+  803718:	48 c1 ea 03          	shr    $0x3,%rdx
+  80371c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803723:	08 10 20 
+  803726:	48 89 d0             	mov    %rdx,%rax
+  803729:	48 f7 e6             	mul    %rsi
+  80372c:	48 c1 ea 06          	shr    $0x6,%rdx
+  803730:	48 89 d0             	mov    %rdx,%rax
+  803733:	48 c1 e0 09          	shl    $0x9,%rax
+  803737:	48 29 d0             	sub    %rdx,%rax
+  80373a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803741:	00 
+  803742:	48 89 c8             	mov    %rcx,%rax
+  803745:	48 29 d0             	sub    %rdx,%rax
+  803748:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80374d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803751:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803755:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803758:	49 83 c7 01          	add    $0x1,%r15
+  80375c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803760:	75 83                	jne    8036e5 <devpipe_read+0x4c>
+    return n;
+  803762:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803766:	eb 03                	jmp    80376b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803768:	4c 89 f8             	mov    %r15,%rax
+}
+  80376b:	48 83 c4 18          	add    $0x18,%rsp
+  80376f:	5b                   	pop    %rbx
+  803770:	41 5c                	pop    %r12
+  803772:	41 5d                	pop    %r13
+  803774:	41 5e                	pop    %r14
+  803776:	41 5f                	pop    %r15
+  803778:	5d                   	pop    %rbp
+  803779:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80377a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377f:	eb ea                	jmp    80376b <devpipe_read+0xd2>
+
+0000000000803781 <pipe>:
+pipe(int pfd[2]) {
+  803781:	55                   	push   %rbp
+  803782:	48 89 e5             	mov    %rsp,%rbp
+  803785:	41 55                	push   %r13
+  803787:	41 54                	push   %r12
+  803789:	53                   	push   %rbx
+  80378a:	48 83 ec 18          	sub    $0x18,%rsp
+  80378e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803791:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803795:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  80379c:	00 00 00 
+  80379f:	ff d0                	call   *%rax
+  8037a1:	89 c3                	mov    %eax,%ebx
+  8037a3:	85 c0                	test   %eax,%eax
+  8037a5:	0f 88 a0 01 00 00    	js     80394b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8037ab:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037b5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8037b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037be:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  8037c5:	00 00 00 
+  8037c8:	ff d0                	call   *%rax
+  8037ca:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8037cc:	85 c0                	test   %eax,%eax
+  8037ce:	0f 88 77 01 00 00    	js     80394b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037d4:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8037d8:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  8037df:	00 00 00 
+  8037e2:	ff d0                	call   *%rax
+  8037e4:	89 c3                	mov    %eax,%ebx
+  8037e6:	85 c0                	test   %eax,%eax
+  8037e8:	0f 88 43 01 00 00    	js     803931 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8037ee:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037f8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8037fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803801:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  803808:	00 00 00 
+  80380b:	ff d0                	call   *%rax
+  80380d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80380f:	85 c0                	test   %eax,%eax
+  803811:	0f 88 1a 01 00 00    	js     803931 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803817:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80381b:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  803822:	00 00 00 
+  803825:	ff d0                	call   *%rax
+  803827:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80382a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80382f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803834:	48 89 c6             	mov    %rax,%rsi
+  803837:	bf 00 00 00 00       	mov    $0x0,%edi
+  80383c:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  803843:	00 00 00 
+  803846:	ff d0                	call   *%rax
+  803848:	89 c3                	mov    %eax,%ebx
+  80384a:	85 c0                	test   %eax,%eax
+  80384c:	0f 88 c5 00 00 00    	js     803917 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803852:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803856:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  80385d:	00 00 00 
+  803860:	ff d0                	call   *%rax
+  803862:	48 89 c1             	mov    %rax,%rcx
+  803865:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80386b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803871:	ba 00 00 00 00       	mov    $0x0,%edx
+  803876:	4c 89 ee             	mov    %r13,%rsi
+  803879:	bf 00 00 00 00       	mov    $0x0,%edi
+  80387e:	48 b8 28 13 80 00 00 	movabs $0x801328,%rax
+  803885:	00 00 00 
+  803888:	ff d0                	call   *%rax
+  80388a:	89 c3                	mov    %eax,%ebx
+  80388c:	85 c0                	test   %eax,%eax
+  80388e:	78 6e                	js     8038fe <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803890:	be 00 10 00 00       	mov    $0x1000,%esi
+  803895:	4c 89 ef             	mov    %r13,%rdi
+  803898:	48 b8 63 12 80 00 00 	movabs $0x801263,%rax
+  80389f:	00 00 00 
+  8038a2:	ff d0                	call   *%rax
+  8038a4:	83 f8 02             	cmp    $0x2,%eax
+  8038a7:	0f 85 ab 00 00 00    	jne    803958 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8038ad:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8038b4:	00 00 
+  8038b6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038ba:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8038bc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038c0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8038c7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8038cb:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8038cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038d1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8038d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8038dc:	48 bb d7 1c 80 00 00 	movabs $0x801cd7,%rbx
+  8038e3:	00 00 00 
+  8038e6:	ff d3                	call   *%rbx
+  8038e8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8038ec:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8038f0:	ff d3                	call   *%rbx
+  8038f2:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8038f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038fc:	eb 4d                	jmp    80394b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8038fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803903:	4c 89 ee             	mov    %r13,%rsi
+  803906:	bf 00 00 00 00       	mov    $0x0,%edi
+  80390b:	48 b8 a0 14 80 00 00 	movabs $0x8014a0,%rax
+  803912:	00 00 00 
+  803915:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803917:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80391c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803920:	bf 00 00 00 00       	mov    $0x0,%edi
+  803925:	48 b8 a0 14 80 00 00 	movabs $0x8014a0,%rax
+  80392c:	00 00 00 
+  80392f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803931:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803936:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80393a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80393f:	48 b8 a0 14 80 00 00 	movabs $0x8014a0,%rax
+  803946:	00 00 00 
+  803949:	ff d0                	call   *%rax
+}
+  80394b:	89 d8                	mov    %ebx,%eax
+  80394d:	48 83 c4 18          	add    $0x18,%rsp
+  803951:	5b                   	pop    %rbx
+  803952:	41 5c                	pop    %r12
+  803954:	41 5d                	pop    %r13
+  803956:	5d                   	pop    %rbp
+  803957:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803958:	48 b9 d0 56 80 00 00 	movabs $0x8056d0,%rcx
+  80395f:	00 00 00 
+  803962:	48 ba a7 56 80 00 00 	movabs $0x8056a7,%rdx
+  803969:	00 00 00 
+  80396c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803971:	48 bf bc 56 80 00 00 	movabs $0x8056bc,%rdi
+  803978:	00 00 00 
+  80397b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803980:	49 b8 60 3f 80 00 00 	movabs $0x803f60,%r8
+  803987:	00 00 00 
+  80398a:	41 ff d0             	call   *%r8
+
+000000000080398d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80398d:	55                   	push   %rbp
+  80398e:	48 89 e5             	mov    %rsp,%rbp
+  803991:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803995:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803999:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  8039a0:	00 00 00 
+  8039a3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039a5:	85 c0                	test   %eax,%eax
+  8039a7:	78 35                	js     8039de <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8039a9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039ad:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  8039b4:	00 00 00 
+  8039b7:	ff d0                	call   *%rax
+  8039b9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039bc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039c1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039c6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039ca:	48 b8 95 12 80 00 00 	movabs $0x801295,%rax
+  8039d1:	00 00 00 
+  8039d4:	ff d0                	call   *%rax
+  8039d6:	85 c0                	test   %eax,%eax
+  8039d8:	0f 94 c0             	sete   %al
+  8039db:	0f b6 c0             	movzbl %al,%eax
+}
+  8039de:	c9                   	leave
+  8039df:	c3                   	ret
+
+00000000008039e0 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8039e0:	48 89 f8             	mov    %rdi,%rax
+  8039e3:	48 c1 e8 27          	shr    $0x27,%rax
+  8039e7:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8039ee:	7f 00 00 
+  8039f1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039f5:	f6 c2 01             	test   $0x1,%dl
+  8039f8:	74 6d                	je     803a67 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8039fa:	48 89 f8             	mov    %rdi,%rax
+  8039fd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803a01:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a08:	7f 00 00 
+  803a0b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a0f:	f6 c2 01             	test   $0x1,%dl
+  803a12:	74 62                	je     803a76 <get_uvpt_entry+0x96>
+  803a14:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a1b:	7f 00 00 
+  803a1e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a22:	f6 c2 80             	test   $0x80,%dl
+  803a25:	75 4f                	jne    803a76 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a27:	48 89 f8             	mov    %rdi,%rax
+  803a2a:	48 c1 e8 15          	shr    $0x15,%rax
+  803a2e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a35:	7f 00 00 
+  803a38:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a3c:	f6 c2 01             	test   $0x1,%dl
+  803a3f:	74 44                	je     803a85 <get_uvpt_entry+0xa5>
+  803a41:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a48:	7f 00 00 
+  803a4b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a4f:	f6 c2 80             	test   $0x80,%dl
+  803a52:	75 31                	jne    803a85 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803a54:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803a58:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a5f:	7f 00 00 
+  803a62:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803a66:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a67:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803a6e:	7f 00 00 
+  803a71:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a75:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a76:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a7d:	7f 00 00 
+  803a80:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a84:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a85:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a8c:	7f 00 00 
+  803a8f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a93:	c3                   	ret
+
+0000000000803a94 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803a94:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a97:	48 89 f9             	mov    %rdi,%rcx
+  803a9a:	48 c1 e9 27          	shr    $0x27,%rcx
+  803a9e:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803aa5:	7f 00 00 
+  803aa8:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803aac:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ab3:	f6 c1 01             	test   $0x1,%cl
+  803ab6:	0f 84 b2 00 00 00    	je     803b6e <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803abc:	48 89 f9             	mov    %rdi,%rcx
+  803abf:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803ac3:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803aca:	7f 00 00 
+  803acd:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ad1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ad8:	40 f6 c6 01          	test   $0x1,%sil
+  803adc:	0f 84 8c 00 00 00    	je     803b6e <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803ae2:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ae9:	7f 00 00 
+  803aec:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803af0:	a8 80                	test   $0x80,%al
+  803af2:	75 7b                	jne    803b6f <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803af4:	48 89 f9             	mov    %rdi,%rcx
+  803af7:	48 c1 e9 15          	shr    $0x15,%rcx
+  803afb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b02:	7f 00 00 
+  803b05:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b09:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803b10:	40 f6 c6 01          	test   $0x1,%sil
+  803b14:	74 58                	je     803b6e <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803b16:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b1d:	7f 00 00 
+  803b20:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b24:	a8 80                	test   $0x80,%al
+  803b26:	75 6c                	jne    803b94 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b28:	48 89 f9             	mov    %rdi,%rcx
+  803b2b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803b2f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b36:	7f 00 00 
+  803b39:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b3d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b44:	40 f6 c6 01          	test   $0x1,%sil
+  803b48:	74 24                	je     803b6e <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803b4a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b51:	7f 00 00 
+  803b54:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b58:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b5f:	ff ff 7f 
+  803b62:	48 21 c8             	and    %rcx,%rax
+  803b65:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803b6b:	48 09 d0             	or     %rdx,%rax
+}
+  803b6e:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803b6f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b76:	7f 00 00 
+  803b79:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b7d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b84:	ff ff 7f 
+  803b87:	48 21 c8             	and    %rcx,%rax
+  803b8a:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803b90:	48 01 d0             	add    %rdx,%rax
+  803b93:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803b94:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b9b:	7f 00 00 
+  803b9e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ba2:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ba9:	ff ff 7f 
+  803bac:	48 21 c8             	and    %rcx,%rax
+  803baf:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803bb5:	48 01 d0             	add    %rdx,%rax
+  803bb8:	c3                   	ret
+
+0000000000803bb9 <get_prot>:
+
+int
+get_prot(void *va) {
+  803bb9:	55                   	push   %rbp
+  803bba:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803bbd:	48 b8 e0 39 80 00 00 	movabs $0x8039e0,%rax
+  803bc4:	00 00 00 
+  803bc7:	ff d0                	call   *%rax
+  803bc9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803bcc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803bd1:	89 c1                	mov    %eax,%ecx
+  803bd3:	83 c9 04             	or     $0x4,%ecx
+  803bd6:	f6 c2 01             	test   $0x1,%dl
+  803bd9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803bdc:	89 c1                	mov    %eax,%ecx
+  803bde:	83 c9 02             	or     $0x2,%ecx
+  803be1:	f6 c2 02             	test   $0x2,%dl
+  803be4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803be7:	89 c1                	mov    %eax,%ecx
+  803be9:	83 c9 01             	or     $0x1,%ecx
+  803bec:	48 85 d2             	test   %rdx,%rdx
+  803bef:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803bf2:	89 c1                	mov    %eax,%ecx
+  803bf4:	83 c9 40             	or     $0x40,%ecx
+  803bf7:	f6 c6 04             	test   $0x4,%dh
+  803bfa:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803bfd:	5d                   	pop    %rbp
+  803bfe:	c3                   	ret
+
+0000000000803bff <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803bff:	55                   	push   %rbp
+  803c00:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c03:	48 b8 e0 39 80 00 00 	movabs $0x8039e0,%rax
+  803c0a:	00 00 00 
+  803c0d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803c0f:	48 c1 e8 06          	shr    $0x6,%rax
+  803c13:	83 e0 01             	and    $0x1,%eax
+}
+  803c16:	5d                   	pop    %rbp
+  803c17:	c3                   	ret
+
+0000000000803c18 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803c18:	55                   	push   %rbp
+  803c19:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803c1c:	48 b8 e0 39 80 00 00 	movabs $0x8039e0,%rax
+  803c23:	00 00 00 
+  803c26:	ff d0                	call   *%rax
+  803c28:	83 e0 01             	and    $0x1,%eax
+}
+  803c2b:	5d                   	pop    %rbp
+  803c2c:	c3                   	ret
+
+0000000000803c2d <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803c2d:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803c34:	7f 00 00 
+  803c37:	a8 01                	test   $0x1,%al
+  803c39:	75 06                	jne    803c41 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c40:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803c41:	55                   	push   %rbp
+  803c42:	48 89 e5             	mov    %rsp,%rbp
+  803c45:	41 57                	push   %r15
+  803c47:	41 56                	push   %r14
+  803c49:	41 55                	push   %r13
+  803c4b:	41 54                	push   %r12
+  803c4d:	53                   	push   %rbx
+  803c4e:	48 83 ec 18          	sub    $0x18,%rsp
+  803c52:	49 89 fe             	mov    %rdi,%r14
+  803c55:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803c58:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803c5f:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c60:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803c67:	7f 00 00 
+  803c6a:	e9 81 00 00 00       	jmp    803cf0 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803c6f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803c76:	49 39 dd             	cmp    %rbx,%r13
+  803c79:	74 2b                	je     803ca6 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c7b:	48 89 d8             	mov    %rbx,%rax
+  803c7e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c82:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803c86:	f6 c2 01             	test   $0x1,%dl
+  803c89:	74 e4                	je     803c6f <foreach_shared_region+0x42>
+  803c8b:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803c8f:	f6 c4 04             	test   $0x4,%ah
+  803c92:	74 db                	je     803c6f <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803c94:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803c9b:	4c 89 fa             	mov    %r15,%rdx
+  803c9e:	48 89 df             	mov    %rbx,%rdi
+  803ca1:	41 ff d6             	call   *%r14
+  803ca4:	eb c9                	jmp    803c6f <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803ca6:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803cad:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803cb1:	74 22                	je     803cd5 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803cb3:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803cba:	48 89 d8             	mov    %rbx,%rax
+  803cbd:	48 c1 e8 15          	shr    $0x15,%rax
+  803cc1:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803cc8:	7f 00 00 
+  803ccb:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803ccf:	a8 01                	test   $0x1,%al
+  803cd1:	74 d3                	je     803ca6 <foreach_shared_region+0x79>
+  803cd3:	eb a6                	jmp    803c7b <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803cd5:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803cdc:	40 
+  803cdd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803ce1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ce8:	00 00 00 
+  803ceb:	48 39 c1             	cmp    %rax,%rcx
+  803cee:	74 31                	je     803d21 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803cf0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cf4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803cf8:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803cff:	7f 00 00 
+  803d02:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803d06:	a8 01                	test   $0x1,%al
+  803d08:	74 cb                	je     803cd5 <foreach_shared_region+0xa8>
+  803d0a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d0e:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803d15:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803d1b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803d1f:	eb 92                	jmp    803cb3 <foreach_shared_region+0x86>
+}
+  803d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d26:	48 83 c4 18          	add    $0x18,%rsp
+  803d2a:	5b                   	pop    %rbx
+  803d2b:	41 5c                	pop    %r12
+  803d2d:	41 5d                	pop    %r13
+  803d2f:	41 5e                	pop    %r14
+  803d31:	41 5f                	pop    %r15
+  803d33:	5d                   	pop    %rbp
+  803d34:	c3                   	ret
+
+0000000000803d35 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3a:	c3                   	ret
+
+0000000000803d3b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803d3b:	55                   	push   %rbp
+  803d3c:	48 89 e5             	mov    %rsp,%rbp
+  803d3f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803d42:	48 be f4 56 80 00 00 	movabs $0x8056f4,%rsi
+  803d49:	00 00 00 
+  803d4c:	48 b8 61 0b 80 00 00 	movabs $0x800b61,%rax
+  803d53:	00 00 00 
+  803d56:	ff d0                	call   *%rax
+    return 0;
+}
+  803d58:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d5d:	5d                   	pop    %rbp
+  803d5e:	c3                   	ret
+
+0000000000803d5f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d5f:	55                   	push   %rbp
+  803d60:	48 89 e5             	mov    %rsp,%rbp
+  803d63:	41 57                	push   %r15
+  803d65:	41 56                	push   %r14
+  803d67:	41 55                	push   %r13
+  803d69:	41 54                	push   %r12
+  803d6b:	53                   	push   %rbx
+  803d6c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803d73:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803d7a:	48 85 d2             	test   %rdx,%rdx
+  803d7d:	74 7a                	je     803df9 <devcons_write+0x9a>
+  803d7f:	49 89 d6             	mov    %rdx,%r14
+  803d82:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803d88:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803d8d:	49 bf ef 0e 80 00 00 	movabs $0x800eef,%r15
+  803d94:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803d97:	4c 89 f3             	mov    %r14,%rbx
+  803d9a:	48 29 f3             	sub    %rsi,%rbx
+  803d9d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803da2:	48 39 c3             	cmp    %rax,%rbx
+  803da5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803da9:	4c 63 eb             	movslq %ebx,%r13
+  803dac:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803db3:	48 01 c6             	add    %rax,%rsi
+  803db6:	4c 89 ea             	mov    %r13,%rdx
+  803db9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803dc0:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803dc3:	4c 89 ee             	mov    %r13,%rsi
+  803dc6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803dcd:	48 b8 38 11 80 00 00 	movabs $0x801138,%rax
+  803dd4:	00 00 00 
+  803dd7:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803dd9:	41 01 dc             	add    %ebx,%r12d
+  803ddc:	49 63 f4             	movslq %r12d,%rsi
+  803ddf:	4c 39 f6             	cmp    %r14,%rsi
+  803de2:	72 b3                	jb     803d97 <devcons_write+0x38>
+    return res;
+  803de4:	49 63 c4             	movslq %r12d,%rax
+}
+  803de7:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803dee:	5b                   	pop    %rbx
+  803def:	41 5c                	pop    %r12
+  803df1:	41 5d                	pop    %r13
+  803df3:	41 5e                	pop    %r14
+  803df5:	41 5f                	pop    %r15
+  803df7:	5d                   	pop    %rbp
+  803df8:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803df9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803dff:	eb e3                	jmp    803de4 <devcons_write+0x85>
+
+0000000000803e01 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e01:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803e04:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e09:	48 85 c0             	test   %rax,%rax
+  803e0c:	74 55                	je     803e63 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e0e:	55                   	push   %rbp
+  803e0f:	48 89 e5             	mov    %rsp,%rbp
+  803e12:	41 55                	push   %r13
+  803e14:	41 54                	push   %r12
+  803e16:	53                   	push   %rbx
+  803e17:	48 83 ec 08          	sub    $0x8,%rsp
+  803e1b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803e1e:	48 bb 65 11 80 00 00 	movabs $0x801165,%rbx
+  803e25:	00 00 00 
+  803e28:	49 bc 32 12 80 00 00 	movabs $0x801232,%r12
+  803e2f:	00 00 00 
+  803e32:	eb 03                	jmp    803e37 <devcons_read+0x36>
+  803e34:	41 ff d4             	call   *%r12
+  803e37:	ff d3                	call   *%rbx
+  803e39:	85 c0                	test   %eax,%eax
+  803e3b:	74 f7                	je     803e34 <devcons_read+0x33>
+    if (c < 0) return c;
+  803e3d:	48 63 d0             	movslq %eax,%rdx
+  803e40:	78 13                	js     803e55 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803e42:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e47:	83 f8 04             	cmp    $0x4,%eax
+  803e4a:	74 09                	je     803e55 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803e4c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803e50:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803e55:	48 89 d0             	mov    %rdx,%rax
+  803e58:	48 83 c4 08          	add    $0x8,%rsp
+  803e5c:	5b                   	pop    %rbx
+  803e5d:	41 5c                	pop    %r12
+  803e5f:	41 5d                	pop    %r13
+  803e61:	5d                   	pop    %rbp
+  803e62:	c3                   	ret
+  803e63:	48 89 d0             	mov    %rdx,%rax
+  803e66:	c3                   	ret
+
+0000000000803e67 <cputchar>:
+cputchar(int ch) {
+  803e67:	55                   	push   %rbp
+  803e68:	48 89 e5             	mov    %rsp,%rbp
+  803e6b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803e6f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803e73:	be 01 00 00 00       	mov    $0x1,%esi
+  803e78:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803e7c:	48 b8 38 11 80 00 00 	movabs $0x801138,%rax
+  803e83:	00 00 00 
+  803e86:	ff d0                	call   *%rax
+}
+  803e88:	c9                   	leave
+  803e89:	c3                   	ret
+
+0000000000803e8a <getchar>:
+getchar(void) {
+  803e8a:	55                   	push   %rbp
+  803e8b:	48 89 e5             	mov    %rsp,%rbp
+  803e8e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803e92:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e97:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803e9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ea0:	48 b8 48 20 80 00 00 	movabs $0x802048,%rax
+  803ea7:	00 00 00 
+  803eaa:	ff d0                	call   *%rax
+  803eac:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803eae:	85 c0                	test   %eax,%eax
+  803eb0:	78 06                	js     803eb8 <getchar+0x2e>
+  803eb2:	74 08                	je     803ebc <getchar+0x32>
+  803eb4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803eb8:	89 d0                	mov    %edx,%eax
+  803eba:	c9                   	leave
+  803ebb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803ebc:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803ec1:	eb f5                	jmp    803eb8 <getchar+0x2e>
+
+0000000000803ec3 <iscons>:
+iscons(int fdnum) {
+  803ec3:	55                   	push   %rbp
+  803ec4:	48 89 e5             	mov    %rsp,%rbp
+  803ec7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ecb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803ecf:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  803ed6:	00 00 00 
+  803ed9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803edb:	85 c0                	test   %eax,%eax
+  803edd:	78 18                	js     803ef7 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803edf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ee3:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803eea:	00 00 00 
+  803eed:	8b 00                	mov    (%rax),%eax
+  803eef:	39 02                	cmp    %eax,(%rdx)
+  803ef1:	0f 94 c0             	sete   %al
+  803ef4:	0f b6 c0             	movzbl %al,%eax
+}
+  803ef7:	c9                   	leave
+  803ef8:	c3                   	ret
+
+0000000000803ef9 <opencons>:
+opencons(void) {
+  803ef9:	55                   	push   %rbp
+  803efa:	48 89 e5             	mov    %rsp,%rbp
+  803efd:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f01:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803f05:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  803f0c:	00 00 00 
+  803f0f:	ff d0                	call   *%rax
+  803f11:	85 c0                	test   %eax,%eax
+  803f13:	78 49                	js     803f5e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803f15:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f1a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f1f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803f23:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f28:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  803f2f:	00 00 00 
+  803f32:	ff d0                	call   *%rax
+  803f34:	85 c0                	test   %eax,%eax
+  803f36:	78 26                	js     803f5e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803f38:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f3c:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803f43:	00 00 
+  803f45:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803f47:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f4b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803f52:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  803f59:	00 00 00 
+  803f5c:	ff d0                	call   *%rax
+}
+  803f5e:	c9                   	leave
+  803f5f:	c3                   	ret
+
+0000000000803f60 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803f60:	55                   	push   %rbp
+  803f61:	48 89 e5             	mov    %rsp,%rbp
+  803f64:	41 56                	push   %r14
+  803f66:	41 55                	push   %r13
+  803f68:	41 54                	push   %r12
+  803f6a:	53                   	push   %rbx
+  803f6b:	48 83 ec 50          	sub    $0x50,%rsp
+  803f6f:	49 89 fc             	mov    %rdi,%r12
+  803f72:	41 89 f5             	mov    %esi,%r13d
+  803f75:	48 89 d3             	mov    %rdx,%rbx
+  803f78:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f7c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803f80:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803f84:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803f8b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f8f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803f93:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803f97:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803f9b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803fa2:	00 00 00 
+  803fa5:	4c 8b 30             	mov    (%rax),%r14
+  803fa8:	48 b8 01 12 80 00 00 	movabs $0x801201,%rax
+  803faf:	00 00 00 
+  803fb2:	ff d0                	call   *%rax
+  803fb4:	89 c6                	mov    %eax,%esi
+  803fb6:	45 89 e8             	mov    %r13d,%r8d
+  803fb9:	4c 89 e1             	mov    %r12,%rcx
+  803fbc:	4c 89 f2             	mov    %r14,%rdx
+  803fbf:	48 bf 00 57 80 00 00 	movabs $0x805700,%rdi
+  803fc6:	00 00 00 
+  803fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fce:	49 bc e9 01 80 00 00 	movabs $0x8001e9,%r12
+  803fd5:	00 00 00 
+  803fd8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803fdb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803fdf:	48 89 df             	mov    %rbx,%rdi
+  803fe2:	48 b8 85 01 80 00 00 	movabs $0x800185,%rax
+  803fe9:	00 00 00 
+  803fec:	ff d0                	call   *%rax
+    cprintf("\n");
+  803fee:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  803ff5:	00 00 00 
+  803ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ffd:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804000:	cc                   	int3
+  804001:	eb fd                	jmp    804000 <_panic+0xa0>
+
+0000000000804003 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804003:	55                   	push   %rbp
+  804004:	48 89 e5             	mov    %rsp,%rbp
+  804007:	41 55                	push   %r13
+  804009:	41 54                	push   %r12
+  80400b:	53                   	push   %rbx
+  80400c:	48 83 ec 08          	sub    $0x8,%rsp
+  804010:	49 89 fc             	mov    %rdi,%r12
+  804013:	48 89 f7             	mov    %rsi,%rdi
+  804016:	48 89 d3             	mov    %rdx,%rbx
+  804019:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80401c:	48 85 f6             	test   %rsi,%rsi
+  80401f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804026:	00 00 00 
+  804029:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80402d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804032:	48 85 d2             	test   %rdx,%rdx
+  804035:	74 03                	je     80403a <ipc_recv+0x37>
+  804037:	48 8b 32             	mov    (%rdx),%rsi
+  80403a:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  804041:	00 00 00 
+  804044:	ff d0                	call   *%rax
+    if (errno) {
+  804046:	85 c0                	test   %eax,%eax
+  804048:	74 1c                	je     804066 <ipc_recv+0x63>
+        if (from_env_store)
+  80404a:	4d 85 e4             	test   %r12,%r12
+  80404d:	74 08                	je     804057 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80404f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804056:	00 
+
+        if (perm_store)
+  804057:	4d 85 ed             	test   %r13,%r13
+  80405a:	74 74                	je     8040d0 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80405c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804063:	00 
+  804064:	eb 6a                	jmp    8040d0 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804066:	4d 85 e4             	test   %r12,%r12
+  804069:	74 14                	je     80407f <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80406b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804072:	00 00 00 
+  804075:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80407b:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80407f:	48 85 db             	test   %rbx,%rbx
+  804082:	74 23                	je     8040a7 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804084:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80408b:	00 00 00 
+  80408e:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804094:	ba 00 00 00 00       	mov    $0x0,%edx
+  804099:	85 c9                	test   %ecx,%ecx
+  80409b:	74 07                	je     8040a4 <ipc_recv+0xa1>
+  80409d:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8040a4:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8040a7:	4d 85 ed             	test   %r13,%r13
+  8040aa:	74 14                	je     8040c0 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8040ac:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040b3:	00 00 00 
+  8040b6:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8040bc:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8040c0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040c7:	00 00 00 
+  8040ca:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040d0:	48 83 c4 08          	add    $0x8,%rsp
+  8040d4:	5b                   	pop    %rbx
+  8040d5:	41 5c                	pop    %r12
+  8040d7:	41 5d                	pop    %r13
+  8040d9:	5d                   	pop    %rbp
+  8040da:	c3                   	ret
+
+00000000008040db <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040db:	55                   	push   %rbp
+  8040dc:	48 89 e5             	mov    %rsp,%rbp
+  8040df:	41 55                	push   %r13
+  8040e1:	41 54                	push   %r12
+  8040e3:	53                   	push   %rbx
+  8040e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8040e8:	49 89 fc             	mov    %rdi,%r12
+  8040eb:	48 89 f7             	mov    %rsi,%rdi
+  8040ee:	48 89 d3             	mov    %rdx,%rbx
+  8040f1:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040f4:	48 85 f6             	test   %rsi,%rsi
+  8040f7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040fe:	00 00 00 
+  804101:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804105:	be 00 10 00 00       	mov    $0x1000,%esi
+  80410a:	48 85 d2             	test   %rdx,%rdx
+  80410d:	74 03                	je     804112 <ipc_try_recv+0x37>
+  80410f:	48 8b 32             	mov    (%rdx),%rsi
+  804112:	48 b8 d7 16 80 00 00 	movabs $0x8016d7,%rax
+  804119:	00 00 00 
+  80411c:	ff d0                	call   *%rax
+    if (errno) {
+  80411e:	85 c0                	test   %eax,%eax
+  804120:	75 75                	jne    804197 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804122:	4d 85 e4             	test   %r12,%r12
+  804125:	74 14                	je     80413b <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804127:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80412e:	00 00 00 
+  804131:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804137:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80413b:	48 85 db             	test   %rbx,%rbx
+  80413e:	74 23                	je     804163 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804140:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804147:	00 00 00 
+  80414a:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804150:	ba 00 00 00 00       	mov    $0x0,%edx
+  804155:	85 c9                	test   %ecx,%ecx
+  804157:	74 07                	je     804160 <ipc_try_recv+0x85>
+  804159:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804160:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804163:	4d 85 ed             	test   %r13,%r13
+  804166:	74 14                	je     80417c <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804168:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80416f:	00 00 00 
+  804172:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804178:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80417c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804183:	00 00 00 
+  804186:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80418c:	48 83 c4 08          	add    $0x8,%rsp
+  804190:	5b                   	pop    %rbx
+  804191:	41 5c                	pop    %r12
+  804193:	41 5d                	pop    %r13
+  804195:	5d                   	pop    %rbp
+  804196:	c3                   	ret
+        if (from_env_store)
+  804197:	4d 85 e4             	test   %r12,%r12
+  80419a:	74 08                	je     8041a4 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80419c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8041a3:	00 
+        if (perm_store)
+  8041a4:	4d 85 ed             	test   %r13,%r13
+  8041a7:	74 e3                	je     80418c <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8041a9:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8041b0:	00 
+  8041b1:	eb d9                	jmp    80418c <ipc_try_recv+0xb1>
+
+00000000008041b3 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8041b3:	55                   	push   %rbp
+  8041b4:	48 89 e5             	mov    %rsp,%rbp
+  8041b7:	41 57                	push   %r15
+  8041b9:	41 56                	push   %r14
+  8041bb:	41 55                	push   %r13
+  8041bd:	41 54                	push   %r12
+  8041bf:	53                   	push   %rbx
+  8041c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8041c4:	41 89 fd             	mov    %edi,%r13d
+  8041c7:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8041ca:	48 89 d3             	mov    %rdx,%rbx
+  8041cd:	49 89 cc             	mov    %rcx,%r12
+  8041d0:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041d4:	48 85 d2             	test   %rdx,%rdx
+  8041d7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041de:	00 00 00 
+  8041e1:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041e5:	49 be 42 16 80 00 00 	movabs $0x801642,%r14
+  8041ec:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041ef:	49 bf 32 12 80 00 00 	movabs $0x801232,%r15
+  8041f6:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041f9:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041fc:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804200:	4c 89 e1             	mov    %r12,%rcx
+  804203:	48 89 da             	mov    %rbx,%rdx
+  804206:	44 89 ef             	mov    %r13d,%edi
+  804209:	41 ff d6             	call   *%r14
+  80420c:	85 c0                	test   %eax,%eax
+  80420e:	74 37                	je     804247 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804210:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804213:	75 05                	jne    80421a <ipc_send+0x67>
+        sys_yield();
+  804215:	41 ff d7             	call   *%r15
+  804218:	eb df                	jmp    8041f9 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80421a:	89 c1                	mov    %eax,%ecx
+  80421c:	48 ba 23 57 80 00 00 	movabs $0x805723,%rdx
+  804223:	00 00 00 
+  804226:	be 65 00 00 00       	mov    $0x65,%esi
+  80422b:	48 bf 3e 57 80 00 00 	movabs $0x80573e,%rdi
+  804232:	00 00 00 
+  804235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423a:	49 b8 60 3f 80 00 00 	movabs $0x803f60,%r8
+  804241:	00 00 00 
+  804244:	41 ff d0             	call   *%r8
+    }
+}
+  804247:	48 83 c4 18          	add    $0x18,%rsp
+  80424b:	5b                   	pop    %rbx
+  80424c:	41 5c                	pop    %r12
+  80424e:	41 5d                	pop    %r13
+  804250:	41 5e                	pop    %r14
+  804252:	41 5f                	pop    %r15
+  804254:	5d                   	pop    %rbp
+  804255:	c3                   	ret
+
+0000000000804256 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804256:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80425b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804262:	00 00 00 
+  804265:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80426c:	48 01 ca             	add    %rcx,%rdx
+  80426f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804275:	39 fa                	cmp    %edi,%edx
+  804277:	74 12                	je     80428b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804279:	48 83 c0 01          	add    $0x1,%rax
+  80427d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804283:	75 e0                	jne    804265 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804285:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80428a:	c3                   	ret
+            return envs[i].env_id;
+  80428b:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804292:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804299:	00 00 00 
+  80429c:	48 01 d0             	add    %rdx,%rax
+  80429f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8042a5:	c3                   	ret
+
+00000000008042a6 <__text_end>:
+  8042a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ad:	00 00 00 
+  8042b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b7:	00 00 00 
+  8042ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c1:	00 00 00 
+  8042c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042cb:	00 00 00 
+  8042ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d5:	00 00 00 
+  8042d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042df:	00 00 00 
+  8042e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e9:	00 00 00 
+  8042ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f3:	00 00 00 
+  8042f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fd:	00 00 00 
+  804300:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804307:	00 00 00 
+  80430a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804311:	00 00 00 
+  804314:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431b:	00 00 00 
+  80431e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804325:	00 00 00 
+  804328:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432f:	00 00 00 
+  804332:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804339:	00 00 00 
+  80433c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804343:	00 00 00 
+  804346:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434d:	00 00 00 
+  804350:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804357:	00 00 00 
+  80435a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804361:	00 00 00 
+  804364:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436b:	00 00 00 
+  80436e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804375:	00 00 00 
+  804378:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437f:	00 00 00 
+  804382:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804389:	00 00 00 
+  80438c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804393:	00 00 00 
+  804396:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439d:	00 00 00 
+  8043a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a7:	00 00 00 
+  8043aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b1:	00 00 00 
+  8043b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bb:	00 00 00 
+  8043be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c5:	00 00 00 
+  8043c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cf:	00 00 00 
+  8043d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d9:	00 00 00 
+  8043dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e3:	00 00 00 
+  8043e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ed:	00 00 00 
+  8043f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f7:	00 00 00 
+  8043fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804401:	00 00 00 
+  804404:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440b:	00 00 00 
+  80440e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804415:	00 00 00 
+  804418:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441f:	00 00 00 
+  804422:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804429:	00 00 00 
+  80442c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804433:	00 00 00 
+  804436:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443d:	00 00 00 
+  804440:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804447:	00 00 00 
+  80444a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804451:	00 00 00 
+  804454:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445b:	00 00 00 
+  80445e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804465:	00 00 00 
+  804468:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446f:	00 00 00 
+  804472:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804479:	00 00 00 
+  80447c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804483:	00 00 00 
+  804486:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448d:	00 00 00 
+  804490:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804497:	00 00 00 
+  80449a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a1:	00 00 00 
+  8044a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ab:	00 00 00 
+  8044ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b5:	00 00 00 
+  8044b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bf:	00 00 00 
+  8044c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c9:	00 00 00 
+  8044cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d3:	00 00 00 
+  8044d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044dd:	00 00 00 
+  8044e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e7:	00 00 00 
+  8044ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f1:	00 00 00 
+  8044f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fb:	00 00 00 
+  8044fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804505:	00 00 00 
+  804508:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450f:	00 00 00 
+  804512:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804519:	00 00 00 
+  80451c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804523:	00 00 00 
+  804526:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452d:	00 00 00 
+  804530:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804537:	00 00 00 
+  80453a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804541:	00 00 00 
+  804544:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454b:	00 00 00 
+  80454e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804555:	00 00 00 
+  804558:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455f:	00 00 00 
+  804562:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804569:	00 00 00 
+  80456c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804573:	00 00 00 
+  804576:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457d:	00 00 00 
+  804580:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804587:	00 00 00 
+  80458a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804591:	00 00 00 
+  804594:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459b:	00 00 00 
+  80459e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a5:	00 00 00 
+  8045a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045af:	00 00 00 
+  8045b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b9:	00 00 00 
+  8045bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c3:	00 00 00 
+  8045c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cd:	00 00 00 
+  8045d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d7:	00 00 00 
+  8045da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e1:	00 00 00 
+  8045e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045eb:	00 00 00 
+  8045ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f5:	00 00 00 
+  8045f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ff:	00 00 00 
+  804602:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804609:	00 00 00 
+  80460c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804613:	00 00 00 
+  804616:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461d:	00 00 00 
+  804620:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804627:	00 00 00 
+  80462a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804631:	00 00 00 
+  804634:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463b:	00 00 00 
+  80463e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804645:	00 00 00 
+  804648:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464f:	00 00 00 
+  804652:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804659:	00 00 00 
+  80465c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804663:	00 00 00 
+  804666:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466d:	00 00 00 
+  804670:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804677:	00 00 00 
+  80467a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804681:	00 00 00 
+  804684:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468b:	00 00 00 
+  80468e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804695:	00 00 00 
+  804698:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469f:	00 00 00 
+  8046a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a9:	00 00 00 
+  8046ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b3:	00 00 00 
+  8046b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bd:	00 00 00 
+  8046c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c7:	00 00 00 
+  8046ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d1:	00 00 00 
+  8046d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046db:	00 00 00 
+  8046de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e5:	00 00 00 
+  8046e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ef:	00 00 00 
+  8046f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f9:	00 00 00 
+  8046fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804703:	00 00 00 
+  804706:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470d:	00 00 00 
+  804710:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804717:	00 00 00 
+  80471a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804721:	00 00 00 
+  804724:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472b:	00 00 00 
+  80472e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804735:	00 00 00 
+  804738:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473f:	00 00 00 
+  804742:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804749:	00 00 00 
+  80474c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804753:	00 00 00 
+  804756:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475d:	00 00 00 
+  804760:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804767:	00 00 00 
+  80476a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804771:	00 00 00 
+  804774:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477b:	00 00 00 
+  80477e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804785:	00 00 00 
+  804788:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478f:	00 00 00 
+  804792:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804799:	00 00 00 
+  80479c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a3:	00 00 00 
+  8047a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ad:	00 00 00 
+  8047b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b7:	00 00 00 
+  8047ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c1:	00 00 00 
+  8047c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cb:	00 00 00 
+  8047ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d5:	00 00 00 
+  8047d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047df:	00 00 00 
+  8047e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e9:	00 00 00 
+  8047ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f3:	00 00 00 
+  8047f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fd:	00 00 00 
+  804800:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804807:	00 00 00 
+  80480a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804811:	00 00 00 
+  804814:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481b:	00 00 00 
+  80481e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804825:	00 00 00 
+  804828:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482f:	00 00 00 
+  804832:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804839:	00 00 00 
+  80483c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804843:	00 00 00 
+  804846:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484d:	00 00 00 
+  804850:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804857:	00 00 00 
+  80485a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804861:	00 00 00 
+  804864:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486b:	00 00 00 
+  80486e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804875:	00 00 00 
+  804878:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487f:	00 00 00 
+  804882:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804889:	00 00 00 
+  80488c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804893:	00 00 00 
+  804896:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489d:	00 00 00 
+  8048a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a7:	00 00 00 
+  8048aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b1:	00 00 00 
+  8048b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bb:	00 00 00 
+  8048be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c5:	00 00 00 
+  8048c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cf:	00 00 00 
+  8048d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d9:	00 00 00 
+  8048dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e3:	00 00 00 
+  8048e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ed:	00 00 00 
+  8048f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f7:	00 00 00 
+  8048fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804901:	00 00 00 
+  804904:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490b:	00 00 00 
+  80490e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804915:	00 00 00 
+  804918:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491f:	00 00 00 
+  804922:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804929:	00 00 00 
+  80492c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804933:	00 00 00 
+  804936:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493d:	00 00 00 
+  804940:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804947:	00 00 00 
+  80494a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804951:	00 00 00 
+  804954:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495b:	00 00 00 
+  80495e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804965:	00 00 00 
+  804968:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496f:	00 00 00 
+  804972:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804979:	00 00 00 
+  80497c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804983:	00 00 00 
+  804986:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498d:	00 00 00 
+  804990:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804997:	00 00 00 
+  80499a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a1:	00 00 00 
+  8049a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ab:	00 00 00 
+  8049ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b5:	00 00 00 
+  8049b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bf:	00 00 00 
+  8049c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c9:	00 00 00 
+  8049cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d3:	00 00 00 
+  8049d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049dd:	00 00 00 
+  8049e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e7:	00 00 00 
+  8049ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f1:	00 00 00 
+  8049f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fb:	00 00 00 
+  8049fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a05:	00 00 00 
+  804a08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0f:	00 00 00 
+  804a12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a19:	00 00 00 
+  804a1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a23:	00 00 00 
+  804a26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2d:	00 00 00 
+  804a30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a37:	00 00 00 
+  804a3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a41:	00 00 00 
+  804a44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4b:	00 00 00 
+  804a4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a55:	00 00 00 
+  804a58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5f:	00 00 00 
+  804a62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a69:	00 00 00 
+  804a6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a73:	00 00 00 
+  804a76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7d:	00 00 00 
+  804a80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a87:	00 00 00 
+  804a8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a91:	00 00 00 
+  804a94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9b:	00 00 00 
+  804a9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa5:	00 00 00 
+  804aa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaf:	00 00 00 
+  804ab2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab9:	00 00 00 
+  804abc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac3:	00 00 00 
+  804ac6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acd:	00 00 00 
+  804ad0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad7:	00 00 00 
+  804ada:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae1:	00 00 00 
+  804ae4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aeb:	00 00 00 
+  804aee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af5:	00 00 00 
+  804af8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aff:	00 00 00 
+  804b02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b09:	00 00 00 
+  804b0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b13:	00 00 00 
+  804b16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1d:	00 00 00 
+  804b20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b27:	00 00 00 
+  804b2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b31:	00 00 00 
+  804b34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3b:	00 00 00 
+  804b3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b45:	00 00 00 
+  804b48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4f:	00 00 00 
+  804b52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b59:	00 00 00 
+  804b5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b63:	00 00 00 
+  804b66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6d:	00 00 00 
+  804b70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b77:	00 00 00 
+  804b7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b81:	00 00 00 
+  804b84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8b:	00 00 00 
+  804b8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b95:	00 00 00 
+  804b98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9f:	00 00 00 
+  804ba2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba9:	00 00 00 
+  804bac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb3:	00 00 00 
+  804bb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbd:	00 00 00 
+  804bc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc7:	00 00 00 
+  804bca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd1:	00 00 00 
+  804bd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdb:	00 00 00 
+  804bde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be5:	00 00 00 
+  804be8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bef:	00 00 00 
+  804bf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf9:	00 00 00 
+  804bfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c03:	00 00 00 
+  804c06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0d:	00 00 00 
+  804c10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c17:	00 00 00 
+  804c1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c21:	00 00 00 
+  804c24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2b:	00 00 00 
+  804c2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c35:	00 00 00 
+  804c38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3f:	00 00 00 
+  804c42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c49:	00 00 00 
+  804c4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c53:	00 00 00 
+  804c56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5d:	00 00 00 
+  804c60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c67:	00 00 00 
+  804c6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c71:	00 00 00 
+  804c74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7b:	00 00 00 
+  804c7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c85:	00 00 00 
+  804c88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8f:	00 00 00 
+  804c92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c99:	00 00 00 
+  804c9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca3:	00 00 00 
+  804ca6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cad:	00 00 00 
+  804cb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb7:	00 00 00 
+  804cba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc1:	00 00 00 
+  804cc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccb:	00 00 00 
+  804cce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd5:	00 00 00 
+  804cd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdf:	00 00 00 
+  804ce2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce9:	00 00 00 
+  804cec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf3:	00 00 00 
+  804cf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfd:	00 00 00 
+  804d00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d07:	00 00 00 
+  804d0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d11:	00 00 00 
+  804d14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1b:	00 00 00 
+  804d1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d25:	00 00 00 
+  804d28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2f:	00 00 00 
+  804d32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d39:	00 00 00 
+  804d3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d43:	00 00 00 
+  804d46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4d:	00 00 00 
+  804d50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d57:	00 00 00 
+  804d5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d61:	00 00 00 
+  804d64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6b:	00 00 00 
+  804d6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d75:	00 00 00 
+  804d78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7f:	00 00 00 
+  804d82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d89:	00 00 00 
+  804d8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d93:	00 00 00 
+  804d96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9d:	00 00 00 
+  804da0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da7:	00 00 00 
+  804daa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db1:	00 00 00 
+  804db4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbb:	00 00 00 
+  804dbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc5:	00 00 00 
+  804dc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcf:	00 00 00 
+  804dd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd9:	00 00 00 
+  804ddc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de3:	00 00 00 
+  804de6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ded:	00 00 00 
+  804df0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df7:	00 00 00 
+  804dfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e01:	00 00 00 
+  804e04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0b:	00 00 00 
+  804e0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e15:	00 00 00 
+  804e18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1f:	00 00 00 
+  804e22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e29:	00 00 00 
+  804e2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e33:	00 00 00 
+  804e36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3d:	00 00 00 
+  804e40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e47:	00 00 00 
+  804e4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e51:	00 00 00 
+  804e54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5b:	00 00 00 
+  804e5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e65:	00 00 00 
+  804e68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6f:	00 00 00 
+  804e72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e79:	00 00 00 
+  804e7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e83:	00 00 00 
+  804e86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8d:	00 00 00 
+  804e90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e97:	00 00 00 
+  804e9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea1:	00 00 00 
+  804ea4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eab:	00 00 00 
+  804eae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb5:	00 00 00 
+  804eb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebf:	00 00 00 
+  804ec2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec9:	00 00 00 
+  804ecc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed3:	00 00 00 
+  804ed6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edd:	00 00 00 
+  804ee0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee7:	00 00 00 
+  804eea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef1:	00 00 00 
+  804ef4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efb:	00 00 00 
+  804efe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f05:	00 00 00 
+  804f08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0f:	00 00 00 
+  804f12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f19:	00 00 00 
+  804f1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f23:	00 00 00 
+  804f26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2d:	00 00 00 
+  804f30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f37:	00 00 00 
+  804f3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f41:	00 00 00 
+  804f44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4b:	00 00 00 
+  804f4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f55:	00 00 00 
+  804f58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5f:	00 00 00 
+  804f62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f69:	00 00 00 
+  804f6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f73:	00 00 00 
+  804f76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7d:	00 00 00 
+  804f80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f87:	00 00 00 
+  804f8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f91:	00 00 00 
+  804f94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9b:	00 00 00 
+  804f9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa5:	00 00 00 
+  804fa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faf:	00 00 00 
+  804fb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb9:	00 00 00 
+  804fbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc3:	00 00 00 
+  804fc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcd:	00 00 00 
+  804fd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd7:	00 00 00 
+  804fda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe1:	00 00 00 
+  804fe4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804feb:	00 00 00 
+  804fee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff5:	00 00 00 
+  804ff8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804fff:	00 
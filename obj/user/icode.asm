@@ -0,0 +1,8370 @@
+
+obj/user/icode:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c9 01 00 00       	call   8001ec <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 81 ec 18 02 00 00 	sub    $0x218,%rsp
+    int fd, n, r;
+    char buf[512 + 1];
+
+    binaryname = "icode";
+  800035:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80003c:	00 00 00 
+  80003f:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800046:	00 00 00 
+
+    cprintf("icode startup\n");
+  800049:	48 bf 06 50 80 00 00 	movabs $0x805006,%rdi
+  800050:	00 00 00 
+  800053:	b8 00 00 00 00       	mov    $0x0,%eax
+  800058:	48 bb 08 04 80 00 00 	movabs $0x800408,%rbx
+  80005f:	00 00 00 
+  800062:	ff d3                	call   *%rbx
+
+    cprintf("icode: open /motd\n");
+  800064:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  80006b:	00 00 00 
+  80006e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800073:	ff d3                	call   *%rbx
+    if ((fd = open("/motd", O_RDONLY)) < 0)
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 bf 28 50 80 00 00 	movabs $0x805028,%rdi
+  800081:	00 00 00 
+  800084:	48 b8 70 32 80 00 00 	movabs $0x803270,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+  800090:	89 c3                	mov    %eax,%ebx
+  800092:	85 c0                	test   %eax,%eax
+  800094:	78 31                	js     8000c7 <umain+0xa2>
+        panic("icode: open /motd: %i", fd);
+
+    cprintf("icode: read /motd\n");
+  800096:	48 bf 51 50 80 00 00 	movabs $0x805051,%rdi
+  80009d:	00 00 00 
+  8000a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a5:	48 ba 08 04 80 00 00 	movabs $0x800408,%rdx
+  8000ac:	00 00 00 
+  8000af:	ff d2                	call   *%rdx
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000b1:	49 bc 67 22 80 00 00 	movabs $0x802267,%r12
+  8000b8:	00 00 00 
+        sys_cputs(buf, n);
+  8000bb:	49 bd 57 13 80 00 00 	movabs $0x801357,%r13
+  8000c2:	00 00 00 
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000c5:	eb 3a                	jmp    800101 <umain+0xdc>
+        panic("icode: open /motd: %i", fd);
+  8000c7:	89 c1                	mov    %eax,%ecx
+  8000c9:	48 ba 2e 50 80 00 00 	movabs $0x80502e,%rdx
+  8000d0:	00 00 00 
+  8000d3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000d8:	48 bf 44 50 80 00 00 	movabs $0x805044,%rdi
+  8000df:	00 00 00 
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  8000ee:	00 00 00 
+  8000f1:	41 ff d0             	call   *%r8
+        sys_cputs(buf, n);
+  8000f4:	48 63 f0             	movslq %eax,%rsi
+  8000f7:	48 8d bd df fd ff ff 	lea    -0x221(%rbp),%rdi
+  8000fe:	41 ff d5             	call   *%r13
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  800101:	ba 00 02 00 00       	mov    $0x200,%edx
+  800106:	48 8d b5 df fd ff ff 	lea    -0x221(%rbp),%rsi
+  80010d:	89 df                	mov    %ebx,%edi
+  80010f:	41 ff d4             	call   *%r12
+  800112:	85 c0                	test   %eax,%eax
+  800114:	7f de                	jg     8000f4 <umain+0xcf>
+
+    cprintf("icode: close /motd\n");
+  800116:	48 bf 64 50 80 00 00 	movabs $0x805064,%rdi
+  80011d:	00 00 00 
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+  800125:	49 bc 08 04 80 00 00 	movabs $0x800408,%r12
+  80012c:	00 00 00 
+  80012f:	41 ff d4             	call   *%r12
+    close(fd);
+  800132:	89 df                	mov    %ebx,%edi
+  800134:	48 b8 e9 20 80 00 00 	movabs $0x8020e9,%rax
+  80013b:	00 00 00 
+  80013e:	ff d0                	call   *%rax
+
+    cprintf("icode: spawn /init\n");
+  800140:	48 bf 78 50 80 00 00 	movabs $0x805078,%rdi
+  800147:	00 00 00 
+  80014a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014f:	41 ff d4             	call   *%r12
+    if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char *)0)) < 0)
+  800152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800158:	48 b9 8c 50 80 00 00 	movabs $0x80508c,%rcx
+  80015f:	00 00 00 
+  800162:	48 ba 95 50 80 00 00 	movabs $0x805095,%rdx
+  800169:	00 00 00 
+  80016c:	48 be 9f 50 80 00 00 	movabs $0x80509f,%rsi
+  800173:	00 00 00 
+  800176:	48 bf 9e 50 80 00 00 	movabs $0x80509e,%rdi
+  80017d:	00 00 00 
+  800180:	b8 00 00 00 00       	mov    $0x0,%eax
+  800185:	49 b9 8b 3e 80 00 00 	movabs $0x803e8b,%r9
+  80018c:	00 00 00 
+  80018f:	41 ff d1             	call   *%r9
+  800192:	85 c0                	test   %eax,%eax
+  800194:	78 29                	js     8001bf <umain+0x19a>
+        panic("icode: spawn /init: %i", r);
+
+    cprintf("icode: exiting\n");
+  800196:	48 bf bb 50 80 00 00 	movabs $0x8050bb,%rdi
+  80019d:	00 00 00 
+  8001a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a5:	48 ba 08 04 80 00 00 	movabs $0x800408,%rdx
+  8001ac:	00 00 00 
+  8001af:	ff d2                	call   *%rdx
+}
+  8001b1:	48 81 c4 18 02 00 00 	add    $0x218,%rsp
+  8001b8:	5b                   	pop    %rbx
+  8001b9:	41 5c                	pop    %r12
+  8001bb:	41 5d                	pop    %r13
+  8001bd:	5d                   	pop    %rbp
+  8001be:	c3                   	ret
+        panic("icode: spawn /init: %i", r);
+  8001bf:	89 c1                	mov    %eax,%ecx
+  8001c1:	48 ba a4 50 80 00 00 	movabs $0x8050a4,%rdx
+  8001c8:	00 00 00 
+  8001cb:	be 19 00 00 00       	mov    $0x19,%esi
+  8001d0:	48 bf 44 50 80 00 00 	movabs $0x805044,%rdi
+  8001d7:	00 00 00 
+  8001da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001df:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  8001e6:	00 00 00 
+  8001e9:	41 ff d0             	call   *%r8
+
+00000000008001ec <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001ec:	55                   	push   %rbp
+  8001ed:	48 89 e5             	mov    %rsp,%rbp
+  8001f0:	41 56                	push   %r14
+  8001f2:	41 55                	push   %r13
+  8001f4:	41 54                	push   %r12
+  8001f6:	53                   	push   %rbx
+  8001f7:	41 89 fd             	mov    %edi,%r13d
+  8001fa:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001fd:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800204:	00 00 00 
+  800207:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80020e:	00 00 00 
+  800211:	48 39 c2             	cmp    %rax,%rdx
+  800214:	73 17                	jae    80022d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800216:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800219:	49 89 c4             	mov    %rax,%r12
+  80021c:	48 83 c3 08          	add    $0x8,%rbx
+  800220:	b8 00 00 00 00       	mov    $0x0,%eax
+  800225:	ff 53 f8             	call   *-0x8(%rbx)
+  800228:	4c 39 e3             	cmp    %r12,%rbx
+  80022b:	72 ef                	jb     80021c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80022d:	48 b8 20 14 80 00 00 	movabs $0x801420,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+  800239:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80023e:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800245:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80024c:	00 00 00 
+  80024f:	48 01 d0             	add    %rdx,%rax
+  800252:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800259:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80025c:	45 85 ed             	test   %r13d,%r13d
+  80025f:	7e 0d                	jle    80026e <libmain+0x82>
+  800261:	49 8b 06             	mov    (%r14),%rax
+  800264:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80026b:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80026e:	4c 89 f6             	mov    %r14,%rsi
+  800271:	44 89 ef             	mov    %r13d,%edi
+  800274:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80027b:	00 00 00 
+  80027e:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800280:	48 b8 95 02 80 00 00 	movabs $0x800295,%rax
+  800287:	00 00 00 
+  80028a:	ff d0                	call   *%rax
+#endif
+}
+  80028c:	5b                   	pop    %rbx
+  80028d:	41 5c                	pop    %r12
+  80028f:	41 5d                	pop    %r13
+  800291:	41 5e                	pop    %r14
+  800293:	5d                   	pop    %rbp
+  800294:	c3                   	ret
+
+0000000000800295 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800295:	55                   	push   %rbp
+  800296:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800299:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  8002a0:	00 00 00 
+  8002a3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002aa:	48 b8 b5 13 80 00 00 	movabs $0x8013b5,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+}
+  8002b6:	5d                   	pop    %rbp
+  8002b7:	c3                   	ret
+
+00000000008002b8 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002b8:	55                   	push   %rbp
+  8002b9:	48 89 e5             	mov    %rsp,%rbp
+  8002bc:	41 56                	push   %r14
+  8002be:	41 55                	push   %r13
+  8002c0:	41 54                	push   %r12
+  8002c2:	53                   	push   %rbx
+  8002c3:	48 83 ec 50          	sub    $0x50,%rsp
+  8002c7:	49 89 fc             	mov    %rdi,%r12
+  8002ca:	41 89 f5             	mov    %esi,%r13d
+  8002cd:	48 89 d3             	mov    %rdx,%rbx
+  8002d0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002d4:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002d8:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002dc:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002e3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002e7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002eb:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002ef:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002f3:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002fa:	00 00 00 
+  8002fd:	4c 8b 30             	mov    (%rax),%r14
+  800300:	48 b8 20 14 80 00 00 	movabs $0x801420,%rax
+  800307:	00 00 00 
+  80030a:	ff d0                	call   *%rax
+  80030c:	89 c6                	mov    %eax,%esi
+  80030e:	45 89 e8             	mov    %r13d,%r8d
+  800311:	4c 89 e1             	mov    %r12,%rcx
+  800314:	4c 89 f2             	mov    %r14,%rdx
+  800317:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  80031e:	00 00 00 
+  800321:	b8 00 00 00 00       	mov    $0x0,%eax
+  800326:	49 bc 08 04 80 00 00 	movabs $0x800408,%r12
+  80032d:	00 00 00 
+  800330:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800333:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800337:	48 89 df             	mov    %rbx,%rdi
+  80033a:	48 b8 a4 03 80 00 00 	movabs $0x8003a4,%rax
+  800341:	00 00 00 
+  800344:	ff d0                	call   *%rax
+    cprintf("\n");
+  800346:	48 bf 62 50 80 00 00 	movabs $0x805062,%rdi
+  80034d:	00 00 00 
+  800350:	b8 00 00 00 00       	mov    $0x0,%eax
+  800355:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800358:	cc                   	int3
+  800359:	eb fd                	jmp    800358 <_panic+0xa0>
+
+000000000080035b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80035b:	55                   	push   %rbp
+  80035c:	48 89 e5             	mov    %rsp,%rbp
+  80035f:	53                   	push   %rbx
+  800360:	48 83 ec 08          	sub    $0x8,%rsp
+  800364:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800367:	8b 06                	mov    (%rsi),%eax
+  800369:	8d 50 01             	lea    0x1(%rax),%edx
+  80036c:	89 16                	mov    %edx,(%rsi)
+  80036e:	48 98                	cltq
+  800370:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800375:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80037b:	74 0a                	je     800387 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80037d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800381:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800385:	c9                   	leave
+  800386:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800387:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80038b:	be ff 00 00 00       	mov    $0xff,%esi
+  800390:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  800397:	00 00 00 
+  80039a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80039c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003a2:	eb d9                	jmp    80037d <putch+0x22>
+
+00000000008003a4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003a4:	55                   	push   %rbp
+  8003a5:	48 89 e5             	mov    %rsp,%rbp
+  8003a8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003af:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003b2:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003b9:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003c6:	48 89 f1             	mov    %rsi,%rcx
+  8003c9:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003d0:	48 bf 5b 03 80 00 00 	movabs $0x80035b,%rdi
+  8003d7:	00 00 00 
+  8003da:	48 b8 58 05 80 00 00 	movabs $0x800558,%rax
+  8003e1:	00 00 00 
+  8003e4:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003e6:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003ed:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003f4:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  8003fb:	00 00 00 
+  8003fe:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800400:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800406:	c9                   	leave
+  800407:	c3                   	ret
+
+0000000000800408 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800408:	55                   	push   %rbp
+  800409:	48 89 e5             	mov    %rsp,%rbp
+  80040c:	48 83 ec 50          	sub    $0x50,%rsp
+  800410:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800414:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800418:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80041c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800420:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800424:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80042b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80042f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800433:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800437:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80043b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80043f:	48 b8 a4 03 80 00 00 	movabs $0x8003a4,%rax
+  800446:	00 00 00 
+  800449:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80044b:	c9                   	leave
+  80044c:	c3                   	ret
+
+000000000080044d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80044d:	55                   	push   %rbp
+  80044e:	48 89 e5             	mov    %rsp,%rbp
+  800451:	41 57                	push   %r15
+  800453:	41 56                	push   %r14
+  800455:	41 55                	push   %r13
+  800457:	41 54                	push   %r12
+  800459:	53                   	push   %rbx
+  80045a:	48 83 ec 18          	sub    $0x18,%rsp
+  80045e:	49 89 fc             	mov    %rdi,%r12
+  800461:	49 89 f5             	mov    %rsi,%r13
+  800464:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800468:	8b 45 10             	mov    0x10(%rbp),%eax
+  80046b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80046e:	41 89 cf             	mov    %ecx,%r15d
+  800471:	4c 39 fa             	cmp    %r15,%rdx
+  800474:	73 5b                	jae    8004d1 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800476:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80047a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80047e:	85 db                	test   %ebx,%ebx
+  800480:	7e 0e                	jle    800490 <print_num+0x43>
+            putch(padc, put_arg);
+  800482:	4c 89 ee             	mov    %r13,%rsi
+  800485:	44 89 f7             	mov    %r14d,%edi
+  800488:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80048b:	83 eb 01             	sub    $0x1,%ebx
+  80048e:	75 f2                	jne    800482 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800490:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800494:	48 b9 0c 51 80 00 00 	movabs $0x80510c,%rcx
+  80049b:	00 00 00 
+  80049e:	48 b8 fb 50 80 00 00 	movabs $0x8050fb,%rax
+  8004a5:	00 00 00 
+  8004a8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b5:	49 f7 f7             	div    %r15
+  8004b8:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004bc:	4c 89 ee             	mov    %r13,%rsi
+  8004bf:	41 ff d4             	call   *%r12
+}
+  8004c2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004c6:	5b                   	pop    %rbx
+  8004c7:	41 5c                	pop    %r12
+  8004c9:	41 5d                	pop    %r13
+  8004cb:	41 5e                	pop    %r14
+  8004cd:	41 5f                	pop    %r15
+  8004cf:	5d                   	pop    %rbp
+  8004d0:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004da:	49 f7 f7             	div    %r15
+  8004dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8004e1:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004e5:	52                   	push   %rdx
+  8004e6:	45 0f be c9          	movsbl %r9b,%r9d
+  8004ea:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004ee:	48 89 c2             	mov    %rax,%rdx
+  8004f1:	48 b8 4d 04 80 00 00 	movabs $0x80044d,%rax
+  8004f8:	00 00 00 
+  8004fb:	ff d0                	call   *%rax
+  8004fd:	48 83 c4 10          	add    $0x10,%rsp
+  800501:	eb 8d                	jmp    800490 <print_num+0x43>
+
+0000000000800503 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800503:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800507:	48 8b 06             	mov    (%rsi),%rax
+  80050a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80050e:	73 0a                	jae    80051a <sprintputch+0x17>
+        *state->start++ = ch;
+  800510:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800514:	48 89 16             	mov    %rdx,(%rsi)
+  800517:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80051a:	c3                   	ret
+
+000000000080051b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80051b:	55                   	push   %rbp
+  80051c:	48 89 e5             	mov    %rsp,%rbp
+  80051f:	48 83 ec 50          	sub    $0x50,%rsp
+  800523:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800527:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80052b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80052f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800536:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80053a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80053e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800542:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800546:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80054a:	48 b8 58 05 80 00 00 	movabs $0x800558,%rax
+  800551:	00 00 00 
+  800554:	ff d0                	call   *%rax
+}
+  800556:	c9                   	leave
+  800557:	c3                   	ret
+
+0000000000800558 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800558:	55                   	push   %rbp
+  800559:	48 89 e5             	mov    %rsp,%rbp
+  80055c:	41 57                	push   %r15
+  80055e:	41 56                	push   %r14
+  800560:	41 55                	push   %r13
+  800562:	41 54                	push   %r12
+  800564:	53                   	push   %rbx
+  800565:	48 83 ec 38          	sub    $0x38,%rsp
+  800569:	49 89 fe             	mov    %rdi,%r14
+  80056c:	49 89 f5             	mov    %rsi,%r13
+  80056f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800572:	48 8b 01             	mov    (%rcx),%rax
+  800575:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800579:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80057d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800581:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800585:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800589:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80058d:	0f b6 3b             	movzbl (%rbx),%edi
+  800590:	40 80 ff 25          	cmp    $0x25,%dil
+  800594:	74 18                	je     8005ae <vprintfmt+0x56>
+            if (!ch) return;
+  800596:	40 84 ff             	test   %dil,%dil
+  800599:	0f 84 04 07 00 00    	je     800ca3 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80059f:	40 0f b6 ff          	movzbl %dil,%edi
+  8005a3:	4c 89 ee             	mov    %r13,%rsi
+  8005a6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005a9:	4c 89 e3             	mov    %r12,%rbx
+  8005ac:	eb db                	jmp    800589 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b3:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005b7:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005bc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005c2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005c9:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005cd:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005d2:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005d7:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005da:	83 e8 23             	sub    $0x23,%eax
+  8005dd:	3c 57                	cmp    $0x57,%al
+  8005df:	0f 87 a4 06 00 00    	ja     800c89 <vprintfmt+0x731>
+  8005e5:	0f b6 c0             	movzbl %al,%eax
+  8005e8:	48 b9 a0 52 80 00 00 	movabs $0x8052a0,%rcx
+  8005ef:	00 00 00 
+  8005f2:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005f5:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005f8:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005fc:	eb cf                	jmp    8005cd <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005fe:	49 89 dc             	mov    %rbx,%r12
+  800601:	be 01 00 00 00       	mov    $0x1,%esi
+  800606:	eb c5                	jmp    8005cd <vprintfmt+0x75>
+            padc = ch;
+  800608:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80060c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80060f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800612:	eb b9                	jmp    8005cd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800614:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800617:	83 f8 2f             	cmp    $0x2f,%eax
+  80061a:	77 24                	ja     800640 <vprintfmt+0xe8>
+  80061c:	89 c1                	mov    %eax,%ecx
+  80061e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800622:	83 c0 08             	add    $0x8,%eax
+  800625:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800628:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80062b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80062e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800632:	79 99                	jns    8005cd <vprintfmt+0x75>
+                width = precision;
+  800634:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800638:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80063e:	eb 8d                	jmp    8005cd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800640:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800644:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800648:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064c:	eb da                	jmp    800628 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80064e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800653:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800657:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80065d:	3c 39                	cmp    $0x39,%al
+  80065f:	77 1c                	ja     80067d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800661:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800665:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800669:	0f b6 c0             	movzbl %al,%eax
+  80066c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800671:	0f b6 03             	movzbl (%rbx),%eax
+  800674:	3c 39                	cmp    $0x39,%al
+  800676:	76 e9                	jbe    800661 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800678:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80067b:	eb b1                	jmp    80062e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80067d:	49 89 dc             	mov    %rbx,%r12
+  800680:	eb ac                	jmp    80062e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800682:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800685:	85 c9                	test   %ecx,%ecx
+  800687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068c:	0f 49 c1             	cmovns %ecx,%eax
+  80068f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800692:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800695:	e9 33 ff ff ff       	jmp    8005cd <vprintfmt+0x75>
+            lflag++;
+  80069a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80069d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006a0:	e9 28 ff ff ff       	jmp    8005cd <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ab:	77 19                	ja     8006c6 <vprintfmt+0x16e>
+  8006ad:	89 c2                	mov    %eax,%edx
+  8006af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b3:	83 c0 08             	add    $0x8,%eax
+  8006b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b9:	8b 3a                	mov    (%rdx),%edi
+  8006bb:	4c 89 ee             	mov    %r13,%rsi
+  8006be:	41 ff d6             	call   *%r14
+            break;
+  8006c1:	e9 c3 fe ff ff       	jmp    800589 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d2:	eb e5                	jmp    8006b9 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006da:	77 5a                	ja     800736 <vprintfmt+0x1de>
+  8006dc:	89 c2                	mov    %eax,%edx
+  8006de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e2:	83 c0 08             	add    $0x8,%eax
+  8006e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006e8:	8b 02                	mov    (%rdx),%eax
+  8006ea:	89 c1                	mov    %eax,%ecx
+  8006ec:	f7 d9                	neg    %ecx
+  8006ee:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006f1:	83 f9 13             	cmp    $0x13,%ecx
+  8006f4:	7f 4e                	jg     800744 <vprintfmt+0x1ec>
+  8006f6:	48 63 c1             	movslq %ecx,%rax
+  8006f9:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  800700:	00 00 00 
+  800703:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800707:	48 85 c0             	test   %rax,%rax
+  80070a:	74 38                	je     800744 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80070c:	48 89 c1             	mov    %rax,%rcx
+  80070f:	48 ba 0c 58 80 00 00 	movabs $0x80580c,%rdx
+  800716:	00 00 00 
+  800719:	4c 89 ee             	mov    %r13,%rsi
+  80071c:	4c 89 f7             	mov    %r14,%rdi
+  80071f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800724:	49 b8 1b 05 80 00 00 	movabs $0x80051b,%r8
+  80072b:	00 00 00 
+  80072e:	41 ff d0             	call   *%r8
+  800731:	e9 53 fe ff ff       	jmp    800589 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800736:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800742:	eb a4                	jmp    8006e8 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800744:	48 ba 24 51 80 00 00 	movabs $0x805124,%rdx
+  80074b:	00 00 00 
+  80074e:	4c 89 ee             	mov    %r13,%rsi
+  800751:	4c 89 f7             	mov    %r14,%rdi
+  800754:	b8 00 00 00 00       	mov    $0x0,%eax
+  800759:	49 b8 1b 05 80 00 00 	movabs $0x80051b,%r8
+  800760:	00 00 00 
+  800763:	41 ff d0             	call   *%r8
+  800766:	e9 1e fe ff ff       	jmp    800589 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80076b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076e:	83 f8 2f             	cmp    $0x2f,%eax
+  800771:	77 36                	ja     8007a9 <vprintfmt+0x251>
+  800773:	89 c2                	mov    %eax,%edx
+  800775:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800779:	83 c0 08             	add    $0x8,%eax
+  80077c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077f:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800782:	48 85 f6             	test   %rsi,%rsi
+  800785:	48 b8 1d 51 80 00 00 	movabs $0x80511d,%rax
+  80078c:	00 00 00 
+  80078f:	48 0f 45 c6          	cmovne %rsi,%rax
+  800793:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800797:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80079b:	7e 06                	jle    8007a3 <vprintfmt+0x24b>
+  80079d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007a1:	75 14                	jne    8007b7 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007a3:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8007a7:	eb 5b                	jmp    800804 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8007a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b5:	eb c8                	jmp    80077f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007b7:	49 63 f7             	movslq %r15d,%rsi
+  8007ba:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007be:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  8007c5:	00 00 00 
+  8007c8:	ff d0                	call   *%rax
+  8007ca:	48 89 c2             	mov    %rax,%rdx
+  8007cd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007d0:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007d2:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007d5:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007d8:	85 c0                	test   %eax,%eax
+  8007da:	7e c7                	jle    8007a3 <vprintfmt+0x24b>
+  8007dc:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007e1:	4c 89 ee             	mov    %r13,%rsi
+  8007e4:	44 89 e7             	mov    %r12d,%edi
+  8007e7:	41 ff d6             	call   *%r14
+  8007ea:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007ee:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007f1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007f4:	75 eb                	jne    8007e1 <vprintfmt+0x289>
+  8007f6:	eb ab                	jmp    8007a3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007f8:	0f b6 f8             	movzbl %al,%edi
+  8007fb:	4c 89 ee             	mov    %r13,%rsi
+  8007fe:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800801:	4c 89 e2             	mov    %r12,%rdx
+  800804:	45 85 ff             	test   %r15d,%r15d
+  800807:	78 06                	js     80080f <vprintfmt+0x2b7>
+  800809:	41 83 ef 01          	sub    $0x1,%r15d
+  80080d:	78 23                	js     800832 <vprintfmt+0x2da>
+  80080f:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800813:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800819:	84 c0                	test   %al,%al
+  80081b:	74 15                	je     800832 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80081d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800821:	74 d5                	je     8007f8 <vprintfmt+0x2a0>
+  800823:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800826:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80082b:	80 fa 5e             	cmp    $0x5e,%dl
+  80082e:	77 cb                	ja     8007fb <vprintfmt+0x2a3>
+  800830:	eb c6                	jmp    8007f8 <vprintfmt+0x2a0>
+  800832:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800835:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800838:	01 f0                	add    %esi,%eax
+  80083a:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80083c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800840:	85 c0                	test   %eax,%eax
+  800842:	0f 8e 41 fd ff ff    	jle    800589 <vprintfmt+0x31>
+  800848:	4c 89 ee             	mov    %r13,%rsi
+  80084b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800850:	41 ff d6             	call   *%r14
+  800853:	41 83 ec 01          	sub    $0x1,%r12d
+  800857:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80085b:	75 eb                	jne    800848 <vprintfmt+0x2f0>
+  80085d:	e9 27 fd ff ff       	jmp    800589 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800862:	40 84 f6             	test   %sil,%sil
+  800865:	75 26                	jne    80088d <vprintfmt+0x335>
+    switch (lflag) {
+  800867:	85 d2                	test   %edx,%edx
+  800869:	74 59                	je     8008c4 <vprintfmt+0x36c>
+  80086b:	83 fa 01             	cmp    $0x1,%edx
+  80086e:	74 7b                	je     8008eb <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800870:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800873:	83 f8 2f             	cmp    $0x2f,%eax
+  800876:	0f 87 96 00 00 00    	ja     800912 <vprintfmt+0x3ba>
+  80087c:	89 c2                	mov    %eax,%edx
+  80087e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800882:	83 c0 08             	add    $0x8,%eax
+  800885:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800888:	4c 8b 22             	mov    (%rdx),%r12
+  80088b:	eb 17                	jmp    8008a4 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80088d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800890:	83 f8 2f             	cmp    $0x2f,%eax
+  800893:	77 21                	ja     8008b6 <vprintfmt+0x35e>
+  800895:	89 c2                	mov    %eax,%edx
+  800897:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089b:	83 c0 08             	add    $0x8,%eax
+  80089e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a1:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008a4:	4d 85 e4             	test   %r12,%r12
+  8008a7:	78 7a                	js     800923 <vprintfmt+0x3cb>
+            num = i;
+  8008a9:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008ac:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008b1:	e9 b5 02 00 00       	jmp    800b6b <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c2:	eb dd                	jmp    8008a1 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8008c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ca:	77 11                	ja     8008dd <vprintfmt+0x385>
+  8008cc:	89 c2                	mov    %eax,%edx
+  8008ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d2:	83 c0 08             	add    $0x8,%eax
+  8008d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d8:	4c 63 22             	movslq (%rdx),%r12
+  8008db:	eb c7                	jmp    8008a4 <vprintfmt+0x34c>
+  8008dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e9:	eb ed                	jmp    8008d8 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8008eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f1:	77 11                	ja     800904 <vprintfmt+0x3ac>
+  8008f3:	89 c2                	mov    %eax,%edx
+  8008f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f9:	83 c0 08             	add    $0x8,%eax
+  8008fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ff:	4c 8b 22             	mov    (%rdx),%r12
+  800902:	eb a0                	jmp    8008a4 <vprintfmt+0x34c>
+  800904:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800908:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800910:	eb ed                	jmp    8008ff <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800912:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800916:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091e:	e9 65 ff ff ff       	jmp    800888 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800923:	4c 89 ee             	mov    %r13,%rsi
+  800926:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80092b:	41 ff d6             	call   *%r14
+                i = -i;
+  80092e:	49 f7 dc             	neg    %r12
+  800931:	e9 73 ff ff ff       	jmp    8008a9 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800936:	40 84 f6             	test   %sil,%sil
+  800939:	75 32                	jne    80096d <vprintfmt+0x415>
+    switch (lflag) {
+  80093b:	85 d2                	test   %edx,%edx
+  80093d:	74 5d                	je     80099c <vprintfmt+0x444>
+  80093f:	83 fa 01             	cmp    $0x1,%edx
+  800942:	0f 84 82 00 00 00    	je     8009ca <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800948:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094b:	83 f8 2f             	cmp    $0x2f,%eax
+  80094e:	0f 87 a5 00 00 00    	ja     8009f9 <vprintfmt+0x4a1>
+  800954:	89 c2                	mov    %eax,%edx
+  800956:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095a:	83 c0 08             	add    $0x8,%eax
+  80095d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800960:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800963:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800968:	e9 fe 01 00 00       	jmp    800b6b <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80096d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800970:	83 f8 2f             	cmp    $0x2f,%eax
+  800973:	77 19                	ja     80098e <vprintfmt+0x436>
+  800975:	89 c2                	mov    %eax,%edx
+  800977:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097b:	83 c0 08             	add    $0x8,%eax
+  80097e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800981:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800984:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800989:	e9 dd 01 00 00       	jmp    800b6b <vprintfmt+0x613>
+  80098e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800992:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800996:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099a:	eb e5                	jmp    800981 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80099c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099f:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a2:	77 18                	ja     8009bc <vprintfmt+0x464>
+  8009a4:	89 c2                	mov    %eax,%edx
+  8009a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009aa:	83 c0 08             	add    $0x8,%eax
+  8009ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b0:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009b2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009b7:	e9 af 01 00 00       	jmp    800b6b <vprintfmt+0x613>
+  8009bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c8:	eb e6                	jmp    8009b0 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8009ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d0:	77 19                	ja     8009eb <vprintfmt+0x493>
+  8009d2:	89 c2                	mov    %eax,%edx
+  8009d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d8:	83 c0 08             	add    $0x8,%eax
+  8009db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009de:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009e1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009e6:	e9 80 01 00 00       	jmp    800b6b <vprintfmt+0x613>
+  8009eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f7:	eb e5                	jmp    8009de <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8009f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a05:	e9 56 ff ff ff       	jmp    800960 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800a0a:	40 84 f6             	test   %sil,%sil
+  800a0d:	75 2e                	jne    800a3d <vprintfmt+0x4e5>
+    switch (lflag) {
+  800a0f:	85 d2                	test   %edx,%edx
+  800a11:	0f 84 b3 00 00 00    	je     800aca <vprintfmt+0x572>
+  800a17:	83 fa 01             	cmp    $0x1,%edx
+  800a1a:	0f 84 d3 00 00 00    	je     800af3 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800a20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a23:	83 f8 2f             	cmp    $0x2f,%eax
+  800a26:	0f 87 f1 00 00 00    	ja     800b1d <vprintfmt+0x5c5>
+  800a2c:	89 c2                	mov    %eax,%edx
+  800a2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a32:	83 c0 08             	add    $0x8,%eax
+  800a35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a38:	48 8b 02             	mov    (%rdx),%rax
+  800a3b:	eb 17                	jmp    800a54 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a40:	83 f8 2f             	cmp    $0x2f,%eax
+  800a43:	77 77                	ja     800abc <vprintfmt+0x564>
+  800a45:	89 c2                	mov    %eax,%edx
+  800a47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4b:	83 c0 08             	add    $0x8,%eax
+  800a4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a51:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800a54:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800a56:	83 f8 07             	cmp    $0x7,%eax
+  800a59:	0f 8e cf 00 00 00    	jle    800b2e <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800a5f:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800a65:	44 89 e7             	mov    %r12d,%edi
+  800a68:	41 c1 e4 03          	shl    $0x3,%r12d
+  800a6c:	89 d1                	mov    %edx,%ecx
+  800a6e:	8d 72 07             	lea    0x7(%rdx),%esi
+  800a71:	85 d2                	test   %edx,%edx
+  800a73:	0f 48 d6             	cmovs  %esi,%edx
+  800a76:	c1 fa 03             	sar    $0x3,%edx
+  800a79:	83 f9 3f             	cmp    $0x3f,%ecx
+  800a7c:	7f e7                	jg     800a65 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800a7e:	85 ff                	test   %edi,%edi
+  800a80:	0f 84 03 fb ff ff    	je     800589 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800a86:	49 63 f4             	movslq %r12d,%rsi
+  800a89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a8e:	48 f7 f6             	div    %rsi
+  800a91:	49 89 d7             	mov    %rdx,%r15
+  800a94:	83 c0 30             	add    $0x30,%eax
+  800a97:	0f be f8             	movsbl %al,%edi
+  800a9a:	4c 89 ee             	mov    %r13,%rsi
+  800a9d:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800aa0:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800aa3:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800aa8:	45 85 e4             	test   %r12d,%r12d
+  800aab:	41 0f 49 d4          	cmovns %r12d,%edx
+  800aaf:	c1 fa 03             	sar    $0x3,%edx
+  800ab2:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800ab5:	75 cf                	jne    800a86 <vprintfmt+0x52e>
+  800ab7:	e9 cd fa ff ff       	jmp    800589 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	eb 87                	jmp    800a51 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800aca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad0:	77 13                	ja     800ae5 <vprintfmt+0x58d>
+  800ad2:	89 c2                	mov    %eax,%edx
+  800ad4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad8:	83 c0 08             	add    $0x8,%eax
+  800adb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ade:	8b 02                	mov    (%rdx),%eax
+  800ae0:	e9 6f ff ff ff       	jmp    800a54 <vprintfmt+0x4fc>
+  800ae5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af1:	eb eb                	jmp    800ade <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800af3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af6:	83 f8 2f             	cmp    $0x2f,%eax
+  800af9:	77 14                	ja     800b0f <vprintfmt+0x5b7>
+  800afb:	89 c2                	mov    %eax,%edx
+  800afd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b01:	83 c0 08             	add    $0x8,%eax
+  800b04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b07:	48 8b 02             	mov    (%rdx),%rax
+  800b0a:	e9 45 ff ff ff       	jmp    800a54 <vprintfmt+0x4fc>
+  800b0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1b:	eb ea                	jmp    800b07 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800b1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b29:	e9 0a ff ff ff       	jmp    800a38 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800b2e:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800b34:	e9 4d ff ff ff       	jmp    800a86 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800b39:	4c 89 ee             	mov    %r13,%rsi
+  800b3c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b41:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b44:	4c 89 ee             	mov    %r13,%rsi
+  800b47:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b4c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b52:	83 f8 2f             	cmp    $0x2f,%eax
+  800b55:	77 47                	ja     800b9e <vprintfmt+0x646>
+  800b57:	89 c2                	mov    %eax,%edx
+  800b59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5d:	83 c0 08             	add    $0x8,%eax
+  800b60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b63:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b66:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b6b:	48 83 ec 08          	sub    $0x8,%rsp
+  800b6f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b73:	0f 94 c0             	sete   %al
+  800b76:	0f b6 c0             	movzbl %al,%eax
+  800b79:	50                   	push   %rax
+  800b7a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b7f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b83:	4c 89 ee             	mov    %r13,%rsi
+  800b86:	4c 89 f7             	mov    %r14,%rdi
+  800b89:	48 b8 4d 04 80 00 00 	movabs $0x80044d,%rax
+  800b90:	00 00 00 
+  800b93:	ff d0                	call   *%rax
+            break;
+  800b95:	48 83 c4 10          	add    $0x10,%rsp
+  800b99:	e9 eb f9 ff ff       	jmp    800589 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800baa:	eb b7                	jmp    800b63 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800bac:	40 84 f6             	test   %sil,%sil
+  800baf:	75 2b                	jne    800bdc <vprintfmt+0x684>
+    switch (lflag) {
+  800bb1:	85 d2                	test   %edx,%edx
+  800bb3:	74 56                	je     800c0b <vprintfmt+0x6b3>
+  800bb5:	83 fa 01             	cmp    $0x1,%edx
+  800bb8:	74 7f                	je     800c39 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800bba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbd:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc0:	0f 87 a2 00 00 00    	ja     800c68 <vprintfmt+0x710>
+  800bc6:	89 c2                	mov    %eax,%edx
+  800bc8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcc:	83 c0 08             	add    $0x8,%eax
+  800bcf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bd5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bda:	eb 8f                	jmp    800b6b <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800bdc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdf:	83 f8 2f             	cmp    $0x2f,%eax
+  800be2:	77 19                	ja     800bfd <vprintfmt+0x6a5>
+  800be4:	89 c2                	mov    %eax,%edx
+  800be6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bea:	83 c0 08             	add    $0x8,%eax
+  800bed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bf3:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bf8:	e9 6e ff ff ff       	jmp    800b6b <vprintfmt+0x613>
+  800bfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c09:	eb e5                	jmp    800bf0 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800c0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c11:	77 18                	ja     800c2b <vprintfmt+0x6d3>
+  800c13:	89 c2                	mov    %eax,%edx
+  800c15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c19:	83 c0 08             	add    $0x8,%eax
+  800c1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c21:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c26:	e9 40 ff ff ff       	jmp    800b6b <vprintfmt+0x613>
+  800c2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c37:	eb e6                	jmp    800c1f <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800c39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3f:	77 19                	ja     800c5a <vprintfmt+0x702>
+  800c41:	89 c2                	mov    %eax,%edx
+  800c43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c47:	83 c0 08             	add    $0x8,%eax
+  800c4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c50:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c55:	e9 11 ff ff ff       	jmp    800b6b <vprintfmt+0x613>
+  800c5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c66:	eb e5                	jmp    800c4d <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800c68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c74:	e9 59 ff ff ff       	jmp    800bd2 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800c79:	4c 89 ee             	mov    %r13,%rsi
+  800c7c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c81:	41 ff d6             	call   *%r14
+            break;
+  800c84:	e9 00 f9 ff ff       	jmp    800589 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c89:	4c 89 ee             	mov    %r13,%rsi
+  800c8c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c91:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c94:	48 83 eb 01          	sub    $0x1,%rbx
+  800c98:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c9c:	75 f6                	jne    800c94 <vprintfmt+0x73c>
+  800c9e:	e9 e6 f8 ff ff       	jmp    800589 <vprintfmt+0x31>
+}
+  800ca3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ca7:	5b                   	pop    %rbx
+  800ca8:	41 5c                	pop    %r12
+  800caa:	41 5d                	pop    %r13
+  800cac:	41 5e                	pop    %r14
+  800cae:	41 5f                	pop    %r15
+  800cb0:	5d                   	pop    %rbp
+  800cb1:	c3                   	ret
+
+0000000000800cb2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cb2:	55                   	push   %rbp
+  800cb3:	48 89 e5             	mov    %rsp,%rbp
+  800cb6:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cbe:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cc3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800cc7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cce:	48 85 ff             	test   %rdi,%rdi
+  800cd1:	74 2b                	je     800cfe <vsnprintf+0x4c>
+  800cd3:	48 85 f6             	test   %rsi,%rsi
+  800cd6:	74 26                	je     800cfe <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cd8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cdc:	48 bf 03 05 80 00 00 	movabs $0x800503,%rdi
+  800ce3:	00 00 00 
+  800ce6:	48 b8 58 05 80 00 00 	movabs $0x800558,%rax
+  800ced:	00 00 00 
+  800cf0:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800cf2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cf6:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cf9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cfc:	c9                   	leave
+  800cfd:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d03:	eb f7                	jmp    800cfc <vsnprintf+0x4a>
+
+0000000000800d05 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d05:	55                   	push   %rbp
+  800d06:	48 89 e5             	mov    %rsp,%rbp
+  800d09:	48 83 ec 50          	sub    $0x50,%rsp
+  800d0d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d11:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d15:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d19:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d20:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d28:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d2c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d30:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d34:	48 b8 b2 0c 80 00 00 	movabs $0x800cb2,%rax
+  800d3b:	00 00 00 
+  800d3e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d40:	c9                   	leave
+  800d41:	c3                   	ret
+
+0000000000800d42 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d42:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d45:	74 10                	je     800d57 <strlen+0x15>
+    size_t n = 0;
+  800d47:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d4c:	48 83 c0 01          	add    $0x1,%rax
+  800d50:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d54:	75 f6                	jne    800d4c <strlen+0xa>
+  800d56:	c3                   	ret
+    size_t n = 0;
+  800d57:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d5c:	c3                   	ret
+
+0000000000800d5d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d5d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d60:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d65:	48 85 f6             	test   %rsi,%rsi
+  800d68:	74 11                	je     800d7b <strnlen+0x1e>
+  800d6a:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d6e:	74 0c                	je     800d7c <strnlen+0x1f>
+  800d70:	48 83 c2 01          	add    $0x1,%rdx
+  800d74:	48 39 d0             	cmp    %rdx,%rax
+  800d77:	75 f1                	jne    800d6a <strnlen+0xd>
+  800d79:	eb 04                	jmp    800d7f <strnlen+0x22>
+  800d7b:	c3                   	ret
+  800d7c:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d7f:	c3                   	ret
+
+0000000000800d80 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d80:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d88:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d8c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d8f:	48 83 c2 01          	add    $0x1,%rdx
+  800d93:	84 c9                	test   %cl,%cl
+  800d95:	75 f1                	jne    800d88 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d97:	c3                   	ret
+
+0000000000800d98 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d98:	55                   	push   %rbp
+  800d99:	48 89 e5             	mov    %rsp,%rbp
+  800d9c:	41 54                	push   %r12
+  800d9e:	53                   	push   %rbx
+  800d9f:	48 89 fb             	mov    %rdi,%rbx
+  800da2:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800da5:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  800dac:	00 00 00 
+  800daf:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800db1:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800db5:	4c 89 e6             	mov    %r12,%rsi
+  800db8:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  800dbf:	00 00 00 
+  800dc2:	ff d0                	call   *%rax
+    return dst;
+}
+  800dc4:	48 89 d8             	mov    %rbx,%rax
+  800dc7:	5b                   	pop    %rbx
+  800dc8:	41 5c                	pop    %r12
+  800dca:	5d                   	pop    %rbp
+  800dcb:	c3                   	ret
+
+0000000000800dcc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dcc:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800dcf:	48 85 d2             	test   %rdx,%rdx
+  800dd2:	74 1f                	je     800df3 <strncpy+0x27>
+  800dd4:	48 01 fa             	add    %rdi,%rdx
+  800dd7:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800dda:	48 83 c1 01          	add    $0x1,%rcx
+  800dde:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800de2:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800de6:	41 80 f8 01          	cmp    $0x1,%r8b
+  800dea:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800dee:	48 39 ca             	cmp    %rcx,%rdx
+  800df1:	75 e7                	jne    800dda <strncpy+0xe>
+    }
+    return ret;
+}
+  800df3:	c3                   	ret
+
+0000000000800df4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800df4:	48 89 f8             	mov    %rdi,%rax
+  800df7:	48 85 d2             	test   %rdx,%rdx
+  800dfa:	74 24                	je     800e20 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800dfc:	48 83 ea 01          	sub    $0x1,%rdx
+  800e00:	74 1b                	je     800e1d <strlcpy+0x29>
+  800e02:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e06:	0f b6 16             	movzbl (%rsi),%edx
+  800e09:	84 d2                	test   %dl,%dl
+  800e0b:	74 10                	je     800e1d <strlcpy+0x29>
+            *dst++ = *src++;
+  800e0d:	48 83 c6 01          	add    $0x1,%rsi
+  800e11:	48 83 c0 01          	add    $0x1,%rax
+  800e15:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e18:	48 39 c8             	cmp    %rcx,%rax
+  800e1b:	75 e9                	jne    800e06 <strlcpy+0x12>
+        *dst = '\0';
+  800e1d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e20:	48 29 f8             	sub    %rdi,%rax
+}
+  800e23:	c3                   	ret
+
+0000000000800e24 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e24:	0f b6 07             	movzbl (%rdi),%eax
+  800e27:	84 c0                	test   %al,%al
+  800e29:	74 13                	je     800e3e <strcmp+0x1a>
+  800e2b:	38 06                	cmp    %al,(%rsi)
+  800e2d:	75 0f                	jne    800e3e <strcmp+0x1a>
+  800e2f:	48 83 c7 01          	add    $0x1,%rdi
+  800e33:	48 83 c6 01          	add    $0x1,%rsi
+  800e37:	0f b6 07             	movzbl (%rdi),%eax
+  800e3a:	84 c0                	test   %al,%al
+  800e3c:	75 ed                	jne    800e2b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e3e:	0f b6 c0             	movzbl %al,%eax
+  800e41:	0f b6 16             	movzbl (%rsi),%edx
+  800e44:	29 d0                	sub    %edx,%eax
+}
+  800e46:	c3                   	ret
+
+0000000000800e47 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e47:	48 85 d2             	test   %rdx,%rdx
+  800e4a:	74 1f                	je     800e6b <strncmp+0x24>
+  800e4c:	0f b6 07             	movzbl (%rdi),%eax
+  800e4f:	84 c0                	test   %al,%al
+  800e51:	74 1e                	je     800e71 <strncmp+0x2a>
+  800e53:	3a 06                	cmp    (%rsi),%al
+  800e55:	75 1a                	jne    800e71 <strncmp+0x2a>
+  800e57:	48 83 c7 01          	add    $0x1,%rdi
+  800e5b:	48 83 c6 01          	add    $0x1,%rsi
+  800e5f:	48 83 ea 01          	sub    $0x1,%rdx
+  800e63:	75 e7                	jne    800e4c <strncmp+0x5>
+
+    if (!n) return 0;
+  800e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6a:	c3                   	ret
+  800e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e70:	c3                   	ret
+  800e71:	48 85 d2             	test   %rdx,%rdx
+  800e74:	74 09                	je     800e7f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e76:	0f b6 07             	movzbl (%rdi),%eax
+  800e79:	0f b6 16             	movzbl (%rsi),%edx
+  800e7c:	29 d0                	sub    %edx,%eax
+  800e7e:	c3                   	ret
+    if (!n) return 0;
+  800e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e84:	c3                   	ret
+
+0000000000800e85 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e85:	0f b6 17             	movzbl (%rdi),%edx
+  800e88:	84 d2                	test   %dl,%dl
+  800e8a:	74 18                	je     800ea4 <strchr+0x1f>
+        if (*str == c) {
+  800e8c:	0f be d2             	movsbl %dl,%edx
+  800e8f:	39 f2                	cmp    %esi,%edx
+  800e91:	74 17                	je     800eaa <strchr+0x25>
+    for (; *str; str++) {
+  800e93:	48 83 c7 01          	add    $0x1,%rdi
+  800e97:	0f b6 17             	movzbl (%rdi),%edx
+  800e9a:	84 d2                	test   %dl,%dl
+  800e9c:	75 ee                	jne    800e8c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea3:	c3                   	ret
+  800ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea9:	c3                   	ret
+  800eaa:	48 89 f8             	mov    %rdi,%rax
+}
+  800ead:	c3                   	ret
+
+0000000000800eae <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800eae:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800eb1:	0f b6 17             	movzbl (%rdi),%edx
+  800eb4:	84 d2                	test   %dl,%dl
+  800eb6:	74 13                	je     800ecb <strfind+0x1d>
+  800eb8:	0f be d2             	movsbl %dl,%edx
+  800ebb:	39 f2                	cmp    %esi,%edx
+  800ebd:	74 0b                	je     800eca <strfind+0x1c>
+  800ebf:	48 83 c0 01          	add    $0x1,%rax
+  800ec3:	0f b6 10             	movzbl (%rax),%edx
+  800ec6:	84 d2                	test   %dl,%dl
+  800ec8:	75 ee                	jne    800eb8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800eca:	c3                   	ret
+  800ecb:	c3                   	ret
+
+0000000000800ecc <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800ecc:	55                   	push   %rbp
+  800ecd:	48 89 e5             	mov    %rsp,%rbp
+  800ed0:	41 57                	push   %r15
+  800ed2:	41 56                	push   %r14
+  800ed4:	41 55                	push   %r13
+  800ed6:	41 54                	push   %r12
+  800ed8:	53                   	push   %rbx
+  800ed9:	48 83 ec 08          	sub    $0x8,%rsp
+  800edd:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800ee0:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800ee4:	45 84 ed             	test   %r13b,%r13b
+  800ee7:	75 12                	jne    800efb <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800ee9:	4c 89 f8             	mov    %r15,%rax
+  800eec:	48 83 c4 08          	add    $0x8,%rsp
+  800ef0:	5b                   	pop    %rbx
+  800ef1:	41 5c                	pop    %r12
+  800ef3:	41 5d                	pop    %r13
+  800ef5:	41 5e                	pop    %r14
+  800ef7:	41 5f                	pop    %r15
+  800ef9:	5d                   	pop    %rbp
+  800efa:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800efb:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800eff:	4c 89 e7             	mov    %r12,%rdi
+  800f02:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  800f09:	00 00 00 
+  800f0c:	ff d0                	call   *%rax
+  800f0e:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800f11:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800f15:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800f19:	49 bf 47 0e 80 00 00 	movabs $0x800e47,%r15
+  800f20:	00 00 00 
+				if ((sc = *s++) == 0)
+  800f23:	84 c0                	test   %al,%al
+  800f25:	75 14                	jne    800f3b <strstr+0x6f>
+					return NULL;
+  800f27:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800f2d:	eb ba                	jmp    800ee9 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800f2f:	48 83 c3 01          	add    $0x1,%rbx
+  800f33:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800f37:	84 c0                	test   %al,%al
+  800f39:	74 1b                	je     800f56 <strstr+0x8a>
+			} while (sc != c);
+  800f3b:	41 38 c5             	cmp    %al,%r13b
+  800f3e:	75 ef                	jne    800f2f <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800f40:	4c 89 f2             	mov    %r14,%rdx
+  800f43:	4c 89 e6             	mov    %r12,%rsi
+  800f46:	48 89 df             	mov    %rbx,%rdi
+  800f49:	41 ff d7             	call   *%r15
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	75 df                	jne    800f2f <strstr+0x63>
+  800f50:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800f54:	eb 93                	jmp    800ee9 <strstr+0x1d>
+					return NULL;
+  800f56:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800f5c:	eb 8b                	jmp    800ee9 <strstr+0x1d>
+
+0000000000800f5e <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800f5e:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800f60:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800f63:	8d 57 20             	lea    0x20(%rdi),%edx
+  800f66:	83 f9 1a             	cmp    $0x1a,%ecx
+  800f69:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800f6c:	c3                   	ret
+
+0000000000800f6d <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800f6d:	55                   	push   %rbp
+  800f6e:	48 89 e5             	mov    %rsp,%rbp
+  800f71:	41 57                	push   %r15
+  800f73:	41 56                	push   %r14
+  800f75:	41 55                	push   %r13
+  800f77:	41 54                	push   %r12
+  800f79:	53                   	push   %rbx
+  800f7a:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800f7e:	48 39 f7             	cmp    %rsi,%rdi
+  800f81:	74 49                	je     800fcc <strcasecmp+0x5f>
+  800f83:	49 89 fd             	mov    %rdi,%r13
+  800f86:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800f89:	49 bf 5e 0f 80 00 00 	movabs $0x800f5e,%r15
+  800f90:	00 00 00 
+  800f93:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800f98:	41 0f b6 fe          	movzbl %r14b,%edi
+  800f9c:	41 ff d7             	call   *%r15
+  800f9f:	89 c3                	mov    %eax,%ebx
+  800fa1:	49 83 c4 01          	add    $0x1,%r12
+  800fa5:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800fab:	41 ff d7             	call   *%r15
+  800fae:	29 c3                	sub    %eax,%ebx
+  800fb0:	75 09                	jne    800fbb <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800fb2:	49 83 c5 01          	add    $0x1,%r13
+  800fb6:	45 84 f6             	test   %r14b,%r14b
+  800fb9:	75 d8                	jne    800f93 <strcasecmp+0x26>
+}
+  800fbb:	89 d8                	mov    %ebx,%eax
+  800fbd:	48 83 c4 08          	add    $0x8,%rsp
+  800fc1:	5b                   	pop    %rbx
+  800fc2:	41 5c                	pop    %r12
+  800fc4:	41 5d                	pop    %r13
+  800fc6:	41 5e                	pop    %r14
+  800fc8:	41 5f                	pop    %r15
+  800fca:	5d                   	pop    %rbp
+  800fcb:	c3                   	ret
+        return 0;
+  800fcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd1:	eb e8                	jmp    800fbb <strcasecmp+0x4e>
+
+0000000000800fd3 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800fd3:	55                   	push   %rbp
+  800fd4:	48 89 e5             	mov    %rsp,%rbp
+  800fd7:	41 57                	push   %r15
+  800fd9:	41 56                	push   %r14
+  800fdb:	41 55                	push   %r13
+  800fdd:	41 54                	push   %r12
+  800fdf:	53                   	push   %rbx
+  800fe0:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800fe4:	48 85 d2             	test   %rdx,%rdx
+  800fe7:	74 4f                	je     801038 <strncasecmp+0x65>
+  800fe9:	49 89 fc             	mov    %rdi,%r12
+  800fec:	49 89 f5             	mov    %rsi,%r13
+  800fef:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800ff3:	49 be 5e 0f 80 00 00 	movabs $0x800f5e,%r14
+  800ffa:	00 00 00 
+  800ffd:	49 83 c4 01          	add    $0x1,%r12
+  801001:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801007:	41 ff d6             	call   *%r14
+  80100a:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  80100c:	49 83 c5 01          	add    $0x1,%r13
+  801010:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801015:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801018:	29 c3                	sub    %eax,%ebx
+  80101a:	85 c0                	test   %eax,%eax
+  80101c:	74 09                	je     801027 <strncasecmp+0x54>
+  80101e:	85 db                	test   %ebx,%ebx
+  801020:	75 05                	jne    801027 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  801022:	4d 39 fc             	cmp    %r15,%r12
+  801025:	75 d6                	jne    800ffd <strncasecmp+0x2a>
+}
+  801027:	89 d8                	mov    %ebx,%eax
+  801029:	48 83 c4 08          	add    $0x8,%rsp
+  80102d:	5b                   	pop    %rbx
+  80102e:	41 5c                	pop    %r12
+  801030:	41 5d                	pop    %r13
+  801032:	41 5e                	pop    %r14
+  801034:	41 5f                	pop    %r15
+  801036:	5d                   	pop    %rbp
+  801037:	c3                   	ret
+    int d = 0;
+  801038:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  80103d:	eb e8                	jmp    801027 <strncasecmp+0x54>
+
+000000000080103f <toupper>:
+
+int toupper(int c) {
+  80103f:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  801041:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801044:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801047:	83 f9 1a             	cmp    $0x1a,%ecx
+  80104a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80104d:	c3                   	ret
+
+000000000080104e <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  80104e:	83 ff 20             	cmp    $0x20,%edi
+  801051:	0f 94 c0             	sete   %al
+  801054:	0f b6 c0             	movzbl %al,%eax
+}
+  801057:	c3                   	ret
+
+0000000000801058 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  801058:	89 f8                	mov    %edi,%eax
+  80105a:	f7 d8                	neg    %eax
+  80105c:	0f 48 c7             	cmovs  %edi,%eax
+}
+  80105f:	c3                   	ret
+
+0000000000801060 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801060:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801063:	48 89 f8             	mov    %rdi,%rax
+  801066:	48 f7 d8             	neg    %rax
+  801069:	83 e0 07             	and    $0x7,%eax
+  80106c:	49 89 d1             	mov    %rdx,%r9
+  80106f:	49 29 c1             	sub    %rax,%r9
+  801072:	78 36                	js     8010aa <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801074:	40 0f b6 c6          	movzbl %sil,%eax
+  801078:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80107f:	01 01 01 
+  801082:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801086:	40 f6 c7 07          	test   $0x7,%dil
+  80108a:	75 38                	jne    8010c4 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80108c:	4c 89 c9             	mov    %r9,%rcx
+  80108f:	48 c1 f9 03          	sar    $0x3,%rcx
+  801093:	74 0c                	je     8010a1 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801095:	fc                   	cld
+  801096:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801099:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80109d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8010a1:	4d 85 c9             	test   %r9,%r9
+  8010a4:	75 45                	jne    8010eb <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8010a6:	4c 89 c0             	mov    %r8,%rax
+  8010a9:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8010aa:	48 85 d2             	test   %rdx,%rdx
+  8010ad:	74 f7                	je     8010a6 <memset+0x46>
+  8010af:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8010b2:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8010b5:	48 83 c0 01          	add    $0x1,%rax
+  8010b9:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8010bd:	48 39 c2             	cmp    %rax,%rdx
+  8010c0:	75 f3                	jne    8010b5 <memset+0x55>
+  8010c2:	eb e2                	jmp    8010a6 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8010c4:	40 f6 c7 01          	test   $0x1,%dil
+  8010c8:	74 06                	je     8010d0 <memset+0x70>
+  8010ca:	88 07                	mov    %al,(%rdi)
+  8010cc:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010d0:	40 f6 c7 02          	test   $0x2,%dil
+  8010d4:	74 07                	je     8010dd <memset+0x7d>
+  8010d6:	66 89 07             	mov    %ax,(%rdi)
+  8010d9:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010dd:	40 f6 c7 04          	test   $0x4,%dil
+  8010e1:	74 a9                	je     80108c <memset+0x2c>
+  8010e3:	89 07                	mov    %eax,(%rdi)
+  8010e5:	48 83 c7 04          	add    $0x4,%rdi
+  8010e9:	eb a1                	jmp    80108c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010eb:	41 f6 c1 04          	test   $0x4,%r9b
+  8010ef:	74 06                	je     8010f7 <memset+0x97>
+  8010f1:	89 07                	mov    %eax,(%rdi)
+  8010f3:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010f7:	41 f6 c1 02          	test   $0x2,%r9b
+  8010fb:	74 07                	je     801104 <memset+0xa4>
+  8010fd:	66 89 07             	mov    %ax,(%rdi)
+  801100:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801104:	41 f6 c1 01          	test   $0x1,%r9b
+  801108:	74 9c                	je     8010a6 <memset+0x46>
+  80110a:	88 07                	mov    %al,(%rdi)
+  80110c:	eb 98                	jmp    8010a6 <memset+0x46>
+
+000000000080110e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80110e:	48 89 f8             	mov    %rdi,%rax
+  801111:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801114:	48 39 fe             	cmp    %rdi,%rsi
+  801117:	73 3b                	jae    801154 <memmove+0x46>
+  801119:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80111d:	48 39 d7             	cmp    %rdx,%rdi
+  801120:	73 32                	jae    801154 <memmove+0x46>
+        s += n;
+        d += n;
+  801122:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801126:	48 89 d6             	mov    %rdx,%rsi
+  801129:	48 09 fe             	or     %rdi,%rsi
+  80112c:	48 09 ce             	or     %rcx,%rsi
+  80112f:	40 f6 c6 07          	test   $0x7,%sil
+  801133:	75 12                	jne    801147 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801135:	48 83 ef 08          	sub    $0x8,%rdi
+  801139:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80113d:	48 c1 e9 03          	shr    $0x3,%rcx
+  801141:	fd                   	std
+  801142:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801145:	fc                   	cld
+  801146:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801147:	48 83 ef 01          	sub    $0x1,%rdi
+  80114b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80114f:	fd                   	std
+  801150:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801152:	eb f1                	jmp    801145 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801154:	48 89 f2             	mov    %rsi,%rdx
+  801157:	48 09 c2             	or     %rax,%rdx
+  80115a:	48 09 ca             	or     %rcx,%rdx
+  80115d:	f6 c2 07             	test   $0x7,%dl
+  801160:	75 0c                	jne    80116e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801162:	48 c1 e9 03          	shr    $0x3,%rcx
+  801166:	48 89 c7             	mov    %rax,%rdi
+  801169:	fc                   	cld
+  80116a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80116d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80116e:	48 89 c7             	mov    %rax,%rdi
+  801171:	fc                   	cld
+  801172:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801174:	c3                   	ret
+
+0000000000801175 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801175:	55                   	push   %rbp
+  801176:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801179:	48 b8 0e 11 80 00 00 	movabs $0x80110e,%rax
+  801180:	00 00 00 
+  801183:	ff d0                	call   *%rax
+}
+  801185:	5d                   	pop    %rbp
+  801186:	c3                   	ret
+
+0000000000801187 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801187:	55                   	push   %rbp
+  801188:	48 89 e5             	mov    %rsp,%rbp
+  80118b:	41 57                	push   %r15
+  80118d:	41 56                	push   %r14
+  80118f:	41 55                	push   %r13
+  801191:	41 54                	push   %r12
+  801193:	53                   	push   %rbx
+  801194:	48 83 ec 08          	sub    $0x8,%rsp
+  801198:	49 89 fe             	mov    %rdi,%r14
+  80119b:	49 89 f7             	mov    %rsi,%r15
+  80119e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8011a1:	48 89 f7             	mov    %rsi,%rdi
+  8011a4:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  8011ab:	00 00 00 
+  8011ae:	ff d0                	call   *%rax
+  8011b0:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8011b3:	48 89 de             	mov    %rbx,%rsi
+  8011b6:	4c 89 f7             	mov    %r14,%rdi
+  8011b9:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  8011c0:	00 00 00 
+  8011c3:	ff d0                	call   *%rax
+  8011c5:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011c8:	48 39 c3             	cmp    %rax,%rbx
+  8011cb:	74 36                	je     801203 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8011cd:	48 89 d8             	mov    %rbx,%rax
+  8011d0:	4c 29 e8             	sub    %r13,%rax
+  8011d3:	49 39 c4             	cmp    %rax,%r12
+  8011d6:	73 31                	jae    801209 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8011d8:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011dd:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011e1:	4c 89 fe             	mov    %r15,%rsi
+  8011e4:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  8011eb:	00 00 00 
+  8011ee:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011f0:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011f4:	48 83 c4 08          	add    $0x8,%rsp
+  8011f8:	5b                   	pop    %rbx
+  8011f9:	41 5c                	pop    %r12
+  8011fb:	41 5d                	pop    %r13
+  8011fd:	41 5e                	pop    %r14
+  8011ff:	41 5f                	pop    %r15
+  801201:	5d                   	pop    %rbp
+  801202:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801203:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801207:	eb eb                	jmp    8011f4 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801209:	48 83 eb 01          	sub    $0x1,%rbx
+  80120d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801211:	48 89 da             	mov    %rbx,%rdx
+  801214:	4c 89 fe             	mov    %r15,%rsi
+  801217:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  80121e:	00 00 00 
+  801221:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801223:	49 01 de             	add    %rbx,%r14
+  801226:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80122b:	eb c3                	jmp    8011f0 <strlcat+0x69>
+
+000000000080122d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80122d:	48 85 d2             	test   %rdx,%rdx
+  801230:	74 2d                	je     80125f <memcmp+0x32>
+  801232:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801237:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80123b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801240:	44 38 c1             	cmp    %r8b,%cl
+  801243:	75 0f                	jne    801254 <memcmp+0x27>
+    while (n-- > 0) {
+  801245:	48 83 c0 01          	add    $0x1,%rax
+  801249:	48 39 c2             	cmp    %rax,%rdx
+  80124c:	75 e9                	jne    801237 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80124e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801253:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801254:	0f b6 c1             	movzbl %cl,%eax
+  801257:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80125b:	44 29 c0             	sub    %r8d,%eax
+  80125e:	c3                   	ret
+    return 0;
+  80125f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801264:	c3                   	ret
+
+0000000000801265 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801265:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801269:	48 39 c7             	cmp    %rax,%rdi
+  80126c:	73 0f                	jae    80127d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80126e:	40 38 37             	cmp    %sil,(%rdi)
+  801271:	74 0e                	je     801281 <memfind+0x1c>
+    for (; src < end; src++) {
+  801273:	48 83 c7 01          	add    $0x1,%rdi
+  801277:	48 39 f8             	cmp    %rdi,%rax
+  80127a:	75 f2                	jne    80126e <memfind+0x9>
+  80127c:	c3                   	ret
+  80127d:	48 89 f8             	mov    %rdi,%rax
+  801280:	c3                   	ret
+  801281:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801284:	c3                   	ret
+
+0000000000801285 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801285:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801288:	0f b6 37             	movzbl (%rdi),%esi
+  80128b:	40 80 fe 20          	cmp    $0x20,%sil
+  80128f:	74 06                	je     801297 <strtol+0x12>
+  801291:	40 80 fe 09          	cmp    $0x9,%sil
+  801295:	75 13                	jne    8012aa <strtol+0x25>
+  801297:	48 83 c7 01          	add    $0x1,%rdi
+  80129b:	0f b6 37             	movzbl (%rdi),%esi
+  80129e:	40 80 fe 20          	cmp    $0x20,%sil
+  8012a2:	74 f3                	je     801297 <strtol+0x12>
+  8012a4:	40 80 fe 09          	cmp    $0x9,%sil
+  8012a8:	74 ed                	je     801297 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8012aa:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8012ad:	83 e0 fd             	and    $0xfffffffd,%eax
+  8012b0:	3c 01                	cmp    $0x1,%al
+  8012b2:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012b6:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8012bc:	75 0f                	jne    8012cd <strtol+0x48>
+  8012be:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8012c1:	74 14                	je     8012d7 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8012c3:	85 d2                	test   %edx,%edx
+  8012c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012ca:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8012cd:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8012d2:	4c 63 ca             	movslq %edx,%r9
+  8012d5:	eb 36                	jmp    80130d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012d7:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012db:	74 0f                	je     8012ec <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012dd:	85 d2                	test   %edx,%edx
+  8012df:	75 ec                	jne    8012cd <strtol+0x48>
+        s++;
+  8012e1:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012e5:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012ea:	eb e1                	jmp    8012cd <strtol+0x48>
+        s += 2;
+  8012ec:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012f0:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012f5:	eb d6                	jmp    8012cd <strtol+0x48>
+            dig -= '0';
+  8012f7:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012fa:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012fe:	41 39 d0             	cmp    %edx,%r8d
+  801301:	7d 21                	jge    801324 <strtol+0x9f>
+        val = val * base + dig;
+  801303:	49 0f af c1          	imul   %r9,%rax
+  801307:	0f b6 c9             	movzbl %cl,%ecx
+  80130a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80130d:	48 83 c7 01          	add    $0x1,%rdi
+  801311:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801315:	80 f9 39             	cmp    $0x39,%cl
+  801318:	76 dd                	jbe    8012f7 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80131a:	80 f9 7b             	cmp    $0x7b,%cl
+  80131d:	77 05                	ja     801324 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80131f:	83 e9 57             	sub    $0x57,%ecx
+  801322:	eb d6                	jmp    8012fa <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801324:	4d 85 d2             	test   %r10,%r10
+  801327:	74 03                	je     80132c <strtol+0xa7>
+  801329:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80132c:	48 89 c2             	mov    %rax,%rdx
+  80132f:	48 f7 da             	neg    %rdx
+  801332:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801336:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80133a:	c3                   	ret
+
+000000000080133b <atoi>:
+int atoi(const char *str) {
+  80133b:	55                   	push   %rbp
+  80133c:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  80133f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801344:	be 00 00 00 00       	mov    $0x0,%esi
+  801349:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  801350:	00 00 00 
+  801353:	ff d0                	call   *%rax
+}
+  801355:	5d                   	pop    %rbp
+  801356:	c3                   	ret
+
+0000000000801357 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801357:	55                   	push   %rbp
+  801358:	48 89 e5             	mov    %rsp,%rbp
+  80135b:	53                   	push   %rbx
+  80135c:	48 89 fa             	mov    %rdi,%rdx
+  80135f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801362:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801367:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801371:	be 00 00 00 00       	mov    $0x0,%esi
+  801376:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80137e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801382:	c9                   	leave
+  801383:	c3                   	ret
+
+0000000000801384 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+  801388:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801389:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80138e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801393:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801398:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ad:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b3:	c9                   	leave
+  8013b4:	c3                   	ret
+
+00000000008013b5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8013b5:	55                   	push   %rbp
+  8013b6:	48 89 e5             	mov    %rsp,%rbp
+  8013b9:	53                   	push   %rbx
+  8013ba:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8013be:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c1:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e2:	48 85 c0             	test   %rax,%rax
+  8013e5:	7f 06                	jg     8013ed <sys_env_destroy+0x38>
+}
+  8013e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013eb:	c9                   	leave
+  8013ec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ed:	49 89 c0             	mov    %rax,%r8
+  8013f0:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013f5:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  8013fc:	00 00 00 
+  8013ff:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801404:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  80140b:	00 00 00 
+  80140e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801413:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  80141a:	00 00 00 
+  80141d:	41 ff d1             	call   *%r9
+
+0000000000801420 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801420:	55                   	push   %rbp
+  801421:	48 89 e5             	mov    %rsp,%rbp
+  801424:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801425:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80142a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801434:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801439:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143e:	be 00 00 00 00       	mov    $0x0,%esi
+  801443:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801449:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80144b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144f:	c9                   	leave
+  801450:	c3                   	ret
+
+0000000000801451 <sys_yield>:
+
+void
+sys_yield(void) {
+  801451:	55                   	push   %rbp
+  801452:	48 89 e5             	mov    %rsp,%rbp
+  801455:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801456:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80145b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801460:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801465:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146f:	be 00 00 00 00       	mov    $0x0,%esi
+  801474:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80147a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80147c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801480:	c9                   	leave
+  801481:	c3                   	ret
+
+0000000000801482 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801482:	55                   	push   %rbp
+  801483:	48 89 e5             	mov    %rsp,%rbp
+  801486:	53                   	push   %rbx
+  801487:	48 89 fa             	mov    %rdi,%rdx
+  80148a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80148d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801492:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801499:	00 00 00 
+  80149c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ac:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8014ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b2:	c9                   	leave
+  8014b3:	c3                   	ret
+
+00000000008014b4 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8014b4:	55                   	push   %rbp
+  8014b5:	48 89 e5             	mov    %rsp,%rbp
+  8014b8:	53                   	push   %rbx
+  8014b9:	49 89 f8             	mov    %rdi,%r8
+  8014bc:	48 89 d3             	mov    %rdx,%rbx
+  8014bf:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c7:	4c 89 c2             	mov    %r8,%rdx
+  8014ca:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014de:	c9                   	leave
+  8014df:	c3                   	ret
+
+00000000008014e0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014e0:	55                   	push   %rbp
+  8014e1:	48 89 e5             	mov    %rsp,%rbp
+  8014e4:	53                   	push   %rbx
+  8014e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e9:	89 f8                	mov    %edi,%eax
+  8014eb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014ee:	48 63 f9             	movslq %ecx,%rdi
+  8014f1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014f9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801501:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801507:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801509:	48 85 c0             	test   %rax,%rax
+  80150c:	7f 06                	jg     801514 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80150e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801512:	c9                   	leave
+  801513:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801514:	49 89 c0             	mov    %rax,%r8
+  801517:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80151c:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  801523:	00 00 00 
+  801526:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80152b:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801532:	00 00 00 
+  801535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153a:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  801541:	00 00 00 
+  801544:	41 ff d1             	call   *%r9
+
+0000000000801547 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801547:	55                   	push   %rbp
+  801548:	48 89 e5             	mov    %rsp,%rbp
+  80154b:	53                   	push   %rbx
+  80154c:	48 83 ec 08          	sub    $0x8,%rsp
+  801550:	89 f8                	mov    %edi,%eax
+  801552:	49 89 f2             	mov    %rsi,%r10
+  801555:	48 89 cf             	mov    %rcx,%rdi
+  801558:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80155b:	48 63 da             	movslq %edx,%rbx
+  80155e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801561:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801566:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801569:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80156c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80156e:	48 85 c0             	test   %rax,%rax
+  801571:	7f 06                	jg     801579 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801573:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801577:	c9                   	leave
+  801578:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801579:	49 89 c0             	mov    %rax,%r8
+  80157c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801581:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  801588:	00 00 00 
+  80158b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801590:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801597:	00 00 00 
+  80159a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159f:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  8015a6:	00 00 00 
+  8015a9:	41 ff d1             	call   *%r9
+
+00000000008015ac <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015ac:	55                   	push   %rbp
+  8015ad:	48 89 e5             	mov    %rsp,%rbp
+  8015b0:	53                   	push   %rbx
+  8015b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b5:	49 89 f9             	mov    %rdi,%r9
+  8015b8:	89 f0                	mov    %esi,%eax
+  8015ba:	48 89 d3             	mov    %rdx,%rbx
+  8015bd:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8015c0:	49 63 f0             	movslq %r8d,%rsi
+  8015c3:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015cb:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015d6:	48 85 c0             	test   %rax,%rax
+  8015d9:	7f 06                	jg     8015e1 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015df:	c9                   	leave
+  8015e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e1:	49 89 c0             	mov    %rax,%r8
+  8015e4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015e9:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  8015f0:	00 00 00 
+  8015f3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015f8:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  8015ff:	00 00 00 
+  801602:	b8 00 00 00 00       	mov    $0x0,%eax
+  801607:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  80160e:	00 00 00 
+  801611:	41 ff d1             	call   *%r9
+
+0000000000801614 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801614:	55                   	push   %rbp
+  801615:	48 89 e5             	mov    %rsp,%rbp
+  801618:	53                   	push   %rbx
+  801619:	89 f8                	mov    %edi,%eax
+  80161b:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80161e:	48 63 f9             	movslq %ecx,%rdi
+  801621:	48 63 da             	movslq %edx,%rbx
+  801624:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801627:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80162c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162f:	be 00 00 00 00       	mov    $0x0,%esi
+  801634:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163a:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80163c:	89 c2                	mov    %eax,%edx
+  80163e:	48 85 c0             	test   %rax,%rax
+  801641:	78 0d                	js     801650 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801643:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801648:	4d 85 c9             	test   %r9,%r9
+  80164b:	74 03                	je     801650 <sys_alloc_dma_region+0x3c>
+  80164d:	49 89 01             	mov    %rax,(%r9)
+}
+  801650:	89 d0                	mov    %edx,%eax
+  801652:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801656:	c9                   	leave
+  801657:	c3                   	ret
+
+0000000000801658 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801658:	55                   	push   %rbp
+  801659:	48 89 e5             	mov    %rsp,%rbp
+  80165c:	53                   	push   %rbx
+  80165d:	48 83 ec 08          	sub    $0x8,%rsp
+  801661:	48 89 f1             	mov    %rsi,%rcx
+  801664:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801667:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80166a:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80166f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801674:	be 00 00 00 00       	mov    $0x0,%esi
+  801679:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80167f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801681:	48 85 c0             	test   %rax,%rax
+  801684:	7f 06                	jg     80168c <sys_set_cache_region+0x34>
+}
+  801686:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80168a:	c9                   	leave
+  80168b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80168c:	49 89 c0             	mov    %rax,%r8
+  80168f:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801694:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  80169b:	00 00 00 
+  80169e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016a3:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  8016aa:	00 00 00 
+  8016ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b2:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  8016b9:	00 00 00 
+  8016bc:	41 ff d1             	call   *%r9
+
+00000000008016bf <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8016bf:	55                   	push   %rbp
+  8016c0:	48 89 e5             	mov    %rsp,%rbp
+  8016c3:	53                   	push   %rbx
+  8016c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c8:	48 89 f1             	mov    %rsi,%rcx
+  8016cb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8016ce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d1:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016db:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e8:	48 85 c0             	test   %rax,%rax
+  8016eb:	7f 06                	jg     8016f3 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8016ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f1:	c9                   	leave
+  8016f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f3:	49 89 c0             	mov    %rax,%r8
+  8016f6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8016fb:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  801702:	00 00 00 
+  801705:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80170a:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801711:	00 00 00 
+  801714:	b8 00 00 00 00       	mov    $0x0,%eax
+  801719:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  801720:	00 00 00 
+  801723:	41 ff d1             	call   *%r9
+
+0000000000801726 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801726:	55                   	push   %rbp
+  801727:	48 89 e5             	mov    %rsp,%rbp
+  80172a:	53                   	push   %rbx
+  80172b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80172f:	48 63 ce             	movslq %esi,%rcx
+  801732:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801735:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80173a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801744:	be 00 00 00 00       	mov    $0x0,%esi
+  801749:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80174f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801751:	48 85 c0             	test   %rax,%rax
+  801754:	7f 06                	jg     80175c <sys_env_set_status+0x36>
+}
+  801756:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80175a:	c9                   	leave
+  80175b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80175c:	49 89 c0             	mov    %rax,%r8
+  80175f:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801764:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  80176b:	00 00 00 
+  80176e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801773:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  80177a:	00 00 00 
+  80177d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801782:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  801789:	00 00 00 
+  80178c:	41 ff d1             	call   *%r9
+
+000000000080178f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80178f:	55                   	push   %rbp
+  801790:	48 89 e5             	mov    %rsp,%rbp
+  801793:	53                   	push   %rbx
+  801794:	48 83 ec 08          	sub    $0x8,%rsp
+  801798:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80179b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80179e:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ba:	48 85 c0             	test   %rax,%rax
+  8017bd:	7f 06                	jg     8017c5 <sys_env_set_trapframe+0x36>
+}
+  8017bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c3:	c9                   	leave
+  8017c4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c5:	49 89 c0             	mov    %rax,%r8
+  8017c8:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8017cd:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  8017d4:	00 00 00 
+  8017d7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017dc:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  8017e3:	00 00 00 
+  8017e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017eb:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  8017f2:	00 00 00 
+  8017f5:	41 ff d1             	call   *%r9
+
+00000000008017f8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017f8:	55                   	push   %rbp
+  8017f9:	48 89 e5             	mov    %rsp,%rbp
+  8017fc:	53                   	push   %rbx
+  8017fd:	48 83 ec 08          	sub    $0x8,%rsp
+  801801:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801804:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801807:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801811:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801816:	be 00 00 00 00       	mov    $0x0,%esi
+  80181b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801821:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801823:	48 85 c0             	test   %rax,%rax
+  801826:	7f 06                	jg     80182e <sys_env_set_pgfault_upcall+0x36>
+}
+  801828:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182c:	c9                   	leave
+  80182d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80182e:	49 89 c0             	mov    %rax,%r8
+  801831:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801836:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  80183d:	00 00 00 
+  801840:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801845:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  80184c:	00 00 00 
+  80184f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801854:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  80185b:	00 00 00 
+  80185e:	41 ff d1             	call   *%r9
+
+0000000000801861 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801861:	55                   	push   %rbp
+  801862:	48 89 e5             	mov    %rsp,%rbp
+  801865:	53                   	push   %rbx
+  801866:	89 f8                	mov    %edi,%eax
+  801868:	49 89 f1             	mov    %rsi,%r9
+  80186b:	48 89 d3             	mov    %rdx,%rbx
+  80186e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801871:	49 63 f0             	movslq %r8d,%rsi
+  801874:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801877:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80187c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801885:	cd 30                	int    $0x30
+}
+  801887:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188b:	c9                   	leave
+  80188c:	c3                   	ret
+
+000000000080188d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80188d:	55                   	push   %rbp
+  80188e:	48 89 e5             	mov    %rsp,%rbp
+  801891:	53                   	push   %rbx
+  801892:	48 83 ec 08          	sub    $0x8,%rsp
+  801896:	48 89 fa             	mov    %rdi,%rdx
+  801899:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80189c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018b8:	48 85 c0             	test   %rax,%rax
+  8018bb:	7f 06                	jg     8018c3 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c1:	c9                   	leave
+  8018c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018c3:	49 89 c0             	mov    %rax,%r8
+  8018c6:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8018cb:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  8018d2:	00 00 00 
+  8018d5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018da:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  8018e1:	00 00 00 
+  8018e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e9:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  8018f0:	00 00 00 
+  8018f3:	41 ff d1             	call   *%r9
+
+00000000008018f6 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8018f6:	55                   	push   %rbp
+  8018f7:	48 89 e5             	mov    %rsp,%rbp
+  8018fa:	53                   	push   %rbx
+  8018fb:	48 89 fa             	mov    %rdi,%rdx
+  8018fe:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801901:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801906:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80190b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801910:	be 00 00 00 00       	mov    $0x0,%esi
+  801915:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80191b:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80191d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801921:	c9                   	leave
+  801922:	c3                   	ret
+
+0000000000801923 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801923:	55                   	push   %rbp
+  801924:	48 89 e5             	mov    %rsp,%rbp
+  801927:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801928:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80192d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801932:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801937:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80193c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801941:	be 00 00 00 00       	mov    $0x0,%esi
+  801946:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80194c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80194e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801952:	c9                   	leave
+  801953:	c3                   	ret
+
+0000000000801954 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801954:	48 85 ff             	test   %rdi,%rdi
+  801957:	0f 84 b6 01 00 00    	je     801b13 <malloc+0x1bf>
+malloc(size_t size) {
+  80195d:	55                   	push   %rbp
+  80195e:	48 89 e5             	mov    %rsp,%rbp
+  801961:	41 56                	push   %r14
+  801963:	41 55                	push   %r13
+  801965:	41 54                	push   %r12
+  801967:	53                   	push   %rbx
+  801968:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80196b:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801972:	00 00 00 
+  801975:	4c 8b 20             	mov    (%rax),%r12
+  801978:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80197f:	0f 87 94 01 00 00    	ja     801b19 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801985:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80198c:	00 00 00 
+  80198f:	48 85 c0             	test   %rax,%rax
+  801992:	74 6b                	je     8019ff <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801994:	4d 85 e4             	test   %r12,%r12
+  801997:	74 66                	je     8019ff <malloc+0xab>
+  801999:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  8019a0:	00 00 00 
+  8019a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019a8:	eb 0d                	jmp    8019b7 <malloc+0x63>
+  8019aa:	48 83 c1 01          	add    $0x1,%rcx
+  8019ae:	48 83 c2 18          	add    $0x18,%rdx
+  8019b2:	49 39 cc             	cmp    %rcx,%r12
+  8019b5:	74 48                	je     8019ff <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  8019b7:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  8019bc:	74 ec                	je     8019aa <malloc+0x56>
+  8019be:	48 39 1a             	cmp    %rbx,(%rdx)
+  8019c1:	72 e7                	jb     8019aa <malloc+0x56>
+                real_freep_size--;
+  8019c3:	48 83 e8 01          	sub    $0x1,%rax
+  8019c7:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  8019ce:	00 00 00 
+                freep[i].is_free = false;
+  8019d1:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8019d8:	00 00 00 
+  8019db:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8019df:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8019e3:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8019e7:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8019ee:	00 
+                freep[i].size = size;
+  8019ef:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8019f3:	48 01 c8             	add    %rcx,%rax
+  8019f6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019fa:	e9 0b 01 00 00       	jmp    801b0a <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8019ff:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801a06:	00 00 00 
+  801a09:	48 01 d8             	add    %rbx,%rax
+  801a0c:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801a12:	76 7c                	jbe    801a90 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801a14:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801a1b:	00 00 00 
+  801a1e:	4c 8b 30             	mov    (%rax),%r14
+  801a21:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801a28:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801a2b:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801a32:	00 00 00 
+  801a35:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801a3c:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801a43:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801a49:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801a4d:	48 b8 20 14 80 00 00 	movabs $0x801420,%rax
+  801a54:	00 00 00 
+  801a57:	ff d0                	call   *%rax
+  801a59:	89 c7                	mov    %eax,%edi
+  801a5b:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801a62:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801a69:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801a70:	00 00 00 
+  801a73:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801a77:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801a7c:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  801a83:	00 00 00 
+  801a86:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801a88:	85 c0                	test   %eax,%eax
+  801a8a:	0f 88 90 00 00 00    	js     801b20 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801a90:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801a97:	00 00 00 
+  801a9a:	48 8b 31             	mov    (%rcx),%rsi
+  801a9d:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801aa4:	00 00 00 
+  801aa7:	4c 8b 07             	mov    (%rdi),%r8
+  801aaa:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801aae:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801ab5:	00 00 00 
+  801ab8:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801abc:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801ac0:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801ac7:	00 00 00 
+  801aca:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801ace:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801ad1:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801ad5:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801adc:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801add:	48 89 d8             	mov    %rbx,%rax
+  801ae0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ae5:	4c 01 c0             	add    %r8,%rax
+  801ae8:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801aeb:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801af2:	48 01 f3             	add    %rsi,%rbx
+  801af5:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801af8:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801afd:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801b04:	00 00 00 
+  801b07:	48 89 d0             	mov    %rdx,%rax
+}
+  801b0a:	5b                   	pop    %rbx
+  801b0b:	41 5c                	pop    %r12
+  801b0d:	41 5d                	pop    %r13
+  801b0f:	41 5e                	pop    %r14
+  801b11:	5d                   	pop    %rbp
+  801b12:	c3                   	ret
+        return NULL;
+  801b13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b18:	c3                   	ret
+        return NULL;
+  801b19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1e:	eb ea                	jmp    801b0a <malloc+0x1b6>
+            return NULL;
+  801b20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b25:	eb e3                	jmp    801b0a <malloc+0x1b6>
+
+0000000000801b27 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801b27:	55                   	push   %rbp
+  801b28:	48 89 e5             	mov    %rsp,%rbp
+  801b2b:	53                   	push   %rbx
+  801b2c:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801b30:	48 89 fb             	mov    %rdi,%rbx
+  801b33:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801b37:	48 89 df             	mov    %rbx,%rdi
+  801b3a:	48 b8 54 19 80 00 00 	movabs $0x801954,%rax
+  801b41:	00 00 00 
+  801b44:	ff d0                	call   *%rax
+  801b46:	48 89 c7             	mov    %rax,%rdi
+  801b49:	48 89 da             	mov    %rbx,%rdx
+  801b4c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b51:	48 b8 60 10 80 00 00 	movabs $0x801060,%rax
+  801b58:	00 00 00 
+  801b5b:	ff d0                	call   *%rax
+}
+  801b5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b61:	c9                   	leave
+  801b62:	c3                   	ret
+
+0000000000801b63 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801b63:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801b6a:	00 00 00 
+  801b6d:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801b74:	00 00 00 
+  801b77:	48 3b 02             	cmp    (%rdx),%rax
+  801b7a:	74 4d                	je     801bc9 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801b7c:	48 85 c0             	test   %rax,%rax
+  801b7f:	74 4d                	je     801bce <get_allocsize+0x6b>
+  801b81:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801b88:	00 00 00 
+  801b8b:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801b90:	48 3b 39             	cmp    (%rcx),%rdi
+  801b93:	74 13                	je     801ba8 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801b95:	48 83 c2 01          	add    $0x1,%rdx
+  801b99:	48 83 c1 18          	add    $0x18,%rcx
+  801b9d:	48 39 d0             	cmp    %rdx,%rax
+  801ba0:	75 ee                	jne    801b90 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba7:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801ba8:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb1:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801bb8:	00 00 00 
+  801bbb:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801bc1:	75 0b                	jne    801bce <get_allocsize+0x6b>
+  801bc3:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801bc8:	c3                   	ret
+        return 0;
+  801bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bce:	c3                   	ret
+
+0000000000801bcf <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801bcf:	48 85 ff             	test   %rdi,%rdi
+  801bd2:	0f 84 01 01 00 00    	je     801cd9 <free+0x10a>
+free(void *ptr) {
+  801bd8:	55                   	push   %rbp
+  801bd9:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801bdc:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801be3:	00 00 00 
+  801be6:	48 8b 30             	mov    (%rax),%rsi
+  801be9:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801bf0:	00 00 00 
+  801bf3:	48 39 c6             	cmp    %rax,%rsi
+  801bf6:	74 50                	je     801c48 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801bf8:	48 85 f6             	test   %rsi,%rsi
+  801bfb:	74 21                	je     801c1e <free+0x4f>
+  801bfd:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801c04:	00 00 00 
+  801c07:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801c0c:	48 3b 39             	cmp    (%rcx),%rdi
+  801c0f:	74 61                	je     801c72 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801c11:	48 83 c2 01          	add    $0x1,%rdx
+  801c15:	48 83 c1 18          	add    $0x18,%rcx
+  801c19:	48 39 d6             	cmp    %rdx,%rsi
+  801c1c:	75 ee                	jne    801c0c <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801c1e:	48 ba 90 56 80 00 00 	movabs $0x805690,%rdx
+  801c25:	00 00 00 
+  801c28:	be 12 01 00 00       	mov    $0x112,%esi
+  801c2d:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801c34:	00 00 00 
+  801c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3c:	48 b9 b8 02 80 00 00 	movabs $0x8002b8,%rcx
+  801c43:	00 00 00 
+  801c46:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801c48:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  801c4f:	00 00 00 
+  801c52:	be 06 01 00 00       	mov    $0x106,%esi
+  801c57:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801c5e:	00 00 00 
+  801c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c66:	48 b9 b8 02 80 00 00 	movabs $0x8002b8,%rcx
+  801c6d:	00 00 00 
+  801c70:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801c72:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c76:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801c7d:	00 00 00 
+  801c80:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801c86:	75 27                	jne    801caf <free+0xe0>
+            freep[i].is_free = true;
+  801c88:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c8c:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801c93:	00 00 00 
+  801c96:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801c9d:	00 00 
+            real_freep_size++;
+  801c9f:	48 83 c0 01          	add    $0x1,%rax
+  801ca3:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801caa:	00 00 00 
+}
+  801cad:	5d                   	pop    %rbp
+  801cae:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801caf:	48 ba 68 56 80 00 00 	movabs $0x805668,%rdx
+  801cb6:	00 00 00 
+  801cb9:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801cbe:	48 bf b8 56 80 00 00 	movabs $0x8056b8,%rdi
+  801cc5:	00 00 00 
+  801cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccd:	48 b9 b8 02 80 00 00 	movabs $0x8002b8,%rcx
+  801cd4:	00 00 00 
+  801cd7:	ff d1                	call   *%rcx
+  801cd9:	c3                   	ret
+
+0000000000801cda <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801cda:	55                   	push   %rbp
+  801cdb:	48 89 e5             	mov    %rsp,%rbp
+  801cde:	41 55                	push   %r13
+  801ce0:	41 54                	push   %r12
+  801ce2:	53                   	push   %rbx
+  801ce3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ce7:	48 89 fb             	mov    %rdi,%rbx
+  801cea:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801ced:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  801cf4:	00 00 00 
+  801cf7:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801cf9:	49 39 c5             	cmp    %rax,%r13
+  801cfc:	73 0e                	jae    801d0c <realloc+0x32>
+}
+  801cfe:	48 89 d8             	mov    %rbx,%rax
+  801d01:	48 83 c4 08          	add    $0x8,%rsp
+  801d05:	5b                   	pop    %rbx
+  801d06:	41 5c                	pop    %r12
+  801d08:	41 5d                	pop    %r13
+  801d0a:	5d                   	pop    %rbp
+  801d0b:	c3                   	ret
+  801d0c:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801d0f:	4c 89 ef             	mov    %r13,%rdi
+  801d12:	48 b8 54 19 80 00 00 	movabs $0x801954,%rax
+  801d19:	00 00 00 
+  801d1c:	ff d0                	call   *%rax
+  801d1e:	48 89 c7             	mov    %rax,%rdi
+  801d21:	4c 89 e2             	mov    %r12,%rdx
+  801d24:	48 89 de             	mov    %rbx,%rsi
+  801d27:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  801d2e:	00 00 00 
+  801d31:	ff d0                	call   *%rax
+  801d33:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801d36:	48 89 df             	mov    %rbx,%rdi
+  801d39:	48 b8 cf 1b 80 00 00 	movabs $0x801bcf,%rax
+  801d40:	00 00 00 
+  801d43:	ff d0                	call   *%rax
+    return newptr;
+  801d45:	4c 89 e3             	mov    %r12,%rbx
+  801d48:	eb b4                	jmp    801cfe <realloc+0x24>
+
+0000000000801d4a <strdup>:
+
+char*
+strdup (const char *src) {
+  801d4a:	55                   	push   %rbp
+  801d4b:	48 89 e5             	mov    %rsp,%rbp
+  801d4e:	41 54                	push   %r12
+  801d50:	53                   	push   %rbx
+  801d51:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801d54:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  801d5b:	00 00 00 
+  801d5e:	ff d0                	call   *%rax
+  801d60:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801d64:	4c 89 e7             	mov    %r12,%rdi
+  801d67:	48 b8 54 19 80 00 00 	movabs $0x801954,%rax
+  801d6e:	00 00 00 
+  801d71:	ff d0                	call   *%rax
+  801d73:	48 89 c7             	mov    %rax,%rdi
+  801d76:	4c 89 e2             	mov    %r12,%rdx
+  801d79:	48 89 de             	mov    %rbx,%rsi
+  801d7c:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  801d83:	00 00 00 
+  801d86:	ff d0                	call   *%rax
+}
+  801d88:	5b                   	pop    %rbx
+  801d89:	41 5c                	pop    %r12
+  801d8b:	5d                   	pop    %rbp
+  801d8c:	c3                   	ret
+
+0000000000801d8d <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801d8d:	55                   	push   %rbp
+  801d8e:	48 89 e5             	mov    %rsp,%rbp
+  801d91:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d92:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801da1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801da6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dab:	be 00 00 00 00       	mov    $0x0,%esi
+  801db0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801db6:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801db8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dbc:	c9                   	leave
+  801dbd:	c3                   	ret
+
+0000000000801dbe <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801dbe:	55                   	push   %rbp
+  801dbf:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801dc2:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801dc9:	00 00 00 
+  801dcc:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801dd0:	74 26                	je     801df8 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801dd2:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801dd4:	48 c1 e2 20          	shl    $0x20,%rdx
+  801dd8:	89 c0                	mov    %eax,%eax
+  801dda:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801ddd:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801de4:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801deb:	00 00 00 
+  801dee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df3:	48 f7 31             	divq   (%rcx)
+}
+  801df6:	5d                   	pop    %rbp
+  801df7:	c3                   	ret
+        freq = get_cpufreq();
+  801df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dfd:	48 ba 8d 1d 80 00 00 	movabs $0x801d8d,%rdx
+  801e04:	00 00 00 
+  801e07:	ff d2                	call   *%rdx
+  801e09:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801e10:	00 00 00 
+  801e13:	eb bd                	jmp    801dd2 <get_ticks+0x14>
+
+0000000000801e15 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801e15:	55                   	push   %rbp
+  801e16:	48 89 e5             	mov    %rsp,%rbp
+  801e19:	53                   	push   %rbx
+  801e1a:	48 83 ec 08          	sub    $0x8,%rsp
+  801e1e:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801e21:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801e28:	00 00 00 
+  801e2b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801e2f:	74 50                	je     801e81 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801e31:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801e33:	48 c1 e2 20          	shl    $0x20,%rdx
+  801e37:	89 c0                	mov    %eax,%eax
+  801e39:	48 89 d6             	mov    %rdx,%rsi
+  801e3c:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801e3f:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801e46:	00 00 00 
+  801e49:	48 0f af 18          	imul   (%rax),%rbx
+  801e4d:	48 c1 eb 03          	shr    $0x3,%rbx
+  801e51:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801e58:	9b c4 20 
+  801e5b:	48 89 d8             	mov    %rbx,%rax
+  801e5e:	48 f7 e2             	mul    %rdx
+  801e61:	48 89 d1             	mov    %rdx,%rcx
+  801e64:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801e68:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801e6a:	48 c1 e2 20          	shl    $0x20,%rdx
+  801e6e:	89 c0                	mov    %eax,%eax
+  801e70:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801e73:	48 29 f2             	sub    %rsi,%rdx
+  801e76:	48 39 ca             	cmp    %rcx,%rdx
+  801e79:	72 ed                	jb     801e68 <sleep+0x53>
+}
+  801e7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e7f:	c9                   	leave
+  801e80:	c3                   	ret
+        freq = get_cpufreq();
+  801e81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e86:	48 ba 8d 1d 80 00 00 	movabs $0x801d8d,%rdx
+  801e8d:	00 00 00 
+  801e90:	ff d2                	call   *%rdx
+  801e92:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801e99:	00 00 00 
+  801e9c:	eb 93                	jmp    801e31 <sleep+0x1c>
+
+0000000000801e9e <poll_kbd>:
+
+int poll_kbd() {
+  801e9e:	55                   	push   %rbp
+  801e9f:	48 89 e5             	mov    %rsp,%rbp
+  801ea2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ea3:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ea8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ead:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801eb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eb7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ebc:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ec7:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ec9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ecd:	c9                   	leave
+  801ece:	c3                   	ret
+
+0000000000801ecf <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801ecf:	55                   	push   %rbp
+  801ed0:	48 89 e5             	mov    %rsp,%rbp
+  801ed3:	53                   	push   %rbx
+  801ed4:	49 89 fa             	mov    %rdi,%r10
+  801ed7:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801ed9:	44 89 c6             	mov    %r8d,%esi
+  801edc:	89 cf                	mov    %ecx,%edi
+  801ede:	89 d3                	mov    %edx,%ebx
+  801ee0:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801ee2:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ee7:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801eea:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801eee:	cd 30                	int    $0x30
+  801ef0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef4:	c9                   	leave
+  801ef5:	c3                   	ret
+
+0000000000801ef6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ef6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801efd:	ff ff ff 
+  801f00:	48 01 f8             	add    %rdi,%rax
+  801f03:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801f07:	c3                   	ret
+
+0000000000801f08 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f08:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801f0f:	ff ff ff 
+  801f12:	48 01 f8             	add    %rdi,%rax
+  801f15:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801f19:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801f1f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801f23:	c3                   	ret
+
+0000000000801f24 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801f24:	55                   	push   %rbp
+  801f25:	48 89 e5             	mov    %rsp,%rbp
+  801f28:	41 57                	push   %r15
+  801f2a:	41 56                	push   %r14
+  801f2c:	41 55                	push   %r13
+  801f2e:	41 54                	push   %r12
+  801f30:	53                   	push   %rbx
+  801f31:	48 83 ec 08          	sub    $0x8,%rsp
+  801f35:	49 89 ff             	mov    %rdi,%r15
+  801f38:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801f3d:	49 bd 5f 46 80 00 00 	movabs $0x80465f,%r13
+  801f44:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801f47:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801f4d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801f50:	48 89 df             	mov    %rbx,%rdi
+  801f53:	41 ff d5             	call   *%r13
+  801f56:	83 e0 04             	and    $0x4,%eax
+  801f59:	74 17                	je     801f72 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801f5b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801f62:	4c 39 f3             	cmp    %r14,%rbx
+  801f65:	75 e6                	jne    801f4d <fd_alloc+0x29>
+  801f67:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801f6d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801f72:	4d 89 27             	mov    %r12,(%r15)
+}
+  801f75:	48 83 c4 08          	add    $0x8,%rsp
+  801f79:	5b                   	pop    %rbx
+  801f7a:	41 5c                	pop    %r12
+  801f7c:	41 5d                	pop    %r13
+  801f7e:	41 5e                	pop    %r14
+  801f80:	41 5f                	pop    %r15
+  801f82:	5d                   	pop    %rbp
+  801f83:	c3                   	ret
+
+0000000000801f84 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801f84:	83 ff 1f             	cmp    $0x1f,%edi
+  801f87:	77 39                	ja     801fc2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801f89:	55                   	push   %rbp
+  801f8a:	48 89 e5             	mov    %rsp,%rbp
+  801f8d:	41 54                	push   %r12
+  801f8f:	53                   	push   %rbx
+  801f90:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801f93:	48 63 df             	movslq %edi,%rbx
+  801f96:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801f9d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801fa1:	48 89 df             	mov    %rbx,%rdi
+  801fa4:	48 b8 5f 46 80 00 00 	movabs $0x80465f,%rax
+  801fab:	00 00 00 
+  801fae:	ff d0                	call   *%rax
+  801fb0:	a8 04                	test   $0x4,%al
+  801fb2:	74 14                	je     801fc8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801fb4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fbd:	5b                   	pop    %rbx
+  801fbe:	41 5c                	pop    %r12
+  801fc0:	5d                   	pop    %rbp
+  801fc1:	c3                   	ret
+        return -E_INVAL;
+  801fc2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801fc7:	c3                   	ret
+        return -E_INVAL;
+  801fc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fcd:	eb ee                	jmp    801fbd <fd_lookup+0x39>
+
+0000000000801fcf <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801fcf:	55                   	push   %rbp
+  801fd0:	48 89 e5             	mov    %rsp,%rbp
+  801fd3:	41 54                	push   %r12
+  801fd5:	53                   	push   %rbx
+  801fd6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801fd9:	48 b8 60 57 80 00 00 	movabs $0x805760,%rax
+  801fe0:	00 00 00 
+  801fe3:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801fea:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801fed:	39 3b                	cmp    %edi,(%rbx)
+  801fef:	74 47                	je     802038 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ff1:	48 83 c0 08          	add    $0x8,%rax
+  801ff5:	48 8b 18             	mov    (%rax),%rbx
+  801ff8:	48 85 db             	test   %rbx,%rbx
+  801ffb:	75 f0                	jne    801fed <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ffd:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802004:	00 00 00 
+  802007:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80200d:	89 fa                	mov    %edi,%edx
+  80200f:	48 bf c8 56 80 00 00 	movabs $0x8056c8,%rdi
+  802016:	00 00 00 
+  802019:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201e:	48 b9 08 04 80 00 00 	movabs $0x800408,%rcx
+  802025:	00 00 00 
+  802028:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80202a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80202f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802033:	5b                   	pop    %rbx
+  802034:	41 5c                	pop    %r12
+  802036:	5d                   	pop    %rbp
+  802037:	c3                   	ret
+            return 0;
+  802038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203d:	eb f0                	jmp    80202f <dev_lookup+0x60>
+
+000000000080203f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80203f:	55                   	push   %rbp
+  802040:	48 89 e5             	mov    %rsp,%rbp
+  802043:	41 55                	push   %r13
+  802045:	41 54                	push   %r12
+  802047:	53                   	push   %rbx
+  802048:	48 83 ec 18          	sub    $0x18,%rsp
+  80204c:	48 89 fb             	mov    %rdi,%rbx
+  80204f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802052:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802059:	ff ff ff 
+  80205c:	48 01 df             	add    %rbx,%rdi
+  80205f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802063:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802067:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  80206e:	00 00 00 
+  802071:	ff d0                	call   *%rax
+  802073:	41 89 c5             	mov    %eax,%r13d
+  802076:	85 c0                	test   %eax,%eax
+  802078:	78 06                	js     802080 <fd_close+0x41>
+  80207a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80207e:	74 1a                	je     80209a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802080:	45 84 e4             	test   %r12b,%r12b
+  802083:	b8 00 00 00 00       	mov    $0x0,%eax
+  802088:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80208c:	44 89 e8             	mov    %r13d,%eax
+  80208f:	48 83 c4 18          	add    $0x18,%rsp
+  802093:	5b                   	pop    %rbx
+  802094:	41 5c                	pop    %r12
+  802096:	41 5d                	pop    %r13
+  802098:	5d                   	pop    %rbp
+  802099:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80209a:	8b 3b                	mov    (%rbx),%edi
+  80209c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020a0:	48 b8 cf 1f 80 00 00 	movabs $0x801fcf,%rax
+  8020a7:	00 00 00 
+  8020aa:	ff d0                	call   *%rax
+  8020ac:	41 89 c5             	mov    %eax,%r13d
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	78 1b                	js     8020ce <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8020b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020b7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8020bb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8020c1:	48 85 c0             	test   %rax,%rax
+  8020c4:	74 08                	je     8020ce <fd_close+0x8f>
+  8020c6:	48 89 df             	mov    %rbx,%rdi
+  8020c9:	ff d0                	call   *%rax
+  8020cb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020d3:	48 89 de             	mov    %rbx,%rsi
+  8020d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020db:	48 b8 bf 16 80 00 00 	movabs $0x8016bf,%rax
+  8020e2:	00 00 00 
+  8020e5:	ff d0                	call   *%rax
+    return res;
+  8020e7:	eb a3                	jmp    80208c <fd_close+0x4d>
+
+00000000008020e9 <close>:
+
+int
+close(int fdnum) {
+  8020e9:	55                   	push   %rbp
+  8020ea:	48 89 e5             	mov    %rsp,%rbp
+  8020ed:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020f1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8020f5:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  8020fc:	00 00 00 
+  8020ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802101:	85 c0                	test   %eax,%eax
+  802103:	78 15                	js     80211a <close+0x31>
+
+    return fd_close(fd, 1);
+  802105:	be 01 00 00 00       	mov    $0x1,%esi
+  80210a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80210e:	48 b8 3f 20 80 00 00 	movabs $0x80203f,%rax
+  802115:	00 00 00 
+  802118:	ff d0                	call   *%rax
+}
+  80211a:	c9                   	leave
+  80211b:	c3                   	ret
+
+000000000080211c <close_all>:
+
+void
+close_all(void) {
+  80211c:	55                   	push   %rbp
+  80211d:	48 89 e5             	mov    %rsp,%rbp
+  802120:	41 54                	push   %r12
+  802122:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802123:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802128:	49 bc e9 20 80 00 00 	movabs $0x8020e9,%r12
+  80212f:	00 00 00 
+  802132:	89 df                	mov    %ebx,%edi
+  802134:	41 ff d4             	call   *%r12
+  802137:	83 c3 01             	add    $0x1,%ebx
+  80213a:	83 fb 20             	cmp    $0x20,%ebx
+  80213d:	75 f3                	jne    802132 <close_all+0x16>
+}
+  80213f:	5b                   	pop    %rbx
+  802140:	41 5c                	pop    %r12
+  802142:	5d                   	pop    %rbp
+  802143:	c3                   	ret
+
+0000000000802144 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802144:	55                   	push   %rbp
+  802145:	48 89 e5             	mov    %rsp,%rbp
+  802148:	41 57                	push   %r15
+  80214a:	41 56                	push   %r14
+  80214c:	41 55                	push   %r13
+  80214e:	41 54                	push   %r12
+  802150:	53                   	push   %rbx
+  802151:	48 83 ec 18          	sub    $0x18,%rsp
+  802155:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802158:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80215c:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  802163:	00 00 00 
+  802166:	ff d0                	call   *%rax
+  802168:	89 c3                	mov    %eax,%ebx
+  80216a:	85 c0                	test   %eax,%eax
+  80216c:	0f 88 b8 00 00 00    	js     80222a <dup+0xe6>
+    close(newfdnum);
+  802172:	44 89 e7             	mov    %r12d,%edi
+  802175:	48 b8 e9 20 80 00 00 	movabs $0x8020e9,%rax
+  80217c:	00 00 00 
+  80217f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802181:	4d 63 ec             	movslq %r12d,%r13
+  802184:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80218b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80218f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802193:	4c 89 ff             	mov    %r15,%rdi
+  802196:	49 be 08 1f 80 00 00 	movabs $0x801f08,%r14
+  80219d:	00 00 00 
+  8021a0:	41 ff d6             	call   *%r14
+  8021a3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8021a6:	4c 89 ef             	mov    %r13,%rdi
+  8021a9:	41 ff d6             	call   *%r14
+  8021ac:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8021af:	48 89 df             	mov    %rbx,%rdi
+  8021b2:	48 b8 5f 46 80 00 00 	movabs $0x80465f,%rax
+  8021b9:	00 00 00 
+  8021bc:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8021be:	a8 04                	test   $0x4,%al
+  8021c0:	74 2b                	je     8021ed <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8021c2:	41 89 c1             	mov    %eax,%r9d
+  8021c5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8021cb:	4c 89 f1             	mov    %r14,%rcx
+  8021ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d3:	48 89 de             	mov    %rbx,%rsi
+  8021d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021db:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  8021e2:	00 00 00 
+  8021e5:	ff d0                	call   *%rax
+  8021e7:	89 c3                	mov    %eax,%ebx
+  8021e9:	85 c0                	test   %eax,%eax
+  8021eb:	78 4e                	js     80223b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8021ed:	4c 89 ff             	mov    %r15,%rdi
+  8021f0:	48 b8 5f 46 80 00 00 	movabs $0x80465f,%rax
+  8021f7:	00 00 00 
+  8021fa:	ff d0                	call   *%rax
+  8021fc:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8021ff:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802205:	4c 89 e9             	mov    %r13,%rcx
+  802208:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220d:	4c 89 fe             	mov    %r15,%rsi
+  802210:	bf 00 00 00 00       	mov    $0x0,%edi
+  802215:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  80221c:	00 00 00 
+  80221f:	ff d0                	call   *%rax
+  802221:	89 c3                	mov    %eax,%ebx
+  802223:	85 c0                	test   %eax,%eax
+  802225:	78 14                	js     80223b <dup+0xf7>
+
+    return newfdnum;
+  802227:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80222a:	89 d8                	mov    %ebx,%eax
+  80222c:	48 83 c4 18          	add    $0x18,%rsp
+  802230:	5b                   	pop    %rbx
+  802231:	41 5c                	pop    %r12
+  802233:	41 5d                	pop    %r13
+  802235:	41 5e                	pop    %r14
+  802237:	41 5f                	pop    %r15
+  802239:	5d                   	pop    %rbp
+  80223a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80223b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802240:	4c 89 ee             	mov    %r13,%rsi
+  802243:	bf 00 00 00 00       	mov    $0x0,%edi
+  802248:	49 bc bf 16 80 00 00 	movabs $0x8016bf,%r12
+  80224f:	00 00 00 
+  802252:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802255:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80225a:	4c 89 f6             	mov    %r14,%rsi
+  80225d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802262:	41 ff d4             	call   *%r12
+    return res;
+  802265:	eb c3                	jmp    80222a <dup+0xe6>
+
+0000000000802267 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802267:	55                   	push   %rbp
+  802268:	48 89 e5             	mov    %rsp,%rbp
+  80226b:	41 56                	push   %r14
+  80226d:	41 55                	push   %r13
+  80226f:	41 54                	push   %r12
+  802271:	53                   	push   %rbx
+  802272:	48 83 ec 10          	sub    $0x10,%rsp
+  802276:	89 fb                	mov    %edi,%ebx
+  802278:	49 89 f4             	mov    %rsi,%r12
+  80227b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80227e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802282:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  802289:	00 00 00 
+  80228c:	ff d0                	call   *%rax
+  80228e:	85 c0                	test   %eax,%eax
+  802290:	78 4c                	js     8022de <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802292:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802296:	41 8b 3e             	mov    (%r14),%edi
+  802299:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80229d:	48 b8 cf 1f 80 00 00 	movabs $0x801fcf,%rax
+  8022a4:	00 00 00 
+  8022a7:	ff d0                	call   *%rax
+  8022a9:	85 c0                	test   %eax,%eax
+  8022ab:	78 35                	js     8022e2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8022ad:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8022b1:	83 e0 03             	and    $0x3,%eax
+  8022b4:	83 f8 01             	cmp    $0x1,%eax
+  8022b7:	74 2d                	je     8022e6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8022b9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022bd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8022c1:	48 85 c0             	test   %rax,%rax
+  8022c4:	74 56                	je     80231c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8022c6:	4c 89 ea             	mov    %r13,%rdx
+  8022c9:	4c 89 e6             	mov    %r12,%rsi
+  8022cc:	4c 89 f7             	mov    %r14,%rdi
+  8022cf:	ff d0                	call   *%rax
+}
+  8022d1:	48 83 c4 10          	add    $0x10,%rsp
+  8022d5:	5b                   	pop    %rbx
+  8022d6:	41 5c                	pop    %r12
+  8022d8:	41 5d                	pop    %r13
+  8022da:	41 5e                	pop    %r14
+  8022dc:	5d                   	pop    %rbp
+  8022dd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022de:	48 98                	cltq
+  8022e0:	eb ef                	jmp    8022d1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022e2:	48 98                	cltq
+  8022e4:	eb eb                	jmp    8022d1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022e6:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022ed:	00 00 00 
+  8022f0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022f6:	89 da                	mov    %ebx,%edx
+  8022f8:	48 bf 09 57 80 00 00 	movabs $0x805709,%rdi
+  8022ff:	00 00 00 
+  802302:	b8 00 00 00 00       	mov    $0x0,%eax
+  802307:	48 b9 08 04 80 00 00 	movabs $0x800408,%rcx
+  80230e:	00 00 00 
+  802311:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802313:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80231a:	eb b5                	jmp    8022d1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80231c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802323:	eb ac                	jmp    8022d1 <read+0x6a>
+
+0000000000802325 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802325:	55                   	push   %rbp
+  802326:	48 89 e5             	mov    %rsp,%rbp
+  802329:	41 57                	push   %r15
+  80232b:	41 56                	push   %r14
+  80232d:	41 55                	push   %r13
+  80232f:	41 54                	push   %r12
+  802331:	53                   	push   %rbx
+  802332:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802336:	48 85 d2             	test   %rdx,%rdx
+  802339:	74 54                	je     80238f <readn+0x6a>
+  80233b:	41 89 fd             	mov    %edi,%r13d
+  80233e:	49 89 f6             	mov    %rsi,%r14
+  802341:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802344:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802349:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80234e:	49 bf 67 22 80 00 00 	movabs $0x802267,%r15
+  802355:	00 00 00 
+  802358:	4c 89 e2             	mov    %r12,%rdx
+  80235b:	48 29 f2             	sub    %rsi,%rdx
+  80235e:	4c 01 f6             	add    %r14,%rsi
+  802361:	44 89 ef             	mov    %r13d,%edi
+  802364:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802367:	85 c0                	test   %eax,%eax
+  802369:	78 20                	js     80238b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80236b:	01 c3                	add    %eax,%ebx
+  80236d:	85 c0                	test   %eax,%eax
+  80236f:	74 08                	je     802379 <readn+0x54>
+  802371:	48 63 f3             	movslq %ebx,%rsi
+  802374:	4c 39 e6             	cmp    %r12,%rsi
+  802377:	72 df                	jb     802358 <readn+0x33>
+    }
+    return res;
+  802379:	48 63 c3             	movslq %ebx,%rax
+}
+  80237c:	48 83 c4 08          	add    $0x8,%rsp
+  802380:	5b                   	pop    %rbx
+  802381:	41 5c                	pop    %r12
+  802383:	41 5d                	pop    %r13
+  802385:	41 5e                	pop    %r14
+  802387:	41 5f                	pop    %r15
+  802389:	5d                   	pop    %rbp
+  80238a:	c3                   	ret
+        if (inc < 0) return inc;
+  80238b:	48 98                	cltq
+  80238d:	eb ed                	jmp    80237c <readn+0x57>
+    int inc = 1, res = 0;
+  80238f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802394:	eb e3                	jmp    802379 <readn+0x54>
+
+0000000000802396 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802396:	55                   	push   %rbp
+  802397:	48 89 e5             	mov    %rsp,%rbp
+  80239a:	41 56                	push   %r14
+  80239c:	41 55                	push   %r13
+  80239e:	41 54                	push   %r12
+  8023a0:	53                   	push   %rbx
+  8023a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8023a5:	89 fb                	mov    %edi,%ebx
+  8023a7:	49 89 f4             	mov    %rsi,%r12
+  8023aa:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023ad:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023b1:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  8023b8:	00 00 00 
+  8023bb:	ff d0                	call   *%rax
+  8023bd:	85 c0                	test   %eax,%eax
+  8023bf:	78 47                	js     802408 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023c1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8023c5:	41 8b 3e             	mov    (%r14),%edi
+  8023c8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023cc:	48 b8 cf 1f 80 00 00 	movabs $0x801fcf,%rax
+  8023d3:	00 00 00 
+  8023d6:	ff d0                	call   *%rax
+  8023d8:	85 c0                	test   %eax,%eax
+  8023da:	78 30                	js     80240c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023dc:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8023e1:	74 2d                	je     802410 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023e7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8023eb:	48 85 c0             	test   %rax,%rax
+  8023ee:	74 56                	je     802446 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8023f0:	4c 89 ea             	mov    %r13,%rdx
+  8023f3:	4c 89 e6             	mov    %r12,%rsi
+  8023f6:	4c 89 f7             	mov    %r14,%rdi
+  8023f9:	ff d0                	call   *%rax
+}
+  8023fb:	48 83 c4 10          	add    $0x10,%rsp
+  8023ff:	5b                   	pop    %rbx
+  802400:	41 5c                	pop    %r12
+  802402:	41 5d                	pop    %r13
+  802404:	41 5e                	pop    %r14
+  802406:	5d                   	pop    %rbp
+  802407:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802408:	48 98                	cltq
+  80240a:	eb ef                	jmp    8023fb <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80240c:	48 98                	cltq
+  80240e:	eb eb                	jmp    8023fb <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802410:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802417:	00 00 00 
+  80241a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802420:	89 da                	mov    %ebx,%edx
+  802422:	48 bf 25 57 80 00 00 	movabs $0x805725,%rdi
+  802429:	00 00 00 
+  80242c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802431:	48 b9 08 04 80 00 00 	movabs $0x800408,%rcx
+  802438:	00 00 00 
+  80243b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80243d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802444:	eb b5                	jmp    8023fb <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802446:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80244d:	eb ac                	jmp    8023fb <write+0x65>
+
+000000000080244f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80244f:	55                   	push   %rbp
+  802450:	48 89 e5             	mov    %rsp,%rbp
+  802453:	53                   	push   %rbx
+  802454:	48 83 ec 18          	sub    $0x18,%rsp
+  802458:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80245a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80245e:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  802465:	00 00 00 
+  802468:	ff d0                	call   *%rax
+  80246a:	85 c0                	test   %eax,%eax
+  80246c:	78 0c                	js     80247a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80246e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802472:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802475:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80247a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80247e:	c9                   	leave
+  80247f:	c3                   	ret
+
+0000000000802480 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802480:	55                   	push   %rbp
+  802481:	48 89 e5             	mov    %rsp,%rbp
+  802484:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802488:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80248c:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  802493:	00 00 00 
+  802496:	ff d0                	call   *%rax
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	78 07                	js     8024a3 <tell+0x23>
+    return fdes->fd_offset;
+  80249c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024a0:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8024a3:	c9                   	leave
+  8024a4:	c3                   	ret
+
+00000000008024a5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8024a5:	55                   	push   %rbp
+  8024a6:	48 89 e5             	mov    %rsp,%rbp
+  8024a9:	41 55                	push   %r13
+  8024ab:	41 54                	push   %r12
+  8024ad:	53                   	push   %rbx
+  8024ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8024b2:	89 fb                	mov    %edi,%ebx
+  8024b4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024b7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024bb:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  8024c2:	00 00 00 
+  8024c5:	ff d0                	call   *%rax
+  8024c7:	85 c0                	test   %eax,%eax
+  8024c9:	78 38                	js     802503 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024cb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8024cf:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8024d3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024d7:	48 b8 cf 1f 80 00 00 	movabs $0x801fcf,%rax
+  8024de:	00 00 00 
+  8024e1:	ff d0                	call   *%rax
+  8024e3:	85 c0                	test   %eax,%eax
+  8024e5:	78 1c                	js     802503 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024e7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8024ec:	74 20                	je     80250e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024f2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8024f6:	48 85 c0             	test   %rax,%rax
+  8024f9:	74 47                	je     802542 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8024fb:	44 89 e6             	mov    %r12d,%esi
+  8024fe:	4c 89 ef             	mov    %r13,%rdi
+  802501:	ff d0                	call   *%rax
+}
+  802503:	48 83 c4 18          	add    $0x18,%rsp
+  802507:	5b                   	pop    %rbx
+  802508:	41 5c                	pop    %r12
+  80250a:	41 5d                	pop    %r13
+  80250c:	5d                   	pop    %rbp
+  80250d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80250e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802515:	00 00 00 
+  802518:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80251e:	89 da                	mov    %ebx,%edx
+  802520:	48 bf e8 56 80 00 00 	movabs $0x8056e8,%rdi
+  802527:	00 00 00 
+  80252a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80252f:	48 b9 08 04 80 00 00 	movabs $0x800408,%rcx
+  802536:	00 00 00 
+  802539:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80253b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802540:	eb c1                	jmp    802503 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802542:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802547:	eb ba                	jmp    802503 <ftruncate+0x5e>
+
+0000000000802549 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802549:	55                   	push   %rbp
+  80254a:	48 89 e5             	mov    %rsp,%rbp
+  80254d:	41 54                	push   %r12
+  80254f:	53                   	push   %rbx
+  802550:	48 83 ec 10          	sub    $0x10,%rsp
+  802554:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802557:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80255b:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  802562:	00 00 00 
+  802565:	ff d0                	call   *%rax
+  802567:	85 c0                	test   %eax,%eax
+  802569:	78 4e                	js     8025b9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80256b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80256f:	41 8b 3c 24          	mov    (%r12),%edi
+  802573:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802577:	48 b8 cf 1f 80 00 00 	movabs $0x801fcf,%rax
+  80257e:	00 00 00 
+  802581:	ff d0                	call   *%rax
+  802583:	85 c0                	test   %eax,%eax
+  802585:	78 32                	js     8025b9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802587:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80258b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802590:	74 30                	je     8025c2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802592:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802595:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80259c:	00 00 00 
+    stat->st_isdir = 0;
+  80259f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8025a6:	00 00 00 
+    stat->st_dev = dev;
+  8025a9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8025b0:	48 89 de             	mov    %rbx,%rsi
+  8025b3:	4c 89 e7             	mov    %r12,%rdi
+  8025b6:	ff 50 28             	call   *0x28(%rax)
+}
+  8025b9:	48 83 c4 10          	add    $0x10,%rsp
+  8025bd:	5b                   	pop    %rbx
+  8025be:	41 5c                	pop    %r12
+  8025c0:	5d                   	pop    %rbp
+  8025c1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8025c2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025c7:	eb f0                	jmp    8025b9 <fstat+0x70>
+
+00000000008025c9 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8025c9:	55                   	push   %rbp
+  8025ca:	48 89 e5             	mov    %rsp,%rbp
+  8025cd:	41 54                	push   %r12
+  8025cf:	53                   	push   %rbx
+  8025d0:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8025d7:	41 89 fc             	mov    %edi,%r12d
+  8025da:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025dc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025e0:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  8025e7:	00 00 00 
+  8025ea:	ff d0                	call   *%rax
+  8025ec:	85 c0                	test   %eax,%eax
+  8025ee:	78 31                	js     802621 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8025f0:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8025f7:	44 89 e7             	mov    %r12d,%edi
+  8025fa:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  802601:	00 00 00 
+  802604:	ff d0                	call   *%rax
+  802606:	85 c0                	test   %eax,%eax
+  802608:	78 17                	js     802621 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  80260a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80260e:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802611:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802614:	39 d3                	cmp    %edx,%ebx
+  802616:	0f 4f da             	cmovg  %edx,%ebx
+  802619:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80261c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802621:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802628:	5b                   	pop    %rbx
+  802629:	41 5c                	pop    %r12
+  80262b:	5d                   	pop    %rbp
+  80262c:	c3                   	ret
+
+000000000080262d <seektoend>:
+{
+  80262d:	55                   	push   %rbp
+  80262e:	48 89 e5             	mov    %rsp,%rbp
+  802631:	53                   	push   %rbx
+  802632:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802639:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80263b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80263f:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  802646:	00 00 00 
+  802649:	ff d0                	call   *%rax
+  80264b:	85 c0                	test   %eax,%eax
+  80264d:	78 28                	js     802677 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80264f:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802656:	89 df                	mov    %ebx,%edi
+  802658:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  80265f:	00 00 00 
+  802662:	ff d0                	call   *%rax
+  802664:	85 c0                	test   %eax,%eax
+  802666:	78 0f                	js     802677 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802668:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80266b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80266f:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802672:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802677:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80267b:	c9                   	leave
+  80267c:	c3                   	ret
+
+000000000080267d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80267d:	55                   	push   %rbp
+  80267e:	48 89 e5             	mov    %rsp,%rbp
+  802681:	41 54                	push   %r12
+  802683:	53                   	push   %rbx
+  802684:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802687:	be 00 00 00 00       	mov    $0x0,%esi
+  80268c:	48 b8 70 32 80 00 00 	movabs $0x803270,%rax
+  802693:	00 00 00 
+  802696:	ff d0                	call   *%rax
+  802698:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80269a:	85 c0                	test   %eax,%eax
+  80269c:	78 25                	js     8026c3 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80269e:	4c 89 e6             	mov    %r12,%rsi
+  8026a1:	89 c7                	mov    %eax,%edi
+  8026a3:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  8026aa:	00 00 00 
+  8026ad:	ff d0                	call   *%rax
+  8026af:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8026b2:	89 df                	mov    %ebx,%edi
+  8026b4:	48 b8 e9 20 80 00 00 	movabs $0x8020e9,%rax
+  8026bb:	00 00 00 
+  8026be:	ff d0                	call   *%rax
+
+    return res;
+  8026c0:	44 89 e3             	mov    %r12d,%ebx
+}
+  8026c3:	89 d8                	mov    %ebx,%eax
+  8026c5:	5b                   	pop    %rbx
+  8026c6:	41 5c                	pop    %r12
+  8026c8:	5d                   	pop    %rbp
+  8026c9:	c3                   	ret
+
+00000000008026ca <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8026ca:	55                   	push   %rbp
+  8026cb:	48 89 e5             	mov    %rsp,%rbp
+  8026ce:	53                   	push   %rbx
+  8026cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8026d3:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8026d6:	48 b8 f6 1e 80 00 00 	movabs $0x801ef6,%rax
+  8026dd:	00 00 00 
+  8026e0:	ff d0                	call   *%rax
+  8026e2:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8026e6:	0f 87 ea 00 00 00    	ja     8027d6 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8026ec:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8026f3:	00 00 00 
+  8026f6:	80 38 00             	cmpb   $0x0,(%rax)
+  8026f9:	75 35                	jne    802730 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8026fb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802700:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802705:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  80270a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80270f:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  802716:	00 00 00 
+  802719:	ff d0                	call   *%rax
+  80271b:	85 c0                	test   %eax,%eax
+  80271d:	0f 88 ba 00 00 00    	js     8027dd <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802723:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80272a:	00 00 00 
+  80272d:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802730:	48 89 df             	mov    %rbx,%rdi
+  802733:	48 b8 f6 1e 80 00 00 	movabs $0x801ef6,%rax
+  80273a:	00 00 00 
+  80273d:	ff d0                	call   *%rax
+  80273f:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802743:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80274a:	00 00 00 
+  80274d:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802751:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802754:	39 39                	cmp    %edi,(%rcx)
+  802756:	74 46                	je     80279e <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802758:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80275c:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802763:	00 
+  802764:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80276b:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802772:	00 
+  802773:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80277a:	00 
+  80277b:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802782:	00 
+  802783:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80278a:	00 
+  80278b:	89 39                	mov    %edi,(%rcx)
+  80278d:	48 01 c6             	add    %rax,%rsi
+  802790:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802795:	48 89 c8             	mov    %rcx,%rax
+  802798:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80279c:	c9                   	leave
+  80279d:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80279e:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8027a2:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  8027a9:	00 00 00 
+  8027ac:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8027af:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  8027b3:	74 e0                	je     802795 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  8027b5:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8027bc:	00 
+  8027bd:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8027c1:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8027c8:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8027ca:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8027cd:	48 01 c2             	add    %rax,%rdx
+  8027d0:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8027d4:	eb bf                	jmp    802795 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8027d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027db:	eb b8                	jmp    802795 <fbuf_get+0xcb>
+            return NULL;
+  8027dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027e2:	eb b1                	jmp    802795 <fbuf_get+0xcb>
+
+00000000008027e4 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8027e4:	55                   	push   %rbp
+  8027e5:	48 89 e5             	mov    %rsp,%rbp
+  8027e8:	53                   	push   %rbx
+  8027e9:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8027ed:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8027f4:	00 00 00 
+  8027f7:	48 8b 18             	mov    (%rax),%rbx
+  8027fa:	48 85 db             	test   %rbx,%rbx
+  8027fd:	74 16                	je     802815 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8027ff:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802806:	00 00 00 
+  802809:	48 8b 18             	mov    (%rax),%rbx
+}
+  80280c:	48 89 d8             	mov    %rbx,%rax
+  80280f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802813:	c9                   	leave
+  802814:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802815:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80281a:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80281f:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802824:	bf 00 00 00 00       	mov    $0x0,%edi
+  802829:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  802830:	00 00 00 
+  802833:	ff d0                	call   *%rax
+  802835:	85 c0                	test   %eax,%eax
+  802837:	78 d3                	js     80280c <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802839:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  80283e:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802845:	00 00 00 
+  802848:	eb b5                	jmp    8027ff <fsipc_bulk+0x1b>
+
+000000000080284a <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80284a:	55                   	push   %rbp
+  80284b:	48 89 e5             	mov    %rsp,%rbp
+  80284e:	41 57                	push   %r15
+  802850:	41 56                	push   %r14
+  802852:	41 55                	push   %r13
+  802854:	41 54                	push   %r12
+  802856:	53                   	push   %rbx
+  802857:	48 83 ec 08          	sub    $0x8,%rsp
+  80285b:	41 89 fd             	mov    %edi,%r13d
+  80285e:	49 89 f6             	mov    %rsi,%r14
+  802861:	49 89 d7             	mov    %rdx,%r15
+  802864:	48 89 cb             	mov    %rcx,%rbx
+  802867:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80286a:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802871:	00 00 00 
+  802874:	83 38 00             	cmpl   $0x0,(%rax)
+  802877:	74 52                	je     8028cb <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802879:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80287f:	4c 89 f9             	mov    %r15,%rcx
+  802882:	4c 89 f2             	mov    %r14,%rdx
+  802885:	44 89 ee             	mov    %r13d,%esi
+  802888:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80288f:	00 00 00 
+  802892:	8b 38                	mov    (%rax),%edi
+  802894:	48 b8 b6 4b 80 00 00 	movabs $0x804bb6,%rax
+  80289b:	00 00 00 
+  80289e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  8028a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028a5:	4c 89 e2             	mov    %r12,%rdx
+  8028a8:	48 89 de             	mov    %rbx,%rsi
+  8028ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028b0:	48 b8 06 4a 80 00 00 	movabs $0x804a06,%rax
+  8028b7:	00 00 00 
+  8028ba:	ff d0                	call   *%rax
+}
+  8028bc:	48 83 c4 08          	add    $0x8,%rsp
+  8028c0:	5b                   	pop    %rbx
+  8028c1:	41 5c                	pop    %r12
+  8028c3:	41 5d                	pop    %r13
+  8028c5:	41 5e                	pop    %r14
+  8028c7:	41 5f                	pop    %r15
+  8028c9:	5d                   	pop    %rbp
+  8028ca:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028cb:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028d0:	48 b8 59 4c 80 00 00 	movabs $0x804c59,%rax
+  8028d7:	00 00 00 
+  8028da:	ff d0                	call   *%rax
+  8028dc:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8028e3:	00 00 
+  8028e5:	eb 92                	jmp    802879 <fsipc_region+0x2f>
+
+00000000008028e7 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8028e7:	55                   	push   %rbp
+  8028e8:	48 89 e5             	mov    %rsp,%rbp
+  8028eb:	41 57                	push   %r15
+  8028ed:	41 56                	push   %r14
+  8028ef:	41 55                	push   %r13
+  8028f1:	41 54                	push   %r12
+  8028f3:	53                   	push   %rbx
+  8028f4:	48 83 ec 28          	sub    $0x28,%rsp
+  8028f8:	49 89 ff             	mov    %rdi,%r15
+  8028fb:	49 89 f6             	mov    %rsi,%r14
+  8028fe:	48 89 d3             	mov    %rdx,%rbx
+  802901:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802905:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802908:	48 b8 e4 27 80 00 00 	movabs $0x8027e4,%rax
+  80290f:	00 00 00 
+  802912:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802914:	48 85 c0             	test   %rax,%rax
+  802917:	0f 84 cc 00 00 00    	je     8029e9 <devfile_write_direct+0x102>
+  80291d:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802920:	48 85 db             	test   %rbx,%rbx
+  802923:	0f 84 ba 00 00 00    	je     8029e3 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802929:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80292f:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802936:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  80293a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80293e:	4c 29 e3             	sub    %r12,%rbx
+  802941:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802946:	48 39 c3             	cmp    %rax,%rbx
+  802949:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80294d:	48 89 da             	mov    %rbx,%rdx
+  802950:	4c 89 f6             	mov    %r14,%rsi
+  802953:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802957:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  80295e:	00 00 00 
+  802961:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802963:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802967:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  80296b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80296e:	44 01 e0             	add    %r12d,%eax
+  802971:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802975:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802979:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802980:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802987:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80298e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802994:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802999:	4c 89 ee             	mov    %r13,%rsi
+  80299c:	bf 04 00 00 00       	mov    $0x4,%edi
+  8029a1:	48 b8 4a 28 80 00 00 	movabs $0x80284a,%rax
+  8029a8:	00 00 00 
+  8029ab:	ff d0                	call   *%rax
+        if (res < 0)
+  8029ad:	85 c0                	test   %eax,%eax
+  8029af:	78 29                	js     8029da <devfile_write_direct+0xf3>
+        if (res == 0)
+  8029b1:	74 2b                	je     8029de <devfile_write_direct+0xf7>
+        i += res;
+  8029b3:	48 98                	cltq
+  8029b5:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  8029b8:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  8029bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029bf:	49 39 c4             	cmp    %rax,%r12
+  8029c2:	0f 82 72 ff ff ff    	jb     80293a <devfile_write_direct+0x53>
+    return i;
+  8029c8:	4c 89 e0             	mov    %r12,%rax
+}
+  8029cb:	48 83 c4 28          	add    $0x28,%rsp
+  8029cf:	5b                   	pop    %rbx
+  8029d0:	41 5c                	pop    %r12
+  8029d2:	41 5d                	pop    %r13
+  8029d4:	41 5e                	pop    %r14
+  8029d6:	41 5f                	pop    %r15
+  8029d8:	5d                   	pop    %rbp
+  8029d9:	c3                   	ret
+            return res;
+  8029da:	48 98                	cltq
+  8029dc:	eb ed                	jmp    8029cb <devfile_write_direct+0xe4>
+            return i;
+  8029de:	4c 89 e0             	mov    %r12,%rax
+  8029e1:	eb e8                	jmp    8029cb <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8029e3:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8029e7:	eb df                	jmp    8029c8 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8029e9:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8029f0:	eb d9                	jmp    8029cb <devfile_write_direct+0xe4>
+
+00000000008029f2 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8029f2:	55                   	push   %rbp
+  8029f3:	48 89 e5             	mov    %rsp,%rbp
+  8029f6:	41 56                	push   %r14
+  8029f8:	41 55                	push   %r13
+  8029fa:	41 54                	push   %r12
+  8029fc:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8029fd:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802a01:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0a:	4d 39 ee             	cmp    %r13,%r14
+  802a0d:	0f 84 99 00 00 00    	je     802aac <fbuf_flush+0xba>
+  802a13:	49 89 fc             	mov    %rdi,%r12
+  802a16:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802a19:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802a1c:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802a20:	48 b8 f6 1e 80 00 00 	movabs $0x801ef6,%rax
+  802a27:	00 00 00 
+  802a2a:	ff d0                	call   *%rax
+  802a2c:	48 89 c2             	mov    %rax,%rdx
+  802a2f:	48 c1 e2 04          	shl    $0x4,%rdx
+  802a33:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802a37:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a3b:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802a40:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802a43:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802a47:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802a4e:	00 
+  802a4f:	44 89 f1             	mov    %r14d,%ecx
+  802a52:	4c 89 ea             	mov    %r13,%rdx
+  802a55:	4c 89 e7             	mov    %r12,%rdi
+  802a58:	48 b8 e7 28 80 00 00 	movabs $0x8028e7,%rax
+  802a5f:	00 00 00 
+  802a62:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a64:	48 85 c0             	test   %rax,%rax
+  802a67:	78 43                	js     802aac <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802a69:	4c 39 e8             	cmp    %r13,%rax
+  802a6c:	72 47                	jb     802ab5 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802a6e:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802a73:	83 c0 01             	add    $0x1,%eax
+  802a76:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802a7b:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802a7e:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802a82:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802a86:	72 0f                	jb     802a97 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802a88:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802a8c:	48 39 c2             	cmp    %rax,%rdx
+  802a8f:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802a93:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802a97:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802a9e:	00 
+  802a9f:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802aa6:	00 
+    return 0;
+  802aa7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802aac:	5b                   	pop    %rbx
+  802aad:	41 5c                	pop    %r12
+  802aaf:	41 5d                	pop    %r13
+  802ab1:	41 5e                	pop    %r14
+  802ab3:	5d                   	pop    %rbp
+  802ab4:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802ab5:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802aba:	eb f0                	jmp    802aac <fbuf_flush+0xba>
+
+0000000000802abc <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802abc:	55                   	push   %rbp
+  802abd:	48 89 e5             	mov    %rsp,%rbp
+  802ac0:	53                   	push   %rbx
+  802ac1:	48 83 ec 08          	sub    $0x8,%rsp
+  802ac5:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802ac8:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802acf:	00 00 00 
+  802ad2:	ff d0                	call   *%rax
+  802ad4:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802adc:	48 85 f6             	test   %rsi,%rsi
+  802adf:	74 0f                	je     802af0 <devfile_sync+0x34>
+  802ae1:	48 89 df             	mov    %rbx,%rdi
+  802ae4:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  802aeb:	00 00 00 
+  802aee:	ff d0                	call   *%rax
+}
+  802af0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802af4:	c9                   	leave
+  802af5:	c3                   	ret
+
+0000000000802af6 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802af6:	55                   	push   %rbp
+  802af7:	48 89 e5             	mov    %rsp,%rbp
+  802afa:	48 83 ec 10          	sub    $0x10,%rsp
+  802afe:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802b01:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802b08:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802b09:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802b0d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b12:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802b19:	00 00 00 
+  802b1c:	48 b8 4a 28 80 00 00 	movabs $0x80284a,%rax
+  802b23:	00 00 00 
+  802b26:	ff d0                	call   *%rax
+}
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+
+0000000000802b2a <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802b2a:	55                   	push   %rbp
+  802b2b:	48 89 e5             	mov    %rsp,%rbp
+  802b2e:	41 54                	push   %r12
+  802b30:	53                   	push   %rbx
+  802b31:	48 89 fb             	mov    %rdi,%rbx
+  802b34:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802b37:	48 b8 bc 2a 80 00 00 	movabs $0x802abc,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b43:	85 c0                	test   %eax,%eax
+  802b45:	78 63                	js     802baa <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802b47:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b4a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802b51:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802b53:	be 00 00 00 00       	mov    $0x0,%esi
+  802b58:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b5d:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  802b64:	00 00 00 
+  802b67:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b69:	85 c0                	test   %eax,%eax
+  802b6b:	78 3d                	js     802baa <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802b6d:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802b74:	00 00 00 
+  802b77:	48 89 de             	mov    %rbx,%rsi
+  802b7a:	4c 89 e7             	mov    %r12,%rdi
+  802b7d:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  802b84:	00 00 00 
+  802b87:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802b89:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802b8f:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802b96:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b97:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802b9d:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802ba4:	00 
+
+    return 0;
+  802ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802baa:	5b                   	pop    %rbx
+  802bab:	41 5c                	pop    %r12
+  802bad:	5d                   	pop    %rbp
+  802bae:	c3                   	ret
+
+0000000000802baf <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802baf:	55                   	push   %rbp
+  802bb0:	48 89 e5             	mov    %rsp,%rbp
+  802bb3:	41 54                	push   %r12
+  802bb5:	53                   	push   %rbx
+  802bb6:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802bb9:	48 b8 bc 2a 80 00 00 	movabs $0x802abc,%rax
+  802bc0:	00 00 00 
+  802bc3:	ff d0                	call   *%rax
+  802bc5:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802bc8:	48 89 df             	mov    %rbx,%rdi
+  802bcb:	48 b8 f6 1e 80 00 00 	movabs $0x801ef6,%rax
+  802bd2:	00 00 00 
+  802bd5:	ff d0                	call   *%rax
+  802bd7:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802bdb:	76 2e                	jbe    802c0b <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802bdd:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802be0:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802be7:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802be9:	be 00 00 00 00       	mov    $0x0,%esi
+  802bee:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bf3:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  802bfa:	00 00 00 
+  802bfd:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802bff:	45 85 e4             	test   %r12d,%r12d
+  802c02:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802c06:	5b                   	pop    %rbx
+  802c07:	41 5c                	pop    %r12
+  802c09:	5d                   	pop    %rbp
+  802c0a:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802c0b:	48 89 df             	mov    %rbx,%rdi
+  802c0e:	48 b8 f6 1e 80 00 00 	movabs $0x801ef6,%rax
+  802c15:	00 00 00 
+  802c18:	ff d0                	call   *%rax
+  802c1a:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802c1e:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802c25:	00 00 00 
+  802c28:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802c2f:	48 89 df             	mov    %rbx,%rdi
+  802c32:	48 b8 08 1f 80 00 00 	movabs $0x801f08,%rax
+  802c39:	00 00 00 
+  802c3c:	ff d0                	call   *%rax
+  802c3e:	48 89 c6             	mov    %rax,%rsi
+  802c41:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c46:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c4b:	48 b8 bf 16 80 00 00 	movabs $0x8016bf,%rax
+  802c52:	00 00 00 
+  802c55:	ff d0                	call   *%rax
+  802c57:	eb 84                	jmp    802bdd <devfile_flush+0x2e>
+
+0000000000802c59 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802c59:	55                   	push   %rbp
+  802c5a:	48 89 e5             	mov    %rsp,%rbp
+  802c5d:	41 55                	push   %r13
+  802c5f:	41 54                	push   %r12
+  802c61:	53                   	push   %rbx
+  802c62:	48 83 ec 08          	sub    $0x8,%rsp
+  802c66:	48 89 fb             	mov    %rdi,%rbx
+  802c69:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802c6c:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802c73:	00 00 00 
+  802c76:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802c78:	48 85 c0             	test   %rax,%rax
+  802c7b:	74 51                	je     802cce <devfile_trunc+0x75>
+  802c7d:	49 89 c4             	mov    %rax,%r12
+  802c80:	48 89 c6             	mov    %rax,%rsi
+  802c83:	48 89 df             	mov    %rbx,%rdi
+  802c86:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  802c8d:	00 00 00 
+  802c90:	ff d0                	call   *%rax
+  802c92:	85 c0                	test   %eax,%eax
+  802c94:	78 2d                	js     802cc3 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802c96:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802c9d:	00 00 00 
+  802ca0:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802ca3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802ca5:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ca9:	be 00 00 00 00       	mov    $0x0,%esi
+  802cae:	bf 02 00 00 00       	mov    $0x2,%edi
+  802cb3:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  802cba:	00 00 00 
+  802cbd:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802cbf:	85 c0                	test   %eax,%eax
+  802cc1:	79 3e                	jns    802d01 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802cc3:	48 83 c4 08          	add    $0x8,%rsp
+  802cc7:	5b                   	pop    %rbx
+  802cc8:	41 5c                	pop    %r12
+  802cca:	41 5d                	pop    %r13
+  802ccc:	5d                   	pop    %rbp
+  802ccd:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802cce:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802cd5:	00 00 00 
+  802cd8:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802cdb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802cdd:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ce1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ce6:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ceb:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  802cf2:	00 00 00 
+  802cf5:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802cf7:	85 c0                	test   %eax,%eax
+  802cf9:	78 c8                	js     802cc3 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802cfb:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802cff:	eb c2                	jmp    802cc3 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802d01:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802d04:	8d 51 01             	lea    0x1(%rcx),%edx
+  802d07:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d0a:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802d0f:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802d16:	00 00 
+  802d18:	eb a9                	jmp    802cc3 <devfile_trunc+0x6a>
+
+0000000000802d1a <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d1a:	55                   	push   %rbp
+  802d1b:	48 89 e5             	mov    %rsp,%rbp
+  802d1e:	41 57                	push   %r15
+  802d20:	41 56                	push   %r14
+  802d22:	41 55                	push   %r13
+  802d24:	41 54                	push   %r12
+  802d26:	53                   	push   %rbx
+  802d27:	48 83 ec 28          	sub    $0x28,%rsp
+  802d2b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802d2f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d33:	49 89 d7             	mov    %rdx,%r15
+  802d36:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802d3a:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802d41:	00 00 00 
+  802d44:	ff d0                	call   *%rax
+  802d46:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802d49:	48 85 c0             	test   %rax,%rax
+  802d4c:	74 31                	je     802d7f <devfile_write+0x65>
+  802d4e:	4c 89 f8             	mov    %r15,%rax
+  802d51:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802d58:	77 25                	ja     802d7f <devfile_write+0x65>
+    size_t i = 0;
+  802d5a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802d60:	48 85 c0             	test   %rax,%rax
+  802d63:	0f 85 64 01 00 00    	jne    802ecd <devfile_write+0x1b3>
+    size_t i = 0;
+  802d69:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802d6d:	4c 89 f8             	mov    %r15,%rax
+}
+  802d70:	48 83 c4 28          	add    $0x28,%rsp
+  802d74:	5b                   	pop    %rbx
+  802d75:	41 5c                	pop    %r12
+  802d77:	41 5d                	pop    %r13
+  802d79:	41 5e                	pop    %r14
+  802d7b:	41 5f                	pop    %r15
+  802d7d:	5d                   	pop    %rbp
+  802d7e:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d7f:	48 85 db             	test   %rbx,%rbx
+  802d82:	74 5b                	je     802ddf <devfile_write+0xc5>
+  802d84:	48 89 de             	mov    %rbx,%rsi
+  802d87:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d8b:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  802d92:	00 00 00 
+  802d95:	ff d0                	call   *%rax
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	78 40                	js     802ddb <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802d9b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d9f:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802da2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802da6:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802daa:	48 b8 e7 28 80 00 00 	movabs $0x8028e7,%rax
+  802db1:	00 00 00 
+  802db4:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802db6:	48 85 c0             	test   %rax,%rax
+  802db9:	7e b5                	jle    802d70 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802dbb:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802dbf:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802dc2:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802dc5:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802dc8:	8d 51 01             	lea    0x1(%rcx),%edx
+  802dcb:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802dce:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802dd1:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802dd8:	00 
+  802dd9:	eb 95                	jmp    802d70 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ddb:	48 98                	cltq
+  802ddd:	eb 91                	jmp    802d70 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802ddf:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802de3:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802de6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dea:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802dee:	48 89 df             	mov    %rbx,%rdi
+  802df1:	48 b8 e7 28 80 00 00 	movabs $0x8028e7,%rax
+  802df8:	00 00 00 
+  802dfb:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802dfd:	48 85 c0             	test   %rax,%rax
+  802e00:	0f 8e 6a ff ff ff    	jle    802d70 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802e06:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802e09:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e0d:	e9 5e ff ff ff       	jmp    802d70 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e12:	48 98                	cltq
+  802e14:	4d 85 ff             	test   %r15,%r15
+  802e17:	49 0f 45 c7          	cmovne %r15,%rax
+  802e1b:	e9 50 ff ff ff       	jmp    802d70 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e20:	48 89 de             	mov    %rbx,%rsi
+  802e23:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e27:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  802e2e:	00 00 00 
+  802e31:	ff d0                	call   *%rax
+  802e33:	85 c0                	test   %eax,%eax
+  802e35:	0f 88 2b 01 00 00    	js     802f66 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802e3b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e3f:	4c 01 f8             	add    %r15,%rax
+  802e42:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802e46:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e4a:	48 b9 f6 1e 80 00 00 	movabs $0x801ef6,%rcx
+  802e51:	00 00 00 
+  802e54:	ff d1                	call   *%rcx
+  802e56:	48 89 c2             	mov    %rax,%rdx
+  802e59:	48 c1 e2 04          	shl    $0x4,%rdx
+  802e5d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802e61:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e65:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802e6a:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802e6d:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802e74:	00 
+  802e75:	4c 89 ea             	mov    %r13,%rdx
+  802e78:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802e7c:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  802e83:	00 00 00 
+  802e86:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802e88:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802e8c:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802e90:	48 39 c2             	cmp    %rax,%rdx
+  802e93:	0f 84 db 00 00 00    	je     802f74 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802e99:	4c 39 e2             	cmp    %r12,%rdx
+  802e9c:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802ea0:	4d 01 ec             	add    %r13,%r12
+  802ea3:	49 39 c4             	cmp    %rax,%r12
+  802ea6:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802eaa:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802eae:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802eb2:	45 01 ee             	add    %r13d,%r14d
+  802eb5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802eb9:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802ebd:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802ec0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ec4:	49 39 c7             	cmp    %rax,%r15
+  802ec7:	0f 83 a0 fe ff ff    	jae    802d6d <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802ecd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ed1:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802ed5:	8b 43 08             	mov    0x8(%rbx),%eax
+  802ed8:	44 39 f0             	cmp    %r14d,%eax
+  802edb:	7f 10                	jg     802eed <devfile_write+0x1d3>
+  802edd:	48 98                	cltq
+  802edf:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802ee5:	49 63 d6             	movslq %r14d,%rdx
+  802ee8:	48 39 d0             	cmp    %rdx,%rax
+  802eeb:	7d 2d                	jge    802f1a <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802eed:	48 89 de             	mov    %rbx,%rsi
+  802ef0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802ef4:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  802efb:	00 00 00 
+  802efe:	ff d0                	call   *%rax
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	0f 88 0a ff ff ff    	js     802e12 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802f08:	44 89 f0             	mov    %r14d,%eax
+  802f0b:	66 b8 00 00          	mov    $0x0,%ax
+  802f0f:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802f12:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802f19:	00 
+        size_t off = pos - fb->fb_base;
+  802f1a:	45 89 f4             	mov    %r14d,%r12d
+  802f1d:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802f21:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802f24:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802f28:	4d 29 fd             	sub    %r15,%r13
+  802f2b:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802f30:	4c 29 e0             	sub    %r12,%rax
+  802f33:	49 39 c5             	cmp    %rax,%r13
+  802f36:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802f3a:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802f3e:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802f42:	48 39 c2             	cmp    %rax,%rdx
+  802f45:	0f 84 f0 fe ff ff    	je     802e3b <devfile_write+0x121>
+  802f4b:	4c 39 e0             	cmp    %r12,%rax
+  802f4e:	0f 82 cc fe ff ff    	jb     802e20 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802f54:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802f58:	48 39 d0             	cmp    %rdx,%rax
+  802f5b:	0f 83 da fe ff ff    	jae    802e3b <devfile_write+0x121>
+  802f61:	e9 ba fe ff ff       	jmp    802e20 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f66:	48 98                	cltq
+  802f68:	4d 85 ff             	test   %r15,%r15
+  802f6b:	49 0f 45 c7          	cmovne %r15,%rax
+  802f6f:	e9 fc fd ff ff       	jmp    802d70 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802f74:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802f78:	4c 89 e2             	mov    %r12,%rdx
+  802f7b:	e9 2a ff ff ff       	jmp    802eaa <devfile_write+0x190>
+
+0000000000802f80 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802f80:	55                   	push   %rbp
+  802f81:	48 89 e5             	mov    %rsp,%rbp
+  802f84:	41 57                	push   %r15
+  802f86:	41 56                	push   %r14
+  802f88:	41 55                	push   %r13
+  802f8a:	41 54                	push   %r12
+  802f8c:	53                   	push   %rbx
+  802f8d:	48 83 ec 28          	sub    $0x28,%rsp
+  802f91:	49 89 ff             	mov    %rdi,%r15
+  802f94:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f98:	48 89 d3             	mov    %rdx,%rbx
+  802f9b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f9f:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802fa6:	00 00 00 
+  802fa9:	ff d0                	call   *%rax
+  802fab:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802fae:	48 85 c0             	test   %rax,%rax
+  802fb1:	74 0d                	je     802fc0 <devfile_read+0x40>
+  802fb3:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802fba:	0f 86 1a 01 00 00    	jbe    8030da <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802fc0:	4d 85 e4             	test   %r12,%r12
+  802fc3:	74 1a                	je     802fdf <devfile_read+0x5f>
+  802fc5:	4c 89 e6             	mov    %r12,%rsi
+  802fc8:	4c 89 ff             	mov    %r15,%rdi
+  802fcb:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  802fd2:	00 00 00 
+  802fd5:	ff d0                	call   *%rax
+  802fd7:	85 c0                	test   %eax,%eax
+  802fd9:	0f 88 e8 00 00 00    	js     8030c7 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802fdf:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802fe3:	48 b8 e4 27 80 00 00 	movabs $0x8027e4,%rax
+  802fea:	00 00 00 
+  802fed:	ff d0                	call   *%rax
+  802fef:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802ff2:	48 85 c0             	test   %rax,%rax
+  802ff5:	0f 84 69 02 00 00    	je     803264 <devfile_read+0x2e4>
+    while (i < n) {
+  802ffb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803000:	0f 84 ce 00 00 00    	je     8030d4 <devfile_read+0x154>
+    size_t i = 0;
+  803006:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80300b:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803012:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803016:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80301a:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  80301e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803022:	48 29 da             	sub    %rbx,%rdx
+  803025:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80302a:	48 39 c2             	cmp    %rax,%rdx
+  80302d:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803031:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803035:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803039:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80303c:	01 d8                	add    %ebx,%eax
+  80303e:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803042:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803046:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  80304d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803054:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80305b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803061:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803066:	4c 89 ee             	mov    %r13,%rsi
+  803069:	bf 03 00 00 00       	mov    $0x3,%edi
+  80306e:	48 b8 4a 28 80 00 00 	movabs $0x80284a,%rax
+  803075:	00 00 00 
+  803078:	ff d0                	call   *%rax
+        if (res < 0)
+  80307a:	85 c0                	test   %eax,%eax
+  80307c:	78 4d                	js     8030cb <devfile_read+0x14b>
+        if (res == 0)
+  80307e:	74 4f                	je     8030cf <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803080:	4c 63 e0             	movslq %eax,%r12
+  803083:	4c 89 e2             	mov    %r12,%rdx
+  803086:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80308a:	4c 89 f7             	mov    %r14,%rdi
+  80308d:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  803094:	00 00 00 
+  803097:	ff d0                	call   *%rax
+        i += res;
+  803099:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  80309c:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  80309f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030a3:	48 39 c3             	cmp    %rax,%rbx
+  8030a6:	0f 82 72 ff ff ff    	jb     80301e <devfile_read+0x9e>
+    return i;
+  8030ac:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8030af:	48 85 c0             	test   %rax,%rax
+  8030b2:	7e 04                	jle    8030b8 <devfile_read+0x138>
+  8030b4:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8030b8:	48 83 c4 28          	add    $0x28,%rsp
+  8030bc:	5b                   	pop    %rbx
+  8030bd:	41 5c                	pop    %r12
+  8030bf:	41 5d                	pop    %r13
+  8030c1:	41 5e                	pop    %r14
+  8030c3:	41 5f                	pop    %r15
+  8030c5:	5d                   	pop    %rbp
+  8030c6:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8030c7:	48 98                	cltq
+  8030c9:	eb ed                	jmp    8030b8 <devfile_read+0x138>
+            return res;
+  8030cb:	48 98                	cltq
+  8030cd:	eb e9                	jmp    8030b8 <devfile_read+0x138>
+            return i;
+  8030cf:	48 89 d8             	mov    %rbx,%rax
+  8030d2:	eb db                	jmp    8030af <devfile_read+0x12f>
+    size_t i = 0;
+  8030d4:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8030d8:	eb d2                	jmp    8030ac <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8030da:	48 89 c6             	mov    %rax,%rsi
+  8030dd:	4c 89 ff             	mov    %r15,%rdi
+  8030e0:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  8030e7:	00 00 00 
+  8030ea:	ff d0                	call   *%rax
+  8030ec:	85 c0                	test   %eax,%eax
+  8030ee:	78 40                	js     803130 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8030f0:	4c 89 ff             	mov    %r15,%rdi
+  8030f3:	48 b8 f6 1e 80 00 00 	movabs $0x801ef6,%rax
+  8030fa:	00 00 00 
+  8030fd:	ff d0                	call   *%rax
+  8030ff:	48 89 c2             	mov    %rax,%rdx
+  803102:	48 c1 e2 04          	shl    $0x4,%rdx
+  803106:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80310a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80310e:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803113:	48 01 d0             	add    %rdx,%rax
+  803116:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80311a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80311f:	0f 84 33 01 00 00    	je     803258 <devfile_read+0x2d8>
+    size_t i = 0;
+  803125:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80312b:	e9 f5 00 00 00       	jmp    803225 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803130:	48 98                	cltq
+  803132:	eb 84                	jmp    8030b8 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803134:	44 89 e8             	mov    %r13d,%eax
+  803137:	66 b8 00 00          	mov    $0x0,%ax
+  80313b:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803140:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803147:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803149:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80314d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803151:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803153:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803158:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80315b:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803162:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803163:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803169:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80316e:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803173:	bf 03 00 00 00       	mov    $0x3,%edi
+  803178:	48 b8 4a 28 80 00 00 	movabs $0x80284a,%rax
+  80317f:	00 00 00 
+  803182:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803184:	85 c0                	test   %eax,%eax
+  803186:	0f 88 be 00 00 00    	js     80324a <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80318c:	48 63 d0             	movslq %eax,%rdx
+  80318f:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803194:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803199:	44 39 e8             	cmp    %r13d,%eax
+  80319c:	0f 8e ba 00 00 00    	jle    80325c <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8031a2:	49 63 c5             	movslq %r13d,%rax
+  8031a5:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8031aa:	48 29 c3             	sub    %rax,%rbx
+  8031ad:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8031b2:	48 01 c3             	add    %rax,%rbx
+  8031b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031b9:	4c 29 f0             	sub    %r14,%rax
+  8031bc:	48 39 c3             	cmp    %rax,%rbx
+  8031bf:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8031c3:	4c 89 ff             	mov    %r15,%rdi
+  8031c6:	48 b9 f6 1e 80 00 00 	movabs $0x801ef6,%rcx
+  8031cd:	00 00 00 
+  8031d0:	ff d1                	call   *%rcx
+  8031d2:	48 89 c2             	mov    %rax,%rdx
+  8031d5:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031d9:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8031dd:	48 c1 e0 0c          	shl    $0xc,%rax
+  8031e1:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8031e6:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8031e9:	44 89 ea             	mov    %r13d,%edx
+  8031ec:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8031f1:	48 63 d2             	movslq %edx,%rdx
+  8031f4:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8031fb:	00 
+  8031fc:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803200:	4c 01 f7             	add    %r14,%rdi
+  803203:	48 89 da             	mov    %rbx,%rdx
+  803206:	48 b9 75 11 80 00 00 	movabs $0x801175,%rcx
+  80320d:	00 00 00 
+  803210:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803212:	41 01 dd             	add    %ebx,%r13d
+  803215:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803219:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80321c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803220:	49 39 c6             	cmp    %rax,%r14
+  803223:	73 37                	jae    80325c <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803225:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803229:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80322e:	44 39 e8             	cmp    %r13d,%eax
+  803231:	0f 8f fd fe ff ff    	jg     803134 <devfile_read+0x1b4>
+  803237:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80323c:	44 39 e8             	cmp    %r13d,%eax
+  80323f:	0f 8f 5d ff ff ff    	jg     8031a2 <devfile_read+0x222>
+  803245:	e9 ea fe ff ff       	jmp    803134 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80324a:	48 98                	cltq
+  80324c:	4d 85 f6             	test   %r14,%r14
+  80324f:	49 0f 45 c6          	cmovne %r14,%rax
+  803253:	e9 60 fe ff ff       	jmp    8030b8 <devfile_read+0x138>
+    size_t i = 0;
+  803258:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80325c:	4c 89 f0             	mov    %r14,%rax
+  80325f:	e9 54 fe ff ff       	jmp    8030b8 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803264:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80326b:	e9 48 fe ff ff       	jmp    8030b8 <devfile_read+0x138>
+
+0000000000803270 <open>:
+open(const char *path, int mode) {
+  803270:	55                   	push   %rbp
+  803271:	48 89 e5             	mov    %rsp,%rbp
+  803274:	41 55                	push   %r13
+  803276:	41 54                	push   %r12
+  803278:	53                   	push   %rbx
+  803279:	48 83 ec 18          	sub    $0x18,%rsp
+  80327d:	49 89 fc             	mov    %rdi,%r12
+  803280:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803283:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  80328a:	00 00 00 
+  80328d:	ff d0                	call   *%rax
+  80328f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803295:	0f 87 8a 00 00 00    	ja     803325 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80329b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80329f:	48 b8 24 1f 80 00 00 	movabs $0x801f24,%rax
+  8032a6:	00 00 00 
+  8032a9:	ff d0                	call   *%rax
+  8032ab:	89 c3                	mov    %eax,%ebx
+  8032ad:	85 c0                	test   %eax,%eax
+  8032af:	78 50                	js     803301 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8032b1:	4c 89 e6             	mov    %r12,%rsi
+  8032b4:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8032bb:	00 00 00 
+  8032be:	48 89 df             	mov    %rbx,%rdi
+  8032c1:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  8032c8:	00 00 00 
+  8032cb:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8032cd:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8032d4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8032d8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8032dd:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  8032e4:	00 00 00 
+  8032e7:	ff d0                	call   *%rax
+  8032e9:	89 c3                	mov    %eax,%ebx
+  8032eb:	85 c0                	test   %eax,%eax
+  8032ed:	78 1f                	js     80330e <open+0x9e>
+    return fd2num(fd);
+  8032ef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032f3:	48 b8 f6 1e 80 00 00 	movabs $0x801ef6,%rax
+  8032fa:	00 00 00 
+  8032fd:	ff d0                	call   *%rax
+  8032ff:	89 c3                	mov    %eax,%ebx
+}
+  803301:	89 d8                	mov    %ebx,%eax
+  803303:	48 83 c4 18          	add    $0x18,%rsp
+  803307:	5b                   	pop    %rbx
+  803308:	41 5c                	pop    %r12
+  80330a:	41 5d                	pop    %r13
+  80330c:	5d                   	pop    %rbp
+  80330d:	c3                   	ret
+        fd_close(fd, 0);
+  80330e:	be 00 00 00 00       	mov    $0x0,%esi
+  803313:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803317:	48 b8 3f 20 80 00 00 	movabs $0x80203f,%rax
+  80331e:	00 00 00 
+  803321:	ff d0                	call   *%rax
+        return res;
+  803323:	eb dc                	jmp    803301 <open+0x91>
+        return -E_BAD_PATH;
+  803325:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80332a:	eb d5                	jmp    803301 <open+0x91>
+
+000000000080332c <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80332c:	55                   	push   %rbp
+  80332d:	48 89 e5             	mov    %rsp,%rbp
+  803330:	41 57                	push   %r15
+  803332:	41 56                	push   %r14
+  803334:	41 55                	push   %r13
+  803336:	41 54                	push   %r12
+  803338:	53                   	push   %rbx
+  803339:	48 83 ec 18          	sub    $0x18,%rsp
+  80333d:	41 89 f6             	mov    %esi,%r14d
+  803340:	49 89 d7             	mov    %rdx,%r15
+  803343:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803346:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80334a:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  803351:	00 00 00 
+  803354:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803356:	85 c0                	test   %eax,%eax
+  803358:	0f 88 db 00 00 00    	js     803439 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80335e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803362:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803369:	00 00 00 
+  80336c:	8b 00                	mov    (%rax),%eax
+  80336e:	39 07                	cmp    %eax,(%rdi)
+  803370:	0f 85 db 00 00 00    	jne    803451 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803376:	45 85 f6             	test   %r14d,%r14d
+  803379:	0f 88 db 00 00 00    	js     80345a <fmap+0x12e>
+  80337f:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803386:	0f 85 d7 00 00 00    	jne    803463 <fmap+0x137>
+  80338c:	4c 89 fb             	mov    %r15,%rbx
+  80338f:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803395:	0f 85 d1 00 00 00    	jne    80346c <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80339b:	48 b8 bc 2a 80 00 00 	movabs $0x802abc,%rax
+  8033a2:	00 00 00 
+  8033a5:	ff d0                	call   *%rax
+  8033a7:	85 c0                	test   %eax,%eax
+  8033a9:	0f 88 8e 00 00 00    	js     80343d <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8033af:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8033b6:	00 00 00 
+    while (i < n) {
+  8033b9:	4d 85 ed             	test   %r13,%r13
+  8033bc:	0f 84 8a 00 00 00    	je     80344c <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8033c2:	4c 89 ea             	mov    %r13,%rdx
+  8033c5:	48 29 da             	sub    %rbx,%rdx
+  8033c8:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8033cf:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8033d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8033d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033dd:	8b 40 0c             	mov    0xc(%rax),%eax
+  8033e0:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8033e4:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8033e8:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8033ed:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8033f2:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8033f6:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8033fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033ff:	4c 89 e6             	mov    %r12,%rsi
+  803402:	bf 09 00 00 00       	mov    $0x9,%edi
+  803407:	48 b8 4a 28 80 00 00 	movabs $0x80284a,%rax
+  80340e:	00 00 00 
+  803411:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803413:	85 c0                	test   %eax,%eax
+  803415:	78 2a                	js     803441 <fmap+0x115>
+        i += res;
+  803417:	48 98                	cltq
+  803419:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80341c:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803420:	72 05                	jb     803427 <fmap+0xfb>
+    while (i < n) {
+  803422:	4c 39 eb             	cmp    %r13,%rbx
+  803425:	72 9b                	jb     8033c2 <fmap+0x96>
+    }
+    return i;
+  803427:	48 89 d8             	mov    %rbx,%rax
+}
+  80342a:	48 83 c4 18          	add    $0x18,%rsp
+  80342e:	5b                   	pop    %rbx
+  80342f:	41 5c                	pop    %r12
+  803431:	41 5d                	pop    %r13
+  803433:	41 5e                	pop    %r14
+  803435:	41 5f                	pop    %r15
+  803437:	5d                   	pop    %rbp
+  803438:	c3                   	ret
+    if (res < 0) return res;
+  803439:	48 98                	cltq
+  80343b:	eb ed                	jmp    80342a <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80343d:	48 98                	cltq
+  80343f:	eb e9                	jmp    80342a <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803441:	48 98                	cltq
+  803443:	48 85 db             	test   %rbx,%rbx
+  803446:	48 0f 45 c3          	cmovne %rbx,%rax
+  80344a:	eb de                	jmp    80342a <fmap+0xfe>
+    size_t i = 0;
+  80344c:	4c 89 eb             	mov    %r13,%rbx
+  80344f:	eb d6                	jmp    803427 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803451:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803458:	eb d0                	jmp    80342a <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80345a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803461:	eb c7                	jmp    80342a <fmap+0xfe>
+  803463:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80346a:	eb be                	jmp    80342a <fmap+0xfe>
+  80346c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803473:	eb b5                	jmp    80342a <fmap+0xfe>
+
+0000000000803475 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803475:	55                   	push   %rbp
+  803476:	48 89 e5             	mov    %rsp,%rbp
+  803479:	41 56                	push   %r14
+  80347b:	41 55                	push   %r13
+  80347d:	41 54                	push   %r12
+  80347f:	53                   	push   %rbx
+  803480:	48 83 ec 10          	sub    $0x10,%rsp
+  803484:	89 fb                	mov    %edi,%ebx
+  803486:	41 89 f4             	mov    %esi,%r12d
+  803489:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80348c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803490:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  803497:	00 00 00 
+  80349a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80349c:	85 c0                	test   %eax,%eax
+  80349e:	78 63                	js     803503 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8034a0:	45 85 e4             	test   %r12d,%r12d
+  8034a3:	0f 88 80 00 00 00    	js     803529 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8034a9:	45 89 e6             	mov    %r12d,%r14d
+  8034ac:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8034b3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034b7:	48 b8 08 1f 80 00 00 	movabs $0x801f08,%rax
+  8034be:	00 00 00 
+  8034c1:	ff d0                	call   *%rax
+  8034c3:	48 89 c2             	mov    %rax,%rdx
+  8034c6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8034cb:	44 89 f6             	mov    %r14d,%esi
+  8034ce:	89 df                	mov    %ebx,%edi
+  8034d0:	48 b8 2c 33 80 00 00 	movabs $0x80332c,%rax
+  8034d7:	00 00 00 
+  8034da:	ff d0                	call   *%rax
+  8034dc:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8034df:	45 29 f4             	sub    %r14d,%r12d
+  8034e2:	4d 63 f4             	movslq %r12d,%r14
+  8034e5:	49 39 c6             	cmp    %rax,%r14
+  8034e8:	7c 1d                	jl     803507 <read_map+0x92>
+  8034ea:	48 85 c0             	test   %rax,%rax
+  8034ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f2:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8034f6:	48 83 c4 10          	add    $0x10,%rsp
+  8034fa:	5b                   	pop    %rbx
+  8034fb:	41 5c                	pop    %r12
+  8034fd:	41 5d                	pop    %r13
+  8034ff:	41 5e                	pop    %r14
+  803501:	5d                   	pop    %rbp
+  803502:	c3                   	ret
+    if (res < 0) return res;
+  803503:	48 98                	cltq
+  803505:	eb ef                	jmp    8034f6 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803507:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80350b:	48 b8 08 1f 80 00 00 	movabs $0x801f08,%rax
+  803512:	00 00 00 
+  803515:	ff d0                	call   *%rax
+  803517:	4d 63 e4             	movslq %r12d,%r12
+  80351a:	4c 01 e0             	add    %r12,%rax
+  80351d:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803521:	48 89 d8             	mov    %rbx,%rax
+  803524:	4c 29 f0             	sub    %r14,%rax
+  803527:	eb cd                	jmp    8034f6 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803529:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803530:	eb c4                	jmp    8034f6 <read_map+0x81>
+
+0000000000803532 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803532:	55                   	push   %rbp
+  803533:	48 89 e5             	mov    %rsp,%rbp
+  803536:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80353a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80353e:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  803545:	00 00 00 
+  803548:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80354a:	85 c0                	test   %eax,%eax
+  80354c:	78 4a                	js     803598 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80354e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803552:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803559:	00 00 00 
+  80355c:	8b 00                	mov    (%rax),%eax
+  80355e:	39 07                	cmp    %eax,(%rdi)
+  803560:	75 38                	jne    80359a <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803562:	48 b8 bc 2a 80 00 00 	movabs $0x802abc,%rax
+  803569:	00 00 00 
+  80356c:	ff d0                	call   *%rax
+  80356e:	85 c0                	test   %eax,%eax
+  803570:	78 26                	js     803598 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803572:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803576:	8b 40 0c             	mov    0xc(%rax),%eax
+  803579:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803580:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803582:	be 00 00 00 00       	mov    $0x0,%esi
+  803587:	bf 06 00 00 00       	mov    $0x6,%edi
+  80358c:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  803593:	00 00 00 
+  803596:	ff d0                	call   *%rax
+}
+  803598:	c9                   	leave
+  803599:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80359a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80359f:	eb f7                	jmp    803598 <fsync+0x66>
+
+00000000008035a1 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8035a1:	55                   	push   %rbp
+  8035a2:	48 89 e5             	mov    %rsp,%rbp
+  8035a5:	41 57                	push   %r15
+  8035a7:	41 56                	push   %r14
+  8035a9:	41 55                	push   %r13
+  8035ab:	41 54                	push   %r12
+  8035ad:	53                   	push   %rbx
+  8035ae:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8035b2:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8035b9:	00 00 00 
+  8035bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8035c1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8035c7:	49 bd 84 1f 80 00 00 	movabs $0x801f84,%r13
+  8035ce:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8035d1:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8035d8:	00 00 00 
+  8035db:	eb 0c                	jmp    8035e9 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8035dd:	83 c3 01             	add    $0x1,%ebx
+  8035e0:	49 83 c4 28          	add    $0x28,%r12
+  8035e4:	83 fb 20             	cmp    $0x20,%ebx
+  8035e7:	74 33                	je     80361c <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8035e9:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8035ee:	74 ed                	je     8035dd <flushall+0x3c>
+  8035f0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8035f4:	89 df                	mov    %ebx,%edi
+  8035f6:	41 ff d5             	call   *%r13
+  8035f9:	85 c0                	test   %eax,%eax
+  8035fb:	78 e0                	js     8035dd <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8035fd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803601:	41 8b 06             	mov    (%r14),%eax
+  803604:	39 07                	cmp    %eax,(%rdi)
+  803606:	75 d5                	jne    8035dd <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803608:	48 b8 bc 2a 80 00 00 	movabs $0x802abc,%rax
+  80360f:	00 00 00 
+  803612:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803614:	85 c0                	test   %eax,%eax
+  803616:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80361a:	eb c1                	jmp    8035dd <flushall+0x3c>
+    }
+    return res;
+}
+  80361c:	44 89 f8             	mov    %r15d,%eax
+  80361f:	48 83 c4 18          	add    $0x18,%rsp
+  803623:	5b                   	pop    %rbx
+  803624:	41 5c                	pop    %r12
+  803626:	41 5d                	pop    %r13
+  803628:	41 5e                	pop    %r14
+  80362a:	41 5f                	pop    %r15
+  80362c:	5d                   	pop    %rbp
+  80362d:	c3                   	ret
+
+000000000080362e <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80362e:	55                   	push   %rbp
+  80362f:	48 89 e5             	mov    %rsp,%rbp
+  803632:	53                   	push   %rbx
+  803633:	48 83 ec 08          	sub    $0x8,%rsp
+  803637:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80363a:	40 0f b6 c6          	movzbl %sil,%eax
+  80363e:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803645:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803647:	be 00 00 00 00       	mov    $0x0,%esi
+  80364c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803651:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  803658:	00 00 00 
+  80365b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80365d:	85 c0                	test   %eax,%eax
+  80365f:	78 23                	js     803684 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803661:	ba 58 06 00 00       	mov    $0x658,%edx
+  803666:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80366d:	00 00 00 
+  803670:	48 89 df             	mov    %rbx,%rdi
+  803673:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  80367a:	00 00 00 
+  80367d:	ff d0                	call   *%rax
+    return 0;
+  80367f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803684:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803688:	c9                   	leave
+  803689:	c3                   	ret
+
+000000000080368a <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80368a:	55                   	push   %rbp
+  80368b:	48 89 e5             	mov    %rsp,%rbp
+  80368e:	53                   	push   %rbx
+  80368f:	48 83 ec 08          	sub    $0x8,%rsp
+  803693:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803696:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  80369d:	00 00 00 
+  8036a0:	ff d0                	call   *%rax
+  8036a2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8036a8:	77 35                	ja     8036df <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8036aa:	48 89 de             	mov    %rbx,%rsi
+  8036ad:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8036b4:	00 00 00 
+  8036b7:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  8036be:	00 00 00 
+  8036c1:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8036c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8036c8:	bf 07 00 00 00       	mov    $0x7,%edi
+  8036cd:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  8036d4:	00 00 00 
+  8036d7:	ff d0                	call   *%rax
+}
+  8036d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036dd:	c9                   	leave
+  8036de:	c3                   	ret
+        return -E_BAD_PATH;
+  8036df:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8036e4:	eb f3                	jmp    8036d9 <remove+0x4f>
+
+00000000008036e6 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8036e6:	55                   	push   %rbp
+  8036e7:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8036ea:	48 b8 a1 35 80 00 00 	movabs $0x8035a1,%rax
+  8036f1:	00 00 00 
+  8036f4:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8036f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8036fb:	bf 08 00 00 00       	mov    $0x8,%edi
+  803700:	48 b8 f6 2a 80 00 00 	movabs $0x802af6,%rax
+  803707:	00 00 00 
+  80370a:	ff d0                	call   *%rax
+}
+  80370c:	5d                   	pop    %rbp
+  80370d:	c3                   	ret
+
+000000000080370e <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  80370e:	55                   	push   %rbp
+  80370f:	48 89 e5             	mov    %rsp,%rbp
+  803712:	41 55                	push   %r13
+  803714:	41 54                	push   %r12
+  803716:	53                   	push   %rbx
+  803717:	48 83 ec 08          	sub    $0x8,%rsp
+  80371b:	48 89 fb             	mov    %rdi,%rbx
+  80371e:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803721:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  803724:	48 b8 5f 46 80 00 00 	movabs $0x80465f,%rax
+  80372b:	00 00 00 
+  80372e:	ff d0                	call   *%rax
+  803730:	41 89 c1             	mov    %eax,%r9d
+  803733:	4d 89 e0             	mov    %r12,%r8
+  803736:	49 29 d8             	sub    %rbx,%r8
+  803739:	48 89 d9             	mov    %rbx,%rcx
+  80373c:	44 89 ea             	mov    %r13d,%edx
+  80373f:	48 89 de             	mov    %rbx,%rsi
+  803742:	bf 00 00 00 00       	mov    $0x0,%edi
+  803747:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  80374e:	00 00 00 
+  803751:	ff d0                	call   *%rax
+}
+  803753:	48 83 c4 08          	add    $0x8,%rsp
+  803757:	5b                   	pop    %rbx
+  803758:	41 5c                	pop    %r12
+  80375a:	41 5d                	pop    %r13
+  80375c:	5d                   	pop    %rbp
+  80375d:	c3                   	ret
+
+000000000080375e <spawn>:
+spawn(const char *prog, const char **argv) {
+  80375e:	55                   	push   %rbp
+  80375f:	48 89 e5             	mov    %rsp,%rbp
+  803762:	41 57                	push   %r15
+  803764:	41 56                	push   %r14
+  803766:	41 55                	push   %r13
+  803768:	41 54                	push   %r12
+  80376a:	53                   	push   %rbx
+  80376b:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  803772:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  803775:	be 00 00 00 00       	mov    $0x0,%esi
+  80377a:	48 b8 70 32 80 00 00 	movabs $0x803270,%rax
+  803781:	00 00 00 
+  803784:	ff d0                	call   *%rax
+  803786:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+    if (fd < 0) return fd;
+  80378c:	85 c0                	test   %eax,%eax
+  80378e:	0f 88 8f 06 00 00    	js     803e23 <spawn+0x6c5>
+  803794:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803796:	ba 00 02 00 00       	mov    $0x200,%edx
+  80379b:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  8037a2:	48 b8 25 23 80 00 00 	movabs $0x802325,%rax
+  8037a9:	00 00 00 
+  8037ac:	ff d0                	call   *%rax
+  8037ae:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8037b0:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8037b5:	0f 85 88 02 00 00    	jne    803a43 <spawn+0x2e5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8037bb:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8037c2:	ff ff 00 
+  8037c5:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8037cc:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  8037d3:	01 01 00 
+  8037d6:	48 39 d0             	cmp    %rdx,%rax
+  8037d9:	0f 85 a0 02 00 00    	jne    803a7f <spawn+0x321>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8037df:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  8037e6:	00 3e 00 
+  8037e9:	0f 85 90 02 00 00    	jne    803a7f <spawn+0x321>
+    flushall();
+  8037ef:	48 b8 a1 35 80 00 00 	movabs $0x8035a1,%rax
+  8037f6:	00 00 00 
+  8037f9:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8037fb:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803800:	cd 30                	int    $0x30
+  803802:	41 89 c7             	mov    %eax,%r15d
+  803805:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  80380b:	85 c0                	test   %eax,%eax
+  80380d:	0f 88 f2 05 00 00    	js     803e05 <spawn+0x6a7>
+    envid_t child = res;
+  803813:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803819:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80381e:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  803825:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  80382c:	00 00 00 
+  80382f:	48 01 c6             	add    %rax,%rsi
+  803832:	48 8b 06             	mov    (%rsi),%rax
+  803835:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  80383c:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803843:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  80384a:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803851:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803858:	48 29 ce             	sub    %rcx,%rsi
+  80385b:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803861:	c1 e9 03             	shr    $0x3,%ecx
+  803864:	89 c9                	mov    %ecx,%ecx
+  803866:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803869:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803870:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803877:	48 8b 3b             	mov    (%rbx),%rdi
+  80387a:	48 85 ff             	test   %rdi,%rdi
+  80387d:	0f 84 b8 05 00 00    	je     803e3b <spawn+0x6dd>
+  803883:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  803889:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  80388f:	49 be 42 0d 80 00 00 	movabs $0x800d42,%r14
+  803896:	00 00 00 
+  803899:	41 ff d6             	call   *%r14
+  80389c:	4c 01 e8             	add    %r13,%rax
+  80389f:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  8038a3:	4c 89 a5 f8 fc ff ff 	mov    %r12,-0x308(%rbp)
+  8038aa:	49 83 c4 01          	add    $0x1,%r12
+  8038ae:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  8038b3:	48 85 ff             	test   %rdi,%rdi
+  8038b6:	75 e1                	jne    803899 <spawn+0x13b>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8038b8:	48 f7 d0             	not    %rax
+  8038bb:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8038c2:	4d 89 e6             	mov    %r12,%r14
+  8038c5:	49 83 e6 f8          	and    $0xfffffffffffffff8,%r14
+  8038c9:	4c 89 b5 f0 fc ff ff 	mov    %r14,-0x310(%rbp)
+  8038d0:	4c 8b ad f8 fc ff ff 	mov    -0x308(%rbp),%r13
+  8038d7:	44 89 e8             	mov    %r13d,%eax
+  8038da:	83 c0 01             	add    $0x1,%eax
+  8038dd:	48 98                	cltq
+  8038df:	48 c1 e0 03          	shl    $0x3,%rax
+  8038e3:	49 29 c6             	sub    %rax,%r14
+  8038e6:	4c 89 b5 e0 fc ff ff 	mov    %r14,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8038ed:	49 8d 46 f0          	lea    -0x10(%r14),%rax
+  8038f1:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8038f7:	0f 86 eb 04 00 00    	jbe    803de8 <spawn+0x68a>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8038fd:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803902:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803907:	be 00 00 40 00       	mov    $0x400000,%esi
+  80390c:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  803913:	00 00 00 
+  803916:	ff d0                	call   *%rax
+  803918:	85 c0                	test   %eax,%eax
+  80391a:	0f 88 cd 04 00 00    	js     803ded <spawn+0x68f>
+    for (i = 0; i < argc; i++) {
+  803920:	4c 89 e8             	mov    %r13,%rax
+  803923:	45 85 ed             	test   %r13d,%r13d
+  803926:	7e 52                	jle    80397a <spawn+0x21c>
+  803928:	4d 89 f5             	mov    %r14,%r13
+  80392b:	48 98                	cltq
+  80392d:	4d 8d 34 c6          	lea    (%r14,%rax,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803931:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  803938:	00 00 00 
+  80393b:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  803942:	ff 
+  803943:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803947:	48 8b 33             	mov    (%rbx),%rsi
+  80394a:	4c 89 e7             	mov    %r12,%rdi
+  80394d:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  803954:	00 00 00 
+  803957:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803959:	48 8b 3b             	mov    (%rbx),%rdi
+  80395c:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  803963:	00 00 00 
+  803966:	ff d0                	call   *%rax
+  803968:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  80396d:	49 83 c5 08          	add    $0x8,%r13
+  803971:	48 83 c3 08          	add    $0x8,%rbx
+  803975:	4d 39 f5             	cmp    %r14,%r13
+  803978:	75 b7                	jne    803931 <spawn+0x1d3>
+    argv_store[argc] = 0;
+  80397a:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  803981:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803988:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803989:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  803990:	0f 85 30 01 00 00    	jne    803ac6 <spawn+0x368>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803996:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  80399d:	00 00 00 
+  8039a0:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  8039a7:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  8039ae:	ff 
+  8039af:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  8039b3:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  8039ba:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8039be:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8039c5:	00 00 00 
+  8039c8:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8039cf:	ff 
+  8039d0:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8039d7:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8039dd:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  8039e3:	44 89 fa             	mov    %r15d,%edx
+  8039e6:	be 00 00 40 00       	mov    $0x400000,%esi
+  8039eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039f0:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  8039f7:	00 00 00 
+  8039fa:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  8039fc:	48 bb bf 16 80 00 00 	movabs $0x8016bf,%rbx
+  803a03:	00 00 00 
+  803a06:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803a0b:	be 00 00 40 00       	mov    $0x400000,%esi
+  803a10:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a15:	ff d3                	call   *%rbx
+  803a17:	85 c0                	test   %eax,%eax
+  803a19:	78 eb                	js     803a06 <spawn+0x2a8>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803a1b:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803a22:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  803a29:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803a2a:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803a31:	00 
+  803a32:	0f 84 a1 02 00 00    	je     803cd9 <spawn+0x57b>
+  803a38:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803a3e:	e9 dd 00 00 00       	jmp    803b20 <spawn+0x3c2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803a43:	48 bf 80 57 80 00 00 	movabs $0x805780,%rdi
+  803a4a:	00 00 00 
+  803a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a52:	48 ba 08 04 80 00 00 	movabs $0x800408,%rdx
+  803a59:	00 00 00 
+  803a5c:	ff d2                	call   *%rdx
+        close(fd);
+  803a5e:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803a64:	48 b8 e9 20 80 00 00 	movabs $0x8020e9,%rax
+  803a6b:	00 00 00 
+  803a6e:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803a70:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  803a77:	ff ff ff 
+  803a7a:	e9 a4 03 00 00       	jmp    803e23 <spawn+0x6c5>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803a7f:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803a84:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803a8a:	48 bf e0 57 80 00 00 	movabs $0x8057e0,%rdi
+  803a91:	00 00 00 
+  803a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a99:	48 b9 08 04 80 00 00 	movabs $0x800408,%rcx
+  803aa0:	00 00 00 
+  803aa3:	ff d1                	call   *%rcx
+        close(fd);
+  803aa5:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803aab:	48 b8 e9 20 80 00 00 	movabs $0x8020e9,%rax
+  803ab2:	00 00 00 
+  803ab5:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803ab7:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  803abe:	ff ff ff 
+  803ac1:	e9 5d 03 00 00       	jmp    803e23 <spawn+0x6c5>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803ac6:	48 b9 b0 57 80 00 00 	movabs $0x8057b0,%rcx
+  803acd:	00 00 00 
+  803ad0:	48 ba fa 57 80 00 00 	movabs $0x8057fa,%rdx
+  803ad7:	00 00 00 
+  803ada:	be f3 00 00 00       	mov    $0xf3,%esi
+  803adf:	48 bf 0f 58 80 00 00 	movabs $0x80580f,%rdi
+  803ae6:	00 00 00 
+  803ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aee:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  803af5:	00 00 00 
+  803af8:	41 ff d0             	call   *%r8
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803afb:	83 bd f8 fc ff ff 00 	cmpl   $0x0,-0x308(%rbp)
+  803b02:	0f 88 eb 02 00 00    	js     803df3 <spawn+0x695>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803b08:	49 83 c7 01          	add    $0x1,%r15
+  803b0c:	48 83 c3 38          	add    $0x38,%rbx
+  803b10:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803b17:	49 39 c7             	cmp    %rax,%r15
+  803b1a:	0f 83 b9 01 00 00    	jae    803cd9 <spawn+0x57b>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803b20:	83 3b 01             	cmpl   $0x1,(%rbx)
+  803b23:	75 e3                	jne    803b08 <spawn+0x3aa>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803b25:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b28:	41 89 c4             	mov    %eax,%r12d
+  803b2b:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803b2f:	44 89 e2             	mov    %r12d,%edx
+  803b32:	83 ca 04             	or     $0x4,%edx
+  803b35:	a8 04                	test   $0x4,%al
+  803b37:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803b3b:	44 89 e2             	mov    %r12d,%edx
+  803b3e:	83 ca 01             	or     $0x1,%edx
+  803b41:	a8 01                	test   $0x1,%al
+  803b43:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803b47:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  803b4b:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+  803b51:	4c 8b 6b 20          	mov    0x20(%rbx),%r13
+  803b55:	4c 8b 73 28          	mov    0x28(%rbx),%r14
+  803b59:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  803b5d:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  803b64:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803b6a:	89 8d e0 fc ff ff    	mov    %ecx,-0x320(%rbp)
+
+    // cprintf("map_segment %x+%x\n", va, memsz);
+
+    /* Fixup unaligned destination */
+    int res = PAGE_OFFSET(va);
+    if (res) {
+  803b70:	89 f2                	mov    %esi,%edx
+  803b72:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803b78:	74 1b                	je     803b95 <spawn+0x437>
+        va -= res;
+  803b7a:	48 63 ca             	movslq %edx,%rcx
+  803b7d:	48 29 ce             	sub    %rcx,%rsi
+  803b80:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  803b87:	49 01 ce             	add    %rcx,%r14
+        filesz += res;
+  803b8a:	49 01 cd             	add    %rcx,%r13
+        fileoffset -= res;
+  803b8d:	29 d0                	sub    %edx,%eax
+  803b8f:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+    }
+
+    /* NOTE: There's restriction on maximal filesz
+     * for each program segment (HUGE_PAGE_SIZE) */
+    if (filesz > HUGE_PAGE_SIZE || filesz > memsz)
+  803b95:	b8 00 00 20 00       	mov    $0x200000,%eax
+  803b9a:	49 39 c6             	cmp    %rax,%r14
+  803b9d:	49 0f 46 c6          	cmovbe %r14,%rax
+  803ba1:	4c 39 e8             	cmp    %r13,%rax
+  803ba4:	0f 82 32 02 00 00    	jb     803ddc <spawn+0x67e>
+    /* Allocate filesz in parent to UTEMP */
+    /* seek() fd to fileoffset  */
+    /* read filesz to UTEMP */
+    /* Map read section conents to child */
+    /* Unmap it from parent */
+    res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, 4096), memsz, perm);
+  803baa:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  803bb1:	49 8d b4 05 ff 0f 00 	lea    0xfff(%r13,%rax,1),%rsi
+  803bb8:	00 
+  803bb9:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803bc0:	44 89 e1             	mov    %r12d,%ecx
+  803bc3:	4c 89 f2             	mov    %r14,%rdx
+  803bc6:	8b bd e0 fc ff ff    	mov    -0x320(%rbp),%edi
+  803bcc:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  803bd3:	00 00 00 
+  803bd6:	ff d0                	call   *%rax
+  803bd8:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (memsz > filesz && res)
+  803bde:	4d 39 f5             	cmp    %r14,%r13
+  803be1:	73 08                	jae    803beb <spawn+0x48d>
+  803be3:	85 c0                	test   %eax,%eax
+  803be5:	0f 85 10 ff ff ff    	jne    803afb <spawn+0x39d>
+        return res;
+
+    if (filesz == 0)
+  803beb:	4d 85 ed             	test   %r13,%r13
+  803bee:	0f 84 14 ff ff ff    	je     803b08 <spawn+0x3aa>
+        return 0;
+
+    res = sys_alloc_region(0, UTEMP, ROUNDUP(filesz, 4096), PTE_P | PTE_U | PTE_W);
+  803bf4:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803bfb:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803c01:	49 89 c6             	mov    %rax,%r14
+  803c04:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803c09:	48 89 c2             	mov    %rax,%rdx
+  803c0c:	be 00 00 40 00       	mov    $0x400000,%esi
+  803c11:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c16:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  803c1d:	00 00 00 
+  803c20:	ff d0                	call   *%rax
+  803c22:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803c28:	85 c0                	test   %eax,%eax
+  803c2a:	0f 85 cb fe ff ff    	jne    803afb <spawn+0x39d>
+        return res;
+    res = seek(fd, fileoffset);
+  803c30:	8b b5 e8 fc ff ff    	mov    -0x318(%rbp),%esi
+  803c36:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803c3c:	48 b8 4f 24 80 00 00 	movabs $0x80244f,%rax
+  803c43:	00 00 00 
+  803c46:	ff d0                	call   *%rax
+  803c48:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803c4e:	85 c0                	test   %eax,%eax
+  803c50:	0f 85 a5 fe ff ff    	jne    803afb <spawn+0x39d>
+        return res;
+    res = readn(fd, UTEMP, filesz);
+  803c56:	4c 89 ea             	mov    %r13,%rdx
+  803c59:	be 00 00 40 00       	mov    $0x400000,%esi
+  803c5e:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803c64:	48 b8 25 23 80 00 00 	movabs $0x802325,%rax
+  803c6b:	00 00 00 
+  803c6e:	ff d0                	call   *%rax
+  803c70:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res < 0)
+  803c76:	85 c0                	test   %eax,%eax
+  803c78:	0f 88 75 01 00 00    	js     803df3 <spawn+0x695>
+        return res;
+    res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, 4096), perm);
+  803c7e:	45 89 e1             	mov    %r12d,%r9d
+  803c81:	4d 89 f0             	mov    %r14,%r8
+  803c84:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  803c8b:	8b 95 e0 fc ff ff    	mov    -0x320(%rbp),%edx
+  803c91:	be 00 00 40 00       	mov    $0x400000,%esi
+  803c96:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c9b:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  803ca2:	00 00 00 
+  803ca5:	ff d0                	call   *%rax
+  803ca7:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803cad:	85 c0                	test   %eax,%eax
+  803caf:	0f 85 46 fe ff ff    	jne    803afb <spawn+0x39d>
+        return res;
+    res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, 4096));
+  803cb5:	4c 89 f2             	mov    %r14,%rdx
+  803cb8:	be 00 00 40 00       	mov    $0x400000,%esi
+  803cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cc2:	48 b8 bf 16 80 00 00 	movabs $0x8016bf,%rax
+  803cc9:	00 00 00 
+  803ccc:	ff d0                	call   *%rax
+  803cce:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803cd4:	e9 22 fe ff ff       	jmp    803afb <spawn+0x39d>
+    close(fd);
+  803cd9:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803cdf:	48 b8 e9 20 80 00 00 	movabs $0x8020e9,%rax
+  803ce6:	00 00 00 
+  803ce9:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  803ceb:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803cf2:	48 bf 0e 37 80 00 00 	movabs $0x80370e,%rdi
+  803cf9:	00 00 00 
+  803cfc:	48 b8 d3 46 80 00 00 	movabs $0x8046d3,%rax
+  803d03:	00 00 00 
+  803d06:	ff d0                	call   *%rax
+  803d08:	85 c0                	test   %eax,%eax
+  803d0a:	78 49                	js     803d55 <spawn+0x5f7>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803d0c:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803d13:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803d19:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  803d20:	00 00 00 
+  803d23:	ff d0                	call   *%rax
+  803d25:	85 c0                	test   %eax,%eax
+  803d27:	78 59                	js     803d82 <spawn+0x624>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803d29:	be 02 00 00 00       	mov    $0x2,%esi
+  803d2e:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803d34:	48 b8 26 17 80 00 00 	movabs $0x801726,%rax
+  803d3b:	00 00 00 
+  803d3e:	ff d0                	call   *%rax
+  803d40:	85 c0                	test   %eax,%eax
+  803d42:	78 6b                	js     803daf <spawn+0x651>
+    return child;
+  803d44:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803d4a:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+  803d50:	e9 ce 00 00 00       	jmp    803e23 <spawn+0x6c5>
+        panic("copy_shared_region: %i", res);
+  803d55:	89 c1                	mov    %eax,%ecx
+  803d57:	48 ba 1b 58 80 00 00 	movabs $0x80581b,%rdx
+  803d5e:	00 00 00 
+  803d61:	be 87 00 00 00       	mov    $0x87,%esi
+  803d66:	48 bf 0f 58 80 00 00 	movabs $0x80580f,%rdi
+  803d6d:	00 00 00 
+  803d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d75:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  803d7c:	00 00 00 
+  803d7f:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  803d82:	89 c1                	mov    %eax,%ecx
+  803d84:	48 ba 32 58 80 00 00 	movabs $0x805832,%rdx
+  803d8b:	00 00 00 
+  803d8e:	be 8a 00 00 00       	mov    $0x8a,%esi
+  803d93:	48 bf 0f 58 80 00 00 	movabs $0x80580f,%rdi
+  803d9a:	00 00 00 
+  803d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803da2:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  803da9:	00 00 00 
+  803dac:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803daf:	89 c1                	mov    %eax,%ecx
+  803db1:	48 ba 4c 58 80 00 00 	movabs $0x80584c,%rdx
+  803db8:	00 00 00 
+  803dbb:	be 8d 00 00 00       	mov    $0x8d,%esi
+  803dc0:	48 bf 0f 58 80 00 00 	movabs $0x80580f,%rdi
+  803dc7:	00 00 00 
+  803dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dcf:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  803dd6:	00 00 00 
+  803dd9:	41 ff d0             	call   *%r8
+        return -E_INVALID_EXE;
+  803ddc:	c7 85 f8 fc ff ff f8 	movl   $0xfffffff8,-0x308(%rbp)
+  803de3:	ff ff ff 
+  803de6:	eb 0b                	jmp    803df3 <spawn+0x695>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803de8:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803ded:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    sys_env_destroy(child);
+  803df3:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803df9:	48 b8 b5 13 80 00 00 	movabs $0x8013b5,%rax
+  803e00:	00 00 00 
+  803e03:	ff d0                	call   *%rax
+    close(fd);
+  803e05:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803e0b:	48 b8 e9 20 80 00 00 	movabs $0x8020e9,%rax
+  803e12:	00 00 00 
+  803e15:	ff d0                	call   *%rax
+    return res;
+  803e17:	8b 85 f8 fc ff ff    	mov    -0x308(%rbp),%eax
+  803e1d:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+}
+  803e23:	8b 85 ec fc ff ff    	mov    -0x314(%rbp),%eax
+  803e29:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  803e30:	5b                   	pop    %rbx
+  803e31:	41 5c                	pop    %r12
+  803e33:	41 5d                	pop    %r13
+  803e35:	41 5e                	pop    %r14
+  803e37:	41 5f                	pop    %r15
+  803e39:	5d                   	pop    %rbp
+  803e3a:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803e3b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803e40:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803e45:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e4f:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  803e56:	00 00 00 
+  803e59:	ff d0                	call   *%rax
+  803e5b:	85 c0                	test   %eax,%eax
+  803e5d:	78 8e                	js     803ded <spawn+0x68f>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803e5f:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  803e66:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803e6a:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  803e71:	f8 ff 40 00 
+  803e75:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  803e7c:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803e80:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  803e86:	e9 ef fa ff ff       	jmp    80397a <spawn+0x21c>
+
+0000000000803e8b <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803e8b:	55                   	push   %rbp
+  803e8c:	48 89 e5             	mov    %rsp,%rbp
+  803e8f:	48 83 ec 50          	sub    $0x50,%rsp
+  803e93:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803e97:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803e9b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803e9f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803ea3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803eaa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803eae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803eb2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803eb6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803eba:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803ebf:	eb 15                	jmp    803ed6 <spawnl+0x4b>
+  803ec1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ec5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ec9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ecd:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803ed1:	74 1c                	je     803eef <spawnl+0x64>
+  803ed3:	83 c1 01             	add    $0x1,%ecx
+  803ed6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ed9:	83 f8 2f             	cmp    $0x2f,%eax
+  803edc:	77 e3                	ja     803ec1 <spawnl+0x36>
+  803ede:	89 c2                	mov    %eax,%edx
+  803ee0:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803ee4:	4c 01 d2             	add    %r10,%rdx
+  803ee7:	83 c0 08             	add    $0x8,%eax
+  803eea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803eed:	eb de                	jmp    803ecd <spawnl+0x42>
+    const char *argv[argc + 2];
+  803eef:	8d 41 02             	lea    0x2(%rcx),%eax
+  803ef2:	48 98                	cltq
+  803ef4:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803efb:	00 
+  803efc:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803f00:	48 29 c4             	sub    %rax,%rsp
+  803f03:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803f08:	4c 89 c0             	mov    %r8,%rax
+  803f0b:	48 c1 e8 03          	shr    $0x3,%rax
+  803f0f:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803f13:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803f1a:	00 
+    argv[argc + 1] = NULL;
+  803f1b:	8d 41 01             	lea    0x1(%rcx),%eax
+  803f1e:	48 98                	cltq
+  803f20:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803f27:	00 
+    va_start(vl, arg0);
+  803f28:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803f2f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f37:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f3b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803f3f:	85 c9                	test   %ecx,%ecx
+  803f41:	74 41                	je     803f84 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803f43:	49 89 c1             	mov    %rax,%r9
+  803f46:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803f4a:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803f4d:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803f52:	eb 1b                	jmp    803f6f <spawnl+0xe4>
+  803f54:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f58:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  803f5c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803f60:	48 8b 11             	mov    (%rcx),%rdx
+  803f63:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803f66:	48 83 c0 08          	add    $0x8,%rax
+  803f6a:	48 39 f0             	cmp    %rsi,%rax
+  803f6d:	74 15                	je     803f84 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803f6f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803f72:	83 fa 2f             	cmp    $0x2f,%edx
+  803f75:	77 dd                	ja     803f54 <spawnl+0xc9>
+  803f77:	89 d1                	mov    %edx,%ecx
+  803f79:	4c 01 c9             	add    %r9,%rcx
+  803f7c:	83 c2 08             	add    $0x8,%edx
+  803f7f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803f82:	eb dc                	jmp    803f60 <spawnl+0xd5>
+    return spawn(prog, argv);
+  803f84:	4c 89 c6             	mov    %r8,%rsi
+  803f87:	48 b8 5e 37 80 00 00 	movabs $0x80375e,%rax
+  803f8e:	00 00 00 
+  803f91:	ff d0                	call   *%rax
+}
+  803f93:	c9                   	leave
+  803f94:	c3                   	ret
+
+0000000000803f95 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803f95:	55                   	push   %rbp
+  803f96:	48 89 e5             	mov    %rsp,%rbp
+  803f99:	41 54                	push   %r12
+  803f9b:	53                   	push   %rbx
+  803f9c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f9f:	48 b8 08 1f 80 00 00 	movabs $0x801f08,%rax
+  803fa6:	00 00 00 
+  803fa9:	ff d0                	call   *%rax
+  803fab:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803fae:	48 be 63 58 80 00 00 	movabs $0x805863,%rsi
+  803fb5:	00 00 00 
+  803fb8:	48 89 df             	mov    %rbx,%rdi
+  803fbb:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  803fc2:	00 00 00 
+  803fc5:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803fc7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803fcc:	41 2b 04 24          	sub    (%r12),%eax
+  803fd0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803fd6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803fdd:	00 00 00 
+    stat->st_dev = &devpipe;
+  803fe0:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803fe7:	00 00 00 
+  803fea:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ff6:	5b                   	pop    %rbx
+  803ff7:	41 5c                	pop    %r12
+  803ff9:	5d                   	pop    %rbp
+  803ffa:	c3                   	ret
+
+0000000000803ffb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803ffb:	55                   	push   %rbp
+  803ffc:	48 89 e5             	mov    %rsp,%rbp
+  803fff:	41 54                	push   %r12
+  804001:	53                   	push   %rbx
+  804002:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804005:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80400a:	48 89 fe             	mov    %rdi,%rsi
+  80400d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804012:	49 bc bf 16 80 00 00 	movabs $0x8016bf,%r12
+  804019:	00 00 00 
+  80401c:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80401f:	48 89 df             	mov    %rbx,%rdi
+  804022:	48 b8 08 1f 80 00 00 	movabs $0x801f08,%rax
+  804029:	00 00 00 
+  80402c:	ff d0                	call   *%rax
+  80402e:	48 89 c6             	mov    %rax,%rsi
+  804031:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804036:	bf 00 00 00 00       	mov    $0x0,%edi
+  80403b:	41 ff d4             	call   *%r12
+}
+  80403e:	5b                   	pop    %rbx
+  80403f:	41 5c                	pop    %r12
+  804041:	5d                   	pop    %rbp
+  804042:	c3                   	ret
+
+0000000000804043 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804043:	55                   	push   %rbp
+  804044:	48 89 e5             	mov    %rsp,%rbp
+  804047:	41 57                	push   %r15
+  804049:	41 56                	push   %r14
+  80404b:	41 55                	push   %r13
+  80404d:	41 54                	push   %r12
+  80404f:	53                   	push   %rbx
+  804050:	48 83 ec 18          	sub    $0x18,%rsp
+  804054:	49 89 fc             	mov    %rdi,%r12
+  804057:	49 89 f5             	mov    %rsi,%r13
+  80405a:	49 89 d7             	mov    %rdx,%r15
+  80405d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804061:	48 b8 08 1f 80 00 00 	movabs $0x801f08,%rax
+  804068:	00 00 00 
+  80406b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80406d:	4d 85 ff             	test   %r15,%r15
+  804070:	0f 84 af 00 00 00    	je     804125 <devpipe_write+0xe2>
+  804076:	48 89 c3             	mov    %rax,%rbx
+  804079:	4c 89 f8             	mov    %r15,%rax
+  80407c:	4d 89 ef             	mov    %r13,%r15
+  80407f:	4c 01 e8             	add    %r13,%rax
+  804082:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804086:	49 bd b4 14 80 00 00 	movabs $0x8014b4,%r13
+  80408d:	00 00 00 
+            sys_yield();
+  804090:	49 be 51 14 80 00 00 	movabs $0x801451,%r14
+  804097:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80409a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80409d:	48 63 ce             	movslq %esi,%rcx
+  8040a0:	48 63 03             	movslq (%rbx),%rax
+  8040a3:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8040a9:	48 39 c1             	cmp    %rax,%rcx
+  8040ac:	72 2e                	jb     8040dc <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040ae:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8040b3:	48 89 da             	mov    %rbx,%rdx
+  8040b6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040bb:	4c 89 e7             	mov    %r12,%rdi
+  8040be:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8040c1:	85 c0                	test   %eax,%eax
+  8040c3:	74 66                	je     80412b <devpipe_write+0xe8>
+            sys_yield();
+  8040c5:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8040c8:	8b 73 04             	mov    0x4(%rbx),%esi
+  8040cb:	48 63 ce             	movslq %esi,%rcx
+  8040ce:	48 63 03             	movslq (%rbx),%rax
+  8040d1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8040d7:	48 39 c1             	cmp    %rax,%rcx
+  8040da:	73 d2                	jae    8040ae <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8040dc:	41 0f b6 3f          	movzbl (%r15),%edi
+  8040e0:	48 89 ca             	mov    %rcx,%rdx
+  8040e3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8040e7:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8040ee:	08 10 20 
+  8040f1:	48 f7 e2             	mul    %rdx
+  8040f4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8040f8:	48 89 d0             	mov    %rdx,%rax
+  8040fb:	48 c1 e0 09          	shl    $0x9,%rax
+  8040ff:	48 29 d0             	sub    %rdx,%rax
+  804102:	48 c1 e0 03          	shl    $0x3,%rax
+  804106:	48 29 c1             	sub    %rax,%rcx
+  804109:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80410e:	83 c6 01             	add    $0x1,%esi
+  804111:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804114:	49 83 c7 01          	add    $0x1,%r15
+  804118:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80411c:	49 39 c7             	cmp    %rax,%r15
+  80411f:	0f 85 75 ff ff ff    	jne    80409a <devpipe_write+0x57>
+    return n;
+  804125:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804129:	eb 05                	jmp    804130 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80412b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804130:	48 83 c4 18          	add    $0x18,%rsp
+  804134:	5b                   	pop    %rbx
+  804135:	41 5c                	pop    %r12
+  804137:	41 5d                	pop    %r13
+  804139:	41 5e                	pop    %r14
+  80413b:	41 5f                	pop    %r15
+  80413d:	5d                   	pop    %rbp
+  80413e:	c3                   	ret
+
+000000000080413f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80413f:	55                   	push   %rbp
+  804140:	48 89 e5             	mov    %rsp,%rbp
+  804143:	41 57                	push   %r15
+  804145:	41 56                	push   %r14
+  804147:	41 55                	push   %r13
+  804149:	41 54                	push   %r12
+  80414b:	53                   	push   %rbx
+  80414c:	48 83 ec 18          	sub    $0x18,%rsp
+  804150:	49 89 fc             	mov    %rdi,%r12
+  804153:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804157:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80415b:	48 b8 08 1f 80 00 00 	movabs $0x801f08,%rax
+  804162:	00 00 00 
+  804165:	ff d0                	call   *%rax
+  804167:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80416a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804170:	49 bd b4 14 80 00 00 	movabs $0x8014b4,%r13
+  804177:	00 00 00 
+            sys_yield();
+  80417a:	49 be 51 14 80 00 00 	movabs $0x801451,%r14
+  804181:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804184:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804189:	74 7d                	je     804208 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80418b:	8b 03                	mov    (%rbx),%eax
+  80418d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804190:	75 26                	jne    8041b8 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804192:	4d 85 ff             	test   %r15,%r15
+  804195:	75 77                	jne    80420e <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804197:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80419c:	48 89 da             	mov    %rbx,%rdx
+  80419f:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041a4:	4c 89 e7             	mov    %r12,%rdi
+  8041a7:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8041aa:	85 c0                	test   %eax,%eax
+  8041ac:	74 72                	je     804220 <devpipe_read+0xe1>
+            sys_yield();
+  8041ae:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8041b1:	8b 03                	mov    (%rbx),%eax
+  8041b3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8041b6:	74 df                	je     804197 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8041b8:	48 63 c8             	movslq %eax,%rcx
+  8041bb:	48 89 ca             	mov    %rcx,%rdx
+  8041be:	48 c1 ea 03          	shr    $0x3,%rdx
+  8041c2:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8041c9:	08 10 20 
+  8041cc:	48 89 d0             	mov    %rdx,%rax
+  8041cf:	48 f7 e6             	mul    %rsi
+  8041d2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8041d6:	48 89 d0             	mov    %rdx,%rax
+  8041d9:	48 c1 e0 09          	shl    $0x9,%rax
+  8041dd:	48 29 d0             	sub    %rdx,%rax
+  8041e0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8041e7:	00 
+  8041e8:	48 89 c8             	mov    %rcx,%rax
+  8041eb:	48 29 d0             	sub    %rdx,%rax
+  8041ee:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8041f3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8041f7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8041fb:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8041fe:	49 83 c7 01          	add    $0x1,%r15
+  804202:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804206:	75 83                	jne    80418b <devpipe_read+0x4c>
+    return n;
+  804208:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80420c:	eb 03                	jmp    804211 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80420e:	4c 89 f8             	mov    %r15,%rax
+}
+  804211:	48 83 c4 18          	add    $0x18,%rsp
+  804215:	5b                   	pop    %rbx
+  804216:	41 5c                	pop    %r12
+  804218:	41 5d                	pop    %r13
+  80421a:	41 5e                	pop    %r14
+  80421c:	41 5f                	pop    %r15
+  80421e:	5d                   	pop    %rbp
+  80421f:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804220:	b8 00 00 00 00       	mov    $0x0,%eax
+  804225:	eb ea                	jmp    804211 <devpipe_read+0xd2>
+
+0000000000804227 <pipe>:
+pipe(int pfd[2]) {
+  804227:	55                   	push   %rbp
+  804228:	48 89 e5             	mov    %rsp,%rbp
+  80422b:	41 55                	push   %r13
+  80422d:	41 54                	push   %r12
+  80422f:	53                   	push   %rbx
+  804230:	48 83 ec 18          	sub    $0x18,%rsp
+  804234:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804237:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80423b:	48 b8 24 1f 80 00 00 	movabs $0x801f24,%rax
+  804242:	00 00 00 
+  804245:	ff d0                	call   *%rax
+  804247:	89 c3                	mov    %eax,%ebx
+  804249:	85 c0                	test   %eax,%eax
+  80424b:	0f 88 a0 01 00 00    	js     8043f1 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804251:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804256:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80425b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80425f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804264:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  80426b:	00 00 00 
+  80426e:	ff d0                	call   *%rax
+  804270:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804272:	85 c0                	test   %eax,%eax
+  804274:	0f 88 77 01 00 00    	js     8043f1 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80427a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80427e:	48 b8 24 1f 80 00 00 	movabs $0x801f24,%rax
+  804285:	00 00 00 
+  804288:	ff d0                	call   *%rax
+  80428a:	89 c3                	mov    %eax,%ebx
+  80428c:	85 c0                	test   %eax,%eax
+  80428e:	0f 88 43 01 00 00    	js     8043d7 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804294:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804299:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80429e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8042a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042a7:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  8042ae:	00 00 00 
+  8042b1:	ff d0                	call   *%rax
+  8042b3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8042b5:	85 c0                	test   %eax,%eax
+  8042b7:	0f 88 1a 01 00 00    	js     8043d7 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8042bd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8042c1:	48 b8 08 1f 80 00 00 	movabs $0x801f08,%rax
+  8042c8:	00 00 00 
+  8042cb:	ff d0                	call   *%rax
+  8042cd:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8042d0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042da:	48 89 c6             	mov    %rax,%rsi
+  8042dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042e2:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  8042e9:	00 00 00 
+  8042ec:	ff d0                	call   *%rax
+  8042ee:	89 c3                	mov    %eax,%ebx
+  8042f0:	85 c0                	test   %eax,%eax
+  8042f2:	0f 88 c5 00 00 00    	js     8043bd <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8042f8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8042fc:	48 b8 08 1f 80 00 00 	movabs $0x801f08,%rax
+  804303:	00 00 00 
+  804306:	ff d0                	call   *%rax
+  804308:	48 89 c1             	mov    %rax,%rcx
+  80430b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804311:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804317:	ba 00 00 00 00       	mov    $0x0,%edx
+  80431c:	4c 89 ee             	mov    %r13,%rsi
+  80431f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804324:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  80432b:	00 00 00 
+  80432e:	ff d0                	call   *%rax
+  804330:	89 c3                	mov    %eax,%ebx
+  804332:	85 c0                	test   %eax,%eax
+  804334:	78 6e                	js     8043a4 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804336:	be 00 10 00 00       	mov    $0x1000,%esi
+  80433b:	4c 89 ef             	mov    %r13,%rdi
+  80433e:	48 b8 82 14 80 00 00 	movabs $0x801482,%rax
+  804345:	00 00 00 
+  804348:	ff d0                	call   *%rax
+  80434a:	83 f8 02             	cmp    $0x2,%eax
+  80434d:	0f 85 ab 00 00 00    	jne    8043fe <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804353:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80435a:	00 00 
+  80435c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804360:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804362:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804366:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80436d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804371:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804373:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804377:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80437e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804382:	48 bb f6 1e 80 00 00 	movabs $0x801ef6,%rbx
+  804389:	00 00 00 
+  80438c:	ff d3                	call   *%rbx
+  80438e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804392:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804396:	ff d3                	call   *%rbx
+  804398:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80439d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043a2:	eb 4d                	jmp    8043f1 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8043a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043a9:	4c 89 ee             	mov    %r13,%rsi
+  8043ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043b1:	48 b8 bf 16 80 00 00 	movabs $0x8016bf,%rax
+  8043b8:	00 00 00 
+  8043bb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8043bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043c2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8043c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043cb:	48 b8 bf 16 80 00 00 	movabs $0x8016bf,%rax
+  8043d2:	00 00 00 
+  8043d5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8043d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043dc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8043e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043e5:	48 b8 bf 16 80 00 00 	movabs $0x8016bf,%rax
+  8043ec:	00 00 00 
+  8043ef:	ff d0                	call   *%rax
+}
+  8043f1:	89 d8                	mov    %ebx,%eax
+  8043f3:	48 83 c4 18          	add    $0x18,%rsp
+  8043f7:	5b                   	pop    %rbx
+  8043f8:	41 5c                	pop    %r12
+  8043fa:	41 5d                	pop    %r13
+  8043fc:	5d                   	pop    %rbp
+  8043fd:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8043fe:	48 b9 80 58 80 00 00 	movabs $0x805880,%rcx
+  804405:	00 00 00 
+  804408:	48 ba fa 57 80 00 00 	movabs $0x8057fa,%rdx
+  80440f:	00 00 00 
+  804412:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804417:	48 bf 6a 58 80 00 00 	movabs $0x80586a,%rdi
+  80441e:	00 00 00 
+  804421:	b8 00 00 00 00       	mov    $0x0,%eax
+  804426:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  80442d:	00 00 00 
+  804430:	41 ff d0             	call   *%r8
+
+0000000000804433 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804433:	55                   	push   %rbp
+  804434:	48 89 e5             	mov    %rsp,%rbp
+  804437:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80443b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80443f:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  804446:	00 00 00 
+  804449:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80444b:	85 c0                	test   %eax,%eax
+  80444d:	78 35                	js     804484 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80444f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804453:	48 b8 08 1f 80 00 00 	movabs $0x801f08,%rax
+  80445a:	00 00 00 
+  80445d:	ff d0                	call   *%rax
+  80445f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804462:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804467:	be 00 10 00 00       	mov    $0x1000,%esi
+  80446c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804470:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  804477:	00 00 00 
+  80447a:	ff d0                	call   *%rax
+  80447c:	85 c0                	test   %eax,%eax
+  80447e:	0f 94 c0             	sete   %al
+  804481:	0f b6 c0             	movzbl %al,%eax
+}
+  804484:	c9                   	leave
+  804485:	c3                   	ret
+
+0000000000804486 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804486:	48 89 f8             	mov    %rdi,%rax
+  804489:	48 c1 e8 27          	shr    $0x27,%rax
+  80448d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804494:	7f 00 00 
+  804497:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80449b:	f6 c2 01             	test   $0x1,%dl
+  80449e:	74 6d                	je     80450d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8044a0:	48 89 f8             	mov    %rdi,%rax
+  8044a3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8044a7:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8044ae:	7f 00 00 
+  8044b1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044b5:	f6 c2 01             	test   $0x1,%dl
+  8044b8:	74 62                	je     80451c <get_uvpt_entry+0x96>
+  8044ba:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8044c1:	7f 00 00 
+  8044c4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044c8:	f6 c2 80             	test   $0x80,%dl
+  8044cb:	75 4f                	jne    80451c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8044cd:	48 89 f8             	mov    %rdi,%rax
+  8044d0:	48 c1 e8 15          	shr    $0x15,%rax
+  8044d4:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8044db:	7f 00 00 
+  8044de:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044e2:	f6 c2 01             	test   $0x1,%dl
+  8044e5:	74 44                	je     80452b <get_uvpt_entry+0xa5>
+  8044e7:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8044ee:	7f 00 00 
+  8044f1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044f5:	f6 c2 80             	test   $0x80,%dl
+  8044f8:	75 31                	jne    80452b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8044fa:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8044fe:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804505:	7f 00 00 
+  804508:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80450c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80450d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804514:	7f 00 00 
+  804517:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80451b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80451c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804523:	7f 00 00 
+  804526:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80452a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80452b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804532:	7f 00 00 
+  804535:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804539:	c3                   	ret
+
+000000000080453a <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80453a:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80453d:	48 89 f9             	mov    %rdi,%rcx
+  804540:	48 c1 e9 27          	shr    $0x27,%rcx
+  804544:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80454b:	7f 00 00 
+  80454e:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  804552:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804559:	f6 c1 01             	test   $0x1,%cl
+  80455c:	0f 84 b2 00 00 00    	je     804614 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804562:	48 89 f9             	mov    %rdi,%rcx
+  804565:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804569:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804570:	7f 00 00 
+  804573:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804577:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80457e:	40 f6 c6 01          	test   $0x1,%sil
+  804582:	0f 84 8c 00 00 00    	je     804614 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804588:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80458f:	7f 00 00 
+  804592:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804596:	a8 80                	test   $0x80,%al
+  804598:	75 7b                	jne    804615 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80459a:	48 89 f9             	mov    %rdi,%rcx
+  80459d:	48 c1 e9 15          	shr    $0x15,%rcx
+  8045a1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8045a8:	7f 00 00 
+  8045ab:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8045af:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8045b6:	40 f6 c6 01          	test   $0x1,%sil
+  8045ba:	74 58                	je     804614 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8045bc:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8045c3:	7f 00 00 
+  8045c6:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8045ca:	a8 80                	test   $0x80,%al
+  8045cc:	75 6c                	jne    80463a <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8045ce:	48 89 f9             	mov    %rdi,%rcx
+  8045d1:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8045d5:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8045dc:	7f 00 00 
+  8045df:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8045e3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8045ea:	40 f6 c6 01          	test   $0x1,%sil
+  8045ee:	74 24                	je     804614 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8045f0:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8045f7:	7f 00 00 
+  8045fa:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8045fe:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804605:	ff ff 7f 
+  804608:	48 21 c8             	and    %rcx,%rax
+  80460b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804611:	48 09 d0             	or     %rdx,%rax
+}
+  804614:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804615:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80461c:	7f 00 00 
+  80461f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804623:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80462a:	ff ff 7f 
+  80462d:	48 21 c8             	and    %rcx,%rax
+  804630:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804636:	48 01 d0             	add    %rdx,%rax
+  804639:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80463a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804641:	7f 00 00 
+  804644:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804648:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80464f:	ff ff 7f 
+  804652:	48 21 c8             	and    %rcx,%rax
+  804655:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80465b:	48 01 d0             	add    %rdx,%rax
+  80465e:	c3                   	ret
+
+000000000080465f <get_prot>:
+
+int
+get_prot(void *va) {
+  80465f:	55                   	push   %rbp
+  804660:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804663:	48 b8 86 44 80 00 00 	movabs $0x804486,%rax
+  80466a:	00 00 00 
+  80466d:	ff d0                	call   *%rax
+  80466f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804672:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804677:	89 c1                	mov    %eax,%ecx
+  804679:	83 c9 04             	or     $0x4,%ecx
+  80467c:	f6 c2 01             	test   $0x1,%dl
+  80467f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804682:	89 c1                	mov    %eax,%ecx
+  804684:	83 c9 02             	or     $0x2,%ecx
+  804687:	f6 c2 02             	test   $0x2,%dl
+  80468a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80468d:	89 c1                	mov    %eax,%ecx
+  80468f:	83 c9 01             	or     $0x1,%ecx
+  804692:	48 85 d2             	test   %rdx,%rdx
+  804695:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804698:	89 c1                	mov    %eax,%ecx
+  80469a:	83 c9 40             	or     $0x40,%ecx
+  80469d:	f6 c6 04             	test   $0x4,%dh
+  8046a0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8046a3:	5d                   	pop    %rbp
+  8046a4:	c3                   	ret
+
+00000000008046a5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8046a5:	55                   	push   %rbp
+  8046a6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8046a9:	48 b8 86 44 80 00 00 	movabs $0x804486,%rax
+  8046b0:	00 00 00 
+  8046b3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8046b5:	48 c1 e8 06          	shr    $0x6,%rax
+  8046b9:	83 e0 01             	and    $0x1,%eax
+}
+  8046bc:	5d                   	pop    %rbp
+  8046bd:	c3                   	ret
+
+00000000008046be <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8046be:	55                   	push   %rbp
+  8046bf:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8046c2:	48 b8 86 44 80 00 00 	movabs $0x804486,%rax
+  8046c9:	00 00 00 
+  8046cc:	ff d0                	call   *%rax
+  8046ce:	83 e0 01             	and    $0x1,%eax
+}
+  8046d1:	5d                   	pop    %rbp
+  8046d2:	c3                   	ret
+
+00000000008046d3 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8046d3:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8046da:	7f 00 00 
+  8046dd:	a8 01                	test   $0x1,%al
+  8046df:	75 06                	jne    8046e7 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8046e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e6:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8046e7:	55                   	push   %rbp
+  8046e8:	48 89 e5             	mov    %rsp,%rbp
+  8046eb:	41 57                	push   %r15
+  8046ed:	41 56                	push   %r14
+  8046ef:	41 55                	push   %r13
+  8046f1:	41 54                	push   %r12
+  8046f3:	53                   	push   %rbx
+  8046f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8046f8:	49 89 fe             	mov    %rdi,%r14
+  8046fb:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8046fe:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804705:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804706:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  80470d:	7f 00 00 
+  804710:	e9 81 00 00 00       	jmp    804796 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804715:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80471c:	49 39 dd             	cmp    %rbx,%r13
+  80471f:	74 2b                	je     80474c <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804721:	48 89 d8             	mov    %rbx,%rax
+  804724:	48 c1 e8 0c          	shr    $0xc,%rax
+  804728:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  80472c:	f6 c2 01             	test   $0x1,%dl
+  80472f:	74 e4                	je     804715 <foreach_shared_region+0x42>
+  804731:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804735:	f6 c4 04             	test   $0x4,%ah
+  804738:	74 db                	je     804715 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  80473a:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804741:	4c 89 fa             	mov    %r15,%rdx
+  804744:	48 89 df             	mov    %rbx,%rdi
+  804747:	41 ff d6             	call   *%r14
+  80474a:	eb c9                	jmp    804715 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80474c:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804753:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804757:	74 22                	je     80477b <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804759:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804760:	48 89 d8             	mov    %rbx,%rax
+  804763:	48 c1 e8 15          	shr    $0x15,%rax
+  804767:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  80476e:	7f 00 00 
+  804771:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804775:	a8 01                	test   $0x1,%al
+  804777:	74 d3                	je     80474c <foreach_shared_region+0x79>
+  804779:	eb a6                	jmp    804721 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80477b:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804782:	40 
+  804783:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804787:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80478e:	00 00 00 
+  804791:	48 39 c1             	cmp    %rax,%rcx
+  804794:	74 31                	je     8047c7 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804796:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80479a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80479e:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8047a5:	7f 00 00 
+  8047a8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8047ac:	a8 01                	test   $0x1,%al
+  8047ae:	74 cb                	je     80477b <foreach_shared_region+0xa8>
+  8047b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047b4:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8047bb:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8047c1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8047c5:	eb 92                	jmp    804759 <foreach_shared_region+0x86>
+}
+  8047c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047cc:	48 83 c4 18          	add    $0x18,%rsp
+  8047d0:	5b                   	pop    %rbx
+  8047d1:	41 5c                	pop    %r12
+  8047d3:	41 5d                	pop    %r13
+  8047d5:	41 5e                	pop    %r14
+  8047d7:	41 5f                	pop    %r15
+  8047d9:	5d                   	pop    %rbp
+  8047da:	c3                   	ret
+
+00000000008047db <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8047db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e0:	c3                   	ret
+
+00000000008047e1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8047e1:	55                   	push   %rbp
+  8047e2:	48 89 e5             	mov    %rsp,%rbp
+  8047e5:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8047e8:	48 be a4 58 80 00 00 	movabs $0x8058a4,%rsi
+  8047ef:	00 00 00 
+  8047f2:	48 b8 80 0d 80 00 00 	movabs $0x800d80,%rax
+  8047f9:	00 00 00 
+  8047fc:	ff d0                	call   *%rax
+    return 0;
+}
+  8047fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804803:	5d                   	pop    %rbp
+  804804:	c3                   	ret
+
+0000000000804805 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804805:	55                   	push   %rbp
+  804806:	48 89 e5             	mov    %rsp,%rbp
+  804809:	41 57                	push   %r15
+  80480b:	41 56                	push   %r14
+  80480d:	41 55                	push   %r13
+  80480f:	41 54                	push   %r12
+  804811:	53                   	push   %rbx
+  804812:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804819:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804820:	48 85 d2             	test   %rdx,%rdx
+  804823:	74 7a                	je     80489f <devcons_write+0x9a>
+  804825:	49 89 d6             	mov    %rdx,%r14
+  804828:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80482e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804833:	49 bf 0e 11 80 00 00 	movabs $0x80110e,%r15
+  80483a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80483d:	4c 89 f3             	mov    %r14,%rbx
+  804840:	48 29 f3             	sub    %rsi,%rbx
+  804843:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804848:	48 39 c3             	cmp    %rax,%rbx
+  80484b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80484f:	4c 63 eb             	movslq %ebx,%r13
+  804852:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804859:	48 01 c6             	add    %rax,%rsi
+  80485c:	4c 89 ea             	mov    %r13,%rdx
+  80485f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804866:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804869:	4c 89 ee             	mov    %r13,%rsi
+  80486c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804873:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  80487a:	00 00 00 
+  80487d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80487f:	41 01 dc             	add    %ebx,%r12d
+  804882:	49 63 f4             	movslq %r12d,%rsi
+  804885:	4c 39 f6             	cmp    %r14,%rsi
+  804888:	72 b3                	jb     80483d <devcons_write+0x38>
+    return res;
+  80488a:	49 63 c4             	movslq %r12d,%rax
+}
+  80488d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804894:	5b                   	pop    %rbx
+  804895:	41 5c                	pop    %r12
+  804897:	41 5d                	pop    %r13
+  804899:	41 5e                	pop    %r14
+  80489b:	41 5f                	pop    %r15
+  80489d:	5d                   	pop    %rbp
+  80489e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80489f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8048a5:	eb e3                	jmp    80488a <devcons_write+0x85>
+
+00000000008048a7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8048a7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8048aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048af:	48 85 c0             	test   %rax,%rax
+  8048b2:	74 55                	je     804909 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8048b4:	55                   	push   %rbp
+  8048b5:	48 89 e5             	mov    %rsp,%rbp
+  8048b8:	41 55                	push   %r13
+  8048ba:	41 54                	push   %r12
+  8048bc:	53                   	push   %rbx
+  8048bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8048c1:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8048c4:	48 bb 84 13 80 00 00 	movabs $0x801384,%rbx
+  8048cb:	00 00 00 
+  8048ce:	49 bc 51 14 80 00 00 	movabs $0x801451,%r12
+  8048d5:	00 00 00 
+  8048d8:	eb 03                	jmp    8048dd <devcons_read+0x36>
+  8048da:	41 ff d4             	call   *%r12
+  8048dd:	ff d3                	call   *%rbx
+  8048df:	85 c0                	test   %eax,%eax
+  8048e1:	74 f7                	je     8048da <devcons_read+0x33>
+    if (c < 0) return c;
+  8048e3:	48 63 d0             	movslq %eax,%rdx
+  8048e6:	78 13                	js     8048fb <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8048e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048ed:	83 f8 04             	cmp    $0x4,%eax
+  8048f0:	74 09                	je     8048fb <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8048f2:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8048f6:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8048fb:	48 89 d0             	mov    %rdx,%rax
+  8048fe:	48 83 c4 08          	add    $0x8,%rsp
+  804902:	5b                   	pop    %rbx
+  804903:	41 5c                	pop    %r12
+  804905:	41 5d                	pop    %r13
+  804907:	5d                   	pop    %rbp
+  804908:	c3                   	ret
+  804909:	48 89 d0             	mov    %rdx,%rax
+  80490c:	c3                   	ret
+
+000000000080490d <cputchar>:
+cputchar(int ch) {
+  80490d:	55                   	push   %rbp
+  80490e:	48 89 e5             	mov    %rsp,%rbp
+  804911:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804915:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804919:	be 01 00 00 00       	mov    $0x1,%esi
+  80491e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804922:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  804929:	00 00 00 
+  80492c:	ff d0                	call   *%rax
+}
+  80492e:	c9                   	leave
+  80492f:	c3                   	ret
+
+0000000000804930 <getchar>:
+getchar(void) {
+  804930:	55                   	push   %rbp
+  804931:	48 89 e5             	mov    %rsp,%rbp
+  804934:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804938:	ba 01 00 00 00       	mov    $0x1,%edx
+  80493d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804941:	bf 00 00 00 00       	mov    $0x0,%edi
+  804946:	48 b8 67 22 80 00 00 	movabs $0x802267,%rax
+  80494d:	00 00 00 
+  804950:	ff d0                	call   *%rax
+  804952:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804954:	85 c0                	test   %eax,%eax
+  804956:	78 06                	js     80495e <getchar+0x2e>
+  804958:	74 08                	je     804962 <getchar+0x32>
+  80495a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80495e:	89 d0                	mov    %edx,%eax
+  804960:	c9                   	leave
+  804961:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804962:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804967:	eb f5                	jmp    80495e <getchar+0x2e>
+
+0000000000804969 <iscons>:
+iscons(int fdnum) {
+  804969:	55                   	push   %rbp
+  80496a:	48 89 e5             	mov    %rsp,%rbp
+  80496d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804971:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804975:	48 b8 84 1f 80 00 00 	movabs $0x801f84,%rax
+  80497c:	00 00 00 
+  80497f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804981:	85 c0                	test   %eax,%eax
+  804983:	78 18                	js     80499d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804985:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804989:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804990:	00 00 00 
+  804993:	8b 00                	mov    (%rax),%eax
+  804995:	39 02                	cmp    %eax,(%rdx)
+  804997:	0f 94 c0             	sete   %al
+  80499a:	0f b6 c0             	movzbl %al,%eax
+}
+  80499d:	c9                   	leave
+  80499e:	c3                   	ret
+
+000000000080499f <opencons>:
+opencons(void) {
+  80499f:	55                   	push   %rbp
+  8049a0:	48 89 e5             	mov    %rsp,%rbp
+  8049a3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8049a7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8049ab:	48 b8 24 1f 80 00 00 	movabs $0x801f24,%rax
+  8049b2:	00 00 00 
+  8049b5:	ff d0                	call   *%rax
+  8049b7:	85 c0                	test   %eax,%eax
+  8049b9:	78 49                	js     804a04 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8049bb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8049c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049c5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8049c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049ce:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  8049d5:	00 00 00 
+  8049d8:	ff d0                	call   *%rax
+  8049da:	85 c0                	test   %eax,%eax
+  8049dc:	78 26                	js     804a04 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8049de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8049e2:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8049e9:	00 00 
+  8049eb:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8049ed:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8049f1:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8049f8:	48 b8 f6 1e 80 00 00 	movabs $0x801ef6,%rax
+  8049ff:	00 00 00 
+  804a02:	ff d0                	call   *%rax
+}
+  804a04:	c9                   	leave
+  804a05:	c3                   	ret
+
+0000000000804a06 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804a06:	55                   	push   %rbp
+  804a07:	48 89 e5             	mov    %rsp,%rbp
+  804a0a:	41 55                	push   %r13
+  804a0c:	41 54                	push   %r12
+  804a0e:	53                   	push   %rbx
+  804a0f:	48 83 ec 08          	sub    $0x8,%rsp
+  804a13:	49 89 fc             	mov    %rdi,%r12
+  804a16:	48 89 f7             	mov    %rsi,%rdi
+  804a19:	48 89 d3             	mov    %rdx,%rbx
+  804a1c:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804a1f:	48 85 f6             	test   %rsi,%rsi
+  804a22:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804a29:	00 00 00 
+  804a2c:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804a30:	be 00 10 00 00       	mov    $0x1000,%esi
+  804a35:	48 85 d2             	test   %rdx,%rdx
+  804a38:	74 03                	je     804a3d <ipc_recv+0x37>
+  804a3a:	48 8b 32             	mov    (%rdx),%rsi
+  804a3d:	48 b8 8d 18 80 00 00 	movabs $0x80188d,%rax
+  804a44:	00 00 00 
+  804a47:	ff d0                	call   *%rax
+    if (errno) {
+  804a49:	85 c0                	test   %eax,%eax
+  804a4b:	74 1c                	je     804a69 <ipc_recv+0x63>
+        if (from_env_store)
+  804a4d:	4d 85 e4             	test   %r12,%r12
+  804a50:	74 08                	je     804a5a <ipc_recv+0x54>
+            *from_env_store = 0;
+  804a52:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804a59:	00 
+
+        if (perm_store)
+  804a5a:	4d 85 ed             	test   %r13,%r13
+  804a5d:	74 74                	je     804ad3 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804a5f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804a66:	00 
+  804a67:	eb 6a                	jmp    804ad3 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804a69:	4d 85 e4             	test   %r12,%r12
+  804a6c:	74 14                	je     804a82 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804a6e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804a75:	00 00 00 
+  804a78:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804a7e:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804a82:	48 85 db             	test   %rbx,%rbx
+  804a85:	74 23                	je     804aaa <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804a87:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804a8e:	00 00 00 
+  804a91:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804a97:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a9c:	85 c9                	test   %ecx,%ecx
+  804a9e:	74 07                	je     804aa7 <ipc_recv+0xa1>
+  804aa0:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804aa7:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804aaa:	4d 85 ed             	test   %r13,%r13
+  804aad:	74 14                	je     804ac3 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804aaf:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804ab6:	00 00 00 
+  804ab9:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804abf:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804ac3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804aca:	00 00 00 
+  804acd:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804ad3:	48 83 c4 08          	add    $0x8,%rsp
+  804ad7:	5b                   	pop    %rbx
+  804ad8:	41 5c                	pop    %r12
+  804ada:	41 5d                	pop    %r13
+  804adc:	5d                   	pop    %rbp
+  804add:	c3                   	ret
+
+0000000000804ade <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804ade:	55                   	push   %rbp
+  804adf:	48 89 e5             	mov    %rsp,%rbp
+  804ae2:	41 55                	push   %r13
+  804ae4:	41 54                	push   %r12
+  804ae6:	53                   	push   %rbx
+  804ae7:	48 83 ec 08          	sub    $0x8,%rsp
+  804aeb:	49 89 fc             	mov    %rdi,%r12
+  804aee:	48 89 f7             	mov    %rsi,%rdi
+  804af1:	48 89 d3             	mov    %rdx,%rbx
+  804af4:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804af7:	48 85 f6             	test   %rsi,%rsi
+  804afa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804b01:	00 00 00 
+  804b04:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804b08:	be 00 10 00 00       	mov    $0x1000,%esi
+  804b0d:	48 85 d2             	test   %rdx,%rdx
+  804b10:	74 03                	je     804b15 <ipc_try_recv+0x37>
+  804b12:	48 8b 32             	mov    (%rdx),%rsi
+  804b15:	48 b8 f6 18 80 00 00 	movabs $0x8018f6,%rax
+  804b1c:	00 00 00 
+  804b1f:	ff d0                	call   *%rax
+    if (errno) {
+  804b21:	85 c0                	test   %eax,%eax
+  804b23:	75 75                	jne    804b9a <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804b25:	4d 85 e4             	test   %r12,%r12
+  804b28:	74 14                	je     804b3e <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804b2a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804b31:	00 00 00 
+  804b34:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804b3a:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804b3e:	48 85 db             	test   %rbx,%rbx
+  804b41:	74 23                	je     804b66 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804b43:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804b4a:	00 00 00 
+  804b4d:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804b53:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b58:	85 c9                	test   %ecx,%ecx
+  804b5a:	74 07                	je     804b63 <ipc_try_recv+0x85>
+  804b5c:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804b63:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804b66:	4d 85 ed             	test   %r13,%r13
+  804b69:	74 14                	je     804b7f <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804b6b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804b72:	00 00 00 
+  804b75:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804b7b:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804b7f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804b86:	00 00 00 
+  804b89:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804b8f:	48 83 c4 08          	add    $0x8,%rsp
+  804b93:	5b                   	pop    %rbx
+  804b94:	41 5c                	pop    %r12
+  804b96:	41 5d                	pop    %r13
+  804b98:	5d                   	pop    %rbp
+  804b99:	c3                   	ret
+        if (from_env_store)
+  804b9a:	4d 85 e4             	test   %r12,%r12
+  804b9d:	74 08                	je     804ba7 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804b9f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804ba6:	00 
+        if (perm_store)
+  804ba7:	4d 85 ed             	test   %r13,%r13
+  804baa:	74 e3                	je     804b8f <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804bac:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804bb3:	00 
+  804bb4:	eb d9                	jmp    804b8f <ipc_try_recv+0xb1>
+
+0000000000804bb6 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804bb6:	55                   	push   %rbp
+  804bb7:	48 89 e5             	mov    %rsp,%rbp
+  804bba:	41 57                	push   %r15
+  804bbc:	41 56                	push   %r14
+  804bbe:	41 55                	push   %r13
+  804bc0:	41 54                	push   %r12
+  804bc2:	53                   	push   %rbx
+  804bc3:	48 83 ec 18          	sub    $0x18,%rsp
+  804bc7:	41 89 fd             	mov    %edi,%r13d
+  804bca:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804bcd:	48 89 d3             	mov    %rdx,%rbx
+  804bd0:	49 89 cc             	mov    %rcx,%r12
+  804bd3:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804bd7:	48 85 d2             	test   %rdx,%rdx
+  804bda:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804be1:	00 00 00 
+  804be4:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804be8:	49 be 61 18 80 00 00 	movabs $0x801861,%r14
+  804bef:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804bf2:	49 bf 51 14 80 00 00 	movabs $0x801451,%r15
+  804bf9:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804bfc:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804bff:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804c03:	4c 89 e1             	mov    %r12,%rcx
+  804c06:	48 89 da             	mov    %rbx,%rdx
+  804c09:	44 89 ef             	mov    %r13d,%edi
+  804c0c:	41 ff d6             	call   *%r14
+  804c0f:	85 c0                	test   %eax,%eax
+  804c11:	74 37                	je     804c4a <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804c13:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804c16:	75 05                	jne    804c1d <ipc_send+0x67>
+        sys_yield();
+  804c18:	41 ff d7             	call   *%r15
+  804c1b:	eb df                	jmp    804bfc <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804c1d:	89 c1                	mov    %eax,%ecx
+  804c1f:	48 ba b0 58 80 00 00 	movabs $0x8058b0,%rdx
+  804c26:	00 00 00 
+  804c29:	be 65 00 00 00       	mov    $0x65,%esi
+  804c2e:	48 bf cb 58 80 00 00 	movabs $0x8058cb,%rdi
+  804c35:	00 00 00 
+  804c38:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c3d:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  804c44:	00 00 00 
+  804c47:	41 ff d0             	call   *%r8
+    }
+}
+  804c4a:	48 83 c4 18          	add    $0x18,%rsp
+  804c4e:	5b                   	pop    %rbx
+  804c4f:	41 5c                	pop    %r12
+  804c51:	41 5d                	pop    %r13
+  804c53:	41 5e                	pop    %r14
+  804c55:	41 5f                	pop    %r15
+  804c57:	5d                   	pop    %rbp
+  804c58:	c3                   	ret
+
+0000000000804c59 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804c59:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804c5e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804c65:	00 00 00 
+  804c68:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804c6f:	48 01 ca             	add    %rcx,%rdx
+  804c72:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804c78:	39 fa                	cmp    %edi,%edx
+  804c7a:	74 12                	je     804c8e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804c7c:	48 83 c0 01          	add    $0x1,%rax
+  804c80:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804c86:	75 e0                	jne    804c68 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804c88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c8d:	c3                   	ret
+            return envs[i].env_id;
+  804c8e:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804c95:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804c9c:	00 00 00 
+  804c9f:	48 01 d0             	add    %rdx,%rax
+  804ca2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804ca8:	c3                   	ret
+
+0000000000804ca9 <__text_end>:
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
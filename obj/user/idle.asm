@@ -0,0 +1,8104 @@
+
+obj/user/idle:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2d 00 00 00       	call   800050 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "idle";
+  80002e:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800035:	00 00 00 
+  800038:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80003f:	00 00 00 
+     * Instead of busy-waiting like this,
+     * a better way would be to use the processor's HLT instruction
+     * to cause the processor to stop executing until the next interrupt -
+     * doing so allows the processor to conserve power more effectively. */
+    while (1) {
+        sys_yield();
+  800042:	48 bb 16 02 80 00 00 	movabs $0x800216,%rbx
+  800049:	00 00 00 
+  80004c:	ff d3                	call   *%rbx
+    while (1) {
+  80004e:	eb fc                	jmp    80004c <umain+0x27>
+
+0000000000800050 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800050:	55                   	push   %rbp
+  800051:	48 89 e5             	mov    %rsp,%rbp
+  800054:	41 56                	push   %r14
+  800056:	41 55                	push   %r13
+  800058:	41 54                	push   %r12
+  80005a:	53                   	push   %rbx
+  80005b:	41 89 fd             	mov    %edi,%r13d
+  80005e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800061:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800068:	00 00 00 
+  80006b:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800072:	00 00 00 
+  800075:	48 39 c2             	cmp    %rax,%rdx
+  800078:	73 17                	jae    800091 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007d:	49 89 c4             	mov    %rax,%r12
+  800080:	48 83 c3 08          	add    $0x8,%rbx
+  800084:	b8 00 00 00 00       	mov    $0x0,%eax
+  800089:	ff 53 f8             	call   *-0x8(%rbx)
+  80008c:	4c 39 e3             	cmp    %r12,%rbx
+  80008f:	72 ef                	jb     800080 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800091:	48 b8 e5 01 80 00 00 	movabs $0x8001e5,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a2:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000a9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b0:	00 00 00 
+  8000b3:	48 01 d0             	add    %rdx,%rax
+  8000b6:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000bd:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c0:	45 85 ed             	test   %r13d,%r13d
+  8000c3:	7e 0d                	jle    8000d2 <libmain+0x82>
+  8000c5:	49 8b 06             	mov    (%r14),%rax
+  8000c8:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000cf:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d2:	4c 89 f6             	mov    %r14,%rsi
+  8000d5:	44 89 ef             	mov    %r13d,%edi
+  8000d8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e4:	48 b8 f9 00 80 00 00 	movabs $0x8000f9,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+#endif
+}
+  8000f0:	5b                   	pop    %rbx
+  8000f1:	41 5c                	pop    %r12
+  8000f3:	41 5d                	pop    %r13
+  8000f5:	41 5e                	pop    %r14
+  8000f7:	5d                   	pop    %rbp
+  8000f8:	c3                   	ret
+
+00000000008000f9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f9:	55                   	push   %rbp
+  8000fa:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fd:	48 b8 e1 0e 80 00 00 	movabs $0x800ee1,%rax
+  800104:	00 00 00 
+  800107:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010e:	48 b8 7a 01 80 00 00 	movabs $0x80017a,%rax
+  800115:	00 00 00 
+  800118:	ff d0                	call   *%rax
+}
+  80011a:	5d                   	pop    %rbp
+  80011b:	c3                   	ret
+
+000000000080011c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80011c:	55                   	push   %rbp
+  80011d:	48 89 e5             	mov    %rsp,%rbp
+  800120:	53                   	push   %rbx
+  800121:	48 89 fa             	mov    %rdi,%rdx
+  800124:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800127:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80012c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800131:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800136:	be 00 00 00 00       	mov    $0x0,%esi
+  80013b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800141:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800143:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800147:	c9                   	leave
+  800148:	c3                   	ret
+
+0000000000800149 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800149:	55                   	push   %rbp
+  80014a:	48 89 e5             	mov    %rsp,%rbp
+  80014d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80014e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800153:	ba 00 00 00 00       	mov    $0x0,%edx
+  800158:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80015d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800162:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800167:	be 00 00 00 00       	mov    $0x0,%esi
+  80016c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800172:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800174:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800178:	c9                   	leave
+  800179:	c3                   	ret
+
+000000000080017a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80017a:	55                   	push   %rbp
+  80017b:	48 89 e5             	mov    %rsp,%rbp
+  80017e:	53                   	push   %rbx
+  80017f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800183:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800186:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80018b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800190:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800195:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80019a:	be 00 00 00 00       	mov    $0x0,%esi
+  80019f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001a7:	48 85 c0             	test   %rax,%rax
+  8001aa:	7f 06                	jg     8001b2 <sys_env_destroy+0x38>
+}
+  8001ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001b0:	c9                   	leave
+  8001b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001b2:	49 89 c0             	mov    %rax,%r8
+  8001b5:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001ba:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8001c1:	00 00 00 
+  8001c4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001c9:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8001d0:	00 00 00 
+  8001d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d8:	49 b9 44 2f 80 00 00 	movabs $0x802f44,%r9
+  8001df:	00 00 00 
+  8001e2:	41 ff d1             	call   *%r9
+
+00000000008001e5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001e5:	55                   	push   %rbp
+  8001e6:	48 89 e5             	mov    %rsp,%rbp
+  8001e9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001ea:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800203:	be 00 00 00 00       	mov    $0x0,%esi
+  800208:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80020e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800210:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800214:	c9                   	leave
+  800215:	c3                   	ret
+
+0000000000800216 <sys_yield>:
+
+void
+sys_yield(void) {
+  800216:	55                   	push   %rbp
+  800217:	48 89 e5             	mov    %rsp,%rbp
+  80021a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80021b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800220:	ba 00 00 00 00       	mov    $0x0,%edx
+  800225:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800234:	be 00 00 00 00       	mov    $0x0,%esi
+  800239:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80023f:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800241:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800245:	c9                   	leave
+  800246:	c3                   	ret
+
+0000000000800247 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800247:	55                   	push   %rbp
+  800248:	48 89 e5             	mov    %rsp,%rbp
+  80024b:	53                   	push   %rbx
+  80024c:	48 89 fa             	mov    %rdi,%rdx
+  80024f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800252:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800257:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80025e:	00 00 00 
+  800261:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800266:	be 00 00 00 00       	mov    $0x0,%esi
+  80026b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800271:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800273:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800277:	c9                   	leave
+  800278:	c3                   	ret
+
+0000000000800279 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800279:	55                   	push   %rbp
+  80027a:	48 89 e5             	mov    %rsp,%rbp
+  80027d:	53                   	push   %rbx
+  80027e:	49 89 f8             	mov    %rdi,%r8
+  800281:	48 89 d3             	mov    %rdx,%rbx
+  800284:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800287:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80028c:	4c 89 c2             	mov    %r8,%rdx
+  80028f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800292:	be 00 00 00 00       	mov    $0x0,%esi
+  800297:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80029d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80029f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a3:	c9                   	leave
+  8002a4:	c3                   	ret
+
+00000000008002a5 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002a5:	55                   	push   %rbp
+  8002a6:	48 89 e5             	mov    %rsp,%rbp
+  8002a9:	53                   	push   %rbx
+  8002aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ae:	89 f8                	mov    %edi,%eax
+  8002b0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002b3:	48 63 f9             	movslq %ecx,%rdi
+  8002b6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002b9:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002be:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002ce:	48 85 c0             	test   %rax,%rax
+  8002d1:	7f 06                	jg     8002d9 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d7:	c9                   	leave
+  8002d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d9:	49 89 c0             	mov    %rax,%r8
+  8002dc:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002e1:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8002e8:	00 00 00 
+  8002eb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002f0:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8002f7:	00 00 00 
+  8002fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ff:	49 b9 44 2f 80 00 00 	movabs $0x802f44,%r9
+  800306:	00 00 00 
+  800309:	41 ff d1             	call   *%r9
+
+000000000080030c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80030c:	55                   	push   %rbp
+  80030d:	48 89 e5             	mov    %rsp,%rbp
+  800310:	53                   	push   %rbx
+  800311:	48 83 ec 08          	sub    $0x8,%rsp
+  800315:	89 f8                	mov    %edi,%eax
+  800317:	49 89 f2             	mov    %rsi,%r10
+  80031a:	48 89 cf             	mov    %rcx,%rdi
+  80031d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800320:	48 63 da             	movslq %edx,%rbx
+  800323:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800326:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80032b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80032e:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800331:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800333:	48 85 c0             	test   %rax,%rax
+  800336:	7f 06                	jg     80033e <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800338:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80033e:	49 89 c0             	mov    %rax,%r8
+  800341:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800346:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80034d:	00 00 00 
+  800350:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800355:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80035c:	00 00 00 
+  80035f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800364:	49 b9 44 2f 80 00 00 	movabs $0x802f44,%r9
+  80036b:	00 00 00 
+  80036e:	41 ff d1             	call   *%r9
+
+0000000000800371 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800371:	55                   	push   %rbp
+  800372:	48 89 e5             	mov    %rsp,%rbp
+  800375:	53                   	push   %rbx
+  800376:	48 83 ec 08          	sub    $0x8,%rsp
+  80037a:	49 89 f9             	mov    %rdi,%r9
+  80037d:	89 f0                	mov    %esi,%eax
+  80037f:	48 89 d3             	mov    %rdx,%rbx
+  800382:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  800385:	49 63 f0             	movslq %r8d,%rsi
+  800388:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80038b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800390:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800393:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800399:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80039b:	48 85 c0             	test   %rax,%rax
+  80039e:	7f 06                	jg     8003a6 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8003a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a4:	c9                   	leave
+  8003a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003a6:	49 89 c0             	mov    %rax,%r8
+  8003a9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003ae:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8003b5:	00 00 00 
+  8003b8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8003bd:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8003c4:	00 00 00 
+  8003c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cc:	49 b9 44 2f 80 00 00 	movabs $0x802f44,%r9
+  8003d3:	00 00 00 
+  8003d6:	41 ff d1             	call   *%r9
+
+00000000008003d9 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003d9:	55                   	push   %rbp
+  8003da:	48 89 e5             	mov    %rsp,%rbp
+  8003dd:	53                   	push   %rbx
+  8003de:	89 f8                	mov    %edi,%eax
+  8003e0:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8003e3:	48 63 f9             	movslq %ecx,%rdi
+  8003e6:	48 63 da             	movslq %edx,%rbx
+  8003e9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003ec:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003f1:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003ff:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  800401:	89 c2                	mov    %eax,%edx
+  800403:	48 85 c0             	test   %rax,%rax
+  800406:	78 0d                	js     800415 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  800408:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80040d:	4d 85 c9             	test   %r9,%r9
+  800410:	74 03                	je     800415 <sys_alloc_dma_region+0x3c>
+  800412:	49 89 01             	mov    %rax,(%r9)
+}
+  800415:	89 d0                	mov    %edx,%eax
+  800417:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80041b:	c9                   	leave
+  80041c:	c3                   	ret
+
+000000000080041d <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80041d:	55                   	push   %rbp
+  80041e:	48 89 e5             	mov    %rsp,%rbp
+  800421:	53                   	push   %rbx
+  800422:	48 83 ec 08          	sub    $0x8,%rsp
+  800426:	48 89 f1             	mov    %rsi,%rcx
+  800429:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80042c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80042f:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800434:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800439:	be 00 00 00 00       	mov    $0x0,%esi
+  80043e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800444:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800446:	48 85 c0             	test   %rax,%rax
+  800449:	7f 06                	jg     800451 <sys_set_cache_region+0x34>
+}
+  80044b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80044f:	c9                   	leave
+  800450:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800451:	49 89 c0             	mov    %rax,%r8
+  800454:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800459:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800460:	00 00 00 
+  800463:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800468:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80046f:	00 00 00 
+  800472:	b8 00 00 00 00       	mov    $0x0,%eax
+  800477:	49 b9 44 2f 80 00 00 	movabs $0x802f44,%r9
+  80047e:	00 00 00 
+  800481:	41 ff d1             	call   *%r9
+
+0000000000800484 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800484:	55                   	push   %rbp
+  800485:	48 89 e5             	mov    %rsp,%rbp
+  800488:	53                   	push   %rbx
+  800489:	48 83 ec 08          	sub    $0x8,%rsp
+  80048d:	48 89 f1             	mov    %rsi,%rcx
+  800490:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800493:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800496:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80049b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ad:	48 85 c0             	test   %rax,%rax
+  8004b0:	7f 06                	jg     8004b8 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8004b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b6:	c9                   	leave
+  8004b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004b8:	49 89 c0             	mov    %rax,%r8
+  8004bb:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004c0:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8004c7:	00 00 00 
+  8004ca:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004cf:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8004d6:	00 00 00 
+  8004d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004de:	49 b9 44 2f 80 00 00 	movabs $0x802f44,%r9
+  8004e5:	00 00 00 
+  8004e8:	41 ff d1             	call   *%r9
+
+00000000008004eb <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004eb:	55                   	push   %rbp
+  8004ec:	48 89 e5             	mov    %rsp,%rbp
+  8004ef:	53                   	push   %rbx
+  8004f0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004f4:	48 63 ce             	movslq %esi,%rcx
+  8004f7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004fa:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800504:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800509:	be 00 00 00 00       	mov    $0x0,%esi
+  80050e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800514:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800516:	48 85 c0             	test   %rax,%rax
+  800519:	7f 06                	jg     800521 <sys_env_set_status+0x36>
+}
+  80051b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80051f:	c9                   	leave
+  800520:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800521:	49 89 c0             	mov    %rax,%r8
+  800524:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800529:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800530:	00 00 00 
+  800533:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800538:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80053f:	00 00 00 
+  800542:	b8 00 00 00 00       	mov    $0x0,%eax
+  800547:	49 b9 44 2f 80 00 00 	movabs $0x802f44,%r9
+  80054e:	00 00 00 
+  800551:	41 ff d1             	call   *%r9
+
+0000000000800554 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800554:	55                   	push   %rbp
+  800555:	48 89 e5             	mov    %rsp,%rbp
+  800558:	53                   	push   %rbx
+  800559:	48 83 ec 08          	sub    $0x8,%rsp
+  80055d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800560:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800563:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800568:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80056d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800572:	be 00 00 00 00       	mov    $0x0,%esi
+  800577:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80057d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80057f:	48 85 c0             	test   %rax,%rax
+  800582:	7f 06                	jg     80058a <sys_env_set_trapframe+0x36>
+}
+  800584:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800588:	c9                   	leave
+  800589:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80058a:	49 89 c0             	mov    %rax,%r8
+  80058d:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  800592:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800599:	00 00 00 
+  80059c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8005a1:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8005a8:	00 00 00 
+  8005ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b0:	49 b9 44 2f 80 00 00 	movabs $0x802f44,%r9
+  8005b7:	00 00 00 
+  8005ba:	41 ff d1             	call   *%r9
+
+00000000008005bd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005bd:	55                   	push   %rbp
+  8005be:	48 89 e5             	mov    %rsp,%rbp
+  8005c1:	53                   	push   %rbx
+  8005c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005c9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005cc:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005db:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005e8:	48 85 c0             	test   %rax,%rax
+  8005eb:	7f 06                	jg     8005f3 <sys_env_set_pgfault_upcall+0x36>
+}
+  8005ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f1:	c9                   	leave
+  8005f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005f3:	49 89 c0             	mov    %rax,%r8
+  8005f6:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005fb:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800602:	00 00 00 
+  800605:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80060a:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800611:	00 00 00 
+  800614:	b8 00 00 00 00       	mov    $0x0,%eax
+  800619:	49 b9 44 2f 80 00 00 	movabs $0x802f44,%r9
+  800620:	00 00 00 
+  800623:	41 ff d1             	call   *%r9
+
+0000000000800626 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800626:	55                   	push   %rbp
+  800627:	48 89 e5             	mov    %rsp,%rbp
+  80062a:	53                   	push   %rbx
+  80062b:	89 f8                	mov    %edi,%eax
+  80062d:	49 89 f1             	mov    %rsi,%r9
+  800630:	48 89 d3             	mov    %rdx,%rbx
+  800633:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800636:	49 63 f0             	movslq %r8d,%rsi
+  800639:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80063c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800641:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800644:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80064a:	cd 30                	int    $0x30
+}
+  80064c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800650:	c9                   	leave
+  800651:	c3                   	ret
+
+0000000000800652 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800652:	55                   	push   %rbp
+  800653:	48 89 e5             	mov    %rsp,%rbp
+  800656:	53                   	push   %rbx
+  800657:	48 83 ec 08          	sub    $0x8,%rsp
+  80065b:	48 89 fa             	mov    %rdi,%rdx
+  80065e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800661:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800666:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80066b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800670:	be 00 00 00 00       	mov    $0x0,%esi
+  800675:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80067b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80067d:	48 85 c0             	test   %rax,%rax
+  800680:	7f 06                	jg     800688 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800682:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800686:	c9                   	leave
+  800687:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800688:	49 89 c0             	mov    %rax,%r8
+  80068b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800690:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800697:	00 00 00 
+  80069a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80069f:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8006a6:	00 00 00 
+  8006a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ae:	49 b9 44 2f 80 00 00 	movabs $0x802f44,%r9
+  8006b5:	00 00 00 
+  8006b8:	41 ff d1             	call   *%r9
+
+00000000008006bb <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8006bb:	55                   	push   %rbp
+  8006bc:	48 89 e5             	mov    %rsp,%rbp
+  8006bf:	53                   	push   %rbx
+  8006c0:	48 89 fa             	mov    %rdi,%rdx
+  8006c3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006c6:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8006da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006e0:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006e6:	c9                   	leave
+  8006e7:	c3                   	ret
+
+00000000008006e8 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006e8:	55                   	push   %rbp
+  8006e9:	48 89 e5             	mov    %rsp,%rbp
+  8006ec:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006ed:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800701:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800706:	be 00 00 00 00       	mov    $0x0,%esi
+  80070b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800711:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800713:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800717:	c9                   	leave
+  800718:	c3                   	ret
+
+0000000000800719 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800719:	48 85 ff             	test   %rdi,%rdi
+  80071c:	0f 84 b6 01 00 00    	je     8008d8 <malloc+0x1bf>
+malloc(size_t size) {
+  800722:	55                   	push   %rbp
+  800723:	48 89 e5             	mov    %rsp,%rbp
+  800726:	41 56                	push   %r14
+  800728:	41 55                	push   %r13
+  80072a:	41 54                	push   %r12
+  80072c:	53                   	push   %rbx
+  80072d:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800730:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800737:	00 00 00 
+  80073a:	4c 8b 20             	mov    (%rax),%r12
+  80073d:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  800744:	0f 87 94 01 00 00    	ja     8008de <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  80074a:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800751:	00 00 00 
+  800754:	48 85 c0             	test   %rax,%rax
+  800757:	74 6b                	je     8007c4 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  800759:	4d 85 e4             	test   %r12,%r12
+  80075c:	74 66                	je     8007c4 <malloc+0xab>
+  80075e:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  800765:	00 00 00 
+  800768:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076d:	eb 0d                	jmp    80077c <malloc+0x63>
+  80076f:	48 83 c1 01          	add    $0x1,%rcx
+  800773:	48 83 c2 18          	add    $0x18,%rdx
+  800777:	49 39 cc             	cmp    %rcx,%r12
+  80077a:	74 48                	je     8007c4 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80077c:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  800781:	74 ec                	je     80076f <malloc+0x56>
+  800783:	48 39 1a             	cmp    %rbx,(%rdx)
+  800786:	72 e7                	jb     80076f <malloc+0x56>
+                real_freep_size--;
+  800788:	48 83 e8 01          	sub    $0x1,%rax
+  80078c:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800793:	00 00 00 
+                freep[i].is_free = false;
+  800796:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80079d:	00 00 00 
+  8007a0:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8007a4:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8007a8:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8007ac:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8007b3:	00 
+                freep[i].size = size;
+  8007b4:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8007b8:	48 01 c8             	add    %rcx,%rax
+  8007bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007bf:	e9 0b 01 00 00       	jmp    8008cf <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8007c4:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8007cb:	00 00 00 
+  8007ce:	48 01 d8             	add    %rbx,%rax
+  8007d1:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007d7:	76 7c                	jbe    800855 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007d9:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8007e0:	00 00 00 
+  8007e3:	4c 8b 30             	mov    (%rax),%r14
+  8007e6:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8007ed:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8007f0:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8007f7:	00 00 00 
+  8007fa:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  800801:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  800808:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80080e:	4c 0f 45 eb          	cmovne %rbx,%r13
+  800812:	48 b8 e5 01 80 00 00 	movabs $0x8001e5,%rax
+  800819:	00 00 00 
+  80081c:	ff d0                	call   *%rax
+  80081e:	89 c7                	mov    %eax,%edi
+  800820:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  800827:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80082e:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  800835:	00 00 00 
+  800838:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80083c:	b9 26 00 00 00       	mov    $0x26,%ecx
+  800841:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  800848:	00 00 00 
+  80084b:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80084d:	85 c0                	test   %eax,%eax
+  80084f:	0f 88 90 00 00 00    	js     8008e5 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  800855:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  80085c:	00 00 00 
+  80085f:	48 8b 31             	mov    (%rcx),%rsi
+  800862:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  800869:	00 00 00 
+  80086c:	4c 8b 07             	mov    (%rdi),%r8
+  80086f:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  800873:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  80087a:	00 00 00 
+  80087d:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  800881:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  800885:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80088c:	00 00 00 
+  80088f:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  800893:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  800896:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  80089a:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8008a1:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8008a2:	48 89 d8             	mov    %rbx,%rax
+  8008a5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8008aa:	4c 01 c0             	add    %r8,%rax
+  8008ad:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8008b0:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8008b7:	48 01 f3             	add    %rsi,%rbx
+  8008ba:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8008bd:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8008c2:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008c9:	00 00 00 
+  8008cc:	48 89 d0             	mov    %rdx,%rax
+}
+  8008cf:	5b                   	pop    %rbx
+  8008d0:	41 5c                	pop    %r12
+  8008d2:	41 5d                	pop    %r13
+  8008d4:	41 5e                	pop    %r14
+  8008d6:	5d                   	pop    %rbp
+  8008d7:	c3                   	ret
+        return NULL;
+  8008d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008dd:	c3                   	ret
+        return NULL;
+  8008de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e3:	eb ea                	jmp    8008cf <malloc+0x1b6>
+            return NULL;
+  8008e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ea:	eb e3                	jmp    8008cf <malloc+0x1b6>
+
+00000000008008ec <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8008ec:	55                   	push   %rbp
+  8008ed:	48 89 e5             	mov    %rsp,%rbp
+  8008f0:	53                   	push   %rbx
+  8008f1:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8008f5:	48 89 fb             	mov    %rdi,%rbx
+  8008f8:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8008fc:	48 89 df             	mov    %rbx,%rdi
+  8008ff:	48 b8 19 07 80 00 00 	movabs $0x800719,%rax
+  800906:	00 00 00 
+  800909:	ff d0                	call   *%rax
+  80090b:	48 89 c7             	mov    %rax,%rdi
+  80090e:	48 89 da             	mov    %rbx,%rdx
+  800911:	be 00 00 00 00       	mov    $0x0,%esi
+  800916:	48 b8 ec 3c 80 00 00 	movabs $0x803cec,%rax
+  80091d:	00 00 00 
+  800920:	ff d0                	call   *%rax
+}
+  800922:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800926:	c9                   	leave
+  800927:	c3                   	ret
+
+0000000000800928 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  800928:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  80092f:	00 00 00 
+  800932:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  800939:	00 00 00 
+  80093c:	48 3b 02             	cmp    (%rdx),%rax
+  80093f:	74 4d                	je     80098e <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  800941:	48 85 c0             	test   %rax,%rax
+  800944:	74 4d                	je     800993 <get_allocsize+0x6b>
+  800946:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80094d:	00 00 00 
+  800950:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  800955:	48 3b 39             	cmp    (%rcx),%rdi
+  800958:	74 13                	je     80096d <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  80095a:	48 83 c2 01          	add    $0x1,%rdx
+  80095e:	48 83 c1 18          	add    $0x18,%rcx
+  800962:	48 39 d0             	cmp    %rdx,%rax
+  800965:	75 ee                	jne    800955 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  800967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096c:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  80096d:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800971:	b8 00 00 00 00       	mov    $0x0,%eax
+  800976:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  80097d:	00 00 00 
+  800980:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800986:	75 0b                	jne    800993 <get_allocsize+0x6b>
+  800988:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  80098d:	c3                   	ret
+        return 0;
+  80098e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800993:	c3                   	ret
+
+0000000000800994 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  800994:	48 85 ff             	test   %rdi,%rdi
+  800997:	0f 84 01 01 00 00    	je     800a9e <free+0x10a>
+free(void *ptr) {
+  80099d:	55                   	push   %rbp
+  80099e:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8009a1:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8009a8:	00 00 00 
+  8009ab:	48 8b 30             	mov    (%rax),%rsi
+  8009ae:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8009b5:	00 00 00 
+  8009b8:	48 39 c6             	cmp    %rax,%rsi
+  8009bb:	74 50                	je     800a0d <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8009bd:	48 85 f6             	test   %rsi,%rsi
+  8009c0:	74 21                	je     8009e3 <free+0x4f>
+  8009c2:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009c9:	00 00 00 
+  8009cc:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009d1:	48 3b 39             	cmp    (%rcx),%rdi
+  8009d4:	74 61                	je     800a37 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009d6:	48 83 c2 01          	add    $0x1,%rdx
+  8009da:	48 83 c1 18          	add    $0x18,%rcx
+  8009de:	48 39 d6             	cmp    %rdx,%rsi
+  8009e1:	75 ee                	jne    8009d1 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8009e3:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  8009ea:	00 00 00 
+  8009ed:	be 12 01 00 00       	mov    $0x112,%esi
+  8009f2:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009f9:	00 00 00 
+  8009fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a01:	48 b9 44 2f 80 00 00 	movabs $0x802f44,%rcx
+  800a08:	00 00 00 
+  800a0b:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  800a0d:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  800a14:	00 00 00 
+  800a17:	be 06 01 00 00       	mov    $0x106,%esi
+  800a1c:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a23:	00 00 00 
+  800a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2b:	48 b9 44 2f 80 00 00 	movabs $0x802f44,%rcx
+  800a32:	00 00 00 
+  800a35:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a37:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a3b:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a42:	00 00 00 
+  800a45:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a4b:	75 27                	jne    800a74 <free+0xe0>
+            freep[i].is_free = true;
+  800a4d:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a51:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a58:	00 00 00 
+  800a5b:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a62:	00 00 
+            real_freep_size++;
+  800a64:	48 83 c0 01          	add    $0x1,%rax
+  800a68:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a6f:	00 00 00 
+}
+  800a72:	5d                   	pop    %rbp
+  800a73:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a74:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a7b:	00 00 00 
+  800a7e:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800a83:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a8a:	00 00 00 
+  800a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a92:	48 b9 44 2f 80 00 00 	movabs $0x802f44,%rcx
+  800a99:	00 00 00 
+  800a9c:	ff d1                	call   *%rcx
+  800a9e:	c3                   	ret
+
+0000000000800a9f <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800a9f:	55                   	push   %rbp
+  800aa0:	48 89 e5             	mov    %rsp,%rbp
+  800aa3:	41 55                	push   %r13
+  800aa5:	41 54                	push   %r12
+  800aa7:	53                   	push   %rbx
+  800aa8:	48 83 ec 08          	sub    $0x8,%rsp
+  800aac:	48 89 fb             	mov    %rdi,%rbx
+  800aaf:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800ab2:	48 b8 28 09 80 00 00 	movabs $0x800928,%rax
+  800ab9:	00 00 00 
+  800abc:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800abe:	49 39 c5             	cmp    %rax,%r13
+  800ac1:	73 0e                	jae    800ad1 <realloc+0x32>
+}
+  800ac3:	48 89 d8             	mov    %rbx,%rax
+  800ac6:	48 83 c4 08          	add    $0x8,%rsp
+  800aca:	5b                   	pop    %rbx
+  800acb:	41 5c                	pop    %r12
+  800acd:	41 5d                	pop    %r13
+  800acf:	5d                   	pop    %rbp
+  800ad0:	c3                   	ret
+  800ad1:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800ad4:	4c 89 ef             	mov    %r13,%rdi
+  800ad7:	48 b8 19 07 80 00 00 	movabs $0x800719,%rax
+  800ade:	00 00 00 
+  800ae1:	ff d0                	call   *%rax
+  800ae3:	48 89 c7             	mov    %rax,%rdi
+  800ae6:	4c 89 e2             	mov    %r12,%rdx
+  800ae9:	48 89 de             	mov    %rbx,%rsi
+  800aec:	48 b8 01 3e 80 00 00 	movabs $0x803e01,%rax
+  800af3:	00 00 00 
+  800af6:	ff d0                	call   *%rax
+  800af8:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800afb:	48 89 df             	mov    %rbx,%rdi
+  800afe:	48 b8 94 09 80 00 00 	movabs $0x800994,%rax
+  800b05:	00 00 00 
+  800b08:	ff d0                	call   *%rax
+    return newptr;
+  800b0a:	4c 89 e3             	mov    %r12,%rbx
+  800b0d:	eb b4                	jmp    800ac3 <realloc+0x24>
+
+0000000000800b0f <strdup>:
+
+char*
+strdup (const char *src) {
+  800b0f:	55                   	push   %rbp
+  800b10:	48 89 e5             	mov    %rsp,%rbp
+  800b13:	41 54                	push   %r12
+  800b15:	53                   	push   %rbx
+  800b16:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800b19:	48 b8 ce 39 80 00 00 	movabs $0x8039ce,%rax
+  800b20:	00 00 00 
+  800b23:	ff d0                	call   *%rax
+  800b25:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b29:	4c 89 e7             	mov    %r12,%rdi
+  800b2c:	48 b8 19 07 80 00 00 	movabs $0x800719,%rax
+  800b33:	00 00 00 
+  800b36:	ff d0                	call   *%rax
+  800b38:	48 89 c7             	mov    %rax,%rdi
+  800b3b:	4c 89 e2             	mov    %r12,%rdx
+  800b3e:	48 89 de             	mov    %rbx,%rsi
+  800b41:	48 b8 01 3e 80 00 00 	movabs $0x803e01,%rax
+  800b48:	00 00 00 
+  800b4b:	ff d0                	call   *%rax
+}
+  800b4d:	5b                   	pop    %rbx
+  800b4e:	41 5c                	pop    %r12
+  800b50:	5d                   	pop    %rbp
+  800b51:	c3                   	ret
+
+0000000000800b52 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b52:	55                   	push   %rbp
+  800b53:	48 89 e5             	mov    %rsp,%rbp
+  800b56:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b57:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b61:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b6b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b70:	be 00 00 00 00       	mov    $0x0,%esi
+  800b75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b7b:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b81:	c9                   	leave
+  800b82:	c3                   	ret
+
+0000000000800b83 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800b83:	55                   	push   %rbp
+  800b84:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800b87:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800b8e:	00 00 00 
+  800b91:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b95:	74 26                	je     800bbd <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800b97:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b99:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b9d:	89 c0                	mov    %eax,%eax
+  800b9f:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800ba2:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800ba9:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800bb0:	00 00 00 
+  800bb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb8:	48 f7 31             	divq   (%rcx)
+}
+  800bbb:	5d                   	pop    %rbp
+  800bbc:	c3                   	ret
+        freq = get_cpufreq();
+  800bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc2:	48 ba 52 0b 80 00 00 	movabs $0x800b52,%rdx
+  800bc9:	00 00 00 
+  800bcc:	ff d2                	call   *%rdx
+  800bce:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bd5:	00 00 00 
+  800bd8:	eb bd                	jmp    800b97 <get_ticks+0x14>
+
+0000000000800bda <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bda:	55                   	push   %rbp
+  800bdb:	48 89 e5             	mov    %rsp,%rbp
+  800bde:	53                   	push   %rbx
+  800bdf:	48 83 ec 08          	sub    $0x8,%rsp
+  800be3:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800be6:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bed:	00 00 00 
+  800bf0:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800bf4:	74 50                	je     800c46 <sleep+0x6c>
+    asm volatile("rdtsc"
+  800bf6:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bf8:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bfc:	89 c0                	mov    %eax,%eax
+  800bfe:	48 89 d6             	mov    %rdx,%rsi
+  800c01:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800c04:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800c0b:	00 00 00 
+  800c0e:	48 0f af 18          	imul   (%rax),%rbx
+  800c12:	48 c1 eb 03          	shr    $0x3,%rbx
+  800c16:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800c1d:	9b c4 20 
+  800c20:	48 89 d8             	mov    %rbx,%rax
+  800c23:	48 f7 e2             	mul    %rdx
+  800c26:	48 89 d1             	mov    %rdx,%rcx
+  800c29:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c2d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c2f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c33:	89 c0                	mov    %eax,%eax
+  800c35:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c38:	48 29 f2             	sub    %rsi,%rdx
+  800c3b:	48 39 ca             	cmp    %rcx,%rdx
+  800c3e:	72 ed                	jb     800c2d <sleep+0x53>
+}
+  800c40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c44:	c9                   	leave
+  800c45:	c3                   	ret
+        freq = get_cpufreq();
+  800c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4b:	48 ba 52 0b 80 00 00 	movabs $0x800b52,%rdx
+  800c52:	00 00 00 
+  800c55:	ff d2                	call   *%rdx
+  800c57:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c5e:	00 00 00 
+  800c61:	eb 93                	jmp    800bf6 <sleep+0x1c>
+
+0000000000800c63 <poll_kbd>:
+
+int poll_kbd() {
+  800c63:	55                   	push   %rbp
+  800c64:	48 89 e5             	mov    %rsp,%rbp
+  800c67:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c68:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c72:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c7c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c81:	be 00 00 00 00       	mov    $0x0,%esi
+  800c86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c8c:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c8e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c92:	c9                   	leave
+  800c93:	c3                   	ret
+
+0000000000800c94 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800c94:	55                   	push   %rbp
+  800c95:	48 89 e5             	mov    %rsp,%rbp
+  800c98:	53                   	push   %rbx
+  800c99:	49 89 fa             	mov    %rdi,%r10
+  800c9c:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800c9e:	44 89 c6             	mov    %r8d,%esi
+  800ca1:	89 cf                	mov    %ecx,%edi
+  800ca3:	89 d3                	mov    %edx,%ebx
+  800ca5:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800ca7:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800cac:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800caf:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800cb3:	cd 30                	int    $0x30
+  800cb5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cb9:	c9                   	leave
+  800cba:	c3                   	ret
+
+0000000000800cbb <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800cbb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cc2:	ff ff ff 
+  800cc5:	48 01 f8             	add    %rdi,%rax
+  800cc8:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800ccc:	c3                   	ret
+
+0000000000800ccd <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800ccd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cd4:	ff ff ff 
+  800cd7:	48 01 f8             	add    %rdi,%rax
+  800cda:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800cde:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800ce4:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800ce8:	c3                   	ret
+
+0000000000800ce9 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800ce9:	55                   	push   %rbp
+  800cea:	48 89 e5             	mov    %rsp,%rbp
+  800ced:	41 57                	push   %r15
+  800cef:	41 56                	push   %r14
+  800cf1:	41 55                	push   %r13
+  800cf3:	41 54                	push   %r12
+  800cf5:	53                   	push   %rbx
+  800cf6:	48 83 ec 08          	sub    $0x8,%rsp
+  800cfa:	49 89 ff             	mov    %rdi,%r15
+  800cfd:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800d02:	49 bd 9d 2b 80 00 00 	movabs $0x802b9d,%r13
+  800d09:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800d0c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800d12:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800d15:	48 89 df             	mov    %rbx,%rdi
+  800d18:	41 ff d5             	call   *%r13
+  800d1b:	83 e0 04             	and    $0x4,%eax
+  800d1e:	74 17                	je     800d37 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800d20:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800d27:	4c 39 f3             	cmp    %r14,%rbx
+  800d2a:	75 e6                	jne    800d12 <fd_alloc+0x29>
+  800d2c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d32:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d37:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d3a:	48 83 c4 08          	add    $0x8,%rsp
+  800d3e:	5b                   	pop    %rbx
+  800d3f:	41 5c                	pop    %r12
+  800d41:	41 5d                	pop    %r13
+  800d43:	41 5e                	pop    %r14
+  800d45:	41 5f                	pop    %r15
+  800d47:	5d                   	pop    %rbp
+  800d48:	c3                   	ret
+
+0000000000800d49 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d49:	83 ff 1f             	cmp    $0x1f,%edi
+  800d4c:	77 39                	ja     800d87 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d4e:	55                   	push   %rbp
+  800d4f:	48 89 e5             	mov    %rsp,%rbp
+  800d52:	41 54                	push   %r12
+  800d54:	53                   	push   %rbx
+  800d55:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d58:	48 63 df             	movslq %edi,%rbx
+  800d5b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d62:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d66:	48 89 df             	mov    %rbx,%rdi
+  800d69:	48 b8 9d 2b 80 00 00 	movabs $0x802b9d,%rax
+  800d70:	00 00 00 
+  800d73:	ff d0                	call   *%rax
+  800d75:	a8 04                	test   $0x4,%al
+  800d77:	74 14                	je     800d8d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d79:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d82:	5b                   	pop    %rbx
+  800d83:	41 5c                	pop    %r12
+  800d85:	5d                   	pop    %rbp
+  800d86:	c3                   	ret
+        return -E_INVAL;
+  800d87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d8c:	c3                   	ret
+        return -E_INVAL;
+  800d8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d92:	eb ee                	jmp    800d82 <fd_lookup+0x39>
+
+0000000000800d94 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d94:	55                   	push   %rbp
+  800d95:	48 89 e5             	mov    %rsp,%rbp
+  800d98:	41 54                	push   %r12
+  800d9a:	53                   	push   %rbx
+  800d9b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800d9e:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800da5:	00 00 00 
+  800da8:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800daf:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800db2:	39 3b                	cmp    %edi,(%rbx)
+  800db4:	74 47                	je     800dfd <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800db6:	48 83 c0 08          	add    $0x8,%rax
+  800dba:	48 8b 18             	mov    (%rax),%rbx
+  800dbd:	48 85 db             	test   %rbx,%rbx
+  800dc0:	75 f0                	jne    800db2 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800dc2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800dc9:	00 00 00 
+  800dcc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800dd2:	89 fa                	mov    %edi,%edx
+  800dd4:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  800ddb:	00 00 00 
+  800dde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de3:	48 b9 94 30 80 00 00 	movabs $0x803094,%rcx
+  800dea:	00 00 00 
+  800ded:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800def:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800df4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800df8:	5b                   	pop    %rbx
+  800df9:	41 5c                	pop    %r12
+  800dfb:	5d                   	pop    %rbp
+  800dfc:	c3                   	ret
+            return 0;
+  800dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e02:	eb f0                	jmp    800df4 <dev_lookup+0x60>
+
+0000000000800e04 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800e04:	55                   	push   %rbp
+  800e05:	48 89 e5             	mov    %rsp,%rbp
+  800e08:	41 55                	push   %r13
+  800e0a:	41 54                	push   %r12
+  800e0c:	53                   	push   %rbx
+  800e0d:	48 83 ec 18          	sub    $0x18,%rsp
+  800e11:	48 89 fb             	mov    %rdi,%rbx
+  800e14:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800e17:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800e1e:	ff ff ff 
+  800e21:	48 01 df             	add    %rbx,%rdi
+  800e24:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800e28:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e2c:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  800e33:	00 00 00 
+  800e36:	ff d0                	call   *%rax
+  800e38:	41 89 c5             	mov    %eax,%r13d
+  800e3b:	85 c0                	test   %eax,%eax
+  800e3d:	78 06                	js     800e45 <fd_close+0x41>
+  800e3f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e43:	74 1a                	je     800e5f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e45:	45 84 e4             	test   %r12b,%r12b
+  800e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e51:	44 89 e8             	mov    %r13d,%eax
+  800e54:	48 83 c4 18          	add    $0x18,%rsp
+  800e58:	5b                   	pop    %rbx
+  800e59:	41 5c                	pop    %r12
+  800e5b:	41 5d                	pop    %r13
+  800e5d:	5d                   	pop    %rbp
+  800e5e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e5f:	8b 3b                	mov    (%rbx),%edi
+  800e61:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e65:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  800e6c:	00 00 00 
+  800e6f:	ff d0                	call   *%rax
+  800e71:	41 89 c5             	mov    %eax,%r13d
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	78 1b                	js     800e93 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e78:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e7c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800e80:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e86:	48 85 c0             	test   %rax,%rax
+  800e89:	74 08                	je     800e93 <fd_close+0x8f>
+  800e8b:	48 89 df             	mov    %rbx,%rdi
+  800e8e:	ff d0                	call   *%rax
+  800e90:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800e93:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e98:	48 89 de             	mov    %rbx,%rsi
+  800e9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ea0:	48 b8 84 04 80 00 00 	movabs $0x800484,%rax
+  800ea7:	00 00 00 
+  800eaa:	ff d0                	call   *%rax
+    return res;
+  800eac:	eb a3                	jmp    800e51 <fd_close+0x4d>
+
+0000000000800eae <close>:
+
+int
+close(int fdnum) {
+  800eae:	55                   	push   %rbp
+  800eaf:	48 89 e5             	mov    %rsp,%rbp
+  800eb2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800eb6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800eba:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  800ec1:	00 00 00 
+  800ec4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800ec6:	85 c0                	test   %eax,%eax
+  800ec8:	78 15                	js     800edf <close+0x31>
+
+    return fd_close(fd, 1);
+  800eca:	be 01 00 00 00       	mov    $0x1,%esi
+  800ecf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800ed3:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  800eda:	00 00 00 
+  800edd:	ff d0                	call   *%rax
+}
+  800edf:	c9                   	leave
+  800ee0:	c3                   	ret
+
+0000000000800ee1 <close_all>:
+
+void
+close_all(void) {
+  800ee1:	55                   	push   %rbp
+  800ee2:	48 89 e5             	mov    %rsp,%rbp
+  800ee5:	41 54                	push   %r12
+  800ee7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800ee8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eed:	49 bc ae 0e 80 00 00 	movabs $0x800eae,%r12
+  800ef4:	00 00 00 
+  800ef7:	89 df                	mov    %ebx,%edi
+  800ef9:	41 ff d4             	call   *%r12
+  800efc:	83 c3 01             	add    $0x1,%ebx
+  800eff:	83 fb 20             	cmp    $0x20,%ebx
+  800f02:	75 f3                	jne    800ef7 <close_all+0x16>
+}
+  800f04:	5b                   	pop    %rbx
+  800f05:	41 5c                	pop    %r12
+  800f07:	5d                   	pop    %rbp
+  800f08:	c3                   	ret
+
+0000000000800f09 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800f09:	55                   	push   %rbp
+  800f0a:	48 89 e5             	mov    %rsp,%rbp
+  800f0d:	41 57                	push   %r15
+  800f0f:	41 56                	push   %r14
+  800f11:	41 55                	push   %r13
+  800f13:	41 54                	push   %r12
+  800f15:	53                   	push   %rbx
+  800f16:	48 83 ec 18          	sub    $0x18,%rsp
+  800f1a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800f1d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800f21:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  800f28:	00 00 00 
+  800f2b:	ff d0                	call   *%rax
+  800f2d:	89 c3                	mov    %eax,%ebx
+  800f2f:	85 c0                	test   %eax,%eax
+  800f31:	0f 88 b8 00 00 00    	js     800fef <dup+0xe6>
+    close(newfdnum);
+  800f37:	44 89 e7             	mov    %r12d,%edi
+  800f3a:	48 b8 ae 0e 80 00 00 	movabs $0x800eae,%rax
+  800f41:	00 00 00 
+  800f44:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f46:	4d 63 ec             	movslq %r12d,%r13
+  800f49:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f50:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f54:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f58:	4c 89 ff             	mov    %r15,%rdi
+  800f5b:	49 be cd 0c 80 00 00 	movabs $0x800ccd,%r14
+  800f62:	00 00 00 
+  800f65:	41 ff d6             	call   *%r14
+  800f68:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f6b:	4c 89 ef             	mov    %r13,%rdi
+  800f6e:	41 ff d6             	call   *%r14
+  800f71:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f74:	48 89 df             	mov    %rbx,%rdi
+  800f77:	48 b8 9d 2b 80 00 00 	movabs $0x802b9d,%rax
+  800f7e:	00 00 00 
+  800f81:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800f83:	a8 04                	test   $0x4,%al
+  800f85:	74 2b                	je     800fb2 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800f87:	41 89 c1             	mov    %eax,%r9d
+  800f8a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f90:	4c 89 f1             	mov    %r14,%rcx
+  800f93:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f98:	48 89 de             	mov    %rbx,%rsi
+  800f9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fa0:	48 b8 0c 03 80 00 00 	movabs $0x80030c,%rax
+  800fa7:	00 00 00 
+  800faa:	ff d0                	call   *%rax
+  800fac:	89 c3                	mov    %eax,%ebx
+  800fae:	85 c0                	test   %eax,%eax
+  800fb0:	78 4e                	js     801000 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800fb2:	4c 89 ff             	mov    %r15,%rdi
+  800fb5:	48 b8 9d 2b 80 00 00 	movabs $0x802b9d,%rax
+  800fbc:	00 00 00 
+  800fbf:	ff d0                	call   *%rax
+  800fc1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800fc4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fca:	4c 89 e9             	mov    %r13,%rcx
+  800fcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd2:	4c 89 fe             	mov    %r15,%rsi
+  800fd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fda:	48 b8 0c 03 80 00 00 	movabs $0x80030c,%rax
+  800fe1:	00 00 00 
+  800fe4:	ff d0                	call   *%rax
+  800fe6:	89 c3                	mov    %eax,%ebx
+  800fe8:	85 c0                	test   %eax,%eax
+  800fea:	78 14                	js     801000 <dup+0xf7>
+
+    return newfdnum;
+  800fec:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800fef:	89 d8                	mov    %ebx,%eax
+  800ff1:	48 83 c4 18          	add    $0x18,%rsp
+  800ff5:	5b                   	pop    %rbx
+  800ff6:	41 5c                	pop    %r12
+  800ff8:	41 5d                	pop    %r13
+  800ffa:	41 5e                	pop    %r14
+  800ffc:	41 5f                	pop    %r15
+  800ffe:	5d                   	pop    %rbp
+  800fff:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801000:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801005:	4c 89 ee             	mov    %r13,%rsi
+  801008:	bf 00 00 00 00       	mov    $0x0,%edi
+  80100d:	49 bc 84 04 80 00 00 	movabs $0x800484,%r12
+  801014:	00 00 00 
+  801017:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80101a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80101f:	4c 89 f6             	mov    %r14,%rsi
+  801022:	bf 00 00 00 00       	mov    $0x0,%edi
+  801027:	41 ff d4             	call   *%r12
+    return res;
+  80102a:	eb c3                	jmp    800fef <dup+0xe6>
+
+000000000080102c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80102c:	55                   	push   %rbp
+  80102d:	48 89 e5             	mov    %rsp,%rbp
+  801030:	41 56                	push   %r14
+  801032:	41 55                	push   %r13
+  801034:	41 54                	push   %r12
+  801036:	53                   	push   %rbx
+  801037:	48 83 ec 10          	sub    $0x10,%rsp
+  80103b:	89 fb                	mov    %edi,%ebx
+  80103d:	49 89 f4             	mov    %rsi,%r12
+  801040:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801043:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801047:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  80104e:	00 00 00 
+  801051:	ff d0                	call   *%rax
+  801053:	85 c0                	test   %eax,%eax
+  801055:	78 4c                	js     8010a3 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801057:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80105b:	41 8b 3e             	mov    (%r14),%edi
+  80105e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801062:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  801069:	00 00 00 
+  80106c:	ff d0                	call   *%rax
+  80106e:	85 c0                	test   %eax,%eax
+  801070:	78 35                	js     8010a7 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801072:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801076:	83 e0 03             	and    $0x3,%eax
+  801079:	83 f8 01             	cmp    $0x1,%eax
+  80107c:	74 2d                	je     8010ab <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80107e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801082:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801086:	48 85 c0             	test   %rax,%rax
+  801089:	74 56                	je     8010e1 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80108b:	4c 89 ea             	mov    %r13,%rdx
+  80108e:	4c 89 e6             	mov    %r12,%rsi
+  801091:	4c 89 f7             	mov    %r14,%rdi
+  801094:	ff d0                	call   *%rax
+}
+  801096:	48 83 c4 10          	add    $0x10,%rsp
+  80109a:	5b                   	pop    %rbx
+  80109b:	41 5c                	pop    %r12
+  80109d:	41 5d                	pop    %r13
+  80109f:	41 5e                	pop    %r14
+  8010a1:	5d                   	pop    %rbp
+  8010a2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8010a3:	48 98                	cltq
+  8010a5:	eb ef                	jmp    801096 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010a7:	48 98                	cltq
+  8010a9:	eb eb                	jmp    801096 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8010ab:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8010b2:	00 00 00 
+  8010b5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8010bb:	89 da                	mov    %ebx,%edx
+  8010bd:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  8010c4:	00 00 00 
+  8010c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010cc:	48 b9 94 30 80 00 00 	movabs $0x803094,%rcx
+  8010d3:	00 00 00 
+  8010d6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010d8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8010df:	eb b5                	jmp    801096 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010e1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8010e8:	eb ac                	jmp    801096 <read+0x6a>
+
+00000000008010ea <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8010ea:	55                   	push   %rbp
+  8010eb:	48 89 e5             	mov    %rsp,%rbp
+  8010ee:	41 57                	push   %r15
+  8010f0:	41 56                	push   %r14
+  8010f2:	41 55                	push   %r13
+  8010f4:	41 54                	push   %r12
+  8010f6:	53                   	push   %rbx
+  8010f7:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8010fb:	48 85 d2             	test   %rdx,%rdx
+  8010fe:	74 54                	je     801154 <readn+0x6a>
+  801100:	41 89 fd             	mov    %edi,%r13d
+  801103:	49 89 f6             	mov    %rsi,%r14
+  801106:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801109:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80110e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801113:	49 bf 2c 10 80 00 00 	movabs $0x80102c,%r15
+  80111a:	00 00 00 
+  80111d:	4c 89 e2             	mov    %r12,%rdx
+  801120:	48 29 f2             	sub    %rsi,%rdx
+  801123:	4c 01 f6             	add    %r14,%rsi
+  801126:	44 89 ef             	mov    %r13d,%edi
+  801129:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80112c:	85 c0                	test   %eax,%eax
+  80112e:	78 20                	js     801150 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801130:	01 c3                	add    %eax,%ebx
+  801132:	85 c0                	test   %eax,%eax
+  801134:	74 08                	je     80113e <readn+0x54>
+  801136:	48 63 f3             	movslq %ebx,%rsi
+  801139:	4c 39 e6             	cmp    %r12,%rsi
+  80113c:	72 df                	jb     80111d <readn+0x33>
+    }
+    return res;
+  80113e:	48 63 c3             	movslq %ebx,%rax
+}
+  801141:	48 83 c4 08          	add    $0x8,%rsp
+  801145:	5b                   	pop    %rbx
+  801146:	41 5c                	pop    %r12
+  801148:	41 5d                	pop    %r13
+  80114a:	41 5e                	pop    %r14
+  80114c:	41 5f                	pop    %r15
+  80114e:	5d                   	pop    %rbp
+  80114f:	c3                   	ret
+        if (inc < 0) return inc;
+  801150:	48 98                	cltq
+  801152:	eb ed                	jmp    801141 <readn+0x57>
+    int inc = 1, res = 0;
+  801154:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801159:	eb e3                	jmp    80113e <readn+0x54>
+
+000000000080115b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80115b:	55                   	push   %rbp
+  80115c:	48 89 e5             	mov    %rsp,%rbp
+  80115f:	41 56                	push   %r14
+  801161:	41 55                	push   %r13
+  801163:	41 54                	push   %r12
+  801165:	53                   	push   %rbx
+  801166:	48 83 ec 10          	sub    $0x10,%rsp
+  80116a:	89 fb                	mov    %edi,%ebx
+  80116c:	49 89 f4             	mov    %rsi,%r12
+  80116f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801172:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801176:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  80117d:	00 00 00 
+  801180:	ff d0                	call   *%rax
+  801182:	85 c0                	test   %eax,%eax
+  801184:	78 47                	js     8011cd <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801186:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80118a:	41 8b 3e             	mov    (%r14),%edi
+  80118d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801191:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  801198:	00 00 00 
+  80119b:	ff d0                	call   *%rax
+  80119d:	85 c0                	test   %eax,%eax
+  80119f:	78 30                	js     8011d1 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8011a1:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8011a6:	74 2d                	je     8011d5 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8011a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011ac:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8011b0:	48 85 c0             	test   %rax,%rax
+  8011b3:	74 56                	je     80120b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8011b5:	4c 89 ea             	mov    %r13,%rdx
+  8011b8:	4c 89 e6             	mov    %r12,%rsi
+  8011bb:	4c 89 f7             	mov    %r14,%rdi
+  8011be:	ff d0                	call   *%rax
+}
+  8011c0:	48 83 c4 10          	add    $0x10,%rsp
+  8011c4:	5b                   	pop    %rbx
+  8011c5:	41 5c                	pop    %r12
+  8011c7:	41 5d                	pop    %r13
+  8011c9:	41 5e                	pop    %r14
+  8011cb:	5d                   	pop    %rbp
+  8011cc:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011cd:	48 98                	cltq
+  8011cf:	eb ef                	jmp    8011c0 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011d1:	48 98                	cltq
+  8011d3:	eb eb                	jmp    8011c0 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011d5:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8011dc:	00 00 00 
+  8011df:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8011e5:	89 da                	mov    %ebx,%edx
+  8011e7:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  8011ee:	00 00 00 
+  8011f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f6:	48 b9 94 30 80 00 00 	movabs $0x803094,%rcx
+  8011fd:	00 00 00 
+  801200:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801202:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801209:	eb b5                	jmp    8011c0 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80120b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801212:	eb ac                	jmp    8011c0 <write+0x65>
+
+0000000000801214 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801214:	55                   	push   %rbp
+  801215:	48 89 e5             	mov    %rsp,%rbp
+  801218:	53                   	push   %rbx
+  801219:	48 83 ec 18          	sub    $0x18,%rsp
+  80121d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80121f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801223:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  80122a:	00 00 00 
+  80122d:	ff d0                	call   *%rax
+  80122f:	85 c0                	test   %eax,%eax
+  801231:	78 0c                	js     80123f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801233:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801237:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80123a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80123f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801243:	c9                   	leave
+  801244:	c3                   	ret
+
+0000000000801245 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  801245:	55                   	push   %rbp
+  801246:	48 89 e5             	mov    %rsp,%rbp
+  801249:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80124d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801251:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  801258:	00 00 00 
+  80125b:	ff d0                	call   *%rax
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	78 07                	js     801268 <tell+0x23>
+    return fdes->fd_offset;
+  801261:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801265:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  801268:	c9                   	leave
+  801269:	c3                   	ret
+
+000000000080126a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80126a:	55                   	push   %rbp
+  80126b:	48 89 e5             	mov    %rsp,%rbp
+  80126e:	41 55                	push   %r13
+  801270:	41 54                	push   %r12
+  801272:	53                   	push   %rbx
+  801273:	48 83 ec 18          	sub    $0x18,%rsp
+  801277:	89 fb                	mov    %edi,%ebx
+  801279:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80127c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801280:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  801287:	00 00 00 
+  80128a:	ff d0                	call   *%rax
+  80128c:	85 c0                	test   %eax,%eax
+  80128e:	78 38                	js     8012c8 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801290:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801294:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801298:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80129c:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  8012a3:	00 00 00 
+  8012a6:	ff d0                	call   *%rax
+  8012a8:	85 c0                	test   %eax,%eax
+  8012aa:	78 1c                	js     8012c8 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012ac:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8012b1:	74 20                	je     8012d3 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8012b7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8012bb:	48 85 c0             	test   %rax,%rax
+  8012be:	74 47                	je     801307 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8012c0:	44 89 e6             	mov    %r12d,%esi
+  8012c3:	4c 89 ef             	mov    %r13,%rdi
+  8012c6:	ff d0                	call   *%rax
+}
+  8012c8:	48 83 c4 18          	add    $0x18,%rsp
+  8012cc:	5b                   	pop    %rbx
+  8012cd:	41 5c                	pop    %r12
+  8012cf:	41 5d                	pop    %r13
+  8012d1:	5d                   	pop    %rbp
+  8012d2:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8012d3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8012da:	00 00 00 
+  8012dd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012e3:	89 da                	mov    %ebx,%edx
+  8012e5:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  8012ec:	00 00 00 
+  8012ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f4:	48 b9 94 30 80 00 00 	movabs $0x803094,%rcx
+  8012fb:	00 00 00 
+  8012fe:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801300:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801305:	eb c1                	jmp    8012c8 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801307:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80130c:	eb ba                	jmp    8012c8 <ftruncate+0x5e>
+
+000000000080130e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80130e:	55                   	push   %rbp
+  80130f:	48 89 e5             	mov    %rsp,%rbp
+  801312:	41 54                	push   %r12
+  801314:	53                   	push   %rbx
+  801315:	48 83 ec 10          	sub    $0x10,%rsp
+  801319:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80131c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801320:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  801327:	00 00 00 
+  80132a:	ff d0                	call   *%rax
+  80132c:	85 c0                	test   %eax,%eax
+  80132e:	78 4e                	js     80137e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801330:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801334:	41 8b 3c 24          	mov    (%r12),%edi
+  801338:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80133c:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  801343:	00 00 00 
+  801346:	ff d0                	call   *%rax
+  801348:	85 c0                	test   %eax,%eax
+  80134a:	78 32                	js     80137e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80134c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801350:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801355:	74 30                	je     801387 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801357:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80135a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801361:	00 00 00 
+    stat->st_isdir = 0;
+  801364:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80136b:	00 00 00 
+    stat->st_dev = dev;
+  80136e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801375:	48 89 de             	mov    %rbx,%rsi
+  801378:	4c 89 e7             	mov    %r12,%rdi
+  80137b:	ff 50 28             	call   *0x28(%rax)
+}
+  80137e:	48 83 c4 10          	add    $0x10,%rsp
+  801382:	5b                   	pop    %rbx
+  801383:	41 5c                	pop    %r12
+  801385:	5d                   	pop    %rbp
+  801386:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801387:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80138c:	eb f0                	jmp    80137e <fstat+0x70>
+
+000000000080138e <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80138e:	55                   	push   %rbp
+  80138f:	48 89 e5             	mov    %rsp,%rbp
+  801392:	41 54                	push   %r12
+  801394:	53                   	push   %rbx
+  801395:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80139c:	41 89 fc             	mov    %edi,%r12d
+  80139f:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8013a1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013a5:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  8013ac:	00 00 00 
+  8013af:	ff d0                	call   *%rax
+  8013b1:	85 c0                	test   %eax,%eax
+  8013b3:	78 31                	js     8013e6 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8013b5:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8013bc:	44 89 e7             	mov    %r12d,%edi
+  8013bf:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  8013c6:	00 00 00 
+  8013c9:	ff d0                	call   *%rax
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	78 17                	js     8013e6 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8013cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013d3:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8013d6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8013d9:	39 d3                	cmp    %edx,%ebx
+  8013db:	0f 4f da             	cmovg  %edx,%ebx
+  8013de:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8013e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e6:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8013ed:	5b                   	pop    %rbx
+  8013ee:	41 5c                	pop    %r12
+  8013f0:	5d                   	pop    %rbp
+  8013f1:	c3                   	ret
+
+00000000008013f2 <seektoend>:
+{
+  8013f2:	55                   	push   %rbp
+  8013f3:	48 89 e5             	mov    %rsp,%rbp
+  8013f6:	53                   	push   %rbx
+  8013f7:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8013fe:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801400:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801404:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  80140b:	00 00 00 
+  80140e:	ff d0                	call   *%rax
+  801410:	85 c0                	test   %eax,%eax
+  801412:	78 28                	js     80143c <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  801414:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80141b:	89 df                	mov    %ebx,%edi
+  80141d:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  801424:	00 00 00 
+  801427:	ff d0                	call   *%rax
+  801429:	85 c0                	test   %eax,%eax
+  80142b:	78 0f                	js     80143c <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80142d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801430:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801434:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  801437:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80143c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801440:	c9                   	leave
+  801441:	c3                   	ret
+
+0000000000801442 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801442:	55                   	push   %rbp
+  801443:	48 89 e5             	mov    %rsp,%rbp
+  801446:	41 54                	push   %r12
+  801448:	53                   	push   %rbx
+  801449:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80144c:	be 00 00 00 00       	mov    $0x0,%esi
+  801451:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  801458:	00 00 00 
+  80145b:	ff d0                	call   *%rax
+  80145d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80145f:	85 c0                	test   %eax,%eax
+  801461:	78 25                	js     801488 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801463:	4c 89 e6             	mov    %r12,%rsi
+  801466:	89 c7                	mov    %eax,%edi
+  801468:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  80146f:	00 00 00 
+  801472:	ff d0                	call   *%rax
+  801474:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801477:	89 df                	mov    %ebx,%edi
+  801479:	48 b8 ae 0e 80 00 00 	movabs $0x800eae,%rax
+  801480:	00 00 00 
+  801483:	ff d0                	call   *%rax
+
+    return res;
+  801485:	44 89 e3             	mov    %r12d,%ebx
+}
+  801488:	89 d8                	mov    %ebx,%eax
+  80148a:	5b                   	pop    %rbx
+  80148b:	41 5c                	pop    %r12
+  80148d:	5d                   	pop    %rbp
+  80148e:	c3                   	ret
+
+000000000080148f <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  80148f:	55                   	push   %rbp
+  801490:	48 89 e5             	mov    %rsp,%rbp
+  801493:	53                   	push   %rbx
+  801494:	48 83 ec 08          	sub    $0x8,%rsp
+  801498:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80149b:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  8014a2:	00 00 00 
+  8014a5:	ff d0                	call   *%rax
+  8014a7:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8014ab:	0f 87 ea 00 00 00    	ja     80159b <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8014b1:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014b8:	00 00 00 
+  8014bb:	80 38 00             	cmpb   $0x0,(%rax)
+  8014be:	75 35                	jne    8014f5 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8014c0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014c5:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8014ca:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8014cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014d4:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  8014db:	00 00 00 
+  8014de:	ff d0                	call   *%rax
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	0f 88 ba 00 00 00    	js     8015a2 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8014e8:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014ef:	00 00 00 
+  8014f2:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8014f5:	48 89 df             	mov    %rbx,%rdi
+  8014f8:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  8014ff:	00 00 00 
+  801502:	ff d0                	call   *%rax
+  801504:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  801508:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80150f:	00 00 00 
+  801512:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  801516:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  801519:	39 39                	cmp    %edi,(%rcx)
+  80151b:	74 46                	je     801563 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80151d:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  801521:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  801528:	00 
+  801529:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  801530:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  801537:	00 
+  801538:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80153f:	00 
+  801540:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  801547:	00 
+  801548:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80154f:	00 
+  801550:	89 39                	mov    %edi,(%rcx)
+  801552:	48 01 c6             	add    %rax,%rsi
+  801555:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  80155a:	48 89 c8             	mov    %rcx,%rax
+  80155d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801561:	c9                   	leave
+  801562:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  801563:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  801567:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80156e:	00 00 00 
+  801571:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801574:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  801578:	74 e0                	je     80155a <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80157a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  801581:	00 
+  801582:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  801586:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  80158d:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80158f:	8b 7b 10             	mov    0x10(%rbx),%edi
+  801592:	48 01 c2             	add    %rax,%rdx
+  801595:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  801599:	eb bf                	jmp    80155a <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80159b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a0:	eb b8                	jmp    80155a <fbuf_get+0xcb>
+            return NULL;
+  8015a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a7:	eb b1                	jmp    80155a <fbuf_get+0xcb>
+
+00000000008015a9 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8015a9:	55                   	push   %rbp
+  8015aa:	48 89 e5             	mov    %rsp,%rbp
+  8015ad:	53                   	push   %rbx
+  8015ae:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8015b2:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015b9:	00 00 00 
+  8015bc:	48 8b 18             	mov    (%rax),%rbx
+  8015bf:	48 85 db             	test   %rbx,%rbx
+  8015c2:	74 16                	je     8015da <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8015c4:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015cb:	00 00 00 
+  8015ce:	48 8b 18             	mov    (%rax),%rbx
+}
+  8015d1:	48 89 d8             	mov    %rbx,%rax
+  8015d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d8:	c9                   	leave
+  8015d9:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8015da:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015df:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8015e4:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8015e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ee:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  8015f5:	00 00 00 
+  8015f8:	ff d0                	call   *%rax
+  8015fa:	85 c0                	test   %eax,%eax
+  8015fc:	78 d3                	js     8015d1 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8015fe:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  801603:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  80160a:	00 00 00 
+  80160d:	eb b5                	jmp    8015c4 <fsipc_bulk+0x1b>
+
+000000000080160f <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80160f:	55                   	push   %rbp
+  801610:	48 89 e5             	mov    %rsp,%rbp
+  801613:	41 57                	push   %r15
+  801615:	41 56                	push   %r14
+  801617:	41 55                	push   %r13
+  801619:	41 54                	push   %r12
+  80161b:	53                   	push   %rbx
+  80161c:	48 83 ec 08          	sub    $0x8,%rsp
+  801620:	41 89 fd             	mov    %edi,%r13d
+  801623:	49 89 f6             	mov    %rsi,%r14
+  801626:	49 89 d7             	mov    %rdx,%r15
+  801629:	48 89 cb             	mov    %rcx,%rbx
+  80162c:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80162f:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801636:	00 00 00 
+  801639:	83 38 00             	cmpl   $0x0,(%rax)
+  80163c:	74 52                	je     801690 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80163e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801644:	4c 89 f9             	mov    %r15,%rcx
+  801647:	4c 89 f2             	mov    %r14,%rdx
+  80164a:	44 89 ee             	mov    %r13d,%esi
+  80164d:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  801654:	00 00 00 
+  801657:	8b 38                	mov    (%rax),%edi
+  801659:	48 b8 93 41 80 00 00 	movabs $0x804193,%rax
+  801660:	00 00 00 
+  801663:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  801665:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166a:	4c 89 e2             	mov    %r12,%rdx
+  80166d:	48 89 de             	mov    %rbx,%rsi
+  801670:	bf 00 00 00 00       	mov    $0x0,%edi
+  801675:	48 b8 e3 3f 80 00 00 	movabs $0x803fe3,%rax
+  80167c:	00 00 00 
+  80167f:	ff d0                	call   *%rax
+}
+  801681:	48 83 c4 08          	add    $0x8,%rsp
+  801685:	5b                   	pop    %rbx
+  801686:	41 5c                	pop    %r12
+  801688:	41 5d                	pop    %r13
+  80168a:	41 5e                	pop    %r14
+  80168c:	41 5f                	pop    %r15
+  80168e:	5d                   	pop    %rbp
+  80168f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801690:	bf 03 00 00 00       	mov    $0x3,%edi
+  801695:	48 b8 36 42 80 00 00 	movabs $0x804236,%rax
+  80169c:	00 00 00 
+  80169f:	ff d0                	call   *%rax
+  8016a1:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8016a8:	00 00 
+  8016aa:	eb 92                	jmp    80163e <fsipc_region+0x2f>
+
+00000000008016ac <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8016ac:	55                   	push   %rbp
+  8016ad:	48 89 e5             	mov    %rsp,%rbp
+  8016b0:	41 57                	push   %r15
+  8016b2:	41 56                	push   %r14
+  8016b4:	41 55                	push   %r13
+  8016b6:	41 54                	push   %r12
+  8016b8:	53                   	push   %rbx
+  8016b9:	48 83 ec 28          	sub    $0x28,%rsp
+  8016bd:	49 89 ff             	mov    %rdi,%r15
+  8016c0:	49 89 f6             	mov    %rsi,%r14
+  8016c3:	48 89 d3             	mov    %rdx,%rbx
+  8016c6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016ca:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8016cd:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  8016d4:	00 00 00 
+  8016d7:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8016d9:	48 85 c0             	test   %rax,%rax
+  8016dc:	0f 84 cc 00 00 00    	je     8017ae <devfile_write_direct+0x102>
+  8016e2:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8016e5:	48 85 db             	test   %rbx,%rbx
+  8016e8:	0f 84 ba 00 00 00    	je     8017a8 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8016ee:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016f4:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8016fb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8016ff:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801703:	4c 29 e3             	sub    %r12,%rbx
+  801706:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80170b:	48 39 c3             	cmp    %rax,%rbx
+  80170e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  801712:	48 89 da             	mov    %rbx,%rdx
+  801715:	4c 89 f6             	mov    %r14,%rsi
+  801718:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80171c:	48 b8 01 3e 80 00 00 	movabs $0x803e01,%rax
+  801723:	00 00 00 
+  801726:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  801728:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80172c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  801730:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801733:	44 01 e0             	add    %r12d,%eax
+  801736:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  80173a:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80173e:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  801745:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80174c:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  801753:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801759:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80175e:	4c 89 ee             	mov    %r13,%rsi
+  801761:	bf 04 00 00 00       	mov    $0x4,%edi
+  801766:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  80176d:	00 00 00 
+  801770:	ff d0                	call   *%rax
+        if (res < 0)
+  801772:	85 c0                	test   %eax,%eax
+  801774:	78 29                	js     80179f <devfile_write_direct+0xf3>
+        if (res == 0)
+  801776:	74 2b                	je     8017a3 <devfile_write_direct+0xf7>
+        i += res;
+  801778:	48 98                	cltq
+  80177a:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  80177d:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  801780:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801784:	49 39 c4             	cmp    %rax,%r12
+  801787:	0f 82 72 ff ff ff    	jb     8016ff <devfile_write_direct+0x53>
+    return i;
+  80178d:	4c 89 e0             	mov    %r12,%rax
+}
+  801790:	48 83 c4 28          	add    $0x28,%rsp
+  801794:	5b                   	pop    %rbx
+  801795:	41 5c                	pop    %r12
+  801797:	41 5d                	pop    %r13
+  801799:	41 5e                	pop    %r14
+  80179b:	41 5f                	pop    %r15
+  80179d:	5d                   	pop    %rbp
+  80179e:	c3                   	ret
+            return res;
+  80179f:	48 98                	cltq
+  8017a1:	eb ed                	jmp    801790 <devfile_write_direct+0xe4>
+            return i;
+  8017a3:	4c 89 e0             	mov    %r12,%rax
+  8017a6:	eb e8                	jmp    801790 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8017a8:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8017ac:	eb df                	jmp    80178d <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8017ae:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8017b5:	eb d9                	jmp    801790 <devfile_write_direct+0xe4>
+
+00000000008017b7 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8017b7:	55                   	push   %rbp
+  8017b8:	48 89 e5             	mov    %rsp,%rbp
+  8017bb:	41 56                	push   %r14
+  8017bd:	41 55                	push   %r13
+  8017bf:	41 54                	push   %r12
+  8017c1:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8017c2:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8017c6:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8017ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cf:	4d 39 ee             	cmp    %r13,%r14
+  8017d2:	0f 84 99 00 00 00    	je     801871 <fbuf_flush+0xba>
+  8017d8:	49 89 fc             	mov    %rdi,%r12
+  8017db:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8017de:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017e1:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8017e5:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  8017ec:	00 00 00 
+  8017ef:	ff d0                	call   *%rax
+  8017f1:	48 89 c2             	mov    %rax,%rdx
+  8017f4:	48 c1 e2 04          	shl    $0x4,%rdx
+  8017f8:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8017fc:	48 c1 e0 0c          	shl    $0xc,%rax
+  801800:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801805:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  801808:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80180c:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801813:	00 
+  801814:	44 89 f1             	mov    %r14d,%ecx
+  801817:	4c 89 ea             	mov    %r13,%rdx
+  80181a:	4c 89 e7             	mov    %r12,%rdi
+  80181d:	48 b8 ac 16 80 00 00 	movabs $0x8016ac,%rax
+  801824:	00 00 00 
+  801827:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801829:	48 85 c0             	test   %rax,%rax
+  80182c:	78 43                	js     801871 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80182e:	4c 39 e8             	cmp    %r13,%rax
+  801831:	72 47                	jb     80187a <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  801833:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  801838:	83 c0 01             	add    $0x1,%eax
+  80183b:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801840:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  801843:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801847:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  80184b:	72 0f                	jb     80185c <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  80184d:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  801851:	48 39 c2             	cmp    %rax,%rdx
+  801854:	48 0f 42 d0          	cmovb  %rax,%rdx
+  801858:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  80185c:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  801863:	00 
+  801864:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  80186b:	00 
+    return 0;
+  80186c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801871:	5b                   	pop    %rbx
+  801872:	41 5c                	pop    %r12
+  801874:	41 5d                	pop    %r13
+  801876:	41 5e                	pop    %r14
+  801878:	5d                   	pop    %rbp
+  801879:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  80187a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80187f:	eb f0                	jmp    801871 <fbuf_flush+0xba>
+
+0000000000801881 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  801881:	55                   	push   %rbp
+  801882:	48 89 e5             	mov    %rsp,%rbp
+  801885:	53                   	push   %rbx
+  801886:	48 83 ec 08          	sub    $0x8,%rsp
+  80188a:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  80188d:	48 b8 8f 14 80 00 00 	movabs $0x80148f,%rax
+  801894:	00 00 00 
+  801897:	ff d0                	call   *%rax
+  801899:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  80189c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a1:	48 85 f6             	test   %rsi,%rsi
+  8018a4:	74 0f                	je     8018b5 <devfile_sync+0x34>
+  8018a6:	48 89 df             	mov    %rbx,%rdi
+  8018a9:	48 b8 b7 17 80 00 00 	movabs $0x8017b7,%rax
+  8018b0:	00 00 00 
+  8018b3:	ff d0                	call   *%rax
+}
+  8018b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018b9:	c9                   	leave
+  8018ba:	c3                   	ret
+
+00000000008018bb <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8018bb:	55                   	push   %rbp
+  8018bc:	48 89 e5             	mov    %rsp,%rbp
+  8018bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8018c3:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8018c6:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8018cd:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8018ce:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8018d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018d7:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8018de:	00 00 00 
+  8018e1:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  8018e8:	00 00 00 
+  8018eb:	ff d0                	call   *%rax
+}
+  8018ed:	c9                   	leave
+  8018ee:	c3                   	ret
+
+00000000008018ef <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018ef:	55                   	push   %rbp
+  8018f0:	48 89 e5             	mov    %rsp,%rbp
+  8018f3:	41 54                	push   %r12
+  8018f5:	53                   	push   %rbx
+  8018f6:	48 89 fb             	mov    %rdi,%rbx
+  8018f9:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8018fc:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  801903:	00 00 00 
+  801906:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801908:	85 c0                	test   %eax,%eax
+  80190a:	78 63                	js     80196f <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80190c:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80190f:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  801916:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  801918:	be 00 00 00 00       	mov    $0x0,%esi
+  80191d:	bf 05 00 00 00       	mov    $0x5,%edi
+  801922:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  801929:	00 00 00 
+  80192c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80192e:	85 c0                	test   %eax,%eax
+  801930:	78 3d                	js     80196f <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801932:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  801939:	00 00 00 
+  80193c:	48 89 de             	mov    %rbx,%rsi
+  80193f:	4c 89 e7             	mov    %r12,%rdi
+  801942:	48 b8 0c 3a 80 00 00 	movabs $0x803a0c,%rax
+  801949:	00 00 00 
+  80194c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80194e:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  801954:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  80195b:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80195c:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  801962:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  801969:	00 
+
+    return 0;
+  80196a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80196f:	5b                   	pop    %rbx
+  801970:	41 5c                	pop    %r12
+  801972:	5d                   	pop    %rbp
+  801973:	c3                   	ret
+
+0000000000801974 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801974:	55                   	push   %rbp
+  801975:	48 89 e5             	mov    %rsp,%rbp
+  801978:	41 54                	push   %r12
+  80197a:	53                   	push   %rbx
+  80197b:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  80197e:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  801985:	00 00 00 
+  801988:	ff d0                	call   *%rax
+  80198a:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  80198d:	48 89 df             	mov    %rbx,%rdi
+  801990:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  801997:	00 00 00 
+  80199a:	ff d0                	call   *%rax
+  80199c:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8019a0:	76 2e                	jbe    8019d0 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  8019a2:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8019a5:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8019ac:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8019ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019b8:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  8019bf:	00 00 00 
+  8019c2:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019c4:	45 85 e4             	test   %r12d,%r12d
+  8019c7:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019cb:	5b                   	pop    %rbx
+  8019cc:	41 5c                	pop    %r12
+  8019ce:	5d                   	pop    %rbp
+  8019cf:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8019d0:	48 89 df             	mov    %rbx,%rdi
+  8019d3:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  8019da:	00 00 00 
+  8019dd:	ff d0                	call   *%rax
+  8019df:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8019e3:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8019ea:	00 00 00 
+  8019ed:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8019f4:	48 89 df             	mov    %rbx,%rdi
+  8019f7:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  8019fe:	00 00 00 
+  801a01:	ff d0                	call   *%rax
+  801a03:	48 89 c6             	mov    %rax,%rsi
+  801a06:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a10:	48 b8 84 04 80 00 00 	movabs $0x800484,%rax
+  801a17:	00 00 00 
+  801a1a:	ff d0                	call   *%rax
+  801a1c:	eb 84                	jmp    8019a2 <devfile_flush+0x2e>
+
+0000000000801a1e <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801a1e:	55                   	push   %rbp
+  801a1f:	48 89 e5             	mov    %rsp,%rbp
+  801a22:	41 55                	push   %r13
+  801a24:	41 54                	push   %r12
+  801a26:	53                   	push   %rbx
+  801a27:	48 83 ec 08          	sub    $0x8,%rsp
+  801a2b:	48 89 fb             	mov    %rdi,%rbx
+  801a2e:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a31:	48 b8 8f 14 80 00 00 	movabs $0x80148f,%rax
+  801a38:	00 00 00 
+  801a3b:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a3d:	48 85 c0             	test   %rax,%rax
+  801a40:	74 51                	je     801a93 <devfile_trunc+0x75>
+  801a42:	49 89 c4             	mov    %rax,%r12
+  801a45:	48 89 c6             	mov    %rax,%rsi
+  801a48:	48 89 df             	mov    %rbx,%rdi
+  801a4b:	48 b8 b7 17 80 00 00 	movabs $0x8017b7,%rax
+  801a52:	00 00 00 
+  801a55:	ff d0                	call   *%rax
+  801a57:	85 c0                	test   %eax,%eax
+  801a59:	78 2d                	js     801a88 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a5b:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a62:	00 00 00 
+  801a65:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a68:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a6a:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a6e:	be 00 00 00 00       	mov    $0x0,%esi
+  801a73:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a78:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  801a7f:	00 00 00 
+  801a82:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	79 3e                	jns    801ac6 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801a88:	48 83 c4 08          	add    $0x8,%rsp
+  801a8c:	5b                   	pop    %rbx
+  801a8d:	41 5c                	pop    %r12
+  801a8f:	41 5d                	pop    %r13
+  801a91:	5d                   	pop    %rbp
+  801a92:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a93:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a9a:	00 00 00 
+  801a9d:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801aa0:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801aa2:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801aa6:	be 00 00 00 00       	mov    $0x0,%esi
+  801aab:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ab0:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  801ab7:	00 00 00 
+  801aba:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	78 c8                	js     801a88 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801ac0:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801ac4:	eb c2                	jmp    801a88 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801ac6:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801ac9:	8d 51 01             	lea    0x1(%rcx),%edx
+  801acc:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801acf:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801ad4:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801adb:	00 00 
+  801add:	eb a9                	jmp    801a88 <devfile_trunc+0x6a>
+
+0000000000801adf <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801adf:	55                   	push   %rbp
+  801ae0:	48 89 e5             	mov    %rsp,%rbp
+  801ae3:	41 57                	push   %r15
+  801ae5:	41 56                	push   %r14
+  801ae7:	41 55                	push   %r13
+  801ae9:	41 54                	push   %r12
+  801aeb:	53                   	push   %rbx
+  801aec:	48 83 ec 28          	sub    $0x28,%rsp
+  801af0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801af4:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801af8:	49 89 d7             	mov    %rdx,%r15
+  801afb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801aff:	48 b8 8f 14 80 00 00 	movabs $0x80148f,%rax
+  801b06:	00 00 00 
+  801b09:	ff d0                	call   *%rax
+  801b0b:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801b0e:	48 85 c0             	test   %rax,%rax
+  801b11:	74 31                	je     801b44 <devfile_write+0x65>
+  801b13:	4c 89 f8             	mov    %r15,%rax
+  801b16:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801b1d:	77 25                	ja     801b44 <devfile_write+0x65>
+    size_t i = 0;
+  801b1f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801b25:	48 85 c0             	test   %rax,%rax
+  801b28:	0f 85 64 01 00 00    	jne    801c92 <devfile_write+0x1b3>
+    size_t i = 0;
+  801b2e:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b32:	4c 89 f8             	mov    %r15,%rax
+}
+  801b35:	48 83 c4 28          	add    $0x28,%rsp
+  801b39:	5b                   	pop    %rbx
+  801b3a:	41 5c                	pop    %r12
+  801b3c:	41 5d                	pop    %r13
+  801b3e:	41 5e                	pop    %r14
+  801b40:	41 5f                	pop    %r15
+  801b42:	5d                   	pop    %rbp
+  801b43:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b44:	48 85 db             	test   %rbx,%rbx
+  801b47:	74 5b                	je     801ba4 <devfile_write+0xc5>
+  801b49:	48 89 de             	mov    %rbx,%rsi
+  801b4c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b50:	48 b8 b7 17 80 00 00 	movabs $0x8017b7,%rax
+  801b57:	00 00 00 
+  801b5a:	ff d0                	call   *%rax
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 40                	js     801ba0 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b60:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b64:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801b67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b6b:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b6f:	48 b8 ac 16 80 00 00 	movabs $0x8016ac,%rax
+  801b76:	00 00 00 
+  801b79:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b7b:	48 85 c0             	test   %rax,%rax
+  801b7e:	7e b5                	jle    801b35 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801b80:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801b84:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801b87:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801b8a:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801b8d:	8d 51 01             	lea    0x1(%rcx),%edx
+  801b90:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b93:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801b96:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801b9d:	00 
+  801b9e:	eb 95                	jmp    801b35 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801ba0:	48 98                	cltq
+  801ba2:	eb 91                	jmp    801b35 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801ba4:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801ba8:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801bab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801baf:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801bb3:	48 89 df             	mov    %rbx,%rdi
+  801bb6:	48 b8 ac 16 80 00 00 	movabs $0x8016ac,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801bc2:	48 85 c0             	test   %rax,%rax
+  801bc5:	0f 8e 6a ff ff ff    	jle    801b35 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801bcb:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801bce:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801bd2:	e9 5e ff ff ff       	jmp    801b35 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bd7:	48 98                	cltq
+  801bd9:	4d 85 ff             	test   %r15,%r15
+  801bdc:	49 0f 45 c7          	cmovne %r15,%rax
+  801be0:	e9 50 ff ff ff       	jmp    801b35 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801be5:	48 89 de             	mov    %rbx,%rsi
+  801be8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801bec:	48 b8 b7 17 80 00 00 	movabs $0x8017b7,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+  801bf8:	85 c0                	test   %eax,%eax
+  801bfa:	0f 88 2b 01 00 00    	js     801d2b <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c00:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801c04:	4c 01 f8             	add    %r15,%rax
+  801c07:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801c0b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c0f:	48 b9 bb 0c 80 00 00 	movabs $0x800cbb,%rcx
+  801c16:	00 00 00 
+  801c19:	ff d1                	call   *%rcx
+  801c1b:	48 89 c2             	mov    %rax,%rdx
+  801c1e:	48 c1 e2 04          	shl    $0x4,%rdx
+  801c22:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801c26:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c2a:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c2f:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c32:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c39:	00 
+  801c3a:	4c 89 ea             	mov    %r13,%rdx
+  801c3d:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c41:	48 b8 01 3e 80 00 00 	movabs $0x803e01,%rax
+  801c48:	00 00 00 
+  801c4b:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c4d:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c51:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801c55:	48 39 c2             	cmp    %rax,%rdx
+  801c58:	0f 84 db 00 00 00    	je     801d39 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801c5e:	4c 39 e2             	cmp    %r12,%rdx
+  801c61:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801c65:	4d 01 ec             	add    %r13,%r12
+  801c68:	49 39 c4             	cmp    %rax,%r12
+  801c6b:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801c6f:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801c73:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801c77:	45 01 ee             	add    %r13d,%r14d
+  801c7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c7e:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801c82:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801c85:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c89:	49 39 c7             	cmp    %rax,%r15
+  801c8c:	0f 83 a0 fe ff ff    	jae    801b32 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801c92:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c96:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801c9a:	8b 43 08             	mov    0x8(%rbx),%eax
+  801c9d:	44 39 f0             	cmp    %r14d,%eax
+  801ca0:	7f 10                	jg     801cb2 <devfile_write+0x1d3>
+  801ca2:	48 98                	cltq
+  801ca4:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801caa:	49 63 d6             	movslq %r14d,%rdx
+  801cad:	48 39 d0             	cmp    %rdx,%rax
+  801cb0:	7d 2d                	jge    801cdf <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801cb2:	48 89 de             	mov    %rbx,%rsi
+  801cb5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801cb9:	48 b8 b7 17 80 00 00 	movabs $0x8017b7,%rax
+  801cc0:	00 00 00 
+  801cc3:	ff d0                	call   *%rax
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	0f 88 0a ff ff ff    	js     801bd7 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801ccd:	44 89 f0             	mov    %r14d,%eax
+  801cd0:	66 b8 00 00          	mov    $0x0,%ax
+  801cd4:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801cd7:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801cde:	00 
+        size_t off = pos - fb->fb_base;
+  801cdf:	45 89 f4             	mov    %r14d,%r12d
+  801ce2:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801ce6:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801ce9:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801ced:	4d 29 fd             	sub    %r15,%r13
+  801cf0:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801cf5:	4c 29 e0             	sub    %r12,%rax
+  801cf8:	49 39 c5             	cmp    %rax,%r13
+  801cfb:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801cff:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801d03:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801d07:	48 39 c2             	cmp    %rax,%rdx
+  801d0a:	0f 84 f0 fe ff ff    	je     801c00 <devfile_write+0x121>
+  801d10:	4c 39 e0             	cmp    %r12,%rax
+  801d13:	0f 82 cc fe ff ff    	jb     801be5 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801d19:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d1d:	48 39 d0             	cmp    %rdx,%rax
+  801d20:	0f 83 da fe ff ff    	jae    801c00 <devfile_write+0x121>
+  801d26:	e9 ba fe ff ff       	jmp    801be5 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d2b:	48 98                	cltq
+  801d2d:	4d 85 ff             	test   %r15,%r15
+  801d30:	49 0f 45 c7          	cmovne %r15,%rax
+  801d34:	e9 fc fd ff ff       	jmp    801b35 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d39:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d3d:	4c 89 e2             	mov    %r12,%rdx
+  801d40:	e9 2a ff ff ff       	jmp    801c6f <devfile_write+0x190>
+
+0000000000801d45 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d45:	55                   	push   %rbp
+  801d46:	48 89 e5             	mov    %rsp,%rbp
+  801d49:	41 57                	push   %r15
+  801d4b:	41 56                	push   %r14
+  801d4d:	41 55                	push   %r13
+  801d4f:	41 54                	push   %r12
+  801d51:	53                   	push   %rbx
+  801d52:	48 83 ec 28          	sub    $0x28,%rsp
+  801d56:	49 89 ff             	mov    %rdi,%r15
+  801d59:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801d5d:	48 89 d3             	mov    %rdx,%rbx
+  801d60:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801d64:	48 b8 8f 14 80 00 00 	movabs $0x80148f,%rax
+  801d6b:	00 00 00 
+  801d6e:	ff d0                	call   *%rax
+  801d70:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801d73:	48 85 c0             	test   %rax,%rax
+  801d76:	74 0d                	je     801d85 <devfile_read+0x40>
+  801d78:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801d7f:	0f 86 1a 01 00 00    	jbe    801e9f <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801d85:	4d 85 e4             	test   %r12,%r12
+  801d88:	74 1a                	je     801da4 <devfile_read+0x5f>
+  801d8a:	4c 89 e6             	mov    %r12,%rsi
+  801d8d:	4c 89 ff             	mov    %r15,%rdi
+  801d90:	48 b8 b7 17 80 00 00 	movabs $0x8017b7,%rax
+  801d97:	00 00 00 
+  801d9a:	ff d0                	call   *%rax
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	0f 88 e8 00 00 00    	js     801e8c <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801da4:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801da8:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  801daf:	00 00 00 
+  801db2:	ff d0                	call   *%rax
+  801db4:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801db7:	48 85 c0             	test   %rax,%rax
+  801dba:	0f 84 69 02 00 00    	je     802029 <devfile_read+0x2e4>
+    while (i < n) {
+  801dc0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801dc5:	0f 84 ce 00 00 00    	je     801e99 <devfile_read+0x154>
+    size_t i = 0;
+  801dcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801dd0:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801dd7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801ddb:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801ddf:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801de3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801de7:	48 29 da             	sub    %rbx,%rdx
+  801dea:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801def:	48 39 c2             	cmp    %rax,%rdx
+  801df2:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801df6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801dfa:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801dfe:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801e01:	01 d8                	add    %ebx,%eax
+  801e03:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801e07:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801e0b:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801e12:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801e19:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801e20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e2b:	4c 89 ee             	mov    %r13,%rsi
+  801e2e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e33:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  801e3a:	00 00 00 
+  801e3d:	ff d0                	call   *%rax
+        if (res < 0)
+  801e3f:	85 c0                	test   %eax,%eax
+  801e41:	78 4d                	js     801e90 <devfile_read+0x14b>
+        if (res == 0)
+  801e43:	74 4f                	je     801e94 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e45:	4c 63 e0             	movslq %eax,%r12
+  801e48:	4c 89 e2             	mov    %r12,%rdx
+  801e4b:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e4f:	4c 89 f7             	mov    %r14,%rdi
+  801e52:	48 b8 01 3e 80 00 00 	movabs $0x803e01,%rax
+  801e59:	00 00 00 
+  801e5c:	ff d0                	call   *%rax
+        i += res;
+  801e5e:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801e61:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801e64:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e68:	48 39 c3             	cmp    %rax,%rbx
+  801e6b:	0f 82 72 ff ff ff    	jb     801de3 <devfile_read+0x9e>
+    return i;
+  801e71:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801e74:	48 85 c0             	test   %rax,%rax
+  801e77:	7e 04                	jle    801e7d <devfile_read+0x138>
+  801e79:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801e7d:	48 83 c4 28          	add    $0x28,%rsp
+  801e81:	5b                   	pop    %rbx
+  801e82:	41 5c                	pop    %r12
+  801e84:	41 5d                	pop    %r13
+  801e86:	41 5e                	pop    %r14
+  801e88:	41 5f                	pop    %r15
+  801e8a:	5d                   	pop    %rbp
+  801e8b:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801e8c:	48 98                	cltq
+  801e8e:	eb ed                	jmp    801e7d <devfile_read+0x138>
+            return res;
+  801e90:	48 98                	cltq
+  801e92:	eb e9                	jmp    801e7d <devfile_read+0x138>
+            return i;
+  801e94:	48 89 d8             	mov    %rbx,%rax
+  801e97:	eb db                	jmp    801e74 <devfile_read+0x12f>
+    size_t i = 0;
+  801e99:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801e9d:	eb d2                	jmp    801e71 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801e9f:	48 89 c6             	mov    %rax,%rsi
+  801ea2:	4c 89 ff             	mov    %r15,%rdi
+  801ea5:	48 b8 b7 17 80 00 00 	movabs $0x8017b7,%rax
+  801eac:	00 00 00 
+  801eaf:	ff d0                	call   *%rax
+  801eb1:	85 c0                	test   %eax,%eax
+  801eb3:	78 40                	js     801ef5 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801eb5:	4c 89 ff             	mov    %r15,%rdi
+  801eb8:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+  801ec4:	48 89 c2             	mov    %rax,%rdx
+  801ec7:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ecb:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801ecf:	48 c1 e0 0c          	shl    $0xc,%rax
+  801ed3:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801ed8:	48 01 d0             	add    %rdx,%rax
+  801edb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801edf:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ee4:	0f 84 33 01 00 00    	je     80201d <devfile_read+0x2d8>
+    size_t i = 0;
+  801eea:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801ef0:	e9 f5 00 00 00       	jmp    801fea <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801ef5:	48 98                	cltq
+  801ef7:	eb 84                	jmp    801e7d <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801ef9:	44 89 e8             	mov    %r13d,%eax
+  801efc:	66 b8 00 00          	mov    $0x0,%ax
+  801f00:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801f05:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801f0c:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801f0e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801f12:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801f16:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801f18:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801f1d:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801f20:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801f27:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801f28:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f33:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f38:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f3d:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  801f44:	00 00 00 
+  801f47:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f49:	85 c0                	test   %eax,%eax
+  801f4b:	0f 88 be 00 00 00    	js     80200f <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f51:	48 63 d0             	movslq %eax,%rdx
+  801f54:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801f59:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801f5e:	44 39 e8             	cmp    %r13d,%eax
+  801f61:	0f 8e ba 00 00 00    	jle    802021 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801f67:	49 63 c5             	movslq %r13d,%rax
+  801f6a:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801f6f:	48 29 c3             	sub    %rax,%rbx
+  801f72:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801f77:	48 01 c3             	add    %rax,%rbx
+  801f7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f7e:	4c 29 f0             	sub    %r14,%rax
+  801f81:	48 39 c3             	cmp    %rax,%rbx
+  801f84:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801f88:	4c 89 ff             	mov    %r15,%rdi
+  801f8b:	48 b9 bb 0c 80 00 00 	movabs $0x800cbb,%rcx
+  801f92:	00 00 00 
+  801f95:	ff d1                	call   *%rcx
+  801f97:	48 89 c2             	mov    %rax,%rdx
+  801f9a:	48 c1 e2 04          	shl    $0x4,%rdx
+  801f9e:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801fa2:	48 c1 e0 0c          	shl    $0xc,%rax
+  801fa6:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801fab:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801fae:	44 89 ea             	mov    %r13d,%edx
+  801fb1:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  801fb6:	48 63 d2             	movslq %edx,%rdx
+  801fb9:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801fc0:	00 
+  801fc1:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801fc5:	4c 01 f7             	add    %r14,%rdi
+  801fc8:	48 89 da             	mov    %rbx,%rdx
+  801fcb:	48 b9 01 3e 80 00 00 	movabs $0x803e01,%rcx
+  801fd2:	00 00 00 
+  801fd5:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  801fd7:	41 01 dd             	add    %ebx,%r13d
+  801fda:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  801fde:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  801fe1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fe5:	49 39 c6             	cmp    %rax,%r14
+  801fe8:	73 37                	jae    802021 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  801fea:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  801fee:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801ff3:	44 39 e8             	cmp    %r13d,%eax
+  801ff6:	0f 8f fd fe ff ff    	jg     801ef9 <devfile_read+0x1b4>
+  801ffc:	41 03 44 24 10       	add    0x10(%r12),%eax
+  802001:	44 39 e8             	cmp    %r13d,%eax
+  802004:	0f 8f 5d ff ff ff    	jg     801f67 <devfile_read+0x222>
+  80200a:	e9 ea fe ff ff       	jmp    801ef9 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80200f:	48 98                	cltq
+  802011:	4d 85 f6             	test   %r14,%r14
+  802014:	49 0f 45 c6          	cmovne %r14,%rax
+  802018:	e9 60 fe ff ff       	jmp    801e7d <devfile_read+0x138>
+    size_t i = 0;
+  80201d:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  802021:	4c 89 f0             	mov    %r14,%rax
+  802024:	e9 54 fe ff ff       	jmp    801e7d <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  802029:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802030:	e9 48 fe ff ff       	jmp    801e7d <devfile_read+0x138>
+
+0000000000802035 <open>:
+open(const char *path, int mode) {
+  802035:	55                   	push   %rbp
+  802036:	48 89 e5             	mov    %rsp,%rbp
+  802039:	41 55                	push   %r13
+  80203b:	41 54                	push   %r12
+  80203d:	53                   	push   %rbx
+  80203e:	48 83 ec 18          	sub    $0x18,%rsp
+  802042:	49 89 fc             	mov    %rdi,%r12
+  802045:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802048:	48 b8 ce 39 80 00 00 	movabs $0x8039ce,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+  802054:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80205a:	0f 87 8a 00 00 00    	ja     8020ea <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802060:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802064:	48 b8 e9 0c 80 00 00 	movabs $0x800ce9,%rax
+  80206b:	00 00 00 
+  80206e:	ff d0                	call   *%rax
+  802070:	89 c3                	mov    %eax,%ebx
+  802072:	85 c0                	test   %eax,%eax
+  802074:	78 50                	js     8020c6 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802076:	4c 89 e6             	mov    %r12,%rsi
+  802079:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802080:	00 00 00 
+  802083:	48 89 df             	mov    %rbx,%rdi
+  802086:	48 b8 0c 3a 80 00 00 	movabs $0x803a0c,%rax
+  80208d:	00 00 00 
+  802090:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802092:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802099:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80209d:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020a2:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  8020a9:	00 00 00 
+  8020ac:	ff d0                	call   *%rax
+  8020ae:	89 c3                	mov    %eax,%ebx
+  8020b0:	85 c0                	test   %eax,%eax
+  8020b2:	78 1f                	js     8020d3 <open+0x9e>
+    return fd2num(fd);
+  8020b4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020b8:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  8020bf:	00 00 00 
+  8020c2:	ff d0                	call   *%rax
+  8020c4:	89 c3                	mov    %eax,%ebx
+}
+  8020c6:	89 d8                	mov    %ebx,%eax
+  8020c8:	48 83 c4 18          	add    $0x18,%rsp
+  8020cc:	5b                   	pop    %rbx
+  8020cd:	41 5c                	pop    %r12
+  8020cf:	41 5d                	pop    %r13
+  8020d1:	5d                   	pop    %rbp
+  8020d2:	c3                   	ret
+        fd_close(fd, 0);
+  8020d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020dc:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  8020e3:	00 00 00 
+  8020e6:	ff d0                	call   *%rax
+        return res;
+  8020e8:	eb dc                	jmp    8020c6 <open+0x91>
+        return -E_BAD_PATH;
+  8020ea:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020ef:	eb d5                	jmp    8020c6 <open+0x91>
+
+00000000008020f1 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8020f1:	55                   	push   %rbp
+  8020f2:	48 89 e5             	mov    %rsp,%rbp
+  8020f5:	41 57                	push   %r15
+  8020f7:	41 56                	push   %r14
+  8020f9:	41 55                	push   %r13
+  8020fb:	41 54                	push   %r12
+  8020fd:	53                   	push   %rbx
+  8020fe:	48 83 ec 18          	sub    $0x18,%rsp
+  802102:	41 89 f6             	mov    %esi,%r14d
+  802105:	49 89 d7             	mov    %rdx,%r15
+  802108:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80210b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80210f:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  802116:	00 00 00 
+  802119:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80211b:	85 c0                	test   %eax,%eax
+  80211d:	0f 88 db 00 00 00    	js     8021fe <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802123:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802127:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80212e:	00 00 00 
+  802131:	8b 00                	mov    (%rax),%eax
+  802133:	39 07                	cmp    %eax,(%rdi)
+  802135:	0f 85 db 00 00 00    	jne    802216 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80213b:	45 85 f6             	test   %r14d,%r14d
+  80213e:	0f 88 db 00 00 00    	js     80221f <fmap+0x12e>
+  802144:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80214b:	0f 85 d7 00 00 00    	jne    802228 <fmap+0x137>
+  802151:	4c 89 fb             	mov    %r15,%rbx
+  802154:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80215a:	0f 85 d1 00 00 00    	jne    802231 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802160:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  802167:	00 00 00 
+  80216a:	ff d0                	call   *%rax
+  80216c:	85 c0                	test   %eax,%eax
+  80216e:	0f 88 8e 00 00 00    	js     802202 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802174:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80217b:	00 00 00 
+    while (i < n) {
+  80217e:	4d 85 ed             	test   %r13,%r13
+  802181:	0f 84 8a 00 00 00    	je     802211 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  802187:	4c 89 ea             	mov    %r13,%rdx
+  80218a:	48 29 da             	sub    %rbx,%rdx
+  80218d:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  802194:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80219a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80219e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021a2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021a5:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8021a9:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8021ad:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8021b2:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8021b7:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8021bb:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8021bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021c4:	4c 89 e6             	mov    %r12,%rsi
+  8021c7:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021cc:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  8021d3:	00 00 00 
+  8021d6:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	78 2a                	js     802206 <fmap+0x115>
+        i += res;
+  8021dc:	48 98                	cltq
+  8021de:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8021e1:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8021e5:	72 05                	jb     8021ec <fmap+0xfb>
+    while (i < n) {
+  8021e7:	4c 39 eb             	cmp    %r13,%rbx
+  8021ea:	72 9b                	jb     802187 <fmap+0x96>
+    }
+    return i;
+  8021ec:	48 89 d8             	mov    %rbx,%rax
+}
+  8021ef:	48 83 c4 18          	add    $0x18,%rsp
+  8021f3:	5b                   	pop    %rbx
+  8021f4:	41 5c                	pop    %r12
+  8021f6:	41 5d                	pop    %r13
+  8021f8:	41 5e                	pop    %r14
+  8021fa:	41 5f                	pop    %r15
+  8021fc:	5d                   	pop    %rbp
+  8021fd:	c3                   	ret
+    if (res < 0) return res;
+  8021fe:	48 98                	cltq
+  802200:	eb ed                	jmp    8021ef <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802202:	48 98                	cltq
+  802204:	eb e9                	jmp    8021ef <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  802206:	48 98                	cltq
+  802208:	48 85 db             	test   %rbx,%rbx
+  80220b:	48 0f 45 c3          	cmovne %rbx,%rax
+  80220f:	eb de                	jmp    8021ef <fmap+0xfe>
+    size_t i = 0;
+  802211:	4c 89 eb             	mov    %r13,%rbx
+  802214:	eb d6                	jmp    8021ec <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802216:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80221d:	eb d0                	jmp    8021ef <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80221f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802226:	eb c7                	jmp    8021ef <fmap+0xfe>
+  802228:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80222f:	eb be                	jmp    8021ef <fmap+0xfe>
+  802231:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802238:	eb b5                	jmp    8021ef <fmap+0xfe>
+
+000000000080223a <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80223a:	55                   	push   %rbp
+  80223b:	48 89 e5             	mov    %rsp,%rbp
+  80223e:	41 56                	push   %r14
+  802240:	41 55                	push   %r13
+  802242:	41 54                	push   %r12
+  802244:	53                   	push   %rbx
+  802245:	48 83 ec 10          	sub    $0x10,%rsp
+  802249:	89 fb                	mov    %edi,%ebx
+  80224b:	41 89 f4             	mov    %esi,%r12d
+  80224e:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802251:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802255:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802261:	85 c0                	test   %eax,%eax
+  802263:	78 63                	js     8022c8 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  802265:	45 85 e4             	test   %r12d,%r12d
+  802268:	0f 88 80 00 00 00    	js     8022ee <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80226e:	45 89 e6             	mov    %r12d,%r14d
+  802271:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  802278:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80227c:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  802283:	00 00 00 
+  802286:	ff d0                	call   *%rax
+  802288:	48 89 c2             	mov    %rax,%rdx
+  80228b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802290:	44 89 f6             	mov    %r14d,%esi
+  802293:	89 df                	mov    %ebx,%edi
+  802295:	48 b8 f1 20 80 00 00 	movabs $0x8020f1,%rax
+  80229c:	00 00 00 
+  80229f:	ff d0                	call   *%rax
+  8022a1:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8022a4:	45 29 f4             	sub    %r14d,%r12d
+  8022a7:	4d 63 f4             	movslq %r12d,%r14
+  8022aa:	49 39 c6             	cmp    %rax,%r14
+  8022ad:	7c 1d                	jl     8022cc <read_map+0x92>
+  8022af:	48 85 c0             	test   %rax,%rax
+  8022b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b7:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8022bb:	48 83 c4 10          	add    $0x10,%rsp
+  8022bf:	5b                   	pop    %rbx
+  8022c0:	41 5c                	pop    %r12
+  8022c2:	41 5d                	pop    %r13
+  8022c4:	41 5e                	pop    %r14
+  8022c6:	5d                   	pop    %rbp
+  8022c7:	c3                   	ret
+    if (res < 0) return res;
+  8022c8:	48 98                	cltq
+  8022ca:	eb ef                	jmp    8022bb <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8022cc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022d0:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  8022d7:	00 00 00 
+  8022da:	ff d0                	call   *%rax
+  8022dc:	4d 63 e4             	movslq %r12d,%r12
+  8022df:	4c 01 e0             	add    %r12,%rax
+  8022e2:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8022e6:	48 89 d8             	mov    %rbx,%rax
+  8022e9:	4c 29 f0             	sub    %r14,%rax
+  8022ec:	eb cd                	jmp    8022bb <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8022ee:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022f5:	eb c4                	jmp    8022bb <read_map+0x81>
+
+00000000008022f7 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8022f7:	55                   	push   %rbp
+  8022f8:	48 89 e5             	mov    %rsp,%rbp
+  8022fb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022ff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802303:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  80230a:	00 00 00 
+  80230d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80230f:	85 c0                	test   %eax,%eax
+  802311:	78 4a                	js     80235d <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802313:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802317:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80231e:	00 00 00 
+  802321:	8b 00                	mov    (%rax),%eax
+  802323:	39 07                	cmp    %eax,(%rdi)
+  802325:	75 38                	jne    80235f <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802327:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  80232e:	00 00 00 
+  802331:	ff d0                	call   *%rax
+  802333:	85 c0                	test   %eax,%eax
+  802335:	78 26                	js     80235d <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802337:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80233b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80233e:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802345:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802347:	be 00 00 00 00       	mov    $0x0,%esi
+  80234c:	bf 06 00 00 00       	mov    $0x6,%edi
+  802351:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  802358:	00 00 00 
+  80235b:	ff d0                	call   *%rax
+}
+  80235d:	c9                   	leave
+  80235e:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80235f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802364:	eb f7                	jmp    80235d <fsync+0x66>
+
+0000000000802366 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  802366:	55                   	push   %rbp
+  802367:	48 89 e5             	mov    %rsp,%rbp
+  80236a:	41 57                	push   %r15
+  80236c:	41 56                	push   %r14
+  80236e:	41 55                	push   %r13
+  802370:	41 54                	push   %r12
+  802372:	53                   	push   %rbx
+  802373:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  802377:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80237e:	00 00 00 
+  802381:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  802386:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80238c:	49 bd 49 0d 80 00 00 	movabs $0x800d49,%r13
+  802393:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  802396:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  80239d:	00 00 00 
+  8023a0:	eb 0c                	jmp    8023ae <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8023a2:	83 c3 01             	add    $0x1,%ebx
+  8023a5:	49 83 c4 28          	add    $0x28,%r12
+  8023a9:	83 fb 20             	cmp    $0x20,%ebx
+  8023ac:	74 33                	je     8023e1 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023ae:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8023b3:	74 ed                	je     8023a2 <flushall+0x3c>
+  8023b5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8023b9:	89 df                	mov    %ebx,%edi
+  8023bb:	41 ff d5             	call   *%r13
+  8023be:	85 c0                	test   %eax,%eax
+  8023c0:	78 e0                	js     8023a2 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8023c2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8023c6:	41 8b 06             	mov    (%r14),%eax
+  8023c9:	39 07                	cmp    %eax,(%rdi)
+  8023cb:	75 d5                	jne    8023a2 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8023cd:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  8023d4:	00 00 00 
+  8023d7:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8023d9:	85 c0                	test   %eax,%eax
+  8023db:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8023df:	eb c1                	jmp    8023a2 <flushall+0x3c>
+    }
+    return res;
+}
+  8023e1:	44 89 f8             	mov    %r15d,%eax
+  8023e4:	48 83 c4 18          	add    $0x18,%rsp
+  8023e8:	5b                   	pop    %rbx
+  8023e9:	41 5c                	pop    %r12
+  8023eb:	41 5d                	pop    %r13
+  8023ed:	41 5e                	pop    %r14
+  8023ef:	41 5f                	pop    %r15
+  8023f1:	5d                   	pop    %rbp
+  8023f2:	c3                   	ret
+
+00000000008023f3 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8023f3:	55                   	push   %rbp
+  8023f4:	48 89 e5             	mov    %rsp,%rbp
+  8023f7:	53                   	push   %rbx
+  8023f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8023fc:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8023ff:	40 0f b6 c6          	movzbl %sil,%eax
+  802403:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80240a:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  80240c:	be 00 00 00 00       	mov    $0x0,%esi
+  802411:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802416:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  80241d:	00 00 00 
+  802420:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802422:	85 c0                	test   %eax,%eax
+  802424:	78 23                	js     802449 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  802426:	ba 58 06 00 00       	mov    $0x658,%edx
+  80242b:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802432:	00 00 00 
+  802435:	48 89 df             	mov    %rbx,%rdi
+  802438:	48 b8 01 3e 80 00 00 	movabs $0x803e01,%rax
+  80243f:	00 00 00 
+  802442:	ff d0                	call   *%rax
+    return 0;
+  802444:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802449:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80244d:	c9                   	leave
+  80244e:	c3                   	ret
+
+000000000080244f <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80244f:	55                   	push   %rbp
+  802450:	48 89 e5             	mov    %rsp,%rbp
+  802453:	53                   	push   %rbx
+  802454:	48 83 ec 08          	sub    $0x8,%rsp
+  802458:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  80245b:	48 b8 ce 39 80 00 00 	movabs $0x8039ce,%rax
+  802462:	00 00 00 
+  802465:	ff d0                	call   *%rax
+  802467:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80246d:	77 35                	ja     8024a4 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80246f:	48 89 de             	mov    %rbx,%rsi
+  802472:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  802479:	00 00 00 
+  80247c:	48 b8 0c 3a 80 00 00 	movabs $0x803a0c,%rax
+  802483:	00 00 00 
+  802486:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  802488:	be 00 00 00 00       	mov    $0x0,%esi
+  80248d:	bf 07 00 00 00       	mov    $0x7,%edi
+  802492:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+}
+  80249e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024a2:	c9                   	leave
+  8024a3:	c3                   	ret
+        return -E_BAD_PATH;
+  8024a4:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8024a9:	eb f3                	jmp    80249e <remove+0x4f>
+
+00000000008024ab <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024ab:	55                   	push   %rbp
+  8024ac:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8024af:	48 b8 66 23 80 00 00 	movabs $0x802366,%rax
+  8024b6:	00 00 00 
+  8024b9:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c0:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024c5:	48 b8 bb 18 80 00 00 	movabs $0x8018bb,%rax
+  8024cc:	00 00 00 
+  8024cf:	ff d0                	call   *%rax
+}
+  8024d1:	5d                   	pop    %rbp
+  8024d2:	c3                   	ret
+
+00000000008024d3 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024d3:	55                   	push   %rbp
+  8024d4:	48 89 e5             	mov    %rsp,%rbp
+  8024d7:	41 54                	push   %r12
+  8024d9:	53                   	push   %rbx
+  8024da:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024dd:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  8024e4:	00 00 00 
+  8024e7:	ff d0                	call   *%rax
+  8024e9:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024ec:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  8024f3:	00 00 00 
+  8024f6:	48 89 df             	mov    %rbx,%rdi
+  8024f9:	48 b8 0c 3a 80 00 00 	movabs $0x803a0c,%rax
+  802500:	00 00 00 
+  802503:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802505:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80250a:	41 2b 04 24          	sub    (%r12),%eax
+  80250e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802514:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80251b:	00 00 00 
+    stat->st_dev = &devpipe;
+  80251e:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  802525:	00 00 00 
+  802528:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80252f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802534:	5b                   	pop    %rbx
+  802535:	41 5c                	pop    %r12
+  802537:	5d                   	pop    %rbp
+  802538:	c3                   	ret
+
+0000000000802539 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802539:	55                   	push   %rbp
+  80253a:	48 89 e5             	mov    %rsp,%rbp
+  80253d:	41 54                	push   %r12
+  80253f:	53                   	push   %rbx
+  802540:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802543:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802548:	48 89 fe             	mov    %rdi,%rsi
+  80254b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802550:	49 bc 84 04 80 00 00 	movabs $0x800484,%r12
+  802557:	00 00 00 
+  80255a:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80255d:	48 89 df             	mov    %rbx,%rdi
+  802560:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  802567:	00 00 00 
+  80256a:	ff d0                	call   *%rax
+  80256c:	48 89 c6             	mov    %rax,%rsi
+  80256f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802574:	bf 00 00 00 00       	mov    $0x0,%edi
+  802579:	41 ff d4             	call   *%r12
+}
+  80257c:	5b                   	pop    %rbx
+  80257d:	41 5c                	pop    %r12
+  80257f:	5d                   	pop    %rbp
+  802580:	c3                   	ret
+
+0000000000802581 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802581:	55                   	push   %rbp
+  802582:	48 89 e5             	mov    %rsp,%rbp
+  802585:	41 57                	push   %r15
+  802587:	41 56                	push   %r14
+  802589:	41 55                	push   %r13
+  80258b:	41 54                	push   %r12
+  80258d:	53                   	push   %rbx
+  80258e:	48 83 ec 18          	sub    $0x18,%rsp
+  802592:	49 89 fc             	mov    %rdi,%r12
+  802595:	49 89 f5             	mov    %rsi,%r13
+  802598:	49 89 d7             	mov    %rdx,%r15
+  80259b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80259f:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  8025a6:	00 00 00 
+  8025a9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025ab:	4d 85 ff             	test   %r15,%r15
+  8025ae:	0f 84 af 00 00 00    	je     802663 <devpipe_write+0xe2>
+  8025b4:	48 89 c3             	mov    %rax,%rbx
+  8025b7:	4c 89 f8             	mov    %r15,%rax
+  8025ba:	4d 89 ef             	mov    %r13,%r15
+  8025bd:	4c 01 e8             	add    %r13,%rax
+  8025c0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025c4:	49 bd 79 02 80 00 00 	movabs $0x800279,%r13
+  8025cb:	00 00 00 
+            sys_yield();
+  8025ce:	49 be 16 02 80 00 00 	movabs $0x800216,%r14
+  8025d5:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025d8:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025db:	48 63 ce             	movslq %esi,%rcx
+  8025de:	48 63 03             	movslq (%rbx),%rax
+  8025e1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025e7:	48 39 c1             	cmp    %rax,%rcx
+  8025ea:	72 2e                	jb     80261a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025ec:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025f1:	48 89 da             	mov    %rbx,%rdx
+  8025f4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025f9:	4c 89 e7             	mov    %r12,%rdi
+  8025fc:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025ff:	85 c0                	test   %eax,%eax
+  802601:	74 66                	je     802669 <devpipe_write+0xe8>
+            sys_yield();
+  802603:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802606:	8b 73 04             	mov    0x4(%rbx),%esi
+  802609:	48 63 ce             	movslq %esi,%rcx
+  80260c:	48 63 03             	movslq (%rbx),%rax
+  80260f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802615:	48 39 c1             	cmp    %rax,%rcx
+  802618:	73 d2                	jae    8025ec <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80261a:	41 0f b6 3f          	movzbl (%r15),%edi
+  80261e:	48 89 ca             	mov    %rcx,%rdx
+  802621:	48 c1 ea 03          	shr    $0x3,%rdx
+  802625:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80262c:	08 10 20 
+  80262f:	48 f7 e2             	mul    %rdx
+  802632:	48 c1 ea 06          	shr    $0x6,%rdx
+  802636:	48 89 d0             	mov    %rdx,%rax
+  802639:	48 c1 e0 09          	shl    $0x9,%rax
+  80263d:	48 29 d0             	sub    %rdx,%rax
+  802640:	48 c1 e0 03          	shl    $0x3,%rax
+  802644:	48 29 c1             	sub    %rax,%rcx
+  802647:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80264c:	83 c6 01             	add    $0x1,%esi
+  80264f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802652:	49 83 c7 01          	add    $0x1,%r15
+  802656:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80265a:	49 39 c7             	cmp    %rax,%r15
+  80265d:	0f 85 75 ff ff ff    	jne    8025d8 <devpipe_write+0x57>
+    return n;
+  802663:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802667:	eb 05                	jmp    80266e <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802669:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80266e:	48 83 c4 18          	add    $0x18,%rsp
+  802672:	5b                   	pop    %rbx
+  802673:	41 5c                	pop    %r12
+  802675:	41 5d                	pop    %r13
+  802677:	41 5e                	pop    %r14
+  802679:	41 5f                	pop    %r15
+  80267b:	5d                   	pop    %rbp
+  80267c:	c3                   	ret
+
+000000000080267d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80267d:	55                   	push   %rbp
+  80267e:	48 89 e5             	mov    %rsp,%rbp
+  802681:	41 57                	push   %r15
+  802683:	41 56                	push   %r14
+  802685:	41 55                	push   %r13
+  802687:	41 54                	push   %r12
+  802689:	53                   	push   %rbx
+  80268a:	48 83 ec 18          	sub    $0x18,%rsp
+  80268e:	49 89 fc             	mov    %rdi,%r12
+  802691:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802695:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802699:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  8026a0:	00 00 00 
+  8026a3:	ff d0                	call   *%rax
+  8026a5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026a8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026ae:	49 bd 79 02 80 00 00 	movabs $0x800279,%r13
+  8026b5:	00 00 00 
+            sys_yield();
+  8026b8:	49 be 16 02 80 00 00 	movabs $0x800216,%r14
+  8026bf:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026c2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026c7:	74 7d                	je     802746 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026c9:	8b 03                	mov    (%rbx),%eax
+  8026cb:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026ce:	75 26                	jne    8026f6 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026d0:	4d 85 ff             	test   %r15,%r15
+  8026d3:	75 77                	jne    80274c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026d5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026da:	48 89 da             	mov    %rbx,%rdx
+  8026dd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026e2:	4c 89 e7             	mov    %r12,%rdi
+  8026e5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026e8:	85 c0                	test   %eax,%eax
+  8026ea:	74 72                	je     80275e <devpipe_read+0xe1>
+            sys_yield();
+  8026ec:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026ef:	8b 03                	mov    (%rbx),%eax
+  8026f1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026f4:	74 df                	je     8026d5 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026f6:	48 63 c8             	movslq %eax,%rcx
+  8026f9:	48 89 ca             	mov    %rcx,%rdx
+  8026fc:	48 c1 ea 03          	shr    $0x3,%rdx
+  802700:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802707:	08 10 20 
+  80270a:	48 89 d0             	mov    %rdx,%rax
+  80270d:	48 f7 e6             	mul    %rsi
+  802710:	48 c1 ea 06          	shr    $0x6,%rdx
+  802714:	48 89 d0             	mov    %rdx,%rax
+  802717:	48 c1 e0 09          	shl    $0x9,%rax
+  80271b:	48 29 d0             	sub    %rdx,%rax
+  80271e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802725:	00 
+  802726:	48 89 c8             	mov    %rcx,%rax
+  802729:	48 29 d0             	sub    %rdx,%rax
+  80272c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802731:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802735:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802739:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80273c:	49 83 c7 01          	add    $0x1,%r15
+  802740:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802744:	75 83                	jne    8026c9 <devpipe_read+0x4c>
+    return n;
+  802746:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80274a:	eb 03                	jmp    80274f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80274c:	4c 89 f8             	mov    %r15,%rax
+}
+  80274f:	48 83 c4 18          	add    $0x18,%rsp
+  802753:	5b                   	pop    %rbx
+  802754:	41 5c                	pop    %r12
+  802756:	41 5d                	pop    %r13
+  802758:	41 5e                	pop    %r14
+  80275a:	41 5f                	pop    %r15
+  80275c:	5d                   	pop    %rbp
+  80275d:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80275e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802763:	eb ea                	jmp    80274f <devpipe_read+0xd2>
+
+0000000000802765 <pipe>:
+pipe(int pfd[2]) {
+  802765:	55                   	push   %rbp
+  802766:	48 89 e5             	mov    %rsp,%rbp
+  802769:	41 55                	push   %r13
+  80276b:	41 54                	push   %r12
+  80276d:	53                   	push   %rbx
+  80276e:	48 83 ec 18          	sub    $0x18,%rsp
+  802772:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802775:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802779:	48 b8 e9 0c 80 00 00 	movabs $0x800ce9,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+  802785:	89 c3                	mov    %eax,%ebx
+  802787:	85 c0                	test   %eax,%eax
+  802789:	0f 88 a0 01 00 00    	js     80292f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80278f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802794:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802799:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80279d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027a2:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  8027a9:	00 00 00 
+  8027ac:	ff d0                	call   *%rax
+  8027ae:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027b0:	85 c0                	test   %eax,%eax
+  8027b2:	0f 88 77 01 00 00    	js     80292f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027b8:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8027bc:	48 b8 e9 0c 80 00 00 	movabs $0x800ce9,%rax
+  8027c3:	00 00 00 
+  8027c6:	ff d0                	call   *%rax
+  8027c8:	89 c3                	mov    %eax,%ebx
+  8027ca:	85 c0                	test   %eax,%eax
+  8027cc:	0f 88 43 01 00 00    	js     802915 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027d2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027dc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027e5:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  8027ec:	00 00 00 
+  8027ef:	ff d0                	call   *%rax
+  8027f1:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027f3:	85 c0                	test   %eax,%eax
+  8027f5:	0f 88 1a 01 00 00    	js     802915 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027fb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027ff:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  802806:	00 00 00 
+  802809:	ff d0                	call   *%rax
+  80280b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80280e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802813:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802818:	48 89 c6             	mov    %rax,%rsi
+  80281b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802820:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  802827:	00 00 00 
+  80282a:	ff d0                	call   *%rax
+  80282c:	89 c3                	mov    %eax,%ebx
+  80282e:	85 c0                	test   %eax,%eax
+  802830:	0f 88 c5 00 00 00    	js     8028fb <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802836:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80283a:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  802841:	00 00 00 
+  802844:	ff d0                	call   *%rax
+  802846:	48 89 c1             	mov    %rax,%rcx
+  802849:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80284f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802855:	ba 00 00 00 00       	mov    $0x0,%edx
+  80285a:	4c 89 ee             	mov    %r13,%rsi
+  80285d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802862:	48 b8 0c 03 80 00 00 	movabs $0x80030c,%rax
+  802869:	00 00 00 
+  80286c:	ff d0                	call   *%rax
+  80286e:	89 c3                	mov    %eax,%ebx
+  802870:	85 c0                	test   %eax,%eax
+  802872:	78 6e                	js     8028e2 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802874:	be 00 10 00 00       	mov    $0x1000,%esi
+  802879:	4c 89 ef             	mov    %r13,%rdi
+  80287c:	48 b8 47 02 80 00 00 	movabs $0x800247,%rax
+  802883:	00 00 00 
+  802886:	ff d0                	call   *%rax
+  802888:	83 f8 02             	cmp    $0x2,%eax
+  80288b:	0f 85 ab 00 00 00    	jne    80293c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802891:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  802898:	00 00 
+  80289a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80289e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028a0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028a4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028ab:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028af:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028b5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028bc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028c0:	48 bb bb 0c 80 00 00 	movabs $0x800cbb,%rbx
+  8028c7:	00 00 00 
+  8028ca:	ff d3                	call   *%rbx
+  8028cc:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028d0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028d4:	ff d3                	call   *%rbx
+  8028d6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028e0:	eb 4d                	jmp    80292f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8028e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028e7:	4c 89 ee             	mov    %r13,%rsi
+  8028ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ef:	48 b8 84 04 80 00 00 	movabs $0x800484,%rax
+  8028f6:	00 00 00 
+  8028f9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802900:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802904:	bf 00 00 00 00       	mov    $0x0,%edi
+  802909:	48 b8 84 04 80 00 00 	movabs $0x800484,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802915:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80291a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80291e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802923:	48 b8 84 04 80 00 00 	movabs $0x800484,%rax
+  80292a:	00 00 00 
+  80292d:	ff d0                	call   *%rax
+}
+  80292f:	89 d8                	mov    %ebx,%eax
+  802931:	48 83 c4 18          	add    $0x18,%rsp
+  802935:	5b                   	pop    %rbx
+  802936:	41 5c                	pop    %r12
+  802938:	41 5d                	pop    %r13
+  80293a:	5d                   	pop    %rbp
+  80293b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80293c:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  802943:	00 00 00 
+  802946:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  80294d:	00 00 00 
+  802950:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802955:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  80295c:	00 00 00 
+  80295f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802964:	49 b8 44 2f 80 00 00 	movabs $0x802f44,%r8
+  80296b:	00 00 00 
+  80296e:	41 ff d0             	call   *%r8
+
+0000000000802971 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802971:	55                   	push   %rbp
+  802972:	48 89 e5             	mov    %rsp,%rbp
+  802975:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802979:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80297d:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  802984:	00 00 00 
+  802987:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802989:	85 c0                	test   %eax,%eax
+  80298b:	78 35                	js     8029c2 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80298d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802991:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  802998:	00 00 00 
+  80299b:	ff d0                	call   *%rax
+  80299d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029a0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029a5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029aa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029ae:	48 b8 79 02 80 00 00 	movabs $0x800279,%rax
+  8029b5:	00 00 00 
+  8029b8:	ff d0                	call   *%rax
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	0f 94 c0             	sete   %al
+  8029bf:	0f b6 c0             	movzbl %al,%eax
+}
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+
+00000000008029c4 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029c4:	48 89 f8             	mov    %rdi,%rax
+  8029c7:	48 c1 e8 27          	shr    $0x27,%rax
+  8029cb:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8029d2:	7f 00 00 
+  8029d5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029d9:	f6 c2 01             	test   $0x1,%dl
+  8029dc:	74 6d                	je     802a4b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029de:	48 89 f8             	mov    %rdi,%rax
+  8029e1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029e5:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029ec:	7f 00 00 
+  8029ef:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029f3:	f6 c2 01             	test   $0x1,%dl
+  8029f6:	74 62                	je     802a5a <get_uvpt_entry+0x96>
+  8029f8:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029ff:	7f 00 00 
+  802a02:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a06:	f6 c2 80             	test   $0x80,%dl
+  802a09:	75 4f                	jne    802a5a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a0b:	48 89 f8             	mov    %rdi,%rax
+  802a0e:	48 c1 e8 15          	shr    $0x15,%rax
+  802a12:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a19:	7f 00 00 
+  802a1c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a20:	f6 c2 01             	test   $0x1,%dl
+  802a23:	74 44                	je     802a69 <get_uvpt_entry+0xa5>
+  802a25:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a2c:	7f 00 00 
+  802a2f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a33:	f6 c2 80             	test   $0x80,%dl
+  802a36:	75 31                	jne    802a69 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a38:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a3c:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a43:	7f 00 00 
+  802a46:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a4a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a4b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a52:	7f 00 00 
+  802a55:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a59:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a5a:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a61:	7f 00 00 
+  802a64:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a68:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a69:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a70:	7f 00 00 
+  802a73:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a77:	c3                   	ret
+
+0000000000802a78 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802a78:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a7b:	48 89 f9             	mov    %rdi,%rcx
+  802a7e:	48 c1 e9 27          	shr    $0x27,%rcx
+  802a82:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802a89:	7f 00 00 
+  802a8c:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802a90:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a97:	f6 c1 01             	test   $0x1,%cl
+  802a9a:	0f 84 b2 00 00 00    	je     802b52 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802aa0:	48 89 f9             	mov    %rdi,%rcx
+  802aa3:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802aa7:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802aae:	7f 00 00 
+  802ab1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802ab5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802abc:	40 f6 c6 01          	test   $0x1,%sil
+  802ac0:	0f 84 8c 00 00 00    	je     802b52 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802ac6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802acd:	7f 00 00 
+  802ad0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802ad4:	a8 80                	test   $0x80,%al
+  802ad6:	75 7b                	jne    802b53 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ad8:	48 89 f9             	mov    %rdi,%rcx
+  802adb:	48 c1 e9 15          	shr    $0x15,%rcx
+  802adf:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802ae6:	7f 00 00 
+  802ae9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802aed:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802af4:	40 f6 c6 01          	test   $0x1,%sil
+  802af8:	74 58                	je     802b52 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802afa:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b01:	7f 00 00 
+  802b04:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b08:	a8 80                	test   $0x80,%al
+  802b0a:	75 6c                	jne    802b78 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b0c:	48 89 f9             	mov    %rdi,%rcx
+  802b0f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802b13:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b1a:	7f 00 00 
+  802b1d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802b21:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b28:	40 f6 c6 01          	test   $0x1,%sil
+  802b2c:	74 24                	je     802b52 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b2e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b35:	7f 00 00 
+  802b38:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b3c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b43:	ff ff 7f 
+  802b46:	48 21 c8             	and    %rcx,%rax
+  802b49:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b4f:	48 09 d0             	or     %rdx,%rax
+}
+  802b52:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b53:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b5a:	7f 00 00 
+  802b5d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b61:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b68:	ff ff 7f 
+  802b6b:	48 21 c8             	and    %rcx,%rax
+  802b6e:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802b74:	48 01 d0             	add    %rdx,%rax
+  802b77:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802b78:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b7f:	7f 00 00 
+  802b82:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b86:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b8d:	ff ff 7f 
+  802b90:	48 21 c8             	and    %rcx,%rax
+  802b93:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802b99:	48 01 d0             	add    %rdx,%rax
+  802b9c:	c3                   	ret
+
+0000000000802b9d <get_prot>:
+
+int
+get_prot(void *va) {
+  802b9d:	55                   	push   %rbp
+  802b9e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ba1:	48 b8 c4 29 80 00 00 	movabs $0x8029c4,%rax
+  802ba8:	00 00 00 
+  802bab:	ff d0                	call   *%rax
+  802bad:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802bb0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802bb5:	89 c1                	mov    %eax,%ecx
+  802bb7:	83 c9 04             	or     $0x4,%ecx
+  802bba:	f6 c2 01             	test   $0x1,%dl
+  802bbd:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802bc0:	89 c1                	mov    %eax,%ecx
+  802bc2:	83 c9 02             	or     $0x2,%ecx
+  802bc5:	f6 c2 02             	test   $0x2,%dl
+  802bc8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802bcb:	89 c1                	mov    %eax,%ecx
+  802bcd:	83 c9 01             	or     $0x1,%ecx
+  802bd0:	48 85 d2             	test   %rdx,%rdx
+  802bd3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bd6:	89 c1                	mov    %eax,%ecx
+  802bd8:	83 c9 40             	or     $0x40,%ecx
+  802bdb:	f6 c6 04             	test   $0x4,%dh
+  802bde:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802be1:	5d                   	pop    %rbp
+  802be2:	c3                   	ret
+
+0000000000802be3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802be3:	55                   	push   %rbp
+  802be4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802be7:	48 b8 c4 29 80 00 00 	movabs $0x8029c4,%rax
+  802bee:	00 00 00 
+  802bf1:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802bf3:	48 c1 e8 06          	shr    $0x6,%rax
+  802bf7:	83 e0 01             	and    $0x1,%eax
+}
+  802bfa:	5d                   	pop    %rbp
+  802bfb:	c3                   	ret
+
+0000000000802bfc <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bfc:	55                   	push   %rbp
+  802bfd:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802c00:	48 b8 c4 29 80 00 00 	movabs $0x8029c4,%rax
+  802c07:	00 00 00 
+  802c0a:	ff d0                	call   *%rax
+  802c0c:	83 e0 01             	and    $0x1,%eax
+}
+  802c0f:	5d                   	pop    %rbp
+  802c10:	c3                   	ret
+
+0000000000802c11 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802c11:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802c18:	7f 00 00 
+  802c1b:	a8 01                	test   $0x1,%al
+  802c1d:	75 06                	jne    802c25 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c24:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c25:	55                   	push   %rbp
+  802c26:	48 89 e5             	mov    %rsp,%rbp
+  802c29:	41 57                	push   %r15
+  802c2b:	41 56                	push   %r14
+  802c2d:	41 55                	push   %r13
+  802c2f:	41 54                	push   %r12
+  802c31:	53                   	push   %rbx
+  802c32:	48 83 ec 18          	sub    $0x18,%rsp
+  802c36:	49 89 fe             	mov    %rdi,%r14
+  802c39:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c3c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c43:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c44:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c4b:	7f 00 00 
+  802c4e:	e9 81 00 00 00       	jmp    802cd4 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c53:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c5a:	49 39 dd             	cmp    %rbx,%r13
+  802c5d:	74 2b                	je     802c8a <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c5f:	48 89 d8             	mov    %rbx,%rax
+  802c62:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c66:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802c6a:	f6 c2 01             	test   $0x1,%dl
+  802c6d:	74 e4                	je     802c53 <foreach_shared_region+0x42>
+  802c6f:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802c73:	f6 c4 04             	test   $0x4,%ah
+  802c76:	74 db                	je     802c53 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802c78:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802c7f:	4c 89 fa             	mov    %r15,%rdx
+  802c82:	48 89 df             	mov    %rbx,%rdi
+  802c85:	41 ff d6             	call   *%r14
+  802c88:	eb c9                	jmp    802c53 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802c8a:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802c91:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802c95:	74 22                	je     802cb9 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802c97:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802c9e:	48 89 d8             	mov    %rbx,%rax
+  802ca1:	48 c1 e8 15          	shr    $0x15,%rax
+  802ca5:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802cac:	7f 00 00 
+  802caf:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802cb3:	a8 01                	test   $0x1,%al
+  802cb5:	74 d3                	je     802c8a <foreach_shared_region+0x79>
+  802cb7:	eb a6                	jmp    802c5f <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802cb9:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802cc0:	40 
+  802cc1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802cc5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ccc:	00 00 00 
+  802ccf:	48 39 c1             	cmp    %rax,%rcx
+  802cd2:	74 31                	je     802d05 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802cd4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cd8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cdc:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802ce3:	7f 00 00 
+  802ce6:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802cea:	a8 01                	test   $0x1,%al
+  802cec:	74 cb                	je     802cb9 <foreach_shared_region+0xa8>
+  802cee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cf2:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cf9:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802cff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802d03:	eb 92                	jmp    802c97 <foreach_shared_region+0x86>
+}
+  802d05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0a:	48 83 c4 18          	add    $0x18,%rsp
+  802d0e:	5b                   	pop    %rbx
+  802d0f:	41 5c                	pop    %r12
+  802d11:	41 5d                	pop    %r13
+  802d13:	41 5e                	pop    %r14
+  802d15:	41 5f                	pop    %r15
+  802d17:	5d                   	pop    %rbp
+  802d18:	c3                   	ret
+
+0000000000802d19 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1e:	c3                   	ret
+
+0000000000802d1f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d1f:	55                   	push   %rbp
+  802d20:	48 89 e5             	mov    %rsp,%rbp
+  802d23:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d26:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d2d:	00 00 00 
+  802d30:	48 b8 0c 3a 80 00 00 	movabs $0x803a0c,%rax
+  802d37:	00 00 00 
+  802d3a:	ff d0                	call   *%rax
+    return 0;
+}
+  802d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d41:	5d                   	pop    %rbp
+  802d42:	c3                   	ret
+
+0000000000802d43 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d43:	55                   	push   %rbp
+  802d44:	48 89 e5             	mov    %rsp,%rbp
+  802d47:	41 57                	push   %r15
+  802d49:	41 56                	push   %r14
+  802d4b:	41 55                	push   %r13
+  802d4d:	41 54                	push   %r12
+  802d4f:	53                   	push   %rbx
+  802d50:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d57:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d5e:	48 85 d2             	test   %rdx,%rdx
+  802d61:	74 7a                	je     802ddd <devcons_write+0x9a>
+  802d63:	49 89 d6             	mov    %rdx,%r14
+  802d66:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d6c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d71:	49 bf 9a 3d 80 00 00 	movabs $0x803d9a,%r15
+  802d78:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d7b:	4c 89 f3             	mov    %r14,%rbx
+  802d7e:	48 29 f3             	sub    %rsi,%rbx
+  802d81:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d86:	48 39 c3             	cmp    %rax,%rbx
+  802d89:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d8d:	4c 63 eb             	movslq %ebx,%r13
+  802d90:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d97:	48 01 c6             	add    %rax,%rsi
+  802d9a:	4c 89 ea             	mov    %r13,%rdx
+  802d9d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802da4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802da7:	4c 89 ee             	mov    %r13,%rsi
+  802daa:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802db1:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  802db8:	00 00 00 
+  802dbb:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802dbd:	41 01 dc             	add    %ebx,%r12d
+  802dc0:	49 63 f4             	movslq %r12d,%rsi
+  802dc3:	4c 39 f6             	cmp    %r14,%rsi
+  802dc6:	72 b3                	jb     802d7b <devcons_write+0x38>
+    return res;
+  802dc8:	49 63 c4             	movslq %r12d,%rax
+}
+  802dcb:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802dd2:	5b                   	pop    %rbx
+  802dd3:	41 5c                	pop    %r12
+  802dd5:	41 5d                	pop    %r13
+  802dd7:	41 5e                	pop    %r14
+  802dd9:	41 5f                	pop    %r15
+  802ddb:	5d                   	pop    %rbp
+  802ddc:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802ddd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802de3:	eb e3                	jmp    802dc8 <devcons_write+0x85>
+
+0000000000802de5 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802de5:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802de8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ded:	48 85 c0             	test   %rax,%rax
+  802df0:	74 55                	je     802e47 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802df2:	55                   	push   %rbp
+  802df3:	48 89 e5             	mov    %rsp,%rbp
+  802df6:	41 55                	push   %r13
+  802df8:	41 54                	push   %r12
+  802dfa:	53                   	push   %rbx
+  802dfb:	48 83 ec 08          	sub    $0x8,%rsp
+  802dff:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802e02:	48 bb 49 01 80 00 00 	movabs $0x800149,%rbx
+  802e09:	00 00 00 
+  802e0c:	49 bc 16 02 80 00 00 	movabs $0x800216,%r12
+  802e13:	00 00 00 
+  802e16:	eb 03                	jmp    802e1b <devcons_read+0x36>
+  802e18:	41 ff d4             	call   *%r12
+  802e1b:	ff d3                	call   *%rbx
+  802e1d:	85 c0                	test   %eax,%eax
+  802e1f:	74 f7                	je     802e18 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e21:	48 63 d0             	movslq %eax,%rdx
+  802e24:	78 13                	js     802e39 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e26:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e2b:	83 f8 04             	cmp    $0x4,%eax
+  802e2e:	74 09                	je     802e39 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e30:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e34:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e39:	48 89 d0             	mov    %rdx,%rax
+  802e3c:	48 83 c4 08          	add    $0x8,%rsp
+  802e40:	5b                   	pop    %rbx
+  802e41:	41 5c                	pop    %r12
+  802e43:	41 5d                	pop    %r13
+  802e45:	5d                   	pop    %rbp
+  802e46:	c3                   	ret
+  802e47:	48 89 d0             	mov    %rdx,%rax
+  802e4a:	c3                   	ret
+
+0000000000802e4b <cputchar>:
+cputchar(int ch) {
+  802e4b:	55                   	push   %rbp
+  802e4c:	48 89 e5             	mov    %rsp,%rbp
+  802e4f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e53:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e57:	be 01 00 00 00       	mov    $0x1,%esi
+  802e5c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e60:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  802e67:	00 00 00 
+  802e6a:	ff d0                	call   *%rax
+}
+  802e6c:	c9                   	leave
+  802e6d:	c3                   	ret
+
+0000000000802e6e <getchar>:
+getchar(void) {
+  802e6e:	55                   	push   %rbp
+  802e6f:	48 89 e5             	mov    %rsp,%rbp
+  802e72:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e76:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e7b:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e84:	48 b8 2c 10 80 00 00 	movabs $0x80102c,%rax
+  802e8b:	00 00 00 
+  802e8e:	ff d0                	call   *%rax
+  802e90:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e92:	85 c0                	test   %eax,%eax
+  802e94:	78 06                	js     802e9c <getchar+0x2e>
+  802e96:	74 08                	je     802ea0 <getchar+0x32>
+  802e98:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e9c:	89 d0                	mov    %edx,%eax
+  802e9e:	c9                   	leave
+  802e9f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802ea0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802ea5:	eb f5                	jmp    802e9c <getchar+0x2e>
+
+0000000000802ea7 <iscons>:
+iscons(int fdnum) {
+  802ea7:	55                   	push   %rbp
+  802ea8:	48 89 e5             	mov    %rsp,%rbp
+  802eab:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802eaf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802eb3:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  802eba:	00 00 00 
+  802ebd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ebf:	85 c0                	test   %eax,%eax
+  802ec1:	78 18                	js     802edb <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ec3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ec7:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802ece:	00 00 00 
+  802ed1:	8b 00                	mov    (%rax),%eax
+  802ed3:	39 02                	cmp    %eax,(%rdx)
+  802ed5:	0f 94 c0             	sete   %al
+  802ed8:	0f b6 c0             	movzbl %al,%eax
+}
+  802edb:	c9                   	leave
+  802edc:	c3                   	ret
+
+0000000000802edd <opencons>:
+opencons(void) {
+  802edd:	55                   	push   %rbp
+  802ede:	48 89 e5             	mov    %rsp,%rbp
+  802ee1:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ee5:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ee9:	48 b8 e9 0c 80 00 00 	movabs $0x800ce9,%rax
+  802ef0:	00 00 00 
+  802ef3:	ff d0                	call   *%rax
+  802ef5:	85 c0                	test   %eax,%eax
+  802ef7:	78 49                	js     802f42 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ef9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802efe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f03:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f07:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f0c:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  802f13:	00 00 00 
+  802f16:	ff d0                	call   *%rax
+  802f18:	85 c0                	test   %eax,%eax
+  802f1a:	78 26                	js     802f42 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f1c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f20:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802f27:	00 00 
+  802f29:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f2b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f2f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f36:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  802f3d:	00 00 00 
+  802f40:	ff d0                	call   *%rax
+}
+  802f42:	c9                   	leave
+  802f43:	c3                   	ret
+
+0000000000802f44 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f44:	55                   	push   %rbp
+  802f45:	48 89 e5             	mov    %rsp,%rbp
+  802f48:	41 56                	push   %r14
+  802f4a:	41 55                	push   %r13
+  802f4c:	41 54                	push   %r12
+  802f4e:	53                   	push   %rbx
+  802f4f:	48 83 ec 50          	sub    $0x50,%rsp
+  802f53:	49 89 fc             	mov    %rdi,%r12
+  802f56:	41 89 f5             	mov    %esi,%r13d
+  802f59:	48 89 d3             	mov    %rdx,%rbx
+  802f5c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802f60:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802f64:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f68:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802f6f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f73:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f77:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802f7b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f7f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802f86:	00 00 00 
+  802f89:	4c 8b 30             	mov    (%rax),%r14
+  802f8c:	48 b8 e5 01 80 00 00 	movabs $0x8001e5,%rax
+  802f93:	00 00 00 
+  802f96:	ff d0                	call   *%rax
+  802f98:	89 c6                	mov    %eax,%esi
+  802f9a:	45 89 e8             	mov    %r13d,%r8d
+  802f9d:	4c 89 e1             	mov    %r12,%rcx
+  802fa0:	4c 89 f2             	mov    %r14,%rdx
+  802fa3:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802faa:	00 00 00 
+  802fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb2:	49 bc 94 30 80 00 00 	movabs $0x803094,%r12
+  802fb9:	00 00 00 
+  802fbc:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802fbf:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802fc3:	48 89 df             	mov    %rbx,%rdi
+  802fc6:	48 b8 30 30 80 00 00 	movabs $0x803030,%rax
+  802fcd:	00 00 00 
+  802fd0:	ff d0                	call   *%rax
+    cprintf("\n");
+  802fd2:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  802fd9:	00 00 00 
+  802fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe1:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802fe4:	cc                   	int3
+  802fe5:	eb fd                	jmp    802fe4 <_panic+0xa0>
+
+0000000000802fe7 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802fe7:	55                   	push   %rbp
+  802fe8:	48 89 e5             	mov    %rsp,%rbp
+  802feb:	53                   	push   %rbx
+  802fec:	48 83 ec 08          	sub    $0x8,%rsp
+  802ff0:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802ff3:	8b 06                	mov    (%rsi),%eax
+  802ff5:	8d 50 01             	lea    0x1(%rax),%edx
+  802ff8:	89 16                	mov    %edx,(%rsi)
+  802ffa:	48 98                	cltq
+  802ffc:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803001:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803007:	74 0a                	je     803013 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803009:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80300d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803011:	c9                   	leave
+  803012:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803013:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803017:	be ff 00 00 00       	mov    $0xff,%esi
+  80301c:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  803023:	00 00 00 
+  803026:	ff d0                	call   *%rax
+        state->offset = 0;
+  803028:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80302e:	eb d9                	jmp    803009 <putch+0x22>
+
+0000000000803030 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803030:	55                   	push   %rbp
+  803031:	48 89 e5             	mov    %rsp,%rbp
+  803034:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80303b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80303e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803045:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80304a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803052:	48 89 f1             	mov    %rsi,%rcx
+  803055:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80305c:	48 bf e7 2f 80 00 00 	movabs $0x802fe7,%rdi
+  803063:	00 00 00 
+  803066:	48 b8 e4 31 80 00 00 	movabs $0x8031e4,%rax
+  80306d:	00 00 00 
+  803070:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803072:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803079:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803080:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  803087:	00 00 00 
+  80308a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80308c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  803092:	c9                   	leave
+  803093:	c3                   	ret
+
+0000000000803094 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803094:	55                   	push   %rbp
+  803095:	48 89 e5             	mov    %rsp,%rbp
+  803098:	48 83 ec 50          	sub    $0x50,%rsp
+  80309c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8030a0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8030a4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8030a8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8030ac:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8030b0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8030b7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030bf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8030c3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8030c7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8030cb:	48 b8 30 30 80 00 00 	movabs $0x803030,%rax
+  8030d2:	00 00 00 
+  8030d5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8030d7:	c9                   	leave
+  8030d8:	c3                   	ret
+
+00000000008030d9 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8030d9:	55                   	push   %rbp
+  8030da:	48 89 e5             	mov    %rsp,%rbp
+  8030dd:	41 57                	push   %r15
+  8030df:	41 56                	push   %r14
+  8030e1:	41 55                	push   %r13
+  8030e3:	41 54                	push   %r12
+  8030e5:	53                   	push   %rbx
+  8030e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8030ea:	49 89 fc             	mov    %rdi,%r12
+  8030ed:	49 89 f5             	mov    %rsi,%r13
+  8030f0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8030f4:	8b 45 10             	mov    0x10(%rbp),%eax
+  8030f7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8030fa:	41 89 cf             	mov    %ecx,%r15d
+  8030fd:	4c 39 fa             	cmp    %r15,%rdx
+  803100:	73 5b                	jae    80315d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803102:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803106:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80310a:	85 db                	test   %ebx,%ebx
+  80310c:	7e 0e                	jle    80311c <print_num+0x43>
+            putch(padc, put_arg);
+  80310e:	4c 89 ee             	mov    %r13,%rsi
+  803111:	44 89 f7             	mov    %r14d,%edi
+  803114:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803117:	83 eb 01             	sub    $0x1,%ebx
+  80311a:	75 f2                	jne    80310e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80311c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803120:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  803127:	00 00 00 
+  80312a:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  803131:	00 00 00 
+  803134:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803138:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80313c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803141:	49 f7 f7             	div    %r15
+  803144:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803148:	4c 89 ee             	mov    %r13,%rsi
+  80314b:	41 ff d4             	call   *%r12
+}
+  80314e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803152:	5b                   	pop    %rbx
+  803153:	41 5c                	pop    %r12
+  803155:	41 5d                	pop    %r13
+  803157:	41 5e                	pop    %r14
+  803159:	41 5f                	pop    %r15
+  80315b:	5d                   	pop    %rbp
+  80315c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80315d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803161:	ba 00 00 00 00       	mov    $0x0,%edx
+  803166:	49 f7 f7             	div    %r15
+  803169:	48 83 ec 08          	sub    $0x8,%rsp
+  80316d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803171:	52                   	push   %rdx
+  803172:	45 0f be c9          	movsbl %r9b,%r9d
+  803176:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80317a:	48 89 c2             	mov    %rax,%rdx
+  80317d:	48 b8 d9 30 80 00 00 	movabs $0x8030d9,%rax
+  803184:	00 00 00 
+  803187:	ff d0                	call   *%rax
+  803189:	48 83 c4 10          	add    $0x10,%rsp
+  80318d:	eb 8d                	jmp    80311c <print_num+0x43>
+
+000000000080318f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80318f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  803193:	48 8b 06             	mov    (%rsi),%rax
+  803196:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80319a:	73 0a                	jae    8031a6 <sprintputch+0x17>
+        *state->start++ = ch;
+  80319c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8031a0:	48 89 16             	mov    %rdx,(%rsi)
+  8031a3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8031a6:	c3                   	ret
+
+00000000008031a7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8031a7:	55                   	push   %rbp
+  8031a8:	48 89 e5             	mov    %rsp,%rbp
+  8031ab:	48 83 ec 50          	sub    $0x50,%rsp
+  8031af:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8031b3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8031b7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8031bb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8031c2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031ca:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031ce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8031d2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8031d6:	48 b8 e4 31 80 00 00 	movabs $0x8031e4,%rax
+  8031dd:	00 00 00 
+  8031e0:	ff d0                	call   *%rax
+}
+  8031e2:	c9                   	leave
+  8031e3:	c3                   	ret
+
+00000000008031e4 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8031e4:	55                   	push   %rbp
+  8031e5:	48 89 e5             	mov    %rsp,%rbp
+  8031e8:	41 57                	push   %r15
+  8031ea:	41 56                	push   %r14
+  8031ec:	41 55                	push   %r13
+  8031ee:	41 54                	push   %r12
+  8031f0:	53                   	push   %rbx
+  8031f1:	48 83 ec 38          	sub    $0x38,%rsp
+  8031f5:	49 89 fe             	mov    %rdi,%r14
+  8031f8:	49 89 f5             	mov    %rsi,%r13
+  8031fb:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8031fe:	48 8b 01             	mov    (%rcx),%rax
+  803201:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803205:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803209:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80320d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803211:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803215:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803219:	0f b6 3b             	movzbl (%rbx),%edi
+  80321c:	40 80 ff 25          	cmp    $0x25,%dil
+  803220:	74 18                	je     80323a <vprintfmt+0x56>
+            if (!ch) return;
+  803222:	40 84 ff             	test   %dil,%dil
+  803225:	0f 84 04 07 00 00    	je     80392f <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80322b:	40 0f b6 ff          	movzbl %dil,%edi
+  80322f:	4c 89 ee             	mov    %r13,%rsi
+  803232:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803235:	4c 89 e3             	mov    %r12,%rbx
+  803238:	eb db                	jmp    803215 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80323a:	be 00 00 00 00       	mov    $0x0,%esi
+  80323f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803243:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803248:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80324e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803255:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803259:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80325e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803263:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803266:	83 e8 23             	sub    $0x23,%eax
+  803269:	3c 57                	cmp    $0x57,%al
+  80326b:	0f 87 a4 06 00 00    	ja     803915 <vprintfmt+0x731>
+  803271:	0f b6 c0             	movzbl %al,%eax
+  803274:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  80327b:	00 00 00 
+  80327e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803281:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803284:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803288:	eb cf                	jmp    803259 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80328a:	49 89 dc             	mov    %rbx,%r12
+  80328d:	be 01 00 00 00       	mov    $0x1,%esi
+  803292:	eb c5                	jmp    803259 <vprintfmt+0x75>
+            padc = ch;
+  803294:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  803298:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80329b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80329e:	eb b9                	jmp    803259 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8032a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8032a6:	77 24                	ja     8032cc <vprintfmt+0xe8>
+  8032a8:	89 c1                	mov    %eax,%ecx
+  8032aa:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8032ae:	83 c0 08             	add    $0x8,%eax
+  8032b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8032b4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8032b7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8032ba:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8032be:	79 99                	jns    803259 <vprintfmt+0x75>
+                width = precision;
+  8032c0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8032c4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8032ca:	eb 8d                	jmp    803259 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032cc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032d0:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8032d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032d8:	eb da                	jmp    8032b4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8032da:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8032df:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032e3:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8032e9:	3c 39                	cmp    $0x39,%al
+  8032eb:	77 1c                	ja     803309 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8032ed:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8032f1:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8032f5:	0f b6 c0             	movzbl %al,%eax
+  8032f8:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032fd:	0f b6 03             	movzbl (%rbx),%eax
+  803300:	3c 39                	cmp    $0x39,%al
+  803302:	76 e9                	jbe    8032ed <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803304:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803307:	eb b1                	jmp    8032ba <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803309:	49 89 dc             	mov    %rbx,%r12
+  80330c:	eb ac                	jmp    8032ba <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80330e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803311:	85 c9                	test   %ecx,%ecx
+  803313:	b8 00 00 00 00       	mov    $0x0,%eax
+  803318:	0f 49 c1             	cmovns %ecx,%eax
+  80331b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80331e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803321:	e9 33 ff ff ff       	jmp    803259 <vprintfmt+0x75>
+            lflag++;
+  803326:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803329:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80332c:	e9 28 ff ff ff       	jmp    803259 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803331:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803334:	83 f8 2f             	cmp    $0x2f,%eax
+  803337:	77 19                	ja     803352 <vprintfmt+0x16e>
+  803339:	89 c2                	mov    %eax,%edx
+  80333b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80333f:	83 c0 08             	add    $0x8,%eax
+  803342:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803345:	8b 3a                	mov    (%rdx),%edi
+  803347:	4c 89 ee             	mov    %r13,%rsi
+  80334a:	41 ff d6             	call   *%r14
+            break;
+  80334d:	e9 c3 fe ff ff       	jmp    803215 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803352:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803356:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80335a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80335e:	eb e5                	jmp    803345 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803360:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803363:	83 f8 2f             	cmp    $0x2f,%eax
+  803366:	77 5a                	ja     8033c2 <vprintfmt+0x1de>
+  803368:	89 c2                	mov    %eax,%edx
+  80336a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80336e:	83 c0 08             	add    $0x8,%eax
+  803371:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803374:	8b 02                	mov    (%rdx),%eax
+  803376:	89 c1                	mov    %eax,%ecx
+  803378:	f7 d9                	neg    %ecx
+  80337a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80337d:	83 f9 13             	cmp    $0x13,%ecx
+  803380:	7f 4e                	jg     8033d0 <vprintfmt+0x1ec>
+  803382:	48 63 c1             	movslq %ecx,%rax
+  803385:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  80338c:	00 00 00 
+  80338f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803393:	48 85 c0             	test   %rax,%rax
+  803396:	74 38                	je     8033d0 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803398:	48 89 c1             	mov    %rax,%rcx
+  80339b:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  8033a2:	00 00 00 
+  8033a5:	4c 89 ee             	mov    %r13,%rsi
+  8033a8:	4c 89 f7             	mov    %r14,%rdi
+  8033ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b0:	49 b8 a7 31 80 00 00 	movabs $0x8031a7,%r8
+  8033b7:	00 00 00 
+  8033ba:	41 ff d0             	call   *%r8
+  8033bd:	e9 53 fe ff ff       	jmp    803215 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8033c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033ce:	eb a4                	jmp    803374 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8033d0:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  8033d7:	00 00 00 
+  8033da:	4c 89 ee             	mov    %r13,%rsi
+  8033dd:	4c 89 f7             	mov    %r14,%rdi
+  8033e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e5:	49 b8 a7 31 80 00 00 	movabs $0x8031a7,%r8
+  8033ec:	00 00 00 
+  8033ef:	41 ff d0             	call   *%r8
+  8033f2:	e9 1e fe ff ff       	jmp    803215 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8033f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8033fd:	77 36                	ja     803435 <vprintfmt+0x251>
+  8033ff:	89 c2                	mov    %eax,%edx
+  803401:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803405:	83 c0 08             	add    $0x8,%eax
+  803408:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80340b:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80340e:	48 85 f6             	test   %rsi,%rsi
+  803411:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  803418:	00 00 00 
+  80341b:	48 0f 45 c6          	cmovne %rsi,%rax
+  80341f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803423:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803427:	7e 06                	jle    80342f <vprintfmt+0x24b>
+  803429:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80342d:	75 14                	jne    803443 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80342f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803433:	eb 5b                	jmp    803490 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  803435:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803439:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80343d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803441:	eb c8                	jmp    80340b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803443:	49 63 f7             	movslq %r15d,%rsi
+  803446:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80344a:	48 b8 e9 39 80 00 00 	movabs $0x8039e9,%rax
+  803451:	00 00 00 
+  803454:	ff d0                	call   *%rax
+  803456:	48 89 c2             	mov    %rax,%rdx
+  803459:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80345c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80345e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803461:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803464:	85 c0                	test   %eax,%eax
+  803466:	7e c7                	jle    80342f <vprintfmt+0x24b>
+  803468:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80346d:	4c 89 ee             	mov    %r13,%rsi
+  803470:	44 89 e7             	mov    %r12d,%edi
+  803473:	41 ff d6             	call   *%r14
+  803476:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80347a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80347d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803480:	75 eb                	jne    80346d <vprintfmt+0x289>
+  803482:	eb ab                	jmp    80342f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803484:	0f b6 f8             	movzbl %al,%edi
+  803487:	4c 89 ee             	mov    %r13,%rsi
+  80348a:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  80348d:	4c 89 e2             	mov    %r12,%rdx
+  803490:	45 85 ff             	test   %r15d,%r15d
+  803493:	78 06                	js     80349b <vprintfmt+0x2b7>
+  803495:	41 83 ef 01          	sub    $0x1,%r15d
+  803499:	78 23                	js     8034be <vprintfmt+0x2da>
+  80349b:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80349f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8034a5:	84 c0                	test   %al,%al
+  8034a7:	74 15                	je     8034be <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8034a9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8034ad:	74 d5                	je     803484 <vprintfmt+0x2a0>
+  8034af:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8034b2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8034b7:	80 fa 5e             	cmp    $0x5e,%dl
+  8034ba:	77 cb                	ja     803487 <vprintfmt+0x2a3>
+  8034bc:	eb c6                	jmp    803484 <vprintfmt+0x2a0>
+  8034be:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8034c1:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8034c4:	01 f0                	add    %esi,%eax
+  8034c6:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8034c8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8034cc:	85 c0                	test   %eax,%eax
+  8034ce:	0f 8e 41 fd ff ff    	jle    803215 <vprintfmt+0x31>
+  8034d4:	4c 89 ee             	mov    %r13,%rsi
+  8034d7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8034dc:	41 ff d6             	call   *%r14
+  8034df:	41 83 ec 01          	sub    $0x1,%r12d
+  8034e3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8034e7:	75 eb                	jne    8034d4 <vprintfmt+0x2f0>
+  8034e9:	e9 27 fd ff ff       	jmp    803215 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8034ee:	40 84 f6             	test   %sil,%sil
+  8034f1:	75 26                	jne    803519 <vprintfmt+0x335>
+    switch (lflag) {
+  8034f3:	85 d2                	test   %edx,%edx
+  8034f5:	74 59                	je     803550 <vprintfmt+0x36c>
+  8034f7:	83 fa 01             	cmp    $0x1,%edx
+  8034fa:	74 7b                	je     803577 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8034fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034ff:	83 f8 2f             	cmp    $0x2f,%eax
+  803502:	0f 87 96 00 00 00    	ja     80359e <vprintfmt+0x3ba>
+  803508:	89 c2                	mov    %eax,%edx
+  80350a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80350e:	83 c0 08             	add    $0x8,%eax
+  803511:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803514:	4c 8b 22             	mov    (%rdx),%r12
+  803517:	eb 17                	jmp    803530 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  803519:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80351c:	83 f8 2f             	cmp    $0x2f,%eax
+  80351f:	77 21                	ja     803542 <vprintfmt+0x35e>
+  803521:	89 c2                	mov    %eax,%edx
+  803523:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803527:	83 c0 08             	add    $0x8,%eax
+  80352a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80352d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803530:	4d 85 e4             	test   %r12,%r12
+  803533:	78 7a                	js     8035af <vprintfmt+0x3cb>
+            num = i;
+  803535:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803538:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80353d:	e9 b5 02 00 00       	jmp    8037f7 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803542:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803546:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80354a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80354e:	eb dd                	jmp    80352d <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  803550:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803553:	83 f8 2f             	cmp    $0x2f,%eax
+  803556:	77 11                	ja     803569 <vprintfmt+0x385>
+  803558:	89 c2                	mov    %eax,%edx
+  80355a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80355e:	83 c0 08             	add    $0x8,%eax
+  803561:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803564:	4c 63 22             	movslq (%rdx),%r12
+  803567:	eb c7                	jmp    803530 <vprintfmt+0x34c>
+  803569:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80356d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803571:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803575:	eb ed                	jmp    803564 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  803577:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80357a:	83 f8 2f             	cmp    $0x2f,%eax
+  80357d:	77 11                	ja     803590 <vprintfmt+0x3ac>
+  80357f:	89 c2                	mov    %eax,%edx
+  803581:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803585:	83 c0 08             	add    $0x8,%eax
+  803588:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80358b:	4c 8b 22             	mov    (%rdx),%r12
+  80358e:	eb a0                	jmp    803530 <vprintfmt+0x34c>
+  803590:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803594:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803598:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80359c:	eb ed                	jmp    80358b <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  80359e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035aa:	e9 65 ff ff ff       	jmp    803514 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8035af:	4c 89 ee             	mov    %r13,%rsi
+  8035b2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8035b7:	41 ff d6             	call   *%r14
+                i = -i;
+  8035ba:	49 f7 dc             	neg    %r12
+  8035bd:	e9 73 ff ff ff       	jmp    803535 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8035c2:	40 84 f6             	test   %sil,%sil
+  8035c5:	75 32                	jne    8035f9 <vprintfmt+0x415>
+    switch (lflag) {
+  8035c7:	85 d2                	test   %edx,%edx
+  8035c9:	74 5d                	je     803628 <vprintfmt+0x444>
+  8035cb:	83 fa 01             	cmp    $0x1,%edx
+  8035ce:	0f 84 82 00 00 00    	je     803656 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8035d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8035da:	0f 87 a5 00 00 00    	ja     803685 <vprintfmt+0x4a1>
+  8035e0:	89 c2                	mov    %eax,%edx
+  8035e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035e6:	83 c0 08             	add    $0x8,%eax
+  8035e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035ec:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035ef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8035f4:	e9 fe 01 00 00       	jmp    8037f7 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8035f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8035ff:	77 19                	ja     80361a <vprintfmt+0x436>
+  803601:	89 c2                	mov    %eax,%edx
+  803603:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803607:	83 c0 08             	add    $0x8,%eax
+  80360a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80360d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803610:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803615:	e9 dd 01 00 00       	jmp    8037f7 <vprintfmt+0x613>
+  80361a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80361e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803622:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803626:	eb e5                	jmp    80360d <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  803628:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80362b:	83 f8 2f             	cmp    $0x2f,%eax
+  80362e:	77 18                	ja     803648 <vprintfmt+0x464>
+  803630:	89 c2                	mov    %eax,%edx
+  803632:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803636:	83 c0 08             	add    $0x8,%eax
+  803639:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80363c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80363e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803643:	e9 af 01 00 00       	jmp    8037f7 <vprintfmt+0x613>
+  803648:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80364c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803650:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803654:	eb e6                	jmp    80363c <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  803656:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803659:	83 f8 2f             	cmp    $0x2f,%eax
+  80365c:	77 19                	ja     803677 <vprintfmt+0x493>
+  80365e:	89 c2                	mov    %eax,%edx
+  803660:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803664:	83 c0 08             	add    $0x8,%eax
+  803667:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80366a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80366d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803672:	e9 80 01 00 00       	jmp    8037f7 <vprintfmt+0x613>
+  803677:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80367b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80367f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803683:	eb e5                	jmp    80366a <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  803685:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803689:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80368d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803691:	e9 56 ff ff ff       	jmp    8035ec <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  803696:	40 84 f6             	test   %sil,%sil
+  803699:	75 2e                	jne    8036c9 <vprintfmt+0x4e5>
+    switch (lflag) {
+  80369b:	85 d2                	test   %edx,%edx
+  80369d:	0f 84 b3 00 00 00    	je     803756 <vprintfmt+0x572>
+  8036a3:	83 fa 01             	cmp    $0x1,%edx
+  8036a6:	0f 84 d3 00 00 00    	je     80377f <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8036ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036af:	83 f8 2f             	cmp    $0x2f,%eax
+  8036b2:	0f 87 f1 00 00 00    	ja     8037a9 <vprintfmt+0x5c5>
+  8036b8:	89 c2                	mov    %eax,%edx
+  8036ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036be:	83 c0 08             	add    $0x8,%eax
+  8036c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036c4:	48 8b 02             	mov    (%rdx),%rax
+  8036c7:	eb 17                	jmp    8036e0 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8036cf:	77 77                	ja     803748 <vprintfmt+0x564>
+  8036d1:	89 c2                	mov    %eax,%edx
+  8036d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036d7:	83 c0 08             	add    $0x8,%eax
+  8036da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036dd:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8036e0:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036e2:	83 f8 07             	cmp    $0x7,%eax
+  8036e5:	0f 8e cf 00 00 00    	jle    8037ba <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8036eb:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036f1:	44 89 e7             	mov    %r12d,%edi
+  8036f4:	41 c1 e4 03          	shl    $0x3,%r12d
+  8036f8:	89 d1                	mov    %edx,%ecx
+  8036fa:	8d 72 07             	lea    0x7(%rdx),%esi
+  8036fd:	85 d2                	test   %edx,%edx
+  8036ff:	0f 48 d6             	cmovs  %esi,%edx
+  803702:	c1 fa 03             	sar    $0x3,%edx
+  803705:	83 f9 3f             	cmp    $0x3f,%ecx
+  803708:	7f e7                	jg     8036f1 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80370a:	85 ff                	test   %edi,%edi
+  80370c:	0f 84 03 fb ff ff    	je     803215 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  803712:	49 63 f4             	movslq %r12d,%rsi
+  803715:	ba 00 00 00 00       	mov    $0x0,%edx
+  80371a:	48 f7 f6             	div    %rsi
+  80371d:	49 89 d7             	mov    %rdx,%r15
+  803720:	83 c0 30             	add    $0x30,%eax
+  803723:	0f be f8             	movsbl %al,%edi
+  803726:	4c 89 ee             	mov    %r13,%rsi
+  803729:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80372c:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  80372f:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  803734:	45 85 e4             	test   %r12d,%r12d
+  803737:	41 0f 49 d4          	cmovns %r12d,%edx
+  80373b:	c1 fa 03             	sar    $0x3,%edx
+  80373e:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  803741:	75 cf                	jne    803712 <vprintfmt+0x52e>
+  803743:	e9 cd fa ff ff       	jmp    803215 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  803748:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80374c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803750:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803754:	eb 87                	jmp    8036dd <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  803756:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803759:	83 f8 2f             	cmp    $0x2f,%eax
+  80375c:	77 13                	ja     803771 <vprintfmt+0x58d>
+  80375e:	89 c2                	mov    %eax,%edx
+  803760:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803764:	83 c0 08             	add    $0x8,%eax
+  803767:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80376a:	8b 02                	mov    (%rdx),%eax
+  80376c:	e9 6f ff ff ff       	jmp    8036e0 <vprintfmt+0x4fc>
+  803771:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803775:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803779:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80377d:	eb eb                	jmp    80376a <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  80377f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803782:	83 f8 2f             	cmp    $0x2f,%eax
+  803785:	77 14                	ja     80379b <vprintfmt+0x5b7>
+  803787:	89 c2                	mov    %eax,%edx
+  803789:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80378d:	83 c0 08             	add    $0x8,%eax
+  803790:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803793:	48 8b 02             	mov    (%rdx),%rax
+  803796:	e9 45 ff ff ff       	jmp    8036e0 <vprintfmt+0x4fc>
+  80379b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80379f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037a7:	eb ea                	jmp    803793 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8037a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037b5:	e9 0a ff ff ff       	jmp    8036c4 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8037ba:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8037c0:	e9 4d ff ff ff       	jmp    803712 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8037c5:	4c 89 ee             	mov    %r13,%rsi
+  8037c8:	bf 30 00 00 00       	mov    $0x30,%edi
+  8037cd:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8037d0:	4c 89 ee             	mov    %r13,%rsi
+  8037d3:	bf 78 00 00 00       	mov    $0x78,%edi
+  8037d8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8037db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037de:	83 f8 2f             	cmp    $0x2f,%eax
+  8037e1:	77 47                	ja     80382a <vprintfmt+0x646>
+  8037e3:	89 c2                	mov    %eax,%edx
+  8037e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037e9:	83 c0 08             	add    $0x8,%eax
+  8037ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037ef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8037f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8037f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8037fb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8037ff:	0f 94 c0             	sete   %al
+  803802:	0f b6 c0             	movzbl %al,%eax
+  803805:	50                   	push   %rax
+  803806:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80380b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80380f:	4c 89 ee             	mov    %r13,%rsi
+  803812:	4c 89 f7             	mov    %r14,%rdi
+  803815:	48 b8 d9 30 80 00 00 	movabs $0x8030d9,%rax
+  80381c:	00 00 00 
+  80381f:	ff d0                	call   *%rax
+            break;
+  803821:	48 83 c4 10          	add    $0x10,%rsp
+  803825:	e9 eb f9 ff ff       	jmp    803215 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80382a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80382e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803832:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803836:	eb b7                	jmp    8037ef <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  803838:	40 84 f6             	test   %sil,%sil
+  80383b:	75 2b                	jne    803868 <vprintfmt+0x684>
+    switch (lflag) {
+  80383d:	85 d2                	test   %edx,%edx
+  80383f:	74 56                	je     803897 <vprintfmt+0x6b3>
+  803841:	83 fa 01             	cmp    $0x1,%edx
+  803844:	74 7f                	je     8038c5 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  803846:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803849:	83 f8 2f             	cmp    $0x2f,%eax
+  80384c:	0f 87 a2 00 00 00    	ja     8038f4 <vprintfmt+0x710>
+  803852:	89 c2                	mov    %eax,%edx
+  803854:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803858:	83 c0 08             	add    $0x8,%eax
+  80385b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80385e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803861:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803866:	eb 8f                	jmp    8037f7 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803868:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80386b:	83 f8 2f             	cmp    $0x2f,%eax
+  80386e:	77 19                	ja     803889 <vprintfmt+0x6a5>
+  803870:	89 c2                	mov    %eax,%edx
+  803872:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803876:	83 c0 08             	add    $0x8,%eax
+  803879:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80387c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80387f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803884:	e9 6e ff ff ff       	jmp    8037f7 <vprintfmt+0x613>
+  803889:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80388d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803891:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803895:	eb e5                	jmp    80387c <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  803897:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80389a:	83 f8 2f             	cmp    $0x2f,%eax
+  80389d:	77 18                	ja     8038b7 <vprintfmt+0x6d3>
+  80389f:	89 c2                	mov    %eax,%edx
+  8038a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038a5:	83 c0 08             	add    $0x8,%eax
+  8038a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038ab:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8038ad:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8038b2:	e9 40 ff ff ff       	jmp    8037f7 <vprintfmt+0x613>
+  8038b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038c3:	eb e6                	jmp    8038ab <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8038c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8038cb:	77 19                	ja     8038e6 <vprintfmt+0x702>
+  8038cd:	89 c2                	mov    %eax,%edx
+  8038cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038d3:	83 c0 08             	add    $0x8,%eax
+  8038d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038d9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038dc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8038e1:	e9 11 ff ff ff       	jmp    8037f7 <vprintfmt+0x613>
+  8038e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038f2:	eb e5                	jmp    8038d9 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  8038f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803900:	e9 59 ff ff ff       	jmp    80385e <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  803905:	4c 89 ee             	mov    %r13,%rsi
+  803908:	bf 25 00 00 00       	mov    $0x25,%edi
+  80390d:	41 ff d6             	call   *%r14
+            break;
+  803910:	e9 00 f9 ff ff       	jmp    803215 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803915:	4c 89 ee             	mov    %r13,%rsi
+  803918:	bf 25 00 00 00       	mov    $0x25,%edi
+  80391d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803920:	48 83 eb 01          	sub    $0x1,%rbx
+  803924:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803928:	75 f6                	jne    803920 <vprintfmt+0x73c>
+  80392a:	e9 e6 f8 ff ff       	jmp    803215 <vprintfmt+0x31>
+}
+  80392f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803933:	5b                   	pop    %rbx
+  803934:	41 5c                	pop    %r12
+  803936:	41 5d                	pop    %r13
+  803938:	41 5e                	pop    %r14
+  80393a:	41 5f                	pop    %r15
+  80393c:	5d                   	pop    %rbp
+  80393d:	c3                   	ret
+
+000000000080393e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80393e:	55                   	push   %rbp
+  80393f:	48 89 e5             	mov    %rsp,%rbp
+  803942:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803946:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80394a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80394f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803953:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80395a:	48 85 ff             	test   %rdi,%rdi
+  80395d:	74 2b                	je     80398a <vsnprintf+0x4c>
+  80395f:	48 85 f6             	test   %rsi,%rsi
+  803962:	74 26                	je     80398a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803964:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803968:	48 bf 8f 31 80 00 00 	movabs $0x80318f,%rdi
+  80396f:	00 00 00 
+  803972:	48 b8 e4 31 80 00 00 	movabs $0x8031e4,%rax
+  803979:	00 00 00 
+  80397c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80397e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803982:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803985:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803988:	c9                   	leave
+  803989:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80398a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80398f:	eb f7                	jmp    803988 <vsnprintf+0x4a>
+
+0000000000803991 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803991:	55                   	push   %rbp
+  803992:	48 89 e5             	mov    %rsp,%rbp
+  803995:	48 83 ec 50          	sub    $0x50,%rsp
+  803999:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80399d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8039a1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8039a5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8039ac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8039b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039b4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8039b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8039bc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8039c0:	48 b8 3e 39 80 00 00 	movabs $0x80393e,%rax
+  8039c7:	00 00 00 
+  8039ca:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8039cc:	c9                   	leave
+  8039cd:	c3                   	ret
+
+00000000008039ce <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8039ce:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8039d1:	74 10                	je     8039e3 <strlen+0x15>
+    size_t n = 0;
+  8039d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8039d8:	48 83 c0 01          	add    $0x1,%rax
+  8039dc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8039e0:	75 f6                	jne    8039d8 <strlen+0xa>
+  8039e2:	c3                   	ret
+    size_t n = 0;
+  8039e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8039e8:	c3                   	ret
+
+00000000008039e9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8039e9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8039ec:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8039f1:	48 85 f6             	test   %rsi,%rsi
+  8039f4:	74 11                	je     803a07 <strnlen+0x1e>
+  8039f6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8039fa:	74 0c                	je     803a08 <strnlen+0x1f>
+  8039fc:	48 83 c2 01          	add    $0x1,%rdx
+  803a00:	48 39 d0             	cmp    %rdx,%rax
+  803a03:	75 f1                	jne    8039f6 <strnlen+0xd>
+  803a05:	eb 04                	jmp    803a0b <strnlen+0x22>
+  803a07:	c3                   	ret
+  803a08:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803a0b:	c3                   	ret
+
+0000000000803a0c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803a0c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803a0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a14:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803a18:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803a1b:	48 83 c2 01          	add    $0x1,%rdx
+  803a1f:	84 c9                	test   %cl,%cl
+  803a21:	75 f1                	jne    803a14 <strcpy+0x8>
+        ;
+    return res;
+}
+  803a23:	c3                   	ret
+
+0000000000803a24 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803a24:	55                   	push   %rbp
+  803a25:	48 89 e5             	mov    %rsp,%rbp
+  803a28:	41 54                	push   %r12
+  803a2a:	53                   	push   %rbx
+  803a2b:	48 89 fb             	mov    %rdi,%rbx
+  803a2e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a31:	48 b8 ce 39 80 00 00 	movabs $0x8039ce,%rax
+  803a38:	00 00 00 
+  803a3b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a3d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a41:	4c 89 e6             	mov    %r12,%rsi
+  803a44:	48 b8 0c 3a 80 00 00 	movabs $0x803a0c,%rax
+  803a4b:	00 00 00 
+  803a4e:	ff d0                	call   *%rax
+    return dst;
+}
+  803a50:	48 89 d8             	mov    %rbx,%rax
+  803a53:	5b                   	pop    %rbx
+  803a54:	41 5c                	pop    %r12
+  803a56:	5d                   	pop    %rbp
+  803a57:	c3                   	ret
+
+0000000000803a58 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803a58:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803a5b:	48 85 d2             	test   %rdx,%rdx
+  803a5e:	74 1f                	je     803a7f <strncpy+0x27>
+  803a60:	48 01 fa             	add    %rdi,%rdx
+  803a63:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803a66:	48 83 c1 01          	add    $0x1,%rcx
+  803a6a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803a6e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803a72:	41 80 f8 01          	cmp    $0x1,%r8b
+  803a76:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803a7a:	48 39 ca             	cmp    %rcx,%rdx
+  803a7d:	75 e7                	jne    803a66 <strncpy+0xe>
+    }
+    return ret;
+}
+  803a7f:	c3                   	ret
+
+0000000000803a80 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803a80:	48 89 f8             	mov    %rdi,%rax
+  803a83:	48 85 d2             	test   %rdx,%rdx
+  803a86:	74 24                	je     803aac <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803a88:	48 83 ea 01          	sub    $0x1,%rdx
+  803a8c:	74 1b                	je     803aa9 <strlcpy+0x29>
+  803a8e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803a92:	0f b6 16             	movzbl (%rsi),%edx
+  803a95:	84 d2                	test   %dl,%dl
+  803a97:	74 10                	je     803aa9 <strlcpy+0x29>
+            *dst++ = *src++;
+  803a99:	48 83 c6 01          	add    $0x1,%rsi
+  803a9d:	48 83 c0 01          	add    $0x1,%rax
+  803aa1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803aa4:	48 39 c8             	cmp    %rcx,%rax
+  803aa7:	75 e9                	jne    803a92 <strlcpy+0x12>
+        *dst = '\0';
+  803aa9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803aac:	48 29 f8             	sub    %rdi,%rax
+}
+  803aaf:	c3                   	ret
+
+0000000000803ab0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803ab0:	0f b6 07             	movzbl (%rdi),%eax
+  803ab3:	84 c0                	test   %al,%al
+  803ab5:	74 13                	je     803aca <strcmp+0x1a>
+  803ab7:	38 06                	cmp    %al,(%rsi)
+  803ab9:	75 0f                	jne    803aca <strcmp+0x1a>
+  803abb:	48 83 c7 01          	add    $0x1,%rdi
+  803abf:	48 83 c6 01          	add    $0x1,%rsi
+  803ac3:	0f b6 07             	movzbl (%rdi),%eax
+  803ac6:	84 c0                	test   %al,%al
+  803ac8:	75 ed                	jne    803ab7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803aca:	0f b6 c0             	movzbl %al,%eax
+  803acd:	0f b6 16             	movzbl (%rsi),%edx
+  803ad0:	29 d0                	sub    %edx,%eax
+}
+  803ad2:	c3                   	ret
+
+0000000000803ad3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803ad3:	48 85 d2             	test   %rdx,%rdx
+  803ad6:	74 1f                	je     803af7 <strncmp+0x24>
+  803ad8:	0f b6 07             	movzbl (%rdi),%eax
+  803adb:	84 c0                	test   %al,%al
+  803add:	74 1e                	je     803afd <strncmp+0x2a>
+  803adf:	3a 06                	cmp    (%rsi),%al
+  803ae1:	75 1a                	jne    803afd <strncmp+0x2a>
+  803ae3:	48 83 c7 01          	add    $0x1,%rdi
+  803ae7:	48 83 c6 01          	add    $0x1,%rsi
+  803aeb:	48 83 ea 01          	sub    $0x1,%rdx
+  803aef:	75 e7                	jne    803ad8 <strncmp+0x5>
+
+    if (!n) return 0;
+  803af1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af6:	c3                   	ret
+  803af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803afc:	c3                   	ret
+  803afd:	48 85 d2             	test   %rdx,%rdx
+  803b00:	74 09                	je     803b0b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803b02:	0f b6 07             	movzbl (%rdi),%eax
+  803b05:	0f b6 16             	movzbl (%rsi),%edx
+  803b08:	29 d0                	sub    %edx,%eax
+  803b0a:	c3                   	ret
+    if (!n) return 0;
+  803b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b10:	c3                   	ret
+
+0000000000803b11 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803b11:	0f b6 17             	movzbl (%rdi),%edx
+  803b14:	84 d2                	test   %dl,%dl
+  803b16:	74 18                	je     803b30 <strchr+0x1f>
+        if (*str == c) {
+  803b18:	0f be d2             	movsbl %dl,%edx
+  803b1b:	39 f2                	cmp    %esi,%edx
+  803b1d:	74 17                	je     803b36 <strchr+0x25>
+    for (; *str; str++) {
+  803b1f:	48 83 c7 01          	add    $0x1,%rdi
+  803b23:	0f b6 17             	movzbl (%rdi),%edx
+  803b26:	84 d2                	test   %dl,%dl
+  803b28:	75 ee                	jne    803b18 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2f:	c3                   	ret
+  803b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b35:	c3                   	ret
+  803b36:	48 89 f8             	mov    %rdi,%rax
+}
+  803b39:	c3                   	ret
+
+0000000000803b3a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b3a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b3d:	0f b6 17             	movzbl (%rdi),%edx
+  803b40:	84 d2                	test   %dl,%dl
+  803b42:	74 13                	je     803b57 <strfind+0x1d>
+  803b44:	0f be d2             	movsbl %dl,%edx
+  803b47:	39 f2                	cmp    %esi,%edx
+  803b49:	74 0b                	je     803b56 <strfind+0x1c>
+  803b4b:	48 83 c0 01          	add    $0x1,%rax
+  803b4f:	0f b6 10             	movzbl (%rax),%edx
+  803b52:	84 d2                	test   %dl,%dl
+  803b54:	75 ee                	jne    803b44 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803b56:	c3                   	ret
+  803b57:	c3                   	ret
+
+0000000000803b58 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803b58:	55                   	push   %rbp
+  803b59:	48 89 e5             	mov    %rsp,%rbp
+  803b5c:	41 57                	push   %r15
+  803b5e:	41 56                	push   %r14
+  803b60:	41 55                	push   %r13
+  803b62:	41 54                	push   %r12
+  803b64:	53                   	push   %rbx
+  803b65:	48 83 ec 08          	sub    $0x8,%rsp
+  803b69:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803b6c:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803b70:	45 84 ed             	test   %r13b,%r13b
+  803b73:	75 12                	jne    803b87 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803b75:	4c 89 f8             	mov    %r15,%rax
+  803b78:	48 83 c4 08          	add    $0x8,%rsp
+  803b7c:	5b                   	pop    %rbx
+  803b7d:	41 5c                	pop    %r12
+  803b7f:	41 5d                	pop    %r13
+  803b81:	41 5e                	pop    %r14
+  803b83:	41 5f                	pop    %r15
+  803b85:	5d                   	pop    %rbp
+  803b86:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803b87:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803b8b:	4c 89 e7             	mov    %r12,%rdi
+  803b8e:	48 b8 ce 39 80 00 00 	movabs $0x8039ce,%rax
+  803b95:	00 00 00 
+  803b98:	ff d0                	call   *%rax
+  803b9a:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803b9d:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803ba1:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803ba5:	49 bf d3 3a 80 00 00 	movabs $0x803ad3,%r15
+  803bac:	00 00 00 
+				if ((sc = *s++) == 0)
+  803baf:	84 c0                	test   %al,%al
+  803bb1:	75 14                	jne    803bc7 <strstr+0x6f>
+					return NULL;
+  803bb3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bb9:	eb ba                	jmp    803b75 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803bbb:	48 83 c3 01          	add    $0x1,%rbx
+  803bbf:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803bc3:	84 c0                	test   %al,%al
+  803bc5:	74 1b                	je     803be2 <strstr+0x8a>
+			} while (sc != c);
+  803bc7:	41 38 c5             	cmp    %al,%r13b
+  803bca:	75 ef                	jne    803bbb <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803bcc:	4c 89 f2             	mov    %r14,%rdx
+  803bcf:	4c 89 e6             	mov    %r12,%rsi
+  803bd2:	48 89 df             	mov    %rbx,%rdi
+  803bd5:	41 ff d7             	call   *%r15
+  803bd8:	85 c0                	test   %eax,%eax
+  803bda:	75 df                	jne    803bbb <strstr+0x63>
+  803bdc:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803be0:	eb 93                	jmp    803b75 <strstr+0x1d>
+					return NULL;
+  803be2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803be8:	eb 8b                	jmp    803b75 <strstr+0x1d>
+
+0000000000803bea <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803bea:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803bec:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803bef:	8d 57 20             	lea    0x20(%rdi),%edx
+  803bf2:	83 f9 1a             	cmp    $0x1a,%ecx
+  803bf5:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803bf8:	c3                   	ret
+
+0000000000803bf9 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803bf9:	55                   	push   %rbp
+  803bfa:	48 89 e5             	mov    %rsp,%rbp
+  803bfd:	41 57                	push   %r15
+  803bff:	41 56                	push   %r14
+  803c01:	41 55                	push   %r13
+  803c03:	41 54                	push   %r12
+  803c05:	53                   	push   %rbx
+  803c06:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803c0a:	48 39 f7             	cmp    %rsi,%rdi
+  803c0d:	74 49                	je     803c58 <strcasecmp+0x5f>
+  803c0f:	49 89 fd             	mov    %rdi,%r13
+  803c12:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803c15:	49 bf ea 3b 80 00 00 	movabs $0x803bea,%r15
+  803c1c:	00 00 00 
+  803c1f:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803c24:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c28:	41 ff d7             	call   *%r15
+  803c2b:	89 c3                	mov    %eax,%ebx
+  803c2d:	49 83 c4 01          	add    $0x1,%r12
+  803c31:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c37:	41 ff d7             	call   *%r15
+  803c3a:	29 c3                	sub    %eax,%ebx
+  803c3c:	75 09                	jne    803c47 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c3e:	49 83 c5 01          	add    $0x1,%r13
+  803c42:	45 84 f6             	test   %r14b,%r14b
+  803c45:	75 d8                	jne    803c1f <strcasecmp+0x26>
+}
+  803c47:	89 d8                	mov    %ebx,%eax
+  803c49:	48 83 c4 08          	add    $0x8,%rsp
+  803c4d:	5b                   	pop    %rbx
+  803c4e:	41 5c                	pop    %r12
+  803c50:	41 5d                	pop    %r13
+  803c52:	41 5e                	pop    %r14
+  803c54:	41 5f                	pop    %r15
+  803c56:	5d                   	pop    %rbp
+  803c57:	c3                   	ret
+        return 0;
+  803c58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c5d:	eb e8                	jmp    803c47 <strcasecmp+0x4e>
+
+0000000000803c5f <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c5f:	55                   	push   %rbp
+  803c60:	48 89 e5             	mov    %rsp,%rbp
+  803c63:	41 57                	push   %r15
+  803c65:	41 56                	push   %r14
+  803c67:	41 55                	push   %r13
+  803c69:	41 54                	push   %r12
+  803c6b:	53                   	push   %rbx
+  803c6c:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803c70:	48 85 d2             	test   %rdx,%rdx
+  803c73:	74 4f                	je     803cc4 <strncasecmp+0x65>
+  803c75:	49 89 fc             	mov    %rdi,%r12
+  803c78:	49 89 f5             	mov    %rsi,%r13
+  803c7b:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803c7f:	49 be ea 3b 80 00 00 	movabs $0x803bea,%r14
+  803c86:	00 00 00 
+  803c89:	49 83 c4 01          	add    $0x1,%r12
+  803c8d:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c93:	41 ff d6             	call   *%r14
+  803c96:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803c98:	49 83 c5 01          	add    $0x1,%r13
+  803c9c:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803ca1:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803ca4:	29 c3                	sub    %eax,%ebx
+  803ca6:	85 c0                	test   %eax,%eax
+  803ca8:	74 09                	je     803cb3 <strncasecmp+0x54>
+  803caa:	85 db                	test   %ebx,%ebx
+  803cac:	75 05                	jne    803cb3 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803cae:	4d 39 fc             	cmp    %r15,%r12
+  803cb1:	75 d6                	jne    803c89 <strncasecmp+0x2a>
+}
+  803cb3:	89 d8                	mov    %ebx,%eax
+  803cb5:	48 83 c4 08          	add    $0x8,%rsp
+  803cb9:	5b                   	pop    %rbx
+  803cba:	41 5c                	pop    %r12
+  803cbc:	41 5d                	pop    %r13
+  803cbe:	41 5e                	pop    %r14
+  803cc0:	41 5f                	pop    %r15
+  803cc2:	5d                   	pop    %rbp
+  803cc3:	c3                   	ret
+    int d = 0;
+  803cc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803cc9:	eb e8                	jmp    803cb3 <strncasecmp+0x54>
+
+0000000000803ccb <toupper>:
+
+int toupper(int c) {
+  803ccb:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803ccd:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803cd0:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803cd3:	83 f9 1a             	cmp    $0x1a,%ecx
+  803cd6:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803cd9:	c3                   	ret
+
+0000000000803cda <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803cda:	83 ff 20             	cmp    $0x20,%edi
+  803cdd:	0f 94 c0             	sete   %al
+  803ce0:	0f b6 c0             	movzbl %al,%eax
+}
+  803ce3:	c3                   	ret
+
+0000000000803ce4 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803ce4:	89 f8                	mov    %edi,%eax
+  803ce6:	f7 d8                	neg    %eax
+  803ce8:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803ceb:	c3                   	ret
+
+0000000000803cec <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803cec:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803cef:	48 89 f8             	mov    %rdi,%rax
+  803cf2:	48 f7 d8             	neg    %rax
+  803cf5:	83 e0 07             	and    $0x7,%eax
+  803cf8:	49 89 d1             	mov    %rdx,%r9
+  803cfb:	49 29 c1             	sub    %rax,%r9
+  803cfe:	78 36                	js     803d36 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803d00:	40 0f b6 c6          	movzbl %sil,%eax
+  803d04:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803d0b:	01 01 01 
+  803d0e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803d12:	40 f6 c7 07          	test   $0x7,%dil
+  803d16:	75 38                	jne    803d50 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803d18:	4c 89 c9             	mov    %r9,%rcx
+  803d1b:	48 c1 f9 03          	sar    $0x3,%rcx
+  803d1f:	74 0c                	je     803d2d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803d21:	fc                   	cld
+  803d22:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803d25:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d29:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d2d:	4d 85 c9             	test   %r9,%r9
+  803d30:	75 45                	jne    803d77 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d32:	4c 89 c0             	mov    %r8,%rax
+  803d35:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d36:	48 85 d2             	test   %rdx,%rdx
+  803d39:	74 f7                	je     803d32 <memset+0x46>
+  803d3b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d3e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d41:	48 83 c0 01          	add    $0x1,%rax
+  803d45:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d49:	48 39 c2             	cmp    %rax,%rdx
+  803d4c:	75 f3                	jne    803d41 <memset+0x55>
+  803d4e:	eb e2                	jmp    803d32 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d50:	40 f6 c7 01          	test   $0x1,%dil
+  803d54:	74 06                	je     803d5c <memset+0x70>
+  803d56:	88 07                	mov    %al,(%rdi)
+  803d58:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d5c:	40 f6 c7 02          	test   $0x2,%dil
+  803d60:	74 07                	je     803d69 <memset+0x7d>
+  803d62:	66 89 07             	mov    %ax,(%rdi)
+  803d65:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d69:	40 f6 c7 04          	test   $0x4,%dil
+  803d6d:	74 a9                	je     803d18 <memset+0x2c>
+  803d6f:	89 07                	mov    %eax,(%rdi)
+  803d71:	48 83 c7 04          	add    $0x4,%rdi
+  803d75:	eb a1                	jmp    803d18 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d77:	41 f6 c1 04          	test   $0x4,%r9b
+  803d7b:	74 06                	je     803d83 <memset+0x97>
+  803d7d:	89 07                	mov    %eax,(%rdi)
+  803d7f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d83:	41 f6 c1 02          	test   $0x2,%r9b
+  803d87:	74 07                	je     803d90 <memset+0xa4>
+  803d89:	66 89 07             	mov    %ax,(%rdi)
+  803d8c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803d90:	41 f6 c1 01          	test   $0x1,%r9b
+  803d94:	74 9c                	je     803d32 <memset+0x46>
+  803d96:	88 07                	mov    %al,(%rdi)
+  803d98:	eb 98                	jmp    803d32 <memset+0x46>
+
+0000000000803d9a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803d9a:	48 89 f8             	mov    %rdi,%rax
+  803d9d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803da0:	48 39 fe             	cmp    %rdi,%rsi
+  803da3:	73 3b                	jae    803de0 <memmove+0x46>
+  803da5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803da9:	48 39 d7             	cmp    %rdx,%rdi
+  803dac:	73 32                	jae    803de0 <memmove+0x46>
+        s += n;
+        d += n;
+  803dae:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803db2:	48 89 d6             	mov    %rdx,%rsi
+  803db5:	48 09 fe             	or     %rdi,%rsi
+  803db8:	48 09 ce             	or     %rcx,%rsi
+  803dbb:	40 f6 c6 07          	test   $0x7,%sil
+  803dbf:	75 12                	jne    803dd3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803dc1:	48 83 ef 08          	sub    $0x8,%rdi
+  803dc5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803dc9:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dcd:	fd                   	std
+  803dce:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803dd1:	fc                   	cld
+  803dd2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803dd3:	48 83 ef 01          	sub    $0x1,%rdi
+  803dd7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803ddb:	fd                   	std
+  803ddc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803dde:	eb f1                	jmp    803dd1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803de0:	48 89 f2             	mov    %rsi,%rdx
+  803de3:	48 09 c2             	or     %rax,%rdx
+  803de6:	48 09 ca             	or     %rcx,%rdx
+  803de9:	f6 c2 07             	test   $0x7,%dl
+  803dec:	75 0c                	jne    803dfa <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803dee:	48 c1 e9 03          	shr    $0x3,%rcx
+  803df2:	48 89 c7             	mov    %rax,%rdi
+  803df5:	fc                   	cld
+  803df6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803df9:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803dfa:	48 89 c7             	mov    %rax,%rdi
+  803dfd:	fc                   	cld
+  803dfe:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803e00:	c3                   	ret
+
+0000000000803e01 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803e01:	55                   	push   %rbp
+  803e02:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803e05:	48 b8 9a 3d 80 00 00 	movabs $0x803d9a,%rax
+  803e0c:	00 00 00 
+  803e0f:	ff d0                	call   *%rax
+}
+  803e11:	5d                   	pop    %rbp
+  803e12:	c3                   	ret
+
+0000000000803e13 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803e13:	55                   	push   %rbp
+  803e14:	48 89 e5             	mov    %rsp,%rbp
+  803e17:	41 57                	push   %r15
+  803e19:	41 56                	push   %r14
+  803e1b:	41 55                	push   %r13
+  803e1d:	41 54                	push   %r12
+  803e1f:	53                   	push   %rbx
+  803e20:	48 83 ec 08          	sub    $0x8,%rsp
+  803e24:	49 89 fe             	mov    %rdi,%r14
+  803e27:	49 89 f7             	mov    %rsi,%r15
+  803e2a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e2d:	48 89 f7             	mov    %rsi,%rdi
+  803e30:	48 b8 ce 39 80 00 00 	movabs $0x8039ce,%rax
+  803e37:	00 00 00 
+  803e3a:	ff d0                	call   *%rax
+  803e3c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e3f:	48 89 de             	mov    %rbx,%rsi
+  803e42:	4c 89 f7             	mov    %r14,%rdi
+  803e45:	48 b8 e9 39 80 00 00 	movabs $0x8039e9,%rax
+  803e4c:	00 00 00 
+  803e4f:	ff d0                	call   *%rax
+  803e51:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e54:	48 39 c3             	cmp    %rax,%rbx
+  803e57:	74 36                	je     803e8f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e59:	48 89 d8             	mov    %rbx,%rax
+  803e5c:	4c 29 e8             	sub    %r13,%rax
+  803e5f:	49 39 c4             	cmp    %rax,%r12
+  803e62:	73 31                	jae    803e95 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803e64:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803e69:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e6d:	4c 89 fe             	mov    %r15,%rsi
+  803e70:	48 b8 01 3e 80 00 00 	movabs $0x803e01,%rax
+  803e77:	00 00 00 
+  803e7a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803e7c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803e80:	48 83 c4 08          	add    $0x8,%rsp
+  803e84:	5b                   	pop    %rbx
+  803e85:	41 5c                	pop    %r12
+  803e87:	41 5d                	pop    %r13
+  803e89:	41 5e                	pop    %r14
+  803e8b:	41 5f                	pop    %r15
+  803e8d:	5d                   	pop    %rbp
+  803e8e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e8f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803e93:	eb eb                	jmp    803e80 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803e95:	48 83 eb 01          	sub    $0x1,%rbx
+  803e99:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e9d:	48 89 da             	mov    %rbx,%rdx
+  803ea0:	4c 89 fe             	mov    %r15,%rsi
+  803ea3:	48 b8 01 3e 80 00 00 	movabs $0x803e01,%rax
+  803eaa:	00 00 00 
+  803ead:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803eaf:	49 01 de             	add    %rbx,%r14
+  803eb2:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803eb7:	eb c3                	jmp    803e7c <strlcat+0x69>
+
+0000000000803eb9 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803eb9:	48 85 d2             	test   %rdx,%rdx
+  803ebc:	74 2d                	je     803eeb <memcmp+0x32>
+  803ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803ec3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803ec7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803ecc:	44 38 c1             	cmp    %r8b,%cl
+  803ecf:	75 0f                	jne    803ee0 <memcmp+0x27>
+    while (n-- > 0) {
+  803ed1:	48 83 c0 01          	add    $0x1,%rax
+  803ed5:	48 39 c2             	cmp    %rax,%rdx
+  803ed8:	75 e9                	jne    803ec3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803eda:	b8 00 00 00 00       	mov    $0x0,%eax
+  803edf:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803ee0:	0f b6 c1             	movzbl %cl,%eax
+  803ee3:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803ee7:	44 29 c0             	sub    %r8d,%eax
+  803eea:	c3                   	ret
+    return 0;
+  803eeb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ef0:	c3                   	ret
+
+0000000000803ef1 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803ef1:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803ef5:	48 39 c7             	cmp    %rax,%rdi
+  803ef8:	73 0f                	jae    803f09 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803efa:	40 38 37             	cmp    %sil,(%rdi)
+  803efd:	74 0e                	je     803f0d <memfind+0x1c>
+    for (; src < end; src++) {
+  803eff:	48 83 c7 01          	add    $0x1,%rdi
+  803f03:	48 39 f8             	cmp    %rdi,%rax
+  803f06:	75 f2                	jne    803efa <memfind+0x9>
+  803f08:	c3                   	ret
+  803f09:	48 89 f8             	mov    %rdi,%rax
+  803f0c:	c3                   	ret
+  803f0d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803f10:	c3                   	ret
+
+0000000000803f11 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803f11:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803f14:	0f b6 37             	movzbl (%rdi),%esi
+  803f17:	40 80 fe 20          	cmp    $0x20,%sil
+  803f1b:	74 06                	je     803f23 <strtol+0x12>
+  803f1d:	40 80 fe 09          	cmp    $0x9,%sil
+  803f21:	75 13                	jne    803f36 <strtol+0x25>
+  803f23:	48 83 c7 01          	add    $0x1,%rdi
+  803f27:	0f b6 37             	movzbl (%rdi),%esi
+  803f2a:	40 80 fe 20          	cmp    $0x20,%sil
+  803f2e:	74 f3                	je     803f23 <strtol+0x12>
+  803f30:	40 80 fe 09          	cmp    $0x9,%sil
+  803f34:	74 ed                	je     803f23 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f36:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f39:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f3c:	3c 01                	cmp    $0x1,%al
+  803f3e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f42:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f48:	75 0f                	jne    803f59 <strtol+0x48>
+  803f4a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f4d:	74 14                	je     803f63 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f4f:	85 d2                	test   %edx,%edx
+  803f51:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f56:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f59:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803f5e:	4c 63 ca             	movslq %edx,%r9
+  803f61:	eb 36                	jmp    803f99 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f63:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803f67:	74 0f                	je     803f78 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803f69:	85 d2                	test   %edx,%edx
+  803f6b:	75 ec                	jne    803f59 <strtol+0x48>
+        s++;
+  803f6d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803f71:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803f76:	eb e1                	jmp    803f59 <strtol+0x48>
+        s += 2;
+  803f78:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803f7c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803f81:	eb d6                	jmp    803f59 <strtol+0x48>
+            dig -= '0';
+  803f83:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803f86:	44 0f b6 c1          	movzbl %cl,%r8d
+  803f8a:	41 39 d0             	cmp    %edx,%r8d
+  803f8d:	7d 21                	jge    803fb0 <strtol+0x9f>
+        val = val * base + dig;
+  803f8f:	49 0f af c1          	imul   %r9,%rax
+  803f93:	0f b6 c9             	movzbl %cl,%ecx
+  803f96:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803f99:	48 83 c7 01          	add    $0x1,%rdi
+  803f9d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803fa1:	80 f9 39             	cmp    $0x39,%cl
+  803fa4:	76 dd                	jbe    803f83 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803fa6:	80 f9 7b             	cmp    $0x7b,%cl
+  803fa9:	77 05                	ja     803fb0 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803fab:	83 e9 57             	sub    $0x57,%ecx
+  803fae:	eb d6                	jmp    803f86 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803fb0:	4d 85 d2             	test   %r10,%r10
+  803fb3:	74 03                	je     803fb8 <strtol+0xa7>
+  803fb5:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803fb8:	48 89 c2             	mov    %rax,%rdx
+  803fbb:	48 f7 da             	neg    %rdx
+  803fbe:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803fc2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803fc6:	c3                   	ret
+
+0000000000803fc7 <atoi>:
+int atoi(const char *str) {
+  803fc7:	55                   	push   %rbp
+  803fc8:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  803fcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fd0:	be 00 00 00 00       	mov    $0x0,%esi
+  803fd5:	48 b8 11 3f 80 00 00 	movabs $0x803f11,%rax
+  803fdc:	00 00 00 
+  803fdf:	ff d0                	call   *%rax
+}
+  803fe1:	5d                   	pop    %rbp
+  803fe2:	c3                   	ret
+
+0000000000803fe3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fe3:	55                   	push   %rbp
+  803fe4:	48 89 e5             	mov    %rsp,%rbp
+  803fe7:	41 55                	push   %r13
+  803fe9:	41 54                	push   %r12
+  803feb:	53                   	push   %rbx
+  803fec:	48 83 ec 08          	sub    $0x8,%rsp
+  803ff0:	49 89 fc             	mov    %rdi,%r12
+  803ff3:	48 89 f7             	mov    %rsi,%rdi
+  803ff6:	48 89 d3             	mov    %rdx,%rbx
+  803ff9:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803ffc:	48 85 f6             	test   %rsi,%rsi
+  803fff:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804006:	00 00 00 
+  804009:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80400d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804012:	48 85 d2             	test   %rdx,%rdx
+  804015:	74 03                	je     80401a <ipc_recv+0x37>
+  804017:	48 8b 32             	mov    (%rdx),%rsi
+  80401a:	48 b8 52 06 80 00 00 	movabs $0x800652,%rax
+  804021:	00 00 00 
+  804024:	ff d0                	call   *%rax
+    if (errno) {
+  804026:	85 c0                	test   %eax,%eax
+  804028:	74 1c                	je     804046 <ipc_recv+0x63>
+        if (from_env_store)
+  80402a:	4d 85 e4             	test   %r12,%r12
+  80402d:	74 08                	je     804037 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80402f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804036:	00 
+
+        if (perm_store)
+  804037:	4d 85 ed             	test   %r13,%r13
+  80403a:	74 74                	je     8040b0 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80403c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804043:	00 
+  804044:	eb 6a                	jmp    8040b0 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804046:	4d 85 e4             	test   %r12,%r12
+  804049:	74 14                	je     80405f <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80404b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804052:	00 00 00 
+  804055:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80405b:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80405f:	48 85 db             	test   %rbx,%rbx
+  804062:	74 23                	je     804087 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804064:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80406b:	00 00 00 
+  80406e:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804074:	ba 00 00 00 00       	mov    $0x0,%edx
+  804079:	85 c9                	test   %ecx,%ecx
+  80407b:	74 07                	je     804084 <ipc_recv+0xa1>
+  80407d:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804084:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804087:	4d 85 ed             	test   %r13,%r13
+  80408a:	74 14                	je     8040a0 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80408c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804093:	00 00 00 
+  804096:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80409c:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8040a0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040a7:	00 00 00 
+  8040aa:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040b0:	48 83 c4 08          	add    $0x8,%rsp
+  8040b4:	5b                   	pop    %rbx
+  8040b5:	41 5c                	pop    %r12
+  8040b7:	41 5d                	pop    %r13
+  8040b9:	5d                   	pop    %rbp
+  8040ba:	c3                   	ret
+
+00000000008040bb <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040bb:	55                   	push   %rbp
+  8040bc:	48 89 e5             	mov    %rsp,%rbp
+  8040bf:	41 55                	push   %r13
+  8040c1:	41 54                	push   %r12
+  8040c3:	53                   	push   %rbx
+  8040c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8040c8:	49 89 fc             	mov    %rdi,%r12
+  8040cb:	48 89 f7             	mov    %rsi,%rdi
+  8040ce:	48 89 d3             	mov    %rdx,%rbx
+  8040d1:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040d4:	48 85 f6             	test   %rsi,%rsi
+  8040d7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040de:	00 00 00 
+  8040e1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040e5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040ea:	48 85 d2             	test   %rdx,%rdx
+  8040ed:	74 03                	je     8040f2 <ipc_try_recv+0x37>
+  8040ef:	48 8b 32             	mov    (%rdx),%rsi
+  8040f2:	48 b8 bb 06 80 00 00 	movabs $0x8006bb,%rax
+  8040f9:	00 00 00 
+  8040fc:	ff d0                	call   *%rax
+    if (errno) {
+  8040fe:	85 c0                	test   %eax,%eax
+  804100:	75 75                	jne    804177 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804102:	4d 85 e4             	test   %r12,%r12
+  804105:	74 14                	je     80411b <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804107:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80410e:	00 00 00 
+  804111:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804117:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80411b:	48 85 db             	test   %rbx,%rbx
+  80411e:	74 23                	je     804143 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804120:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804127:	00 00 00 
+  80412a:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804130:	ba 00 00 00 00       	mov    $0x0,%edx
+  804135:	85 c9                	test   %ecx,%ecx
+  804137:	74 07                	je     804140 <ipc_try_recv+0x85>
+  804139:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804140:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804143:	4d 85 ed             	test   %r13,%r13
+  804146:	74 14                	je     80415c <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804148:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80414f:	00 00 00 
+  804152:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804158:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80415c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804163:	00 00 00 
+  804166:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80416c:	48 83 c4 08          	add    $0x8,%rsp
+  804170:	5b                   	pop    %rbx
+  804171:	41 5c                	pop    %r12
+  804173:	41 5d                	pop    %r13
+  804175:	5d                   	pop    %rbp
+  804176:	c3                   	ret
+        if (from_env_store)
+  804177:	4d 85 e4             	test   %r12,%r12
+  80417a:	74 08                	je     804184 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80417c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804183:	00 
+        if (perm_store)
+  804184:	4d 85 ed             	test   %r13,%r13
+  804187:	74 e3                	je     80416c <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804189:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804190:	00 
+  804191:	eb d9                	jmp    80416c <ipc_try_recv+0xb1>
+
+0000000000804193 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804193:	55                   	push   %rbp
+  804194:	48 89 e5             	mov    %rsp,%rbp
+  804197:	41 57                	push   %r15
+  804199:	41 56                	push   %r14
+  80419b:	41 55                	push   %r13
+  80419d:	41 54                	push   %r12
+  80419f:	53                   	push   %rbx
+  8041a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8041a4:	41 89 fd             	mov    %edi,%r13d
+  8041a7:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8041aa:	48 89 d3             	mov    %rdx,%rbx
+  8041ad:	49 89 cc             	mov    %rcx,%r12
+  8041b0:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041b4:	48 85 d2             	test   %rdx,%rdx
+  8041b7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041be:	00 00 00 
+  8041c1:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041c5:	49 be 26 06 80 00 00 	movabs $0x800626,%r14
+  8041cc:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041cf:	49 bf 16 02 80 00 00 	movabs $0x800216,%r15
+  8041d6:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041d9:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041dc:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041e0:	4c 89 e1             	mov    %r12,%rcx
+  8041e3:	48 89 da             	mov    %rbx,%rdx
+  8041e6:	44 89 ef             	mov    %r13d,%edi
+  8041e9:	41 ff d6             	call   *%r14
+  8041ec:	85 c0                	test   %eax,%eax
+  8041ee:	74 37                	je     804227 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041f0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041f3:	75 05                	jne    8041fa <ipc_send+0x67>
+        sys_yield();
+  8041f5:	41 ff d7             	call   *%r15
+  8041f8:	eb df                	jmp    8041d9 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041fa:	89 c1                	mov    %eax,%ecx
+  8041fc:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  804203:	00 00 00 
+  804206:	be 65 00 00 00       	mov    $0x65,%esi
+  80420b:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  804212:	00 00 00 
+  804215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80421a:	49 b8 44 2f 80 00 00 	movabs $0x802f44,%r8
+  804221:	00 00 00 
+  804224:	41 ff d0             	call   *%r8
+    }
+}
+  804227:	48 83 c4 18          	add    $0x18,%rsp
+  80422b:	5b                   	pop    %rbx
+  80422c:	41 5c                	pop    %r12
+  80422e:	41 5d                	pop    %r13
+  804230:	41 5e                	pop    %r14
+  804232:	41 5f                	pop    %r15
+  804234:	5d                   	pop    %rbp
+  804235:	c3                   	ret
+
+0000000000804236 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804236:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80423b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804242:	00 00 00 
+  804245:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80424c:	48 01 ca             	add    %rcx,%rdx
+  80424f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804255:	39 fa                	cmp    %edi,%edx
+  804257:	74 12                	je     80426b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804259:	48 83 c0 01          	add    $0x1,%rax
+  80425d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804263:	75 e0                	jne    804245 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804265:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80426a:	c3                   	ret
+            return envs[i].env_id;
+  80426b:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804272:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804279:	00 00 00 
+  80427c:	48 01 d0             	add    %rdx,%rax
+  80427f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804285:	c3                   	ret
+
+0000000000804286 <__text_end>:
+  804286:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428d:	00 00 00 
+  804290:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804297:	00 00 00 
+  80429a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a1:	00 00 00 
+  8042a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ab:	00 00 00 
+  8042ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b5:	00 00 00 
+  8042b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042bf:	00 00 00 
+  8042c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c9:	00 00 00 
+  8042cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d3:	00 00 00 
+  8042d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042dd:	00 00 00 
+  8042e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e7:	00 00 00 
+  8042ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f1:	00 00 00 
+  8042f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fb:	00 00 00 
+  8042fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804305:	00 00 00 
+  804308:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430f:	00 00 00 
+  804312:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804319:	00 00 00 
+  80431c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804323:	00 00 00 
+  804326:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432d:	00 00 00 
+  804330:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804337:	00 00 00 
+  80433a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804341:	00 00 00 
+  804344:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434b:	00 00 00 
+  80434e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804355:	00 00 00 
+  804358:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435f:	00 00 00 
+  804362:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804369:	00 00 00 
+  80436c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804373:	00 00 00 
+  804376:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437d:	00 00 00 
+  804380:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804387:	00 00 00 
+  80438a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804391:	00 00 00 
+  804394:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439b:	00 00 00 
+  80439e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a5:	00 00 00 
+  8043a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043af:	00 00 00 
+  8043b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b9:	00 00 00 
+  8043bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c3:	00 00 00 
+  8043c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cd:	00 00 00 
+  8043d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d7:	00 00 00 
+  8043da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e1:	00 00 00 
+  8043e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043eb:	00 00 00 
+  8043ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f5:	00 00 00 
+  8043f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ff:	00 00 00 
+  804402:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804409:	00 00 00 
+  80440c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804413:	00 00 00 
+  804416:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441d:	00 00 00 
+  804420:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804427:	00 00 00 
+  80442a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804431:	00 00 00 
+  804434:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443b:	00 00 00 
+  80443e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804445:	00 00 00 
+  804448:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444f:	00 00 00 
+  804452:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804459:	00 00 00 
+  80445c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804463:	00 00 00 
+  804466:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446d:	00 00 00 
+  804470:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804477:	00 00 00 
+  80447a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804481:	00 00 00 
+  804484:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448b:	00 00 00 
+  80448e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804495:	00 00 00 
+  804498:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449f:	00 00 00 
+  8044a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a9:	00 00 00 
+  8044ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b3:	00 00 00 
+  8044b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bd:	00 00 00 
+  8044c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c7:	00 00 00 
+  8044ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d1:	00 00 00 
+  8044d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044db:	00 00 00 
+  8044de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e5:	00 00 00 
+  8044e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ef:	00 00 00 
+  8044f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f9:	00 00 00 
+  8044fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804503:	00 00 00 
+  804506:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450d:	00 00 00 
+  804510:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804517:	00 00 00 
+  80451a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804521:	00 00 00 
+  804524:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452b:	00 00 00 
+  80452e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804535:	00 00 00 
+  804538:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453f:	00 00 00 
+  804542:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804549:	00 00 00 
+  80454c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804553:	00 00 00 
+  804556:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455d:	00 00 00 
+  804560:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804567:	00 00 00 
+  80456a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804571:	00 00 00 
+  804574:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457b:	00 00 00 
+  80457e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804585:	00 00 00 
+  804588:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458f:	00 00 00 
+  804592:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804599:	00 00 00 
+  80459c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a3:	00 00 00 
+  8045a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ad:	00 00 00 
+  8045b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b7:	00 00 00 
+  8045ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c1:	00 00 00 
+  8045c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cb:	00 00 00 
+  8045ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d5:	00 00 00 
+  8045d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045df:	00 00 00 
+  8045e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e9:	00 00 00 
+  8045ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f3:	00 00 00 
+  8045f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fd:	00 00 00 
+  804600:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804607:	00 00 00 
+  80460a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804611:	00 00 00 
+  804614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461b:	00 00 00 
+  80461e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804625:	00 00 00 
+  804628:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462f:	00 00 00 
+  804632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804639:	00 00 00 
+  80463c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804643:	00 00 00 
+  804646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464d:	00 00 00 
+  804650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804657:	00 00 00 
+  80465a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804661:	00 00 00 
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467f:	00 00 00 
+  804682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804689:	00 00 00 
+  80468c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804693:	00 00 00 
+  804696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469d:	00 00 00 
+  8046a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a7:	00 00 00 
+  8046aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b1:	00 00 00 
+  8046b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bb:	00 00 00 
+  8046be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c5:	00 00 00 
+  8046c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cf:	00 00 00 
+  8046d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d9:	00 00 00 
+  8046dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e3:	00 00 00 
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
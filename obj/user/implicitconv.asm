@@ -0,0 +1,8111 @@
+
+obj/user/implicitconv:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 05 00 00 00       	call   800028 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <signed_impl_conv>:
+    a = 257;
+    char c = a;
+
+    (void)b;
+    (void)c;
+}
+  800025:	c3                   	ret
+
+0000000000800026 <unsigned_impl_conv>:
+unsigned_impl_conv() {
+    unsigned long long a = 400000000000;
+    unsigned int b = a;
+
+    (void)b;
+}
+  800026:	c3                   	ret
+
+0000000000800027 <umain>:
+
+void
+umain(int argc, char **argv) {
+    signed_impl_conv();
+    unsigned_impl_conv();
+}
+  800027:	c3                   	ret
+
+0000000000800028 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800028:	55                   	push   %rbp
+  800029:	48 89 e5             	mov    %rsp,%rbp
+  80002c:	41 56                	push   %r14
+  80002e:	41 55                	push   %r13
+  800030:	41 54                	push   %r12
+  800032:	53                   	push   %rbx
+  800033:	41 89 fd             	mov    %edi,%r13d
+  800036:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800039:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800040:	00 00 00 
+  800043:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80004a:	00 00 00 
+  80004d:	48 39 c2             	cmp    %rax,%rdx
+  800050:	73 17                	jae    800069 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800052:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800055:	49 89 c4             	mov    %rax,%r12
+  800058:	48 83 c3 08          	add    $0x8,%rbx
+  80005c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800061:	ff 53 f8             	call   *-0x8(%rbx)
+  800064:	4c 39 e3             	cmp    %r12,%rbx
+  800067:	72 ef                	jb     800058 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800069:	48 b8 bd 01 80 00 00 	movabs $0x8001bd,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007a:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800081:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800088:	00 00 00 
+  80008b:	48 01 d0             	add    %rdx,%rax
+  80008e:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800095:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800098:	45 85 ed             	test   %r13d,%r13d
+  80009b:	7e 0d                	jle    8000aa <libmain+0x82>
+  80009d:	49 8b 06             	mov    (%r14),%rax
+  8000a0:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000a7:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000aa:	4c 89 f6             	mov    %r14,%rsi
+  8000ad:	44 89 ef             	mov    %r13d,%edi
+  8000b0:	48 b8 27 00 80 00 00 	movabs $0x800027,%rax
+  8000b7:	00 00 00 
+  8000ba:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000bc:	48 b8 d1 00 80 00 00 	movabs $0x8000d1,%rax
+  8000c3:	00 00 00 
+  8000c6:	ff d0                	call   *%rax
+#endif
+}
+  8000c8:	5b                   	pop    %rbx
+  8000c9:	41 5c                	pop    %r12
+  8000cb:	41 5d                	pop    %r13
+  8000cd:	41 5e                	pop    %r14
+  8000cf:	5d                   	pop    %rbp
+  8000d0:	c3                   	ret
+
+00000000008000d1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d1:	55                   	push   %rbp
+  8000d2:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000d5:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  8000dc:	00 00 00 
+  8000df:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e6:	48 b8 52 01 80 00 00 	movabs $0x800152,%rax
+  8000ed:	00 00 00 
+  8000f0:	ff d0                	call   *%rax
+}
+  8000f2:	5d                   	pop    %rbp
+  8000f3:	c3                   	ret
+
+00000000008000f4 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f4:	55                   	push   %rbp
+  8000f5:	48 89 e5             	mov    %rsp,%rbp
+  8000f8:	53                   	push   %rbx
+  8000f9:	48 89 fa             	mov    %rdi,%rdx
+  8000fc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8000ff:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800104:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800109:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80010e:	be 00 00 00 00       	mov    $0x0,%esi
+  800113:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800119:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80011b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80011f:	c9                   	leave
+  800120:	c3                   	ret
+
+0000000000800121 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800121:	55                   	push   %rbp
+  800122:	48 89 e5             	mov    %rsp,%rbp
+  800125:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800126:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80012b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800130:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800135:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80013a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80013f:	be 00 00 00 00       	mov    $0x0,%esi
+  800144:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80014a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80014c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800150:	c9                   	leave
+  800151:	c3                   	ret
+
+0000000000800152 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800152:	55                   	push   %rbp
+  800153:	48 89 e5             	mov    %rsp,%rbp
+  800156:	53                   	push   %rbx
+  800157:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80015b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80015e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800163:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800168:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80016d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800172:	be 00 00 00 00       	mov    $0x0,%esi
+  800177:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80017d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80017f:	48 85 c0             	test   %rax,%rax
+  800182:	7f 06                	jg     80018a <sys_env_destroy+0x38>
+}
+  800184:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800188:	c9                   	leave
+  800189:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80018a:	49 89 c0             	mov    %rax,%r8
+  80018d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800192:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800199:	00 00 00 
+  80019c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8001a1:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8001a8:	00 00 00 
+  8001ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b0:	49 b9 1c 2f 80 00 00 	movabs $0x802f1c,%r9
+  8001b7:	00 00 00 
+  8001ba:	41 ff d1             	call   *%r9
+
+00000000008001bd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001bd:	55                   	push   %rbp
+  8001be:	48 89 e5             	mov    %rsp,%rbp
+  8001c1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001db:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001e6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ec:	c9                   	leave
+  8001ed:	c3                   	ret
+
+00000000008001ee <sys_yield>:
+
+void
+sys_yield(void) {
+  8001ee:	55                   	push   %rbp
+  8001ef:	48 89 e5             	mov    %rsp,%rbp
+  8001f2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800207:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80020c:	be 00 00 00 00       	mov    $0x0,%esi
+  800211:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800217:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800219:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80021d:	c9                   	leave
+  80021e:	c3                   	ret
+
+000000000080021f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80021f:	55                   	push   %rbp
+  800220:	48 89 e5             	mov    %rsp,%rbp
+  800223:	53                   	push   %rbx
+  800224:	48 89 fa             	mov    %rdi,%rdx
+  800227:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80022a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800236:	00 00 00 
+  800239:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80023e:	be 00 00 00 00       	mov    $0x0,%esi
+  800243:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800249:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80024b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80024f:	c9                   	leave
+  800250:	c3                   	ret
+
+0000000000800251 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800251:	55                   	push   %rbp
+  800252:	48 89 e5             	mov    %rsp,%rbp
+  800255:	53                   	push   %rbx
+  800256:	49 89 f8             	mov    %rdi,%r8
+  800259:	48 89 d3             	mov    %rdx,%rbx
+  80025c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80025f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800264:	4c 89 c2             	mov    %r8,%rdx
+  800267:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80026a:	be 00 00 00 00       	mov    $0x0,%esi
+  80026f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800275:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800277:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027b:	c9                   	leave
+  80027c:	c3                   	ret
+
+000000000080027d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80027d:	55                   	push   %rbp
+  80027e:	48 89 e5             	mov    %rsp,%rbp
+  800281:	53                   	push   %rbx
+  800282:	48 83 ec 08          	sub    $0x8,%rsp
+  800286:	89 f8                	mov    %edi,%eax
+  800288:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80028b:	48 63 f9             	movslq %ecx,%rdi
+  80028e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800291:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800296:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800299:	be 00 00 00 00       	mov    $0x0,%esi
+  80029e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002a6:	48 85 c0             	test   %rax,%rax
+  8002a9:	7f 06                	jg     8002b1 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002af:	c9                   	leave
+  8002b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b1:	49 89 c0             	mov    %rax,%r8
+  8002b4:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002b9:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8002c0:	00 00 00 
+  8002c3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002c8:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8002cf:	00 00 00 
+  8002d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d7:	49 b9 1c 2f 80 00 00 	movabs $0x802f1c,%r9
+  8002de:	00 00 00 
+  8002e1:	41 ff d1             	call   *%r9
+
+00000000008002e4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e4:	55                   	push   %rbp
+  8002e5:	48 89 e5             	mov    %rsp,%rbp
+  8002e8:	53                   	push   %rbx
+  8002e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ed:	89 f8                	mov    %edi,%eax
+  8002ef:	49 89 f2             	mov    %rsi,%r10
+  8002f2:	48 89 cf             	mov    %rcx,%rdi
+  8002f5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002f8:	48 63 da             	movslq %edx,%rbx
+  8002fb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002fe:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800303:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800306:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800309:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80030b:	48 85 c0             	test   %rax,%rax
+  80030e:	7f 06                	jg     800316 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800310:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800314:	c9                   	leave
+  800315:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800316:	49 89 c0             	mov    %rax,%r8
+  800319:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80031e:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800325:	00 00 00 
+  800328:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80032d:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800334:	00 00 00 
+  800337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033c:	49 b9 1c 2f 80 00 00 	movabs $0x802f1c,%r9
+  800343:	00 00 00 
+  800346:	41 ff d1             	call   *%r9
+
+0000000000800349 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800349:	55                   	push   %rbp
+  80034a:	48 89 e5             	mov    %rsp,%rbp
+  80034d:	53                   	push   %rbx
+  80034e:	48 83 ec 08          	sub    $0x8,%rsp
+  800352:	49 89 f9             	mov    %rdi,%r9
+  800355:	89 f0                	mov    %esi,%eax
+  800357:	48 89 d3             	mov    %rdx,%rbx
+  80035a:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80035d:	49 63 f0             	movslq %r8d,%rsi
+  800360:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800363:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800368:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80036b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800371:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800373:	48 85 c0             	test   %rax,%rax
+  800376:	7f 06                	jg     80037e <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800378:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80037c:	c9                   	leave
+  80037d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80037e:	49 89 c0             	mov    %rax,%r8
+  800381:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800386:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80038d:	00 00 00 
+  800390:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800395:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80039c:	00 00 00 
+  80039f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a4:	49 b9 1c 2f 80 00 00 	movabs $0x802f1c,%r9
+  8003ab:	00 00 00 
+  8003ae:	41 ff d1             	call   *%r9
+
+00000000008003b1 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8003b1:	55                   	push   %rbp
+  8003b2:	48 89 e5             	mov    %rsp,%rbp
+  8003b5:	53                   	push   %rbx
+  8003b6:	89 f8                	mov    %edi,%eax
+  8003b8:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8003bb:	48 63 f9             	movslq %ecx,%rdi
+  8003be:	48 63 da             	movslq %edx,%rbx
+  8003c1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8003c9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003d7:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8003d9:	89 c2                	mov    %eax,%edx
+  8003db:	48 85 c0             	test   %rax,%rax
+  8003de:	78 0d                	js     8003ed <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8003e0:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8003e5:	4d 85 c9             	test   %r9,%r9
+  8003e8:	74 03                	je     8003ed <sys_alloc_dma_region+0x3c>
+  8003ea:	49 89 01             	mov    %rax,(%r9)
+}
+  8003ed:	89 d0                	mov    %edx,%eax
+  8003ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003f3:	c9                   	leave
+  8003f4:	c3                   	ret
+
+00000000008003f5 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8003f5:	55                   	push   %rbp
+  8003f6:	48 89 e5             	mov    %rsp,%rbp
+  8003f9:	53                   	push   %rbx
+  8003fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8003fe:	48 89 f1             	mov    %rsi,%rcx
+  800401:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800404:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800407:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80040c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800411:	be 00 00 00 00       	mov    $0x0,%esi
+  800416:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80041c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80041e:	48 85 c0             	test   %rax,%rax
+  800421:	7f 06                	jg     800429 <sys_set_cache_region+0x34>
+}
+  800423:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800427:	c9                   	leave
+  800428:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800429:	49 89 c0             	mov    %rax,%r8
+  80042c:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800431:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800438:	00 00 00 
+  80043b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800440:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800447:	00 00 00 
+  80044a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044f:	49 b9 1c 2f 80 00 00 	movabs $0x802f1c,%r9
+  800456:	00 00 00 
+  800459:	41 ff d1             	call   *%r9
+
+000000000080045c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80045c:	55                   	push   %rbp
+  80045d:	48 89 e5             	mov    %rsp,%rbp
+  800460:	53                   	push   %rbx
+  800461:	48 83 ec 08          	sub    $0x8,%rsp
+  800465:	48 89 f1             	mov    %rsi,%rcx
+  800468:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80046b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80046e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800473:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800478:	be 00 00 00 00       	mov    $0x0,%esi
+  80047d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800483:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800485:	48 85 c0             	test   %rax,%rax
+  800488:	7f 06                	jg     800490 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80048a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80048e:	c9                   	leave
+  80048f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800490:	49 89 c0             	mov    %rax,%r8
+  800493:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800498:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80049f:	00 00 00 
+  8004a2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8004a7:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8004ae:	00 00 00 
+  8004b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b6:	49 b9 1c 2f 80 00 00 	movabs $0x802f1c,%r9
+  8004bd:	00 00 00 
+  8004c0:	41 ff d1             	call   *%r9
+
+00000000008004c3 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004c3:	55                   	push   %rbp
+  8004c4:	48 89 e5             	mov    %rsp,%rbp
+  8004c7:	53                   	push   %rbx
+  8004c8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8004cc:	48 63 ce             	movslq %esi,%rcx
+  8004cf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8004e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ee:	48 85 c0             	test   %rax,%rax
+  8004f1:	7f 06                	jg     8004f9 <sys_env_set_status+0x36>
+}
+  8004f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004f7:	c9                   	leave
+  8004f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004f9:	49 89 c0             	mov    %rax,%r8
+  8004fc:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  800501:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800508:	00 00 00 
+  80050b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800510:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800517:	00 00 00 
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	49 b9 1c 2f 80 00 00 	movabs $0x802f1c,%r9
+  800526:	00 00 00 
+  800529:	41 ff d1             	call   *%r9
+
+000000000080052c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80052c:	55                   	push   %rbp
+  80052d:	48 89 e5             	mov    %rsp,%rbp
+  800530:	53                   	push   %rbx
+  800531:	48 83 ec 08          	sub    $0x8,%rsp
+  800535:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800538:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80053b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800540:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800545:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80054a:	be 00 00 00 00       	mov    $0x0,%esi
+  80054f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800555:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800557:	48 85 c0             	test   %rax,%rax
+  80055a:	7f 06                	jg     800562 <sys_env_set_trapframe+0x36>
+}
+  80055c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800560:	c9                   	leave
+  800561:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800562:	49 89 c0             	mov    %rax,%r8
+  800565:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80056a:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  800571:	00 00 00 
+  800574:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800579:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800580:	00 00 00 
+  800583:	b8 00 00 00 00       	mov    $0x0,%eax
+  800588:	49 b9 1c 2f 80 00 00 	movabs $0x802f1c,%r9
+  80058f:	00 00 00 
+  800592:	41 ff d1             	call   *%r9
+
+0000000000800595 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800595:	55                   	push   %rbp
+  800596:	48 89 e5             	mov    %rsp,%rbp
+  800599:	53                   	push   %rbx
+  80059a:	48 83 ec 08          	sub    $0x8,%rsp
+  80059e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005a1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005a4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005c0:	48 85 c0             	test   %rax,%rax
+  8005c3:	7f 06                	jg     8005cb <sys_env_set_pgfault_upcall+0x36>
+}
+  8005c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005c9:	c9                   	leave
+  8005ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005cb:	49 89 c0             	mov    %rax,%r8
+  8005ce:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8005d3:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8005da:	00 00 00 
+  8005dd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8005e2:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8005e9:	00 00 00 
+  8005ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f1:	49 b9 1c 2f 80 00 00 	movabs $0x802f1c,%r9
+  8005f8:	00 00 00 
+  8005fb:	41 ff d1             	call   *%r9
+
+00000000008005fe <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8005fe:	55                   	push   %rbp
+  8005ff:	48 89 e5             	mov    %rsp,%rbp
+  800602:	53                   	push   %rbx
+  800603:	89 f8                	mov    %edi,%eax
+  800605:	49 89 f1             	mov    %rsi,%r9
+  800608:	48 89 d3             	mov    %rdx,%rbx
+  80060b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80060e:	49 63 f0             	movslq %r8d,%rsi
+  800611:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800614:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800619:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80061c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800622:	cd 30                	int    $0x30
+}
+  800624:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800628:	c9                   	leave
+  800629:	c3                   	ret
+
+000000000080062a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80062a:	55                   	push   %rbp
+  80062b:	48 89 e5             	mov    %rsp,%rbp
+  80062e:	53                   	push   %rbx
+  80062f:	48 83 ec 08          	sub    $0x8,%rsp
+  800633:	48 89 fa             	mov    %rdi,%rdx
+  800636:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800639:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80063e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800643:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800648:	be 00 00 00 00       	mov    $0x0,%esi
+  80064d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800653:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800655:	48 85 c0             	test   %rax,%rax
+  800658:	7f 06                	jg     800660 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80065a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80065e:	c9                   	leave
+  80065f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800660:	49 89 c0             	mov    %rax,%r8
+  800663:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800668:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  80066f:	00 00 00 
+  800672:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800677:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  80067e:	00 00 00 
+  800681:	b8 00 00 00 00       	mov    $0x0,%eax
+  800686:	49 b9 1c 2f 80 00 00 	movabs $0x802f1c,%r9
+  80068d:	00 00 00 
+  800690:	41 ff d1             	call   *%r9
+
+0000000000800693 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  800693:	55                   	push   %rbp
+  800694:	48 89 e5             	mov    %rsp,%rbp
+  800697:	53                   	push   %rbx
+  800698:	48 89 fa             	mov    %rdi,%rdx
+  80069b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80069e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006b8:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006be:	c9                   	leave
+  8006bf:	c3                   	ret
+
+00000000008006c0 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006c0:	55                   	push   %rbp
+  8006c1:	48 89 e5             	mov    %rsp,%rbp
+  8006c4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8006c5:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8006ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006de:	be 00 00 00 00       	mov    $0x0,%esi
+  8006e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006e9:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8006eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006ef:	c9                   	leave
+  8006f0:	c3                   	ret
+
+00000000008006f1 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8006f1:	48 85 ff             	test   %rdi,%rdi
+  8006f4:	0f 84 b6 01 00 00    	je     8008b0 <malloc+0x1bf>
+malloc(size_t size) {
+  8006fa:	55                   	push   %rbp
+  8006fb:	48 89 e5             	mov    %rsp,%rbp
+  8006fe:	41 56                	push   %r14
+  800700:	41 55                	push   %r13
+  800702:	41 54                	push   %r12
+  800704:	53                   	push   %rbx
+  800705:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  800708:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80070f:	00 00 00 
+  800712:	4c 8b 20             	mov    (%rax),%r12
+  800715:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80071c:	0f 87 94 01 00 00    	ja     8008b6 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  800722:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  800729:	00 00 00 
+  80072c:	48 85 c0             	test   %rax,%rax
+  80072f:	74 6b                	je     80079c <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  800731:	4d 85 e4             	test   %r12,%r12
+  800734:	74 66                	je     80079c <malloc+0xab>
+  800736:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80073d:	00 00 00 
+  800740:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800745:	eb 0d                	jmp    800754 <malloc+0x63>
+  800747:	48 83 c1 01          	add    $0x1,%rcx
+  80074b:	48 83 c2 18          	add    $0x18,%rdx
+  80074f:	49 39 cc             	cmp    %rcx,%r12
+  800752:	74 48                	je     80079c <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  800754:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  800759:	74 ec                	je     800747 <malloc+0x56>
+  80075b:	48 39 1a             	cmp    %rbx,(%rdx)
+  80075e:	72 e7                	jb     800747 <malloc+0x56>
+                real_freep_size--;
+  800760:	48 83 e8 01          	sub    $0x1,%rax
+  800764:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80076b:	00 00 00 
+                freep[i].is_free = false;
+  80076e:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800775:	00 00 00 
+  800778:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80077c:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  800780:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  800784:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  80078b:	00 
+                freep[i].size = size;
+  80078c:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  800790:	48 01 c8             	add    %rcx,%rax
+  800793:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800797:	e9 0b 01 00 00       	jmp    8008a7 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  80079c:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8007a3:	00 00 00 
+  8007a6:	48 01 d8             	add    %rbx,%rax
+  8007a9:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8007af:	76 7c                	jbe    80082d <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8007b1:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8007b8:	00 00 00 
+  8007bb:	4c 8b 30             	mov    (%rax),%r14
+  8007be:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8007c5:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8007c8:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8007cf:	00 00 00 
+  8007d2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8007d9:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8007e0:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8007e6:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8007ea:	48 b8 bd 01 80 00 00 	movabs $0x8001bd,%rax
+  8007f1:	00 00 00 
+  8007f4:	ff d0                	call   *%rax
+  8007f6:	89 c7                	mov    %eax,%edi
+  8007f8:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8007ff:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  800806:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80080d:	00 00 00 
+  800810:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  800814:	b9 26 00 00 00       	mov    $0x26,%ecx
+  800819:	48 b8 7d 02 80 00 00 	movabs $0x80027d,%rax
+  800820:	00 00 00 
+  800823:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  800825:	85 c0                	test   %eax,%eax
+  800827:	0f 88 90 00 00 00    	js     8008bd <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80082d:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  800834:	00 00 00 
+  800837:	48 8b 31             	mov    (%rcx),%rsi
+  80083a:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  800841:	00 00 00 
+  800844:	4c 8b 07             	mov    (%rdi),%r8
+  800847:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80084b:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  800852:	00 00 00 
+  800855:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  800859:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80085d:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800864:	00 00 00 
+  800867:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80086b:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80086e:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  800872:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  800879:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  80087a:	48 89 d8             	mov    %rbx,%rax
+  80087d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800882:	4c 01 c0             	add    %r8,%rax
+  800885:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  800888:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80088f:	48 01 f3             	add    %rsi,%rbx
+  800892:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  800895:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  80089a:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8008a1:	00 00 00 
+  8008a4:	48 89 d0             	mov    %rdx,%rax
+}
+  8008a7:	5b                   	pop    %rbx
+  8008a8:	41 5c                	pop    %r12
+  8008aa:	41 5d                	pop    %r13
+  8008ac:	41 5e                	pop    %r14
+  8008ae:	5d                   	pop    %rbp
+  8008af:	c3                   	ret
+        return NULL;
+  8008b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008b5:	c3                   	ret
+        return NULL;
+  8008b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bb:	eb ea                	jmp    8008a7 <malloc+0x1b6>
+            return NULL;
+  8008bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c2:	eb e3                	jmp    8008a7 <malloc+0x1b6>
+
+00000000008008c4 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8008c4:	55                   	push   %rbp
+  8008c5:	48 89 e5             	mov    %rsp,%rbp
+  8008c8:	53                   	push   %rbx
+  8008c9:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8008cd:	48 89 fb             	mov    %rdi,%rbx
+  8008d0:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8008d4:	48 89 df             	mov    %rbx,%rdi
+  8008d7:	48 b8 f1 06 80 00 00 	movabs $0x8006f1,%rax
+  8008de:	00 00 00 
+  8008e1:	ff d0                	call   *%rax
+  8008e3:	48 89 c7             	mov    %rax,%rdi
+  8008e6:	48 89 da             	mov    %rbx,%rdx
+  8008e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8008ee:	48 b8 c4 3c 80 00 00 	movabs $0x803cc4,%rax
+  8008f5:	00 00 00 
+  8008f8:	ff d0                	call   *%rax
+}
+  8008fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008fe:	c9                   	leave
+  8008ff:	c3                   	ret
+
+0000000000800900 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  800900:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  800907:	00 00 00 
+  80090a:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  800911:	00 00 00 
+  800914:	48 3b 02             	cmp    (%rdx),%rax
+  800917:	74 4d                	je     800966 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  800919:	48 85 c0             	test   %rax,%rax
+  80091c:	74 4d                	je     80096b <get_allocsize+0x6b>
+  80091e:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  800925:	00 00 00 
+  800928:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80092d:	48 3b 39             	cmp    (%rcx),%rdi
+  800930:	74 13                	je     800945 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  800932:	48 83 c2 01          	add    $0x1,%rdx
+  800936:	48 83 c1 18          	add    $0x18,%rcx
+  80093a:	48 39 d0             	cmp    %rdx,%rax
+  80093d:	75 ee                	jne    80092d <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  80093f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800944:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  800945:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094e:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800955:	00 00 00 
+  800958:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80095e:	75 0b                	jne    80096b <get_allocsize+0x6b>
+  800960:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  800965:	c3                   	ret
+        return 0;
+  800966:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096b:	c3                   	ret
+
+000000000080096c <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80096c:	48 85 ff             	test   %rdi,%rdi
+  80096f:	0f 84 01 01 00 00    	je     800a76 <free+0x10a>
+free(void *ptr) {
+  800975:	55                   	push   %rbp
+  800976:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  800979:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  800980:	00 00 00 
+  800983:	48 8b 30             	mov    (%rax),%rsi
+  800986:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80098d:	00 00 00 
+  800990:	48 39 c6             	cmp    %rax,%rsi
+  800993:	74 50                	je     8009e5 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  800995:	48 85 f6             	test   %rsi,%rsi
+  800998:	74 21                	je     8009bb <free+0x4f>
+  80099a:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8009a1:	00 00 00 
+  8009a4:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8009a9:	48 3b 39             	cmp    (%rcx),%rdi
+  8009ac:	74 61                	je     800a0f <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8009ae:	48 83 c2 01          	add    $0x1,%rdx
+  8009b2:	48 83 c1 18          	add    $0x18,%rcx
+  8009b6:	48 39 d6             	cmp    %rdx,%rsi
+  8009b9:	75 ee                	jne    8009a9 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8009bb:	48 ba 80 50 80 00 00 	movabs $0x805080,%rdx
+  8009c2:	00 00 00 
+  8009c5:	be 12 01 00 00       	mov    $0x112,%esi
+  8009ca:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009d1:	00 00 00 
+  8009d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d9:	48 b9 1c 2f 80 00 00 	movabs $0x802f1c,%rcx
+  8009e0:	00 00 00 
+  8009e3:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  8009e5:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  8009ec:	00 00 00 
+  8009ef:	be 06 01 00 00       	mov    $0x106,%esi
+  8009f4:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  8009fb:	00 00 00 
+  8009fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a03:	48 b9 1c 2f 80 00 00 	movabs $0x802f1c,%rcx
+  800a0a:	00 00 00 
+  800a0d:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  800a0f:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a13:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  800a1a:	00 00 00 
+  800a1d:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  800a23:	75 27                	jne    800a4c <free+0xe0>
+            freep[i].is_free = true;
+  800a25:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  800a29:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  800a30:	00 00 00 
+  800a33:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  800a3a:	00 00 
+            real_freep_size++;
+  800a3c:	48 83 c0 01          	add    $0x1,%rax
+  800a40:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  800a47:	00 00 00 
+}
+  800a4a:	5d                   	pop    %rbp
+  800a4b:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  800a4c:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  800a53:	00 00 00 
+  800a56:	be 0b 01 00 00       	mov    $0x10b,%esi
+  800a5b:	48 bf a8 50 80 00 00 	movabs $0x8050a8,%rdi
+  800a62:	00 00 00 
+  800a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6a:	48 b9 1c 2f 80 00 00 	movabs $0x802f1c,%rcx
+  800a71:	00 00 00 
+  800a74:	ff d1                	call   *%rcx
+  800a76:	c3                   	ret
+
+0000000000800a77 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  800a77:	55                   	push   %rbp
+  800a78:	48 89 e5             	mov    %rsp,%rbp
+  800a7b:	41 55                	push   %r13
+  800a7d:	41 54                	push   %r12
+  800a7f:	53                   	push   %rbx
+  800a80:	48 83 ec 08          	sub    $0x8,%rsp
+  800a84:	48 89 fb             	mov    %rdi,%rbx
+  800a87:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  800a8a:	48 b8 00 09 80 00 00 	movabs $0x800900,%rax
+  800a91:	00 00 00 
+  800a94:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  800a96:	49 39 c5             	cmp    %rax,%r13
+  800a99:	73 0e                	jae    800aa9 <realloc+0x32>
+}
+  800a9b:	48 89 d8             	mov    %rbx,%rax
+  800a9e:	48 83 c4 08          	add    $0x8,%rsp
+  800aa2:	5b                   	pop    %rbx
+  800aa3:	41 5c                	pop    %r12
+  800aa5:	41 5d                	pop    %r13
+  800aa7:	5d                   	pop    %rbp
+  800aa8:	c3                   	ret
+  800aa9:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  800aac:	4c 89 ef             	mov    %r13,%rdi
+  800aaf:	48 b8 f1 06 80 00 00 	movabs $0x8006f1,%rax
+  800ab6:	00 00 00 
+  800ab9:	ff d0                	call   *%rax
+  800abb:	48 89 c7             	mov    %rax,%rdi
+  800abe:	4c 89 e2             	mov    %r12,%rdx
+  800ac1:	48 89 de             	mov    %rbx,%rsi
+  800ac4:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  800acb:	00 00 00 
+  800ace:	ff d0                	call   *%rax
+  800ad0:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  800ad3:	48 89 df             	mov    %rbx,%rdi
+  800ad6:	48 b8 6c 09 80 00 00 	movabs $0x80096c,%rax
+  800add:	00 00 00 
+  800ae0:	ff d0                	call   *%rax
+    return newptr;
+  800ae2:	4c 89 e3             	mov    %r12,%rbx
+  800ae5:	eb b4                	jmp    800a9b <realloc+0x24>
+
+0000000000800ae7 <strdup>:
+
+char*
+strdup (const char *src) {
+  800ae7:	55                   	push   %rbp
+  800ae8:	48 89 e5             	mov    %rsp,%rbp
+  800aeb:	41 54                	push   %r12
+  800aed:	53                   	push   %rbx
+  800aee:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  800af1:	48 b8 a6 39 80 00 00 	movabs $0x8039a6,%rax
+  800af8:	00 00 00 
+  800afb:	ff d0                	call   *%rax
+  800afd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  800b01:	4c 89 e7             	mov    %r12,%rdi
+  800b04:	48 b8 f1 06 80 00 00 	movabs $0x8006f1,%rax
+  800b0b:	00 00 00 
+  800b0e:	ff d0                	call   *%rax
+  800b10:	48 89 c7             	mov    %rax,%rdi
+  800b13:	4c 89 e2             	mov    %r12,%rdx
+  800b16:	48 89 de             	mov    %rbx,%rsi
+  800b19:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  800b20:	00 00 00 
+  800b23:	ff d0                	call   *%rax
+}
+  800b25:	5b                   	pop    %rbx
+  800b26:	41 5c                	pop    %r12
+  800b28:	5d                   	pop    %rbp
+  800b29:	c3                   	ret
+
+0000000000800b2a <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  800b2a:	55                   	push   %rbp
+  800b2b:	48 89 e5             	mov    %rsp,%rbp
+  800b2e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800b2f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800b34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b39:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800b3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b43:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800b48:	be 00 00 00 00       	mov    $0x0,%esi
+  800b4d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800b53:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  800b55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800b59:	c9                   	leave
+  800b5a:	c3                   	ret
+
+0000000000800b5b <get_ticks>:
+
+uint64_t
+get_ticks() {
+  800b5b:	55                   	push   %rbp
+  800b5c:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  800b5f:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800b66:	00 00 00 
+  800b69:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800b6d:	74 26                	je     800b95 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800b6f:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800b71:	48 c1 e2 20          	shl    $0x20,%rdx
+  800b75:	89 c0                	mov    %eax,%eax
+  800b77:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  800b7a:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  800b81:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  800b88:	00 00 00 
+  800b8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b90:	48 f7 31             	divq   (%rcx)
+}
+  800b93:	5d                   	pop    %rbp
+  800b94:	c3                   	ret
+        freq = get_cpufreq();
+  800b95:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9a:	48 ba 2a 0b 80 00 00 	movabs $0x800b2a,%rdx
+  800ba1:	00 00 00 
+  800ba4:	ff d2                	call   *%rdx
+  800ba6:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800bad:	00 00 00 
+  800bb0:	eb bd                	jmp    800b6f <get_ticks+0x14>
+
+0000000000800bb2 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  800bb2:	55                   	push   %rbp
+  800bb3:	48 89 e5             	mov    %rsp,%rbp
+  800bb6:	53                   	push   %rbx
+  800bb7:	48 83 ec 08          	sub    $0x8,%rsp
+  800bbb:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  800bbe:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800bc5:	00 00 00 
+  800bc8:	48 83 38 00          	cmpq   $0x0,(%rax)
+  800bcc:	74 50                	je     800c1e <sleep+0x6c>
+    asm volatile("rdtsc"
+  800bce:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800bd0:	48 c1 e2 20          	shl    $0x20,%rdx
+  800bd4:	89 c0                	mov    %eax,%eax
+  800bd6:	48 89 d6             	mov    %rdx,%rsi
+  800bd9:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  800bdc:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  800be3:	00 00 00 
+  800be6:	48 0f af 18          	imul   (%rax),%rbx
+  800bea:	48 c1 eb 03          	shr    $0x3,%rbx
+  800bee:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800bf5:	9b c4 20 
+  800bf8:	48 89 d8             	mov    %rbx,%rax
+  800bfb:	48 f7 e2             	mul    %rdx
+  800bfe:	48 89 d1             	mov    %rdx,%rcx
+  800c01:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  800c05:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800c07:	48 c1 e2 20          	shl    $0x20,%rdx
+  800c0b:	89 c0                	mov    %eax,%eax
+  800c0d:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  800c10:	48 29 f2             	sub    %rsi,%rdx
+  800c13:	48 39 ca             	cmp    %rcx,%rdx
+  800c16:	72 ed                	jb     800c05 <sleep+0x53>
+}
+  800c18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c1c:	c9                   	leave
+  800c1d:	c3                   	ret
+        freq = get_cpufreq();
+  800c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c23:	48 ba 2a 0b 80 00 00 	movabs $0x800b2a,%rdx
+  800c2a:	00 00 00 
+  800c2d:	ff d2                	call   *%rdx
+  800c2f:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  800c36:	00 00 00 
+  800c39:	eb 93                	jmp    800bce <sleep+0x1c>
+
+0000000000800c3b <poll_kbd>:
+
+int poll_kbd() {
+  800c3b:	55                   	push   %rbp
+  800c3c:	48 89 e5             	mov    %rsp,%rbp
+  800c3f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c40:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c54:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c59:	be 00 00 00 00       	mov    $0x0,%esi
+  800c5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c64:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c6a:	c9                   	leave
+  800c6b:	c3                   	ret
+
+0000000000800c6c <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  800c6c:	55                   	push   %rbp
+  800c6d:	48 89 e5             	mov    %rsp,%rbp
+  800c70:	53                   	push   %rbx
+  800c71:	49 89 fa             	mov    %rdi,%r10
+  800c74:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  800c76:	44 89 c6             	mov    %r8d,%esi
+  800c79:	89 cf                	mov    %ecx,%edi
+  800c7b:	89 d3                	mov    %edx,%ebx
+  800c7d:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  800c7f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c84:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c87:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  800c8b:	cd 30                	int    $0x30
+  800c8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c91:	c9                   	leave
+  800c92:	c3                   	ret
+
+0000000000800c93 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800c93:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800c9a:	ff ff ff 
+  800c9d:	48 01 f8             	add    %rdi,%rax
+  800ca0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800ca4:	c3                   	ret
+
+0000000000800ca5 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800ca5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800cac:	ff ff ff 
+  800caf:	48 01 f8             	add    %rdi,%rax
+  800cb2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800cb6:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800cbc:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800cc0:	c3                   	ret
+
+0000000000800cc1 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800cc1:	55                   	push   %rbp
+  800cc2:	48 89 e5             	mov    %rsp,%rbp
+  800cc5:	41 57                	push   %r15
+  800cc7:	41 56                	push   %r14
+  800cc9:	41 55                	push   %r13
+  800ccb:	41 54                	push   %r12
+  800ccd:	53                   	push   %rbx
+  800cce:	48 83 ec 08          	sub    $0x8,%rsp
+  800cd2:	49 89 ff             	mov    %rdi,%r15
+  800cd5:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800cda:	49 bd 75 2b 80 00 00 	movabs $0x802b75,%r13
+  800ce1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800ce4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800cea:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800ced:	48 89 df             	mov    %rbx,%rdi
+  800cf0:	41 ff d5             	call   *%r13
+  800cf3:	83 e0 04             	and    $0x4,%eax
+  800cf6:	74 17                	je     800d0f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800cf8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800cff:	4c 39 f3             	cmp    %r14,%rbx
+  800d02:	75 e6                	jne    800cea <fd_alloc+0x29>
+  800d04:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800d0a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800d0f:	4d 89 27             	mov    %r12,(%r15)
+}
+  800d12:	48 83 c4 08          	add    $0x8,%rsp
+  800d16:	5b                   	pop    %rbx
+  800d17:	41 5c                	pop    %r12
+  800d19:	41 5d                	pop    %r13
+  800d1b:	41 5e                	pop    %r14
+  800d1d:	41 5f                	pop    %r15
+  800d1f:	5d                   	pop    %rbp
+  800d20:	c3                   	ret
+
+0000000000800d21 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800d21:	83 ff 1f             	cmp    $0x1f,%edi
+  800d24:	77 39                	ja     800d5f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800d26:	55                   	push   %rbp
+  800d27:	48 89 e5             	mov    %rsp,%rbp
+  800d2a:	41 54                	push   %r12
+  800d2c:	53                   	push   %rbx
+  800d2d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800d30:	48 63 df             	movslq %edi,%rbx
+  800d33:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800d3a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800d3e:	48 89 df             	mov    %rbx,%rdi
+  800d41:	48 b8 75 2b 80 00 00 	movabs $0x802b75,%rax
+  800d48:	00 00 00 
+  800d4b:	ff d0                	call   *%rax
+  800d4d:	a8 04                	test   $0x4,%al
+  800d4f:	74 14                	je     800d65 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800d51:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800d55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d5a:	5b                   	pop    %rbx
+  800d5b:	41 5c                	pop    %r12
+  800d5d:	5d                   	pop    %rbp
+  800d5e:	c3                   	ret
+        return -E_INVAL;
+  800d5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d64:	c3                   	ret
+        return -E_INVAL;
+  800d65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d6a:	eb ee                	jmp    800d5a <fd_lookup+0x39>
+
+0000000000800d6c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d6c:	55                   	push   %rbp
+  800d6d:	48 89 e5             	mov    %rsp,%rbp
+  800d70:	41 54                	push   %r12
+  800d72:	53                   	push   %rbx
+  800d73:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800d76:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  800d7d:	00 00 00 
+  800d80:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  800d87:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800d8a:	39 3b                	cmp    %edi,(%rbx)
+  800d8c:	74 47                	je     800dd5 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800d8e:	48 83 c0 08          	add    $0x8,%rax
+  800d92:	48 8b 18             	mov    (%rax),%rbx
+  800d95:	48 85 db             	test   %rbx,%rbx
+  800d98:	75 f0                	jne    800d8a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800d9a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800da1:	00 00 00 
+  800da4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800daa:	89 fa                	mov    %edi,%edx
+  800dac:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  800db3:	00 00 00 
+  800db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbb:	48 b9 6c 30 80 00 00 	movabs $0x80306c,%rcx
+  800dc2:	00 00 00 
+  800dc5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800dc7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800dcc:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800dd0:	5b                   	pop    %rbx
+  800dd1:	41 5c                	pop    %r12
+  800dd3:	5d                   	pop    %rbp
+  800dd4:	c3                   	ret
+            return 0;
+  800dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dda:	eb f0                	jmp    800dcc <dev_lookup+0x60>
+
+0000000000800ddc <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800ddc:	55                   	push   %rbp
+  800ddd:	48 89 e5             	mov    %rsp,%rbp
+  800de0:	41 55                	push   %r13
+  800de2:	41 54                	push   %r12
+  800de4:	53                   	push   %rbx
+  800de5:	48 83 ec 18          	sub    $0x18,%rsp
+  800de9:	48 89 fb             	mov    %rdi,%rbx
+  800dec:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800def:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800df6:	ff ff ff 
+  800df9:	48 01 df             	add    %rbx,%rdi
+  800dfc:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800e00:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800e04:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  800e0b:	00 00 00 
+  800e0e:	ff d0                	call   *%rax
+  800e10:	41 89 c5             	mov    %eax,%r13d
+  800e13:	85 c0                	test   %eax,%eax
+  800e15:	78 06                	js     800e1d <fd_close+0x41>
+  800e17:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800e1b:	74 1a                	je     800e37 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800e1d:	45 84 e4             	test   %r12b,%r12b
+  800e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e25:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800e29:	44 89 e8             	mov    %r13d,%eax
+  800e2c:	48 83 c4 18          	add    $0x18,%rsp
+  800e30:	5b                   	pop    %rbx
+  800e31:	41 5c                	pop    %r12
+  800e33:	41 5d                	pop    %r13
+  800e35:	5d                   	pop    %rbp
+  800e36:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800e37:	8b 3b                	mov    (%rbx),%edi
+  800e39:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e3d:	48 b8 6c 0d 80 00 00 	movabs $0x800d6c,%rax
+  800e44:	00 00 00 
+  800e47:	ff d0                	call   *%rax
+  800e49:	41 89 c5             	mov    %eax,%r13d
+  800e4c:	85 c0                	test   %eax,%eax
+  800e4e:	78 1b                	js     800e6b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800e50:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e54:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800e58:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e5e:	48 85 c0             	test   %rax,%rax
+  800e61:	74 08                	je     800e6b <fd_close+0x8f>
+  800e63:	48 89 df             	mov    %rbx,%rdi
+  800e66:	ff d0                	call   *%rax
+  800e68:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800e6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800e70:	48 89 de             	mov    %rbx,%rsi
+  800e73:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e78:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  800e7f:	00 00 00 
+  800e82:	ff d0                	call   *%rax
+    return res;
+  800e84:	eb a3                	jmp    800e29 <fd_close+0x4d>
+
+0000000000800e86 <close>:
+
+int
+close(int fdnum) {
+  800e86:	55                   	push   %rbp
+  800e87:	48 89 e5             	mov    %rsp,%rbp
+  800e8a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800e8e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800e92:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  800e99:	00 00 00 
+  800e9c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800e9e:	85 c0                	test   %eax,%eax
+  800ea0:	78 15                	js     800eb7 <close+0x31>
+
+    return fd_close(fd, 1);
+  800ea2:	be 01 00 00 00       	mov    $0x1,%esi
+  800ea7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800eab:	48 b8 dc 0d 80 00 00 	movabs $0x800ddc,%rax
+  800eb2:	00 00 00 
+  800eb5:	ff d0                	call   *%rax
+}
+  800eb7:	c9                   	leave
+  800eb8:	c3                   	ret
+
+0000000000800eb9 <close_all>:
+
+void
+close_all(void) {
+  800eb9:	55                   	push   %rbp
+  800eba:	48 89 e5             	mov    %rsp,%rbp
+  800ebd:	41 54                	push   %r12
+  800ebf:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800ec0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec5:	49 bc 86 0e 80 00 00 	movabs $0x800e86,%r12
+  800ecc:	00 00 00 
+  800ecf:	89 df                	mov    %ebx,%edi
+  800ed1:	41 ff d4             	call   *%r12
+  800ed4:	83 c3 01             	add    $0x1,%ebx
+  800ed7:	83 fb 20             	cmp    $0x20,%ebx
+  800eda:	75 f3                	jne    800ecf <close_all+0x16>
+}
+  800edc:	5b                   	pop    %rbx
+  800edd:	41 5c                	pop    %r12
+  800edf:	5d                   	pop    %rbp
+  800ee0:	c3                   	ret
+
+0000000000800ee1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800ee1:	55                   	push   %rbp
+  800ee2:	48 89 e5             	mov    %rsp,%rbp
+  800ee5:	41 57                	push   %r15
+  800ee7:	41 56                	push   %r14
+  800ee9:	41 55                	push   %r13
+  800eeb:	41 54                	push   %r12
+  800eed:	53                   	push   %rbx
+  800eee:	48 83 ec 18          	sub    $0x18,%rsp
+  800ef2:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800ef5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800ef9:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  800f00:	00 00 00 
+  800f03:	ff d0                	call   *%rax
+  800f05:	89 c3                	mov    %eax,%ebx
+  800f07:	85 c0                	test   %eax,%eax
+  800f09:	0f 88 b8 00 00 00    	js     800fc7 <dup+0xe6>
+    close(newfdnum);
+  800f0f:	44 89 e7             	mov    %r12d,%edi
+  800f12:	48 b8 86 0e 80 00 00 	movabs $0x800e86,%rax
+  800f19:	00 00 00 
+  800f1c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800f1e:	4d 63 ec             	movslq %r12d,%r13
+  800f21:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800f28:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800f2c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800f30:	4c 89 ff             	mov    %r15,%rdi
+  800f33:	49 be a5 0c 80 00 00 	movabs $0x800ca5,%r14
+  800f3a:	00 00 00 
+  800f3d:	41 ff d6             	call   *%r14
+  800f40:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800f43:	4c 89 ef             	mov    %r13,%rdi
+  800f46:	41 ff d6             	call   *%r14
+  800f49:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800f4c:	48 89 df             	mov    %rbx,%rdi
+  800f4f:	48 b8 75 2b 80 00 00 	movabs $0x802b75,%rax
+  800f56:	00 00 00 
+  800f59:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800f5b:	a8 04                	test   $0x4,%al
+  800f5d:	74 2b                	je     800f8a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800f5f:	41 89 c1             	mov    %eax,%r9d
+  800f62:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800f68:	4c 89 f1             	mov    %r14,%rcx
+  800f6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f70:	48 89 de             	mov    %rbx,%rsi
+  800f73:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f78:	48 b8 e4 02 80 00 00 	movabs $0x8002e4,%rax
+  800f7f:	00 00 00 
+  800f82:	ff d0                	call   *%rax
+  800f84:	89 c3                	mov    %eax,%ebx
+  800f86:	85 c0                	test   %eax,%eax
+  800f88:	78 4e                	js     800fd8 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800f8a:	4c 89 ff             	mov    %r15,%rdi
+  800f8d:	48 b8 75 2b 80 00 00 	movabs $0x802b75,%rax
+  800f94:	00 00 00 
+  800f97:	ff d0                	call   *%rax
+  800f99:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800f9c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800fa2:	4c 89 e9             	mov    %r13,%rcx
+  800fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800faa:	4c 89 fe             	mov    %r15,%rsi
+  800fad:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fb2:	48 b8 e4 02 80 00 00 	movabs $0x8002e4,%rax
+  800fb9:	00 00 00 
+  800fbc:	ff d0                	call   *%rax
+  800fbe:	89 c3                	mov    %eax,%ebx
+  800fc0:	85 c0                	test   %eax,%eax
+  800fc2:	78 14                	js     800fd8 <dup+0xf7>
+
+    return newfdnum;
+  800fc4:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800fc7:	89 d8                	mov    %ebx,%eax
+  800fc9:	48 83 c4 18          	add    $0x18,%rsp
+  800fcd:	5b                   	pop    %rbx
+  800fce:	41 5c                	pop    %r12
+  800fd0:	41 5d                	pop    %r13
+  800fd2:	41 5e                	pop    %r14
+  800fd4:	41 5f                	pop    %r15
+  800fd6:	5d                   	pop    %rbp
+  800fd7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800fd8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800fdd:	4c 89 ee             	mov    %r13,%rsi
+  800fe0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe5:	49 bc 5c 04 80 00 00 	movabs $0x80045c,%r12
+  800fec:	00 00 00 
+  800fef:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800ff2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ff7:	4c 89 f6             	mov    %r14,%rsi
+  800ffa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fff:	41 ff d4             	call   *%r12
+    return res;
+  801002:	eb c3                	jmp    800fc7 <dup+0xe6>
+
+0000000000801004 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801004:	55                   	push   %rbp
+  801005:	48 89 e5             	mov    %rsp,%rbp
+  801008:	41 56                	push   %r14
+  80100a:	41 55                	push   %r13
+  80100c:	41 54                	push   %r12
+  80100e:	53                   	push   %rbx
+  80100f:	48 83 ec 10          	sub    $0x10,%rsp
+  801013:	89 fb                	mov    %edi,%ebx
+  801015:	49 89 f4             	mov    %rsi,%r12
+  801018:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80101b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80101f:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  801026:	00 00 00 
+  801029:	ff d0                	call   *%rax
+  80102b:	85 c0                	test   %eax,%eax
+  80102d:	78 4c                	js     80107b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80102f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801033:	41 8b 3e             	mov    (%r14),%edi
+  801036:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80103a:	48 b8 6c 0d 80 00 00 	movabs $0x800d6c,%rax
+  801041:	00 00 00 
+  801044:	ff d0                	call   *%rax
+  801046:	85 c0                	test   %eax,%eax
+  801048:	78 35                	js     80107f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80104a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80104e:	83 e0 03             	and    $0x3,%eax
+  801051:	83 f8 01             	cmp    $0x1,%eax
+  801054:	74 2d                	je     801083 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801056:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80105a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80105e:	48 85 c0             	test   %rax,%rax
+  801061:	74 56                	je     8010b9 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801063:	4c 89 ea             	mov    %r13,%rdx
+  801066:	4c 89 e6             	mov    %r12,%rsi
+  801069:	4c 89 f7             	mov    %r14,%rdi
+  80106c:	ff d0                	call   *%rax
+}
+  80106e:	48 83 c4 10          	add    $0x10,%rsp
+  801072:	5b                   	pop    %rbx
+  801073:	41 5c                	pop    %r12
+  801075:	41 5d                	pop    %r13
+  801077:	41 5e                	pop    %r14
+  801079:	5d                   	pop    %rbp
+  80107a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80107b:	48 98                	cltq
+  80107d:	eb ef                	jmp    80106e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80107f:	48 98                	cltq
+  801081:	eb eb                	jmp    80106e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801083:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80108a:	00 00 00 
+  80108d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801093:	89 da                	mov    %ebx,%edx
+  801095:	48 bf f9 50 80 00 00 	movabs $0x8050f9,%rdi
+  80109c:	00 00 00 
+  80109f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a4:	48 b9 6c 30 80 00 00 	movabs $0x80306c,%rcx
+  8010ab:	00 00 00 
+  8010ae:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8010b0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8010b7:	eb b5                	jmp    80106e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8010b9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8010c0:	eb ac                	jmp    80106e <read+0x6a>
+
+00000000008010c2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8010c2:	55                   	push   %rbp
+  8010c3:	48 89 e5             	mov    %rsp,%rbp
+  8010c6:	41 57                	push   %r15
+  8010c8:	41 56                	push   %r14
+  8010ca:	41 55                	push   %r13
+  8010cc:	41 54                	push   %r12
+  8010ce:	53                   	push   %rbx
+  8010cf:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8010d3:	48 85 d2             	test   %rdx,%rdx
+  8010d6:	74 54                	je     80112c <readn+0x6a>
+  8010d8:	41 89 fd             	mov    %edi,%r13d
+  8010db:	49 89 f6             	mov    %rsi,%r14
+  8010de:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8010e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8010e6:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8010eb:	49 bf 04 10 80 00 00 	movabs $0x801004,%r15
+  8010f2:	00 00 00 
+  8010f5:	4c 89 e2             	mov    %r12,%rdx
+  8010f8:	48 29 f2             	sub    %rsi,%rdx
+  8010fb:	4c 01 f6             	add    %r14,%rsi
+  8010fe:	44 89 ef             	mov    %r13d,%edi
+  801101:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801104:	85 c0                	test   %eax,%eax
+  801106:	78 20                	js     801128 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801108:	01 c3                	add    %eax,%ebx
+  80110a:	85 c0                	test   %eax,%eax
+  80110c:	74 08                	je     801116 <readn+0x54>
+  80110e:	48 63 f3             	movslq %ebx,%rsi
+  801111:	4c 39 e6             	cmp    %r12,%rsi
+  801114:	72 df                	jb     8010f5 <readn+0x33>
+    }
+    return res;
+  801116:	48 63 c3             	movslq %ebx,%rax
+}
+  801119:	48 83 c4 08          	add    $0x8,%rsp
+  80111d:	5b                   	pop    %rbx
+  80111e:	41 5c                	pop    %r12
+  801120:	41 5d                	pop    %r13
+  801122:	41 5e                	pop    %r14
+  801124:	41 5f                	pop    %r15
+  801126:	5d                   	pop    %rbp
+  801127:	c3                   	ret
+        if (inc < 0) return inc;
+  801128:	48 98                	cltq
+  80112a:	eb ed                	jmp    801119 <readn+0x57>
+    int inc = 1, res = 0;
+  80112c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801131:	eb e3                	jmp    801116 <readn+0x54>
+
+0000000000801133 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801133:	55                   	push   %rbp
+  801134:	48 89 e5             	mov    %rsp,%rbp
+  801137:	41 56                	push   %r14
+  801139:	41 55                	push   %r13
+  80113b:	41 54                	push   %r12
+  80113d:	53                   	push   %rbx
+  80113e:	48 83 ec 10          	sub    $0x10,%rsp
+  801142:	89 fb                	mov    %edi,%ebx
+  801144:	49 89 f4             	mov    %rsi,%r12
+  801147:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80114a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80114e:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  801155:	00 00 00 
+  801158:	ff d0                	call   *%rax
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	78 47                	js     8011a5 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80115e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801162:	41 8b 3e             	mov    (%r14),%edi
+  801165:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801169:	48 b8 6c 0d 80 00 00 	movabs $0x800d6c,%rax
+  801170:	00 00 00 
+  801173:	ff d0                	call   *%rax
+  801175:	85 c0                	test   %eax,%eax
+  801177:	78 30                	js     8011a9 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801179:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80117e:	74 2d                	je     8011ad <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801180:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801184:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801188:	48 85 c0             	test   %rax,%rax
+  80118b:	74 56                	je     8011e3 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80118d:	4c 89 ea             	mov    %r13,%rdx
+  801190:	4c 89 e6             	mov    %r12,%rsi
+  801193:	4c 89 f7             	mov    %r14,%rdi
+  801196:	ff d0                	call   *%rax
+}
+  801198:	48 83 c4 10          	add    $0x10,%rsp
+  80119c:	5b                   	pop    %rbx
+  80119d:	41 5c                	pop    %r12
+  80119f:	41 5d                	pop    %r13
+  8011a1:	41 5e                	pop    %r14
+  8011a3:	5d                   	pop    %rbp
+  8011a4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011a5:	48 98                	cltq
+  8011a7:	eb ef                	jmp    801198 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011a9:	48 98                	cltq
+  8011ab:	eb eb                	jmp    801198 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011ad:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8011b4:	00 00 00 
+  8011b7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8011bd:	89 da                	mov    %ebx,%edx
+  8011bf:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  8011c6:	00 00 00 
+  8011c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ce:	48 b9 6c 30 80 00 00 	movabs $0x80306c,%rcx
+  8011d5:	00 00 00 
+  8011d8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8011da:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011e1:	eb b5                	jmp    801198 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8011e3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8011ea:	eb ac                	jmp    801198 <write+0x65>
+
+00000000008011ec <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8011ec:	55                   	push   %rbp
+  8011ed:	48 89 e5             	mov    %rsp,%rbp
+  8011f0:	53                   	push   %rbx
+  8011f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8011f5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8011f7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8011fb:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  801202:	00 00 00 
+  801205:	ff d0                	call   *%rax
+  801207:	85 c0                	test   %eax,%eax
+  801209:	78 0c                	js     801217 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80120b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80120f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801212:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801217:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121b:	c9                   	leave
+  80121c:	c3                   	ret
+
+000000000080121d <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80121d:	55                   	push   %rbp
+  80121e:	48 89 e5             	mov    %rsp,%rbp
+  801221:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801225:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801229:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  801230:	00 00 00 
+  801233:	ff d0                	call   *%rax
+  801235:	85 c0                	test   %eax,%eax
+  801237:	78 07                	js     801240 <tell+0x23>
+    return fdes->fd_offset;
+  801239:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80123d:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  801240:	c9                   	leave
+  801241:	c3                   	ret
+
+0000000000801242 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801242:	55                   	push   %rbp
+  801243:	48 89 e5             	mov    %rsp,%rbp
+  801246:	41 55                	push   %r13
+  801248:	41 54                	push   %r12
+  80124a:	53                   	push   %rbx
+  80124b:	48 83 ec 18          	sub    $0x18,%rsp
+  80124f:	89 fb                	mov    %edi,%ebx
+  801251:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801254:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801258:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  80125f:	00 00 00 
+  801262:	ff d0                	call   *%rax
+  801264:	85 c0                	test   %eax,%eax
+  801266:	78 38                	js     8012a0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801268:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80126c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801270:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801274:	48 b8 6c 0d 80 00 00 	movabs $0x800d6c,%rax
+  80127b:	00 00 00 
+  80127e:	ff d0                	call   *%rax
+  801280:	85 c0                	test   %eax,%eax
+  801282:	78 1c                	js     8012a0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801284:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801289:	74 20                	je     8012ab <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80128b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80128f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801293:	48 85 c0             	test   %rax,%rax
+  801296:	74 47                	je     8012df <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801298:	44 89 e6             	mov    %r12d,%esi
+  80129b:	4c 89 ef             	mov    %r13,%rdi
+  80129e:	ff d0                	call   *%rax
+}
+  8012a0:	48 83 c4 18          	add    $0x18,%rsp
+  8012a4:	5b                   	pop    %rbx
+  8012a5:	41 5c                	pop    %r12
+  8012a7:	41 5d                	pop    %r13
+  8012a9:	5d                   	pop    %rbp
+  8012aa:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8012ab:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8012b2:	00 00 00 
+  8012b5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8012bb:	89 da                	mov    %ebx,%edx
+  8012bd:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  8012c4:	00 00 00 
+  8012c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012cc:	48 b9 6c 30 80 00 00 	movabs $0x80306c,%rcx
+  8012d3:	00 00 00 
+  8012d6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8012d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012dd:	eb c1                	jmp    8012a0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8012df:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8012e4:	eb ba                	jmp    8012a0 <ftruncate+0x5e>
+
+00000000008012e6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8012e6:	55                   	push   %rbp
+  8012e7:	48 89 e5             	mov    %rsp,%rbp
+  8012ea:	41 54                	push   %r12
+  8012ec:	53                   	push   %rbx
+  8012ed:	48 83 ec 10          	sub    $0x10,%rsp
+  8012f1:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8012f4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8012f8:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  8012ff:	00 00 00 
+  801302:	ff d0                	call   *%rax
+  801304:	85 c0                	test   %eax,%eax
+  801306:	78 4e                	js     801356 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801308:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80130c:	41 8b 3c 24          	mov    (%r12),%edi
+  801310:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801314:	48 b8 6c 0d 80 00 00 	movabs $0x800d6c,%rax
+  80131b:	00 00 00 
+  80131e:	ff d0                	call   *%rax
+  801320:	85 c0                	test   %eax,%eax
+  801322:	78 32                	js     801356 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801324:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801328:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80132d:	74 30                	je     80135f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80132f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801332:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801339:	00 00 00 
+    stat->st_isdir = 0;
+  80133c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801343:	00 00 00 
+    stat->st_dev = dev;
+  801346:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80134d:	48 89 de             	mov    %rbx,%rsi
+  801350:	4c 89 e7             	mov    %r12,%rdi
+  801353:	ff 50 28             	call   *0x28(%rax)
+}
+  801356:	48 83 c4 10          	add    $0x10,%rsp
+  80135a:	5b                   	pop    %rbx
+  80135b:	41 5c                	pop    %r12
+  80135d:	5d                   	pop    %rbp
+  80135e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80135f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801364:	eb f0                	jmp    801356 <fstat+0x70>
+
+0000000000801366 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  801366:	55                   	push   %rbp
+  801367:	48 89 e5             	mov    %rsp,%rbp
+  80136a:	41 54                	push   %r12
+  80136c:	53                   	push   %rbx
+  80136d:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  801374:	41 89 fc             	mov    %edi,%r12d
+  801377:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801379:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80137d:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  801384:	00 00 00 
+  801387:	ff d0                	call   *%rax
+  801389:	85 c0                	test   %eax,%eax
+  80138b:	78 31                	js     8013be <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  80138d:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801394:	44 89 e7             	mov    %r12d,%edi
+  801397:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  80139e:	00 00 00 
+  8013a1:	ff d0                	call   *%rax
+  8013a3:	85 c0                	test   %eax,%eax
+  8013a5:	78 17                	js     8013be <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8013a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ab:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8013ae:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8013b1:	39 d3                	cmp    %edx,%ebx
+  8013b3:	0f 4f da             	cmovg  %edx,%ebx
+  8013b6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8013b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013be:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8013c5:	5b                   	pop    %rbx
+  8013c6:	41 5c                	pop    %r12
+  8013c8:	5d                   	pop    %rbp
+  8013c9:	c3                   	ret
+
+00000000008013ca <seektoend>:
+{
+  8013ca:	55                   	push   %rbp
+  8013cb:	48 89 e5             	mov    %rsp,%rbp
+  8013ce:	53                   	push   %rbx
+  8013cf:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8013d6:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8013d8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8013dc:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  8013e3:	00 00 00 
+  8013e6:	ff d0                	call   *%rax
+  8013e8:	85 c0                	test   %eax,%eax
+  8013ea:	78 28                	js     801414 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8013ec:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8013f3:	89 df                	mov    %ebx,%edi
+  8013f5:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  8013fc:	00 00 00 
+  8013ff:	ff d0                	call   *%rax
+  801401:	85 c0                	test   %eax,%eax
+  801403:	78 0f                	js     801414 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  801405:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801408:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80140c:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80140f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801414:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801418:	c9                   	leave
+  801419:	c3                   	ret
+
+000000000080141a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80141a:	55                   	push   %rbp
+  80141b:	48 89 e5             	mov    %rsp,%rbp
+  80141e:	41 54                	push   %r12
+  801420:	53                   	push   %rbx
+  801421:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801424:	be 00 00 00 00       	mov    $0x0,%esi
+  801429:	48 b8 0d 20 80 00 00 	movabs $0x80200d,%rax
+  801430:	00 00 00 
+  801433:	ff d0                	call   *%rax
+  801435:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801437:	85 c0                	test   %eax,%eax
+  801439:	78 25                	js     801460 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80143b:	4c 89 e6             	mov    %r12,%rsi
+  80143e:	89 c7                	mov    %eax,%edi
+  801440:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  801447:	00 00 00 
+  80144a:	ff d0                	call   *%rax
+  80144c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80144f:	89 df                	mov    %ebx,%edi
+  801451:	48 b8 86 0e 80 00 00 	movabs $0x800e86,%rax
+  801458:	00 00 00 
+  80145b:	ff d0                	call   *%rax
+
+    return res;
+  80145d:	44 89 e3             	mov    %r12d,%ebx
+}
+  801460:	89 d8                	mov    %ebx,%eax
+  801462:	5b                   	pop    %rbx
+  801463:	41 5c                	pop    %r12
+  801465:	5d                   	pop    %rbp
+  801466:	c3                   	ret
+
+0000000000801467 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  801467:	55                   	push   %rbp
+  801468:	48 89 e5             	mov    %rsp,%rbp
+  80146b:	53                   	push   %rbx
+  80146c:	48 83 ec 08          	sub    $0x8,%rsp
+  801470:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801473:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  80147a:	00 00 00 
+  80147d:	ff d0                	call   *%rax
+  80147f:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801483:	0f 87 ea 00 00 00    	ja     801573 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  801489:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  801490:	00 00 00 
+  801493:	80 38 00             	cmpb   $0x0,(%rax)
+  801496:	75 35                	jne    8014cd <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  801498:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80149d:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8014a2:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8014a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ac:	48 b8 7d 02 80 00 00 	movabs $0x80027d,%rax
+  8014b3:	00 00 00 
+  8014b6:	ff d0                	call   *%rax
+  8014b8:	85 c0                	test   %eax,%eax
+  8014ba:	0f 88 ba 00 00 00    	js     80157a <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8014c0:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8014c7:	00 00 00 
+  8014ca:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8014cd:	48 89 df             	mov    %rbx,%rdi
+  8014d0:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  8014d7:	00 00 00 
+  8014da:	ff d0                	call   *%rax
+  8014dc:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8014e0:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8014e7:	00 00 00 
+  8014ea:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8014ee:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8014f1:	39 39                	cmp    %edi,(%rcx)
+  8014f3:	74 46                	je     80153b <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8014f5:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8014f9:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  801500:	00 
+  801501:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  801508:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  80150f:	00 
+  801510:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  801517:	00 
+  801518:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  80151f:	00 
+  801520:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  801527:	00 
+  801528:	89 39                	mov    %edi,(%rcx)
+  80152a:	48 01 c6             	add    %rax,%rsi
+  80152d:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  801532:	48 89 c8             	mov    %rcx,%rax
+  801535:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801539:	c9                   	leave
+  80153a:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80153b:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80153f:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  801546:	00 00 00 
+  801549:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80154c:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  801550:	74 e0                	je     801532 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  801552:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  801559:	00 
+  80155a:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80155e:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  801565:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  801567:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80156a:	48 01 c2             	add    %rax,%rdx
+  80156d:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  801571:	eb bf                	jmp    801532 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801578:	eb b8                	jmp    801532 <fbuf_get+0xcb>
+            return NULL;
+  80157a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157f:	eb b1                	jmp    801532 <fbuf_get+0xcb>
+
+0000000000801581 <fsipc_bulk>:
+fsipc_bulk(void) {
+  801581:	55                   	push   %rbp
+  801582:	48 89 e5             	mov    %rsp,%rbp
+  801585:	53                   	push   %rbx
+  801586:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  80158a:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  801591:	00 00 00 
+  801594:	48 8b 18             	mov    (%rax),%rbx
+  801597:	48 85 db             	test   %rbx,%rbx
+  80159a:	74 16                	je     8015b2 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  80159c:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8015a3:	00 00 00 
+  8015a6:	48 8b 18             	mov    (%rax),%rbx
+}
+  8015a9:	48 89 d8             	mov    %rbx,%rax
+  8015ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b0:	c9                   	leave
+  8015b1:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8015b2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015b7:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8015bc:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8015c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c6:	48 b8 7d 02 80 00 00 	movabs $0x80027d,%rax
+  8015cd:	00 00 00 
+  8015d0:	ff d0                	call   *%rax
+  8015d2:	85 c0                	test   %eax,%eax
+  8015d4:	78 d3                	js     8015a9 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8015d6:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8015db:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8015e2:	00 00 00 
+  8015e5:	eb b5                	jmp    80159c <fsipc_bulk+0x1b>
+
+00000000008015e7 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8015e7:	55                   	push   %rbp
+  8015e8:	48 89 e5             	mov    %rsp,%rbp
+  8015eb:	41 57                	push   %r15
+  8015ed:	41 56                	push   %r14
+  8015ef:	41 55                	push   %r13
+  8015f1:	41 54                	push   %r12
+  8015f3:	53                   	push   %rbx
+  8015f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f8:	41 89 fd             	mov    %edi,%r13d
+  8015fb:	49 89 f6             	mov    %rsi,%r14
+  8015fe:	49 89 d7             	mov    %rdx,%r15
+  801601:	48 89 cb             	mov    %rcx,%rbx
+  801604:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801607:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80160e:	00 00 00 
+  801611:	83 38 00             	cmpl   $0x0,(%rax)
+  801614:	74 52                	je     801668 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  801616:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80161c:	4c 89 f9             	mov    %r15,%rcx
+  80161f:	4c 89 f2             	mov    %r14,%rdx
+  801622:	44 89 ee             	mov    %r13d,%esi
+  801625:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80162c:	00 00 00 
+  80162f:	8b 38                	mov    (%rax),%edi
+  801631:	48 b8 6b 41 80 00 00 	movabs $0x80416b,%rax
+  801638:	00 00 00 
+  80163b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80163d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801642:	4c 89 e2             	mov    %r12,%rdx
+  801645:	48 89 de             	mov    %rbx,%rsi
+  801648:	bf 00 00 00 00       	mov    $0x0,%edi
+  80164d:	48 b8 bb 3f 80 00 00 	movabs $0x803fbb,%rax
+  801654:	00 00 00 
+  801657:	ff d0                	call   *%rax
+}
+  801659:	48 83 c4 08          	add    $0x8,%rsp
+  80165d:	5b                   	pop    %rbx
+  80165e:	41 5c                	pop    %r12
+  801660:	41 5d                	pop    %r13
+  801662:	41 5e                	pop    %r14
+  801664:	41 5f                	pop    %r15
+  801666:	5d                   	pop    %rbp
+  801667:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801668:	bf 03 00 00 00       	mov    $0x3,%edi
+  80166d:	48 b8 0e 42 80 00 00 	movabs $0x80420e,%rax
+  801674:	00 00 00 
+  801677:	ff d0                	call   *%rax
+  801679:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  801680:	00 00 
+  801682:	eb 92                	jmp    801616 <fsipc_region+0x2f>
+
+0000000000801684 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  801684:	55                   	push   %rbp
+  801685:	48 89 e5             	mov    %rsp,%rbp
+  801688:	41 57                	push   %r15
+  80168a:	41 56                	push   %r14
+  80168c:	41 55                	push   %r13
+  80168e:	41 54                	push   %r12
+  801690:	53                   	push   %rbx
+  801691:	48 83 ec 28          	sub    $0x28,%rsp
+  801695:	49 89 ff             	mov    %rdi,%r15
+  801698:	49 89 f6             	mov    %rsi,%r14
+  80169b:	48 89 d3             	mov    %rdx,%rbx
+  80169e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016a2:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8016a5:	48 b8 81 15 80 00 00 	movabs $0x801581,%rax
+  8016ac:	00 00 00 
+  8016af:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8016b1:	48 85 c0             	test   %rax,%rax
+  8016b4:	0f 84 cc 00 00 00    	je     801786 <devfile_write_direct+0x102>
+  8016ba:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8016bd:	48 85 db             	test   %rbx,%rbx
+  8016c0:	0f 84 ba 00 00 00    	je     801780 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8016c6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016cc:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8016d3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8016d7:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8016db:	4c 29 e3             	sub    %r12,%rbx
+  8016de:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8016e3:	48 39 c3             	cmp    %rax,%rbx
+  8016e6:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8016ea:	48 89 da             	mov    %rbx,%rdx
+  8016ed:	4c 89 f6             	mov    %r14,%rsi
+  8016f0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8016f4:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  8016fb:	00 00 00 
+  8016fe:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  801700:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801704:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  801708:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80170b:	44 01 e0             	add    %r12d,%eax
+  80170e:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  801712:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  801716:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80171d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801724:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80172b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801731:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801736:	4c 89 ee             	mov    %r13,%rsi
+  801739:	bf 04 00 00 00       	mov    $0x4,%edi
+  80173e:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  801745:	00 00 00 
+  801748:	ff d0                	call   *%rax
+        if (res < 0)
+  80174a:	85 c0                	test   %eax,%eax
+  80174c:	78 29                	js     801777 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80174e:	74 2b                	je     80177b <devfile_write_direct+0xf7>
+        i += res;
+  801750:	48 98                	cltq
+  801752:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  801755:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  801758:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80175c:	49 39 c4             	cmp    %rax,%r12
+  80175f:	0f 82 72 ff ff ff    	jb     8016d7 <devfile_write_direct+0x53>
+    return i;
+  801765:	4c 89 e0             	mov    %r12,%rax
+}
+  801768:	48 83 c4 28          	add    $0x28,%rsp
+  80176c:	5b                   	pop    %rbx
+  80176d:	41 5c                	pop    %r12
+  80176f:	41 5d                	pop    %r13
+  801771:	41 5e                	pop    %r14
+  801773:	41 5f                	pop    %r15
+  801775:	5d                   	pop    %rbp
+  801776:	c3                   	ret
+            return res;
+  801777:	48 98                	cltq
+  801779:	eb ed                	jmp    801768 <devfile_write_direct+0xe4>
+            return i;
+  80177b:	4c 89 e0             	mov    %r12,%rax
+  80177e:	eb e8                	jmp    801768 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  801780:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  801784:	eb df                	jmp    801765 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  801786:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  80178d:	eb d9                	jmp    801768 <devfile_write_direct+0xe4>
+
+000000000080178f <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  80178f:	55                   	push   %rbp
+  801790:	48 89 e5             	mov    %rsp,%rbp
+  801793:	41 56                	push   %r14
+  801795:	41 55                	push   %r13
+  801797:	41 54                	push   %r12
+  801799:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  80179a:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  80179e:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8017a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a7:	4d 39 ee             	cmp    %r13,%r14
+  8017aa:	0f 84 99 00 00 00    	je     801849 <fbuf_flush+0xba>
+  8017b0:	49 89 fc             	mov    %rdi,%r12
+  8017b3:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8017b6:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017b9:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8017bd:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  8017c4:	00 00 00 
+  8017c7:	ff d0                	call   *%rax
+  8017c9:	48 89 c2             	mov    %rax,%rdx
+  8017cc:	48 c1 e2 04          	shl    $0x4,%rdx
+  8017d0:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8017d4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8017d8:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8017dd:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8017e0:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8017e4:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8017eb:	00 
+  8017ec:	44 89 f1             	mov    %r14d,%ecx
+  8017ef:	4c 89 ea             	mov    %r13,%rdx
+  8017f2:	4c 89 e7             	mov    %r12,%rdi
+  8017f5:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  8017fc:	00 00 00 
+  8017ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801801:	48 85 c0             	test   %rax,%rax
+  801804:	78 43                	js     801849 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  801806:	4c 39 e8             	cmp    %r13,%rax
+  801809:	72 47                	jb     801852 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80180b:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  801810:	83 c0 01             	add    $0x1,%eax
+  801813:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801818:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80181b:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80181f:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  801823:	72 0f                	jb     801834 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  801825:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  801829:	48 39 c2             	cmp    %rax,%rdx
+  80182c:	48 0f 42 d0          	cmovb  %rax,%rdx
+  801830:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  801834:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80183b:	00 
+  80183c:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  801843:	00 
+    return 0;
+  801844:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801849:	5b                   	pop    %rbx
+  80184a:	41 5c                	pop    %r12
+  80184c:	41 5d                	pop    %r13
+  80184e:	41 5e                	pop    %r14
+  801850:	5d                   	pop    %rbp
+  801851:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  801852:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801857:	eb f0                	jmp    801849 <fbuf_flush+0xba>
+
+0000000000801859 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  801859:	55                   	push   %rbp
+  80185a:	48 89 e5             	mov    %rsp,%rbp
+  80185d:	53                   	push   %rbx
+  80185e:	48 83 ec 08          	sub    $0x8,%rsp
+  801862:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  801865:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  80186c:	00 00 00 
+  80186f:	ff d0                	call   *%rax
+  801871:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  801874:	b8 00 00 00 00       	mov    $0x0,%eax
+  801879:	48 85 f6             	test   %rsi,%rsi
+  80187c:	74 0f                	je     80188d <devfile_sync+0x34>
+  80187e:	48 89 df             	mov    %rbx,%rdi
+  801881:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  801888:	00 00 00 
+  80188b:	ff d0                	call   *%rax
+}
+  80188d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801891:	c9                   	leave
+  801892:	c3                   	ret
+
+0000000000801893 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  801893:	55                   	push   %rbp
+  801894:	48 89 e5             	mov    %rsp,%rbp
+  801897:	48 83 ec 10          	sub    $0x10,%rsp
+  80189b:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  80189e:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8018a5:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8018a6:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8018aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018af:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8018b6:	00 00 00 
+  8018b9:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  8018c0:	00 00 00 
+  8018c3:	ff d0                	call   *%rax
+}
+  8018c5:	c9                   	leave
+  8018c6:	c3                   	ret
+
+00000000008018c7 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8018c7:	55                   	push   %rbp
+  8018c8:	48 89 e5             	mov    %rsp,%rbp
+  8018cb:	41 54                	push   %r12
+  8018cd:	53                   	push   %rbx
+  8018ce:	48 89 fb             	mov    %rdi,%rbx
+  8018d1:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8018d4:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  8018db:	00 00 00 
+  8018de:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018e0:	85 c0                	test   %eax,%eax
+  8018e2:	78 63                	js     801947 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018e4:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8018e7:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8018ee:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  8018f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f5:	bf 05 00 00 00       	mov    $0x5,%edi
+  8018fa:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  801901:	00 00 00 
+  801904:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801906:	85 c0                	test   %eax,%eax
+  801908:	78 3d                	js     801947 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80190a:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  801911:	00 00 00 
+  801914:	48 89 de             	mov    %rbx,%rsi
+  801917:	4c 89 e7             	mov    %r12,%rdi
+  80191a:	48 b8 e4 39 80 00 00 	movabs $0x8039e4,%rax
+  801921:	00 00 00 
+  801924:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  801926:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80192c:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  801933:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801934:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80193a:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  801941:	00 
+
+    return 0;
+  801942:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801947:	5b                   	pop    %rbx
+  801948:	41 5c                	pop    %r12
+  80194a:	5d                   	pop    %rbp
+  80194b:	c3                   	ret
+
+000000000080194c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80194c:	55                   	push   %rbp
+  80194d:	48 89 e5             	mov    %rsp,%rbp
+  801950:	41 54                	push   %r12
+  801952:	53                   	push   %rbx
+  801953:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  801956:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  80195d:	00 00 00 
+  801960:	ff d0                	call   *%rax
+  801962:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  801965:	48 89 df             	mov    %rbx,%rdi
+  801968:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  80196f:	00 00 00 
+  801972:	ff d0                	call   *%rax
+  801974:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801978:	76 2e                	jbe    8019a8 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  80197a:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80197d:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  801984:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  801986:	be 00 00 00 00       	mov    $0x0,%esi
+  80198b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801990:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  801997:	00 00 00 
+  80199a:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  80199c:	45 85 e4             	test   %r12d,%r12d
+  80199f:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019a3:	5b                   	pop    %rbx
+  8019a4:	41 5c                	pop    %r12
+  8019a6:	5d                   	pop    %rbp
+  8019a7:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8019a8:	48 89 df             	mov    %rbx,%rdi
+  8019ab:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  8019b2:	00 00 00 
+  8019b5:	ff d0                	call   *%rax
+  8019b7:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8019bb:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8019c2:	00 00 00 
+  8019c5:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8019cc:	48 89 df             	mov    %rbx,%rdi
+  8019cf:	48 b8 a5 0c 80 00 00 	movabs $0x800ca5,%rax
+  8019d6:	00 00 00 
+  8019d9:	ff d0                	call   *%rax
+  8019db:	48 89 c6             	mov    %rax,%rsi
+  8019de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019e8:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  8019ef:	00 00 00 
+  8019f2:	ff d0                	call   *%rax
+  8019f4:	eb 84                	jmp    80197a <devfile_flush+0x2e>
+
+00000000008019f6 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8019f6:	55                   	push   %rbp
+  8019f7:	48 89 e5             	mov    %rsp,%rbp
+  8019fa:	41 55                	push   %r13
+  8019fc:	41 54                	push   %r12
+  8019fe:	53                   	push   %rbx
+  8019ff:	48 83 ec 08          	sub    $0x8,%rsp
+  801a03:	48 89 fb             	mov    %rdi,%rbx
+  801a06:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  801a09:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  801a10:	00 00 00 
+  801a13:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801a15:	48 85 c0             	test   %rax,%rax
+  801a18:	74 51                	je     801a6b <devfile_trunc+0x75>
+  801a1a:	49 89 c4             	mov    %rax,%r12
+  801a1d:	48 89 c6             	mov    %rax,%rsi
+  801a20:	48 89 df             	mov    %rbx,%rdi
+  801a23:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  801a2a:	00 00 00 
+  801a2d:	ff d0                	call   *%rax
+  801a2f:	85 c0                	test   %eax,%eax
+  801a31:	78 2d                	js     801a60 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a33:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a3a:	00 00 00 
+  801a3d:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a40:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a42:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a46:	be 00 00 00 00       	mov    $0x0,%esi
+  801a4b:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a50:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  801a57:	00 00 00 
+  801a5a:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a5c:	85 c0                	test   %eax,%eax
+  801a5e:	79 3e                	jns    801a9e <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  801a60:	48 83 c4 08          	add    $0x8,%rsp
+  801a64:	5b                   	pop    %rbx
+  801a65:	41 5c                	pop    %r12
+  801a67:	41 5d                	pop    %r13
+  801a69:	5d                   	pop    %rbp
+  801a6a:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a6b:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  801a72:	00 00 00 
+  801a75:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801a78:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801a7a:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  801a7e:	be 00 00 00 00       	mov    $0x0,%esi
+  801a83:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a88:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  801a8f:	00 00 00 
+  801a92:	ff d0                	call   *%rax
+    if (res >= 0) {
+  801a94:	85 c0                	test   %eax,%eax
+  801a96:	78 c8                	js     801a60 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801a98:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801a9c:	eb c2                	jmp    801a60 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  801a9e:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  801aa1:	8d 51 01             	lea    0x1(%rcx),%edx
+  801aa4:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801aa7:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  801aac:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801ab3:	00 00 
+  801ab5:	eb a9                	jmp    801a60 <devfile_trunc+0x6a>
+
+0000000000801ab7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801ab7:	55                   	push   %rbp
+  801ab8:	48 89 e5             	mov    %rsp,%rbp
+  801abb:	41 57                	push   %r15
+  801abd:	41 56                	push   %r14
+  801abf:	41 55                	push   %r13
+  801ac1:	41 54                	push   %r12
+  801ac3:	53                   	push   %rbx
+  801ac4:	48 83 ec 28          	sub    $0x28,%rsp
+  801ac8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801acc:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801ad0:	49 89 d7             	mov    %rdx,%r15
+  801ad3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801ad7:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  801ade:	00 00 00 
+  801ae1:	ff d0                	call   *%rax
+  801ae3:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  801ae6:	48 85 c0             	test   %rax,%rax
+  801ae9:	74 31                	je     801b1c <devfile_write+0x65>
+  801aeb:	4c 89 f8             	mov    %r15,%rax
+  801aee:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  801af5:	77 25                	ja     801b1c <devfile_write+0x65>
+    size_t i = 0;
+  801af7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  801afd:	48 85 c0             	test   %rax,%rax
+  801b00:	0f 85 64 01 00 00    	jne    801c6a <devfile_write+0x1b3>
+    size_t i = 0;
+  801b06:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  801b0a:	4c 89 f8             	mov    %r15,%rax
+}
+  801b0d:	48 83 c4 28          	add    $0x28,%rsp
+  801b11:	5b                   	pop    %rbx
+  801b12:	41 5c                	pop    %r12
+  801b14:	41 5d                	pop    %r13
+  801b16:	41 5e                	pop    %r14
+  801b18:	41 5f                	pop    %r15
+  801b1a:	5d                   	pop    %rbp
+  801b1b:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b1c:	48 85 db             	test   %rbx,%rbx
+  801b1f:	74 5b                	je     801b7c <devfile_write+0xc5>
+  801b21:	48 89 de             	mov    %rbx,%rsi
+  801b24:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b28:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  801b2f:	00 00 00 
+  801b32:	ff d0                	call   *%rax
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	78 40                	js     801b78 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b38:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801b3c:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  801b3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b43:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b47:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  801b4e:	00 00 00 
+  801b51:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b53:	48 85 c0             	test   %rax,%rax
+  801b56:	7e b5                	jle    801b0d <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801b58:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  801b5c:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  801b5f:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  801b62:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  801b65:	8d 51 01             	lea    0x1(%rcx),%edx
+  801b68:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801b6b:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  801b6e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801b75:	00 
+  801b76:	eb 95                	jmp    801b0d <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801b78:	48 98                	cltq
+  801b7a:	eb 91                	jmp    801b0d <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  801b7c:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801b80:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  801b83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b87:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  801b8b:	48 89 df             	mov    %rbx,%rdi
+  801b8e:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  801b95:	00 00 00 
+  801b98:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  801b9a:	48 85 c0             	test   %rax,%rax
+  801b9d:	0f 8e 6a ff ff ff    	jle    801b0d <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  801ba3:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  801ba6:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  801baa:	e9 5e ff ff ff       	jmp    801b0d <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801baf:	48 98                	cltq
+  801bb1:	4d 85 ff             	test   %r15,%r15
+  801bb4:	49 0f 45 c7          	cmovne %r15,%rax
+  801bb8:	e9 50 ff ff ff       	jmp    801b0d <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801bbd:	48 89 de             	mov    %rbx,%rsi
+  801bc0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801bc4:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  801bcb:	00 00 00 
+  801bce:	ff d0                	call   *%rax
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	0f 88 2b 01 00 00    	js     801d03 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801bd8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801bdc:	4c 01 f8             	add    %r15,%rax
+  801bdf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801be3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801be7:	48 b9 93 0c 80 00 00 	movabs $0x800c93,%rcx
+  801bee:	00 00 00 
+  801bf1:	ff d1                	call   *%rcx
+  801bf3:	48 89 c2             	mov    %rax,%rdx
+  801bf6:	48 c1 e2 04          	shl    $0x4,%rdx
+  801bfa:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801bfe:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c02:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  801c07:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  801c0a:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  801c11:	00 
+  801c12:	4c 89 ea             	mov    %r13,%rdx
+  801c15:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801c19:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  801c20:	00 00 00 
+  801c23:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  801c25:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801c29:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801c2d:	48 39 c2             	cmp    %rax,%rdx
+  801c30:	0f 84 db 00 00 00    	je     801d11 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  801c36:	4c 39 e2             	cmp    %r12,%rdx
+  801c39:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  801c3d:	4d 01 ec             	add    %r13,%r12
+  801c40:	49 39 c4             	cmp    %rax,%r12
+  801c43:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  801c47:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  801c4b:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  801c4f:	45 01 ee             	add    %r13d,%r14d
+  801c52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c56:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  801c5a:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  801c5d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c61:	49 39 c7             	cmp    %rax,%r15
+  801c64:	0f 83 a0 fe ff ff    	jae    801b0a <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  801c6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c6e:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  801c72:	8b 43 08             	mov    0x8(%rbx),%eax
+  801c75:	44 39 f0             	cmp    %r14d,%eax
+  801c78:	7f 10                	jg     801c8a <devfile_write+0x1d3>
+  801c7a:	48 98                	cltq
+  801c7c:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  801c82:	49 63 d6             	movslq %r14d,%rdx
+  801c85:	48 39 d0             	cmp    %rdx,%rax
+  801c88:	7d 2d                	jge    801cb7 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801c8a:	48 89 de             	mov    %rbx,%rsi
+  801c8d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801c91:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  801c98:	00 00 00 
+  801c9b:	ff d0                	call   *%rax
+  801c9d:	85 c0                	test   %eax,%eax
+  801c9f:	0f 88 0a ff ff ff    	js     801baf <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801ca5:	44 89 f0             	mov    %r14d,%eax
+  801ca8:	66 b8 00 00          	mov    $0x0,%ax
+  801cac:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  801caf:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801cb6:	00 
+        size_t off = pos - fb->fb_base;
+  801cb7:	45 89 f4             	mov    %r14d,%r12d
+  801cba:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  801cbe:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  801cc1:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  801cc5:	4d 29 fd             	sub    %r15,%r13
+  801cc8:	b8 00 00 01 00       	mov    $0x10000,%eax
+  801ccd:	4c 29 e0             	sub    %r12,%rax
+  801cd0:	49 39 c5             	cmp    %rax,%r13
+  801cd3:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  801cd7:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  801cdb:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  801cdf:	48 39 c2             	cmp    %rax,%rdx
+  801ce2:	0f 84 f0 fe ff ff    	je     801bd8 <devfile_write+0x121>
+  801ce8:	4c 39 e0             	cmp    %r12,%rax
+  801ceb:	0f 82 cc fe ff ff    	jb     801bbd <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  801cf1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801cf5:	48 39 d0             	cmp    %rdx,%rax
+  801cf8:	0f 83 da fe ff ff    	jae    801bd8 <devfile_write+0x121>
+  801cfe:	e9 ba fe ff ff       	jmp    801bbd <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  801d03:	48 98                	cltq
+  801d05:	4d 85 ff             	test   %r15,%r15
+  801d08:	49 0f 45 c7          	cmovne %r15,%rax
+  801d0c:	e9 fc fd ff ff       	jmp    801b0d <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  801d11:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  801d15:	4c 89 e2             	mov    %r12,%rdx
+  801d18:	e9 2a ff ff ff       	jmp    801c47 <devfile_write+0x190>
+
+0000000000801d1d <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801d1d:	55                   	push   %rbp
+  801d1e:	48 89 e5             	mov    %rsp,%rbp
+  801d21:	41 57                	push   %r15
+  801d23:	41 56                	push   %r14
+  801d25:	41 55                	push   %r13
+  801d27:	41 54                	push   %r12
+  801d29:	53                   	push   %rbx
+  801d2a:	48 83 ec 28          	sub    $0x28,%rsp
+  801d2e:	49 89 ff             	mov    %rdi,%r15
+  801d31:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  801d35:	48 89 d3             	mov    %rdx,%rbx
+  801d38:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  801d3c:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+  801d48:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  801d4b:	48 85 c0             	test   %rax,%rax
+  801d4e:	74 0d                	je     801d5d <devfile_read+0x40>
+  801d50:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  801d57:	0f 86 1a 01 00 00    	jbe    801e77 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801d5d:	4d 85 e4             	test   %r12,%r12
+  801d60:	74 1a                	je     801d7c <devfile_read+0x5f>
+  801d62:	4c 89 e6             	mov    %r12,%rsi
+  801d65:	4c 89 ff             	mov    %r15,%rdi
+  801d68:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  801d6f:	00 00 00 
+  801d72:	ff d0                	call   *%rax
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	0f 88 e8 00 00 00    	js     801e64 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  801d7c:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  801d80:	48 b8 81 15 80 00 00 	movabs $0x801581,%rax
+  801d87:	00 00 00 
+  801d8a:	ff d0                	call   *%rax
+  801d8c:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  801d8f:	48 85 c0             	test   %rax,%rax
+  801d92:	0f 84 69 02 00 00    	je     802001 <devfile_read+0x2e4>
+    while (i < n) {
+  801d98:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801d9d:	0f 84 ce 00 00 00    	je     801e71 <devfile_read+0x154>
+    size_t i = 0;
+  801da3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801da8:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  801daf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801db3:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  801db7:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  801dbb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801dbf:	48 29 da             	sub    %rbx,%rdx
+  801dc2:	b8 00 00 04 00       	mov    $0x40000,%eax
+  801dc7:	48 39 c2             	cmp    %rax,%rdx
+  801dca:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  801dce:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801dd2:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  801dd6:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801dd9:	01 d8                	add    %ebx,%eax
+  801ddb:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  801ddf:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  801de3:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  801dea:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801df1:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  801df8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dfe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e03:	4c 89 ee             	mov    %r13,%rsi
+  801e06:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e0b:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  801e12:	00 00 00 
+  801e15:	ff d0                	call   *%rax
+        if (res < 0)
+  801e17:	85 c0                	test   %eax,%eax
+  801e19:	78 4d                	js     801e68 <devfile_read+0x14b>
+        if (res == 0)
+  801e1b:	74 4f                	je     801e6c <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  801e1d:	4c 63 e0             	movslq %eax,%r12
+  801e20:	4c 89 e2             	mov    %r12,%rdx
+  801e23:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  801e27:	4c 89 f7             	mov    %r14,%rdi
+  801e2a:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  801e31:	00 00 00 
+  801e34:	ff d0                	call   *%rax
+        i += res;
+  801e36:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  801e39:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  801e3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e40:	48 39 c3             	cmp    %rax,%rbx
+  801e43:	0f 82 72 ff ff ff    	jb     801dbb <devfile_read+0x9e>
+    return i;
+  801e49:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  801e4c:	48 85 c0             	test   %rax,%rax
+  801e4f:	7e 04                	jle    801e55 <devfile_read+0x138>
+  801e51:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  801e55:	48 83 c4 28          	add    $0x28,%rsp
+  801e59:	5b                   	pop    %rbx
+  801e5a:	41 5c                	pop    %r12
+  801e5c:	41 5d                	pop    %r13
+  801e5e:	41 5e                	pop    %r14
+  801e60:	41 5f                	pop    %r15
+  801e62:	5d                   	pop    %rbp
+  801e63:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  801e64:	48 98                	cltq
+  801e66:	eb ed                	jmp    801e55 <devfile_read+0x138>
+            return res;
+  801e68:	48 98                	cltq
+  801e6a:	eb e9                	jmp    801e55 <devfile_read+0x138>
+            return i;
+  801e6c:	48 89 d8             	mov    %rbx,%rax
+  801e6f:	eb db                	jmp    801e4c <devfile_read+0x12f>
+    size_t i = 0;
+  801e71:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  801e75:	eb d2                	jmp    801e49 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801e77:	48 89 c6             	mov    %rax,%rsi
+  801e7a:	4c 89 ff             	mov    %r15,%rdi
+  801e7d:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  801e84:	00 00 00 
+  801e87:	ff d0                	call   *%rax
+  801e89:	85 c0                	test   %eax,%eax
+  801e8b:	78 40                	js     801ecd <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801e8d:	4c 89 ff             	mov    %r15,%rdi
+  801e90:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  801e97:	00 00 00 
+  801e9a:	ff d0                	call   *%rax
+  801e9c:	48 89 c2             	mov    %rax,%rdx
+  801e9f:	48 c1 e2 04          	shl    $0x4,%rdx
+  801ea3:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801ea7:	48 c1 e0 0c          	shl    $0xc,%rax
+  801eab:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  801eb0:	48 01 d0             	add    %rdx,%rax
+  801eb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  801eb7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ebc:	0f 84 33 01 00 00    	je     801ff5 <devfile_read+0x2d8>
+    size_t i = 0;
+  801ec2:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801ec8:	e9 f5 00 00 00       	jmp    801fc2 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  801ecd:	48 98                	cltq
+  801ecf:	eb 84                	jmp    801e55 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  801ed1:	44 89 e8             	mov    %r13d,%eax
+  801ed4:	66 b8 00 00          	mov    $0x0,%ax
+  801ed8:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  801edd:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  801ee4:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  801ee6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  801eea:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801eee:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  801ef0:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801ef5:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  801ef8:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  801eff:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  801f00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f0b:	ba 00 10 01 00       	mov    $0x11000,%edx
+  801f10:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f15:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  801f1c:	00 00 00 
+  801f1f:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	0f 88 be 00 00 00    	js     801fe7 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  801f29:	48 63 d0             	movslq %eax,%rdx
+  801f2c:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  801f31:	41 03 44 24 08       	add    0x8(%r12),%eax
+  801f36:	44 39 e8             	cmp    %r13d,%eax
+  801f39:	0f 8e ba 00 00 00    	jle    801ff9 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  801f3f:	49 63 c5             	movslq %r13d,%rax
+  801f42:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  801f47:	48 29 c3             	sub    %rax,%rbx
+  801f4a:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  801f4f:	48 01 c3             	add    %rax,%rbx
+  801f52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f56:	4c 29 f0             	sub    %r14,%rax
+  801f59:	48 39 c3             	cmp    %rax,%rbx
+  801f5c:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  801f60:	4c 89 ff             	mov    %r15,%rdi
+  801f63:	48 b9 93 0c 80 00 00 	movabs $0x800c93,%rcx
+  801f6a:	00 00 00 
+  801f6d:	ff d1                	call   *%rcx
+  801f6f:	48 89 c2             	mov    %rax,%rdx
+  801f72:	48 c1 e2 04          	shl    $0x4,%rdx
+  801f76:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  801f7a:	48 c1 e0 0c          	shl    $0xc,%rax
+  801f7e:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  801f83:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  801f86:	44 89 ea             	mov    %r13d,%edx
+  801f89:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  801f8e:	48 63 d2             	movslq %edx,%rdx
+  801f91:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  801f98:	00 
+  801f99:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801f9d:	4c 01 f7             	add    %r14,%rdi
+  801fa0:	48 89 da             	mov    %rbx,%rdx
+  801fa3:	48 b9 d9 3d 80 00 00 	movabs $0x803dd9,%rcx
+  801faa:	00 00 00 
+  801fad:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  801faf:	41 01 dd             	add    %ebx,%r13d
+  801fb2:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  801fb6:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  801fb9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fbd:	49 39 c6             	cmp    %rax,%r14
+  801fc0:	73 37                	jae    801ff9 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  801fc2:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  801fc6:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  801fcb:	44 39 e8             	cmp    %r13d,%eax
+  801fce:	0f 8f fd fe ff ff    	jg     801ed1 <devfile_read+0x1b4>
+  801fd4:	41 03 44 24 10       	add    0x10(%r12),%eax
+  801fd9:	44 39 e8             	cmp    %r13d,%eax
+  801fdc:	0f 8f 5d ff ff ff    	jg     801f3f <devfile_read+0x222>
+  801fe2:	e9 ea fe ff ff       	jmp    801ed1 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  801fe7:	48 98                	cltq
+  801fe9:	4d 85 f6             	test   %r14,%r14
+  801fec:	49 0f 45 c6          	cmovne %r14,%rax
+  801ff0:	e9 60 fe ff ff       	jmp    801e55 <devfile_read+0x138>
+    size_t i = 0;
+  801ff5:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  801ff9:	4c 89 f0             	mov    %r14,%rax
+  801ffc:	e9 54 fe ff ff       	jmp    801e55 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  802001:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802008:	e9 48 fe ff ff       	jmp    801e55 <devfile_read+0x138>
+
+000000000080200d <open>:
+open(const char *path, int mode) {
+  80200d:	55                   	push   %rbp
+  80200e:	48 89 e5             	mov    %rsp,%rbp
+  802011:	41 55                	push   %r13
+  802013:	41 54                	push   %r12
+  802015:	53                   	push   %rbx
+  802016:	48 83 ec 18          	sub    $0x18,%rsp
+  80201a:	49 89 fc             	mov    %rdi,%r12
+  80201d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802020:	48 b8 a6 39 80 00 00 	movabs $0x8039a6,%rax
+  802027:	00 00 00 
+  80202a:	ff d0                	call   *%rax
+  80202c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802032:	0f 87 8a 00 00 00    	ja     8020c2 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802038:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80203c:	48 b8 c1 0c 80 00 00 	movabs $0x800cc1,%rax
+  802043:	00 00 00 
+  802046:	ff d0                	call   *%rax
+  802048:	89 c3                	mov    %eax,%ebx
+  80204a:	85 c0                	test   %eax,%eax
+  80204c:	78 50                	js     80209e <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80204e:	4c 89 e6             	mov    %r12,%rsi
+  802051:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802058:	00 00 00 
+  80205b:	48 89 df             	mov    %rbx,%rdi
+  80205e:	48 b8 e4 39 80 00 00 	movabs $0x8039e4,%rax
+  802065:	00 00 00 
+  802068:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80206a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802071:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802075:	bf 01 00 00 00       	mov    $0x1,%edi
+  80207a:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  802081:	00 00 00 
+  802084:	ff d0                	call   *%rax
+  802086:	89 c3                	mov    %eax,%ebx
+  802088:	85 c0                	test   %eax,%eax
+  80208a:	78 1f                	js     8020ab <open+0x9e>
+    return fd2num(fd);
+  80208c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802090:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  802097:	00 00 00 
+  80209a:	ff d0                	call   *%rax
+  80209c:	89 c3                	mov    %eax,%ebx
+}
+  80209e:	89 d8                	mov    %ebx,%eax
+  8020a0:	48 83 c4 18          	add    $0x18,%rsp
+  8020a4:	5b                   	pop    %rbx
+  8020a5:	41 5c                	pop    %r12
+  8020a7:	41 5d                	pop    %r13
+  8020a9:	5d                   	pop    %rbp
+  8020aa:	c3                   	ret
+        fd_close(fd, 0);
+  8020ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020b4:	48 b8 dc 0d 80 00 00 	movabs $0x800ddc,%rax
+  8020bb:	00 00 00 
+  8020be:	ff d0                	call   *%rax
+        return res;
+  8020c0:	eb dc                	jmp    80209e <open+0x91>
+        return -E_BAD_PATH;
+  8020c2:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020c7:	eb d5                	jmp    80209e <open+0x91>
+
+00000000008020c9 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8020c9:	55                   	push   %rbp
+  8020ca:	48 89 e5             	mov    %rsp,%rbp
+  8020cd:	41 57                	push   %r15
+  8020cf:	41 56                	push   %r14
+  8020d1:	41 55                	push   %r13
+  8020d3:	41 54                	push   %r12
+  8020d5:	53                   	push   %rbx
+  8020d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8020da:	41 89 f6             	mov    %esi,%r14d
+  8020dd:	49 89 d7             	mov    %rdx,%r15
+  8020e0:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8020e3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8020e7:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  8020ee:	00 00 00 
+  8020f1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020f3:	85 c0                	test   %eax,%eax
+  8020f5:	0f 88 db 00 00 00    	js     8021d6 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8020fb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8020ff:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802106:	00 00 00 
+  802109:	8b 00                	mov    (%rax),%eax
+  80210b:	39 07                	cmp    %eax,(%rdi)
+  80210d:	0f 85 db 00 00 00    	jne    8021ee <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802113:	45 85 f6             	test   %r14d,%r14d
+  802116:	0f 88 db 00 00 00    	js     8021f7 <fmap+0x12e>
+  80211c:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802123:	0f 85 d7 00 00 00    	jne    802200 <fmap+0x137>
+  802129:	4c 89 fb             	mov    %r15,%rbx
+  80212c:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802132:	0f 85 d1 00 00 00    	jne    802209 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802138:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  80213f:	00 00 00 
+  802142:	ff d0                	call   *%rax
+  802144:	85 c0                	test   %eax,%eax
+  802146:	0f 88 8e 00 00 00    	js     8021da <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80214c:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  802153:	00 00 00 
+    while (i < n) {
+  802156:	4d 85 ed             	test   %r13,%r13
+  802159:	0f 84 8a 00 00 00    	je     8021e9 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80215f:	4c 89 ea             	mov    %r13,%rdx
+  802162:	48 29 da             	sub    %rbx,%rdx
+  802165:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80216c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802172:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802176:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80217a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80217d:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  802181:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  802185:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  80218a:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80218f:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  802193:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  802197:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80219c:	4c 89 e6             	mov    %r12,%rsi
+  80219f:	bf 09 00 00 00       	mov    $0x9,%edi
+  8021a4:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  8021ab:	00 00 00 
+  8021ae:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021b0:	85 c0                	test   %eax,%eax
+  8021b2:	78 2a                	js     8021de <fmap+0x115>
+        i += res;
+  8021b4:	48 98                	cltq
+  8021b6:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8021b9:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8021bd:	72 05                	jb     8021c4 <fmap+0xfb>
+    while (i < n) {
+  8021bf:	4c 39 eb             	cmp    %r13,%rbx
+  8021c2:	72 9b                	jb     80215f <fmap+0x96>
+    }
+    return i;
+  8021c4:	48 89 d8             	mov    %rbx,%rax
+}
+  8021c7:	48 83 c4 18          	add    $0x18,%rsp
+  8021cb:	5b                   	pop    %rbx
+  8021cc:	41 5c                	pop    %r12
+  8021ce:	41 5d                	pop    %r13
+  8021d0:	41 5e                	pop    %r14
+  8021d2:	41 5f                	pop    %r15
+  8021d4:	5d                   	pop    %rbp
+  8021d5:	c3                   	ret
+    if (res < 0) return res;
+  8021d6:	48 98                	cltq
+  8021d8:	eb ed                	jmp    8021c7 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8021da:	48 98                	cltq
+  8021dc:	eb e9                	jmp    8021c7 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8021de:	48 98                	cltq
+  8021e0:	48 85 db             	test   %rbx,%rbx
+  8021e3:	48 0f 45 c3          	cmovne %rbx,%rax
+  8021e7:	eb de                	jmp    8021c7 <fmap+0xfe>
+    size_t i = 0;
+  8021e9:	4c 89 eb             	mov    %r13,%rbx
+  8021ec:	eb d6                	jmp    8021c4 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8021ee:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8021f5:	eb d0                	jmp    8021c7 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8021f7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8021fe:	eb c7                	jmp    8021c7 <fmap+0xfe>
+  802200:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802207:	eb be                	jmp    8021c7 <fmap+0xfe>
+  802209:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802210:	eb b5                	jmp    8021c7 <fmap+0xfe>
+
+0000000000802212 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  802212:	55                   	push   %rbp
+  802213:	48 89 e5             	mov    %rsp,%rbp
+  802216:	41 56                	push   %r14
+  802218:	41 55                	push   %r13
+  80221a:	41 54                	push   %r12
+  80221c:	53                   	push   %rbx
+  80221d:	48 83 ec 10          	sub    $0x10,%rsp
+  802221:	89 fb                	mov    %edi,%ebx
+  802223:	41 89 f4             	mov    %esi,%r12d
+  802226:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802229:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80222d:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  802234:	00 00 00 
+  802237:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802239:	85 c0                	test   %eax,%eax
+  80223b:	78 63                	js     8022a0 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80223d:	45 85 e4             	test   %r12d,%r12d
+  802240:	0f 88 80 00 00 00    	js     8022c6 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  802246:	45 89 e6             	mov    %r12d,%r14d
+  802249:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  802250:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802254:	48 b8 a5 0c 80 00 00 	movabs $0x800ca5,%rax
+  80225b:	00 00 00 
+  80225e:	ff d0                	call   *%rax
+  802260:	48 89 c2             	mov    %rax,%rdx
+  802263:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802268:	44 89 f6             	mov    %r14d,%esi
+  80226b:	89 df                	mov    %ebx,%edi
+  80226d:	48 b8 c9 20 80 00 00 	movabs $0x8020c9,%rax
+  802274:	00 00 00 
+  802277:	ff d0                	call   *%rax
+  802279:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80227c:	45 29 f4             	sub    %r14d,%r12d
+  80227f:	4d 63 f4             	movslq %r12d,%r14
+  802282:	49 39 c6             	cmp    %rax,%r14
+  802285:	7c 1d                	jl     8022a4 <read_map+0x92>
+  802287:	48 85 c0             	test   %rax,%rax
+  80228a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228f:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  802293:	48 83 c4 10          	add    $0x10,%rsp
+  802297:	5b                   	pop    %rbx
+  802298:	41 5c                	pop    %r12
+  80229a:	41 5d                	pop    %r13
+  80229c:	41 5e                	pop    %r14
+  80229e:	5d                   	pop    %rbp
+  80229f:	c3                   	ret
+    if (res < 0) return res;
+  8022a0:	48 98                	cltq
+  8022a2:	eb ef                	jmp    802293 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8022a4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022a8:	48 b8 a5 0c 80 00 00 	movabs $0x800ca5,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+  8022b4:	4d 63 e4             	movslq %r12d,%r12
+  8022b7:	4c 01 e0             	add    %r12,%rax
+  8022ba:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8022be:	48 89 d8             	mov    %rbx,%rax
+  8022c1:	4c 29 f0             	sub    %r14,%rax
+  8022c4:	eb cd                	jmp    802293 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8022c6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8022cd:	eb c4                	jmp    802293 <read_map+0x81>
+
+00000000008022cf <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8022cf:	55                   	push   %rbp
+  8022d0:	48 89 e5             	mov    %rsp,%rbp
+  8022d3:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8022d7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8022db:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  8022e2:	00 00 00 
+  8022e5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	78 4a                	js     802335 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8022eb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8022ef:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8022f6:	00 00 00 
+  8022f9:	8b 00                	mov    (%rax),%eax
+  8022fb:	39 07                	cmp    %eax,(%rdi)
+  8022fd:	75 38                	jne    802337 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8022ff:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  802306:	00 00 00 
+  802309:	ff d0                	call   *%rax
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	78 26                	js     802335 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80230f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802313:	8b 40 0c             	mov    0xc(%rax),%eax
+  802316:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80231d:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80231f:	be 00 00 00 00       	mov    $0x0,%esi
+  802324:	bf 06 00 00 00       	mov    $0x6,%edi
+  802329:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  802330:	00 00 00 
+  802333:	ff d0                	call   *%rax
+}
+  802335:	c9                   	leave
+  802336:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802337:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80233c:	eb f7                	jmp    802335 <fsync+0x66>
+
+000000000080233e <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80233e:	55                   	push   %rbp
+  80233f:	48 89 e5             	mov    %rsp,%rbp
+  802342:	41 57                	push   %r15
+  802344:	41 56                	push   %r14
+  802346:	41 55                	push   %r13
+  802348:	41 54                	push   %r12
+  80234a:	53                   	push   %rbx
+  80234b:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80234f:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  802356:	00 00 00 
+  802359:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80235e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802364:	49 bd 21 0d 80 00 00 	movabs $0x800d21,%r13
+  80236b:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80236e:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  802375:	00 00 00 
+  802378:	eb 0c                	jmp    802386 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80237a:	83 c3 01             	add    $0x1,%ebx
+  80237d:	49 83 c4 28          	add    $0x28,%r12
+  802381:	83 fb 20             	cmp    $0x20,%ebx
+  802384:	74 33                	je     8023b9 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802386:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80238b:	74 ed                	je     80237a <flushall+0x3c>
+  80238d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802391:	89 df                	mov    %ebx,%edi
+  802393:	41 ff d5             	call   *%r13
+  802396:	85 c0                	test   %eax,%eax
+  802398:	78 e0                	js     80237a <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80239a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80239e:	41 8b 06             	mov    (%r14),%eax
+  8023a1:	39 07                	cmp    %eax,(%rdi)
+  8023a3:	75 d5                	jne    80237a <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8023a5:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  8023ac:	00 00 00 
+  8023af:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8023b1:	85 c0                	test   %eax,%eax
+  8023b3:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8023b7:	eb c1                	jmp    80237a <flushall+0x3c>
+    }
+    return res;
+}
+  8023b9:	44 89 f8             	mov    %r15d,%eax
+  8023bc:	48 83 c4 18          	add    $0x18,%rsp
+  8023c0:	5b                   	pop    %rbx
+  8023c1:	41 5c                	pop    %r12
+  8023c3:	41 5d                	pop    %r13
+  8023c5:	41 5e                	pop    %r14
+  8023c7:	41 5f                	pop    %r15
+  8023c9:	5d                   	pop    %rbp
+  8023ca:	c3                   	ret
+
+00000000008023cb <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8023cb:	55                   	push   %rbp
+  8023cc:	48 89 e5             	mov    %rsp,%rbp
+  8023cf:	53                   	push   %rbx
+  8023d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d4:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8023d7:	40 0f b6 c6          	movzbl %sil,%eax
+  8023db:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8023e2:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8023e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8023ee:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  8023f5:	00 00 00 
+  8023f8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023fa:	85 c0                	test   %eax,%eax
+  8023fc:	78 23                	js     802421 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8023fe:	ba 58 06 00 00       	mov    $0x658,%edx
+  802403:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80240a:	00 00 00 
+  80240d:	48 89 df             	mov    %rbx,%rdi
+  802410:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  802417:	00 00 00 
+  80241a:	ff d0                	call   *%rax
+    return 0;
+  80241c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802421:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802425:	c9                   	leave
+  802426:	c3                   	ret
+
+0000000000802427 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  802427:	55                   	push   %rbp
+  802428:	48 89 e5             	mov    %rsp,%rbp
+  80242b:	53                   	push   %rbx
+  80242c:	48 83 ec 08          	sub    $0x8,%rsp
+  802430:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  802433:	48 b8 a6 39 80 00 00 	movabs $0x8039a6,%rax
+  80243a:	00 00 00 
+  80243d:	ff d0                	call   *%rax
+  80243f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802445:	77 35                	ja     80247c <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  802447:	48 89 de             	mov    %rbx,%rsi
+  80244a:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  802451:	00 00 00 
+  802454:	48 b8 e4 39 80 00 00 	movabs $0x8039e4,%rax
+  80245b:	00 00 00 
+  80245e:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  802460:	be 00 00 00 00       	mov    $0x0,%esi
+  802465:	bf 07 00 00 00       	mov    $0x7,%edi
+  80246a:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  802471:	00 00 00 
+  802474:	ff d0                	call   *%rax
+}
+  802476:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80247a:	c9                   	leave
+  80247b:	c3                   	ret
+        return -E_BAD_PATH;
+  80247c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802481:	eb f3                	jmp    802476 <remove+0x4f>
+
+0000000000802483 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802483:	55                   	push   %rbp
+  802484:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  802487:	48 b8 3e 23 80 00 00 	movabs $0x80233e,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802493:	be 00 00 00 00       	mov    $0x0,%esi
+  802498:	bf 08 00 00 00       	mov    $0x8,%edi
+  80249d:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  8024a4:	00 00 00 
+  8024a7:	ff d0                	call   *%rax
+}
+  8024a9:	5d                   	pop    %rbp
+  8024aa:	c3                   	ret
+
+00000000008024ab <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024ab:	55                   	push   %rbp
+  8024ac:	48 89 e5             	mov    %rsp,%rbp
+  8024af:	41 54                	push   %r12
+  8024b1:	53                   	push   %rbx
+  8024b2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024b5:	48 b8 a5 0c 80 00 00 	movabs $0x800ca5,%rax
+  8024bc:	00 00 00 
+  8024bf:	ff d0                	call   *%rax
+  8024c1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024c4:	48 be 60 51 80 00 00 	movabs $0x805160,%rsi
+  8024cb:	00 00 00 
+  8024ce:	48 89 df             	mov    %rbx,%rdi
+  8024d1:	48 b8 e4 39 80 00 00 	movabs $0x8039e4,%rax
+  8024d8:	00 00 00 
+  8024db:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024dd:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024e2:	41 2b 04 24          	sub    (%r12),%eax
+  8024e6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024ec:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024f3:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024f6:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8024fd:	00 00 00 
+  802500:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250c:	5b                   	pop    %rbx
+  80250d:	41 5c                	pop    %r12
+  80250f:	5d                   	pop    %rbp
+  802510:	c3                   	ret
+
+0000000000802511 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802511:	55                   	push   %rbp
+  802512:	48 89 e5             	mov    %rsp,%rbp
+  802515:	41 54                	push   %r12
+  802517:	53                   	push   %rbx
+  802518:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80251b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802520:	48 89 fe             	mov    %rdi,%rsi
+  802523:	bf 00 00 00 00       	mov    $0x0,%edi
+  802528:	49 bc 5c 04 80 00 00 	movabs $0x80045c,%r12
+  80252f:	00 00 00 
+  802532:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802535:	48 89 df             	mov    %rbx,%rdi
+  802538:	48 b8 a5 0c 80 00 00 	movabs $0x800ca5,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+  802544:	48 89 c6             	mov    %rax,%rsi
+  802547:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80254c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802551:	41 ff d4             	call   *%r12
+}
+  802554:	5b                   	pop    %rbx
+  802555:	41 5c                	pop    %r12
+  802557:	5d                   	pop    %rbp
+  802558:	c3                   	ret
+
+0000000000802559 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802559:	55                   	push   %rbp
+  80255a:	48 89 e5             	mov    %rsp,%rbp
+  80255d:	41 57                	push   %r15
+  80255f:	41 56                	push   %r14
+  802561:	41 55                	push   %r13
+  802563:	41 54                	push   %r12
+  802565:	53                   	push   %rbx
+  802566:	48 83 ec 18          	sub    $0x18,%rsp
+  80256a:	49 89 fc             	mov    %rdi,%r12
+  80256d:	49 89 f5             	mov    %rsi,%r13
+  802570:	49 89 d7             	mov    %rdx,%r15
+  802573:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802577:	48 b8 a5 0c 80 00 00 	movabs $0x800ca5,%rax
+  80257e:	00 00 00 
+  802581:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802583:	4d 85 ff             	test   %r15,%r15
+  802586:	0f 84 af 00 00 00    	je     80263b <devpipe_write+0xe2>
+  80258c:	48 89 c3             	mov    %rax,%rbx
+  80258f:	4c 89 f8             	mov    %r15,%rax
+  802592:	4d 89 ef             	mov    %r13,%r15
+  802595:	4c 01 e8             	add    %r13,%rax
+  802598:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80259c:	49 bd 51 02 80 00 00 	movabs $0x800251,%r13
+  8025a3:	00 00 00 
+            sys_yield();
+  8025a6:	49 be ee 01 80 00 00 	movabs $0x8001ee,%r14
+  8025ad:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025b0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025b3:	48 63 ce             	movslq %esi,%rcx
+  8025b6:	48 63 03             	movslq (%rbx),%rax
+  8025b9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025bf:	48 39 c1             	cmp    %rax,%rcx
+  8025c2:	72 2e                	jb     8025f2 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025c4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025c9:	48 89 da             	mov    %rbx,%rdx
+  8025cc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025d1:	4c 89 e7             	mov    %r12,%rdi
+  8025d4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025d7:	85 c0                	test   %eax,%eax
+  8025d9:	74 66                	je     802641 <devpipe_write+0xe8>
+            sys_yield();
+  8025db:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025de:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025e1:	48 63 ce             	movslq %esi,%rcx
+  8025e4:	48 63 03             	movslq (%rbx),%rax
+  8025e7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025ed:	48 39 c1             	cmp    %rax,%rcx
+  8025f0:	73 d2                	jae    8025c4 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025f2:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025f6:	48 89 ca             	mov    %rcx,%rdx
+  8025f9:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025fd:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802604:	08 10 20 
+  802607:	48 f7 e2             	mul    %rdx
+  80260a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80260e:	48 89 d0             	mov    %rdx,%rax
+  802611:	48 c1 e0 09          	shl    $0x9,%rax
+  802615:	48 29 d0             	sub    %rdx,%rax
+  802618:	48 c1 e0 03          	shl    $0x3,%rax
+  80261c:	48 29 c1             	sub    %rax,%rcx
+  80261f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802624:	83 c6 01             	add    $0x1,%esi
+  802627:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80262a:	49 83 c7 01          	add    $0x1,%r15
+  80262e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802632:	49 39 c7             	cmp    %rax,%r15
+  802635:	0f 85 75 ff ff ff    	jne    8025b0 <devpipe_write+0x57>
+    return n;
+  80263b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80263f:	eb 05                	jmp    802646 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802641:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802646:	48 83 c4 18          	add    $0x18,%rsp
+  80264a:	5b                   	pop    %rbx
+  80264b:	41 5c                	pop    %r12
+  80264d:	41 5d                	pop    %r13
+  80264f:	41 5e                	pop    %r14
+  802651:	41 5f                	pop    %r15
+  802653:	5d                   	pop    %rbp
+  802654:	c3                   	ret
+
+0000000000802655 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802655:	55                   	push   %rbp
+  802656:	48 89 e5             	mov    %rsp,%rbp
+  802659:	41 57                	push   %r15
+  80265b:	41 56                	push   %r14
+  80265d:	41 55                	push   %r13
+  80265f:	41 54                	push   %r12
+  802661:	53                   	push   %rbx
+  802662:	48 83 ec 18          	sub    $0x18,%rsp
+  802666:	49 89 fc             	mov    %rdi,%r12
+  802669:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80266d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802671:	48 b8 a5 0c 80 00 00 	movabs $0x800ca5,%rax
+  802678:	00 00 00 
+  80267b:	ff d0                	call   *%rax
+  80267d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802680:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802686:	49 bd 51 02 80 00 00 	movabs $0x800251,%r13
+  80268d:	00 00 00 
+            sys_yield();
+  802690:	49 be ee 01 80 00 00 	movabs $0x8001ee,%r14
+  802697:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80269a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80269f:	74 7d                	je     80271e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026a1:	8b 03                	mov    (%rbx),%eax
+  8026a3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026a6:	75 26                	jne    8026ce <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026a8:	4d 85 ff             	test   %r15,%r15
+  8026ab:	75 77                	jne    802724 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026ad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026b2:	48 89 da             	mov    %rbx,%rdx
+  8026b5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026ba:	4c 89 e7             	mov    %r12,%rdi
+  8026bd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026c0:	85 c0                	test   %eax,%eax
+  8026c2:	74 72                	je     802736 <devpipe_read+0xe1>
+            sys_yield();
+  8026c4:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026c7:	8b 03                	mov    (%rbx),%eax
+  8026c9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026cc:	74 df                	je     8026ad <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026ce:	48 63 c8             	movslq %eax,%rcx
+  8026d1:	48 89 ca             	mov    %rcx,%rdx
+  8026d4:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026d8:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026df:	08 10 20 
+  8026e2:	48 89 d0             	mov    %rdx,%rax
+  8026e5:	48 f7 e6             	mul    %rsi
+  8026e8:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026ec:	48 89 d0             	mov    %rdx,%rax
+  8026ef:	48 c1 e0 09          	shl    $0x9,%rax
+  8026f3:	48 29 d0             	sub    %rdx,%rax
+  8026f6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8026fd:	00 
+  8026fe:	48 89 c8             	mov    %rcx,%rax
+  802701:	48 29 d0             	sub    %rdx,%rax
+  802704:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802709:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80270d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802711:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802714:	49 83 c7 01          	add    $0x1,%r15
+  802718:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80271c:	75 83                	jne    8026a1 <devpipe_read+0x4c>
+    return n;
+  80271e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802722:	eb 03                	jmp    802727 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802724:	4c 89 f8             	mov    %r15,%rax
+}
+  802727:	48 83 c4 18          	add    $0x18,%rsp
+  80272b:	5b                   	pop    %rbx
+  80272c:	41 5c                	pop    %r12
+  80272e:	41 5d                	pop    %r13
+  802730:	41 5e                	pop    %r14
+  802732:	41 5f                	pop    %r15
+  802734:	5d                   	pop    %rbp
+  802735:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273b:	eb ea                	jmp    802727 <devpipe_read+0xd2>
+
+000000000080273d <pipe>:
+pipe(int pfd[2]) {
+  80273d:	55                   	push   %rbp
+  80273e:	48 89 e5             	mov    %rsp,%rbp
+  802741:	41 55                	push   %r13
+  802743:	41 54                	push   %r12
+  802745:	53                   	push   %rbx
+  802746:	48 83 ec 18          	sub    $0x18,%rsp
+  80274a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80274d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802751:	48 b8 c1 0c 80 00 00 	movabs $0x800cc1,%rax
+  802758:	00 00 00 
+  80275b:	ff d0                	call   *%rax
+  80275d:	89 c3                	mov    %eax,%ebx
+  80275f:	85 c0                	test   %eax,%eax
+  802761:	0f 88 a0 01 00 00    	js     802907 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802767:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80276c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802771:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802775:	bf 00 00 00 00       	mov    $0x0,%edi
+  80277a:	48 b8 7d 02 80 00 00 	movabs $0x80027d,%rax
+  802781:	00 00 00 
+  802784:	ff d0                	call   *%rax
+  802786:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802788:	85 c0                	test   %eax,%eax
+  80278a:	0f 88 77 01 00 00    	js     802907 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802790:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802794:	48 b8 c1 0c 80 00 00 	movabs $0x800cc1,%rax
+  80279b:	00 00 00 
+  80279e:	ff d0                	call   *%rax
+  8027a0:	89 c3                	mov    %eax,%ebx
+  8027a2:	85 c0                	test   %eax,%eax
+  8027a4:	0f 88 43 01 00 00    	js     8028ed <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8027aa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027af:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027b4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027bd:	48 b8 7d 02 80 00 00 	movabs $0x80027d,%rax
+  8027c4:	00 00 00 
+  8027c7:	ff d0                	call   *%rax
+  8027c9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8027cb:	85 c0                	test   %eax,%eax
+  8027cd:	0f 88 1a 01 00 00    	js     8028ed <pipe+0x1b0>
+    va = fd2data(fd0);
+  8027d3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027d7:	48 b8 a5 0c 80 00 00 	movabs $0x800ca5,%rax
+  8027de:	00 00 00 
+  8027e1:	ff d0                	call   *%rax
+  8027e3:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8027e6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8027eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027f0:	48 89 c6             	mov    %rax,%rsi
+  8027f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027f8:	48 b8 7d 02 80 00 00 	movabs $0x80027d,%rax
+  8027ff:	00 00 00 
+  802802:	ff d0                	call   *%rax
+  802804:	89 c3                	mov    %eax,%ebx
+  802806:	85 c0                	test   %eax,%eax
+  802808:	0f 88 c5 00 00 00    	js     8028d3 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80280e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802812:	48 b8 a5 0c 80 00 00 	movabs $0x800ca5,%rax
+  802819:	00 00 00 
+  80281c:	ff d0                	call   *%rax
+  80281e:	48 89 c1             	mov    %rax,%rcx
+  802821:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802827:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80282d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802832:	4c 89 ee             	mov    %r13,%rsi
+  802835:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283a:	48 b8 e4 02 80 00 00 	movabs $0x8002e4,%rax
+  802841:	00 00 00 
+  802844:	ff d0                	call   *%rax
+  802846:	89 c3                	mov    %eax,%ebx
+  802848:	85 c0                	test   %eax,%eax
+  80284a:	78 6e                	js     8028ba <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80284c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802851:	4c 89 ef             	mov    %r13,%rdi
+  802854:	48 b8 1f 02 80 00 00 	movabs $0x80021f,%rax
+  80285b:	00 00 00 
+  80285e:	ff d0                	call   *%rax
+  802860:	83 f8 02             	cmp    $0x2,%eax
+  802863:	0f 85 ab 00 00 00    	jne    802914 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802869:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  802870:	00 00 
+  802872:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802876:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802878:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80287c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802883:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802887:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802889:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80288d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802894:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802898:	48 bb 93 0c 80 00 00 	movabs $0x800c93,%rbx
+  80289f:	00 00 00 
+  8028a2:	ff d3                	call   *%rbx
+  8028a4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028a8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028ac:	ff d3                	call   *%rbx
+  8028ae:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028b8:	eb 4d                	jmp    802907 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8028ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028bf:	4c 89 ee             	mov    %r13,%rsi
+  8028c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028c7:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  8028ce:	00 00 00 
+  8028d1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8028d3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028d8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e1:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  8028e8:	00 00 00 
+  8028eb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8028ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028f2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fb:	48 b8 5c 04 80 00 00 	movabs $0x80045c,%rax
+  802902:	00 00 00 
+  802905:	ff d0                	call   *%rax
+}
+  802907:	89 d8                	mov    %ebx,%eax
+  802909:	48 83 c4 18          	add    $0x18,%rsp
+  80290d:	5b                   	pop    %rbx
+  80290e:	41 5c                	pop    %r12
+  802910:	41 5d                	pop    %r13
+  802912:	5d                   	pop    %rbp
+  802913:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802914:	48 b9 90 51 80 00 00 	movabs $0x805190,%rcx
+  80291b:	00 00 00 
+  80291e:	48 ba 67 51 80 00 00 	movabs $0x805167,%rdx
+  802925:	00 00 00 
+  802928:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80292d:	48 bf 7c 51 80 00 00 	movabs $0x80517c,%rdi
+  802934:	00 00 00 
+  802937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293c:	49 b8 1c 2f 80 00 00 	movabs $0x802f1c,%r8
+  802943:	00 00 00 
+  802946:	41 ff d0             	call   *%r8
+
+0000000000802949 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802949:	55                   	push   %rbp
+  80294a:	48 89 e5             	mov    %rsp,%rbp
+  80294d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802951:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802955:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  80295c:	00 00 00 
+  80295f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802961:	85 c0                	test   %eax,%eax
+  802963:	78 35                	js     80299a <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802965:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802969:	48 b8 a5 0c 80 00 00 	movabs $0x800ca5,%rax
+  802970:	00 00 00 
+  802973:	ff d0                	call   *%rax
+  802975:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802978:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80297d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802982:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802986:	48 b8 51 02 80 00 00 	movabs $0x800251,%rax
+  80298d:	00 00 00 
+  802990:	ff d0                	call   *%rax
+  802992:	85 c0                	test   %eax,%eax
+  802994:	0f 94 c0             	sete   %al
+  802997:	0f b6 c0             	movzbl %al,%eax
+}
+  80299a:	c9                   	leave
+  80299b:	c3                   	ret
+
+000000000080299c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80299c:	48 89 f8             	mov    %rdi,%rax
+  80299f:	48 c1 e8 27          	shr    $0x27,%rax
+  8029a3:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8029aa:	7f 00 00 
+  8029ad:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029b1:	f6 c2 01             	test   $0x1,%dl
+  8029b4:	74 6d                	je     802a23 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029b6:	48 89 f8             	mov    %rdi,%rax
+  8029b9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029bd:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029c4:	7f 00 00 
+  8029c7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029cb:	f6 c2 01             	test   $0x1,%dl
+  8029ce:	74 62                	je     802a32 <get_uvpt_entry+0x96>
+  8029d0:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8029d7:	7f 00 00 
+  8029da:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029de:	f6 c2 80             	test   $0x80,%dl
+  8029e1:	75 4f                	jne    802a32 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029e3:	48 89 f8             	mov    %rdi,%rax
+  8029e6:	48 c1 e8 15          	shr    $0x15,%rax
+  8029ea:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8029f1:	7f 00 00 
+  8029f4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029f8:	f6 c2 01             	test   $0x1,%dl
+  8029fb:	74 44                	je     802a41 <get_uvpt_entry+0xa5>
+  8029fd:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a04:	7f 00 00 
+  802a07:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a0b:	f6 c2 80             	test   $0x80,%dl
+  802a0e:	75 31                	jne    802a41 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a10:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a14:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802a1b:	7f 00 00 
+  802a1e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a22:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a23:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  802a2a:	7f 00 00 
+  802a2d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a31:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a32:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  802a39:	7f 00 00 
+  802a3c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a40:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a41:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  802a48:	7f 00 00 
+  802a4b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a4f:	c3                   	ret
+
+0000000000802a50 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  802a50:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a53:	48 89 f9             	mov    %rdi,%rcx
+  802a56:	48 c1 e9 27          	shr    $0x27,%rcx
+  802a5a:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  802a61:	7f 00 00 
+  802a64:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  802a68:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  802a6f:	f6 c1 01             	test   $0x1,%cl
+  802a72:	0f 84 b2 00 00 00    	je     802b2a <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a78:	48 89 f9             	mov    %rdi,%rcx
+  802a7b:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  802a7f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802a86:	7f 00 00 
+  802a89:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802a8d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  802a94:	40 f6 c6 01          	test   $0x1,%sil
+  802a98:	0f 84 8c 00 00 00    	je     802b2a <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  802a9e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802aa5:	7f 00 00 
+  802aa8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802aac:	a8 80                	test   $0x80,%al
+  802aae:	75 7b                	jne    802b2b <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802ab0:	48 89 f9             	mov    %rdi,%rcx
+  802ab3:	48 c1 e9 15          	shr    $0x15,%rcx
+  802ab7:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802abe:	7f 00 00 
+  802ac1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802ac5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  802acc:	40 f6 c6 01          	test   $0x1,%sil
+  802ad0:	74 58                	je     802b2a <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  802ad2:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802ad9:	7f 00 00 
+  802adc:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802ae0:	a8 80                	test   $0x80,%al
+  802ae2:	75 6c                	jne    802b50 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802ae4:	48 89 f9             	mov    %rdi,%rcx
+  802ae7:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802aeb:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802af2:	7f 00 00 
+  802af5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  802af9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  802b00:	40 f6 c6 01          	test   $0x1,%sil
+  802b04:	74 24                	je     802b2a <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  802b06:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  802b0d:	7f 00 00 
+  802b10:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b14:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b1b:	ff ff 7f 
+  802b1e:	48 21 c8             	and    %rcx,%rax
+  802b21:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b27:	48 09 d0             	or     %rdx,%rax
+}
+  802b2a:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  802b2b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  802b32:	7f 00 00 
+  802b35:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b39:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b40:	ff ff 7f 
+  802b43:	48 21 c8             	and    %rcx,%rax
+  802b46:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  802b4c:	48 01 d0             	add    %rdx,%rax
+  802b4f:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  802b50:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  802b57:	7f 00 00 
+  802b5a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  802b5e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  802b65:	ff ff 7f 
+  802b68:	48 21 c8             	and    %rcx,%rax
+  802b6b:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  802b71:	48 01 d0             	add    %rdx,%rax
+  802b74:	c3                   	ret
+
+0000000000802b75 <get_prot>:
+
+int
+get_prot(void *va) {
+  802b75:	55                   	push   %rbp
+  802b76:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b79:	48 b8 9c 29 80 00 00 	movabs $0x80299c,%rax
+  802b80:	00 00 00 
+  802b83:	ff d0                	call   *%rax
+  802b85:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b88:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b8d:	89 c1                	mov    %eax,%ecx
+  802b8f:	83 c9 04             	or     $0x4,%ecx
+  802b92:	f6 c2 01             	test   $0x1,%dl
+  802b95:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b98:	89 c1                	mov    %eax,%ecx
+  802b9a:	83 c9 02             	or     $0x2,%ecx
+  802b9d:	f6 c2 02             	test   $0x2,%dl
+  802ba0:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ba3:	89 c1                	mov    %eax,%ecx
+  802ba5:	83 c9 01             	or     $0x1,%ecx
+  802ba8:	48 85 d2             	test   %rdx,%rdx
+  802bab:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bae:	89 c1                	mov    %eax,%ecx
+  802bb0:	83 c9 40             	or     $0x40,%ecx
+  802bb3:	f6 c6 04             	test   $0x4,%dh
+  802bb6:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802bb9:	5d                   	pop    %rbp
+  802bba:	c3                   	ret
+
+0000000000802bbb <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802bbb:	55                   	push   %rbp
+  802bbc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bbf:	48 b8 9c 29 80 00 00 	movabs $0x80299c,%rax
+  802bc6:	00 00 00 
+  802bc9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802bcb:	48 c1 e8 06          	shr    $0x6,%rax
+  802bcf:	83 e0 01             	and    $0x1,%eax
+}
+  802bd2:	5d                   	pop    %rbp
+  802bd3:	c3                   	ret
+
+0000000000802bd4 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bd4:	55                   	push   %rbp
+  802bd5:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802bd8:	48 b8 9c 29 80 00 00 	movabs $0x80299c,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+  802be4:	83 e0 01             	and    $0x1,%eax
+}
+  802be7:	5d                   	pop    %rbp
+  802be8:	c3                   	ret
+
+0000000000802be9 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  802be9:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  802bf0:	7f 00 00 
+  802bf3:	a8 01                	test   $0x1,%al
+  802bf5:	75 06                	jne    802bfd <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  802bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bfc:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802bfd:	55                   	push   %rbp
+  802bfe:	48 89 e5             	mov    %rsp,%rbp
+  802c01:	41 57                	push   %r15
+  802c03:	41 56                	push   %r14
+  802c05:	41 55                	push   %r13
+  802c07:	41 54                	push   %r12
+  802c09:	53                   	push   %rbx
+  802c0a:	48 83 ec 18          	sub    $0x18,%rsp
+  802c0e:	49 89 fe             	mov    %rdi,%r14
+  802c11:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c14:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c1b:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c1c:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  802c23:	7f 00 00 
+  802c26:	e9 81 00 00 00       	jmp    802cac <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  802c2b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c32:	49 39 dd             	cmp    %rbx,%r13
+  802c35:	74 2b                	je     802c62 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  802c37:	48 89 d8             	mov    %rbx,%rax
+  802c3a:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c3e:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  802c42:	f6 c2 01             	test   $0x1,%dl
+  802c45:	74 e4                	je     802c2b <foreach_shared_region+0x42>
+  802c47:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  802c4b:	f6 c4 04             	test   $0x4,%ah
+  802c4e:	74 db                	je     802c2b <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  802c50:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802c57:	4c 89 fa             	mov    %r15,%rdx
+  802c5a:	48 89 df             	mov    %rbx,%rdi
+  802c5d:	41 ff d6             	call   *%r14
+  802c60:	eb c9                	jmp    802c2b <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802c62:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  802c69:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  802c6d:	74 22                	je     802c91 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  802c6f:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  802c76:	48 89 d8             	mov    %rbx,%rax
+  802c79:	48 c1 e8 15          	shr    $0x15,%rax
+  802c7d:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  802c84:	7f 00 00 
+  802c87:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802c8b:	a8 01                	test   $0x1,%al
+  802c8d:	74 d3                	je     802c62 <foreach_shared_region+0x79>
+  802c8f:	eb a6                	jmp    802c37 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  802c91:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  802c98:	40 
+  802c99:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802c9d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ca4:	00 00 00 
+  802ca7:	48 39 c1             	cmp    %rax,%rcx
+  802caa:	74 31                	je     802cdd <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  802cac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cb0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cb4:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  802cbb:	7f 00 00 
+  802cbe:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802cc2:	a8 01                	test   $0x1,%al
+  802cc4:	74 cb                	je     802c91 <foreach_shared_region+0xa8>
+  802cc6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cca:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  802cd1:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  802cd7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802cdb:	eb 92                	jmp    802c6f <foreach_shared_region+0x86>
+}
+  802cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce2:	48 83 c4 18          	add    $0x18,%rsp
+  802ce6:	5b                   	pop    %rbx
+  802ce7:	41 5c                	pop    %r12
+  802ce9:	41 5d                	pop    %r13
+  802ceb:	41 5e                	pop    %r14
+  802ced:	41 5f                	pop    %r15
+  802cef:	5d                   	pop    %rbp
+  802cf0:	c3                   	ret
+
+0000000000802cf1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf6:	c3                   	ret
+
+0000000000802cf7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802cf7:	55                   	push   %rbp
+  802cf8:	48 89 e5             	mov    %rsp,%rbp
+  802cfb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802cfe:	48 be b4 51 80 00 00 	movabs $0x8051b4,%rsi
+  802d05:	00 00 00 
+  802d08:	48 b8 e4 39 80 00 00 	movabs $0x8039e4,%rax
+  802d0f:	00 00 00 
+  802d12:	ff d0                	call   *%rax
+    return 0;
+}
+  802d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d19:	5d                   	pop    %rbp
+  802d1a:	c3                   	ret
+
+0000000000802d1b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d1b:	55                   	push   %rbp
+  802d1c:	48 89 e5             	mov    %rsp,%rbp
+  802d1f:	41 57                	push   %r15
+  802d21:	41 56                	push   %r14
+  802d23:	41 55                	push   %r13
+  802d25:	41 54                	push   %r12
+  802d27:	53                   	push   %rbx
+  802d28:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d2f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d36:	48 85 d2             	test   %rdx,%rdx
+  802d39:	74 7a                	je     802db5 <devcons_write+0x9a>
+  802d3b:	49 89 d6             	mov    %rdx,%r14
+  802d3e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d44:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d49:	49 bf 72 3d 80 00 00 	movabs $0x803d72,%r15
+  802d50:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d53:	4c 89 f3             	mov    %r14,%rbx
+  802d56:	48 29 f3             	sub    %rsi,%rbx
+  802d59:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d5e:	48 39 c3             	cmp    %rax,%rbx
+  802d61:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d65:	4c 63 eb             	movslq %ebx,%r13
+  802d68:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d6f:	48 01 c6             	add    %rax,%rsi
+  802d72:	4c 89 ea             	mov    %r13,%rdx
+  802d75:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d7c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d7f:	4c 89 ee             	mov    %r13,%rsi
+  802d82:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d89:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  802d90:	00 00 00 
+  802d93:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d95:	41 01 dc             	add    %ebx,%r12d
+  802d98:	49 63 f4             	movslq %r12d,%rsi
+  802d9b:	4c 39 f6             	cmp    %r14,%rsi
+  802d9e:	72 b3                	jb     802d53 <devcons_write+0x38>
+    return res;
+  802da0:	49 63 c4             	movslq %r12d,%rax
+}
+  802da3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802daa:	5b                   	pop    %rbx
+  802dab:	41 5c                	pop    %r12
+  802dad:	41 5d                	pop    %r13
+  802daf:	41 5e                	pop    %r14
+  802db1:	41 5f                	pop    %r15
+  802db3:	5d                   	pop    %rbp
+  802db4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802db5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dbb:	eb e3                	jmp    802da0 <devcons_write+0x85>
+
+0000000000802dbd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dbd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802dc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dc5:	48 85 c0             	test   %rax,%rax
+  802dc8:	74 55                	je     802e1f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dca:	55                   	push   %rbp
+  802dcb:	48 89 e5             	mov    %rsp,%rbp
+  802dce:	41 55                	push   %r13
+  802dd0:	41 54                	push   %r12
+  802dd2:	53                   	push   %rbx
+  802dd3:	48 83 ec 08          	sub    $0x8,%rsp
+  802dd7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802dda:	48 bb 21 01 80 00 00 	movabs $0x800121,%rbx
+  802de1:	00 00 00 
+  802de4:	49 bc ee 01 80 00 00 	movabs $0x8001ee,%r12
+  802deb:	00 00 00 
+  802dee:	eb 03                	jmp    802df3 <devcons_read+0x36>
+  802df0:	41 ff d4             	call   *%r12
+  802df3:	ff d3                	call   *%rbx
+  802df5:	85 c0                	test   %eax,%eax
+  802df7:	74 f7                	je     802df0 <devcons_read+0x33>
+    if (c < 0) return c;
+  802df9:	48 63 d0             	movslq %eax,%rdx
+  802dfc:	78 13                	js     802e11 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802dfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e03:	83 f8 04             	cmp    $0x4,%eax
+  802e06:	74 09                	je     802e11 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e08:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e0c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e11:	48 89 d0             	mov    %rdx,%rax
+  802e14:	48 83 c4 08          	add    $0x8,%rsp
+  802e18:	5b                   	pop    %rbx
+  802e19:	41 5c                	pop    %r12
+  802e1b:	41 5d                	pop    %r13
+  802e1d:	5d                   	pop    %rbp
+  802e1e:	c3                   	ret
+  802e1f:	48 89 d0             	mov    %rdx,%rax
+  802e22:	c3                   	ret
+
+0000000000802e23 <cputchar>:
+cputchar(int ch) {
+  802e23:	55                   	push   %rbp
+  802e24:	48 89 e5             	mov    %rsp,%rbp
+  802e27:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e2b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e2f:	be 01 00 00 00       	mov    $0x1,%esi
+  802e34:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e38:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  802e3f:	00 00 00 
+  802e42:	ff d0                	call   *%rax
+}
+  802e44:	c9                   	leave
+  802e45:	c3                   	ret
+
+0000000000802e46 <getchar>:
+getchar(void) {
+  802e46:	55                   	push   %rbp
+  802e47:	48 89 e5             	mov    %rsp,%rbp
+  802e4a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e4e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e53:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e57:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5c:	48 b8 04 10 80 00 00 	movabs $0x801004,%rax
+  802e63:	00 00 00 
+  802e66:	ff d0                	call   *%rax
+  802e68:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e6a:	85 c0                	test   %eax,%eax
+  802e6c:	78 06                	js     802e74 <getchar+0x2e>
+  802e6e:	74 08                	je     802e78 <getchar+0x32>
+  802e70:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e74:	89 d0                	mov    %edx,%eax
+  802e76:	c9                   	leave
+  802e77:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e78:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e7d:	eb f5                	jmp    802e74 <getchar+0x2e>
+
+0000000000802e7f <iscons>:
+iscons(int fdnum) {
+  802e7f:	55                   	push   %rbp
+  802e80:	48 89 e5             	mov    %rsp,%rbp
+  802e83:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e87:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e8b:	48 b8 21 0d 80 00 00 	movabs $0x800d21,%rax
+  802e92:	00 00 00 
+  802e95:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e97:	85 c0                	test   %eax,%eax
+  802e99:	78 18                	js     802eb3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e9b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e9f:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  802ea6:	00 00 00 
+  802ea9:	8b 00                	mov    (%rax),%eax
+  802eab:	39 02                	cmp    %eax,(%rdx)
+  802ead:	0f 94 c0             	sete   %al
+  802eb0:	0f b6 c0             	movzbl %al,%eax
+}
+  802eb3:	c9                   	leave
+  802eb4:	c3                   	ret
+
+0000000000802eb5 <opencons>:
+opencons(void) {
+  802eb5:	55                   	push   %rbp
+  802eb6:	48 89 e5             	mov    %rsp,%rbp
+  802eb9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ebd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ec1:	48 b8 c1 0c 80 00 00 	movabs $0x800cc1,%rax
+  802ec8:	00 00 00 
+  802ecb:	ff d0                	call   *%rax
+  802ecd:	85 c0                	test   %eax,%eax
+  802ecf:	78 49                	js     802f1a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ed1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ed6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802edb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802edf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee4:	48 b8 7d 02 80 00 00 	movabs $0x80027d,%rax
+  802eeb:	00 00 00 
+  802eee:	ff d0                	call   *%rax
+  802ef0:	85 c0                	test   %eax,%eax
+  802ef2:	78 26                	js     802f1a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802ef4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ef8:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  802eff:	00 00 
+  802f01:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f03:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f07:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f0e:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  802f15:	00 00 00 
+  802f18:	ff d0                	call   *%rax
+}
+  802f1a:	c9                   	leave
+  802f1b:	c3                   	ret
+
+0000000000802f1c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f1c:	55                   	push   %rbp
+  802f1d:	48 89 e5             	mov    %rsp,%rbp
+  802f20:	41 56                	push   %r14
+  802f22:	41 55                	push   %r13
+  802f24:	41 54                	push   %r12
+  802f26:	53                   	push   %rbx
+  802f27:	48 83 ec 50          	sub    $0x50,%rsp
+  802f2b:	49 89 fc             	mov    %rdi,%r12
+  802f2e:	41 89 f5             	mov    %esi,%r13d
+  802f31:	48 89 d3             	mov    %rdx,%rbx
+  802f34:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802f38:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802f3c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802f40:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802f47:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802f4b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802f4f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802f53:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f57:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802f5e:	00 00 00 
+  802f61:	4c 8b 30             	mov    (%rax),%r14
+  802f64:	48 b8 bd 01 80 00 00 	movabs $0x8001bd,%rax
+  802f6b:	00 00 00 
+  802f6e:	ff d0                	call   *%rax
+  802f70:	89 c6                	mov    %eax,%esi
+  802f72:	45 89 e8             	mov    %r13d,%r8d
+  802f75:	4c 89 e1             	mov    %r12,%rcx
+  802f78:	4c 89 f2             	mov    %r14,%rdx
+  802f7b:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  802f82:	00 00 00 
+  802f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8a:	49 bc 6c 30 80 00 00 	movabs $0x80306c,%r12
+  802f91:	00 00 00 
+  802f94:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802f97:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802f9b:	48 89 df             	mov    %rbx,%rdi
+  802f9e:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  802fa5:	00 00 00 
+  802fa8:	ff d0                	call   *%rax
+    cprintf("\n");
+  802faa:	48 bf 13 51 80 00 00 	movabs $0x805113,%rdi
+  802fb1:	00 00 00 
+  802fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802fbc:	cc                   	int3
+  802fbd:	eb fd                	jmp    802fbc <_panic+0xa0>
+
+0000000000802fbf <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802fbf:	55                   	push   %rbp
+  802fc0:	48 89 e5             	mov    %rsp,%rbp
+  802fc3:	53                   	push   %rbx
+  802fc4:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802fcb:	8b 06                	mov    (%rsi),%eax
+  802fcd:	8d 50 01             	lea    0x1(%rax),%edx
+  802fd0:	89 16                	mov    %edx,(%rsi)
+  802fd2:	48 98                	cltq
+  802fd4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802fd9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802fdf:	74 0a                	je     802feb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802fe1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802fe5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fe9:	c9                   	leave
+  802fea:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802feb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802fef:	be ff 00 00 00       	mov    $0xff,%esi
+  802ff4:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  802ffb:	00 00 00 
+  802ffe:	ff d0                	call   *%rax
+        state->offset = 0;
+  803000:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803006:	eb d9                	jmp    802fe1 <putch+0x22>
+
+0000000000803008 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803008:	55                   	push   %rbp
+  803009:	48 89 e5             	mov    %rsp,%rbp
+  80300c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803013:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803016:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80301d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803022:	b8 00 00 00 00       	mov    $0x0,%eax
+  803027:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80302a:	48 89 f1             	mov    %rsi,%rcx
+  80302d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803034:	48 bf bf 2f 80 00 00 	movabs $0x802fbf,%rdi
+  80303b:	00 00 00 
+  80303e:	48 b8 bc 31 80 00 00 	movabs $0x8031bc,%rax
+  803045:	00 00 00 
+  803048:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80304a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803051:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803058:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  80305f:	00 00 00 
+  803062:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  803064:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80306a:	c9                   	leave
+  80306b:	c3                   	ret
+
+000000000080306c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80306c:	55                   	push   %rbp
+  80306d:	48 89 e5             	mov    %rsp,%rbp
+  803070:	48 83 ec 50          	sub    $0x50,%rsp
+  803074:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803078:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80307c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803080:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803084:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803088:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80308f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803093:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803097:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80309b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80309f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8030a3:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  8030aa:	00 00 00 
+  8030ad:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8030af:	c9                   	leave
+  8030b0:	c3                   	ret
+
+00000000008030b1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8030b1:	55                   	push   %rbp
+  8030b2:	48 89 e5             	mov    %rsp,%rbp
+  8030b5:	41 57                	push   %r15
+  8030b7:	41 56                	push   %r14
+  8030b9:	41 55                	push   %r13
+  8030bb:	41 54                	push   %r12
+  8030bd:	53                   	push   %rbx
+  8030be:	48 83 ec 18          	sub    $0x18,%rsp
+  8030c2:	49 89 fc             	mov    %rdi,%r12
+  8030c5:	49 89 f5             	mov    %rsi,%r13
+  8030c8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8030cc:	8b 45 10             	mov    0x10(%rbp),%eax
+  8030cf:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8030d2:	41 89 cf             	mov    %ecx,%r15d
+  8030d5:	4c 39 fa             	cmp    %r15,%rdx
+  8030d8:	73 5b                	jae    803135 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8030da:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8030de:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8030e2:	85 db                	test   %ebx,%ebx
+  8030e4:	7e 0e                	jle    8030f4 <print_num+0x43>
+            putch(padc, put_arg);
+  8030e6:	4c 89 ee             	mov    %r13,%rsi
+  8030e9:	44 89 f7             	mov    %r14d,%edi
+  8030ec:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8030ef:	83 eb 01             	sub    $0x1,%ebx
+  8030f2:	75 f2                	jne    8030e6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8030f4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8030f8:	48 b9 f4 51 80 00 00 	movabs $0x8051f4,%rcx
+  8030ff:	00 00 00 
+  803102:	48 b8 e3 51 80 00 00 	movabs $0x8051e3,%rax
+  803109:	00 00 00 
+  80310c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803110:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803114:	ba 00 00 00 00       	mov    $0x0,%edx
+  803119:	49 f7 f7             	div    %r15
+  80311c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803120:	4c 89 ee             	mov    %r13,%rsi
+  803123:	41 ff d4             	call   *%r12
+}
+  803126:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80312a:	5b                   	pop    %rbx
+  80312b:	41 5c                	pop    %r12
+  80312d:	41 5d                	pop    %r13
+  80312f:	41 5e                	pop    %r14
+  803131:	41 5f                	pop    %r15
+  803133:	5d                   	pop    %rbp
+  803134:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803135:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313e:	49 f7 f7             	div    %r15
+  803141:	48 83 ec 08          	sub    $0x8,%rsp
+  803145:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803149:	52                   	push   %rdx
+  80314a:	45 0f be c9          	movsbl %r9b,%r9d
+  80314e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803152:	48 89 c2             	mov    %rax,%rdx
+  803155:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  80315c:	00 00 00 
+  80315f:	ff d0                	call   *%rax
+  803161:	48 83 c4 10          	add    $0x10,%rsp
+  803165:	eb 8d                	jmp    8030f4 <print_num+0x43>
+
+0000000000803167 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803167:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80316b:	48 8b 06             	mov    (%rsi),%rax
+  80316e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  803172:	73 0a                	jae    80317e <sprintputch+0x17>
+        *state->start++ = ch;
+  803174:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803178:	48 89 16             	mov    %rdx,(%rsi)
+  80317b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80317e:	c3                   	ret
+
+000000000080317f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80317f:	55                   	push   %rbp
+  803180:	48 89 e5             	mov    %rsp,%rbp
+  803183:	48 83 ec 50          	sub    $0x50,%rsp
+  803187:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80318b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80318f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  803193:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80319a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80319e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031a2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8031aa:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8031ae:	48 b8 bc 31 80 00 00 	movabs $0x8031bc,%rax
+  8031b5:	00 00 00 
+  8031b8:	ff d0                	call   *%rax
+}
+  8031ba:	c9                   	leave
+  8031bb:	c3                   	ret
+
+00000000008031bc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8031bc:	55                   	push   %rbp
+  8031bd:	48 89 e5             	mov    %rsp,%rbp
+  8031c0:	41 57                	push   %r15
+  8031c2:	41 56                	push   %r14
+  8031c4:	41 55                	push   %r13
+  8031c6:	41 54                	push   %r12
+  8031c8:	53                   	push   %rbx
+  8031c9:	48 83 ec 38          	sub    $0x38,%rsp
+  8031cd:	49 89 fe             	mov    %rdi,%r14
+  8031d0:	49 89 f5             	mov    %rsi,%r13
+  8031d3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8031d6:	48 8b 01             	mov    (%rcx),%rax
+  8031d9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8031dd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8031e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031e5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8031e9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8031ed:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8031f1:	0f b6 3b             	movzbl (%rbx),%edi
+  8031f4:	40 80 ff 25          	cmp    $0x25,%dil
+  8031f8:	74 18                	je     803212 <vprintfmt+0x56>
+            if (!ch) return;
+  8031fa:	40 84 ff             	test   %dil,%dil
+  8031fd:	0f 84 04 07 00 00    	je     803907 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  803203:	40 0f b6 ff          	movzbl %dil,%edi
+  803207:	4c 89 ee             	mov    %r13,%rsi
+  80320a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80320d:	4c 89 e3             	mov    %r12,%rbx
+  803210:	eb db                	jmp    8031ed <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803212:	be 00 00 00 00       	mov    $0x0,%esi
+  803217:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80321b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803220:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803226:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80322d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803231:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803236:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80323b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80323e:	83 e8 23             	sub    $0x23,%eax
+  803241:	3c 57                	cmp    $0x57,%al
+  803243:	0f 87 a4 06 00 00    	ja     8038ed <vprintfmt+0x731>
+  803249:	0f b6 c0             	movzbl %al,%eax
+  80324c:	48 b9 80 53 80 00 00 	movabs $0x805380,%rcx
+  803253:	00 00 00 
+  803256:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803259:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80325c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803260:	eb cf                	jmp    803231 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  803262:	49 89 dc             	mov    %rbx,%r12
+  803265:	be 01 00 00 00       	mov    $0x1,%esi
+  80326a:	eb c5                	jmp    803231 <vprintfmt+0x75>
+            padc = ch;
+  80326c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  803270:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803273:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803276:	eb b9                	jmp    803231 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803278:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80327b:	83 f8 2f             	cmp    $0x2f,%eax
+  80327e:	77 24                	ja     8032a4 <vprintfmt+0xe8>
+  803280:	89 c1                	mov    %eax,%ecx
+  803282:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  803286:	83 c0 08             	add    $0x8,%eax
+  803289:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80328c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80328f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  803292:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803296:	79 99                	jns    803231 <vprintfmt+0x75>
+                width = precision;
+  803298:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80329c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8032a2:	eb 8d                	jmp    803231 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8032a4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032a8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8032ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032b0:	eb da                	jmp    80328c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8032b2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8032b7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032bb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8032c1:	3c 39                	cmp    $0x39,%al
+  8032c3:	77 1c                	ja     8032e1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8032c5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8032c9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8032cd:	0f b6 c0             	movzbl %al,%eax
+  8032d0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8032d5:	0f b6 03             	movzbl (%rbx),%eax
+  8032d8:	3c 39                	cmp    $0x39,%al
+  8032da:	76 e9                	jbe    8032c5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8032dc:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8032df:	eb b1                	jmp    803292 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8032e1:	49 89 dc             	mov    %rbx,%r12
+  8032e4:	eb ac                	jmp    803292 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8032e6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8032e9:	85 c9                	test   %ecx,%ecx
+  8032eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f0:	0f 49 c1             	cmovns %ecx,%eax
+  8032f3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8032f6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8032f9:	e9 33 ff ff ff       	jmp    803231 <vprintfmt+0x75>
+            lflag++;
+  8032fe:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803301:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803304:	e9 28 ff ff ff       	jmp    803231 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803309:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80330c:	83 f8 2f             	cmp    $0x2f,%eax
+  80330f:	77 19                	ja     80332a <vprintfmt+0x16e>
+  803311:	89 c2                	mov    %eax,%edx
+  803313:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803317:	83 c0 08             	add    $0x8,%eax
+  80331a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80331d:	8b 3a                	mov    (%rdx),%edi
+  80331f:	4c 89 ee             	mov    %r13,%rsi
+  803322:	41 ff d6             	call   *%r14
+            break;
+  803325:	e9 c3 fe ff ff       	jmp    8031ed <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80332a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80332e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803332:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803336:	eb e5                	jmp    80331d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803338:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80333b:	83 f8 2f             	cmp    $0x2f,%eax
+  80333e:	77 5a                	ja     80339a <vprintfmt+0x1de>
+  803340:	89 c2                	mov    %eax,%edx
+  803342:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803346:	83 c0 08             	add    $0x8,%eax
+  803349:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80334c:	8b 02                	mov    (%rdx),%eax
+  80334e:	89 c1                	mov    %eax,%ecx
+  803350:	f7 d9                	neg    %ecx
+  803352:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803355:	83 f9 13             	cmp    $0x13,%ecx
+  803358:	7f 4e                	jg     8033a8 <vprintfmt+0x1ec>
+  80335a:	48 63 c1             	movslq %ecx,%rax
+  80335d:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  803364:	00 00 00 
+  803367:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80336b:	48 85 c0             	test   %rax,%rax
+  80336e:	74 38                	je     8033a8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803370:	48 89 c1             	mov    %rax,%rcx
+  803373:	48 ba 79 51 80 00 00 	movabs $0x805179,%rdx
+  80337a:	00 00 00 
+  80337d:	4c 89 ee             	mov    %r13,%rsi
+  803380:	4c 89 f7             	mov    %r14,%rdi
+  803383:	b8 00 00 00 00       	mov    $0x0,%eax
+  803388:	49 b8 7f 31 80 00 00 	movabs $0x80317f,%r8
+  80338f:	00 00 00 
+  803392:	41 ff d0             	call   *%r8
+  803395:	e9 53 fe ff ff       	jmp    8031ed <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80339a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80339e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8033a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033a6:	eb a4                	jmp    80334c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8033a8:	48 ba 0c 52 80 00 00 	movabs $0x80520c,%rdx
+  8033af:	00 00 00 
+  8033b2:	4c 89 ee             	mov    %r13,%rsi
+  8033b5:	4c 89 f7             	mov    %r14,%rdi
+  8033b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033bd:	49 b8 7f 31 80 00 00 	movabs $0x80317f,%r8
+  8033c4:	00 00 00 
+  8033c7:	41 ff d0             	call   *%r8
+  8033ca:	e9 1e fe ff ff       	jmp    8031ed <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8033cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8033d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8033d5:	77 36                	ja     80340d <vprintfmt+0x251>
+  8033d7:	89 c2                	mov    %eax,%edx
+  8033d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8033dd:	83 c0 08             	add    $0x8,%eax
+  8033e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8033e3:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8033e6:	48 85 f6             	test   %rsi,%rsi
+  8033e9:	48 b8 05 52 80 00 00 	movabs $0x805205,%rax
+  8033f0:	00 00 00 
+  8033f3:	48 0f 45 c6          	cmovne %rsi,%rax
+  8033f7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8033fb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8033ff:	7e 06                	jle    803407 <vprintfmt+0x24b>
+  803401:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803405:	75 14                	jne    80341b <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803407:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80340b:	eb 5b                	jmp    803468 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80340d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803411:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803415:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803419:	eb c8                	jmp    8033e3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80341b:	49 63 f7             	movslq %r15d,%rsi
+  80341e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803422:	48 b8 c1 39 80 00 00 	movabs $0x8039c1,%rax
+  803429:	00 00 00 
+  80342c:	ff d0                	call   *%rax
+  80342e:	48 89 c2             	mov    %rax,%rdx
+  803431:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803434:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803436:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803439:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80343c:	85 c0                	test   %eax,%eax
+  80343e:	7e c7                	jle    803407 <vprintfmt+0x24b>
+  803440:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803445:	4c 89 ee             	mov    %r13,%rsi
+  803448:	44 89 e7             	mov    %r12d,%edi
+  80344b:	41 ff d6             	call   *%r14
+  80344e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803452:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803455:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803458:	75 eb                	jne    803445 <vprintfmt+0x289>
+  80345a:	eb ab                	jmp    803407 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80345c:	0f b6 f8             	movzbl %al,%edi
+  80345f:	4c 89 ee             	mov    %r13,%rsi
+  803462:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  803465:	4c 89 e2             	mov    %r12,%rdx
+  803468:	45 85 ff             	test   %r15d,%r15d
+  80346b:	78 06                	js     803473 <vprintfmt+0x2b7>
+  80346d:	41 83 ef 01          	sub    $0x1,%r15d
+  803471:	78 23                	js     803496 <vprintfmt+0x2da>
+  803473:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  803477:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80347d:	84 c0                	test   %al,%al
+  80347f:	74 15                	je     803496 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803481:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803485:	74 d5                	je     80345c <vprintfmt+0x2a0>
+  803487:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80348a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80348f:	80 fa 5e             	cmp    $0x5e,%dl
+  803492:	77 cb                	ja     80345f <vprintfmt+0x2a3>
+  803494:	eb c6                	jmp    80345c <vprintfmt+0x2a0>
+  803496:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803499:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  80349c:	01 f0                	add    %esi,%eax
+  80349e:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8034a0:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8034a4:	85 c0                	test   %eax,%eax
+  8034a6:	0f 8e 41 fd ff ff    	jle    8031ed <vprintfmt+0x31>
+  8034ac:	4c 89 ee             	mov    %r13,%rsi
+  8034af:	bf 20 00 00 00       	mov    $0x20,%edi
+  8034b4:	41 ff d6             	call   *%r14
+  8034b7:	41 83 ec 01          	sub    $0x1,%r12d
+  8034bb:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8034bf:	75 eb                	jne    8034ac <vprintfmt+0x2f0>
+  8034c1:	e9 27 fd ff ff       	jmp    8031ed <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8034c6:	40 84 f6             	test   %sil,%sil
+  8034c9:	75 26                	jne    8034f1 <vprintfmt+0x335>
+    switch (lflag) {
+  8034cb:	85 d2                	test   %edx,%edx
+  8034cd:	74 59                	je     803528 <vprintfmt+0x36c>
+  8034cf:	83 fa 01             	cmp    $0x1,%edx
+  8034d2:	74 7b                	je     80354f <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8034d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8034da:	0f 87 96 00 00 00    	ja     803576 <vprintfmt+0x3ba>
+  8034e0:	89 c2                	mov    %eax,%edx
+  8034e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034e6:	83 c0 08             	add    $0x8,%eax
+  8034e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8034ec:	4c 8b 22             	mov    (%rdx),%r12
+  8034ef:	eb 17                	jmp    803508 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8034f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8034f7:	77 21                	ja     80351a <vprintfmt+0x35e>
+  8034f9:	89 c2                	mov    %eax,%edx
+  8034fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8034ff:	83 c0 08             	add    $0x8,%eax
+  803502:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803505:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803508:	4d 85 e4             	test   %r12,%r12
+  80350b:	78 7a                	js     803587 <vprintfmt+0x3cb>
+            num = i;
+  80350d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803510:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803515:	e9 b5 02 00 00       	jmp    8037cf <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80351a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80351e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803522:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803526:	eb dd                	jmp    803505 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  803528:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80352b:	83 f8 2f             	cmp    $0x2f,%eax
+  80352e:	77 11                	ja     803541 <vprintfmt+0x385>
+  803530:	89 c2                	mov    %eax,%edx
+  803532:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803536:	83 c0 08             	add    $0x8,%eax
+  803539:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80353c:	4c 63 22             	movslq (%rdx),%r12
+  80353f:	eb c7                	jmp    803508 <vprintfmt+0x34c>
+  803541:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803545:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803549:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80354d:	eb ed                	jmp    80353c <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80354f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803552:	83 f8 2f             	cmp    $0x2f,%eax
+  803555:	77 11                	ja     803568 <vprintfmt+0x3ac>
+  803557:	89 c2                	mov    %eax,%edx
+  803559:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80355d:	83 c0 08             	add    $0x8,%eax
+  803560:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803563:	4c 8b 22             	mov    (%rdx),%r12
+  803566:	eb a0                	jmp    803508 <vprintfmt+0x34c>
+  803568:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80356c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803570:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803574:	eb ed                	jmp    803563 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  803576:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80357a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80357e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803582:	e9 65 ff ff ff       	jmp    8034ec <vprintfmt+0x330>
+                putch('-', put_arg);
+  803587:	4c 89 ee             	mov    %r13,%rsi
+  80358a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80358f:	41 ff d6             	call   *%r14
+                i = -i;
+  803592:	49 f7 dc             	neg    %r12
+  803595:	e9 73 ff ff ff       	jmp    80350d <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  80359a:	40 84 f6             	test   %sil,%sil
+  80359d:	75 32                	jne    8035d1 <vprintfmt+0x415>
+    switch (lflag) {
+  80359f:	85 d2                	test   %edx,%edx
+  8035a1:	74 5d                	je     803600 <vprintfmt+0x444>
+  8035a3:	83 fa 01             	cmp    $0x1,%edx
+  8035a6:	0f 84 82 00 00 00    	je     80362e <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8035ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035af:	83 f8 2f             	cmp    $0x2f,%eax
+  8035b2:	0f 87 a5 00 00 00    	ja     80365d <vprintfmt+0x4a1>
+  8035b8:	89 c2                	mov    %eax,%edx
+  8035ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035be:	83 c0 08             	add    $0x8,%eax
+  8035c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035c4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035c7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8035cc:	e9 fe 01 00 00       	jmp    8037cf <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8035d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8035d7:	77 19                	ja     8035f2 <vprintfmt+0x436>
+  8035d9:	89 c2                	mov    %eax,%edx
+  8035db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8035df:	83 c0 08             	add    $0x8,%eax
+  8035e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8035e5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8035e8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8035ed:	e9 dd 01 00 00       	jmp    8037cf <vprintfmt+0x613>
+  8035f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8035fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035fe:	eb e5                	jmp    8035e5 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  803600:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803603:	83 f8 2f             	cmp    $0x2f,%eax
+  803606:	77 18                	ja     803620 <vprintfmt+0x464>
+  803608:	89 c2                	mov    %eax,%edx
+  80360a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80360e:	83 c0 08             	add    $0x8,%eax
+  803611:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803614:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803616:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80361b:	e9 af 01 00 00       	jmp    8037cf <vprintfmt+0x613>
+  803620:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803624:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803628:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80362c:	eb e6                	jmp    803614 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80362e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803631:	83 f8 2f             	cmp    $0x2f,%eax
+  803634:	77 19                	ja     80364f <vprintfmt+0x493>
+  803636:	89 c2                	mov    %eax,%edx
+  803638:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80363c:	83 c0 08             	add    $0x8,%eax
+  80363f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803642:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803645:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80364a:	e9 80 01 00 00       	jmp    8037cf <vprintfmt+0x613>
+  80364f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803653:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803657:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80365b:	eb e5                	jmp    803642 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80365d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803661:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803665:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803669:	e9 56 ff ff ff       	jmp    8035c4 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80366e:	40 84 f6             	test   %sil,%sil
+  803671:	75 2e                	jne    8036a1 <vprintfmt+0x4e5>
+    switch (lflag) {
+  803673:	85 d2                	test   %edx,%edx
+  803675:	0f 84 b3 00 00 00    	je     80372e <vprintfmt+0x572>
+  80367b:	83 fa 01             	cmp    $0x1,%edx
+  80367e:	0f 84 d3 00 00 00    	je     803757 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  803684:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803687:	83 f8 2f             	cmp    $0x2f,%eax
+  80368a:	0f 87 f1 00 00 00    	ja     803781 <vprintfmt+0x5c5>
+  803690:	89 c2                	mov    %eax,%edx
+  803692:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803696:	83 c0 08             	add    $0x8,%eax
+  803699:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80369c:	48 8b 02             	mov    (%rdx),%rax
+  80369f:	eb 17                	jmp    8036b8 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8036a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8036a7:	77 77                	ja     803720 <vprintfmt+0x564>
+  8036a9:	89 c2                	mov    %eax,%edx
+  8036ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8036af:	83 c0 08             	add    $0x8,%eax
+  8036b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036b5:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8036b8:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036ba:	83 f8 07             	cmp    $0x7,%eax
+  8036bd:	0f 8e cf 00 00 00    	jle    803792 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8036c3:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8036c9:	44 89 e7             	mov    %r12d,%edi
+  8036cc:	41 c1 e4 03          	shl    $0x3,%r12d
+  8036d0:	89 d1                	mov    %edx,%ecx
+  8036d2:	8d 72 07             	lea    0x7(%rdx),%esi
+  8036d5:	85 d2                	test   %edx,%edx
+  8036d7:	0f 48 d6             	cmovs  %esi,%edx
+  8036da:	c1 fa 03             	sar    $0x3,%edx
+  8036dd:	83 f9 3f             	cmp    $0x3f,%ecx
+  8036e0:	7f e7                	jg     8036c9 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8036e2:	85 ff                	test   %edi,%edi
+  8036e4:	0f 84 03 fb ff ff    	je     8031ed <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8036ea:	49 63 f4             	movslq %r12d,%rsi
+  8036ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036f2:	48 f7 f6             	div    %rsi
+  8036f5:	49 89 d7             	mov    %rdx,%r15
+  8036f8:	83 c0 30             	add    $0x30,%eax
+  8036fb:	0f be f8             	movsbl %al,%edi
+  8036fe:	4c 89 ee             	mov    %r13,%rsi
+  803701:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  803704:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  803707:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  80370c:	45 85 e4             	test   %r12d,%r12d
+  80370f:	41 0f 49 d4          	cmovns %r12d,%edx
+  803713:	c1 fa 03             	sar    $0x3,%edx
+  803716:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  803719:	75 cf                	jne    8036ea <vprintfmt+0x52e>
+  80371b:	e9 cd fa ff ff       	jmp    8031ed <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  803720:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803724:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803728:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80372c:	eb 87                	jmp    8036b5 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80372e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803731:	83 f8 2f             	cmp    $0x2f,%eax
+  803734:	77 13                	ja     803749 <vprintfmt+0x58d>
+  803736:	89 c2                	mov    %eax,%edx
+  803738:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80373c:	83 c0 08             	add    $0x8,%eax
+  80373f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803742:	8b 02                	mov    (%rdx),%eax
+  803744:	e9 6f ff ff ff       	jmp    8036b8 <vprintfmt+0x4fc>
+  803749:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80374d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803751:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803755:	eb eb                	jmp    803742 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  803757:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80375a:	83 f8 2f             	cmp    $0x2f,%eax
+  80375d:	77 14                	ja     803773 <vprintfmt+0x5b7>
+  80375f:	89 c2                	mov    %eax,%edx
+  803761:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803765:	83 c0 08             	add    $0x8,%eax
+  803768:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80376b:	48 8b 02             	mov    (%rdx),%rax
+  80376e:	e9 45 ff ff ff       	jmp    8036b8 <vprintfmt+0x4fc>
+  803773:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803777:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80377b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80377f:	eb ea                	jmp    80376b <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  803781:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803785:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803789:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80378d:	e9 0a ff ff ff       	jmp    80369c <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  803792:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  803798:	e9 4d ff ff ff       	jmp    8036ea <vprintfmt+0x52e>
+            putch('0', put_arg);
+  80379d:	4c 89 ee             	mov    %r13,%rsi
+  8037a0:	bf 30 00 00 00       	mov    $0x30,%edi
+  8037a5:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8037a8:	4c 89 ee             	mov    %r13,%rsi
+  8037ab:	bf 78 00 00 00       	mov    $0x78,%edi
+  8037b0:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8037b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8037b9:	77 47                	ja     803802 <vprintfmt+0x646>
+  8037bb:	89 c2                	mov    %eax,%edx
+  8037bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037c1:	83 c0 08             	add    $0x8,%eax
+  8037c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037c7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8037ca:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8037cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8037d3:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8037d7:	0f 94 c0             	sete   %al
+  8037da:	0f b6 c0             	movzbl %al,%eax
+  8037dd:	50                   	push   %rax
+  8037de:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8037e3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8037e7:	4c 89 ee             	mov    %r13,%rsi
+  8037ea:	4c 89 f7             	mov    %r14,%rdi
+  8037ed:	48 b8 b1 30 80 00 00 	movabs $0x8030b1,%rax
+  8037f4:	00 00 00 
+  8037f7:	ff d0                	call   *%rax
+            break;
+  8037f9:	48 83 c4 10          	add    $0x10,%rsp
+  8037fd:	e9 eb f9 ff ff       	jmp    8031ed <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803802:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803806:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80380a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80380e:	eb b7                	jmp    8037c7 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  803810:	40 84 f6             	test   %sil,%sil
+  803813:	75 2b                	jne    803840 <vprintfmt+0x684>
+    switch (lflag) {
+  803815:	85 d2                	test   %edx,%edx
+  803817:	74 56                	je     80386f <vprintfmt+0x6b3>
+  803819:	83 fa 01             	cmp    $0x1,%edx
+  80381c:	74 7f                	je     80389d <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  80381e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803821:	83 f8 2f             	cmp    $0x2f,%eax
+  803824:	0f 87 a2 00 00 00    	ja     8038cc <vprintfmt+0x710>
+  80382a:	89 c2                	mov    %eax,%edx
+  80382c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803830:	83 c0 08             	add    $0x8,%eax
+  803833:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803836:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803839:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80383e:	eb 8f                	jmp    8037cf <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  803840:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803843:	83 f8 2f             	cmp    $0x2f,%eax
+  803846:	77 19                	ja     803861 <vprintfmt+0x6a5>
+  803848:	89 c2                	mov    %eax,%edx
+  80384a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80384e:	83 c0 08             	add    $0x8,%eax
+  803851:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803854:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803857:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80385c:	e9 6e ff ff ff       	jmp    8037cf <vprintfmt+0x613>
+  803861:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803865:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803869:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80386d:	eb e5                	jmp    803854 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  80386f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803872:	83 f8 2f             	cmp    $0x2f,%eax
+  803875:	77 18                	ja     80388f <vprintfmt+0x6d3>
+  803877:	89 c2                	mov    %eax,%edx
+  803879:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80387d:	83 c0 08             	add    $0x8,%eax
+  803880:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803883:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803885:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80388a:	e9 40 ff ff ff       	jmp    8037cf <vprintfmt+0x613>
+  80388f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803893:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803897:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80389b:	eb e6                	jmp    803883 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  80389d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8038a3:	77 19                	ja     8038be <vprintfmt+0x702>
+  8038a5:	89 c2                	mov    %eax,%edx
+  8038a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8038ab:	83 c0 08             	add    $0x8,%eax
+  8038ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8038b1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8038b4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8038b9:	e9 11 ff ff ff       	jmp    8037cf <vprintfmt+0x613>
+  8038be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038ca:	eb e5                	jmp    8038b1 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  8038cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038d8:	e9 59 ff ff ff       	jmp    803836 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8038dd:	4c 89 ee             	mov    %r13,%rsi
+  8038e0:	bf 25 00 00 00       	mov    $0x25,%edi
+  8038e5:	41 ff d6             	call   *%r14
+            break;
+  8038e8:	e9 00 f9 ff ff       	jmp    8031ed <vprintfmt+0x31>
+            putch('%', put_arg);
+  8038ed:	4c 89 ee             	mov    %r13,%rsi
+  8038f0:	bf 25 00 00 00       	mov    $0x25,%edi
+  8038f5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8038f8:	48 83 eb 01          	sub    $0x1,%rbx
+  8038fc:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803900:	75 f6                	jne    8038f8 <vprintfmt+0x73c>
+  803902:	e9 e6 f8 ff ff       	jmp    8031ed <vprintfmt+0x31>
+}
+  803907:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80390b:	5b                   	pop    %rbx
+  80390c:	41 5c                	pop    %r12
+  80390e:	41 5d                	pop    %r13
+  803910:	41 5e                	pop    %r14
+  803912:	41 5f                	pop    %r15
+  803914:	5d                   	pop    %rbp
+  803915:	c3                   	ret
+
+0000000000803916 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803916:	55                   	push   %rbp
+  803917:	48 89 e5             	mov    %rsp,%rbp
+  80391a:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80391e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803922:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803927:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80392b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803932:	48 85 ff             	test   %rdi,%rdi
+  803935:	74 2b                	je     803962 <vsnprintf+0x4c>
+  803937:	48 85 f6             	test   %rsi,%rsi
+  80393a:	74 26                	je     803962 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80393c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803940:	48 bf 67 31 80 00 00 	movabs $0x803167,%rdi
+  803947:	00 00 00 
+  80394a:	48 b8 bc 31 80 00 00 	movabs $0x8031bc,%rax
+  803951:	00 00 00 
+  803954:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803956:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80395a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80395d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803960:	c9                   	leave
+  803961:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803962:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803967:	eb f7                	jmp    803960 <vsnprintf+0x4a>
+
+0000000000803969 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803969:	55                   	push   %rbp
+  80396a:	48 89 e5             	mov    %rsp,%rbp
+  80396d:	48 83 ec 50          	sub    $0x50,%rsp
+  803971:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803975:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803979:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80397d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803984:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803988:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80398c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803990:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803994:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803998:	48 b8 16 39 80 00 00 	movabs $0x803916,%rax
+  80399f:	00 00 00 
+  8039a2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8039a4:	c9                   	leave
+  8039a5:	c3                   	ret
+
+00000000008039a6 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8039a6:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8039a9:	74 10                	je     8039bb <strlen+0x15>
+    size_t n = 0;
+  8039ab:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8039b0:	48 83 c0 01          	add    $0x1,%rax
+  8039b4:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8039b8:	75 f6                	jne    8039b0 <strlen+0xa>
+  8039ba:	c3                   	ret
+    size_t n = 0;
+  8039bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8039c0:	c3                   	ret
+
+00000000008039c1 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8039c1:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8039c4:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8039c9:	48 85 f6             	test   %rsi,%rsi
+  8039cc:	74 11                	je     8039df <strnlen+0x1e>
+  8039ce:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8039d2:	74 0c                	je     8039e0 <strnlen+0x1f>
+  8039d4:	48 83 c2 01          	add    $0x1,%rdx
+  8039d8:	48 39 d0             	cmp    %rdx,%rax
+  8039db:	75 f1                	jne    8039ce <strnlen+0xd>
+  8039dd:	eb 04                	jmp    8039e3 <strnlen+0x22>
+  8039df:	c3                   	ret
+  8039e0:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8039e3:	c3                   	ret
+
+00000000008039e4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8039e4:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8039e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039ec:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8039f0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8039f3:	48 83 c2 01          	add    $0x1,%rdx
+  8039f7:	84 c9                	test   %cl,%cl
+  8039f9:	75 f1                	jne    8039ec <strcpy+0x8>
+        ;
+    return res;
+}
+  8039fb:	c3                   	ret
+
+00000000008039fc <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8039fc:	55                   	push   %rbp
+  8039fd:	48 89 e5             	mov    %rsp,%rbp
+  803a00:	41 54                	push   %r12
+  803a02:	53                   	push   %rbx
+  803a03:	48 89 fb             	mov    %rdi,%rbx
+  803a06:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803a09:	48 b8 a6 39 80 00 00 	movabs $0x8039a6,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803a15:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803a19:	4c 89 e6             	mov    %r12,%rsi
+  803a1c:	48 b8 e4 39 80 00 00 	movabs $0x8039e4,%rax
+  803a23:	00 00 00 
+  803a26:	ff d0                	call   *%rax
+    return dst;
+}
+  803a28:	48 89 d8             	mov    %rbx,%rax
+  803a2b:	5b                   	pop    %rbx
+  803a2c:	41 5c                	pop    %r12
+  803a2e:	5d                   	pop    %rbp
+  803a2f:	c3                   	ret
+
+0000000000803a30 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803a30:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803a33:	48 85 d2             	test   %rdx,%rdx
+  803a36:	74 1f                	je     803a57 <strncpy+0x27>
+  803a38:	48 01 fa             	add    %rdi,%rdx
+  803a3b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803a3e:	48 83 c1 01          	add    $0x1,%rcx
+  803a42:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803a46:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803a4a:	41 80 f8 01          	cmp    $0x1,%r8b
+  803a4e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803a52:	48 39 ca             	cmp    %rcx,%rdx
+  803a55:	75 e7                	jne    803a3e <strncpy+0xe>
+    }
+    return ret;
+}
+  803a57:	c3                   	ret
+
+0000000000803a58 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803a58:	48 89 f8             	mov    %rdi,%rax
+  803a5b:	48 85 d2             	test   %rdx,%rdx
+  803a5e:	74 24                	je     803a84 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803a60:	48 83 ea 01          	sub    $0x1,%rdx
+  803a64:	74 1b                	je     803a81 <strlcpy+0x29>
+  803a66:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803a6a:	0f b6 16             	movzbl (%rsi),%edx
+  803a6d:	84 d2                	test   %dl,%dl
+  803a6f:	74 10                	je     803a81 <strlcpy+0x29>
+            *dst++ = *src++;
+  803a71:	48 83 c6 01          	add    $0x1,%rsi
+  803a75:	48 83 c0 01          	add    $0x1,%rax
+  803a79:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803a7c:	48 39 c8             	cmp    %rcx,%rax
+  803a7f:	75 e9                	jne    803a6a <strlcpy+0x12>
+        *dst = '\0';
+  803a81:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803a84:	48 29 f8             	sub    %rdi,%rax
+}
+  803a87:	c3                   	ret
+
+0000000000803a88 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803a88:	0f b6 07             	movzbl (%rdi),%eax
+  803a8b:	84 c0                	test   %al,%al
+  803a8d:	74 13                	je     803aa2 <strcmp+0x1a>
+  803a8f:	38 06                	cmp    %al,(%rsi)
+  803a91:	75 0f                	jne    803aa2 <strcmp+0x1a>
+  803a93:	48 83 c7 01          	add    $0x1,%rdi
+  803a97:	48 83 c6 01          	add    $0x1,%rsi
+  803a9b:	0f b6 07             	movzbl (%rdi),%eax
+  803a9e:	84 c0                	test   %al,%al
+  803aa0:	75 ed                	jne    803a8f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803aa2:	0f b6 c0             	movzbl %al,%eax
+  803aa5:	0f b6 16             	movzbl (%rsi),%edx
+  803aa8:	29 d0                	sub    %edx,%eax
+}
+  803aaa:	c3                   	ret
+
+0000000000803aab <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803aab:	48 85 d2             	test   %rdx,%rdx
+  803aae:	74 1f                	je     803acf <strncmp+0x24>
+  803ab0:	0f b6 07             	movzbl (%rdi),%eax
+  803ab3:	84 c0                	test   %al,%al
+  803ab5:	74 1e                	je     803ad5 <strncmp+0x2a>
+  803ab7:	3a 06                	cmp    (%rsi),%al
+  803ab9:	75 1a                	jne    803ad5 <strncmp+0x2a>
+  803abb:	48 83 c7 01          	add    $0x1,%rdi
+  803abf:	48 83 c6 01          	add    $0x1,%rsi
+  803ac3:	48 83 ea 01          	sub    $0x1,%rdx
+  803ac7:	75 e7                	jne    803ab0 <strncmp+0x5>
+
+    if (!n) return 0;
+  803ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ace:	c3                   	ret
+  803acf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad4:	c3                   	ret
+  803ad5:	48 85 d2             	test   %rdx,%rdx
+  803ad8:	74 09                	je     803ae3 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ada:	0f b6 07             	movzbl (%rdi),%eax
+  803add:	0f b6 16             	movzbl (%rsi),%edx
+  803ae0:	29 d0                	sub    %edx,%eax
+  803ae2:	c3                   	ret
+    if (!n) return 0;
+  803ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ae8:	c3                   	ret
+
+0000000000803ae9 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803ae9:	0f b6 17             	movzbl (%rdi),%edx
+  803aec:	84 d2                	test   %dl,%dl
+  803aee:	74 18                	je     803b08 <strchr+0x1f>
+        if (*str == c) {
+  803af0:	0f be d2             	movsbl %dl,%edx
+  803af3:	39 f2                	cmp    %esi,%edx
+  803af5:	74 17                	je     803b0e <strchr+0x25>
+    for (; *str; str++) {
+  803af7:	48 83 c7 01          	add    $0x1,%rdi
+  803afb:	0f b6 17             	movzbl (%rdi),%edx
+  803afe:	84 d2                	test   %dl,%dl
+  803b00:	75 ee                	jne    803af0 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b07:	c3                   	ret
+  803b08:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0d:	c3                   	ret
+  803b0e:	48 89 f8             	mov    %rdi,%rax
+}
+  803b11:	c3                   	ret
+
+0000000000803b12 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803b12:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803b15:	0f b6 17             	movzbl (%rdi),%edx
+  803b18:	84 d2                	test   %dl,%dl
+  803b1a:	74 13                	je     803b2f <strfind+0x1d>
+  803b1c:	0f be d2             	movsbl %dl,%edx
+  803b1f:	39 f2                	cmp    %esi,%edx
+  803b21:	74 0b                	je     803b2e <strfind+0x1c>
+  803b23:	48 83 c0 01          	add    $0x1,%rax
+  803b27:	0f b6 10             	movzbl (%rax),%edx
+  803b2a:	84 d2                	test   %dl,%dl
+  803b2c:	75 ee                	jne    803b1c <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803b2e:	c3                   	ret
+  803b2f:	c3                   	ret
+
+0000000000803b30 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  803b30:	55                   	push   %rbp
+  803b31:	48 89 e5             	mov    %rsp,%rbp
+  803b34:	41 57                	push   %r15
+  803b36:	41 56                	push   %r14
+  803b38:	41 55                	push   %r13
+  803b3a:	41 54                	push   %r12
+  803b3c:	53                   	push   %rbx
+  803b3d:	48 83 ec 08          	sub    $0x8,%rsp
+  803b41:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  803b44:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  803b48:	45 84 ed             	test   %r13b,%r13b
+  803b4b:	75 12                	jne    803b5f <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  803b4d:	4c 89 f8             	mov    %r15,%rax
+  803b50:	48 83 c4 08          	add    $0x8,%rsp
+  803b54:	5b                   	pop    %rbx
+  803b55:	41 5c                	pop    %r12
+  803b57:	41 5d                	pop    %r13
+  803b59:	41 5e                	pop    %r14
+  803b5b:	41 5f                	pop    %r15
+  803b5d:	5d                   	pop    %rbp
+  803b5e:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  803b5f:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  803b63:	4c 89 e7             	mov    %r12,%rdi
+  803b66:	48 b8 a6 39 80 00 00 	movabs $0x8039a6,%rax
+  803b6d:	00 00 00 
+  803b70:	ff d0                	call   *%rax
+  803b72:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  803b75:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  803b79:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  803b7d:	49 bf ab 3a 80 00 00 	movabs $0x803aab,%r15
+  803b84:	00 00 00 
+				if ((sc = *s++) == 0)
+  803b87:	84 c0                	test   %al,%al
+  803b89:	75 14                	jne    803b9f <strstr+0x6f>
+					return NULL;
+  803b8b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803b91:	eb ba                	jmp    803b4d <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  803b93:	48 83 c3 01          	add    $0x1,%rbx
+  803b97:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  803b9b:	84 c0                	test   %al,%al
+  803b9d:	74 1b                	je     803bba <strstr+0x8a>
+			} while (sc != c);
+  803b9f:	41 38 c5             	cmp    %al,%r13b
+  803ba2:	75 ef                	jne    803b93 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  803ba4:	4c 89 f2             	mov    %r14,%rdx
+  803ba7:	4c 89 e6             	mov    %r12,%rsi
+  803baa:	48 89 df             	mov    %rbx,%rdi
+  803bad:	41 ff d7             	call   *%r15
+  803bb0:	85 c0                	test   %eax,%eax
+  803bb2:	75 df                	jne    803b93 <strstr+0x63>
+  803bb4:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  803bb8:	eb 93                	jmp    803b4d <strstr+0x1d>
+					return NULL;
+  803bba:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803bc0:	eb 8b                	jmp    803b4d <strstr+0x1d>
+
+0000000000803bc2 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  803bc2:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  803bc4:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  803bc7:	8d 57 20             	lea    0x20(%rdi),%edx
+  803bca:	83 f9 1a             	cmp    $0x1a,%ecx
+  803bcd:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803bd0:	c3                   	ret
+
+0000000000803bd1 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  803bd1:	55                   	push   %rbp
+  803bd2:	48 89 e5             	mov    %rsp,%rbp
+  803bd5:	41 57                	push   %r15
+  803bd7:	41 56                	push   %r14
+  803bd9:	41 55                	push   %r13
+  803bdb:	41 54                	push   %r12
+  803bdd:	53                   	push   %rbx
+  803bde:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  803be2:	48 39 f7             	cmp    %rsi,%rdi
+  803be5:	74 49                	je     803c30 <strcasecmp+0x5f>
+  803be7:	49 89 fd             	mov    %rdi,%r13
+  803bea:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  803bed:	49 bf c2 3b 80 00 00 	movabs $0x803bc2,%r15
+  803bf4:	00 00 00 
+  803bf7:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  803bfc:	41 0f b6 fe          	movzbl %r14b,%edi
+  803c00:	41 ff d7             	call   *%r15
+  803c03:	89 c3                	mov    %eax,%ebx
+  803c05:	49 83 c4 01          	add    $0x1,%r12
+  803c09:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c0f:	41 ff d7             	call   *%r15
+  803c12:	29 c3                	sub    %eax,%ebx
+  803c14:	75 09                	jne    803c1f <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  803c16:	49 83 c5 01          	add    $0x1,%r13
+  803c1a:	45 84 f6             	test   %r14b,%r14b
+  803c1d:	75 d8                	jne    803bf7 <strcasecmp+0x26>
+}
+  803c1f:	89 d8                	mov    %ebx,%eax
+  803c21:	48 83 c4 08          	add    $0x8,%rsp
+  803c25:	5b                   	pop    %rbx
+  803c26:	41 5c                	pop    %r12
+  803c28:	41 5d                	pop    %r13
+  803c2a:	41 5e                	pop    %r14
+  803c2c:	41 5f                	pop    %r15
+  803c2e:	5d                   	pop    %rbp
+  803c2f:	c3                   	ret
+        return 0;
+  803c30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c35:	eb e8                	jmp    803c1f <strcasecmp+0x4e>
+
+0000000000803c37 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  803c37:	55                   	push   %rbp
+  803c38:	48 89 e5             	mov    %rsp,%rbp
+  803c3b:	41 57                	push   %r15
+  803c3d:	41 56                	push   %r14
+  803c3f:	41 55                	push   %r13
+  803c41:	41 54                	push   %r12
+  803c43:	53                   	push   %rbx
+  803c44:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  803c48:	48 85 d2             	test   %rdx,%rdx
+  803c4b:	74 4f                	je     803c9c <strncasecmp+0x65>
+  803c4d:	49 89 fc             	mov    %rdi,%r12
+  803c50:	49 89 f5             	mov    %rsi,%r13
+  803c53:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  803c57:	49 be c2 3b 80 00 00 	movabs $0x803bc2,%r14
+  803c5e:	00 00 00 
+  803c61:	49 83 c4 01          	add    $0x1,%r12
+  803c65:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  803c6b:	41 ff d6             	call   *%r14
+  803c6e:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  803c70:	49 83 c5 01          	add    $0x1,%r13
+  803c74:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  803c79:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  803c7c:	29 c3                	sub    %eax,%ebx
+  803c7e:	85 c0                	test   %eax,%eax
+  803c80:	74 09                	je     803c8b <strncasecmp+0x54>
+  803c82:	85 db                	test   %ebx,%ebx
+  803c84:	75 05                	jne    803c8b <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  803c86:	4d 39 fc             	cmp    %r15,%r12
+  803c89:	75 d6                	jne    803c61 <strncasecmp+0x2a>
+}
+  803c8b:	89 d8                	mov    %ebx,%eax
+  803c8d:	48 83 c4 08          	add    $0x8,%rsp
+  803c91:	5b                   	pop    %rbx
+  803c92:	41 5c                	pop    %r12
+  803c94:	41 5d                	pop    %r13
+  803c96:	41 5e                	pop    %r14
+  803c98:	41 5f                	pop    %r15
+  803c9a:	5d                   	pop    %rbp
+  803c9b:	c3                   	ret
+    int d = 0;
+  803c9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  803ca1:	eb e8                	jmp    803c8b <strncasecmp+0x54>
+
+0000000000803ca3 <toupper>:
+
+int toupper(int c) {
+  803ca3:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  803ca5:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  803ca8:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  803cab:	83 f9 1a             	cmp    $0x1a,%ecx
+  803cae:	0f 42 c2             	cmovb  %edx,%eax
+}
+  803cb1:	c3                   	ret
+
+0000000000803cb2 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  803cb2:	83 ff 20             	cmp    $0x20,%edi
+  803cb5:	0f 94 c0             	sete   %al
+  803cb8:	0f b6 c0             	movzbl %al,%eax
+}
+  803cbb:	c3                   	ret
+
+0000000000803cbc <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  803cbc:	89 f8                	mov    %edi,%eax
+  803cbe:	f7 d8                	neg    %eax
+  803cc0:	0f 48 c7             	cmovs  %edi,%eax
+}
+  803cc3:	c3                   	ret
+
+0000000000803cc4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803cc4:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803cc7:	48 89 f8             	mov    %rdi,%rax
+  803cca:	48 f7 d8             	neg    %rax
+  803ccd:	83 e0 07             	and    $0x7,%eax
+  803cd0:	49 89 d1             	mov    %rdx,%r9
+  803cd3:	49 29 c1             	sub    %rax,%r9
+  803cd6:	78 36                	js     803d0e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803cd8:	40 0f b6 c6          	movzbl %sil,%eax
+  803cdc:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803ce3:	01 01 01 
+  803ce6:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803cea:	40 f6 c7 07          	test   $0x7,%dil
+  803cee:	75 38                	jne    803d28 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803cf0:	4c 89 c9             	mov    %r9,%rcx
+  803cf3:	48 c1 f9 03          	sar    $0x3,%rcx
+  803cf7:	74 0c                	je     803d05 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803cf9:	fc                   	cld
+  803cfa:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803cfd:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803d01:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803d05:	4d 85 c9             	test   %r9,%r9
+  803d08:	75 45                	jne    803d4f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803d0a:	4c 89 c0             	mov    %r8,%rax
+  803d0d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803d0e:	48 85 d2             	test   %rdx,%rdx
+  803d11:	74 f7                	je     803d0a <memset+0x46>
+  803d13:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803d16:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803d19:	48 83 c0 01          	add    $0x1,%rax
+  803d1d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803d21:	48 39 c2             	cmp    %rax,%rdx
+  803d24:	75 f3                	jne    803d19 <memset+0x55>
+  803d26:	eb e2                	jmp    803d0a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803d28:	40 f6 c7 01          	test   $0x1,%dil
+  803d2c:	74 06                	je     803d34 <memset+0x70>
+  803d2e:	88 07                	mov    %al,(%rdi)
+  803d30:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d34:	40 f6 c7 02          	test   $0x2,%dil
+  803d38:	74 07                	je     803d41 <memset+0x7d>
+  803d3a:	66 89 07             	mov    %ax,(%rdi)
+  803d3d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d41:	40 f6 c7 04          	test   $0x4,%dil
+  803d45:	74 a9                	je     803cf0 <memset+0x2c>
+  803d47:	89 07                	mov    %eax,(%rdi)
+  803d49:	48 83 c7 04          	add    $0x4,%rdi
+  803d4d:	eb a1                	jmp    803cf0 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803d4f:	41 f6 c1 04          	test   $0x4,%r9b
+  803d53:	74 06                	je     803d5b <memset+0x97>
+  803d55:	89 07                	mov    %eax,(%rdi)
+  803d57:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803d5b:	41 f6 c1 02          	test   $0x2,%r9b
+  803d5f:	74 07                	je     803d68 <memset+0xa4>
+  803d61:	66 89 07             	mov    %ax,(%rdi)
+  803d64:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803d68:	41 f6 c1 01          	test   $0x1,%r9b
+  803d6c:	74 9c                	je     803d0a <memset+0x46>
+  803d6e:	88 07                	mov    %al,(%rdi)
+  803d70:	eb 98                	jmp    803d0a <memset+0x46>
+
+0000000000803d72 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803d72:	48 89 f8             	mov    %rdi,%rax
+  803d75:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803d78:	48 39 fe             	cmp    %rdi,%rsi
+  803d7b:	73 3b                	jae    803db8 <memmove+0x46>
+  803d7d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803d81:	48 39 d7             	cmp    %rdx,%rdi
+  803d84:	73 32                	jae    803db8 <memmove+0x46>
+        s += n;
+        d += n;
+  803d86:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803d8a:	48 89 d6             	mov    %rdx,%rsi
+  803d8d:	48 09 fe             	or     %rdi,%rsi
+  803d90:	48 09 ce             	or     %rcx,%rsi
+  803d93:	40 f6 c6 07          	test   $0x7,%sil
+  803d97:	75 12                	jne    803dab <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803d99:	48 83 ef 08          	sub    $0x8,%rdi
+  803d9d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803da1:	48 c1 e9 03          	shr    $0x3,%rcx
+  803da5:	fd                   	std
+  803da6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803da9:	fc                   	cld
+  803daa:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803dab:	48 83 ef 01          	sub    $0x1,%rdi
+  803daf:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  803db3:	fd                   	std
+  803db4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803db6:	eb f1                	jmp    803da9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803db8:	48 89 f2             	mov    %rsi,%rdx
+  803dbb:	48 09 c2             	or     %rax,%rdx
+  803dbe:	48 09 ca             	or     %rcx,%rdx
+  803dc1:	f6 c2 07             	test   $0x7,%dl
+  803dc4:	75 0c                	jne    803dd2 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803dc6:	48 c1 e9 03          	shr    $0x3,%rcx
+  803dca:	48 89 c7             	mov    %rax,%rdi
+  803dcd:	fc                   	cld
+  803dce:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  803dd1:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  803dd2:	48 89 c7             	mov    %rax,%rdi
+  803dd5:	fc                   	cld
+  803dd6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803dd8:	c3                   	ret
+
+0000000000803dd9 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803dd9:	55                   	push   %rbp
+  803dda:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803ddd:	48 b8 72 3d 80 00 00 	movabs $0x803d72,%rax
+  803de4:	00 00 00 
+  803de7:	ff d0                	call   *%rax
+}
+  803de9:	5d                   	pop    %rbp
+  803dea:	c3                   	ret
+
+0000000000803deb <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803deb:	55                   	push   %rbp
+  803dec:	48 89 e5             	mov    %rsp,%rbp
+  803def:	41 57                	push   %r15
+  803df1:	41 56                	push   %r14
+  803df3:	41 55                	push   %r13
+  803df5:	41 54                	push   %r12
+  803df7:	53                   	push   %rbx
+  803df8:	48 83 ec 08          	sub    $0x8,%rsp
+  803dfc:	49 89 fe             	mov    %rdi,%r14
+  803dff:	49 89 f7             	mov    %rsi,%r15
+  803e02:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  803e05:	48 89 f7             	mov    %rsi,%rdi
+  803e08:	48 b8 a6 39 80 00 00 	movabs $0x8039a6,%rax
+  803e0f:	00 00 00 
+  803e12:	ff d0                	call   *%rax
+  803e14:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803e17:	48 89 de             	mov    %rbx,%rsi
+  803e1a:	4c 89 f7             	mov    %r14,%rdi
+  803e1d:	48 b8 c1 39 80 00 00 	movabs $0x8039c1,%rax
+  803e24:	00 00 00 
+  803e27:	ff d0                	call   *%rax
+  803e29:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e2c:	48 39 c3             	cmp    %rax,%rbx
+  803e2f:	74 36                	je     803e67 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  803e31:	48 89 d8             	mov    %rbx,%rax
+  803e34:	4c 29 e8             	sub    %r13,%rax
+  803e37:	49 39 c4             	cmp    %rax,%r12
+  803e3a:	73 31                	jae    803e6d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  803e3c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  803e41:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e45:	4c 89 fe             	mov    %r15,%rsi
+  803e48:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  803e4f:	00 00 00 
+  803e52:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  803e54:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  803e58:	48 83 c4 08          	add    $0x8,%rsp
+  803e5c:	5b                   	pop    %rbx
+  803e5d:	41 5c                	pop    %r12
+  803e5f:	41 5d                	pop    %r13
+  803e61:	41 5e                	pop    %r14
+  803e63:	41 5f                	pop    %r15
+  803e65:	5d                   	pop    %rbp
+  803e66:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  803e67:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  803e6b:	eb eb                	jmp    803e58 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  803e6d:	48 83 eb 01          	sub    $0x1,%rbx
+  803e71:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  803e75:	48 89 da             	mov    %rbx,%rdx
+  803e78:	4c 89 fe             	mov    %r15,%rsi
+  803e7b:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  803e82:	00 00 00 
+  803e85:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803e87:	49 01 de             	add    %rbx,%r14
+  803e8a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803e8f:	eb c3                	jmp    803e54 <strlcat+0x69>
+
+0000000000803e91 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  803e91:	48 85 d2             	test   %rdx,%rdx
+  803e94:	74 2d                	je     803ec3 <memcmp+0x32>
+  803e96:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803e9b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803e9f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  803ea4:	44 38 c1             	cmp    %r8b,%cl
+  803ea7:	75 0f                	jne    803eb8 <memcmp+0x27>
+    while (n-- > 0) {
+  803ea9:	48 83 c0 01          	add    $0x1,%rax
+  803ead:	48 39 c2             	cmp    %rax,%rdx
+  803eb0:	75 e9                	jne    803e9b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb7:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803eb8:	0f b6 c1             	movzbl %cl,%eax
+  803ebb:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803ebf:	44 29 c0             	sub    %r8d,%eax
+  803ec2:	c3                   	ret
+    return 0;
+  803ec3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ec8:	c3                   	ret
+
+0000000000803ec9 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803ec9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803ecd:	48 39 c7             	cmp    %rax,%rdi
+  803ed0:	73 0f                	jae    803ee1 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803ed2:	40 38 37             	cmp    %sil,(%rdi)
+  803ed5:	74 0e                	je     803ee5 <memfind+0x1c>
+    for (; src < end; src++) {
+  803ed7:	48 83 c7 01          	add    $0x1,%rdi
+  803edb:	48 39 f8             	cmp    %rdi,%rax
+  803ede:	75 f2                	jne    803ed2 <memfind+0x9>
+  803ee0:	c3                   	ret
+  803ee1:	48 89 f8             	mov    %rdi,%rax
+  803ee4:	c3                   	ret
+  803ee5:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803ee8:	c3                   	ret
+
+0000000000803ee9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803ee9:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803eec:	0f b6 37             	movzbl (%rdi),%esi
+  803eef:	40 80 fe 20          	cmp    $0x20,%sil
+  803ef3:	74 06                	je     803efb <strtol+0x12>
+  803ef5:	40 80 fe 09          	cmp    $0x9,%sil
+  803ef9:	75 13                	jne    803f0e <strtol+0x25>
+  803efb:	48 83 c7 01          	add    $0x1,%rdi
+  803eff:	0f b6 37             	movzbl (%rdi),%esi
+  803f02:	40 80 fe 20          	cmp    $0x20,%sil
+  803f06:	74 f3                	je     803efb <strtol+0x12>
+  803f08:	40 80 fe 09          	cmp    $0x9,%sil
+  803f0c:	74 ed                	je     803efb <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803f0e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803f11:	83 e0 fd             	and    $0xfffffffd,%eax
+  803f14:	3c 01                	cmp    $0x1,%al
+  803f16:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f1a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803f20:	75 0f                	jne    803f31 <strtol+0x48>
+  803f22:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803f25:	74 14                	je     803f3b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803f27:	85 d2                	test   %edx,%edx
+  803f29:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803f2e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803f31:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803f36:	4c 63 ca             	movslq %edx,%r9
+  803f39:	eb 36                	jmp    803f71 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803f3b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  803f3f:	74 0f                	je     803f50 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803f41:	85 d2                	test   %edx,%edx
+  803f43:	75 ec                	jne    803f31 <strtol+0x48>
+        s++;
+  803f45:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803f49:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803f4e:	eb e1                	jmp    803f31 <strtol+0x48>
+        s += 2;
+  803f50:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  803f54:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803f59:	eb d6                	jmp    803f31 <strtol+0x48>
+            dig -= '0';
+  803f5b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803f5e:	44 0f b6 c1          	movzbl %cl,%r8d
+  803f62:	41 39 d0             	cmp    %edx,%r8d
+  803f65:	7d 21                	jge    803f88 <strtol+0x9f>
+        val = val * base + dig;
+  803f67:	49 0f af c1          	imul   %r9,%rax
+  803f6b:	0f b6 c9             	movzbl %cl,%ecx
+  803f6e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  803f71:	48 83 c7 01          	add    $0x1,%rdi
+  803f75:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803f79:	80 f9 39             	cmp    $0x39,%cl
+  803f7c:	76 dd                	jbe    803f5b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803f7e:	80 f9 7b             	cmp    $0x7b,%cl
+  803f81:	77 05                	ja     803f88 <strtol+0x9f>
+            dig -= 'a' - 10;
+  803f83:	83 e9 57             	sub    $0x57,%ecx
+  803f86:	eb d6                	jmp    803f5e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803f88:	4d 85 d2             	test   %r10,%r10
+  803f8b:	74 03                	je     803f90 <strtol+0xa7>
+  803f8d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  803f90:	48 89 c2             	mov    %rax,%rdx
+  803f93:	48 f7 da             	neg    %rdx
+  803f96:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803f9a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803f9e:	c3                   	ret
+
+0000000000803f9f <atoi>:
+int atoi(const char *str) {
+  803f9f:	55                   	push   %rbp
+  803fa0:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  803fa3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fa8:	be 00 00 00 00       	mov    $0x0,%esi
+  803fad:	48 b8 e9 3e 80 00 00 	movabs $0x803ee9,%rax
+  803fb4:	00 00 00 
+  803fb7:	ff d0                	call   *%rax
+}
+  803fb9:	5d                   	pop    %rbp
+  803fba:	c3                   	ret
+
+0000000000803fbb <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fbb:	55                   	push   %rbp
+  803fbc:	48 89 e5             	mov    %rsp,%rbp
+  803fbf:	41 55                	push   %r13
+  803fc1:	41 54                	push   %r12
+  803fc3:	53                   	push   %rbx
+  803fc4:	48 83 ec 08          	sub    $0x8,%rsp
+  803fc8:	49 89 fc             	mov    %rdi,%r12
+  803fcb:	48 89 f7             	mov    %rsi,%rdi
+  803fce:	48 89 d3             	mov    %rdx,%rbx
+  803fd1:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803fd4:	48 85 f6             	test   %rsi,%rsi
+  803fd7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fde:	00 00 00 
+  803fe1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  803fe5:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fea:	48 85 d2             	test   %rdx,%rdx
+  803fed:	74 03                	je     803ff2 <ipc_recv+0x37>
+  803fef:	48 8b 32             	mov    (%rdx),%rsi
+  803ff2:	48 b8 2a 06 80 00 00 	movabs $0x80062a,%rax
+  803ff9:	00 00 00 
+  803ffc:	ff d0                	call   *%rax
+    if (errno) {
+  803ffe:	85 c0                	test   %eax,%eax
+  804000:	74 1c                	je     80401e <ipc_recv+0x63>
+        if (from_env_store)
+  804002:	4d 85 e4             	test   %r12,%r12
+  804005:	74 08                	je     80400f <ipc_recv+0x54>
+            *from_env_store = 0;
+  804007:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80400e:	00 
+
+        if (perm_store)
+  80400f:	4d 85 ed             	test   %r13,%r13
+  804012:	74 74                	je     804088 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804014:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80401b:	00 
+  80401c:	eb 6a                	jmp    804088 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80401e:	4d 85 e4             	test   %r12,%r12
+  804021:	74 14                	je     804037 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804023:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80402a:	00 00 00 
+  80402d:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804033:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804037:	48 85 db             	test   %rbx,%rbx
+  80403a:	74 23                	je     80405f <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80403c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804043:	00 00 00 
+  804046:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80404c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804051:	85 c9                	test   %ecx,%ecx
+  804053:	74 07                	je     80405c <ipc_recv+0xa1>
+  804055:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80405c:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80405f:	4d 85 ed             	test   %r13,%r13
+  804062:	74 14                	je     804078 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804064:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80406b:	00 00 00 
+  80406e:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804074:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804078:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80407f:	00 00 00 
+  804082:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804088:	48 83 c4 08          	add    $0x8,%rsp
+  80408c:	5b                   	pop    %rbx
+  80408d:	41 5c                	pop    %r12
+  80408f:	41 5d                	pop    %r13
+  804091:	5d                   	pop    %rbp
+  804092:	c3                   	ret
+
+0000000000804093 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804093:	55                   	push   %rbp
+  804094:	48 89 e5             	mov    %rsp,%rbp
+  804097:	41 55                	push   %r13
+  804099:	41 54                	push   %r12
+  80409b:	53                   	push   %rbx
+  80409c:	48 83 ec 08          	sub    $0x8,%rsp
+  8040a0:	49 89 fc             	mov    %rdi,%r12
+  8040a3:	48 89 f7             	mov    %rsi,%rdi
+  8040a6:	48 89 d3             	mov    %rdx,%rbx
+  8040a9:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040ac:	48 85 f6             	test   %rsi,%rsi
+  8040af:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040b6:	00 00 00 
+  8040b9:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040bd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040c2:	48 85 d2             	test   %rdx,%rdx
+  8040c5:	74 03                	je     8040ca <ipc_try_recv+0x37>
+  8040c7:	48 8b 32             	mov    (%rdx),%rsi
+  8040ca:	48 b8 93 06 80 00 00 	movabs $0x800693,%rax
+  8040d1:	00 00 00 
+  8040d4:	ff d0                	call   *%rax
+    if (errno) {
+  8040d6:	85 c0                	test   %eax,%eax
+  8040d8:	75 75                	jne    80414f <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8040da:	4d 85 e4             	test   %r12,%r12
+  8040dd:	74 14                	je     8040f3 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8040df:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040e6:	00 00 00 
+  8040e9:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8040ef:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8040f3:	48 85 db             	test   %rbx,%rbx
+  8040f6:	74 23                	je     80411b <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8040f8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040ff:	00 00 00 
+  804102:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80410d:	85 c9                	test   %ecx,%ecx
+  80410f:	74 07                	je     804118 <ipc_try_recv+0x85>
+  804111:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804118:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80411b:	4d 85 ed             	test   %r13,%r13
+  80411e:	74 14                	je     804134 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804120:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804127:	00 00 00 
+  80412a:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804130:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804134:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80413b:	00 00 00 
+  80413e:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804144:	48 83 c4 08          	add    $0x8,%rsp
+  804148:	5b                   	pop    %rbx
+  804149:	41 5c                	pop    %r12
+  80414b:	41 5d                	pop    %r13
+  80414d:	5d                   	pop    %rbp
+  80414e:	c3                   	ret
+        if (from_env_store)
+  80414f:	4d 85 e4             	test   %r12,%r12
+  804152:	74 08                	je     80415c <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804154:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80415b:	00 
+        if (perm_store)
+  80415c:	4d 85 ed             	test   %r13,%r13
+  80415f:	74 e3                	je     804144 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804161:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804168:	00 
+  804169:	eb d9                	jmp    804144 <ipc_try_recv+0xb1>
+
+000000000080416b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80416b:	55                   	push   %rbp
+  80416c:	48 89 e5             	mov    %rsp,%rbp
+  80416f:	41 57                	push   %r15
+  804171:	41 56                	push   %r14
+  804173:	41 55                	push   %r13
+  804175:	41 54                	push   %r12
+  804177:	53                   	push   %rbx
+  804178:	48 83 ec 18          	sub    $0x18,%rsp
+  80417c:	41 89 fd             	mov    %edi,%r13d
+  80417f:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804182:	48 89 d3             	mov    %rdx,%rbx
+  804185:	49 89 cc             	mov    %rcx,%r12
+  804188:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80418c:	48 85 d2             	test   %rdx,%rdx
+  80418f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804196:	00 00 00 
+  804199:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80419d:	49 be fe 05 80 00 00 	movabs $0x8005fe,%r14
+  8041a4:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041a7:	49 bf ee 01 80 00 00 	movabs $0x8001ee,%r15
+  8041ae:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041b1:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041b4:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041b8:	4c 89 e1             	mov    %r12,%rcx
+  8041bb:	48 89 da             	mov    %rbx,%rdx
+  8041be:	44 89 ef             	mov    %r13d,%edi
+  8041c1:	41 ff d6             	call   *%r14
+  8041c4:	85 c0                	test   %eax,%eax
+  8041c6:	74 37                	je     8041ff <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041c8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041cb:	75 05                	jne    8041d2 <ipc_send+0x67>
+        sys_yield();
+  8041cd:	41 ff d7             	call   *%r15
+  8041d0:	eb df                	jmp    8041b1 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041d2:	89 c1                	mov    %eax,%ecx
+  8041d4:	48 ba ff 56 80 00 00 	movabs $0x8056ff,%rdx
+  8041db:	00 00 00 
+  8041de:	be 65 00 00 00       	mov    $0x65,%esi
+  8041e3:	48 bf 1a 57 80 00 00 	movabs $0x80571a,%rdi
+  8041ea:	00 00 00 
+  8041ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f2:	49 b8 1c 2f 80 00 00 	movabs $0x802f1c,%r8
+  8041f9:	00 00 00 
+  8041fc:	41 ff d0             	call   *%r8
+    }
+}
+  8041ff:	48 83 c4 18          	add    $0x18,%rsp
+  804203:	5b                   	pop    %rbx
+  804204:	41 5c                	pop    %r12
+  804206:	41 5d                	pop    %r13
+  804208:	41 5e                	pop    %r14
+  80420a:	41 5f                	pop    %r15
+  80420c:	5d                   	pop    %rbp
+  80420d:	c3                   	ret
+
+000000000080420e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80420e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804213:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80421a:	00 00 00 
+  80421d:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804224:	48 01 ca             	add    %rcx,%rdx
+  804227:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80422d:	39 fa                	cmp    %edi,%edx
+  80422f:	74 12                	je     804243 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804231:	48 83 c0 01          	add    $0x1,%rax
+  804235:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80423b:	75 e0                	jne    80421d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80423d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804242:	c3                   	ret
+            return envs[i].env_id;
+  804243:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80424a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804251:	00 00 00 
+  804254:	48 01 d0             	add    %rdx,%rax
+  804257:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80425d:	c3                   	ret
+
+000000000080425e <__text_end>:
+  80425e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804265:	00 00 00 
+  804268:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80426f:	00 00 00 
+  804272:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804279:	00 00 00 
+  80427c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804283:	00 00 00 
+  804286:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80428d:	00 00 00 
+  804290:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804297:	00 00 00 
+  80429a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a1:	00 00 00 
+  8042a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ab:	00 00 00 
+  8042ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b5:	00 00 00 
+  8042b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042bf:	00 00 00 
+  8042c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c9:	00 00 00 
+  8042cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d3:	00 00 00 
+  8042d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042dd:	00 00 00 
+  8042e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e7:	00 00 00 
+  8042ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f1:	00 00 00 
+  8042f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042fb:	00 00 00 
+  8042fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804305:	00 00 00 
+  804308:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430f:	00 00 00 
+  804312:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804319:	00 00 00 
+  80431c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804323:	00 00 00 
+  804326:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80432d:	00 00 00 
+  804330:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804337:	00 00 00 
+  80433a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804341:	00 00 00 
+  804344:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80434b:	00 00 00 
+  80434e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804355:	00 00 00 
+  804358:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435f:	00 00 00 
+  804362:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804369:	00 00 00 
+  80436c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804373:	00 00 00 
+  804376:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80437d:	00 00 00 
+  804380:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804387:	00 00 00 
+  80438a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804391:	00 00 00 
+  804394:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439b:	00 00 00 
+  80439e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a5:	00 00 00 
+  8043a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043af:	00 00 00 
+  8043b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b9:	00 00 00 
+  8043bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c3:	00 00 00 
+  8043c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043cd:	00 00 00 
+  8043d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d7:	00 00 00 
+  8043da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e1:	00 00 00 
+  8043e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043eb:	00 00 00 
+  8043ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f5:	00 00 00 
+  8043f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ff:	00 00 00 
+  804402:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804409:	00 00 00 
+  80440c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804413:	00 00 00 
+  804416:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80441d:	00 00 00 
+  804420:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804427:	00 00 00 
+  80442a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804431:	00 00 00 
+  804434:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443b:	00 00 00 
+  80443e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804445:	00 00 00 
+  804448:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444f:	00 00 00 
+  804452:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804459:	00 00 00 
+  80445c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804463:	00 00 00 
+  804466:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446d:	00 00 00 
+  804470:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804477:	00 00 00 
+  80447a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804481:	00 00 00 
+  804484:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448b:	00 00 00 
+  80448e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804495:	00 00 00 
+  804498:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449f:	00 00 00 
+  8044a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a9:	00 00 00 
+  8044ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b3:	00 00 00 
+  8044b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bd:	00 00 00 
+  8044c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c7:	00 00 00 
+  8044ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d1:	00 00 00 
+  8044d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044db:	00 00 00 
+  8044de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e5:	00 00 00 
+  8044e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ef:	00 00 00 
+  8044f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f9:	00 00 00 
+  8044fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804503:	00 00 00 
+  804506:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450d:	00 00 00 
+  804510:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804517:	00 00 00 
+  80451a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804521:	00 00 00 
+  804524:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452b:	00 00 00 
+  80452e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804535:	00 00 00 
+  804538:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453f:	00 00 00 
+  804542:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804549:	00 00 00 
+  80454c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804553:	00 00 00 
+  804556:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455d:	00 00 00 
+  804560:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804567:	00 00 00 
+  80456a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804571:	00 00 00 
+  804574:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457b:	00 00 00 
+  80457e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804585:	00 00 00 
+  804588:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458f:	00 00 00 
+  804592:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804599:	00 00 00 
+  80459c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a3:	00 00 00 
+  8045a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ad:	00 00 00 
+  8045b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b7:	00 00 00 
+  8045ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c1:	00 00 00 
+  8045c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cb:	00 00 00 
+  8045ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d5:	00 00 00 
+  8045d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045df:	00 00 00 
+  8045e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e9:	00 00 00 
+  8045ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f3:	00 00 00 
+  8045f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fd:	00 00 00 
+  804600:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804607:	00 00 00 
+  80460a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804611:	00 00 00 
+  804614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461b:	00 00 00 
+  80461e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804625:	00 00 00 
+  804628:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462f:	00 00 00 
+  804632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804639:	00 00 00 
+  80463c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804643:	00 00 00 
+  804646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464d:	00 00 00 
+  804650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804657:	00 00 00 
+  80465a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804661:	00 00 00 
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467f:	00 00 00 
+  804682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804689:	00 00 00 
+  80468c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804693:	00 00 00 
+  804696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469d:	00 00 00 
+  8046a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a7:	00 00 00 
+  8046aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b1:	00 00 00 
+  8046b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bb:	00 00 00 
+  8046be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c5:	00 00 00 
+  8046c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cf:	00 00 00 
+  8046d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d9:	00 00 00 
+  8046dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e3:	00 00 00 
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
@@ -0,0 +1,8461 @@
+
+obj/user/init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 42 05 00 00       	call   800565 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <sum>:
+char bss[6000];
+
+int
+sum(const char *s, int n) {
+    int i, tot = 0;
+    for (i = 0; i < n; i++)
+  800025:	85 f6                	test   %esi,%esi
+  800027:	7e 22                	jle    80004b <sum+0x26>
+  800029:	48 63 f6             	movslq %esi,%rsi
+  80002c:	b8 00 00 00 00       	mov    $0x0,%eax
+    int i, tot = 0;
+  800031:	b9 00 00 00 00       	mov    $0x0,%ecx
+        tot ^= i * s[i];
+  800036:	0f be 14 07          	movsbl (%rdi,%rax,1),%edx
+  80003a:	0f af d0             	imul   %eax,%edx
+  80003d:	31 d1                	xor    %edx,%ecx
+    for (i = 0; i < n; i++)
+  80003f:	48 83 c0 01          	add    $0x1,%rax
+  800043:	48 39 f0             	cmp    %rsi,%rax
+  800046:	75 ee                	jne    800036 <sum+0x11>
+    return tot;
+}
+  800048:	89 c8                	mov    %ecx,%eax
+  80004a:	c3                   	ret
+    int i, tot = 0;
+  80004b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    return tot;
+  800050:	eb f6                	jmp    800048 <sum+0x23>
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+  800066:	41 89 fc             	mov    %edi,%r12d
+  800069:	49 89 f5             	mov    %rsi,%r13
+    int i, r, x, want;
+    char args[256];
+
+    cprintf("init: running\n");
+  80006c:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800073:	00 00 00 
+  800076:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007b:	48 ba 81 07 80 00 00 	movabs $0x800781,%rdx
+  800082:	00 00 00 
+  800085:	ff d2                	call   *%rdx
+
+    want = 0xf989e;
+    if ((x = sum((char *)&data, sizeof data)) != want)
+  800087:	be 70 17 00 00       	mov    $0x1770,%esi
+  80008c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  800093:	00 00 00 
+  800096:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80009d:	00 00 00 
+  8000a0:	ff d0                	call   *%rax
+  8000a2:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  8000a7:	0f 84 64 01 00 00    	je     800211 <umain+0x1bf>
+        cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  8000ad:	ba 9e 98 0f 00       	mov    $0xf989e,%edx
+  8000b2:	89 c6                	mov    %eax,%esi
+  8000b4:	48 bf c8 50 80 00 00 	movabs $0x8050c8,%rdi
+  8000bb:	00 00 00 
+  8000be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c3:	48 b9 81 07 80 00 00 	movabs $0x800781,%rcx
+  8000ca:	00 00 00 
+  8000cd:	ff d1                	call   *%rcx
+                x, want);
+    else
+        cprintf("init: data seems okay\n");
+    if ((x = sum(bss, sizeof bss)) != 0)
+  8000cf:	be 70 17 00 00       	mov    $0x1770,%esi
+  8000d4:	48 bf 00 80 80 00 00 	movabs $0x808000,%rdi
+  8000db:	00 00 00 
+  8000de:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 84 3f 01 00 00    	je     800231 <umain+0x1df>
+        cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000f2:	89 c6                	mov    %eax,%esi
+  8000f4:	48 bf 08 51 80 00 00 	movabs $0x805108,%rdi
+  8000fb:	00 00 00 
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	48 ba 81 07 80 00 00 	movabs $0x800781,%rdx
+  80010a:	00 00 00 
+  80010d:	ff d2                	call   *%rdx
+    else
+        cprintf("init: bss seems okay\n");
+
+    /* Output in one syscall per line to avoid output interleaving */
+    strcat(args, "init: args:");
+  80010f:	48 be 3c 50 80 00 00 	movabs $0x80503c,%rsi
+  800116:	00 00 00 
+  800119:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800120:	48 b8 11 11 80 00 00 	movabs $0x801111,%rax
+  800127:	00 00 00 
+  80012a:	ff d0                	call   *%rax
+    for (i = 0; i < argc; i++) {
+  80012c:	45 85 e4             	test   %r12d,%r12d
+  80012f:	7e 59                	jle    80018a <umain+0x138>
+  800131:	4c 89 eb             	mov    %r13,%rbx
+  800134:	4d 63 e4             	movslq %r12d,%r12
+  800137:	4f 8d 7c e5 00       	lea    0x0(%r13,%r12,8),%r15
+        strcat(args, " '");
+  80013c:	49 be 48 50 80 00 00 	movabs $0x805048,%r14
+  800143:	00 00 00 
+  800146:	49 bc 11 11 80 00 00 	movabs $0x801111,%r12
+  80014d:	00 00 00 
+        strcat(args, argv[i]);
+        strcat(args, "'");
+  800150:	49 bd 49 50 80 00 00 	movabs $0x805049,%r13
+  800157:	00 00 00 
+        strcat(args, " '");
+  80015a:	4c 89 f6             	mov    %r14,%rsi
+  80015d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800164:	41 ff d4             	call   *%r12
+        strcat(args, argv[i]);
+  800167:	48 8b 33             	mov    (%rbx),%rsi
+  80016a:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800171:	41 ff d4             	call   *%r12
+        strcat(args, "'");
+  800174:	4c 89 ee             	mov    %r13,%rsi
+  800177:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  80017e:	41 ff d4             	call   *%r12
+    for (i = 0; i < argc; i++) {
+  800181:	48 83 c3 08          	add    $0x8,%rbx
+  800185:	4c 39 fb             	cmp    %r15,%rbx
+  800188:	75 d0                	jne    80015a <umain+0x108>
+    }
+    cprintf("%s\n", args);
+  80018a:	48 8d b5 d0 fe ff ff 	lea    -0x130(%rbp),%rsi
+  800191:	48 bf 4b 50 80 00 00 	movabs $0x80504b,%rdi
+  800198:	00 00 00 
+  80019b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a0:	48 bb 81 07 80 00 00 	movabs $0x800781,%rbx
+  8001a7:	00 00 00 
+  8001aa:	ff d3                	call   *%rbx
+
+    cprintf("init: running sh\n");
+  8001ac:	48 bf 4f 50 80 00 00 	movabs $0x80504f,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	ff d3                	call   *%rbx
+
+    /* Being run directly from kernel, so no file descriptors open yet */
+    close(0);
+  8001bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c2:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  8001c9:	00 00 00 
+  8001cc:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  8001ce:	48 b8 fe 04 80 00 00 	movabs $0x8004fe,%rax
+  8001d5:	00 00 00 
+  8001d8:	ff d0                	call   *%rax
+  8001da:	85 c0                	test   %eax,%eax
+  8001dc:	78 73                	js     800251 <umain+0x1ff>
+        panic("opencons: %i", r);
+    if (r != 0)
+  8001de:	0f 84 9a 00 00 00    	je     80027e <umain+0x22c>
+        panic("first opencons used fd %d", r);
+  8001e4:	89 c1                	mov    %eax,%ecx
+  8001e6:	48 ba 7a 50 80 00 00 	movabs $0x80507a,%rdx
+  8001ed:	00 00 00 
+  8001f0:	be 36 00 00 00       	mov    $0x36,%esi
+  8001f5:	48 bf 6e 50 80 00 00 	movabs $0x80506e,%rdi
+  8001fc:	00 00 00 
+  8001ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800204:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  80020b:	00 00 00 
+  80020e:	41 ff d0             	call   *%r8
+        cprintf("init: data seems okay\n");
+  800211:	48 bf 0f 50 80 00 00 	movabs $0x80500f,%rdi
+  800218:	00 00 00 
+  80021b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800220:	48 ba 81 07 80 00 00 	movabs $0x800781,%rdx
+  800227:	00 00 00 
+  80022a:	ff d2                	call   *%rdx
+  80022c:	e9 9e fe ff ff       	jmp    8000cf <umain+0x7d>
+        cprintf("init: bss seems okay\n");
+  800231:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800238:	00 00 00 
+  80023b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800240:	48 ba 81 07 80 00 00 	movabs $0x800781,%rdx
+  800247:	00 00 00 
+  80024a:	ff d2                	call   *%rdx
+  80024c:	e9 be fe ff ff       	jmp    80010f <umain+0xbd>
+        panic("opencons: %i", r);
+  800251:	89 c1                	mov    %eax,%ecx
+  800253:	48 ba 61 50 80 00 00 	movabs $0x805061,%rdx
+  80025a:	00 00 00 
+  80025d:	be 34 00 00 00       	mov    $0x34,%esi
+  800262:	48 bf 6e 50 80 00 00 	movabs $0x80506e,%rdi
+  800269:	00 00 00 
+  80026c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800271:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  800278:	00 00 00 
+  80027b:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  80027e:	be 01 00 00 00       	mov    $0x1,%esi
+  800283:	bf 00 00 00 00       	mov    $0x0,%edi
+  800288:	48 b8 bd 24 80 00 00 	movabs $0x8024bd,%rax
+  80028f:	00 00 00 
+  800292:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+    while (1) {
+        cprintf("init: starting sh\n");
+  800294:	49 be 9c 50 80 00 00 	movabs $0x80509c,%r14
+  80029b:	00 00 00 
+  80029e:	48 bb 81 07 80 00 00 	movabs $0x800781,%rbx
+  8002a5:	00 00 00 
+        r = spawnl("/sh", "sh", (char *)0);
+  8002a8:	49 bd b0 50 80 00 00 	movabs $0x8050b0,%r13
+  8002af:	00 00 00 
+  8002b2:	49 bc af 50 80 00 00 	movabs $0x8050af,%r12
+  8002b9:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  8002bc:	85 c0                	test   %eax,%eax
+  8002be:	79 40                	jns    800300 <umain+0x2ae>
+        panic("dup: %i", r);
+  8002c0:	89 c1                	mov    %eax,%ecx
+  8002c2:	48 ba 94 50 80 00 00 	movabs $0x805094,%rdx
+  8002c9:	00 00 00 
+  8002cc:	be 38 00 00 00       	mov    $0x38,%esi
+  8002d1:	48 bf 6e 50 80 00 00 	movabs $0x80506e,%rdi
+  8002d8:	00 00 00 
+  8002db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e0:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  8002e7:	00 00 00 
+  8002ea:	41 ff d0             	call   *%r8
+        if (r < 0) {
+            cprintf("init: spawn sh: %i\n", r);
+  8002ed:	89 c6                	mov    %eax,%esi
+  8002ef:	48 bf b3 50 80 00 00 	movabs $0x8050b3,%rdi
+  8002f6:	00 00 00 
+  8002f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fe:	ff d3                	call   *%rbx
+        cprintf("init: starting sh\n");
+  800300:	4c 89 f7             	mov    %r14,%rdi
+  800303:	b8 00 00 00 00       	mov    $0x0,%eax
+  800308:	ff d3                	call   *%rbx
+        r = spawnl("/sh", "sh", (char *)0);
+  80030a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030f:	4c 89 ee             	mov    %r13,%rsi
+  800312:	4c 89 e7             	mov    %r12,%rdi
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	48 b9 04 42 80 00 00 	movabs $0x804204,%rcx
+  800321:	00 00 00 
+  800324:	ff d1                	call   *%rcx
+        if (r < 0) {
+  800326:	85 c0                	test   %eax,%eax
+  800328:	78 c3                	js     8002ed <umain+0x29b>
+            continue;
+        }
+        wait(r);
+  80032a:	89 c7                	mov    %eax,%edi
+  80032c:	48 b8 ff 47 80 00 00 	movabs $0x8047ff,%rax
+  800333:	00 00 00 
+  800336:	ff d0                	call   *%rax
+  800338:	eb c6                	jmp    800300 <umain+0x2ae>
+
+000000000080033a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	c3                   	ret
+
+0000000000800340 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  800340:	55                   	push   %rbp
+  800341:	48 89 e5             	mov    %rsp,%rbp
+  800344:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800347:	48 be 37 51 80 00 00 	movabs $0x805137,%rsi
+  80034e:	00 00 00 
+  800351:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  800358:	00 00 00 
+  80035b:	ff d0                	call   *%rax
+    return 0;
+}
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	41 57                	push   %r15
+  80036a:	41 56                	push   %r14
+  80036c:	41 55                	push   %r13
+  80036e:	41 54                	push   %r12
+  800370:	53                   	push   %rbx
+  800371:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  800378:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80037f:	48 85 d2             	test   %rdx,%rdx
+  800382:	74 7a                	je     8003fe <devcons_write+0x9a>
+  800384:	49 89 d6             	mov    %rdx,%r14
+  800387:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80038d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800392:	49 bf 87 14 80 00 00 	movabs $0x801487,%r15
+  800399:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80039c:	4c 89 f3             	mov    %r14,%rbx
+  80039f:	48 29 f3             	sub    %rsi,%rbx
+  8003a2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8003a7:	48 39 c3             	cmp    %rax,%rbx
+  8003aa:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8003ae:	4c 63 eb             	movslq %ebx,%r13
+  8003b1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8003b8:	48 01 c6             	add    %rax,%rsi
+  8003bb:	4c 89 ea             	mov    %r13,%rdx
+  8003be:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8003c5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8003c8:	4c 89 ee             	mov    %r13,%rsi
+  8003cb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8003d2:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  8003d9:	00 00 00 
+  8003dc:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8003de:	41 01 dc             	add    %ebx,%r12d
+  8003e1:	49 63 f4             	movslq %r12d,%rsi
+  8003e4:	4c 39 f6             	cmp    %r14,%rsi
+  8003e7:	72 b3                	jb     80039c <devcons_write+0x38>
+    return res;
+  8003e9:	49 63 c4             	movslq %r12d,%rax
+}
+  8003ec:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8003f3:	5b                   	pop    %rbx
+  8003f4:	41 5c                	pop    %r12
+  8003f6:	41 5d                	pop    %r13
+  8003f8:	41 5e                	pop    %r14
+  8003fa:	41 5f                	pop    %r15
+  8003fc:	5d                   	pop    %rbp
+  8003fd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8003fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800404:	eb e3                	jmp    8003e9 <devcons_write+0x85>
+
+0000000000800406 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800406:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040e:	48 85 c0             	test   %rax,%rax
+  800411:	74 55                	je     800468 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800413:	55                   	push   %rbp
+  800414:	48 89 e5             	mov    %rsp,%rbp
+  800417:	41 55                	push   %r13
+  800419:	41 54                	push   %r12
+  80041b:	53                   	push   %rbx
+  80041c:	48 83 ec 08          	sub    $0x8,%rsp
+  800420:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  800423:	48 bb fd 16 80 00 00 	movabs $0x8016fd,%rbx
+  80042a:	00 00 00 
+  80042d:	49 bc ca 17 80 00 00 	movabs $0x8017ca,%r12
+  800434:	00 00 00 
+  800437:	eb 03                	jmp    80043c <devcons_read+0x36>
+  800439:	41 ff d4             	call   *%r12
+  80043c:	ff d3                	call   *%rbx
+  80043e:	85 c0                	test   %eax,%eax
+  800440:	74 f7                	je     800439 <devcons_read+0x33>
+    if (c < 0) return c;
+  800442:	48 63 d0             	movslq %eax,%rdx
+  800445:	78 13                	js     80045a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044c:	83 f8 04             	cmp    $0x4,%eax
+  80044f:	74 09                	je     80045a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  800451:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800455:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80045a:	48 89 d0             	mov    %rdx,%rax
+  80045d:	48 83 c4 08          	add    $0x8,%rsp
+  800461:	5b                   	pop    %rbx
+  800462:	41 5c                	pop    %r12
+  800464:	41 5d                	pop    %r13
+  800466:	5d                   	pop    %rbp
+  800467:	c3                   	ret
+  800468:	48 89 d0             	mov    %rdx,%rax
+  80046b:	c3                   	ret
+
+000000000080046c <cputchar>:
+cputchar(int ch) {
+  80046c:	55                   	push   %rbp
+  80046d:	48 89 e5             	mov    %rsp,%rbp
+  800470:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800474:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  800478:	be 01 00 00 00       	mov    $0x1,%esi
+  80047d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  800481:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+}
+  80048d:	c9                   	leave
+  80048e:	c3                   	ret
+
+000000000080048f <getchar>:
+getchar(void) {
+  80048f:	55                   	push   %rbp
+  800490:	48 89 e5             	mov    %rsp,%rbp
+  800493:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  800497:	ba 01 00 00 00       	mov    $0x1,%edx
+  80049c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8004a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004a5:	48 b8 e0 25 80 00 00 	movabs $0x8025e0,%rax
+  8004ac:	00 00 00 
+  8004af:	ff d0                	call   *%rax
+  8004b1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8004b3:	85 c0                	test   %eax,%eax
+  8004b5:	78 06                	js     8004bd <getchar+0x2e>
+  8004b7:	74 08                	je     8004c1 <getchar+0x32>
+  8004b9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8004bd:	89 d0                	mov    %edx,%eax
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8004c1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8004c6:	eb f5                	jmp    8004bd <getchar+0x2e>
+
+00000000008004c8 <iscons>:
+iscons(int fdnum) {
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8004d0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8004d4:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8004db:	00 00 00 
+  8004de:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8004e0:	85 c0                	test   %eax,%eax
+  8004e2:	78 18                	js     8004fc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8004e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004e8:	48 b8 80 77 80 00 00 	movabs $0x807780,%rax
+  8004ef:	00 00 00 
+  8004f2:	8b 00                	mov    (%rax),%eax
+  8004f4:	39 02                	cmp    %eax,(%rdx)
+  8004f6:	0f 94 c0             	sete   %al
+  8004f9:	0f b6 c0             	movzbl %al,%eax
+}
+  8004fc:	c9                   	leave
+  8004fd:	c3                   	ret
+
+00000000008004fe <opencons>:
+opencons(void) {
+  8004fe:	55                   	push   %rbp
+  8004ff:	48 89 e5             	mov    %rsp,%rbp
+  800502:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800506:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80050a:	48 b8 9d 22 80 00 00 	movabs $0x80229d,%rax
+  800511:	00 00 00 
+  800514:	ff d0                	call   *%rax
+  800516:	85 c0                	test   %eax,%eax
+  800518:	78 49                	js     800563 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80051a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80051f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800524:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800528:	bf 00 00 00 00       	mov    $0x0,%edi
+  80052d:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  800534:	00 00 00 
+  800537:	ff d0                	call   *%rax
+  800539:	85 c0                	test   %eax,%eax
+  80053b:	78 26                	js     800563 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80053d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800541:	a1 80 77 80 00 00 00 	movabs 0x807780,%eax
+  800548:	00 00 
+  80054a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80054c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800550:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800557:	48 b8 6f 22 80 00 00 	movabs $0x80226f,%rax
+  80055e:	00 00 00 
+  800561:	ff d0                	call   *%rax
+}
+  800563:	c9                   	leave
+  800564:	c3                   	ret
+
+0000000000800565 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	41 56                	push   %r14
+  80056b:	41 55                	push   %r13
+  80056d:	41 54                	push   %r12
+  80056f:	53                   	push   %rbx
+  800570:	41 89 fd             	mov    %edi,%r13d
+  800573:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800576:	48 ba 58 78 80 00 00 	movabs $0x807858,%rdx
+  80057d:	00 00 00 
+  800580:	48 b8 58 78 80 00 00 	movabs $0x807858,%rax
+  800587:	00 00 00 
+  80058a:	48 39 c2             	cmp    %rax,%rdx
+  80058d:	73 17                	jae    8005a6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80058f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800592:	49 89 c4             	mov    %rax,%r12
+  800595:	48 83 c3 08          	add    $0x8,%rbx
+  800599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059e:	ff 53 f8             	call   *-0x8(%rbx)
+  8005a1:	4c 39 e3             	cmp    %r12,%rbx
+  8005a4:	72 ef                	jb     800595 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8005a6:	48 b8 99 17 80 00 00 	movabs $0x801799,%rax
+  8005ad:	00 00 00 
+  8005b0:	ff d0                	call   *%rax
+  8005b2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005b7:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8005be:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8005c5:	00 00 00 
+  8005c8:	48 01 d0             	add    %rdx,%rax
+  8005cb:	48 a3 70 97 80 00 00 	movabs %rax,0x809770
+  8005d2:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8005d5:	45 85 ed             	test   %r13d,%r13d
+  8005d8:	7e 0d                	jle    8005e7 <libmain+0x82>
+  8005da:	49 8b 06             	mov    (%r14),%rax
+  8005dd:	48 a3 b8 77 80 00 00 	movabs %rax,0x8077b8
+  8005e4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8005e7:	4c 89 f6             	mov    %r14,%rsi
+  8005ea:	44 89 ef             	mov    %r13d,%edi
+  8005ed:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  8005f4:	00 00 00 
+  8005f7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8005f9:	48 b8 0e 06 80 00 00 	movabs $0x80060e,%rax
+  800600:	00 00 00 
+  800603:	ff d0                	call   *%rax
+#endif
+}
+  800605:	5b                   	pop    %rbx
+  800606:	41 5c                	pop    %r12
+  800608:	41 5d                	pop    %r13
+  80060a:	41 5e                	pop    %r14
+  80060c:	5d                   	pop    %rbp
+  80060d:	c3                   	ret
+
+000000000080060e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80060e:	55                   	push   %rbp
+  80060f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800612:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  800619:	00 00 00 
+  80061c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80061e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800623:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  80062a:	00 00 00 
+  80062d:	ff d0                	call   *%rax
+}
+  80062f:	5d                   	pop    %rbp
+  800630:	c3                   	ret
+
+0000000000800631 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800631:	55                   	push   %rbp
+  800632:	48 89 e5             	mov    %rsp,%rbp
+  800635:	41 56                	push   %r14
+  800637:	41 55                	push   %r13
+  800639:	41 54                	push   %r12
+  80063b:	53                   	push   %rbx
+  80063c:	48 83 ec 50          	sub    $0x50,%rsp
+  800640:	49 89 fc             	mov    %rdi,%r12
+  800643:	41 89 f5             	mov    %esi,%r13d
+  800646:	48 89 d3             	mov    %rdx,%rbx
+  800649:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80064d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800651:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800655:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80065c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800660:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800664:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800668:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80066c:	48 b8 b8 77 80 00 00 	movabs $0x8077b8,%rax
+  800673:	00 00 00 
+  800676:	4c 8b 30             	mov    (%rax),%r14
+  800679:	48 b8 99 17 80 00 00 	movabs $0x801799,%rax
+  800680:	00 00 00 
+  800683:	ff d0                	call   *%rax
+  800685:	89 c6                	mov    %eax,%esi
+  800687:	45 89 e8             	mov    %r13d,%r8d
+  80068a:	4c 89 e1             	mov    %r12,%rcx
+  80068d:	4c 89 f2             	mov    %r14,%rdx
+  800690:	48 bf 50 51 80 00 00 	movabs $0x805150,%rdi
+  800697:	00 00 00 
+  80069a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069f:	49 bc 81 07 80 00 00 	movabs $0x800781,%r12
+  8006a6:	00 00 00 
+  8006a9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8006ac:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8006b0:	48 89 df             	mov    %rbx,%rdi
+  8006b3:	48 b8 1d 07 80 00 00 	movabs $0x80071d,%rax
+  8006ba:	00 00 00 
+  8006bd:	ff d0                	call   *%rax
+    cprintf("\n");
+  8006bf:	48 bf a3 57 80 00 00 	movabs $0x8057a3,%rdi
+  8006c6:	00 00 00 
+  8006c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ce:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8006d1:	cc                   	int3
+  8006d2:	eb fd                	jmp    8006d1 <_panic+0xa0>
+
+00000000008006d4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8006d4:	55                   	push   %rbp
+  8006d5:	48 89 e5             	mov    %rsp,%rbp
+  8006d8:	53                   	push   %rbx
+  8006d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8006dd:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8006e0:	8b 06                	mov    (%rsi),%eax
+  8006e2:	8d 50 01             	lea    0x1(%rax),%edx
+  8006e5:	89 16                	mov    %edx,(%rsi)
+  8006e7:	48 98                	cltq
+  8006e9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8006ee:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8006f4:	74 0a                	je     800700 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8006f6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8006fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006fe:	c9                   	leave
+  8006ff:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800700:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800704:	be ff 00 00 00       	mov    $0xff,%esi
+  800709:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  800710:	00 00 00 
+  800713:	ff d0                	call   *%rax
+        state->offset = 0;
+  800715:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80071b:	eb d9                	jmp    8006f6 <putch+0x22>
+
+000000000080071d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80071d:	55                   	push   %rbp
+  80071e:	48 89 e5             	mov    %rsp,%rbp
+  800721:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800728:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80072b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800732:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80073f:	48 89 f1             	mov    %rsi,%rcx
+  800742:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800749:	48 bf d4 06 80 00 00 	movabs $0x8006d4,%rdi
+  800750:	00 00 00 
+  800753:	48 b8 d1 08 80 00 00 	movabs $0x8008d1,%rax
+  80075a:	00 00 00 
+  80075d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80075f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800766:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80076d:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  800774:	00 00 00 
+  800777:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800779:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80077f:	c9                   	leave
+  800780:	c3                   	ret
+
+0000000000800781 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800781:	55                   	push   %rbp
+  800782:	48 89 e5             	mov    %rsp,%rbp
+  800785:	48 83 ec 50          	sub    $0x50,%rsp
+  800789:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80078d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800791:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800795:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800799:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80079d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8007a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ac:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007b0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8007b4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8007b8:	48 b8 1d 07 80 00 00 	movabs $0x80071d,%rax
+  8007bf:	00 00 00 
+  8007c2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8007c4:	c9                   	leave
+  8007c5:	c3                   	ret
+
+00000000008007c6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8007c6:	55                   	push   %rbp
+  8007c7:	48 89 e5             	mov    %rsp,%rbp
+  8007ca:	41 57                	push   %r15
+  8007cc:	41 56                	push   %r14
+  8007ce:	41 55                	push   %r13
+  8007d0:	41 54                	push   %r12
+  8007d2:	53                   	push   %rbx
+  8007d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8007d7:	49 89 fc             	mov    %rdi,%r12
+  8007da:	49 89 f5             	mov    %rsi,%r13
+  8007dd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8007e1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8007e4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8007e7:	41 89 cf             	mov    %ecx,%r15d
+  8007ea:	4c 39 fa             	cmp    %r15,%rdx
+  8007ed:	73 5b                	jae    80084a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8007ef:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8007f3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8007f7:	85 db                	test   %ebx,%ebx
+  8007f9:	7e 0e                	jle    800809 <print_num+0x43>
+            putch(padc, put_arg);
+  8007fb:	4c 89 ee             	mov    %r13,%rsi
+  8007fe:	44 89 f7             	mov    %r14d,%edi
+  800801:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800804:	83 eb 01             	sub    $0x1,%ebx
+  800807:	75 f2                	jne    8007fb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800809:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80080d:	48 b9 84 51 80 00 00 	movabs $0x805184,%rcx
+  800814:	00 00 00 
+  800817:	48 b8 73 51 80 00 00 	movabs $0x805173,%rax
+  80081e:	00 00 00 
+  800821:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800825:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800829:	ba 00 00 00 00       	mov    $0x0,%edx
+  80082e:	49 f7 f7             	div    %r15
+  800831:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800835:	4c 89 ee             	mov    %r13,%rsi
+  800838:	41 ff d4             	call   *%r12
+}
+  80083b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80083f:	5b                   	pop    %rbx
+  800840:	41 5c                	pop    %r12
+  800842:	41 5d                	pop    %r13
+  800844:	41 5e                	pop    %r14
+  800846:	41 5f                	pop    %r15
+  800848:	5d                   	pop    %rbp
+  800849:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80084a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80084e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800853:	49 f7 f7             	div    %r15
+  800856:	48 83 ec 08          	sub    $0x8,%rsp
+  80085a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80085e:	52                   	push   %rdx
+  80085f:	45 0f be c9          	movsbl %r9b,%r9d
+  800863:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800867:	48 89 c2             	mov    %rax,%rdx
+  80086a:	48 b8 c6 07 80 00 00 	movabs $0x8007c6,%rax
+  800871:	00 00 00 
+  800874:	ff d0                	call   *%rax
+  800876:	48 83 c4 10          	add    $0x10,%rsp
+  80087a:	eb 8d                	jmp    800809 <print_num+0x43>
+
+000000000080087c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80087c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800880:	48 8b 06             	mov    (%rsi),%rax
+  800883:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800887:	73 0a                	jae    800893 <sprintputch+0x17>
+        *state->start++ = ch;
+  800889:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80088d:	48 89 16             	mov    %rdx,(%rsi)
+  800890:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800893:	c3                   	ret
+
+0000000000800894 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800894:	55                   	push   %rbp
+  800895:	48 89 e5             	mov    %rsp,%rbp
+  800898:	48 83 ec 50          	sub    $0x50,%rsp
+  80089c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8008a0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008a4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8008a8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8008af:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8008bb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8008bf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8008c3:	48 b8 d1 08 80 00 00 	movabs $0x8008d1,%rax
+  8008ca:	00 00 00 
+  8008cd:	ff d0                	call   *%rax
+}
+  8008cf:	c9                   	leave
+  8008d0:	c3                   	ret
+
+00000000008008d1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8008d1:	55                   	push   %rbp
+  8008d2:	48 89 e5             	mov    %rsp,%rbp
+  8008d5:	41 57                	push   %r15
+  8008d7:	41 56                	push   %r14
+  8008d9:	41 55                	push   %r13
+  8008db:	41 54                	push   %r12
+  8008dd:	53                   	push   %rbx
+  8008de:	48 83 ec 38          	sub    $0x38,%rsp
+  8008e2:	49 89 fe             	mov    %rdi,%r14
+  8008e5:	49 89 f5             	mov    %rsi,%r13
+  8008e8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8008eb:	48 8b 01             	mov    (%rcx),%rax
+  8008ee:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8008f2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8008f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fa:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8008fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800902:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800906:	0f b6 3b             	movzbl (%rbx),%edi
+  800909:	40 80 ff 25          	cmp    $0x25,%dil
+  80090d:	74 18                	je     800927 <vprintfmt+0x56>
+            if (!ch) return;
+  80090f:	40 84 ff             	test   %dil,%dil
+  800912:	0f 84 04 07 00 00    	je     80101c <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800918:	40 0f b6 ff          	movzbl %dil,%edi
+  80091c:	4c 89 ee             	mov    %r13,%rsi
+  80091f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800922:	4c 89 e3             	mov    %r12,%rbx
+  800925:	eb db                	jmp    800902 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800927:	be 00 00 00 00       	mov    $0x0,%esi
+  80092c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800930:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800935:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80093b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800942:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800946:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80094b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800950:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800953:	83 e8 23             	sub    $0x23,%eax
+  800956:	3c 57                	cmp    $0x57,%al
+  800958:	0f 87 a4 06 00 00    	ja     801002 <vprintfmt+0x731>
+  80095e:	0f b6 c0             	movzbl %al,%eax
+  800961:	48 b9 20 53 80 00 00 	movabs $0x805320,%rcx
+  800968:	00 00 00 
+  80096b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80096e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800971:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800975:	eb cf                	jmp    800946 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800977:	49 89 dc             	mov    %rbx,%r12
+  80097a:	be 01 00 00 00       	mov    $0x1,%esi
+  80097f:	eb c5                	jmp    800946 <vprintfmt+0x75>
+            padc = ch;
+  800981:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800985:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800988:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80098b:	eb b9                	jmp    800946 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80098d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800990:	83 f8 2f             	cmp    $0x2f,%eax
+  800993:	77 24                	ja     8009b9 <vprintfmt+0xe8>
+  800995:	89 c1                	mov    %eax,%ecx
+  800997:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80099b:	83 c0 08             	add    $0x8,%eax
+  80099e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8009a4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8009a7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009ab:	79 99                	jns    800946 <vprintfmt+0x75>
+                width = precision;
+  8009ad:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8009b1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009b7:	eb 8d                	jmp    800946 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009b9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8009bd:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8009c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c5:	eb da                	jmp    8009a1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8009c7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8009cc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009d0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8009d6:	3c 39                	cmp    $0x39,%al
+  8009d8:	77 1c                	ja     8009f6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8009da:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8009de:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8009e2:	0f b6 c0             	movzbl %al,%eax
+  8009e5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009ea:	0f b6 03             	movzbl (%rbx),%eax
+  8009ed:	3c 39                	cmp    $0x39,%al
+  8009ef:	76 e9                	jbe    8009da <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8009f1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8009f4:	eb b1                	jmp    8009a7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8009f6:	49 89 dc             	mov    %rbx,%r12
+  8009f9:	eb ac                	jmp    8009a7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8009fb:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8009fe:	85 c9                	test   %ecx,%ecx
+  800a00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a05:	0f 49 c1             	cmovns %ecx,%eax
+  800a08:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800a0b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a0e:	e9 33 ff ff ff       	jmp    800946 <vprintfmt+0x75>
+            lflag++;
+  800a13:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800a16:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a19:	e9 28 ff ff ff       	jmp    800946 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800a1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a21:	83 f8 2f             	cmp    $0x2f,%eax
+  800a24:	77 19                	ja     800a3f <vprintfmt+0x16e>
+  800a26:	89 c2                	mov    %eax,%edx
+  800a28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2c:	83 c0 08             	add    $0x8,%eax
+  800a2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a32:	8b 3a                	mov    (%rdx),%edi
+  800a34:	4c 89 ee             	mov    %r13,%rsi
+  800a37:	41 ff d6             	call   *%r14
+            break;
+  800a3a:	e9 c3 fe ff ff       	jmp    800902 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800a3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4b:	eb e5                	jmp    800a32 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800a4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a50:	83 f8 2f             	cmp    $0x2f,%eax
+  800a53:	77 5a                	ja     800aaf <vprintfmt+0x1de>
+  800a55:	89 c2                	mov    %eax,%edx
+  800a57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5b:	83 c0 08             	add    $0x8,%eax
+  800a5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800a61:	8b 02                	mov    (%rdx),%eax
+  800a63:	89 c1                	mov    %eax,%ecx
+  800a65:	f7 d9                	neg    %ecx
+  800a67:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800a6a:	83 f9 13             	cmp    $0x13,%ecx
+  800a6d:	7f 4e                	jg     800abd <vprintfmt+0x1ec>
+  800a6f:	48 63 c1             	movslq %ecx,%rax
+  800a72:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  800a79:	00 00 00 
+  800a7c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a80:	48 85 c0             	test   %rax,%rax
+  800a83:	74 38                	je     800abd <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800a85:	48 89 c1             	mov    %rax,%rcx
+  800a88:	48 ba 8c 58 80 00 00 	movabs $0x80588c,%rdx
+  800a8f:	00 00 00 
+  800a92:	4c 89 ee             	mov    %r13,%rsi
+  800a95:	4c 89 f7             	mov    %r14,%rdi
+  800a98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9d:	49 b8 94 08 80 00 00 	movabs $0x800894,%r8
+  800aa4:	00 00 00 
+  800aa7:	41 ff d0             	call   *%r8
+  800aaa:	e9 53 fe ff ff       	jmp    800902 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800aaf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abb:	eb a4                	jmp    800a61 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800abd:	48 ba 9c 51 80 00 00 	movabs $0x80519c,%rdx
+  800ac4:	00 00 00 
+  800ac7:	4c 89 ee             	mov    %r13,%rsi
+  800aca:	4c 89 f7             	mov    %r14,%rdi
+  800acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad2:	49 b8 94 08 80 00 00 	movabs $0x800894,%r8
+  800ad9:	00 00 00 
+  800adc:	41 ff d0             	call   *%r8
+  800adf:	e9 1e fe ff ff       	jmp    800902 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800ae4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aea:	77 36                	ja     800b22 <vprintfmt+0x251>
+  800aec:	89 c2                	mov    %eax,%edx
+  800aee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af2:	83 c0 08             	add    $0x8,%eax
+  800af5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af8:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800afb:	48 85 f6             	test   %rsi,%rsi
+  800afe:	48 b8 95 51 80 00 00 	movabs $0x805195,%rax
+  800b05:	00 00 00 
+  800b08:	48 0f 45 c6          	cmovne %rsi,%rax
+  800b0c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800b10:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b14:	7e 06                	jle    800b1c <vprintfmt+0x24b>
+  800b16:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800b1a:	75 14                	jne    800b30 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800b1c:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b20:	eb 5b                	jmp    800b7d <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800b22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2e:	eb c8                	jmp    800af8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800b30:	49 63 f7             	movslq %r15d,%rsi
+  800b33:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800b37:	48 b8 d6 10 80 00 00 	movabs $0x8010d6,%rax
+  800b3e:	00 00 00 
+  800b41:	ff d0                	call   *%rax
+  800b43:	48 89 c2             	mov    %rax,%rdx
+  800b46:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b49:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800b4b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800b4e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800b51:	85 c0                	test   %eax,%eax
+  800b53:	7e c7                	jle    800b1c <vprintfmt+0x24b>
+  800b55:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800b5a:	4c 89 ee             	mov    %r13,%rsi
+  800b5d:	44 89 e7             	mov    %r12d,%edi
+  800b60:	41 ff d6             	call   *%r14
+  800b63:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800b67:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b6a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800b6d:	75 eb                	jne    800b5a <vprintfmt+0x289>
+  800b6f:	eb ab                	jmp    800b1c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800b71:	0f b6 f8             	movzbl %al,%edi
+  800b74:	4c 89 ee             	mov    %r13,%rsi
+  800b77:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800b7a:	4c 89 e2             	mov    %r12,%rdx
+  800b7d:	45 85 ff             	test   %r15d,%r15d
+  800b80:	78 06                	js     800b88 <vprintfmt+0x2b7>
+  800b82:	41 83 ef 01          	sub    $0x1,%r15d
+  800b86:	78 23                	js     800bab <vprintfmt+0x2da>
+  800b88:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800b8c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b92:	84 c0                	test   %al,%al
+  800b94:	74 15                	je     800bab <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800b96:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800b9a:	74 d5                	je     800b71 <vprintfmt+0x2a0>
+  800b9c:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800b9f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ba4:	80 fa 5e             	cmp    $0x5e,%dl
+  800ba7:	77 cb                	ja     800b74 <vprintfmt+0x2a3>
+  800ba9:	eb c6                	jmp    800b71 <vprintfmt+0x2a0>
+  800bab:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800bae:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800bb1:	01 f0                	add    %esi,%eax
+  800bb3:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800bb5:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800bb9:	85 c0                	test   %eax,%eax
+  800bbb:	0f 8e 41 fd ff ff    	jle    800902 <vprintfmt+0x31>
+  800bc1:	4c 89 ee             	mov    %r13,%rsi
+  800bc4:	bf 20 00 00 00       	mov    $0x20,%edi
+  800bc9:	41 ff d6             	call   *%r14
+  800bcc:	41 83 ec 01          	sub    $0x1,%r12d
+  800bd0:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800bd4:	75 eb                	jne    800bc1 <vprintfmt+0x2f0>
+  800bd6:	e9 27 fd ff ff       	jmp    800902 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800bdb:	40 84 f6             	test   %sil,%sil
+  800bde:	75 26                	jne    800c06 <vprintfmt+0x335>
+    switch (lflag) {
+  800be0:	85 d2                	test   %edx,%edx
+  800be2:	74 59                	je     800c3d <vprintfmt+0x36c>
+  800be4:	83 fa 01             	cmp    $0x1,%edx
+  800be7:	74 7b                	je     800c64 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800be9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bec:	83 f8 2f             	cmp    $0x2f,%eax
+  800bef:	0f 87 96 00 00 00    	ja     800c8b <vprintfmt+0x3ba>
+  800bf5:	89 c2                	mov    %eax,%edx
+  800bf7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bfb:	83 c0 08             	add    $0x8,%eax
+  800bfe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c01:	4c 8b 22             	mov    (%rdx),%r12
+  800c04:	eb 17                	jmp    800c1d <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800c06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c09:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0c:	77 21                	ja     800c2f <vprintfmt+0x35e>
+  800c0e:	89 c2                	mov    %eax,%edx
+  800c10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c14:	83 c0 08             	add    $0x8,%eax
+  800c17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800c1d:	4d 85 e4             	test   %r12,%r12
+  800c20:	78 7a                	js     800c9c <vprintfmt+0x3cb>
+            num = i;
+  800c22:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800c25:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800c2a:	e9 b5 02 00 00       	jmp    800ee4 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800c2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3b:	eb dd                	jmp    800c1a <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800c3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c40:	83 f8 2f             	cmp    $0x2f,%eax
+  800c43:	77 11                	ja     800c56 <vprintfmt+0x385>
+  800c45:	89 c2                	mov    %eax,%edx
+  800c47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4b:	83 c0 08             	add    $0x8,%eax
+  800c4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c51:	4c 63 22             	movslq (%rdx),%r12
+  800c54:	eb c7                	jmp    800c1d <vprintfmt+0x34c>
+  800c56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c62:	eb ed                	jmp    800c51 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800c64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c67:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6a:	77 11                	ja     800c7d <vprintfmt+0x3ac>
+  800c6c:	89 c2                	mov    %eax,%edx
+  800c6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c72:	83 c0 08             	add    $0x8,%eax
+  800c75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c78:	4c 8b 22             	mov    (%rdx),%r12
+  800c7b:	eb a0                	jmp    800c1d <vprintfmt+0x34c>
+  800c7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c89:	eb ed                	jmp    800c78 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800c8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c97:	e9 65 ff ff ff       	jmp    800c01 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800c9c:	4c 89 ee             	mov    %r13,%rsi
+  800c9f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ca4:	41 ff d6             	call   *%r14
+                i = -i;
+  800ca7:	49 f7 dc             	neg    %r12
+  800caa:	e9 73 ff ff ff       	jmp    800c22 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800caf:	40 84 f6             	test   %sil,%sil
+  800cb2:	75 32                	jne    800ce6 <vprintfmt+0x415>
+    switch (lflag) {
+  800cb4:	85 d2                	test   %edx,%edx
+  800cb6:	74 5d                	je     800d15 <vprintfmt+0x444>
+  800cb8:	83 fa 01             	cmp    $0x1,%edx
+  800cbb:	0f 84 82 00 00 00    	je     800d43 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800cc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc4:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc7:	0f 87 a5 00 00 00    	ja     800d72 <vprintfmt+0x4a1>
+  800ccd:	89 c2                	mov    %eax,%edx
+  800ccf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd3:	83 c0 08             	add    $0x8,%eax
+  800cd6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800cdc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ce1:	e9 fe 01 00 00       	jmp    800ee4 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cec:	77 19                	ja     800d07 <vprintfmt+0x436>
+  800cee:	89 c2                	mov    %eax,%edx
+  800cf0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf4:	83 c0 08             	add    $0x8,%eax
+  800cf7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800cfd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d02:	e9 dd 01 00 00       	jmp    800ee4 <vprintfmt+0x613>
+  800d07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d13:	eb e5                	jmp    800cfa <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800d15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d18:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1b:	77 18                	ja     800d35 <vprintfmt+0x464>
+  800d1d:	89 c2                	mov    %eax,%edx
+  800d1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d23:	83 c0 08             	add    $0x8,%eax
+  800d26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d29:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800d2b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800d30:	e9 af 01 00 00       	jmp    800ee4 <vprintfmt+0x613>
+  800d35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d41:	eb e6                	jmp    800d29 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800d43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d46:	83 f8 2f             	cmp    $0x2f,%eax
+  800d49:	77 19                	ja     800d64 <vprintfmt+0x493>
+  800d4b:	89 c2                	mov    %eax,%edx
+  800d4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d51:	83 c0 08             	add    $0x8,%eax
+  800d54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d57:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d5a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800d5f:	e9 80 01 00 00       	jmp    800ee4 <vprintfmt+0x613>
+  800d64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d70:	eb e5                	jmp    800d57 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800d72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d7e:	e9 56 ff ff ff       	jmp    800cd9 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800d83:	40 84 f6             	test   %sil,%sil
+  800d86:	75 2e                	jne    800db6 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800d88:	85 d2                	test   %edx,%edx
+  800d8a:	0f 84 b3 00 00 00    	je     800e43 <vprintfmt+0x572>
+  800d90:	83 fa 01             	cmp    $0x1,%edx
+  800d93:	0f 84 d3 00 00 00    	je     800e6c <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800d99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d9f:	0f 87 f1 00 00 00    	ja     800e96 <vprintfmt+0x5c5>
+  800da5:	89 c2                	mov    %eax,%edx
+  800da7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dab:	83 c0 08             	add    $0x8,%eax
+  800dae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db1:	48 8b 02             	mov    (%rdx),%rax
+  800db4:	eb 17                	jmp    800dcd <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800db6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db9:	83 f8 2f             	cmp    $0x2f,%eax
+  800dbc:	77 77                	ja     800e35 <vprintfmt+0x564>
+  800dbe:	89 c2                	mov    %eax,%edx
+  800dc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc4:	83 c0 08             	add    $0x8,%eax
+  800dc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dca:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800dcd:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800dcf:	83 f8 07             	cmp    $0x7,%eax
+  800dd2:	0f 8e cf 00 00 00    	jle    800ea7 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800dd8:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800dde:	44 89 e7             	mov    %r12d,%edi
+  800de1:	41 c1 e4 03          	shl    $0x3,%r12d
+  800de5:	89 d1                	mov    %edx,%ecx
+  800de7:	8d 72 07             	lea    0x7(%rdx),%esi
+  800dea:	85 d2                	test   %edx,%edx
+  800dec:	0f 48 d6             	cmovs  %esi,%edx
+  800def:	c1 fa 03             	sar    $0x3,%edx
+  800df2:	83 f9 3f             	cmp    $0x3f,%ecx
+  800df5:	7f e7                	jg     800dde <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800df7:	85 ff                	test   %edi,%edi
+  800df9:	0f 84 03 fb ff ff    	je     800902 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800dff:	49 63 f4             	movslq %r12d,%rsi
+  800e02:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e07:	48 f7 f6             	div    %rsi
+  800e0a:	49 89 d7             	mov    %rdx,%r15
+  800e0d:	83 c0 30             	add    $0x30,%eax
+  800e10:	0f be f8             	movsbl %al,%edi
+  800e13:	4c 89 ee             	mov    %r13,%rsi
+  800e16:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800e19:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800e1c:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800e21:	45 85 e4             	test   %r12d,%r12d
+  800e24:	41 0f 49 d4          	cmovns %r12d,%edx
+  800e28:	c1 fa 03             	sar    $0x3,%edx
+  800e2b:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800e2e:	75 cf                	jne    800dff <vprintfmt+0x52e>
+  800e30:	e9 cd fa ff ff       	jmp    800902 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800e35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e41:	eb 87                	jmp    800dca <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800e43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e46:	83 f8 2f             	cmp    $0x2f,%eax
+  800e49:	77 13                	ja     800e5e <vprintfmt+0x58d>
+  800e4b:	89 c2                	mov    %eax,%edx
+  800e4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e51:	83 c0 08             	add    $0x8,%eax
+  800e54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e57:	8b 02                	mov    (%rdx),%eax
+  800e59:	e9 6f ff ff ff       	jmp    800dcd <vprintfmt+0x4fc>
+  800e5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e6a:	eb eb                	jmp    800e57 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800e6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e72:	77 14                	ja     800e88 <vprintfmt+0x5b7>
+  800e74:	89 c2                	mov    %eax,%edx
+  800e76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e7a:	83 c0 08             	add    $0x8,%eax
+  800e7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e80:	48 8b 02             	mov    (%rdx),%rax
+  800e83:	e9 45 ff ff ff       	jmp    800dcd <vprintfmt+0x4fc>
+  800e88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e94:	eb ea                	jmp    800e80 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800e96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea2:	e9 0a ff ff ff       	jmp    800db1 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800ea7:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800ead:	e9 4d ff ff ff       	jmp    800dff <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800eb2:	4c 89 ee             	mov    %r13,%rsi
+  800eb5:	bf 30 00 00 00       	mov    $0x30,%edi
+  800eba:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ebd:	4c 89 ee             	mov    %r13,%rsi
+  800ec0:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ec5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ec8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ecb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ece:	77 47                	ja     800f17 <vprintfmt+0x646>
+  800ed0:	89 c2                	mov    %eax,%edx
+  800ed2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed6:	83 c0 08             	add    $0x8,%eax
+  800ed9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800edc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800edf:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ee4:	48 83 ec 08          	sub    $0x8,%rsp
+  800ee8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800eec:	0f 94 c0             	sete   %al
+  800eef:	0f b6 c0             	movzbl %al,%eax
+  800ef2:	50                   	push   %rax
+  800ef3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ef8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800efc:	4c 89 ee             	mov    %r13,%rsi
+  800eff:	4c 89 f7             	mov    %r14,%rdi
+  800f02:	48 b8 c6 07 80 00 00 	movabs $0x8007c6,%rax
+  800f09:	00 00 00 
+  800f0c:	ff d0                	call   *%rax
+            break;
+  800f0e:	48 83 c4 10          	add    $0x10,%rsp
+  800f12:	e9 eb f9 ff ff       	jmp    800902 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800f17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f23:	eb b7                	jmp    800edc <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800f25:	40 84 f6             	test   %sil,%sil
+  800f28:	75 2b                	jne    800f55 <vprintfmt+0x684>
+    switch (lflag) {
+  800f2a:	85 d2                	test   %edx,%edx
+  800f2c:	74 56                	je     800f84 <vprintfmt+0x6b3>
+  800f2e:	83 fa 01             	cmp    $0x1,%edx
+  800f31:	74 7f                	je     800fb2 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800f33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f36:	83 f8 2f             	cmp    $0x2f,%eax
+  800f39:	0f 87 a2 00 00 00    	ja     800fe1 <vprintfmt+0x710>
+  800f3f:	89 c2                	mov    %eax,%edx
+  800f41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f45:	83 c0 08             	add    $0x8,%eax
+  800f48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f4b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f4e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f53:	eb 8f                	jmp    800ee4 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800f55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f58:	83 f8 2f             	cmp    $0x2f,%eax
+  800f5b:	77 19                	ja     800f76 <vprintfmt+0x6a5>
+  800f5d:	89 c2                	mov    %eax,%edx
+  800f5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f63:	83 c0 08             	add    $0x8,%eax
+  800f66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f69:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f6c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f71:	e9 6e ff ff ff       	jmp    800ee4 <vprintfmt+0x613>
+  800f76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f82:	eb e5                	jmp    800f69 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800f84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f87:	83 f8 2f             	cmp    $0x2f,%eax
+  800f8a:	77 18                	ja     800fa4 <vprintfmt+0x6d3>
+  800f8c:	89 c2                	mov    %eax,%edx
+  800f8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f92:	83 c0 08             	add    $0x8,%eax
+  800f95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f98:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800f9a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800f9f:	e9 40 ff ff ff       	jmp    800ee4 <vprintfmt+0x613>
+  800fa4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fa8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fb0:	eb e6                	jmp    800f98 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800fb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fb5:	83 f8 2f             	cmp    $0x2f,%eax
+  800fb8:	77 19                	ja     800fd3 <vprintfmt+0x702>
+  800fba:	89 c2                	mov    %eax,%edx
+  800fbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fc0:	83 c0 08             	add    $0x8,%eax
+  800fc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fc6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800fc9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800fce:	e9 11 ff ff ff       	jmp    800ee4 <vprintfmt+0x613>
+  800fd3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fd7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fdf:	eb e5                	jmp    800fc6 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800fe1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fe5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fe9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fed:	e9 59 ff ff ff       	jmp    800f4b <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800ff2:	4c 89 ee             	mov    %r13,%rsi
+  800ff5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ffa:	41 ff d6             	call   *%r14
+            break;
+  800ffd:	e9 00 f9 ff ff       	jmp    800902 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801002:	4c 89 ee             	mov    %r13,%rsi
+  801005:	bf 25 00 00 00       	mov    $0x25,%edi
+  80100a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80100d:	48 83 eb 01          	sub    $0x1,%rbx
+  801011:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801015:	75 f6                	jne    80100d <vprintfmt+0x73c>
+  801017:	e9 e6 f8 ff ff       	jmp    800902 <vprintfmt+0x31>
+}
+  80101c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801020:	5b                   	pop    %rbx
+  801021:	41 5c                	pop    %r12
+  801023:	41 5d                	pop    %r13
+  801025:	41 5e                	pop    %r14
+  801027:	41 5f                	pop    %r15
+  801029:	5d                   	pop    %rbp
+  80102a:	c3                   	ret
+
+000000000080102b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80102b:	55                   	push   %rbp
+  80102c:	48 89 e5             	mov    %rsp,%rbp
+  80102f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801033:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801037:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80103c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801040:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801047:	48 85 ff             	test   %rdi,%rdi
+  80104a:	74 2b                	je     801077 <vsnprintf+0x4c>
+  80104c:	48 85 f6             	test   %rsi,%rsi
+  80104f:	74 26                	je     801077 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801051:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801055:	48 bf 7c 08 80 00 00 	movabs $0x80087c,%rdi
+  80105c:	00 00 00 
+  80105f:	48 b8 d1 08 80 00 00 	movabs $0x8008d1,%rax
+  801066:	00 00 00 
+  801069:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80106b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80106f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801072:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801075:	c9                   	leave
+  801076:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801077:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80107c:	eb f7                	jmp    801075 <vsnprintf+0x4a>
+
+000000000080107e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80107e:	55                   	push   %rbp
+  80107f:	48 89 e5             	mov    %rsp,%rbp
+  801082:	48 83 ec 50          	sub    $0x50,%rsp
+  801086:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80108a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80108e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801092:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801099:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80109d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010a1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8010a5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8010a9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8010ad:	48 b8 2b 10 80 00 00 	movabs $0x80102b,%rax
+  8010b4:	00 00 00 
+  8010b7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8010b9:	c9                   	leave
+  8010ba:	c3                   	ret
+
+00000000008010bb <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8010bb:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8010be:	74 10                	je     8010d0 <strlen+0x15>
+    size_t n = 0;
+  8010c0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8010c5:	48 83 c0 01          	add    $0x1,%rax
+  8010c9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8010cd:	75 f6                	jne    8010c5 <strlen+0xa>
+  8010cf:	c3                   	ret
+    size_t n = 0;
+  8010d0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8010d5:	c3                   	ret
+
+00000000008010d6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8010d6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8010d9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8010de:	48 85 f6             	test   %rsi,%rsi
+  8010e1:	74 11                	je     8010f4 <strnlen+0x1e>
+  8010e3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8010e7:	74 0c                	je     8010f5 <strnlen+0x1f>
+  8010e9:	48 83 c2 01          	add    $0x1,%rdx
+  8010ed:	48 39 d0             	cmp    %rdx,%rax
+  8010f0:	75 f1                	jne    8010e3 <strnlen+0xd>
+  8010f2:	eb 04                	jmp    8010f8 <strnlen+0x22>
+  8010f4:	c3                   	ret
+  8010f5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8010f8:	c3                   	ret
+
+00000000008010f9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8010f9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8010fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801101:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801105:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801108:	48 83 c2 01          	add    $0x1,%rdx
+  80110c:	84 c9                	test   %cl,%cl
+  80110e:	75 f1                	jne    801101 <strcpy+0x8>
+        ;
+    return res;
+}
+  801110:	c3                   	ret
+
+0000000000801111 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801111:	55                   	push   %rbp
+  801112:	48 89 e5             	mov    %rsp,%rbp
+  801115:	41 54                	push   %r12
+  801117:	53                   	push   %rbx
+  801118:	48 89 fb             	mov    %rdi,%rbx
+  80111b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80111e:	48 b8 bb 10 80 00 00 	movabs $0x8010bb,%rax
+  801125:	00 00 00 
+  801128:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80112a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80112e:	4c 89 e6             	mov    %r12,%rsi
+  801131:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  801138:	00 00 00 
+  80113b:	ff d0                	call   *%rax
+    return dst;
+}
+  80113d:	48 89 d8             	mov    %rbx,%rax
+  801140:	5b                   	pop    %rbx
+  801141:	41 5c                	pop    %r12
+  801143:	5d                   	pop    %rbp
+  801144:	c3                   	ret
+
+0000000000801145 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801145:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801148:	48 85 d2             	test   %rdx,%rdx
+  80114b:	74 1f                	je     80116c <strncpy+0x27>
+  80114d:	48 01 fa             	add    %rdi,%rdx
+  801150:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801153:	48 83 c1 01          	add    $0x1,%rcx
+  801157:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80115b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80115f:	41 80 f8 01          	cmp    $0x1,%r8b
+  801163:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801167:	48 39 ca             	cmp    %rcx,%rdx
+  80116a:	75 e7                	jne    801153 <strncpy+0xe>
+    }
+    return ret;
+}
+  80116c:	c3                   	ret
+
+000000000080116d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80116d:	48 89 f8             	mov    %rdi,%rax
+  801170:	48 85 d2             	test   %rdx,%rdx
+  801173:	74 24                	je     801199 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801175:	48 83 ea 01          	sub    $0x1,%rdx
+  801179:	74 1b                	je     801196 <strlcpy+0x29>
+  80117b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80117f:	0f b6 16             	movzbl (%rsi),%edx
+  801182:	84 d2                	test   %dl,%dl
+  801184:	74 10                	je     801196 <strlcpy+0x29>
+            *dst++ = *src++;
+  801186:	48 83 c6 01          	add    $0x1,%rsi
+  80118a:	48 83 c0 01          	add    $0x1,%rax
+  80118e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801191:	48 39 c8             	cmp    %rcx,%rax
+  801194:	75 e9                	jne    80117f <strlcpy+0x12>
+        *dst = '\0';
+  801196:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801199:	48 29 f8             	sub    %rdi,%rax
+}
+  80119c:	c3                   	ret
+
+000000000080119d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80119d:	0f b6 07             	movzbl (%rdi),%eax
+  8011a0:	84 c0                	test   %al,%al
+  8011a2:	74 13                	je     8011b7 <strcmp+0x1a>
+  8011a4:	38 06                	cmp    %al,(%rsi)
+  8011a6:	75 0f                	jne    8011b7 <strcmp+0x1a>
+  8011a8:	48 83 c7 01          	add    $0x1,%rdi
+  8011ac:	48 83 c6 01          	add    $0x1,%rsi
+  8011b0:	0f b6 07             	movzbl (%rdi),%eax
+  8011b3:	84 c0                	test   %al,%al
+  8011b5:	75 ed                	jne    8011a4 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011b7:	0f b6 c0             	movzbl %al,%eax
+  8011ba:	0f b6 16             	movzbl (%rsi),%edx
+  8011bd:	29 d0                	sub    %edx,%eax
+}
+  8011bf:	c3                   	ret
+
+00000000008011c0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8011c0:	48 85 d2             	test   %rdx,%rdx
+  8011c3:	74 1f                	je     8011e4 <strncmp+0x24>
+  8011c5:	0f b6 07             	movzbl (%rdi),%eax
+  8011c8:	84 c0                	test   %al,%al
+  8011ca:	74 1e                	je     8011ea <strncmp+0x2a>
+  8011cc:	3a 06                	cmp    (%rsi),%al
+  8011ce:	75 1a                	jne    8011ea <strncmp+0x2a>
+  8011d0:	48 83 c7 01          	add    $0x1,%rdi
+  8011d4:	48 83 c6 01          	add    $0x1,%rsi
+  8011d8:	48 83 ea 01          	sub    $0x1,%rdx
+  8011dc:	75 e7                	jne    8011c5 <strncmp+0x5>
+
+    if (!n) return 0;
+  8011de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e3:	c3                   	ret
+  8011e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e9:	c3                   	ret
+  8011ea:	48 85 d2             	test   %rdx,%rdx
+  8011ed:	74 09                	je     8011f8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011ef:	0f b6 07             	movzbl (%rdi),%eax
+  8011f2:	0f b6 16             	movzbl (%rsi),%edx
+  8011f5:	29 d0                	sub    %edx,%eax
+  8011f7:	c3                   	ret
+    if (!n) return 0;
+  8011f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011fd:	c3                   	ret
+
+00000000008011fe <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8011fe:	0f b6 17             	movzbl (%rdi),%edx
+  801201:	84 d2                	test   %dl,%dl
+  801203:	74 18                	je     80121d <strchr+0x1f>
+        if (*str == c) {
+  801205:	0f be d2             	movsbl %dl,%edx
+  801208:	39 f2                	cmp    %esi,%edx
+  80120a:	74 17                	je     801223 <strchr+0x25>
+    for (; *str; str++) {
+  80120c:	48 83 c7 01          	add    $0x1,%rdi
+  801210:	0f b6 17             	movzbl (%rdi),%edx
+  801213:	84 d2                	test   %dl,%dl
+  801215:	75 ee                	jne    801205 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121c:	c3                   	ret
+  80121d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801222:	c3                   	ret
+  801223:	48 89 f8             	mov    %rdi,%rax
+}
+  801226:	c3                   	ret
+
+0000000000801227 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801227:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80122a:	0f b6 17             	movzbl (%rdi),%edx
+  80122d:	84 d2                	test   %dl,%dl
+  80122f:	74 13                	je     801244 <strfind+0x1d>
+  801231:	0f be d2             	movsbl %dl,%edx
+  801234:	39 f2                	cmp    %esi,%edx
+  801236:	74 0b                	je     801243 <strfind+0x1c>
+  801238:	48 83 c0 01          	add    $0x1,%rax
+  80123c:	0f b6 10             	movzbl (%rax),%edx
+  80123f:	84 d2                	test   %dl,%dl
+  801241:	75 ee                	jne    801231 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801243:	c3                   	ret
+  801244:	c3                   	ret
+
+0000000000801245 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  801245:	55                   	push   %rbp
+  801246:	48 89 e5             	mov    %rsp,%rbp
+  801249:	41 57                	push   %r15
+  80124b:	41 56                	push   %r14
+  80124d:	41 55                	push   %r13
+  80124f:	41 54                	push   %r12
+  801251:	53                   	push   %rbx
+  801252:	48 83 ec 08          	sub    $0x8,%rsp
+  801256:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  801259:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  80125d:	45 84 ed             	test   %r13b,%r13b
+  801260:	75 12                	jne    801274 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  801262:	4c 89 f8             	mov    %r15,%rax
+  801265:	48 83 c4 08          	add    $0x8,%rsp
+  801269:	5b                   	pop    %rbx
+  80126a:	41 5c                	pop    %r12
+  80126c:	41 5d                	pop    %r13
+  80126e:	41 5e                	pop    %r14
+  801270:	41 5f                	pop    %r15
+  801272:	5d                   	pop    %rbp
+  801273:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  801274:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  801278:	4c 89 e7             	mov    %r12,%rdi
+  80127b:	48 b8 bb 10 80 00 00 	movabs $0x8010bb,%rax
+  801282:	00 00 00 
+  801285:	ff d0                	call   *%rax
+  801287:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  80128a:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  80128e:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  801292:	49 bf c0 11 80 00 00 	movabs $0x8011c0,%r15
+  801299:	00 00 00 
+				if ((sc = *s++) == 0)
+  80129c:	84 c0                	test   %al,%al
+  80129e:	75 14                	jne    8012b4 <strstr+0x6f>
+					return NULL;
+  8012a0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8012a6:	eb ba                	jmp    801262 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  8012a8:	48 83 c3 01          	add    $0x1,%rbx
+  8012ac:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8012b0:	84 c0                	test   %al,%al
+  8012b2:	74 1b                	je     8012cf <strstr+0x8a>
+			} while (sc != c);
+  8012b4:	41 38 c5             	cmp    %al,%r13b
+  8012b7:	75 ef                	jne    8012a8 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  8012b9:	4c 89 f2             	mov    %r14,%rdx
+  8012bc:	4c 89 e6             	mov    %r12,%rsi
+  8012bf:	48 89 df             	mov    %rbx,%rdi
+  8012c2:	41 ff d7             	call   *%r15
+  8012c5:	85 c0                	test   %eax,%eax
+  8012c7:	75 df                	jne    8012a8 <strstr+0x63>
+  8012c9:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  8012cd:	eb 93                	jmp    801262 <strstr+0x1d>
+					return NULL;
+  8012cf:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8012d5:	eb 8b                	jmp    801262 <strstr+0x1d>
+
+00000000008012d7 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  8012d7:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  8012d9:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  8012dc:	8d 57 20             	lea    0x20(%rdi),%edx
+  8012df:	83 f9 1a             	cmp    $0x1a,%ecx
+  8012e2:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8012e5:	c3                   	ret
+
+00000000008012e6 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  8012e6:	55                   	push   %rbp
+  8012e7:	48 89 e5             	mov    %rsp,%rbp
+  8012ea:	41 57                	push   %r15
+  8012ec:	41 56                	push   %r14
+  8012ee:	41 55                	push   %r13
+  8012f0:	41 54                	push   %r12
+  8012f2:	53                   	push   %rbx
+  8012f3:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  8012f7:	48 39 f7             	cmp    %rsi,%rdi
+  8012fa:	74 49                	je     801345 <strcasecmp+0x5f>
+  8012fc:	49 89 fd             	mov    %rdi,%r13
+  8012ff:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  801302:	49 bf d7 12 80 00 00 	movabs $0x8012d7,%r15
+  801309:	00 00 00 
+  80130c:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801311:	41 0f b6 fe          	movzbl %r14b,%edi
+  801315:	41 ff d7             	call   *%r15
+  801318:	89 c3                	mov    %eax,%ebx
+  80131a:	49 83 c4 01          	add    $0x1,%r12
+  80131e:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801324:	41 ff d7             	call   *%r15
+  801327:	29 c3                	sub    %eax,%ebx
+  801329:	75 09                	jne    801334 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  80132b:	49 83 c5 01          	add    $0x1,%r13
+  80132f:	45 84 f6             	test   %r14b,%r14b
+  801332:	75 d8                	jne    80130c <strcasecmp+0x26>
+}
+  801334:	89 d8                	mov    %ebx,%eax
+  801336:	48 83 c4 08          	add    $0x8,%rsp
+  80133a:	5b                   	pop    %rbx
+  80133b:	41 5c                	pop    %r12
+  80133d:	41 5d                	pop    %r13
+  80133f:	41 5e                	pop    %r14
+  801341:	41 5f                	pop    %r15
+  801343:	5d                   	pop    %rbp
+  801344:	c3                   	ret
+        return 0;
+  801345:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134a:	eb e8                	jmp    801334 <strcasecmp+0x4e>
+
+000000000080134c <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80134c:	55                   	push   %rbp
+  80134d:	48 89 e5             	mov    %rsp,%rbp
+  801350:	41 57                	push   %r15
+  801352:	41 56                	push   %r14
+  801354:	41 55                	push   %r13
+  801356:	41 54                	push   %r12
+  801358:	53                   	push   %rbx
+  801359:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  80135d:	48 85 d2             	test   %rdx,%rdx
+  801360:	74 4f                	je     8013b1 <strncasecmp+0x65>
+  801362:	49 89 fc             	mov    %rdi,%r12
+  801365:	49 89 f5             	mov    %rsi,%r13
+  801368:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  80136c:	49 be d7 12 80 00 00 	movabs $0x8012d7,%r14
+  801373:	00 00 00 
+  801376:	49 83 c4 01          	add    $0x1,%r12
+  80137a:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801380:	41 ff d6             	call   *%r14
+  801383:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  801385:	49 83 c5 01          	add    $0x1,%r13
+  801389:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  80138e:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801391:	29 c3                	sub    %eax,%ebx
+  801393:	85 c0                	test   %eax,%eax
+  801395:	74 09                	je     8013a0 <strncasecmp+0x54>
+  801397:	85 db                	test   %ebx,%ebx
+  801399:	75 05                	jne    8013a0 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  80139b:	4d 39 fc             	cmp    %r15,%r12
+  80139e:	75 d6                	jne    801376 <strncasecmp+0x2a>
+}
+  8013a0:	89 d8                	mov    %ebx,%eax
+  8013a2:	48 83 c4 08          	add    $0x8,%rsp
+  8013a6:	5b                   	pop    %rbx
+  8013a7:	41 5c                	pop    %r12
+  8013a9:	41 5d                	pop    %r13
+  8013ab:	41 5e                	pop    %r14
+  8013ad:	41 5f                	pop    %r15
+  8013af:	5d                   	pop    %rbp
+  8013b0:	c3                   	ret
+    int d = 0;
+  8013b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  8013b6:	eb e8                	jmp    8013a0 <strncasecmp+0x54>
+
+00000000008013b8 <toupper>:
+
+int toupper(int c) {
+  8013b8:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  8013ba:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  8013bd:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8013c0:	83 f9 1a             	cmp    $0x1a,%ecx
+  8013c3:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8013c6:	c3                   	ret
+
+00000000008013c7 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  8013c7:	83 ff 20             	cmp    $0x20,%edi
+  8013ca:	0f 94 c0             	sete   %al
+  8013cd:	0f b6 c0             	movzbl %al,%eax
+}
+  8013d0:	c3                   	ret
+
+00000000008013d1 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  8013d1:	89 f8                	mov    %edi,%eax
+  8013d3:	f7 d8                	neg    %eax
+  8013d5:	0f 48 c7             	cmovs  %edi,%eax
+}
+  8013d8:	c3                   	ret
+
+00000000008013d9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8013d9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8013dc:	48 89 f8             	mov    %rdi,%rax
+  8013df:	48 f7 d8             	neg    %rax
+  8013e2:	83 e0 07             	and    $0x7,%eax
+  8013e5:	49 89 d1             	mov    %rdx,%r9
+  8013e8:	49 29 c1             	sub    %rax,%r9
+  8013eb:	78 36                	js     801423 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8013ed:	40 0f b6 c6          	movzbl %sil,%eax
+  8013f1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8013f8:	01 01 01 
+  8013fb:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8013ff:	40 f6 c7 07          	test   $0x7,%dil
+  801403:	75 38                	jne    80143d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801405:	4c 89 c9             	mov    %r9,%rcx
+  801408:	48 c1 f9 03          	sar    $0x3,%rcx
+  80140c:	74 0c                	je     80141a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80140e:	fc                   	cld
+  80140f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801412:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801416:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80141a:	4d 85 c9             	test   %r9,%r9
+  80141d:	75 45                	jne    801464 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80141f:	4c 89 c0             	mov    %r8,%rax
+  801422:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801423:	48 85 d2             	test   %rdx,%rdx
+  801426:	74 f7                	je     80141f <memset+0x46>
+  801428:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80142b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80142e:	48 83 c0 01          	add    $0x1,%rax
+  801432:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801436:	48 39 c2             	cmp    %rax,%rdx
+  801439:	75 f3                	jne    80142e <memset+0x55>
+  80143b:	eb e2                	jmp    80141f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80143d:	40 f6 c7 01          	test   $0x1,%dil
+  801441:	74 06                	je     801449 <memset+0x70>
+  801443:	88 07                	mov    %al,(%rdi)
+  801445:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801449:	40 f6 c7 02          	test   $0x2,%dil
+  80144d:	74 07                	je     801456 <memset+0x7d>
+  80144f:	66 89 07             	mov    %ax,(%rdi)
+  801452:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801456:	40 f6 c7 04          	test   $0x4,%dil
+  80145a:	74 a9                	je     801405 <memset+0x2c>
+  80145c:	89 07                	mov    %eax,(%rdi)
+  80145e:	48 83 c7 04          	add    $0x4,%rdi
+  801462:	eb a1                	jmp    801405 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801464:	41 f6 c1 04          	test   $0x4,%r9b
+  801468:	74 06                	je     801470 <memset+0x97>
+  80146a:	89 07                	mov    %eax,(%rdi)
+  80146c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801470:	41 f6 c1 02          	test   $0x2,%r9b
+  801474:	74 07                	je     80147d <memset+0xa4>
+  801476:	66 89 07             	mov    %ax,(%rdi)
+  801479:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80147d:	41 f6 c1 01          	test   $0x1,%r9b
+  801481:	74 9c                	je     80141f <memset+0x46>
+  801483:	88 07                	mov    %al,(%rdi)
+  801485:	eb 98                	jmp    80141f <memset+0x46>
+
+0000000000801487 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801487:	48 89 f8             	mov    %rdi,%rax
+  80148a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80148d:	48 39 fe             	cmp    %rdi,%rsi
+  801490:	73 3b                	jae    8014cd <memmove+0x46>
+  801492:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801496:	48 39 d7             	cmp    %rdx,%rdi
+  801499:	73 32                	jae    8014cd <memmove+0x46>
+        s += n;
+        d += n;
+  80149b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80149f:	48 89 d6             	mov    %rdx,%rsi
+  8014a2:	48 09 fe             	or     %rdi,%rsi
+  8014a5:	48 09 ce             	or     %rcx,%rsi
+  8014a8:	40 f6 c6 07          	test   $0x7,%sil
+  8014ac:	75 12                	jne    8014c0 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8014ae:	48 83 ef 08          	sub    $0x8,%rdi
+  8014b2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8014b6:	48 c1 e9 03          	shr    $0x3,%rcx
+  8014ba:	fd                   	std
+  8014bb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8014be:	fc                   	cld
+  8014bf:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8014c0:	48 83 ef 01          	sub    $0x1,%rdi
+  8014c4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8014c8:	fd                   	std
+  8014c9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8014cb:	eb f1                	jmp    8014be <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8014cd:	48 89 f2             	mov    %rsi,%rdx
+  8014d0:	48 09 c2             	or     %rax,%rdx
+  8014d3:	48 09 ca             	or     %rcx,%rdx
+  8014d6:	f6 c2 07             	test   $0x7,%dl
+  8014d9:	75 0c                	jne    8014e7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8014db:	48 c1 e9 03          	shr    $0x3,%rcx
+  8014df:	48 89 c7             	mov    %rax,%rdi
+  8014e2:	fc                   	cld
+  8014e3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8014e6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8014e7:	48 89 c7             	mov    %rax,%rdi
+  8014ea:	fc                   	cld
+  8014eb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8014ed:	c3                   	ret
+
+00000000008014ee <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8014ee:	55                   	push   %rbp
+  8014ef:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8014f2:	48 b8 87 14 80 00 00 	movabs $0x801487,%rax
+  8014f9:	00 00 00 
+  8014fc:	ff d0                	call   *%rax
+}
+  8014fe:	5d                   	pop    %rbp
+  8014ff:	c3                   	ret
+
+0000000000801500 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801500:	55                   	push   %rbp
+  801501:	48 89 e5             	mov    %rsp,%rbp
+  801504:	41 57                	push   %r15
+  801506:	41 56                	push   %r14
+  801508:	41 55                	push   %r13
+  80150a:	41 54                	push   %r12
+  80150c:	53                   	push   %rbx
+  80150d:	48 83 ec 08          	sub    $0x8,%rsp
+  801511:	49 89 fe             	mov    %rdi,%r14
+  801514:	49 89 f7             	mov    %rsi,%r15
+  801517:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80151a:	48 89 f7             	mov    %rsi,%rdi
+  80151d:	48 b8 bb 10 80 00 00 	movabs $0x8010bb,%rax
+  801524:	00 00 00 
+  801527:	ff d0                	call   *%rax
+  801529:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80152c:	48 89 de             	mov    %rbx,%rsi
+  80152f:	4c 89 f7             	mov    %r14,%rdi
+  801532:	48 b8 d6 10 80 00 00 	movabs $0x8010d6,%rax
+  801539:	00 00 00 
+  80153c:	ff d0                	call   *%rax
+  80153e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801541:	48 39 c3             	cmp    %rax,%rbx
+  801544:	74 36                	je     80157c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801546:	48 89 d8             	mov    %rbx,%rax
+  801549:	4c 29 e8             	sub    %r13,%rax
+  80154c:	49 39 c4             	cmp    %rax,%r12
+  80154f:	73 31                	jae    801582 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801551:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801556:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80155a:	4c 89 fe             	mov    %r15,%rsi
+  80155d:	48 b8 ee 14 80 00 00 	movabs $0x8014ee,%rax
+  801564:	00 00 00 
+  801567:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801569:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80156d:	48 83 c4 08          	add    $0x8,%rsp
+  801571:	5b                   	pop    %rbx
+  801572:	41 5c                	pop    %r12
+  801574:	41 5d                	pop    %r13
+  801576:	41 5e                	pop    %r14
+  801578:	41 5f                	pop    %r15
+  80157a:	5d                   	pop    %rbp
+  80157b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80157c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801580:	eb eb                	jmp    80156d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801582:	48 83 eb 01          	sub    $0x1,%rbx
+  801586:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80158a:	48 89 da             	mov    %rbx,%rdx
+  80158d:	4c 89 fe             	mov    %r15,%rsi
+  801590:	48 b8 ee 14 80 00 00 	movabs $0x8014ee,%rax
+  801597:	00 00 00 
+  80159a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80159c:	49 01 de             	add    %rbx,%r14
+  80159f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8015a4:	eb c3                	jmp    801569 <strlcat+0x69>
+
+00000000008015a6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8015a6:	48 85 d2             	test   %rdx,%rdx
+  8015a9:	74 2d                	je     8015d8 <memcmp+0x32>
+  8015ab:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8015b0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8015b4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8015b9:	44 38 c1             	cmp    %r8b,%cl
+  8015bc:	75 0f                	jne    8015cd <memcmp+0x27>
+    while (n-- > 0) {
+  8015be:	48 83 c0 01          	add    $0x1,%rax
+  8015c2:	48 39 c2             	cmp    %rax,%rdx
+  8015c5:	75 e9                	jne    8015b0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8015c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cc:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8015cd:	0f b6 c1             	movzbl %cl,%eax
+  8015d0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8015d4:	44 29 c0             	sub    %r8d,%eax
+  8015d7:	c3                   	ret
+    return 0;
+  8015d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015dd:	c3                   	ret
+
+00000000008015de <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8015de:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8015e2:	48 39 c7             	cmp    %rax,%rdi
+  8015e5:	73 0f                	jae    8015f6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8015e7:	40 38 37             	cmp    %sil,(%rdi)
+  8015ea:	74 0e                	je     8015fa <memfind+0x1c>
+    for (; src < end; src++) {
+  8015ec:	48 83 c7 01          	add    $0x1,%rdi
+  8015f0:	48 39 f8             	cmp    %rdi,%rax
+  8015f3:	75 f2                	jne    8015e7 <memfind+0x9>
+  8015f5:	c3                   	ret
+  8015f6:	48 89 f8             	mov    %rdi,%rax
+  8015f9:	c3                   	ret
+  8015fa:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8015fd:	c3                   	ret
+
+00000000008015fe <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8015fe:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801601:	0f b6 37             	movzbl (%rdi),%esi
+  801604:	40 80 fe 20          	cmp    $0x20,%sil
+  801608:	74 06                	je     801610 <strtol+0x12>
+  80160a:	40 80 fe 09          	cmp    $0x9,%sil
+  80160e:	75 13                	jne    801623 <strtol+0x25>
+  801610:	48 83 c7 01          	add    $0x1,%rdi
+  801614:	0f b6 37             	movzbl (%rdi),%esi
+  801617:	40 80 fe 20          	cmp    $0x20,%sil
+  80161b:	74 f3                	je     801610 <strtol+0x12>
+  80161d:	40 80 fe 09          	cmp    $0x9,%sil
+  801621:	74 ed                	je     801610 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801623:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801626:	83 e0 fd             	and    $0xfffffffd,%eax
+  801629:	3c 01                	cmp    $0x1,%al
+  80162b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80162f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801635:	75 0f                	jne    801646 <strtol+0x48>
+  801637:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80163a:	74 14                	je     801650 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80163c:	85 d2                	test   %edx,%edx
+  80163e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801643:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801646:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80164b:	4c 63 ca             	movslq %edx,%r9
+  80164e:	eb 36                	jmp    801686 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801650:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801654:	74 0f                	je     801665 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801656:	85 d2                	test   %edx,%edx
+  801658:	75 ec                	jne    801646 <strtol+0x48>
+        s++;
+  80165a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80165e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801663:	eb e1                	jmp    801646 <strtol+0x48>
+        s += 2;
+  801665:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801669:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80166e:	eb d6                	jmp    801646 <strtol+0x48>
+            dig -= '0';
+  801670:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801673:	44 0f b6 c1          	movzbl %cl,%r8d
+  801677:	41 39 d0             	cmp    %edx,%r8d
+  80167a:	7d 21                	jge    80169d <strtol+0x9f>
+        val = val * base + dig;
+  80167c:	49 0f af c1          	imul   %r9,%rax
+  801680:	0f b6 c9             	movzbl %cl,%ecx
+  801683:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801686:	48 83 c7 01          	add    $0x1,%rdi
+  80168a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80168e:	80 f9 39             	cmp    $0x39,%cl
+  801691:	76 dd                	jbe    801670 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801693:	80 f9 7b             	cmp    $0x7b,%cl
+  801696:	77 05                	ja     80169d <strtol+0x9f>
+            dig -= 'a' - 10;
+  801698:	83 e9 57             	sub    $0x57,%ecx
+  80169b:	eb d6                	jmp    801673 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80169d:	4d 85 d2             	test   %r10,%r10
+  8016a0:	74 03                	je     8016a5 <strtol+0xa7>
+  8016a2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8016a5:	48 89 c2             	mov    %rax,%rdx
+  8016a8:	48 f7 da             	neg    %rdx
+  8016ab:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8016af:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8016b3:	c3                   	ret
+
+00000000008016b4 <atoi>:
+int atoi(const char *str) {
+  8016b4:	55                   	push   %rbp
+  8016b5:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8016b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c2:	48 b8 fe 15 80 00 00 	movabs $0x8015fe,%rax
+  8016c9:	00 00 00 
+  8016cc:	ff d0                	call   *%rax
+}
+  8016ce:	5d                   	pop    %rbp
+  8016cf:	c3                   	ret
+
+00000000008016d0 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	53                   	push   %rbx
+  8016d5:	48 89 fa             	mov    %rdi,%rdx
+  8016d8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016db:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f5:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8016f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fb:	c9                   	leave
+  8016fc:	c3                   	ret
+
+00000000008016fd <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8016fd:	55                   	push   %rbp
+  8016fe:	48 89 e5             	mov    %rsp,%rbp
+  801701:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801702:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801707:	ba 00 00 00 00       	mov    $0x0,%edx
+  80170c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801711:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801716:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171b:	be 00 00 00 00       	mov    $0x0,%esi
+  801720:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801726:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801728:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80172c:	c9                   	leave
+  80172d:	c3                   	ret
+
+000000000080172e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80172e:	55                   	push   %rbp
+  80172f:	48 89 e5             	mov    %rsp,%rbp
+  801732:	53                   	push   %rbx
+  801733:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801737:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80173a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80173f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801744:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801749:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174e:	be 00 00 00 00       	mov    $0x0,%esi
+  801753:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801759:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80175b:	48 85 c0             	test   %rax,%rax
+  80175e:	7f 06                	jg     801766 <sys_env_destroy+0x38>
+}
+  801760:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801764:	c9                   	leave
+  801765:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801766:	49 89 c0             	mov    %rax,%r8
+  801769:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80176e:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801775:	00 00 00 
+  801778:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80177d:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801784:	00 00 00 
+  801787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178c:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  801793:	00 00 00 
+  801796:	41 ff d1             	call   *%r9
+
+0000000000801799 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801799:	55                   	push   %rbp
+  80179a:	48 89 e5             	mov    %rsp,%rbp
+  80179d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80179e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c2:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c8:	c9                   	leave
+  8017c9:	c3                   	ret
+
+00000000008017ca <sys_yield>:
+
+void
+sys_yield(void) {
+  8017ca:	55                   	push   %rbp
+  8017cb:	48 89 e5             	mov    %rsp,%rbp
+  8017ce:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017cf:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f3:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+
+00000000008017fb <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8017fb:	55                   	push   %rbp
+  8017fc:	48 89 e5             	mov    %rsp,%rbp
+  8017ff:	53                   	push   %rbx
+  801800:	48 89 fa             	mov    %rdi,%rdx
+  801803:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801806:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801812:	00 00 00 
+  801815:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181a:	be 00 00 00 00       	mov    $0x0,%esi
+  80181f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801825:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801827:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182b:	c9                   	leave
+  80182c:	c3                   	ret
+
+000000000080182d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80182d:	55                   	push   %rbp
+  80182e:	48 89 e5             	mov    %rsp,%rbp
+  801831:	53                   	push   %rbx
+  801832:	49 89 f8             	mov    %rdi,%r8
+  801835:	48 89 d3             	mov    %rdx,%rbx
+  801838:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80183b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801840:	4c 89 c2             	mov    %r8,%rdx
+  801843:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801846:	be 00 00 00 00       	mov    $0x0,%esi
+  80184b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801851:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801853:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801857:	c9                   	leave
+  801858:	c3                   	ret
+
+0000000000801859 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801859:	55                   	push   %rbp
+  80185a:	48 89 e5             	mov    %rsp,%rbp
+  80185d:	53                   	push   %rbx
+  80185e:	48 83 ec 08          	sub    $0x8,%rsp
+  801862:	89 f8                	mov    %edi,%eax
+  801864:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801867:	48 63 f9             	movslq %ecx,%rdi
+  80186a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80186d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801872:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801875:	be 00 00 00 00       	mov    $0x0,%esi
+  80187a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801880:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801882:	48 85 c0             	test   %rax,%rax
+  801885:	7f 06                	jg     80188d <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801887:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188b:	c9                   	leave
+  80188c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80188d:	49 89 c0             	mov    %rax,%r8
+  801890:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801895:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  80189c:	00 00 00 
+  80189f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018a4:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  8018ab:	00 00 00 
+  8018ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b3:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  8018ba:	00 00 00 
+  8018bd:	41 ff d1             	call   *%r9
+
+00000000008018c0 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8018c0:	55                   	push   %rbp
+  8018c1:	48 89 e5             	mov    %rsp,%rbp
+  8018c4:	53                   	push   %rbx
+  8018c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8018c9:	89 f8                	mov    %edi,%eax
+  8018cb:	49 89 f2             	mov    %rsi,%r10
+  8018ce:	48 89 cf             	mov    %rcx,%rdi
+  8018d1:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8018d4:	48 63 da             	movslq %edx,%rbx
+  8018d7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018da:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018df:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018e2:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8018e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018e7:	48 85 c0             	test   %rax,%rax
+  8018ea:	7f 06                	jg     8018f2 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8018ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018f0:	c9                   	leave
+  8018f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018f2:	49 89 c0             	mov    %rax,%r8
+  8018f5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8018fa:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801901:	00 00 00 
+  801904:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801909:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801910:	00 00 00 
+  801913:	b8 00 00 00 00       	mov    $0x0,%eax
+  801918:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  80191f:	00 00 00 
+  801922:	41 ff d1             	call   *%r9
+
+0000000000801925 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801925:	55                   	push   %rbp
+  801926:	48 89 e5             	mov    %rsp,%rbp
+  801929:	53                   	push   %rbx
+  80192a:	48 83 ec 08          	sub    $0x8,%rsp
+  80192e:	49 89 f9             	mov    %rdi,%r9
+  801931:	89 f0                	mov    %esi,%eax
+  801933:	48 89 d3             	mov    %rdx,%rbx
+  801936:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801939:	49 63 f0             	movslq %r8d,%rsi
+  80193c:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80193f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801944:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801947:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80194d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80194f:	48 85 c0             	test   %rax,%rax
+  801952:	7f 06                	jg     80195a <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801954:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801958:	c9                   	leave
+  801959:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80195a:	49 89 c0             	mov    %rax,%r8
+  80195d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801962:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801969:	00 00 00 
+  80196c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801971:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801978:	00 00 00 
+  80197b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801980:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  801987:	00 00 00 
+  80198a:	41 ff d1             	call   *%r9
+
+000000000080198d <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  80198d:	55                   	push   %rbp
+  80198e:	48 89 e5             	mov    %rsp,%rbp
+  801991:	53                   	push   %rbx
+  801992:	89 f8                	mov    %edi,%eax
+  801994:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801997:	48 63 f9             	movslq %ecx,%rdi
+  80199a:	48 63 da             	movslq %edx,%rbx
+  80199d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019a5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019b3:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8019b5:	89 c2                	mov    %eax,%edx
+  8019b7:	48 85 c0             	test   %rax,%rax
+  8019ba:	78 0d                	js     8019c9 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8019bc:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8019c1:	4d 85 c9             	test   %r9,%r9
+  8019c4:	74 03                	je     8019c9 <sys_alloc_dma_region+0x3c>
+  8019c6:	49 89 01             	mov    %rax,(%r9)
+}
+  8019c9:	89 d0                	mov    %edx,%eax
+  8019cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019cf:	c9                   	leave
+  8019d0:	c3                   	ret
+
+00000000008019d1 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8019d1:	55                   	push   %rbp
+  8019d2:	48 89 e5             	mov    %rsp,%rbp
+  8019d5:	53                   	push   %rbx
+  8019d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8019da:	48 89 f1             	mov    %rsi,%rcx
+  8019dd:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8019e0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019e3:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8019f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019fa:	48 85 c0             	test   %rax,%rax
+  8019fd:	7f 06                	jg     801a05 <sys_set_cache_region+0x34>
+}
+  8019ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a03:	c9                   	leave
+  801a04:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a05:	49 89 c0             	mov    %rax,%r8
+  801a08:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801a0d:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801a14:	00 00 00 
+  801a17:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a1c:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801a23:	00 00 00 
+  801a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2b:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  801a32:	00 00 00 
+  801a35:	41 ff d1             	call   *%r9
+
+0000000000801a38 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	53                   	push   %rbx
+  801a3d:	48 83 ec 08          	sub    $0x8,%rsp
+  801a41:	48 89 f1             	mov    %rsi,%rcx
+  801a44:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801a47:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a4a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a4f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a54:	be 00 00 00 00       	mov    $0x0,%esi
+  801a59:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a5f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a61:	48 85 c0             	test   %rax,%rax
+  801a64:	7f 06                	jg     801a6c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801a66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a6a:	c9                   	leave
+  801a6b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a6c:	49 89 c0             	mov    %rax,%r8
+  801a6f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801a74:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801a7b:	00 00 00 
+  801a7e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a83:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801a8a:	00 00 00 
+  801a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a92:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  801a99:	00 00 00 
+  801a9c:	41 ff d1             	call   *%r9
+
+0000000000801a9f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801a9f:	55                   	push   %rbp
+  801aa0:	48 89 e5             	mov    %rsp,%rbp
+  801aa3:	53                   	push   %rbx
+  801aa4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801aa8:	48 63 ce             	movslq %esi,%rcx
+  801aab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801aae:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ab3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801abd:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ac8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801aca:	48 85 c0             	test   %rax,%rax
+  801acd:	7f 06                	jg     801ad5 <sys_env_set_status+0x36>
+}
+  801acf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad3:	c9                   	leave
+  801ad4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ad5:	49 89 c0             	mov    %rax,%r8
+  801ad8:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801add:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801ae4:	00 00 00 
+  801ae7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801aec:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801af3:	00 00 00 
+  801af6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afb:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  801b02:	00 00 00 
+  801b05:	41 ff d1             	call   *%r9
+
+0000000000801b08 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801b08:	55                   	push   %rbp
+  801b09:	48 89 e5             	mov    %rsp,%rbp
+  801b0c:	53                   	push   %rbx
+  801b0d:	48 83 ec 08          	sub    $0x8,%rsp
+  801b11:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801b14:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b17:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b21:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b26:	be 00 00 00 00       	mov    $0x0,%esi
+  801b2b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b31:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b33:	48 85 c0             	test   %rax,%rax
+  801b36:	7f 06                	jg     801b3e <sys_env_set_trapframe+0x36>
+}
+  801b38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b3c:	c9                   	leave
+  801b3d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b3e:	49 89 c0             	mov    %rax,%r8
+  801b41:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801b46:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801b4d:	00 00 00 
+  801b50:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801b55:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801b5c:	00 00 00 
+  801b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b64:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  801b6b:	00 00 00 
+  801b6e:	41 ff d1             	call   *%r9
+
+0000000000801b71 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801b71:	55                   	push   %rbp
+  801b72:	48 89 e5             	mov    %rsp,%rbp
+  801b75:	53                   	push   %rbx
+  801b76:	48 83 ec 08          	sub    $0x8,%rsp
+  801b7a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801b7d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b80:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801b94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b9a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b9c:	48 85 c0             	test   %rax,%rax
+  801b9f:	7f 06                	jg     801ba7 <sys_env_set_pgfault_upcall+0x36>
+}
+  801ba1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ba5:	c9                   	leave
+  801ba6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ba7:	49 89 c0             	mov    %rax,%r8
+  801baa:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801baf:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801bb6:	00 00 00 
+  801bb9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801bbe:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801bc5:	00 00 00 
+  801bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcd:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  801bd4:	00 00 00 
+  801bd7:	41 ff d1             	call   *%r9
+
+0000000000801bda <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801bda:	55                   	push   %rbp
+  801bdb:	48 89 e5             	mov    %rsp,%rbp
+  801bde:	53                   	push   %rbx
+  801bdf:	89 f8                	mov    %edi,%eax
+  801be1:	49 89 f1             	mov    %rsi,%r9
+  801be4:	48 89 d3             	mov    %rdx,%rbx
+  801be7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801bea:	49 63 f0             	movslq %r8d,%rsi
+  801bed:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801bf0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bf5:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bf8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bfe:	cd 30                	int    $0x30
+}
+  801c00:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c04:	c9                   	leave
+  801c05:	c3                   	ret
+
+0000000000801c06 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801c06:	55                   	push   %rbp
+  801c07:	48 89 e5             	mov    %rsp,%rbp
+  801c0a:	53                   	push   %rbx
+  801c0b:	48 83 ec 08          	sub    $0x8,%rsp
+  801c0f:	48 89 fa             	mov    %rdi,%rdx
+  801c12:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c15:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c1f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c24:	be 00 00 00 00       	mov    $0x0,%esi
+  801c29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c2f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c31:	48 85 c0             	test   %rax,%rax
+  801c34:	7f 06                	jg     801c3c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c3a:	c9                   	leave
+  801c3b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c3c:	49 89 c0             	mov    %rax,%r8
+  801c3f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801c44:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801c4b:	00 00 00 
+  801c4e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801c53:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801c5a:	00 00 00 
+  801c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c62:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  801c69:	00 00 00 
+  801c6c:	41 ff d1             	call   *%r9
+
+0000000000801c6f <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801c6f:	55                   	push   %rbp
+  801c70:	48 89 e5             	mov    %rsp,%rbp
+  801c73:	53                   	push   %rbx
+  801c74:	48 89 fa             	mov    %rdi,%rdx
+  801c77:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c7a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c84:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c89:	be 00 00 00 00       	mov    $0x0,%esi
+  801c8e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c94:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c96:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+
+0000000000801c9c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801c9c:	55                   	push   %rbp
+  801c9d:	48 89 e5             	mov    %rsp,%rbp
+  801ca0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ca1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ca6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cab:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cba:	be 00 00 00 00       	mov    $0x0,%esi
+  801cbf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cc5:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801cc7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ccb:	c9                   	leave
+  801ccc:	c3                   	ret
+
+0000000000801ccd <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801ccd:	48 85 ff             	test   %rdi,%rdi
+  801cd0:	0f 84 b6 01 00 00    	je     801e8c <malloc+0x1bf>
+malloc(size_t size) {
+  801cd6:	55                   	push   %rbp
+  801cd7:	48 89 e5             	mov    %rsp,%rbp
+  801cda:	41 56                	push   %r14
+  801cdc:	41 55                	push   %r13
+  801cde:	41 54                	push   %r12
+  801ce0:	53                   	push   %rbx
+  801ce1:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801ce4:	48 b8 88 97 80 00 00 	movabs $0x809788,%rax
+  801ceb:	00 00 00 
+  801cee:	4c 8b 20             	mov    (%rax),%r12
+  801cf1:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801cf8:	0f 87 94 01 00 00    	ja     801e92 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801cfe:	48 a1 80 97 80 00 00 	movabs 0x809780,%rax
+  801d05:	00 00 00 
+  801d08:	48 85 c0             	test   %rax,%rax
+  801d0b:	74 6b                	je     801d78 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801d0d:	4d 85 e4             	test   %r12,%r12
+  801d10:	74 66                	je     801d78 <malloc+0xab>
+  801d12:	48 ba a8 97 80 00 00 	movabs $0x8097a8,%rdx
+  801d19:	00 00 00 
+  801d1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d21:	eb 0d                	jmp    801d30 <malloc+0x63>
+  801d23:	48 83 c1 01          	add    $0x1,%rcx
+  801d27:	48 83 c2 18          	add    $0x18,%rdx
+  801d2b:	49 39 cc             	cmp    %rcx,%r12
+  801d2e:	74 48                	je     801d78 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801d30:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801d35:	74 ec                	je     801d23 <malloc+0x56>
+  801d37:	48 39 1a             	cmp    %rbx,(%rdx)
+  801d3a:	72 e7                	jb     801d23 <malloc+0x56>
+                real_freep_size--;
+  801d3c:	48 83 e8 01          	sub    $0x1,%rax
+  801d40:	48 a3 80 97 80 00 00 	movabs %rax,0x809780
+  801d47:	00 00 00 
+                freep[i].is_free = false;
+  801d4a:	48 ba a0 97 80 00 00 	movabs $0x8097a0,%rdx
+  801d51:	00 00 00 
+  801d54:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801d58:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801d5c:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801d60:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801d67:	00 
+                freep[i].size = size;
+  801d68:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801d6c:	48 01 c8             	add    %rcx,%rax
+  801d6f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801d73:	e9 0b 01 00 00       	jmp    801e83 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801d78:	48 a1 c0 77 80 00 00 	movabs 0x8077c0,%rax
+  801d7f:	00 00 00 
+  801d82:	48 01 d8             	add    %rbx,%rax
+  801d85:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801d8b:	76 7c                	jbe    801e09 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801d8d:	48 b8 c8 77 80 00 00 	movabs $0x8077c8,%rax
+  801d94:	00 00 00 
+  801d97:	4c 8b 30             	mov    (%rax),%r14
+  801d9a:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801da1:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801da4:	48 b8 c0 77 80 00 00 	movabs $0x8077c0,%rax
+  801dab:	00 00 00 
+  801dae:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801db5:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801dbc:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801dc2:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801dc6:	48 b8 99 17 80 00 00 	movabs $0x801799,%rax
+  801dcd:	00 00 00 
+  801dd0:	ff d0                	call   *%rax
+  801dd2:	89 c7                	mov    %eax,%edi
+  801dd4:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801ddb:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801de2:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801de9:	00 00 00 
+  801dec:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801df0:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801df5:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  801dfc:	00 00 00 
+  801dff:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	0f 88 90 00 00 00    	js     801e99 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801e09:	48 b9 c8 77 80 00 00 	movabs $0x8077c8,%rcx
+  801e10:	00 00 00 
+  801e13:	48 8b 31             	mov    (%rcx),%rsi
+  801e16:	48 bf c0 77 80 00 00 	movabs $0x8077c0,%rdi
+  801e1d:	00 00 00 
+  801e20:	4c 8b 07             	mov    (%rdi),%r8
+  801e23:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801e27:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801e2e:	00 00 00 
+  801e31:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801e35:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801e39:	48 b8 a0 97 80 00 00 	movabs $0x8097a0,%rax
+  801e40:	00 00 00 
+  801e43:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801e47:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801e4a:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801e4e:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801e55:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801e56:	48 89 d8             	mov    %rbx,%rax
+  801e59:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801e5e:	4c 01 c0             	add    %r8,%rax
+  801e61:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801e64:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801e6b:	48 01 f3             	add    %rsi,%rbx
+  801e6e:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801e71:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801e76:	48 a3 88 97 80 00 00 	movabs %rax,0x809788
+  801e7d:	00 00 00 
+  801e80:	48 89 d0             	mov    %rdx,%rax
+}
+  801e83:	5b                   	pop    %rbx
+  801e84:	41 5c                	pop    %r12
+  801e86:	41 5d                	pop    %r13
+  801e88:	41 5e                	pop    %r14
+  801e8a:	5d                   	pop    %rbp
+  801e8b:	c3                   	ret
+        return NULL;
+  801e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e91:	c3                   	ret
+        return NULL;
+  801e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e97:	eb ea                	jmp    801e83 <malloc+0x1b6>
+            return NULL;
+  801e99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9e:	eb e3                	jmp    801e83 <malloc+0x1b6>
+
+0000000000801ea0 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801ea0:	55                   	push   %rbp
+  801ea1:	48 89 e5             	mov    %rsp,%rbp
+  801ea4:	53                   	push   %rbx
+  801ea5:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801ea9:	48 89 fb             	mov    %rdi,%rbx
+  801eac:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801eb0:	48 89 df             	mov    %rbx,%rdi
+  801eb3:	48 b8 cd 1c 80 00 00 	movabs $0x801ccd,%rax
+  801eba:	00 00 00 
+  801ebd:	ff d0                	call   *%rax
+  801ebf:	48 89 c7             	mov    %rax,%rdi
+  801ec2:	48 89 da             	mov    %rbx,%rdx
+  801ec5:	be 00 00 00 00       	mov    $0x0,%esi
+  801eca:	48 b8 d9 13 80 00 00 	movabs $0x8013d9,%rax
+  801ed1:	00 00 00 
+  801ed4:	ff d0                	call   *%rax
+}
+  801ed6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eda:	c9                   	leave
+  801edb:	c3                   	ret
+
+0000000000801edc <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801edc:	48 a1 88 97 80 00 00 	movabs 0x809788,%rax
+  801ee3:	00 00 00 
+  801ee6:	48 ba 80 97 80 00 00 	movabs $0x809780,%rdx
+  801eed:	00 00 00 
+  801ef0:	48 3b 02             	cmp    (%rdx),%rax
+  801ef3:	74 4d                	je     801f42 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801ef5:	48 85 c0             	test   %rax,%rax
+  801ef8:	74 4d                	je     801f47 <get_allocsize+0x6b>
+  801efa:	48 b9 a0 97 80 00 00 	movabs $0x8097a0,%rcx
+  801f01:	00 00 00 
+  801f04:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801f09:	48 3b 39             	cmp    (%rcx),%rdi
+  801f0c:	74 13                	je     801f21 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801f0e:	48 83 c2 01          	add    $0x1,%rdx
+  801f12:	48 83 c1 18          	add    $0x18,%rcx
+  801f16:	48 39 d0             	cmp    %rdx,%rax
+  801f19:	75 ee                	jne    801f09 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f20:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801f21:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801f25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2a:	48 be a0 97 80 00 00 	movabs $0x8097a0,%rsi
+  801f31:	00 00 00 
+  801f34:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801f3a:	75 0b                	jne    801f47 <get_allocsize+0x6b>
+  801f3c:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801f41:	c3                   	ret
+        return 0;
+  801f42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f47:	c3                   	ret
+
+0000000000801f48 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801f48:	48 85 ff             	test   %rdi,%rdi
+  801f4b:	0f 84 01 01 00 00    	je     802052 <free+0x10a>
+free(void *ptr) {
+  801f51:	55                   	push   %rbp
+  801f52:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801f55:	48 b8 88 97 80 00 00 	movabs $0x809788,%rax
+  801f5c:	00 00 00 
+  801f5f:	48 8b 30             	mov    (%rax),%rsi
+  801f62:	48 a1 80 97 80 00 00 	movabs 0x809780,%rax
+  801f69:	00 00 00 
+  801f6c:	48 39 c6             	cmp    %rax,%rsi
+  801f6f:	74 50                	je     801fc1 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801f71:	48 85 f6             	test   %rsi,%rsi
+  801f74:	74 21                	je     801f97 <free+0x4f>
+  801f76:	48 b9 a0 97 80 00 00 	movabs $0x8097a0,%rcx
+  801f7d:	00 00 00 
+  801f80:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801f85:	48 3b 39             	cmp    (%rcx),%rdi
+  801f88:	74 61                	je     801feb <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801f8a:	48 83 c2 01          	add    $0x1,%rdx
+  801f8e:	48 83 c1 18          	add    $0x18,%rcx
+  801f92:	48 39 d6             	cmp    %rdx,%rsi
+  801f95:	75 ee                	jne    801f85 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801f97:	48 ba 10 57 80 00 00 	movabs $0x805710,%rdx
+  801f9e:	00 00 00 
+  801fa1:	be 12 01 00 00       	mov    $0x112,%esi
+  801fa6:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801fad:	00 00 00 
+  801fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb5:	48 b9 31 06 80 00 00 	movabs $0x800631,%rcx
+  801fbc:	00 00 00 
+  801fbf:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801fc1:	48 ba c0 56 80 00 00 	movabs $0x8056c0,%rdx
+  801fc8:	00 00 00 
+  801fcb:	be 06 01 00 00       	mov    $0x106,%esi
+  801fd0:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801fd7:	00 00 00 
+  801fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fdf:	48 b9 31 06 80 00 00 	movabs $0x800631,%rcx
+  801fe6:	00 00 00 
+  801fe9:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801feb:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801fef:	48 be a0 97 80 00 00 	movabs $0x8097a0,%rsi
+  801ff6:	00 00 00 
+  801ff9:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801fff:	75 27                	jne    802028 <free+0xe0>
+            freep[i].is_free = true;
+  802001:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  802005:	48 ba a0 97 80 00 00 	movabs $0x8097a0,%rdx
+  80200c:	00 00 00 
+  80200f:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  802016:	00 00 
+            real_freep_size++;
+  802018:	48 83 c0 01          	add    $0x1,%rax
+  80201c:	48 a3 80 97 80 00 00 	movabs %rax,0x809780
+  802023:	00 00 00 
+}
+  802026:	5d                   	pop    %rbp
+  802027:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  802028:	48 ba e8 56 80 00 00 	movabs $0x8056e8,%rdx
+  80202f:	00 00 00 
+  802032:	be 0b 01 00 00       	mov    $0x10b,%esi
+  802037:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  80203e:	00 00 00 
+  802041:	b8 00 00 00 00       	mov    $0x0,%eax
+  802046:	48 b9 31 06 80 00 00 	movabs $0x800631,%rcx
+  80204d:	00 00 00 
+  802050:	ff d1                	call   *%rcx
+  802052:	c3                   	ret
+
+0000000000802053 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  802053:	55                   	push   %rbp
+  802054:	48 89 e5             	mov    %rsp,%rbp
+  802057:	41 55                	push   %r13
+  802059:	41 54                	push   %r12
+  80205b:	53                   	push   %rbx
+  80205c:	48 83 ec 08          	sub    $0x8,%rsp
+  802060:	48 89 fb             	mov    %rdi,%rbx
+  802063:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  802066:	48 b8 dc 1e 80 00 00 	movabs $0x801edc,%rax
+  80206d:	00 00 00 
+  802070:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  802072:	49 39 c5             	cmp    %rax,%r13
+  802075:	73 0e                	jae    802085 <realloc+0x32>
+}
+  802077:	48 89 d8             	mov    %rbx,%rax
+  80207a:	48 83 c4 08          	add    $0x8,%rsp
+  80207e:	5b                   	pop    %rbx
+  80207f:	41 5c                	pop    %r12
+  802081:	41 5d                	pop    %r13
+  802083:	5d                   	pop    %rbp
+  802084:	c3                   	ret
+  802085:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  802088:	4c 89 ef             	mov    %r13,%rdi
+  80208b:	48 b8 cd 1c 80 00 00 	movabs $0x801ccd,%rax
+  802092:	00 00 00 
+  802095:	ff d0                	call   *%rax
+  802097:	48 89 c7             	mov    %rax,%rdi
+  80209a:	4c 89 e2             	mov    %r12,%rdx
+  80209d:	48 89 de             	mov    %rbx,%rsi
+  8020a0:	48 b8 ee 14 80 00 00 	movabs $0x8014ee,%rax
+  8020a7:	00 00 00 
+  8020aa:	ff d0                	call   *%rax
+  8020ac:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  8020af:	48 89 df             	mov    %rbx,%rdi
+  8020b2:	48 b8 48 1f 80 00 00 	movabs $0x801f48,%rax
+  8020b9:	00 00 00 
+  8020bc:	ff d0                	call   *%rax
+    return newptr;
+  8020be:	4c 89 e3             	mov    %r12,%rbx
+  8020c1:	eb b4                	jmp    802077 <realloc+0x24>
+
+00000000008020c3 <strdup>:
+
+char*
+strdup (const char *src) {
+  8020c3:	55                   	push   %rbp
+  8020c4:	48 89 e5             	mov    %rsp,%rbp
+  8020c7:	41 54                	push   %r12
+  8020c9:	53                   	push   %rbx
+  8020ca:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  8020cd:	48 b8 bb 10 80 00 00 	movabs $0x8010bb,%rax
+  8020d4:	00 00 00 
+  8020d7:	ff d0                	call   *%rax
+  8020d9:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  8020dd:	4c 89 e7             	mov    %r12,%rdi
+  8020e0:	48 b8 cd 1c 80 00 00 	movabs $0x801ccd,%rax
+  8020e7:	00 00 00 
+  8020ea:	ff d0                	call   *%rax
+  8020ec:	48 89 c7             	mov    %rax,%rdi
+  8020ef:	4c 89 e2             	mov    %r12,%rdx
+  8020f2:	48 89 de             	mov    %rbx,%rsi
+  8020f5:	48 b8 ee 14 80 00 00 	movabs $0x8014ee,%rax
+  8020fc:	00 00 00 
+  8020ff:	ff d0                	call   *%rax
+}
+  802101:	5b                   	pop    %rbx
+  802102:	41 5c                	pop    %r12
+  802104:	5d                   	pop    %rbp
+  802105:	c3                   	ret
+
+0000000000802106 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  802106:	55                   	push   %rbp
+  802107:	48 89 e5             	mov    %rsp,%rbp
+  80210a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80210b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802110:	ba 00 00 00 00       	mov    $0x0,%edx
+  802115:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80211a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80211f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802124:	be 00 00 00 00       	mov    $0x0,%esi
+  802129:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80212f:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  802131:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802135:	c9                   	leave
+  802136:	c3                   	ret
+
+0000000000802137 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  802137:	55                   	push   %rbp
+  802138:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  80213b:	48 b8 a0 97 98 00 00 	movabs $0x9897a0,%rax
+  802142:	00 00 00 
+  802145:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802149:	74 26                	je     802171 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80214b:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80214d:	48 c1 e2 20          	shl    $0x20,%rdx
+  802151:	89 c0                	mov    %eax,%eax
+  802153:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  802156:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  80215d:	48 b9 a0 97 98 00 00 	movabs $0x9897a0,%rcx
+  802164:	00 00 00 
+  802167:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216c:	48 f7 31             	divq   (%rcx)
+}
+  80216f:	5d                   	pop    %rbp
+  802170:	c3                   	ret
+        freq = get_cpufreq();
+  802171:	b8 00 00 00 00       	mov    $0x0,%eax
+  802176:	48 ba 06 21 80 00 00 	movabs $0x802106,%rdx
+  80217d:	00 00 00 
+  802180:	ff d2                	call   *%rdx
+  802182:	48 a3 a0 97 98 00 00 	movabs %rax,0x9897a0
+  802189:	00 00 00 
+  80218c:	eb bd                	jmp    80214b <get_ticks+0x14>
+
+000000000080218e <sleep>:
+
+void
+sleep(uint64_t ms) {
+  80218e:	55                   	push   %rbp
+  80218f:	48 89 e5             	mov    %rsp,%rbp
+  802192:	53                   	push   %rbx
+  802193:	48 83 ec 08          	sub    $0x8,%rsp
+  802197:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  80219a:	48 b8 a0 97 98 00 00 	movabs $0x9897a0,%rax
+  8021a1:	00 00 00 
+  8021a4:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8021a8:	74 50                	je     8021fa <sleep+0x6c>
+    asm volatile("rdtsc"
+  8021aa:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8021ac:	48 c1 e2 20          	shl    $0x20,%rdx
+  8021b0:	89 c0                	mov    %eax,%eax
+  8021b2:	48 89 d6             	mov    %rdx,%rsi
+  8021b5:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  8021b8:	48 b8 a0 97 98 00 00 	movabs $0x9897a0,%rax
+  8021bf:	00 00 00 
+  8021c2:	48 0f af 18          	imul   (%rax),%rbx
+  8021c6:	48 c1 eb 03          	shr    $0x3,%rbx
+  8021ca:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  8021d1:	9b c4 20 
+  8021d4:	48 89 d8             	mov    %rbx,%rax
+  8021d7:	48 f7 e2             	mul    %rdx
+  8021da:	48 89 d1             	mov    %rdx,%rcx
+  8021dd:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  8021e1:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8021e3:	48 c1 e2 20          	shl    $0x20,%rdx
+  8021e7:	89 c0                	mov    %eax,%eax
+  8021e9:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  8021ec:	48 29 f2             	sub    %rsi,%rdx
+  8021ef:	48 39 ca             	cmp    %rcx,%rdx
+  8021f2:	72 ed                	jb     8021e1 <sleep+0x53>
+}
+  8021f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021f8:	c9                   	leave
+  8021f9:	c3                   	ret
+        freq = get_cpufreq();
+  8021fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ff:	48 ba 06 21 80 00 00 	movabs $0x802106,%rdx
+  802206:	00 00 00 
+  802209:	ff d2                	call   *%rdx
+  80220b:	48 a3 a0 97 98 00 00 	movabs %rax,0x9897a0
+  802212:	00 00 00 
+  802215:	eb 93                	jmp    8021aa <sleep+0x1c>
+
+0000000000802217 <poll_kbd>:
+
+int poll_kbd() {
+  802217:	55                   	push   %rbp
+  802218:	48 89 e5             	mov    %rsp,%rbp
+  80221b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80221c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802221:	ba 00 00 00 00       	mov    $0x0,%edx
+  802226:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80222b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802230:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802235:	be 00 00 00 00       	mov    $0x0,%esi
+  80223a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802240:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  802242:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802246:	c9                   	leave
+  802247:	c3                   	ret
+
+0000000000802248 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  802248:	55                   	push   %rbp
+  802249:	48 89 e5             	mov    %rsp,%rbp
+  80224c:	53                   	push   %rbx
+  80224d:	49 89 fa             	mov    %rdi,%r10
+  802250:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  802252:	44 89 c6             	mov    %r8d,%esi
+  802255:	89 cf                	mov    %ecx,%edi
+  802257:	89 d3                	mov    %edx,%ebx
+  802259:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80225b:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802260:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802263:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  802267:	cd 30                	int    $0x30
+  802269:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80226d:	c9                   	leave
+  80226e:	c3                   	ret
+
+000000000080226f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80226f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802276:	ff ff ff 
+  802279:	48 01 f8             	add    %rdi,%rax
+  80227c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802280:	c3                   	ret
+
+0000000000802281 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802281:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802288:	ff ff ff 
+  80228b:	48 01 f8             	add    %rdi,%rax
+  80228e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802292:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802298:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80229c:	c3                   	ret
+
+000000000080229d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80229d:	55                   	push   %rbp
+  80229e:	48 89 e5             	mov    %rsp,%rbp
+  8022a1:	41 57                	push   %r15
+  8022a3:	41 56                	push   %r14
+  8022a5:	41 55                	push   %r13
+  8022a7:	41 54                	push   %r12
+  8022a9:	53                   	push   %rbx
+  8022aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ae:	49 89 ff             	mov    %rdi,%r15
+  8022b1:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8022b6:	49 bd 91 4a 80 00 00 	movabs $0x804a91,%r13
+  8022bd:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8022c0:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8022c6:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8022c9:	48 89 df             	mov    %rbx,%rdi
+  8022cc:	41 ff d5             	call   *%r13
+  8022cf:	83 e0 04             	and    $0x4,%eax
+  8022d2:	74 17                	je     8022eb <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8022d4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8022db:	4c 39 f3             	cmp    %r14,%rbx
+  8022de:	75 e6                	jne    8022c6 <fd_alloc+0x29>
+  8022e0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8022e6:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8022eb:	4d 89 27             	mov    %r12,(%r15)
+}
+  8022ee:	48 83 c4 08          	add    $0x8,%rsp
+  8022f2:	5b                   	pop    %rbx
+  8022f3:	41 5c                	pop    %r12
+  8022f5:	41 5d                	pop    %r13
+  8022f7:	41 5e                	pop    %r14
+  8022f9:	41 5f                	pop    %r15
+  8022fb:	5d                   	pop    %rbp
+  8022fc:	c3                   	ret
+
+00000000008022fd <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8022fd:	83 ff 1f             	cmp    $0x1f,%edi
+  802300:	77 39                	ja     80233b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802302:	55                   	push   %rbp
+  802303:	48 89 e5             	mov    %rsp,%rbp
+  802306:	41 54                	push   %r12
+  802308:	53                   	push   %rbx
+  802309:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80230c:	48 63 df             	movslq %edi,%rbx
+  80230f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802316:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80231a:	48 89 df             	mov    %rbx,%rdi
+  80231d:	48 b8 91 4a 80 00 00 	movabs $0x804a91,%rax
+  802324:	00 00 00 
+  802327:	ff d0                	call   *%rax
+  802329:	a8 04                	test   $0x4,%al
+  80232b:	74 14                	je     802341 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80232d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802331:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802336:	5b                   	pop    %rbx
+  802337:	41 5c                	pop    %r12
+  802339:	5d                   	pop    %rbp
+  80233a:	c3                   	ret
+        return -E_INVAL;
+  80233b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802340:	c3                   	ret
+        return -E_INVAL;
+  802341:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802346:	eb ee                	jmp    802336 <fd_lookup+0x39>
+
+0000000000802348 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802348:	55                   	push   %rbp
+  802349:	48 89 e5             	mov    %rsp,%rbp
+  80234c:	41 54                	push   %r12
+  80234e:	53                   	push   %rbx
+  80234f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802352:	48 b8 e0 57 80 00 00 	movabs $0x8057e0,%rax
+  802359:	00 00 00 
+  80235c:	48 bb e0 77 80 00 00 	movabs $0x8077e0,%rbx
+  802363:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802366:	39 3b                	cmp    %edi,(%rbx)
+  802368:	74 47                	je     8023b1 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80236a:	48 83 c0 08          	add    $0x8,%rax
+  80236e:	48 8b 18             	mov    (%rax),%rbx
+  802371:	48 85 db             	test   %rbx,%rbx
+  802374:	75 f0                	jne    802366 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802376:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  80237d:	00 00 00 
+  802380:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802386:	89 fa                	mov    %edi,%edx
+  802388:	48 bf 48 57 80 00 00 	movabs $0x805748,%rdi
+  80238f:	00 00 00 
+  802392:	b8 00 00 00 00       	mov    $0x0,%eax
+  802397:	48 b9 81 07 80 00 00 	movabs $0x800781,%rcx
+  80239e:	00 00 00 
+  8023a1:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8023a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8023a8:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8023ac:	5b                   	pop    %rbx
+  8023ad:	41 5c                	pop    %r12
+  8023af:	5d                   	pop    %rbp
+  8023b0:	c3                   	ret
+            return 0;
+  8023b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b6:	eb f0                	jmp    8023a8 <dev_lookup+0x60>
+
+00000000008023b8 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8023b8:	55                   	push   %rbp
+  8023b9:	48 89 e5             	mov    %rsp,%rbp
+  8023bc:	41 55                	push   %r13
+  8023be:	41 54                	push   %r12
+  8023c0:	53                   	push   %rbx
+  8023c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8023c5:	48 89 fb             	mov    %rdi,%rbx
+  8023c8:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8023cb:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8023d2:	ff ff ff 
+  8023d5:	48 01 df             	add    %rbx,%rdi
+  8023d8:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8023dc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023e0:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8023e7:	00 00 00 
+  8023ea:	ff d0                	call   *%rax
+  8023ec:	41 89 c5             	mov    %eax,%r13d
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	78 06                	js     8023f9 <fd_close+0x41>
+  8023f3:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8023f7:	74 1a                	je     802413 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8023f9:	45 84 e4             	test   %r12b,%r12b
+  8023fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802401:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802405:	44 89 e8             	mov    %r13d,%eax
+  802408:	48 83 c4 18          	add    $0x18,%rsp
+  80240c:	5b                   	pop    %rbx
+  80240d:	41 5c                	pop    %r12
+  80240f:	41 5d                	pop    %r13
+  802411:	5d                   	pop    %rbp
+  802412:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802413:	8b 3b                	mov    (%rbx),%edi
+  802415:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802419:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  802420:	00 00 00 
+  802423:	ff d0                	call   *%rax
+  802425:	41 89 c5             	mov    %eax,%r13d
+  802428:	85 c0                	test   %eax,%eax
+  80242a:	78 1b                	js     802447 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80242c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802430:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802434:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80243a:	48 85 c0             	test   %rax,%rax
+  80243d:	74 08                	je     802447 <fd_close+0x8f>
+  80243f:	48 89 df             	mov    %rbx,%rdi
+  802442:	ff d0                	call   *%rax
+  802444:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802447:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80244c:	48 89 de             	mov    %rbx,%rsi
+  80244f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802454:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  80245b:	00 00 00 
+  80245e:	ff d0                	call   *%rax
+    return res;
+  802460:	eb a3                	jmp    802405 <fd_close+0x4d>
+
+0000000000802462 <close>:
+
+int
+close(int fdnum) {
+  802462:	55                   	push   %rbp
+  802463:	48 89 e5             	mov    %rsp,%rbp
+  802466:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80246a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80246e:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80247a:	85 c0                	test   %eax,%eax
+  80247c:	78 15                	js     802493 <close+0x31>
+
+    return fd_close(fd, 1);
+  80247e:	be 01 00 00 00       	mov    $0x1,%esi
+  802483:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802487:	48 b8 b8 23 80 00 00 	movabs $0x8023b8,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+}
+  802493:	c9                   	leave
+  802494:	c3                   	ret
+
+0000000000802495 <close_all>:
+
+void
+close_all(void) {
+  802495:	55                   	push   %rbp
+  802496:	48 89 e5             	mov    %rsp,%rbp
+  802499:	41 54                	push   %r12
+  80249b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80249c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024a1:	49 bc 62 24 80 00 00 	movabs $0x802462,%r12
+  8024a8:	00 00 00 
+  8024ab:	89 df                	mov    %ebx,%edi
+  8024ad:	41 ff d4             	call   *%r12
+  8024b0:	83 c3 01             	add    $0x1,%ebx
+  8024b3:	83 fb 20             	cmp    $0x20,%ebx
+  8024b6:	75 f3                	jne    8024ab <close_all+0x16>
+}
+  8024b8:	5b                   	pop    %rbx
+  8024b9:	41 5c                	pop    %r12
+  8024bb:	5d                   	pop    %rbp
+  8024bc:	c3                   	ret
+
+00000000008024bd <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8024bd:	55                   	push   %rbp
+  8024be:	48 89 e5             	mov    %rsp,%rbp
+  8024c1:	41 57                	push   %r15
+  8024c3:	41 56                	push   %r14
+  8024c5:	41 55                	push   %r13
+  8024c7:	41 54                	push   %r12
+  8024c9:	53                   	push   %rbx
+  8024ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8024ce:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8024d1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8024d5:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8024dc:	00 00 00 
+  8024df:	ff d0                	call   *%rax
+  8024e1:	89 c3                	mov    %eax,%ebx
+  8024e3:	85 c0                	test   %eax,%eax
+  8024e5:	0f 88 b8 00 00 00    	js     8025a3 <dup+0xe6>
+    close(newfdnum);
+  8024eb:	44 89 e7             	mov    %r12d,%edi
+  8024ee:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  8024f5:	00 00 00 
+  8024f8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8024fa:	4d 63 ec             	movslq %r12d,%r13
+  8024fd:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802504:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802508:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80250c:	4c 89 ff             	mov    %r15,%rdi
+  80250f:	49 be 81 22 80 00 00 	movabs $0x802281,%r14
+  802516:	00 00 00 
+  802519:	41 ff d6             	call   *%r14
+  80251c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80251f:	4c 89 ef             	mov    %r13,%rdi
+  802522:	41 ff d6             	call   *%r14
+  802525:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802528:	48 89 df             	mov    %rbx,%rdi
+  80252b:	48 b8 91 4a 80 00 00 	movabs $0x804a91,%rax
+  802532:	00 00 00 
+  802535:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802537:	a8 04                	test   $0x4,%al
+  802539:	74 2b                	je     802566 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80253b:	41 89 c1             	mov    %eax,%r9d
+  80253e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802544:	4c 89 f1             	mov    %r14,%rcx
+  802547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254c:	48 89 de             	mov    %rbx,%rsi
+  80254f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802554:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  80255b:	00 00 00 
+  80255e:	ff d0                	call   *%rax
+  802560:	89 c3                	mov    %eax,%ebx
+  802562:	85 c0                	test   %eax,%eax
+  802564:	78 4e                	js     8025b4 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802566:	4c 89 ff             	mov    %r15,%rdi
+  802569:	48 b8 91 4a 80 00 00 	movabs $0x804a91,%rax
+  802570:	00 00 00 
+  802573:	ff d0                	call   *%rax
+  802575:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802578:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80257e:	4c 89 e9             	mov    %r13,%rcx
+  802581:	ba 00 00 00 00       	mov    $0x0,%edx
+  802586:	4c 89 fe             	mov    %r15,%rsi
+  802589:	bf 00 00 00 00       	mov    $0x0,%edi
+  80258e:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  802595:	00 00 00 
+  802598:	ff d0                	call   *%rax
+  80259a:	89 c3                	mov    %eax,%ebx
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	78 14                	js     8025b4 <dup+0xf7>
+
+    return newfdnum;
+  8025a0:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8025a3:	89 d8                	mov    %ebx,%eax
+  8025a5:	48 83 c4 18          	add    $0x18,%rsp
+  8025a9:	5b                   	pop    %rbx
+  8025aa:	41 5c                	pop    %r12
+  8025ac:	41 5d                	pop    %r13
+  8025ae:	41 5e                	pop    %r14
+  8025b0:	41 5f                	pop    %r15
+  8025b2:	5d                   	pop    %rbp
+  8025b3:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8025b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025b9:	4c 89 ee             	mov    %r13,%rsi
+  8025bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c1:	49 bc 38 1a 80 00 00 	movabs $0x801a38,%r12
+  8025c8:	00 00 00 
+  8025cb:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8025ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025d3:	4c 89 f6             	mov    %r14,%rsi
+  8025d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025db:	41 ff d4             	call   *%r12
+    return res;
+  8025de:	eb c3                	jmp    8025a3 <dup+0xe6>
+
+00000000008025e0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8025e0:	55                   	push   %rbp
+  8025e1:	48 89 e5             	mov    %rsp,%rbp
+  8025e4:	41 56                	push   %r14
+  8025e6:	41 55                	push   %r13
+  8025e8:	41 54                	push   %r12
+  8025ea:	53                   	push   %rbx
+  8025eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ef:	89 fb                	mov    %edi,%ebx
+  8025f1:	49 89 f4             	mov    %rsi,%r12
+  8025f4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025f7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025fb:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  802602:	00 00 00 
+  802605:	ff d0                	call   *%rax
+  802607:	85 c0                	test   %eax,%eax
+  802609:	78 4c                	js     802657 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80260b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80260f:	41 8b 3e             	mov    (%r14),%edi
+  802612:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802616:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  80261d:	00 00 00 
+  802620:	ff d0                	call   *%rax
+  802622:	85 c0                	test   %eax,%eax
+  802624:	78 35                	js     80265b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802626:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80262a:	83 e0 03             	and    $0x3,%eax
+  80262d:	83 f8 01             	cmp    $0x1,%eax
+  802630:	74 2d                	je     80265f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802632:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802636:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80263a:	48 85 c0             	test   %rax,%rax
+  80263d:	74 56                	je     802695 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80263f:	4c 89 ea             	mov    %r13,%rdx
+  802642:	4c 89 e6             	mov    %r12,%rsi
+  802645:	4c 89 f7             	mov    %r14,%rdi
+  802648:	ff d0                	call   *%rax
+}
+  80264a:	48 83 c4 10          	add    $0x10,%rsp
+  80264e:	5b                   	pop    %rbx
+  80264f:	41 5c                	pop    %r12
+  802651:	41 5d                	pop    %r13
+  802653:	41 5e                	pop    %r14
+  802655:	5d                   	pop    %rbp
+  802656:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802657:	48 98                	cltq
+  802659:	eb ef                	jmp    80264a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80265b:	48 98                	cltq
+  80265d:	eb eb                	jmp    80264a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80265f:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  802666:	00 00 00 
+  802669:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80266f:	89 da                	mov    %ebx,%edx
+  802671:	48 bf 89 57 80 00 00 	movabs $0x805789,%rdi
+  802678:	00 00 00 
+  80267b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802680:	48 b9 81 07 80 00 00 	movabs $0x800781,%rcx
+  802687:	00 00 00 
+  80268a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80268c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802693:	eb b5                	jmp    80264a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802695:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80269c:	eb ac                	jmp    80264a <read+0x6a>
+
+000000000080269e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80269e:	55                   	push   %rbp
+  80269f:	48 89 e5             	mov    %rsp,%rbp
+  8026a2:	41 57                	push   %r15
+  8026a4:	41 56                	push   %r14
+  8026a6:	41 55                	push   %r13
+  8026a8:	41 54                	push   %r12
+  8026aa:	53                   	push   %rbx
+  8026ab:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8026af:	48 85 d2             	test   %rdx,%rdx
+  8026b2:	74 54                	je     802708 <readn+0x6a>
+  8026b4:	41 89 fd             	mov    %edi,%r13d
+  8026b7:	49 89 f6             	mov    %rsi,%r14
+  8026ba:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8026bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8026c2:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8026c7:	49 bf e0 25 80 00 00 	movabs $0x8025e0,%r15
+  8026ce:	00 00 00 
+  8026d1:	4c 89 e2             	mov    %r12,%rdx
+  8026d4:	48 29 f2             	sub    %rsi,%rdx
+  8026d7:	4c 01 f6             	add    %r14,%rsi
+  8026da:	44 89 ef             	mov    %r13d,%edi
+  8026dd:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8026e0:	85 c0                	test   %eax,%eax
+  8026e2:	78 20                	js     802704 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8026e4:	01 c3                	add    %eax,%ebx
+  8026e6:	85 c0                	test   %eax,%eax
+  8026e8:	74 08                	je     8026f2 <readn+0x54>
+  8026ea:	48 63 f3             	movslq %ebx,%rsi
+  8026ed:	4c 39 e6             	cmp    %r12,%rsi
+  8026f0:	72 df                	jb     8026d1 <readn+0x33>
+    }
+    return res;
+  8026f2:	48 63 c3             	movslq %ebx,%rax
+}
+  8026f5:	48 83 c4 08          	add    $0x8,%rsp
+  8026f9:	5b                   	pop    %rbx
+  8026fa:	41 5c                	pop    %r12
+  8026fc:	41 5d                	pop    %r13
+  8026fe:	41 5e                	pop    %r14
+  802700:	41 5f                	pop    %r15
+  802702:	5d                   	pop    %rbp
+  802703:	c3                   	ret
+        if (inc < 0) return inc;
+  802704:	48 98                	cltq
+  802706:	eb ed                	jmp    8026f5 <readn+0x57>
+    int inc = 1, res = 0;
+  802708:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80270d:	eb e3                	jmp    8026f2 <readn+0x54>
+
+000000000080270f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80270f:	55                   	push   %rbp
+  802710:	48 89 e5             	mov    %rsp,%rbp
+  802713:	41 56                	push   %r14
+  802715:	41 55                	push   %r13
+  802717:	41 54                	push   %r12
+  802719:	53                   	push   %rbx
+  80271a:	48 83 ec 10          	sub    $0x10,%rsp
+  80271e:	89 fb                	mov    %edi,%ebx
+  802720:	49 89 f4             	mov    %rsi,%r12
+  802723:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802726:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80272a:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  802731:	00 00 00 
+  802734:	ff d0                	call   *%rax
+  802736:	85 c0                	test   %eax,%eax
+  802738:	78 47                	js     802781 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80273a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80273e:	41 8b 3e             	mov    (%r14),%edi
+  802741:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802745:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  80274c:	00 00 00 
+  80274f:	ff d0                	call   *%rax
+  802751:	85 c0                	test   %eax,%eax
+  802753:	78 30                	js     802785 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802755:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80275a:	74 2d                	je     802789 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80275c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802760:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802764:	48 85 c0             	test   %rax,%rax
+  802767:	74 56                	je     8027bf <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802769:	4c 89 ea             	mov    %r13,%rdx
+  80276c:	4c 89 e6             	mov    %r12,%rsi
+  80276f:	4c 89 f7             	mov    %r14,%rdi
+  802772:	ff d0                	call   *%rax
+}
+  802774:	48 83 c4 10          	add    $0x10,%rsp
+  802778:	5b                   	pop    %rbx
+  802779:	41 5c                	pop    %r12
+  80277b:	41 5d                	pop    %r13
+  80277d:	41 5e                	pop    %r14
+  80277f:	5d                   	pop    %rbp
+  802780:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802781:	48 98                	cltq
+  802783:	eb ef                	jmp    802774 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802785:	48 98                	cltq
+  802787:	eb eb                	jmp    802774 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802789:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  802790:	00 00 00 
+  802793:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802799:	89 da                	mov    %ebx,%edx
+  80279b:	48 bf a5 57 80 00 00 	movabs $0x8057a5,%rdi
+  8027a2:	00 00 00 
+  8027a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027aa:	48 b9 81 07 80 00 00 	movabs $0x800781,%rcx
+  8027b1:	00 00 00 
+  8027b4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8027b6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8027bd:	eb b5                	jmp    802774 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027bf:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8027c6:	eb ac                	jmp    802774 <write+0x65>
+
+00000000008027c8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8027c8:	55                   	push   %rbp
+  8027c9:	48 89 e5             	mov    %rsp,%rbp
+  8027cc:	53                   	push   %rbx
+  8027cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8027d1:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027d3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027d7:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8027de:	00 00 00 
+  8027e1:	ff d0                	call   *%rax
+  8027e3:	85 c0                	test   %eax,%eax
+  8027e5:	78 0c                	js     8027f3 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8027e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027eb:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8027ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027f7:	c9                   	leave
+  8027f8:	c3                   	ret
+
+00000000008027f9 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8027f9:	55                   	push   %rbp
+  8027fa:	48 89 e5             	mov    %rsp,%rbp
+  8027fd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802801:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802805:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  80280c:	00 00 00 
+  80280f:	ff d0                	call   *%rax
+  802811:	85 c0                	test   %eax,%eax
+  802813:	78 07                	js     80281c <tell+0x23>
+    return fdes->fd_offset;
+  802815:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802819:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80281c:	c9                   	leave
+  80281d:	c3                   	ret
+
+000000000080281e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80281e:	55                   	push   %rbp
+  80281f:	48 89 e5             	mov    %rsp,%rbp
+  802822:	41 55                	push   %r13
+  802824:	41 54                	push   %r12
+  802826:	53                   	push   %rbx
+  802827:	48 83 ec 18          	sub    $0x18,%rsp
+  80282b:	89 fb                	mov    %edi,%ebx
+  80282d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802830:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802834:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  80283b:	00 00 00 
+  80283e:	ff d0                	call   *%rax
+  802840:	85 c0                	test   %eax,%eax
+  802842:	78 38                	js     80287c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802844:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802848:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80284c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802850:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  802857:	00 00 00 
+  80285a:	ff d0                	call   *%rax
+  80285c:	85 c0                	test   %eax,%eax
+  80285e:	78 1c                	js     80287c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802860:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802865:	74 20                	je     802887 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802867:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80286b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80286f:	48 85 c0             	test   %rax,%rax
+  802872:	74 47                	je     8028bb <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802874:	44 89 e6             	mov    %r12d,%esi
+  802877:	4c 89 ef             	mov    %r13,%rdi
+  80287a:	ff d0                	call   *%rax
+}
+  80287c:	48 83 c4 18          	add    $0x18,%rsp
+  802880:	5b                   	pop    %rbx
+  802881:	41 5c                	pop    %r12
+  802883:	41 5d                	pop    %r13
+  802885:	5d                   	pop    %rbp
+  802886:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802887:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  80288e:	00 00 00 
+  802891:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802897:	89 da                	mov    %ebx,%edx
+  802899:	48 bf 68 57 80 00 00 	movabs $0x805768,%rdi
+  8028a0:	00 00 00 
+  8028a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a8:	48 b9 81 07 80 00 00 	movabs $0x800781,%rcx
+  8028af:	00 00 00 
+  8028b2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8028b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b9:	eb c1                	jmp    80287c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028bb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8028c0:	eb ba                	jmp    80287c <ftruncate+0x5e>
+
+00000000008028c2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8028c2:	55                   	push   %rbp
+  8028c3:	48 89 e5             	mov    %rsp,%rbp
+  8028c6:	41 54                	push   %r12
+  8028c8:	53                   	push   %rbx
+  8028c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8028cd:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028d0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028d4:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8028db:	00 00 00 
+  8028de:	ff d0                	call   *%rax
+  8028e0:	85 c0                	test   %eax,%eax
+  8028e2:	78 4e                	js     802932 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028e4:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8028e8:	41 8b 3c 24          	mov    (%r12),%edi
+  8028ec:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8028f0:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  8028f7:	00 00 00 
+  8028fa:	ff d0                	call   *%rax
+  8028fc:	85 c0                	test   %eax,%eax
+  8028fe:	78 32                	js     802932 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802900:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802904:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802909:	74 30                	je     80293b <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80290b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80290e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802915:	00 00 00 
+    stat->st_isdir = 0;
+  802918:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80291f:	00 00 00 
+    stat->st_dev = dev;
+  802922:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802929:	48 89 de             	mov    %rbx,%rsi
+  80292c:	4c 89 e7             	mov    %r12,%rdi
+  80292f:	ff 50 28             	call   *0x28(%rax)
+}
+  802932:	48 83 c4 10          	add    $0x10,%rsp
+  802936:	5b                   	pop    %rbx
+  802937:	41 5c                	pop    %r12
+  802939:	5d                   	pop    %rbp
+  80293a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80293b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802940:	eb f0                	jmp    802932 <fstat+0x70>
+
+0000000000802942 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802942:	55                   	push   %rbp
+  802943:	48 89 e5             	mov    %rsp,%rbp
+  802946:	41 54                	push   %r12
+  802948:	53                   	push   %rbx
+  802949:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802950:	41 89 fc             	mov    %edi,%r12d
+  802953:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802955:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802959:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  802960:	00 00 00 
+  802963:	ff d0                	call   *%rax
+  802965:	85 c0                	test   %eax,%eax
+  802967:	78 31                	js     80299a <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802969:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802970:	44 89 e7             	mov    %r12d,%edi
+  802973:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  80297a:	00 00 00 
+  80297d:	ff d0                	call   *%rax
+  80297f:	85 c0                	test   %eax,%eax
+  802981:	78 17                	js     80299a <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802983:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802987:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  80298a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80298d:	39 d3                	cmp    %edx,%ebx
+  80298f:	0f 4f da             	cmovg  %edx,%ebx
+  802992:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802995:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80299a:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8029a1:	5b                   	pop    %rbx
+  8029a2:	41 5c                	pop    %r12
+  8029a4:	5d                   	pop    %rbp
+  8029a5:	c3                   	ret
+
+00000000008029a6 <seektoend>:
+{
+  8029a6:	55                   	push   %rbp
+  8029a7:	48 89 e5             	mov    %rsp,%rbp
+  8029aa:	53                   	push   %rbx
+  8029ab:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8029b2:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8029b4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8029b8:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8029bf:	00 00 00 
+  8029c2:	ff d0                	call   *%rax
+  8029c4:	85 c0                	test   %eax,%eax
+  8029c6:	78 28                	js     8029f0 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8029c8:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8029cf:	89 df                	mov    %ebx,%edi
+  8029d1:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+  8029dd:	85 c0                	test   %eax,%eax
+  8029df:	78 0f                	js     8029f0 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8029e1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8029e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029e8:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8029eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029f4:	c9                   	leave
+  8029f5:	c3                   	ret
+
+00000000008029f6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8029f6:	55                   	push   %rbp
+  8029f7:	48 89 e5             	mov    %rsp,%rbp
+  8029fa:	41 54                	push   %r12
+  8029fc:	53                   	push   %rbx
+  8029fd:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802a00:	be 00 00 00 00       	mov    $0x0,%esi
+  802a05:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  802a0c:	00 00 00 
+  802a0f:	ff d0                	call   *%rax
+  802a11:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802a13:	85 c0                	test   %eax,%eax
+  802a15:	78 25                	js     802a3c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802a17:	4c 89 e6             	mov    %r12,%rsi
+  802a1a:	89 c7                	mov    %eax,%edi
+  802a1c:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  802a23:	00 00 00 
+  802a26:	ff d0                	call   *%rax
+  802a28:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802a2b:	89 df                	mov    %ebx,%edi
+  802a2d:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  802a34:	00 00 00 
+  802a37:	ff d0                	call   *%rax
+
+    return res;
+  802a39:	44 89 e3             	mov    %r12d,%ebx
+}
+  802a3c:	89 d8                	mov    %ebx,%eax
+  802a3e:	5b                   	pop    %rbx
+  802a3f:	41 5c                	pop    %r12
+  802a41:	5d                   	pop    %rbp
+  802a42:	c3                   	ret
+
+0000000000802a43 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802a43:	55                   	push   %rbp
+  802a44:	48 89 e5             	mov    %rsp,%rbp
+  802a47:	53                   	push   %rbx
+  802a48:	48 83 ec 08          	sub    $0x8,%rsp
+  802a4c:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802a4f:	48 b8 6f 22 80 00 00 	movabs $0x80226f,%rax
+  802a56:	00 00 00 
+  802a59:	ff d0                	call   *%rax
+  802a5b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802a5f:	0f 87 ea 00 00 00    	ja     802b4f <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802a65:	48 b8 04 b0 98 00 00 	movabs $0x98b004,%rax
+  802a6c:	00 00 00 
+  802a6f:	80 38 00             	cmpb   $0x0,(%rax)
+  802a72:	75 35                	jne    802aa9 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802a74:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a79:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802a7e:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802a83:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a88:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+  802a94:	85 c0                	test   %eax,%eax
+  802a96:	0f 88 ba 00 00 00    	js     802b56 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802a9c:	48 b8 04 b0 98 00 00 	movabs $0x98b004,%rax
+  802aa3:	00 00 00 
+  802aa6:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802aa9:	48 89 df             	mov    %rbx,%rdi
+  802aac:	48 b8 6f 22 80 00 00 	movabs $0x80226f,%rax
+  802ab3:	00 00 00 
+  802ab6:	ff d0                	call   *%rax
+  802ab8:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802abc:	48 ba 20 b0 98 00 00 	movabs $0x98b020,%rdx
+  802ac3:	00 00 00 
+  802ac6:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802aca:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802acd:	39 39                	cmp    %edi,(%rcx)
+  802acf:	74 46                	je     802b17 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802ad1:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802ad5:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802adc:	00 
+  802add:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802ae4:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802aeb:	00 
+  802aec:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802af3:	00 
+  802af4:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802afb:	00 
+  802afc:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802b03:	00 
+  802b04:	89 39                	mov    %edi,(%rcx)
+  802b06:	48 01 c6             	add    %rax,%rsi
+  802b09:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802b0e:	48 89 c8             	mov    %rcx,%rax
+  802b11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802b17:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802b1b:	48 be 20 b0 98 00 00 	movabs $0x98b020,%rsi
+  802b22:	00 00 00 
+  802b25:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802b28:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802b2c:	74 e0                	je     802b0e <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802b2e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802b35:	00 
+  802b36:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802b3a:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802b41:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802b43:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802b46:	48 01 c2             	add    %rax,%rdx
+  802b49:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802b4d:	eb bf                	jmp    802b0e <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802b4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b54:	eb b8                	jmp    802b0e <fbuf_get+0xcb>
+            return NULL;
+  802b56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b5b:	eb b1                	jmp    802b0e <fbuf_get+0xcb>
+
+0000000000802b5d <fsipc_bulk>:
+fsipc_bulk(void) {
+  802b5d:	55                   	push   %rbp
+  802b5e:	48 89 e5             	mov    %rsp,%rbp
+  802b61:	53                   	push   %rbx
+  802b62:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802b66:	48 b8 20 b5 98 00 00 	movabs $0x98b520,%rax
+  802b6d:	00 00 00 
+  802b70:	48 8b 18             	mov    (%rax),%rbx
+  802b73:	48 85 db             	test   %rbx,%rbx
+  802b76:	74 16                	je     802b8e <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802b78:	48 b8 20 b5 98 00 00 	movabs $0x98b520,%rax
+  802b7f:	00 00 00 
+  802b82:	48 8b 18             	mov    (%rax),%rbx
+}
+  802b85:	48 89 d8             	mov    %rbx,%rax
+  802b88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b8c:	c9                   	leave
+  802b8d:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802b8e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b93:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802b98:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802b9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba2:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  802ba9:	00 00 00 
+  802bac:	ff d0                	call   *%rax
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	78 d3                	js     802b85 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802bb2:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802bb7:	48 a3 20 b5 98 00 00 	movabs %rax,0x98b520
+  802bbe:	00 00 00 
+  802bc1:	eb b5                	jmp    802b78 <fsipc_bulk+0x1b>
+
+0000000000802bc3 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802bc3:	55                   	push   %rbp
+  802bc4:	48 89 e5             	mov    %rsp,%rbp
+  802bc7:	41 57                	push   %r15
+  802bc9:	41 56                	push   %r14
+  802bcb:	41 55                	push   %r13
+  802bcd:	41 54                	push   %r12
+  802bcf:	53                   	push   %rbx
+  802bd0:	48 83 ec 08          	sub    $0x8,%rsp
+  802bd4:	41 89 fd             	mov    %edi,%r13d
+  802bd7:	49 89 f6             	mov    %rsi,%r14
+  802bda:	49 89 d7             	mov    %rdx,%r15
+  802bdd:	48 89 cb             	mov    %rcx,%rbx
+  802be0:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802be3:	48 b8 00 b0 98 00 00 	movabs $0x98b000,%rax
+  802bea:	00 00 00 
+  802bed:	83 38 00             	cmpl   $0x0,(%rax)
+  802bf0:	74 52                	je     802c44 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802bf2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802bf8:	4c 89 f9             	mov    %r15,%rcx
+  802bfb:	4c 89 f2             	mov    %r14,%rdx
+  802bfe:	44 89 ee             	mov    %r13d,%esi
+  802c01:	48 b8 00 b0 98 00 00 	movabs $0x98b000,%rax
+  802c08:	00 00 00 
+  802c0b:	8b 38                	mov    (%rax),%edi
+  802c0d:	48 b8 bd 4d 80 00 00 	movabs $0x804dbd,%rax
+  802c14:	00 00 00 
+  802c17:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802c19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c1e:	4c 89 e2             	mov    %r12,%rdx
+  802c21:	48 89 de             	mov    %rbx,%rsi
+  802c24:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c29:	48 b8 0d 4c 80 00 00 	movabs $0x804c0d,%rax
+  802c30:	00 00 00 
+  802c33:	ff d0                	call   *%rax
+}
+  802c35:	48 83 c4 08          	add    $0x8,%rsp
+  802c39:	5b                   	pop    %rbx
+  802c3a:	41 5c                	pop    %r12
+  802c3c:	41 5d                	pop    %r13
+  802c3e:	41 5e                	pop    %r14
+  802c40:	41 5f                	pop    %r15
+  802c42:	5d                   	pop    %rbp
+  802c43:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c44:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c49:	48 b8 60 4e 80 00 00 	movabs $0x804e60,%rax
+  802c50:	00 00 00 
+  802c53:	ff d0                	call   *%rax
+  802c55:	a3 00 b0 98 00 00 00 	movabs %eax,0x98b000
+  802c5c:	00 00 
+  802c5e:	eb 92                	jmp    802bf2 <fsipc_region+0x2f>
+
+0000000000802c60 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802c60:	55                   	push   %rbp
+  802c61:	48 89 e5             	mov    %rsp,%rbp
+  802c64:	41 57                	push   %r15
+  802c66:	41 56                	push   %r14
+  802c68:	41 55                	push   %r13
+  802c6a:	41 54                	push   %r12
+  802c6c:	53                   	push   %rbx
+  802c6d:	48 83 ec 28          	sub    $0x28,%rsp
+  802c71:	49 89 ff             	mov    %rdi,%r15
+  802c74:	49 89 f6             	mov    %rsi,%r14
+  802c77:	48 89 d3             	mov    %rdx,%rbx
+  802c7a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802c7e:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802c81:	48 b8 5d 2b 80 00 00 	movabs $0x802b5d,%rax
+  802c88:	00 00 00 
+  802c8b:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802c8d:	48 85 c0             	test   %rax,%rax
+  802c90:	0f 84 cc 00 00 00    	je     802d62 <devfile_write_direct+0x102>
+  802c96:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802c99:	48 85 db             	test   %rbx,%rbx
+  802c9c:	0f 84 ba 00 00 00    	je     802d5c <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802ca2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802ca8:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802caf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802cb3:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802cb7:	4c 29 e3             	sub    %r12,%rbx
+  802cba:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802cbf:	48 39 c3             	cmp    %rax,%rbx
+  802cc2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802cc6:	48 89 da             	mov    %rbx,%rdx
+  802cc9:	4c 89 f6             	mov    %r14,%rsi
+  802ccc:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802cd0:	48 b8 ee 14 80 00 00 	movabs $0x8014ee,%rax
+  802cd7:	00 00 00 
+  802cda:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802cdc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802ce0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802ce4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802ce7:	44 01 e0             	add    %r12d,%eax
+  802cea:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802cee:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802cf2:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802cf9:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802d00:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802d07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d12:	4c 89 ee             	mov    %r13,%rsi
+  802d15:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d1a:	48 b8 c3 2b 80 00 00 	movabs $0x802bc3,%rax
+  802d21:	00 00 00 
+  802d24:	ff d0                	call   *%rax
+        if (res < 0)
+  802d26:	85 c0                	test   %eax,%eax
+  802d28:	78 29                	js     802d53 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802d2a:	74 2b                	je     802d57 <devfile_write_direct+0xf7>
+        i += res;
+  802d2c:	48 98                	cltq
+  802d2e:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802d31:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802d34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d38:	49 39 c4             	cmp    %rax,%r12
+  802d3b:	0f 82 72 ff ff ff    	jb     802cb3 <devfile_write_direct+0x53>
+    return i;
+  802d41:	4c 89 e0             	mov    %r12,%rax
+}
+  802d44:	48 83 c4 28          	add    $0x28,%rsp
+  802d48:	5b                   	pop    %rbx
+  802d49:	41 5c                	pop    %r12
+  802d4b:	41 5d                	pop    %r13
+  802d4d:	41 5e                	pop    %r14
+  802d4f:	41 5f                	pop    %r15
+  802d51:	5d                   	pop    %rbp
+  802d52:	c3                   	ret
+            return res;
+  802d53:	48 98                	cltq
+  802d55:	eb ed                	jmp    802d44 <devfile_write_direct+0xe4>
+            return i;
+  802d57:	4c 89 e0             	mov    %r12,%rax
+  802d5a:	eb e8                	jmp    802d44 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802d5c:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802d60:	eb df                	jmp    802d41 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802d62:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802d69:	eb d9                	jmp    802d44 <devfile_write_direct+0xe4>
+
+0000000000802d6b <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802d6b:	55                   	push   %rbp
+  802d6c:	48 89 e5             	mov    %rsp,%rbp
+  802d6f:	41 56                	push   %r14
+  802d71:	41 55                	push   %r13
+  802d73:	41 54                	push   %r12
+  802d75:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802d76:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802d7a:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d83:	4d 39 ee             	cmp    %r13,%r14
+  802d86:	0f 84 99 00 00 00    	je     802e25 <fbuf_flush+0xba>
+  802d8c:	49 89 fc             	mov    %rdi,%r12
+  802d8f:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802d92:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802d95:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802d99:	48 b8 6f 22 80 00 00 	movabs $0x80226f,%rax
+  802da0:	00 00 00 
+  802da3:	ff d0                	call   *%rax
+  802da5:	48 89 c2             	mov    %rax,%rdx
+  802da8:	48 c1 e2 04          	shl    $0x4,%rdx
+  802dac:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802db0:	48 c1 e0 0c          	shl    $0xc,%rax
+  802db4:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802db9:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802dbc:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802dc0:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802dc7:	00 
+  802dc8:	44 89 f1             	mov    %r14d,%ecx
+  802dcb:	4c 89 ea             	mov    %r13,%rdx
+  802dce:	4c 89 e7             	mov    %r12,%rdi
+  802dd1:	48 b8 60 2c 80 00 00 	movabs $0x802c60,%rax
+  802dd8:	00 00 00 
+  802ddb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ddd:	48 85 c0             	test   %rax,%rax
+  802de0:	78 43                	js     802e25 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802de2:	4c 39 e8             	cmp    %r13,%rax
+  802de5:	72 47                	jb     802e2e <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802de7:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802dec:	83 c0 01             	add    $0x1,%eax
+  802def:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802df4:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802df7:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802dfb:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802dff:	72 0f                	jb     802e10 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802e01:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802e05:	48 39 c2             	cmp    %rax,%rdx
+  802e08:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802e0c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802e10:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802e17:	00 
+  802e18:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802e1f:	00 
+    return 0;
+  802e20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e25:	5b                   	pop    %rbx
+  802e26:	41 5c                	pop    %r12
+  802e28:	41 5d                	pop    %r13
+  802e2a:	41 5e                	pop    %r14
+  802e2c:	5d                   	pop    %rbp
+  802e2d:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802e2e:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802e33:	eb f0                	jmp    802e25 <fbuf_flush+0xba>
+
+0000000000802e35 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802e35:	55                   	push   %rbp
+  802e36:	48 89 e5             	mov    %rsp,%rbp
+  802e39:	53                   	push   %rbx
+  802e3a:	48 83 ec 08          	sub    $0x8,%rsp
+  802e3e:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802e41:	48 b8 43 2a 80 00 00 	movabs $0x802a43,%rax
+  802e48:	00 00 00 
+  802e4b:	ff d0                	call   *%rax
+  802e4d:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802e50:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e55:	48 85 f6             	test   %rsi,%rsi
+  802e58:	74 0f                	je     802e69 <devfile_sync+0x34>
+  802e5a:	48 89 df             	mov    %rbx,%rdi
+  802e5d:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  802e64:	00 00 00 
+  802e67:	ff d0                	call   *%rax
+}
+  802e69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e6d:	c9                   	leave
+  802e6e:	c3                   	ret
+
+0000000000802e6f <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802e6f:	55                   	push   %rbp
+  802e70:	48 89 e5             	mov    %rsp,%rbp
+  802e73:	48 83 ec 10          	sub    $0x10,%rsp
+  802e77:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802e7a:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802e81:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802e82:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802e86:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e8b:	48 be 00 a0 98 00 00 	movabs $0x98a000,%rsi
+  802e92:	00 00 00 
+  802e95:	48 b8 c3 2b 80 00 00 	movabs $0x802bc3,%rax
+  802e9c:	00 00 00 
+  802e9f:	ff d0                	call   *%rax
+}
+  802ea1:	c9                   	leave
+  802ea2:	c3                   	ret
+
+0000000000802ea3 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ea3:	55                   	push   %rbp
+  802ea4:	48 89 e5             	mov    %rsp,%rbp
+  802ea7:	41 54                	push   %r12
+  802ea9:	53                   	push   %rbx
+  802eaa:	48 89 fb             	mov    %rdi,%rbx
+  802ead:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802eb0:	48 b8 35 2e 80 00 00 	movabs $0x802e35,%rax
+  802eb7:	00 00 00 
+  802eba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ebc:	85 c0                	test   %eax,%eax
+  802ebe:	78 63                	js     802f23 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ec0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ec3:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  802eca:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802ecc:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed1:	bf 05 00 00 00       	mov    $0x5,%edi
+  802ed6:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  802edd:	00 00 00 
+  802ee0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ee2:	85 c0                	test   %eax,%eax
+  802ee4:	78 3d                	js     802f23 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802ee6:	48 bb 00 a0 98 00 00 	movabs $0x98a000,%rbx
+  802eed:	00 00 00 
+  802ef0:	48 89 de             	mov    %rbx,%rsi
+  802ef3:	4c 89 e7             	mov    %r12,%rdi
+  802ef6:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  802efd:	00 00 00 
+  802f00:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802f02:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802f08:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802f0f:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802f10:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802f16:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802f1d:	00 
+
+    return 0;
+  802f1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f23:	5b                   	pop    %rbx
+  802f24:	41 5c                	pop    %r12
+  802f26:	5d                   	pop    %rbp
+  802f27:	c3                   	ret
+
+0000000000802f28 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802f28:	55                   	push   %rbp
+  802f29:	48 89 e5             	mov    %rsp,%rbp
+  802f2c:	41 54                	push   %r12
+  802f2e:	53                   	push   %rbx
+  802f2f:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802f32:	48 b8 35 2e 80 00 00 	movabs $0x802e35,%rax
+  802f39:	00 00 00 
+  802f3c:	ff d0                	call   *%rax
+  802f3e:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802f41:	48 89 df             	mov    %rbx,%rdi
+  802f44:	48 b8 6f 22 80 00 00 	movabs $0x80226f,%rax
+  802f4b:	00 00 00 
+  802f4e:	ff d0                	call   *%rax
+  802f50:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802f54:	76 2e                	jbe    802f84 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802f56:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f59:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  802f60:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802f62:	be 00 00 00 00       	mov    $0x0,%esi
+  802f67:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802f6c:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  802f73:	00 00 00 
+  802f76:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802f78:	45 85 e4             	test   %r12d,%r12d
+  802f7b:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802f7f:	5b                   	pop    %rbx
+  802f80:	41 5c                	pop    %r12
+  802f82:	5d                   	pop    %rbp
+  802f83:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802f84:	48 89 df             	mov    %rbx,%rdi
+  802f87:	48 b8 6f 22 80 00 00 	movabs $0x80226f,%rax
+  802f8e:	00 00 00 
+  802f91:	ff d0                	call   *%rax
+  802f93:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802f97:	48 b8 20 b0 98 00 00 	movabs $0x98b020,%rax
+  802f9e:	00 00 00 
+  802fa1:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802fa8:	48 89 df             	mov    %rbx,%rdi
+  802fab:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  802fb2:	00 00 00 
+  802fb5:	ff d0                	call   *%rax
+  802fb7:	48 89 c6             	mov    %rax,%rsi
+  802fba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc4:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  802fcb:	00 00 00 
+  802fce:	ff d0                	call   *%rax
+  802fd0:	eb 84                	jmp    802f56 <devfile_flush+0x2e>
+
+0000000000802fd2 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802fd2:	55                   	push   %rbp
+  802fd3:	48 89 e5             	mov    %rsp,%rbp
+  802fd6:	41 55                	push   %r13
+  802fd8:	41 54                	push   %r12
+  802fda:	53                   	push   %rbx
+  802fdb:	48 83 ec 08          	sub    $0x8,%rsp
+  802fdf:	48 89 fb             	mov    %rdi,%rbx
+  802fe2:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802fe5:	48 b8 43 2a 80 00 00 	movabs $0x802a43,%rax
+  802fec:	00 00 00 
+  802fef:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ff1:	48 85 c0             	test   %rax,%rax
+  802ff4:	74 51                	je     803047 <devfile_trunc+0x75>
+  802ff6:	49 89 c4             	mov    %rax,%r12
+  802ff9:	48 89 c6             	mov    %rax,%rsi
+  802ffc:	48 89 df             	mov    %rbx,%rdi
+  802fff:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  803006:	00 00 00 
+  803009:	ff d0                	call   *%rax
+  80300b:	85 c0                	test   %eax,%eax
+  80300d:	78 2d                	js     80303c <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80300f:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  803016:	00 00 00 
+  803019:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80301c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80301e:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803022:	be 00 00 00 00       	mov    $0x0,%esi
+  803027:	bf 02 00 00 00       	mov    $0x2,%edi
+  80302c:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  803033:	00 00 00 
+  803036:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803038:	85 c0                	test   %eax,%eax
+  80303a:	79 3e                	jns    80307a <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  80303c:	48 83 c4 08          	add    $0x8,%rsp
+  803040:	5b                   	pop    %rbx
+  803041:	41 5c                	pop    %r12
+  803043:	41 5d                	pop    %r13
+  803045:	5d                   	pop    %rbp
+  803046:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803047:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  80304e:	00 00 00 
+  803051:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803054:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803056:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  80305a:	be 00 00 00 00       	mov    $0x0,%esi
+  80305f:	bf 02 00 00 00       	mov    $0x2,%edi
+  803064:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  80306b:	00 00 00 
+  80306e:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803070:	85 c0                	test   %eax,%eax
+  803072:	78 c8                	js     80303c <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803074:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803078:	eb c2                	jmp    80303c <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  80307a:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  80307d:	8d 51 01             	lea    0x1(%rcx),%edx
+  803080:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803083:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  803088:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80308f:	00 00 
+  803091:	eb a9                	jmp    80303c <devfile_trunc+0x6a>
+
+0000000000803093 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803093:	55                   	push   %rbp
+  803094:	48 89 e5             	mov    %rsp,%rbp
+  803097:	41 57                	push   %r15
+  803099:	41 56                	push   %r14
+  80309b:	41 55                	push   %r13
+  80309d:	41 54                	push   %r12
+  80309f:	53                   	push   %rbx
+  8030a0:	48 83 ec 28          	sub    $0x28,%rsp
+  8030a4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8030a8:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8030ac:	49 89 d7             	mov    %rdx,%r15
+  8030af:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8030b3:	48 b8 43 2a 80 00 00 	movabs $0x802a43,%rax
+  8030ba:	00 00 00 
+  8030bd:	ff d0                	call   *%rax
+  8030bf:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  8030c2:	48 85 c0             	test   %rax,%rax
+  8030c5:	74 31                	je     8030f8 <devfile_write+0x65>
+  8030c7:	4c 89 f8             	mov    %r15,%rax
+  8030ca:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  8030d1:	77 25                	ja     8030f8 <devfile_write+0x65>
+    size_t i = 0;
+  8030d3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  8030d9:	48 85 c0             	test   %rax,%rax
+  8030dc:	0f 85 64 01 00 00    	jne    803246 <devfile_write+0x1b3>
+    size_t i = 0;
+  8030e2:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  8030e6:	4c 89 f8             	mov    %r15,%rax
+}
+  8030e9:	48 83 c4 28          	add    $0x28,%rsp
+  8030ed:	5b                   	pop    %rbx
+  8030ee:	41 5c                	pop    %r12
+  8030f0:	41 5d                	pop    %r13
+  8030f2:	41 5e                	pop    %r14
+  8030f4:	41 5f                	pop    %r15
+  8030f6:	5d                   	pop    %rbp
+  8030f7:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8030f8:	48 85 db             	test   %rbx,%rbx
+  8030fb:	74 5b                	je     803158 <devfile_write+0xc5>
+  8030fd:	48 89 de             	mov    %rbx,%rsi
+  803100:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803104:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+  803110:	85 c0                	test   %eax,%eax
+  803112:	78 40                	js     803154 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803114:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803118:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  80311b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80311f:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803123:	48 b8 60 2c 80 00 00 	movabs $0x802c60,%rax
+  80312a:	00 00 00 
+  80312d:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80312f:	48 85 c0             	test   %rax,%rax
+  803132:	7e b5                	jle    8030e9 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803134:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803138:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  80313b:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  80313e:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803141:	8d 51 01             	lea    0x1(%rcx),%edx
+  803144:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803147:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  80314a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803151:	00 
+  803152:	eb 95                	jmp    8030e9 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803154:	48 98                	cltq
+  803156:	eb 91                	jmp    8030e9 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803158:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80315c:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  80315f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803163:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803167:	48 89 df             	mov    %rbx,%rdi
+  80316a:	48 b8 60 2c 80 00 00 	movabs $0x802c60,%rax
+  803171:	00 00 00 
+  803174:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803176:	48 85 c0             	test   %rax,%rax
+  803179:	0f 8e 6a ff ff ff    	jle    8030e9 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80317f:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803182:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803186:	e9 5e ff ff ff       	jmp    8030e9 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80318b:	48 98                	cltq
+  80318d:	4d 85 ff             	test   %r15,%r15
+  803190:	49 0f 45 c7          	cmovne %r15,%rax
+  803194:	e9 50 ff ff ff       	jmp    8030e9 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803199:	48 89 de             	mov    %rbx,%rsi
+  80319c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031a0:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  8031a7:	00 00 00 
+  8031aa:	ff d0                	call   *%rax
+  8031ac:	85 c0                	test   %eax,%eax
+  8031ae:	0f 88 2b 01 00 00    	js     8032df <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8031b4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8031b8:	4c 01 f8             	add    %r15,%rax
+  8031bb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8031bf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031c3:	48 b9 6f 22 80 00 00 	movabs $0x80226f,%rcx
+  8031ca:	00 00 00 
+  8031cd:	ff d1                	call   *%rcx
+  8031cf:	48 89 c2             	mov    %rax,%rdx
+  8031d2:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031d6:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8031da:	48 c1 e0 0c          	shl    $0xc,%rax
+  8031de:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  8031e3:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8031e6:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8031ed:	00 
+  8031ee:	4c 89 ea             	mov    %r13,%rdx
+  8031f1:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8031f5:	48 b8 ee 14 80 00 00 	movabs $0x8014ee,%rax
+  8031fc:	00 00 00 
+  8031ff:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803201:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803205:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803209:	48 39 c2             	cmp    %rax,%rdx
+  80320c:	0f 84 db 00 00 00    	je     8032ed <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803212:	4c 39 e2             	cmp    %r12,%rdx
+  803215:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  803219:	4d 01 ec             	add    %r13,%r12
+  80321c:	49 39 c4             	cmp    %rax,%r12
+  80321f:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803223:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803227:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  80322b:	45 01 ee             	add    %r13d,%r14d
+  80322e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803232:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803236:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803239:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80323d:	49 39 c7             	cmp    %rax,%r15
+  803240:	0f 83 a0 fe ff ff    	jae    8030e6 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803246:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80324a:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  80324e:	8b 43 08             	mov    0x8(%rbx),%eax
+  803251:	44 39 f0             	cmp    %r14d,%eax
+  803254:	7f 10                	jg     803266 <devfile_write+0x1d3>
+  803256:	48 98                	cltq
+  803258:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  80325e:	49 63 d6             	movslq %r14d,%rdx
+  803261:	48 39 d0             	cmp    %rdx,%rax
+  803264:	7d 2d                	jge    803293 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803266:	48 89 de             	mov    %rbx,%rsi
+  803269:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80326d:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  803274:	00 00 00 
+  803277:	ff d0                	call   *%rax
+  803279:	85 c0                	test   %eax,%eax
+  80327b:	0f 88 0a ff ff ff    	js     80318b <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803281:	44 89 f0             	mov    %r14d,%eax
+  803284:	66 b8 00 00          	mov    $0x0,%ax
+  803288:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  80328b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803292:	00 
+        size_t off = pos - fb->fb_base;
+  803293:	45 89 f4             	mov    %r14d,%r12d
+  803296:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  80329a:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  80329d:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  8032a1:	4d 29 fd             	sub    %r15,%r13
+  8032a4:	b8 00 00 01 00       	mov    $0x10000,%eax
+  8032a9:	4c 29 e0             	sub    %r12,%rax
+  8032ac:	49 39 c5             	cmp    %rax,%r13
+  8032af:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  8032b3:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8032b7:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8032bb:	48 39 c2             	cmp    %rax,%rdx
+  8032be:	0f 84 f0 fe ff ff    	je     8031b4 <devfile_write+0x121>
+  8032c4:	4c 39 e0             	cmp    %r12,%rax
+  8032c7:	0f 82 cc fe ff ff    	jb     803199 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  8032cd:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8032d1:	48 39 d0             	cmp    %rdx,%rax
+  8032d4:	0f 83 da fe ff ff    	jae    8031b4 <devfile_write+0x121>
+  8032da:	e9 ba fe ff ff       	jmp    803199 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8032df:	48 98                	cltq
+  8032e1:	4d 85 ff             	test   %r15,%r15
+  8032e4:	49 0f 45 c7          	cmovne %r15,%rax
+  8032e8:	e9 fc fd ff ff       	jmp    8030e9 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  8032ed:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8032f1:	4c 89 e2             	mov    %r12,%rdx
+  8032f4:	e9 2a ff ff ff       	jmp    803223 <devfile_write+0x190>
+
+00000000008032f9 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8032f9:	55                   	push   %rbp
+  8032fa:	48 89 e5             	mov    %rsp,%rbp
+  8032fd:	41 57                	push   %r15
+  8032ff:	41 56                	push   %r14
+  803301:	41 55                	push   %r13
+  803303:	41 54                	push   %r12
+  803305:	53                   	push   %rbx
+  803306:	48 83 ec 28          	sub    $0x28,%rsp
+  80330a:	49 89 ff             	mov    %rdi,%r15
+  80330d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803311:	48 89 d3             	mov    %rdx,%rbx
+  803314:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803318:	48 b8 43 2a 80 00 00 	movabs $0x802a43,%rax
+  80331f:	00 00 00 
+  803322:	ff d0                	call   *%rax
+  803324:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803327:	48 85 c0             	test   %rax,%rax
+  80332a:	74 0d                	je     803339 <devfile_read+0x40>
+  80332c:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803333:	0f 86 1a 01 00 00    	jbe    803453 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803339:	4d 85 e4             	test   %r12,%r12
+  80333c:	74 1a                	je     803358 <devfile_read+0x5f>
+  80333e:	4c 89 e6             	mov    %r12,%rsi
+  803341:	4c 89 ff             	mov    %r15,%rdi
+  803344:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  80334b:	00 00 00 
+  80334e:	ff d0                	call   *%rax
+  803350:	85 c0                	test   %eax,%eax
+  803352:	0f 88 e8 00 00 00    	js     803440 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803358:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  80335c:	48 b8 5d 2b 80 00 00 	movabs $0x802b5d,%rax
+  803363:	00 00 00 
+  803366:	ff d0                	call   *%rax
+  803368:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  80336b:	48 85 c0             	test   %rax,%rax
+  80336e:	0f 84 69 02 00 00    	je     8035dd <devfile_read+0x2e4>
+    while (i < n) {
+  803374:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803379:	0f 84 ce 00 00 00    	je     80344d <devfile_read+0x154>
+    size_t i = 0;
+  80337f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803384:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80338b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80338f:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803393:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803397:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80339b:	48 29 da             	sub    %rbx,%rdx
+  80339e:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8033a3:	48 39 c2             	cmp    %rax,%rdx
+  8033a6:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  8033aa:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8033ae:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  8033b2:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8033b5:	01 d8                	add    %ebx,%eax
+  8033b7:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  8033bb:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  8033bf:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  8033c6:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8033cd:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8033d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8033da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033df:	4c 89 ee             	mov    %r13,%rsi
+  8033e2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8033e7:	48 b8 c3 2b 80 00 00 	movabs $0x802bc3,%rax
+  8033ee:	00 00 00 
+  8033f1:	ff d0                	call   *%rax
+        if (res < 0)
+  8033f3:	85 c0                	test   %eax,%eax
+  8033f5:	78 4d                	js     803444 <devfile_read+0x14b>
+        if (res == 0)
+  8033f7:	74 4f                	je     803448 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8033f9:	4c 63 e0             	movslq %eax,%r12
+  8033fc:	4c 89 e2             	mov    %r12,%rdx
+  8033ff:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803403:	4c 89 f7             	mov    %r14,%rdi
+  803406:	48 b8 ee 14 80 00 00 	movabs $0x8014ee,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+        i += res;
+  803412:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803415:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803418:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80341c:	48 39 c3             	cmp    %rax,%rbx
+  80341f:	0f 82 72 ff ff ff    	jb     803397 <devfile_read+0x9e>
+    return i;
+  803425:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803428:	48 85 c0             	test   %rax,%rax
+  80342b:	7e 04                	jle    803431 <devfile_read+0x138>
+  80342d:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803431:	48 83 c4 28          	add    $0x28,%rsp
+  803435:	5b                   	pop    %rbx
+  803436:	41 5c                	pop    %r12
+  803438:	41 5d                	pop    %r13
+  80343a:	41 5e                	pop    %r14
+  80343c:	41 5f                	pop    %r15
+  80343e:	5d                   	pop    %rbp
+  80343f:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803440:	48 98                	cltq
+  803442:	eb ed                	jmp    803431 <devfile_read+0x138>
+            return res;
+  803444:	48 98                	cltq
+  803446:	eb e9                	jmp    803431 <devfile_read+0x138>
+            return i;
+  803448:	48 89 d8             	mov    %rbx,%rax
+  80344b:	eb db                	jmp    803428 <devfile_read+0x12f>
+    size_t i = 0;
+  80344d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803451:	eb d2                	jmp    803425 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803453:	48 89 c6             	mov    %rax,%rsi
+  803456:	4c 89 ff             	mov    %r15,%rdi
+  803459:	48 b8 6b 2d 80 00 00 	movabs $0x802d6b,%rax
+  803460:	00 00 00 
+  803463:	ff d0                	call   *%rax
+  803465:	85 c0                	test   %eax,%eax
+  803467:	78 40                	js     8034a9 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803469:	4c 89 ff             	mov    %r15,%rdi
+  80346c:	48 b8 6f 22 80 00 00 	movabs $0x80226f,%rax
+  803473:	00 00 00 
+  803476:	ff d0                	call   *%rax
+  803478:	48 89 c2             	mov    %rax,%rdx
+  80347b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80347f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803483:	48 c1 e0 0c          	shl    $0xc,%rax
+  803487:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80348c:	48 01 d0             	add    %rdx,%rax
+  80348f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803493:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803498:	0f 84 33 01 00 00    	je     8035d1 <devfile_read+0x2d8>
+    size_t i = 0;
+  80349e:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8034a4:	e9 f5 00 00 00       	jmp    80359e <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8034a9:	48 98                	cltq
+  8034ab:	eb 84                	jmp    803431 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8034ad:	44 89 e8             	mov    %r13d,%eax
+  8034b0:	66 b8 00 00          	mov    $0x0,%ax
+  8034b4:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8034b9:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8034c0:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8034c2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8034c6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8034ca:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8034cc:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8034d1:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8034d4:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8034db:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8034dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8034e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034e7:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8034ec:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034f1:	48 b8 c3 2b 80 00 00 	movabs $0x802bc3,%rax
+  8034f8:	00 00 00 
+  8034fb:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8034fd:	85 c0                	test   %eax,%eax
+  8034ff:	0f 88 be 00 00 00    	js     8035c3 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803505:	48 63 d0             	movslq %eax,%rdx
+  803508:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  80350d:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803512:	44 39 e8             	cmp    %r13d,%eax
+  803515:	0f 8e ba 00 00 00    	jle    8035d5 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80351b:	49 63 c5             	movslq %r13d,%rax
+  80351e:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803523:	48 29 c3             	sub    %rax,%rbx
+  803526:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80352b:	48 01 c3             	add    %rax,%rbx
+  80352e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803532:	4c 29 f0             	sub    %r14,%rax
+  803535:	48 39 c3             	cmp    %rax,%rbx
+  803538:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80353c:	4c 89 ff             	mov    %r15,%rdi
+  80353f:	48 b9 6f 22 80 00 00 	movabs $0x80226f,%rcx
+  803546:	00 00 00 
+  803549:	ff d1                	call   *%rcx
+  80354b:	48 89 c2             	mov    %rax,%rdx
+  80354e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803552:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803556:	48 c1 e0 0c          	shl    $0xc,%rax
+  80355a:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  80355f:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803562:	44 89 ea             	mov    %r13d,%edx
+  803565:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  80356a:	48 63 d2             	movslq %edx,%rdx
+  80356d:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803574:	00 
+  803575:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803579:	4c 01 f7             	add    %r14,%rdi
+  80357c:	48 89 da             	mov    %rbx,%rdx
+  80357f:	48 b9 ee 14 80 00 00 	movabs $0x8014ee,%rcx
+  803586:	00 00 00 
+  803589:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80358b:	41 01 dd             	add    %ebx,%r13d
+  80358e:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803592:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803595:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803599:	49 39 c6             	cmp    %rax,%r14
+  80359c:	73 37                	jae    8035d5 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  80359e:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8035a2:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8035a7:	44 39 e8             	cmp    %r13d,%eax
+  8035aa:	0f 8f fd fe ff ff    	jg     8034ad <devfile_read+0x1b4>
+  8035b0:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8035b5:	44 39 e8             	cmp    %r13d,%eax
+  8035b8:	0f 8f 5d ff ff ff    	jg     80351b <devfile_read+0x222>
+  8035be:	e9 ea fe ff ff       	jmp    8034ad <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8035c3:	48 98                	cltq
+  8035c5:	4d 85 f6             	test   %r14,%r14
+  8035c8:	49 0f 45 c6          	cmovne %r14,%rax
+  8035cc:	e9 60 fe ff ff       	jmp    803431 <devfile_read+0x138>
+    size_t i = 0;
+  8035d1:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8035d5:	4c 89 f0             	mov    %r14,%rax
+  8035d8:	e9 54 fe ff ff       	jmp    803431 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8035dd:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8035e4:	e9 48 fe ff ff       	jmp    803431 <devfile_read+0x138>
+
+00000000008035e9 <open>:
+open(const char *path, int mode) {
+  8035e9:	55                   	push   %rbp
+  8035ea:	48 89 e5             	mov    %rsp,%rbp
+  8035ed:	41 55                	push   %r13
+  8035ef:	41 54                	push   %r12
+  8035f1:	53                   	push   %rbx
+  8035f2:	48 83 ec 18          	sub    $0x18,%rsp
+  8035f6:	49 89 fc             	mov    %rdi,%r12
+  8035f9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8035fc:	48 b8 bb 10 80 00 00 	movabs $0x8010bb,%rax
+  803603:	00 00 00 
+  803606:	ff d0                	call   *%rax
+  803608:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80360e:	0f 87 8a 00 00 00    	ja     80369e <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803614:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803618:	48 b8 9d 22 80 00 00 	movabs $0x80229d,%rax
+  80361f:	00 00 00 
+  803622:	ff d0                	call   *%rax
+  803624:	89 c3                	mov    %eax,%ebx
+  803626:	85 c0                	test   %eax,%eax
+  803628:	78 50                	js     80367a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80362a:	4c 89 e6             	mov    %r12,%rsi
+  80362d:	48 bb 00 a0 98 00 00 	movabs $0x98a000,%rbx
+  803634:	00 00 00 
+  803637:	48 89 df             	mov    %rbx,%rdi
+  80363a:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  803641:	00 00 00 
+  803644:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803646:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80364d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803651:	bf 01 00 00 00       	mov    $0x1,%edi
+  803656:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  80365d:	00 00 00 
+  803660:	ff d0                	call   *%rax
+  803662:	89 c3                	mov    %eax,%ebx
+  803664:	85 c0                	test   %eax,%eax
+  803666:	78 1f                	js     803687 <open+0x9e>
+    return fd2num(fd);
+  803668:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80366c:	48 b8 6f 22 80 00 00 	movabs $0x80226f,%rax
+  803673:	00 00 00 
+  803676:	ff d0                	call   *%rax
+  803678:	89 c3                	mov    %eax,%ebx
+}
+  80367a:	89 d8                	mov    %ebx,%eax
+  80367c:	48 83 c4 18          	add    $0x18,%rsp
+  803680:	5b                   	pop    %rbx
+  803681:	41 5c                	pop    %r12
+  803683:	41 5d                	pop    %r13
+  803685:	5d                   	pop    %rbp
+  803686:	c3                   	ret
+        fd_close(fd, 0);
+  803687:	be 00 00 00 00       	mov    $0x0,%esi
+  80368c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803690:	48 b8 b8 23 80 00 00 	movabs $0x8023b8,%rax
+  803697:	00 00 00 
+  80369a:	ff d0                	call   *%rax
+        return res;
+  80369c:	eb dc                	jmp    80367a <open+0x91>
+        return -E_BAD_PATH;
+  80369e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8036a3:	eb d5                	jmp    80367a <open+0x91>
+
+00000000008036a5 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8036a5:	55                   	push   %rbp
+  8036a6:	48 89 e5             	mov    %rsp,%rbp
+  8036a9:	41 57                	push   %r15
+  8036ab:	41 56                	push   %r14
+  8036ad:	41 55                	push   %r13
+  8036af:	41 54                	push   %r12
+  8036b1:	53                   	push   %rbx
+  8036b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8036b6:	41 89 f6             	mov    %esi,%r14d
+  8036b9:	49 89 d7             	mov    %rdx,%r15
+  8036bc:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8036bf:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8036c3:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8036ca:	00 00 00 
+  8036cd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036cf:	85 c0                	test   %eax,%eax
+  8036d1:	0f 88 db 00 00 00    	js     8037b2 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8036d7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8036db:	48 b8 e0 77 80 00 00 	movabs $0x8077e0,%rax
+  8036e2:	00 00 00 
+  8036e5:	8b 00                	mov    (%rax),%eax
+  8036e7:	39 07                	cmp    %eax,(%rdi)
+  8036e9:	0f 85 db 00 00 00    	jne    8037ca <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8036ef:	45 85 f6             	test   %r14d,%r14d
+  8036f2:	0f 88 db 00 00 00    	js     8037d3 <fmap+0x12e>
+  8036f8:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8036ff:	0f 85 d7 00 00 00    	jne    8037dc <fmap+0x137>
+  803705:	4c 89 fb             	mov    %r15,%rbx
+  803708:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80370e:	0f 85 d1 00 00 00    	jne    8037e5 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803714:	48 b8 35 2e 80 00 00 	movabs $0x802e35,%rax
+  80371b:	00 00 00 
+  80371e:	ff d0                	call   *%rax
+  803720:	85 c0                	test   %eax,%eax
+  803722:	0f 88 8e 00 00 00    	js     8037b6 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803728:	49 bc 00 a0 98 00 00 	movabs $0x98a000,%r12
+  80372f:	00 00 00 
+    while (i < n) {
+  803732:	4d 85 ed             	test   %r13,%r13
+  803735:	0f 84 8a 00 00 00    	je     8037c5 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80373b:	4c 89 ea             	mov    %r13,%rdx
+  80373e:	48 29 da             	sub    %rbx,%rdx
+  803741:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803748:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80374e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803752:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803756:	8b 40 0c             	mov    0xc(%rax),%eax
+  803759:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80375d:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803761:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803766:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80376b:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80376f:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803773:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803778:	4c 89 e6             	mov    %r12,%rsi
+  80377b:	bf 09 00 00 00       	mov    $0x9,%edi
+  803780:	48 b8 c3 2b 80 00 00 	movabs $0x802bc3,%rax
+  803787:	00 00 00 
+  80378a:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80378c:	85 c0                	test   %eax,%eax
+  80378e:	78 2a                	js     8037ba <fmap+0x115>
+        i += res;
+  803790:	48 98                	cltq
+  803792:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803795:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803799:	72 05                	jb     8037a0 <fmap+0xfb>
+    while (i < n) {
+  80379b:	4c 39 eb             	cmp    %r13,%rbx
+  80379e:	72 9b                	jb     80373b <fmap+0x96>
+    }
+    return i;
+  8037a0:	48 89 d8             	mov    %rbx,%rax
+}
+  8037a3:	48 83 c4 18          	add    $0x18,%rsp
+  8037a7:	5b                   	pop    %rbx
+  8037a8:	41 5c                	pop    %r12
+  8037aa:	41 5d                	pop    %r13
+  8037ac:	41 5e                	pop    %r14
+  8037ae:	41 5f                	pop    %r15
+  8037b0:	5d                   	pop    %rbp
+  8037b1:	c3                   	ret
+    if (res < 0) return res;
+  8037b2:	48 98                	cltq
+  8037b4:	eb ed                	jmp    8037a3 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8037b6:	48 98                	cltq
+  8037b8:	eb e9                	jmp    8037a3 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8037ba:	48 98                	cltq
+  8037bc:	48 85 db             	test   %rbx,%rbx
+  8037bf:	48 0f 45 c3          	cmovne %rbx,%rax
+  8037c3:	eb de                	jmp    8037a3 <fmap+0xfe>
+    size_t i = 0;
+  8037c5:	4c 89 eb             	mov    %r13,%rbx
+  8037c8:	eb d6                	jmp    8037a0 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8037ca:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8037d1:	eb d0                	jmp    8037a3 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8037d3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037da:	eb c7                	jmp    8037a3 <fmap+0xfe>
+  8037dc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037e3:	eb be                	jmp    8037a3 <fmap+0xfe>
+  8037e5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037ec:	eb b5                	jmp    8037a3 <fmap+0xfe>
+
+00000000008037ee <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8037ee:	55                   	push   %rbp
+  8037ef:	48 89 e5             	mov    %rsp,%rbp
+  8037f2:	41 56                	push   %r14
+  8037f4:	41 55                	push   %r13
+  8037f6:	41 54                	push   %r12
+  8037f8:	53                   	push   %rbx
+  8037f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8037fd:	89 fb                	mov    %edi,%ebx
+  8037ff:	41 89 f4             	mov    %esi,%r12d
+  803802:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803805:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803809:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  803810:	00 00 00 
+  803813:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803815:	85 c0                	test   %eax,%eax
+  803817:	78 63                	js     80387c <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803819:	45 85 e4             	test   %r12d,%r12d
+  80381c:	0f 88 80 00 00 00    	js     8038a2 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803822:	45 89 e6             	mov    %r12d,%r14d
+  803825:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80382c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803830:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  803837:	00 00 00 
+  80383a:	ff d0                	call   *%rax
+  80383c:	48 89 c2             	mov    %rax,%rdx
+  80383f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803844:	44 89 f6             	mov    %r14d,%esi
+  803847:	89 df                	mov    %ebx,%edi
+  803849:	48 b8 a5 36 80 00 00 	movabs $0x8036a5,%rax
+  803850:	00 00 00 
+  803853:	ff d0                	call   *%rax
+  803855:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803858:	45 29 f4             	sub    %r14d,%r12d
+  80385b:	4d 63 f4             	movslq %r12d,%r14
+  80385e:	49 39 c6             	cmp    %rax,%r14
+  803861:	7c 1d                	jl     803880 <read_map+0x92>
+  803863:	48 85 c0             	test   %rax,%rax
+  803866:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386b:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80386f:	48 83 c4 10          	add    $0x10,%rsp
+  803873:	5b                   	pop    %rbx
+  803874:	41 5c                	pop    %r12
+  803876:	41 5d                	pop    %r13
+  803878:	41 5e                	pop    %r14
+  80387a:	5d                   	pop    %rbp
+  80387b:	c3                   	ret
+    if (res < 0) return res;
+  80387c:	48 98                	cltq
+  80387e:	eb ef                	jmp    80386f <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803880:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803884:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  80388b:	00 00 00 
+  80388e:	ff d0                	call   *%rax
+  803890:	4d 63 e4             	movslq %r12d,%r12
+  803893:	4c 01 e0             	add    %r12,%rax
+  803896:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  80389a:	48 89 d8             	mov    %rbx,%rax
+  80389d:	4c 29 f0             	sub    %r14,%rax
+  8038a0:	eb cd                	jmp    80386f <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8038a2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8038a9:	eb c4                	jmp    80386f <read_map+0x81>
+
+00000000008038ab <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8038ab:	55                   	push   %rbp
+  8038ac:	48 89 e5             	mov    %rsp,%rbp
+  8038af:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8038b3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8038b7:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8038be:	00 00 00 
+  8038c1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038c3:	85 c0                	test   %eax,%eax
+  8038c5:	78 4a                	js     803911 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8038c7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8038cb:	48 b8 e0 77 80 00 00 	movabs $0x8077e0,%rax
+  8038d2:	00 00 00 
+  8038d5:	8b 00                	mov    (%rax),%eax
+  8038d7:	39 07                	cmp    %eax,(%rdi)
+  8038d9:	75 38                	jne    803913 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8038db:	48 b8 35 2e 80 00 00 	movabs $0x802e35,%rax
+  8038e2:	00 00 00 
+  8038e5:	ff d0                	call   *%rax
+  8038e7:	85 c0                	test   %eax,%eax
+  8038e9:	78 26                	js     803911 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8038eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038ef:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038f2:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  8038f9:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8038fb:	be 00 00 00 00       	mov    $0x0,%esi
+  803900:	bf 06 00 00 00       	mov    $0x6,%edi
+  803905:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  80390c:	00 00 00 
+  80390f:	ff d0                	call   *%rax
+}
+  803911:	c9                   	leave
+  803912:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803913:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803918:	eb f7                	jmp    803911 <fsync+0x66>
+
+000000000080391a <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80391a:	55                   	push   %rbp
+  80391b:	48 89 e5             	mov    %rsp,%rbp
+  80391e:	41 57                	push   %r15
+  803920:	41 56                	push   %r14
+  803922:	41 55                	push   %r13
+  803924:	41 54                	push   %r12
+  803926:	53                   	push   %rbx
+  803927:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80392b:	49 bc 20 b0 98 00 00 	movabs $0x98b020,%r12
+  803932:	00 00 00 
+  803935:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80393a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803940:	49 bd fd 22 80 00 00 	movabs $0x8022fd,%r13
+  803947:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80394a:	49 be e0 77 80 00 00 	movabs $0x8077e0,%r14
+  803951:	00 00 00 
+  803954:	eb 0c                	jmp    803962 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803956:	83 c3 01             	add    $0x1,%ebx
+  803959:	49 83 c4 28          	add    $0x28,%r12
+  80395d:	83 fb 20             	cmp    $0x20,%ebx
+  803960:	74 33                	je     803995 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803962:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803967:	74 ed                	je     803956 <flushall+0x3c>
+  803969:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80396d:	89 df                	mov    %ebx,%edi
+  80396f:	41 ff d5             	call   *%r13
+  803972:	85 c0                	test   %eax,%eax
+  803974:	78 e0                	js     803956 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803976:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80397a:	41 8b 06             	mov    (%r14),%eax
+  80397d:	39 07                	cmp    %eax,(%rdi)
+  80397f:	75 d5                	jne    803956 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803981:	48 b8 35 2e 80 00 00 	movabs $0x802e35,%rax
+  803988:	00 00 00 
+  80398b:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80398d:	85 c0                	test   %eax,%eax
+  80398f:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803993:	eb c1                	jmp    803956 <flushall+0x3c>
+    }
+    return res;
+}
+  803995:	44 89 f8             	mov    %r15d,%eax
+  803998:	48 83 c4 18          	add    $0x18,%rsp
+  80399c:	5b                   	pop    %rbx
+  80399d:	41 5c                	pop    %r12
+  80399f:	41 5d                	pop    %r13
+  8039a1:	41 5e                	pop    %r14
+  8039a3:	41 5f                	pop    %r15
+  8039a5:	5d                   	pop    %rbp
+  8039a6:	c3                   	ret
+
+00000000008039a7 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8039a7:	55                   	push   %rbp
+  8039a8:	48 89 e5             	mov    %rsp,%rbp
+  8039ab:	53                   	push   %rbx
+  8039ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8039b0:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8039b3:	40 0f b6 c6          	movzbl %sil,%eax
+  8039b7:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  8039be:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8039c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8039c5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8039ca:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  8039d1:	00 00 00 
+  8039d4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039d6:	85 c0                	test   %eax,%eax
+  8039d8:	78 23                	js     8039fd <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8039da:	ba 58 06 00 00       	mov    $0x658,%edx
+  8039df:	48 be 00 a0 98 00 00 	movabs $0x98a000,%rsi
+  8039e6:	00 00 00 
+  8039e9:	48 89 df             	mov    %rbx,%rdi
+  8039ec:	48 b8 ee 14 80 00 00 	movabs $0x8014ee,%rax
+  8039f3:	00 00 00 
+  8039f6:	ff d0                	call   *%rax
+    return 0;
+  8039f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a01:	c9                   	leave
+  803a02:	c3                   	ret
+
+0000000000803a03 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803a03:	55                   	push   %rbp
+  803a04:	48 89 e5             	mov    %rsp,%rbp
+  803a07:	53                   	push   %rbx
+  803a08:	48 83 ec 08          	sub    $0x8,%rsp
+  803a0c:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803a0f:	48 b8 bb 10 80 00 00 	movabs $0x8010bb,%rax
+  803a16:	00 00 00 
+  803a19:	ff d0                	call   *%rax
+  803a1b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803a21:	77 35                	ja     803a58 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803a23:	48 89 de             	mov    %rbx,%rsi
+  803a26:	48 bf 00 a0 98 00 00 	movabs $0x98a000,%rdi
+  803a2d:	00 00 00 
+  803a30:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  803a37:	00 00 00 
+  803a3a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803a3c:	be 00 00 00 00       	mov    $0x0,%esi
+  803a41:	bf 07 00 00 00       	mov    $0x7,%edi
+  803a46:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  803a4d:	00 00 00 
+  803a50:	ff d0                	call   *%rax
+}
+  803a52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a56:	c9                   	leave
+  803a57:	c3                   	ret
+        return -E_BAD_PATH;
+  803a58:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803a5d:	eb f3                	jmp    803a52 <remove+0x4f>
+
+0000000000803a5f <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a5f:	55                   	push   %rbp
+  803a60:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803a63:	48 b8 1a 39 80 00 00 	movabs $0x80391a,%rax
+  803a6a:	00 00 00 
+  803a6d:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803a6f:	be 00 00 00 00       	mov    $0x0,%esi
+  803a74:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a79:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  803a80:	00 00 00 
+  803a83:	ff d0                	call   *%rax
+}
+  803a85:	5d                   	pop    %rbp
+  803a86:	c3                   	ret
+
+0000000000803a87 <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803a87:	55                   	push   %rbp
+  803a88:	48 89 e5             	mov    %rsp,%rbp
+  803a8b:	41 55                	push   %r13
+  803a8d:	41 54                	push   %r12
+  803a8f:	53                   	push   %rbx
+  803a90:	48 83 ec 08          	sub    $0x8,%rsp
+  803a94:	48 89 fb             	mov    %rdi,%rbx
+  803a97:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803a9a:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  803a9d:	48 b8 91 4a 80 00 00 	movabs $0x804a91,%rax
+  803aa4:	00 00 00 
+  803aa7:	ff d0                	call   *%rax
+  803aa9:	41 89 c1             	mov    %eax,%r9d
+  803aac:	4d 89 e0             	mov    %r12,%r8
+  803aaf:	49 29 d8             	sub    %rbx,%r8
+  803ab2:	48 89 d9             	mov    %rbx,%rcx
+  803ab5:	44 89 ea             	mov    %r13d,%edx
+  803ab8:	48 89 de             	mov    %rbx,%rsi
+  803abb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ac0:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  803ac7:	00 00 00 
+  803aca:	ff d0                	call   *%rax
+}
+  803acc:	48 83 c4 08          	add    $0x8,%rsp
+  803ad0:	5b                   	pop    %rbx
+  803ad1:	41 5c                	pop    %r12
+  803ad3:	41 5d                	pop    %r13
+  803ad5:	5d                   	pop    %rbp
+  803ad6:	c3                   	ret
+
+0000000000803ad7 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803ad7:	55                   	push   %rbp
+  803ad8:	48 89 e5             	mov    %rsp,%rbp
+  803adb:	41 57                	push   %r15
+  803add:	41 56                	push   %r14
+  803adf:	41 55                	push   %r13
+  803ae1:	41 54                	push   %r12
+  803ae3:	53                   	push   %rbx
+  803ae4:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  803aeb:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  803aee:	be 00 00 00 00       	mov    $0x0,%esi
+  803af3:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803afa:	00 00 00 
+  803afd:	ff d0                	call   *%rax
+  803aff:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+    if (fd < 0) return fd;
+  803b05:	85 c0                	test   %eax,%eax
+  803b07:	0f 88 8f 06 00 00    	js     80419c <spawn+0x6c5>
+  803b0d:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803b0f:	ba 00 02 00 00       	mov    $0x200,%edx
+  803b14:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803b1b:	48 b8 9e 26 80 00 00 	movabs $0x80269e,%rax
+  803b22:	00 00 00 
+  803b25:	ff d0                	call   *%rax
+  803b27:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803b29:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803b2e:	0f 85 88 02 00 00    	jne    803dbc <spawn+0x2e5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803b34:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803b3b:	ff ff 00 
+  803b3e:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803b45:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803b4c:	01 01 00 
+  803b4f:	48 39 d0             	cmp    %rdx,%rax
+  803b52:	0f 85 a0 02 00 00    	jne    803df8 <spawn+0x321>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803b58:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803b5f:	00 3e 00 
+  803b62:	0f 85 90 02 00 00    	jne    803df8 <spawn+0x321>
+    flushall();
+  803b68:	48 b8 1a 39 80 00 00 	movabs $0x80391a,%rax
+  803b6f:	00 00 00 
+  803b72:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803b74:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803b79:	cd 30                	int    $0x30
+  803b7b:	41 89 c7             	mov    %eax,%r15d
+  803b7e:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803b84:	85 c0                	test   %eax,%eax
+  803b86:	0f 88 f2 05 00 00    	js     80417e <spawn+0x6a7>
+    envid_t child = res;
+  803b8c:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803b92:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b97:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  803b9e:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  803ba5:	00 00 00 
+  803ba8:	48 01 c6             	add    %rax,%rsi
+  803bab:	48 8b 06             	mov    (%rsi),%rax
+  803bae:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803bb5:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803bbc:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803bc3:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803bca:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803bd1:	48 29 ce             	sub    %rcx,%rsi
+  803bd4:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803bda:	c1 e9 03             	shr    $0x3,%ecx
+  803bdd:	89 c9                	mov    %ecx,%ecx
+  803bdf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803be2:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803be9:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803bf0:	48 8b 3b             	mov    (%rbx),%rdi
+  803bf3:	48 85 ff             	test   %rdi,%rdi
+  803bf6:	0f 84 b8 05 00 00    	je     8041b4 <spawn+0x6dd>
+  803bfc:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  803c02:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  803c08:	49 be bb 10 80 00 00 	movabs $0x8010bb,%r14
+  803c0f:	00 00 00 
+  803c12:	41 ff d6             	call   *%r14
+  803c15:	4c 01 e8             	add    %r13,%rax
+  803c18:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  803c1c:	4c 89 a5 f8 fc ff ff 	mov    %r12,-0x308(%rbp)
+  803c23:	49 83 c4 01          	add    $0x1,%r12
+  803c27:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  803c2c:	48 85 ff             	test   %rdi,%rdi
+  803c2f:	75 e1                	jne    803c12 <spawn+0x13b>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803c31:	48 f7 d0             	not    %rax
+  803c34:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803c3b:	4d 89 e6             	mov    %r12,%r14
+  803c3e:	49 83 e6 f8          	and    $0xfffffffffffffff8,%r14
+  803c42:	4c 89 b5 f0 fc ff ff 	mov    %r14,-0x310(%rbp)
+  803c49:	4c 8b ad f8 fc ff ff 	mov    -0x308(%rbp),%r13
+  803c50:	44 89 e8             	mov    %r13d,%eax
+  803c53:	83 c0 01             	add    $0x1,%eax
+  803c56:	48 98                	cltq
+  803c58:	48 c1 e0 03          	shl    $0x3,%rax
+  803c5c:	49 29 c6             	sub    %rax,%r14
+  803c5f:	4c 89 b5 e0 fc ff ff 	mov    %r14,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803c66:	49 8d 46 f0          	lea    -0x10(%r14),%rax
+  803c6a:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803c70:	0f 86 eb 04 00 00    	jbe    804161 <spawn+0x68a>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803c76:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803c7b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803c80:	be 00 00 40 00       	mov    $0x400000,%esi
+  803c85:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  803c8c:	00 00 00 
+  803c8f:	ff d0                	call   *%rax
+  803c91:	85 c0                	test   %eax,%eax
+  803c93:	0f 88 cd 04 00 00    	js     804166 <spawn+0x68f>
+    for (i = 0; i < argc; i++) {
+  803c99:	4c 89 e8             	mov    %r13,%rax
+  803c9c:	45 85 ed             	test   %r13d,%r13d
+  803c9f:	7e 52                	jle    803cf3 <spawn+0x21c>
+  803ca1:	4d 89 f5             	mov    %r14,%r13
+  803ca4:	48 98                	cltq
+  803ca6:	4d 8d 34 c6          	lea    (%r14,%rax,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803caa:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  803cb1:	00 00 00 
+  803cb4:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  803cbb:	ff 
+  803cbc:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803cc0:	48 8b 33             	mov    (%rbx),%rsi
+  803cc3:	4c 89 e7             	mov    %r12,%rdi
+  803cc6:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  803ccd:	00 00 00 
+  803cd0:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803cd2:	48 8b 3b             	mov    (%rbx),%rdi
+  803cd5:	48 b8 bb 10 80 00 00 	movabs $0x8010bb,%rax
+  803cdc:	00 00 00 
+  803cdf:	ff d0                	call   *%rax
+  803ce1:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  803ce6:	49 83 c5 08          	add    $0x8,%r13
+  803cea:	48 83 c3 08          	add    $0x8,%rbx
+  803cee:	4d 39 f5             	cmp    %r14,%r13
+  803cf1:	75 b7                	jne    803caa <spawn+0x1d3>
+    argv_store[argc] = 0;
+  803cf3:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  803cfa:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803d01:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803d02:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  803d09:	0f 85 30 01 00 00    	jne    803e3f <spawn+0x368>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803d0f:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803d16:	00 00 00 
+  803d19:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  803d20:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803d27:	ff 
+  803d28:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803d2c:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803d33:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803d37:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803d3e:	00 00 00 
+  803d41:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803d48:	ff 
+  803d49:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803d50:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803d56:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803d5c:	44 89 fa             	mov    %r15d,%edx
+  803d5f:	be 00 00 40 00       	mov    $0x400000,%esi
+  803d64:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d69:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  803d70:	00 00 00 
+  803d73:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  803d75:	48 bb 38 1a 80 00 00 	movabs $0x801a38,%rbx
+  803d7c:	00 00 00 
+  803d7f:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803d84:	be 00 00 40 00       	mov    $0x400000,%esi
+  803d89:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d8e:	ff d3                	call   *%rbx
+  803d90:	85 c0                	test   %eax,%eax
+  803d92:	78 eb                	js     803d7f <spawn+0x2a8>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803d94:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803d9b:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  803da2:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803da3:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803daa:	00 
+  803dab:	0f 84 a1 02 00 00    	je     804052 <spawn+0x57b>
+  803db1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803db7:	e9 dd 00 00 00       	jmp    803e99 <spawn+0x3c2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803dbc:	48 bf 00 58 80 00 00 	movabs $0x805800,%rdi
+  803dc3:	00 00 00 
+  803dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dcb:	48 ba 81 07 80 00 00 	movabs $0x800781,%rdx
+  803dd2:	00 00 00 
+  803dd5:	ff d2                	call   *%rdx
+        close(fd);
+  803dd7:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803ddd:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  803de4:	00 00 00 
+  803de7:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803de9:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  803df0:	ff ff ff 
+  803df3:	e9 a4 03 00 00       	jmp    80419c <spawn+0x6c5>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803df8:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803dfd:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803e03:	48 bf 60 58 80 00 00 	movabs $0x805860,%rdi
+  803e0a:	00 00 00 
+  803e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e12:	48 b9 81 07 80 00 00 	movabs $0x800781,%rcx
+  803e19:	00 00 00 
+  803e1c:	ff d1                	call   *%rcx
+        close(fd);
+  803e1e:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803e24:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  803e2b:	00 00 00 
+  803e2e:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803e30:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  803e37:	ff ff ff 
+  803e3a:	e9 5d 03 00 00       	jmp    80419c <spawn+0x6c5>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803e3f:	48 b9 30 58 80 00 00 	movabs $0x805830,%rcx
+  803e46:	00 00 00 
+  803e49:	48 ba 7a 58 80 00 00 	movabs $0x80587a,%rdx
+  803e50:	00 00 00 
+  803e53:	be f3 00 00 00       	mov    $0xf3,%esi
+  803e58:	48 bf 8f 58 80 00 00 	movabs $0x80588f,%rdi
+  803e5f:	00 00 00 
+  803e62:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e67:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  803e6e:	00 00 00 
+  803e71:	41 ff d0             	call   *%r8
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803e74:	83 bd f8 fc ff ff 00 	cmpl   $0x0,-0x308(%rbp)
+  803e7b:	0f 88 eb 02 00 00    	js     80416c <spawn+0x695>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803e81:	49 83 c7 01          	add    $0x1,%r15
+  803e85:	48 83 c3 38          	add    $0x38,%rbx
+  803e89:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803e90:	49 39 c7             	cmp    %rax,%r15
+  803e93:	0f 83 b9 01 00 00    	jae    804052 <spawn+0x57b>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803e99:	83 3b 01             	cmpl   $0x1,(%rbx)
+  803e9c:	75 e3                	jne    803e81 <spawn+0x3aa>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803e9e:	8b 43 04             	mov    0x4(%rbx),%eax
+  803ea1:	41 89 c4             	mov    %eax,%r12d
+  803ea4:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803ea8:	44 89 e2             	mov    %r12d,%edx
+  803eab:	83 ca 04             	or     $0x4,%edx
+  803eae:	a8 04                	test   $0x4,%al
+  803eb0:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803eb4:	44 89 e2             	mov    %r12d,%edx
+  803eb7:	83 ca 01             	or     $0x1,%edx
+  803eba:	a8 01                	test   $0x1,%al
+  803ebc:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803ec0:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  803ec4:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+  803eca:	4c 8b 6b 20          	mov    0x20(%rbx),%r13
+  803ece:	4c 8b 73 28          	mov    0x28(%rbx),%r14
+  803ed2:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  803ed6:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  803edd:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803ee3:	89 8d e0 fc ff ff    	mov    %ecx,-0x320(%rbp)
+
+    // cprintf("map_segment %x+%x\n", va, memsz);
+
+    /* Fixup unaligned destination */
+    int res = PAGE_OFFSET(va);
+    if (res) {
+  803ee9:	89 f2                	mov    %esi,%edx
+  803eeb:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803ef1:	74 1b                	je     803f0e <spawn+0x437>
+        va -= res;
+  803ef3:	48 63 ca             	movslq %edx,%rcx
+  803ef6:	48 29 ce             	sub    %rcx,%rsi
+  803ef9:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  803f00:	49 01 ce             	add    %rcx,%r14
+        filesz += res;
+  803f03:	49 01 cd             	add    %rcx,%r13
+        fileoffset -= res;
+  803f06:	29 d0                	sub    %edx,%eax
+  803f08:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+    }
+
+    /* NOTE: There's restriction on maximal filesz
+     * for each program segment (HUGE_PAGE_SIZE) */
+    if (filesz > HUGE_PAGE_SIZE || filesz > memsz)
+  803f0e:	b8 00 00 20 00       	mov    $0x200000,%eax
+  803f13:	49 39 c6             	cmp    %rax,%r14
+  803f16:	49 0f 46 c6          	cmovbe %r14,%rax
+  803f1a:	4c 39 e8             	cmp    %r13,%rax
+  803f1d:	0f 82 32 02 00 00    	jb     804155 <spawn+0x67e>
+    /* Allocate filesz in parent to UTEMP */
+    /* seek() fd to fileoffset  */
+    /* read filesz to UTEMP */
+    /* Map read section conents to child */
+    /* Unmap it from parent */
+    res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, 4096), memsz, perm);
+  803f23:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  803f2a:	49 8d b4 05 ff 0f 00 	lea    0xfff(%r13,%rax,1),%rsi
+  803f31:	00 
+  803f32:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803f39:	44 89 e1             	mov    %r12d,%ecx
+  803f3c:	4c 89 f2             	mov    %r14,%rdx
+  803f3f:	8b bd e0 fc ff ff    	mov    -0x320(%rbp),%edi
+  803f45:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  803f4c:	00 00 00 
+  803f4f:	ff d0                	call   *%rax
+  803f51:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (memsz > filesz && res)
+  803f57:	4d 39 f5             	cmp    %r14,%r13
+  803f5a:	73 08                	jae    803f64 <spawn+0x48d>
+  803f5c:	85 c0                	test   %eax,%eax
+  803f5e:	0f 85 10 ff ff ff    	jne    803e74 <spawn+0x39d>
+        return res;
+
+    if (filesz == 0)
+  803f64:	4d 85 ed             	test   %r13,%r13
+  803f67:	0f 84 14 ff ff ff    	je     803e81 <spawn+0x3aa>
+        return 0;
+
+    res = sys_alloc_region(0, UTEMP, ROUNDUP(filesz, 4096), PTE_P | PTE_U | PTE_W);
+  803f6d:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803f74:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803f7a:	49 89 c6             	mov    %rax,%r14
+  803f7d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803f82:	48 89 c2             	mov    %rax,%rdx
+  803f85:	be 00 00 40 00       	mov    $0x400000,%esi
+  803f8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f8f:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  803f96:	00 00 00 
+  803f99:	ff d0                	call   *%rax
+  803f9b:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803fa1:	85 c0                	test   %eax,%eax
+  803fa3:	0f 85 cb fe ff ff    	jne    803e74 <spawn+0x39d>
+        return res;
+    res = seek(fd, fileoffset);
+  803fa9:	8b b5 e8 fc ff ff    	mov    -0x318(%rbp),%esi
+  803faf:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803fb5:	48 b8 c8 27 80 00 00 	movabs $0x8027c8,%rax
+  803fbc:	00 00 00 
+  803fbf:	ff d0                	call   *%rax
+  803fc1:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803fc7:	85 c0                	test   %eax,%eax
+  803fc9:	0f 85 a5 fe ff ff    	jne    803e74 <spawn+0x39d>
+        return res;
+    res = readn(fd, UTEMP, filesz);
+  803fcf:	4c 89 ea             	mov    %r13,%rdx
+  803fd2:	be 00 00 40 00       	mov    $0x400000,%esi
+  803fd7:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803fdd:	48 b8 9e 26 80 00 00 	movabs $0x80269e,%rax
+  803fe4:	00 00 00 
+  803fe7:	ff d0                	call   *%rax
+  803fe9:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res < 0)
+  803fef:	85 c0                	test   %eax,%eax
+  803ff1:	0f 88 75 01 00 00    	js     80416c <spawn+0x695>
+        return res;
+    res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, 4096), perm);
+  803ff7:	45 89 e1             	mov    %r12d,%r9d
+  803ffa:	4d 89 f0             	mov    %r14,%r8
+  803ffd:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  804004:	8b 95 e0 fc ff ff    	mov    -0x320(%rbp),%edx
+  80400a:	be 00 00 40 00       	mov    $0x400000,%esi
+  80400f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804014:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  80401b:	00 00 00 
+  80401e:	ff d0                	call   *%rax
+  804020:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  804026:	85 c0                	test   %eax,%eax
+  804028:	0f 85 46 fe ff ff    	jne    803e74 <spawn+0x39d>
+        return res;
+    res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, 4096));
+  80402e:	4c 89 f2             	mov    %r14,%rdx
+  804031:	be 00 00 40 00       	mov    $0x400000,%esi
+  804036:	bf 00 00 00 00       	mov    $0x0,%edi
+  80403b:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  804042:	00 00 00 
+  804045:	ff d0                	call   *%rax
+  804047:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  80404d:	e9 22 fe ff ff       	jmp    803e74 <spawn+0x39d>
+    close(fd);
+  804052:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  804058:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  80405f:	00 00 00 
+  804062:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  804064:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  80406b:	48 bf 87 3a 80 00 00 	movabs $0x803a87,%rdi
+  804072:	00 00 00 
+  804075:	48 b8 05 4b 80 00 00 	movabs $0x804b05,%rax
+  80407c:	00 00 00 
+  80407f:	ff d0                	call   *%rax
+  804081:	85 c0                	test   %eax,%eax
+  804083:	78 49                	js     8040ce <spawn+0x5f7>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  804085:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80408c:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804092:	48 b8 08 1b 80 00 00 	movabs $0x801b08,%rax
+  804099:	00 00 00 
+  80409c:	ff d0                	call   *%rax
+  80409e:	85 c0                	test   %eax,%eax
+  8040a0:	78 59                	js     8040fb <spawn+0x624>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8040a2:	be 02 00 00 00       	mov    $0x2,%esi
+  8040a7:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8040ad:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  8040b4:	00 00 00 
+  8040b7:	ff d0                	call   *%rax
+  8040b9:	85 c0                	test   %eax,%eax
+  8040bb:	78 6b                	js     804128 <spawn+0x651>
+    return child;
+  8040bd:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  8040c3:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+  8040c9:	e9 ce 00 00 00       	jmp    80419c <spawn+0x6c5>
+        panic("copy_shared_region: %i", res);
+  8040ce:	89 c1                	mov    %eax,%ecx
+  8040d0:	48 ba 9b 58 80 00 00 	movabs $0x80589b,%rdx
+  8040d7:	00 00 00 
+  8040da:	be 87 00 00 00       	mov    $0x87,%esi
+  8040df:	48 bf 8f 58 80 00 00 	movabs $0x80588f,%rdi
+  8040e6:	00 00 00 
+  8040e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ee:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  8040f5:	00 00 00 
+  8040f8:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  8040fb:	89 c1                	mov    %eax,%ecx
+  8040fd:	48 ba b2 58 80 00 00 	movabs $0x8058b2,%rdx
+  804104:	00 00 00 
+  804107:	be 8a 00 00 00       	mov    $0x8a,%esi
+  80410c:	48 bf 8f 58 80 00 00 	movabs $0x80588f,%rdi
+  804113:	00 00 00 
+  804116:	b8 00 00 00 00       	mov    $0x0,%eax
+  80411b:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  804122:	00 00 00 
+  804125:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  804128:	89 c1                	mov    %eax,%ecx
+  80412a:	48 ba cc 58 80 00 00 	movabs $0x8058cc,%rdx
+  804131:	00 00 00 
+  804134:	be 8d 00 00 00       	mov    $0x8d,%esi
+  804139:	48 bf 8f 58 80 00 00 	movabs $0x80588f,%rdi
+  804140:	00 00 00 
+  804143:	b8 00 00 00 00       	mov    $0x0,%eax
+  804148:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  80414f:	00 00 00 
+  804152:	41 ff d0             	call   *%r8
+        return -E_INVALID_EXE;
+  804155:	c7 85 f8 fc ff ff f8 	movl   $0xfffffff8,-0x308(%rbp)
+  80415c:	ff ff ff 
+  80415f:	eb 0b                	jmp    80416c <spawn+0x695>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  804161:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804166:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    sys_env_destroy(child);
+  80416c:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804172:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  804179:	00 00 00 
+  80417c:	ff d0                	call   *%rax
+    close(fd);
+  80417e:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  804184:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  80418b:	00 00 00 
+  80418e:	ff d0                	call   *%rax
+    return res;
+  804190:	8b 85 f8 fc ff ff    	mov    -0x308(%rbp),%eax
+  804196:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+}
+  80419c:	8b 85 ec fc ff ff    	mov    -0x314(%rbp),%eax
+  8041a2:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  8041a9:	5b                   	pop    %rbx
+  8041aa:	41 5c                	pop    %r12
+  8041ac:	41 5d                	pop    %r13
+  8041ae:	41 5e                	pop    %r14
+  8041b0:	41 5f                	pop    %r15
+  8041b2:	5d                   	pop    %rbp
+  8041b3:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8041b4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8041b9:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8041be:	be 00 00 40 00       	mov    $0x400000,%esi
+  8041c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041c8:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  8041cf:	00 00 00 
+  8041d2:	ff d0                	call   *%rax
+  8041d4:	85 c0                	test   %eax,%eax
+  8041d6:	78 8e                	js     804166 <spawn+0x68f>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8041d8:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  8041df:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8041e3:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  8041ea:	f8 ff 40 00 
+  8041ee:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  8041f5:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8041f9:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  8041ff:	e9 ef fa ff ff       	jmp    803cf3 <spawn+0x21c>
+
+0000000000804204 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804204:	55                   	push   %rbp
+  804205:	48 89 e5             	mov    %rsp,%rbp
+  804208:	48 83 ec 50          	sub    $0x50,%rsp
+  80420c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804210:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804214:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804218:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  80421c:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804223:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804227:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80422b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80422f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804233:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804238:	eb 15                	jmp    80424f <spawnl+0x4b>
+  80423a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80423e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804242:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804246:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80424a:	74 1c                	je     804268 <spawnl+0x64>
+  80424c:	83 c1 01             	add    $0x1,%ecx
+  80424f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804252:	83 f8 2f             	cmp    $0x2f,%eax
+  804255:	77 e3                	ja     80423a <spawnl+0x36>
+  804257:	89 c2                	mov    %eax,%edx
+  804259:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  80425d:	4c 01 d2             	add    %r10,%rdx
+  804260:	83 c0 08             	add    $0x8,%eax
+  804263:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804266:	eb de                	jmp    804246 <spawnl+0x42>
+    const char *argv[argc + 2];
+  804268:	8d 41 02             	lea    0x2(%rcx),%eax
+  80426b:	48 98                	cltq
+  80426d:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  804274:	00 
+  804275:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  804279:	48 29 c4             	sub    %rax,%rsp
+  80427c:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  804281:	4c 89 c0             	mov    %r8,%rax
+  804284:	48 c1 e8 03          	shr    $0x3,%rax
+  804288:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  80428c:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  804293:	00 
+    argv[argc + 1] = NULL;
+  804294:	8d 41 01             	lea    0x1(%rcx),%eax
+  804297:	48 98                	cltq
+  804299:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8042a0:	00 
+    va_start(vl, arg0);
+  8042a1:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8042a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042b0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8042b4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8042b8:	85 c9                	test   %ecx,%ecx
+  8042ba:	74 41                	je     8042fd <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8042bc:	49 89 c1             	mov    %rax,%r9
+  8042bf:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8042c3:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8042c6:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8042cb:	eb 1b                	jmp    8042e8 <spawnl+0xe4>
+  8042cd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8042d1:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8042d5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8042d9:	48 8b 11             	mov    (%rcx),%rdx
+  8042dc:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8042df:	48 83 c0 08          	add    $0x8,%rax
+  8042e3:	48 39 f0             	cmp    %rsi,%rax
+  8042e6:	74 15                	je     8042fd <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8042e8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8042eb:	83 fa 2f             	cmp    $0x2f,%edx
+  8042ee:	77 dd                	ja     8042cd <spawnl+0xc9>
+  8042f0:	89 d1                	mov    %edx,%ecx
+  8042f2:	4c 01 c9             	add    %r9,%rcx
+  8042f5:	83 c2 08             	add    $0x8,%edx
+  8042f8:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8042fb:	eb dc                	jmp    8042d9 <spawnl+0xd5>
+    return spawn(prog, argv);
+  8042fd:	4c 89 c6             	mov    %r8,%rsi
+  804300:	48 b8 d7 3a 80 00 00 	movabs $0x803ad7,%rax
+  804307:	00 00 00 
+  80430a:	ff d0                	call   *%rax
+}
+  80430c:	c9                   	leave
+  80430d:	c3                   	ret
+
+000000000080430e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80430e:	55                   	push   %rbp
+  80430f:	48 89 e5             	mov    %rsp,%rbp
+  804312:	41 54                	push   %r12
+  804314:	53                   	push   %rbx
+  804315:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804318:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  80431f:	00 00 00 
+  804322:	ff d0                	call   *%rax
+  804324:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804327:	48 be e3 58 80 00 00 	movabs $0x8058e3,%rsi
+  80432e:	00 00 00 
+  804331:	48 89 df             	mov    %rbx,%rdi
+  804334:	48 b8 f9 10 80 00 00 	movabs $0x8010f9,%rax
+  80433b:	00 00 00 
+  80433e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804340:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804345:	41 2b 04 24          	sub    (%r12),%eax
+  804349:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80434f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804356:	00 00 00 
+    stat->st_dev = &devpipe;
+  804359:	48 b8 20 78 80 00 00 	movabs $0x807820,%rax
+  804360:	00 00 00 
+  804363:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80436a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80436f:	5b                   	pop    %rbx
+  804370:	41 5c                	pop    %r12
+  804372:	5d                   	pop    %rbp
+  804373:	c3                   	ret
+
+0000000000804374 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804374:	55                   	push   %rbp
+  804375:	48 89 e5             	mov    %rsp,%rbp
+  804378:	41 54                	push   %r12
+  80437a:	53                   	push   %rbx
+  80437b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80437e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804383:	48 89 fe             	mov    %rdi,%rsi
+  804386:	bf 00 00 00 00       	mov    $0x0,%edi
+  80438b:	49 bc 38 1a 80 00 00 	movabs $0x801a38,%r12
+  804392:	00 00 00 
+  804395:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804398:	48 89 df             	mov    %rbx,%rdi
+  80439b:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  8043a2:	00 00 00 
+  8043a5:	ff d0                	call   *%rax
+  8043a7:	48 89 c6             	mov    %rax,%rsi
+  8043aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043b4:	41 ff d4             	call   *%r12
+}
+  8043b7:	5b                   	pop    %rbx
+  8043b8:	41 5c                	pop    %r12
+  8043ba:	5d                   	pop    %rbp
+  8043bb:	c3                   	ret
+
+00000000008043bc <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043bc:	55                   	push   %rbp
+  8043bd:	48 89 e5             	mov    %rsp,%rbp
+  8043c0:	41 57                	push   %r15
+  8043c2:	41 56                	push   %r14
+  8043c4:	41 55                	push   %r13
+  8043c6:	41 54                	push   %r12
+  8043c8:	53                   	push   %rbx
+  8043c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8043cd:	49 89 fc             	mov    %rdi,%r12
+  8043d0:	49 89 f5             	mov    %rsi,%r13
+  8043d3:	49 89 d7             	mov    %rdx,%r15
+  8043d6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8043da:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  8043e1:	00 00 00 
+  8043e4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8043e6:	4d 85 ff             	test   %r15,%r15
+  8043e9:	0f 84 af 00 00 00    	je     80449e <devpipe_write+0xe2>
+  8043ef:	48 89 c3             	mov    %rax,%rbx
+  8043f2:	4c 89 f8             	mov    %r15,%rax
+  8043f5:	4d 89 ef             	mov    %r13,%r15
+  8043f8:	4c 01 e8             	add    %r13,%rax
+  8043fb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043ff:	49 bd 2d 18 80 00 00 	movabs $0x80182d,%r13
+  804406:	00 00 00 
+            sys_yield();
+  804409:	49 be ca 17 80 00 00 	movabs $0x8017ca,%r14
+  804410:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804413:	8b 73 04             	mov    0x4(%rbx),%esi
+  804416:	48 63 ce             	movslq %esi,%rcx
+  804419:	48 63 03             	movslq (%rbx),%rax
+  80441c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804422:	48 39 c1             	cmp    %rax,%rcx
+  804425:	72 2e                	jb     804455 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804427:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80442c:	48 89 da             	mov    %rbx,%rdx
+  80442f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804434:	4c 89 e7             	mov    %r12,%rdi
+  804437:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80443a:	85 c0                	test   %eax,%eax
+  80443c:	74 66                	je     8044a4 <devpipe_write+0xe8>
+            sys_yield();
+  80443e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804441:	8b 73 04             	mov    0x4(%rbx),%esi
+  804444:	48 63 ce             	movslq %esi,%rcx
+  804447:	48 63 03             	movslq (%rbx),%rax
+  80444a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804450:	48 39 c1             	cmp    %rax,%rcx
+  804453:	73 d2                	jae    804427 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804455:	41 0f b6 3f          	movzbl (%r15),%edi
+  804459:	48 89 ca             	mov    %rcx,%rdx
+  80445c:	48 c1 ea 03          	shr    $0x3,%rdx
+  804460:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804467:	08 10 20 
+  80446a:	48 f7 e2             	mul    %rdx
+  80446d:	48 c1 ea 06          	shr    $0x6,%rdx
+  804471:	48 89 d0             	mov    %rdx,%rax
+  804474:	48 c1 e0 09          	shl    $0x9,%rax
+  804478:	48 29 d0             	sub    %rdx,%rax
+  80447b:	48 c1 e0 03          	shl    $0x3,%rax
+  80447f:	48 29 c1             	sub    %rax,%rcx
+  804482:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804487:	83 c6 01             	add    $0x1,%esi
+  80448a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80448d:	49 83 c7 01          	add    $0x1,%r15
+  804491:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804495:	49 39 c7             	cmp    %rax,%r15
+  804498:	0f 85 75 ff ff ff    	jne    804413 <devpipe_write+0x57>
+    return n;
+  80449e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044a2:	eb 05                	jmp    8044a9 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8044a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044a9:	48 83 c4 18          	add    $0x18,%rsp
+  8044ad:	5b                   	pop    %rbx
+  8044ae:	41 5c                	pop    %r12
+  8044b0:	41 5d                	pop    %r13
+  8044b2:	41 5e                	pop    %r14
+  8044b4:	41 5f                	pop    %r15
+  8044b6:	5d                   	pop    %rbp
+  8044b7:	c3                   	ret
+
+00000000008044b8 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044b8:	55                   	push   %rbp
+  8044b9:	48 89 e5             	mov    %rsp,%rbp
+  8044bc:	41 57                	push   %r15
+  8044be:	41 56                	push   %r14
+  8044c0:	41 55                	push   %r13
+  8044c2:	41 54                	push   %r12
+  8044c4:	53                   	push   %rbx
+  8044c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8044c9:	49 89 fc             	mov    %rdi,%r12
+  8044cc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044d0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044d4:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  8044db:	00 00 00 
+  8044de:	ff d0                	call   *%rax
+  8044e0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8044e3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8044e9:	49 bd 2d 18 80 00 00 	movabs $0x80182d,%r13
+  8044f0:	00 00 00 
+            sys_yield();
+  8044f3:	49 be ca 17 80 00 00 	movabs $0x8017ca,%r14
+  8044fa:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8044fd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804502:	74 7d                	je     804581 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804504:	8b 03                	mov    (%rbx),%eax
+  804506:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804509:	75 26                	jne    804531 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80450b:	4d 85 ff             	test   %r15,%r15
+  80450e:	75 77                	jne    804587 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804510:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804515:	48 89 da             	mov    %rbx,%rdx
+  804518:	be 00 10 00 00       	mov    $0x1000,%esi
+  80451d:	4c 89 e7             	mov    %r12,%rdi
+  804520:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804523:	85 c0                	test   %eax,%eax
+  804525:	74 72                	je     804599 <devpipe_read+0xe1>
+            sys_yield();
+  804527:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80452a:	8b 03                	mov    (%rbx),%eax
+  80452c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80452f:	74 df                	je     804510 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804531:	48 63 c8             	movslq %eax,%rcx
+  804534:	48 89 ca             	mov    %rcx,%rdx
+  804537:	48 c1 ea 03          	shr    $0x3,%rdx
+  80453b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804542:	08 10 20 
+  804545:	48 89 d0             	mov    %rdx,%rax
+  804548:	48 f7 e6             	mul    %rsi
+  80454b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80454f:	48 89 d0             	mov    %rdx,%rax
+  804552:	48 c1 e0 09          	shl    $0x9,%rax
+  804556:	48 29 d0             	sub    %rdx,%rax
+  804559:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804560:	00 
+  804561:	48 89 c8             	mov    %rcx,%rax
+  804564:	48 29 d0             	sub    %rdx,%rax
+  804567:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80456c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804570:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804574:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804577:	49 83 c7 01          	add    $0x1,%r15
+  80457b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80457f:	75 83                	jne    804504 <devpipe_read+0x4c>
+    return n;
+  804581:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804585:	eb 03                	jmp    80458a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804587:	4c 89 f8             	mov    %r15,%rax
+}
+  80458a:	48 83 c4 18          	add    $0x18,%rsp
+  80458e:	5b                   	pop    %rbx
+  80458f:	41 5c                	pop    %r12
+  804591:	41 5d                	pop    %r13
+  804593:	41 5e                	pop    %r14
+  804595:	41 5f                	pop    %r15
+  804597:	5d                   	pop    %rbp
+  804598:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80459e:	eb ea                	jmp    80458a <devpipe_read+0xd2>
+
+00000000008045a0 <pipe>:
+pipe(int pfd[2]) {
+  8045a0:	55                   	push   %rbp
+  8045a1:	48 89 e5             	mov    %rsp,%rbp
+  8045a4:	41 55                	push   %r13
+  8045a6:	41 54                	push   %r12
+  8045a8:	53                   	push   %rbx
+  8045a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8045ad:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8045b0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8045b4:	48 b8 9d 22 80 00 00 	movabs $0x80229d,%rax
+  8045bb:	00 00 00 
+  8045be:	ff d0                	call   *%rax
+  8045c0:	89 c3                	mov    %eax,%ebx
+  8045c2:	85 c0                	test   %eax,%eax
+  8045c4:	0f 88 a0 01 00 00    	js     80476a <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8045ca:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045d4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8045d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045dd:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  8045e4:	00 00 00 
+  8045e7:	ff d0                	call   *%rax
+  8045e9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8045eb:	85 c0                	test   %eax,%eax
+  8045ed:	0f 88 77 01 00 00    	js     80476a <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8045f3:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8045f7:	48 b8 9d 22 80 00 00 	movabs $0x80229d,%rax
+  8045fe:	00 00 00 
+  804601:	ff d0                	call   *%rax
+  804603:	89 c3                	mov    %eax,%ebx
+  804605:	85 c0                	test   %eax,%eax
+  804607:	0f 88 43 01 00 00    	js     804750 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80460d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804612:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804617:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80461b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804620:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  804627:	00 00 00 
+  80462a:	ff d0                	call   *%rax
+  80462c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80462e:	85 c0                	test   %eax,%eax
+  804630:	0f 88 1a 01 00 00    	js     804750 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804636:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80463a:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  804641:	00 00 00 
+  804644:	ff d0                	call   *%rax
+  804646:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804649:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80464e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804653:	48 89 c6             	mov    %rax,%rsi
+  804656:	bf 00 00 00 00       	mov    $0x0,%edi
+  80465b:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  804662:	00 00 00 
+  804665:	ff d0                	call   *%rax
+  804667:	89 c3                	mov    %eax,%ebx
+  804669:	85 c0                	test   %eax,%eax
+  80466b:	0f 88 c5 00 00 00    	js     804736 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804671:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804675:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  80467c:	00 00 00 
+  80467f:	ff d0                	call   *%rax
+  804681:	48 89 c1             	mov    %rax,%rcx
+  804684:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80468a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804690:	ba 00 00 00 00       	mov    $0x0,%edx
+  804695:	4c 89 ee             	mov    %r13,%rsi
+  804698:	bf 00 00 00 00       	mov    $0x0,%edi
+  80469d:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  8046a4:	00 00 00 
+  8046a7:	ff d0                	call   *%rax
+  8046a9:	89 c3                	mov    %eax,%ebx
+  8046ab:	85 c0                	test   %eax,%eax
+  8046ad:	78 6e                	js     80471d <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8046af:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046b4:	4c 89 ef             	mov    %r13,%rdi
+  8046b7:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  8046be:	00 00 00 
+  8046c1:	ff d0                	call   *%rax
+  8046c3:	83 f8 02             	cmp    $0x2,%eax
+  8046c6:	0f 85 ab 00 00 00    	jne    804777 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8046cc:	a1 20 78 80 00 00 00 	movabs 0x807820,%eax
+  8046d3:	00 00 
+  8046d5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8046d9:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8046db:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8046df:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8046e6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8046ea:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8046ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046f0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8046f7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8046fb:	48 bb 6f 22 80 00 00 	movabs $0x80226f,%rbx
+  804702:	00 00 00 
+  804705:	ff d3                	call   *%rbx
+  804707:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80470b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80470f:	ff d3                	call   *%rbx
+  804711:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804716:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80471b:	eb 4d                	jmp    80476a <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80471d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804722:	4c 89 ee             	mov    %r13,%rsi
+  804725:	bf 00 00 00 00       	mov    $0x0,%edi
+  80472a:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  804731:	00 00 00 
+  804734:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804736:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80473b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80473f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804744:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  80474b:	00 00 00 
+  80474e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804750:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804755:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804759:	bf 00 00 00 00       	mov    $0x0,%edi
+  80475e:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  804765:	00 00 00 
+  804768:	ff d0                	call   *%rax
+}
+  80476a:	89 d8                	mov    %ebx,%eax
+  80476c:	48 83 c4 18          	add    $0x18,%rsp
+  804770:	5b                   	pop    %rbx
+  804771:	41 5c                	pop    %r12
+  804773:	41 5d                	pop    %r13
+  804775:	5d                   	pop    %rbp
+  804776:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804777:	48 b9 00 59 80 00 00 	movabs $0x805900,%rcx
+  80477e:	00 00 00 
+  804781:	48 ba 7a 58 80 00 00 	movabs $0x80587a,%rdx
+  804788:	00 00 00 
+  80478b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804790:	48 bf ea 58 80 00 00 	movabs $0x8058ea,%rdi
+  804797:	00 00 00 
+  80479a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80479f:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  8047a6:	00 00 00 
+  8047a9:	41 ff d0             	call   *%r8
+
+00000000008047ac <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8047ac:	55                   	push   %rbp
+  8047ad:	48 89 e5             	mov    %rsp,%rbp
+  8047b0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8047b4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8047b8:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8047bf:	00 00 00 
+  8047c2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8047c4:	85 c0                	test   %eax,%eax
+  8047c6:	78 35                	js     8047fd <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8047c8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8047cc:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  8047d3:	00 00 00 
+  8047d6:	ff d0                	call   *%rax
+  8047d8:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8047db:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8047e0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8047e5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8047e9:	48 b8 2d 18 80 00 00 	movabs $0x80182d,%rax
+  8047f0:	00 00 00 
+  8047f3:	ff d0                	call   *%rax
+  8047f5:	85 c0                	test   %eax,%eax
+  8047f7:	0f 94 c0             	sete   %al
+  8047fa:	0f b6 c0             	movzbl %al,%eax
+}
+  8047fd:	c9                   	leave
+  8047fe:	c3                   	ret
+
+00000000008047ff <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8047ff:	55                   	push   %rbp
+  804800:	48 89 e5             	mov    %rsp,%rbp
+  804803:	41 55                	push   %r13
+  804805:	41 54                	push   %r12
+  804807:	53                   	push   %rbx
+  804808:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  80480c:	85 ff                	test   %edi,%edi
+  80480e:	74 73                	je     804883 <wait+0x84>
+  804810:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804813:	89 f8                	mov    %edi,%eax
+  804815:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  80481a:	89 f9                	mov    %edi,%ecx
+  80481c:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804822:	48 69 c9 68 01 00 00 	imul   $0x168,%rcx,%rcx
+  804829:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804830:	00 00 00 
+  804833:	48 01 ca             	add    %rcx,%rdx
+  804836:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80483c:	39 d7                	cmp    %edx,%edi
+  80483e:	75 38                	jne    804878 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  804840:	48 98                	cltq
+  804842:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804849:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804850:	00 00 00 
+  804853:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  804856:	49 bd ca 17 80 00 00 	movabs $0x8017ca,%r13
+  80485d:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804860:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804866:	85 c0                	test   %eax,%eax
+  804868:	74 0e                	je     804878 <wait+0x79>
+        sys_yield();
+  80486a:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80486d:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804873:	44 39 e0             	cmp    %r12d,%eax
+  804876:	74 e8                	je     804860 <wait+0x61>
+    }
+}
+  804878:	48 83 c4 08          	add    $0x8,%rsp
+  80487c:	5b                   	pop    %rbx
+  80487d:	41 5c                	pop    %r12
+  80487f:	41 5d                	pop    %r13
+  804881:	5d                   	pop    %rbp
+  804882:	c3                   	ret
+    assert(envid != 0);
+  804883:	48 b9 24 59 80 00 00 	movabs $0x805924,%rcx
+  80488a:	00 00 00 
+  80488d:	48 ba 7a 58 80 00 00 	movabs $0x80587a,%rdx
+  804894:	00 00 00 
+  804897:	be 06 00 00 00       	mov    $0x6,%esi
+  80489c:	48 bf 2f 59 80 00 00 	movabs $0x80592f,%rdi
+  8048a3:	00 00 00 
+  8048a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048ab:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  8048b2:	00 00 00 
+  8048b5:	41 ff d0             	call   *%r8
+
+00000000008048b8 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8048b8:	48 89 f8             	mov    %rdi,%rax
+  8048bb:	48 c1 e8 27          	shr    $0x27,%rax
+  8048bf:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8048c6:	7f 00 00 
+  8048c9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8048cd:	f6 c2 01             	test   $0x1,%dl
+  8048d0:	74 6d                	je     80493f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8048d2:	48 89 f8             	mov    %rdi,%rax
+  8048d5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8048d9:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8048e0:	7f 00 00 
+  8048e3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8048e7:	f6 c2 01             	test   $0x1,%dl
+  8048ea:	74 62                	je     80494e <get_uvpt_entry+0x96>
+  8048ec:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8048f3:	7f 00 00 
+  8048f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8048fa:	f6 c2 80             	test   $0x80,%dl
+  8048fd:	75 4f                	jne    80494e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8048ff:	48 89 f8             	mov    %rdi,%rax
+  804902:	48 c1 e8 15          	shr    $0x15,%rax
+  804906:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80490d:	7f 00 00 
+  804910:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804914:	f6 c2 01             	test   $0x1,%dl
+  804917:	74 44                	je     80495d <get_uvpt_entry+0xa5>
+  804919:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804920:	7f 00 00 
+  804923:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804927:	f6 c2 80             	test   $0x80,%dl
+  80492a:	75 31                	jne    80495d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80492c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804930:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804937:	7f 00 00 
+  80493a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80493e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80493f:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804946:	7f 00 00 
+  804949:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80494d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80494e:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804955:	7f 00 00 
+  804958:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80495c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80495d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804964:	7f 00 00 
+  804967:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80496b:	c3                   	ret
+
+000000000080496c <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80496c:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80496f:	48 89 f9             	mov    %rdi,%rcx
+  804972:	48 c1 e9 27          	shr    $0x27,%rcx
+  804976:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80497d:	7f 00 00 
+  804980:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  804984:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80498b:	f6 c1 01             	test   $0x1,%cl
+  80498e:	0f 84 b2 00 00 00    	je     804a46 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804994:	48 89 f9             	mov    %rdi,%rcx
+  804997:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80499b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8049a2:	7f 00 00 
+  8049a5:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8049a9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8049b0:	40 f6 c6 01          	test   $0x1,%sil
+  8049b4:	0f 84 8c 00 00 00    	je     804a46 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8049ba:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8049c1:	7f 00 00 
+  8049c4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8049c8:	a8 80                	test   $0x80,%al
+  8049ca:	75 7b                	jne    804a47 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8049cc:	48 89 f9             	mov    %rdi,%rcx
+  8049cf:	48 c1 e9 15          	shr    $0x15,%rcx
+  8049d3:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8049da:	7f 00 00 
+  8049dd:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8049e1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8049e8:	40 f6 c6 01          	test   $0x1,%sil
+  8049ec:	74 58                	je     804a46 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8049ee:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8049f5:	7f 00 00 
+  8049f8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8049fc:	a8 80                	test   $0x80,%al
+  8049fe:	75 6c                	jne    804a6c <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804a00:	48 89 f9             	mov    %rdi,%rcx
+  804a03:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804a07:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804a0e:	7f 00 00 
+  804a11:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804a15:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804a1c:	40 f6 c6 01          	test   $0x1,%sil
+  804a20:	74 24                	je     804a46 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804a22:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804a29:	7f 00 00 
+  804a2c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804a30:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804a37:	ff ff 7f 
+  804a3a:	48 21 c8             	and    %rcx,%rax
+  804a3d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804a43:	48 09 d0             	or     %rdx,%rax
+}
+  804a46:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804a47:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804a4e:	7f 00 00 
+  804a51:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804a55:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804a5c:	ff ff 7f 
+  804a5f:	48 21 c8             	and    %rcx,%rax
+  804a62:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804a68:	48 01 d0             	add    %rdx,%rax
+  804a6b:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804a6c:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804a73:	7f 00 00 
+  804a76:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804a7a:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804a81:	ff ff 7f 
+  804a84:	48 21 c8             	and    %rcx,%rax
+  804a87:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804a8d:	48 01 d0             	add    %rdx,%rax
+  804a90:	c3                   	ret
+
+0000000000804a91 <get_prot>:
+
+int
+get_prot(void *va) {
+  804a91:	55                   	push   %rbp
+  804a92:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804a95:	48 b8 b8 48 80 00 00 	movabs $0x8048b8,%rax
+  804a9c:	00 00 00 
+  804a9f:	ff d0                	call   *%rax
+  804aa1:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804aa4:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804aa9:	89 c1                	mov    %eax,%ecx
+  804aab:	83 c9 04             	or     $0x4,%ecx
+  804aae:	f6 c2 01             	test   $0x1,%dl
+  804ab1:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804ab4:	89 c1                	mov    %eax,%ecx
+  804ab6:	83 c9 02             	or     $0x2,%ecx
+  804ab9:	f6 c2 02             	test   $0x2,%dl
+  804abc:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804abf:	89 c1                	mov    %eax,%ecx
+  804ac1:	83 c9 01             	or     $0x1,%ecx
+  804ac4:	48 85 d2             	test   %rdx,%rdx
+  804ac7:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804aca:	89 c1                	mov    %eax,%ecx
+  804acc:	83 c9 40             	or     $0x40,%ecx
+  804acf:	f6 c6 04             	test   $0x4,%dh
+  804ad2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804ad5:	5d                   	pop    %rbp
+  804ad6:	c3                   	ret
+
+0000000000804ad7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804ad7:	55                   	push   %rbp
+  804ad8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804adb:	48 b8 b8 48 80 00 00 	movabs $0x8048b8,%rax
+  804ae2:	00 00 00 
+  804ae5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804ae7:	48 c1 e8 06          	shr    $0x6,%rax
+  804aeb:	83 e0 01             	and    $0x1,%eax
+}
+  804aee:	5d                   	pop    %rbp
+  804aef:	c3                   	ret
+
+0000000000804af0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804af0:	55                   	push   %rbp
+  804af1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804af4:	48 b8 b8 48 80 00 00 	movabs $0x8048b8,%rax
+  804afb:	00 00 00 
+  804afe:	ff d0                	call   *%rax
+  804b00:	83 e0 01             	and    $0x1,%eax
+}
+  804b03:	5d                   	pop    %rbp
+  804b04:	c3                   	ret
+
+0000000000804b05 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804b05:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804b0c:	7f 00 00 
+  804b0f:	a8 01                	test   $0x1,%al
+  804b11:	75 06                	jne    804b19 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804b13:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b18:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804b19:	55                   	push   %rbp
+  804b1a:	48 89 e5             	mov    %rsp,%rbp
+  804b1d:	41 57                	push   %r15
+  804b1f:	41 56                	push   %r14
+  804b21:	41 55                	push   %r13
+  804b23:	41 54                	push   %r12
+  804b25:	53                   	push   %rbx
+  804b26:	48 83 ec 18          	sub    $0x18,%rsp
+  804b2a:	49 89 fe             	mov    %rdi,%r14
+  804b2d:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804b30:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804b37:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804b38:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804b3f:	7f 00 00 
+  804b42:	e9 81 00 00 00       	jmp    804bc8 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804b47:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804b4e:	49 39 dd             	cmp    %rbx,%r13
+  804b51:	74 2b                	je     804b7e <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804b53:	48 89 d8             	mov    %rbx,%rax
+  804b56:	48 c1 e8 0c          	shr    $0xc,%rax
+  804b5a:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804b5e:	f6 c2 01             	test   $0x1,%dl
+  804b61:	74 e4                	je     804b47 <foreach_shared_region+0x42>
+  804b63:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804b67:	f6 c4 04             	test   $0x4,%ah
+  804b6a:	74 db                	je     804b47 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804b6c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804b73:	4c 89 fa             	mov    %r15,%rdx
+  804b76:	48 89 df             	mov    %rbx,%rdi
+  804b79:	41 ff d6             	call   *%r14
+  804b7c:	eb c9                	jmp    804b47 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804b7e:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804b85:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804b89:	74 22                	je     804bad <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804b8b:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804b92:	48 89 d8             	mov    %rbx,%rax
+  804b95:	48 c1 e8 15          	shr    $0x15,%rax
+  804b99:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804ba0:	7f 00 00 
+  804ba3:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804ba7:	a8 01                	test   $0x1,%al
+  804ba9:	74 d3                	je     804b7e <foreach_shared_region+0x79>
+  804bab:	eb a6                	jmp    804b53 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804bad:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804bb4:	40 
+  804bb5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804bb9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804bc0:	00 00 00 
+  804bc3:	48 39 c1             	cmp    %rax,%rcx
+  804bc6:	74 31                	je     804bf9 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804bc8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804bcc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804bd0:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804bd7:	7f 00 00 
+  804bda:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804bde:	a8 01                	test   $0x1,%al
+  804be0:	74 cb                	je     804bad <foreach_shared_region+0xa8>
+  804be2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804be6:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804bed:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804bf3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804bf7:	eb 92                	jmp    804b8b <foreach_shared_region+0x86>
+}
+  804bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bfe:	48 83 c4 18          	add    $0x18,%rsp
+  804c02:	5b                   	pop    %rbx
+  804c03:	41 5c                	pop    %r12
+  804c05:	41 5d                	pop    %r13
+  804c07:	41 5e                	pop    %r14
+  804c09:	41 5f                	pop    %r15
+  804c0b:	5d                   	pop    %rbp
+  804c0c:	c3                   	ret
+
+0000000000804c0d <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804c0d:	55                   	push   %rbp
+  804c0e:	48 89 e5             	mov    %rsp,%rbp
+  804c11:	41 55                	push   %r13
+  804c13:	41 54                	push   %r12
+  804c15:	53                   	push   %rbx
+  804c16:	48 83 ec 08          	sub    $0x8,%rsp
+  804c1a:	49 89 fc             	mov    %rdi,%r12
+  804c1d:	48 89 f7             	mov    %rsi,%rdi
+  804c20:	48 89 d3             	mov    %rdx,%rbx
+  804c23:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804c26:	48 85 f6             	test   %rsi,%rsi
+  804c29:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c30:	00 00 00 
+  804c33:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804c37:	be 00 10 00 00       	mov    $0x1000,%esi
+  804c3c:	48 85 d2             	test   %rdx,%rdx
+  804c3f:	74 03                	je     804c44 <ipc_recv+0x37>
+  804c41:	48 8b 32             	mov    (%rdx),%rsi
+  804c44:	48 b8 06 1c 80 00 00 	movabs $0x801c06,%rax
+  804c4b:	00 00 00 
+  804c4e:	ff d0                	call   *%rax
+    if (errno) {
+  804c50:	85 c0                	test   %eax,%eax
+  804c52:	74 1c                	je     804c70 <ipc_recv+0x63>
+        if (from_env_store)
+  804c54:	4d 85 e4             	test   %r12,%r12
+  804c57:	74 08                	je     804c61 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804c59:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804c60:	00 
+
+        if (perm_store)
+  804c61:	4d 85 ed             	test   %r13,%r13
+  804c64:	74 74                	je     804cda <ipc_recv+0xcd>
+            *perm_store = 0;
+  804c66:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804c6d:	00 
+  804c6e:	eb 6a                	jmp    804cda <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804c70:	4d 85 e4             	test   %r12,%r12
+  804c73:	74 14                	je     804c89 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804c75:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  804c7c:	00 00 00 
+  804c7f:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804c85:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804c89:	48 85 db             	test   %rbx,%rbx
+  804c8c:	74 23                	je     804cb1 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804c8e:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  804c95:	00 00 00 
+  804c98:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804c9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ca3:	85 c9                	test   %ecx,%ecx
+  804ca5:	74 07                	je     804cae <ipc_recv+0xa1>
+  804ca7:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804cae:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804cb1:	4d 85 ed             	test   %r13,%r13
+  804cb4:	74 14                	je     804cca <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804cb6:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  804cbd:	00 00 00 
+  804cc0:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804cc6:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804cca:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  804cd1:	00 00 00 
+  804cd4:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804cda:	48 83 c4 08          	add    $0x8,%rsp
+  804cde:	5b                   	pop    %rbx
+  804cdf:	41 5c                	pop    %r12
+  804ce1:	41 5d                	pop    %r13
+  804ce3:	5d                   	pop    %rbp
+  804ce4:	c3                   	ret
+
+0000000000804ce5 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804ce5:	55                   	push   %rbp
+  804ce6:	48 89 e5             	mov    %rsp,%rbp
+  804ce9:	41 55                	push   %r13
+  804ceb:	41 54                	push   %r12
+  804ced:	53                   	push   %rbx
+  804cee:	48 83 ec 08          	sub    $0x8,%rsp
+  804cf2:	49 89 fc             	mov    %rdi,%r12
+  804cf5:	48 89 f7             	mov    %rsi,%rdi
+  804cf8:	48 89 d3             	mov    %rdx,%rbx
+  804cfb:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804cfe:	48 85 f6             	test   %rsi,%rsi
+  804d01:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d08:	00 00 00 
+  804d0b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804d0f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804d14:	48 85 d2             	test   %rdx,%rdx
+  804d17:	74 03                	je     804d1c <ipc_try_recv+0x37>
+  804d19:	48 8b 32             	mov    (%rdx),%rsi
+  804d1c:	48 b8 6f 1c 80 00 00 	movabs $0x801c6f,%rax
+  804d23:	00 00 00 
+  804d26:	ff d0                	call   *%rax
+    if (errno) {
+  804d28:	85 c0                	test   %eax,%eax
+  804d2a:	75 75                	jne    804da1 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804d2c:	4d 85 e4             	test   %r12,%r12
+  804d2f:	74 14                	je     804d45 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804d31:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  804d38:	00 00 00 
+  804d3b:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804d41:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804d45:	48 85 db             	test   %rbx,%rbx
+  804d48:	74 23                	je     804d6d <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804d4a:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  804d51:	00 00 00 
+  804d54:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804d5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d5f:	85 c9                	test   %ecx,%ecx
+  804d61:	74 07                	je     804d6a <ipc_try_recv+0x85>
+  804d63:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804d6a:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804d6d:	4d 85 ed             	test   %r13,%r13
+  804d70:	74 14                	je     804d86 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804d72:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  804d79:	00 00 00 
+  804d7c:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804d82:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804d86:	48 a1 70 97 80 00 00 	movabs 0x809770,%rax
+  804d8d:	00 00 00 
+  804d90:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804d96:	48 83 c4 08          	add    $0x8,%rsp
+  804d9a:	5b                   	pop    %rbx
+  804d9b:	41 5c                	pop    %r12
+  804d9d:	41 5d                	pop    %r13
+  804d9f:	5d                   	pop    %rbp
+  804da0:	c3                   	ret
+        if (from_env_store)
+  804da1:	4d 85 e4             	test   %r12,%r12
+  804da4:	74 08                	je     804dae <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804da6:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804dad:	00 
+        if (perm_store)
+  804dae:	4d 85 ed             	test   %r13,%r13
+  804db1:	74 e3                	je     804d96 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804db3:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804dba:	00 
+  804dbb:	eb d9                	jmp    804d96 <ipc_try_recv+0xb1>
+
+0000000000804dbd <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804dbd:	55                   	push   %rbp
+  804dbe:	48 89 e5             	mov    %rsp,%rbp
+  804dc1:	41 57                	push   %r15
+  804dc3:	41 56                	push   %r14
+  804dc5:	41 55                	push   %r13
+  804dc7:	41 54                	push   %r12
+  804dc9:	53                   	push   %rbx
+  804dca:	48 83 ec 18          	sub    $0x18,%rsp
+  804dce:	41 89 fd             	mov    %edi,%r13d
+  804dd1:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804dd4:	48 89 d3             	mov    %rdx,%rbx
+  804dd7:	49 89 cc             	mov    %rcx,%r12
+  804dda:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804dde:	48 85 d2             	test   %rdx,%rdx
+  804de1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804de8:	00 00 00 
+  804deb:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804def:	49 be da 1b 80 00 00 	movabs $0x801bda,%r14
+  804df6:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804df9:	49 bf ca 17 80 00 00 	movabs $0x8017ca,%r15
+  804e00:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804e03:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804e06:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804e0a:	4c 89 e1             	mov    %r12,%rcx
+  804e0d:	48 89 da             	mov    %rbx,%rdx
+  804e10:	44 89 ef             	mov    %r13d,%edi
+  804e13:	41 ff d6             	call   *%r14
+  804e16:	85 c0                	test   %eax,%eax
+  804e18:	74 37                	je     804e51 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804e1a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804e1d:	75 05                	jne    804e24 <ipc_send+0x67>
+        sys_yield();
+  804e1f:	41 ff d7             	call   *%r15
+  804e22:	eb df                	jmp    804e03 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804e24:	89 c1                	mov    %eax,%ecx
+  804e26:	48 ba 3a 59 80 00 00 	movabs $0x80593a,%rdx
+  804e2d:	00 00 00 
+  804e30:	be 65 00 00 00       	mov    $0x65,%esi
+  804e35:	48 bf 55 59 80 00 00 	movabs $0x805955,%rdi
+  804e3c:	00 00 00 
+  804e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e44:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  804e4b:	00 00 00 
+  804e4e:	41 ff d0             	call   *%r8
+    }
+}
+  804e51:	48 83 c4 18          	add    $0x18,%rsp
+  804e55:	5b                   	pop    %rbx
+  804e56:	41 5c                	pop    %r12
+  804e58:	41 5d                	pop    %r13
+  804e5a:	41 5e                	pop    %r14
+  804e5c:	41 5f                	pop    %r15
+  804e5e:	5d                   	pop    %rbp
+  804e5f:	c3                   	ret
+
+0000000000804e60 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804e60:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804e65:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804e6c:	00 00 00 
+  804e6f:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804e76:	48 01 ca             	add    %rcx,%rdx
+  804e79:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804e7f:	39 fa                	cmp    %edi,%edx
+  804e81:	74 12                	je     804e95 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804e83:	48 83 c0 01          	add    $0x1,%rax
+  804e87:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804e8d:	75 e0                	jne    804e6f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e94:	c3                   	ret
+            return envs[i].env_id;
+  804e95:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804e9c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804ea3:	00 00 00 
+  804ea6:	48 01 d0             	add    %rdx,%rax
+  804ea9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804eaf:	c3                   	ret
+
+0000000000804eb0 <__text_end>:
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
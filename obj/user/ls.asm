@@ -0,0 +1,8510 @@
+
+obj/user/ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 17 04 00 00       	call   80043a <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <ls1>:
+    if (n < 0)
+        panic("error reading directory %s: %i", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+  800032:	48 89 fb             	mov    %rdi,%rbx
+  800035:	41 89 f4             	mov    %esi,%r12d
+  800038:	49 89 cd             	mov    %rcx,%r13
+    const char *sep;
+
+    if (flag['l'])
+  80003b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800042:	00 00 00 
+  800045:	83 b8 b0 01 00 00 00 	cmpl   $0x0,0x1b0(%rax)
+  80004c:	74 29                	je     800077 <ls1+0x52>
+  80004e:	89 d6                	mov    %edx,%esi
+        printf("%11d %c ", size, isdir ? 'd' : '-');
+  800050:	41 80 fc 01          	cmp    $0x1,%r12b
+  800054:	19 d2                	sbb    %edx,%edx
+  800056:	83 e2 c9             	and    $0xffffffc9,%edx
+  800059:	83 c2 64             	add    $0x64,%edx
+  80005c:	48 bf 02 50 80 00 00 	movabs $0x805002,%rdi
+  800063:	00 00 00 
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	48 b9 2d 3c 80 00 00 	movabs $0x803c2d,%rcx
+  800072:	00 00 00 
+  800075:	ff d1                	call   *%rcx
+    if (prefix) {
+  800077:	48 85 db             	test   %rbx,%rbx
+  80007a:	74 2d                	je     8000a9 <ls1+0x84>
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+            sep = "/";
+        else
+            sep = "";
+  80007c:	48 ba 68 50 80 00 00 	movabs $0x805068,%rdx
+  800083:	00 00 00 
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  800086:	80 3b 00             	cmpb   $0x0,(%rbx)
+  800089:	75 7a                	jne    800105 <ls1+0xe0>
+        printf("%s%s", prefix, sep);
+  80008b:	48 89 de             	mov    %rbx,%rsi
+  80008e:	48 bf 0b 50 80 00 00 	movabs $0x80500b,%rdi
+  800095:	00 00 00 
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	48 b9 2d 3c 80 00 00 	movabs $0x803c2d,%rcx
+  8000a4:	00 00 00 
+  8000a7:	ff d1                	call   *%rcx
+    }
+    printf("%s", name);
+  8000a9:	4c 89 ee             	mov    %r13,%rsi
+  8000ac:	48 bf 5d 57 80 00 00 	movabs $0x80575d,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	48 ba 2d 3c 80 00 00 	movabs $0x803c2d,%rdx
+  8000c2:	00 00 00 
+  8000c5:	ff d2                	call   *%rdx
+    if (flag['F'] && isdir)
+  8000c7:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000ce:	00 00 00 
+  8000d1:	83 b8 18 01 00 00 00 	cmpl   $0x0,0x118(%rax)
+  8000d8:	74 05                	je     8000df <ls1+0xba>
+  8000da:	45 84 e4             	test   %r12b,%r12b
+  8000dd:	75 57                	jne    800136 <ls1+0x111>
+        printf("/");
+    printf("\n");
+  8000df:	48 bf 67 50 80 00 00 	movabs $0x805067,%rdi
+  8000e6:	00 00 00 
+  8000e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ee:	48 ba 2d 3c 80 00 00 	movabs $0x803c2d,%rdx
+  8000f5:	00 00 00 
+  8000f8:	ff d2                	call   *%rdx
+}
+  8000fa:	48 83 c4 08          	add    $0x8,%rsp
+  8000fe:	5b                   	pop    %rbx
+  8000ff:	41 5c                	pop    %r12
+  800101:	41 5d                	pop    %r13
+  800103:	5d                   	pop    %rbp
+  800104:	c3                   	ret
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  800105:	48 89 df             	mov    %rbx,%rdi
+  800108:	48 b8 90 0f 80 00 00 	movabs $0x800f90,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+            sep = "/";
+  800114:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%rbx,%rax,1)
+  800119:	48 ba 68 50 80 00 00 	movabs $0x805068,%rdx
+  800120:	00 00 00 
+  800123:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80012a:	00 00 00 
+  80012d:	48 0f 45 d0          	cmovne %rax,%rdx
+  800131:	e9 55 ff ff ff       	jmp    80008b <ls1+0x66>
+        printf("/");
+  800136:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80013d:	00 00 00 
+  800140:	b8 00 00 00 00       	mov    $0x0,%eax
+  800145:	48 ba 2d 3c 80 00 00 	movabs $0x803c2d,%rdx
+  80014c:	00 00 00 
+  80014f:	ff d2                	call   *%rdx
+  800151:	eb 8c                	jmp    8000df <ls1+0xba>
+
+0000000000800153 <lsdir>:
+lsdir(const char *path, const char *prefix) {
+  800153:	55                   	push   %rbp
+  800154:	48 89 e5             	mov    %rsp,%rbp
+  800157:	41 56                	push   %r14
+  800159:	41 55                	push   %r13
+  80015b:	41 54                	push   %r12
+  80015d:	53                   	push   %rbx
+  80015e:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800165:	49 89 fd             	mov    %rdi,%r13
+  800168:	49 89 f6             	mov    %rsi,%r14
+    if ((fd = open(path, O_RDONLY)) < 0)
+  80016b:	be 00 00 00 00       	mov    $0x0,%esi
+  800170:	48 b8 38 36 80 00 00 	movabs $0x803638,%rax
+  800177:	00 00 00 
+  80017a:	ff d0                	call   *%rax
+  80017c:	89 c3                	mov    %eax,%ebx
+  80017e:	85 c0                	test   %eax,%eax
+  800180:	78 58                	js     8001da <lsdir+0x87>
+    while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  800182:	49 bc ed 26 80 00 00 	movabs $0x8026ed,%r12
+  800189:	00 00 00 
+  80018c:	ba 00 01 00 00       	mov    $0x100,%edx
+  800191:	48 8d b5 e0 fe ff ff 	lea    -0x120(%rbp),%rsi
+  800198:	89 df                	mov    %ebx,%edi
+  80019a:	41 ff d4             	call   *%r12
+  80019d:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8001a2:	75 67                	jne    80020b <lsdir+0xb8>
+        if (f.f_name[0])
+  8001a4:	80 bd e0 fe ff ff 00 	cmpb   $0x0,-0x120(%rbp)
+  8001ab:	74 df                	je     80018c <lsdir+0x39>
+            ls1(prefix, f.f_type == FTYPE_DIR, f.f_size, f.f_name);
+  8001ad:	83 bd 64 ff ff ff 01 	cmpl   $0x1,-0x9c(%rbp)
+  8001b4:	40 0f 94 c6          	sete   %sil
+  8001b8:	40 0f b6 f6          	movzbl %sil,%esi
+  8001bc:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+  8001c3:	8b 95 60 ff ff ff    	mov    -0xa0(%rbp),%edx
+  8001c9:	4c 89 f7             	mov    %r14,%rdi
+  8001cc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+  8001d8:	eb b2                	jmp    80018c <lsdir+0x39>
+        panic("open %s: %i", path, fd);
+  8001da:	41 89 c0             	mov    %eax,%r8d
+  8001dd:	4c 89 e9             	mov    %r13,%rcx
+  8001e0:	48 ba 10 50 80 00 00 	movabs $0x805010,%rdx
+  8001e7:	00 00 00 
+  8001ea:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8001ef:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  8001f6:	00 00 00 
+  8001f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fe:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  800205:	00 00 00 
+  800208:	41 ff d1             	call   *%r9
+    if (n > 0)
+  80020b:	85 c0                	test   %eax,%eax
+  80020d:	7f 12                	jg     800221 <lsdir+0xce>
+    if (n < 0)
+  80020f:	78 3e                	js     80024f <lsdir+0xfc>
+}
+  800211:	48 81 c4 00 01 00 00 	add    $0x100,%rsp
+  800218:	5b                   	pop    %rbx
+  800219:	41 5c                	pop    %r12
+  80021b:	41 5d                	pop    %r13
+  80021d:	41 5e                	pop    %r14
+  80021f:	5d                   	pop    %rbp
+  800220:	c3                   	ret
+        panic("short read in directory %s", path);
+  800221:	4c 89 e9             	mov    %r13,%rcx
+  800224:	48 ba 26 50 80 00 00 	movabs $0x805026,%rdx
+  80022b:	00 00 00 
+  80022e:	be 20 00 00 00       	mov    $0x20,%esi
+  800233:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  80023a:	00 00 00 
+  80023d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800242:	49 b8 06 05 80 00 00 	movabs $0x800506,%r8
+  800249:	00 00 00 
+  80024c:	41 ff d0             	call   *%r8
+        panic("error reading directory %s: %i", path, n);
+  80024f:	41 89 c0             	mov    %eax,%r8d
+  800252:	4c 89 e9             	mov    %r13,%rcx
+  800255:	48 ba 70 50 80 00 00 	movabs $0x805070,%rdx
+  80025c:	00 00 00 
+  80025f:	be 22 00 00 00       	mov    $0x22,%esi
+  800264:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  80026b:	00 00 00 
+  80026e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800273:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  80027a:	00 00 00 
+  80027d:	41 ff d1             	call   *%r9
+
+0000000000800280 <ls>:
+ls(const char *path, const char *prefix) {
+  800280:	55                   	push   %rbp
+  800281:	48 89 e5             	mov    %rsp,%rbp
+  800284:	41 54                	push   %r12
+  800286:	53                   	push   %rbx
+  800287:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80028e:	48 89 fb             	mov    %rdi,%rbx
+  800291:	49 89 f4             	mov    %rsi,%r12
+    if ((r = stat(path, &st)) < 0)
+  800294:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  80029b:	48 b8 45 2a 80 00 00 	movabs $0x802a45,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+  8002a7:	85 c0                	test   %eax,%eax
+  8002a9:	78 47                	js     8002f2 <ls+0x72>
+    if (st.st_isdir && !flag['d'])
+  8002ab:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002ae:	85 c0                	test   %eax,%eax
+  8002b0:	74 13                	je     8002c5 <ls+0x45>
+  8002b2:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8002b9:	00 00 00 
+  8002bc:	83 ba 90 01 00 00 00 	cmpl   $0x0,0x190(%rdx)
+  8002c3:	74 5e                	je     800323 <ls+0xa3>
+        ls1(0, st.st_isdir, st.st_size, path);
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	40 0f 95 c6          	setne  %sil
+  8002cb:	40 0f b6 f6          	movzbl %sil,%esi
+  8002cf:	48 89 d9             	mov    %rbx,%rcx
+  8002d2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8002d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002da:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002e1:	00 00 00 
+  8002e4:	ff d0                	call   *%rax
+}
+  8002e6:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+  8002ed:	5b                   	pop    %rbx
+  8002ee:	41 5c                	pop    %r12
+  8002f0:	5d                   	pop    %rbp
+  8002f1:	c3                   	ret
+        panic("stat %s: %i", path, r);
+  8002f2:	41 89 c0             	mov    %eax,%r8d
+  8002f5:	48 89 d9             	mov    %rbx,%rcx
+  8002f8:	48 ba 41 50 80 00 00 	movabs $0x805041,%rdx
+  8002ff:	00 00 00 
+  800302:	be 0e 00 00 00       	mov    $0xe,%esi
+  800307:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  80030e:	00 00 00 
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  80031d:	00 00 00 
+  800320:	41 ff d1             	call   *%r9
+        lsdir(path, prefix);
+  800323:	4c 89 e6             	mov    %r12,%rsi
+  800326:	48 89 df             	mov    %rbx,%rdi
+  800329:	48 b8 53 01 80 00 00 	movabs $0x800153,%rax
+  800330:	00 00 00 
+  800333:	ff d0                	call   *%rax
+  800335:	eb af                	jmp    8002e6 <ls+0x66>
+
+0000000000800337 <usage>:
+
+void
+usage(void) {
+  800337:	55                   	push   %rbp
+  800338:	48 89 e5             	mov    %rsp,%rbp
+    printf("usage: ls [-dFl] [file...]\n");
+  80033b:	48 bf 4d 50 80 00 00 	movabs $0x80504d,%rdi
+  800342:	00 00 00 
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	48 ba 2d 3c 80 00 00 	movabs $0x803c2d,%rdx
+  800351:	00 00 00 
+  800354:	ff d2                	call   *%rdx
+    exit();
+  800356:	48 b8 e3 04 80 00 00 	movabs $0x8004e3,%rax
+  80035d:	00 00 00 
+  800360:	ff d0                	call   *%rax
+}
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	41 57                	push   %r15
+  80036a:	41 56                	push   %r14
+  80036c:	41 55                	push   %r13
+  80036e:	41 54                	push   %r12
+  800370:	53                   	push   %rbx
+  800371:	48 83 ec 38          	sub    $0x38,%rsp
+  800375:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  800378:	49 89 f4             	mov    %rsi,%r12
+    int i;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80037b:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  80037f:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  800383:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  80038a:	00 00 00 
+  80038d:	ff d0                	call   *%rax
+    while ((i = argnext(&args)) >= 0)
+  80038f:	49 bd 71 21 80 00 00 	movabs $0x802171,%r13
+  800396:	00 00 00 
+        case 'F':
+        case 'l':
+            flag[i]++;
+            break;
+        default:
+            usage();
+  800399:	49 bf 37 03 80 00 00 	movabs $0x800337,%r15
+  8003a0:	00 00 00 
+        switch (i) {
+  8003a3:	49 be 01 00 00 40 40 	movabs $0x4040000001,%r14
+  8003aa:	00 00 00 
+            flag[i]++;
+  8003ad:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8003b4:	00 00 00 
+    while ((i = argnext(&args)) >= 0)
+  8003b7:	eb 06                	jmp    8003bf <umain+0x5b>
+            flag[i]++;
+  8003b9:	48 98                	cltq
+  8003bb:	83 04 83 01          	addl   $0x1,(%rbx,%rax,4)
+    while ((i = argnext(&args)) >= 0)
+  8003bf:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8003c3:	41 ff d5             	call   *%r13
+  8003c6:	85 c0                	test   %eax,%eax
+  8003c8:	78 13                	js     8003dd <umain+0x79>
+        switch (i) {
+  8003ca:	8d 50 ba             	lea    -0x46(%rax),%edx
+  8003cd:	83 fa 26             	cmp    $0x26,%edx
+  8003d0:	77 06                	ja     8003d8 <umain+0x74>
+  8003d2:	49 0f a3 d6          	bt     %rdx,%r14
+  8003d6:	72 e1                	jb     8003b9 <umain+0x55>
+            usage();
+  8003d8:	41 ff d7             	call   *%r15
+  8003db:	eb e2                	jmp    8003bf <umain+0x5b>
+        }
+
+    if (argc == 1)
+  8003dd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8003e0:	83 f8 01             	cmp    $0x1,%eax
+  8003e3:	74 33                	je     800418 <umain+0xb4>
+        ls("/", "");
+    else {
+        for (i = 1; i < argc; i++)
+  8003e5:	bb 01 00 00 00       	mov    $0x1,%ebx
+            ls(argv[i], argv[i]);
+  8003ea:	49 bd 80 02 80 00 00 	movabs $0x800280,%r13
+  8003f1:	00 00 00 
+        for (i = 1; i < argc; i++)
+  8003f4:	7e 13                	jle    800409 <umain+0xa5>
+            ls(argv[i], argv[i]);
+  8003f6:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  8003fa:	48 89 fe             	mov    %rdi,%rsi
+  8003fd:	41 ff d5             	call   *%r13
+        for (i = 1; i < argc; i++)
+  800400:	48 83 c3 01          	add    $0x1,%rbx
+  800404:	39 5d ac             	cmp    %ebx,-0x54(%rbp)
+  800407:	7f ed                	jg     8003f6 <umain+0x92>
+    }
+}
+  800409:	48 83 c4 38          	add    $0x38,%rsp
+  80040d:	5b                   	pop    %rbx
+  80040e:	41 5c                	pop    %r12
+  800410:	41 5d                	pop    %r13
+  800412:	41 5e                	pop    %r14
+  800414:	41 5f                	pop    %r15
+  800416:	5d                   	pop    %rbp
+  800417:	c3                   	ret
+        ls("/", "");
+  800418:	48 be 68 50 80 00 00 	movabs $0x805068,%rsi
+  80041f:	00 00 00 
+  800422:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800429:	00 00 00 
+  80042c:	48 b8 80 02 80 00 00 	movabs $0x800280,%rax
+  800433:	00 00 00 
+  800436:	ff d0                	call   *%rax
+  800438:	eb cf                	jmp    800409 <umain+0xa5>
+
+000000000080043a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80043a:	55                   	push   %rbp
+  80043b:	48 89 e5             	mov    %rsp,%rbp
+  80043e:	41 56                	push   %r14
+  800440:	41 55                	push   %r13
+  800442:	41 54                	push   %r12
+  800444:	53                   	push   %rbx
+  800445:	41 89 fd             	mov    %edi,%r13d
+  800448:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80044b:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800452:	00 00 00 
+  800455:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80045c:	00 00 00 
+  80045f:	48 39 c2             	cmp    %rax,%rdx
+  800462:	73 17                	jae    80047b <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800464:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800467:	49 89 c4             	mov    %rax,%r12
+  80046a:	48 83 c3 08          	add    $0x8,%rbx
+  80046e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800473:	ff 53 f8             	call   *-0x8(%rbx)
+  800476:	4c 39 e3             	cmp    %r12,%rbx
+  800479:	72 ef                	jb     80046a <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80047b:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  800482:	00 00 00 
+  800485:	ff d0                	call   *%rax
+  800487:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80048c:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800493:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80049a:	00 00 00 
+  80049d:	48 01 d0             	add    %rdx,%rax
+  8004a0:	48 a3 00 74 80 00 00 	movabs %rax,0x807400
+  8004a7:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8004aa:	45 85 ed             	test   %r13d,%r13d
+  8004ad:	7e 0d                	jle    8004bc <libmain+0x82>
+  8004af:	49 8b 06             	mov    (%r14),%rax
+  8004b2:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8004b9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8004bc:	4c 89 f6             	mov    %r14,%rsi
+  8004bf:	44 89 ef             	mov    %r13d,%edi
+  8004c2:	48 b8 64 03 80 00 00 	movabs $0x800364,%rax
+  8004c9:	00 00 00 
+  8004cc:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8004ce:	48 b8 e3 04 80 00 00 	movabs $0x8004e3,%rax
+  8004d5:	00 00 00 
+  8004d8:	ff d0                	call   *%rax
+#endif
+}
+  8004da:	5b                   	pop    %rbx
+  8004db:	41 5c                	pop    %r12
+  8004dd:	41 5d                	pop    %r13
+  8004df:	41 5e                	pop    %r14
+  8004e1:	5d                   	pop    %rbp
+  8004e2:	c3                   	ret
+
+00000000008004e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004e3:	55                   	push   %rbp
+  8004e4:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8004e7:	48 b8 e4 24 80 00 00 	movabs $0x8024e4,%rax
+  8004ee:	00 00 00 
+  8004f1:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8004f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004f8:	48 b8 03 16 80 00 00 	movabs $0x801603,%rax
+  8004ff:	00 00 00 
+  800502:	ff d0                	call   *%rax
+}
+  800504:	5d                   	pop    %rbp
+  800505:	c3                   	ret
+
+0000000000800506 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800506:	55                   	push   %rbp
+  800507:	48 89 e5             	mov    %rsp,%rbp
+  80050a:	41 56                	push   %r14
+  80050c:	41 55                	push   %r13
+  80050e:	41 54                	push   %r12
+  800510:	53                   	push   %rbx
+  800511:	48 83 ec 50          	sub    $0x50,%rsp
+  800515:	49 89 fc             	mov    %rdi,%r12
+  800518:	41 89 f5             	mov    %esi,%r13d
+  80051b:	48 89 d3             	mov    %rdx,%rbx
+  80051e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800522:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800526:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80052a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800531:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800535:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800539:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80053d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800541:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800548:	00 00 00 
+  80054b:	4c 8b 30             	mov    (%rax),%r14
+  80054e:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  800555:	00 00 00 
+  800558:	ff d0                	call   *%rax
+  80055a:	89 c6                	mov    %eax,%esi
+  80055c:	45 89 e8             	mov    %r13d,%r8d
+  80055f:	4c 89 e1             	mov    %r12,%rcx
+  800562:	4c 89 f2             	mov    %r14,%rdx
+  800565:	48 bf a0 50 80 00 00 	movabs $0x8050a0,%rdi
+  80056c:	00 00 00 
+  80056f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800574:	49 bc 56 06 80 00 00 	movabs $0x800656,%r12
+  80057b:	00 00 00 
+  80057e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800581:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800585:	48 89 df             	mov    %rbx,%rdi
+  800588:	48 b8 f2 05 80 00 00 	movabs $0x8005f2,%rax
+  80058f:	00 00 00 
+  800592:	ff d0                	call   *%rax
+    cprintf("\n");
+  800594:	48 bf 67 50 80 00 00 	movabs $0x805067,%rdi
+  80059b:	00 00 00 
+  80059e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8005a6:	cc                   	int3
+  8005a7:	eb fd                	jmp    8005a6 <_panic+0xa0>
+
+00000000008005a9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8005a9:	55                   	push   %rbp
+  8005aa:	48 89 e5             	mov    %rsp,%rbp
+  8005ad:	53                   	push   %rbx
+  8005ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8005b2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8005b5:	8b 06                	mov    (%rsi),%eax
+  8005b7:	8d 50 01             	lea    0x1(%rax),%edx
+  8005ba:	89 16                	mov    %edx,(%rsi)
+  8005bc:	48 98                	cltq
+  8005be:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8005c3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005c9:	74 0a                	je     8005d5 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8005cb:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8005cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005d3:	c9                   	leave
+  8005d4:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8005d5:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8005d9:	be ff 00 00 00       	mov    $0xff,%esi
+  8005de:	48 b8 a5 15 80 00 00 	movabs $0x8015a5,%rax
+  8005e5:	00 00 00 
+  8005e8:	ff d0                	call   *%rax
+        state->offset = 0;
+  8005ea:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8005f0:	eb d9                	jmp    8005cb <putch+0x22>
+
+00000000008005f2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005f2:	55                   	push   %rbp
+  8005f3:	48 89 e5             	mov    %rsp,%rbp
+  8005f6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8005fd:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800600:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800607:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80060c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800611:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800614:	48 89 f1             	mov    %rsi,%rcx
+  800617:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80061e:	48 bf a9 05 80 00 00 	movabs $0x8005a9,%rdi
+  800625:	00 00 00 
+  800628:	48 b8 a6 07 80 00 00 	movabs $0x8007a6,%rax
+  80062f:	00 00 00 
+  800632:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800634:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80063b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800642:	48 b8 a5 15 80 00 00 	movabs $0x8015a5,%rax
+  800649:	00 00 00 
+  80064c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80064e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800654:	c9                   	leave
+  800655:	c3                   	ret
+
+0000000000800656 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800656:	55                   	push   %rbp
+  800657:	48 89 e5             	mov    %rsp,%rbp
+  80065a:	48 83 ec 50          	sub    $0x50,%rsp
+  80065e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800662:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800666:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80066a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80066e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800672:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800679:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80067d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800681:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800685:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800689:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80068d:	48 b8 f2 05 80 00 00 	movabs $0x8005f2,%rax
+  800694:	00 00 00 
+  800697:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800699:	c9                   	leave
+  80069a:	c3                   	ret
+
+000000000080069b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80069b:	55                   	push   %rbp
+  80069c:	48 89 e5             	mov    %rsp,%rbp
+  80069f:	41 57                	push   %r15
+  8006a1:	41 56                	push   %r14
+  8006a3:	41 55                	push   %r13
+  8006a5:	41 54                	push   %r12
+  8006a7:	53                   	push   %rbx
+  8006a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8006ac:	49 89 fc             	mov    %rdi,%r12
+  8006af:	49 89 f5             	mov    %rsi,%r13
+  8006b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8006b6:	8b 45 10             	mov    0x10(%rbp),%eax
+  8006b9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8006bc:	41 89 cf             	mov    %ecx,%r15d
+  8006bf:	4c 39 fa             	cmp    %r15,%rdx
+  8006c2:	73 5b                	jae    80071f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8006c4:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8006c8:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8006cc:	85 db                	test   %ebx,%ebx
+  8006ce:	7e 0e                	jle    8006de <print_num+0x43>
+            putch(padc, put_arg);
+  8006d0:	4c 89 ee             	mov    %r13,%rsi
+  8006d3:	44 89 f7             	mov    %r14d,%edi
+  8006d6:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8006d9:	83 eb 01             	sub    $0x1,%ebx
+  8006dc:	75 f2                	jne    8006d0 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8006de:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8006e2:	48 b9 d4 50 80 00 00 	movabs $0x8050d4,%rcx
+  8006e9:	00 00 00 
+  8006ec:	48 b8 c3 50 80 00 00 	movabs $0x8050c3,%rax
+  8006f3:	00 00 00 
+  8006f6:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8006fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800703:	49 f7 f7             	div    %r15
+  800706:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80070a:	4c 89 ee             	mov    %r13,%rsi
+  80070d:	41 ff d4             	call   *%r12
+}
+  800710:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800714:	5b                   	pop    %rbx
+  800715:	41 5c                	pop    %r12
+  800717:	41 5d                	pop    %r13
+  800719:	41 5e                	pop    %r14
+  80071b:	41 5f                	pop    %r15
+  80071d:	5d                   	pop    %rbp
+  80071e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80071f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800723:	ba 00 00 00 00       	mov    $0x0,%edx
+  800728:	49 f7 f7             	div    %r15
+  80072b:	48 83 ec 08          	sub    $0x8,%rsp
+  80072f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800733:	52                   	push   %rdx
+  800734:	45 0f be c9          	movsbl %r9b,%r9d
+  800738:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80073c:	48 89 c2             	mov    %rax,%rdx
+  80073f:	48 b8 9b 06 80 00 00 	movabs $0x80069b,%rax
+  800746:	00 00 00 
+  800749:	ff d0                	call   *%rax
+  80074b:	48 83 c4 10          	add    $0x10,%rsp
+  80074f:	eb 8d                	jmp    8006de <print_num+0x43>
+
+0000000000800751 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800751:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800755:	48 8b 06             	mov    (%rsi),%rax
+  800758:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80075c:	73 0a                	jae    800768 <sprintputch+0x17>
+        *state->start++ = ch;
+  80075e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800762:	48 89 16             	mov    %rdx,(%rsi)
+  800765:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800768:	c3                   	ret
+
+0000000000800769 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800769:	55                   	push   %rbp
+  80076a:	48 89 e5             	mov    %rsp,%rbp
+  80076d:	48 83 ec 50          	sub    $0x50,%rsp
+  800771:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800775:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800779:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80077d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800784:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800788:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800790:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800794:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800798:	48 b8 a6 07 80 00 00 	movabs $0x8007a6,%rax
+  80079f:	00 00 00 
+  8007a2:	ff d0                	call   *%rax
+}
+  8007a4:	c9                   	leave
+  8007a5:	c3                   	ret
+
+00000000008007a6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8007a6:	55                   	push   %rbp
+  8007a7:	48 89 e5             	mov    %rsp,%rbp
+  8007aa:	41 57                	push   %r15
+  8007ac:	41 56                	push   %r14
+  8007ae:	41 55                	push   %r13
+  8007b0:	41 54                	push   %r12
+  8007b2:	53                   	push   %rbx
+  8007b3:	48 83 ec 38          	sub    $0x38,%rsp
+  8007b7:	49 89 fe             	mov    %rdi,%r14
+  8007ba:	49 89 f5             	mov    %rsi,%r13
+  8007bd:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8007c0:	48 8b 01             	mov    (%rcx),%rax
+  8007c3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8007c7:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8007cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cf:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8007d3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8007d7:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8007db:	0f b6 3b             	movzbl (%rbx),%edi
+  8007de:	40 80 ff 25          	cmp    $0x25,%dil
+  8007e2:	74 18                	je     8007fc <vprintfmt+0x56>
+            if (!ch) return;
+  8007e4:	40 84 ff             	test   %dil,%dil
+  8007e7:	0f 84 04 07 00 00    	je     800ef1 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8007ed:	40 0f b6 ff          	movzbl %dil,%edi
+  8007f1:	4c 89 ee             	mov    %r13,%rsi
+  8007f4:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8007f7:	4c 89 e3             	mov    %r12,%rbx
+  8007fa:	eb db                	jmp    8007d7 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8007fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800801:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800805:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80080a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800810:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800817:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80081b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800820:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800825:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800828:	83 e8 23             	sub    $0x23,%eax
+  80082b:	3c 57                	cmp    $0x57,%al
+  80082d:	0f 87 a4 06 00 00    	ja     800ed7 <vprintfmt+0x731>
+  800833:	0f b6 c0             	movzbl %al,%eax
+  800836:	48 b9 60 52 80 00 00 	movabs $0x805260,%rcx
+  80083d:	00 00 00 
+  800840:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800843:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800846:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80084a:	eb cf                	jmp    80081b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80084c:	49 89 dc             	mov    %rbx,%r12
+  80084f:	be 01 00 00 00       	mov    $0x1,%esi
+  800854:	eb c5                	jmp    80081b <vprintfmt+0x75>
+            padc = ch;
+  800856:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80085a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80085d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800860:	eb b9                	jmp    80081b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800862:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800865:	83 f8 2f             	cmp    $0x2f,%eax
+  800868:	77 24                	ja     80088e <vprintfmt+0xe8>
+  80086a:	89 c1                	mov    %eax,%ecx
+  80086c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800870:	83 c0 08             	add    $0x8,%eax
+  800873:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800876:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800879:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80087c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800880:	79 99                	jns    80081b <vprintfmt+0x75>
+                width = precision;
+  800882:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800886:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80088c:	eb 8d                	jmp    80081b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80088e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800892:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800896:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089a:	eb da                	jmp    800876 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80089c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8008a1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008a5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8008ab:	3c 39                	cmp    $0x39,%al
+  8008ad:	77 1c                	ja     8008cb <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8008af:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8008b3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8008b7:	0f b6 c0             	movzbl %al,%eax
+  8008ba:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008bf:	0f b6 03             	movzbl (%rbx),%eax
+  8008c2:	3c 39                	cmp    $0x39,%al
+  8008c4:	76 e9                	jbe    8008af <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8008c6:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8008c9:	eb b1                	jmp    80087c <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8008cb:	49 89 dc             	mov    %rbx,%r12
+  8008ce:	eb ac                	jmp    80087c <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8008d0:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8008d3:	85 c9                	test   %ecx,%ecx
+  8008d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008da:	0f 49 c1             	cmovns %ecx,%eax
+  8008dd:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8008e0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008e3:	e9 33 ff ff ff       	jmp    80081b <vprintfmt+0x75>
+            lflag++;
+  8008e8:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8008eb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008ee:	e9 28 ff ff ff       	jmp    80081b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8008f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f9:	77 19                	ja     800914 <vprintfmt+0x16e>
+  8008fb:	89 c2                	mov    %eax,%edx
+  8008fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800901:	83 c0 08             	add    $0x8,%eax
+  800904:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800907:	8b 3a                	mov    (%rdx),%edi
+  800909:	4c 89 ee             	mov    %r13,%rsi
+  80090c:	41 ff d6             	call   *%r14
+            break;
+  80090f:	e9 c3 fe ff ff       	jmp    8007d7 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800914:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800918:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800920:	eb e5                	jmp    800907 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800922:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800925:	83 f8 2f             	cmp    $0x2f,%eax
+  800928:	77 5a                	ja     800984 <vprintfmt+0x1de>
+  80092a:	89 c2                	mov    %eax,%edx
+  80092c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800930:	83 c0 08             	add    $0x8,%eax
+  800933:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800936:	8b 02                	mov    (%rdx),%eax
+  800938:	89 c1                	mov    %eax,%ecx
+  80093a:	f7 d9                	neg    %ecx
+  80093c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80093f:	83 f9 13             	cmp    $0x13,%ecx
+  800942:	7f 4e                	jg     800992 <vprintfmt+0x1ec>
+  800944:	48 63 c1             	movslq %ecx,%rax
+  800947:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  80094e:	00 00 00 
+  800951:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800955:	48 85 c0             	test   %rax,%rax
+  800958:	74 38                	je     800992 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80095a:	48 89 c1             	mov    %rax,%rcx
+  80095d:	48 ba 5d 57 80 00 00 	movabs $0x80575d,%rdx
+  800964:	00 00 00 
+  800967:	4c 89 ee             	mov    %r13,%rsi
+  80096a:	4c 89 f7             	mov    %r14,%rdi
+  80096d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800972:	49 b8 69 07 80 00 00 	movabs $0x800769,%r8
+  800979:	00 00 00 
+  80097c:	41 ff d0             	call   *%r8
+  80097f:	e9 53 fe ff ff       	jmp    8007d7 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800984:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800988:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800990:	eb a4                	jmp    800936 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800992:	48 ba ec 50 80 00 00 	movabs $0x8050ec,%rdx
+  800999:	00 00 00 
+  80099c:	4c 89 ee             	mov    %r13,%rsi
+  80099f:	4c 89 f7             	mov    %r14,%rdi
+  8009a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a7:	49 b8 69 07 80 00 00 	movabs $0x800769,%r8
+  8009ae:	00 00 00 
+  8009b1:	41 ff d0             	call   *%r8
+  8009b4:	e9 1e fe ff ff       	jmp    8007d7 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bf:	77 36                	ja     8009f7 <vprintfmt+0x251>
+  8009c1:	89 c2                	mov    %eax,%edx
+  8009c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c7:	83 c0 08             	add    $0x8,%eax
+  8009ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cd:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8009d0:	48 85 f6             	test   %rsi,%rsi
+  8009d3:	48 b8 e5 50 80 00 00 	movabs $0x8050e5,%rax
+  8009da:	00 00 00 
+  8009dd:	48 0f 45 c6          	cmovne %rsi,%rax
+  8009e1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8009e5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009e9:	7e 06                	jle    8009f1 <vprintfmt+0x24b>
+  8009eb:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8009ef:	75 14                	jne    800a05 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009f1:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8009f5:	eb 5b                	jmp    800a52 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8009f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a03:	eb c8                	jmp    8009cd <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a05:	49 63 f7             	movslq %r15d,%rsi
+  800a08:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a0c:	48 b8 ab 0f 80 00 00 	movabs $0x800fab,%rax
+  800a13:	00 00 00 
+  800a16:	ff d0                	call   *%rax
+  800a18:	48 89 c2             	mov    %rax,%rdx
+  800a1b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a1e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a20:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a23:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a26:	85 c0                	test   %eax,%eax
+  800a28:	7e c7                	jle    8009f1 <vprintfmt+0x24b>
+  800a2a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a2f:	4c 89 ee             	mov    %r13,%rsi
+  800a32:	44 89 e7             	mov    %r12d,%edi
+  800a35:	41 ff d6             	call   *%r14
+  800a38:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a3c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a42:	75 eb                	jne    800a2f <vprintfmt+0x289>
+  800a44:	eb ab                	jmp    8009f1 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a46:	0f b6 f8             	movzbl %al,%edi
+  800a49:	4c 89 ee             	mov    %r13,%rsi
+  800a4c:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800a4f:	4c 89 e2             	mov    %r12,%rdx
+  800a52:	45 85 ff             	test   %r15d,%r15d
+  800a55:	78 06                	js     800a5d <vprintfmt+0x2b7>
+  800a57:	41 83 ef 01          	sub    $0x1,%r15d
+  800a5b:	78 23                	js     800a80 <vprintfmt+0x2da>
+  800a5d:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800a61:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800a67:	84 c0                	test   %al,%al
+  800a69:	74 15                	je     800a80 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a6b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a6f:	74 d5                	je     800a46 <vprintfmt+0x2a0>
+  800a71:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a74:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a79:	80 fa 5e             	cmp    $0x5e,%dl
+  800a7c:	77 cb                	ja     800a49 <vprintfmt+0x2a3>
+  800a7e:	eb c6                	jmp    800a46 <vprintfmt+0x2a0>
+  800a80:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a83:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800a86:	01 f0                	add    %esi,%eax
+  800a88:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800a8a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a8e:	85 c0                	test   %eax,%eax
+  800a90:	0f 8e 41 fd ff ff    	jle    8007d7 <vprintfmt+0x31>
+  800a96:	4c 89 ee             	mov    %r13,%rsi
+  800a99:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a9e:	41 ff d6             	call   *%r14
+  800aa1:	41 83 ec 01          	sub    $0x1,%r12d
+  800aa5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800aa9:	75 eb                	jne    800a96 <vprintfmt+0x2f0>
+  800aab:	e9 27 fd ff ff       	jmp    8007d7 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab0:	40 84 f6             	test   %sil,%sil
+  800ab3:	75 26                	jne    800adb <vprintfmt+0x335>
+    switch (lflag) {
+  800ab5:	85 d2                	test   %edx,%edx
+  800ab7:	74 59                	je     800b12 <vprintfmt+0x36c>
+  800ab9:	83 fa 01             	cmp    $0x1,%edx
+  800abc:	74 7b                	je     800b39 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800abe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac4:	0f 87 96 00 00 00    	ja     800b60 <vprintfmt+0x3ba>
+  800aca:	89 c2                	mov    %eax,%edx
+  800acc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad0:	83 c0 08             	add    $0x8,%eax
+  800ad3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad6:	4c 8b 22             	mov    (%rdx),%r12
+  800ad9:	eb 17                	jmp    800af2 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800adb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ade:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae1:	77 21                	ja     800b04 <vprintfmt+0x35e>
+  800ae3:	89 c2                	mov    %eax,%edx
+  800ae5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae9:	83 c0 08             	add    $0x8,%eax
+  800aec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aef:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800af2:	4d 85 e4             	test   %r12,%r12
+  800af5:	78 7a                	js     800b71 <vprintfmt+0x3cb>
+            num = i;
+  800af7:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800afa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800aff:	e9 b5 02 00 00       	jmp    800db9 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800b04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b10:	eb dd                	jmp    800aef <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800b12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b15:	83 f8 2f             	cmp    $0x2f,%eax
+  800b18:	77 11                	ja     800b2b <vprintfmt+0x385>
+  800b1a:	89 c2                	mov    %eax,%edx
+  800b1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b20:	83 c0 08             	add    $0x8,%eax
+  800b23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b26:	4c 63 22             	movslq (%rdx),%r12
+  800b29:	eb c7                	jmp    800af2 <vprintfmt+0x34c>
+  800b2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b37:	eb ed                	jmp    800b26 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800b39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3f:	77 11                	ja     800b52 <vprintfmt+0x3ac>
+  800b41:	89 c2                	mov    %eax,%edx
+  800b43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b47:	83 c0 08             	add    $0x8,%eax
+  800b4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4d:	4c 8b 22             	mov    (%rdx),%r12
+  800b50:	eb a0                	jmp    800af2 <vprintfmt+0x34c>
+  800b52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5e:	eb ed                	jmp    800b4d <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800b60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6c:	e9 65 ff ff ff       	jmp    800ad6 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800b71:	4c 89 ee             	mov    %r13,%rsi
+  800b74:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b79:	41 ff d6             	call   *%r14
+                i = -i;
+  800b7c:	49 f7 dc             	neg    %r12
+  800b7f:	e9 73 ff ff ff       	jmp    800af7 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800b84:	40 84 f6             	test   %sil,%sil
+  800b87:	75 32                	jne    800bbb <vprintfmt+0x415>
+    switch (lflag) {
+  800b89:	85 d2                	test   %edx,%edx
+  800b8b:	74 5d                	je     800bea <vprintfmt+0x444>
+  800b8d:	83 fa 01             	cmp    $0x1,%edx
+  800b90:	0f 84 82 00 00 00    	je     800c18 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800b96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b99:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9c:	0f 87 a5 00 00 00    	ja     800c47 <vprintfmt+0x4a1>
+  800ba2:	89 c2                	mov    %eax,%edx
+  800ba4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba8:	83 c0 08             	add    $0x8,%eax
+  800bab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bae:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bb1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bb6:	e9 fe 01 00 00       	jmp    800db9 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800bbb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbe:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc1:	77 19                	ja     800bdc <vprintfmt+0x436>
+  800bc3:	89 c2                	mov    %eax,%edx
+  800bc5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc9:	83 c0 08             	add    $0x8,%eax
+  800bcc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bd2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bd7:	e9 dd 01 00 00       	jmp    800db9 <vprintfmt+0x613>
+  800bdc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be8:	eb e5                	jmp    800bcf <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800bea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bed:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf0:	77 18                	ja     800c0a <vprintfmt+0x464>
+  800bf2:	89 c2                	mov    %eax,%edx
+  800bf4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf8:	83 c0 08             	add    $0x8,%eax
+  800bfb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bfe:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c00:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c05:	e9 af 01 00 00       	jmp    800db9 <vprintfmt+0x613>
+  800c0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c16:	eb e6                	jmp    800bfe <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800c18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1e:	77 19                	ja     800c39 <vprintfmt+0x493>
+  800c20:	89 c2                	mov    %eax,%edx
+  800c22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c26:	83 c0 08             	add    $0x8,%eax
+  800c29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c2f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800c34:	e9 80 01 00 00       	jmp    800db9 <vprintfmt+0x613>
+  800c39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c45:	eb e5                	jmp    800c2c <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800c47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c53:	e9 56 ff ff ff       	jmp    800bae <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800c58:	40 84 f6             	test   %sil,%sil
+  800c5b:	75 2e                	jne    800c8b <vprintfmt+0x4e5>
+    switch (lflag) {
+  800c5d:	85 d2                	test   %edx,%edx
+  800c5f:	0f 84 b3 00 00 00    	je     800d18 <vprintfmt+0x572>
+  800c65:	83 fa 01             	cmp    $0x1,%edx
+  800c68:	0f 84 d3 00 00 00    	je     800d41 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800c6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c71:	83 f8 2f             	cmp    $0x2f,%eax
+  800c74:	0f 87 f1 00 00 00    	ja     800d6b <vprintfmt+0x5c5>
+  800c7a:	89 c2                	mov    %eax,%edx
+  800c7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c80:	83 c0 08             	add    $0x8,%eax
+  800c83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c86:	48 8b 02             	mov    (%rdx),%rax
+  800c89:	eb 17                	jmp    800ca2 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800c8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c91:	77 77                	ja     800d0a <vprintfmt+0x564>
+  800c93:	89 c2                	mov    %eax,%edx
+  800c95:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c99:	83 c0 08             	add    $0x8,%eax
+  800c9c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9f:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800ca2:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800ca4:	83 f8 07             	cmp    $0x7,%eax
+  800ca7:	0f 8e cf 00 00 00    	jle    800d7c <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800cad:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800cb3:	44 89 e7             	mov    %r12d,%edi
+  800cb6:	41 c1 e4 03          	shl    $0x3,%r12d
+  800cba:	89 d1                	mov    %edx,%ecx
+  800cbc:	8d 72 07             	lea    0x7(%rdx),%esi
+  800cbf:	85 d2                	test   %edx,%edx
+  800cc1:	0f 48 d6             	cmovs  %esi,%edx
+  800cc4:	c1 fa 03             	sar    $0x3,%edx
+  800cc7:	83 f9 3f             	cmp    $0x3f,%ecx
+  800cca:	7f e7                	jg     800cb3 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800ccc:	85 ff                	test   %edi,%edi
+  800cce:	0f 84 03 fb ff ff    	je     8007d7 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800cd4:	49 63 f4             	movslq %r12d,%rsi
+  800cd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cdc:	48 f7 f6             	div    %rsi
+  800cdf:	49 89 d7             	mov    %rdx,%r15
+  800ce2:	83 c0 30             	add    $0x30,%eax
+  800ce5:	0f be f8             	movsbl %al,%edi
+  800ce8:	4c 89 ee             	mov    %r13,%rsi
+  800ceb:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800cee:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800cf1:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800cf6:	45 85 e4             	test   %r12d,%r12d
+  800cf9:	41 0f 49 d4          	cmovns %r12d,%edx
+  800cfd:	c1 fa 03             	sar    $0x3,%edx
+  800d00:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800d03:	75 cf                	jne    800cd4 <vprintfmt+0x52e>
+  800d05:	e9 cd fa ff ff       	jmp    8007d7 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800d0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d16:	eb 87                	jmp    800c9f <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800d18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1e:	77 13                	ja     800d33 <vprintfmt+0x58d>
+  800d20:	89 c2                	mov    %eax,%edx
+  800d22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d26:	83 c0 08             	add    $0x8,%eax
+  800d29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d2c:	8b 02                	mov    (%rdx),%eax
+  800d2e:	e9 6f ff ff ff       	jmp    800ca2 <vprintfmt+0x4fc>
+  800d33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d3f:	eb eb                	jmp    800d2c <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800d41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d44:	83 f8 2f             	cmp    $0x2f,%eax
+  800d47:	77 14                	ja     800d5d <vprintfmt+0x5b7>
+  800d49:	89 c2                	mov    %eax,%edx
+  800d4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4f:	83 c0 08             	add    $0x8,%eax
+  800d52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d55:	48 8b 02             	mov    (%rdx),%rax
+  800d58:	e9 45 ff ff ff       	jmp    800ca2 <vprintfmt+0x4fc>
+  800d5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d69:	eb ea                	jmp    800d55 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800d6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d77:	e9 0a ff ff ff       	jmp    800c86 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800d7c:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800d82:	e9 4d ff ff ff       	jmp    800cd4 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800d87:	4c 89 ee             	mov    %r13,%rsi
+  800d8a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d8f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d92:	4c 89 ee             	mov    %r13,%rsi
+  800d95:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d9a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800d9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da0:	83 f8 2f             	cmp    $0x2f,%eax
+  800da3:	77 47                	ja     800dec <vprintfmt+0x646>
+  800da5:	89 c2                	mov    %eax,%edx
+  800da7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dab:	83 c0 08             	add    $0x8,%eax
+  800dae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800db4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800db9:	48 83 ec 08          	sub    $0x8,%rsp
+  800dbd:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800dc1:	0f 94 c0             	sete   %al
+  800dc4:	0f b6 c0             	movzbl %al,%eax
+  800dc7:	50                   	push   %rax
+  800dc8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800dcd:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800dd1:	4c 89 ee             	mov    %r13,%rsi
+  800dd4:	4c 89 f7             	mov    %r14,%rdi
+  800dd7:	48 b8 9b 06 80 00 00 	movabs $0x80069b,%rax
+  800dde:	00 00 00 
+  800de1:	ff d0                	call   *%rax
+            break;
+  800de3:	48 83 c4 10          	add    $0x10,%rsp
+  800de7:	e9 eb f9 ff ff       	jmp    8007d7 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800dec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800df0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800df4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800df8:	eb b7                	jmp    800db1 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800dfa:	40 84 f6             	test   %sil,%sil
+  800dfd:	75 2b                	jne    800e2a <vprintfmt+0x684>
+    switch (lflag) {
+  800dff:	85 d2                	test   %edx,%edx
+  800e01:	74 56                	je     800e59 <vprintfmt+0x6b3>
+  800e03:	83 fa 01             	cmp    $0x1,%edx
+  800e06:	74 7f                	je     800e87 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800e08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800e0e:	0f 87 a2 00 00 00    	ja     800eb6 <vprintfmt+0x710>
+  800e14:	89 c2                	mov    %eax,%edx
+  800e16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e1a:	83 c0 08             	add    $0x8,%eax
+  800e1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e20:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e23:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e28:	eb 8f                	jmp    800db9 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800e2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e30:	77 19                	ja     800e4b <vprintfmt+0x6a5>
+  800e32:	89 c2                	mov    %eax,%edx
+  800e34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e38:	83 c0 08             	add    $0x8,%eax
+  800e3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e3e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e41:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e46:	e9 6e ff ff ff       	jmp    800db9 <vprintfmt+0x613>
+  800e4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e57:	eb e5                	jmp    800e3e <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800e59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e5f:	77 18                	ja     800e79 <vprintfmt+0x6d3>
+  800e61:	89 c2                	mov    %eax,%edx
+  800e63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e67:	83 c0 08             	add    $0x8,%eax
+  800e6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e6d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e6f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e74:	e9 40 ff ff ff       	jmp    800db9 <vprintfmt+0x613>
+  800e79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e85:	eb e6                	jmp    800e6d <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800e87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e8d:	77 19                	ja     800ea8 <vprintfmt+0x702>
+  800e8f:	89 c2                	mov    %eax,%edx
+  800e91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e95:	83 c0 08             	add    $0x8,%eax
+  800e98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e9b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e9e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ea3:	e9 11 ff ff ff       	jmp    800db9 <vprintfmt+0x613>
+  800ea8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eb4:	eb e5                	jmp    800e9b <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800eb6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ebe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ec2:	e9 59 ff ff ff       	jmp    800e20 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800ec7:	4c 89 ee             	mov    %r13,%rsi
+  800eca:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ecf:	41 ff d6             	call   *%r14
+            break;
+  800ed2:	e9 00 f9 ff ff       	jmp    8007d7 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ed7:	4c 89 ee             	mov    %r13,%rsi
+  800eda:	bf 25 00 00 00       	mov    $0x25,%edi
+  800edf:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ee2:	48 83 eb 01          	sub    $0x1,%rbx
+  800ee6:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800eea:	75 f6                	jne    800ee2 <vprintfmt+0x73c>
+  800eec:	e9 e6 f8 ff ff       	jmp    8007d7 <vprintfmt+0x31>
+}
+  800ef1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ef5:	5b                   	pop    %rbx
+  800ef6:	41 5c                	pop    %r12
+  800ef8:	41 5d                	pop    %r13
+  800efa:	41 5e                	pop    %r14
+  800efc:	41 5f                	pop    %r15
+  800efe:	5d                   	pop    %rbp
+  800eff:	c3                   	ret
+
+0000000000800f00 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800f00:	55                   	push   %rbp
+  800f01:	48 89 e5             	mov    %rsp,%rbp
+  800f04:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800f08:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f0c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800f11:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800f15:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800f1c:	48 85 ff             	test   %rdi,%rdi
+  800f1f:	74 2b                	je     800f4c <vsnprintf+0x4c>
+  800f21:	48 85 f6             	test   %rsi,%rsi
+  800f24:	74 26                	je     800f4c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800f26:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f2a:	48 bf 51 07 80 00 00 	movabs $0x800751,%rdi
+  800f31:	00 00 00 
+  800f34:	48 b8 a6 07 80 00 00 	movabs $0x8007a6,%rax
+  800f3b:	00 00 00 
+  800f3e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800f40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f44:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800f47:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f4a:	c9                   	leave
+  800f4b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f51:	eb f7                	jmp    800f4a <vsnprintf+0x4a>
+
+0000000000800f53 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f53:	55                   	push   %rbp
+  800f54:	48 89 e5             	mov    %rsp,%rbp
+  800f57:	48 83 ec 50          	sub    $0x50,%rsp
+  800f5b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f5f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f63:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f67:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f6e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f76:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f7a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f7e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f82:	48 b8 00 0f 80 00 00 	movabs $0x800f00,%rax
+  800f89:	00 00 00 
+  800f8c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f8e:	c9                   	leave
+  800f8f:	c3                   	ret
+
+0000000000800f90 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f90:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f93:	74 10                	je     800fa5 <strlen+0x15>
+    size_t n = 0;
+  800f95:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800f9a:	48 83 c0 01          	add    $0x1,%rax
+  800f9e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800fa2:	75 f6                	jne    800f9a <strlen+0xa>
+  800fa4:	c3                   	ret
+    size_t n = 0;
+  800fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800faa:	c3                   	ret
+
+0000000000800fab <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800fab:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800fae:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800fb3:	48 85 f6             	test   %rsi,%rsi
+  800fb6:	74 11                	je     800fc9 <strnlen+0x1e>
+  800fb8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800fbc:	74 0c                	je     800fca <strnlen+0x1f>
+  800fbe:	48 83 c2 01          	add    $0x1,%rdx
+  800fc2:	48 39 d0             	cmp    %rdx,%rax
+  800fc5:	75 f1                	jne    800fb8 <strnlen+0xd>
+  800fc7:	eb 04                	jmp    800fcd <strnlen+0x22>
+  800fc9:	c3                   	ret
+  800fca:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800fcd:	c3                   	ret
+
+0000000000800fce <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800fce:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800fd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fda:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800fdd:	48 83 c2 01          	add    $0x1,%rdx
+  800fe1:	84 c9                	test   %cl,%cl
+  800fe3:	75 f1                	jne    800fd6 <strcpy+0x8>
+        ;
+    return res;
+}
+  800fe5:	c3                   	ret
+
+0000000000800fe6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800fe6:	55                   	push   %rbp
+  800fe7:	48 89 e5             	mov    %rsp,%rbp
+  800fea:	41 54                	push   %r12
+  800fec:	53                   	push   %rbx
+  800fed:	48 89 fb             	mov    %rdi,%rbx
+  800ff0:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ff3:	48 b8 90 0f 80 00 00 	movabs $0x800f90,%rax
+  800ffa:	00 00 00 
+  800ffd:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800fff:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801003:	4c 89 e6             	mov    %r12,%rsi
+  801006:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  80100d:	00 00 00 
+  801010:	ff d0                	call   *%rax
+    return dst;
+}
+  801012:	48 89 d8             	mov    %rbx,%rax
+  801015:	5b                   	pop    %rbx
+  801016:	41 5c                	pop    %r12
+  801018:	5d                   	pop    %rbp
+  801019:	c3                   	ret
+
+000000000080101a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80101a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80101d:	48 85 d2             	test   %rdx,%rdx
+  801020:	74 1f                	je     801041 <strncpy+0x27>
+  801022:	48 01 fa             	add    %rdi,%rdx
+  801025:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801028:	48 83 c1 01          	add    $0x1,%rcx
+  80102c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801030:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801034:	41 80 f8 01          	cmp    $0x1,%r8b
+  801038:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80103c:	48 39 ca             	cmp    %rcx,%rdx
+  80103f:	75 e7                	jne    801028 <strncpy+0xe>
+    }
+    return ret;
+}
+  801041:	c3                   	ret
+
+0000000000801042 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801042:	48 89 f8             	mov    %rdi,%rax
+  801045:	48 85 d2             	test   %rdx,%rdx
+  801048:	74 24                	je     80106e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80104a:	48 83 ea 01          	sub    $0x1,%rdx
+  80104e:	74 1b                	je     80106b <strlcpy+0x29>
+  801050:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801054:	0f b6 16             	movzbl (%rsi),%edx
+  801057:	84 d2                	test   %dl,%dl
+  801059:	74 10                	je     80106b <strlcpy+0x29>
+            *dst++ = *src++;
+  80105b:	48 83 c6 01          	add    $0x1,%rsi
+  80105f:	48 83 c0 01          	add    $0x1,%rax
+  801063:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801066:	48 39 c8             	cmp    %rcx,%rax
+  801069:	75 e9                	jne    801054 <strlcpy+0x12>
+        *dst = '\0';
+  80106b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80106e:	48 29 f8             	sub    %rdi,%rax
+}
+  801071:	c3                   	ret
+
+0000000000801072 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801072:	0f b6 07             	movzbl (%rdi),%eax
+  801075:	84 c0                	test   %al,%al
+  801077:	74 13                	je     80108c <strcmp+0x1a>
+  801079:	38 06                	cmp    %al,(%rsi)
+  80107b:	75 0f                	jne    80108c <strcmp+0x1a>
+  80107d:	48 83 c7 01          	add    $0x1,%rdi
+  801081:	48 83 c6 01          	add    $0x1,%rsi
+  801085:	0f b6 07             	movzbl (%rdi),%eax
+  801088:	84 c0                	test   %al,%al
+  80108a:	75 ed                	jne    801079 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80108c:	0f b6 c0             	movzbl %al,%eax
+  80108f:	0f b6 16             	movzbl (%rsi),%edx
+  801092:	29 d0                	sub    %edx,%eax
+}
+  801094:	c3                   	ret
+
+0000000000801095 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801095:	48 85 d2             	test   %rdx,%rdx
+  801098:	74 1f                	je     8010b9 <strncmp+0x24>
+  80109a:	0f b6 07             	movzbl (%rdi),%eax
+  80109d:	84 c0                	test   %al,%al
+  80109f:	74 1e                	je     8010bf <strncmp+0x2a>
+  8010a1:	3a 06                	cmp    (%rsi),%al
+  8010a3:	75 1a                	jne    8010bf <strncmp+0x2a>
+  8010a5:	48 83 c7 01          	add    $0x1,%rdi
+  8010a9:	48 83 c6 01          	add    $0x1,%rsi
+  8010ad:	48 83 ea 01          	sub    $0x1,%rdx
+  8010b1:	75 e7                	jne    80109a <strncmp+0x5>
+
+    if (!n) return 0;
+  8010b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b8:	c3                   	ret
+  8010b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010be:	c3                   	ret
+  8010bf:	48 85 d2             	test   %rdx,%rdx
+  8010c2:	74 09                	je     8010cd <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010c4:	0f b6 07             	movzbl (%rdi),%eax
+  8010c7:	0f b6 16             	movzbl (%rsi),%edx
+  8010ca:	29 d0                	sub    %edx,%eax
+  8010cc:	c3                   	ret
+    if (!n) return 0;
+  8010cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010d2:	c3                   	ret
+
+00000000008010d3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8010d3:	0f b6 17             	movzbl (%rdi),%edx
+  8010d6:	84 d2                	test   %dl,%dl
+  8010d8:	74 18                	je     8010f2 <strchr+0x1f>
+        if (*str == c) {
+  8010da:	0f be d2             	movsbl %dl,%edx
+  8010dd:	39 f2                	cmp    %esi,%edx
+  8010df:	74 17                	je     8010f8 <strchr+0x25>
+    for (; *str; str++) {
+  8010e1:	48 83 c7 01          	add    $0x1,%rdi
+  8010e5:	0f b6 17             	movzbl (%rdi),%edx
+  8010e8:	84 d2                	test   %dl,%dl
+  8010ea:	75 ee                	jne    8010da <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8010ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f1:	c3                   	ret
+  8010f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f7:	c3                   	ret
+  8010f8:	48 89 f8             	mov    %rdi,%rax
+}
+  8010fb:	c3                   	ret
+
+00000000008010fc <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8010fc:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8010ff:	0f b6 17             	movzbl (%rdi),%edx
+  801102:	84 d2                	test   %dl,%dl
+  801104:	74 13                	je     801119 <strfind+0x1d>
+  801106:	0f be d2             	movsbl %dl,%edx
+  801109:	39 f2                	cmp    %esi,%edx
+  80110b:	74 0b                	je     801118 <strfind+0x1c>
+  80110d:	48 83 c0 01          	add    $0x1,%rax
+  801111:	0f b6 10             	movzbl (%rax),%edx
+  801114:	84 d2                	test   %dl,%dl
+  801116:	75 ee                	jne    801106 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801118:	c3                   	ret
+  801119:	c3                   	ret
+
+000000000080111a <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  80111a:	55                   	push   %rbp
+  80111b:	48 89 e5             	mov    %rsp,%rbp
+  80111e:	41 57                	push   %r15
+  801120:	41 56                	push   %r14
+  801122:	41 55                	push   %r13
+  801124:	41 54                	push   %r12
+  801126:	53                   	push   %rbx
+  801127:	48 83 ec 08          	sub    $0x8,%rsp
+  80112b:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  80112e:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  801132:	45 84 ed             	test   %r13b,%r13b
+  801135:	75 12                	jne    801149 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  801137:	4c 89 f8             	mov    %r15,%rax
+  80113a:	48 83 c4 08          	add    $0x8,%rsp
+  80113e:	5b                   	pop    %rbx
+  80113f:	41 5c                	pop    %r12
+  801141:	41 5d                	pop    %r13
+  801143:	41 5e                	pop    %r14
+  801145:	41 5f                	pop    %r15
+  801147:	5d                   	pop    %rbp
+  801148:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  801149:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  80114d:	4c 89 e7             	mov    %r12,%rdi
+  801150:	48 b8 90 0f 80 00 00 	movabs $0x800f90,%rax
+  801157:	00 00 00 
+  80115a:	ff d0                	call   *%rax
+  80115c:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  80115f:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  801163:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  801167:	49 bf 95 10 80 00 00 	movabs $0x801095,%r15
+  80116e:	00 00 00 
+				if ((sc = *s++) == 0)
+  801171:	84 c0                	test   %al,%al
+  801173:	75 14                	jne    801189 <strstr+0x6f>
+					return NULL;
+  801175:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80117b:	eb ba                	jmp    801137 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  80117d:	48 83 c3 01          	add    $0x1,%rbx
+  801181:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  801185:	84 c0                	test   %al,%al
+  801187:	74 1b                	je     8011a4 <strstr+0x8a>
+			} while (sc != c);
+  801189:	41 38 c5             	cmp    %al,%r13b
+  80118c:	75 ef                	jne    80117d <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  80118e:	4c 89 f2             	mov    %r14,%rdx
+  801191:	4c 89 e6             	mov    %r12,%rsi
+  801194:	48 89 df             	mov    %rbx,%rdi
+  801197:	41 ff d7             	call   *%r15
+  80119a:	85 c0                	test   %eax,%eax
+  80119c:	75 df                	jne    80117d <strstr+0x63>
+  80119e:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  8011a2:	eb 93                	jmp    801137 <strstr+0x1d>
+					return NULL;
+  8011a4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8011aa:	eb 8b                	jmp    801137 <strstr+0x1d>
+
+00000000008011ac <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  8011ac:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  8011ae:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  8011b1:	8d 57 20             	lea    0x20(%rdi),%edx
+  8011b4:	83 f9 1a             	cmp    $0x1a,%ecx
+  8011b7:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8011ba:	c3                   	ret
+
+00000000008011bb <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  8011bb:	55                   	push   %rbp
+  8011bc:	48 89 e5             	mov    %rsp,%rbp
+  8011bf:	41 57                	push   %r15
+  8011c1:	41 56                	push   %r14
+  8011c3:	41 55                	push   %r13
+  8011c5:	41 54                	push   %r12
+  8011c7:	53                   	push   %rbx
+  8011c8:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  8011cc:	48 39 f7             	cmp    %rsi,%rdi
+  8011cf:	74 49                	je     80121a <strcasecmp+0x5f>
+  8011d1:	49 89 fd             	mov    %rdi,%r13
+  8011d4:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  8011d7:	49 bf ac 11 80 00 00 	movabs $0x8011ac,%r15
+  8011de:	00 00 00 
+  8011e1:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  8011e6:	41 0f b6 fe          	movzbl %r14b,%edi
+  8011ea:	41 ff d7             	call   *%r15
+  8011ed:	89 c3                	mov    %eax,%ebx
+  8011ef:	49 83 c4 01          	add    $0x1,%r12
+  8011f3:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8011f9:	41 ff d7             	call   *%r15
+  8011fc:	29 c3                	sub    %eax,%ebx
+  8011fe:	75 09                	jne    801209 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  801200:	49 83 c5 01          	add    $0x1,%r13
+  801204:	45 84 f6             	test   %r14b,%r14b
+  801207:	75 d8                	jne    8011e1 <strcasecmp+0x26>
+}
+  801209:	89 d8                	mov    %ebx,%eax
+  80120b:	48 83 c4 08          	add    $0x8,%rsp
+  80120f:	5b                   	pop    %rbx
+  801210:	41 5c                	pop    %r12
+  801212:	41 5d                	pop    %r13
+  801214:	41 5e                	pop    %r14
+  801216:	41 5f                	pop    %r15
+  801218:	5d                   	pop    %rbp
+  801219:	c3                   	ret
+        return 0;
+  80121a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121f:	eb e8                	jmp    801209 <strcasecmp+0x4e>
+
+0000000000801221 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  801221:	55                   	push   %rbp
+  801222:	48 89 e5             	mov    %rsp,%rbp
+  801225:	41 57                	push   %r15
+  801227:	41 56                	push   %r14
+  801229:	41 55                	push   %r13
+  80122b:	41 54                	push   %r12
+  80122d:	53                   	push   %rbx
+  80122e:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  801232:	48 85 d2             	test   %rdx,%rdx
+  801235:	74 4f                	je     801286 <strncasecmp+0x65>
+  801237:	49 89 fc             	mov    %rdi,%r12
+  80123a:	49 89 f5             	mov    %rsi,%r13
+  80123d:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  801241:	49 be ac 11 80 00 00 	movabs $0x8011ac,%r14
+  801248:	00 00 00 
+  80124b:	49 83 c4 01          	add    $0x1,%r12
+  80124f:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801255:	41 ff d6             	call   *%r14
+  801258:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  80125a:	49 83 c5 01          	add    $0x1,%r13
+  80125e:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801263:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801266:	29 c3                	sub    %eax,%ebx
+  801268:	85 c0                	test   %eax,%eax
+  80126a:	74 09                	je     801275 <strncasecmp+0x54>
+  80126c:	85 db                	test   %ebx,%ebx
+  80126e:	75 05                	jne    801275 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  801270:	4d 39 fc             	cmp    %r15,%r12
+  801273:	75 d6                	jne    80124b <strncasecmp+0x2a>
+}
+  801275:	89 d8                	mov    %ebx,%eax
+  801277:	48 83 c4 08          	add    $0x8,%rsp
+  80127b:	5b                   	pop    %rbx
+  80127c:	41 5c                	pop    %r12
+  80127e:	41 5d                	pop    %r13
+  801280:	41 5e                	pop    %r14
+  801282:	41 5f                	pop    %r15
+  801284:	5d                   	pop    %rbp
+  801285:	c3                   	ret
+    int d = 0;
+  801286:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  80128b:	eb e8                	jmp    801275 <strncasecmp+0x54>
+
+000000000080128d <toupper>:
+
+int toupper(int c) {
+  80128d:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  80128f:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801292:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801295:	83 f9 1a             	cmp    $0x1a,%ecx
+  801298:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80129b:	c3                   	ret
+
+000000000080129c <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  80129c:	83 ff 20             	cmp    $0x20,%edi
+  80129f:	0f 94 c0             	sete   %al
+  8012a2:	0f b6 c0             	movzbl %al,%eax
+}
+  8012a5:	c3                   	ret
+
+00000000008012a6 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  8012a6:	89 f8                	mov    %edi,%eax
+  8012a8:	f7 d8                	neg    %eax
+  8012aa:	0f 48 c7             	cmovs  %edi,%eax
+}
+  8012ad:	c3                   	ret
+
+00000000008012ae <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8012ae:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8012b1:	48 89 f8             	mov    %rdi,%rax
+  8012b4:	48 f7 d8             	neg    %rax
+  8012b7:	83 e0 07             	and    $0x7,%eax
+  8012ba:	49 89 d1             	mov    %rdx,%r9
+  8012bd:	49 29 c1             	sub    %rax,%r9
+  8012c0:	78 36                	js     8012f8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8012c2:	40 0f b6 c6          	movzbl %sil,%eax
+  8012c6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8012cd:	01 01 01 
+  8012d0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8012d4:	40 f6 c7 07          	test   $0x7,%dil
+  8012d8:	75 38                	jne    801312 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8012da:	4c 89 c9             	mov    %r9,%rcx
+  8012dd:	48 c1 f9 03          	sar    $0x3,%rcx
+  8012e1:	74 0c                	je     8012ef <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8012e3:	fc                   	cld
+  8012e4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8012e7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8012eb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8012ef:	4d 85 c9             	test   %r9,%r9
+  8012f2:	75 45                	jne    801339 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8012f4:	4c 89 c0             	mov    %r8,%rax
+  8012f7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8012f8:	48 85 d2             	test   %rdx,%rdx
+  8012fb:	74 f7                	je     8012f4 <memset+0x46>
+  8012fd:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801300:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801303:	48 83 c0 01          	add    $0x1,%rax
+  801307:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80130b:	48 39 c2             	cmp    %rax,%rdx
+  80130e:	75 f3                	jne    801303 <memset+0x55>
+  801310:	eb e2                	jmp    8012f4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801312:	40 f6 c7 01          	test   $0x1,%dil
+  801316:	74 06                	je     80131e <memset+0x70>
+  801318:	88 07                	mov    %al,(%rdi)
+  80131a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80131e:	40 f6 c7 02          	test   $0x2,%dil
+  801322:	74 07                	je     80132b <memset+0x7d>
+  801324:	66 89 07             	mov    %ax,(%rdi)
+  801327:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80132b:	40 f6 c7 04          	test   $0x4,%dil
+  80132f:	74 a9                	je     8012da <memset+0x2c>
+  801331:	89 07                	mov    %eax,(%rdi)
+  801333:	48 83 c7 04          	add    $0x4,%rdi
+  801337:	eb a1                	jmp    8012da <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801339:	41 f6 c1 04          	test   $0x4,%r9b
+  80133d:	74 06                	je     801345 <memset+0x97>
+  80133f:	89 07                	mov    %eax,(%rdi)
+  801341:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801345:	41 f6 c1 02          	test   $0x2,%r9b
+  801349:	74 07                	je     801352 <memset+0xa4>
+  80134b:	66 89 07             	mov    %ax,(%rdi)
+  80134e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801352:	41 f6 c1 01          	test   $0x1,%r9b
+  801356:	74 9c                	je     8012f4 <memset+0x46>
+  801358:	88 07                	mov    %al,(%rdi)
+  80135a:	eb 98                	jmp    8012f4 <memset+0x46>
+
+000000000080135c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80135c:	48 89 f8             	mov    %rdi,%rax
+  80135f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801362:	48 39 fe             	cmp    %rdi,%rsi
+  801365:	73 3b                	jae    8013a2 <memmove+0x46>
+  801367:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80136b:	48 39 d7             	cmp    %rdx,%rdi
+  80136e:	73 32                	jae    8013a2 <memmove+0x46>
+        s += n;
+        d += n;
+  801370:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801374:	48 89 d6             	mov    %rdx,%rsi
+  801377:	48 09 fe             	or     %rdi,%rsi
+  80137a:	48 09 ce             	or     %rcx,%rsi
+  80137d:	40 f6 c6 07          	test   $0x7,%sil
+  801381:	75 12                	jne    801395 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801383:	48 83 ef 08          	sub    $0x8,%rdi
+  801387:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80138b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80138f:	fd                   	std
+  801390:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801393:	fc                   	cld
+  801394:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801395:	48 83 ef 01          	sub    $0x1,%rdi
+  801399:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80139d:	fd                   	std
+  80139e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8013a0:	eb f1                	jmp    801393 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8013a2:	48 89 f2             	mov    %rsi,%rdx
+  8013a5:	48 09 c2             	or     %rax,%rdx
+  8013a8:	48 09 ca             	or     %rcx,%rdx
+  8013ab:	f6 c2 07             	test   $0x7,%dl
+  8013ae:	75 0c                	jne    8013bc <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8013b0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8013b4:	48 89 c7             	mov    %rax,%rdi
+  8013b7:	fc                   	cld
+  8013b8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8013bb:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8013bc:	48 89 c7             	mov    %rax,%rdi
+  8013bf:	fc                   	cld
+  8013c0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8013c2:	c3                   	ret
+
+00000000008013c3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8013c3:	55                   	push   %rbp
+  8013c4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8013c7:	48 b8 5c 13 80 00 00 	movabs $0x80135c,%rax
+  8013ce:	00 00 00 
+  8013d1:	ff d0                	call   *%rax
+}
+  8013d3:	5d                   	pop    %rbp
+  8013d4:	c3                   	ret
+
+00000000008013d5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8013d5:	55                   	push   %rbp
+  8013d6:	48 89 e5             	mov    %rsp,%rbp
+  8013d9:	41 57                	push   %r15
+  8013db:	41 56                	push   %r14
+  8013dd:	41 55                	push   %r13
+  8013df:	41 54                	push   %r12
+  8013e1:	53                   	push   %rbx
+  8013e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013e6:	49 89 fe             	mov    %rdi,%r14
+  8013e9:	49 89 f7             	mov    %rsi,%r15
+  8013ec:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8013ef:	48 89 f7             	mov    %rsi,%rdi
+  8013f2:	48 b8 90 0f 80 00 00 	movabs $0x800f90,%rax
+  8013f9:	00 00 00 
+  8013fc:	ff d0                	call   *%rax
+  8013fe:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801401:	48 89 de             	mov    %rbx,%rsi
+  801404:	4c 89 f7             	mov    %r14,%rdi
+  801407:	48 b8 ab 0f 80 00 00 	movabs $0x800fab,%rax
+  80140e:	00 00 00 
+  801411:	ff d0                	call   *%rax
+  801413:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801416:	48 39 c3             	cmp    %rax,%rbx
+  801419:	74 36                	je     801451 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80141b:	48 89 d8             	mov    %rbx,%rax
+  80141e:	4c 29 e8             	sub    %r13,%rax
+  801421:	49 39 c4             	cmp    %rax,%r12
+  801424:	73 31                	jae    801457 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801426:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80142b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80142f:	4c 89 fe             	mov    %r15,%rsi
+  801432:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  801439:	00 00 00 
+  80143c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80143e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801442:	48 83 c4 08          	add    $0x8,%rsp
+  801446:	5b                   	pop    %rbx
+  801447:	41 5c                	pop    %r12
+  801449:	41 5d                	pop    %r13
+  80144b:	41 5e                	pop    %r14
+  80144d:	41 5f                	pop    %r15
+  80144f:	5d                   	pop    %rbp
+  801450:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801451:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801455:	eb eb                	jmp    801442 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801457:	48 83 eb 01          	sub    $0x1,%rbx
+  80145b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80145f:	48 89 da             	mov    %rbx,%rdx
+  801462:	4c 89 fe             	mov    %r15,%rsi
+  801465:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  80146c:	00 00 00 
+  80146f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801471:	49 01 de             	add    %rbx,%r14
+  801474:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801479:	eb c3                	jmp    80143e <strlcat+0x69>
+
+000000000080147b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80147b:	48 85 d2             	test   %rdx,%rdx
+  80147e:	74 2d                	je     8014ad <memcmp+0x32>
+  801480:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801485:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801489:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80148e:	44 38 c1             	cmp    %r8b,%cl
+  801491:	75 0f                	jne    8014a2 <memcmp+0x27>
+    while (n-- > 0) {
+  801493:	48 83 c0 01          	add    $0x1,%rax
+  801497:	48 39 c2             	cmp    %rax,%rdx
+  80149a:	75 e9                	jne    801485 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80149c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a1:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8014a2:	0f b6 c1             	movzbl %cl,%eax
+  8014a5:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8014a9:	44 29 c0             	sub    %r8d,%eax
+  8014ac:	c3                   	ret
+    return 0;
+  8014ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014b2:	c3                   	ret
+
+00000000008014b3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8014b3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8014b7:	48 39 c7             	cmp    %rax,%rdi
+  8014ba:	73 0f                	jae    8014cb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8014bc:	40 38 37             	cmp    %sil,(%rdi)
+  8014bf:	74 0e                	je     8014cf <memfind+0x1c>
+    for (; src < end; src++) {
+  8014c1:	48 83 c7 01          	add    $0x1,%rdi
+  8014c5:	48 39 f8             	cmp    %rdi,%rax
+  8014c8:	75 f2                	jne    8014bc <memfind+0x9>
+  8014ca:	c3                   	ret
+  8014cb:	48 89 f8             	mov    %rdi,%rax
+  8014ce:	c3                   	ret
+  8014cf:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8014d2:	c3                   	ret
+
+00000000008014d3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8014d3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8014d6:	0f b6 37             	movzbl (%rdi),%esi
+  8014d9:	40 80 fe 20          	cmp    $0x20,%sil
+  8014dd:	74 06                	je     8014e5 <strtol+0x12>
+  8014df:	40 80 fe 09          	cmp    $0x9,%sil
+  8014e3:	75 13                	jne    8014f8 <strtol+0x25>
+  8014e5:	48 83 c7 01          	add    $0x1,%rdi
+  8014e9:	0f b6 37             	movzbl (%rdi),%esi
+  8014ec:	40 80 fe 20          	cmp    $0x20,%sil
+  8014f0:	74 f3                	je     8014e5 <strtol+0x12>
+  8014f2:	40 80 fe 09          	cmp    $0x9,%sil
+  8014f6:	74 ed                	je     8014e5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8014f8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8014fb:	83 e0 fd             	and    $0xfffffffd,%eax
+  8014fe:	3c 01                	cmp    $0x1,%al
+  801500:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801504:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80150a:	75 0f                	jne    80151b <strtol+0x48>
+  80150c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80150f:	74 14                	je     801525 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801511:	85 d2                	test   %edx,%edx
+  801513:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801518:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80151b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801520:	4c 63 ca             	movslq %edx,%r9
+  801523:	eb 36                	jmp    80155b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801525:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801529:	74 0f                	je     80153a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80152b:	85 d2                	test   %edx,%edx
+  80152d:	75 ec                	jne    80151b <strtol+0x48>
+        s++;
+  80152f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801533:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801538:	eb e1                	jmp    80151b <strtol+0x48>
+        s += 2;
+  80153a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80153e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801543:	eb d6                	jmp    80151b <strtol+0x48>
+            dig -= '0';
+  801545:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801548:	44 0f b6 c1          	movzbl %cl,%r8d
+  80154c:	41 39 d0             	cmp    %edx,%r8d
+  80154f:	7d 21                	jge    801572 <strtol+0x9f>
+        val = val * base + dig;
+  801551:	49 0f af c1          	imul   %r9,%rax
+  801555:	0f b6 c9             	movzbl %cl,%ecx
+  801558:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80155b:	48 83 c7 01          	add    $0x1,%rdi
+  80155f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801563:	80 f9 39             	cmp    $0x39,%cl
+  801566:	76 dd                	jbe    801545 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801568:	80 f9 7b             	cmp    $0x7b,%cl
+  80156b:	77 05                	ja     801572 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80156d:	83 e9 57             	sub    $0x57,%ecx
+  801570:	eb d6                	jmp    801548 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801572:	4d 85 d2             	test   %r10,%r10
+  801575:	74 03                	je     80157a <strtol+0xa7>
+  801577:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80157a:	48 89 c2             	mov    %rax,%rdx
+  80157d:	48 f7 da             	neg    %rdx
+  801580:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801584:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801588:	c3                   	ret
+
+0000000000801589 <atoi>:
+int atoi(const char *str) {
+  801589:	55                   	push   %rbp
+  80158a:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  80158d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801592:	be 00 00 00 00       	mov    $0x0,%esi
+  801597:	48 b8 d3 14 80 00 00 	movabs $0x8014d3,%rax
+  80159e:	00 00 00 
+  8015a1:	ff d0                	call   *%rax
+}
+  8015a3:	5d                   	pop    %rbp
+  8015a4:	c3                   	ret
+
+00000000008015a5 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8015a5:	55                   	push   %rbp
+  8015a6:	48 89 e5             	mov    %rsp,%rbp
+  8015a9:	53                   	push   %rbx
+  8015aa:	48 89 fa             	mov    %rdi,%rdx
+  8015ad:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b0:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ca:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8015cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d0:	c9                   	leave
+  8015d1:	c3                   	ret
+
+00000000008015d2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8015d2:	55                   	push   %rbp
+  8015d3:	48 89 e5             	mov    %rsp,%rbp
+  8015d6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801601:	c9                   	leave
+  801602:	c3                   	ret
+
+0000000000801603 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801603:	55                   	push   %rbp
+  801604:	48 89 e5             	mov    %rsp,%rbp
+  801607:	53                   	push   %rbx
+  801608:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80160c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80160f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801614:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801619:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801623:	be 00 00 00 00       	mov    $0x0,%esi
+  801628:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801630:	48 85 c0             	test   %rax,%rax
+  801633:	7f 06                	jg     80163b <sys_env_destroy+0x38>
+}
+  801635:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801639:	c9                   	leave
+  80163a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163b:	49 89 c0             	mov    %rax,%r8
+  80163e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801643:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  80164a:	00 00 00 
+  80164d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801652:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  801659:	00 00 00 
+  80165c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801661:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  801668:	00 00 00 
+  80166b:	41 ff d1             	call   *%r9
+
+000000000080166e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+  801672:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801673:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801678:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801682:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801687:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168c:	be 00 00 00 00       	mov    $0x0,%esi
+  801691:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801697:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801699:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169d:	c9                   	leave
+  80169e:	c3                   	ret
+
+000000000080169f <sys_yield>:
+
+void
+sys_yield(void) {
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+  8016a3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c8:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ce:	c9                   	leave
+  8016cf:	c3                   	ret
+
+00000000008016d0 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	53                   	push   %rbx
+  8016d5:	48 89 fa             	mov    %rdi,%rdx
+  8016d8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016db:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8016e7:	00 00 00 
+  8016ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016fa:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8016fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801700:	c9                   	leave
+  801701:	c3                   	ret
+
+0000000000801702 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801702:	55                   	push   %rbp
+  801703:	48 89 e5             	mov    %rsp,%rbp
+  801706:	53                   	push   %rbx
+  801707:	49 89 f8             	mov    %rdi,%r8
+  80170a:	48 89 d3             	mov    %rdx,%rbx
+  80170d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801710:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801715:	4c 89 c2             	mov    %r8,%rdx
+  801718:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171b:	be 00 00 00 00       	mov    $0x0,%esi
+  801720:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801726:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801728:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80172c:	c9                   	leave
+  80172d:	c3                   	ret
+
+000000000080172e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80172e:	55                   	push   %rbp
+  80172f:	48 89 e5             	mov    %rsp,%rbp
+  801732:	53                   	push   %rbx
+  801733:	48 83 ec 08          	sub    $0x8,%rsp
+  801737:	89 f8                	mov    %edi,%eax
+  801739:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80173c:	48 63 f9             	movslq %ecx,%rdi
+  80173f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801742:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801747:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174a:	be 00 00 00 00       	mov    $0x0,%esi
+  80174f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801755:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801757:	48 85 c0             	test   %rax,%rax
+  80175a:	7f 06                	jg     801762 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80175c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801760:	c9                   	leave
+  801761:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801762:	49 89 c0             	mov    %rax,%r8
+  801765:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80176a:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  801771:	00 00 00 
+  801774:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801779:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  801780:	00 00 00 
+  801783:	b8 00 00 00 00       	mov    $0x0,%eax
+  801788:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  80178f:	00 00 00 
+  801792:	41 ff d1             	call   *%r9
+
+0000000000801795 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801795:	55                   	push   %rbp
+  801796:	48 89 e5             	mov    %rsp,%rbp
+  801799:	53                   	push   %rbx
+  80179a:	48 83 ec 08          	sub    $0x8,%rsp
+  80179e:	89 f8                	mov    %edi,%eax
+  8017a0:	49 89 f2             	mov    %rsi,%r10
+  8017a3:	48 89 cf             	mov    %rcx,%rdi
+  8017a6:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8017a9:	48 63 da             	movslq %edx,%rbx
+  8017ac:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017af:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017b4:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b7:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8017ba:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017bc:	48 85 c0             	test   %rax,%rax
+  8017bf:	7f 06                	jg     8017c7 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8017c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c5:	c9                   	leave
+  8017c6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c7:	49 89 c0             	mov    %rax,%r8
+  8017ca:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8017cf:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  8017d6:	00 00 00 
+  8017d9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017de:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  8017e5:	00 00 00 
+  8017e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ed:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  8017f4:	00 00 00 
+  8017f7:	41 ff d1             	call   *%r9
+
+00000000008017fa <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8017fa:	55                   	push   %rbp
+  8017fb:	48 89 e5             	mov    %rsp,%rbp
+  8017fe:	53                   	push   %rbx
+  8017ff:	48 83 ec 08          	sub    $0x8,%rsp
+  801803:	49 89 f9             	mov    %rdi,%r9
+  801806:	89 f0                	mov    %esi,%eax
+  801808:	48 89 d3             	mov    %rdx,%rbx
+  80180b:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80180e:	49 63 f0             	movslq %r8d,%rsi
+  801811:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801814:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801819:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801822:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801824:	48 85 c0             	test   %rax,%rax
+  801827:	7f 06                	jg     80182f <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801829:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182d:	c9                   	leave
+  80182e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80182f:	49 89 c0             	mov    %rax,%r8
+  801832:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801837:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  80183e:	00 00 00 
+  801841:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801846:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  80184d:	00 00 00 
+  801850:	b8 00 00 00 00       	mov    $0x0,%eax
+  801855:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  80185c:	00 00 00 
+  80185f:	41 ff d1             	call   *%r9
+
+0000000000801862 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801862:	55                   	push   %rbp
+  801863:	48 89 e5             	mov    %rsp,%rbp
+  801866:	53                   	push   %rbx
+  801867:	89 f8                	mov    %edi,%eax
+  801869:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80186c:	48 63 f9             	movslq %ecx,%rdi
+  80186f:	48 63 da             	movslq %edx,%rbx
+  801872:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801875:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80187a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187d:	be 00 00 00 00       	mov    $0x0,%esi
+  801882:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801888:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80188a:	89 c2                	mov    %eax,%edx
+  80188c:	48 85 c0             	test   %rax,%rax
+  80188f:	78 0d                	js     80189e <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801891:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801896:	4d 85 c9             	test   %r9,%r9
+  801899:	74 03                	je     80189e <sys_alloc_dma_region+0x3c>
+  80189b:	49 89 01             	mov    %rax,(%r9)
+}
+  80189e:	89 d0                	mov    %edx,%eax
+  8018a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a4:	c9                   	leave
+  8018a5:	c3                   	ret
+
+00000000008018a6 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8018a6:	55                   	push   %rbp
+  8018a7:	48 89 e5             	mov    %rsp,%rbp
+  8018aa:	53                   	push   %rbx
+  8018ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8018af:	48 89 f1             	mov    %rsi,%rcx
+  8018b2:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8018b5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b8:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018cf:	48 85 c0             	test   %rax,%rax
+  8018d2:	7f 06                	jg     8018da <sys_set_cache_region+0x34>
+}
+  8018d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d8:	c9                   	leave
+  8018d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018da:	49 89 c0             	mov    %rax,%r8
+  8018dd:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8018e2:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  8018e9:	00 00 00 
+  8018ec:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018f1:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  8018f8:	00 00 00 
+  8018fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801900:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  801907:	00 00 00 
+  80190a:	41 ff d1             	call   *%r9
+
+000000000080190d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80190d:	55                   	push   %rbp
+  80190e:	48 89 e5             	mov    %rsp,%rbp
+  801911:	53                   	push   %rbx
+  801912:	48 83 ec 08          	sub    $0x8,%rsp
+  801916:	48 89 f1             	mov    %rsi,%rcx
+  801919:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80191c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80191f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801924:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801929:	be 00 00 00 00       	mov    $0x0,%esi
+  80192e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801934:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801936:	48 85 c0             	test   %rax,%rax
+  801939:	7f 06                	jg     801941 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80193b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80193f:	c9                   	leave
+  801940:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801941:	49 89 c0             	mov    %rax,%r8
+  801944:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801949:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  801950:	00 00 00 
+  801953:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801958:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  80195f:	00 00 00 
+  801962:	b8 00 00 00 00       	mov    $0x0,%eax
+  801967:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  80196e:	00 00 00 
+  801971:	41 ff d1             	call   *%r9
+
+0000000000801974 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801974:	55                   	push   %rbp
+  801975:	48 89 e5             	mov    %rsp,%rbp
+  801978:	53                   	push   %rbx
+  801979:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80197d:	48 63 ce             	movslq %esi,%rcx
+  801980:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801983:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801988:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801992:	be 00 00 00 00       	mov    $0x0,%esi
+  801997:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80199d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80199f:	48 85 c0             	test   %rax,%rax
+  8019a2:	7f 06                	jg     8019aa <sys_env_set_status+0x36>
+}
+  8019a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019a8:	c9                   	leave
+  8019a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019aa:	49 89 c0             	mov    %rax,%r8
+  8019ad:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8019b2:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  8019b9:	00 00 00 
+  8019bc:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019c1:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  8019c8:	00 00 00 
+  8019cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d0:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  8019d7:	00 00 00 
+  8019da:	41 ff d1             	call   *%r9
+
+00000000008019dd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8019dd:	55                   	push   %rbp
+  8019de:	48 89 e5             	mov    %rsp,%rbp
+  8019e1:	53                   	push   %rbx
+  8019e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8019e6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8019e9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019ec:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801a00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a06:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a08:	48 85 c0             	test   %rax,%rax
+  801a0b:	7f 06                	jg     801a13 <sys_env_set_trapframe+0x36>
+}
+  801a0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a11:	c9                   	leave
+  801a12:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a13:	49 89 c0             	mov    %rax,%r8
+  801a16:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801a1b:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  801a22:	00 00 00 
+  801a25:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a2a:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  801a31:	00 00 00 
+  801a34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a39:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  801a40:	00 00 00 
+  801a43:	41 ff d1             	call   *%r9
+
+0000000000801a46 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801a46:	55                   	push   %rbp
+  801a47:	48 89 e5             	mov    %rsp,%rbp
+  801a4a:	53                   	push   %rbx
+  801a4b:	48 83 ec 08          	sub    $0x8,%rsp
+  801a4f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801a52:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a55:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a5f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a64:	be 00 00 00 00       	mov    $0x0,%esi
+  801a69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a6f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a71:	48 85 c0             	test   %rax,%rax
+  801a74:	7f 06                	jg     801a7c <sys_env_set_pgfault_upcall+0x36>
+}
+  801a76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a7a:	c9                   	leave
+  801a7b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a7c:	49 89 c0             	mov    %rax,%r8
+  801a7f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801a84:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  801a8b:	00 00 00 
+  801a8e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a93:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  801a9a:	00 00 00 
+  801a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa2:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  801aa9:	00 00 00 
+  801aac:	41 ff d1             	call   *%r9
+
+0000000000801aaf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801aaf:	55                   	push   %rbp
+  801ab0:	48 89 e5             	mov    %rsp,%rbp
+  801ab3:	53                   	push   %rbx
+  801ab4:	89 f8                	mov    %edi,%eax
+  801ab6:	49 89 f1             	mov    %rsi,%r9
+  801ab9:	48 89 d3             	mov    %rdx,%rbx
+  801abc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801abf:	49 63 f0             	movslq %r8d,%rsi
+  801ac2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ac5:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801aca:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801acd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ad3:	cd 30                	int    $0x30
+}
+  801ad5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ad9:	c9                   	leave
+  801ada:	c3                   	ret
+
+0000000000801adb <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801adb:	55                   	push   %rbp
+  801adc:	48 89 e5             	mov    %rsp,%rbp
+  801adf:	53                   	push   %rbx
+  801ae0:	48 83 ec 08          	sub    $0x8,%rsp
+  801ae4:	48 89 fa             	mov    %rdi,%rdx
+  801ae7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801aea:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801af4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801af9:	be 00 00 00 00       	mov    $0x0,%esi
+  801afe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b04:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b06:	48 85 c0             	test   %rax,%rax
+  801b09:	7f 06                	jg     801b11 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b0b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b0f:	c9                   	leave
+  801b10:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b11:	49 89 c0             	mov    %rax,%r8
+  801b14:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801b19:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  801b20:	00 00 00 
+  801b23:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801b28:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  801b2f:	00 00 00 
+  801b32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b37:	49 b9 06 05 80 00 00 	movabs $0x800506,%r9
+  801b3e:	00 00 00 
+  801b41:	41 ff d1             	call   *%r9
+
+0000000000801b44 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801b44:	55                   	push   %rbp
+  801b45:	48 89 e5             	mov    %rsp,%rbp
+  801b48:	53                   	push   %rbx
+  801b49:	48 89 fa             	mov    %rdi,%rdx
+  801b4c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b4f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b59:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b5e:	be 00 00 00 00       	mov    $0x0,%esi
+  801b63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b69:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b6f:	c9                   	leave
+  801b70:	c3                   	ret
+
+0000000000801b71 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801b71:	55                   	push   %rbp
+  801b72:	48 89 e5             	mov    %rsp,%rbp
+  801b75:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b76:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b80:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801b94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b9a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ba0:	c9                   	leave
+  801ba1:	c3                   	ret
+
+0000000000801ba2 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801ba2:	48 85 ff             	test   %rdi,%rdi
+  801ba5:	0f 84 b6 01 00 00    	je     801d61 <malloc+0x1bf>
+malloc(size_t size) {
+  801bab:	55                   	push   %rbp
+  801bac:	48 89 e5             	mov    %rsp,%rbp
+  801baf:	41 56                	push   %r14
+  801bb1:	41 55                	push   %r13
+  801bb3:	41 54                	push   %r12
+  801bb5:	53                   	push   %rbx
+  801bb6:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801bb9:	48 b8 28 74 80 00 00 	movabs $0x807428,%rax
+  801bc0:	00 00 00 
+  801bc3:	4c 8b 20             	mov    (%rax),%r12
+  801bc6:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801bcd:	0f 87 94 01 00 00    	ja     801d67 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801bd3:	48 a1 20 74 80 00 00 	movabs 0x807420,%rax
+  801bda:	00 00 00 
+  801bdd:	48 85 c0             	test   %rax,%rax
+  801be0:	74 6b                	je     801c4d <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801be2:	4d 85 e4             	test   %r12,%r12
+  801be5:	74 66                	je     801c4d <malloc+0xab>
+  801be7:	48 ba 48 74 80 00 00 	movabs $0x807448,%rdx
+  801bee:	00 00 00 
+  801bf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bf6:	eb 0d                	jmp    801c05 <malloc+0x63>
+  801bf8:	48 83 c1 01          	add    $0x1,%rcx
+  801bfc:	48 83 c2 18          	add    $0x18,%rdx
+  801c00:	49 39 cc             	cmp    %rcx,%r12
+  801c03:	74 48                	je     801c4d <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801c05:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801c0a:	74 ec                	je     801bf8 <malloc+0x56>
+  801c0c:	48 39 1a             	cmp    %rbx,(%rdx)
+  801c0f:	72 e7                	jb     801bf8 <malloc+0x56>
+                real_freep_size--;
+  801c11:	48 83 e8 01          	sub    $0x1,%rax
+  801c15:	48 a3 20 74 80 00 00 	movabs %rax,0x807420
+  801c1c:	00 00 00 
+                freep[i].is_free = false;
+  801c1f:	48 ba 40 74 80 00 00 	movabs $0x807440,%rdx
+  801c26:	00 00 00 
+  801c29:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801c2d:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801c31:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801c35:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801c3c:	00 
+                freep[i].size = size;
+  801c3d:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801c41:	48 01 c8             	add    %rcx,%rax
+  801c44:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801c48:	e9 0b 01 00 00       	jmp    801d58 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801c4d:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801c54:	00 00 00 
+  801c57:	48 01 d8             	add    %rbx,%rax
+  801c5a:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801c60:	76 7c                	jbe    801cde <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801c62:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801c69:	00 00 00 
+  801c6c:	4c 8b 30             	mov    (%rax),%r14
+  801c6f:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801c76:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801c79:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801c80:	00 00 00 
+  801c83:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801c8a:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801c91:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801c97:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801c9b:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  801ca2:	00 00 00 
+  801ca5:	ff d0                	call   *%rax
+  801ca7:	89 c7                	mov    %eax,%edi
+  801ca9:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801cb0:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801cb7:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801cbe:	00 00 00 
+  801cc1:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801cc5:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801cca:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  801cd1:	00 00 00 
+  801cd4:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	0f 88 90 00 00 00    	js     801d6e <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801cde:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801ce5:	00 00 00 
+  801ce8:	48 8b 31             	mov    (%rcx),%rsi
+  801ceb:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801cf2:	00 00 00 
+  801cf5:	4c 8b 07             	mov    (%rdi),%r8
+  801cf8:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801cfc:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801d03:	00 00 00 
+  801d06:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801d0a:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801d0e:	48 b8 40 74 80 00 00 	movabs $0x807440,%rax
+  801d15:	00 00 00 
+  801d18:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801d1c:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801d1f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801d23:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801d2a:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801d2b:	48 89 d8             	mov    %rbx,%rax
+  801d2e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801d33:	4c 01 c0             	add    %r8,%rax
+  801d36:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801d39:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801d40:	48 01 f3             	add    %rsi,%rbx
+  801d43:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801d46:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801d4b:	48 a3 28 74 80 00 00 	movabs %rax,0x807428
+  801d52:	00 00 00 
+  801d55:	48 89 d0             	mov    %rdx,%rax
+}
+  801d58:	5b                   	pop    %rbx
+  801d59:	41 5c                	pop    %r12
+  801d5b:	41 5d                	pop    %r13
+  801d5d:	41 5e                	pop    %r14
+  801d5f:	5d                   	pop    %rbp
+  801d60:	c3                   	ret
+        return NULL;
+  801d61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d66:	c3                   	ret
+        return NULL;
+  801d67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6c:	eb ea                	jmp    801d58 <malloc+0x1b6>
+            return NULL;
+  801d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d73:	eb e3                	jmp    801d58 <malloc+0x1b6>
+
+0000000000801d75 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801d75:	55                   	push   %rbp
+  801d76:	48 89 e5             	mov    %rsp,%rbp
+  801d79:	53                   	push   %rbx
+  801d7a:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801d7e:	48 89 fb             	mov    %rdi,%rbx
+  801d81:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801d85:	48 89 df             	mov    %rbx,%rdi
+  801d88:	48 b8 a2 1b 80 00 00 	movabs $0x801ba2,%rax
+  801d8f:	00 00 00 
+  801d92:	ff d0                	call   *%rax
+  801d94:	48 89 c7             	mov    %rax,%rdi
+  801d97:	48 89 da             	mov    %rbx,%rdx
+  801d9a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9f:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+}
+  801dab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+
+0000000000801db1 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801db1:	48 a1 28 74 80 00 00 	movabs 0x807428,%rax
+  801db8:	00 00 00 
+  801dbb:	48 ba 20 74 80 00 00 	movabs $0x807420,%rdx
+  801dc2:	00 00 00 
+  801dc5:	48 3b 02             	cmp    (%rdx),%rax
+  801dc8:	74 4d                	je     801e17 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801dca:	48 85 c0             	test   %rax,%rax
+  801dcd:	74 4d                	je     801e1c <get_allocsize+0x6b>
+  801dcf:	48 b9 40 74 80 00 00 	movabs $0x807440,%rcx
+  801dd6:	00 00 00 
+  801dd9:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801dde:	48 3b 39             	cmp    (%rcx),%rdi
+  801de1:	74 13                	je     801df6 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801de3:	48 83 c2 01          	add    $0x1,%rdx
+  801de7:	48 83 c1 18          	add    $0x18,%rcx
+  801deb:	48 39 d0             	cmp    %rdx,%rax
+  801dee:	75 ee                	jne    801dde <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801df0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df5:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801df6:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dff:	48 be 40 74 80 00 00 	movabs $0x807440,%rsi
+  801e06:	00 00 00 
+  801e09:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801e0f:	75 0b                	jne    801e1c <get_allocsize+0x6b>
+  801e11:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801e16:	c3                   	ret
+        return 0;
+  801e17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e1c:	c3                   	ret
+
+0000000000801e1d <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801e1d:	48 85 ff             	test   %rdi,%rdi
+  801e20:	0f 84 01 01 00 00    	je     801f27 <free+0x10a>
+free(void *ptr) {
+  801e26:	55                   	push   %rbp
+  801e27:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801e2a:	48 b8 28 74 80 00 00 	movabs $0x807428,%rax
+  801e31:	00 00 00 
+  801e34:	48 8b 30             	mov    (%rax),%rsi
+  801e37:	48 a1 20 74 80 00 00 	movabs 0x807420,%rax
+  801e3e:	00 00 00 
+  801e41:	48 39 c6             	cmp    %rax,%rsi
+  801e44:	74 50                	je     801e96 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801e46:	48 85 f6             	test   %rsi,%rsi
+  801e49:	74 21                	je     801e6c <free+0x4f>
+  801e4b:	48 b9 40 74 80 00 00 	movabs $0x807440,%rcx
+  801e52:	00 00 00 
+  801e55:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801e5a:	48 3b 39             	cmp    (%rcx),%rdi
+  801e5d:	74 61                	je     801ec0 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801e5f:	48 83 c2 01          	add    $0x1,%rdx
+  801e63:	48 83 c1 18          	add    $0x18,%rcx
+  801e67:	48 39 d6             	cmp    %rdx,%rsi
+  801e6a:	75 ee                	jne    801e5a <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801e6c:	48 ba 50 56 80 00 00 	movabs $0x805650,%rdx
+  801e73:	00 00 00 
+  801e76:	be 12 01 00 00       	mov    $0x112,%esi
+  801e7b:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  801e82:	00 00 00 
+  801e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8a:	48 b9 06 05 80 00 00 	movabs $0x800506,%rcx
+  801e91:	00 00 00 
+  801e94:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801e96:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801e9d:	00 00 00 
+  801ea0:	be 06 01 00 00       	mov    $0x106,%esi
+  801ea5:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  801eac:	00 00 00 
+  801eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb4:	48 b9 06 05 80 00 00 	movabs $0x800506,%rcx
+  801ebb:	00 00 00 
+  801ebe:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801ec0:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801ec4:	48 be 40 74 80 00 00 	movabs $0x807440,%rsi
+  801ecb:	00 00 00 
+  801ece:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801ed4:	75 27                	jne    801efd <free+0xe0>
+            freep[i].is_free = true;
+  801ed6:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801eda:	48 ba 40 74 80 00 00 	movabs $0x807440,%rdx
+  801ee1:	00 00 00 
+  801ee4:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801eeb:	00 00 
+            real_freep_size++;
+  801eed:	48 83 c0 01          	add    $0x1,%rax
+  801ef1:	48 a3 20 74 80 00 00 	movabs %rax,0x807420
+  801ef8:	00 00 00 
+}
+  801efb:	5d                   	pop    %rbp
+  801efc:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801efd:	48 ba 28 56 80 00 00 	movabs $0x805628,%rdx
+  801f04:	00 00 00 
+  801f07:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801f0c:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  801f13:	00 00 00 
+  801f16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1b:	48 b9 06 05 80 00 00 	movabs $0x800506,%rcx
+  801f22:	00 00 00 
+  801f25:	ff d1                	call   *%rcx
+  801f27:	c3                   	ret
+
+0000000000801f28 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801f28:	55                   	push   %rbp
+  801f29:	48 89 e5             	mov    %rsp,%rbp
+  801f2c:	41 55                	push   %r13
+  801f2e:	41 54                	push   %r12
+  801f30:	53                   	push   %rbx
+  801f31:	48 83 ec 08          	sub    $0x8,%rsp
+  801f35:	48 89 fb             	mov    %rdi,%rbx
+  801f38:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801f3b:	48 b8 b1 1d 80 00 00 	movabs $0x801db1,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801f47:	49 39 c5             	cmp    %rax,%r13
+  801f4a:	73 0e                	jae    801f5a <realloc+0x32>
+}
+  801f4c:	48 89 d8             	mov    %rbx,%rax
+  801f4f:	48 83 c4 08          	add    $0x8,%rsp
+  801f53:	5b                   	pop    %rbx
+  801f54:	41 5c                	pop    %r12
+  801f56:	41 5d                	pop    %r13
+  801f58:	5d                   	pop    %rbp
+  801f59:	c3                   	ret
+  801f5a:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801f5d:	4c 89 ef             	mov    %r13,%rdi
+  801f60:	48 b8 a2 1b 80 00 00 	movabs $0x801ba2,%rax
+  801f67:	00 00 00 
+  801f6a:	ff d0                	call   *%rax
+  801f6c:	48 89 c7             	mov    %rax,%rdi
+  801f6f:	4c 89 e2             	mov    %r12,%rdx
+  801f72:	48 89 de             	mov    %rbx,%rsi
+  801f75:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  801f7c:	00 00 00 
+  801f7f:	ff d0                	call   *%rax
+  801f81:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801f84:	48 89 df             	mov    %rbx,%rdi
+  801f87:	48 b8 1d 1e 80 00 00 	movabs $0x801e1d,%rax
+  801f8e:	00 00 00 
+  801f91:	ff d0                	call   *%rax
+    return newptr;
+  801f93:	4c 89 e3             	mov    %r12,%rbx
+  801f96:	eb b4                	jmp    801f4c <realloc+0x24>
+
+0000000000801f98 <strdup>:
+
+char*
+strdup (const char *src) {
+  801f98:	55                   	push   %rbp
+  801f99:	48 89 e5             	mov    %rsp,%rbp
+  801f9c:	41 54                	push   %r12
+  801f9e:	53                   	push   %rbx
+  801f9f:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801fa2:	48 b8 90 0f 80 00 00 	movabs $0x800f90,%rax
+  801fa9:	00 00 00 
+  801fac:	ff d0                	call   *%rax
+  801fae:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801fb2:	4c 89 e7             	mov    %r12,%rdi
+  801fb5:	48 b8 a2 1b 80 00 00 	movabs $0x801ba2,%rax
+  801fbc:	00 00 00 
+  801fbf:	ff d0                	call   *%rax
+  801fc1:	48 89 c7             	mov    %rax,%rdi
+  801fc4:	4c 89 e2             	mov    %r12,%rdx
+  801fc7:	48 89 de             	mov    %rbx,%rsi
+  801fca:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  801fd1:	00 00 00 
+  801fd4:	ff d0                	call   *%rax
+}
+  801fd6:	5b                   	pop    %rbx
+  801fd7:	41 5c                	pop    %r12
+  801fd9:	5d                   	pop    %rbp
+  801fda:	c3                   	ret
+
+0000000000801fdb <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801fdb:	55                   	push   %rbp
+  801fdc:	48 89 e5             	mov    %rsp,%rbp
+  801fdf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801fe0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ff4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ff9:	be 00 00 00 00       	mov    $0x0,%esi
+  801ffe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802004:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  802006:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80200a:	c9                   	leave
+  80200b:	c3                   	ret
+
+000000000080200c <get_ticks>:
+
+uint64_t
+get_ticks() {
+  80200c:	55                   	push   %rbp
+  80200d:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  802010:	48 b8 40 74 98 00 00 	movabs $0x987440,%rax
+  802017:	00 00 00 
+  80201a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80201e:	74 26                	je     802046 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802020:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802022:	48 c1 e2 20          	shl    $0x20,%rdx
+  802026:	89 c0                	mov    %eax,%eax
+  802028:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  80202b:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  802032:	48 b9 40 74 98 00 00 	movabs $0x987440,%rcx
+  802039:	00 00 00 
+  80203c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802041:	48 f7 31             	divq   (%rcx)
+}
+  802044:	5d                   	pop    %rbp
+  802045:	c3                   	ret
+        freq = get_cpufreq();
+  802046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204b:	48 ba db 1f 80 00 00 	movabs $0x801fdb,%rdx
+  802052:	00 00 00 
+  802055:	ff d2                	call   *%rdx
+  802057:	48 a3 40 74 98 00 00 	movabs %rax,0x987440
+  80205e:	00 00 00 
+  802061:	eb bd                	jmp    802020 <get_ticks+0x14>
+
+0000000000802063 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  802063:	55                   	push   %rbp
+  802064:	48 89 e5             	mov    %rsp,%rbp
+  802067:	53                   	push   %rbx
+  802068:	48 83 ec 08          	sub    $0x8,%rsp
+  80206c:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  80206f:	48 b8 40 74 98 00 00 	movabs $0x987440,%rax
+  802076:	00 00 00 
+  802079:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80207d:	74 50                	je     8020cf <sleep+0x6c>
+    asm volatile("rdtsc"
+  80207f:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802081:	48 c1 e2 20          	shl    $0x20,%rdx
+  802085:	89 c0                	mov    %eax,%eax
+  802087:	48 89 d6             	mov    %rdx,%rsi
+  80208a:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  80208d:	48 b8 40 74 98 00 00 	movabs $0x987440,%rax
+  802094:	00 00 00 
+  802097:	48 0f af 18          	imul   (%rax),%rbx
+  80209b:	48 c1 eb 03          	shr    $0x3,%rbx
+  80209f:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  8020a6:	9b c4 20 
+  8020a9:	48 89 d8             	mov    %rbx,%rax
+  8020ac:	48 f7 e2             	mul    %rdx
+  8020af:	48 89 d1             	mov    %rdx,%rcx
+  8020b2:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  8020b6:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8020b8:	48 c1 e2 20          	shl    $0x20,%rdx
+  8020bc:	89 c0                	mov    %eax,%eax
+  8020be:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  8020c1:	48 29 f2             	sub    %rsi,%rdx
+  8020c4:	48 39 ca             	cmp    %rcx,%rdx
+  8020c7:	72 ed                	jb     8020b6 <sleep+0x53>
+}
+  8020c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020cd:	c9                   	leave
+  8020ce:	c3                   	ret
+        freq = get_cpufreq();
+  8020cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d4:	48 ba db 1f 80 00 00 	movabs $0x801fdb,%rdx
+  8020db:	00 00 00 
+  8020de:	ff d2                	call   *%rdx
+  8020e0:	48 a3 40 74 98 00 00 	movabs %rax,0x987440
+  8020e7:	00 00 00 
+  8020ea:	eb 93                	jmp    80207f <sleep+0x1c>
+
+00000000008020ec <poll_kbd>:
+
+int poll_kbd() {
+  8020ec:	55                   	push   %rbp
+  8020ed:	48 89 e5             	mov    %rsp,%rbp
+  8020f0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8020f1:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8020f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802100:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802105:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80210a:	be 00 00 00 00       	mov    $0x0,%esi
+  80210f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802115:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  802117:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80211b:	c9                   	leave
+  80211c:	c3                   	ret
+
+000000000080211d <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  80211d:	55                   	push   %rbp
+  80211e:	48 89 e5             	mov    %rsp,%rbp
+  802121:	53                   	push   %rbx
+  802122:	49 89 fa             	mov    %rdi,%r10
+  802125:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  802127:	44 89 c6             	mov    %r8d,%esi
+  80212a:	89 cf                	mov    %ecx,%edi
+  80212c:	89 d3                	mov    %edx,%ebx
+  80212e:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  802130:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802135:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802138:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  80213c:	cd 30                	int    $0x30
+  80213e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802142:	c9                   	leave
+  802143:	c3                   	ret
+
+0000000000802144 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  802144:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  802147:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  80214b:	83 3f 01             	cmpl   $0x1,(%rdi)
+  80214e:	7e 0f                	jle    80215f <argstart+0x1b>
+  802150:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  802157:	00 00 00 
+  80215a:	48 85 f6             	test   %rsi,%rsi
+  80215d:	75 05                	jne    802164 <argstart+0x20>
+  80215f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802164:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  802168:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  80216f:	00 
+}
+  802170:	c3                   	ret
+
+0000000000802171 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  802171:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802178:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  802179:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  80217d:	48 85 c0             	test   %rax,%rax
+  802180:	0f 84 8f 00 00 00    	je     802215 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  802186:	55                   	push   %rbp
+  802187:	48 89 e5             	mov    %rsp,%rbp
+  80218a:	53                   	push   %rbx
+  80218b:	48 83 ec 08          	sub    $0x8,%rsp
+  80218f:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  802192:	80 38 00             	cmpb   $0x0,(%rax)
+  802195:	75 52                	jne    8021e9 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  802197:	48 8b 17             	mov    (%rdi),%rdx
+  80219a:	83 3a 01             	cmpl   $0x1,(%rdx)
+  80219d:	74 67                	je     802206 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  80219f:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8021a3:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  8021a7:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8021aa:	75 5a                	jne    802206 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  8021ac:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  8021b0:	74 54                	je     802206 <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  8021b2:	48 83 c0 01          	add    $0x1,%rax
+  8021b6:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8021ba:	8b 12                	mov    (%rdx),%edx
+  8021bc:	83 ea 01             	sub    $0x1,%edx
+  8021bf:	48 63 d2             	movslq %edx,%rdx
+  8021c2:	48 c1 e2 03          	shl    $0x3,%rdx
+  8021c6:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8021ca:	48 83 c7 08          	add    $0x8,%rdi
+  8021ce:	48 b8 5c 13 80 00 00 	movabs $0x80135c,%rax
+  8021d5:	00 00 00 
+  8021d8:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  8021da:	48 8b 03             	mov    (%rbx),%rax
+  8021dd:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  8021e0:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8021e4:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8021e7:	74 17                	je     802200 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  8021e9:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8021ed:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  8021f0:	48 83 c0 01          	add    $0x1,%rax
+  8021f4:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  8021f8:	89 d0                	mov    %edx,%eax
+  8021fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021fe:	c9                   	leave
+  8021ff:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  802200:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802204:	75 e3                	jne    8021e9 <argnext+0x78>
+    args->curarg = 0;
+  802206:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80220d:	00 
+    return -1;
+  80220e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802213:	eb e3                	jmp    8021f8 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  802215:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  80221a:	89 d0                	mov    %edx,%eax
+  80221c:	c3                   	ret
+
+000000000080221d <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  80221d:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802221:	48 85 c0             	test   %rax,%rax
+  802224:	74 7b                	je     8022a1 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  802226:	55                   	push   %rbp
+  802227:	48 89 e5             	mov    %rsp,%rbp
+  80222a:	53                   	push   %rbx
+  80222b:	48 83 ec 08          	sub    $0x8,%rsp
+  80222f:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  802232:	80 38 00             	cmpb   $0x0,(%rax)
+  802235:	74 1c                	je     802253 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  802237:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  80223b:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  802242:	00 00 00 
+  802245:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  802249:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  80224d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802251:	c9                   	leave
+  802252:	c3                   	ret
+    } else if (*args->argc > 1) {
+  802253:	48 8b 07             	mov    (%rdi),%rax
+  802256:	83 38 01             	cmpl   $0x1,(%rax)
+  802259:	7f 12                	jg     80226d <argnextvalue+0x50>
+        args->argvalue = 0;
+  80225b:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802262:	00 
+        args->curarg = 0;
+  802263:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  80226a:	00 
+  80226b:	eb dc                	jmp    802249 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  80226d:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802271:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802275:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802279:	8b 10                	mov    (%rax),%edx
+  80227b:	83 ea 01             	sub    $0x1,%edx
+  80227e:	48 63 d2             	movslq %edx,%rdx
+  802281:	48 c1 e2 03          	shl    $0x3,%rdx
+  802285:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  802289:	48 83 c7 08          	add    $0x8,%rdi
+  80228d:	48 b8 5c 13 80 00 00 	movabs $0x80135c,%rax
+  802294:	00 00 00 
+  802297:	ff d0                	call   *%rax
+        (*args->argc)--;
+  802299:	48 8b 03             	mov    (%rbx),%rax
+  80229c:	83 28 01             	subl   $0x1,(%rax)
+  80229f:	eb a8                	jmp    802249 <argnextvalue+0x2c>
+}
+  8022a1:	c3                   	ret
+
+00000000008022a2 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  8022a2:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  8022a6:	48 85 c0             	test   %rax,%rax
+  8022a9:	74 01                	je     8022ac <argvalue+0xa>
+}
+  8022ab:	c3                   	ret
+argvalue(struct Argstate *args) {
+  8022ac:	55                   	push   %rbp
+  8022ad:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  8022b0:	48 b8 1d 22 80 00 00 	movabs $0x80221d,%rax
+  8022b7:	00 00 00 
+  8022ba:	ff d0                	call   *%rax
+}
+  8022bc:	5d                   	pop    %rbp
+  8022bd:	c3                   	ret
+
+00000000008022be <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022be:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022c5:	ff ff ff 
+  8022c8:	48 01 f8             	add    %rdi,%rax
+  8022cb:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8022cf:	c3                   	ret
+
+00000000008022d0 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022d0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022d7:	ff ff ff 
+  8022da:	48 01 f8             	add    %rdi,%rax
+  8022dd:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8022e1:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8022e7:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8022eb:	c3                   	ret
+
+00000000008022ec <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8022ec:	55                   	push   %rbp
+  8022ed:	48 89 e5             	mov    %rsp,%rbp
+  8022f0:	41 57                	push   %r15
+  8022f2:	41 56                	push   %r14
+  8022f4:	41 55                	push   %r13
+  8022f6:	41 54                	push   %r12
+  8022f8:	53                   	push   %rbx
+  8022f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8022fd:	49 89 ff             	mov    %rdi,%r15
+  802300:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802305:	49 bd 68 43 80 00 00 	movabs $0x804368,%r13
+  80230c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80230f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802315:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802318:	48 89 df             	mov    %rbx,%rdi
+  80231b:	41 ff d5             	call   *%r13
+  80231e:	83 e0 04             	and    $0x4,%eax
+  802321:	74 17                	je     80233a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802323:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80232a:	4c 39 f3             	cmp    %r14,%rbx
+  80232d:	75 e6                	jne    802315 <fd_alloc+0x29>
+  80232f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802335:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80233a:	4d 89 27             	mov    %r12,(%r15)
+}
+  80233d:	48 83 c4 08          	add    $0x8,%rsp
+  802341:	5b                   	pop    %rbx
+  802342:	41 5c                	pop    %r12
+  802344:	41 5d                	pop    %r13
+  802346:	41 5e                	pop    %r14
+  802348:	41 5f                	pop    %r15
+  80234a:	5d                   	pop    %rbp
+  80234b:	c3                   	ret
+
+000000000080234c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80234c:	83 ff 1f             	cmp    $0x1f,%edi
+  80234f:	77 39                	ja     80238a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802351:	55                   	push   %rbp
+  802352:	48 89 e5             	mov    %rsp,%rbp
+  802355:	41 54                	push   %r12
+  802357:	53                   	push   %rbx
+  802358:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80235b:	48 63 df             	movslq %edi,%rbx
+  80235e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802365:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802369:	48 89 df             	mov    %rbx,%rdi
+  80236c:	48 b8 68 43 80 00 00 	movabs $0x804368,%rax
+  802373:	00 00 00 
+  802376:	ff d0                	call   *%rax
+  802378:	a8 04                	test   $0x4,%al
+  80237a:	74 14                	je     802390 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80237c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802380:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802385:	5b                   	pop    %rbx
+  802386:	41 5c                	pop    %r12
+  802388:	5d                   	pop    %rbp
+  802389:	c3                   	ret
+        return -E_INVAL;
+  80238a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80238f:	c3                   	ret
+        return -E_INVAL;
+  802390:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802395:	eb ee                	jmp    802385 <fd_lookup+0x39>
+
+0000000000802397 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802397:	55                   	push   %rbp
+  802398:	48 89 e5             	mov    %rsp,%rbp
+  80239b:	41 54                	push   %r12
+  80239d:	53                   	push   %rbx
+  80239e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8023a1:	48 b8 20 57 80 00 00 	movabs $0x805720,%rax
+  8023a8:	00 00 00 
+  8023ab:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8023b2:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8023b5:	39 3b                	cmp    %edi,(%rbx)
+  8023b7:	74 47                	je     802400 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8023b9:	48 83 c0 08          	add    $0x8,%rax
+  8023bd:	48 8b 18             	mov    (%rax),%rbx
+  8023c0:	48 85 db             	test   %rbx,%rbx
+  8023c3:	75 f0                	jne    8023b5 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023c5:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8023cc:	00 00 00 
+  8023cf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023d5:	89 fa                	mov    %edi,%edx
+  8023d7:	48 bf 88 56 80 00 00 	movabs $0x805688,%rdi
+  8023de:	00 00 00 
+  8023e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e6:	48 b9 56 06 80 00 00 	movabs $0x800656,%rcx
+  8023ed:	00 00 00 
+  8023f0:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8023f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8023f7:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8023fb:	5b                   	pop    %rbx
+  8023fc:	41 5c                	pop    %r12
+  8023fe:	5d                   	pop    %rbp
+  8023ff:	c3                   	ret
+            return 0;
+  802400:	b8 00 00 00 00       	mov    $0x0,%eax
+  802405:	eb f0                	jmp    8023f7 <dev_lookup+0x60>
+
+0000000000802407 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802407:	55                   	push   %rbp
+  802408:	48 89 e5             	mov    %rsp,%rbp
+  80240b:	41 55                	push   %r13
+  80240d:	41 54                	push   %r12
+  80240f:	53                   	push   %rbx
+  802410:	48 83 ec 18          	sub    $0x18,%rsp
+  802414:	48 89 fb             	mov    %rdi,%rbx
+  802417:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80241a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802421:	ff ff ff 
+  802424:	48 01 df             	add    %rbx,%rdi
+  802427:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80242b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80242f:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  802436:	00 00 00 
+  802439:	ff d0                	call   *%rax
+  80243b:	41 89 c5             	mov    %eax,%r13d
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	78 06                	js     802448 <fd_close+0x41>
+  802442:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802446:	74 1a                	je     802462 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802448:	45 84 e4             	test   %r12b,%r12b
+  80244b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802450:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802454:	44 89 e8             	mov    %r13d,%eax
+  802457:	48 83 c4 18          	add    $0x18,%rsp
+  80245b:	5b                   	pop    %rbx
+  80245c:	41 5c                	pop    %r12
+  80245e:	41 5d                	pop    %r13
+  802460:	5d                   	pop    %rbp
+  802461:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802462:	8b 3b                	mov    (%rbx),%edi
+  802464:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802468:	48 b8 97 23 80 00 00 	movabs $0x802397,%rax
+  80246f:	00 00 00 
+  802472:	ff d0                	call   *%rax
+  802474:	41 89 c5             	mov    %eax,%r13d
+  802477:	85 c0                	test   %eax,%eax
+  802479:	78 1b                	js     802496 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80247b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80247f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802483:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802489:	48 85 c0             	test   %rax,%rax
+  80248c:	74 08                	je     802496 <fd_close+0x8f>
+  80248e:	48 89 df             	mov    %rbx,%rdi
+  802491:	ff d0                	call   *%rax
+  802493:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802496:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80249b:	48 89 de             	mov    %rbx,%rsi
+  80249e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a3:	48 b8 0d 19 80 00 00 	movabs $0x80190d,%rax
+  8024aa:	00 00 00 
+  8024ad:	ff d0                	call   *%rax
+    return res;
+  8024af:	eb a3                	jmp    802454 <fd_close+0x4d>
+
+00000000008024b1 <close>:
+
+int
+close(int fdnum) {
+  8024b1:	55                   	push   %rbp
+  8024b2:	48 89 e5             	mov    %rsp,%rbp
+  8024b5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8024b9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024bd:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  8024c4:	00 00 00 
+  8024c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024c9:	85 c0                	test   %eax,%eax
+  8024cb:	78 15                	js     8024e2 <close+0x31>
+
+    return fd_close(fd, 1);
+  8024cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8024d2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024d6:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+}
+  8024e2:	c9                   	leave
+  8024e3:	c3                   	ret
+
+00000000008024e4 <close_all>:
+
+void
+close_all(void) {
+  8024e4:	55                   	push   %rbp
+  8024e5:	48 89 e5             	mov    %rsp,%rbp
+  8024e8:	41 54                	push   %r12
+  8024ea:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8024eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024f0:	49 bc b1 24 80 00 00 	movabs $0x8024b1,%r12
+  8024f7:	00 00 00 
+  8024fa:	89 df                	mov    %ebx,%edi
+  8024fc:	41 ff d4             	call   *%r12
+  8024ff:	83 c3 01             	add    $0x1,%ebx
+  802502:	83 fb 20             	cmp    $0x20,%ebx
+  802505:	75 f3                	jne    8024fa <close_all+0x16>
+}
+  802507:	5b                   	pop    %rbx
+  802508:	41 5c                	pop    %r12
+  80250a:	5d                   	pop    %rbp
+  80250b:	c3                   	ret
+
+000000000080250c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80250c:	55                   	push   %rbp
+  80250d:	48 89 e5             	mov    %rsp,%rbp
+  802510:	41 57                	push   %r15
+  802512:	41 56                	push   %r14
+  802514:	41 55                	push   %r13
+  802516:	41 54                	push   %r12
+  802518:	53                   	push   %rbx
+  802519:	48 83 ec 18          	sub    $0x18,%rsp
+  80251d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802520:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802524:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  80252b:	00 00 00 
+  80252e:	ff d0                	call   *%rax
+  802530:	89 c3                	mov    %eax,%ebx
+  802532:	85 c0                	test   %eax,%eax
+  802534:	0f 88 b8 00 00 00    	js     8025f2 <dup+0xe6>
+    close(newfdnum);
+  80253a:	44 89 e7             	mov    %r12d,%edi
+  80253d:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  802544:	00 00 00 
+  802547:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802549:	4d 63 ec             	movslq %r12d,%r13
+  80254c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802553:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802557:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80255b:	4c 89 ff             	mov    %r15,%rdi
+  80255e:	49 be d0 22 80 00 00 	movabs $0x8022d0,%r14
+  802565:	00 00 00 
+  802568:	41 ff d6             	call   *%r14
+  80256b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80256e:	4c 89 ef             	mov    %r13,%rdi
+  802571:	41 ff d6             	call   *%r14
+  802574:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802577:	48 89 df             	mov    %rbx,%rdi
+  80257a:	48 b8 68 43 80 00 00 	movabs $0x804368,%rax
+  802581:	00 00 00 
+  802584:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802586:	a8 04                	test   $0x4,%al
+  802588:	74 2b                	je     8025b5 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80258a:	41 89 c1             	mov    %eax,%r9d
+  80258d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802593:	4c 89 f1             	mov    %r14,%rcx
+  802596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259b:	48 89 de             	mov    %rbx,%rsi
+  80259e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a3:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  8025aa:	00 00 00 
+  8025ad:	ff d0                	call   *%rax
+  8025af:	89 c3                	mov    %eax,%ebx
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	78 4e                	js     802603 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8025b5:	4c 89 ff             	mov    %r15,%rdi
+  8025b8:	48 b8 68 43 80 00 00 	movabs $0x804368,%rax
+  8025bf:	00 00 00 
+  8025c2:	ff d0                	call   *%rax
+  8025c4:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8025c7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8025cd:	4c 89 e9             	mov    %r13,%rcx
+  8025d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d5:	4c 89 fe             	mov    %r15,%rsi
+  8025d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025dd:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  8025e4:	00 00 00 
+  8025e7:	ff d0                	call   *%rax
+  8025e9:	89 c3                	mov    %eax,%ebx
+  8025eb:	85 c0                	test   %eax,%eax
+  8025ed:	78 14                	js     802603 <dup+0xf7>
+
+    return newfdnum;
+  8025ef:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8025f2:	89 d8                	mov    %ebx,%eax
+  8025f4:	48 83 c4 18          	add    $0x18,%rsp
+  8025f8:	5b                   	pop    %rbx
+  8025f9:	41 5c                	pop    %r12
+  8025fb:	41 5d                	pop    %r13
+  8025fd:	41 5e                	pop    %r14
+  8025ff:	41 5f                	pop    %r15
+  802601:	5d                   	pop    %rbp
+  802602:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802603:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802608:	4c 89 ee             	mov    %r13,%rsi
+  80260b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802610:	49 bc 0d 19 80 00 00 	movabs $0x80190d,%r12
+  802617:	00 00 00 
+  80261a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80261d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802622:	4c 89 f6             	mov    %r14,%rsi
+  802625:	bf 00 00 00 00       	mov    $0x0,%edi
+  80262a:	41 ff d4             	call   *%r12
+    return res;
+  80262d:	eb c3                	jmp    8025f2 <dup+0xe6>
+
+000000000080262f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80262f:	55                   	push   %rbp
+  802630:	48 89 e5             	mov    %rsp,%rbp
+  802633:	41 56                	push   %r14
+  802635:	41 55                	push   %r13
+  802637:	41 54                	push   %r12
+  802639:	53                   	push   %rbx
+  80263a:	48 83 ec 10          	sub    $0x10,%rsp
+  80263e:	89 fb                	mov    %edi,%ebx
+  802640:	49 89 f4             	mov    %rsi,%r12
+  802643:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802646:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80264a:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  802651:	00 00 00 
+  802654:	ff d0                	call   *%rax
+  802656:	85 c0                	test   %eax,%eax
+  802658:	78 4c                	js     8026a6 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80265a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80265e:	41 8b 3e             	mov    (%r14),%edi
+  802661:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802665:	48 b8 97 23 80 00 00 	movabs $0x802397,%rax
+  80266c:	00 00 00 
+  80266f:	ff d0                	call   *%rax
+  802671:	85 c0                	test   %eax,%eax
+  802673:	78 35                	js     8026aa <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802675:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802679:	83 e0 03             	and    $0x3,%eax
+  80267c:	83 f8 01             	cmp    $0x1,%eax
+  80267f:	74 2d                	je     8026ae <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802681:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802685:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802689:	48 85 c0             	test   %rax,%rax
+  80268c:	74 56                	je     8026e4 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80268e:	4c 89 ea             	mov    %r13,%rdx
+  802691:	4c 89 e6             	mov    %r12,%rsi
+  802694:	4c 89 f7             	mov    %r14,%rdi
+  802697:	ff d0                	call   *%rax
+}
+  802699:	48 83 c4 10          	add    $0x10,%rsp
+  80269d:	5b                   	pop    %rbx
+  80269e:	41 5c                	pop    %r12
+  8026a0:	41 5d                	pop    %r13
+  8026a2:	41 5e                	pop    %r14
+  8026a4:	5d                   	pop    %rbp
+  8026a5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026a6:	48 98                	cltq
+  8026a8:	eb ef                	jmp    802699 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026aa:	48 98                	cltq
+  8026ac:	eb eb                	jmp    802699 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026ae:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8026b5:	00 00 00 
+  8026b8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026be:	89 da                	mov    %ebx,%edx
+  8026c0:	48 bf c9 56 80 00 00 	movabs $0x8056c9,%rdi
+  8026c7:	00 00 00 
+  8026ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026cf:	48 b9 56 06 80 00 00 	movabs $0x800656,%rcx
+  8026d6:	00 00 00 
+  8026d9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8026db:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026e2:	eb b5                	jmp    802699 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8026e4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8026eb:	eb ac                	jmp    802699 <read+0x6a>
+
+00000000008026ed <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8026ed:	55                   	push   %rbp
+  8026ee:	48 89 e5             	mov    %rsp,%rbp
+  8026f1:	41 57                	push   %r15
+  8026f3:	41 56                	push   %r14
+  8026f5:	41 55                	push   %r13
+  8026f7:	41 54                	push   %r12
+  8026f9:	53                   	push   %rbx
+  8026fa:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8026fe:	48 85 d2             	test   %rdx,%rdx
+  802701:	74 54                	je     802757 <readn+0x6a>
+  802703:	41 89 fd             	mov    %edi,%r13d
+  802706:	49 89 f6             	mov    %rsi,%r14
+  802709:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80270c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802711:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802716:	49 bf 2f 26 80 00 00 	movabs $0x80262f,%r15
+  80271d:	00 00 00 
+  802720:	4c 89 e2             	mov    %r12,%rdx
+  802723:	48 29 f2             	sub    %rsi,%rdx
+  802726:	4c 01 f6             	add    %r14,%rsi
+  802729:	44 89 ef             	mov    %r13d,%edi
+  80272c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80272f:	85 c0                	test   %eax,%eax
+  802731:	78 20                	js     802753 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802733:	01 c3                	add    %eax,%ebx
+  802735:	85 c0                	test   %eax,%eax
+  802737:	74 08                	je     802741 <readn+0x54>
+  802739:	48 63 f3             	movslq %ebx,%rsi
+  80273c:	4c 39 e6             	cmp    %r12,%rsi
+  80273f:	72 df                	jb     802720 <readn+0x33>
+    }
+    return res;
+  802741:	48 63 c3             	movslq %ebx,%rax
+}
+  802744:	48 83 c4 08          	add    $0x8,%rsp
+  802748:	5b                   	pop    %rbx
+  802749:	41 5c                	pop    %r12
+  80274b:	41 5d                	pop    %r13
+  80274d:	41 5e                	pop    %r14
+  80274f:	41 5f                	pop    %r15
+  802751:	5d                   	pop    %rbp
+  802752:	c3                   	ret
+        if (inc < 0) return inc;
+  802753:	48 98                	cltq
+  802755:	eb ed                	jmp    802744 <readn+0x57>
+    int inc = 1, res = 0;
+  802757:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80275c:	eb e3                	jmp    802741 <readn+0x54>
+
+000000000080275e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80275e:	55                   	push   %rbp
+  80275f:	48 89 e5             	mov    %rsp,%rbp
+  802762:	41 56                	push   %r14
+  802764:	41 55                	push   %r13
+  802766:	41 54                	push   %r12
+  802768:	53                   	push   %rbx
+  802769:	48 83 ec 10          	sub    $0x10,%rsp
+  80276d:	89 fb                	mov    %edi,%ebx
+  80276f:	49 89 f4             	mov    %rsi,%r12
+  802772:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802775:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802779:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+  802785:	85 c0                	test   %eax,%eax
+  802787:	78 47                	js     8027d0 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802789:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80278d:	41 8b 3e             	mov    (%r14),%edi
+  802790:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802794:	48 b8 97 23 80 00 00 	movabs $0x802397,%rax
+  80279b:	00 00 00 
+  80279e:	ff d0                	call   *%rax
+  8027a0:	85 c0                	test   %eax,%eax
+  8027a2:	78 30                	js     8027d4 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027a4:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8027a9:	74 2d                	je     8027d8 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027af:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8027b3:	48 85 c0             	test   %rax,%rax
+  8027b6:	74 56                	je     80280e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8027b8:	4c 89 ea             	mov    %r13,%rdx
+  8027bb:	4c 89 e6             	mov    %r12,%rsi
+  8027be:	4c 89 f7             	mov    %r14,%rdi
+  8027c1:	ff d0                	call   *%rax
+}
+  8027c3:	48 83 c4 10          	add    $0x10,%rsp
+  8027c7:	5b                   	pop    %rbx
+  8027c8:	41 5c                	pop    %r12
+  8027ca:	41 5d                	pop    %r13
+  8027cc:	41 5e                	pop    %r14
+  8027ce:	5d                   	pop    %rbp
+  8027cf:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027d0:	48 98                	cltq
+  8027d2:	eb ef                	jmp    8027c3 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027d4:	48 98                	cltq
+  8027d6:	eb eb                	jmp    8027c3 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8027d8:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8027df:	00 00 00 
+  8027e2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8027e8:	89 da                	mov    %ebx,%edx
+  8027ea:	48 bf e5 56 80 00 00 	movabs $0x8056e5,%rdi
+  8027f1:	00 00 00 
+  8027f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f9:	48 b9 56 06 80 00 00 	movabs $0x800656,%rcx
+  802800:	00 00 00 
+  802803:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802805:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80280c:	eb b5                	jmp    8027c3 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80280e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802815:	eb ac                	jmp    8027c3 <write+0x65>
+
+0000000000802817 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802817:	55                   	push   %rbp
+  802818:	48 89 e5             	mov    %rsp,%rbp
+  80281b:	53                   	push   %rbx
+  80281c:	48 83 ec 18          	sub    $0x18,%rsp
+  802820:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802822:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802826:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+  802832:	85 c0                	test   %eax,%eax
+  802834:	78 0c                	js     802842 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802836:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80283a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80283d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802842:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802846:	c9                   	leave
+  802847:	c3                   	ret
+
+0000000000802848 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802848:	55                   	push   %rbp
+  802849:	48 89 e5             	mov    %rsp,%rbp
+  80284c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802850:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802854:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  80285b:	00 00 00 
+  80285e:	ff d0                	call   *%rax
+  802860:	85 c0                	test   %eax,%eax
+  802862:	78 07                	js     80286b <tell+0x23>
+    return fdes->fd_offset;
+  802864:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802868:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80286b:	c9                   	leave
+  80286c:	c3                   	ret
+
+000000000080286d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80286d:	55                   	push   %rbp
+  80286e:	48 89 e5             	mov    %rsp,%rbp
+  802871:	41 55                	push   %r13
+  802873:	41 54                	push   %r12
+  802875:	53                   	push   %rbx
+  802876:	48 83 ec 18          	sub    $0x18,%rsp
+  80287a:	89 fb                	mov    %edi,%ebx
+  80287c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80287f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802883:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  80288a:	00 00 00 
+  80288d:	ff d0                	call   *%rax
+  80288f:	85 c0                	test   %eax,%eax
+  802891:	78 38                	js     8028cb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802893:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802897:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80289b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80289f:	48 b8 97 23 80 00 00 	movabs $0x802397,%rax
+  8028a6:	00 00 00 
+  8028a9:	ff d0                	call   *%rax
+  8028ab:	85 c0                	test   %eax,%eax
+  8028ad:	78 1c                	js     8028cb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8028af:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8028b4:	74 20                	je     8028d6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028ba:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8028be:	48 85 c0             	test   %rax,%rax
+  8028c1:	74 47                	je     80290a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8028c3:	44 89 e6             	mov    %r12d,%esi
+  8028c6:	4c 89 ef             	mov    %r13,%rdi
+  8028c9:	ff d0                	call   *%rax
+}
+  8028cb:	48 83 c4 18          	add    $0x18,%rsp
+  8028cf:	5b                   	pop    %rbx
+  8028d0:	41 5c                	pop    %r12
+  8028d2:	41 5d                	pop    %r13
+  8028d4:	5d                   	pop    %rbp
+  8028d5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8028d6:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8028dd:	00 00 00 
+  8028e0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8028e6:	89 da                	mov    %ebx,%edx
+  8028e8:	48 bf a8 56 80 00 00 	movabs $0x8056a8,%rdi
+  8028ef:	00 00 00 
+  8028f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f7:	48 b9 56 06 80 00 00 	movabs $0x800656,%rcx
+  8028fe:	00 00 00 
+  802901:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802903:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802908:	eb c1                	jmp    8028cb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80290a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80290f:	eb ba                	jmp    8028cb <ftruncate+0x5e>
+
+0000000000802911 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802911:	55                   	push   %rbp
+  802912:	48 89 e5             	mov    %rsp,%rbp
+  802915:	41 54                	push   %r12
+  802917:	53                   	push   %rbx
+  802918:	48 83 ec 10          	sub    $0x10,%rsp
+  80291c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80291f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802923:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  80292a:	00 00 00 
+  80292d:	ff d0                	call   *%rax
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	78 4e                	js     802981 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802933:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802937:	41 8b 3c 24          	mov    (%r12),%edi
+  80293b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80293f:	48 b8 97 23 80 00 00 	movabs $0x802397,%rax
+  802946:	00 00 00 
+  802949:	ff d0                	call   *%rax
+  80294b:	85 c0                	test   %eax,%eax
+  80294d:	78 32                	js     802981 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80294f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802953:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802958:	74 30                	je     80298a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80295a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80295d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802964:	00 00 00 
+    stat->st_isdir = 0;
+  802967:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80296e:	00 00 00 
+    stat->st_dev = dev;
+  802971:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802978:	48 89 de             	mov    %rbx,%rsi
+  80297b:	4c 89 e7             	mov    %r12,%rdi
+  80297e:	ff 50 28             	call   *0x28(%rax)
+}
+  802981:	48 83 c4 10          	add    $0x10,%rsp
+  802985:	5b                   	pop    %rbx
+  802986:	41 5c                	pop    %r12
+  802988:	5d                   	pop    %rbp
+  802989:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80298a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80298f:	eb f0                	jmp    802981 <fstat+0x70>
+
+0000000000802991 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802991:	55                   	push   %rbp
+  802992:	48 89 e5             	mov    %rsp,%rbp
+  802995:	41 54                	push   %r12
+  802997:	53                   	push   %rbx
+  802998:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80299f:	41 89 fc             	mov    %edi,%r12d
+  8029a2:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029a4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8029a8:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  8029af:	00 00 00 
+  8029b2:	ff d0                	call   *%rax
+  8029b4:	85 c0                	test   %eax,%eax
+  8029b6:	78 31                	js     8029e9 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8029b8:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8029bf:	44 89 e7             	mov    %r12d,%edi
+  8029c2:	48 b8 11 29 80 00 00 	movabs $0x802911,%rax
+  8029c9:	00 00 00 
+  8029cc:	ff d0                	call   *%rax
+  8029ce:	85 c0                	test   %eax,%eax
+  8029d0:	78 17                	js     8029e9 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8029d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029d6:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8029d9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8029dc:	39 d3                	cmp    %edx,%ebx
+  8029de:	0f 4f da             	cmovg  %edx,%ebx
+  8029e1:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8029e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029e9:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8029f0:	5b                   	pop    %rbx
+  8029f1:	41 5c                	pop    %r12
+  8029f3:	5d                   	pop    %rbp
+  8029f4:	c3                   	ret
+
+00000000008029f5 <seektoend>:
+{
+  8029f5:	55                   	push   %rbp
+  8029f6:	48 89 e5             	mov    %rsp,%rbp
+  8029f9:	53                   	push   %rbx
+  8029fa:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802a01:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802a03:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802a07:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  802a0e:	00 00 00 
+  802a11:	ff d0                	call   *%rax
+  802a13:	85 c0                	test   %eax,%eax
+  802a15:	78 28                	js     802a3f <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802a17:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802a1e:	89 df                	mov    %ebx,%edi
+  802a20:	48 b8 11 29 80 00 00 	movabs $0x802911,%rax
+  802a27:	00 00 00 
+  802a2a:	ff d0                	call   *%rax
+  802a2c:	85 c0                	test   %eax,%eax
+  802a2e:	78 0f                	js     802a3f <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802a30:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802a33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a37:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a3f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a43:	c9                   	leave
+  802a44:	c3                   	ret
+
+0000000000802a45 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802a45:	55                   	push   %rbp
+  802a46:	48 89 e5             	mov    %rsp,%rbp
+  802a49:	41 54                	push   %r12
+  802a4b:	53                   	push   %rbx
+  802a4c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802a4f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a54:	48 b8 38 36 80 00 00 	movabs $0x803638,%rax
+  802a5b:	00 00 00 
+  802a5e:	ff d0                	call   *%rax
+  802a60:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802a62:	85 c0                	test   %eax,%eax
+  802a64:	78 25                	js     802a8b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802a66:	4c 89 e6             	mov    %r12,%rsi
+  802a69:	89 c7                	mov    %eax,%edi
+  802a6b:	48 b8 11 29 80 00 00 	movabs $0x802911,%rax
+  802a72:	00 00 00 
+  802a75:	ff d0                	call   *%rax
+  802a77:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802a7a:	89 df                	mov    %ebx,%edi
+  802a7c:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  802a83:	00 00 00 
+  802a86:	ff d0                	call   *%rax
+
+    return res;
+  802a88:	44 89 e3             	mov    %r12d,%ebx
+}
+  802a8b:	89 d8                	mov    %ebx,%eax
+  802a8d:	5b                   	pop    %rbx
+  802a8e:	41 5c                	pop    %r12
+  802a90:	5d                   	pop    %rbp
+  802a91:	c3                   	ret
+
+0000000000802a92 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802a92:	55                   	push   %rbp
+  802a93:	48 89 e5             	mov    %rsp,%rbp
+  802a96:	53                   	push   %rbx
+  802a97:	48 83 ec 08          	sub    $0x8,%rsp
+  802a9b:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802a9e:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  802aa5:	00 00 00 
+  802aa8:	ff d0                	call   *%rax
+  802aaa:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802aae:	0f 87 ea 00 00 00    	ja     802b9e <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802ab4:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802abb:	00 00 00 
+  802abe:	80 38 00             	cmpb   $0x0,(%rax)
+  802ac1:	75 35                	jne    802af8 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802ac3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ac8:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802acd:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802ad2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ad7:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  802ade:	00 00 00 
+  802ae1:	ff d0                	call   *%rax
+  802ae3:	85 c0                	test   %eax,%eax
+  802ae5:	0f 88 ba 00 00 00    	js     802ba5 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802aeb:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802af2:	00 00 00 
+  802af5:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802af8:	48 89 df             	mov    %rbx,%rdi
+  802afb:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  802b02:	00 00 00 
+  802b05:	ff d0                	call   *%rax
+  802b07:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802b0b:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802b12:	00 00 00 
+  802b15:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802b19:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802b1c:	39 39                	cmp    %edi,(%rcx)
+  802b1e:	74 46                	je     802b66 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802b20:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802b24:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802b2b:	00 
+  802b2c:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802b33:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802b3a:	00 
+  802b3b:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802b42:	00 
+  802b43:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802b4a:	00 
+  802b4b:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802b52:	00 
+  802b53:	89 39                	mov    %edi,(%rcx)
+  802b55:	48 01 c6             	add    %rax,%rsi
+  802b58:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802b5d:	48 89 c8             	mov    %rcx,%rax
+  802b60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b64:	c9                   	leave
+  802b65:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802b66:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802b6a:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802b71:	00 00 00 
+  802b74:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802b77:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802b7b:	74 e0                	je     802b5d <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802b7d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802b84:	00 
+  802b85:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802b89:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802b90:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802b92:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802b95:	48 01 c2             	add    %rax,%rdx
+  802b98:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802b9c:	eb bf                	jmp    802b5d <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802b9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ba3:	eb b8                	jmp    802b5d <fbuf_get+0xcb>
+            return NULL;
+  802ba5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802baa:	eb b1                	jmp    802b5d <fbuf_get+0xcb>
+
+0000000000802bac <fsipc_bulk>:
+fsipc_bulk(void) {
+  802bac:	55                   	push   %rbp
+  802bad:	48 89 e5             	mov    %rsp,%rbp
+  802bb0:	53                   	push   %rbx
+  802bb1:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802bb5:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802bbc:	00 00 00 
+  802bbf:	48 8b 18             	mov    (%rax),%rbx
+  802bc2:	48 85 db             	test   %rbx,%rbx
+  802bc5:	74 16                	je     802bdd <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802bc7:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802bce:	00 00 00 
+  802bd1:	48 8b 18             	mov    (%rax),%rbx
+}
+  802bd4:	48 89 d8             	mov    %rbx,%rax
+  802bd7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bdb:	c9                   	leave
+  802bdc:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802bdd:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802be2:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802be7:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802bec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf1:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  802bf8:	00 00 00 
+  802bfb:	ff d0                	call   *%rax
+  802bfd:	85 c0                	test   %eax,%eax
+  802bff:	78 d3                	js     802bd4 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802c01:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802c06:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802c0d:	00 00 00 
+  802c10:	eb b5                	jmp    802bc7 <fsipc_bulk+0x1b>
+
+0000000000802c12 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802c12:	55                   	push   %rbp
+  802c13:	48 89 e5             	mov    %rsp,%rbp
+  802c16:	41 57                	push   %r15
+  802c18:	41 56                	push   %r14
+  802c1a:	41 55                	push   %r13
+  802c1c:	41 54                	push   %r12
+  802c1e:	53                   	push   %rbx
+  802c1f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c23:	41 89 fd             	mov    %edi,%r13d
+  802c26:	49 89 f6             	mov    %rsi,%r14
+  802c29:	49 89 d7             	mov    %rdx,%r15
+  802c2c:	48 89 cb             	mov    %rcx,%rbx
+  802c2f:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c32:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802c39:	00 00 00 
+  802c3c:	83 38 00             	cmpl   $0x0,(%rax)
+  802c3f:	74 52                	je     802c93 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802c41:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c47:	4c 89 f9             	mov    %r15,%rcx
+  802c4a:	4c 89 f2             	mov    %r14,%rdx
+  802c4d:	44 89 ee             	mov    %r13d,%esi
+  802c50:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802c57:	00 00 00 
+  802c5a:	8b 38                	mov    (%rax),%edi
+  802c5c:	48 b8 bf 48 80 00 00 	movabs $0x8048bf,%rax
+  802c63:	00 00 00 
+  802c66:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802c68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c6d:	4c 89 e2             	mov    %r12,%rdx
+  802c70:	48 89 de             	mov    %rbx,%rsi
+  802c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c78:	48 b8 0f 47 80 00 00 	movabs $0x80470f,%rax
+  802c7f:	00 00 00 
+  802c82:	ff d0                	call   *%rax
+}
+  802c84:	48 83 c4 08          	add    $0x8,%rsp
+  802c88:	5b                   	pop    %rbx
+  802c89:	41 5c                	pop    %r12
+  802c8b:	41 5d                	pop    %r13
+  802c8d:	41 5e                	pop    %r14
+  802c8f:	41 5f                	pop    %r15
+  802c91:	5d                   	pop    %rbp
+  802c92:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c93:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c98:	48 b8 62 49 80 00 00 	movabs $0x804962,%rax
+  802c9f:	00 00 00 
+  802ca2:	ff d0                	call   *%rax
+  802ca4:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802cab:	00 00 
+  802cad:	eb 92                	jmp    802c41 <fsipc_region+0x2f>
+
+0000000000802caf <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802caf:	55                   	push   %rbp
+  802cb0:	48 89 e5             	mov    %rsp,%rbp
+  802cb3:	41 57                	push   %r15
+  802cb5:	41 56                	push   %r14
+  802cb7:	41 55                	push   %r13
+  802cb9:	41 54                	push   %r12
+  802cbb:	53                   	push   %rbx
+  802cbc:	48 83 ec 28          	sub    $0x28,%rsp
+  802cc0:	49 89 ff             	mov    %rdi,%r15
+  802cc3:	49 89 f6             	mov    %rsi,%r14
+  802cc6:	48 89 d3             	mov    %rdx,%rbx
+  802cc9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802ccd:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802cd0:	48 b8 ac 2b 80 00 00 	movabs $0x802bac,%rax
+  802cd7:	00 00 00 
+  802cda:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802cdc:	48 85 c0             	test   %rax,%rax
+  802cdf:	0f 84 cc 00 00 00    	je     802db1 <devfile_write_direct+0x102>
+  802ce5:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802ce8:	48 85 db             	test   %rbx,%rbx
+  802ceb:	0f 84 ba 00 00 00    	je     802dab <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802cf1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802cf7:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802cfe:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802d02:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802d06:	4c 29 e3             	sub    %r12,%rbx
+  802d09:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802d0e:	48 39 c3             	cmp    %rax,%rbx
+  802d11:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802d15:	48 89 da             	mov    %rbx,%rdx
+  802d18:	4c 89 f6             	mov    %r14,%rsi
+  802d1b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802d1f:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  802d26:	00 00 00 
+  802d29:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802d2b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d2f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802d33:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802d36:	44 01 e0             	add    %r12d,%eax
+  802d39:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802d3d:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802d41:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802d48:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802d4f:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802d56:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d61:	4c 89 ee             	mov    %r13,%rsi
+  802d64:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d69:	48 b8 12 2c 80 00 00 	movabs $0x802c12,%rax
+  802d70:	00 00 00 
+  802d73:	ff d0                	call   *%rax
+        if (res < 0)
+  802d75:	85 c0                	test   %eax,%eax
+  802d77:	78 29                	js     802da2 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802d79:	74 2b                	je     802da6 <devfile_write_direct+0xf7>
+        i += res;
+  802d7b:	48 98                	cltq
+  802d7d:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802d80:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802d83:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d87:	49 39 c4             	cmp    %rax,%r12
+  802d8a:	0f 82 72 ff ff ff    	jb     802d02 <devfile_write_direct+0x53>
+    return i;
+  802d90:	4c 89 e0             	mov    %r12,%rax
+}
+  802d93:	48 83 c4 28          	add    $0x28,%rsp
+  802d97:	5b                   	pop    %rbx
+  802d98:	41 5c                	pop    %r12
+  802d9a:	41 5d                	pop    %r13
+  802d9c:	41 5e                	pop    %r14
+  802d9e:	41 5f                	pop    %r15
+  802da0:	5d                   	pop    %rbp
+  802da1:	c3                   	ret
+            return res;
+  802da2:	48 98                	cltq
+  802da4:	eb ed                	jmp    802d93 <devfile_write_direct+0xe4>
+            return i;
+  802da6:	4c 89 e0             	mov    %r12,%rax
+  802da9:	eb e8                	jmp    802d93 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802dab:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802daf:	eb df                	jmp    802d90 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802db1:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802db8:	eb d9                	jmp    802d93 <devfile_write_direct+0xe4>
+
+0000000000802dba <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802dba:	55                   	push   %rbp
+  802dbb:	48 89 e5             	mov    %rsp,%rbp
+  802dbe:	41 56                	push   %r14
+  802dc0:	41 55                	push   %r13
+  802dc2:	41 54                	push   %r12
+  802dc4:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802dc5:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802dc9:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd2:	4d 39 ee             	cmp    %r13,%r14
+  802dd5:	0f 84 99 00 00 00    	je     802e74 <fbuf_flush+0xba>
+  802ddb:	49 89 fc             	mov    %rdi,%r12
+  802dde:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802de1:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802de4:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802de8:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  802def:	00 00 00 
+  802df2:	ff d0                	call   *%rax
+  802df4:	48 89 c2             	mov    %rax,%rdx
+  802df7:	48 c1 e2 04          	shl    $0x4,%rdx
+  802dfb:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802dff:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e03:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802e08:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802e0b:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802e0f:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802e16:	00 
+  802e17:	44 89 f1             	mov    %r14d,%ecx
+  802e1a:	4c 89 ea             	mov    %r13,%rdx
+  802e1d:	4c 89 e7             	mov    %r12,%rdi
+  802e20:	48 b8 af 2c 80 00 00 	movabs $0x802caf,%rax
+  802e27:	00 00 00 
+  802e2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e2c:	48 85 c0             	test   %rax,%rax
+  802e2f:	78 43                	js     802e74 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802e31:	4c 39 e8             	cmp    %r13,%rax
+  802e34:	72 47                	jb     802e7d <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802e36:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802e3b:	83 c0 01             	add    $0x1,%eax
+  802e3e:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e43:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802e46:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802e4a:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802e4e:	72 0f                	jb     802e5f <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802e50:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802e54:	48 39 c2             	cmp    %rax,%rdx
+  802e57:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802e5b:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802e5f:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802e66:	00 
+  802e67:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802e6e:	00 
+    return 0;
+  802e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e74:	5b                   	pop    %rbx
+  802e75:	41 5c                	pop    %r12
+  802e77:	41 5d                	pop    %r13
+  802e79:	41 5e                	pop    %r14
+  802e7b:	5d                   	pop    %rbp
+  802e7c:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802e7d:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802e82:	eb f0                	jmp    802e74 <fbuf_flush+0xba>
+
+0000000000802e84 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802e84:	55                   	push   %rbp
+  802e85:	48 89 e5             	mov    %rsp,%rbp
+  802e88:	53                   	push   %rbx
+  802e89:	48 83 ec 08          	sub    $0x8,%rsp
+  802e8d:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802e90:	48 b8 92 2a 80 00 00 	movabs $0x802a92,%rax
+  802e97:	00 00 00 
+  802e9a:	ff d0                	call   *%rax
+  802e9c:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea4:	48 85 f6             	test   %rsi,%rsi
+  802ea7:	74 0f                	je     802eb8 <devfile_sync+0x34>
+  802ea9:	48 89 df             	mov    %rbx,%rdi
+  802eac:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  802eb3:	00 00 00 
+  802eb6:	ff d0                	call   *%rax
+}
+  802eb8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ebc:	c9                   	leave
+  802ebd:	c3                   	ret
+
+0000000000802ebe <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802ebe:	55                   	push   %rbp
+  802ebf:	48 89 e5             	mov    %rsp,%rbp
+  802ec2:	48 83 ec 10          	sub    $0x10,%rsp
+  802ec6:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802ec9:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802ed0:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802ed1:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802ed5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802eda:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802ee1:	00 00 00 
+  802ee4:	48 b8 12 2c 80 00 00 	movabs $0x802c12,%rax
+  802eeb:	00 00 00 
+  802eee:	ff d0                	call   *%rax
+}
+  802ef0:	c9                   	leave
+  802ef1:	c3                   	ret
+
+0000000000802ef2 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ef2:	55                   	push   %rbp
+  802ef3:	48 89 e5             	mov    %rsp,%rbp
+  802ef6:	41 54                	push   %r12
+  802ef8:	53                   	push   %rbx
+  802ef9:	48 89 fb             	mov    %rdi,%rbx
+  802efc:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802eff:	48 b8 84 2e 80 00 00 	movabs $0x802e84,%rax
+  802f06:	00 00 00 
+  802f09:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f0b:	85 c0                	test   %eax,%eax
+  802f0d:	78 63                	js     802f72 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802f0f:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f12:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802f19:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802f1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802f20:	bf 05 00 00 00       	mov    $0x5,%edi
+  802f25:	48 b8 be 2e 80 00 00 	movabs $0x802ebe,%rax
+  802f2c:	00 00 00 
+  802f2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f31:	85 c0                	test   %eax,%eax
+  802f33:	78 3d                	js     802f72 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802f35:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802f3c:	00 00 00 
+  802f3f:	48 89 de             	mov    %rbx,%rsi
+  802f42:	4c 89 e7             	mov    %r12,%rdi
+  802f45:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  802f4c:	00 00 00 
+  802f4f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802f51:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802f57:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802f5e:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802f5f:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802f65:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802f6c:	00 
+
+    return 0;
+  802f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f72:	5b                   	pop    %rbx
+  802f73:	41 5c                	pop    %r12
+  802f75:	5d                   	pop    %rbp
+  802f76:	c3                   	ret
+
+0000000000802f77 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802f77:	55                   	push   %rbp
+  802f78:	48 89 e5             	mov    %rsp,%rbp
+  802f7b:	41 54                	push   %r12
+  802f7d:	53                   	push   %rbx
+  802f7e:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802f81:	48 b8 84 2e 80 00 00 	movabs $0x802e84,%rax
+  802f88:	00 00 00 
+  802f8b:	ff d0                	call   *%rax
+  802f8d:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802f90:	48 89 df             	mov    %rbx,%rdi
+  802f93:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  802f9a:	00 00 00 
+  802f9d:	ff d0                	call   *%rax
+  802f9f:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802fa3:	76 2e                	jbe    802fd3 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802fa5:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802fa8:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802faf:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802fb1:	be 00 00 00 00       	mov    $0x0,%esi
+  802fb6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802fbb:	48 b8 be 2e 80 00 00 	movabs $0x802ebe,%rax
+  802fc2:	00 00 00 
+  802fc5:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802fc7:	45 85 e4             	test   %r12d,%r12d
+  802fca:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802fce:	5b                   	pop    %rbx
+  802fcf:	41 5c                	pop    %r12
+  802fd1:	5d                   	pop    %rbp
+  802fd2:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802fd3:	48 89 df             	mov    %rbx,%rdi
+  802fd6:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  802fdd:	00 00 00 
+  802fe0:	ff d0                	call   *%rax
+  802fe2:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802fe6:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802fed:	00 00 00 
+  802ff0:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802ff7:	48 89 df             	mov    %rbx,%rdi
+  802ffa:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  803001:	00 00 00 
+  803004:	ff d0                	call   *%rax
+  803006:	48 89 c6             	mov    %rax,%rsi
+  803009:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80300e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803013:	48 b8 0d 19 80 00 00 	movabs $0x80190d,%rax
+  80301a:	00 00 00 
+  80301d:	ff d0                	call   *%rax
+  80301f:	eb 84                	jmp    802fa5 <devfile_flush+0x2e>
+
+0000000000803021 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803021:	55                   	push   %rbp
+  803022:	48 89 e5             	mov    %rsp,%rbp
+  803025:	41 55                	push   %r13
+  803027:	41 54                	push   %r12
+  803029:	53                   	push   %rbx
+  80302a:	48 83 ec 08          	sub    $0x8,%rsp
+  80302e:	48 89 fb             	mov    %rdi,%rbx
+  803031:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  803034:	48 b8 92 2a 80 00 00 	movabs $0x802a92,%rax
+  80303b:	00 00 00 
+  80303e:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803040:	48 85 c0             	test   %rax,%rax
+  803043:	74 51                	je     803096 <devfile_trunc+0x75>
+  803045:	49 89 c4             	mov    %rax,%r12
+  803048:	48 89 c6             	mov    %rax,%rsi
+  80304b:	48 89 df             	mov    %rbx,%rdi
+  80304e:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  803055:	00 00 00 
+  803058:	ff d0                	call   *%rax
+  80305a:	85 c0                	test   %eax,%eax
+  80305c:	78 2d                	js     80308b <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80305e:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  803065:	00 00 00 
+  803068:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80306b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80306d:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803071:	be 00 00 00 00       	mov    $0x0,%esi
+  803076:	bf 02 00 00 00       	mov    $0x2,%edi
+  80307b:	48 b8 be 2e 80 00 00 	movabs $0x802ebe,%rax
+  803082:	00 00 00 
+  803085:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803087:	85 c0                	test   %eax,%eax
+  803089:	79 3e                	jns    8030c9 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  80308b:	48 83 c4 08          	add    $0x8,%rsp
+  80308f:	5b                   	pop    %rbx
+  803090:	41 5c                	pop    %r12
+  803092:	41 5d                	pop    %r13
+  803094:	5d                   	pop    %rbp
+  803095:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803096:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  80309d:	00 00 00 
+  8030a0:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8030a3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8030a5:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  8030a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ae:	bf 02 00 00 00       	mov    $0x2,%edi
+  8030b3:	48 b8 be 2e 80 00 00 	movabs $0x802ebe,%rax
+  8030ba:	00 00 00 
+  8030bd:	ff d0                	call   *%rax
+    if (res >= 0) {
+  8030bf:	85 c0                	test   %eax,%eax
+  8030c1:	78 c8                	js     80308b <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  8030c3:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8030c7:	eb c2                	jmp    80308b <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  8030c9:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  8030cc:	8d 51 01             	lea    0x1(%rcx),%edx
+  8030cf:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8030d2:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  8030d7:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8030de:	00 00 
+  8030e0:	eb a9                	jmp    80308b <devfile_trunc+0x6a>
+
+00000000008030e2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8030e2:	55                   	push   %rbp
+  8030e3:	48 89 e5             	mov    %rsp,%rbp
+  8030e6:	41 57                	push   %r15
+  8030e8:	41 56                	push   %r14
+  8030ea:	41 55                	push   %r13
+  8030ec:	41 54                	push   %r12
+  8030ee:	53                   	push   %rbx
+  8030ef:	48 83 ec 28          	sub    $0x28,%rsp
+  8030f3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8030f7:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8030fb:	49 89 d7             	mov    %rdx,%r15
+  8030fe:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803102:	48 b8 92 2a 80 00 00 	movabs $0x802a92,%rax
+  803109:	00 00 00 
+  80310c:	ff d0                	call   *%rax
+  80310e:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  803111:	48 85 c0             	test   %rax,%rax
+  803114:	74 31                	je     803147 <devfile_write+0x65>
+  803116:	4c 89 f8             	mov    %r15,%rax
+  803119:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  803120:	77 25                	ja     803147 <devfile_write+0x65>
+    size_t i = 0;
+  803122:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  803128:	48 85 c0             	test   %rax,%rax
+  80312b:	0f 85 64 01 00 00    	jne    803295 <devfile_write+0x1b3>
+    size_t i = 0;
+  803131:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  803135:	4c 89 f8             	mov    %r15,%rax
+}
+  803138:	48 83 c4 28          	add    $0x28,%rsp
+  80313c:	5b                   	pop    %rbx
+  80313d:	41 5c                	pop    %r12
+  80313f:	41 5d                	pop    %r13
+  803141:	41 5e                	pop    %r14
+  803143:	41 5f                	pop    %r15
+  803145:	5d                   	pop    %rbp
+  803146:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803147:	48 85 db             	test   %rbx,%rbx
+  80314a:	74 5b                	je     8031a7 <devfile_write+0xc5>
+  80314c:	48 89 de             	mov    %rbx,%rsi
+  80314f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803153:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  80315a:	00 00 00 
+  80315d:	ff d0                	call   *%rax
+  80315f:	85 c0                	test   %eax,%eax
+  803161:	78 40                	js     8031a3 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803163:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803167:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  80316a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80316e:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803172:	48 b8 af 2c 80 00 00 	movabs $0x802caf,%rax
+  803179:	00 00 00 
+  80317c:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80317e:	48 85 c0             	test   %rax,%rax
+  803181:	7e b5                	jle    803138 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803183:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803187:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  80318a:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  80318d:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803190:	8d 51 01             	lea    0x1(%rcx),%edx
+  803193:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803196:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  803199:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8031a0:	00 
+  8031a1:	eb 95                	jmp    803138 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8031a3:	48 98                	cltq
+  8031a5:	eb 91                	jmp    803138 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  8031a7:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8031ab:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  8031ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031b2:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8031b6:	48 89 df             	mov    %rbx,%rdi
+  8031b9:	48 b8 af 2c 80 00 00 	movabs $0x802caf,%rax
+  8031c0:	00 00 00 
+  8031c3:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8031c5:	48 85 c0             	test   %rax,%rax
+  8031c8:	0f 8e 6a ff ff ff    	jle    803138 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8031ce:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  8031d1:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8031d5:	e9 5e ff ff ff       	jmp    803138 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8031da:	48 98                	cltq
+  8031dc:	4d 85 ff             	test   %r15,%r15
+  8031df:	49 0f 45 c7          	cmovne %r15,%rax
+  8031e3:	e9 50 ff ff ff       	jmp    803138 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8031e8:	48 89 de             	mov    %rbx,%rsi
+  8031eb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031ef:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  8031f6:	00 00 00 
+  8031f9:	ff d0                	call   *%rax
+  8031fb:	85 c0                	test   %eax,%eax
+  8031fd:	0f 88 2b 01 00 00    	js     80332e <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803203:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803207:	4c 01 f8             	add    %r15,%rax
+  80320a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80320e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803212:	48 b9 be 22 80 00 00 	movabs $0x8022be,%rcx
+  803219:	00 00 00 
+  80321c:	ff d1                	call   *%rcx
+  80321e:	48 89 c2             	mov    %rax,%rdx
+  803221:	48 c1 e2 04          	shl    $0x4,%rdx
+  803225:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803229:	48 c1 e0 0c          	shl    $0xc,%rax
+  80322d:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803232:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803235:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80323c:	00 
+  80323d:	4c 89 ea             	mov    %r13,%rdx
+  803240:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803244:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  80324b:	00 00 00 
+  80324e:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803250:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803254:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803258:	48 39 c2             	cmp    %rax,%rdx
+  80325b:	0f 84 db 00 00 00    	je     80333c <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803261:	4c 39 e2             	cmp    %r12,%rdx
+  803264:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  803268:	4d 01 ec             	add    %r13,%r12
+  80326b:	49 39 c4             	cmp    %rax,%r12
+  80326e:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803272:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803276:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  80327a:	45 01 ee             	add    %r13d,%r14d
+  80327d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803281:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803285:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803288:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80328c:	49 39 c7             	cmp    %rax,%r15
+  80328f:	0f 83 a0 fe ff ff    	jae    803135 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803295:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803299:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  80329d:	8b 43 08             	mov    0x8(%rbx),%eax
+  8032a0:	44 39 f0             	cmp    %r14d,%eax
+  8032a3:	7f 10                	jg     8032b5 <devfile_write+0x1d3>
+  8032a5:	48 98                	cltq
+  8032a7:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  8032ad:	49 63 d6             	movslq %r14d,%rdx
+  8032b0:	48 39 d0             	cmp    %rdx,%rax
+  8032b3:	7d 2d                	jge    8032e2 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8032b5:	48 89 de             	mov    %rbx,%rsi
+  8032b8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8032bc:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  8032c3:	00 00 00 
+  8032c6:	ff d0                	call   *%rax
+  8032c8:	85 c0                	test   %eax,%eax
+  8032ca:	0f 88 0a ff ff ff    	js     8031da <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8032d0:	44 89 f0             	mov    %r14d,%eax
+  8032d3:	66 b8 00 00          	mov    $0x0,%ax
+  8032d7:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  8032da:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8032e1:	00 
+        size_t off = pos - fb->fb_base;
+  8032e2:	45 89 f4             	mov    %r14d,%r12d
+  8032e5:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  8032e9:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  8032ec:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  8032f0:	4d 29 fd             	sub    %r15,%r13
+  8032f3:	b8 00 00 01 00       	mov    $0x10000,%eax
+  8032f8:	4c 29 e0             	sub    %r12,%rax
+  8032fb:	49 39 c5             	cmp    %rax,%r13
+  8032fe:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803302:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803306:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80330a:	48 39 c2             	cmp    %rax,%rdx
+  80330d:	0f 84 f0 fe ff ff    	je     803203 <devfile_write+0x121>
+  803313:	4c 39 e0             	cmp    %r12,%rax
+  803316:	0f 82 cc fe ff ff    	jb     8031e8 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  80331c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803320:	48 39 d0             	cmp    %rdx,%rax
+  803323:	0f 83 da fe ff ff    	jae    803203 <devfile_write+0x121>
+  803329:	e9 ba fe ff ff       	jmp    8031e8 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80332e:	48 98                	cltq
+  803330:	4d 85 ff             	test   %r15,%r15
+  803333:	49 0f 45 c7          	cmovne %r15,%rax
+  803337:	e9 fc fd ff ff       	jmp    803138 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  80333c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803340:	4c 89 e2             	mov    %r12,%rdx
+  803343:	e9 2a ff ff ff       	jmp    803272 <devfile_write+0x190>
+
+0000000000803348 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803348:	55                   	push   %rbp
+  803349:	48 89 e5             	mov    %rsp,%rbp
+  80334c:	41 57                	push   %r15
+  80334e:	41 56                	push   %r14
+  803350:	41 55                	push   %r13
+  803352:	41 54                	push   %r12
+  803354:	53                   	push   %rbx
+  803355:	48 83 ec 28          	sub    $0x28,%rsp
+  803359:	49 89 ff             	mov    %rdi,%r15
+  80335c:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803360:	48 89 d3             	mov    %rdx,%rbx
+  803363:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803367:	48 b8 92 2a 80 00 00 	movabs $0x802a92,%rax
+  80336e:	00 00 00 
+  803371:	ff d0                	call   *%rax
+  803373:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803376:	48 85 c0             	test   %rax,%rax
+  803379:	74 0d                	je     803388 <devfile_read+0x40>
+  80337b:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803382:	0f 86 1a 01 00 00    	jbe    8034a2 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803388:	4d 85 e4             	test   %r12,%r12
+  80338b:	74 1a                	je     8033a7 <devfile_read+0x5f>
+  80338d:	4c 89 e6             	mov    %r12,%rsi
+  803390:	4c 89 ff             	mov    %r15,%rdi
+  803393:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  80339a:	00 00 00 
+  80339d:	ff d0                	call   *%rax
+  80339f:	85 c0                	test   %eax,%eax
+  8033a1:	0f 88 e8 00 00 00    	js     80348f <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8033a7:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8033ab:	48 b8 ac 2b 80 00 00 	movabs $0x802bac,%rax
+  8033b2:	00 00 00 
+  8033b5:	ff d0                	call   *%rax
+  8033b7:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  8033ba:	48 85 c0             	test   %rax,%rax
+  8033bd:	0f 84 69 02 00 00    	je     80362c <devfile_read+0x2e4>
+    while (i < n) {
+  8033c3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8033c8:	0f 84 ce 00 00 00    	je     80349c <devfile_read+0x154>
+    size_t i = 0;
+  8033ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8033d3:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8033da:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8033de:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  8033e2:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  8033e6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8033ea:	48 29 da             	sub    %rbx,%rdx
+  8033ed:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8033f2:	48 39 c2             	cmp    %rax,%rdx
+  8033f5:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  8033f9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8033fd:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803401:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803404:	01 d8                	add    %ebx,%eax
+  803406:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  80340a:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  80340e:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803415:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80341c:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803423:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803429:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80342e:	4c 89 ee             	mov    %r13,%rsi
+  803431:	bf 03 00 00 00       	mov    $0x3,%edi
+  803436:	48 b8 12 2c 80 00 00 	movabs $0x802c12,%rax
+  80343d:	00 00 00 
+  803440:	ff d0                	call   *%rax
+        if (res < 0)
+  803442:	85 c0                	test   %eax,%eax
+  803444:	78 4d                	js     803493 <devfile_read+0x14b>
+        if (res == 0)
+  803446:	74 4f                	je     803497 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803448:	4c 63 e0             	movslq %eax,%r12
+  80344b:	4c 89 e2             	mov    %r12,%rdx
+  80344e:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803452:	4c 89 f7             	mov    %r14,%rdi
+  803455:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  80345c:	00 00 00 
+  80345f:	ff d0                	call   *%rax
+        i += res;
+  803461:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803464:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803467:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80346b:	48 39 c3             	cmp    %rax,%rbx
+  80346e:	0f 82 72 ff ff ff    	jb     8033e6 <devfile_read+0x9e>
+    return i;
+  803474:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803477:	48 85 c0             	test   %rax,%rax
+  80347a:	7e 04                	jle    803480 <devfile_read+0x138>
+  80347c:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803480:	48 83 c4 28          	add    $0x28,%rsp
+  803484:	5b                   	pop    %rbx
+  803485:	41 5c                	pop    %r12
+  803487:	41 5d                	pop    %r13
+  803489:	41 5e                	pop    %r14
+  80348b:	41 5f                	pop    %r15
+  80348d:	5d                   	pop    %rbp
+  80348e:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80348f:	48 98                	cltq
+  803491:	eb ed                	jmp    803480 <devfile_read+0x138>
+            return res;
+  803493:	48 98                	cltq
+  803495:	eb e9                	jmp    803480 <devfile_read+0x138>
+            return i;
+  803497:	48 89 d8             	mov    %rbx,%rax
+  80349a:	eb db                	jmp    803477 <devfile_read+0x12f>
+    size_t i = 0;
+  80349c:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8034a0:	eb d2                	jmp    803474 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8034a2:	48 89 c6             	mov    %rax,%rsi
+  8034a5:	4c 89 ff             	mov    %r15,%rdi
+  8034a8:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  8034af:	00 00 00 
+  8034b2:	ff d0                	call   *%rax
+  8034b4:	85 c0                	test   %eax,%eax
+  8034b6:	78 40                	js     8034f8 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8034b8:	4c 89 ff             	mov    %r15,%rdi
+  8034bb:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  8034c2:	00 00 00 
+  8034c5:	ff d0                	call   *%rax
+  8034c7:	48 89 c2             	mov    %rax,%rdx
+  8034ca:	48 c1 e2 04          	shl    $0x4,%rdx
+  8034ce:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8034d2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8034d6:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8034db:	48 01 d0             	add    %rdx,%rax
+  8034de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8034e2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8034e7:	0f 84 33 01 00 00    	je     803620 <devfile_read+0x2d8>
+    size_t i = 0;
+  8034ed:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8034f3:	e9 f5 00 00 00       	jmp    8035ed <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8034f8:	48 98                	cltq
+  8034fa:	eb 84                	jmp    803480 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8034fc:	44 89 e8             	mov    %r13d,%eax
+  8034ff:	66 b8 00 00          	mov    $0x0,%ax
+  803503:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803508:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80350f:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803511:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803515:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803519:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  80351b:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803520:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803523:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  80352a:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  80352b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803531:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803536:	ba 00 10 01 00       	mov    $0x11000,%edx
+  80353b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803540:	48 b8 12 2c 80 00 00 	movabs $0x802c12,%rax
+  803547:	00 00 00 
+  80354a:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  80354c:	85 c0                	test   %eax,%eax
+  80354e:	0f 88 be 00 00 00    	js     803612 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803554:	48 63 d0             	movslq %eax,%rdx
+  803557:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  80355c:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803561:	44 39 e8             	cmp    %r13d,%eax
+  803564:	0f 8e ba 00 00 00    	jle    803624 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80356a:	49 63 c5             	movslq %r13d,%rax
+  80356d:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803572:	48 29 c3             	sub    %rax,%rbx
+  803575:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80357a:	48 01 c3             	add    %rax,%rbx
+  80357d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803581:	4c 29 f0             	sub    %r14,%rax
+  803584:	48 39 c3             	cmp    %rax,%rbx
+  803587:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80358b:	4c 89 ff             	mov    %r15,%rdi
+  80358e:	48 b9 be 22 80 00 00 	movabs $0x8022be,%rcx
+  803595:	00 00 00 
+  803598:	ff d1                	call   *%rcx
+  80359a:	48 89 c2             	mov    %rax,%rdx
+  80359d:	48 c1 e2 04          	shl    $0x4,%rdx
+  8035a1:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8035a5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8035a9:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8035ae:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8035b1:	44 89 ea             	mov    %r13d,%edx
+  8035b4:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8035b9:	48 63 d2             	movslq %edx,%rdx
+  8035bc:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8035c3:	00 
+  8035c4:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8035c8:	4c 01 f7             	add    %r14,%rdi
+  8035cb:	48 89 da             	mov    %rbx,%rdx
+  8035ce:	48 b9 c3 13 80 00 00 	movabs $0x8013c3,%rcx
+  8035d5:	00 00 00 
+  8035d8:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8035da:	41 01 dd             	add    %ebx,%r13d
+  8035dd:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8035e1:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8035e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035e8:	49 39 c6             	cmp    %rax,%r14
+  8035eb:	73 37                	jae    803624 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8035ed:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8035f1:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8035f6:	44 39 e8             	cmp    %r13d,%eax
+  8035f9:	0f 8f fd fe ff ff    	jg     8034fc <devfile_read+0x1b4>
+  8035ff:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803604:	44 39 e8             	cmp    %r13d,%eax
+  803607:	0f 8f 5d ff ff ff    	jg     80356a <devfile_read+0x222>
+  80360d:	e9 ea fe ff ff       	jmp    8034fc <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803612:	48 98                	cltq
+  803614:	4d 85 f6             	test   %r14,%r14
+  803617:	49 0f 45 c6          	cmovne %r14,%rax
+  80361b:	e9 60 fe ff ff       	jmp    803480 <devfile_read+0x138>
+    size_t i = 0;
+  803620:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803624:	4c 89 f0             	mov    %r14,%rax
+  803627:	e9 54 fe ff ff       	jmp    803480 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80362c:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803633:	e9 48 fe ff ff       	jmp    803480 <devfile_read+0x138>
+
+0000000000803638 <open>:
+open(const char *path, int mode) {
+  803638:	55                   	push   %rbp
+  803639:	48 89 e5             	mov    %rsp,%rbp
+  80363c:	41 55                	push   %r13
+  80363e:	41 54                	push   %r12
+  803640:	53                   	push   %rbx
+  803641:	48 83 ec 18          	sub    $0x18,%rsp
+  803645:	49 89 fc             	mov    %rdi,%r12
+  803648:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80364b:	48 b8 90 0f 80 00 00 	movabs $0x800f90,%rax
+  803652:	00 00 00 
+  803655:	ff d0                	call   *%rax
+  803657:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80365d:	0f 87 8a 00 00 00    	ja     8036ed <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803663:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803667:	48 b8 ec 22 80 00 00 	movabs $0x8022ec,%rax
+  80366e:	00 00 00 
+  803671:	ff d0                	call   *%rax
+  803673:	89 c3                	mov    %eax,%ebx
+  803675:	85 c0                	test   %eax,%eax
+  803677:	78 50                	js     8036c9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803679:	4c 89 e6             	mov    %r12,%rsi
+  80367c:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803683:	00 00 00 
+  803686:	48 89 df             	mov    %rbx,%rdi
+  803689:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803695:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80369c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8036a0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8036a5:	48 b8 be 2e 80 00 00 	movabs $0x802ebe,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+  8036b1:	89 c3                	mov    %eax,%ebx
+  8036b3:	85 c0                	test   %eax,%eax
+  8036b5:	78 1f                	js     8036d6 <open+0x9e>
+    return fd2num(fd);
+  8036b7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036bb:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  8036c2:	00 00 00 
+  8036c5:	ff d0                	call   *%rax
+  8036c7:	89 c3                	mov    %eax,%ebx
+}
+  8036c9:	89 d8                	mov    %ebx,%eax
+  8036cb:	48 83 c4 18          	add    $0x18,%rsp
+  8036cf:	5b                   	pop    %rbx
+  8036d0:	41 5c                	pop    %r12
+  8036d2:	41 5d                	pop    %r13
+  8036d4:	5d                   	pop    %rbp
+  8036d5:	c3                   	ret
+        fd_close(fd, 0);
+  8036d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8036db:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036df:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  8036e6:	00 00 00 
+  8036e9:	ff d0                	call   *%rax
+        return res;
+  8036eb:	eb dc                	jmp    8036c9 <open+0x91>
+        return -E_BAD_PATH;
+  8036ed:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8036f2:	eb d5                	jmp    8036c9 <open+0x91>
+
+00000000008036f4 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8036f4:	55                   	push   %rbp
+  8036f5:	48 89 e5             	mov    %rsp,%rbp
+  8036f8:	41 57                	push   %r15
+  8036fa:	41 56                	push   %r14
+  8036fc:	41 55                	push   %r13
+  8036fe:	41 54                	push   %r12
+  803700:	53                   	push   %rbx
+  803701:	48 83 ec 18          	sub    $0x18,%rsp
+  803705:	41 89 f6             	mov    %esi,%r14d
+  803708:	49 89 d7             	mov    %rdx,%r15
+  80370b:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80370e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803712:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  803719:	00 00 00 
+  80371c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80371e:	85 c0                	test   %eax,%eax
+  803720:	0f 88 db 00 00 00    	js     803801 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803726:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80372a:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803731:	00 00 00 
+  803734:	8b 00                	mov    (%rax),%eax
+  803736:	39 07                	cmp    %eax,(%rdi)
+  803738:	0f 85 db 00 00 00    	jne    803819 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80373e:	45 85 f6             	test   %r14d,%r14d
+  803741:	0f 88 db 00 00 00    	js     803822 <fmap+0x12e>
+  803747:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80374e:	0f 85 d7 00 00 00    	jne    80382b <fmap+0x137>
+  803754:	4c 89 fb             	mov    %r15,%rbx
+  803757:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80375d:	0f 85 d1 00 00 00    	jne    803834 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803763:	48 b8 84 2e 80 00 00 	movabs $0x802e84,%rax
+  80376a:	00 00 00 
+  80376d:	ff d0                	call   *%rax
+  80376f:	85 c0                	test   %eax,%eax
+  803771:	0f 88 8e 00 00 00    	js     803805 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803777:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80377e:	00 00 00 
+    while (i < n) {
+  803781:	4d 85 ed             	test   %r13,%r13
+  803784:	0f 84 8a 00 00 00    	je     803814 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80378a:	4c 89 ea             	mov    %r13,%rdx
+  80378d:	48 29 da             	sub    %rbx,%rdx
+  803790:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803797:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80379d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8037a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037a5:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037a8:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8037ac:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8037b0:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8037b5:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8037ba:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8037be:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8037c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037c7:	4c 89 e6             	mov    %r12,%rsi
+  8037ca:	bf 09 00 00 00       	mov    $0x9,%edi
+  8037cf:	48 b8 12 2c 80 00 00 	movabs $0x802c12,%rax
+  8037d6:	00 00 00 
+  8037d9:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8037db:	85 c0                	test   %eax,%eax
+  8037dd:	78 2a                	js     803809 <fmap+0x115>
+        i += res;
+  8037df:	48 98                	cltq
+  8037e1:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8037e4:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8037e8:	72 05                	jb     8037ef <fmap+0xfb>
+    while (i < n) {
+  8037ea:	4c 39 eb             	cmp    %r13,%rbx
+  8037ed:	72 9b                	jb     80378a <fmap+0x96>
+    }
+    return i;
+  8037ef:	48 89 d8             	mov    %rbx,%rax
+}
+  8037f2:	48 83 c4 18          	add    $0x18,%rsp
+  8037f6:	5b                   	pop    %rbx
+  8037f7:	41 5c                	pop    %r12
+  8037f9:	41 5d                	pop    %r13
+  8037fb:	41 5e                	pop    %r14
+  8037fd:	41 5f                	pop    %r15
+  8037ff:	5d                   	pop    %rbp
+  803800:	c3                   	ret
+    if (res < 0) return res;
+  803801:	48 98                	cltq
+  803803:	eb ed                	jmp    8037f2 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803805:	48 98                	cltq
+  803807:	eb e9                	jmp    8037f2 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803809:	48 98                	cltq
+  80380b:	48 85 db             	test   %rbx,%rbx
+  80380e:	48 0f 45 c3          	cmovne %rbx,%rax
+  803812:	eb de                	jmp    8037f2 <fmap+0xfe>
+    size_t i = 0;
+  803814:	4c 89 eb             	mov    %r13,%rbx
+  803817:	eb d6                	jmp    8037ef <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803819:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803820:	eb d0                	jmp    8037f2 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803822:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803829:	eb c7                	jmp    8037f2 <fmap+0xfe>
+  80382b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803832:	eb be                	jmp    8037f2 <fmap+0xfe>
+  803834:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80383b:	eb b5                	jmp    8037f2 <fmap+0xfe>
+
+000000000080383d <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80383d:	55                   	push   %rbp
+  80383e:	48 89 e5             	mov    %rsp,%rbp
+  803841:	41 56                	push   %r14
+  803843:	41 55                	push   %r13
+  803845:	41 54                	push   %r12
+  803847:	53                   	push   %rbx
+  803848:	48 83 ec 10          	sub    $0x10,%rsp
+  80384c:	89 fb                	mov    %edi,%ebx
+  80384e:	41 89 f4             	mov    %esi,%r12d
+  803851:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803854:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803858:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  80385f:	00 00 00 
+  803862:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803864:	85 c0                	test   %eax,%eax
+  803866:	78 63                	js     8038cb <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803868:	45 85 e4             	test   %r12d,%r12d
+  80386b:	0f 88 80 00 00 00    	js     8038f1 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803871:	45 89 e6             	mov    %r12d,%r14d
+  803874:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80387b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80387f:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  803886:	00 00 00 
+  803889:	ff d0                	call   *%rax
+  80388b:	48 89 c2             	mov    %rax,%rdx
+  80388e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803893:	44 89 f6             	mov    %r14d,%esi
+  803896:	89 df                	mov    %ebx,%edi
+  803898:	48 b8 f4 36 80 00 00 	movabs $0x8036f4,%rax
+  80389f:	00 00 00 
+  8038a2:	ff d0                	call   *%rax
+  8038a4:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8038a7:	45 29 f4             	sub    %r14d,%r12d
+  8038aa:	4d 63 f4             	movslq %r12d,%r14
+  8038ad:	49 39 c6             	cmp    %rax,%r14
+  8038b0:	7c 1d                	jl     8038cf <read_map+0x92>
+  8038b2:	48 85 c0             	test   %rax,%rax
+  8038b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ba:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8038be:	48 83 c4 10          	add    $0x10,%rsp
+  8038c2:	5b                   	pop    %rbx
+  8038c3:	41 5c                	pop    %r12
+  8038c5:	41 5d                	pop    %r13
+  8038c7:	41 5e                	pop    %r14
+  8038c9:	5d                   	pop    %rbp
+  8038ca:	c3                   	ret
+    if (res < 0) return res;
+  8038cb:	48 98                	cltq
+  8038cd:	eb ef                	jmp    8038be <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8038cf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8038d3:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  8038da:	00 00 00 
+  8038dd:	ff d0                	call   *%rax
+  8038df:	4d 63 e4             	movslq %r12d,%r12
+  8038e2:	4c 01 e0             	add    %r12,%rax
+  8038e5:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8038e9:	48 89 d8             	mov    %rbx,%rax
+  8038ec:	4c 29 f0             	sub    %r14,%rax
+  8038ef:	eb cd                	jmp    8038be <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8038f1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8038f8:	eb c4                	jmp    8038be <read_map+0x81>
+
+00000000008038fa <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8038fa:	55                   	push   %rbp
+  8038fb:	48 89 e5             	mov    %rsp,%rbp
+  8038fe:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803902:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803906:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  80390d:	00 00 00 
+  803910:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803912:	85 c0                	test   %eax,%eax
+  803914:	78 4a                	js     803960 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803916:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80391a:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803921:	00 00 00 
+  803924:	8b 00                	mov    (%rax),%eax
+  803926:	39 07                	cmp    %eax,(%rdi)
+  803928:	75 38                	jne    803962 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80392a:	48 b8 84 2e 80 00 00 	movabs $0x802e84,%rax
+  803931:	00 00 00 
+  803934:	ff d0                	call   *%rax
+  803936:	85 c0                	test   %eax,%eax
+  803938:	78 26                	js     803960 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80393a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80393e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803941:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803948:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80394a:	be 00 00 00 00       	mov    $0x0,%esi
+  80394f:	bf 06 00 00 00       	mov    $0x6,%edi
+  803954:	48 b8 be 2e 80 00 00 	movabs $0x802ebe,%rax
+  80395b:	00 00 00 
+  80395e:	ff d0                	call   *%rax
+}
+  803960:	c9                   	leave
+  803961:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803962:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803967:	eb f7                	jmp    803960 <fsync+0x66>
+
+0000000000803969 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803969:	55                   	push   %rbp
+  80396a:	48 89 e5             	mov    %rsp,%rbp
+  80396d:	41 57                	push   %r15
+  80396f:	41 56                	push   %r14
+  803971:	41 55                	push   %r13
+  803973:	41 54                	push   %r12
+  803975:	53                   	push   %rbx
+  803976:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80397a:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803981:	00 00 00 
+  803984:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803989:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80398f:	49 bd 4c 23 80 00 00 	movabs $0x80234c,%r13
+  803996:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803999:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8039a0:	00 00 00 
+  8039a3:	eb 0c                	jmp    8039b1 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8039a5:	83 c3 01             	add    $0x1,%ebx
+  8039a8:	49 83 c4 28          	add    $0x28,%r12
+  8039ac:	83 fb 20             	cmp    $0x20,%ebx
+  8039af:	74 33                	je     8039e4 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8039b1:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8039b6:	74 ed                	je     8039a5 <flushall+0x3c>
+  8039b8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8039bc:	89 df                	mov    %ebx,%edi
+  8039be:	41 ff d5             	call   *%r13
+  8039c1:	85 c0                	test   %eax,%eax
+  8039c3:	78 e0                	js     8039a5 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8039c5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8039c9:	41 8b 06             	mov    (%r14),%eax
+  8039cc:	39 07                	cmp    %eax,(%rdi)
+  8039ce:	75 d5                	jne    8039a5 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8039d0:	48 b8 84 2e 80 00 00 	movabs $0x802e84,%rax
+  8039d7:	00 00 00 
+  8039da:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8039dc:	85 c0                	test   %eax,%eax
+  8039de:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8039e2:	eb c1                	jmp    8039a5 <flushall+0x3c>
+    }
+    return res;
+}
+  8039e4:	44 89 f8             	mov    %r15d,%eax
+  8039e7:	48 83 c4 18          	add    $0x18,%rsp
+  8039eb:	5b                   	pop    %rbx
+  8039ec:	41 5c                	pop    %r12
+  8039ee:	41 5d                	pop    %r13
+  8039f0:	41 5e                	pop    %r14
+  8039f2:	41 5f                	pop    %r15
+  8039f4:	5d                   	pop    %rbp
+  8039f5:	c3                   	ret
+
+00000000008039f6 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8039f6:	55                   	push   %rbp
+  8039f7:	48 89 e5             	mov    %rsp,%rbp
+  8039fa:	53                   	push   %rbx
+  8039fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8039ff:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803a02:	40 0f b6 c6          	movzbl %sil,%eax
+  803a06:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803a0d:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803a0f:	be 00 00 00 00       	mov    $0x0,%esi
+  803a14:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803a19:	48 b8 be 2e 80 00 00 	movabs $0x802ebe,%rax
+  803a20:	00 00 00 
+  803a23:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a25:	85 c0                	test   %eax,%eax
+  803a27:	78 23                	js     803a4c <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803a29:	ba 58 06 00 00       	mov    $0x658,%edx
+  803a2e:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803a35:	00 00 00 
+  803a38:	48 89 df             	mov    %rbx,%rdi
+  803a3b:	48 b8 c3 13 80 00 00 	movabs $0x8013c3,%rax
+  803a42:	00 00 00 
+  803a45:	ff d0                	call   *%rax
+    return 0;
+  803a47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a4c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a50:	c9                   	leave
+  803a51:	c3                   	ret
+
+0000000000803a52 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803a52:	55                   	push   %rbp
+  803a53:	48 89 e5             	mov    %rsp,%rbp
+  803a56:	53                   	push   %rbx
+  803a57:	48 83 ec 08          	sub    $0x8,%rsp
+  803a5b:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803a5e:	48 b8 90 0f 80 00 00 	movabs $0x800f90,%rax
+  803a65:	00 00 00 
+  803a68:	ff d0                	call   *%rax
+  803a6a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803a70:	77 35                	ja     803aa7 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803a72:	48 89 de             	mov    %rbx,%rsi
+  803a75:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803a7c:	00 00 00 
+  803a7f:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  803a86:	00 00 00 
+  803a89:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803a8b:	be 00 00 00 00       	mov    $0x0,%esi
+  803a90:	bf 07 00 00 00       	mov    $0x7,%edi
+  803a95:	48 b8 be 2e 80 00 00 	movabs $0x802ebe,%rax
+  803a9c:	00 00 00 
+  803a9f:	ff d0                	call   *%rax
+}
+  803aa1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803aa5:	c9                   	leave
+  803aa6:	c3                   	ret
+        return -E_BAD_PATH;
+  803aa7:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803aac:	eb f3                	jmp    803aa1 <remove+0x4f>
+
+0000000000803aae <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803aae:	55                   	push   %rbp
+  803aaf:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803ab2:	48 b8 69 39 80 00 00 	movabs $0x803969,%rax
+  803ab9:	00 00 00 
+  803abc:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803abe:	be 00 00 00 00       	mov    $0x0,%esi
+  803ac3:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ac8:	48 b8 be 2e 80 00 00 	movabs $0x802ebe,%rax
+  803acf:	00 00 00 
+  803ad2:	ff d0                	call   *%rax
+}
+  803ad4:	5d                   	pop    %rbp
+  803ad5:	c3                   	ret
+
+0000000000803ad6 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803ad6:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803ada:	7f 01                	jg     803add <writebuf+0x7>
+  803adc:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803add:	55                   	push   %rbp
+  803ade:	48 89 e5             	mov    %rsp,%rbp
+  803ae1:	53                   	push   %rbx
+  803ae2:	48 83 ec 08          	sub    $0x8,%rsp
+  803ae6:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803ae9:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803aed:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803af1:	8b 3f                	mov    (%rdi),%edi
+  803af3:	48 b8 5e 27 80 00 00 	movabs $0x80275e,%rax
+  803afa:	00 00 00 
+  803afd:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803aff:	48 85 c0             	test   %rax,%rax
+  803b02:	7e 04                	jle    803b08 <writebuf+0x32>
+  803b04:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803b08:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803b0c:	48 39 c2             	cmp    %rax,%rdx
+  803b0f:	74 0f                	je     803b20 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803b11:	48 85 c0             	test   %rax,%rax
+  803b14:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b19:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803b1d:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803b20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b24:	c9                   	leave
+  803b25:	c3                   	ret
+
+0000000000803b26 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803b26:	8b 46 04             	mov    0x4(%rsi),%eax
+  803b29:	8d 50 01             	lea    0x1(%rax),%edx
+  803b2c:	89 56 04             	mov    %edx,0x4(%rsi)
+  803b2f:	48 98                	cltq
+  803b31:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803b36:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803b3c:	74 01                	je     803b3f <putch+0x19>
+  803b3e:	c3                   	ret
+putch(int ch, void *arg) {
+  803b3f:	55                   	push   %rbp
+  803b40:	48 89 e5             	mov    %rsp,%rbp
+  803b43:	53                   	push   %rbx
+  803b44:	48 83 ec 08          	sub    $0x8,%rsp
+  803b48:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803b4b:	48 89 f7             	mov    %rsi,%rdi
+  803b4e:	48 b8 d6 3a 80 00 00 	movabs $0x803ad6,%rax
+  803b55:	00 00 00 
+  803b58:	ff d0                	call   *%rax
+        state->offset = 0;
+  803b5a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803b61:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b65:	c9                   	leave
+  803b66:	c3                   	ret
+
+0000000000803b67 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803b67:	55                   	push   %rbp
+  803b68:	48 89 e5             	mov    %rsp,%rbp
+  803b6b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803b72:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803b75:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803b7b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803b82:	00 00 00 
+    state.result = 0;
+  803b85:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803b8c:	00 00 00 00 
+    state.error = 1;
+  803b90:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803b97:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803b9a:	48 89 f2             	mov    %rsi,%rdx
+  803b9d:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803ba4:	48 bf 26 3b 80 00 00 	movabs $0x803b26,%rdi
+  803bab:	00 00 00 
+  803bae:	48 b8 a6 07 80 00 00 	movabs $0x8007a6,%rax
+  803bb5:	00 00 00 
+  803bb8:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803bba:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803bc1:	7f 14                	jg     803bd7 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803bc3:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803bca:	48 85 c0             	test   %rax,%rax
+  803bcd:	75 06                	jne    803bd5 <vfprintf+0x6e>
+  803bcf:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803bd5:	c9                   	leave
+  803bd6:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803bd7:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803bde:	48 b8 d6 3a 80 00 00 	movabs $0x803ad6,%rax
+  803be5:	00 00 00 
+  803be8:	ff d0                	call   *%rax
+  803bea:	eb d7                	jmp    803bc3 <vfprintf+0x5c>
+
+0000000000803bec <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803bec:	55                   	push   %rbp
+  803bed:	48 89 e5             	mov    %rsp,%rbp
+  803bf0:	48 83 ec 50          	sub    $0x50,%rsp
+  803bf4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803bf8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803bfc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803c00:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803c04:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803c0b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c13:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803c17:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803c1b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803c1f:	48 b8 67 3b 80 00 00 	movabs $0x803b67,%rax
+  803c26:	00 00 00 
+  803c29:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803c2b:	c9                   	leave
+  803c2c:	c3                   	ret
+
+0000000000803c2d <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803c2d:	55                   	push   %rbp
+  803c2e:	48 89 e5             	mov    %rsp,%rbp
+  803c31:	48 83 ec 50          	sub    $0x50,%rsp
+  803c35:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c39:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803c3d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803c41:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803c45:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803c49:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803c50:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c58:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803c5c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803c60:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803c64:	48 89 fe             	mov    %rdi,%rsi
+  803c67:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c6c:	48 b8 67 3b 80 00 00 	movabs $0x803b67,%rax
+  803c73:	00 00 00 
+  803c76:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803c78:	c9                   	leave
+  803c79:	c3                   	ret
+
+0000000000803c7a <puts>:
+
+int
+puts(const char *str) {
+  803c7a:	55                   	push   %rbp
+  803c7b:	48 89 e5             	mov    %rsp,%rbp
+  803c7e:	48 89 fe             	mov    %rdi,%rsi
+    return printf("%s\n", str);
+  803c81:	48 bf 40 57 80 00 00 	movabs $0x805740,%rdi
+  803c88:	00 00 00 
+  803c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c90:	48 ba 2d 3c 80 00 00 	movabs $0x803c2d,%rdx
+  803c97:	00 00 00 
+  803c9a:	ff d2                	call   *%rdx
+}
+  803c9c:	5d                   	pop    %rbp
+  803c9d:	c3                   	ret
+
+0000000000803c9e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803c9e:	55                   	push   %rbp
+  803c9f:	48 89 e5             	mov    %rsp,%rbp
+  803ca2:	41 54                	push   %r12
+  803ca4:	53                   	push   %rbx
+  803ca5:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ca8:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  803caf:	00 00 00 
+  803cb2:	ff d0                	call   *%rax
+  803cb4:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803cb7:	48 be 44 57 80 00 00 	movabs $0x805744,%rsi
+  803cbe:	00 00 00 
+  803cc1:	48 89 df             	mov    %rbx,%rdi
+  803cc4:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  803ccb:	00 00 00 
+  803cce:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803cd0:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803cd5:	41 2b 04 24          	sub    (%r12),%eax
+  803cd9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803cdf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803ce6:	00 00 00 
+    stat->st_dev = &devpipe;
+  803ce9:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803cf0:	00 00 00 
+  803cf3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cff:	5b                   	pop    %rbx
+  803d00:	41 5c                	pop    %r12
+  803d02:	5d                   	pop    %rbp
+  803d03:	c3                   	ret
+
+0000000000803d04 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d04:	55                   	push   %rbp
+  803d05:	48 89 e5             	mov    %rsp,%rbp
+  803d08:	41 54                	push   %r12
+  803d0a:	53                   	push   %rbx
+  803d0b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d13:	48 89 fe             	mov    %rdi,%rsi
+  803d16:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d1b:	49 bc 0d 19 80 00 00 	movabs $0x80190d,%r12
+  803d22:	00 00 00 
+  803d25:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803d28:	48 89 df             	mov    %rbx,%rdi
+  803d2b:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  803d32:	00 00 00 
+  803d35:	ff d0                	call   *%rax
+  803d37:	48 89 c6             	mov    %rax,%rsi
+  803d3a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d44:	41 ff d4             	call   *%r12
+}
+  803d47:	5b                   	pop    %rbx
+  803d48:	41 5c                	pop    %r12
+  803d4a:	5d                   	pop    %rbp
+  803d4b:	c3                   	ret
+
+0000000000803d4c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d4c:	55                   	push   %rbp
+  803d4d:	48 89 e5             	mov    %rsp,%rbp
+  803d50:	41 57                	push   %r15
+  803d52:	41 56                	push   %r14
+  803d54:	41 55                	push   %r13
+  803d56:	41 54                	push   %r12
+  803d58:	53                   	push   %rbx
+  803d59:	48 83 ec 18          	sub    $0x18,%rsp
+  803d5d:	49 89 fc             	mov    %rdi,%r12
+  803d60:	49 89 f5             	mov    %rsi,%r13
+  803d63:	49 89 d7             	mov    %rdx,%r15
+  803d66:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d6a:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  803d71:	00 00 00 
+  803d74:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803d76:	4d 85 ff             	test   %r15,%r15
+  803d79:	0f 84 af 00 00 00    	je     803e2e <devpipe_write+0xe2>
+  803d7f:	48 89 c3             	mov    %rax,%rbx
+  803d82:	4c 89 f8             	mov    %r15,%rax
+  803d85:	4d 89 ef             	mov    %r13,%r15
+  803d88:	4c 01 e8             	add    %r13,%rax
+  803d8b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803d8f:	49 bd 02 17 80 00 00 	movabs $0x801702,%r13
+  803d96:	00 00 00 
+            sys_yield();
+  803d99:	49 be 9f 16 80 00 00 	movabs $0x80169f,%r14
+  803da0:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803da3:	8b 73 04             	mov    0x4(%rbx),%esi
+  803da6:	48 63 ce             	movslq %esi,%rcx
+  803da9:	48 63 03             	movslq (%rbx),%rax
+  803dac:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803db2:	48 39 c1             	cmp    %rax,%rcx
+  803db5:	72 2e                	jb     803de5 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803db7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803dbc:	48 89 da             	mov    %rbx,%rdx
+  803dbf:	be 00 10 00 00       	mov    $0x1000,%esi
+  803dc4:	4c 89 e7             	mov    %r12,%rdi
+  803dc7:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803dca:	85 c0                	test   %eax,%eax
+  803dcc:	74 66                	je     803e34 <devpipe_write+0xe8>
+            sys_yield();
+  803dce:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803dd1:	8b 73 04             	mov    0x4(%rbx),%esi
+  803dd4:	48 63 ce             	movslq %esi,%rcx
+  803dd7:	48 63 03             	movslq (%rbx),%rax
+  803dda:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803de0:	48 39 c1             	cmp    %rax,%rcx
+  803de3:	73 d2                	jae    803db7 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803de5:	41 0f b6 3f          	movzbl (%r15),%edi
+  803de9:	48 89 ca             	mov    %rcx,%rdx
+  803dec:	48 c1 ea 03          	shr    $0x3,%rdx
+  803df0:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803df7:	08 10 20 
+  803dfa:	48 f7 e2             	mul    %rdx
+  803dfd:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e01:	48 89 d0             	mov    %rdx,%rax
+  803e04:	48 c1 e0 09          	shl    $0x9,%rax
+  803e08:	48 29 d0             	sub    %rdx,%rax
+  803e0b:	48 c1 e0 03          	shl    $0x3,%rax
+  803e0f:	48 29 c1             	sub    %rax,%rcx
+  803e12:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e17:	83 c6 01             	add    $0x1,%esi
+  803e1a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e1d:	49 83 c7 01          	add    $0x1,%r15
+  803e21:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e25:	49 39 c7             	cmp    %rax,%r15
+  803e28:	0f 85 75 ff ff ff    	jne    803da3 <devpipe_write+0x57>
+    return n;
+  803e2e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e32:	eb 05                	jmp    803e39 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e39:	48 83 c4 18          	add    $0x18,%rsp
+  803e3d:	5b                   	pop    %rbx
+  803e3e:	41 5c                	pop    %r12
+  803e40:	41 5d                	pop    %r13
+  803e42:	41 5e                	pop    %r14
+  803e44:	41 5f                	pop    %r15
+  803e46:	5d                   	pop    %rbp
+  803e47:	c3                   	ret
+
+0000000000803e48 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e48:	55                   	push   %rbp
+  803e49:	48 89 e5             	mov    %rsp,%rbp
+  803e4c:	41 57                	push   %r15
+  803e4e:	41 56                	push   %r14
+  803e50:	41 55                	push   %r13
+  803e52:	41 54                	push   %r12
+  803e54:	53                   	push   %rbx
+  803e55:	48 83 ec 18          	sub    $0x18,%rsp
+  803e59:	49 89 fc             	mov    %rdi,%r12
+  803e5c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803e60:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e64:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  803e6b:	00 00 00 
+  803e6e:	ff d0                	call   *%rax
+  803e70:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803e73:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e79:	49 bd 02 17 80 00 00 	movabs $0x801702,%r13
+  803e80:	00 00 00 
+            sys_yield();
+  803e83:	49 be 9f 16 80 00 00 	movabs $0x80169f,%r14
+  803e8a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803e8d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803e92:	74 7d                	je     803f11 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803e94:	8b 03                	mov    (%rbx),%eax
+  803e96:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803e99:	75 26                	jne    803ec1 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803e9b:	4d 85 ff             	test   %r15,%r15
+  803e9e:	75 77                	jne    803f17 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ea0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ea5:	48 89 da             	mov    %rbx,%rdx
+  803ea8:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ead:	4c 89 e7             	mov    %r12,%rdi
+  803eb0:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803eb3:	85 c0                	test   %eax,%eax
+  803eb5:	74 72                	je     803f29 <devpipe_read+0xe1>
+            sys_yield();
+  803eb7:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803eba:	8b 03                	mov    (%rbx),%eax
+  803ebc:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803ebf:	74 df                	je     803ea0 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803ec1:	48 63 c8             	movslq %eax,%rcx
+  803ec4:	48 89 ca             	mov    %rcx,%rdx
+  803ec7:	48 c1 ea 03          	shr    $0x3,%rdx
+  803ecb:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803ed2:	08 10 20 
+  803ed5:	48 89 d0             	mov    %rdx,%rax
+  803ed8:	48 f7 e6             	mul    %rsi
+  803edb:	48 c1 ea 06          	shr    $0x6,%rdx
+  803edf:	48 89 d0             	mov    %rdx,%rax
+  803ee2:	48 c1 e0 09          	shl    $0x9,%rax
+  803ee6:	48 29 d0             	sub    %rdx,%rax
+  803ee9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803ef0:	00 
+  803ef1:	48 89 c8             	mov    %rcx,%rax
+  803ef4:	48 29 d0             	sub    %rdx,%rax
+  803ef7:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803efc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f00:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f04:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f07:	49 83 c7 01          	add    $0x1,%r15
+  803f0b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f0f:	75 83                	jne    803e94 <devpipe_read+0x4c>
+    return n;
+  803f11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f15:	eb 03                	jmp    803f1a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f17:	4c 89 f8             	mov    %r15,%rax
+}
+  803f1a:	48 83 c4 18          	add    $0x18,%rsp
+  803f1e:	5b                   	pop    %rbx
+  803f1f:	41 5c                	pop    %r12
+  803f21:	41 5d                	pop    %r13
+  803f23:	41 5e                	pop    %r14
+  803f25:	41 5f                	pop    %r15
+  803f27:	5d                   	pop    %rbp
+  803f28:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f2e:	eb ea                	jmp    803f1a <devpipe_read+0xd2>
+
+0000000000803f30 <pipe>:
+pipe(int pfd[2]) {
+  803f30:	55                   	push   %rbp
+  803f31:	48 89 e5             	mov    %rsp,%rbp
+  803f34:	41 55                	push   %r13
+  803f36:	41 54                	push   %r12
+  803f38:	53                   	push   %rbx
+  803f39:	48 83 ec 18          	sub    $0x18,%rsp
+  803f3d:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f40:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f44:	48 b8 ec 22 80 00 00 	movabs $0x8022ec,%rax
+  803f4b:	00 00 00 
+  803f4e:	ff d0                	call   *%rax
+  803f50:	89 c3                	mov    %eax,%ebx
+  803f52:	85 c0                	test   %eax,%eax
+  803f54:	0f 88 a0 01 00 00    	js     8040fa <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803f5a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f5f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f64:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f68:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f6d:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  803f74:	00 00 00 
+  803f77:	ff d0                	call   *%rax
+  803f79:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f7b:	85 c0                	test   %eax,%eax
+  803f7d:	0f 88 77 01 00 00    	js     8040fa <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f83:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803f87:	48 b8 ec 22 80 00 00 	movabs $0x8022ec,%rax
+  803f8e:	00 00 00 
+  803f91:	ff d0                	call   *%rax
+  803f93:	89 c3                	mov    %eax,%ebx
+  803f95:	85 c0                	test   %eax,%eax
+  803f97:	0f 88 43 01 00 00    	js     8040e0 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803f9d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fa2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fa7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803fab:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fb0:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  803fb7:	00 00 00 
+  803fba:	ff d0                	call   *%rax
+  803fbc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fbe:	85 c0                	test   %eax,%eax
+  803fc0:	0f 88 1a 01 00 00    	js     8040e0 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803fc6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fca:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  803fd1:	00 00 00 
+  803fd4:	ff d0                	call   *%rax
+  803fd6:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803fd9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fde:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fe3:	48 89 c6             	mov    %rax,%rsi
+  803fe6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803feb:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  803ff2:	00 00 00 
+  803ff5:	ff d0                	call   *%rax
+  803ff7:	89 c3                	mov    %eax,%ebx
+  803ff9:	85 c0                	test   %eax,%eax
+  803ffb:	0f 88 c5 00 00 00    	js     8040c6 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804001:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804005:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  80400c:	00 00 00 
+  80400f:	ff d0                	call   *%rax
+  804011:	48 89 c1             	mov    %rax,%rcx
+  804014:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80401a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804020:	ba 00 00 00 00       	mov    $0x0,%edx
+  804025:	4c 89 ee             	mov    %r13,%rsi
+  804028:	bf 00 00 00 00       	mov    $0x0,%edi
+  80402d:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  804034:	00 00 00 
+  804037:	ff d0                	call   *%rax
+  804039:	89 c3                	mov    %eax,%ebx
+  80403b:	85 c0                	test   %eax,%eax
+  80403d:	78 6e                	js     8040ad <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80403f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804044:	4c 89 ef             	mov    %r13,%rdi
+  804047:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  80404e:	00 00 00 
+  804051:	ff d0                	call   *%rax
+  804053:	83 f8 02             	cmp    $0x2,%eax
+  804056:	0f 85 ab 00 00 00    	jne    804107 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80405c:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804063:	00 00 
+  804065:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804069:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80406b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80406f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804076:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80407a:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80407c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804080:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804087:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80408b:	48 bb be 22 80 00 00 	movabs $0x8022be,%rbx
+  804092:	00 00 00 
+  804095:	ff d3                	call   *%rbx
+  804097:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80409b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80409f:	ff d3                	call   *%rbx
+  8040a1:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8040a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8040ab:	eb 4d                	jmp    8040fa <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8040ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040b2:	4c 89 ee             	mov    %r13,%rsi
+  8040b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ba:	48 b8 0d 19 80 00 00 	movabs $0x80190d,%rax
+  8040c1:	00 00 00 
+  8040c4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8040c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040cb:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8040cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d4:	48 b8 0d 19 80 00 00 	movabs $0x80190d,%rax
+  8040db:	00 00 00 
+  8040de:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8040e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040e5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8040e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ee:	48 b8 0d 19 80 00 00 	movabs $0x80190d,%rax
+  8040f5:	00 00 00 
+  8040f8:	ff d0                	call   *%rax
+}
+  8040fa:	89 d8                	mov    %ebx,%eax
+  8040fc:	48 83 c4 18          	add    $0x18,%rsp
+  804100:	5b                   	pop    %rbx
+  804101:	41 5c                	pop    %r12
+  804103:	41 5d                	pop    %r13
+  804105:	5d                   	pop    %rbp
+  804106:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804107:	48 b9 70 57 80 00 00 	movabs $0x805770,%rcx
+  80410e:	00 00 00 
+  804111:	48 ba 4b 57 80 00 00 	movabs $0x80574b,%rdx
+  804118:	00 00 00 
+  80411b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804120:	48 bf 60 57 80 00 00 	movabs $0x805760,%rdi
+  804127:	00 00 00 
+  80412a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80412f:	49 b8 06 05 80 00 00 	movabs $0x800506,%r8
+  804136:	00 00 00 
+  804139:	41 ff d0             	call   *%r8
+
+000000000080413c <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80413c:	55                   	push   %rbp
+  80413d:	48 89 e5             	mov    %rsp,%rbp
+  804140:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804144:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804148:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  80414f:	00 00 00 
+  804152:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804154:	85 c0                	test   %eax,%eax
+  804156:	78 35                	js     80418d <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804158:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80415c:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  804163:	00 00 00 
+  804166:	ff d0                	call   *%rax
+  804168:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80416b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804170:	be 00 10 00 00       	mov    $0x1000,%esi
+  804175:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804179:	48 b8 02 17 80 00 00 	movabs $0x801702,%rax
+  804180:	00 00 00 
+  804183:	ff d0                	call   *%rax
+  804185:	85 c0                	test   %eax,%eax
+  804187:	0f 94 c0             	sete   %al
+  80418a:	0f b6 c0             	movzbl %al,%eax
+}
+  80418d:	c9                   	leave
+  80418e:	c3                   	ret
+
+000000000080418f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80418f:	48 89 f8             	mov    %rdi,%rax
+  804192:	48 c1 e8 27          	shr    $0x27,%rax
+  804196:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80419d:	7f 00 00 
+  8041a0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8041a4:	f6 c2 01             	test   $0x1,%dl
+  8041a7:	74 6d                	je     804216 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8041a9:	48 89 f8             	mov    %rdi,%rax
+  8041ac:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041b0:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8041b7:	7f 00 00 
+  8041ba:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8041be:	f6 c2 01             	test   $0x1,%dl
+  8041c1:	74 62                	je     804225 <get_uvpt_entry+0x96>
+  8041c3:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8041ca:	7f 00 00 
+  8041cd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8041d1:	f6 c2 80             	test   $0x80,%dl
+  8041d4:	75 4f                	jne    804225 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8041d6:	48 89 f8             	mov    %rdi,%rax
+  8041d9:	48 c1 e8 15          	shr    $0x15,%rax
+  8041dd:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8041e4:	7f 00 00 
+  8041e7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8041eb:	f6 c2 01             	test   $0x1,%dl
+  8041ee:	74 44                	je     804234 <get_uvpt_entry+0xa5>
+  8041f0:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8041f7:	7f 00 00 
+  8041fa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8041fe:	f6 c2 80             	test   $0x80,%dl
+  804201:	75 31                	jne    804234 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804203:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804207:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80420e:	7f 00 00 
+  804211:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804215:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804216:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80421d:	7f 00 00 
+  804220:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804224:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804225:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80422c:	7f 00 00 
+  80422f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804233:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804234:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80423b:	7f 00 00 
+  80423e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804242:	c3                   	ret
+
+0000000000804243 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  804243:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804246:	48 89 f9             	mov    %rdi,%rcx
+  804249:	48 c1 e9 27          	shr    $0x27,%rcx
+  80424d:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804254:	7f 00 00 
+  804257:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80425b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804262:	f6 c1 01             	test   $0x1,%cl
+  804265:	0f 84 b2 00 00 00    	je     80431d <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80426b:	48 89 f9             	mov    %rdi,%rcx
+  80426e:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804272:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804279:	7f 00 00 
+  80427c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804280:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804287:	40 f6 c6 01          	test   $0x1,%sil
+  80428b:	0f 84 8c 00 00 00    	je     80431d <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804291:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804298:	7f 00 00 
+  80429b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80429f:	a8 80                	test   $0x80,%al
+  8042a1:	75 7b                	jne    80431e <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8042a3:	48 89 f9             	mov    %rdi,%rcx
+  8042a6:	48 c1 e9 15          	shr    $0x15,%rcx
+  8042aa:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8042b1:	7f 00 00 
+  8042b4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8042b8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8042bf:	40 f6 c6 01          	test   $0x1,%sil
+  8042c3:	74 58                	je     80431d <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8042c5:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8042cc:	7f 00 00 
+  8042cf:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8042d3:	a8 80                	test   $0x80,%al
+  8042d5:	75 6c                	jne    804343 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8042d7:	48 89 f9             	mov    %rdi,%rcx
+  8042da:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8042de:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8042e5:	7f 00 00 
+  8042e8:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8042ec:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8042f3:	40 f6 c6 01          	test   $0x1,%sil
+  8042f7:	74 24                	je     80431d <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8042f9:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804300:	7f 00 00 
+  804303:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804307:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80430e:	ff ff 7f 
+  804311:	48 21 c8             	and    %rcx,%rax
+  804314:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80431a:	48 09 d0             	or     %rdx,%rax
+}
+  80431d:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80431e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804325:	7f 00 00 
+  804328:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80432c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804333:	ff ff 7f 
+  804336:	48 21 c8             	and    %rcx,%rax
+  804339:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80433f:	48 01 d0             	add    %rdx,%rax
+  804342:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804343:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80434a:	7f 00 00 
+  80434d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804351:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804358:	ff ff 7f 
+  80435b:	48 21 c8             	and    %rcx,%rax
+  80435e:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804364:	48 01 d0             	add    %rdx,%rax
+  804367:	c3                   	ret
+
+0000000000804368 <get_prot>:
+
+int
+get_prot(void *va) {
+  804368:	55                   	push   %rbp
+  804369:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80436c:	48 b8 8f 41 80 00 00 	movabs $0x80418f,%rax
+  804373:	00 00 00 
+  804376:	ff d0                	call   *%rax
+  804378:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80437b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804380:	89 c1                	mov    %eax,%ecx
+  804382:	83 c9 04             	or     $0x4,%ecx
+  804385:	f6 c2 01             	test   $0x1,%dl
+  804388:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80438b:	89 c1                	mov    %eax,%ecx
+  80438d:	83 c9 02             	or     $0x2,%ecx
+  804390:	f6 c2 02             	test   $0x2,%dl
+  804393:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804396:	89 c1                	mov    %eax,%ecx
+  804398:	83 c9 01             	or     $0x1,%ecx
+  80439b:	48 85 d2             	test   %rdx,%rdx
+  80439e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8043a1:	89 c1                	mov    %eax,%ecx
+  8043a3:	83 c9 40             	or     $0x40,%ecx
+  8043a6:	f6 c6 04             	test   $0x4,%dh
+  8043a9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8043ac:	5d                   	pop    %rbp
+  8043ad:	c3                   	ret
+
+00000000008043ae <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8043ae:	55                   	push   %rbp
+  8043af:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8043b2:	48 b8 8f 41 80 00 00 	movabs $0x80418f,%rax
+  8043b9:	00 00 00 
+  8043bc:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8043be:	48 c1 e8 06          	shr    $0x6,%rax
+  8043c2:	83 e0 01             	and    $0x1,%eax
+}
+  8043c5:	5d                   	pop    %rbp
+  8043c6:	c3                   	ret
+
+00000000008043c7 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8043c7:	55                   	push   %rbp
+  8043c8:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8043cb:	48 b8 8f 41 80 00 00 	movabs $0x80418f,%rax
+  8043d2:	00 00 00 
+  8043d5:	ff d0                	call   *%rax
+  8043d7:	83 e0 01             	and    $0x1,%eax
+}
+  8043da:	5d                   	pop    %rbp
+  8043db:	c3                   	ret
+
+00000000008043dc <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8043dc:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8043e3:	7f 00 00 
+  8043e6:	a8 01                	test   $0x1,%al
+  8043e8:	75 06                	jne    8043f0 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8043ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ef:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8043f0:	55                   	push   %rbp
+  8043f1:	48 89 e5             	mov    %rsp,%rbp
+  8043f4:	41 57                	push   %r15
+  8043f6:	41 56                	push   %r14
+  8043f8:	41 55                	push   %r13
+  8043fa:	41 54                	push   %r12
+  8043fc:	53                   	push   %rbx
+  8043fd:	48 83 ec 18          	sub    $0x18,%rsp
+  804401:	49 89 fe             	mov    %rdi,%r14
+  804404:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804407:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80440e:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80440f:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804416:	7f 00 00 
+  804419:	e9 81 00 00 00       	jmp    80449f <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  80441e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804425:	49 39 dd             	cmp    %rbx,%r13
+  804428:	74 2b                	je     804455 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80442a:	48 89 d8             	mov    %rbx,%rax
+  80442d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804431:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804435:	f6 c2 01             	test   $0x1,%dl
+  804438:	74 e4                	je     80441e <foreach_shared_region+0x42>
+  80443a:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  80443e:	f6 c4 04             	test   $0x4,%ah
+  804441:	74 db                	je     80441e <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804443:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80444a:	4c 89 fa             	mov    %r15,%rdx
+  80444d:	48 89 df             	mov    %rbx,%rdi
+  804450:	41 ff d6             	call   *%r14
+  804453:	eb c9                	jmp    80441e <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804455:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  80445c:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804460:	74 22                	je     804484 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804462:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804469:	48 89 d8             	mov    %rbx,%rax
+  80446c:	48 c1 e8 15          	shr    $0x15,%rax
+  804470:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804477:	7f 00 00 
+  80447a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80447e:	a8 01                	test   $0x1,%al
+  804480:	74 d3                	je     804455 <foreach_shared_region+0x79>
+  804482:	eb a6                	jmp    80442a <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804484:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  80448b:	40 
+  80448c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804490:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804497:	00 00 00 
+  80449a:	48 39 c1             	cmp    %rax,%rcx
+  80449d:	74 31                	je     8044d0 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  80449f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044a3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8044a7:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8044ae:	7f 00 00 
+  8044b1:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8044b5:	a8 01                	test   $0x1,%al
+  8044b7:	74 cb                	je     804484 <foreach_shared_region+0xa8>
+  8044b9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044bd:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8044c4:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8044ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8044ce:	eb 92                	jmp    804462 <foreach_shared_region+0x86>
+}
+  8044d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d5:	48 83 c4 18          	add    $0x18,%rsp
+  8044d9:	5b                   	pop    %rbx
+  8044da:	41 5c                	pop    %r12
+  8044dc:	41 5d                	pop    %r13
+  8044de:	41 5e                	pop    %r14
+  8044e0:	41 5f                	pop    %r15
+  8044e2:	5d                   	pop    %rbp
+  8044e3:	c3                   	ret
+
+00000000008044e4 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8044e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e9:	c3                   	ret
+
+00000000008044ea <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8044ea:	55                   	push   %rbp
+  8044eb:	48 89 e5             	mov    %rsp,%rbp
+  8044ee:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8044f1:	48 be 94 57 80 00 00 	movabs $0x805794,%rsi
+  8044f8:	00 00 00 
+  8044fb:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  804502:	00 00 00 
+  804505:	ff d0                	call   *%rax
+    return 0;
+}
+  804507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80450c:	5d                   	pop    %rbp
+  80450d:	c3                   	ret
+
+000000000080450e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80450e:	55                   	push   %rbp
+  80450f:	48 89 e5             	mov    %rsp,%rbp
+  804512:	41 57                	push   %r15
+  804514:	41 56                	push   %r14
+  804516:	41 55                	push   %r13
+  804518:	41 54                	push   %r12
+  80451a:	53                   	push   %rbx
+  80451b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804522:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804529:	48 85 d2             	test   %rdx,%rdx
+  80452c:	74 7a                	je     8045a8 <devcons_write+0x9a>
+  80452e:	49 89 d6             	mov    %rdx,%r14
+  804531:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804537:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80453c:	49 bf 5c 13 80 00 00 	movabs $0x80135c,%r15
+  804543:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804546:	4c 89 f3             	mov    %r14,%rbx
+  804549:	48 29 f3             	sub    %rsi,%rbx
+  80454c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804551:	48 39 c3             	cmp    %rax,%rbx
+  804554:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804558:	4c 63 eb             	movslq %ebx,%r13
+  80455b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804562:	48 01 c6             	add    %rax,%rsi
+  804565:	4c 89 ea             	mov    %r13,%rdx
+  804568:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80456f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804572:	4c 89 ee             	mov    %r13,%rsi
+  804575:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80457c:	48 b8 a5 15 80 00 00 	movabs $0x8015a5,%rax
+  804583:	00 00 00 
+  804586:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804588:	41 01 dc             	add    %ebx,%r12d
+  80458b:	49 63 f4             	movslq %r12d,%rsi
+  80458e:	4c 39 f6             	cmp    %r14,%rsi
+  804591:	72 b3                	jb     804546 <devcons_write+0x38>
+    return res;
+  804593:	49 63 c4             	movslq %r12d,%rax
+}
+  804596:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80459d:	5b                   	pop    %rbx
+  80459e:	41 5c                	pop    %r12
+  8045a0:	41 5d                	pop    %r13
+  8045a2:	41 5e                	pop    %r14
+  8045a4:	41 5f                	pop    %r15
+  8045a6:	5d                   	pop    %rbp
+  8045a7:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8045a8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8045ae:	eb e3                	jmp    804593 <devcons_write+0x85>
+
+00000000008045b0 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8045b0:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8045b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045b8:	48 85 c0             	test   %rax,%rax
+  8045bb:	74 55                	je     804612 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8045bd:	55                   	push   %rbp
+  8045be:	48 89 e5             	mov    %rsp,%rbp
+  8045c1:	41 55                	push   %r13
+  8045c3:	41 54                	push   %r12
+  8045c5:	53                   	push   %rbx
+  8045c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8045ca:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8045cd:	48 bb d2 15 80 00 00 	movabs $0x8015d2,%rbx
+  8045d4:	00 00 00 
+  8045d7:	49 bc 9f 16 80 00 00 	movabs $0x80169f,%r12
+  8045de:	00 00 00 
+  8045e1:	eb 03                	jmp    8045e6 <devcons_read+0x36>
+  8045e3:	41 ff d4             	call   *%r12
+  8045e6:	ff d3                	call   *%rbx
+  8045e8:	85 c0                	test   %eax,%eax
+  8045ea:	74 f7                	je     8045e3 <devcons_read+0x33>
+    if (c < 0) return c;
+  8045ec:	48 63 d0             	movslq %eax,%rdx
+  8045ef:	78 13                	js     804604 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8045f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045f6:	83 f8 04             	cmp    $0x4,%eax
+  8045f9:	74 09                	je     804604 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8045fb:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8045ff:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804604:	48 89 d0             	mov    %rdx,%rax
+  804607:	48 83 c4 08          	add    $0x8,%rsp
+  80460b:	5b                   	pop    %rbx
+  80460c:	41 5c                	pop    %r12
+  80460e:	41 5d                	pop    %r13
+  804610:	5d                   	pop    %rbp
+  804611:	c3                   	ret
+  804612:	48 89 d0             	mov    %rdx,%rax
+  804615:	c3                   	ret
+
+0000000000804616 <cputchar>:
+cputchar(int ch) {
+  804616:	55                   	push   %rbp
+  804617:	48 89 e5             	mov    %rsp,%rbp
+  80461a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80461e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804622:	be 01 00 00 00       	mov    $0x1,%esi
+  804627:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80462b:	48 b8 a5 15 80 00 00 	movabs $0x8015a5,%rax
+  804632:	00 00 00 
+  804635:	ff d0                	call   *%rax
+}
+  804637:	c9                   	leave
+  804638:	c3                   	ret
+
+0000000000804639 <getchar>:
+getchar(void) {
+  804639:	55                   	push   %rbp
+  80463a:	48 89 e5             	mov    %rsp,%rbp
+  80463d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804641:	ba 01 00 00 00       	mov    $0x1,%edx
+  804646:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80464a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80464f:	48 b8 2f 26 80 00 00 	movabs $0x80262f,%rax
+  804656:	00 00 00 
+  804659:	ff d0                	call   *%rax
+  80465b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80465d:	85 c0                	test   %eax,%eax
+  80465f:	78 06                	js     804667 <getchar+0x2e>
+  804661:	74 08                	je     80466b <getchar+0x32>
+  804663:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804667:	89 d0                	mov    %edx,%eax
+  804669:	c9                   	leave
+  80466a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80466b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804670:	eb f5                	jmp    804667 <getchar+0x2e>
+
+0000000000804672 <iscons>:
+iscons(int fdnum) {
+  804672:	55                   	push   %rbp
+  804673:	48 89 e5             	mov    %rsp,%rbp
+  804676:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80467a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80467e:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  804685:	00 00 00 
+  804688:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80468a:	85 c0                	test   %eax,%eax
+  80468c:	78 18                	js     8046a6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80468e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804692:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804699:	00 00 00 
+  80469c:	8b 00                	mov    (%rax),%eax
+  80469e:	39 02                	cmp    %eax,(%rdx)
+  8046a0:	0f 94 c0             	sete   %al
+  8046a3:	0f b6 c0             	movzbl %al,%eax
+}
+  8046a6:	c9                   	leave
+  8046a7:	c3                   	ret
+
+00000000008046a8 <opencons>:
+opencons(void) {
+  8046a8:	55                   	push   %rbp
+  8046a9:	48 89 e5             	mov    %rsp,%rbp
+  8046ac:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8046b0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8046b4:	48 b8 ec 22 80 00 00 	movabs $0x8022ec,%rax
+  8046bb:	00 00 00 
+  8046be:	ff d0                	call   *%rax
+  8046c0:	85 c0                	test   %eax,%eax
+  8046c2:	78 49                	js     80470d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8046c4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8046c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046ce:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8046d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046d7:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  8046de:	00 00 00 
+  8046e1:	ff d0                	call   *%rax
+  8046e3:	85 c0                	test   %eax,%eax
+  8046e5:	78 26                	js     80470d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8046e7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046eb:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8046f2:	00 00 
+  8046f4:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8046f6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8046fa:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804701:	48 b8 be 22 80 00 00 	movabs $0x8022be,%rax
+  804708:	00 00 00 
+  80470b:	ff d0                	call   *%rax
+}
+  80470d:	c9                   	leave
+  80470e:	c3                   	ret
+
+000000000080470f <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80470f:	55                   	push   %rbp
+  804710:	48 89 e5             	mov    %rsp,%rbp
+  804713:	41 55                	push   %r13
+  804715:	41 54                	push   %r12
+  804717:	53                   	push   %rbx
+  804718:	48 83 ec 08          	sub    $0x8,%rsp
+  80471c:	49 89 fc             	mov    %rdi,%r12
+  80471f:	48 89 f7             	mov    %rsi,%rdi
+  804722:	48 89 d3             	mov    %rdx,%rbx
+  804725:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804728:	48 85 f6             	test   %rsi,%rsi
+  80472b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804732:	00 00 00 
+  804735:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804739:	be 00 10 00 00       	mov    $0x1000,%esi
+  80473e:	48 85 d2             	test   %rdx,%rdx
+  804741:	74 03                	je     804746 <ipc_recv+0x37>
+  804743:	48 8b 32             	mov    (%rdx),%rsi
+  804746:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  80474d:	00 00 00 
+  804750:	ff d0                	call   *%rax
+    if (errno) {
+  804752:	85 c0                	test   %eax,%eax
+  804754:	74 1c                	je     804772 <ipc_recv+0x63>
+        if (from_env_store)
+  804756:	4d 85 e4             	test   %r12,%r12
+  804759:	74 08                	je     804763 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80475b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804762:	00 
+
+        if (perm_store)
+  804763:	4d 85 ed             	test   %r13,%r13
+  804766:	74 74                	je     8047dc <ipc_recv+0xcd>
+            *perm_store = 0;
+  804768:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80476f:	00 
+  804770:	eb 6a                	jmp    8047dc <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804772:	4d 85 e4             	test   %r12,%r12
+  804775:	74 14                	je     80478b <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804777:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  80477e:	00 00 00 
+  804781:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804787:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80478b:	48 85 db             	test   %rbx,%rbx
+  80478e:	74 23                	je     8047b3 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804790:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  804797:	00 00 00 
+  80479a:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8047a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047a5:	85 c9                	test   %ecx,%ecx
+  8047a7:	74 07                	je     8047b0 <ipc_recv+0xa1>
+  8047a9:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8047b0:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8047b3:	4d 85 ed             	test   %r13,%r13
+  8047b6:	74 14                	je     8047cc <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8047b8:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8047bf:	00 00 00 
+  8047c2:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8047c8:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8047cc:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8047d3:	00 00 00 
+  8047d6:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8047dc:	48 83 c4 08          	add    $0x8,%rsp
+  8047e0:	5b                   	pop    %rbx
+  8047e1:	41 5c                	pop    %r12
+  8047e3:	41 5d                	pop    %r13
+  8047e5:	5d                   	pop    %rbp
+  8047e6:	c3                   	ret
+
+00000000008047e7 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8047e7:	55                   	push   %rbp
+  8047e8:	48 89 e5             	mov    %rsp,%rbp
+  8047eb:	41 55                	push   %r13
+  8047ed:	41 54                	push   %r12
+  8047ef:	53                   	push   %rbx
+  8047f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8047f4:	49 89 fc             	mov    %rdi,%r12
+  8047f7:	48 89 f7             	mov    %rsi,%rdi
+  8047fa:	48 89 d3             	mov    %rdx,%rbx
+  8047fd:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804800:	48 85 f6             	test   %rsi,%rsi
+  804803:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80480a:	00 00 00 
+  80480d:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804811:	be 00 10 00 00       	mov    $0x1000,%esi
+  804816:	48 85 d2             	test   %rdx,%rdx
+  804819:	74 03                	je     80481e <ipc_try_recv+0x37>
+  80481b:	48 8b 32             	mov    (%rdx),%rsi
+  80481e:	48 b8 44 1b 80 00 00 	movabs $0x801b44,%rax
+  804825:	00 00 00 
+  804828:	ff d0                	call   *%rax
+    if (errno) {
+  80482a:	85 c0                	test   %eax,%eax
+  80482c:	75 75                	jne    8048a3 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80482e:	4d 85 e4             	test   %r12,%r12
+  804831:	74 14                	je     804847 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804833:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  80483a:	00 00 00 
+  80483d:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804843:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804847:	48 85 db             	test   %rbx,%rbx
+  80484a:	74 23                	je     80486f <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80484c:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  804853:	00 00 00 
+  804856:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80485c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804861:	85 c9                	test   %ecx,%ecx
+  804863:	74 07                	je     80486c <ipc_try_recv+0x85>
+  804865:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80486c:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80486f:	4d 85 ed             	test   %r13,%r13
+  804872:	74 14                	je     804888 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804874:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  80487b:	00 00 00 
+  80487e:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804884:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804888:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  80488f:	00 00 00 
+  804892:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804898:	48 83 c4 08          	add    $0x8,%rsp
+  80489c:	5b                   	pop    %rbx
+  80489d:	41 5c                	pop    %r12
+  80489f:	41 5d                	pop    %r13
+  8048a1:	5d                   	pop    %rbp
+  8048a2:	c3                   	ret
+        if (from_env_store)
+  8048a3:	4d 85 e4             	test   %r12,%r12
+  8048a6:	74 08                	je     8048b0 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8048a8:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8048af:	00 
+        if (perm_store)
+  8048b0:	4d 85 ed             	test   %r13,%r13
+  8048b3:	74 e3                	je     804898 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8048b5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8048bc:	00 
+  8048bd:	eb d9                	jmp    804898 <ipc_try_recv+0xb1>
+
+00000000008048bf <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8048bf:	55                   	push   %rbp
+  8048c0:	48 89 e5             	mov    %rsp,%rbp
+  8048c3:	41 57                	push   %r15
+  8048c5:	41 56                	push   %r14
+  8048c7:	41 55                	push   %r13
+  8048c9:	41 54                	push   %r12
+  8048cb:	53                   	push   %rbx
+  8048cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8048d0:	41 89 fd             	mov    %edi,%r13d
+  8048d3:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8048d6:	48 89 d3             	mov    %rdx,%rbx
+  8048d9:	49 89 cc             	mov    %rcx,%r12
+  8048dc:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8048e0:	48 85 d2             	test   %rdx,%rdx
+  8048e3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8048ea:	00 00 00 
+  8048ed:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8048f1:	49 be af 1a 80 00 00 	movabs $0x801aaf,%r14
+  8048f8:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8048fb:	49 bf 9f 16 80 00 00 	movabs $0x80169f,%r15
+  804902:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804905:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804908:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80490c:	4c 89 e1             	mov    %r12,%rcx
+  80490f:	48 89 da             	mov    %rbx,%rdx
+  804912:	44 89 ef             	mov    %r13d,%edi
+  804915:	41 ff d6             	call   *%r14
+  804918:	85 c0                	test   %eax,%eax
+  80491a:	74 37                	je     804953 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  80491c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80491f:	75 05                	jne    804926 <ipc_send+0x67>
+        sys_yield();
+  804921:	41 ff d7             	call   *%r15
+  804924:	eb df                	jmp    804905 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804926:	89 c1                	mov    %eax,%ecx
+  804928:	48 ba a0 57 80 00 00 	movabs $0x8057a0,%rdx
+  80492f:	00 00 00 
+  804932:	be 65 00 00 00       	mov    $0x65,%esi
+  804937:	48 bf bb 57 80 00 00 	movabs $0x8057bb,%rdi
+  80493e:	00 00 00 
+  804941:	b8 00 00 00 00       	mov    $0x0,%eax
+  804946:	49 b8 06 05 80 00 00 	movabs $0x800506,%r8
+  80494d:	00 00 00 
+  804950:	41 ff d0             	call   *%r8
+    }
+}
+  804953:	48 83 c4 18          	add    $0x18,%rsp
+  804957:	5b                   	pop    %rbx
+  804958:	41 5c                	pop    %r12
+  80495a:	41 5d                	pop    %r13
+  80495c:	41 5e                	pop    %r14
+  80495e:	41 5f                	pop    %r15
+  804960:	5d                   	pop    %rbp
+  804961:	c3                   	ret
+
+0000000000804962 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804962:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804967:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80496e:	00 00 00 
+  804971:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804978:	48 01 ca             	add    %rcx,%rdx
+  80497b:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804981:	39 fa                	cmp    %edi,%edx
+  804983:	74 12                	je     804997 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804985:	48 83 c0 01          	add    $0x1,%rax
+  804989:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80498f:	75 e0                	jne    804971 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804991:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804996:	c3                   	ret
+            return envs[i].env_id;
+  804997:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80499e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8049a5:	00 00 00 
+  8049a8:	48 01 d0             	add    %rdx,%rax
+  8049ab:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8049b1:	c3                   	ret
+
+00000000008049b2 <__text_end>:
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
@@ -0,0 +1,8408 @@
+
+obj/user/lsfd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4b 01 00 00       	call   80016e <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: lsfd [-1]\n");
+  800029:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba e7 02 80 00 00 	movabs $0x8002e7,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+    exit();
+  800044:	48 b8 17 02 80 00 00 	movabs $0x800217,%rax
+  80004b:	00 00 00 
+  80004e:	ff d0                	call   *%rax
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  800066:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+    int i, usefprint = 0;
+    struct Stat st;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80006c:	48 8d 95 20 ff ff ff 	lea    -0xe0(%rbp),%rdx
+  800073:	48 8d bd 1c ff ff ff 	lea    -0xe4(%rbp),%rdi
+  80007a:	48 b8 d5 1d 80 00 00 	movabs $0x801dd5,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+    int i, usefprint = 0;
+  800086:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((i = argnext(&args)) >= 0) {
+  80008c:	48 bb 02 1e 80 00 00 	movabs $0x801e02,%rbx
+  800093:	00 00 00 
+  800096:	48 8d bd 20 ff ff ff 	lea    -0xe0(%rbp),%rdi
+  80009d:	ff d3                	call   *%rbx
+  80009f:	85 c0                	test   %eax,%eax
+  8000a1:	78 1b                	js     8000be <umain+0x6c>
+        if (i == '1')
+  8000a3:	83 f8 31             	cmp    $0x31,%eax
+  8000a6:	75 08                	jne    8000b0 <umain+0x5e>
+            usefprint = 1;
+  8000a8:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8000ae:	eb e6                	jmp    800096 <umain+0x44>
+        else
+            usage();
+  8000b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b7:	00 00 00 
+  8000ba:	ff d0                	call   *%rax
+  8000bc:	eb d8                	jmp    800096 <umain+0x44>
+    }
+
+    for (i = 0; i < 32; i++) {
+  8000be:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fstat(i, &st) >= 0) {
+  8000c3:	49 bd a2 25 80 00 00 	movabs $0x8025a2,%r13
+  8000ca:	00 00 00 
+            if (usefprint) {
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            } else {
+                cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000cd:	49 be 18 50 80 00 00 	movabs $0x805018,%r14
+  8000d4:	00 00 00 
+  8000d7:	49 bf e7 02 80 00 00 	movabs $0x8002e7,%r15
+  8000de:	00 00 00 
+  8000e1:	eb 2b                	jmp    80010e <umain+0xbc>
+  8000e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000e7:	4c 8b 48 08          	mov    0x8(%rax),%r9
+  8000eb:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8000ef:	8b 4d c4             	mov    -0x3c(%rbp),%ecx
+  8000f2:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  8000f9:	89 de                	mov    %ebx,%esi
+  8000fb:	4c 89 f7             	mov    %r14,%rdi
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	41 ff d7             	call   *%r15
+    for (i = 0; i < 32; i++) {
+  800106:	83 c3 01             	add    $0x1,%ebx
+  800109:	83 fb 20             	cmp    $0x20,%ebx
+  80010c:	74 51                	je     80015f <umain+0x10d>
+        if (fstat(i, &st) >= 0) {
+  80010e:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800115:	89 df                	mov    %ebx,%edi
+  800117:	41 ff d5             	call   *%r13
+  80011a:	85 c0                	test   %eax,%eax
+  80011c:	78 e8                	js     800106 <umain+0xb4>
+            if (usefprint) {
+  80011e:	45 85 e4             	test   %r12d,%r12d
+  800121:	74 c0                	je     8000e3 <umain+0x91>
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  800123:	48 83 ec 08          	sub    $0x8,%rsp
+  800127:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80012b:	ff 70 08             	push   0x8(%rax)
+  80012e:	44 8b 4d c0          	mov    -0x40(%rbp),%r9d
+  800132:	44 8b 45 c4          	mov    -0x3c(%rbp),%r8d
+  800136:	48 8d 8d 40 ff ff ff 	lea    -0xc0(%rbp),%rcx
+  80013d:	89 da                	mov    %ebx,%edx
+  80013f:	4c 89 f6             	mov    %r14,%rsi
+  800142:	bf 01 00 00 00       	mov    $0x1,%edi
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	49 ba 7d 38 80 00 00 	movabs $0x80387d,%r10
+  800153:	00 00 00 
+  800156:	41 ff d2             	call   *%r10
+  800159:	48 83 c4 10          	add    $0x10,%rsp
+  80015d:	eb a7                	jmp    800106 <umain+0xb4>
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            }
+        }
+    }
+}
+  80015f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800163:	5b                   	pop    %rbx
+  800164:	41 5c                	pop    %r12
+  800166:	41 5d                	pop    %r13
+  800168:	41 5e                	pop    %r14
+  80016a:	41 5f                	pop    %r15
+  80016c:	5d                   	pop    %rbp
+  80016d:	c3                   	ret
+
+000000000080016e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80016e:	55                   	push   %rbp
+  80016f:	48 89 e5             	mov    %rsp,%rbp
+  800172:	41 56                	push   %r14
+  800174:	41 55                	push   %r13
+  800176:	41 54                	push   %r12
+  800178:	53                   	push   %rbx
+  800179:	41 89 fd             	mov    %edi,%r13d
+  80017c:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80017f:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800186:	00 00 00 
+  800189:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800190:	00 00 00 
+  800193:	48 39 c2             	cmp    %rax,%rdx
+  800196:	73 17                	jae    8001af <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800198:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80019b:	49 89 c4             	mov    %rax,%r12
+  80019e:	48 83 c3 08          	add    $0x8,%rbx
+  8001a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a7:	ff 53 f8             	call   *-0x8(%rbx)
+  8001aa:	4c 39 e3             	cmp    %r12,%rbx
+  8001ad:	72 ef                	jb     80019e <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001af:	48 b8 ff 12 80 00 00 	movabs $0x8012ff,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+  8001bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001c0:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8001c7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001ce:	00 00 00 
+  8001d1:	48 01 d0             	add    %rdx,%rax
+  8001d4:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8001db:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001de:	45 85 ed             	test   %r13d,%r13d
+  8001e1:	7e 0d                	jle    8001f0 <libmain+0x82>
+  8001e3:	49 8b 06             	mov    (%r14),%rax
+  8001e6:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001ed:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001f0:	4c 89 f6             	mov    %r14,%rsi
+  8001f3:	44 89 ef             	mov    %r13d,%edi
+  8001f6:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  8001fd:	00 00 00 
+  800200:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800202:	48 b8 17 02 80 00 00 	movabs $0x800217,%rax
+  800209:	00 00 00 
+  80020c:	ff d0                	call   *%rax
+#endif
+}
+  80020e:	5b                   	pop    %rbx
+  80020f:	41 5c                	pop    %r12
+  800211:	41 5d                	pop    %r13
+  800213:	41 5e                	pop    %r14
+  800215:	5d                   	pop    %rbp
+  800216:	c3                   	ret
+
+0000000000800217 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800217:	55                   	push   %rbp
+  800218:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80021b:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  800222:	00 00 00 
+  800225:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800227:	bf 00 00 00 00       	mov    $0x0,%edi
+  80022c:	48 b8 94 12 80 00 00 	movabs $0x801294,%rax
+  800233:	00 00 00 
+  800236:	ff d0                	call   *%rax
+}
+  800238:	5d                   	pop    %rbp
+  800239:	c3                   	ret
+
+000000000080023a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80023a:	55                   	push   %rbp
+  80023b:	48 89 e5             	mov    %rsp,%rbp
+  80023e:	53                   	push   %rbx
+  80023f:	48 83 ec 08          	sub    $0x8,%rsp
+  800243:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800246:	8b 06                	mov    (%rsi),%eax
+  800248:	8d 50 01             	lea    0x1(%rax),%edx
+  80024b:	89 16                	mov    %edx,(%rsi)
+  80024d:	48 98                	cltq
+  80024f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800254:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80025a:	74 0a                	je     800266 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80025c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800260:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800264:	c9                   	leave
+  800265:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800266:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80026a:	be ff 00 00 00       	mov    $0xff,%esi
+  80026f:	48 b8 36 12 80 00 00 	movabs $0x801236,%rax
+  800276:	00 00 00 
+  800279:	ff d0                	call   *%rax
+        state->offset = 0;
+  80027b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800281:	eb d9                	jmp    80025c <putch+0x22>
+
+0000000000800283 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800283:	55                   	push   %rbp
+  800284:	48 89 e5             	mov    %rsp,%rbp
+  800287:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80028e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800291:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800298:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80029d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002a5:	48 89 f1             	mov    %rsi,%rcx
+  8002a8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002af:	48 bf 3a 02 80 00 00 	movabs $0x80023a,%rdi
+  8002b6:	00 00 00 
+  8002b9:	48 b8 37 04 80 00 00 	movabs $0x800437,%rax
+  8002c0:	00 00 00 
+  8002c3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002c5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002cc:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002d3:	48 b8 36 12 80 00 00 	movabs $0x801236,%rax
+  8002da:	00 00 00 
+  8002dd:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002df:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002e5:	c9                   	leave
+  8002e6:	c3                   	ret
+
+00000000008002e7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002e7:	55                   	push   %rbp
+  8002e8:	48 89 e5             	mov    %rsp,%rbp
+  8002eb:	48 83 ec 50          	sub    $0x50,%rsp
+  8002ef:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002f3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002f7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002fb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002ff:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800303:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80030a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80030e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800312:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800316:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80031a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80031e:	48 b8 83 02 80 00 00 	movabs $0x800283,%rax
+  800325:	00 00 00 
+  800328:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80032a:	c9                   	leave
+  80032b:	c3                   	ret
+
+000000000080032c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80032c:	55                   	push   %rbp
+  80032d:	48 89 e5             	mov    %rsp,%rbp
+  800330:	41 57                	push   %r15
+  800332:	41 56                	push   %r14
+  800334:	41 55                	push   %r13
+  800336:	41 54                	push   %r12
+  800338:	53                   	push   %rbx
+  800339:	48 83 ec 18          	sub    $0x18,%rsp
+  80033d:	49 89 fc             	mov    %rdi,%r12
+  800340:	49 89 f5             	mov    %rsi,%r13
+  800343:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800347:	8b 45 10             	mov    0x10(%rbp),%eax
+  80034a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80034d:	41 89 cf             	mov    %ecx,%r15d
+  800350:	4c 39 fa             	cmp    %r15,%rdx
+  800353:	73 5b                	jae    8003b0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800355:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800359:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80035d:	85 db                	test   %ebx,%ebx
+  80035f:	7e 0e                	jle    80036f <print_num+0x43>
+            putch(padc, put_arg);
+  800361:	4c 89 ee             	mov    %r13,%rsi
+  800364:	44 89 f7             	mov    %r14d,%edi
+  800367:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80036a:	83 eb 01             	sub    $0x1,%ebx
+  80036d:	75 f2                	jne    800361 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80036f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800373:	48 b9 5b 50 80 00 00 	movabs $0x80505b,%rcx
+  80037a:	00 00 00 
+  80037d:	48 b8 4a 50 80 00 00 	movabs $0x80504a,%rax
+  800384:	00 00 00 
+  800387:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80038b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80038f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800394:	49 f7 f7             	div    %r15
+  800397:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80039b:	4c 89 ee             	mov    %r13,%rsi
+  80039e:	41 ff d4             	call   *%r12
+}
+  8003a1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003a5:	5b                   	pop    %rbx
+  8003a6:	41 5c                	pop    %r12
+  8003a8:	41 5d                	pop    %r13
+  8003aa:	41 5e                	pop    %r14
+  8003ac:	41 5f                	pop    %r15
+  8003ae:	5d                   	pop    %rbp
+  8003af:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b9:	49 f7 f7             	div    %r15
+  8003bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8003c0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003c4:	52                   	push   %rdx
+  8003c5:	45 0f be c9          	movsbl %r9b,%r9d
+  8003c9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003cd:	48 89 c2             	mov    %rax,%rdx
+  8003d0:	48 b8 2c 03 80 00 00 	movabs $0x80032c,%rax
+  8003d7:	00 00 00 
+  8003da:	ff d0                	call   *%rax
+  8003dc:	48 83 c4 10          	add    $0x10,%rsp
+  8003e0:	eb 8d                	jmp    80036f <print_num+0x43>
+
+00000000008003e2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003e2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003e6:	48 8b 06             	mov    (%rsi),%rax
+  8003e9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003ed:	73 0a                	jae    8003f9 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003ef:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003f3:	48 89 16             	mov    %rdx,(%rsi)
+  8003f6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003f9:	c3                   	ret
+
+00000000008003fa <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003fa:	55                   	push   %rbp
+  8003fb:	48 89 e5             	mov    %rsp,%rbp
+  8003fe:	48 83 ec 50          	sub    $0x50,%rsp
+  800402:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800406:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80040a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80040e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800415:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800419:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800421:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800425:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800429:	48 b8 37 04 80 00 00 	movabs $0x800437,%rax
+  800430:	00 00 00 
+  800433:	ff d0                	call   *%rax
+}
+  800435:	c9                   	leave
+  800436:	c3                   	ret
+
+0000000000800437 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800437:	55                   	push   %rbp
+  800438:	48 89 e5             	mov    %rsp,%rbp
+  80043b:	41 57                	push   %r15
+  80043d:	41 56                	push   %r14
+  80043f:	41 55                	push   %r13
+  800441:	41 54                	push   %r12
+  800443:	53                   	push   %rbx
+  800444:	48 83 ec 38          	sub    $0x38,%rsp
+  800448:	49 89 fe             	mov    %rdi,%r14
+  80044b:	49 89 f5             	mov    %rsi,%r13
+  80044e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800451:	48 8b 01             	mov    (%rcx),%rax
+  800454:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800458:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80045c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800460:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800464:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800468:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80046c:	0f b6 3b             	movzbl (%rbx),%edi
+  80046f:	40 80 ff 25          	cmp    $0x25,%dil
+  800473:	74 18                	je     80048d <vprintfmt+0x56>
+            if (!ch) return;
+  800475:	40 84 ff             	test   %dil,%dil
+  800478:	0f 84 04 07 00 00    	je     800b82 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80047e:	40 0f b6 ff          	movzbl %dil,%edi
+  800482:	4c 89 ee             	mov    %r13,%rsi
+  800485:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800488:	4c 89 e3             	mov    %r12,%rbx
+  80048b:	eb db                	jmp    800468 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80048d:	be 00 00 00 00       	mov    $0x0,%esi
+  800492:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800496:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80049b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004a1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004a8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004ac:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004b1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004b6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004b9:	83 e8 23             	sub    $0x23,%eax
+  8004bc:	3c 57                	cmp    $0x57,%al
+  8004be:	0f 87 a4 06 00 00    	ja     800b68 <vprintfmt+0x731>
+  8004c4:	0f b6 c0             	movzbl %al,%eax
+  8004c7:	48 b9 e0 51 80 00 00 	movabs $0x8051e0,%rcx
+  8004ce:	00 00 00 
+  8004d1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004d4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004d7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004db:	eb cf                	jmp    8004ac <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004dd:	49 89 dc             	mov    %rbx,%r12
+  8004e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8004e5:	eb c5                	jmp    8004ac <vprintfmt+0x75>
+            padc = ch;
+  8004e7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004eb:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004ee:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f1:	eb b9                	jmp    8004ac <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8004f9:	77 24                	ja     80051f <vprintfmt+0xe8>
+  8004fb:	89 c1                	mov    %eax,%ecx
+  8004fd:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800501:	83 c0 08             	add    $0x8,%eax
+  800504:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800507:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80050a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80050d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800511:	79 99                	jns    8004ac <vprintfmt+0x75>
+                width = precision;
+  800513:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800517:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80051d:	eb 8d                	jmp    8004ac <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80051f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800523:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800527:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80052b:	eb da                	jmp    800507 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80052d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800532:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800536:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80053c:	3c 39                	cmp    $0x39,%al
+  80053e:	77 1c                	ja     80055c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800540:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800544:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800548:	0f b6 c0             	movzbl %al,%eax
+  80054b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800550:	0f b6 03             	movzbl (%rbx),%eax
+  800553:	3c 39                	cmp    $0x39,%al
+  800555:	76 e9                	jbe    800540 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800557:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80055a:	eb b1                	jmp    80050d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80055c:	49 89 dc             	mov    %rbx,%r12
+  80055f:	eb ac                	jmp    80050d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800561:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800564:	85 c9                	test   %ecx,%ecx
+  800566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056b:	0f 49 c1             	cmovns %ecx,%eax
+  80056e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800571:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800574:	e9 33 ff ff ff       	jmp    8004ac <vprintfmt+0x75>
+            lflag++;
+  800579:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80057c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80057f:	e9 28 ff ff ff       	jmp    8004ac <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800584:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800587:	83 f8 2f             	cmp    $0x2f,%eax
+  80058a:	77 19                	ja     8005a5 <vprintfmt+0x16e>
+  80058c:	89 c2                	mov    %eax,%edx
+  80058e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800592:	83 c0 08             	add    $0x8,%eax
+  800595:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800598:	8b 3a                	mov    (%rdx),%edi
+  80059a:	4c 89 ee             	mov    %r13,%rsi
+  80059d:	41 ff d6             	call   *%r14
+            break;
+  8005a0:	e9 c3 fe ff ff       	jmp    800468 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b1:	eb e5                	jmp    800598 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b9:	77 5a                	ja     800615 <vprintfmt+0x1de>
+  8005bb:	89 c2                	mov    %eax,%edx
+  8005bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005c1:	83 c0 08             	add    $0x8,%eax
+  8005c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005c7:	8b 02                	mov    (%rdx),%eax
+  8005c9:	89 c1                	mov    %eax,%ecx
+  8005cb:	f7 d9                	neg    %ecx
+  8005cd:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005d0:	83 f9 13             	cmp    $0x13,%ecx
+  8005d3:	7f 4e                	jg     800623 <vprintfmt+0x1ec>
+  8005d5:	48 63 c1             	movslq %ecx,%rax
+  8005d8:	48 ba a0 54 80 00 00 	movabs $0x8054a0,%rdx
+  8005df:	00 00 00 
+  8005e2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005e6:	48 85 c0             	test   %rax,%rax
+  8005e9:	74 38                	je     800623 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005eb:	48 89 c1             	mov    %rax,%rcx
+  8005ee:	48 ba dd 56 80 00 00 	movabs $0x8056dd,%rdx
+  8005f5:	00 00 00 
+  8005f8:	4c 89 ee             	mov    %r13,%rsi
+  8005fb:	4c 89 f7             	mov    %r14,%rdi
+  8005fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800603:	49 b8 fa 03 80 00 00 	movabs $0x8003fa,%r8
+  80060a:	00 00 00 
+  80060d:	41 ff d0             	call   *%r8
+  800610:	e9 53 fe ff ff       	jmp    800468 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800615:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800619:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80061d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800621:	eb a4                	jmp    8005c7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800623:	48 ba 73 50 80 00 00 	movabs $0x805073,%rdx
+  80062a:	00 00 00 
+  80062d:	4c 89 ee             	mov    %r13,%rsi
+  800630:	4c 89 f7             	mov    %r14,%rdi
+  800633:	b8 00 00 00 00       	mov    $0x0,%eax
+  800638:	49 b8 fa 03 80 00 00 	movabs $0x8003fa,%r8
+  80063f:	00 00 00 
+  800642:	41 ff d0             	call   *%r8
+  800645:	e9 1e fe ff ff       	jmp    800468 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80064a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80064d:	83 f8 2f             	cmp    $0x2f,%eax
+  800650:	77 36                	ja     800688 <vprintfmt+0x251>
+  800652:	89 c2                	mov    %eax,%edx
+  800654:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800658:	83 c0 08             	add    $0x8,%eax
+  80065b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80065e:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800661:	48 85 f6             	test   %rsi,%rsi
+  800664:	48 b8 6c 50 80 00 00 	movabs $0x80506c,%rax
+  80066b:	00 00 00 
+  80066e:	48 0f 45 c6          	cmovne %rsi,%rax
+  800672:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800676:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80067a:	7e 06                	jle    800682 <vprintfmt+0x24b>
+  80067c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800680:	75 14                	jne    800696 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800682:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800686:	eb 5b                	jmp    8006e3 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800688:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800690:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800694:	eb c8                	jmp    80065e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800696:	49 63 f7             	movslq %r15d,%rsi
+  800699:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80069d:	48 b8 3c 0c 80 00 00 	movabs $0x800c3c,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	48 89 c2             	mov    %rax,%rdx
+  8006ac:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006af:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006b1:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006b4:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006b7:	85 c0                	test   %eax,%eax
+  8006b9:	7e c7                	jle    800682 <vprintfmt+0x24b>
+  8006bb:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006c0:	4c 89 ee             	mov    %r13,%rsi
+  8006c3:	44 89 e7             	mov    %r12d,%edi
+  8006c6:	41 ff d6             	call   *%r14
+  8006c9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006cd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006d0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006d3:	75 eb                	jne    8006c0 <vprintfmt+0x289>
+  8006d5:	eb ab                	jmp    800682 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006d7:	0f b6 f8             	movzbl %al,%edi
+  8006da:	4c 89 ee             	mov    %r13,%rsi
+  8006dd:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8006e0:	4c 89 e2             	mov    %r12,%rdx
+  8006e3:	45 85 ff             	test   %r15d,%r15d
+  8006e6:	78 06                	js     8006ee <vprintfmt+0x2b7>
+  8006e8:	41 83 ef 01          	sub    $0x1,%r15d
+  8006ec:	78 23                	js     800711 <vprintfmt+0x2da>
+  8006ee:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8006f2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006f8:	84 c0                	test   %al,%al
+  8006fa:	74 15                	je     800711 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006fc:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800700:	74 d5                	je     8006d7 <vprintfmt+0x2a0>
+  800702:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800705:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80070a:	80 fa 5e             	cmp    $0x5e,%dl
+  80070d:	77 cb                	ja     8006da <vprintfmt+0x2a3>
+  80070f:	eb c6                	jmp    8006d7 <vprintfmt+0x2a0>
+  800711:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800714:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800717:	01 f0                	add    %esi,%eax
+  800719:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80071b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80071f:	85 c0                	test   %eax,%eax
+  800721:	0f 8e 41 fd ff ff    	jle    800468 <vprintfmt+0x31>
+  800727:	4c 89 ee             	mov    %r13,%rsi
+  80072a:	bf 20 00 00 00       	mov    $0x20,%edi
+  80072f:	41 ff d6             	call   *%r14
+  800732:	41 83 ec 01          	sub    $0x1,%r12d
+  800736:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80073a:	75 eb                	jne    800727 <vprintfmt+0x2f0>
+  80073c:	e9 27 fd ff ff       	jmp    800468 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800741:	40 84 f6             	test   %sil,%sil
+  800744:	75 26                	jne    80076c <vprintfmt+0x335>
+    switch (lflag) {
+  800746:	85 d2                	test   %edx,%edx
+  800748:	74 59                	je     8007a3 <vprintfmt+0x36c>
+  80074a:	83 fa 01             	cmp    $0x1,%edx
+  80074d:	74 7b                	je     8007ca <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80074f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800752:	83 f8 2f             	cmp    $0x2f,%eax
+  800755:	0f 87 96 00 00 00    	ja     8007f1 <vprintfmt+0x3ba>
+  80075b:	89 c2                	mov    %eax,%edx
+  80075d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800761:	83 c0 08             	add    $0x8,%eax
+  800764:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800767:	4c 8b 22             	mov    (%rdx),%r12
+  80076a:	eb 17                	jmp    800783 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80076c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076f:	83 f8 2f             	cmp    $0x2f,%eax
+  800772:	77 21                	ja     800795 <vprintfmt+0x35e>
+  800774:	89 c2                	mov    %eax,%edx
+  800776:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077a:	83 c0 08             	add    $0x8,%eax
+  80077d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800780:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800783:	4d 85 e4             	test   %r12,%r12
+  800786:	78 7a                	js     800802 <vprintfmt+0x3cb>
+            num = i;
+  800788:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80078b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800790:	e9 b5 02 00 00       	jmp    800a4a <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800795:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800799:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a1:	eb dd                	jmp    800780 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8007a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a9:	77 11                	ja     8007bc <vprintfmt+0x385>
+  8007ab:	89 c2                	mov    %eax,%edx
+  8007ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b1:	83 c0 08             	add    $0x8,%eax
+  8007b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b7:	4c 63 22             	movslq (%rdx),%r12
+  8007ba:	eb c7                	jmp    800783 <vprintfmt+0x34c>
+  8007bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c8:	eb ed                	jmp    8007b7 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8007ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d0:	77 11                	ja     8007e3 <vprintfmt+0x3ac>
+  8007d2:	89 c2                	mov    %eax,%edx
+  8007d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d8:	83 c0 08             	add    $0x8,%eax
+  8007db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007de:	4c 8b 22             	mov    (%rdx),%r12
+  8007e1:	eb a0                	jmp    800783 <vprintfmt+0x34c>
+  8007e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ef:	eb ed                	jmp    8007de <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8007f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fd:	e9 65 ff ff ff       	jmp    800767 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800802:	4c 89 ee             	mov    %r13,%rsi
+  800805:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80080a:	41 ff d6             	call   *%r14
+                i = -i;
+  80080d:	49 f7 dc             	neg    %r12
+  800810:	e9 73 ff ff ff       	jmp    800788 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800815:	40 84 f6             	test   %sil,%sil
+  800818:	75 32                	jne    80084c <vprintfmt+0x415>
+    switch (lflag) {
+  80081a:	85 d2                	test   %edx,%edx
+  80081c:	74 5d                	je     80087b <vprintfmt+0x444>
+  80081e:	83 fa 01             	cmp    $0x1,%edx
+  800821:	0f 84 82 00 00 00    	je     8008a9 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800827:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082a:	83 f8 2f             	cmp    $0x2f,%eax
+  80082d:	0f 87 a5 00 00 00    	ja     8008d8 <vprintfmt+0x4a1>
+  800833:	89 c2                	mov    %eax,%edx
+  800835:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800839:	83 c0 08             	add    $0x8,%eax
+  80083c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800842:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800847:	e9 fe 01 00 00       	jmp    800a4a <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80084c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084f:	83 f8 2f             	cmp    $0x2f,%eax
+  800852:	77 19                	ja     80086d <vprintfmt+0x436>
+  800854:	89 c2                	mov    %eax,%edx
+  800856:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085a:	83 c0 08             	add    $0x8,%eax
+  80085d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800860:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800863:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800868:	e9 dd 01 00 00       	jmp    800a4a <vprintfmt+0x613>
+  80086d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800871:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800875:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800879:	eb e5                	jmp    800860 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80087b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087e:	83 f8 2f             	cmp    $0x2f,%eax
+  800881:	77 18                	ja     80089b <vprintfmt+0x464>
+  800883:	89 c2                	mov    %eax,%edx
+  800885:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800889:	83 c0 08             	add    $0x8,%eax
+  80088c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800891:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800896:	e9 af 01 00 00       	jmp    800a4a <vprintfmt+0x613>
+  80089b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a7:	eb e6                	jmp    80088f <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8008a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8008af:	77 19                	ja     8008ca <vprintfmt+0x493>
+  8008b1:	89 c2                	mov    %eax,%edx
+  8008b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b7:	83 c0 08             	add    $0x8,%eax
+  8008ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008c0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008c5:	e9 80 01 00 00       	jmp    800a4a <vprintfmt+0x613>
+  8008ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d6:	eb e5                	jmp    8008bd <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8008d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e4:	e9 56 ff ff ff       	jmp    80083f <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e9:	40 84 f6             	test   %sil,%sil
+  8008ec:	75 2e                	jne    80091c <vprintfmt+0x4e5>
+    switch (lflag) {
+  8008ee:	85 d2                	test   %edx,%edx
+  8008f0:	0f 84 b3 00 00 00    	je     8009a9 <vprintfmt+0x572>
+  8008f6:	83 fa 01             	cmp    $0x1,%edx
+  8008f9:	0f 84 d3 00 00 00    	je     8009d2 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8008ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800902:	83 f8 2f             	cmp    $0x2f,%eax
+  800905:	0f 87 f1 00 00 00    	ja     8009fc <vprintfmt+0x5c5>
+  80090b:	89 c2                	mov    %eax,%edx
+  80090d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800911:	83 c0 08             	add    $0x8,%eax
+  800914:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800917:	48 8b 02             	mov    (%rdx),%rax
+  80091a:	eb 17                	jmp    800933 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  80091c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091f:	83 f8 2f             	cmp    $0x2f,%eax
+  800922:	77 77                	ja     80099b <vprintfmt+0x564>
+  800924:	89 c2                	mov    %eax,%edx
+  800926:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092a:	83 c0 08             	add    $0x8,%eax
+  80092d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800930:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800933:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800935:	83 f8 07             	cmp    $0x7,%eax
+  800938:	0f 8e cf 00 00 00    	jle    800a0d <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  80093e:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800944:	44 89 e7             	mov    %r12d,%edi
+  800947:	41 c1 e4 03          	shl    $0x3,%r12d
+  80094b:	89 d1                	mov    %edx,%ecx
+  80094d:	8d 72 07             	lea    0x7(%rdx),%esi
+  800950:	85 d2                	test   %edx,%edx
+  800952:	0f 48 d6             	cmovs  %esi,%edx
+  800955:	c1 fa 03             	sar    $0x3,%edx
+  800958:	83 f9 3f             	cmp    $0x3f,%ecx
+  80095b:	7f e7                	jg     800944 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80095d:	85 ff                	test   %edi,%edi
+  80095f:	0f 84 03 fb ff ff    	je     800468 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800965:	49 63 f4             	movslq %r12d,%rsi
+  800968:	ba 00 00 00 00       	mov    $0x0,%edx
+  80096d:	48 f7 f6             	div    %rsi
+  800970:	49 89 d7             	mov    %rdx,%r15
+  800973:	83 c0 30             	add    $0x30,%eax
+  800976:	0f be f8             	movsbl %al,%edi
+  800979:	4c 89 ee             	mov    %r13,%rsi
+  80097c:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80097f:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800982:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800987:	45 85 e4             	test   %r12d,%r12d
+  80098a:	41 0f 49 d4          	cmovns %r12d,%edx
+  80098e:	c1 fa 03             	sar    $0x3,%edx
+  800991:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800994:	75 cf                	jne    800965 <vprintfmt+0x52e>
+  800996:	e9 cd fa ff ff       	jmp    800468 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80099b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a7:	eb 87                	jmp    800930 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  8009a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8009af:	77 13                	ja     8009c4 <vprintfmt+0x58d>
+  8009b1:	89 c2                	mov    %eax,%edx
+  8009b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b7:	83 c0 08             	add    $0x8,%eax
+  8009ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bd:	8b 02                	mov    (%rdx),%eax
+  8009bf:	e9 6f ff ff ff       	jmp    800933 <vprintfmt+0x4fc>
+  8009c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d0:	eb eb                	jmp    8009bd <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8009d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d8:	77 14                	ja     8009ee <vprintfmt+0x5b7>
+  8009da:	89 c2                	mov    %eax,%edx
+  8009dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e0:	83 c0 08             	add    $0x8,%eax
+  8009e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e6:	48 8b 02             	mov    (%rdx),%rax
+  8009e9:	e9 45 ff ff ff       	jmp    800933 <vprintfmt+0x4fc>
+  8009ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fa:	eb ea                	jmp    8009e6 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8009fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a08:	e9 0a ff ff ff       	jmp    800917 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800a0d:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800a13:	e9 4d ff ff ff       	jmp    800965 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800a18:	4c 89 ee             	mov    %r13,%rsi
+  800a1b:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a20:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a23:	4c 89 ee             	mov    %r13,%rsi
+  800a26:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a2b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a31:	83 f8 2f             	cmp    $0x2f,%eax
+  800a34:	77 47                	ja     800a7d <vprintfmt+0x646>
+  800a36:	89 c2                	mov    %eax,%edx
+  800a38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3c:	83 c0 08             	add    $0x8,%eax
+  800a3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a42:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a45:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a4a:	48 83 ec 08          	sub    $0x8,%rsp
+  800a4e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a52:	0f 94 c0             	sete   %al
+  800a55:	0f b6 c0             	movzbl %al,%eax
+  800a58:	50                   	push   %rax
+  800a59:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a5e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a62:	4c 89 ee             	mov    %r13,%rsi
+  800a65:	4c 89 f7             	mov    %r14,%rdi
+  800a68:	48 b8 2c 03 80 00 00 	movabs $0x80032c,%rax
+  800a6f:	00 00 00 
+  800a72:	ff d0                	call   *%rax
+            break;
+  800a74:	48 83 c4 10          	add    $0x10,%rsp
+  800a78:	e9 eb f9 ff ff       	jmp    800468 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a89:	eb b7                	jmp    800a42 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8b:	40 84 f6             	test   %sil,%sil
+  800a8e:	75 2b                	jne    800abb <vprintfmt+0x684>
+    switch (lflag) {
+  800a90:	85 d2                	test   %edx,%edx
+  800a92:	74 56                	je     800aea <vprintfmt+0x6b3>
+  800a94:	83 fa 01             	cmp    $0x1,%edx
+  800a97:	74 7f                	je     800b18 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800a99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9f:	0f 87 a2 00 00 00    	ja     800b47 <vprintfmt+0x710>
+  800aa5:	89 c2                	mov    %eax,%edx
+  800aa7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aab:	83 c0 08             	add    $0x8,%eax
+  800aae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ab4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ab9:	eb 8f                	jmp    800a4a <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800abb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abe:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac1:	77 19                	ja     800adc <vprintfmt+0x6a5>
+  800ac3:	89 c2                	mov    %eax,%edx
+  800ac5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac9:	83 c0 08             	add    $0x8,%eax
+  800acc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ad2:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ad7:	e9 6e ff ff ff       	jmp    800a4a <vprintfmt+0x613>
+  800adc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae8:	eb e5                	jmp    800acf <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800aea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aed:	83 f8 2f             	cmp    $0x2f,%eax
+  800af0:	77 18                	ja     800b0a <vprintfmt+0x6d3>
+  800af2:	89 c2                	mov    %eax,%edx
+  800af4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af8:	83 c0 08             	add    $0x8,%eax
+  800afb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afe:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b00:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b05:	e9 40 ff ff ff       	jmp    800a4a <vprintfmt+0x613>
+  800b0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b16:	eb e6                	jmp    800afe <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800b18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b1e:	77 19                	ja     800b39 <vprintfmt+0x702>
+  800b20:	89 c2                	mov    %eax,%edx
+  800b22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b26:	83 c0 08             	add    $0x8,%eax
+  800b29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b2f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b34:	e9 11 ff ff ff       	jmp    800a4a <vprintfmt+0x613>
+  800b39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b45:	eb e5                	jmp    800b2c <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800b47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b53:	e9 59 ff ff ff       	jmp    800ab1 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800b58:	4c 89 ee             	mov    %r13,%rsi
+  800b5b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b60:	41 ff d6             	call   *%r14
+            break;
+  800b63:	e9 00 f9 ff ff       	jmp    800468 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b68:	4c 89 ee             	mov    %r13,%rsi
+  800b6b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b70:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b73:	48 83 eb 01          	sub    $0x1,%rbx
+  800b77:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b7b:	75 f6                	jne    800b73 <vprintfmt+0x73c>
+  800b7d:	e9 e6 f8 ff ff       	jmp    800468 <vprintfmt+0x31>
+}
+  800b82:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b86:	5b                   	pop    %rbx
+  800b87:	41 5c                	pop    %r12
+  800b89:	41 5d                	pop    %r13
+  800b8b:	41 5e                	pop    %r14
+  800b8d:	41 5f                	pop    %r15
+  800b8f:	5d                   	pop    %rbp
+  800b90:	c3                   	ret
+
+0000000000800b91 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b91:	55                   	push   %rbp
+  800b92:	48 89 e5             	mov    %rsp,%rbp
+  800b95:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b99:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b9d:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ba2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ba6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bad:	48 85 ff             	test   %rdi,%rdi
+  800bb0:	74 2b                	je     800bdd <vsnprintf+0x4c>
+  800bb2:	48 85 f6             	test   %rsi,%rsi
+  800bb5:	74 26                	je     800bdd <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bb7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bbb:	48 bf e2 03 80 00 00 	movabs $0x8003e2,%rdi
+  800bc2:	00 00 00 
+  800bc5:	48 b8 37 04 80 00 00 	movabs $0x800437,%rax
+  800bcc:	00 00 00 
+  800bcf:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bd5:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bd8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bdb:	c9                   	leave
+  800bdc:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bdd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800be2:	eb f7                	jmp    800bdb <vsnprintf+0x4a>
+
+0000000000800be4 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800be4:	55                   	push   %rbp
+  800be5:	48 89 e5             	mov    %rsp,%rbp
+  800be8:	48 83 ec 50          	sub    $0x50,%rsp
+  800bec:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bf0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bf4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bf8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bff:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c07:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c0b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c0f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c13:	48 b8 91 0b 80 00 00 	movabs $0x800b91,%rax
+  800c1a:	00 00 00 
+  800c1d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c1f:	c9                   	leave
+  800c20:	c3                   	ret
+
+0000000000800c21 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c21:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c24:	74 10                	je     800c36 <strlen+0x15>
+    size_t n = 0;
+  800c26:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c2b:	48 83 c0 01          	add    $0x1,%rax
+  800c2f:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c33:	75 f6                	jne    800c2b <strlen+0xa>
+  800c35:	c3                   	ret
+    size_t n = 0;
+  800c36:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c3b:	c3                   	ret
+
+0000000000800c3c <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c3c:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c3f:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c44:	48 85 f6             	test   %rsi,%rsi
+  800c47:	74 11                	je     800c5a <strnlen+0x1e>
+  800c49:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c4d:	74 0c                	je     800c5b <strnlen+0x1f>
+  800c4f:	48 83 c2 01          	add    $0x1,%rdx
+  800c53:	48 39 d0             	cmp    %rdx,%rax
+  800c56:	75 f1                	jne    800c49 <strnlen+0xd>
+  800c58:	eb 04                	jmp    800c5e <strnlen+0x22>
+  800c5a:	c3                   	ret
+  800c5b:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c5e:	c3                   	ret
+
+0000000000800c5f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c5f:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c62:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c67:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c6b:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c6e:	48 83 c2 01          	add    $0x1,%rdx
+  800c72:	84 c9                	test   %cl,%cl
+  800c74:	75 f1                	jne    800c67 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c76:	c3                   	ret
+
+0000000000800c77 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c77:	55                   	push   %rbp
+  800c78:	48 89 e5             	mov    %rsp,%rbp
+  800c7b:	41 54                	push   %r12
+  800c7d:	53                   	push   %rbx
+  800c7e:	48 89 fb             	mov    %rdi,%rbx
+  800c81:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c84:	48 b8 21 0c 80 00 00 	movabs $0x800c21,%rax
+  800c8b:	00 00 00 
+  800c8e:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c90:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c94:	4c 89 e6             	mov    %r12,%rsi
+  800c97:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  800c9e:	00 00 00 
+  800ca1:	ff d0                	call   *%rax
+    return dst;
+}
+  800ca3:	48 89 d8             	mov    %rbx,%rax
+  800ca6:	5b                   	pop    %rbx
+  800ca7:	41 5c                	pop    %r12
+  800ca9:	5d                   	pop    %rbp
+  800caa:	c3                   	ret
+
+0000000000800cab <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cab:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cae:	48 85 d2             	test   %rdx,%rdx
+  800cb1:	74 1f                	je     800cd2 <strncpy+0x27>
+  800cb3:	48 01 fa             	add    %rdi,%rdx
+  800cb6:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cb9:	48 83 c1 01          	add    $0x1,%rcx
+  800cbd:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cc1:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cc5:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cc9:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ccd:	48 39 ca             	cmp    %rcx,%rdx
+  800cd0:	75 e7                	jne    800cb9 <strncpy+0xe>
+    }
+    return ret;
+}
+  800cd2:	c3                   	ret
+
+0000000000800cd3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cd3:	48 89 f8             	mov    %rdi,%rax
+  800cd6:	48 85 d2             	test   %rdx,%rdx
+  800cd9:	74 24                	je     800cff <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cdb:	48 83 ea 01          	sub    $0x1,%rdx
+  800cdf:	74 1b                	je     800cfc <strlcpy+0x29>
+  800ce1:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ce5:	0f b6 16             	movzbl (%rsi),%edx
+  800ce8:	84 d2                	test   %dl,%dl
+  800cea:	74 10                	je     800cfc <strlcpy+0x29>
+            *dst++ = *src++;
+  800cec:	48 83 c6 01          	add    $0x1,%rsi
+  800cf0:	48 83 c0 01          	add    $0x1,%rax
+  800cf4:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cf7:	48 39 c8             	cmp    %rcx,%rax
+  800cfa:	75 e9                	jne    800ce5 <strlcpy+0x12>
+        *dst = '\0';
+  800cfc:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cff:	48 29 f8             	sub    %rdi,%rax
+}
+  800d02:	c3                   	ret
+
+0000000000800d03 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d03:	0f b6 07             	movzbl (%rdi),%eax
+  800d06:	84 c0                	test   %al,%al
+  800d08:	74 13                	je     800d1d <strcmp+0x1a>
+  800d0a:	38 06                	cmp    %al,(%rsi)
+  800d0c:	75 0f                	jne    800d1d <strcmp+0x1a>
+  800d0e:	48 83 c7 01          	add    $0x1,%rdi
+  800d12:	48 83 c6 01          	add    $0x1,%rsi
+  800d16:	0f b6 07             	movzbl (%rdi),%eax
+  800d19:	84 c0                	test   %al,%al
+  800d1b:	75 ed                	jne    800d0a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d1d:	0f b6 c0             	movzbl %al,%eax
+  800d20:	0f b6 16             	movzbl (%rsi),%edx
+  800d23:	29 d0                	sub    %edx,%eax
+}
+  800d25:	c3                   	ret
+
+0000000000800d26 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d26:	48 85 d2             	test   %rdx,%rdx
+  800d29:	74 1f                	je     800d4a <strncmp+0x24>
+  800d2b:	0f b6 07             	movzbl (%rdi),%eax
+  800d2e:	84 c0                	test   %al,%al
+  800d30:	74 1e                	je     800d50 <strncmp+0x2a>
+  800d32:	3a 06                	cmp    (%rsi),%al
+  800d34:	75 1a                	jne    800d50 <strncmp+0x2a>
+  800d36:	48 83 c7 01          	add    $0x1,%rdi
+  800d3a:	48 83 c6 01          	add    $0x1,%rsi
+  800d3e:	48 83 ea 01          	sub    $0x1,%rdx
+  800d42:	75 e7                	jne    800d2b <strncmp+0x5>
+
+    if (!n) return 0;
+  800d44:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d49:	c3                   	ret
+  800d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4f:	c3                   	ret
+  800d50:	48 85 d2             	test   %rdx,%rdx
+  800d53:	74 09                	je     800d5e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d55:	0f b6 07             	movzbl (%rdi),%eax
+  800d58:	0f b6 16             	movzbl (%rsi),%edx
+  800d5b:	29 d0                	sub    %edx,%eax
+  800d5d:	c3                   	ret
+    if (!n) return 0;
+  800d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d63:	c3                   	ret
+
+0000000000800d64 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d64:	0f b6 17             	movzbl (%rdi),%edx
+  800d67:	84 d2                	test   %dl,%dl
+  800d69:	74 18                	je     800d83 <strchr+0x1f>
+        if (*str == c) {
+  800d6b:	0f be d2             	movsbl %dl,%edx
+  800d6e:	39 f2                	cmp    %esi,%edx
+  800d70:	74 17                	je     800d89 <strchr+0x25>
+    for (; *str; str++) {
+  800d72:	48 83 c7 01          	add    $0x1,%rdi
+  800d76:	0f b6 17             	movzbl (%rdi),%edx
+  800d79:	84 d2                	test   %dl,%dl
+  800d7b:	75 ee                	jne    800d6b <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d82:	c3                   	ret
+  800d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d88:	c3                   	ret
+  800d89:	48 89 f8             	mov    %rdi,%rax
+}
+  800d8c:	c3                   	ret
+
+0000000000800d8d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d8d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d90:	0f b6 17             	movzbl (%rdi),%edx
+  800d93:	84 d2                	test   %dl,%dl
+  800d95:	74 13                	je     800daa <strfind+0x1d>
+  800d97:	0f be d2             	movsbl %dl,%edx
+  800d9a:	39 f2                	cmp    %esi,%edx
+  800d9c:	74 0b                	je     800da9 <strfind+0x1c>
+  800d9e:	48 83 c0 01          	add    $0x1,%rax
+  800da2:	0f b6 10             	movzbl (%rax),%edx
+  800da5:	84 d2                	test   %dl,%dl
+  800da7:	75 ee                	jne    800d97 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800da9:	c3                   	ret
+  800daa:	c3                   	ret
+
+0000000000800dab <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800dab:	55                   	push   %rbp
+  800dac:	48 89 e5             	mov    %rsp,%rbp
+  800daf:	41 57                	push   %r15
+  800db1:	41 56                	push   %r14
+  800db3:	41 55                	push   %r13
+  800db5:	41 54                	push   %r12
+  800db7:	53                   	push   %rbx
+  800db8:	48 83 ec 08          	sub    $0x8,%rsp
+  800dbc:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800dbf:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800dc3:	45 84 ed             	test   %r13b,%r13b
+  800dc6:	75 12                	jne    800dda <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800dc8:	4c 89 f8             	mov    %r15,%rax
+  800dcb:	48 83 c4 08          	add    $0x8,%rsp
+  800dcf:	5b                   	pop    %rbx
+  800dd0:	41 5c                	pop    %r12
+  800dd2:	41 5d                	pop    %r13
+  800dd4:	41 5e                	pop    %r14
+  800dd6:	41 5f                	pop    %r15
+  800dd8:	5d                   	pop    %rbp
+  800dd9:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800dda:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800dde:	4c 89 e7             	mov    %r12,%rdi
+  800de1:	48 b8 21 0c 80 00 00 	movabs $0x800c21,%rax
+  800de8:	00 00 00 
+  800deb:	ff d0                	call   *%rax
+  800ded:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800df0:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800df4:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800df8:	49 bf 26 0d 80 00 00 	movabs $0x800d26,%r15
+  800dff:	00 00 00 
+				if ((sc = *s++) == 0)
+  800e02:	84 c0                	test   %al,%al
+  800e04:	75 14                	jne    800e1a <strstr+0x6f>
+					return NULL;
+  800e06:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e0c:	eb ba                	jmp    800dc8 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800e0e:	48 83 c3 01          	add    $0x1,%rbx
+  800e12:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800e16:	84 c0                	test   %al,%al
+  800e18:	74 1b                	je     800e35 <strstr+0x8a>
+			} while (sc != c);
+  800e1a:	41 38 c5             	cmp    %al,%r13b
+  800e1d:	75 ef                	jne    800e0e <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800e1f:	4c 89 f2             	mov    %r14,%rdx
+  800e22:	4c 89 e6             	mov    %r12,%rsi
+  800e25:	48 89 df             	mov    %rbx,%rdi
+  800e28:	41 ff d7             	call   *%r15
+  800e2b:	85 c0                	test   %eax,%eax
+  800e2d:	75 df                	jne    800e0e <strstr+0x63>
+  800e2f:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800e33:	eb 93                	jmp    800dc8 <strstr+0x1d>
+					return NULL;
+  800e35:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e3b:	eb 8b                	jmp    800dc8 <strstr+0x1d>
+
+0000000000800e3d <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800e3d:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800e3f:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800e42:	8d 57 20             	lea    0x20(%rdi),%edx
+  800e45:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e48:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e4b:	c3                   	ret
+
+0000000000800e4c <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800e4c:	55                   	push   %rbp
+  800e4d:	48 89 e5             	mov    %rsp,%rbp
+  800e50:	41 57                	push   %r15
+  800e52:	41 56                	push   %r14
+  800e54:	41 55                	push   %r13
+  800e56:	41 54                	push   %r12
+  800e58:	53                   	push   %rbx
+  800e59:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800e5d:	48 39 f7             	cmp    %rsi,%rdi
+  800e60:	74 49                	je     800eab <strcasecmp+0x5f>
+  800e62:	49 89 fd             	mov    %rdi,%r13
+  800e65:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800e68:	49 bf 3d 0e 80 00 00 	movabs $0x800e3d,%r15
+  800e6f:	00 00 00 
+  800e72:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800e77:	41 0f b6 fe          	movzbl %r14b,%edi
+  800e7b:	41 ff d7             	call   *%r15
+  800e7e:	89 c3                	mov    %eax,%ebx
+  800e80:	49 83 c4 01          	add    $0x1,%r12
+  800e84:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e8a:	41 ff d7             	call   *%r15
+  800e8d:	29 c3                	sub    %eax,%ebx
+  800e8f:	75 09                	jne    800e9a <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800e91:	49 83 c5 01          	add    $0x1,%r13
+  800e95:	45 84 f6             	test   %r14b,%r14b
+  800e98:	75 d8                	jne    800e72 <strcasecmp+0x26>
+}
+  800e9a:	89 d8                	mov    %ebx,%eax
+  800e9c:	48 83 c4 08          	add    $0x8,%rsp
+  800ea0:	5b                   	pop    %rbx
+  800ea1:	41 5c                	pop    %r12
+  800ea3:	41 5d                	pop    %r13
+  800ea5:	41 5e                	pop    %r14
+  800ea7:	41 5f                	pop    %r15
+  800ea9:	5d                   	pop    %rbp
+  800eaa:	c3                   	ret
+        return 0;
+  800eab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb0:	eb e8                	jmp    800e9a <strcasecmp+0x4e>
+
+0000000000800eb2 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800eb2:	55                   	push   %rbp
+  800eb3:	48 89 e5             	mov    %rsp,%rbp
+  800eb6:	41 57                	push   %r15
+  800eb8:	41 56                	push   %r14
+  800eba:	41 55                	push   %r13
+  800ebc:	41 54                	push   %r12
+  800ebe:	53                   	push   %rbx
+  800ebf:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800ec3:	48 85 d2             	test   %rdx,%rdx
+  800ec6:	74 4f                	je     800f17 <strncasecmp+0x65>
+  800ec8:	49 89 fc             	mov    %rdi,%r12
+  800ecb:	49 89 f5             	mov    %rsi,%r13
+  800ece:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800ed2:	49 be 3d 0e 80 00 00 	movabs $0x800e3d,%r14
+  800ed9:	00 00 00 
+  800edc:	49 83 c4 01          	add    $0x1,%r12
+  800ee0:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800ee6:	41 ff d6             	call   *%r14
+  800ee9:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800eeb:	49 83 c5 01          	add    $0x1,%r13
+  800eef:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800ef4:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800ef7:	29 c3                	sub    %eax,%ebx
+  800ef9:	85 c0                	test   %eax,%eax
+  800efb:	74 09                	je     800f06 <strncasecmp+0x54>
+  800efd:	85 db                	test   %ebx,%ebx
+  800eff:	75 05                	jne    800f06 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800f01:	4d 39 fc             	cmp    %r15,%r12
+  800f04:	75 d6                	jne    800edc <strncasecmp+0x2a>
+}
+  800f06:	89 d8                	mov    %ebx,%eax
+  800f08:	48 83 c4 08          	add    $0x8,%rsp
+  800f0c:	5b                   	pop    %rbx
+  800f0d:	41 5c                	pop    %r12
+  800f0f:	41 5d                	pop    %r13
+  800f11:	41 5e                	pop    %r14
+  800f13:	41 5f                	pop    %r15
+  800f15:	5d                   	pop    %rbp
+  800f16:	c3                   	ret
+    int d = 0;
+  800f17:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800f1c:	eb e8                	jmp    800f06 <strncasecmp+0x54>
+
+0000000000800f1e <toupper>:
+
+int toupper(int c) {
+  800f1e:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800f20:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800f23:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800f26:	83 f9 1a             	cmp    $0x1a,%ecx
+  800f29:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800f2c:	c3                   	ret
+
+0000000000800f2d <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800f2d:	83 ff 20             	cmp    $0x20,%edi
+  800f30:	0f 94 c0             	sete   %al
+  800f33:	0f b6 c0             	movzbl %al,%eax
+}
+  800f36:	c3                   	ret
+
+0000000000800f37 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800f37:	89 f8                	mov    %edi,%eax
+  800f39:	f7 d8                	neg    %eax
+  800f3b:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800f3e:	c3                   	ret
+
+0000000000800f3f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f3f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f42:	48 89 f8             	mov    %rdi,%rax
+  800f45:	48 f7 d8             	neg    %rax
+  800f48:	83 e0 07             	and    $0x7,%eax
+  800f4b:	49 89 d1             	mov    %rdx,%r9
+  800f4e:	49 29 c1             	sub    %rax,%r9
+  800f51:	78 36                	js     800f89 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f53:	40 0f b6 c6          	movzbl %sil,%eax
+  800f57:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f5e:	01 01 01 
+  800f61:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f65:	40 f6 c7 07          	test   $0x7,%dil
+  800f69:	75 38                	jne    800fa3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f6b:	4c 89 c9             	mov    %r9,%rcx
+  800f6e:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f72:	74 0c                	je     800f80 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f74:	fc                   	cld
+  800f75:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f78:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f7c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f80:	4d 85 c9             	test   %r9,%r9
+  800f83:	75 45                	jne    800fca <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f85:	4c 89 c0             	mov    %r8,%rax
+  800f88:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f89:	48 85 d2             	test   %rdx,%rdx
+  800f8c:	74 f7                	je     800f85 <memset+0x46>
+  800f8e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f91:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f94:	48 83 c0 01          	add    $0x1,%rax
+  800f98:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f9c:	48 39 c2             	cmp    %rax,%rdx
+  800f9f:	75 f3                	jne    800f94 <memset+0x55>
+  800fa1:	eb e2                	jmp    800f85 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fa3:	40 f6 c7 01          	test   $0x1,%dil
+  800fa7:	74 06                	je     800faf <memset+0x70>
+  800fa9:	88 07                	mov    %al,(%rdi)
+  800fab:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800faf:	40 f6 c7 02          	test   $0x2,%dil
+  800fb3:	74 07                	je     800fbc <memset+0x7d>
+  800fb5:	66 89 07             	mov    %ax,(%rdi)
+  800fb8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fbc:	40 f6 c7 04          	test   $0x4,%dil
+  800fc0:	74 a9                	je     800f6b <memset+0x2c>
+  800fc2:	89 07                	mov    %eax,(%rdi)
+  800fc4:	48 83 c7 04          	add    $0x4,%rdi
+  800fc8:	eb a1                	jmp    800f6b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fca:	41 f6 c1 04          	test   $0x4,%r9b
+  800fce:	74 06                	je     800fd6 <memset+0x97>
+  800fd0:	89 07                	mov    %eax,(%rdi)
+  800fd2:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fd6:	41 f6 c1 02          	test   $0x2,%r9b
+  800fda:	74 07                	je     800fe3 <memset+0xa4>
+  800fdc:	66 89 07             	mov    %ax,(%rdi)
+  800fdf:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800fe3:	41 f6 c1 01          	test   $0x1,%r9b
+  800fe7:	74 9c                	je     800f85 <memset+0x46>
+  800fe9:	88 07                	mov    %al,(%rdi)
+  800feb:	eb 98                	jmp    800f85 <memset+0x46>
+
+0000000000800fed <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fed:	48 89 f8             	mov    %rdi,%rax
+  800ff0:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ff3:	48 39 fe             	cmp    %rdi,%rsi
+  800ff6:	73 3b                	jae    801033 <memmove+0x46>
+  800ff8:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ffc:	48 39 d7             	cmp    %rdx,%rdi
+  800fff:	73 32                	jae    801033 <memmove+0x46>
+        s += n;
+        d += n;
+  801001:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801005:	48 89 d6             	mov    %rdx,%rsi
+  801008:	48 09 fe             	or     %rdi,%rsi
+  80100b:	48 09 ce             	or     %rcx,%rsi
+  80100e:	40 f6 c6 07          	test   $0x7,%sil
+  801012:	75 12                	jne    801026 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801014:	48 83 ef 08          	sub    $0x8,%rdi
+  801018:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80101c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801020:	fd                   	std
+  801021:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801024:	fc                   	cld
+  801025:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801026:	48 83 ef 01          	sub    $0x1,%rdi
+  80102a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80102e:	fd                   	std
+  80102f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801031:	eb f1                	jmp    801024 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801033:	48 89 f2             	mov    %rsi,%rdx
+  801036:	48 09 c2             	or     %rax,%rdx
+  801039:	48 09 ca             	or     %rcx,%rdx
+  80103c:	f6 c2 07             	test   $0x7,%dl
+  80103f:	75 0c                	jne    80104d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801041:	48 c1 e9 03          	shr    $0x3,%rcx
+  801045:	48 89 c7             	mov    %rax,%rdi
+  801048:	fc                   	cld
+  801049:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80104c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80104d:	48 89 c7             	mov    %rax,%rdi
+  801050:	fc                   	cld
+  801051:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801053:	c3                   	ret
+
+0000000000801054 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801054:	55                   	push   %rbp
+  801055:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801058:	48 b8 ed 0f 80 00 00 	movabs $0x800fed,%rax
+  80105f:	00 00 00 
+  801062:	ff d0                	call   *%rax
+}
+  801064:	5d                   	pop    %rbp
+  801065:	c3                   	ret
+
+0000000000801066 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801066:	55                   	push   %rbp
+  801067:	48 89 e5             	mov    %rsp,%rbp
+  80106a:	41 57                	push   %r15
+  80106c:	41 56                	push   %r14
+  80106e:	41 55                	push   %r13
+  801070:	41 54                	push   %r12
+  801072:	53                   	push   %rbx
+  801073:	48 83 ec 08          	sub    $0x8,%rsp
+  801077:	49 89 fe             	mov    %rdi,%r14
+  80107a:	49 89 f7             	mov    %rsi,%r15
+  80107d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801080:	48 89 f7             	mov    %rsi,%rdi
+  801083:	48 b8 21 0c 80 00 00 	movabs $0x800c21,%rax
+  80108a:	00 00 00 
+  80108d:	ff d0                	call   *%rax
+  80108f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801092:	48 89 de             	mov    %rbx,%rsi
+  801095:	4c 89 f7             	mov    %r14,%rdi
+  801098:	48 b8 3c 0c 80 00 00 	movabs $0x800c3c,%rax
+  80109f:	00 00 00 
+  8010a2:	ff d0                	call   *%rax
+  8010a4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010a7:	48 39 c3             	cmp    %rax,%rbx
+  8010aa:	74 36                	je     8010e2 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010ac:	48 89 d8             	mov    %rbx,%rax
+  8010af:	4c 29 e8             	sub    %r13,%rax
+  8010b2:	49 39 c4             	cmp    %rax,%r12
+  8010b5:	73 31                	jae    8010e8 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010b7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010bc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010c0:	4c 89 fe             	mov    %r15,%rsi
+  8010c3:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  8010ca:	00 00 00 
+  8010cd:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8010cf:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8010d3:	48 83 c4 08          	add    $0x8,%rsp
+  8010d7:	5b                   	pop    %rbx
+  8010d8:	41 5c                	pop    %r12
+  8010da:	41 5d                	pop    %r13
+  8010dc:	41 5e                	pop    %r14
+  8010de:	41 5f                	pop    %r15
+  8010e0:	5d                   	pop    %rbp
+  8010e1:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010e2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010e6:	eb eb                	jmp    8010d3 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010e8:	48 83 eb 01          	sub    $0x1,%rbx
+  8010ec:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010f0:	48 89 da             	mov    %rbx,%rdx
+  8010f3:	4c 89 fe             	mov    %r15,%rsi
+  8010f6:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  8010fd:	00 00 00 
+  801100:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801102:	49 01 de             	add    %rbx,%r14
+  801105:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80110a:	eb c3                	jmp    8010cf <strlcat+0x69>
+
+000000000080110c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80110c:	48 85 d2             	test   %rdx,%rdx
+  80110f:	74 2d                	je     80113e <memcmp+0x32>
+  801111:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801116:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80111a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80111f:	44 38 c1             	cmp    %r8b,%cl
+  801122:	75 0f                	jne    801133 <memcmp+0x27>
+    while (n-- > 0) {
+  801124:	48 83 c0 01          	add    $0x1,%rax
+  801128:	48 39 c2             	cmp    %rax,%rdx
+  80112b:	75 e9                	jne    801116 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80112d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801132:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801133:	0f b6 c1             	movzbl %cl,%eax
+  801136:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80113a:	44 29 c0             	sub    %r8d,%eax
+  80113d:	c3                   	ret
+    return 0;
+  80113e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801143:	c3                   	ret
+
+0000000000801144 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801144:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801148:	48 39 c7             	cmp    %rax,%rdi
+  80114b:	73 0f                	jae    80115c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80114d:	40 38 37             	cmp    %sil,(%rdi)
+  801150:	74 0e                	je     801160 <memfind+0x1c>
+    for (; src < end; src++) {
+  801152:	48 83 c7 01          	add    $0x1,%rdi
+  801156:	48 39 f8             	cmp    %rdi,%rax
+  801159:	75 f2                	jne    80114d <memfind+0x9>
+  80115b:	c3                   	ret
+  80115c:	48 89 f8             	mov    %rdi,%rax
+  80115f:	c3                   	ret
+  801160:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801163:	c3                   	ret
+
+0000000000801164 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801164:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801167:	0f b6 37             	movzbl (%rdi),%esi
+  80116a:	40 80 fe 20          	cmp    $0x20,%sil
+  80116e:	74 06                	je     801176 <strtol+0x12>
+  801170:	40 80 fe 09          	cmp    $0x9,%sil
+  801174:	75 13                	jne    801189 <strtol+0x25>
+  801176:	48 83 c7 01          	add    $0x1,%rdi
+  80117a:	0f b6 37             	movzbl (%rdi),%esi
+  80117d:	40 80 fe 20          	cmp    $0x20,%sil
+  801181:	74 f3                	je     801176 <strtol+0x12>
+  801183:	40 80 fe 09          	cmp    $0x9,%sil
+  801187:	74 ed                	je     801176 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801189:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80118c:	83 e0 fd             	and    $0xfffffffd,%eax
+  80118f:	3c 01                	cmp    $0x1,%al
+  801191:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801195:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80119b:	75 0f                	jne    8011ac <strtol+0x48>
+  80119d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011a0:	74 14                	je     8011b6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011a2:	85 d2                	test   %edx,%edx
+  8011a4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011a9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011ac:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011b1:	4c 63 ca             	movslq %edx,%r9
+  8011b4:	eb 36                	jmp    8011ec <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011b6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011ba:	74 0f                	je     8011cb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011bc:	85 d2                	test   %edx,%edx
+  8011be:	75 ec                	jne    8011ac <strtol+0x48>
+        s++;
+  8011c0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011c4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8011c9:	eb e1                	jmp    8011ac <strtol+0x48>
+        s += 2;
+  8011cb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8011cf:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8011d4:	eb d6                	jmp    8011ac <strtol+0x48>
+            dig -= '0';
+  8011d6:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011d9:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011dd:	41 39 d0             	cmp    %edx,%r8d
+  8011e0:	7d 21                	jge    801203 <strtol+0x9f>
+        val = val * base + dig;
+  8011e2:	49 0f af c1          	imul   %r9,%rax
+  8011e6:	0f b6 c9             	movzbl %cl,%ecx
+  8011e9:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011ec:	48 83 c7 01          	add    $0x1,%rdi
+  8011f0:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011f4:	80 f9 39             	cmp    $0x39,%cl
+  8011f7:	76 dd                	jbe    8011d6 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011f9:	80 f9 7b             	cmp    $0x7b,%cl
+  8011fc:	77 05                	ja     801203 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011fe:	83 e9 57             	sub    $0x57,%ecx
+  801201:	eb d6                	jmp    8011d9 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801203:	4d 85 d2             	test   %r10,%r10
+  801206:	74 03                	je     80120b <strtol+0xa7>
+  801208:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80120b:	48 89 c2             	mov    %rax,%rdx
+  80120e:	48 f7 da             	neg    %rdx
+  801211:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801215:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801219:	c3                   	ret
+
+000000000080121a <atoi>:
+int atoi(const char *str) {
+  80121a:	55                   	push   %rbp
+  80121b:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  80121e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801223:	be 00 00 00 00       	mov    $0x0,%esi
+  801228:	48 b8 64 11 80 00 00 	movabs $0x801164,%rax
+  80122f:	00 00 00 
+  801232:	ff d0                	call   *%rax
+}
+  801234:	5d                   	pop    %rbp
+  801235:	c3                   	ret
+
+0000000000801236 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801236:	55                   	push   %rbp
+  801237:	48 89 e5             	mov    %rsp,%rbp
+  80123a:	53                   	push   %rbx
+  80123b:	48 89 fa             	mov    %rdi,%rdx
+  80123e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801241:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801246:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801250:	be 00 00 00 00       	mov    $0x0,%esi
+  801255:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80125d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801261:	c9                   	leave
+  801262:	c3                   	ret
+
+0000000000801263 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801263:	55                   	push   %rbp
+  801264:	48 89 e5             	mov    %rsp,%rbp
+  801267:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801268:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80126d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801272:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801277:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801281:	be 00 00 00 00       	mov    $0x0,%esi
+  801286:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80128e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801292:	c9                   	leave
+  801293:	c3                   	ret
+
+0000000000801294 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801294:	55                   	push   %rbp
+  801295:	48 89 e5             	mov    %rsp,%rbp
+  801298:	53                   	push   %rbx
+  801299:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80129d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c1:	48 85 c0             	test   %rax,%rax
+  8012c4:	7f 06                	jg     8012cc <sys_env_destroy+0x38>
+}
+  8012c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ca:	c9                   	leave
+  8012cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012cc:	49 89 c0             	mov    %rax,%r8
+  8012cf:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012d4:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8012db:	00 00 00 
+  8012de:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8012e3:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8012ea:	00 00 00 
+  8012ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f2:	49 b9 a0 43 80 00 00 	movabs $0x8043a0,%r9
+  8012f9:	00 00 00 
+  8012fc:	41 ff d1             	call   *%r9
+
+00000000008012ff <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012ff:	55                   	push   %rbp
+  801300:	48 89 e5             	mov    %rsp,%rbp
+  801303:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801304:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801309:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801313:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801318:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131d:	be 00 00 00 00       	mov    $0x0,%esi
+  801322:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801328:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80132a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80132e:	c9                   	leave
+  80132f:	c3                   	ret
+
+0000000000801330 <sys_yield>:
+
+void
+sys_yield(void) {
+  801330:	55                   	push   %rbp
+  801331:	48 89 e5             	mov    %rsp,%rbp
+  801334:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801335:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80133a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801344:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801349:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134e:	be 00 00 00 00       	mov    $0x0,%esi
+  801353:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801359:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80135b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135f:	c9                   	leave
+  801360:	c3                   	ret
+
+0000000000801361 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801361:	55                   	push   %rbp
+  801362:	48 89 e5             	mov    %rsp,%rbp
+  801365:	53                   	push   %rbx
+  801366:	48 89 fa             	mov    %rdi,%rdx
+  801369:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80136c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801371:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801378:	00 00 00 
+  80137b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801380:	be 00 00 00 00       	mov    $0x0,%esi
+  801385:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80138d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801391:	c9                   	leave
+  801392:	c3                   	ret
+
+0000000000801393 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801393:	55                   	push   %rbp
+  801394:	48 89 e5             	mov    %rsp,%rbp
+  801397:	53                   	push   %rbx
+  801398:	49 89 f8             	mov    %rdi,%r8
+  80139b:	48 89 d3             	mov    %rdx,%rbx
+  80139e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013a1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013a6:	4c 89 c2             	mov    %r8,%rdx
+  8013a9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013bd:	c9                   	leave
+  8013be:	c3                   	ret
+
+00000000008013bf <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013bf:	55                   	push   %rbp
+  8013c0:	48 89 e5             	mov    %rsp,%rbp
+  8013c3:	53                   	push   %rbx
+  8013c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8013c8:	89 f8                	mov    %edi,%eax
+  8013ca:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013cd:	48 63 f9             	movslq %ecx,%rdi
+  8013d0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013db:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e8:	48 85 c0             	test   %rax,%rax
+  8013eb:	7f 06                	jg     8013f3 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f1:	c9                   	leave
+  8013f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f3:	49 89 c0             	mov    %rax,%r8
+  8013f6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013fb:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801402:	00 00 00 
+  801405:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80140a:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801411:	00 00 00 
+  801414:	b8 00 00 00 00       	mov    $0x0,%eax
+  801419:	49 b9 a0 43 80 00 00 	movabs $0x8043a0,%r9
+  801420:	00 00 00 
+  801423:	41 ff d1             	call   *%r9
+
+0000000000801426 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801426:	55                   	push   %rbp
+  801427:	48 89 e5             	mov    %rsp,%rbp
+  80142a:	53                   	push   %rbx
+  80142b:	48 83 ec 08          	sub    $0x8,%rsp
+  80142f:	89 f8                	mov    %edi,%eax
+  801431:	49 89 f2             	mov    %rsi,%r10
+  801434:	48 89 cf             	mov    %rcx,%rdi
+  801437:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80143a:	48 63 da             	movslq %edx,%rbx
+  80143d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801440:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801445:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801448:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80144b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144d:	48 85 c0             	test   %rax,%rax
+  801450:	7f 06                	jg     801458 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801452:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801456:	c9                   	leave
+  801457:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801458:	49 89 c0             	mov    %rax,%r8
+  80145b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801460:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801467:	00 00 00 
+  80146a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80146f:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801476:	00 00 00 
+  801479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147e:	49 b9 a0 43 80 00 00 	movabs $0x8043a0,%r9
+  801485:	00 00 00 
+  801488:	41 ff d1             	call   *%r9
+
+000000000080148b <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80148b:	55                   	push   %rbp
+  80148c:	48 89 e5             	mov    %rsp,%rbp
+  80148f:	53                   	push   %rbx
+  801490:	48 83 ec 08          	sub    $0x8,%rsp
+  801494:	49 89 f9             	mov    %rdi,%r9
+  801497:	89 f0                	mov    %esi,%eax
+  801499:	48 89 d3             	mov    %rdx,%rbx
+  80149c:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80149f:	49 63 f0             	movslq %r8d,%rsi
+  8014a2:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a5:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014aa:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b5:	48 85 c0             	test   %rax,%rax
+  8014b8:	7f 06                	jg     8014c0 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c0:	49 89 c0             	mov    %rax,%r8
+  8014c3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014c8:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8014cf:	00 00 00 
+  8014d2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014d7:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8014de:	00 00 00 
+  8014e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e6:	49 b9 a0 43 80 00 00 	movabs $0x8043a0,%r9
+  8014ed:	00 00 00 
+  8014f0:	41 ff d1             	call   *%r9
+
+00000000008014f3 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	53                   	push   %rbx
+  8014f8:	89 f8                	mov    %edi,%eax
+  8014fa:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8014fd:	48 63 f9             	movslq %ecx,%rdi
+  801500:	48 63 da             	movslq %edx,%rbx
+  801503:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801506:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80150b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80150e:	be 00 00 00 00       	mov    $0x0,%esi
+  801513:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801519:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80151b:	89 c2                	mov    %eax,%edx
+  80151d:	48 85 c0             	test   %rax,%rax
+  801520:	78 0d                	js     80152f <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801522:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801527:	4d 85 c9             	test   %r9,%r9
+  80152a:	74 03                	je     80152f <sys_alloc_dma_region+0x3c>
+  80152c:	49 89 01             	mov    %rax,(%r9)
+}
+  80152f:	89 d0                	mov    %edx,%eax
+  801531:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801535:	c9                   	leave
+  801536:	c3                   	ret
+
+0000000000801537 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801537:	55                   	push   %rbp
+  801538:	48 89 e5             	mov    %rsp,%rbp
+  80153b:	53                   	push   %rbx
+  80153c:	48 83 ec 08          	sub    $0x8,%rsp
+  801540:	48 89 f1             	mov    %rsi,%rcx
+  801543:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801546:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801549:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80154e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801553:	be 00 00 00 00       	mov    $0x0,%esi
+  801558:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801560:	48 85 c0             	test   %rax,%rax
+  801563:	7f 06                	jg     80156b <sys_set_cache_region+0x34>
+}
+  801565:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801569:	c9                   	leave
+  80156a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80156b:	49 89 c0             	mov    %rax,%r8
+  80156e:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801573:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80157a:	00 00 00 
+  80157d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801582:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801589:	00 00 00 
+  80158c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801591:	49 b9 a0 43 80 00 00 	movabs $0x8043a0,%r9
+  801598:	00 00 00 
+  80159b:	41 ff d1             	call   *%r9
+
+000000000080159e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80159e:	55                   	push   %rbp
+  80159f:	48 89 e5             	mov    %rsp,%rbp
+  8015a2:	53                   	push   %rbx
+  8015a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a7:	48 89 f1             	mov    %rsi,%rcx
+  8015aa:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015ad:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b0:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c7:	48 85 c0             	test   %rax,%rax
+  8015ca:	7f 06                	jg     8015d2 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d0:	c9                   	leave
+  8015d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d2:	49 89 c0             	mov    %rax,%r8
+  8015d5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015da:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8015e1:	00 00 00 
+  8015e4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015e9:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8015f0:	00 00 00 
+  8015f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f8:	49 b9 a0 43 80 00 00 	movabs $0x8043a0,%r9
+  8015ff:	00 00 00 
+  801602:	41 ff d1             	call   *%r9
+
+0000000000801605 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801605:	55                   	push   %rbp
+  801606:	48 89 e5             	mov    %rsp,%rbp
+  801609:	53                   	push   %rbx
+  80160a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80160e:	48 63 ce             	movslq %esi,%rcx
+  801611:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801614:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801619:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801623:	be 00 00 00 00       	mov    $0x0,%esi
+  801628:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801630:	48 85 c0             	test   %rax,%rax
+  801633:	7f 06                	jg     80163b <sys_env_set_status+0x36>
+}
+  801635:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801639:	c9                   	leave
+  80163a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163b:	49 89 c0             	mov    %rax,%r8
+  80163e:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801643:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80164a:	00 00 00 
+  80164d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801652:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801659:	00 00 00 
+  80165c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801661:	49 b9 a0 43 80 00 00 	movabs $0x8043a0,%r9
+  801668:	00 00 00 
+  80166b:	41 ff d1             	call   *%r9
+
+000000000080166e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+  801672:	53                   	push   %rbx
+  801673:	48 83 ec 08          	sub    $0x8,%rsp
+  801677:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80167a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80167d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801682:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801687:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168c:	be 00 00 00 00       	mov    $0x0,%esi
+  801691:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801697:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801699:	48 85 c0             	test   %rax,%rax
+  80169c:	7f 06                	jg     8016a4 <sys_env_set_trapframe+0x36>
+}
+  80169e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a2:	c9                   	leave
+  8016a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a4:	49 89 c0             	mov    %rax,%r8
+  8016a7:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8016ac:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8016b3:	00 00 00 
+  8016b6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016bb:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8016c2:	00 00 00 
+  8016c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ca:	49 b9 a0 43 80 00 00 	movabs $0x8043a0,%r9
+  8016d1:	00 00 00 
+  8016d4:	41 ff d1             	call   *%r9
+
+00000000008016d7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016d7:	55                   	push   %rbp
+  8016d8:	48 89 e5             	mov    %rsp,%rbp
+  8016db:	53                   	push   %rbx
+  8016dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8016e0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016e3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e6:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801700:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801702:	48 85 c0             	test   %rax,%rax
+  801705:	7f 06                	jg     80170d <sys_env_set_pgfault_upcall+0x36>
+}
+  801707:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170b:	c9                   	leave
+  80170c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80170d:	49 89 c0             	mov    %rax,%r8
+  801710:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801715:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80171c:	00 00 00 
+  80171f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801724:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80172b:	00 00 00 
+  80172e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801733:	49 b9 a0 43 80 00 00 	movabs $0x8043a0,%r9
+  80173a:	00 00 00 
+  80173d:	41 ff d1             	call   *%r9
+
+0000000000801740 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801740:	55                   	push   %rbp
+  801741:	48 89 e5             	mov    %rsp,%rbp
+  801744:	53                   	push   %rbx
+  801745:	89 f8                	mov    %edi,%eax
+  801747:	49 89 f1             	mov    %rsi,%r9
+  80174a:	48 89 d3             	mov    %rdx,%rbx
+  80174d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801750:	49 63 f0             	movslq %r8d,%rsi
+  801753:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801756:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80175b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80175e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801764:	cd 30                	int    $0x30
+}
+  801766:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176a:	c9                   	leave
+  80176b:	c3                   	ret
+
+000000000080176c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80176c:	55                   	push   %rbp
+  80176d:	48 89 e5             	mov    %rsp,%rbp
+  801770:	53                   	push   %rbx
+  801771:	48 83 ec 08          	sub    $0x8,%rsp
+  801775:	48 89 fa             	mov    %rdi,%rdx
+  801778:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80177b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801780:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801785:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80178a:	be 00 00 00 00       	mov    $0x0,%esi
+  80178f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801795:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801797:	48 85 c0             	test   %rax,%rax
+  80179a:	7f 06                	jg     8017a2 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80179c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a0:	c9                   	leave
+  8017a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017a2:	49 89 c0             	mov    %rax,%r8
+  8017a5:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8017aa:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8017b1:	00 00 00 
+  8017b4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017b9:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8017c0:	00 00 00 
+  8017c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c8:	49 b9 a0 43 80 00 00 	movabs $0x8043a0,%r9
+  8017cf:	00 00 00 
+  8017d2:	41 ff d1             	call   *%r9
+
+00000000008017d5 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8017d5:	55                   	push   %rbp
+  8017d6:	48 89 e5             	mov    %rsp,%rbp
+  8017d9:	53                   	push   %rbx
+  8017da:	48 89 fa             	mov    %rdi,%rdx
+  8017dd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e0:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017fa:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801800:	c9                   	leave
+  801801:	c3                   	ret
+
+0000000000801802 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801802:	55                   	push   %rbp
+  801803:	48 89 e5             	mov    %rsp,%rbp
+  801806:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801807:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80180c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801811:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801816:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801820:	be 00 00 00 00       	mov    $0x0,%esi
+  801825:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80182b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80182d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801831:	c9                   	leave
+  801832:	c3                   	ret
+
+0000000000801833 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801833:	48 85 ff             	test   %rdi,%rdi
+  801836:	0f 84 b6 01 00 00    	je     8019f2 <malloc+0x1bf>
+malloc(size_t size) {
+  80183c:	55                   	push   %rbp
+  80183d:	48 89 e5             	mov    %rsp,%rbp
+  801840:	41 56                	push   %r14
+  801842:	41 55                	push   %r13
+  801844:	41 54                	push   %r12
+  801846:	53                   	push   %rbx
+  801847:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80184a:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801851:	00 00 00 
+  801854:	4c 8b 20             	mov    (%rax),%r12
+  801857:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80185e:	0f 87 94 01 00 00    	ja     8019f8 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801864:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80186b:	00 00 00 
+  80186e:	48 85 c0             	test   %rax,%rax
+  801871:	74 6b                	je     8018de <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801873:	4d 85 e4             	test   %r12,%r12
+  801876:	74 66                	je     8018de <malloc+0xab>
+  801878:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80187f:	00 00 00 
+  801882:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801887:	eb 0d                	jmp    801896 <malloc+0x63>
+  801889:	48 83 c1 01          	add    $0x1,%rcx
+  80188d:	48 83 c2 18          	add    $0x18,%rdx
+  801891:	49 39 cc             	cmp    %rcx,%r12
+  801894:	74 48                	je     8018de <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801896:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80189b:	74 ec                	je     801889 <malloc+0x56>
+  80189d:	48 39 1a             	cmp    %rbx,(%rdx)
+  8018a0:	72 e7                	jb     801889 <malloc+0x56>
+                real_freep_size--;
+  8018a2:	48 83 e8 01          	sub    $0x1,%rax
+  8018a6:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  8018ad:	00 00 00 
+                freep[i].is_free = false;
+  8018b0:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8018b7:	00 00 00 
+  8018ba:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8018be:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8018c2:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8018c6:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8018cd:	00 
+                freep[i].size = size;
+  8018ce:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8018d2:	48 01 c8             	add    %rcx,%rax
+  8018d5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8018d9:	e9 0b 01 00 00       	jmp    8019e9 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8018de:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8018e5:	00 00 00 
+  8018e8:	48 01 d8             	add    %rbx,%rax
+  8018eb:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8018f1:	76 7c                	jbe    80196f <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8018f3:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8018fa:	00 00 00 
+  8018fd:	4c 8b 30             	mov    (%rax),%r14
+  801900:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801907:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  80190a:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801911:	00 00 00 
+  801914:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  80191b:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801922:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801928:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80192c:	48 b8 ff 12 80 00 00 	movabs $0x8012ff,%rax
+  801933:	00 00 00 
+  801936:	ff d0                	call   *%rax
+  801938:	89 c7                	mov    %eax,%edi
+  80193a:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801941:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801948:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80194f:	00 00 00 
+  801952:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801956:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80195b:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  801962:	00 00 00 
+  801965:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801967:	85 c0                	test   %eax,%eax
+  801969:	0f 88 90 00 00 00    	js     8019ff <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80196f:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801976:	00 00 00 
+  801979:	48 8b 31             	mov    (%rcx),%rsi
+  80197c:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801983:	00 00 00 
+  801986:	4c 8b 07             	mov    (%rdi),%r8
+  801989:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80198d:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801994:	00 00 00 
+  801997:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80199b:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80199f:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8019a6:	00 00 00 
+  8019a9:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  8019ad:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  8019b0:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8019b4:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8019bb:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8019bc:	48 89 d8             	mov    %rbx,%rax
+  8019bf:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019c4:	4c 01 c0             	add    %r8,%rax
+  8019c7:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8019ca:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8019d1:	48 01 f3             	add    %rsi,%rbx
+  8019d4:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8019d7:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8019dc:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8019e3:	00 00 00 
+  8019e6:	48 89 d0             	mov    %rdx,%rax
+}
+  8019e9:	5b                   	pop    %rbx
+  8019ea:	41 5c                	pop    %r12
+  8019ec:	41 5d                	pop    %r13
+  8019ee:	41 5e                	pop    %r14
+  8019f0:	5d                   	pop    %rbp
+  8019f1:	c3                   	ret
+        return NULL;
+  8019f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019f7:	c3                   	ret
+        return NULL;
+  8019f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fd:	eb ea                	jmp    8019e9 <malloc+0x1b6>
+            return NULL;
+  8019ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a04:	eb e3                	jmp    8019e9 <malloc+0x1b6>
+
+0000000000801a06 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801a06:	55                   	push   %rbp
+  801a07:	48 89 e5             	mov    %rsp,%rbp
+  801a0a:	53                   	push   %rbx
+  801a0b:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801a0f:	48 89 fb             	mov    %rdi,%rbx
+  801a12:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801a16:	48 89 df             	mov    %rbx,%rdi
+  801a19:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  801a20:	00 00 00 
+  801a23:	ff d0                	call   *%rax
+  801a25:	48 89 c7             	mov    %rax,%rdi
+  801a28:	48 89 da             	mov    %rbx,%rdx
+  801a2b:	be 00 00 00 00       	mov    $0x0,%esi
+  801a30:	48 b8 3f 0f 80 00 00 	movabs $0x800f3f,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+}
+  801a3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a40:	c9                   	leave
+  801a41:	c3                   	ret
+
+0000000000801a42 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801a42:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801a49:	00 00 00 
+  801a4c:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801a53:	00 00 00 
+  801a56:	48 3b 02             	cmp    (%rdx),%rax
+  801a59:	74 4d                	je     801aa8 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801a5b:	48 85 c0             	test   %rax,%rax
+  801a5e:	74 4d                	je     801aad <get_allocsize+0x6b>
+  801a60:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801a67:	00 00 00 
+  801a6a:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801a6f:	48 3b 39             	cmp    (%rcx),%rdi
+  801a72:	74 13                	je     801a87 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801a74:	48 83 c2 01          	add    $0x1,%rdx
+  801a78:	48 83 c1 18          	add    $0x18,%rcx
+  801a7c:	48 39 d0             	cmp    %rdx,%rax
+  801a7f:	75 ee                	jne    801a6f <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801a81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a86:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801a87:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a90:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a97:	00 00 00 
+  801a9a:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801aa0:	75 0b                	jne    801aad <get_allocsize+0x6b>
+  801aa2:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801aa7:	c3                   	ret
+        return 0;
+  801aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aad:	c3                   	ret
+
+0000000000801aae <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801aae:	48 85 ff             	test   %rdi,%rdi
+  801ab1:	0f 84 01 01 00 00    	je     801bb8 <free+0x10a>
+free(void *ptr) {
+  801ab7:	55                   	push   %rbp
+  801ab8:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801abb:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801ac2:	00 00 00 
+  801ac5:	48 8b 30             	mov    (%rax),%rsi
+  801ac8:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801acf:	00 00 00 
+  801ad2:	48 39 c6             	cmp    %rax,%rsi
+  801ad5:	74 50                	je     801b27 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801ad7:	48 85 f6             	test   %rsi,%rsi
+  801ada:	74 21                	je     801afd <free+0x4f>
+  801adc:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801ae3:	00 00 00 
+  801ae6:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801aeb:	48 3b 39             	cmp    (%rcx),%rdi
+  801aee:	74 61                	je     801b51 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801af0:	48 83 c2 01          	add    $0x1,%rdx
+  801af4:	48 83 c1 18          	add    $0x18,%rcx
+  801af8:	48 39 d6             	cmp    %rdx,%rsi
+  801afb:	75 ee                	jne    801aeb <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801afd:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  801b04:	00 00 00 
+  801b07:	be 12 01 00 00       	mov    $0x112,%esi
+  801b0c:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801b13:	00 00 00 
+  801b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1b:	48 b9 a0 43 80 00 00 	movabs $0x8043a0,%rcx
+  801b22:	00 00 00 
+  801b25:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801b27:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801b2e:	00 00 00 
+  801b31:	be 06 01 00 00       	mov    $0x106,%esi
+  801b36:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801b3d:	00 00 00 
+  801b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b45:	48 b9 a0 43 80 00 00 	movabs $0x8043a0,%rcx
+  801b4c:	00 00 00 
+  801b4f:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801b51:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b55:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801b5c:	00 00 00 
+  801b5f:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b65:	75 27                	jne    801b8e <free+0xe0>
+            freep[i].is_free = true;
+  801b67:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b6b:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801b72:	00 00 00 
+  801b75:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801b7c:	00 00 
+            real_freep_size++;
+  801b7e:	48 83 c0 01          	add    $0x1,%rax
+  801b82:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801b89:	00 00 00 
+}
+  801b8c:	5d                   	pop    %rbp
+  801b8d:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801b8e:	48 ba a8 55 80 00 00 	movabs $0x8055a8,%rdx
+  801b95:	00 00 00 
+  801b98:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801b9d:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801ba4:	00 00 00 
+  801ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bac:	48 b9 a0 43 80 00 00 	movabs $0x8043a0,%rcx
+  801bb3:	00 00 00 
+  801bb6:	ff d1                	call   *%rcx
+  801bb8:	c3                   	ret
+
+0000000000801bb9 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801bb9:	55                   	push   %rbp
+  801bba:	48 89 e5             	mov    %rsp,%rbp
+  801bbd:	41 55                	push   %r13
+  801bbf:	41 54                	push   %r12
+  801bc1:	53                   	push   %rbx
+  801bc2:	48 83 ec 08          	sub    $0x8,%rsp
+  801bc6:	48 89 fb             	mov    %rdi,%rbx
+  801bc9:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801bcc:	48 b8 42 1a 80 00 00 	movabs $0x801a42,%rax
+  801bd3:	00 00 00 
+  801bd6:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801bd8:	49 39 c5             	cmp    %rax,%r13
+  801bdb:	73 0e                	jae    801beb <realloc+0x32>
+}
+  801bdd:	48 89 d8             	mov    %rbx,%rax
+  801be0:	48 83 c4 08          	add    $0x8,%rsp
+  801be4:	5b                   	pop    %rbx
+  801be5:	41 5c                	pop    %r12
+  801be7:	41 5d                	pop    %r13
+  801be9:	5d                   	pop    %rbp
+  801bea:	c3                   	ret
+  801beb:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801bee:	4c 89 ef             	mov    %r13,%rdi
+  801bf1:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+  801bfd:	48 89 c7             	mov    %rax,%rdi
+  801c00:	4c 89 e2             	mov    %r12,%rdx
+  801c03:	48 89 de             	mov    %rbx,%rsi
+  801c06:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  801c0d:	00 00 00 
+  801c10:	ff d0                	call   *%rax
+  801c12:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801c15:	48 89 df             	mov    %rbx,%rdi
+  801c18:	48 b8 ae 1a 80 00 00 	movabs $0x801aae,%rax
+  801c1f:	00 00 00 
+  801c22:	ff d0                	call   *%rax
+    return newptr;
+  801c24:	4c 89 e3             	mov    %r12,%rbx
+  801c27:	eb b4                	jmp    801bdd <realloc+0x24>
+
+0000000000801c29 <strdup>:
+
+char*
+strdup (const char *src) {
+  801c29:	55                   	push   %rbp
+  801c2a:	48 89 e5             	mov    %rsp,%rbp
+  801c2d:	41 54                	push   %r12
+  801c2f:	53                   	push   %rbx
+  801c30:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801c33:	48 b8 21 0c 80 00 00 	movabs $0x800c21,%rax
+  801c3a:	00 00 00 
+  801c3d:	ff d0                	call   *%rax
+  801c3f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801c43:	4c 89 e7             	mov    %r12,%rdi
+  801c46:	48 b8 33 18 80 00 00 	movabs $0x801833,%rax
+  801c4d:	00 00 00 
+  801c50:	ff d0                	call   *%rax
+  801c52:	48 89 c7             	mov    %rax,%rdi
+  801c55:	4c 89 e2             	mov    %r12,%rdx
+  801c58:	48 89 de             	mov    %rbx,%rsi
+  801c5b:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  801c62:	00 00 00 
+  801c65:	ff d0                	call   *%rax
+}
+  801c67:	5b                   	pop    %rbx
+  801c68:	41 5c                	pop    %r12
+  801c6a:	5d                   	pop    %rbp
+  801c6b:	c3                   	ret
+
+0000000000801c6c <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801c6c:	55                   	push   %rbp
+  801c6d:	48 89 e5             	mov    %rsp,%rbp
+  801c70:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c71:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c85:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801c8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c95:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c9b:	c9                   	leave
+  801c9c:	c3                   	ret
+
+0000000000801c9d <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801c9d:	55                   	push   %rbp
+  801c9e:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801ca1:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801ca8:	00 00 00 
+  801cab:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801caf:	74 26                	je     801cd7 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801cb1:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801cb3:	48 c1 e2 20          	shl    $0x20,%rdx
+  801cb7:	89 c0                	mov    %eax,%eax
+  801cb9:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801cbc:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801cc3:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801cca:	00 00 00 
+  801ccd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd2:	48 f7 31             	divq   (%rcx)
+}
+  801cd5:	5d                   	pop    %rbp
+  801cd6:	c3                   	ret
+        freq = get_cpufreq();
+  801cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdc:	48 ba 6c 1c 80 00 00 	movabs $0x801c6c,%rdx
+  801ce3:	00 00 00 
+  801ce6:	ff d2                	call   *%rdx
+  801ce8:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801cef:	00 00 00 
+  801cf2:	eb bd                	jmp    801cb1 <get_ticks+0x14>
+
+0000000000801cf4 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801cf4:	55                   	push   %rbp
+  801cf5:	48 89 e5             	mov    %rsp,%rbp
+  801cf8:	53                   	push   %rbx
+  801cf9:	48 83 ec 08          	sub    $0x8,%rsp
+  801cfd:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801d00:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d07:	00 00 00 
+  801d0a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d0e:	74 50                	je     801d60 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801d10:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d12:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d16:	89 c0                	mov    %eax,%eax
+  801d18:	48 89 d6             	mov    %rdx,%rsi
+  801d1b:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801d1e:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d25:	00 00 00 
+  801d28:	48 0f af 18          	imul   (%rax),%rbx
+  801d2c:	48 c1 eb 03          	shr    $0x3,%rbx
+  801d30:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801d37:	9b c4 20 
+  801d3a:	48 89 d8             	mov    %rbx,%rax
+  801d3d:	48 f7 e2             	mul    %rdx
+  801d40:	48 89 d1             	mov    %rdx,%rcx
+  801d43:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801d47:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d49:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d4d:	89 c0                	mov    %eax,%eax
+  801d4f:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801d52:	48 29 f2             	sub    %rsi,%rdx
+  801d55:	48 39 ca             	cmp    %rcx,%rdx
+  801d58:	72 ed                	jb     801d47 <sleep+0x53>
+}
+  801d5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d5e:	c9                   	leave
+  801d5f:	c3                   	ret
+        freq = get_cpufreq();
+  801d60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d65:	48 ba 6c 1c 80 00 00 	movabs $0x801c6c,%rdx
+  801d6c:	00 00 00 
+  801d6f:	ff d2                	call   *%rdx
+  801d71:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801d78:	00 00 00 
+  801d7b:	eb 93                	jmp    801d10 <sleep+0x1c>
+
+0000000000801d7d <poll_kbd>:
+
+int poll_kbd() {
+  801d7d:	55                   	push   %rbp
+  801d7e:	48 89 e5             	mov    %rsp,%rbp
+  801d81:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d82:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d96:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d9b:	be 00 00 00 00       	mov    $0x0,%esi
+  801da0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801da6:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801da8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dac:	c9                   	leave
+  801dad:	c3                   	ret
+
+0000000000801dae <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801dae:	55                   	push   %rbp
+  801daf:	48 89 e5             	mov    %rsp,%rbp
+  801db2:	53                   	push   %rbx
+  801db3:	49 89 fa             	mov    %rdi,%r10
+  801db6:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801db8:	44 89 c6             	mov    %r8d,%esi
+  801dbb:	89 cf                	mov    %ecx,%edi
+  801dbd:	89 d3                	mov    %edx,%ebx
+  801dbf:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801dc1:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801dc6:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dc9:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801dcd:	cd 30                	int    $0x30
+  801dcf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dd3:	c9                   	leave
+  801dd4:	c3                   	ret
+
+0000000000801dd5 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  801dd5:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  801dd8:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  801ddc:	83 3f 01             	cmpl   $0x1,(%rdi)
+  801ddf:	7e 0f                	jle    801df0 <argstart+0x1b>
+  801de1:	48 b8 11 50 80 00 00 	movabs $0x805011,%rax
+  801de8:	00 00 00 
+  801deb:	48 85 f6             	test   %rsi,%rsi
+  801dee:	75 05                	jne    801df5 <argstart+0x20>
+  801df0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df5:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  801df9:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  801e00:	00 
+}
+  801e01:	c3                   	ret
+
+0000000000801e02 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  801e02:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801e09:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  801e0a:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801e0e:	48 85 c0             	test   %rax,%rax
+  801e11:	0f 84 8f 00 00 00    	je     801ea6 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  801e17:	55                   	push   %rbp
+  801e18:	48 89 e5             	mov    %rsp,%rbp
+  801e1b:	53                   	push   %rbx
+  801e1c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e20:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  801e23:	80 38 00             	cmpb   $0x0,(%rax)
+  801e26:	75 52                	jne    801e7a <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  801e28:	48 8b 17             	mov    (%rdi),%rdx
+  801e2b:	83 3a 01             	cmpl   $0x1,(%rdx)
+  801e2e:	74 67                	je     801e97 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801e30:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801e34:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  801e38:	80 38 2d             	cmpb   $0x2d,(%rax)
+  801e3b:	75 5a                	jne    801e97 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801e3d:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801e41:	74 54                	je     801e97 <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  801e43:	48 83 c0 01          	add    $0x1,%rax
+  801e47:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801e4b:	8b 12                	mov    (%rdx),%edx
+  801e4d:	83 ea 01             	sub    $0x1,%edx
+  801e50:	48 63 d2             	movslq %edx,%rdx
+  801e53:	48 c1 e2 03          	shl    $0x3,%rdx
+  801e57:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  801e5b:	48 83 c7 08          	add    $0x8,%rdi
+  801e5f:	48 b8 ed 0f 80 00 00 	movabs $0x800fed,%rax
+  801e66:	00 00 00 
+  801e69:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  801e6b:	48 8b 03             	mov    (%rbx),%rax
+  801e6e:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  801e71:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801e75:	80 38 2d             	cmpb   $0x2d,(%rax)
+  801e78:	74 17                	je     801e91 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  801e7a:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801e7e:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  801e81:	48 83 c0 01          	add    $0x1,%rax
+  801e85:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  801e89:	89 d0                	mov    %edx,%eax
+  801e8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e8f:	c9                   	leave
+  801e90:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  801e91:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801e95:	75 e3                	jne    801e7a <argnext+0x78>
+    args->curarg = 0;
+  801e97:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801e9e:	00 
+    return -1;
+  801e9f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801ea4:	eb e3                	jmp    801e89 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  801ea6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  801eab:	89 d0                	mov    %edx,%eax
+  801ead:	c3                   	ret
+
+0000000000801eae <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  801eae:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801eb2:	48 85 c0             	test   %rax,%rax
+  801eb5:	74 7b                	je     801f32 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  801eb7:	55                   	push   %rbp
+  801eb8:	48 89 e5             	mov    %rsp,%rbp
+  801ebb:	53                   	push   %rbx
+  801ebc:	48 83 ec 08          	sub    $0x8,%rsp
+  801ec0:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  801ec3:	80 38 00             	cmpb   $0x0,(%rax)
+  801ec6:	74 1c                	je     801ee4 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  801ec8:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  801ecc:	48 b8 11 50 80 00 00 	movabs $0x805011,%rax
+  801ed3:	00 00 00 
+  801ed6:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  801eda:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  801ede:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ee2:	c9                   	leave
+  801ee3:	c3                   	ret
+    } else if (*args->argc > 1) {
+  801ee4:	48 8b 07             	mov    (%rdi),%rax
+  801ee7:	83 38 01             	cmpl   $0x1,(%rax)
+  801eea:	7f 12                	jg     801efe <argnextvalue+0x50>
+        args->argvalue = 0;
+  801eec:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801ef3:	00 
+        args->curarg = 0;
+  801ef4:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  801efb:	00 
+  801efc:	eb dc                	jmp    801eda <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  801efe:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801f02:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801f06:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801f0a:	8b 10                	mov    (%rax),%edx
+  801f0c:	83 ea 01             	sub    $0x1,%edx
+  801f0f:	48 63 d2             	movslq %edx,%rdx
+  801f12:	48 c1 e2 03          	shl    $0x3,%rdx
+  801f16:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  801f1a:	48 83 c7 08          	add    $0x8,%rdi
+  801f1e:	48 b8 ed 0f 80 00 00 	movabs $0x800fed,%rax
+  801f25:	00 00 00 
+  801f28:	ff d0                	call   *%rax
+        (*args->argc)--;
+  801f2a:	48 8b 03             	mov    (%rbx),%rax
+  801f2d:	83 28 01             	subl   $0x1,(%rax)
+  801f30:	eb a8                	jmp    801eda <argnextvalue+0x2c>
+}
+  801f32:	c3                   	ret
+
+0000000000801f33 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801f33:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  801f37:	48 85 c0             	test   %rax,%rax
+  801f3a:	74 01                	je     801f3d <argvalue+0xa>
+}
+  801f3c:	c3                   	ret
+argvalue(struct Argstate *args) {
+  801f3d:	55                   	push   %rbp
+  801f3e:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801f41:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  801f48:	00 00 00 
+  801f4b:	ff d0                	call   *%rax
+}
+  801f4d:	5d                   	pop    %rbp
+  801f4e:	c3                   	ret
+
+0000000000801f4f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f4f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801f56:	ff ff ff 
+  801f59:	48 01 f8             	add    %rdi,%rax
+  801f5c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801f60:	c3                   	ret
+
+0000000000801f61 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f61:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801f68:	ff ff ff 
+  801f6b:	48 01 f8             	add    %rdi,%rax
+  801f6e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801f72:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801f78:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801f7c:	c3                   	ret
+
+0000000000801f7d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801f7d:	55                   	push   %rbp
+  801f7e:	48 89 e5             	mov    %rsp,%rbp
+  801f81:	41 57                	push   %r15
+  801f83:	41 56                	push   %r14
+  801f85:	41 55                	push   %r13
+  801f87:	41 54                	push   %r12
+  801f89:	53                   	push   %rbx
+  801f8a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f8e:	49 89 ff             	mov    %rdi,%r15
+  801f91:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801f96:	49 bd f9 3f 80 00 00 	movabs $0x803ff9,%r13
+  801f9d:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801fa0:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801fa6:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801fa9:	48 89 df             	mov    %rbx,%rdi
+  801fac:	41 ff d5             	call   *%r13
+  801faf:	83 e0 04             	and    $0x4,%eax
+  801fb2:	74 17                	je     801fcb <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801fb4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801fbb:	4c 39 f3             	cmp    %r14,%rbx
+  801fbe:	75 e6                	jne    801fa6 <fd_alloc+0x29>
+  801fc0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801fc6:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801fcb:	4d 89 27             	mov    %r12,(%r15)
+}
+  801fce:	48 83 c4 08          	add    $0x8,%rsp
+  801fd2:	5b                   	pop    %rbx
+  801fd3:	41 5c                	pop    %r12
+  801fd5:	41 5d                	pop    %r13
+  801fd7:	41 5e                	pop    %r14
+  801fd9:	41 5f                	pop    %r15
+  801fdb:	5d                   	pop    %rbp
+  801fdc:	c3                   	ret
+
+0000000000801fdd <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801fdd:	83 ff 1f             	cmp    $0x1f,%edi
+  801fe0:	77 39                	ja     80201b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801fe2:	55                   	push   %rbp
+  801fe3:	48 89 e5             	mov    %rsp,%rbp
+  801fe6:	41 54                	push   %r12
+  801fe8:	53                   	push   %rbx
+  801fe9:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801fec:	48 63 df             	movslq %edi,%rbx
+  801fef:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ff6:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ffa:	48 89 df             	mov    %rbx,%rdi
+  801ffd:	48 b8 f9 3f 80 00 00 	movabs $0x803ff9,%rax
+  802004:	00 00 00 
+  802007:	ff d0                	call   *%rax
+  802009:	a8 04                	test   $0x4,%al
+  80200b:	74 14                	je     802021 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80200d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802011:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802016:	5b                   	pop    %rbx
+  802017:	41 5c                	pop    %r12
+  802019:	5d                   	pop    %rbp
+  80201a:	c3                   	ret
+        return -E_INVAL;
+  80201b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802020:	c3                   	ret
+        return -E_INVAL;
+  802021:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802026:	eb ee                	jmp    802016 <fd_lookup+0x39>
+
+0000000000802028 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802028:	55                   	push   %rbp
+  802029:	48 89 e5             	mov    %rsp,%rbp
+  80202c:	41 54                	push   %r12
+  80202e:	53                   	push   %rbx
+  80202f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802032:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  802039:	00 00 00 
+  80203c:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802043:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802046:	39 3b                	cmp    %edi,(%rbx)
+  802048:	74 47                	je     802091 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80204a:	48 83 c0 08          	add    $0x8,%rax
+  80204e:	48 8b 18             	mov    (%rax),%rbx
+  802051:	48 85 db             	test   %rbx,%rbx
+  802054:	75 f0                	jne    802046 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802056:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80205d:	00 00 00 
+  802060:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802066:	89 fa                	mov    %edi,%edx
+  802068:	48 bf 08 56 80 00 00 	movabs $0x805608,%rdi
+  80206f:	00 00 00 
+  802072:	b8 00 00 00 00       	mov    $0x0,%eax
+  802077:	48 b9 e7 02 80 00 00 	movabs $0x8002e7,%rcx
+  80207e:	00 00 00 
+  802081:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802083:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802088:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80208c:	5b                   	pop    %rbx
+  80208d:	41 5c                	pop    %r12
+  80208f:	5d                   	pop    %rbp
+  802090:	c3                   	ret
+            return 0;
+  802091:	b8 00 00 00 00       	mov    $0x0,%eax
+  802096:	eb f0                	jmp    802088 <dev_lookup+0x60>
+
+0000000000802098 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802098:	55                   	push   %rbp
+  802099:	48 89 e5             	mov    %rsp,%rbp
+  80209c:	41 55                	push   %r13
+  80209e:	41 54                	push   %r12
+  8020a0:	53                   	push   %rbx
+  8020a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8020a5:	48 89 fb             	mov    %rdi,%rbx
+  8020a8:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020ab:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8020b2:	ff ff ff 
+  8020b5:	48 01 df             	add    %rbx,%rdi
+  8020b8:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8020bc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020c0:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  8020c7:	00 00 00 
+  8020ca:	ff d0                	call   *%rax
+  8020cc:	41 89 c5             	mov    %eax,%r13d
+  8020cf:	85 c0                	test   %eax,%eax
+  8020d1:	78 06                	js     8020d9 <fd_close+0x41>
+  8020d3:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8020d7:	74 1a                	je     8020f3 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8020d9:	45 84 e4             	test   %r12b,%r12b
+  8020dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e1:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8020e5:	44 89 e8             	mov    %r13d,%eax
+  8020e8:	48 83 c4 18          	add    $0x18,%rsp
+  8020ec:	5b                   	pop    %rbx
+  8020ed:	41 5c                	pop    %r12
+  8020ef:	41 5d                	pop    %r13
+  8020f1:	5d                   	pop    %rbp
+  8020f2:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8020f3:	8b 3b                	mov    (%rbx),%edi
+  8020f5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020f9:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  802100:	00 00 00 
+  802103:	ff d0                	call   *%rax
+  802105:	41 89 c5             	mov    %eax,%r13d
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	78 1b                	js     802127 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80210c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802110:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802114:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80211a:	48 85 c0             	test   %rax,%rax
+  80211d:	74 08                	je     802127 <fd_close+0x8f>
+  80211f:	48 89 df             	mov    %rbx,%rdi
+  802122:	ff d0                	call   *%rax
+  802124:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802127:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80212c:	48 89 de             	mov    %rbx,%rsi
+  80212f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802134:	48 b8 9e 15 80 00 00 	movabs $0x80159e,%rax
+  80213b:	00 00 00 
+  80213e:	ff d0                	call   *%rax
+    return res;
+  802140:	eb a3                	jmp    8020e5 <fd_close+0x4d>
+
+0000000000802142 <close>:
+
+int
+close(int fdnum) {
+  802142:	55                   	push   %rbp
+  802143:	48 89 e5             	mov    %rsp,%rbp
+  802146:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80214a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80214e:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  802155:	00 00 00 
+  802158:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80215a:	85 c0                	test   %eax,%eax
+  80215c:	78 15                	js     802173 <close+0x31>
+
+    return fd_close(fd, 1);
+  80215e:	be 01 00 00 00       	mov    $0x1,%esi
+  802163:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802167:	48 b8 98 20 80 00 00 	movabs $0x802098,%rax
+  80216e:	00 00 00 
+  802171:	ff d0                	call   *%rax
+}
+  802173:	c9                   	leave
+  802174:	c3                   	ret
+
+0000000000802175 <close_all>:
+
+void
+close_all(void) {
+  802175:	55                   	push   %rbp
+  802176:	48 89 e5             	mov    %rsp,%rbp
+  802179:	41 54                	push   %r12
+  80217b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80217c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802181:	49 bc 42 21 80 00 00 	movabs $0x802142,%r12
+  802188:	00 00 00 
+  80218b:	89 df                	mov    %ebx,%edi
+  80218d:	41 ff d4             	call   *%r12
+  802190:	83 c3 01             	add    $0x1,%ebx
+  802193:	83 fb 20             	cmp    $0x20,%ebx
+  802196:	75 f3                	jne    80218b <close_all+0x16>
+}
+  802198:	5b                   	pop    %rbx
+  802199:	41 5c                	pop    %r12
+  80219b:	5d                   	pop    %rbp
+  80219c:	c3                   	ret
+
+000000000080219d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80219d:	55                   	push   %rbp
+  80219e:	48 89 e5             	mov    %rsp,%rbp
+  8021a1:	41 57                	push   %r15
+  8021a3:	41 56                	push   %r14
+  8021a5:	41 55                	push   %r13
+  8021a7:	41 54                	push   %r12
+  8021a9:	53                   	push   %rbx
+  8021aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8021ae:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8021b1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8021b5:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  8021bc:	00 00 00 
+  8021bf:	ff d0                	call   *%rax
+  8021c1:	89 c3                	mov    %eax,%ebx
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	0f 88 b8 00 00 00    	js     802283 <dup+0xe6>
+    close(newfdnum);
+  8021cb:	44 89 e7             	mov    %r12d,%edi
+  8021ce:	48 b8 42 21 80 00 00 	movabs $0x802142,%rax
+  8021d5:	00 00 00 
+  8021d8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8021da:	4d 63 ec             	movslq %r12d,%r13
+  8021dd:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8021e4:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8021e8:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8021ec:	4c 89 ff             	mov    %r15,%rdi
+  8021ef:	49 be 61 1f 80 00 00 	movabs $0x801f61,%r14
+  8021f6:	00 00 00 
+  8021f9:	41 ff d6             	call   *%r14
+  8021fc:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8021ff:	4c 89 ef             	mov    %r13,%rdi
+  802202:	41 ff d6             	call   *%r14
+  802205:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802208:	48 89 df             	mov    %rbx,%rdi
+  80220b:	48 b8 f9 3f 80 00 00 	movabs $0x803ff9,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802217:	a8 04                	test   $0x4,%al
+  802219:	74 2b                	je     802246 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80221b:	41 89 c1             	mov    %eax,%r9d
+  80221e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802224:	4c 89 f1             	mov    %r14,%rcx
+  802227:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222c:	48 89 de             	mov    %rbx,%rsi
+  80222f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802234:	48 b8 26 14 80 00 00 	movabs $0x801426,%rax
+  80223b:	00 00 00 
+  80223e:	ff d0                	call   *%rax
+  802240:	89 c3                	mov    %eax,%ebx
+  802242:	85 c0                	test   %eax,%eax
+  802244:	78 4e                	js     802294 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802246:	4c 89 ff             	mov    %r15,%rdi
+  802249:	48 b8 f9 3f 80 00 00 	movabs $0x803ff9,%rax
+  802250:	00 00 00 
+  802253:	ff d0                	call   *%rax
+  802255:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802258:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80225e:	4c 89 e9             	mov    %r13,%rcx
+  802261:	ba 00 00 00 00       	mov    $0x0,%edx
+  802266:	4c 89 fe             	mov    %r15,%rsi
+  802269:	bf 00 00 00 00       	mov    $0x0,%edi
+  80226e:	48 b8 26 14 80 00 00 	movabs $0x801426,%rax
+  802275:	00 00 00 
+  802278:	ff d0                	call   *%rax
+  80227a:	89 c3                	mov    %eax,%ebx
+  80227c:	85 c0                	test   %eax,%eax
+  80227e:	78 14                	js     802294 <dup+0xf7>
+
+    return newfdnum;
+  802280:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802283:	89 d8                	mov    %ebx,%eax
+  802285:	48 83 c4 18          	add    $0x18,%rsp
+  802289:	5b                   	pop    %rbx
+  80228a:	41 5c                	pop    %r12
+  80228c:	41 5d                	pop    %r13
+  80228e:	41 5e                	pop    %r14
+  802290:	41 5f                	pop    %r15
+  802292:	5d                   	pop    %rbp
+  802293:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802294:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802299:	4c 89 ee             	mov    %r13,%rsi
+  80229c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a1:	49 bc 9e 15 80 00 00 	movabs $0x80159e,%r12
+  8022a8:	00 00 00 
+  8022ab:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8022ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022b3:	4c 89 f6             	mov    %r14,%rsi
+  8022b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022bb:	41 ff d4             	call   *%r12
+    return res;
+  8022be:	eb c3                	jmp    802283 <dup+0xe6>
+
+00000000008022c0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8022c0:	55                   	push   %rbp
+  8022c1:	48 89 e5             	mov    %rsp,%rbp
+  8022c4:	41 56                	push   %r14
+  8022c6:	41 55                	push   %r13
+  8022c8:	41 54                	push   %r12
+  8022ca:	53                   	push   %rbx
+  8022cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8022cf:	89 fb                	mov    %edi,%ebx
+  8022d1:	49 89 f4             	mov    %rsi,%r12
+  8022d4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022d7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022db:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  8022e2:	00 00 00 
+  8022e5:	ff d0                	call   *%rax
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	78 4c                	js     802337 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022eb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8022ef:	41 8b 3e             	mov    (%r14),%edi
+  8022f2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022f6:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  8022fd:	00 00 00 
+  802300:	ff d0                	call   *%rax
+  802302:	85 c0                	test   %eax,%eax
+  802304:	78 35                	js     80233b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802306:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80230a:	83 e0 03             	and    $0x3,%eax
+  80230d:	83 f8 01             	cmp    $0x1,%eax
+  802310:	74 2d                	je     80233f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802312:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802316:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80231a:	48 85 c0             	test   %rax,%rax
+  80231d:	74 56                	je     802375 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80231f:	4c 89 ea             	mov    %r13,%rdx
+  802322:	4c 89 e6             	mov    %r12,%rsi
+  802325:	4c 89 f7             	mov    %r14,%rdi
+  802328:	ff d0                	call   *%rax
+}
+  80232a:	48 83 c4 10          	add    $0x10,%rsp
+  80232e:	5b                   	pop    %rbx
+  80232f:	41 5c                	pop    %r12
+  802331:	41 5d                	pop    %r13
+  802333:	41 5e                	pop    %r14
+  802335:	5d                   	pop    %rbp
+  802336:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802337:	48 98                	cltq
+  802339:	eb ef                	jmp    80232a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80233b:	48 98                	cltq
+  80233d:	eb eb                	jmp    80232a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80233f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802346:	00 00 00 
+  802349:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80234f:	89 da                	mov    %ebx,%edx
+  802351:	48 bf 49 56 80 00 00 	movabs $0x805649,%rdi
+  802358:	00 00 00 
+  80235b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802360:	48 b9 e7 02 80 00 00 	movabs $0x8002e7,%rcx
+  802367:	00 00 00 
+  80236a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80236c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802373:	eb b5                	jmp    80232a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802375:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80237c:	eb ac                	jmp    80232a <read+0x6a>
+
+000000000080237e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80237e:	55                   	push   %rbp
+  80237f:	48 89 e5             	mov    %rsp,%rbp
+  802382:	41 57                	push   %r15
+  802384:	41 56                	push   %r14
+  802386:	41 55                	push   %r13
+  802388:	41 54                	push   %r12
+  80238a:	53                   	push   %rbx
+  80238b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80238f:	48 85 d2             	test   %rdx,%rdx
+  802392:	74 54                	je     8023e8 <readn+0x6a>
+  802394:	41 89 fd             	mov    %edi,%r13d
+  802397:	49 89 f6             	mov    %rsi,%r14
+  80239a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80239d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8023a2:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8023a7:	49 bf c0 22 80 00 00 	movabs $0x8022c0,%r15
+  8023ae:	00 00 00 
+  8023b1:	4c 89 e2             	mov    %r12,%rdx
+  8023b4:	48 29 f2             	sub    %rsi,%rdx
+  8023b7:	4c 01 f6             	add    %r14,%rsi
+  8023ba:	44 89 ef             	mov    %r13d,%edi
+  8023bd:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8023c0:	85 c0                	test   %eax,%eax
+  8023c2:	78 20                	js     8023e4 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8023c4:	01 c3                	add    %eax,%ebx
+  8023c6:	85 c0                	test   %eax,%eax
+  8023c8:	74 08                	je     8023d2 <readn+0x54>
+  8023ca:	48 63 f3             	movslq %ebx,%rsi
+  8023cd:	4c 39 e6             	cmp    %r12,%rsi
+  8023d0:	72 df                	jb     8023b1 <readn+0x33>
+    }
+    return res;
+  8023d2:	48 63 c3             	movslq %ebx,%rax
+}
+  8023d5:	48 83 c4 08          	add    $0x8,%rsp
+  8023d9:	5b                   	pop    %rbx
+  8023da:	41 5c                	pop    %r12
+  8023dc:	41 5d                	pop    %r13
+  8023de:	41 5e                	pop    %r14
+  8023e0:	41 5f                	pop    %r15
+  8023e2:	5d                   	pop    %rbp
+  8023e3:	c3                   	ret
+        if (inc < 0) return inc;
+  8023e4:	48 98                	cltq
+  8023e6:	eb ed                	jmp    8023d5 <readn+0x57>
+    int inc = 1, res = 0;
+  8023e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023ed:	eb e3                	jmp    8023d2 <readn+0x54>
+
+00000000008023ef <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8023ef:	55                   	push   %rbp
+  8023f0:	48 89 e5             	mov    %rsp,%rbp
+  8023f3:	41 56                	push   %r14
+  8023f5:	41 55                	push   %r13
+  8023f7:	41 54                	push   %r12
+  8023f9:	53                   	push   %rbx
+  8023fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8023fe:	89 fb                	mov    %edi,%ebx
+  802400:	49 89 f4             	mov    %rsi,%r12
+  802403:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802406:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80240a:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  802411:	00 00 00 
+  802414:	ff d0                	call   *%rax
+  802416:	85 c0                	test   %eax,%eax
+  802418:	78 47                	js     802461 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80241a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80241e:	41 8b 3e             	mov    (%r14),%edi
+  802421:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802425:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  80242c:	00 00 00 
+  80242f:	ff d0                	call   *%rax
+  802431:	85 c0                	test   %eax,%eax
+  802433:	78 30                	js     802465 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802435:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80243a:	74 2d                	je     802469 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80243c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802440:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802444:	48 85 c0             	test   %rax,%rax
+  802447:	74 56                	je     80249f <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802449:	4c 89 ea             	mov    %r13,%rdx
+  80244c:	4c 89 e6             	mov    %r12,%rsi
+  80244f:	4c 89 f7             	mov    %r14,%rdi
+  802452:	ff d0                	call   *%rax
+}
+  802454:	48 83 c4 10          	add    $0x10,%rsp
+  802458:	5b                   	pop    %rbx
+  802459:	41 5c                	pop    %r12
+  80245b:	41 5d                	pop    %r13
+  80245d:	41 5e                	pop    %r14
+  80245f:	5d                   	pop    %rbp
+  802460:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802461:	48 98                	cltq
+  802463:	eb ef                	jmp    802454 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802465:	48 98                	cltq
+  802467:	eb eb                	jmp    802454 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802469:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802470:	00 00 00 
+  802473:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802479:	89 da                	mov    %ebx,%edx
+  80247b:	48 bf 65 56 80 00 00 	movabs $0x805665,%rdi
+  802482:	00 00 00 
+  802485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80248a:	48 b9 e7 02 80 00 00 	movabs $0x8002e7,%rcx
+  802491:	00 00 00 
+  802494:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802496:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80249d:	eb b5                	jmp    802454 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80249f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8024a6:	eb ac                	jmp    802454 <write+0x65>
+
+00000000008024a8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8024a8:	55                   	push   %rbp
+  8024a9:	48 89 e5             	mov    %rsp,%rbp
+  8024ac:	53                   	push   %rbx
+  8024ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8024b1:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024b3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024b7:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  8024be:	00 00 00 
+  8024c1:	ff d0                	call   *%rax
+  8024c3:	85 c0                	test   %eax,%eax
+  8024c5:	78 0c                	js     8024d3 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8024c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024cb:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8024ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024d7:	c9                   	leave
+  8024d8:	c3                   	ret
+
+00000000008024d9 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8024d9:	55                   	push   %rbp
+  8024da:	48 89 e5             	mov    %rsp,%rbp
+  8024dd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8024e1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024e5:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  8024ec:	00 00 00 
+  8024ef:	ff d0                	call   *%rax
+  8024f1:	85 c0                	test   %eax,%eax
+  8024f3:	78 07                	js     8024fc <tell+0x23>
+    return fdes->fd_offset;
+  8024f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024f9:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8024fc:	c9                   	leave
+  8024fd:	c3                   	ret
+
+00000000008024fe <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8024fe:	55                   	push   %rbp
+  8024ff:	48 89 e5             	mov    %rsp,%rbp
+  802502:	41 55                	push   %r13
+  802504:	41 54                	push   %r12
+  802506:	53                   	push   %rbx
+  802507:	48 83 ec 18          	sub    $0x18,%rsp
+  80250b:	89 fb                	mov    %edi,%ebx
+  80250d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802510:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802514:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  80251b:	00 00 00 
+  80251e:	ff d0                	call   *%rax
+  802520:	85 c0                	test   %eax,%eax
+  802522:	78 38                	js     80255c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802524:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802528:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80252c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802530:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	78 1c                	js     80255c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802540:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802545:	74 20                	je     802567 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802547:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80254b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80254f:	48 85 c0             	test   %rax,%rax
+  802552:	74 47                	je     80259b <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802554:	44 89 e6             	mov    %r12d,%esi
+  802557:	4c 89 ef             	mov    %r13,%rdi
+  80255a:	ff d0                	call   *%rax
+}
+  80255c:	48 83 c4 18          	add    $0x18,%rsp
+  802560:	5b                   	pop    %rbx
+  802561:	41 5c                	pop    %r12
+  802563:	41 5d                	pop    %r13
+  802565:	5d                   	pop    %rbp
+  802566:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802567:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80256e:	00 00 00 
+  802571:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802577:	89 da                	mov    %ebx,%edx
+  802579:	48 bf 28 56 80 00 00 	movabs $0x805628,%rdi
+  802580:	00 00 00 
+  802583:	b8 00 00 00 00       	mov    $0x0,%eax
+  802588:	48 b9 e7 02 80 00 00 	movabs $0x8002e7,%rcx
+  80258f:	00 00 00 
+  802592:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802594:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802599:	eb c1                	jmp    80255c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80259b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025a0:	eb ba                	jmp    80255c <ftruncate+0x5e>
+
+00000000008025a2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8025a2:	55                   	push   %rbp
+  8025a3:	48 89 e5             	mov    %rsp,%rbp
+  8025a6:	41 54                	push   %r12
+  8025a8:	53                   	push   %rbx
+  8025a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ad:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025b0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025b4:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  8025bb:	00 00 00 
+  8025be:	ff d0                	call   *%rax
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	78 4e                	js     802612 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025c4:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8025c8:	41 8b 3c 24          	mov    (%r12),%edi
+  8025cc:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8025d0:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  8025d7:	00 00 00 
+  8025da:	ff d0                	call   *%rax
+  8025dc:	85 c0                	test   %eax,%eax
+  8025de:	78 32                	js     802612 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8025e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8025e4:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8025e9:	74 30                	je     80261b <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8025eb:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8025ee:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8025f5:	00 00 00 
+    stat->st_isdir = 0;
+  8025f8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8025ff:	00 00 00 
+    stat->st_dev = dev;
+  802602:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802609:	48 89 de             	mov    %rbx,%rsi
+  80260c:	4c 89 e7             	mov    %r12,%rdi
+  80260f:	ff 50 28             	call   *0x28(%rax)
+}
+  802612:	48 83 c4 10          	add    $0x10,%rsp
+  802616:	5b                   	pop    %rbx
+  802617:	41 5c                	pop    %r12
+  802619:	5d                   	pop    %rbp
+  80261a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80261b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802620:	eb f0                	jmp    802612 <fstat+0x70>
+
+0000000000802622 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802622:	55                   	push   %rbp
+  802623:	48 89 e5             	mov    %rsp,%rbp
+  802626:	41 54                	push   %r12
+  802628:	53                   	push   %rbx
+  802629:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802630:	41 89 fc             	mov    %edi,%r12d
+  802633:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802635:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802639:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  802640:	00 00 00 
+  802643:	ff d0                	call   *%rax
+  802645:	85 c0                	test   %eax,%eax
+  802647:	78 31                	js     80267a <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802649:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802650:	44 89 e7             	mov    %r12d,%edi
+  802653:	48 b8 a2 25 80 00 00 	movabs $0x8025a2,%rax
+  80265a:	00 00 00 
+  80265d:	ff d0                	call   *%rax
+  80265f:	85 c0                	test   %eax,%eax
+  802661:	78 17                	js     80267a <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802663:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802667:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  80266a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80266d:	39 d3                	cmp    %edx,%ebx
+  80266f:	0f 4f da             	cmovg  %edx,%ebx
+  802672:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802675:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80267a:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802681:	5b                   	pop    %rbx
+  802682:	41 5c                	pop    %r12
+  802684:	5d                   	pop    %rbp
+  802685:	c3                   	ret
+
+0000000000802686 <seektoend>:
+{
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+  80268a:	53                   	push   %rbx
+  80268b:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802692:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802694:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802698:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  80269f:	00 00 00 
+  8026a2:	ff d0                	call   *%rax
+  8026a4:	85 c0                	test   %eax,%eax
+  8026a6:	78 28                	js     8026d0 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8026a8:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8026af:	89 df                	mov    %ebx,%edi
+  8026b1:	48 b8 a2 25 80 00 00 	movabs $0x8025a2,%rax
+  8026b8:	00 00 00 
+  8026bb:	ff d0                	call   *%rax
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	78 0f                	js     8026d0 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8026c1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8026c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026c8:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8026cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026d4:	c9                   	leave
+  8026d5:	c3                   	ret
+
+00000000008026d6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8026d6:	55                   	push   %rbp
+  8026d7:	48 89 e5             	mov    %rsp,%rbp
+  8026da:	41 54                	push   %r12
+  8026dc:	53                   	push   %rbx
+  8026dd:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8026e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e5:	48 b8 c9 32 80 00 00 	movabs $0x8032c9,%rax
+  8026ec:	00 00 00 
+  8026ef:	ff d0                	call   *%rax
+  8026f1:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8026f3:	85 c0                	test   %eax,%eax
+  8026f5:	78 25                	js     80271c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8026f7:	4c 89 e6             	mov    %r12,%rsi
+  8026fa:	89 c7                	mov    %eax,%edi
+  8026fc:	48 b8 a2 25 80 00 00 	movabs $0x8025a2,%rax
+  802703:	00 00 00 
+  802706:	ff d0                	call   *%rax
+  802708:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80270b:	89 df                	mov    %ebx,%edi
+  80270d:	48 b8 42 21 80 00 00 	movabs $0x802142,%rax
+  802714:	00 00 00 
+  802717:	ff d0                	call   *%rax
+
+    return res;
+  802719:	44 89 e3             	mov    %r12d,%ebx
+}
+  80271c:	89 d8                	mov    %ebx,%eax
+  80271e:	5b                   	pop    %rbx
+  80271f:	41 5c                	pop    %r12
+  802721:	5d                   	pop    %rbp
+  802722:	c3                   	ret
+
+0000000000802723 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802723:	55                   	push   %rbp
+  802724:	48 89 e5             	mov    %rsp,%rbp
+  802727:	53                   	push   %rbx
+  802728:	48 83 ec 08          	sub    $0x8,%rsp
+  80272c:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80272f:	48 b8 4f 1f 80 00 00 	movabs $0x801f4f,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+  80273b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80273f:	0f 87 ea 00 00 00    	ja     80282f <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802745:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80274c:	00 00 00 
+  80274f:	80 38 00             	cmpb   $0x0,(%rax)
+  802752:	75 35                	jne    802789 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802754:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802759:	ba 00 00 22 00       	mov    $0x220000,%edx
+  80275e:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802763:	bf 00 00 00 00       	mov    $0x0,%edi
+  802768:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  80276f:	00 00 00 
+  802772:	ff d0                	call   *%rax
+  802774:	85 c0                	test   %eax,%eax
+  802776:	0f 88 ba 00 00 00    	js     802836 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80277c:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802783:	00 00 00 
+  802786:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802789:	48 89 df             	mov    %rbx,%rdi
+  80278c:	48 b8 4f 1f 80 00 00 	movabs $0x801f4f,%rax
+  802793:	00 00 00 
+  802796:	ff d0                	call   *%rax
+  802798:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  80279c:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8027a3:	00 00 00 
+  8027a6:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8027aa:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8027ad:	39 39                	cmp    %edi,(%rcx)
+  8027af:	74 46                	je     8027f7 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8027b1:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8027b5:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8027bc:	00 
+  8027bd:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8027c4:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8027cb:	00 
+  8027cc:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8027d3:	00 
+  8027d4:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8027db:	00 
+  8027dc:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8027e3:	00 
+  8027e4:	89 39                	mov    %edi,(%rcx)
+  8027e6:	48 01 c6             	add    %rax,%rsi
+  8027e9:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8027ee:	48 89 c8             	mov    %rcx,%rax
+  8027f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027f5:	c9                   	leave
+  8027f6:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  8027f7:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8027fb:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802802:	00 00 00 
+  802805:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802808:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80280c:	74 e0                	je     8027ee <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80280e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802815:	00 
+  802816:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80281a:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802821:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802823:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802826:	48 01 c2             	add    %rax,%rdx
+  802829:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80282d:	eb bf                	jmp    8027ee <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80282f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802834:	eb b8                	jmp    8027ee <fbuf_get+0xcb>
+            return NULL;
+  802836:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80283b:	eb b1                	jmp    8027ee <fbuf_get+0xcb>
+
+000000000080283d <fsipc_bulk>:
+fsipc_bulk(void) {
+  80283d:	55                   	push   %rbp
+  80283e:	48 89 e5             	mov    %rsp,%rbp
+  802841:	53                   	push   %rbx
+  802842:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802846:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  80284d:	00 00 00 
+  802850:	48 8b 18             	mov    (%rax),%rbx
+  802853:	48 85 db             	test   %rbx,%rbx
+  802856:	74 16                	je     80286e <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802858:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  80285f:	00 00 00 
+  802862:	48 8b 18             	mov    (%rax),%rbx
+}
+  802865:	48 89 d8             	mov    %rbx,%rax
+  802868:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80286c:	c9                   	leave
+  80286d:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  80286e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802873:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802878:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  80287d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802882:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  802889:	00 00 00 
+  80288c:	ff d0                	call   *%rax
+  80288e:	85 c0                	test   %eax,%eax
+  802890:	78 d3                	js     802865 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802892:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802897:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  80289e:	00 00 00 
+  8028a1:	eb b5                	jmp    802858 <fsipc_bulk+0x1b>
+
+00000000008028a3 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8028a3:	55                   	push   %rbp
+  8028a4:	48 89 e5             	mov    %rsp,%rbp
+  8028a7:	41 57                	push   %r15
+  8028a9:	41 56                	push   %r14
+  8028ab:	41 55                	push   %r13
+  8028ad:	41 54                	push   %r12
+  8028af:	53                   	push   %rbx
+  8028b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b4:	41 89 fd             	mov    %edi,%r13d
+  8028b7:	49 89 f6             	mov    %rsi,%r14
+  8028ba:	49 89 d7             	mov    %rdx,%r15
+  8028bd:	48 89 cb             	mov    %rcx,%rbx
+  8028c0:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028c3:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8028ca:	00 00 00 
+  8028cd:	83 38 00             	cmpl   $0x0,(%rax)
+  8028d0:	74 52                	je     802924 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  8028d2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8028d8:	4c 89 f9             	mov    %r15,%rcx
+  8028db:	4c 89 f2             	mov    %r14,%rdx
+  8028de:	44 89 ee             	mov    %r13d,%esi
+  8028e1:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8028e8:	00 00 00 
+  8028eb:	8b 38                	mov    (%rax),%edi
+  8028ed:	48 b8 f3 45 80 00 00 	movabs $0x8045f3,%rax
+  8028f4:	00 00 00 
+  8028f7:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  8028f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028fe:	4c 89 e2             	mov    %r12,%rdx
+  802901:	48 89 de             	mov    %rbx,%rsi
+  802904:	bf 00 00 00 00       	mov    $0x0,%edi
+  802909:	48 b8 43 44 80 00 00 	movabs $0x804443,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+}
+  802915:	48 83 c4 08          	add    $0x8,%rsp
+  802919:	5b                   	pop    %rbx
+  80291a:	41 5c                	pop    %r12
+  80291c:	41 5d                	pop    %r13
+  80291e:	41 5e                	pop    %r14
+  802920:	41 5f                	pop    %r15
+  802922:	5d                   	pop    %rbp
+  802923:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802924:	bf 03 00 00 00       	mov    $0x3,%edi
+  802929:	48 b8 96 46 80 00 00 	movabs $0x804696,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+  802935:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80293c:	00 00 
+  80293e:	eb 92                	jmp    8028d2 <fsipc_region+0x2f>
+
+0000000000802940 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802940:	55                   	push   %rbp
+  802941:	48 89 e5             	mov    %rsp,%rbp
+  802944:	41 57                	push   %r15
+  802946:	41 56                	push   %r14
+  802948:	41 55                	push   %r13
+  80294a:	41 54                	push   %r12
+  80294c:	53                   	push   %rbx
+  80294d:	48 83 ec 28          	sub    $0x28,%rsp
+  802951:	49 89 ff             	mov    %rdi,%r15
+  802954:	49 89 f6             	mov    %rsi,%r14
+  802957:	48 89 d3             	mov    %rdx,%rbx
+  80295a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80295e:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802961:	48 b8 3d 28 80 00 00 	movabs $0x80283d,%rax
+  802968:	00 00 00 
+  80296b:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  80296d:	48 85 c0             	test   %rax,%rax
+  802970:	0f 84 cc 00 00 00    	je     802a42 <devfile_write_direct+0x102>
+  802976:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802979:	48 85 db             	test   %rbx,%rbx
+  80297c:	0f 84 ba 00 00 00    	je     802a3c <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802982:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802988:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80298f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802993:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802997:	4c 29 e3             	sub    %r12,%rbx
+  80299a:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80299f:	48 39 c3             	cmp    %rax,%rbx
+  8029a2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8029a6:	48 89 da             	mov    %rbx,%rdx
+  8029a9:	4c 89 f6             	mov    %r14,%rsi
+  8029ac:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8029b0:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  8029b7:	00 00 00 
+  8029ba:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8029bc:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8029c0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  8029c4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8029c7:	44 01 e0             	add    %r12d,%eax
+  8029ca:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  8029ce:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  8029d2:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  8029d9:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8029e0:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  8029e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029f2:	4c 89 ee             	mov    %r13,%rsi
+  8029f5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8029fa:	48 b8 a3 28 80 00 00 	movabs $0x8028a3,%rax
+  802a01:	00 00 00 
+  802a04:	ff d0                	call   *%rax
+        if (res < 0)
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	78 29                	js     802a33 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802a0a:	74 2b                	je     802a37 <devfile_write_direct+0xf7>
+        i += res;
+  802a0c:	48 98                	cltq
+  802a0e:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802a11:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802a14:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a18:	49 39 c4             	cmp    %rax,%r12
+  802a1b:	0f 82 72 ff ff ff    	jb     802993 <devfile_write_direct+0x53>
+    return i;
+  802a21:	4c 89 e0             	mov    %r12,%rax
+}
+  802a24:	48 83 c4 28          	add    $0x28,%rsp
+  802a28:	5b                   	pop    %rbx
+  802a29:	41 5c                	pop    %r12
+  802a2b:	41 5d                	pop    %r13
+  802a2d:	41 5e                	pop    %r14
+  802a2f:	41 5f                	pop    %r15
+  802a31:	5d                   	pop    %rbp
+  802a32:	c3                   	ret
+            return res;
+  802a33:	48 98                	cltq
+  802a35:	eb ed                	jmp    802a24 <devfile_write_direct+0xe4>
+            return i;
+  802a37:	4c 89 e0             	mov    %r12,%rax
+  802a3a:	eb e8                	jmp    802a24 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802a3c:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802a40:	eb df                	jmp    802a21 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802a42:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802a49:	eb d9                	jmp    802a24 <devfile_write_direct+0xe4>
+
+0000000000802a4b <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802a4b:	55                   	push   %rbp
+  802a4c:	48 89 e5             	mov    %rsp,%rbp
+  802a4f:	41 56                	push   %r14
+  802a51:	41 55                	push   %r13
+  802a53:	41 54                	push   %r12
+  802a55:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802a56:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802a5a:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802a5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a63:	4d 39 ee             	cmp    %r13,%r14
+  802a66:	0f 84 99 00 00 00    	je     802b05 <fbuf_flush+0xba>
+  802a6c:	49 89 fc             	mov    %rdi,%r12
+  802a6f:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802a72:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802a75:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802a79:	48 b8 4f 1f 80 00 00 	movabs $0x801f4f,%rax
+  802a80:	00 00 00 
+  802a83:	ff d0                	call   *%rax
+  802a85:	48 89 c2             	mov    %rax,%rdx
+  802a88:	48 c1 e2 04          	shl    $0x4,%rdx
+  802a8c:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802a90:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a94:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802a99:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802a9c:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802aa0:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802aa7:	00 
+  802aa8:	44 89 f1             	mov    %r14d,%ecx
+  802aab:	4c 89 ea             	mov    %r13,%rdx
+  802aae:	4c 89 e7             	mov    %r12,%rdi
+  802ab1:	48 b8 40 29 80 00 00 	movabs $0x802940,%rax
+  802ab8:	00 00 00 
+  802abb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802abd:	48 85 c0             	test   %rax,%rax
+  802ac0:	78 43                	js     802b05 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802ac2:	4c 39 e8             	cmp    %r13,%rax
+  802ac5:	72 47                	jb     802b0e <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802ac7:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802acc:	83 c0 01             	add    $0x1,%eax
+  802acf:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ad4:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802ad7:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802adb:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802adf:	72 0f                	jb     802af0 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802ae1:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802ae5:	48 39 c2             	cmp    %rax,%rdx
+  802ae8:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802aec:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802af0:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802af7:	00 
+  802af8:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802aff:	00 
+    return 0;
+  802b00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b05:	5b                   	pop    %rbx
+  802b06:	41 5c                	pop    %r12
+  802b08:	41 5d                	pop    %r13
+  802b0a:	41 5e                	pop    %r14
+  802b0c:	5d                   	pop    %rbp
+  802b0d:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802b0e:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802b13:	eb f0                	jmp    802b05 <fbuf_flush+0xba>
+
+0000000000802b15 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802b15:	55                   	push   %rbp
+  802b16:	48 89 e5             	mov    %rsp,%rbp
+  802b19:	53                   	push   %rbx
+  802b1a:	48 83 ec 08          	sub    $0x8,%rsp
+  802b1e:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802b21:	48 b8 23 27 80 00 00 	movabs $0x802723,%rax
+  802b28:	00 00 00 
+  802b2b:	ff d0                	call   *%rax
+  802b2d:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b35:	48 85 f6             	test   %rsi,%rsi
+  802b38:	74 0f                	je     802b49 <devfile_sync+0x34>
+  802b3a:	48 89 df             	mov    %rbx,%rdi
+  802b3d:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  802b44:	00 00 00 
+  802b47:	ff d0                	call   *%rax
+}
+  802b49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b4d:	c9                   	leave
+  802b4e:	c3                   	ret
+
+0000000000802b4f <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802b4f:	55                   	push   %rbp
+  802b50:	48 89 e5             	mov    %rsp,%rbp
+  802b53:	48 83 ec 10          	sub    $0x10,%rsp
+  802b57:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802b5a:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802b61:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802b62:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802b66:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b6b:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802b72:	00 00 00 
+  802b75:	48 b8 a3 28 80 00 00 	movabs $0x8028a3,%rax
+  802b7c:	00 00 00 
+  802b7f:	ff d0                	call   *%rax
+}
+  802b81:	c9                   	leave
+  802b82:	c3                   	ret
+
+0000000000802b83 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802b83:	55                   	push   %rbp
+  802b84:	48 89 e5             	mov    %rsp,%rbp
+  802b87:	41 54                	push   %r12
+  802b89:	53                   	push   %rbx
+  802b8a:	48 89 fb             	mov    %rdi,%rbx
+  802b8d:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802b90:	48 b8 15 2b 80 00 00 	movabs $0x802b15,%rax
+  802b97:	00 00 00 
+  802b9a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b9c:	85 c0                	test   %eax,%eax
+  802b9e:	78 63                	js     802c03 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ba0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ba3:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802baa:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802bac:	be 00 00 00 00       	mov    $0x0,%esi
+  802bb1:	bf 05 00 00 00       	mov    $0x5,%edi
+  802bb6:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  802bbd:	00 00 00 
+  802bc0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bc2:	85 c0                	test   %eax,%eax
+  802bc4:	78 3d                	js     802c03 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802bc6:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802bcd:	00 00 00 
+  802bd0:	48 89 de             	mov    %rbx,%rsi
+  802bd3:	4c 89 e7             	mov    %r12,%rdi
+  802bd6:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  802bdd:	00 00 00 
+  802be0:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802be2:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802be8:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802bef:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802bf0:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802bf6:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802bfd:	00 
+
+    return 0;
+  802bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c03:	5b                   	pop    %rbx
+  802c04:	41 5c                	pop    %r12
+  802c06:	5d                   	pop    %rbp
+  802c07:	c3                   	ret
+
+0000000000802c08 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802c08:	55                   	push   %rbp
+  802c09:	48 89 e5             	mov    %rsp,%rbp
+  802c0c:	41 54                	push   %r12
+  802c0e:	53                   	push   %rbx
+  802c0f:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802c12:	48 b8 15 2b 80 00 00 	movabs $0x802b15,%rax
+  802c19:	00 00 00 
+  802c1c:	ff d0                	call   *%rax
+  802c1e:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802c21:	48 89 df             	mov    %rbx,%rdi
+  802c24:	48 b8 4f 1f 80 00 00 	movabs $0x801f4f,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+  802c30:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802c34:	76 2e                	jbe    802c64 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802c36:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c39:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802c40:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802c42:	be 00 00 00 00       	mov    $0x0,%esi
+  802c47:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802c4c:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  802c53:	00 00 00 
+  802c56:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802c58:	45 85 e4             	test   %r12d,%r12d
+  802c5b:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802c5f:	5b                   	pop    %rbx
+  802c60:	41 5c                	pop    %r12
+  802c62:	5d                   	pop    %rbp
+  802c63:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802c64:	48 89 df             	mov    %rbx,%rdi
+  802c67:	48 b8 4f 1f 80 00 00 	movabs $0x801f4f,%rax
+  802c6e:	00 00 00 
+  802c71:	ff d0                	call   *%rax
+  802c73:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802c77:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802c7e:	00 00 00 
+  802c81:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802c88:	48 89 df             	mov    %rbx,%rdi
+  802c8b:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  802c92:	00 00 00 
+  802c95:	ff d0                	call   *%rax
+  802c97:	48 89 c6             	mov    %rax,%rsi
+  802c9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ca4:	48 b8 9e 15 80 00 00 	movabs $0x80159e,%rax
+  802cab:	00 00 00 
+  802cae:	ff d0                	call   *%rax
+  802cb0:	eb 84                	jmp    802c36 <devfile_flush+0x2e>
+
+0000000000802cb2 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802cb2:	55                   	push   %rbp
+  802cb3:	48 89 e5             	mov    %rsp,%rbp
+  802cb6:	41 55                	push   %r13
+  802cb8:	41 54                	push   %r12
+  802cba:	53                   	push   %rbx
+  802cbb:	48 83 ec 08          	sub    $0x8,%rsp
+  802cbf:	48 89 fb             	mov    %rdi,%rbx
+  802cc2:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802cc5:	48 b8 23 27 80 00 00 	movabs $0x802723,%rax
+  802ccc:	00 00 00 
+  802ccf:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802cd1:	48 85 c0             	test   %rax,%rax
+  802cd4:	74 51                	je     802d27 <devfile_trunc+0x75>
+  802cd6:	49 89 c4             	mov    %rax,%r12
+  802cd9:	48 89 c6             	mov    %rax,%rsi
+  802cdc:	48 89 df             	mov    %rbx,%rdi
+  802cdf:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  802ce6:	00 00 00 
+  802ce9:	ff d0                	call   *%rax
+  802ceb:	85 c0                	test   %eax,%eax
+  802ced:	78 2d                	js     802d1c <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802cef:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802cf6:	00 00 00 
+  802cf9:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802cfc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802cfe:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802d02:	be 00 00 00 00       	mov    $0x0,%esi
+  802d07:	bf 02 00 00 00       	mov    $0x2,%edi
+  802d0c:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  802d13:	00 00 00 
+  802d16:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	79 3e                	jns    802d5a <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802d1c:	48 83 c4 08          	add    $0x8,%rsp
+  802d20:	5b                   	pop    %rbx
+  802d21:	41 5c                	pop    %r12
+  802d23:	41 5d                	pop    %r13
+  802d25:	5d                   	pop    %rbp
+  802d26:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802d27:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802d2e:	00 00 00 
+  802d31:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802d34:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802d36:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802d3a:	be 00 00 00 00       	mov    $0x0,%esi
+  802d3f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802d44:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  802d4b:	00 00 00 
+  802d4e:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802d50:	85 c0                	test   %eax,%eax
+  802d52:	78 c8                	js     802d1c <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802d54:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d58:	eb c2                	jmp    802d1c <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802d5a:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802d5d:	8d 51 01             	lea    0x1(%rcx),%edx
+  802d60:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d63:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802d68:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802d6f:	00 00 
+  802d71:	eb a9                	jmp    802d1c <devfile_trunc+0x6a>
+
+0000000000802d73 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d73:	55                   	push   %rbp
+  802d74:	48 89 e5             	mov    %rsp,%rbp
+  802d77:	41 57                	push   %r15
+  802d79:	41 56                	push   %r14
+  802d7b:	41 55                	push   %r13
+  802d7d:	41 54                	push   %r12
+  802d7f:	53                   	push   %rbx
+  802d80:	48 83 ec 28          	sub    $0x28,%rsp
+  802d84:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802d88:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d8c:	49 89 d7             	mov    %rdx,%r15
+  802d8f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802d93:	48 b8 23 27 80 00 00 	movabs $0x802723,%rax
+  802d9a:	00 00 00 
+  802d9d:	ff d0                	call   *%rax
+  802d9f:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802da2:	48 85 c0             	test   %rax,%rax
+  802da5:	74 31                	je     802dd8 <devfile_write+0x65>
+  802da7:	4c 89 f8             	mov    %r15,%rax
+  802daa:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802db1:	77 25                	ja     802dd8 <devfile_write+0x65>
+    size_t i = 0;
+  802db3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802db9:	48 85 c0             	test   %rax,%rax
+  802dbc:	0f 85 64 01 00 00    	jne    802f26 <devfile_write+0x1b3>
+    size_t i = 0;
+  802dc2:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802dc6:	4c 89 f8             	mov    %r15,%rax
+}
+  802dc9:	48 83 c4 28          	add    $0x28,%rsp
+  802dcd:	5b                   	pop    %rbx
+  802dce:	41 5c                	pop    %r12
+  802dd0:	41 5d                	pop    %r13
+  802dd2:	41 5e                	pop    %r14
+  802dd4:	41 5f                	pop    %r15
+  802dd6:	5d                   	pop    %rbp
+  802dd7:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802dd8:	48 85 db             	test   %rbx,%rbx
+  802ddb:	74 5b                	je     802e38 <devfile_write+0xc5>
+  802ddd:	48 89 de             	mov    %rbx,%rsi
+  802de0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802de4:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  802deb:	00 00 00 
+  802dee:	ff d0                	call   *%rax
+  802df0:	85 c0                	test   %eax,%eax
+  802df2:	78 40                	js     802e34 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802df4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802df8:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802dfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dff:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802e03:	48 b8 40 29 80 00 00 	movabs $0x802940,%rax
+  802e0a:	00 00 00 
+  802e0d:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802e0f:	48 85 c0             	test   %rax,%rax
+  802e12:	7e b5                	jle    802dc9 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802e14:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802e18:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802e1b:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802e1e:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802e21:	8d 51 01             	lea    0x1(%rcx),%edx
+  802e24:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e27:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802e2a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802e31:	00 
+  802e32:	eb 95                	jmp    802dc9 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e34:	48 98                	cltq
+  802e36:	eb 91                	jmp    802dc9 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802e38:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802e3c:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802e3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e43:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802e47:	48 89 df             	mov    %rbx,%rdi
+  802e4a:	48 b8 40 29 80 00 00 	movabs $0x802940,%rax
+  802e51:	00 00 00 
+  802e54:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802e56:	48 85 c0             	test   %rax,%rax
+  802e59:	0f 8e 6a ff ff ff    	jle    802dc9 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802e5f:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802e62:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e66:	e9 5e ff ff ff       	jmp    802dc9 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e6b:	48 98                	cltq
+  802e6d:	4d 85 ff             	test   %r15,%r15
+  802e70:	49 0f 45 c7          	cmovne %r15,%rax
+  802e74:	e9 50 ff ff ff       	jmp    802dc9 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e79:	48 89 de             	mov    %rbx,%rsi
+  802e7c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e80:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  802e87:	00 00 00 
+  802e8a:	ff d0                	call   *%rax
+  802e8c:	85 c0                	test   %eax,%eax
+  802e8e:	0f 88 2b 01 00 00    	js     802fbf <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802e94:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e98:	4c 01 f8             	add    %r15,%rax
+  802e9b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802e9f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802ea3:	48 b9 4f 1f 80 00 00 	movabs $0x801f4f,%rcx
+  802eaa:	00 00 00 
+  802ead:	ff d1                	call   *%rcx
+  802eaf:	48 89 c2             	mov    %rax,%rdx
+  802eb2:	48 c1 e2 04          	shl    $0x4,%rdx
+  802eb6:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802eba:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ebe:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802ec3:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802ec6:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802ecd:	00 
+  802ece:	4c 89 ea             	mov    %r13,%rdx
+  802ed1:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802ed5:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  802edc:	00 00 00 
+  802edf:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802ee1:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802ee5:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802ee9:	48 39 c2             	cmp    %rax,%rdx
+  802eec:	0f 84 db 00 00 00    	je     802fcd <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802ef2:	4c 39 e2             	cmp    %r12,%rdx
+  802ef5:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802ef9:	4d 01 ec             	add    %r13,%r12
+  802efc:	49 39 c4             	cmp    %rax,%r12
+  802eff:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802f03:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802f07:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802f0b:	45 01 ee             	add    %r13d,%r14d
+  802f0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f12:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802f16:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802f19:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f1d:	49 39 c7             	cmp    %rax,%r15
+  802f20:	0f 83 a0 fe ff ff    	jae    802dc6 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802f26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f2a:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802f2e:	8b 43 08             	mov    0x8(%rbx),%eax
+  802f31:	44 39 f0             	cmp    %r14d,%eax
+  802f34:	7f 10                	jg     802f46 <devfile_write+0x1d3>
+  802f36:	48 98                	cltq
+  802f38:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802f3e:	49 63 d6             	movslq %r14d,%rdx
+  802f41:	48 39 d0             	cmp    %rdx,%rax
+  802f44:	7d 2d                	jge    802f73 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f46:	48 89 de             	mov    %rbx,%rsi
+  802f49:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f4d:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  802f54:	00 00 00 
+  802f57:	ff d0                	call   *%rax
+  802f59:	85 c0                	test   %eax,%eax
+  802f5b:	0f 88 0a ff ff ff    	js     802e6b <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802f61:	44 89 f0             	mov    %r14d,%eax
+  802f64:	66 b8 00 00          	mov    $0x0,%ax
+  802f68:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802f6b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802f72:	00 
+        size_t off = pos - fb->fb_base;
+  802f73:	45 89 f4             	mov    %r14d,%r12d
+  802f76:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802f7a:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802f7d:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802f81:	4d 29 fd             	sub    %r15,%r13
+  802f84:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802f89:	4c 29 e0             	sub    %r12,%rax
+  802f8c:	49 39 c5             	cmp    %rax,%r13
+  802f8f:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802f93:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802f97:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802f9b:	48 39 c2             	cmp    %rax,%rdx
+  802f9e:	0f 84 f0 fe ff ff    	je     802e94 <devfile_write+0x121>
+  802fa4:	4c 39 e0             	cmp    %r12,%rax
+  802fa7:	0f 82 cc fe ff ff    	jb     802e79 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802fad:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802fb1:	48 39 d0             	cmp    %rdx,%rax
+  802fb4:	0f 83 da fe ff ff    	jae    802e94 <devfile_write+0x121>
+  802fba:	e9 ba fe ff ff       	jmp    802e79 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802fbf:	48 98                	cltq
+  802fc1:	4d 85 ff             	test   %r15,%r15
+  802fc4:	49 0f 45 c7          	cmovne %r15,%rax
+  802fc8:	e9 fc fd ff ff       	jmp    802dc9 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802fcd:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802fd1:	4c 89 e2             	mov    %r12,%rdx
+  802fd4:	e9 2a ff ff ff       	jmp    802f03 <devfile_write+0x190>
+
+0000000000802fd9 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802fd9:	55                   	push   %rbp
+  802fda:	48 89 e5             	mov    %rsp,%rbp
+  802fdd:	41 57                	push   %r15
+  802fdf:	41 56                	push   %r14
+  802fe1:	41 55                	push   %r13
+  802fe3:	41 54                	push   %r12
+  802fe5:	53                   	push   %rbx
+  802fe6:	48 83 ec 28          	sub    $0x28,%rsp
+  802fea:	49 89 ff             	mov    %rdi,%r15
+  802fed:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802ff1:	48 89 d3             	mov    %rdx,%rbx
+  802ff4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802ff8:	48 b8 23 27 80 00 00 	movabs $0x802723,%rax
+  802fff:	00 00 00 
+  803002:	ff d0                	call   *%rax
+  803004:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803007:	48 85 c0             	test   %rax,%rax
+  80300a:	74 0d                	je     803019 <devfile_read+0x40>
+  80300c:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803013:	0f 86 1a 01 00 00    	jbe    803133 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803019:	4d 85 e4             	test   %r12,%r12
+  80301c:	74 1a                	je     803038 <devfile_read+0x5f>
+  80301e:	4c 89 e6             	mov    %r12,%rsi
+  803021:	4c 89 ff             	mov    %r15,%rdi
+  803024:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  80302b:	00 00 00 
+  80302e:	ff d0                	call   *%rax
+  803030:	85 c0                	test   %eax,%eax
+  803032:	0f 88 e8 00 00 00    	js     803120 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803038:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  80303c:	48 b8 3d 28 80 00 00 	movabs $0x80283d,%rax
+  803043:	00 00 00 
+  803046:	ff d0                	call   *%rax
+  803048:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  80304b:	48 85 c0             	test   %rax,%rax
+  80304e:	0f 84 69 02 00 00    	je     8032bd <devfile_read+0x2e4>
+    while (i < n) {
+  803054:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803059:	0f 84 ce 00 00 00    	je     80312d <devfile_read+0x154>
+    size_t i = 0;
+  80305f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803064:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80306b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80306f:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803073:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803077:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80307b:	48 29 da             	sub    %rbx,%rdx
+  80307e:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803083:	48 39 c2             	cmp    %rax,%rdx
+  803086:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  80308a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80308e:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803092:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803095:	01 d8                	add    %ebx,%eax
+  803097:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  80309b:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  80309f:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  8030a6:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8030ad:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8030b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030bf:	4c 89 ee             	mov    %r13,%rsi
+  8030c2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8030c7:	48 b8 a3 28 80 00 00 	movabs $0x8028a3,%rax
+  8030ce:	00 00 00 
+  8030d1:	ff d0                	call   *%rax
+        if (res < 0)
+  8030d3:	85 c0                	test   %eax,%eax
+  8030d5:	78 4d                	js     803124 <devfile_read+0x14b>
+        if (res == 0)
+  8030d7:	74 4f                	je     803128 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8030d9:	4c 63 e0             	movslq %eax,%r12
+  8030dc:	4c 89 e2             	mov    %r12,%rdx
+  8030df:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8030e3:	4c 89 f7             	mov    %r14,%rdi
+  8030e6:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  8030ed:	00 00 00 
+  8030f0:	ff d0                	call   *%rax
+        i += res;
+  8030f2:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8030f5:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8030f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030fc:	48 39 c3             	cmp    %rax,%rbx
+  8030ff:	0f 82 72 ff ff ff    	jb     803077 <devfile_read+0x9e>
+    return i;
+  803105:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803108:	48 85 c0             	test   %rax,%rax
+  80310b:	7e 04                	jle    803111 <devfile_read+0x138>
+  80310d:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803111:	48 83 c4 28          	add    $0x28,%rsp
+  803115:	5b                   	pop    %rbx
+  803116:	41 5c                	pop    %r12
+  803118:	41 5d                	pop    %r13
+  80311a:	41 5e                	pop    %r14
+  80311c:	41 5f                	pop    %r15
+  80311e:	5d                   	pop    %rbp
+  80311f:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803120:	48 98                	cltq
+  803122:	eb ed                	jmp    803111 <devfile_read+0x138>
+            return res;
+  803124:	48 98                	cltq
+  803126:	eb e9                	jmp    803111 <devfile_read+0x138>
+            return i;
+  803128:	48 89 d8             	mov    %rbx,%rax
+  80312b:	eb db                	jmp    803108 <devfile_read+0x12f>
+    size_t i = 0;
+  80312d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803131:	eb d2                	jmp    803105 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803133:	48 89 c6             	mov    %rax,%rsi
+  803136:	4c 89 ff             	mov    %r15,%rdi
+  803139:	48 b8 4b 2a 80 00 00 	movabs $0x802a4b,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+  803145:	85 c0                	test   %eax,%eax
+  803147:	78 40                	js     803189 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803149:	4c 89 ff             	mov    %r15,%rdi
+  80314c:	48 b8 4f 1f 80 00 00 	movabs $0x801f4f,%rax
+  803153:	00 00 00 
+  803156:	ff d0                	call   *%rax
+  803158:	48 89 c2             	mov    %rax,%rdx
+  80315b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80315f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803163:	48 c1 e0 0c          	shl    $0xc,%rax
+  803167:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80316c:	48 01 d0             	add    %rdx,%rax
+  80316f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803173:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803178:	0f 84 33 01 00 00    	je     8032b1 <devfile_read+0x2d8>
+    size_t i = 0;
+  80317e:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803184:	e9 f5 00 00 00       	jmp    80327e <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803189:	48 98                	cltq
+  80318b:	eb 84                	jmp    803111 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80318d:	44 89 e8             	mov    %r13d,%eax
+  803190:	66 b8 00 00          	mov    $0x0,%ax
+  803194:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803199:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8031a0:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8031a2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8031a6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8031aa:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8031ac:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8031b1:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8031b4:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8031bb:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8031bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031c7:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8031cc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8031d1:	48 b8 a3 28 80 00 00 	movabs $0x8028a3,%rax
+  8031d8:	00 00 00 
+  8031db:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8031dd:	85 c0                	test   %eax,%eax
+  8031df:	0f 88 be 00 00 00    	js     8032a3 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8031e5:	48 63 d0             	movslq %eax,%rdx
+  8031e8:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8031ed:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8031f2:	44 39 e8             	cmp    %r13d,%eax
+  8031f5:	0f 8e ba 00 00 00    	jle    8032b5 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8031fb:	49 63 c5             	movslq %r13d,%rax
+  8031fe:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803203:	48 29 c3             	sub    %rax,%rbx
+  803206:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80320b:	48 01 c3             	add    %rax,%rbx
+  80320e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803212:	4c 29 f0             	sub    %r14,%rax
+  803215:	48 39 c3             	cmp    %rax,%rbx
+  803218:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80321c:	4c 89 ff             	mov    %r15,%rdi
+  80321f:	48 b9 4f 1f 80 00 00 	movabs $0x801f4f,%rcx
+  803226:	00 00 00 
+  803229:	ff d1                	call   *%rcx
+  80322b:	48 89 c2             	mov    %rax,%rdx
+  80322e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803232:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803236:	48 c1 e0 0c          	shl    $0xc,%rax
+  80323a:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  80323f:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803242:	44 89 ea             	mov    %r13d,%edx
+  803245:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  80324a:	48 63 d2             	movslq %edx,%rdx
+  80324d:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803254:	00 
+  803255:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803259:	4c 01 f7             	add    %r14,%rdi
+  80325c:	48 89 da             	mov    %rbx,%rdx
+  80325f:	48 b9 54 10 80 00 00 	movabs $0x801054,%rcx
+  803266:	00 00 00 
+  803269:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80326b:	41 01 dd             	add    %ebx,%r13d
+  80326e:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803272:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803275:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803279:	49 39 c6             	cmp    %rax,%r14
+  80327c:	73 37                	jae    8032b5 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  80327e:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803282:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803287:	44 39 e8             	cmp    %r13d,%eax
+  80328a:	0f 8f fd fe ff ff    	jg     80318d <devfile_read+0x1b4>
+  803290:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803295:	44 39 e8             	cmp    %r13d,%eax
+  803298:	0f 8f 5d ff ff ff    	jg     8031fb <devfile_read+0x222>
+  80329e:	e9 ea fe ff ff       	jmp    80318d <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8032a3:	48 98                	cltq
+  8032a5:	4d 85 f6             	test   %r14,%r14
+  8032a8:	49 0f 45 c6          	cmovne %r14,%rax
+  8032ac:	e9 60 fe ff ff       	jmp    803111 <devfile_read+0x138>
+    size_t i = 0;
+  8032b1:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8032b5:	4c 89 f0             	mov    %r14,%rax
+  8032b8:	e9 54 fe ff ff       	jmp    803111 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8032bd:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8032c4:	e9 48 fe ff ff       	jmp    803111 <devfile_read+0x138>
+
+00000000008032c9 <open>:
+open(const char *path, int mode) {
+  8032c9:	55                   	push   %rbp
+  8032ca:	48 89 e5             	mov    %rsp,%rbp
+  8032cd:	41 55                	push   %r13
+  8032cf:	41 54                	push   %r12
+  8032d1:	53                   	push   %rbx
+  8032d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8032d6:	49 89 fc             	mov    %rdi,%r12
+  8032d9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8032dc:	48 b8 21 0c 80 00 00 	movabs $0x800c21,%rax
+  8032e3:	00 00 00 
+  8032e6:	ff d0                	call   *%rax
+  8032e8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8032ee:	0f 87 8a 00 00 00    	ja     80337e <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8032f4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8032f8:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  8032ff:	00 00 00 
+  803302:	ff d0                	call   *%rax
+  803304:	89 c3                	mov    %eax,%ebx
+  803306:	85 c0                	test   %eax,%eax
+  803308:	78 50                	js     80335a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80330a:	4c 89 e6             	mov    %r12,%rsi
+  80330d:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803314:	00 00 00 
+  803317:	48 89 df             	mov    %rbx,%rdi
+  80331a:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  803321:	00 00 00 
+  803324:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803326:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80332d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803331:	bf 01 00 00 00       	mov    $0x1,%edi
+  803336:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  80333d:	00 00 00 
+  803340:	ff d0                	call   *%rax
+  803342:	89 c3                	mov    %eax,%ebx
+  803344:	85 c0                	test   %eax,%eax
+  803346:	78 1f                	js     803367 <open+0x9e>
+    return fd2num(fd);
+  803348:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80334c:	48 b8 4f 1f 80 00 00 	movabs $0x801f4f,%rax
+  803353:	00 00 00 
+  803356:	ff d0                	call   *%rax
+  803358:	89 c3                	mov    %eax,%ebx
+}
+  80335a:	89 d8                	mov    %ebx,%eax
+  80335c:	48 83 c4 18          	add    $0x18,%rsp
+  803360:	5b                   	pop    %rbx
+  803361:	41 5c                	pop    %r12
+  803363:	41 5d                	pop    %r13
+  803365:	5d                   	pop    %rbp
+  803366:	c3                   	ret
+        fd_close(fd, 0);
+  803367:	be 00 00 00 00       	mov    $0x0,%esi
+  80336c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803370:	48 b8 98 20 80 00 00 	movabs $0x802098,%rax
+  803377:	00 00 00 
+  80337a:	ff d0                	call   *%rax
+        return res;
+  80337c:	eb dc                	jmp    80335a <open+0x91>
+        return -E_BAD_PATH;
+  80337e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803383:	eb d5                	jmp    80335a <open+0x91>
+
+0000000000803385 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803385:	55                   	push   %rbp
+  803386:	48 89 e5             	mov    %rsp,%rbp
+  803389:	41 57                	push   %r15
+  80338b:	41 56                	push   %r14
+  80338d:	41 55                	push   %r13
+  80338f:	41 54                	push   %r12
+  803391:	53                   	push   %rbx
+  803392:	48 83 ec 18          	sub    $0x18,%rsp
+  803396:	41 89 f6             	mov    %esi,%r14d
+  803399:	49 89 d7             	mov    %rdx,%r15
+  80339c:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80339f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033a3:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  8033aa:	00 00 00 
+  8033ad:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033af:	85 c0                	test   %eax,%eax
+  8033b1:	0f 88 db 00 00 00    	js     803492 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8033b7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033bb:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8033c2:	00 00 00 
+  8033c5:	8b 00                	mov    (%rax),%eax
+  8033c7:	39 07                	cmp    %eax,(%rdi)
+  8033c9:	0f 85 db 00 00 00    	jne    8034aa <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8033cf:	45 85 f6             	test   %r14d,%r14d
+  8033d2:	0f 88 db 00 00 00    	js     8034b3 <fmap+0x12e>
+  8033d8:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8033df:	0f 85 d7 00 00 00    	jne    8034bc <fmap+0x137>
+  8033e5:	4c 89 fb             	mov    %r15,%rbx
+  8033e8:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8033ee:	0f 85 d1 00 00 00    	jne    8034c5 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8033f4:	48 b8 15 2b 80 00 00 	movabs $0x802b15,%rax
+  8033fb:	00 00 00 
+  8033fe:	ff d0                	call   *%rax
+  803400:	85 c0                	test   %eax,%eax
+  803402:	0f 88 8e 00 00 00    	js     803496 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803408:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80340f:	00 00 00 
+    while (i < n) {
+  803412:	4d 85 ed             	test   %r13,%r13
+  803415:	0f 84 8a 00 00 00    	je     8034a5 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80341b:	4c 89 ea             	mov    %r13,%rdx
+  80341e:	48 29 da             	sub    %rbx,%rdx
+  803421:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803428:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80342e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803432:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803436:	8b 40 0c             	mov    0xc(%rax),%eax
+  803439:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80343d:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803441:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803446:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80344b:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80344f:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803453:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803458:	4c 89 e6             	mov    %r12,%rsi
+  80345b:	bf 09 00 00 00       	mov    $0x9,%edi
+  803460:	48 b8 a3 28 80 00 00 	movabs $0x8028a3,%rax
+  803467:	00 00 00 
+  80346a:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80346c:	85 c0                	test   %eax,%eax
+  80346e:	78 2a                	js     80349a <fmap+0x115>
+        i += res;
+  803470:	48 98                	cltq
+  803472:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803475:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803479:	72 05                	jb     803480 <fmap+0xfb>
+    while (i < n) {
+  80347b:	4c 39 eb             	cmp    %r13,%rbx
+  80347e:	72 9b                	jb     80341b <fmap+0x96>
+    }
+    return i;
+  803480:	48 89 d8             	mov    %rbx,%rax
+}
+  803483:	48 83 c4 18          	add    $0x18,%rsp
+  803487:	5b                   	pop    %rbx
+  803488:	41 5c                	pop    %r12
+  80348a:	41 5d                	pop    %r13
+  80348c:	41 5e                	pop    %r14
+  80348e:	41 5f                	pop    %r15
+  803490:	5d                   	pop    %rbp
+  803491:	c3                   	ret
+    if (res < 0) return res;
+  803492:	48 98                	cltq
+  803494:	eb ed                	jmp    803483 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803496:	48 98                	cltq
+  803498:	eb e9                	jmp    803483 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  80349a:	48 98                	cltq
+  80349c:	48 85 db             	test   %rbx,%rbx
+  80349f:	48 0f 45 c3          	cmovne %rbx,%rax
+  8034a3:	eb de                	jmp    803483 <fmap+0xfe>
+    size_t i = 0;
+  8034a5:	4c 89 eb             	mov    %r13,%rbx
+  8034a8:	eb d6                	jmp    803480 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8034aa:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8034b1:	eb d0                	jmp    803483 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8034b3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034ba:	eb c7                	jmp    803483 <fmap+0xfe>
+  8034bc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034c3:	eb be                	jmp    803483 <fmap+0xfe>
+  8034c5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034cc:	eb b5                	jmp    803483 <fmap+0xfe>
+
+00000000008034ce <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8034ce:	55                   	push   %rbp
+  8034cf:	48 89 e5             	mov    %rsp,%rbp
+  8034d2:	41 56                	push   %r14
+  8034d4:	41 55                	push   %r13
+  8034d6:	41 54                	push   %r12
+  8034d8:	53                   	push   %rbx
+  8034d9:	48 83 ec 10          	sub    $0x10,%rsp
+  8034dd:	89 fb                	mov    %edi,%ebx
+  8034df:	41 89 f4             	mov    %esi,%r12d
+  8034e2:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034e5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034e9:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  8034f0:	00 00 00 
+  8034f3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034f5:	85 c0                	test   %eax,%eax
+  8034f7:	78 63                	js     80355c <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8034f9:	45 85 e4             	test   %r12d,%r12d
+  8034fc:	0f 88 80 00 00 00    	js     803582 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803502:	45 89 e6             	mov    %r12d,%r14d
+  803505:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80350c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803510:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  803517:	00 00 00 
+  80351a:	ff d0                	call   *%rax
+  80351c:	48 89 c2             	mov    %rax,%rdx
+  80351f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803524:	44 89 f6             	mov    %r14d,%esi
+  803527:	89 df                	mov    %ebx,%edi
+  803529:	48 b8 85 33 80 00 00 	movabs $0x803385,%rax
+  803530:	00 00 00 
+  803533:	ff d0                	call   *%rax
+  803535:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803538:	45 29 f4             	sub    %r14d,%r12d
+  80353b:	4d 63 f4             	movslq %r12d,%r14
+  80353e:	49 39 c6             	cmp    %rax,%r14
+  803541:	7c 1d                	jl     803560 <read_map+0x92>
+  803543:	48 85 c0             	test   %rax,%rax
+  803546:	b8 00 00 00 00       	mov    $0x0,%eax
+  80354b:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80354f:	48 83 c4 10          	add    $0x10,%rsp
+  803553:	5b                   	pop    %rbx
+  803554:	41 5c                	pop    %r12
+  803556:	41 5d                	pop    %r13
+  803558:	41 5e                	pop    %r14
+  80355a:	5d                   	pop    %rbp
+  80355b:	c3                   	ret
+    if (res < 0) return res;
+  80355c:	48 98                	cltq
+  80355e:	eb ef                	jmp    80354f <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803560:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803564:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  80356b:	00 00 00 
+  80356e:	ff d0                	call   *%rax
+  803570:	4d 63 e4             	movslq %r12d,%r12
+  803573:	4c 01 e0             	add    %r12,%rax
+  803576:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  80357a:	48 89 d8             	mov    %rbx,%rax
+  80357d:	4c 29 f0             	sub    %r14,%rax
+  803580:	eb cd                	jmp    80354f <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803582:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803589:	eb c4                	jmp    80354f <read_map+0x81>
+
+000000000080358b <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  80358b:	55                   	push   %rbp
+  80358c:	48 89 e5             	mov    %rsp,%rbp
+  80358f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803593:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803597:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  80359e:	00 00 00 
+  8035a1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035a3:	85 c0                	test   %eax,%eax
+  8035a5:	78 4a                	js     8035f1 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8035a7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035ab:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8035b2:	00 00 00 
+  8035b5:	8b 00                	mov    (%rax),%eax
+  8035b7:	39 07                	cmp    %eax,(%rdi)
+  8035b9:	75 38                	jne    8035f3 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8035bb:	48 b8 15 2b 80 00 00 	movabs $0x802b15,%rax
+  8035c2:	00 00 00 
+  8035c5:	ff d0                	call   *%rax
+  8035c7:	85 c0                	test   %eax,%eax
+  8035c9:	78 26                	js     8035f1 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8035cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035cf:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035d2:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8035d9:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8035db:	be 00 00 00 00       	mov    $0x0,%esi
+  8035e0:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035e5:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  8035ec:	00 00 00 
+  8035ef:	ff d0                	call   *%rax
+}
+  8035f1:	c9                   	leave
+  8035f2:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8035f3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8035f8:	eb f7                	jmp    8035f1 <fsync+0x66>
+
+00000000008035fa <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8035fa:	55                   	push   %rbp
+  8035fb:	48 89 e5             	mov    %rsp,%rbp
+  8035fe:	41 57                	push   %r15
+  803600:	41 56                	push   %r14
+  803602:	41 55                	push   %r13
+  803604:	41 54                	push   %r12
+  803606:	53                   	push   %rbx
+  803607:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80360b:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803612:	00 00 00 
+  803615:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80361a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803620:	49 bd dd 1f 80 00 00 	movabs $0x801fdd,%r13
+  803627:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80362a:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803631:	00 00 00 
+  803634:	eb 0c                	jmp    803642 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803636:	83 c3 01             	add    $0x1,%ebx
+  803639:	49 83 c4 28          	add    $0x28,%r12
+  80363d:	83 fb 20             	cmp    $0x20,%ebx
+  803640:	74 33                	je     803675 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803642:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803647:	74 ed                	je     803636 <flushall+0x3c>
+  803649:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80364d:	89 df                	mov    %ebx,%edi
+  80364f:	41 ff d5             	call   *%r13
+  803652:	85 c0                	test   %eax,%eax
+  803654:	78 e0                	js     803636 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803656:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80365a:	41 8b 06             	mov    (%r14),%eax
+  80365d:	39 07                	cmp    %eax,(%rdi)
+  80365f:	75 d5                	jne    803636 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803661:	48 b8 15 2b 80 00 00 	movabs $0x802b15,%rax
+  803668:	00 00 00 
+  80366b:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80366d:	85 c0                	test   %eax,%eax
+  80366f:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803673:	eb c1                	jmp    803636 <flushall+0x3c>
+    }
+    return res;
+}
+  803675:	44 89 f8             	mov    %r15d,%eax
+  803678:	48 83 c4 18          	add    $0x18,%rsp
+  80367c:	5b                   	pop    %rbx
+  80367d:	41 5c                	pop    %r12
+  80367f:	41 5d                	pop    %r13
+  803681:	41 5e                	pop    %r14
+  803683:	41 5f                	pop    %r15
+  803685:	5d                   	pop    %rbp
+  803686:	c3                   	ret
+
+0000000000803687 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803687:	55                   	push   %rbp
+  803688:	48 89 e5             	mov    %rsp,%rbp
+  80368b:	53                   	push   %rbx
+  80368c:	48 83 ec 08          	sub    $0x8,%rsp
+  803690:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803693:	40 0f b6 c6          	movzbl %sil,%eax
+  803697:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80369e:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8036a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8036a5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8036aa:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  8036b1:	00 00 00 
+  8036b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036b6:	85 c0                	test   %eax,%eax
+  8036b8:	78 23                	js     8036dd <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8036ba:	ba 58 06 00 00       	mov    $0x658,%edx
+  8036bf:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8036c6:	00 00 00 
+  8036c9:	48 89 df             	mov    %rbx,%rdi
+  8036cc:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  8036d3:	00 00 00 
+  8036d6:	ff d0                	call   *%rax
+    return 0;
+  8036d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036e1:	c9                   	leave
+  8036e2:	c3                   	ret
+
+00000000008036e3 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8036e3:	55                   	push   %rbp
+  8036e4:	48 89 e5             	mov    %rsp,%rbp
+  8036e7:	53                   	push   %rbx
+  8036e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8036ec:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8036ef:	48 b8 21 0c 80 00 00 	movabs $0x800c21,%rax
+  8036f6:	00 00 00 
+  8036f9:	ff d0                	call   *%rax
+  8036fb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803701:	77 35                	ja     803738 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803703:	48 89 de             	mov    %rbx,%rsi
+  803706:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80370d:	00 00 00 
+  803710:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  803717:	00 00 00 
+  80371a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80371c:	be 00 00 00 00       	mov    $0x0,%esi
+  803721:	bf 07 00 00 00       	mov    $0x7,%edi
+  803726:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  80372d:	00 00 00 
+  803730:	ff d0                	call   *%rax
+}
+  803732:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803736:	c9                   	leave
+  803737:	c3                   	ret
+        return -E_BAD_PATH;
+  803738:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80373d:	eb f3                	jmp    803732 <remove+0x4f>
+
+000000000080373f <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80373f:	55                   	push   %rbp
+  803740:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803743:	48 b8 fa 35 80 00 00 	movabs $0x8035fa,%rax
+  80374a:	00 00 00 
+  80374d:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80374f:	be 00 00 00 00       	mov    $0x0,%esi
+  803754:	bf 08 00 00 00       	mov    $0x8,%edi
+  803759:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  803760:	00 00 00 
+  803763:	ff d0                	call   *%rax
+}
+  803765:	5d                   	pop    %rbp
+  803766:	c3                   	ret
+
+0000000000803767 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803767:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80376b:	7f 01                	jg     80376e <writebuf+0x7>
+  80376d:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80376e:	55                   	push   %rbp
+  80376f:	48 89 e5             	mov    %rsp,%rbp
+  803772:	53                   	push   %rbx
+  803773:	48 83 ec 08          	sub    $0x8,%rsp
+  803777:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80377a:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80377e:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803782:	8b 3f                	mov    (%rdi),%edi
+  803784:	48 b8 ef 23 80 00 00 	movabs $0x8023ef,%rax
+  80378b:	00 00 00 
+  80378e:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803790:	48 85 c0             	test   %rax,%rax
+  803793:	7e 04                	jle    803799 <writebuf+0x32>
+  803795:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803799:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80379d:	48 39 c2             	cmp    %rax,%rdx
+  8037a0:	74 0f                	je     8037b1 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8037a2:	48 85 c0             	test   %rax,%rax
+  8037a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037aa:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8037ae:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8037b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037b5:	c9                   	leave
+  8037b6:	c3                   	ret
+
+00000000008037b7 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8037b7:	8b 46 04             	mov    0x4(%rsi),%eax
+  8037ba:	8d 50 01             	lea    0x1(%rax),%edx
+  8037bd:	89 56 04             	mov    %edx,0x4(%rsi)
+  8037c0:	48 98                	cltq
+  8037c2:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8037c7:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8037cd:	74 01                	je     8037d0 <putch+0x19>
+  8037cf:	c3                   	ret
+putch(int ch, void *arg) {
+  8037d0:	55                   	push   %rbp
+  8037d1:	48 89 e5             	mov    %rsp,%rbp
+  8037d4:	53                   	push   %rbx
+  8037d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8037d9:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8037dc:	48 89 f7             	mov    %rsi,%rdi
+  8037df:	48 b8 67 37 80 00 00 	movabs $0x803767,%rax
+  8037e6:	00 00 00 
+  8037e9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8037eb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8037f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037f6:	c9                   	leave
+  8037f7:	c3                   	ret
+
+00000000008037f8 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8037f8:	55                   	push   %rbp
+  8037f9:	48 89 e5             	mov    %rsp,%rbp
+  8037fc:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803803:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803806:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  80380c:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803813:	00 00 00 
+    state.result = 0;
+  803816:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80381d:	00 00 00 00 
+    state.error = 1;
+  803821:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803828:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80382b:	48 89 f2             	mov    %rsi,%rdx
+  80382e:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803835:	48 bf b7 37 80 00 00 	movabs $0x8037b7,%rdi
+  80383c:	00 00 00 
+  80383f:	48 b8 37 04 80 00 00 	movabs $0x800437,%rax
+  803846:	00 00 00 
+  803849:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80384b:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803852:	7f 14                	jg     803868 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803854:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80385b:	48 85 c0             	test   %rax,%rax
+  80385e:	75 06                	jne    803866 <vfprintf+0x6e>
+  803860:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803866:	c9                   	leave
+  803867:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803868:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  80386f:	48 b8 67 37 80 00 00 	movabs $0x803767,%rax
+  803876:	00 00 00 
+  803879:	ff d0                	call   *%rax
+  80387b:	eb d7                	jmp    803854 <vfprintf+0x5c>
+
+000000000080387d <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80387d:	55                   	push   %rbp
+  80387e:	48 89 e5             	mov    %rsp,%rbp
+  803881:	48 83 ec 50          	sub    $0x50,%rsp
+  803885:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803889:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80388d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803891:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803895:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80389c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8038a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038a4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8038a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8038ac:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8038b0:	48 b8 f8 37 80 00 00 	movabs $0x8037f8,%rax
+  8038b7:	00 00 00 
+  8038ba:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8038bc:	c9                   	leave
+  8038bd:	c3                   	ret
+
+00000000008038be <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8038be:	55                   	push   %rbp
+  8038bf:	48 89 e5             	mov    %rsp,%rbp
+  8038c2:	48 83 ec 50          	sub    $0x50,%rsp
+  8038c6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8038ca:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8038ce:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8038d2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8038d6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8038da:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8038e1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8038e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038e9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8038ed:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8038f1:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8038f5:	48 89 fe             	mov    %rdi,%rsi
+  8038f8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8038fd:	48 b8 f8 37 80 00 00 	movabs $0x8037f8,%rax
+  803904:	00 00 00 
+  803907:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803909:	c9                   	leave
+  80390a:	c3                   	ret
+
+000000000080390b <puts>:
+
+int
+puts(const char *str) {
+  80390b:	55                   	push   %rbp
+  80390c:	48 89 e5             	mov    %rsp,%rbp
+  80390f:	48 89 fe             	mov    %rdi,%rsi
+    return printf("%s\n", str);
+  803912:	48 bf c0 56 80 00 00 	movabs $0x8056c0,%rdi
+  803919:	00 00 00 
+  80391c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803921:	48 ba be 38 80 00 00 	movabs $0x8038be,%rdx
+  803928:	00 00 00 
+  80392b:	ff d2                	call   *%rdx
+}
+  80392d:	5d                   	pop    %rbp
+  80392e:	c3                   	ret
+
+000000000080392f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80392f:	55                   	push   %rbp
+  803930:	48 89 e5             	mov    %rsp,%rbp
+  803933:	41 54                	push   %r12
+  803935:	53                   	push   %rbx
+  803936:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803939:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  803940:	00 00 00 
+  803943:	ff d0                	call   *%rax
+  803945:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803948:	48 be c4 56 80 00 00 	movabs $0x8056c4,%rsi
+  80394f:	00 00 00 
+  803952:	48 89 df             	mov    %rbx,%rdi
+  803955:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  80395c:	00 00 00 
+  80395f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803961:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803966:	41 2b 04 24          	sub    (%r12),%eax
+  80396a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803970:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803977:	00 00 00 
+    stat->st_dev = &devpipe;
+  80397a:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803981:	00 00 00 
+  803984:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80398b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803990:	5b                   	pop    %rbx
+  803991:	41 5c                	pop    %r12
+  803993:	5d                   	pop    %rbp
+  803994:	c3                   	ret
+
+0000000000803995 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803995:	55                   	push   %rbp
+  803996:	48 89 e5             	mov    %rsp,%rbp
+  803999:	41 54                	push   %r12
+  80399b:	53                   	push   %rbx
+  80399c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80399f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039a4:	48 89 fe             	mov    %rdi,%rsi
+  8039a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039ac:	49 bc 9e 15 80 00 00 	movabs $0x80159e,%r12
+  8039b3:	00 00 00 
+  8039b6:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8039b9:	48 89 df             	mov    %rbx,%rdi
+  8039bc:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  8039c3:	00 00 00 
+  8039c6:	ff d0                	call   *%rax
+  8039c8:	48 89 c6             	mov    %rax,%rsi
+  8039cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d5:	41 ff d4             	call   *%r12
+}
+  8039d8:	5b                   	pop    %rbx
+  8039d9:	41 5c                	pop    %r12
+  8039db:	5d                   	pop    %rbp
+  8039dc:	c3                   	ret
+
+00000000008039dd <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039dd:	55                   	push   %rbp
+  8039de:	48 89 e5             	mov    %rsp,%rbp
+  8039e1:	41 57                	push   %r15
+  8039e3:	41 56                	push   %r14
+  8039e5:	41 55                	push   %r13
+  8039e7:	41 54                	push   %r12
+  8039e9:	53                   	push   %rbx
+  8039ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8039ee:	49 89 fc             	mov    %rdi,%r12
+  8039f1:	49 89 f5             	mov    %rsi,%r13
+  8039f4:	49 89 d7             	mov    %rdx,%r15
+  8039f7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039fb:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  803a02:	00 00 00 
+  803a05:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803a07:	4d 85 ff             	test   %r15,%r15
+  803a0a:	0f 84 af 00 00 00    	je     803abf <devpipe_write+0xe2>
+  803a10:	48 89 c3             	mov    %rax,%rbx
+  803a13:	4c 89 f8             	mov    %r15,%rax
+  803a16:	4d 89 ef             	mov    %r13,%r15
+  803a19:	4c 01 e8             	add    %r13,%rax
+  803a1c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a20:	49 bd 93 13 80 00 00 	movabs $0x801393,%r13
+  803a27:	00 00 00 
+            sys_yield();
+  803a2a:	49 be 30 13 80 00 00 	movabs $0x801330,%r14
+  803a31:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a34:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a37:	48 63 ce             	movslq %esi,%rcx
+  803a3a:	48 63 03             	movslq (%rbx),%rax
+  803a3d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a43:	48 39 c1             	cmp    %rax,%rcx
+  803a46:	72 2e                	jb     803a76 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a48:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a4d:	48 89 da             	mov    %rbx,%rdx
+  803a50:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a55:	4c 89 e7             	mov    %r12,%rdi
+  803a58:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803a5b:	85 c0                	test   %eax,%eax
+  803a5d:	74 66                	je     803ac5 <devpipe_write+0xe8>
+            sys_yield();
+  803a5f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a62:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a65:	48 63 ce             	movslq %esi,%rcx
+  803a68:	48 63 03             	movslq (%rbx),%rax
+  803a6b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a71:	48 39 c1             	cmp    %rax,%rcx
+  803a74:	73 d2                	jae    803a48 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a76:	41 0f b6 3f          	movzbl (%r15),%edi
+  803a7a:	48 89 ca             	mov    %rcx,%rdx
+  803a7d:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a81:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803a88:	08 10 20 
+  803a8b:	48 f7 e2             	mul    %rdx
+  803a8e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a92:	48 89 d0             	mov    %rdx,%rax
+  803a95:	48 c1 e0 09          	shl    $0x9,%rax
+  803a99:	48 29 d0             	sub    %rdx,%rax
+  803a9c:	48 c1 e0 03          	shl    $0x3,%rax
+  803aa0:	48 29 c1             	sub    %rax,%rcx
+  803aa3:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803aa8:	83 c6 01             	add    $0x1,%esi
+  803aab:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803aae:	49 83 c7 01          	add    $0x1,%r15
+  803ab2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ab6:	49 39 c7             	cmp    %rax,%r15
+  803ab9:	0f 85 75 ff ff ff    	jne    803a34 <devpipe_write+0x57>
+    return n;
+  803abf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ac3:	eb 05                	jmp    803aca <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803aca:	48 83 c4 18          	add    $0x18,%rsp
+  803ace:	5b                   	pop    %rbx
+  803acf:	41 5c                	pop    %r12
+  803ad1:	41 5d                	pop    %r13
+  803ad3:	41 5e                	pop    %r14
+  803ad5:	41 5f                	pop    %r15
+  803ad7:	5d                   	pop    %rbp
+  803ad8:	c3                   	ret
+
+0000000000803ad9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ad9:	55                   	push   %rbp
+  803ada:	48 89 e5             	mov    %rsp,%rbp
+  803add:	41 57                	push   %r15
+  803adf:	41 56                	push   %r14
+  803ae1:	41 55                	push   %r13
+  803ae3:	41 54                	push   %r12
+  803ae5:	53                   	push   %rbx
+  803ae6:	48 83 ec 18          	sub    $0x18,%rsp
+  803aea:	49 89 fc             	mov    %rdi,%r12
+  803aed:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803af1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803af5:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  803afc:	00 00 00 
+  803aff:	ff d0                	call   *%rax
+  803b01:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b04:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b0a:	49 bd 93 13 80 00 00 	movabs $0x801393,%r13
+  803b11:	00 00 00 
+            sys_yield();
+  803b14:	49 be 30 13 80 00 00 	movabs $0x801330,%r14
+  803b1b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b1e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b23:	74 7d                	je     803ba2 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b25:	8b 03                	mov    (%rbx),%eax
+  803b27:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b2a:	75 26                	jne    803b52 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803b2c:	4d 85 ff             	test   %r15,%r15
+  803b2f:	75 77                	jne    803ba8 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b31:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b36:	48 89 da             	mov    %rbx,%rdx
+  803b39:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b3e:	4c 89 e7             	mov    %r12,%rdi
+  803b41:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b44:	85 c0                	test   %eax,%eax
+  803b46:	74 72                	je     803bba <devpipe_read+0xe1>
+            sys_yield();
+  803b48:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b4b:	8b 03                	mov    (%rbx),%eax
+  803b4d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b50:	74 df                	je     803b31 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b52:	48 63 c8             	movslq %eax,%rcx
+  803b55:	48 89 ca             	mov    %rcx,%rdx
+  803b58:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b5c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803b63:	08 10 20 
+  803b66:	48 89 d0             	mov    %rdx,%rax
+  803b69:	48 f7 e6             	mul    %rsi
+  803b6c:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b70:	48 89 d0             	mov    %rdx,%rax
+  803b73:	48 c1 e0 09          	shl    $0x9,%rax
+  803b77:	48 29 d0             	sub    %rdx,%rax
+  803b7a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803b81:	00 
+  803b82:	48 89 c8             	mov    %rcx,%rax
+  803b85:	48 29 d0             	sub    %rdx,%rax
+  803b88:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803b8d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b91:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803b95:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b98:	49 83 c7 01          	add    $0x1,%r15
+  803b9c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803ba0:	75 83                	jne    803b25 <devpipe_read+0x4c>
+    return n;
+  803ba2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ba6:	eb 03                	jmp    803bab <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803ba8:	4c 89 f8             	mov    %r15,%rax
+}
+  803bab:	48 83 c4 18          	add    $0x18,%rsp
+  803baf:	5b                   	pop    %rbx
+  803bb0:	41 5c                	pop    %r12
+  803bb2:	41 5d                	pop    %r13
+  803bb4:	41 5e                	pop    %r14
+  803bb6:	41 5f                	pop    %r15
+  803bb8:	5d                   	pop    %rbp
+  803bb9:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803bba:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbf:	eb ea                	jmp    803bab <devpipe_read+0xd2>
+
+0000000000803bc1 <pipe>:
+pipe(int pfd[2]) {
+  803bc1:	55                   	push   %rbp
+  803bc2:	48 89 e5             	mov    %rsp,%rbp
+  803bc5:	41 55                	push   %r13
+  803bc7:	41 54                	push   %r12
+  803bc9:	53                   	push   %rbx
+  803bca:	48 83 ec 18          	sub    $0x18,%rsp
+  803bce:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bd1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bd5:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  803bdc:	00 00 00 
+  803bdf:	ff d0                	call   *%rax
+  803be1:	89 c3                	mov    %eax,%ebx
+  803be3:	85 c0                	test   %eax,%eax
+  803be5:	0f 88 a0 01 00 00    	js     803d8b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803beb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bf0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bf5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803bf9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bfe:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  803c05:	00 00 00 
+  803c08:	ff d0                	call   *%rax
+  803c0a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c0c:	85 c0                	test   %eax,%eax
+  803c0e:	0f 88 77 01 00 00    	js     803d8b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c14:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c18:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  803c1f:	00 00 00 
+  803c22:	ff d0                	call   *%rax
+  803c24:	89 c3                	mov    %eax,%ebx
+  803c26:	85 c0                	test   %eax,%eax
+  803c28:	0f 88 43 01 00 00    	js     803d71 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c2e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c33:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c38:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c41:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  803c48:	00 00 00 
+  803c4b:	ff d0                	call   *%rax
+  803c4d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c4f:	85 c0                	test   %eax,%eax
+  803c51:	0f 88 1a 01 00 00    	js     803d71 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803c57:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c5b:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  803c62:	00 00 00 
+  803c65:	ff d0                	call   *%rax
+  803c67:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c6a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c6f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c74:	48 89 c6             	mov    %rax,%rsi
+  803c77:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c7c:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  803c83:	00 00 00 
+  803c86:	ff d0                	call   *%rax
+  803c88:	89 c3                	mov    %eax,%ebx
+  803c8a:	85 c0                	test   %eax,%eax
+  803c8c:	0f 88 c5 00 00 00    	js     803d57 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c92:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c96:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  803c9d:	00 00 00 
+  803ca0:	ff d0                	call   *%rax
+  803ca2:	48 89 c1             	mov    %rax,%rcx
+  803ca5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803cab:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803cb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cb6:	4c 89 ee             	mov    %r13,%rsi
+  803cb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cbe:	48 b8 26 14 80 00 00 	movabs $0x801426,%rax
+  803cc5:	00 00 00 
+  803cc8:	ff d0                	call   *%rax
+  803cca:	89 c3                	mov    %eax,%ebx
+  803ccc:	85 c0                	test   %eax,%eax
+  803cce:	78 6e                	js     803d3e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803cd0:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cd5:	4c 89 ef             	mov    %r13,%rdi
+  803cd8:	48 b8 61 13 80 00 00 	movabs $0x801361,%rax
+  803cdf:	00 00 00 
+  803ce2:	ff d0                	call   *%rax
+  803ce4:	83 f8 02             	cmp    $0x2,%eax
+  803ce7:	0f 85 ab 00 00 00    	jne    803d98 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803ced:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803cf4:	00 00 
+  803cf6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cfa:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803cfc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d00:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d07:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d0b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d11:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d18:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d1c:	48 bb 4f 1f 80 00 00 	movabs $0x801f4f,%rbx
+  803d23:	00 00 00 
+  803d26:	ff d3                	call   *%rbx
+  803d28:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d2c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d30:	ff d3                	call   *%rbx
+  803d32:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d3c:	eb 4d                	jmp    803d8b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d43:	4c 89 ee             	mov    %r13,%rsi
+  803d46:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d4b:	48 b8 9e 15 80 00 00 	movabs $0x80159e,%rax
+  803d52:	00 00 00 
+  803d55:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d57:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d5c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d60:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d65:	48 b8 9e 15 80 00 00 	movabs $0x80159e,%rax
+  803d6c:	00 00 00 
+  803d6f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d71:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d76:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d7f:	48 b8 9e 15 80 00 00 	movabs $0x80159e,%rax
+  803d86:	00 00 00 
+  803d89:	ff d0                	call   *%rax
+}
+  803d8b:	89 d8                	mov    %ebx,%eax
+  803d8d:	48 83 c4 18          	add    $0x18,%rsp
+  803d91:	5b                   	pop    %rbx
+  803d92:	41 5c                	pop    %r12
+  803d94:	41 5d                	pop    %r13
+  803d96:	5d                   	pop    %rbp
+  803d97:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d98:	48 b9 f0 56 80 00 00 	movabs $0x8056f0,%rcx
+  803d9f:	00 00 00 
+  803da2:	48 ba cb 56 80 00 00 	movabs $0x8056cb,%rdx
+  803da9:	00 00 00 
+  803dac:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803db1:	48 bf e0 56 80 00 00 	movabs $0x8056e0,%rdi
+  803db8:	00 00 00 
+  803dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc0:	49 b8 a0 43 80 00 00 	movabs $0x8043a0,%r8
+  803dc7:	00 00 00 
+  803dca:	41 ff d0             	call   *%r8
+
+0000000000803dcd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803dcd:	55                   	push   %rbp
+  803dce:	48 89 e5             	mov    %rsp,%rbp
+  803dd1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803dd5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803dd9:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  803de0:	00 00 00 
+  803de3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803de5:	85 c0                	test   %eax,%eax
+  803de7:	78 35                	js     803e1e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803de9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ded:	48 b8 61 1f 80 00 00 	movabs $0x801f61,%rax
+  803df4:	00 00 00 
+  803df7:	ff d0                	call   *%rax
+  803df9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803dfc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e01:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e06:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e0a:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  803e11:	00 00 00 
+  803e14:	ff d0                	call   *%rax
+  803e16:	85 c0                	test   %eax,%eax
+  803e18:	0f 94 c0             	sete   %al
+  803e1b:	0f b6 c0             	movzbl %al,%eax
+}
+  803e1e:	c9                   	leave
+  803e1f:	c3                   	ret
+
+0000000000803e20 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e20:	48 89 f8             	mov    %rdi,%rax
+  803e23:	48 c1 e8 27          	shr    $0x27,%rax
+  803e27:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e2e:	7f 00 00 
+  803e31:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e35:	f6 c2 01             	test   $0x1,%dl
+  803e38:	74 6d                	je     803ea7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e3a:	48 89 f8             	mov    %rdi,%rax
+  803e3d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e41:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e48:	7f 00 00 
+  803e4b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e4f:	f6 c2 01             	test   $0x1,%dl
+  803e52:	74 62                	je     803eb6 <get_uvpt_entry+0x96>
+  803e54:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e5b:	7f 00 00 
+  803e5e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e62:	f6 c2 80             	test   $0x80,%dl
+  803e65:	75 4f                	jne    803eb6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e67:	48 89 f8             	mov    %rdi,%rax
+  803e6a:	48 c1 e8 15          	shr    $0x15,%rax
+  803e6e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e75:	7f 00 00 
+  803e78:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e7c:	f6 c2 01             	test   $0x1,%dl
+  803e7f:	74 44                	je     803ec5 <get_uvpt_entry+0xa5>
+  803e81:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e88:	7f 00 00 
+  803e8b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e8f:	f6 c2 80             	test   $0x80,%dl
+  803e92:	75 31                	jne    803ec5 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e94:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e98:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e9f:	7f 00 00 
+  803ea2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803ea6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ea7:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803eae:	7f 00 00 
+  803eb1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803eb5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803eb6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ebd:	7f 00 00 
+  803ec0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ec4:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ec5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ecc:	7f 00 00 
+  803ecf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ed3:	c3                   	ret
+
+0000000000803ed4 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803ed4:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ed7:	48 89 f9             	mov    %rdi,%rcx
+  803eda:	48 c1 e9 27          	shr    $0x27,%rcx
+  803ede:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803ee5:	7f 00 00 
+  803ee8:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803eec:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ef3:	f6 c1 01             	test   $0x1,%cl
+  803ef6:	0f 84 b2 00 00 00    	je     803fae <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803efc:	48 89 f9             	mov    %rdi,%rcx
+  803eff:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803f03:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f0a:	7f 00 00 
+  803f0d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f11:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f18:	40 f6 c6 01          	test   $0x1,%sil
+  803f1c:	0f 84 8c 00 00 00    	je     803fae <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803f22:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f29:	7f 00 00 
+  803f2c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f30:	a8 80                	test   $0x80,%al
+  803f32:	75 7b                	jne    803faf <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f34:	48 89 f9             	mov    %rdi,%rcx
+  803f37:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f3b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f42:	7f 00 00 
+  803f45:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f49:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f50:	40 f6 c6 01          	test   $0x1,%sil
+  803f54:	74 58                	je     803fae <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803f56:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f5d:	7f 00 00 
+  803f60:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f64:	a8 80                	test   $0x80,%al
+  803f66:	75 6c                	jne    803fd4 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f68:	48 89 f9             	mov    %rdi,%rcx
+  803f6b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803f6f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f76:	7f 00 00 
+  803f79:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f7d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f84:	40 f6 c6 01          	test   $0x1,%sil
+  803f88:	74 24                	je     803fae <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f8a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f91:	7f 00 00 
+  803f94:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f98:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f9f:	ff ff 7f 
+  803fa2:	48 21 c8             	and    %rcx,%rax
+  803fa5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803fab:	48 09 d0             	or     %rdx,%rax
+}
+  803fae:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803faf:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fb6:	7f 00 00 
+  803fb9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fbd:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fc4:	ff ff 7f 
+  803fc7:	48 21 c8             	and    %rcx,%rax
+  803fca:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803fd0:	48 01 d0             	add    %rdx,%rax
+  803fd3:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803fd4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fdb:	7f 00 00 
+  803fde:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fe2:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fe9:	ff ff 7f 
+  803fec:	48 21 c8             	and    %rcx,%rax
+  803fef:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803ff5:	48 01 d0             	add    %rdx,%rax
+  803ff8:	c3                   	ret
+
+0000000000803ff9 <get_prot>:
+
+int
+get_prot(void *va) {
+  803ff9:	55                   	push   %rbp
+  803ffa:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ffd:	48 b8 20 3e 80 00 00 	movabs $0x803e20,%rax
+  804004:	00 00 00 
+  804007:	ff d0                	call   *%rax
+  804009:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80400c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804011:	89 c1                	mov    %eax,%ecx
+  804013:	83 c9 04             	or     $0x4,%ecx
+  804016:	f6 c2 01             	test   $0x1,%dl
+  804019:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80401c:	89 c1                	mov    %eax,%ecx
+  80401e:	83 c9 02             	or     $0x2,%ecx
+  804021:	f6 c2 02             	test   $0x2,%dl
+  804024:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804027:	89 c1                	mov    %eax,%ecx
+  804029:	83 c9 01             	or     $0x1,%ecx
+  80402c:	48 85 d2             	test   %rdx,%rdx
+  80402f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804032:	89 c1                	mov    %eax,%ecx
+  804034:	83 c9 40             	or     $0x40,%ecx
+  804037:	f6 c6 04             	test   $0x4,%dh
+  80403a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80403d:	5d                   	pop    %rbp
+  80403e:	c3                   	ret
+
+000000000080403f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80403f:	55                   	push   %rbp
+  804040:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804043:	48 b8 20 3e 80 00 00 	movabs $0x803e20,%rax
+  80404a:	00 00 00 
+  80404d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80404f:	48 c1 e8 06          	shr    $0x6,%rax
+  804053:	83 e0 01             	and    $0x1,%eax
+}
+  804056:	5d                   	pop    %rbp
+  804057:	c3                   	ret
+
+0000000000804058 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804058:	55                   	push   %rbp
+  804059:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80405c:	48 b8 20 3e 80 00 00 	movabs $0x803e20,%rax
+  804063:	00 00 00 
+  804066:	ff d0                	call   *%rax
+  804068:	83 e0 01             	and    $0x1,%eax
+}
+  80406b:	5d                   	pop    %rbp
+  80406c:	c3                   	ret
+
+000000000080406d <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  80406d:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804074:	7f 00 00 
+  804077:	a8 01                	test   $0x1,%al
+  804079:	75 06                	jne    804081 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  80407b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804080:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804081:	55                   	push   %rbp
+  804082:	48 89 e5             	mov    %rsp,%rbp
+  804085:	41 57                	push   %r15
+  804087:	41 56                	push   %r14
+  804089:	41 55                	push   %r13
+  80408b:	41 54                	push   %r12
+  80408d:	53                   	push   %rbx
+  80408e:	48 83 ec 18          	sub    $0x18,%rsp
+  804092:	49 89 fe             	mov    %rdi,%r14
+  804095:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804098:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80409f:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8040a0:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  8040a7:	7f 00 00 
+  8040aa:	e9 81 00 00 00       	jmp    804130 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  8040af:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040b6:	49 39 dd             	cmp    %rbx,%r13
+  8040b9:	74 2b                	je     8040e6 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8040bb:	48 89 d8             	mov    %rbx,%rax
+  8040be:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040c2:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  8040c6:	f6 c2 01             	test   $0x1,%dl
+  8040c9:	74 e4                	je     8040af <foreach_shared_region+0x42>
+  8040cb:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  8040cf:	f6 c4 04             	test   $0x4,%ah
+  8040d2:	74 db                	je     8040af <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  8040d4:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040db:	4c 89 fa             	mov    %r15,%rdx
+  8040de:	48 89 df             	mov    %rbx,%rdi
+  8040e1:	41 ff d6             	call   *%r14
+  8040e4:	eb c9                	jmp    8040af <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8040e6:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  8040ed:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  8040f1:	74 22                	je     804115 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  8040f3:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  8040fa:	48 89 d8             	mov    %rbx,%rax
+  8040fd:	48 c1 e8 15          	shr    $0x15,%rax
+  804101:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804108:	7f 00 00 
+  80410b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80410f:	a8 01                	test   $0x1,%al
+  804111:	74 d3                	je     8040e6 <foreach_shared_region+0x79>
+  804113:	eb a6                	jmp    8040bb <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804115:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  80411c:	40 
+  80411d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804121:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804128:	00 00 00 
+  80412b:	48 39 c1             	cmp    %rax,%rcx
+  80412e:	74 31                	je     804161 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804130:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804134:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804138:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  80413f:	7f 00 00 
+  804142:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804146:	a8 01                	test   $0x1,%al
+  804148:	74 cb                	je     804115 <foreach_shared_region+0xa8>
+  80414a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80414e:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804155:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  80415b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80415f:	eb 92                	jmp    8040f3 <foreach_shared_region+0x86>
+}
+  804161:	b8 00 00 00 00       	mov    $0x0,%eax
+  804166:	48 83 c4 18          	add    $0x18,%rsp
+  80416a:	5b                   	pop    %rbx
+  80416b:	41 5c                	pop    %r12
+  80416d:	41 5d                	pop    %r13
+  80416f:	41 5e                	pop    %r14
+  804171:	41 5f                	pop    %r15
+  804173:	5d                   	pop    %rbp
+  804174:	c3                   	ret
+
+0000000000804175 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804175:	b8 00 00 00 00       	mov    $0x0,%eax
+  80417a:	c3                   	ret
+
+000000000080417b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80417b:	55                   	push   %rbp
+  80417c:	48 89 e5             	mov    %rsp,%rbp
+  80417f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804182:	48 be 14 57 80 00 00 	movabs $0x805714,%rsi
+  804189:	00 00 00 
+  80418c:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  804193:	00 00 00 
+  804196:	ff d0                	call   *%rax
+    return 0;
+}
+  804198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419d:	5d                   	pop    %rbp
+  80419e:	c3                   	ret
+
+000000000080419f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80419f:	55                   	push   %rbp
+  8041a0:	48 89 e5             	mov    %rsp,%rbp
+  8041a3:	41 57                	push   %r15
+  8041a5:	41 56                	push   %r14
+  8041a7:	41 55                	push   %r13
+  8041a9:	41 54                	push   %r12
+  8041ab:	53                   	push   %rbx
+  8041ac:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8041b3:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8041ba:	48 85 d2             	test   %rdx,%rdx
+  8041bd:	74 7a                	je     804239 <devcons_write+0x9a>
+  8041bf:	49 89 d6             	mov    %rdx,%r14
+  8041c2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041c8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8041cd:	49 bf ed 0f 80 00 00 	movabs $0x800fed,%r15
+  8041d4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8041d7:	4c 89 f3             	mov    %r14,%rbx
+  8041da:	48 29 f3             	sub    %rsi,%rbx
+  8041dd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8041e2:	48 39 c3             	cmp    %rax,%rbx
+  8041e5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8041e9:	4c 63 eb             	movslq %ebx,%r13
+  8041ec:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8041f3:	48 01 c6             	add    %rax,%rsi
+  8041f6:	4c 89 ea             	mov    %r13,%rdx
+  8041f9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804200:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804203:	4c 89 ee             	mov    %r13,%rsi
+  804206:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80420d:	48 b8 36 12 80 00 00 	movabs $0x801236,%rax
+  804214:	00 00 00 
+  804217:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804219:	41 01 dc             	add    %ebx,%r12d
+  80421c:	49 63 f4             	movslq %r12d,%rsi
+  80421f:	4c 39 f6             	cmp    %r14,%rsi
+  804222:	72 b3                	jb     8041d7 <devcons_write+0x38>
+    return res;
+  804224:	49 63 c4             	movslq %r12d,%rax
+}
+  804227:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80422e:	5b                   	pop    %rbx
+  80422f:	41 5c                	pop    %r12
+  804231:	41 5d                	pop    %r13
+  804233:	41 5e                	pop    %r14
+  804235:	41 5f                	pop    %r15
+  804237:	5d                   	pop    %rbp
+  804238:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804239:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80423f:	eb e3                	jmp    804224 <devcons_write+0x85>
+
+0000000000804241 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804241:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804244:	ba 00 00 00 00       	mov    $0x0,%edx
+  804249:	48 85 c0             	test   %rax,%rax
+  80424c:	74 55                	je     8042a3 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80424e:	55                   	push   %rbp
+  80424f:	48 89 e5             	mov    %rsp,%rbp
+  804252:	41 55                	push   %r13
+  804254:	41 54                	push   %r12
+  804256:	53                   	push   %rbx
+  804257:	48 83 ec 08          	sub    $0x8,%rsp
+  80425b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80425e:	48 bb 63 12 80 00 00 	movabs $0x801263,%rbx
+  804265:	00 00 00 
+  804268:	49 bc 30 13 80 00 00 	movabs $0x801330,%r12
+  80426f:	00 00 00 
+  804272:	eb 03                	jmp    804277 <devcons_read+0x36>
+  804274:	41 ff d4             	call   *%r12
+  804277:	ff d3                	call   *%rbx
+  804279:	85 c0                	test   %eax,%eax
+  80427b:	74 f7                	je     804274 <devcons_read+0x33>
+    if (c < 0) return c;
+  80427d:	48 63 d0             	movslq %eax,%rdx
+  804280:	78 13                	js     804295 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804282:	ba 00 00 00 00       	mov    $0x0,%edx
+  804287:	83 f8 04             	cmp    $0x4,%eax
+  80428a:	74 09                	je     804295 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80428c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804290:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804295:	48 89 d0             	mov    %rdx,%rax
+  804298:	48 83 c4 08          	add    $0x8,%rsp
+  80429c:	5b                   	pop    %rbx
+  80429d:	41 5c                	pop    %r12
+  80429f:	41 5d                	pop    %r13
+  8042a1:	5d                   	pop    %rbp
+  8042a2:	c3                   	ret
+  8042a3:	48 89 d0             	mov    %rdx,%rax
+  8042a6:	c3                   	ret
+
+00000000008042a7 <cputchar>:
+cputchar(int ch) {
+  8042a7:	55                   	push   %rbp
+  8042a8:	48 89 e5             	mov    %rsp,%rbp
+  8042ab:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8042af:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8042b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8042b8:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8042bc:	48 b8 36 12 80 00 00 	movabs $0x801236,%rax
+  8042c3:	00 00 00 
+  8042c6:	ff d0                	call   *%rax
+}
+  8042c8:	c9                   	leave
+  8042c9:	c3                   	ret
+
+00000000008042ca <getchar>:
+getchar(void) {
+  8042ca:	55                   	push   %rbp
+  8042cb:	48 89 e5             	mov    %rsp,%rbp
+  8042ce:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8042d2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042d7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8042db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042e0:	48 b8 c0 22 80 00 00 	movabs $0x8022c0,%rax
+  8042e7:	00 00 00 
+  8042ea:	ff d0                	call   *%rax
+  8042ec:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8042ee:	85 c0                	test   %eax,%eax
+  8042f0:	78 06                	js     8042f8 <getchar+0x2e>
+  8042f2:	74 08                	je     8042fc <getchar+0x32>
+  8042f4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8042f8:	89 d0                	mov    %edx,%eax
+  8042fa:	c9                   	leave
+  8042fb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8042fc:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804301:	eb f5                	jmp    8042f8 <getchar+0x2e>
+
+0000000000804303 <iscons>:
+iscons(int fdnum) {
+  804303:	55                   	push   %rbp
+  804304:	48 89 e5             	mov    %rsp,%rbp
+  804307:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80430b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80430f:	48 b8 dd 1f 80 00 00 	movabs $0x801fdd,%rax
+  804316:	00 00 00 
+  804319:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80431b:	85 c0                	test   %eax,%eax
+  80431d:	78 18                	js     804337 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80431f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804323:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80432a:	00 00 00 
+  80432d:	8b 00                	mov    (%rax),%eax
+  80432f:	39 02                	cmp    %eax,(%rdx)
+  804331:	0f 94 c0             	sete   %al
+  804334:	0f b6 c0             	movzbl %al,%eax
+}
+  804337:	c9                   	leave
+  804338:	c3                   	ret
+
+0000000000804339 <opencons>:
+opencons(void) {
+  804339:	55                   	push   %rbp
+  80433a:	48 89 e5             	mov    %rsp,%rbp
+  80433d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804341:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804345:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  80434c:	00 00 00 
+  80434f:	ff d0                	call   *%rax
+  804351:	85 c0                	test   %eax,%eax
+  804353:	78 49                	js     80439e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804355:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80435a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80435f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804363:	bf 00 00 00 00       	mov    $0x0,%edi
+  804368:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  80436f:	00 00 00 
+  804372:	ff d0                	call   *%rax
+  804374:	85 c0                	test   %eax,%eax
+  804376:	78 26                	js     80439e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804378:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80437c:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804383:	00 00 
+  804385:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804387:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80438b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804392:	48 b8 4f 1f 80 00 00 	movabs $0x801f4f,%rax
+  804399:	00 00 00 
+  80439c:	ff d0                	call   *%rax
+}
+  80439e:	c9                   	leave
+  80439f:	c3                   	ret
+
+00000000008043a0 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8043a0:	55                   	push   %rbp
+  8043a1:	48 89 e5             	mov    %rsp,%rbp
+  8043a4:	41 56                	push   %r14
+  8043a6:	41 55                	push   %r13
+  8043a8:	41 54                	push   %r12
+  8043aa:	53                   	push   %rbx
+  8043ab:	48 83 ec 50          	sub    $0x50,%rsp
+  8043af:	49 89 fc             	mov    %rdi,%r12
+  8043b2:	41 89 f5             	mov    %esi,%r13d
+  8043b5:	48 89 d3             	mov    %rdx,%rbx
+  8043b8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8043bc:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8043c0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8043c4:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8043cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8043cf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8043d3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8043d7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8043db:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8043e2:	00 00 00 
+  8043e5:	4c 8b 30             	mov    (%rax),%r14
+  8043e8:	48 b8 ff 12 80 00 00 	movabs $0x8012ff,%rax
+  8043ef:	00 00 00 
+  8043f2:	ff d0                	call   *%rax
+  8043f4:	89 c6                	mov    %eax,%esi
+  8043f6:	45 89 e8             	mov    %r13d,%r8d
+  8043f9:	4c 89 e1             	mov    %r12,%rcx
+  8043fc:	4c 89 f2             	mov    %r14,%rdx
+  8043ff:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  804406:	00 00 00 
+  804409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80440e:	49 bc e7 02 80 00 00 	movabs $0x8002e7,%r12
+  804415:	00 00 00 
+  804418:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80441b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80441f:	48 89 df             	mov    %rbx,%rdi
+  804422:	48 b8 83 02 80 00 00 	movabs $0x800283,%rax
+  804429:	00 00 00 
+  80442c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80442e:	48 bf 10 50 80 00 00 	movabs $0x805010,%rdi
+  804435:	00 00 00 
+  804438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80443d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804440:	cc                   	int3
+  804441:	eb fd                	jmp    804440 <_panic+0xa0>
+
+0000000000804443 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804443:	55                   	push   %rbp
+  804444:	48 89 e5             	mov    %rsp,%rbp
+  804447:	41 55                	push   %r13
+  804449:	41 54                	push   %r12
+  80444b:	53                   	push   %rbx
+  80444c:	48 83 ec 08          	sub    $0x8,%rsp
+  804450:	49 89 fc             	mov    %rdi,%r12
+  804453:	48 89 f7             	mov    %rsi,%rdi
+  804456:	48 89 d3             	mov    %rdx,%rbx
+  804459:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80445c:	48 85 f6             	test   %rsi,%rsi
+  80445f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804466:	00 00 00 
+  804469:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80446d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804472:	48 85 d2             	test   %rdx,%rdx
+  804475:	74 03                	je     80447a <ipc_recv+0x37>
+  804477:	48 8b 32             	mov    (%rdx),%rsi
+  80447a:	48 b8 6c 17 80 00 00 	movabs $0x80176c,%rax
+  804481:	00 00 00 
+  804484:	ff d0                	call   *%rax
+    if (errno) {
+  804486:	85 c0                	test   %eax,%eax
+  804488:	74 1c                	je     8044a6 <ipc_recv+0x63>
+        if (from_env_store)
+  80448a:	4d 85 e4             	test   %r12,%r12
+  80448d:	74 08                	je     804497 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80448f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804496:	00 
+
+        if (perm_store)
+  804497:	4d 85 ed             	test   %r13,%r13
+  80449a:	74 74                	je     804510 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80449c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8044a3:	00 
+  8044a4:	eb 6a                	jmp    804510 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8044a6:	4d 85 e4             	test   %r12,%r12
+  8044a9:	74 14                	je     8044bf <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8044ab:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044b2:	00 00 00 
+  8044b5:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8044bb:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  8044bf:	48 85 db             	test   %rbx,%rbx
+  8044c2:	74 23                	je     8044e7 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8044c4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044cb:	00 00 00 
+  8044ce:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8044d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044d9:	85 c9                	test   %ecx,%ecx
+  8044db:	74 07                	je     8044e4 <ipc_recv+0xa1>
+  8044dd:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8044e4:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8044e7:	4d 85 ed             	test   %r13,%r13
+  8044ea:	74 14                	je     804500 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8044ec:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044f3:	00 00 00 
+  8044f6:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8044fc:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804500:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804507:	00 00 00 
+  80450a:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804510:	48 83 c4 08          	add    $0x8,%rsp
+  804514:	5b                   	pop    %rbx
+  804515:	41 5c                	pop    %r12
+  804517:	41 5d                	pop    %r13
+  804519:	5d                   	pop    %rbp
+  80451a:	c3                   	ret
+
+000000000080451b <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80451b:	55                   	push   %rbp
+  80451c:	48 89 e5             	mov    %rsp,%rbp
+  80451f:	41 55                	push   %r13
+  804521:	41 54                	push   %r12
+  804523:	53                   	push   %rbx
+  804524:	48 83 ec 08          	sub    $0x8,%rsp
+  804528:	49 89 fc             	mov    %rdi,%r12
+  80452b:	48 89 f7             	mov    %rsi,%rdi
+  80452e:	48 89 d3             	mov    %rdx,%rbx
+  804531:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804534:	48 85 f6             	test   %rsi,%rsi
+  804537:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80453e:	00 00 00 
+  804541:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804545:	be 00 10 00 00       	mov    $0x1000,%esi
+  80454a:	48 85 d2             	test   %rdx,%rdx
+  80454d:	74 03                	je     804552 <ipc_try_recv+0x37>
+  80454f:	48 8b 32             	mov    (%rdx),%rsi
+  804552:	48 b8 d5 17 80 00 00 	movabs $0x8017d5,%rax
+  804559:	00 00 00 
+  80455c:	ff d0                	call   *%rax
+    if (errno) {
+  80455e:	85 c0                	test   %eax,%eax
+  804560:	75 75                	jne    8045d7 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804562:	4d 85 e4             	test   %r12,%r12
+  804565:	74 14                	je     80457b <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804567:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80456e:	00 00 00 
+  804571:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804577:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80457b:	48 85 db             	test   %rbx,%rbx
+  80457e:	74 23                	je     8045a3 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804580:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804587:	00 00 00 
+  80458a:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804590:	ba 00 00 00 00       	mov    $0x0,%edx
+  804595:	85 c9                	test   %ecx,%ecx
+  804597:	74 07                	je     8045a0 <ipc_try_recv+0x85>
+  804599:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8045a0:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8045a3:	4d 85 ed             	test   %r13,%r13
+  8045a6:	74 14                	je     8045bc <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8045a8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8045af:	00 00 00 
+  8045b2:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8045b8:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8045bc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8045c3:	00 00 00 
+  8045c6:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  8045cc:	48 83 c4 08          	add    $0x8,%rsp
+  8045d0:	5b                   	pop    %rbx
+  8045d1:	41 5c                	pop    %r12
+  8045d3:	41 5d                	pop    %r13
+  8045d5:	5d                   	pop    %rbp
+  8045d6:	c3                   	ret
+        if (from_env_store)
+  8045d7:	4d 85 e4             	test   %r12,%r12
+  8045da:	74 08                	je     8045e4 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8045dc:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045e3:	00 
+        if (perm_store)
+  8045e4:	4d 85 ed             	test   %r13,%r13
+  8045e7:	74 e3                	je     8045cc <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8045e9:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045f0:	00 
+  8045f1:	eb d9                	jmp    8045cc <ipc_try_recv+0xb1>
+
+00000000008045f3 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045f3:	55                   	push   %rbp
+  8045f4:	48 89 e5             	mov    %rsp,%rbp
+  8045f7:	41 57                	push   %r15
+  8045f9:	41 56                	push   %r14
+  8045fb:	41 55                	push   %r13
+  8045fd:	41 54                	push   %r12
+  8045ff:	53                   	push   %rbx
+  804600:	48 83 ec 18          	sub    $0x18,%rsp
+  804604:	41 89 fd             	mov    %edi,%r13d
+  804607:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80460a:	48 89 d3             	mov    %rdx,%rbx
+  80460d:	49 89 cc             	mov    %rcx,%r12
+  804610:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804614:	48 85 d2             	test   %rdx,%rdx
+  804617:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80461e:	00 00 00 
+  804621:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804625:	49 be 40 17 80 00 00 	movabs $0x801740,%r14
+  80462c:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  80462f:	49 bf 30 13 80 00 00 	movabs $0x801330,%r15
+  804636:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804639:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80463c:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804640:	4c 89 e1             	mov    %r12,%rcx
+  804643:	48 89 da             	mov    %rbx,%rdx
+  804646:	44 89 ef             	mov    %r13d,%edi
+  804649:	41 ff d6             	call   *%r14
+  80464c:	85 c0                	test   %eax,%eax
+  80464e:	74 37                	je     804687 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804650:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804653:	75 05                	jne    80465a <ipc_send+0x67>
+        sys_yield();
+  804655:	41 ff d7             	call   *%r15
+  804658:	eb df                	jmp    804639 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80465a:	89 c1                	mov    %eax,%ecx
+  80465c:	48 ba 43 57 80 00 00 	movabs $0x805743,%rdx
+  804663:	00 00 00 
+  804666:	be 65 00 00 00       	mov    $0x65,%esi
+  80466b:	48 bf 5e 57 80 00 00 	movabs $0x80575e,%rdi
+  804672:	00 00 00 
+  804675:	b8 00 00 00 00       	mov    $0x0,%eax
+  80467a:	49 b8 a0 43 80 00 00 	movabs $0x8043a0,%r8
+  804681:	00 00 00 
+  804684:	41 ff d0             	call   *%r8
+    }
+}
+  804687:	48 83 c4 18          	add    $0x18,%rsp
+  80468b:	5b                   	pop    %rbx
+  80468c:	41 5c                	pop    %r12
+  80468e:	41 5d                	pop    %r13
+  804690:	41 5e                	pop    %r14
+  804692:	41 5f                	pop    %r15
+  804694:	5d                   	pop    %rbp
+  804695:	c3                   	ret
+
+0000000000804696 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804696:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80469b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8046a2:	00 00 00 
+  8046a5:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8046ac:	48 01 ca             	add    %rcx,%rdx
+  8046af:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8046b5:	39 fa                	cmp    %edi,%edx
+  8046b7:	74 12                	je     8046cb <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8046b9:	48 83 c0 01          	add    $0x1,%rax
+  8046bd:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8046c3:	75 e0                	jne    8046a5 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8046c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046ca:	c3                   	ret
+            return envs[i].env_id;
+  8046cb:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8046d2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046d9:	00 00 00 
+  8046dc:	48 01 d0             	add    %rdx,%rax
+  8046df:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046e5:	c3                   	ret
+
+00000000008046e6 <__text_end>:
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
@@ -0,0 +1,8271 @@
+
+obj/user/memlayout:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 52 03 00 00       	call   800375 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <memlayout>:
+#ifndef PROT_SHARE
+#define PROT_SHARE 0x400
+#endif
+
+void
+memlayout(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 48          	sub    $0x48,%rsp
+    size_t total_p = 0;
+    size_t total_u = 0;
+    size_t total_w = 0;
+    size_t total_cow = 0;
+
+    cprintf("EID: %d, PEID: %d\n", thisenv->env_id, thisenv->env_parent_id);
+  800036:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80003d:	00 00 00 
+  800040:	49 8b 04 24          	mov    (%r12),%rax
+  800044:	8b 90 cc 00 00 00    	mov    0xcc(%rax),%edx
+  80004a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800050:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800057:	00 00 00 
+  80005a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005f:	48 bb 91 05 80 00 00 	movabs $0x800591,%rbx
+  800066:	00 00 00 
+  800069:	ff d3                	call   *%rbx
+    cprintf("pml4=%p uvpml4=%p uvpdp=%p uvpd=%p uvpt=%p\n", thisenv->address_space.pml4,
+  80006b:	49 8b 04 24          	mov    (%r12),%rax
+  80006f:	48 8b b0 e8 00 00 00 	mov    0xe8(%rax),%rsi
+  800076:	49 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%r9
+  80007d:	7f 00 00 
+  800080:	49 b8 00 00 00 00 80 	movabs $0x7f8000000000,%r8
+  800087:	7f 00 00 
+  80008a:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  800091:	7f 00 00 
+  800094:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80009b:	7f 00 00 
+  80009e:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  8000a5:	00 00 00 
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	ff d3                	call   *%rbx
+    size_t total_cow = 0;
+  8000af:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8000b6:	00 
+    size_t total_w = 0;
+  8000b7:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8000be:	00 
+    size_t total_u = 0;
+  8000bf:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8000c6:	00 
+    size_t total_p = 0;
+  8000c7:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8000ce:	00 
+            (void *)UVPML4, (void *)UVPDP, (void *)UVPT, (void *)UVPD);
+
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  8000cf:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        pte_t ent = get_uvpt_entry((void *)addr);
+  8000d5:	49 bd 96 3e 80 00 00 	movabs $0x803e96,%r13
+  8000dc:	00 00 00 
+        if (ent) {
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000df:	49 bc 35 50 80 00 00 	movabs $0x805035,%r12
+  8000e6:	00 00 00 
+  8000e9:	eb 5f                	jmp    80014a <memlayout+0x125>
+                    (void *)get_uvpt_entry((void *)addr), (unsigned long)addr, (unsigned long)ent,
+  8000eb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8000ef:	41 ff d5             	call   *%r13
+  8000f2:	48 89 c6             	mov    %rax,%rsi
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8000f9:	41 57                	push   %r15
+  8000fb:	ff 75 c0             	push   -0x40(%rbp)
+  8000fe:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800101:	50                   	push   %rax
+  800102:	44 8b 4d b8          	mov    -0x48(%rbp),%r9d
+  800106:	44 8b 45 b4          	mov    -0x4c(%rbp),%r8d
+  80010a:	48 89 d9             	mov    %rbx,%rcx
+  80010d:	4c 89 f2             	mov    %r14,%rdx
+  800110:	48 bf e8 50 80 00 00 	movabs $0x8050e8,%rdi
+  800117:	00 00 00 
+  80011a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011f:	49 ba 91 05 80 00 00 	movabs $0x800591,%r10
+  800126:	00 00 00 
+  800129:	41 ff d2             	call   *%r10
+  80012c:	48 83 c4 20          	add    $0x20,%rsp
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  800130:	49 81 c6 00 10 00 00 	add    $0x1000,%r14
+  800137:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80013e:	00 00 00 
+  800141:	49 39 c6             	cmp    %rax,%r14
+  800144:	0f 84 8f 00 00 00    	je     8001d9 <memlayout+0x1b4>
+        pte_t ent = get_uvpt_entry((void *)addr);
+  80014a:	4c 89 75 c8          	mov    %r14,-0x38(%rbp)
+  80014e:	4c 89 f7             	mov    %r14,%rdi
+  800151:	41 ff d5             	call   *%r13
+  800154:	48 89 c3             	mov    %rax,%rbx
+        if (ent) {
+  800157:	48 85 c0             	test   %rax,%rax
+  80015a:	74 d4                	je     800130 <memlayout+0x10b>
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80015c:	a8 40                	test   $0x40,%al
+  80015e:	49 bf 00 50 80 00 00 	movabs $0x805000,%r15
+  800165:	00 00 00 
+  800168:	4d 0f 44 fc          	cmove  %r12,%r15
+  80016c:	4c 89 65 c0          	mov    %r12,-0x40(%rbp)
+  800170:	f6 c4 08             	test   $0x8,%ah
+  800173:	74 13                	je     800188 <memlayout+0x163>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+                    (ent & PROT_COW) ? total_cow++, " COW" : "",
+  800175:	48 83 45 90 01       	addq   $0x1,-0x70(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80017a:	48 b8 07 50 80 00 00 	movabs $0x805007,%rax
+  800181:	00 00 00 
+  800184:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800188:	c7 45 bc 2d 00 00 00 	movl   $0x2d,-0x44(%rbp)
+  80018f:	f6 c3 02             	test   $0x2,%bl
+  800192:	74 0c                	je     8001a0 <memlayout+0x17b>
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+  800194:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  800199:	c7 45 bc 57 00 00 00 	movl   $0x57,-0x44(%rbp)
+  8001a0:	c7 45 b8 2d 00 00 00 	movl   $0x2d,-0x48(%rbp)
+  8001a7:	f6 c3 04             	test   $0x4,%bl
+  8001aa:	74 0c                	je     8001b8 <memlayout+0x193>
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+  8001ac:	48 83 45 a0 01       	addq   $0x1,-0x60(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001b1:	c7 45 b8 55 00 00 00 	movl   $0x55,-0x48(%rbp)
+  8001b8:	c7 45 b4 2d 00 00 00 	movl   $0x2d,-0x4c(%rbp)
+  8001bf:	f6 c3 01             	test   $0x1,%bl
+  8001c2:	0f 84 23 ff ff ff    	je     8000eb <memlayout+0xc6>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+  8001c8:	48 83 45 a8 01       	addq   $0x1,-0x58(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001cd:	c7 45 b4 50 00 00 00 	movl   $0x50,-0x4c(%rbp)
+  8001d4:	e9 12 ff ff ff       	jmp    8000eb <memlayout+0xc6>
+                    (ent & PROT_SHARE) ? " SHARE" : "");
+        }
+    }
+
+    cprintf("Memory usage summary:\n");
+  8001d9:	48 bf 1f 50 80 00 00 	movabs $0x80501f,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 bb 91 05 80 00 00 	movabs $0x800591,%rbx
+  8001ef:	00 00 00 
+  8001f2:	ff d3                	call   *%rbx
+    cprintf("  PTE_P: %lu\n", (unsigned long)total_p);
+  8001f4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8001f8:	48 bf 36 50 80 00 00 	movabs $0x805036,%rdi
+  8001ff:	00 00 00 
+  800202:	b8 00 00 00 00       	mov    $0x0,%eax
+  800207:	ff d3                	call   *%rbx
+    cprintf("  PTE_U: %lu\n", (unsigned long)total_u);
+  800209:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80020d:	48 bf 44 50 80 00 00 	movabs $0x805044,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	ff d3                	call   *%rbx
+    cprintf("  PTE_W: %lu\n", (unsigned long)total_w);
+  80021e:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+  800222:	48 bf 52 50 80 00 00 	movabs $0x805052,%rdi
+  800229:	00 00 00 
+  80022c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800231:	ff d3                	call   *%rbx
+    cprintf("  PTE_COW: %lu\n", (unsigned long)total_cow);
+  800233:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800237:	48 bf 60 50 80 00 00 	movabs $0x805060,%rdi
+  80023e:	00 00 00 
+  800241:	b8 00 00 00 00       	mov    $0x0,%eax
+  800246:	ff d3                	call   *%rbx
+}
+  800248:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80024c:	5b                   	pop    %rbx
+  80024d:	41 5c                	pop    %r12
+  80024f:	41 5d                	pop    %r13
+  800251:	41 5e                	pop    %r14
+  800253:	41 5f                	pop    %r15
+  800255:	5d                   	pop    %rbp
+  800256:	c3                   	ret
+
+0000000000800257 <umain>:
+
+void
+umain(int argc, char *argv[]) {
+  800257:	55                   	push   %rbp
+  800258:	48 89 e5             	mov    %rsp,%rbp
+  80025b:	41 54                	push   %r12
+  80025d:	53                   	push   %rbx
+  80025e:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t ceid;
+    int pipefd[2];
+    int res;
+
+    memlayout();
+  800262:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+
+    res = pipe(pipefd);
+  80026e:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  800272:	48 b8 37 3c 80 00 00 	movabs $0x803c37,%rax
+  800279:	00 00 00 
+  80027c:	ff d0                	call   *%rax
+    if (res < 0) panic("pipe() failed\n");
+  80027e:	85 c0                	test   %eax,%eax
+  800280:	78 46                	js     8002c8 <umain+0x71>
+    ceid = fork();
+  800282:	48 b8 7f 20 80 00 00 	movabs $0x80207f,%rax
+  800289:	00 00 00 
+  80028c:	ff d0                	call   *%rax
+    if (ceid < 0) panic("fork() failed\n");
+  80028e:	85 c0                	test   %eax,%eax
+  800290:	78 60                	js     8002f2 <umain+0x9b>
+
+    if (!ceid) {
+  800292:	0f 84 84 00 00 00    	je     80031c <umain+0xc5>
+        cprintf("==== Child\n");
+        memlayout();
+        return;
+    }
+
+    cprintf("==== Parent\n");
+  800298:	48 bf ab 50 80 00 00 	movabs $0x8050ab,%rdi
+  80029f:	00 00 00 
+  8002a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a7:	48 ba 91 05 80 00 00 	movabs $0x800591,%rdx
+  8002ae:	00 00 00 
+  8002b1:	ff d2                	call   *%rdx
+    memlayout();
+  8002b3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002ba:	00 00 00 
+  8002bd:	ff d0                	call   *%rax
+}
+  8002bf:	48 83 c4 10          	add    $0x10,%rsp
+  8002c3:	5b                   	pop    %rbx
+  8002c4:	41 5c                	pop    %r12
+  8002c6:	5d                   	pop    %rbp
+  8002c7:	c3                   	ret
+    if (res < 0) panic("pipe() failed\n");
+  8002c8:	48 ba 70 50 80 00 00 	movabs $0x805070,%rdx
+  8002cf:	00 00 00 
+  8002d2:	be 33 00 00 00       	mov    $0x33,%esi
+  8002d7:	48 bf 7f 50 80 00 00 	movabs $0x80507f,%rdi
+  8002de:	00 00 00 
+  8002e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e6:	48 b9 41 04 80 00 00 	movabs $0x800441,%rcx
+  8002ed:	00 00 00 
+  8002f0:	ff d1                	call   *%rcx
+    if (ceid < 0) panic("fork() failed\n");
+  8002f2:	48 ba 90 50 80 00 00 	movabs $0x805090,%rdx
+  8002f9:	00 00 00 
+  8002fc:	be 35 00 00 00       	mov    $0x35,%esi
+  800301:	48 bf 7f 50 80 00 00 	movabs $0x80507f,%rdi
+  800308:	00 00 00 
+  80030b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800310:	48 b9 41 04 80 00 00 	movabs $0x800441,%rcx
+  800317:	00 00 00 
+  80031a:	ff d1                	call   *%rcx
+        cprintf("\n");
+  80031c:	48 bf 34 50 80 00 00 	movabs $0x805034,%rdi
+  800323:	00 00 00 
+  800326:	48 ba 91 05 80 00 00 	movabs $0x800591,%rdx
+  80032d:	00 00 00 
+  800330:	ff d2                	call   *%rdx
+  800332:	bb 00 90 01 00       	mov    $0x19000,%ebx
+            sys_yield();
+  800337:	49 bc da 15 80 00 00 	movabs $0x8015da,%r12
+  80033e:	00 00 00 
+  800341:	41 ff d4             	call   *%r12
+        for (i = 0; i < 102400; i++)
+  800344:	83 eb 01             	sub    $0x1,%ebx
+  800347:	75 f8                	jne    800341 <umain+0xea>
+        cprintf("==== Child\n");
+  800349:	48 bf 9f 50 80 00 00 	movabs $0x80509f,%rdi
+  800350:	00 00 00 
+  800353:	b8 00 00 00 00       	mov    $0x0,%eax
+  800358:	48 ba 91 05 80 00 00 	movabs $0x800591,%rdx
+  80035f:	00 00 00 
+  800362:	ff d2                	call   *%rdx
+        memlayout();
+  800364:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80036b:	00 00 00 
+  80036e:	ff d0                	call   *%rax
+        return;
+  800370:	e9 4a ff ff ff       	jmp    8002bf <umain+0x68>
+
+0000000000800375 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800375:	55                   	push   %rbp
+  800376:	48 89 e5             	mov    %rsp,%rbp
+  800379:	41 56                	push   %r14
+  80037b:	41 55                	push   %r13
+  80037d:	41 54                	push   %r12
+  80037f:	53                   	push   %rbx
+  800380:	41 89 fd             	mov    %edi,%r13d
+  800383:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800386:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80038d:	00 00 00 
+  800390:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800397:	00 00 00 
+  80039a:	48 39 c2             	cmp    %rax,%rdx
+  80039d:	73 17                	jae    8003b6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80039f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a2:	49 89 c4             	mov    %rax,%r12
+  8003a5:	48 83 c3 08          	add    $0x8,%rbx
+  8003a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ae:	ff 53 f8             	call   *-0x8(%rbx)
+  8003b1:	4c 39 e3             	cmp    %r12,%rbx
+  8003b4:	72 ef                	jb     8003a5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003b6:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  8003bd:	00 00 00 
+  8003c0:	ff d0                	call   *%rax
+  8003c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003c7:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8003ce:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003d5:	00 00 00 
+  8003d8:	48 01 d0             	add    %rdx,%rax
+  8003db:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8003e2:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003e5:	45 85 ed             	test   %r13d,%r13d
+  8003e8:	7e 0d                	jle    8003f7 <libmain+0x82>
+  8003ea:	49 8b 06             	mov    (%r14),%rax
+  8003ed:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003f4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003f7:	4c 89 f6             	mov    %r14,%rsi
+  8003fa:	44 89 ef             	mov    %r13d,%edi
+  8003fd:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  800404:	00 00 00 
+  800407:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800409:	48 b8 1e 04 80 00 00 	movabs $0x80041e,%rax
+  800410:	00 00 00 
+  800413:	ff d0                	call   *%rax
+#endif
+}
+  800415:	5b                   	pop    %rbx
+  800416:	41 5c                	pop    %r12
+  800418:	41 5d                	pop    %r13
+  80041a:	41 5e                	pop    %r14
+  80041c:	5d                   	pop    %rbp
+  80041d:	c3                   	ret
+
+000000000080041e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80041e:	55                   	push   %rbp
+  80041f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800422:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  800429:	00 00 00 
+  80042c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80042e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800433:	48 b8 3e 15 80 00 00 	movabs $0x80153e,%rax
+  80043a:	00 00 00 
+  80043d:	ff d0                	call   *%rax
+}
+  80043f:	5d                   	pop    %rbp
+  800440:	c3                   	ret
+
+0000000000800441 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800441:	55                   	push   %rbp
+  800442:	48 89 e5             	mov    %rsp,%rbp
+  800445:	41 56                	push   %r14
+  800447:	41 55                	push   %r13
+  800449:	41 54                	push   %r12
+  80044b:	53                   	push   %rbx
+  80044c:	48 83 ec 50          	sub    $0x50,%rsp
+  800450:	49 89 fc             	mov    %rdi,%r12
+  800453:	41 89 f5             	mov    %esi,%r13d
+  800456:	48 89 d3             	mov    %rdx,%rbx
+  800459:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80045d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800461:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800465:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80046c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800470:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800474:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800478:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80047c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800483:	00 00 00 
+  800486:	4c 8b 30             	mov    (%rax),%r14
+  800489:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  800490:	00 00 00 
+  800493:	ff d0                	call   *%rax
+  800495:	89 c6                	mov    %eax,%esi
+  800497:	45 89 e8             	mov    %r13d,%r8d
+  80049a:	4c 89 e1             	mov    %r12,%rcx
+  80049d:	4c 89 f2             	mov    %r14,%rdx
+  8004a0:	48 bf 18 51 80 00 00 	movabs $0x805118,%rdi
+  8004a7:	00 00 00 
+  8004aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004af:	49 bc 91 05 80 00 00 	movabs $0x800591,%r12
+  8004b6:	00 00 00 
+  8004b9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004bc:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004c0:	48 89 df             	mov    %rbx,%rdi
+  8004c3:	48 b8 2d 05 80 00 00 	movabs $0x80052d,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004cf:	48 bf 34 50 80 00 00 	movabs $0x805034,%rdi
+  8004d6:	00 00 00 
+  8004d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004de:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004e1:	cc                   	int3
+  8004e2:	eb fd                	jmp    8004e1 <_panic+0xa0>
+
+00000000008004e4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004e4:	55                   	push   %rbp
+  8004e5:	48 89 e5             	mov    %rsp,%rbp
+  8004e8:	53                   	push   %rbx
+  8004e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ed:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004f0:	8b 06                	mov    (%rsi),%eax
+  8004f2:	8d 50 01             	lea    0x1(%rax),%edx
+  8004f5:	89 16                	mov    %edx,(%rsi)
+  8004f7:	48 98                	cltq
+  8004f9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004fe:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800504:	74 0a                	je     800510 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800506:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80050a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80050e:	c9                   	leave
+  80050f:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800510:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800514:	be ff 00 00 00       	mov    $0xff,%esi
+  800519:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  800520:	00 00 00 
+  800523:	ff d0                	call   *%rax
+        state->offset = 0;
+  800525:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80052b:	eb d9                	jmp    800506 <putch+0x22>
+
+000000000080052d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80052d:	55                   	push   %rbp
+  80052e:	48 89 e5             	mov    %rsp,%rbp
+  800531:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800538:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80053b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800542:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80054f:	48 89 f1             	mov    %rsi,%rcx
+  800552:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800559:	48 bf e4 04 80 00 00 	movabs $0x8004e4,%rdi
+  800560:	00 00 00 
+  800563:	48 b8 e1 06 80 00 00 	movabs $0x8006e1,%rax
+  80056a:	00 00 00 
+  80056d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80056f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800576:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80057d:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  800584:	00 00 00 
+  800587:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800589:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80058f:	c9                   	leave
+  800590:	c3                   	ret
+
+0000000000800591 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800591:	55                   	push   %rbp
+  800592:	48 89 e5             	mov    %rsp,%rbp
+  800595:	48 83 ec 50          	sub    $0x50,%rsp
+  800599:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80059d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005a1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005a5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005a9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005ad:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005c0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005c4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005c8:	48 b8 2d 05 80 00 00 	movabs $0x80052d,%rax
+  8005cf:	00 00 00 
+  8005d2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005d4:	c9                   	leave
+  8005d5:	c3                   	ret
+
+00000000008005d6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005d6:	55                   	push   %rbp
+  8005d7:	48 89 e5             	mov    %rsp,%rbp
+  8005da:	41 57                	push   %r15
+  8005dc:	41 56                	push   %r14
+  8005de:	41 55                	push   %r13
+  8005e0:	41 54                	push   %r12
+  8005e2:	53                   	push   %rbx
+  8005e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8005e7:	49 89 fc             	mov    %rdi,%r12
+  8005ea:	49 89 f5             	mov    %rsi,%r13
+  8005ed:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005f1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005f4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005f7:	41 89 cf             	mov    %ecx,%r15d
+  8005fa:	4c 39 fa             	cmp    %r15,%rdx
+  8005fd:	73 5b                	jae    80065a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005ff:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800603:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800607:	85 db                	test   %ebx,%ebx
+  800609:	7e 0e                	jle    800619 <print_num+0x43>
+            putch(padc, put_arg);
+  80060b:	4c 89 ee             	mov    %r13,%rsi
+  80060e:	44 89 f7             	mov    %r14d,%edi
+  800611:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800614:	83 eb 01             	sub    $0x1,%ebx
+  800617:	75 f2                	jne    80060b <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800619:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80061d:	48 b9 4c 51 80 00 00 	movabs $0x80514c,%rcx
+  800624:	00 00 00 
+  800627:	48 b8 3b 51 80 00 00 	movabs $0x80513b,%rax
+  80062e:	00 00 00 
+  800631:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800635:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800639:	ba 00 00 00 00       	mov    $0x0,%edx
+  80063e:	49 f7 f7             	div    %r15
+  800641:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800645:	4c 89 ee             	mov    %r13,%rsi
+  800648:	41 ff d4             	call   *%r12
+}
+  80064b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80064f:	5b                   	pop    %rbx
+  800650:	41 5c                	pop    %r12
+  800652:	41 5d                	pop    %r13
+  800654:	41 5e                	pop    %r14
+  800656:	41 5f                	pop    %r15
+  800658:	5d                   	pop    %rbp
+  800659:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80065a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80065e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800663:	49 f7 f7             	div    %r15
+  800666:	48 83 ec 08          	sub    $0x8,%rsp
+  80066a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80066e:	52                   	push   %rdx
+  80066f:	45 0f be c9          	movsbl %r9b,%r9d
+  800673:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800677:	48 89 c2             	mov    %rax,%rdx
+  80067a:	48 b8 d6 05 80 00 00 	movabs $0x8005d6,%rax
+  800681:	00 00 00 
+  800684:	ff d0                	call   *%rax
+  800686:	48 83 c4 10          	add    $0x10,%rsp
+  80068a:	eb 8d                	jmp    800619 <print_num+0x43>
+
+000000000080068c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80068c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800690:	48 8b 06             	mov    (%rsi),%rax
+  800693:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800697:	73 0a                	jae    8006a3 <sprintputch+0x17>
+        *state->start++ = ch;
+  800699:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80069d:	48 89 16             	mov    %rdx,(%rsi)
+  8006a0:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006a3:	c3                   	ret
+
+00000000008006a4 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006a4:	55                   	push   %rbp
+  8006a5:	48 89 e5             	mov    %rsp,%rbp
+  8006a8:	48 83 ec 50          	sub    $0x50,%rsp
+  8006ac:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006b0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006b4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006b8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006bf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006cf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006d3:	48 b8 e1 06 80 00 00 	movabs $0x8006e1,%rax
+  8006da:	00 00 00 
+  8006dd:	ff d0                	call   *%rax
+}
+  8006df:	c9                   	leave
+  8006e0:	c3                   	ret
+
+00000000008006e1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006e1:	55                   	push   %rbp
+  8006e2:	48 89 e5             	mov    %rsp,%rbp
+  8006e5:	41 57                	push   %r15
+  8006e7:	41 56                	push   %r14
+  8006e9:	41 55                	push   %r13
+  8006eb:	41 54                	push   %r12
+  8006ed:	53                   	push   %rbx
+  8006ee:	48 83 ec 38          	sub    $0x38,%rsp
+  8006f2:	49 89 fe             	mov    %rdi,%r14
+  8006f5:	49 89 f5             	mov    %rsi,%r13
+  8006f8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006fb:	48 8b 01             	mov    (%rcx),%rax
+  8006fe:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800702:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800706:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80070e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800712:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800716:	0f b6 3b             	movzbl (%rbx),%edi
+  800719:	40 80 ff 25          	cmp    $0x25,%dil
+  80071d:	74 18                	je     800737 <vprintfmt+0x56>
+            if (!ch) return;
+  80071f:	40 84 ff             	test   %dil,%dil
+  800722:	0f 84 04 07 00 00    	je     800e2c <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800728:	40 0f b6 ff          	movzbl %dil,%edi
+  80072c:	4c 89 ee             	mov    %r13,%rsi
+  80072f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800732:	4c 89 e3             	mov    %r12,%rbx
+  800735:	eb db                	jmp    800712 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800737:	be 00 00 00 00       	mov    $0x0,%esi
+  80073c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800740:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800745:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80074b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800752:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800756:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80075b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800760:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800763:	83 e8 23             	sub    $0x23,%eax
+  800766:	3c 57                	cmp    $0x57,%al
+  800768:	0f 87 a4 06 00 00    	ja     800e12 <vprintfmt+0x731>
+  80076e:	0f b6 c0             	movzbl %al,%eax
+  800771:	48 b9 e0 52 80 00 00 	movabs $0x8052e0,%rcx
+  800778:	00 00 00 
+  80077b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80077e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800781:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800785:	eb cf                	jmp    800756 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800787:	49 89 dc             	mov    %rbx,%r12
+  80078a:	be 01 00 00 00       	mov    $0x1,%esi
+  80078f:	eb c5                	jmp    800756 <vprintfmt+0x75>
+            padc = ch;
+  800791:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800795:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800798:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80079b:	eb b9                	jmp    800756 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80079d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a3:	77 24                	ja     8007c9 <vprintfmt+0xe8>
+  8007a5:	89 c1                	mov    %eax,%ecx
+  8007a7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007ab:	83 c0 08             	add    $0x8,%eax
+  8007ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007b4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007b7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007bb:	79 99                	jns    800756 <vprintfmt+0x75>
+                width = precision;
+  8007bd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007c1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007c7:	eb 8d                	jmp    800756 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007c9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007cd:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d5:	eb da                	jmp    8007b1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007d7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007dc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007e0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007e6:	3c 39                	cmp    $0x39,%al
+  8007e8:	77 1c                	ja     800806 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007ea:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007ee:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007f2:	0f b6 c0             	movzbl %al,%eax
+  8007f5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007fa:	0f b6 03             	movzbl (%rbx),%eax
+  8007fd:	3c 39                	cmp    $0x39,%al
+  8007ff:	76 e9                	jbe    8007ea <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800801:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800804:	eb b1                	jmp    8007b7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800806:	49 89 dc             	mov    %rbx,%r12
+  800809:	eb ac                	jmp    8007b7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80080b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80080e:	85 c9                	test   %ecx,%ecx
+  800810:	b8 00 00 00 00       	mov    $0x0,%eax
+  800815:	0f 49 c1             	cmovns %ecx,%eax
+  800818:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80081b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80081e:	e9 33 ff ff ff       	jmp    800756 <vprintfmt+0x75>
+            lflag++;
+  800823:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800826:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800829:	e9 28 ff ff ff       	jmp    800756 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80082e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800831:	83 f8 2f             	cmp    $0x2f,%eax
+  800834:	77 19                	ja     80084f <vprintfmt+0x16e>
+  800836:	89 c2                	mov    %eax,%edx
+  800838:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083c:	83 c0 08             	add    $0x8,%eax
+  80083f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800842:	8b 3a                	mov    (%rdx),%edi
+  800844:	4c 89 ee             	mov    %r13,%rsi
+  800847:	41 ff d6             	call   *%r14
+            break;
+  80084a:	e9 c3 fe ff ff       	jmp    800712 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80084f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800853:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800857:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085b:	eb e5                	jmp    800842 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80085d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800860:	83 f8 2f             	cmp    $0x2f,%eax
+  800863:	77 5a                	ja     8008bf <vprintfmt+0x1de>
+  800865:	89 c2                	mov    %eax,%edx
+  800867:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086b:	83 c0 08             	add    $0x8,%eax
+  80086e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800871:	8b 02                	mov    (%rdx),%eax
+  800873:	89 c1                	mov    %eax,%ecx
+  800875:	f7 d9                	neg    %ecx
+  800877:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80087a:	83 f9 13             	cmp    $0x13,%ecx
+  80087d:	7f 4e                	jg     8008cd <vprintfmt+0x1ec>
+  80087f:	48 63 c1             	movslq %ecx,%rax
+  800882:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  800889:	00 00 00 
+  80088c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800890:	48 85 c0             	test   %rax,%rax
+  800893:	74 38                	je     8008cd <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800895:	48 89 c1             	mov    %rax,%rcx
+  800898:	48 ba f9 57 80 00 00 	movabs $0x8057f9,%rdx
+  80089f:	00 00 00 
+  8008a2:	4c 89 ee             	mov    %r13,%rsi
+  8008a5:	4c 89 f7             	mov    %r14,%rdi
+  8008a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ad:	49 b8 a4 06 80 00 00 	movabs $0x8006a4,%r8
+  8008b4:	00 00 00 
+  8008b7:	41 ff d0             	call   *%r8
+  8008ba:	e9 53 fe ff ff       	jmp    800712 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cb:	eb a4                	jmp    800871 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008cd:	48 ba 64 51 80 00 00 	movabs $0x805164,%rdx
+  8008d4:	00 00 00 
+  8008d7:	4c 89 ee             	mov    %r13,%rsi
+  8008da:	4c 89 f7             	mov    %r14,%rdi
+  8008dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e2:	49 b8 a4 06 80 00 00 	movabs $0x8006a4,%r8
+  8008e9:	00 00 00 
+  8008ec:	41 ff d0             	call   *%r8
+  8008ef:	e9 1e fe ff ff       	jmp    800712 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fa:	77 36                	ja     800932 <vprintfmt+0x251>
+  8008fc:	89 c2                	mov    %eax,%edx
+  8008fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800902:	83 c0 08             	add    $0x8,%eax
+  800905:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800908:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80090b:	48 85 f6             	test   %rsi,%rsi
+  80090e:	48 b8 5d 51 80 00 00 	movabs $0x80515d,%rax
+  800915:	00 00 00 
+  800918:	48 0f 45 c6          	cmovne %rsi,%rax
+  80091c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800920:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800924:	7e 06                	jle    80092c <vprintfmt+0x24b>
+  800926:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80092a:	75 14                	jne    800940 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80092c:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800930:	eb 5b                	jmp    80098d <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800932:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800936:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093e:	eb c8                	jmp    800908 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800940:	49 63 f7             	movslq %r15d,%rsi
+  800943:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800947:	48 b8 e6 0e 80 00 00 	movabs $0x800ee6,%rax
+  80094e:	00 00 00 
+  800951:	ff d0                	call   *%rax
+  800953:	48 89 c2             	mov    %rax,%rdx
+  800956:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800959:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80095b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80095e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800961:	85 c0                	test   %eax,%eax
+  800963:	7e c7                	jle    80092c <vprintfmt+0x24b>
+  800965:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80096a:	4c 89 ee             	mov    %r13,%rsi
+  80096d:	44 89 e7             	mov    %r12d,%edi
+  800970:	41 ff d6             	call   *%r14
+  800973:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800977:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80097a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80097d:	75 eb                	jne    80096a <vprintfmt+0x289>
+  80097f:	eb ab                	jmp    80092c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800981:	0f b6 f8             	movzbl %al,%edi
+  800984:	4c 89 ee             	mov    %r13,%rsi
+  800987:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  80098a:	4c 89 e2             	mov    %r12,%rdx
+  80098d:	45 85 ff             	test   %r15d,%r15d
+  800990:	78 06                	js     800998 <vprintfmt+0x2b7>
+  800992:	41 83 ef 01          	sub    $0x1,%r15d
+  800996:	78 23                	js     8009bb <vprintfmt+0x2da>
+  800998:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80099c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009a2:	84 c0                	test   %al,%al
+  8009a4:	74 15                	je     8009bb <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009a6:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009aa:	74 d5                	je     800981 <vprintfmt+0x2a0>
+  8009ac:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009af:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009b4:	80 fa 5e             	cmp    $0x5e,%dl
+  8009b7:	77 cb                	ja     800984 <vprintfmt+0x2a3>
+  8009b9:	eb c6                	jmp    800981 <vprintfmt+0x2a0>
+  8009bb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009be:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8009c1:	01 f0                	add    %esi,%eax
+  8009c3:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8009c5:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009c9:	85 c0                	test   %eax,%eax
+  8009cb:	0f 8e 41 fd ff ff    	jle    800712 <vprintfmt+0x31>
+  8009d1:	4c 89 ee             	mov    %r13,%rsi
+  8009d4:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009d9:	41 ff d6             	call   *%r14
+  8009dc:	41 83 ec 01          	sub    $0x1,%r12d
+  8009e0:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009e4:	75 eb                	jne    8009d1 <vprintfmt+0x2f0>
+  8009e6:	e9 27 fd ff ff       	jmp    800712 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8009eb:	40 84 f6             	test   %sil,%sil
+  8009ee:	75 26                	jne    800a16 <vprintfmt+0x335>
+    switch (lflag) {
+  8009f0:	85 d2                	test   %edx,%edx
+  8009f2:	74 59                	je     800a4d <vprintfmt+0x36c>
+  8009f4:	83 fa 01             	cmp    $0x1,%edx
+  8009f7:	74 7b                	je     800a74 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8009f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ff:	0f 87 96 00 00 00    	ja     800a9b <vprintfmt+0x3ba>
+  800a05:	89 c2                	mov    %eax,%edx
+  800a07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0b:	83 c0 08             	add    $0x8,%eax
+  800a0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a11:	4c 8b 22             	mov    (%rdx),%r12
+  800a14:	eb 17                	jmp    800a2d <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800a16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a19:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1c:	77 21                	ja     800a3f <vprintfmt+0x35e>
+  800a1e:	89 c2                	mov    %eax,%edx
+  800a20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a24:	83 c0 08             	add    $0x8,%eax
+  800a27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a2d:	4d 85 e4             	test   %r12,%r12
+  800a30:	78 7a                	js     800aac <vprintfmt+0x3cb>
+            num = i;
+  800a32:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a35:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a3a:	e9 b5 02 00 00       	jmp    800cf4 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4b:	eb dd                	jmp    800a2a <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800a4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a50:	83 f8 2f             	cmp    $0x2f,%eax
+  800a53:	77 11                	ja     800a66 <vprintfmt+0x385>
+  800a55:	89 c2                	mov    %eax,%edx
+  800a57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5b:	83 c0 08             	add    $0x8,%eax
+  800a5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a61:	4c 63 22             	movslq (%rdx),%r12
+  800a64:	eb c7                	jmp    800a2d <vprintfmt+0x34c>
+  800a66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a72:	eb ed                	jmp    800a61 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800a74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a77:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7a:	77 11                	ja     800a8d <vprintfmt+0x3ac>
+  800a7c:	89 c2                	mov    %eax,%edx
+  800a7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a82:	83 c0 08             	add    $0x8,%eax
+  800a85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a88:	4c 8b 22             	mov    (%rdx),%r12
+  800a8b:	eb a0                	jmp    800a2d <vprintfmt+0x34c>
+  800a8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a99:	eb ed                	jmp    800a88 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800a9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa7:	e9 65 ff ff ff       	jmp    800a11 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800aac:	4c 89 ee             	mov    %r13,%rsi
+  800aaf:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ab4:	41 ff d6             	call   *%r14
+                i = -i;
+  800ab7:	49 f7 dc             	neg    %r12
+  800aba:	e9 73 ff ff ff       	jmp    800a32 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800abf:	40 84 f6             	test   %sil,%sil
+  800ac2:	75 32                	jne    800af6 <vprintfmt+0x415>
+    switch (lflag) {
+  800ac4:	85 d2                	test   %edx,%edx
+  800ac6:	74 5d                	je     800b25 <vprintfmt+0x444>
+  800ac8:	83 fa 01             	cmp    $0x1,%edx
+  800acb:	0f 84 82 00 00 00    	je     800b53 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800ad1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad7:	0f 87 a5 00 00 00    	ja     800b82 <vprintfmt+0x4a1>
+  800add:	89 c2                	mov    %eax,%edx
+  800adf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae3:	83 c0 08             	add    $0x8,%eax
+  800ae6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800af1:	e9 fe 01 00 00       	jmp    800cf4 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800af6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af9:	83 f8 2f             	cmp    $0x2f,%eax
+  800afc:	77 19                	ja     800b17 <vprintfmt+0x436>
+  800afe:	89 c2                	mov    %eax,%edx
+  800b00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b04:	83 c0 08             	add    $0x8,%eax
+  800b07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b0d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b12:	e9 dd 01 00 00       	jmp    800cf4 <vprintfmt+0x613>
+  800b17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b23:	eb e5                	jmp    800b0a <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800b25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b28:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2b:	77 18                	ja     800b45 <vprintfmt+0x464>
+  800b2d:	89 c2                	mov    %eax,%edx
+  800b2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b33:	83 c0 08             	add    $0x8,%eax
+  800b36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b39:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b40:	e9 af 01 00 00       	jmp    800cf4 <vprintfmt+0x613>
+  800b45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b51:	eb e6                	jmp    800b39 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800b53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b56:	83 f8 2f             	cmp    $0x2f,%eax
+  800b59:	77 19                	ja     800b74 <vprintfmt+0x493>
+  800b5b:	89 c2                	mov    %eax,%edx
+  800b5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b61:	83 c0 08             	add    $0x8,%eax
+  800b64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b67:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b6a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b6f:	e9 80 01 00 00       	jmp    800cf4 <vprintfmt+0x613>
+  800b74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b80:	eb e5                	jmp    800b67 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800b82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8e:	e9 56 ff ff ff       	jmp    800ae9 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800b93:	40 84 f6             	test   %sil,%sil
+  800b96:	75 2e                	jne    800bc6 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800b98:	85 d2                	test   %edx,%edx
+  800b9a:	0f 84 b3 00 00 00    	je     800c53 <vprintfmt+0x572>
+  800ba0:	83 fa 01             	cmp    $0x1,%edx
+  800ba3:	0f 84 d3 00 00 00    	je     800c7c <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800ba9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bac:	83 f8 2f             	cmp    $0x2f,%eax
+  800baf:	0f 87 f1 00 00 00    	ja     800ca6 <vprintfmt+0x5c5>
+  800bb5:	89 c2                	mov    %eax,%edx
+  800bb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bbb:	83 c0 08             	add    $0x8,%eax
+  800bbe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc1:	48 8b 02             	mov    (%rdx),%rax
+  800bc4:	eb 17                	jmp    800bdd <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bcc:	77 77                	ja     800c45 <vprintfmt+0x564>
+  800bce:	89 c2                	mov    %eax,%edx
+  800bd0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd4:	83 c0 08             	add    $0x8,%eax
+  800bd7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bda:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800bdd:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800bdf:	83 f8 07             	cmp    $0x7,%eax
+  800be2:	0f 8e cf 00 00 00    	jle    800cb7 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800be8:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800bee:	44 89 e7             	mov    %r12d,%edi
+  800bf1:	41 c1 e4 03          	shl    $0x3,%r12d
+  800bf5:	89 d1                	mov    %edx,%ecx
+  800bf7:	8d 72 07             	lea    0x7(%rdx),%esi
+  800bfa:	85 d2                	test   %edx,%edx
+  800bfc:	0f 48 d6             	cmovs  %esi,%edx
+  800bff:	c1 fa 03             	sar    $0x3,%edx
+  800c02:	83 f9 3f             	cmp    $0x3f,%ecx
+  800c05:	7f e7                	jg     800bee <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800c07:	85 ff                	test   %edi,%edi
+  800c09:	0f 84 03 fb ff ff    	je     800712 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800c0f:	49 63 f4             	movslq %r12d,%rsi
+  800c12:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c17:	48 f7 f6             	div    %rsi
+  800c1a:	49 89 d7             	mov    %rdx,%r15
+  800c1d:	83 c0 30             	add    $0x30,%eax
+  800c20:	0f be f8             	movsbl %al,%edi
+  800c23:	4c 89 ee             	mov    %r13,%rsi
+  800c26:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800c29:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800c2c:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800c31:	45 85 e4             	test   %r12d,%r12d
+  800c34:	41 0f 49 d4          	cmovns %r12d,%edx
+  800c38:	c1 fa 03             	sar    $0x3,%edx
+  800c3b:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800c3e:	75 cf                	jne    800c0f <vprintfmt+0x52e>
+  800c40:	e9 cd fa ff ff       	jmp    800712 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800c45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c51:	eb 87                	jmp    800bda <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800c53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c56:	83 f8 2f             	cmp    $0x2f,%eax
+  800c59:	77 13                	ja     800c6e <vprintfmt+0x58d>
+  800c5b:	89 c2                	mov    %eax,%edx
+  800c5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c61:	83 c0 08             	add    $0x8,%eax
+  800c64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c67:	8b 02                	mov    (%rdx),%eax
+  800c69:	e9 6f ff ff ff       	jmp    800bdd <vprintfmt+0x4fc>
+  800c6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c7a:	eb eb                	jmp    800c67 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800c7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c82:	77 14                	ja     800c98 <vprintfmt+0x5b7>
+  800c84:	89 c2                	mov    %eax,%edx
+  800c86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c8a:	83 c0 08             	add    $0x8,%eax
+  800c8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c90:	48 8b 02             	mov    (%rdx),%rax
+  800c93:	e9 45 ff ff ff       	jmp    800bdd <vprintfmt+0x4fc>
+  800c98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca4:	eb ea                	jmp    800c90 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800ca6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800caa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb2:	e9 0a ff ff ff       	jmp    800bc1 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800cb7:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800cbd:	e9 4d ff ff ff       	jmp    800c0f <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800cc2:	4c 89 ee             	mov    %r13,%rsi
+  800cc5:	bf 30 00 00 00       	mov    $0x30,%edi
+  800cca:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ccd:	4c 89 ee             	mov    %r13,%rsi
+  800cd0:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cd5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cd8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cdb:	83 f8 2f             	cmp    $0x2f,%eax
+  800cde:	77 47                	ja     800d27 <vprintfmt+0x646>
+  800ce0:	89 c2                	mov    %eax,%edx
+  800ce2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce6:	83 c0 08             	add    $0x8,%eax
+  800ce9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cef:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cf4:	48 83 ec 08          	sub    $0x8,%rsp
+  800cf8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cfc:	0f 94 c0             	sete   %al
+  800cff:	0f b6 c0             	movzbl %al,%eax
+  800d02:	50                   	push   %rax
+  800d03:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d08:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d0c:	4c 89 ee             	mov    %r13,%rsi
+  800d0f:	4c 89 f7             	mov    %r14,%rdi
+  800d12:	48 b8 d6 05 80 00 00 	movabs $0x8005d6,%rax
+  800d19:	00 00 00 
+  800d1c:	ff d0                	call   *%rax
+            break;
+  800d1e:	48 83 c4 10          	add    $0x10,%rsp
+  800d22:	e9 eb f9 ff ff       	jmp    800712 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d33:	eb b7                	jmp    800cec <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800d35:	40 84 f6             	test   %sil,%sil
+  800d38:	75 2b                	jne    800d65 <vprintfmt+0x684>
+    switch (lflag) {
+  800d3a:	85 d2                	test   %edx,%edx
+  800d3c:	74 56                	je     800d94 <vprintfmt+0x6b3>
+  800d3e:	83 fa 01             	cmp    $0x1,%edx
+  800d41:	74 7f                	je     800dc2 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800d43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d46:	83 f8 2f             	cmp    $0x2f,%eax
+  800d49:	0f 87 a2 00 00 00    	ja     800df1 <vprintfmt+0x710>
+  800d4f:	89 c2                	mov    %eax,%edx
+  800d51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d55:	83 c0 08             	add    $0x8,%eax
+  800d58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d5b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d5e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d63:	eb 8f                	jmp    800cf4 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800d65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d68:	83 f8 2f             	cmp    $0x2f,%eax
+  800d6b:	77 19                	ja     800d86 <vprintfmt+0x6a5>
+  800d6d:	89 c2                	mov    %eax,%edx
+  800d6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d73:	83 c0 08             	add    $0x8,%eax
+  800d76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d79:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d7c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d81:	e9 6e ff ff ff       	jmp    800cf4 <vprintfmt+0x613>
+  800d86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d92:	eb e5                	jmp    800d79 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800d94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d97:	83 f8 2f             	cmp    $0x2f,%eax
+  800d9a:	77 18                	ja     800db4 <vprintfmt+0x6d3>
+  800d9c:	89 c2                	mov    %eax,%edx
+  800d9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800da2:	83 c0 08             	add    $0x8,%eax
+  800da5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da8:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800daa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800daf:	e9 40 ff ff ff       	jmp    800cf4 <vprintfmt+0x613>
+  800db4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc0:	eb e6                	jmp    800da8 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800dc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc5:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc8:	77 19                	ja     800de3 <vprintfmt+0x702>
+  800dca:	89 c2                	mov    %eax,%edx
+  800dcc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dd0:	83 c0 08             	add    $0x8,%eax
+  800dd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dd6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dd9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800dde:	e9 11 ff ff ff       	jmp    800cf4 <vprintfmt+0x613>
+  800de3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800de7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800deb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800def:	eb e5                	jmp    800dd6 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800df1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800df5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800df9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dfd:	e9 59 ff ff ff       	jmp    800d5b <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800e02:	4c 89 ee             	mov    %r13,%rsi
+  800e05:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e0a:	41 ff d6             	call   *%r14
+            break;
+  800e0d:	e9 00 f9 ff ff       	jmp    800712 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e12:	4c 89 ee             	mov    %r13,%rsi
+  800e15:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e1a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e1d:	48 83 eb 01          	sub    $0x1,%rbx
+  800e21:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e25:	75 f6                	jne    800e1d <vprintfmt+0x73c>
+  800e27:	e9 e6 f8 ff ff       	jmp    800712 <vprintfmt+0x31>
+}
+  800e2c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e30:	5b                   	pop    %rbx
+  800e31:	41 5c                	pop    %r12
+  800e33:	41 5d                	pop    %r13
+  800e35:	41 5e                	pop    %r14
+  800e37:	41 5f                	pop    %r15
+  800e39:	5d                   	pop    %rbp
+  800e3a:	c3                   	ret
+
+0000000000800e3b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e3b:	55                   	push   %rbp
+  800e3c:	48 89 e5             	mov    %rsp,%rbp
+  800e3f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e43:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e47:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e4c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e50:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e57:	48 85 ff             	test   %rdi,%rdi
+  800e5a:	74 2b                	je     800e87 <vsnprintf+0x4c>
+  800e5c:	48 85 f6             	test   %rsi,%rsi
+  800e5f:	74 26                	je     800e87 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e61:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e65:	48 bf 8c 06 80 00 00 	movabs $0x80068c,%rdi
+  800e6c:	00 00 00 
+  800e6f:	48 b8 e1 06 80 00 00 	movabs $0x8006e1,%rax
+  800e76:	00 00 00 
+  800e79:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e7f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e82:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e85:	c9                   	leave
+  800e86:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e8c:	eb f7                	jmp    800e85 <vsnprintf+0x4a>
+
+0000000000800e8e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e8e:	55                   	push   %rbp
+  800e8f:	48 89 e5             	mov    %rsp,%rbp
+  800e92:	48 83 ec 50          	sub    $0x50,%rsp
+  800e96:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e9a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e9e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ea2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ea9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ead:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eb1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800eb5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800eb9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ebd:	48 b8 3b 0e 80 00 00 	movabs $0x800e3b,%rax
+  800ec4:	00 00 00 
+  800ec7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ec9:	c9                   	leave
+  800eca:	c3                   	ret
+
+0000000000800ecb <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ecb:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ece:	74 10                	je     800ee0 <strlen+0x15>
+    size_t n = 0;
+  800ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ed5:	48 83 c0 01          	add    $0x1,%rax
+  800ed9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800edd:	75 f6                	jne    800ed5 <strlen+0xa>
+  800edf:	c3                   	ret
+    size_t n = 0;
+  800ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ee5:	c3                   	ret
+
+0000000000800ee6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ee6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ee9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800eee:	48 85 f6             	test   %rsi,%rsi
+  800ef1:	74 11                	je     800f04 <strnlen+0x1e>
+  800ef3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ef7:	74 0c                	je     800f05 <strnlen+0x1f>
+  800ef9:	48 83 c2 01          	add    $0x1,%rdx
+  800efd:	48 39 d0             	cmp    %rdx,%rax
+  800f00:	75 f1                	jne    800ef3 <strnlen+0xd>
+  800f02:	eb 04                	jmp    800f08 <strnlen+0x22>
+  800f04:	c3                   	ret
+  800f05:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f08:	c3                   	ret
+
+0000000000800f09 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f09:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f11:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f15:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f18:	48 83 c2 01          	add    $0x1,%rdx
+  800f1c:	84 c9                	test   %cl,%cl
+  800f1e:	75 f1                	jne    800f11 <strcpy+0x8>
+        ;
+    return res;
+}
+  800f20:	c3                   	ret
+
+0000000000800f21 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f21:	55                   	push   %rbp
+  800f22:	48 89 e5             	mov    %rsp,%rbp
+  800f25:	41 54                	push   %r12
+  800f27:	53                   	push   %rbx
+  800f28:	48 89 fb             	mov    %rdi,%rbx
+  800f2b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f2e:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  800f35:	00 00 00 
+  800f38:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f3a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f3e:	4c 89 e6             	mov    %r12,%rsi
+  800f41:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  800f48:	00 00 00 
+  800f4b:	ff d0                	call   *%rax
+    return dst;
+}
+  800f4d:	48 89 d8             	mov    %rbx,%rax
+  800f50:	5b                   	pop    %rbx
+  800f51:	41 5c                	pop    %r12
+  800f53:	5d                   	pop    %rbp
+  800f54:	c3                   	ret
+
+0000000000800f55 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f55:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f58:	48 85 d2             	test   %rdx,%rdx
+  800f5b:	74 1f                	je     800f7c <strncpy+0x27>
+  800f5d:	48 01 fa             	add    %rdi,%rdx
+  800f60:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f63:	48 83 c1 01          	add    $0x1,%rcx
+  800f67:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f6b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f6f:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f73:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f77:	48 39 ca             	cmp    %rcx,%rdx
+  800f7a:	75 e7                	jne    800f63 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f7c:	c3                   	ret
+
+0000000000800f7d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f7d:	48 89 f8             	mov    %rdi,%rax
+  800f80:	48 85 d2             	test   %rdx,%rdx
+  800f83:	74 24                	je     800fa9 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f85:	48 83 ea 01          	sub    $0x1,%rdx
+  800f89:	74 1b                	je     800fa6 <strlcpy+0x29>
+  800f8b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f8f:	0f b6 16             	movzbl (%rsi),%edx
+  800f92:	84 d2                	test   %dl,%dl
+  800f94:	74 10                	je     800fa6 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f96:	48 83 c6 01          	add    $0x1,%rsi
+  800f9a:	48 83 c0 01          	add    $0x1,%rax
+  800f9e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800fa1:	48 39 c8             	cmp    %rcx,%rax
+  800fa4:	75 e9                	jne    800f8f <strlcpy+0x12>
+        *dst = '\0';
+  800fa6:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800fa9:	48 29 f8             	sub    %rdi,%rax
+}
+  800fac:	c3                   	ret
+
+0000000000800fad <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800fad:	0f b6 07             	movzbl (%rdi),%eax
+  800fb0:	84 c0                	test   %al,%al
+  800fb2:	74 13                	je     800fc7 <strcmp+0x1a>
+  800fb4:	38 06                	cmp    %al,(%rsi)
+  800fb6:	75 0f                	jne    800fc7 <strcmp+0x1a>
+  800fb8:	48 83 c7 01          	add    $0x1,%rdi
+  800fbc:	48 83 c6 01          	add    $0x1,%rsi
+  800fc0:	0f b6 07             	movzbl (%rdi),%eax
+  800fc3:	84 c0                	test   %al,%al
+  800fc5:	75 ed                	jne    800fb4 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fc7:	0f b6 c0             	movzbl %al,%eax
+  800fca:	0f b6 16             	movzbl (%rsi),%edx
+  800fcd:	29 d0                	sub    %edx,%eax
+}
+  800fcf:	c3                   	ret
+
+0000000000800fd0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fd0:	48 85 d2             	test   %rdx,%rdx
+  800fd3:	74 1f                	je     800ff4 <strncmp+0x24>
+  800fd5:	0f b6 07             	movzbl (%rdi),%eax
+  800fd8:	84 c0                	test   %al,%al
+  800fda:	74 1e                	je     800ffa <strncmp+0x2a>
+  800fdc:	3a 06                	cmp    (%rsi),%al
+  800fde:	75 1a                	jne    800ffa <strncmp+0x2a>
+  800fe0:	48 83 c7 01          	add    $0x1,%rdi
+  800fe4:	48 83 c6 01          	add    $0x1,%rsi
+  800fe8:	48 83 ea 01          	sub    $0x1,%rdx
+  800fec:	75 e7                	jne    800fd5 <strncmp+0x5>
+
+    if (!n) return 0;
+  800fee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff3:	c3                   	ret
+  800ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff9:	c3                   	ret
+  800ffa:	48 85 d2             	test   %rdx,%rdx
+  800ffd:	74 09                	je     801008 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fff:	0f b6 07             	movzbl (%rdi),%eax
+  801002:	0f b6 16             	movzbl (%rsi),%edx
+  801005:	29 d0                	sub    %edx,%eax
+  801007:	c3                   	ret
+    if (!n) return 0;
+  801008:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80100d:	c3                   	ret
+
+000000000080100e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80100e:	0f b6 17             	movzbl (%rdi),%edx
+  801011:	84 d2                	test   %dl,%dl
+  801013:	74 18                	je     80102d <strchr+0x1f>
+        if (*str == c) {
+  801015:	0f be d2             	movsbl %dl,%edx
+  801018:	39 f2                	cmp    %esi,%edx
+  80101a:	74 17                	je     801033 <strchr+0x25>
+    for (; *str; str++) {
+  80101c:	48 83 c7 01          	add    $0x1,%rdi
+  801020:	0f b6 17             	movzbl (%rdi),%edx
+  801023:	84 d2                	test   %dl,%dl
+  801025:	75 ee                	jne    801015 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801027:	b8 00 00 00 00       	mov    $0x0,%eax
+  80102c:	c3                   	ret
+  80102d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801032:	c3                   	ret
+  801033:	48 89 f8             	mov    %rdi,%rax
+}
+  801036:	c3                   	ret
+
+0000000000801037 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801037:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80103a:	0f b6 17             	movzbl (%rdi),%edx
+  80103d:	84 d2                	test   %dl,%dl
+  80103f:	74 13                	je     801054 <strfind+0x1d>
+  801041:	0f be d2             	movsbl %dl,%edx
+  801044:	39 f2                	cmp    %esi,%edx
+  801046:	74 0b                	je     801053 <strfind+0x1c>
+  801048:	48 83 c0 01          	add    $0x1,%rax
+  80104c:	0f b6 10             	movzbl (%rax),%edx
+  80104f:	84 d2                	test   %dl,%dl
+  801051:	75 ee                	jne    801041 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801053:	c3                   	ret
+  801054:	c3                   	ret
+
+0000000000801055 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  801055:	55                   	push   %rbp
+  801056:	48 89 e5             	mov    %rsp,%rbp
+  801059:	41 57                	push   %r15
+  80105b:	41 56                	push   %r14
+  80105d:	41 55                	push   %r13
+  80105f:	41 54                	push   %r12
+  801061:	53                   	push   %rbx
+  801062:	48 83 ec 08          	sub    $0x8,%rsp
+  801066:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  801069:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  80106d:	45 84 ed             	test   %r13b,%r13b
+  801070:	75 12                	jne    801084 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  801072:	4c 89 f8             	mov    %r15,%rax
+  801075:	48 83 c4 08          	add    $0x8,%rsp
+  801079:	5b                   	pop    %rbx
+  80107a:	41 5c                	pop    %r12
+  80107c:	41 5d                	pop    %r13
+  80107e:	41 5e                	pop    %r14
+  801080:	41 5f                	pop    %r15
+  801082:	5d                   	pop    %rbp
+  801083:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  801084:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  801088:	4c 89 e7             	mov    %r12,%rdi
+  80108b:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  801092:	00 00 00 
+  801095:	ff d0                	call   *%rax
+  801097:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  80109a:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  80109e:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  8010a2:	49 bf d0 0f 80 00 00 	movabs $0x800fd0,%r15
+  8010a9:	00 00 00 
+				if ((sc = *s++) == 0)
+  8010ac:	84 c0                	test   %al,%al
+  8010ae:	75 14                	jne    8010c4 <strstr+0x6f>
+					return NULL;
+  8010b0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8010b6:	eb ba                	jmp    801072 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  8010b8:	48 83 c3 01          	add    $0x1,%rbx
+  8010bc:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010c0:	84 c0                	test   %al,%al
+  8010c2:	74 1b                	je     8010df <strstr+0x8a>
+			} while (sc != c);
+  8010c4:	41 38 c5             	cmp    %al,%r13b
+  8010c7:	75 ef                	jne    8010b8 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  8010c9:	4c 89 f2             	mov    %r14,%rdx
+  8010cc:	4c 89 e6             	mov    %r12,%rsi
+  8010cf:	48 89 df             	mov    %rbx,%rdi
+  8010d2:	41 ff d7             	call   *%r15
+  8010d5:	85 c0                	test   %eax,%eax
+  8010d7:	75 df                	jne    8010b8 <strstr+0x63>
+  8010d9:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  8010dd:	eb 93                	jmp    801072 <strstr+0x1d>
+					return NULL;
+  8010df:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8010e5:	eb 8b                	jmp    801072 <strstr+0x1d>
+
+00000000008010e7 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  8010e7:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  8010e9:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  8010ec:	8d 57 20             	lea    0x20(%rdi),%edx
+  8010ef:	83 f9 1a             	cmp    $0x1a,%ecx
+  8010f2:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8010f5:	c3                   	ret
+
+00000000008010f6 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  8010f6:	55                   	push   %rbp
+  8010f7:	48 89 e5             	mov    %rsp,%rbp
+  8010fa:	41 57                	push   %r15
+  8010fc:	41 56                	push   %r14
+  8010fe:	41 55                	push   %r13
+  801100:	41 54                	push   %r12
+  801102:	53                   	push   %rbx
+  801103:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  801107:	48 39 f7             	cmp    %rsi,%rdi
+  80110a:	74 49                	je     801155 <strcasecmp+0x5f>
+  80110c:	49 89 fd             	mov    %rdi,%r13
+  80110f:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  801112:	49 bf e7 10 80 00 00 	movabs $0x8010e7,%r15
+  801119:	00 00 00 
+  80111c:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801121:	41 0f b6 fe          	movzbl %r14b,%edi
+  801125:	41 ff d7             	call   *%r15
+  801128:	89 c3                	mov    %eax,%ebx
+  80112a:	49 83 c4 01          	add    $0x1,%r12
+  80112e:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801134:	41 ff d7             	call   *%r15
+  801137:	29 c3                	sub    %eax,%ebx
+  801139:	75 09                	jne    801144 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  80113b:	49 83 c5 01          	add    $0x1,%r13
+  80113f:	45 84 f6             	test   %r14b,%r14b
+  801142:	75 d8                	jne    80111c <strcasecmp+0x26>
+}
+  801144:	89 d8                	mov    %ebx,%eax
+  801146:	48 83 c4 08          	add    $0x8,%rsp
+  80114a:	5b                   	pop    %rbx
+  80114b:	41 5c                	pop    %r12
+  80114d:	41 5d                	pop    %r13
+  80114f:	41 5e                	pop    %r14
+  801151:	41 5f                	pop    %r15
+  801153:	5d                   	pop    %rbp
+  801154:	c3                   	ret
+        return 0;
+  801155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115a:	eb e8                	jmp    801144 <strcasecmp+0x4e>
+
+000000000080115c <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80115c:	55                   	push   %rbp
+  80115d:	48 89 e5             	mov    %rsp,%rbp
+  801160:	41 57                	push   %r15
+  801162:	41 56                	push   %r14
+  801164:	41 55                	push   %r13
+  801166:	41 54                	push   %r12
+  801168:	53                   	push   %rbx
+  801169:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  80116d:	48 85 d2             	test   %rdx,%rdx
+  801170:	74 4f                	je     8011c1 <strncasecmp+0x65>
+  801172:	49 89 fc             	mov    %rdi,%r12
+  801175:	49 89 f5             	mov    %rsi,%r13
+  801178:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  80117c:	49 be e7 10 80 00 00 	movabs $0x8010e7,%r14
+  801183:	00 00 00 
+  801186:	49 83 c4 01          	add    $0x1,%r12
+  80118a:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801190:	41 ff d6             	call   *%r14
+  801193:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  801195:	49 83 c5 01          	add    $0x1,%r13
+  801199:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  80119e:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  8011a1:	29 c3                	sub    %eax,%ebx
+  8011a3:	85 c0                	test   %eax,%eax
+  8011a5:	74 09                	je     8011b0 <strncasecmp+0x54>
+  8011a7:	85 db                	test   %ebx,%ebx
+  8011a9:	75 05                	jne    8011b0 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8011ab:	4d 39 fc             	cmp    %r15,%r12
+  8011ae:	75 d6                	jne    801186 <strncasecmp+0x2a>
+}
+  8011b0:	89 d8                	mov    %ebx,%eax
+  8011b2:	48 83 c4 08          	add    $0x8,%rsp
+  8011b6:	5b                   	pop    %rbx
+  8011b7:	41 5c                	pop    %r12
+  8011b9:	41 5d                	pop    %r13
+  8011bb:	41 5e                	pop    %r14
+  8011bd:	41 5f                	pop    %r15
+  8011bf:	5d                   	pop    %rbp
+  8011c0:	c3                   	ret
+    int d = 0;
+  8011c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  8011c6:	eb e8                	jmp    8011b0 <strncasecmp+0x54>
+
+00000000008011c8 <toupper>:
+
+int toupper(int c) {
+  8011c8:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  8011ca:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  8011cd:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8011d0:	83 f9 1a             	cmp    $0x1a,%ecx
+  8011d3:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8011d6:	c3                   	ret
+
+00000000008011d7 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  8011d7:	83 ff 20             	cmp    $0x20,%edi
+  8011da:	0f 94 c0             	sete   %al
+  8011dd:	0f b6 c0             	movzbl %al,%eax
+}
+  8011e0:	c3                   	ret
+
+00000000008011e1 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  8011e1:	89 f8                	mov    %edi,%eax
+  8011e3:	f7 d8                	neg    %eax
+  8011e5:	0f 48 c7             	cmovs  %edi,%eax
+}
+  8011e8:	c3                   	ret
+
+00000000008011e9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8011e9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8011ec:	48 89 f8             	mov    %rdi,%rax
+  8011ef:	48 f7 d8             	neg    %rax
+  8011f2:	83 e0 07             	and    $0x7,%eax
+  8011f5:	49 89 d1             	mov    %rdx,%r9
+  8011f8:	49 29 c1             	sub    %rax,%r9
+  8011fb:	78 36                	js     801233 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8011fd:	40 0f b6 c6          	movzbl %sil,%eax
+  801201:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801208:	01 01 01 
+  80120b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80120f:	40 f6 c7 07          	test   $0x7,%dil
+  801213:	75 38                	jne    80124d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801215:	4c 89 c9             	mov    %r9,%rcx
+  801218:	48 c1 f9 03          	sar    $0x3,%rcx
+  80121c:	74 0c                	je     80122a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80121e:	fc                   	cld
+  80121f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801222:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801226:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80122a:	4d 85 c9             	test   %r9,%r9
+  80122d:	75 45                	jne    801274 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80122f:	4c 89 c0             	mov    %r8,%rax
+  801232:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801233:	48 85 d2             	test   %rdx,%rdx
+  801236:	74 f7                	je     80122f <memset+0x46>
+  801238:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80123b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80123e:	48 83 c0 01          	add    $0x1,%rax
+  801242:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801246:	48 39 c2             	cmp    %rax,%rdx
+  801249:	75 f3                	jne    80123e <memset+0x55>
+  80124b:	eb e2                	jmp    80122f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80124d:	40 f6 c7 01          	test   $0x1,%dil
+  801251:	74 06                	je     801259 <memset+0x70>
+  801253:	88 07                	mov    %al,(%rdi)
+  801255:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801259:	40 f6 c7 02          	test   $0x2,%dil
+  80125d:	74 07                	je     801266 <memset+0x7d>
+  80125f:	66 89 07             	mov    %ax,(%rdi)
+  801262:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801266:	40 f6 c7 04          	test   $0x4,%dil
+  80126a:	74 a9                	je     801215 <memset+0x2c>
+  80126c:	89 07                	mov    %eax,(%rdi)
+  80126e:	48 83 c7 04          	add    $0x4,%rdi
+  801272:	eb a1                	jmp    801215 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801274:	41 f6 c1 04          	test   $0x4,%r9b
+  801278:	74 06                	je     801280 <memset+0x97>
+  80127a:	89 07                	mov    %eax,(%rdi)
+  80127c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801280:	41 f6 c1 02          	test   $0x2,%r9b
+  801284:	74 07                	je     80128d <memset+0xa4>
+  801286:	66 89 07             	mov    %ax,(%rdi)
+  801289:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80128d:	41 f6 c1 01          	test   $0x1,%r9b
+  801291:	74 9c                	je     80122f <memset+0x46>
+  801293:	88 07                	mov    %al,(%rdi)
+  801295:	eb 98                	jmp    80122f <memset+0x46>
+
+0000000000801297 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801297:	48 89 f8             	mov    %rdi,%rax
+  80129a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80129d:	48 39 fe             	cmp    %rdi,%rsi
+  8012a0:	73 3b                	jae    8012dd <memmove+0x46>
+  8012a2:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8012a6:	48 39 d7             	cmp    %rdx,%rdi
+  8012a9:	73 32                	jae    8012dd <memmove+0x46>
+        s += n;
+        d += n;
+  8012ab:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012af:	48 89 d6             	mov    %rdx,%rsi
+  8012b2:	48 09 fe             	or     %rdi,%rsi
+  8012b5:	48 09 ce             	or     %rcx,%rsi
+  8012b8:	40 f6 c6 07          	test   $0x7,%sil
+  8012bc:	75 12                	jne    8012d0 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8012be:	48 83 ef 08          	sub    $0x8,%rdi
+  8012c2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8012c6:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012ca:	fd                   	std
+  8012cb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012ce:	fc                   	cld
+  8012cf:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012d0:	48 83 ef 01          	sub    $0x1,%rdi
+  8012d4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8012d8:	fd                   	std
+  8012d9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8012db:	eb f1                	jmp    8012ce <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012dd:	48 89 f2             	mov    %rsi,%rdx
+  8012e0:	48 09 c2             	or     %rax,%rdx
+  8012e3:	48 09 ca             	or     %rcx,%rdx
+  8012e6:	f6 c2 07             	test   $0x7,%dl
+  8012e9:	75 0c                	jne    8012f7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8012eb:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012ef:	48 89 c7             	mov    %rax,%rdi
+  8012f2:	fc                   	cld
+  8012f3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8012f6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8012f7:	48 89 c7             	mov    %rax,%rdi
+  8012fa:	fc                   	cld
+  8012fb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8012fd:	c3                   	ret
+
+00000000008012fe <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8012fe:	55                   	push   %rbp
+  8012ff:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801302:	48 b8 97 12 80 00 00 	movabs $0x801297,%rax
+  801309:	00 00 00 
+  80130c:	ff d0                	call   *%rax
+}
+  80130e:	5d                   	pop    %rbp
+  80130f:	c3                   	ret
+
+0000000000801310 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801310:	55                   	push   %rbp
+  801311:	48 89 e5             	mov    %rsp,%rbp
+  801314:	41 57                	push   %r15
+  801316:	41 56                	push   %r14
+  801318:	41 55                	push   %r13
+  80131a:	41 54                	push   %r12
+  80131c:	53                   	push   %rbx
+  80131d:	48 83 ec 08          	sub    $0x8,%rsp
+  801321:	49 89 fe             	mov    %rdi,%r14
+  801324:	49 89 f7             	mov    %rsi,%r15
+  801327:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80132a:	48 89 f7             	mov    %rsi,%rdi
+  80132d:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  801334:	00 00 00 
+  801337:	ff d0                	call   *%rax
+  801339:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80133c:	48 89 de             	mov    %rbx,%rsi
+  80133f:	4c 89 f7             	mov    %r14,%rdi
+  801342:	48 b8 e6 0e 80 00 00 	movabs $0x800ee6,%rax
+  801349:	00 00 00 
+  80134c:	ff d0                	call   *%rax
+  80134e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801351:	48 39 c3             	cmp    %rax,%rbx
+  801354:	74 36                	je     80138c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801356:	48 89 d8             	mov    %rbx,%rax
+  801359:	4c 29 e8             	sub    %r13,%rax
+  80135c:	49 39 c4             	cmp    %rax,%r12
+  80135f:	73 31                	jae    801392 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801361:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801366:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80136a:	4c 89 fe             	mov    %r15,%rsi
+  80136d:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  801374:	00 00 00 
+  801377:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801379:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80137d:	48 83 c4 08          	add    $0x8,%rsp
+  801381:	5b                   	pop    %rbx
+  801382:	41 5c                	pop    %r12
+  801384:	41 5d                	pop    %r13
+  801386:	41 5e                	pop    %r14
+  801388:	41 5f                	pop    %r15
+  80138a:	5d                   	pop    %rbp
+  80138b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80138c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801390:	eb eb                	jmp    80137d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801392:	48 83 eb 01          	sub    $0x1,%rbx
+  801396:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80139a:	48 89 da             	mov    %rbx,%rdx
+  80139d:	4c 89 fe             	mov    %r15,%rsi
+  8013a0:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  8013a7:	00 00 00 
+  8013aa:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8013ac:	49 01 de             	add    %rbx,%r14
+  8013af:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8013b4:	eb c3                	jmp    801379 <strlcat+0x69>
+
+00000000008013b6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8013b6:	48 85 d2             	test   %rdx,%rdx
+  8013b9:	74 2d                	je     8013e8 <memcmp+0x32>
+  8013bb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8013c0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8013c4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013c9:	44 38 c1             	cmp    %r8b,%cl
+  8013cc:	75 0f                	jne    8013dd <memcmp+0x27>
+    while (n-- > 0) {
+  8013ce:	48 83 c0 01          	add    $0x1,%rax
+  8013d2:	48 39 c2             	cmp    %rax,%rdx
+  8013d5:	75 e9                	jne    8013c0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8013d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013dc:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8013dd:	0f b6 c1             	movzbl %cl,%eax
+  8013e0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8013e4:	44 29 c0             	sub    %r8d,%eax
+  8013e7:	c3                   	ret
+    return 0;
+  8013e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ed:	c3                   	ret
+
+00000000008013ee <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8013ee:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8013f2:	48 39 c7             	cmp    %rax,%rdi
+  8013f5:	73 0f                	jae    801406 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8013f7:	40 38 37             	cmp    %sil,(%rdi)
+  8013fa:	74 0e                	je     80140a <memfind+0x1c>
+    for (; src < end; src++) {
+  8013fc:	48 83 c7 01          	add    $0x1,%rdi
+  801400:	48 39 f8             	cmp    %rdi,%rax
+  801403:	75 f2                	jne    8013f7 <memfind+0x9>
+  801405:	c3                   	ret
+  801406:	48 89 f8             	mov    %rdi,%rax
+  801409:	c3                   	ret
+  80140a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80140d:	c3                   	ret
+
+000000000080140e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80140e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801411:	0f b6 37             	movzbl (%rdi),%esi
+  801414:	40 80 fe 20          	cmp    $0x20,%sil
+  801418:	74 06                	je     801420 <strtol+0x12>
+  80141a:	40 80 fe 09          	cmp    $0x9,%sil
+  80141e:	75 13                	jne    801433 <strtol+0x25>
+  801420:	48 83 c7 01          	add    $0x1,%rdi
+  801424:	0f b6 37             	movzbl (%rdi),%esi
+  801427:	40 80 fe 20          	cmp    $0x20,%sil
+  80142b:	74 f3                	je     801420 <strtol+0x12>
+  80142d:	40 80 fe 09          	cmp    $0x9,%sil
+  801431:	74 ed                	je     801420 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801433:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801436:	83 e0 fd             	and    $0xfffffffd,%eax
+  801439:	3c 01                	cmp    $0x1,%al
+  80143b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80143f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801445:	75 0f                	jne    801456 <strtol+0x48>
+  801447:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80144a:	74 14                	je     801460 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80144c:	85 d2                	test   %edx,%edx
+  80144e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801453:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801456:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80145b:	4c 63 ca             	movslq %edx,%r9
+  80145e:	eb 36                	jmp    801496 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801460:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801464:	74 0f                	je     801475 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801466:	85 d2                	test   %edx,%edx
+  801468:	75 ec                	jne    801456 <strtol+0x48>
+        s++;
+  80146a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80146e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801473:	eb e1                	jmp    801456 <strtol+0x48>
+        s += 2;
+  801475:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801479:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80147e:	eb d6                	jmp    801456 <strtol+0x48>
+            dig -= '0';
+  801480:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801483:	44 0f b6 c1          	movzbl %cl,%r8d
+  801487:	41 39 d0             	cmp    %edx,%r8d
+  80148a:	7d 21                	jge    8014ad <strtol+0x9f>
+        val = val * base + dig;
+  80148c:	49 0f af c1          	imul   %r9,%rax
+  801490:	0f b6 c9             	movzbl %cl,%ecx
+  801493:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801496:	48 83 c7 01          	add    $0x1,%rdi
+  80149a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80149e:	80 f9 39             	cmp    $0x39,%cl
+  8014a1:	76 dd                	jbe    801480 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8014a3:	80 f9 7b             	cmp    $0x7b,%cl
+  8014a6:	77 05                	ja     8014ad <strtol+0x9f>
+            dig -= 'a' - 10;
+  8014a8:	83 e9 57             	sub    $0x57,%ecx
+  8014ab:	eb d6                	jmp    801483 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8014ad:	4d 85 d2             	test   %r10,%r10
+  8014b0:	74 03                	je     8014b5 <strtol+0xa7>
+  8014b2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8014b5:	48 89 c2             	mov    %rax,%rdx
+  8014b8:	48 f7 da             	neg    %rdx
+  8014bb:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8014bf:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8014c3:	c3                   	ret
+
+00000000008014c4 <atoi>:
+int atoi(const char *str) {
+  8014c4:	55                   	push   %rbp
+  8014c5:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8014c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d2:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  8014d9:	00 00 00 
+  8014dc:	ff d0                	call   *%rax
+}
+  8014de:	5d                   	pop    %rbp
+  8014df:	c3                   	ret
+
+00000000008014e0 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8014e0:	55                   	push   %rbp
+  8014e1:	48 89 e5             	mov    %rsp,%rbp
+  8014e4:	53                   	push   %rbx
+  8014e5:	48 89 fa             	mov    %rdi,%rdx
+  8014e8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014eb:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801505:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801507:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150b:	c9                   	leave
+  80150c:	c3                   	ret
+
+000000000080150d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80150d:	55                   	push   %rbp
+  80150e:	48 89 e5             	mov    %rsp,%rbp
+  801511:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801512:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801517:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801526:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80152b:	be 00 00 00 00       	mov    $0x0,%esi
+  801530:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801536:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801538:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153c:	c9                   	leave
+  80153d:	c3                   	ret
+
+000000000080153e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80153e:	55                   	push   %rbp
+  80153f:	48 89 e5             	mov    %rsp,%rbp
+  801542:	53                   	push   %rbx
+  801543:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801547:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80154a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80154f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801554:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801559:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155e:	be 00 00 00 00       	mov    $0x0,%esi
+  801563:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801569:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80156b:	48 85 c0             	test   %rax,%rax
+  80156e:	7f 06                	jg     801576 <sys_env_destroy+0x38>
+}
+  801570:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801574:	c9                   	leave
+  801575:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801576:	49 89 c0             	mov    %rax,%r8
+  801579:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80157e:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  801585:	00 00 00 
+  801588:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80158d:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801594:	00 00 00 
+  801597:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159c:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  8015a3:	00 00 00 
+  8015a6:	41 ff d1             	call   *%r9
+
+00000000008015a9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8015a9:	55                   	push   %rbp
+  8015aa:	48 89 e5             	mov    %rsp,%rbp
+  8015ad:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ae:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d2:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d8:	c9                   	leave
+  8015d9:	c3                   	ret
+
+00000000008015da <sys_yield>:
+
+void
+sys_yield(void) {
+  8015da:	55                   	push   %rbp
+  8015db:	48 89 e5             	mov    %rsp,%rbp
+  8015de:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015df:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801603:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801605:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801609:	c9                   	leave
+  80160a:	c3                   	ret
+
+000000000080160b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80160b:	55                   	push   %rbp
+  80160c:	48 89 e5             	mov    %rsp,%rbp
+  80160f:	53                   	push   %rbx
+  801610:	48 89 fa             	mov    %rdi,%rdx
+  801613:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801616:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80161b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801622:	00 00 00 
+  801625:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162a:	be 00 00 00 00       	mov    $0x0,%esi
+  80162f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801635:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801637:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80163b:	c9                   	leave
+  80163c:	c3                   	ret
+
+000000000080163d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80163d:	55                   	push   %rbp
+  80163e:	48 89 e5             	mov    %rsp,%rbp
+  801641:	53                   	push   %rbx
+  801642:	49 89 f8             	mov    %rdi,%r8
+  801645:	48 89 d3             	mov    %rdx,%rbx
+  801648:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80164b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801650:	4c 89 c2             	mov    %r8,%rdx
+  801653:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801656:	be 00 00 00 00       	mov    $0x0,%esi
+  80165b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801661:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801663:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801667:	c9                   	leave
+  801668:	c3                   	ret
+
+0000000000801669 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801669:	55                   	push   %rbp
+  80166a:	48 89 e5             	mov    %rsp,%rbp
+  80166d:	53                   	push   %rbx
+  80166e:	48 83 ec 08          	sub    $0x8,%rsp
+  801672:	89 f8                	mov    %edi,%eax
+  801674:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801677:	48 63 f9             	movslq %ecx,%rdi
+  80167a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80167d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801682:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801685:	be 00 00 00 00       	mov    $0x0,%esi
+  80168a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801690:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801692:	48 85 c0             	test   %rax,%rax
+  801695:	7f 06                	jg     80169d <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801697:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169d:	49 89 c0             	mov    %rax,%r8
+  8016a0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8016a5:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  8016ac:	00 00 00 
+  8016af:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016b4:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  8016bb:	00 00 00 
+  8016be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c3:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  8016ca:	00 00 00 
+  8016cd:	41 ff d1             	call   *%r9
+
+00000000008016d0 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	53                   	push   %rbx
+  8016d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d9:	89 f8                	mov    %edi,%eax
+  8016db:	49 89 f2             	mov    %rsi,%r10
+  8016de:	48 89 cf             	mov    %rcx,%rdi
+  8016e1:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8016e4:	48 63 da             	movslq %edx,%rbx
+  8016e7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ea:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016ef:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f2:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8016f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f7:	48 85 c0             	test   %rax,%rax
+  8016fa:	7f 06                	jg     801702 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801700:	c9                   	leave
+  801701:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801702:	49 89 c0             	mov    %rax,%r8
+  801705:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80170a:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  801711:	00 00 00 
+  801714:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801719:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801720:	00 00 00 
+  801723:	b8 00 00 00 00       	mov    $0x0,%eax
+  801728:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  80172f:	00 00 00 
+  801732:	41 ff d1             	call   *%r9
+
+0000000000801735 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801735:	55                   	push   %rbp
+  801736:	48 89 e5             	mov    %rsp,%rbp
+  801739:	53                   	push   %rbx
+  80173a:	48 83 ec 08          	sub    $0x8,%rsp
+  80173e:	49 89 f9             	mov    %rdi,%r9
+  801741:	89 f0                	mov    %esi,%eax
+  801743:	48 89 d3             	mov    %rdx,%rbx
+  801746:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801749:	49 63 f0             	movslq %r8d,%rsi
+  80174c:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80174f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801754:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801757:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80175d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80175f:	48 85 c0             	test   %rax,%rax
+  801762:	7f 06                	jg     80176a <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801764:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801768:	c9                   	leave
+  801769:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80176a:	49 89 c0             	mov    %rax,%r8
+  80176d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801772:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  801779:	00 00 00 
+  80177c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801781:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801788:	00 00 00 
+  80178b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801790:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  801797:	00 00 00 
+  80179a:	41 ff d1             	call   *%r9
+
+000000000080179d <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  80179d:	55                   	push   %rbp
+  80179e:	48 89 e5             	mov    %rsp,%rbp
+  8017a1:	53                   	push   %rbx
+  8017a2:	89 f8                	mov    %edi,%eax
+  8017a4:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8017a7:	48 63 f9             	movslq %ecx,%rdi
+  8017aa:	48 63 da             	movslq %edx,%rbx
+  8017ad:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017b5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c3:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8017c5:	89 c2                	mov    %eax,%edx
+  8017c7:	48 85 c0             	test   %rax,%rax
+  8017ca:	78 0d                	js     8017d9 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8017cc:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8017d1:	4d 85 c9             	test   %r9,%r9
+  8017d4:	74 03                	je     8017d9 <sys_alloc_dma_region+0x3c>
+  8017d6:	49 89 01             	mov    %rax,(%r9)
+}
+  8017d9:	89 d0                	mov    %edx,%eax
+  8017db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017df:	c9                   	leave
+  8017e0:	c3                   	ret
+
+00000000008017e1 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8017e1:	55                   	push   %rbp
+  8017e2:	48 89 e5             	mov    %rsp,%rbp
+  8017e5:	53                   	push   %rbx
+  8017e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ea:	48 89 f1             	mov    %rsi,%rcx
+  8017ed:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f3:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801802:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801808:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80180a:	48 85 c0             	test   %rax,%rax
+  80180d:	7f 06                	jg     801815 <sys_set_cache_region+0x34>
+}
+  80180f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801813:	c9                   	leave
+  801814:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801815:	49 89 c0             	mov    %rax,%r8
+  801818:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80181d:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  801824:	00 00 00 
+  801827:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80182c:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801833:	00 00 00 
+  801836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183b:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  801842:	00 00 00 
+  801845:	41 ff d1             	call   *%r9
+
+0000000000801848 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801848:	55                   	push   %rbp
+  801849:	48 89 e5             	mov    %rsp,%rbp
+  80184c:	53                   	push   %rbx
+  80184d:	48 83 ec 08          	sub    $0x8,%rsp
+  801851:	48 89 f1             	mov    %rsi,%rcx
+  801854:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801857:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80185a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80185f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801864:	be 00 00 00 00       	mov    $0x0,%esi
+  801869:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80186f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801871:	48 85 c0             	test   %rax,%rax
+  801874:	7f 06                	jg     80187c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801876:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80187a:	c9                   	leave
+  80187b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80187c:	49 89 c0             	mov    %rax,%r8
+  80187f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801884:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  80188b:	00 00 00 
+  80188e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801893:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  80189a:	00 00 00 
+  80189d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a2:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  8018a9:	00 00 00 
+  8018ac:	41 ff d1             	call   *%r9
+
+00000000008018af <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8018af:	55                   	push   %rbp
+  8018b0:	48 89 e5             	mov    %rsp,%rbp
+  8018b3:	53                   	push   %rbx
+  8018b4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8018b8:	48 63 ce             	movslq %esi,%rcx
+  8018bb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018be:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018da:	48 85 c0             	test   %rax,%rax
+  8018dd:	7f 06                	jg     8018e5 <sys_env_set_status+0x36>
+}
+  8018df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018e3:	c9                   	leave
+  8018e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018e5:	49 89 c0             	mov    %rax,%r8
+  8018e8:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8018ed:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  8018f4:	00 00 00 
+  8018f7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018fc:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801903:	00 00 00 
+  801906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190b:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  801912:	00 00 00 
+  801915:	41 ff d1             	call   *%r9
+
+0000000000801918 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801918:	55                   	push   %rbp
+  801919:	48 89 e5             	mov    %rsp,%rbp
+  80191c:	53                   	push   %rbx
+  80191d:	48 83 ec 08          	sub    $0x8,%rsp
+  801921:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801924:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801927:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80192c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801931:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801936:	be 00 00 00 00       	mov    $0x0,%esi
+  80193b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801941:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801943:	48 85 c0             	test   %rax,%rax
+  801946:	7f 06                	jg     80194e <sys_env_set_trapframe+0x36>
+}
+  801948:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80194c:	c9                   	leave
+  80194d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80194e:	49 89 c0             	mov    %rax,%r8
+  801951:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801956:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  80195d:	00 00 00 
+  801960:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801965:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  80196c:	00 00 00 
+  80196f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801974:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  80197b:	00 00 00 
+  80197e:	41 ff d1             	call   *%r9
+
+0000000000801981 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801981:	55                   	push   %rbp
+  801982:	48 89 e5             	mov    %rsp,%rbp
+  801985:	53                   	push   %rbx
+  801986:	48 83 ec 08          	sub    $0x8,%rsp
+  80198a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80198d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801990:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801995:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80199a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80199f:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019ac:	48 85 c0             	test   %rax,%rax
+  8019af:	7f 06                	jg     8019b7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8019b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019b5:	c9                   	leave
+  8019b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019b7:	49 89 c0             	mov    %rax,%r8
+  8019ba:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8019bf:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  8019c6:	00 00 00 
+  8019c9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019ce:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  8019d5:	00 00 00 
+  8019d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019dd:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  8019e4:	00 00 00 
+  8019e7:	41 ff d1             	call   *%r9
+
+00000000008019ea <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019ea:	55                   	push   %rbp
+  8019eb:	48 89 e5             	mov    %rsp,%rbp
+  8019ee:	53                   	push   %rbx
+  8019ef:	89 f8                	mov    %edi,%eax
+  8019f1:	49 89 f1             	mov    %rsi,%r9
+  8019f4:	48 89 d3             	mov    %rdx,%rbx
+  8019f7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019fa:	49 63 f0             	movslq %r8d,%rsi
+  8019fd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a00:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a05:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a0e:	cd 30                	int    $0x30
+}
+  801a10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a14:	c9                   	leave
+  801a15:	c3                   	ret
+
+0000000000801a16 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801a16:	55                   	push   %rbp
+  801a17:	48 89 e5             	mov    %rsp,%rbp
+  801a1a:	53                   	push   %rbx
+  801a1b:	48 83 ec 08          	sub    $0x8,%rsp
+  801a1f:	48 89 fa             	mov    %rdi,%rdx
+  801a22:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a25:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a2f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a34:	be 00 00 00 00       	mov    $0x0,%esi
+  801a39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a3f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a41:	48 85 c0             	test   %rax,%rax
+  801a44:	7f 06                	jg     801a4c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a4a:	c9                   	leave
+  801a4b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a4c:	49 89 c0             	mov    %rax,%r8
+  801a4f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801a54:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  801a5b:	00 00 00 
+  801a5e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a63:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801a6a:	00 00 00 
+  801a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a72:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  801a79:	00 00 00 
+  801a7c:	41 ff d1             	call   *%r9
+
+0000000000801a7f <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801a7f:	55                   	push   %rbp
+  801a80:	48 89 e5             	mov    %rsp,%rbp
+  801a83:	53                   	push   %rbx
+  801a84:	48 89 fa             	mov    %rdi,%rdx
+  801a87:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a8a:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a94:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a99:	be 00 00 00 00       	mov    $0x0,%esi
+  801a9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aa4:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801aa6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aaa:	c9                   	leave
+  801aab:	c3                   	ret
+
+0000000000801aac <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801aac:	55                   	push   %rbp
+  801aad:	48 89 e5             	mov    %rsp,%rbp
+  801ab0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ab1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ab6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801abb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ac0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aca:	be 00 00 00 00       	mov    $0x0,%esi
+  801acf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ad5:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ad7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801adb:	c9                   	leave
+  801adc:	c3                   	ret
+
+0000000000801add <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801add:	48 85 ff             	test   %rdi,%rdi
+  801ae0:	0f 84 b6 01 00 00    	je     801c9c <malloc+0x1bf>
+malloc(size_t size) {
+  801ae6:	55                   	push   %rbp
+  801ae7:	48 89 e5             	mov    %rsp,%rbp
+  801aea:	41 56                	push   %r14
+  801aec:	41 55                	push   %r13
+  801aee:	41 54                	push   %r12
+  801af0:	53                   	push   %rbx
+  801af1:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801af4:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801afb:	00 00 00 
+  801afe:	4c 8b 20             	mov    (%rax),%r12
+  801b01:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801b08:	0f 87 94 01 00 00    	ja     801ca2 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801b0e:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801b15:	00 00 00 
+  801b18:	48 85 c0             	test   %rax,%rax
+  801b1b:	74 6b                	je     801b88 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801b1d:	4d 85 e4             	test   %r12,%r12
+  801b20:	74 66                	je     801b88 <malloc+0xab>
+  801b22:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801b29:	00 00 00 
+  801b2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b31:	eb 0d                	jmp    801b40 <malloc+0x63>
+  801b33:	48 83 c1 01          	add    $0x1,%rcx
+  801b37:	48 83 c2 18          	add    $0x18,%rdx
+  801b3b:	49 39 cc             	cmp    %rcx,%r12
+  801b3e:	74 48                	je     801b88 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801b40:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801b45:	74 ec                	je     801b33 <malloc+0x56>
+  801b47:	48 39 1a             	cmp    %rbx,(%rdx)
+  801b4a:	72 e7                	jb     801b33 <malloc+0x56>
+                real_freep_size--;
+  801b4c:	48 83 e8 01          	sub    $0x1,%rax
+  801b50:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801b57:	00 00 00 
+                freep[i].is_free = false;
+  801b5a:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801b61:	00 00 00 
+  801b64:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801b68:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801b6c:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801b70:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801b77:	00 
+                freep[i].size = size;
+  801b78:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801b7c:	48 01 c8             	add    %rcx,%rax
+  801b7f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b83:	e9 0b 01 00 00       	jmp    801c93 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801b88:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801b8f:	00 00 00 
+  801b92:	48 01 d8             	add    %rbx,%rax
+  801b95:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801b9b:	76 7c                	jbe    801c19 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801b9d:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801ba4:	00 00 00 
+  801ba7:	4c 8b 30             	mov    (%rax),%r14
+  801baa:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801bb1:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801bb4:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801bbb:	00 00 00 
+  801bbe:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801bc5:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801bcc:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801bd2:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801bd6:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  801bdd:	00 00 00 
+  801be0:	ff d0                	call   *%rax
+  801be2:	89 c7                	mov    %eax,%edi
+  801be4:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801beb:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801bf2:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801bf9:	00 00 00 
+  801bfc:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801c00:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801c05:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  801c0c:	00 00 00 
+  801c0f:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801c11:	85 c0                	test   %eax,%eax
+  801c13:	0f 88 90 00 00 00    	js     801ca9 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801c19:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801c20:	00 00 00 
+  801c23:	48 8b 31             	mov    (%rcx),%rsi
+  801c26:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801c2d:	00 00 00 
+  801c30:	4c 8b 07             	mov    (%rdi),%r8
+  801c33:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801c37:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801c3e:	00 00 00 
+  801c41:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801c45:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801c49:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801c50:	00 00 00 
+  801c53:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801c57:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801c5a:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801c5e:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801c65:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801c66:	48 89 d8             	mov    %rbx,%rax
+  801c69:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c6e:	4c 01 c0             	add    %r8,%rax
+  801c71:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801c74:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801c7b:	48 01 f3             	add    %rsi,%rbx
+  801c7e:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801c81:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801c86:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801c8d:	00 00 00 
+  801c90:	48 89 d0             	mov    %rdx,%rax
+}
+  801c93:	5b                   	pop    %rbx
+  801c94:	41 5c                	pop    %r12
+  801c96:	41 5d                	pop    %r13
+  801c98:	41 5e                	pop    %r14
+  801c9a:	5d                   	pop    %rbp
+  801c9b:	c3                   	ret
+        return NULL;
+  801c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ca1:	c3                   	ret
+        return NULL;
+  801ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca7:	eb ea                	jmp    801c93 <malloc+0x1b6>
+            return NULL;
+  801ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cae:	eb e3                	jmp    801c93 <malloc+0x1b6>
+
+0000000000801cb0 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801cb0:	55                   	push   %rbp
+  801cb1:	48 89 e5             	mov    %rsp,%rbp
+  801cb4:	53                   	push   %rbx
+  801cb5:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801cb9:	48 89 fb             	mov    %rdi,%rbx
+  801cbc:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801cc0:	48 89 df             	mov    %rbx,%rdi
+  801cc3:	48 b8 dd 1a 80 00 00 	movabs $0x801add,%rax
+  801cca:	00 00 00 
+  801ccd:	ff d0                	call   *%rax
+  801ccf:	48 89 c7             	mov    %rax,%rdi
+  801cd2:	48 89 da             	mov    %rbx,%rdx
+  801cd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801cda:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  801ce1:	00 00 00 
+  801ce4:	ff d0                	call   *%rax
+}
+  801ce6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cea:	c9                   	leave
+  801ceb:	c3                   	ret
+
+0000000000801cec <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801cec:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801cf3:	00 00 00 
+  801cf6:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801cfd:	00 00 00 
+  801d00:	48 3b 02             	cmp    (%rdx),%rax
+  801d03:	74 4d                	je     801d52 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801d05:	48 85 c0             	test   %rax,%rax
+  801d08:	74 4d                	je     801d57 <get_allocsize+0x6b>
+  801d0a:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801d11:	00 00 00 
+  801d14:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801d19:	48 3b 39             	cmp    (%rcx),%rdi
+  801d1c:	74 13                	je     801d31 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801d1e:	48 83 c2 01          	add    $0x1,%rdx
+  801d22:	48 83 c1 18          	add    $0x18,%rcx
+  801d26:	48 39 d0             	cmp    %rdx,%rax
+  801d29:	75 ee                	jne    801d19 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d30:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801d31:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3a:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801d41:	00 00 00 
+  801d44:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801d4a:	75 0b                	jne    801d57 <get_allocsize+0x6b>
+  801d4c:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801d51:	c3                   	ret
+        return 0;
+  801d52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d57:	c3                   	ret
+
+0000000000801d58 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801d58:	48 85 ff             	test   %rdi,%rdi
+  801d5b:	0f 84 01 01 00 00    	je     801e62 <free+0x10a>
+free(void *ptr) {
+  801d61:	55                   	push   %rbp
+  801d62:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801d65:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801d6c:	00 00 00 
+  801d6f:	48 8b 30             	mov    (%rax),%rsi
+  801d72:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801d79:	00 00 00 
+  801d7c:	48 39 c6             	cmp    %rax,%rsi
+  801d7f:	74 50                	je     801dd1 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801d81:	48 85 f6             	test   %rsi,%rsi
+  801d84:	74 21                	je     801da7 <free+0x4f>
+  801d86:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801d8d:	00 00 00 
+  801d90:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801d95:	48 3b 39             	cmp    (%rcx),%rdi
+  801d98:	74 61                	je     801dfb <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801d9a:	48 83 c2 01          	add    $0x1,%rdx
+  801d9e:	48 83 c1 18          	add    $0x18,%rcx
+  801da2:	48 39 d6             	cmp    %rdx,%rsi
+  801da5:	75 ee                	jne    801d95 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801da7:	48 ba d0 56 80 00 00 	movabs $0x8056d0,%rdx
+  801dae:	00 00 00 
+  801db1:	be 12 01 00 00       	mov    $0x112,%esi
+  801db6:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801dbd:	00 00 00 
+  801dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc5:	48 b9 41 04 80 00 00 	movabs $0x800441,%rcx
+  801dcc:	00 00 00 
+  801dcf:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801dd1:	48 ba 80 56 80 00 00 	movabs $0x805680,%rdx
+  801dd8:	00 00 00 
+  801ddb:	be 06 01 00 00       	mov    $0x106,%esi
+  801de0:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801de7:	00 00 00 
+  801dea:	b8 00 00 00 00       	mov    $0x0,%eax
+  801def:	48 b9 41 04 80 00 00 	movabs $0x800441,%rcx
+  801df6:	00 00 00 
+  801df9:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801dfb:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801dff:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801e06:	00 00 00 
+  801e09:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801e0f:	75 27                	jne    801e38 <free+0xe0>
+            freep[i].is_free = true;
+  801e11:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801e15:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801e1c:	00 00 00 
+  801e1f:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801e26:	00 00 
+            real_freep_size++;
+  801e28:	48 83 c0 01          	add    $0x1,%rax
+  801e2c:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801e33:	00 00 00 
+}
+  801e36:	5d                   	pop    %rbp
+  801e37:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801e38:	48 ba a8 56 80 00 00 	movabs $0x8056a8,%rdx
+  801e3f:	00 00 00 
+  801e42:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801e47:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801e4e:	00 00 00 
+  801e51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e56:	48 b9 41 04 80 00 00 	movabs $0x800441,%rcx
+  801e5d:	00 00 00 
+  801e60:	ff d1                	call   *%rcx
+  801e62:	c3                   	ret
+
+0000000000801e63 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801e63:	55                   	push   %rbp
+  801e64:	48 89 e5             	mov    %rsp,%rbp
+  801e67:	41 55                	push   %r13
+  801e69:	41 54                	push   %r12
+  801e6b:	53                   	push   %rbx
+  801e6c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e70:	48 89 fb             	mov    %rdi,%rbx
+  801e73:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801e76:	48 b8 ec 1c 80 00 00 	movabs $0x801cec,%rax
+  801e7d:	00 00 00 
+  801e80:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801e82:	49 39 c5             	cmp    %rax,%r13
+  801e85:	73 0e                	jae    801e95 <realloc+0x32>
+}
+  801e87:	48 89 d8             	mov    %rbx,%rax
+  801e8a:	48 83 c4 08          	add    $0x8,%rsp
+  801e8e:	5b                   	pop    %rbx
+  801e8f:	41 5c                	pop    %r12
+  801e91:	41 5d                	pop    %r13
+  801e93:	5d                   	pop    %rbp
+  801e94:	c3                   	ret
+  801e95:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801e98:	4c 89 ef             	mov    %r13,%rdi
+  801e9b:	48 b8 dd 1a 80 00 00 	movabs $0x801add,%rax
+  801ea2:	00 00 00 
+  801ea5:	ff d0                	call   *%rax
+  801ea7:	48 89 c7             	mov    %rax,%rdi
+  801eaa:	4c 89 e2             	mov    %r12,%rdx
+  801ead:	48 89 de             	mov    %rbx,%rsi
+  801eb0:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  801eb7:	00 00 00 
+  801eba:	ff d0                	call   *%rax
+  801ebc:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801ebf:	48 89 df             	mov    %rbx,%rdi
+  801ec2:	48 b8 58 1d 80 00 00 	movabs $0x801d58,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+    return newptr;
+  801ece:	4c 89 e3             	mov    %r12,%rbx
+  801ed1:	eb b4                	jmp    801e87 <realloc+0x24>
+
+0000000000801ed3 <strdup>:
+
+char*
+strdup (const char *src) {
+  801ed3:	55                   	push   %rbp
+  801ed4:	48 89 e5             	mov    %rsp,%rbp
+  801ed7:	41 54                	push   %r12
+  801ed9:	53                   	push   %rbx
+  801eda:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801edd:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  801ee4:	00 00 00 
+  801ee7:	ff d0                	call   *%rax
+  801ee9:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801eed:	4c 89 e7             	mov    %r12,%rdi
+  801ef0:	48 b8 dd 1a 80 00 00 	movabs $0x801add,%rax
+  801ef7:	00 00 00 
+  801efa:	ff d0                	call   *%rax
+  801efc:	48 89 c7             	mov    %rax,%rdi
+  801eff:	4c 89 e2             	mov    %r12,%rdx
+  801f02:	48 89 de             	mov    %rbx,%rsi
+  801f05:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  801f0c:	00 00 00 
+  801f0f:	ff d0                	call   *%rax
+}
+  801f11:	5b                   	pop    %rbx
+  801f12:	41 5c                	pop    %r12
+  801f14:	5d                   	pop    %rbp
+  801f15:	c3                   	ret
+
+0000000000801f16 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801f16:	55                   	push   %rbp
+  801f17:	48 89 e5             	mov    %rsp,%rbp
+  801f1a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f1b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f20:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f25:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f2f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f34:	be 00 00 00 00       	mov    $0x0,%esi
+  801f39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f3f:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f45:	c9                   	leave
+  801f46:	c3                   	ret
+
+0000000000801f47 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801f47:	55                   	push   %rbp
+  801f48:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801f4b:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801f52:	00 00 00 
+  801f55:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801f59:	74 26                	je     801f81 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801f5b:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f5d:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f61:	89 c0                	mov    %eax,%eax
+  801f63:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801f66:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801f6d:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801f74:	00 00 00 
+  801f77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7c:	48 f7 31             	divq   (%rcx)
+}
+  801f7f:	5d                   	pop    %rbp
+  801f80:	c3                   	ret
+        freq = get_cpufreq();
+  801f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f86:	48 ba 16 1f 80 00 00 	movabs $0x801f16,%rdx
+  801f8d:	00 00 00 
+  801f90:	ff d2                	call   *%rdx
+  801f92:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801f99:	00 00 00 
+  801f9c:	eb bd                	jmp    801f5b <get_ticks+0x14>
+
+0000000000801f9e <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801f9e:	55                   	push   %rbp
+  801f9f:	48 89 e5             	mov    %rsp,%rbp
+  801fa2:	53                   	push   %rbx
+  801fa3:	48 83 ec 08          	sub    $0x8,%rsp
+  801fa7:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801faa:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801fb1:	00 00 00 
+  801fb4:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801fb8:	74 50                	je     80200a <sleep+0x6c>
+    asm volatile("rdtsc"
+  801fba:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fbc:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fc0:	89 c0                	mov    %eax,%eax
+  801fc2:	48 89 d6             	mov    %rdx,%rsi
+  801fc5:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801fc8:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801fcf:	00 00 00 
+  801fd2:	48 0f af 18          	imul   (%rax),%rbx
+  801fd6:	48 c1 eb 03          	shr    $0x3,%rbx
+  801fda:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801fe1:	9b c4 20 
+  801fe4:	48 89 d8             	mov    %rbx,%rax
+  801fe7:	48 f7 e2             	mul    %rdx
+  801fea:	48 89 d1             	mov    %rdx,%rcx
+  801fed:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801ff1:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801ff3:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ff7:	89 c0                	mov    %eax,%eax
+  801ff9:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801ffc:	48 29 f2             	sub    %rsi,%rdx
+  801fff:	48 39 ca             	cmp    %rcx,%rdx
+  802002:	72 ed                	jb     801ff1 <sleep+0x53>
+}
+  802004:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802008:	c9                   	leave
+  802009:	c3                   	ret
+        freq = get_cpufreq();
+  80200a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200f:	48 ba 16 1f 80 00 00 	movabs $0x801f16,%rdx
+  802016:	00 00 00 
+  802019:	ff d2                	call   *%rdx
+  80201b:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  802022:	00 00 00 
+  802025:	eb 93                	jmp    801fba <sleep+0x1c>
+
+0000000000802027 <poll_kbd>:
+
+int poll_kbd() {
+  802027:	55                   	push   %rbp
+  802028:	48 89 e5             	mov    %rsp,%rbp
+  80202b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80202c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802031:	ba 00 00 00 00       	mov    $0x0,%edx
+  802036:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80203b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802040:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802045:	be 00 00 00 00       	mov    $0x0,%esi
+  80204a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802050:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  802052:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802056:	c9                   	leave
+  802057:	c3                   	ret
+
+0000000000802058 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  802058:	55                   	push   %rbp
+  802059:	48 89 e5             	mov    %rsp,%rbp
+  80205c:	53                   	push   %rbx
+  80205d:	49 89 fa             	mov    %rdi,%r10
+  802060:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  802062:	44 89 c6             	mov    %r8d,%esi
+  802065:	89 cf                	mov    %ecx,%edi
+  802067:	89 d3                	mov    %edx,%ebx
+  802069:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80206b:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802070:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802073:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  802077:	cd 30                	int    $0x30
+  802079:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80207d:	c9                   	leave
+  80207e:	c3                   	ret
+
+000000000080207f <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80207f:	55                   	push   %rbp
+  802080:	48 89 e5             	mov    %rsp,%rbp
+  802083:	41 54                	push   %r12
+  802085:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  802086:	48 b8 38 38 80 00 00 	movabs $0x803838,%rax
+  80208d:	00 00 00 
+  802090:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802092:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802097:	cd 30                	int    $0x30
+  802099:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  80209c:	85 c0                	test   %eax,%eax
+  80209e:	78 76                	js     802116 <fork+0x97>
+        return envid;
+    if (!envid) {
+  8020a0:	74 7c                	je     80211e <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  8020a2:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8020a8:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8020af:	00 00 00 
+  8020b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020b7:	89 c2                	mov    %eax,%edx
+  8020b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020c3:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  8020ca:	00 00 00 
+  8020cd:	ff d0                	call   *%rax
+  8020cf:	85 c0                	test   %eax,%eax
+  8020d1:	75 7c                	jne    80214f <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  8020d3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020da:	00 00 00 
+  8020dd:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8020e4:	44 89 e7             	mov    %r12d,%edi
+  8020e7:	48 b8 81 19 80 00 00 	movabs $0x801981,%rax
+  8020ee:	00 00 00 
+  8020f1:	ff d0                	call   *%rax
+  8020f3:	85 c0                	test   %eax,%eax
+  8020f5:	75 60                	jne    802157 <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  8020f7:	be 02 00 00 00       	mov    $0x2,%esi
+  8020fc:	44 89 e7             	mov    %r12d,%edi
+  8020ff:	48 b8 af 18 80 00 00 	movabs $0x8018af,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+        return -1;
+  80210b:	85 c0                	test   %eax,%eax
+  80210d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802112:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  802116:	44 89 e0             	mov    %r12d,%eax
+  802119:	5b                   	pop    %rbx
+  80211a:	41 5c                	pop    %r12
+  80211c:	5d                   	pop    %rbp
+  80211d:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80211e:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  802125:	00 00 00 
+  802128:	ff d0                	call   *%rax
+  80212a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80212f:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  802136:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80213d:	00 00 00 
+  802140:	48 01 d0             	add    %rdx,%rax
+  802143:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  80214a:	00 00 00 
+        return 0;
+  80214d:	eb c7                	jmp    802116 <fork+0x97>
+        return -1;
+  80214f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802155:	eb bf                	jmp    802116 <fork+0x97>
+  802157:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80215d:	eb b7                	jmp    802116 <fork+0x97>
+
+000000000080215f <sfork>:
+
+envid_t
+sfork() {
+  80215f:	55                   	push   %rbp
+  802160:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  802163:	48 ba 06 57 80 00 00 	movabs $0x805706,%rdx
+  80216a:	00 00 00 
+  80216d:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802172:	48 bf 21 57 80 00 00 	movabs $0x805721,%rdi
+  802179:	00 00 00 
+  80217c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802181:	48 b9 41 04 80 00 00 	movabs $0x800441,%rcx
+  802188:	00 00 00 
+  80218b:	ff d1                	call   *%rcx
+
+000000000080218d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80218d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802194:	ff ff ff 
+  802197:	48 01 f8             	add    %rdi,%rax
+  80219a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80219e:	c3                   	ret
+
+000000000080219f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80219f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8021a6:	ff ff ff 
+  8021a9:	48 01 f8             	add    %rdi,%rax
+  8021ac:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8021b0:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8021b6:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8021ba:	c3                   	ret
+
+00000000008021bb <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8021bb:	55                   	push   %rbp
+  8021bc:	48 89 e5             	mov    %rsp,%rbp
+  8021bf:	41 57                	push   %r15
+  8021c1:	41 56                	push   %r14
+  8021c3:	41 55                	push   %r13
+  8021c5:	41 54                	push   %r12
+  8021c7:	53                   	push   %rbx
+  8021c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8021cc:	49 89 ff             	mov    %rdi,%r15
+  8021cf:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8021d4:	49 bd 6f 40 80 00 00 	movabs $0x80406f,%r13
+  8021db:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8021de:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8021e4:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8021e7:	48 89 df             	mov    %rbx,%rdi
+  8021ea:	41 ff d5             	call   *%r13
+  8021ed:	83 e0 04             	and    $0x4,%eax
+  8021f0:	74 17                	je     802209 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8021f2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8021f9:	4c 39 f3             	cmp    %r14,%rbx
+  8021fc:	75 e6                	jne    8021e4 <fd_alloc+0x29>
+  8021fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802204:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802209:	4d 89 27             	mov    %r12,(%r15)
+}
+  80220c:	48 83 c4 08          	add    $0x8,%rsp
+  802210:	5b                   	pop    %rbx
+  802211:	41 5c                	pop    %r12
+  802213:	41 5d                	pop    %r13
+  802215:	41 5e                	pop    %r14
+  802217:	41 5f                	pop    %r15
+  802219:	5d                   	pop    %rbp
+  80221a:	c3                   	ret
+
+000000000080221b <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80221b:	83 ff 1f             	cmp    $0x1f,%edi
+  80221e:	77 39                	ja     802259 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802220:	55                   	push   %rbp
+  802221:	48 89 e5             	mov    %rsp,%rbp
+  802224:	41 54                	push   %r12
+  802226:	53                   	push   %rbx
+  802227:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80222a:	48 63 df             	movslq %edi,%rbx
+  80222d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802234:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802238:	48 89 df             	mov    %rbx,%rdi
+  80223b:	48 b8 6f 40 80 00 00 	movabs $0x80406f,%rax
+  802242:	00 00 00 
+  802245:	ff d0                	call   *%rax
+  802247:	a8 04                	test   $0x4,%al
+  802249:	74 14                	je     80225f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80224b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80224f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802254:	5b                   	pop    %rbx
+  802255:	41 5c                	pop    %r12
+  802257:	5d                   	pop    %rbp
+  802258:	c3                   	ret
+        return -E_INVAL;
+  802259:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80225e:	c3                   	ret
+        return -E_INVAL;
+  80225f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802264:	eb ee                	jmp    802254 <fd_lookup+0x39>
+
+0000000000802266 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802266:	55                   	push   %rbp
+  802267:	48 89 e5             	mov    %rsp,%rbp
+  80226a:	41 54                	push   %r12
+  80226c:	53                   	push   %rbx
+  80226d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802270:	48 b8 c0 57 80 00 00 	movabs $0x8057c0,%rax
+  802277:	00 00 00 
+  80227a:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802281:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802284:	39 3b                	cmp    %edi,(%rbx)
+  802286:	74 47                	je     8022cf <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802288:	48 83 c0 08          	add    $0x8,%rax
+  80228c:	48 8b 18             	mov    (%rax),%rbx
+  80228f:	48 85 db             	test   %rbx,%rbx
+  802292:	75 f0                	jne    802284 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802294:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80229b:	00 00 00 
+  80229e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022a4:	89 fa                	mov    %edi,%edx
+  8022a6:	48 bf 30 57 80 00 00 	movabs $0x805730,%rdi
+  8022ad:	00 00 00 
+  8022b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b5:	48 b9 91 05 80 00 00 	movabs $0x800591,%rcx
+  8022bc:	00 00 00 
+  8022bf:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8022c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8022c6:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8022ca:	5b                   	pop    %rbx
+  8022cb:	41 5c                	pop    %r12
+  8022cd:	5d                   	pop    %rbp
+  8022ce:	c3                   	ret
+            return 0;
+  8022cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d4:	eb f0                	jmp    8022c6 <dev_lookup+0x60>
+
+00000000008022d6 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8022d6:	55                   	push   %rbp
+  8022d7:	48 89 e5             	mov    %rsp,%rbp
+  8022da:	41 55                	push   %r13
+  8022dc:	41 54                	push   %r12
+  8022de:	53                   	push   %rbx
+  8022df:	48 83 ec 18          	sub    $0x18,%rsp
+  8022e3:	48 89 fb             	mov    %rdi,%rbx
+  8022e6:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022e9:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8022f0:	ff ff ff 
+  8022f3:	48 01 df             	add    %rbx,%rdi
+  8022f6:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8022fa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022fe:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  802305:	00 00 00 
+  802308:	ff d0                	call   *%rax
+  80230a:	41 89 c5             	mov    %eax,%r13d
+  80230d:	85 c0                	test   %eax,%eax
+  80230f:	78 06                	js     802317 <fd_close+0x41>
+  802311:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802315:	74 1a                	je     802331 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802317:	45 84 e4             	test   %r12b,%r12b
+  80231a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80231f:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802323:	44 89 e8             	mov    %r13d,%eax
+  802326:	48 83 c4 18          	add    $0x18,%rsp
+  80232a:	5b                   	pop    %rbx
+  80232b:	41 5c                	pop    %r12
+  80232d:	41 5d                	pop    %r13
+  80232f:	5d                   	pop    %rbp
+  802330:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802331:	8b 3b                	mov    (%rbx),%edi
+  802333:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802337:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  80233e:	00 00 00 
+  802341:	ff d0                	call   *%rax
+  802343:	41 89 c5             	mov    %eax,%r13d
+  802346:	85 c0                	test   %eax,%eax
+  802348:	78 1b                	js     802365 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80234a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80234e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802352:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802358:	48 85 c0             	test   %rax,%rax
+  80235b:	74 08                	je     802365 <fd_close+0x8f>
+  80235d:	48 89 df             	mov    %rbx,%rdi
+  802360:	ff d0                	call   *%rax
+  802362:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802365:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80236a:	48 89 de             	mov    %rbx,%rsi
+  80236d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802372:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  802379:	00 00 00 
+  80237c:	ff d0                	call   *%rax
+    return res;
+  80237e:	eb a3                	jmp    802323 <fd_close+0x4d>
+
+0000000000802380 <close>:
+
+int
+close(int fdnum) {
+  802380:	55                   	push   %rbp
+  802381:	48 89 e5             	mov    %rsp,%rbp
+  802384:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802388:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80238c:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  802393:	00 00 00 
+  802396:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802398:	85 c0                	test   %eax,%eax
+  80239a:	78 15                	js     8023b1 <close+0x31>
+
+    return fd_close(fd, 1);
+  80239c:	be 01 00 00 00       	mov    $0x1,%esi
+  8023a1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8023a5:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  8023ac:	00 00 00 
+  8023af:	ff d0                	call   *%rax
+}
+  8023b1:	c9                   	leave
+  8023b2:	c3                   	ret
+
+00000000008023b3 <close_all>:
+
+void
+close_all(void) {
+  8023b3:	55                   	push   %rbp
+  8023b4:	48 89 e5             	mov    %rsp,%rbp
+  8023b7:	41 54                	push   %r12
+  8023b9:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8023ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023bf:	49 bc 80 23 80 00 00 	movabs $0x802380,%r12
+  8023c6:	00 00 00 
+  8023c9:	89 df                	mov    %ebx,%edi
+  8023cb:	41 ff d4             	call   *%r12
+  8023ce:	83 c3 01             	add    $0x1,%ebx
+  8023d1:	83 fb 20             	cmp    $0x20,%ebx
+  8023d4:	75 f3                	jne    8023c9 <close_all+0x16>
+}
+  8023d6:	5b                   	pop    %rbx
+  8023d7:	41 5c                	pop    %r12
+  8023d9:	5d                   	pop    %rbp
+  8023da:	c3                   	ret
+
+00000000008023db <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8023db:	55                   	push   %rbp
+  8023dc:	48 89 e5             	mov    %rsp,%rbp
+  8023df:	41 57                	push   %r15
+  8023e1:	41 56                	push   %r14
+  8023e3:	41 55                	push   %r13
+  8023e5:	41 54                	push   %r12
+  8023e7:	53                   	push   %rbx
+  8023e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8023ec:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8023ef:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8023f3:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  8023fa:	00 00 00 
+  8023fd:	ff d0                	call   *%rax
+  8023ff:	89 c3                	mov    %eax,%ebx
+  802401:	85 c0                	test   %eax,%eax
+  802403:	0f 88 b8 00 00 00    	js     8024c1 <dup+0xe6>
+    close(newfdnum);
+  802409:	44 89 e7             	mov    %r12d,%edi
+  80240c:	48 b8 80 23 80 00 00 	movabs $0x802380,%rax
+  802413:	00 00 00 
+  802416:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802418:	4d 63 ec             	movslq %r12d,%r13
+  80241b:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802422:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802426:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80242a:	4c 89 ff             	mov    %r15,%rdi
+  80242d:	49 be 9f 21 80 00 00 	movabs $0x80219f,%r14
+  802434:	00 00 00 
+  802437:	41 ff d6             	call   *%r14
+  80243a:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80243d:	4c 89 ef             	mov    %r13,%rdi
+  802440:	41 ff d6             	call   *%r14
+  802443:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802446:	48 89 df             	mov    %rbx,%rdi
+  802449:	48 b8 6f 40 80 00 00 	movabs $0x80406f,%rax
+  802450:	00 00 00 
+  802453:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802455:	a8 04                	test   $0x4,%al
+  802457:	74 2b                	je     802484 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802459:	41 89 c1             	mov    %eax,%r9d
+  80245c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802462:	4c 89 f1             	mov    %r14,%rcx
+  802465:	ba 00 00 00 00       	mov    $0x0,%edx
+  80246a:	48 89 de             	mov    %rbx,%rsi
+  80246d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802472:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  802479:	00 00 00 
+  80247c:	ff d0                	call   *%rax
+  80247e:	89 c3                	mov    %eax,%ebx
+  802480:	85 c0                	test   %eax,%eax
+  802482:	78 4e                	js     8024d2 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802484:	4c 89 ff             	mov    %r15,%rdi
+  802487:	48 b8 6f 40 80 00 00 	movabs $0x80406f,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+  802493:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802496:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80249c:	4c 89 e9             	mov    %r13,%rcx
+  80249f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a4:	4c 89 fe             	mov    %r15,%rsi
+  8024a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ac:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+  8024b8:	89 c3                	mov    %eax,%ebx
+  8024ba:	85 c0                	test   %eax,%eax
+  8024bc:	78 14                	js     8024d2 <dup+0xf7>
+
+    return newfdnum;
+  8024be:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8024c1:	89 d8                	mov    %ebx,%eax
+  8024c3:	48 83 c4 18          	add    $0x18,%rsp
+  8024c7:	5b                   	pop    %rbx
+  8024c8:	41 5c                	pop    %r12
+  8024ca:	41 5d                	pop    %r13
+  8024cc:	41 5e                	pop    %r14
+  8024ce:	41 5f                	pop    %r15
+  8024d0:	5d                   	pop    %rbp
+  8024d1:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8024d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024d7:	4c 89 ee             	mov    %r13,%rsi
+  8024da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024df:	49 bc 48 18 80 00 00 	movabs $0x801848,%r12
+  8024e6:	00 00 00 
+  8024e9:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8024ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024f1:	4c 89 f6             	mov    %r14,%rsi
+  8024f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024f9:	41 ff d4             	call   *%r12
+    return res;
+  8024fc:	eb c3                	jmp    8024c1 <dup+0xe6>
+
+00000000008024fe <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8024fe:	55                   	push   %rbp
+  8024ff:	48 89 e5             	mov    %rsp,%rbp
+  802502:	41 56                	push   %r14
+  802504:	41 55                	push   %r13
+  802506:	41 54                	push   %r12
+  802508:	53                   	push   %rbx
+  802509:	48 83 ec 10          	sub    $0x10,%rsp
+  80250d:	89 fb                	mov    %edi,%ebx
+  80250f:	49 89 f4             	mov    %rsi,%r12
+  802512:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802515:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802519:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  802520:	00 00 00 
+  802523:	ff d0                	call   *%rax
+  802525:	85 c0                	test   %eax,%eax
+  802527:	78 4c                	js     802575 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802529:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80252d:	41 8b 3e             	mov    (%r14),%edi
+  802530:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802534:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  80253b:	00 00 00 
+  80253e:	ff d0                	call   *%rax
+  802540:	85 c0                	test   %eax,%eax
+  802542:	78 35                	js     802579 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802544:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802548:	83 e0 03             	and    $0x3,%eax
+  80254b:	83 f8 01             	cmp    $0x1,%eax
+  80254e:	74 2d                	je     80257d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802550:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802554:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802558:	48 85 c0             	test   %rax,%rax
+  80255b:	74 56                	je     8025b3 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80255d:	4c 89 ea             	mov    %r13,%rdx
+  802560:	4c 89 e6             	mov    %r12,%rsi
+  802563:	4c 89 f7             	mov    %r14,%rdi
+  802566:	ff d0                	call   *%rax
+}
+  802568:	48 83 c4 10          	add    $0x10,%rsp
+  80256c:	5b                   	pop    %rbx
+  80256d:	41 5c                	pop    %r12
+  80256f:	41 5d                	pop    %r13
+  802571:	41 5e                	pop    %r14
+  802573:	5d                   	pop    %rbp
+  802574:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802575:	48 98                	cltq
+  802577:	eb ef                	jmp    802568 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802579:	48 98                	cltq
+  80257b:	eb eb                	jmp    802568 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80257d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802584:	00 00 00 
+  802587:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80258d:	89 da                	mov    %ebx,%edx
+  80258f:	48 bf 71 57 80 00 00 	movabs $0x805771,%rdi
+  802596:	00 00 00 
+  802599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259e:	48 b9 91 05 80 00 00 	movabs $0x800591,%rcx
+  8025a5:	00 00 00 
+  8025a8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8025aa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025b1:	eb b5                	jmp    802568 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8025b3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8025ba:	eb ac                	jmp    802568 <read+0x6a>
+
+00000000008025bc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8025bc:	55                   	push   %rbp
+  8025bd:	48 89 e5             	mov    %rsp,%rbp
+  8025c0:	41 57                	push   %r15
+  8025c2:	41 56                	push   %r14
+  8025c4:	41 55                	push   %r13
+  8025c6:	41 54                	push   %r12
+  8025c8:	53                   	push   %rbx
+  8025c9:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8025cd:	48 85 d2             	test   %rdx,%rdx
+  8025d0:	74 54                	je     802626 <readn+0x6a>
+  8025d2:	41 89 fd             	mov    %edi,%r13d
+  8025d5:	49 89 f6             	mov    %rsi,%r14
+  8025d8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8025db:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8025e0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8025e5:	49 bf fe 24 80 00 00 	movabs $0x8024fe,%r15
+  8025ec:	00 00 00 
+  8025ef:	4c 89 e2             	mov    %r12,%rdx
+  8025f2:	48 29 f2             	sub    %rsi,%rdx
+  8025f5:	4c 01 f6             	add    %r14,%rsi
+  8025f8:	44 89 ef             	mov    %r13d,%edi
+  8025fb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8025fe:	85 c0                	test   %eax,%eax
+  802600:	78 20                	js     802622 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802602:	01 c3                	add    %eax,%ebx
+  802604:	85 c0                	test   %eax,%eax
+  802606:	74 08                	je     802610 <readn+0x54>
+  802608:	48 63 f3             	movslq %ebx,%rsi
+  80260b:	4c 39 e6             	cmp    %r12,%rsi
+  80260e:	72 df                	jb     8025ef <readn+0x33>
+    }
+    return res;
+  802610:	48 63 c3             	movslq %ebx,%rax
+}
+  802613:	48 83 c4 08          	add    $0x8,%rsp
+  802617:	5b                   	pop    %rbx
+  802618:	41 5c                	pop    %r12
+  80261a:	41 5d                	pop    %r13
+  80261c:	41 5e                	pop    %r14
+  80261e:	41 5f                	pop    %r15
+  802620:	5d                   	pop    %rbp
+  802621:	c3                   	ret
+        if (inc < 0) return inc;
+  802622:	48 98                	cltq
+  802624:	eb ed                	jmp    802613 <readn+0x57>
+    int inc = 1, res = 0;
+  802626:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80262b:	eb e3                	jmp    802610 <readn+0x54>
+
+000000000080262d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80262d:	55                   	push   %rbp
+  80262e:	48 89 e5             	mov    %rsp,%rbp
+  802631:	41 56                	push   %r14
+  802633:	41 55                	push   %r13
+  802635:	41 54                	push   %r12
+  802637:	53                   	push   %rbx
+  802638:	48 83 ec 10          	sub    $0x10,%rsp
+  80263c:	89 fb                	mov    %edi,%ebx
+  80263e:	49 89 f4             	mov    %rsi,%r12
+  802641:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802644:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802648:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+  802654:	85 c0                	test   %eax,%eax
+  802656:	78 47                	js     80269f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802658:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80265c:	41 8b 3e             	mov    (%r14),%edi
+  80265f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802663:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  80266a:	00 00 00 
+  80266d:	ff d0                	call   *%rax
+  80266f:	85 c0                	test   %eax,%eax
+  802671:	78 30                	js     8026a3 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802673:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802678:	74 2d                	je     8026a7 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80267a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80267e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802682:	48 85 c0             	test   %rax,%rax
+  802685:	74 56                	je     8026dd <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802687:	4c 89 ea             	mov    %r13,%rdx
+  80268a:	4c 89 e6             	mov    %r12,%rsi
+  80268d:	4c 89 f7             	mov    %r14,%rdi
+  802690:	ff d0                	call   *%rax
+}
+  802692:	48 83 c4 10          	add    $0x10,%rsp
+  802696:	5b                   	pop    %rbx
+  802697:	41 5c                	pop    %r12
+  802699:	41 5d                	pop    %r13
+  80269b:	41 5e                	pop    %r14
+  80269d:	5d                   	pop    %rbp
+  80269e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80269f:	48 98                	cltq
+  8026a1:	eb ef                	jmp    802692 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026a3:	48 98                	cltq
+  8026a5:	eb eb                	jmp    802692 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026a7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8026ae:	00 00 00 
+  8026b1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026b7:	89 da                	mov    %ebx,%edx
+  8026b9:	48 bf 8d 57 80 00 00 	movabs $0x80578d,%rdi
+  8026c0:	00 00 00 
+  8026c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c8:	48 b9 91 05 80 00 00 	movabs $0x800591,%rcx
+  8026cf:	00 00 00 
+  8026d2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8026d4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026db:	eb b5                	jmp    802692 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8026dd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8026e4:	eb ac                	jmp    802692 <write+0x65>
+
+00000000008026e6 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8026e6:	55                   	push   %rbp
+  8026e7:	48 89 e5             	mov    %rsp,%rbp
+  8026ea:	53                   	push   %rbx
+  8026eb:	48 83 ec 18          	sub    $0x18,%rsp
+  8026ef:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026f1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026f5:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  8026fc:	00 00 00 
+  8026ff:	ff d0                	call   *%rax
+  802701:	85 c0                	test   %eax,%eax
+  802703:	78 0c                	js     802711 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802705:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802709:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80270c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802711:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802715:	c9                   	leave
+  802716:	c3                   	ret
+
+0000000000802717 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802717:	55                   	push   %rbp
+  802718:	48 89 e5             	mov    %rsp,%rbp
+  80271b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80271f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802723:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  80272a:	00 00 00 
+  80272d:	ff d0                	call   *%rax
+  80272f:	85 c0                	test   %eax,%eax
+  802731:	78 07                	js     80273a <tell+0x23>
+    return fdes->fd_offset;
+  802733:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802737:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80273a:	c9                   	leave
+  80273b:	c3                   	ret
+
+000000000080273c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80273c:	55                   	push   %rbp
+  80273d:	48 89 e5             	mov    %rsp,%rbp
+  802740:	41 55                	push   %r13
+  802742:	41 54                	push   %r12
+  802744:	53                   	push   %rbx
+  802745:	48 83 ec 18          	sub    $0x18,%rsp
+  802749:	89 fb                	mov    %edi,%ebx
+  80274b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80274e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802752:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  802759:	00 00 00 
+  80275c:	ff d0                	call   *%rax
+  80275e:	85 c0                	test   %eax,%eax
+  802760:	78 38                	js     80279a <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802762:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802766:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80276a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80276e:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+  80277a:	85 c0                	test   %eax,%eax
+  80277c:	78 1c                	js     80279a <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80277e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802783:	74 20                	je     8027a5 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802785:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802789:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80278d:	48 85 c0             	test   %rax,%rax
+  802790:	74 47                	je     8027d9 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802792:	44 89 e6             	mov    %r12d,%esi
+  802795:	4c 89 ef             	mov    %r13,%rdi
+  802798:	ff d0                	call   *%rax
+}
+  80279a:	48 83 c4 18          	add    $0x18,%rsp
+  80279e:	5b                   	pop    %rbx
+  80279f:	41 5c                	pop    %r12
+  8027a1:	41 5d                	pop    %r13
+  8027a3:	5d                   	pop    %rbp
+  8027a4:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8027a5:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8027ac:	00 00 00 
+  8027af:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8027b5:	89 da                	mov    %ebx,%edx
+  8027b7:	48 bf 50 57 80 00 00 	movabs $0x805750,%rdi
+  8027be:	00 00 00 
+  8027c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c6:	48 b9 91 05 80 00 00 	movabs $0x800591,%rcx
+  8027cd:	00 00 00 
+  8027d0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8027d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027d7:	eb c1                	jmp    80279a <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8027d9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027de:	eb ba                	jmp    80279a <ftruncate+0x5e>
+
+00000000008027e0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8027e0:	55                   	push   %rbp
+  8027e1:	48 89 e5             	mov    %rsp,%rbp
+  8027e4:	41 54                	push   %r12
+  8027e6:	53                   	push   %rbx
+  8027e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8027eb:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027ee:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027f2:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  8027f9:	00 00 00 
+  8027fc:	ff d0                	call   *%rax
+  8027fe:	85 c0                	test   %eax,%eax
+  802800:	78 4e                	js     802850 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802802:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802806:	41 8b 3c 24          	mov    (%r12),%edi
+  80280a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80280e:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  802815:	00 00 00 
+  802818:	ff d0                	call   *%rax
+  80281a:	85 c0                	test   %eax,%eax
+  80281c:	78 32                	js     802850 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80281e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802822:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802827:	74 30                	je     802859 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802829:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80282c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802833:	00 00 00 
+    stat->st_isdir = 0;
+  802836:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80283d:	00 00 00 
+    stat->st_dev = dev;
+  802840:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802847:	48 89 de             	mov    %rbx,%rsi
+  80284a:	4c 89 e7             	mov    %r12,%rdi
+  80284d:	ff 50 28             	call   *0x28(%rax)
+}
+  802850:	48 83 c4 10          	add    $0x10,%rsp
+  802854:	5b                   	pop    %rbx
+  802855:	41 5c                	pop    %r12
+  802857:	5d                   	pop    %rbp
+  802858:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802859:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80285e:	eb f0                	jmp    802850 <fstat+0x70>
+
+0000000000802860 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802860:	55                   	push   %rbp
+  802861:	48 89 e5             	mov    %rsp,%rbp
+  802864:	41 54                	push   %r12
+  802866:	53                   	push   %rbx
+  802867:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80286e:	41 89 fc             	mov    %edi,%r12d
+  802871:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802873:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802877:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  80287e:	00 00 00 
+  802881:	ff d0                	call   *%rax
+  802883:	85 c0                	test   %eax,%eax
+  802885:	78 31                	js     8028b8 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802887:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80288e:	44 89 e7             	mov    %r12d,%edi
+  802891:	48 b8 e0 27 80 00 00 	movabs $0x8027e0,%rax
+  802898:	00 00 00 
+  80289b:	ff d0                	call   *%rax
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	78 17                	js     8028b8 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8028a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028a5:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8028a8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8028ab:	39 d3                	cmp    %edx,%ebx
+  8028ad:	0f 4f da             	cmovg  %edx,%ebx
+  8028b0:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8028b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028b8:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8028bf:	5b                   	pop    %rbx
+  8028c0:	41 5c                	pop    %r12
+  8028c2:	5d                   	pop    %rbp
+  8028c3:	c3                   	ret
+
+00000000008028c4 <seektoend>:
+{
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	53                   	push   %rbx
+  8028c9:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8028d0:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8028d2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028d6:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  8028dd:	00 00 00 
+  8028e0:	ff d0                	call   *%rax
+  8028e2:	85 c0                	test   %eax,%eax
+  8028e4:	78 28                	js     80290e <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8028e6:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8028ed:	89 df                	mov    %ebx,%edi
+  8028ef:	48 b8 e0 27 80 00 00 	movabs $0x8027e0,%rax
+  8028f6:	00 00 00 
+  8028f9:	ff d0                	call   *%rax
+  8028fb:	85 c0                	test   %eax,%eax
+  8028fd:	78 0f                	js     80290e <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8028ff:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802902:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802906:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802909:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80290e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802912:	c9                   	leave
+  802913:	c3                   	ret
+
+0000000000802914 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802914:	55                   	push   %rbp
+  802915:	48 89 e5             	mov    %rsp,%rbp
+  802918:	41 54                	push   %r12
+  80291a:	53                   	push   %rbx
+  80291b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80291e:	be 00 00 00 00       	mov    $0x0,%esi
+  802923:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  80292a:	00 00 00 
+  80292d:	ff d0                	call   *%rax
+  80292f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802931:	85 c0                	test   %eax,%eax
+  802933:	78 25                	js     80295a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802935:	4c 89 e6             	mov    %r12,%rsi
+  802938:	89 c7                	mov    %eax,%edi
+  80293a:	48 b8 e0 27 80 00 00 	movabs $0x8027e0,%rax
+  802941:	00 00 00 
+  802944:	ff d0                	call   *%rax
+  802946:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802949:	89 df                	mov    %ebx,%edi
+  80294b:	48 b8 80 23 80 00 00 	movabs $0x802380,%rax
+  802952:	00 00 00 
+  802955:	ff d0                	call   *%rax
+
+    return res;
+  802957:	44 89 e3             	mov    %r12d,%ebx
+}
+  80295a:	89 d8                	mov    %ebx,%eax
+  80295c:	5b                   	pop    %rbx
+  80295d:	41 5c                	pop    %r12
+  80295f:	5d                   	pop    %rbp
+  802960:	c3                   	ret
+
+0000000000802961 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802961:	55                   	push   %rbp
+  802962:	48 89 e5             	mov    %rsp,%rbp
+  802965:	53                   	push   %rbx
+  802966:	48 83 ec 08          	sub    $0x8,%rsp
+  80296a:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80296d:	48 b8 8d 21 80 00 00 	movabs $0x80218d,%rax
+  802974:	00 00 00 
+  802977:	ff d0                	call   *%rax
+  802979:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80297d:	0f 87 ea 00 00 00    	ja     802a6d <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802983:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80298a:	00 00 00 
+  80298d:	80 38 00             	cmpb   $0x0,(%rax)
+  802990:	75 35                	jne    8029c7 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802992:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802997:	ba 00 00 22 00       	mov    $0x220000,%edx
+  80299c:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8029a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029a6:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  8029ad:	00 00 00 
+  8029b0:	ff d0                	call   *%rax
+  8029b2:	85 c0                	test   %eax,%eax
+  8029b4:	0f 88 ba 00 00 00    	js     802a74 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8029ba:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8029c1:	00 00 00 
+  8029c4:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8029c7:	48 89 df             	mov    %rbx,%rdi
+  8029ca:	48 b8 8d 21 80 00 00 	movabs $0x80218d,%rax
+  8029d1:	00 00 00 
+  8029d4:	ff d0                	call   *%rax
+  8029d6:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8029da:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8029e1:	00 00 00 
+  8029e4:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8029e8:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8029eb:	39 39                	cmp    %edi,(%rcx)
+  8029ed:	74 46                	je     802a35 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8029ef:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8029f3:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8029fa:	00 
+  8029fb:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802a02:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802a09:	00 
+  802a0a:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802a11:	00 
+  802a12:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802a19:	00 
+  802a1a:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802a21:	00 
+  802a22:	89 39                	mov    %edi,(%rcx)
+  802a24:	48 01 c6             	add    %rax,%rsi
+  802a27:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802a2c:	48 89 c8             	mov    %rcx,%rax
+  802a2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a33:	c9                   	leave
+  802a34:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802a35:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802a39:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802a40:	00 00 00 
+  802a43:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802a46:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802a4a:	74 e0                	je     802a2c <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802a4c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802a53:	00 
+  802a54:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802a58:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802a5f:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802a61:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802a64:	48 01 c2             	add    %rax,%rdx
+  802a67:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802a6b:	eb bf                	jmp    802a2c <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802a6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a72:	eb b8                	jmp    802a2c <fbuf_get+0xcb>
+            return NULL;
+  802a74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a79:	eb b1                	jmp    802a2c <fbuf_get+0xcb>
+
+0000000000802a7b <fsipc_bulk>:
+fsipc_bulk(void) {
+  802a7b:	55                   	push   %rbp
+  802a7c:	48 89 e5             	mov    %rsp,%rbp
+  802a7f:	53                   	push   %rbx
+  802a80:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802a84:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a8b:	00 00 00 
+  802a8e:	48 8b 18             	mov    (%rax),%rbx
+  802a91:	48 85 db             	test   %rbx,%rbx
+  802a94:	74 16                	je     802aac <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802a96:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a9d:	00 00 00 
+  802aa0:	48 8b 18             	mov    (%rax),%rbx
+}
+  802aa3:	48 89 d8             	mov    %rbx,%rax
+  802aa6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aaa:	c9                   	leave
+  802aab:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802aac:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ab1:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802ab6:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802abb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ac0:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  802ac7:	00 00 00 
+  802aca:	ff d0                	call   *%rax
+  802acc:	85 c0                	test   %eax,%eax
+  802ace:	78 d3                	js     802aa3 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802ad0:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802ad5:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802adc:	00 00 00 
+  802adf:	eb b5                	jmp    802a96 <fsipc_bulk+0x1b>
+
+0000000000802ae1 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802ae1:	55                   	push   %rbp
+  802ae2:	48 89 e5             	mov    %rsp,%rbp
+  802ae5:	41 57                	push   %r15
+  802ae7:	41 56                	push   %r14
+  802ae9:	41 55                	push   %r13
+  802aeb:	41 54                	push   %r12
+  802aed:	53                   	push   %rbx
+  802aee:	48 83 ec 08          	sub    $0x8,%rsp
+  802af2:	41 89 fd             	mov    %edi,%r13d
+  802af5:	49 89 f6             	mov    %rsi,%r14
+  802af8:	49 89 d7             	mov    %rdx,%r15
+  802afb:	48 89 cb             	mov    %rcx,%rbx
+  802afe:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b01:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802b08:	00 00 00 
+  802b0b:	83 38 00             	cmpl   $0x0,(%rax)
+  802b0e:	74 52                	je     802b62 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802b10:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b16:	4c 89 f9             	mov    %r15,%rcx
+  802b19:	4c 89 f2             	mov    %r14,%rdx
+  802b1c:	44 89 ee             	mov    %r13d,%esi
+  802b1f:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802b26:	00 00 00 
+  802b29:	8b 38                	mov    (%rax),%edi
+  802b2b:	48 b8 c6 45 80 00 00 	movabs $0x8045c6,%rax
+  802b32:	00 00 00 
+  802b35:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802b37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b3c:	4c 89 e2             	mov    %r12,%rdx
+  802b3f:	48 89 de             	mov    %rbx,%rsi
+  802b42:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b47:	48 b8 16 44 80 00 00 	movabs $0x804416,%rax
+  802b4e:	00 00 00 
+  802b51:	ff d0                	call   *%rax
+}
+  802b53:	48 83 c4 08          	add    $0x8,%rsp
+  802b57:	5b                   	pop    %rbx
+  802b58:	41 5c                	pop    %r12
+  802b5a:	41 5d                	pop    %r13
+  802b5c:	41 5e                	pop    %r14
+  802b5e:	41 5f                	pop    %r15
+  802b60:	5d                   	pop    %rbp
+  802b61:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b62:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b67:	48 b8 69 46 80 00 00 	movabs $0x804669,%rax
+  802b6e:	00 00 00 
+  802b71:	ff d0                	call   *%rax
+  802b73:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802b7a:	00 00 
+  802b7c:	eb 92                	jmp    802b10 <fsipc_region+0x2f>
+
+0000000000802b7e <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802b7e:	55                   	push   %rbp
+  802b7f:	48 89 e5             	mov    %rsp,%rbp
+  802b82:	41 57                	push   %r15
+  802b84:	41 56                	push   %r14
+  802b86:	41 55                	push   %r13
+  802b88:	41 54                	push   %r12
+  802b8a:	53                   	push   %rbx
+  802b8b:	48 83 ec 28          	sub    $0x28,%rsp
+  802b8f:	49 89 ff             	mov    %rdi,%r15
+  802b92:	49 89 f6             	mov    %rsi,%r14
+  802b95:	48 89 d3             	mov    %rdx,%rbx
+  802b98:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802b9c:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802b9f:	48 b8 7b 2a 80 00 00 	movabs $0x802a7b,%rax
+  802ba6:	00 00 00 
+  802ba9:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802bab:	48 85 c0             	test   %rax,%rax
+  802bae:	0f 84 cc 00 00 00    	je     802c80 <devfile_write_direct+0x102>
+  802bb4:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802bb7:	48 85 db             	test   %rbx,%rbx
+  802bba:	0f 84 ba 00 00 00    	je     802c7a <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802bc0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802bc6:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802bcd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802bd1:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802bd5:	4c 29 e3             	sub    %r12,%rbx
+  802bd8:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802bdd:	48 39 c3             	cmp    %rax,%rbx
+  802be0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802be4:	48 89 da             	mov    %rbx,%rdx
+  802be7:	4c 89 f6             	mov    %r14,%rsi
+  802bea:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802bee:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802bfa:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802bfe:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802c02:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802c05:	44 01 e0             	add    %r12d,%eax
+  802c08:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802c0c:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802c10:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802c17:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802c1e:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802c25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c2b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c30:	4c 89 ee             	mov    %r13,%rsi
+  802c33:	bf 04 00 00 00       	mov    $0x4,%edi
+  802c38:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  802c3f:	00 00 00 
+  802c42:	ff d0                	call   *%rax
+        if (res < 0)
+  802c44:	85 c0                	test   %eax,%eax
+  802c46:	78 29                	js     802c71 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802c48:	74 2b                	je     802c75 <devfile_write_direct+0xf7>
+        i += res;
+  802c4a:	48 98                	cltq
+  802c4c:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802c4f:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802c52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c56:	49 39 c4             	cmp    %rax,%r12
+  802c59:	0f 82 72 ff ff ff    	jb     802bd1 <devfile_write_direct+0x53>
+    return i;
+  802c5f:	4c 89 e0             	mov    %r12,%rax
+}
+  802c62:	48 83 c4 28          	add    $0x28,%rsp
+  802c66:	5b                   	pop    %rbx
+  802c67:	41 5c                	pop    %r12
+  802c69:	41 5d                	pop    %r13
+  802c6b:	41 5e                	pop    %r14
+  802c6d:	41 5f                	pop    %r15
+  802c6f:	5d                   	pop    %rbp
+  802c70:	c3                   	ret
+            return res;
+  802c71:	48 98                	cltq
+  802c73:	eb ed                	jmp    802c62 <devfile_write_direct+0xe4>
+            return i;
+  802c75:	4c 89 e0             	mov    %r12,%rax
+  802c78:	eb e8                	jmp    802c62 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802c7a:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802c7e:	eb df                	jmp    802c5f <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802c80:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802c87:	eb d9                	jmp    802c62 <devfile_write_direct+0xe4>
+
+0000000000802c89 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802c89:	55                   	push   %rbp
+  802c8a:	48 89 e5             	mov    %rsp,%rbp
+  802c8d:	41 56                	push   %r14
+  802c8f:	41 55                	push   %r13
+  802c91:	41 54                	push   %r12
+  802c93:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802c94:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802c98:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca1:	4d 39 ee             	cmp    %r13,%r14
+  802ca4:	0f 84 99 00 00 00    	je     802d43 <fbuf_flush+0xba>
+  802caa:	49 89 fc             	mov    %rdi,%r12
+  802cad:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802cb0:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802cb3:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802cb7:	48 b8 8d 21 80 00 00 	movabs $0x80218d,%rax
+  802cbe:	00 00 00 
+  802cc1:	ff d0                	call   *%rax
+  802cc3:	48 89 c2             	mov    %rax,%rdx
+  802cc6:	48 c1 e2 04          	shl    $0x4,%rdx
+  802cca:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802cce:	48 c1 e0 0c          	shl    $0xc,%rax
+  802cd2:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802cd7:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802cda:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802cde:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802ce5:	00 
+  802ce6:	44 89 f1             	mov    %r14d,%ecx
+  802ce9:	4c 89 ea             	mov    %r13,%rdx
+  802cec:	4c 89 e7             	mov    %r12,%rdi
+  802cef:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  802cf6:	00 00 00 
+  802cf9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cfb:	48 85 c0             	test   %rax,%rax
+  802cfe:	78 43                	js     802d43 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802d00:	4c 39 e8             	cmp    %r13,%rax
+  802d03:	72 47                	jb     802d4c <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802d05:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802d0a:	83 c0 01             	add    $0x1,%eax
+  802d0d:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d12:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802d15:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802d19:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802d1d:	72 0f                	jb     802d2e <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802d1f:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802d23:	48 39 c2             	cmp    %rax,%rdx
+  802d26:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802d2a:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802d2e:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802d35:	00 
+  802d36:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802d3d:	00 
+    return 0;
+  802d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d43:	5b                   	pop    %rbx
+  802d44:	41 5c                	pop    %r12
+  802d46:	41 5d                	pop    %r13
+  802d48:	41 5e                	pop    %r14
+  802d4a:	5d                   	pop    %rbp
+  802d4b:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802d4c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802d51:	eb f0                	jmp    802d43 <fbuf_flush+0xba>
+
+0000000000802d53 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802d53:	55                   	push   %rbp
+  802d54:	48 89 e5             	mov    %rsp,%rbp
+  802d57:	53                   	push   %rbx
+  802d58:	48 83 ec 08          	sub    $0x8,%rsp
+  802d5c:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802d5f:	48 b8 61 29 80 00 00 	movabs $0x802961,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+  802d6b:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d73:	48 85 f6             	test   %rsi,%rsi
+  802d76:	74 0f                	je     802d87 <devfile_sync+0x34>
+  802d78:	48 89 df             	mov    %rbx,%rdi
+  802d7b:	48 b8 89 2c 80 00 00 	movabs $0x802c89,%rax
+  802d82:	00 00 00 
+  802d85:	ff d0                	call   *%rax
+}
+  802d87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d8b:	c9                   	leave
+  802d8c:	c3                   	ret
+
+0000000000802d8d <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802d8d:	55                   	push   %rbp
+  802d8e:	48 89 e5             	mov    %rsp,%rbp
+  802d91:	48 83 ec 10          	sub    $0x10,%rsp
+  802d95:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802d98:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802d9f:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802da0:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802da4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802da9:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802db0:	00 00 00 
+  802db3:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  802dba:	00 00 00 
+  802dbd:	ff d0                	call   *%rax
+}
+  802dbf:	c9                   	leave
+  802dc0:	c3                   	ret
+
+0000000000802dc1 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802dc1:	55                   	push   %rbp
+  802dc2:	48 89 e5             	mov    %rsp,%rbp
+  802dc5:	41 54                	push   %r12
+  802dc7:	53                   	push   %rbx
+  802dc8:	48 89 fb             	mov    %rdi,%rbx
+  802dcb:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802dce:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  802dd5:	00 00 00 
+  802dd8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802dda:	85 c0                	test   %eax,%eax
+  802ddc:	78 63                	js     802e41 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802dde:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802de1:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802de8:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802dea:	be 00 00 00 00       	mov    $0x0,%esi
+  802def:	bf 05 00 00 00       	mov    $0x5,%edi
+  802df4:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  802dfb:	00 00 00 
+  802dfe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e00:	85 c0                	test   %eax,%eax
+  802e02:	78 3d                	js     802e41 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e04:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802e0b:	00 00 00 
+  802e0e:	48 89 de             	mov    %rbx,%rsi
+  802e11:	4c 89 e7             	mov    %r12,%rdi
+  802e14:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  802e1b:	00 00 00 
+  802e1e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802e20:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802e26:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802e2d:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802e2e:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802e34:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802e3b:	00 
+
+    return 0;
+  802e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e41:	5b                   	pop    %rbx
+  802e42:	41 5c                	pop    %r12
+  802e44:	5d                   	pop    %rbp
+  802e45:	c3                   	ret
+
+0000000000802e46 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802e46:	55                   	push   %rbp
+  802e47:	48 89 e5             	mov    %rsp,%rbp
+  802e4a:	41 54                	push   %r12
+  802e4c:	53                   	push   %rbx
+  802e4d:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802e50:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  802e57:	00 00 00 
+  802e5a:	ff d0                	call   *%rax
+  802e5c:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802e5f:	48 89 df             	mov    %rbx,%rdi
+  802e62:	48 b8 8d 21 80 00 00 	movabs $0x80218d,%rax
+  802e69:	00 00 00 
+  802e6c:	ff d0                	call   *%rax
+  802e6e:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802e72:	76 2e                	jbe    802ea2 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802e74:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e77:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802e7e:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802e80:	be 00 00 00 00       	mov    $0x0,%esi
+  802e85:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802e8a:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  802e91:	00 00 00 
+  802e94:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802e96:	45 85 e4             	test   %r12d,%r12d
+  802e99:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802e9d:	5b                   	pop    %rbx
+  802e9e:	41 5c                	pop    %r12
+  802ea0:	5d                   	pop    %rbp
+  802ea1:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802ea2:	48 89 df             	mov    %rbx,%rdi
+  802ea5:	48 b8 8d 21 80 00 00 	movabs $0x80218d,%rax
+  802eac:	00 00 00 
+  802eaf:	ff d0                	call   *%rax
+  802eb1:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802eb5:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802ebc:	00 00 00 
+  802ebf:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802ec6:	48 89 df             	mov    %rbx,%rdi
+  802ec9:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  802ed0:	00 00 00 
+  802ed3:	ff d0                	call   *%rax
+  802ed5:	48 89 c6             	mov    %rax,%rsi
+  802ed8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802edd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee2:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  802ee9:	00 00 00 
+  802eec:	ff d0                	call   *%rax
+  802eee:	eb 84                	jmp    802e74 <devfile_flush+0x2e>
+
+0000000000802ef0 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802ef0:	55                   	push   %rbp
+  802ef1:	48 89 e5             	mov    %rsp,%rbp
+  802ef4:	41 55                	push   %r13
+  802ef6:	41 54                	push   %r12
+  802ef8:	53                   	push   %rbx
+  802ef9:	48 83 ec 08          	sub    $0x8,%rsp
+  802efd:	48 89 fb             	mov    %rdi,%rbx
+  802f00:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802f03:	48 b8 61 29 80 00 00 	movabs $0x802961,%rax
+  802f0a:	00 00 00 
+  802f0d:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f0f:	48 85 c0             	test   %rax,%rax
+  802f12:	74 51                	je     802f65 <devfile_trunc+0x75>
+  802f14:	49 89 c4             	mov    %rax,%r12
+  802f17:	48 89 c6             	mov    %rax,%rsi
+  802f1a:	48 89 df             	mov    %rbx,%rdi
+  802f1d:	48 b8 89 2c 80 00 00 	movabs $0x802c89,%rax
+  802f24:	00 00 00 
+  802f27:	ff d0                	call   *%rax
+  802f29:	85 c0                	test   %eax,%eax
+  802f2b:	78 2d                	js     802f5a <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f2d:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802f34:	00 00 00 
+  802f37:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f3a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802f3c:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802f40:	be 00 00 00 00       	mov    $0x0,%esi
+  802f45:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f4a:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  802f51:	00 00 00 
+  802f54:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802f56:	85 c0                	test   %eax,%eax
+  802f58:	79 3e                	jns    802f98 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802f5a:	48 83 c4 08          	add    $0x8,%rsp
+  802f5e:	5b                   	pop    %rbx
+  802f5f:	41 5c                	pop    %r12
+  802f61:	41 5d                	pop    %r13
+  802f63:	5d                   	pop    %rbp
+  802f64:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f65:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802f6c:	00 00 00 
+  802f6f:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f72:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802f74:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802f78:	be 00 00 00 00       	mov    $0x0,%esi
+  802f7d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f82:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  802f89:	00 00 00 
+  802f8c:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802f8e:	85 c0                	test   %eax,%eax
+  802f90:	78 c8                	js     802f5a <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f92:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f96:	eb c2                	jmp    802f5a <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f98:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802f9b:	8d 51 01             	lea    0x1(%rcx),%edx
+  802f9e:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802fa1:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802fa6:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802fad:	00 00 
+  802faf:	eb a9                	jmp    802f5a <devfile_trunc+0x6a>
+
+0000000000802fb1 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802fb1:	55                   	push   %rbp
+  802fb2:	48 89 e5             	mov    %rsp,%rbp
+  802fb5:	41 57                	push   %r15
+  802fb7:	41 56                	push   %r14
+  802fb9:	41 55                	push   %r13
+  802fbb:	41 54                	push   %r12
+  802fbd:	53                   	push   %rbx
+  802fbe:	48 83 ec 28          	sub    $0x28,%rsp
+  802fc2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802fc6:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802fca:	49 89 d7             	mov    %rdx,%r15
+  802fcd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802fd1:	48 b8 61 29 80 00 00 	movabs $0x802961,%rax
+  802fd8:	00 00 00 
+  802fdb:	ff d0                	call   *%rax
+  802fdd:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802fe0:	48 85 c0             	test   %rax,%rax
+  802fe3:	74 31                	je     803016 <devfile_write+0x65>
+  802fe5:	4c 89 f8             	mov    %r15,%rax
+  802fe8:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802fef:	77 25                	ja     803016 <devfile_write+0x65>
+    size_t i = 0;
+  802ff1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802ff7:	48 85 c0             	test   %rax,%rax
+  802ffa:	0f 85 64 01 00 00    	jne    803164 <devfile_write+0x1b3>
+    size_t i = 0;
+  803000:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  803004:	4c 89 f8             	mov    %r15,%rax
+}
+  803007:	48 83 c4 28          	add    $0x28,%rsp
+  80300b:	5b                   	pop    %rbx
+  80300c:	41 5c                	pop    %r12
+  80300e:	41 5d                	pop    %r13
+  803010:	41 5e                	pop    %r14
+  803012:	41 5f                	pop    %r15
+  803014:	5d                   	pop    %rbp
+  803015:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803016:	48 85 db             	test   %rbx,%rbx
+  803019:	74 5b                	je     803076 <devfile_write+0xc5>
+  80301b:	48 89 de             	mov    %rbx,%rsi
+  80301e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803022:	48 b8 89 2c 80 00 00 	movabs $0x802c89,%rax
+  803029:	00 00 00 
+  80302c:	ff d0                	call   *%rax
+  80302e:	85 c0                	test   %eax,%eax
+  803030:	78 40                	js     803072 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803032:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803036:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  803039:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80303d:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803041:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  803048:	00 00 00 
+  80304b:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80304d:	48 85 c0             	test   %rax,%rax
+  803050:	7e b5                	jle    803007 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803052:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803056:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  803059:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  80305c:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  80305f:	8d 51 01             	lea    0x1(%rcx),%edx
+  803062:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803065:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  803068:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80306f:	00 
+  803070:	eb 95                	jmp    803007 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803072:	48 98                	cltq
+  803074:	eb 91                	jmp    803007 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803076:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80307a:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  80307d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803081:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803085:	48 89 df             	mov    %rbx,%rdi
+  803088:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  80308f:	00 00 00 
+  803092:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803094:	48 85 c0             	test   %rax,%rax
+  803097:	0f 8e 6a ff ff ff    	jle    803007 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80309d:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  8030a0:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8030a4:	e9 5e ff ff ff       	jmp    803007 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8030a9:	48 98                	cltq
+  8030ab:	4d 85 ff             	test   %r15,%r15
+  8030ae:	49 0f 45 c7          	cmovne %r15,%rax
+  8030b2:	e9 50 ff ff ff       	jmp    803007 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8030b7:	48 89 de             	mov    %rbx,%rsi
+  8030ba:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030be:	48 b8 89 2c 80 00 00 	movabs $0x802c89,%rax
+  8030c5:	00 00 00 
+  8030c8:	ff d0                	call   *%rax
+  8030ca:	85 c0                	test   %eax,%eax
+  8030cc:	0f 88 2b 01 00 00    	js     8031fd <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8030d2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8030d6:	4c 01 f8             	add    %r15,%rax
+  8030d9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8030dd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030e1:	48 b9 8d 21 80 00 00 	movabs $0x80218d,%rcx
+  8030e8:	00 00 00 
+  8030eb:	ff d1                	call   *%rcx
+  8030ed:	48 89 c2             	mov    %rax,%rdx
+  8030f0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8030f4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8030f8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030fc:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803101:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803104:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80310b:	00 
+  80310c:	4c 89 ea             	mov    %r13,%rdx
+  80310f:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803113:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  80311a:	00 00 00 
+  80311d:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  80311f:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803123:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803127:	48 39 c2             	cmp    %rax,%rdx
+  80312a:	0f 84 db 00 00 00    	je     80320b <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803130:	4c 39 e2             	cmp    %r12,%rdx
+  803133:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  803137:	4d 01 ec             	add    %r13,%r12
+  80313a:	49 39 c4             	cmp    %rax,%r12
+  80313d:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803141:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803145:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  803149:	45 01 ee             	add    %r13d,%r14d
+  80314c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803150:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803154:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803157:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80315b:	49 39 c7             	cmp    %rax,%r15
+  80315e:	0f 83 a0 fe ff ff    	jae    803004 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803164:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803168:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  80316c:	8b 43 08             	mov    0x8(%rbx),%eax
+  80316f:	44 39 f0             	cmp    %r14d,%eax
+  803172:	7f 10                	jg     803184 <devfile_write+0x1d3>
+  803174:	48 98                	cltq
+  803176:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  80317c:	49 63 d6             	movslq %r14d,%rdx
+  80317f:	48 39 d0             	cmp    %rdx,%rax
+  803182:	7d 2d                	jge    8031b1 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803184:	48 89 de             	mov    %rbx,%rsi
+  803187:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80318b:	48 b8 89 2c 80 00 00 	movabs $0x802c89,%rax
+  803192:	00 00 00 
+  803195:	ff d0                	call   *%rax
+  803197:	85 c0                	test   %eax,%eax
+  803199:	0f 88 0a ff ff ff    	js     8030a9 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80319f:	44 89 f0             	mov    %r14d,%eax
+  8031a2:	66 b8 00 00          	mov    $0x0,%ax
+  8031a6:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  8031a9:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8031b0:	00 
+        size_t off = pos - fb->fb_base;
+  8031b1:	45 89 f4             	mov    %r14d,%r12d
+  8031b4:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  8031b8:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  8031bb:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  8031bf:	4d 29 fd             	sub    %r15,%r13
+  8031c2:	b8 00 00 01 00       	mov    $0x10000,%eax
+  8031c7:	4c 29 e0             	sub    %r12,%rax
+  8031ca:	49 39 c5             	cmp    %rax,%r13
+  8031cd:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  8031d1:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8031d5:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8031d9:	48 39 c2             	cmp    %rax,%rdx
+  8031dc:	0f 84 f0 fe ff ff    	je     8030d2 <devfile_write+0x121>
+  8031e2:	4c 39 e0             	cmp    %r12,%rax
+  8031e5:	0f 82 cc fe ff ff    	jb     8030b7 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  8031eb:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8031ef:	48 39 d0             	cmp    %rdx,%rax
+  8031f2:	0f 83 da fe ff ff    	jae    8030d2 <devfile_write+0x121>
+  8031f8:	e9 ba fe ff ff       	jmp    8030b7 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8031fd:	48 98                	cltq
+  8031ff:	4d 85 ff             	test   %r15,%r15
+  803202:	49 0f 45 c7          	cmovne %r15,%rax
+  803206:	e9 fc fd ff ff       	jmp    803007 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  80320b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80320f:	4c 89 e2             	mov    %r12,%rdx
+  803212:	e9 2a ff ff ff       	jmp    803141 <devfile_write+0x190>
+
+0000000000803217 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803217:	55                   	push   %rbp
+  803218:	48 89 e5             	mov    %rsp,%rbp
+  80321b:	41 57                	push   %r15
+  80321d:	41 56                	push   %r14
+  80321f:	41 55                	push   %r13
+  803221:	41 54                	push   %r12
+  803223:	53                   	push   %rbx
+  803224:	48 83 ec 28          	sub    $0x28,%rsp
+  803228:	49 89 ff             	mov    %rdi,%r15
+  80322b:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80322f:	48 89 d3             	mov    %rdx,%rbx
+  803232:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803236:	48 b8 61 29 80 00 00 	movabs $0x802961,%rax
+  80323d:	00 00 00 
+  803240:	ff d0                	call   *%rax
+  803242:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803245:	48 85 c0             	test   %rax,%rax
+  803248:	74 0d                	je     803257 <devfile_read+0x40>
+  80324a:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803251:	0f 86 1a 01 00 00    	jbe    803371 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803257:	4d 85 e4             	test   %r12,%r12
+  80325a:	74 1a                	je     803276 <devfile_read+0x5f>
+  80325c:	4c 89 e6             	mov    %r12,%rsi
+  80325f:	4c 89 ff             	mov    %r15,%rdi
+  803262:	48 b8 89 2c 80 00 00 	movabs $0x802c89,%rax
+  803269:	00 00 00 
+  80326c:	ff d0                	call   *%rax
+  80326e:	85 c0                	test   %eax,%eax
+  803270:	0f 88 e8 00 00 00    	js     80335e <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803276:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  80327a:	48 b8 7b 2a 80 00 00 	movabs $0x802a7b,%rax
+  803281:	00 00 00 
+  803284:	ff d0                	call   *%rax
+  803286:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803289:	48 85 c0             	test   %rax,%rax
+  80328c:	0f 84 69 02 00 00    	je     8034fb <devfile_read+0x2e4>
+    while (i < n) {
+  803292:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803297:	0f 84 ce 00 00 00    	je     80336b <devfile_read+0x154>
+    size_t i = 0;
+  80329d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8032a2:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8032a9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8032ad:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  8032b1:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  8032b5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8032b9:	48 29 da             	sub    %rbx,%rdx
+  8032bc:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8032c1:	48 39 c2             	cmp    %rax,%rdx
+  8032c4:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  8032c8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8032cc:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  8032d0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8032d3:	01 d8                	add    %ebx,%eax
+  8032d5:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  8032d9:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  8032dd:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  8032e4:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8032eb:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8032f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8032f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032fd:	4c 89 ee             	mov    %r13,%rsi
+  803300:	bf 03 00 00 00       	mov    $0x3,%edi
+  803305:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  80330c:	00 00 00 
+  80330f:	ff d0                	call   *%rax
+        if (res < 0)
+  803311:	85 c0                	test   %eax,%eax
+  803313:	78 4d                	js     803362 <devfile_read+0x14b>
+        if (res == 0)
+  803315:	74 4f                	je     803366 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803317:	4c 63 e0             	movslq %eax,%r12
+  80331a:	4c 89 e2             	mov    %r12,%rdx
+  80331d:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803321:	4c 89 f7             	mov    %r14,%rdi
+  803324:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  80332b:	00 00 00 
+  80332e:	ff d0                	call   *%rax
+        i += res;
+  803330:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803333:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803336:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80333a:	48 39 c3             	cmp    %rax,%rbx
+  80333d:	0f 82 72 ff ff ff    	jb     8032b5 <devfile_read+0x9e>
+    return i;
+  803343:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803346:	48 85 c0             	test   %rax,%rax
+  803349:	7e 04                	jle    80334f <devfile_read+0x138>
+  80334b:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  80334f:	48 83 c4 28          	add    $0x28,%rsp
+  803353:	5b                   	pop    %rbx
+  803354:	41 5c                	pop    %r12
+  803356:	41 5d                	pop    %r13
+  803358:	41 5e                	pop    %r14
+  80335a:	41 5f                	pop    %r15
+  80335c:	5d                   	pop    %rbp
+  80335d:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80335e:	48 98                	cltq
+  803360:	eb ed                	jmp    80334f <devfile_read+0x138>
+            return res;
+  803362:	48 98                	cltq
+  803364:	eb e9                	jmp    80334f <devfile_read+0x138>
+            return i;
+  803366:	48 89 d8             	mov    %rbx,%rax
+  803369:	eb db                	jmp    803346 <devfile_read+0x12f>
+    size_t i = 0;
+  80336b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80336f:	eb d2                	jmp    803343 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803371:	48 89 c6             	mov    %rax,%rsi
+  803374:	4c 89 ff             	mov    %r15,%rdi
+  803377:	48 b8 89 2c 80 00 00 	movabs $0x802c89,%rax
+  80337e:	00 00 00 
+  803381:	ff d0                	call   *%rax
+  803383:	85 c0                	test   %eax,%eax
+  803385:	78 40                	js     8033c7 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803387:	4c 89 ff             	mov    %r15,%rdi
+  80338a:	48 b8 8d 21 80 00 00 	movabs $0x80218d,%rax
+  803391:	00 00 00 
+  803394:	ff d0                	call   *%rax
+  803396:	48 89 c2             	mov    %rax,%rdx
+  803399:	48 c1 e2 04          	shl    $0x4,%rdx
+  80339d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8033a1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8033a5:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8033aa:	48 01 d0             	add    %rdx,%rax
+  8033ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8033b1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8033b6:	0f 84 33 01 00 00    	je     8034ef <devfile_read+0x2d8>
+    size_t i = 0;
+  8033bc:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8033c2:	e9 f5 00 00 00       	jmp    8034bc <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8033c7:	48 98                	cltq
+  8033c9:	eb 84                	jmp    80334f <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8033cb:	44 89 e8             	mov    %r13d,%eax
+  8033ce:	66 b8 00 00          	mov    $0x0,%ax
+  8033d2:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8033d7:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8033de:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8033e0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8033e4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8033e8:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8033ea:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8033ef:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8033f2:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8033f9:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8033fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803400:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803405:	ba 00 10 01 00       	mov    $0x11000,%edx
+  80340a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80340f:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  803416:	00 00 00 
+  803419:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  80341b:	85 c0                	test   %eax,%eax
+  80341d:	0f 88 be 00 00 00    	js     8034e1 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803423:	48 63 d0             	movslq %eax,%rdx
+  803426:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  80342b:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803430:	44 39 e8             	cmp    %r13d,%eax
+  803433:	0f 8e ba 00 00 00    	jle    8034f3 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803439:	49 63 c5             	movslq %r13d,%rax
+  80343c:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803441:	48 29 c3             	sub    %rax,%rbx
+  803444:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803449:	48 01 c3             	add    %rax,%rbx
+  80344c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803450:	4c 29 f0             	sub    %r14,%rax
+  803453:	48 39 c3             	cmp    %rax,%rbx
+  803456:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80345a:	4c 89 ff             	mov    %r15,%rdi
+  80345d:	48 b9 8d 21 80 00 00 	movabs $0x80218d,%rcx
+  803464:	00 00 00 
+  803467:	ff d1                	call   *%rcx
+  803469:	48 89 c2             	mov    %rax,%rdx
+  80346c:	48 c1 e2 04          	shl    $0x4,%rdx
+  803470:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803474:	48 c1 e0 0c          	shl    $0xc,%rax
+  803478:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  80347d:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803480:	44 89 ea             	mov    %r13d,%edx
+  803483:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803488:	48 63 d2             	movslq %edx,%rdx
+  80348b:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803492:	00 
+  803493:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803497:	4c 01 f7             	add    %r14,%rdi
+  80349a:	48 89 da             	mov    %rbx,%rdx
+  80349d:	48 b9 fe 12 80 00 00 	movabs $0x8012fe,%rcx
+  8034a4:	00 00 00 
+  8034a7:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8034a9:	41 01 dd             	add    %ebx,%r13d
+  8034ac:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8034b0:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8034b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034b7:	49 39 c6             	cmp    %rax,%r14
+  8034ba:	73 37                	jae    8034f3 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8034bc:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8034c0:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8034c5:	44 39 e8             	cmp    %r13d,%eax
+  8034c8:	0f 8f fd fe ff ff    	jg     8033cb <devfile_read+0x1b4>
+  8034ce:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8034d3:	44 39 e8             	cmp    %r13d,%eax
+  8034d6:	0f 8f 5d ff ff ff    	jg     803439 <devfile_read+0x222>
+  8034dc:	e9 ea fe ff ff       	jmp    8033cb <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8034e1:	48 98                	cltq
+  8034e3:	4d 85 f6             	test   %r14,%r14
+  8034e6:	49 0f 45 c6          	cmovne %r14,%rax
+  8034ea:	e9 60 fe ff ff       	jmp    80334f <devfile_read+0x138>
+    size_t i = 0;
+  8034ef:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8034f3:	4c 89 f0             	mov    %r14,%rax
+  8034f6:	e9 54 fe ff ff       	jmp    80334f <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8034fb:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803502:	e9 48 fe ff ff       	jmp    80334f <devfile_read+0x138>
+
+0000000000803507 <open>:
+open(const char *path, int mode) {
+  803507:	55                   	push   %rbp
+  803508:	48 89 e5             	mov    %rsp,%rbp
+  80350b:	41 55                	push   %r13
+  80350d:	41 54                	push   %r12
+  80350f:	53                   	push   %rbx
+  803510:	48 83 ec 18          	sub    $0x18,%rsp
+  803514:	49 89 fc             	mov    %rdi,%r12
+  803517:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80351a:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  803521:	00 00 00 
+  803524:	ff d0                	call   *%rax
+  803526:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80352c:	0f 87 8a 00 00 00    	ja     8035bc <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803532:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803536:	48 b8 bb 21 80 00 00 	movabs $0x8021bb,%rax
+  80353d:	00 00 00 
+  803540:	ff d0                	call   *%rax
+  803542:	89 c3                	mov    %eax,%ebx
+  803544:	85 c0                	test   %eax,%eax
+  803546:	78 50                	js     803598 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803548:	4c 89 e6             	mov    %r12,%rsi
+  80354b:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803552:	00 00 00 
+  803555:	48 89 df             	mov    %rbx,%rdi
+  803558:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  80355f:	00 00 00 
+  803562:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803564:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80356b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80356f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803574:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  80357b:	00 00 00 
+  80357e:	ff d0                	call   *%rax
+  803580:	89 c3                	mov    %eax,%ebx
+  803582:	85 c0                	test   %eax,%eax
+  803584:	78 1f                	js     8035a5 <open+0x9e>
+    return fd2num(fd);
+  803586:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80358a:	48 b8 8d 21 80 00 00 	movabs $0x80218d,%rax
+  803591:	00 00 00 
+  803594:	ff d0                	call   *%rax
+  803596:	89 c3                	mov    %eax,%ebx
+}
+  803598:	89 d8                	mov    %ebx,%eax
+  80359a:	48 83 c4 18          	add    $0x18,%rsp
+  80359e:	5b                   	pop    %rbx
+  80359f:	41 5c                	pop    %r12
+  8035a1:	41 5d                	pop    %r13
+  8035a3:	5d                   	pop    %rbp
+  8035a4:	c3                   	ret
+        fd_close(fd, 0);
+  8035a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8035aa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035ae:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  8035b5:	00 00 00 
+  8035b8:	ff d0                	call   *%rax
+        return res;
+  8035ba:	eb dc                	jmp    803598 <open+0x91>
+        return -E_BAD_PATH;
+  8035bc:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035c1:	eb d5                	jmp    803598 <open+0x91>
+
+00000000008035c3 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8035c3:	55                   	push   %rbp
+  8035c4:	48 89 e5             	mov    %rsp,%rbp
+  8035c7:	41 57                	push   %r15
+  8035c9:	41 56                	push   %r14
+  8035cb:	41 55                	push   %r13
+  8035cd:	41 54                	push   %r12
+  8035cf:	53                   	push   %rbx
+  8035d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8035d4:	41 89 f6             	mov    %esi,%r14d
+  8035d7:	49 89 d7             	mov    %rdx,%r15
+  8035da:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8035dd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8035e1:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  8035e8:	00 00 00 
+  8035eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035ed:	85 c0                	test   %eax,%eax
+  8035ef:	0f 88 db 00 00 00    	js     8036d0 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8035f5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035f9:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803600:	00 00 00 
+  803603:	8b 00                	mov    (%rax),%eax
+  803605:	39 07                	cmp    %eax,(%rdi)
+  803607:	0f 85 db 00 00 00    	jne    8036e8 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80360d:	45 85 f6             	test   %r14d,%r14d
+  803610:	0f 88 db 00 00 00    	js     8036f1 <fmap+0x12e>
+  803616:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80361d:	0f 85 d7 00 00 00    	jne    8036fa <fmap+0x137>
+  803623:	4c 89 fb             	mov    %r15,%rbx
+  803626:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80362c:	0f 85 d1 00 00 00    	jne    803703 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803632:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  803639:	00 00 00 
+  80363c:	ff d0                	call   *%rax
+  80363e:	85 c0                	test   %eax,%eax
+  803640:	0f 88 8e 00 00 00    	js     8036d4 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803646:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80364d:	00 00 00 
+    while (i < n) {
+  803650:	4d 85 ed             	test   %r13,%r13
+  803653:	0f 84 8a 00 00 00    	je     8036e3 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803659:	4c 89 ea             	mov    %r13,%rdx
+  80365c:	48 29 da             	sub    %rbx,%rdx
+  80365f:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803666:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80366c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803670:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803674:	8b 40 0c             	mov    0xc(%rax),%eax
+  803677:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80367b:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  80367f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803684:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803689:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80368d:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803691:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803696:	4c 89 e6             	mov    %r12,%rsi
+  803699:	bf 09 00 00 00       	mov    $0x9,%edi
+  80369e:	48 b8 e1 2a 80 00 00 	movabs $0x802ae1,%rax
+  8036a5:	00 00 00 
+  8036a8:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8036aa:	85 c0                	test   %eax,%eax
+  8036ac:	78 2a                	js     8036d8 <fmap+0x115>
+        i += res;
+  8036ae:	48 98                	cltq
+  8036b0:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8036b3:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8036b7:	72 05                	jb     8036be <fmap+0xfb>
+    while (i < n) {
+  8036b9:	4c 39 eb             	cmp    %r13,%rbx
+  8036bc:	72 9b                	jb     803659 <fmap+0x96>
+    }
+    return i;
+  8036be:	48 89 d8             	mov    %rbx,%rax
+}
+  8036c1:	48 83 c4 18          	add    $0x18,%rsp
+  8036c5:	5b                   	pop    %rbx
+  8036c6:	41 5c                	pop    %r12
+  8036c8:	41 5d                	pop    %r13
+  8036ca:	41 5e                	pop    %r14
+  8036cc:	41 5f                	pop    %r15
+  8036ce:	5d                   	pop    %rbp
+  8036cf:	c3                   	ret
+    if (res < 0) return res;
+  8036d0:	48 98                	cltq
+  8036d2:	eb ed                	jmp    8036c1 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8036d4:	48 98                	cltq
+  8036d6:	eb e9                	jmp    8036c1 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8036d8:	48 98                	cltq
+  8036da:	48 85 db             	test   %rbx,%rbx
+  8036dd:	48 0f 45 c3          	cmovne %rbx,%rax
+  8036e1:	eb de                	jmp    8036c1 <fmap+0xfe>
+    size_t i = 0;
+  8036e3:	4c 89 eb             	mov    %r13,%rbx
+  8036e6:	eb d6                	jmp    8036be <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8036e8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8036ef:	eb d0                	jmp    8036c1 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8036f1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036f8:	eb c7                	jmp    8036c1 <fmap+0xfe>
+  8036fa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803701:	eb be                	jmp    8036c1 <fmap+0xfe>
+  803703:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80370a:	eb b5                	jmp    8036c1 <fmap+0xfe>
+
+000000000080370c <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80370c:	55                   	push   %rbp
+  80370d:	48 89 e5             	mov    %rsp,%rbp
+  803710:	41 56                	push   %r14
+  803712:	41 55                	push   %r13
+  803714:	41 54                	push   %r12
+  803716:	53                   	push   %rbx
+  803717:	48 83 ec 10          	sub    $0x10,%rsp
+  80371b:	89 fb                	mov    %edi,%ebx
+  80371d:	41 89 f4             	mov    %esi,%r12d
+  803720:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803723:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803727:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  80372e:	00 00 00 
+  803731:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803733:	85 c0                	test   %eax,%eax
+  803735:	78 63                	js     80379a <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803737:	45 85 e4             	test   %r12d,%r12d
+  80373a:	0f 88 80 00 00 00    	js     8037c0 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803740:	45 89 e6             	mov    %r12d,%r14d
+  803743:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80374a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80374e:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803755:	00 00 00 
+  803758:	ff d0                	call   *%rax
+  80375a:	48 89 c2             	mov    %rax,%rdx
+  80375d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803762:	44 89 f6             	mov    %r14d,%esi
+  803765:	89 df                	mov    %ebx,%edi
+  803767:	48 b8 c3 35 80 00 00 	movabs $0x8035c3,%rax
+  80376e:	00 00 00 
+  803771:	ff d0                	call   *%rax
+  803773:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803776:	45 29 f4             	sub    %r14d,%r12d
+  803779:	4d 63 f4             	movslq %r12d,%r14
+  80377c:	49 39 c6             	cmp    %rax,%r14
+  80377f:	7c 1d                	jl     80379e <read_map+0x92>
+  803781:	48 85 c0             	test   %rax,%rax
+  803784:	b8 00 00 00 00       	mov    $0x0,%eax
+  803789:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80378d:	48 83 c4 10          	add    $0x10,%rsp
+  803791:	5b                   	pop    %rbx
+  803792:	41 5c                	pop    %r12
+  803794:	41 5d                	pop    %r13
+  803796:	41 5e                	pop    %r14
+  803798:	5d                   	pop    %rbp
+  803799:	c3                   	ret
+    if (res < 0) return res;
+  80379a:	48 98                	cltq
+  80379c:	eb ef                	jmp    80378d <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  80379e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8037a2:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  8037a9:	00 00 00 
+  8037ac:	ff d0                	call   *%rax
+  8037ae:	4d 63 e4             	movslq %r12d,%r12
+  8037b1:	4c 01 e0             	add    %r12,%rax
+  8037b4:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8037b8:	48 89 d8             	mov    %rbx,%rax
+  8037bb:	4c 29 f0             	sub    %r14,%rax
+  8037be:	eb cd                	jmp    80378d <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8037c0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037c7:	eb c4                	jmp    80378d <read_map+0x81>
+
+00000000008037c9 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8037c9:	55                   	push   %rbp
+  8037ca:	48 89 e5             	mov    %rsp,%rbp
+  8037cd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8037d1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037d5:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  8037dc:	00 00 00 
+  8037df:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037e1:	85 c0                	test   %eax,%eax
+  8037e3:	78 4a                	js     80382f <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8037e5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8037e9:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8037f0:	00 00 00 
+  8037f3:	8b 00                	mov    (%rax),%eax
+  8037f5:	39 07                	cmp    %eax,(%rdi)
+  8037f7:	75 38                	jne    803831 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8037f9:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  803800:	00 00 00 
+  803803:	ff d0                	call   *%rax
+  803805:	85 c0                	test   %eax,%eax
+  803807:	78 26                	js     80382f <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803809:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80380d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803810:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803817:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803819:	be 00 00 00 00       	mov    $0x0,%esi
+  80381e:	bf 06 00 00 00       	mov    $0x6,%edi
+  803823:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  80382a:	00 00 00 
+  80382d:	ff d0                	call   *%rax
+}
+  80382f:	c9                   	leave
+  803830:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803831:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803836:	eb f7                	jmp    80382f <fsync+0x66>
+
+0000000000803838 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803838:	55                   	push   %rbp
+  803839:	48 89 e5             	mov    %rsp,%rbp
+  80383c:	41 57                	push   %r15
+  80383e:	41 56                	push   %r14
+  803840:	41 55                	push   %r13
+  803842:	41 54                	push   %r12
+  803844:	53                   	push   %rbx
+  803845:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803849:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803850:	00 00 00 
+  803853:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803858:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80385e:	49 bd 1b 22 80 00 00 	movabs $0x80221b,%r13
+  803865:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803868:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  80386f:	00 00 00 
+  803872:	eb 0c                	jmp    803880 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803874:	83 c3 01             	add    $0x1,%ebx
+  803877:	49 83 c4 28          	add    $0x28,%r12
+  80387b:	83 fb 20             	cmp    $0x20,%ebx
+  80387e:	74 33                	je     8038b3 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803880:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803885:	74 ed                	je     803874 <flushall+0x3c>
+  803887:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80388b:	89 df                	mov    %ebx,%edi
+  80388d:	41 ff d5             	call   *%r13
+  803890:	85 c0                	test   %eax,%eax
+  803892:	78 e0                	js     803874 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803894:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803898:	41 8b 06             	mov    (%r14),%eax
+  80389b:	39 07                	cmp    %eax,(%rdi)
+  80389d:	75 d5                	jne    803874 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  80389f:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  8038a6:	00 00 00 
+  8038a9:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8038ab:	85 c0                	test   %eax,%eax
+  8038ad:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8038b1:	eb c1                	jmp    803874 <flushall+0x3c>
+    }
+    return res;
+}
+  8038b3:	44 89 f8             	mov    %r15d,%eax
+  8038b6:	48 83 c4 18          	add    $0x18,%rsp
+  8038ba:	5b                   	pop    %rbx
+  8038bb:	41 5c                	pop    %r12
+  8038bd:	41 5d                	pop    %r13
+  8038bf:	41 5e                	pop    %r14
+  8038c1:	41 5f                	pop    %r15
+  8038c3:	5d                   	pop    %rbp
+  8038c4:	c3                   	ret
+
+00000000008038c5 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8038c5:	55                   	push   %rbp
+  8038c6:	48 89 e5             	mov    %rsp,%rbp
+  8038c9:	53                   	push   %rbx
+  8038ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8038ce:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8038d1:	40 0f b6 c6          	movzbl %sil,%eax
+  8038d5:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8038dc:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8038de:	be 00 00 00 00       	mov    $0x0,%esi
+  8038e3:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8038e8:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  8038ef:	00 00 00 
+  8038f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038f4:	85 c0                	test   %eax,%eax
+  8038f6:	78 23                	js     80391b <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8038f8:	ba 58 06 00 00       	mov    $0x658,%edx
+  8038fd:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803904:	00 00 00 
+  803907:	48 89 df             	mov    %rbx,%rdi
+  80390a:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803911:	00 00 00 
+  803914:	ff d0                	call   *%rax
+    return 0;
+  803916:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80391b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80391f:	c9                   	leave
+  803920:	c3                   	ret
+
+0000000000803921 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803921:	55                   	push   %rbp
+  803922:	48 89 e5             	mov    %rsp,%rbp
+  803925:	53                   	push   %rbx
+  803926:	48 83 ec 08          	sub    $0x8,%rsp
+  80392a:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  80392d:	48 b8 cb 0e 80 00 00 	movabs $0x800ecb,%rax
+  803934:	00 00 00 
+  803937:	ff d0                	call   *%rax
+  803939:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80393f:	77 35                	ja     803976 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803941:	48 89 de             	mov    %rbx,%rsi
+  803944:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80394b:	00 00 00 
+  80394e:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  803955:	00 00 00 
+  803958:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80395a:	be 00 00 00 00       	mov    $0x0,%esi
+  80395f:	bf 07 00 00 00       	mov    $0x7,%edi
+  803964:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  80396b:	00 00 00 
+  80396e:	ff d0                	call   *%rax
+}
+  803970:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803974:	c9                   	leave
+  803975:	c3                   	ret
+        return -E_BAD_PATH;
+  803976:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80397b:	eb f3                	jmp    803970 <remove+0x4f>
+
+000000000080397d <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80397d:	55                   	push   %rbp
+  80397e:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803981:	48 b8 38 38 80 00 00 	movabs $0x803838,%rax
+  803988:	00 00 00 
+  80398b:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80398d:	be 00 00 00 00       	mov    $0x0,%esi
+  803992:	bf 08 00 00 00       	mov    $0x8,%edi
+  803997:	48 b8 8d 2d 80 00 00 	movabs $0x802d8d,%rax
+  80399e:	00 00 00 
+  8039a1:	ff d0                	call   *%rax
+}
+  8039a3:	5d                   	pop    %rbp
+  8039a4:	c3                   	ret
+
+00000000008039a5 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039a5:	55                   	push   %rbp
+  8039a6:	48 89 e5             	mov    %rsp,%rbp
+  8039a9:	41 54                	push   %r12
+  8039ab:	53                   	push   %rbx
+  8039ac:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039af:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  8039b6:	00 00 00 
+  8039b9:	ff d0                	call   *%rax
+  8039bb:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039be:	48 be e0 57 80 00 00 	movabs $0x8057e0,%rsi
+  8039c5:	00 00 00 
+  8039c8:	48 89 df             	mov    %rbx,%rdi
+  8039cb:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  8039d2:	00 00 00 
+  8039d5:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8039d7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8039dc:	41 2b 04 24          	sub    (%r12),%eax
+  8039e0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8039e6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039ed:	00 00 00 
+    stat->st_dev = &devpipe;
+  8039f0:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8039f7:	00 00 00 
+  8039fa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a06:	5b                   	pop    %rbx
+  803a07:	41 5c                	pop    %r12
+  803a09:	5d                   	pop    %rbp
+  803a0a:	c3                   	ret
+
+0000000000803a0b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a0b:	55                   	push   %rbp
+  803a0c:	48 89 e5             	mov    %rsp,%rbp
+  803a0f:	41 54                	push   %r12
+  803a11:	53                   	push   %rbx
+  803a12:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a15:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a1a:	48 89 fe             	mov    %rdi,%rsi
+  803a1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a22:	49 bc 48 18 80 00 00 	movabs $0x801848,%r12
+  803a29:	00 00 00 
+  803a2c:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803a2f:	48 89 df             	mov    %rbx,%rdi
+  803a32:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803a39:	00 00 00 
+  803a3c:	ff d0                	call   *%rax
+  803a3e:	48 89 c6             	mov    %rax,%rsi
+  803a41:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a46:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a4b:	41 ff d4             	call   *%r12
+}
+  803a4e:	5b                   	pop    %rbx
+  803a4f:	41 5c                	pop    %r12
+  803a51:	5d                   	pop    %rbp
+  803a52:	c3                   	ret
+
+0000000000803a53 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803a53:	55                   	push   %rbp
+  803a54:	48 89 e5             	mov    %rsp,%rbp
+  803a57:	41 57                	push   %r15
+  803a59:	41 56                	push   %r14
+  803a5b:	41 55                	push   %r13
+  803a5d:	41 54                	push   %r12
+  803a5f:	53                   	push   %rbx
+  803a60:	48 83 ec 18          	sub    $0x18,%rsp
+  803a64:	49 89 fc             	mov    %rdi,%r12
+  803a67:	49 89 f5             	mov    %rsi,%r13
+  803a6a:	49 89 d7             	mov    %rdx,%r15
+  803a6d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a71:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803a78:	00 00 00 
+  803a7b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803a7d:	4d 85 ff             	test   %r15,%r15
+  803a80:	0f 84 af 00 00 00    	je     803b35 <devpipe_write+0xe2>
+  803a86:	48 89 c3             	mov    %rax,%rbx
+  803a89:	4c 89 f8             	mov    %r15,%rax
+  803a8c:	4d 89 ef             	mov    %r13,%r15
+  803a8f:	4c 01 e8             	add    %r13,%rax
+  803a92:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a96:	49 bd 3d 16 80 00 00 	movabs $0x80163d,%r13
+  803a9d:	00 00 00 
+            sys_yield();
+  803aa0:	49 be da 15 80 00 00 	movabs $0x8015da,%r14
+  803aa7:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803aaa:	8b 73 04             	mov    0x4(%rbx),%esi
+  803aad:	48 63 ce             	movslq %esi,%rcx
+  803ab0:	48 63 03             	movslq (%rbx),%rax
+  803ab3:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803ab9:	48 39 c1             	cmp    %rax,%rcx
+  803abc:	72 2e                	jb     803aec <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803abe:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ac3:	48 89 da             	mov    %rbx,%rdx
+  803ac6:	be 00 10 00 00       	mov    $0x1000,%esi
+  803acb:	4c 89 e7             	mov    %r12,%rdi
+  803ace:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803ad1:	85 c0                	test   %eax,%eax
+  803ad3:	74 66                	je     803b3b <devpipe_write+0xe8>
+            sys_yield();
+  803ad5:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ad8:	8b 73 04             	mov    0x4(%rbx),%esi
+  803adb:	48 63 ce             	movslq %esi,%rcx
+  803ade:	48 63 03             	movslq (%rbx),%rax
+  803ae1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803ae7:	48 39 c1             	cmp    %rax,%rcx
+  803aea:	73 d2                	jae    803abe <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803aec:	41 0f b6 3f          	movzbl (%r15),%edi
+  803af0:	48 89 ca             	mov    %rcx,%rdx
+  803af3:	48 c1 ea 03          	shr    $0x3,%rdx
+  803af7:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803afe:	08 10 20 
+  803b01:	48 f7 e2             	mul    %rdx
+  803b04:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b08:	48 89 d0             	mov    %rdx,%rax
+  803b0b:	48 c1 e0 09          	shl    $0x9,%rax
+  803b0f:	48 29 d0             	sub    %rdx,%rax
+  803b12:	48 c1 e0 03          	shl    $0x3,%rax
+  803b16:	48 29 c1             	sub    %rax,%rcx
+  803b19:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803b1e:	83 c6 01             	add    $0x1,%esi
+  803b21:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b24:	49 83 c7 01          	add    $0x1,%r15
+  803b28:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b2c:	49 39 c7             	cmp    %rax,%r15
+  803b2f:	0f 85 75 ff ff ff    	jne    803aaa <devpipe_write+0x57>
+    return n;
+  803b35:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b39:	eb 05                	jmp    803b40 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b40:	48 83 c4 18          	add    $0x18,%rsp
+  803b44:	5b                   	pop    %rbx
+  803b45:	41 5c                	pop    %r12
+  803b47:	41 5d                	pop    %r13
+  803b49:	41 5e                	pop    %r14
+  803b4b:	41 5f                	pop    %r15
+  803b4d:	5d                   	pop    %rbp
+  803b4e:	c3                   	ret
+
+0000000000803b4f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803b4f:	55                   	push   %rbp
+  803b50:	48 89 e5             	mov    %rsp,%rbp
+  803b53:	41 57                	push   %r15
+  803b55:	41 56                	push   %r14
+  803b57:	41 55                	push   %r13
+  803b59:	41 54                	push   %r12
+  803b5b:	53                   	push   %rbx
+  803b5c:	48 83 ec 18          	sub    $0x18,%rsp
+  803b60:	49 89 fc             	mov    %rdi,%r12
+  803b63:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b67:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b6b:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803b72:	00 00 00 
+  803b75:	ff d0                	call   *%rax
+  803b77:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b7a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b80:	49 bd 3d 16 80 00 00 	movabs $0x80163d,%r13
+  803b87:	00 00 00 
+            sys_yield();
+  803b8a:	49 be da 15 80 00 00 	movabs $0x8015da,%r14
+  803b91:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b94:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b99:	74 7d                	je     803c18 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b9b:	8b 03                	mov    (%rbx),%eax
+  803b9d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803ba0:	75 26                	jne    803bc8 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803ba2:	4d 85 ff             	test   %r15,%r15
+  803ba5:	75 77                	jne    803c1e <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ba7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803bac:	48 89 da             	mov    %rbx,%rdx
+  803baf:	be 00 10 00 00       	mov    $0x1000,%esi
+  803bb4:	4c 89 e7             	mov    %r12,%rdi
+  803bb7:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803bba:	85 c0                	test   %eax,%eax
+  803bbc:	74 72                	je     803c30 <devpipe_read+0xe1>
+            sys_yield();
+  803bbe:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803bc1:	8b 03                	mov    (%rbx),%eax
+  803bc3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803bc6:	74 df                	je     803ba7 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803bc8:	48 63 c8             	movslq %eax,%rcx
+  803bcb:	48 89 ca             	mov    %rcx,%rdx
+  803bce:	48 c1 ea 03          	shr    $0x3,%rdx
+  803bd2:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803bd9:	08 10 20 
+  803bdc:	48 89 d0             	mov    %rdx,%rax
+  803bdf:	48 f7 e6             	mul    %rsi
+  803be2:	48 c1 ea 06          	shr    $0x6,%rdx
+  803be6:	48 89 d0             	mov    %rdx,%rax
+  803be9:	48 c1 e0 09          	shl    $0x9,%rax
+  803bed:	48 29 d0             	sub    %rdx,%rax
+  803bf0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803bf7:	00 
+  803bf8:	48 89 c8             	mov    %rcx,%rax
+  803bfb:	48 29 d0             	sub    %rdx,%rax
+  803bfe:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803c03:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803c07:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803c0b:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c0e:	49 83 c7 01          	add    $0x1,%r15
+  803c12:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803c16:	75 83                	jne    803b9b <devpipe_read+0x4c>
+    return n;
+  803c18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c1c:	eb 03                	jmp    803c21 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803c1e:	4c 89 f8             	mov    %r15,%rax
+}
+  803c21:	48 83 c4 18          	add    $0x18,%rsp
+  803c25:	5b                   	pop    %rbx
+  803c26:	41 5c                	pop    %r12
+  803c28:	41 5d                	pop    %r13
+  803c2a:	41 5e                	pop    %r14
+  803c2c:	41 5f                	pop    %r15
+  803c2e:	5d                   	pop    %rbp
+  803c2f:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c35:	eb ea                	jmp    803c21 <devpipe_read+0xd2>
+
+0000000000803c37 <pipe>:
+pipe(int pfd[2]) {
+  803c37:	55                   	push   %rbp
+  803c38:	48 89 e5             	mov    %rsp,%rbp
+  803c3b:	41 55                	push   %r13
+  803c3d:	41 54                	push   %r12
+  803c3f:	53                   	push   %rbx
+  803c40:	48 83 ec 18          	sub    $0x18,%rsp
+  803c44:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c47:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c4b:	48 b8 bb 21 80 00 00 	movabs $0x8021bb,%rax
+  803c52:	00 00 00 
+  803c55:	ff d0                	call   *%rax
+  803c57:	89 c3                	mov    %eax,%ebx
+  803c59:	85 c0                	test   %eax,%eax
+  803c5b:	0f 88 a0 01 00 00    	js     803e01 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803c61:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c66:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c6b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c74:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  803c7b:	00 00 00 
+  803c7e:	ff d0                	call   *%rax
+  803c80:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c82:	85 c0                	test   %eax,%eax
+  803c84:	0f 88 77 01 00 00    	js     803e01 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c8a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c8e:	48 b8 bb 21 80 00 00 	movabs $0x8021bb,%rax
+  803c95:	00 00 00 
+  803c98:	ff d0                	call   *%rax
+  803c9a:	89 c3                	mov    %eax,%ebx
+  803c9c:	85 c0                	test   %eax,%eax
+  803c9e:	0f 88 43 01 00 00    	js     803de7 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803ca4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ca9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cae:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803cb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb7:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  803cbe:	00 00 00 
+  803cc1:	ff d0                	call   *%rax
+  803cc3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803cc5:	85 c0                	test   %eax,%eax
+  803cc7:	0f 88 1a 01 00 00    	js     803de7 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ccd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cd1:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803cd8:	00 00 00 
+  803cdb:	ff d0                	call   *%rax
+  803cdd:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803ce0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ce5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cea:	48 89 c6             	mov    %rax,%rsi
+  803ced:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cf2:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  803cf9:	00 00 00 
+  803cfc:	ff d0                	call   *%rax
+  803cfe:	89 c3                	mov    %eax,%ebx
+  803d00:	85 c0                	test   %eax,%eax
+  803d02:	0f 88 c5 00 00 00    	js     803dcd <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803d08:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d0c:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803d13:	00 00 00 
+  803d16:	ff d0                	call   *%rax
+  803d18:	48 89 c1             	mov    %rax,%rcx
+  803d1b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803d21:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803d27:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d2c:	4c 89 ee             	mov    %r13,%rsi
+  803d2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d34:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  803d3b:	00 00 00 
+  803d3e:	ff d0                	call   *%rax
+  803d40:	89 c3                	mov    %eax,%ebx
+  803d42:	85 c0                	test   %eax,%eax
+  803d44:	78 6e                	js     803db4 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d46:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d4b:	4c 89 ef             	mov    %r13,%rdi
+  803d4e:	48 b8 0b 16 80 00 00 	movabs $0x80160b,%rax
+  803d55:	00 00 00 
+  803d58:	ff d0                	call   *%rax
+  803d5a:	83 f8 02             	cmp    $0x2,%eax
+  803d5d:	0f 85 ab 00 00 00    	jne    803e0e <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803d63:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803d6a:	00 00 
+  803d6c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d70:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803d72:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d76:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d7d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d81:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d83:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d87:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d8e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d92:	48 bb 8d 21 80 00 00 	movabs $0x80218d,%rbx
+  803d99:	00 00 00 
+  803d9c:	ff d3                	call   *%rbx
+  803d9e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803da2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803da6:	ff d3                	call   *%rbx
+  803da8:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803dad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803db2:	eb 4d                	jmp    803e01 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803db4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803db9:	4c 89 ee             	mov    %r13,%rsi
+  803dbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dc1:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  803dc8:	00 00 00 
+  803dcb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803dcd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dd2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803dd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ddb:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  803de2:	00 00 00 
+  803de5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803de7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dec:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803df0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803df5:	48 b8 48 18 80 00 00 	movabs $0x801848,%rax
+  803dfc:	00 00 00 
+  803dff:	ff d0                	call   *%rax
+}
+  803e01:	89 d8                	mov    %ebx,%eax
+  803e03:	48 83 c4 18          	add    $0x18,%rsp
+  803e07:	5b                   	pop    %rbx
+  803e08:	41 5c                	pop    %r12
+  803e0a:	41 5d                	pop    %r13
+  803e0c:	5d                   	pop    %rbp
+  803e0d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e0e:	48 b9 10 58 80 00 00 	movabs $0x805810,%rcx
+  803e15:	00 00 00 
+  803e18:	48 ba e7 57 80 00 00 	movabs $0x8057e7,%rdx
+  803e1f:	00 00 00 
+  803e22:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803e27:	48 bf fc 57 80 00 00 	movabs $0x8057fc,%rdi
+  803e2e:	00 00 00 
+  803e31:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e36:	49 b8 41 04 80 00 00 	movabs $0x800441,%r8
+  803e3d:	00 00 00 
+  803e40:	41 ff d0             	call   *%r8
+
+0000000000803e43 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e43:	55                   	push   %rbp
+  803e44:	48 89 e5             	mov    %rsp,%rbp
+  803e47:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e4b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e4f:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  803e56:	00 00 00 
+  803e59:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e5b:	85 c0                	test   %eax,%eax
+  803e5d:	78 35                	js     803e94 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803e5f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e63:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803e6a:	00 00 00 
+  803e6d:	ff d0                	call   *%rax
+  803e6f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e72:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e77:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e7c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e80:	48 b8 3d 16 80 00 00 	movabs $0x80163d,%rax
+  803e87:	00 00 00 
+  803e8a:	ff d0                	call   *%rax
+  803e8c:	85 c0                	test   %eax,%eax
+  803e8e:	0f 94 c0             	sete   %al
+  803e91:	0f b6 c0             	movzbl %al,%eax
+}
+  803e94:	c9                   	leave
+  803e95:	c3                   	ret
+
+0000000000803e96 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e96:	48 89 f8             	mov    %rdi,%rax
+  803e99:	48 c1 e8 27          	shr    $0x27,%rax
+  803e9d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803ea4:	7f 00 00 
+  803ea7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803eab:	f6 c2 01             	test   $0x1,%dl
+  803eae:	74 6d                	je     803f1d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803eb0:	48 89 f8             	mov    %rdi,%rax
+  803eb3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803eb7:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ebe:	7f 00 00 
+  803ec1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ec5:	f6 c2 01             	test   $0x1,%dl
+  803ec8:	74 62                	je     803f2c <get_uvpt_entry+0x96>
+  803eca:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ed1:	7f 00 00 
+  803ed4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ed8:	f6 c2 80             	test   $0x80,%dl
+  803edb:	75 4f                	jne    803f2c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803edd:	48 89 f8             	mov    %rdi,%rax
+  803ee0:	48 c1 e8 15          	shr    $0x15,%rax
+  803ee4:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803eeb:	7f 00 00 
+  803eee:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ef2:	f6 c2 01             	test   $0x1,%dl
+  803ef5:	74 44                	je     803f3b <get_uvpt_entry+0xa5>
+  803ef7:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803efe:	7f 00 00 
+  803f01:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f05:	f6 c2 80             	test   $0x80,%dl
+  803f08:	75 31                	jne    803f3b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803f0a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803f0e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f15:	7f 00 00 
+  803f18:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803f1c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f1d:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803f24:	7f 00 00 
+  803f27:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f2b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f2c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f33:	7f 00 00 
+  803f36:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f3a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f3b:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f42:	7f 00 00 
+  803f45:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f49:	c3                   	ret
+
+0000000000803f4a <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803f4a:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f4d:	48 89 f9             	mov    %rdi,%rcx
+  803f50:	48 c1 e9 27          	shr    $0x27,%rcx
+  803f54:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803f5b:	7f 00 00 
+  803f5e:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803f62:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f69:	f6 c1 01             	test   $0x1,%cl
+  803f6c:	0f 84 b2 00 00 00    	je     804024 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f72:	48 89 f9             	mov    %rdi,%rcx
+  803f75:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803f79:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f80:	7f 00 00 
+  803f83:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f87:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f8e:	40 f6 c6 01          	test   $0x1,%sil
+  803f92:	0f 84 8c 00 00 00    	je     804024 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803f98:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f9f:	7f 00 00 
+  803fa2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fa6:	a8 80                	test   $0x80,%al
+  803fa8:	75 7b                	jne    804025 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803faa:	48 89 f9             	mov    %rdi,%rcx
+  803fad:	48 c1 e9 15          	shr    $0x15,%rcx
+  803fb1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fb8:	7f 00 00 
+  803fbb:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803fbf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803fc6:	40 f6 c6 01          	test   $0x1,%sil
+  803fca:	74 58                	je     804024 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803fcc:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fd3:	7f 00 00 
+  803fd6:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fda:	a8 80                	test   $0x80,%al
+  803fdc:	75 6c                	jne    80404a <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803fde:	48 89 f9             	mov    %rdi,%rcx
+  803fe1:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803fe5:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803fec:	7f 00 00 
+  803fef:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ff3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803ffa:	40 f6 c6 01          	test   $0x1,%sil
+  803ffe:	74 24                	je     804024 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804000:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804007:	7f 00 00 
+  80400a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80400e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804015:	ff ff 7f 
+  804018:	48 21 c8             	and    %rcx,%rax
+  80401b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804021:	48 09 d0             	or     %rdx,%rax
+}
+  804024:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804025:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80402c:	7f 00 00 
+  80402f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804033:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80403a:	ff ff 7f 
+  80403d:	48 21 c8             	and    %rcx,%rax
+  804040:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804046:	48 01 d0             	add    %rdx,%rax
+  804049:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80404a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804051:	7f 00 00 
+  804054:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804058:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80405f:	ff ff 7f 
+  804062:	48 21 c8             	and    %rcx,%rax
+  804065:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80406b:	48 01 d0             	add    %rdx,%rax
+  80406e:	c3                   	ret
+
+000000000080406f <get_prot>:
+
+int
+get_prot(void *va) {
+  80406f:	55                   	push   %rbp
+  804070:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804073:	48 b8 96 3e 80 00 00 	movabs $0x803e96,%rax
+  80407a:	00 00 00 
+  80407d:	ff d0                	call   *%rax
+  80407f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804082:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804087:	89 c1                	mov    %eax,%ecx
+  804089:	83 c9 04             	or     $0x4,%ecx
+  80408c:	f6 c2 01             	test   $0x1,%dl
+  80408f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804092:	89 c1                	mov    %eax,%ecx
+  804094:	83 c9 02             	or     $0x2,%ecx
+  804097:	f6 c2 02             	test   $0x2,%dl
+  80409a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80409d:	89 c1                	mov    %eax,%ecx
+  80409f:	83 c9 01             	or     $0x1,%ecx
+  8040a2:	48 85 d2             	test   %rdx,%rdx
+  8040a5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040a8:	89 c1                	mov    %eax,%ecx
+  8040aa:	83 c9 40             	or     $0x40,%ecx
+  8040ad:	f6 c6 04             	test   $0x4,%dh
+  8040b0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040b3:	5d                   	pop    %rbp
+  8040b4:	c3                   	ret
+
+00000000008040b5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040b5:	55                   	push   %rbp
+  8040b6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040b9:	48 b8 96 3e 80 00 00 	movabs $0x803e96,%rax
+  8040c0:	00 00 00 
+  8040c3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040c5:	48 c1 e8 06          	shr    $0x6,%rax
+  8040c9:	83 e0 01             	and    $0x1,%eax
+}
+  8040cc:	5d                   	pop    %rbp
+  8040cd:	c3                   	ret
+
+00000000008040ce <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040ce:	55                   	push   %rbp
+  8040cf:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040d2:	48 b8 96 3e 80 00 00 	movabs $0x803e96,%rax
+  8040d9:	00 00 00 
+  8040dc:	ff d0                	call   *%rax
+  8040de:	83 e0 01             	and    $0x1,%eax
+}
+  8040e1:	5d                   	pop    %rbp
+  8040e2:	c3                   	ret
+
+00000000008040e3 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8040e3:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8040ea:	7f 00 00 
+  8040ed:	a8 01                	test   $0x1,%al
+  8040ef:	75 06                	jne    8040f7 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8040f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f6:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8040f7:	55                   	push   %rbp
+  8040f8:	48 89 e5             	mov    %rsp,%rbp
+  8040fb:	41 57                	push   %r15
+  8040fd:	41 56                	push   %r14
+  8040ff:	41 55                	push   %r13
+  804101:	41 54                	push   %r12
+  804103:	53                   	push   %rbx
+  804104:	48 83 ec 18          	sub    $0x18,%rsp
+  804108:	49 89 fe             	mov    %rdi,%r14
+  80410b:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80410e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804115:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804116:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  80411d:	7f 00 00 
+  804120:	e9 81 00 00 00       	jmp    8041a6 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804125:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80412c:	49 39 dd             	cmp    %rbx,%r13
+  80412f:	74 2b                	je     80415c <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804131:	48 89 d8             	mov    %rbx,%rax
+  804134:	48 c1 e8 0c          	shr    $0xc,%rax
+  804138:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  80413c:	f6 c2 01             	test   $0x1,%dl
+  80413f:	74 e4                	je     804125 <foreach_shared_region+0x42>
+  804141:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804145:	f6 c4 04             	test   $0x4,%ah
+  804148:	74 db                	je     804125 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  80414a:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804151:	4c 89 fa             	mov    %r15,%rdx
+  804154:	48 89 df             	mov    %rbx,%rdi
+  804157:	41 ff d6             	call   *%r14
+  80415a:	eb c9                	jmp    804125 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80415c:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804163:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804167:	74 22                	je     80418b <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804169:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804170:	48 89 d8             	mov    %rbx,%rax
+  804173:	48 c1 e8 15          	shr    $0x15,%rax
+  804177:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  80417e:	7f 00 00 
+  804181:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804185:	a8 01                	test   $0x1,%al
+  804187:	74 d3                	je     80415c <foreach_shared_region+0x79>
+  804189:	eb a6                	jmp    804131 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80418b:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804192:	40 
+  804193:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804197:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80419e:	00 00 00 
+  8041a1:	48 39 c1             	cmp    %rax,%rcx
+  8041a4:	74 31                	je     8041d7 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  8041a6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041aa:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041ae:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8041b5:	7f 00 00 
+  8041b8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041bc:	a8 01                	test   $0x1,%al
+  8041be:	74 cb                	je     80418b <foreach_shared_region+0xa8>
+  8041c0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041c4:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8041cb:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8041d1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8041d5:	eb 92                	jmp    804169 <foreach_shared_region+0x86>
+}
+  8041d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041dc:	48 83 c4 18          	add    $0x18,%rsp
+  8041e0:	5b                   	pop    %rbx
+  8041e1:	41 5c                	pop    %r12
+  8041e3:	41 5d                	pop    %r13
+  8041e5:	41 5e                	pop    %r14
+  8041e7:	41 5f                	pop    %r15
+  8041e9:	5d                   	pop    %rbp
+  8041ea:	c3                   	ret
+
+00000000008041eb <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8041eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f0:	c3                   	ret
+
+00000000008041f1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8041f1:	55                   	push   %rbp
+  8041f2:	48 89 e5             	mov    %rsp,%rbp
+  8041f5:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8041f8:	48 be 34 58 80 00 00 	movabs $0x805834,%rsi
+  8041ff:	00 00 00 
+  804202:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  804209:	00 00 00 
+  80420c:	ff d0                	call   *%rax
+    return 0;
+}
+  80420e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804213:	5d                   	pop    %rbp
+  804214:	c3                   	ret
+
+0000000000804215 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804215:	55                   	push   %rbp
+  804216:	48 89 e5             	mov    %rsp,%rbp
+  804219:	41 57                	push   %r15
+  80421b:	41 56                	push   %r14
+  80421d:	41 55                	push   %r13
+  80421f:	41 54                	push   %r12
+  804221:	53                   	push   %rbx
+  804222:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804229:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804230:	48 85 d2             	test   %rdx,%rdx
+  804233:	74 7a                	je     8042af <devcons_write+0x9a>
+  804235:	49 89 d6             	mov    %rdx,%r14
+  804238:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80423e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804243:	49 bf 97 12 80 00 00 	movabs $0x801297,%r15
+  80424a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80424d:	4c 89 f3             	mov    %r14,%rbx
+  804250:	48 29 f3             	sub    %rsi,%rbx
+  804253:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804258:	48 39 c3             	cmp    %rax,%rbx
+  80425b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80425f:	4c 63 eb             	movslq %ebx,%r13
+  804262:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804269:	48 01 c6             	add    %rax,%rsi
+  80426c:	4c 89 ea             	mov    %r13,%rdx
+  80426f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804276:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804279:	4c 89 ee             	mov    %r13,%rsi
+  80427c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804283:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  80428a:	00 00 00 
+  80428d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80428f:	41 01 dc             	add    %ebx,%r12d
+  804292:	49 63 f4             	movslq %r12d,%rsi
+  804295:	4c 39 f6             	cmp    %r14,%rsi
+  804298:	72 b3                	jb     80424d <devcons_write+0x38>
+    return res;
+  80429a:	49 63 c4             	movslq %r12d,%rax
+}
+  80429d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8042a4:	5b                   	pop    %rbx
+  8042a5:	41 5c                	pop    %r12
+  8042a7:	41 5d                	pop    %r13
+  8042a9:	41 5e                	pop    %r14
+  8042ab:	41 5f                	pop    %r15
+  8042ad:	5d                   	pop    %rbp
+  8042ae:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8042af:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042b5:	eb e3                	jmp    80429a <devcons_write+0x85>
+
+00000000008042b7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042b7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8042ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042bf:	48 85 c0             	test   %rax,%rax
+  8042c2:	74 55                	je     804319 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042c4:	55                   	push   %rbp
+  8042c5:	48 89 e5             	mov    %rsp,%rbp
+  8042c8:	41 55                	push   %r13
+  8042ca:	41 54                	push   %r12
+  8042cc:	53                   	push   %rbx
+  8042cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8042d1:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8042d4:	48 bb 0d 15 80 00 00 	movabs $0x80150d,%rbx
+  8042db:	00 00 00 
+  8042de:	49 bc da 15 80 00 00 	movabs $0x8015da,%r12
+  8042e5:	00 00 00 
+  8042e8:	eb 03                	jmp    8042ed <devcons_read+0x36>
+  8042ea:	41 ff d4             	call   *%r12
+  8042ed:	ff d3                	call   *%rbx
+  8042ef:	85 c0                	test   %eax,%eax
+  8042f1:	74 f7                	je     8042ea <devcons_read+0x33>
+    if (c < 0) return c;
+  8042f3:	48 63 d0             	movslq %eax,%rdx
+  8042f6:	78 13                	js     80430b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8042f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042fd:	83 f8 04             	cmp    $0x4,%eax
+  804300:	74 09                	je     80430b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804302:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804306:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80430b:	48 89 d0             	mov    %rdx,%rax
+  80430e:	48 83 c4 08          	add    $0x8,%rsp
+  804312:	5b                   	pop    %rbx
+  804313:	41 5c                	pop    %r12
+  804315:	41 5d                	pop    %r13
+  804317:	5d                   	pop    %rbp
+  804318:	c3                   	ret
+  804319:	48 89 d0             	mov    %rdx,%rax
+  80431c:	c3                   	ret
+
+000000000080431d <cputchar>:
+cputchar(int ch) {
+  80431d:	55                   	push   %rbp
+  80431e:	48 89 e5             	mov    %rsp,%rbp
+  804321:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804325:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804329:	be 01 00 00 00       	mov    $0x1,%esi
+  80432e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804332:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  804339:	00 00 00 
+  80433c:	ff d0                	call   *%rax
+}
+  80433e:	c9                   	leave
+  80433f:	c3                   	ret
+
+0000000000804340 <getchar>:
+getchar(void) {
+  804340:	55                   	push   %rbp
+  804341:	48 89 e5             	mov    %rsp,%rbp
+  804344:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804348:	ba 01 00 00 00       	mov    $0x1,%edx
+  80434d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804351:	bf 00 00 00 00       	mov    $0x0,%edi
+  804356:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  80435d:	00 00 00 
+  804360:	ff d0                	call   *%rax
+  804362:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804364:	85 c0                	test   %eax,%eax
+  804366:	78 06                	js     80436e <getchar+0x2e>
+  804368:	74 08                	je     804372 <getchar+0x32>
+  80436a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80436e:	89 d0                	mov    %edx,%eax
+  804370:	c9                   	leave
+  804371:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804372:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804377:	eb f5                	jmp    80436e <getchar+0x2e>
+
+0000000000804379 <iscons>:
+iscons(int fdnum) {
+  804379:	55                   	push   %rbp
+  80437a:	48 89 e5             	mov    %rsp,%rbp
+  80437d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804381:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804385:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  80438c:	00 00 00 
+  80438f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804391:	85 c0                	test   %eax,%eax
+  804393:	78 18                	js     8043ad <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804395:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804399:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8043a0:	00 00 00 
+  8043a3:	8b 00                	mov    (%rax),%eax
+  8043a5:	39 02                	cmp    %eax,(%rdx)
+  8043a7:	0f 94 c0             	sete   %al
+  8043aa:	0f b6 c0             	movzbl %al,%eax
+}
+  8043ad:	c9                   	leave
+  8043ae:	c3                   	ret
+
+00000000008043af <opencons>:
+opencons(void) {
+  8043af:	55                   	push   %rbp
+  8043b0:	48 89 e5             	mov    %rsp,%rbp
+  8043b3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8043b7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8043bb:	48 b8 bb 21 80 00 00 	movabs $0x8021bb,%rax
+  8043c2:	00 00 00 
+  8043c5:	ff d0                	call   *%rax
+  8043c7:	85 c0                	test   %eax,%eax
+  8043c9:	78 49                	js     804414 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8043cb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043d5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8043d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043de:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  8043e5:	00 00 00 
+  8043e8:	ff d0                	call   *%rax
+  8043ea:	85 c0                	test   %eax,%eax
+  8043ec:	78 26                	js     804414 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8043ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043f2:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8043f9:	00 00 
+  8043fb:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8043fd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804401:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804408:	48 b8 8d 21 80 00 00 	movabs $0x80218d,%rax
+  80440f:	00 00 00 
+  804412:	ff d0                	call   *%rax
+}
+  804414:	c9                   	leave
+  804415:	c3                   	ret
+
+0000000000804416 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804416:	55                   	push   %rbp
+  804417:	48 89 e5             	mov    %rsp,%rbp
+  80441a:	41 55                	push   %r13
+  80441c:	41 54                	push   %r12
+  80441e:	53                   	push   %rbx
+  80441f:	48 83 ec 08          	sub    $0x8,%rsp
+  804423:	49 89 fc             	mov    %rdi,%r12
+  804426:	48 89 f7             	mov    %rsi,%rdi
+  804429:	48 89 d3             	mov    %rdx,%rbx
+  80442c:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80442f:	48 85 f6             	test   %rsi,%rsi
+  804432:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804439:	00 00 00 
+  80443c:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804440:	be 00 10 00 00       	mov    $0x1000,%esi
+  804445:	48 85 d2             	test   %rdx,%rdx
+  804448:	74 03                	je     80444d <ipc_recv+0x37>
+  80444a:	48 8b 32             	mov    (%rdx),%rsi
+  80444d:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  804454:	00 00 00 
+  804457:	ff d0                	call   *%rax
+    if (errno) {
+  804459:	85 c0                	test   %eax,%eax
+  80445b:	74 1c                	je     804479 <ipc_recv+0x63>
+        if (from_env_store)
+  80445d:	4d 85 e4             	test   %r12,%r12
+  804460:	74 08                	je     80446a <ipc_recv+0x54>
+            *from_env_store = 0;
+  804462:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804469:	00 
+
+        if (perm_store)
+  80446a:	4d 85 ed             	test   %r13,%r13
+  80446d:	74 74                	je     8044e3 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80446f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804476:	00 
+  804477:	eb 6a                	jmp    8044e3 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804479:	4d 85 e4             	test   %r12,%r12
+  80447c:	74 14                	je     804492 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80447e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804485:	00 00 00 
+  804488:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80448e:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804492:	48 85 db             	test   %rbx,%rbx
+  804495:	74 23                	je     8044ba <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804497:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80449e:	00 00 00 
+  8044a1:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8044a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044ac:	85 c9                	test   %ecx,%ecx
+  8044ae:	74 07                	je     8044b7 <ipc_recv+0xa1>
+  8044b0:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8044b7:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8044ba:	4d 85 ed             	test   %r13,%r13
+  8044bd:	74 14                	je     8044d3 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8044bf:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044c6:	00 00 00 
+  8044c9:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8044cf:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8044d3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044da:	00 00 00 
+  8044dd:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8044e3:	48 83 c4 08          	add    $0x8,%rsp
+  8044e7:	5b                   	pop    %rbx
+  8044e8:	41 5c                	pop    %r12
+  8044ea:	41 5d                	pop    %r13
+  8044ec:	5d                   	pop    %rbp
+  8044ed:	c3                   	ret
+
+00000000008044ee <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8044ee:	55                   	push   %rbp
+  8044ef:	48 89 e5             	mov    %rsp,%rbp
+  8044f2:	41 55                	push   %r13
+  8044f4:	41 54                	push   %r12
+  8044f6:	53                   	push   %rbx
+  8044f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8044fb:	49 89 fc             	mov    %rdi,%r12
+  8044fe:	48 89 f7             	mov    %rsi,%rdi
+  804501:	48 89 d3             	mov    %rdx,%rbx
+  804504:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804507:	48 85 f6             	test   %rsi,%rsi
+  80450a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804511:	00 00 00 
+  804514:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804518:	be 00 10 00 00       	mov    $0x1000,%esi
+  80451d:	48 85 d2             	test   %rdx,%rdx
+  804520:	74 03                	je     804525 <ipc_try_recv+0x37>
+  804522:	48 8b 32             	mov    (%rdx),%rsi
+  804525:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  80452c:	00 00 00 
+  80452f:	ff d0                	call   *%rax
+    if (errno) {
+  804531:	85 c0                	test   %eax,%eax
+  804533:	75 75                	jne    8045aa <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804535:	4d 85 e4             	test   %r12,%r12
+  804538:	74 14                	je     80454e <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  80453a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804541:	00 00 00 
+  804544:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80454a:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80454e:	48 85 db             	test   %rbx,%rbx
+  804551:	74 23                	je     804576 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804553:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80455a:	00 00 00 
+  80455d:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804563:	ba 00 00 00 00       	mov    $0x0,%edx
+  804568:	85 c9                	test   %ecx,%ecx
+  80456a:	74 07                	je     804573 <ipc_try_recv+0x85>
+  80456c:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804573:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804576:	4d 85 ed             	test   %r13,%r13
+  804579:	74 14                	je     80458f <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80457b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804582:	00 00 00 
+  804585:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80458b:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80458f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804596:	00 00 00 
+  804599:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80459f:	48 83 c4 08          	add    $0x8,%rsp
+  8045a3:	5b                   	pop    %rbx
+  8045a4:	41 5c                	pop    %r12
+  8045a6:	41 5d                	pop    %r13
+  8045a8:	5d                   	pop    %rbp
+  8045a9:	c3                   	ret
+        if (from_env_store)
+  8045aa:	4d 85 e4             	test   %r12,%r12
+  8045ad:	74 08                	je     8045b7 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8045af:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045b6:	00 
+        if (perm_store)
+  8045b7:	4d 85 ed             	test   %r13,%r13
+  8045ba:	74 e3                	je     80459f <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8045bc:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045c3:	00 
+  8045c4:	eb d9                	jmp    80459f <ipc_try_recv+0xb1>
+
+00000000008045c6 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045c6:	55                   	push   %rbp
+  8045c7:	48 89 e5             	mov    %rsp,%rbp
+  8045ca:	41 57                	push   %r15
+  8045cc:	41 56                	push   %r14
+  8045ce:	41 55                	push   %r13
+  8045d0:	41 54                	push   %r12
+  8045d2:	53                   	push   %rbx
+  8045d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8045d7:	41 89 fd             	mov    %edi,%r13d
+  8045da:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8045dd:	48 89 d3             	mov    %rdx,%rbx
+  8045e0:	49 89 cc             	mov    %rcx,%r12
+  8045e3:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8045e7:	48 85 d2             	test   %rdx,%rdx
+  8045ea:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045f1:	00 00 00 
+  8045f4:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8045f8:	49 be ea 19 80 00 00 	movabs $0x8019ea,%r14
+  8045ff:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804602:	49 bf da 15 80 00 00 	movabs $0x8015da,%r15
+  804609:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80460c:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80460f:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804613:	4c 89 e1             	mov    %r12,%rcx
+  804616:	48 89 da             	mov    %rbx,%rdx
+  804619:	44 89 ef             	mov    %r13d,%edi
+  80461c:	41 ff d6             	call   *%r14
+  80461f:	85 c0                	test   %eax,%eax
+  804621:	74 37                	je     80465a <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804623:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804626:	75 05                	jne    80462d <ipc_send+0x67>
+        sys_yield();
+  804628:	41 ff d7             	call   *%r15
+  80462b:	eb df                	jmp    80460c <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80462d:	89 c1                	mov    %eax,%ecx
+  80462f:	48 ba 40 58 80 00 00 	movabs $0x805840,%rdx
+  804636:	00 00 00 
+  804639:	be 65 00 00 00       	mov    $0x65,%esi
+  80463e:	48 bf 5b 58 80 00 00 	movabs $0x80585b,%rdi
+  804645:	00 00 00 
+  804648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464d:	49 b8 41 04 80 00 00 	movabs $0x800441,%r8
+  804654:	00 00 00 
+  804657:	41 ff d0             	call   *%r8
+    }
+}
+  80465a:	48 83 c4 18          	add    $0x18,%rsp
+  80465e:	5b                   	pop    %rbx
+  80465f:	41 5c                	pop    %r12
+  804661:	41 5d                	pop    %r13
+  804663:	41 5e                	pop    %r14
+  804665:	41 5f                	pop    %r15
+  804667:	5d                   	pop    %rbp
+  804668:	c3                   	ret
+
+0000000000804669 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804669:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80466e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804675:	00 00 00 
+  804678:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80467f:	48 01 ca             	add    %rcx,%rdx
+  804682:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804688:	39 fa                	cmp    %edi,%edx
+  80468a:	74 12                	je     80469e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80468c:	48 83 c0 01          	add    $0x1,%rax
+  804690:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804696:	75 e0                	jne    804678 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804698:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80469d:	c3                   	ret
+            return envs[i].env_id;
+  80469e:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8046a5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046ac:	00 00 00 
+  8046af:	48 01 d0             	add    %rdx,%rax
+  8046b2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046b8:	c3                   	ret
+
+00000000008046b9 <__text_end>:
+  8046b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c0:	00 00 00 
+  8046c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ca:	00 00 00 
+  8046cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d4:	00 00 00 
+  8046d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046de:	00 00 00 
+  8046e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e8:	00 00 00 
+  8046eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f2:	00 00 00 
+  8046f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fc:	00 00 00 
+  8046ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804706:	00 00 00 
+  804709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804710:	00 00 00 
+  804713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471a:	00 00 00 
+  80471d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804724:	00 00 00 
+  804727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472e:	00 00 00 
+  804731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804738:	00 00 00 
+  80473b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804742:	00 00 00 
+  804745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474c:	00 00 00 
+  80474f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804756:	00 00 00 
+  804759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804760:	00 00 00 
+  804763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476a:	00 00 00 
+  80476d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804774:	00 00 00 
+  804777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477e:	00 00 00 
+  804781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804788:	00 00 00 
+  80478b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804792:	00 00 00 
+  804795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479c:	00 00 00 
+  80479f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a6:	00 00 00 
+  8047a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b0:	00 00 00 
+  8047b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ba:	00 00 00 
+  8047bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c4:	00 00 00 
+  8047c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ce:	00 00 00 
+  8047d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d8:	00 00 00 
+  8047db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e2:	00 00 00 
+  8047e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ec:	00 00 00 
+  8047ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f6:	00 00 00 
+  8047f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804800:	00 00 00 
+  804803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480a:	00 00 00 
+  80480d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804814:	00 00 00 
+  804817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481e:	00 00 00 
+  804821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804828:	00 00 00 
+  80482b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804832:	00 00 00 
+  804835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483c:	00 00 00 
+  80483f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804846:	00 00 00 
+  804849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804850:	00 00 00 
+  804853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485a:	00 00 00 
+  80485d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804864:	00 00 00 
+  804867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486e:	00 00 00 
+  804871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804878:	00 00 00 
+  80487b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804882:	00 00 00 
+  804885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488c:	00 00 00 
+  80488f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804896:	00 00 00 
+  804899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a0:	00 00 00 
+  8048a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048aa:	00 00 00 
+  8048ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b4:	00 00 00 
+  8048b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048be:	00 00 00 
+  8048c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c8:	00 00 00 
+  8048cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d2:	00 00 00 
+  8048d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dc:	00 00 00 
+  8048df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e6:	00 00 00 
+  8048e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f0:	00 00 00 
+  8048f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fa:	00 00 00 
+  8048fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804904:	00 00 00 
+  804907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490e:	00 00 00 
+  804911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804918:	00 00 00 
+  80491b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804922:	00 00 00 
+  804925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492c:	00 00 00 
+  80492f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804936:	00 00 00 
+  804939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804940:	00 00 00 
+  804943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494a:	00 00 00 
+  80494d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804954:	00 00 00 
+  804957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495e:	00 00 00 
+  804961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804968:	00 00 00 
+  80496b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804972:	00 00 00 
+  804975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497c:	00 00 00 
+  80497f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804986:	00 00 00 
+  804989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804990:	00 00 00 
+  804993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499a:	00 00 00 
+  80499d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a4:	00 00 00 
+  8049a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ae:	00 00 00 
+  8049b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b8:	00 00 00 
+  8049bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c2:	00 00 00 
+  8049c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cc:	00 00 00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e0:	00 00 00 
+  8049e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ea:	00 00 00 
+  8049ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f4:	00 00 00 
+  8049f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fe:	00 00 00 
+  804a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a08:	00 00 00 
+  804a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a12:	00 00 00 
+  804a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1c:	00 00 00 
+  804a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a26:	00 00 00 
+  804a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a30:	00 00 00 
+  804a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3a:	00 00 00 
+  804a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a44:	00 00 00 
+  804a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4e:	00 00 00 
+  804a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a58:	00 00 00 
+  804a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a62:	00 00 00 
+  804a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6c:	00 00 00 
+  804a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a76:	00 00 00 
+  804a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a80:	00 00 00 
+  804a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8a:	00 00 00 
+  804a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a94:	00 00 00 
+  804a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9e:	00 00 00 
+  804aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa8:	00 00 00 
+  804aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab2:	00 00 00 
+  804ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abc:	00 00 00 
+  804abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac6:	00 00 00 
+  804ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad0:	00 00 00 
+  804ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ada:	00 00 00 
+  804add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae4:	00 00 00 
+  804ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aee:	00 00 00 
+  804af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af8:	00 00 00 
+  804afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b02:	00 00 00 
+  804b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0c:	00 00 00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b20:	00 00 00 
+  804b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2a:	00 00 00 
+  804b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b34:	00 00 00 
+  804b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3e:	00 00 00 
+  804b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b48:	00 00 00 
+  804b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b52:	00 00 00 
+  804b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5c:	00 00 00 
+  804b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b66:	00 00 00 
+  804b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b70:	00 00 00 
+  804b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7a:	00 00 00 
+  804b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b84:	00 00 00 
+  804b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8e:	00 00 00 
+  804b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b98:	00 00 00 
+  804b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba2:	00 00 00 
+  804ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bac:	00 00 00 
+  804baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb6:	00 00 00 
+  804bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc0:	00 00 00 
+  804bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bca:	00 00 00 
+  804bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd4:	00 00 00 
+  804bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bde:	00 00 00 
+  804be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be8:	00 00 00 
+  804beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf2:	00 00 00 
+  804bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfc:	00 00 00 
+  804bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c06:	00 00 00 
+  804c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c10:	00 00 00 
+  804c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1a:	00 00 00 
+  804c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c24:	00 00 00 
+  804c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2e:	00 00 00 
+  804c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c38:	00 00 00 
+  804c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c42:	00 00 00 
+  804c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4c:	00 00 00 
+  804c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c56:	00 00 00 
+  804c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c60:	00 00 00 
+  804c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6a:	00 00 00 
+  804c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c74:	00 00 00 
+  804c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7e:	00 00 00 
+  804c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c88:	00 00 00 
+  804c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c92:	00 00 00 
+  804c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9c:	00 00 00 
+  804c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca6:	00 00 00 
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
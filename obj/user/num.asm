@@ -0,0 +1,8300 @@
+
+obj/user/num:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 19 02 00 00       	call   80023c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <num>:
+
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+  800036:	41 89 fc             	mov    %edi,%r12d
+  800039:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    long n;
+    int r;
+    char c;
+
+    while ((n = read(f, &c, 1)) > 0) {
+  80003d:	49 bd b7 22 80 00 00 	movabs $0x8022b7,%r13
+  800044:	00 00 00 
+        if (bol) {
+  800047:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80004e:	00 00 00 
+            printf("%5d ", ++line);
+  800051:	49 be 00 70 80 00 00 	movabs $0x807000,%r14
+  800058:	00 00 00 
+  80005b:	49 bf 00 50 80 00 00 	movabs $0x805000,%r15
+  800062:	00 00 00 
+  800065:	eb 25                	jmp    80008c <num+0x67>
+            bol = 0;
+        }
+        if ((r = write(1, &c, 1)) != 1)
+  800067:	ba 01 00 00 00       	mov    $0x1,%edx
+  80006c:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  800070:	bf 01 00 00 00       	mov    $0x1,%edi
+  800075:	48 b8 e6 23 80 00 00 	movabs $0x8023e6,%rax
+  80007c:	00 00 00 
+  80007f:	ff d0                	call   *%rax
+  800081:	83 f8 01             	cmp    $0x1,%eax
+  800084:	75 44                	jne    8000ca <num+0xa5>
+            panic("write error copying %s: %i", s, r);
+        if (c == '\n')
+  800086:	80 7d cf 0a          	cmpb   $0xa,-0x31(%rbp)
+  80008a:	74 70                	je     8000fc <num+0xd7>
+    while ((n = read(f, &c, 1)) > 0) {
+  80008c:	ba 01 00 00 00       	mov    $0x1,%edx
+  800091:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  800095:	44 89 e7             	mov    %r12d,%edi
+  800098:	41 ff d5             	call   *%r13
+  80009b:	48 85 c0             	test   %rax,%rax
+  80009e:	7e 71                	jle    800111 <num+0xec>
+        if (bol) {
+  8000a0:	83 3b 00             	cmpl   $0x0,(%rbx)
+  8000a3:	74 c2                	je     800067 <num+0x42>
+            printf("%5d ", ++line);
+  8000a5:	41 8b 06             	mov    (%r14),%eax
+  8000a8:	8d 70 01             	lea    0x1(%rax),%esi
+  8000ab:	41 89 36             	mov    %esi,(%r14)
+  8000ae:	4c 89 ff             	mov    %r15,%rdi
+  8000b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b6:	48 ba b5 38 80 00 00 	movabs $0x8038b5,%rdx
+  8000bd:	00 00 00 
+  8000c0:	ff d2                	call   *%rdx
+            bol = 0;
+  8000c2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8000c8:	eb 9d                	jmp    800067 <num+0x42>
+            panic("write error copying %s: %i", s, r);
+  8000ca:	41 89 c0             	mov    %eax,%r8d
+  8000cd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8000d1:	48 ba 05 50 80 00 00 	movabs $0x805005,%rdx
+  8000d8:	00 00 00 
+  8000db:	be 12 00 00 00       	mov    $0x12,%esi
+  8000e0:	48 bf 20 50 80 00 00 	movabs $0x805020,%rdi
+  8000e7:	00 00 00 
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  8000f6:	00 00 00 
+  8000f9:	41 ff d1             	call   *%r9
+            bol = 1;
+  8000fc:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800103:	00 00 00 
+  800106:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  80010c:	e9 4a ff ff ff       	jmp    80005b <num+0x36>
+    }
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  800111:	78 0f                	js     800122 <num+0xfd>
+}
+  800113:	48 83 c4 28          	add    $0x28,%rsp
+  800117:	5b                   	pop    %rbx
+  800118:	41 5c                	pop    %r12
+  80011a:	41 5d                	pop    %r13
+  80011c:	41 5e                	pop    %r14
+  80011e:	41 5f                	pop    %r15
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  800122:	41 89 c0             	mov    %eax,%r8d
+  800125:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  800129:	48 ba 2b 50 80 00 00 	movabs $0x80502b,%rdx
+  800130:	00 00 00 
+  800133:	be 16 00 00 00       	mov    $0x16,%esi
+  800138:	48 bf 20 50 80 00 00 	movabs $0x805020,%rdi
+  80013f:	00 00 00 
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  80014e:	00 00 00 
+  800151:	41 ff d1             	call   *%r9
+
+0000000000800154 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800154:	55                   	push   %rbp
+  800155:	48 89 e5             	mov    %rsp,%rbp
+  800158:	41 57                	push   %r15
+  80015a:	41 56                	push   %r14
+  80015c:	41 55                	push   %r13
+  80015e:	41 54                	push   %r12
+  800160:	53                   	push   %rbx
+  800161:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "num";
+  800165:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  80016c:	00 00 00 
+  80016f:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800176:	00 00 00 
+    if (argc == 1)
+  800179:	83 ff 01             	cmp    $0x1,%edi
+  80017c:	74 6f                	je     8001ed <umain+0x99>
+        num(0, "<stdin>");
+    else {
+        for (int i = 1; i < argc; i++) {
+  80017e:	7e 52                	jle    8001d2 <umain+0x7e>
+  800180:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  800184:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  800187:	4c 8d 7c c6 10       	lea    0x10(%rsi,%rax,8),%r15
+            int f = open(argv[i], O_RDONLY);
+  80018c:	49 bd c0 32 80 00 00 	movabs $0x8032c0,%r13
+  800193:	00 00 00 
+            if (f < 0)
+                panic("can't open %s: %i", argv[i], f);
+            else {
+                num(f, argv[i]);
+  800196:	49 be 25 00 80 00 00 	movabs $0x800025,%r14
+  80019d:	00 00 00 
+            int f = open(argv[i], O_RDONLY);
+  8001a0:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a9:	41 ff d5             	call   *%r13
+  8001ac:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	78 58                	js     80020a <umain+0xb6>
+                num(f, argv[i]);
+  8001b2:	49 8b 34 24          	mov    (%r12),%rsi
+  8001b6:	89 c7                	mov    %eax,%edi
+  8001b8:	41 ff d6             	call   *%r14
+                close(f);
+  8001bb:	89 df                	mov    %ebx,%edi
+  8001bd:	48 b8 39 21 80 00 00 	movabs $0x802139,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+        for (int i = 1; i < argc; i++) {
+  8001c9:	49 83 c4 08          	add    $0x8,%r12
+  8001cd:	4d 39 fc             	cmp    %r15,%r12
+  8001d0:	75 ce                	jne    8001a0 <umain+0x4c>
+            }
+        }
+    }
+    exit();
+  8001d2:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  8001d9:	00 00 00 
+  8001dc:	ff d0                	call   *%rax
+}
+  8001de:	48 83 c4 08          	add    $0x8,%rsp
+  8001e2:	5b                   	pop    %rbx
+  8001e3:	41 5c                	pop    %r12
+  8001e5:	41 5d                	pop    %r13
+  8001e7:	41 5e                	pop    %r14
+  8001e9:	41 5f                	pop    %r15
+  8001eb:	5d                   	pop    %rbp
+  8001ec:	c3                   	ret
+        num(0, "<stdin>");
+  8001ed:	48 be 44 50 80 00 00 	movabs $0x805044,%rsi
+  8001f4:	00 00 00 
+  8001f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800203:	00 00 00 
+  800206:	ff d0                	call   *%rax
+  800208:	eb c8                	jmp    8001d2 <umain+0x7e>
+                panic("can't open %s: %i", argv[i], f);
+  80020a:	49 8b 0c 24          	mov    (%r12),%rcx
+  80020e:	41 89 c0             	mov    %eax,%r8d
+  800211:	48 ba 4c 50 80 00 00 	movabs $0x80504c,%rdx
+  800218:	00 00 00 
+  80021b:	be 22 00 00 00       	mov    $0x22,%esi
+  800220:	48 bf 20 50 80 00 00 	movabs $0x805020,%rdi
+  800227:	00 00 00 
+  80022a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022f:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  800236:	00 00 00 
+  800239:	41 ff d1             	call   *%r9
+
+000000000080023c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80023c:	55                   	push   %rbp
+  80023d:	48 89 e5             	mov    %rsp,%rbp
+  800240:	41 56                	push   %r14
+  800242:	41 55                	push   %r13
+  800244:	41 54                	push   %r12
+  800246:	53                   	push   %rbx
+  800247:	41 89 fd             	mov    %edi,%r13d
+  80024a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80024d:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800254:	00 00 00 
+  800257:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80025e:	00 00 00 
+  800261:	48 39 c2             	cmp    %rax,%rdx
+  800264:	73 17                	jae    80027d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800266:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800269:	49 89 c4             	mov    %rax,%r12
+  80026c:	48 83 c3 08          	add    $0x8,%rbx
+  800270:	b8 00 00 00 00       	mov    $0x0,%eax
+  800275:	ff 53 f8             	call   *-0x8(%rbx)
+  800278:	4c 39 e3             	cmp    %r12,%rbx
+  80027b:	72 ef                	jb     80026c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80027d:	48 b8 70 14 80 00 00 	movabs $0x801470,%rax
+  800284:	00 00 00 
+  800287:	ff d0                	call   *%rax
+  800289:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80028e:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800295:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80029c:	00 00 00 
+  80029f:	48 01 d0             	add    %rdx,%rax
+  8002a2:	48 a3 08 70 80 00 00 	movabs %rax,0x807008
+  8002a9:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002ac:	45 85 ed             	test   %r13d,%r13d
+  8002af:	7e 0d                	jle    8002be <libmain+0x82>
+  8002b1:	49 8b 06             	mov    (%r14),%rax
+  8002b4:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  8002bb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002be:	4c 89 f6             	mov    %r14,%rsi
+  8002c1:	44 89 ef             	mov    %r13d,%edi
+  8002c4:	48 b8 54 01 80 00 00 	movabs $0x800154,%rax
+  8002cb:	00 00 00 
+  8002ce:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002d0:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  8002d7:	00 00 00 
+  8002da:	ff d0                	call   *%rax
+#endif
+}
+  8002dc:	5b                   	pop    %rbx
+  8002dd:	41 5c                	pop    %r12
+  8002df:	41 5d                	pop    %r13
+  8002e1:	41 5e                	pop    %r14
+  8002e3:	5d                   	pop    %rbp
+  8002e4:	c3                   	ret
+
+00000000008002e5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002e5:	55                   	push   %rbp
+  8002e6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002e9:	48 b8 6c 21 80 00 00 	movabs $0x80216c,%rax
+  8002f0:	00 00 00 
+  8002f3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002fa:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  800301:	00 00 00 
+  800304:	ff d0                	call   *%rax
+}
+  800306:	5d                   	pop    %rbp
+  800307:	c3                   	ret
+
+0000000000800308 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800308:	55                   	push   %rbp
+  800309:	48 89 e5             	mov    %rsp,%rbp
+  80030c:	41 56                	push   %r14
+  80030e:	41 55                	push   %r13
+  800310:	41 54                	push   %r12
+  800312:	53                   	push   %rbx
+  800313:	48 83 ec 50          	sub    $0x50,%rsp
+  800317:	49 89 fc             	mov    %rdi,%r12
+  80031a:	41 89 f5             	mov    %esi,%r13d
+  80031d:	48 89 d3             	mov    %rdx,%rbx
+  800320:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800324:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800328:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80032c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800333:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800337:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80033b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80033f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800343:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  80034a:	00 00 00 
+  80034d:	4c 8b 30             	mov    (%rax),%r14
+  800350:	48 b8 70 14 80 00 00 	movabs $0x801470,%rax
+  800357:	00 00 00 
+  80035a:	ff d0                	call   *%rax
+  80035c:	89 c6                	mov    %eax,%esi
+  80035e:	45 89 e8             	mov    %r13d,%r8d
+  800361:	4c 89 e1             	mov    %r12,%rcx
+  800364:	4c 89 f2             	mov    %r14,%rdx
+  800367:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  80036e:	00 00 00 
+  800371:	b8 00 00 00 00       	mov    $0x0,%eax
+  800376:	49 bc 58 04 80 00 00 	movabs $0x800458,%r12
+  80037d:	00 00 00 
+  800380:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800383:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800387:	48 89 df             	mov    %rbx,%rdi
+  80038a:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  800391:	00 00 00 
+  800394:	ff d0                	call   *%rax
+    cprintf("\n");
+  800396:	48 bf a3 56 80 00 00 	movabs $0x8056a3,%rdi
+  80039d:	00 00 00 
+  8003a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a5:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003a8:	cc                   	int3
+  8003a9:	eb fd                	jmp    8003a8 <_panic+0xa0>
+
+00000000008003ab <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003ab:	55                   	push   %rbp
+  8003ac:	48 89 e5             	mov    %rsp,%rbp
+  8003af:	53                   	push   %rbx
+  8003b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003b7:	8b 06                	mov    (%rsi),%eax
+  8003b9:	8d 50 01             	lea    0x1(%rax),%edx
+  8003bc:	89 16                	mov    %edx,(%rsi)
+  8003be:	48 98                	cltq
+  8003c0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003c5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003cb:	74 0a                	je     8003d7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003cd:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003d5:	c9                   	leave
+  8003d6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003d7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003db:	be ff 00 00 00       	mov    $0xff,%esi
+  8003e0:	48 b8 a7 13 80 00 00 	movabs $0x8013a7,%rax
+  8003e7:	00 00 00 
+  8003ea:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003ec:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003f2:	eb d9                	jmp    8003cd <putch+0x22>
+
+00000000008003f4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003f4:	55                   	push   %rbp
+  8003f5:	48 89 e5             	mov    %rsp,%rbp
+  8003f8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003ff:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800402:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800409:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80040e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800413:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800416:	48 89 f1             	mov    %rsi,%rcx
+  800419:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800420:	48 bf ab 03 80 00 00 	movabs $0x8003ab,%rdi
+  800427:	00 00 00 
+  80042a:	48 b8 a8 05 80 00 00 	movabs $0x8005a8,%rax
+  800431:	00 00 00 
+  800434:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800436:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80043d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800444:	48 b8 a7 13 80 00 00 	movabs $0x8013a7,%rax
+  80044b:	00 00 00 
+  80044e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800450:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800456:	c9                   	leave
+  800457:	c3                   	ret
+
+0000000000800458 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800458:	55                   	push   %rbp
+  800459:	48 89 e5             	mov    %rsp,%rbp
+  80045c:	48 83 ec 50          	sub    $0x50,%rsp
+  800460:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800464:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800468:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80046c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800470:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800474:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80047b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80047f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800483:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800487:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80048b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80048f:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  800496:	00 00 00 
+  800499:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80049b:	c9                   	leave
+  80049c:	c3                   	ret
+
+000000000080049d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80049d:	55                   	push   %rbp
+  80049e:	48 89 e5             	mov    %rsp,%rbp
+  8004a1:	41 57                	push   %r15
+  8004a3:	41 56                	push   %r14
+  8004a5:	41 55                	push   %r13
+  8004a7:	41 54                	push   %r12
+  8004a9:	53                   	push   %rbx
+  8004aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8004ae:	49 89 fc             	mov    %rdi,%r12
+  8004b1:	49 89 f5             	mov    %rsi,%r13
+  8004b4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004b8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004bb:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004be:	41 89 cf             	mov    %ecx,%r15d
+  8004c1:	4c 39 fa             	cmp    %r15,%rdx
+  8004c4:	73 5b                	jae    800521 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004c6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004ca:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004ce:	85 db                	test   %ebx,%ebx
+  8004d0:	7e 0e                	jle    8004e0 <print_num+0x43>
+            putch(padc, put_arg);
+  8004d2:	4c 89 ee             	mov    %r13,%rsi
+  8004d5:	44 89 f7             	mov    %r14d,%edi
+  8004d8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004db:	83 eb 01             	sub    $0x1,%ebx
+  8004de:	75 f2                	jne    8004d2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004e0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004e4:	48 b9 9c 50 80 00 00 	movabs $0x80509c,%rcx
+  8004eb:	00 00 00 
+  8004ee:	48 b8 8b 50 80 00 00 	movabs $0x80508b,%rax
+  8004f5:	00 00 00 
+  8004f8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800500:	ba 00 00 00 00       	mov    $0x0,%edx
+  800505:	49 f7 f7             	div    %r15
+  800508:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80050c:	4c 89 ee             	mov    %r13,%rsi
+  80050f:	41 ff d4             	call   *%r12
+}
+  800512:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800516:	5b                   	pop    %rbx
+  800517:	41 5c                	pop    %r12
+  800519:	41 5d                	pop    %r13
+  80051b:	41 5e                	pop    %r14
+  80051d:	41 5f                	pop    %r15
+  80051f:	5d                   	pop    %rbp
+  800520:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800521:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800525:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052a:	49 f7 f7             	div    %r15
+  80052d:	48 83 ec 08          	sub    $0x8,%rsp
+  800531:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800535:	52                   	push   %rdx
+  800536:	45 0f be c9          	movsbl %r9b,%r9d
+  80053a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80053e:	48 89 c2             	mov    %rax,%rdx
+  800541:	48 b8 9d 04 80 00 00 	movabs $0x80049d,%rax
+  800548:	00 00 00 
+  80054b:	ff d0                	call   *%rax
+  80054d:	48 83 c4 10          	add    $0x10,%rsp
+  800551:	eb 8d                	jmp    8004e0 <print_num+0x43>
+
+0000000000800553 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800553:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800557:	48 8b 06             	mov    (%rsi),%rax
+  80055a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80055e:	73 0a                	jae    80056a <sprintputch+0x17>
+        *state->start++ = ch;
+  800560:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800564:	48 89 16             	mov    %rdx,(%rsi)
+  800567:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80056a:	c3                   	ret
+
+000000000080056b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80056b:	55                   	push   %rbp
+  80056c:	48 89 e5             	mov    %rsp,%rbp
+  80056f:	48 83 ec 50          	sub    $0x50,%rsp
+  800573:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800577:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80057f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800586:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80058e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800592:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800596:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059a:	48 b8 a8 05 80 00 00 	movabs $0x8005a8,%rax
+  8005a1:	00 00 00 
+  8005a4:	ff d0                	call   *%rax
+}
+  8005a6:	c9                   	leave
+  8005a7:	c3                   	ret
+
+00000000008005a8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005a8:	55                   	push   %rbp
+  8005a9:	48 89 e5             	mov    %rsp,%rbp
+  8005ac:	41 57                	push   %r15
+  8005ae:	41 56                	push   %r14
+  8005b0:	41 55                	push   %r13
+  8005b2:	41 54                	push   %r12
+  8005b4:	53                   	push   %rbx
+  8005b5:	48 83 ec 38          	sub    $0x38,%rsp
+  8005b9:	49 89 fe             	mov    %rdi,%r14
+  8005bc:	49 89 f5             	mov    %rsi,%r13
+  8005bf:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005c2:	48 8b 01             	mov    (%rcx),%rax
+  8005c5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005c9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005d9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005dd:	0f b6 3b             	movzbl (%rbx),%edi
+  8005e0:	40 80 ff 25          	cmp    $0x25,%dil
+  8005e4:	74 18                	je     8005fe <vprintfmt+0x56>
+            if (!ch) return;
+  8005e6:	40 84 ff             	test   %dil,%dil
+  8005e9:	0f 84 04 07 00 00    	je     800cf3 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8005ef:	40 0f b6 ff          	movzbl %dil,%edi
+  8005f3:	4c 89 ee             	mov    %r13,%rsi
+  8005f6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005f9:	4c 89 e3             	mov    %r12,%rbx
+  8005fc:	eb db                	jmp    8005d9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005fe:	be 00 00 00 00       	mov    $0x0,%esi
+  800603:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800607:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80060c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800612:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800619:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80061d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800622:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800627:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80062a:	83 e8 23             	sub    $0x23,%eax
+  80062d:	3c 57                	cmp    $0x57,%al
+  80062f:	0f 87 a4 06 00 00    	ja     800cd9 <vprintfmt+0x731>
+  800635:	0f b6 c0             	movzbl %al,%eax
+  800638:	48 b9 20 52 80 00 00 	movabs $0x805220,%rcx
+  80063f:	00 00 00 
+  800642:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800645:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800648:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80064c:	eb cf                	jmp    80061d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80064e:	49 89 dc             	mov    %rbx,%r12
+  800651:	be 01 00 00 00       	mov    $0x1,%esi
+  800656:	eb c5                	jmp    80061d <vprintfmt+0x75>
+            padc = ch;
+  800658:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80065c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80065f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800662:	eb b9                	jmp    80061d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800664:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800667:	83 f8 2f             	cmp    $0x2f,%eax
+  80066a:	77 24                	ja     800690 <vprintfmt+0xe8>
+  80066c:	89 c1                	mov    %eax,%ecx
+  80066e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800672:	83 c0 08             	add    $0x8,%eax
+  800675:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800678:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80067b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80067e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800682:	79 99                	jns    80061d <vprintfmt+0x75>
+                width = precision;
+  800684:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800688:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80068e:	eb 8d                	jmp    80061d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800690:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800694:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800698:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069c:	eb da                	jmp    800678 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80069e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006a3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006a7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006ad:	3c 39                	cmp    $0x39,%al
+  8006af:	77 1c                	ja     8006cd <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006b1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006b5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006b9:	0f b6 c0             	movzbl %al,%eax
+  8006bc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006c1:	0f b6 03             	movzbl (%rbx),%eax
+  8006c4:	3c 39                	cmp    $0x39,%al
+  8006c6:	76 e9                	jbe    8006b1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006c8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006cb:	eb b1                	jmp    80067e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006cd:	49 89 dc             	mov    %rbx,%r12
+  8006d0:	eb ac                	jmp    80067e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006d2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006d5:	85 c9                	test   %ecx,%ecx
+  8006d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006dc:	0f 49 c1             	cmovns %ecx,%eax
+  8006df:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006e2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006e5:	e9 33 ff ff ff       	jmp    80061d <vprintfmt+0x75>
+            lflag++;
+  8006ea:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006ed:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006f0:	e9 28 ff ff ff       	jmp    80061d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fb:	77 19                	ja     800716 <vprintfmt+0x16e>
+  8006fd:	89 c2                	mov    %eax,%edx
+  8006ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800703:	83 c0 08             	add    $0x8,%eax
+  800706:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800709:	8b 3a                	mov    (%rdx),%edi
+  80070b:	4c 89 ee             	mov    %r13,%rsi
+  80070e:	41 ff d6             	call   *%r14
+            break;
+  800711:	e9 c3 fe ff ff       	jmp    8005d9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800716:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80071a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80071e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800722:	eb e5                	jmp    800709 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800724:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800727:	83 f8 2f             	cmp    $0x2f,%eax
+  80072a:	77 5a                	ja     800786 <vprintfmt+0x1de>
+  80072c:	89 c2                	mov    %eax,%edx
+  80072e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800732:	83 c0 08             	add    $0x8,%eax
+  800735:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800738:	8b 02                	mov    (%rdx),%eax
+  80073a:	89 c1                	mov    %eax,%ecx
+  80073c:	f7 d9                	neg    %ecx
+  80073e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800741:	83 f9 13             	cmp    $0x13,%ecx
+  800744:	7f 4e                	jg     800794 <vprintfmt+0x1ec>
+  800746:	48 63 c1             	movslq %ecx,%rax
+  800749:	48 ba e0 54 80 00 00 	movabs $0x8054e0,%rdx
+  800750:	00 00 00 
+  800753:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800757:	48 85 c0             	test   %rax,%rax
+  80075a:	74 38                	je     800794 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80075c:	48 89 c1             	mov    %rax,%rcx
+  80075f:	48 ba 1d 57 80 00 00 	movabs $0x80571d,%rdx
+  800766:	00 00 00 
+  800769:	4c 89 ee             	mov    %r13,%rsi
+  80076c:	4c 89 f7             	mov    %r14,%rdi
+  80076f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800774:	49 b8 6b 05 80 00 00 	movabs $0x80056b,%r8
+  80077b:	00 00 00 
+  80077e:	41 ff d0             	call   *%r8
+  800781:	e9 53 fe ff ff       	jmp    8005d9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800786:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800792:	eb a4                	jmp    800738 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800794:	48 ba b4 50 80 00 00 	movabs $0x8050b4,%rdx
+  80079b:	00 00 00 
+  80079e:	4c 89 ee             	mov    %r13,%rsi
+  8007a1:	4c 89 f7             	mov    %r14,%rdi
+  8007a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a9:	49 b8 6b 05 80 00 00 	movabs $0x80056b,%r8
+  8007b0:	00 00 00 
+  8007b3:	41 ff d0             	call   *%r8
+  8007b6:	e9 1e fe ff ff       	jmp    8005d9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007be:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c1:	77 36                	ja     8007f9 <vprintfmt+0x251>
+  8007c3:	89 c2                	mov    %eax,%edx
+  8007c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c9:	83 c0 08             	add    $0x8,%eax
+  8007cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cf:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8007d2:	48 85 f6             	test   %rsi,%rsi
+  8007d5:	48 b8 ad 50 80 00 00 	movabs $0x8050ad,%rax
+  8007dc:	00 00 00 
+  8007df:	48 0f 45 c6          	cmovne %rsi,%rax
+  8007e3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007e7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007eb:	7e 06                	jle    8007f3 <vprintfmt+0x24b>
+  8007ed:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007f1:	75 14                	jne    800807 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007f3:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8007f7:	eb 5b                	jmp    800854 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8007f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800801:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800805:	eb c8                	jmp    8007cf <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800807:	49 63 f7             	movslq %r15d,%rsi
+  80080a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80080e:	48 b8 ad 0d 80 00 00 	movabs $0x800dad,%rax
+  800815:	00 00 00 
+  800818:	ff d0                	call   *%rax
+  80081a:	48 89 c2             	mov    %rax,%rdx
+  80081d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800820:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800822:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800825:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800828:	85 c0                	test   %eax,%eax
+  80082a:	7e c7                	jle    8007f3 <vprintfmt+0x24b>
+  80082c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800831:	4c 89 ee             	mov    %r13,%rsi
+  800834:	44 89 e7             	mov    %r12d,%edi
+  800837:	41 ff d6             	call   *%r14
+  80083a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80083e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800841:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800844:	75 eb                	jne    800831 <vprintfmt+0x289>
+  800846:	eb ab                	jmp    8007f3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800848:	0f b6 f8             	movzbl %al,%edi
+  80084b:	4c 89 ee             	mov    %r13,%rsi
+  80084e:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800851:	4c 89 e2             	mov    %r12,%rdx
+  800854:	45 85 ff             	test   %r15d,%r15d
+  800857:	78 06                	js     80085f <vprintfmt+0x2b7>
+  800859:	41 83 ef 01          	sub    $0x1,%r15d
+  80085d:	78 23                	js     800882 <vprintfmt+0x2da>
+  80085f:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800863:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800869:	84 c0                	test   %al,%al
+  80086b:	74 15                	je     800882 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80086d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800871:	74 d5                	je     800848 <vprintfmt+0x2a0>
+  800873:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800876:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80087b:	80 fa 5e             	cmp    $0x5e,%dl
+  80087e:	77 cb                	ja     80084b <vprintfmt+0x2a3>
+  800880:	eb c6                	jmp    800848 <vprintfmt+0x2a0>
+  800882:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800885:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800888:	01 f0                	add    %esi,%eax
+  80088a:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80088c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800890:	85 c0                	test   %eax,%eax
+  800892:	0f 8e 41 fd ff ff    	jle    8005d9 <vprintfmt+0x31>
+  800898:	4c 89 ee             	mov    %r13,%rsi
+  80089b:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008a0:	41 ff d6             	call   *%r14
+  8008a3:	41 83 ec 01          	sub    $0x1,%r12d
+  8008a7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008ab:	75 eb                	jne    800898 <vprintfmt+0x2f0>
+  8008ad:	e9 27 fd ff ff       	jmp    8005d9 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b2:	40 84 f6             	test   %sil,%sil
+  8008b5:	75 26                	jne    8008dd <vprintfmt+0x335>
+    switch (lflag) {
+  8008b7:	85 d2                	test   %edx,%edx
+  8008b9:	74 59                	je     800914 <vprintfmt+0x36c>
+  8008bb:	83 fa 01             	cmp    $0x1,%edx
+  8008be:	74 7b                	je     80093b <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8008c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c6:	0f 87 96 00 00 00    	ja     800962 <vprintfmt+0x3ba>
+  8008cc:	89 c2                	mov    %eax,%edx
+  8008ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d2:	83 c0 08             	add    $0x8,%eax
+  8008d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d8:	4c 8b 22             	mov    (%rdx),%r12
+  8008db:	eb 17                	jmp    8008f4 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8008dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e3:	77 21                	ja     800906 <vprintfmt+0x35e>
+  8008e5:	89 c2                	mov    %eax,%edx
+  8008e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008eb:	83 c0 08             	add    $0x8,%eax
+  8008ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f1:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008f4:	4d 85 e4             	test   %r12,%r12
+  8008f7:	78 7a                	js     800973 <vprintfmt+0x3cb>
+            num = i;
+  8008f9:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008fc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800901:	e9 b5 02 00 00       	jmp    800bbb <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800906:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800912:	eb dd                	jmp    8008f1 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800914:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800917:	83 f8 2f             	cmp    $0x2f,%eax
+  80091a:	77 11                	ja     80092d <vprintfmt+0x385>
+  80091c:	89 c2                	mov    %eax,%edx
+  80091e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800922:	83 c0 08             	add    $0x8,%eax
+  800925:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800928:	4c 63 22             	movslq (%rdx),%r12
+  80092b:	eb c7                	jmp    8008f4 <vprintfmt+0x34c>
+  80092d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800931:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800935:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800939:	eb ed                	jmp    800928 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80093b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093e:	83 f8 2f             	cmp    $0x2f,%eax
+  800941:	77 11                	ja     800954 <vprintfmt+0x3ac>
+  800943:	89 c2                	mov    %eax,%edx
+  800945:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800949:	83 c0 08             	add    $0x8,%eax
+  80094c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094f:	4c 8b 22             	mov    (%rdx),%r12
+  800952:	eb a0                	jmp    8008f4 <vprintfmt+0x34c>
+  800954:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800958:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800960:	eb ed                	jmp    80094f <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800962:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800966:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096e:	e9 65 ff ff ff       	jmp    8008d8 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800973:	4c 89 ee             	mov    %r13,%rsi
+  800976:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80097b:	41 ff d6             	call   *%r14
+                i = -i;
+  80097e:	49 f7 dc             	neg    %r12
+  800981:	e9 73 ff ff ff       	jmp    8008f9 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800986:	40 84 f6             	test   %sil,%sil
+  800989:	75 32                	jne    8009bd <vprintfmt+0x415>
+    switch (lflag) {
+  80098b:	85 d2                	test   %edx,%edx
+  80098d:	74 5d                	je     8009ec <vprintfmt+0x444>
+  80098f:	83 fa 01             	cmp    $0x1,%edx
+  800992:	0f 84 82 00 00 00    	je     800a1a <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800998:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099b:	83 f8 2f             	cmp    $0x2f,%eax
+  80099e:	0f 87 a5 00 00 00    	ja     800a49 <vprintfmt+0x4a1>
+  8009a4:	89 c2                	mov    %eax,%edx
+  8009a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009aa:	83 c0 08             	add    $0x8,%eax
+  8009ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009b3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009b8:	e9 fe 01 00 00       	jmp    800bbb <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c3:	77 19                	ja     8009de <vprintfmt+0x436>
+  8009c5:	89 c2                	mov    %eax,%edx
+  8009c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cb:	83 c0 08             	add    $0x8,%eax
+  8009ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009d4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009d9:	e9 dd 01 00 00       	jmp    800bbb <vprintfmt+0x613>
+  8009de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ea:	eb e5                	jmp    8009d1 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8009ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f2:	77 18                	ja     800a0c <vprintfmt+0x464>
+  8009f4:	89 c2                	mov    %eax,%edx
+  8009f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fa:	83 c0 08             	add    $0x8,%eax
+  8009fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a00:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a02:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a07:	e9 af 01 00 00       	jmp    800bbb <vprintfmt+0x613>
+  800a0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a18:	eb e6                	jmp    800a00 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a20:	77 19                	ja     800a3b <vprintfmt+0x493>
+  800a22:	89 c2                	mov    %eax,%edx
+  800a24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a28:	83 c0 08             	add    $0x8,%eax
+  800a2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a31:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a36:	e9 80 01 00 00       	jmp    800bbb <vprintfmt+0x613>
+  800a3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a47:	eb e5                	jmp    800a2e <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800a49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a55:	e9 56 ff ff ff       	jmp    8009b0 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800a5a:	40 84 f6             	test   %sil,%sil
+  800a5d:	75 2e                	jne    800a8d <vprintfmt+0x4e5>
+    switch (lflag) {
+  800a5f:	85 d2                	test   %edx,%edx
+  800a61:	0f 84 b3 00 00 00    	je     800b1a <vprintfmt+0x572>
+  800a67:	83 fa 01             	cmp    $0x1,%edx
+  800a6a:	0f 84 d3 00 00 00    	je     800b43 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800a70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a73:	83 f8 2f             	cmp    $0x2f,%eax
+  800a76:	0f 87 f1 00 00 00    	ja     800b6d <vprintfmt+0x5c5>
+  800a7c:	89 c2                	mov    %eax,%edx
+  800a7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a82:	83 c0 08             	add    $0x8,%eax
+  800a85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a88:	48 8b 02             	mov    (%rdx),%rax
+  800a8b:	eb 17                	jmp    800aa4 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a90:	83 f8 2f             	cmp    $0x2f,%eax
+  800a93:	77 77                	ja     800b0c <vprintfmt+0x564>
+  800a95:	89 c2                	mov    %eax,%edx
+  800a97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9b:	83 c0 08             	add    $0x8,%eax
+  800a9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa1:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800aa4:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800aa6:	83 f8 07             	cmp    $0x7,%eax
+  800aa9:	0f 8e cf 00 00 00    	jle    800b7e <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800aaf:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800ab5:	44 89 e7             	mov    %r12d,%edi
+  800ab8:	41 c1 e4 03          	shl    $0x3,%r12d
+  800abc:	89 d1                	mov    %edx,%ecx
+  800abe:	8d 72 07             	lea    0x7(%rdx),%esi
+  800ac1:	85 d2                	test   %edx,%edx
+  800ac3:	0f 48 d6             	cmovs  %esi,%edx
+  800ac6:	c1 fa 03             	sar    $0x3,%edx
+  800ac9:	83 f9 3f             	cmp    $0x3f,%ecx
+  800acc:	7f e7                	jg     800ab5 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800ace:	85 ff                	test   %edi,%edi
+  800ad0:	0f 84 03 fb ff ff    	je     8005d9 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800ad6:	49 63 f4             	movslq %r12d,%rsi
+  800ad9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ade:	48 f7 f6             	div    %rsi
+  800ae1:	49 89 d7             	mov    %rdx,%r15
+  800ae4:	83 c0 30             	add    $0x30,%eax
+  800ae7:	0f be f8             	movsbl %al,%edi
+  800aea:	4c 89 ee             	mov    %r13,%rsi
+  800aed:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800af0:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800af3:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800af8:	45 85 e4             	test   %r12d,%r12d
+  800afb:	41 0f 49 d4          	cmovns %r12d,%edx
+  800aff:	c1 fa 03             	sar    $0x3,%edx
+  800b02:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800b05:	75 cf                	jne    800ad6 <vprintfmt+0x52e>
+  800b07:	e9 cd fa ff ff       	jmp    8005d9 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800b0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b18:	eb 87                	jmp    800aa1 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800b1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b20:	77 13                	ja     800b35 <vprintfmt+0x58d>
+  800b22:	89 c2                	mov    %eax,%edx
+  800b24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b28:	83 c0 08             	add    $0x8,%eax
+  800b2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2e:	8b 02                	mov    (%rdx),%eax
+  800b30:	e9 6f ff ff ff       	jmp    800aa4 <vprintfmt+0x4fc>
+  800b35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b41:	eb eb                	jmp    800b2e <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800b43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b46:	83 f8 2f             	cmp    $0x2f,%eax
+  800b49:	77 14                	ja     800b5f <vprintfmt+0x5b7>
+  800b4b:	89 c2                	mov    %eax,%edx
+  800b4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b51:	83 c0 08             	add    $0x8,%eax
+  800b54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b57:	48 8b 02             	mov    (%rdx),%rax
+  800b5a:	e9 45 ff ff ff       	jmp    800aa4 <vprintfmt+0x4fc>
+  800b5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6b:	eb ea                	jmp    800b57 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800b6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b79:	e9 0a ff ff ff       	jmp    800a88 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800b7e:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800b84:	e9 4d ff ff ff       	jmp    800ad6 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800b89:	4c 89 ee             	mov    %r13,%rsi
+  800b8c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b91:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b94:	4c 89 ee             	mov    %r13,%rsi
+  800b97:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b9c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba5:	77 47                	ja     800bee <vprintfmt+0x646>
+  800ba7:	89 c2                	mov    %eax,%edx
+  800ba9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bad:	83 c0 08             	add    $0x8,%eax
+  800bb0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800bbb:	48 83 ec 08          	sub    $0x8,%rsp
+  800bbf:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800bc3:	0f 94 c0             	sete   %al
+  800bc6:	0f b6 c0             	movzbl %al,%eax
+  800bc9:	50                   	push   %rax
+  800bca:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800bcf:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800bd3:	4c 89 ee             	mov    %r13,%rsi
+  800bd6:	4c 89 f7             	mov    %r14,%rdi
+  800bd9:	48 b8 9d 04 80 00 00 	movabs $0x80049d,%rax
+  800be0:	00 00 00 
+  800be3:	ff d0                	call   *%rax
+            break;
+  800be5:	48 83 c4 10          	add    $0x10,%rsp
+  800be9:	e9 eb f9 ff ff       	jmp    8005d9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800bee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfa:	eb b7                	jmp    800bb3 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800bfc:	40 84 f6             	test   %sil,%sil
+  800bff:	75 2b                	jne    800c2c <vprintfmt+0x684>
+    switch (lflag) {
+  800c01:	85 d2                	test   %edx,%edx
+  800c03:	74 56                	je     800c5b <vprintfmt+0x6b3>
+  800c05:	83 fa 01             	cmp    $0x1,%edx
+  800c08:	74 7f                	je     800c89 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800c0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c10:	0f 87 a2 00 00 00    	ja     800cb8 <vprintfmt+0x710>
+  800c16:	89 c2                	mov    %eax,%edx
+  800c18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1c:	83 c0 08             	add    $0x8,%eax
+  800c1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c22:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c25:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c2a:	eb 8f                	jmp    800bbb <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800c2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c32:	77 19                	ja     800c4d <vprintfmt+0x6a5>
+  800c34:	89 c2                	mov    %eax,%edx
+  800c36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c3a:	83 c0 08             	add    $0x8,%eax
+  800c3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c40:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c43:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c48:	e9 6e ff ff ff       	jmp    800bbb <vprintfmt+0x613>
+  800c4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c51:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c59:	eb e5                	jmp    800c40 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800c5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c61:	77 18                	ja     800c7b <vprintfmt+0x6d3>
+  800c63:	89 c2                	mov    %eax,%edx
+  800c65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c69:	83 c0 08             	add    $0x8,%eax
+  800c6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c71:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c76:	e9 40 ff ff ff       	jmp    800bbb <vprintfmt+0x613>
+  800c7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c87:	eb e6                	jmp    800c6f <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800c89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8f:	77 19                	ja     800caa <vprintfmt+0x702>
+  800c91:	89 c2                	mov    %eax,%edx
+  800c93:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c97:	83 c0 08             	add    $0x8,%eax
+  800c9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ca0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ca5:	e9 11 ff ff ff       	jmp    800bbb <vprintfmt+0x613>
+  800caa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb6:	eb e5                	jmp    800c9d <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800cb8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cbc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc4:	e9 59 ff ff ff       	jmp    800c22 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800cc9:	4c 89 ee             	mov    %r13,%rsi
+  800ccc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cd1:	41 ff d6             	call   *%r14
+            break;
+  800cd4:	e9 00 f9 ff ff       	jmp    8005d9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800cd9:	4c 89 ee             	mov    %r13,%rsi
+  800cdc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ce1:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ce4:	48 83 eb 01          	sub    $0x1,%rbx
+  800ce8:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cec:	75 f6                	jne    800ce4 <vprintfmt+0x73c>
+  800cee:	e9 e6 f8 ff ff       	jmp    8005d9 <vprintfmt+0x31>
+}
+  800cf3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800cf7:	5b                   	pop    %rbx
+  800cf8:	41 5c                	pop    %r12
+  800cfa:	41 5d                	pop    %r13
+  800cfc:	41 5e                	pop    %r14
+  800cfe:	41 5f                	pop    %r15
+  800d00:	5d                   	pop    %rbp
+  800d01:	c3                   	ret
+
+0000000000800d02 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d02:	55                   	push   %rbp
+  800d03:	48 89 e5             	mov    %rsp,%rbp
+  800d06:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d0a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d0e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d13:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d17:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d1e:	48 85 ff             	test   %rdi,%rdi
+  800d21:	74 2b                	je     800d4e <vsnprintf+0x4c>
+  800d23:	48 85 f6             	test   %rsi,%rsi
+  800d26:	74 26                	je     800d4e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d28:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d2c:	48 bf 53 05 80 00 00 	movabs $0x800553,%rdi
+  800d33:	00 00 00 
+  800d36:	48 b8 a8 05 80 00 00 	movabs $0x8005a8,%rax
+  800d3d:	00 00 00 
+  800d40:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d46:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d49:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d4c:	c9                   	leave
+  800d4d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d53:	eb f7                	jmp    800d4c <vsnprintf+0x4a>
+
+0000000000800d55 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d55:	55                   	push   %rbp
+  800d56:	48 89 e5             	mov    %rsp,%rbp
+  800d59:	48 83 ec 50          	sub    $0x50,%rsp
+  800d5d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d61:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d65:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d69:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d70:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d78:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d7c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d80:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d84:	48 b8 02 0d 80 00 00 	movabs $0x800d02,%rax
+  800d8b:	00 00 00 
+  800d8e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d90:	c9                   	leave
+  800d91:	c3                   	ret
+
+0000000000800d92 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d92:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d95:	74 10                	je     800da7 <strlen+0x15>
+    size_t n = 0;
+  800d97:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d9c:	48 83 c0 01          	add    $0x1,%rax
+  800da0:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800da4:	75 f6                	jne    800d9c <strlen+0xa>
+  800da6:	c3                   	ret
+    size_t n = 0;
+  800da7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800dac:	c3                   	ret
+
+0000000000800dad <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800dad:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800db0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800db5:	48 85 f6             	test   %rsi,%rsi
+  800db8:	74 11                	je     800dcb <strnlen+0x1e>
+  800dba:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800dbe:	74 0c                	je     800dcc <strnlen+0x1f>
+  800dc0:	48 83 c2 01          	add    $0x1,%rdx
+  800dc4:	48 39 d0             	cmp    %rdx,%rax
+  800dc7:	75 f1                	jne    800dba <strnlen+0xd>
+  800dc9:	eb 04                	jmp    800dcf <strnlen+0x22>
+  800dcb:	c3                   	ret
+  800dcc:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800dcf:	c3                   	ret
+
+0000000000800dd0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800dd0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800dd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ddc:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ddf:	48 83 c2 01          	add    $0x1,%rdx
+  800de3:	84 c9                	test   %cl,%cl
+  800de5:	75 f1                	jne    800dd8 <strcpy+0x8>
+        ;
+    return res;
+}
+  800de7:	c3                   	ret
+
+0000000000800de8 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800de8:	55                   	push   %rbp
+  800de9:	48 89 e5             	mov    %rsp,%rbp
+  800dec:	41 54                	push   %r12
+  800dee:	53                   	push   %rbx
+  800def:	48 89 fb             	mov    %rdi,%rbx
+  800df2:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800df5:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  800dfc:	00 00 00 
+  800dff:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e01:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e05:	4c 89 e6             	mov    %r12,%rsi
+  800e08:	48 b8 d0 0d 80 00 00 	movabs $0x800dd0,%rax
+  800e0f:	00 00 00 
+  800e12:	ff d0                	call   *%rax
+    return dst;
+}
+  800e14:	48 89 d8             	mov    %rbx,%rax
+  800e17:	5b                   	pop    %rbx
+  800e18:	41 5c                	pop    %r12
+  800e1a:	5d                   	pop    %rbp
+  800e1b:	c3                   	ret
+
+0000000000800e1c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e1c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e1f:	48 85 d2             	test   %rdx,%rdx
+  800e22:	74 1f                	je     800e43 <strncpy+0x27>
+  800e24:	48 01 fa             	add    %rdi,%rdx
+  800e27:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e2a:	48 83 c1 01          	add    $0x1,%rcx
+  800e2e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e32:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e36:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e3a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e3e:	48 39 ca             	cmp    %rcx,%rdx
+  800e41:	75 e7                	jne    800e2a <strncpy+0xe>
+    }
+    return ret;
+}
+  800e43:	c3                   	ret
+
+0000000000800e44 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e44:	48 89 f8             	mov    %rdi,%rax
+  800e47:	48 85 d2             	test   %rdx,%rdx
+  800e4a:	74 24                	je     800e70 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e4c:	48 83 ea 01          	sub    $0x1,%rdx
+  800e50:	74 1b                	je     800e6d <strlcpy+0x29>
+  800e52:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e56:	0f b6 16             	movzbl (%rsi),%edx
+  800e59:	84 d2                	test   %dl,%dl
+  800e5b:	74 10                	je     800e6d <strlcpy+0x29>
+            *dst++ = *src++;
+  800e5d:	48 83 c6 01          	add    $0x1,%rsi
+  800e61:	48 83 c0 01          	add    $0x1,%rax
+  800e65:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e68:	48 39 c8             	cmp    %rcx,%rax
+  800e6b:	75 e9                	jne    800e56 <strlcpy+0x12>
+        *dst = '\0';
+  800e6d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e70:	48 29 f8             	sub    %rdi,%rax
+}
+  800e73:	c3                   	ret
+
+0000000000800e74 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e74:	0f b6 07             	movzbl (%rdi),%eax
+  800e77:	84 c0                	test   %al,%al
+  800e79:	74 13                	je     800e8e <strcmp+0x1a>
+  800e7b:	38 06                	cmp    %al,(%rsi)
+  800e7d:	75 0f                	jne    800e8e <strcmp+0x1a>
+  800e7f:	48 83 c7 01          	add    $0x1,%rdi
+  800e83:	48 83 c6 01          	add    $0x1,%rsi
+  800e87:	0f b6 07             	movzbl (%rdi),%eax
+  800e8a:	84 c0                	test   %al,%al
+  800e8c:	75 ed                	jne    800e7b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e8e:	0f b6 c0             	movzbl %al,%eax
+  800e91:	0f b6 16             	movzbl (%rsi),%edx
+  800e94:	29 d0                	sub    %edx,%eax
+}
+  800e96:	c3                   	ret
+
+0000000000800e97 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e97:	48 85 d2             	test   %rdx,%rdx
+  800e9a:	74 1f                	je     800ebb <strncmp+0x24>
+  800e9c:	0f b6 07             	movzbl (%rdi),%eax
+  800e9f:	84 c0                	test   %al,%al
+  800ea1:	74 1e                	je     800ec1 <strncmp+0x2a>
+  800ea3:	3a 06                	cmp    (%rsi),%al
+  800ea5:	75 1a                	jne    800ec1 <strncmp+0x2a>
+  800ea7:	48 83 c7 01          	add    $0x1,%rdi
+  800eab:	48 83 c6 01          	add    $0x1,%rsi
+  800eaf:	48 83 ea 01          	sub    $0x1,%rdx
+  800eb3:	75 e7                	jne    800e9c <strncmp+0x5>
+
+    if (!n) return 0;
+  800eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eba:	c3                   	ret
+  800ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec0:	c3                   	ret
+  800ec1:	48 85 d2             	test   %rdx,%rdx
+  800ec4:	74 09                	je     800ecf <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ec6:	0f b6 07             	movzbl (%rdi),%eax
+  800ec9:	0f b6 16             	movzbl (%rsi),%edx
+  800ecc:	29 d0                	sub    %edx,%eax
+  800ece:	c3                   	ret
+    if (!n) return 0;
+  800ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ed4:	c3                   	ret
+
+0000000000800ed5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ed5:	0f b6 17             	movzbl (%rdi),%edx
+  800ed8:	84 d2                	test   %dl,%dl
+  800eda:	74 18                	je     800ef4 <strchr+0x1f>
+        if (*str == c) {
+  800edc:	0f be d2             	movsbl %dl,%edx
+  800edf:	39 f2                	cmp    %esi,%edx
+  800ee1:	74 17                	je     800efa <strchr+0x25>
+    for (; *str; str++) {
+  800ee3:	48 83 c7 01          	add    $0x1,%rdi
+  800ee7:	0f b6 17             	movzbl (%rdi),%edx
+  800eea:	84 d2                	test   %dl,%dl
+  800eec:	75 ee                	jne    800edc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef3:	c3                   	ret
+  800ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef9:	c3                   	ret
+  800efa:	48 89 f8             	mov    %rdi,%rax
+}
+  800efd:	c3                   	ret
+
+0000000000800efe <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800efe:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f01:	0f b6 17             	movzbl (%rdi),%edx
+  800f04:	84 d2                	test   %dl,%dl
+  800f06:	74 13                	je     800f1b <strfind+0x1d>
+  800f08:	0f be d2             	movsbl %dl,%edx
+  800f0b:	39 f2                	cmp    %esi,%edx
+  800f0d:	74 0b                	je     800f1a <strfind+0x1c>
+  800f0f:	48 83 c0 01          	add    $0x1,%rax
+  800f13:	0f b6 10             	movzbl (%rax),%edx
+  800f16:	84 d2                	test   %dl,%dl
+  800f18:	75 ee                	jne    800f08 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f1a:	c3                   	ret
+  800f1b:	c3                   	ret
+
+0000000000800f1c <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800f1c:	55                   	push   %rbp
+  800f1d:	48 89 e5             	mov    %rsp,%rbp
+  800f20:	41 57                	push   %r15
+  800f22:	41 56                	push   %r14
+  800f24:	41 55                	push   %r13
+  800f26:	41 54                	push   %r12
+  800f28:	53                   	push   %rbx
+  800f29:	48 83 ec 08          	sub    $0x8,%rsp
+  800f2d:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800f30:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800f34:	45 84 ed             	test   %r13b,%r13b
+  800f37:	75 12                	jne    800f4b <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800f39:	4c 89 f8             	mov    %r15,%rax
+  800f3c:	48 83 c4 08          	add    $0x8,%rsp
+  800f40:	5b                   	pop    %rbx
+  800f41:	41 5c                	pop    %r12
+  800f43:	41 5d                	pop    %r13
+  800f45:	41 5e                	pop    %r14
+  800f47:	41 5f                	pop    %r15
+  800f49:	5d                   	pop    %rbp
+  800f4a:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800f4b:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800f4f:	4c 89 e7             	mov    %r12,%rdi
+  800f52:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  800f59:	00 00 00 
+  800f5c:	ff d0                	call   *%rax
+  800f5e:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800f61:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800f65:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800f69:	49 bf 97 0e 80 00 00 	movabs $0x800e97,%r15
+  800f70:	00 00 00 
+				if ((sc = *s++) == 0)
+  800f73:	84 c0                	test   %al,%al
+  800f75:	75 14                	jne    800f8b <strstr+0x6f>
+					return NULL;
+  800f77:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800f7d:	eb ba                	jmp    800f39 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800f7f:	48 83 c3 01          	add    $0x1,%rbx
+  800f83:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800f87:	84 c0                	test   %al,%al
+  800f89:	74 1b                	je     800fa6 <strstr+0x8a>
+			} while (sc != c);
+  800f8b:	41 38 c5             	cmp    %al,%r13b
+  800f8e:	75 ef                	jne    800f7f <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800f90:	4c 89 f2             	mov    %r14,%rdx
+  800f93:	4c 89 e6             	mov    %r12,%rsi
+  800f96:	48 89 df             	mov    %rbx,%rdi
+  800f99:	41 ff d7             	call   *%r15
+  800f9c:	85 c0                	test   %eax,%eax
+  800f9e:	75 df                	jne    800f7f <strstr+0x63>
+  800fa0:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800fa4:	eb 93                	jmp    800f39 <strstr+0x1d>
+					return NULL;
+  800fa6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800fac:	eb 8b                	jmp    800f39 <strstr+0x1d>
+
+0000000000800fae <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800fae:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800fb0:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800fb3:	8d 57 20             	lea    0x20(%rdi),%edx
+  800fb6:	83 f9 1a             	cmp    $0x1a,%ecx
+  800fb9:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800fbc:	c3                   	ret
+
+0000000000800fbd <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800fbd:	55                   	push   %rbp
+  800fbe:	48 89 e5             	mov    %rsp,%rbp
+  800fc1:	41 57                	push   %r15
+  800fc3:	41 56                	push   %r14
+  800fc5:	41 55                	push   %r13
+  800fc7:	41 54                	push   %r12
+  800fc9:	53                   	push   %rbx
+  800fca:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800fce:	48 39 f7             	cmp    %rsi,%rdi
+  800fd1:	74 49                	je     80101c <strcasecmp+0x5f>
+  800fd3:	49 89 fd             	mov    %rdi,%r13
+  800fd6:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800fd9:	49 bf ae 0f 80 00 00 	movabs $0x800fae,%r15
+  800fe0:	00 00 00 
+  800fe3:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800fe8:	41 0f b6 fe          	movzbl %r14b,%edi
+  800fec:	41 ff d7             	call   *%r15
+  800fef:	89 c3                	mov    %eax,%ebx
+  800ff1:	49 83 c4 01          	add    $0x1,%r12
+  800ff5:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800ffb:	41 ff d7             	call   *%r15
+  800ffe:	29 c3                	sub    %eax,%ebx
+  801000:	75 09                	jne    80100b <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  801002:	49 83 c5 01          	add    $0x1,%r13
+  801006:	45 84 f6             	test   %r14b,%r14b
+  801009:	75 d8                	jne    800fe3 <strcasecmp+0x26>
+}
+  80100b:	89 d8                	mov    %ebx,%eax
+  80100d:	48 83 c4 08          	add    $0x8,%rsp
+  801011:	5b                   	pop    %rbx
+  801012:	41 5c                	pop    %r12
+  801014:	41 5d                	pop    %r13
+  801016:	41 5e                	pop    %r14
+  801018:	41 5f                	pop    %r15
+  80101a:	5d                   	pop    %rbp
+  80101b:	c3                   	ret
+        return 0;
+  80101c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801021:	eb e8                	jmp    80100b <strcasecmp+0x4e>
+
+0000000000801023 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  801023:	55                   	push   %rbp
+  801024:	48 89 e5             	mov    %rsp,%rbp
+  801027:	41 57                	push   %r15
+  801029:	41 56                	push   %r14
+  80102b:	41 55                	push   %r13
+  80102d:	41 54                	push   %r12
+  80102f:	53                   	push   %rbx
+  801030:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  801034:	48 85 d2             	test   %rdx,%rdx
+  801037:	74 4f                	je     801088 <strncasecmp+0x65>
+  801039:	49 89 fc             	mov    %rdi,%r12
+  80103c:	49 89 f5             	mov    %rsi,%r13
+  80103f:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  801043:	49 be ae 0f 80 00 00 	movabs $0x800fae,%r14
+  80104a:	00 00 00 
+  80104d:	49 83 c4 01          	add    $0x1,%r12
+  801051:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801057:	41 ff d6             	call   *%r14
+  80105a:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  80105c:	49 83 c5 01          	add    $0x1,%r13
+  801060:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801065:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801068:	29 c3                	sub    %eax,%ebx
+  80106a:	85 c0                	test   %eax,%eax
+  80106c:	74 09                	je     801077 <strncasecmp+0x54>
+  80106e:	85 db                	test   %ebx,%ebx
+  801070:	75 05                	jne    801077 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  801072:	4d 39 fc             	cmp    %r15,%r12
+  801075:	75 d6                	jne    80104d <strncasecmp+0x2a>
+}
+  801077:	89 d8                	mov    %ebx,%eax
+  801079:	48 83 c4 08          	add    $0x8,%rsp
+  80107d:	5b                   	pop    %rbx
+  80107e:	41 5c                	pop    %r12
+  801080:	41 5d                	pop    %r13
+  801082:	41 5e                	pop    %r14
+  801084:	41 5f                	pop    %r15
+  801086:	5d                   	pop    %rbp
+  801087:	c3                   	ret
+    int d = 0;
+  801088:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  80108d:	eb e8                	jmp    801077 <strncasecmp+0x54>
+
+000000000080108f <toupper>:
+
+int toupper(int c) {
+  80108f:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  801091:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801094:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801097:	83 f9 1a             	cmp    $0x1a,%ecx
+  80109a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80109d:	c3                   	ret
+
+000000000080109e <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  80109e:	83 ff 20             	cmp    $0x20,%edi
+  8010a1:	0f 94 c0             	sete   %al
+  8010a4:	0f b6 c0             	movzbl %al,%eax
+}
+  8010a7:	c3                   	ret
+
+00000000008010a8 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  8010a8:	89 f8                	mov    %edi,%eax
+  8010aa:	f7 d8                	neg    %eax
+  8010ac:	0f 48 c7             	cmovs  %edi,%eax
+}
+  8010af:	c3                   	ret
+
+00000000008010b0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8010b0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8010b3:	48 89 f8             	mov    %rdi,%rax
+  8010b6:	48 f7 d8             	neg    %rax
+  8010b9:	83 e0 07             	and    $0x7,%eax
+  8010bc:	49 89 d1             	mov    %rdx,%r9
+  8010bf:	49 29 c1             	sub    %rax,%r9
+  8010c2:	78 36                	js     8010fa <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8010c4:	40 0f b6 c6          	movzbl %sil,%eax
+  8010c8:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8010cf:	01 01 01 
+  8010d2:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8010d6:	40 f6 c7 07          	test   $0x7,%dil
+  8010da:	75 38                	jne    801114 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8010dc:	4c 89 c9             	mov    %r9,%rcx
+  8010df:	48 c1 f9 03          	sar    $0x3,%rcx
+  8010e3:	74 0c                	je     8010f1 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8010e5:	fc                   	cld
+  8010e6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8010e9:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8010ed:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8010f1:	4d 85 c9             	test   %r9,%r9
+  8010f4:	75 45                	jne    80113b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8010f6:	4c 89 c0             	mov    %r8,%rax
+  8010f9:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8010fa:	48 85 d2             	test   %rdx,%rdx
+  8010fd:	74 f7                	je     8010f6 <memset+0x46>
+  8010ff:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801102:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801105:	48 83 c0 01          	add    $0x1,%rax
+  801109:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80110d:	48 39 c2             	cmp    %rax,%rdx
+  801110:	75 f3                	jne    801105 <memset+0x55>
+  801112:	eb e2                	jmp    8010f6 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801114:	40 f6 c7 01          	test   $0x1,%dil
+  801118:	74 06                	je     801120 <memset+0x70>
+  80111a:	88 07                	mov    %al,(%rdi)
+  80111c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801120:	40 f6 c7 02          	test   $0x2,%dil
+  801124:	74 07                	je     80112d <memset+0x7d>
+  801126:	66 89 07             	mov    %ax,(%rdi)
+  801129:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80112d:	40 f6 c7 04          	test   $0x4,%dil
+  801131:	74 a9                	je     8010dc <memset+0x2c>
+  801133:	89 07                	mov    %eax,(%rdi)
+  801135:	48 83 c7 04          	add    $0x4,%rdi
+  801139:	eb a1                	jmp    8010dc <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80113b:	41 f6 c1 04          	test   $0x4,%r9b
+  80113f:	74 06                	je     801147 <memset+0x97>
+  801141:	89 07                	mov    %eax,(%rdi)
+  801143:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801147:	41 f6 c1 02          	test   $0x2,%r9b
+  80114b:	74 07                	je     801154 <memset+0xa4>
+  80114d:	66 89 07             	mov    %ax,(%rdi)
+  801150:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801154:	41 f6 c1 01          	test   $0x1,%r9b
+  801158:	74 9c                	je     8010f6 <memset+0x46>
+  80115a:	88 07                	mov    %al,(%rdi)
+  80115c:	eb 98                	jmp    8010f6 <memset+0x46>
+
+000000000080115e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80115e:	48 89 f8             	mov    %rdi,%rax
+  801161:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801164:	48 39 fe             	cmp    %rdi,%rsi
+  801167:	73 3b                	jae    8011a4 <memmove+0x46>
+  801169:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80116d:	48 39 d7             	cmp    %rdx,%rdi
+  801170:	73 32                	jae    8011a4 <memmove+0x46>
+        s += n;
+        d += n;
+  801172:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801176:	48 89 d6             	mov    %rdx,%rsi
+  801179:	48 09 fe             	or     %rdi,%rsi
+  80117c:	48 09 ce             	or     %rcx,%rsi
+  80117f:	40 f6 c6 07          	test   $0x7,%sil
+  801183:	75 12                	jne    801197 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801185:	48 83 ef 08          	sub    $0x8,%rdi
+  801189:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80118d:	48 c1 e9 03          	shr    $0x3,%rcx
+  801191:	fd                   	std
+  801192:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801195:	fc                   	cld
+  801196:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801197:	48 83 ef 01          	sub    $0x1,%rdi
+  80119b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80119f:	fd                   	std
+  8011a0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8011a2:	eb f1                	jmp    801195 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011a4:	48 89 f2             	mov    %rsi,%rdx
+  8011a7:	48 09 c2             	or     %rax,%rdx
+  8011aa:	48 09 ca             	or     %rcx,%rdx
+  8011ad:	f6 c2 07             	test   $0x7,%dl
+  8011b0:	75 0c                	jne    8011be <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8011b2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011b6:	48 89 c7             	mov    %rax,%rdi
+  8011b9:	fc                   	cld
+  8011ba:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8011bd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8011be:	48 89 c7             	mov    %rax,%rdi
+  8011c1:	fc                   	cld
+  8011c2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8011c4:	c3                   	ret
+
+00000000008011c5 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8011c5:	55                   	push   %rbp
+  8011c6:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8011c9:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  8011d0:	00 00 00 
+  8011d3:	ff d0                	call   *%rax
+}
+  8011d5:	5d                   	pop    %rbp
+  8011d6:	c3                   	ret
+
+00000000008011d7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8011d7:	55                   	push   %rbp
+  8011d8:	48 89 e5             	mov    %rsp,%rbp
+  8011db:	41 57                	push   %r15
+  8011dd:	41 56                	push   %r14
+  8011df:	41 55                	push   %r13
+  8011e1:	41 54                	push   %r12
+  8011e3:	53                   	push   %rbx
+  8011e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8011e8:	49 89 fe             	mov    %rdi,%r14
+  8011eb:	49 89 f7             	mov    %rsi,%r15
+  8011ee:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8011f1:	48 89 f7             	mov    %rsi,%rdi
+  8011f4:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  8011fb:	00 00 00 
+  8011fe:	ff d0                	call   *%rax
+  801200:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801203:	48 89 de             	mov    %rbx,%rsi
+  801206:	4c 89 f7             	mov    %r14,%rdi
+  801209:	48 b8 ad 0d 80 00 00 	movabs $0x800dad,%rax
+  801210:	00 00 00 
+  801213:	ff d0                	call   *%rax
+  801215:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801218:	48 39 c3             	cmp    %rax,%rbx
+  80121b:	74 36                	je     801253 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80121d:	48 89 d8             	mov    %rbx,%rax
+  801220:	4c 29 e8             	sub    %r13,%rax
+  801223:	49 39 c4             	cmp    %rax,%r12
+  801226:	73 31                	jae    801259 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801228:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80122d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801231:	4c 89 fe             	mov    %r15,%rsi
+  801234:	48 b8 c5 11 80 00 00 	movabs $0x8011c5,%rax
+  80123b:	00 00 00 
+  80123e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801240:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801244:	48 83 c4 08          	add    $0x8,%rsp
+  801248:	5b                   	pop    %rbx
+  801249:	41 5c                	pop    %r12
+  80124b:	41 5d                	pop    %r13
+  80124d:	41 5e                	pop    %r14
+  80124f:	41 5f                	pop    %r15
+  801251:	5d                   	pop    %rbp
+  801252:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801253:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801257:	eb eb                	jmp    801244 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801259:	48 83 eb 01          	sub    $0x1,%rbx
+  80125d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801261:	48 89 da             	mov    %rbx,%rdx
+  801264:	4c 89 fe             	mov    %r15,%rsi
+  801267:	48 b8 c5 11 80 00 00 	movabs $0x8011c5,%rax
+  80126e:	00 00 00 
+  801271:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801273:	49 01 de             	add    %rbx,%r14
+  801276:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80127b:	eb c3                	jmp    801240 <strlcat+0x69>
+
+000000000080127d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80127d:	48 85 d2             	test   %rdx,%rdx
+  801280:	74 2d                	je     8012af <memcmp+0x32>
+  801282:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801287:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80128b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801290:	44 38 c1             	cmp    %r8b,%cl
+  801293:	75 0f                	jne    8012a4 <memcmp+0x27>
+    while (n-- > 0) {
+  801295:	48 83 c0 01          	add    $0x1,%rax
+  801299:	48 39 c2             	cmp    %rax,%rdx
+  80129c:	75 e9                	jne    801287 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80129e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8012a4:	0f b6 c1             	movzbl %cl,%eax
+  8012a7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8012ab:	44 29 c0             	sub    %r8d,%eax
+  8012ae:	c3                   	ret
+    return 0;
+  8012af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012b4:	c3                   	ret
+
+00000000008012b5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8012b5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8012b9:	48 39 c7             	cmp    %rax,%rdi
+  8012bc:	73 0f                	jae    8012cd <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8012be:	40 38 37             	cmp    %sil,(%rdi)
+  8012c1:	74 0e                	je     8012d1 <memfind+0x1c>
+    for (; src < end; src++) {
+  8012c3:	48 83 c7 01          	add    $0x1,%rdi
+  8012c7:	48 39 f8             	cmp    %rdi,%rax
+  8012ca:	75 f2                	jne    8012be <memfind+0x9>
+  8012cc:	c3                   	ret
+  8012cd:	48 89 f8             	mov    %rdi,%rax
+  8012d0:	c3                   	ret
+  8012d1:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8012d4:	c3                   	ret
+
+00000000008012d5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8012d5:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8012d8:	0f b6 37             	movzbl (%rdi),%esi
+  8012db:	40 80 fe 20          	cmp    $0x20,%sil
+  8012df:	74 06                	je     8012e7 <strtol+0x12>
+  8012e1:	40 80 fe 09          	cmp    $0x9,%sil
+  8012e5:	75 13                	jne    8012fa <strtol+0x25>
+  8012e7:	48 83 c7 01          	add    $0x1,%rdi
+  8012eb:	0f b6 37             	movzbl (%rdi),%esi
+  8012ee:	40 80 fe 20          	cmp    $0x20,%sil
+  8012f2:	74 f3                	je     8012e7 <strtol+0x12>
+  8012f4:	40 80 fe 09          	cmp    $0x9,%sil
+  8012f8:	74 ed                	je     8012e7 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8012fa:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8012fd:	83 e0 fd             	and    $0xfffffffd,%eax
+  801300:	3c 01                	cmp    $0x1,%al
+  801302:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801306:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80130c:	75 0f                	jne    80131d <strtol+0x48>
+  80130e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801311:	74 14                	je     801327 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801313:	85 d2                	test   %edx,%edx
+  801315:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80131a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80131d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801322:	4c 63 ca             	movslq %edx,%r9
+  801325:	eb 36                	jmp    80135d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801327:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80132b:	74 0f                	je     80133c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80132d:	85 d2                	test   %edx,%edx
+  80132f:	75 ec                	jne    80131d <strtol+0x48>
+        s++;
+  801331:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801335:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80133a:	eb e1                	jmp    80131d <strtol+0x48>
+        s += 2;
+  80133c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801340:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801345:	eb d6                	jmp    80131d <strtol+0x48>
+            dig -= '0';
+  801347:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80134a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80134e:	41 39 d0             	cmp    %edx,%r8d
+  801351:	7d 21                	jge    801374 <strtol+0x9f>
+        val = val * base + dig;
+  801353:	49 0f af c1          	imul   %r9,%rax
+  801357:	0f b6 c9             	movzbl %cl,%ecx
+  80135a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80135d:	48 83 c7 01          	add    $0x1,%rdi
+  801361:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801365:	80 f9 39             	cmp    $0x39,%cl
+  801368:	76 dd                	jbe    801347 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80136a:	80 f9 7b             	cmp    $0x7b,%cl
+  80136d:	77 05                	ja     801374 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80136f:	83 e9 57             	sub    $0x57,%ecx
+  801372:	eb d6                	jmp    80134a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801374:	4d 85 d2             	test   %r10,%r10
+  801377:	74 03                	je     80137c <strtol+0xa7>
+  801379:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80137c:	48 89 c2             	mov    %rax,%rdx
+  80137f:	48 f7 da             	neg    %rdx
+  801382:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801386:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80138a:	c3                   	ret
+
+000000000080138b <atoi>:
+int atoi(const char *str) {
+  80138b:	55                   	push   %rbp
+  80138c:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  80138f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801394:	be 00 00 00 00       	mov    $0x0,%esi
+  801399:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  8013a0:	00 00 00 
+  8013a3:	ff d0                	call   *%rax
+}
+  8013a5:	5d                   	pop    %rbp
+  8013a6:	c3                   	ret
+
+00000000008013a7 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8013a7:	55                   	push   %rbp
+  8013a8:	48 89 e5             	mov    %rsp,%rbp
+  8013ab:	53                   	push   %rbx
+  8013ac:	48 89 fa             	mov    %rdi,%rdx
+  8013af:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b2:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013cc:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8013ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d2:	c9                   	leave
+  8013d3:	c3                   	ret
+
+00000000008013d4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8013d4:	55                   	push   %rbp
+  8013d5:	48 89 e5             	mov    %rsp,%rbp
+  8013d8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013fd:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801403:	c9                   	leave
+  801404:	c3                   	ret
+
+0000000000801405 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801405:	55                   	push   %rbp
+  801406:	48 89 e5             	mov    %rsp,%rbp
+  801409:	53                   	push   %rbx
+  80140a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80140e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801411:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801416:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80141b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801420:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801425:	be 00 00 00 00       	mov    $0x0,%esi
+  80142a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801430:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801432:	48 85 c0             	test   %rax,%rax
+  801435:	7f 06                	jg     80143d <sys_env_destroy+0x38>
+}
+  801437:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143b:	c9                   	leave
+  80143c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143d:	49 89 c0             	mov    %rax,%r8
+  801440:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801445:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  80144c:	00 00 00 
+  80144f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801454:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80145b:	00 00 00 
+  80145e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801463:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  80146a:	00 00 00 
+  80146d:	41 ff d1             	call   *%r9
+
+0000000000801470 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801470:	55                   	push   %rbp
+  801471:	48 89 e5             	mov    %rsp,%rbp
+  801474:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801475:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801484:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801489:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148e:	be 00 00 00 00       	mov    $0x0,%esi
+  801493:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801499:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80149b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149f:	c9                   	leave
+  8014a0:	c3                   	ret
+
+00000000008014a1 <sys_yield>:
+
+void
+sys_yield(void) {
+  8014a1:	55                   	push   %rbp
+  8014a2:	48 89 e5             	mov    %rsp,%rbp
+  8014a5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ca:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d0:	c9                   	leave
+  8014d1:	c3                   	ret
+
+00000000008014d2 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8014d2:	55                   	push   %rbp
+  8014d3:	48 89 e5             	mov    %rsp,%rbp
+  8014d6:	53                   	push   %rbx
+  8014d7:	48 89 fa             	mov    %rdi,%rdx
+  8014da:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e2:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8014e9:	00 00 00 
+  8014ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014fc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8014fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801502:	c9                   	leave
+  801503:	c3                   	ret
+
+0000000000801504 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801504:	55                   	push   %rbp
+  801505:	48 89 e5             	mov    %rsp,%rbp
+  801508:	53                   	push   %rbx
+  801509:	49 89 f8             	mov    %rdi,%r8
+  80150c:	48 89 d3             	mov    %rdx,%rbx
+  80150f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801512:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801517:	4c 89 c2             	mov    %r8,%rdx
+  80151a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151d:	be 00 00 00 00       	mov    $0x0,%esi
+  801522:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801528:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80152a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152e:	c9                   	leave
+  80152f:	c3                   	ret
+
+0000000000801530 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801530:	55                   	push   %rbp
+  801531:	48 89 e5             	mov    %rsp,%rbp
+  801534:	53                   	push   %rbx
+  801535:	48 83 ec 08          	sub    $0x8,%rsp
+  801539:	89 f8                	mov    %edi,%eax
+  80153b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80153e:	48 63 f9             	movslq %ecx,%rdi
+  801541:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801544:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801549:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154c:	be 00 00 00 00       	mov    $0x0,%esi
+  801551:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801557:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801559:	48 85 c0             	test   %rax,%rax
+  80155c:	7f 06                	jg     801564 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80155e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801562:	c9                   	leave
+  801563:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801564:	49 89 c0             	mov    %rax,%r8
+  801567:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80156c:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801573:	00 00 00 
+  801576:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80157b:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801582:	00 00 00 
+  801585:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158a:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  801591:	00 00 00 
+  801594:	41 ff d1             	call   *%r9
+
+0000000000801597 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801597:	55                   	push   %rbp
+  801598:	48 89 e5             	mov    %rsp,%rbp
+  80159b:	53                   	push   %rbx
+  80159c:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a0:	89 f8                	mov    %edi,%eax
+  8015a2:	49 89 f2             	mov    %rsi,%r10
+  8015a5:	48 89 cf             	mov    %rcx,%rdi
+  8015a8:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8015ab:	48 63 da             	movslq %edx,%rbx
+  8015ae:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b9:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8015bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015be:	48 85 c0             	test   %rax,%rax
+  8015c1:	7f 06                	jg     8015c9 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c7:	c9                   	leave
+  8015c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c9:	49 89 c0             	mov    %rax,%r8
+  8015cc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8015d1:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8015d8:	00 00 00 
+  8015db:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015e0:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8015e7:	00 00 00 
+  8015ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ef:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  8015f6:	00 00 00 
+  8015f9:	41 ff d1             	call   *%r9
+
+00000000008015fc <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015fc:	55                   	push   %rbp
+  8015fd:	48 89 e5             	mov    %rsp,%rbp
+  801600:	53                   	push   %rbx
+  801601:	48 83 ec 08          	sub    $0x8,%rsp
+  801605:	49 89 f9             	mov    %rdi,%r9
+  801608:	89 f0                	mov    %esi,%eax
+  80160a:	48 89 d3             	mov    %rdx,%rbx
+  80160d:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801610:	49 63 f0             	movslq %r8d,%rsi
+  801613:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801616:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80161b:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80161e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801624:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801626:	48 85 c0             	test   %rax,%rax
+  801629:	7f 06                	jg     801631 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80162b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80162f:	c9                   	leave
+  801630:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801631:	49 89 c0             	mov    %rax,%r8
+  801634:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801639:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801640:	00 00 00 
+  801643:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801648:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80164f:	00 00 00 
+  801652:	b8 00 00 00 00       	mov    $0x0,%eax
+  801657:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  80165e:	00 00 00 
+  801661:	41 ff d1             	call   *%r9
+
+0000000000801664 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801664:	55                   	push   %rbp
+  801665:	48 89 e5             	mov    %rsp,%rbp
+  801668:	53                   	push   %rbx
+  801669:	89 f8                	mov    %edi,%eax
+  80166b:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80166e:	48 63 f9             	movslq %ecx,%rdi
+  801671:	48 63 da             	movslq %edx,%rbx
+  801674:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801677:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80167c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167f:	be 00 00 00 00       	mov    $0x0,%esi
+  801684:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80168a:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80168c:	89 c2                	mov    %eax,%edx
+  80168e:	48 85 c0             	test   %rax,%rax
+  801691:	78 0d                	js     8016a0 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801693:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801698:	4d 85 c9             	test   %r9,%r9
+  80169b:	74 03                	je     8016a0 <sys_alloc_dma_region+0x3c>
+  80169d:	49 89 01             	mov    %rax,(%r9)
+}
+  8016a0:	89 d0                	mov    %edx,%eax
+  8016a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a6:	c9                   	leave
+  8016a7:	c3                   	ret
+
+00000000008016a8 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8016a8:	55                   	push   %rbp
+  8016a9:	48 89 e5             	mov    %rsp,%rbp
+  8016ac:	53                   	push   %rbx
+  8016ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b1:	48 89 f1             	mov    %rsi,%rcx
+  8016b4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8016b7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ba:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d1:	48 85 c0             	test   %rax,%rax
+  8016d4:	7f 06                	jg     8016dc <sys_set_cache_region+0x34>
+}
+  8016d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016da:	c9                   	leave
+  8016db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016dc:	49 89 c0             	mov    %rax,%r8
+  8016df:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8016e4:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8016eb:	00 00 00 
+  8016ee:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016f3:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8016fa:	00 00 00 
+  8016fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801702:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  801709:	00 00 00 
+  80170c:	41 ff d1             	call   *%r9
+
+000000000080170f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	53                   	push   %rbx
+  801714:	48 83 ec 08          	sub    $0x8,%rsp
+  801718:	48 89 f1             	mov    %rsi,%rcx
+  80171b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80171e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801721:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801726:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172b:	be 00 00 00 00       	mov    $0x0,%esi
+  801730:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801736:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801738:	48 85 c0             	test   %rax,%rax
+  80173b:	7f 06                	jg     801743 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80173d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801741:	c9                   	leave
+  801742:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801743:	49 89 c0             	mov    %rax,%r8
+  801746:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80174b:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801752:	00 00 00 
+  801755:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80175a:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801761:	00 00 00 
+  801764:	b8 00 00 00 00       	mov    $0x0,%eax
+  801769:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  801770:	00 00 00 
+  801773:	41 ff d1             	call   *%r9
+
+0000000000801776 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801776:	55                   	push   %rbp
+  801777:	48 89 e5             	mov    %rsp,%rbp
+  80177a:	53                   	push   %rbx
+  80177b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80177f:	48 63 ce             	movslq %esi,%rcx
+  801782:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801785:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80178a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801794:	be 00 00 00 00       	mov    $0x0,%esi
+  801799:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80179f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017a1:	48 85 c0             	test   %rax,%rax
+  8017a4:	7f 06                	jg     8017ac <sys_env_set_status+0x36>
+}
+  8017a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017aa:	c9                   	leave
+  8017ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017ac:	49 89 c0             	mov    %rax,%r8
+  8017af:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8017b4:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8017bb:	00 00 00 
+  8017be:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017c3:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8017ca:	00 00 00 
+  8017cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d2:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  8017d9:	00 00 00 
+  8017dc:	41 ff d1             	call   *%r9
+
+00000000008017df <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8017df:	55                   	push   %rbp
+  8017e0:	48 89 e5             	mov    %rsp,%rbp
+  8017e3:	53                   	push   %rbx
+  8017e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8017eb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ee:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801802:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801808:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80180a:	48 85 c0             	test   %rax,%rax
+  80180d:	7f 06                	jg     801815 <sys_env_set_trapframe+0x36>
+}
+  80180f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801813:	c9                   	leave
+  801814:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801815:	49 89 c0             	mov    %rax,%r8
+  801818:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80181d:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801824:	00 00 00 
+  801827:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80182c:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801833:	00 00 00 
+  801836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183b:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  801842:	00 00 00 
+  801845:	41 ff d1             	call   *%r9
+
+0000000000801848 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801848:	55                   	push   %rbp
+  801849:	48 89 e5             	mov    %rsp,%rbp
+  80184c:	53                   	push   %rbx
+  80184d:	48 83 ec 08          	sub    $0x8,%rsp
+  801851:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801854:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801857:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80185c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801861:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801866:	be 00 00 00 00       	mov    $0x0,%esi
+  80186b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801871:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801873:	48 85 c0             	test   %rax,%rax
+  801876:	7f 06                	jg     80187e <sys_env_set_pgfault_upcall+0x36>
+}
+  801878:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80187c:	c9                   	leave
+  80187d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80187e:	49 89 c0             	mov    %rax,%r8
+  801881:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801886:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  80188d:	00 00 00 
+  801890:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801895:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80189c:	00 00 00 
+  80189f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a4:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  8018ab:	00 00 00 
+  8018ae:	41 ff d1             	call   *%r9
+
+00000000008018b1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8018b1:	55                   	push   %rbp
+  8018b2:	48 89 e5             	mov    %rsp,%rbp
+  8018b5:	53                   	push   %rbx
+  8018b6:	89 f8                	mov    %edi,%eax
+  8018b8:	49 89 f1             	mov    %rsi,%r9
+  8018bb:	48 89 d3             	mov    %rdx,%rbx
+  8018be:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8018c1:	49 63 f0             	movslq %r8d,%rsi
+  8018c4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018cc:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018d5:	cd 30                	int    $0x30
+}
+  8018d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018db:	c9                   	leave
+  8018dc:	c3                   	ret
+
+00000000008018dd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8018dd:	55                   	push   %rbp
+  8018de:	48 89 e5             	mov    %rsp,%rbp
+  8018e1:	53                   	push   %rbx
+  8018e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8018e6:	48 89 fa             	mov    %rdi,%rdx
+  8018e9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018ec:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801900:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801906:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801908:	48 85 c0             	test   %rax,%rax
+  80190b:	7f 06                	jg     801913 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80190d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801911:	c9                   	leave
+  801912:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801913:	49 89 c0             	mov    %rax,%r8
+  801916:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80191b:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801922:	00 00 00 
+  801925:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80192a:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801931:	00 00 00 
+  801934:	b8 00 00 00 00       	mov    $0x0,%eax
+  801939:	49 b9 08 03 80 00 00 	movabs $0x800308,%r9
+  801940:	00 00 00 
+  801943:	41 ff d1             	call   *%r9
+
+0000000000801946 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801946:	55                   	push   %rbp
+  801947:	48 89 e5             	mov    %rsp,%rbp
+  80194a:	53                   	push   %rbx
+  80194b:	48 89 fa             	mov    %rdi,%rdx
+  80194e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801951:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801956:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80195b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801960:	be 00 00 00 00       	mov    $0x0,%esi
+  801965:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80196b:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80196d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801971:	c9                   	leave
+  801972:	c3                   	ret
+
+0000000000801973 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801973:	55                   	push   %rbp
+  801974:	48 89 e5             	mov    %rsp,%rbp
+  801977:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801978:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80197d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801982:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801987:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801991:	be 00 00 00 00       	mov    $0x0,%esi
+  801996:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80199c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80199e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019a2:	c9                   	leave
+  8019a3:	c3                   	ret
+
+00000000008019a4 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8019a4:	48 85 ff             	test   %rdi,%rdi
+  8019a7:	0f 84 b6 01 00 00    	je     801b63 <malloc+0x1bf>
+malloc(size_t size) {
+  8019ad:	55                   	push   %rbp
+  8019ae:	48 89 e5             	mov    %rsp,%rbp
+  8019b1:	41 56                	push   %r14
+  8019b3:	41 55                	push   %r13
+  8019b5:	41 54                	push   %r12
+  8019b7:	53                   	push   %rbx
+  8019b8:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8019bb:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8019c2:	00 00 00 
+  8019c5:	4c 8b 20             	mov    (%rax),%r12
+  8019c8:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  8019cf:	0f 87 94 01 00 00    	ja     801b69 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  8019d5:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8019dc:	00 00 00 
+  8019df:	48 85 c0             	test   %rax,%rax
+  8019e2:	74 6b                	je     801a4f <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  8019e4:	4d 85 e4             	test   %r12,%r12
+  8019e7:	74 66                	je     801a4f <malloc+0xab>
+  8019e9:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  8019f0:	00 00 00 
+  8019f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019f8:	eb 0d                	jmp    801a07 <malloc+0x63>
+  8019fa:	48 83 c1 01          	add    $0x1,%rcx
+  8019fe:	48 83 c2 18          	add    $0x18,%rdx
+  801a02:	49 39 cc             	cmp    %rcx,%r12
+  801a05:	74 48                	je     801a4f <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801a07:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801a0c:	74 ec                	je     8019fa <malloc+0x56>
+  801a0e:	48 39 1a             	cmp    %rbx,(%rdx)
+  801a11:	72 e7                	jb     8019fa <malloc+0x56>
+                real_freep_size--;
+  801a13:	48 83 e8 01          	sub    $0x1,%rax
+  801a17:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801a1e:	00 00 00 
+                freep[i].is_free = false;
+  801a21:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801a28:	00 00 00 
+  801a2b:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801a2f:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801a33:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801a37:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801a3e:	00 
+                freep[i].size = size;
+  801a3f:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801a43:	48 01 c8             	add    %rcx,%rax
+  801a46:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801a4a:	e9 0b 01 00 00       	jmp    801b5a <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801a4f:	48 a1 10 60 80 00 00 	movabs 0x806010,%rax
+  801a56:	00 00 00 
+  801a59:	48 01 d8             	add    %rbx,%rax
+  801a5c:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801a62:	76 7c                	jbe    801ae0 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801a64:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  801a6b:	00 00 00 
+  801a6e:	4c 8b 30             	mov    (%rax),%r14
+  801a71:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801a78:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801a7b:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801a82:	00 00 00 
+  801a85:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801a8c:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801a93:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801a99:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801a9d:	48 b8 70 14 80 00 00 	movabs $0x801470,%rax
+  801aa4:	00 00 00 
+  801aa7:	ff d0                	call   *%rax
+  801aa9:	89 c7                	mov    %eax,%edi
+  801aab:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801ab2:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801ab9:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801ac0:	00 00 00 
+  801ac3:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801ac7:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801acc:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  801ad3:	00 00 00 
+  801ad6:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801ad8:	85 c0                	test   %eax,%eax
+  801ada:	0f 88 90 00 00 00    	js     801b70 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801ae0:	48 b9 18 60 80 00 00 	movabs $0x806018,%rcx
+  801ae7:	00 00 00 
+  801aea:	48 8b 31             	mov    (%rcx),%rsi
+  801aed:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801af4:	00 00 00 
+  801af7:	4c 8b 07             	mov    (%rdi),%r8
+  801afa:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801afe:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801b05:	00 00 00 
+  801b08:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801b0c:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801b10:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801b17:	00 00 00 
+  801b1a:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801b1e:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801b21:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801b25:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801b2c:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801b2d:	48 89 d8             	mov    %rbx,%rax
+  801b30:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801b35:	4c 01 c0             	add    %r8,%rax
+  801b38:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801b3b:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801b42:	48 01 f3             	add    %rsi,%rbx
+  801b45:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801b48:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801b4d:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801b54:	00 00 00 
+  801b57:	48 89 d0             	mov    %rdx,%rax
+}
+  801b5a:	5b                   	pop    %rbx
+  801b5b:	41 5c                	pop    %r12
+  801b5d:	41 5d                	pop    %r13
+  801b5f:	41 5e                	pop    %r14
+  801b61:	5d                   	pop    %rbp
+  801b62:	c3                   	ret
+        return NULL;
+  801b63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b68:	c3                   	ret
+        return NULL;
+  801b69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b6e:	eb ea                	jmp    801b5a <malloc+0x1b6>
+            return NULL;
+  801b70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b75:	eb e3                	jmp    801b5a <malloc+0x1b6>
+
+0000000000801b77 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801b77:	55                   	push   %rbp
+  801b78:	48 89 e5             	mov    %rsp,%rbp
+  801b7b:	53                   	push   %rbx
+  801b7c:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801b80:	48 89 fb             	mov    %rdi,%rbx
+  801b83:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801b87:	48 89 df             	mov    %rbx,%rdi
+  801b8a:	48 b8 a4 19 80 00 00 	movabs $0x8019a4,%rax
+  801b91:	00 00 00 
+  801b94:	ff d0                	call   *%rax
+  801b96:	48 89 c7             	mov    %rax,%rdi
+  801b99:	48 89 da             	mov    %rbx,%rdx
+  801b9c:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba1:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  801ba8:	00 00 00 
+  801bab:	ff d0                	call   *%rax
+}
+  801bad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bb1:	c9                   	leave
+  801bb2:	c3                   	ret
+
+0000000000801bb3 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801bb3:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801bba:	00 00 00 
+  801bbd:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801bc4:	00 00 00 
+  801bc7:	48 3b 02             	cmp    (%rdx),%rax
+  801bca:	74 4d                	je     801c19 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801bcc:	48 85 c0             	test   %rax,%rax
+  801bcf:	74 4d                	je     801c1e <get_allocsize+0x6b>
+  801bd1:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801bd8:	00 00 00 
+  801bdb:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801be0:	48 3b 39             	cmp    (%rcx),%rdi
+  801be3:	74 13                	je     801bf8 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801be5:	48 83 c2 01          	add    $0x1,%rdx
+  801be9:	48 83 c1 18          	add    $0x18,%rcx
+  801bed:	48 39 d0             	cmp    %rdx,%rax
+  801bf0:	75 ee                	jne    801be0 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf7:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801bf8:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c01:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801c08:	00 00 00 
+  801c0b:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801c11:	75 0b                	jne    801c1e <get_allocsize+0x6b>
+  801c13:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801c18:	c3                   	ret
+        return 0;
+  801c19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c1e:	c3                   	ret
+
+0000000000801c1f <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801c1f:	48 85 ff             	test   %rdi,%rdi
+  801c22:	0f 84 01 01 00 00    	je     801d29 <free+0x10a>
+free(void *ptr) {
+  801c28:	55                   	push   %rbp
+  801c29:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801c2c:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801c33:	00 00 00 
+  801c36:	48 8b 30             	mov    (%rax),%rsi
+  801c39:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801c40:	00 00 00 
+  801c43:	48 39 c6             	cmp    %rax,%rsi
+  801c46:	74 50                	je     801c98 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801c48:	48 85 f6             	test   %rsi,%rsi
+  801c4b:	74 21                	je     801c6e <free+0x4f>
+  801c4d:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801c54:	00 00 00 
+  801c57:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801c5c:	48 3b 39             	cmp    (%rcx),%rdi
+  801c5f:	74 61                	je     801cc2 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801c61:	48 83 c2 01          	add    $0x1,%rdx
+  801c65:	48 83 c1 18          	add    $0x18,%rcx
+  801c69:	48 39 d6             	cmp    %rdx,%rsi
+  801c6c:	75 ee                	jne    801c5c <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801c6e:	48 ba 10 56 80 00 00 	movabs $0x805610,%rdx
+  801c75:	00 00 00 
+  801c78:	be 12 01 00 00       	mov    $0x112,%esi
+  801c7d:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801c84:	00 00 00 
+  801c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8c:	48 b9 08 03 80 00 00 	movabs $0x800308,%rcx
+  801c93:	00 00 00 
+  801c96:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801c98:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801c9f:	00 00 00 
+  801ca2:	be 06 01 00 00       	mov    $0x106,%esi
+  801ca7:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801cae:	00 00 00 
+  801cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb6:	48 b9 08 03 80 00 00 	movabs $0x800308,%rcx
+  801cbd:	00 00 00 
+  801cc0:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801cc2:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801cc6:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801ccd:	00 00 00 
+  801cd0:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801cd6:	75 27                	jne    801cff <free+0xe0>
+            freep[i].is_free = true;
+  801cd8:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801cdc:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801ce3:	00 00 00 
+  801ce6:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801ced:	00 00 
+            real_freep_size++;
+  801cef:	48 83 c0 01          	add    $0x1,%rax
+  801cf3:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801cfa:	00 00 00 
+}
+  801cfd:	5d                   	pop    %rbp
+  801cfe:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801cff:	48 ba e8 55 80 00 00 	movabs $0x8055e8,%rdx
+  801d06:	00 00 00 
+  801d09:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801d0e:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801d15:	00 00 00 
+  801d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1d:	48 b9 08 03 80 00 00 	movabs $0x800308,%rcx
+  801d24:	00 00 00 
+  801d27:	ff d1                	call   *%rcx
+  801d29:	c3                   	ret
+
+0000000000801d2a <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801d2a:	55                   	push   %rbp
+  801d2b:	48 89 e5             	mov    %rsp,%rbp
+  801d2e:	41 55                	push   %r13
+  801d30:	41 54                	push   %r12
+  801d32:	53                   	push   %rbx
+  801d33:	48 83 ec 08          	sub    $0x8,%rsp
+  801d37:	48 89 fb             	mov    %rdi,%rbx
+  801d3a:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801d3d:	48 b8 b3 1b 80 00 00 	movabs $0x801bb3,%rax
+  801d44:	00 00 00 
+  801d47:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801d49:	49 39 c5             	cmp    %rax,%r13
+  801d4c:	73 0e                	jae    801d5c <realloc+0x32>
+}
+  801d4e:	48 89 d8             	mov    %rbx,%rax
+  801d51:	48 83 c4 08          	add    $0x8,%rsp
+  801d55:	5b                   	pop    %rbx
+  801d56:	41 5c                	pop    %r12
+  801d58:	41 5d                	pop    %r13
+  801d5a:	5d                   	pop    %rbp
+  801d5b:	c3                   	ret
+  801d5c:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801d5f:	4c 89 ef             	mov    %r13,%rdi
+  801d62:	48 b8 a4 19 80 00 00 	movabs $0x8019a4,%rax
+  801d69:	00 00 00 
+  801d6c:	ff d0                	call   *%rax
+  801d6e:	48 89 c7             	mov    %rax,%rdi
+  801d71:	4c 89 e2             	mov    %r12,%rdx
+  801d74:	48 89 de             	mov    %rbx,%rsi
+  801d77:	48 b8 c5 11 80 00 00 	movabs $0x8011c5,%rax
+  801d7e:	00 00 00 
+  801d81:	ff d0                	call   *%rax
+  801d83:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801d86:	48 89 df             	mov    %rbx,%rdi
+  801d89:	48 b8 1f 1c 80 00 00 	movabs $0x801c1f,%rax
+  801d90:	00 00 00 
+  801d93:	ff d0                	call   *%rax
+    return newptr;
+  801d95:	4c 89 e3             	mov    %r12,%rbx
+  801d98:	eb b4                	jmp    801d4e <realloc+0x24>
+
+0000000000801d9a <strdup>:
+
+char*
+strdup (const char *src) {
+  801d9a:	55                   	push   %rbp
+  801d9b:	48 89 e5             	mov    %rsp,%rbp
+  801d9e:	41 54                	push   %r12
+  801da0:	53                   	push   %rbx
+  801da1:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801da4:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  801dab:	00 00 00 
+  801dae:	ff d0                	call   *%rax
+  801db0:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801db4:	4c 89 e7             	mov    %r12,%rdi
+  801db7:	48 b8 a4 19 80 00 00 	movabs $0x8019a4,%rax
+  801dbe:	00 00 00 
+  801dc1:	ff d0                	call   *%rax
+  801dc3:	48 89 c7             	mov    %rax,%rdi
+  801dc6:	4c 89 e2             	mov    %r12,%rdx
+  801dc9:	48 89 de             	mov    %rbx,%rsi
+  801dcc:	48 b8 c5 11 80 00 00 	movabs $0x8011c5,%rax
+  801dd3:	00 00 00 
+  801dd6:	ff d0                	call   *%rax
+}
+  801dd8:	5b                   	pop    %rbx
+  801dd9:	41 5c                	pop    %r12
+  801ddb:	5d                   	pop    %rbp
+  801ddc:	c3                   	ret
+
+0000000000801ddd <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801ddd:	55                   	push   %rbp
+  801dde:	48 89 e5             	mov    %rsp,%rbp
+  801de1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801de2:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801de7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dec:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801df1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801df6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dfb:	be 00 00 00 00       	mov    $0x0,%esi
+  801e00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e06:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e08:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e0c:	c9                   	leave
+  801e0d:	c3                   	ret
+
+0000000000801e0e <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801e0e:	55                   	push   %rbp
+  801e0f:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801e12:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801e19:	00 00 00 
+  801e1c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801e20:	74 26                	je     801e48 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801e22:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801e24:	48 c1 e2 20          	shl    $0x20,%rdx
+  801e28:	89 c0                	mov    %eax,%eax
+  801e2a:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801e2d:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801e34:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801e3b:	00 00 00 
+  801e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e43:	48 f7 31             	divq   (%rcx)
+}
+  801e46:	5d                   	pop    %rbp
+  801e47:	c3                   	ret
+        freq = get_cpufreq();
+  801e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4d:	48 ba dd 1d 80 00 00 	movabs $0x801ddd,%rdx
+  801e54:	00 00 00 
+  801e57:	ff d2                	call   *%rdx
+  801e59:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801e60:	00 00 00 
+  801e63:	eb bd                	jmp    801e22 <get_ticks+0x14>
+
+0000000000801e65 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801e65:	55                   	push   %rbp
+  801e66:	48 89 e5             	mov    %rsp,%rbp
+  801e69:	53                   	push   %rbx
+  801e6a:	48 83 ec 08          	sub    $0x8,%rsp
+  801e6e:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801e71:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801e78:	00 00 00 
+  801e7b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801e7f:	74 50                	je     801ed1 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801e81:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801e83:	48 c1 e2 20          	shl    $0x20,%rdx
+  801e87:	89 c0                	mov    %eax,%eax
+  801e89:	48 89 d6             	mov    %rdx,%rsi
+  801e8c:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801e8f:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801e96:	00 00 00 
+  801e99:	48 0f af 18          	imul   (%rax),%rbx
+  801e9d:	48 c1 eb 03          	shr    $0x3,%rbx
+  801ea1:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801ea8:	9b c4 20 
+  801eab:	48 89 d8             	mov    %rbx,%rax
+  801eae:	48 f7 e2             	mul    %rdx
+  801eb1:	48 89 d1             	mov    %rdx,%rcx
+  801eb4:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801eb8:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801eba:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ebe:	89 c0                	mov    %eax,%eax
+  801ec0:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801ec3:	48 29 f2             	sub    %rsi,%rdx
+  801ec6:	48 39 ca             	cmp    %rcx,%rdx
+  801ec9:	72 ed                	jb     801eb8 <sleep+0x53>
+}
+  801ecb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ecf:	c9                   	leave
+  801ed0:	c3                   	ret
+        freq = get_cpufreq();
+  801ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed6:	48 ba dd 1d 80 00 00 	movabs $0x801ddd,%rdx
+  801edd:	00 00 00 
+  801ee0:	ff d2                	call   *%rdx
+  801ee2:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801ee9:	00 00 00 
+  801eec:	eb 93                	jmp    801e81 <sleep+0x1c>
+
+0000000000801eee <poll_kbd>:
+
+int poll_kbd() {
+  801eee:	55                   	push   %rbp
+  801eef:	48 89 e5             	mov    %rsp,%rbp
+  801ef2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ef3:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ef8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801efd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f07:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f0c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f17:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f1d:	c9                   	leave
+  801f1e:	c3                   	ret
+
+0000000000801f1f <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801f1f:	55                   	push   %rbp
+  801f20:	48 89 e5             	mov    %rsp,%rbp
+  801f23:	53                   	push   %rbx
+  801f24:	49 89 fa             	mov    %rdi,%r10
+  801f27:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801f29:	44 89 c6             	mov    %r8d,%esi
+  801f2c:	89 cf                	mov    %ecx,%edi
+  801f2e:	89 d3                	mov    %edx,%ebx
+  801f30:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801f32:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f37:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f3a:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801f3e:	cd 30                	int    $0x30
+  801f40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+
+0000000000801f46 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f46:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801f4d:	ff ff ff 
+  801f50:	48 01 f8             	add    %rdi,%rax
+  801f53:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801f57:	c3                   	ret
+
+0000000000801f58 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f58:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801f5f:	ff ff ff 
+  801f62:	48 01 f8             	add    %rdi,%rax
+  801f65:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801f69:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801f6f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801f73:	c3                   	ret
+
+0000000000801f74 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801f74:	55                   	push   %rbp
+  801f75:	48 89 e5             	mov    %rsp,%rbp
+  801f78:	41 57                	push   %r15
+  801f7a:	41 56                	push   %r14
+  801f7c:	41 55                	push   %r13
+  801f7e:	41 54                	push   %r12
+  801f80:	53                   	push   %rbx
+  801f81:	48 83 ec 08          	sub    $0x8,%rsp
+  801f85:	49 89 ff             	mov    %rdi,%r15
+  801f88:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801f8d:	49 bd f0 3f 80 00 00 	movabs $0x803ff0,%r13
+  801f94:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801f97:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801f9d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801fa0:	48 89 df             	mov    %rbx,%rdi
+  801fa3:	41 ff d5             	call   *%r13
+  801fa6:	83 e0 04             	and    $0x4,%eax
+  801fa9:	74 17                	je     801fc2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801fab:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801fb2:	4c 39 f3             	cmp    %r14,%rbx
+  801fb5:	75 e6                	jne    801f9d <fd_alloc+0x29>
+  801fb7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801fbd:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801fc2:	4d 89 27             	mov    %r12,(%r15)
+}
+  801fc5:	48 83 c4 08          	add    $0x8,%rsp
+  801fc9:	5b                   	pop    %rbx
+  801fca:	41 5c                	pop    %r12
+  801fcc:	41 5d                	pop    %r13
+  801fce:	41 5e                	pop    %r14
+  801fd0:	41 5f                	pop    %r15
+  801fd2:	5d                   	pop    %rbp
+  801fd3:	c3                   	ret
+
+0000000000801fd4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801fd4:	83 ff 1f             	cmp    $0x1f,%edi
+  801fd7:	77 39                	ja     802012 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801fd9:	55                   	push   %rbp
+  801fda:	48 89 e5             	mov    %rsp,%rbp
+  801fdd:	41 54                	push   %r12
+  801fdf:	53                   	push   %rbx
+  801fe0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801fe3:	48 63 df             	movslq %edi,%rbx
+  801fe6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801fed:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ff1:	48 89 df             	mov    %rbx,%rdi
+  801ff4:	48 b8 f0 3f 80 00 00 	movabs $0x803ff0,%rax
+  801ffb:	00 00 00 
+  801ffe:	ff d0                	call   *%rax
+  802000:	a8 04                	test   $0x4,%al
+  802002:	74 14                	je     802018 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802004:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802008:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80200d:	5b                   	pop    %rbx
+  80200e:	41 5c                	pop    %r12
+  802010:	5d                   	pop    %rbp
+  802011:	c3                   	ret
+        return -E_INVAL;
+  802012:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802017:	c3                   	ret
+        return -E_INVAL;
+  802018:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80201d:	eb ee                	jmp    80200d <fd_lookup+0x39>
+
+000000000080201f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80201f:	55                   	push   %rbp
+  802020:	48 89 e5             	mov    %rsp,%rbp
+  802023:	41 54                	push   %r12
+  802025:	53                   	push   %rbx
+  802026:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802029:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  802030:	00 00 00 
+  802033:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80203a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80203d:	39 3b                	cmp    %edi,(%rbx)
+  80203f:	74 47                	je     802088 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802041:	48 83 c0 08          	add    $0x8,%rax
+  802045:	48 8b 18             	mov    (%rax),%rbx
+  802048:	48 85 db             	test   %rbx,%rbx
+  80204b:	75 f0                	jne    80203d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80204d:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  802054:	00 00 00 
+  802057:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80205d:	89 fa                	mov    %edi,%edx
+  80205f:	48 bf 48 56 80 00 00 	movabs $0x805648,%rdi
+  802066:	00 00 00 
+  802069:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206e:	48 b9 58 04 80 00 00 	movabs $0x800458,%rcx
+  802075:	00 00 00 
+  802078:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80207a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80207f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802083:	5b                   	pop    %rbx
+  802084:	41 5c                	pop    %r12
+  802086:	5d                   	pop    %rbp
+  802087:	c3                   	ret
+            return 0;
+  802088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208d:	eb f0                	jmp    80207f <dev_lookup+0x60>
+
+000000000080208f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80208f:	55                   	push   %rbp
+  802090:	48 89 e5             	mov    %rsp,%rbp
+  802093:	41 55                	push   %r13
+  802095:	41 54                	push   %r12
+  802097:	53                   	push   %rbx
+  802098:	48 83 ec 18          	sub    $0x18,%rsp
+  80209c:	48 89 fb             	mov    %rdi,%rbx
+  80209f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020a2:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8020a9:	ff ff ff 
+  8020ac:	48 01 df             	add    %rbx,%rdi
+  8020af:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8020b3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020b7:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8020be:	00 00 00 
+  8020c1:	ff d0                	call   *%rax
+  8020c3:	41 89 c5             	mov    %eax,%r13d
+  8020c6:	85 c0                	test   %eax,%eax
+  8020c8:	78 06                	js     8020d0 <fd_close+0x41>
+  8020ca:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8020ce:	74 1a                	je     8020ea <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8020d0:	45 84 e4             	test   %r12b,%r12b
+  8020d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8020dc:	44 89 e8             	mov    %r13d,%eax
+  8020df:	48 83 c4 18          	add    $0x18,%rsp
+  8020e3:	5b                   	pop    %rbx
+  8020e4:	41 5c                	pop    %r12
+  8020e6:	41 5d                	pop    %r13
+  8020e8:	5d                   	pop    %rbp
+  8020e9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8020ea:	8b 3b                	mov    (%rbx),%edi
+  8020ec:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020f0:	48 b8 1f 20 80 00 00 	movabs $0x80201f,%rax
+  8020f7:	00 00 00 
+  8020fa:	ff d0                	call   *%rax
+  8020fc:	41 89 c5             	mov    %eax,%r13d
+  8020ff:	85 c0                	test   %eax,%eax
+  802101:	78 1b                	js     80211e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802103:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802107:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80210b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802111:	48 85 c0             	test   %rax,%rax
+  802114:	74 08                	je     80211e <fd_close+0x8f>
+  802116:	48 89 df             	mov    %rbx,%rdi
+  802119:	ff d0                	call   *%rax
+  80211b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80211e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802123:	48 89 de             	mov    %rbx,%rsi
+  802126:	bf 00 00 00 00       	mov    $0x0,%edi
+  80212b:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  802132:	00 00 00 
+  802135:	ff d0                	call   *%rax
+    return res;
+  802137:	eb a3                	jmp    8020dc <fd_close+0x4d>
+
+0000000000802139 <close>:
+
+int
+close(int fdnum) {
+  802139:	55                   	push   %rbp
+  80213a:	48 89 e5             	mov    %rsp,%rbp
+  80213d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802141:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802145:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  80214c:	00 00 00 
+  80214f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802151:	85 c0                	test   %eax,%eax
+  802153:	78 15                	js     80216a <close+0x31>
+
+    return fd_close(fd, 1);
+  802155:	be 01 00 00 00       	mov    $0x1,%esi
+  80215a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80215e:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+}
+  80216a:	c9                   	leave
+  80216b:	c3                   	ret
+
+000000000080216c <close_all>:
+
+void
+close_all(void) {
+  80216c:	55                   	push   %rbp
+  80216d:	48 89 e5             	mov    %rsp,%rbp
+  802170:	41 54                	push   %r12
+  802172:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802173:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802178:	49 bc 39 21 80 00 00 	movabs $0x802139,%r12
+  80217f:	00 00 00 
+  802182:	89 df                	mov    %ebx,%edi
+  802184:	41 ff d4             	call   *%r12
+  802187:	83 c3 01             	add    $0x1,%ebx
+  80218a:	83 fb 20             	cmp    $0x20,%ebx
+  80218d:	75 f3                	jne    802182 <close_all+0x16>
+}
+  80218f:	5b                   	pop    %rbx
+  802190:	41 5c                	pop    %r12
+  802192:	5d                   	pop    %rbp
+  802193:	c3                   	ret
+
+0000000000802194 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802194:	55                   	push   %rbp
+  802195:	48 89 e5             	mov    %rsp,%rbp
+  802198:	41 57                	push   %r15
+  80219a:	41 56                	push   %r14
+  80219c:	41 55                	push   %r13
+  80219e:	41 54                	push   %r12
+  8021a0:	53                   	push   %rbx
+  8021a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a5:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8021a8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8021ac:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8021b3:	00 00 00 
+  8021b6:	ff d0                	call   *%rax
+  8021b8:	89 c3                	mov    %eax,%ebx
+  8021ba:	85 c0                	test   %eax,%eax
+  8021bc:	0f 88 b8 00 00 00    	js     80227a <dup+0xe6>
+    close(newfdnum);
+  8021c2:	44 89 e7             	mov    %r12d,%edi
+  8021c5:	48 b8 39 21 80 00 00 	movabs $0x802139,%rax
+  8021cc:	00 00 00 
+  8021cf:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8021d1:	4d 63 ec             	movslq %r12d,%r13
+  8021d4:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8021db:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8021df:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8021e3:	4c 89 ff             	mov    %r15,%rdi
+  8021e6:	49 be 58 1f 80 00 00 	movabs $0x801f58,%r14
+  8021ed:	00 00 00 
+  8021f0:	41 ff d6             	call   *%r14
+  8021f3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8021f6:	4c 89 ef             	mov    %r13,%rdi
+  8021f9:	41 ff d6             	call   *%r14
+  8021fc:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8021ff:	48 89 df             	mov    %rbx,%rdi
+  802202:	48 b8 f0 3f 80 00 00 	movabs $0x803ff0,%rax
+  802209:	00 00 00 
+  80220c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80220e:	a8 04                	test   $0x4,%al
+  802210:	74 2b                	je     80223d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802212:	41 89 c1             	mov    %eax,%r9d
+  802215:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80221b:	4c 89 f1             	mov    %r14,%rcx
+  80221e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802223:	48 89 de             	mov    %rbx,%rsi
+  802226:	bf 00 00 00 00       	mov    $0x0,%edi
+  80222b:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  802232:	00 00 00 
+  802235:	ff d0                	call   *%rax
+  802237:	89 c3                	mov    %eax,%ebx
+  802239:	85 c0                	test   %eax,%eax
+  80223b:	78 4e                	js     80228b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80223d:	4c 89 ff             	mov    %r15,%rdi
+  802240:	48 b8 f0 3f 80 00 00 	movabs $0x803ff0,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+  80224c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80224f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802255:	4c 89 e9             	mov    %r13,%rcx
+  802258:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225d:	4c 89 fe             	mov    %r15,%rsi
+  802260:	bf 00 00 00 00       	mov    $0x0,%edi
+  802265:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  80226c:	00 00 00 
+  80226f:	ff d0                	call   *%rax
+  802271:	89 c3                	mov    %eax,%ebx
+  802273:	85 c0                	test   %eax,%eax
+  802275:	78 14                	js     80228b <dup+0xf7>
+
+    return newfdnum;
+  802277:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80227a:	89 d8                	mov    %ebx,%eax
+  80227c:	48 83 c4 18          	add    $0x18,%rsp
+  802280:	5b                   	pop    %rbx
+  802281:	41 5c                	pop    %r12
+  802283:	41 5d                	pop    %r13
+  802285:	41 5e                	pop    %r14
+  802287:	41 5f                	pop    %r15
+  802289:	5d                   	pop    %rbp
+  80228a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80228b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802290:	4c 89 ee             	mov    %r13,%rsi
+  802293:	bf 00 00 00 00       	mov    $0x0,%edi
+  802298:	49 bc 0f 17 80 00 00 	movabs $0x80170f,%r12
+  80229f:	00 00 00 
+  8022a2:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8022a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022aa:	4c 89 f6             	mov    %r14,%rsi
+  8022ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b2:	41 ff d4             	call   *%r12
+    return res;
+  8022b5:	eb c3                	jmp    80227a <dup+0xe6>
+
+00000000008022b7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8022b7:	55                   	push   %rbp
+  8022b8:	48 89 e5             	mov    %rsp,%rbp
+  8022bb:	41 56                	push   %r14
+  8022bd:	41 55                	push   %r13
+  8022bf:	41 54                	push   %r12
+  8022c1:	53                   	push   %rbx
+  8022c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8022c6:	89 fb                	mov    %edi,%ebx
+  8022c8:	49 89 f4             	mov    %rsi,%r12
+  8022cb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022ce:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022d2:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8022d9:	00 00 00 
+  8022dc:	ff d0                	call   *%rax
+  8022de:	85 c0                	test   %eax,%eax
+  8022e0:	78 4c                	js     80232e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022e2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8022e6:	41 8b 3e             	mov    (%r14),%edi
+  8022e9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022ed:	48 b8 1f 20 80 00 00 	movabs $0x80201f,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+  8022f9:	85 c0                	test   %eax,%eax
+  8022fb:	78 35                	js     802332 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8022fd:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802301:	83 e0 03             	and    $0x3,%eax
+  802304:	83 f8 01             	cmp    $0x1,%eax
+  802307:	74 2d                	je     802336 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802309:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80230d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802311:	48 85 c0             	test   %rax,%rax
+  802314:	74 56                	je     80236c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802316:	4c 89 ea             	mov    %r13,%rdx
+  802319:	4c 89 e6             	mov    %r12,%rsi
+  80231c:	4c 89 f7             	mov    %r14,%rdi
+  80231f:	ff d0                	call   *%rax
+}
+  802321:	48 83 c4 10          	add    $0x10,%rsp
+  802325:	5b                   	pop    %rbx
+  802326:	41 5c                	pop    %r12
+  802328:	41 5d                	pop    %r13
+  80232a:	41 5e                	pop    %r14
+  80232c:	5d                   	pop    %rbp
+  80232d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80232e:	48 98                	cltq
+  802330:	eb ef                	jmp    802321 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802332:	48 98                	cltq
+  802334:	eb eb                	jmp    802321 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802336:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80233d:	00 00 00 
+  802340:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802346:	89 da                	mov    %ebx,%edx
+  802348:	48 bf 89 56 80 00 00 	movabs $0x805689,%rdi
+  80234f:	00 00 00 
+  802352:	b8 00 00 00 00       	mov    $0x0,%eax
+  802357:	48 b9 58 04 80 00 00 	movabs $0x800458,%rcx
+  80235e:	00 00 00 
+  802361:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802363:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80236a:	eb b5                	jmp    802321 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80236c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802373:	eb ac                	jmp    802321 <read+0x6a>
+
+0000000000802375 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802375:	55                   	push   %rbp
+  802376:	48 89 e5             	mov    %rsp,%rbp
+  802379:	41 57                	push   %r15
+  80237b:	41 56                	push   %r14
+  80237d:	41 55                	push   %r13
+  80237f:	41 54                	push   %r12
+  802381:	53                   	push   %rbx
+  802382:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802386:	48 85 d2             	test   %rdx,%rdx
+  802389:	74 54                	je     8023df <readn+0x6a>
+  80238b:	41 89 fd             	mov    %edi,%r13d
+  80238e:	49 89 f6             	mov    %rsi,%r14
+  802391:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802394:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802399:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80239e:	49 bf b7 22 80 00 00 	movabs $0x8022b7,%r15
+  8023a5:	00 00 00 
+  8023a8:	4c 89 e2             	mov    %r12,%rdx
+  8023ab:	48 29 f2             	sub    %rsi,%rdx
+  8023ae:	4c 01 f6             	add    %r14,%rsi
+  8023b1:	44 89 ef             	mov    %r13d,%edi
+  8023b4:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8023b7:	85 c0                	test   %eax,%eax
+  8023b9:	78 20                	js     8023db <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8023bb:	01 c3                	add    %eax,%ebx
+  8023bd:	85 c0                	test   %eax,%eax
+  8023bf:	74 08                	je     8023c9 <readn+0x54>
+  8023c1:	48 63 f3             	movslq %ebx,%rsi
+  8023c4:	4c 39 e6             	cmp    %r12,%rsi
+  8023c7:	72 df                	jb     8023a8 <readn+0x33>
+    }
+    return res;
+  8023c9:	48 63 c3             	movslq %ebx,%rax
+}
+  8023cc:	48 83 c4 08          	add    $0x8,%rsp
+  8023d0:	5b                   	pop    %rbx
+  8023d1:	41 5c                	pop    %r12
+  8023d3:	41 5d                	pop    %r13
+  8023d5:	41 5e                	pop    %r14
+  8023d7:	41 5f                	pop    %r15
+  8023d9:	5d                   	pop    %rbp
+  8023da:	c3                   	ret
+        if (inc < 0) return inc;
+  8023db:	48 98                	cltq
+  8023dd:	eb ed                	jmp    8023cc <readn+0x57>
+    int inc = 1, res = 0;
+  8023df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023e4:	eb e3                	jmp    8023c9 <readn+0x54>
+
+00000000008023e6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8023e6:	55                   	push   %rbp
+  8023e7:	48 89 e5             	mov    %rsp,%rbp
+  8023ea:	41 56                	push   %r14
+  8023ec:	41 55                	push   %r13
+  8023ee:	41 54                	push   %r12
+  8023f0:	53                   	push   %rbx
+  8023f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8023f5:	89 fb                	mov    %edi,%ebx
+  8023f7:	49 89 f4             	mov    %rsi,%r12
+  8023fa:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023fd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802401:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	78 47                	js     802458 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802411:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802415:	41 8b 3e             	mov    (%r14),%edi
+  802418:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80241c:	48 b8 1f 20 80 00 00 	movabs $0x80201f,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+  802428:	85 c0                	test   %eax,%eax
+  80242a:	78 30                	js     80245c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80242c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802431:	74 2d                	je     802460 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802433:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802437:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80243b:	48 85 c0             	test   %rax,%rax
+  80243e:	74 56                	je     802496 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802440:	4c 89 ea             	mov    %r13,%rdx
+  802443:	4c 89 e6             	mov    %r12,%rsi
+  802446:	4c 89 f7             	mov    %r14,%rdi
+  802449:	ff d0                	call   *%rax
+}
+  80244b:	48 83 c4 10          	add    $0x10,%rsp
+  80244f:	5b                   	pop    %rbx
+  802450:	41 5c                	pop    %r12
+  802452:	41 5d                	pop    %r13
+  802454:	41 5e                	pop    %r14
+  802456:	5d                   	pop    %rbp
+  802457:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802458:	48 98                	cltq
+  80245a:	eb ef                	jmp    80244b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80245c:	48 98                	cltq
+  80245e:	eb eb                	jmp    80244b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802460:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  802467:	00 00 00 
+  80246a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802470:	89 da                	mov    %ebx,%edx
+  802472:	48 bf a5 56 80 00 00 	movabs $0x8056a5,%rdi
+  802479:	00 00 00 
+  80247c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802481:	48 b9 58 04 80 00 00 	movabs $0x800458,%rcx
+  802488:	00 00 00 
+  80248b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80248d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802494:	eb b5                	jmp    80244b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802496:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80249d:	eb ac                	jmp    80244b <write+0x65>
+
+000000000080249f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80249f:	55                   	push   %rbp
+  8024a0:	48 89 e5             	mov    %rsp,%rbp
+  8024a3:	53                   	push   %rbx
+  8024a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8024a8:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024aa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024ae:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8024b5:	00 00 00 
+  8024b8:	ff d0                	call   *%rax
+  8024ba:	85 c0                	test   %eax,%eax
+  8024bc:	78 0c                	js     8024ca <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8024be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024c2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8024c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024ce:	c9                   	leave
+  8024cf:	c3                   	ret
+
+00000000008024d0 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8024d0:	55                   	push   %rbp
+  8024d1:	48 89 e5             	mov    %rsp,%rbp
+  8024d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8024d8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024dc:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8024e3:	00 00 00 
+  8024e6:	ff d0                	call   *%rax
+  8024e8:	85 c0                	test   %eax,%eax
+  8024ea:	78 07                	js     8024f3 <tell+0x23>
+    return fdes->fd_offset;
+  8024ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024f0:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8024f3:	c9                   	leave
+  8024f4:	c3                   	ret
+
+00000000008024f5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8024f5:	55                   	push   %rbp
+  8024f6:	48 89 e5             	mov    %rsp,%rbp
+  8024f9:	41 55                	push   %r13
+  8024fb:	41 54                	push   %r12
+  8024fd:	53                   	push   %rbx
+  8024fe:	48 83 ec 18          	sub    $0x18,%rsp
+  802502:	89 fb                	mov    %edi,%ebx
+  802504:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802507:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80250b:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  802512:	00 00 00 
+  802515:	ff d0                	call   *%rax
+  802517:	85 c0                	test   %eax,%eax
+  802519:	78 38                	js     802553 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80251b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80251f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802523:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802527:	48 b8 1f 20 80 00 00 	movabs $0x80201f,%rax
+  80252e:	00 00 00 
+  802531:	ff d0                	call   *%rax
+  802533:	85 c0                	test   %eax,%eax
+  802535:	78 1c                	js     802553 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802537:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80253c:	74 20                	je     80255e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80253e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802542:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802546:	48 85 c0             	test   %rax,%rax
+  802549:	74 47                	je     802592 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80254b:	44 89 e6             	mov    %r12d,%esi
+  80254e:	4c 89 ef             	mov    %r13,%rdi
+  802551:	ff d0                	call   *%rax
+}
+  802553:	48 83 c4 18          	add    $0x18,%rsp
+  802557:	5b                   	pop    %rbx
+  802558:	41 5c                	pop    %r12
+  80255a:	41 5d                	pop    %r13
+  80255c:	5d                   	pop    %rbp
+  80255d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80255e:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  802565:	00 00 00 
+  802568:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80256e:	89 da                	mov    %ebx,%edx
+  802570:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  802577:	00 00 00 
+  80257a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257f:	48 b9 58 04 80 00 00 	movabs $0x800458,%rcx
+  802586:	00 00 00 
+  802589:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80258b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802590:	eb c1                	jmp    802553 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802592:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802597:	eb ba                	jmp    802553 <ftruncate+0x5e>
+
+0000000000802599 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802599:	55                   	push   %rbp
+  80259a:	48 89 e5             	mov    %rsp,%rbp
+  80259d:	41 54                	push   %r12
+  80259f:	53                   	push   %rbx
+  8025a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8025a4:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025a7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025ab:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+  8025b7:	85 c0                	test   %eax,%eax
+  8025b9:	78 4e                	js     802609 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025bb:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8025bf:	41 8b 3c 24          	mov    (%r12),%edi
+  8025c3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8025c7:	48 b8 1f 20 80 00 00 	movabs $0x80201f,%rax
+  8025ce:	00 00 00 
+  8025d1:	ff d0                	call   *%rax
+  8025d3:	85 c0                	test   %eax,%eax
+  8025d5:	78 32                	js     802609 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8025d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8025db:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8025e0:	74 30                	je     802612 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8025e2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8025e5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8025ec:	00 00 00 
+    stat->st_isdir = 0;
+  8025ef:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8025f6:	00 00 00 
+    stat->st_dev = dev;
+  8025f9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802600:	48 89 de             	mov    %rbx,%rsi
+  802603:	4c 89 e7             	mov    %r12,%rdi
+  802606:	ff 50 28             	call   *0x28(%rax)
+}
+  802609:	48 83 c4 10          	add    $0x10,%rsp
+  80260d:	5b                   	pop    %rbx
+  80260e:	41 5c                	pop    %r12
+  802610:	5d                   	pop    %rbp
+  802611:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802612:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802617:	eb f0                	jmp    802609 <fstat+0x70>
+
+0000000000802619 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802619:	55                   	push   %rbp
+  80261a:	48 89 e5             	mov    %rsp,%rbp
+  80261d:	41 54                	push   %r12
+  80261f:	53                   	push   %rbx
+  802620:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802627:	41 89 fc             	mov    %edi,%r12d
+  80262a:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80262c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802630:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  802637:	00 00 00 
+  80263a:	ff d0                	call   *%rax
+  80263c:	85 c0                	test   %eax,%eax
+  80263e:	78 31                	js     802671 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802640:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802647:	44 89 e7             	mov    %r12d,%edi
+  80264a:	48 b8 99 25 80 00 00 	movabs $0x802599,%rax
+  802651:	00 00 00 
+  802654:	ff d0                	call   *%rax
+  802656:	85 c0                	test   %eax,%eax
+  802658:	78 17                	js     802671 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  80265a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80265e:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802661:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802664:	39 d3                	cmp    %edx,%ebx
+  802666:	0f 4f da             	cmovg  %edx,%ebx
+  802669:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80266c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802671:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802678:	5b                   	pop    %rbx
+  802679:	41 5c                	pop    %r12
+  80267b:	5d                   	pop    %rbp
+  80267c:	c3                   	ret
+
+000000000080267d <seektoend>:
+{
+  80267d:	55                   	push   %rbp
+  80267e:	48 89 e5             	mov    %rsp,%rbp
+  802681:	53                   	push   %rbx
+  802682:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802689:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80268b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80268f:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  802696:	00 00 00 
+  802699:	ff d0                	call   *%rax
+  80269b:	85 c0                	test   %eax,%eax
+  80269d:	78 28                	js     8026c7 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80269f:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8026a6:	89 df                	mov    %ebx,%edi
+  8026a8:	48 b8 99 25 80 00 00 	movabs $0x802599,%rax
+  8026af:	00 00 00 
+  8026b2:	ff d0                	call   *%rax
+  8026b4:	85 c0                	test   %eax,%eax
+  8026b6:	78 0f                	js     8026c7 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8026b8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8026bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026bf:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8026c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026cb:	c9                   	leave
+  8026cc:	c3                   	ret
+
+00000000008026cd <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8026cd:	55                   	push   %rbp
+  8026ce:	48 89 e5             	mov    %rsp,%rbp
+  8026d1:	41 54                	push   %r12
+  8026d3:	53                   	push   %rbx
+  8026d4:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8026d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026dc:	48 b8 c0 32 80 00 00 	movabs $0x8032c0,%rax
+  8026e3:	00 00 00 
+  8026e6:	ff d0                	call   *%rax
+  8026e8:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8026ea:	85 c0                	test   %eax,%eax
+  8026ec:	78 25                	js     802713 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8026ee:	4c 89 e6             	mov    %r12,%rsi
+  8026f1:	89 c7                	mov    %eax,%edi
+  8026f3:	48 b8 99 25 80 00 00 	movabs $0x802599,%rax
+  8026fa:	00 00 00 
+  8026fd:	ff d0                	call   *%rax
+  8026ff:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802702:	89 df                	mov    %ebx,%edi
+  802704:	48 b8 39 21 80 00 00 	movabs $0x802139,%rax
+  80270b:	00 00 00 
+  80270e:	ff d0                	call   *%rax
+
+    return res;
+  802710:	44 89 e3             	mov    %r12d,%ebx
+}
+  802713:	89 d8                	mov    %ebx,%eax
+  802715:	5b                   	pop    %rbx
+  802716:	41 5c                	pop    %r12
+  802718:	5d                   	pop    %rbp
+  802719:	c3                   	ret
+
+000000000080271a <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  80271a:	55                   	push   %rbp
+  80271b:	48 89 e5             	mov    %rsp,%rbp
+  80271e:	53                   	push   %rbx
+  80271f:	48 83 ec 08          	sub    $0x8,%rsp
+  802723:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802726:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  80272d:	00 00 00 
+  802730:	ff d0                	call   *%rax
+  802732:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802736:	0f 87 ea 00 00 00    	ja     802826 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  80273c:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802743:	00 00 00 
+  802746:	80 38 00             	cmpb   $0x0,(%rax)
+  802749:	75 35                	jne    802780 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  80274b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802750:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802755:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  80275a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80275f:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  802766:	00 00 00 
+  802769:	ff d0                	call   *%rax
+  80276b:	85 c0                	test   %eax,%eax
+  80276d:	0f 88 ba 00 00 00    	js     80282d <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802773:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80277a:	00 00 00 
+  80277d:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802780:	48 89 df             	mov    %rbx,%rdi
+  802783:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  80278a:	00 00 00 
+  80278d:	ff d0                	call   *%rax
+  80278f:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802793:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80279a:	00 00 00 
+  80279d:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8027a1:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8027a4:	39 39                	cmp    %edi,(%rcx)
+  8027a6:	74 46                	je     8027ee <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8027a8:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8027ac:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8027b3:	00 
+  8027b4:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8027bb:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8027c2:	00 
+  8027c3:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8027ca:	00 
+  8027cb:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8027d2:	00 
+  8027d3:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8027da:	00 
+  8027db:	89 39                	mov    %edi,(%rcx)
+  8027dd:	48 01 c6             	add    %rax,%rsi
+  8027e0:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8027e5:	48 89 c8             	mov    %rcx,%rax
+  8027e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027ec:	c9                   	leave
+  8027ed:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  8027ee:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8027f2:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  8027f9:	00 00 00 
+  8027fc:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8027ff:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802803:	74 e0                	je     8027e5 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802805:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80280c:	00 
+  80280d:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802811:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802818:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80281a:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80281d:	48 01 c2             	add    %rax,%rdx
+  802820:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802824:	eb bf                	jmp    8027e5 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802826:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80282b:	eb b8                	jmp    8027e5 <fbuf_get+0xcb>
+            return NULL;
+  80282d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802832:	eb b1                	jmp    8027e5 <fbuf_get+0xcb>
+
+0000000000802834 <fsipc_bulk>:
+fsipc_bulk(void) {
+  802834:	55                   	push   %rbp
+  802835:	48 89 e5             	mov    %rsp,%rbp
+  802838:	53                   	push   %rbx
+  802839:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  80283d:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802844:	00 00 00 
+  802847:	48 8b 18             	mov    (%rax),%rbx
+  80284a:	48 85 db             	test   %rbx,%rbx
+  80284d:	74 16                	je     802865 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  80284f:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802856:	00 00 00 
+  802859:	48 8b 18             	mov    (%rax),%rbx
+}
+  80285c:	48 89 d8             	mov    %rbx,%rax
+  80285f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802863:	c9                   	leave
+  802864:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802865:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80286a:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80286f:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802874:	bf 00 00 00 00       	mov    $0x0,%edi
+  802879:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  802880:	00 00 00 
+  802883:	ff d0                	call   *%rax
+  802885:	85 c0                	test   %eax,%eax
+  802887:	78 d3                	js     80285c <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802889:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  80288e:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802895:	00 00 00 
+  802898:	eb b5                	jmp    80284f <fsipc_bulk+0x1b>
+
+000000000080289a <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80289a:	55                   	push   %rbp
+  80289b:	48 89 e5             	mov    %rsp,%rbp
+  80289e:	41 57                	push   %r15
+  8028a0:	41 56                	push   %r14
+  8028a2:	41 55                	push   %r13
+  8028a4:	41 54                	push   %r12
+  8028a6:	53                   	push   %rbx
+  8028a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ab:	41 89 fd             	mov    %edi,%r13d
+  8028ae:	49 89 f6             	mov    %rsi,%r14
+  8028b1:	49 89 d7             	mov    %rdx,%r15
+  8028b4:	48 89 cb             	mov    %rcx,%rbx
+  8028b7:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028ba:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8028c1:	00 00 00 
+  8028c4:	83 38 00             	cmpl   $0x0,(%rax)
+  8028c7:	74 52                	je     80291b <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  8028c9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8028cf:	4c 89 f9             	mov    %r15,%rcx
+  8028d2:	4c 89 f2             	mov    %r14,%rdx
+  8028d5:	44 89 ee             	mov    %r13d,%esi
+  8028d8:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8028df:	00 00 00 
+  8028e2:	8b 38                	mov    (%rax),%edi
+  8028e4:	48 b8 47 45 80 00 00 	movabs $0x804547,%rax
+  8028eb:	00 00 00 
+  8028ee:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  8028f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028f5:	4c 89 e2             	mov    %r12,%rdx
+  8028f8:	48 89 de             	mov    %rbx,%rsi
+  8028fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802900:	48 b8 97 43 80 00 00 	movabs $0x804397,%rax
+  802907:	00 00 00 
+  80290a:	ff d0                	call   *%rax
+}
+  80290c:	48 83 c4 08          	add    $0x8,%rsp
+  802910:	5b                   	pop    %rbx
+  802911:	41 5c                	pop    %r12
+  802913:	41 5d                	pop    %r13
+  802915:	41 5e                	pop    %r14
+  802917:	41 5f                	pop    %r15
+  802919:	5d                   	pop    %rbp
+  80291a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80291b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802920:	48 b8 ea 45 80 00 00 	movabs $0x8045ea,%rax
+  802927:	00 00 00 
+  80292a:	ff d0                	call   *%rax
+  80292c:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802933:	00 00 
+  802935:	eb 92                	jmp    8028c9 <fsipc_region+0x2f>
+
+0000000000802937 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802937:	55                   	push   %rbp
+  802938:	48 89 e5             	mov    %rsp,%rbp
+  80293b:	41 57                	push   %r15
+  80293d:	41 56                	push   %r14
+  80293f:	41 55                	push   %r13
+  802941:	41 54                	push   %r12
+  802943:	53                   	push   %rbx
+  802944:	48 83 ec 28          	sub    $0x28,%rsp
+  802948:	49 89 ff             	mov    %rdi,%r15
+  80294b:	49 89 f6             	mov    %rsi,%r14
+  80294e:	48 89 d3             	mov    %rdx,%rbx
+  802951:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802955:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802958:	48 b8 34 28 80 00 00 	movabs $0x802834,%rax
+  80295f:	00 00 00 
+  802962:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802964:	48 85 c0             	test   %rax,%rax
+  802967:	0f 84 cc 00 00 00    	je     802a39 <devfile_write_direct+0x102>
+  80296d:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802970:	48 85 db             	test   %rbx,%rbx
+  802973:	0f 84 ba 00 00 00    	je     802a33 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802979:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80297f:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802986:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  80298a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80298e:	4c 29 e3             	sub    %r12,%rbx
+  802991:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802996:	48 39 c3             	cmp    %rax,%rbx
+  802999:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80299d:	48 89 da             	mov    %rbx,%rdx
+  8029a0:	4c 89 f6             	mov    %r14,%rsi
+  8029a3:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8029a7:	48 b8 c5 11 80 00 00 	movabs $0x8011c5,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8029b3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8029b7:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  8029bb:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8029be:	44 01 e0             	add    %r12d,%eax
+  8029c1:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  8029c5:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  8029c9:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  8029d0:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8029d7:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  8029de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029e9:	4c 89 ee             	mov    %r13,%rsi
+  8029ec:	bf 04 00 00 00       	mov    $0x4,%edi
+  8029f1:	48 b8 9a 28 80 00 00 	movabs $0x80289a,%rax
+  8029f8:	00 00 00 
+  8029fb:	ff d0                	call   *%rax
+        if (res < 0)
+  8029fd:	85 c0                	test   %eax,%eax
+  8029ff:	78 29                	js     802a2a <devfile_write_direct+0xf3>
+        if (res == 0)
+  802a01:	74 2b                	je     802a2e <devfile_write_direct+0xf7>
+        i += res;
+  802a03:	48 98                	cltq
+  802a05:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802a08:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802a0b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a0f:	49 39 c4             	cmp    %rax,%r12
+  802a12:	0f 82 72 ff ff ff    	jb     80298a <devfile_write_direct+0x53>
+    return i;
+  802a18:	4c 89 e0             	mov    %r12,%rax
+}
+  802a1b:	48 83 c4 28          	add    $0x28,%rsp
+  802a1f:	5b                   	pop    %rbx
+  802a20:	41 5c                	pop    %r12
+  802a22:	41 5d                	pop    %r13
+  802a24:	41 5e                	pop    %r14
+  802a26:	41 5f                	pop    %r15
+  802a28:	5d                   	pop    %rbp
+  802a29:	c3                   	ret
+            return res;
+  802a2a:	48 98                	cltq
+  802a2c:	eb ed                	jmp    802a1b <devfile_write_direct+0xe4>
+            return i;
+  802a2e:	4c 89 e0             	mov    %r12,%rax
+  802a31:	eb e8                	jmp    802a1b <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802a33:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802a37:	eb df                	jmp    802a18 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802a39:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802a40:	eb d9                	jmp    802a1b <devfile_write_direct+0xe4>
+
+0000000000802a42 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802a42:	55                   	push   %rbp
+  802a43:	48 89 e5             	mov    %rsp,%rbp
+  802a46:	41 56                	push   %r14
+  802a48:	41 55                	push   %r13
+  802a4a:	41 54                	push   %r12
+  802a4c:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802a4d:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802a51:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5a:	4d 39 ee             	cmp    %r13,%r14
+  802a5d:	0f 84 99 00 00 00    	je     802afc <fbuf_flush+0xba>
+  802a63:	49 89 fc             	mov    %rdi,%r12
+  802a66:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802a69:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802a6c:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802a70:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  802a77:	00 00 00 
+  802a7a:	ff d0                	call   *%rax
+  802a7c:	48 89 c2             	mov    %rax,%rdx
+  802a7f:	48 c1 e2 04          	shl    $0x4,%rdx
+  802a83:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802a87:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a8b:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802a90:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802a93:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802a97:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802a9e:	00 
+  802a9f:	44 89 f1             	mov    %r14d,%ecx
+  802aa2:	4c 89 ea             	mov    %r13,%rdx
+  802aa5:	4c 89 e7             	mov    %r12,%rdi
+  802aa8:	48 b8 37 29 80 00 00 	movabs $0x802937,%rax
+  802aaf:	00 00 00 
+  802ab2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ab4:	48 85 c0             	test   %rax,%rax
+  802ab7:	78 43                	js     802afc <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802ab9:	4c 39 e8             	cmp    %r13,%rax
+  802abc:	72 47                	jb     802b05 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802abe:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802ac3:	83 c0 01             	add    $0x1,%eax
+  802ac6:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802acb:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802ace:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802ad2:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802ad6:	72 0f                	jb     802ae7 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802ad8:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802adc:	48 39 c2             	cmp    %rax,%rdx
+  802adf:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802ae3:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802ae7:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802aee:	00 
+  802aef:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802af6:	00 
+    return 0;
+  802af7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802afc:	5b                   	pop    %rbx
+  802afd:	41 5c                	pop    %r12
+  802aff:	41 5d                	pop    %r13
+  802b01:	41 5e                	pop    %r14
+  802b03:	5d                   	pop    %rbp
+  802b04:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802b05:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802b0a:	eb f0                	jmp    802afc <fbuf_flush+0xba>
+
+0000000000802b0c <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802b0c:	55                   	push   %rbp
+  802b0d:	48 89 e5             	mov    %rsp,%rbp
+  802b10:	53                   	push   %rbx
+  802b11:	48 83 ec 08          	sub    $0x8,%rsp
+  802b15:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802b18:	48 b8 1a 27 80 00 00 	movabs $0x80271a,%rax
+  802b1f:	00 00 00 
+  802b22:	ff d0                	call   *%rax
+  802b24:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2c:	48 85 f6             	test   %rsi,%rsi
+  802b2f:	74 0f                	je     802b40 <devfile_sync+0x34>
+  802b31:	48 89 df             	mov    %rbx,%rdi
+  802b34:	48 b8 42 2a 80 00 00 	movabs $0x802a42,%rax
+  802b3b:	00 00 00 
+  802b3e:	ff d0                	call   *%rax
+}
+  802b40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b44:	c9                   	leave
+  802b45:	c3                   	ret
+
+0000000000802b46 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802b46:	55                   	push   %rbp
+  802b47:	48 89 e5             	mov    %rsp,%rbp
+  802b4a:	48 83 ec 10          	sub    $0x10,%rsp
+  802b4e:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802b51:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802b58:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802b59:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802b5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b62:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802b69:	00 00 00 
+  802b6c:	48 b8 9a 28 80 00 00 	movabs $0x80289a,%rax
+  802b73:	00 00 00 
+  802b76:	ff d0                	call   *%rax
+}
+  802b78:	c9                   	leave
+  802b79:	c3                   	ret
+
+0000000000802b7a <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802b7a:	55                   	push   %rbp
+  802b7b:	48 89 e5             	mov    %rsp,%rbp
+  802b7e:	41 54                	push   %r12
+  802b80:	53                   	push   %rbx
+  802b81:	48 89 fb             	mov    %rdi,%rbx
+  802b84:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802b87:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  802b8e:	00 00 00 
+  802b91:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b93:	85 c0                	test   %eax,%eax
+  802b95:	78 63                	js     802bfa <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802b97:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b9a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802ba1:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802ba3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba8:	bf 05 00 00 00       	mov    $0x5,%edi
+  802bad:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  802bb4:	00 00 00 
+  802bb7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bb9:	85 c0                	test   %eax,%eax
+  802bbb:	78 3d                	js     802bfa <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802bbd:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802bc4:	00 00 00 
+  802bc7:	48 89 de             	mov    %rbx,%rsi
+  802bca:	4c 89 e7             	mov    %r12,%rdi
+  802bcd:	48 b8 d0 0d 80 00 00 	movabs $0x800dd0,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802bd9:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802bdf:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802be6:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802be7:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802bed:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802bf4:	00 
+
+    return 0;
+  802bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bfa:	5b                   	pop    %rbx
+  802bfb:	41 5c                	pop    %r12
+  802bfd:	5d                   	pop    %rbp
+  802bfe:	c3                   	ret
+
+0000000000802bff <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802bff:	55                   	push   %rbp
+  802c00:	48 89 e5             	mov    %rsp,%rbp
+  802c03:	41 54                	push   %r12
+  802c05:	53                   	push   %rbx
+  802c06:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802c09:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  802c10:	00 00 00 
+  802c13:	ff d0                	call   *%rax
+  802c15:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802c18:	48 89 df             	mov    %rbx,%rdi
+  802c1b:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  802c22:	00 00 00 
+  802c25:	ff d0                	call   *%rax
+  802c27:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802c2b:	76 2e                	jbe    802c5b <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802c2d:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c30:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802c37:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802c39:	be 00 00 00 00       	mov    $0x0,%esi
+  802c3e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802c43:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  802c4a:	00 00 00 
+  802c4d:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802c4f:	45 85 e4             	test   %r12d,%r12d
+  802c52:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802c56:	5b                   	pop    %rbx
+  802c57:	41 5c                	pop    %r12
+  802c59:	5d                   	pop    %rbp
+  802c5a:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802c5b:	48 89 df             	mov    %rbx,%rdi
+  802c5e:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  802c65:	00 00 00 
+  802c68:	ff d0                	call   *%rax
+  802c6a:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802c6e:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802c75:	00 00 00 
+  802c78:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802c7f:	48 89 df             	mov    %rbx,%rdi
+  802c82:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  802c89:	00 00 00 
+  802c8c:	ff d0                	call   *%rax
+  802c8e:	48 89 c6             	mov    %rax,%rsi
+  802c91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c96:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9b:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  802ca2:	00 00 00 
+  802ca5:	ff d0                	call   *%rax
+  802ca7:	eb 84                	jmp    802c2d <devfile_flush+0x2e>
+
+0000000000802ca9 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802ca9:	55                   	push   %rbp
+  802caa:	48 89 e5             	mov    %rsp,%rbp
+  802cad:	41 55                	push   %r13
+  802caf:	41 54                	push   %r12
+  802cb1:	53                   	push   %rbx
+  802cb2:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb6:	48 89 fb             	mov    %rdi,%rbx
+  802cb9:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802cbc:	48 b8 1a 27 80 00 00 	movabs $0x80271a,%rax
+  802cc3:	00 00 00 
+  802cc6:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802cc8:	48 85 c0             	test   %rax,%rax
+  802ccb:	74 51                	je     802d1e <devfile_trunc+0x75>
+  802ccd:	49 89 c4             	mov    %rax,%r12
+  802cd0:	48 89 c6             	mov    %rax,%rsi
+  802cd3:	48 89 df             	mov    %rbx,%rdi
+  802cd6:	48 b8 42 2a 80 00 00 	movabs $0x802a42,%rax
+  802cdd:	00 00 00 
+  802ce0:	ff d0                	call   *%rax
+  802ce2:	85 c0                	test   %eax,%eax
+  802ce4:	78 2d                	js     802d13 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802ce6:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802ced:	00 00 00 
+  802cf0:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802cf3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802cf5:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802cf9:	be 00 00 00 00       	mov    $0x0,%esi
+  802cfe:	bf 02 00 00 00       	mov    $0x2,%edi
+  802d03:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  802d0a:	00 00 00 
+  802d0d:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802d0f:	85 c0                	test   %eax,%eax
+  802d11:	79 3e                	jns    802d51 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802d13:	48 83 c4 08          	add    $0x8,%rsp
+  802d17:	5b                   	pop    %rbx
+  802d18:	41 5c                	pop    %r12
+  802d1a:	41 5d                	pop    %r13
+  802d1c:	5d                   	pop    %rbp
+  802d1d:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802d1e:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802d25:	00 00 00 
+  802d28:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802d2b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802d2d:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802d31:	be 00 00 00 00       	mov    $0x0,%esi
+  802d36:	bf 02 00 00 00       	mov    $0x2,%edi
+  802d3b:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  802d42:	00 00 00 
+  802d45:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802d47:	85 c0                	test   %eax,%eax
+  802d49:	78 c8                	js     802d13 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802d4b:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d4f:	eb c2                	jmp    802d13 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802d51:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802d54:	8d 51 01             	lea    0x1(%rcx),%edx
+  802d57:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d5a:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802d5f:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802d66:	00 00 
+  802d68:	eb a9                	jmp    802d13 <devfile_trunc+0x6a>
+
+0000000000802d6a <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d6a:	55                   	push   %rbp
+  802d6b:	48 89 e5             	mov    %rsp,%rbp
+  802d6e:	41 57                	push   %r15
+  802d70:	41 56                	push   %r14
+  802d72:	41 55                	push   %r13
+  802d74:	41 54                	push   %r12
+  802d76:	53                   	push   %rbx
+  802d77:	48 83 ec 28          	sub    $0x28,%rsp
+  802d7b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802d7f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d83:	49 89 d7             	mov    %rdx,%r15
+  802d86:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802d8a:	48 b8 1a 27 80 00 00 	movabs $0x80271a,%rax
+  802d91:	00 00 00 
+  802d94:	ff d0                	call   *%rax
+  802d96:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802d99:	48 85 c0             	test   %rax,%rax
+  802d9c:	74 31                	je     802dcf <devfile_write+0x65>
+  802d9e:	4c 89 f8             	mov    %r15,%rax
+  802da1:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802da8:	77 25                	ja     802dcf <devfile_write+0x65>
+    size_t i = 0;
+  802daa:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802db0:	48 85 c0             	test   %rax,%rax
+  802db3:	0f 85 64 01 00 00    	jne    802f1d <devfile_write+0x1b3>
+    size_t i = 0;
+  802db9:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802dbd:	4c 89 f8             	mov    %r15,%rax
+}
+  802dc0:	48 83 c4 28          	add    $0x28,%rsp
+  802dc4:	5b                   	pop    %rbx
+  802dc5:	41 5c                	pop    %r12
+  802dc7:	41 5d                	pop    %r13
+  802dc9:	41 5e                	pop    %r14
+  802dcb:	41 5f                	pop    %r15
+  802dcd:	5d                   	pop    %rbp
+  802dce:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802dcf:	48 85 db             	test   %rbx,%rbx
+  802dd2:	74 5b                	je     802e2f <devfile_write+0xc5>
+  802dd4:	48 89 de             	mov    %rbx,%rsi
+  802dd7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802ddb:	48 b8 42 2a 80 00 00 	movabs $0x802a42,%rax
+  802de2:	00 00 00 
+  802de5:	ff d0                	call   *%rax
+  802de7:	85 c0                	test   %eax,%eax
+  802de9:	78 40                	js     802e2b <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802deb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802def:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802df2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802df6:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802dfa:	48 b8 37 29 80 00 00 	movabs $0x802937,%rax
+  802e01:	00 00 00 
+  802e04:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802e06:	48 85 c0             	test   %rax,%rax
+  802e09:	7e b5                	jle    802dc0 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802e0b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802e0f:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802e12:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802e15:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802e18:	8d 51 01             	lea    0x1(%rcx),%edx
+  802e1b:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e1e:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802e21:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802e28:	00 
+  802e29:	eb 95                	jmp    802dc0 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e2b:	48 98                	cltq
+  802e2d:	eb 91                	jmp    802dc0 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802e2f:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802e33:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802e36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e3a:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802e3e:	48 89 df             	mov    %rbx,%rdi
+  802e41:	48 b8 37 29 80 00 00 	movabs $0x802937,%rax
+  802e48:	00 00 00 
+  802e4b:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802e4d:	48 85 c0             	test   %rax,%rax
+  802e50:	0f 8e 6a ff ff ff    	jle    802dc0 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802e56:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802e59:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e5d:	e9 5e ff ff ff       	jmp    802dc0 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e62:	48 98                	cltq
+  802e64:	4d 85 ff             	test   %r15,%r15
+  802e67:	49 0f 45 c7          	cmovne %r15,%rax
+  802e6b:	e9 50 ff ff ff       	jmp    802dc0 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e70:	48 89 de             	mov    %rbx,%rsi
+  802e73:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e77:	48 b8 42 2a 80 00 00 	movabs $0x802a42,%rax
+  802e7e:	00 00 00 
+  802e81:	ff d0                	call   *%rax
+  802e83:	85 c0                	test   %eax,%eax
+  802e85:	0f 88 2b 01 00 00    	js     802fb6 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802e8b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e8f:	4c 01 f8             	add    %r15,%rax
+  802e92:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802e96:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e9a:	48 b9 46 1f 80 00 00 	movabs $0x801f46,%rcx
+  802ea1:	00 00 00 
+  802ea4:	ff d1                	call   *%rcx
+  802ea6:	48 89 c2             	mov    %rax,%rdx
+  802ea9:	48 c1 e2 04          	shl    $0x4,%rdx
+  802ead:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802eb1:	48 c1 e0 0c          	shl    $0xc,%rax
+  802eb5:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802eba:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802ebd:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802ec4:	00 
+  802ec5:	4c 89 ea             	mov    %r13,%rdx
+  802ec8:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802ecc:	48 b8 c5 11 80 00 00 	movabs $0x8011c5,%rax
+  802ed3:	00 00 00 
+  802ed6:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802ed8:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802edc:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802ee0:	48 39 c2             	cmp    %rax,%rdx
+  802ee3:	0f 84 db 00 00 00    	je     802fc4 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802ee9:	4c 39 e2             	cmp    %r12,%rdx
+  802eec:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802ef0:	4d 01 ec             	add    %r13,%r12
+  802ef3:	49 39 c4             	cmp    %rax,%r12
+  802ef6:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802efa:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802efe:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802f02:	45 01 ee             	add    %r13d,%r14d
+  802f05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f09:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802f0d:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802f10:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f14:	49 39 c7             	cmp    %rax,%r15
+  802f17:	0f 83 a0 fe ff ff    	jae    802dbd <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802f1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f21:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802f25:	8b 43 08             	mov    0x8(%rbx),%eax
+  802f28:	44 39 f0             	cmp    %r14d,%eax
+  802f2b:	7f 10                	jg     802f3d <devfile_write+0x1d3>
+  802f2d:	48 98                	cltq
+  802f2f:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802f35:	49 63 d6             	movslq %r14d,%rdx
+  802f38:	48 39 d0             	cmp    %rdx,%rax
+  802f3b:	7d 2d                	jge    802f6a <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f3d:	48 89 de             	mov    %rbx,%rsi
+  802f40:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f44:	48 b8 42 2a 80 00 00 	movabs $0x802a42,%rax
+  802f4b:	00 00 00 
+  802f4e:	ff d0                	call   *%rax
+  802f50:	85 c0                	test   %eax,%eax
+  802f52:	0f 88 0a ff ff ff    	js     802e62 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802f58:	44 89 f0             	mov    %r14d,%eax
+  802f5b:	66 b8 00 00          	mov    $0x0,%ax
+  802f5f:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802f62:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802f69:	00 
+        size_t off = pos - fb->fb_base;
+  802f6a:	45 89 f4             	mov    %r14d,%r12d
+  802f6d:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802f71:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802f74:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802f78:	4d 29 fd             	sub    %r15,%r13
+  802f7b:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802f80:	4c 29 e0             	sub    %r12,%rax
+  802f83:	49 39 c5             	cmp    %rax,%r13
+  802f86:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802f8a:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802f8e:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802f92:	48 39 c2             	cmp    %rax,%rdx
+  802f95:	0f 84 f0 fe ff ff    	je     802e8b <devfile_write+0x121>
+  802f9b:	4c 39 e0             	cmp    %r12,%rax
+  802f9e:	0f 82 cc fe ff ff    	jb     802e70 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802fa4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802fa8:	48 39 d0             	cmp    %rdx,%rax
+  802fab:	0f 83 da fe ff ff    	jae    802e8b <devfile_write+0x121>
+  802fb1:	e9 ba fe ff ff       	jmp    802e70 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802fb6:	48 98                	cltq
+  802fb8:	4d 85 ff             	test   %r15,%r15
+  802fbb:	49 0f 45 c7          	cmovne %r15,%rax
+  802fbf:	e9 fc fd ff ff       	jmp    802dc0 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802fc4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802fc8:	4c 89 e2             	mov    %r12,%rdx
+  802fcb:	e9 2a ff ff ff       	jmp    802efa <devfile_write+0x190>
+
+0000000000802fd0 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802fd0:	55                   	push   %rbp
+  802fd1:	48 89 e5             	mov    %rsp,%rbp
+  802fd4:	41 57                	push   %r15
+  802fd6:	41 56                	push   %r14
+  802fd8:	41 55                	push   %r13
+  802fda:	41 54                	push   %r12
+  802fdc:	53                   	push   %rbx
+  802fdd:	48 83 ec 28          	sub    $0x28,%rsp
+  802fe1:	49 89 ff             	mov    %rdi,%r15
+  802fe4:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802fe8:	48 89 d3             	mov    %rdx,%rbx
+  802feb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802fef:	48 b8 1a 27 80 00 00 	movabs $0x80271a,%rax
+  802ff6:	00 00 00 
+  802ff9:	ff d0                	call   *%rax
+  802ffb:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802ffe:	48 85 c0             	test   %rax,%rax
+  803001:	74 0d                	je     803010 <devfile_read+0x40>
+  803003:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  80300a:	0f 86 1a 01 00 00    	jbe    80312a <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803010:	4d 85 e4             	test   %r12,%r12
+  803013:	74 1a                	je     80302f <devfile_read+0x5f>
+  803015:	4c 89 e6             	mov    %r12,%rsi
+  803018:	4c 89 ff             	mov    %r15,%rdi
+  80301b:	48 b8 42 2a 80 00 00 	movabs $0x802a42,%rax
+  803022:	00 00 00 
+  803025:	ff d0                	call   *%rax
+  803027:	85 c0                	test   %eax,%eax
+  803029:	0f 88 e8 00 00 00    	js     803117 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  80302f:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  803033:	48 b8 34 28 80 00 00 	movabs $0x802834,%rax
+  80303a:	00 00 00 
+  80303d:	ff d0                	call   *%rax
+  80303f:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803042:	48 85 c0             	test   %rax,%rax
+  803045:	0f 84 69 02 00 00    	je     8032b4 <devfile_read+0x2e4>
+    while (i < n) {
+  80304b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803050:	0f 84 ce 00 00 00    	je     803124 <devfile_read+0x154>
+    size_t i = 0;
+  803056:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80305b:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803062:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803066:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80306a:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  80306e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803072:	48 29 da             	sub    %rbx,%rdx
+  803075:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80307a:	48 39 c2             	cmp    %rax,%rdx
+  80307d:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803081:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803085:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803089:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80308c:	01 d8                	add    %ebx,%eax
+  80308e:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803092:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803096:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  80309d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8030a4:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8030ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030b6:	4c 89 ee             	mov    %r13,%rsi
+  8030b9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8030be:	48 b8 9a 28 80 00 00 	movabs $0x80289a,%rax
+  8030c5:	00 00 00 
+  8030c8:	ff d0                	call   *%rax
+        if (res < 0)
+  8030ca:	85 c0                	test   %eax,%eax
+  8030cc:	78 4d                	js     80311b <devfile_read+0x14b>
+        if (res == 0)
+  8030ce:	74 4f                	je     80311f <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8030d0:	4c 63 e0             	movslq %eax,%r12
+  8030d3:	4c 89 e2             	mov    %r12,%rdx
+  8030d6:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8030da:	4c 89 f7             	mov    %r14,%rdi
+  8030dd:	48 b8 c5 11 80 00 00 	movabs $0x8011c5,%rax
+  8030e4:	00 00 00 
+  8030e7:	ff d0                	call   *%rax
+        i += res;
+  8030e9:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8030ec:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8030ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030f3:	48 39 c3             	cmp    %rax,%rbx
+  8030f6:	0f 82 72 ff ff ff    	jb     80306e <devfile_read+0x9e>
+    return i;
+  8030fc:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8030ff:	48 85 c0             	test   %rax,%rax
+  803102:	7e 04                	jle    803108 <devfile_read+0x138>
+  803104:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803108:	48 83 c4 28          	add    $0x28,%rsp
+  80310c:	5b                   	pop    %rbx
+  80310d:	41 5c                	pop    %r12
+  80310f:	41 5d                	pop    %r13
+  803111:	41 5e                	pop    %r14
+  803113:	41 5f                	pop    %r15
+  803115:	5d                   	pop    %rbp
+  803116:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803117:	48 98                	cltq
+  803119:	eb ed                	jmp    803108 <devfile_read+0x138>
+            return res;
+  80311b:	48 98                	cltq
+  80311d:	eb e9                	jmp    803108 <devfile_read+0x138>
+            return i;
+  80311f:	48 89 d8             	mov    %rbx,%rax
+  803122:	eb db                	jmp    8030ff <devfile_read+0x12f>
+    size_t i = 0;
+  803124:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803128:	eb d2                	jmp    8030fc <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80312a:	48 89 c6             	mov    %rax,%rsi
+  80312d:	4c 89 ff             	mov    %r15,%rdi
+  803130:	48 b8 42 2a 80 00 00 	movabs $0x802a42,%rax
+  803137:	00 00 00 
+  80313a:	ff d0                	call   *%rax
+  80313c:	85 c0                	test   %eax,%eax
+  80313e:	78 40                	js     803180 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803140:	4c 89 ff             	mov    %r15,%rdi
+  803143:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  80314a:	00 00 00 
+  80314d:	ff d0                	call   *%rax
+  80314f:	48 89 c2             	mov    %rax,%rdx
+  803152:	48 c1 e2 04          	shl    $0x4,%rdx
+  803156:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80315a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80315e:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803163:	48 01 d0             	add    %rdx,%rax
+  803166:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80316a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80316f:	0f 84 33 01 00 00    	je     8032a8 <devfile_read+0x2d8>
+    size_t i = 0;
+  803175:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80317b:	e9 f5 00 00 00       	jmp    803275 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803180:	48 98                	cltq
+  803182:	eb 84                	jmp    803108 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803184:	44 89 e8             	mov    %r13d,%eax
+  803187:	66 b8 00 00          	mov    $0x0,%ax
+  80318b:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803190:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803197:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803199:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80319d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8031a1:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8031a3:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8031a8:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8031ab:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8031b2:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8031b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031be:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8031c3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8031c8:	48 b8 9a 28 80 00 00 	movabs $0x80289a,%rax
+  8031cf:	00 00 00 
+  8031d2:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8031d4:	85 c0                	test   %eax,%eax
+  8031d6:	0f 88 be 00 00 00    	js     80329a <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8031dc:	48 63 d0             	movslq %eax,%rdx
+  8031df:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8031e4:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8031e9:	44 39 e8             	cmp    %r13d,%eax
+  8031ec:	0f 8e ba 00 00 00    	jle    8032ac <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8031f2:	49 63 c5             	movslq %r13d,%rax
+  8031f5:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8031fa:	48 29 c3             	sub    %rax,%rbx
+  8031fd:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803202:	48 01 c3             	add    %rax,%rbx
+  803205:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803209:	4c 29 f0             	sub    %r14,%rax
+  80320c:	48 39 c3             	cmp    %rax,%rbx
+  80320f:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803213:	4c 89 ff             	mov    %r15,%rdi
+  803216:	48 b9 46 1f 80 00 00 	movabs $0x801f46,%rcx
+  80321d:	00 00 00 
+  803220:	ff d1                	call   *%rcx
+  803222:	48 89 c2             	mov    %rax,%rdx
+  803225:	48 c1 e2 04          	shl    $0x4,%rdx
+  803229:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80322d:	48 c1 e0 0c          	shl    $0xc,%rax
+  803231:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803236:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803239:	44 89 ea             	mov    %r13d,%edx
+  80323c:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803241:	48 63 d2             	movslq %edx,%rdx
+  803244:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80324b:	00 
+  80324c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803250:	4c 01 f7             	add    %r14,%rdi
+  803253:	48 89 da             	mov    %rbx,%rdx
+  803256:	48 b9 c5 11 80 00 00 	movabs $0x8011c5,%rcx
+  80325d:	00 00 00 
+  803260:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803262:	41 01 dd             	add    %ebx,%r13d
+  803265:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803269:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80326c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803270:	49 39 c6             	cmp    %rax,%r14
+  803273:	73 37                	jae    8032ac <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803275:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803279:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80327e:	44 39 e8             	cmp    %r13d,%eax
+  803281:	0f 8f fd fe ff ff    	jg     803184 <devfile_read+0x1b4>
+  803287:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80328c:	44 39 e8             	cmp    %r13d,%eax
+  80328f:	0f 8f 5d ff ff ff    	jg     8031f2 <devfile_read+0x222>
+  803295:	e9 ea fe ff ff       	jmp    803184 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80329a:	48 98                	cltq
+  80329c:	4d 85 f6             	test   %r14,%r14
+  80329f:	49 0f 45 c6          	cmovne %r14,%rax
+  8032a3:	e9 60 fe ff ff       	jmp    803108 <devfile_read+0x138>
+    size_t i = 0;
+  8032a8:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8032ac:	4c 89 f0             	mov    %r14,%rax
+  8032af:	e9 54 fe ff ff       	jmp    803108 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8032b4:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8032bb:	e9 48 fe ff ff       	jmp    803108 <devfile_read+0x138>
+
+00000000008032c0 <open>:
+open(const char *path, int mode) {
+  8032c0:	55                   	push   %rbp
+  8032c1:	48 89 e5             	mov    %rsp,%rbp
+  8032c4:	41 55                	push   %r13
+  8032c6:	41 54                	push   %r12
+  8032c8:	53                   	push   %rbx
+  8032c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8032cd:	49 89 fc             	mov    %rdi,%r12
+  8032d0:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8032d3:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  8032da:	00 00 00 
+  8032dd:	ff d0                	call   *%rax
+  8032df:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8032e5:	0f 87 8a 00 00 00    	ja     803375 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8032eb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8032ef:	48 b8 74 1f 80 00 00 	movabs $0x801f74,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+  8032fb:	89 c3                	mov    %eax,%ebx
+  8032fd:	85 c0                	test   %eax,%eax
+  8032ff:	78 50                	js     803351 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803301:	4c 89 e6             	mov    %r12,%rsi
+  803304:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80330b:	00 00 00 
+  80330e:	48 89 df             	mov    %rbx,%rdi
+  803311:	48 b8 d0 0d 80 00 00 	movabs $0x800dd0,%rax
+  803318:	00 00 00 
+  80331b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80331d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803324:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803328:	bf 01 00 00 00       	mov    $0x1,%edi
+  80332d:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  803334:	00 00 00 
+  803337:	ff d0                	call   *%rax
+  803339:	89 c3                	mov    %eax,%ebx
+  80333b:	85 c0                	test   %eax,%eax
+  80333d:	78 1f                	js     80335e <open+0x9e>
+    return fd2num(fd);
+  80333f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803343:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  80334a:	00 00 00 
+  80334d:	ff d0                	call   *%rax
+  80334f:	89 c3                	mov    %eax,%ebx
+}
+  803351:	89 d8                	mov    %ebx,%eax
+  803353:	48 83 c4 18          	add    $0x18,%rsp
+  803357:	5b                   	pop    %rbx
+  803358:	41 5c                	pop    %r12
+  80335a:	41 5d                	pop    %r13
+  80335c:	5d                   	pop    %rbp
+  80335d:	c3                   	ret
+        fd_close(fd, 0);
+  80335e:	be 00 00 00 00       	mov    $0x0,%esi
+  803363:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803367:	48 b8 8f 20 80 00 00 	movabs $0x80208f,%rax
+  80336e:	00 00 00 
+  803371:	ff d0                	call   *%rax
+        return res;
+  803373:	eb dc                	jmp    803351 <open+0x91>
+        return -E_BAD_PATH;
+  803375:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80337a:	eb d5                	jmp    803351 <open+0x91>
+
+000000000080337c <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80337c:	55                   	push   %rbp
+  80337d:	48 89 e5             	mov    %rsp,%rbp
+  803380:	41 57                	push   %r15
+  803382:	41 56                	push   %r14
+  803384:	41 55                	push   %r13
+  803386:	41 54                	push   %r12
+  803388:	53                   	push   %rbx
+  803389:	48 83 ec 18          	sub    $0x18,%rsp
+  80338d:	41 89 f6             	mov    %esi,%r14d
+  803390:	49 89 d7             	mov    %rdx,%r15
+  803393:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803396:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80339a:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8033a1:	00 00 00 
+  8033a4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033a6:	85 c0                	test   %eax,%eax
+  8033a8:	0f 88 db 00 00 00    	js     803489 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8033ae:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033b2:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8033b9:	00 00 00 
+  8033bc:	8b 00                	mov    (%rax),%eax
+  8033be:	39 07                	cmp    %eax,(%rdi)
+  8033c0:	0f 85 db 00 00 00    	jne    8034a1 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8033c6:	45 85 f6             	test   %r14d,%r14d
+  8033c9:	0f 88 db 00 00 00    	js     8034aa <fmap+0x12e>
+  8033cf:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8033d6:	0f 85 d7 00 00 00    	jne    8034b3 <fmap+0x137>
+  8033dc:	4c 89 fb             	mov    %r15,%rbx
+  8033df:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8033e5:	0f 85 d1 00 00 00    	jne    8034bc <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8033eb:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  8033f2:	00 00 00 
+  8033f5:	ff d0                	call   *%rax
+  8033f7:	85 c0                	test   %eax,%eax
+  8033f9:	0f 88 8e 00 00 00    	js     80348d <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8033ff:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803406:	00 00 00 
+    while (i < n) {
+  803409:	4d 85 ed             	test   %r13,%r13
+  80340c:	0f 84 8a 00 00 00    	je     80349c <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803412:	4c 89 ea             	mov    %r13,%rdx
+  803415:	48 29 da             	sub    %rbx,%rdx
+  803418:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80341f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803425:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803429:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80342d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803430:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  803434:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803438:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  80343d:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803442:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803446:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80344a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80344f:	4c 89 e6             	mov    %r12,%rsi
+  803452:	bf 09 00 00 00       	mov    $0x9,%edi
+  803457:	48 b8 9a 28 80 00 00 	movabs $0x80289a,%rax
+  80345e:	00 00 00 
+  803461:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803463:	85 c0                	test   %eax,%eax
+  803465:	78 2a                	js     803491 <fmap+0x115>
+        i += res;
+  803467:	48 98                	cltq
+  803469:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80346c:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803470:	72 05                	jb     803477 <fmap+0xfb>
+    while (i < n) {
+  803472:	4c 39 eb             	cmp    %r13,%rbx
+  803475:	72 9b                	jb     803412 <fmap+0x96>
+    }
+    return i;
+  803477:	48 89 d8             	mov    %rbx,%rax
+}
+  80347a:	48 83 c4 18          	add    $0x18,%rsp
+  80347e:	5b                   	pop    %rbx
+  80347f:	41 5c                	pop    %r12
+  803481:	41 5d                	pop    %r13
+  803483:	41 5e                	pop    %r14
+  803485:	41 5f                	pop    %r15
+  803487:	5d                   	pop    %rbp
+  803488:	c3                   	ret
+    if (res < 0) return res;
+  803489:	48 98                	cltq
+  80348b:	eb ed                	jmp    80347a <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80348d:	48 98                	cltq
+  80348f:	eb e9                	jmp    80347a <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803491:	48 98                	cltq
+  803493:	48 85 db             	test   %rbx,%rbx
+  803496:	48 0f 45 c3          	cmovne %rbx,%rax
+  80349a:	eb de                	jmp    80347a <fmap+0xfe>
+    size_t i = 0;
+  80349c:	4c 89 eb             	mov    %r13,%rbx
+  80349f:	eb d6                	jmp    803477 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8034a1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8034a8:	eb d0                	jmp    80347a <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8034aa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034b1:	eb c7                	jmp    80347a <fmap+0xfe>
+  8034b3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034ba:	eb be                	jmp    80347a <fmap+0xfe>
+  8034bc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034c3:	eb b5                	jmp    80347a <fmap+0xfe>
+
+00000000008034c5 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8034c5:	55                   	push   %rbp
+  8034c6:	48 89 e5             	mov    %rsp,%rbp
+  8034c9:	41 56                	push   %r14
+  8034cb:	41 55                	push   %r13
+  8034cd:	41 54                	push   %r12
+  8034cf:	53                   	push   %rbx
+  8034d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8034d4:	89 fb                	mov    %edi,%ebx
+  8034d6:	41 89 f4             	mov    %esi,%r12d
+  8034d9:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034dc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034e0:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8034e7:	00 00 00 
+  8034ea:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034ec:	85 c0                	test   %eax,%eax
+  8034ee:	78 63                	js     803553 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8034f0:	45 85 e4             	test   %r12d,%r12d
+  8034f3:	0f 88 80 00 00 00    	js     803579 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8034f9:	45 89 e6             	mov    %r12d,%r14d
+  8034fc:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803503:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803507:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  80350e:	00 00 00 
+  803511:	ff d0                	call   *%rax
+  803513:	48 89 c2             	mov    %rax,%rdx
+  803516:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80351b:	44 89 f6             	mov    %r14d,%esi
+  80351e:	89 df                	mov    %ebx,%edi
+  803520:	48 b8 7c 33 80 00 00 	movabs $0x80337c,%rax
+  803527:	00 00 00 
+  80352a:	ff d0                	call   *%rax
+  80352c:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80352f:	45 29 f4             	sub    %r14d,%r12d
+  803532:	4d 63 f4             	movslq %r12d,%r14
+  803535:	49 39 c6             	cmp    %rax,%r14
+  803538:	7c 1d                	jl     803557 <read_map+0x92>
+  80353a:	48 85 c0             	test   %rax,%rax
+  80353d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803542:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803546:	48 83 c4 10          	add    $0x10,%rsp
+  80354a:	5b                   	pop    %rbx
+  80354b:	41 5c                	pop    %r12
+  80354d:	41 5d                	pop    %r13
+  80354f:	41 5e                	pop    %r14
+  803551:	5d                   	pop    %rbp
+  803552:	c3                   	ret
+    if (res < 0) return res;
+  803553:	48 98                	cltq
+  803555:	eb ef                	jmp    803546 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803557:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80355b:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  803562:	00 00 00 
+  803565:	ff d0                	call   *%rax
+  803567:	4d 63 e4             	movslq %r12d,%r12
+  80356a:	4c 01 e0             	add    %r12,%rax
+  80356d:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803571:	48 89 d8             	mov    %rbx,%rax
+  803574:	4c 29 f0             	sub    %r14,%rax
+  803577:	eb cd                	jmp    803546 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803579:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803580:	eb c4                	jmp    803546 <read_map+0x81>
+
+0000000000803582 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803582:	55                   	push   %rbp
+  803583:	48 89 e5             	mov    %rsp,%rbp
+  803586:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80358a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80358e:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  803595:	00 00 00 
+  803598:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80359a:	85 c0                	test   %eax,%eax
+  80359c:	78 4a                	js     8035e8 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80359e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035a2:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8035a9:	00 00 00 
+  8035ac:	8b 00                	mov    (%rax),%eax
+  8035ae:	39 07                	cmp    %eax,(%rdi)
+  8035b0:	75 38                	jne    8035ea <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8035b2:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  8035b9:	00 00 00 
+  8035bc:	ff d0                	call   *%rax
+  8035be:	85 c0                	test   %eax,%eax
+  8035c0:	78 26                	js     8035e8 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8035c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035c6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035c9:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8035d0:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8035d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8035d7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035dc:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  8035e3:	00 00 00 
+  8035e6:	ff d0                	call   *%rax
+}
+  8035e8:	c9                   	leave
+  8035e9:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8035ea:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8035ef:	eb f7                	jmp    8035e8 <fsync+0x66>
+
+00000000008035f1 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8035f1:	55                   	push   %rbp
+  8035f2:	48 89 e5             	mov    %rsp,%rbp
+  8035f5:	41 57                	push   %r15
+  8035f7:	41 56                	push   %r14
+  8035f9:	41 55                	push   %r13
+  8035fb:	41 54                	push   %r12
+  8035fd:	53                   	push   %rbx
+  8035fe:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803602:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803609:	00 00 00 
+  80360c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803611:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803617:	49 bd d4 1f 80 00 00 	movabs $0x801fd4,%r13
+  80361e:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803621:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803628:	00 00 00 
+  80362b:	eb 0c                	jmp    803639 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80362d:	83 c3 01             	add    $0x1,%ebx
+  803630:	49 83 c4 28          	add    $0x28,%r12
+  803634:	83 fb 20             	cmp    $0x20,%ebx
+  803637:	74 33                	je     80366c <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803639:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80363e:	74 ed                	je     80362d <flushall+0x3c>
+  803640:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803644:	89 df                	mov    %ebx,%edi
+  803646:	41 ff d5             	call   *%r13
+  803649:	85 c0                	test   %eax,%eax
+  80364b:	78 e0                	js     80362d <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80364d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803651:	41 8b 06             	mov    (%r14),%eax
+  803654:	39 07                	cmp    %eax,(%rdi)
+  803656:	75 d5                	jne    80362d <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803658:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  80365f:	00 00 00 
+  803662:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803664:	85 c0                	test   %eax,%eax
+  803666:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80366a:	eb c1                	jmp    80362d <flushall+0x3c>
+    }
+    return res;
+}
+  80366c:	44 89 f8             	mov    %r15d,%eax
+  80366f:	48 83 c4 18          	add    $0x18,%rsp
+  803673:	5b                   	pop    %rbx
+  803674:	41 5c                	pop    %r12
+  803676:	41 5d                	pop    %r13
+  803678:	41 5e                	pop    %r14
+  80367a:	41 5f                	pop    %r15
+  80367c:	5d                   	pop    %rbp
+  80367d:	c3                   	ret
+
+000000000080367e <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80367e:	55                   	push   %rbp
+  80367f:	48 89 e5             	mov    %rsp,%rbp
+  803682:	53                   	push   %rbx
+  803683:	48 83 ec 08          	sub    $0x8,%rsp
+  803687:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80368a:	40 0f b6 c6          	movzbl %sil,%eax
+  80368e:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803695:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803697:	be 00 00 00 00       	mov    $0x0,%esi
+  80369c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8036a1:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  8036a8:	00 00 00 
+  8036ab:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036ad:	85 c0                	test   %eax,%eax
+  8036af:	78 23                	js     8036d4 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8036b1:	ba 58 06 00 00       	mov    $0x658,%edx
+  8036b6:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8036bd:	00 00 00 
+  8036c0:	48 89 df             	mov    %rbx,%rdi
+  8036c3:	48 b8 c5 11 80 00 00 	movabs $0x8011c5,%rax
+  8036ca:	00 00 00 
+  8036cd:	ff d0                	call   *%rax
+    return 0;
+  8036cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036d8:	c9                   	leave
+  8036d9:	c3                   	ret
+
+00000000008036da <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8036da:	55                   	push   %rbp
+  8036db:	48 89 e5             	mov    %rsp,%rbp
+  8036de:	53                   	push   %rbx
+  8036df:	48 83 ec 08          	sub    $0x8,%rsp
+  8036e3:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8036e6:	48 b8 92 0d 80 00 00 	movabs $0x800d92,%rax
+  8036ed:	00 00 00 
+  8036f0:	ff d0                	call   *%rax
+  8036f2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8036f8:	77 35                	ja     80372f <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8036fa:	48 89 de             	mov    %rbx,%rsi
+  8036fd:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803704:	00 00 00 
+  803707:	48 b8 d0 0d 80 00 00 	movabs $0x800dd0,%rax
+  80370e:	00 00 00 
+  803711:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803713:	be 00 00 00 00       	mov    $0x0,%esi
+  803718:	bf 07 00 00 00       	mov    $0x7,%edi
+  80371d:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  803724:	00 00 00 
+  803727:	ff d0                	call   *%rax
+}
+  803729:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80372d:	c9                   	leave
+  80372e:	c3                   	ret
+        return -E_BAD_PATH;
+  80372f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803734:	eb f3                	jmp    803729 <remove+0x4f>
+
+0000000000803736 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803736:	55                   	push   %rbp
+  803737:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  80373a:	48 b8 f1 35 80 00 00 	movabs $0x8035f1,%rax
+  803741:	00 00 00 
+  803744:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803746:	be 00 00 00 00       	mov    $0x0,%esi
+  80374b:	bf 08 00 00 00       	mov    $0x8,%edi
+  803750:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  803757:	00 00 00 
+  80375a:	ff d0                	call   *%rax
+}
+  80375c:	5d                   	pop    %rbp
+  80375d:	c3                   	ret
+
+000000000080375e <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  80375e:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803762:	7f 01                	jg     803765 <writebuf+0x7>
+  803764:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803765:	55                   	push   %rbp
+  803766:	48 89 e5             	mov    %rsp,%rbp
+  803769:	53                   	push   %rbx
+  80376a:	48 83 ec 08          	sub    $0x8,%rsp
+  80376e:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803771:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803775:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803779:	8b 3f                	mov    (%rdi),%edi
+  80377b:	48 b8 e6 23 80 00 00 	movabs $0x8023e6,%rax
+  803782:	00 00 00 
+  803785:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803787:	48 85 c0             	test   %rax,%rax
+  80378a:	7e 04                	jle    803790 <writebuf+0x32>
+  80378c:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803790:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803794:	48 39 c2             	cmp    %rax,%rdx
+  803797:	74 0f                	je     8037a8 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803799:	48 85 c0             	test   %rax,%rax
+  80379c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037a1:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8037a5:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8037a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037ac:	c9                   	leave
+  8037ad:	c3                   	ret
+
+00000000008037ae <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8037ae:	8b 46 04             	mov    0x4(%rsi),%eax
+  8037b1:	8d 50 01             	lea    0x1(%rax),%edx
+  8037b4:	89 56 04             	mov    %edx,0x4(%rsi)
+  8037b7:	48 98                	cltq
+  8037b9:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8037be:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8037c4:	74 01                	je     8037c7 <putch+0x19>
+  8037c6:	c3                   	ret
+putch(int ch, void *arg) {
+  8037c7:	55                   	push   %rbp
+  8037c8:	48 89 e5             	mov    %rsp,%rbp
+  8037cb:	53                   	push   %rbx
+  8037cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8037d0:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8037d3:	48 89 f7             	mov    %rsi,%rdi
+  8037d6:	48 b8 5e 37 80 00 00 	movabs $0x80375e,%rax
+  8037dd:	00 00 00 
+  8037e0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8037e2:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8037e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037ed:	c9                   	leave
+  8037ee:	c3                   	ret
+
+00000000008037ef <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8037ef:	55                   	push   %rbp
+  8037f0:	48 89 e5             	mov    %rsp,%rbp
+  8037f3:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8037fa:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8037fd:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803803:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80380a:	00 00 00 
+    state.result = 0;
+  80380d:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803814:	00 00 00 00 
+    state.error = 1;
+  803818:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  80381f:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803822:	48 89 f2             	mov    %rsi,%rdx
+  803825:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80382c:	48 bf ae 37 80 00 00 	movabs $0x8037ae,%rdi
+  803833:	00 00 00 
+  803836:	48 b8 a8 05 80 00 00 	movabs $0x8005a8,%rax
+  80383d:	00 00 00 
+  803840:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803842:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803849:	7f 14                	jg     80385f <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  80384b:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803852:	48 85 c0             	test   %rax,%rax
+  803855:	75 06                	jne    80385d <vfprintf+0x6e>
+  803857:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  80385d:	c9                   	leave
+  80385e:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  80385f:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803866:	48 b8 5e 37 80 00 00 	movabs $0x80375e,%rax
+  80386d:	00 00 00 
+  803870:	ff d0                	call   *%rax
+  803872:	eb d7                	jmp    80384b <vfprintf+0x5c>
+
+0000000000803874 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803874:	55                   	push   %rbp
+  803875:	48 89 e5             	mov    %rsp,%rbp
+  803878:	48 83 ec 50          	sub    $0x50,%rsp
+  80387c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803880:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803884:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803888:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80388c:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803893:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803897:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80389b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80389f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8038a3:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8038a7:	48 b8 ef 37 80 00 00 	movabs $0x8037ef,%rax
+  8038ae:	00 00 00 
+  8038b1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8038b3:	c9                   	leave
+  8038b4:	c3                   	ret
+
+00000000008038b5 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8038b5:	55                   	push   %rbp
+  8038b6:	48 89 e5             	mov    %rsp,%rbp
+  8038b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8038bd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8038c1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8038c5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8038c9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8038cd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8038d1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8038d8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8038dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038e0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8038e4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8038e8:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8038ec:	48 89 fe             	mov    %rdi,%rsi
+  8038ef:	bf 01 00 00 00       	mov    $0x1,%edi
+  8038f4:	48 b8 ef 37 80 00 00 	movabs $0x8037ef,%rax
+  8038fb:	00 00 00 
+  8038fe:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803900:	c9                   	leave
+  803901:	c3                   	ret
+
+0000000000803902 <puts>:
+
+int
+puts(const char *str) {
+  803902:	55                   	push   %rbp
+  803903:	48 89 e5             	mov    %rsp,%rbp
+  803906:	48 89 fe             	mov    %rdi,%rsi
+    return printf("%s\n", str);
+  803909:	48 bf 00 57 80 00 00 	movabs $0x805700,%rdi
+  803910:	00 00 00 
+  803913:	b8 00 00 00 00       	mov    $0x0,%eax
+  803918:	48 ba b5 38 80 00 00 	movabs $0x8038b5,%rdx
+  80391f:	00 00 00 
+  803922:	ff d2                	call   *%rdx
+}
+  803924:	5d                   	pop    %rbp
+  803925:	c3                   	ret
+
+0000000000803926 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803926:	55                   	push   %rbp
+  803927:	48 89 e5             	mov    %rsp,%rbp
+  80392a:	41 54                	push   %r12
+  80392c:	53                   	push   %rbx
+  80392d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803930:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  803937:	00 00 00 
+  80393a:	ff d0                	call   *%rax
+  80393c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80393f:	48 be 04 57 80 00 00 	movabs $0x805704,%rsi
+  803946:	00 00 00 
+  803949:	48 89 df             	mov    %rbx,%rdi
+  80394c:	48 b8 d0 0d 80 00 00 	movabs $0x800dd0,%rax
+  803953:	00 00 00 
+  803956:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803958:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80395d:	41 2b 04 24          	sub    (%r12),%eax
+  803961:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803967:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80396e:	00 00 00 
+    stat->st_dev = &devpipe;
+  803971:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803978:	00 00 00 
+  80397b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803982:	b8 00 00 00 00       	mov    $0x0,%eax
+  803987:	5b                   	pop    %rbx
+  803988:	41 5c                	pop    %r12
+  80398a:	5d                   	pop    %rbp
+  80398b:	c3                   	ret
+
+000000000080398c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80398c:	55                   	push   %rbp
+  80398d:	48 89 e5             	mov    %rsp,%rbp
+  803990:	41 54                	push   %r12
+  803992:	53                   	push   %rbx
+  803993:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803996:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80399b:	48 89 fe             	mov    %rdi,%rsi
+  80399e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039a3:	49 bc 0f 17 80 00 00 	movabs $0x80170f,%r12
+  8039aa:	00 00 00 
+  8039ad:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8039b0:	48 89 df             	mov    %rbx,%rdi
+  8039b3:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  8039ba:	00 00 00 
+  8039bd:	ff d0                	call   *%rax
+  8039bf:	48 89 c6             	mov    %rax,%rsi
+  8039c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039cc:	41 ff d4             	call   *%r12
+}
+  8039cf:	5b                   	pop    %rbx
+  8039d0:	41 5c                	pop    %r12
+  8039d2:	5d                   	pop    %rbp
+  8039d3:	c3                   	ret
+
+00000000008039d4 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039d4:	55                   	push   %rbp
+  8039d5:	48 89 e5             	mov    %rsp,%rbp
+  8039d8:	41 57                	push   %r15
+  8039da:	41 56                	push   %r14
+  8039dc:	41 55                	push   %r13
+  8039de:	41 54                	push   %r12
+  8039e0:	53                   	push   %rbx
+  8039e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8039e5:	49 89 fc             	mov    %rdi,%r12
+  8039e8:	49 89 f5             	mov    %rsi,%r13
+  8039eb:	49 89 d7             	mov    %rdx,%r15
+  8039ee:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039f2:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  8039f9:	00 00 00 
+  8039fc:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8039fe:	4d 85 ff             	test   %r15,%r15
+  803a01:	0f 84 af 00 00 00    	je     803ab6 <devpipe_write+0xe2>
+  803a07:	48 89 c3             	mov    %rax,%rbx
+  803a0a:	4c 89 f8             	mov    %r15,%rax
+  803a0d:	4d 89 ef             	mov    %r13,%r15
+  803a10:	4c 01 e8             	add    %r13,%rax
+  803a13:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a17:	49 bd 04 15 80 00 00 	movabs $0x801504,%r13
+  803a1e:	00 00 00 
+            sys_yield();
+  803a21:	49 be a1 14 80 00 00 	movabs $0x8014a1,%r14
+  803a28:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a2b:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a2e:	48 63 ce             	movslq %esi,%rcx
+  803a31:	48 63 03             	movslq (%rbx),%rax
+  803a34:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a3a:	48 39 c1             	cmp    %rax,%rcx
+  803a3d:	72 2e                	jb     803a6d <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a3f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a44:	48 89 da             	mov    %rbx,%rdx
+  803a47:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a4c:	4c 89 e7             	mov    %r12,%rdi
+  803a4f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803a52:	85 c0                	test   %eax,%eax
+  803a54:	74 66                	je     803abc <devpipe_write+0xe8>
+            sys_yield();
+  803a56:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a59:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a5c:	48 63 ce             	movslq %esi,%rcx
+  803a5f:	48 63 03             	movslq (%rbx),%rax
+  803a62:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a68:	48 39 c1             	cmp    %rax,%rcx
+  803a6b:	73 d2                	jae    803a3f <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a6d:	41 0f b6 3f          	movzbl (%r15),%edi
+  803a71:	48 89 ca             	mov    %rcx,%rdx
+  803a74:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a78:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803a7f:	08 10 20 
+  803a82:	48 f7 e2             	mul    %rdx
+  803a85:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a89:	48 89 d0             	mov    %rdx,%rax
+  803a8c:	48 c1 e0 09          	shl    $0x9,%rax
+  803a90:	48 29 d0             	sub    %rdx,%rax
+  803a93:	48 c1 e0 03          	shl    $0x3,%rax
+  803a97:	48 29 c1             	sub    %rax,%rcx
+  803a9a:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803a9f:	83 c6 01             	add    $0x1,%esi
+  803aa2:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803aa5:	49 83 c7 01          	add    $0x1,%r15
+  803aa9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803aad:	49 39 c7             	cmp    %rax,%r15
+  803ab0:	0f 85 75 ff ff ff    	jne    803a2b <devpipe_write+0x57>
+    return n;
+  803ab6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803aba:	eb 05                	jmp    803ac1 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803abc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ac1:	48 83 c4 18          	add    $0x18,%rsp
+  803ac5:	5b                   	pop    %rbx
+  803ac6:	41 5c                	pop    %r12
+  803ac8:	41 5d                	pop    %r13
+  803aca:	41 5e                	pop    %r14
+  803acc:	41 5f                	pop    %r15
+  803ace:	5d                   	pop    %rbp
+  803acf:	c3                   	ret
+
+0000000000803ad0 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ad0:	55                   	push   %rbp
+  803ad1:	48 89 e5             	mov    %rsp,%rbp
+  803ad4:	41 57                	push   %r15
+  803ad6:	41 56                	push   %r14
+  803ad8:	41 55                	push   %r13
+  803ada:	41 54                	push   %r12
+  803adc:	53                   	push   %rbx
+  803add:	48 83 ec 18          	sub    $0x18,%rsp
+  803ae1:	49 89 fc             	mov    %rdi,%r12
+  803ae4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ae8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803aec:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  803af3:	00 00 00 
+  803af6:	ff d0                	call   *%rax
+  803af8:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803afb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b01:	49 bd 04 15 80 00 00 	movabs $0x801504,%r13
+  803b08:	00 00 00 
+            sys_yield();
+  803b0b:	49 be a1 14 80 00 00 	movabs $0x8014a1,%r14
+  803b12:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b15:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b1a:	74 7d                	je     803b99 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b1c:	8b 03                	mov    (%rbx),%eax
+  803b1e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b21:	75 26                	jne    803b49 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803b23:	4d 85 ff             	test   %r15,%r15
+  803b26:	75 77                	jne    803b9f <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b28:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b2d:	48 89 da             	mov    %rbx,%rdx
+  803b30:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b35:	4c 89 e7             	mov    %r12,%rdi
+  803b38:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b3b:	85 c0                	test   %eax,%eax
+  803b3d:	74 72                	je     803bb1 <devpipe_read+0xe1>
+            sys_yield();
+  803b3f:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b42:	8b 03                	mov    (%rbx),%eax
+  803b44:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b47:	74 df                	je     803b28 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b49:	48 63 c8             	movslq %eax,%rcx
+  803b4c:	48 89 ca             	mov    %rcx,%rdx
+  803b4f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b53:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803b5a:	08 10 20 
+  803b5d:	48 89 d0             	mov    %rdx,%rax
+  803b60:	48 f7 e6             	mul    %rsi
+  803b63:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b67:	48 89 d0             	mov    %rdx,%rax
+  803b6a:	48 c1 e0 09          	shl    $0x9,%rax
+  803b6e:	48 29 d0             	sub    %rdx,%rax
+  803b71:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803b78:	00 
+  803b79:	48 89 c8             	mov    %rcx,%rax
+  803b7c:	48 29 d0             	sub    %rdx,%rax
+  803b7f:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803b84:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b88:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803b8c:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b8f:	49 83 c7 01          	add    $0x1,%r15
+  803b93:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803b97:	75 83                	jne    803b1c <devpipe_read+0x4c>
+    return n;
+  803b99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b9d:	eb 03                	jmp    803ba2 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803b9f:	4c 89 f8             	mov    %r15,%rax
+}
+  803ba2:	48 83 c4 18          	add    $0x18,%rsp
+  803ba6:	5b                   	pop    %rbx
+  803ba7:	41 5c                	pop    %r12
+  803ba9:	41 5d                	pop    %r13
+  803bab:	41 5e                	pop    %r14
+  803bad:	41 5f                	pop    %r15
+  803baf:	5d                   	pop    %rbp
+  803bb0:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb6:	eb ea                	jmp    803ba2 <devpipe_read+0xd2>
+
+0000000000803bb8 <pipe>:
+pipe(int pfd[2]) {
+  803bb8:	55                   	push   %rbp
+  803bb9:	48 89 e5             	mov    %rsp,%rbp
+  803bbc:	41 55                	push   %r13
+  803bbe:	41 54                	push   %r12
+  803bc0:	53                   	push   %rbx
+  803bc1:	48 83 ec 18          	sub    $0x18,%rsp
+  803bc5:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bc8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bcc:	48 b8 74 1f 80 00 00 	movabs $0x801f74,%rax
+  803bd3:	00 00 00 
+  803bd6:	ff d0                	call   *%rax
+  803bd8:	89 c3                	mov    %eax,%ebx
+  803bda:	85 c0                	test   %eax,%eax
+  803bdc:	0f 88 a0 01 00 00    	js     803d82 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803be2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803be7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bec:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803bf0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bf5:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  803bfc:	00 00 00 
+  803bff:	ff d0                	call   *%rax
+  803c01:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c03:	85 c0                	test   %eax,%eax
+  803c05:	0f 88 77 01 00 00    	js     803d82 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c0b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c0f:	48 b8 74 1f 80 00 00 	movabs $0x801f74,%rax
+  803c16:	00 00 00 
+  803c19:	ff d0                	call   *%rax
+  803c1b:	89 c3                	mov    %eax,%ebx
+  803c1d:	85 c0                	test   %eax,%eax
+  803c1f:	0f 88 43 01 00 00    	js     803d68 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c25:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c2a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c2f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c33:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c38:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  803c3f:	00 00 00 
+  803c42:	ff d0                	call   *%rax
+  803c44:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c46:	85 c0                	test   %eax,%eax
+  803c48:	0f 88 1a 01 00 00    	js     803d68 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803c4e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c52:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  803c59:	00 00 00 
+  803c5c:	ff d0                	call   *%rax
+  803c5e:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c61:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c66:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c6b:	48 89 c6             	mov    %rax,%rsi
+  803c6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c73:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  803c7a:	00 00 00 
+  803c7d:	ff d0                	call   *%rax
+  803c7f:	89 c3                	mov    %eax,%ebx
+  803c81:	85 c0                	test   %eax,%eax
+  803c83:	0f 88 c5 00 00 00    	js     803d4e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c89:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c8d:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  803c94:	00 00 00 
+  803c97:	ff d0                	call   *%rax
+  803c99:	48 89 c1             	mov    %rax,%rcx
+  803c9c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803ca2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803ca8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cad:	4c 89 ee             	mov    %r13,%rsi
+  803cb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb5:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  803cbc:	00 00 00 
+  803cbf:	ff d0                	call   *%rax
+  803cc1:	89 c3                	mov    %eax,%ebx
+  803cc3:	85 c0                	test   %eax,%eax
+  803cc5:	78 6e                	js     803d35 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803cc7:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ccc:	4c 89 ef             	mov    %r13,%rdi
+  803ccf:	48 b8 d2 14 80 00 00 	movabs $0x8014d2,%rax
+  803cd6:	00 00 00 
+  803cd9:	ff d0                	call   *%rax
+  803cdb:	83 f8 02             	cmp    $0x2,%eax
+  803cde:	0f 85 ab 00 00 00    	jne    803d8f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803ce4:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803ceb:	00 00 
+  803ced:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cf1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803cf3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cf7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803cfe:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d02:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d08:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d0f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d13:	48 bb 46 1f 80 00 00 	movabs $0x801f46,%rbx
+  803d1a:	00 00 00 
+  803d1d:	ff d3                	call   *%rbx
+  803d1f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d23:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d27:	ff d3                	call   *%rbx
+  803d29:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d33:	eb 4d                	jmp    803d82 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d35:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d3a:	4c 89 ee             	mov    %r13,%rsi
+  803d3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d42:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  803d49:	00 00 00 
+  803d4c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d53:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d57:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d5c:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  803d63:	00 00 00 
+  803d66:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d68:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d6d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d71:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d76:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  803d7d:	00 00 00 
+  803d80:	ff d0                	call   *%rax
+}
+  803d82:	89 d8                	mov    %ebx,%eax
+  803d84:	48 83 c4 18          	add    $0x18,%rsp
+  803d88:	5b                   	pop    %rbx
+  803d89:	41 5c                	pop    %r12
+  803d8b:	41 5d                	pop    %r13
+  803d8d:	5d                   	pop    %rbp
+  803d8e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d8f:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  803d96:	00 00 00 
+  803d99:	48 ba 0b 57 80 00 00 	movabs $0x80570b,%rdx
+  803da0:	00 00 00 
+  803da3:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803da8:	48 bf 20 57 80 00 00 	movabs $0x805720,%rdi
+  803daf:	00 00 00 
+  803db2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803db7:	49 b8 08 03 80 00 00 	movabs $0x800308,%r8
+  803dbe:	00 00 00 
+  803dc1:	41 ff d0             	call   *%r8
+
+0000000000803dc4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803dc4:	55                   	push   %rbp
+  803dc5:	48 89 e5             	mov    %rsp,%rbp
+  803dc8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803dcc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803dd0:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  803dd7:	00 00 00 
+  803dda:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ddc:	85 c0                	test   %eax,%eax
+  803dde:	78 35                	js     803e15 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803de0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803de4:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  803deb:	00 00 00 
+  803dee:	ff d0                	call   *%rax
+  803df0:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803df3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803df8:	be 00 10 00 00       	mov    $0x1000,%esi
+  803dfd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e01:	48 b8 04 15 80 00 00 	movabs $0x801504,%rax
+  803e08:	00 00 00 
+  803e0b:	ff d0                	call   *%rax
+  803e0d:	85 c0                	test   %eax,%eax
+  803e0f:	0f 94 c0             	sete   %al
+  803e12:	0f b6 c0             	movzbl %al,%eax
+}
+  803e15:	c9                   	leave
+  803e16:	c3                   	ret
+
+0000000000803e17 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e17:	48 89 f8             	mov    %rdi,%rax
+  803e1a:	48 c1 e8 27          	shr    $0x27,%rax
+  803e1e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e25:	7f 00 00 
+  803e28:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e2c:	f6 c2 01             	test   $0x1,%dl
+  803e2f:	74 6d                	je     803e9e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e31:	48 89 f8             	mov    %rdi,%rax
+  803e34:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e38:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e3f:	7f 00 00 
+  803e42:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e46:	f6 c2 01             	test   $0x1,%dl
+  803e49:	74 62                	je     803ead <get_uvpt_entry+0x96>
+  803e4b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e52:	7f 00 00 
+  803e55:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e59:	f6 c2 80             	test   $0x80,%dl
+  803e5c:	75 4f                	jne    803ead <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e5e:	48 89 f8             	mov    %rdi,%rax
+  803e61:	48 c1 e8 15          	shr    $0x15,%rax
+  803e65:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e6c:	7f 00 00 
+  803e6f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e73:	f6 c2 01             	test   $0x1,%dl
+  803e76:	74 44                	je     803ebc <get_uvpt_entry+0xa5>
+  803e78:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e7f:	7f 00 00 
+  803e82:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e86:	f6 c2 80             	test   $0x80,%dl
+  803e89:	75 31                	jne    803ebc <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e8b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e8f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803e96:	7f 00 00 
+  803e99:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e9d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e9e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803ea5:	7f 00 00 
+  803ea8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803eac:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ead:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803eb4:	7f 00 00 
+  803eb7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ebb:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ebc:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ec3:	7f 00 00 
+  803ec6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803eca:	c3                   	ret
+
+0000000000803ecb <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803ecb:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ece:	48 89 f9             	mov    %rdi,%rcx
+  803ed1:	48 c1 e9 27          	shr    $0x27,%rcx
+  803ed5:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803edc:	7f 00 00 
+  803edf:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803ee3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803eea:	f6 c1 01             	test   $0x1,%cl
+  803eed:	0f 84 b2 00 00 00    	je     803fa5 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ef3:	48 89 f9             	mov    %rdi,%rcx
+  803ef6:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803efa:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f01:	7f 00 00 
+  803f04:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f08:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f0f:	40 f6 c6 01          	test   $0x1,%sil
+  803f13:	0f 84 8c 00 00 00    	je     803fa5 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803f19:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f20:	7f 00 00 
+  803f23:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f27:	a8 80                	test   $0x80,%al
+  803f29:	75 7b                	jne    803fa6 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f2b:	48 89 f9             	mov    %rdi,%rcx
+  803f2e:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f32:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f39:	7f 00 00 
+  803f3c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f40:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f47:	40 f6 c6 01          	test   $0x1,%sil
+  803f4b:	74 58                	je     803fa5 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803f4d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f54:	7f 00 00 
+  803f57:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f5b:	a8 80                	test   $0x80,%al
+  803f5d:	75 6c                	jne    803fcb <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f5f:	48 89 f9             	mov    %rdi,%rcx
+  803f62:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803f66:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f6d:	7f 00 00 
+  803f70:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f74:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f7b:	40 f6 c6 01          	test   $0x1,%sil
+  803f7f:	74 24                	je     803fa5 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803f81:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f88:	7f 00 00 
+  803f8b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f8f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803f96:	ff ff 7f 
+  803f99:	48 21 c8             	and    %rcx,%rax
+  803f9c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803fa2:	48 09 d0             	or     %rdx,%rax
+}
+  803fa5:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803fa6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fad:	7f 00 00 
+  803fb0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fb4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fbb:	ff ff 7f 
+  803fbe:	48 21 c8             	and    %rcx,%rax
+  803fc1:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803fc7:	48 01 d0             	add    %rdx,%rax
+  803fca:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803fcb:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fd2:	7f 00 00 
+  803fd5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fd9:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fe0:	ff ff 7f 
+  803fe3:	48 21 c8             	and    %rcx,%rax
+  803fe6:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803fec:	48 01 d0             	add    %rdx,%rax
+  803fef:	c3                   	ret
+
+0000000000803ff0 <get_prot>:
+
+int
+get_prot(void *va) {
+  803ff0:	55                   	push   %rbp
+  803ff1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ff4:	48 b8 17 3e 80 00 00 	movabs $0x803e17,%rax
+  803ffb:	00 00 00 
+  803ffe:	ff d0                	call   *%rax
+  804000:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804003:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804008:	89 c1                	mov    %eax,%ecx
+  80400a:	83 c9 04             	or     $0x4,%ecx
+  80400d:	f6 c2 01             	test   $0x1,%dl
+  804010:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804013:	89 c1                	mov    %eax,%ecx
+  804015:	83 c9 02             	or     $0x2,%ecx
+  804018:	f6 c2 02             	test   $0x2,%dl
+  80401b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80401e:	89 c1                	mov    %eax,%ecx
+  804020:	83 c9 01             	or     $0x1,%ecx
+  804023:	48 85 d2             	test   %rdx,%rdx
+  804026:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804029:	89 c1                	mov    %eax,%ecx
+  80402b:	83 c9 40             	or     $0x40,%ecx
+  80402e:	f6 c6 04             	test   $0x4,%dh
+  804031:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804034:	5d                   	pop    %rbp
+  804035:	c3                   	ret
+
+0000000000804036 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804036:	55                   	push   %rbp
+  804037:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80403a:	48 b8 17 3e 80 00 00 	movabs $0x803e17,%rax
+  804041:	00 00 00 
+  804044:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804046:	48 c1 e8 06          	shr    $0x6,%rax
+  80404a:	83 e0 01             	and    $0x1,%eax
+}
+  80404d:	5d                   	pop    %rbp
+  80404e:	c3                   	ret
+
+000000000080404f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80404f:	55                   	push   %rbp
+  804050:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804053:	48 b8 17 3e 80 00 00 	movabs $0x803e17,%rax
+  80405a:	00 00 00 
+  80405d:	ff d0                	call   *%rax
+  80405f:	83 e0 01             	and    $0x1,%eax
+}
+  804062:	5d                   	pop    %rbp
+  804063:	c3                   	ret
+
+0000000000804064 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804064:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80406b:	7f 00 00 
+  80406e:	a8 01                	test   $0x1,%al
+  804070:	75 06                	jne    804078 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804072:	b8 00 00 00 00       	mov    $0x0,%eax
+  804077:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804078:	55                   	push   %rbp
+  804079:	48 89 e5             	mov    %rsp,%rbp
+  80407c:	41 57                	push   %r15
+  80407e:	41 56                	push   %r14
+  804080:	41 55                	push   %r13
+  804082:	41 54                	push   %r12
+  804084:	53                   	push   %rbx
+  804085:	48 83 ec 18          	sub    $0x18,%rsp
+  804089:	49 89 fe             	mov    %rdi,%r14
+  80408c:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80408f:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804096:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804097:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  80409e:	7f 00 00 
+  8040a1:	e9 81 00 00 00       	jmp    804127 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  8040a6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040ad:	49 39 dd             	cmp    %rbx,%r13
+  8040b0:	74 2b                	je     8040dd <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8040b2:	48 89 d8             	mov    %rbx,%rax
+  8040b5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040b9:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  8040bd:	f6 c2 01             	test   $0x1,%dl
+  8040c0:	74 e4                	je     8040a6 <foreach_shared_region+0x42>
+  8040c2:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  8040c6:	f6 c4 04             	test   $0x4,%ah
+  8040c9:	74 db                	je     8040a6 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  8040cb:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040d2:	4c 89 fa             	mov    %r15,%rdx
+  8040d5:	48 89 df             	mov    %rbx,%rdi
+  8040d8:	41 ff d6             	call   *%r14
+  8040db:	eb c9                	jmp    8040a6 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8040dd:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  8040e4:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  8040e8:	74 22                	je     80410c <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  8040ea:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  8040f1:	48 89 d8             	mov    %rbx,%rax
+  8040f4:	48 c1 e8 15          	shr    $0x15,%rax
+  8040f8:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  8040ff:	7f 00 00 
+  804102:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804106:	a8 01                	test   $0x1,%al
+  804108:	74 d3                	je     8040dd <foreach_shared_region+0x79>
+  80410a:	eb a6                	jmp    8040b2 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80410c:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804113:	40 
+  804114:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804118:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80411f:	00 00 00 
+  804122:	48 39 c1             	cmp    %rax,%rcx
+  804125:	74 31                	je     804158 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804127:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80412b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80412f:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804136:	7f 00 00 
+  804139:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80413d:	a8 01                	test   $0x1,%al
+  80413f:	74 cb                	je     80410c <foreach_shared_region+0xa8>
+  804141:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804145:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80414c:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804152:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804156:	eb 92                	jmp    8040ea <foreach_shared_region+0x86>
+}
+  804158:	b8 00 00 00 00       	mov    $0x0,%eax
+  80415d:	48 83 c4 18          	add    $0x18,%rsp
+  804161:	5b                   	pop    %rbx
+  804162:	41 5c                	pop    %r12
+  804164:	41 5d                	pop    %r13
+  804166:	41 5e                	pop    %r14
+  804168:	41 5f                	pop    %r15
+  80416a:	5d                   	pop    %rbp
+  80416b:	c3                   	ret
+
+000000000080416c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80416c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804171:	c3                   	ret
+
+0000000000804172 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804172:	55                   	push   %rbp
+  804173:	48 89 e5             	mov    %rsp,%rbp
+  804176:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804179:	48 be 54 57 80 00 00 	movabs $0x805754,%rsi
+  804180:	00 00 00 
+  804183:	48 b8 d0 0d 80 00 00 	movabs $0x800dd0,%rax
+  80418a:	00 00 00 
+  80418d:	ff d0                	call   *%rax
+    return 0;
+}
+  80418f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804194:	5d                   	pop    %rbp
+  804195:	c3                   	ret
+
+0000000000804196 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804196:	55                   	push   %rbp
+  804197:	48 89 e5             	mov    %rsp,%rbp
+  80419a:	41 57                	push   %r15
+  80419c:	41 56                	push   %r14
+  80419e:	41 55                	push   %r13
+  8041a0:	41 54                	push   %r12
+  8041a2:	53                   	push   %rbx
+  8041a3:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8041aa:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8041b1:	48 85 d2             	test   %rdx,%rdx
+  8041b4:	74 7a                	je     804230 <devcons_write+0x9a>
+  8041b6:	49 89 d6             	mov    %rdx,%r14
+  8041b9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041bf:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8041c4:	49 bf 5e 11 80 00 00 	movabs $0x80115e,%r15
+  8041cb:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8041ce:	4c 89 f3             	mov    %r14,%rbx
+  8041d1:	48 29 f3             	sub    %rsi,%rbx
+  8041d4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8041d9:	48 39 c3             	cmp    %rax,%rbx
+  8041dc:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8041e0:	4c 63 eb             	movslq %ebx,%r13
+  8041e3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8041ea:	48 01 c6             	add    %rax,%rsi
+  8041ed:	4c 89 ea             	mov    %r13,%rdx
+  8041f0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041f7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8041fa:	4c 89 ee             	mov    %r13,%rsi
+  8041fd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804204:	48 b8 a7 13 80 00 00 	movabs $0x8013a7,%rax
+  80420b:	00 00 00 
+  80420e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804210:	41 01 dc             	add    %ebx,%r12d
+  804213:	49 63 f4             	movslq %r12d,%rsi
+  804216:	4c 39 f6             	cmp    %r14,%rsi
+  804219:	72 b3                	jb     8041ce <devcons_write+0x38>
+    return res;
+  80421b:	49 63 c4             	movslq %r12d,%rax
+}
+  80421e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804225:	5b                   	pop    %rbx
+  804226:	41 5c                	pop    %r12
+  804228:	41 5d                	pop    %r13
+  80422a:	41 5e                	pop    %r14
+  80422c:	41 5f                	pop    %r15
+  80422e:	5d                   	pop    %rbp
+  80422f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804230:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804236:	eb e3                	jmp    80421b <devcons_write+0x85>
+
+0000000000804238 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804238:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80423b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804240:	48 85 c0             	test   %rax,%rax
+  804243:	74 55                	je     80429a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804245:	55                   	push   %rbp
+  804246:	48 89 e5             	mov    %rsp,%rbp
+  804249:	41 55                	push   %r13
+  80424b:	41 54                	push   %r12
+  80424d:	53                   	push   %rbx
+  80424e:	48 83 ec 08          	sub    $0x8,%rsp
+  804252:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804255:	48 bb d4 13 80 00 00 	movabs $0x8013d4,%rbx
+  80425c:	00 00 00 
+  80425f:	49 bc a1 14 80 00 00 	movabs $0x8014a1,%r12
+  804266:	00 00 00 
+  804269:	eb 03                	jmp    80426e <devcons_read+0x36>
+  80426b:	41 ff d4             	call   *%r12
+  80426e:	ff d3                	call   *%rbx
+  804270:	85 c0                	test   %eax,%eax
+  804272:	74 f7                	je     80426b <devcons_read+0x33>
+    if (c < 0) return c;
+  804274:	48 63 d0             	movslq %eax,%rdx
+  804277:	78 13                	js     80428c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804279:	ba 00 00 00 00       	mov    $0x0,%edx
+  80427e:	83 f8 04             	cmp    $0x4,%eax
+  804281:	74 09                	je     80428c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804283:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804287:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80428c:	48 89 d0             	mov    %rdx,%rax
+  80428f:	48 83 c4 08          	add    $0x8,%rsp
+  804293:	5b                   	pop    %rbx
+  804294:	41 5c                	pop    %r12
+  804296:	41 5d                	pop    %r13
+  804298:	5d                   	pop    %rbp
+  804299:	c3                   	ret
+  80429a:	48 89 d0             	mov    %rdx,%rax
+  80429d:	c3                   	ret
+
+000000000080429e <cputchar>:
+cputchar(int ch) {
+  80429e:	55                   	push   %rbp
+  80429f:	48 89 e5             	mov    %rsp,%rbp
+  8042a2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8042a6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8042aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8042af:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8042b3:	48 b8 a7 13 80 00 00 	movabs $0x8013a7,%rax
+  8042ba:	00 00 00 
+  8042bd:	ff d0                	call   *%rax
+}
+  8042bf:	c9                   	leave
+  8042c0:	c3                   	ret
+
+00000000008042c1 <getchar>:
+getchar(void) {
+  8042c1:	55                   	push   %rbp
+  8042c2:	48 89 e5             	mov    %rsp,%rbp
+  8042c5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8042c9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042ce:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8042d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042d7:	48 b8 b7 22 80 00 00 	movabs $0x8022b7,%rax
+  8042de:	00 00 00 
+  8042e1:	ff d0                	call   *%rax
+  8042e3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8042e5:	85 c0                	test   %eax,%eax
+  8042e7:	78 06                	js     8042ef <getchar+0x2e>
+  8042e9:	74 08                	je     8042f3 <getchar+0x32>
+  8042eb:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8042ef:	89 d0                	mov    %edx,%eax
+  8042f1:	c9                   	leave
+  8042f2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8042f3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8042f8:	eb f5                	jmp    8042ef <getchar+0x2e>
+
+00000000008042fa <iscons>:
+iscons(int fdnum) {
+  8042fa:	55                   	push   %rbp
+  8042fb:	48 89 e5             	mov    %rsp,%rbp
+  8042fe:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804302:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804306:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  80430d:	00 00 00 
+  804310:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804312:	85 c0                	test   %eax,%eax
+  804314:	78 18                	js     80432e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804316:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80431a:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804321:	00 00 00 
+  804324:	8b 00                	mov    (%rax),%eax
+  804326:	39 02                	cmp    %eax,(%rdx)
+  804328:	0f 94 c0             	sete   %al
+  80432b:	0f b6 c0             	movzbl %al,%eax
+}
+  80432e:	c9                   	leave
+  80432f:	c3                   	ret
+
+0000000000804330 <opencons>:
+opencons(void) {
+  804330:	55                   	push   %rbp
+  804331:	48 89 e5             	mov    %rsp,%rbp
+  804334:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804338:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80433c:	48 b8 74 1f 80 00 00 	movabs $0x801f74,%rax
+  804343:	00 00 00 
+  804346:	ff d0                	call   *%rax
+  804348:	85 c0                	test   %eax,%eax
+  80434a:	78 49                	js     804395 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80434c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804351:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804356:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80435a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80435f:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  804366:	00 00 00 
+  804369:	ff d0                	call   *%rax
+  80436b:	85 c0                	test   %eax,%eax
+  80436d:	78 26                	js     804395 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80436f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804373:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80437a:	00 00 
+  80437c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80437e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804382:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804389:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  804390:	00 00 00 
+  804393:	ff d0                	call   *%rax
+}
+  804395:	c9                   	leave
+  804396:	c3                   	ret
+
+0000000000804397 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804397:	55                   	push   %rbp
+  804398:	48 89 e5             	mov    %rsp,%rbp
+  80439b:	41 55                	push   %r13
+  80439d:	41 54                	push   %r12
+  80439f:	53                   	push   %rbx
+  8043a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8043a4:	49 89 fc             	mov    %rdi,%r12
+  8043a7:	48 89 f7             	mov    %rsi,%rdi
+  8043aa:	48 89 d3             	mov    %rdx,%rbx
+  8043ad:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8043b0:	48 85 f6             	test   %rsi,%rsi
+  8043b3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8043ba:	00 00 00 
+  8043bd:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8043c1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043c6:	48 85 d2             	test   %rdx,%rdx
+  8043c9:	74 03                	je     8043ce <ipc_recv+0x37>
+  8043cb:	48 8b 32             	mov    (%rdx),%rsi
+  8043ce:	48 b8 dd 18 80 00 00 	movabs $0x8018dd,%rax
+  8043d5:	00 00 00 
+  8043d8:	ff d0                	call   *%rax
+    if (errno) {
+  8043da:	85 c0                	test   %eax,%eax
+  8043dc:	74 1c                	je     8043fa <ipc_recv+0x63>
+        if (from_env_store)
+  8043de:	4d 85 e4             	test   %r12,%r12
+  8043e1:	74 08                	je     8043eb <ipc_recv+0x54>
+            *from_env_store = 0;
+  8043e3:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8043ea:	00 
+
+        if (perm_store)
+  8043eb:	4d 85 ed             	test   %r13,%r13
+  8043ee:	74 74                	je     804464 <ipc_recv+0xcd>
+            *perm_store = 0;
+  8043f0:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8043f7:	00 
+  8043f8:	eb 6a                	jmp    804464 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8043fa:	4d 85 e4             	test   %r12,%r12
+  8043fd:	74 14                	je     804413 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8043ff:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804406:	00 00 00 
+  804409:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80440f:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804413:	48 85 db             	test   %rbx,%rbx
+  804416:	74 23                	je     80443b <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804418:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80441f:	00 00 00 
+  804422:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804428:	ba 00 00 00 00       	mov    $0x0,%edx
+  80442d:	85 c9                	test   %ecx,%ecx
+  80442f:	74 07                	je     804438 <ipc_recv+0xa1>
+  804431:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804438:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80443b:	4d 85 ed             	test   %r13,%r13
+  80443e:	74 14                	je     804454 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804440:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804447:	00 00 00 
+  80444a:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804450:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804454:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80445b:	00 00 00 
+  80445e:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804464:	48 83 c4 08          	add    $0x8,%rsp
+  804468:	5b                   	pop    %rbx
+  804469:	41 5c                	pop    %r12
+  80446b:	41 5d                	pop    %r13
+  80446d:	5d                   	pop    %rbp
+  80446e:	c3                   	ret
+
+000000000080446f <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80446f:	55                   	push   %rbp
+  804470:	48 89 e5             	mov    %rsp,%rbp
+  804473:	41 55                	push   %r13
+  804475:	41 54                	push   %r12
+  804477:	53                   	push   %rbx
+  804478:	48 83 ec 08          	sub    $0x8,%rsp
+  80447c:	49 89 fc             	mov    %rdi,%r12
+  80447f:	48 89 f7             	mov    %rsi,%rdi
+  804482:	48 89 d3             	mov    %rdx,%rbx
+  804485:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804488:	48 85 f6             	test   %rsi,%rsi
+  80448b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804492:	00 00 00 
+  804495:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804499:	be 00 10 00 00       	mov    $0x1000,%esi
+  80449e:	48 85 d2             	test   %rdx,%rdx
+  8044a1:	74 03                	je     8044a6 <ipc_try_recv+0x37>
+  8044a3:	48 8b 32             	mov    (%rdx),%rsi
+  8044a6:	48 b8 46 19 80 00 00 	movabs $0x801946,%rax
+  8044ad:	00 00 00 
+  8044b0:	ff d0                	call   *%rax
+    if (errno) {
+  8044b2:	85 c0                	test   %eax,%eax
+  8044b4:	75 75                	jne    80452b <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8044b6:	4d 85 e4             	test   %r12,%r12
+  8044b9:	74 14                	je     8044cf <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8044bb:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8044c2:	00 00 00 
+  8044c5:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8044cb:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8044cf:	48 85 db             	test   %rbx,%rbx
+  8044d2:	74 23                	je     8044f7 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8044d4:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8044db:	00 00 00 
+  8044de:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8044e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044e9:	85 c9                	test   %ecx,%ecx
+  8044eb:	74 07                	je     8044f4 <ipc_try_recv+0x85>
+  8044ed:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8044f4:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8044f7:	4d 85 ed             	test   %r13,%r13
+  8044fa:	74 14                	je     804510 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8044fc:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804503:	00 00 00 
+  804506:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80450c:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804510:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804517:	00 00 00 
+  80451a:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804520:	48 83 c4 08          	add    $0x8,%rsp
+  804524:	5b                   	pop    %rbx
+  804525:	41 5c                	pop    %r12
+  804527:	41 5d                	pop    %r13
+  804529:	5d                   	pop    %rbp
+  80452a:	c3                   	ret
+        if (from_env_store)
+  80452b:	4d 85 e4             	test   %r12,%r12
+  80452e:	74 08                	je     804538 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804530:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804537:	00 
+        if (perm_store)
+  804538:	4d 85 ed             	test   %r13,%r13
+  80453b:	74 e3                	je     804520 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80453d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804544:	00 
+  804545:	eb d9                	jmp    804520 <ipc_try_recv+0xb1>
+
+0000000000804547 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804547:	55                   	push   %rbp
+  804548:	48 89 e5             	mov    %rsp,%rbp
+  80454b:	41 57                	push   %r15
+  80454d:	41 56                	push   %r14
+  80454f:	41 55                	push   %r13
+  804551:	41 54                	push   %r12
+  804553:	53                   	push   %rbx
+  804554:	48 83 ec 18          	sub    $0x18,%rsp
+  804558:	41 89 fd             	mov    %edi,%r13d
+  80455b:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80455e:	48 89 d3             	mov    %rdx,%rbx
+  804561:	49 89 cc             	mov    %rcx,%r12
+  804564:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804568:	48 85 d2             	test   %rdx,%rdx
+  80456b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804572:	00 00 00 
+  804575:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804579:	49 be b1 18 80 00 00 	movabs $0x8018b1,%r14
+  804580:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804583:	49 bf a1 14 80 00 00 	movabs $0x8014a1,%r15
+  80458a:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80458d:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804590:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804594:	4c 89 e1             	mov    %r12,%rcx
+  804597:	48 89 da             	mov    %rbx,%rdx
+  80459a:	44 89 ef             	mov    %r13d,%edi
+  80459d:	41 ff d6             	call   *%r14
+  8045a0:	85 c0                	test   %eax,%eax
+  8045a2:	74 37                	je     8045db <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8045a4:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8045a7:	75 05                	jne    8045ae <ipc_send+0x67>
+        sys_yield();
+  8045a9:	41 ff d7             	call   *%r15
+  8045ac:	eb df                	jmp    80458d <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8045ae:	89 c1                	mov    %eax,%ecx
+  8045b0:	48 ba 60 57 80 00 00 	movabs $0x805760,%rdx
+  8045b7:	00 00 00 
+  8045ba:	be 65 00 00 00       	mov    $0x65,%esi
+  8045bf:	48 bf 7b 57 80 00 00 	movabs $0x80577b,%rdi
+  8045c6:	00 00 00 
+  8045c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ce:	49 b8 08 03 80 00 00 	movabs $0x800308,%r8
+  8045d5:	00 00 00 
+  8045d8:	41 ff d0             	call   *%r8
+    }
+}
+  8045db:	48 83 c4 18          	add    $0x18,%rsp
+  8045df:	5b                   	pop    %rbx
+  8045e0:	41 5c                	pop    %r12
+  8045e2:	41 5d                	pop    %r13
+  8045e4:	41 5e                	pop    %r14
+  8045e6:	41 5f                	pop    %r15
+  8045e8:	5d                   	pop    %rbp
+  8045e9:	c3                   	ret
+
+00000000008045ea <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8045ea:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8045ef:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8045f6:	00 00 00 
+  8045f9:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804600:	48 01 ca             	add    %rcx,%rdx
+  804603:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804609:	39 fa                	cmp    %edi,%edx
+  80460b:	74 12                	je     80461f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80460d:	48 83 c0 01          	add    $0x1,%rax
+  804611:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804617:	75 e0                	jne    8045f9 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804619:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80461e:	c3                   	ret
+            return envs[i].env_id;
+  80461f:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804626:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80462d:	00 00 00 
+  804630:	48 01 d0             	add    %rdx,%rax
+  804633:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804639:	c3                   	ret
+
+000000000080463a <__text_end>:
+  80463a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804641:	00 00 00 
+  804644:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464b:	00 00 00 
+  80464e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804655:	00 00 00 
+  804658:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465f:	00 00 00 
+  804662:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804669:	00 00 00 
+  80466c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804673:	00 00 00 
+  804676:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467d:	00 00 00 
+  804680:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804687:	00 00 00 
+  80468a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804691:	00 00 00 
+  804694:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469b:	00 00 00 
+  80469e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a5:	00 00 00 
+  8046a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046af:	00 00 00 
+  8046b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b9:	00 00 00 
+  8046bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c3:	00 00 00 
+  8046c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cd:	00 00 00 
+  8046d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d7:	00 00 00 
+  8046da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e1:	00 00 00 
+  8046e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046eb:	00 00 00 
+  8046ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f5:	00 00 00 
+  8046f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ff:	00 00 00 
+  804702:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804709:	00 00 00 
+  80470c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804713:	00 00 00 
+  804716:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471d:	00 00 00 
+  804720:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804727:	00 00 00 
+  80472a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804731:	00 00 00 
+  804734:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473b:	00 00 00 
+  80473e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804745:	00 00 00 
+  804748:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474f:	00 00 00 
+  804752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804759:	00 00 00 
+  80475c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804763:	00 00 00 
+  804766:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476d:	00 00 00 
+  804770:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804777:	00 00 00 
+  80477a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804781:	00 00 00 
+  804784:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478b:	00 00 00 
+  80478e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804795:	00 00 00 
+  804798:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479f:	00 00 00 
+  8047a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a9:	00 00 00 
+  8047ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b3:	00 00 00 
+  8047b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bd:	00 00 00 
+  8047c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c7:	00 00 00 
+  8047ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d1:	00 00 00 
+  8047d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047db:	00 00 00 
+  8047de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e5:	00 00 00 
+  8047e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ef:	00 00 00 
+  8047f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f9:	00 00 00 
+  8047fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804803:	00 00 00 
+  804806:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480d:	00 00 00 
+  804810:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804817:	00 00 00 
+  80481a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804821:	00 00 00 
+  804824:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482b:	00 00 00 
+  80482e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804835:	00 00 00 
+  804838:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483f:	00 00 00 
+  804842:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804849:	00 00 00 
+  80484c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804853:	00 00 00 
+  804856:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485d:	00 00 00 
+  804860:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804867:	00 00 00 
+  80486a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804871:	00 00 00 
+  804874:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487b:	00 00 00 
+  80487e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804885:	00 00 00 
+  804888:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488f:	00 00 00 
+  804892:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804899:	00 00 00 
+  80489c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a3:	00 00 00 
+  8048a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ad:	00 00 00 
+  8048b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b7:	00 00 00 
+  8048ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c1:	00 00 00 
+  8048c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cb:	00 00 00 
+  8048ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d5:	00 00 00 
+  8048d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048df:	00 00 00 
+  8048e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e9:	00 00 00 
+  8048ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f3:	00 00 00 
+  8048f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fd:	00 00 00 
+  804900:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804907:	00 00 00 
+  80490a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804911:	00 00 00 
+  804914:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491b:	00 00 00 
+  80491e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804925:	00 00 00 
+  804928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492f:	00 00 00 
+  804932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804939:	00 00 00 
+  80493c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804943:	00 00 00 
+  804946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494d:	00 00 00 
+  804950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804957:	00 00 00 
+  80495a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804961:	00 00 00 
+  804964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496b:	00 00 00 
+  80496e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804975:	00 00 00 
+  804978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497f:	00 00 00 
+  804982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804989:	00 00 00 
+  80498c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804993:	00 00 00 
+  804996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499d:	00 00 00 
+  8049a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a7:	00 00 00 
+  8049aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b1:	00 00 00 
+  8049b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bb:	00 00 00 
+  8049be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c5:	00 00 00 
+  8049c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cf:	00 00 00 
+  8049d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d9:	00 00 00 
+  8049dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e3:	00 00 00 
+  8049e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ed:	00 00 00 
+  8049f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f7:	00 00 00 
+  8049fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a01:	00 00 00 
+  804a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0b:	00 00 00 
+  804a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a15:	00 00 00 
+  804a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1f:	00 00 00 
+  804a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a29:	00 00 00 
+  804a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a33:	00 00 00 
+  804a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3d:	00 00 00 
+  804a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a47:	00 00 00 
+  804a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a51:	00 00 00 
+  804a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5b:	00 00 00 
+  804a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a65:	00 00 00 
+  804a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6f:	00 00 00 
+  804a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a79:	00 00 00 
+  804a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a83:	00 00 00 
+  804a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8d:	00 00 00 
+  804a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a97:	00 00 00 
+  804a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa1:	00 00 00 
+  804aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aab:	00 00 00 
+  804aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab5:	00 00 00 
+  804ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abf:	00 00 00 
+  804ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac9:	00 00 00 
+  804acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad3:	00 00 00 
+  804ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804add:	00 00 00 
+  804ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae7:	00 00 00 
+  804aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af1:	00 00 00 
+  804af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afb:	00 00 00 
+  804afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b05:	00 00 00 
+  804b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0f:	00 00 00 
+  804b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b19:	00 00 00 
+  804b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b23:	00 00 00 
+  804b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2d:	00 00 00 
+  804b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b37:	00 00 00 
+  804b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b41:	00 00 00 
+  804b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4b:	00 00 00 
+  804b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b55:	00 00 00 
+  804b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5f:	00 00 00 
+  804b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b69:	00 00 00 
+  804b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b73:	00 00 00 
+  804b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7d:	00 00 00 
+  804b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b87:	00 00 00 
+  804b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b91:	00 00 00 
+  804b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9b:	00 00 00 
+  804b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba5:	00 00 00 
+  804ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baf:	00 00 00 
+  804bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb9:	00 00 00 
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8195 @@
+
+obj/user/pingpong:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 01 00 00       	call   800136 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Only need to start one of these -- splits into two with fork. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = fork()) != 0) {
+  800036:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	0f 85 93 00 00 00    	jne    8000e0 <umain+0xbb>
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80004d:	49 bf ab 1e 80 00 00 	movabs $0x801eab,%r15
+  800054:	00 00 00 
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800057:	49 be c7 12 80 00 00 	movabs $0x8012c7,%r14
+  80005e:	00 00 00 
+  800061:	49 bd af 02 80 00 00 	movabs $0x8002af,%r13
+  800068:	00 00 00 
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80006b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800070:	ba 00 00 00 00       	mov    $0x0,%edx
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80007e:	41 ff d7             	call   *%r15
+  800081:	89 c3                	mov    %eax,%ebx
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800083:	44 8b 65 cc          	mov    -0x34(%rbp),%r12d
+  800087:	41 ff d6             	call   *%r14
+  80008a:	89 c6                	mov    %eax,%esi
+  80008c:	44 89 e1             	mov    %r12d,%ecx
+  80008f:	89 da                	mov    %ebx,%edx
+  800091:	48 bf 16 50 80 00 00 	movabs $0x805016,%rdi
+  800098:	00 00 00 
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a0:	41 ff d5             	call   *%r13
+        if (i == 10) return;
+  8000a3:	83 fb 0a             	cmp    $0xa,%ebx
+  8000a6:	74 29                	je     8000d1 <umain+0xac>
+        i++;
+  8000a8:	83 c3 01             	add    $0x1,%ebx
+        ipc_send(who, i, 0, 0, 0);
+  8000ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000bb:	89 de                	mov    %ebx,%esi
+  8000bd:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000c0:	48 b8 5b 20 80 00 00 	movabs $0x80205b,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+        if (i == 10) return;
+  8000cc:	83 fb 0a             	cmp    $0xa,%ebx
+  8000cf:	75 9a                	jne    80006b <umain+0x46>
+    }
+}
+  8000d1:	48 83 c4 18          	add    $0x18,%rsp
+  8000d5:	5b                   	pop    %rbx
+  8000d6:	41 5c                	pop    %r12
+  8000d8:	41 5d                	pop    %r13
+  8000da:	41 5e                	pop    %r14
+  8000dc:	41 5f                	pop    %r15
+  8000de:	5d                   	pop    %rbp
+  8000df:	c3                   	ret
+  8000e0:	89 c3                	mov    %eax,%ebx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000e2:	48 b8 c7 12 80 00 00 	movabs $0x8012c7,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+  8000ee:	89 c6                	mov    %eax,%esi
+  8000f0:	89 da                	mov    %ebx,%edx
+  8000f2:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  8000f9:	00 00 00 
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	48 b9 af 02 80 00 00 	movabs $0x8002af,%rcx
+  800108:	00 00 00 
+  80010b:	ff d1                	call   *%rcx
+        ipc_send(who, 0, 0, 0, 0);
+  80010d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800113:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011d:	be 00 00 00 00       	mov    $0x0,%esi
+  800122:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800125:	48 b8 5b 20 80 00 00 	movabs $0x80205b,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+  800131:	e9 17 ff ff ff       	jmp    80004d <umain+0x28>
+
+0000000000800136 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800136:	55                   	push   %rbp
+  800137:	48 89 e5             	mov    %rsp,%rbp
+  80013a:	41 56                	push   %r14
+  80013c:	41 55                	push   %r13
+  80013e:	41 54                	push   %r12
+  800140:	53                   	push   %rbx
+  800141:	41 89 fd             	mov    %edi,%r13d
+  800144:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800147:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80014e:	00 00 00 
+  800151:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800158:	00 00 00 
+  80015b:	48 39 c2             	cmp    %rax,%rdx
+  80015e:	73 17                	jae    800177 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800160:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800163:	49 89 c4             	mov    %rax,%r12
+  800166:	48 83 c3 08          	add    $0x8,%rbx
+  80016a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016f:	ff 53 f8             	call   *-0x8(%rbx)
+  800172:	4c 39 e3             	cmp    %r12,%rbx
+  800175:	72 ef                	jb     800166 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800177:	48 b8 c7 12 80 00 00 	movabs $0x8012c7,%rax
+  80017e:	00 00 00 
+  800181:	ff d0                	call   *%rax
+  800183:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800188:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80018f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800196:	00 00 00 
+  800199:	48 01 d0             	add    %rdx,%rax
+  80019c:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8001a3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001a6:	45 85 ed             	test   %r13d,%r13d
+  8001a9:	7e 0d                	jle    8001b8 <libmain+0x82>
+  8001ab:	49 8b 06             	mov    (%r14),%rax
+  8001ae:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001b5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001b8:	4c 89 f6             	mov    %r14,%rsi
+  8001bb:	44 89 ef             	mov    %r13d,%edi
+  8001be:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001c5:	00 00 00 
+  8001c8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001ca:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  8001d1:	00 00 00 
+  8001d4:	ff d0                	call   *%rax
+#endif
+}
+  8001d6:	5b                   	pop    %rbx
+  8001d7:	41 5c                	pop    %r12
+  8001d9:	41 5d                	pop    %r13
+  8001db:	41 5e                	pop    %r14
+  8001dd:	5d                   	pop    %rbp
+  8001de:	c3                   	ret
+
+00000000008001df <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001df:	55                   	push   %rbp
+  8001e0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001e3:	48 b8 74 23 80 00 00 	movabs $0x802374,%rax
+  8001ea:	00 00 00 
+  8001ed:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f4:	48 b8 5c 12 80 00 00 	movabs $0x80125c,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+}
+  800200:	5d                   	pop    %rbp
+  800201:	c3                   	ret
+
+0000000000800202 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800202:	55                   	push   %rbp
+  800203:	48 89 e5             	mov    %rsp,%rbp
+  800206:	53                   	push   %rbx
+  800207:	48 83 ec 08          	sub    $0x8,%rsp
+  80020b:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80020e:	8b 06                	mov    (%rsi),%eax
+  800210:	8d 50 01             	lea    0x1(%rax),%edx
+  800213:	89 16                	mov    %edx,(%rsi)
+  800215:	48 98                	cltq
+  800217:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80021c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800222:	74 0a                	je     80022e <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800224:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800228:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80022c:	c9                   	leave
+  80022d:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80022e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800232:	be ff 00 00 00       	mov    $0xff,%esi
+  800237:	48 b8 fe 11 80 00 00 	movabs $0x8011fe,%rax
+  80023e:	00 00 00 
+  800241:	ff d0                	call   *%rax
+        state->offset = 0;
+  800243:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800249:	eb d9                	jmp    800224 <putch+0x22>
+
+000000000080024b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80024b:	55                   	push   %rbp
+  80024c:	48 89 e5             	mov    %rsp,%rbp
+  80024f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800256:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800259:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800260:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80026d:	48 89 f1             	mov    %rsi,%rcx
+  800270:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800277:	48 bf 02 02 80 00 00 	movabs $0x800202,%rdi
+  80027e:	00 00 00 
+  800281:	48 b8 ff 03 80 00 00 	movabs $0x8003ff,%rax
+  800288:	00 00 00 
+  80028b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80028d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800294:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80029b:	48 b8 fe 11 80 00 00 	movabs $0x8011fe,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002a7:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002ad:	c9                   	leave
+  8002ae:	c3                   	ret
+
+00000000008002af <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002af:	55                   	push   %rbp
+  8002b0:	48 89 e5             	mov    %rsp,%rbp
+  8002b3:	48 83 ec 50          	sub    $0x50,%rsp
+  8002b7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002bb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002bf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002c3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002c7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002cb:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002d2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002da:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002de:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002e2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002e6:	48 b8 4b 02 80 00 00 	movabs $0x80024b,%rax
+  8002ed:	00 00 00 
+  8002f0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002f2:	c9                   	leave
+  8002f3:	c3                   	ret
+
+00000000008002f4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002f4:	55                   	push   %rbp
+  8002f5:	48 89 e5             	mov    %rsp,%rbp
+  8002f8:	41 57                	push   %r15
+  8002fa:	41 56                	push   %r14
+  8002fc:	41 55                	push   %r13
+  8002fe:	41 54                	push   %r12
+  800300:	53                   	push   %rbx
+  800301:	48 83 ec 18          	sub    $0x18,%rsp
+  800305:	49 89 fc             	mov    %rdi,%r12
+  800308:	49 89 f5             	mov    %rsi,%r13
+  80030b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80030f:	8b 45 10             	mov    0x10(%rbp),%eax
+  800312:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800315:	41 89 cf             	mov    %ecx,%r15d
+  800318:	4c 39 fa             	cmp    %r15,%rdx
+  80031b:	73 5b                	jae    800378 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80031d:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800321:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800325:	85 db                	test   %ebx,%ebx
+  800327:	7e 0e                	jle    800337 <print_num+0x43>
+            putch(padc, put_arg);
+  800329:	4c 89 ee             	mov    %r13,%rsi
+  80032c:	44 89 f7             	mov    %r14d,%edi
+  80032f:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800332:	83 eb 01             	sub    $0x1,%ebx
+  800335:	75 f2                	jne    800329 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800337:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80033b:	48 b9 44 50 80 00 00 	movabs $0x805044,%rcx
+  800342:	00 00 00 
+  800345:	48 b8 33 50 80 00 00 	movabs $0x805033,%rax
+  80034c:	00 00 00 
+  80034f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800353:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800357:	ba 00 00 00 00       	mov    $0x0,%edx
+  80035c:	49 f7 f7             	div    %r15
+  80035f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800363:	4c 89 ee             	mov    %r13,%rsi
+  800366:	41 ff d4             	call   *%r12
+}
+  800369:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80036d:	5b                   	pop    %rbx
+  80036e:	41 5c                	pop    %r12
+  800370:	41 5d                	pop    %r13
+  800372:	41 5e                	pop    %r14
+  800374:	41 5f                	pop    %r15
+  800376:	5d                   	pop    %rbp
+  800377:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800378:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80037c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800381:	49 f7 f7             	div    %r15
+  800384:	48 83 ec 08          	sub    $0x8,%rsp
+  800388:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80038c:	52                   	push   %rdx
+  80038d:	45 0f be c9          	movsbl %r9b,%r9d
+  800391:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800395:	48 89 c2             	mov    %rax,%rdx
+  800398:	48 b8 f4 02 80 00 00 	movabs $0x8002f4,%rax
+  80039f:	00 00 00 
+  8003a2:	ff d0                	call   *%rax
+  8003a4:	48 83 c4 10          	add    $0x10,%rsp
+  8003a8:	eb 8d                	jmp    800337 <print_num+0x43>
+
+00000000008003aa <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003aa:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003ae:	48 8b 06             	mov    (%rsi),%rax
+  8003b1:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003b5:	73 0a                	jae    8003c1 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003b7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003bb:	48 89 16             	mov    %rdx,(%rsi)
+  8003be:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003c1:	c3                   	ret
+
+00000000008003c2 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003c2:	55                   	push   %rbp
+  8003c3:	48 89 e5             	mov    %rsp,%rbp
+  8003c6:	48 83 ec 50          	sub    $0x50,%rsp
+  8003ca:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003ce:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003d2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003d6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003dd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003e5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003e9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003ed:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003f1:	48 b8 ff 03 80 00 00 	movabs $0x8003ff,%rax
+  8003f8:	00 00 00 
+  8003fb:	ff d0                	call   *%rax
+}
+  8003fd:	c9                   	leave
+  8003fe:	c3                   	ret
+
+00000000008003ff <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003ff:	55                   	push   %rbp
+  800400:	48 89 e5             	mov    %rsp,%rbp
+  800403:	41 57                	push   %r15
+  800405:	41 56                	push   %r14
+  800407:	41 55                	push   %r13
+  800409:	41 54                	push   %r12
+  80040b:	53                   	push   %rbx
+  80040c:	48 83 ec 38          	sub    $0x38,%rsp
+  800410:	49 89 fe             	mov    %rdi,%r14
+  800413:	49 89 f5             	mov    %rsi,%r13
+  800416:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800419:	48 8b 01             	mov    (%rcx),%rax
+  80041c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800420:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800424:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800428:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80042c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800430:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800434:	0f b6 3b             	movzbl (%rbx),%edi
+  800437:	40 80 ff 25          	cmp    $0x25,%dil
+  80043b:	74 18                	je     800455 <vprintfmt+0x56>
+            if (!ch) return;
+  80043d:	40 84 ff             	test   %dil,%dil
+  800440:	0f 84 04 07 00 00    	je     800b4a <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800446:	40 0f b6 ff          	movzbl %dil,%edi
+  80044a:	4c 89 ee             	mov    %r13,%rsi
+  80044d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800450:	4c 89 e3             	mov    %r12,%rbx
+  800453:	eb db                	jmp    800430 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800455:	be 00 00 00 00       	mov    $0x0,%esi
+  80045a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80045e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800463:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800469:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800470:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800474:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800479:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80047e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800481:	83 e8 23             	sub    $0x23,%eax
+  800484:	3c 57                	cmp    $0x57,%al
+  800486:	0f 87 a4 06 00 00    	ja     800b30 <vprintfmt+0x731>
+  80048c:	0f b6 c0             	movzbl %al,%eax
+  80048f:	48 b9 e0 51 80 00 00 	movabs $0x8051e0,%rcx
+  800496:	00 00 00 
+  800499:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80049c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80049f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004a3:	eb cf                	jmp    800474 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004a5:	49 89 dc             	mov    %rbx,%r12
+  8004a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8004ad:	eb c5                	jmp    800474 <vprintfmt+0x75>
+            padc = ch;
+  8004af:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004b3:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004b6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004b9:	eb b9                	jmp    800474 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004be:	83 f8 2f             	cmp    $0x2f,%eax
+  8004c1:	77 24                	ja     8004e7 <vprintfmt+0xe8>
+  8004c3:	89 c1                	mov    %eax,%ecx
+  8004c5:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004c9:	83 c0 08             	add    $0x8,%eax
+  8004cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004cf:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004d2:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004d5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004d9:	79 99                	jns    800474 <vprintfmt+0x75>
+                width = precision;
+  8004db:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004df:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004e5:	eb 8d                	jmp    800474 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004e7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004eb:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f3:	eb da                	jmp    8004cf <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004f5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004fa:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004fe:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800504:	3c 39                	cmp    $0x39,%al
+  800506:	77 1c                	ja     800524 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800508:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80050c:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800510:	0f b6 c0             	movzbl %al,%eax
+  800513:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800518:	0f b6 03             	movzbl (%rbx),%eax
+  80051b:	3c 39                	cmp    $0x39,%al
+  80051d:	76 e9                	jbe    800508 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80051f:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800522:	eb b1                	jmp    8004d5 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800524:	49 89 dc             	mov    %rbx,%r12
+  800527:	eb ac                	jmp    8004d5 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800529:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80052c:	85 c9                	test   %ecx,%ecx
+  80052e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800533:	0f 49 c1             	cmovns %ecx,%eax
+  800536:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800539:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80053c:	e9 33 ff ff ff       	jmp    800474 <vprintfmt+0x75>
+            lflag++;
+  800541:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800544:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800547:	e9 28 ff ff ff       	jmp    800474 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80054c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80054f:	83 f8 2f             	cmp    $0x2f,%eax
+  800552:	77 19                	ja     80056d <vprintfmt+0x16e>
+  800554:	89 c2                	mov    %eax,%edx
+  800556:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055a:	83 c0 08             	add    $0x8,%eax
+  80055d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800560:	8b 3a                	mov    (%rdx),%edi
+  800562:	4c 89 ee             	mov    %r13,%rsi
+  800565:	41 ff d6             	call   *%r14
+            break;
+  800568:	e9 c3 fe ff ff       	jmp    800430 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80056d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800571:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800575:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800579:	eb e5                	jmp    800560 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80057b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80057e:	83 f8 2f             	cmp    $0x2f,%eax
+  800581:	77 5a                	ja     8005dd <vprintfmt+0x1de>
+  800583:	89 c2                	mov    %eax,%edx
+  800585:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800589:	83 c0 08             	add    $0x8,%eax
+  80058c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80058f:	8b 02                	mov    (%rdx),%eax
+  800591:	89 c1                	mov    %eax,%ecx
+  800593:	f7 d9                	neg    %ecx
+  800595:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800598:	83 f9 13             	cmp    $0x13,%ecx
+  80059b:	7f 4e                	jg     8005eb <vprintfmt+0x1ec>
+  80059d:	48 63 c1             	movslq %ecx,%rax
+  8005a0:	48 ba a0 54 80 00 00 	movabs $0x8054a0,%rdx
+  8005a7:	00 00 00 
+  8005aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005ae:	48 85 c0             	test   %rax,%rax
+  8005b1:	74 38                	je     8005eb <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005b3:	48 89 c1             	mov    %rax,%rcx
+  8005b6:	48 ba 19 57 80 00 00 	movabs $0x805719,%rdx
+  8005bd:	00 00 00 
+  8005c0:	4c 89 ee             	mov    %r13,%rsi
+  8005c3:	4c 89 f7             	mov    %r14,%rdi
+  8005c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cb:	49 b8 c2 03 80 00 00 	movabs $0x8003c2,%r8
+  8005d2:	00 00 00 
+  8005d5:	41 ff d0             	call   *%r8
+  8005d8:	e9 53 fe ff ff       	jmp    800430 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e9:	eb a4                	jmp    80058f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005eb:	48 ba 5c 50 80 00 00 	movabs $0x80505c,%rdx
+  8005f2:	00 00 00 
+  8005f5:	4c 89 ee             	mov    %r13,%rsi
+  8005f8:	4c 89 f7             	mov    %r14,%rdi
+  8005fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800600:	49 b8 c2 03 80 00 00 	movabs $0x8003c2,%r8
+  800607:	00 00 00 
+  80060a:	41 ff d0             	call   *%r8
+  80060d:	e9 1e fe ff ff       	jmp    800430 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800612:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800615:	83 f8 2f             	cmp    $0x2f,%eax
+  800618:	77 36                	ja     800650 <vprintfmt+0x251>
+  80061a:	89 c2                	mov    %eax,%edx
+  80061c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800620:	83 c0 08             	add    $0x8,%eax
+  800623:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800626:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800629:	48 85 f6             	test   %rsi,%rsi
+  80062c:	48 b8 55 50 80 00 00 	movabs $0x805055,%rax
+  800633:	00 00 00 
+  800636:	48 0f 45 c6          	cmovne %rsi,%rax
+  80063a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80063e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800642:	7e 06                	jle    80064a <vprintfmt+0x24b>
+  800644:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800648:	75 14                	jne    80065e <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80064a:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80064e:	eb 5b                	jmp    8006ab <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800650:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800654:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800658:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80065c:	eb c8                	jmp    800626 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80065e:	49 63 f7             	movslq %r15d,%rsi
+  800661:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800665:	48 b8 04 0c 80 00 00 	movabs $0x800c04,%rax
+  80066c:	00 00 00 
+  80066f:	ff d0                	call   *%rax
+  800671:	48 89 c2             	mov    %rax,%rdx
+  800674:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800677:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800679:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80067c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80067f:	85 c0                	test   %eax,%eax
+  800681:	7e c7                	jle    80064a <vprintfmt+0x24b>
+  800683:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800688:	4c 89 ee             	mov    %r13,%rsi
+  80068b:	44 89 e7             	mov    %r12d,%edi
+  80068e:	41 ff d6             	call   *%r14
+  800691:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800695:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800698:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80069b:	75 eb                	jne    800688 <vprintfmt+0x289>
+  80069d:	eb ab                	jmp    80064a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80069f:	0f b6 f8             	movzbl %al,%edi
+  8006a2:	4c 89 ee             	mov    %r13,%rsi
+  8006a5:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8006a8:	4c 89 e2             	mov    %r12,%rdx
+  8006ab:	45 85 ff             	test   %r15d,%r15d
+  8006ae:	78 06                	js     8006b6 <vprintfmt+0x2b7>
+  8006b0:	41 83 ef 01          	sub    $0x1,%r15d
+  8006b4:	78 23                	js     8006d9 <vprintfmt+0x2da>
+  8006b6:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8006ba:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006c0:	84 c0                	test   %al,%al
+  8006c2:	74 15                	je     8006d9 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006c4:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006c8:	74 d5                	je     80069f <vprintfmt+0x2a0>
+  8006ca:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006cd:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006d2:	80 fa 5e             	cmp    $0x5e,%dl
+  8006d5:	77 cb                	ja     8006a2 <vprintfmt+0x2a3>
+  8006d7:	eb c6                	jmp    80069f <vprintfmt+0x2a0>
+  8006d9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006dc:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8006df:	01 f0                	add    %esi,%eax
+  8006e1:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8006e3:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006e7:	85 c0                	test   %eax,%eax
+  8006e9:	0f 8e 41 fd ff ff    	jle    800430 <vprintfmt+0x31>
+  8006ef:	4c 89 ee             	mov    %r13,%rsi
+  8006f2:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006f7:	41 ff d6             	call   *%r14
+  8006fa:	41 83 ec 01          	sub    $0x1,%r12d
+  8006fe:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800702:	75 eb                	jne    8006ef <vprintfmt+0x2f0>
+  800704:	e9 27 fd ff ff       	jmp    800430 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800709:	40 84 f6             	test   %sil,%sil
+  80070c:	75 26                	jne    800734 <vprintfmt+0x335>
+    switch (lflag) {
+  80070e:	85 d2                	test   %edx,%edx
+  800710:	74 59                	je     80076b <vprintfmt+0x36c>
+  800712:	83 fa 01             	cmp    $0x1,%edx
+  800715:	74 7b                	je     800792 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800717:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071a:	83 f8 2f             	cmp    $0x2f,%eax
+  80071d:	0f 87 96 00 00 00    	ja     8007b9 <vprintfmt+0x3ba>
+  800723:	89 c2                	mov    %eax,%edx
+  800725:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800729:	83 c0 08             	add    $0x8,%eax
+  80072c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072f:	4c 8b 22             	mov    (%rdx),%r12
+  800732:	eb 17                	jmp    80074b <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800734:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800737:	83 f8 2f             	cmp    $0x2f,%eax
+  80073a:	77 21                	ja     80075d <vprintfmt+0x35e>
+  80073c:	89 c2                	mov    %eax,%edx
+  80073e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800742:	83 c0 08             	add    $0x8,%eax
+  800745:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800748:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80074b:	4d 85 e4             	test   %r12,%r12
+  80074e:	78 7a                	js     8007ca <vprintfmt+0x3cb>
+            num = i;
+  800750:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800753:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800758:	e9 b5 02 00 00       	jmp    800a12 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80075d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800761:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800765:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800769:	eb dd                	jmp    800748 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  80076b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076e:	83 f8 2f             	cmp    $0x2f,%eax
+  800771:	77 11                	ja     800784 <vprintfmt+0x385>
+  800773:	89 c2                	mov    %eax,%edx
+  800775:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800779:	83 c0 08             	add    $0x8,%eax
+  80077c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077f:	4c 63 22             	movslq (%rdx),%r12
+  800782:	eb c7                	jmp    80074b <vprintfmt+0x34c>
+  800784:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800788:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800790:	eb ed                	jmp    80077f <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800792:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800795:	83 f8 2f             	cmp    $0x2f,%eax
+  800798:	77 11                	ja     8007ab <vprintfmt+0x3ac>
+  80079a:	89 c2                	mov    %eax,%edx
+  80079c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a0:	83 c0 08             	add    $0x8,%eax
+  8007a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a6:	4c 8b 22             	mov    (%rdx),%r12
+  8007a9:	eb a0                	jmp    80074b <vprintfmt+0x34c>
+  8007ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b7:	eb ed                	jmp    8007a6 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8007b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c5:	e9 65 ff ff ff       	jmp    80072f <vprintfmt+0x330>
+                putch('-', put_arg);
+  8007ca:	4c 89 ee             	mov    %r13,%rsi
+  8007cd:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007d2:	41 ff d6             	call   *%r14
+                i = -i;
+  8007d5:	49 f7 dc             	neg    %r12
+  8007d8:	e9 73 ff ff ff       	jmp    800750 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8007dd:	40 84 f6             	test   %sil,%sil
+  8007e0:	75 32                	jne    800814 <vprintfmt+0x415>
+    switch (lflag) {
+  8007e2:	85 d2                	test   %edx,%edx
+  8007e4:	74 5d                	je     800843 <vprintfmt+0x444>
+  8007e6:	83 fa 01             	cmp    $0x1,%edx
+  8007e9:	0f 84 82 00 00 00    	je     800871 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8007ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f5:	0f 87 a5 00 00 00    	ja     8008a0 <vprintfmt+0x4a1>
+  8007fb:	89 c2                	mov    %eax,%edx
+  8007fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800801:	83 c0 08             	add    $0x8,%eax
+  800804:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800807:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80080a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80080f:	e9 fe 01 00 00       	jmp    800a12 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800814:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800817:	83 f8 2f             	cmp    $0x2f,%eax
+  80081a:	77 19                	ja     800835 <vprintfmt+0x436>
+  80081c:	89 c2                	mov    %eax,%edx
+  80081e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800822:	83 c0 08             	add    $0x8,%eax
+  800825:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800828:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80082b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800830:	e9 dd 01 00 00       	jmp    800a12 <vprintfmt+0x613>
+  800835:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800839:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800841:	eb e5                	jmp    800828 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800843:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800846:	83 f8 2f             	cmp    $0x2f,%eax
+  800849:	77 18                	ja     800863 <vprintfmt+0x464>
+  80084b:	89 c2                	mov    %eax,%edx
+  80084d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800851:	83 c0 08             	add    $0x8,%eax
+  800854:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800857:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800859:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80085e:	e9 af 01 00 00       	jmp    800a12 <vprintfmt+0x613>
+  800863:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800867:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086f:	eb e6                	jmp    800857 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800871:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800874:	83 f8 2f             	cmp    $0x2f,%eax
+  800877:	77 19                	ja     800892 <vprintfmt+0x493>
+  800879:	89 c2                	mov    %eax,%edx
+  80087b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087f:	83 c0 08             	add    $0x8,%eax
+  800882:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800885:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800888:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80088d:	e9 80 01 00 00       	jmp    800a12 <vprintfmt+0x613>
+  800892:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800896:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089e:	eb e5                	jmp    800885 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8008a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ac:	e9 56 ff ff ff       	jmp    800807 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b1:	40 84 f6             	test   %sil,%sil
+  8008b4:	75 2e                	jne    8008e4 <vprintfmt+0x4e5>
+    switch (lflag) {
+  8008b6:	85 d2                	test   %edx,%edx
+  8008b8:	0f 84 b3 00 00 00    	je     800971 <vprintfmt+0x572>
+  8008be:	83 fa 01             	cmp    $0x1,%edx
+  8008c1:	0f 84 d3 00 00 00    	je     80099a <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8008c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cd:	0f 87 f1 00 00 00    	ja     8009c4 <vprintfmt+0x5c5>
+  8008d3:	89 c2                	mov    %eax,%edx
+  8008d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d9:	83 c0 08             	add    $0x8,%eax
+  8008dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008df:	48 8b 02             	mov    (%rdx),%rax
+  8008e2:	eb 17                	jmp    8008fb <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ea:	77 77                	ja     800963 <vprintfmt+0x564>
+  8008ec:	89 c2                	mov    %eax,%edx
+  8008ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f2:	83 c0 08             	add    $0x8,%eax
+  8008f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f8:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8008fb:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8008fd:	83 f8 07             	cmp    $0x7,%eax
+  800900:	0f 8e cf 00 00 00    	jle    8009d5 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800906:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80090c:	44 89 e7             	mov    %r12d,%edi
+  80090f:	41 c1 e4 03          	shl    $0x3,%r12d
+  800913:	89 d1                	mov    %edx,%ecx
+  800915:	8d 72 07             	lea    0x7(%rdx),%esi
+  800918:	85 d2                	test   %edx,%edx
+  80091a:	0f 48 d6             	cmovs  %esi,%edx
+  80091d:	c1 fa 03             	sar    $0x3,%edx
+  800920:	83 f9 3f             	cmp    $0x3f,%ecx
+  800923:	7f e7                	jg     80090c <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800925:	85 ff                	test   %edi,%edi
+  800927:	0f 84 03 fb ff ff    	je     800430 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  80092d:	49 63 f4             	movslq %r12d,%rsi
+  800930:	ba 00 00 00 00       	mov    $0x0,%edx
+  800935:	48 f7 f6             	div    %rsi
+  800938:	49 89 d7             	mov    %rdx,%r15
+  80093b:	83 c0 30             	add    $0x30,%eax
+  80093e:	0f be f8             	movsbl %al,%edi
+  800941:	4c 89 ee             	mov    %r13,%rsi
+  800944:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800947:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  80094a:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  80094f:	45 85 e4             	test   %r12d,%r12d
+  800952:	41 0f 49 d4          	cmovns %r12d,%edx
+  800956:	c1 fa 03             	sar    $0x3,%edx
+  800959:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  80095c:	75 cf                	jne    80092d <vprintfmt+0x52e>
+  80095e:	e9 cd fa ff ff       	jmp    800430 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800963:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800967:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096f:	eb 87                	jmp    8008f8 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800971:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800974:	83 f8 2f             	cmp    $0x2f,%eax
+  800977:	77 13                	ja     80098c <vprintfmt+0x58d>
+  800979:	89 c2                	mov    %eax,%edx
+  80097b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097f:	83 c0 08             	add    $0x8,%eax
+  800982:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800985:	8b 02                	mov    (%rdx),%eax
+  800987:	e9 6f ff ff ff       	jmp    8008fb <vprintfmt+0x4fc>
+  80098c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800990:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800994:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800998:	eb eb                	jmp    800985 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  80099a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099d:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a0:	77 14                	ja     8009b6 <vprintfmt+0x5b7>
+  8009a2:	89 c2                	mov    %eax,%edx
+  8009a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a8:	83 c0 08             	add    $0x8,%eax
+  8009ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ae:	48 8b 02             	mov    (%rdx),%rax
+  8009b1:	e9 45 ff ff ff       	jmp    8008fb <vprintfmt+0x4fc>
+  8009b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c2:	eb ea                	jmp    8009ae <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8009c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d0:	e9 0a ff ff ff       	jmp    8008df <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8009d5:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8009db:	e9 4d ff ff ff       	jmp    80092d <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8009e0:	4c 89 ee             	mov    %r13,%rsi
+  8009e3:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009e8:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009eb:	4c 89 ee             	mov    %r13,%rsi
+  8009ee:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009f3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fc:	77 47                	ja     800a45 <vprintfmt+0x646>
+  8009fe:	89 c2                	mov    %eax,%edx
+  800a00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a04:	83 c0 08             	add    $0x8,%eax
+  800a07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a12:	48 83 ec 08          	sub    $0x8,%rsp
+  800a16:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a1a:	0f 94 c0             	sete   %al
+  800a1d:	0f b6 c0             	movzbl %al,%eax
+  800a20:	50                   	push   %rax
+  800a21:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a26:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a2a:	4c 89 ee             	mov    %r13,%rsi
+  800a2d:	4c 89 f7             	mov    %r14,%rdi
+  800a30:	48 b8 f4 02 80 00 00 	movabs $0x8002f4,%rax
+  800a37:	00 00 00 
+  800a3a:	ff d0                	call   *%rax
+            break;
+  800a3c:	48 83 c4 10          	add    $0x10,%rsp
+  800a40:	e9 eb f9 ff ff       	jmp    800430 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a51:	eb b7                	jmp    800a0a <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800a53:	40 84 f6             	test   %sil,%sil
+  800a56:	75 2b                	jne    800a83 <vprintfmt+0x684>
+    switch (lflag) {
+  800a58:	85 d2                	test   %edx,%edx
+  800a5a:	74 56                	je     800ab2 <vprintfmt+0x6b3>
+  800a5c:	83 fa 01             	cmp    $0x1,%edx
+  800a5f:	74 7f                	je     800ae0 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800a61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a64:	83 f8 2f             	cmp    $0x2f,%eax
+  800a67:	0f 87 a2 00 00 00    	ja     800b0f <vprintfmt+0x710>
+  800a6d:	89 c2                	mov    %eax,%edx
+  800a6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a73:	83 c0 08             	add    $0x8,%eax
+  800a76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a79:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a7c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a81:	eb 8f                	jmp    800a12 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a86:	83 f8 2f             	cmp    $0x2f,%eax
+  800a89:	77 19                	ja     800aa4 <vprintfmt+0x6a5>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a9a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a9f:	e9 6e ff ff ff       	jmp    800a12 <vprintfmt+0x613>
+  800aa4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab0:	eb e5                	jmp    800a97 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800ab2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab8:	77 18                	ja     800ad2 <vprintfmt+0x6d3>
+  800aba:	89 c2                	mov    %eax,%edx
+  800abc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac0:	83 c0 08             	add    $0x8,%eax
+  800ac3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac6:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ac8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800acd:	e9 40 ff ff ff       	jmp    800a12 <vprintfmt+0x613>
+  800ad2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ada:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ade:	eb e6                	jmp    800ac6 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800ae0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae6:	77 19                	ja     800b01 <vprintfmt+0x702>
+  800ae8:	89 c2                	mov    %eax,%edx
+  800aea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aee:	83 c0 08             	add    $0x8,%eax
+  800af1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800afc:	e9 11 ff ff ff       	jmp    800a12 <vprintfmt+0x613>
+  800b01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0d:	eb e5                	jmp    800af4 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800b0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1b:	e9 59 ff ff ff       	jmp    800a79 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800b20:	4c 89 ee             	mov    %r13,%rsi
+  800b23:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b28:	41 ff d6             	call   *%r14
+            break;
+  800b2b:	e9 00 f9 ff ff       	jmp    800430 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b30:	4c 89 ee             	mov    %r13,%rsi
+  800b33:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b38:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b3b:	48 83 eb 01          	sub    $0x1,%rbx
+  800b3f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b43:	75 f6                	jne    800b3b <vprintfmt+0x73c>
+  800b45:	e9 e6 f8 ff ff       	jmp    800430 <vprintfmt+0x31>
+}
+  800b4a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b4e:	5b                   	pop    %rbx
+  800b4f:	41 5c                	pop    %r12
+  800b51:	41 5d                	pop    %r13
+  800b53:	41 5e                	pop    %r14
+  800b55:	41 5f                	pop    %r15
+  800b57:	5d                   	pop    %rbp
+  800b58:	c3                   	ret
+
+0000000000800b59 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b59:	55                   	push   %rbp
+  800b5a:	48 89 e5             	mov    %rsp,%rbp
+  800b5d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b61:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b65:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b6a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b6e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b75:	48 85 ff             	test   %rdi,%rdi
+  800b78:	74 2b                	je     800ba5 <vsnprintf+0x4c>
+  800b7a:	48 85 f6             	test   %rsi,%rsi
+  800b7d:	74 26                	je     800ba5 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b7f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b83:	48 bf aa 03 80 00 00 	movabs $0x8003aa,%rdi
+  800b8a:	00 00 00 
+  800b8d:	48 b8 ff 03 80 00 00 	movabs $0x8003ff,%rax
+  800b94:	00 00 00 
+  800b97:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b9d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ba0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ba3:	c9                   	leave
+  800ba4:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ba5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800baa:	eb f7                	jmp    800ba3 <vsnprintf+0x4a>
+
+0000000000800bac <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bac:	55                   	push   %rbp
+  800bad:	48 89 e5             	mov    %rsp,%rbp
+  800bb0:	48 83 ec 50          	sub    $0x50,%rsp
+  800bb4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bb8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bbc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bc0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bc7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bcb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bd3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bd7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800bdb:	48 b8 59 0b 80 00 00 	movabs $0x800b59,%rax
+  800be2:	00 00 00 
+  800be5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800be7:	c9                   	leave
+  800be8:	c3                   	ret
+
+0000000000800be9 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800be9:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bec:	74 10                	je     800bfe <strlen+0x15>
+    size_t n = 0;
+  800bee:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bf3:	48 83 c0 01          	add    $0x1,%rax
+  800bf7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bfb:	75 f6                	jne    800bf3 <strlen+0xa>
+  800bfd:	c3                   	ret
+    size_t n = 0;
+  800bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c03:	c3                   	ret
+
+0000000000800c04 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c04:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c07:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c0c:	48 85 f6             	test   %rsi,%rsi
+  800c0f:	74 11                	je     800c22 <strnlen+0x1e>
+  800c11:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c15:	74 0c                	je     800c23 <strnlen+0x1f>
+  800c17:	48 83 c2 01          	add    $0x1,%rdx
+  800c1b:	48 39 d0             	cmp    %rdx,%rax
+  800c1e:	75 f1                	jne    800c11 <strnlen+0xd>
+  800c20:	eb 04                	jmp    800c26 <strnlen+0x22>
+  800c22:	c3                   	ret
+  800c23:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c26:	c3                   	ret
+
+0000000000800c27 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c27:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c33:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c36:	48 83 c2 01          	add    $0x1,%rdx
+  800c3a:	84 c9                	test   %cl,%cl
+  800c3c:	75 f1                	jne    800c2f <strcpy+0x8>
+        ;
+    return res;
+}
+  800c3e:	c3                   	ret
+
+0000000000800c3f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c3f:	55                   	push   %rbp
+  800c40:	48 89 e5             	mov    %rsp,%rbp
+  800c43:	41 54                	push   %r12
+  800c45:	53                   	push   %rbx
+  800c46:	48 89 fb             	mov    %rdi,%rbx
+  800c49:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c4c:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  800c53:	00 00 00 
+  800c56:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c58:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c5c:	4c 89 e6             	mov    %r12,%rsi
+  800c5f:	48 b8 27 0c 80 00 00 	movabs $0x800c27,%rax
+  800c66:	00 00 00 
+  800c69:	ff d0                	call   *%rax
+    return dst;
+}
+  800c6b:	48 89 d8             	mov    %rbx,%rax
+  800c6e:	5b                   	pop    %rbx
+  800c6f:	41 5c                	pop    %r12
+  800c71:	5d                   	pop    %rbp
+  800c72:	c3                   	ret
+
+0000000000800c73 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c73:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c76:	48 85 d2             	test   %rdx,%rdx
+  800c79:	74 1f                	je     800c9a <strncpy+0x27>
+  800c7b:	48 01 fa             	add    %rdi,%rdx
+  800c7e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c81:	48 83 c1 01          	add    $0x1,%rcx
+  800c85:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c89:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c8d:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c91:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c95:	48 39 ca             	cmp    %rcx,%rdx
+  800c98:	75 e7                	jne    800c81 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c9a:	c3                   	ret
+
+0000000000800c9b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c9b:	48 89 f8             	mov    %rdi,%rax
+  800c9e:	48 85 d2             	test   %rdx,%rdx
+  800ca1:	74 24                	je     800cc7 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ca3:	48 83 ea 01          	sub    $0x1,%rdx
+  800ca7:	74 1b                	je     800cc4 <strlcpy+0x29>
+  800ca9:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cad:	0f b6 16             	movzbl (%rsi),%edx
+  800cb0:	84 d2                	test   %dl,%dl
+  800cb2:	74 10                	je     800cc4 <strlcpy+0x29>
+            *dst++ = *src++;
+  800cb4:	48 83 c6 01          	add    $0x1,%rsi
+  800cb8:	48 83 c0 01          	add    $0x1,%rax
+  800cbc:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cbf:	48 39 c8             	cmp    %rcx,%rax
+  800cc2:	75 e9                	jne    800cad <strlcpy+0x12>
+        *dst = '\0';
+  800cc4:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cc7:	48 29 f8             	sub    %rdi,%rax
+}
+  800cca:	c3                   	ret
+
+0000000000800ccb <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ccb:	0f b6 07             	movzbl (%rdi),%eax
+  800cce:	84 c0                	test   %al,%al
+  800cd0:	74 13                	je     800ce5 <strcmp+0x1a>
+  800cd2:	38 06                	cmp    %al,(%rsi)
+  800cd4:	75 0f                	jne    800ce5 <strcmp+0x1a>
+  800cd6:	48 83 c7 01          	add    $0x1,%rdi
+  800cda:	48 83 c6 01          	add    $0x1,%rsi
+  800cde:	0f b6 07             	movzbl (%rdi),%eax
+  800ce1:	84 c0                	test   %al,%al
+  800ce3:	75 ed                	jne    800cd2 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ce5:	0f b6 c0             	movzbl %al,%eax
+  800ce8:	0f b6 16             	movzbl (%rsi),%edx
+  800ceb:	29 d0                	sub    %edx,%eax
+}
+  800ced:	c3                   	ret
+
+0000000000800cee <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cee:	48 85 d2             	test   %rdx,%rdx
+  800cf1:	74 1f                	je     800d12 <strncmp+0x24>
+  800cf3:	0f b6 07             	movzbl (%rdi),%eax
+  800cf6:	84 c0                	test   %al,%al
+  800cf8:	74 1e                	je     800d18 <strncmp+0x2a>
+  800cfa:	3a 06                	cmp    (%rsi),%al
+  800cfc:	75 1a                	jne    800d18 <strncmp+0x2a>
+  800cfe:	48 83 c7 01          	add    $0x1,%rdi
+  800d02:	48 83 c6 01          	add    $0x1,%rsi
+  800d06:	48 83 ea 01          	sub    $0x1,%rdx
+  800d0a:	75 e7                	jne    800cf3 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d11:	c3                   	ret
+  800d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d17:	c3                   	ret
+  800d18:	48 85 d2             	test   %rdx,%rdx
+  800d1b:	74 09                	je     800d26 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d1d:	0f b6 07             	movzbl (%rdi),%eax
+  800d20:	0f b6 16             	movzbl (%rsi),%edx
+  800d23:	29 d0                	sub    %edx,%eax
+  800d25:	c3                   	ret
+    if (!n) return 0;
+  800d26:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d2b:	c3                   	ret
+
+0000000000800d2c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d2c:	0f b6 17             	movzbl (%rdi),%edx
+  800d2f:	84 d2                	test   %dl,%dl
+  800d31:	74 18                	je     800d4b <strchr+0x1f>
+        if (*str == c) {
+  800d33:	0f be d2             	movsbl %dl,%edx
+  800d36:	39 f2                	cmp    %esi,%edx
+  800d38:	74 17                	je     800d51 <strchr+0x25>
+    for (; *str; str++) {
+  800d3a:	48 83 c7 01          	add    $0x1,%rdi
+  800d3e:	0f b6 17             	movzbl (%rdi),%edx
+  800d41:	84 d2                	test   %dl,%dl
+  800d43:	75 ee                	jne    800d33 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4a:	c3                   	ret
+  800d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d50:	c3                   	ret
+  800d51:	48 89 f8             	mov    %rdi,%rax
+}
+  800d54:	c3                   	ret
+
+0000000000800d55 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d55:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d58:	0f b6 17             	movzbl (%rdi),%edx
+  800d5b:	84 d2                	test   %dl,%dl
+  800d5d:	74 13                	je     800d72 <strfind+0x1d>
+  800d5f:	0f be d2             	movsbl %dl,%edx
+  800d62:	39 f2                	cmp    %esi,%edx
+  800d64:	74 0b                	je     800d71 <strfind+0x1c>
+  800d66:	48 83 c0 01          	add    $0x1,%rax
+  800d6a:	0f b6 10             	movzbl (%rax),%edx
+  800d6d:	84 d2                	test   %dl,%dl
+  800d6f:	75 ee                	jne    800d5f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d71:	c3                   	ret
+  800d72:	c3                   	ret
+
+0000000000800d73 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800d73:	55                   	push   %rbp
+  800d74:	48 89 e5             	mov    %rsp,%rbp
+  800d77:	41 57                	push   %r15
+  800d79:	41 56                	push   %r14
+  800d7b:	41 55                	push   %r13
+  800d7d:	41 54                	push   %r12
+  800d7f:	53                   	push   %rbx
+  800d80:	48 83 ec 08          	sub    $0x8,%rsp
+  800d84:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800d87:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800d8b:	45 84 ed             	test   %r13b,%r13b
+  800d8e:	75 12                	jne    800da2 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800d90:	4c 89 f8             	mov    %r15,%rax
+  800d93:	48 83 c4 08          	add    $0x8,%rsp
+  800d97:	5b                   	pop    %rbx
+  800d98:	41 5c                	pop    %r12
+  800d9a:	41 5d                	pop    %r13
+  800d9c:	41 5e                	pop    %r14
+  800d9e:	41 5f                	pop    %r15
+  800da0:	5d                   	pop    %rbp
+  800da1:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800da2:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800da6:	4c 89 e7             	mov    %r12,%rdi
+  800da9:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  800db0:	00 00 00 
+  800db3:	ff d0                	call   *%rax
+  800db5:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800db8:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800dbc:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800dc0:	49 bf ee 0c 80 00 00 	movabs $0x800cee,%r15
+  800dc7:	00 00 00 
+				if ((sc = *s++) == 0)
+  800dca:	84 c0                	test   %al,%al
+  800dcc:	75 14                	jne    800de2 <strstr+0x6f>
+					return NULL;
+  800dce:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800dd4:	eb ba                	jmp    800d90 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800dd6:	48 83 c3 01          	add    $0x1,%rbx
+  800dda:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800dde:	84 c0                	test   %al,%al
+  800de0:	74 1b                	je     800dfd <strstr+0x8a>
+			} while (sc != c);
+  800de2:	41 38 c5             	cmp    %al,%r13b
+  800de5:	75 ef                	jne    800dd6 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800de7:	4c 89 f2             	mov    %r14,%rdx
+  800dea:	4c 89 e6             	mov    %r12,%rsi
+  800ded:	48 89 df             	mov    %rbx,%rdi
+  800df0:	41 ff d7             	call   *%r15
+  800df3:	85 c0                	test   %eax,%eax
+  800df5:	75 df                	jne    800dd6 <strstr+0x63>
+  800df7:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800dfb:	eb 93                	jmp    800d90 <strstr+0x1d>
+					return NULL;
+  800dfd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e03:	eb 8b                	jmp    800d90 <strstr+0x1d>
+
+0000000000800e05 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800e05:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800e07:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800e0a:	8d 57 20             	lea    0x20(%rdi),%edx
+  800e0d:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e10:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e13:	c3                   	ret
+
+0000000000800e14 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800e14:	55                   	push   %rbp
+  800e15:	48 89 e5             	mov    %rsp,%rbp
+  800e18:	41 57                	push   %r15
+  800e1a:	41 56                	push   %r14
+  800e1c:	41 55                	push   %r13
+  800e1e:	41 54                	push   %r12
+  800e20:	53                   	push   %rbx
+  800e21:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800e25:	48 39 f7             	cmp    %rsi,%rdi
+  800e28:	74 49                	je     800e73 <strcasecmp+0x5f>
+  800e2a:	49 89 fd             	mov    %rdi,%r13
+  800e2d:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800e30:	49 bf 05 0e 80 00 00 	movabs $0x800e05,%r15
+  800e37:	00 00 00 
+  800e3a:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800e3f:	41 0f b6 fe          	movzbl %r14b,%edi
+  800e43:	41 ff d7             	call   *%r15
+  800e46:	89 c3                	mov    %eax,%ebx
+  800e48:	49 83 c4 01          	add    $0x1,%r12
+  800e4c:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e52:	41 ff d7             	call   *%r15
+  800e55:	29 c3                	sub    %eax,%ebx
+  800e57:	75 09                	jne    800e62 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800e59:	49 83 c5 01          	add    $0x1,%r13
+  800e5d:	45 84 f6             	test   %r14b,%r14b
+  800e60:	75 d8                	jne    800e3a <strcasecmp+0x26>
+}
+  800e62:	89 d8                	mov    %ebx,%eax
+  800e64:	48 83 c4 08          	add    $0x8,%rsp
+  800e68:	5b                   	pop    %rbx
+  800e69:	41 5c                	pop    %r12
+  800e6b:	41 5d                	pop    %r13
+  800e6d:	41 5e                	pop    %r14
+  800e6f:	41 5f                	pop    %r15
+  800e71:	5d                   	pop    %rbp
+  800e72:	c3                   	ret
+        return 0;
+  800e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e78:	eb e8                	jmp    800e62 <strcasecmp+0x4e>
+
+0000000000800e7a <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800e7a:	55                   	push   %rbp
+  800e7b:	48 89 e5             	mov    %rsp,%rbp
+  800e7e:	41 57                	push   %r15
+  800e80:	41 56                	push   %r14
+  800e82:	41 55                	push   %r13
+  800e84:	41 54                	push   %r12
+  800e86:	53                   	push   %rbx
+  800e87:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800e8b:	48 85 d2             	test   %rdx,%rdx
+  800e8e:	74 4f                	je     800edf <strncasecmp+0x65>
+  800e90:	49 89 fc             	mov    %rdi,%r12
+  800e93:	49 89 f5             	mov    %rsi,%r13
+  800e96:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800e9a:	49 be 05 0e 80 00 00 	movabs $0x800e05,%r14
+  800ea1:	00 00 00 
+  800ea4:	49 83 c4 01          	add    $0x1,%r12
+  800ea8:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800eae:	41 ff d6             	call   *%r14
+  800eb1:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800eb3:	49 83 c5 01          	add    $0x1,%r13
+  800eb7:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800ebc:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800ebf:	29 c3                	sub    %eax,%ebx
+  800ec1:	85 c0                	test   %eax,%eax
+  800ec3:	74 09                	je     800ece <strncasecmp+0x54>
+  800ec5:	85 db                	test   %ebx,%ebx
+  800ec7:	75 05                	jne    800ece <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800ec9:	4d 39 fc             	cmp    %r15,%r12
+  800ecc:	75 d6                	jne    800ea4 <strncasecmp+0x2a>
+}
+  800ece:	89 d8                	mov    %ebx,%eax
+  800ed0:	48 83 c4 08          	add    $0x8,%rsp
+  800ed4:	5b                   	pop    %rbx
+  800ed5:	41 5c                	pop    %r12
+  800ed7:	41 5d                	pop    %r13
+  800ed9:	41 5e                	pop    %r14
+  800edb:	41 5f                	pop    %r15
+  800edd:	5d                   	pop    %rbp
+  800ede:	c3                   	ret
+    int d = 0;
+  800edf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800ee4:	eb e8                	jmp    800ece <strncasecmp+0x54>
+
+0000000000800ee6 <toupper>:
+
+int toupper(int c) {
+  800ee6:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800ee8:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800eeb:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800eee:	83 f9 1a             	cmp    $0x1a,%ecx
+  800ef1:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800ef4:	c3                   	ret
+
+0000000000800ef5 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800ef5:	83 ff 20             	cmp    $0x20,%edi
+  800ef8:	0f 94 c0             	sete   %al
+  800efb:	0f b6 c0             	movzbl %al,%eax
+}
+  800efe:	c3                   	ret
+
+0000000000800eff <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800eff:	89 f8                	mov    %edi,%eax
+  800f01:	f7 d8                	neg    %eax
+  800f03:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800f06:	c3                   	ret
+
+0000000000800f07 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f07:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f0a:	48 89 f8             	mov    %rdi,%rax
+  800f0d:	48 f7 d8             	neg    %rax
+  800f10:	83 e0 07             	and    $0x7,%eax
+  800f13:	49 89 d1             	mov    %rdx,%r9
+  800f16:	49 29 c1             	sub    %rax,%r9
+  800f19:	78 36                	js     800f51 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f1b:	40 0f b6 c6          	movzbl %sil,%eax
+  800f1f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f26:	01 01 01 
+  800f29:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f2d:	40 f6 c7 07          	test   $0x7,%dil
+  800f31:	75 38                	jne    800f6b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f33:	4c 89 c9             	mov    %r9,%rcx
+  800f36:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f3a:	74 0c                	je     800f48 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f3c:	fc                   	cld
+  800f3d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f40:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f44:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f48:	4d 85 c9             	test   %r9,%r9
+  800f4b:	75 45                	jne    800f92 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f4d:	4c 89 c0             	mov    %r8,%rax
+  800f50:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f51:	48 85 d2             	test   %rdx,%rdx
+  800f54:	74 f7                	je     800f4d <memset+0x46>
+  800f56:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f59:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f5c:	48 83 c0 01          	add    $0x1,%rax
+  800f60:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f64:	48 39 c2             	cmp    %rax,%rdx
+  800f67:	75 f3                	jne    800f5c <memset+0x55>
+  800f69:	eb e2                	jmp    800f4d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f6b:	40 f6 c7 01          	test   $0x1,%dil
+  800f6f:	74 06                	je     800f77 <memset+0x70>
+  800f71:	88 07                	mov    %al,(%rdi)
+  800f73:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f77:	40 f6 c7 02          	test   $0x2,%dil
+  800f7b:	74 07                	je     800f84 <memset+0x7d>
+  800f7d:	66 89 07             	mov    %ax,(%rdi)
+  800f80:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f84:	40 f6 c7 04          	test   $0x4,%dil
+  800f88:	74 a9                	je     800f33 <memset+0x2c>
+  800f8a:	89 07                	mov    %eax,(%rdi)
+  800f8c:	48 83 c7 04          	add    $0x4,%rdi
+  800f90:	eb a1                	jmp    800f33 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f92:	41 f6 c1 04          	test   $0x4,%r9b
+  800f96:	74 06                	je     800f9e <memset+0x97>
+  800f98:	89 07                	mov    %eax,(%rdi)
+  800f9a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f9e:	41 f6 c1 02          	test   $0x2,%r9b
+  800fa2:	74 07                	je     800fab <memset+0xa4>
+  800fa4:	66 89 07             	mov    %ax,(%rdi)
+  800fa7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800fab:	41 f6 c1 01          	test   $0x1,%r9b
+  800faf:	74 9c                	je     800f4d <memset+0x46>
+  800fb1:	88 07                	mov    %al,(%rdi)
+  800fb3:	eb 98                	jmp    800f4d <memset+0x46>
+
+0000000000800fb5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fb5:	48 89 f8             	mov    %rdi,%rax
+  800fb8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fbb:	48 39 fe             	cmp    %rdi,%rsi
+  800fbe:	73 3b                	jae    800ffb <memmove+0x46>
+  800fc0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fc4:	48 39 d7             	cmp    %rdx,%rdi
+  800fc7:	73 32                	jae    800ffb <memmove+0x46>
+        s += n;
+        d += n;
+  800fc9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fcd:	48 89 d6             	mov    %rdx,%rsi
+  800fd0:	48 09 fe             	or     %rdi,%rsi
+  800fd3:	48 09 ce             	or     %rcx,%rsi
+  800fd6:	40 f6 c6 07          	test   $0x7,%sil
+  800fda:	75 12                	jne    800fee <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fdc:	48 83 ef 08          	sub    $0x8,%rdi
+  800fe0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fe4:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fe8:	fd                   	std
+  800fe9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fec:	fc                   	cld
+  800fed:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fee:	48 83 ef 01          	sub    $0x1,%rdi
+  800ff2:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ff6:	fd                   	std
+  800ff7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ff9:	eb f1                	jmp    800fec <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ffb:	48 89 f2             	mov    %rsi,%rdx
+  800ffe:	48 09 c2             	or     %rax,%rdx
+  801001:	48 09 ca             	or     %rcx,%rdx
+  801004:	f6 c2 07             	test   $0x7,%dl
+  801007:	75 0c                	jne    801015 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801009:	48 c1 e9 03          	shr    $0x3,%rcx
+  80100d:	48 89 c7             	mov    %rax,%rdi
+  801010:	fc                   	cld
+  801011:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801014:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801015:	48 89 c7             	mov    %rax,%rdi
+  801018:	fc                   	cld
+  801019:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80101b:	c3                   	ret
+
+000000000080101c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80101c:	55                   	push   %rbp
+  80101d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801020:	48 b8 b5 0f 80 00 00 	movabs $0x800fb5,%rax
+  801027:	00 00 00 
+  80102a:	ff d0                	call   *%rax
+}
+  80102c:	5d                   	pop    %rbp
+  80102d:	c3                   	ret
+
+000000000080102e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80102e:	55                   	push   %rbp
+  80102f:	48 89 e5             	mov    %rsp,%rbp
+  801032:	41 57                	push   %r15
+  801034:	41 56                	push   %r14
+  801036:	41 55                	push   %r13
+  801038:	41 54                	push   %r12
+  80103a:	53                   	push   %rbx
+  80103b:	48 83 ec 08          	sub    $0x8,%rsp
+  80103f:	49 89 fe             	mov    %rdi,%r14
+  801042:	49 89 f7             	mov    %rsi,%r15
+  801045:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801048:	48 89 f7             	mov    %rsi,%rdi
+  80104b:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  801052:	00 00 00 
+  801055:	ff d0                	call   *%rax
+  801057:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80105a:	48 89 de             	mov    %rbx,%rsi
+  80105d:	4c 89 f7             	mov    %r14,%rdi
+  801060:	48 b8 04 0c 80 00 00 	movabs $0x800c04,%rax
+  801067:	00 00 00 
+  80106a:	ff d0                	call   *%rax
+  80106c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80106f:	48 39 c3             	cmp    %rax,%rbx
+  801072:	74 36                	je     8010aa <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801074:	48 89 d8             	mov    %rbx,%rax
+  801077:	4c 29 e8             	sub    %r13,%rax
+  80107a:	49 39 c4             	cmp    %rax,%r12
+  80107d:	73 31                	jae    8010b0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80107f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801084:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801088:	4c 89 fe             	mov    %r15,%rsi
+  80108b:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  801092:	00 00 00 
+  801095:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801097:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80109b:	48 83 c4 08          	add    $0x8,%rsp
+  80109f:	5b                   	pop    %rbx
+  8010a0:	41 5c                	pop    %r12
+  8010a2:	41 5d                	pop    %r13
+  8010a4:	41 5e                	pop    %r14
+  8010a6:	41 5f                	pop    %r15
+  8010a8:	5d                   	pop    %rbp
+  8010a9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010aa:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010ae:	eb eb                	jmp    80109b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010b0:	48 83 eb 01          	sub    $0x1,%rbx
+  8010b4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010b8:	48 89 da             	mov    %rbx,%rdx
+  8010bb:	4c 89 fe             	mov    %r15,%rsi
+  8010be:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  8010c5:	00 00 00 
+  8010c8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010ca:	49 01 de             	add    %rbx,%r14
+  8010cd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010d2:	eb c3                	jmp    801097 <strlcat+0x69>
+
+00000000008010d4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010d4:	48 85 d2             	test   %rdx,%rdx
+  8010d7:	74 2d                	je     801106 <memcmp+0x32>
+  8010d9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010de:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010e2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010e7:	44 38 c1             	cmp    %r8b,%cl
+  8010ea:	75 0f                	jne    8010fb <memcmp+0x27>
+    while (n-- > 0) {
+  8010ec:	48 83 c0 01          	add    $0x1,%rax
+  8010f0:	48 39 c2             	cmp    %rax,%rdx
+  8010f3:	75 e9                	jne    8010de <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010fa:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010fb:	0f b6 c1             	movzbl %cl,%eax
+  8010fe:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801102:	44 29 c0             	sub    %r8d,%eax
+  801105:	c3                   	ret
+    return 0;
+  801106:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80110b:	c3                   	ret
+
+000000000080110c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80110c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801110:	48 39 c7             	cmp    %rax,%rdi
+  801113:	73 0f                	jae    801124 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801115:	40 38 37             	cmp    %sil,(%rdi)
+  801118:	74 0e                	je     801128 <memfind+0x1c>
+    for (; src < end; src++) {
+  80111a:	48 83 c7 01          	add    $0x1,%rdi
+  80111e:	48 39 f8             	cmp    %rdi,%rax
+  801121:	75 f2                	jne    801115 <memfind+0x9>
+  801123:	c3                   	ret
+  801124:	48 89 f8             	mov    %rdi,%rax
+  801127:	c3                   	ret
+  801128:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80112b:	c3                   	ret
+
+000000000080112c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80112c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80112f:	0f b6 37             	movzbl (%rdi),%esi
+  801132:	40 80 fe 20          	cmp    $0x20,%sil
+  801136:	74 06                	je     80113e <strtol+0x12>
+  801138:	40 80 fe 09          	cmp    $0x9,%sil
+  80113c:	75 13                	jne    801151 <strtol+0x25>
+  80113e:	48 83 c7 01          	add    $0x1,%rdi
+  801142:	0f b6 37             	movzbl (%rdi),%esi
+  801145:	40 80 fe 20          	cmp    $0x20,%sil
+  801149:	74 f3                	je     80113e <strtol+0x12>
+  80114b:	40 80 fe 09          	cmp    $0x9,%sil
+  80114f:	74 ed                	je     80113e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801151:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801154:	83 e0 fd             	and    $0xfffffffd,%eax
+  801157:	3c 01                	cmp    $0x1,%al
+  801159:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80115d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801163:	75 0f                	jne    801174 <strtol+0x48>
+  801165:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801168:	74 14                	je     80117e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80116a:	85 d2                	test   %edx,%edx
+  80116c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801171:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801174:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801179:	4c 63 ca             	movslq %edx,%r9
+  80117c:	eb 36                	jmp    8011b4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80117e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801182:	74 0f                	je     801193 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801184:	85 d2                	test   %edx,%edx
+  801186:	75 ec                	jne    801174 <strtol+0x48>
+        s++;
+  801188:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80118c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801191:	eb e1                	jmp    801174 <strtol+0x48>
+        s += 2;
+  801193:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801197:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80119c:	eb d6                	jmp    801174 <strtol+0x48>
+            dig -= '0';
+  80119e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011a1:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011a5:	41 39 d0             	cmp    %edx,%r8d
+  8011a8:	7d 21                	jge    8011cb <strtol+0x9f>
+        val = val * base + dig;
+  8011aa:	49 0f af c1          	imul   %r9,%rax
+  8011ae:	0f b6 c9             	movzbl %cl,%ecx
+  8011b1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011b4:	48 83 c7 01          	add    $0x1,%rdi
+  8011b8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011bc:	80 f9 39             	cmp    $0x39,%cl
+  8011bf:	76 dd                	jbe    80119e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011c1:	80 f9 7b             	cmp    $0x7b,%cl
+  8011c4:	77 05                	ja     8011cb <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011c6:	83 e9 57             	sub    $0x57,%ecx
+  8011c9:	eb d6                	jmp    8011a1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011cb:	4d 85 d2             	test   %r10,%r10
+  8011ce:	74 03                	je     8011d3 <strtol+0xa7>
+  8011d0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011d3:	48 89 c2             	mov    %rax,%rdx
+  8011d6:	48 f7 da             	neg    %rdx
+  8011d9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011dd:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011e1:	c3                   	ret
+
+00000000008011e2 <atoi>:
+int atoi(const char *str) {
+  8011e2:	55                   	push   %rbp
+  8011e3:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8011e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f0:	48 b8 2c 11 80 00 00 	movabs $0x80112c,%rax
+  8011f7:	00 00 00 
+  8011fa:	ff d0                	call   *%rax
+}
+  8011fc:	5d                   	pop    %rbp
+  8011fd:	c3                   	ret
+
+00000000008011fe <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011fe:	55                   	push   %rbp
+  8011ff:	48 89 e5             	mov    %rsp,%rbp
+  801202:	53                   	push   %rbx
+  801203:	48 89 fa             	mov    %rdi,%rdx
+  801206:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801209:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80120e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801213:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801218:	be 00 00 00 00       	mov    $0x0,%esi
+  80121d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801223:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801225:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801229:	c9                   	leave
+  80122a:	c3                   	ret
+
+000000000080122b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80122b:	55                   	push   %rbp
+  80122c:	48 89 e5             	mov    %rsp,%rbp
+  80122f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801230:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801235:	ba 00 00 00 00       	mov    $0x0,%edx
+  80123a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80123f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801244:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801249:	be 00 00 00 00       	mov    $0x0,%esi
+  80124e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801254:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801256:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80125a:	c9                   	leave
+  80125b:	c3                   	ret
+
+000000000080125c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80125c:	55                   	push   %rbp
+  80125d:	48 89 e5             	mov    %rsp,%rbp
+  801260:	53                   	push   %rbx
+  801261:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801265:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801268:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80126d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801272:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801277:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80127c:	be 00 00 00 00       	mov    $0x0,%esi
+  801281:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801287:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801289:	48 85 c0             	test   %rax,%rax
+  80128c:	7f 06                	jg     801294 <sys_env_destroy+0x38>
+}
+  80128e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801292:	c9                   	leave
+  801293:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801294:	49 89 c0             	mov    %rax,%r8
+  801297:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80129c:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8012a3:	00 00 00 
+  8012a6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8012ab:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8012b2:	00 00 00 
+  8012b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ba:	49 b9 d7 43 80 00 00 	movabs $0x8043d7,%r9
+  8012c1:	00 00 00 
+  8012c4:	41 ff d1             	call   *%r9
+
+00000000008012c7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012c7:	55                   	push   %rbp
+  8012c8:	48 89 e5             	mov    %rsp,%rbp
+  8012cb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012cc:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f0:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f6:	c9                   	leave
+  8012f7:	c3                   	ret
+
+00000000008012f8 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012f8:	55                   	push   %rbp
+  8012f9:	48 89 e5             	mov    %rsp,%rbp
+  8012fc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fd:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801302:	ba 00 00 00 00       	mov    $0x0,%edx
+  801307:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80130c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801311:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801316:	be 00 00 00 00       	mov    $0x0,%esi
+  80131b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801321:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801323:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801327:	c9                   	leave
+  801328:	c3                   	ret
+
+0000000000801329 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801329:	55                   	push   %rbp
+  80132a:	48 89 e5             	mov    %rsp,%rbp
+  80132d:	53                   	push   %rbx
+  80132e:	48 89 fa             	mov    %rdi,%rdx
+  801331:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801334:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801339:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801340:	00 00 00 
+  801343:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801348:	be 00 00 00 00       	mov    $0x0,%esi
+  80134d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801353:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801355:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801359:	c9                   	leave
+  80135a:	c3                   	ret
+
+000000000080135b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80135b:	55                   	push   %rbp
+  80135c:	48 89 e5             	mov    %rsp,%rbp
+  80135f:	53                   	push   %rbx
+  801360:	49 89 f8             	mov    %rdi,%r8
+  801363:	48 89 d3             	mov    %rdx,%rbx
+  801366:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801369:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80136e:	4c 89 c2             	mov    %r8,%rdx
+  801371:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801374:	be 00 00 00 00       	mov    $0x0,%esi
+  801379:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801381:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801385:	c9                   	leave
+  801386:	c3                   	ret
+
+0000000000801387 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801387:	55                   	push   %rbp
+  801388:	48 89 e5             	mov    %rsp,%rbp
+  80138b:	53                   	push   %rbx
+  80138c:	48 83 ec 08          	sub    $0x8,%rsp
+  801390:	89 f8                	mov    %edi,%eax
+  801392:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801395:	48 63 f9             	movslq %ecx,%rdi
+  801398:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80139b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013a0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b0:	48 85 c0             	test   %rax,%rax
+  8013b3:	7f 06                	jg     8013bb <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b9:	c9                   	leave
+  8013ba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013bb:	49 89 c0             	mov    %rax,%r8
+  8013be:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013c3:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8013ca:	00 00 00 
+  8013cd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013d2:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8013d9:	00 00 00 
+  8013dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e1:	49 b9 d7 43 80 00 00 	movabs $0x8043d7,%r9
+  8013e8:	00 00 00 
+  8013eb:	41 ff d1             	call   *%r9
+
+00000000008013ee <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013ee:	55                   	push   %rbp
+  8013ef:	48 89 e5             	mov    %rsp,%rbp
+  8013f2:	53                   	push   %rbx
+  8013f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f7:	89 f8                	mov    %edi,%eax
+  8013f9:	49 89 f2             	mov    %rsi,%r10
+  8013fc:	48 89 cf             	mov    %rcx,%rdi
+  8013ff:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801402:	48 63 da             	movslq %edx,%rbx
+  801405:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801408:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140d:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801410:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801413:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801415:	48 85 c0             	test   %rax,%rax
+  801418:	7f 06                	jg     801420 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80141a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141e:	c9                   	leave
+  80141f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801420:	49 89 c0             	mov    %rax,%r8
+  801423:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801428:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80142f:	00 00 00 
+  801432:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801437:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80143e:	00 00 00 
+  801441:	b8 00 00 00 00       	mov    $0x0,%eax
+  801446:	49 b9 d7 43 80 00 00 	movabs $0x8043d7,%r9
+  80144d:	00 00 00 
+  801450:	41 ff d1             	call   *%r9
+
+0000000000801453 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801453:	55                   	push   %rbp
+  801454:	48 89 e5             	mov    %rsp,%rbp
+  801457:	53                   	push   %rbx
+  801458:	48 83 ec 08          	sub    $0x8,%rsp
+  80145c:	49 89 f9             	mov    %rdi,%r9
+  80145f:	89 f0                	mov    %esi,%eax
+  801461:	48 89 d3             	mov    %rdx,%rbx
+  801464:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801467:	49 63 f0             	movslq %r8d,%rsi
+  80146a:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80146d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801472:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801475:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80147b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80147d:	48 85 c0             	test   %rax,%rax
+  801480:	7f 06                	jg     801488 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801482:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801486:	c9                   	leave
+  801487:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801488:	49 89 c0             	mov    %rax,%r8
+  80148b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801490:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801497:	00 00 00 
+  80149a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80149f:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8014a6:	00 00 00 
+  8014a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ae:	49 b9 d7 43 80 00 00 	movabs $0x8043d7,%r9
+  8014b5:	00 00 00 
+  8014b8:	41 ff d1             	call   *%r9
+
+00000000008014bb <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8014bb:	55                   	push   %rbp
+  8014bc:	48 89 e5             	mov    %rsp,%rbp
+  8014bf:	53                   	push   %rbx
+  8014c0:	89 f8                	mov    %edi,%eax
+  8014c2:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8014c5:	48 63 f9             	movslq %ecx,%rdi
+  8014c8:	48 63 da             	movslq %edx,%rbx
+  8014cb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ce:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014d3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e1:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8014e3:	89 c2                	mov    %eax,%edx
+  8014e5:	48 85 c0             	test   %rax,%rax
+  8014e8:	78 0d                	js     8014f7 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8014ea:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8014ef:	4d 85 c9             	test   %r9,%r9
+  8014f2:	74 03                	je     8014f7 <sys_alloc_dma_region+0x3c>
+  8014f4:	49 89 01             	mov    %rax,(%r9)
+}
+  8014f7:	89 d0                	mov    %edx,%eax
+  8014f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fd:	c9                   	leave
+  8014fe:	c3                   	ret
+
+00000000008014ff <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8014ff:	55                   	push   %rbp
+  801500:	48 89 e5             	mov    %rsp,%rbp
+  801503:	53                   	push   %rbx
+  801504:	48 83 ec 08          	sub    $0x8,%rsp
+  801508:	48 89 f1             	mov    %rsi,%rcx
+  80150b:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80150e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801511:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801516:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151b:	be 00 00 00 00       	mov    $0x0,%esi
+  801520:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801526:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801528:	48 85 c0             	test   %rax,%rax
+  80152b:	7f 06                	jg     801533 <sys_set_cache_region+0x34>
+}
+  80152d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801531:	c9                   	leave
+  801532:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801533:	49 89 c0             	mov    %rax,%r8
+  801536:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80153b:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801542:	00 00 00 
+  801545:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80154a:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801551:	00 00 00 
+  801554:	b8 00 00 00 00       	mov    $0x0,%eax
+  801559:	49 b9 d7 43 80 00 00 	movabs $0x8043d7,%r9
+  801560:	00 00 00 
+  801563:	41 ff d1             	call   *%r9
+
+0000000000801566 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801566:	55                   	push   %rbp
+  801567:	48 89 e5             	mov    %rsp,%rbp
+  80156a:	53                   	push   %rbx
+  80156b:	48 83 ec 08          	sub    $0x8,%rsp
+  80156f:	48 89 f1             	mov    %rsi,%rcx
+  801572:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801575:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801578:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801582:	be 00 00 00 00       	mov    $0x0,%esi
+  801587:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80158f:	48 85 c0             	test   %rax,%rax
+  801592:	7f 06                	jg     80159a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801594:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801598:	c9                   	leave
+  801599:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159a:	49 89 c0             	mov    %rax,%r8
+  80159d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015a2:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8015a9:	00 00 00 
+  8015ac:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015b1:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8015b8:	00 00 00 
+  8015bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c0:	49 b9 d7 43 80 00 00 	movabs $0x8043d7,%r9
+  8015c7:	00 00 00 
+  8015ca:	41 ff d1             	call   *%r9
+
+00000000008015cd <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015cd:	55                   	push   %rbp
+  8015ce:	48 89 e5             	mov    %rsp,%rbp
+  8015d1:	53                   	push   %rbx
+  8015d2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015d6:	48 63 ce             	movslq %esi,%rcx
+  8015d9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015dc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f8:	48 85 c0             	test   %rax,%rax
+  8015fb:	7f 06                	jg     801603 <sys_env_set_status+0x36>
+}
+  8015fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801601:	c9                   	leave
+  801602:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801603:	49 89 c0             	mov    %rax,%r8
+  801606:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80160b:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801612:	00 00 00 
+  801615:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80161a:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801621:	00 00 00 
+  801624:	b8 00 00 00 00       	mov    $0x0,%eax
+  801629:	49 b9 d7 43 80 00 00 	movabs $0x8043d7,%r9
+  801630:	00 00 00 
+  801633:	41 ff d1             	call   *%r9
+
+0000000000801636 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801636:	55                   	push   %rbp
+  801637:	48 89 e5             	mov    %rsp,%rbp
+  80163a:	53                   	push   %rbx
+  80163b:	48 83 ec 08          	sub    $0x8,%rsp
+  80163f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801642:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801645:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80164a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801654:	be 00 00 00 00       	mov    $0x0,%esi
+  801659:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801661:	48 85 c0             	test   %rax,%rax
+  801664:	7f 06                	jg     80166c <sys_env_set_trapframe+0x36>
+}
+  801666:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166a:	c9                   	leave
+  80166b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80166c:	49 89 c0             	mov    %rax,%r8
+  80166f:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801674:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80167b:	00 00 00 
+  80167e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801683:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80168a:	00 00 00 
+  80168d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801692:	49 b9 d7 43 80 00 00 	movabs $0x8043d7,%r9
+  801699:	00 00 00 
+  80169c:	41 ff d1             	call   *%r9
+
+000000000080169f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+  8016a3:	53                   	push   %rbx
+  8016a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016ab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ae:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ca:	48 85 c0             	test   %rax,%rax
+  8016cd:	7f 06                	jg     8016d5 <sys_env_set_pgfault_upcall+0x36>
+}
+  8016cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d3:	c9                   	leave
+  8016d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d5:	49 89 c0             	mov    %rax,%r8
+  8016d8:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016dd:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8016e4:	00 00 00 
+  8016e7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016ec:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8016f3:	00 00 00 
+  8016f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fb:	49 b9 d7 43 80 00 00 	movabs $0x8043d7,%r9
+  801702:	00 00 00 
+  801705:	41 ff d1             	call   *%r9
+
+0000000000801708 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801708:	55                   	push   %rbp
+  801709:	48 89 e5             	mov    %rsp,%rbp
+  80170c:	53                   	push   %rbx
+  80170d:	89 f8                	mov    %edi,%eax
+  80170f:	49 89 f1             	mov    %rsi,%r9
+  801712:	48 89 d3             	mov    %rdx,%rbx
+  801715:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801718:	49 63 f0             	movslq %r8d,%rsi
+  80171b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80171e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801723:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801726:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172c:	cd 30                	int    $0x30
+}
+  80172e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801732:	c9                   	leave
+  801733:	c3                   	ret
+
+0000000000801734 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801734:	55                   	push   %rbp
+  801735:	48 89 e5             	mov    %rsp,%rbp
+  801738:	53                   	push   %rbx
+  801739:	48 83 ec 08          	sub    $0x8,%rsp
+  80173d:	48 89 fa             	mov    %rdi,%rdx
+  801740:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801743:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801748:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801752:	be 00 00 00 00       	mov    $0x0,%esi
+  801757:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80175d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80175f:	48 85 c0             	test   %rax,%rax
+  801762:	7f 06                	jg     80176a <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801764:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801768:	c9                   	leave
+  801769:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80176a:	49 89 c0             	mov    %rax,%r8
+  80176d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801772:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801779:	00 00 00 
+  80177c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801781:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801788:	00 00 00 
+  80178b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801790:	49 b9 d7 43 80 00 00 	movabs $0x8043d7,%r9
+  801797:	00 00 00 
+  80179a:	41 ff d1             	call   *%r9
+
+000000000080179d <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  80179d:	55                   	push   %rbp
+  80179e:	48 89 e5             	mov    %rsp,%rbp
+  8017a1:	53                   	push   %rbx
+  8017a2:	48 89 fa             	mov    %rdi,%rdx
+  8017a5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a8:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c2:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c8:	c9                   	leave
+  8017c9:	c3                   	ret
+
+00000000008017ca <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017ca:	55                   	push   %rbp
+  8017cb:	48 89 e5             	mov    %rsp,%rbp
+  8017ce:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017cf:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f3:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+
+00000000008017fb <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8017fb:	48 85 ff             	test   %rdi,%rdi
+  8017fe:	0f 84 b6 01 00 00    	je     8019ba <malloc+0x1bf>
+malloc(size_t size) {
+  801804:	55                   	push   %rbp
+  801805:	48 89 e5             	mov    %rsp,%rbp
+  801808:	41 56                	push   %r14
+  80180a:	41 55                	push   %r13
+  80180c:	41 54                	push   %r12
+  80180e:	53                   	push   %rbx
+  80180f:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801812:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801819:	00 00 00 
+  80181c:	4c 8b 20             	mov    (%rax),%r12
+  80181f:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801826:	0f 87 94 01 00 00    	ja     8019c0 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  80182c:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801833:	00 00 00 
+  801836:	48 85 c0             	test   %rax,%rax
+  801839:	74 6b                	je     8018a6 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  80183b:	4d 85 e4             	test   %r12,%r12
+  80183e:	74 66                	je     8018a6 <malloc+0xab>
+  801840:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801847:	00 00 00 
+  80184a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80184f:	eb 0d                	jmp    80185e <malloc+0x63>
+  801851:	48 83 c1 01          	add    $0x1,%rcx
+  801855:	48 83 c2 18          	add    $0x18,%rdx
+  801859:	49 39 cc             	cmp    %rcx,%r12
+  80185c:	74 48                	je     8018a6 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80185e:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801863:	74 ec                	je     801851 <malloc+0x56>
+  801865:	48 39 1a             	cmp    %rbx,(%rdx)
+  801868:	72 e7                	jb     801851 <malloc+0x56>
+                real_freep_size--;
+  80186a:	48 83 e8 01          	sub    $0x1,%rax
+  80186e:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801875:	00 00 00 
+                freep[i].is_free = false;
+  801878:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80187f:	00 00 00 
+  801882:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801886:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  80188a:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  80188e:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801895:	00 
+                freep[i].size = size;
+  801896:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  80189a:	48 01 c8             	add    %rcx,%rax
+  80189d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8018a1:	e9 0b 01 00 00       	jmp    8019b1 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8018a6:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8018ad:	00 00 00 
+  8018b0:	48 01 d8             	add    %rbx,%rax
+  8018b3:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8018b9:	76 7c                	jbe    801937 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8018bb:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8018c2:	00 00 00 
+  8018c5:	4c 8b 30             	mov    (%rax),%r14
+  8018c8:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8018cf:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8018d2:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8018d9:	00 00 00 
+  8018dc:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8018e3:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8018ea:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8018f0:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8018f4:	48 b8 c7 12 80 00 00 	movabs $0x8012c7,%rax
+  8018fb:	00 00 00 
+  8018fe:	ff d0                	call   *%rax
+  801900:	89 c7                	mov    %eax,%edi
+  801902:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801909:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801910:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801917:	00 00 00 
+  80191a:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80191e:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801923:	48 b8 87 13 80 00 00 	movabs $0x801387,%rax
+  80192a:	00 00 00 
+  80192d:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80192f:	85 c0                	test   %eax,%eax
+  801931:	0f 88 90 00 00 00    	js     8019c7 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801937:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  80193e:	00 00 00 
+  801941:	48 8b 31             	mov    (%rcx),%rsi
+  801944:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  80194b:	00 00 00 
+  80194e:	4c 8b 07             	mov    (%rdi),%r8
+  801951:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801955:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  80195c:	00 00 00 
+  80195f:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801963:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801967:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80196e:	00 00 00 
+  801971:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801975:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801978:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  80197c:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801983:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801984:	48 89 d8             	mov    %rbx,%rax
+  801987:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80198c:	4c 01 c0             	add    %r8,%rax
+  80198f:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801992:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801999:	48 01 f3             	add    %rsi,%rbx
+  80199c:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  80199f:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8019a4:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8019ab:	00 00 00 
+  8019ae:	48 89 d0             	mov    %rdx,%rax
+}
+  8019b1:	5b                   	pop    %rbx
+  8019b2:	41 5c                	pop    %r12
+  8019b4:	41 5d                	pop    %r13
+  8019b6:	41 5e                	pop    %r14
+  8019b8:	5d                   	pop    %rbp
+  8019b9:	c3                   	ret
+        return NULL;
+  8019ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019bf:	c3                   	ret
+        return NULL;
+  8019c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c5:	eb ea                	jmp    8019b1 <malloc+0x1b6>
+            return NULL;
+  8019c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cc:	eb e3                	jmp    8019b1 <malloc+0x1b6>
+
+00000000008019ce <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8019ce:	55                   	push   %rbp
+  8019cf:	48 89 e5             	mov    %rsp,%rbp
+  8019d2:	53                   	push   %rbx
+  8019d3:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8019d7:	48 89 fb             	mov    %rdi,%rbx
+  8019da:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8019de:	48 89 df             	mov    %rbx,%rdi
+  8019e1:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  8019e8:	00 00 00 
+  8019eb:	ff d0                	call   *%rax
+  8019ed:	48 89 c7             	mov    %rax,%rdi
+  8019f0:	48 89 da             	mov    %rbx,%rdx
+  8019f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8019f8:	48 b8 07 0f 80 00 00 	movabs $0x800f07,%rax
+  8019ff:	00 00 00 
+  801a02:	ff d0                	call   *%rax
+}
+  801a04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a08:	c9                   	leave
+  801a09:	c3                   	ret
+
+0000000000801a0a <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801a0a:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801a11:	00 00 00 
+  801a14:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801a1b:	00 00 00 
+  801a1e:	48 3b 02             	cmp    (%rdx),%rax
+  801a21:	74 4d                	je     801a70 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801a23:	48 85 c0             	test   %rax,%rax
+  801a26:	74 4d                	je     801a75 <get_allocsize+0x6b>
+  801a28:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801a2f:	00 00 00 
+  801a32:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801a37:	48 3b 39             	cmp    (%rcx),%rdi
+  801a3a:	74 13                	je     801a4f <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801a3c:	48 83 c2 01          	add    $0x1,%rdx
+  801a40:	48 83 c1 18          	add    $0x18,%rcx
+  801a44:	48 39 d0             	cmp    %rdx,%rax
+  801a47:	75 ee                	jne    801a37 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801a49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4e:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801a4f:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a58:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a5f:	00 00 00 
+  801a62:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a68:	75 0b                	jne    801a75 <get_allocsize+0x6b>
+  801a6a:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801a6f:	c3                   	ret
+        return 0;
+  801a70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a75:	c3                   	ret
+
+0000000000801a76 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801a76:	48 85 ff             	test   %rdi,%rdi
+  801a79:	0f 84 01 01 00 00    	je     801b80 <free+0x10a>
+free(void *ptr) {
+  801a7f:	55                   	push   %rbp
+  801a80:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801a83:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801a8a:	00 00 00 
+  801a8d:	48 8b 30             	mov    (%rax),%rsi
+  801a90:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801a97:	00 00 00 
+  801a9a:	48 39 c6             	cmp    %rax,%rsi
+  801a9d:	74 50                	je     801aef <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801a9f:	48 85 f6             	test   %rsi,%rsi
+  801aa2:	74 21                	je     801ac5 <free+0x4f>
+  801aa4:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801aab:	00 00 00 
+  801aae:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801ab3:	48 3b 39             	cmp    (%rcx),%rdi
+  801ab6:	74 61                	je     801b19 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801ab8:	48 83 c2 01          	add    $0x1,%rdx
+  801abc:	48 83 c1 18          	add    $0x18,%rcx
+  801ac0:	48 39 d6             	cmp    %rdx,%rsi
+  801ac3:	75 ee                	jne    801ab3 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801ac5:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  801acc:	00 00 00 
+  801acf:	be 12 01 00 00       	mov    $0x112,%esi
+  801ad4:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801adb:	00 00 00 
+  801ade:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae3:	48 b9 d7 43 80 00 00 	movabs $0x8043d7,%rcx
+  801aea:	00 00 00 
+  801aed:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801aef:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801af6:	00 00 00 
+  801af9:	be 06 01 00 00       	mov    $0x106,%esi
+  801afe:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801b05:	00 00 00 
+  801b08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0d:	48 b9 d7 43 80 00 00 	movabs $0x8043d7,%rcx
+  801b14:	00 00 00 
+  801b17:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801b19:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b1d:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801b24:	00 00 00 
+  801b27:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b2d:	75 27                	jne    801b56 <free+0xe0>
+            freep[i].is_free = true;
+  801b2f:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b33:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801b3a:	00 00 00 
+  801b3d:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801b44:	00 00 
+            real_freep_size++;
+  801b46:	48 83 c0 01          	add    $0x1,%rax
+  801b4a:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801b51:	00 00 00 
+}
+  801b54:	5d                   	pop    %rbp
+  801b55:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801b56:	48 ba a8 55 80 00 00 	movabs $0x8055a8,%rdx
+  801b5d:	00 00 00 
+  801b60:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801b65:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801b6c:	00 00 00 
+  801b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b74:	48 b9 d7 43 80 00 00 	movabs $0x8043d7,%rcx
+  801b7b:	00 00 00 
+  801b7e:	ff d1                	call   *%rcx
+  801b80:	c3                   	ret
+
+0000000000801b81 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801b81:	55                   	push   %rbp
+  801b82:	48 89 e5             	mov    %rsp,%rbp
+  801b85:	41 55                	push   %r13
+  801b87:	41 54                	push   %r12
+  801b89:	53                   	push   %rbx
+  801b8a:	48 83 ec 08          	sub    $0x8,%rsp
+  801b8e:	48 89 fb             	mov    %rdi,%rbx
+  801b91:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801b94:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  801b9b:	00 00 00 
+  801b9e:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801ba0:	49 39 c5             	cmp    %rax,%r13
+  801ba3:	73 0e                	jae    801bb3 <realloc+0x32>
+}
+  801ba5:	48 89 d8             	mov    %rbx,%rax
+  801ba8:	48 83 c4 08          	add    $0x8,%rsp
+  801bac:	5b                   	pop    %rbx
+  801bad:	41 5c                	pop    %r12
+  801baf:	41 5d                	pop    %r13
+  801bb1:	5d                   	pop    %rbp
+  801bb2:	c3                   	ret
+  801bb3:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801bb6:	4c 89 ef             	mov    %r13,%rdi
+  801bb9:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  801bc0:	00 00 00 
+  801bc3:	ff d0                	call   *%rax
+  801bc5:	48 89 c7             	mov    %rax,%rdi
+  801bc8:	4c 89 e2             	mov    %r12,%rdx
+  801bcb:	48 89 de             	mov    %rbx,%rsi
+  801bce:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  801bd5:	00 00 00 
+  801bd8:	ff d0                	call   *%rax
+  801bda:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801bdd:	48 89 df             	mov    %rbx,%rdi
+  801be0:	48 b8 76 1a 80 00 00 	movabs $0x801a76,%rax
+  801be7:	00 00 00 
+  801bea:	ff d0                	call   *%rax
+    return newptr;
+  801bec:	4c 89 e3             	mov    %r12,%rbx
+  801bef:	eb b4                	jmp    801ba5 <realloc+0x24>
+
+0000000000801bf1 <strdup>:
+
+char*
+strdup (const char *src) {
+  801bf1:	55                   	push   %rbp
+  801bf2:	48 89 e5             	mov    %rsp,%rbp
+  801bf5:	41 54                	push   %r12
+  801bf7:	53                   	push   %rbx
+  801bf8:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801bfb:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  801c02:	00 00 00 
+  801c05:	ff d0                	call   *%rax
+  801c07:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801c0b:	4c 89 e7             	mov    %r12,%rdi
+  801c0e:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  801c15:	00 00 00 
+  801c18:	ff d0                	call   *%rax
+  801c1a:	48 89 c7             	mov    %rax,%rdi
+  801c1d:	4c 89 e2             	mov    %r12,%rdx
+  801c20:	48 89 de             	mov    %rbx,%rsi
+  801c23:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  801c2a:	00 00 00 
+  801c2d:	ff d0                	call   *%rax
+}
+  801c2f:	5b                   	pop    %rbx
+  801c30:	41 5c                	pop    %r12
+  801c32:	5d                   	pop    %rbp
+  801c33:	c3                   	ret
+
+0000000000801c34 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801c34:	55                   	push   %rbp
+  801c35:	48 89 e5             	mov    %rsp,%rbp
+  801c38:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c39:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c43:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c4d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c52:	be 00 00 00 00       	mov    $0x0,%esi
+  801c57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c5d:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c63:	c9                   	leave
+  801c64:	c3                   	ret
+
+0000000000801c65 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801c65:	55                   	push   %rbp
+  801c66:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801c69:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c70:	00 00 00 
+  801c73:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c77:	74 26                	je     801c9f <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801c79:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c7b:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c7f:	89 c0                	mov    %eax,%eax
+  801c81:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801c84:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801c8b:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801c92:	00 00 00 
+  801c95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9a:	48 f7 31             	divq   (%rcx)
+}
+  801c9d:	5d                   	pop    %rbp
+  801c9e:	c3                   	ret
+        freq = get_cpufreq();
+  801c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca4:	48 ba 34 1c 80 00 00 	movabs $0x801c34,%rdx
+  801cab:	00 00 00 
+  801cae:	ff d2                	call   *%rdx
+  801cb0:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801cb7:	00 00 00 
+  801cba:	eb bd                	jmp    801c79 <get_ticks+0x14>
+
+0000000000801cbc <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801cbc:	55                   	push   %rbp
+  801cbd:	48 89 e5             	mov    %rsp,%rbp
+  801cc0:	53                   	push   %rbx
+  801cc1:	48 83 ec 08          	sub    $0x8,%rsp
+  801cc5:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801cc8:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801ccf:	00 00 00 
+  801cd2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801cd6:	74 50                	je     801d28 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801cd8:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801cda:	48 c1 e2 20          	shl    $0x20,%rdx
+  801cde:	89 c0                	mov    %eax,%eax
+  801ce0:	48 89 d6             	mov    %rdx,%rsi
+  801ce3:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801ce6:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801ced:	00 00 00 
+  801cf0:	48 0f af 18          	imul   (%rax),%rbx
+  801cf4:	48 c1 eb 03          	shr    $0x3,%rbx
+  801cf8:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801cff:	9b c4 20 
+  801d02:	48 89 d8             	mov    %rbx,%rax
+  801d05:	48 f7 e2             	mul    %rdx
+  801d08:	48 89 d1             	mov    %rdx,%rcx
+  801d0b:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801d0f:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d11:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d15:	89 c0                	mov    %eax,%eax
+  801d17:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801d1a:	48 29 f2             	sub    %rsi,%rdx
+  801d1d:	48 39 ca             	cmp    %rcx,%rdx
+  801d20:	72 ed                	jb     801d0f <sleep+0x53>
+}
+  801d22:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d26:	c9                   	leave
+  801d27:	c3                   	ret
+        freq = get_cpufreq();
+  801d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2d:	48 ba 34 1c 80 00 00 	movabs $0x801c34,%rdx
+  801d34:	00 00 00 
+  801d37:	ff d2                	call   *%rdx
+  801d39:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801d40:	00 00 00 
+  801d43:	eb 93                	jmp    801cd8 <sleep+0x1c>
+
+0000000000801d45 <poll_kbd>:
+
+int poll_kbd() {
+  801d45:	55                   	push   %rbp
+  801d46:	48 89 e5             	mov    %rsp,%rbp
+  801d49:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d4a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d54:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d5e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d63:	be 00 00 00 00       	mov    $0x0,%esi
+  801d68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d6e:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d74:	c9                   	leave
+  801d75:	c3                   	ret
+
+0000000000801d76 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801d76:	55                   	push   %rbp
+  801d77:	48 89 e5             	mov    %rsp,%rbp
+  801d7a:	53                   	push   %rbx
+  801d7b:	49 89 fa             	mov    %rdi,%r10
+  801d7e:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801d80:	44 89 c6             	mov    %r8d,%esi
+  801d83:	89 cf                	mov    %ecx,%edi
+  801d85:	89 d3                	mov    %edx,%ebx
+  801d87:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801d89:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d8e:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d91:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801d95:	cd 30                	int    $0x30
+  801d97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d9b:	c9                   	leave
+  801d9c:	c3                   	ret
+
+0000000000801d9d <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801d9d:	55                   	push   %rbp
+  801d9e:	48 89 e5             	mov    %rsp,%rbp
+  801da1:	41 54                	push   %r12
+  801da3:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  801da4:	48 b8 f9 37 80 00 00 	movabs $0x8037f9,%rax
+  801dab:	00 00 00 
+  801dae:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801db0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801db5:	cd 30                	int    $0x30
+  801db7:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801dba:	85 c0                	test   %eax,%eax
+  801dbc:	78 76                	js     801e34 <fork+0x97>
+        return envid;
+    if (!envid) {
+  801dbe:	74 7c                	je     801e3c <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801dc0:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801dc6:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801dcd:	00 00 00 
+  801dd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dd5:	89 c2                	mov    %eax,%edx
+  801dd7:	be 00 00 00 00       	mov    $0x0,%esi
+  801ddc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801de1:	48 b8 ee 13 80 00 00 	movabs $0x8013ee,%rax
+  801de8:	00 00 00 
+  801deb:	ff d0                	call   *%rax
+  801ded:	85 c0                	test   %eax,%eax
+  801def:	75 7c                	jne    801e6d <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801df1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801df8:	00 00 00 
+  801dfb:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801e02:	44 89 e7             	mov    %r12d,%edi
+  801e05:	48 b8 9f 16 80 00 00 	movabs $0x80169f,%rax
+  801e0c:	00 00 00 
+  801e0f:	ff d0                	call   *%rax
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	75 60                	jne    801e75 <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  801e15:	be 02 00 00 00       	mov    $0x2,%esi
+  801e1a:	44 89 e7             	mov    %r12d,%edi
+  801e1d:	48 b8 cd 15 80 00 00 	movabs $0x8015cd,%rax
+  801e24:	00 00 00 
+  801e27:	ff d0                	call   *%rax
+        return -1;
+  801e29:	85 c0                	test   %eax,%eax
+  801e2b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801e30:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  801e34:	44 89 e0             	mov    %r12d,%eax
+  801e37:	5b                   	pop    %rbx
+  801e38:	41 5c                	pop    %r12
+  801e3a:	5d                   	pop    %rbp
+  801e3b:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801e3c:	48 b8 c7 12 80 00 00 	movabs $0x8012c7,%rax
+  801e43:	00 00 00 
+  801e46:	ff d0                	call   *%rax
+  801e48:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e4d:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  801e54:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801e5b:	00 00 00 
+  801e5e:	48 01 d0             	add    %rdx,%rax
+  801e61:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  801e68:	00 00 00 
+        return 0;
+  801e6b:	eb c7                	jmp    801e34 <fork+0x97>
+        return -1;
+  801e6d:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e73:	eb bf                	jmp    801e34 <fork+0x97>
+  801e75:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e7b:	eb b7                	jmp    801e34 <fork+0x97>
+
+0000000000801e7d <sfork>:
+
+envid_t
+sfork() {
+  801e7d:	55                   	push   %rbp
+  801e7e:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801e81:	48 ba 06 56 80 00 00 	movabs $0x805606,%rdx
+  801e88:	00 00 00 
+  801e8b:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801e90:	48 bf 21 56 80 00 00 	movabs $0x805621,%rdi
+  801e97:	00 00 00 
+  801e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9f:	48 b9 d7 43 80 00 00 	movabs $0x8043d7,%rcx
+  801ea6:	00 00 00 
+  801ea9:	ff d1                	call   *%rcx
+
+0000000000801eab <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801eab:	55                   	push   %rbp
+  801eac:	48 89 e5             	mov    %rsp,%rbp
+  801eaf:	41 55                	push   %r13
+  801eb1:	41 54                	push   %r12
+  801eb3:	53                   	push   %rbx
+  801eb4:	48 83 ec 08          	sub    $0x8,%rsp
+  801eb8:	49 89 fc             	mov    %rdi,%r12
+  801ebb:	48 89 f7             	mov    %rsi,%rdi
+  801ebe:	48 89 d3             	mov    %rdx,%rbx
+  801ec1:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  801ec4:	48 85 f6             	test   %rsi,%rsi
+  801ec7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801ece:	00 00 00 
+  801ed1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  801ed5:	be 00 10 00 00       	mov    $0x1000,%esi
+  801eda:	48 85 d2             	test   %rdx,%rdx
+  801edd:	74 03                	je     801ee2 <ipc_recv+0x37>
+  801edf:	48 8b 32             	mov    (%rdx),%rsi
+  801ee2:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  801ee9:	00 00 00 
+  801eec:	ff d0                	call   *%rax
+    if (errno) {
+  801eee:	85 c0                	test   %eax,%eax
+  801ef0:	74 1c                	je     801f0e <ipc_recv+0x63>
+        if (from_env_store)
+  801ef2:	4d 85 e4             	test   %r12,%r12
+  801ef5:	74 08                	je     801eff <ipc_recv+0x54>
+            *from_env_store = 0;
+  801ef7:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801efe:	00 
+
+        if (perm_store)
+  801eff:	4d 85 ed             	test   %r13,%r13
+  801f02:	74 74                	je     801f78 <ipc_recv+0xcd>
+            *perm_store = 0;
+  801f04:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801f0b:	00 
+  801f0c:	eb 6a                	jmp    801f78 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  801f0e:	4d 85 e4             	test   %r12,%r12
+  801f11:	74 14                	je     801f27 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  801f13:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801f1a:	00 00 00 
+  801f1d:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  801f23:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  801f27:	48 85 db             	test   %rbx,%rbx
+  801f2a:	74 23                	je     801f4f <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801f2c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801f33:	00 00 00 
+  801f36:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  801f3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f41:	85 c9                	test   %ecx,%ecx
+  801f43:	74 07                	je     801f4c <ipc_recv+0xa1>
+  801f45:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  801f4c:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  801f4f:	4d 85 ed             	test   %r13,%r13
+  801f52:	74 14                	je     801f68 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  801f54:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801f5b:	00 00 00 
+  801f5e:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  801f64:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  801f68:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801f6f:	00 00 00 
+  801f72:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  801f78:	48 83 c4 08          	add    $0x8,%rsp
+  801f7c:	5b                   	pop    %rbx
+  801f7d:	41 5c                	pop    %r12
+  801f7f:	41 5d                	pop    %r13
+  801f81:	5d                   	pop    %rbp
+  801f82:	c3                   	ret
+
+0000000000801f83 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801f83:	55                   	push   %rbp
+  801f84:	48 89 e5             	mov    %rsp,%rbp
+  801f87:	41 55                	push   %r13
+  801f89:	41 54                	push   %r12
+  801f8b:	53                   	push   %rbx
+  801f8c:	48 83 ec 08          	sub    $0x8,%rsp
+  801f90:	49 89 fc             	mov    %rdi,%r12
+  801f93:	48 89 f7             	mov    %rsi,%rdi
+  801f96:	48 89 d3             	mov    %rdx,%rbx
+  801f99:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  801f9c:	48 85 f6             	test   %rsi,%rsi
+  801f9f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801fa6:	00 00 00 
+  801fa9:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  801fad:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fb2:	48 85 d2             	test   %rdx,%rdx
+  801fb5:	74 03                	je     801fba <ipc_try_recv+0x37>
+  801fb7:	48 8b 32             	mov    (%rdx),%rsi
+  801fba:	48 b8 9d 17 80 00 00 	movabs $0x80179d,%rax
+  801fc1:	00 00 00 
+  801fc4:	ff d0                	call   *%rax
+    if (errno) {
+  801fc6:	85 c0                	test   %eax,%eax
+  801fc8:	75 75                	jne    80203f <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  801fca:	4d 85 e4             	test   %r12,%r12
+  801fcd:	74 14                	je     801fe3 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  801fcf:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801fd6:	00 00 00 
+  801fd9:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  801fdf:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  801fe3:	48 85 db             	test   %rbx,%rbx
+  801fe6:	74 23                	je     80200b <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801fe8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801fef:	00 00 00 
+  801ff2:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  801ff8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ffd:	85 c9                	test   %ecx,%ecx
+  801fff:	74 07                	je     802008 <ipc_try_recv+0x85>
+  802001:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  802008:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80200b:	4d 85 ed             	test   %r13,%r13
+  80200e:	74 14                	je     802024 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  802010:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802017:	00 00 00 
+  80201a:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  802020:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  802024:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80202b:	00 00 00 
+  80202e:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  802034:	48 83 c4 08          	add    $0x8,%rsp
+  802038:	5b                   	pop    %rbx
+  802039:	41 5c                	pop    %r12
+  80203b:	41 5d                	pop    %r13
+  80203d:	5d                   	pop    %rbp
+  80203e:	c3                   	ret
+        if (from_env_store)
+  80203f:	4d 85 e4             	test   %r12,%r12
+  802042:	74 08                	je     80204c <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  802044:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80204b:	00 
+        if (perm_store)
+  80204c:	4d 85 ed             	test   %r13,%r13
+  80204f:	74 e3                	je     802034 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  802051:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802058:	00 
+  802059:	eb d9                	jmp    802034 <ipc_try_recv+0xb1>
+
+000000000080205b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80205b:	55                   	push   %rbp
+  80205c:	48 89 e5             	mov    %rsp,%rbp
+  80205f:	41 57                	push   %r15
+  802061:	41 56                	push   %r14
+  802063:	41 55                	push   %r13
+  802065:	41 54                	push   %r12
+  802067:	53                   	push   %rbx
+  802068:	48 83 ec 18          	sub    $0x18,%rsp
+  80206c:	41 89 fd             	mov    %edi,%r13d
+  80206f:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802072:	48 89 d3             	mov    %rdx,%rbx
+  802075:	49 89 cc             	mov    %rcx,%r12
+  802078:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80207c:	48 85 d2             	test   %rdx,%rdx
+  80207f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802086:	00 00 00 
+  802089:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80208d:	49 be 08 17 80 00 00 	movabs $0x801708,%r14
+  802094:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  802097:	49 bf f8 12 80 00 00 	movabs $0x8012f8,%r15
+  80209e:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8020a1:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8020a4:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8020a8:	4c 89 e1             	mov    %r12,%rcx
+  8020ab:	48 89 da             	mov    %rbx,%rdx
+  8020ae:	44 89 ef             	mov    %r13d,%edi
+  8020b1:	41 ff d6             	call   *%r14
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	74 37                	je     8020ef <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8020b8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8020bb:	75 05                	jne    8020c2 <ipc_send+0x67>
+        sys_yield();
+  8020bd:	41 ff d7             	call   *%r15
+  8020c0:	eb df                	jmp    8020a1 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8020c2:	89 c1                	mov    %eax,%ecx
+  8020c4:	48 ba 2c 56 80 00 00 	movabs $0x80562c,%rdx
+  8020cb:	00 00 00 
+  8020ce:	be 65 00 00 00       	mov    $0x65,%esi
+  8020d3:	48 bf 47 56 80 00 00 	movabs $0x805647,%rdi
+  8020da:	00 00 00 
+  8020dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e2:	49 b8 d7 43 80 00 00 	movabs $0x8043d7,%r8
+  8020e9:	00 00 00 
+  8020ec:	41 ff d0             	call   *%r8
+    }
+}
+  8020ef:	48 83 c4 18          	add    $0x18,%rsp
+  8020f3:	5b                   	pop    %rbx
+  8020f4:	41 5c                	pop    %r12
+  8020f6:	41 5d                	pop    %r13
+  8020f8:	41 5e                	pop    %r14
+  8020fa:	41 5f                	pop    %r15
+  8020fc:	5d                   	pop    %rbp
+  8020fd:	c3                   	ret
+
+00000000008020fe <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8020fe:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802103:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80210a:	00 00 00 
+  80210d:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  802114:	48 01 ca             	add    %rcx,%rdx
+  802117:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80211d:	39 fa                	cmp    %edi,%edx
+  80211f:	74 12                	je     802133 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802121:	48 83 c0 01          	add    $0x1,%rax
+  802125:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80212b:	75 e0                	jne    80210d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80212d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802132:	c3                   	ret
+            return envs[i].env_id;
+  802133:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80213a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802141:	00 00 00 
+  802144:	48 01 d0             	add    %rdx,%rax
+  802147:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80214d:	c3                   	ret
+
+000000000080214e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80214e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802155:	ff ff ff 
+  802158:	48 01 f8             	add    %rdi,%rax
+  80215b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80215f:	c3                   	ret
+
+0000000000802160 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802160:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802167:	ff ff ff 
+  80216a:	48 01 f8             	add    %rdi,%rax
+  80216d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802171:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802177:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80217b:	c3                   	ret
+
+000000000080217c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80217c:	55                   	push   %rbp
+  80217d:	48 89 e5             	mov    %rsp,%rbp
+  802180:	41 57                	push   %r15
+  802182:	41 56                	push   %r14
+  802184:	41 55                	push   %r13
+  802186:	41 54                	push   %r12
+  802188:	53                   	push   %rbx
+  802189:	48 83 ec 08          	sub    $0x8,%rsp
+  80218d:	49 89 ff             	mov    %rdi,%r15
+  802190:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802195:	49 bd 30 40 80 00 00 	movabs $0x804030,%r13
+  80219c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80219f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8021a5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8021a8:	48 89 df             	mov    %rbx,%rdi
+  8021ab:	41 ff d5             	call   *%r13
+  8021ae:	83 e0 04             	and    $0x4,%eax
+  8021b1:	74 17                	je     8021ca <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8021b3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8021ba:	4c 39 f3             	cmp    %r14,%rbx
+  8021bd:	75 e6                	jne    8021a5 <fd_alloc+0x29>
+  8021bf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8021c5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8021ca:	4d 89 27             	mov    %r12,(%r15)
+}
+  8021cd:	48 83 c4 08          	add    $0x8,%rsp
+  8021d1:	5b                   	pop    %rbx
+  8021d2:	41 5c                	pop    %r12
+  8021d4:	41 5d                	pop    %r13
+  8021d6:	41 5e                	pop    %r14
+  8021d8:	41 5f                	pop    %r15
+  8021da:	5d                   	pop    %rbp
+  8021db:	c3                   	ret
+
+00000000008021dc <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8021dc:	83 ff 1f             	cmp    $0x1f,%edi
+  8021df:	77 39                	ja     80221a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8021e1:	55                   	push   %rbp
+  8021e2:	48 89 e5             	mov    %rsp,%rbp
+  8021e5:	41 54                	push   %r12
+  8021e7:	53                   	push   %rbx
+  8021e8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8021eb:	48 63 df             	movslq %edi,%rbx
+  8021ee:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8021f5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8021f9:	48 89 df             	mov    %rbx,%rdi
+  8021fc:	48 b8 30 40 80 00 00 	movabs $0x804030,%rax
+  802203:	00 00 00 
+  802206:	ff d0                	call   *%rax
+  802208:	a8 04                	test   $0x4,%al
+  80220a:	74 14                	je     802220 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80220c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802210:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802215:	5b                   	pop    %rbx
+  802216:	41 5c                	pop    %r12
+  802218:	5d                   	pop    %rbp
+  802219:	c3                   	ret
+        return -E_INVAL;
+  80221a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80221f:	c3                   	ret
+        return -E_INVAL;
+  802220:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802225:	eb ee                	jmp    802215 <fd_lookup+0x39>
+
+0000000000802227 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802227:	55                   	push   %rbp
+  802228:	48 89 e5             	mov    %rsp,%rbp
+  80222b:	41 54                	push   %r12
+  80222d:	53                   	push   %rbx
+  80222e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802231:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  802238:	00 00 00 
+  80223b:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802242:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802245:	39 3b                	cmp    %edi,(%rbx)
+  802247:	74 47                	je     802290 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802249:	48 83 c0 08          	add    $0x8,%rax
+  80224d:	48 8b 18             	mov    (%rax),%rbx
+  802250:	48 85 db             	test   %rbx,%rbx
+  802253:	75 f0                	jne    802245 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802255:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80225c:	00 00 00 
+  80225f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802265:	89 fa                	mov    %edi,%edx
+  802267:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  80226e:	00 00 00 
+  802271:	b8 00 00 00 00       	mov    $0x0,%eax
+  802276:	48 b9 af 02 80 00 00 	movabs $0x8002af,%rcx
+  80227d:	00 00 00 
+  802280:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802282:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802287:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80228b:	5b                   	pop    %rbx
+  80228c:	41 5c                	pop    %r12
+  80228e:	5d                   	pop    %rbp
+  80228f:	c3                   	ret
+            return 0;
+  802290:	b8 00 00 00 00       	mov    $0x0,%eax
+  802295:	eb f0                	jmp    802287 <dev_lookup+0x60>
+
+0000000000802297 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802297:	55                   	push   %rbp
+  802298:	48 89 e5             	mov    %rsp,%rbp
+  80229b:	41 55                	push   %r13
+  80229d:	41 54                	push   %r12
+  80229f:	53                   	push   %rbx
+  8022a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8022a4:	48 89 fb             	mov    %rdi,%rbx
+  8022a7:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022aa:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8022b1:	ff ff ff 
+  8022b4:	48 01 df             	add    %rbx,%rdi
+  8022b7:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8022bb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022bf:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  8022c6:	00 00 00 
+  8022c9:	ff d0                	call   *%rax
+  8022cb:	41 89 c5             	mov    %eax,%r13d
+  8022ce:	85 c0                	test   %eax,%eax
+  8022d0:	78 06                	js     8022d8 <fd_close+0x41>
+  8022d2:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8022d6:	74 1a                	je     8022f2 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8022d8:	45 84 e4             	test   %r12b,%r12b
+  8022db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e0:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8022e4:	44 89 e8             	mov    %r13d,%eax
+  8022e7:	48 83 c4 18          	add    $0x18,%rsp
+  8022eb:	5b                   	pop    %rbx
+  8022ec:	41 5c                	pop    %r12
+  8022ee:	41 5d                	pop    %r13
+  8022f0:	5d                   	pop    %rbp
+  8022f1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8022f2:	8b 3b                	mov    (%rbx),%edi
+  8022f4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022f8:	48 b8 27 22 80 00 00 	movabs $0x802227,%rax
+  8022ff:	00 00 00 
+  802302:	ff d0                	call   *%rax
+  802304:	41 89 c5             	mov    %eax,%r13d
+  802307:	85 c0                	test   %eax,%eax
+  802309:	78 1b                	js     802326 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80230b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80230f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802313:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802319:	48 85 c0             	test   %rax,%rax
+  80231c:	74 08                	je     802326 <fd_close+0x8f>
+  80231e:	48 89 df             	mov    %rbx,%rdi
+  802321:	ff d0                	call   *%rax
+  802323:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802326:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80232b:	48 89 de             	mov    %rbx,%rsi
+  80232e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802333:	48 b8 66 15 80 00 00 	movabs $0x801566,%rax
+  80233a:	00 00 00 
+  80233d:	ff d0                	call   *%rax
+    return res;
+  80233f:	eb a3                	jmp    8022e4 <fd_close+0x4d>
+
+0000000000802341 <close>:
+
+int
+close(int fdnum) {
+  802341:	55                   	push   %rbp
+  802342:	48 89 e5             	mov    %rsp,%rbp
+  802345:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802349:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80234d:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  802354:	00 00 00 
+  802357:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802359:	85 c0                	test   %eax,%eax
+  80235b:	78 15                	js     802372 <close+0x31>
+
+    return fd_close(fd, 1);
+  80235d:	be 01 00 00 00       	mov    $0x1,%esi
+  802362:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802366:	48 b8 97 22 80 00 00 	movabs $0x802297,%rax
+  80236d:	00 00 00 
+  802370:	ff d0                	call   *%rax
+}
+  802372:	c9                   	leave
+  802373:	c3                   	ret
+
+0000000000802374 <close_all>:
+
+void
+close_all(void) {
+  802374:	55                   	push   %rbp
+  802375:	48 89 e5             	mov    %rsp,%rbp
+  802378:	41 54                	push   %r12
+  80237a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80237b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802380:	49 bc 41 23 80 00 00 	movabs $0x802341,%r12
+  802387:	00 00 00 
+  80238a:	89 df                	mov    %ebx,%edi
+  80238c:	41 ff d4             	call   *%r12
+  80238f:	83 c3 01             	add    $0x1,%ebx
+  802392:	83 fb 20             	cmp    $0x20,%ebx
+  802395:	75 f3                	jne    80238a <close_all+0x16>
+}
+  802397:	5b                   	pop    %rbx
+  802398:	41 5c                	pop    %r12
+  80239a:	5d                   	pop    %rbp
+  80239b:	c3                   	ret
+
+000000000080239c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80239c:	55                   	push   %rbp
+  80239d:	48 89 e5             	mov    %rsp,%rbp
+  8023a0:	41 57                	push   %r15
+  8023a2:	41 56                	push   %r14
+  8023a4:	41 55                	push   %r13
+  8023a6:	41 54                	push   %r12
+  8023a8:	53                   	push   %rbx
+  8023a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8023ad:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8023b0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8023b4:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  8023bb:	00 00 00 
+  8023be:	ff d0                	call   *%rax
+  8023c0:	89 c3                	mov    %eax,%ebx
+  8023c2:	85 c0                	test   %eax,%eax
+  8023c4:	0f 88 b8 00 00 00    	js     802482 <dup+0xe6>
+    close(newfdnum);
+  8023ca:	44 89 e7             	mov    %r12d,%edi
+  8023cd:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  8023d4:	00 00 00 
+  8023d7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8023d9:	4d 63 ec             	movslq %r12d,%r13
+  8023dc:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8023e3:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8023e7:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8023eb:	4c 89 ff             	mov    %r15,%rdi
+  8023ee:	49 be 60 21 80 00 00 	movabs $0x802160,%r14
+  8023f5:	00 00 00 
+  8023f8:	41 ff d6             	call   *%r14
+  8023fb:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8023fe:	4c 89 ef             	mov    %r13,%rdi
+  802401:	41 ff d6             	call   *%r14
+  802404:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802407:	48 89 df             	mov    %rbx,%rdi
+  80240a:	48 b8 30 40 80 00 00 	movabs $0x804030,%rax
+  802411:	00 00 00 
+  802414:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802416:	a8 04                	test   $0x4,%al
+  802418:	74 2b                	je     802445 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80241a:	41 89 c1             	mov    %eax,%r9d
+  80241d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802423:	4c 89 f1             	mov    %r14,%rcx
+  802426:	ba 00 00 00 00       	mov    $0x0,%edx
+  80242b:	48 89 de             	mov    %rbx,%rsi
+  80242e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802433:	48 b8 ee 13 80 00 00 	movabs $0x8013ee,%rax
+  80243a:	00 00 00 
+  80243d:	ff d0                	call   *%rax
+  80243f:	89 c3                	mov    %eax,%ebx
+  802441:	85 c0                	test   %eax,%eax
+  802443:	78 4e                	js     802493 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802445:	4c 89 ff             	mov    %r15,%rdi
+  802448:	48 b8 30 40 80 00 00 	movabs $0x804030,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+  802454:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802457:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80245d:	4c 89 e9             	mov    %r13,%rcx
+  802460:	ba 00 00 00 00       	mov    $0x0,%edx
+  802465:	4c 89 fe             	mov    %r15,%rsi
+  802468:	bf 00 00 00 00       	mov    $0x0,%edi
+  80246d:	48 b8 ee 13 80 00 00 	movabs $0x8013ee,%rax
+  802474:	00 00 00 
+  802477:	ff d0                	call   *%rax
+  802479:	89 c3                	mov    %eax,%ebx
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	78 14                	js     802493 <dup+0xf7>
+
+    return newfdnum;
+  80247f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802482:	89 d8                	mov    %ebx,%eax
+  802484:	48 83 c4 18          	add    $0x18,%rsp
+  802488:	5b                   	pop    %rbx
+  802489:	41 5c                	pop    %r12
+  80248b:	41 5d                	pop    %r13
+  80248d:	41 5e                	pop    %r14
+  80248f:	41 5f                	pop    %r15
+  802491:	5d                   	pop    %rbp
+  802492:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802493:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802498:	4c 89 ee             	mov    %r13,%rsi
+  80249b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a0:	49 bc 66 15 80 00 00 	movabs $0x801566,%r12
+  8024a7:	00 00 00 
+  8024aa:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8024ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024b2:	4c 89 f6             	mov    %r14,%rsi
+  8024b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ba:	41 ff d4             	call   *%r12
+    return res;
+  8024bd:	eb c3                	jmp    802482 <dup+0xe6>
+
+00000000008024bf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8024bf:	55                   	push   %rbp
+  8024c0:	48 89 e5             	mov    %rsp,%rbp
+  8024c3:	41 56                	push   %r14
+  8024c5:	41 55                	push   %r13
+  8024c7:	41 54                	push   %r12
+  8024c9:	53                   	push   %rbx
+  8024ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ce:	89 fb                	mov    %edi,%ebx
+  8024d0:	49 89 f4             	mov    %rsi,%r12
+  8024d3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024d6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024da:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  8024e1:	00 00 00 
+  8024e4:	ff d0                	call   *%rax
+  8024e6:	85 c0                	test   %eax,%eax
+  8024e8:	78 4c                	js     802536 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024ea:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8024ee:	41 8b 3e             	mov    (%r14),%edi
+  8024f1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024f5:	48 b8 27 22 80 00 00 	movabs $0x802227,%rax
+  8024fc:	00 00 00 
+  8024ff:	ff d0                	call   *%rax
+  802501:	85 c0                	test   %eax,%eax
+  802503:	78 35                	js     80253a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802505:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802509:	83 e0 03             	and    $0x3,%eax
+  80250c:	83 f8 01             	cmp    $0x1,%eax
+  80250f:	74 2d                	je     80253e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802511:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802515:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802519:	48 85 c0             	test   %rax,%rax
+  80251c:	74 56                	je     802574 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80251e:	4c 89 ea             	mov    %r13,%rdx
+  802521:	4c 89 e6             	mov    %r12,%rsi
+  802524:	4c 89 f7             	mov    %r14,%rdi
+  802527:	ff d0                	call   *%rax
+}
+  802529:	48 83 c4 10          	add    $0x10,%rsp
+  80252d:	5b                   	pop    %rbx
+  80252e:	41 5c                	pop    %r12
+  802530:	41 5d                	pop    %r13
+  802532:	41 5e                	pop    %r14
+  802534:	5d                   	pop    %rbp
+  802535:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802536:	48 98                	cltq
+  802538:	eb ef                	jmp    802529 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80253a:	48 98                	cltq
+  80253c:	eb eb                	jmp    802529 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80253e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802545:	00 00 00 
+  802548:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80254e:	89 da                	mov    %ebx,%edx
+  802550:	48 bf 99 56 80 00 00 	movabs $0x805699,%rdi
+  802557:	00 00 00 
+  80255a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255f:	48 b9 af 02 80 00 00 	movabs $0x8002af,%rcx
+  802566:	00 00 00 
+  802569:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80256b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802572:	eb b5                	jmp    802529 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802574:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80257b:	eb ac                	jmp    802529 <read+0x6a>
+
+000000000080257d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80257d:	55                   	push   %rbp
+  80257e:	48 89 e5             	mov    %rsp,%rbp
+  802581:	41 57                	push   %r15
+  802583:	41 56                	push   %r14
+  802585:	41 55                	push   %r13
+  802587:	41 54                	push   %r12
+  802589:	53                   	push   %rbx
+  80258a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80258e:	48 85 d2             	test   %rdx,%rdx
+  802591:	74 54                	je     8025e7 <readn+0x6a>
+  802593:	41 89 fd             	mov    %edi,%r13d
+  802596:	49 89 f6             	mov    %rsi,%r14
+  802599:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80259c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8025a1:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8025a6:	49 bf bf 24 80 00 00 	movabs $0x8024bf,%r15
+  8025ad:	00 00 00 
+  8025b0:	4c 89 e2             	mov    %r12,%rdx
+  8025b3:	48 29 f2             	sub    %rsi,%rdx
+  8025b6:	4c 01 f6             	add    %r14,%rsi
+  8025b9:	44 89 ef             	mov    %r13d,%edi
+  8025bc:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8025bf:	85 c0                	test   %eax,%eax
+  8025c1:	78 20                	js     8025e3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8025c3:	01 c3                	add    %eax,%ebx
+  8025c5:	85 c0                	test   %eax,%eax
+  8025c7:	74 08                	je     8025d1 <readn+0x54>
+  8025c9:	48 63 f3             	movslq %ebx,%rsi
+  8025cc:	4c 39 e6             	cmp    %r12,%rsi
+  8025cf:	72 df                	jb     8025b0 <readn+0x33>
+    }
+    return res;
+  8025d1:	48 63 c3             	movslq %ebx,%rax
+}
+  8025d4:	48 83 c4 08          	add    $0x8,%rsp
+  8025d8:	5b                   	pop    %rbx
+  8025d9:	41 5c                	pop    %r12
+  8025db:	41 5d                	pop    %r13
+  8025dd:	41 5e                	pop    %r14
+  8025df:	41 5f                	pop    %r15
+  8025e1:	5d                   	pop    %rbp
+  8025e2:	c3                   	ret
+        if (inc < 0) return inc;
+  8025e3:	48 98                	cltq
+  8025e5:	eb ed                	jmp    8025d4 <readn+0x57>
+    int inc = 1, res = 0;
+  8025e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025ec:	eb e3                	jmp    8025d1 <readn+0x54>
+
+00000000008025ee <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8025ee:	55                   	push   %rbp
+  8025ef:	48 89 e5             	mov    %rsp,%rbp
+  8025f2:	41 56                	push   %r14
+  8025f4:	41 55                	push   %r13
+  8025f6:	41 54                	push   %r12
+  8025f8:	53                   	push   %rbx
+  8025f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8025fd:	89 fb                	mov    %edi,%ebx
+  8025ff:	49 89 f4             	mov    %rsi,%r12
+  802602:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802605:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802609:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  802610:	00 00 00 
+  802613:	ff d0                	call   *%rax
+  802615:	85 c0                	test   %eax,%eax
+  802617:	78 47                	js     802660 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802619:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80261d:	41 8b 3e             	mov    (%r14),%edi
+  802620:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802624:	48 b8 27 22 80 00 00 	movabs $0x802227,%rax
+  80262b:	00 00 00 
+  80262e:	ff d0                	call   *%rax
+  802630:	85 c0                	test   %eax,%eax
+  802632:	78 30                	js     802664 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802634:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802639:	74 2d                	je     802668 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80263b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80263f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802643:	48 85 c0             	test   %rax,%rax
+  802646:	74 56                	je     80269e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802648:	4c 89 ea             	mov    %r13,%rdx
+  80264b:	4c 89 e6             	mov    %r12,%rsi
+  80264e:	4c 89 f7             	mov    %r14,%rdi
+  802651:	ff d0                	call   *%rax
+}
+  802653:	48 83 c4 10          	add    $0x10,%rsp
+  802657:	5b                   	pop    %rbx
+  802658:	41 5c                	pop    %r12
+  80265a:	41 5d                	pop    %r13
+  80265c:	41 5e                	pop    %r14
+  80265e:	5d                   	pop    %rbp
+  80265f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802660:	48 98                	cltq
+  802662:	eb ef                	jmp    802653 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802664:	48 98                	cltq
+  802666:	eb eb                	jmp    802653 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802668:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80266f:	00 00 00 
+  802672:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802678:	89 da                	mov    %ebx,%edx
+  80267a:	48 bf b5 56 80 00 00 	movabs $0x8056b5,%rdi
+  802681:	00 00 00 
+  802684:	b8 00 00 00 00       	mov    $0x0,%eax
+  802689:	48 b9 af 02 80 00 00 	movabs $0x8002af,%rcx
+  802690:	00 00 00 
+  802693:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802695:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80269c:	eb b5                	jmp    802653 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80269e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8026a5:	eb ac                	jmp    802653 <write+0x65>
+
+00000000008026a7 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8026a7:	55                   	push   %rbp
+  8026a8:	48 89 e5             	mov    %rsp,%rbp
+  8026ab:	53                   	push   %rbx
+  8026ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8026b0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026b2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026b6:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  8026bd:	00 00 00 
+  8026c0:	ff d0                	call   *%rax
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	78 0c                	js     8026d2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8026c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026ca:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8026cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026d6:	c9                   	leave
+  8026d7:	c3                   	ret
+
+00000000008026d8 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8026d8:	55                   	push   %rbp
+  8026d9:	48 89 e5             	mov    %rsp,%rbp
+  8026dc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8026e0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026e4:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  8026eb:	00 00 00 
+  8026ee:	ff d0                	call   *%rax
+  8026f0:	85 c0                	test   %eax,%eax
+  8026f2:	78 07                	js     8026fb <tell+0x23>
+    return fdes->fd_offset;
+  8026f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026f8:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8026fb:	c9                   	leave
+  8026fc:	c3                   	ret
+
+00000000008026fd <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8026fd:	55                   	push   %rbp
+  8026fe:	48 89 e5             	mov    %rsp,%rbp
+  802701:	41 55                	push   %r13
+  802703:	41 54                	push   %r12
+  802705:	53                   	push   %rbx
+  802706:	48 83 ec 18          	sub    $0x18,%rsp
+  80270a:	89 fb                	mov    %edi,%ebx
+  80270c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80270f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802713:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  80271a:	00 00 00 
+  80271d:	ff d0                	call   *%rax
+  80271f:	85 c0                	test   %eax,%eax
+  802721:	78 38                	js     80275b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802723:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802727:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80272b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80272f:	48 b8 27 22 80 00 00 	movabs $0x802227,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+  80273b:	85 c0                	test   %eax,%eax
+  80273d:	78 1c                	js     80275b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80273f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802744:	74 20                	je     802766 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802746:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80274a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80274e:	48 85 c0             	test   %rax,%rax
+  802751:	74 47                	je     80279a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802753:	44 89 e6             	mov    %r12d,%esi
+  802756:	4c 89 ef             	mov    %r13,%rdi
+  802759:	ff d0                	call   *%rax
+}
+  80275b:	48 83 c4 18          	add    $0x18,%rsp
+  80275f:	5b                   	pop    %rbx
+  802760:	41 5c                	pop    %r12
+  802762:	41 5d                	pop    %r13
+  802764:	5d                   	pop    %rbp
+  802765:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802766:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80276d:	00 00 00 
+  802770:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802776:	89 da                	mov    %ebx,%edx
+  802778:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  80277f:	00 00 00 
+  802782:	b8 00 00 00 00       	mov    $0x0,%eax
+  802787:	48 b9 af 02 80 00 00 	movabs $0x8002af,%rcx
+  80278e:	00 00 00 
+  802791:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802793:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802798:	eb c1                	jmp    80275b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80279a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80279f:	eb ba                	jmp    80275b <ftruncate+0x5e>
+
+00000000008027a1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8027a1:	55                   	push   %rbp
+  8027a2:	48 89 e5             	mov    %rsp,%rbp
+  8027a5:	41 54                	push   %r12
+  8027a7:	53                   	push   %rbx
+  8027a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8027ac:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027af:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027b3:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  8027ba:	00 00 00 
+  8027bd:	ff d0                	call   *%rax
+  8027bf:	85 c0                	test   %eax,%eax
+  8027c1:	78 4e                	js     802811 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027c3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8027c7:	41 8b 3c 24          	mov    (%r12),%edi
+  8027cb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8027cf:	48 b8 27 22 80 00 00 	movabs $0x802227,%rax
+  8027d6:	00 00 00 
+  8027d9:	ff d0                	call   *%rax
+  8027db:	85 c0                	test   %eax,%eax
+  8027dd:	78 32                	js     802811 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8027df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8027e3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8027e8:	74 30                	je     80281a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8027ea:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8027ed:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8027f4:	00 00 00 
+    stat->st_isdir = 0;
+  8027f7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027fe:	00 00 00 
+    stat->st_dev = dev;
+  802801:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802808:	48 89 de             	mov    %rbx,%rsi
+  80280b:	4c 89 e7             	mov    %r12,%rdi
+  80280e:	ff 50 28             	call   *0x28(%rax)
+}
+  802811:	48 83 c4 10          	add    $0x10,%rsp
+  802815:	5b                   	pop    %rbx
+  802816:	41 5c                	pop    %r12
+  802818:	5d                   	pop    %rbp
+  802819:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80281a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80281f:	eb f0                	jmp    802811 <fstat+0x70>
+
+0000000000802821 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802821:	55                   	push   %rbp
+  802822:	48 89 e5             	mov    %rsp,%rbp
+  802825:	41 54                	push   %r12
+  802827:	53                   	push   %rbx
+  802828:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80282f:	41 89 fc             	mov    %edi,%r12d
+  802832:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802834:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802838:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  80283f:	00 00 00 
+  802842:	ff d0                	call   *%rax
+  802844:	85 c0                	test   %eax,%eax
+  802846:	78 31                	js     802879 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802848:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80284f:	44 89 e7             	mov    %r12d,%edi
+  802852:	48 b8 a1 27 80 00 00 	movabs $0x8027a1,%rax
+  802859:	00 00 00 
+  80285c:	ff d0                	call   *%rax
+  80285e:	85 c0                	test   %eax,%eax
+  802860:	78 17                	js     802879 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802862:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802866:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802869:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80286c:	39 d3                	cmp    %edx,%ebx
+  80286e:	0f 4f da             	cmovg  %edx,%ebx
+  802871:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802874:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802879:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802880:	5b                   	pop    %rbx
+  802881:	41 5c                	pop    %r12
+  802883:	5d                   	pop    %rbp
+  802884:	c3                   	ret
+
+0000000000802885 <seektoend>:
+{
+  802885:	55                   	push   %rbp
+  802886:	48 89 e5             	mov    %rsp,%rbp
+  802889:	53                   	push   %rbx
+  80288a:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802891:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802893:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802897:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  80289e:	00 00 00 
+  8028a1:	ff d0                	call   *%rax
+  8028a3:	85 c0                	test   %eax,%eax
+  8028a5:	78 28                	js     8028cf <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8028a7:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8028ae:	89 df                	mov    %ebx,%edi
+  8028b0:	48 b8 a1 27 80 00 00 	movabs $0x8027a1,%rax
+  8028b7:	00 00 00 
+  8028ba:	ff d0                	call   *%rax
+  8028bc:	85 c0                	test   %eax,%eax
+  8028be:	78 0f                	js     8028cf <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8028c0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8028c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028c7:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8028ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028d3:	c9                   	leave
+  8028d4:	c3                   	ret
+
+00000000008028d5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8028d5:	55                   	push   %rbp
+  8028d6:	48 89 e5             	mov    %rsp,%rbp
+  8028d9:	41 54                	push   %r12
+  8028db:	53                   	push   %rbx
+  8028dc:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8028df:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e4:	48 b8 c8 34 80 00 00 	movabs $0x8034c8,%rax
+  8028eb:	00 00 00 
+  8028ee:	ff d0                	call   *%rax
+  8028f0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	78 25                	js     80291b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8028f6:	4c 89 e6             	mov    %r12,%rsi
+  8028f9:	89 c7                	mov    %eax,%edi
+  8028fb:	48 b8 a1 27 80 00 00 	movabs $0x8027a1,%rax
+  802902:	00 00 00 
+  802905:	ff d0                	call   *%rax
+  802907:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80290a:	89 df                	mov    %ebx,%edi
+  80290c:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  802913:	00 00 00 
+  802916:	ff d0                	call   *%rax
+
+    return res;
+  802918:	44 89 e3             	mov    %r12d,%ebx
+}
+  80291b:	89 d8                	mov    %ebx,%eax
+  80291d:	5b                   	pop    %rbx
+  80291e:	41 5c                	pop    %r12
+  802920:	5d                   	pop    %rbp
+  802921:	c3                   	ret
+
+0000000000802922 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802922:	55                   	push   %rbp
+  802923:	48 89 e5             	mov    %rsp,%rbp
+  802926:	53                   	push   %rbx
+  802927:	48 83 ec 08          	sub    $0x8,%rsp
+  80292b:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80292e:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  802935:	00 00 00 
+  802938:	ff d0                	call   *%rax
+  80293a:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80293e:	0f 87 ea 00 00 00    	ja     802a2e <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802944:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80294b:	00 00 00 
+  80294e:	80 38 00             	cmpb   $0x0,(%rax)
+  802951:	75 35                	jne    802988 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802953:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802958:	ba 00 00 22 00       	mov    $0x220000,%edx
+  80295d:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802962:	bf 00 00 00 00       	mov    $0x0,%edi
+  802967:	48 b8 87 13 80 00 00 	movabs $0x801387,%rax
+  80296e:	00 00 00 
+  802971:	ff d0                	call   *%rax
+  802973:	85 c0                	test   %eax,%eax
+  802975:	0f 88 ba 00 00 00    	js     802a35 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80297b:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802982:	00 00 00 
+  802985:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802988:	48 89 df             	mov    %rbx,%rdi
+  80298b:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  802992:	00 00 00 
+  802995:	ff d0                	call   *%rax
+  802997:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  80299b:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8029a2:	00 00 00 
+  8029a5:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8029a9:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8029ac:	39 39                	cmp    %edi,(%rcx)
+  8029ae:	74 46                	je     8029f6 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8029b0:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8029b4:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8029bb:	00 
+  8029bc:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8029c3:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8029ca:	00 
+  8029cb:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8029d2:	00 
+  8029d3:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8029da:	00 
+  8029db:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8029e2:	00 
+  8029e3:	89 39                	mov    %edi,(%rcx)
+  8029e5:	48 01 c6             	add    %rax,%rsi
+  8029e8:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8029ed:	48 89 c8             	mov    %rcx,%rax
+  8029f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029f4:	c9                   	leave
+  8029f5:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  8029f6:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8029fa:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802a01:	00 00 00 
+  802a04:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802a07:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802a0b:	74 e0                	je     8029ed <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802a0d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802a14:	00 
+  802a15:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802a19:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802a20:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802a22:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802a25:	48 01 c2             	add    %rax,%rdx
+  802a28:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802a2c:	eb bf                	jmp    8029ed <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802a2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a33:	eb b8                	jmp    8029ed <fbuf_get+0xcb>
+            return NULL;
+  802a35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a3a:	eb b1                	jmp    8029ed <fbuf_get+0xcb>
+
+0000000000802a3c <fsipc_bulk>:
+fsipc_bulk(void) {
+  802a3c:	55                   	push   %rbp
+  802a3d:	48 89 e5             	mov    %rsp,%rbp
+  802a40:	53                   	push   %rbx
+  802a41:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802a45:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a4c:	00 00 00 
+  802a4f:	48 8b 18             	mov    (%rax),%rbx
+  802a52:	48 85 db             	test   %rbx,%rbx
+  802a55:	74 16                	je     802a6d <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802a57:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a5e:	00 00 00 
+  802a61:	48 8b 18             	mov    (%rax),%rbx
+}
+  802a64:	48 89 d8             	mov    %rbx,%rax
+  802a67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a6b:	c9                   	leave
+  802a6c:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802a6d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a72:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802a77:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802a7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a81:	48 b8 87 13 80 00 00 	movabs $0x801387,%rax
+  802a88:	00 00 00 
+  802a8b:	ff d0                	call   *%rax
+  802a8d:	85 c0                	test   %eax,%eax
+  802a8f:	78 d3                	js     802a64 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802a91:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802a96:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802a9d:	00 00 00 
+  802aa0:	eb b5                	jmp    802a57 <fsipc_bulk+0x1b>
+
+0000000000802aa2 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802aa2:	55                   	push   %rbp
+  802aa3:	48 89 e5             	mov    %rsp,%rbp
+  802aa6:	41 57                	push   %r15
+  802aa8:	41 56                	push   %r14
+  802aaa:	41 55                	push   %r13
+  802aac:	41 54                	push   %r12
+  802aae:	53                   	push   %rbx
+  802aaf:	48 83 ec 08          	sub    $0x8,%rsp
+  802ab3:	41 89 fd             	mov    %edi,%r13d
+  802ab6:	49 89 f6             	mov    %rsi,%r14
+  802ab9:	49 89 d7             	mov    %rdx,%r15
+  802abc:	48 89 cb             	mov    %rcx,%rbx
+  802abf:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ac2:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802ac9:	00 00 00 
+  802acc:	83 38 00             	cmpl   $0x0,(%rax)
+  802acf:	74 52                	je     802b23 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802ad1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802ad7:	4c 89 f9             	mov    %r15,%rcx
+  802ada:	4c 89 f2             	mov    %r14,%rdx
+  802add:	44 89 ee             	mov    %r13d,%esi
+  802ae0:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802ae7:	00 00 00 
+  802aea:	8b 38                	mov    (%rax),%edi
+  802aec:	48 b8 5b 20 80 00 00 	movabs $0x80205b,%rax
+  802af3:	00 00 00 
+  802af6:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802af8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802afd:	4c 89 e2             	mov    %r12,%rdx
+  802b00:	48 89 de             	mov    %rbx,%rsi
+  802b03:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b08:	48 b8 ab 1e 80 00 00 	movabs $0x801eab,%rax
+  802b0f:	00 00 00 
+  802b12:	ff d0                	call   *%rax
+}
+  802b14:	48 83 c4 08          	add    $0x8,%rsp
+  802b18:	5b                   	pop    %rbx
+  802b19:	41 5c                	pop    %r12
+  802b1b:	41 5d                	pop    %r13
+  802b1d:	41 5e                	pop    %r14
+  802b1f:	41 5f                	pop    %r15
+  802b21:	5d                   	pop    %rbp
+  802b22:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b23:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b28:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  802b2f:	00 00 00 
+  802b32:	ff d0                	call   *%rax
+  802b34:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802b3b:	00 00 
+  802b3d:	eb 92                	jmp    802ad1 <fsipc_region+0x2f>
+
+0000000000802b3f <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802b3f:	55                   	push   %rbp
+  802b40:	48 89 e5             	mov    %rsp,%rbp
+  802b43:	41 57                	push   %r15
+  802b45:	41 56                	push   %r14
+  802b47:	41 55                	push   %r13
+  802b49:	41 54                	push   %r12
+  802b4b:	53                   	push   %rbx
+  802b4c:	48 83 ec 28          	sub    $0x28,%rsp
+  802b50:	49 89 ff             	mov    %rdi,%r15
+  802b53:	49 89 f6             	mov    %rsi,%r14
+  802b56:	48 89 d3             	mov    %rdx,%rbx
+  802b59:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802b5d:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802b60:	48 b8 3c 2a 80 00 00 	movabs $0x802a3c,%rax
+  802b67:	00 00 00 
+  802b6a:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802b6c:	48 85 c0             	test   %rax,%rax
+  802b6f:	0f 84 cc 00 00 00    	je     802c41 <devfile_write_direct+0x102>
+  802b75:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802b78:	48 85 db             	test   %rbx,%rbx
+  802b7b:	0f 84 ba 00 00 00    	je     802c3b <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802b81:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b87:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802b8e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802b92:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802b96:	4c 29 e3             	sub    %r12,%rbx
+  802b99:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802b9e:	48 39 c3             	cmp    %rax,%rbx
+  802ba1:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802ba5:	48 89 da             	mov    %rbx,%rdx
+  802ba8:	4c 89 f6             	mov    %r14,%rsi
+  802bab:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802baf:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  802bb6:	00 00 00 
+  802bb9:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802bbb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802bbf:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802bc3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802bc6:	44 01 e0             	add    %r12d,%eax
+  802bc9:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802bcd:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802bd1:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802bd8:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802bdf:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802be6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802bec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bf1:	4c 89 ee             	mov    %r13,%rsi
+  802bf4:	bf 04 00 00 00       	mov    $0x4,%edi
+  802bf9:	48 b8 a2 2a 80 00 00 	movabs $0x802aa2,%rax
+  802c00:	00 00 00 
+  802c03:	ff d0                	call   *%rax
+        if (res < 0)
+  802c05:	85 c0                	test   %eax,%eax
+  802c07:	78 29                	js     802c32 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802c09:	74 2b                	je     802c36 <devfile_write_direct+0xf7>
+        i += res;
+  802c0b:	48 98                	cltq
+  802c0d:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802c10:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802c13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c17:	49 39 c4             	cmp    %rax,%r12
+  802c1a:	0f 82 72 ff ff ff    	jb     802b92 <devfile_write_direct+0x53>
+    return i;
+  802c20:	4c 89 e0             	mov    %r12,%rax
+}
+  802c23:	48 83 c4 28          	add    $0x28,%rsp
+  802c27:	5b                   	pop    %rbx
+  802c28:	41 5c                	pop    %r12
+  802c2a:	41 5d                	pop    %r13
+  802c2c:	41 5e                	pop    %r14
+  802c2e:	41 5f                	pop    %r15
+  802c30:	5d                   	pop    %rbp
+  802c31:	c3                   	ret
+            return res;
+  802c32:	48 98                	cltq
+  802c34:	eb ed                	jmp    802c23 <devfile_write_direct+0xe4>
+            return i;
+  802c36:	4c 89 e0             	mov    %r12,%rax
+  802c39:	eb e8                	jmp    802c23 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802c3b:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802c3f:	eb df                	jmp    802c20 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802c41:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802c48:	eb d9                	jmp    802c23 <devfile_write_direct+0xe4>
+
+0000000000802c4a <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802c4a:	55                   	push   %rbp
+  802c4b:	48 89 e5             	mov    %rsp,%rbp
+  802c4e:	41 56                	push   %r14
+  802c50:	41 55                	push   %r13
+  802c52:	41 54                	push   %r12
+  802c54:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802c55:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802c59:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c62:	4d 39 ee             	cmp    %r13,%r14
+  802c65:	0f 84 99 00 00 00    	je     802d04 <fbuf_flush+0xba>
+  802c6b:	49 89 fc             	mov    %rdi,%r12
+  802c6e:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802c71:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c74:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c78:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  802c7f:	00 00 00 
+  802c82:	ff d0                	call   *%rax
+  802c84:	48 89 c2             	mov    %rax,%rdx
+  802c87:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c8b:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c8f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c93:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802c98:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c9b:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c9f:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802ca6:	00 
+  802ca7:	44 89 f1             	mov    %r14d,%ecx
+  802caa:	4c 89 ea             	mov    %r13,%rdx
+  802cad:	4c 89 e7             	mov    %r12,%rdi
+  802cb0:	48 b8 3f 2b 80 00 00 	movabs $0x802b3f,%rax
+  802cb7:	00 00 00 
+  802cba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cbc:	48 85 c0             	test   %rax,%rax
+  802cbf:	78 43                	js     802d04 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802cc1:	4c 39 e8             	cmp    %r13,%rax
+  802cc4:	72 47                	jb     802d0d <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802cc6:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802ccb:	83 c0 01             	add    $0x1,%eax
+  802cce:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802cd3:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802cd6:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802cda:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802cde:	72 0f                	jb     802cef <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802ce0:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802ce4:	48 39 c2             	cmp    %rax,%rdx
+  802ce7:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802ceb:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802cef:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802cf6:	00 
+  802cf7:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802cfe:	00 
+    return 0;
+  802cff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d04:	5b                   	pop    %rbx
+  802d05:	41 5c                	pop    %r12
+  802d07:	41 5d                	pop    %r13
+  802d09:	41 5e                	pop    %r14
+  802d0b:	5d                   	pop    %rbp
+  802d0c:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802d0d:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802d12:	eb f0                	jmp    802d04 <fbuf_flush+0xba>
+
+0000000000802d14 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802d14:	55                   	push   %rbp
+  802d15:	48 89 e5             	mov    %rsp,%rbp
+  802d18:	53                   	push   %rbx
+  802d19:	48 83 ec 08          	sub    $0x8,%rsp
+  802d1d:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802d20:	48 b8 22 29 80 00 00 	movabs $0x802922,%rax
+  802d27:	00 00 00 
+  802d2a:	ff d0                	call   *%rax
+  802d2c:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d34:	48 85 f6             	test   %rsi,%rsi
+  802d37:	74 0f                	je     802d48 <devfile_sync+0x34>
+  802d39:	48 89 df             	mov    %rbx,%rdi
+  802d3c:	48 b8 4a 2c 80 00 00 	movabs $0x802c4a,%rax
+  802d43:	00 00 00 
+  802d46:	ff d0                	call   *%rax
+}
+  802d48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d4c:	c9                   	leave
+  802d4d:	c3                   	ret
+
+0000000000802d4e <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802d4e:	55                   	push   %rbp
+  802d4f:	48 89 e5             	mov    %rsp,%rbp
+  802d52:	48 83 ec 10          	sub    $0x10,%rsp
+  802d56:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802d59:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802d60:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802d61:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802d65:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d6a:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802d71:	00 00 00 
+  802d74:	48 b8 a2 2a 80 00 00 	movabs $0x802aa2,%rax
+  802d7b:	00 00 00 
+  802d7e:	ff d0                	call   *%rax
+}
+  802d80:	c9                   	leave
+  802d81:	c3                   	ret
+
+0000000000802d82 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d82:	55                   	push   %rbp
+  802d83:	48 89 e5             	mov    %rsp,%rbp
+  802d86:	41 54                	push   %r12
+  802d88:	53                   	push   %rbx
+  802d89:	48 89 fb             	mov    %rdi,%rbx
+  802d8c:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802d8f:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  802d96:	00 00 00 
+  802d99:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d9b:	85 c0                	test   %eax,%eax
+  802d9d:	78 63                	js     802e02 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d9f:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802da2:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802da9:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802dab:	be 00 00 00 00       	mov    $0x0,%esi
+  802db0:	bf 05 00 00 00       	mov    $0x5,%edi
+  802db5:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  802dbc:	00 00 00 
+  802dbf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802dc1:	85 c0                	test   %eax,%eax
+  802dc3:	78 3d                	js     802e02 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802dc5:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802dcc:	00 00 00 
+  802dcf:	48 89 de             	mov    %rbx,%rsi
+  802dd2:	4c 89 e7             	mov    %r12,%rdi
+  802dd5:	48 b8 27 0c 80 00 00 	movabs $0x800c27,%rax
+  802ddc:	00 00 00 
+  802ddf:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802de1:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802de7:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802dee:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802def:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802df5:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802dfc:	00 
+
+    return 0;
+  802dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e02:	5b                   	pop    %rbx
+  802e03:	41 5c                	pop    %r12
+  802e05:	5d                   	pop    %rbp
+  802e06:	c3                   	ret
+
+0000000000802e07 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802e07:	55                   	push   %rbp
+  802e08:	48 89 e5             	mov    %rsp,%rbp
+  802e0b:	41 54                	push   %r12
+  802e0d:	53                   	push   %rbx
+  802e0e:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802e11:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  802e18:	00 00 00 
+  802e1b:	ff d0                	call   *%rax
+  802e1d:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802e20:	48 89 df             	mov    %rbx,%rdi
+  802e23:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  802e2a:	00 00 00 
+  802e2d:	ff d0                	call   *%rax
+  802e2f:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802e33:	76 2e                	jbe    802e63 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802e35:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e38:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802e3f:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802e41:	be 00 00 00 00       	mov    $0x0,%esi
+  802e46:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802e4b:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  802e52:	00 00 00 
+  802e55:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802e57:	45 85 e4             	test   %r12d,%r12d
+  802e5a:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802e5e:	5b                   	pop    %rbx
+  802e5f:	41 5c                	pop    %r12
+  802e61:	5d                   	pop    %rbp
+  802e62:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802e63:	48 89 df             	mov    %rbx,%rdi
+  802e66:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  802e6d:	00 00 00 
+  802e70:	ff d0                	call   *%rax
+  802e72:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802e76:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802e7d:	00 00 00 
+  802e80:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802e87:	48 89 df             	mov    %rbx,%rdi
+  802e8a:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  802e91:	00 00 00 
+  802e94:	ff d0                	call   *%rax
+  802e96:	48 89 c6             	mov    %rax,%rsi
+  802e99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea3:	48 b8 66 15 80 00 00 	movabs $0x801566,%rax
+  802eaa:	00 00 00 
+  802ead:	ff d0                	call   *%rax
+  802eaf:	eb 84                	jmp    802e35 <devfile_flush+0x2e>
+
+0000000000802eb1 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802eb1:	55                   	push   %rbp
+  802eb2:	48 89 e5             	mov    %rsp,%rbp
+  802eb5:	41 55                	push   %r13
+  802eb7:	41 54                	push   %r12
+  802eb9:	53                   	push   %rbx
+  802eba:	48 83 ec 08          	sub    $0x8,%rsp
+  802ebe:	48 89 fb             	mov    %rdi,%rbx
+  802ec1:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802ec4:	48 b8 22 29 80 00 00 	movabs $0x802922,%rax
+  802ecb:	00 00 00 
+  802ece:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ed0:	48 85 c0             	test   %rax,%rax
+  802ed3:	74 51                	je     802f26 <devfile_trunc+0x75>
+  802ed5:	49 89 c4             	mov    %rax,%r12
+  802ed8:	48 89 c6             	mov    %rax,%rsi
+  802edb:	48 89 df             	mov    %rbx,%rdi
+  802ede:	48 b8 4a 2c 80 00 00 	movabs $0x802c4a,%rax
+  802ee5:	00 00 00 
+  802ee8:	ff d0                	call   *%rax
+  802eea:	85 c0                	test   %eax,%eax
+  802eec:	78 2d                	js     802f1b <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802eee:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802ef5:	00 00 00 
+  802ef8:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802efb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802efd:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802f01:	be 00 00 00 00       	mov    $0x0,%esi
+  802f06:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f0b:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802f17:	85 c0                	test   %eax,%eax
+  802f19:	79 3e                	jns    802f59 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802f1b:	48 83 c4 08          	add    $0x8,%rsp
+  802f1f:	5b                   	pop    %rbx
+  802f20:	41 5c                	pop    %r12
+  802f22:	41 5d                	pop    %r13
+  802f24:	5d                   	pop    %rbp
+  802f25:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f26:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802f2d:	00 00 00 
+  802f30:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f33:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802f35:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802f39:	be 00 00 00 00       	mov    $0x0,%esi
+  802f3e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f43:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  802f4a:	00 00 00 
+  802f4d:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802f4f:	85 c0                	test   %eax,%eax
+  802f51:	78 c8                	js     802f1b <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f53:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f57:	eb c2                	jmp    802f1b <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f59:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802f5c:	8d 51 01             	lea    0x1(%rcx),%edx
+  802f5f:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f62:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802f67:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f6e:	00 00 
+  802f70:	eb a9                	jmp    802f1b <devfile_trunc+0x6a>
+
+0000000000802f72 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802f72:	55                   	push   %rbp
+  802f73:	48 89 e5             	mov    %rsp,%rbp
+  802f76:	41 57                	push   %r15
+  802f78:	41 56                	push   %r14
+  802f7a:	41 55                	push   %r13
+  802f7c:	41 54                	push   %r12
+  802f7e:	53                   	push   %rbx
+  802f7f:	48 83 ec 28          	sub    $0x28,%rsp
+  802f83:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f87:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f8b:	49 89 d7             	mov    %rdx,%r15
+  802f8e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f92:	48 b8 22 29 80 00 00 	movabs $0x802922,%rax
+  802f99:	00 00 00 
+  802f9c:	ff d0                	call   *%rax
+  802f9e:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802fa1:	48 85 c0             	test   %rax,%rax
+  802fa4:	74 31                	je     802fd7 <devfile_write+0x65>
+  802fa6:	4c 89 f8             	mov    %r15,%rax
+  802fa9:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802fb0:	77 25                	ja     802fd7 <devfile_write+0x65>
+    size_t i = 0;
+  802fb2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802fb8:	48 85 c0             	test   %rax,%rax
+  802fbb:	0f 85 64 01 00 00    	jne    803125 <devfile_write+0x1b3>
+    size_t i = 0;
+  802fc1:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802fc5:	4c 89 f8             	mov    %r15,%rax
+}
+  802fc8:	48 83 c4 28          	add    $0x28,%rsp
+  802fcc:	5b                   	pop    %rbx
+  802fcd:	41 5c                	pop    %r12
+  802fcf:	41 5d                	pop    %r13
+  802fd1:	41 5e                	pop    %r14
+  802fd3:	41 5f                	pop    %r15
+  802fd5:	5d                   	pop    %rbp
+  802fd6:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802fd7:	48 85 db             	test   %rbx,%rbx
+  802fda:	74 5b                	je     803037 <devfile_write+0xc5>
+  802fdc:	48 89 de             	mov    %rbx,%rsi
+  802fdf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fe3:	48 b8 4a 2c 80 00 00 	movabs $0x802c4a,%rax
+  802fea:	00 00 00 
+  802fed:	ff d0                	call   *%rax
+  802fef:	85 c0                	test   %eax,%eax
+  802ff1:	78 40                	js     803033 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802ff3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802ff7:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802ffa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ffe:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803002:	48 b8 3f 2b 80 00 00 	movabs $0x802b3f,%rax
+  803009:	00 00 00 
+  80300c:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80300e:	48 85 c0             	test   %rax,%rax
+  803011:	7e b5                	jle    802fc8 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803013:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803017:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  80301a:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  80301d:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803020:	8d 51 01             	lea    0x1(%rcx),%edx
+  803023:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803026:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  803029:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803030:	00 
+  803031:	eb 95                	jmp    802fc8 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803033:	48 98                	cltq
+  803035:	eb 91                	jmp    802fc8 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803037:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80303b:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  80303e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803042:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803046:	48 89 df             	mov    %rbx,%rdi
+  803049:	48 b8 3f 2b 80 00 00 	movabs $0x802b3f,%rax
+  803050:	00 00 00 
+  803053:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803055:	48 85 c0             	test   %rax,%rax
+  803058:	0f 8e 6a ff ff ff    	jle    802fc8 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80305e:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803061:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803065:	e9 5e ff ff ff       	jmp    802fc8 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80306a:	48 98                	cltq
+  80306c:	4d 85 ff             	test   %r15,%r15
+  80306f:	49 0f 45 c7          	cmovne %r15,%rax
+  803073:	e9 50 ff ff ff       	jmp    802fc8 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803078:	48 89 de             	mov    %rbx,%rsi
+  80307b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80307f:	48 b8 4a 2c 80 00 00 	movabs $0x802c4a,%rax
+  803086:	00 00 00 
+  803089:	ff d0                	call   *%rax
+  80308b:	85 c0                	test   %eax,%eax
+  80308d:	0f 88 2b 01 00 00    	js     8031be <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803093:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803097:	4c 01 f8             	add    %r15,%rax
+  80309a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80309e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030a2:	48 b9 4e 21 80 00 00 	movabs $0x80214e,%rcx
+  8030a9:	00 00 00 
+  8030ac:	ff d1                	call   *%rcx
+  8030ae:	48 89 c2             	mov    %rax,%rdx
+  8030b1:	48 c1 e2 04          	shl    $0x4,%rdx
+  8030b5:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8030b9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030bd:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  8030c2:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8030c5:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8030cc:	00 
+  8030cd:	4c 89 ea             	mov    %r13,%rdx
+  8030d0:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8030d4:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  8030db:	00 00 00 
+  8030de:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  8030e0:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8030e4:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8030e8:	48 39 c2             	cmp    %rax,%rdx
+  8030eb:	0f 84 db 00 00 00    	je     8031cc <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  8030f1:	4c 39 e2             	cmp    %r12,%rdx
+  8030f4:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  8030f8:	4d 01 ec             	add    %r13,%r12
+  8030fb:	49 39 c4             	cmp    %rax,%r12
+  8030fe:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803102:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803106:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  80310a:	45 01 ee             	add    %r13d,%r14d
+  80310d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803111:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803115:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803118:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80311c:	49 39 c7             	cmp    %rax,%r15
+  80311f:	0f 83 a0 fe ff ff    	jae    802fc5 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803125:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803129:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  80312d:	8b 43 08             	mov    0x8(%rbx),%eax
+  803130:	44 39 f0             	cmp    %r14d,%eax
+  803133:	7f 10                	jg     803145 <devfile_write+0x1d3>
+  803135:	48 98                	cltq
+  803137:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  80313d:	49 63 d6             	movslq %r14d,%rdx
+  803140:	48 39 d0             	cmp    %rdx,%rax
+  803143:	7d 2d                	jge    803172 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803145:	48 89 de             	mov    %rbx,%rsi
+  803148:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80314c:	48 b8 4a 2c 80 00 00 	movabs $0x802c4a,%rax
+  803153:	00 00 00 
+  803156:	ff d0                	call   *%rax
+  803158:	85 c0                	test   %eax,%eax
+  80315a:	0f 88 0a ff ff ff    	js     80306a <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803160:	44 89 f0             	mov    %r14d,%eax
+  803163:	66 b8 00 00          	mov    $0x0,%ax
+  803167:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  80316a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803171:	00 
+        size_t off = pos - fb->fb_base;
+  803172:	45 89 f4             	mov    %r14d,%r12d
+  803175:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803179:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  80317c:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803180:	4d 29 fd             	sub    %r15,%r13
+  803183:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803188:	4c 29 e0             	sub    %r12,%rax
+  80318b:	49 39 c5             	cmp    %rax,%r13
+  80318e:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803192:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803196:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80319a:	48 39 c2             	cmp    %rax,%rdx
+  80319d:	0f 84 f0 fe ff ff    	je     803093 <devfile_write+0x121>
+  8031a3:	4c 39 e0             	cmp    %r12,%rax
+  8031a6:	0f 82 cc fe ff ff    	jb     803078 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  8031ac:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8031b0:	48 39 d0             	cmp    %rdx,%rax
+  8031b3:	0f 83 da fe ff ff    	jae    803093 <devfile_write+0x121>
+  8031b9:	e9 ba fe ff ff       	jmp    803078 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8031be:	48 98                	cltq
+  8031c0:	4d 85 ff             	test   %r15,%r15
+  8031c3:	49 0f 45 c7          	cmovne %r15,%rax
+  8031c7:	e9 fc fd ff ff       	jmp    802fc8 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  8031cc:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8031d0:	4c 89 e2             	mov    %r12,%rdx
+  8031d3:	e9 2a ff ff ff       	jmp    803102 <devfile_write+0x190>
+
+00000000008031d8 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8031d8:	55                   	push   %rbp
+  8031d9:	48 89 e5             	mov    %rsp,%rbp
+  8031dc:	41 57                	push   %r15
+  8031de:	41 56                	push   %r14
+  8031e0:	41 55                	push   %r13
+  8031e2:	41 54                	push   %r12
+  8031e4:	53                   	push   %rbx
+  8031e5:	48 83 ec 28          	sub    $0x28,%rsp
+  8031e9:	49 89 ff             	mov    %rdi,%r15
+  8031ec:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8031f0:	48 89 d3             	mov    %rdx,%rbx
+  8031f3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8031f7:	48 b8 22 29 80 00 00 	movabs $0x802922,%rax
+  8031fe:	00 00 00 
+  803201:	ff d0                	call   *%rax
+  803203:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803206:	48 85 c0             	test   %rax,%rax
+  803209:	74 0d                	je     803218 <devfile_read+0x40>
+  80320b:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803212:	0f 86 1a 01 00 00    	jbe    803332 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803218:	4d 85 e4             	test   %r12,%r12
+  80321b:	74 1a                	je     803237 <devfile_read+0x5f>
+  80321d:	4c 89 e6             	mov    %r12,%rsi
+  803220:	4c 89 ff             	mov    %r15,%rdi
+  803223:	48 b8 4a 2c 80 00 00 	movabs $0x802c4a,%rax
+  80322a:	00 00 00 
+  80322d:	ff d0                	call   *%rax
+  80322f:	85 c0                	test   %eax,%eax
+  803231:	0f 88 e8 00 00 00    	js     80331f <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803237:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  80323b:	48 b8 3c 2a 80 00 00 	movabs $0x802a3c,%rax
+  803242:	00 00 00 
+  803245:	ff d0                	call   *%rax
+  803247:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  80324a:	48 85 c0             	test   %rax,%rax
+  80324d:	0f 84 69 02 00 00    	je     8034bc <devfile_read+0x2e4>
+    while (i < n) {
+  803253:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803258:	0f 84 ce 00 00 00    	je     80332c <devfile_read+0x154>
+    size_t i = 0;
+  80325e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803263:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80326a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80326e:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803272:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803276:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80327a:	48 29 da             	sub    %rbx,%rdx
+  80327d:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803282:	48 39 c2             	cmp    %rax,%rdx
+  803285:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803289:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80328d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803291:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803294:	01 d8                	add    %ebx,%eax
+  803296:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  80329a:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  80329e:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  8032a5:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8032ac:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8032b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8032b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032be:	4c 89 ee             	mov    %r13,%rsi
+  8032c1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8032c6:	48 b8 a2 2a 80 00 00 	movabs $0x802aa2,%rax
+  8032cd:	00 00 00 
+  8032d0:	ff d0                	call   *%rax
+        if (res < 0)
+  8032d2:	85 c0                	test   %eax,%eax
+  8032d4:	78 4d                	js     803323 <devfile_read+0x14b>
+        if (res == 0)
+  8032d6:	74 4f                	je     803327 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8032d8:	4c 63 e0             	movslq %eax,%r12
+  8032db:	4c 89 e2             	mov    %r12,%rdx
+  8032de:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8032e2:	4c 89 f7             	mov    %r14,%rdi
+  8032e5:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  8032ec:	00 00 00 
+  8032ef:	ff d0                	call   *%rax
+        i += res;
+  8032f1:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8032f4:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8032f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032fb:	48 39 c3             	cmp    %rax,%rbx
+  8032fe:	0f 82 72 ff ff ff    	jb     803276 <devfile_read+0x9e>
+    return i;
+  803304:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803307:	48 85 c0             	test   %rax,%rax
+  80330a:	7e 04                	jle    803310 <devfile_read+0x138>
+  80330c:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803310:	48 83 c4 28          	add    $0x28,%rsp
+  803314:	5b                   	pop    %rbx
+  803315:	41 5c                	pop    %r12
+  803317:	41 5d                	pop    %r13
+  803319:	41 5e                	pop    %r14
+  80331b:	41 5f                	pop    %r15
+  80331d:	5d                   	pop    %rbp
+  80331e:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80331f:	48 98                	cltq
+  803321:	eb ed                	jmp    803310 <devfile_read+0x138>
+            return res;
+  803323:	48 98                	cltq
+  803325:	eb e9                	jmp    803310 <devfile_read+0x138>
+            return i;
+  803327:	48 89 d8             	mov    %rbx,%rax
+  80332a:	eb db                	jmp    803307 <devfile_read+0x12f>
+    size_t i = 0;
+  80332c:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803330:	eb d2                	jmp    803304 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803332:	48 89 c6             	mov    %rax,%rsi
+  803335:	4c 89 ff             	mov    %r15,%rdi
+  803338:	48 b8 4a 2c 80 00 00 	movabs $0x802c4a,%rax
+  80333f:	00 00 00 
+  803342:	ff d0                	call   *%rax
+  803344:	85 c0                	test   %eax,%eax
+  803346:	78 40                	js     803388 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803348:	4c 89 ff             	mov    %r15,%rdi
+  80334b:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  803352:	00 00 00 
+  803355:	ff d0                	call   *%rax
+  803357:	48 89 c2             	mov    %rax,%rdx
+  80335a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80335e:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803362:	48 c1 e0 0c          	shl    $0xc,%rax
+  803366:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80336b:	48 01 d0             	add    %rdx,%rax
+  80336e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803372:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803377:	0f 84 33 01 00 00    	je     8034b0 <devfile_read+0x2d8>
+    size_t i = 0;
+  80337d:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803383:	e9 f5 00 00 00       	jmp    80347d <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803388:	48 98                	cltq
+  80338a:	eb 84                	jmp    803310 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80338c:	44 89 e8             	mov    %r13d,%eax
+  80338f:	66 b8 00 00          	mov    $0x0,%ax
+  803393:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803398:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80339f:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8033a1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8033a5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8033a9:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8033ab:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8033b0:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8033b3:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8033ba:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8033bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8033c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033c6:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8033cb:	bf 03 00 00 00       	mov    $0x3,%edi
+  8033d0:	48 b8 a2 2a 80 00 00 	movabs $0x802aa2,%rax
+  8033d7:	00 00 00 
+  8033da:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8033dc:	85 c0                	test   %eax,%eax
+  8033de:	0f 88 be 00 00 00    	js     8034a2 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8033e4:	48 63 d0             	movslq %eax,%rdx
+  8033e7:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8033ec:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8033f1:	44 39 e8             	cmp    %r13d,%eax
+  8033f4:	0f 8e ba 00 00 00    	jle    8034b4 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8033fa:	49 63 c5             	movslq %r13d,%rax
+  8033fd:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803402:	48 29 c3             	sub    %rax,%rbx
+  803405:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80340a:	48 01 c3             	add    %rax,%rbx
+  80340d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803411:	4c 29 f0             	sub    %r14,%rax
+  803414:	48 39 c3             	cmp    %rax,%rbx
+  803417:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80341b:	4c 89 ff             	mov    %r15,%rdi
+  80341e:	48 b9 4e 21 80 00 00 	movabs $0x80214e,%rcx
+  803425:	00 00 00 
+  803428:	ff d1                	call   *%rcx
+  80342a:	48 89 c2             	mov    %rax,%rdx
+  80342d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803431:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803435:	48 c1 e0 0c          	shl    $0xc,%rax
+  803439:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  80343e:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803441:	44 89 ea             	mov    %r13d,%edx
+  803444:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803449:	48 63 d2             	movslq %edx,%rdx
+  80344c:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803453:	00 
+  803454:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803458:	4c 01 f7             	add    %r14,%rdi
+  80345b:	48 89 da             	mov    %rbx,%rdx
+  80345e:	48 b9 1c 10 80 00 00 	movabs $0x80101c,%rcx
+  803465:	00 00 00 
+  803468:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80346a:	41 01 dd             	add    %ebx,%r13d
+  80346d:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803471:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803474:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803478:	49 39 c6             	cmp    %rax,%r14
+  80347b:	73 37                	jae    8034b4 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  80347d:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803481:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803486:	44 39 e8             	cmp    %r13d,%eax
+  803489:	0f 8f fd fe ff ff    	jg     80338c <devfile_read+0x1b4>
+  80348f:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803494:	44 39 e8             	cmp    %r13d,%eax
+  803497:	0f 8f 5d ff ff ff    	jg     8033fa <devfile_read+0x222>
+  80349d:	e9 ea fe ff ff       	jmp    80338c <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8034a2:	48 98                	cltq
+  8034a4:	4d 85 f6             	test   %r14,%r14
+  8034a7:	49 0f 45 c6          	cmovne %r14,%rax
+  8034ab:	e9 60 fe ff ff       	jmp    803310 <devfile_read+0x138>
+    size_t i = 0;
+  8034b0:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8034b4:	4c 89 f0             	mov    %r14,%rax
+  8034b7:	e9 54 fe ff ff       	jmp    803310 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8034bc:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8034c3:	e9 48 fe ff ff       	jmp    803310 <devfile_read+0x138>
+
+00000000008034c8 <open>:
+open(const char *path, int mode) {
+  8034c8:	55                   	push   %rbp
+  8034c9:	48 89 e5             	mov    %rsp,%rbp
+  8034cc:	41 55                	push   %r13
+  8034ce:	41 54                	push   %r12
+  8034d0:	53                   	push   %rbx
+  8034d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8034d5:	49 89 fc             	mov    %rdi,%r12
+  8034d8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8034db:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  8034e2:	00 00 00 
+  8034e5:	ff d0                	call   *%rax
+  8034e7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8034ed:	0f 87 8a 00 00 00    	ja     80357d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8034f3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8034f7:	48 b8 7c 21 80 00 00 	movabs $0x80217c,%rax
+  8034fe:	00 00 00 
+  803501:	ff d0                	call   *%rax
+  803503:	89 c3                	mov    %eax,%ebx
+  803505:	85 c0                	test   %eax,%eax
+  803507:	78 50                	js     803559 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803509:	4c 89 e6             	mov    %r12,%rsi
+  80350c:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803513:	00 00 00 
+  803516:	48 89 df             	mov    %rbx,%rdi
+  803519:	48 b8 27 0c 80 00 00 	movabs $0x800c27,%rax
+  803520:	00 00 00 
+  803523:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803525:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80352c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803530:	bf 01 00 00 00       	mov    $0x1,%edi
+  803535:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  80353c:	00 00 00 
+  80353f:	ff d0                	call   *%rax
+  803541:	89 c3                	mov    %eax,%ebx
+  803543:	85 c0                	test   %eax,%eax
+  803545:	78 1f                	js     803566 <open+0x9e>
+    return fd2num(fd);
+  803547:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80354b:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  803552:	00 00 00 
+  803555:	ff d0                	call   *%rax
+  803557:	89 c3                	mov    %eax,%ebx
+}
+  803559:	89 d8                	mov    %ebx,%eax
+  80355b:	48 83 c4 18          	add    $0x18,%rsp
+  80355f:	5b                   	pop    %rbx
+  803560:	41 5c                	pop    %r12
+  803562:	41 5d                	pop    %r13
+  803564:	5d                   	pop    %rbp
+  803565:	c3                   	ret
+        fd_close(fd, 0);
+  803566:	be 00 00 00 00       	mov    $0x0,%esi
+  80356b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80356f:	48 b8 97 22 80 00 00 	movabs $0x802297,%rax
+  803576:	00 00 00 
+  803579:	ff d0                	call   *%rax
+        return res;
+  80357b:	eb dc                	jmp    803559 <open+0x91>
+        return -E_BAD_PATH;
+  80357d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803582:	eb d5                	jmp    803559 <open+0x91>
+
+0000000000803584 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803584:	55                   	push   %rbp
+  803585:	48 89 e5             	mov    %rsp,%rbp
+  803588:	41 57                	push   %r15
+  80358a:	41 56                	push   %r14
+  80358c:	41 55                	push   %r13
+  80358e:	41 54                	push   %r12
+  803590:	53                   	push   %rbx
+  803591:	48 83 ec 18          	sub    $0x18,%rsp
+  803595:	41 89 f6             	mov    %esi,%r14d
+  803598:	49 89 d7             	mov    %rdx,%r15
+  80359b:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80359e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8035a2:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  8035a9:	00 00 00 
+  8035ac:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035ae:	85 c0                	test   %eax,%eax
+  8035b0:	0f 88 db 00 00 00    	js     803691 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8035b6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035ba:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8035c1:	00 00 00 
+  8035c4:	8b 00                	mov    (%rax),%eax
+  8035c6:	39 07                	cmp    %eax,(%rdi)
+  8035c8:	0f 85 db 00 00 00    	jne    8036a9 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8035ce:	45 85 f6             	test   %r14d,%r14d
+  8035d1:	0f 88 db 00 00 00    	js     8036b2 <fmap+0x12e>
+  8035d7:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8035de:	0f 85 d7 00 00 00    	jne    8036bb <fmap+0x137>
+  8035e4:	4c 89 fb             	mov    %r15,%rbx
+  8035e7:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8035ed:	0f 85 d1 00 00 00    	jne    8036c4 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8035f3:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  8035fa:	00 00 00 
+  8035fd:	ff d0                	call   *%rax
+  8035ff:	85 c0                	test   %eax,%eax
+  803601:	0f 88 8e 00 00 00    	js     803695 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803607:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80360e:	00 00 00 
+    while (i < n) {
+  803611:	4d 85 ed             	test   %r13,%r13
+  803614:	0f 84 8a 00 00 00    	je     8036a4 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80361a:	4c 89 ea             	mov    %r13,%rdx
+  80361d:	48 29 da             	sub    %rbx,%rdx
+  803620:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803627:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80362d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803631:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803635:	8b 40 0c             	mov    0xc(%rax),%eax
+  803638:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80363c:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803640:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803645:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80364a:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80364e:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803652:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803657:	4c 89 e6             	mov    %r12,%rsi
+  80365a:	bf 09 00 00 00       	mov    $0x9,%edi
+  80365f:	48 b8 a2 2a 80 00 00 	movabs $0x802aa2,%rax
+  803666:	00 00 00 
+  803669:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80366b:	85 c0                	test   %eax,%eax
+  80366d:	78 2a                	js     803699 <fmap+0x115>
+        i += res;
+  80366f:	48 98                	cltq
+  803671:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803674:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803678:	72 05                	jb     80367f <fmap+0xfb>
+    while (i < n) {
+  80367a:	4c 39 eb             	cmp    %r13,%rbx
+  80367d:	72 9b                	jb     80361a <fmap+0x96>
+    }
+    return i;
+  80367f:	48 89 d8             	mov    %rbx,%rax
+}
+  803682:	48 83 c4 18          	add    $0x18,%rsp
+  803686:	5b                   	pop    %rbx
+  803687:	41 5c                	pop    %r12
+  803689:	41 5d                	pop    %r13
+  80368b:	41 5e                	pop    %r14
+  80368d:	41 5f                	pop    %r15
+  80368f:	5d                   	pop    %rbp
+  803690:	c3                   	ret
+    if (res < 0) return res;
+  803691:	48 98                	cltq
+  803693:	eb ed                	jmp    803682 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803695:	48 98                	cltq
+  803697:	eb e9                	jmp    803682 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803699:	48 98                	cltq
+  80369b:	48 85 db             	test   %rbx,%rbx
+  80369e:	48 0f 45 c3          	cmovne %rbx,%rax
+  8036a2:	eb de                	jmp    803682 <fmap+0xfe>
+    size_t i = 0;
+  8036a4:	4c 89 eb             	mov    %r13,%rbx
+  8036a7:	eb d6                	jmp    80367f <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8036a9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8036b0:	eb d0                	jmp    803682 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8036b2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036b9:	eb c7                	jmp    803682 <fmap+0xfe>
+  8036bb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036c2:	eb be                	jmp    803682 <fmap+0xfe>
+  8036c4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036cb:	eb b5                	jmp    803682 <fmap+0xfe>
+
+00000000008036cd <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8036cd:	55                   	push   %rbp
+  8036ce:	48 89 e5             	mov    %rsp,%rbp
+  8036d1:	41 56                	push   %r14
+  8036d3:	41 55                	push   %r13
+  8036d5:	41 54                	push   %r12
+  8036d7:	53                   	push   %rbx
+  8036d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8036dc:	89 fb                	mov    %edi,%ebx
+  8036de:	41 89 f4             	mov    %esi,%r12d
+  8036e1:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8036e4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036e8:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  8036ef:	00 00 00 
+  8036f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036f4:	85 c0                	test   %eax,%eax
+  8036f6:	78 63                	js     80375b <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8036f8:	45 85 e4             	test   %r12d,%r12d
+  8036fb:	0f 88 80 00 00 00    	js     803781 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803701:	45 89 e6             	mov    %r12d,%r14d
+  803704:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80370b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80370f:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  803716:	00 00 00 
+  803719:	ff d0                	call   *%rax
+  80371b:	48 89 c2             	mov    %rax,%rdx
+  80371e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803723:	44 89 f6             	mov    %r14d,%esi
+  803726:	89 df                	mov    %ebx,%edi
+  803728:	48 b8 84 35 80 00 00 	movabs $0x803584,%rax
+  80372f:	00 00 00 
+  803732:	ff d0                	call   *%rax
+  803734:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803737:	45 29 f4             	sub    %r14d,%r12d
+  80373a:	4d 63 f4             	movslq %r12d,%r14
+  80373d:	49 39 c6             	cmp    %rax,%r14
+  803740:	7c 1d                	jl     80375f <read_map+0x92>
+  803742:	48 85 c0             	test   %rax,%rax
+  803745:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374a:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80374e:	48 83 c4 10          	add    $0x10,%rsp
+  803752:	5b                   	pop    %rbx
+  803753:	41 5c                	pop    %r12
+  803755:	41 5d                	pop    %r13
+  803757:	41 5e                	pop    %r14
+  803759:	5d                   	pop    %rbp
+  80375a:	c3                   	ret
+    if (res < 0) return res;
+  80375b:	48 98                	cltq
+  80375d:	eb ef                	jmp    80374e <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  80375f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803763:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  80376a:	00 00 00 
+  80376d:	ff d0                	call   *%rax
+  80376f:	4d 63 e4             	movslq %r12d,%r12
+  803772:	4c 01 e0             	add    %r12,%rax
+  803775:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803779:	48 89 d8             	mov    %rbx,%rax
+  80377c:	4c 29 f0             	sub    %r14,%rax
+  80377f:	eb cd                	jmp    80374e <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803781:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803788:	eb c4                	jmp    80374e <read_map+0x81>
+
+000000000080378a <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  80378a:	55                   	push   %rbp
+  80378b:	48 89 e5             	mov    %rsp,%rbp
+  80378e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803792:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803796:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  80379d:	00 00 00 
+  8037a0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037a2:	85 c0                	test   %eax,%eax
+  8037a4:	78 4a                	js     8037f0 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8037a6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8037aa:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8037b1:	00 00 00 
+  8037b4:	8b 00                	mov    (%rax),%eax
+  8037b6:	39 07                	cmp    %eax,(%rdi)
+  8037b8:	75 38                	jne    8037f2 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8037ba:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  8037c1:	00 00 00 
+  8037c4:	ff d0                	call   *%rax
+  8037c6:	85 c0                	test   %eax,%eax
+  8037c8:	78 26                	js     8037f0 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8037ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037ce:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037d1:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8037d8:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8037da:	be 00 00 00 00       	mov    $0x0,%esi
+  8037df:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037e4:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  8037eb:	00 00 00 
+  8037ee:	ff d0                	call   *%rax
+}
+  8037f0:	c9                   	leave
+  8037f1:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8037f2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8037f7:	eb f7                	jmp    8037f0 <fsync+0x66>
+
+00000000008037f9 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8037f9:	55                   	push   %rbp
+  8037fa:	48 89 e5             	mov    %rsp,%rbp
+  8037fd:	41 57                	push   %r15
+  8037ff:	41 56                	push   %r14
+  803801:	41 55                	push   %r13
+  803803:	41 54                	push   %r12
+  803805:	53                   	push   %rbx
+  803806:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80380a:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803811:	00 00 00 
+  803814:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803819:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80381f:	49 bd dc 21 80 00 00 	movabs $0x8021dc,%r13
+  803826:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803829:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803830:	00 00 00 
+  803833:	eb 0c                	jmp    803841 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803835:	83 c3 01             	add    $0x1,%ebx
+  803838:	49 83 c4 28          	add    $0x28,%r12
+  80383c:	83 fb 20             	cmp    $0x20,%ebx
+  80383f:	74 33                	je     803874 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803841:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803846:	74 ed                	je     803835 <flushall+0x3c>
+  803848:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80384c:	89 df                	mov    %ebx,%edi
+  80384e:	41 ff d5             	call   *%r13
+  803851:	85 c0                	test   %eax,%eax
+  803853:	78 e0                	js     803835 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803855:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803859:	41 8b 06             	mov    (%r14),%eax
+  80385c:	39 07                	cmp    %eax,(%rdi)
+  80385e:	75 d5                	jne    803835 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803860:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  803867:	00 00 00 
+  80386a:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80386c:	85 c0                	test   %eax,%eax
+  80386e:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803872:	eb c1                	jmp    803835 <flushall+0x3c>
+    }
+    return res;
+}
+  803874:	44 89 f8             	mov    %r15d,%eax
+  803877:	48 83 c4 18          	add    $0x18,%rsp
+  80387b:	5b                   	pop    %rbx
+  80387c:	41 5c                	pop    %r12
+  80387e:	41 5d                	pop    %r13
+  803880:	41 5e                	pop    %r14
+  803882:	41 5f                	pop    %r15
+  803884:	5d                   	pop    %rbp
+  803885:	c3                   	ret
+
+0000000000803886 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803886:	55                   	push   %rbp
+  803887:	48 89 e5             	mov    %rsp,%rbp
+  80388a:	53                   	push   %rbx
+  80388b:	48 83 ec 08          	sub    $0x8,%rsp
+  80388f:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803892:	40 0f b6 c6          	movzbl %sil,%eax
+  803896:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80389d:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  80389f:	be 00 00 00 00       	mov    $0x0,%esi
+  8038a4:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8038a9:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  8038b0:	00 00 00 
+  8038b3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038b5:	85 c0                	test   %eax,%eax
+  8038b7:	78 23                	js     8038dc <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8038b9:	ba 58 06 00 00       	mov    $0x658,%edx
+  8038be:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8038c5:	00 00 00 
+  8038c8:	48 89 df             	mov    %rbx,%rdi
+  8038cb:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  8038d2:	00 00 00 
+  8038d5:	ff d0                	call   *%rax
+    return 0;
+  8038d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038e0:	c9                   	leave
+  8038e1:	c3                   	ret
+
+00000000008038e2 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8038e2:	55                   	push   %rbp
+  8038e3:	48 89 e5             	mov    %rsp,%rbp
+  8038e6:	53                   	push   %rbx
+  8038e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8038eb:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8038ee:	48 b8 e9 0b 80 00 00 	movabs $0x800be9,%rax
+  8038f5:	00 00 00 
+  8038f8:	ff d0                	call   *%rax
+  8038fa:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803900:	77 35                	ja     803937 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803902:	48 89 de             	mov    %rbx,%rsi
+  803905:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80390c:	00 00 00 
+  80390f:	48 b8 27 0c 80 00 00 	movabs $0x800c27,%rax
+  803916:	00 00 00 
+  803919:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80391b:	be 00 00 00 00       	mov    $0x0,%esi
+  803920:	bf 07 00 00 00       	mov    $0x7,%edi
+  803925:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  80392c:	00 00 00 
+  80392f:	ff d0                	call   *%rax
+}
+  803931:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803935:	c9                   	leave
+  803936:	c3                   	ret
+        return -E_BAD_PATH;
+  803937:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80393c:	eb f3                	jmp    803931 <remove+0x4f>
+
+000000000080393e <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80393e:	55                   	push   %rbp
+  80393f:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803942:	48 b8 f9 37 80 00 00 	movabs $0x8037f9,%rax
+  803949:	00 00 00 
+  80394c:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80394e:	be 00 00 00 00       	mov    $0x0,%esi
+  803953:	bf 08 00 00 00       	mov    $0x8,%edi
+  803958:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  80395f:	00 00 00 
+  803962:	ff d0                	call   *%rax
+}
+  803964:	5d                   	pop    %rbp
+  803965:	c3                   	ret
+
+0000000000803966 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803966:	55                   	push   %rbp
+  803967:	48 89 e5             	mov    %rsp,%rbp
+  80396a:	41 54                	push   %r12
+  80396c:	53                   	push   %rbx
+  80396d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803970:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  803977:	00 00 00 
+  80397a:	ff d0                	call   *%rax
+  80397c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80397f:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  803986:	00 00 00 
+  803989:	48 89 df             	mov    %rbx,%rdi
+  80398c:	48 b8 27 0c 80 00 00 	movabs $0x800c27,%rax
+  803993:	00 00 00 
+  803996:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803998:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80399d:	41 2b 04 24          	sub    (%r12),%eax
+  8039a1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8039a7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039ae:	00 00 00 
+    stat->st_dev = &devpipe;
+  8039b1:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8039b8:	00 00 00 
+  8039bb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8039c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c7:	5b                   	pop    %rbx
+  8039c8:	41 5c                	pop    %r12
+  8039ca:	5d                   	pop    %rbp
+  8039cb:	c3                   	ret
+
+00000000008039cc <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8039cc:	55                   	push   %rbp
+  8039cd:	48 89 e5             	mov    %rsp,%rbp
+  8039d0:	41 54                	push   %r12
+  8039d2:	53                   	push   %rbx
+  8039d3:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8039d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039db:	48 89 fe             	mov    %rdi,%rsi
+  8039de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039e3:	49 bc 66 15 80 00 00 	movabs $0x801566,%r12
+  8039ea:	00 00 00 
+  8039ed:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8039f0:	48 89 df             	mov    %rbx,%rdi
+  8039f3:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  8039fa:	00 00 00 
+  8039fd:	ff d0                	call   *%rax
+  8039ff:	48 89 c6             	mov    %rax,%rsi
+  803a02:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a07:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a0c:	41 ff d4             	call   *%r12
+}
+  803a0f:	5b                   	pop    %rbx
+  803a10:	41 5c                	pop    %r12
+  803a12:	5d                   	pop    %rbp
+  803a13:	c3                   	ret
+
+0000000000803a14 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803a14:	55                   	push   %rbp
+  803a15:	48 89 e5             	mov    %rsp,%rbp
+  803a18:	41 57                	push   %r15
+  803a1a:	41 56                	push   %r14
+  803a1c:	41 55                	push   %r13
+  803a1e:	41 54                	push   %r12
+  803a20:	53                   	push   %rbx
+  803a21:	48 83 ec 18          	sub    $0x18,%rsp
+  803a25:	49 89 fc             	mov    %rdi,%r12
+  803a28:	49 89 f5             	mov    %rsi,%r13
+  803a2b:	49 89 d7             	mov    %rdx,%r15
+  803a2e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a32:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  803a39:	00 00 00 
+  803a3c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803a3e:	4d 85 ff             	test   %r15,%r15
+  803a41:	0f 84 af 00 00 00    	je     803af6 <devpipe_write+0xe2>
+  803a47:	48 89 c3             	mov    %rax,%rbx
+  803a4a:	4c 89 f8             	mov    %r15,%rax
+  803a4d:	4d 89 ef             	mov    %r13,%r15
+  803a50:	4c 01 e8             	add    %r13,%rax
+  803a53:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a57:	49 bd 5b 13 80 00 00 	movabs $0x80135b,%r13
+  803a5e:	00 00 00 
+            sys_yield();
+  803a61:	49 be f8 12 80 00 00 	movabs $0x8012f8,%r14
+  803a68:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a6b:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a6e:	48 63 ce             	movslq %esi,%rcx
+  803a71:	48 63 03             	movslq (%rbx),%rax
+  803a74:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a7a:	48 39 c1             	cmp    %rax,%rcx
+  803a7d:	72 2e                	jb     803aad <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a7f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a84:	48 89 da             	mov    %rbx,%rdx
+  803a87:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a8c:	4c 89 e7             	mov    %r12,%rdi
+  803a8f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803a92:	85 c0                	test   %eax,%eax
+  803a94:	74 66                	je     803afc <devpipe_write+0xe8>
+            sys_yield();
+  803a96:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a99:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a9c:	48 63 ce             	movslq %esi,%rcx
+  803a9f:	48 63 03             	movslq (%rbx),%rax
+  803aa2:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803aa8:	48 39 c1             	cmp    %rax,%rcx
+  803aab:	73 d2                	jae    803a7f <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803aad:	41 0f b6 3f          	movzbl (%r15),%edi
+  803ab1:	48 89 ca             	mov    %rcx,%rdx
+  803ab4:	48 c1 ea 03          	shr    $0x3,%rdx
+  803ab8:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803abf:	08 10 20 
+  803ac2:	48 f7 e2             	mul    %rdx
+  803ac5:	48 c1 ea 06          	shr    $0x6,%rdx
+  803ac9:	48 89 d0             	mov    %rdx,%rax
+  803acc:	48 c1 e0 09          	shl    $0x9,%rax
+  803ad0:	48 29 d0             	sub    %rdx,%rax
+  803ad3:	48 c1 e0 03          	shl    $0x3,%rax
+  803ad7:	48 29 c1             	sub    %rax,%rcx
+  803ada:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803adf:	83 c6 01             	add    $0x1,%esi
+  803ae2:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ae5:	49 83 c7 01          	add    $0x1,%r15
+  803ae9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803aed:	49 39 c7             	cmp    %rax,%r15
+  803af0:	0f 85 75 ff ff ff    	jne    803a6b <devpipe_write+0x57>
+    return n;
+  803af6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803afa:	eb 05                	jmp    803b01 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803afc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b01:	48 83 c4 18          	add    $0x18,%rsp
+  803b05:	5b                   	pop    %rbx
+  803b06:	41 5c                	pop    %r12
+  803b08:	41 5d                	pop    %r13
+  803b0a:	41 5e                	pop    %r14
+  803b0c:	41 5f                	pop    %r15
+  803b0e:	5d                   	pop    %rbp
+  803b0f:	c3                   	ret
+
+0000000000803b10 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803b10:	55                   	push   %rbp
+  803b11:	48 89 e5             	mov    %rsp,%rbp
+  803b14:	41 57                	push   %r15
+  803b16:	41 56                	push   %r14
+  803b18:	41 55                	push   %r13
+  803b1a:	41 54                	push   %r12
+  803b1c:	53                   	push   %rbx
+  803b1d:	48 83 ec 18          	sub    $0x18,%rsp
+  803b21:	49 89 fc             	mov    %rdi,%r12
+  803b24:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b28:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b2c:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  803b33:	00 00 00 
+  803b36:	ff d0                	call   *%rax
+  803b38:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b3b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b41:	49 bd 5b 13 80 00 00 	movabs $0x80135b,%r13
+  803b48:	00 00 00 
+            sys_yield();
+  803b4b:	49 be f8 12 80 00 00 	movabs $0x8012f8,%r14
+  803b52:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b55:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b5a:	74 7d                	je     803bd9 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b5c:	8b 03                	mov    (%rbx),%eax
+  803b5e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b61:	75 26                	jne    803b89 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803b63:	4d 85 ff             	test   %r15,%r15
+  803b66:	75 77                	jne    803bdf <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b68:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b6d:	48 89 da             	mov    %rbx,%rdx
+  803b70:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b75:	4c 89 e7             	mov    %r12,%rdi
+  803b78:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b7b:	85 c0                	test   %eax,%eax
+  803b7d:	74 72                	je     803bf1 <devpipe_read+0xe1>
+            sys_yield();
+  803b7f:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b82:	8b 03                	mov    (%rbx),%eax
+  803b84:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b87:	74 df                	je     803b68 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b89:	48 63 c8             	movslq %eax,%rcx
+  803b8c:	48 89 ca             	mov    %rcx,%rdx
+  803b8f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b93:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803b9a:	08 10 20 
+  803b9d:	48 89 d0             	mov    %rdx,%rax
+  803ba0:	48 f7 e6             	mul    %rsi
+  803ba3:	48 c1 ea 06          	shr    $0x6,%rdx
+  803ba7:	48 89 d0             	mov    %rdx,%rax
+  803baa:	48 c1 e0 09          	shl    $0x9,%rax
+  803bae:	48 29 d0             	sub    %rdx,%rax
+  803bb1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803bb8:	00 
+  803bb9:	48 89 c8             	mov    %rcx,%rax
+  803bbc:	48 29 d0             	sub    %rdx,%rax
+  803bbf:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803bc4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803bc8:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803bcc:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803bcf:	49 83 c7 01          	add    $0x1,%r15
+  803bd3:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803bd7:	75 83                	jne    803b5c <devpipe_read+0x4c>
+    return n;
+  803bd9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bdd:	eb 03                	jmp    803be2 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803bdf:	4c 89 f8             	mov    %r15,%rax
+}
+  803be2:	48 83 c4 18          	add    $0x18,%rsp
+  803be6:	5b                   	pop    %rbx
+  803be7:	41 5c                	pop    %r12
+  803be9:	41 5d                	pop    %r13
+  803beb:	41 5e                	pop    %r14
+  803bed:	41 5f                	pop    %r15
+  803bef:	5d                   	pop    %rbp
+  803bf0:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bf6:	eb ea                	jmp    803be2 <devpipe_read+0xd2>
+
+0000000000803bf8 <pipe>:
+pipe(int pfd[2]) {
+  803bf8:	55                   	push   %rbp
+  803bf9:	48 89 e5             	mov    %rsp,%rbp
+  803bfc:	41 55                	push   %r13
+  803bfe:	41 54                	push   %r12
+  803c00:	53                   	push   %rbx
+  803c01:	48 83 ec 18          	sub    $0x18,%rsp
+  803c05:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c08:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c0c:	48 b8 7c 21 80 00 00 	movabs $0x80217c,%rax
+  803c13:	00 00 00 
+  803c16:	ff d0                	call   *%rax
+  803c18:	89 c3                	mov    %eax,%ebx
+  803c1a:	85 c0                	test   %eax,%eax
+  803c1c:	0f 88 a0 01 00 00    	js     803dc2 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803c22:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c27:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c2c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c30:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c35:	48 b8 87 13 80 00 00 	movabs $0x801387,%rax
+  803c3c:	00 00 00 
+  803c3f:	ff d0                	call   *%rax
+  803c41:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c43:	85 c0                	test   %eax,%eax
+  803c45:	0f 88 77 01 00 00    	js     803dc2 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c4b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c4f:	48 b8 7c 21 80 00 00 	movabs $0x80217c,%rax
+  803c56:	00 00 00 
+  803c59:	ff d0                	call   *%rax
+  803c5b:	89 c3                	mov    %eax,%ebx
+  803c5d:	85 c0                	test   %eax,%eax
+  803c5f:	0f 88 43 01 00 00    	js     803da8 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c65:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c6a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c6f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c78:	48 b8 87 13 80 00 00 	movabs $0x801387,%rax
+  803c7f:	00 00 00 
+  803c82:	ff d0                	call   *%rax
+  803c84:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c86:	85 c0                	test   %eax,%eax
+  803c88:	0f 88 1a 01 00 00    	js     803da8 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803c8e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c92:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  803c99:	00 00 00 
+  803c9c:	ff d0                	call   *%rax
+  803c9e:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803ca1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ca6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cab:	48 89 c6             	mov    %rax,%rsi
+  803cae:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb3:	48 b8 87 13 80 00 00 	movabs $0x801387,%rax
+  803cba:	00 00 00 
+  803cbd:	ff d0                	call   *%rax
+  803cbf:	89 c3                	mov    %eax,%ebx
+  803cc1:	85 c0                	test   %eax,%eax
+  803cc3:	0f 88 c5 00 00 00    	js     803d8e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803cc9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ccd:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  803cd4:	00 00 00 
+  803cd7:	ff d0                	call   *%rax
+  803cd9:	48 89 c1             	mov    %rax,%rcx
+  803cdc:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803ce2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803ce8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ced:	4c 89 ee             	mov    %r13,%rsi
+  803cf0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cf5:	48 b8 ee 13 80 00 00 	movabs $0x8013ee,%rax
+  803cfc:	00 00 00 
+  803cff:	ff d0                	call   *%rax
+  803d01:	89 c3                	mov    %eax,%ebx
+  803d03:	85 c0                	test   %eax,%eax
+  803d05:	78 6e                	js     803d75 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d07:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d0c:	4c 89 ef             	mov    %r13,%rdi
+  803d0f:	48 b8 29 13 80 00 00 	movabs $0x801329,%rax
+  803d16:	00 00 00 
+  803d19:	ff d0                	call   *%rax
+  803d1b:	83 f8 02             	cmp    $0x2,%eax
+  803d1e:	0f 85 ab 00 00 00    	jne    803dcf <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803d24:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803d2b:	00 00 
+  803d2d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d31:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803d33:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d37:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d3e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d42:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d44:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d48:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d4f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d53:	48 bb 4e 21 80 00 00 	movabs $0x80214e,%rbx
+  803d5a:	00 00 00 
+  803d5d:	ff d3                	call   *%rbx
+  803d5f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d63:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d67:	ff d3                	call   *%rbx
+  803d69:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d73:	eb 4d                	jmp    803dc2 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d75:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d7a:	4c 89 ee             	mov    %r13,%rsi
+  803d7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d82:	48 b8 66 15 80 00 00 	movabs $0x801566,%rax
+  803d89:	00 00 00 
+  803d8c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d8e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d93:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d97:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d9c:	48 b8 66 15 80 00 00 	movabs $0x801566,%rax
+  803da3:	00 00 00 
+  803da6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803da8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dad:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803db1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803db6:	48 b8 66 15 80 00 00 	movabs $0x801566,%rax
+  803dbd:	00 00 00 
+  803dc0:	ff d0                	call   *%rax
+}
+  803dc2:	89 d8                	mov    %ebx,%eax
+  803dc4:	48 83 c4 18          	add    $0x18,%rsp
+  803dc8:	5b                   	pop    %rbx
+  803dc9:	41 5c                	pop    %r12
+  803dcb:	41 5d                	pop    %r13
+  803dcd:	5d                   	pop    %rbp
+  803dce:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803dcf:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  803dd6:	00 00 00 
+  803dd9:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  803de0:	00 00 00 
+  803de3:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803de8:	48 bf 1c 57 80 00 00 	movabs $0x80571c,%rdi
+  803def:	00 00 00 
+  803df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803df7:	49 b8 d7 43 80 00 00 	movabs $0x8043d7,%r8
+  803dfe:	00 00 00 
+  803e01:	41 ff d0             	call   *%r8
+
+0000000000803e04 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e04:	55                   	push   %rbp
+  803e05:	48 89 e5             	mov    %rsp,%rbp
+  803e08:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e0c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e10:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  803e17:	00 00 00 
+  803e1a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e1c:	85 c0                	test   %eax,%eax
+  803e1e:	78 35                	js     803e55 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803e20:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e24:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  803e2b:	00 00 00 
+  803e2e:	ff d0                	call   *%rax
+  803e30:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e33:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e38:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e3d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e41:	48 b8 5b 13 80 00 00 	movabs $0x80135b,%rax
+  803e48:	00 00 00 
+  803e4b:	ff d0                	call   *%rax
+  803e4d:	85 c0                	test   %eax,%eax
+  803e4f:	0f 94 c0             	sete   %al
+  803e52:	0f b6 c0             	movzbl %al,%eax
+}
+  803e55:	c9                   	leave
+  803e56:	c3                   	ret
+
+0000000000803e57 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e57:	48 89 f8             	mov    %rdi,%rax
+  803e5a:	48 c1 e8 27          	shr    $0x27,%rax
+  803e5e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e65:	7f 00 00 
+  803e68:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e6c:	f6 c2 01             	test   $0x1,%dl
+  803e6f:	74 6d                	je     803ede <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e71:	48 89 f8             	mov    %rdi,%rax
+  803e74:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e78:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e7f:	7f 00 00 
+  803e82:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e86:	f6 c2 01             	test   $0x1,%dl
+  803e89:	74 62                	je     803eed <get_uvpt_entry+0x96>
+  803e8b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e92:	7f 00 00 
+  803e95:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e99:	f6 c2 80             	test   $0x80,%dl
+  803e9c:	75 4f                	jne    803eed <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e9e:	48 89 f8             	mov    %rdi,%rax
+  803ea1:	48 c1 e8 15          	shr    $0x15,%rax
+  803ea5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803eac:	7f 00 00 
+  803eaf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803eb3:	f6 c2 01             	test   $0x1,%dl
+  803eb6:	74 44                	je     803efc <get_uvpt_entry+0xa5>
+  803eb8:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ebf:	7f 00 00 
+  803ec2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ec6:	f6 c2 80             	test   $0x80,%dl
+  803ec9:	75 31                	jne    803efc <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803ecb:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803ecf:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803ed6:	7f 00 00 
+  803ed9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803edd:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ede:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803ee5:	7f 00 00 
+  803ee8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803eec:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803eed:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ef4:	7f 00 00 
+  803ef7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803efb:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803efc:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f03:	7f 00 00 
+  803f06:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f0a:	c3                   	ret
+
+0000000000803f0b <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803f0b:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f0e:	48 89 f9             	mov    %rdi,%rcx
+  803f11:	48 c1 e9 27          	shr    $0x27,%rcx
+  803f15:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803f1c:	7f 00 00 
+  803f1f:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803f23:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f2a:	f6 c1 01             	test   $0x1,%cl
+  803f2d:	0f 84 b2 00 00 00    	je     803fe5 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f33:	48 89 f9             	mov    %rdi,%rcx
+  803f36:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803f3a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f41:	7f 00 00 
+  803f44:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f48:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f4f:	40 f6 c6 01          	test   $0x1,%sil
+  803f53:	0f 84 8c 00 00 00    	je     803fe5 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803f59:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f60:	7f 00 00 
+  803f63:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f67:	a8 80                	test   $0x80,%al
+  803f69:	75 7b                	jne    803fe6 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f6b:	48 89 f9             	mov    %rdi,%rcx
+  803f6e:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f72:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f79:	7f 00 00 
+  803f7c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f80:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f87:	40 f6 c6 01          	test   $0x1,%sil
+  803f8b:	74 58                	je     803fe5 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803f8d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f94:	7f 00 00 
+  803f97:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f9b:	a8 80                	test   $0x80,%al
+  803f9d:	75 6c                	jne    80400b <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f9f:	48 89 f9             	mov    %rdi,%rcx
+  803fa2:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803fa6:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803fad:	7f 00 00 
+  803fb0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803fb4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803fbb:	40 f6 c6 01          	test   $0x1,%sil
+  803fbf:	74 24                	je     803fe5 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803fc1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803fc8:	7f 00 00 
+  803fcb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fcf:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fd6:	ff ff 7f 
+  803fd9:	48 21 c8             	and    %rcx,%rax
+  803fdc:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803fe2:	48 09 d0             	or     %rdx,%rax
+}
+  803fe5:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803fe6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fed:	7f 00 00 
+  803ff0:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ff4:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ffb:	ff ff 7f 
+  803ffe:	48 21 c8             	and    %rcx,%rax
+  804001:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804007:	48 01 d0             	add    %rdx,%rax
+  80400a:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80400b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804012:	7f 00 00 
+  804015:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804019:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804020:	ff ff 7f 
+  804023:	48 21 c8             	and    %rcx,%rax
+  804026:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80402c:	48 01 d0             	add    %rdx,%rax
+  80402f:	c3                   	ret
+
+0000000000804030 <get_prot>:
+
+int
+get_prot(void *va) {
+  804030:	55                   	push   %rbp
+  804031:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804034:	48 b8 57 3e 80 00 00 	movabs $0x803e57,%rax
+  80403b:	00 00 00 
+  80403e:	ff d0                	call   *%rax
+  804040:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804043:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804048:	89 c1                	mov    %eax,%ecx
+  80404a:	83 c9 04             	or     $0x4,%ecx
+  80404d:	f6 c2 01             	test   $0x1,%dl
+  804050:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804053:	89 c1                	mov    %eax,%ecx
+  804055:	83 c9 02             	or     $0x2,%ecx
+  804058:	f6 c2 02             	test   $0x2,%dl
+  80405b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80405e:	89 c1                	mov    %eax,%ecx
+  804060:	83 c9 01             	or     $0x1,%ecx
+  804063:	48 85 d2             	test   %rdx,%rdx
+  804066:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804069:	89 c1                	mov    %eax,%ecx
+  80406b:	83 c9 40             	or     $0x40,%ecx
+  80406e:	f6 c6 04             	test   $0x4,%dh
+  804071:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804074:	5d                   	pop    %rbp
+  804075:	c3                   	ret
+
+0000000000804076 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804076:	55                   	push   %rbp
+  804077:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80407a:	48 b8 57 3e 80 00 00 	movabs $0x803e57,%rax
+  804081:	00 00 00 
+  804084:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804086:	48 c1 e8 06          	shr    $0x6,%rax
+  80408a:	83 e0 01             	and    $0x1,%eax
+}
+  80408d:	5d                   	pop    %rbp
+  80408e:	c3                   	ret
+
+000000000080408f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80408f:	55                   	push   %rbp
+  804090:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804093:	48 b8 57 3e 80 00 00 	movabs $0x803e57,%rax
+  80409a:	00 00 00 
+  80409d:	ff d0                	call   *%rax
+  80409f:	83 e0 01             	and    $0x1,%eax
+}
+  8040a2:	5d                   	pop    %rbp
+  8040a3:	c3                   	ret
+
+00000000008040a4 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8040a4:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8040ab:	7f 00 00 
+  8040ae:	a8 01                	test   $0x1,%al
+  8040b0:	75 06                	jne    8040b8 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8040b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b7:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8040b8:	55                   	push   %rbp
+  8040b9:	48 89 e5             	mov    %rsp,%rbp
+  8040bc:	41 57                	push   %r15
+  8040be:	41 56                	push   %r14
+  8040c0:	41 55                	push   %r13
+  8040c2:	41 54                	push   %r12
+  8040c4:	53                   	push   %rbx
+  8040c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8040c9:	49 89 fe             	mov    %rdi,%r14
+  8040cc:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8040cf:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8040d6:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8040d7:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  8040de:	7f 00 00 
+  8040e1:	e9 81 00 00 00       	jmp    804167 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  8040e6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040ed:	49 39 dd             	cmp    %rbx,%r13
+  8040f0:	74 2b                	je     80411d <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8040f2:	48 89 d8             	mov    %rbx,%rax
+  8040f5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040f9:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  8040fd:	f6 c2 01             	test   $0x1,%dl
+  804100:	74 e4                	je     8040e6 <foreach_shared_region+0x42>
+  804102:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804106:	f6 c4 04             	test   $0x4,%ah
+  804109:	74 db                	je     8040e6 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  80410b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804112:	4c 89 fa             	mov    %r15,%rdx
+  804115:	48 89 df             	mov    %rbx,%rdi
+  804118:	41 ff d6             	call   *%r14
+  80411b:	eb c9                	jmp    8040e6 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80411d:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804124:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804128:	74 22                	je     80414c <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  80412a:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804131:	48 89 d8             	mov    %rbx,%rax
+  804134:	48 c1 e8 15          	shr    $0x15,%rax
+  804138:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  80413f:	7f 00 00 
+  804142:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804146:	a8 01                	test   $0x1,%al
+  804148:	74 d3                	je     80411d <foreach_shared_region+0x79>
+  80414a:	eb a6                	jmp    8040f2 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80414c:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804153:	40 
+  804154:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804158:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80415f:	00 00 00 
+  804162:	48 39 c1             	cmp    %rax,%rcx
+  804165:	74 31                	je     804198 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804167:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80416b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80416f:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804176:	7f 00 00 
+  804179:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80417d:	a8 01                	test   $0x1,%al
+  80417f:	74 cb                	je     80414c <foreach_shared_region+0xa8>
+  804181:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804185:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80418c:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804192:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804196:	eb 92                	jmp    80412a <foreach_shared_region+0x86>
+}
+  804198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419d:	48 83 c4 18          	add    $0x18,%rsp
+  8041a1:	5b                   	pop    %rbx
+  8041a2:	41 5c                	pop    %r12
+  8041a4:	41 5d                	pop    %r13
+  8041a6:	41 5e                	pop    %r14
+  8041a8:	41 5f                	pop    %r15
+  8041aa:	5d                   	pop    %rbp
+  8041ab:	c3                   	ret
+
+00000000008041ac <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8041ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b1:	c3                   	ret
+
+00000000008041b2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8041b2:	55                   	push   %rbp
+  8041b3:	48 89 e5             	mov    %rsp,%rbp
+  8041b6:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8041b9:	48 be 54 57 80 00 00 	movabs $0x805754,%rsi
+  8041c0:	00 00 00 
+  8041c3:	48 b8 27 0c 80 00 00 	movabs $0x800c27,%rax
+  8041ca:	00 00 00 
+  8041cd:	ff d0                	call   *%rax
+    return 0;
+}
+  8041cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d4:	5d                   	pop    %rbp
+  8041d5:	c3                   	ret
+
+00000000008041d6 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8041d6:	55                   	push   %rbp
+  8041d7:	48 89 e5             	mov    %rsp,%rbp
+  8041da:	41 57                	push   %r15
+  8041dc:	41 56                	push   %r14
+  8041de:	41 55                	push   %r13
+  8041e0:	41 54                	push   %r12
+  8041e2:	53                   	push   %rbx
+  8041e3:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8041ea:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8041f1:	48 85 d2             	test   %rdx,%rdx
+  8041f4:	74 7a                	je     804270 <devcons_write+0x9a>
+  8041f6:	49 89 d6             	mov    %rdx,%r14
+  8041f9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041ff:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804204:	49 bf b5 0f 80 00 00 	movabs $0x800fb5,%r15
+  80420b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80420e:	4c 89 f3             	mov    %r14,%rbx
+  804211:	48 29 f3             	sub    %rsi,%rbx
+  804214:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804219:	48 39 c3             	cmp    %rax,%rbx
+  80421c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804220:	4c 63 eb             	movslq %ebx,%r13
+  804223:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80422a:	48 01 c6             	add    %rax,%rsi
+  80422d:	4c 89 ea             	mov    %r13,%rdx
+  804230:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804237:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80423a:	4c 89 ee             	mov    %r13,%rsi
+  80423d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804244:	48 b8 fe 11 80 00 00 	movabs $0x8011fe,%rax
+  80424b:	00 00 00 
+  80424e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804250:	41 01 dc             	add    %ebx,%r12d
+  804253:	49 63 f4             	movslq %r12d,%rsi
+  804256:	4c 39 f6             	cmp    %r14,%rsi
+  804259:	72 b3                	jb     80420e <devcons_write+0x38>
+    return res;
+  80425b:	49 63 c4             	movslq %r12d,%rax
+}
+  80425e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804265:	5b                   	pop    %rbx
+  804266:	41 5c                	pop    %r12
+  804268:	41 5d                	pop    %r13
+  80426a:	41 5e                	pop    %r14
+  80426c:	41 5f                	pop    %r15
+  80426e:	5d                   	pop    %rbp
+  80426f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804270:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804276:	eb e3                	jmp    80425b <devcons_write+0x85>
+
+0000000000804278 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804278:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80427b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804280:	48 85 c0             	test   %rax,%rax
+  804283:	74 55                	je     8042da <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804285:	55                   	push   %rbp
+  804286:	48 89 e5             	mov    %rsp,%rbp
+  804289:	41 55                	push   %r13
+  80428b:	41 54                	push   %r12
+  80428d:	53                   	push   %rbx
+  80428e:	48 83 ec 08          	sub    $0x8,%rsp
+  804292:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804295:	48 bb 2b 12 80 00 00 	movabs $0x80122b,%rbx
+  80429c:	00 00 00 
+  80429f:	49 bc f8 12 80 00 00 	movabs $0x8012f8,%r12
+  8042a6:	00 00 00 
+  8042a9:	eb 03                	jmp    8042ae <devcons_read+0x36>
+  8042ab:	41 ff d4             	call   *%r12
+  8042ae:	ff d3                	call   *%rbx
+  8042b0:	85 c0                	test   %eax,%eax
+  8042b2:	74 f7                	je     8042ab <devcons_read+0x33>
+    if (c < 0) return c;
+  8042b4:	48 63 d0             	movslq %eax,%rdx
+  8042b7:	78 13                	js     8042cc <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8042b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042be:	83 f8 04             	cmp    $0x4,%eax
+  8042c1:	74 09                	je     8042cc <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8042c3:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8042c7:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8042cc:	48 89 d0             	mov    %rdx,%rax
+  8042cf:	48 83 c4 08          	add    $0x8,%rsp
+  8042d3:	5b                   	pop    %rbx
+  8042d4:	41 5c                	pop    %r12
+  8042d6:	41 5d                	pop    %r13
+  8042d8:	5d                   	pop    %rbp
+  8042d9:	c3                   	ret
+  8042da:	48 89 d0             	mov    %rdx,%rax
+  8042dd:	c3                   	ret
+
+00000000008042de <cputchar>:
+cputchar(int ch) {
+  8042de:	55                   	push   %rbp
+  8042df:	48 89 e5             	mov    %rsp,%rbp
+  8042e2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8042e6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8042ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8042ef:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8042f3:	48 b8 fe 11 80 00 00 	movabs $0x8011fe,%rax
+  8042fa:	00 00 00 
+  8042fd:	ff d0                	call   *%rax
+}
+  8042ff:	c9                   	leave
+  804300:	c3                   	ret
+
+0000000000804301 <getchar>:
+getchar(void) {
+  804301:	55                   	push   %rbp
+  804302:	48 89 e5             	mov    %rsp,%rbp
+  804305:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804309:	ba 01 00 00 00       	mov    $0x1,%edx
+  80430e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804312:	bf 00 00 00 00       	mov    $0x0,%edi
+  804317:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  80431e:	00 00 00 
+  804321:	ff d0                	call   *%rax
+  804323:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804325:	85 c0                	test   %eax,%eax
+  804327:	78 06                	js     80432f <getchar+0x2e>
+  804329:	74 08                	je     804333 <getchar+0x32>
+  80432b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80432f:	89 d0                	mov    %edx,%eax
+  804331:	c9                   	leave
+  804332:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804333:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804338:	eb f5                	jmp    80432f <getchar+0x2e>
+
+000000000080433a <iscons>:
+iscons(int fdnum) {
+  80433a:	55                   	push   %rbp
+  80433b:	48 89 e5             	mov    %rsp,%rbp
+  80433e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804342:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804346:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  80434d:	00 00 00 
+  804350:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804352:	85 c0                	test   %eax,%eax
+  804354:	78 18                	js     80436e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804356:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80435a:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804361:	00 00 00 
+  804364:	8b 00                	mov    (%rax),%eax
+  804366:	39 02                	cmp    %eax,(%rdx)
+  804368:	0f 94 c0             	sete   %al
+  80436b:	0f b6 c0             	movzbl %al,%eax
+}
+  80436e:	c9                   	leave
+  80436f:	c3                   	ret
+
+0000000000804370 <opencons>:
+opencons(void) {
+  804370:	55                   	push   %rbp
+  804371:	48 89 e5             	mov    %rsp,%rbp
+  804374:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804378:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80437c:	48 b8 7c 21 80 00 00 	movabs $0x80217c,%rax
+  804383:	00 00 00 
+  804386:	ff d0                	call   *%rax
+  804388:	85 c0                	test   %eax,%eax
+  80438a:	78 49                	js     8043d5 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80438c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804391:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804396:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80439a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80439f:	48 b8 87 13 80 00 00 	movabs $0x801387,%rax
+  8043a6:	00 00 00 
+  8043a9:	ff d0                	call   *%rax
+  8043ab:	85 c0                	test   %eax,%eax
+  8043ad:	78 26                	js     8043d5 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8043af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043b3:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8043ba:	00 00 
+  8043bc:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8043be:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043c2:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8043c9:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  8043d0:	00 00 00 
+  8043d3:	ff d0                	call   *%rax
+}
+  8043d5:	c9                   	leave
+  8043d6:	c3                   	ret
+
+00000000008043d7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8043d7:	55                   	push   %rbp
+  8043d8:	48 89 e5             	mov    %rsp,%rbp
+  8043db:	41 56                	push   %r14
+  8043dd:	41 55                	push   %r13
+  8043df:	41 54                	push   %r12
+  8043e1:	53                   	push   %rbx
+  8043e2:	48 83 ec 50          	sub    $0x50,%rsp
+  8043e6:	49 89 fc             	mov    %rdi,%r12
+  8043e9:	41 89 f5             	mov    %esi,%r13d
+  8043ec:	48 89 d3             	mov    %rdx,%rbx
+  8043ef:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8043f3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8043f7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8043fb:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  804402:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804406:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80440a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80440e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  804412:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804419:	00 00 00 
+  80441c:	4c 8b 30             	mov    (%rax),%r14
+  80441f:	48 b8 c7 12 80 00 00 	movabs $0x8012c7,%rax
+  804426:	00 00 00 
+  804429:	ff d0                	call   *%rax
+  80442b:	89 c6                	mov    %eax,%esi
+  80442d:	45 89 e8             	mov    %r13d,%r8d
+  804430:	4c 89 e1             	mov    %r12,%rcx
+  804433:	4c 89 f2             	mov    %r14,%rdx
+  804436:	48 bf 60 57 80 00 00 	movabs $0x805760,%rdi
+  80443d:	00 00 00 
+  804440:	b8 00 00 00 00       	mov    $0x0,%eax
+  804445:	49 bc af 02 80 00 00 	movabs $0x8002af,%r12
+  80444c:	00 00 00 
+  80444f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  804452:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  804456:	48 89 df             	mov    %rbx,%rdi
+  804459:	48 b8 4b 02 80 00 00 	movabs $0x80024b,%rax
+  804460:	00 00 00 
+  804463:	ff d0                	call   *%rax
+    cprintf("\n");
+  804465:	48 bf b3 56 80 00 00 	movabs $0x8056b3,%rdi
+  80446c:	00 00 00 
+  80446f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804474:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804477:	cc                   	int3
+  804478:	eb fd                	jmp    804477 <_panic+0xa0>
+
+000000000080447a <__text_end>:
+  80447a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804481:	00 00 00 
+  804484:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448b:	00 00 00 
+  80448e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804495:	00 00 00 
+  804498:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449f:	00 00 00 
+  8044a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a9:	00 00 00 
+  8044ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b3:	00 00 00 
+  8044b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bd:	00 00 00 
+  8044c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c7:	00 00 00 
+  8044ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d1:	00 00 00 
+  8044d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044db:	00 00 00 
+  8044de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e5:	00 00 00 
+  8044e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ef:	00 00 00 
+  8044f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f9:	00 00 00 
+  8044fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804503:	00 00 00 
+  804506:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450d:	00 00 00 
+  804510:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804517:	00 00 00 
+  80451a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804521:	00 00 00 
+  804524:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452b:	00 00 00 
+  80452e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804535:	00 00 00 
+  804538:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453f:	00 00 00 
+  804542:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804549:	00 00 00 
+  80454c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804553:	00 00 00 
+  804556:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455d:	00 00 00 
+  804560:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804567:	00 00 00 
+  80456a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804571:	00 00 00 
+  804574:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457b:	00 00 00 
+  80457e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804585:	00 00 00 
+  804588:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458f:	00 00 00 
+  804592:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804599:	00 00 00 
+  80459c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a3:	00 00 00 
+  8045a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ad:	00 00 00 
+  8045b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b7:	00 00 00 
+  8045ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c1:	00 00 00 
+  8045c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cb:	00 00 00 
+  8045ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d5:	00 00 00 
+  8045d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045df:	00 00 00 
+  8045e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e9:	00 00 00 
+  8045ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f3:	00 00 00 
+  8045f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fd:	00 00 00 
+  804600:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804607:	00 00 00 
+  80460a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804611:	00 00 00 
+  804614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461b:	00 00 00 
+  80461e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804625:	00 00 00 
+  804628:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462f:	00 00 00 
+  804632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804639:	00 00 00 
+  80463c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804643:	00 00 00 
+  804646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464d:	00 00 00 
+  804650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804657:	00 00 00 
+  80465a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804661:	00 00 00 
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467f:	00 00 00 
+  804682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804689:	00 00 00 
+  80468c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804693:	00 00 00 
+  804696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469d:	00 00 00 
+  8046a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a7:	00 00 00 
+  8046aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b1:	00 00 00 
+  8046b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bb:	00 00 00 
+  8046be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c5:	00 00 00 
+  8046c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cf:	00 00 00 
+  8046d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d9:	00 00 00 
+  8046dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e3:	00 00 00 
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
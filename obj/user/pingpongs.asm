@@ -0,0 +1,8198 @@
+
+obj/user/pingpongs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 6d 01 00 00       	call   800190 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+uint32_t val;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = sfork()) != 0) {
+  800036:	48 b8 d7 1e 80 00 00 	movabs $0x801ed7,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	0f 85 c3 00 00 00    	jne    800110 <umain+0xeb>
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        ipc_recv(&who, 0, 0, 0);
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  80004d:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  800054:	00 00 00 
+        ipc_recv(&who, 0, 0, 0);
+  800057:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80005c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800061:	be 00 00 00 00       	mov    $0x0,%esi
+  800066:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80006a:	48 b8 05 1f 80 00 00 	movabs $0x801f05,%rax
+  800071:	00 00 00 
+  800074:	ff d0                	call   *%rax
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800076:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80007d:	00 00 00 
+  800080:	4c 8b 20             	mov    (%rax),%r12
+  800083:	45 8b bc 24 c8 00 00 	mov    0xc8(%r12),%r15d
+  80008a:	00 
+  80008b:	44 8b 75 cc          	mov    -0x34(%rbp),%r14d
+  80008f:	44 8b 2b             	mov    (%rbx),%r13d
+  800092:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	89 c6                	mov    %eax,%esi
+  8000a0:	45 89 f9             	mov    %r15d,%r9d
+  8000a3:	4d 89 e0             	mov    %r12,%r8
+  8000a6:	44 89 f1             	mov    %r14d,%ecx
+  8000a9:	44 89 ea             	mov    %r13d,%edx
+  8000ac:	48 bf 30 50 80 00 00 	movabs $0x805030,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	49 ba 09 03 80 00 00 	movabs $0x800309,%r10
+  8000c2:	00 00 00 
+  8000c5:	41 ff d2             	call   *%r10
+        if (val == 10) return;
+  8000c8:	8b 03                	mov    (%rbx),%eax
+  8000ca:	83 f8 0a             	cmp    $0xa,%eax
+  8000cd:	74 32                	je     800101 <umain+0xdc>
+        ++val;
+  8000cf:	83 c0 01             	add    $0x1,%eax
+  8000d2:	89 03                	mov    %eax,(%rbx)
+        ipc_send(who, 0, 0, 0, 0);
+  8000d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e9:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000ec:	48 b8 b5 20 80 00 00 	movabs $0x8020b5,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        if (val == 10) return;
+  8000f8:	83 3b 0a             	cmpl   $0xa,(%rbx)
+  8000fb:	0f 85 56 ff ff ff    	jne    800057 <umain+0x32>
+    }
+}
+  800101:	48 83 c4 18          	add    $0x18,%rsp
+  800105:	5b                   	pop    %rbx
+  800106:	41 5c                	pop    %r12
+  800108:	41 5d                	pop    %r13
+  80010a:	41 5e                	pop    %r14
+  80010c:	41 5f                	pop    %r15
+  80010e:	5d                   	pop    %rbp
+  80010f:	c3                   	ret
+        cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  800110:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800117:	00 00 00 
+  80011a:	48 8b 18             	mov    (%rax),%rbx
+  80011d:	49 bc 21 13 80 00 00 	movabs $0x801321,%r12
+  800124:	00 00 00 
+  800127:	41 ff d4             	call   *%r12
+  80012a:	89 c6                	mov    %eax,%esi
+  80012c:	48 89 da             	mov    %rbx,%rdx
+  80012f:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 bb 09 03 80 00 00 	movabs $0x800309,%rbx
+  800145:	00 00 00 
+  800148:	ff d3                	call   *%rbx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  80014a:	44 8b 6d cc          	mov    -0x34(%rbp),%r13d
+  80014e:	41 ff d4             	call   *%r12
+  800151:	89 c6                	mov    %eax,%esi
+  800153:	44 89 ea             	mov    %r13d,%edx
+  800156:	48 bf 1a 50 80 00 00 	movabs $0x80501a,%rdi
+  80015d:	00 00 00 
+  800160:	b8 00 00 00 00       	mov    $0x0,%eax
+  800165:	ff d3                	call   *%rbx
+        ipc_send(who, 0, 0, 0, 0);
+  800167:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80016d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800172:	ba 00 00 00 00       	mov    $0x0,%edx
+  800177:	be 00 00 00 00       	mov    $0x0,%esi
+  80017c:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80017f:	48 b8 b5 20 80 00 00 	movabs $0x8020b5,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+  80018b:	e9 bd fe ff ff       	jmp    80004d <umain+0x28>
+
+0000000000800190 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800190:	55                   	push   %rbp
+  800191:	48 89 e5             	mov    %rsp,%rbp
+  800194:	41 56                	push   %r14
+  800196:	41 55                	push   %r13
+  800198:	41 54                	push   %r12
+  80019a:	53                   	push   %rbx
+  80019b:	41 89 fd             	mov    %edi,%r13d
+  80019e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001a1:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8001a8:	00 00 00 
+  8001ab:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8001b2:	00 00 00 
+  8001b5:	48 39 c2             	cmp    %rax,%rdx
+  8001b8:	73 17                	jae    8001d1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001ba:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001bd:	49 89 c4             	mov    %rax,%r12
+  8001c0:	48 83 c3 08          	add    $0x8,%rbx
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c9:	ff 53 f8             	call   *-0x8(%rbx)
+  8001cc:	4c 39 e3             	cmp    %r12,%rbx
+  8001cf:	72 ef                	jb     8001c0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001d1:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8001d8:	00 00 00 
+  8001db:	ff d0                	call   *%rax
+  8001dd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e2:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8001e9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001f0:	00 00 00 
+  8001f3:	48 01 d0             	add    %rdx,%rax
+  8001f6:	48 a3 08 70 80 00 00 	movabs %rax,0x807008
+  8001fd:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800200:	45 85 ed             	test   %r13d,%r13d
+  800203:	7e 0d                	jle    800212 <libmain+0x82>
+  800205:	49 8b 06             	mov    (%r14),%rax
+  800208:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80020f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800212:	4c 89 f6             	mov    %r14,%rsi
+  800215:	44 89 ef             	mov    %r13d,%edi
+  800218:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80021f:	00 00 00 
+  800222:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800224:	48 b8 39 02 80 00 00 	movabs $0x800239,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+#endif
+}
+  800230:	5b                   	pop    %rbx
+  800231:	41 5c                	pop    %r12
+  800233:	41 5d                	pop    %r13
+  800235:	41 5e                	pop    %r14
+  800237:	5d                   	pop    %rbp
+  800238:	c3                   	ret
+
+0000000000800239 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800239:	55                   	push   %rbp
+  80023a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80023d:	48 b8 ce 23 80 00 00 	movabs $0x8023ce,%rax
+  800244:	00 00 00 
+  800247:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800249:	bf 00 00 00 00       	mov    $0x0,%edi
+  80024e:	48 b8 b6 12 80 00 00 	movabs $0x8012b6,%rax
+  800255:	00 00 00 
+  800258:	ff d0                	call   *%rax
+}
+  80025a:	5d                   	pop    %rbp
+  80025b:	c3                   	ret
+
+000000000080025c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80025c:	55                   	push   %rbp
+  80025d:	48 89 e5             	mov    %rsp,%rbp
+  800260:	53                   	push   %rbx
+  800261:	48 83 ec 08          	sub    $0x8,%rsp
+  800265:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800268:	8b 06                	mov    (%rsi),%eax
+  80026a:	8d 50 01             	lea    0x1(%rax),%edx
+  80026d:	89 16                	mov    %edx,(%rsi)
+  80026f:	48 98                	cltq
+  800271:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800276:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80027c:	74 0a                	je     800288 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80027e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800282:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800286:	c9                   	leave
+  800287:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800288:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80028c:	be ff 00 00 00       	mov    $0xff,%esi
+  800291:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  800298:	00 00 00 
+  80029b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80029d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002a3:	eb d9                	jmp    80027e <putch+0x22>
+
+00000000008002a5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002a5:	55                   	push   %rbp
+  8002a6:	48 89 e5             	mov    %rsp,%rbp
+  8002a9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002b0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002b3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002ba:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002c7:	48 89 f1             	mov    %rsi,%rcx
+  8002ca:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002d1:	48 bf 5c 02 80 00 00 	movabs $0x80025c,%rdi
+  8002d8:	00 00 00 
+  8002db:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  8002e2:	00 00 00 
+  8002e5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002e7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002ee:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002f5:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  8002fc:	00 00 00 
+  8002ff:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800301:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800307:	c9                   	leave
+  800308:	c3                   	ret
+
+0000000000800309 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800309:	55                   	push   %rbp
+  80030a:	48 89 e5             	mov    %rsp,%rbp
+  80030d:	48 83 ec 50          	sub    $0x50,%rsp
+  800311:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800315:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800319:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80031d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800321:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800325:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80032c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800330:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800334:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800338:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80033c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800340:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  800347:	00 00 00 
+  80034a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80034c:	c9                   	leave
+  80034d:	c3                   	ret
+
+000000000080034e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80034e:	55                   	push   %rbp
+  80034f:	48 89 e5             	mov    %rsp,%rbp
+  800352:	41 57                	push   %r15
+  800354:	41 56                	push   %r14
+  800356:	41 55                	push   %r13
+  800358:	41 54                	push   %r12
+  80035a:	53                   	push   %rbx
+  80035b:	48 83 ec 18          	sub    $0x18,%rsp
+  80035f:	49 89 fc             	mov    %rdi,%r12
+  800362:	49 89 f5             	mov    %rsi,%r13
+  800365:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800369:	8b 45 10             	mov    0x10(%rbp),%eax
+  80036c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80036f:	41 89 cf             	mov    %ecx,%r15d
+  800372:	4c 39 fa             	cmp    %r15,%rdx
+  800375:	73 5b                	jae    8003d2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800377:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80037b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80037f:	85 db                	test   %ebx,%ebx
+  800381:	7e 0e                	jle    800391 <print_num+0x43>
+            putch(padc, put_arg);
+  800383:	4c 89 ee             	mov    %r13,%rsi
+  800386:	44 89 f7             	mov    %r14d,%edi
+  800389:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80038c:	83 eb 01             	sub    $0x1,%ebx
+  80038f:	75 f2                	jne    800383 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800391:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800395:	48 b9 71 50 80 00 00 	movabs $0x805071,%rcx
+  80039c:	00 00 00 
+  80039f:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8003a6:	00 00 00 
+  8003a9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b6:	49 f7 f7             	div    %r15
+  8003b9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003bd:	4c 89 ee             	mov    %r13,%rsi
+  8003c0:	41 ff d4             	call   *%r12
+}
+  8003c3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003c7:	5b                   	pop    %rbx
+  8003c8:	41 5c                	pop    %r12
+  8003ca:	41 5d                	pop    %r13
+  8003cc:	41 5e                	pop    %r14
+  8003ce:	41 5f                	pop    %r15
+  8003d0:	5d                   	pop    %rbp
+  8003d1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003db:	49 f7 f7             	div    %r15
+  8003de:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003e6:	52                   	push   %rdx
+  8003e7:	45 0f be c9          	movsbl %r9b,%r9d
+  8003eb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003ef:	48 89 c2             	mov    %rax,%rdx
+  8003f2:	48 b8 4e 03 80 00 00 	movabs $0x80034e,%rax
+  8003f9:	00 00 00 
+  8003fc:	ff d0                	call   *%rax
+  8003fe:	48 83 c4 10          	add    $0x10,%rsp
+  800402:	eb 8d                	jmp    800391 <print_num+0x43>
+
+0000000000800404 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800404:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800408:	48 8b 06             	mov    (%rsi),%rax
+  80040b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80040f:	73 0a                	jae    80041b <sprintputch+0x17>
+        *state->start++ = ch;
+  800411:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800415:	48 89 16             	mov    %rdx,(%rsi)
+  800418:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80041b:	c3                   	ret
+
+000000000080041c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80041c:	55                   	push   %rbp
+  80041d:	48 89 e5             	mov    %rsp,%rbp
+  800420:	48 83 ec 50          	sub    $0x50,%rsp
+  800424:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800428:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80042c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800430:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800437:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80043b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80043f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800443:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800447:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80044b:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  800452:	00 00 00 
+  800455:	ff d0                	call   *%rax
+}
+  800457:	c9                   	leave
+  800458:	c3                   	ret
+
+0000000000800459 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800459:	55                   	push   %rbp
+  80045a:	48 89 e5             	mov    %rsp,%rbp
+  80045d:	41 57                	push   %r15
+  80045f:	41 56                	push   %r14
+  800461:	41 55                	push   %r13
+  800463:	41 54                	push   %r12
+  800465:	53                   	push   %rbx
+  800466:	48 83 ec 38          	sub    $0x38,%rsp
+  80046a:	49 89 fe             	mov    %rdi,%r14
+  80046d:	49 89 f5             	mov    %rsi,%r13
+  800470:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800473:	48 8b 01             	mov    (%rcx),%rax
+  800476:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80047a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80047e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800482:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800486:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80048a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80048e:	0f b6 3b             	movzbl (%rbx),%edi
+  800491:	40 80 ff 25          	cmp    $0x25,%dil
+  800495:	74 18                	je     8004af <vprintfmt+0x56>
+            if (!ch) return;
+  800497:	40 84 ff             	test   %dil,%dil
+  80049a:	0f 84 04 07 00 00    	je     800ba4 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8004a0:	40 0f b6 ff          	movzbl %dil,%edi
+  8004a4:	4c 89 ee             	mov    %r13,%rsi
+  8004a7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004aa:	4c 89 e3             	mov    %r12,%rbx
+  8004ad:	eb db                	jmp    80048a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004af:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004b8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004bd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004c3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004ca:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004ce:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004d3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004d8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004db:	83 e8 23             	sub    $0x23,%eax
+  8004de:	3c 57                	cmp    $0x57,%al
+  8004e0:	0f 87 a4 06 00 00    	ja     800b8a <vprintfmt+0x731>
+  8004e6:	0f b6 c0             	movzbl %al,%eax
+  8004e9:	48 b9 00 52 80 00 00 	movabs $0x805200,%rcx
+  8004f0:	00 00 00 
+  8004f3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004f6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004f9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004fd:	eb cf                	jmp    8004ce <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004ff:	49 89 dc             	mov    %rbx,%r12
+  800502:	be 01 00 00 00       	mov    $0x1,%esi
+  800507:	eb c5                	jmp    8004ce <vprintfmt+0x75>
+            padc = ch;
+  800509:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80050d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800510:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800513:	eb b9                	jmp    8004ce <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800515:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800518:	83 f8 2f             	cmp    $0x2f,%eax
+  80051b:	77 24                	ja     800541 <vprintfmt+0xe8>
+  80051d:	89 c1                	mov    %eax,%ecx
+  80051f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800523:	83 c0 08             	add    $0x8,%eax
+  800526:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800529:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80052c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80052f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800533:	79 99                	jns    8004ce <vprintfmt+0x75>
+                width = precision;
+  800535:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800539:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80053f:	eb 8d                	jmp    8004ce <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800541:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800545:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800549:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054d:	eb da                	jmp    800529 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80054f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800554:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800558:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80055e:	3c 39                	cmp    $0x39,%al
+  800560:	77 1c                	ja     80057e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800562:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800566:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80056a:	0f b6 c0             	movzbl %al,%eax
+  80056d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800572:	0f b6 03             	movzbl (%rbx),%eax
+  800575:	3c 39                	cmp    $0x39,%al
+  800577:	76 e9                	jbe    800562 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800579:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80057c:	eb b1                	jmp    80052f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80057e:	49 89 dc             	mov    %rbx,%r12
+  800581:	eb ac                	jmp    80052f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800583:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800586:	85 c9                	test   %ecx,%ecx
+  800588:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058d:	0f 49 c1             	cmovns %ecx,%eax
+  800590:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800593:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800596:	e9 33 ff ff ff       	jmp    8004ce <vprintfmt+0x75>
+            lflag++;
+  80059b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80059e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005a1:	e9 28 ff ff ff       	jmp    8004ce <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ac:	77 19                	ja     8005c7 <vprintfmt+0x16e>
+  8005ae:	89 c2                	mov    %eax,%edx
+  8005b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005b4:	83 c0 08             	add    $0x8,%eax
+  8005b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005ba:	8b 3a                	mov    (%rdx),%edi
+  8005bc:	4c 89 ee             	mov    %r13,%rsi
+  8005bf:	41 ff d6             	call   *%r14
+            break;
+  8005c2:	e9 c3 fe ff ff       	jmp    80048a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d3:	eb e5                	jmp    8005ba <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005db:	77 5a                	ja     800637 <vprintfmt+0x1de>
+  8005dd:	89 c2                	mov    %eax,%edx
+  8005df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e3:	83 c0 08             	add    $0x8,%eax
+  8005e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005e9:	8b 02                	mov    (%rdx),%eax
+  8005eb:	89 c1                	mov    %eax,%ecx
+  8005ed:	f7 d9                	neg    %ecx
+  8005ef:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005f2:	83 f9 13             	cmp    $0x13,%ecx
+  8005f5:	7f 4e                	jg     800645 <vprintfmt+0x1ec>
+  8005f7:	48 63 c1             	movslq %ecx,%rax
+  8005fa:	48 ba c0 54 80 00 00 	movabs $0x8054c0,%rdx
+  800601:	00 00 00 
+  800604:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800608:	48 85 c0             	test   %rax,%rax
+  80060b:	74 38                	je     800645 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80060d:	48 89 c1             	mov    %rax,%rcx
+  800610:	48 ba 39 57 80 00 00 	movabs $0x805739,%rdx
+  800617:	00 00 00 
+  80061a:	4c 89 ee             	mov    %r13,%rsi
+  80061d:	4c 89 f7             	mov    %r14,%rdi
+  800620:	b8 00 00 00 00       	mov    $0x0,%eax
+  800625:	49 b8 1c 04 80 00 00 	movabs $0x80041c,%r8
+  80062c:	00 00 00 
+  80062f:	41 ff d0             	call   *%r8
+  800632:	e9 53 fe ff ff       	jmp    80048a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800637:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800643:	eb a4                	jmp    8005e9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800645:	48 ba 89 50 80 00 00 	movabs $0x805089,%rdx
+  80064c:	00 00 00 
+  80064f:	4c 89 ee             	mov    %r13,%rsi
+  800652:	4c 89 f7             	mov    %r14,%rdi
+  800655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065a:	49 b8 1c 04 80 00 00 	movabs $0x80041c,%r8
+  800661:	00 00 00 
+  800664:	41 ff d0             	call   *%r8
+  800667:	e9 1e fe ff ff       	jmp    80048a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80066c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066f:	83 f8 2f             	cmp    $0x2f,%eax
+  800672:	77 36                	ja     8006aa <vprintfmt+0x251>
+  800674:	89 c2                	mov    %eax,%edx
+  800676:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067a:	83 c0 08             	add    $0x8,%eax
+  80067d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800680:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800683:	48 85 f6             	test   %rsi,%rsi
+  800686:	48 b8 82 50 80 00 00 	movabs $0x805082,%rax
+  80068d:	00 00 00 
+  800690:	48 0f 45 c6          	cmovne %rsi,%rax
+  800694:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800698:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80069c:	7e 06                	jle    8006a4 <vprintfmt+0x24b>
+  80069e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006a2:	75 14                	jne    8006b8 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006a4:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8006a8:	eb 5b                	jmp    800705 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8006aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b6:	eb c8                	jmp    800680 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006b8:	49 63 f7             	movslq %r15d,%rsi
+  8006bb:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006bf:	48 b8 5e 0c 80 00 00 	movabs $0x800c5e,%rax
+  8006c6:	00 00 00 
+  8006c9:	ff d0                	call   *%rax
+  8006cb:	48 89 c2             	mov    %rax,%rdx
+  8006ce:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006d1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006d3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006d6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006d9:	85 c0                	test   %eax,%eax
+  8006db:	7e c7                	jle    8006a4 <vprintfmt+0x24b>
+  8006dd:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006e2:	4c 89 ee             	mov    %r13,%rsi
+  8006e5:	44 89 e7             	mov    %r12d,%edi
+  8006e8:	41 ff d6             	call   *%r14
+  8006eb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006ef:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006f2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006f5:	75 eb                	jne    8006e2 <vprintfmt+0x289>
+  8006f7:	eb ab                	jmp    8006a4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006f9:	0f b6 f8             	movzbl %al,%edi
+  8006fc:	4c 89 ee             	mov    %r13,%rsi
+  8006ff:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800702:	4c 89 e2             	mov    %r12,%rdx
+  800705:	45 85 ff             	test   %r15d,%r15d
+  800708:	78 06                	js     800710 <vprintfmt+0x2b7>
+  80070a:	41 83 ef 01          	sub    $0x1,%r15d
+  80070e:	78 23                	js     800733 <vprintfmt+0x2da>
+  800710:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800714:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80071a:	84 c0                	test   %al,%al
+  80071c:	74 15                	je     800733 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80071e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800722:	74 d5                	je     8006f9 <vprintfmt+0x2a0>
+  800724:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800727:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80072c:	80 fa 5e             	cmp    $0x5e,%dl
+  80072f:	77 cb                	ja     8006fc <vprintfmt+0x2a3>
+  800731:	eb c6                	jmp    8006f9 <vprintfmt+0x2a0>
+  800733:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800736:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800739:	01 f0                	add    %esi,%eax
+  80073b:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80073d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800741:	85 c0                	test   %eax,%eax
+  800743:	0f 8e 41 fd ff ff    	jle    80048a <vprintfmt+0x31>
+  800749:	4c 89 ee             	mov    %r13,%rsi
+  80074c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800751:	41 ff d6             	call   *%r14
+  800754:	41 83 ec 01          	sub    $0x1,%r12d
+  800758:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80075c:	75 eb                	jne    800749 <vprintfmt+0x2f0>
+  80075e:	e9 27 fd ff ff       	jmp    80048a <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800763:	40 84 f6             	test   %sil,%sil
+  800766:	75 26                	jne    80078e <vprintfmt+0x335>
+    switch (lflag) {
+  800768:	85 d2                	test   %edx,%edx
+  80076a:	74 59                	je     8007c5 <vprintfmt+0x36c>
+  80076c:	83 fa 01             	cmp    $0x1,%edx
+  80076f:	74 7b                	je     8007ec <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800771:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800774:	83 f8 2f             	cmp    $0x2f,%eax
+  800777:	0f 87 96 00 00 00    	ja     800813 <vprintfmt+0x3ba>
+  80077d:	89 c2                	mov    %eax,%edx
+  80077f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800783:	83 c0 08             	add    $0x8,%eax
+  800786:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800789:	4c 8b 22             	mov    (%rdx),%r12
+  80078c:	eb 17                	jmp    8007a5 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80078e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800791:	83 f8 2f             	cmp    $0x2f,%eax
+  800794:	77 21                	ja     8007b7 <vprintfmt+0x35e>
+  800796:	89 c2                	mov    %eax,%edx
+  800798:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079c:	83 c0 08             	add    $0x8,%eax
+  80079f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007a5:	4d 85 e4             	test   %r12,%r12
+  8007a8:	78 7a                	js     800824 <vprintfmt+0x3cb>
+            num = i;
+  8007aa:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007b2:	e9 b5 02 00 00       	jmp    800a6c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8007b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c3:	eb dd                	jmp    8007a2 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8007c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cb:	77 11                	ja     8007de <vprintfmt+0x385>
+  8007cd:	89 c2                	mov    %eax,%edx
+  8007cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d3:	83 c0 08             	add    $0x8,%eax
+  8007d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d9:	4c 63 22             	movslq (%rdx),%r12
+  8007dc:	eb c7                	jmp    8007a5 <vprintfmt+0x34c>
+  8007de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ea:	eb ed                	jmp    8007d9 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8007ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f2:	77 11                	ja     800805 <vprintfmt+0x3ac>
+  8007f4:	89 c2                	mov    %eax,%edx
+  8007f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fa:	83 c0 08             	add    $0x8,%eax
+  8007fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800800:	4c 8b 22             	mov    (%rdx),%r12
+  800803:	eb a0                	jmp    8007a5 <vprintfmt+0x34c>
+  800805:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800809:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80080d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800811:	eb ed                	jmp    800800 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800813:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800817:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081f:	e9 65 ff ff ff       	jmp    800789 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800824:	4c 89 ee             	mov    %r13,%rsi
+  800827:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80082c:	41 ff d6             	call   *%r14
+                i = -i;
+  80082f:	49 f7 dc             	neg    %r12
+  800832:	e9 73 ff ff ff       	jmp    8007aa <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800837:	40 84 f6             	test   %sil,%sil
+  80083a:	75 32                	jne    80086e <vprintfmt+0x415>
+    switch (lflag) {
+  80083c:	85 d2                	test   %edx,%edx
+  80083e:	74 5d                	je     80089d <vprintfmt+0x444>
+  800840:	83 fa 01             	cmp    $0x1,%edx
+  800843:	0f 84 82 00 00 00    	je     8008cb <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800849:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084c:	83 f8 2f             	cmp    $0x2f,%eax
+  80084f:	0f 87 a5 00 00 00    	ja     8008fa <vprintfmt+0x4a1>
+  800855:	89 c2                	mov    %eax,%edx
+  800857:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085b:	83 c0 08             	add    $0x8,%eax
+  80085e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800861:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800864:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800869:	e9 fe 01 00 00       	jmp    800a6c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80086e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800871:	83 f8 2f             	cmp    $0x2f,%eax
+  800874:	77 19                	ja     80088f <vprintfmt+0x436>
+  800876:	89 c2                	mov    %eax,%edx
+  800878:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087c:	83 c0 08             	add    $0x8,%eax
+  80087f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800882:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800885:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80088a:	e9 dd 01 00 00       	jmp    800a6c <vprintfmt+0x613>
+  80088f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800893:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800897:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089b:	eb e5                	jmp    800882 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80089d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a3:	77 18                	ja     8008bd <vprintfmt+0x464>
+  8008a5:	89 c2                	mov    %eax,%edx
+  8008a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ab:	83 c0 08             	add    $0x8,%eax
+  8008ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008b3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008b8:	e9 af 01 00 00       	jmp    800a6c <vprintfmt+0x613>
+  8008bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c9:	eb e6                	jmp    8008b1 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8008cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d1:	77 19                	ja     8008ec <vprintfmt+0x493>
+  8008d3:	89 c2                	mov    %eax,%edx
+  8008d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d9:	83 c0 08             	add    $0x8,%eax
+  8008dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008df:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008e2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008e7:	e9 80 01 00 00       	jmp    800a6c <vprintfmt+0x613>
+  8008ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f8:	eb e5                	jmp    8008df <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8008fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800902:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800906:	e9 56 ff ff ff       	jmp    800861 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80090b:	40 84 f6             	test   %sil,%sil
+  80090e:	75 2e                	jne    80093e <vprintfmt+0x4e5>
+    switch (lflag) {
+  800910:	85 d2                	test   %edx,%edx
+  800912:	0f 84 b3 00 00 00    	je     8009cb <vprintfmt+0x572>
+  800918:	83 fa 01             	cmp    $0x1,%edx
+  80091b:	0f 84 d3 00 00 00    	je     8009f4 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800921:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800924:	83 f8 2f             	cmp    $0x2f,%eax
+  800927:	0f 87 f1 00 00 00    	ja     800a1e <vprintfmt+0x5c5>
+  80092d:	89 c2                	mov    %eax,%edx
+  80092f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800933:	83 c0 08             	add    $0x8,%eax
+  800936:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800939:	48 8b 02             	mov    (%rdx),%rax
+  80093c:	eb 17                	jmp    800955 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  80093e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800941:	83 f8 2f             	cmp    $0x2f,%eax
+  800944:	77 77                	ja     8009bd <vprintfmt+0x564>
+  800946:	89 c2                	mov    %eax,%edx
+  800948:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094c:	83 c0 08             	add    $0x8,%eax
+  80094f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800952:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800955:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800957:	83 f8 07             	cmp    $0x7,%eax
+  80095a:	0f 8e cf 00 00 00    	jle    800a2f <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800960:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800966:	44 89 e7             	mov    %r12d,%edi
+  800969:	41 c1 e4 03          	shl    $0x3,%r12d
+  80096d:	89 d1                	mov    %edx,%ecx
+  80096f:	8d 72 07             	lea    0x7(%rdx),%esi
+  800972:	85 d2                	test   %edx,%edx
+  800974:	0f 48 d6             	cmovs  %esi,%edx
+  800977:	c1 fa 03             	sar    $0x3,%edx
+  80097a:	83 f9 3f             	cmp    $0x3f,%ecx
+  80097d:	7f e7                	jg     800966 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80097f:	85 ff                	test   %edi,%edi
+  800981:	0f 84 03 fb ff ff    	je     80048a <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800987:	49 63 f4             	movslq %r12d,%rsi
+  80098a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80098f:	48 f7 f6             	div    %rsi
+  800992:	49 89 d7             	mov    %rdx,%r15
+  800995:	83 c0 30             	add    $0x30,%eax
+  800998:	0f be f8             	movsbl %al,%edi
+  80099b:	4c 89 ee             	mov    %r13,%rsi
+  80099e:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  8009a1:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  8009a4:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  8009a9:	45 85 e4             	test   %r12d,%r12d
+  8009ac:	41 0f 49 d4          	cmovns %r12d,%edx
+  8009b0:	c1 fa 03             	sar    $0x3,%edx
+  8009b3:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  8009b6:	75 cf                	jne    800987 <vprintfmt+0x52e>
+  8009b8:	e9 cd fa ff ff       	jmp    80048a <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c9:	eb 87                	jmp    800952 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  8009cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d1:	77 13                	ja     8009e6 <vprintfmt+0x58d>
+  8009d3:	89 c2                	mov    %eax,%edx
+  8009d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d9:	83 c0 08             	add    $0x8,%eax
+  8009dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009df:	8b 02                	mov    (%rdx),%eax
+  8009e1:	e9 6f ff ff ff       	jmp    800955 <vprintfmt+0x4fc>
+  8009e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f2:	eb eb                	jmp    8009df <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8009f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fa:	77 14                	ja     800a10 <vprintfmt+0x5b7>
+  8009fc:	89 c2                	mov    %eax,%edx
+  8009fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a02:	83 c0 08             	add    $0x8,%eax
+  800a05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a08:	48 8b 02             	mov    (%rdx),%rax
+  800a0b:	e9 45 ff ff ff       	jmp    800955 <vprintfmt+0x4fc>
+  800a10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1c:	eb ea                	jmp    800a08 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800a1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2a:	e9 0a ff ff ff       	jmp    800939 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800a2f:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800a35:	e9 4d ff ff ff       	jmp    800987 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800a3a:	4c 89 ee             	mov    %r13,%rsi
+  800a3d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a42:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a45:	4c 89 ee             	mov    %r13,%rsi
+  800a48:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a4d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a53:	83 f8 2f             	cmp    $0x2f,%eax
+  800a56:	77 47                	ja     800a9f <vprintfmt+0x646>
+  800a58:	89 c2                	mov    %eax,%edx
+  800a5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5e:	83 c0 08             	add    $0x8,%eax
+  800a61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a64:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a67:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a6c:	48 83 ec 08          	sub    $0x8,%rsp
+  800a70:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a74:	0f 94 c0             	sete   %al
+  800a77:	0f b6 c0             	movzbl %al,%eax
+  800a7a:	50                   	push   %rax
+  800a7b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a80:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a84:	4c 89 ee             	mov    %r13,%rsi
+  800a87:	4c 89 f7             	mov    %r14,%rdi
+  800a8a:	48 b8 4e 03 80 00 00 	movabs $0x80034e,%rax
+  800a91:	00 00 00 
+  800a94:	ff d0                	call   *%rax
+            break;
+  800a96:	48 83 c4 10          	add    $0x10,%rsp
+  800a9a:	e9 eb f9 ff ff       	jmp    80048a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aab:	eb b7                	jmp    800a64 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800aad:	40 84 f6             	test   %sil,%sil
+  800ab0:	75 2b                	jne    800add <vprintfmt+0x684>
+    switch (lflag) {
+  800ab2:	85 d2                	test   %edx,%edx
+  800ab4:	74 56                	je     800b0c <vprintfmt+0x6b3>
+  800ab6:	83 fa 01             	cmp    $0x1,%edx
+  800ab9:	74 7f                	je     800b3a <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800abb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abe:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac1:	0f 87 a2 00 00 00    	ja     800b69 <vprintfmt+0x710>
+  800ac7:	89 c2                	mov    %eax,%edx
+  800ac9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acd:	83 c0 08             	add    $0x8,%eax
+  800ad0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ad6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800adb:	eb 8f                	jmp    800a6c <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800add:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae3:	77 19                	ja     800afe <vprintfmt+0x6a5>
+  800ae5:	89 c2                	mov    %eax,%edx
+  800ae7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aeb:	83 c0 08             	add    $0x8,%eax
+  800aee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800af9:	e9 6e ff ff ff       	jmp    800a6c <vprintfmt+0x613>
+  800afe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0a:	eb e5                	jmp    800af1 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800b0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b12:	77 18                	ja     800b2c <vprintfmt+0x6d3>
+  800b14:	89 c2                	mov    %eax,%edx
+  800b16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1a:	83 c0 08             	add    $0x8,%eax
+  800b1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b20:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b22:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b27:	e9 40 ff ff ff       	jmp    800a6c <vprintfmt+0x613>
+  800b2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b38:	eb e6                	jmp    800b20 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800b3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b40:	77 19                	ja     800b5b <vprintfmt+0x702>
+  800b42:	89 c2                	mov    %eax,%edx
+  800b44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b48:	83 c0 08             	add    $0x8,%eax
+  800b4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b51:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b56:	e9 11 ff ff ff       	jmp    800a6c <vprintfmt+0x613>
+  800b5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b67:	eb e5                	jmp    800b4e <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800b69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b75:	e9 59 ff ff ff       	jmp    800ad3 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800b7a:	4c 89 ee             	mov    %r13,%rsi
+  800b7d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b82:	41 ff d6             	call   *%r14
+            break;
+  800b85:	e9 00 f9 ff ff       	jmp    80048a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b8a:	4c 89 ee             	mov    %r13,%rsi
+  800b8d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b92:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b95:	48 83 eb 01          	sub    $0x1,%rbx
+  800b99:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b9d:	75 f6                	jne    800b95 <vprintfmt+0x73c>
+  800b9f:	e9 e6 f8 ff ff       	jmp    80048a <vprintfmt+0x31>
+}
+  800ba4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ba8:	5b                   	pop    %rbx
+  800ba9:	41 5c                	pop    %r12
+  800bab:	41 5d                	pop    %r13
+  800bad:	41 5e                	pop    %r14
+  800baf:	41 5f                	pop    %r15
+  800bb1:	5d                   	pop    %rbp
+  800bb2:	c3                   	ret
+
+0000000000800bb3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bb3:	55                   	push   %rbp
+  800bb4:	48 89 e5             	mov    %rsp,%rbp
+  800bb7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bbb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bbf:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bc4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bc8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bcf:	48 85 ff             	test   %rdi,%rdi
+  800bd2:	74 2b                	je     800bff <vsnprintf+0x4c>
+  800bd4:	48 85 f6             	test   %rsi,%rsi
+  800bd7:	74 26                	je     800bff <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bd9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bdd:	48 bf 04 04 80 00 00 	movabs $0x800404,%rdi
+  800be4:	00 00 00 
+  800be7:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  800bee:	00 00 00 
+  800bf1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bf7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bfa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bfd:	c9                   	leave
+  800bfe:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c04:	eb f7                	jmp    800bfd <vsnprintf+0x4a>
+
+0000000000800c06 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c06:	55                   	push   %rbp
+  800c07:	48 89 e5             	mov    %rsp,%rbp
+  800c0a:	48 83 ec 50          	sub    $0x50,%rsp
+  800c0e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c12:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c16:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c1a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c21:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c29:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c2d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c31:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c35:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  800c3c:	00 00 00 
+  800c3f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c41:	c9                   	leave
+  800c42:	c3                   	ret
+
+0000000000800c43 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c43:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c46:	74 10                	je     800c58 <strlen+0x15>
+    size_t n = 0;
+  800c48:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c4d:	48 83 c0 01          	add    $0x1,%rax
+  800c51:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c55:	75 f6                	jne    800c4d <strlen+0xa>
+  800c57:	c3                   	ret
+    size_t n = 0;
+  800c58:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c5d:	c3                   	ret
+
+0000000000800c5e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c5e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c61:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c66:	48 85 f6             	test   %rsi,%rsi
+  800c69:	74 11                	je     800c7c <strnlen+0x1e>
+  800c6b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c6f:	74 0c                	je     800c7d <strnlen+0x1f>
+  800c71:	48 83 c2 01          	add    $0x1,%rdx
+  800c75:	48 39 d0             	cmp    %rdx,%rax
+  800c78:	75 f1                	jne    800c6b <strnlen+0xd>
+  800c7a:	eb 04                	jmp    800c80 <strnlen+0x22>
+  800c7c:	c3                   	ret
+  800c7d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c80:	c3                   	ret
+
+0000000000800c81 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c81:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c89:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c8d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c90:	48 83 c2 01          	add    $0x1,%rdx
+  800c94:	84 c9                	test   %cl,%cl
+  800c96:	75 f1                	jne    800c89 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c98:	c3                   	ret
+
+0000000000800c99 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c99:	55                   	push   %rbp
+  800c9a:	48 89 e5             	mov    %rsp,%rbp
+  800c9d:	41 54                	push   %r12
+  800c9f:	53                   	push   %rbx
+  800ca0:	48 89 fb             	mov    %rdi,%rbx
+  800ca3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ca6:	48 b8 43 0c 80 00 00 	movabs $0x800c43,%rax
+  800cad:	00 00 00 
+  800cb0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cb2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cb6:	4c 89 e6             	mov    %r12,%rsi
+  800cb9:	48 b8 81 0c 80 00 00 	movabs $0x800c81,%rax
+  800cc0:	00 00 00 
+  800cc3:	ff d0                	call   *%rax
+    return dst;
+}
+  800cc5:	48 89 d8             	mov    %rbx,%rax
+  800cc8:	5b                   	pop    %rbx
+  800cc9:	41 5c                	pop    %r12
+  800ccb:	5d                   	pop    %rbp
+  800ccc:	c3                   	ret
+
+0000000000800ccd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ccd:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cd0:	48 85 d2             	test   %rdx,%rdx
+  800cd3:	74 1f                	je     800cf4 <strncpy+0x27>
+  800cd5:	48 01 fa             	add    %rdi,%rdx
+  800cd8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cdb:	48 83 c1 01          	add    $0x1,%rcx
+  800cdf:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ce3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ce7:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ceb:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cef:	48 39 ca             	cmp    %rcx,%rdx
+  800cf2:	75 e7                	jne    800cdb <strncpy+0xe>
+    }
+    return ret;
+}
+  800cf4:	c3                   	ret
+
+0000000000800cf5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cf5:	48 89 f8             	mov    %rdi,%rax
+  800cf8:	48 85 d2             	test   %rdx,%rdx
+  800cfb:	74 24                	je     800d21 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cfd:	48 83 ea 01          	sub    $0x1,%rdx
+  800d01:	74 1b                	je     800d1e <strlcpy+0x29>
+  800d03:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d07:	0f b6 16             	movzbl (%rsi),%edx
+  800d0a:	84 d2                	test   %dl,%dl
+  800d0c:	74 10                	je     800d1e <strlcpy+0x29>
+            *dst++ = *src++;
+  800d0e:	48 83 c6 01          	add    $0x1,%rsi
+  800d12:	48 83 c0 01          	add    $0x1,%rax
+  800d16:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d19:	48 39 c8             	cmp    %rcx,%rax
+  800d1c:	75 e9                	jne    800d07 <strlcpy+0x12>
+        *dst = '\0';
+  800d1e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d21:	48 29 f8             	sub    %rdi,%rax
+}
+  800d24:	c3                   	ret
+
+0000000000800d25 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d25:	0f b6 07             	movzbl (%rdi),%eax
+  800d28:	84 c0                	test   %al,%al
+  800d2a:	74 13                	je     800d3f <strcmp+0x1a>
+  800d2c:	38 06                	cmp    %al,(%rsi)
+  800d2e:	75 0f                	jne    800d3f <strcmp+0x1a>
+  800d30:	48 83 c7 01          	add    $0x1,%rdi
+  800d34:	48 83 c6 01          	add    $0x1,%rsi
+  800d38:	0f b6 07             	movzbl (%rdi),%eax
+  800d3b:	84 c0                	test   %al,%al
+  800d3d:	75 ed                	jne    800d2c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d3f:	0f b6 c0             	movzbl %al,%eax
+  800d42:	0f b6 16             	movzbl (%rsi),%edx
+  800d45:	29 d0                	sub    %edx,%eax
+}
+  800d47:	c3                   	ret
+
+0000000000800d48 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d48:	48 85 d2             	test   %rdx,%rdx
+  800d4b:	74 1f                	je     800d6c <strncmp+0x24>
+  800d4d:	0f b6 07             	movzbl (%rdi),%eax
+  800d50:	84 c0                	test   %al,%al
+  800d52:	74 1e                	je     800d72 <strncmp+0x2a>
+  800d54:	3a 06                	cmp    (%rsi),%al
+  800d56:	75 1a                	jne    800d72 <strncmp+0x2a>
+  800d58:	48 83 c7 01          	add    $0x1,%rdi
+  800d5c:	48 83 c6 01          	add    $0x1,%rsi
+  800d60:	48 83 ea 01          	sub    $0x1,%rdx
+  800d64:	75 e7                	jne    800d4d <strncmp+0x5>
+
+    if (!n) return 0;
+  800d66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6b:	c3                   	ret
+  800d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d71:	c3                   	ret
+  800d72:	48 85 d2             	test   %rdx,%rdx
+  800d75:	74 09                	je     800d80 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d77:	0f b6 07             	movzbl (%rdi),%eax
+  800d7a:	0f b6 16             	movzbl (%rsi),%edx
+  800d7d:	29 d0                	sub    %edx,%eax
+  800d7f:	c3                   	ret
+    if (!n) return 0;
+  800d80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d85:	c3                   	ret
+
+0000000000800d86 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d86:	0f b6 17             	movzbl (%rdi),%edx
+  800d89:	84 d2                	test   %dl,%dl
+  800d8b:	74 18                	je     800da5 <strchr+0x1f>
+        if (*str == c) {
+  800d8d:	0f be d2             	movsbl %dl,%edx
+  800d90:	39 f2                	cmp    %esi,%edx
+  800d92:	74 17                	je     800dab <strchr+0x25>
+    for (; *str; str++) {
+  800d94:	48 83 c7 01          	add    $0x1,%rdi
+  800d98:	0f b6 17             	movzbl (%rdi),%edx
+  800d9b:	84 d2                	test   %dl,%dl
+  800d9d:	75 ee                	jne    800d8d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da4:	c3                   	ret
+  800da5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800daa:	c3                   	ret
+  800dab:	48 89 f8             	mov    %rdi,%rax
+}
+  800dae:	c3                   	ret
+
+0000000000800daf <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800daf:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800db2:	0f b6 17             	movzbl (%rdi),%edx
+  800db5:	84 d2                	test   %dl,%dl
+  800db7:	74 13                	je     800dcc <strfind+0x1d>
+  800db9:	0f be d2             	movsbl %dl,%edx
+  800dbc:	39 f2                	cmp    %esi,%edx
+  800dbe:	74 0b                	je     800dcb <strfind+0x1c>
+  800dc0:	48 83 c0 01          	add    $0x1,%rax
+  800dc4:	0f b6 10             	movzbl (%rax),%edx
+  800dc7:	84 d2                	test   %dl,%dl
+  800dc9:	75 ee                	jne    800db9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800dcb:	c3                   	ret
+  800dcc:	c3                   	ret
+
+0000000000800dcd <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800dcd:	55                   	push   %rbp
+  800dce:	48 89 e5             	mov    %rsp,%rbp
+  800dd1:	41 57                	push   %r15
+  800dd3:	41 56                	push   %r14
+  800dd5:	41 55                	push   %r13
+  800dd7:	41 54                	push   %r12
+  800dd9:	53                   	push   %rbx
+  800dda:	48 83 ec 08          	sub    $0x8,%rsp
+  800dde:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800de1:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800de5:	45 84 ed             	test   %r13b,%r13b
+  800de8:	75 12                	jne    800dfc <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800dea:	4c 89 f8             	mov    %r15,%rax
+  800ded:	48 83 c4 08          	add    $0x8,%rsp
+  800df1:	5b                   	pop    %rbx
+  800df2:	41 5c                	pop    %r12
+  800df4:	41 5d                	pop    %r13
+  800df6:	41 5e                	pop    %r14
+  800df8:	41 5f                	pop    %r15
+  800dfa:	5d                   	pop    %rbp
+  800dfb:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800dfc:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800e00:	4c 89 e7             	mov    %r12,%rdi
+  800e03:	48 b8 43 0c 80 00 00 	movabs $0x800c43,%rax
+  800e0a:	00 00 00 
+  800e0d:	ff d0                	call   *%rax
+  800e0f:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800e12:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800e16:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800e1a:	49 bf 48 0d 80 00 00 	movabs $0x800d48,%r15
+  800e21:	00 00 00 
+				if ((sc = *s++) == 0)
+  800e24:	84 c0                	test   %al,%al
+  800e26:	75 14                	jne    800e3c <strstr+0x6f>
+					return NULL;
+  800e28:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e2e:	eb ba                	jmp    800dea <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800e30:	48 83 c3 01          	add    $0x1,%rbx
+  800e34:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800e38:	84 c0                	test   %al,%al
+  800e3a:	74 1b                	je     800e57 <strstr+0x8a>
+			} while (sc != c);
+  800e3c:	41 38 c5             	cmp    %al,%r13b
+  800e3f:	75 ef                	jne    800e30 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800e41:	4c 89 f2             	mov    %r14,%rdx
+  800e44:	4c 89 e6             	mov    %r12,%rsi
+  800e47:	48 89 df             	mov    %rbx,%rdi
+  800e4a:	41 ff d7             	call   *%r15
+  800e4d:	85 c0                	test   %eax,%eax
+  800e4f:	75 df                	jne    800e30 <strstr+0x63>
+  800e51:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800e55:	eb 93                	jmp    800dea <strstr+0x1d>
+					return NULL;
+  800e57:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e5d:	eb 8b                	jmp    800dea <strstr+0x1d>
+
+0000000000800e5f <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800e5f:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800e61:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800e64:	8d 57 20             	lea    0x20(%rdi),%edx
+  800e67:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e6a:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e6d:	c3                   	ret
+
+0000000000800e6e <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800e6e:	55                   	push   %rbp
+  800e6f:	48 89 e5             	mov    %rsp,%rbp
+  800e72:	41 57                	push   %r15
+  800e74:	41 56                	push   %r14
+  800e76:	41 55                	push   %r13
+  800e78:	41 54                	push   %r12
+  800e7a:	53                   	push   %rbx
+  800e7b:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800e7f:	48 39 f7             	cmp    %rsi,%rdi
+  800e82:	74 49                	je     800ecd <strcasecmp+0x5f>
+  800e84:	49 89 fd             	mov    %rdi,%r13
+  800e87:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800e8a:	49 bf 5f 0e 80 00 00 	movabs $0x800e5f,%r15
+  800e91:	00 00 00 
+  800e94:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800e99:	41 0f b6 fe          	movzbl %r14b,%edi
+  800e9d:	41 ff d7             	call   *%r15
+  800ea0:	89 c3                	mov    %eax,%ebx
+  800ea2:	49 83 c4 01          	add    $0x1,%r12
+  800ea6:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800eac:	41 ff d7             	call   *%r15
+  800eaf:	29 c3                	sub    %eax,%ebx
+  800eb1:	75 09                	jne    800ebc <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800eb3:	49 83 c5 01          	add    $0x1,%r13
+  800eb7:	45 84 f6             	test   %r14b,%r14b
+  800eba:	75 d8                	jne    800e94 <strcasecmp+0x26>
+}
+  800ebc:	89 d8                	mov    %ebx,%eax
+  800ebe:	48 83 c4 08          	add    $0x8,%rsp
+  800ec2:	5b                   	pop    %rbx
+  800ec3:	41 5c                	pop    %r12
+  800ec5:	41 5d                	pop    %r13
+  800ec7:	41 5e                	pop    %r14
+  800ec9:	41 5f                	pop    %r15
+  800ecb:	5d                   	pop    %rbp
+  800ecc:	c3                   	ret
+        return 0;
+  800ecd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed2:	eb e8                	jmp    800ebc <strcasecmp+0x4e>
+
+0000000000800ed4 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800ed4:	55                   	push   %rbp
+  800ed5:	48 89 e5             	mov    %rsp,%rbp
+  800ed8:	41 57                	push   %r15
+  800eda:	41 56                	push   %r14
+  800edc:	41 55                	push   %r13
+  800ede:	41 54                	push   %r12
+  800ee0:	53                   	push   %rbx
+  800ee1:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800ee5:	48 85 d2             	test   %rdx,%rdx
+  800ee8:	74 4f                	je     800f39 <strncasecmp+0x65>
+  800eea:	49 89 fc             	mov    %rdi,%r12
+  800eed:	49 89 f5             	mov    %rsi,%r13
+  800ef0:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800ef4:	49 be 5f 0e 80 00 00 	movabs $0x800e5f,%r14
+  800efb:	00 00 00 
+  800efe:	49 83 c4 01          	add    $0x1,%r12
+  800f02:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800f08:	41 ff d6             	call   *%r14
+  800f0b:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800f0d:	49 83 c5 01          	add    $0x1,%r13
+  800f11:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800f16:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800f19:	29 c3                	sub    %eax,%ebx
+  800f1b:	85 c0                	test   %eax,%eax
+  800f1d:	74 09                	je     800f28 <strncasecmp+0x54>
+  800f1f:	85 db                	test   %ebx,%ebx
+  800f21:	75 05                	jne    800f28 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800f23:	4d 39 fc             	cmp    %r15,%r12
+  800f26:	75 d6                	jne    800efe <strncasecmp+0x2a>
+}
+  800f28:	89 d8                	mov    %ebx,%eax
+  800f2a:	48 83 c4 08          	add    $0x8,%rsp
+  800f2e:	5b                   	pop    %rbx
+  800f2f:	41 5c                	pop    %r12
+  800f31:	41 5d                	pop    %r13
+  800f33:	41 5e                	pop    %r14
+  800f35:	41 5f                	pop    %r15
+  800f37:	5d                   	pop    %rbp
+  800f38:	c3                   	ret
+    int d = 0;
+  800f39:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800f3e:	eb e8                	jmp    800f28 <strncasecmp+0x54>
+
+0000000000800f40 <toupper>:
+
+int toupper(int c) {
+  800f40:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800f42:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800f45:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800f48:	83 f9 1a             	cmp    $0x1a,%ecx
+  800f4b:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800f4e:	c3                   	ret
+
+0000000000800f4f <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800f4f:	83 ff 20             	cmp    $0x20,%edi
+  800f52:	0f 94 c0             	sete   %al
+  800f55:	0f b6 c0             	movzbl %al,%eax
+}
+  800f58:	c3                   	ret
+
+0000000000800f59 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800f59:	89 f8                	mov    %edi,%eax
+  800f5b:	f7 d8                	neg    %eax
+  800f5d:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800f60:	c3                   	ret
+
+0000000000800f61 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f61:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f64:	48 89 f8             	mov    %rdi,%rax
+  800f67:	48 f7 d8             	neg    %rax
+  800f6a:	83 e0 07             	and    $0x7,%eax
+  800f6d:	49 89 d1             	mov    %rdx,%r9
+  800f70:	49 29 c1             	sub    %rax,%r9
+  800f73:	78 36                	js     800fab <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f75:	40 0f b6 c6          	movzbl %sil,%eax
+  800f79:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f80:	01 01 01 
+  800f83:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f87:	40 f6 c7 07          	test   $0x7,%dil
+  800f8b:	75 38                	jne    800fc5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f8d:	4c 89 c9             	mov    %r9,%rcx
+  800f90:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f94:	74 0c                	je     800fa2 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f96:	fc                   	cld
+  800f97:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f9a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f9e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fa2:	4d 85 c9             	test   %r9,%r9
+  800fa5:	75 45                	jne    800fec <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fa7:	4c 89 c0             	mov    %r8,%rax
+  800faa:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fab:	48 85 d2             	test   %rdx,%rdx
+  800fae:	74 f7                	je     800fa7 <memset+0x46>
+  800fb0:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fb3:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fb6:	48 83 c0 01          	add    $0x1,%rax
+  800fba:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fbe:	48 39 c2             	cmp    %rax,%rdx
+  800fc1:	75 f3                	jne    800fb6 <memset+0x55>
+  800fc3:	eb e2                	jmp    800fa7 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fc5:	40 f6 c7 01          	test   $0x1,%dil
+  800fc9:	74 06                	je     800fd1 <memset+0x70>
+  800fcb:	88 07                	mov    %al,(%rdi)
+  800fcd:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fd1:	40 f6 c7 02          	test   $0x2,%dil
+  800fd5:	74 07                	je     800fde <memset+0x7d>
+  800fd7:	66 89 07             	mov    %ax,(%rdi)
+  800fda:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fde:	40 f6 c7 04          	test   $0x4,%dil
+  800fe2:	74 a9                	je     800f8d <memset+0x2c>
+  800fe4:	89 07                	mov    %eax,(%rdi)
+  800fe6:	48 83 c7 04          	add    $0x4,%rdi
+  800fea:	eb a1                	jmp    800f8d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fec:	41 f6 c1 04          	test   $0x4,%r9b
+  800ff0:	74 06                	je     800ff8 <memset+0x97>
+  800ff2:	89 07                	mov    %eax,(%rdi)
+  800ff4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ff8:	41 f6 c1 02          	test   $0x2,%r9b
+  800ffc:	74 07                	je     801005 <memset+0xa4>
+  800ffe:	66 89 07             	mov    %ax,(%rdi)
+  801001:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801005:	41 f6 c1 01          	test   $0x1,%r9b
+  801009:	74 9c                	je     800fa7 <memset+0x46>
+  80100b:	88 07                	mov    %al,(%rdi)
+  80100d:	eb 98                	jmp    800fa7 <memset+0x46>
+
+000000000080100f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80100f:	48 89 f8             	mov    %rdi,%rax
+  801012:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801015:	48 39 fe             	cmp    %rdi,%rsi
+  801018:	73 3b                	jae    801055 <memmove+0x46>
+  80101a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80101e:	48 39 d7             	cmp    %rdx,%rdi
+  801021:	73 32                	jae    801055 <memmove+0x46>
+        s += n;
+        d += n;
+  801023:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801027:	48 89 d6             	mov    %rdx,%rsi
+  80102a:	48 09 fe             	or     %rdi,%rsi
+  80102d:	48 09 ce             	or     %rcx,%rsi
+  801030:	40 f6 c6 07          	test   $0x7,%sil
+  801034:	75 12                	jne    801048 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801036:	48 83 ef 08          	sub    $0x8,%rdi
+  80103a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80103e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801042:	fd                   	std
+  801043:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801046:	fc                   	cld
+  801047:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801048:	48 83 ef 01          	sub    $0x1,%rdi
+  80104c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801050:	fd                   	std
+  801051:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801053:	eb f1                	jmp    801046 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801055:	48 89 f2             	mov    %rsi,%rdx
+  801058:	48 09 c2             	or     %rax,%rdx
+  80105b:	48 09 ca             	or     %rcx,%rdx
+  80105e:	f6 c2 07             	test   $0x7,%dl
+  801061:	75 0c                	jne    80106f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801063:	48 c1 e9 03          	shr    $0x3,%rcx
+  801067:	48 89 c7             	mov    %rax,%rdi
+  80106a:	fc                   	cld
+  80106b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80106e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80106f:	48 89 c7             	mov    %rax,%rdi
+  801072:	fc                   	cld
+  801073:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801075:	c3                   	ret
+
+0000000000801076 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801076:	55                   	push   %rbp
+  801077:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80107a:	48 b8 0f 10 80 00 00 	movabs $0x80100f,%rax
+  801081:	00 00 00 
+  801084:	ff d0                	call   *%rax
+}
+  801086:	5d                   	pop    %rbp
+  801087:	c3                   	ret
+
+0000000000801088 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801088:	55                   	push   %rbp
+  801089:	48 89 e5             	mov    %rsp,%rbp
+  80108c:	41 57                	push   %r15
+  80108e:	41 56                	push   %r14
+  801090:	41 55                	push   %r13
+  801092:	41 54                	push   %r12
+  801094:	53                   	push   %rbx
+  801095:	48 83 ec 08          	sub    $0x8,%rsp
+  801099:	49 89 fe             	mov    %rdi,%r14
+  80109c:	49 89 f7             	mov    %rsi,%r15
+  80109f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010a2:	48 89 f7             	mov    %rsi,%rdi
+  8010a5:	48 b8 43 0c 80 00 00 	movabs $0x800c43,%rax
+  8010ac:	00 00 00 
+  8010af:	ff d0                	call   *%rax
+  8010b1:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010b4:	48 89 de             	mov    %rbx,%rsi
+  8010b7:	4c 89 f7             	mov    %r14,%rdi
+  8010ba:	48 b8 5e 0c 80 00 00 	movabs $0x800c5e,%rax
+  8010c1:	00 00 00 
+  8010c4:	ff d0                	call   *%rax
+  8010c6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010c9:	48 39 c3             	cmp    %rax,%rbx
+  8010cc:	74 36                	je     801104 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010ce:	48 89 d8             	mov    %rbx,%rax
+  8010d1:	4c 29 e8             	sub    %r13,%rax
+  8010d4:	49 39 c4             	cmp    %rax,%r12
+  8010d7:	73 31                	jae    80110a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010d9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010de:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010e2:	4c 89 fe             	mov    %r15,%rsi
+  8010e5:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  8010ec:	00 00 00 
+  8010ef:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8010f1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8010f5:	48 83 c4 08          	add    $0x8,%rsp
+  8010f9:	5b                   	pop    %rbx
+  8010fa:	41 5c                	pop    %r12
+  8010fc:	41 5d                	pop    %r13
+  8010fe:	41 5e                	pop    %r14
+  801100:	41 5f                	pop    %r15
+  801102:	5d                   	pop    %rbp
+  801103:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801104:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801108:	eb eb                	jmp    8010f5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80110a:	48 83 eb 01          	sub    $0x1,%rbx
+  80110e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801112:	48 89 da             	mov    %rbx,%rdx
+  801115:	4c 89 fe             	mov    %r15,%rsi
+  801118:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  80111f:	00 00 00 
+  801122:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801124:	49 01 de             	add    %rbx,%r14
+  801127:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80112c:	eb c3                	jmp    8010f1 <strlcat+0x69>
+
+000000000080112e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80112e:	48 85 d2             	test   %rdx,%rdx
+  801131:	74 2d                	je     801160 <memcmp+0x32>
+  801133:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801138:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80113c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801141:	44 38 c1             	cmp    %r8b,%cl
+  801144:	75 0f                	jne    801155 <memcmp+0x27>
+    while (n-- > 0) {
+  801146:	48 83 c0 01          	add    $0x1,%rax
+  80114a:	48 39 c2             	cmp    %rax,%rdx
+  80114d:	75 e9                	jne    801138 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80114f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801154:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801155:	0f b6 c1             	movzbl %cl,%eax
+  801158:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80115c:	44 29 c0             	sub    %r8d,%eax
+  80115f:	c3                   	ret
+    return 0;
+  801160:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801165:	c3                   	ret
+
+0000000000801166 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801166:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80116a:	48 39 c7             	cmp    %rax,%rdi
+  80116d:	73 0f                	jae    80117e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80116f:	40 38 37             	cmp    %sil,(%rdi)
+  801172:	74 0e                	je     801182 <memfind+0x1c>
+    for (; src < end; src++) {
+  801174:	48 83 c7 01          	add    $0x1,%rdi
+  801178:	48 39 f8             	cmp    %rdi,%rax
+  80117b:	75 f2                	jne    80116f <memfind+0x9>
+  80117d:	c3                   	ret
+  80117e:	48 89 f8             	mov    %rdi,%rax
+  801181:	c3                   	ret
+  801182:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801185:	c3                   	ret
+
+0000000000801186 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801186:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801189:	0f b6 37             	movzbl (%rdi),%esi
+  80118c:	40 80 fe 20          	cmp    $0x20,%sil
+  801190:	74 06                	je     801198 <strtol+0x12>
+  801192:	40 80 fe 09          	cmp    $0x9,%sil
+  801196:	75 13                	jne    8011ab <strtol+0x25>
+  801198:	48 83 c7 01          	add    $0x1,%rdi
+  80119c:	0f b6 37             	movzbl (%rdi),%esi
+  80119f:	40 80 fe 20          	cmp    $0x20,%sil
+  8011a3:	74 f3                	je     801198 <strtol+0x12>
+  8011a5:	40 80 fe 09          	cmp    $0x9,%sil
+  8011a9:	74 ed                	je     801198 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011ab:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011ae:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011b1:	3c 01                	cmp    $0x1,%al
+  8011b3:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011b7:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011bd:	75 0f                	jne    8011ce <strtol+0x48>
+  8011bf:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011c2:	74 14                	je     8011d8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011c4:	85 d2                	test   %edx,%edx
+  8011c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011cb:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011ce:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011d3:	4c 63 ca             	movslq %edx,%r9
+  8011d6:	eb 36                	jmp    80120e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011d8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011dc:	74 0f                	je     8011ed <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011de:	85 d2                	test   %edx,%edx
+  8011e0:	75 ec                	jne    8011ce <strtol+0x48>
+        s++;
+  8011e2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011e6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8011eb:	eb e1                	jmp    8011ce <strtol+0x48>
+        s += 2;
+  8011ed:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8011f1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8011f6:	eb d6                	jmp    8011ce <strtol+0x48>
+            dig -= '0';
+  8011f8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011fb:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011ff:	41 39 d0             	cmp    %edx,%r8d
+  801202:	7d 21                	jge    801225 <strtol+0x9f>
+        val = val * base + dig;
+  801204:	49 0f af c1          	imul   %r9,%rax
+  801208:	0f b6 c9             	movzbl %cl,%ecx
+  80120b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80120e:	48 83 c7 01          	add    $0x1,%rdi
+  801212:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801216:	80 f9 39             	cmp    $0x39,%cl
+  801219:	76 dd                	jbe    8011f8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80121b:	80 f9 7b             	cmp    $0x7b,%cl
+  80121e:	77 05                	ja     801225 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801220:	83 e9 57             	sub    $0x57,%ecx
+  801223:	eb d6                	jmp    8011fb <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801225:	4d 85 d2             	test   %r10,%r10
+  801228:	74 03                	je     80122d <strtol+0xa7>
+  80122a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80122d:	48 89 c2             	mov    %rax,%rdx
+  801230:	48 f7 da             	neg    %rdx
+  801233:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801237:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80123b:	c3                   	ret
+
+000000000080123c <atoi>:
+int atoi(const char *str) {
+  80123c:	55                   	push   %rbp
+  80123d:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801240:	ba 00 00 00 00       	mov    $0x0,%edx
+  801245:	be 00 00 00 00       	mov    $0x0,%esi
+  80124a:	48 b8 86 11 80 00 00 	movabs $0x801186,%rax
+  801251:	00 00 00 
+  801254:	ff d0                	call   *%rax
+}
+  801256:	5d                   	pop    %rbp
+  801257:	c3                   	ret
+
+0000000000801258 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801258:	55                   	push   %rbp
+  801259:	48 89 e5             	mov    %rsp,%rbp
+  80125c:	53                   	push   %rbx
+  80125d:	48 89 fa             	mov    %rdi,%rdx
+  801260:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801263:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801268:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801272:	be 00 00 00 00       	mov    $0x0,%esi
+  801277:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80127f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801283:	c9                   	leave
+  801284:	c3                   	ret
+
+0000000000801285 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801285:	55                   	push   %rbp
+  801286:	48 89 e5             	mov    %rsp,%rbp
+  801289:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80128a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80128f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801294:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801299:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ae:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b4:	c9                   	leave
+  8012b5:	c3                   	ret
+
+00000000008012b6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012b6:	55                   	push   %rbp
+  8012b7:	48 89 e5             	mov    %rsp,%rbp
+  8012ba:	53                   	push   %rbx
+  8012bb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012bf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e3:	48 85 c0             	test   %rax,%rax
+  8012e6:	7f 06                	jg     8012ee <sys_env_destroy+0x38>
+}
+  8012e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ec:	c9                   	leave
+  8012ed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ee:	49 89 c0             	mov    %rax,%r8
+  8012f1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012f6:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  8012fd:	00 00 00 
+  801300:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801305:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  80130c:	00 00 00 
+  80130f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801314:	49 b9 31 44 80 00 00 	movabs $0x804431,%r9
+  80131b:	00 00 00 
+  80131e:	41 ff d1             	call   *%r9
+
+0000000000801321 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801321:	55                   	push   %rbp
+  801322:	48 89 e5             	mov    %rsp,%rbp
+  801325:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801326:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80132b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801330:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133f:	be 00 00 00 00       	mov    $0x0,%esi
+  801344:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134a:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80134c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801350:	c9                   	leave
+  801351:	c3                   	ret
+
+0000000000801352 <sys_yield>:
+
+void
+sys_yield(void) {
+  801352:	55                   	push   %rbp
+  801353:	48 89 e5             	mov    %rsp,%rbp
+  801356:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801357:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80135c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801361:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801366:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801370:	be 00 00 00 00       	mov    $0x0,%esi
+  801375:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80137d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801381:	c9                   	leave
+  801382:	c3                   	ret
+
+0000000000801383 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801383:	55                   	push   %rbp
+  801384:	48 89 e5             	mov    %rsp,%rbp
+  801387:	53                   	push   %rbx
+  801388:	48 89 fa             	mov    %rdi,%rdx
+  80138b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80138e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801393:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80139a:	00 00 00 
+  80139d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ad:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b3:	c9                   	leave
+  8013b4:	c3                   	ret
+
+00000000008013b5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013b5:	55                   	push   %rbp
+  8013b6:	48 89 e5             	mov    %rsp,%rbp
+  8013b9:	53                   	push   %rbx
+  8013ba:	49 89 f8             	mov    %rdi,%r8
+  8013bd:	48 89 d3             	mov    %rdx,%rbx
+  8013c0:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c8:	4c 89 c2             	mov    %r8,%rdx
+  8013cb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013df:	c9                   	leave
+  8013e0:	c3                   	ret
+
+00000000008013e1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013e1:	55                   	push   %rbp
+  8013e2:	48 89 e5             	mov    %rsp,%rbp
+  8013e5:	53                   	push   %rbx
+  8013e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ea:	89 f8                	mov    %edi,%eax
+  8013ec:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013ef:	48 63 f9             	movslq %ecx,%rdi
+  8013f2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fa:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801402:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801408:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80140a:	48 85 c0             	test   %rax,%rax
+  80140d:	7f 06                	jg     801415 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80140f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801413:	c9                   	leave
+  801414:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801415:	49 89 c0             	mov    %rax,%r8
+  801418:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80141d:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801424:	00 00 00 
+  801427:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80142c:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801433:	00 00 00 
+  801436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143b:	49 b9 31 44 80 00 00 	movabs $0x804431,%r9
+  801442:	00 00 00 
+  801445:	41 ff d1             	call   *%r9
+
+0000000000801448 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801448:	55                   	push   %rbp
+  801449:	48 89 e5             	mov    %rsp,%rbp
+  80144c:	53                   	push   %rbx
+  80144d:	48 83 ec 08          	sub    $0x8,%rsp
+  801451:	89 f8                	mov    %edi,%eax
+  801453:	49 89 f2             	mov    %rsi,%r10
+  801456:	48 89 cf             	mov    %rcx,%rdi
+  801459:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80145c:	48 63 da             	movslq %edx,%rbx
+  80145f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801462:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801467:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80146d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80146f:	48 85 c0             	test   %rax,%rax
+  801472:	7f 06                	jg     80147a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801474:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801478:	c9                   	leave
+  801479:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147a:	49 89 c0             	mov    %rax,%r8
+  80147d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801482:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801489:	00 00 00 
+  80148c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801491:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801498:	00 00 00 
+  80149b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a0:	49 b9 31 44 80 00 00 	movabs $0x804431,%r9
+  8014a7:	00 00 00 
+  8014aa:	41 ff d1             	call   *%r9
+
+00000000008014ad <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014ad:	55                   	push   %rbp
+  8014ae:	48 89 e5             	mov    %rsp,%rbp
+  8014b1:	53                   	push   %rbx
+  8014b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b6:	49 89 f9             	mov    %rdi,%r9
+  8014b9:	89 f0                	mov    %esi,%eax
+  8014bb:	48 89 d3             	mov    %rdx,%rbx
+  8014be:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8014c1:	49 63 f0             	movslq %r8d,%rsi
+  8014c4:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014cc:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d7:	48 85 c0             	test   %rax,%rax
+  8014da:	7f 06                	jg     8014e2 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e2:	49 89 c0             	mov    %rax,%r8
+  8014e5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014ea:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  8014f1:	00 00 00 
+  8014f4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014f9:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801500:	00 00 00 
+  801503:	b8 00 00 00 00       	mov    $0x0,%eax
+  801508:	49 b9 31 44 80 00 00 	movabs $0x804431,%r9
+  80150f:	00 00 00 
+  801512:	41 ff d1             	call   *%r9
+
+0000000000801515 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801515:	55                   	push   %rbp
+  801516:	48 89 e5             	mov    %rsp,%rbp
+  801519:	53                   	push   %rbx
+  80151a:	89 f8                	mov    %edi,%eax
+  80151c:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80151f:	48 63 f9             	movslq %ecx,%rdi
+  801522:	48 63 da             	movslq %edx,%rbx
+  801525:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801528:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80152d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801530:	be 00 00 00 00       	mov    $0x0,%esi
+  801535:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153b:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80153d:	89 c2                	mov    %eax,%edx
+  80153f:	48 85 c0             	test   %rax,%rax
+  801542:	78 0d                	js     801551 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801544:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801549:	4d 85 c9             	test   %r9,%r9
+  80154c:	74 03                	je     801551 <sys_alloc_dma_region+0x3c>
+  80154e:	49 89 01             	mov    %rax,(%r9)
+}
+  801551:	89 d0                	mov    %edx,%eax
+  801553:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801557:	c9                   	leave
+  801558:	c3                   	ret
+
+0000000000801559 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801559:	55                   	push   %rbp
+  80155a:	48 89 e5             	mov    %rsp,%rbp
+  80155d:	53                   	push   %rbx
+  80155e:	48 83 ec 08          	sub    $0x8,%rsp
+  801562:	48 89 f1             	mov    %rsi,%rcx
+  801565:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801568:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156b:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801570:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801575:	be 00 00 00 00       	mov    $0x0,%esi
+  80157a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801580:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801582:	48 85 c0             	test   %rax,%rax
+  801585:	7f 06                	jg     80158d <sys_set_cache_region+0x34>
+}
+  801587:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158b:	c9                   	leave
+  80158c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158d:	49 89 c0             	mov    %rax,%r8
+  801590:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801595:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  80159c:	00 00 00 
+  80159f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015a4:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  8015ab:	00 00 00 
+  8015ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b3:	49 b9 31 44 80 00 00 	movabs $0x804431,%r9
+  8015ba:	00 00 00 
+  8015bd:	41 ff d1             	call   *%r9
+
+00000000008015c0 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015c0:	55                   	push   %rbp
+  8015c1:	48 89 e5             	mov    %rsp,%rbp
+  8015c4:	53                   	push   %rbx
+  8015c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8015c9:	48 89 f1             	mov    %rsi,%rcx
+  8015cc:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015cf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e9:	48 85 c0             	test   %rax,%rax
+  8015ec:	7f 06                	jg     8015f4 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f2:	c9                   	leave
+  8015f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f4:	49 89 c0             	mov    %rax,%r8
+  8015f7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015fc:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801603:	00 00 00 
+  801606:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80160b:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801612:	00 00 00 
+  801615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161a:	49 b9 31 44 80 00 00 	movabs $0x804431,%r9
+  801621:	00 00 00 
+  801624:	41 ff d1             	call   *%r9
+
+0000000000801627 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801627:	55                   	push   %rbp
+  801628:	48 89 e5             	mov    %rsp,%rbp
+  80162b:	53                   	push   %rbx
+  80162c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801630:	48 63 ce             	movslq %esi,%rcx
+  801633:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801636:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80163b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801640:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801645:	be 00 00 00 00       	mov    $0x0,%esi
+  80164a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801650:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801652:	48 85 c0             	test   %rax,%rax
+  801655:	7f 06                	jg     80165d <sys_env_set_status+0x36>
+}
+  801657:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80165b:	c9                   	leave
+  80165c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80165d:	49 89 c0             	mov    %rax,%r8
+  801660:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801665:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  80166c:	00 00 00 
+  80166f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801674:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  80167b:	00 00 00 
+  80167e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801683:	49 b9 31 44 80 00 00 	movabs $0x804431,%r9
+  80168a:	00 00 00 
+  80168d:	41 ff d1             	call   *%r9
+
+0000000000801690 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801690:	55                   	push   %rbp
+  801691:	48 89 e5             	mov    %rsp,%rbp
+  801694:	53                   	push   %rbx
+  801695:	48 83 ec 08          	sub    $0x8,%rsp
+  801699:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80169c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80169f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016bb:	48 85 c0             	test   %rax,%rax
+  8016be:	7f 06                	jg     8016c6 <sys_env_set_trapframe+0x36>
+}
+  8016c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c4:	c9                   	leave
+  8016c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c6:	49 89 c0             	mov    %rax,%r8
+  8016c9:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8016ce:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  8016d5:	00 00 00 
+  8016d8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016dd:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  8016e4:	00 00 00 
+  8016e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ec:	49 b9 31 44 80 00 00 	movabs $0x804431,%r9
+  8016f3:	00 00 00 
+  8016f6:	41 ff d1             	call   *%r9
+
+00000000008016f9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016f9:	55                   	push   %rbp
+  8016fa:	48 89 e5             	mov    %rsp,%rbp
+  8016fd:	53                   	push   %rbx
+  8016fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801702:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801705:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801708:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80170d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801712:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801717:	be 00 00 00 00       	mov    $0x0,%esi
+  80171c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801722:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801724:	48 85 c0             	test   %rax,%rax
+  801727:	7f 06                	jg     80172f <sys_env_set_pgfault_upcall+0x36>
+}
+  801729:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80172d:	c9                   	leave
+  80172e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80172f:	49 89 c0             	mov    %rax,%r8
+  801732:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801737:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  80173e:	00 00 00 
+  801741:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801746:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  80174d:	00 00 00 
+  801750:	b8 00 00 00 00       	mov    $0x0,%eax
+  801755:	49 b9 31 44 80 00 00 	movabs $0x804431,%r9
+  80175c:	00 00 00 
+  80175f:	41 ff d1             	call   *%r9
+
+0000000000801762 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801762:	55                   	push   %rbp
+  801763:	48 89 e5             	mov    %rsp,%rbp
+  801766:	53                   	push   %rbx
+  801767:	89 f8                	mov    %edi,%eax
+  801769:	49 89 f1             	mov    %rsi,%r9
+  80176c:	48 89 d3             	mov    %rdx,%rbx
+  80176f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801772:	49 63 f0             	movslq %r8d,%rsi
+  801775:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801778:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80177d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801780:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801786:	cd 30                	int    $0x30
+}
+  801788:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80178c:	c9                   	leave
+  80178d:	c3                   	ret
+
+000000000080178e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80178e:	55                   	push   %rbp
+  80178f:	48 89 e5             	mov    %rsp,%rbp
+  801792:	53                   	push   %rbx
+  801793:	48 83 ec 08          	sub    $0x8,%rsp
+  801797:	48 89 fa             	mov    %rdi,%rdx
+  80179a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80179d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017b9:	48 85 c0             	test   %rax,%rax
+  8017bc:	7f 06                	jg     8017c4 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c2:	c9                   	leave
+  8017c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c4:	49 89 c0             	mov    %rax,%r8
+  8017c7:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8017cc:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  8017d3:	00 00 00 
+  8017d6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017db:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  8017e2:	00 00 00 
+  8017e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ea:	49 b9 31 44 80 00 00 	movabs $0x804431,%r9
+  8017f1:	00 00 00 
+  8017f4:	41 ff d1             	call   *%r9
+
+00000000008017f7 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8017f7:	55                   	push   %rbp
+  8017f8:	48 89 e5             	mov    %rsp,%rbp
+  8017fb:	53                   	push   %rbx
+  8017fc:	48 89 fa             	mov    %rdi,%rdx
+  8017ff:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801802:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801807:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801811:	be 00 00 00 00       	mov    $0x0,%esi
+  801816:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80181c:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80181e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801822:	c9                   	leave
+  801823:	c3                   	ret
+
+0000000000801824 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801824:	55                   	push   %rbp
+  801825:	48 89 e5             	mov    %rsp,%rbp
+  801828:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801829:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80182e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801833:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801838:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801842:	be 00 00 00 00       	mov    $0x0,%esi
+  801847:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80184d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80184f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801853:	c9                   	leave
+  801854:	c3                   	ret
+
+0000000000801855 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801855:	48 85 ff             	test   %rdi,%rdi
+  801858:	0f 84 b6 01 00 00    	je     801a14 <malloc+0x1bf>
+malloc(size_t size) {
+  80185e:	55                   	push   %rbp
+  80185f:	48 89 e5             	mov    %rsp,%rbp
+  801862:	41 56                	push   %r14
+  801864:	41 55                	push   %r13
+  801866:	41 54                	push   %r12
+  801868:	53                   	push   %rbx
+  801869:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80186c:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801873:	00 00 00 
+  801876:	4c 8b 20             	mov    (%rax),%r12
+  801879:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801880:	0f 87 94 01 00 00    	ja     801a1a <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801886:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80188d:	00 00 00 
+  801890:	48 85 c0             	test   %rax,%rax
+  801893:	74 6b                	je     801900 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801895:	4d 85 e4             	test   %r12,%r12
+  801898:	74 66                	je     801900 <malloc+0xab>
+  80189a:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  8018a1:	00 00 00 
+  8018a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a9:	eb 0d                	jmp    8018b8 <malloc+0x63>
+  8018ab:	48 83 c1 01          	add    $0x1,%rcx
+  8018af:	48 83 c2 18          	add    $0x18,%rdx
+  8018b3:	49 39 cc             	cmp    %rcx,%r12
+  8018b6:	74 48                	je     801900 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  8018b8:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  8018bd:	74 ec                	je     8018ab <malloc+0x56>
+  8018bf:	48 39 1a             	cmp    %rbx,(%rdx)
+  8018c2:	72 e7                	jb     8018ab <malloc+0x56>
+                real_freep_size--;
+  8018c4:	48 83 e8 01          	sub    $0x1,%rax
+  8018c8:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  8018cf:	00 00 00 
+                freep[i].is_free = false;
+  8018d2:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8018d9:	00 00 00 
+  8018dc:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8018e0:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8018e4:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8018e8:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8018ef:	00 
+                freep[i].size = size;
+  8018f0:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8018f4:	48 01 c8             	add    %rcx,%rax
+  8018f7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8018fb:	e9 0b 01 00 00       	jmp    801a0b <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801900:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801907:	00 00 00 
+  80190a:	48 01 d8             	add    %rbx,%rax
+  80190d:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801913:	76 7c                	jbe    801991 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801915:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  80191c:	00 00 00 
+  80191f:	4c 8b 30             	mov    (%rax),%r14
+  801922:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801929:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  80192c:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801933:	00 00 00 
+  801936:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  80193d:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801944:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80194a:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80194e:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  801955:	00 00 00 
+  801958:	ff d0                	call   *%rax
+  80195a:	89 c7                	mov    %eax,%edi
+  80195c:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801963:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80196a:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801971:	00 00 00 
+  801974:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801978:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80197d:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  801984:	00 00 00 
+  801987:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	0f 88 90 00 00 00    	js     801a21 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801991:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801998:	00 00 00 
+  80199b:	48 8b 31             	mov    (%rcx),%rsi
+  80199e:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  8019a5:	00 00 00 
+  8019a8:	4c 8b 07             	mov    (%rdi),%r8
+  8019ab:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  8019af:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  8019b6:	00 00 00 
+  8019b9:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  8019bd:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  8019c1:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8019c8:	00 00 00 
+  8019cb:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  8019cf:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  8019d2:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8019d6:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8019dd:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8019de:	48 89 d8             	mov    %rbx,%rax
+  8019e1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019e6:	4c 01 c0             	add    %r8,%rax
+  8019e9:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8019ec:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8019f3:	48 01 f3             	add    %rsi,%rbx
+  8019f6:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8019f9:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8019fe:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801a05:	00 00 00 
+  801a08:	48 89 d0             	mov    %rdx,%rax
+}
+  801a0b:	5b                   	pop    %rbx
+  801a0c:	41 5c                	pop    %r12
+  801a0e:	41 5d                	pop    %r13
+  801a10:	41 5e                	pop    %r14
+  801a12:	5d                   	pop    %rbp
+  801a13:	c3                   	ret
+        return NULL;
+  801a14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a19:	c3                   	ret
+        return NULL;
+  801a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1f:	eb ea                	jmp    801a0b <malloc+0x1b6>
+            return NULL;
+  801a21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a26:	eb e3                	jmp    801a0b <malloc+0x1b6>
+
+0000000000801a28 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801a28:	55                   	push   %rbp
+  801a29:	48 89 e5             	mov    %rsp,%rbp
+  801a2c:	53                   	push   %rbx
+  801a2d:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801a31:	48 89 fb             	mov    %rdi,%rbx
+  801a34:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801a38:	48 89 df             	mov    %rbx,%rdi
+  801a3b:	48 b8 55 18 80 00 00 	movabs $0x801855,%rax
+  801a42:	00 00 00 
+  801a45:	ff d0                	call   *%rax
+  801a47:	48 89 c7             	mov    %rax,%rdi
+  801a4a:	48 89 da             	mov    %rbx,%rdx
+  801a4d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a52:	48 b8 61 0f 80 00 00 	movabs $0x800f61,%rax
+  801a59:	00 00 00 
+  801a5c:	ff d0                	call   *%rax
+}
+  801a5e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a62:	c9                   	leave
+  801a63:	c3                   	ret
+
+0000000000801a64 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801a64:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801a6b:	00 00 00 
+  801a6e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801a75:	00 00 00 
+  801a78:	48 3b 02             	cmp    (%rdx),%rax
+  801a7b:	74 4d                	je     801aca <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801a7d:	48 85 c0             	test   %rax,%rax
+  801a80:	74 4d                	je     801acf <get_allocsize+0x6b>
+  801a82:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801a89:	00 00 00 
+  801a8c:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801a91:	48 3b 39             	cmp    (%rcx),%rdi
+  801a94:	74 13                	je     801aa9 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801a96:	48 83 c2 01          	add    $0x1,%rdx
+  801a9a:	48 83 c1 18          	add    $0x18,%rcx
+  801a9e:	48 39 d0             	cmp    %rdx,%rax
+  801aa1:	75 ee                	jne    801a91 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801aa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa8:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801aa9:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab2:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801ab9:	00 00 00 
+  801abc:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801ac2:	75 0b                	jne    801acf <get_allocsize+0x6b>
+  801ac4:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801ac9:	c3                   	ret
+        return 0;
+  801aca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801acf:	c3                   	ret
+
+0000000000801ad0 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801ad0:	48 85 ff             	test   %rdi,%rdi
+  801ad3:	0f 84 01 01 00 00    	je     801bda <free+0x10a>
+free(void *ptr) {
+  801ad9:	55                   	push   %rbp
+  801ada:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801add:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801ae4:	00 00 00 
+  801ae7:	48 8b 30             	mov    (%rax),%rsi
+  801aea:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801af1:	00 00 00 
+  801af4:	48 39 c6             	cmp    %rax,%rsi
+  801af7:	74 50                	je     801b49 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801af9:	48 85 f6             	test   %rsi,%rsi
+  801afc:	74 21                	je     801b1f <free+0x4f>
+  801afe:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801b05:	00 00 00 
+  801b08:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801b0d:	48 3b 39             	cmp    (%rcx),%rdi
+  801b10:	74 61                	je     801b73 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801b12:	48 83 c2 01          	add    $0x1,%rdx
+  801b16:	48 83 c1 18          	add    $0x18,%rcx
+  801b1a:	48 39 d6             	cmp    %rdx,%rsi
+  801b1d:	75 ee                	jne    801b0d <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801b1f:	48 ba f0 55 80 00 00 	movabs $0x8055f0,%rdx
+  801b26:	00 00 00 
+  801b29:	be 12 01 00 00       	mov    $0x112,%esi
+  801b2e:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801b35:	00 00 00 
+  801b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3d:	48 b9 31 44 80 00 00 	movabs $0x804431,%rcx
+  801b44:	00 00 00 
+  801b47:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801b49:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801b50:	00 00 00 
+  801b53:	be 06 01 00 00       	mov    $0x106,%esi
+  801b58:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801b5f:	00 00 00 
+  801b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b67:	48 b9 31 44 80 00 00 	movabs $0x804431,%rcx
+  801b6e:	00 00 00 
+  801b71:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801b73:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b77:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801b7e:	00 00 00 
+  801b81:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b87:	75 27                	jne    801bb0 <free+0xe0>
+            freep[i].is_free = true;
+  801b89:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b8d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801b94:	00 00 00 
+  801b97:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801b9e:	00 00 
+            real_freep_size++;
+  801ba0:	48 83 c0 01          	add    $0x1,%rax
+  801ba4:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801bab:	00 00 00 
+}
+  801bae:	5d                   	pop    %rbp
+  801baf:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801bb0:	48 ba c8 55 80 00 00 	movabs $0x8055c8,%rdx
+  801bb7:	00 00 00 
+  801bba:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801bbf:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801bc6:	00 00 00 
+  801bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bce:	48 b9 31 44 80 00 00 	movabs $0x804431,%rcx
+  801bd5:	00 00 00 
+  801bd8:	ff d1                	call   *%rcx
+  801bda:	c3                   	ret
+
+0000000000801bdb <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801bdb:	55                   	push   %rbp
+  801bdc:	48 89 e5             	mov    %rsp,%rbp
+  801bdf:	41 55                	push   %r13
+  801be1:	41 54                	push   %r12
+  801be3:	53                   	push   %rbx
+  801be4:	48 83 ec 08          	sub    $0x8,%rsp
+  801be8:	48 89 fb             	mov    %rdi,%rbx
+  801beb:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801bee:	48 b8 64 1a 80 00 00 	movabs $0x801a64,%rax
+  801bf5:	00 00 00 
+  801bf8:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801bfa:	49 39 c5             	cmp    %rax,%r13
+  801bfd:	73 0e                	jae    801c0d <realloc+0x32>
+}
+  801bff:	48 89 d8             	mov    %rbx,%rax
+  801c02:	48 83 c4 08          	add    $0x8,%rsp
+  801c06:	5b                   	pop    %rbx
+  801c07:	41 5c                	pop    %r12
+  801c09:	41 5d                	pop    %r13
+  801c0b:	5d                   	pop    %rbp
+  801c0c:	c3                   	ret
+  801c0d:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801c10:	4c 89 ef             	mov    %r13,%rdi
+  801c13:	48 b8 55 18 80 00 00 	movabs $0x801855,%rax
+  801c1a:	00 00 00 
+  801c1d:	ff d0                	call   *%rax
+  801c1f:	48 89 c7             	mov    %rax,%rdi
+  801c22:	4c 89 e2             	mov    %r12,%rdx
+  801c25:	48 89 de             	mov    %rbx,%rsi
+  801c28:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  801c2f:	00 00 00 
+  801c32:	ff d0                	call   *%rax
+  801c34:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801c37:	48 89 df             	mov    %rbx,%rdi
+  801c3a:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  801c41:	00 00 00 
+  801c44:	ff d0                	call   *%rax
+    return newptr;
+  801c46:	4c 89 e3             	mov    %r12,%rbx
+  801c49:	eb b4                	jmp    801bff <realloc+0x24>
+
+0000000000801c4b <strdup>:
+
+char*
+strdup (const char *src) {
+  801c4b:	55                   	push   %rbp
+  801c4c:	48 89 e5             	mov    %rsp,%rbp
+  801c4f:	41 54                	push   %r12
+  801c51:	53                   	push   %rbx
+  801c52:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801c55:	48 b8 43 0c 80 00 00 	movabs $0x800c43,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+  801c61:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801c65:	4c 89 e7             	mov    %r12,%rdi
+  801c68:	48 b8 55 18 80 00 00 	movabs $0x801855,%rax
+  801c6f:	00 00 00 
+  801c72:	ff d0                	call   *%rax
+  801c74:	48 89 c7             	mov    %rax,%rdi
+  801c77:	4c 89 e2             	mov    %r12,%rdx
+  801c7a:	48 89 de             	mov    %rbx,%rsi
+  801c7d:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  801c84:	00 00 00 
+  801c87:	ff d0                	call   *%rax
+}
+  801c89:	5b                   	pop    %rbx
+  801c8a:	41 5c                	pop    %r12
+  801c8c:	5d                   	pop    %rbp
+  801c8d:	c3                   	ret
+
+0000000000801c8e <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801c8e:	55                   	push   %rbp
+  801c8f:	48 89 e5             	mov    %rsp,%rbp
+  801c92:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c93:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ca2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cac:	be 00 00 00 00       	mov    $0x0,%esi
+  801cb1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cb7:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801cb9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cbd:	c9                   	leave
+  801cbe:	c3                   	ret
+
+0000000000801cbf <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801cbf:	55                   	push   %rbp
+  801cc0:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801cc3:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801cca:	00 00 00 
+  801ccd:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801cd1:	74 26                	je     801cf9 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801cd3:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801cd5:	48 c1 e2 20          	shl    $0x20,%rdx
+  801cd9:	89 c0                	mov    %eax,%eax
+  801cdb:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801cde:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801ce5:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801cec:	00 00 00 
+  801cef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf4:	48 f7 31             	divq   (%rcx)
+}
+  801cf7:	5d                   	pop    %rbp
+  801cf8:	c3                   	ret
+        freq = get_cpufreq();
+  801cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cfe:	48 ba 8e 1c 80 00 00 	movabs $0x801c8e,%rdx
+  801d05:	00 00 00 
+  801d08:	ff d2                	call   *%rdx
+  801d0a:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801d11:	00 00 00 
+  801d14:	eb bd                	jmp    801cd3 <get_ticks+0x14>
+
+0000000000801d16 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801d16:	55                   	push   %rbp
+  801d17:	48 89 e5             	mov    %rsp,%rbp
+  801d1a:	53                   	push   %rbx
+  801d1b:	48 83 ec 08          	sub    $0x8,%rsp
+  801d1f:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801d22:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d29:	00 00 00 
+  801d2c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d30:	74 50                	je     801d82 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801d32:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d34:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d38:	89 c0                	mov    %eax,%eax
+  801d3a:	48 89 d6             	mov    %rdx,%rsi
+  801d3d:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801d40:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d47:	00 00 00 
+  801d4a:	48 0f af 18          	imul   (%rax),%rbx
+  801d4e:	48 c1 eb 03          	shr    $0x3,%rbx
+  801d52:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801d59:	9b c4 20 
+  801d5c:	48 89 d8             	mov    %rbx,%rax
+  801d5f:	48 f7 e2             	mul    %rdx
+  801d62:	48 89 d1             	mov    %rdx,%rcx
+  801d65:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801d69:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d6b:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d6f:	89 c0                	mov    %eax,%eax
+  801d71:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801d74:	48 29 f2             	sub    %rsi,%rdx
+  801d77:	48 39 ca             	cmp    %rcx,%rdx
+  801d7a:	72 ed                	jb     801d69 <sleep+0x53>
+}
+  801d7c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d80:	c9                   	leave
+  801d81:	c3                   	ret
+        freq = get_cpufreq();
+  801d82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d87:	48 ba 8e 1c 80 00 00 	movabs $0x801c8e,%rdx
+  801d8e:	00 00 00 
+  801d91:	ff d2                	call   *%rdx
+  801d93:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801d9a:	00 00 00 
+  801d9d:	eb 93                	jmp    801d32 <sleep+0x1c>
+
+0000000000801d9f <poll_kbd>:
+
+int poll_kbd() {
+  801d9f:	55                   	push   %rbp
+  801da0:	48 89 e5             	mov    %rsp,%rbp
+  801da3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801da4:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801da9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dae:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801db3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801db8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dc8:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801dca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dce:	c9                   	leave
+  801dcf:	c3                   	ret
+
+0000000000801dd0 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801dd0:	55                   	push   %rbp
+  801dd1:	48 89 e5             	mov    %rsp,%rbp
+  801dd4:	53                   	push   %rbx
+  801dd5:	49 89 fa             	mov    %rdi,%r10
+  801dd8:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801dda:	44 89 c6             	mov    %r8d,%esi
+  801ddd:	89 cf                	mov    %ecx,%edi
+  801ddf:	89 d3                	mov    %edx,%ebx
+  801de1:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801de3:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801de8:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801deb:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801def:	cd 30                	int    $0x30
+  801df1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801df5:	c9                   	leave
+  801df6:	c3                   	ret
+
+0000000000801df7 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801df7:	55                   	push   %rbp
+  801df8:	48 89 e5             	mov    %rsp,%rbp
+  801dfb:	41 54                	push   %r12
+  801dfd:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  801dfe:	48 b8 53 38 80 00 00 	movabs $0x803853,%rax
+  801e05:	00 00 00 
+  801e08:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801e0a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801e0f:	cd 30                	int    $0x30
+  801e11:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801e14:	85 c0                	test   %eax,%eax
+  801e16:	78 76                	js     801e8e <fork+0x97>
+        return envid;
+    if (!envid) {
+  801e18:	74 7c                	je     801e96 <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801e1a:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801e20:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801e27:	00 00 00 
+  801e2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e2f:	89 c2                	mov    %eax,%edx
+  801e31:	be 00 00 00 00       	mov    $0x0,%esi
+  801e36:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e3b:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  801e42:	00 00 00 
+  801e45:	ff d0                	call   *%rax
+  801e47:	85 c0                	test   %eax,%eax
+  801e49:	75 7c                	jne    801ec7 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801e4b:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  801e52:	00 00 00 
+  801e55:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801e5c:	44 89 e7             	mov    %r12d,%edi
+  801e5f:	48 b8 f9 16 80 00 00 	movabs $0x8016f9,%rax
+  801e66:	00 00 00 
+  801e69:	ff d0                	call   *%rax
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	75 60                	jne    801ecf <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  801e6f:	be 02 00 00 00       	mov    $0x2,%esi
+  801e74:	44 89 e7             	mov    %r12d,%edi
+  801e77:	48 b8 27 16 80 00 00 	movabs $0x801627,%rax
+  801e7e:	00 00 00 
+  801e81:	ff d0                	call   *%rax
+        return -1;
+  801e83:	85 c0                	test   %eax,%eax
+  801e85:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801e8a:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  801e8e:	44 89 e0             	mov    %r12d,%eax
+  801e91:	5b                   	pop    %rbx
+  801e92:	41 5c                	pop    %r12
+  801e94:	5d                   	pop    %rbp
+  801e95:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801e96:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  801e9d:	00 00 00 
+  801ea0:	ff d0                	call   *%rax
+  801ea2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ea7:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  801eae:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801eb5:	00 00 00 
+  801eb8:	48 01 d0             	add    %rdx,%rax
+  801ebb:	48 a3 08 70 80 00 00 	movabs %rax,0x807008
+  801ec2:	00 00 00 
+        return 0;
+  801ec5:	eb c7                	jmp    801e8e <fork+0x97>
+        return -1;
+  801ec7:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801ecd:	eb bf                	jmp    801e8e <fork+0x97>
+  801ecf:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801ed5:	eb b7                	jmp    801e8e <fork+0x97>
+
+0000000000801ed7 <sfork>:
+
+envid_t
+sfork() {
+  801ed7:	55                   	push   %rbp
+  801ed8:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801edb:	48 ba 26 56 80 00 00 	movabs $0x805626,%rdx
+  801ee2:	00 00 00 
+  801ee5:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801eea:	48 bf 41 56 80 00 00 	movabs $0x805641,%rdi
+  801ef1:	00 00 00 
+  801ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef9:	48 b9 31 44 80 00 00 	movabs $0x804431,%rcx
+  801f00:	00 00 00 
+  801f03:	ff d1                	call   *%rcx
+
+0000000000801f05 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801f05:	55                   	push   %rbp
+  801f06:	48 89 e5             	mov    %rsp,%rbp
+  801f09:	41 55                	push   %r13
+  801f0b:	41 54                	push   %r12
+  801f0d:	53                   	push   %rbx
+  801f0e:	48 83 ec 08          	sub    $0x8,%rsp
+  801f12:	49 89 fc             	mov    %rdi,%r12
+  801f15:	48 89 f7             	mov    %rsi,%rdi
+  801f18:	48 89 d3             	mov    %rdx,%rbx
+  801f1b:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  801f1e:	48 85 f6             	test   %rsi,%rsi
+  801f21:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801f28:	00 00 00 
+  801f2b:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  801f2f:	be 00 10 00 00       	mov    $0x1000,%esi
+  801f34:	48 85 d2             	test   %rdx,%rdx
+  801f37:	74 03                	je     801f3c <ipc_recv+0x37>
+  801f39:	48 8b 32             	mov    (%rdx),%rsi
+  801f3c:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+    if (errno) {
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	74 1c                	je     801f68 <ipc_recv+0x63>
+        if (from_env_store)
+  801f4c:	4d 85 e4             	test   %r12,%r12
+  801f4f:	74 08                	je     801f59 <ipc_recv+0x54>
+            *from_env_store = 0;
+  801f51:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801f58:	00 
+
+        if (perm_store)
+  801f59:	4d 85 ed             	test   %r13,%r13
+  801f5c:	74 74                	je     801fd2 <ipc_recv+0xcd>
+            *perm_store = 0;
+  801f5e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801f65:	00 
+  801f66:	eb 6a                	jmp    801fd2 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  801f68:	4d 85 e4             	test   %r12,%r12
+  801f6b:	74 14                	je     801f81 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  801f6d:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  801f74:	00 00 00 
+  801f77:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  801f7d:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  801f81:	48 85 db             	test   %rbx,%rbx
+  801f84:	74 23                	je     801fa9 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801f86:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  801f8d:	00 00 00 
+  801f90:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  801f96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9b:	85 c9                	test   %ecx,%ecx
+  801f9d:	74 07                	je     801fa6 <ipc_recv+0xa1>
+  801f9f:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  801fa6:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  801fa9:	4d 85 ed             	test   %r13,%r13
+  801fac:	74 14                	je     801fc2 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  801fae:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  801fb5:	00 00 00 
+  801fb8:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  801fbe:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  801fc2:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  801fc9:	00 00 00 
+  801fcc:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  801fd2:	48 83 c4 08          	add    $0x8,%rsp
+  801fd6:	5b                   	pop    %rbx
+  801fd7:	41 5c                	pop    %r12
+  801fd9:	41 5d                	pop    %r13
+  801fdb:	5d                   	pop    %rbp
+  801fdc:	c3                   	ret
+
+0000000000801fdd <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801fdd:	55                   	push   %rbp
+  801fde:	48 89 e5             	mov    %rsp,%rbp
+  801fe1:	41 55                	push   %r13
+  801fe3:	41 54                	push   %r12
+  801fe5:	53                   	push   %rbx
+  801fe6:	48 83 ec 08          	sub    $0x8,%rsp
+  801fea:	49 89 fc             	mov    %rdi,%r12
+  801fed:	48 89 f7             	mov    %rsi,%rdi
+  801ff0:	48 89 d3             	mov    %rdx,%rbx
+  801ff3:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  801ff6:	48 85 f6             	test   %rsi,%rsi
+  801ff9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802000:	00 00 00 
+  802003:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  802007:	be 00 10 00 00       	mov    $0x1000,%esi
+  80200c:	48 85 d2             	test   %rdx,%rdx
+  80200f:	74 03                	je     802014 <ipc_try_recv+0x37>
+  802011:	48 8b 32             	mov    (%rdx),%rsi
+  802014:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+    if (errno) {
+  802020:	85 c0                	test   %eax,%eax
+  802022:	75 75                	jne    802099 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  802024:	4d 85 e4             	test   %r12,%r12
+  802027:	74 14                	je     80203d <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802029:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  802030:	00 00 00 
+  802033:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  802039:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80203d:	48 85 db             	test   %rbx,%rbx
+  802040:	74 23                	je     802065 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  802042:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  802049:	00 00 00 
+  80204c:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  802052:	ba 00 00 00 00       	mov    $0x0,%edx
+  802057:	85 c9                	test   %ecx,%ecx
+  802059:	74 07                	je     802062 <ipc_try_recv+0x85>
+  80205b:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  802062:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  802065:	4d 85 ed             	test   %r13,%r13
+  802068:	74 14                	je     80207e <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80206a:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  802071:	00 00 00 
+  802074:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80207a:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80207e:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  802085:	00 00 00 
+  802088:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80208e:	48 83 c4 08          	add    $0x8,%rsp
+  802092:	5b                   	pop    %rbx
+  802093:	41 5c                	pop    %r12
+  802095:	41 5d                	pop    %r13
+  802097:	5d                   	pop    %rbp
+  802098:	c3                   	ret
+        if (from_env_store)
+  802099:	4d 85 e4             	test   %r12,%r12
+  80209c:	74 08                	je     8020a6 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80209e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8020a5:	00 
+        if (perm_store)
+  8020a6:	4d 85 ed             	test   %r13,%r13
+  8020a9:	74 e3                	je     80208e <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8020ab:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8020b2:	00 
+  8020b3:	eb d9                	jmp    80208e <ipc_try_recv+0xb1>
+
+00000000008020b5 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8020b5:	55                   	push   %rbp
+  8020b6:	48 89 e5             	mov    %rsp,%rbp
+  8020b9:	41 57                	push   %r15
+  8020bb:	41 56                	push   %r14
+  8020bd:	41 55                	push   %r13
+  8020bf:	41 54                	push   %r12
+  8020c1:	53                   	push   %rbx
+  8020c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8020c6:	41 89 fd             	mov    %edi,%r13d
+  8020c9:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8020cc:	48 89 d3             	mov    %rdx,%rbx
+  8020cf:	49 89 cc             	mov    %rcx,%r12
+  8020d2:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8020d6:	48 85 d2             	test   %rdx,%rdx
+  8020d9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8020e0:	00 00 00 
+  8020e3:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8020e7:	49 be 62 17 80 00 00 	movabs $0x801762,%r14
+  8020ee:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8020f1:	49 bf 52 13 80 00 00 	movabs $0x801352,%r15
+  8020f8:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8020fb:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8020fe:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802102:	4c 89 e1             	mov    %r12,%rcx
+  802105:	48 89 da             	mov    %rbx,%rdx
+  802108:	44 89 ef             	mov    %r13d,%edi
+  80210b:	41 ff d6             	call   *%r14
+  80210e:	85 c0                	test   %eax,%eax
+  802110:	74 37                	je     802149 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  802112:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802115:	75 05                	jne    80211c <ipc_send+0x67>
+        sys_yield();
+  802117:	41 ff d7             	call   *%r15
+  80211a:	eb df                	jmp    8020fb <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80211c:	89 c1                	mov    %eax,%ecx
+  80211e:	48 ba 4c 56 80 00 00 	movabs $0x80564c,%rdx
+  802125:	00 00 00 
+  802128:	be 65 00 00 00       	mov    $0x65,%esi
+  80212d:	48 bf 67 56 80 00 00 	movabs $0x805667,%rdi
+  802134:	00 00 00 
+  802137:	b8 00 00 00 00       	mov    $0x0,%eax
+  80213c:	49 b8 31 44 80 00 00 	movabs $0x804431,%r8
+  802143:	00 00 00 
+  802146:	41 ff d0             	call   *%r8
+    }
+}
+  802149:	48 83 c4 18          	add    $0x18,%rsp
+  80214d:	5b                   	pop    %rbx
+  80214e:	41 5c                	pop    %r12
+  802150:	41 5d                	pop    %r13
+  802152:	41 5e                	pop    %r14
+  802154:	41 5f                	pop    %r15
+  802156:	5d                   	pop    %rbp
+  802157:	c3                   	ret
+
+0000000000802158 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802158:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80215d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802164:	00 00 00 
+  802167:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80216e:	48 01 ca             	add    %rcx,%rdx
+  802171:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802177:	39 fa                	cmp    %edi,%edx
+  802179:	74 12                	je     80218d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80217b:	48 83 c0 01          	add    $0x1,%rax
+  80217f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802185:	75 e0                	jne    802167 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802187:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80218c:	c3                   	ret
+            return envs[i].env_id;
+  80218d:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  802194:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80219b:	00 00 00 
+  80219e:	48 01 d0             	add    %rdx,%rax
+  8021a1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8021a7:	c3                   	ret
+
+00000000008021a8 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8021a8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8021af:	ff ff ff 
+  8021b2:	48 01 f8             	add    %rdi,%rax
+  8021b5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8021b9:	c3                   	ret
+
+00000000008021ba <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8021ba:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8021c1:	ff ff ff 
+  8021c4:	48 01 f8             	add    %rdi,%rax
+  8021c7:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8021cb:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8021d1:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8021d5:	c3                   	ret
+
+00000000008021d6 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8021d6:	55                   	push   %rbp
+  8021d7:	48 89 e5             	mov    %rsp,%rbp
+  8021da:	41 57                	push   %r15
+  8021dc:	41 56                	push   %r14
+  8021de:	41 55                	push   %r13
+  8021e0:	41 54                	push   %r12
+  8021e2:	53                   	push   %rbx
+  8021e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e7:	49 89 ff             	mov    %rdi,%r15
+  8021ea:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8021ef:	49 bd 8a 40 80 00 00 	movabs $0x80408a,%r13
+  8021f6:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8021f9:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8021ff:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802202:	48 89 df             	mov    %rbx,%rdi
+  802205:	41 ff d5             	call   *%r13
+  802208:	83 e0 04             	and    $0x4,%eax
+  80220b:	74 17                	je     802224 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80220d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802214:	4c 39 f3             	cmp    %r14,%rbx
+  802217:	75 e6                	jne    8021ff <fd_alloc+0x29>
+  802219:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80221f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802224:	4d 89 27             	mov    %r12,(%r15)
+}
+  802227:	48 83 c4 08          	add    $0x8,%rsp
+  80222b:	5b                   	pop    %rbx
+  80222c:	41 5c                	pop    %r12
+  80222e:	41 5d                	pop    %r13
+  802230:	41 5e                	pop    %r14
+  802232:	41 5f                	pop    %r15
+  802234:	5d                   	pop    %rbp
+  802235:	c3                   	ret
+
+0000000000802236 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802236:	83 ff 1f             	cmp    $0x1f,%edi
+  802239:	77 39                	ja     802274 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80223b:	55                   	push   %rbp
+  80223c:	48 89 e5             	mov    %rsp,%rbp
+  80223f:	41 54                	push   %r12
+  802241:	53                   	push   %rbx
+  802242:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802245:	48 63 df             	movslq %edi,%rbx
+  802248:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80224f:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802253:	48 89 df             	mov    %rbx,%rdi
+  802256:	48 b8 8a 40 80 00 00 	movabs $0x80408a,%rax
+  80225d:	00 00 00 
+  802260:	ff d0                	call   *%rax
+  802262:	a8 04                	test   $0x4,%al
+  802264:	74 14                	je     80227a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802266:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80226a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80226f:	5b                   	pop    %rbx
+  802270:	41 5c                	pop    %r12
+  802272:	5d                   	pop    %rbp
+  802273:	c3                   	ret
+        return -E_INVAL;
+  802274:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802279:	c3                   	ret
+        return -E_INVAL;
+  80227a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80227f:	eb ee                	jmp    80226f <fd_lookup+0x39>
+
+0000000000802281 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802281:	55                   	push   %rbp
+  802282:	48 89 e5             	mov    %rsp,%rbp
+  802285:	41 54                	push   %r12
+  802287:	53                   	push   %rbx
+  802288:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80228b:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  802292:	00 00 00 
+  802295:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80229c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80229f:	39 3b                	cmp    %edi,(%rbx)
+  8022a1:	74 47                	je     8022ea <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8022a3:	48 83 c0 08          	add    $0x8,%rax
+  8022a7:	48 8b 18             	mov    (%rax),%rbx
+  8022aa:	48 85 db             	test   %rbx,%rbx
+  8022ad:	75 f0                	jne    80229f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8022af:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8022b6:	00 00 00 
+  8022b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022bf:	89 fa                	mov    %edi,%edx
+  8022c1:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  8022c8:	00 00 00 
+  8022cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d0:	48 b9 09 03 80 00 00 	movabs $0x800309,%rcx
+  8022d7:	00 00 00 
+  8022da:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8022dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8022e1:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8022e5:	5b                   	pop    %rbx
+  8022e6:	41 5c                	pop    %r12
+  8022e8:	5d                   	pop    %rbp
+  8022e9:	c3                   	ret
+            return 0;
+  8022ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ef:	eb f0                	jmp    8022e1 <dev_lookup+0x60>
+
+00000000008022f1 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8022f1:	55                   	push   %rbp
+  8022f2:	48 89 e5             	mov    %rsp,%rbp
+  8022f5:	41 55                	push   %r13
+  8022f7:	41 54                	push   %r12
+  8022f9:	53                   	push   %rbx
+  8022fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8022fe:	48 89 fb             	mov    %rdi,%rbx
+  802301:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802304:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80230b:	ff ff ff 
+  80230e:	48 01 df             	add    %rbx,%rdi
+  802311:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802315:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802319:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  802320:	00 00 00 
+  802323:	ff d0                	call   *%rax
+  802325:	41 89 c5             	mov    %eax,%r13d
+  802328:	85 c0                	test   %eax,%eax
+  80232a:	78 06                	js     802332 <fd_close+0x41>
+  80232c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802330:	74 1a                	je     80234c <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802332:	45 84 e4             	test   %r12b,%r12b
+  802335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80233e:	44 89 e8             	mov    %r13d,%eax
+  802341:	48 83 c4 18          	add    $0x18,%rsp
+  802345:	5b                   	pop    %rbx
+  802346:	41 5c                	pop    %r12
+  802348:	41 5d                	pop    %r13
+  80234a:	5d                   	pop    %rbp
+  80234b:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80234c:	8b 3b                	mov    (%rbx),%edi
+  80234e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802352:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  802359:	00 00 00 
+  80235c:	ff d0                	call   *%rax
+  80235e:	41 89 c5             	mov    %eax,%r13d
+  802361:	85 c0                	test   %eax,%eax
+  802363:	78 1b                	js     802380 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802365:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802369:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80236d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802373:	48 85 c0             	test   %rax,%rax
+  802376:	74 08                	je     802380 <fd_close+0x8f>
+  802378:	48 89 df             	mov    %rbx,%rdi
+  80237b:	ff d0                	call   *%rax
+  80237d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802380:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802385:	48 89 de             	mov    %rbx,%rsi
+  802388:	bf 00 00 00 00       	mov    $0x0,%edi
+  80238d:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  802394:	00 00 00 
+  802397:	ff d0                	call   *%rax
+    return res;
+  802399:	eb a3                	jmp    80233e <fd_close+0x4d>
+
+000000000080239b <close>:
+
+int
+close(int fdnum) {
+  80239b:	55                   	push   %rbp
+  80239c:	48 89 e5             	mov    %rsp,%rbp
+  80239f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8023a3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023a7:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  8023ae:	00 00 00 
+  8023b1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023b3:	85 c0                	test   %eax,%eax
+  8023b5:	78 15                	js     8023cc <close+0x31>
+
+    return fd_close(fd, 1);
+  8023b7:	be 01 00 00 00       	mov    $0x1,%esi
+  8023bc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8023c0:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  8023c7:	00 00 00 
+  8023ca:	ff d0                	call   *%rax
+}
+  8023cc:	c9                   	leave
+  8023cd:	c3                   	ret
+
+00000000008023ce <close_all>:
+
+void
+close_all(void) {
+  8023ce:	55                   	push   %rbp
+  8023cf:	48 89 e5             	mov    %rsp,%rbp
+  8023d2:	41 54                	push   %r12
+  8023d4:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8023d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023da:	49 bc 9b 23 80 00 00 	movabs $0x80239b,%r12
+  8023e1:	00 00 00 
+  8023e4:	89 df                	mov    %ebx,%edi
+  8023e6:	41 ff d4             	call   *%r12
+  8023e9:	83 c3 01             	add    $0x1,%ebx
+  8023ec:	83 fb 20             	cmp    $0x20,%ebx
+  8023ef:	75 f3                	jne    8023e4 <close_all+0x16>
+}
+  8023f1:	5b                   	pop    %rbx
+  8023f2:	41 5c                	pop    %r12
+  8023f4:	5d                   	pop    %rbp
+  8023f5:	c3                   	ret
+
+00000000008023f6 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8023f6:	55                   	push   %rbp
+  8023f7:	48 89 e5             	mov    %rsp,%rbp
+  8023fa:	41 57                	push   %r15
+  8023fc:	41 56                	push   %r14
+  8023fe:	41 55                	push   %r13
+  802400:	41 54                	push   %r12
+  802402:	53                   	push   %rbx
+  802403:	48 83 ec 18          	sub    $0x18,%rsp
+  802407:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80240a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80240e:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  802415:	00 00 00 
+  802418:	ff d0                	call   *%rax
+  80241a:	89 c3                	mov    %eax,%ebx
+  80241c:	85 c0                	test   %eax,%eax
+  80241e:	0f 88 b8 00 00 00    	js     8024dc <dup+0xe6>
+    close(newfdnum);
+  802424:	44 89 e7             	mov    %r12d,%edi
+  802427:	48 b8 9b 23 80 00 00 	movabs $0x80239b,%rax
+  80242e:	00 00 00 
+  802431:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802433:	4d 63 ec             	movslq %r12d,%r13
+  802436:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80243d:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802441:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802445:	4c 89 ff             	mov    %r15,%rdi
+  802448:	49 be ba 21 80 00 00 	movabs $0x8021ba,%r14
+  80244f:	00 00 00 
+  802452:	41 ff d6             	call   *%r14
+  802455:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802458:	4c 89 ef             	mov    %r13,%rdi
+  80245b:	41 ff d6             	call   *%r14
+  80245e:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802461:	48 89 df             	mov    %rbx,%rdi
+  802464:	48 b8 8a 40 80 00 00 	movabs $0x80408a,%rax
+  80246b:	00 00 00 
+  80246e:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802470:	a8 04                	test   $0x4,%al
+  802472:	74 2b                	je     80249f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802474:	41 89 c1             	mov    %eax,%r9d
+  802477:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80247d:	4c 89 f1             	mov    %r14,%rcx
+  802480:	ba 00 00 00 00       	mov    $0x0,%edx
+  802485:	48 89 de             	mov    %rbx,%rsi
+  802488:	bf 00 00 00 00       	mov    $0x0,%edi
+  80248d:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  802494:	00 00 00 
+  802497:	ff d0                	call   *%rax
+  802499:	89 c3                	mov    %eax,%ebx
+  80249b:	85 c0                	test   %eax,%eax
+  80249d:	78 4e                	js     8024ed <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80249f:	4c 89 ff             	mov    %r15,%rdi
+  8024a2:	48 b8 8a 40 80 00 00 	movabs $0x80408a,%rax
+  8024a9:	00 00 00 
+  8024ac:	ff d0                	call   *%rax
+  8024ae:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8024b1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024b7:	4c 89 e9             	mov    %r13,%rcx
+  8024ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024bf:	4c 89 fe             	mov    %r15,%rsi
+  8024c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024c7:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  8024ce:	00 00 00 
+  8024d1:	ff d0                	call   *%rax
+  8024d3:	89 c3                	mov    %eax,%ebx
+  8024d5:	85 c0                	test   %eax,%eax
+  8024d7:	78 14                	js     8024ed <dup+0xf7>
+
+    return newfdnum;
+  8024d9:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8024dc:	89 d8                	mov    %ebx,%eax
+  8024de:	48 83 c4 18          	add    $0x18,%rsp
+  8024e2:	5b                   	pop    %rbx
+  8024e3:	41 5c                	pop    %r12
+  8024e5:	41 5d                	pop    %r13
+  8024e7:	41 5e                	pop    %r14
+  8024e9:	41 5f                	pop    %r15
+  8024eb:	5d                   	pop    %rbp
+  8024ec:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8024ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024f2:	4c 89 ee             	mov    %r13,%rsi
+  8024f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024fa:	49 bc c0 15 80 00 00 	movabs $0x8015c0,%r12
+  802501:	00 00 00 
+  802504:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802507:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80250c:	4c 89 f6             	mov    %r14,%rsi
+  80250f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802514:	41 ff d4             	call   *%r12
+    return res;
+  802517:	eb c3                	jmp    8024dc <dup+0xe6>
+
+0000000000802519 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802519:	55                   	push   %rbp
+  80251a:	48 89 e5             	mov    %rsp,%rbp
+  80251d:	41 56                	push   %r14
+  80251f:	41 55                	push   %r13
+  802521:	41 54                	push   %r12
+  802523:	53                   	push   %rbx
+  802524:	48 83 ec 10          	sub    $0x10,%rsp
+  802528:	89 fb                	mov    %edi,%ebx
+  80252a:	49 89 f4             	mov    %rsi,%r12
+  80252d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802530:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802534:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  80253b:	00 00 00 
+  80253e:	ff d0                	call   *%rax
+  802540:	85 c0                	test   %eax,%eax
+  802542:	78 4c                	js     802590 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802544:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802548:	41 8b 3e             	mov    (%r14),%edi
+  80254b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80254f:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  802556:	00 00 00 
+  802559:	ff d0                	call   *%rax
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	78 35                	js     802594 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80255f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802563:	83 e0 03             	and    $0x3,%eax
+  802566:	83 f8 01             	cmp    $0x1,%eax
+  802569:	74 2d                	je     802598 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80256b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80256f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802573:	48 85 c0             	test   %rax,%rax
+  802576:	74 56                	je     8025ce <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802578:	4c 89 ea             	mov    %r13,%rdx
+  80257b:	4c 89 e6             	mov    %r12,%rsi
+  80257e:	4c 89 f7             	mov    %r14,%rdi
+  802581:	ff d0                	call   *%rax
+}
+  802583:	48 83 c4 10          	add    $0x10,%rsp
+  802587:	5b                   	pop    %rbx
+  802588:	41 5c                	pop    %r12
+  80258a:	41 5d                	pop    %r13
+  80258c:	41 5e                	pop    %r14
+  80258e:	5d                   	pop    %rbp
+  80258f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802590:	48 98                	cltq
+  802592:	eb ef                	jmp    802583 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802594:	48 98                	cltq
+  802596:	eb eb                	jmp    802583 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802598:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80259f:	00 00 00 
+  8025a2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8025a8:	89 da                	mov    %ebx,%edx
+  8025aa:	48 bf b9 56 80 00 00 	movabs $0x8056b9,%rdi
+  8025b1:	00 00 00 
+  8025b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b9:	48 b9 09 03 80 00 00 	movabs $0x800309,%rcx
+  8025c0:	00 00 00 
+  8025c3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8025c5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025cc:	eb b5                	jmp    802583 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8025ce:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8025d5:	eb ac                	jmp    802583 <read+0x6a>
+
+00000000008025d7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8025d7:	55                   	push   %rbp
+  8025d8:	48 89 e5             	mov    %rsp,%rbp
+  8025db:	41 57                	push   %r15
+  8025dd:	41 56                	push   %r14
+  8025df:	41 55                	push   %r13
+  8025e1:	41 54                	push   %r12
+  8025e3:	53                   	push   %rbx
+  8025e4:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8025e8:	48 85 d2             	test   %rdx,%rdx
+  8025eb:	74 54                	je     802641 <readn+0x6a>
+  8025ed:	41 89 fd             	mov    %edi,%r13d
+  8025f0:	49 89 f6             	mov    %rsi,%r14
+  8025f3:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8025f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8025fb:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802600:	49 bf 19 25 80 00 00 	movabs $0x802519,%r15
+  802607:	00 00 00 
+  80260a:	4c 89 e2             	mov    %r12,%rdx
+  80260d:	48 29 f2             	sub    %rsi,%rdx
+  802610:	4c 01 f6             	add    %r14,%rsi
+  802613:	44 89 ef             	mov    %r13d,%edi
+  802616:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802619:	85 c0                	test   %eax,%eax
+  80261b:	78 20                	js     80263d <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80261d:	01 c3                	add    %eax,%ebx
+  80261f:	85 c0                	test   %eax,%eax
+  802621:	74 08                	je     80262b <readn+0x54>
+  802623:	48 63 f3             	movslq %ebx,%rsi
+  802626:	4c 39 e6             	cmp    %r12,%rsi
+  802629:	72 df                	jb     80260a <readn+0x33>
+    }
+    return res;
+  80262b:	48 63 c3             	movslq %ebx,%rax
+}
+  80262e:	48 83 c4 08          	add    $0x8,%rsp
+  802632:	5b                   	pop    %rbx
+  802633:	41 5c                	pop    %r12
+  802635:	41 5d                	pop    %r13
+  802637:	41 5e                	pop    %r14
+  802639:	41 5f                	pop    %r15
+  80263b:	5d                   	pop    %rbp
+  80263c:	c3                   	ret
+        if (inc < 0) return inc;
+  80263d:	48 98                	cltq
+  80263f:	eb ed                	jmp    80262e <readn+0x57>
+    int inc = 1, res = 0;
+  802641:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802646:	eb e3                	jmp    80262b <readn+0x54>
+
+0000000000802648 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802648:	55                   	push   %rbp
+  802649:	48 89 e5             	mov    %rsp,%rbp
+  80264c:	41 56                	push   %r14
+  80264e:	41 55                	push   %r13
+  802650:	41 54                	push   %r12
+  802652:	53                   	push   %rbx
+  802653:	48 83 ec 10          	sub    $0x10,%rsp
+  802657:	89 fb                	mov    %edi,%ebx
+  802659:	49 89 f4             	mov    %rsi,%r12
+  80265c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80265f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802663:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  80266a:	00 00 00 
+  80266d:	ff d0                	call   *%rax
+  80266f:	85 c0                	test   %eax,%eax
+  802671:	78 47                	js     8026ba <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802673:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802677:	41 8b 3e             	mov    (%r14),%edi
+  80267a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80267e:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  802685:	00 00 00 
+  802688:	ff d0                	call   *%rax
+  80268a:	85 c0                	test   %eax,%eax
+  80268c:	78 30                	js     8026be <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80268e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802693:	74 2d                	je     8026c2 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802695:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802699:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80269d:	48 85 c0             	test   %rax,%rax
+  8026a0:	74 56                	je     8026f8 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8026a2:	4c 89 ea             	mov    %r13,%rdx
+  8026a5:	4c 89 e6             	mov    %r12,%rsi
+  8026a8:	4c 89 f7             	mov    %r14,%rdi
+  8026ab:	ff d0                	call   *%rax
+}
+  8026ad:	48 83 c4 10          	add    $0x10,%rsp
+  8026b1:	5b                   	pop    %rbx
+  8026b2:	41 5c                	pop    %r12
+  8026b4:	41 5d                	pop    %r13
+  8026b6:	41 5e                	pop    %r14
+  8026b8:	5d                   	pop    %rbp
+  8026b9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026ba:	48 98                	cltq
+  8026bc:	eb ef                	jmp    8026ad <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026be:	48 98                	cltq
+  8026c0:	eb eb                	jmp    8026ad <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026c2:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8026c9:	00 00 00 
+  8026cc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026d2:	89 da                	mov    %ebx,%edx
+  8026d4:	48 bf d5 56 80 00 00 	movabs $0x8056d5,%rdi
+  8026db:	00 00 00 
+  8026de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e3:	48 b9 09 03 80 00 00 	movabs $0x800309,%rcx
+  8026ea:	00 00 00 
+  8026ed:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8026ef:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026f6:	eb b5                	jmp    8026ad <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8026f8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8026ff:	eb ac                	jmp    8026ad <write+0x65>
+
+0000000000802701 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802701:	55                   	push   %rbp
+  802702:	48 89 e5             	mov    %rsp,%rbp
+  802705:	53                   	push   %rbx
+  802706:	48 83 ec 18          	sub    $0x18,%rsp
+  80270a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80270c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802710:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  802717:	00 00 00 
+  80271a:	ff d0                	call   *%rax
+  80271c:	85 c0                	test   %eax,%eax
+  80271e:	78 0c                	js     80272c <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802720:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802724:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802727:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80272c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802730:	c9                   	leave
+  802731:	c3                   	ret
+
+0000000000802732 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802732:	55                   	push   %rbp
+  802733:	48 89 e5             	mov    %rsp,%rbp
+  802736:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80273a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80273e:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  802745:	00 00 00 
+  802748:	ff d0                	call   *%rax
+  80274a:	85 c0                	test   %eax,%eax
+  80274c:	78 07                	js     802755 <tell+0x23>
+    return fdes->fd_offset;
+  80274e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802752:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802755:	c9                   	leave
+  802756:	c3                   	ret
+
+0000000000802757 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802757:	55                   	push   %rbp
+  802758:	48 89 e5             	mov    %rsp,%rbp
+  80275b:	41 55                	push   %r13
+  80275d:	41 54                	push   %r12
+  80275f:	53                   	push   %rbx
+  802760:	48 83 ec 18          	sub    $0x18,%rsp
+  802764:	89 fb                	mov    %edi,%ebx
+  802766:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802769:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80276d:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  802774:	00 00 00 
+  802777:	ff d0                	call   *%rax
+  802779:	85 c0                	test   %eax,%eax
+  80277b:	78 38                	js     8027b5 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80277d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802781:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802785:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802789:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  802790:	00 00 00 
+  802793:	ff d0                	call   *%rax
+  802795:	85 c0                	test   %eax,%eax
+  802797:	78 1c                	js     8027b5 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802799:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80279e:	74 20                	je     8027c0 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8027a0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027a4:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8027a8:	48 85 c0             	test   %rax,%rax
+  8027ab:	74 47                	je     8027f4 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8027ad:	44 89 e6             	mov    %r12d,%esi
+  8027b0:	4c 89 ef             	mov    %r13,%rdi
+  8027b3:	ff d0                	call   *%rax
+}
+  8027b5:	48 83 c4 18          	add    $0x18,%rsp
+  8027b9:	5b                   	pop    %rbx
+  8027ba:	41 5c                	pop    %r12
+  8027bc:	41 5d                	pop    %r13
+  8027be:	5d                   	pop    %rbp
+  8027bf:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8027c0:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8027c7:	00 00 00 
+  8027ca:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8027d0:	89 da                	mov    %ebx,%edx
+  8027d2:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  8027d9:	00 00 00 
+  8027dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e1:	48 b9 09 03 80 00 00 	movabs $0x800309,%rcx
+  8027e8:	00 00 00 
+  8027eb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8027ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027f2:	eb c1                	jmp    8027b5 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8027f4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027f9:	eb ba                	jmp    8027b5 <ftruncate+0x5e>
+
+00000000008027fb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8027fb:	55                   	push   %rbp
+  8027fc:	48 89 e5             	mov    %rsp,%rbp
+  8027ff:	41 54                	push   %r12
+  802801:	53                   	push   %rbx
+  802802:	48 83 ec 10          	sub    $0x10,%rsp
+  802806:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802809:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80280d:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  802814:	00 00 00 
+  802817:	ff d0                	call   *%rax
+  802819:	85 c0                	test   %eax,%eax
+  80281b:	78 4e                	js     80286b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80281d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802821:	41 8b 3c 24          	mov    (%r12),%edi
+  802825:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802829:	48 b8 81 22 80 00 00 	movabs $0x802281,%rax
+  802830:	00 00 00 
+  802833:	ff d0                	call   *%rax
+  802835:	85 c0                	test   %eax,%eax
+  802837:	78 32                	js     80286b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802839:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80283d:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802842:	74 30                	je     802874 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802844:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802847:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80284e:	00 00 00 
+    stat->st_isdir = 0;
+  802851:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802858:	00 00 00 
+    stat->st_dev = dev;
+  80285b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802862:	48 89 de             	mov    %rbx,%rsi
+  802865:	4c 89 e7             	mov    %r12,%rdi
+  802868:	ff 50 28             	call   *0x28(%rax)
+}
+  80286b:	48 83 c4 10          	add    $0x10,%rsp
+  80286f:	5b                   	pop    %rbx
+  802870:	41 5c                	pop    %r12
+  802872:	5d                   	pop    %rbp
+  802873:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802874:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802879:	eb f0                	jmp    80286b <fstat+0x70>
+
+000000000080287b <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80287b:	55                   	push   %rbp
+  80287c:	48 89 e5             	mov    %rsp,%rbp
+  80287f:	41 54                	push   %r12
+  802881:	53                   	push   %rbx
+  802882:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802889:	41 89 fc             	mov    %edi,%r12d
+  80288c:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80288e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802892:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+  80289e:	85 c0                	test   %eax,%eax
+  8028a0:	78 31                	js     8028d3 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8028a2:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8028a9:	44 89 e7             	mov    %r12d,%edi
+  8028ac:	48 b8 fb 27 80 00 00 	movabs $0x8027fb,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+  8028b8:	85 c0                	test   %eax,%eax
+  8028ba:	78 17                	js     8028d3 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8028bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028c0:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8028c3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8028c6:	39 d3                	cmp    %edx,%ebx
+  8028c8:	0f 4f da             	cmovg  %edx,%ebx
+  8028cb:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8028ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028d3:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8028da:	5b                   	pop    %rbx
+  8028db:	41 5c                	pop    %r12
+  8028dd:	5d                   	pop    %rbp
+  8028de:	c3                   	ret
+
+00000000008028df <seektoend>:
+{
+  8028df:	55                   	push   %rbp
+  8028e0:	48 89 e5             	mov    %rsp,%rbp
+  8028e3:	53                   	push   %rbx
+  8028e4:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8028eb:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8028ed:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028f1:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  8028f8:	00 00 00 
+  8028fb:	ff d0                	call   *%rax
+  8028fd:	85 c0                	test   %eax,%eax
+  8028ff:	78 28                	js     802929 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802901:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802908:	89 df                	mov    %ebx,%edi
+  80290a:	48 b8 fb 27 80 00 00 	movabs $0x8027fb,%rax
+  802911:	00 00 00 
+  802914:	ff d0                	call   *%rax
+  802916:	85 c0                	test   %eax,%eax
+  802918:	78 0f                	js     802929 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80291a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80291d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802921:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802924:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802929:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80292d:	c9                   	leave
+  80292e:	c3                   	ret
+
+000000000080292f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80292f:	55                   	push   %rbp
+  802930:	48 89 e5             	mov    %rsp,%rbp
+  802933:	41 54                	push   %r12
+  802935:	53                   	push   %rbx
+  802936:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802939:	be 00 00 00 00       	mov    $0x0,%esi
+  80293e:	48 b8 22 35 80 00 00 	movabs $0x803522,%rax
+  802945:	00 00 00 
+  802948:	ff d0                	call   *%rax
+  80294a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	78 25                	js     802975 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802950:	4c 89 e6             	mov    %r12,%rsi
+  802953:	89 c7                	mov    %eax,%edi
+  802955:	48 b8 fb 27 80 00 00 	movabs $0x8027fb,%rax
+  80295c:	00 00 00 
+  80295f:	ff d0                	call   *%rax
+  802961:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802964:	89 df                	mov    %ebx,%edi
+  802966:	48 b8 9b 23 80 00 00 	movabs $0x80239b,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+
+    return res;
+  802972:	44 89 e3             	mov    %r12d,%ebx
+}
+  802975:	89 d8                	mov    %ebx,%eax
+  802977:	5b                   	pop    %rbx
+  802978:	41 5c                	pop    %r12
+  80297a:	5d                   	pop    %rbp
+  80297b:	c3                   	ret
+
+000000000080297c <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  80297c:	55                   	push   %rbp
+  80297d:	48 89 e5             	mov    %rsp,%rbp
+  802980:	53                   	push   %rbx
+  802981:	48 83 ec 08          	sub    $0x8,%rsp
+  802985:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802988:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  80298f:	00 00 00 
+  802992:	ff d0                	call   *%rax
+  802994:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802998:	0f 87 ea 00 00 00    	ja     802a88 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  80299e:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8029a5:	00 00 00 
+  8029a8:	80 38 00             	cmpb   $0x0,(%rax)
+  8029ab:	75 35                	jne    8029e2 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8029ad:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029b2:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8029b7:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8029bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029c1:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  8029c8:	00 00 00 
+  8029cb:	ff d0                	call   *%rax
+  8029cd:	85 c0                	test   %eax,%eax
+  8029cf:	0f 88 ba 00 00 00    	js     802a8f <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8029d5:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8029dc:	00 00 00 
+  8029df:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8029e2:	48 89 df             	mov    %rbx,%rdi
+  8029e5:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  8029ec:	00 00 00 
+  8029ef:	ff d0                	call   *%rax
+  8029f1:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8029f5:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8029fc:	00 00 00 
+  8029ff:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802a03:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802a06:	39 39                	cmp    %edi,(%rcx)
+  802a08:	74 46                	je     802a50 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802a0a:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802a0e:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802a15:	00 
+  802a16:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802a1d:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802a24:	00 
+  802a25:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802a2c:	00 
+  802a2d:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802a34:	00 
+  802a35:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802a3c:	00 
+  802a3d:	89 39                	mov    %edi,(%rcx)
+  802a3f:	48 01 c6             	add    %rax,%rsi
+  802a42:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802a47:	48 89 c8             	mov    %rcx,%rax
+  802a4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a4e:	c9                   	leave
+  802a4f:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802a50:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802a54:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802a5b:	00 00 00 
+  802a5e:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802a61:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802a65:	74 e0                	je     802a47 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802a67:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802a6e:	00 
+  802a6f:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802a73:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802a7a:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802a7c:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802a7f:	48 01 c2             	add    %rax,%rdx
+  802a82:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802a86:	eb bf                	jmp    802a47 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802a88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a8d:	eb b8                	jmp    802a47 <fbuf_get+0xcb>
+            return NULL;
+  802a8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a94:	eb b1                	jmp    802a47 <fbuf_get+0xcb>
+
+0000000000802a96 <fsipc_bulk>:
+fsipc_bulk(void) {
+  802a96:	55                   	push   %rbp
+  802a97:	48 89 e5             	mov    %rsp,%rbp
+  802a9a:	53                   	push   %rbx
+  802a9b:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802a9f:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802aa6:	00 00 00 
+  802aa9:	48 8b 18             	mov    (%rax),%rbx
+  802aac:	48 85 db             	test   %rbx,%rbx
+  802aaf:	74 16                	je     802ac7 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802ab1:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802ab8:	00 00 00 
+  802abb:	48 8b 18             	mov    (%rax),%rbx
+}
+  802abe:	48 89 d8             	mov    %rbx,%rax
+  802ac1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ac5:	c9                   	leave
+  802ac6:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802ac7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802acc:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802ad1:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802ad6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802adb:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  802ae2:	00 00 00 
+  802ae5:	ff d0                	call   *%rax
+  802ae7:	85 c0                	test   %eax,%eax
+  802ae9:	78 d3                	js     802abe <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802aeb:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802af0:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802af7:	00 00 00 
+  802afa:	eb b5                	jmp    802ab1 <fsipc_bulk+0x1b>
+
+0000000000802afc <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802afc:	55                   	push   %rbp
+  802afd:	48 89 e5             	mov    %rsp,%rbp
+  802b00:	41 57                	push   %r15
+  802b02:	41 56                	push   %r14
+  802b04:	41 55                	push   %r13
+  802b06:	41 54                	push   %r12
+  802b08:	53                   	push   %rbx
+  802b09:	48 83 ec 08          	sub    $0x8,%rsp
+  802b0d:	41 89 fd             	mov    %edi,%r13d
+  802b10:	49 89 f6             	mov    %rsi,%r14
+  802b13:	49 89 d7             	mov    %rdx,%r15
+  802b16:	48 89 cb             	mov    %rcx,%rbx
+  802b19:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b1c:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802b23:	00 00 00 
+  802b26:	83 38 00             	cmpl   $0x0,(%rax)
+  802b29:	74 52                	je     802b7d <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802b2b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b31:	4c 89 f9             	mov    %r15,%rcx
+  802b34:	4c 89 f2             	mov    %r14,%rdx
+  802b37:	44 89 ee             	mov    %r13d,%esi
+  802b3a:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802b41:	00 00 00 
+  802b44:	8b 38                	mov    (%rax),%edi
+  802b46:	48 b8 b5 20 80 00 00 	movabs $0x8020b5,%rax
+  802b4d:	00 00 00 
+  802b50:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802b52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b57:	4c 89 e2             	mov    %r12,%rdx
+  802b5a:	48 89 de             	mov    %rbx,%rsi
+  802b5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b62:	48 b8 05 1f 80 00 00 	movabs $0x801f05,%rax
+  802b69:	00 00 00 
+  802b6c:	ff d0                	call   *%rax
+}
+  802b6e:	48 83 c4 08          	add    $0x8,%rsp
+  802b72:	5b                   	pop    %rbx
+  802b73:	41 5c                	pop    %r12
+  802b75:	41 5d                	pop    %r13
+  802b77:	41 5e                	pop    %r14
+  802b79:	41 5f                	pop    %r15
+  802b7b:	5d                   	pop    %rbp
+  802b7c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b7d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b82:	48 b8 58 21 80 00 00 	movabs $0x802158,%rax
+  802b89:	00 00 00 
+  802b8c:	ff d0                	call   *%rax
+  802b8e:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802b95:	00 00 
+  802b97:	eb 92                	jmp    802b2b <fsipc_region+0x2f>
+
+0000000000802b99 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802b99:	55                   	push   %rbp
+  802b9a:	48 89 e5             	mov    %rsp,%rbp
+  802b9d:	41 57                	push   %r15
+  802b9f:	41 56                	push   %r14
+  802ba1:	41 55                	push   %r13
+  802ba3:	41 54                	push   %r12
+  802ba5:	53                   	push   %rbx
+  802ba6:	48 83 ec 28          	sub    $0x28,%rsp
+  802baa:	49 89 ff             	mov    %rdi,%r15
+  802bad:	49 89 f6             	mov    %rsi,%r14
+  802bb0:	48 89 d3             	mov    %rdx,%rbx
+  802bb3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802bb7:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802bba:	48 b8 96 2a 80 00 00 	movabs $0x802a96,%rax
+  802bc1:	00 00 00 
+  802bc4:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802bc6:	48 85 c0             	test   %rax,%rax
+  802bc9:	0f 84 cc 00 00 00    	je     802c9b <devfile_write_direct+0x102>
+  802bcf:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802bd2:	48 85 db             	test   %rbx,%rbx
+  802bd5:	0f 84 ba 00 00 00    	je     802c95 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802bdb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802be1:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802be8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802bec:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802bf0:	4c 29 e3             	sub    %r12,%rbx
+  802bf3:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802bf8:	48 39 c3             	cmp    %rax,%rbx
+  802bfb:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802bff:	48 89 da             	mov    %rbx,%rdx
+  802c02:	4c 89 f6             	mov    %r14,%rsi
+  802c05:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802c09:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  802c10:	00 00 00 
+  802c13:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802c15:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802c19:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802c1d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802c20:	44 01 e0             	add    %r12d,%eax
+  802c23:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802c27:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802c2b:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802c32:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802c39:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802c40:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c4b:	4c 89 ee             	mov    %r13,%rsi
+  802c4e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802c53:	48 b8 fc 2a 80 00 00 	movabs $0x802afc,%rax
+  802c5a:	00 00 00 
+  802c5d:	ff d0                	call   *%rax
+        if (res < 0)
+  802c5f:	85 c0                	test   %eax,%eax
+  802c61:	78 29                	js     802c8c <devfile_write_direct+0xf3>
+        if (res == 0)
+  802c63:	74 2b                	je     802c90 <devfile_write_direct+0xf7>
+        i += res;
+  802c65:	48 98                	cltq
+  802c67:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802c6a:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802c6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c71:	49 39 c4             	cmp    %rax,%r12
+  802c74:	0f 82 72 ff ff ff    	jb     802bec <devfile_write_direct+0x53>
+    return i;
+  802c7a:	4c 89 e0             	mov    %r12,%rax
+}
+  802c7d:	48 83 c4 28          	add    $0x28,%rsp
+  802c81:	5b                   	pop    %rbx
+  802c82:	41 5c                	pop    %r12
+  802c84:	41 5d                	pop    %r13
+  802c86:	41 5e                	pop    %r14
+  802c88:	41 5f                	pop    %r15
+  802c8a:	5d                   	pop    %rbp
+  802c8b:	c3                   	ret
+            return res;
+  802c8c:	48 98                	cltq
+  802c8e:	eb ed                	jmp    802c7d <devfile_write_direct+0xe4>
+            return i;
+  802c90:	4c 89 e0             	mov    %r12,%rax
+  802c93:	eb e8                	jmp    802c7d <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802c95:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802c99:	eb df                	jmp    802c7a <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802c9b:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802ca2:	eb d9                	jmp    802c7d <devfile_write_direct+0xe4>
+
+0000000000802ca4 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802ca4:	55                   	push   %rbp
+  802ca5:	48 89 e5             	mov    %rsp,%rbp
+  802ca8:	41 56                	push   %r14
+  802caa:	41 55                	push   %r13
+  802cac:	41 54                	push   %r12
+  802cae:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802caf:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802cb3:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbc:	4d 39 ee             	cmp    %r13,%r14
+  802cbf:	0f 84 99 00 00 00    	je     802d5e <fbuf_flush+0xba>
+  802cc5:	49 89 fc             	mov    %rdi,%r12
+  802cc8:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802ccb:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802cce:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802cd2:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  802cd9:	00 00 00 
+  802cdc:	ff d0                	call   *%rax
+  802cde:	48 89 c2             	mov    %rax,%rdx
+  802ce1:	48 c1 e2 04          	shl    $0x4,%rdx
+  802ce5:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802ce9:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ced:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802cf2:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802cf5:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802cf9:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802d00:	00 
+  802d01:	44 89 f1             	mov    %r14d,%ecx
+  802d04:	4c 89 ea             	mov    %r13,%rdx
+  802d07:	4c 89 e7             	mov    %r12,%rdi
+  802d0a:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802d11:	00 00 00 
+  802d14:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d16:	48 85 c0             	test   %rax,%rax
+  802d19:	78 43                	js     802d5e <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802d1b:	4c 39 e8             	cmp    %r13,%rax
+  802d1e:	72 47                	jb     802d67 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802d20:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802d25:	83 c0 01             	add    $0x1,%eax
+  802d28:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d2d:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802d30:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802d34:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802d38:	72 0f                	jb     802d49 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802d3a:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802d3e:	48 39 c2             	cmp    %rax,%rdx
+  802d41:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802d45:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802d49:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802d50:	00 
+  802d51:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802d58:	00 
+    return 0;
+  802d59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d5e:	5b                   	pop    %rbx
+  802d5f:	41 5c                	pop    %r12
+  802d61:	41 5d                	pop    %r13
+  802d63:	41 5e                	pop    %r14
+  802d65:	5d                   	pop    %rbp
+  802d66:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802d67:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802d6c:	eb f0                	jmp    802d5e <fbuf_flush+0xba>
+
+0000000000802d6e <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802d6e:	55                   	push   %rbp
+  802d6f:	48 89 e5             	mov    %rsp,%rbp
+  802d72:	53                   	push   %rbx
+  802d73:	48 83 ec 08          	sub    $0x8,%rsp
+  802d77:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802d7a:	48 b8 7c 29 80 00 00 	movabs $0x80297c,%rax
+  802d81:	00 00 00 
+  802d84:	ff d0                	call   *%rax
+  802d86:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8e:	48 85 f6             	test   %rsi,%rsi
+  802d91:	74 0f                	je     802da2 <devfile_sync+0x34>
+  802d93:	48 89 df             	mov    %rbx,%rdi
+  802d96:	48 b8 a4 2c 80 00 00 	movabs $0x802ca4,%rax
+  802d9d:	00 00 00 
+  802da0:	ff d0                	call   *%rax
+}
+  802da2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802da6:	c9                   	leave
+  802da7:	c3                   	ret
+
+0000000000802da8 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802da8:	55                   	push   %rbp
+  802da9:	48 89 e5             	mov    %rsp,%rbp
+  802dac:	48 83 ec 10          	sub    $0x10,%rsp
+  802db0:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802db3:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802dba:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802dbb:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802dbf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dc4:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802dcb:	00 00 00 
+  802dce:	48 b8 fc 2a 80 00 00 	movabs $0x802afc,%rax
+  802dd5:	00 00 00 
+  802dd8:	ff d0                	call   *%rax
+}
+  802dda:	c9                   	leave
+  802ddb:	c3                   	ret
+
+0000000000802ddc <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ddc:	55                   	push   %rbp
+  802ddd:	48 89 e5             	mov    %rsp,%rbp
+  802de0:	41 54                	push   %r12
+  802de2:	53                   	push   %rbx
+  802de3:	48 89 fb             	mov    %rdi,%rbx
+  802de6:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802de9:	48 b8 6e 2d 80 00 00 	movabs $0x802d6e,%rax
+  802df0:	00 00 00 
+  802df3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802df5:	85 c0                	test   %eax,%eax
+  802df7:	78 63                	js     802e5c <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802df9:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802dfc:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802e03:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802e05:	be 00 00 00 00       	mov    $0x0,%esi
+  802e0a:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e0f:	48 b8 a8 2d 80 00 00 	movabs $0x802da8,%rax
+  802e16:	00 00 00 
+  802e19:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e1b:	85 c0                	test   %eax,%eax
+  802e1d:	78 3d                	js     802e5c <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e1f:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802e26:	00 00 00 
+  802e29:	48 89 de             	mov    %rbx,%rsi
+  802e2c:	4c 89 e7             	mov    %r12,%rdi
+  802e2f:	48 b8 81 0c 80 00 00 	movabs $0x800c81,%rax
+  802e36:	00 00 00 
+  802e39:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802e3b:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802e41:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802e48:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802e49:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802e4f:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802e56:	00 
+
+    return 0;
+  802e57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e5c:	5b                   	pop    %rbx
+  802e5d:	41 5c                	pop    %r12
+  802e5f:	5d                   	pop    %rbp
+  802e60:	c3                   	ret
+
+0000000000802e61 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802e61:	55                   	push   %rbp
+  802e62:	48 89 e5             	mov    %rsp,%rbp
+  802e65:	41 54                	push   %r12
+  802e67:	53                   	push   %rbx
+  802e68:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802e6b:	48 b8 6e 2d 80 00 00 	movabs $0x802d6e,%rax
+  802e72:	00 00 00 
+  802e75:	ff d0                	call   *%rax
+  802e77:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802e7a:	48 89 df             	mov    %rbx,%rdi
+  802e7d:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  802e84:	00 00 00 
+  802e87:	ff d0                	call   *%rax
+  802e89:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802e8d:	76 2e                	jbe    802ebd <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802e8f:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e92:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802e99:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802e9b:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ea5:	48 b8 a8 2d 80 00 00 	movabs $0x802da8,%rax
+  802eac:	00 00 00 
+  802eaf:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802eb1:	45 85 e4             	test   %r12d,%r12d
+  802eb4:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802eb8:	5b                   	pop    %rbx
+  802eb9:	41 5c                	pop    %r12
+  802ebb:	5d                   	pop    %rbp
+  802ebc:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802ebd:	48 89 df             	mov    %rbx,%rdi
+  802ec0:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  802ec7:	00 00 00 
+  802eca:	ff d0                	call   *%rax
+  802ecc:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802ed0:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802ed7:	00 00 00 
+  802eda:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802ee1:	48 89 df             	mov    %rbx,%rdi
+  802ee4:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  802eeb:	00 00 00 
+  802eee:	ff d0                	call   *%rax
+  802ef0:	48 89 c6             	mov    %rax,%rsi
+  802ef3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ef8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802efd:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  802f04:	00 00 00 
+  802f07:	ff d0                	call   *%rax
+  802f09:	eb 84                	jmp    802e8f <devfile_flush+0x2e>
+
+0000000000802f0b <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802f0b:	55                   	push   %rbp
+  802f0c:	48 89 e5             	mov    %rsp,%rbp
+  802f0f:	41 55                	push   %r13
+  802f11:	41 54                	push   %r12
+  802f13:	53                   	push   %rbx
+  802f14:	48 83 ec 08          	sub    $0x8,%rsp
+  802f18:	48 89 fb             	mov    %rdi,%rbx
+  802f1b:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802f1e:	48 b8 7c 29 80 00 00 	movabs $0x80297c,%rax
+  802f25:	00 00 00 
+  802f28:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f2a:	48 85 c0             	test   %rax,%rax
+  802f2d:	74 51                	je     802f80 <devfile_trunc+0x75>
+  802f2f:	49 89 c4             	mov    %rax,%r12
+  802f32:	48 89 c6             	mov    %rax,%rsi
+  802f35:	48 89 df             	mov    %rbx,%rdi
+  802f38:	48 b8 a4 2c 80 00 00 	movabs $0x802ca4,%rax
+  802f3f:	00 00 00 
+  802f42:	ff d0                	call   *%rax
+  802f44:	85 c0                	test   %eax,%eax
+  802f46:	78 2d                	js     802f75 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f48:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802f4f:	00 00 00 
+  802f52:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f55:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802f57:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802f5b:	be 00 00 00 00       	mov    $0x0,%esi
+  802f60:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f65:	48 b8 a8 2d 80 00 00 	movabs $0x802da8,%rax
+  802f6c:	00 00 00 
+  802f6f:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802f71:	85 c0                	test   %eax,%eax
+  802f73:	79 3e                	jns    802fb3 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802f75:	48 83 c4 08          	add    $0x8,%rsp
+  802f79:	5b                   	pop    %rbx
+  802f7a:	41 5c                	pop    %r12
+  802f7c:	41 5d                	pop    %r13
+  802f7e:	5d                   	pop    %rbp
+  802f7f:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f80:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802f87:	00 00 00 
+  802f8a:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f8d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802f8f:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802f93:	be 00 00 00 00       	mov    $0x0,%esi
+  802f98:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f9d:	48 b8 a8 2d 80 00 00 	movabs $0x802da8,%rax
+  802fa4:	00 00 00 
+  802fa7:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802fa9:	85 c0                	test   %eax,%eax
+  802fab:	78 c8                	js     802f75 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802fad:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802fb1:	eb c2                	jmp    802f75 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802fb3:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802fb6:	8d 51 01             	lea    0x1(%rcx),%edx
+  802fb9:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802fbc:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802fc1:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802fc8:	00 00 
+  802fca:	eb a9                	jmp    802f75 <devfile_trunc+0x6a>
+
+0000000000802fcc <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802fcc:	55                   	push   %rbp
+  802fcd:	48 89 e5             	mov    %rsp,%rbp
+  802fd0:	41 57                	push   %r15
+  802fd2:	41 56                	push   %r14
+  802fd4:	41 55                	push   %r13
+  802fd6:	41 54                	push   %r12
+  802fd8:	53                   	push   %rbx
+  802fd9:	48 83 ec 28          	sub    $0x28,%rsp
+  802fdd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802fe1:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802fe5:	49 89 d7             	mov    %rdx,%r15
+  802fe8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802fec:	48 b8 7c 29 80 00 00 	movabs $0x80297c,%rax
+  802ff3:	00 00 00 
+  802ff6:	ff d0                	call   *%rax
+  802ff8:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802ffb:	48 85 c0             	test   %rax,%rax
+  802ffe:	74 31                	je     803031 <devfile_write+0x65>
+  803000:	4c 89 f8             	mov    %r15,%rax
+  803003:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  80300a:	77 25                	ja     803031 <devfile_write+0x65>
+    size_t i = 0;
+  80300c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  803012:	48 85 c0             	test   %rax,%rax
+  803015:	0f 85 64 01 00 00    	jne    80317f <devfile_write+0x1b3>
+    size_t i = 0;
+  80301b:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  80301f:	4c 89 f8             	mov    %r15,%rax
+}
+  803022:	48 83 c4 28          	add    $0x28,%rsp
+  803026:	5b                   	pop    %rbx
+  803027:	41 5c                	pop    %r12
+  803029:	41 5d                	pop    %r13
+  80302b:	41 5e                	pop    %r14
+  80302d:	41 5f                	pop    %r15
+  80302f:	5d                   	pop    %rbp
+  803030:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803031:	48 85 db             	test   %rbx,%rbx
+  803034:	74 5b                	je     803091 <devfile_write+0xc5>
+  803036:	48 89 de             	mov    %rbx,%rsi
+  803039:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80303d:	48 b8 a4 2c 80 00 00 	movabs $0x802ca4,%rax
+  803044:	00 00 00 
+  803047:	ff d0                	call   *%rax
+  803049:	85 c0                	test   %eax,%eax
+  80304b:	78 40                	js     80308d <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80304d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803051:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  803054:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803058:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80305c:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  803063:	00 00 00 
+  803066:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803068:	48 85 c0             	test   %rax,%rax
+  80306b:	7e b5                	jle    803022 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80306d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803071:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  803074:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  803077:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  80307a:	8d 51 01             	lea    0x1(%rcx),%edx
+  80307d:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803080:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  803083:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80308a:	00 
+  80308b:	eb 95                	jmp    803022 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80308d:	48 98                	cltq
+  80308f:	eb 91                	jmp    803022 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803091:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803095:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  803098:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80309c:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8030a0:	48 89 df             	mov    %rbx,%rdi
+  8030a3:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  8030aa:	00 00 00 
+  8030ad:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8030af:	48 85 c0             	test   %rax,%rax
+  8030b2:	0f 8e 6a ff ff ff    	jle    803022 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8030b8:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  8030bb:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8030bf:	e9 5e ff ff ff       	jmp    803022 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8030c4:	48 98                	cltq
+  8030c6:	4d 85 ff             	test   %r15,%r15
+  8030c9:	49 0f 45 c7          	cmovne %r15,%rax
+  8030cd:	e9 50 ff ff ff       	jmp    803022 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8030d2:	48 89 de             	mov    %rbx,%rsi
+  8030d5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030d9:	48 b8 a4 2c 80 00 00 	movabs $0x802ca4,%rax
+  8030e0:	00 00 00 
+  8030e3:	ff d0                	call   *%rax
+  8030e5:	85 c0                	test   %eax,%eax
+  8030e7:	0f 88 2b 01 00 00    	js     803218 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8030ed:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8030f1:	4c 01 f8             	add    %r15,%rax
+  8030f4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8030f8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030fc:	48 b9 a8 21 80 00 00 	movabs $0x8021a8,%rcx
+  803103:	00 00 00 
+  803106:	ff d1                	call   *%rcx
+  803108:	48 89 c2             	mov    %rax,%rdx
+  80310b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80310f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803113:	48 c1 e0 0c          	shl    $0xc,%rax
+  803117:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  80311c:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80311f:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803126:	00 
+  803127:	4c 89 ea             	mov    %r13,%rdx
+  80312a:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80312e:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  803135:	00 00 00 
+  803138:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  80313a:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80313e:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803142:	48 39 c2             	cmp    %rax,%rdx
+  803145:	0f 84 db 00 00 00    	je     803226 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  80314b:	4c 39 e2             	cmp    %r12,%rdx
+  80314e:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  803152:	4d 01 ec             	add    %r13,%r12
+  803155:	49 39 c4             	cmp    %rax,%r12
+  803158:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  80315c:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803160:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  803164:	45 01 ee             	add    %r13d,%r14d
+  803167:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80316b:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  80316f:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803172:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803176:	49 39 c7             	cmp    %rax,%r15
+  803179:	0f 83 a0 fe ff ff    	jae    80301f <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  80317f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803183:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  803187:	8b 43 08             	mov    0x8(%rbx),%eax
+  80318a:	44 39 f0             	cmp    %r14d,%eax
+  80318d:	7f 10                	jg     80319f <devfile_write+0x1d3>
+  80318f:	48 98                	cltq
+  803191:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  803197:	49 63 d6             	movslq %r14d,%rdx
+  80319a:	48 39 d0             	cmp    %rdx,%rax
+  80319d:	7d 2d                	jge    8031cc <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80319f:	48 89 de             	mov    %rbx,%rsi
+  8031a2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031a6:	48 b8 a4 2c 80 00 00 	movabs $0x802ca4,%rax
+  8031ad:	00 00 00 
+  8031b0:	ff d0                	call   *%rax
+  8031b2:	85 c0                	test   %eax,%eax
+  8031b4:	0f 88 0a ff ff ff    	js     8030c4 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8031ba:	44 89 f0             	mov    %r14d,%eax
+  8031bd:	66 b8 00 00          	mov    $0x0,%ax
+  8031c1:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  8031c4:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8031cb:	00 
+        size_t off = pos - fb->fb_base;
+  8031cc:	45 89 f4             	mov    %r14d,%r12d
+  8031cf:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  8031d3:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  8031d6:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  8031da:	4d 29 fd             	sub    %r15,%r13
+  8031dd:	b8 00 00 01 00       	mov    $0x10000,%eax
+  8031e2:	4c 29 e0             	sub    %r12,%rax
+  8031e5:	49 39 c5             	cmp    %rax,%r13
+  8031e8:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  8031ec:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8031f0:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8031f4:	48 39 c2             	cmp    %rax,%rdx
+  8031f7:	0f 84 f0 fe ff ff    	je     8030ed <devfile_write+0x121>
+  8031fd:	4c 39 e0             	cmp    %r12,%rax
+  803200:	0f 82 cc fe ff ff    	jb     8030d2 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803206:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80320a:	48 39 d0             	cmp    %rdx,%rax
+  80320d:	0f 83 da fe ff ff    	jae    8030ed <devfile_write+0x121>
+  803213:	e9 ba fe ff ff       	jmp    8030d2 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803218:	48 98                	cltq
+  80321a:	4d 85 ff             	test   %r15,%r15
+  80321d:	49 0f 45 c7          	cmovne %r15,%rax
+  803221:	e9 fc fd ff ff       	jmp    803022 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803226:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80322a:	4c 89 e2             	mov    %r12,%rdx
+  80322d:	e9 2a ff ff ff       	jmp    80315c <devfile_write+0x190>
+
+0000000000803232 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803232:	55                   	push   %rbp
+  803233:	48 89 e5             	mov    %rsp,%rbp
+  803236:	41 57                	push   %r15
+  803238:	41 56                	push   %r14
+  80323a:	41 55                	push   %r13
+  80323c:	41 54                	push   %r12
+  80323e:	53                   	push   %rbx
+  80323f:	48 83 ec 28          	sub    $0x28,%rsp
+  803243:	49 89 ff             	mov    %rdi,%r15
+  803246:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80324a:	48 89 d3             	mov    %rdx,%rbx
+  80324d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803251:	48 b8 7c 29 80 00 00 	movabs $0x80297c,%rax
+  803258:	00 00 00 
+  80325b:	ff d0                	call   *%rax
+  80325d:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803260:	48 85 c0             	test   %rax,%rax
+  803263:	74 0d                	je     803272 <devfile_read+0x40>
+  803265:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  80326c:	0f 86 1a 01 00 00    	jbe    80338c <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803272:	4d 85 e4             	test   %r12,%r12
+  803275:	74 1a                	je     803291 <devfile_read+0x5f>
+  803277:	4c 89 e6             	mov    %r12,%rsi
+  80327a:	4c 89 ff             	mov    %r15,%rdi
+  80327d:	48 b8 a4 2c 80 00 00 	movabs $0x802ca4,%rax
+  803284:	00 00 00 
+  803287:	ff d0                	call   *%rax
+  803289:	85 c0                	test   %eax,%eax
+  80328b:	0f 88 e8 00 00 00    	js     803379 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803291:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  803295:	48 b8 96 2a 80 00 00 	movabs $0x802a96,%rax
+  80329c:	00 00 00 
+  80329f:	ff d0                	call   *%rax
+  8032a1:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  8032a4:	48 85 c0             	test   %rax,%rax
+  8032a7:	0f 84 69 02 00 00    	je     803516 <devfile_read+0x2e4>
+    while (i < n) {
+  8032ad:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8032b2:	0f 84 ce 00 00 00    	je     803386 <devfile_read+0x154>
+    size_t i = 0;
+  8032b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8032bd:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8032c4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8032c8:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  8032cc:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  8032d0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8032d4:	48 29 da             	sub    %rbx,%rdx
+  8032d7:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8032dc:	48 39 c2             	cmp    %rax,%rdx
+  8032df:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  8032e3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8032e7:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  8032eb:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8032ee:	01 d8                	add    %ebx,%eax
+  8032f0:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  8032f4:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  8032f8:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  8032ff:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803306:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80330d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803313:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803318:	4c 89 ee             	mov    %r13,%rsi
+  80331b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803320:	48 b8 fc 2a 80 00 00 	movabs $0x802afc,%rax
+  803327:	00 00 00 
+  80332a:	ff d0                	call   *%rax
+        if (res < 0)
+  80332c:	85 c0                	test   %eax,%eax
+  80332e:	78 4d                	js     80337d <devfile_read+0x14b>
+        if (res == 0)
+  803330:	74 4f                	je     803381 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803332:	4c 63 e0             	movslq %eax,%r12
+  803335:	4c 89 e2             	mov    %r12,%rdx
+  803338:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80333c:	4c 89 f7             	mov    %r14,%rdi
+  80333f:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  803346:	00 00 00 
+  803349:	ff d0                	call   *%rax
+        i += res;
+  80334b:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  80334e:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803351:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803355:	48 39 c3             	cmp    %rax,%rbx
+  803358:	0f 82 72 ff ff ff    	jb     8032d0 <devfile_read+0x9e>
+    return i;
+  80335e:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803361:	48 85 c0             	test   %rax,%rax
+  803364:	7e 04                	jle    80336a <devfile_read+0x138>
+  803366:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  80336a:	48 83 c4 28          	add    $0x28,%rsp
+  80336e:	5b                   	pop    %rbx
+  80336f:	41 5c                	pop    %r12
+  803371:	41 5d                	pop    %r13
+  803373:	41 5e                	pop    %r14
+  803375:	41 5f                	pop    %r15
+  803377:	5d                   	pop    %rbp
+  803378:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803379:	48 98                	cltq
+  80337b:	eb ed                	jmp    80336a <devfile_read+0x138>
+            return res;
+  80337d:	48 98                	cltq
+  80337f:	eb e9                	jmp    80336a <devfile_read+0x138>
+            return i;
+  803381:	48 89 d8             	mov    %rbx,%rax
+  803384:	eb db                	jmp    803361 <devfile_read+0x12f>
+    size_t i = 0;
+  803386:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80338a:	eb d2                	jmp    80335e <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80338c:	48 89 c6             	mov    %rax,%rsi
+  80338f:	4c 89 ff             	mov    %r15,%rdi
+  803392:	48 b8 a4 2c 80 00 00 	movabs $0x802ca4,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+  80339e:	85 c0                	test   %eax,%eax
+  8033a0:	78 40                	js     8033e2 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8033a2:	4c 89 ff             	mov    %r15,%rdi
+  8033a5:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  8033ac:	00 00 00 
+  8033af:	ff d0                	call   *%rax
+  8033b1:	48 89 c2             	mov    %rax,%rdx
+  8033b4:	48 c1 e2 04          	shl    $0x4,%rdx
+  8033b8:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8033bc:	48 c1 e0 0c          	shl    $0xc,%rax
+  8033c0:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8033c5:	48 01 d0             	add    %rdx,%rax
+  8033c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8033cc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8033d1:	0f 84 33 01 00 00    	je     80350a <devfile_read+0x2d8>
+    size_t i = 0;
+  8033d7:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8033dd:	e9 f5 00 00 00       	jmp    8034d7 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8033e2:	48 98                	cltq
+  8033e4:	eb 84                	jmp    80336a <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8033e6:	44 89 e8             	mov    %r13d,%eax
+  8033e9:	66 b8 00 00          	mov    $0x0,%ax
+  8033ed:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8033f2:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8033f9:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8033fb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8033ff:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803403:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803405:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80340a:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80340d:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803414:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80341b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803420:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803425:	bf 03 00 00 00       	mov    $0x3,%edi
+  80342a:	48 b8 fc 2a 80 00 00 	movabs $0x802afc,%rax
+  803431:	00 00 00 
+  803434:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803436:	85 c0                	test   %eax,%eax
+  803438:	0f 88 be 00 00 00    	js     8034fc <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80343e:	48 63 d0             	movslq %eax,%rdx
+  803441:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803446:	41 03 44 24 08       	add    0x8(%r12),%eax
+  80344b:	44 39 e8             	cmp    %r13d,%eax
+  80344e:	0f 8e ba 00 00 00    	jle    80350e <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803454:	49 63 c5             	movslq %r13d,%rax
+  803457:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  80345c:	48 29 c3             	sub    %rax,%rbx
+  80345f:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803464:	48 01 c3             	add    %rax,%rbx
+  803467:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80346b:	4c 29 f0             	sub    %r14,%rax
+  80346e:	48 39 c3             	cmp    %rax,%rbx
+  803471:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803475:	4c 89 ff             	mov    %r15,%rdi
+  803478:	48 b9 a8 21 80 00 00 	movabs $0x8021a8,%rcx
+  80347f:	00 00 00 
+  803482:	ff d1                	call   *%rcx
+  803484:	48 89 c2             	mov    %rax,%rdx
+  803487:	48 c1 e2 04          	shl    $0x4,%rdx
+  80348b:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80348f:	48 c1 e0 0c          	shl    $0xc,%rax
+  803493:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803498:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  80349b:	44 89 ea             	mov    %r13d,%edx
+  80349e:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8034a3:	48 63 d2             	movslq %edx,%rdx
+  8034a6:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8034ad:	00 
+  8034ae:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8034b2:	4c 01 f7             	add    %r14,%rdi
+  8034b5:	48 89 da             	mov    %rbx,%rdx
+  8034b8:	48 b9 76 10 80 00 00 	movabs $0x801076,%rcx
+  8034bf:	00 00 00 
+  8034c2:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8034c4:	41 01 dd             	add    %ebx,%r13d
+  8034c7:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8034cb:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8034ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034d2:	49 39 c6             	cmp    %rax,%r14
+  8034d5:	73 37                	jae    80350e <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8034d7:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8034db:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8034e0:	44 39 e8             	cmp    %r13d,%eax
+  8034e3:	0f 8f fd fe ff ff    	jg     8033e6 <devfile_read+0x1b4>
+  8034e9:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8034ee:	44 39 e8             	cmp    %r13d,%eax
+  8034f1:	0f 8f 5d ff ff ff    	jg     803454 <devfile_read+0x222>
+  8034f7:	e9 ea fe ff ff       	jmp    8033e6 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8034fc:	48 98                	cltq
+  8034fe:	4d 85 f6             	test   %r14,%r14
+  803501:	49 0f 45 c6          	cmovne %r14,%rax
+  803505:	e9 60 fe ff ff       	jmp    80336a <devfile_read+0x138>
+    size_t i = 0;
+  80350a:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80350e:	4c 89 f0             	mov    %r14,%rax
+  803511:	e9 54 fe ff ff       	jmp    80336a <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803516:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80351d:	e9 48 fe ff ff       	jmp    80336a <devfile_read+0x138>
+
+0000000000803522 <open>:
+open(const char *path, int mode) {
+  803522:	55                   	push   %rbp
+  803523:	48 89 e5             	mov    %rsp,%rbp
+  803526:	41 55                	push   %r13
+  803528:	41 54                	push   %r12
+  80352a:	53                   	push   %rbx
+  80352b:	48 83 ec 18          	sub    $0x18,%rsp
+  80352f:	49 89 fc             	mov    %rdi,%r12
+  803532:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803535:	48 b8 43 0c 80 00 00 	movabs $0x800c43,%rax
+  80353c:	00 00 00 
+  80353f:	ff d0                	call   *%rax
+  803541:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803547:	0f 87 8a 00 00 00    	ja     8035d7 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80354d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803551:	48 b8 d6 21 80 00 00 	movabs $0x8021d6,%rax
+  803558:	00 00 00 
+  80355b:	ff d0                	call   *%rax
+  80355d:	89 c3                	mov    %eax,%ebx
+  80355f:	85 c0                	test   %eax,%eax
+  803561:	78 50                	js     8035b3 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803563:	4c 89 e6             	mov    %r12,%rsi
+  803566:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80356d:	00 00 00 
+  803570:	48 89 df             	mov    %rbx,%rdi
+  803573:	48 b8 81 0c 80 00 00 	movabs $0x800c81,%rax
+  80357a:	00 00 00 
+  80357d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80357f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803586:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80358a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80358f:	48 b8 a8 2d 80 00 00 	movabs $0x802da8,%rax
+  803596:	00 00 00 
+  803599:	ff d0                	call   *%rax
+  80359b:	89 c3                	mov    %eax,%ebx
+  80359d:	85 c0                	test   %eax,%eax
+  80359f:	78 1f                	js     8035c0 <open+0x9e>
+    return fd2num(fd);
+  8035a1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035a5:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  8035ac:	00 00 00 
+  8035af:	ff d0                	call   *%rax
+  8035b1:	89 c3                	mov    %eax,%ebx
+}
+  8035b3:	89 d8                	mov    %ebx,%eax
+  8035b5:	48 83 c4 18          	add    $0x18,%rsp
+  8035b9:	5b                   	pop    %rbx
+  8035ba:	41 5c                	pop    %r12
+  8035bc:	41 5d                	pop    %r13
+  8035be:	5d                   	pop    %rbp
+  8035bf:	c3                   	ret
+        fd_close(fd, 0);
+  8035c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8035c5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035c9:	48 b8 f1 22 80 00 00 	movabs $0x8022f1,%rax
+  8035d0:	00 00 00 
+  8035d3:	ff d0                	call   *%rax
+        return res;
+  8035d5:	eb dc                	jmp    8035b3 <open+0x91>
+        return -E_BAD_PATH;
+  8035d7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035dc:	eb d5                	jmp    8035b3 <open+0x91>
+
+00000000008035de <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8035de:	55                   	push   %rbp
+  8035df:	48 89 e5             	mov    %rsp,%rbp
+  8035e2:	41 57                	push   %r15
+  8035e4:	41 56                	push   %r14
+  8035e6:	41 55                	push   %r13
+  8035e8:	41 54                	push   %r12
+  8035ea:	53                   	push   %rbx
+  8035eb:	48 83 ec 18          	sub    $0x18,%rsp
+  8035ef:	41 89 f6             	mov    %esi,%r14d
+  8035f2:	49 89 d7             	mov    %rdx,%r15
+  8035f5:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8035f8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8035fc:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  803603:	00 00 00 
+  803606:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803608:	85 c0                	test   %eax,%eax
+  80360a:	0f 88 db 00 00 00    	js     8036eb <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803610:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803614:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80361b:	00 00 00 
+  80361e:	8b 00                	mov    (%rax),%eax
+  803620:	39 07                	cmp    %eax,(%rdi)
+  803622:	0f 85 db 00 00 00    	jne    803703 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803628:	45 85 f6             	test   %r14d,%r14d
+  80362b:	0f 88 db 00 00 00    	js     80370c <fmap+0x12e>
+  803631:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803638:	0f 85 d7 00 00 00    	jne    803715 <fmap+0x137>
+  80363e:	4c 89 fb             	mov    %r15,%rbx
+  803641:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803647:	0f 85 d1 00 00 00    	jne    80371e <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80364d:	48 b8 6e 2d 80 00 00 	movabs $0x802d6e,%rax
+  803654:	00 00 00 
+  803657:	ff d0                	call   *%rax
+  803659:	85 c0                	test   %eax,%eax
+  80365b:	0f 88 8e 00 00 00    	js     8036ef <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803661:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803668:	00 00 00 
+    while (i < n) {
+  80366b:	4d 85 ed             	test   %r13,%r13
+  80366e:	0f 84 8a 00 00 00    	je     8036fe <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803674:	4c 89 ea             	mov    %r13,%rdx
+  803677:	48 29 da             	sub    %rbx,%rdx
+  80367a:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803681:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803687:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80368b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80368f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803692:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  803696:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  80369a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  80369f:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8036a4:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8036a8:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8036ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036b1:	4c 89 e6             	mov    %r12,%rsi
+  8036b4:	bf 09 00 00 00       	mov    $0x9,%edi
+  8036b9:	48 b8 fc 2a 80 00 00 	movabs $0x802afc,%rax
+  8036c0:	00 00 00 
+  8036c3:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8036c5:	85 c0                	test   %eax,%eax
+  8036c7:	78 2a                	js     8036f3 <fmap+0x115>
+        i += res;
+  8036c9:	48 98                	cltq
+  8036cb:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8036ce:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8036d2:	72 05                	jb     8036d9 <fmap+0xfb>
+    while (i < n) {
+  8036d4:	4c 39 eb             	cmp    %r13,%rbx
+  8036d7:	72 9b                	jb     803674 <fmap+0x96>
+    }
+    return i;
+  8036d9:	48 89 d8             	mov    %rbx,%rax
+}
+  8036dc:	48 83 c4 18          	add    $0x18,%rsp
+  8036e0:	5b                   	pop    %rbx
+  8036e1:	41 5c                	pop    %r12
+  8036e3:	41 5d                	pop    %r13
+  8036e5:	41 5e                	pop    %r14
+  8036e7:	41 5f                	pop    %r15
+  8036e9:	5d                   	pop    %rbp
+  8036ea:	c3                   	ret
+    if (res < 0) return res;
+  8036eb:	48 98                	cltq
+  8036ed:	eb ed                	jmp    8036dc <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8036ef:	48 98                	cltq
+  8036f1:	eb e9                	jmp    8036dc <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8036f3:	48 98                	cltq
+  8036f5:	48 85 db             	test   %rbx,%rbx
+  8036f8:	48 0f 45 c3          	cmovne %rbx,%rax
+  8036fc:	eb de                	jmp    8036dc <fmap+0xfe>
+    size_t i = 0;
+  8036fe:	4c 89 eb             	mov    %r13,%rbx
+  803701:	eb d6                	jmp    8036d9 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803703:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80370a:	eb d0                	jmp    8036dc <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80370c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803713:	eb c7                	jmp    8036dc <fmap+0xfe>
+  803715:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80371c:	eb be                	jmp    8036dc <fmap+0xfe>
+  80371e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803725:	eb b5                	jmp    8036dc <fmap+0xfe>
+
+0000000000803727 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803727:	55                   	push   %rbp
+  803728:	48 89 e5             	mov    %rsp,%rbp
+  80372b:	41 56                	push   %r14
+  80372d:	41 55                	push   %r13
+  80372f:	41 54                	push   %r12
+  803731:	53                   	push   %rbx
+  803732:	48 83 ec 10          	sub    $0x10,%rsp
+  803736:	89 fb                	mov    %edi,%ebx
+  803738:	41 89 f4             	mov    %esi,%r12d
+  80373b:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80373e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803742:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  803749:	00 00 00 
+  80374c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80374e:	85 c0                	test   %eax,%eax
+  803750:	78 63                	js     8037b5 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803752:	45 85 e4             	test   %r12d,%r12d
+  803755:	0f 88 80 00 00 00    	js     8037db <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80375b:	45 89 e6             	mov    %r12d,%r14d
+  80375e:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803765:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803769:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  803770:	00 00 00 
+  803773:	ff d0                	call   *%rax
+  803775:	48 89 c2             	mov    %rax,%rdx
+  803778:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80377d:	44 89 f6             	mov    %r14d,%esi
+  803780:	89 df                	mov    %ebx,%edi
+  803782:	48 b8 de 35 80 00 00 	movabs $0x8035de,%rax
+  803789:	00 00 00 
+  80378c:	ff d0                	call   *%rax
+  80378e:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803791:	45 29 f4             	sub    %r14d,%r12d
+  803794:	4d 63 f4             	movslq %r12d,%r14
+  803797:	49 39 c6             	cmp    %rax,%r14
+  80379a:	7c 1d                	jl     8037b9 <read_map+0x92>
+  80379c:	48 85 c0             	test   %rax,%rax
+  80379f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a4:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8037a8:	48 83 c4 10          	add    $0x10,%rsp
+  8037ac:	5b                   	pop    %rbx
+  8037ad:	41 5c                	pop    %r12
+  8037af:	41 5d                	pop    %r13
+  8037b1:	41 5e                	pop    %r14
+  8037b3:	5d                   	pop    %rbp
+  8037b4:	c3                   	ret
+    if (res < 0) return res;
+  8037b5:	48 98                	cltq
+  8037b7:	eb ef                	jmp    8037a8 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8037b9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8037bd:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  8037c4:	00 00 00 
+  8037c7:	ff d0                	call   *%rax
+  8037c9:	4d 63 e4             	movslq %r12d,%r12
+  8037cc:	4c 01 e0             	add    %r12,%rax
+  8037cf:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8037d3:	48 89 d8             	mov    %rbx,%rax
+  8037d6:	4c 29 f0             	sub    %r14,%rax
+  8037d9:	eb cd                	jmp    8037a8 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8037db:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037e2:	eb c4                	jmp    8037a8 <read_map+0x81>
+
+00000000008037e4 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8037e4:	55                   	push   %rbp
+  8037e5:	48 89 e5             	mov    %rsp,%rbp
+  8037e8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8037ec:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037f0:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  8037f7:	00 00 00 
+  8037fa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037fc:	85 c0                	test   %eax,%eax
+  8037fe:	78 4a                	js     80384a <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803800:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803804:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80380b:	00 00 00 
+  80380e:	8b 00                	mov    (%rax),%eax
+  803810:	39 07                	cmp    %eax,(%rdi)
+  803812:	75 38                	jne    80384c <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803814:	48 b8 6e 2d 80 00 00 	movabs $0x802d6e,%rax
+  80381b:	00 00 00 
+  80381e:	ff d0                	call   *%rax
+  803820:	85 c0                	test   %eax,%eax
+  803822:	78 26                	js     80384a <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803824:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803828:	8b 40 0c             	mov    0xc(%rax),%eax
+  80382b:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803832:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803834:	be 00 00 00 00       	mov    $0x0,%esi
+  803839:	bf 06 00 00 00       	mov    $0x6,%edi
+  80383e:	48 b8 a8 2d 80 00 00 	movabs $0x802da8,%rax
+  803845:	00 00 00 
+  803848:	ff d0                	call   *%rax
+}
+  80384a:	c9                   	leave
+  80384b:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80384c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803851:	eb f7                	jmp    80384a <fsync+0x66>
+
+0000000000803853 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803853:	55                   	push   %rbp
+  803854:	48 89 e5             	mov    %rsp,%rbp
+  803857:	41 57                	push   %r15
+  803859:	41 56                	push   %r14
+  80385b:	41 55                	push   %r13
+  80385d:	41 54                	push   %r12
+  80385f:	53                   	push   %rbx
+  803860:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803864:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80386b:	00 00 00 
+  80386e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803873:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803879:	49 bd 36 22 80 00 00 	movabs $0x802236,%r13
+  803880:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803883:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  80388a:	00 00 00 
+  80388d:	eb 0c                	jmp    80389b <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80388f:	83 c3 01             	add    $0x1,%ebx
+  803892:	49 83 c4 28          	add    $0x28,%r12
+  803896:	83 fb 20             	cmp    $0x20,%ebx
+  803899:	74 33                	je     8038ce <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80389b:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8038a0:	74 ed                	je     80388f <flushall+0x3c>
+  8038a2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8038a6:	89 df                	mov    %ebx,%edi
+  8038a8:	41 ff d5             	call   *%r13
+  8038ab:	85 c0                	test   %eax,%eax
+  8038ad:	78 e0                	js     80388f <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8038af:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8038b3:	41 8b 06             	mov    (%r14),%eax
+  8038b6:	39 07                	cmp    %eax,(%rdi)
+  8038b8:	75 d5                	jne    80388f <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8038ba:	48 b8 6e 2d 80 00 00 	movabs $0x802d6e,%rax
+  8038c1:	00 00 00 
+  8038c4:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8038c6:	85 c0                	test   %eax,%eax
+  8038c8:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8038cc:	eb c1                	jmp    80388f <flushall+0x3c>
+    }
+    return res;
+}
+  8038ce:	44 89 f8             	mov    %r15d,%eax
+  8038d1:	48 83 c4 18          	add    $0x18,%rsp
+  8038d5:	5b                   	pop    %rbx
+  8038d6:	41 5c                	pop    %r12
+  8038d8:	41 5d                	pop    %r13
+  8038da:	41 5e                	pop    %r14
+  8038dc:	41 5f                	pop    %r15
+  8038de:	5d                   	pop    %rbp
+  8038df:	c3                   	ret
+
+00000000008038e0 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8038e0:	55                   	push   %rbp
+  8038e1:	48 89 e5             	mov    %rsp,%rbp
+  8038e4:	53                   	push   %rbx
+  8038e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8038e9:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8038ec:	40 0f b6 c6          	movzbl %sil,%eax
+  8038f0:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8038f7:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8038f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8038fe:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803903:	48 b8 a8 2d 80 00 00 	movabs $0x802da8,%rax
+  80390a:	00 00 00 
+  80390d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80390f:	85 c0                	test   %eax,%eax
+  803911:	78 23                	js     803936 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803913:	ba 58 06 00 00       	mov    $0x658,%edx
+  803918:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80391f:	00 00 00 
+  803922:	48 89 df             	mov    %rbx,%rdi
+  803925:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  80392c:	00 00 00 
+  80392f:	ff d0                	call   *%rax
+    return 0;
+  803931:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803936:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80393a:	c9                   	leave
+  80393b:	c3                   	ret
+
+000000000080393c <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80393c:	55                   	push   %rbp
+  80393d:	48 89 e5             	mov    %rsp,%rbp
+  803940:	53                   	push   %rbx
+  803941:	48 83 ec 08          	sub    $0x8,%rsp
+  803945:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803948:	48 b8 43 0c 80 00 00 	movabs $0x800c43,%rax
+  80394f:	00 00 00 
+  803952:	ff d0                	call   *%rax
+  803954:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80395a:	77 35                	ja     803991 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80395c:	48 89 de             	mov    %rbx,%rsi
+  80395f:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803966:	00 00 00 
+  803969:	48 b8 81 0c 80 00 00 	movabs $0x800c81,%rax
+  803970:	00 00 00 
+  803973:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803975:	be 00 00 00 00       	mov    $0x0,%esi
+  80397a:	bf 07 00 00 00       	mov    $0x7,%edi
+  80397f:	48 b8 a8 2d 80 00 00 	movabs $0x802da8,%rax
+  803986:	00 00 00 
+  803989:	ff d0                	call   *%rax
+}
+  80398b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80398f:	c9                   	leave
+  803990:	c3                   	ret
+        return -E_BAD_PATH;
+  803991:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803996:	eb f3                	jmp    80398b <remove+0x4f>
+
+0000000000803998 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803998:	55                   	push   %rbp
+  803999:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  80399c:	48 b8 53 38 80 00 00 	movabs $0x803853,%rax
+  8039a3:	00 00 00 
+  8039a6:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8039a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ad:	bf 08 00 00 00       	mov    $0x8,%edi
+  8039b2:	48 b8 a8 2d 80 00 00 	movabs $0x802da8,%rax
+  8039b9:	00 00 00 
+  8039bc:	ff d0                	call   *%rax
+}
+  8039be:	5d                   	pop    %rbp
+  8039bf:	c3                   	ret
+
+00000000008039c0 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039c0:	55                   	push   %rbp
+  8039c1:	48 89 e5             	mov    %rsp,%rbp
+  8039c4:	41 54                	push   %r12
+  8039c6:	53                   	push   %rbx
+  8039c7:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039ca:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  8039d1:	00 00 00 
+  8039d4:	ff d0                	call   *%rax
+  8039d6:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039d9:	48 be 20 57 80 00 00 	movabs $0x805720,%rsi
+  8039e0:	00 00 00 
+  8039e3:	48 89 df             	mov    %rbx,%rdi
+  8039e6:	48 b8 81 0c 80 00 00 	movabs $0x800c81,%rax
+  8039ed:	00 00 00 
+  8039f0:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8039f2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8039f7:	41 2b 04 24          	sub    (%r12),%eax
+  8039fb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803a01:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a08:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a0b:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803a12:	00 00 00 
+  803a15:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a21:	5b                   	pop    %rbx
+  803a22:	41 5c                	pop    %r12
+  803a24:	5d                   	pop    %rbp
+  803a25:	c3                   	ret
+
+0000000000803a26 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a26:	55                   	push   %rbp
+  803a27:	48 89 e5             	mov    %rsp,%rbp
+  803a2a:	41 54                	push   %r12
+  803a2c:	53                   	push   %rbx
+  803a2d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a35:	48 89 fe             	mov    %rdi,%rsi
+  803a38:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a3d:	49 bc c0 15 80 00 00 	movabs $0x8015c0,%r12
+  803a44:	00 00 00 
+  803a47:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803a4a:	48 89 df             	mov    %rbx,%rdi
+  803a4d:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  803a54:	00 00 00 
+  803a57:	ff d0                	call   *%rax
+  803a59:	48 89 c6             	mov    %rax,%rsi
+  803a5c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a61:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a66:	41 ff d4             	call   *%r12
+}
+  803a69:	5b                   	pop    %rbx
+  803a6a:	41 5c                	pop    %r12
+  803a6c:	5d                   	pop    %rbp
+  803a6d:	c3                   	ret
+
+0000000000803a6e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803a6e:	55                   	push   %rbp
+  803a6f:	48 89 e5             	mov    %rsp,%rbp
+  803a72:	41 57                	push   %r15
+  803a74:	41 56                	push   %r14
+  803a76:	41 55                	push   %r13
+  803a78:	41 54                	push   %r12
+  803a7a:	53                   	push   %rbx
+  803a7b:	48 83 ec 18          	sub    $0x18,%rsp
+  803a7f:	49 89 fc             	mov    %rdi,%r12
+  803a82:	49 89 f5             	mov    %rsi,%r13
+  803a85:	49 89 d7             	mov    %rdx,%r15
+  803a88:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a8c:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  803a93:	00 00 00 
+  803a96:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803a98:	4d 85 ff             	test   %r15,%r15
+  803a9b:	0f 84 af 00 00 00    	je     803b50 <devpipe_write+0xe2>
+  803aa1:	48 89 c3             	mov    %rax,%rbx
+  803aa4:	4c 89 f8             	mov    %r15,%rax
+  803aa7:	4d 89 ef             	mov    %r13,%r15
+  803aaa:	4c 01 e8             	add    %r13,%rax
+  803aad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ab1:	49 bd b5 13 80 00 00 	movabs $0x8013b5,%r13
+  803ab8:	00 00 00 
+            sys_yield();
+  803abb:	49 be 52 13 80 00 00 	movabs $0x801352,%r14
+  803ac2:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ac5:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ac8:	48 63 ce             	movslq %esi,%rcx
+  803acb:	48 63 03             	movslq (%rbx),%rax
+  803ace:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803ad4:	48 39 c1             	cmp    %rax,%rcx
+  803ad7:	72 2e                	jb     803b07 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ad9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ade:	48 89 da             	mov    %rbx,%rdx
+  803ae1:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ae6:	4c 89 e7             	mov    %r12,%rdi
+  803ae9:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803aec:	85 c0                	test   %eax,%eax
+  803aee:	74 66                	je     803b56 <devpipe_write+0xe8>
+            sys_yield();
+  803af0:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803af3:	8b 73 04             	mov    0x4(%rbx),%esi
+  803af6:	48 63 ce             	movslq %esi,%rcx
+  803af9:	48 63 03             	movslq (%rbx),%rax
+  803afc:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803b02:	48 39 c1             	cmp    %rax,%rcx
+  803b05:	73 d2                	jae    803ad9 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803b07:	41 0f b6 3f          	movzbl (%r15),%edi
+  803b0b:	48 89 ca             	mov    %rcx,%rdx
+  803b0e:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b12:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803b19:	08 10 20 
+  803b1c:	48 f7 e2             	mul    %rdx
+  803b1f:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b23:	48 89 d0             	mov    %rdx,%rax
+  803b26:	48 c1 e0 09          	shl    $0x9,%rax
+  803b2a:	48 29 d0             	sub    %rdx,%rax
+  803b2d:	48 c1 e0 03          	shl    $0x3,%rax
+  803b31:	48 29 c1             	sub    %rax,%rcx
+  803b34:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803b39:	83 c6 01             	add    $0x1,%esi
+  803b3c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b3f:	49 83 c7 01          	add    $0x1,%r15
+  803b43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b47:	49 39 c7             	cmp    %rax,%r15
+  803b4a:	0f 85 75 ff ff ff    	jne    803ac5 <devpipe_write+0x57>
+    return n;
+  803b50:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b54:	eb 05                	jmp    803b5b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b5b:	48 83 c4 18          	add    $0x18,%rsp
+  803b5f:	5b                   	pop    %rbx
+  803b60:	41 5c                	pop    %r12
+  803b62:	41 5d                	pop    %r13
+  803b64:	41 5e                	pop    %r14
+  803b66:	41 5f                	pop    %r15
+  803b68:	5d                   	pop    %rbp
+  803b69:	c3                   	ret
+
+0000000000803b6a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803b6a:	55                   	push   %rbp
+  803b6b:	48 89 e5             	mov    %rsp,%rbp
+  803b6e:	41 57                	push   %r15
+  803b70:	41 56                	push   %r14
+  803b72:	41 55                	push   %r13
+  803b74:	41 54                	push   %r12
+  803b76:	53                   	push   %rbx
+  803b77:	48 83 ec 18          	sub    $0x18,%rsp
+  803b7b:	49 89 fc             	mov    %rdi,%r12
+  803b7e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b82:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b86:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  803b8d:	00 00 00 
+  803b90:	ff d0                	call   *%rax
+  803b92:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b95:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b9b:	49 bd b5 13 80 00 00 	movabs $0x8013b5,%r13
+  803ba2:	00 00 00 
+            sys_yield();
+  803ba5:	49 be 52 13 80 00 00 	movabs $0x801352,%r14
+  803bac:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803baf:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803bb4:	74 7d                	je     803c33 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803bb6:	8b 03                	mov    (%rbx),%eax
+  803bb8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803bbb:	75 26                	jne    803be3 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803bbd:	4d 85 ff             	test   %r15,%r15
+  803bc0:	75 77                	jne    803c39 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803bc2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803bc7:	48 89 da             	mov    %rbx,%rdx
+  803bca:	be 00 10 00 00       	mov    $0x1000,%esi
+  803bcf:	4c 89 e7             	mov    %r12,%rdi
+  803bd2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803bd5:	85 c0                	test   %eax,%eax
+  803bd7:	74 72                	je     803c4b <devpipe_read+0xe1>
+            sys_yield();
+  803bd9:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803bdc:	8b 03                	mov    (%rbx),%eax
+  803bde:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803be1:	74 df                	je     803bc2 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803be3:	48 63 c8             	movslq %eax,%rcx
+  803be6:	48 89 ca             	mov    %rcx,%rdx
+  803be9:	48 c1 ea 03          	shr    $0x3,%rdx
+  803bed:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803bf4:	08 10 20 
+  803bf7:	48 89 d0             	mov    %rdx,%rax
+  803bfa:	48 f7 e6             	mul    %rsi
+  803bfd:	48 c1 ea 06          	shr    $0x6,%rdx
+  803c01:	48 89 d0             	mov    %rdx,%rax
+  803c04:	48 c1 e0 09          	shl    $0x9,%rax
+  803c08:	48 29 d0             	sub    %rdx,%rax
+  803c0b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803c12:	00 
+  803c13:	48 89 c8             	mov    %rcx,%rax
+  803c16:	48 29 d0             	sub    %rdx,%rax
+  803c19:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803c1e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803c22:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803c26:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c29:	49 83 c7 01          	add    $0x1,%r15
+  803c2d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803c31:	75 83                	jne    803bb6 <devpipe_read+0x4c>
+    return n;
+  803c33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c37:	eb 03                	jmp    803c3c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803c39:	4c 89 f8             	mov    %r15,%rax
+}
+  803c3c:	48 83 c4 18          	add    $0x18,%rsp
+  803c40:	5b                   	pop    %rbx
+  803c41:	41 5c                	pop    %r12
+  803c43:	41 5d                	pop    %r13
+  803c45:	41 5e                	pop    %r14
+  803c47:	41 5f                	pop    %r15
+  803c49:	5d                   	pop    %rbp
+  803c4a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c50:	eb ea                	jmp    803c3c <devpipe_read+0xd2>
+
+0000000000803c52 <pipe>:
+pipe(int pfd[2]) {
+  803c52:	55                   	push   %rbp
+  803c53:	48 89 e5             	mov    %rsp,%rbp
+  803c56:	41 55                	push   %r13
+  803c58:	41 54                	push   %r12
+  803c5a:	53                   	push   %rbx
+  803c5b:	48 83 ec 18          	sub    $0x18,%rsp
+  803c5f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c62:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c66:	48 b8 d6 21 80 00 00 	movabs $0x8021d6,%rax
+  803c6d:	00 00 00 
+  803c70:	ff d0                	call   *%rax
+  803c72:	89 c3                	mov    %eax,%ebx
+  803c74:	85 c0                	test   %eax,%eax
+  803c76:	0f 88 a0 01 00 00    	js     803e1c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803c7c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c81:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c86:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c8f:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  803c96:	00 00 00 
+  803c99:	ff d0                	call   *%rax
+  803c9b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c9d:	85 c0                	test   %eax,%eax
+  803c9f:	0f 88 77 01 00 00    	js     803e1c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ca5:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803ca9:	48 b8 d6 21 80 00 00 	movabs $0x8021d6,%rax
+  803cb0:	00 00 00 
+  803cb3:	ff d0                	call   *%rax
+  803cb5:	89 c3                	mov    %eax,%ebx
+  803cb7:	85 c0                	test   %eax,%eax
+  803cb9:	0f 88 43 01 00 00    	js     803e02 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803cbf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cc4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ccd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd2:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  803cd9:	00 00 00 
+  803cdc:	ff d0                	call   *%rax
+  803cde:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ce0:	85 c0                	test   %eax,%eax
+  803ce2:	0f 88 1a 01 00 00    	js     803e02 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ce8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cec:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  803cf3:	00 00 00 
+  803cf6:	ff d0                	call   *%rax
+  803cf8:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803cfb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d05:	48 89 c6             	mov    %rax,%rsi
+  803d08:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d0d:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  803d14:	00 00 00 
+  803d17:	ff d0                	call   *%rax
+  803d19:	89 c3                	mov    %eax,%ebx
+  803d1b:	85 c0                	test   %eax,%eax
+  803d1d:	0f 88 c5 00 00 00    	js     803de8 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803d23:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d27:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  803d2e:	00 00 00 
+  803d31:	ff d0                	call   *%rax
+  803d33:	48 89 c1             	mov    %rax,%rcx
+  803d36:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803d3c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803d42:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d47:	4c 89 ee             	mov    %r13,%rsi
+  803d4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d4f:	48 b8 48 14 80 00 00 	movabs $0x801448,%rax
+  803d56:	00 00 00 
+  803d59:	ff d0                	call   *%rax
+  803d5b:	89 c3                	mov    %eax,%ebx
+  803d5d:	85 c0                	test   %eax,%eax
+  803d5f:	78 6e                	js     803dcf <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d61:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d66:	4c 89 ef             	mov    %r13,%rdi
+  803d69:	48 b8 83 13 80 00 00 	movabs $0x801383,%rax
+  803d70:	00 00 00 
+  803d73:	ff d0                	call   *%rax
+  803d75:	83 f8 02             	cmp    $0x2,%eax
+  803d78:	0f 85 ab 00 00 00    	jne    803e29 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803d7e:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803d85:	00 00 
+  803d87:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d8b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803d8d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d91:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d98:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d9c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d9e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803da2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803da9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803dad:	48 bb a8 21 80 00 00 	movabs $0x8021a8,%rbx
+  803db4:	00 00 00 
+  803db7:	ff d3                	call   *%rbx
+  803db9:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803dbd:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803dc1:	ff d3                	call   *%rbx
+  803dc3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803dc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803dcd:	eb 4d                	jmp    803e1c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803dcf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dd4:	4c 89 ee             	mov    %r13,%rsi
+  803dd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ddc:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  803de3:	00 00 00 
+  803de6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803de8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ded:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803df1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803df6:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  803dfd:	00 00 00 
+  803e00:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803e02:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e07:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e10:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  803e17:	00 00 00 
+  803e1a:	ff d0                	call   *%rax
+}
+  803e1c:	89 d8                	mov    %ebx,%eax
+  803e1e:	48 83 c4 18          	add    $0x18,%rsp
+  803e22:	5b                   	pop    %rbx
+  803e23:	41 5c                	pop    %r12
+  803e25:	41 5d                	pop    %r13
+  803e27:	5d                   	pop    %rbp
+  803e28:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e29:	48 b9 50 57 80 00 00 	movabs $0x805750,%rcx
+  803e30:	00 00 00 
+  803e33:	48 ba 27 57 80 00 00 	movabs $0x805727,%rdx
+  803e3a:	00 00 00 
+  803e3d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803e42:	48 bf 3c 57 80 00 00 	movabs $0x80573c,%rdi
+  803e49:	00 00 00 
+  803e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e51:	49 b8 31 44 80 00 00 	movabs $0x804431,%r8
+  803e58:	00 00 00 
+  803e5b:	41 ff d0             	call   *%r8
+
+0000000000803e5e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e5e:	55                   	push   %rbp
+  803e5f:	48 89 e5             	mov    %rsp,%rbp
+  803e62:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e66:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e6a:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  803e71:	00 00 00 
+  803e74:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e76:	85 c0                	test   %eax,%eax
+  803e78:	78 35                	js     803eaf <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803e7a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e7e:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  803e85:	00 00 00 
+  803e88:	ff d0                	call   *%rax
+  803e8a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e8d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e92:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e97:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e9b:	48 b8 b5 13 80 00 00 	movabs $0x8013b5,%rax
+  803ea2:	00 00 00 
+  803ea5:	ff d0                	call   *%rax
+  803ea7:	85 c0                	test   %eax,%eax
+  803ea9:	0f 94 c0             	sete   %al
+  803eac:	0f b6 c0             	movzbl %al,%eax
+}
+  803eaf:	c9                   	leave
+  803eb0:	c3                   	ret
+
+0000000000803eb1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803eb1:	48 89 f8             	mov    %rdi,%rax
+  803eb4:	48 c1 e8 27          	shr    $0x27,%rax
+  803eb8:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803ebf:	7f 00 00 
+  803ec2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ec6:	f6 c2 01             	test   $0x1,%dl
+  803ec9:	74 6d                	je     803f38 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ecb:	48 89 f8             	mov    %rdi,%rax
+  803ece:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ed2:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ed9:	7f 00 00 
+  803edc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ee0:	f6 c2 01             	test   $0x1,%dl
+  803ee3:	74 62                	je     803f47 <get_uvpt_entry+0x96>
+  803ee5:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803eec:	7f 00 00 
+  803eef:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ef3:	f6 c2 80             	test   $0x80,%dl
+  803ef6:	75 4f                	jne    803f47 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ef8:	48 89 f8             	mov    %rdi,%rax
+  803efb:	48 c1 e8 15          	shr    $0x15,%rax
+  803eff:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f06:	7f 00 00 
+  803f09:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f0d:	f6 c2 01             	test   $0x1,%dl
+  803f10:	74 44                	je     803f56 <get_uvpt_entry+0xa5>
+  803f12:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f19:	7f 00 00 
+  803f1c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f20:	f6 c2 80             	test   $0x80,%dl
+  803f23:	75 31                	jne    803f56 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803f25:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803f29:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f30:	7f 00 00 
+  803f33:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803f37:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f38:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803f3f:	7f 00 00 
+  803f42:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f46:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f47:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f4e:	7f 00 00 
+  803f51:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f55:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f56:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f5d:	7f 00 00 
+  803f60:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f64:	c3                   	ret
+
+0000000000803f65 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803f65:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f68:	48 89 f9             	mov    %rdi,%rcx
+  803f6b:	48 c1 e9 27          	shr    $0x27,%rcx
+  803f6f:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803f76:	7f 00 00 
+  803f79:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803f7d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f84:	f6 c1 01             	test   $0x1,%cl
+  803f87:	0f 84 b2 00 00 00    	je     80403f <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f8d:	48 89 f9             	mov    %rdi,%rcx
+  803f90:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803f94:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f9b:	7f 00 00 
+  803f9e:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803fa2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803fa9:	40 f6 c6 01          	test   $0x1,%sil
+  803fad:	0f 84 8c 00 00 00    	je     80403f <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803fb3:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fba:	7f 00 00 
+  803fbd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fc1:	a8 80                	test   $0x80,%al
+  803fc3:	75 7b                	jne    804040 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803fc5:	48 89 f9             	mov    %rdi,%rcx
+  803fc8:	48 c1 e9 15          	shr    $0x15,%rcx
+  803fcc:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fd3:	7f 00 00 
+  803fd6:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803fda:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803fe1:	40 f6 c6 01          	test   $0x1,%sil
+  803fe5:	74 58                	je     80403f <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803fe7:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fee:	7f 00 00 
+  803ff1:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ff5:	a8 80                	test   $0x80,%al
+  803ff7:	75 6c                	jne    804065 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803ff9:	48 89 f9             	mov    %rdi,%rcx
+  803ffc:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804000:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804007:	7f 00 00 
+  80400a:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80400e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804015:	40 f6 c6 01          	test   $0x1,%sil
+  804019:	74 24                	je     80403f <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80401b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804022:	7f 00 00 
+  804025:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804029:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804030:	ff ff 7f 
+  804033:	48 21 c8             	and    %rcx,%rax
+  804036:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80403c:	48 09 d0             	or     %rdx,%rax
+}
+  80403f:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804040:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804047:	7f 00 00 
+  80404a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80404e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804055:	ff ff 7f 
+  804058:	48 21 c8             	and    %rcx,%rax
+  80405b:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804061:	48 01 d0             	add    %rdx,%rax
+  804064:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804065:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80406c:	7f 00 00 
+  80406f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804073:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80407a:	ff ff 7f 
+  80407d:	48 21 c8             	and    %rcx,%rax
+  804080:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804086:	48 01 d0             	add    %rdx,%rax
+  804089:	c3                   	ret
+
+000000000080408a <get_prot>:
+
+int
+get_prot(void *va) {
+  80408a:	55                   	push   %rbp
+  80408b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80408e:	48 b8 b1 3e 80 00 00 	movabs $0x803eb1,%rax
+  804095:	00 00 00 
+  804098:	ff d0                	call   *%rax
+  80409a:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80409d:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8040a2:	89 c1                	mov    %eax,%ecx
+  8040a4:	83 c9 04             	or     $0x4,%ecx
+  8040a7:	f6 c2 01             	test   $0x1,%dl
+  8040aa:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8040ad:	89 c1                	mov    %eax,%ecx
+  8040af:	83 c9 02             	or     $0x2,%ecx
+  8040b2:	f6 c2 02             	test   $0x2,%dl
+  8040b5:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040b8:	89 c1                	mov    %eax,%ecx
+  8040ba:	83 c9 01             	or     $0x1,%ecx
+  8040bd:	48 85 d2             	test   %rdx,%rdx
+  8040c0:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040c3:	89 c1                	mov    %eax,%ecx
+  8040c5:	83 c9 40             	or     $0x40,%ecx
+  8040c8:	f6 c6 04             	test   $0x4,%dh
+  8040cb:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040ce:	5d                   	pop    %rbp
+  8040cf:	c3                   	ret
+
+00000000008040d0 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040d0:	55                   	push   %rbp
+  8040d1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040d4:	48 b8 b1 3e 80 00 00 	movabs $0x803eb1,%rax
+  8040db:	00 00 00 
+  8040de:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040e0:	48 c1 e8 06          	shr    $0x6,%rax
+  8040e4:	83 e0 01             	and    $0x1,%eax
+}
+  8040e7:	5d                   	pop    %rbp
+  8040e8:	c3                   	ret
+
+00000000008040e9 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040e9:	55                   	push   %rbp
+  8040ea:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040ed:	48 b8 b1 3e 80 00 00 	movabs $0x803eb1,%rax
+  8040f4:	00 00 00 
+  8040f7:	ff d0                	call   *%rax
+  8040f9:	83 e0 01             	and    $0x1,%eax
+}
+  8040fc:	5d                   	pop    %rbp
+  8040fd:	c3                   	ret
+
+00000000008040fe <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8040fe:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804105:	7f 00 00 
+  804108:	a8 01                	test   $0x1,%al
+  80410a:	75 06                	jne    804112 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  80410c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804111:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804112:	55                   	push   %rbp
+  804113:	48 89 e5             	mov    %rsp,%rbp
+  804116:	41 57                	push   %r15
+  804118:	41 56                	push   %r14
+  80411a:	41 55                	push   %r13
+  80411c:	41 54                	push   %r12
+  80411e:	53                   	push   %rbx
+  80411f:	48 83 ec 18          	sub    $0x18,%rsp
+  804123:	49 89 fe             	mov    %rdi,%r14
+  804126:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804129:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804130:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804131:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804138:	7f 00 00 
+  80413b:	e9 81 00 00 00       	jmp    8041c1 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804140:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804147:	49 39 dd             	cmp    %rbx,%r13
+  80414a:	74 2b                	je     804177 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80414c:	48 89 d8             	mov    %rbx,%rax
+  80414f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804153:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804157:	f6 c2 01             	test   $0x1,%dl
+  80415a:	74 e4                	je     804140 <foreach_shared_region+0x42>
+  80415c:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804160:	f6 c4 04             	test   $0x4,%ah
+  804163:	74 db                	je     804140 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804165:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80416c:	4c 89 fa             	mov    %r15,%rdx
+  80416f:	48 89 df             	mov    %rbx,%rdi
+  804172:	41 ff d6             	call   *%r14
+  804175:	eb c9                	jmp    804140 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804177:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  80417e:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804182:	74 22                	je     8041a6 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804184:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  80418b:	48 89 d8             	mov    %rbx,%rax
+  80418e:	48 c1 e8 15          	shr    $0x15,%rax
+  804192:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804199:	7f 00 00 
+  80419c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041a0:	a8 01                	test   $0x1,%al
+  8041a2:	74 d3                	je     804177 <foreach_shared_region+0x79>
+  8041a4:	eb a6                	jmp    80414c <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8041a6:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  8041ad:	40 
+  8041ae:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8041b2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041b9:	00 00 00 
+  8041bc:	48 39 c1             	cmp    %rax,%rcx
+  8041bf:	74 31                	je     8041f2 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  8041c1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041c5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041c9:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8041d0:	7f 00 00 
+  8041d3:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041d7:	a8 01                	test   $0x1,%al
+  8041d9:	74 cb                	je     8041a6 <foreach_shared_region+0xa8>
+  8041db:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041df:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8041e6:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8041ec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8041f0:	eb 92                	jmp    804184 <foreach_shared_region+0x86>
+}
+  8041f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f7:	48 83 c4 18          	add    $0x18,%rsp
+  8041fb:	5b                   	pop    %rbx
+  8041fc:	41 5c                	pop    %r12
+  8041fe:	41 5d                	pop    %r13
+  804200:	41 5e                	pop    %r14
+  804202:	41 5f                	pop    %r15
+  804204:	5d                   	pop    %rbp
+  804205:	c3                   	ret
+
+0000000000804206 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80420b:	c3                   	ret
+
+000000000080420c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80420c:	55                   	push   %rbp
+  80420d:	48 89 e5             	mov    %rsp,%rbp
+  804210:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804213:	48 be 74 57 80 00 00 	movabs $0x805774,%rsi
+  80421a:	00 00 00 
+  80421d:	48 b8 81 0c 80 00 00 	movabs $0x800c81,%rax
+  804224:	00 00 00 
+  804227:	ff d0                	call   *%rax
+    return 0;
+}
+  804229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80422e:	5d                   	pop    %rbp
+  80422f:	c3                   	ret
+
+0000000000804230 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804230:	55                   	push   %rbp
+  804231:	48 89 e5             	mov    %rsp,%rbp
+  804234:	41 57                	push   %r15
+  804236:	41 56                	push   %r14
+  804238:	41 55                	push   %r13
+  80423a:	41 54                	push   %r12
+  80423c:	53                   	push   %rbx
+  80423d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804244:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80424b:	48 85 d2             	test   %rdx,%rdx
+  80424e:	74 7a                	je     8042ca <devcons_write+0x9a>
+  804250:	49 89 d6             	mov    %rdx,%r14
+  804253:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804259:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80425e:	49 bf 0f 10 80 00 00 	movabs $0x80100f,%r15
+  804265:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804268:	4c 89 f3             	mov    %r14,%rbx
+  80426b:	48 29 f3             	sub    %rsi,%rbx
+  80426e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804273:	48 39 c3             	cmp    %rax,%rbx
+  804276:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80427a:	4c 63 eb             	movslq %ebx,%r13
+  80427d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804284:	48 01 c6             	add    %rax,%rsi
+  804287:	4c 89 ea             	mov    %r13,%rdx
+  80428a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804291:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804294:	4c 89 ee             	mov    %r13,%rsi
+  804297:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80429e:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  8042a5:	00 00 00 
+  8042a8:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8042aa:	41 01 dc             	add    %ebx,%r12d
+  8042ad:	49 63 f4             	movslq %r12d,%rsi
+  8042b0:	4c 39 f6             	cmp    %r14,%rsi
+  8042b3:	72 b3                	jb     804268 <devcons_write+0x38>
+    return res;
+  8042b5:	49 63 c4             	movslq %r12d,%rax
+}
+  8042b8:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8042bf:	5b                   	pop    %rbx
+  8042c0:	41 5c                	pop    %r12
+  8042c2:	41 5d                	pop    %r13
+  8042c4:	41 5e                	pop    %r14
+  8042c6:	41 5f                	pop    %r15
+  8042c8:	5d                   	pop    %rbp
+  8042c9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8042ca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042d0:	eb e3                	jmp    8042b5 <devcons_write+0x85>
+
+00000000008042d2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042d2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8042d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042da:	48 85 c0             	test   %rax,%rax
+  8042dd:	74 55                	je     804334 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042df:	55                   	push   %rbp
+  8042e0:	48 89 e5             	mov    %rsp,%rbp
+  8042e3:	41 55                	push   %r13
+  8042e5:	41 54                	push   %r12
+  8042e7:	53                   	push   %rbx
+  8042e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8042ec:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8042ef:	48 bb 85 12 80 00 00 	movabs $0x801285,%rbx
+  8042f6:	00 00 00 
+  8042f9:	49 bc 52 13 80 00 00 	movabs $0x801352,%r12
+  804300:	00 00 00 
+  804303:	eb 03                	jmp    804308 <devcons_read+0x36>
+  804305:	41 ff d4             	call   *%r12
+  804308:	ff d3                	call   *%rbx
+  80430a:	85 c0                	test   %eax,%eax
+  80430c:	74 f7                	je     804305 <devcons_read+0x33>
+    if (c < 0) return c;
+  80430e:	48 63 d0             	movslq %eax,%rdx
+  804311:	78 13                	js     804326 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804313:	ba 00 00 00 00       	mov    $0x0,%edx
+  804318:	83 f8 04             	cmp    $0x4,%eax
+  80431b:	74 09                	je     804326 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80431d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804321:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804326:	48 89 d0             	mov    %rdx,%rax
+  804329:	48 83 c4 08          	add    $0x8,%rsp
+  80432d:	5b                   	pop    %rbx
+  80432e:	41 5c                	pop    %r12
+  804330:	41 5d                	pop    %r13
+  804332:	5d                   	pop    %rbp
+  804333:	c3                   	ret
+  804334:	48 89 d0             	mov    %rdx,%rax
+  804337:	c3                   	ret
+
+0000000000804338 <cputchar>:
+cputchar(int ch) {
+  804338:	55                   	push   %rbp
+  804339:	48 89 e5             	mov    %rsp,%rbp
+  80433c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804340:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804344:	be 01 00 00 00       	mov    $0x1,%esi
+  804349:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80434d:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  804354:	00 00 00 
+  804357:	ff d0                	call   *%rax
+}
+  804359:	c9                   	leave
+  80435a:	c3                   	ret
+
+000000000080435b <getchar>:
+getchar(void) {
+  80435b:	55                   	push   %rbp
+  80435c:	48 89 e5             	mov    %rsp,%rbp
+  80435f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804363:	ba 01 00 00 00       	mov    $0x1,%edx
+  804368:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80436c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804371:	48 b8 19 25 80 00 00 	movabs $0x802519,%rax
+  804378:	00 00 00 
+  80437b:	ff d0                	call   *%rax
+  80437d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80437f:	85 c0                	test   %eax,%eax
+  804381:	78 06                	js     804389 <getchar+0x2e>
+  804383:	74 08                	je     80438d <getchar+0x32>
+  804385:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804389:	89 d0                	mov    %edx,%eax
+  80438b:	c9                   	leave
+  80438c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80438d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804392:	eb f5                	jmp    804389 <getchar+0x2e>
+
+0000000000804394 <iscons>:
+iscons(int fdnum) {
+  804394:	55                   	push   %rbp
+  804395:	48 89 e5             	mov    %rsp,%rbp
+  804398:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80439c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043a0:	48 b8 36 22 80 00 00 	movabs $0x802236,%rax
+  8043a7:	00 00 00 
+  8043aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8043ac:	85 c0                	test   %eax,%eax
+  8043ae:	78 18                	js     8043c8 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8043b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043b4:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8043bb:	00 00 00 
+  8043be:	8b 00                	mov    (%rax),%eax
+  8043c0:	39 02                	cmp    %eax,(%rdx)
+  8043c2:	0f 94 c0             	sete   %al
+  8043c5:	0f b6 c0             	movzbl %al,%eax
+}
+  8043c8:	c9                   	leave
+  8043c9:	c3                   	ret
+
+00000000008043ca <opencons>:
+opencons(void) {
+  8043ca:	55                   	push   %rbp
+  8043cb:	48 89 e5             	mov    %rsp,%rbp
+  8043ce:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8043d2:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8043d6:	48 b8 d6 21 80 00 00 	movabs $0x8021d6,%rax
+  8043dd:	00 00 00 
+  8043e0:	ff d0                	call   *%rax
+  8043e2:	85 c0                	test   %eax,%eax
+  8043e4:	78 49                	js     80442f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8043e6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043f0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8043f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043f9:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  804400:	00 00 00 
+  804403:	ff d0                	call   *%rax
+  804405:	85 c0                	test   %eax,%eax
+  804407:	78 26                	js     80442f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804409:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80440d:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804414:	00 00 
+  804416:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804418:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80441c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804423:	48 b8 a8 21 80 00 00 	movabs $0x8021a8,%rax
+  80442a:	00 00 00 
+  80442d:	ff d0                	call   *%rax
+}
+  80442f:	c9                   	leave
+  804430:	c3                   	ret
+
+0000000000804431 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804431:	55                   	push   %rbp
+  804432:	48 89 e5             	mov    %rsp,%rbp
+  804435:	41 56                	push   %r14
+  804437:	41 55                	push   %r13
+  804439:	41 54                	push   %r12
+  80443b:	53                   	push   %rbx
+  80443c:	48 83 ec 50          	sub    $0x50,%rsp
+  804440:	49 89 fc             	mov    %rdi,%r12
+  804443:	41 89 f5             	mov    %esi,%r13d
+  804446:	48 89 d3             	mov    %rdx,%rbx
+  804449:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80444d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  804451:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804455:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80445c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804460:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  804464:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804468:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80446c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804473:	00 00 00 
+  804476:	4c 8b 30             	mov    (%rax),%r14
+  804479:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  804480:	00 00 00 
+  804483:	ff d0                	call   *%rax
+  804485:	89 c6                	mov    %eax,%esi
+  804487:	45 89 e8             	mov    %r13d,%r8d
+  80448a:	4c 89 e1             	mov    %r12,%rcx
+  80448d:	4c 89 f2             	mov    %r14,%rdx
+  804490:	48 bf 80 57 80 00 00 	movabs $0x805780,%rdi
+  804497:	00 00 00 
+  80449a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80449f:	49 bc 09 03 80 00 00 	movabs $0x800309,%r12
+  8044a6:	00 00 00 
+  8044a9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8044ac:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8044b0:	48 89 df             	mov    %rbx,%rdi
+  8044b3:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  8044ba:	00 00 00 
+  8044bd:	ff d0                	call   *%rax
+    cprintf("\n");
+  8044bf:	48 bf d3 56 80 00 00 	movabs $0x8056d3,%rdi
+  8044c6:	00 00 00 
+  8044c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044ce:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8044d1:	cc                   	int3
+  8044d2:	eb fd                	jmp    8044d1 <_panic+0xa0>
+
+00000000008044d4 <__text_end>:
+  8044d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044db:	00 00 00 
+  8044de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e5:	00 00 00 
+  8044e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ef:	00 00 00 
+  8044f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f9:	00 00 00 
+  8044fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804503:	00 00 00 
+  804506:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450d:	00 00 00 
+  804510:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804517:	00 00 00 
+  80451a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804521:	00 00 00 
+  804524:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452b:	00 00 00 
+  80452e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804535:	00 00 00 
+  804538:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453f:	00 00 00 
+  804542:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804549:	00 00 00 
+  80454c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804553:	00 00 00 
+  804556:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455d:	00 00 00 
+  804560:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804567:	00 00 00 
+  80456a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804571:	00 00 00 
+  804574:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457b:	00 00 00 
+  80457e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804585:	00 00 00 
+  804588:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458f:	00 00 00 
+  804592:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804599:	00 00 00 
+  80459c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a3:	00 00 00 
+  8045a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ad:	00 00 00 
+  8045b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b7:	00 00 00 
+  8045ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c1:	00 00 00 
+  8045c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cb:	00 00 00 
+  8045ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d5:	00 00 00 
+  8045d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045df:	00 00 00 
+  8045e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e9:	00 00 00 
+  8045ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f3:	00 00 00 
+  8045f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fd:	00 00 00 
+  804600:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804607:	00 00 00 
+  80460a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804611:	00 00 00 
+  804614:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461b:	00 00 00 
+  80461e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804625:	00 00 00 
+  804628:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462f:	00 00 00 
+  804632:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804639:	00 00 00 
+  80463c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804643:	00 00 00 
+  804646:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464d:	00 00 00 
+  804650:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804657:	00 00 00 
+  80465a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804661:	00 00 00 
+  804664:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466b:	00 00 00 
+  80466e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804675:	00 00 00 
+  804678:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467f:	00 00 00 
+  804682:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804689:	00 00 00 
+  80468c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804693:	00 00 00 
+  804696:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469d:	00 00 00 
+  8046a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a7:	00 00 00 
+  8046aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b1:	00 00 00 
+  8046b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bb:	00 00 00 
+  8046be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c5:	00 00 00 
+  8046c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cf:	00 00 00 
+  8046d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d9:	00 00 00 
+  8046dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e3:	00 00 00 
+  8046e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ed:	00 00 00 
+  8046f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f7:	00 00 00 
+  8046fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804701:	00 00 00 
+  804704:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470b:	00 00 00 
+  80470e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804715:	00 00 00 
+  804718:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471f:	00 00 00 
+  804722:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804729:	00 00 00 
+  80472c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804733:	00 00 00 
+  804736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473d:	00 00 00 
+  804740:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804747:	00 00 00 
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804765:	00 00 00 
+  804768:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476f:	00 00 00 
+  804772:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804779:	00 00 00 
+  80477c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804783:	00 00 00 
+  804786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478d:	00 00 00 
+  804790:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804797:	00 00 00 
+  80479a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a1:	00 00 00 
+  8047a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ab:	00 00 00 
+  8047ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b5:	00 00 00 
+  8047b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bf:	00 00 00 
+  8047c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c9:	00 00 00 
+  8047cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d3:	00 00 00 
+  8047d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dd:	00 00 00 
+  8047e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e7:	00 00 00 
+  8047ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f1:	00 00 00 
+  8047f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fb:	00 00 00 
+  8047fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804805:	00 00 00 
+  804808:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480f:	00 00 00 
+  804812:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804819:	00 00 00 
+  80481c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804823:	00 00 00 
+  804826:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482d:	00 00 00 
+  804830:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804837:	00 00 00 
+  80483a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804841:	00 00 00 
+  804844:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484b:	00 00 00 
+  80484e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804855:	00 00 00 
+  804858:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485f:	00 00 00 
+  804862:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804869:	00 00 00 
+  80486c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804873:	00 00 00 
+  804876:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487d:	00 00 00 
+  804880:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804887:	00 00 00 
+  80488a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804891:	00 00 00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a5:	00 00 00 
+  8048a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048af:	00 00 00 
+  8048b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b9:	00 00 00 
+  8048bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c3:	00 00 00 
+  8048c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cd:	00 00 00 
+  8048d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d7:	00 00 00 
+  8048da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e1:	00 00 00 
+  8048e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048eb:	00 00 00 
+  8048ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f5:	00 00 00 
+  8048f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ff:	00 00 00 
+  804902:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804909:	00 00 00 
+  80490c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804913:	00 00 00 
+  804916:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491d:	00 00 00 
+  804920:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804927:	00 00 00 
+  80492a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804931:	00 00 00 
+  804934:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493b:	00 00 00 
+  80493e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804945:	00 00 00 
+  804948:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494f:	00 00 00 
+  804952:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804959:	00 00 00 
+  80495c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804963:	00 00 00 
+  804966:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496d:	00 00 00 
+  804970:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804977:	00 00 00 
+  80497a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804981:	00 00 00 
+  804984:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498b:	00 00 00 
+  80498e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804995:	00 00 00 
+  804998:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499f:	00 00 00 
+  8049a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a9:	00 00 00 
+  8049ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b3:	00 00 00 
+  8049b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bd:	00 00 00 
+  8049c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c7:	00 00 00 
+  8049ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d1:	00 00 00 
+  8049d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049db:	00 00 00 
+  8049de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e5:	00 00 00 
+  8049e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ef:	00 00 00 
+  8049f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f9:	00 00 00 
+  8049fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a03:	00 00 00 
+  804a06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0d:	00 00 00 
+  804a10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a17:	00 00 00 
+  804a1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a21:	00 00 00 
+  804a24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2b:	00 00 00 
+  804a2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a35:	00 00 00 
+  804a38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3f:	00 00 00 
+  804a42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a49:	00 00 00 
+  804a4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a53:	00 00 00 
+  804a56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5d:	00 00 00 
+  804a60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a67:	00 00 00 
+  804a6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a71:	00 00 00 
+  804a74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7b:	00 00 00 
+  804a7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a85:	00 00 00 
+  804a88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8f:	00 00 00 
+  804a92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a99:	00 00 00 
+  804a9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa3:	00 00 00 
+  804aa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aad:	00 00 00 
+  804ab0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab7:	00 00 00 
+  804aba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac1:	00 00 00 
+  804ac4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acb:	00 00 00 
+  804ace:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad5:	00 00 00 
+  804ad8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adf:	00 00 00 
+  804ae2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae9:	00 00 00 
+  804aec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af3:	00 00 00 
+  804af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afd:	00 00 00 
+  804b00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b07:	00 00 00 
+  804b0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b11:	00 00 00 
+  804b14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1b:	00 00 00 
+  804b1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b25:	00 00 00 
+  804b28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2f:	00 00 00 
+  804b32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b39:	00 00 00 
+  804b3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b43:	00 00 00 
+  804b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4d:	00 00 00 
+  804b50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b57:	00 00 00 
+  804b5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b61:	00 00 00 
+  804b64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6b:	00 00 00 
+  804b6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b75:	00 00 00 
+  804b78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7f:	00 00 00 
+  804b82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b89:	00 00 00 
+  804b8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b93:	00 00 00 
+  804b96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9d:	00 00 00 
+  804ba0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba7:	00 00 00 
+  804baa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb1:	00 00 00 
+  804bb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbb:	00 00 00 
+  804bbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc5:	00 00 00 
+  804bc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcf:	00 00 00 
+  804bd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd9:	00 00 00 
+  804bdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be3:	00 00 00 
+  804be6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bed:	00 00 00 
+  804bf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf7:	00 00 00 
+  804bfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c01:	00 00 00 
+  804c04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0b:	00 00 00 
+  804c0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c15:	00 00 00 
+  804c18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1f:	00 00 00 
+  804c22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c29:	00 00 00 
+  804c2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c33:	00 00 00 
+  804c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3d:	00 00 00 
+  804c40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c47:	00 00 00 
+  804c4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c51:	00 00 00 
+  804c54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5b:	00 00 00 
+  804c5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c65:	00 00 00 
+  804c68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6f:	00 00 00 
+  804c72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c79:	00 00 00 
+  804c7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c83:	00 00 00 
+  804c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8d:	00 00 00 
+  804c90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c97:	00 00 00 
+  804c9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca1:	00 00 00 
+  804ca4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cab:	00 00 00 
+  804cae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb5:	00 00 00 
+  804cb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbf:	00 00 00 
+  804cc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc9:	00 00 00 
+  804ccc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd3:	00 00 00 
+  804cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdd:	00 00 00 
+  804ce0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce7:	00 00 00 
+  804cea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf1:	00 00 00 
+  804cf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfb:	00 00 00 
+  804cfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d05:	00 00 00 
+  804d08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0f:	00 00 00 
+  804d12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d19:	00 00 00 
+  804d1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d23:	00 00 00 
+  804d26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2d:	00 00 00 
+  804d30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d37:	00 00 00 
+  804d3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d41:	00 00 00 
+  804d44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4b:	00 00 00 
+  804d4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d55:	00 00 00 
+  804d58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5f:	00 00 00 
+  804d62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d69:	00 00 00 
+  804d6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d73:	00 00 00 
+  804d76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7d:	00 00 00 
+  804d80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d87:	00 00 00 
+  804d8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d91:	00 00 00 
+  804d94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9b:	00 00 00 
+  804d9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da5:	00 00 00 
+  804da8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daf:	00 00 00 
+  804db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db9:	00 00 00 
+  804dbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc3:	00 00 00 
+  804dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcd:	00 00 00 
+  804dd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd7:	00 00 00 
+  804dda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de1:	00 00 00 
+  804de4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804deb:	00 00 00 
+  804dee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df5:	00 00 00 
+  804df8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dff:	00 00 00 
+  804e02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e09:	00 00 00 
+  804e0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e13:	00 00 00 
+  804e16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1d:	00 00 00 
+  804e20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e27:	00 00 00 
+  804e2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e31:	00 00 00 
+  804e34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3b:	00 00 00 
+  804e3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e45:	00 00 00 
+  804e48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4f:	00 00 00 
+  804e52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e59:	00 00 00 
+  804e5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e63:	00 00 00 
+  804e66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6d:	00 00 00 
+  804e70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e77:	00 00 00 
+  804e7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e81:	00 00 00 
+  804e84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8b:	00 00 00 
+  804e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e95:	00 00 00 
+  804e98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9f:	00 00 00 
+  804ea2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea9:	00 00 00 
+  804eac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb3:	00 00 00 
+  804eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebd:	00 00 00 
+  804ec0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec7:	00 00 00 
+  804eca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed1:	00 00 00 
+  804ed4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edb:	00 00 00 
+  804ede:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee5:	00 00 00 
+  804ee8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eef:	00 00 00 
+  804ef2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef9:	00 00 00 
+  804efc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f03:	00 00 00 
+  804f06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0d:	00 00 00 
+  804f10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f17:	00 00 00 
+  804f1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f21:	00 00 00 
+  804f24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2b:	00 00 00 
+  804f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f35:	00 00 00 
+  804f38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3f:	00 00 00 
+  804f42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f49:	00 00 00 
+  804f4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f53:	00 00 00 
+  804f56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5d:	00 00 00 
+  804f60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f67:	00 00 00 
+  804f6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f71:	00 00 00 
+  804f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7b:	00 00 00 
+  804f7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f85:	00 00 00 
+  804f88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8f:	00 00 00 
+  804f92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f99:	00 00 00 
+  804f9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa3:	00 00 00 
+  804fa6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fad:	00 00 00 
+  804fb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb7:	00 00 00 
+  804fba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc1:	00 00 00 
+  804fc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcb:	00 00 00 
+  804fce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd5:	00 00 00 
+  804fd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdf:	00 00 00 
+  804fe2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe9:	00 00 00 
+  804fec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff3:	00 00 00 
+  804ff6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffd:	00 00 00 
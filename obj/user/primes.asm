@@ -0,0 +1,8227 @@
+
+obj/user/primes:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 68 01 00 00       	call   80018b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, id, p;
+    envid_t envid;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    p = ipc_recv(&envid, 0, 0, 0);
+  800036:	49 bf a3 1f 80 00 00 	movabs $0x801fa3,%r15
+  80003d:	00 00 00 
+    cprintf("%d ", p);
+  800040:	49 be a7 03 80 00 00 	movabs $0x8003a7,%r14
+  800047:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((id = fork()) < 0)
+  80004a:	49 bd 95 1e 80 00 00 	movabs $0x801e95,%r13
+  800051:	00 00 00 
+    p = ipc_recv(&envid, 0, 0, 0);
+  800054:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80005e:	be 00 00 00 00       	mov    $0x0,%esi
+  800063:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800067:	41 ff d7             	call   *%r15
+  80006a:	89 c3                	mov    %eax,%ebx
+    cprintf("%d ", p);
+  80006c:	89 c6                	mov    %eax,%esi
+  80006e:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800075:	00 00 00 
+  800078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007d:	41 ff d6             	call   *%r14
+    if ((id = fork()) < 0)
+  800080:	41 ff d5             	call   *%r13
+  800083:	41 89 c4             	mov    %eax,%r12d
+  800086:	85 c0                	test   %eax,%eax
+  800088:	78 4d                	js     8000d7 <primeproc+0xb2>
+        panic("fork: %i", id);
+    if (id == 0)
+  80008a:	74 c8                	je     800054 <primeproc+0x2f>
+        goto top;
+
+    /* Filter out multiples of our prime */
+    while (1) {
+        i = ipc_recv(&envid, 0, 0, 0);
+  80008c:	49 bd a3 1f 80 00 00 	movabs $0x801fa3,%r13
+  800093:	00 00 00 
+        if (i % p)
+            ipc_send(id, i, 0, 0, 0);
+  800096:	49 be 53 21 80 00 00 	movabs $0x802153,%r14
+  80009d:	00 00 00 
+        i = ipc_recv(&envid, 0, 0, 0);
+  8000a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8000af:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  8000b3:	41 ff d5             	call   *%r13
+  8000b6:	89 c6                	mov    %eax,%esi
+        if (i % p)
+  8000b8:	99                   	cltd
+  8000b9:	f7 fb                	idiv   %ebx
+  8000bb:	85 d2                	test   %edx,%edx
+  8000bd:	74 e1                	je     8000a0 <primeproc+0x7b>
+            ipc_send(id, i, 0, 0, 0);
+  8000bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000cf:	44 89 e7             	mov    %r12d,%edi
+  8000d2:	41 ff d6             	call   *%r14
+  8000d5:	eb c9                	jmp    8000a0 <primeproc+0x7b>
+        panic("fork: %i", id);
+  8000d7:	89 c1                	mov    %eax,%ecx
+  8000d9:	48 ba 04 50 80 00 00 	movabs $0x805004,%rdx
+  8000e0:	00 00 00 
+  8000e3:	be 19 00 00 00       	mov    $0x19,%esi
+  8000e8:	48 bf 0d 50 80 00 00 	movabs $0x80500d,%rdi
+  8000ef:	00 00 00 
+  8000f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f7:	49 b8 57 02 80 00 00 	movabs $0x800257,%r8
+  8000fe:	00 00 00 
+  800101:	41 ff d0             	call   *%r8
+
+0000000000800104 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800104:	55                   	push   %rbp
+  800105:	48 89 e5             	mov    %rsp,%rbp
+  800108:	41 55                	push   %r13
+  80010a:	41 54                	push   %r12
+  80010c:	53                   	push   %rbx
+  80010d:	48 83 ec 08          	sub    $0x8,%rsp
+    int id;
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  800111:	48 b8 95 1e 80 00 00 	movabs $0x801e95,%rax
+  800118:	00 00 00 
+  80011b:	ff d0                	call   *%rax
+  80011d:	41 89 c4             	mov    %eax,%r12d
+  800120:	85 c0                	test   %eax,%eax
+  800122:	78 2e                	js     800152 <umain+0x4e>
+        panic("fork: %i", id);
+    if (id == 0)
+        primeproc();
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+  800124:	bb 02 00 00 00       	mov    $0x2,%ebx
+        ipc_send(id, i, 0, 0, 0);
+  800129:	49 bd 53 21 80 00 00 	movabs $0x802153,%r13
+  800130:	00 00 00 
+    if (id == 0)
+  800133:	74 4a                	je     80017f <umain+0x7b>
+        ipc_send(id, i, 0, 0, 0);
+  800135:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800140:	ba 00 00 00 00       	mov    $0x0,%edx
+  800145:	89 de                	mov    %ebx,%esi
+  800147:	44 89 e7             	mov    %r12d,%edi
+  80014a:	41 ff d5             	call   *%r13
+    for (int i = 2;; i++)
+  80014d:	83 c3 01             	add    $0x1,%ebx
+  800150:	eb e3                	jmp    800135 <umain+0x31>
+        panic("fork: %i", id);
+  800152:	89 c1                	mov    %eax,%ecx
+  800154:	48 ba 04 50 80 00 00 	movabs $0x805004,%rdx
+  80015b:	00 00 00 
+  80015e:	be 2b 00 00 00       	mov    $0x2b,%esi
+  800163:	48 bf 0d 50 80 00 00 	movabs $0x80500d,%rdi
+  80016a:	00 00 00 
+  80016d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800172:	49 b8 57 02 80 00 00 	movabs $0x800257,%r8
+  800179:	00 00 00 
+  80017c:	41 ff d0             	call   *%r8
+        primeproc();
+  80017f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+
+000000000080018b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80018b:	55                   	push   %rbp
+  80018c:	48 89 e5             	mov    %rsp,%rbp
+  80018f:	41 56                	push   %r14
+  800191:	41 55                	push   %r13
+  800193:	41 54                	push   %r12
+  800195:	53                   	push   %rbx
+  800196:	41 89 fd             	mov    %edi,%r13d
+  800199:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80019c:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8001a3:	00 00 00 
+  8001a6:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8001ad:	00 00 00 
+  8001b0:	48 39 c2             	cmp    %rax,%rdx
+  8001b3:	73 17                	jae    8001cc <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001b5:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001b8:	49 89 c4             	mov    %rax,%r12
+  8001bb:	48 83 c3 08          	add    $0x8,%rbx
+  8001bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c4:	ff 53 f8             	call   *-0x8(%rbx)
+  8001c7:	4c 39 e3             	cmp    %r12,%rbx
+  8001ca:	72 ef                	jb     8001bb <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8001cc:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+  8001d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001dd:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8001e4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001eb:	00 00 00 
+  8001ee:	48 01 d0             	add    %rdx,%rax
+  8001f1:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8001f8:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001fb:	45 85 ed             	test   %r13d,%r13d
+  8001fe:	7e 0d                	jle    80020d <libmain+0x82>
+  800200:	49 8b 06             	mov    (%r14),%rax
+  800203:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80020a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80020d:	4c 89 f6             	mov    %r14,%rsi
+  800210:	44 89 ef             	mov    %r13d,%edi
+  800213:	48 b8 04 01 80 00 00 	movabs $0x800104,%rax
+  80021a:	00 00 00 
+  80021d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80021f:	48 b8 34 02 80 00 00 	movabs $0x800234,%rax
+  800226:	00 00 00 
+  800229:	ff d0                	call   *%rax
+#endif
+}
+  80022b:	5b                   	pop    %rbx
+  80022c:	41 5c                	pop    %r12
+  80022e:	41 5d                	pop    %r13
+  800230:	41 5e                	pop    %r14
+  800232:	5d                   	pop    %rbp
+  800233:	c3                   	ret
+
+0000000000800234 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800234:	55                   	push   %rbp
+  800235:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800238:	48 b8 6c 24 80 00 00 	movabs $0x80246c,%rax
+  80023f:	00 00 00 
+  800242:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800244:	bf 00 00 00 00       	mov    $0x0,%edi
+  800249:	48 b8 54 13 80 00 00 	movabs $0x801354,%rax
+  800250:	00 00 00 
+  800253:	ff d0                	call   *%rax
+}
+  800255:	5d                   	pop    %rbp
+  800256:	c3                   	ret
+
+0000000000800257 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800257:	55                   	push   %rbp
+  800258:	48 89 e5             	mov    %rsp,%rbp
+  80025b:	41 56                	push   %r14
+  80025d:	41 55                	push   %r13
+  80025f:	41 54                	push   %r12
+  800261:	53                   	push   %rbx
+  800262:	48 83 ec 50          	sub    $0x50,%rsp
+  800266:	49 89 fc             	mov    %rdi,%r12
+  800269:	41 89 f5             	mov    %esi,%r13d
+  80026c:	48 89 d3             	mov    %rdx,%rbx
+  80026f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800273:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800277:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80027b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800282:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800286:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80028a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80028e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800292:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800299:	00 00 00 
+  80029c:	4c 8b 30             	mov    (%rax),%r14
+  80029f:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+  8002ab:	89 c6                	mov    %eax,%esi
+  8002ad:	45 89 e8             	mov    %r13d,%r8d
+  8002b0:	4c 89 e1             	mov    %r12,%rcx
+  8002b3:	4c 89 f2             	mov    %r14,%rdx
+  8002b6:	48 bf 28 50 80 00 00 	movabs $0x805028,%rdi
+  8002bd:	00 00 00 
+  8002c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c5:	49 bc a7 03 80 00 00 	movabs $0x8003a7,%r12
+  8002cc:	00 00 00 
+  8002cf:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002d2:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002d6:	48 89 df             	mov    %rbx,%rdi
+  8002d9:	48 b8 43 03 80 00 00 	movabs $0x800343,%rax
+  8002e0:	00 00 00 
+  8002e3:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002e5:	48 bf b3 56 80 00 00 	movabs $0x8056b3,%rdi
+  8002ec:	00 00 00 
+  8002ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f4:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002f7:	cc                   	int3
+  8002f8:	eb fd                	jmp    8002f7 <_panic+0xa0>
+
+00000000008002fa <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002fa:	55                   	push   %rbp
+  8002fb:	48 89 e5             	mov    %rsp,%rbp
+  8002fe:	53                   	push   %rbx
+  8002ff:	48 83 ec 08          	sub    $0x8,%rsp
+  800303:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800306:	8b 06                	mov    (%rsi),%eax
+  800308:	8d 50 01             	lea    0x1(%rax),%edx
+  80030b:	89 16                	mov    %edx,(%rsi)
+  80030d:	48 98                	cltq
+  80030f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800314:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80031a:	74 0a                	je     800326 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80031c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800320:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800324:	c9                   	leave
+  800325:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800326:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80032a:	be ff 00 00 00       	mov    $0xff,%esi
+  80032f:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  800336:	00 00 00 
+  800339:	ff d0                	call   *%rax
+        state->offset = 0;
+  80033b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800341:	eb d9                	jmp    80031c <putch+0x22>
+
+0000000000800343 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800343:	55                   	push   %rbp
+  800344:	48 89 e5             	mov    %rsp,%rbp
+  800347:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80034e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800351:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800358:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800365:	48 89 f1             	mov    %rsi,%rcx
+  800368:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80036f:	48 bf fa 02 80 00 00 	movabs $0x8002fa,%rdi
+  800376:	00 00 00 
+  800379:	48 b8 f7 04 80 00 00 	movabs $0x8004f7,%rax
+  800380:	00 00 00 
+  800383:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800385:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80038c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800393:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  80039a:	00 00 00 
+  80039d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80039f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003a5:	c9                   	leave
+  8003a6:	c3                   	ret
+
+00000000008003a7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003a7:	55                   	push   %rbp
+  8003a8:	48 89 e5             	mov    %rsp,%rbp
+  8003ab:	48 83 ec 50          	sub    $0x50,%rsp
+  8003af:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003b3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003b7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003bb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003bf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003c3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003ca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003d6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003da:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003de:	48 b8 43 03 80 00 00 	movabs $0x800343,%rax
+  8003e5:	00 00 00 
+  8003e8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003ea:	c9                   	leave
+  8003eb:	c3                   	ret
+
+00000000008003ec <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003ec:	55                   	push   %rbp
+  8003ed:	48 89 e5             	mov    %rsp,%rbp
+  8003f0:	41 57                	push   %r15
+  8003f2:	41 56                	push   %r14
+  8003f4:	41 55                	push   %r13
+  8003f6:	41 54                	push   %r12
+  8003f8:	53                   	push   %rbx
+  8003f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8003fd:	49 89 fc             	mov    %rdi,%r12
+  800400:	49 89 f5             	mov    %rsi,%r13
+  800403:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800407:	8b 45 10             	mov    0x10(%rbp),%eax
+  80040a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80040d:	41 89 cf             	mov    %ecx,%r15d
+  800410:	4c 39 fa             	cmp    %r15,%rdx
+  800413:	73 5b                	jae    800470 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800415:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800419:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80041d:	85 db                	test   %ebx,%ebx
+  80041f:	7e 0e                	jle    80042f <print_num+0x43>
+            putch(padc, put_arg);
+  800421:	4c 89 ee             	mov    %r13,%rsi
+  800424:	44 89 f7             	mov    %r14d,%edi
+  800427:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80042a:	83 eb 01             	sub    $0x1,%ebx
+  80042d:	75 f2                	jne    800421 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80042f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800433:	48 b9 5c 50 80 00 00 	movabs $0x80505c,%rcx
+  80043a:	00 00 00 
+  80043d:	48 b8 4b 50 80 00 00 	movabs $0x80504b,%rax
+  800444:	00 00 00 
+  800447:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80044b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80044f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800454:	49 f7 f7             	div    %r15
+  800457:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80045b:	4c 89 ee             	mov    %r13,%rsi
+  80045e:	41 ff d4             	call   *%r12
+}
+  800461:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800465:	5b                   	pop    %rbx
+  800466:	41 5c                	pop    %r12
+  800468:	41 5d                	pop    %r13
+  80046a:	41 5e                	pop    %r14
+  80046c:	41 5f                	pop    %r15
+  80046e:	5d                   	pop    %rbp
+  80046f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800470:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800474:	ba 00 00 00 00       	mov    $0x0,%edx
+  800479:	49 f7 f7             	div    %r15
+  80047c:	48 83 ec 08          	sub    $0x8,%rsp
+  800480:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800484:	52                   	push   %rdx
+  800485:	45 0f be c9          	movsbl %r9b,%r9d
+  800489:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80048d:	48 89 c2             	mov    %rax,%rdx
+  800490:	48 b8 ec 03 80 00 00 	movabs $0x8003ec,%rax
+  800497:	00 00 00 
+  80049a:	ff d0                	call   *%rax
+  80049c:	48 83 c4 10          	add    $0x10,%rsp
+  8004a0:	eb 8d                	jmp    80042f <print_num+0x43>
+
+00000000008004a2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004a2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004a6:	48 8b 06             	mov    (%rsi),%rax
+  8004a9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004ad:	73 0a                	jae    8004b9 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004af:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004b3:	48 89 16             	mov    %rdx,(%rsi)
+  8004b6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004b9:	c3                   	ret
+
+00000000008004ba <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004ba:	55                   	push   %rbp
+  8004bb:	48 89 e5             	mov    %rsp,%rbp
+  8004be:	48 83 ec 50          	sub    $0x50,%rsp
+  8004c2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004c6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004ca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004ce:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004dd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004e5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004e9:	48 b8 f7 04 80 00 00 	movabs $0x8004f7,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+}
+  8004f5:	c9                   	leave
+  8004f6:	c3                   	ret
+
+00000000008004f7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004f7:	55                   	push   %rbp
+  8004f8:	48 89 e5             	mov    %rsp,%rbp
+  8004fb:	41 57                	push   %r15
+  8004fd:	41 56                	push   %r14
+  8004ff:	41 55                	push   %r13
+  800501:	41 54                	push   %r12
+  800503:	53                   	push   %rbx
+  800504:	48 83 ec 38          	sub    $0x38,%rsp
+  800508:	49 89 fe             	mov    %rdi,%r14
+  80050b:	49 89 f5             	mov    %rsi,%r13
+  80050e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800511:	48 8b 01             	mov    (%rcx),%rax
+  800514:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800518:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80051c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800520:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800524:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800528:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80052c:	0f b6 3b             	movzbl (%rbx),%edi
+  80052f:	40 80 ff 25          	cmp    $0x25,%dil
+  800533:	74 18                	je     80054d <vprintfmt+0x56>
+            if (!ch) return;
+  800535:	40 84 ff             	test   %dil,%dil
+  800538:	0f 84 04 07 00 00    	je     800c42 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80053e:	40 0f b6 ff          	movzbl %dil,%edi
+  800542:	4c 89 ee             	mov    %r13,%rsi
+  800545:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800548:	4c 89 e3             	mov    %r12,%rbx
+  80054b:	eb db                	jmp    800528 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80054d:	be 00 00 00 00       	mov    $0x0,%esi
+  800552:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800556:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80055b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800561:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800568:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80056c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800571:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800576:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800579:	83 e8 23             	sub    $0x23,%eax
+  80057c:	3c 57                	cmp    $0x57,%al
+  80057e:	0f 87 a4 06 00 00    	ja     800c28 <vprintfmt+0x731>
+  800584:	0f b6 c0             	movzbl %al,%eax
+  800587:	48 b9 e0 51 80 00 00 	movabs $0x8051e0,%rcx
+  80058e:	00 00 00 
+  800591:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800594:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800597:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80059b:	eb cf                	jmp    80056c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80059d:	49 89 dc             	mov    %rbx,%r12
+  8005a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8005a5:	eb c5                	jmp    80056c <vprintfmt+0x75>
+            padc = ch;
+  8005a7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005ab:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005ae:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005b1:	eb b9                	jmp    80056c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b9:	77 24                	ja     8005df <vprintfmt+0xe8>
+  8005bb:	89 c1                	mov    %eax,%ecx
+  8005bd:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005c1:	83 c0 08             	add    $0x8,%eax
+  8005c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005c7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005ca:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005cd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005d1:	79 99                	jns    80056c <vprintfmt+0x75>
+                width = precision;
+  8005d3:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005d7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005dd:	eb 8d                	jmp    80056c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005df:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005e3:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005eb:	eb da                	jmp    8005c7 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005ed:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005f2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005f6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005fc:	3c 39                	cmp    $0x39,%al
+  8005fe:	77 1c                	ja     80061c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800600:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800604:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800608:	0f b6 c0             	movzbl %al,%eax
+  80060b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800610:	0f b6 03             	movzbl (%rbx),%eax
+  800613:	3c 39                	cmp    $0x39,%al
+  800615:	76 e9                	jbe    800600 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800617:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80061a:	eb b1                	jmp    8005cd <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80061c:	49 89 dc             	mov    %rbx,%r12
+  80061f:	eb ac                	jmp    8005cd <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800621:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800624:	85 c9                	test   %ecx,%ecx
+  800626:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062b:	0f 49 c1             	cmovns %ecx,%eax
+  80062e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800631:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800634:	e9 33 ff ff ff       	jmp    80056c <vprintfmt+0x75>
+            lflag++;
+  800639:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80063c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80063f:	e9 28 ff ff ff       	jmp    80056c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800644:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800647:	83 f8 2f             	cmp    $0x2f,%eax
+  80064a:	77 19                	ja     800665 <vprintfmt+0x16e>
+  80064c:	89 c2                	mov    %eax,%edx
+  80064e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800652:	83 c0 08             	add    $0x8,%eax
+  800655:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800658:	8b 3a                	mov    (%rdx),%edi
+  80065a:	4c 89 ee             	mov    %r13,%rsi
+  80065d:	41 ff d6             	call   *%r14
+            break;
+  800660:	e9 c3 fe ff ff       	jmp    800528 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800665:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800669:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80066d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800671:	eb e5                	jmp    800658 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800673:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800676:	83 f8 2f             	cmp    $0x2f,%eax
+  800679:	77 5a                	ja     8006d5 <vprintfmt+0x1de>
+  80067b:	89 c2                	mov    %eax,%edx
+  80067d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800681:	83 c0 08             	add    $0x8,%eax
+  800684:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800687:	8b 02                	mov    (%rdx),%eax
+  800689:	89 c1                	mov    %eax,%ecx
+  80068b:	f7 d9                	neg    %ecx
+  80068d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800690:	83 f9 13             	cmp    $0x13,%ecx
+  800693:	7f 4e                	jg     8006e3 <vprintfmt+0x1ec>
+  800695:	48 63 c1             	movslq %ecx,%rax
+  800698:	48 ba a0 54 80 00 00 	movabs $0x8054a0,%rdx
+  80069f:	00 00 00 
+  8006a2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006a6:	48 85 c0             	test   %rax,%rax
+  8006a9:	74 38                	je     8006e3 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006ab:	48 89 c1             	mov    %rax,%rcx
+  8006ae:	48 ba 19 57 80 00 00 	movabs $0x805719,%rdx
+  8006b5:	00 00 00 
+  8006b8:	4c 89 ee             	mov    %r13,%rsi
+  8006bb:	4c 89 f7             	mov    %r14,%rdi
+  8006be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c3:	49 b8 ba 04 80 00 00 	movabs $0x8004ba,%r8
+  8006ca:	00 00 00 
+  8006cd:	41 ff d0             	call   *%r8
+  8006d0:	e9 53 fe ff ff       	jmp    800528 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e1:	eb a4                	jmp    800687 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006e3:	48 ba 74 50 80 00 00 	movabs $0x805074,%rdx
+  8006ea:	00 00 00 
+  8006ed:	4c 89 ee             	mov    %r13,%rsi
+  8006f0:	4c 89 f7             	mov    %r14,%rdi
+  8006f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f8:	49 b8 ba 04 80 00 00 	movabs $0x8004ba,%r8
+  8006ff:	00 00 00 
+  800702:	41 ff d0             	call   *%r8
+  800705:	e9 1e fe ff ff       	jmp    800528 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80070a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070d:	83 f8 2f             	cmp    $0x2f,%eax
+  800710:	77 36                	ja     800748 <vprintfmt+0x251>
+  800712:	89 c2                	mov    %eax,%edx
+  800714:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800718:	83 c0 08             	add    $0x8,%eax
+  80071b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071e:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800721:	48 85 f6             	test   %rsi,%rsi
+  800724:	48 b8 6d 50 80 00 00 	movabs $0x80506d,%rax
+  80072b:	00 00 00 
+  80072e:	48 0f 45 c6          	cmovne %rsi,%rax
+  800732:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800736:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80073a:	7e 06                	jle    800742 <vprintfmt+0x24b>
+  80073c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800740:	75 14                	jne    800756 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800742:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800746:	eb 5b                	jmp    8007a3 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800748:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800750:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800754:	eb c8                	jmp    80071e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800756:	49 63 f7             	movslq %r15d,%rsi
+  800759:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80075d:	48 b8 fc 0c 80 00 00 	movabs $0x800cfc,%rax
+  800764:	00 00 00 
+  800767:	ff d0                	call   *%rax
+  800769:	48 89 c2             	mov    %rax,%rdx
+  80076c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80076f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800771:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800774:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800777:	85 c0                	test   %eax,%eax
+  800779:	7e c7                	jle    800742 <vprintfmt+0x24b>
+  80077b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800780:	4c 89 ee             	mov    %r13,%rsi
+  800783:	44 89 e7             	mov    %r12d,%edi
+  800786:	41 ff d6             	call   *%r14
+  800789:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80078d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800790:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800793:	75 eb                	jne    800780 <vprintfmt+0x289>
+  800795:	eb ab                	jmp    800742 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800797:	0f b6 f8             	movzbl %al,%edi
+  80079a:	4c 89 ee             	mov    %r13,%rsi
+  80079d:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8007a0:	4c 89 e2             	mov    %r12,%rdx
+  8007a3:	45 85 ff             	test   %r15d,%r15d
+  8007a6:	78 06                	js     8007ae <vprintfmt+0x2b7>
+  8007a8:	41 83 ef 01          	sub    $0x1,%r15d
+  8007ac:	78 23                	js     8007d1 <vprintfmt+0x2da>
+  8007ae:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8007b2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007b8:	84 c0                	test   %al,%al
+  8007ba:	74 15                	je     8007d1 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007bc:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007c0:	74 d5                	je     800797 <vprintfmt+0x2a0>
+  8007c2:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007c5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007ca:	80 fa 5e             	cmp    $0x5e,%dl
+  8007cd:	77 cb                	ja     80079a <vprintfmt+0x2a3>
+  8007cf:	eb c6                	jmp    800797 <vprintfmt+0x2a0>
+  8007d1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007d4:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8007d7:	01 f0                	add    %esi,%eax
+  8007d9:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8007db:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007df:	85 c0                	test   %eax,%eax
+  8007e1:	0f 8e 41 fd ff ff    	jle    800528 <vprintfmt+0x31>
+  8007e7:	4c 89 ee             	mov    %r13,%rsi
+  8007ea:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007ef:	41 ff d6             	call   *%r14
+  8007f2:	41 83 ec 01          	sub    $0x1,%r12d
+  8007f6:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007fa:	75 eb                	jne    8007e7 <vprintfmt+0x2f0>
+  8007fc:	e9 27 fd ff ff       	jmp    800528 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800801:	40 84 f6             	test   %sil,%sil
+  800804:	75 26                	jne    80082c <vprintfmt+0x335>
+    switch (lflag) {
+  800806:	85 d2                	test   %edx,%edx
+  800808:	74 59                	je     800863 <vprintfmt+0x36c>
+  80080a:	83 fa 01             	cmp    $0x1,%edx
+  80080d:	74 7b                	je     80088a <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80080f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800812:	83 f8 2f             	cmp    $0x2f,%eax
+  800815:	0f 87 96 00 00 00    	ja     8008b1 <vprintfmt+0x3ba>
+  80081b:	89 c2                	mov    %eax,%edx
+  80081d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800821:	83 c0 08             	add    $0x8,%eax
+  800824:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800827:	4c 8b 22             	mov    (%rdx),%r12
+  80082a:	eb 17                	jmp    800843 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80082c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082f:	83 f8 2f             	cmp    $0x2f,%eax
+  800832:	77 21                	ja     800855 <vprintfmt+0x35e>
+  800834:	89 c2                	mov    %eax,%edx
+  800836:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083a:	83 c0 08             	add    $0x8,%eax
+  80083d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800840:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800843:	4d 85 e4             	test   %r12,%r12
+  800846:	78 7a                	js     8008c2 <vprintfmt+0x3cb>
+            num = i;
+  800848:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80084b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800850:	e9 b5 02 00 00       	jmp    800b0a <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800855:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800859:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800861:	eb dd                	jmp    800840 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800863:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800866:	83 f8 2f             	cmp    $0x2f,%eax
+  800869:	77 11                	ja     80087c <vprintfmt+0x385>
+  80086b:	89 c2                	mov    %eax,%edx
+  80086d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800871:	83 c0 08             	add    $0x8,%eax
+  800874:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800877:	4c 63 22             	movslq (%rdx),%r12
+  80087a:	eb c7                	jmp    800843 <vprintfmt+0x34c>
+  80087c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800880:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800884:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800888:	eb ed                	jmp    800877 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80088a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088d:	83 f8 2f             	cmp    $0x2f,%eax
+  800890:	77 11                	ja     8008a3 <vprintfmt+0x3ac>
+  800892:	89 c2                	mov    %eax,%edx
+  800894:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800898:	83 c0 08             	add    $0x8,%eax
+  80089b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089e:	4c 8b 22             	mov    (%rdx),%r12
+  8008a1:	eb a0                	jmp    800843 <vprintfmt+0x34c>
+  8008a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008af:	eb ed                	jmp    80089e <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8008b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bd:	e9 65 ff ff ff       	jmp    800827 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8008c2:	4c 89 ee             	mov    %r13,%rsi
+  8008c5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008ca:	41 ff d6             	call   *%r14
+                i = -i;
+  8008cd:	49 f7 dc             	neg    %r12
+  8008d0:	e9 73 ff ff ff       	jmp    800848 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8008d5:	40 84 f6             	test   %sil,%sil
+  8008d8:	75 32                	jne    80090c <vprintfmt+0x415>
+    switch (lflag) {
+  8008da:	85 d2                	test   %edx,%edx
+  8008dc:	74 5d                	je     80093b <vprintfmt+0x444>
+  8008de:	83 fa 01             	cmp    $0x1,%edx
+  8008e1:	0f 84 82 00 00 00    	je     800969 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8008e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ed:	0f 87 a5 00 00 00    	ja     800998 <vprintfmt+0x4a1>
+  8008f3:	89 c2                	mov    %eax,%edx
+  8008f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f9:	83 c0 08             	add    $0x8,%eax
+  8008fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ff:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800902:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800907:	e9 fe 01 00 00       	jmp    800b0a <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80090c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090f:	83 f8 2f             	cmp    $0x2f,%eax
+  800912:	77 19                	ja     80092d <vprintfmt+0x436>
+  800914:	89 c2                	mov    %eax,%edx
+  800916:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091a:	83 c0 08             	add    $0x8,%eax
+  80091d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800920:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800923:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800928:	e9 dd 01 00 00       	jmp    800b0a <vprintfmt+0x613>
+  80092d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800931:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800935:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800939:	eb e5                	jmp    800920 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80093b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093e:	83 f8 2f             	cmp    $0x2f,%eax
+  800941:	77 18                	ja     80095b <vprintfmt+0x464>
+  800943:	89 c2                	mov    %eax,%edx
+  800945:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800949:	83 c0 08             	add    $0x8,%eax
+  80094c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800951:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800956:	e9 af 01 00 00       	jmp    800b0a <vprintfmt+0x613>
+  80095b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800963:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800967:	eb e6                	jmp    80094f <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800969:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096c:	83 f8 2f             	cmp    $0x2f,%eax
+  80096f:	77 19                	ja     80098a <vprintfmt+0x493>
+  800971:	89 c2                	mov    %eax,%edx
+  800973:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800977:	83 c0 08             	add    $0x8,%eax
+  80097a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800980:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800985:	e9 80 01 00 00       	jmp    800b0a <vprintfmt+0x613>
+  80098a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800992:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800996:	eb e5                	jmp    80097d <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800998:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a4:	e9 56 ff ff ff       	jmp    8008ff <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a9:	40 84 f6             	test   %sil,%sil
+  8009ac:	75 2e                	jne    8009dc <vprintfmt+0x4e5>
+    switch (lflag) {
+  8009ae:	85 d2                	test   %edx,%edx
+  8009b0:	0f 84 b3 00 00 00    	je     800a69 <vprintfmt+0x572>
+  8009b6:	83 fa 01             	cmp    $0x1,%edx
+  8009b9:	0f 84 d3 00 00 00    	je     800a92 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8009bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c5:	0f 87 f1 00 00 00    	ja     800abc <vprintfmt+0x5c5>
+  8009cb:	89 c2                	mov    %eax,%edx
+  8009cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d1:	83 c0 08             	add    $0x8,%eax
+  8009d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d7:	48 8b 02             	mov    (%rdx),%rax
+  8009da:	eb 17                	jmp    8009f3 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8009dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009df:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e2:	77 77                	ja     800a5b <vprintfmt+0x564>
+  8009e4:	89 c2                	mov    %eax,%edx
+  8009e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ea:	83 c0 08             	add    $0x8,%eax
+  8009ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f0:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8009f3:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8009f5:	83 f8 07             	cmp    $0x7,%eax
+  8009f8:	0f 8e cf 00 00 00    	jle    800acd <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8009fe:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800a04:	44 89 e7             	mov    %r12d,%edi
+  800a07:	41 c1 e4 03          	shl    $0x3,%r12d
+  800a0b:	89 d1                	mov    %edx,%ecx
+  800a0d:	8d 72 07             	lea    0x7(%rdx),%esi
+  800a10:	85 d2                	test   %edx,%edx
+  800a12:	0f 48 d6             	cmovs  %esi,%edx
+  800a15:	c1 fa 03             	sar    $0x3,%edx
+  800a18:	83 f9 3f             	cmp    $0x3f,%ecx
+  800a1b:	7f e7                	jg     800a04 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800a1d:	85 ff                	test   %edi,%edi
+  800a1f:	0f 84 03 fb ff ff    	je     800528 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800a25:	49 63 f4             	movslq %r12d,%rsi
+  800a28:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a2d:	48 f7 f6             	div    %rsi
+  800a30:	49 89 d7             	mov    %rdx,%r15
+  800a33:	83 c0 30             	add    $0x30,%eax
+  800a36:	0f be f8             	movsbl %al,%edi
+  800a39:	4c 89 ee             	mov    %r13,%rsi
+  800a3c:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800a3f:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800a42:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800a47:	45 85 e4             	test   %r12d,%r12d
+  800a4a:	41 0f 49 d4          	cmovns %r12d,%edx
+  800a4e:	c1 fa 03             	sar    $0x3,%edx
+  800a51:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800a54:	75 cf                	jne    800a25 <vprintfmt+0x52e>
+  800a56:	e9 cd fa ff ff       	jmp    800528 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800a5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a67:	eb 87                	jmp    8009f0 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800a69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6f:	77 13                	ja     800a84 <vprintfmt+0x58d>
+  800a71:	89 c2                	mov    %eax,%edx
+  800a73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a77:	83 c0 08             	add    $0x8,%eax
+  800a7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7d:	8b 02                	mov    (%rdx),%eax
+  800a7f:	e9 6f ff ff ff       	jmp    8009f3 <vprintfmt+0x4fc>
+  800a84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a90:	eb eb                	jmp    800a7d <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800a92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a95:	83 f8 2f             	cmp    $0x2f,%eax
+  800a98:	77 14                	ja     800aae <vprintfmt+0x5b7>
+  800a9a:	89 c2                	mov    %eax,%edx
+  800a9c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa0:	83 c0 08             	add    $0x8,%eax
+  800aa3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa6:	48 8b 02             	mov    (%rdx),%rax
+  800aa9:	e9 45 ff ff ff       	jmp    8009f3 <vprintfmt+0x4fc>
+  800aae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aba:	eb ea                	jmp    800aa6 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	e9 0a ff ff ff       	jmp    8009d7 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800acd:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800ad3:	e9 4d ff ff ff       	jmp    800a25 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800ad8:	4c 89 ee             	mov    %r13,%rsi
+  800adb:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ae0:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ae3:	4c 89 ee             	mov    %r13,%rsi
+  800ae6:	bf 78 00 00 00       	mov    $0x78,%edi
+  800aeb:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800aee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af1:	83 f8 2f             	cmp    $0x2f,%eax
+  800af4:	77 47                	ja     800b3d <vprintfmt+0x646>
+  800af6:	89 c2                	mov    %eax,%edx
+  800af8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800afc:	83 c0 08             	add    $0x8,%eax
+  800aff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b02:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b05:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b0a:	48 83 ec 08          	sub    $0x8,%rsp
+  800b0e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b12:	0f 94 c0             	sete   %al
+  800b15:	0f b6 c0             	movzbl %al,%eax
+  800b18:	50                   	push   %rax
+  800b19:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b1e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b22:	4c 89 ee             	mov    %r13,%rsi
+  800b25:	4c 89 f7             	mov    %r14,%rdi
+  800b28:	48 b8 ec 03 80 00 00 	movabs $0x8003ec,%rax
+  800b2f:	00 00 00 
+  800b32:	ff d0                	call   *%rax
+            break;
+  800b34:	48 83 c4 10          	add    $0x10,%rsp
+  800b38:	e9 eb f9 ff ff       	jmp    800528 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b49:	eb b7                	jmp    800b02 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800b4b:	40 84 f6             	test   %sil,%sil
+  800b4e:	75 2b                	jne    800b7b <vprintfmt+0x684>
+    switch (lflag) {
+  800b50:	85 d2                	test   %edx,%edx
+  800b52:	74 56                	je     800baa <vprintfmt+0x6b3>
+  800b54:	83 fa 01             	cmp    $0x1,%edx
+  800b57:	74 7f                	je     800bd8 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800b59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5f:	0f 87 a2 00 00 00    	ja     800c07 <vprintfmt+0x710>
+  800b65:	89 c2                	mov    %eax,%edx
+  800b67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6b:	83 c0 08             	add    $0x8,%eax
+  800b6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b71:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b74:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b79:	eb 8f                	jmp    800b0a <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800b7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b81:	77 19                	ja     800b9c <vprintfmt+0x6a5>
+  800b83:	89 c2                	mov    %eax,%edx
+  800b85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b89:	83 c0 08             	add    $0x8,%eax
+  800b8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b92:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b97:	e9 6e ff ff ff       	jmp    800b0a <vprintfmt+0x613>
+  800b9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba8:	eb e5                	jmp    800b8f <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800baa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bad:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb0:	77 18                	ja     800bca <vprintfmt+0x6d3>
+  800bb2:	89 c2                	mov    %eax,%edx
+  800bb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb8:	83 c0 08             	add    $0x8,%eax
+  800bbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbe:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bc0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bc5:	e9 40 ff ff ff       	jmp    800b0a <vprintfmt+0x613>
+  800bca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd6:	eb e6                	jmp    800bbe <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800bd8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bde:	77 19                	ja     800bf9 <vprintfmt+0x702>
+  800be0:	89 c2                	mov    %eax,%edx
+  800be2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be6:	83 c0 08             	add    $0x8,%eax
+  800be9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bef:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bf4:	e9 11 ff ff ff       	jmp    800b0a <vprintfmt+0x613>
+  800bf9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c05:	eb e5                	jmp    800bec <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800c07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c13:	e9 59 ff ff ff       	jmp    800b71 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800c18:	4c 89 ee             	mov    %r13,%rsi
+  800c1b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c20:	41 ff d6             	call   *%r14
+            break;
+  800c23:	e9 00 f9 ff ff       	jmp    800528 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c28:	4c 89 ee             	mov    %r13,%rsi
+  800c2b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c30:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c33:	48 83 eb 01          	sub    $0x1,%rbx
+  800c37:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c3b:	75 f6                	jne    800c33 <vprintfmt+0x73c>
+  800c3d:	e9 e6 f8 ff ff       	jmp    800528 <vprintfmt+0x31>
+}
+  800c42:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c46:	5b                   	pop    %rbx
+  800c47:	41 5c                	pop    %r12
+  800c49:	41 5d                	pop    %r13
+  800c4b:	41 5e                	pop    %r14
+  800c4d:	41 5f                	pop    %r15
+  800c4f:	5d                   	pop    %rbp
+  800c50:	c3                   	ret
+
+0000000000800c51 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c51:	55                   	push   %rbp
+  800c52:	48 89 e5             	mov    %rsp,%rbp
+  800c55:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c59:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c5d:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c62:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c66:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c6d:	48 85 ff             	test   %rdi,%rdi
+  800c70:	74 2b                	je     800c9d <vsnprintf+0x4c>
+  800c72:	48 85 f6             	test   %rsi,%rsi
+  800c75:	74 26                	je     800c9d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c77:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c7b:	48 bf a2 04 80 00 00 	movabs $0x8004a2,%rdi
+  800c82:	00 00 00 
+  800c85:	48 b8 f7 04 80 00 00 	movabs $0x8004f7,%rax
+  800c8c:	00 00 00 
+  800c8f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c95:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c98:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c9b:	c9                   	leave
+  800c9c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c9d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ca2:	eb f7                	jmp    800c9b <vsnprintf+0x4a>
+
+0000000000800ca4 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ca4:	55                   	push   %rbp
+  800ca5:	48 89 e5             	mov    %rsp,%rbp
+  800ca8:	48 83 ec 50          	sub    $0x50,%rsp
+  800cac:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cb0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cb4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cb8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cbf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cc3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ccb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ccf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cd3:	48 b8 51 0c 80 00 00 	movabs $0x800c51,%rax
+  800cda:	00 00 00 
+  800cdd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cdf:	c9                   	leave
+  800ce0:	c3                   	ret
+
+0000000000800ce1 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ce1:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ce4:	74 10                	je     800cf6 <strlen+0x15>
+    size_t n = 0;
+  800ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ceb:	48 83 c0 01          	add    $0x1,%rax
+  800cef:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cf3:	75 f6                	jne    800ceb <strlen+0xa>
+  800cf5:	c3                   	ret
+    size_t n = 0;
+  800cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cfb:	c3                   	ret
+
+0000000000800cfc <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cfc:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cff:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d04:	48 85 f6             	test   %rsi,%rsi
+  800d07:	74 11                	je     800d1a <strnlen+0x1e>
+  800d09:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d0d:	74 0c                	je     800d1b <strnlen+0x1f>
+  800d0f:	48 83 c2 01          	add    $0x1,%rdx
+  800d13:	48 39 d0             	cmp    %rdx,%rax
+  800d16:	75 f1                	jne    800d09 <strnlen+0xd>
+  800d18:	eb 04                	jmp    800d1e <strnlen+0x22>
+  800d1a:	c3                   	ret
+  800d1b:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d1e:	c3                   	ret
+
+0000000000800d1f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d1f:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d22:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d27:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d2b:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d2e:	48 83 c2 01          	add    $0x1,%rdx
+  800d32:	84 c9                	test   %cl,%cl
+  800d34:	75 f1                	jne    800d27 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d36:	c3                   	ret
+
+0000000000800d37 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d37:	55                   	push   %rbp
+  800d38:	48 89 e5             	mov    %rsp,%rbp
+  800d3b:	41 54                	push   %r12
+  800d3d:	53                   	push   %rbx
+  800d3e:	48 89 fb             	mov    %rdi,%rbx
+  800d41:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d44:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  800d4b:	00 00 00 
+  800d4e:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d50:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d54:	4c 89 e6             	mov    %r12,%rsi
+  800d57:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  800d5e:	00 00 00 
+  800d61:	ff d0                	call   *%rax
+    return dst;
+}
+  800d63:	48 89 d8             	mov    %rbx,%rax
+  800d66:	5b                   	pop    %rbx
+  800d67:	41 5c                	pop    %r12
+  800d69:	5d                   	pop    %rbp
+  800d6a:	c3                   	ret
+
+0000000000800d6b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d6b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d6e:	48 85 d2             	test   %rdx,%rdx
+  800d71:	74 1f                	je     800d92 <strncpy+0x27>
+  800d73:	48 01 fa             	add    %rdi,%rdx
+  800d76:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d79:	48 83 c1 01          	add    $0x1,%rcx
+  800d7d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d81:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d85:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d89:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d8d:	48 39 ca             	cmp    %rcx,%rdx
+  800d90:	75 e7                	jne    800d79 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d92:	c3                   	ret
+
+0000000000800d93 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d93:	48 89 f8             	mov    %rdi,%rax
+  800d96:	48 85 d2             	test   %rdx,%rdx
+  800d99:	74 24                	je     800dbf <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d9b:	48 83 ea 01          	sub    $0x1,%rdx
+  800d9f:	74 1b                	je     800dbc <strlcpy+0x29>
+  800da1:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800da5:	0f b6 16             	movzbl (%rsi),%edx
+  800da8:	84 d2                	test   %dl,%dl
+  800daa:	74 10                	je     800dbc <strlcpy+0x29>
+            *dst++ = *src++;
+  800dac:	48 83 c6 01          	add    $0x1,%rsi
+  800db0:	48 83 c0 01          	add    $0x1,%rax
+  800db4:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800db7:	48 39 c8             	cmp    %rcx,%rax
+  800dba:	75 e9                	jne    800da5 <strlcpy+0x12>
+        *dst = '\0';
+  800dbc:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dbf:	48 29 f8             	sub    %rdi,%rax
+}
+  800dc2:	c3                   	ret
+
+0000000000800dc3 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800dc3:	0f b6 07             	movzbl (%rdi),%eax
+  800dc6:	84 c0                	test   %al,%al
+  800dc8:	74 13                	je     800ddd <strcmp+0x1a>
+  800dca:	38 06                	cmp    %al,(%rsi)
+  800dcc:	75 0f                	jne    800ddd <strcmp+0x1a>
+  800dce:	48 83 c7 01          	add    $0x1,%rdi
+  800dd2:	48 83 c6 01          	add    $0x1,%rsi
+  800dd6:	0f b6 07             	movzbl (%rdi),%eax
+  800dd9:	84 c0                	test   %al,%al
+  800ddb:	75 ed                	jne    800dca <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ddd:	0f b6 c0             	movzbl %al,%eax
+  800de0:	0f b6 16             	movzbl (%rsi),%edx
+  800de3:	29 d0                	sub    %edx,%eax
+}
+  800de5:	c3                   	ret
+
+0000000000800de6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800de6:	48 85 d2             	test   %rdx,%rdx
+  800de9:	74 1f                	je     800e0a <strncmp+0x24>
+  800deb:	0f b6 07             	movzbl (%rdi),%eax
+  800dee:	84 c0                	test   %al,%al
+  800df0:	74 1e                	je     800e10 <strncmp+0x2a>
+  800df2:	3a 06                	cmp    (%rsi),%al
+  800df4:	75 1a                	jne    800e10 <strncmp+0x2a>
+  800df6:	48 83 c7 01          	add    $0x1,%rdi
+  800dfa:	48 83 c6 01          	add    $0x1,%rsi
+  800dfe:	48 83 ea 01          	sub    $0x1,%rdx
+  800e02:	75 e7                	jne    800deb <strncmp+0x5>
+
+    if (!n) return 0;
+  800e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e09:	c3                   	ret
+  800e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0f:	c3                   	ret
+  800e10:	48 85 d2             	test   %rdx,%rdx
+  800e13:	74 09                	je     800e1e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e15:	0f b6 07             	movzbl (%rdi),%eax
+  800e18:	0f b6 16             	movzbl (%rsi),%edx
+  800e1b:	29 d0                	sub    %edx,%eax
+  800e1d:	c3                   	ret
+    if (!n) return 0;
+  800e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e23:	c3                   	ret
+
+0000000000800e24 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e24:	0f b6 17             	movzbl (%rdi),%edx
+  800e27:	84 d2                	test   %dl,%dl
+  800e29:	74 18                	je     800e43 <strchr+0x1f>
+        if (*str == c) {
+  800e2b:	0f be d2             	movsbl %dl,%edx
+  800e2e:	39 f2                	cmp    %esi,%edx
+  800e30:	74 17                	je     800e49 <strchr+0x25>
+    for (; *str; str++) {
+  800e32:	48 83 c7 01          	add    $0x1,%rdi
+  800e36:	0f b6 17             	movzbl (%rdi),%edx
+  800e39:	84 d2                	test   %dl,%dl
+  800e3b:	75 ee                	jne    800e2b <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e42:	c3                   	ret
+  800e43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e48:	c3                   	ret
+  800e49:	48 89 f8             	mov    %rdi,%rax
+}
+  800e4c:	c3                   	ret
+
+0000000000800e4d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e4d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e50:	0f b6 17             	movzbl (%rdi),%edx
+  800e53:	84 d2                	test   %dl,%dl
+  800e55:	74 13                	je     800e6a <strfind+0x1d>
+  800e57:	0f be d2             	movsbl %dl,%edx
+  800e5a:	39 f2                	cmp    %esi,%edx
+  800e5c:	74 0b                	je     800e69 <strfind+0x1c>
+  800e5e:	48 83 c0 01          	add    $0x1,%rax
+  800e62:	0f b6 10             	movzbl (%rax),%edx
+  800e65:	84 d2                	test   %dl,%dl
+  800e67:	75 ee                	jne    800e57 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e69:	c3                   	ret
+  800e6a:	c3                   	ret
+
+0000000000800e6b <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800e6b:	55                   	push   %rbp
+  800e6c:	48 89 e5             	mov    %rsp,%rbp
+  800e6f:	41 57                	push   %r15
+  800e71:	41 56                	push   %r14
+  800e73:	41 55                	push   %r13
+  800e75:	41 54                	push   %r12
+  800e77:	53                   	push   %rbx
+  800e78:	48 83 ec 08          	sub    $0x8,%rsp
+  800e7c:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800e7f:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800e83:	45 84 ed             	test   %r13b,%r13b
+  800e86:	75 12                	jne    800e9a <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800e88:	4c 89 f8             	mov    %r15,%rax
+  800e8b:	48 83 c4 08          	add    $0x8,%rsp
+  800e8f:	5b                   	pop    %rbx
+  800e90:	41 5c                	pop    %r12
+  800e92:	41 5d                	pop    %r13
+  800e94:	41 5e                	pop    %r14
+  800e96:	41 5f                	pop    %r15
+  800e98:	5d                   	pop    %rbp
+  800e99:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800e9a:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800e9e:	4c 89 e7             	mov    %r12,%rdi
+  800ea1:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  800ea8:	00 00 00 
+  800eab:	ff d0                	call   *%rax
+  800ead:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800eb0:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800eb4:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800eb8:	49 bf e6 0d 80 00 00 	movabs $0x800de6,%r15
+  800ebf:	00 00 00 
+				if ((sc = *s++) == 0)
+  800ec2:	84 c0                	test   %al,%al
+  800ec4:	75 14                	jne    800eda <strstr+0x6f>
+					return NULL;
+  800ec6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800ecc:	eb ba                	jmp    800e88 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800ece:	48 83 c3 01          	add    $0x1,%rbx
+  800ed2:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800ed6:	84 c0                	test   %al,%al
+  800ed8:	74 1b                	je     800ef5 <strstr+0x8a>
+			} while (sc != c);
+  800eda:	41 38 c5             	cmp    %al,%r13b
+  800edd:	75 ef                	jne    800ece <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800edf:	4c 89 f2             	mov    %r14,%rdx
+  800ee2:	4c 89 e6             	mov    %r12,%rsi
+  800ee5:	48 89 df             	mov    %rbx,%rdi
+  800ee8:	41 ff d7             	call   *%r15
+  800eeb:	85 c0                	test   %eax,%eax
+  800eed:	75 df                	jne    800ece <strstr+0x63>
+  800eef:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800ef3:	eb 93                	jmp    800e88 <strstr+0x1d>
+					return NULL;
+  800ef5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800efb:	eb 8b                	jmp    800e88 <strstr+0x1d>
+
+0000000000800efd <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800efd:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800eff:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800f02:	8d 57 20             	lea    0x20(%rdi),%edx
+  800f05:	83 f9 1a             	cmp    $0x1a,%ecx
+  800f08:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800f0b:	c3                   	ret
+
+0000000000800f0c <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800f0c:	55                   	push   %rbp
+  800f0d:	48 89 e5             	mov    %rsp,%rbp
+  800f10:	41 57                	push   %r15
+  800f12:	41 56                	push   %r14
+  800f14:	41 55                	push   %r13
+  800f16:	41 54                	push   %r12
+  800f18:	53                   	push   %rbx
+  800f19:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800f1d:	48 39 f7             	cmp    %rsi,%rdi
+  800f20:	74 49                	je     800f6b <strcasecmp+0x5f>
+  800f22:	49 89 fd             	mov    %rdi,%r13
+  800f25:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800f28:	49 bf fd 0e 80 00 00 	movabs $0x800efd,%r15
+  800f2f:	00 00 00 
+  800f32:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800f37:	41 0f b6 fe          	movzbl %r14b,%edi
+  800f3b:	41 ff d7             	call   *%r15
+  800f3e:	89 c3                	mov    %eax,%ebx
+  800f40:	49 83 c4 01          	add    $0x1,%r12
+  800f44:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800f4a:	41 ff d7             	call   *%r15
+  800f4d:	29 c3                	sub    %eax,%ebx
+  800f4f:	75 09                	jne    800f5a <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800f51:	49 83 c5 01          	add    $0x1,%r13
+  800f55:	45 84 f6             	test   %r14b,%r14b
+  800f58:	75 d8                	jne    800f32 <strcasecmp+0x26>
+}
+  800f5a:	89 d8                	mov    %ebx,%eax
+  800f5c:	48 83 c4 08          	add    $0x8,%rsp
+  800f60:	5b                   	pop    %rbx
+  800f61:	41 5c                	pop    %r12
+  800f63:	41 5d                	pop    %r13
+  800f65:	41 5e                	pop    %r14
+  800f67:	41 5f                	pop    %r15
+  800f69:	5d                   	pop    %rbp
+  800f6a:	c3                   	ret
+        return 0;
+  800f6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f70:	eb e8                	jmp    800f5a <strcasecmp+0x4e>
+
+0000000000800f72 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800f72:	55                   	push   %rbp
+  800f73:	48 89 e5             	mov    %rsp,%rbp
+  800f76:	41 57                	push   %r15
+  800f78:	41 56                	push   %r14
+  800f7a:	41 55                	push   %r13
+  800f7c:	41 54                	push   %r12
+  800f7e:	53                   	push   %rbx
+  800f7f:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800f83:	48 85 d2             	test   %rdx,%rdx
+  800f86:	74 4f                	je     800fd7 <strncasecmp+0x65>
+  800f88:	49 89 fc             	mov    %rdi,%r12
+  800f8b:	49 89 f5             	mov    %rsi,%r13
+  800f8e:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800f92:	49 be fd 0e 80 00 00 	movabs $0x800efd,%r14
+  800f99:	00 00 00 
+  800f9c:	49 83 c4 01          	add    $0x1,%r12
+  800fa0:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800fa6:	41 ff d6             	call   *%r14
+  800fa9:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800fab:	49 83 c5 01          	add    $0x1,%r13
+  800faf:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800fb4:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800fb7:	29 c3                	sub    %eax,%ebx
+  800fb9:	85 c0                	test   %eax,%eax
+  800fbb:	74 09                	je     800fc6 <strncasecmp+0x54>
+  800fbd:	85 db                	test   %ebx,%ebx
+  800fbf:	75 05                	jne    800fc6 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800fc1:	4d 39 fc             	cmp    %r15,%r12
+  800fc4:	75 d6                	jne    800f9c <strncasecmp+0x2a>
+}
+  800fc6:	89 d8                	mov    %ebx,%eax
+  800fc8:	48 83 c4 08          	add    $0x8,%rsp
+  800fcc:	5b                   	pop    %rbx
+  800fcd:	41 5c                	pop    %r12
+  800fcf:	41 5d                	pop    %r13
+  800fd1:	41 5e                	pop    %r14
+  800fd3:	41 5f                	pop    %r15
+  800fd5:	5d                   	pop    %rbp
+  800fd6:	c3                   	ret
+    int d = 0;
+  800fd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800fdc:	eb e8                	jmp    800fc6 <strncasecmp+0x54>
+
+0000000000800fde <toupper>:
+
+int toupper(int c) {
+  800fde:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800fe0:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800fe3:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800fe6:	83 f9 1a             	cmp    $0x1a,%ecx
+  800fe9:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800fec:	c3                   	ret
+
+0000000000800fed <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800fed:	83 ff 20             	cmp    $0x20,%edi
+  800ff0:	0f 94 c0             	sete   %al
+  800ff3:	0f b6 c0             	movzbl %al,%eax
+}
+  800ff6:	c3                   	ret
+
+0000000000800ff7 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800ff7:	89 f8                	mov    %edi,%eax
+  800ff9:	f7 d8                	neg    %eax
+  800ffb:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800ffe:	c3                   	ret
+
+0000000000800fff <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fff:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801002:	48 89 f8             	mov    %rdi,%rax
+  801005:	48 f7 d8             	neg    %rax
+  801008:	83 e0 07             	and    $0x7,%eax
+  80100b:	49 89 d1             	mov    %rdx,%r9
+  80100e:	49 29 c1             	sub    %rax,%r9
+  801011:	78 36                	js     801049 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801013:	40 0f b6 c6          	movzbl %sil,%eax
+  801017:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80101e:	01 01 01 
+  801021:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801025:	40 f6 c7 07          	test   $0x7,%dil
+  801029:	75 38                	jne    801063 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80102b:	4c 89 c9             	mov    %r9,%rcx
+  80102e:	48 c1 f9 03          	sar    $0x3,%rcx
+  801032:	74 0c                	je     801040 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801034:	fc                   	cld
+  801035:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801038:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80103c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801040:	4d 85 c9             	test   %r9,%r9
+  801043:	75 45                	jne    80108a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801045:	4c 89 c0             	mov    %r8,%rax
+  801048:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801049:	48 85 d2             	test   %rdx,%rdx
+  80104c:	74 f7                	je     801045 <memset+0x46>
+  80104e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801051:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801054:	48 83 c0 01          	add    $0x1,%rax
+  801058:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80105c:	48 39 c2             	cmp    %rax,%rdx
+  80105f:	75 f3                	jne    801054 <memset+0x55>
+  801061:	eb e2                	jmp    801045 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801063:	40 f6 c7 01          	test   $0x1,%dil
+  801067:	74 06                	je     80106f <memset+0x70>
+  801069:	88 07                	mov    %al,(%rdi)
+  80106b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80106f:	40 f6 c7 02          	test   $0x2,%dil
+  801073:	74 07                	je     80107c <memset+0x7d>
+  801075:	66 89 07             	mov    %ax,(%rdi)
+  801078:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80107c:	40 f6 c7 04          	test   $0x4,%dil
+  801080:	74 a9                	je     80102b <memset+0x2c>
+  801082:	89 07                	mov    %eax,(%rdi)
+  801084:	48 83 c7 04          	add    $0x4,%rdi
+  801088:	eb a1                	jmp    80102b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80108a:	41 f6 c1 04          	test   $0x4,%r9b
+  80108e:	74 06                	je     801096 <memset+0x97>
+  801090:	89 07                	mov    %eax,(%rdi)
+  801092:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801096:	41 f6 c1 02          	test   $0x2,%r9b
+  80109a:	74 07                	je     8010a3 <memset+0xa4>
+  80109c:	66 89 07             	mov    %ax,(%rdi)
+  80109f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010a3:	41 f6 c1 01          	test   $0x1,%r9b
+  8010a7:	74 9c                	je     801045 <memset+0x46>
+  8010a9:	88 07                	mov    %al,(%rdi)
+  8010ab:	eb 98                	jmp    801045 <memset+0x46>
+
+00000000008010ad <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010ad:	48 89 f8             	mov    %rdi,%rax
+  8010b0:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010b3:	48 39 fe             	cmp    %rdi,%rsi
+  8010b6:	73 3b                	jae    8010f3 <memmove+0x46>
+  8010b8:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010bc:	48 39 d7             	cmp    %rdx,%rdi
+  8010bf:	73 32                	jae    8010f3 <memmove+0x46>
+        s += n;
+        d += n;
+  8010c1:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010c5:	48 89 d6             	mov    %rdx,%rsi
+  8010c8:	48 09 fe             	or     %rdi,%rsi
+  8010cb:	48 09 ce             	or     %rcx,%rsi
+  8010ce:	40 f6 c6 07          	test   $0x7,%sil
+  8010d2:	75 12                	jne    8010e6 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010d4:	48 83 ef 08          	sub    $0x8,%rdi
+  8010d8:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010dc:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010e0:	fd                   	std
+  8010e1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010e4:	fc                   	cld
+  8010e5:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010e6:	48 83 ef 01          	sub    $0x1,%rdi
+  8010ea:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010ee:	fd                   	std
+  8010ef:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010f1:	eb f1                	jmp    8010e4 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010f3:	48 89 f2             	mov    %rsi,%rdx
+  8010f6:	48 09 c2             	or     %rax,%rdx
+  8010f9:	48 09 ca             	or     %rcx,%rdx
+  8010fc:	f6 c2 07             	test   $0x7,%dl
+  8010ff:	75 0c                	jne    80110d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801101:	48 c1 e9 03          	shr    $0x3,%rcx
+  801105:	48 89 c7             	mov    %rax,%rdi
+  801108:	fc                   	cld
+  801109:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80110c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80110d:	48 89 c7             	mov    %rax,%rdi
+  801110:	fc                   	cld
+  801111:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801113:	c3                   	ret
+
+0000000000801114 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801118:	48 b8 ad 10 80 00 00 	movabs $0x8010ad,%rax
+  80111f:	00 00 00 
+  801122:	ff d0                	call   *%rax
+}
+  801124:	5d                   	pop    %rbp
+  801125:	c3                   	ret
+
+0000000000801126 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801126:	55                   	push   %rbp
+  801127:	48 89 e5             	mov    %rsp,%rbp
+  80112a:	41 57                	push   %r15
+  80112c:	41 56                	push   %r14
+  80112e:	41 55                	push   %r13
+  801130:	41 54                	push   %r12
+  801132:	53                   	push   %rbx
+  801133:	48 83 ec 08          	sub    $0x8,%rsp
+  801137:	49 89 fe             	mov    %rdi,%r14
+  80113a:	49 89 f7             	mov    %rsi,%r15
+  80113d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801140:	48 89 f7             	mov    %rsi,%rdi
+  801143:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  80114a:	00 00 00 
+  80114d:	ff d0                	call   *%rax
+  80114f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801152:	48 89 de             	mov    %rbx,%rsi
+  801155:	4c 89 f7             	mov    %r14,%rdi
+  801158:	48 b8 fc 0c 80 00 00 	movabs $0x800cfc,%rax
+  80115f:	00 00 00 
+  801162:	ff d0                	call   *%rax
+  801164:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801167:	48 39 c3             	cmp    %rax,%rbx
+  80116a:	74 36                	je     8011a2 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80116c:	48 89 d8             	mov    %rbx,%rax
+  80116f:	4c 29 e8             	sub    %r13,%rax
+  801172:	49 39 c4             	cmp    %rax,%r12
+  801175:	73 31                	jae    8011a8 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801177:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80117c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801180:	4c 89 fe             	mov    %r15,%rsi
+  801183:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  80118a:	00 00 00 
+  80118d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80118f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801193:	48 83 c4 08          	add    $0x8,%rsp
+  801197:	5b                   	pop    %rbx
+  801198:	41 5c                	pop    %r12
+  80119a:	41 5d                	pop    %r13
+  80119c:	41 5e                	pop    %r14
+  80119e:	41 5f                	pop    %r15
+  8011a0:	5d                   	pop    %rbp
+  8011a1:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011a2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011a6:	eb eb                	jmp    801193 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011a8:	48 83 eb 01          	sub    $0x1,%rbx
+  8011ac:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011b0:	48 89 da             	mov    %rbx,%rdx
+  8011b3:	4c 89 fe             	mov    %r15,%rsi
+  8011b6:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  8011bd:	00 00 00 
+  8011c0:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011c2:	49 01 de             	add    %rbx,%r14
+  8011c5:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011ca:	eb c3                	jmp    80118f <strlcat+0x69>
+
+00000000008011cc <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011cc:	48 85 d2             	test   %rdx,%rdx
+  8011cf:	74 2d                	je     8011fe <memcmp+0x32>
+  8011d1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011d6:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011da:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011df:	44 38 c1             	cmp    %r8b,%cl
+  8011e2:	75 0f                	jne    8011f3 <memcmp+0x27>
+    while (n-- > 0) {
+  8011e4:	48 83 c0 01          	add    $0x1,%rax
+  8011e8:	48 39 c2             	cmp    %rax,%rdx
+  8011eb:	75 e9                	jne    8011d6 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f2:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011f3:	0f b6 c1             	movzbl %cl,%eax
+  8011f6:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011fa:	44 29 c0             	sub    %r8d,%eax
+  8011fd:	c3                   	ret
+    return 0;
+  8011fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801203:	c3                   	ret
+
+0000000000801204 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801204:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801208:	48 39 c7             	cmp    %rax,%rdi
+  80120b:	73 0f                	jae    80121c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80120d:	40 38 37             	cmp    %sil,(%rdi)
+  801210:	74 0e                	je     801220 <memfind+0x1c>
+    for (; src < end; src++) {
+  801212:	48 83 c7 01          	add    $0x1,%rdi
+  801216:	48 39 f8             	cmp    %rdi,%rax
+  801219:	75 f2                	jne    80120d <memfind+0x9>
+  80121b:	c3                   	ret
+  80121c:	48 89 f8             	mov    %rdi,%rax
+  80121f:	c3                   	ret
+  801220:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801223:	c3                   	ret
+
+0000000000801224 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801224:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801227:	0f b6 37             	movzbl (%rdi),%esi
+  80122a:	40 80 fe 20          	cmp    $0x20,%sil
+  80122e:	74 06                	je     801236 <strtol+0x12>
+  801230:	40 80 fe 09          	cmp    $0x9,%sil
+  801234:	75 13                	jne    801249 <strtol+0x25>
+  801236:	48 83 c7 01          	add    $0x1,%rdi
+  80123a:	0f b6 37             	movzbl (%rdi),%esi
+  80123d:	40 80 fe 20          	cmp    $0x20,%sil
+  801241:	74 f3                	je     801236 <strtol+0x12>
+  801243:	40 80 fe 09          	cmp    $0x9,%sil
+  801247:	74 ed                	je     801236 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801249:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80124c:	83 e0 fd             	and    $0xfffffffd,%eax
+  80124f:	3c 01                	cmp    $0x1,%al
+  801251:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801255:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80125b:	75 0f                	jne    80126c <strtol+0x48>
+  80125d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801260:	74 14                	je     801276 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801262:	85 d2                	test   %edx,%edx
+  801264:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801269:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80126c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801271:	4c 63 ca             	movslq %edx,%r9
+  801274:	eb 36                	jmp    8012ac <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801276:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80127a:	74 0f                	je     80128b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80127c:	85 d2                	test   %edx,%edx
+  80127e:	75 ec                	jne    80126c <strtol+0x48>
+        s++;
+  801280:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801284:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801289:	eb e1                	jmp    80126c <strtol+0x48>
+        s += 2;
+  80128b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80128f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801294:	eb d6                	jmp    80126c <strtol+0x48>
+            dig -= '0';
+  801296:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801299:	44 0f b6 c1          	movzbl %cl,%r8d
+  80129d:	41 39 d0             	cmp    %edx,%r8d
+  8012a0:	7d 21                	jge    8012c3 <strtol+0x9f>
+        val = val * base + dig;
+  8012a2:	49 0f af c1          	imul   %r9,%rax
+  8012a6:	0f b6 c9             	movzbl %cl,%ecx
+  8012a9:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012ac:	48 83 c7 01          	add    $0x1,%rdi
+  8012b0:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012b4:	80 f9 39             	cmp    $0x39,%cl
+  8012b7:	76 dd                	jbe    801296 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012b9:	80 f9 7b             	cmp    $0x7b,%cl
+  8012bc:	77 05                	ja     8012c3 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012be:	83 e9 57             	sub    $0x57,%ecx
+  8012c1:	eb d6                	jmp    801299 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012c3:	4d 85 d2             	test   %r10,%r10
+  8012c6:	74 03                	je     8012cb <strtol+0xa7>
+  8012c8:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012cb:	48 89 c2             	mov    %rax,%rdx
+  8012ce:	48 f7 da             	neg    %rdx
+  8012d1:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012d5:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012d9:	c3                   	ret
+
+00000000008012da <atoi>:
+int atoi(const char *str) {
+  8012da:	55                   	push   %rbp
+  8012db:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8012de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e8:	48 b8 24 12 80 00 00 	movabs $0x801224,%rax
+  8012ef:	00 00 00 
+  8012f2:	ff d0                	call   *%rax
+}
+  8012f4:	5d                   	pop    %rbp
+  8012f5:	c3                   	ret
+
+00000000008012f6 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012f6:	55                   	push   %rbp
+  8012f7:	48 89 e5             	mov    %rsp,%rbp
+  8012fa:	53                   	push   %rbx
+  8012fb:	48 89 fa             	mov    %rdi,%rdx
+  8012fe:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801301:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801306:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801310:	be 00 00 00 00       	mov    $0x0,%esi
+  801315:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80131b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80131d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801321:	c9                   	leave
+  801322:	c3                   	ret
+
+0000000000801323 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801323:	55                   	push   %rbp
+  801324:	48 89 e5             	mov    %rsp,%rbp
+  801327:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801328:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80132d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801332:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801337:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801341:	be 00 00 00 00       	mov    $0x0,%esi
+  801346:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80134e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801352:	c9                   	leave
+  801353:	c3                   	ret
+
+0000000000801354 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801354:	55                   	push   %rbp
+  801355:	48 89 e5             	mov    %rsp,%rbp
+  801358:	53                   	push   %rbx
+  801359:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80135d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801360:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801365:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80136a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801374:	be 00 00 00 00       	mov    $0x0,%esi
+  801379:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801381:	48 85 c0             	test   %rax,%rax
+  801384:	7f 06                	jg     80138c <sys_env_destroy+0x38>
+}
+  801386:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80138a:	c9                   	leave
+  80138b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80138c:	49 89 c0             	mov    %rax,%r8
+  80138f:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801394:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80139b:	00 00 00 
+  80139e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013a3:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8013aa:	00 00 00 
+  8013ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b2:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8013b9:	00 00 00 
+  8013bc:	41 ff d1             	call   *%r9
+
+00000000008013bf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013bf:	55                   	push   %rbp
+  8013c0:	48 89 e5             	mov    %rsp,%rbp
+  8013c3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c4:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e8:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ee:	c9                   	leave
+  8013ef:	c3                   	ret
+
+00000000008013f0 <sys_yield>:
+
+void
+sys_yield(void) {
+  8013f0:	55                   	push   %rbp
+  8013f1:	48 89 e5             	mov    %rsp,%rbp
+  8013f4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f5:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801404:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801409:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140e:	be 00 00 00 00       	mov    $0x0,%esi
+  801413:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801419:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80141b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141f:	c9                   	leave
+  801420:	c3                   	ret
+
+0000000000801421 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801421:	55                   	push   %rbp
+  801422:	48 89 e5             	mov    %rsp,%rbp
+  801425:	53                   	push   %rbx
+  801426:	48 89 fa             	mov    %rdi,%rdx
+  801429:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80142c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801431:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801438:	00 00 00 
+  80143b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801440:	be 00 00 00 00       	mov    $0x0,%esi
+  801445:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80144d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801451:	c9                   	leave
+  801452:	c3                   	ret
+
+0000000000801453 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801453:	55                   	push   %rbp
+  801454:	48 89 e5             	mov    %rsp,%rbp
+  801457:	53                   	push   %rbx
+  801458:	49 89 f8             	mov    %rdi,%r8
+  80145b:	48 89 d3             	mov    %rdx,%rbx
+  80145e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801461:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801466:	4c 89 c2             	mov    %r8,%rdx
+  801469:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146c:	be 00 00 00 00       	mov    $0x0,%esi
+  801471:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801477:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801479:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147d:	c9                   	leave
+  80147e:	c3                   	ret
+
+000000000080147f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80147f:	55                   	push   %rbp
+  801480:	48 89 e5             	mov    %rsp,%rbp
+  801483:	53                   	push   %rbx
+  801484:	48 83 ec 08          	sub    $0x8,%rsp
+  801488:	89 f8                	mov    %edi,%eax
+  80148a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80148d:	48 63 f9             	movslq %ecx,%rdi
+  801490:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801493:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801498:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149b:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a8:	48 85 c0             	test   %rax,%rax
+  8014ab:	7f 06                	jg     8014b3 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b1:	c9                   	leave
+  8014b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b3:	49 89 c0             	mov    %rax,%r8
+  8014b6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014bb:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8014c2:	00 00 00 
+  8014c5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014ca:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8014d1:	00 00 00 
+  8014d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d9:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8014e0:	00 00 00 
+  8014e3:	41 ff d1             	call   *%r9
+
+00000000008014e6 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014e6:	55                   	push   %rbp
+  8014e7:	48 89 e5             	mov    %rsp,%rbp
+  8014ea:	53                   	push   %rbx
+  8014eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ef:	89 f8                	mov    %edi,%eax
+  8014f1:	49 89 f2             	mov    %rsi,%r10
+  8014f4:	48 89 cf             	mov    %rcx,%rdi
+  8014f7:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014fa:	48 63 da             	movslq %edx,%rbx
+  8014fd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801500:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801505:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801508:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80150b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150d:	48 85 c0             	test   %rax,%rax
+  801510:	7f 06                	jg     801518 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801512:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801516:	c9                   	leave
+  801517:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801518:	49 89 c0             	mov    %rax,%r8
+  80151b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801520:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801527:	00 00 00 
+  80152a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80152f:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801536:	00 00 00 
+  801539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153e:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  801545:	00 00 00 
+  801548:	41 ff d1             	call   *%r9
+
+000000000080154b <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80154b:	55                   	push   %rbp
+  80154c:	48 89 e5             	mov    %rsp,%rbp
+  80154f:	53                   	push   %rbx
+  801550:	48 83 ec 08          	sub    $0x8,%rsp
+  801554:	49 89 f9             	mov    %rdi,%r9
+  801557:	89 f0                	mov    %esi,%eax
+  801559:	48 89 d3             	mov    %rdx,%rbx
+  80155c:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80155f:	49 63 f0             	movslq %r8d,%rsi
+  801562:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801565:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80156a:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801573:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801575:	48 85 c0             	test   %rax,%rax
+  801578:	7f 06                	jg     801580 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80157a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157e:	c9                   	leave
+  80157f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801580:	49 89 c0             	mov    %rax,%r8
+  801583:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801588:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80158f:	00 00 00 
+  801592:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801597:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  80159e:	00 00 00 
+  8015a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a6:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8015ad:	00 00 00 
+  8015b0:	41 ff d1             	call   *%r9
+
+00000000008015b3 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8015b3:	55                   	push   %rbp
+  8015b4:	48 89 e5             	mov    %rsp,%rbp
+  8015b7:	53                   	push   %rbx
+  8015b8:	89 f8                	mov    %edi,%eax
+  8015ba:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8015bd:	48 63 f9             	movslq %ecx,%rdi
+  8015c0:	48 63 da             	movslq %edx,%rbx
+  8015c3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015cb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d9:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8015db:	89 c2                	mov    %eax,%edx
+  8015dd:	48 85 c0             	test   %rax,%rax
+  8015e0:	78 0d                	js     8015ef <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8015e2:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8015e7:	4d 85 c9             	test   %r9,%r9
+  8015ea:	74 03                	je     8015ef <sys_alloc_dma_region+0x3c>
+  8015ec:	49 89 01             	mov    %rax,(%r9)
+}
+  8015ef:	89 d0                	mov    %edx,%eax
+  8015f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f5:	c9                   	leave
+  8015f6:	c3                   	ret
+
+00000000008015f7 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8015f7:	55                   	push   %rbp
+  8015f8:	48 89 e5             	mov    %rsp,%rbp
+  8015fb:	53                   	push   %rbx
+  8015fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801600:	48 89 f1             	mov    %rsi,%rcx
+  801603:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801606:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801609:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801613:	be 00 00 00 00       	mov    $0x0,%esi
+  801618:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801620:	48 85 c0             	test   %rax,%rax
+  801623:	7f 06                	jg     80162b <sys_set_cache_region+0x34>
+}
+  801625:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801629:	c9                   	leave
+  80162a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80162b:	49 89 c0             	mov    %rax,%r8
+  80162e:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801633:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80163a:	00 00 00 
+  80163d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801642:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801649:	00 00 00 
+  80164c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801651:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  801658:	00 00 00 
+  80165b:	41 ff d1             	call   *%r9
+
+000000000080165e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80165e:	55                   	push   %rbp
+  80165f:	48 89 e5             	mov    %rsp,%rbp
+  801662:	53                   	push   %rbx
+  801663:	48 83 ec 08          	sub    $0x8,%rsp
+  801667:	48 89 f1             	mov    %rsi,%rcx
+  80166a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80166d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801670:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801675:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167a:	be 00 00 00 00       	mov    $0x0,%esi
+  80167f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801685:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801687:	48 85 c0             	test   %rax,%rax
+  80168a:	7f 06                	jg     801692 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80168c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801690:	c9                   	leave
+  801691:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801692:	49 89 c0             	mov    %rax,%r8
+  801695:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80169a:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8016a1:	00 00 00 
+  8016a4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016a9:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8016b0:	00 00 00 
+  8016b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b8:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8016bf:	00 00 00 
+  8016c2:	41 ff d1             	call   *%r9
+
+00000000008016c5 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8016c5:	55                   	push   %rbp
+  8016c6:	48 89 e5             	mov    %rsp,%rbp
+  8016c9:	53                   	push   %rbx
+  8016ca:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8016ce:	48 63 ce             	movslq %esi,%rcx
+  8016d1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016de:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f0:	48 85 c0             	test   %rax,%rax
+  8016f3:	7f 06                	jg     8016fb <sys_env_set_status+0x36>
+}
+  8016f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f9:	c9                   	leave
+  8016fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016fb:	49 89 c0             	mov    %rax,%r8
+  8016fe:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801703:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  80170a:	00 00 00 
+  80170d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801712:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801719:	00 00 00 
+  80171c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801721:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  801728:	00 00 00 
+  80172b:	41 ff d1             	call   *%r9
+
+000000000080172e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80172e:	55                   	push   %rbp
+  80172f:	48 89 e5             	mov    %rsp,%rbp
+  801732:	53                   	push   %rbx
+  801733:	48 83 ec 08          	sub    $0x8,%rsp
+  801737:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80173a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80173d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801742:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801747:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174c:	be 00 00 00 00       	mov    $0x0,%esi
+  801751:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801757:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801759:	48 85 c0             	test   %rax,%rax
+  80175c:	7f 06                	jg     801764 <sys_env_set_trapframe+0x36>
+}
+  80175e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801762:	c9                   	leave
+  801763:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801764:	49 89 c0             	mov    %rax,%r8
+  801767:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80176c:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801773:	00 00 00 
+  801776:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80177b:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801782:	00 00 00 
+  801785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178a:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  801791:	00 00 00 
+  801794:	41 ff d1             	call   *%r9
+
+0000000000801797 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801797:	55                   	push   %rbp
+  801798:	48 89 e5             	mov    %rsp,%rbp
+  80179b:	53                   	push   %rbx
+  80179c:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8017a3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a6:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c2:	48 85 c0             	test   %rax,%rax
+  8017c5:	7f 06                	jg     8017cd <sys_env_set_pgfault_upcall+0x36>
+}
+  8017c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017cb:	c9                   	leave
+  8017cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017cd:	49 89 c0             	mov    %rax,%r8
+  8017d0:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8017d5:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  8017dc:	00 00 00 
+  8017df:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017e4:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  8017eb:	00 00 00 
+  8017ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f3:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8017fa:	00 00 00 
+  8017fd:	41 ff d1             	call   *%r9
+
+0000000000801800 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801800:	55                   	push   %rbp
+  801801:	48 89 e5             	mov    %rsp,%rbp
+  801804:	53                   	push   %rbx
+  801805:	89 f8                	mov    %edi,%eax
+  801807:	49 89 f1             	mov    %rsi,%r9
+  80180a:	48 89 d3             	mov    %rdx,%rbx
+  80180d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801810:	49 63 f0             	movslq %r8d,%rsi
+  801813:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801816:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80181b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80181e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801824:	cd 30                	int    $0x30
+}
+  801826:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182a:	c9                   	leave
+  80182b:	c3                   	ret
+
+000000000080182c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80182c:	55                   	push   %rbp
+  80182d:	48 89 e5             	mov    %rsp,%rbp
+  801830:	53                   	push   %rbx
+  801831:	48 83 ec 08          	sub    $0x8,%rsp
+  801835:	48 89 fa             	mov    %rdi,%rdx
+  801838:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80183b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801840:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801845:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80184a:	be 00 00 00 00       	mov    $0x0,%esi
+  80184f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801855:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801857:	48 85 c0             	test   %rax,%rax
+  80185a:	7f 06                	jg     801862 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80185c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801860:	c9                   	leave
+  801861:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801862:	49 89 c0             	mov    %rax,%r8
+  801865:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80186a:	48 ba 60 55 80 00 00 	movabs $0x805560,%rdx
+  801871:	00 00 00 
+  801874:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801879:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801880:	00 00 00 
+  801883:	b8 00 00 00 00       	mov    $0x0,%eax
+  801888:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  80188f:	00 00 00 
+  801892:	41 ff d1             	call   *%r9
+
+0000000000801895 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801895:	55                   	push   %rbp
+  801896:	48 89 e5             	mov    %rsp,%rbp
+  801899:	53                   	push   %rbx
+  80189a:	48 89 fa             	mov    %rdi,%rdx
+  80189d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018a0:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018af:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ba:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c0:	c9                   	leave
+  8018c1:	c3                   	ret
+
+00000000008018c2 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8018c2:	55                   	push   %rbp
+  8018c3:	48 89 e5             	mov    %rsp,%rbp
+  8018c6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c7:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018eb:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018f1:	c9                   	leave
+  8018f2:	c3                   	ret
+
+00000000008018f3 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8018f3:	48 85 ff             	test   %rdi,%rdi
+  8018f6:	0f 84 b6 01 00 00    	je     801ab2 <malloc+0x1bf>
+malloc(size_t size) {
+  8018fc:	55                   	push   %rbp
+  8018fd:	48 89 e5             	mov    %rsp,%rbp
+  801900:	41 56                	push   %r14
+  801902:	41 55                	push   %r13
+  801904:	41 54                	push   %r12
+  801906:	53                   	push   %rbx
+  801907:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80190a:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801911:	00 00 00 
+  801914:	4c 8b 20             	mov    (%rax),%r12
+  801917:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80191e:	0f 87 94 01 00 00    	ja     801ab8 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801924:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80192b:	00 00 00 
+  80192e:	48 85 c0             	test   %rax,%rax
+  801931:	74 6b                	je     80199e <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801933:	4d 85 e4             	test   %r12,%r12
+  801936:	74 66                	je     80199e <malloc+0xab>
+  801938:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80193f:	00 00 00 
+  801942:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801947:	eb 0d                	jmp    801956 <malloc+0x63>
+  801949:	48 83 c1 01          	add    $0x1,%rcx
+  80194d:	48 83 c2 18          	add    $0x18,%rdx
+  801951:	49 39 cc             	cmp    %rcx,%r12
+  801954:	74 48                	je     80199e <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801956:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80195b:	74 ec                	je     801949 <malloc+0x56>
+  80195d:	48 39 1a             	cmp    %rbx,(%rdx)
+  801960:	72 e7                	jb     801949 <malloc+0x56>
+                real_freep_size--;
+  801962:	48 83 e8 01          	sub    $0x1,%rax
+  801966:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80196d:	00 00 00 
+                freep[i].is_free = false;
+  801970:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801977:	00 00 00 
+  80197a:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80197e:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801982:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801986:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  80198d:	00 
+                freep[i].size = size;
+  80198e:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801992:	48 01 c8             	add    %rcx,%rax
+  801995:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801999:	e9 0b 01 00 00       	jmp    801aa9 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  80199e:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8019a5:	00 00 00 
+  8019a8:	48 01 d8             	add    %rbx,%rax
+  8019ab:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8019b1:	76 7c                	jbe    801a2f <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8019b3:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8019ba:	00 00 00 
+  8019bd:	4c 8b 30             	mov    (%rax),%r14
+  8019c0:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8019c7:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8019ca:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8019d1:	00 00 00 
+  8019d4:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8019db:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8019e2:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8019e8:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8019ec:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  8019f3:	00 00 00 
+  8019f6:	ff d0                	call   *%rax
+  8019f8:	89 c7                	mov    %eax,%edi
+  8019fa:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801a01:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801a08:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801a0f:	00 00 00 
+  801a12:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801a16:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801a1b:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  801a22:	00 00 00 
+  801a25:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801a27:	85 c0                	test   %eax,%eax
+  801a29:	0f 88 90 00 00 00    	js     801abf <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801a2f:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801a36:	00 00 00 
+  801a39:	48 8b 31             	mov    (%rcx),%rsi
+  801a3c:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801a43:	00 00 00 
+  801a46:	4c 8b 07             	mov    (%rdi),%r8
+  801a49:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801a4d:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801a54:	00 00 00 
+  801a57:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801a5b:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801a5f:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801a66:	00 00 00 
+  801a69:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801a6d:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801a70:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801a74:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801a7b:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801a7c:	48 89 d8             	mov    %rbx,%rax
+  801a7f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a84:	4c 01 c0             	add    %r8,%rax
+  801a87:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801a8a:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801a91:	48 01 f3             	add    %rsi,%rbx
+  801a94:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801a97:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801a9c:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801aa3:	00 00 00 
+  801aa6:	48 89 d0             	mov    %rdx,%rax
+}
+  801aa9:	5b                   	pop    %rbx
+  801aaa:	41 5c                	pop    %r12
+  801aac:	41 5d                	pop    %r13
+  801aae:	41 5e                	pop    %r14
+  801ab0:	5d                   	pop    %rbp
+  801ab1:	c3                   	ret
+        return NULL;
+  801ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ab7:	c3                   	ret
+        return NULL;
+  801ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abd:	eb ea                	jmp    801aa9 <malloc+0x1b6>
+            return NULL;
+  801abf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac4:	eb e3                	jmp    801aa9 <malloc+0x1b6>
+
+0000000000801ac6 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801ac6:	55                   	push   %rbp
+  801ac7:	48 89 e5             	mov    %rsp,%rbp
+  801aca:	53                   	push   %rbx
+  801acb:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801acf:	48 89 fb             	mov    %rdi,%rbx
+  801ad2:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801ad6:	48 89 df             	mov    %rbx,%rdi
+  801ad9:	48 b8 f3 18 80 00 00 	movabs $0x8018f3,%rax
+  801ae0:	00 00 00 
+  801ae3:	ff d0                	call   *%rax
+  801ae5:	48 89 c7             	mov    %rax,%rdi
+  801ae8:	48 89 da             	mov    %rbx,%rdx
+  801aeb:	be 00 00 00 00       	mov    $0x0,%esi
+  801af0:	48 b8 ff 0f 80 00 00 	movabs $0x800fff,%rax
+  801af7:	00 00 00 
+  801afa:	ff d0                	call   *%rax
+}
+  801afc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b00:	c9                   	leave
+  801b01:	c3                   	ret
+
+0000000000801b02 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801b02:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801b09:	00 00 00 
+  801b0c:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801b13:	00 00 00 
+  801b16:	48 3b 02             	cmp    (%rdx),%rax
+  801b19:	74 4d                	je     801b68 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801b1b:	48 85 c0             	test   %rax,%rax
+  801b1e:	74 4d                	je     801b6d <get_allocsize+0x6b>
+  801b20:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801b27:	00 00 00 
+  801b2a:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801b2f:	48 3b 39             	cmp    (%rcx),%rdi
+  801b32:	74 13                	je     801b47 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801b34:	48 83 c2 01          	add    $0x1,%rdx
+  801b38:	48 83 c1 18          	add    $0x18,%rcx
+  801b3c:	48 39 d0             	cmp    %rdx,%rax
+  801b3f:	75 ee                	jne    801b2f <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801b41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b46:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801b47:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b50:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801b57:	00 00 00 
+  801b5a:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b60:	75 0b                	jne    801b6d <get_allocsize+0x6b>
+  801b62:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801b67:	c3                   	ret
+        return 0;
+  801b68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b6d:	c3                   	ret
+
+0000000000801b6e <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801b6e:	48 85 ff             	test   %rdi,%rdi
+  801b71:	0f 84 01 01 00 00    	je     801c78 <free+0x10a>
+free(void *ptr) {
+  801b77:	55                   	push   %rbp
+  801b78:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801b7b:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801b82:	00 00 00 
+  801b85:	48 8b 30             	mov    (%rax),%rsi
+  801b88:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801b8f:	00 00 00 
+  801b92:	48 39 c6             	cmp    %rax,%rsi
+  801b95:	74 50                	je     801be7 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801b97:	48 85 f6             	test   %rsi,%rsi
+  801b9a:	74 21                	je     801bbd <free+0x4f>
+  801b9c:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801ba3:	00 00 00 
+  801ba6:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801bab:	48 3b 39             	cmp    (%rcx),%rdi
+  801bae:	74 61                	je     801c11 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801bb0:	48 83 c2 01          	add    $0x1,%rdx
+  801bb4:	48 83 c1 18          	add    $0x18,%rcx
+  801bb8:	48 39 d6             	cmp    %rdx,%rsi
+  801bbb:	75 ee                	jne    801bab <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801bbd:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  801bc4:	00 00 00 
+  801bc7:	be 12 01 00 00       	mov    $0x112,%esi
+  801bcc:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801bd3:	00 00 00 
+  801bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdb:	48 b9 57 02 80 00 00 	movabs $0x800257,%rcx
+  801be2:	00 00 00 
+  801be5:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801be7:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801bee:	00 00 00 
+  801bf1:	be 06 01 00 00       	mov    $0x106,%esi
+  801bf6:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801bfd:	00 00 00 
+  801c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c05:	48 b9 57 02 80 00 00 	movabs $0x800257,%rcx
+  801c0c:	00 00 00 
+  801c0f:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801c11:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c15:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801c1c:	00 00 00 
+  801c1f:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801c25:	75 27                	jne    801c4e <free+0xe0>
+            freep[i].is_free = true;
+  801c27:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c2b:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801c32:	00 00 00 
+  801c35:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801c3c:	00 00 
+            real_freep_size++;
+  801c3e:	48 83 c0 01          	add    $0x1,%rax
+  801c42:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801c49:	00 00 00 
+}
+  801c4c:	5d                   	pop    %rbp
+  801c4d:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801c4e:	48 ba a8 55 80 00 00 	movabs $0x8055a8,%rdx
+  801c55:	00 00 00 
+  801c58:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801c5d:	48 bf f8 55 80 00 00 	movabs $0x8055f8,%rdi
+  801c64:	00 00 00 
+  801c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6c:	48 b9 57 02 80 00 00 	movabs $0x800257,%rcx
+  801c73:	00 00 00 
+  801c76:	ff d1                	call   *%rcx
+  801c78:	c3                   	ret
+
+0000000000801c79 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801c79:	55                   	push   %rbp
+  801c7a:	48 89 e5             	mov    %rsp,%rbp
+  801c7d:	41 55                	push   %r13
+  801c7f:	41 54                	push   %r12
+  801c81:	53                   	push   %rbx
+  801c82:	48 83 ec 08          	sub    $0x8,%rsp
+  801c86:	48 89 fb             	mov    %rdi,%rbx
+  801c89:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801c8c:	48 b8 02 1b 80 00 00 	movabs $0x801b02,%rax
+  801c93:	00 00 00 
+  801c96:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801c98:	49 39 c5             	cmp    %rax,%r13
+  801c9b:	73 0e                	jae    801cab <realloc+0x32>
+}
+  801c9d:	48 89 d8             	mov    %rbx,%rax
+  801ca0:	48 83 c4 08          	add    $0x8,%rsp
+  801ca4:	5b                   	pop    %rbx
+  801ca5:	41 5c                	pop    %r12
+  801ca7:	41 5d                	pop    %r13
+  801ca9:	5d                   	pop    %rbp
+  801caa:	c3                   	ret
+  801cab:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801cae:	4c 89 ef             	mov    %r13,%rdi
+  801cb1:	48 b8 f3 18 80 00 00 	movabs $0x8018f3,%rax
+  801cb8:	00 00 00 
+  801cbb:	ff d0                	call   *%rax
+  801cbd:	48 89 c7             	mov    %rax,%rdi
+  801cc0:	4c 89 e2             	mov    %r12,%rdx
+  801cc3:	48 89 de             	mov    %rbx,%rsi
+  801cc6:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  801ccd:	00 00 00 
+  801cd0:	ff d0                	call   *%rax
+  801cd2:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801cd5:	48 89 df             	mov    %rbx,%rdi
+  801cd8:	48 b8 6e 1b 80 00 00 	movabs $0x801b6e,%rax
+  801cdf:	00 00 00 
+  801ce2:	ff d0                	call   *%rax
+    return newptr;
+  801ce4:	4c 89 e3             	mov    %r12,%rbx
+  801ce7:	eb b4                	jmp    801c9d <realloc+0x24>
+
+0000000000801ce9 <strdup>:
+
+char*
+strdup (const char *src) {
+  801ce9:	55                   	push   %rbp
+  801cea:	48 89 e5             	mov    %rsp,%rbp
+  801ced:	41 54                	push   %r12
+  801cef:	53                   	push   %rbx
+  801cf0:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801cf3:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  801cfa:	00 00 00 
+  801cfd:	ff d0                	call   *%rax
+  801cff:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801d03:	4c 89 e7             	mov    %r12,%rdi
+  801d06:	48 b8 f3 18 80 00 00 	movabs $0x8018f3,%rax
+  801d0d:	00 00 00 
+  801d10:	ff d0                	call   *%rax
+  801d12:	48 89 c7             	mov    %rax,%rdi
+  801d15:	4c 89 e2             	mov    %r12,%rdx
+  801d18:	48 89 de             	mov    %rbx,%rsi
+  801d1b:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  801d22:	00 00 00 
+  801d25:	ff d0                	call   *%rax
+}
+  801d27:	5b                   	pop    %rbx
+  801d28:	41 5c                	pop    %r12
+  801d2a:	5d                   	pop    %rbp
+  801d2b:	c3                   	ret
+
+0000000000801d2c <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801d2c:	55                   	push   %rbp
+  801d2d:	48 89 e5             	mov    %rsp,%rbp
+  801d30:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d31:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d45:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d4a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d55:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d57:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d5b:	c9                   	leave
+  801d5c:	c3                   	ret
+
+0000000000801d5d <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801d5d:	55                   	push   %rbp
+  801d5e:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801d61:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d68:	00 00 00 
+  801d6b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d6f:	74 26                	je     801d97 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801d71:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d73:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d77:	89 c0                	mov    %eax,%eax
+  801d79:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801d7c:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801d83:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801d8a:	00 00 00 
+  801d8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d92:	48 f7 31             	divq   (%rcx)
+}
+  801d95:	5d                   	pop    %rbp
+  801d96:	c3                   	ret
+        freq = get_cpufreq();
+  801d97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9c:	48 ba 2c 1d 80 00 00 	movabs $0x801d2c,%rdx
+  801da3:	00 00 00 
+  801da6:	ff d2                	call   *%rdx
+  801da8:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801daf:	00 00 00 
+  801db2:	eb bd                	jmp    801d71 <get_ticks+0x14>
+
+0000000000801db4 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801db4:	55                   	push   %rbp
+  801db5:	48 89 e5             	mov    %rsp,%rbp
+  801db8:	53                   	push   %rbx
+  801db9:	48 83 ec 08          	sub    $0x8,%rsp
+  801dbd:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801dc0:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801dc7:	00 00 00 
+  801dca:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801dce:	74 50                	je     801e20 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801dd0:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801dd2:	48 c1 e2 20          	shl    $0x20,%rdx
+  801dd6:	89 c0                	mov    %eax,%eax
+  801dd8:	48 89 d6             	mov    %rdx,%rsi
+  801ddb:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801dde:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801de5:	00 00 00 
+  801de8:	48 0f af 18          	imul   (%rax),%rbx
+  801dec:	48 c1 eb 03          	shr    $0x3,%rbx
+  801df0:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801df7:	9b c4 20 
+  801dfa:	48 89 d8             	mov    %rbx,%rax
+  801dfd:	48 f7 e2             	mul    %rdx
+  801e00:	48 89 d1             	mov    %rdx,%rcx
+  801e03:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801e07:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801e09:	48 c1 e2 20          	shl    $0x20,%rdx
+  801e0d:	89 c0                	mov    %eax,%eax
+  801e0f:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801e12:	48 29 f2             	sub    %rsi,%rdx
+  801e15:	48 39 ca             	cmp    %rcx,%rdx
+  801e18:	72 ed                	jb     801e07 <sleep+0x53>
+}
+  801e1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e1e:	c9                   	leave
+  801e1f:	c3                   	ret
+        freq = get_cpufreq();
+  801e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e25:	48 ba 2c 1d 80 00 00 	movabs $0x801d2c,%rdx
+  801e2c:	00 00 00 
+  801e2f:	ff d2                	call   *%rdx
+  801e31:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801e38:	00 00 00 
+  801e3b:	eb 93                	jmp    801dd0 <sleep+0x1c>
+
+0000000000801e3d <poll_kbd>:
+
+int poll_kbd() {
+  801e3d:	55                   	push   %rbp
+  801e3e:	48 89 e5             	mov    %rsp,%rbp
+  801e41:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e42:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e56:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e5b:	be 00 00 00 00       	mov    $0x0,%esi
+  801e60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e66:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e6c:	c9                   	leave
+  801e6d:	c3                   	ret
+
+0000000000801e6e <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801e6e:	55                   	push   %rbp
+  801e6f:	48 89 e5             	mov    %rsp,%rbp
+  801e72:	53                   	push   %rbx
+  801e73:	49 89 fa             	mov    %rdi,%r10
+  801e76:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801e78:	44 89 c6             	mov    %r8d,%esi
+  801e7b:	89 cf                	mov    %ecx,%edi
+  801e7d:	89 d3                	mov    %edx,%ebx
+  801e7f:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801e81:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e86:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e89:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801e8d:	cd 30                	int    $0x30
+  801e8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e93:	c9                   	leave
+  801e94:	c3                   	ret
+
+0000000000801e95 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801e95:	55                   	push   %rbp
+  801e96:	48 89 e5             	mov    %rsp,%rbp
+  801e99:	41 54                	push   %r12
+  801e9b:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  801e9c:	48 b8 f1 38 80 00 00 	movabs $0x8038f1,%rax
+  801ea3:	00 00 00 
+  801ea6:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801ea8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801ead:	cd 30                	int    $0x30
+  801eaf:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801eb2:	85 c0                	test   %eax,%eax
+  801eb4:	78 76                	js     801f2c <fork+0x97>
+        return envid;
+    if (!envid) {
+  801eb6:	74 7c                	je     801f34 <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801eb8:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801ebe:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801ec5:	00 00 00 
+  801ec8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ecd:	89 c2                	mov    %eax,%edx
+  801ecf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ed9:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  801ee0:	00 00 00 
+  801ee3:	ff d0                	call   *%rax
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	75 7c                	jne    801f65 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801ee9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801ef0:	00 00 00 
+  801ef3:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801efa:	44 89 e7             	mov    %r12d,%edi
+  801efd:	48 b8 97 17 80 00 00 	movabs $0x801797,%rax
+  801f04:	00 00 00 
+  801f07:	ff d0                	call   *%rax
+  801f09:	85 c0                	test   %eax,%eax
+  801f0b:	75 60                	jne    801f6d <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  801f0d:	be 02 00 00 00       	mov    $0x2,%esi
+  801f12:	44 89 e7             	mov    %r12d,%edi
+  801f15:	48 b8 c5 16 80 00 00 	movabs $0x8016c5,%rax
+  801f1c:	00 00 00 
+  801f1f:	ff d0                	call   *%rax
+        return -1;
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801f28:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  801f2c:	44 89 e0             	mov    %r12d,%eax
+  801f2f:	5b                   	pop    %rbx
+  801f30:	41 5c                	pop    %r12
+  801f32:	5d                   	pop    %rbp
+  801f33:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801f34:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  801f3b:	00 00 00 
+  801f3e:	ff d0                	call   *%rax
+  801f40:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f45:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  801f4c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801f53:	00 00 00 
+  801f56:	48 01 d0             	add    %rdx,%rax
+  801f59:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  801f60:	00 00 00 
+        return 0;
+  801f63:	eb c7                	jmp    801f2c <fork+0x97>
+        return -1;
+  801f65:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801f6b:	eb bf                	jmp    801f2c <fork+0x97>
+  801f6d:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801f73:	eb b7                	jmp    801f2c <fork+0x97>
+
+0000000000801f75 <sfork>:
+
+envid_t
+sfork() {
+  801f75:	55                   	push   %rbp
+  801f76:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801f79:	48 ba 06 56 80 00 00 	movabs $0x805606,%rdx
+  801f80:	00 00 00 
+  801f83:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801f88:	48 bf 21 56 80 00 00 	movabs $0x805621,%rdi
+  801f8f:	00 00 00 
+  801f92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f97:	48 b9 57 02 80 00 00 	movabs $0x800257,%rcx
+  801f9e:	00 00 00 
+  801fa1:	ff d1                	call   *%rcx
+
+0000000000801fa3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801fa3:	55                   	push   %rbp
+  801fa4:	48 89 e5             	mov    %rsp,%rbp
+  801fa7:	41 55                	push   %r13
+  801fa9:	41 54                	push   %r12
+  801fab:	53                   	push   %rbx
+  801fac:	48 83 ec 08          	sub    $0x8,%rsp
+  801fb0:	49 89 fc             	mov    %rdi,%r12
+  801fb3:	48 89 f7             	mov    %rsi,%rdi
+  801fb6:	48 89 d3             	mov    %rdx,%rbx
+  801fb9:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  801fbc:	48 85 f6             	test   %rsi,%rsi
+  801fbf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801fc6:	00 00 00 
+  801fc9:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  801fcd:	be 00 10 00 00       	mov    $0x1000,%esi
+  801fd2:	48 85 d2             	test   %rdx,%rdx
+  801fd5:	74 03                	je     801fda <ipc_recv+0x37>
+  801fd7:	48 8b 32             	mov    (%rdx),%rsi
+  801fda:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  801fe1:	00 00 00 
+  801fe4:	ff d0                	call   *%rax
+    if (errno) {
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	74 1c                	je     802006 <ipc_recv+0x63>
+        if (from_env_store)
+  801fea:	4d 85 e4             	test   %r12,%r12
+  801fed:	74 08                	je     801ff7 <ipc_recv+0x54>
+            *from_env_store = 0;
+  801fef:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801ff6:	00 
+
+        if (perm_store)
+  801ff7:	4d 85 ed             	test   %r13,%r13
+  801ffa:	74 74                	je     802070 <ipc_recv+0xcd>
+            *perm_store = 0;
+  801ffc:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802003:	00 
+  802004:	eb 6a                	jmp    802070 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  802006:	4d 85 e4             	test   %r12,%r12
+  802009:	74 14                	je     80201f <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80200b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802012:	00 00 00 
+  802015:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80201b:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80201f:	48 85 db             	test   %rbx,%rbx
+  802022:	74 23                	je     802047 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  802024:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80202b:	00 00 00 
+  80202e:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  802034:	ba 00 00 00 00       	mov    $0x0,%edx
+  802039:	85 c9                	test   %ecx,%ecx
+  80203b:	74 07                	je     802044 <ipc_recv+0xa1>
+  80203d:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  802044:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  802047:	4d 85 ed             	test   %r13,%r13
+  80204a:	74 14                	je     802060 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80204c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802053:	00 00 00 
+  802056:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80205c:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  802060:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802067:	00 00 00 
+  80206a:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  802070:	48 83 c4 08          	add    $0x8,%rsp
+  802074:	5b                   	pop    %rbx
+  802075:	41 5c                	pop    %r12
+  802077:	41 5d                	pop    %r13
+  802079:	5d                   	pop    %rbp
+  80207a:	c3                   	ret
+
+000000000080207b <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80207b:	55                   	push   %rbp
+  80207c:	48 89 e5             	mov    %rsp,%rbp
+  80207f:	41 55                	push   %r13
+  802081:	41 54                	push   %r12
+  802083:	53                   	push   %rbx
+  802084:	48 83 ec 08          	sub    $0x8,%rsp
+  802088:	49 89 fc             	mov    %rdi,%r12
+  80208b:	48 89 f7             	mov    %rsi,%rdi
+  80208e:	48 89 d3             	mov    %rdx,%rbx
+  802091:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  802094:	48 85 f6             	test   %rsi,%rsi
+  802097:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80209e:	00 00 00 
+  8020a1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8020a5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8020aa:	48 85 d2             	test   %rdx,%rdx
+  8020ad:	74 03                	je     8020b2 <ipc_try_recv+0x37>
+  8020af:	48 8b 32             	mov    (%rdx),%rsi
+  8020b2:	48 b8 95 18 80 00 00 	movabs $0x801895,%rax
+  8020b9:	00 00 00 
+  8020bc:	ff d0                	call   *%rax
+    if (errno) {
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	75 75                	jne    802137 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8020c2:	4d 85 e4             	test   %r12,%r12
+  8020c5:	74 14                	je     8020db <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8020c7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020ce:	00 00 00 
+  8020d1:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8020d7:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8020db:	48 85 db             	test   %rbx,%rbx
+  8020de:	74 23                	je     802103 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8020e0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020e7:	00 00 00 
+  8020ea:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8020f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f5:	85 c9                	test   %ecx,%ecx
+  8020f7:	74 07                	je     802100 <ipc_try_recv+0x85>
+  8020f9:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  802100:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  802103:	4d 85 ed             	test   %r13,%r13
+  802106:	74 14                	je     80211c <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  802108:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80210f:	00 00 00 
+  802112:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  802118:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80211c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802123:	00 00 00 
+  802126:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80212c:	48 83 c4 08          	add    $0x8,%rsp
+  802130:	5b                   	pop    %rbx
+  802131:	41 5c                	pop    %r12
+  802133:	41 5d                	pop    %r13
+  802135:	5d                   	pop    %rbp
+  802136:	c3                   	ret
+        if (from_env_store)
+  802137:	4d 85 e4             	test   %r12,%r12
+  80213a:	74 08                	je     802144 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80213c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802143:	00 
+        if (perm_store)
+  802144:	4d 85 ed             	test   %r13,%r13
+  802147:	74 e3                	je     80212c <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  802149:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802150:	00 
+  802151:	eb d9                	jmp    80212c <ipc_try_recv+0xb1>
+
+0000000000802153 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802153:	55                   	push   %rbp
+  802154:	48 89 e5             	mov    %rsp,%rbp
+  802157:	41 57                	push   %r15
+  802159:	41 56                	push   %r14
+  80215b:	41 55                	push   %r13
+  80215d:	41 54                	push   %r12
+  80215f:	53                   	push   %rbx
+  802160:	48 83 ec 18          	sub    $0x18,%rsp
+  802164:	41 89 fd             	mov    %edi,%r13d
+  802167:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80216a:	48 89 d3             	mov    %rdx,%rbx
+  80216d:	49 89 cc             	mov    %rcx,%r12
+  802170:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  802174:	48 85 d2             	test   %rdx,%rdx
+  802177:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80217e:	00 00 00 
+  802181:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  802185:	49 be 00 18 80 00 00 	movabs $0x801800,%r14
+  80218c:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  80218f:	49 bf f0 13 80 00 00 	movabs $0x8013f0,%r15
+  802196:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  802199:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80219c:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8021a0:	4c 89 e1             	mov    %r12,%rcx
+  8021a3:	48 89 da             	mov    %rbx,%rdx
+  8021a6:	44 89 ef             	mov    %r13d,%edi
+  8021a9:	41 ff d6             	call   *%r14
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	74 37                	je     8021e7 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8021b0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8021b3:	75 05                	jne    8021ba <ipc_send+0x67>
+        sys_yield();
+  8021b5:	41 ff d7             	call   *%r15
+  8021b8:	eb df                	jmp    802199 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8021ba:	89 c1                	mov    %eax,%ecx
+  8021bc:	48 ba 2c 56 80 00 00 	movabs $0x80562c,%rdx
+  8021c3:	00 00 00 
+  8021c6:	be 65 00 00 00       	mov    $0x65,%esi
+  8021cb:	48 bf 47 56 80 00 00 	movabs $0x805647,%rdi
+  8021d2:	00 00 00 
+  8021d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021da:	49 b8 57 02 80 00 00 	movabs $0x800257,%r8
+  8021e1:	00 00 00 
+  8021e4:	41 ff d0             	call   *%r8
+    }
+}
+  8021e7:	48 83 c4 18          	add    $0x18,%rsp
+  8021eb:	5b                   	pop    %rbx
+  8021ec:	41 5c                	pop    %r12
+  8021ee:	41 5d                	pop    %r13
+  8021f0:	41 5e                	pop    %r14
+  8021f2:	41 5f                	pop    %r15
+  8021f4:	5d                   	pop    %rbp
+  8021f5:	c3                   	ret
+
+00000000008021f6 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8021f6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8021fb:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802202:	00 00 00 
+  802205:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80220c:	48 01 ca             	add    %rcx,%rdx
+  80220f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802215:	39 fa                	cmp    %edi,%edx
+  802217:	74 12                	je     80222b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802219:	48 83 c0 01          	add    $0x1,%rax
+  80221d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802223:	75 e0                	jne    802205 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802225:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222a:	c3                   	ret
+            return envs[i].env_id;
+  80222b:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  802232:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802239:	00 00 00 
+  80223c:	48 01 d0             	add    %rdx,%rax
+  80223f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802245:	c3                   	ret
+
+0000000000802246 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802246:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80224d:	ff ff ff 
+  802250:	48 01 f8             	add    %rdi,%rax
+  802253:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802257:	c3                   	ret
+
+0000000000802258 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802258:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80225f:	ff ff ff 
+  802262:	48 01 f8             	add    %rdi,%rax
+  802265:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802269:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80226f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802273:	c3                   	ret
+
+0000000000802274 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802274:	55                   	push   %rbp
+  802275:	48 89 e5             	mov    %rsp,%rbp
+  802278:	41 57                	push   %r15
+  80227a:	41 56                	push   %r14
+  80227c:	41 55                	push   %r13
+  80227e:	41 54                	push   %r12
+  802280:	53                   	push   %rbx
+  802281:	48 83 ec 08          	sub    $0x8,%rsp
+  802285:	49 89 ff             	mov    %rdi,%r15
+  802288:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80228d:	49 bd 28 41 80 00 00 	movabs $0x804128,%r13
+  802294:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802297:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80229d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8022a0:	48 89 df             	mov    %rbx,%rdi
+  8022a3:	41 ff d5             	call   *%r13
+  8022a6:	83 e0 04             	and    $0x4,%eax
+  8022a9:	74 17                	je     8022c2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8022ab:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8022b2:	4c 39 f3             	cmp    %r14,%rbx
+  8022b5:	75 e6                	jne    80229d <fd_alloc+0x29>
+  8022b7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8022bd:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8022c2:	4d 89 27             	mov    %r12,(%r15)
+}
+  8022c5:	48 83 c4 08          	add    $0x8,%rsp
+  8022c9:	5b                   	pop    %rbx
+  8022ca:	41 5c                	pop    %r12
+  8022cc:	41 5d                	pop    %r13
+  8022ce:	41 5e                	pop    %r14
+  8022d0:	41 5f                	pop    %r15
+  8022d2:	5d                   	pop    %rbp
+  8022d3:	c3                   	ret
+
+00000000008022d4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8022d4:	83 ff 1f             	cmp    $0x1f,%edi
+  8022d7:	77 39                	ja     802312 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8022d9:	55                   	push   %rbp
+  8022da:	48 89 e5             	mov    %rsp,%rbp
+  8022dd:	41 54                	push   %r12
+  8022df:	53                   	push   %rbx
+  8022e0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8022e3:	48 63 df             	movslq %edi,%rbx
+  8022e6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8022ed:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8022f1:	48 89 df             	mov    %rbx,%rdi
+  8022f4:	48 b8 28 41 80 00 00 	movabs $0x804128,%rax
+  8022fb:	00 00 00 
+  8022fe:	ff d0                	call   *%rax
+  802300:	a8 04                	test   $0x4,%al
+  802302:	74 14                	je     802318 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802304:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802308:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80230d:	5b                   	pop    %rbx
+  80230e:	41 5c                	pop    %r12
+  802310:	5d                   	pop    %rbp
+  802311:	c3                   	ret
+        return -E_INVAL;
+  802312:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802317:	c3                   	ret
+        return -E_INVAL;
+  802318:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80231d:	eb ee                	jmp    80230d <fd_lookup+0x39>
+
+000000000080231f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80231f:	55                   	push   %rbp
+  802320:	48 89 e5             	mov    %rsp,%rbp
+  802323:	41 54                	push   %r12
+  802325:	53                   	push   %rbx
+  802326:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802329:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  802330:	00 00 00 
+  802333:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80233a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80233d:	39 3b                	cmp    %edi,(%rbx)
+  80233f:	74 47                	je     802388 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802341:	48 83 c0 08          	add    $0x8,%rax
+  802345:	48 8b 18             	mov    (%rax),%rbx
+  802348:	48 85 db             	test   %rbx,%rbx
+  80234b:	75 f0                	jne    80233d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80234d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802354:	00 00 00 
+  802357:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80235d:	89 fa                	mov    %edi,%edx
+  80235f:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  802366:	00 00 00 
+  802369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236e:	48 b9 a7 03 80 00 00 	movabs $0x8003a7,%rcx
+  802375:	00 00 00 
+  802378:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80237a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80237f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802383:	5b                   	pop    %rbx
+  802384:	41 5c                	pop    %r12
+  802386:	5d                   	pop    %rbp
+  802387:	c3                   	ret
+            return 0;
+  802388:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238d:	eb f0                	jmp    80237f <dev_lookup+0x60>
+
+000000000080238f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80238f:	55                   	push   %rbp
+  802390:	48 89 e5             	mov    %rsp,%rbp
+  802393:	41 55                	push   %r13
+  802395:	41 54                	push   %r12
+  802397:	53                   	push   %rbx
+  802398:	48 83 ec 18          	sub    $0x18,%rsp
+  80239c:	48 89 fb             	mov    %rdi,%rbx
+  80239f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8023a2:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8023a9:	ff ff ff 
+  8023ac:	48 01 df             	add    %rbx,%rdi
+  8023af:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8023b3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023b7:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  8023be:	00 00 00 
+  8023c1:	ff d0                	call   *%rax
+  8023c3:	41 89 c5             	mov    %eax,%r13d
+  8023c6:	85 c0                	test   %eax,%eax
+  8023c8:	78 06                	js     8023d0 <fd_close+0x41>
+  8023ca:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8023ce:	74 1a                	je     8023ea <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8023d0:	45 84 e4             	test   %r12b,%r12b
+  8023d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8023dc:	44 89 e8             	mov    %r13d,%eax
+  8023df:	48 83 c4 18          	add    $0x18,%rsp
+  8023e3:	5b                   	pop    %rbx
+  8023e4:	41 5c                	pop    %r12
+  8023e6:	41 5d                	pop    %r13
+  8023e8:	5d                   	pop    %rbp
+  8023e9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8023ea:	8b 3b                	mov    (%rbx),%edi
+  8023ec:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023f0:	48 b8 1f 23 80 00 00 	movabs $0x80231f,%rax
+  8023f7:	00 00 00 
+  8023fa:	ff d0                	call   *%rax
+  8023fc:	41 89 c5             	mov    %eax,%r13d
+  8023ff:	85 c0                	test   %eax,%eax
+  802401:	78 1b                	js     80241e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802403:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802407:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80240b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802411:	48 85 c0             	test   %rax,%rax
+  802414:	74 08                	je     80241e <fd_close+0x8f>
+  802416:	48 89 df             	mov    %rbx,%rdi
+  802419:	ff d0                	call   *%rax
+  80241b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80241e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802423:	48 89 de             	mov    %rbx,%rsi
+  802426:	bf 00 00 00 00       	mov    $0x0,%edi
+  80242b:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  802432:	00 00 00 
+  802435:	ff d0                	call   *%rax
+    return res;
+  802437:	eb a3                	jmp    8023dc <fd_close+0x4d>
+
+0000000000802439 <close>:
+
+int
+close(int fdnum) {
+  802439:	55                   	push   %rbp
+  80243a:	48 89 e5             	mov    %rsp,%rbp
+  80243d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802441:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802445:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  80244c:	00 00 00 
+  80244f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802451:	85 c0                	test   %eax,%eax
+  802453:	78 15                	js     80246a <close+0x31>
+
+    return fd_close(fd, 1);
+  802455:	be 01 00 00 00       	mov    $0x1,%esi
+  80245a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80245e:	48 b8 8f 23 80 00 00 	movabs $0x80238f,%rax
+  802465:	00 00 00 
+  802468:	ff d0                	call   *%rax
+}
+  80246a:	c9                   	leave
+  80246b:	c3                   	ret
+
+000000000080246c <close_all>:
+
+void
+close_all(void) {
+  80246c:	55                   	push   %rbp
+  80246d:	48 89 e5             	mov    %rsp,%rbp
+  802470:	41 54                	push   %r12
+  802472:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802473:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802478:	49 bc 39 24 80 00 00 	movabs $0x802439,%r12
+  80247f:	00 00 00 
+  802482:	89 df                	mov    %ebx,%edi
+  802484:	41 ff d4             	call   *%r12
+  802487:	83 c3 01             	add    $0x1,%ebx
+  80248a:	83 fb 20             	cmp    $0x20,%ebx
+  80248d:	75 f3                	jne    802482 <close_all+0x16>
+}
+  80248f:	5b                   	pop    %rbx
+  802490:	41 5c                	pop    %r12
+  802492:	5d                   	pop    %rbp
+  802493:	c3                   	ret
+
+0000000000802494 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802494:	55                   	push   %rbp
+  802495:	48 89 e5             	mov    %rsp,%rbp
+  802498:	41 57                	push   %r15
+  80249a:	41 56                	push   %r14
+  80249c:	41 55                	push   %r13
+  80249e:	41 54                	push   %r12
+  8024a0:	53                   	push   %rbx
+  8024a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8024a5:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8024a8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8024ac:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+  8024b8:	89 c3                	mov    %eax,%ebx
+  8024ba:	85 c0                	test   %eax,%eax
+  8024bc:	0f 88 b8 00 00 00    	js     80257a <dup+0xe6>
+    close(newfdnum);
+  8024c2:	44 89 e7             	mov    %r12d,%edi
+  8024c5:	48 b8 39 24 80 00 00 	movabs $0x802439,%rax
+  8024cc:	00 00 00 
+  8024cf:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8024d1:	4d 63 ec             	movslq %r12d,%r13
+  8024d4:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8024db:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8024df:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8024e3:	4c 89 ff             	mov    %r15,%rdi
+  8024e6:	49 be 58 22 80 00 00 	movabs $0x802258,%r14
+  8024ed:	00 00 00 
+  8024f0:	41 ff d6             	call   *%r14
+  8024f3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8024f6:	4c 89 ef             	mov    %r13,%rdi
+  8024f9:	41 ff d6             	call   *%r14
+  8024fc:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8024ff:	48 89 df             	mov    %rbx,%rdi
+  802502:	48 b8 28 41 80 00 00 	movabs $0x804128,%rax
+  802509:	00 00 00 
+  80250c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80250e:	a8 04                	test   $0x4,%al
+  802510:	74 2b                	je     80253d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802512:	41 89 c1             	mov    %eax,%r9d
+  802515:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80251b:	4c 89 f1             	mov    %r14,%rcx
+  80251e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802523:	48 89 de             	mov    %rbx,%rsi
+  802526:	bf 00 00 00 00       	mov    $0x0,%edi
+  80252b:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  802532:	00 00 00 
+  802535:	ff d0                	call   *%rax
+  802537:	89 c3                	mov    %eax,%ebx
+  802539:	85 c0                	test   %eax,%eax
+  80253b:	78 4e                	js     80258b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80253d:	4c 89 ff             	mov    %r15,%rdi
+  802540:	48 b8 28 41 80 00 00 	movabs $0x804128,%rax
+  802547:	00 00 00 
+  80254a:	ff d0                	call   *%rax
+  80254c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80254f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802555:	4c 89 e9             	mov    %r13,%rcx
+  802558:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255d:	4c 89 fe             	mov    %r15,%rsi
+  802560:	bf 00 00 00 00       	mov    $0x0,%edi
+  802565:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  80256c:	00 00 00 
+  80256f:	ff d0                	call   *%rax
+  802571:	89 c3                	mov    %eax,%ebx
+  802573:	85 c0                	test   %eax,%eax
+  802575:	78 14                	js     80258b <dup+0xf7>
+
+    return newfdnum;
+  802577:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80257a:	89 d8                	mov    %ebx,%eax
+  80257c:	48 83 c4 18          	add    $0x18,%rsp
+  802580:	5b                   	pop    %rbx
+  802581:	41 5c                	pop    %r12
+  802583:	41 5d                	pop    %r13
+  802585:	41 5e                	pop    %r14
+  802587:	41 5f                	pop    %r15
+  802589:	5d                   	pop    %rbp
+  80258a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80258b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802590:	4c 89 ee             	mov    %r13,%rsi
+  802593:	bf 00 00 00 00       	mov    $0x0,%edi
+  802598:	49 bc 5e 16 80 00 00 	movabs $0x80165e,%r12
+  80259f:	00 00 00 
+  8025a2:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8025a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025aa:	4c 89 f6             	mov    %r14,%rsi
+  8025ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025b2:	41 ff d4             	call   *%r12
+    return res;
+  8025b5:	eb c3                	jmp    80257a <dup+0xe6>
+
+00000000008025b7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8025b7:	55                   	push   %rbp
+  8025b8:	48 89 e5             	mov    %rsp,%rbp
+  8025bb:	41 56                	push   %r14
+  8025bd:	41 55                	push   %r13
+  8025bf:	41 54                	push   %r12
+  8025c1:	53                   	push   %rbx
+  8025c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8025c6:	89 fb                	mov    %edi,%ebx
+  8025c8:	49 89 f4             	mov    %rsi,%r12
+  8025cb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025ce:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025d2:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  8025d9:	00 00 00 
+  8025dc:	ff d0                	call   *%rax
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	78 4c                	js     80262e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025e2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8025e6:	41 8b 3e             	mov    (%r14),%edi
+  8025e9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025ed:	48 b8 1f 23 80 00 00 	movabs $0x80231f,%rax
+  8025f4:	00 00 00 
+  8025f7:	ff d0                	call   *%rax
+  8025f9:	85 c0                	test   %eax,%eax
+  8025fb:	78 35                	js     802632 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8025fd:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802601:	83 e0 03             	and    $0x3,%eax
+  802604:	83 f8 01             	cmp    $0x1,%eax
+  802607:	74 2d                	je     802636 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802609:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80260d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802611:	48 85 c0             	test   %rax,%rax
+  802614:	74 56                	je     80266c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802616:	4c 89 ea             	mov    %r13,%rdx
+  802619:	4c 89 e6             	mov    %r12,%rsi
+  80261c:	4c 89 f7             	mov    %r14,%rdi
+  80261f:	ff d0                	call   *%rax
+}
+  802621:	48 83 c4 10          	add    $0x10,%rsp
+  802625:	5b                   	pop    %rbx
+  802626:	41 5c                	pop    %r12
+  802628:	41 5d                	pop    %r13
+  80262a:	41 5e                	pop    %r14
+  80262c:	5d                   	pop    %rbp
+  80262d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80262e:	48 98                	cltq
+  802630:	eb ef                	jmp    802621 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802632:	48 98                	cltq
+  802634:	eb eb                	jmp    802621 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802636:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80263d:	00 00 00 
+  802640:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802646:	89 da                	mov    %ebx,%edx
+  802648:	48 bf 99 56 80 00 00 	movabs $0x805699,%rdi
+  80264f:	00 00 00 
+  802652:	b8 00 00 00 00       	mov    $0x0,%eax
+  802657:	48 b9 a7 03 80 00 00 	movabs $0x8003a7,%rcx
+  80265e:	00 00 00 
+  802661:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802663:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80266a:	eb b5                	jmp    802621 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80266c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802673:	eb ac                	jmp    802621 <read+0x6a>
+
+0000000000802675 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802675:	55                   	push   %rbp
+  802676:	48 89 e5             	mov    %rsp,%rbp
+  802679:	41 57                	push   %r15
+  80267b:	41 56                	push   %r14
+  80267d:	41 55                	push   %r13
+  80267f:	41 54                	push   %r12
+  802681:	53                   	push   %rbx
+  802682:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802686:	48 85 d2             	test   %rdx,%rdx
+  802689:	74 54                	je     8026df <readn+0x6a>
+  80268b:	41 89 fd             	mov    %edi,%r13d
+  80268e:	49 89 f6             	mov    %rsi,%r14
+  802691:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802694:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802699:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80269e:	49 bf b7 25 80 00 00 	movabs $0x8025b7,%r15
+  8026a5:	00 00 00 
+  8026a8:	4c 89 e2             	mov    %r12,%rdx
+  8026ab:	48 29 f2             	sub    %rsi,%rdx
+  8026ae:	4c 01 f6             	add    %r14,%rsi
+  8026b1:	44 89 ef             	mov    %r13d,%edi
+  8026b4:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8026b7:	85 c0                	test   %eax,%eax
+  8026b9:	78 20                	js     8026db <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8026bb:	01 c3                	add    %eax,%ebx
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	74 08                	je     8026c9 <readn+0x54>
+  8026c1:	48 63 f3             	movslq %ebx,%rsi
+  8026c4:	4c 39 e6             	cmp    %r12,%rsi
+  8026c7:	72 df                	jb     8026a8 <readn+0x33>
+    }
+    return res;
+  8026c9:	48 63 c3             	movslq %ebx,%rax
+}
+  8026cc:	48 83 c4 08          	add    $0x8,%rsp
+  8026d0:	5b                   	pop    %rbx
+  8026d1:	41 5c                	pop    %r12
+  8026d3:	41 5d                	pop    %r13
+  8026d5:	41 5e                	pop    %r14
+  8026d7:	41 5f                	pop    %r15
+  8026d9:	5d                   	pop    %rbp
+  8026da:	c3                   	ret
+        if (inc < 0) return inc;
+  8026db:	48 98                	cltq
+  8026dd:	eb ed                	jmp    8026cc <readn+0x57>
+    int inc = 1, res = 0;
+  8026df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026e4:	eb e3                	jmp    8026c9 <readn+0x54>
+
+00000000008026e6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8026e6:	55                   	push   %rbp
+  8026e7:	48 89 e5             	mov    %rsp,%rbp
+  8026ea:	41 56                	push   %r14
+  8026ec:	41 55                	push   %r13
+  8026ee:	41 54                	push   %r12
+  8026f0:	53                   	push   %rbx
+  8026f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8026f5:	89 fb                	mov    %edi,%ebx
+  8026f7:	49 89 f4             	mov    %rsi,%r12
+  8026fa:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026fd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802701:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  802708:	00 00 00 
+  80270b:	ff d0                	call   *%rax
+  80270d:	85 c0                	test   %eax,%eax
+  80270f:	78 47                	js     802758 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802711:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802715:	41 8b 3e             	mov    (%r14),%edi
+  802718:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80271c:	48 b8 1f 23 80 00 00 	movabs $0x80231f,%rax
+  802723:	00 00 00 
+  802726:	ff d0                	call   *%rax
+  802728:	85 c0                	test   %eax,%eax
+  80272a:	78 30                	js     80275c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80272c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802731:	74 2d                	je     802760 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802733:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802737:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80273b:	48 85 c0             	test   %rax,%rax
+  80273e:	74 56                	je     802796 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802740:	4c 89 ea             	mov    %r13,%rdx
+  802743:	4c 89 e6             	mov    %r12,%rsi
+  802746:	4c 89 f7             	mov    %r14,%rdi
+  802749:	ff d0                	call   *%rax
+}
+  80274b:	48 83 c4 10          	add    $0x10,%rsp
+  80274f:	5b                   	pop    %rbx
+  802750:	41 5c                	pop    %r12
+  802752:	41 5d                	pop    %r13
+  802754:	41 5e                	pop    %r14
+  802756:	5d                   	pop    %rbp
+  802757:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802758:	48 98                	cltq
+  80275a:	eb ef                	jmp    80274b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80275c:	48 98                	cltq
+  80275e:	eb eb                	jmp    80274b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802760:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802767:	00 00 00 
+  80276a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802770:	89 da                	mov    %ebx,%edx
+  802772:	48 bf b5 56 80 00 00 	movabs $0x8056b5,%rdi
+  802779:	00 00 00 
+  80277c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802781:	48 b9 a7 03 80 00 00 	movabs $0x8003a7,%rcx
+  802788:	00 00 00 
+  80278b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80278d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802794:	eb b5                	jmp    80274b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802796:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80279d:	eb ac                	jmp    80274b <write+0x65>
+
+000000000080279f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80279f:	55                   	push   %rbp
+  8027a0:	48 89 e5             	mov    %rsp,%rbp
+  8027a3:	53                   	push   %rbx
+  8027a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8027a8:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027aa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027ae:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  8027b5:	00 00 00 
+  8027b8:	ff d0                	call   *%rax
+  8027ba:	85 c0                	test   %eax,%eax
+  8027bc:	78 0c                	js     8027ca <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8027be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027c2:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8027c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027ce:	c9                   	leave
+  8027cf:	c3                   	ret
+
+00000000008027d0 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8027d0:	55                   	push   %rbp
+  8027d1:	48 89 e5             	mov    %rsp,%rbp
+  8027d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8027d8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8027dc:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  8027e3:	00 00 00 
+  8027e6:	ff d0                	call   *%rax
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	78 07                	js     8027f3 <tell+0x23>
+    return fdes->fd_offset;
+  8027ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027f0:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8027f3:	c9                   	leave
+  8027f4:	c3                   	ret
+
+00000000008027f5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8027f5:	55                   	push   %rbp
+  8027f6:	48 89 e5             	mov    %rsp,%rbp
+  8027f9:	41 55                	push   %r13
+  8027fb:	41 54                	push   %r12
+  8027fd:	53                   	push   %rbx
+  8027fe:	48 83 ec 18          	sub    $0x18,%rsp
+  802802:	89 fb                	mov    %edi,%ebx
+  802804:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802807:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80280b:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  802812:	00 00 00 
+  802815:	ff d0                	call   *%rax
+  802817:	85 c0                	test   %eax,%eax
+  802819:	78 38                	js     802853 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80281b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80281f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802823:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802827:	48 b8 1f 23 80 00 00 	movabs $0x80231f,%rax
+  80282e:	00 00 00 
+  802831:	ff d0                	call   *%rax
+  802833:	85 c0                	test   %eax,%eax
+  802835:	78 1c                	js     802853 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802837:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80283c:	74 20                	je     80285e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80283e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802842:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802846:	48 85 c0             	test   %rax,%rax
+  802849:	74 47                	je     802892 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80284b:	44 89 e6             	mov    %r12d,%esi
+  80284e:	4c 89 ef             	mov    %r13,%rdi
+  802851:	ff d0                	call   *%rax
+}
+  802853:	48 83 c4 18          	add    $0x18,%rsp
+  802857:	5b                   	pop    %rbx
+  802858:	41 5c                	pop    %r12
+  80285a:	41 5d                	pop    %r13
+  80285c:	5d                   	pop    %rbp
+  80285d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80285e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802865:	00 00 00 
+  802868:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80286e:	89 da                	mov    %ebx,%edx
+  802870:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  802877:	00 00 00 
+  80287a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287f:	48 b9 a7 03 80 00 00 	movabs $0x8003a7,%rcx
+  802886:	00 00 00 
+  802889:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80288b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802890:	eb c1                	jmp    802853 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802892:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802897:	eb ba                	jmp    802853 <ftruncate+0x5e>
+
+0000000000802899 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802899:	55                   	push   %rbp
+  80289a:	48 89 e5             	mov    %rsp,%rbp
+  80289d:	41 54                	push   %r12
+  80289f:	53                   	push   %rbx
+  8028a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8028a4:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028a7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028ab:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  8028b2:	00 00 00 
+  8028b5:	ff d0                	call   *%rax
+  8028b7:	85 c0                	test   %eax,%eax
+  8028b9:	78 4e                	js     802909 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028bb:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8028bf:	41 8b 3c 24          	mov    (%r12),%edi
+  8028c3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8028c7:	48 b8 1f 23 80 00 00 	movabs $0x80231f,%rax
+  8028ce:	00 00 00 
+  8028d1:	ff d0                	call   *%rax
+  8028d3:	85 c0                	test   %eax,%eax
+  8028d5:	78 32                	js     802909 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8028d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8028db:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8028e0:	74 30                	je     802912 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8028e2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8028e5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8028ec:	00 00 00 
+    stat->st_isdir = 0;
+  8028ef:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8028f6:	00 00 00 
+    stat->st_dev = dev;
+  8028f9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802900:	48 89 de             	mov    %rbx,%rsi
+  802903:	4c 89 e7             	mov    %r12,%rdi
+  802906:	ff 50 28             	call   *0x28(%rax)
+}
+  802909:	48 83 c4 10          	add    $0x10,%rsp
+  80290d:	5b                   	pop    %rbx
+  80290e:	41 5c                	pop    %r12
+  802910:	5d                   	pop    %rbp
+  802911:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802912:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802917:	eb f0                	jmp    802909 <fstat+0x70>
+
+0000000000802919 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802919:	55                   	push   %rbp
+  80291a:	48 89 e5             	mov    %rsp,%rbp
+  80291d:	41 54                	push   %r12
+  80291f:	53                   	push   %rbx
+  802920:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802927:	41 89 fc             	mov    %edi,%r12d
+  80292a:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80292c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802930:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  802937:	00 00 00 
+  80293a:	ff d0                	call   *%rax
+  80293c:	85 c0                	test   %eax,%eax
+  80293e:	78 31                	js     802971 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802940:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802947:	44 89 e7             	mov    %r12d,%edi
+  80294a:	48 b8 99 28 80 00 00 	movabs $0x802899,%rax
+  802951:	00 00 00 
+  802954:	ff d0                	call   *%rax
+  802956:	85 c0                	test   %eax,%eax
+  802958:	78 17                	js     802971 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  80295a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80295e:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802961:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802964:	39 d3                	cmp    %edx,%ebx
+  802966:	0f 4f da             	cmovg  %edx,%ebx
+  802969:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80296c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802971:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802978:	5b                   	pop    %rbx
+  802979:	41 5c                	pop    %r12
+  80297b:	5d                   	pop    %rbp
+  80297c:	c3                   	ret
+
+000000000080297d <seektoend>:
+{
+  80297d:	55                   	push   %rbp
+  80297e:	48 89 e5             	mov    %rsp,%rbp
+  802981:	53                   	push   %rbx
+  802982:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802989:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80298b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80298f:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  802996:	00 00 00 
+  802999:	ff d0                	call   *%rax
+  80299b:	85 c0                	test   %eax,%eax
+  80299d:	78 28                	js     8029c7 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80299f:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8029a6:	89 df                	mov    %ebx,%edi
+  8029a8:	48 b8 99 28 80 00 00 	movabs $0x802899,%rax
+  8029af:	00 00 00 
+  8029b2:	ff d0                	call   *%rax
+  8029b4:	85 c0                	test   %eax,%eax
+  8029b6:	78 0f                	js     8029c7 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8029b8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8029bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029bf:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8029c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029cb:	c9                   	leave
+  8029cc:	c3                   	ret
+
+00000000008029cd <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8029cd:	55                   	push   %rbp
+  8029ce:	48 89 e5             	mov    %rsp,%rbp
+  8029d1:	41 54                	push   %r12
+  8029d3:	53                   	push   %rbx
+  8029d4:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8029d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029dc:	48 b8 c0 35 80 00 00 	movabs $0x8035c0,%rax
+  8029e3:	00 00 00 
+  8029e6:	ff d0                	call   *%rax
+  8029e8:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8029ea:	85 c0                	test   %eax,%eax
+  8029ec:	78 25                	js     802a13 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8029ee:	4c 89 e6             	mov    %r12,%rsi
+  8029f1:	89 c7                	mov    %eax,%edi
+  8029f3:	48 b8 99 28 80 00 00 	movabs $0x802899,%rax
+  8029fa:	00 00 00 
+  8029fd:	ff d0                	call   *%rax
+  8029ff:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802a02:	89 df                	mov    %ebx,%edi
+  802a04:	48 b8 39 24 80 00 00 	movabs $0x802439,%rax
+  802a0b:	00 00 00 
+  802a0e:	ff d0                	call   *%rax
+
+    return res;
+  802a10:	44 89 e3             	mov    %r12d,%ebx
+}
+  802a13:	89 d8                	mov    %ebx,%eax
+  802a15:	5b                   	pop    %rbx
+  802a16:	41 5c                	pop    %r12
+  802a18:	5d                   	pop    %rbp
+  802a19:	c3                   	ret
+
+0000000000802a1a <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802a1a:	55                   	push   %rbp
+  802a1b:	48 89 e5             	mov    %rsp,%rbp
+  802a1e:	53                   	push   %rbx
+  802a1f:	48 83 ec 08          	sub    $0x8,%rsp
+  802a23:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802a26:	48 b8 46 22 80 00 00 	movabs $0x802246,%rax
+  802a2d:	00 00 00 
+  802a30:	ff d0                	call   *%rax
+  802a32:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802a36:	0f 87 ea 00 00 00    	ja     802b26 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802a3c:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802a43:	00 00 00 
+  802a46:	80 38 00             	cmpb   $0x0,(%rax)
+  802a49:	75 35                	jne    802a80 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802a4b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a50:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802a55:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802a5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a5f:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  802a66:	00 00 00 
+  802a69:	ff d0                	call   *%rax
+  802a6b:	85 c0                	test   %eax,%eax
+  802a6d:	0f 88 ba 00 00 00    	js     802b2d <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802a73:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802a7a:	00 00 00 
+  802a7d:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802a80:	48 89 df             	mov    %rbx,%rdi
+  802a83:	48 b8 46 22 80 00 00 	movabs $0x802246,%rax
+  802a8a:	00 00 00 
+  802a8d:	ff d0                	call   *%rax
+  802a8f:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802a93:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802a9a:	00 00 00 
+  802a9d:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802aa1:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802aa4:	39 39                	cmp    %edi,(%rcx)
+  802aa6:	74 46                	je     802aee <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802aa8:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802aac:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802ab3:	00 
+  802ab4:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802abb:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802ac2:	00 
+  802ac3:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802aca:	00 
+  802acb:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802ad2:	00 
+  802ad3:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802ada:	00 
+  802adb:	89 39                	mov    %edi,(%rcx)
+  802add:	48 01 c6             	add    %rax,%rsi
+  802ae0:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802ae5:	48 89 c8             	mov    %rcx,%rax
+  802ae8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aec:	c9                   	leave
+  802aed:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802aee:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802af2:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802af9:	00 00 00 
+  802afc:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802aff:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802b03:	74 e0                	je     802ae5 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802b05:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802b0c:	00 
+  802b0d:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802b11:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802b18:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802b1a:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802b1d:	48 01 c2             	add    %rax,%rdx
+  802b20:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802b24:	eb bf                	jmp    802ae5 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802b26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b2b:	eb b8                	jmp    802ae5 <fbuf_get+0xcb>
+            return NULL;
+  802b2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b32:	eb b1                	jmp    802ae5 <fbuf_get+0xcb>
+
+0000000000802b34 <fsipc_bulk>:
+fsipc_bulk(void) {
+  802b34:	55                   	push   %rbp
+  802b35:	48 89 e5             	mov    %rsp,%rbp
+  802b38:	53                   	push   %rbx
+  802b39:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802b3d:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802b44:	00 00 00 
+  802b47:	48 8b 18             	mov    (%rax),%rbx
+  802b4a:	48 85 db             	test   %rbx,%rbx
+  802b4d:	74 16                	je     802b65 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802b4f:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802b56:	00 00 00 
+  802b59:	48 8b 18             	mov    (%rax),%rbx
+}
+  802b5c:	48 89 d8             	mov    %rbx,%rax
+  802b5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b63:	c9                   	leave
+  802b64:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802b65:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b6a:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802b6f:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802b74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b79:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  802b80:	00 00 00 
+  802b83:	ff d0                	call   *%rax
+  802b85:	85 c0                	test   %eax,%eax
+  802b87:	78 d3                	js     802b5c <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802b89:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802b8e:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802b95:	00 00 00 
+  802b98:	eb b5                	jmp    802b4f <fsipc_bulk+0x1b>
+
+0000000000802b9a <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802b9a:	55                   	push   %rbp
+  802b9b:	48 89 e5             	mov    %rsp,%rbp
+  802b9e:	41 57                	push   %r15
+  802ba0:	41 56                	push   %r14
+  802ba2:	41 55                	push   %r13
+  802ba4:	41 54                	push   %r12
+  802ba6:	53                   	push   %rbx
+  802ba7:	48 83 ec 08          	sub    $0x8,%rsp
+  802bab:	41 89 fd             	mov    %edi,%r13d
+  802bae:	49 89 f6             	mov    %rsi,%r14
+  802bb1:	49 89 d7             	mov    %rdx,%r15
+  802bb4:	48 89 cb             	mov    %rcx,%rbx
+  802bb7:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bba:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802bc1:	00 00 00 
+  802bc4:	83 38 00             	cmpl   $0x0,(%rax)
+  802bc7:	74 52                	je     802c1b <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802bc9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802bcf:	4c 89 f9             	mov    %r15,%rcx
+  802bd2:	4c 89 f2             	mov    %r14,%rdx
+  802bd5:	44 89 ee             	mov    %r13d,%esi
+  802bd8:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802bdf:	00 00 00 
+  802be2:	8b 38                	mov    (%rax),%edi
+  802be4:	48 b8 53 21 80 00 00 	movabs $0x802153,%rax
+  802beb:	00 00 00 
+  802bee:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802bf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bf5:	4c 89 e2             	mov    %r12,%rdx
+  802bf8:	48 89 de             	mov    %rbx,%rsi
+  802bfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c00:	48 b8 a3 1f 80 00 00 	movabs $0x801fa3,%rax
+  802c07:	00 00 00 
+  802c0a:	ff d0                	call   *%rax
+}
+  802c0c:	48 83 c4 08          	add    $0x8,%rsp
+  802c10:	5b                   	pop    %rbx
+  802c11:	41 5c                	pop    %r12
+  802c13:	41 5d                	pop    %r13
+  802c15:	41 5e                	pop    %r14
+  802c17:	41 5f                	pop    %r15
+  802c19:	5d                   	pop    %rbp
+  802c1a:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c1b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c20:	48 b8 f6 21 80 00 00 	movabs $0x8021f6,%rax
+  802c27:	00 00 00 
+  802c2a:	ff d0                	call   *%rax
+  802c2c:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802c33:	00 00 
+  802c35:	eb 92                	jmp    802bc9 <fsipc_region+0x2f>
+
+0000000000802c37 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802c37:	55                   	push   %rbp
+  802c38:	48 89 e5             	mov    %rsp,%rbp
+  802c3b:	41 57                	push   %r15
+  802c3d:	41 56                	push   %r14
+  802c3f:	41 55                	push   %r13
+  802c41:	41 54                	push   %r12
+  802c43:	53                   	push   %rbx
+  802c44:	48 83 ec 28          	sub    $0x28,%rsp
+  802c48:	49 89 ff             	mov    %rdi,%r15
+  802c4b:	49 89 f6             	mov    %rsi,%r14
+  802c4e:	48 89 d3             	mov    %rdx,%rbx
+  802c51:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802c55:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802c58:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  802c5f:	00 00 00 
+  802c62:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802c64:	48 85 c0             	test   %rax,%rax
+  802c67:	0f 84 cc 00 00 00    	je     802d39 <devfile_write_direct+0x102>
+  802c6d:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802c70:	48 85 db             	test   %rbx,%rbx
+  802c73:	0f 84 ba 00 00 00    	je     802d33 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802c79:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802c7f:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802c86:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802c8a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802c8e:	4c 29 e3             	sub    %r12,%rbx
+  802c91:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802c96:	48 39 c3             	cmp    %rax,%rbx
+  802c99:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802c9d:	48 89 da             	mov    %rbx,%rdx
+  802ca0:	4c 89 f6             	mov    %r14,%rsi
+  802ca3:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802ca7:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  802cae:	00 00 00 
+  802cb1:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802cb3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802cb7:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802cbb:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802cbe:	44 01 e0             	add    %r12d,%eax
+  802cc1:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802cc5:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802cc9:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802cd0:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802cd7:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802cde:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ce4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ce9:	4c 89 ee             	mov    %r13,%rsi
+  802cec:	bf 04 00 00 00       	mov    $0x4,%edi
+  802cf1:	48 b8 9a 2b 80 00 00 	movabs $0x802b9a,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+        if (res < 0)
+  802cfd:	85 c0                	test   %eax,%eax
+  802cff:	78 29                	js     802d2a <devfile_write_direct+0xf3>
+        if (res == 0)
+  802d01:	74 2b                	je     802d2e <devfile_write_direct+0xf7>
+        i += res;
+  802d03:	48 98                	cltq
+  802d05:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802d08:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802d0b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d0f:	49 39 c4             	cmp    %rax,%r12
+  802d12:	0f 82 72 ff ff ff    	jb     802c8a <devfile_write_direct+0x53>
+    return i;
+  802d18:	4c 89 e0             	mov    %r12,%rax
+}
+  802d1b:	48 83 c4 28          	add    $0x28,%rsp
+  802d1f:	5b                   	pop    %rbx
+  802d20:	41 5c                	pop    %r12
+  802d22:	41 5d                	pop    %r13
+  802d24:	41 5e                	pop    %r14
+  802d26:	41 5f                	pop    %r15
+  802d28:	5d                   	pop    %rbp
+  802d29:	c3                   	ret
+            return res;
+  802d2a:	48 98                	cltq
+  802d2c:	eb ed                	jmp    802d1b <devfile_write_direct+0xe4>
+            return i;
+  802d2e:	4c 89 e0             	mov    %r12,%rax
+  802d31:	eb e8                	jmp    802d1b <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802d33:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802d37:	eb df                	jmp    802d18 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802d39:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802d40:	eb d9                	jmp    802d1b <devfile_write_direct+0xe4>
+
+0000000000802d42 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802d42:	55                   	push   %rbp
+  802d43:	48 89 e5             	mov    %rsp,%rbp
+  802d46:	41 56                	push   %r14
+  802d48:	41 55                	push   %r13
+  802d4a:	41 54                	push   %r12
+  802d4c:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802d4d:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802d51:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5a:	4d 39 ee             	cmp    %r13,%r14
+  802d5d:	0f 84 99 00 00 00    	je     802dfc <fbuf_flush+0xba>
+  802d63:	49 89 fc             	mov    %rdi,%r12
+  802d66:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802d69:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802d6c:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802d70:	48 b8 46 22 80 00 00 	movabs $0x802246,%rax
+  802d77:	00 00 00 
+  802d7a:	ff d0                	call   *%rax
+  802d7c:	48 89 c2             	mov    %rax,%rdx
+  802d7f:	48 c1 e2 04          	shl    $0x4,%rdx
+  802d83:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802d87:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d8b:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802d90:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802d93:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802d97:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802d9e:	00 
+  802d9f:	44 89 f1             	mov    %r14d,%ecx
+  802da2:	4c 89 ea             	mov    %r13,%rdx
+  802da5:	4c 89 e7             	mov    %r12,%rdi
+  802da8:	48 b8 37 2c 80 00 00 	movabs $0x802c37,%rax
+  802daf:	00 00 00 
+  802db2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802db4:	48 85 c0             	test   %rax,%rax
+  802db7:	78 43                	js     802dfc <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802db9:	4c 39 e8             	cmp    %r13,%rax
+  802dbc:	72 47                	jb     802e05 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802dbe:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802dc3:	83 c0 01             	add    $0x1,%eax
+  802dc6:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802dcb:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802dce:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802dd2:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802dd6:	72 0f                	jb     802de7 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802dd8:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802ddc:	48 39 c2             	cmp    %rax,%rdx
+  802ddf:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802de3:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802de7:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802dee:	00 
+  802def:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802df6:	00 
+    return 0;
+  802df7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dfc:	5b                   	pop    %rbx
+  802dfd:	41 5c                	pop    %r12
+  802dff:	41 5d                	pop    %r13
+  802e01:	41 5e                	pop    %r14
+  802e03:	5d                   	pop    %rbp
+  802e04:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802e05:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802e0a:	eb f0                	jmp    802dfc <fbuf_flush+0xba>
+
+0000000000802e0c <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802e0c:	55                   	push   %rbp
+  802e0d:	48 89 e5             	mov    %rsp,%rbp
+  802e10:	53                   	push   %rbx
+  802e11:	48 83 ec 08          	sub    $0x8,%rsp
+  802e15:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802e18:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  802e1f:	00 00 00 
+  802e22:	ff d0                	call   *%rax
+  802e24:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802e27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e2c:	48 85 f6             	test   %rsi,%rsi
+  802e2f:	74 0f                	je     802e40 <devfile_sync+0x34>
+  802e31:	48 89 df             	mov    %rbx,%rdi
+  802e34:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  802e3b:	00 00 00 
+  802e3e:	ff d0                	call   *%rax
+}
+  802e40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e44:	c9                   	leave
+  802e45:	c3                   	ret
+
+0000000000802e46 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802e46:	55                   	push   %rbp
+  802e47:	48 89 e5             	mov    %rsp,%rbp
+  802e4a:	48 83 ec 10          	sub    $0x10,%rsp
+  802e4e:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802e51:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802e58:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802e59:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802e5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e62:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802e69:	00 00 00 
+  802e6c:	48 b8 9a 2b 80 00 00 	movabs $0x802b9a,%rax
+  802e73:	00 00 00 
+  802e76:	ff d0                	call   *%rax
+}
+  802e78:	c9                   	leave
+  802e79:	c3                   	ret
+
+0000000000802e7a <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e7a:	55                   	push   %rbp
+  802e7b:	48 89 e5             	mov    %rsp,%rbp
+  802e7e:	41 54                	push   %r12
+  802e80:	53                   	push   %rbx
+  802e81:	48 89 fb             	mov    %rdi,%rbx
+  802e84:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802e87:	48 b8 0c 2e 80 00 00 	movabs $0x802e0c,%rax
+  802e8e:	00 00 00 
+  802e91:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e93:	85 c0                	test   %eax,%eax
+  802e95:	78 63                	js     802efa <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e97:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e9a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802ea1:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802ea3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea8:	bf 05 00 00 00       	mov    $0x5,%edi
+  802ead:	48 b8 46 2e 80 00 00 	movabs $0x802e46,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802eb9:	85 c0                	test   %eax,%eax
+  802ebb:	78 3d                	js     802efa <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802ebd:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802ec4:	00 00 00 
+  802ec7:	48 89 de             	mov    %rbx,%rsi
+  802eca:	4c 89 e7             	mov    %r12,%rdi
+  802ecd:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  802ed4:	00 00 00 
+  802ed7:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802ed9:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802edf:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802ee6:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ee7:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802eed:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802ef4:	00 
+
+    return 0;
+  802ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802efa:	5b                   	pop    %rbx
+  802efb:	41 5c                	pop    %r12
+  802efd:	5d                   	pop    %rbp
+  802efe:	c3                   	ret
+
+0000000000802eff <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802eff:	55                   	push   %rbp
+  802f00:	48 89 e5             	mov    %rsp,%rbp
+  802f03:	41 54                	push   %r12
+  802f05:	53                   	push   %rbx
+  802f06:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802f09:	48 b8 0c 2e 80 00 00 	movabs $0x802e0c,%rax
+  802f10:	00 00 00 
+  802f13:	ff d0                	call   *%rax
+  802f15:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802f18:	48 89 df             	mov    %rbx,%rdi
+  802f1b:	48 b8 46 22 80 00 00 	movabs $0x802246,%rax
+  802f22:	00 00 00 
+  802f25:	ff d0                	call   *%rax
+  802f27:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802f2b:	76 2e                	jbe    802f5b <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802f2d:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f30:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802f37:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802f39:	be 00 00 00 00       	mov    $0x0,%esi
+  802f3e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802f43:	48 b8 46 2e 80 00 00 	movabs $0x802e46,%rax
+  802f4a:	00 00 00 
+  802f4d:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802f4f:	45 85 e4             	test   %r12d,%r12d
+  802f52:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802f56:	5b                   	pop    %rbx
+  802f57:	41 5c                	pop    %r12
+  802f59:	5d                   	pop    %rbp
+  802f5a:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802f5b:	48 89 df             	mov    %rbx,%rdi
+  802f5e:	48 b8 46 22 80 00 00 	movabs $0x802246,%rax
+  802f65:	00 00 00 
+  802f68:	ff d0                	call   *%rax
+  802f6a:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802f6e:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802f75:	00 00 00 
+  802f78:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802f7f:	48 89 df             	mov    %rbx,%rdi
+  802f82:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  802f89:	00 00 00 
+  802f8c:	ff d0                	call   *%rax
+  802f8e:	48 89 c6             	mov    %rax,%rsi
+  802f91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f96:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f9b:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  802fa2:	00 00 00 
+  802fa5:	ff d0                	call   *%rax
+  802fa7:	eb 84                	jmp    802f2d <devfile_flush+0x2e>
+
+0000000000802fa9 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802fa9:	55                   	push   %rbp
+  802faa:	48 89 e5             	mov    %rsp,%rbp
+  802fad:	41 55                	push   %r13
+  802faf:	41 54                	push   %r12
+  802fb1:	53                   	push   %rbx
+  802fb2:	48 83 ec 08          	sub    $0x8,%rsp
+  802fb6:	48 89 fb             	mov    %rdi,%rbx
+  802fb9:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802fbc:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  802fc3:	00 00 00 
+  802fc6:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802fc8:	48 85 c0             	test   %rax,%rax
+  802fcb:	74 51                	je     80301e <devfile_trunc+0x75>
+  802fcd:	49 89 c4             	mov    %rax,%r12
+  802fd0:	48 89 c6             	mov    %rax,%rsi
+  802fd3:	48 89 df             	mov    %rbx,%rdi
+  802fd6:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  802fdd:	00 00 00 
+  802fe0:	ff d0                	call   *%rax
+  802fe2:	85 c0                	test   %eax,%eax
+  802fe4:	78 2d                	js     803013 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802fe6:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802fed:	00 00 00 
+  802ff0:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802ff3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802ff5:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ff9:	be 00 00 00 00       	mov    $0x0,%esi
+  802ffe:	bf 02 00 00 00       	mov    $0x2,%edi
+  803003:	48 b8 46 2e 80 00 00 	movabs $0x802e46,%rax
+  80300a:	00 00 00 
+  80300d:	ff d0                	call   *%rax
+    if (res >= 0) {
+  80300f:	85 c0                	test   %eax,%eax
+  803011:	79 3e                	jns    803051 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  803013:	48 83 c4 08          	add    $0x8,%rsp
+  803017:	5b                   	pop    %rbx
+  803018:	41 5c                	pop    %r12
+  80301a:	41 5d                	pop    %r13
+  80301c:	5d                   	pop    %rbp
+  80301d:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80301e:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  803025:	00 00 00 
+  803028:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80302b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80302d:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803031:	be 00 00 00 00       	mov    $0x0,%esi
+  803036:	bf 02 00 00 00       	mov    $0x2,%edi
+  80303b:	48 b8 46 2e 80 00 00 	movabs $0x802e46,%rax
+  803042:	00 00 00 
+  803045:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803047:	85 c0                	test   %eax,%eax
+  803049:	78 c8                	js     803013 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  80304b:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80304f:	eb c2                	jmp    803013 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803051:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  803054:	8d 51 01             	lea    0x1(%rcx),%edx
+  803057:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80305a:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  80305f:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803066:	00 00 
+  803068:	eb a9                	jmp    803013 <devfile_trunc+0x6a>
+
+000000000080306a <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80306a:	55                   	push   %rbp
+  80306b:	48 89 e5             	mov    %rsp,%rbp
+  80306e:	41 57                	push   %r15
+  803070:	41 56                	push   %r14
+  803072:	41 55                	push   %r13
+  803074:	41 54                	push   %r12
+  803076:	53                   	push   %rbx
+  803077:	48 83 ec 28          	sub    $0x28,%rsp
+  80307b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80307f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803083:	49 89 d7             	mov    %rdx,%r15
+  803086:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  80308a:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  803091:	00 00 00 
+  803094:	ff d0                	call   *%rax
+  803096:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  803099:	48 85 c0             	test   %rax,%rax
+  80309c:	74 31                	je     8030cf <devfile_write+0x65>
+  80309e:	4c 89 f8             	mov    %r15,%rax
+  8030a1:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  8030a8:	77 25                	ja     8030cf <devfile_write+0x65>
+    size_t i = 0;
+  8030aa:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  8030b0:	48 85 c0             	test   %rax,%rax
+  8030b3:	0f 85 64 01 00 00    	jne    80321d <devfile_write+0x1b3>
+    size_t i = 0;
+  8030b9:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  8030bd:	4c 89 f8             	mov    %r15,%rax
+}
+  8030c0:	48 83 c4 28          	add    $0x28,%rsp
+  8030c4:	5b                   	pop    %rbx
+  8030c5:	41 5c                	pop    %r12
+  8030c7:	41 5d                	pop    %r13
+  8030c9:	41 5e                	pop    %r14
+  8030cb:	41 5f                	pop    %r15
+  8030cd:	5d                   	pop    %rbp
+  8030ce:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8030cf:	48 85 db             	test   %rbx,%rbx
+  8030d2:	74 5b                	je     80312f <devfile_write+0xc5>
+  8030d4:	48 89 de             	mov    %rbx,%rsi
+  8030d7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030db:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  8030e2:	00 00 00 
+  8030e5:	ff d0                	call   *%rax
+  8030e7:	85 c0                	test   %eax,%eax
+  8030e9:	78 40                	js     80312b <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  8030eb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030ef:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  8030f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8030f6:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8030fa:	48 b8 37 2c 80 00 00 	movabs $0x802c37,%rax
+  803101:	00 00 00 
+  803104:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803106:	48 85 c0             	test   %rax,%rax
+  803109:	7e b5                	jle    8030c0 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80310b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80310f:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  803112:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  803115:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803118:	8d 51 01             	lea    0x1(%rcx),%edx
+  80311b:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80311e:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  803121:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803128:	00 
+  803129:	eb 95                	jmp    8030c0 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80312b:	48 98                	cltq
+  80312d:	eb 91                	jmp    8030c0 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80312f:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803133:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  803136:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80313a:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80313e:	48 89 df             	mov    %rbx,%rdi
+  803141:	48 b8 37 2c 80 00 00 	movabs $0x802c37,%rax
+  803148:	00 00 00 
+  80314b:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80314d:	48 85 c0             	test   %rax,%rax
+  803150:	0f 8e 6a ff ff ff    	jle    8030c0 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803156:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803159:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80315d:	e9 5e ff ff ff       	jmp    8030c0 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803162:	48 98                	cltq
+  803164:	4d 85 ff             	test   %r15,%r15
+  803167:	49 0f 45 c7          	cmovne %r15,%rax
+  80316b:	e9 50 ff ff ff       	jmp    8030c0 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803170:	48 89 de             	mov    %rbx,%rsi
+  803173:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803177:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  80317e:	00 00 00 
+  803181:	ff d0                	call   *%rax
+  803183:	85 c0                	test   %eax,%eax
+  803185:	0f 88 2b 01 00 00    	js     8032b6 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80318b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80318f:	4c 01 f8             	add    %r15,%rax
+  803192:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803196:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80319a:	48 b9 46 22 80 00 00 	movabs $0x802246,%rcx
+  8031a1:	00 00 00 
+  8031a4:	ff d1                	call   *%rcx
+  8031a6:	48 89 c2             	mov    %rax,%rdx
+  8031a9:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031ad:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8031b1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8031b5:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  8031ba:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8031bd:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8031c4:	00 
+  8031c5:	4c 89 ea             	mov    %r13,%rdx
+  8031c8:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8031cc:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  8031d3:	00 00 00 
+  8031d6:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  8031d8:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8031dc:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8031e0:	48 39 c2             	cmp    %rax,%rdx
+  8031e3:	0f 84 db 00 00 00    	je     8032c4 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  8031e9:	4c 39 e2             	cmp    %r12,%rdx
+  8031ec:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  8031f0:	4d 01 ec             	add    %r13,%r12
+  8031f3:	49 39 c4             	cmp    %rax,%r12
+  8031f6:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  8031fa:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  8031fe:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  803202:	45 01 ee             	add    %r13d,%r14d
+  803205:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803209:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  80320d:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803210:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803214:	49 39 c7             	cmp    %rax,%r15
+  803217:	0f 83 a0 fe ff ff    	jae    8030bd <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  80321d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803221:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  803225:	8b 43 08             	mov    0x8(%rbx),%eax
+  803228:	44 39 f0             	cmp    %r14d,%eax
+  80322b:	7f 10                	jg     80323d <devfile_write+0x1d3>
+  80322d:	48 98                	cltq
+  80322f:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  803235:	49 63 d6             	movslq %r14d,%rdx
+  803238:	48 39 d0             	cmp    %rdx,%rax
+  80323b:	7d 2d                	jge    80326a <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80323d:	48 89 de             	mov    %rbx,%rsi
+  803240:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803244:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  80324b:	00 00 00 
+  80324e:	ff d0                	call   *%rax
+  803250:	85 c0                	test   %eax,%eax
+  803252:	0f 88 0a ff ff ff    	js     803162 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803258:	44 89 f0             	mov    %r14d,%eax
+  80325b:	66 b8 00 00          	mov    $0x0,%ax
+  80325f:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803262:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803269:	00 
+        size_t off = pos - fb->fb_base;
+  80326a:	45 89 f4             	mov    %r14d,%r12d
+  80326d:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803271:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803274:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803278:	4d 29 fd             	sub    %r15,%r13
+  80327b:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803280:	4c 29 e0             	sub    %r12,%rax
+  803283:	49 39 c5             	cmp    %rax,%r13
+  803286:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  80328a:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80328e:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803292:	48 39 c2             	cmp    %rax,%rdx
+  803295:	0f 84 f0 fe ff ff    	je     80318b <devfile_write+0x121>
+  80329b:	4c 39 e0             	cmp    %r12,%rax
+  80329e:	0f 82 cc fe ff ff    	jb     803170 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  8032a4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8032a8:	48 39 d0             	cmp    %rdx,%rax
+  8032ab:	0f 83 da fe ff ff    	jae    80318b <devfile_write+0x121>
+  8032b1:	e9 ba fe ff ff       	jmp    803170 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8032b6:	48 98                	cltq
+  8032b8:	4d 85 ff             	test   %r15,%r15
+  8032bb:	49 0f 45 c7          	cmovne %r15,%rax
+  8032bf:	e9 fc fd ff ff       	jmp    8030c0 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  8032c4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8032c8:	4c 89 e2             	mov    %r12,%rdx
+  8032cb:	e9 2a ff ff ff       	jmp    8031fa <devfile_write+0x190>
+
+00000000008032d0 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8032d0:	55                   	push   %rbp
+  8032d1:	48 89 e5             	mov    %rsp,%rbp
+  8032d4:	41 57                	push   %r15
+  8032d6:	41 56                	push   %r14
+  8032d8:	41 55                	push   %r13
+  8032da:	41 54                	push   %r12
+  8032dc:	53                   	push   %rbx
+  8032dd:	48 83 ec 28          	sub    $0x28,%rsp
+  8032e1:	49 89 ff             	mov    %rdi,%r15
+  8032e4:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8032e8:	48 89 d3             	mov    %rdx,%rbx
+  8032eb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8032ef:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+  8032fb:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8032fe:	48 85 c0             	test   %rax,%rax
+  803301:	74 0d                	je     803310 <devfile_read+0x40>
+  803303:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  80330a:	0f 86 1a 01 00 00    	jbe    80342a <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803310:	4d 85 e4             	test   %r12,%r12
+  803313:	74 1a                	je     80332f <devfile_read+0x5f>
+  803315:	4c 89 e6             	mov    %r12,%rsi
+  803318:	4c 89 ff             	mov    %r15,%rdi
+  80331b:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  803322:	00 00 00 
+  803325:	ff d0                	call   *%rax
+  803327:	85 c0                	test   %eax,%eax
+  803329:	0f 88 e8 00 00 00    	js     803417 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  80332f:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  803333:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  80333a:	00 00 00 
+  80333d:	ff d0                	call   *%rax
+  80333f:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803342:	48 85 c0             	test   %rax,%rax
+  803345:	0f 84 69 02 00 00    	je     8035b4 <devfile_read+0x2e4>
+    while (i < n) {
+  80334b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803350:	0f 84 ce 00 00 00    	je     803424 <devfile_read+0x154>
+    size_t i = 0;
+  803356:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80335b:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803362:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803366:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80336a:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  80336e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803372:	48 29 da             	sub    %rbx,%rdx
+  803375:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80337a:	48 39 c2             	cmp    %rax,%rdx
+  80337d:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803381:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803385:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803389:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80338c:	01 d8                	add    %ebx,%eax
+  80338e:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803392:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803396:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  80339d:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8033a4:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8033ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8033b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033b6:	4c 89 ee             	mov    %r13,%rsi
+  8033b9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8033be:	48 b8 9a 2b 80 00 00 	movabs $0x802b9a,%rax
+  8033c5:	00 00 00 
+  8033c8:	ff d0                	call   *%rax
+        if (res < 0)
+  8033ca:	85 c0                	test   %eax,%eax
+  8033cc:	78 4d                	js     80341b <devfile_read+0x14b>
+        if (res == 0)
+  8033ce:	74 4f                	je     80341f <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8033d0:	4c 63 e0             	movslq %eax,%r12
+  8033d3:	4c 89 e2             	mov    %r12,%rdx
+  8033d6:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8033da:	4c 89 f7             	mov    %r14,%rdi
+  8033dd:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  8033e4:	00 00 00 
+  8033e7:	ff d0                	call   *%rax
+        i += res;
+  8033e9:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8033ec:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8033ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033f3:	48 39 c3             	cmp    %rax,%rbx
+  8033f6:	0f 82 72 ff ff ff    	jb     80336e <devfile_read+0x9e>
+    return i;
+  8033fc:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8033ff:	48 85 c0             	test   %rax,%rax
+  803402:	7e 04                	jle    803408 <devfile_read+0x138>
+  803404:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803408:	48 83 c4 28          	add    $0x28,%rsp
+  80340c:	5b                   	pop    %rbx
+  80340d:	41 5c                	pop    %r12
+  80340f:	41 5d                	pop    %r13
+  803411:	41 5e                	pop    %r14
+  803413:	41 5f                	pop    %r15
+  803415:	5d                   	pop    %rbp
+  803416:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803417:	48 98                	cltq
+  803419:	eb ed                	jmp    803408 <devfile_read+0x138>
+            return res;
+  80341b:	48 98                	cltq
+  80341d:	eb e9                	jmp    803408 <devfile_read+0x138>
+            return i;
+  80341f:	48 89 d8             	mov    %rbx,%rax
+  803422:	eb db                	jmp    8033ff <devfile_read+0x12f>
+    size_t i = 0;
+  803424:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803428:	eb d2                	jmp    8033fc <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80342a:	48 89 c6             	mov    %rax,%rsi
+  80342d:	4c 89 ff             	mov    %r15,%rdi
+  803430:	48 b8 42 2d 80 00 00 	movabs $0x802d42,%rax
+  803437:	00 00 00 
+  80343a:	ff d0                	call   *%rax
+  80343c:	85 c0                	test   %eax,%eax
+  80343e:	78 40                	js     803480 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803440:	4c 89 ff             	mov    %r15,%rdi
+  803443:	48 b8 46 22 80 00 00 	movabs $0x802246,%rax
+  80344a:	00 00 00 
+  80344d:	ff d0                	call   *%rax
+  80344f:	48 89 c2             	mov    %rax,%rdx
+  803452:	48 c1 e2 04          	shl    $0x4,%rdx
+  803456:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80345a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80345e:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803463:	48 01 d0             	add    %rdx,%rax
+  803466:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80346a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80346f:	0f 84 33 01 00 00    	je     8035a8 <devfile_read+0x2d8>
+    size_t i = 0;
+  803475:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80347b:	e9 f5 00 00 00       	jmp    803575 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803480:	48 98                	cltq
+  803482:	eb 84                	jmp    803408 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803484:	44 89 e8             	mov    %r13d,%eax
+  803487:	66 b8 00 00          	mov    $0x0,%ax
+  80348b:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803490:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803497:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803499:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80349d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8034a1:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8034a3:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8034a8:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8034ab:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8034b2:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8034b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8034b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034be:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8034c3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034c8:	48 b8 9a 2b 80 00 00 	movabs $0x802b9a,%rax
+  8034cf:	00 00 00 
+  8034d2:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8034d4:	85 c0                	test   %eax,%eax
+  8034d6:	0f 88 be 00 00 00    	js     80359a <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8034dc:	48 63 d0             	movslq %eax,%rdx
+  8034df:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8034e4:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8034e9:	44 39 e8             	cmp    %r13d,%eax
+  8034ec:	0f 8e ba 00 00 00    	jle    8035ac <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8034f2:	49 63 c5             	movslq %r13d,%rax
+  8034f5:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8034fa:	48 29 c3             	sub    %rax,%rbx
+  8034fd:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803502:	48 01 c3             	add    %rax,%rbx
+  803505:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803509:	4c 29 f0             	sub    %r14,%rax
+  80350c:	48 39 c3             	cmp    %rax,%rbx
+  80350f:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803513:	4c 89 ff             	mov    %r15,%rdi
+  803516:	48 b9 46 22 80 00 00 	movabs $0x802246,%rcx
+  80351d:	00 00 00 
+  803520:	ff d1                	call   *%rcx
+  803522:	48 89 c2             	mov    %rax,%rdx
+  803525:	48 c1 e2 04          	shl    $0x4,%rdx
+  803529:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80352d:	48 c1 e0 0c          	shl    $0xc,%rax
+  803531:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803536:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803539:	44 89 ea             	mov    %r13d,%edx
+  80353c:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803541:	48 63 d2             	movslq %edx,%rdx
+  803544:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80354b:	00 
+  80354c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803550:	4c 01 f7             	add    %r14,%rdi
+  803553:	48 89 da             	mov    %rbx,%rdx
+  803556:	48 b9 14 11 80 00 00 	movabs $0x801114,%rcx
+  80355d:	00 00 00 
+  803560:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803562:	41 01 dd             	add    %ebx,%r13d
+  803565:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803569:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80356c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803570:	49 39 c6             	cmp    %rax,%r14
+  803573:	73 37                	jae    8035ac <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803575:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803579:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80357e:	44 39 e8             	cmp    %r13d,%eax
+  803581:	0f 8f fd fe ff ff    	jg     803484 <devfile_read+0x1b4>
+  803587:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80358c:	44 39 e8             	cmp    %r13d,%eax
+  80358f:	0f 8f 5d ff ff ff    	jg     8034f2 <devfile_read+0x222>
+  803595:	e9 ea fe ff ff       	jmp    803484 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80359a:	48 98                	cltq
+  80359c:	4d 85 f6             	test   %r14,%r14
+  80359f:	49 0f 45 c6          	cmovne %r14,%rax
+  8035a3:	e9 60 fe ff ff       	jmp    803408 <devfile_read+0x138>
+    size_t i = 0;
+  8035a8:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8035ac:	4c 89 f0             	mov    %r14,%rax
+  8035af:	e9 54 fe ff ff       	jmp    803408 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8035b4:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8035bb:	e9 48 fe ff ff       	jmp    803408 <devfile_read+0x138>
+
+00000000008035c0 <open>:
+open(const char *path, int mode) {
+  8035c0:	55                   	push   %rbp
+  8035c1:	48 89 e5             	mov    %rsp,%rbp
+  8035c4:	41 55                	push   %r13
+  8035c6:	41 54                	push   %r12
+  8035c8:	53                   	push   %rbx
+  8035c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8035cd:	49 89 fc             	mov    %rdi,%r12
+  8035d0:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8035d3:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  8035da:	00 00 00 
+  8035dd:	ff d0                	call   *%rax
+  8035df:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8035e5:	0f 87 8a 00 00 00    	ja     803675 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8035eb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8035ef:	48 b8 74 22 80 00 00 	movabs $0x802274,%rax
+  8035f6:	00 00 00 
+  8035f9:	ff d0                	call   *%rax
+  8035fb:	89 c3                	mov    %eax,%ebx
+  8035fd:	85 c0                	test   %eax,%eax
+  8035ff:	78 50                	js     803651 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803601:	4c 89 e6             	mov    %r12,%rsi
+  803604:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80360b:	00 00 00 
+  80360e:	48 89 df             	mov    %rbx,%rdi
+  803611:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  803618:	00 00 00 
+  80361b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80361d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803624:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803628:	bf 01 00 00 00       	mov    $0x1,%edi
+  80362d:	48 b8 46 2e 80 00 00 	movabs $0x802e46,%rax
+  803634:	00 00 00 
+  803637:	ff d0                	call   *%rax
+  803639:	89 c3                	mov    %eax,%ebx
+  80363b:	85 c0                	test   %eax,%eax
+  80363d:	78 1f                	js     80365e <open+0x9e>
+    return fd2num(fd);
+  80363f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803643:	48 b8 46 22 80 00 00 	movabs $0x802246,%rax
+  80364a:	00 00 00 
+  80364d:	ff d0                	call   *%rax
+  80364f:	89 c3                	mov    %eax,%ebx
+}
+  803651:	89 d8                	mov    %ebx,%eax
+  803653:	48 83 c4 18          	add    $0x18,%rsp
+  803657:	5b                   	pop    %rbx
+  803658:	41 5c                	pop    %r12
+  80365a:	41 5d                	pop    %r13
+  80365c:	5d                   	pop    %rbp
+  80365d:	c3                   	ret
+        fd_close(fd, 0);
+  80365e:	be 00 00 00 00       	mov    $0x0,%esi
+  803663:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803667:	48 b8 8f 23 80 00 00 	movabs $0x80238f,%rax
+  80366e:	00 00 00 
+  803671:	ff d0                	call   *%rax
+        return res;
+  803673:	eb dc                	jmp    803651 <open+0x91>
+        return -E_BAD_PATH;
+  803675:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80367a:	eb d5                	jmp    803651 <open+0x91>
+
+000000000080367c <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80367c:	55                   	push   %rbp
+  80367d:	48 89 e5             	mov    %rsp,%rbp
+  803680:	41 57                	push   %r15
+  803682:	41 56                	push   %r14
+  803684:	41 55                	push   %r13
+  803686:	41 54                	push   %r12
+  803688:	53                   	push   %rbx
+  803689:	48 83 ec 18          	sub    $0x18,%rsp
+  80368d:	41 89 f6             	mov    %esi,%r14d
+  803690:	49 89 d7             	mov    %rdx,%r15
+  803693:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803696:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80369a:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  8036a1:	00 00 00 
+  8036a4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	0f 88 db 00 00 00    	js     803789 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8036ae:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8036b2:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8036b9:	00 00 00 
+  8036bc:	8b 00                	mov    (%rax),%eax
+  8036be:	39 07                	cmp    %eax,(%rdi)
+  8036c0:	0f 85 db 00 00 00    	jne    8037a1 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8036c6:	45 85 f6             	test   %r14d,%r14d
+  8036c9:	0f 88 db 00 00 00    	js     8037aa <fmap+0x12e>
+  8036cf:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8036d6:	0f 85 d7 00 00 00    	jne    8037b3 <fmap+0x137>
+  8036dc:	4c 89 fb             	mov    %r15,%rbx
+  8036df:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8036e5:	0f 85 d1 00 00 00    	jne    8037bc <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8036eb:	48 b8 0c 2e 80 00 00 	movabs $0x802e0c,%rax
+  8036f2:	00 00 00 
+  8036f5:	ff d0                	call   *%rax
+  8036f7:	85 c0                	test   %eax,%eax
+  8036f9:	0f 88 8e 00 00 00    	js     80378d <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8036ff:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803706:	00 00 00 
+    while (i < n) {
+  803709:	4d 85 ed             	test   %r13,%r13
+  80370c:	0f 84 8a 00 00 00    	je     80379c <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803712:	4c 89 ea             	mov    %r13,%rdx
+  803715:	48 29 da             	sub    %rbx,%rdx
+  803718:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80371f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803725:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803729:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80372d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803730:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  803734:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803738:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  80373d:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803742:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803746:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80374a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80374f:	4c 89 e6             	mov    %r12,%rsi
+  803752:	bf 09 00 00 00       	mov    $0x9,%edi
+  803757:	48 b8 9a 2b 80 00 00 	movabs $0x802b9a,%rax
+  80375e:	00 00 00 
+  803761:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803763:	85 c0                	test   %eax,%eax
+  803765:	78 2a                	js     803791 <fmap+0x115>
+        i += res;
+  803767:	48 98                	cltq
+  803769:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80376c:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803770:	72 05                	jb     803777 <fmap+0xfb>
+    while (i < n) {
+  803772:	4c 39 eb             	cmp    %r13,%rbx
+  803775:	72 9b                	jb     803712 <fmap+0x96>
+    }
+    return i;
+  803777:	48 89 d8             	mov    %rbx,%rax
+}
+  80377a:	48 83 c4 18          	add    $0x18,%rsp
+  80377e:	5b                   	pop    %rbx
+  80377f:	41 5c                	pop    %r12
+  803781:	41 5d                	pop    %r13
+  803783:	41 5e                	pop    %r14
+  803785:	41 5f                	pop    %r15
+  803787:	5d                   	pop    %rbp
+  803788:	c3                   	ret
+    if (res < 0) return res;
+  803789:	48 98                	cltq
+  80378b:	eb ed                	jmp    80377a <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80378d:	48 98                	cltq
+  80378f:	eb e9                	jmp    80377a <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803791:	48 98                	cltq
+  803793:	48 85 db             	test   %rbx,%rbx
+  803796:	48 0f 45 c3          	cmovne %rbx,%rax
+  80379a:	eb de                	jmp    80377a <fmap+0xfe>
+    size_t i = 0;
+  80379c:	4c 89 eb             	mov    %r13,%rbx
+  80379f:	eb d6                	jmp    803777 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8037a1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8037a8:	eb d0                	jmp    80377a <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8037aa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037b1:	eb c7                	jmp    80377a <fmap+0xfe>
+  8037b3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037ba:	eb be                	jmp    80377a <fmap+0xfe>
+  8037bc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037c3:	eb b5                	jmp    80377a <fmap+0xfe>
+
+00000000008037c5 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8037c5:	55                   	push   %rbp
+  8037c6:	48 89 e5             	mov    %rsp,%rbp
+  8037c9:	41 56                	push   %r14
+  8037cb:	41 55                	push   %r13
+  8037cd:	41 54                	push   %r12
+  8037cf:	53                   	push   %rbx
+  8037d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8037d4:	89 fb                	mov    %edi,%ebx
+  8037d6:	41 89 f4             	mov    %esi,%r12d
+  8037d9:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8037dc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8037e0:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  8037e7:	00 00 00 
+  8037ea:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037ec:	85 c0                	test   %eax,%eax
+  8037ee:	78 63                	js     803853 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8037f0:	45 85 e4             	test   %r12d,%r12d
+  8037f3:	0f 88 80 00 00 00    	js     803879 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8037f9:	45 89 e6             	mov    %r12d,%r14d
+  8037fc:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803803:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803807:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  80380e:	00 00 00 
+  803811:	ff d0                	call   *%rax
+  803813:	48 89 c2             	mov    %rax,%rdx
+  803816:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80381b:	44 89 f6             	mov    %r14d,%esi
+  80381e:	89 df                	mov    %ebx,%edi
+  803820:	48 b8 7c 36 80 00 00 	movabs $0x80367c,%rax
+  803827:	00 00 00 
+  80382a:	ff d0                	call   *%rax
+  80382c:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80382f:	45 29 f4             	sub    %r14d,%r12d
+  803832:	4d 63 f4             	movslq %r12d,%r14
+  803835:	49 39 c6             	cmp    %rax,%r14
+  803838:	7c 1d                	jl     803857 <read_map+0x92>
+  80383a:	48 85 c0             	test   %rax,%rax
+  80383d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803842:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803846:	48 83 c4 10          	add    $0x10,%rsp
+  80384a:	5b                   	pop    %rbx
+  80384b:	41 5c                	pop    %r12
+  80384d:	41 5d                	pop    %r13
+  80384f:	41 5e                	pop    %r14
+  803851:	5d                   	pop    %rbp
+  803852:	c3                   	ret
+    if (res < 0) return res;
+  803853:	48 98                	cltq
+  803855:	eb ef                	jmp    803846 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803857:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80385b:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+  803867:	4d 63 e4             	movslq %r12d,%r12
+  80386a:	4c 01 e0             	add    %r12,%rax
+  80386d:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803871:	48 89 d8             	mov    %rbx,%rax
+  803874:	4c 29 f0             	sub    %r14,%rax
+  803877:	eb cd                	jmp    803846 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803879:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803880:	eb c4                	jmp    803846 <read_map+0x81>
+
+0000000000803882 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803882:	55                   	push   %rbp
+  803883:	48 89 e5             	mov    %rsp,%rbp
+  803886:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80388a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80388e:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  803895:	00 00 00 
+  803898:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80389a:	85 c0                	test   %eax,%eax
+  80389c:	78 4a                	js     8038e8 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80389e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8038a2:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8038a9:	00 00 00 
+  8038ac:	8b 00                	mov    (%rax),%eax
+  8038ae:	39 07                	cmp    %eax,(%rdi)
+  8038b0:	75 38                	jne    8038ea <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8038b2:	48 b8 0c 2e 80 00 00 	movabs $0x802e0c,%rax
+  8038b9:	00 00 00 
+  8038bc:	ff d0                	call   *%rax
+  8038be:	85 c0                	test   %eax,%eax
+  8038c0:	78 26                	js     8038e8 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8038c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038c6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038c9:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8038d0:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8038d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8038d7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8038dc:	48 b8 46 2e 80 00 00 	movabs $0x802e46,%rax
+  8038e3:	00 00 00 
+  8038e6:	ff d0                	call   *%rax
+}
+  8038e8:	c9                   	leave
+  8038e9:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8038ea:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8038ef:	eb f7                	jmp    8038e8 <fsync+0x66>
+
+00000000008038f1 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8038f1:	55                   	push   %rbp
+  8038f2:	48 89 e5             	mov    %rsp,%rbp
+  8038f5:	41 57                	push   %r15
+  8038f7:	41 56                	push   %r14
+  8038f9:	41 55                	push   %r13
+  8038fb:	41 54                	push   %r12
+  8038fd:	53                   	push   %rbx
+  8038fe:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803902:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803909:	00 00 00 
+  80390c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803911:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803917:	49 bd d4 22 80 00 00 	movabs $0x8022d4,%r13
+  80391e:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803921:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803928:	00 00 00 
+  80392b:	eb 0c                	jmp    803939 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80392d:	83 c3 01             	add    $0x1,%ebx
+  803930:	49 83 c4 28          	add    $0x28,%r12
+  803934:	83 fb 20             	cmp    $0x20,%ebx
+  803937:	74 33                	je     80396c <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803939:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80393e:	74 ed                	je     80392d <flushall+0x3c>
+  803940:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803944:	89 df                	mov    %ebx,%edi
+  803946:	41 ff d5             	call   *%r13
+  803949:	85 c0                	test   %eax,%eax
+  80394b:	78 e0                	js     80392d <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80394d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803951:	41 8b 06             	mov    (%r14),%eax
+  803954:	39 07                	cmp    %eax,(%rdi)
+  803956:	75 d5                	jne    80392d <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803958:	48 b8 0c 2e 80 00 00 	movabs $0x802e0c,%rax
+  80395f:	00 00 00 
+  803962:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803964:	85 c0                	test   %eax,%eax
+  803966:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80396a:	eb c1                	jmp    80392d <flushall+0x3c>
+    }
+    return res;
+}
+  80396c:	44 89 f8             	mov    %r15d,%eax
+  80396f:	48 83 c4 18          	add    $0x18,%rsp
+  803973:	5b                   	pop    %rbx
+  803974:	41 5c                	pop    %r12
+  803976:	41 5d                	pop    %r13
+  803978:	41 5e                	pop    %r14
+  80397a:	41 5f                	pop    %r15
+  80397c:	5d                   	pop    %rbp
+  80397d:	c3                   	ret
+
+000000000080397e <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80397e:	55                   	push   %rbp
+  80397f:	48 89 e5             	mov    %rsp,%rbp
+  803982:	53                   	push   %rbx
+  803983:	48 83 ec 08          	sub    $0x8,%rsp
+  803987:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80398a:	40 0f b6 c6          	movzbl %sil,%eax
+  80398e:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803995:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803997:	be 00 00 00 00       	mov    $0x0,%esi
+  80399c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8039a1:	48 b8 46 2e 80 00 00 	movabs $0x802e46,%rax
+  8039a8:	00 00 00 
+  8039ab:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039ad:	85 c0                	test   %eax,%eax
+  8039af:	78 23                	js     8039d4 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8039b1:	ba 58 06 00 00       	mov    $0x658,%edx
+  8039b6:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8039bd:	00 00 00 
+  8039c0:	48 89 df             	mov    %rbx,%rdi
+  8039c3:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  8039ca:	00 00 00 
+  8039cd:	ff d0                	call   *%rax
+    return 0;
+  8039cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039d8:	c9                   	leave
+  8039d9:	c3                   	ret
+
+00000000008039da <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8039da:	55                   	push   %rbp
+  8039db:	48 89 e5             	mov    %rsp,%rbp
+  8039de:	53                   	push   %rbx
+  8039df:	48 83 ec 08          	sub    $0x8,%rsp
+  8039e3:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8039e6:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  8039ed:	00 00 00 
+  8039f0:	ff d0                	call   *%rax
+  8039f2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039f8:	77 35                	ja     803a2f <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8039fa:	48 89 de             	mov    %rbx,%rsi
+  8039fd:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803a04:	00 00 00 
+  803a07:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  803a0e:	00 00 00 
+  803a11:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803a13:	be 00 00 00 00       	mov    $0x0,%esi
+  803a18:	bf 07 00 00 00       	mov    $0x7,%edi
+  803a1d:	48 b8 46 2e 80 00 00 	movabs $0x802e46,%rax
+  803a24:	00 00 00 
+  803a27:	ff d0                	call   *%rax
+}
+  803a29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a2d:	c9                   	leave
+  803a2e:	c3                   	ret
+        return -E_BAD_PATH;
+  803a2f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803a34:	eb f3                	jmp    803a29 <remove+0x4f>
+
+0000000000803a36 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a36:	55                   	push   %rbp
+  803a37:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803a3a:	48 b8 f1 38 80 00 00 	movabs $0x8038f1,%rax
+  803a41:	00 00 00 
+  803a44:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803a46:	be 00 00 00 00       	mov    $0x0,%esi
+  803a4b:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a50:	48 b8 46 2e 80 00 00 	movabs $0x802e46,%rax
+  803a57:	00 00 00 
+  803a5a:	ff d0                	call   *%rax
+}
+  803a5c:	5d                   	pop    %rbp
+  803a5d:	c3                   	ret
+
+0000000000803a5e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803a5e:	55                   	push   %rbp
+  803a5f:	48 89 e5             	mov    %rsp,%rbp
+  803a62:	41 54                	push   %r12
+  803a64:	53                   	push   %rbx
+  803a65:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a68:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  803a6f:	00 00 00 
+  803a72:	ff d0                	call   *%rax
+  803a74:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803a77:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  803a7e:	00 00 00 
+  803a81:	48 89 df             	mov    %rbx,%rdi
+  803a84:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  803a8b:	00 00 00 
+  803a8e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803a90:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803a95:	41 2b 04 24          	sub    (%r12),%eax
+  803a99:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803a9f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803aa6:	00 00 00 
+    stat->st_dev = &devpipe;
+  803aa9:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803ab0:	00 00 00 
+  803ab3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803aba:	b8 00 00 00 00       	mov    $0x0,%eax
+  803abf:	5b                   	pop    %rbx
+  803ac0:	41 5c                	pop    %r12
+  803ac2:	5d                   	pop    %rbp
+  803ac3:	c3                   	ret
+
+0000000000803ac4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803ac4:	55                   	push   %rbp
+  803ac5:	48 89 e5             	mov    %rsp,%rbp
+  803ac8:	41 54                	push   %r12
+  803aca:	53                   	push   %rbx
+  803acb:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803ace:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ad3:	48 89 fe             	mov    %rdi,%rsi
+  803ad6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803adb:	49 bc 5e 16 80 00 00 	movabs $0x80165e,%r12
+  803ae2:	00 00 00 
+  803ae5:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803ae8:	48 89 df             	mov    %rbx,%rdi
+  803aeb:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  803af2:	00 00 00 
+  803af5:	ff d0                	call   *%rax
+  803af7:	48 89 c6             	mov    %rax,%rsi
+  803afa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aff:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b04:	41 ff d4             	call   *%r12
+}
+  803b07:	5b                   	pop    %rbx
+  803b08:	41 5c                	pop    %r12
+  803b0a:	5d                   	pop    %rbp
+  803b0b:	c3                   	ret
+
+0000000000803b0c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b0c:	55                   	push   %rbp
+  803b0d:	48 89 e5             	mov    %rsp,%rbp
+  803b10:	41 57                	push   %r15
+  803b12:	41 56                	push   %r14
+  803b14:	41 55                	push   %r13
+  803b16:	41 54                	push   %r12
+  803b18:	53                   	push   %rbx
+  803b19:	48 83 ec 18          	sub    $0x18,%rsp
+  803b1d:	49 89 fc             	mov    %rdi,%r12
+  803b20:	49 89 f5             	mov    %rsi,%r13
+  803b23:	49 89 d7             	mov    %rdx,%r15
+  803b26:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b2a:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  803b31:	00 00 00 
+  803b34:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803b36:	4d 85 ff             	test   %r15,%r15
+  803b39:	0f 84 af 00 00 00    	je     803bee <devpipe_write+0xe2>
+  803b3f:	48 89 c3             	mov    %rax,%rbx
+  803b42:	4c 89 f8             	mov    %r15,%rax
+  803b45:	4d 89 ef             	mov    %r13,%r15
+  803b48:	4c 01 e8             	add    %r13,%rax
+  803b4b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b4f:	49 bd 53 14 80 00 00 	movabs $0x801453,%r13
+  803b56:	00 00 00 
+            sys_yield();
+  803b59:	49 be f0 13 80 00 00 	movabs $0x8013f0,%r14
+  803b60:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b63:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b66:	48 63 ce             	movslq %esi,%rcx
+  803b69:	48 63 03             	movslq (%rbx),%rax
+  803b6c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803b72:	48 39 c1             	cmp    %rax,%rcx
+  803b75:	72 2e                	jb     803ba5 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b77:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b7c:	48 89 da             	mov    %rbx,%rdx
+  803b7f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b84:	4c 89 e7             	mov    %r12,%rdi
+  803b87:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b8a:	85 c0                	test   %eax,%eax
+  803b8c:	74 66                	je     803bf4 <devpipe_write+0xe8>
+            sys_yield();
+  803b8e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b91:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b94:	48 63 ce             	movslq %esi,%rcx
+  803b97:	48 63 03             	movslq (%rbx),%rax
+  803b9a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803ba0:	48 39 c1             	cmp    %rax,%rcx
+  803ba3:	73 d2                	jae    803b77 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803ba5:	41 0f b6 3f          	movzbl (%r15),%edi
+  803ba9:	48 89 ca             	mov    %rcx,%rdx
+  803bac:	48 c1 ea 03          	shr    $0x3,%rdx
+  803bb0:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803bb7:	08 10 20 
+  803bba:	48 f7 e2             	mul    %rdx
+  803bbd:	48 c1 ea 06          	shr    $0x6,%rdx
+  803bc1:	48 89 d0             	mov    %rdx,%rax
+  803bc4:	48 c1 e0 09          	shl    $0x9,%rax
+  803bc8:	48 29 d0             	sub    %rdx,%rax
+  803bcb:	48 c1 e0 03          	shl    $0x3,%rax
+  803bcf:	48 29 c1             	sub    %rax,%rcx
+  803bd2:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803bd7:	83 c6 01             	add    $0x1,%esi
+  803bda:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803bdd:	49 83 c7 01          	add    $0x1,%r15
+  803be1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803be5:	49 39 c7             	cmp    %rax,%r15
+  803be8:	0f 85 75 ff ff ff    	jne    803b63 <devpipe_write+0x57>
+    return n;
+  803bee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803bf2:	eb 05                	jmp    803bf9 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bf9:	48 83 c4 18          	add    $0x18,%rsp
+  803bfd:	5b                   	pop    %rbx
+  803bfe:	41 5c                	pop    %r12
+  803c00:	41 5d                	pop    %r13
+  803c02:	41 5e                	pop    %r14
+  803c04:	41 5f                	pop    %r15
+  803c06:	5d                   	pop    %rbp
+  803c07:	c3                   	ret
+
+0000000000803c08 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c08:	55                   	push   %rbp
+  803c09:	48 89 e5             	mov    %rsp,%rbp
+  803c0c:	41 57                	push   %r15
+  803c0e:	41 56                	push   %r14
+  803c10:	41 55                	push   %r13
+  803c12:	41 54                	push   %r12
+  803c14:	53                   	push   %rbx
+  803c15:	48 83 ec 18          	sub    $0x18,%rsp
+  803c19:	49 89 fc             	mov    %rdi,%r12
+  803c1c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803c20:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c24:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  803c2b:	00 00 00 
+  803c2e:	ff d0                	call   *%rax
+  803c30:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c33:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803c39:	49 bd 53 14 80 00 00 	movabs $0x801453,%r13
+  803c40:	00 00 00 
+            sys_yield();
+  803c43:	49 be f0 13 80 00 00 	movabs $0x8013f0,%r14
+  803c4a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803c4d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c52:	74 7d                	je     803cd1 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803c54:	8b 03                	mov    (%rbx),%eax
+  803c56:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c59:	75 26                	jne    803c81 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803c5b:	4d 85 ff             	test   %r15,%r15
+  803c5e:	75 77                	jne    803cd7 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803c60:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c65:	48 89 da             	mov    %rbx,%rdx
+  803c68:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c6d:	4c 89 e7             	mov    %r12,%rdi
+  803c70:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803c73:	85 c0                	test   %eax,%eax
+  803c75:	74 72                	je     803ce9 <devpipe_read+0xe1>
+            sys_yield();
+  803c77:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803c7a:	8b 03                	mov    (%rbx),%eax
+  803c7c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c7f:	74 df                	je     803c60 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803c81:	48 63 c8             	movslq %eax,%rcx
+  803c84:	48 89 ca             	mov    %rcx,%rdx
+  803c87:	48 c1 ea 03          	shr    $0x3,%rdx
+  803c8b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803c92:	08 10 20 
+  803c95:	48 89 d0             	mov    %rdx,%rax
+  803c98:	48 f7 e6             	mul    %rsi
+  803c9b:	48 c1 ea 06          	shr    $0x6,%rdx
+  803c9f:	48 89 d0             	mov    %rdx,%rax
+  803ca2:	48 c1 e0 09          	shl    $0x9,%rax
+  803ca6:	48 29 d0             	sub    %rdx,%rax
+  803ca9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803cb0:	00 
+  803cb1:	48 89 c8             	mov    %rcx,%rax
+  803cb4:	48 29 d0             	sub    %rdx,%rax
+  803cb7:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803cbc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803cc0:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803cc4:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803cc7:	49 83 c7 01          	add    $0x1,%r15
+  803ccb:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803ccf:	75 83                	jne    803c54 <devpipe_read+0x4c>
+    return n;
+  803cd1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cd5:	eb 03                	jmp    803cda <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803cd7:	4c 89 f8             	mov    %r15,%rax
+}
+  803cda:	48 83 c4 18          	add    $0x18,%rsp
+  803cde:	5b                   	pop    %rbx
+  803cdf:	41 5c                	pop    %r12
+  803ce1:	41 5d                	pop    %r13
+  803ce3:	41 5e                	pop    %r14
+  803ce5:	41 5f                	pop    %r15
+  803ce7:	5d                   	pop    %rbp
+  803ce8:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cee:	eb ea                	jmp    803cda <devpipe_read+0xd2>
+
+0000000000803cf0 <pipe>:
+pipe(int pfd[2]) {
+  803cf0:	55                   	push   %rbp
+  803cf1:	48 89 e5             	mov    %rsp,%rbp
+  803cf4:	41 55                	push   %r13
+  803cf6:	41 54                	push   %r12
+  803cf8:	53                   	push   %rbx
+  803cf9:	48 83 ec 18          	sub    $0x18,%rsp
+  803cfd:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d00:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d04:	48 b8 74 22 80 00 00 	movabs $0x802274,%rax
+  803d0b:	00 00 00 
+  803d0e:	ff d0                	call   *%rax
+  803d10:	89 c3                	mov    %eax,%ebx
+  803d12:	85 c0                	test   %eax,%eax
+  803d14:	0f 88 a0 01 00 00    	js     803eba <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803d1a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d1f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d24:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d28:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d2d:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  803d34:	00 00 00 
+  803d37:	ff d0                	call   *%rax
+  803d39:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d3b:	85 c0                	test   %eax,%eax
+  803d3d:	0f 88 77 01 00 00    	js     803eba <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803d43:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803d47:	48 b8 74 22 80 00 00 	movabs $0x802274,%rax
+  803d4e:	00 00 00 
+  803d51:	ff d0                	call   *%rax
+  803d53:	89 c3                	mov    %eax,%ebx
+  803d55:	85 c0                	test   %eax,%eax
+  803d57:	0f 88 43 01 00 00    	js     803ea0 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803d5d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d62:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d67:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d70:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  803d77:	00 00 00 
+  803d7a:	ff d0                	call   *%rax
+  803d7c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803d7e:	85 c0                	test   %eax,%eax
+  803d80:	0f 88 1a 01 00 00    	js     803ea0 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803d86:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d8a:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  803d91:	00 00 00 
+  803d94:	ff d0                	call   *%rax
+  803d96:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803d99:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d9e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803da3:	48 89 c6             	mov    %rax,%rsi
+  803da6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dab:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  803db2:	00 00 00 
+  803db5:	ff d0                	call   *%rax
+  803db7:	89 c3                	mov    %eax,%ebx
+  803db9:	85 c0                	test   %eax,%eax
+  803dbb:	0f 88 c5 00 00 00    	js     803e86 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803dc1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803dc5:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  803dcc:	00 00 00 
+  803dcf:	ff d0                	call   *%rax
+  803dd1:	48 89 c1             	mov    %rax,%rcx
+  803dd4:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803dda:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803de0:	ba 00 00 00 00       	mov    $0x0,%edx
+  803de5:	4c 89 ee             	mov    %r13,%rsi
+  803de8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ded:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  803df4:	00 00 00 
+  803df7:	ff d0                	call   *%rax
+  803df9:	89 c3                	mov    %eax,%ebx
+  803dfb:	85 c0                	test   %eax,%eax
+  803dfd:	78 6e                	js     803e6d <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803dff:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e04:	4c 89 ef             	mov    %r13,%rdi
+  803e07:	48 b8 21 14 80 00 00 	movabs $0x801421,%rax
+  803e0e:	00 00 00 
+  803e11:	ff d0                	call   *%rax
+  803e13:	83 f8 02             	cmp    $0x2,%eax
+  803e16:	0f 85 ab 00 00 00    	jne    803ec7 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803e1c:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803e23:	00 00 
+  803e25:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e29:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803e2b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e2f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803e36:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803e3a:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803e3c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e40:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803e47:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e4b:	48 bb 46 22 80 00 00 	movabs $0x802246,%rbx
+  803e52:	00 00 00 
+  803e55:	ff d3                	call   *%rbx
+  803e57:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803e5b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e5f:	ff d3                	call   *%rbx
+  803e61:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803e66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e6b:	eb 4d                	jmp    803eba <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803e6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e72:	4c 89 ee             	mov    %r13,%rsi
+  803e75:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e7a:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  803e81:	00 00 00 
+  803e84:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803e86:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e8b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e94:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  803e9b:	00 00 00 
+  803e9e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803ea0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ea5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ea9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eae:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  803eb5:	00 00 00 
+  803eb8:	ff d0                	call   *%rax
+}
+  803eba:	89 d8                	mov    %ebx,%eax
+  803ebc:	48 83 c4 18          	add    $0x18,%rsp
+  803ec0:	5b                   	pop    %rbx
+  803ec1:	41 5c                	pop    %r12
+  803ec3:	41 5d                	pop    %r13
+  803ec5:	5d                   	pop    %rbp
+  803ec6:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803ec7:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  803ece:	00 00 00 
+  803ed1:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  803ed8:	00 00 00 
+  803edb:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803ee0:	48 bf 1c 57 80 00 00 	movabs $0x80571c,%rdi
+  803ee7:	00 00 00 
+  803eea:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eef:	49 b8 57 02 80 00 00 	movabs $0x800257,%r8
+  803ef6:	00 00 00 
+  803ef9:	41 ff d0             	call   *%r8
+
+0000000000803efc <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803efc:	55                   	push   %rbp
+  803efd:	48 89 e5             	mov    %rsp,%rbp
+  803f00:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f04:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f08:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  803f0f:	00 00 00 
+  803f12:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f14:	85 c0                	test   %eax,%eax
+  803f16:	78 35                	js     803f4d <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803f18:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f1c:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  803f23:	00 00 00 
+  803f26:	ff d0                	call   *%rax
+  803f28:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f2b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f30:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f35:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f39:	48 b8 53 14 80 00 00 	movabs $0x801453,%rax
+  803f40:	00 00 00 
+  803f43:	ff d0                	call   *%rax
+  803f45:	85 c0                	test   %eax,%eax
+  803f47:	0f 94 c0             	sete   %al
+  803f4a:	0f b6 c0             	movzbl %al,%eax
+}
+  803f4d:	c9                   	leave
+  803f4e:	c3                   	ret
+
+0000000000803f4f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f4f:	48 89 f8             	mov    %rdi,%rax
+  803f52:	48 c1 e8 27          	shr    $0x27,%rax
+  803f56:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803f5d:	7f 00 00 
+  803f60:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f64:	f6 c2 01             	test   $0x1,%dl
+  803f67:	74 6d                	je     803fd6 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f69:	48 89 f8             	mov    %rdi,%rax
+  803f6c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f70:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f77:	7f 00 00 
+  803f7a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f7e:	f6 c2 01             	test   $0x1,%dl
+  803f81:	74 62                	je     803fe5 <get_uvpt_entry+0x96>
+  803f83:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f8a:	7f 00 00 
+  803f8d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f91:	f6 c2 80             	test   $0x80,%dl
+  803f94:	75 4f                	jne    803fe5 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f96:	48 89 f8             	mov    %rdi,%rax
+  803f99:	48 c1 e8 15          	shr    $0x15,%rax
+  803f9d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803fa4:	7f 00 00 
+  803fa7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fab:	f6 c2 01             	test   $0x1,%dl
+  803fae:	74 44                	je     803ff4 <get_uvpt_entry+0xa5>
+  803fb0:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803fb7:	7f 00 00 
+  803fba:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fbe:	f6 c2 80             	test   $0x80,%dl
+  803fc1:	75 31                	jne    803ff4 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803fc3:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803fc7:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803fce:	7f 00 00 
+  803fd1:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803fd5:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fd6:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803fdd:	7f 00 00 
+  803fe0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803fe4:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803fe5:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803fec:	7f 00 00 
+  803fef:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ff3:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ff4:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ffb:	7f 00 00 
+  803ffe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804002:	c3                   	ret
+
+0000000000804003 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  804003:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804006:	48 89 f9             	mov    %rdi,%rcx
+  804009:	48 c1 e9 27          	shr    $0x27,%rcx
+  80400d:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804014:	7f 00 00 
+  804017:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80401b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804022:	f6 c1 01             	test   $0x1,%cl
+  804025:	0f 84 b2 00 00 00    	je     8040dd <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80402b:	48 89 f9             	mov    %rdi,%rcx
+  80402e:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804032:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804039:	7f 00 00 
+  80403c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804040:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804047:	40 f6 c6 01          	test   $0x1,%sil
+  80404b:	0f 84 8c 00 00 00    	je     8040dd <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804051:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804058:	7f 00 00 
+  80405b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80405f:	a8 80                	test   $0x80,%al
+  804061:	75 7b                	jne    8040de <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804063:	48 89 f9             	mov    %rdi,%rcx
+  804066:	48 c1 e9 15          	shr    $0x15,%rcx
+  80406a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804071:	7f 00 00 
+  804074:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804078:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80407f:	40 f6 c6 01          	test   $0x1,%sil
+  804083:	74 58                	je     8040dd <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  804085:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80408c:	7f 00 00 
+  80408f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804093:	a8 80                	test   $0x80,%al
+  804095:	75 6c                	jne    804103 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804097:	48 89 f9             	mov    %rdi,%rcx
+  80409a:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80409e:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8040a5:	7f 00 00 
+  8040a8:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8040ac:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8040b3:	40 f6 c6 01          	test   $0x1,%sil
+  8040b7:	74 24                	je     8040dd <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8040b9:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8040c0:	7f 00 00 
+  8040c3:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8040c7:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8040ce:	ff ff 7f 
+  8040d1:	48 21 c8             	and    %rcx,%rax
+  8040d4:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8040da:	48 09 d0             	or     %rdx,%rax
+}
+  8040dd:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8040de:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8040e5:	7f 00 00 
+  8040e8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8040ec:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8040f3:	ff ff 7f 
+  8040f6:	48 21 c8             	and    %rcx,%rax
+  8040f9:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8040ff:	48 01 d0             	add    %rdx,%rax
+  804102:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804103:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80410a:	7f 00 00 
+  80410d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804111:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804118:	ff ff 7f 
+  80411b:	48 21 c8             	and    %rcx,%rax
+  80411e:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804124:	48 01 d0             	add    %rdx,%rax
+  804127:	c3                   	ret
+
+0000000000804128 <get_prot>:
+
+int
+get_prot(void *va) {
+  804128:	55                   	push   %rbp
+  804129:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80412c:	48 b8 4f 3f 80 00 00 	movabs $0x803f4f,%rax
+  804133:	00 00 00 
+  804136:	ff d0                	call   *%rax
+  804138:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80413b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804140:	89 c1                	mov    %eax,%ecx
+  804142:	83 c9 04             	or     $0x4,%ecx
+  804145:	f6 c2 01             	test   $0x1,%dl
+  804148:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80414b:	89 c1                	mov    %eax,%ecx
+  80414d:	83 c9 02             	or     $0x2,%ecx
+  804150:	f6 c2 02             	test   $0x2,%dl
+  804153:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804156:	89 c1                	mov    %eax,%ecx
+  804158:	83 c9 01             	or     $0x1,%ecx
+  80415b:	48 85 d2             	test   %rdx,%rdx
+  80415e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804161:	89 c1                	mov    %eax,%ecx
+  804163:	83 c9 40             	or     $0x40,%ecx
+  804166:	f6 c6 04             	test   $0x4,%dh
+  804169:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80416c:	5d                   	pop    %rbp
+  80416d:	c3                   	ret
+
+000000000080416e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80416e:	55                   	push   %rbp
+  80416f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804172:	48 b8 4f 3f 80 00 00 	movabs $0x803f4f,%rax
+  804179:	00 00 00 
+  80417c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80417e:	48 c1 e8 06          	shr    $0x6,%rax
+  804182:	83 e0 01             	and    $0x1,%eax
+}
+  804185:	5d                   	pop    %rbp
+  804186:	c3                   	ret
+
+0000000000804187 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804187:	55                   	push   %rbp
+  804188:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80418b:	48 b8 4f 3f 80 00 00 	movabs $0x803f4f,%rax
+  804192:	00 00 00 
+  804195:	ff d0                	call   *%rax
+  804197:	83 e0 01             	and    $0x1,%eax
+}
+  80419a:	5d                   	pop    %rbp
+  80419b:	c3                   	ret
+
+000000000080419c <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  80419c:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8041a3:	7f 00 00 
+  8041a6:	a8 01                	test   $0x1,%al
+  8041a8:	75 06                	jne    8041b0 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8041aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041af:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8041b0:	55                   	push   %rbp
+  8041b1:	48 89 e5             	mov    %rsp,%rbp
+  8041b4:	41 57                	push   %r15
+  8041b6:	41 56                	push   %r14
+  8041b8:	41 55                	push   %r13
+  8041ba:	41 54                	push   %r12
+  8041bc:	53                   	push   %rbx
+  8041bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8041c1:	49 89 fe             	mov    %rdi,%r14
+  8041c4:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8041c7:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8041ce:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8041cf:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  8041d6:	7f 00 00 
+  8041d9:	e9 81 00 00 00       	jmp    80425f <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  8041de:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8041e5:	49 39 dd             	cmp    %rbx,%r13
+  8041e8:	74 2b                	je     804215 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8041ea:	48 89 d8             	mov    %rbx,%rax
+  8041ed:	48 c1 e8 0c          	shr    $0xc,%rax
+  8041f1:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  8041f5:	f6 c2 01             	test   $0x1,%dl
+  8041f8:	74 e4                	je     8041de <foreach_shared_region+0x42>
+  8041fa:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  8041fe:	f6 c4 04             	test   $0x4,%ah
+  804201:	74 db                	je     8041de <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804203:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80420a:	4c 89 fa             	mov    %r15,%rdx
+  80420d:	48 89 df             	mov    %rbx,%rdi
+  804210:	41 ff d6             	call   *%r14
+  804213:	eb c9                	jmp    8041de <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804215:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  80421c:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804220:	74 22                	je     804244 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804222:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804229:	48 89 d8             	mov    %rbx,%rax
+  80422c:	48 c1 e8 15          	shr    $0x15,%rax
+  804230:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804237:	7f 00 00 
+  80423a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80423e:	a8 01                	test   $0x1,%al
+  804240:	74 d3                	je     804215 <foreach_shared_region+0x79>
+  804242:	eb a6                	jmp    8041ea <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804244:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  80424b:	40 
+  80424c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804250:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804257:	00 00 00 
+  80425a:	48 39 c1             	cmp    %rax,%rcx
+  80425d:	74 31                	je     804290 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  80425f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804263:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804267:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  80426e:	7f 00 00 
+  804271:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804275:	a8 01                	test   $0x1,%al
+  804277:	74 cb                	je     804244 <foreach_shared_region+0xa8>
+  804279:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80427d:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804284:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  80428a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80428e:	eb 92                	jmp    804222 <foreach_shared_region+0x86>
+}
+  804290:	b8 00 00 00 00       	mov    $0x0,%eax
+  804295:	48 83 c4 18          	add    $0x18,%rsp
+  804299:	5b                   	pop    %rbx
+  80429a:	41 5c                	pop    %r12
+  80429c:	41 5d                	pop    %r13
+  80429e:	41 5e                	pop    %r14
+  8042a0:	41 5f                	pop    %r15
+  8042a2:	5d                   	pop    %rbp
+  8042a3:	c3                   	ret
+
+00000000008042a4 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8042a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042a9:	c3                   	ret
+
+00000000008042aa <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8042aa:	55                   	push   %rbp
+  8042ab:	48 89 e5             	mov    %rsp,%rbp
+  8042ae:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8042b1:	48 be 54 57 80 00 00 	movabs $0x805754,%rsi
+  8042b8:	00 00 00 
+  8042bb:	48 b8 1f 0d 80 00 00 	movabs $0x800d1f,%rax
+  8042c2:	00 00 00 
+  8042c5:	ff d0                	call   *%rax
+    return 0;
+}
+  8042c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042cc:	5d                   	pop    %rbp
+  8042cd:	c3                   	ret
+
+00000000008042ce <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8042ce:	55                   	push   %rbp
+  8042cf:	48 89 e5             	mov    %rsp,%rbp
+  8042d2:	41 57                	push   %r15
+  8042d4:	41 56                	push   %r14
+  8042d6:	41 55                	push   %r13
+  8042d8:	41 54                	push   %r12
+  8042da:	53                   	push   %rbx
+  8042db:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8042e2:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8042e9:	48 85 d2             	test   %rdx,%rdx
+  8042ec:	74 7a                	je     804368 <devcons_write+0x9a>
+  8042ee:	49 89 d6             	mov    %rdx,%r14
+  8042f1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042f7:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042fc:	49 bf ad 10 80 00 00 	movabs $0x8010ad,%r15
+  804303:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804306:	4c 89 f3             	mov    %r14,%rbx
+  804309:	48 29 f3             	sub    %rsi,%rbx
+  80430c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804311:	48 39 c3             	cmp    %rax,%rbx
+  804314:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804318:	4c 63 eb             	movslq %ebx,%r13
+  80431b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804322:	48 01 c6             	add    %rax,%rsi
+  804325:	4c 89 ea             	mov    %r13,%rdx
+  804328:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80432f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804332:	4c 89 ee             	mov    %r13,%rsi
+  804335:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80433c:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  804343:	00 00 00 
+  804346:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804348:	41 01 dc             	add    %ebx,%r12d
+  80434b:	49 63 f4             	movslq %r12d,%rsi
+  80434e:	4c 39 f6             	cmp    %r14,%rsi
+  804351:	72 b3                	jb     804306 <devcons_write+0x38>
+    return res;
+  804353:	49 63 c4             	movslq %r12d,%rax
+}
+  804356:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80435d:	5b                   	pop    %rbx
+  80435e:	41 5c                	pop    %r12
+  804360:	41 5d                	pop    %r13
+  804362:	41 5e                	pop    %r14
+  804364:	41 5f                	pop    %r15
+  804366:	5d                   	pop    %rbp
+  804367:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804368:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80436e:	eb e3                	jmp    804353 <devcons_write+0x85>
+
+0000000000804370 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804370:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804373:	ba 00 00 00 00       	mov    $0x0,%edx
+  804378:	48 85 c0             	test   %rax,%rax
+  80437b:	74 55                	je     8043d2 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80437d:	55                   	push   %rbp
+  80437e:	48 89 e5             	mov    %rsp,%rbp
+  804381:	41 55                	push   %r13
+  804383:	41 54                	push   %r12
+  804385:	53                   	push   %rbx
+  804386:	48 83 ec 08          	sub    $0x8,%rsp
+  80438a:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80438d:	48 bb 23 13 80 00 00 	movabs $0x801323,%rbx
+  804394:	00 00 00 
+  804397:	49 bc f0 13 80 00 00 	movabs $0x8013f0,%r12
+  80439e:	00 00 00 
+  8043a1:	eb 03                	jmp    8043a6 <devcons_read+0x36>
+  8043a3:	41 ff d4             	call   *%r12
+  8043a6:	ff d3                	call   *%rbx
+  8043a8:	85 c0                	test   %eax,%eax
+  8043aa:	74 f7                	je     8043a3 <devcons_read+0x33>
+    if (c < 0) return c;
+  8043ac:	48 63 d0             	movslq %eax,%rdx
+  8043af:	78 13                	js     8043c4 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8043b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043b6:	83 f8 04             	cmp    $0x4,%eax
+  8043b9:	74 09                	je     8043c4 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8043bb:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8043bf:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8043c4:	48 89 d0             	mov    %rdx,%rax
+  8043c7:	48 83 c4 08          	add    $0x8,%rsp
+  8043cb:	5b                   	pop    %rbx
+  8043cc:	41 5c                	pop    %r12
+  8043ce:	41 5d                	pop    %r13
+  8043d0:	5d                   	pop    %rbp
+  8043d1:	c3                   	ret
+  8043d2:	48 89 d0             	mov    %rdx,%rax
+  8043d5:	c3                   	ret
+
+00000000008043d6 <cputchar>:
+cputchar(int ch) {
+  8043d6:	55                   	push   %rbp
+  8043d7:	48 89 e5             	mov    %rsp,%rbp
+  8043da:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8043de:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8043e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8043e7:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8043eb:	48 b8 f6 12 80 00 00 	movabs $0x8012f6,%rax
+  8043f2:	00 00 00 
+  8043f5:	ff d0                	call   *%rax
+}
+  8043f7:	c9                   	leave
+  8043f8:	c3                   	ret
+
+00000000008043f9 <getchar>:
+getchar(void) {
+  8043f9:	55                   	push   %rbp
+  8043fa:	48 89 e5             	mov    %rsp,%rbp
+  8043fd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804401:	ba 01 00 00 00       	mov    $0x1,%edx
+  804406:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80440a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80440f:	48 b8 b7 25 80 00 00 	movabs $0x8025b7,%rax
+  804416:	00 00 00 
+  804419:	ff d0                	call   *%rax
+  80441b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80441d:	85 c0                	test   %eax,%eax
+  80441f:	78 06                	js     804427 <getchar+0x2e>
+  804421:	74 08                	je     80442b <getchar+0x32>
+  804423:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804427:	89 d0                	mov    %edx,%eax
+  804429:	c9                   	leave
+  80442a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80442b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804430:	eb f5                	jmp    804427 <getchar+0x2e>
+
+0000000000804432 <iscons>:
+iscons(int fdnum) {
+  804432:	55                   	push   %rbp
+  804433:	48 89 e5             	mov    %rsp,%rbp
+  804436:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80443a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80443e:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  804445:	00 00 00 
+  804448:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80444a:	85 c0                	test   %eax,%eax
+  80444c:	78 18                	js     804466 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80444e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804452:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804459:	00 00 00 
+  80445c:	8b 00                	mov    (%rax),%eax
+  80445e:	39 02                	cmp    %eax,(%rdx)
+  804460:	0f 94 c0             	sete   %al
+  804463:	0f b6 c0             	movzbl %al,%eax
+}
+  804466:	c9                   	leave
+  804467:	c3                   	ret
+
+0000000000804468 <opencons>:
+opencons(void) {
+  804468:	55                   	push   %rbp
+  804469:	48 89 e5             	mov    %rsp,%rbp
+  80446c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804470:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804474:	48 b8 74 22 80 00 00 	movabs $0x802274,%rax
+  80447b:	00 00 00 
+  80447e:	ff d0                	call   *%rax
+  804480:	85 c0                	test   %eax,%eax
+  804482:	78 49                	js     8044cd <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804484:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804489:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80448e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804492:	bf 00 00 00 00       	mov    $0x0,%edi
+  804497:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  80449e:	00 00 00 
+  8044a1:	ff d0                	call   *%rax
+  8044a3:	85 c0                	test   %eax,%eax
+  8044a5:	78 26                	js     8044cd <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8044a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044ab:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8044b2:	00 00 
+  8044b4:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8044b6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8044ba:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8044c1:	48 b8 46 22 80 00 00 	movabs $0x802246,%rax
+  8044c8:	00 00 00 
+  8044cb:	ff d0                	call   *%rax
+}
+  8044cd:	c9                   	leave
+  8044ce:	c3                   	ret
+
+00000000008044cf <__text_end>:
+  8044cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d6:	00 00 00 
+  8044d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e0:	00 00 00 
+  8044e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ea:	00 00 00 
+  8044ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f4:	00 00 00 
+  8044f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fe:	00 00 00 
+  804501:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804508:	00 00 00 
+  80450b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804512:	00 00 00 
+  804515:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451c:	00 00 00 
+  80451f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804526:	00 00 00 
+  804529:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804530:	00 00 00 
+  804533:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453a:	00 00 00 
+  80453d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804544:	00 00 00 
+  804547:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454e:	00 00 00 
+  804551:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804558:	00 00 00 
+  80455b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804562:	00 00 00 
+  804565:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456c:	00 00 00 
+  80456f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804576:	00 00 00 
+  804579:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804580:	00 00 00 
+  804583:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458a:	00 00 00 
+  80458d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804594:	00 00 00 
+  804597:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459e:	00 00 00 
+  8045a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a8:	00 00 00 
+  8045ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b2:	00 00 00 
+  8045b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bc:	00 00 00 
+  8045bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c6:	00 00 00 
+  8045c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d0:	00 00 00 
+  8045d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045da:	00 00 00 
+  8045dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e4:	00 00 00 
+  8045e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ee:	00 00 00 
+  8045f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f8:	00 00 00 
+  8045fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804602:	00 00 00 
+  804605:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460c:	00 00 00 
+  80460f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804616:	00 00 00 
+  804619:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804620:	00 00 00 
+  804623:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462a:	00 00 00 
+  80462d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804634:	00 00 00 
+  804637:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463e:	00 00 00 
+  804641:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804648:	00 00 00 
+  80464b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804652:	00 00 00 
+  804655:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465c:	00 00 00 
+  80465f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804666:	00 00 00 
+  804669:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804670:	00 00 00 
+  804673:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467a:	00 00 00 
+  80467d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804684:	00 00 00 
+  804687:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468e:	00 00 00 
+  804691:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804698:	00 00 00 
+  80469b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a2:	00 00 00 
+  8046a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ac:	00 00 00 
+  8046af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b6:	00 00 00 
+  8046b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c0:	00 00 00 
+  8046c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ca:	00 00 00 
+  8046cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d4:	00 00 00 
+  8046d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046de:	00 00 00 
+  8046e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e8:	00 00 00 
+  8046eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f2:	00 00 00 
+  8046f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fc:	00 00 00 
+  8046ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804706:	00 00 00 
+  804709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804710:	00 00 00 
+  804713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471a:	00 00 00 
+  80471d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804724:	00 00 00 
+  804727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472e:	00 00 00 
+  804731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804738:	00 00 00 
+  80473b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804742:	00 00 00 
+  804745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474c:	00 00 00 
+  80474f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804756:	00 00 00 
+  804759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804760:	00 00 00 
+  804763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476a:	00 00 00 
+  80476d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804774:	00 00 00 
+  804777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477e:	00 00 00 
+  804781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804788:	00 00 00 
+  80478b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804792:	00 00 00 
+  804795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479c:	00 00 00 
+  80479f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a6:	00 00 00 
+  8047a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b0:	00 00 00 
+  8047b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ba:	00 00 00 
+  8047bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c4:	00 00 00 
+  8047c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ce:	00 00 00 
+  8047d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d8:	00 00 00 
+  8047db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e2:	00 00 00 
+  8047e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ec:	00 00 00 
+  8047ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f6:	00 00 00 
+  8047f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804800:	00 00 00 
+  804803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480a:	00 00 00 
+  80480d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804814:	00 00 00 
+  804817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481e:	00 00 00 
+  804821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804828:	00 00 00 
+  80482b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804832:	00 00 00 
+  804835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483c:	00 00 00 
+  80483f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804846:	00 00 00 
+  804849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804850:	00 00 00 
+  804853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485a:	00 00 00 
+  80485d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804864:	00 00 00 
+  804867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486e:	00 00 00 
+  804871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804878:	00 00 00 
+  80487b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804882:	00 00 00 
+  804885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488c:	00 00 00 
+  80488f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804896:	00 00 00 
+  804899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a0:	00 00 00 
+  8048a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048aa:	00 00 00 
+  8048ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b4:	00 00 00 
+  8048b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048be:	00 00 00 
+  8048c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c8:	00 00 00 
+  8048cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d2:	00 00 00 
+  8048d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dc:	00 00 00 
+  8048df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e6:	00 00 00 
+  8048e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f0:	00 00 00 
+  8048f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fa:	00 00 00 
+  8048fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804904:	00 00 00 
+  804907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490e:	00 00 00 
+  804911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804918:	00 00 00 
+  80491b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804922:	00 00 00 
+  804925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492c:	00 00 00 
+  80492f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804936:	00 00 00 
+  804939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804940:	00 00 00 
+  804943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494a:	00 00 00 
+  80494d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804954:	00 00 00 
+  804957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495e:	00 00 00 
+  804961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804968:	00 00 00 
+  80496b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804972:	00 00 00 
+  804975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497c:	00 00 00 
+  80497f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804986:	00 00 00 
+  804989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804990:	00 00 00 
+  804993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499a:	00 00 00 
+  80499d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a4:	00 00 00 
+  8049a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ae:	00 00 00 
+  8049b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b8:	00 00 00 
+  8049bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c2:	00 00 00 
+  8049c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cc:	00 00 00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e0:	00 00 00 
+  8049e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ea:	00 00 00 
+  8049ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f4:	00 00 00 
+  8049f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fe:	00 00 00 
+  804a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a08:	00 00 00 
+  804a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a12:	00 00 00 
+  804a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1c:	00 00 00 
+  804a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a26:	00 00 00 
+  804a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a30:	00 00 00 
+  804a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3a:	00 00 00 
+  804a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a44:	00 00 00 
+  804a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4e:	00 00 00 
+  804a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a58:	00 00 00 
+  804a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a62:	00 00 00 
+  804a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6c:	00 00 00 
+  804a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a76:	00 00 00 
+  804a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a80:	00 00 00 
+  804a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8a:	00 00 00 
+  804a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a94:	00 00 00 
+  804a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9e:	00 00 00 
+  804aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa8:	00 00 00 
+  804aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab2:	00 00 00 
+  804ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abc:	00 00 00 
+  804abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac6:	00 00 00 
+  804ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad0:	00 00 00 
+  804ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ada:	00 00 00 
+  804add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae4:	00 00 00 
+  804ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aee:	00 00 00 
+  804af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af8:	00 00 00 
+  804afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b02:	00 00 00 
+  804b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0c:	00 00 00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b20:	00 00 00 
+  804b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2a:	00 00 00 
+  804b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b34:	00 00 00 
+  804b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3e:	00 00 00 
+  804b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b48:	00 00 00 
+  804b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b52:	00 00 00 
+  804b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5c:	00 00 00 
+  804b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b66:	00 00 00 
+  804b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b70:	00 00 00 
+  804b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7a:	00 00 00 
+  804b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b84:	00 00 00 
+  804b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8e:	00 00 00 
+  804b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b98:	00 00 00 
+  804b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba2:	00 00 00 
+  804ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bac:	00 00 00 
+  804baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb6:	00 00 00 
+  804bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc0:	00 00 00 
+  804bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bca:	00 00 00 
+  804bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd4:	00 00 00 
+  804bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bde:	00 00 00 
+  804be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be8:	00 00 00 
+  804beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf2:	00 00 00 
+  804bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfc:	00 00 00 
+  804bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c06:	00 00 00 
+  804c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c10:	00 00 00 
+  804c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1a:	00 00 00 
+  804c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c24:	00 00 00 
+  804c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2e:	00 00 00 
+  804c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c38:	00 00 00 
+  804c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c42:	00 00 00 
+  804c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4c:	00 00 00 
+  804c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c56:	00 00 00 
+  804c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c60:	00 00 00 
+  804c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6a:	00 00 00 
+  804c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c74:	00 00 00 
+  804c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7e:	00 00 00 
+  804c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c88:	00 00 00 
+  804c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c92:	00 00 00 
+  804c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9c:	00 00 00 
+  804c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca6:	00 00 00 
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
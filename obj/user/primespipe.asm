@@ -0,0 +1,8273 @@
+
+obj/user/primespipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 36 03 00 00       	call   800359 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	89 fb                	mov    %edi,%ebx
+    int id, p, pfd[2], wfd, r;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    if ((r = readn(fd, &p, 4)) != 4)
+  800038:	49 bc a0 25 80 00 00 	movabs $0x8025a0,%r12
+  80003f:	00 00 00 
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+
+    cprintf("%d\n", p);
+  800042:	49 bf 41 50 80 00 00 	movabs $0x805041,%r15
+  800049:	00 00 00 
+  80004c:	49 be 75 05 80 00 00 	movabs $0x800575,%r14
+  800053:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((r = pipe(pfd)) < 0)
+  800056:	49 bd 1b 3c 80 00 00 	movabs $0x803c1b,%r13
+  80005d:	00 00 00 
+    if ((r = readn(fd, &p, 4)) != 4)
+  800060:	ba 04 00 00 00       	mov    $0x4,%edx
+  800065:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  800069:	89 df                	mov    %ebx,%edi
+  80006b:	41 ff d4             	call   *%r12
+  80006e:	89 c1                	mov    %eax,%ecx
+  800070:	83 f8 04             	cmp    $0x4,%eax
+  800073:	75 4b                	jne    8000c0 <primeproc+0x9b>
+    cprintf("%d\n", p);
+  800075:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  800078:	4c 89 ff             	mov    %r15,%rdi
+  80007b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800080:	41 ff d6             	call   *%r14
+    if ((r = pipe(pfd)) < 0)
+  800083:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800087:	41 ff d5             	call   *%r13
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	78 69                	js     8000f7 <primeproc+0xd2>
+        panic("pipe: %i", r);
+    if ((id = fork()) < 0)
+  80008e:	48 b8 63 20 80 00 00 	movabs $0x802063,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	85 c0                	test   %eax,%eax
+  80009c:	0f 88 82 00 00 00    	js     800124 <primeproc+0xff>
+        panic("fork: %i", id);
+    if (id == 0) {
+  8000a2:	0f 85 a9 00 00 00    	jne    800151 <primeproc+0x12c>
+        close(fd);
+  8000a8:	89 df                	mov    %ebx,%edi
+  8000aa:	48 bb 64 23 80 00 00 	movabs $0x802364,%rbx
+  8000b1:	00 00 00 
+  8000b4:	ff d3                	call   *%rbx
+        close(pfd[1]);
+  8000b6:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000b9:	ff d3                	call   *%rbx
+        fd = pfd[0];
+  8000bb:	8b 5d c4             	mov    -0x3c(%rbp),%ebx
+        goto top;
+  8000be:	eb a0                	jmp    800060 <primeproc+0x3b>
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c8:	44 0f 4e c0          	cmovle %eax,%r8d
+  8000cc:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8000d3:	00 00 00 
+  8000d6:	be 14 00 00 00       	mov    $0x14,%esi
+  8000db:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8000e2:	00 00 00 
+  8000e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ea:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  8000f1:	00 00 00 
+  8000f4:	41 ff d1             	call   *%r9
+        panic("pipe: %i", r);
+  8000f7:	89 c1                	mov    %eax,%ecx
+  8000f9:	48 ba 45 50 80 00 00 	movabs $0x805045,%rdx
+  800100:	00 00 00 
+  800103:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800108:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  80010f:	00 00 00 
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+  800117:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  80011e:	00 00 00 
+  800121:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  800124:	89 c1                	mov    %eax,%ecx
+  800126:	48 ba 4e 50 80 00 00 	movabs $0x80504e,%rdx
+  80012d:	00 00 00 
+  800130:	be 1c 00 00 00       	mov    $0x1c,%esi
+  800135:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  80013c:	00 00 00 
+  80013f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800144:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  80014b:	00 00 00 
+  80014e:	41 ff d0             	call   *%r8
+    }
+
+    close(pfd[0]);
+  800151:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  800154:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+    wfd = pfd[1];
+  800160:	44 8b 6d c8          	mov    -0x38(%rbp),%r13d
+
+    /* Filter out multiples of our prime */
+    for (int i;;) {
+        if ((r = readn(fd, &i, 4)) != 4)
+  800164:	49 bc a0 25 80 00 00 	movabs $0x8025a0,%r12
+  80016b:	00 00 00 
+  80016e:	ba 04 00 00 00       	mov    $0x4,%edx
+  800173:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800177:	89 df                	mov    %ebx,%edi
+  800179:	41 ff d4             	call   *%r12
+  80017c:	83 f8 04             	cmp    $0x4,%eax
+  80017f:	75 65                	jne    8001e6 <primeproc+0x1c1>
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+        if (i % p)
+  800181:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  800184:	99                   	cltd
+  800185:	f7 7d cc             	idivl  -0x34(%rbp)
+  800188:	85 d2                	test   %edx,%edx
+  80018a:	74 e2                	je     80016e <primeproc+0x149>
+            if ((r = write(wfd, &i, 4)) != 4)
+  80018c:	ba 04 00 00 00       	mov    $0x4,%edx
+  800191:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800195:	44 89 ef             	mov    %r13d,%edi
+  800198:	48 b8 11 26 80 00 00 	movabs $0x802611,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+  8001a4:	83 f8 04             	cmp    $0x4,%eax
+  8001a7:	74 c5                	je     80016e <primeproc+0x149>
+                panic("primeproc %d write: %d %i", p, r, r >= 0 ? 0 : r);
+  8001a9:	85 c0                	test   %eax,%eax
+  8001ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001b1:	44 0f 4e c8          	cmovle %eax,%r9d
+  8001b5:	41 89 c0             	mov    %eax,%r8d
+  8001b8:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001bb:	48 ba 73 50 80 00 00 	movabs $0x805073,%rdx
+  8001c2:	00 00 00 
+  8001c5:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8001ca:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8001d1:	00 00 00 
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	49 ba 25 04 80 00 00 	movabs $0x800425,%r10
+  8001e0:	00 00 00 
+  8001e3:	41 ff d2             	call   *%r10
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+  8001e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ea:	85 c0                	test   %eax,%eax
+  8001ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f1:	0f 4e d0             	cmovle %eax,%edx
+  8001f4:	52                   	push   %rdx
+  8001f5:	41 89 c1             	mov    %eax,%r9d
+  8001f8:	41 89 d8             	mov    %ebx,%r8d
+  8001fb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001fe:	48 ba 57 50 80 00 00 	movabs $0x805057,%rdx
+  800205:	00 00 00 
+  800208:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80020d:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	49 ba 25 04 80 00 00 	movabs $0x800425,%r10
+  800223:	00 00 00 
+  800226:	41 ff d2             	call   *%r10
+
+0000000000800229 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+  80022d:	53                   	push   %rbx
+  80022e:	48 83 ec 18          	sub    $0x18,%rsp
+    int id, p[2], r;
+
+    binaryname = "primespipe";
+  800232:	48 b8 8d 50 80 00 00 	movabs $0x80508d,%rax
+  800239:	00 00 00 
+  80023c:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800243:	00 00 00 
+
+    if ((r = pipe(p)) < 0)
+  800246:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  80024a:	48 b8 1b 3c 80 00 00 	movabs $0x803c1b,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+  800256:	85 c0                	test   %eax,%eax
+  800258:	78 30                	js     80028a <umain+0x61>
+        panic("pipe: %i", r);
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  80025a:	48 b8 63 20 80 00 00 	movabs $0x802063,%rax
+  800261:	00 00 00 
+  800264:	ff d0                	call   *%rax
+  800266:	85 c0                	test   %eax,%eax
+  800268:	78 4d                	js     8002b7 <umain+0x8e>
+        panic("fork: %i", id);
+
+    if (id == 0) {
+  80026a:	75 78                	jne    8002e4 <umain+0xbb>
+        close(p[1]);
+  80026c:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  80026f:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  800276:	00 00 00 
+  800279:	ff d0                	call   *%rax
+        primeproc(p[0]);
+  80027b:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  80027e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+        panic("pipe: %i", r);
+  80028a:	89 c1                	mov    %eax,%ecx
+  80028c:	48 ba 45 50 80 00 00 	movabs $0x805045,%rdx
+  800293:	00 00 00 
+  800296:	be 38 00 00 00       	mov    $0x38,%esi
+  80029b:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8002a2:	00 00 00 
+  8002a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002aa:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  8002b1:	00 00 00 
+  8002b4:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  8002b7:	89 c1                	mov    %eax,%ecx
+  8002b9:	48 ba 4e 50 80 00 00 	movabs $0x80504e,%rdx
+  8002c0:	00 00 00 
+  8002c3:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8002c8:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  8002cf:	00 00 00 
+  8002d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d7:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  8002de:	00 00 00 
+  8002e1:	41 ff d0             	call   *%r8
+    }
+
+    close(p[0]);
+  8002e4:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  8002e7:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+  8002f3:	b8 02 00 00 00       	mov    $0x2,%eax
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+        if ((r = write(p[1], &i, 4)) != 4)
+  8002f8:	48 bb 11 26 80 00 00 	movabs $0x802611,%rbx
+  8002ff:	00 00 00 
+  800302:	eb 06                	jmp    80030a <umain+0xe1>
+    for (int i = 2;; i++)
+  800304:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800307:	83 c0 01             	add    $0x1,%eax
+  80030a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+        if ((r = write(p[1], &i, 4)) != 4)
+  80030d:	ba 04 00 00 00       	mov    $0x4,%edx
+  800312:	48 8d 75 e4          	lea    -0x1c(%rbp),%rsi
+  800316:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  800319:	ff d3                	call   *%rbx
+  80031b:	89 c1                	mov    %eax,%ecx
+  80031d:	83 f8 04             	cmp    $0x4,%eax
+  800320:	74 e2                	je     800304 <umain+0xdb>
+            panic("generator write: %d, %i", r, r >= 0 ? 0 : r);
+  800322:	85 c0                	test   %eax,%eax
+  800324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80032a:	44 0f 4e c0          	cmovle %eax,%r8d
+  80032e:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  800335:	00 00 00 
+  800338:	be 48 00 00 00       	mov    $0x48,%esi
+  80033d:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800344:	00 00 00 
+  800347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034c:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  800353:	00 00 00 
+  800356:	41 ff d1             	call   *%r9
+
+0000000000800359 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	41 56                	push   %r14
+  80035f:	41 55                	push   %r13
+  800361:	41 54                	push   %r12
+  800363:	53                   	push   %rbx
+  800364:	41 89 fd             	mov    %edi,%r13d
+  800367:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80036a:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800371:	00 00 00 
+  800374:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80037b:	00 00 00 
+  80037e:	48 39 c2             	cmp    %rax,%rdx
+  800381:	73 17                	jae    80039a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800383:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800386:	49 89 c4             	mov    %rax,%r12
+  800389:	48 83 c3 08          	add    $0x8,%rbx
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	ff 53 f8             	call   *-0x8(%rbx)
+  800395:	4c 39 e3             	cmp    %r12,%rbx
+  800398:	72 ef                	jb     800389 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80039a:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+  8003a6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003ab:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8003b2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003b9:	00 00 00 
+  8003bc:	48 01 d0             	add    %rdx,%rax
+  8003bf:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8003c6:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003c9:	45 85 ed             	test   %r13d,%r13d
+  8003cc:	7e 0d                	jle    8003db <libmain+0x82>
+  8003ce:	49 8b 06             	mov    (%r14),%rax
+  8003d1:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003d8:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003db:	4c 89 f6             	mov    %r14,%rsi
+  8003de:	44 89 ef             	mov    %r13d,%edi
+  8003e1:	48 b8 29 02 80 00 00 	movabs $0x800229,%rax
+  8003e8:	00 00 00 
+  8003eb:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003ed:	48 b8 02 04 80 00 00 	movabs $0x800402,%rax
+  8003f4:	00 00 00 
+  8003f7:	ff d0                	call   *%rax
+#endif
+}
+  8003f9:	5b                   	pop    %rbx
+  8003fa:	41 5c                	pop    %r12
+  8003fc:	41 5d                	pop    %r13
+  8003fe:	41 5e                	pop    %r14
+  800400:	5d                   	pop    %rbp
+  800401:	c3                   	ret
+
+0000000000800402 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800402:	55                   	push   %rbp
+  800403:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800406:	48 b8 97 23 80 00 00 	movabs $0x802397,%rax
+  80040d:	00 00 00 
+  800410:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800412:	bf 00 00 00 00       	mov    $0x0,%edi
+  800417:	48 b8 22 15 80 00 00 	movabs $0x801522,%rax
+  80041e:	00 00 00 
+  800421:	ff d0                	call   *%rax
+}
+  800423:	5d                   	pop    %rbp
+  800424:	c3                   	ret
+
+0000000000800425 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800425:	55                   	push   %rbp
+  800426:	48 89 e5             	mov    %rsp,%rbp
+  800429:	41 56                	push   %r14
+  80042b:	41 55                	push   %r13
+  80042d:	41 54                	push   %r12
+  80042f:	53                   	push   %rbx
+  800430:	48 83 ec 50          	sub    $0x50,%rsp
+  800434:	49 89 fc             	mov    %rdi,%r12
+  800437:	41 89 f5             	mov    %esi,%r13d
+  80043a:	48 89 d3             	mov    %rdx,%rbx
+  80043d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800441:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800445:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800449:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800450:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800454:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800458:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80045c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800460:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800467:	00 00 00 
+  80046a:	4c 8b 30             	mov    (%rax),%r14
+  80046d:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  800474:	00 00 00 
+  800477:	ff d0                	call   *%rax
+  800479:	89 c6                	mov    %eax,%esi
+  80047b:	45 89 e8             	mov    %r13d,%r8d
+  80047e:	4c 89 e1             	mov    %r12,%rcx
+  800481:	4c 89 f2             	mov    %r14,%rdx
+  800484:	48 bf c0 50 80 00 00 	movabs $0x8050c0,%rdi
+  80048b:	00 00 00 
+  80048e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800493:	49 bc 75 05 80 00 00 	movabs $0x800575,%r12
+  80049a:	00 00 00 
+  80049d:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004a0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004a4:	48 89 df             	mov    %rbx,%rdi
+  8004a7:	48 b8 11 05 80 00 00 	movabs $0x800511,%rax
+  8004ae:	00 00 00 
+  8004b1:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004b3:	48 bf 43 50 80 00 00 	movabs $0x805043,%rdi
+  8004ba:	00 00 00 
+  8004bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c2:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004c5:	cc                   	int3
+  8004c6:	eb fd                	jmp    8004c5 <_panic+0xa0>
+
+00000000008004c8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	53                   	push   %rbx
+  8004cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8004d1:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004d4:	8b 06                	mov    (%rsi),%eax
+  8004d6:	8d 50 01             	lea    0x1(%rax),%edx
+  8004d9:	89 16                	mov    %edx,(%rsi)
+  8004db:	48 98                	cltq
+  8004dd:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004e2:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004e8:	74 0a                	je     8004f4 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004ea:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004f2:	c9                   	leave
+  8004f3:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004f4:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004f8:	be ff 00 00 00       	mov    $0xff,%esi
+  8004fd:	48 b8 c4 14 80 00 00 	movabs $0x8014c4,%rax
+  800504:	00 00 00 
+  800507:	ff d0                	call   *%rax
+        state->offset = 0;
+  800509:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80050f:	eb d9                	jmp    8004ea <putch+0x22>
+
+0000000000800511 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800511:	55                   	push   %rbp
+  800512:	48 89 e5             	mov    %rsp,%rbp
+  800515:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80051c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80051f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800526:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80052b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800530:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800533:	48 89 f1             	mov    %rsi,%rcx
+  800536:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80053d:	48 bf c8 04 80 00 00 	movabs $0x8004c8,%rdi
+  800544:	00 00 00 
+  800547:	48 b8 c5 06 80 00 00 	movabs $0x8006c5,%rax
+  80054e:	00 00 00 
+  800551:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800553:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80055a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800561:	48 b8 c4 14 80 00 00 	movabs $0x8014c4,%rax
+  800568:	00 00 00 
+  80056b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80056d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800573:	c9                   	leave
+  800574:	c3                   	ret
+
+0000000000800575 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800575:	55                   	push   %rbp
+  800576:	48 89 e5             	mov    %rsp,%rbp
+  800579:	48 83 ec 50          	sub    $0x50,%rsp
+  80057d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800581:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800585:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800589:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80058d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800591:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800598:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80059c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005a4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005a8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005ac:	48 b8 11 05 80 00 00 	movabs $0x800511,%rax
+  8005b3:	00 00 00 
+  8005b6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005b8:	c9                   	leave
+  8005b9:	c3                   	ret
+
+00000000008005ba <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005ba:	55                   	push   %rbp
+  8005bb:	48 89 e5             	mov    %rsp,%rbp
+  8005be:	41 57                	push   %r15
+  8005c0:	41 56                	push   %r14
+  8005c2:	41 55                	push   %r13
+  8005c4:	41 54                	push   %r12
+  8005c6:	53                   	push   %rbx
+  8005c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8005cb:	49 89 fc             	mov    %rdi,%r12
+  8005ce:	49 89 f5             	mov    %rsi,%r13
+  8005d1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005d5:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005d8:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005db:	41 89 cf             	mov    %ecx,%r15d
+  8005de:	4c 39 fa             	cmp    %r15,%rdx
+  8005e1:	73 5b                	jae    80063e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005e3:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005e7:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005eb:	85 db                	test   %ebx,%ebx
+  8005ed:	7e 0e                	jle    8005fd <print_num+0x43>
+            putch(padc, put_arg);
+  8005ef:	4c 89 ee             	mov    %r13,%rsi
+  8005f2:	44 89 f7             	mov    %r14d,%edi
+  8005f5:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005f8:	83 eb 01             	sub    $0x1,%ebx
+  8005fb:	75 f2                	jne    8005ef <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005fd:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800601:	48 b9 f4 50 80 00 00 	movabs $0x8050f4,%rcx
+  800608:	00 00 00 
+  80060b:	48 b8 e3 50 80 00 00 	movabs $0x8050e3,%rax
+  800612:	00 00 00 
+  800615:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800619:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80061d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800622:	49 f7 f7             	div    %r15
+  800625:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800629:	4c 89 ee             	mov    %r13,%rsi
+  80062c:	41 ff d4             	call   *%r12
+}
+  80062f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800633:	5b                   	pop    %rbx
+  800634:	41 5c                	pop    %r12
+  800636:	41 5d                	pop    %r13
+  800638:	41 5e                	pop    %r14
+  80063a:	41 5f                	pop    %r15
+  80063c:	5d                   	pop    %rbp
+  80063d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80063e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800642:	ba 00 00 00 00       	mov    $0x0,%edx
+  800647:	49 f7 f7             	div    %r15
+  80064a:	48 83 ec 08          	sub    $0x8,%rsp
+  80064e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800652:	52                   	push   %rdx
+  800653:	45 0f be c9          	movsbl %r9b,%r9d
+  800657:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80065b:	48 89 c2             	mov    %rax,%rdx
+  80065e:	48 b8 ba 05 80 00 00 	movabs $0x8005ba,%rax
+  800665:	00 00 00 
+  800668:	ff d0                	call   *%rax
+  80066a:	48 83 c4 10          	add    $0x10,%rsp
+  80066e:	eb 8d                	jmp    8005fd <print_num+0x43>
+
+0000000000800670 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800670:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800674:	48 8b 06             	mov    (%rsi),%rax
+  800677:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80067b:	73 0a                	jae    800687 <sprintputch+0x17>
+        *state->start++ = ch;
+  80067d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800681:	48 89 16             	mov    %rdx,(%rsi)
+  800684:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800687:	c3                   	ret
+
+0000000000800688 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800688:	55                   	push   %rbp
+  800689:	48 89 e5             	mov    %rsp,%rbp
+  80068c:	48 83 ec 50          	sub    $0x50,%rsp
+  800690:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800694:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800698:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80069c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006a3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ab:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006af:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006b3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006b7:	48 b8 c5 06 80 00 00 	movabs $0x8006c5,%rax
+  8006be:	00 00 00 
+  8006c1:	ff d0                	call   *%rax
+}
+  8006c3:	c9                   	leave
+  8006c4:	c3                   	ret
+
+00000000008006c5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006c5:	55                   	push   %rbp
+  8006c6:	48 89 e5             	mov    %rsp,%rbp
+  8006c9:	41 57                	push   %r15
+  8006cb:	41 56                	push   %r14
+  8006cd:	41 55                	push   %r13
+  8006cf:	41 54                	push   %r12
+  8006d1:	53                   	push   %rbx
+  8006d2:	48 83 ec 38          	sub    $0x38,%rsp
+  8006d6:	49 89 fe             	mov    %rdi,%r14
+  8006d9:	49 89 f5             	mov    %rsi,%r13
+  8006dc:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006df:	48 8b 01             	mov    (%rcx),%rax
+  8006e2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006e6:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ee:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006f2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006f6:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006fa:	0f b6 3b             	movzbl (%rbx),%edi
+  8006fd:	40 80 ff 25          	cmp    $0x25,%dil
+  800701:	74 18                	je     80071b <vprintfmt+0x56>
+            if (!ch) return;
+  800703:	40 84 ff             	test   %dil,%dil
+  800706:	0f 84 04 07 00 00    	je     800e10 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80070c:	40 0f b6 ff          	movzbl %dil,%edi
+  800710:	4c 89 ee             	mov    %r13,%rsi
+  800713:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800716:	4c 89 e3             	mov    %r12,%rbx
+  800719:	eb db                	jmp    8006f6 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80071b:	be 00 00 00 00       	mov    $0x0,%esi
+  800720:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800724:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800729:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80072f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800736:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80073a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80073f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800744:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800747:	83 e8 23             	sub    $0x23,%eax
+  80074a:	3c 57                	cmp    $0x57,%al
+  80074c:	0f 87 a4 06 00 00    	ja     800df6 <vprintfmt+0x731>
+  800752:	0f b6 c0             	movzbl %al,%eax
+  800755:	48 b9 80 52 80 00 00 	movabs $0x805280,%rcx
+  80075c:	00 00 00 
+  80075f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800762:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800765:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800769:	eb cf                	jmp    80073a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80076b:	49 89 dc             	mov    %rbx,%r12
+  80076e:	be 01 00 00 00       	mov    $0x1,%esi
+  800773:	eb c5                	jmp    80073a <vprintfmt+0x75>
+            padc = ch;
+  800775:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800779:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80077c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80077f:	eb b9                	jmp    80073a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800781:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800784:	83 f8 2f             	cmp    $0x2f,%eax
+  800787:	77 24                	ja     8007ad <vprintfmt+0xe8>
+  800789:	89 c1                	mov    %eax,%ecx
+  80078b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80078f:	83 c0 08             	add    $0x8,%eax
+  800792:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800795:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800798:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80079b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80079f:	79 99                	jns    80073a <vprintfmt+0x75>
+                width = precision;
+  8007a1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007a5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007ab:	eb 8d                	jmp    80073a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007ad:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007b1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b9:	eb da                	jmp    800795 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007bb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007c0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007c4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007ca:	3c 39                	cmp    $0x39,%al
+  8007cc:	77 1c                	ja     8007ea <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007ce:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007d2:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007d6:	0f b6 c0             	movzbl %al,%eax
+  8007d9:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007de:	0f b6 03             	movzbl (%rbx),%eax
+  8007e1:	3c 39                	cmp    $0x39,%al
+  8007e3:	76 e9                	jbe    8007ce <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007e5:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007e8:	eb b1                	jmp    80079b <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007ea:	49 89 dc             	mov    %rbx,%r12
+  8007ed:	eb ac                	jmp    80079b <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007ef:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007f2:	85 c9                	test   %ecx,%ecx
+  8007f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f9:	0f 49 c1             	cmovns %ecx,%eax
+  8007fc:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007ff:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800802:	e9 33 ff ff ff       	jmp    80073a <vprintfmt+0x75>
+            lflag++;
+  800807:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80080a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80080d:	e9 28 ff ff ff       	jmp    80073a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800812:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800815:	83 f8 2f             	cmp    $0x2f,%eax
+  800818:	77 19                	ja     800833 <vprintfmt+0x16e>
+  80081a:	89 c2                	mov    %eax,%edx
+  80081c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800820:	83 c0 08             	add    $0x8,%eax
+  800823:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800826:	8b 3a                	mov    (%rdx),%edi
+  800828:	4c 89 ee             	mov    %r13,%rsi
+  80082b:	41 ff d6             	call   *%r14
+            break;
+  80082e:	e9 c3 fe ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800833:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800837:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083f:	eb e5                	jmp    800826 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800841:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800844:	83 f8 2f             	cmp    $0x2f,%eax
+  800847:	77 5a                	ja     8008a3 <vprintfmt+0x1de>
+  800849:	89 c2                	mov    %eax,%edx
+  80084b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084f:	83 c0 08             	add    $0x8,%eax
+  800852:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800855:	8b 02                	mov    (%rdx),%eax
+  800857:	89 c1                	mov    %eax,%ecx
+  800859:	f7 d9                	neg    %ecx
+  80085b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80085e:	83 f9 13             	cmp    $0x13,%ecx
+  800861:	7f 4e                	jg     8008b1 <vprintfmt+0x1ec>
+  800863:	48 63 c1             	movslq %ecx,%rax
+  800866:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80086d:	00 00 00 
+  800870:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800874:	48 85 c0             	test   %rax,%rax
+  800877:	74 38                	je     8008b1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800879:	48 89 c1             	mov    %rax,%rcx
+  80087c:	48 ba 99 57 80 00 00 	movabs $0x805799,%rdx
+  800883:	00 00 00 
+  800886:	4c 89 ee             	mov    %r13,%rsi
+  800889:	4c 89 f7             	mov    %r14,%rdi
+  80088c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800891:	49 b8 88 06 80 00 00 	movabs $0x800688,%r8
+  800898:	00 00 00 
+  80089b:	41 ff d0             	call   *%r8
+  80089e:	e9 53 fe ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008af:	eb a4                	jmp    800855 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008b1:	48 ba 0c 51 80 00 00 	movabs $0x80510c,%rdx
+  8008b8:	00 00 00 
+  8008bb:	4c 89 ee             	mov    %r13,%rsi
+  8008be:	4c 89 f7             	mov    %r14,%rdi
+  8008c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c6:	49 b8 88 06 80 00 00 	movabs $0x800688,%r8
+  8008cd:	00 00 00 
+  8008d0:	41 ff d0             	call   *%r8
+  8008d3:	e9 1e fe ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008db:	83 f8 2f             	cmp    $0x2f,%eax
+  8008de:	77 36                	ja     800916 <vprintfmt+0x251>
+  8008e0:	89 c2                	mov    %eax,%edx
+  8008e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e6:	83 c0 08             	add    $0x8,%eax
+  8008e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ec:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8008ef:	48 85 f6             	test   %rsi,%rsi
+  8008f2:	48 b8 05 51 80 00 00 	movabs $0x805105,%rax
+  8008f9:	00 00 00 
+  8008fc:	48 0f 45 c6          	cmovne %rsi,%rax
+  800900:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800904:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800908:	7e 06                	jle    800910 <vprintfmt+0x24b>
+  80090a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80090e:	75 14                	jne    800924 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800910:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800914:	eb 5b                	jmp    800971 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800916:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800922:	eb c8                	jmp    8008ec <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800924:	49 63 f7             	movslq %r15d,%rsi
+  800927:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80092b:	48 b8 ca 0e 80 00 00 	movabs $0x800eca,%rax
+  800932:	00 00 00 
+  800935:	ff d0                	call   *%rax
+  800937:	48 89 c2             	mov    %rax,%rdx
+  80093a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80093d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80093f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800942:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800945:	85 c0                	test   %eax,%eax
+  800947:	7e c7                	jle    800910 <vprintfmt+0x24b>
+  800949:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80094e:	4c 89 ee             	mov    %r13,%rsi
+  800951:	44 89 e7             	mov    %r12d,%edi
+  800954:	41 ff d6             	call   *%r14
+  800957:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80095b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80095e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800961:	75 eb                	jne    80094e <vprintfmt+0x289>
+  800963:	eb ab                	jmp    800910 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800965:	0f b6 f8             	movzbl %al,%edi
+  800968:	4c 89 ee             	mov    %r13,%rsi
+  80096b:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  80096e:	4c 89 e2             	mov    %r12,%rdx
+  800971:	45 85 ff             	test   %r15d,%r15d
+  800974:	78 06                	js     80097c <vprintfmt+0x2b7>
+  800976:	41 83 ef 01          	sub    $0x1,%r15d
+  80097a:	78 23                	js     80099f <vprintfmt+0x2da>
+  80097c:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800980:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800986:	84 c0                	test   %al,%al
+  800988:	74 15                	je     80099f <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80098a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80098e:	74 d5                	je     800965 <vprintfmt+0x2a0>
+  800990:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800993:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800998:	80 fa 5e             	cmp    $0x5e,%dl
+  80099b:	77 cb                	ja     800968 <vprintfmt+0x2a3>
+  80099d:	eb c6                	jmp    800965 <vprintfmt+0x2a0>
+  80099f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009a2:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8009a5:	01 f0                	add    %esi,%eax
+  8009a7:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8009a9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009ad:	85 c0                	test   %eax,%eax
+  8009af:	0f 8e 41 fd ff ff    	jle    8006f6 <vprintfmt+0x31>
+  8009b5:	4c 89 ee             	mov    %r13,%rsi
+  8009b8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009bd:	41 ff d6             	call   *%r14
+  8009c0:	41 83 ec 01          	sub    $0x1,%r12d
+  8009c4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009c8:	75 eb                	jne    8009b5 <vprintfmt+0x2f0>
+  8009ca:	e9 27 fd ff ff       	jmp    8006f6 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8009cf:	40 84 f6             	test   %sil,%sil
+  8009d2:	75 26                	jne    8009fa <vprintfmt+0x335>
+    switch (lflag) {
+  8009d4:	85 d2                	test   %edx,%edx
+  8009d6:	74 59                	je     800a31 <vprintfmt+0x36c>
+  8009d8:	83 fa 01             	cmp    $0x1,%edx
+  8009db:	74 7b                	je     800a58 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8009dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e3:	0f 87 96 00 00 00    	ja     800a7f <vprintfmt+0x3ba>
+  8009e9:	89 c2                	mov    %eax,%edx
+  8009eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ef:	83 c0 08             	add    $0x8,%eax
+  8009f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f5:	4c 8b 22             	mov    (%rdx),%r12
+  8009f8:	eb 17                	jmp    800a11 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8009fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800a00:	77 21                	ja     800a23 <vprintfmt+0x35e>
+  800a02:	89 c2                	mov    %eax,%edx
+  800a04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a08:	83 c0 08             	add    $0x8,%eax
+  800a0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a11:	4d 85 e4             	test   %r12,%r12
+  800a14:	78 7a                	js     800a90 <vprintfmt+0x3cb>
+            num = i;
+  800a16:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a19:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a1e:	e9 b5 02 00 00       	jmp    800cd8 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2f:	eb dd                	jmp    800a0e <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800a31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a34:	83 f8 2f             	cmp    $0x2f,%eax
+  800a37:	77 11                	ja     800a4a <vprintfmt+0x385>
+  800a39:	89 c2                	mov    %eax,%edx
+  800a3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3f:	83 c0 08             	add    $0x8,%eax
+  800a42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a45:	4c 63 22             	movslq (%rdx),%r12
+  800a48:	eb c7                	jmp    800a11 <vprintfmt+0x34c>
+  800a4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a56:	eb ed                	jmp    800a45 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800a58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5e:	77 11                	ja     800a71 <vprintfmt+0x3ac>
+  800a60:	89 c2                	mov    %eax,%edx
+  800a62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a66:	83 c0 08             	add    $0x8,%eax
+  800a69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6c:	4c 8b 22             	mov    (%rdx),%r12
+  800a6f:	eb a0                	jmp    800a11 <vprintfmt+0x34c>
+  800a71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7d:	eb ed                	jmp    800a6c <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800a7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8b:	e9 65 ff ff ff       	jmp    8009f5 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800a90:	4c 89 ee             	mov    %r13,%rsi
+  800a93:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a98:	41 ff d6             	call   *%r14
+                i = -i;
+  800a9b:	49 f7 dc             	neg    %r12
+  800a9e:	e9 73 ff ff ff       	jmp    800a16 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa3:	40 84 f6             	test   %sil,%sil
+  800aa6:	75 32                	jne    800ada <vprintfmt+0x415>
+    switch (lflag) {
+  800aa8:	85 d2                	test   %edx,%edx
+  800aaa:	74 5d                	je     800b09 <vprintfmt+0x444>
+  800aac:	83 fa 01             	cmp    $0x1,%edx
+  800aaf:	0f 84 82 00 00 00    	je     800b37 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800ab5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab8:	83 f8 2f             	cmp    $0x2f,%eax
+  800abb:	0f 87 a5 00 00 00    	ja     800b66 <vprintfmt+0x4a1>
+  800ac1:	89 c2                	mov    %eax,%edx
+  800ac3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac7:	83 c0 08             	add    $0x8,%eax
+  800aca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ad0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ad5:	e9 fe 01 00 00       	jmp    800cd8 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800ada:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800add:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae0:	77 19                	ja     800afb <vprintfmt+0x436>
+  800ae2:	89 c2                	mov    %eax,%edx
+  800ae4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae8:	83 c0 08             	add    $0x8,%eax
+  800aeb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aee:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800af1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800af6:	e9 dd 01 00 00       	jmp    800cd8 <vprintfmt+0x613>
+  800afb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b07:	eb e5                	jmp    800aee <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800b09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0f:	77 18                	ja     800b29 <vprintfmt+0x464>
+  800b11:	89 c2                	mov    %eax,%edx
+  800b13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b17:	83 c0 08             	add    $0x8,%eax
+  800b1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b1f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b24:	e9 af 01 00 00       	jmp    800cd8 <vprintfmt+0x613>
+  800b29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b35:	eb e6                	jmp    800b1d <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800b37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3d:	77 19                	ja     800b58 <vprintfmt+0x493>
+  800b3f:	89 c2                	mov    %eax,%edx
+  800b41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b45:	83 c0 08             	add    $0x8,%eax
+  800b48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b4e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b53:	e9 80 01 00 00       	jmp    800cd8 <vprintfmt+0x613>
+  800b58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b64:	eb e5                	jmp    800b4b <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800b66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b72:	e9 56 ff ff ff       	jmp    800acd <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800b77:	40 84 f6             	test   %sil,%sil
+  800b7a:	75 2e                	jne    800baa <vprintfmt+0x4e5>
+    switch (lflag) {
+  800b7c:	85 d2                	test   %edx,%edx
+  800b7e:	0f 84 b3 00 00 00    	je     800c37 <vprintfmt+0x572>
+  800b84:	83 fa 01             	cmp    $0x1,%edx
+  800b87:	0f 84 d3 00 00 00    	je     800c60 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800b8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b90:	83 f8 2f             	cmp    $0x2f,%eax
+  800b93:	0f 87 f1 00 00 00    	ja     800c8a <vprintfmt+0x5c5>
+  800b99:	89 c2                	mov    %eax,%edx
+  800b9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9f:	83 c0 08             	add    $0x8,%eax
+  800ba2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba5:	48 8b 02             	mov    (%rdx),%rax
+  800ba8:	eb 17                	jmp    800bc1 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800baa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bad:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb0:	77 77                	ja     800c29 <vprintfmt+0x564>
+  800bb2:	89 c2                	mov    %eax,%edx
+  800bb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb8:	83 c0 08             	add    $0x8,%eax
+  800bbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbe:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800bc1:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800bc3:	83 f8 07             	cmp    $0x7,%eax
+  800bc6:	0f 8e cf 00 00 00    	jle    800c9b <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800bcc:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800bd2:	44 89 e7             	mov    %r12d,%edi
+  800bd5:	41 c1 e4 03          	shl    $0x3,%r12d
+  800bd9:	89 d1                	mov    %edx,%ecx
+  800bdb:	8d 72 07             	lea    0x7(%rdx),%esi
+  800bde:	85 d2                	test   %edx,%edx
+  800be0:	0f 48 d6             	cmovs  %esi,%edx
+  800be3:	c1 fa 03             	sar    $0x3,%edx
+  800be6:	83 f9 3f             	cmp    $0x3f,%ecx
+  800be9:	7f e7                	jg     800bd2 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800beb:	85 ff                	test   %edi,%edi
+  800bed:	0f 84 03 fb ff ff    	je     8006f6 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800bf3:	49 63 f4             	movslq %r12d,%rsi
+  800bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfb:	48 f7 f6             	div    %rsi
+  800bfe:	49 89 d7             	mov    %rdx,%r15
+  800c01:	83 c0 30             	add    $0x30,%eax
+  800c04:	0f be f8             	movsbl %al,%edi
+  800c07:	4c 89 ee             	mov    %r13,%rsi
+  800c0a:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800c0d:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800c10:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800c15:	45 85 e4             	test   %r12d,%r12d
+  800c18:	41 0f 49 d4          	cmovns %r12d,%edx
+  800c1c:	c1 fa 03             	sar    $0x3,%edx
+  800c1f:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800c22:	75 cf                	jne    800bf3 <vprintfmt+0x52e>
+  800c24:	e9 cd fa ff ff       	jmp    8006f6 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800c29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c35:	eb 87                	jmp    800bbe <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800c37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3d:	77 13                	ja     800c52 <vprintfmt+0x58d>
+  800c3f:	89 c2                	mov    %eax,%edx
+  800c41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c45:	83 c0 08             	add    $0x8,%eax
+  800c48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4b:	8b 02                	mov    (%rdx),%eax
+  800c4d:	e9 6f ff ff ff       	jmp    800bc1 <vprintfmt+0x4fc>
+  800c52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5e:	eb eb                	jmp    800c4b <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800c60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c63:	83 f8 2f             	cmp    $0x2f,%eax
+  800c66:	77 14                	ja     800c7c <vprintfmt+0x5b7>
+  800c68:	89 c2                	mov    %eax,%edx
+  800c6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6e:	83 c0 08             	add    $0x8,%eax
+  800c71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c74:	48 8b 02             	mov    (%rdx),%rax
+  800c77:	e9 45 ff ff ff       	jmp    800bc1 <vprintfmt+0x4fc>
+  800c7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c88:	eb ea                	jmp    800c74 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800c8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c96:	e9 0a ff ff ff       	jmp    800ba5 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800c9b:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800ca1:	e9 4d ff ff ff       	jmp    800bf3 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800ca6:	4c 89 ee             	mov    %r13,%rsi
+  800ca9:	bf 30 00 00 00       	mov    $0x30,%edi
+  800cae:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800cb1:	4c 89 ee             	mov    %r13,%rsi
+  800cb4:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cb9:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cbc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cbf:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc2:	77 47                	ja     800d0b <vprintfmt+0x646>
+  800cc4:	89 c2                	mov    %eax,%edx
+  800cc6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cca:	83 c0 08             	add    $0x8,%eax
+  800ccd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cd3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cd8:	48 83 ec 08          	sub    $0x8,%rsp
+  800cdc:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ce0:	0f 94 c0             	sete   %al
+  800ce3:	0f b6 c0             	movzbl %al,%eax
+  800ce6:	50                   	push   %rax
+  800ce7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cec:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cf0:	4c 89 ee             	mov    %r13,%rsi
+  800cf3:	4c 89 f7             	mov    %r14,%rdi
+  800cf6:	48 b8 ba 05 80 00 00 	movabs $0x8005ba,%rax
+  800cfd:	00 00 00 
+  800d00:	ff d0                	call   *%rax
+            break;
+  800d02:	48 83 c4 10          	add    $0x10,%rsp
+  800d06:	e9 eb f9 ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d17:	eb b7                	jmp    800cd0 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800d19:	40 84 f6             	test   %sil,%sil
+  800d1c:	75 2b                	jne    800d49 <vprintfmt+0x684>
+    switch (lflag) {
+  800d1e:	85 d2                	test   %edx,%edx
+  800d20:	74 56                	je     800d78 <vprintfmt+0x6b3>
+  800d22:	83 fa 01             	cmp    $0x1,%edx
+  800d25:	74 7f                	je     800da6 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800d27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800d2d:	0f 87 a2 00 00 00    	ja     800dd5 <vprintfmt+0x710>
+  800d33:	89 c2                	mov    %eax,%edx
+  800d35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d39:	83 c0 08             	add    $0x8,%eax
+  800d3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d3f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d42:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d47:	eb 8f                	jmp    800cd8 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800d49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4f:	77 19                	ja     800d6a <vprintfmt+0x6a5>
+  800d51:	89 c2                	mov    %eax,%edx
+  800d53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d57:	83 c0 08             	add    $0x8,%eax
+  800d5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d5d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d60:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d65:	e9 6e ff ff ff       	jmp    800cd8 <vprintfmt+0x613>
+  800d6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d76:	eb e5                	jmp    800d5d <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800d78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d7e:	77 18                	ja     800d98 <vprintfmt+0x6d3>
+  800d80:	89 c2                	mov    %eax,%edx
+  800d82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d86:	83 c0 08             	add    $0x8,%eax
+  800d89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d8c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d8e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d93:	e9 40 ff ff ff       	jmp    800cd8 <vprintfmt+0x613>
+  800d98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da4:	eb e6                	jmp    800d8c <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800da6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da9:	83 f8 2f             	cmp    $0x2f,%eax
+  800dac:	77 19                	ja     800dc7 <vprintfmt+0x702>
+  800dae:	89 c2                	mov    %eax,%edx
+  800db0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800db4:	83 c0 08             	add    $0x8,%eax
+  800db7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dbd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800dc2:	e9 11 ff ff ff       	jmp    800cd8 <vprintfmt+0x613>
+  800dc7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dcb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dcf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd3:	eb e5                	jmp    800dba <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800dd5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ddd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de1:	e9 59 ff ff ff       	jmp    800d3f <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800de6:	4c 89 ee             	mov    %r13,%rsi
+  800de9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dee:	41 ff d6             	call   *%r14
+            break;
+  800df1:	e9 00 f9 ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800df6:	4c 89 ee             	mov    %r13,%rsi
+  800df9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dfe:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e01:	48 83 eb 01          	sub    $0x1,%rbx
+  800e05:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e09:	75 f6                	jne    800e01 <vprintfmt+0x73c>
+  800e0b:	e9 e6 f8 ff ff       	jmp    8006f6 <vprintfmt+0x31>
+}
+  800e10:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e14:	5b                   	pop    %rbx
+  800e15:	41 5c                	pop    %r12
+  800e17:	41 5d                	pop    %r13
+  800e19:	41 5e                	pop    %r14
+  800e1b:	41 5f                	pop    %r15
+  800e1d:	5d                   	pop    %rbp
+  800e1e:	c3                   	ret
+
+0000000000800e1f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e1f:	55                   	push   %rbp
+  800e20:	48 89 e5             	mov    %rsp,%rbp
+  800e23:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e27:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e2b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e30:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e34:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e3b:	48 85 ff             	test   %rdi,%rdi
+  800e3e:	74 2b                	je     800e6b <vsnprintf+0x4c>
+  800e40:	48 85 f6             	test   %rsi,%rsi
+  800e43:	74 26                	je     800e6b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e45:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e49:	48 bf 70 06 80 00 00 	movabs $0x800670,%rdi
+  800e50:	00 00 00 
+  800e53:	48 b8 c5 06 80 00 00 	movabs $0x8006c5,%rax
+  800e5a:	00 00 00 
+  800e5d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e63:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e66:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e69:	c9                   	leave
+  800e6a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e70:	eb f7                	jmp    800e69 <vsnprintf+0x4a>
+
+0000000000800e72 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e72:	55                   	push   %rbp
+  800e73:	48 89 e5             	mov    %rsp,%rbp
+  800e76:	48 83 ec 50          	sub    $0x50,%rsp
+  800e7a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e7e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e82:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e86:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e8d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e95:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e99:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e9d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ea1:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  800ea8:	00 00 00 
+  800eab:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ead:	c9                   	leave
+  800eae:	c3                   	ret
+
+0000000000800eaf <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800eaf:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800eb2:	74 10                	je     800ec4 <strlen+0x15>
+    size_t n = 0;
+  800eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800eb9:	48 83 c0 01          	add    $0x1,%rax
+  800ebd:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ec1:	75 f6                	jne    800eb9 <strlen+0xa>
+  800ec3:	c3                   	ret
+    size_t n = 0;
+  800ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ec9:	c3                   	ret
+
+0000000000800eca <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800eca:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ecd:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ed2:	48 85 f6             	test   %rsi,%rsi
+  800ed5:	74 11                	je     800ee8 <strnlen+0x1e>
+  800ed7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800edb:	74 0c                	je     800ee9 <strnlen+0x1f>
+  800edd:	48 83 c2 01          	add    $0x1,%rdx
+  800ee1:	48 39 d0             	cmp    %rdx,%rax
+  800ee4:	75 f1                	jne    800ed7 <strnlen+0xd>
+  800ee6:	eb 04                	jmp    800eec <strnlen+0x22>
+  800ee8:	c3                   	ret
+  800ee9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800eec:	c3                   	ret
+
+0000000000800eed <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800eed:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ef0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ef9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800efc:	48 83 c2 01          	add    $0x1,%rdx
+  800f00:	84 c9                	test   %cl,%cl
+  800f02:	75 f1                	jne    800ef5 <strcpy+0x8>
+        ;
+    return res;
+}
+  800f04:	c3                   	ret
+
+0000000000800f05 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f05:	55                   	push   %rbp
+  800f06:	48 89 e5             	mov    %rsp,%rbp
+  800f09:	41 54                	push   %r12
+  800f0b:	53                   	push   %rbx
+  800f0c:	48 89 fb             	mov    %rdi,%rbx
+  800f0f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f12:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  800f19:	00 00 00 
+  800f1c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f1e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f22:	4c 89 e6             	mov    %r12,%rsi
+  800f25:	48 b8 ed 0e 80 00 00 	movabs $0x800eed,%rax
+  800f2c:	00 00 00 
+  800f2f:	ff d0                	call   *%rax
+    return dst;
+}
+  800f31:	48 89 d8             	mov    %rbx,%rax
+  800f34:	5b                   	pop    %rbx
+  800f35:	41 5c                	pop    %r12
+  800f37:	5d                   	pop    %rbp
+  800f38:	c3                   	ret
+
+0000000000800f39 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f39:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f3c:	48 85 d2             	test   %rdx,%rdx
+  800f3f:	74 1f                	je     800f60 <strncpy+0x27>
+  800f41:	48 01 fa             	add    %rdi,%rdx
+  800f44:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f47:	48 83 c1 01          	add    $0x1,%rcx
+  800f4b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f4f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f53:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f57:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f5b:	48 39 ca             	cmp    %rcx,%rdx
+  800f5e:	75 e7                	jne    800f47 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f60:	c3                   	ret
+
+0000000000800f61 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f61:	48 89 f8             	mov    %rdi,%rax
+  800f64:	48 85 d2             	test   %rdx,%rdx
+  800f67:	74 24                	je     800f8d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f69:	48 83 ea 01          	sub    $0x1,%rdx
+  800f6d:	74 1b                	je     800f8a <strlcpy+0x29>
+  800f6f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f73:	0f b6 16             	movzbl (%rsi),%edx
+  800f76:	84 d2                	test   %dl,%dl
+  800f78:	74 10                	je     800f8a <strlcpy+0x29>
+            *dst++ = *src++;
+  800f7a:	48 83 c6 01          	add    $0x1,%rsi
+  800f7e:	48 83 c0 01          	add    $0x1,%rax
+  800f82:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f85:	48 39 c8             	cmp    %rcx,%rax
+  800f88:	75 e9                	jne    800f73 <strlcpy+0x12>
+        *dst = '\0';
+  800f8a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f8d:	48 29 f8             	sub    %rdi,%rax
+}
+  800f90:	c3                   	ret
+
+0000000000800f91 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f91:	0f b6 07             	movzbl (%rdi),%eax
+  800f94:	84 c0                	test   %al,%al
+  800f96:	74 13                	je     800fab <strcmp+0x1a>
+  800f98:	38 06                	cmp    %al,(%rsi)
+  800f9a:	75 0f                	jne    800fab <strcmp+0x1a>
+  800f9c:	48 83 c7 01          	add    $0x1,%rdi
+  800fa0:	48 83 c6 01          	add    $0x1,%rsi
+  800fa4:	0f b6 07             	movzbl (%rdi),%eax
+  800fa7:	84 c0                	test   %al,%al
+  800fa9:	75 ed                	jne    800f98 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fab:	0f b6 c0             	movzbl %al,%eax
+  800fae:	0f b6 16             	movzbl (%rsi),%edx
+  800fb1:	29 d0                	sub    %edx,%eax
+}
+  800fb3:	c3                   	ret
+
+0000000000800fb4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fb4:	48 85 d2             	test   %rdx,%rdx
+  800fb7:	74 1f                	je     800fd8 <strncmp+0x24>
+  800fb9:	0f b6 07             	movzbl (%rdi),%eax
+  800fbc:	84 c0                	test   %al,%al
+  800fbe:	74 1e                	je     800fde <strncmp+0x2a>
+  800fc0:	3a 06                	cmp    (%rsi),%al
+  800fc2:	75 1a                	jne    800fde <strncmp+0x2a>
+  800fc4:	48 83 c7 01          	add    $0x1,%rdi
+  800fc8:	48 83 c6 01          	add    $0x1,%rsi
+  800fcc:	48 83 ea 01          	sub    $0x1,%rdx
+  800fd0:	75 e7                	jne    800fb9 <strncmp+0x5>
+
+    if (!n) return 0;
+  800fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd7:	c3                   	ret
+  800fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdd:	c3                   	ret
+  800fde:	48 85 d2             	test   %rdx,%rdx
+  800fe1:	74 09                	je     800fec <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fe3:	0f b6 07             	movzbl (%rdi),%eax
+  800fe6:	0f b6 16             	movzbl (%rsi),%edx
+  800fe9:	29 d0                	sub    %edx,%eax
+  800feb:	c3                   	ret
+    if (!n) return 0;
+  800fec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ff1:	c3                   	ret
+
+0000000000800ff2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ff2:	0f b6 17             	movzbl (%rdi),%edx
+  800ff5:	84 d2                	test   %dl,%dl
+  800ff7:	74 18                	je     801011 <strchr+0x1f>
+        if (*str == c) {
+  800ff9:	0f be d2             	movsbl %dl,%edx
+  800ffc:	39 f2                	cmp    %esi,%edx
+  800ffe:	74 17                	je     801017 <strchr+0x25>
+    for (; *str; str++) {
+  801000:	48 83 c7 01          	add    $0x1,%rdi
+  801004:	0f b6 17             	movzbl (%rdi),%edx
+  801007:	84 d2                	test   %dl,%dl
+  801009:	75 ee                	jne    800ff9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80100b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801010:	c3                   	ret
+  801011:	b8 00 00 00 00       	mov    $0x0,%eax
+  801016:	c3                   	ret
+  801017:	48 89 f8             	mov    %rdi,%rax
+}
+  80101a:	c3                   	ret
+
+000000000080101b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80101b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80101e:	0f b6 17             	movzbl (%rdi),%edx
+  801021:	84 d2                	test   %dl,%dl
+  801023:	74 13                	je     801038 <strfind+0x1d>
+  801025:	0f be d2             	movsbl %dl,%edx
+  801028:	39 f2                	cmp    %esi,%edx
+  80102a:	74 0b                	je     801037 <strfind+0x1c>
+  80102c:	48 83 c0 01          	add    $0x1,%rax
+  801030:	0f b6 10             	movzbl (%rax),%edx
+  801033:	84 d2                	test   %dl,%dl
+  801035:	75 ee                	jne    801025 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801037:	c3                   	ret
+  801038:	c3                   	ret
+
+0000000000801039 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  801039:	55                   	push   %rbp
+  80103a:	48 89 e5             	mov    %rsp,%rbp
+  80103d:	41 57                	push   %r15
+  80103f:	41 56                	push   %r14
+  801041:	41 55                	push   %r13
+  801043:	41 54                	push   %r12
+  801045:	53                   	push   %rbx
+  801046:	48 83 ec 08          	sub    $0x8,%rsp
+  80104a:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  80104d:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  801051:	45 84 ed             	test   %r13b,%r13b
+  801054:	75 12                	jne    801068 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  801056:	4c 89 f8             	mov    %r15,%rax
+  801059:	48 83 c4 08          	add    $0x8,%rsp
+  80105d:	5b                   	pop    %rbx
+  80105e:	41 5c                	pop    %r12
+  801060:	41 5d                	pop    %r13
+  801062:	41 5e                	pop    %r14
+  801064:	41 5f                	pop    %r15
+  801066:	5d                   	pop    %rbp
+  801067:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  801068:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  80106c:	4c 89 e7             	mov    %r12,%rdi
+  80106f:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  801076:	00 00 00 
+  801079:	ff d0                	call   *%rax
+  80107b:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  80107e:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  801082:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  801086:	49 bf b4 0f 80 00 00 	movabs $0x800fb4,%r15
+  80108d:	00 00 00 
+				if ((sc = *s++) == 0)
+  801090:	84 c0                	test   %al,%al
+  801092:	75 14                	jne    8010a8 <strstr+0x6f>
+					return NULL;
+  801094:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80109a:	eb ba                	jmp    801056 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  80109c:	48 83 c3 01          	add    $0x1,%rbx
+  8010a0:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010a4:	84 c0                	test   %al,%al
+  8010a6:	74 1b                	je     8010c3 <strstr+0x8a>
+			} while (sc != c);
+  8010a8:	41 38 c5             	cmp    %al,%r13b
+  8010ab:	75 ef                	jne    80109c <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  8010ad:	4c 89 f2             	mov    %r14,%rdx
+  8010b0:	4c 89 e6             	mov    %r12,%rsi
+  8010b3:	48 89 df             	mov    %rbx,%rdi
+  8010b6:	41 ff d7             	call   *%r15
+  8010b9:	85 c0                	test   %eax,%eax
+  8010bb:	75 df                	jne    80109c <strstr+0x63>
+  8010bd:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  8010c1:	eb 93                	jmp    801056 <strstr+0x1d>
+					return NULL;
+  8010c3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8010c9:	eb 8b                	jmp    801056 <strstr+0x1d>
+
+00000000008010cb <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  8010cb:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  8010cd:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  8010d0:	8d 57 20             	lea    0x20(%rdi),%edx
+  8010d3:	83 f9 1a             	cmp    $0x1a,%ecx
+  8010d6:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8010d9:	c3                   	ret
+
+00000000008010da <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  8010da:	55                   	push   %rbp
+  8010db:	48 89 e5             	mov    %rsp,%rbp
+  8010de:	41 57                	push   %r15
+  8010e0:	41 56                	push   %r14
+  8010e2:	41 55                	push   %r13
+  8010e4:	41 54                	push   %r12
+  8010e6:	53                   	push   %rbx
+  8010e7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  8010eb:	48 39 f7             	cmp    %rsi,%rdi
+  8010ee:	74 49                	je     801139 <strcasecmp+0x5f>
+  8010f0:	49 89 fd             	mov    %rdi,%r13
+  8010f3:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  8010f6:	49 bf cb 10 80 00 00 	movabs $0x8010cb,%r15
+  8010fd:	00 00 00 
+  801100:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801105:	41 0f b6 fe          	movzbl %r14b,%edi
+  801109:	41 ff d7             	call   *%r15
+  80110c:	89 c3                	mov    %eax,%ebx
+  80110e:	49 83 c4 01          	add    $0x1,%r12
+  801112:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801118:	41 ff d7             	call   *%r15
+  80111b:	29 c3                	sub    %eax,%ebx
+  80111d:	75 09                	jne    801128 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  80111f:	49 83 c5 01          	add    $0x1,%r13
+  801123:	45 84 f6             	test   %r14b,%r14b
+  801126:	75 d8                	jne    801100 <strcasecmp+0x26>
+}
+  801128:	89 d8                	mov    %ebx,%eax
+  80112a:	48 83 c4 08          	add    $0x8,%rsp
+  80112e:	5b                   	pop    %rbx
+  80112f:	41 5c                	pop    %r12
+  801131:	41 5d                	pop    %r13
+  801133:	41 5e                	pop    %r14
+  801135:	41 5f                	pop    %r15
+  801137:	5d                   	pop    %rbp
+  801138:	c3                   	ret
+        return 0;
+  801139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113e:	eb e8                	jmp    801128 <strcasecmp+0x4e>
+
+0000000000801140 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  801140:	55                   	push   %rbp
+  801141:	48 89 e5             	mov    %rsp,%rbp
+  801144:	41 57                	push   %r15
+  801146:	41 56                	push   %r14
+  801148:	41 55                	push   %r13
+  80114a:	41 54                	push   %r12
+  80114c:	53                   	push   %rbx
+  80114d:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  801151:	48 85 d2             	test   %rdx,%rdx
+  801154:	74 4f                	je     8011a5 <strncasecmp+0x65>
+  801156:	49 89 fc             	mov    %rdi,%r12
+  801159:	49 89 f5             	mov    %rsi,%r13
+  80115c:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  801160:	49 be cb 10 80 00 00 	movabs $0x8010cb,%r14
+  801167:	00 00 00 
+  80116a:	49 83 c4 01          	add    $0x1,%r12
+  80116e:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801174:	41 ff d6             	call   *%r14
+  801177:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  801179:	49 83 c5 01          	add    $0x1,%r13
+  80117d:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801182:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801185:	29 c3                	sub    %eax,%ebx
+  801187:	85 c0                	test   %eax,%eax
+  801189:	74 09                	je     801194 <strncasecmp+0x54>
+  80118b:	85 db                	test   %ebx,%ebx
+  80118d:	75 05                	jne    801194 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  80118f:	4d 39 fc             	cmp    %r15,%r12
+  801192:	75 d6                	jne    80116a <strncasecmp+0x2a>
+}
+  801194:	89 d8                	mov    %ebx,%eax
+  801196:	48 83 c4 08          	add    $0x8,%rsp
+  80119a:	5b                   	pop    %rbx
+  80119b:	41 5c                	pop    %r12
+  80119d:	41 5d                	pop    %r13
+  80119f:	41 5e                	pop    %r14
+  8011a1:	41 5f                	pop    %r15
+  8011a3:	5d                   	pop    %rbp
+  8011a4:	c3                   	ret
+    int d = 0;
+  8011a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  8011aa:	eb e8                	jmp    801194 <strncasecmp+0x54>
+
+00000000008011ac <toupper>:
+
+int toupper(int c) {
+  8011ac:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  8011ae:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  8011b1:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8011b4:	83 f9 1a             	cmp    $0x1a,%ecx
+  8011b7:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8011ba:	c3                   	ret
+
+00000000008011bb <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  8011bb:	83 ff 20             	cmp    $0x20,%edi
+  8011be:	0f 94 c0             	sete   %al
+  8011c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8011c4:	c3                   	ret
+
+00000000008011c5 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  8011c5:	89 f8                	mov    %edi,%eax
+  8011c7:	f7 d8                	neg    %eax
+  8011c9:	0f 48 c7             	cmovs  %edi,%eax
+}
+  8011cc:	c3                   	ret
+
+00000000008011cd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8011cd:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8011d0:	48 89 f8             	mov    %rdi,%rax
+  8011d3:	48 f7 d8             	neg    %rax
+  8011d6:	83 e0 07             	and    $0x7,%eax
+  8011d9:	49 89 d1             	mov    %rdx,%r9
+  8011dc:	49 29 c1             	sub    %rax,%r9
+  8011df:	78 36                	js     801217 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8011e1:	40 0f b6 c6          	movzbl %sil,%eax
+  8011e5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8011ec:	01 01 01 
+  8011ef:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8011f3:	40 f6 c7 07          	test   $0x7,%dil
+  8011f7:	75 38                	jne    801231 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8011f9:	4c 89 c9             	mov    %r9,%rcx
+  8011fc:	48 c1 f9 03          	sar    $0x3,%rcx
+  801200:	74 0c                	je     80120e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801202:	fc                   	cld
+  801203:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801206:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80120a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80120e:	4d 85 c9             	test   %r9,%r9
+  801211:	75 45                	jne    801258 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801213:	4c 89 c0             	mov    %r8,%rax
+  801216:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801217:	48 85 d2             	test   %rdx,%rdx
+  80121a:	74 f7                	je     801213 <memset+0x46>
+  80121c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80121f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801222:	48 83 c0 01          	add    $0x1,%rax
+  801226:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80122a:	48 39 c2             	cmp    %rax,%rdx
+  80122d:	75 f3                	jne    801222 <memset+0x55>
+  80122f:	eb e2                	jmp    801213 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801231:	40 f6 c7 01          	test   $0x1,%dil
+  801235:	74 06                	je     80123d <memset+0x70>
+  801237:	88 07                	mov    %al,(%rdi)
+  801239:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80123d:	40 f6 c7 02          	test   $0x2,%dil
+  801241:	74 07                	je     80124a <memset+0x7d>
+  801243:	66 89 07             	mov    %ax,(%rdi)
+  801246:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80124a:	40 f6 c7 04          	test   $0x4,%dil
+  80124e:	74 a9                	je     8011f9 <memset+0x2c>
+  801250:	89 07                	mov    %eax,(%rdi)
+  801252:	48 83 c7 04          	add    $0x4,%rdi
+  801256:	eb a1                	jmp    8011f9 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801258:	41 f6 c1 04          	test   $0x4,%r9b
+  80125c:	74 06                	je     801264 <memset+0x97>
+  80125e:	89 07                	mov    %eax,(%rdi)
+  801260:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801264:	41 f6 c1 02          	test   $0x2,%r9b
+  801268:	74 07                	je     801271 <memset+0xa4>
+  80126a:	66 89 07             	mov    %ax,(%rdi)
+  80126d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801271:	41 f6 c1 01          	test   $0x1,%r9b
+  801275:	74 9c                	je     801213 <memset+0x46>
+  801277:	88 07                	mov    %al,(%rdi)
+  801279:	eb 98                	jmp    801213 <memset+0x46>
+
+000000000080127b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80127b:	48 89 f8             	mov    %rdi,%rax
+  80127e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801281:	48 39 fe             	cmp    %rdi,%rsi
+  801284:	73 3b                	jae    8012c1 <memmove+0x46>
+  801286:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80128a:	48 39 d7             	cmp    %rdx,%rdi
+  80128d:	73 32                	jae    8012c1 <memmove+0x46>
+        s += n;
+        d += n;
+  80128f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801293:	48 89 d6             	mov    %rdx,%rsi
+  801296:	48 09 fe             	or     %rdi,%rsi
+  801299:	48 09 ce             	or     %rcx,%rsi
+  80129c:	40 f6 c6 07          	test   $0x7,%sil
+  8012a0:	75 12                	jne    8012b4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8012a2:	48 83 ef 08          	sub    $0x8,%rdi
+  8012a6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8012aa:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012ae:	fd                   	std
+  8012af:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012b2:	fc                   	cld
+  8012b3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012b4:	48 83 ef 01          	sub    $0x1,%rdi
+  8012b8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8012bc:	fd                   	std
+  8012bd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8012bf:	eb f1                	jmp    8012b2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012c1:	48 89 f2             	mov    %rsi,%rdx
+  8012c4:	48 09 c2             	or     %rax,%rdx
+  8012c7:	48 09 ca             	or     %rcx,%rdx
+  8012ca:	f6 c2 07             	test   $0x7,%dl
+  8012cd:	75 0c                	jne    8012db <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8012cf:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012d3:	48 89 c7             	mov    %rax,%rdi
+  8012d6:	fc                   	cld
+  8012d7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8012da:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8012db:	48 89 c7             	mov    %rax,%rdi
+  8012de:	fc                   	cld
+  8012df:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8012e1:	c3                   	ret
+
+00000000008012e2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8012e2:	55                   	push   %rbp
+  8012e3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8012e6:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  8012ed:	00 00 00 
+  8012f0:	ff d0                	call   *%rax
+}
+  8012f2:	5d                   	pop    %rbp
+  8012f3:	c3                   	ret
+
+00000000008012f4 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8012f4:	55                   	push   %rbp
+  8012f5:	48 89 e5             	mov    %rsp,%rbp
+  8012f8:	41 57                	push   %r15
+  8012fa:	41 56                	push   %r14
+  8012fc:	41 55                	push   %r13
+  8012fe:	41 54                	push   %r12
+  801300:	53                   	push   %rbx
+  801301:	48 83 ec 08          	sub    $0x8,%rsp
+  801305:	49 89 fe             	mov    %rdi,%r14
+  801308:	49 89 f7             	mov    %rsi,%r15
+  80130b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80130e:	48 89 f7             	mov    %rsi,%rdi
+  801311:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  801318:	00 00 00 
+  80131b:	ff d0                	call   *%rax
+  80131d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801320:	48 89 de             	mov    %rbx,%rsi
+  801323:	4c 89 f7             	mov    %r14,%rdi
+  801326:	48 b8 ca 0e 80 00 00 	movabs $0x800eca,%rax
+  80132d:	00 00 00 
+  801330:	ff d0                	call   *%rax
+  801332:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801335:	48 39 c3             	cmp    %rax,%rbx
+  801338:	74 36                	je     801370 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80133a:	48 89 d8             	mov    %rbx,%rax
+  80133d:	4c 29 e8             	sub    %r13,%rax
+  801340:	49 39 c4             	cmp    %rax,%r12
+  801343:	73 31                	jae    801376 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801345:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80134a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80134e:	4c 89 fe             	mov    %r15,%rsi
+  801351:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801358:	00 00 00 
+  80135b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80135d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801361:	48 83 c4 08          	add    $0x8,%rsp
+  801365:	5b                   	pop    %rbx
+  801366:	41 5c                	pop    %r12
+  801368:	41 5d                	pop    %r13
+  80136a:	41 5e                	pop    %r14
+  80136c:	41 5f                	pop    %r15
+  80136e:	5d                   	pop    %rbp
+  80136f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801370:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801374:	eb eb                	jmp    801361 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801376:	48 83 eb 01          	sub    $0x1,%rbx
+  80137a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80137e:	48 89 da             	mov    %rbx,%rdx
+  801381:	4c 89 fe             	mov    %r15,%rsi
+  801384:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  80138b:	00 00 00 
+  80138e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801390:	49 01 de             	add    %rbx,%r14
+  801393:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801398:	eb c3                	jmp    80135d <strlcat+0x69>
+
+000000000080139a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80139a:	48 85 d2             	test   %rdx,%rdx
+  80139d:	74 2d                	je     8013cc <memcmp+0x32>
+  80139f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8013a4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8013a8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013ad:	44 38 c1             	cmp    %r8b,%cl
+  8013b0:	75 0f                	jne    8013c1 <memcmp+0x27>
+    while (n-- > 0) {
+  8013b2:	48 83 c0 01          	add    $0x1,%rax
+  8013b6:	48 39 c2             	cmp    %rax,%rdx
+  8013b9:	75 e9                	jne    8013a4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8013bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8013c1:	0f b6 c1             	movzbl %cl,%eax
+  8013c4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8013c8:	44 29 c0             	sub    %r8d,%eax
+  8013cb:	c3                   	ret
+    return 0;
+  8013cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013d1:	c3                   	ret
+
+00000000008013d2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8013d2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8013d6:	48 39 c7             	cmp    %rax,%rdi
+  8013d9:	73 0f                	jae    8013ea <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8013db:	40 38 37             	cmp    %sil,(%rdi)
+  8013de:	74 0e                	je     8013ee <memfind+0x1c>
+    for (; src < end; src++) {
+  8013e0:	48 83 c7 01          	add    $0x1,%rdi
+  8013e4:	48 39 f8             	cmp    %rdi,%rax
+  8013e7:	75 f2                	jne    8013db <memfind+0x9>
+  8013e9:	c3                   	ret
+  8013ea:	48 89 f8             	mov    %rdi,%rax
+  8013ed:	c3                   	ret
+  8013ee:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8013f1:	c3                   	ret
+
+00000000008013f2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8013f2:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8013f5:	0f b6 37             	movzbl (%rdi),%esi
+  8013f8:	40 80 fe 20          	cmp    $0x20,%sil
+  8013fc:	74 06                	je     801404 <strtol+0x12>
+  8013fe:	40 80 fe 09          	cmp    $0x9,%sil
+  801402:	75 13                	jne    801417 <strtol+0x25>
+  801404:	48 83 c7 01          	add    $0x1,%rdi
+  801408:	0f b6 37             	movzbl (%rdi),%esi
+  80140b:	40 80 fe 20          	cmp    $0x20,%sil
+  80140f:	74 f3                	je     801404 <strtol+0x12>
+  801411:	40 80 fe 09          	cmp    $0x9,%sil
+  801415:	74 ed                	je     801404 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801417:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80141a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80141d:	3c 01                	cmp    $0x1,%al
+  80141f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801423:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801429:	75 0f                	jne    80143a <strtol+0x48>
+  80142b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80142e:	74 14                	je     801444 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801430:	85 d2                	test   %edx,%edx
+  801432:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801437:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80143a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80143f:	4c 63 ca             	movslq %edx,%r9
+  801442:	eb 36                	jmp    80147a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801444:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801448:	74 0f                	je     801459 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80144a:	85 d2                	test   %edx,%edx
+  80144c:	75 ec                	jne    80143a <strtol+0x48>
+        s++;
+  80144e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801452:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801457:	eb e1                	jmp    80143a <strtol+0x48>
+        s += 2;
+  801459:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80145d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801462:	eb d6                	jmp    80143a <strtol+0x48>
+            dig -= '0';
+  801464:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801467:	44 0f b6 c1          	movzbl %cl,%r8d
+  80146b:	41 39 d0             	cmp    %edx,%r8d
+  80146e:	7d 21                	jge    801491 <strtol+0x9f>
+        val = val * base + dig;
+  801470:	49 0f af c1          	imul   %r9,%rax
+  801474:	0f b6 c9             	movzbl %cl,%ecx
+  801477:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80147a:	48 83 c7 01          	add    $0x1,%rdi
+  80147e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801482:	80 f9 39             	cmp    $0x39,%cl
+  801485:	76 dd                	jbe    801464 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801487:	80 f9 7b             	cmp    $0x7b,%cl
+  80148a:	77 05                	ja     801491 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80148c:	83 e9 57             	sub    $0x57,%ecx
+  80148f:	eb d6                	jmp    801467 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801491:	4d 85 d2             	test   %r10,%r10
+  801494:	74 03                	je     801499 <strtol+0xa7>
+  801496:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801499:	48 89 c2             	mov    %rax,%rdx
+  80149c:	48 f7 da             	neg    %rdx
+  80149f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8014a3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8014a7:	c3                   	ret
+
+00000000008014a8 <atoi>:
+int atoi(const char *str) {
+  8014a8:	55                   	push   %rbp
+  8014a9:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8014ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b6:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  8014bd:	00 00 00 
+  8014c0:	ff d0                	call   *%rax
+}
+  8014c2:	5d                   	pop    %rbp
+  8014c3:	c3                   	ret
+
+00000000008014c4 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8014c4:	55                   	push   %rbp
+  8014c5:	48 89 e5             	mov    %rsp,%rbp
+  8014c8:	53                   	push   %rbx
+  8014c9:	48 89 fa             	mov    %rdi,%rdx
+  8014cc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014cf:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014de:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8014eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ef:	c9                   	leave
+  8014f0:	c3                   	ret
+
+00000000008014f1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8014f1:	55                   	push   %rbp
+  8014f2:	48 89 e5             	mov    %rsp,%rbp
+  8014f5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801500:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801505:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80150f:	be 00 00 00 00       	mov    $0x0,%esi
+  801514:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80151c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801520:	c9                   	leave
+  801521:	c3                   	ret
+
+0000000000801522 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801522:	55                   	push   %rbp
+  801523:	48 89 e5             	mov    %rsp,%rbp
+  801526:	53                   	push   %rbx
+  801527:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80152b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80152e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801533:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801538:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801542:	be 00 00 00 00       	mov    $0x0,%esi
+  801547:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80154d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80154f:	48 85 c0             	test   %rax,%rax
+  801552:	7f 06                	jg     80155a <sys_env_destroy+0x38>
+}
+  801554:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801558:	c9                   	leave
+  801559:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80155a:	49 89 c0             	mov    %rax,%r8
+  80155d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801562:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801569:	00 00 00 
+  80156c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801571:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801578:	00 00 00 
+  80157b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801580:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  801587:	00 00 00 
+  80158a:	41 ff d1             	call   *%r9
+
+000000000080158d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80158d:	55                   	push   %rbp
+  80158e:	48 89 e5             	mov    %rsp,%rbp
+  801591:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801592:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801597:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015bc:	c9                   	leave
+  8015bd:	c3                   	ret
+
+00000000008015be <sys_yield>:
+
+void
+sys_yield(void) {
+  8015be:	55                   	push   %rbp
+  8015bf:	48 89 e5             	mov    %rsp,%rbp
+  8015c2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e7:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ed:	c9                   	leave
+  8015ee:	c3                   	ret
+
+00000000008015ef <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8015ef:	55                   	push   %rbp
+  8015f0:	48 89 e5             	mov    %rsp,%rbp
+  8015f3:	53                   	push   %rbx
+  8015f4:	48 89 fa             	mov    %rdi,%rdx
+  8015f7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ff:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801606:	00 00 00 
+  801609:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160e:	be 00 00 00 00       	mov    $0x0,%esi
+  801613:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801619:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80161b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161f:	c9                   	leave
+  801620:	c3                   	ret
+
+0000000000801621 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801621:	55                   	push   %rbp
+  801622:	48 89 e5             	mov    %rsp,%rbp
+  801625:	53                   	push   %rbx
+  801626:	49 89 f8             	mov    %rdi,%r8
+  801629:	48 89 d3             	mov    %rdx,%rbx
+  80162c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80162f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801634:	4c 89 c2             	mov    %r8,%rdx
+  801637:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80163a:	be 00 00 00 00       	mov    $0x0,%esi
+  80163f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801645:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801647:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164b:	c9                   	leave
+  80164c:	c3                   	ret
+
+000000000080164d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80164d:	55                   	push   %rbp
+  80164e:	48 89 e5             	mov    %rsp,%rbp
+  801651:	53                   	push   %rbx
+  801652:	48 83 ec 08          	sub    $0x8,%rsp
+  801656:	89 f8                	mov    %edi,%eax
+  801658:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80165b:	48 63 f9             	movslq %ecx,%rdi
+  80165e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801661:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801666:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801669:	be 00 00 00 00       	mov    $0x0,%esi
+  80166e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801674:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801676:	48 85 c0             	test   %rax,%rax
+  801679:	7f 06                	jg     801681 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80167b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167f:	c9                   	leave
+  801680:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801681:	49 89 c0             	mov    %rax,%r8
+  801684:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801689:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801690:	00 00 00 
+  801693:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801698:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80169f:	00 00 00 
+  8016a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a7:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  8016ae:	00 00 00 
+  8016b1:	41 ff d1             	call   *%r9
+
+00000000008016b4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016b4:	55                   	push   %rbp
+  8016b5:	48 89 e5             	mov    %rsp,%rbp
+  8016b8:	53                   	push   %rbx
+  8016b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8016bd:	89 f8                	mov    %edi,%eax
+  8016bf:	49 89 f2             	mov    %rsi,%r10
+  8016c2:	48 89 cf             	mov    %rcx,%rdi
+  8016c5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8016c8:	48 63 da             	movslq %edx,%rbx
+  8016cb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ce:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016d3:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d6:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8016d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016db:	48 85 c0             	test   %rax,%rax
+  8016de:	7f 06                	jg     8016e6 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e6:	49 89 c0             	mov    %rax,%r8
+  8016e9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8016ee:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  8016f5:	00 00 00 
+  8016f8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016fd:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801704:	00 00 00 
+  801707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170c:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  801713:	00 00 00 
+  801716:	41 ff d1             	call   *%r9
+
+0000000000801719 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801719:	55                   	push   %rbp
+  80171a:	48 89 e5             	mov    %rsp,%rbp
+  80171d:	53                   	push   %rbx
+  80171e:	48 83 ec 08          	sub    $0x8,%rsp
+  801722:	49 89 f9             	mov    %rdi,%r9
+  801725:	89 f0                	mov    %esi,%eax
+  801727:	48 89 d3             	mov    %rdx,%rbx
+  80172a:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80172d:	49 63 f0             	movslq %r8d,%rsi
+  801730:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801733:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801738:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801741:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801743:	48 85 c0             	test   %rax,%rax
+  801746:	7f 06                	jg     80174e <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801748:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174c:	c9                   	leave
+  80174d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80174e:	49 89 c0             	mov    %rax,%r8
+  801751:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801756:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  80175d:	00 00 00 
+  801760:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801765:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80176c:	00 00 00 
+  80176f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801774:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  80177b:	00 00 00 
+  80177e:	41 ff d1             	call   *%r9
+
+0000000000801781 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801781:	55                   	push   %rbp
+  801782:	48 89 e5             	mov    %rsp,%rbp
+  801785:	53                   	push   %rbx
+  801786:	89 f8                	mov    %edi,%eax
+  801788:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80178b:	48 63 f9             	movslq %ecx,%rdi
+  80178e:	48 63 da             	movslq %edx,%rbx
+  801791:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801794:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801799:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80179c:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a7:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8017a9:	89 c2                	mov    %eax,%edx
+  8017ab:	48 85 c0             	test   %rax,%rax
+  8017ae:	78 0d                	js     8017bd <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8017b0:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8017b5:	4d 85 c9             	test   %r9,%r9
+  8017b8:	74 03                	je     8017bd <sys_alloc_dma_region+0x3c>
+  8017ba:	49 89 01             	mov    %rax,(%r9)
+}
+  8017bd:	89 d0                	mov    %edx,%eax
+  8017bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c3:	c9                   	leave
+  8017c4:	c3                   	ret
+
+00000000008017c5 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8017c5:	55                   	push   %rbp
+  8017c6:	48 89 e5             	mov    %rsp,%rbp
+  8017c9:	53                   	push   %rbx
+  8017ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ce:	48 89 f1             	mov    %rsi,%rcx
+  8017d1:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017d4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d7:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ee:	48 85 c0             	test   %rax,%rax
+  8017f1:	7f 06                	jg     8017f9 <sys_set_cache_region+0x34>
+}
+  8017f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f7:	c9                   	leave
+  8017f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017f9:	49 89 c0             	mov    %rax,%r8
+  8017fc:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801801:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801808:	00 00 00 
+  80180b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801810:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801817:	00 00 00 
+  80181a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181f:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  801826:	00 00 00 
+  801829:	41 ff d1             	call   *%r9
+
+000000000080182c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80182c:	55                   	push   %rbp
+  80182d:	48 89 e5             	mov    %rsp,%rbp
+  801830:	53                   	push   %rbx
+  801831:	48 83 ec 08          	sub    $0x8,%rsp
+  801835:	48 89 f1             	mov    %rsi,%rcx
+  801838:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80183b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80183e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801843:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801848:	be 00 00 00 00       	mov    $0x0,%esi
+  80184d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801853:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801855:	48 85 c0             	test   %rax,%rax
+  801858:	7f 06                	jg     801860 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80185a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80185e:	c9                   	leave
+  80185f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801860:	49 89 c0             	mov    %rax,%r8
+  801863:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801868:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  80186f:	00 00 00 
+  801872:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801877:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80187e:	00 00 00 
+  801881:	b8 00 00 00 00       	mov    $0x0,%eax
+  801886:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  80188d:	00 00 00 
+  801890:	41 ff d1             	call   *%r9
+
+0000000000801893 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801893:	55                   	push   %rbp
+  801894:	48 89 e5             	mov    %rsp,%rbp
+  801897:	53                   	push   %rbx
+  801898:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80189c:	48 63 ce             	movslq %esi,%rcx
+  80189f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018be:	48 85 c0             	test   %rax,%rax
+  8018c1:	7f 06                	jg     8018c9 <sys_env_set_status+0x36>
+}
+  8018c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c7:	c9                   	leave
+  8018c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018c9:	49 89 c0             	mov    %rax,%r8
+  8018cc:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8018d1:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  8018d8:	00 00 00 
+  8018db:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018e0:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  8018e7:	00 00 00 
+  8018ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ef:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  8018f6:	00 00 00 
+  8018f9:	41 ff d1             	call   *%r9
+
+00000000008018fc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8018fc:	55                   	push   %rbp
+  8018fd:	48 89 e5             	mov    %rsp,%rbp
+  801900:	53                   	push   %rbx
+  801901:	48 83 ec 08          	sub    $0x8,%rsp
+  801905:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801908:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80190b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801910:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801915:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80191a:	be 00 00 00 00       	mov    $0x0,%esi
+  80191f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801925:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801927:	48 85 c0             	test   %rax,%rax
+  80192a:	7f 06                	jg     801932 <sys_env_set_trapframe+0x36>
+}
+  80192c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801930:	c9                   	leave
+  801931:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801932:	49 89 c0             	mov    %rax,%r8
+  801935:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80193a:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801941:	00 00 00 
+  801944:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801949:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801950:	00 00 00 
+  801953:	b8 00 00 00 00       	mov    $0x0,%eax
+  801958:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  80195f:	00 00 00 
+  801962:	41 ff d1             	call   *%r9
+
+0000000000801965 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801965:	55                   	push   %rbp
+  801966:	48 89 e5             	mov    %rsp,%rbp
+  801969:	53                   	push   %rbx
+  80196a:	48 83 ec 08          	sub    $0x8,%rsp
+  80196e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801971:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801974:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801979:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80197e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801983:	be 00 00 00 00       	mov    $0x0,%esi
+  801988:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80198e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801990:	48 85 c0             	test   %rax,%rax
+  801993:	7f 06                	jg     80199b <sys_env_set_pgfault_upcall+0x36>
+}
+  801995:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801999:	c9                   	leave
+  80199a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80199b:	49 89 c0             	mov    %rax,%r8
+  80199e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8019a3:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  8019aa:	00 00 00 
+  8019ad:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019b2:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  8019b9:	00 00 00 
+  8019bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c1:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  8019c8:	00 00 00 
+  8019cb:	41 ff d1             	call   *%r9
+
+00000000008019ce <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019ce:	55                   	push   %rbp
+  8019cf:	48 89 e5             	mov    %rsp,%rbp
+  8019d2:	53                   	push   %rbx
+  8019d3:	89 f8                	mov    %edi,%eax
+  8019d5:	49 89 f1             	mov    %rsi,%r9
+  8019d8:	48 89 d3             	mov    %rdx,%rbx
+  8019db:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019de:	49 63 f0             	movslq %r8d,%rsi
+  8019e1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019e4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019e9:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019f2:	cd 30                	int    $0x30
+}
+  8019f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019f8:	c9                   	leave
+  8019f9:	c3                   	ret
+
+00000000008019fa <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8019fa:	55                   	push   %rbp
+  8019fb:	48 89 e5             	mov    %rsp,%rbp
+  8019fe:	53                   	push   %rbx
+  8019ff:	48 83 ec 08          	sub    $0x8,%rsp
+  801a03:	48 89 fa             	mov    %rdi,%rdx
+  801a06:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a09:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a13:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a18:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a23:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a25:	48 85 c0             	test   %rax,%rax
+  801a28:	7f 06                	jg     801a30 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a2e:	c9                   	leave
+  801a2f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a30:	49 89 c0             	mov    %rax,%r8
+  801a33:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801a38:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801a3f:	00 00 00 
+  801a42:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a47:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801a4e:	00 00 00 
+  801a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a56:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  801a5d:	00 00 00 
+  801a60:	41 ff d1             	call   *%r9
+
+0000000000801a63 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801a63:	55                   	push   %rbp
+  801a64:	48 89 e5             	mov    %rsp,%rbp
+  801a67:	53                   	push   %rbx
+  801a68:	48 89 fa             	mov    %rdi,%rdx
+  801a6b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a6e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a78:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a88:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a8e:	c9                   	leave
+  801a8f:	c3                   	ret
+
+0000000000801a90 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a90:	55                   	push   %rbp
+  801a91:	48 89 e5             	mov    %rsp,%rbp
+  801a94:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a95:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801aa4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aae:	be 00 00 00 00       	mov    $0x0,%esi
+  801ab3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ab9:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801abb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801abf:	c9                   	leave
+  801ac0:	c3                   	ret
+
+0000000000801ac1 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801ac1:	48 85 ff             	test   %rdi,%rdi
+  801ac4:	0f 84 b6 01 00 00    	je     801c80 <malloc+0x1bf>
+malloc(size_t size) {
+  801aca:	55                   	push   %rbp
+  801acb:	48 89 e5             	mov    %rsp,%rbp
+  801ace:	41 56                	push   %r14
+  801ad0:	41 55                	push   %r13
+  801ad2:	41 54                	push   %r12
+  801ad4:	53                   	push   %rbx
+  801ad5:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801ad8:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801adf:	00 00 00 
+  801ae2:	4c 8b 20             	mov    (%rax),%r12
+  801ae5:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801aec:	0f 87 94 01 00 00    	ja     801c86 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801af2:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801af9:	00 00 00 
+  801afc:	48 85 c0             	test   %rax,%rax
+  801aff:	74 6b                	je     801b6c <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801b01:	4d 85 e4             	test   %r12,%r12
+  801b04:	74 66                	je     801b6c <malloc+0xab>
+  801b06:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801b0d:	00 00 00 
+  801b10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b15:	eb 0d                	jmp    801b24 <malloc+0x63>
+  801b17:	48 83 c1 01          	add    $0x1,%rcx
+  801b1b:	48 83 c2 18          	add    $0x18,%rdx
+  801b1f:	49 39 cc             	cmp    %rcx,%r12
+  801b22:	74 48                	je     801b6c <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801b24:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801b29:	74 ec                	je     801b17 <malloc+0x56>
+  801b2b:	48 39 1a             	cmp    %rbx,(%rdx)
+  801b2e:	72 e7                	jb     801b17 <malloc+0x56>
+                real_freep_size--;
+  801b30:	48 83 e8 01          	sub    $0x1,%rax
+  801b34:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801b3b:	00 00 00 
+                freep[i].is_free = false;
+  801b3e:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801b45:	00 00 00 
+  801b48:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801b4c:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801b50:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801b54:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801b5b:	00 
+                freep[i].size = size;
+  801b5c:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801b60:	48 01 c8             	add    %rcx,%rax
+  801b63:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b67:	e9 0b 01 00 00       	jmp    801c77 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801b6c:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801b73:	00 00 00 
+  801b76:	48 01 d8             	add    %rbx,%rax
+  801b79:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801b7f:	76 7c                	jbe    801bfd <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801b81:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801b88:	00 00 00 
+  801b8b:	4c 8b 30             	mov    (%rax),%r14
+  801b8e:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801b95:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801b98:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801b9f:	00 00 00 
+  801ba2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801ba9:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801bb0:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801bb6:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801bba:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  801bc1:	00 00 00 
+  801bc4:	ff d0                	call   *%rax
+  801bc6:	89 c7                	mov    %eax,%edi
+  801bc8:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801bcf:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801bd6:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801bdd:	00 00 00 
+  801be0:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801be4:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801be9:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  801bf0:	00 00 00 
+  801bf3:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801bf5:	85 c0                	test   %eax,%eax
+  801bf7:	0f 88 90 00 00 00    	js     801c8d <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801bfd:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801c04:	00 00 00 
+  801c07:	48 8b 31             	mov    (%rcx),%rsi
+  801c0a:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801c11:	00 00 00 
+  801c14:	4c 8b 07             	mov    (%rdi),%r8
+  801c17:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801c1b:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801c22:	00 00 00 
+  801c25:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801c29:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801c2d:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801c34:	00 00 00 
+  801c37:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801c3b:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801c3e:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801c42:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801c49:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801c4a:	48 89 d8             	mov    %rbx,%rax
+  801c4d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c52:	4c 01 c0             	add    %r8,%rax
+  801c55:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801c58:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801c5f:	48 01 f3             	add    %rsi,%rbx
+  801c62:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801c65:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801c6a:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801c71:	00 00 00 
+  801c74:	48 89 d0             	mov    %rdx,%rax
+}
+  801c77:	5b                   	pop    %rbx
+  801c78:	41 5c                	pop    %r12
+  801c7a:	41 5d                	pop    %r13
+  801c7c:	41 5e                	pop    %r14
+  801c7e:	5d                   	pop    %rbp
+  801c7f:	c3                   	ret
+        return NULL;
+  801c80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c85:	c3                   	ret
+        return NULL;
+  801c86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8b:	eb ea                	jmp    801c77 <malloc+0x1b6>
+            return NULL;
+  801c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c92:	eb e3                	jmp    801c77 <malloc+0x1b6>
+
+0000000000801c94 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801c94:	55                   	push   %rbp
+  801c95:	48 89 e5             	mov    %rsp,%rbp
+  801c98:	53                   	push   %rbx
+  801c99:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801c9d:	48 89 fb             	mov    %rdi,%rbx
+  801ca0:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801ca4:	48 89 df             	mov    %rbx,%rdi
+  801ca7:	48 b8 c1 1a 80 00 00 	movabs $0x801ac1,%rax
+  801cae:	00 00 00 
+  801cb1:	ff d0                	call   *%rax
+  801cb3:	48 89 c7             	mov    %rax,%rdi
+  801cb6:	48 89 da             	mov    %rbx,%rdx
+  801cb9:	be 00 00 00 00       	mov    $0x0,%esi
+  801cbe:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  801cc5:	00 00 00 
+  801cc8:	ff d0                	call   *%rax
+}
+  801cca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cce:	c9                   	leave
+  801ccf:	c3                   	ret
+
+0000000000801cd0 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801cd0:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801cd7:	00 00 00 
+  801cda:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801ce1:	00 00 00 
+  801ce4:	48 3b 02             	cmp    (%rdx),%rax
+  801ce7:	74 4d                	je     801d36 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801ce9:	48 85 c0             	test   %rax,%rax
+  801cec:	74 4d                	je     801d3b <get_allocsize+0x6b>
+  801cee:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801cf5:	00 00 00 
+  801cf8:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801cfd:	48 3b 39             	cmp    (%rcx),%rdi
+  801d00:	74 13                	je     801d15 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801d02:	48 83 c2 01          	add    $0x1,%rdx
+  801d06:	48 83 c1 18          	add    $0x18,%rcx
+  801d0a:	48 39 d0             	cmp    %rdx,%rax
+  801d0d:	75 ee                	jne    801cfd <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d14:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801d15:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1e:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801d25:	00 00 00 
+  801d28:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801d2e:	75 0b                	jne    801d3b <get_allocsize+0x6b>
+  801d30:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801d35:	c3                   	ret
+        return 0;
+  801d36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d3b:	c3                   	ret
+
+0000000000801d3c <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801d3c:	48 85 ff             	test   %rdi,%rdi
+  801d3f:	0f 84 01 01 00 00    	je     801e46 <free+0x10a>
+free(void *ptr) {
+  801d45:	55                   	push   %rbp
+  801d46:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801d49:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801d50:	00 00 00 
+  801d53:	48 8b 30             	mov    (%rax),%rsi
+  801d56:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801d5d:	00 00 00 
+  801d60:	48 39 c6             	cmp    %rax,%rsi
+  801d63:	74 50                	je     801db5 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801d65:	48 85 f6             	test   %rsi,%rsi
+  801d68:	74 21                	je     801d8b <free+0x4f>
+  801d6a:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801d71:	00 00 00 
+  801d74:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801d79:	48 3b 39             	cmp    (%rcx),%rdi
+  801d7c:	74 61                	je     801ddf <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801d7e:	48 83 c2 01          	add    $0x1,%rdx
+  801d82:	48 83 c1 18          	add    $0x18,%rcx
+  801d86:	48 39 d6             	cmp    %rdx,%rsi
+  801d89:	75 ee                	jne    801d79 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801d8b:	48 ba 70 56 80 00 00 	movabs $0x805670,%rdx
+  801d92:	00 00 00 
+  801d95:	be 12 01 00 00       	mov    $0x112,%esi
+  801d9a:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801da1:	00 00 00 
+  801da4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da9:	48 b9 25 04 80 00 00 	movabs $0x800425,%rcx
+  801db0:	00 00 00 
+  801db3:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801db5:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  801dbc:	00 00 00 
+  801dbf:	be 06 01 00 00       	mov    $0x106,%esi
+  801dc4:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801dcb:	00 00 00 
+  801dce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd3:	48 b9 25 04 80 00 00 	movabs $0x800425,%rcx
+  801dda:	00 00 00 
+  801ddd:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801ddf:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801de3:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801dea:	00 00 00 
+  801ded:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801df3:	75 27                	jne    801e1c <free+0xe0>
+            freep[i].is_free = true;
+  801df5:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801df9:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801e00:	00 00 00 
+  801e03:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801e0a:	00 00 
+            real_freep_size++;
+  801e0c:	48 83 c0 01          	add    $0x1,%rax
+  801e10:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801e17:	00 00 00 
+}
+  801e1a:	5d                   	pop    %rbp
+  801e1b:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801e1c:	48 ba 48 56 80 00 00 	movabs $0x805648,%rdx
+  801e23:	00 00 00 
+  801e26:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801e2b:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801e32:	00 00 00 
+  801e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3a:	48 b9 25 04 80 00 00 	movabs $0x800425,%rcx
+  801e41:	00 00 00 
+  801e44:	ff d1                	call   *%rcx
+  801e46:	c3                   	ret
+
+0000000000801e47 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801e47:	55                   	push   %rbp
+  801e48:	48 89 e5             	mov    %rsp,%rbp
+  801e4b:	41 55                	push   %r13
+  801e4d:	41 54                	push   %r12
+  801e4f:	53                   	push   %rbx
+  801e50:	48 83 ec 08          	sub    $0x8,%rsp
+  801e54:	48 89 fb             	mov    %rdi,%rbx
+  801e57:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801e5a:	48 b8 d0 1c 80 00 00 	movabs $0x801cd0,%rax
+  801e61:	00 00 00 
+  801e64:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801e66:	49 39 c5             	cmp    %rax,%r13
+  801e69:	73 0e                	jae    801e79 <realloc+0x32>
+}
+  801e6b:	48 89 d8             	mov    %rbx,%rax
+  801e6e:	48 83 c4 08          	add    $0x8,%rsp
+  801e72:	5b                   	pop    %rbx
+  801e73:	41 5c                	pop    %r12
+  801e75:	41 5d                	pop    %r13
+  801e77:	5d                   	pop    %rbp
+  801e78:	c3                   	ret
+  801e79:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801e7c:	4c 89 ef             	mov    %r13,%rdi
+  801e7f:	48 b8 c1 1a 80 00 00 	movabs $0x801ac1,%rax
+  801e86:	00 00 00 
+  801e89:	ff d0                	call   *%rax
+  801e8b:	48 89 c7             	mov    %rax,%rdi
+  801e8e:	4c 89 e2             	mov    %r12,%rdx
+  801e91:	48 89 de             	mov    %rbx,%rsi
+  801e94:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+  801ea0:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801ea3:	48 89 df             	mov    %rbx,%rdi
+  801ea6:	48 b8 3c 1d 80 00 00 	movabs $0x801d3c,%rax
+  801ead:	00 00 00 
+  801eb0:	ff d0                	call   *%rax
+    return newptr;
+  801eb2:	4c 89 e3             	mov    %r12,%rbx
+  801eb5:	eb b4                	jmp    801e6b <realloc+0x24>
+
+0000000000801eb7 <strdup>:
+
+char*
+strdup (const char *src) {
+  801eb7:	55                   	push   %rbp
+  801eb8:	48 89 e5             	mov    %rsp,%rbp
+  801ebb:	41 54                	push   %r12
+  801ebd:	53                   	push   %rbx
+  801ebe:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801ec1:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  801ec8:	00 00 00 
+  801ecb:	ff d0                	call   *%rax
+  801ecd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801ed1:	4c 89 e7             	mov    %r12,%rdi
+  801ed4:	48 b8 c1 1a 80 00 00 	movabs $0x801ac1,%rax
+  801edb:	00 00 00 
+  801ede:	ff d0                	call   *%rax
+  801ee0:	48 89 c7             	mov    %rax,%rdi
+  801ee3:	4c 89 e2             	mov    %r12,%rdx
+  801ee6:	48 89 de             	mov    %rbx,%rsi
+  801ee9:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  801ef0:	00 00 00 
+  801ef3:	ff d0                	call   *%rax
+}
+  801ef5:	5b                   	pop    %rbx
+  801ef6:	41 5c                	pop    %r12
+  801ef8:	5d                   	pop    %rbp
+  801ef9:	c3                   	ret
+
+0000000000801efa <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801efa:	55                   	push   %rbp
+  801efb:	48 89 e5             	mov    %rsp,%rbp
+  801efe:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801eff:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f09:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f13:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f18:	be 00 00 00 00       	mov    $0x0,%esi
+  801f1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f23:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f25:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f29:	c9                   	leave
+  801f2a:	c3                   	ret
+
+0000000000801f2b <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801f2b:	55                   	push   %rbp
+  801f2c:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801f2f:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801f36:	00 00 00 
+  801f39:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801f3d:	74 26                	je     801f65 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801f3f:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f41:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f45:	89 c0                	mov    %eax,%eax
+  801f47:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801f4a:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801f51:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801f58:	00 00 00 
+  801f5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f60:	48 f7 31             	divq   (%rcx)
+}
+  801f63:	5d                   	pop    %rbp
+  801f64:	c3                   	ret
+        freq = get_cpufreq();
+  801f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6a:	48 ba fa 1e 80 00 00 	movabs $0x801efa,%rdx
+  801f71:	00 00 00 
+  801f74:	ff d2                	call   *%rdx
+  801f76:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801f7d:	00 00 00 
+  801f80:	eb bd                	jmp    801f3f <get_ticks+0x14>
+
+0000000000801f82 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801f82:	55                   	push   %rbp
+  801f83:	48 89 e5             	mov    %rsp,%rbp
+  801f86:	53                   	push   %rbx
+  801f87:	48 83 ec 08          	sub    $0x8,%rsp
+  801f8b:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801f8e:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801f95:	00 00 00 
+  801f98:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801f9c:	74 50                	je     801fee <sleep+0x6c>
+    asm volatile("rdtsc"
+  801f9e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fa0:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fa4:	89 c0                	mov    %eax,%eax
+  801fa6:	48 89 d6             	mov    %rdx,%rsi
+  801fa9:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801fac:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801fb3:	00 00 00 
+  801fb6:	48 0f af 18          	imul   (%rax),%rbx
+  801fba:	48 c1 eb 03          	shr    $0x3,%rbx
+  801fbe:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801fc5:	9b c4 20 
+  801fc8:	48 89 d8             	mov    %rbx,%rax
+  801fcb:	48 f7 e2             	mul    %rdx
+  801fce:	48 89 d1             	mov    %rdx,%rcx
+  801fd1:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801fd5:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fd7:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fdb:	89 c0                	mov    %eax,%eax
+  801fdd:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801fe0:	48 29 f2             	sub    %rsi,%rdx
+  801fe3:	48 39 ca             	cmp    %rcx,%rdx
+  801fe6:	72 ed                	jb     801fd5 <sleep+0x53>
+}
+  801fe8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fec:	c9                   	leave
+  801fed:	c3                   	ret
+        freq = get_cpufreq();
+  801fee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff3:	48 ba fa 1e 80 00 00 	movabs $0x801efa,%rdx
+  801ffa:	00 00 00 
+  801ffd:	ff d2                	call   *%rdx
+  801fff:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  802006:	00 00 00 
+  802009:	eb 93                	jmp    801f9e <sleep+0x1c>
+
+000000000080200b <poll_kbd>:
+
+int poll_kbd() {
+  80200b:	55                   	push   %rbp
+  80200c:	48 89 e5             	mov    %rsp,%rbp
+  80200f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802010:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802015:	ba 00 00 00 00       	mov    $0x0,%edx
+  80201a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80201f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802024:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802029:	be 00 00 00 00       	mov    $0x0,%esi
+  80202e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802034:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  802036:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80203a:	c9                   	leave
+  80203b:	c3                   	ret
+
+000000000080203c <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  80203c:	55                   	push   %rbp
+  80203d:	48 89 e5             	mov    %rsp,%rbp
+  802040:	53                   	push   %rbx
+  802041:	49 89 fa             	mov    %rdi,%r10
+  802044:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  802046:	44 89 c6             	mov    %r8d,%esi
+  802049:	89 cf                	mov    %ecx,%edi
+  80204b:	89 d3                	mov    %edx,%ebx
+  80204d:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80204f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802054:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802057:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  80205b:	cd 30                	int    $0x30
+  80205d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802061:	c9                   	leave
+  802062:	c3                   	ret
+
+0000000000802063 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802063:	55                   	push   %rbp
+  802064:	48 89 e5             	mov    %rsp,%rbp
+  802067:	41 54                	push   %r12
+  802069:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  80206a:	48 b8 1c 38 80 00 00 	movabs $0x80381c,%rax
+  802071:	00 00 00 
+  802074:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802076:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80207b:	cd 30                	int    $0x30
+  80207d:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  802080:	85 c0                	test   %eax,%eax
+  802082:	78 76                	js     8020fa <fork+0x97>
+        return envid;
+    if (!envid) {
+  802084:	74 7c                	je     802102 <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  802086:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80208c:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802093:	00 00 00 
+  802096:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80209b:	89 c2                	mov    %eax,%edx
+  80209d:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020a7:	48 b8 b4 16 80 00 00 	movabs $0x8016b4,%rax
+  8020ae:	00 00 00 
+  8020b1:	ff d0                	call   *%rax
+  8020b3:	85 c0                	test   %eax,%eax
+  8020b5:	75 7c                	jne    802133 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  8020b7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020be:	00 00 00 
+  8020c1:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8020c8:	44 89 e7             	mov    %r12d,%edi
+  8020cb:	48 b8 65 19 80 00 00 	movabs $0x801965,%rax
+  8020d2:	00 00 00 
+  8020d5:	ff d0                	call   *%rax
+  8020d7:	85 c0                	test   %eax,%eax
+  8020d9:	75 60                	jne    80213b <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  8020db:	be 02 00 00 00       	mov    $0x2,%esi
+  8020e0:	44 89 e7             	mov    %r12d,%edi
+  8020e3:	48 b8 93 18 80 00 00 	movabs $0x801893,%rax
+  8020ea:	00 00 00 
+  8020ed:	ff d0                	call   *%rax
+        return -1;
+  8020ef:	85 c0                	test   %eax,%eax
+  8020f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8020f6:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  8020fa:	44 89 e0             	mov    %r12d,%eax
+  8020fd:	5b                   	pop    %rbx
+  8020fe:	41 5c                	pop    %r12
+  802100:	5d                   	pop    %rbp
+  802101:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802102:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  802109:	00 00 00 
+  80210c:	ff d0                	call   *%rax
+  80210e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802113:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80211a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802121:	00 00 00 
+  802124:	48 01 d0             	add    %rdx,%rax
+  802127:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  80212e:	00 00 00 
+        return 0;
+  802131:	eb c7                	jmp    8020fa <fork+0x97>
+        return -1;
+  802133:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802139:	eb bf                	jmp    8020fa <fork+0x97>
+  80213b:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802141:	eb b7                	jmp    8020fa <fork+0x97>
+
+0000000000802143 <sfork>:
+
+envid_t
+sfork() {
+  802143:	55                   	push   %rbp
+  802144:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  802147:	48 ba a6 56 80 00 00 	movabs $0x8056a6,%rdx
+  80214e:	00 00 00 
+  802151:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802156:	48 bf c1 56 80 00 00 	movabs $0x8056c1,%rdi
+  80215d:	00 00 00 
+  802160:	b8 00 00 00 00       	mov    $0x0,%eax
+  802165:	48 b9 25 04 80 00 00 	movabs $0x800425,%rcx
+  80216c:	00 00 00 
+  80216f:	ff d1                	call   *%rcx
+
+0000000000802171 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802171:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802178:	ff ff ff 
+  80217b:	48 01 f8             	add    %rdi,%rax
+  80217e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802182:	c3                   	ret
+
+0000000000802183 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802183:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80218a:	ff ff ff 
+  80218d:	48 01 f8             	add    %rdi,%rax
+  802190:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802194:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80219a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80219e:	c3                   	ret
+
+000000000080219f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80219f:	55                   	push   %rbp
+  8021a0:	48 89 e5             	mov    %rsp,%rbp
+  8021a3:	41 57                	push   %r15
+  8021a5:	41 56                	push   %r14
+  8021a7:	41 55                	push   %r13
+  8021a9:	41 54                	push   %r12
+  8021ab:	53                   	push   %rbx
+  8021ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b0:	49 89 ff             	mov    %rdi,%r15
+  8021b3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8021b8:	49 bd 53 40 80 00 00 	movabs $0x804053,%r13
+  8021bf:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8021c2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8021c8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8021cb:	48 89 df             	mov    %rbx,%rdi
+  8021ce:	41 ff d5             	call   *%r13
+  8021d1:	83 e0 04             	and    $0x4,%eax
+  8021d4:	74 17                	je     8021ed <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8021d6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8021dd:	4c 39 f3             	cmp    %r14,%rbx
+  8021e0:	75 e6                	jne    8021c8 <fd_alloc+0x29>
+  8021e2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8021e8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8021ed:	4d 89 27             	mov    %r12,(%r15)
+}
+  8021f0:	48 83 c4 08          	add    $0x8,%rsp
+  8021f4:	5b                   	pop    %rbx
+  8021f5:	41 5c                	pop    %r12
+  8021f7:	41 5d                	pop    %r13
+  8021f9:	41 5e                	pop    %r14
+  8021fb:	41 5f                	pop    %r15
+  8021fd:	5d                   	pop    %rbp
+  8021fe:	c3                   	ret
+
+00000000008021ff <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8021ff:	83 ff 1f             	cmp    $0x1f,%edi
+  802202:	77 39                	ja     80223d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802204:	55                   	push   %rbp
+  802205:	48 89 e5             	mov    %rsp,%rbp
+  802208:	41 54                	push   %r12
+  80220a:	53                   	push   %rbx
+  80220b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80220e:	48 63 df             	movslq %edi,%rbx
+  802211:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802218:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80221c:	48 89 df             	mov    %rbx,%rdi
+  80221f:	48 b8 53 40 80 00 00 	movabs $0x804053,%rax
+  802226:	00 00 00 
+  802229:	ff d0                	call   *%rax
+  80222b:	a8 04                	test   $0x4,%al
+  80222d:	74 14                	je     802243 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80222f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802233:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802238:	5b                   	pop    %rbx
+  802239:	41 5c                	pop    %r12
+  80223b:	5d                   	pop    %rbp
+  80223c:	c3                   	ret
+        return -E_INVAL;
+  80223d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802242:	c3                   	ret
+        return -E_INVAL;
+  802243:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802248:	eb ee                	jmp    802238 <fd_lookup+0x39>
+
+000000000080224a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80224a:	55                   	push   %rbp
+  80224b:	48 89 e5             	mov    %rsp,%rbp
+  80224e:	41 54                	push   %r12
+  802250:	53                   	push   %rbx
+  802251:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802254:	48 b8 60 57 80 00 00 	movabs $0x805760,%rax
+  80225b:	00 00 00 
+  80225e:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802265:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802268:	39 3b                	cmp    %edi,(%rbx)
+  80226a:	74 47                	je     8022b3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80226c:	48 83 c0 08          	add    $0x8,%rax
+  802270:	48 8b 18             	mov    (%rax),%rbx
+  802273:	48 85 db             	test   %rbx,%rbx
+  802276:	75 f0                	jne    802268 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802278:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80227f:	00 00 00 
+  802282:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802288:	89 fa                	mov    %edi,%edx
+  80228a:	48 bf d0 56 80 00 00 	movabs $0x8056d0,%rdi
+  802291:	00 00 00 
+  802294:	b8 00 00 00 00       	mov    $0x0,%eax
+  802299:	48 b9 75 05 80 00 00 	movabs $0x800575,%rcx
+  8022a0:	00 00 00 
+  8022a3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8022a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8022aa:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8022ae:	5b                   	pop    %rbx
+  8022af:	41 5c                	pop    %r12
+  8022b1:	5d                   	pop    %rbp
+  8022b2:	c3                   	ret
+            return 0;
+  8022b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b8:	eb f0                	jmp    8022aa <dev_lookup+0x60>
+
+00000000008022ba <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8022ba:	55                   	push   %rbp
+  8022bb:	48 89 e5             	mov    %rsp,%rbp
+  8022be:	41 55                	push   %r13
+  8022c0:	41 54                	push   %r12
+  8022c2:	53                   	push   %rbx
+  8022c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8022c7:	48 89 fb             	mov    %rdi,%rbx
+  8022ca:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022cd:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8022d4:	ff ff ff 
+  8022d7:	48 01 df             	add    %rbx,%rdi
+  8022da:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8022de:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022e2:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  8022e9:	00 00 00 
+  8022ec:	ff d0                	call   *%rax
+  8022ee:	41 89 c5             	mov    %eax,%r13d
+  8022f1:	85 c0                	test   %eax,%eax
+  8022f3:	78 06                	js     8022fb <fd_close+0x41>
+  8022f5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8022f9:	74 1a                	je     802315 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8022fb:	45 84 e4             	test   %r12b,%r12b
+  8022fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802303:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802307:	44 89 e8             	mov    %r13d,%eax
+  80230a:	48 83 c4 18          	add    $0x18,%rsp
+  80230e:	5b                   	pop    %rbx
+  80230f:	41 5c                	pop    %r12
+  802311:	41 5d                	pop    %r13
+  802313:	5d                   	pop    %rbp
+  802314:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802315:	8b 3b                	mov    (%rbx),%edi
+  802317:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80231b:	48 b8 4a 22 80 00 00 	movabs $0x80224a,%rax
+  802322:	00 00 00 
+  802325:	ff d0                	call   *%rax
+  802327:	41 89 c5             	mov    %eax,%r13d
+  80232a:	85 c0                	test   %eax,%eax
+  80232c:	78 1b                	js     802349 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80232e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802332:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802336:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80233c:	48 85 c0             	test   %rax,%rax
+  80233f:	74 08                	je     802349 <fd_close+0x8f>
+  802341:	48 89 df             	mov    %rbx,%rdi
+  802344:	ff d0                	call   *%rax
+  802346:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802349:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80234e:	48 89 de             	mov    %rbx,%rsi
+  802351:	bf 00 00 00 00       	mov    $0x0,%edi
+  802356:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  80235d:	00 00 00 
+  802360:	ff d0                	call   *%rax
+    return res;
+  802362:	eb a3                	jmp    802307 <fd_close+0x4d>
+
+0000000000802364 <close>:
+
+int
+close(int fdnum) {
+  802364:	55                   	push   %rbp
+  802365:	48 89 e5             	mov    %rsp,%rbp
+  802368:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80236c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802370:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  802377:	00 00 00 
+  80237a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80237c:	85 c0                	test   %eax,%eax
+  80237e:	78 15                	js     802395 <close+0x31>
+
+    return fd_close(fd, 1);
+  802380:	be 01 00 00 00       	mov    $0x1,%esi
+  802385:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802389:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  802390:	00 00 00 
+  802393:	ff d0                	call   *%rax
+}
+  802395:	c9                   	leave
+  802396:	c3                   	ret
+
+0000000000802397 <close_all>:
+
+void
+close_all(void) {
+  802397:	55                   	push   %rbp
+  802398:	48 89 e5             	mov    %rsp,%rbp
+  80239b:	41 54                	push   %r12
+  80239d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80239e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023a3:	49 bc 64 23 80 00 00 	movabs $0x802364,%r12
+  8023aa:	00 00 00 
+  8023ad:	89 df                	mov    %ebx,%edi
+  8023af:	41 ff d4             	call   *%r12
+  8023b2:	83 c3 01             	add    $0x1,%ebx
+  8023b5:	83 fb 20             	cmp    $0x20,%ebx
+  8023b8:	75 f3                	jne    8023ad <close_all+0x16>
+}
+  8023ba:	5b                   	pop    %rbx
+  8023bb:	41 5c                	pop    %r12
+  8023bd:	5d                   	pop    %rbp
+  8023be:	c3                   	ret
+
+00000000008023bf <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8023bf:	55                   	push   %rbp
+  8023c0:	48 89 e5             	mov    %rsp,%rbp
+  8023c3:	41 57                	push   %r15
+  8023c5:	41 56                	push   %r14
+  8023c7:	41 55                	push   %r13
+  8023c9:	41 54                	push   %r12
+  8023cb:	53                   	push   %rbx
+  8023cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d0:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8023d3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8023d7:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  8023de:	00 00 00 
+  8023e1:	ff d0                	call   *%rax
+  8023e3:	89 c3                	mov    %eax,%ebx
+  8023e5:	85 c0                	test   %eax,%eax
+  8023e7:	0f 88 b8 00 00 00    	js     8024a5 <dup+0xe6>
+    close(newfdnum);
+  8023ed:	44 89 e7             	mov    %r12d,%edi
+  8023f0:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  8023f7:	00 00 00 
+  8023fa:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8023fc:	4d 63 ec             	movslq %r12d,%r13
+  8023ff:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802406:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80240a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80240e:	4c 89 ff             	mov    %r15,%rdi
+  802411:	49 be 83 21 80 00 00 	movabs $0x802183,%r14
+  802418:	00 00 00 
+  80241b:	41 ff d6             	call   *%r14
+  80241e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802421:	4c 89 ef             	mov    %r13,%rdi
+  802424:	41 ff d6             	call   *%r14
+  802427:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80242a:	48 89 df             	mov    %rbx,%rdi
+  80242d:	48 b8 53 40 80 00 00 	movabs $0x804053,%rax
+  802434:	00 00 00 
+  802437:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802439:	a8 04                	test   $0x4,%al
+  80243b:	74 2b                	je     802468 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80243d:	41 89 c1             	mov    %eax,%r9d
+  802440:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802446:	4c 89 f1             	mov    %r14,%rcx
+  802449:	ba 00 00 00 00       	mov    $0x0,%edx
+  80244e:	48 89 de             	mov    %rbx,%rsi
+  802451:	bf 00 00 00 00       	mov    $0x0,%edi
+  802456:	48 b8 b4 16 80 00 00 	movabs $0x8016b4,%rax
+  80245d:	00 00 00 
+  802460:	ff d0                	call   *%rax
+  802462:	89 c3                	mov    %eax,%ebx
+  802464:	85 c0                	test   %eax,%eax
+  802466:	78 4e                	js     8024b6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802468:	4c 89 ff             	mov    %r15,%rdi
+  80246b:	48 b8 53 40 80 00 00 	movabs $0x804053,%rax
+  802472:	00 00 00 
+  802475:	ff d0                	call   *%rax
+  802477:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80247a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802480:	4c 89 e9             	mov    %r13,%rcx
+  802483:	ba 00 00 00 00       	mov    $0x0,%edx
+  802488:	4c 89 fe             	mov    %r15,%rsi
+  80248b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802490:	48 b8 b4 16 80 00 00 	movabs $0x8016b4,%rax
+  802497:	00 00 00 
+  80249a:	ff d0                	call   *%rax
+  80249c:	89 c3                	mov    %eax,%ebx
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	78 14                	js     8024b6 <dup+0xf7>
+
+    return newfdnum;
+  8024a2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8024a5:	89 d8                	mov    %ebx,%eax
+  8024a7:	48 83 c4 18          	add    $0x18,%rsp
+  8024ab:	5b                   	pop    %rbx
+  8024ac:	41 5c                	pop    %r12
+  8024ae:	41 5d                	pop    %r13
+  8024b0:	41 5e                	pop    %r14
+  8024b2:	41 5f                	pop    %r15
+  8024b4:	5d                   	pop    %rbp
+  8024b5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8024b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024bb:	4c 89 ee             	mov    %r13,%rsi
+  8024be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024c3:	49 bc 2c 18 80 00 00 	movabs $0x80182c,%r12
+  8024ca:	00 00 00 
+  8024cd:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8024d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024d5:	4c 89 f6             	mov    %r14,%rsi
+  8024d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024dd:	41 ff d4             	call   *%r12
+    return res;
+  8024e0:	eb c3                	jmp    8024a5 <dup+0xe6>
+
+00000000008024e2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8024e2:	55                   	push   %rbp
+  8024e3:	48 89 e5             	mov    %rsp,%rbp
+  8024e6:	41 56                	push   %r14
+  8024e8:	41 55                	push   %r13
+  8024ea:	41 54                	push   %r12
+  8024ec:	53                   	push   %rbx
+  8024ed:	48 83 ec 10          	sub    $0x10,%rsp
+  8024f1:	89 fb                	mov    %edi,%ebx
+  8024f3:	49 89 f4             	mov    %rsi,%r12
+  8024f6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024f9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024fd:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  802504:	00 00 00 
+  802507:	ff d0                	call   *%rax
+  802509:	85 c0                	test   %eax,%eax
+  80250b:	78 4c                	js     802559 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80250d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802511:	41 8b 3e             	mov    (%r14),%edi
+  802514:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802518:	48 b8 4a 22 80 00 00 	movabs $0x80224a,%rax
+  80251f:	00 00 00 
+  802522:	ff d0                	call   *%rax
+  802524:	85 c0                	test   %eax,%eax
+  802526:	78 35                	js     80255d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802528:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80252c:	83 e0 03             	and    $0x3,%eax
+  80252f:	83 f8 01             	cmp    $0x1,%eax
+  802532:	74 2d                	je     802561 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802534:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802538:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80253c:	48 85 c0             	test   %rax,%rax
+  80253f:	74 56                	je     802597 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802541:	4c 89 ea             	mov    %r13,%rdx
+  802544:	4c 89 e6             	mov    %r12,%rsi
+  802547:	4c 89 f7             	mov    %r14,%rdi
+  80254a:	ff d0                	call   *%rax
+}
+  80254c:	48 83 c4 10          	add    $0x10,%rsp
+  802550:	5b                   	pop    %rbx
+  802551:	41 5c                	pop    %r12
+  802553:	41 5d                	pop    %r13
+  802555:	41 5e                	pop    %r14
+  802557:	5d                   	pop    %rbp
+  802558:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802559:	48 98                	cltq
+  80255b:	eb ef                	jmp    80254c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80255d:	48 98                	cltq
+  80255f:	eb eb                	jmp    80254c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802561:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802568:	00 00 00 
+  80256b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802571:	89 da                	mov    %ebx,%edx
+  802573:	48 bf 11 57 80 00 00 	movabs $0x805711,%rdi
+  80257a:	00 00 00 
+  80257d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802582:	48 b9 75 05 80 00 00 	movabs $0x800575,%rcx
+  802589:	00 00 00 
+  80258c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80258e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802595:	eb b5                	jmp    80254c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802597:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80259e:	eb ac                	jmp    80254c <read+0x6a>
+
+00000000008025a0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8025a0:	55                   	push   %rbp
+  8025a1:	48 89 e5             	mov    %rsp,%rbp
+  8025a4:	41 57                	push   %r15
+  8025a6:	41 56                	push   %r14
+  8025a8:	41 55                	push   %r13
+  8025aa:	41 54                	push   %r12
+  8025ac:	53                   	push   %rbx
+  8025ad:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8025b1:	48 85 d2             	test   %rdx,%rdx
+  8025b4:	74 54                	je     80260a <readn+0x6a>
+  8025b6:	41 89 fd             	mov    %edi,%r13d
+  8025b9:	49 89 f6             	mov    %rsi,%r14
+  8025bc:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8025bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8025c4:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8025c9:	49 bf e2 24 80 00 00 	movabs $0x8024e2,%r15
+  8025d0:	00 00 00 
+  8025d3:	4c 89 e2             	mov    %r12,%rdx
+  8025d6:	48 29 f2             	sub    %rsi,%rdx
+  8025d9:	4c 01 f6             	add    %r14,%rsi
+  8025dc:	44 89 ef             	mov    %r13d,%edi
+  8025df:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	78 20                	js     802606 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8025e6:	01 c3                	add    %eax,%ebx
+  8025e8:	85 c0                	test   %eax,%eax
+  8025ea:	74 08                	je     8025f4 <readn+0x54>
+  8025ec:	48 63 f3             	movslq %ebx,%rsi
+  8025ef:	4c 39 e6             	cmp    %r12,%rsi
+  8025f2:	72 df                	jb     8025d3 <readn+0x33>
+    }
+    return res;
+  8025f4:	48 63 c3             	movslq %ebx,%rax
+}
+  8025f7:	48 83 c4 08          	add    $0x8,%rsp
+  8025fb:	5b                   	pop    %rbx
+  8025fc:	41 5c                	pop    %r12
+  8025fe:	41 5d                	pop    %r13
+  802600:	41 5e                	pop    %r14
+  802602:	41 5f                	pop    %r15
+  802604:	5d                   	pop    %rbp
+  802605:	c3                   	ret
+        if (inc < 0) return inc;
+  802606:	48 98                	cltq
+  802608:	eb ed                	jmp    8025f7 <readn+0x57>
+    int inc = 1, res = 0;
+  80260a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80260f:	eb e3                	jmp    8025f4 <readn+0x54>
+
+0000000000802611 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802611:	55                   	push   %rbp
+  802612:	48 89 e5             	mov    %rsp,%rbp
+  802615:	41 56                	push   %r14
+  802617:	41 55                	push   %r13
+  802619:	41 54                	push   %r12
+  80261b:	53                   	push   %rbx
+  80261c:	48 83 ec 10          	sub    $0x10,%rsp
+  802620:	89 fb                	mov    %edi,%ebx
+  802622:	49 89 f4             	mov    %rsi,%r12
+  802625:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802628:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80262c:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  802633:	00 00 00 
+  802636:	ff d0                	call   *%rax
+  802638:	85 c0                	test   %eax,%eax
+  80263a:	78 47                	js     802683 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80263c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802640:	41 8b 3e             	mov    (%r14),%edi
+  802643:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802647:	48 b8 4a 22 80 00 00 	movabs $0x80224a,%rax
+  80264e:	00 00 00 
+  802651:	ff d0                	call   *%rax
+  802653:	85 c0                	test   %eax,%eax
+  802655:	78 30                	js     802687 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802657:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80265c:	74 2d                	je     80268b <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80265e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802662:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802666:	48 85 c0             	test   %rax,%rax
+  802669:	74 56                	je     8026c1 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80266b:	4c 89 ea             	mov    %r13,%rdx
+  80266e:	4c 89 e6             	mov    %r12,%rsi
+  802671:	4c 89 f7             	mov    %r14,%rdi
+  802674:	ff d0                	call   *%rax
+}
+  802676:	48 83 c4 10          	add    $0x10,%rsp
+  80267a:	5b                   	pop    %rbx
+  80267b:	41 5c                	pop    %r12
+  80267d:	41 5d                	pop    %r13
+  80267f:	41 5e                	pop    %r14
+  802681:	5d                   	pop    %rbp
+  802682:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802683:	48 98                	cltq
+  802685:	eb ef                	jmp    802676 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802687:	48 98                	cltq
+  802689:	eb eb                	jmp    802676 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80268b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802692:	00 00 00 
+  802695:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80269b:	89 da                	mov    %ebx,%edx
+  80269d:	48 bf 2d 57 80 00 00 	movabs $0x80572d,%rdi
+  8026a4:	00 00 00 
+  8026a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ac:	48 b9 75 05 80 00 00 	movabs $0x800575,%rcx
+  8026b3:	00 00 00 
+  8026b6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8026b8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026bf:	eb b5                	jmp    802676 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8026c1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8026c8:	eb ac                	jmp    802676 <write+0x65>
+
+00000000008026ca <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8026ca:	55                   	push   %rbp
+  8026cb:	48 89 e5             	mov    %rsp,%rbp
+  8026ce:	53                   	push   %rbx
+  8026cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8026d3:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026d5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026d9:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  8026e0:	00 00 00 
+  8026e3:	ff d0                	call   *%rax
+  8026e5:	85 c0                	test   %eax,%eax
+  8026e7:	78 0c                	js     8026f5 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8026e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026ed:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8026f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026f9:	c9                   	leave
+  8026fa:	c3                   	ret
+
+00000000008026fb <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8026fb:	55                   	push   %rbp
+  8026fc:	48 89 e5             	mov    %rsp,%rbp
+  8026ff:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802703:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802707:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  80270e:	00 00 00 
+  802711:	ff d0                	call   *%rax
+  802713:	85 c0                	test   %eax,%eax
+  802715:	78 07                	js     80271e <tell+0x23>
+    return fdes->fd_offset;
+  802717:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80271b:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80271e:	c9                   	leave
+  80271f:	c3                   	ret
+
+0000000000802720 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802720:	55                   	push   %rbp
+  802721:	48 89 e5             	mov    %rsp,%rbp
+  802724:	41 55                	push   %r13
+  802726:	41 54                	push   %r12
+  802728:	53                   	push   %rbx
+  802729:	48 83 ec 18          	sub    $0x18,%rsp
+  80272d:	89 fb                	mov    %edi,%ebx
+  80272f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802732:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802736:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  80273d:	00 00 00 
+  802740:	ff d0                	call   *%rax
+  802742:	85 c0                	test   %eax,%eax
+  802744:	78 38                	js     80277e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802746:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80274a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80274e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802752:	48 b8 4a 22 80 00 00 	movabs $0x80224a,%rax
+  802759:	00 00 00 
+  80275c:	ff d0                	call   *%rax
+  80275e:	85 c0                	test   %eax,%eax
+  802760:	78 1c                	js     80277e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802762:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802767:	74 20                	je     802789 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802769:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80276d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802771:	48 85 c0             	test   %rax,%rax
+  802774:	74 47                	je     8027bd <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802776:	44 89 e6             	mov    %r12d,%esi
+  802779:	4c 89 ef             	mov    %r13,%rdi
+  80277c:	ff d0                	call   *%rax
+}
+  80277e:	48 83 c4 18          	add    $0x18,%rsp
+  802782:	5b                   	pop    %rbx
+  802783:	41 5c                	pop    %r12
+  802785:	41 5d                	pop    %r13
+  802787:	5d                   	pop    %rbp
+  802788:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802789:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802790:	00 00 00 
+  802793:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802799:	89 da                	mov    %ebx,%edx
+  80279b:	48 bf f0 56 80 00 00 	movabs $0x8056f0,%rdi
+  8027a2:	00 00 00 
+  8027a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027aa:	48 b9 75 05 80 00 00 	movabs $0x800575,%rcx
+  8027b1:	00 00 00 
+  8027b4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8027b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027bb:	eb c1                	jmp    80277e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8027bd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027c2:	eb ba                	jmp    80277e <ftruncate+0x5e>
+
+00000000008027c4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8027c4:	55                   	push   %rbp
+  8027c5:	48 89 e5             	mov    %rsp,%rbp
+  8027c8:	41 54                	push   %r12
+  8027ca:	53                   	push   %rbx
+  8027cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8027cf:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027d2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027d6:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+  8027e2:	85 c0                	test   %eax,%eax
+  8027e4:	78 4e                	js     802834 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027e6:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8027ea:	41 8b 3c 24          	mov    (%r12),%edi
+  8027ee:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8027f2:	48 b8 4a 22 80 00 00 	movabs $0x80224a,%rax
+  8027f9:	00 00 00 
+  8027fc:	ff d0                	call   *%rax
+  8027fe:	85 c0                	test   %eax,%eax
+  802800:	78 32                	js     802834 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802802:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802806:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80280b:	74 30                	je     80283d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80280d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802810:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802817:	00 00 00 
+    stat->st_isdir = 0;
+  80281a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802821:	00 00 00 
+    stat->st_dev = dev;
+  802824:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80282b:	48 89 de             	mov    %rbx,%rsi
+  80282e:	4c 89 e7             	mov    %r12,%rdi
+  802831:	ff 50 28             	call   *0x28(%rax)
+}
+  802834:	48 83 c4 10          	add    $0x10,%rsp
+  802838:	5b                   	pop    %rbx
+  802839:	41 5c                	pop    %r12
+  80283b:	5d                   	pop    %rbp
+  80283c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80283d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802842:	eb f0                	jmp    802834 <fstat+0x70>
+
+0000000000802844 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802844:	55                   	push   %rbp
+  802845:	48 89 e5             	mov    %rsp,%rbp
+  802848:	41 54                	push   %r12
+  80284a:	53                   	push   %rbx
+  80284b:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802852:	41 89 fc             	mov    %edi,%r12d
+  802855:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802857:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80285b:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  802862:	00 00 00 
+  802865:	ff d0                	call   *%rax
+  802867:	85 c0                	test   %eax,%eax
+  802869:	78 31                	js     80289c <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  80286b:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802872:	44 89 e7             	mov    %r12d,%edi
+  802875:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  80287c:	00 00 00 
+  80287f:	ff d0                	call   *%rax
+  802881:	85 c0                	test   %eax,%eax
+  802883:	78 17                	js     80289c <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802885:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802889:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  80288c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80288f:	39 d3                	cmp    %edx,%ebx
+  802891:	0f 4f da             	cmovg  %edx,%ebx
+  802894:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802897:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80289c:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8028a3:	5b                   	pop    %rbx
+  8028a4:	41 5c                	pop    %r12
+  8028a6:	5d                   	pop    %rbp
+  8028a7:	c3                   	ret
+
+00000000008028a8 <seektoend>:
+{
+  8028a8:	55                   	push   %rbp
+  8028a9:	48 89 e5             	mov    %rsp,%rbp
+  8028ac:	53                   	push   %rbx
+  8028ad:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8028b4:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8028b6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028ba:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  8028c1:	00 00 00 
+  8028c4:	ff d0                	call   *%rax
+  8028c6:	85 c0                	test   %eax,%eax
+  8028c8:	78 28                	js     8028f2 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8028ca:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8028d1:	89 df                	mov    %ebx,%edi
+  8028d3:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  8028da:	00 00 00 
+  8028dd:	ff d0                	call   *%rax
+  8028df:	85 c0                	test   %eax,%eax
+  8028e1:	78 0f                	js     8028f2 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8028e3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8028e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028ea:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8028ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028f6:	c9                   	leave
+  8028f7:	c3                   	ret
+
+00000000008028f8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8028f8:	55                   	push   %rbp
+  8028f9:	48 89 e5             	mov    %rsp,%rbp
+  8028fc:	41 54                	push   %r12
+  8028fe:	53                   	push   %rbx
+  8028ff:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802902:	be 00 00 00 00       	mov    $0x0,%esi
+  802907:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  80290e:	00 00 00 
+  802911:	ff d0                	call   *%rax
+  802913:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802915:	85 c0                	test   %eax,%eax
+  802917:	78 25                	js     80293e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802919:	4c 89 e6             	mov    %r12,%rsi
+  80291c:	89 c7                	mov    %eax,%edi
+  80291e:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  802925:	00 00 00 
+  802928:	ff d0                	call   *%rax
+  80292a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80292d:	89 df                	mov    %ebx,%edi
+  80292f:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  802936:	00 00 00 
+  802939:	ff d0                	call   *%rax
+
+    return res;
+  80293b:	44 89 e3             	mov    %r12d,%ebx
+}
+  80293e:	89 d8                	mov    %ebx,%eax
+  802940:	5b                   	pop    %rbx
+  802941:	41 5c                	pop    %r12
+  802943:	5d                   	pop    %rbp
+  802944:	c3                   	ret
+
+0000000000802945 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802945:	55                   	push   %rbp
+  802946:	48 89 e5             	mov    %rsp,%rbp
+  802949:	53                   	push   %rbx
+  80294a:	48 83 ec 08          	sub    $0x8,%rsp
+  80294e:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802951:	48 b8 71 21 80 00 00 	movabs $0x802171,%rax
+  802958:	00 00 00 
+  80295b:	ff d0                	call   *%rax
+  80295d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802961:	0f 87 ea 00 00 00    	ja     802a51 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802967:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80296e:	00 00 00 
+  802971:	80 38 00             	cmpb   $0x0,(%rax)
+  802974:	75 35                	jne    8029ab <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802976:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80297b:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802980:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802985:	bf 00 00 00 00       	mov    $0x0,%edi
+  80298a:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+  802996:	85 c0                	test   %eax,%eax
+  802998:	0f 88 ba 00 00 00    	js     802a58 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80299e:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8029a5:	00 00 00 
+  8029a8:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8029ab:	48 89 df             	mov    %rbx,%rdi
+  8029ae:	48 b8 71 21 80 00 00 	movabs $0x802171,%rax
+  8029b5:	00 00 00 
+  8029b8:	ff d0                	call   *%rax
+  8029ba:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8029be:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8029c5:	00 00 00 
+  8029c8:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8029cc:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8029cf:	39 39                	cmp    %edi,(%rcx)
+  8029d1:	74 46                	je     802a19 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8029d3:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8029d7:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8029de:	00 
+  8029df:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8029e6:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8029ed:	00 
+  8029ee:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8029f5:	00 
+  8029f6:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8029fd:	00 
+  8029fe:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802a05:	00 
+  802a06:	89 39                	mov    %edi,(%rcx)
+  802a08:	48 01 c6             	add    %rax,%rsi
+  802a0b:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802a10:	48 89 c8             	mov    %rcx,%rax
+  802a13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a17:	c9                   	leave
+  802a18:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802a19:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802a1d:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802a24:	00 00 00 
+  802a27:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802a2a:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802a2e:	74 e0                	je     802a10 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802a30:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802a37:	00 
+  802a38:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802a3c:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802a43:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802a45:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802a48:	48 01 c2             	add    %rax,%rdx
+  802a4b:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802a4f:	eb bf                	jmp    802a10 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802a51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a56:	eb b8                	jmp    802a10 <fbuf_get+0xcb>
+            return NULL;
+  802a58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a5d:	eb b1                	jmp    802a10 <fbuf_get+0xcb>
+
+0000000000802a5f <fsipc_bulk>:
+fsipc_bulk(void) {
+  802a5f:	55                   	push   %rbp
+  802a60:	48 89 e5             	mov    %rsp,%rbp
+  802a63:	53                   	push   %rbx
+  802a64:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802a68:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a6f:	00 00 00 
+  802a72:	48 8b 18             	mov    (%rax),%rbx
+  802a75:	48 85 db             	test   %rbx,%rbx
+  802a78:	74 16                	je     802a90 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802a7a:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a81:	00 00 00 
+  802a84:	48 8b 18             	mov    (%rax),%rbx
+}
+  802a87:	48 89 d8             	mov    %rbx,%rax
+  802a8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a8e:	c9                   	leave
+  802a8f:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802a90:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a95:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802a9a:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802a9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aa4:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+  802ab0:	85 c0                	test   %eax,%eax
+  802ab2:	78 d3                	js     802a87 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802ab4:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802ab9:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802ac0:	00 00 00 
+  802ac3:	eb b5                	jmp    802a7a <fsipc_bulk+0x1b>
+
+0000000000802ac5 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802ac5:	55                   	push   %rbp
+  802ac6:	48 89 e5             	mov    %rsp,%rbp
+  802ac9:	41 57                	push   %r15
+  802acb:	41 56                	push   %r14
+  802acd:	41 55                	push   %r13
+  802acf:	41 54                	push   %r12
+  802ad1:	53                   	push   %rbx
+  802ad2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ad6:	41 89 fd             	mov    %edi,%r13d
+  802ad9:	49 89 f6             	mov    %rsi,%r14
+  802adc:	49 89 d7             	mov    %rdx,%r15
+  802adf:	48 89 cb             	mov    %rcx,%rbx
+  802ae2:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ae5:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802aec:	00 00 00 
+  802aef:	83 38 00             	cmpl   $0x0,(%rax)
+  802af2:	74 52                	je     802b46 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802af4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802afa:	4c 89 f9             	mov    %r15,%rcx
+  802afd:	4c 89 f2             	mov    %r14,%rdx
+  802b00:	44 89 ee             	mov    %r13d,%esi
+  802b03:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802b0a:	00 00 00 
+  802b0d:	8b 38                	mov    (%rax),%edi
+  802b0f:	48 b8 aa 45 80 00 00 	movabs $0x8045aa,%rax
+  802b16:	00 00 00 
+  802b19:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802b1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b20:	4c 89 e2             	mov    %r12,%rdx
+  802b23:	48 89 de             	mov    %rbx,%rsi
+  802b26:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b2b:	48 b8 fa 43 80 00 00 	movabs $0x8043fa,%rax
+  802b32:	00 00 00 
+  802b35:	ff d0                	call   *%rax
+}
+  802b37:	48 83 c4 08          	add    $0x8,%rsp
+  802b3b:	5b                   	pop    %rbx
+  802b3c:	41 5c                	pop    %r12
+  802b3e:	41 5d                	pop    %r13
+  802b40:	41 5e                	pop    %r14
+  802b42:	41 5f                	pop    %r15
+  802b44:	5d                   	pop    %rbp
+  802b45:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b46:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b4b:	48 b8 4d 46 80 00 00 	movabs $0x80464d,%rax
+  802b52:	00 00 00 
+  802b55:	ff d0                	call   *%rax
+  802b57:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802b5e:	00 00 
+  802b60:	eb 92                	jmp    802af4 <fsipc_region+0x2f>
+
+0000000000802b62 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802b62:	55                   	push   %rbp
+  802b63:	48 89 e5             	mov    %rsp,%rbp
+  802b66:	41 57                	push   %r15
+  802b68:	41 56                	push   %r14
+  802b6a:	41 55                	push   %r13
+  802b6c:	41 54                	push   %r12
+  802b6e:	53                   	push   %rbx
+  802b6f:	48 83 ec 28          	sub    $0x28,%rsp
+  802b73:	49 89 ff             	mov    %rdi,%r15
+  802b76:	49 89 f6             	mov    %rsi,%r14
+  802b79:	48 89 d3             	mov    %rdx,%rbx
+  802b7c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802b80:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802b83:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  802b8a:	00 00 00 
+  802b8d:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802b8f:	48 85 c0             	test   %rax,%rax
+  802b92:	0f 84 cc 00 00 00    	je     802c64 <devfile_write_direct+0x102>
+  802b98:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802b9b:	48 85 db             	test   %rbx,%rbx
+  802b9e:	0f 84 ba 00 00 00    	je     802c5e <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802ba4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802baa:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802bb1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802bb5:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802bb9:	4c 29 e3             	sub    %r12,%rbx
+  802bbc:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802bc1:	48 39 c3             	cmp    %rax,%rbx
+  802bc4:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802bc8:	48 89 da             	mov    %rbx,%rdx
+  802bcb:	4c 89 f6             	mov    %r14,%rsi
+  802bce:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802bd2:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  802bd9:	00 00 00 
+  802bdc:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802bde:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802be2:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802be6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802be9:	44 01 e0             	add    %r12d,%eax
+  802bec:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802bf0:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802bf4:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802bfb:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802c02:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802c09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c14:	4c 89 ee             	mov    %r13,%rsi
+  802c17:	bf 04 00 00 00       	mov    $0x4,%edi
+  802c1c:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  802c23:	00 00 00 
+  802c26:	ff d0                	call   *%rax
+        if (res < 0)
+  802c28:	85 c0                	test   %eax,%eax
+  802c2a:	78 29                	js     802c55 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802c2c:	74 2b                	je     802c59 <devfile_write_direct+0xf7>
+        i += res;
+  802c2e:	48 98                	cltq
+  802c30:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802c33:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802c36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c3a:	49 39 c4             	cmp    %rax,%r12
+  802c3d:	0f 82 72 ff ff ff    	jb     802bb5 <devfile_write_direct+0x53>
+    return i;
+  802c43:	4c 89 e0             	mov    %r12,%rax
+}
+  802c46:	48 83 c4 28          	add    $0x28,%rsp
+  802c4a:	5b                   	pop    %rbx
+  802c4b:	41 5c                	pop    %r12
+  802c4d:	41 5d                	pop    %r13
+  802c4f:	41 5e                	pop    %r14
+  802c51:	41 5f                	pop    %r15
+  802c53:	5d                   	pop    %rbp
+  802c54:	c3                   	ret
+            return res;
+  802c55:	48 98                	cltq
+  802c57:	eb ed                	jmp    802c46 <devfile_write_direct+0xe4>
+            return i;
+  802c59:	4c 89 e0             	mov    %r12,%rax
+  802c5c:	eb e8                	jmp    802c46 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802c5e:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802c62:	eb df                	jmp    802c43 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802c64:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802c6b:	eb d9                	jmp    802c46 <devfile_write_direct+0xe4>
+
+0000000000802c6d <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802c6d:	55                   	push   %rbp
+  802c6e:	48 89 e5             	mov    %rsp,%rbp
+  802c71:	41 56                	push   %r14
+  802c73:	41 55                	push   %r13
+  802c75:	41 54                	push   %r12
+  802c77:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802c78:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802c7c:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c85:	4d 39 ee             	cmp    %r13,%r14
+  802c88:	0f 84 99 00 00 00    	je     802d27 <fbuf_flush+0xba>
+  802c8e:	49 89 fc             	mov    %rdi,%r12
+  802c91:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802c94:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c97:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c9b:	48 b8 71 21 80 00 00 	movabs $0x802171,%rax
+  802ca2:	00 00 00 
+  802ca5:	ff d0                	call   *%rax
+  802ca7:	48 89 c2             	mov    %rax,%rdx
+  802caa:	48 c1 e2 04          	shl    $0x4,%rdx
+  802cae:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802cb2:	48 c1 e0 0c          	shl    $0xc,%rax
+  802cb6:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802cbb:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802cbe:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802cc2:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802cc9:	00 
+  802cca:	44 89 f1             	mov    %r14d,%ecx
+  802ccd:	4c 89 ea             	mov    %r13,%rdx
+  802cd0:	4c 89 e7             	mov    %r12,%rdi
+  802cd3:	48 b8 62 2b 80 00 00 	movabs $0x802b62,%rax
+  802cda:	00 00 00 
+  802cdd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cdf:	48 85 c0             	test   %rax,%rax
+  802ce2:	78 43                	js     802d27 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802ce4:	4c 39 e8             	cmp    %r13,%rax
+  802ce7:	72 47                	jb     802d30 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802ce9:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802cee:	83 c0 01             	add    $0x1,%eax
+  802cf1:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802cf6:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802cf9:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802cfd:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802d01:	72 0f                	jb     802d12 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802d03:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802d07:	48 39 c2             	cmp    %rax,%rdx
+  802d0a:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802d0e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802d12:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802d19:	00 
+  802d1a:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802d21:	00 
+    return 0;
+  802d22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d27:	5b                   	pop    %rbx
+  802d28:	41 5c                	pop    %r12
+  802d2a:	41 5d                	pop    %r13
+  802d2c:	41 5e                	pop    %r14
+  802d2e:	5d                   	pop    %rbp
+  802d2f:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802d30:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802d35:	eb f0                	jmp    802d27 <fbuf_flush+0xba>
+
+0000000000802d37 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802d37:	55                   	push   %rbp
+  802d38:	48 89 e5             	mov    %rsp,%rbp
+  802d3b:	53                   	push   %rbx
+  802d3c:	48 83 ec 08          	sub    $0x8,%rsp
+  802d40:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802d43:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  802d4a:	00 00 00 
+  802d4d:	ff d0                	call   *%rax
+  802d4f:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d57:	48 85 f6             	test   %rsi,%rsi
+  802d5a:	74 0f                	je     802d6b <devfile_sync+0x34>
+  802d5c:	48 89 df             	mov    %rbx,%rdi
+  802d5f:	48 b8 6d 2c 80 00 00 	movabs $0x802c6d,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+}
+  802d6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d6f:	c9                   	leave
+  802d70:	c3                   	ret
+
+0000000000802d71 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802d71:	55                   	push   %rbp
+  802d72:	48 89 e5             	mov    %rsp,%rbp
+  802d75:	48 83 ec 10          	sub    $0x10,%rsp
+  802d79:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802d7c:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802d83:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802d84:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802d88:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d8d:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802d94:	00 00 00 
+  802d97:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  802d9e:	00 00 00 
+  802da1:	ff d0                	call   *%rax
+}
+  802da3:	c9                   	leave
+  802da4:	c3                   	ret
+
+0000000000802da5 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802da5:	55                   	push   %rbp
+  802da6:	48 89 e5             	mov    %rsp,%rbp
+  802da9:	41 54                	push   %r12
+  802dab:	53                   	push   %rbx
+  802dac:	48 89 fb             	mov    %rdi,%rbx
+  802daf:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802db2:	48 b8 37 2d 80 00 00 	movabs $0x802d37,%rax
+  802db9:	00 00 00 
+  802dbc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802dbe:	85 c0                	test   %eax,%eax
+  802dc0:	78 63                	js     802e25 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802dc2:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802dc5:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802dcc:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802dce:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd3:	bf 05 00 00 00       	mov    $0x5,%edi
+  802dd8:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  802ddf:	00 00 00 
+  802de2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802de4:	85 c0                	test   %eax,%eax
+  802de6:	78 3d                	js     802e25 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802de8:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802def:	00 00 00 
+  802df2:	48 89 de             	mov    %rbx,%rsi
+  802df5:	4c 89 e7             	mov    %r12,%rdi
+  802df8:	48 b8 ed 0e 80 00 00 	movabs $0x800eed,%rax
+  802dff:	00 00 00 
+  802e02:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802e04:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802e0a:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802e11:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802e12:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802e18:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802e1f:	00 
+
+    return 0;
+  802e20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e25:	5b                   	pop    %rbx
+  802e26:	41 5c                	pop    %r12
+  802e28:	5d                   	pop    %rbp
+  802e29:	c3                   	ret
+
+0000000000802e2a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802e2a:	55                   	push   %rbp
+  802e2b:	48 89 e5             	mov    %rsp,%rbp
+  802e2e:	41 54                	push   %r12
+  802e30:	53                   	push   %rbx
+  802e31:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802e34:	48 b8 37 2d 80 00 00 	movabs $0x802d37,%rax
+  802e3b:	00 00 00 
+  802e3e:	ff d0                	call   *%rax
+  802e40:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802e43:	48 89 df             	mov    %rbx,%rdi
+  802e46:	48 b8 71 21 80 00 00 	movabs $0x802171,%rax
+  802e4d:	00 00 00 
+  802e50:	ff d0                	call   *%rax
+  802e52:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802e56:	76 2e                	jbe    802e86 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802e58:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e5b:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802e62:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802e64:	be 00 00 00 00       	mov    $0x0,%esi
+  802e69:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802e6e:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  802e75:	00 00 00 
+  802e78:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802e7a:	45 85 e4             	test   %r12d,%r12d
+  802e7d:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802e81:	5b                   	pop    %rbx
+  802e82:	41 5c                	pop    %r12
+  802e84:	5d                   	pop    %rbp
+  802e85:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802e86:	48 89 df             	mov    %rbx,%rdi
+  802e89:	48 b8 71 21 80 00 00 	movabs $0x802171,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+  802e95:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802e99:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802ea0:	00 00 00 
+  802ea3:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802eaa:	48 89 df             	mov    %rbx,%rdi
+  802ead:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+  802eb9:	48 89 c6             	mov    %rax,%rsi
+  802ebc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ec1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec6:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  802ecd:	00 00 00 
+  802ed0:	ff d0                	call   *%rax
+  802ed2:	eb 84                	jmp    802e58 <devfile_flush+0x2e>
+
+0000000000802ed4 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802ed4:	55                   	push   %rbp
+  802ed5:	48 89 e5             	mov    %rsp,%rbp
+  802ed8:	41 55                	push   %r13
+  802eda:	41 54                	push   %r12
+  802edc:	53                   	push   %rbx
+  802edd:	48 83 ec 08          	sub    $0x8,%rsp
+  802ee1:	48 89 fb             	mov    %rdi,%rbx
+  802ee4:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802ee7:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  802eee:	00 00 00 
+  802ef1:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ef3:	48 85 c0             	test   %rax,%rax
+  802ef6:	74 51                	je     802f49 <devfile_trunc+0x75>
+  802ef8:	49 89 c4             	mov    %rax,%r12
+  802efb:	48 89 c6             	mov    %rax,%rsi
+  802efe:	48 89 df             	mov    %rbx,%rdi
+  802f01:	48 b8 6d 2c 80 00 00 	movabs $0x802c6d,%rax
+  802f08:	00 00 00 
+  802f0b:	ff d0                	call   *%rax
+  802f0d:	85 c0                	test   %eax,%eax
+  802f0f:	78 2d                	js     802f3e <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f11:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802f18:	00 00 00 
+  802f1b:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f1e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802f20:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802f24:	be 00 00 00 00       	mov    $0x0,%esi
+  802f29:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f2e:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  802f35:	00 00 00 
+  802f38:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802f3a:	85 c0                	test   %eax,%eax
+  802f3c:	79 3e                	jns    802f7c <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802f3e:	48 83 c4 08          	add    $0x8,%rsp
+  802f42:	5b                   	pop    %rbx
+  802f43:	41 5c                	pop    %r12
+  802f45:	41 5d                	pop    %r13
+  802f47:	5d                   	pop    %rbp
+  802f48:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f49:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802f50:	00 00 00 
+  802f53:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f56:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802f58:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802f5c:	be 00 00 00 00       	mov    $0x0,%esi
+  802f61:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f66:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  802f6d:	00 00 00 
+  802f70:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802f72:	85 c0                	test   %eax,%eax
+  802f74:	78 c8                	js     802f3e <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f76:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f7a:	eb c2                	jmp    802f3e <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f7c:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802f7f:	8d 51 01             	lea    0x1(%rcx),%edx
+  802f82:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f85:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802f8a:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f91:	00 00 
+  802f93:	eb a9                	jmp    802f3e <devfile_trunc+0x6a>
+
+0000000000802f95 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802f95:	55                   	push   %rbp
+  802f96:	48 89 e5             	mov    %rsp,%rbp
+  802f99:	41 57                	push   %r15
+  802f9b:	41 56                	push   %r14
+  802f9d:	41 55                	push   %r13
+  802f9f:	41 54                	push   %r12
+  802fa1:	53                   	push   %rbx
+  802fa2:	48 83 ec 28          	sub    $0x28,%rsp
+  802fa6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802faa:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802fae:	49 89 d7             	mov    %rdx,%r15
+  802fb1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802fb5:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  802fbc:	00 00 00 
+  802fbf:	ff d0                	call   *%rax
+  802fc1:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802fc4:	48 85 c0             	test   %rax,%rax
+  802fc7:	74 31                	je     802ffa <devfile_write+0x65>
+  802fc9:	4c 89 f8             	mov    %r15,%rax
+  802fcc:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802fd3:	77 25                	ja     802ffa <devfile_write+0x65>
+    size_t i = 0;
+  802fd5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802fdb:	48 85 c0             	test   %rax,%rax
+  802fde:	0f 85 64 01 00 00    	jne    803148 <devfile_write+0x1b3>
+    size_t i = 0;
+  802fe4:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802fe8:	4c 89 f8             	mov    %r15,%rax
+}
+  802feb:	48 83 c4 28          	add    $0x28,%rsp
+  802fef:	5b                   	pop    %rbx
+  802ff0:	41 5c                	pop    %r12
+  802ff2:	41 5d                	pop    %r13
+  802ff4:	41 5e                	pop    %r14
+  802ff6:	41 5f                	pop    %r15
+  802ff8:	5d                   	pop    %rbp
+  802ff9:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ffa:	48 85 db             	test   %rbx,%rbx
+  802ffd:	74 5b                	je     80305a <devfile_write+0xc5>
+  802fff:	48 89 de             	mov    %rbx,%rsi
+  803002:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803006:	48 b8 6d 2c 80 00 00 	movabs $0x802c6d,%rax
+  80300d:	00 00 00 
+  803010:	ff d0                	call   *%rax
+  803012:	85 c0                	test   %eax,%eax
+  803014:	78 40                	js     803056 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803016:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80301a:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  80301d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803021:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803025:	48 b8 62 2b 80 00 00 	movabs $0x802b62,%rax
+  80302c:	00 00 00 
+  80302f:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803031:	48 85 c0             	test   %rax,%rax
+  803034:	7e b5                	jle    802feb <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803036:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80303a:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  80303d:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  803040:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803043:	8d 51 01             	lea    0x1(%rcx),%edx
+  803046:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803049:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  80304c:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803053:	00 
+  803054:	eb 95                	jmp    802feb <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803056:	48 98                	cltq
+  803058:	eb 91                	jmp    802feb <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80305a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80305e:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  803061:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803065:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803069:	48 89 df             	mov    %rbx,%rdi
+  80306c:	48 b8 62 2b 80 00 00 	movabs $0x802b62,%rax
+  803073:	00 00 00 
+  803076:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803078:	48 85 c0             	test   %rax,%rax
+  80307b:	0f 8e 6a ff ff ff    	jle    802feb <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803081:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803084:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803088:	e9 5e ff ff ff       	jmp    802feb <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80308d:	48 98                	cltq
+  80308f:	4d 85 ff             	test   %r15,%r15
+  803092:	49 0f 45 c7          	cmovne %r15,%rax
+  803096:	e9 50 ff ff ff       	jmp    802feb <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80309b:	48 89 de             	mov    %rbx,%rsi
+  80309e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030a2:	48 b8 6d 2c 80 00 00 	movabs $0x802c6d,%rax
+  8030a9:	00 00 00 
+  8030ac:	ff d0                	call   *%rax
+  8030ae:	85 c0                	test   %eax,%eax
+  8030b0:	0f 88 2b 01 00 00    	js     8031e1 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8030b6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8030ba:	4c 01 f8             	add    %r15,%rax
+  8030bd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8030c1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030c5:	48 b9 71 21 80 00 00 	movabs $0x802171,%rcx
+  8030cc:	00 00 00 
+  8030cf:	ff d1                	call   *%rcx
+  8030d1:	48 89 c2             	mov    %rax,%rdx
+  8030d4:	48 c1 e2 04          	shl    $0x4,%rdx
+  8030d8:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8030dc:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030e0:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  8030e5:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8030e8:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8030ef:	00 
+  8030f0:	4c 89 ea             	mov    %r13,%rdx
+  8030f3:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8030f7:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  8030fe:	00 00 00 
+  803101:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803103:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803107:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80310b:	48 39 c2             	cmp    %rax,%rdx
+  80310e:	0f 84 db 00 00 00    	je     8031ef <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803114:	4c 39 e2             	cmp    %r12,%rdx
+  803117:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  80311b:	4d 01 ec             	add    %r13,%r12
+  80311e:	49 39 c4             	cmp    %rax,%r12
+  803121:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803125:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803129:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  80312d:	45 01 ee             	add    %r13d,%r14d
+  803130:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803134:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803138:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  80313b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80313f:	49 39 c7             	cmp    %rax,%r15
+  803142:	0f 83 a0 fe ff ff    	jae    802fe8 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803148:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80314c:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  803150:	8b 43 08             	mov    0x8(%rbx),%eax
+  803153:	44 39 f0             	cmp    %r14d,%eax
+  803156:	7f 10                	jg     803168 <devfile_write+0x1d3>
+  803158:	48 98                	cltq
+  80315a:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  803160:	49 63 d6             	movslq %r14d,%rdx
+  803163:	48 39 d0             	cmp    %rdx,%rax
+  803166:	7d 2d                	jge    803195 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803168:	48 89 de             	mov    %rbx,%rsi
+  80316b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80316f:	48 b8 6d 2c 80 00 00 	movabs $0x802c6d,%rax
+  803176:	00 00 00 
+  803179:	ff d0                	call   *%rax
+  80317b:	85 c0                	test   %eax,%eax
+  80317d:	0f 88 0a ff ff ff    	js     80308d <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803183:	44 89 f0             	mov    %r14d,%eax
+  803186:	66 b8 00 00          	mov    $0x0,%ax
+  80318a:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  80318d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803194:	00 
+        size_t off = pos - fb->fb_base;
+  803195:	45 89 f4             	mov    %r14d,%r12d
+  803198:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  80319c:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  80319f:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  8031a3:	4d 29 fd             	sub    %r15,%r13
+  8031a6:	b8 00 00 01 00       	mov    $0x10000,%eax
+  8031ab:	4c 29 e0             	sub    %r12,%rax
+  8031ae:	49 39 c5             	cmp    %rax,%r13
+  8031b1:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  8031b5:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8031b9:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8031bd:	48 39 c2             	cmp    %rax,%rdx
+  8031c0:	0f 84 f0 fe ff ff    	je     8030b6 <devfile_write+0x121>
+  8031c6:	4c 39 e0             	cmp    %r12,%rax
+  8031c9:	0f 82 cc fe ff ff    	jb     80309b <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  8031cf:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8031d3:	48 39 d0             	cmp    %rdx,%rax
+  8031d6:	0f 83 da fe ff ff    	jae    8030b6 <devfile_write+0x121>
+  8031dc:	e9 ba fe ff ff       	jmp    80309b <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8031e1:	48 98                	cltq
+  8031e3:	4d 85 ff             	test   %r15,%r15
+  8031e6:	49 0f 45 c7          	cmovne %r15,%rax
+  8031ea:	e9 fc fd ff ff       	jmp    802feb <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  8031ef:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8031f3:	4c 89 e2             	mov    %r12,%rdx
+  8031f6:	e9 2a ff ff ff       	jmp    803125 <devfile_write+0x190>
+
+00000000008031fb <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8031fb:	55                   	push   %rbp
+  8031fc:	48 89 e5             	mov    %rsp,%rbp
+  8031ff:	41 57                	push   %r15
+  803201:	41 56                	push   %r14
+  803203:	41 55                	push   %r13
+  803205:	41 54                	push   %r12
+  803207:	53                   	push   %rbx
+  803208:	48 83 ec 28          	sub    $0x28,%rsp
+  80320c:	49 89 ff             	mov    %rdi,%r15
+  80320f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803213:	48 89 d3             	mov    %rdx,%rbx
+  803216:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  80321a:	48 b8 45 29 80 00 00 	movabs $0x802945,%rax
+  803221:	00 00 00 
+  803224:	ff d0                	call   *%rax
+  803226:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803229:	48 85 c0             	test   %rax,%rax
+  80322c:	74 0d                	je     80323b <devfile_read+0x40>
+  80322e:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803235:	0f 86 1a 01 00 00    	jbe    803355 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80323b:	4d 85 e4             	test   %r12,%r12
+  80323e:	74 1a                	je     80325a <devfile_read+0x5f>
+  803240:	4c 89 e6             	mov    %r12,%rsi
+  803243:	4c 89 ff             	mov    %r15,%rdi
+  803246:	48 b8 6d 2c 80 00 00 	movabs $0x802c6d,%rax
+  80324d:	00 00 00 
+  803250:	ff d0                	call   *%rax
+  803252:	85 c0                	test   %eax,%eax
+  803254:	0f 88 e8 00 00 00    	js     803342 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  80325a:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  80325e:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  803265:	00 00 00 
+  803268:	ff d0                	call   *%rax
+  80326a:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  80326d:	48 85 c0             	test   %rax,%rax
+  803270:	0f 84 69 02 00 00    	je     8034df <devfile_read+0x2e4>
+    while (i < n) {
+  803276:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80327b:	0f 84 ce 00 00 00    	je     80334f <devfile_read+0x154>
+    size_t i = 0;
+  803281:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803286:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80328d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803291:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803295:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803299:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80329d:	48 29 da             	sub    %rbx,%rdx
+  8032a0:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8032a5:	48 39 c2             	cmp    %rax,%rdx
+  8032a8:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  8032ac:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8032b0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  8032b4:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8032b7:	01 d8                	add    %ebx,%eax
+  8032b9:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  8032bd:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  8032c1:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  8032c8:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8032cf:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8032d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8032dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032e1:	4c 89 ee             	mov    %r13,%rsi
+  8032e4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8032e9:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  8032f0:	00 00 00 
+  8032f3:	ff d0                	call   *%rax
+        if (res < 0)
+  8032f5:	85 c0                	test   %eax,%eax
+  8032f7:	78 4d                	js     803346 <devfile_read+0x14b>
+        if (res == 0)
+  8032f9:	74 4f                	je     80334a <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8032fb:	4c 63 e0             	movslq %eax,%r12
+  8032fe:	4c 89 e2             	mov    %r12,%rdx
+  803301:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803305:	4c 89 f7             	mov    %r14,%rdi
+  803308:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  80330f:	00 00 00 
+  803312:	ff d0                	call   *%rax
+        i += res;
+  803314:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803317:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  80331a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80331e:	48 39 c3             	cmp    %rax,%rbx
+  803321:	0f 82 72 ff ff ff    	jb     803299 <devfile_read+0x9e>
+    return i;
+  803327:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80332a:	48 85 c0             	test   %rax,%rax
+  80332d:	7e 04                	jle    803333 <devfile_read+0x138>
+  80332f:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803333:	48 83 c4 28          	add    $0x28,%rsp
+  803337:	5b                   	pop    %rbx
+  803338:	41 5c                	pop    %r12
+  80333a:	41 5d                	pop    %r13
+  80333c:	41 5e                	pop    %r14
+  80333e:	41 5f                	pop    %r15
+  803340:	5d                   	pop    %rbp
+  803341:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803342:	48 98                	cltq
+  803344:	eb ed                	jmp    803333 <devfile_read+0x138>
+            return res;
+  803346:	48 98                	cltq
+  803348:	eb e9                	jmp    803333 <devfile_read+0x138>
+            return i;
+  80334a:	48 89 d8             	mov    %rbx,%rax
+  80334d:	eb db                	jmp    80332a <devfile_read+0x12f>
+    size_t i = 0;
+  80334f:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803353:	eb d2                	jmp    803327 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803355:	48 89 c6             	mov    %rax,%rsi
+  803358:	4c 89 ff             	mov    %r15,%rdi
+  80335b:	48 b8 6d 2c 80 00 00 	movabs $0x802c6d,%rax
+  803362:	00 00 00 
+  803365:	ff d0                	call   *%rax
+  803367:	85 c0                	test   %eax,%eax
+  803369:	78 40                	js     8033ab <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80336b:	4c 89 ff             	mov    %r15,%rdi
+  80336e:	48 b8 71 21 80 00 00 	movabs $0x802171,%rax
+  803375:	00 00 00 
+  803378:	ff d0                	call   *%rax
+  80337a:	48 89 c2             	mov    %rax,%rdx
+  80337d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803381:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803385:	48 c1 e0 0c          	shl    $0xc,%rax
+  803389:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80338e:	48 01 d0             	add    %rdx,%rax
+  803391:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803395:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80339a:	0f 84 33 01 00 00    	je     8034d3 <devfile_read+0x2d8>
+    size_t i = 0;
+  8033a0:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8033a6:	e9 f5 00 00 00       	jmp    8034a0 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8033ab:	48 98                	cltq
+  8033ad:	eb 84                	jmp    803333 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8033af:	44 89 e8             	mov    %r13d,%eax
+  8033b2:	66 b8 00 00          	mov    $0x0,%ax
+  8033b6:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8033bb:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8033c2:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8033c4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8033c8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8033cc:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8033ce:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8033d3:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8033d6:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8033dd:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8033de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8033e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033e9:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8033ee:	bf 03 00 00 00       	mov    $0x3,%edi
+  8033f3:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  8033fa:	00 00 00 
+  8033fd:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8033ff:	85 c0                	test   %eax,%eax
+  803401:	0f 88 be 00 00 00    	js     8034c5 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803407:	48 63 d0             	movslq %eax,%rdx
+  80340a:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  80340f:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803414:	44 39 e8             	cmp    %r13d,%eax
+  803417:	0f 8e ba 00 00 00    	jle    8034d7 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80341d:	49 63 c5             	movslq %r13d,%rax
+  803420:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803425:	48 29 c3             	sub    %rax,%rbx
+  803428:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80342d:	48 01 c3             	add    %rax,%rbx
+  803430:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803434:	4c 29 f0             	sub    %r14,%rax
+  803437:	48 39 c3             	cmp    %rax,%rbx
+  80343a:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80343e:	4c 89 ff             	mov    %r15,%rdi
+  803441:	48 b9 71 21 80 00 00 	movabs $0x802171,%rcx
+  803448:	00 00 00 
+  80344b:	ff d1                	call   *%rcx
+  80344d:	48 89 c2             	mov    %rax,%rdx
+  803450:	48 c1 e2 04          	shl    $0x4,%rdx
+  803454:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803458:	48 c1 e0 0c          	shl    $0xc,%rax
+  80345c:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803461:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803464:	44 89 ea             	mov    %r13d,%edx
+  803467:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  80346c:	48 63 d2             	movslq %edx,%rdx
+  80346f:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803476:	00 
+  803477:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80347b:	4c 01 f7             	add    %r14,%rdi
+  80347e:	48 89 da             	mov    %rbx,%rdx
+  803481:	48 b9 e2 12 80 00 00 	movabs $0x8012e2,%rcx
+  803488:	00 00 00 
+  80348b:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80348d:	41 01 dd             	add    %ebx,%r13d
+  803490:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803494:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803497:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80349b:	49 39 c6             	cmp    %rax,%r14
+  80349e:	73 37                	jae    8034d7 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8034a0:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8034a4:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8034a9:	44 39 e8             	cmp    %r13d,%eax
+  8034ac:	0f 8f fd fe ff ff    	jg     8033af <devfile_read+0x1b4>
+  8034b2:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8034b7:	44 39 e8             	cmp    %r13d,%eax
+  8034ba:	0f 8f 5d ff ff ff    	jg     80341d <devfile_read+0x222>
+  8034c0:	e9 ea fe ff ff       	jmp    8033af <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8034c5:	48 98                	cltq
+  8034c7:	4d 85 f6             	test   %r14,%r14
+  8034ca:	49 0f 45 c6          	cmovne %r14,%rax
+  8034ce:	e9 60 fe ff ff       	jmp    803333 <devfile_read+0x138>
+    size_t i = 0;
+  8034d3:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8034d7:	4c 89 f0             	mov    %r14,%rax
+  8034da:	e9 54 fe ff ff       	jmp    803333 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8034df:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8034e6:	e9 48 fe ff ff       	jmp    803333 <devfile_read+0x138>
+
+00000000008034eb <open>:
+open(const char *path, int mode) {
+  8034eb:	55                   	push   %rbp
+  8034ec:	48 89 e5             	mov    %rsp,%rbp
+  8034ef:	41 55                	push   %r13
+  8034f1:	41 54                	push   %r12
+  8034f3:	53                   	push   %rbx
+  8034f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8034f8:	49 89 fc             	mov    %rdi,%r12
+  8034fb:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8034fe:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  803505:	00 00 00 
+  803508:	ff d0                	call   *%rax
+  80350a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803510:	0f 87 8a 00 00 00    	ja     8035a0 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803516:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80351a:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803521:	00 00 00 
+  803524:	ff d0                	call   *%rax
+  803526:	89 c3                	mov    %eax,%ebx
+  803528:	85 c0                	test   %eax,%eax
+  80352a:	78 50                	js     80357c <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80352c:	4c 89 e6             	mov    %r12,%rsi
+  80352f:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803536:	00 00 00 
+  803539:	48 89 df             	mov    %rbx,%rdi
+  80353c:	48 b8 ed 0e 80 00 00 	movabs $0x800eed,%rax
+  803543:	00 00 00 
+  803546:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803548:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80354f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803553:	bf 01 00 00 00       	mov    $0x1,%edi
+  803558:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  80355f:	00 00 00 
+  803562:	ff d0                	call   *%rax
+  803564:	89 c3                	mov    %eax,%ebx
+  803566:	85 c0                	test   %eax,%eax
+  803568:	78 1f                	js     803589 <open+0x9e>
+    return fd2num(fd);
+  80356a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80356e:	48 b8 71 21 80 00 00 	movabs $0x802171,%rax
+  803575:	00 00 00 
+  803578:	ff d0                	call   *%rax
+  80357a:	89 c3                	mov    %eax,%ebx
+}
+  80357c:	89 d8                	mov    %ebx,%eax
+  80357e:	48 83 c4 18          	add    $0x18,%rsp
+  803582:	5b                   	pop    %rbx
+  803583:	41 5c                	pop    %r12
+  803585:	41 5d                	pop    %r13
+  803587:	5d                   	pop    %rbp
+  803588:	c3                   	ret
+        fd_close(fd, 0);
+  803589:	be 00 00 00 00       	mov    $0x0,%esi
+  80358e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803592:	48 b8 ba 22 80 00 00 	movabs $0x8022ba,%rax
+  803599:	00 00 00 
+  80359c:	ff d0                	call   *%rax
+        return res;
+  80359e:	eb dc                	jmp    80357c <open+0x91>
+        return -E_BAD_PATH;
+  8035a0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035a5:	eb d5                	jmp    80357c <open+0x91>
+
+00000000008035a7 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8035a7:	55                   	push   %rbp
+  8035a8:	48 89 e5             	mov    %rsp,%rbp
+  8035ab:	41 57                	push   %r15
+  8035ad:	41 56                	push   %r14
+  8035af:	41 55                	push   %r13
+  8035b1:	41 54                	push   %r12
+  8035b3:	53                   	push   %rbx
+  8035b4:	48 83 ec 18          	sub    $0x18,%rsp
+  8035b8:	41 89 f6             	mov    %esi,%r14d
+  8035bb:	49 89 d7             	mov    %rdx,%r15
+  8035be:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8035c1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8035c5:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  8035cc:	00 00 00 
+  8035cf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035d1:	85 c0                	test   %eax,%eax
+  8035d3:	0f 88 db 00 00 00    	js     8036b4 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8035d9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035dd:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8035e4:	00 00 00 
+  8035e7:	8b 00                	mov    (%rax),%eax
+  8035e9:	39 07                	cmp    %eax,(%rdi)
+  8035eb:	0f 85 db 00 00 00    	jne    8036cc <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8035f1:	45 85 f6             	test   %r14d,%r14d
+  8035f4:	0f 88 db 00 00 00    	js     8036d5 <fmap+0x12e>
+  8035fa:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803601:	0f 85 d7 00 00 00    	jne    8036de <fmap+0x137>
+  803607:	4c 89 fb             	mov    %r15,%rbx
+  80360a:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803610:	0f 85 d1 00 00 00    	jne    8036e7 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803616:	48 b8 37 2d 80 00 00 	movabs $0x802d37,%rax
+  80361d:	00 00 00 
+  803620:	ff d0                	call   *%rax
+  803622:	85 c0                	test   %eax,%eax
+  803624:	0f 88 8e 00 00 00    	js     8036b8 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80362a:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803631:	00 00 00 
+    while (i < n) {
+  803634:	4d 85 ed             	test   %r13,%r13
+  803637:	0f 84 8a 00 00 00    	je     8036c7 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80363d:	4c 89 ea             	mov    %r13,%rdx
+  803640:	48 29 da             	sub    %rbx,%rdx
+  803643:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80364a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803650:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803654:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803658:	8b 40 0c             	mov    0xc(%rax),%eax
+  80365b:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80365f:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803663:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803668:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80366d:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803671:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803675:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80367a:	4c 89 e6             	mov    %r12,%rsi
+  80367d:	bf 09 00 00 00       	mov    $0x9,%edi
+  803682:	48 b8 c5 2a 80 00 00 	movabs $0x802ac5,%rax
+  803689:	00 00 00 
+  80368c:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80368e:	85 c0                	test   %eax,%eax
+  803690:	78 2a                	js     8036bc <fmap+0x115>
+        i += res;
+  803692:	48 98                	cltq
+  803694:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803697:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  80369b:	72 05                	jb     8036a2 <fmap+0xfb>
+    while (i < n) {
+  80369d:	4c 39 eb             	cmp    %r13,%rbx
+  8036a0:	72 9b                	jb     80363d <fmap+0x96>
+    }
+    return i;
+  8036a2:	48 89 d8             	mov    %rbx,%rax
+}
+  8036a5:	48 83 c4 18          	add    $0x18,%rsp
+  8036a9:	5b                   	pop    %rbx
+  8036aa:	41 5c                	pop    %r12
+  8036ac:	41 5d                	pop    %r13
+  8036ae:	41 5e                	pop    %r14
+  8036b0:	41 5f                	pop    %r15
+  8036b2:	5d                   	pop    %rbp
+  8036b3:	c3                   	ret
+    if (res < 0) return res;
+  8036b4:	48 98                	cltq
+  8036b6:	eb ed                	jmp    8036a5 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8036b8:	48 98                	cltq
+  8036ba:	eb e9                	jmp    8036a5 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8036bc:	48 98                	cltq
+  8036be:	48 85 db             	test   %rbx,%rbx
+  8036c1:	48 0f 45 c3          	cmovne %rbx,%rax
+  8036c5:	eb de                	jmp    8036a5 <fmap+0xfe>
+    size_t i = 0;
+  8036c7:	4c 89 eb             	mov    %r13,%rbx
+  8036ca:	eb d6                	jmp    8036a2 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8036cc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8036d3:	eb d0                	jmp    8036a5 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8036d5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036dc:	eb c7                	jmp    8036a5 <fmap+0xfe>
+  8036de:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036e5:	eb be                	jmp    8036a5 <fmap+0xfe>
+  8036e7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036ee:	eb b5                	jmp    8036a5 <fmap+0xfe>
+
+00000000008036f0 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8036f0:	55                   	push   %rbp
+  8036f1:	48 89 e5             	mov    %rsp,%rbp
+  8036f4:	41 56                	push   %r14
+  8036f6:	41 55                	push   %r13
+  8036f8:	41 54                	push   %r12
+  8036fa:	53                   	push   %rbx
+  8036fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8036ff:	89 fb                	mov    %edi,%ebx
+  803701:	41 89 f4             	mov    %esi,%r12d
+  803704:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803707:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80370b:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  803712:	00 00 00 
+  803715:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803717:	85 c0                	test   %eax,%eax
+  803719:	78 63                	js     80377e <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80371b:	45 85 e4             	test   %r12d,%r12d
+  80371e:	0f 88 80 00 00 00    	js     8037a4 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803724:	45 89 e6             	mov    %r12d,%r14d
+  803727:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80372e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803732:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  803739:	00 00 00 
+  80373c:	ff d0                	call   *%rax
+  80373e:	48 89 c2             	mov    %rax,%rdx
+  803741:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803746:	44 89 f6             	mov    %r14d,%esi
+  803749:	89 df                	mov    %ebx,%edi
+  80374b:	48 b8 a7 35 80 00 00 	movabs $0x8035a7,%rax
+  803752:	00 00 00 
+  803755:	ff d0                	call   *%rax
+  803757:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80375a:	45 29 f4             	sub    %r14d,%r12d
+  80375d:	4d 63 f4             	movslq %r12d,%r14
+  803760:	49 39 c6             	cmp    %rax,%r14
+  803763:	7c 1d                	jl     803782 <read_map+0x92>
+  803765:	48 85 c0             	test   %rax,%rax
+  803768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376d:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803771:	48 83 c4 10          	add    $0x10,%rsp
+  803775:	5b                   	pop    %rbx
+  803776:	41 5c                	pop    %r12
+  803778:	41 5d                	pop    %r13
+  80377a:	41 5e                	pop    %r14
+  80377c:	5d                   	pop    %rbp
+  80377d:	c3                   	ret
+    if (res < 0) return res;
+  80377e:	48 98                	cltq
+  803780:	eb ef                	jmp    803771 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803782:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803786:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  80378d:	00 00 00 
+  803790:	ff d0                	call   *%rax
+  803792:	4d 63 e4             	movslq %r12d,%r12
+  803795:	4c 01 e0             	add    %r12,%rax
+  803798:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  80379c:	48 89 d8             	mov    %rbx,%rax
+  80379f:	4c 29 f0             	sub    %r14,%rax
+  8037a2:	eb cd                	jmp    803771 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8037a4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037ab:	eb c4                	jmp    803771 <read_map+0x81>
+
+00000000008037ad <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8037ad:	55                   	push   %rbp
+  8037ae:	48 89 e5             	mov    %rsp,%rbp
+  8037b1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8037b5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037b9:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  8037c0:	00 00 00 
+  8037c3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037c5:	85 c0                	test   %eax,%eax
+  8037c7:	78 4a                	js     803813 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8037c9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8037cd:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8037d4:	00 00 00 
+  8037d7:	8b 00                	mov    (%rax),%eax
+  8037d9:	39 07                	cmp    %eax,(%rdi)
+  8037db:	75 38                	jne    803815 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8037dd:	48 b8 37 2d 80 00 00 	movabs $0x802d37,%rax
+  8037e4:	00 00 00 
+  8037e7:	ff d0                	call   *%rax
+  8037e9:	85 c0                	test   %eax,%eax
+  8037eb:	78 26                	js     803813 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8037ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037f1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037f4:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8037fb:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8037fd:	be 00 00 00 00       	mov    $0x0,%esi
+  803802:	bf 06 00 00 00       	mov    $0x6,%edi
+  803807:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  80380e:	00 00 00 
+  803811:	ff d0                	call   *%rax
+}
+  803813:	c9                   	leave
+  803814:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803815:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80381a:	eb f7                	jmp    803813 <fsync+0x66>
+
+000000000080381c <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80381c:	55                   	push   %rbp
+  80381d:	48 89 e5             	mov    %rsp,%rbp
+  803820:	41 57                	push   %r15
+  803822:	41 56                	push   %r14
+  803824:	41 55                	push   %r13
+  803826:	41 54                	push   %r12
+  803828:	53                   	push   %rbx
+  803829:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80382d:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803834:	00 00 00 
+  803837:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80383c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803842:	49 bd ff 21 80 00 00 	movabs $0x8021ff,%r13
+  803849:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80384c:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803853:	00 00 00 
+  803856:	eb 0c                	jmp    803864 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803858:	83 c3 01             	add    $0x1,%ebx
+  80385b:	49 83 c4 28          	add    $0x28,%r12
+  80385f:	83 fb 20             	cmp    $0x20,%ebx
+  803862:	74 33                	je     803897 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803864:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803869:	74 ed                	je     803858 <flushall+0x3c>
+  80386b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80386f:	89 df                	mov    %ebx,%edi
+  803871:	41 ff d5             	call   *%r13
+  803874:	85 c0                	test   %eax,%eax
+  803876:	78 e0                	js     803858 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803878:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80387c:	41 8b 06             	mov    (%r14),%eax
+  80387f:	39 07                	cmp    %eax,(%rdi)
+  803881:	75 d5                	jne    803858 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803883:	48 b8 37 2d 80 00 00 	movabs $0x802d37,%rax
+  80388a:	00 00 00 
+  80388d:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80388f:	85 c0                	test   %eax,%eax
+  803891:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803895:	eb c1                	jmp    803858 <flushall+0x3c>
+    }
+    return res;
+}
+  803897:	44 89 f8             	mov    %r15d,%eax
+  80389a:	48 83 c4 18          	add    $0x18,%rsp
+  80389e:	5b                   	pop    %rbx
+  80389f:	41 5c                	pop    %r12
+  8038a1:	41 5d                	pop    %r13
+  8038a3:	41 5e                	pop    %r14
+  8038a5:	41 5f                	pop    %r15
+  8038a7:	5d                   	pop    %rbp
+  8038a8:	c3                   	ret
+
+00000000008038a9 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8038a9:	55                   	push   %rbp
+  8038aa:	48 89 e5             	mov    %rsp,%rbp
+  8038ad:	53                   	push   %rbx
+  8038ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8038b2:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8038b5:	40 0f b6 c6          	movzbl %sil,%eax
+  8038b9:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8038c0:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8038c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8038c7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8038cc:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  8038d3:	00 00 00 
+  8038d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038d8:	85 c0                	test   %eax,%eax
+  8038da:	78 23                	js     8038ff <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8038dc:	ba 58 06 00 00       	mov    $0x658,%edx
+  8038e1:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8038e8:	00 00 00 
+  8038eb:	48 89 df             	mov    %rbx,%rdi
+  8038ee:	48 b8 e2 12 80 00 00 	movabs $0x8012e2,%rax
+  8038f5:	00 00 00 
+  8038f8:	ff d0                	call   *%rax
+    return 0;
+  8038fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803903:	c9                   	leave
+  803904:	c3                   	ret
+
+0000000000803905 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803905:	55                   	push   %rbp
+  803906:	48 89 e5             	mov    %rsp,%rbp
+  803909:	53                   	push   %rbx
+  80390a:	48 83 ec 08          	sub    $0x8,%rsp
+  80390e:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803911:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  803918:	00 00 00 
+  80391b:	ff d0                	call   *%rax
+  80391d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803923:	77 35                	ja     80395a <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803925:	48 89 de             	mov    %rbx,%rsi
+  803928:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80392f:	00 00 00 
+  803932:	48 b8 ed 0e 80 00 00 	movabs $0x800eed,%rax
+  803939:	00 00 00 
+  80393c:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80393e:	be 00 00 00 00       	mov    $0x0,%esi
+  803943:	bf 07 00 00 00       	mov    $0x7,%edi
+  803948:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  80394f:	00 00 00 
+  803952:	ff d0                	call   *%rax
+}
+  803954:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803958:	c9                   	leave
+  803959:	c3                   	ret
+        return -E_BAD_PATH;
+  80395a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80395f:	eb f3                	jmp    803954 <remove+0x4f>
+
+0000000000803961 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803961:	55                   	push   %rbp
+  803962:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803965:	48 b8 1c 38 80 00 00 	movabs $0x80381c,%rax
+  80396c:	00 00 00 
+  80396f:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803971:	be 00 00 00 00       	mov    $0x0,%esi
+  803976:	bf 08 00 00 00       	mov    $0x8,%edi
+  80397b:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  803982:	00 00 00 
+  803985:	ff d0                	call   *%rax
+}
+  803987:	5d                   	pop    %rbp
+  803988:	c3                   	ret
+
+0000000000803989 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803989:	55                   	push   %rbp
+  80398a:	48 89 e5             	mov    %rsp,%rbp
+  80398d:	41 54                	push   %r12
+  80398f:	53                   	push   %rbx
+  803990:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803993:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  80399a:	00 00 00 
+  80399d:	ff d0                	call   *%rax
+  80399f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039a2:	48 be 80 57 80 00 00 	movabs $0x805780,%rsi
+  8039a9:	00 00 00 
+  8039ac:	48 89 df             	mov    %rbx,%rdi
+  8039af:	48 b8 ed 0e 80 00 00 	movabs $0x800eed,%rax
+  8039b6:	00 00 00 
+  8039b9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8039bb:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8039c0:	41 2b 04 24          	sub    (%r12),%eax
+  8039c4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8039ca:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039d1:	00 00 00 
+    stat->st_dev = &devpipe;
+  8039d4:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8039db:	00 00 00 
+  8039de:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8039e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ea:	5b                   	pop    %rbx
+  8039eb:	41 5c                	pop    %r12
+  8039ed:	5d                   	pop    %rbp
+  8039ee:	c3                   	ret
+
+00000000008039ef <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8039ef:	55                   	push   %rbp
+  8039f0:	48 89 e5             	mov    %rsp,%rbp
+  8039f3:	41 54                	push   %r12
+  8039f5:	53                   	push   %rbx
+  8039f6:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8039f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039fe:	48 89 fe             	mov    %rdi,%rsi
+  803a01:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a06:	49 bc 2c 18 80 00 00 	movabs $0x80182c,%r12
+  803a0d:	00 00 00 
+  803a10:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803a13:	48 89 df             	mov    %rbx,%rdi
+  803a16:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  803a1d:	00 00 00 
+  803a20:	ff d0                	call   *%rax
+  803a22:	48 89 c6             	mov    %rax,%rsi
+  803a25:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a2f:	41 ff d4             	call   *%r12
+}
+  803a32:	5b                   	pop    %rbx
+  803a33:	41 5c                	pop    %r12
+  803a35:	5d                   	pop    %rbp
+  803a36:	c3                   	ret
+
+0000000000803a37 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803a37:	55                   	push   %rbp
+  803a38:	48 89 e5             	mov    %rsp,%rbp
+  803a3b:	41 57                	push   %r15
+  803a3d:	41 56                	push   %r14
+  803a3f:	41 55                	push   %r13
+  803a41:	41 54                	push   %r12
+  803a43:	53                   	push   %rbx
+  803a44:	48 83 ec 18          	sub    $0x18,%rsp
+  803a48:	49 89 fc             	mov    %rdi,%r12
+  803a4b:	49 89 f5             	mov    %rsi,%r13
+  803a4e:	49 89 d7             	mov    %rdx,%r15
+  803a51:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a55:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  803a5c:	00 00 00 
+  803a5f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803a61:	4d 85 ff             	test   %r15,%r15
+  803a64:	0f 84 af 00 00 00    	je     803b19 <devpipe_write+0xe2>
+  803a6a:	48 89 c3             	mov    %rax,%rbx
+  803a6d:	4c 89 f8             	mov    %r15,%rax
+  803a70:	4d 89 ef             	mov    %r13,%r15
+  803a73:	4c 01 e8             	add    %r13,%rax
+  803a76:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a7a:	49 bd 21 16 80 00 00 	movabs $0x801621,%r13
+  803a81:	00 00 00 
+            sys_yield();
+  803a84:	49 be be 15 80 00 00 	movabs $0x8015be,%r14
+  803a8b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a8e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a91:	48 63 ce             	movslq %esi,%rcx
+  803a94:	48 63 03             	movslq (%rbx),%rax
+  803a97:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a9d:	48 39 c1             	cmp    %rax,%rcx
+  803aa0:	72 2e                	jb     803ad0 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803aa2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803aa7:	48 89 da             	mov    %rbx,%rdx
+  803aaa:	be 00 10 00 00       	mov    $0x1000,%esi
+  803aaf:	4c 89 e7             	mov    %r12,%rdi
+  803ab2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803ab5:	85 c0                	test   %eax,%eax
+  803ab7:	74 66                	je     803b1f <devpipe_write+0xe8>
+            sys_yield();
+  803ab9:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803abc:	8b 73 04             	mov    0x4(%rbx),%esi
+  803abf:	48 63 ce             	movslq %esi,%rcx
+  803ac2:	48 63 03             	movslq (%rbx),%rax
+  803ac5:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803acb:	48 39 c1             	cmp    %rax,%rcx
+  803ace:	73 d2                	jae    803aa2 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803ad0:	41 0f b6 3f          	movzbl (%r15),%edi
+  803ad4:	48 89 ca             	mov    %rcx,%rdx
+  803ad7:	48 c1 ea 03          	shr    $0x3,%rdx
+  803adb:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803ae2:	08 10 20 
+  803ae5:	48 f7 e2             	mul    %rdx
+  803ae8:	48 c1 ea 06          	shr    $0x6,%rdx
+  803aec:	48 89 d0             	mov    %rdx,%rax
+  803aef:	48 c1 e0 09          	shl    $0x9,%rax
+  803af3:	48 29 d0             	sub    %rdx,%rax
+  803af6:	48 c1 e0 03          	shl    $0x3,%rax
+  803afa:	48 29 c1             	sub    %rax,%rcx
+  803afd:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803b02:	83 c6 01             	add    $0x1,%esi
+  803b05:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b08:	49 83 c7 01          	add    $0x1,%r15
+  803b0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b10:	49 39 c7             	cmp    %rax,%r15
+  803b13:	0f 85 75 ff ff ff    	jne    803a8e <devpipe_write+0x57>
+    return n;
+  803b19:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b1d:	eb 05                	jmp    803b24 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b24:	48 83 c4 18          	add    $0x18,%rsp
+  803b28:	5b                   	pop    %rbx
+  803b29:	41 5c                	pop    %r12
+  803b2b:	41 5d                	pop    %r13
+  803b2d:	41 5e                	pop    %r14
+  803b2f:	41 5f                	pop    %r15
+  803b31:	5d                   	pop    %rbp
+  803b32:	c3                   	ret
+
+0000000000803b33 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803b33:	55                   	push   %rbp
+  803b34:	48 89 e5             	mov    %rsp,%rbp
+  803b37:	41 57                	push   %r15
+  803b39:	41 56                	push   %r14
+  803b3b:	41 55                	push   %r13
+  803b3d:	41 54                	push   %r12
+  803b3f:	53                   	push   %rbx
+  803b40:	48 83 ec 18          	sub    $0x18,%rsp
+  803b44:	49 89 fc             	mov    %rdi,%r12
+  803b47:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b4b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b4f:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  803b56:	00 00 00 
+  803b59:	ff d0                	call   *%rax
+  803b5b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b5e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b64:	49 bd 21 16 80 00 00 	movabs $0x801621,%r13
+  803b6b:	00 00 00 
+            sys_yield();
+  803b6e:	49 be be 15 80 00 00 	movabs $0x8015be,%r14
+  803b75:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b78:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b7d:	74 7d                	je     803bfc <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b7f:	8b 03                	mov    (%rbx),%eax
+  803b81:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b84:	75 26                	jne    803bac <devpipe_read+0x79>
+            if (i > 0) return i;
+  803b86:	4d 85 ff             	test   %r15,%r15
+  803b89:	75 77                	jne    803c02 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b8b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b90:	48 89 da             	mov    %rbx,%rdx
+  803b93:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b98:	4c 89 e7             	mov    %r12,%rdi
+  803b9b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b9e:	85 c0                	test   %eax,%eax
+  803ba0:	74 72                	je     803c14 <devpipe_read+0xe1>
+            sys_yield();
+  803ba2:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803ba5:	8b 03                	mov    (%rbx),%eax
+  803ba7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803baa:	74 df                	je     803b8b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803bac:	48 63 c8             	movslq %eax,%rcx
+  803baf:	48 89 ca             	mov    %rcx,%rdx
+  803bb2:	48 c1 ea 03          	shr    $0x3,%rdx
+  803bb6:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803bbd:	08 10 20 
+  803bc0:	48 89 d0             	mov    %rdx,%rax
+  803bc3:	48 f7 e6             	mul    %rsi
+  803bc6:	48 c1 ea 06          	shr    $0x6,%rdx
+  803bca:	48 89 d0             	mov    %rdx,%rax
+  803bcd:	48 c1 e0 09          	shl    $0x9,%rax
+  803bd1:	48 29 d0             	sub    %rdx,%rax
+  803bd4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803bdb:	00 
+  803bdc:	48 89 c8             	mov    %rcx,%rax
+  803bdf:	48 29 d0             	sub    %rdx,%rax
+  803be2:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803be7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803beb:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803bef:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803bf2:	49 83 c7 01          	add    $0x1,%r15
+  803bf6:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803bfa:	75 83                	jne    803b7f <devpipe_read+0x4c>
+    return n;
+  803bfc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c00:	eb 03                	jmp    803c05 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803c02:	4c 89 f8             	mov    %r15,%rax
+}
+  803c05:	48 83 c4 18          	add    $0x18,%rsp
+  803c09:	5b                   	pop    %rbx
+  803c0a:	41 5c                	pop    %r12
+  803c0c:	41 5d                	pop    %r13
+  803c0e:	41 5e                	pop    %r14
+  803c10:	41 5f                	pop    %r15
+  803c12:	5d                   	pop    %rbp
+  803c13:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c19:	eb ea                	jmp    803c05 <devpipe_read+0xd2>
+
+0000000000803c1b <pipe>:
+pipe(int pfd[2]) {
+  803c1b:	55                   	push   %rbp
+  803c1c:	48 89 e5             	mov    %rsp,%rbp
+  803c1f:	41 55                	push   %r13
+  803c21:	41 54                	push   %r12
+  803c23:	53                   	push   %rbx
+  803c24:	48 83 ec 18          	sub    $0x18,%rsp
+  803c28:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c2b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c2f:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803c36:	00 00 00 
+  803c39:	ff d0                	call   *%rax
+  803c3b:	89 c3                	mov    %eax,%ebx
+  803c3d:	85 c0                	test   %eax,%eax
+  803c3f:	0f 88 a0 01 00 00    	js     803de5 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803c45:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c4f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c53:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c58:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  803c5f:	00 00 00 
+  803c62:	ff d0                	call   *%rax
+  803c64:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c66:	85 c0                	test   %eax,%eax
+  803c68:	0f 88 77 01 00 00    	js     803de5 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c6e:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c72:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803c79:	00 00 00 
+  803c7c:	ff d0                	call   *%rax
+  803c7e:	89 c3                	mov    %eax,%ebx
+  803c80:	85 c0                	test   %eax,%eax
+  803c82:	0f 88 43 01 00 00    	js     803dcb <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c88:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c8d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c92:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c96:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c9b:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  803ca2:	00 00 00 
+  803ca5:	ff d0                	call   *%rax
+  803ca7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ca9:	85 c0                	test   %eax,%eax
+  803cab:	0f 88 1a 01 00 00    	js     803dcb <pipe+0x1b0>
+    va = fd2data(fd0);
+  803cb1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cb5:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  803cbc:	00 00 00 
+  803cbf:	ff d0                	call   *%rax
+  803cc1:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803cc4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cc9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cce:	48 89 c6             	mov    %rax,%rsi
+  803cd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd6:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  803cdd:	00 00 00 
+  803ce0:	ff d0                	call   *%rax
+  803ce2:	89 c3                	mov    %eax,%ebx
+  803ce4:	85 c0                	test   %eax,%eax
+  803ce6:	0f 88 c5 00 00 00    	js     803db1 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803cec:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803cf0:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  803cf7:	00 00 00 
+  803cfa:	ff d0                	call   *%rax
+  803cfc:	48 89 c1             	mov    %rax,%rcx
+  803cff:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803d05:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803d0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d10:	4c 89 ee             	mov    %r13,%rsi
+  803d13:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d18:	48 b8 b4 16 80 00 00 	movabs $0x8016b4,%rax
+  803d1f:	00 00 00 
+  803d22:	ff d0                	call   *%rax
+  803d24:	89 c3                	mov    %eax,%ebx
+  803d26:	85 c0                	test   %eax,%eax
+  803d28:	78 6e                	js     803d98 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d2a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d2f:	4c 89 ef             	mov    %r13,%rdi
+  803d32:	48 b8 ef 15 80 00 00 	movabs $0x8015ef,%rax
+  803d39:	00 00 00 
+  803d3c:	ff d0                	call   *%rax
+  803d3e:	83 f8 02             	cmp    $0x2,%eax
+  803d41:	0f 85 ab 00 00 00    	jne    803df2 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803d47:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803d4e:	00 00 
+  803d50:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d54:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803d56:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d5a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d61:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d65:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d67:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d6b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d72:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d76:	48 bb 71 21 80 00 00 	movabs $0x802171,%rbx
+  803d7d:	00 00 00 
+  803d80:	ff d3                	call   *%rbx
+  803d82:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d86:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d8a:	ff d3                	call   *%rbx
+  803d8c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d96:	eb 4d                	jmp    803de5 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d98:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d9d:	4c 89 ee             	mov    %r13,%rsi
+  803da0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803da5:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  803dac:	00 00 00 
+  803daf:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803db1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803db6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803dba:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dbf:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  803dc6:	00 00 00 
+  803dc9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803dcb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dd0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803dd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dd9:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  803de0:	00 00 00 
+  803de3:	ff d0                	call   *%rax
+}
+  803de5:	89 d8                	mov    %ebx,%eax
+  803de7:	48 83 c4 18          	add    $0x18,%rsp
+  803deb:	5b                   	pop    %rbx
+  803dec:	41 5c                	pop    %r12
+  803dee:	41 5d                	pop    %r13
+  803df0:	5d                   	pop    %rbp
+  803df1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803df2:	48 b9 a8 57 80 00 00 	movabs $0x8057a8,%rcx
+  803df9:	00 00 00 
+  803dfc:	48 ba 87 57 80 00 00 	movabs $0x805787,%rdx
+  803e03:	00 00 00 
+  803e06:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803e0b:	48 bf 9c 57 80 00 00 	movabs $0x80579c,%rdi
+  803e12:	00 00 00 
+  803e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e1a:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  803e21:	00 00 00 
+  803e24:	41 ff d0             	call   *%r8
+
+0000000000803e27 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e27:	55                   	push   %rbp
+  803e28:	48 89 e5             	mov    %rsp,%rbp
+  803e2b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e2f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e33:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  803e3a:	00 00 00 
+  803e3d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e3f:	85 c0                	test   %eax,%eax
+  803e41:	78 35                	js     803e78 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803e43:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e47:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  803e4e:	00 00 00 
+  803e51:	ff d0                	call   *%rax
+  803e53:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e56:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e5b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e60:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e64:	48 b8 21 16 80 00 00 	movabs $0x801621,%rax
+  803e6b:	00 00 00 
+  803e6e:	ff d0                	call   *%rax
+  803e70:	85 c0                	test   %eax,%eax
+  803e72:	0f 94 c0             	sete   %al
+  803e75:	0f b6 c0             	movzbl %al,%eax
+}
+  803e78:	c9                   	leave
+  803e79:	c3                   	ret
+
+0000000000803e7a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e7a:	48 89 f8             	mov    %rdi,%rax
+  803e7d:	48 c1 e8 27          	shr    $0x27,%rax
+  803e81:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e88:	7f 00 00 
+  803e8b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e8f:	f6 c2 01             	test   $0x1,%dl
+  803e92:	74 6d                	je     803f01 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e94:	48 89 f8             	mov    %rdi,%rax
+  803e97:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e9b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ea2:	7f 00 00 
+  803ea5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ea9:	f6 c2 01             	test   $0x1,%dl
+  803eac:	74 62                	je     803f10 <get_uvpt_entry+0x96>
+  803eae:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803eb5:	7f 00 00 
+  803eb8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ebc:	f6 c2 80             	test   $0x80,%dl
+  803ebf:	75 4f                	jne    803f10 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ec1:	48 89 f8             	mov    %rdi,%rax
+  803ec4:	48 c1 e8 15          	shr    $0x15,%rax
+  803ec8:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ecf:	7f 00 00 
+  803ed2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ed6:	f6 c2 01             	test   $0x1,%dl
+  803ed9:	74 44                	je     803f1f <get_uvpt_entry+0xa5>
+  803edb:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ee2:	7f 00 00 
+  803ee5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ee9:	f6 c2 80             	test   $0x80,%dl
+  803eec:	75 31                	jne    803f1f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803eee:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803ef2:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803ef9:	7f 00 00 
+  803efc:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803f00:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f01:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803f08:	7f 00 00 
+  803f0b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f0f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f10:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f17:	7f 00 00 
+  803f1a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f1e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f1f:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f26:	7f 00 00 
+  803f29:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f2d:	c3                   	ret
+
+0000000000803f2e <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803f2e:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f31:	48 89 f9             	mov    %rdi,%rcx
+  803f34:	48 c1 e9 27          	shr    $0x27,%rcx
+  803f38:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803f3f:	7f 00 00 
+  803f42:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803f46:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f4d:	f6 c1 01             	test   $0x1,%cl
+  803f50:	0f 84 b2 00 00 00    	je     804008 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f56:	48 89 f9             	mov    %rdi,%rcx
+  803f59:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803f5d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f64:	7f 00 00 
+  803f67:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f6b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f72:	40 f6 c6 01          	test   $0x1,%sil
+  803f76:	0f 84 8c 00 00 00    	je     804008 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803f7c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f83:	7f 00 00 
+  803f86:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f8a:	a8 80                	test   $0x80,%al
+  803f8c:	75 7b                	jne    804009 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f8e:	48 89 f9             	mov    %rdi,%rcx
+  803f91:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f95:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f9c:	7f 00 00 
+  803f9f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803fa3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803faa:	40 f6 c6 01          	test   $0x1,%sil
+  803fae:	74 58                	je     804008 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803fb0:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fb7:	7f 00 00 
+  803fba:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fbe:	a8 80                	test   $0x80,%al
+  803fc0:	75 6c                	jne    80402e <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803fc2:	48 89 f9             	mov    %rdi,%rcx
+  803fc5:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803fc9:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803fd0:	7f 00 00 
+  803fd3:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803fd7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803fde:	40 f6 c6 01          	test   $0x1,%sil
+  803fe2:	74 24                	je     804008 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803fe4:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803feb:	7f 00 00 
+  803fee:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ff2:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ff9:	ff ff 7f 
+  803ffc:	48 21 c8             	and    %rcx,%rax
+  803fff:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804005:	48 09 d0             	or     %rdx,%rax
+}
+  804008:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804009:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804010:	7f 00 00 
+  804013:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804017:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80401e:	ff ff 7f 
+  804021:	48 21 c8             	and    %rcx,%rax
+  804024:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80402a:	48 01 d0             	add    %rdx,%rax
+  80402d:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80402e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804035:	7f 00 00 
+  804038:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80403c:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804043:	ff ff 7f 
+  804046:	48 21 c8             	and    %rcx,%rax
+  804049:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80404f:	48 01 d0             	add    %rdx,%rax
+  804052:	c3                   	ret
+
+0000000000804053 <get_prot>:
+
+int
+get_prot(void *va) {
+  804053:	55                   	push   %rbp
+  804054:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804057:	48 b8 7a 3e 80 00 00 	movabs $0x803e7a,%rax
+  80405e:	00 00 00 
+  804061:	ff d0                	call   *%rax
+  804063:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804066:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80406b:	89 c1                	mov    %eax,%ecx
+  80406d:	83 c9 04             	or     $0x4,%ecx
+  804070:	f6 c2 01             	test   $0x1,%dl
+  804073:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804076:	89 c1                	mov    %eax,%ecx
+  804078:	83 c9 02             	or     $0x2,%ecx
+  80407b:	f6 c2 02             	test   $0x2,%dl
+  80407e:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804081:	89 c1                	mov    %eax,%ecx
+  804083:	83 c9 01             	or     $0x1,%ecx
+  804086:	48 85 d2             	test   %rdx,%rdx
+  804089:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80408c:	89 c1                	mov    %eax,%ecx
+  80408e:	83 c9 40             	or     $0x40,%ecx
+  804091:	f6 c6 04             	test   $0x4,%dh
+  804094:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804097:	5d                   	pop    %rbp
+  804098:	c3                   	ret
+
+0000000000804099 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804099:	55                   	push   %rbp
+  80409a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80409d:	48 b8 7a 3e 80 00 00 	movabs $0x803e7a,%rax
+  8040a4:	00 00 00 
+  8040a7:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040a9:	48 c1 e8 06          	shr    $0x6,%rax
+  8040ad:	83 e0 01             	and    $0x1,%eax
+}
+  8040b0:	5d                   	pop    %rbp
+  8040b1:	c3                   	ret
+
+00000000008040b2 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040b2:	55                   	push   %rbp
+  8040b3:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040b6:	48 b8 7a 3e 80 00 00 	movabs $0x803e7a,%rax
+  8040bd:	00 00 00 
+  8040c0:	ff d0                	call   *%rax
+  8040c2:	83 e0 01             	and    $0x1,%eax
+}
+  8040c5:	5d                   	pop    %rbp
+  8040c6:	c3                   	ret
+
+00000000008040c7 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8040c7:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8040ce:	7f 00 00 
+  8040d1:	a8 01                	test   $0x1,%al
+  8040d3:	75 06                	jne    8040db <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8040d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040da:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8040db:	55                   	push   %rbp
+  8040dc:	48 89 e5             	mov    %rsp,%rbp
+  8040df:	41 57                	push   %r15
+  8040e1:	41 56                	push   %r14
+  8040e3:	41 55                	push   %r13
+  8040e5:	41 54                	push   %r12
+  8040e7:	53                   	push   %rbx
+  8040e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8040ec:	49 89 fe             	mov    %rdi,%r14
+  8040ef:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8040f2:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8040f9:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8040fa:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804101:	7f 00 00 
+  804104:	e9 81 00 00 00       	jmp    80418a <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804109:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804110:	49 39 dd             	cmp    %rbx,%r13
+  804113:	74 2b                	je     804140 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804115:	48 89 d8             	mov    %rbx,%rax
+  804118:	48 c1 e8 0c          	shr    $0xc,%rax
+  80411c:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804120:	f6 c2 01             	test   $0x1,%dl
+  804123:	74 e4                	je     804109 <foreach_shared_region+0x42>
+  804125:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804129:	f6 c4 04             	test   $0x4,%ah
+  80412c:	74 db                	je     804109 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  80412e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804135:	4c 89 fa             	mov    %r15,%rdx
+  804138:	48 89 df             	mov    %rbx,%rdi
+  80413b:	41 ff d6             	call   *%r14
+  80413e:	eb c9                	jmp    804109 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804140:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804147:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  80414b:	74 22                	je     80416f <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  80414d:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804154:	48 89 d8             	mov    %rbx,%rax
+  804157:	48 c1 e8 15          	shr    $0x15,%rax
+  80415b:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804162:	7f 00 00 
+  804165:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804169:	a8 01                	test   $0x1,%al
+  80416b:	74 d3                	je     804140 <foreach_shared_region+0x79>
+  80416d:	eb a6                	jmp    804115 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  80416f:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804176:	40 
+  804177:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80417b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804182:	00 00 00 
+  804185:	48 39 c1             	cmp    %rax,%rcx
+  804188:	74 31                	je     8041bb <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  80418a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80418e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804192:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804199:	7f 00 00 
+  80419c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041a0:	a8 01                	test   $0x1,%al
+  8041a2:	74 cb                	je     80416f <foreach_shared_region+0xa8>
+  8041a4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041a8:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8041af:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8041b5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8041b9:	eb 92                	jmp    80414d <foreach_shared_region+0x86>
+}
+  8041bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c0:	48 83 c4 18          	add    $0x18,%rsp
+  8041c4:	5b                   	pop    %rbx
+  8041c5:	41 5c                	pop    %r12
+  8041c7:	41 5d                	pop    %r13
+  8041c9:	41 5e                	pop    %r14
+  8041cb:	41 5f                	pop    %r15
+  8041cd:	5d                   	pop    %rbp
+  8041ce:	c3                   	ret
+
+00000000008041cf <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8041cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d4:	c3                   	ret
+
+00000000008041d5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8041d5:	55                   	push   %rbp
+  8041d6:	48 89 e5             	mov    %rsp,%rbp
+  8041d9:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8041dc:	48 be cc 57 80 00 00 	movabs $0x8057cc,%rsi
+  8041e3:	00 00 00 
+  8041e6:	48 b8 ed 0e 80 00 00 	movabs $0x800eed,%rax
+  8041ed:	00 00 00 
+  8041f0:	ff d0                	call   *%rax
+    return 0;
+}
+  8041f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f7:	5d                   	pop    %rbp
+  8041f8:	c3                   	ret
+
+00000000008041f9 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8041f9:	55                   	push   %rbp
+  8041fa:	48 89 e5             	mov    %rsp,%rbp
+  8041fd:	41 57                	push   %r15
+  8041ff:	41 56                	push   %r14
+  804201:	41 55                	push   %r13
+  804203:	41 54                	push   %r12
+  804205:	53                   	push   %rbx
+  804206:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80420d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804214:	48 85 d2             	test   %rdx,%rdx
+  804217:	74 7a                	je     804293 <devcons_write+0x9a>
+  804219:	49 89 d6             	mov    %rdx,%r14
+  80421c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804222:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804227:	49 bf 7b 12 80 00 00 	movabs $0x80127b,%r15
+  80422e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804231:	4c 89 f3             	mov    %r14,%rbx
+  804234:	48 29 f3             	sub    %rsi,%rbx
+  804237:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80423c:	48 39 c3             	cmp    %rax,%rbx
+  80423f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804243:	4c 63 eb             	movslq %ebx,%r13
+  804246:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80424d:	48 01 c6             	add    %rax,%rsi
+  804250:	4c 89 ea             	mov    %r13,%rdx
+  804253:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80425a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80425d:	4c 89 ee             	mov    %r13,%rsi
+  804260:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804267:	48 b8 c4 14 80 00 00 	movabs $0x8014c4,%rax
+  80426e:	00 00 00 
+  804271:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804273:	41 01 dc             	add    %ebx,%r12d
+  804276:	49 63 f4             	movslq %r12d,%rsi
+  804279:	4c 39 f6             	cmp    %r14,%rsi
+  80427c:	72 b3                	jb     804231 <devcons_write+0x38>
+    return res;
+  80427e:	49 63 c4             	movslq %r12d,%rax
+}
+  804281:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804288:	5b                   	pop    %rbx
+  804289:	41 5c                	pop    %r12
+  80428b:	41 5d                	pop    %r13
+  80428d:	41 5e                	pop    %r14
+  80428f:	41 5f                	pop    %r15
+  804291:	5d                   	pop    %rbp
+  804292:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804293:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804299:	eb e3                	jmp    80427e <devcons_write+0x85>
+
+000000000080429b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80429b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80429e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042a3:	48 85 c0             	test   %rax,%rax
+  8042a6:	74 55                	je     8042fd <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042a8:	55                   	push   %rbp
+  8042a9:	48 89 e5             	mov    %rsp,%rbp
+  8042ac:	41 55                	push   %r13
+  8042ae:	41 54                	push   %r12
+  8042b0:	53                   	push   %rbx
+  8042b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8042b5:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8042b8:	48 bb f1 14 80 00 00 	movabs $0x8014f1,%rbx
+  8042bf:	00 00 00 
+  8042c2:	49 bc be 15 80 00 00 	movabs $0x8015be,%r12
+  8042c9:	00 00 00 
+  8042cc:	eb 03                	jmp    8042d1 <devcons_read+0x36>
+  8042ce:	41 ff d4             	call   *%r12
+  8042d1:	ff d3                	call   *%rbx
+  8042d3:	85 c0                	test   %eax,%eax
+  8042d5:	74 f7                	je     8042ce <devcons_read+0x33>
+    if (c < 0) return c;
+  8042d7:	48 63 d0             	movslq %eax,%rdx
+  8042da:	78 13                	js     8042ef <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8042dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042e1:	83 f8 04             	cmp    $0x4,%eax
+  8042e4:	74 09                	je     8042ef <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8042e6:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8042ea:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8042ef:	48 89 d0             	mov    %rdx,%rax
+  8042f2:	48 83 c4 08          	add    $0x8,%rsp
+  8042f6:	5b                   	pop    %rbx
+  8042f7:	41 5c                	pop    %r12
+  8042f9:	41 5d                	pop    %r13
+  8042fb:	5d                   	pop    %rbp
+  8042fc:	c3                   	ret
+  8042fd:	48 89 d0             	mov    %rdx,%rax
+  804300:	c3                   	ret
+
+0000000000804301 <cputchar>:
+cputchar(int ch) {
+  804301:	55                   	push   %rbp
+  804302:	48 89 e5             	mov    %rsp,%rbp
+  804305:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804309:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80430d:	be 01 00 00 00       	mov    $0x1,%esi
+  804312:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804316:	48 b8 c4 14 80 00 00 	movabs $0x8014c4,%rax
+  80431d:	00 00 00 
+  804320:	ff d0                	call   *%rax
+}
+  804322:	c9                   	leave
+  804323:	c3                   	ret
+
+0000000000804324 <getchar>:
+getchar(void) {
+  804324:	55                   	push   %rbp
+  804325:	48 89 e5             	mov    %rsp,%rbp
+  804328:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80432c:	ba 01 00 00 00       	mov    $0x1,%edx
+  804331:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804335:	bf 00 00 00 00       	mov    $0x0,%edi
+  80433a:	48 b8 e2 24 80 00 00 	movabs $0x8024e2,%rax
+  804341:	00 00 00 
+  804344:	ff d0                	call   *%rax
+  804346:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804348:	85 c0                	test   %eax,%eax
+  80434a:	78 06                	js     804352 <getchar+0x2e>
+  80434c:	74 08                	je     804356 <getchar+0x32>
+  80434e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804352:	89 d0                	mov    %edx,%eax
+  804354:	c9                   	leave
+  804355:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804356:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80435b:	eb f5                	jmp    804352 <getchar+0x2e>
+
+000000000080435d <iscons>:
+iscons(int fdnum) {
+  80435d:	55                   	push   %rbp
+  80435e:	48 89 e5             	mov    %rsp,%rbp
+  804361:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804365:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804369:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  804370:	00 00 00 
+  804373:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804375:	85 c0                	test   %eax,%eax
+  804377:	78 18                	js     804391 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804379:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80437d:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804384:	00 00 00 
+  804387:	8b 00                	mov    (%rax),%eax
+  804389:	39 02                	cmp    %eax,(%rdx)
+  80438b:	0f 94 c0             	sete   %al
+  80438e:	0f b6 c0             	movzbl %al,%eax
+}
+  804391:	c9                   	leave
+  804392:	c3                   	ret
+
+0000000000804393 <opencons>:
+opencons(void) {
+  804393:	55                   	push   %rbp
+  804394:	48 89 e5             	mov    %rsp,%rbp
+  804397:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80439b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80439f:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  8043a6:	00 00 00 
+  8043a9:	ff d0                	call   *%rax
+  8043ab:	85 c0                	test   %eax,%eax
+  8043ad:	78 49                	js     8043f8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8043af:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043b9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8043bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043c2:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  8043c9:	00 00 00 
+  8043cc:	ff d0                	call   *%rax
+  8043ce:	85 c0                	test   %eax,%eax
+  8043d0:	78 26                	js     8043f8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8043d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043d6:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8043dd:	00 00 
+  8043df:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8043e1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043e5:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8043ec:	48 b8 71 21 80 00 00 	movabs $0x802171,%rax
+  8043f3:	00 00 00 
+  8043f6:	ff d0                	call   *%rax
+}
+  8043f8:	c9                   	leave
+  8043f9:	c3                   	ret
+
+00000000008043fa <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8043fa:	55                   	push   %rbp
+  8043fb:	48 89 e5             	mov    %rsp,%rbp
+  8043fe:	41 55                	push   %r13
+  804400:	41 54                	push   %r12
+  804402:	53                   	push   %rbx
+  804403:	48 83 ec 08          	sub    $0x8,%rsp
+  804407:	49 89 fc             	mov    %rdi,%r12
+  80440a:	48 89 f7             	mov    %rsi,%rdi
+  80440d:	48 89 d3             	mov    %rdx,%rbx
+  804410:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804413:	48 85 f6             	test   %rsi,%rsi
+  804416:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80441d:	00 00 00 
+  804420:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804424:	be 00 10 00 00       	mov    $0x1000,%esi
+  804429:	48 85 d2             	test   %rdx,%rdx
+  80442c:	74 03                	je     804431 <ipc_recv+0x37>
+  80442e:	48 8b 32             	mov    (%rdx),%rsi
+  804431:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  804438:	00 00 00 
+  80443b:	ff d0                	call   *%rax
+    if (errno) {
+  80443d:	85 c0                	test   %eax,%eax
+  80443f:	74 1c                	je     80445d <ipc_recv+0x63>
+        if (from_env_store)
+  804441:	4d 85 e4             	test   %r12,%r12
+  804444:	74 08                	je     80444e <ipc_recv+0x54>
+            *from_env_store = 0;
+  804446:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80444d:	00 
+
+        if (perm_store)
+  80444e:	4d 85 ed             	test   %r13,%r13
+  804451:	74 74                	je     8044c7 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804453:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80445a:	00 
+  80445b:	eb 6a                	jmp    8044c7 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80445d:	4d 85 e4             	test   %r12,%r12
+  804460:	74 14                	je     804476 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804462:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804469:	00 00 00 
+  80446c:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804472:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804476:	48 85 db             	test   %rbx,%rbx
+  804479:	74 23                	je     80449e <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80447b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804482:	00 00 00 
+  804485:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80448b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804490:	85 c9                	test   %ecx,%ecx
+  804492:	74 07                	je     80449b <ipc_recv+0xa1>
+  804494:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80449b:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80449e:	4d 85 ed             	test   %r13,%r13
+  8044a1:	74 14                	je     8044b7 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8044a3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044aa:	00 00 00 
+  8044ad:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8044b3:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8044b7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044be:	00 00 00 
+  8044c1:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8044c7:	48 83 c4 08          	add    $0x8,%rsp
+  8044cb:	5b                   	pop    %rbx
+  8044cc:	41 5c                	pop    %r12
+  8044ce:	41 5d                	pop    %r13
+  8044d0:	5d                   	pop    %rbp
+  8044d1:	c3                   	ret
+
+00000000008044d2 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8044d2:	55                   	push   %rbp
+  8044d3:	48 89 e5             	mov    %rsp,%rbp
+  8044d6:	41 55                	push   %r13
+  8044d8:	41 54                	push   %r12
+  8044da:	53                   	push   %rbx
+  8044db:	48 83 ec 08          	sub    $0x8,%rsp
+  8044df:	49 89 fc             	mov    %rdi,%r12
+  8044e2:	48 89 f7             	mov    %rsi,%rdi
+  8044e5:	48 89 d3             	mov    %rdx,%rbx
+  8044e8:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8044eb:	48 85 f6             	test   %rsi,%rsi
+  8044ee:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044f5:	00 00 00 
+  8044f8:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8044fc:	be 00 10 00 00       	mov    $0x1000,%esi
+  804501:	48 85 d2             	test   %rdx,%rdx
+  804504:	74 03                	je     804509 <ipc_try_recv+0x37>
+  804506:	48 8b 32             	mov    (%rdx),%rsi
+  804509:	48 b8 63 1a 80 00 00 	movabs $0x801a63,%rax
+  804510:	00 00 00 
+  804513:	ff d0                	call   *%rax
+    if (errno) {
+  804515:	85 c0                	test   %eax,%eax
+  804517:	75 75                	jne    80458e <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804519:	4d 85 e4             	test   %r12,%r12
+  80451c:	74 14                	je     804532 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  80451e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804525:	00 00 00 
+  804528:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80452e:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804532:	48 85 db             	test   %rbx,%rbx
+  804535:	74 23                	je     80455a <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804537:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80453e:	00 00 00 
+  804541:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80454c:	85 c9                	test   %ecx,%ecx
+  80454e:	74 07                	je     804557 <ipc_try_recv+0x85>
+  804550:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804557:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80455a:	4d 85 ed             	test   %r13,%r13
+  80455d:	74 14                	je     804573 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80455f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804566:	00 00 00 
+  804569:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80456f:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804573:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80457a:	00 00 00 
+  80457d:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804583:	48 83 c4 08          	add    $0x8,%rsp
+  804587:	5b                   	pop    %rbx
+  804588:	41 5c                	pop    %r12
+  80458a:	41 5d                	pop    %r13
+  80458c:	5d                   	pop    %rbp
+  80458d:	c3                   	ret
+        if (from_env_store)
+  80458e:	4d 85 e4             	test   %r12,%r12
+  804591:	74 08                	je     80459b <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804593:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80459a:	00 
+        if (perm_store)
+  80459b:	4d 85 ed             	test   %r13,%r13
+  80459e:	74 e3                	je     804583 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8045a0:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045a7:	00 
+  8045a8:	eb d9                	jmp    804583 <ipc_try_recv+0xb1>
+
+00000000008045aa <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045aa:	55                   	push   %rbp
+  8045ab:	48 89 e5             	mov    %rsp,%rbp
+  8045ae:	41 57                	push   %r15
+  8045b0:	41 56                	push   %r14
+  8045b2:	41 55                	push   %r13
+  8045b4:	41 54                	push   %r12
+  8045b6:	53                   	push   %rbx
+  8045b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8045bb:	41 89 fd             	mov    %edi,%r13d
+  8045be:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8045c1:	48 89 d3             	mov    %rdx,%rbx
+  8045c4:	49 89 cc             	mov    %rcx,%r12
+  8045c7:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8045cb:	48 85 d2             	test   %rdx,%rdx
+  8045ce:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045d5:	00 00 00 
+  8045d8:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8045dc:	49 be ce 19 80 00 00 	movabs $0x8019ce,%r14
+  8045e3:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8045e6:	49 bf be 15 80 00 00 	movabs $0x8015be,%r15
+  8045ed:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8045f0:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8045f3:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8045f7:	4c 89 e1             	mov    %r12,%rcx
+  8045fa:	48 89 da             	mov    %rbx,%rdx
+  8045fd:	44 89 ef             	mov    %r13d,%edi
+  804600:	41 ff d6             	call   *%r14
+  804603:	85 c0                	test   %eax,%eax
+  804605:	74 37                	je     80463e <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804607:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80460a:	75 05                	jne    804611 <ipc_send+0x67>
+        sys_yield();
+  80460c:	41 ff d7             	call   *%r15
+  80460f:	eb df                	jmp    8045f0 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804611:	89 c1                	mov    %eax,%ecx
+  804613:	48 ba d8 57 80 00 00 	movabs $0x8057d8,%rdx
+  80461a:	00 00 00 
+  80461d:	be 65 00 00 00       	mov    $0x65,%esi
+  804622:	48 bf f3 57 80 00 00 	movabs $0x8057f3,%rdi
+  804629:	00 00 00 
+  80462c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804631:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  804638:	00 00 00 
+  80463b:	41 ff d0             	call   *%r8
+    }
+}
+  80463e:	48 83 c4 18          	add    $0x18,%rsp
+  804642:	5b                   	pop    %rbx
+  804643:	41 5c                	pop    %r12
+  804645:	41 5d                	pop    %r13
+  804647:	41 5e                	pop    %r14
+  804649:	41 5f                	pop    %r15
+  80464b:	5d                   	pop    %rbp
+  80464c:	c3                   	ret
+
+000000000080464d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80464d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804652:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804659:	00 00 00 
+  80465c:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804663:	48 01 ca             	add    %rcx,%rdx
+  804666:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80466c:	39 fa                	cmp    %edi,%edx
+  80466e:	74 12                	je     804682 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804670:	48 83 c0 01          	add    $0x1,%rax
+  804674:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80467a:	75 e0                	jne    80465c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80467c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804681:	c3                   	ret
+            return envs[i].env_id;
+  804682:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804689:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804690:	00 00 00 
+  804693:	48 01 d0             	add    %rdx,%rax
+  804696:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80469c:	c3                   	ret
+
+000000000080469d <__text_end>:
+  80469d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a4:	00 00 00 
+  8046a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ae:	00 00 00 
+  8046b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b8:	00 00 00 
+  8046bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c2:	00 00 00 
+  8046c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cc:	00 00 00 
+  8046cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d6:	00 00 00 
+  8046d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e0:	00 00 00 
+  8046e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ea:	00 00 00 
+  8046ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f4:	00 00 00 
+  8046f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fe:	00 00 00 
+  804701:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804708:	00 00 00 
+  80470b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804712:	00 00 00 
+  804715:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471c:	00 00 00 
+  80471f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804726:	00 00 00 
+  804729:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804730:	00 00 00 
+  804733:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473a:	00 00 00 
+  80473d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804744:	00 00 00 
+  804747:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474e:	00 00 00 
+  804751:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804758:	00 00 00 
+  80475b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804762:	00 00 00 
+  804765:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476c:	00 00 00 
+  80476f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804776:	00 00 00 
+  804779:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804780:	00 00 00 
+  804783:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478a:	00 00 00 
+  80478d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804794:	00 00 00 
+  804797:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479e:	00 00 00 
+  8047a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a8:	00 00 00 
+  8047ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b2:	00 00 00 
+  8047b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bc:	00 00 00 
+  8047bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c6:	00 00 00 
+  8047c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d0:	00 00 00 
+  8047d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047da:	00 00 00 
+  8047dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e4:	00 00 00 
+  8047e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ee:	00 00 00 
+  8047f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f8:	00 00 00 
+  8047fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804802:	00 00 00 
+  804805:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480c:	00 00 00 
+  80480f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804816:	00 00 00 
+  804819:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804820:	00 00 00 
+  804823:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482a:	00 00 00 
+  80482d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804834:	00 00 00 
+  804837:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483e:	00 00 00 
+  804841:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804848:	00 00 00 
+  80484b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804852:	00 00 00 
+  804855:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485c:	00 00 00 
+  80485f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804866:	00 00 00 
+  804869:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804870:	00 00 00 
+  804873:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487a:	00 00 00 
+  80487d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804884:	00 00 00 
+  804887:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488e:	00 00 00 
+  804891:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804898:	00 00 00 
+  80489b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a2:	00 00 00 
+  8048a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ac:	00 00 00 
+  8048af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b6:	00 00 00 
+  8048b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c0:	00 00 00 
+  8048c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ca:	00 00 00 
+  8048cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d4:	00 00 00 
+  8048d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048de:	00 00 00 
+  8048e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e8:	00 00 00 
+  8048eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f2:	00 00 00 
+  8048f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fc:	00 00 00 
+  8048ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804906:	00 00 00 
+  804909:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804910:	00 00 00 
+  804913:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491a:	00 00 00 
+  80491d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804924:	00 00 00 
+  804927:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492e:	00 00 00 
+  804931:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804938:	00 00 00 
+  80493b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804942:	00 00 00 
+  804945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494c:	00 00 00 
+  80494f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804956:	00 00 00 
+  804959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804960:	00 00 00 
+  804963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496a:	00 00 00 
+  80496d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804974:	00 00 00 
+  804977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497e:	00 00 00 
+  804981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804988:	00 00 00 
+  80498b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804992:	00 00 00 
+  804995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499c:	00 00 00 
+  80499f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a6:	00 00 00 
+  8049a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b0:	00 00 00 
+  8049b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ba:	00 00 00 
+  8049bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c4:	00 00 00 
+  8049c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ce:	00 00 00 
+  8049d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d8:	00 00 00 
+  8049db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e2:	00 00 00 
+  8049e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ec:	00 00 00 
+  8049ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f6:	00 00 00 
+  8049f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a00:	00 00 00 
+  804a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0a:	00 00 00 
+  804a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a14:	00 00 00 
+  804a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1e:	00 00 00 
+  804a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a28:	00 00 00 
+  804a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a32:	00 00 00 
+  804a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3c:	00 00 00 
+  804a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a46:	00 00 00 
+  804a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a50:	00 00 00 
+  804a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5a:	00 00 00 
+  804a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a64:	00 00 00 
+  804a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6e:	00 00 00 
+  804a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a78:	00 00 00 
+  804a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a82:	00 00 00 
+  804a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8c:	00 00 00 
+  804a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a96:	00 00 00 
+  804a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa0:	00 00 00 
+  804aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaa:	00 00 00 
+  804aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab4:	00 00 00 
+  804ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abe:	00 00 00 
+  804ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac8:	00 00 00 
+  804acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad2:	00 00 00 
+  804ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adc:	00 00 00 
+  804adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae6:	00 00 00 
+  804ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af0:	00 00 00 
+  804af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afa:	00 00 00 
+  804afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b04:	00 00 00 
+  804b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0e:	00 00 00 
+  804b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b18:	00 00 00 
+  804b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b22:	00 00 00 
+  804b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2c:	00 00 00 
+  804b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b36:	00 00 00 
+  804b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b40:	00 00 00 
+  804b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4a:	00 00 00 
+  804b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b54:	00 00 00 
+  804b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5e:	00 00 00 
+  804b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b68:	00 00 00 
+  804b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b72:	00 00 00 
+  804b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7c:	00 00 00 
+  804b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b86:	00 00 00 
+  804b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b90:	00 00 00 
+  804b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9a:	00 00 00 
+  804b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba4:	00 00 00 
+  804ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bae:	00 00 00 
+  804bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb8:	00 00 00 
+  804bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc2:	00 00 00 
+  804bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcc:	00 00 00 
+  804bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd6:	00 00 00 
+  804bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be0:	00 00 00 
+  804be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bea:	00 00 00 
+  804bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf4:	00 00 00 
+  804bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfe:	00 00 00 
+  804c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c08:	00 00 00 
+  804c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c12:	00 00 00 
+  804c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1c:	00 00 00 
+  804c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c26:	00 00 00 
+  804c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c30:	00 00 00 
+  804c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3a:	00 00 00 
+  804c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c44:	00 00 00 
+  804c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4e:	00 00 00 
+  804c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c58:	00 00 00 
+  804c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c62:	00 00 00 
+  804c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6c:	00 00 00 
+  804c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c76:	00 00 00 
+  804c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c80:	00 00 00 
+  804c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8a:	00 00 00 
+  804c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c94:	00 00 00 
+  804c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9e:	00 00 00 
+  804ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca8:	00 00 00 
+  804cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb2:	00 00 00 
+  804cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbc:	00 00 00 
+  804cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc6:	00 00 00 
+  804cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd0:	00 00 00 
+  804cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cda:	00 00 00 
+  804cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce4:	00 00 00 
+  804ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cee:	00 00 00 
+  804cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf8:	00 00 00 
+  804cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d02:	00 00 00 
+  804d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0c:	00 00 00 
+  804d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d16:	00 00 00 
+  804d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d20:	00 00 00 
+  804d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2a:	00 00 00 
+  804d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d34:	00 00 00 
+  804d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3e:	00 00 00 
+  804d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d48:	00 00 00 
+  804d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d52:	00 00 00 
+  804d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5c:	00 00 00 
+  804d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d66:	00 00 00 
+  804d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d70:	00 00 00 
+  804d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7a:	00 00 00 
+  804d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d84:	00 00 00 
+  804d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8e:	00 00 00 
+  804d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d98:	00 00 00 
+  804d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da2:	00 00 00 
+  804da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dac:	00 00 00 
+  804daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db6:	00 00 00 
+  804db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc0:	00 00 00 
+  804dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dca:	00 00 00 
+  804dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd4:	00 00 00 
+  804dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dde:	00 00 00 
+  804de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de8:	00 00 00 
+  804deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df2:	00 00 00 
+  804df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfc:	00 00 00 
+  804dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e06:	00 00 00 
+  804e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e10:	00 00 00 
+  804e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1a:	00 00 00 
+  804e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e24:	00 00 00 
+  804e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2e:	00 00 00 
+  804e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e38:	00 00 00 
+  804e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e42:	00 00 00 
+  804e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4c:	00 00 00 
+  804e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e56:	00 00 00 
+  804e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e60:	00 00 00 
+  804e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6a:	00 00 00 
+  804e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e74:	00 00 00 
+  804e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7e:	00 00 00 
+  804e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e88:	00 00 00 
+  804e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e92:	00 00 00 
+  804e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9c:	00 00 00 
+  804e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea6:	00 00 00 
+  804ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb0:	00 00 00 
+  804eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eba:	00 00 00 
+  804ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec4:	00 00 00 
+  804ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ece:	00 00 00 
+  804ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed8:	00 00 00 
+  804edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee2:	00 00 00 
+  804ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eec:	00 00 00 
+  804eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef6:	00 00 00 
+  804ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f00:	00 00 00 
+  804f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0a:	00 00 00 
+  804f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f14:	00 00 00 
+  804f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1e:	00 00 00 
+  804f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f28:	00 00 00 
+  804f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f32:	00 00 00 
+  804f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3c:	00 00 00 
+  804f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f46:	00 00 00 
+  804f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f50:	00 00 00 
+  804f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5a:	00 00 00 
+  804f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f64:	00 00 00 
+  804f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6e:	00 00 00 
+  804f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f78:	00 00 00 
+  804f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f82:	00 00 00 
+  804f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8c:	00 00 00 
+  804f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f96:	00 00 00 
+  804f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa0:	00 00 00 
+  804fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faa:	00 00 00 
+  804fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb4:	00 00 00 
+  804fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbe:	00 00 00 
+  804fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc8:	00 00 00 
+  804fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd2:	00 00 00 
+  804fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdc:	00 00 00 
+  804fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe6:	00 00 00 
+  804fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff0:	00 00 00 
+  804ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffa:	00 00 00 
+  804ffd:	0f 1f 00             	nopl   (%rax)
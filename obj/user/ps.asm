@@ -0,0 +1,8316 @@
+
+obj/user/ps:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2e 03 00 00       	call   800351 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <usage>:
+        [ENV_TYPE_FS] = "fs",
+        [ENV_TYPE_VS] = "vs",
+};
+
+void
+usage(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: ps [-t] [-n count]\n");
+  800029:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba ca 04 80 00 00 	movabs $0x8004ca,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+    exit();
+  800044:	48 b8 fa 03 80 00 00 	movabs $0x8003fa,%rax
+  80004b:	00 00 00 
+  80004e:	ff d0                	call   *%rax
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <umain>:
+    cprintf("Total: private %zuK, shared %zuK, page tables %zuK\n",
+            total_private / KB, total_shared / KB, total_pt * (size_t)PAGE_SIZE / KB);
+}
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 83 ec 78          	sub    $0x78,%rsp
+  800063:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+    int i, repeat = 0, count = -1;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  800069:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  80006d:	48 8d bd 7c ff ff ff 	lea    -0x84(%rbp),%rdi
+  800074:	48 b8 b8 1f 80 00 00 	movabs $0x801fb8,%rax
+  80007b:	00 00 00 
+  80007e:	ff d0                	call   *%rax
+    int i, repeat = 0, count = -1;
+  800080:	41 bd ff ff ff ff    	mov    $0xffffffff,%r13d
+  800086:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while ((i = argnext(&args)) >= 0) {
+  80008b:	49 bc e5 1f 80 00 00 	movabs $0x801fe5,%r12
+  800092:	00 00 00 
+  800095:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  800099:	41 ff d4             	call   *%r12
+  80009c:	85 c0                	test   %eax,%eax
+  80009e:	78 62                	js     800102 <umain+0xb0>
+        if (i == 't')
+  8000a0:	83 f8 74             	cmp    $0x74,%eax
+  8000a3:	75 07                	jne    8000ac <umain+0x5a>
+            repeat = 1;
+  8000a5:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8000aa:	eb e9                	jmp    800095 <umain+0x43>
+        else if (i == 'n' && argvalue(&args))
+  8000ac:	83 f8 6e             	cmp    $0x6e,%eax
+  8000af:	74 0e                	je     8000bf <umain+0x6d>
+            count = strtol(argvalue(&args), NULL, 0);
+        else
+            usage();
+  8000b1:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b8:	00 00 00 
+  8000bb:	ff d0                	call   *%rax
+  8000bd:	eb d6                	jmp    800095 <umain+0x43>
+        else if (i == 'n' && argvalue(&args))
+  8000bf:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8000c3:	48 b8 16 21 80 00 00 	movabs $0x802116,%rax
+  8000ca:	00 00 00 
+  8000cd:	ff d0                	call   *%rax
+  8000cf:	48 85 c0             	test   %rax,%rax
+  8000d2:	74 dd                	je     8000b1 <umain+0x5f>
+            count = strtol(argvalue(&args), NULL, 0);
+  8000d4:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8000d8:	48 b8 16 21 80 00 00 	movabs $0x802116,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+  8000e4:	48 89 c7             	mov    %rax,%rdi
+  8000e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8000f1:	48 b8 47 13 80 00 00 	movabs $0x801347,%rax
+  8000f8:	00 00 00 
+  8000fb:	ff d0                	call   *%rax
+  8000fd:	41 89 c5             	mov    %eax,%r13d
+  800100:	eb 93                	jmp    800095 <umain+0x43>
+    }
+
+    if (!repeat) count = 1;
+  800102:	85 db                	test   %ebx,%ebx
+  800104:	b8 01 00 00 00       	mov    $0x1,%eax
+  800109:	44 0f 44 e8          	cmove  %eax,%r13d
+        if (env->env_status == ENV_FREE) continue;
+  80010d:	49 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%r15
+  800114:	00 00 00 
+  800117:	e9 68 01 00 00       	jmp    800284 <umain+0x232>
+    for (size_t i = 0; i < NENV; i++) {
+  80011c:	48 83 c3 01          	add    $0x1,%rbx
+  800120:	48 81 fb 00 04 00 00 	cmp    $0x400,%rbx
+  800127:	0f 84 f0 00 00 00    	je     80021d <umain+0x1cb>
+        if (env->env_status == ENV_FREE) continue;
+  80012d:	48 69 c3 68 01 00 00 	imul   $0x168,%rbx,%rax
+  800134:	4c 01 f8             	add    %r15,%rax
+  800137:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  80013d:	85 c0                	test   %eax,%eax
+  80013f:	74 db                	je     80011c <umain+0xca>
+        struct MemoryStat stat = *(struct MemoryStat *)&env->address_space.stat;
+  800141:	48 69 c3 68 01 00 00 	imul   $0x168,%rbx,%rax
+  800148:	4c 01 f8             	add    %r15,%rax
+  80014b:	4c 8b b0 00 01 00 00 	mov    0x100(%rax),%r14
+  800152:	4c 89 75 88          	mov    %r14,-0x78(%rbp)
+  800156:	4c 8b a8 08 01 00 00 	mov    0x108(%rax),%r13
+  80015d:	4c 89 6d 90          	mov    %r13,-0x70(%rbp)
+  800161:	48 8b 88 10 01 00 00 	mov    0x110(%rax),%rcx
+  800168:	48 89 4d 98          	mov    %rcx,-0x68(%rbp)
+  80016c:	4c 8b a0 18 01 00 00 	mov    0x118(%rax),%r12
+  800173:	4c 89 65 a0          	mov    %r12,-0x60(%rbp)
+  800177:	4c 8b 80 20 01 00 00 	mov    0x120(%rax),%r8
+  80017e:	4c 89 45 a8          	mov    %r8,-0x58(%rbp)
+                type_names[env->env_type], status_names[env->env_status], env->env_runs,
+  800182:	44 8b 88 d8 00 00 00 	mov    0xd8(%rax),%r9d
+  800189:	44 8b 90 d4 00 00 00 	mov    0xd4(%rax),%r10d
+  800190:	8b b8 d0 00 00 00    	mov    0xd0(%rax),%edi
+                env->env_id, env->env_parent_id,
+  800196:	8b 90 cc 00 00 00    	mov    0xcc(%rax),%edx
+  80019c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("%08x %08x %-6s %-8s %6u %9zu %9zu %9zu %5zu %7zu\n",
+  8001a2:	44 89 d0             	mov    %r10d,%eax
+  8001a5:	89 ff                	mov    %edi,%edi
+  8001a7:	49 bb 40 51 80 00 00 	movabs $0x805140,%r11
+  8001ae:	00 00 00 
+  8001b1:	49 8b 3c fb          	mov    (%r11,%rdi,8),%rdi
+  8001b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8001b9:	41 50                	push   %r8
+  8001bb:	41 54                	push   %r12
+  8001bd:	48 c1 e9 0a          	shr    $0xa,%rcx
+  8001c1:	51                   	push   %rcx
+  8001c2:	4c 89 e9             	mov    %r13,%rcx
+  8001c5:	48 c1 e9 0a          	shr    $0xa,%rcx
+  8001c9:	51                   	push   %rcx
+  8001ca:	4c 89 f1             	mov    %r14,%rcx
+  8001cd:	48 c1 e9 0a          	shr    $0xa,%rcx
+  8001d1:	51                   	push   %rcx
+  8001d2:	48 b9 80 51 80 00 00 	movabs $0x805180,%rcx
+  8001d9:	00 00 00 
+  8001dc:	4c 8b 04 c1          	mov    (%rcx,%rax,8),%r8
+  8001e0:	48 89 f9             	mov    %rdi,%rcx
+  8001e3:	48 bf c8 50 80 00 00 	movabs $0x8050c8,%rdi
+  8001ea:	00 00 00 
+  8001ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f2:	49 ba ca 04 80 00 00 	movabs $0x8004ca,%r10
+  8001f9:	00 00 00 
+  8001fc:	41 ff d2             	call   *%r10
+        total_private += stat.private_bytes;
+  8001ff:	4c 01 b5 70 ff ff ff 	add    %r14,-0x90(%rbp)
+        total_shared += stat.shared_bytes;
+  800206:	4c 01 ad 68 ff ff ff 	add    %r13,-0x98(%rbp)
+        total_pt += stat.pt_pages;
+  80020d:	4c 01 a5 60 ff ff ff 	add    %r12,-0xa0(%rbp)
+  800214:	48 83 c4 30          	add    $0x30,%rsp
+  800218:	e9 ff fe ff ff       	jmp    80011c <umain+0xca>
+            total_private / KB, total_shared / KB, total_pt * (size_t)PAGE_SIZE / KB);
+  80021d:	44 8b ad 78 ff ff ff 	mov    -0x88(%rbp),%r13d
+  800224:	48 8b 8d 60 ff ff ff 	mov    -0xa0(%rbp),%rcx
+  80022b:	48 c1 e1 0c          	shl    $0xc,%rcx
+    cprintf("Total: private %zuK, shared %zuK, page tables %zuK\n",
+  80022f:	48 c1 e9 0a          	shr    $0xa,%rcx
+  800233:	48 8b 95 68 ff ff ff 	mov    -0x98(%rbp),%rdx
+  80023a:	48 c1 ea 0a          	shr    $0xa,%rdx
+  80023e:	48 8b b5 70 ff ff ff 	mov    -0x90(%rbp),%rsi
+  800245:	48 c1 ee 0a          	shr    $0xa,%rsi
+  800249:	48 bf 00 51 80 00 00 	movabs $0x805100,%rdi
+  800250:	00 00 00 
+  800253:	b8 00 00 00 00       	mov    $0x0,%eax
+  800258:	48 bb ca 04 80 00 00 	movabs $0x8004ca,%rbx
+  80025f:	00 00 00 
+  800262:	ff d3                	call   *%rbx
+
+    /* In top mode refresh once a second until count is exhausted */
+    for (;;) {
+        show();
+        if (count > 0 && !--count) break;
+  800264:	45 85 ed             	test   %r13d,%r13d
+  800267:	7e 0a                	jle    800273 <umain+0x221>
+  800269:	41 83 ed 01          	sub    $0x1,%r13d
+  80026d:	0f 84 cf 00 00 00    	je     800342 <umain+0x2f0>
+        sleep(1000);
+  800273:	bf e8 03 00 00       	mov    $0x3e8,%edi
+  800278:	48 b8 d7 1e 80 00 00 	movabs $0x801ed7,%rax
+  80027f:	00 00 00 
+  800282:	ff d0                	call   *%rax
+    cprintf("%8s %8s %-6s %-8s %6s %9s %9s %9s %5s %7s\n",
+  800284:	48 83 ec 08          	sub    $0x8,%rsp
+  800288:	48 b8 39 50 80 00 00 	movabs $0x805039,%rax
+  80028f:	00 00 00 
+  800292:	50                   	push   %rax
+  800293:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  80029a:	00 00 00 
+  80029d:	50                   	push   %rax
+  80029e:	48 b8 43 50 80 00 00 	movabs $0x805043,%rax
+  8002a5:	00 00 00 
+  8002a8:	50                   	push   %rax
+  8002a9:	48 b8 4b 50 80 00 00 	movabs $0x80504b,%rax
+  8002b0:	00 00 00 
+  8002b3:	50                   	push   %rax
+  8002b4:	48 b8 55 50 80 00 00 	movabs $0x805055,%rax
+  8002bb:	00 00 00 
+  8002be:	50                   	push   %rax
+  8002bf:	49 b9 1b 50 80 00 00 	movabs $0x80501b,%r9
+  8002c6:	00 00 00 
+  8002c9:	49 b8 20 50 80 00 00 	movabs $0x805020,%r8
+  8002d0:	00 00 00 
+  8002d3:	48 b9 27 50 80 00 00 	movabs $0x805027,%rcx
+  8002da:	00 00 00 
+  8002dd:	48 ba 2c 50 80 00 00 	movabs $0x80502c,%rdx
+  8002e4:	00 00 00 
+  8002e7:	48 be 33 50 80 00 00 	movabs $0x805033,%rsi
+  8002ee:	00 00 00 
+  8002f1:	48 bf 98 50 80 00 00 	movabs $0x805098,%rdi
+  8002f8:	00 00 00 
+  8002fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800300:	48 bb ca 04 80 00 00 	movabs $0x8004ca,%rbx
+  800307:	00 00 00 
+  80030a:	ff d3                	call   *%rbx
+  80030c:	48 83 c4 30          	add    $0x30,%rsp
+    size_t total_private = 0, total_shared = 0, total_pt = 0;
+  800310:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  800317:	00 00 00 00 
+  80031b:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  800322:	00 00 00 00 
+  800326:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  80032d:	00 00 00 00 
+    for (size_t i = 0; i < NENV; i++) {
+  800331:	bb 00 00 00 00       	mov    $0x0,%ebx
+        cprintf("%08x %08x %-6s %-8s %6u %9zu %9zu %9zu %5zu %7zu\n",
+  800336:	44 89 ad 78 ff ff ff 	mov    %r13d,-0x88(%rbp)
+  80033d:	e9 eb fd ff ff       	jmp    80012d <umain+0xdb>
+    }
+}
+  800342:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800346:	5b                   	pop    %rbx
+  800347:	41 5c                	pop    %r12
+  800349:	41 5d                	pop    %r13
+  80034b:	41 5e                	pop    %r14
+  80034d:	41 5f                	pop    %r15
+  80034f:	5d                   	pop    %rbp
+  800350:	c3                   	ret
+
+0000000000800351 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800351:	55                   	push   %rbp
+  800352:	48 89 e5             	mov    %rsp,%rbp
+  800355:	41 56                	push   %r14
+  800357:	41 55                	push   %r13
+  800359:	41 54                	push   %r12
+  80035b:	53                   	push   %rbx
+  80035c:	41 89 fd             	mov    %edi,%r13d
+  80035f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800362:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800369:	00 00 00 
+  80036c:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800373:	00 00 00 
+  800376:	48 39 c2             	cmp    %rax,%rdx
+  800379:	73 17                	jae    800392 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80037b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80037e:	49 89 c4             	mov    %rax,%r12
+  800381:	48 83 c3 08          	add    $0x8,%rbx
+  800385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038a:	ff 53 f8             	call   *-0x8(%rbx)
+  80038d:	4c 39 e3             	cmp    %r12,%rbx
+  800390:	72 ef                	jb     800381 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800392:	48 b8 e2 14 80 00 00 	movabs $0x8014e2,%rax
+  800399:	00 00 00 
+  80039c:	ff d0                	call   *%rax
+  80039e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003a3:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8003aa:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003b1:	00 00 00 
+  8003b4:	48 01 d0             	add    %rdx,%rax
+  8003b7:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8003be:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003c1:	45 85 ed             	test   %r13d,%r13d
+  8003c4:	7e 0d                	jle    8003d3 <libmain+0x82>
+  8003c6:	49 8b 06             	mov    (%r14),%rax
+  8003c9:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003d0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003d3:	4c 89 f6             	mov    %r14,%rsi
+  8003d6:	44 89 ef             	mov    %r13d,%edi
+  8003d9:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  8003e0:	00 00 00 
+  8003e3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003e5:	48 b8 fa 03 80 00 00 	movabs $0x8003fa,%rax
+  8003ec:	00 00 00 
+  8003ef:	ff d0                	call   *%rax
+#endif
+}
+  8003f1:	5b                   	pop    %rbx
+  8003f2:	41 5c                	pop    %r12
+  8003f4:	41 5d                	pop    %r13
+  8003f6:	41 5e                	pop    %r14
+  8003f8:	5d                   	pop    %rbp
+  8003f9:	c3                   	ret
+
+00000000008003fa <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003fa:	55                   	push   %rbp
+  8003fb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003fe:	48 b8 58 23 80 00 00 	movabs $0x802358,%rax
+  800405:	00 00 00 
+  800408:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80040a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80040f:	48 b8 77 14 80 00 00 	movabs $0x801477,%rax
+  800416:	00 00 00 
+  800419:	ff d0                	call   *%rax
+}
+  80041b:	5d                   	pop    %rbp
+  80041c:	c3                   	ret
+
+000000000080041d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80041d:	55                   	push   %rbp
+  80041e:	48 89 e5             	mov    %rsp,%rbp
+  800421:	53                   	push   %rbx
+  800422:	48 83 ec 08          	sub    $0x8,%rsp
+  800426:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800429:	8b 06                	mov    (%rsi),%eax
+  80042b:	8d 50 01             	lea    0x1(%rax),%edx
+  80042e:	89 16                	mov    %edx,(%rsi)
+  800430:	48 98                	cltq
+  800432:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800437:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80043d:	74 0a                	je     800449 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80043f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800443:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800447:	c9                   	leave
+  800448:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800449:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80044d:	be ff 00 00 00       	mov    $0xff,%esi
+  800452:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  800459:	00 00 00 
+  80045c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80045e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800464:	eb d9                	jmp    80043f <putch+0x22>
+
+0000000000800466 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800466:	55                   	push   %rbp
+  800467:	48 89 e5             	mov    %rsp,%rbp
+  80046a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800471:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800474:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80047b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800480:	b8 00 00 00 00       	mov    $0x0,%eax
+  800485:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800488:	48 89 f1             	mov    %rsi,%rcx
+  80048b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800492:	48 bf 1d 04 80 00 00 	movabs $0x80041d,%rdi
+  800499:	00 00 00 
+  80049c:	48 b8 1a 06 80 00 00 	movabs $0x80061a,%rax
+  8004a3:	00 00 00 
+  8004a6:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004a8:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004af:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004b6:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  8004bd:	00 00 00 
+  8004c0:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004c2:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8004c8:	c9                   	leave
+  8004c9:	c3                   	ret
+
+00000000008004ca <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8004ca:	55                   	push   %rbp
+  8004cb:	48 89 e5             	mov    %rsp,%rbp
+  8004ce:	48 83 ec 50          	sub    $0x50,%rsp
+  8004d2:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004d6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004da:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004de:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004e2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8004e6:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004ed:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004f9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004fd:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800501:	48 b8 66 04 80 00 00 	movabs $0x800466,%rax
+  800508:	00 00 00 
+  80050b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80050d:	c9                   	leave
+  80050e:	c3                   	ret
+
+000000000080050f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80050f:	55                   	push   %rbp
+  800510:	48 89 e5             	mov    %rsp,%rbp
+  800513:	41 57                	push   %r15
+  800515:	41 56                	push   %r14
+  800517:	41 55                	push   %r13
+  800519:	41 54                	push   %r12
+  80051b:	53                   	push   %rbx
+  80051c:	48 83 ec 18          	sub    $0x18,%rsp
+  800520:	49 89 fc             	mov    %rdi,%r12
+  800523:	49 89 f5             	mov    %rsi,%r13
+  800526:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80052a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80052d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800530:	41 89 cf             	mov    %ecx,%r15d
+  800533:	4c 39 fa             	cmp    %r15,%rdx
+  800536:	73 5b                	jae    800593 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800538:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80053c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800540:	85 db                	test   %ebx,%ebx
+  800542:	7e 0e                	jle    800552 <print_num+0x43>
+            putch(padc, put_arg);
+  800544:	4c 89 ee             	mov    %r13,%rsi
+  800547:	44 89 f7             	mov    %r14d,%edi
+  80054a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80054d:	83 eb 01             	sub    $0x1,%ebx
+  800550:	75 f2                	jne    800544 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800552:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800556:	48 b9 c3 51 80 00 00 	movabs $0x8051c3,%rcx
+  80055d:	00 00 00 
+  800560:	48 b8 b2 51 80 00 00 	movabs $0x8051b2,%rax
+  800567:	00 00 00 
+  80056a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80056e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800572:	ba 00 00 00 00       	mov    $0x0,%edx
+  800577:	49 f7 f7             	div    %r15
+  80057a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80057e:	4c 89 ee             	mov    %r13,%rsi
+  800581:	41 ff d4             	call   *%r12
+}
+  800584:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800588:	5b                   	pop    %rbx
+  800589:	41 5c                	pop    %r12
+  80058b:	41 5d                	pop    %r13
+  80058d:	41 5e                	pop    %r14
+  80058f:	41 5f                	pop    %r15
+  800591:	5d                   	pop    %rbp
+  800592:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800593:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800597:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059c:	49 f7 f7             	div    %r15
+  80059f:	48 83 ec 08          	sub    $0x8,%rsp
+  8005a3:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005a7:	52                   	push   %rdx
+  8005a8:	45 0f be c9          	movsbl %r9b,%r9d
+  8005ac:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005b0:	48 89 c2             	mov    %rax,%rdx
+  8005b3:	48 b8 0f 05 80 00 00 	movabs $0x80050f,%rax
+  8005ba:	00 00 00 
+  8005bd:	ff d0                	call   *%rax
+  8005bf:	48 83 c4 10          	add    $0x10,%rsp
+  8005c3:	eb 8d                	jmp    800552 <print_num+0x43>
+
+00000000008005c5 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8005c5:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8005c9:	48 8b 06             	mov    (%rsi),%rax
+  8005cc:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8005d0:	73 0a                	jae    8005dc <sprintputch+0x17>
+        *state->start++ = ch;
+  8005d2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005d6:	48 89 16             	mov    %rdx,(%rsi)
+  8005d9:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8005dc:	c3                   	ret
+
+00000000008005dd <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8005dd:	55                   	push   %rbp
+  8005de:	48 89 e5             	mov    %rsp,%rbp
+  8005e1:	48 83 ec 50          	sub    $0x50,%rsp
+  8005e5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005e9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005ed:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005f1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800600:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800604:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800608:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80060c:	48 b8 1a 06 80 00 00 	movabs $0x80061a,%rax
+  800613:	00 00 00 
+  800616:	ff d0                	call   *%rax
+}
+  800618:	c9                   	leave
+  800619:	c3                   	ret
+
+000000000080061a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80061a:	55                   	push   %rbp
+  80061b:	48 89 e5             	mov    %rsp,%rbp
+  80061e:	41 57                	push   %r15
+  800620:	41 56                	push   %r14
+  800622:	41 55                	push   %r13
+  800624:	41 54                	push   %r12
+  800626:	53                   	push   %rbx
+  800627:	48 83 ec 38          	sub    $0x38,%rsp
+  80062b:	49 89 fe             	mov    %rdi,%r14
+  80062e:	49 89 f5             	mov    %rsi,%r13
+  800631:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800634:	48 8b 01             	mov    (%rcx),%rax
+  800637:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80063b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80063f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800643:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800647:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80064b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80064f:	0f b6 3b             	movzbl (%rbx),%edi
+  800652:	40 80 ff 25          	cmp    $0x25,%dil
+  800656:	74 18                	je     800670 <vprintfmt+0x56>
+            if (!ch) return;
+  800658:	40 84 ff             	test   %dil,%dil
+  80065b:	0f 84 04 07 00 00    	je     800d65 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800661:	40 0f b6 ff          	movzbl %dil,%edi
+  800665:	4c 89 ee             	mov    %r13,%rsi
+  800668:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80066b:	4c 89 e3             	mov    %r12,%rbx
+  80066e:	eb db                	jmp    80064b <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800670:	be 00 00 00 00       	mov    $0x0,%esi
+  800675:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800679:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80067e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800684:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80068b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80068f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800694:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800699:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80069c:	83 e8 23             	sub    $0x23,%eax
+  80069f:	3c 57                	cmp    $0x57,%al
+  8006a1:	0f 87 a4 06 00 00    	ja     800d4b <vprintfmt+0x731>
+  8006a7:	0f b6 c0             	movzbl %al,%eax
+  8006aa:	48 b9 60 53 80 00 00 	movabs $0x805360,%rcx
+  8006b1:	00 00 00 
+  8006b4:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006b7:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006ba:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006be:	eb cf                	jmp    80068f <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006c0:	49 89 dc             	mov    %rbx,%r12
+  8006c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8006c8:	eb c5                	jmp    80068f <vprintfmt+0x75>
+            padc = ch;
+  8006ca:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8006ce:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006d1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006d4:	eb b9                	jmp    80068f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006dc:	77 24                	ja     800702 <vprintfmt+0xe8>
+  8006de:	89 c1                	mov    %eax,%ecx
+  8006e0:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8006e4:	83 c0 08             	add    $0x8,%eax
+  8006e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ea:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006ed:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006f0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006f4:	79 99                	jns    80068f <vprintfmt+0x75>
+                width = precision;
+  8006f6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006fa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800700:	eb 8d                	jmp    80068f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800702:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800706:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80070a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070e:	eb da                	jmp    8006ea <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800710:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800715:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800719:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80071f:	3c 39                	cmp    $0x39,%al
+  800721:	77 1c                	ja     80073f <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800723:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800727:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80072b:	0f b6 c0             	movzbl %al,%eax
+  80072e:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800733:	0f b6 03             	movzbl (%rbx),%eax
+  800736:	3c 39                	cmp    $0x39,%al
+  800738:	76 e9                	jbe    800723 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80073a:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80073d:	eb b1                	jmp    8006f0 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80073f:	49 89 dc             	mov    %rbx,%r12
+  800742:	eb ac                	jmp    8006f0 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800744:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800747:	85 c9                	test   %ecx,%ecx
+  800749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074e:	0f 49 c1             	cmovns %ecx,%eax
+  800751:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800754:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800757:	e9 33 ff ff ff       	jmp    80068f <vprintfmt+0x75>
+            lflag++;
+  80075c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80075f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800762:	e9 28 ff ff ff       	jmp    80068f <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800767:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076a:	83 f8 2f             	cmp    $0x2f,%eax
+  80076d:	77 19                	ja     800788 <vprintfmt+0x16e>
+  80076f:	89 c2                	mov    %eax,%edx
+  800771:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800775:	83 c0 08             	add    $0x8,%eax
+  800778:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077b:	8b 3a                	mov    (%rdx),%edi
+  80077d:	4c 89 ee             	mov    %r13,%rsi
+  800780:	41 ff d6             	call   *%r14
+            break;
+  800783:	e9 c3 fe ff ff       	jmp    80064b <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800788:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800790:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800794:	eb e5                	jmp    80077b <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800796:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800799:	83 f8 2f             	cmp    $0x2f,%eax
+  80079c:	77 5a                	ja     8007f8 <vprintfmt+0x1de>
+  80079e:	89 c2                	mov    %eax,%edx
+  8007a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a4:	83 c0 08             	add    $0x8,%eax
+  8007a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007aa:	8b 02                	mov    (%rdx),%eax
+  8007ac:	89 c1                	mov    %eax,%ecx
+  8007ae:	f7 d9                	neg    %ecx
+  8007b0:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007b3:	83 f9 13             	cmp    $0x13,%ecx
+  8007b6:	7f 4e                	jg     800806 <vprintfmt+0x1ec>
+  8007b8:	48 63 c1             	movslq %ecx,%rax
+  8007bb:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  8007c2:	00 00 00 
+  8007c5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007c9:	48 85 c0             	test   %rax,%rax
+  8007cc:	74 38                	je     800806 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8007ce:	48 89 c1             	mov    %rax,%rcx
+  8007d1:	48 ba 59 58 80 00 00 	movabs $0x805859,%rdx
+  8007d8:	00 00 00 
+  8007db:	4c 89 ee             	mov    %r13,%rsi
+  8007de:	4c 89 f7             	mov    %r14,%rdi
+  8007e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e6:	49 b8 dd 05 80 00 00 	movabs $0x8005dd,%r8
+  8007ed:	00 00 00 
+  8007f0:	41 ff d0             	call   *%r8
+  8007f3:	e9 53 fe ff ff       	jmp    80064b <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800800:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800804:	eb a4                	jmp    8007aa <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800806:	48 ba db 51 80 00 00 	movabs $0x8051db,%rdx
+  80080d:	00 00 00 
+  800810:	4c 89 ee             	mov    %r13,%rsi
+  800813:	4c 89 f7             	mov    %r14,%rdi
+  800816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081b:	49 b8 dd 05 80 00 00 	movabs $0x8005dd,%r8
+  800822:	00 00 00 
+  800825:	41 ff d0             	call   *%r8
+  800828:	e9 1e fe ff ff       	jmp    80064b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80082d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800830:	83 f8 2f             	cmp    $0x2f,%eax
+  800833:	77 36                	ja     80086b <vprintfmt+0x251>
+  800835:	89 c2                	mov    %eax,%edx
+  800837:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083b:	83 c0 08             	add    $0x8,%eax
+  80083e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800841:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800844:	48 85 f6             	test   %rsi,%rsi
+  800847:	48 b8 d4 51 80 00 00 	movabs $0x8051d4,%rax
+  80084e:	00 00 00 
+  800851:	48 0f 45 c6          	cmovne %rsi,%rax
+  800855:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800859:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80085d:	7e 06                	jle    800865 <vprintfmt+0x24b>
+  80085f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800863:	75 14                	jne    800879 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800865:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800869:	eb 5b                	jmp    8008c6 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80086b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800873:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800877:	eb c8                	jmp    800841 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800879:	49 63 f7             	movslq %r15d,%rsi
+  80087c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800880:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  800887:	00 00 00 
+  80088a:	ff d0                	call   *%rax
+  80088c:	48 89 c2             	mov    %rax,%rdx
+  80088f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800892:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800894:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800897:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80089a:	85 c0                	test   %eax,%eax
+  80089c:	7e c7                	jle    800865 <vprintfmt+0x24b>
+  80089e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008a3:	4c 89 ee             	mov    %r13,%rsi
+  8008a6:	44 89 e7             	mov    %r12d,%edi
+  8008a9:	41 ff d6             	call   *%r14
+  8008ac:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008b0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008b3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008b6:	75 eb                	jne    8008a3 <vprintfmt+0x289>
+  8008b8:	eb ab                	jmp    800865 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008ba:	0f b6 f8             	movzbl %al,%edi
+  8008bd:	4c 89 ee             	mov    %r13,%rsi
+  8008c0:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8008c3:	4c 89 e2             	mov    %r12,%rdx
+  8008c6:	45 85 ff             	test   %r15d,%r15d
+  8008c9:	78 06                	js     8008d1 <vprintfmt+0x2b7>
+  8008cb:	41 83 ef 01          	sub    $0x1,%r15d
+  8008cf:	78 23                	js     8008f4 <vprintfmt+0x2da>
+  8008d1:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8008d5:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008db:	84 c0                	test   %al,%al
+  8008dd:	74 15                	je     8008f4 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008df:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008e3:	74 d5                	je     8008ba <vprintfmt+0x2a0>
+  8008e5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008e8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008ed:	80 fa 5e             	cmp    $0x5e,%dl
+  8008f0:	77 cb                	ja     8008bd <vprintfmt+0x2a3>
+  8008f2:	eb c6                	jmp    8008ba <vprintfmt+0x2a0>
+  8008f4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008f7:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8008fa:	01 f0                	add    %esi,%eax
+  8008fc:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8008fe:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800902:	85 c0                	test   %eax,%eax
+  800904:	0f 8e 41 fd ff ff    	jle    80064b <vprintfmt+0x31>
+  80090a:	4c 89 ee             	mov    %r13,%rsi
+  80090d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800912:	41 ff d6             	call   *%r14
+  800915:	41 83 ec 01          	sub    $0x1,%r12d
+  800919:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80091d:	75 eb                	jne    80090a <vprintfmt+0x2f0>
+  80091f:	e9 27 fd ff ff       	jmp    80064b <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800924:	40 84 f6             	test   %sil,%sil
+  800927:	75 26                	jne    80094f <vprintfmt+0x335>
+    switch (lflag) {
+  800929:	85 d2                	test   %edx,%edx
+  80092b:	74 59                	je     800986 <vprintfmt+0x36c>
+  80092d:	83 fa 01             	cmp    $0x1,%edx
+  800930:	74 7b                	je     8009ad <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800932:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800935:	83 f8 2f             	cmp    $0x2f,%eax
+  800938:	0f 87 96 00 00 00    	ja     8009d4 <vprintfmt+0x3ba>
+  80093e:	89 c2                	mov    %eax,%edx
+  800940:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800944:	83 c0 08             	add    $0x8,%eax
+  800947:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094a:	4c 8b 22             	mov    (%rdx),%r12
+  80094d:	eb 17                	jmp    800966 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80094f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800952:	83 f8 2f             	cmp    $0x2f,%eax
+  800955:	77 21                	ja     800978 <vprintfmt+0x35e>
+  800957:	89 c2                	mov    %eax,%edx
+  800959:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095d:	83 c0 08             	add    $0x8,%eax
+  800960:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800963:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800966:	4d 85 e4             	test   %r12,%r12
+  800969:	78 7a                	js     8009e5 <vprintfmt+0x3cb>
+            num = i;
+  80096b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80096e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800973:	e9 b5 02 00 00       	jmp    800c2d <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800978:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800984:	eb dd                	jmp    800963 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	77 11                	ja     80099f <vprintfmt+0x385>
+  80098e:	89 c2                	mov    %eax,%edx
+  800990:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800994:	83 c0 08             	add    $0x8,%eax
+  800997:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099a:	4c 63 22             	movslq (%rdx),%r12
+  80099d:	eb c7                	jmp    800966 <vprintfmt+0x34c>
+  80099f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ab:	eb ed                	jmp    80099a <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8009ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b3:	77 11                	ja     8009c6 <vprintfmt+0x3ac>
+  8009b5:	89 c2                	mov    %eax,%edx
+  8009b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bb:	83 c0 08             	add    $0x8,%eax
+  8009be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c1:	4c 8b 22             	mov    (%rdx),%r12
+  8009c4:	eb a0                	jmp    800966 <vprintfmt+0x34c>
+  8009c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d2:	eb ed                	jmp    8009c1 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8009d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e0:	e9 65 ff ff ff       	jmp    80094a <vprintfmt+0x330>
+                putch('-', put_arg);
+  8009e5:	4c 89 ee             	mov    %r13,%rsi
+  8009e8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009ed:	41 ff d6             	call   *%r14
+                i = -i;
+  8009f0:	49 f7 dc             	neg    %r12
+  8009f3:	e9 73 ff ff ff       	jmp    80096b <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f8:	40 84 f6             	test   %sil,%sil
+  8009fb:	75 32                	jne    800a2f <vprintfmt+0x415>
+    switch (lflag) {
+  8009fd:	85 d2                	test   %edx,%edx
+  8009ff:	74 5d                	je     800a5e <vprintfmt+0x444>
+  800a01:	83 fa 01             	cmp    $0x1,%edx
+  800a04:	0f 84 82 00 00 00    	je     800a8c <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800a0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a10:	0f 87 a5 00 00 00    	ja     800abb <vprintfmt+0x4a1>
+  800a16:	89 c2                	mov    %eax,%edx
+  800a18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1c:	83 c0 08             	add    $0x8,%eax
+  800a1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a22:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a25:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a2a:	e9 fe 01 00 00       	jmp    800c2d <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a32:	83 f8 2f             	cmp    $0x2f,%eax
+  800a35:	77 19                	ja     800a50 <vprintfmt+0x436>
+  800a37:	89 c2                	mov    %eax,%edx
+  800a39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3d:	83 c0 08             	add    $0x8,%eax
+  800a40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a43:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a4b:	e9 dd 01 00 00       	jmp    800c2d <vprintfmt+0x613>
+  800a50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5c:	eb e5                	jmp    800a43 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800a5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a61:	83 f8 2f             	cmp    $0x2f,%eax
+  800a64:	77 18                	ja     800a7e <vprintfmt+0x464>
+  800a66:	89 c2                	mov    %eax,%edx
+  800a68:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6c:	83 c0 08             	add    $0x8,%eax
+  800a6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a72:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a74:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a79:	e9 af 01 00 00       	jmp    800c2d <vprintfmt+0x613>
+  800a7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8a:	eb e6                	jmp    800a72 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800a8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a92:	77 19                	ja     800aad <vprintfmt+0x493>
+  800a94:	89 c2                	mov    %eax,%edx
+  800a96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9a:	83 c0 08             	add    $0x8,%eax
+  800a9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aa3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800aa8:	e9 80 01 00 00       	jmp    800c2d <vprintfmt+0x613>
+  800aad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab9:	eb e5                	jmp    800aa0 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800abb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac7:	e9 56 ff ff ff       	jmp    800a22 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800acc:	40 84 f6             	test   %sil,%sil
+  800acf:	75 2e                	jne    800aff <vprintfmt+0x4e5>
+    switch (lflag) {
+  800ad1:	85 d2                	test   %edx,%edx
+  800ad3:	0f 84 b3 00 00 00    	je     800b8c <vprintfmt+0x572>
+  800ad9:	83 fa 01             	cmp    $0x1,%edx
+  800adc:	0f 84 d3 00 00 00    	je     800bb5 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800ae2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae8:	0f 87 f1 00 00 00    	ja     800bdf <vprintfmt+0x5c5>
+  800aee:	89 c2                	mov    %eax,%edx
+  800af0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af4:	83 c0 08             	add    $0x8,%eax
+  800af7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afa:	48 8b 02             	mov    (%rdx),%rax
+  800afd:	eb 17                	jmp    800b16 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800aff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b02:	83 f8 2f             	cmp    $0x2f,%eax
+  800b05:	77 77                	ja     800b7e <vprintfmt+0x564>
+  800b07:	89 c2                	mov    %eax,%edx
+  800b09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0d:	83 c0 08             	add    $0x8,%eax
+  800b10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b13:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800b16:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800b18:	83 f8 07             	cmp    $0x7,%eax
+  800b1b:	0f 8e cf 00 00 00    	jle    800bf0 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800b21:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800b27:	44 89 e7             	mov    %r12d,%edi
+  800b2a:	41 c1 e4 03          	shl    $0x3,%r12d
+  800b2e:	89 d1                	mov    %edx,%ecx
+  800b30:	8d 72 07             	lea    0x7(%rdx),%esi
+  800b33:	85 d2                	test   %edx,%edx
+  800b35:	0f 48 d6             	cmovs  %esi,%edx
+  800b38:	c1 fa 03             	sar    $0x3,%edx
+  800b3b:	83 f9 3f             	cmp    $0x3f,%ecx
+  800b3e:	7f e7                	jg     800b27 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800b40:	85 ff                	test   %edi,%edi
+  800b42:	0f 84 03 fb ff ff    	je     80064b <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800b48:	49 63 f4             	movslq %r12d,%rsi
+  800b4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b50:	48 f7 f6             	div    %rsi
+  800b53:	49 89 d7             	mov    %rdx,%r15
+  800b56:	83 c0 30             	add    $0x30,%eax
+  800b59:	0f be f8             	movsbl %al,%edi
+  800b5c:	4c 89 ee             	mov    %r13,%rsi
+  800b5f:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800b62:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800b65:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800b6a:	45 85 e4             	test   %r12d,%r12d
+  800b6d:	41 0f 49 d4          	cmovns %r12d,%edx
+  800b71:	c1 fa 03             	sar    $0x3,%edx
+  800b74:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800b77:	75 cf                	jne    800b48 <vprintfmt+0x52e>
+  800b79:	e9 cd fa ff ff       	jmp    80064b <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800b7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8a:	eb 87                	jmp    800b13 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800b8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b92:	77 13                	ja     800ba7 <vprintfmt+0x58d>
+  800b94:	89 c2                	mov    %eax,%edx
+  800b96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9a:	83 c0 08             	add    $0x8,%eax
+  800b9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba0:	8b 02                	mov    (%rdx),%eax
+  800ba2:	e9 6f ff ff ff       	jmp    800b16 <vprintfmt+0x4fc>
+  800ba7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800baf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb3:	eb eb                	jmp    800ba0 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800bb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbb:	77 14                	ja     800bd1 <vprintfmt+0x5b7>
+  800bbd:	89 c2                	mov    %eax,%edx
+  800bbf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc3:	83 c0 08             	add    $0x8,%eax
+  800bc6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc9:	48 8b 02             	mov    (%rdx),%rax
+  800bcc:	e9 45 ff ff ff       	jmp    800b16 <vprintfmt+0x4fc>
+  800bd1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bdd:	eb ea                	jmp    800bc9 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800bdf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800beb:	e9 0a ff ff ff       	jmp    800afa <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800bf0:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800bf6:	e9 4d ff ff ff       	jmp    800b48 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800bfb:	4c 89 ee             	mov    %r13,%rsi
+  800bfe:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c03:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c06:	4c 89 ee             	mov    %r13,%rsi
+  800c09:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c0e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c14:	83 f8 2f             	cmp    $0x2f,%eax
+  800c17:	77 47                	ja     800c60 <vprintfmt+0x646>
+  800c19:	89 c2                	mov    %eax,%edx
+  800c1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1f:	83 c0 08             	add    $0x8,%eax
+  800c22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c25:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c28:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c2d:	48 83 ec 08          	sub    $0x8,%rsp
+  800c31:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c35:	0f 94 c0             	sete   %al
+  800c38:	0f b6 c0             	movzbl %al,%eax
+  800c3b:	50                   	push   %rax
+  800c3c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c41:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c45:	4c 89 ee             	mov    %r13,%rsi
+  800c48:	4c 89 f7             	mov    %r14,%rdi
+  800c4b:	48 b8 0f 05 80 00 00 	movabs $0x80050f,%rax
+  800c52:	00 00 00 
+  800c55:	ff d0                	call   *%rax
+            break;
+  800c57:	48 83 c4 10          	add    $0x10,%rsp
+  800c5b:	e9 eb f9 ff ff       	jmp    80064b <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6c:	eb b7                	jmp    800c25 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800c6e:	40 84 f6             	test   %sil,%sil
+  800c71:	75 2b                	jne    800c9e <vprintfmt+0x684>
+    switch (lflag) {
+  800c73:	85 d2                	test   %edx,%edx
+  800c75:	74 56                	je     800ccd <vprintfmt+0x6b3>
+  800c77:	83 fa 01             	cmp    $0x1,%edx
+  800c7a:	74 7f                	je     800cfb <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800c7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c82:	0f 87 a2 00 00 00    	ja     800d2a <vprintfmt+0x710>
+  800c88:	89 c2                	mov    %eax,%edx
+  800c8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c8e:	83 c0 08             	add    $0x8,%eax
+  800c91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c94:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c97:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c9c:	eb 8f                	jmp    800c2d <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800c9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca4:	77 19                	ja     800cbf <vprintfmt+0x6a5>
+  800ca6:	89 c2                	mov    %eax,%edx
+  800ca8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cac:	83 c0 08             	add    $0x8,%eax
+  800caf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cb5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cba:	e9 6e ff ff ff       	jmp    800c2d <vprintfmt+0x613>
+  800cbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ccb:	eb e5                	jmp    800cb2 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800ccd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd0:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd3:	77 18                	ja     800ced <vprintfmt+0x6d3>
+  800cd5:	89 c2                	mov    %eax,%edx
+  800cd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cdb:	83 c0 08             	add    $0x8,%eax
+  800cde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ce3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ce8:	e9 40 ff ff ff       	jmp    800c2d <vprintfmt+0x613>
+  800ced:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf9:	eb e6                	jmp    800ce1 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800cfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfe:	83 f8 2f             	cmp    $0x2f,%eax
+  800d01:	77 19                	ja     800d1c <vprintfmt+0x702>
+  800d03:	89 c2                	mov    %eax,%edx
+  800d05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d09:	83 c0 08             	add    $0x8,%eax
+  800d0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d12:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d17:	e9 11 ff ff ff       	jmp    800c2d <vprintfmt+0x613>
+  800d1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d28:	eb e5                	jmp    800d0f <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800d2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d36:	e9 59 ff ff ff       	jmp    800c94 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800d3b:	4c 89 ee             	mov    %r13,%rsi
+  800d3e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d43:	41 ff d6             	call   *%r14
+            break;
+  800d46:	e9 00 f9 ff ff       	jmp    80064b <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d4b:	4c 89 ee             	mov    %r13,%rsi
+  800d4e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d53:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d56:	48 83 eb 01          	sub    $0x1,%rbx
+  800d5a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d5e:	75 f6                	jne    800d56 <vprintfmt+0x73c>
+  800d60:	e9 e6 f8 ff ff       	jmp    80064b <vprintfmt+0x31>
+}
+  800d65:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d69:	5b                   	pop    %rbx
+  800d6a:	41 5c                	pop    %r12
+  800d6c:	41 5d                	pop    %r13
+  800d6e:	41 5e                	pop    %r14
+  800d70:	41 5f                	pop    %r15
+  800d72:	5d                   	pop    %rbp
+  800d73:	c3                   	ret
+
+0000000000800d74 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d74:	55                   	push   %rbp
+  800d75:	48 89 e5             	mov    %rsp,%rbp
+  800d78:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d7c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d80:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d85:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d89:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d90:	48 85 ff             	test   %rdi,%rdi
+  800d93:	74 2b                	je     800dc0 <vsnprintf+0x4c>
+  800d95:	48 85 f6             	test   %rsi,%rsi
+  800d98:	74 26                	je     800dc0 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d9a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d9e:	48 bf c5 05 80 00 00 	movabs $0x8005c5,%rdi
+  800da5:	00 00 00 
+  800da8:	48 b8 1a 06 80 00 00 	movabs $0x80061a,%rax
+  800daf:	00 00 00 
+  800db2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800db4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800db8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800dbb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800dbe:	c9                   	leave
+  800dbf:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800dc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dc5:	eb f7                	jmp    800dbe <vsnprintf+0x4a>
+
+0000000000800dc7 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800dc7:	55                   	push   %rbp
+  800dc8:	48 89 e5             	mov    %rsp,%rbp
+  800dcb:	48 83 ec 50          	sub    $0x50,%rsp
+  800dcf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dd3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dd7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ddb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800de2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800de6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dea:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800df2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800df6:	48 b8 74 0d 80 00 00 	movabs $0x800d74,%rax
+  800dfd:	00 00 00 
+  800e00:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e02:	c9                   	leave
+  800e03:	c3                   	ret
+
+0000000000800e04 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e04:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e07:	74 10                	je     800e19 <strlen+0x15>
+    size_t n = 0;
+  800e09:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e0e:	48 83 c0 01          	add    $0x1,%rax
+  800e12:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e16:	75 f6                	jne    800e0e <strlen+0xa>
+  800e18:	c3                   	ret
+    size_t n = 0;
+  800e19:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e1e:	c3                   	ret
+
+0000000000800e1f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e1f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e22:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e27:	48 85 f6             	test   %rsi,%rsi
+  800e2a:	74 11                	je     800e3d <strnlen+0x1e>
+  800e2c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e30:	74 0c                	je     800e3e <strnlen+0x1f>
+  800e32:	48 83 c2 01          	add    $0x1,%rdx
+  800e36:	48 39 d0             	cmp    %rdx,%rax
+  800e39:	75 f1                	jne    800e2c <strnlen+0xd>
+  800e3b:	eb 04                	jmp    800e41 <strnlen+0x22>
+  800e3d:	c3                   	ret
+  800e3e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e41:	c3                   	ret
+
+0000000000800e42 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e42:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e4e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e51:	48 83 c2 01          	add    $0x1,%rdx
+  800e55:	84 c9                	test   %cl,%cl
+  800e57:	75 f1                	jne    800e4a <strcpy+0x8>
+        ;
+    return res;
+}
+  800e59:	c3                   	ret
+
+0000000000800e5a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e5a:	55                   	push   %rbp
+  800e5b:	48 89 e5             	mov    %rsp,%rbp
+  800e5e:	41 54                	push   %r12
+  800e60:	53                   	push   %rbx
+  800e61:	48 89 fb             	mov    %rdi,%rbx
+  800e64:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e67:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  800e6e:	00 00 00 
+  800e71:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e73:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e77:	4c 89 e6             	mov    %r12,%rsi
+  800e7a:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  800e81:	00 00 00 
+  800e84:	ff d0                	call   *%rax
+    return dst;
+}
+  800e86:	48 89 d8             	mov    %rbx,%rax
+  800e89:	5b                   	pop    %rbx
+  800e8a:	41 5c                	pop    %r12
+  800e8c:	5d                   	pop    %rbp
+  800e8d:	c3                   	ret
+
+0000000000800e8e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e8e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e91:	48 85 d2             	test   %rdx,%rdx
+  800e94:	74 1f                	je     800eb5 <strncpy+0x27>
+  800e96:	48 01 fa             	add    %rdi,%rdx
+  800e99:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e9c:	48 83 c1 01          	add    $0x1,%rcx
+  800ea0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ea4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ea8:	41 80 f8 01          	cmp    $0x1,%r8b
+  800eac:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800eb0:	48 39 ca             	cmp    %rcx,%rdx
+  800eb3:	75 e7                	jne    800e9c <strncpy+0xe>
+    }
+    return ret;
+}
+  800eb5:	c3                   	ret
+
+0000000000800eb6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800eb6:	48 89 f8             	mov    %rdi,%rax
+  800eb9:	48 85 d2             	test   %rdx,%rdx
+  800ebc:	74 24                	je     800ee2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ebe:	48 83 ea 01          	sub    $0x1,%rdx
+  800ec2:	74 1b                	je     800edf <strlcpy+0x29>
+  800ec4:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ec8:	0f b6 16             	movzbl (%rsi),%edx
+  800ecb:	84 d2                	test   %dl,%dl
+  800ecd:	74 10                	je     800edf <strlcpy+0x29>
+            *dst++ = *src++;
+  800ecf:	48 83 c6 01          	add    $0x1,%rsi
+  800ed3:	48 83 c0 01          	add    $0x1,%rax
+  800ed7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800eda:	48 39 c8             	cmp    %rcx,%rax
+  800edd:	75 e9                	jne    800ec8 <strlcpy+0x12>
+        *dst = '\0';
+  800edf:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ee2:	48 29 f8             	sub    %rdi,%rax
+}
+  800ee5:	c3                   	ret
+
+0000000000800ee6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ee6:	0f b6 07             	movzbl (%rdi),%eax
+  800ee9:	84 c0                	test   %al,%al
+  800eeb:	74 13                	je     800f00 <strcmp+0x1a>
+  800eed:	38 06                	cmp    %al,(%rsi)
+  800eef:	75 0f                	jne    800f00 <strcmp+0x1a>
+  800ef1:	48 83 c7 01          	add    $0x1,%rdi
+  800ef5:	48 83 c6 01          	add    $0x1,%rsi
+  800ef9:	0f b6 07             	movzbl (%rdi),%eax
+  800efc:	84 c0                	test   %al,%al
+  800efe:	75 ed                	jne    800eed <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f00:	0f b6 c0             	movzbl %al,%eax
+  800f03:	0f b6 16             	movzbl (%rsi),%edx
+  800f06:	29 d0                	sub    %edx,%eax
+}
+  800f08:	c3                   	ret
+
+0000000000800f09 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f09:	48 85 d2             	test   %rdx,%rdx
+  800f0c:	74 1f                	je     800f2d <strncmp+0x24>
+  800f0e:	0f b6 07             	movzbl (%rdi),%eax
+  800f11:	84 c0                	test   %al,%al
+  800f13:	74 1e                	je     800f33 <strncmp+0x2a>
+  800f15:	3a 06                	cmp    (%rsi),%al
+  800f17:	75 1a                	jne    800f33 <strncmp+0x2a>
+  800f19:	48 83 c7 01          	add    $0x1,%rdi
+  800f1d:	48 83 c6 01          	add    $0x1,%rsi
+  800f21:	48 83 ea 01          	sub    $0x1,%rdx
+  800f25:	75 e7                	jne    800f0e <strncmp+0x5>
+
+    if (!n) return 0;
+  800f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f2c:	c3                   	ret
+  800f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f32:	c3                   	ret
+  800f33:	48 85 d2             	test   %rdx,%rdx
+  800f36:	74 09                	je     800f41 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f38:	0f b6 07             	movzbl (%rdi),%eax
+  800f3b:	0f b6 16             	movzbl (%rsi),%edx
+  800f3e:	29 d0                	sub    %edx,%eax
+  800f40:	c3                   	ret
+    if (!n) return 0;
+  800f41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f46:	c3                   	ret
+
+0000000000800f47 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f47:	0f b6 17             	movzbl (%rdi),%edx
+  800f4a:	84 d2                	test   %dl,%dl
+  800f4c:	74 18                	je     800f66 <strchr+0x1f>
+        if (*str == c) {
+  800f4e:	0f be d2             	movsbl %dl,%edx
+  800f51:	39 f2                	cmp    %esi,%edx
+  800f53:	74 17                	je     800f6c <strchr+0x25>
+    for (; *str; str++) {
+  800f55:	48 83 c7 01          	add    $0x1,%rdi
+  800f59:	0f b6 17             	movzbl (%rdi),%edx
+  800f5c:	84 d2                	test   %dl,%dl
+  800f5e:	75 ee                	jne    800f4e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f65:	c3                   	ret
+  800f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6b:	c3                   	ret
+  800f6c:	48 89 f8             	mov    %rdi,%rax
+}
+  800f6f:	c3                   	ret
+
+0000000000800f70 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f70:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f73:	0f b6 17             	movzbl (%rdi),%edx
+  800f76:	84 d2                	test   %dl,%dl
+  800f78:	74 13                	je     800f8d <strfind+0x1d>
+  800f7a:	0f be d2             	movsbl %dl,%edx
+  800f7d:	39 f2                	cmp    %esi,%edx
+  800f7f:	74 0b                	je     800f8c <strfind+0x1c>
+  800f81:	48 83 c0 01          	add    $0x1,%rax
+  800f85:	0f b6 10             	movzbl (%rax),%edx
+  800f88:	84 d2                	test   %dl,%dl
+  800f8a:	75 ee                	jne    800f7a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f8c:	c3                   	ret
+  800f8d:	c3                   	ret
+
+0000000000800f8e <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800f8e:	55                   	push   %rbp
+  800f8f:	48 89 e5             	mov    %rsp,%rbp
+  800f92:	41 57                	push   %r15
+  800f94:	41 56                	push   %r14
+  800f96:	41 55                	push   %r13
+  800f98:	41 54                	push   %r12
+  800f9a:	53                   	push   %rbx
+  800f9b:	48 83 ec 08          	sub    $0x8,%rsp
+  800f9f:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800fa2:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800fa6:	45 84 ed             	test   %r13b,%r13b
+  800fa9:	75 12                	jne    800fbd <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800fab:	4c 89 f8             	mov    %r15,%rax
+  800fae:	48 83 c4 08          	add    $0x8,%rsp
+  800fb2:	5b                   	pop    %rbx
+  800fb3:	41 5c                	pop    %r12
+  800fb5:	41 5d                	pop    %r13
+  800fb7:	41 5e                	pop    %r14
+  800fb9:	41 5f                	pop    %r15
+  800fbb:	5d                   	pop    %rbp
+  800fbc:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800fbd:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800fc1:	4c 89 e7             	mov    %r12,%rdi
+  800fc4:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  800fcb:	00 00 00 
+  800fce:	ff d0                	call   *%rax
+  800fd0:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800fd3:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800fd7:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800fdb:	49 bf 09 0f 80 00 00 	movabs $0x800f09,%r15
+  800fe2:	00 00 00 
+				if ((sc = *s++) == 0)
+  800fe5:	84 c0                	test   %al,%al
+  800fe7:	75 14                	jne    800ffd <strstr+0x6f>
+					return NULL;
+  800fe9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800fef:	eb ba                	jmp    800fab <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800ff1:	48 83 c3 01          	add    $0x1,%rbx
+  800ff5:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800ff9:	84 c0                	test   %al,%al
+  800ffb:	74 1b                	je     801018 <strstr+0x8a>
+			} while (sc != c);
+  800ffd:	41 38 c5             	cmp    %al,%r13b
+  801000:	75 ef                	jne    800ff1 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  801002:	4c 89 f2             	mov    %r14,%rdx
+  801005:	4c 89 e6             	mov    %r12,%rsi
+  801008:	48 89 df             	mov    %rbx,%rdi
+  80100b:	41 ff d7             	call   *%r15
+  80100e:	85 c0                	test   %eax,%eax
+  801010:	75 df                	jne    800ff1 <strstr+0x63>
+  801012:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  801016:	eb 93                	jmp    800fab <strstr+0x1d>
+					return NULL;
+  801018:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80101e:	eb 8b                	jmp    800fab <strstr+0x1d>
+
+0000000000801020 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  801020:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  801022:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  801025:	8d 57 20             	lea    0x20(%rdi),%edx
+  801028:	83 f9 1a             	cmp    $0x1a,%ecx
+  80102b:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80102e:	c3                   	ret
+
+000000000080102f <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  80102f:	55                   	push   %rbp
+  801030:	48 89 e5             	mov    %rsp,%rbp
+  801033:	41 57                	push   %r15
+  801035:	41 56                	push   %r14
+  801037:	41 55                	push   %r13
+  801039:	41 54                	push   %r12
+  80103b:	53                   	push   %rbx
+  80103c:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  801040:	48 39 f7             	cmp    %rsi,%rdi
+  801043:	74 49                	je     80108e <strcasecmp+0x5f>
+  801045:	49 89 fd             	mov    %rdi,%r13
+  801048:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  80104b:	49 bf 20 10 80 00 00 	movabs $0x801020,%r15
+  801052:	00 00 00 
+  801055:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  80105a:	41 0f b6 fe          	movzbl %r14b,%edi
+  80105e:	41 ff d7             	call   *%r15
+  801061:	89 c3                	mov    %eax,%ebx
+  801063:	49 83 c4 01          	add    $0x1,%r12
+  801067:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  80106d:	41 ff d7             	call   *%r15
+  801070:	29 c3                	sub    %eax,%ebx
+  801072:	75 09                	jne    80107d <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  801074:	49 83 c5 01          	add    $0x1,%r13
+  801078:	45 84 f6             	test   %r14b,%r14b
+  80107b:	75 d8                	jne    801055 <strcasecmp+0x26>
+}
+  80107d:	89 d8                	mov    %ebx,%eax
+  80107f:	48 83 c4 08          	add    $0x8,%rsp
+  801083:	5b                   	pop    %rbx
+  801084:	41 5c                	pop    %r12
+  801086:	41 5d                	pop    %r13
+  801088:	41 5e                	pop    %r14
+  80108a:	41 5f                	pop    %r15
+  80108c:	5d                   	pop    %rbp
+  80108d:	c3                   	ret
+        return 0;
+  80108e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801093:	eb e8                	jmp    80107d <strcasecmp+0x4e>
+
+0000000000801095 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  801095:	55                   	push   %rbp
+  801096:	48 89 e5             	mov    %rsp,%rbp
+  801099:	41 57                	push   %r15
+  80109b:	41 56                	push   %r14
+  80109d:	41 55                	push   %r13
+  80109f:	41 54                	push   %r12
+  8010a1:	53                   	push   %rbx
+  8010a2:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  8010a6:	48 85 d2             	test   %rdx,%rdx
+  8010a9:	74 4f                	je     8010fa <strncasecmp+0x65>
+  8010ab:	49 89 fc             	mov    %rdi,%r12
+  8010ae:	49 89 f5             	mov    %rsi,%r13
+  8010b1:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  8010b5:	49 be 20 10 80 00 00 	movabs $0x801020,%r14
+  8010bc:	00 00 00 
+  8010bf:	49 83 c4 01          	add    $0x1,%r12
+  8010c3:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8010c9:	41 ff d6             	call   *%r14
+  8010cc:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  8010ce:	49 83 c5 01          	add    $0x1,%r13
+  8010d2:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  8010d7:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  8010da:	29 c3                	sub    %eax,%ebx
+  8010dc:	85 c0                	test   %eax,%eax
+  8010de:	74 09                	je     8010e9 <strncasecmp+0x54>
+  8010e0:	85 db                	test   %ebx,%ebx
+  8010e2:	75 05                	jne    8010e9 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8010e4:	4d 39 fc             	cmp    %r15,%r12
+  8010e7:	75 d6                	jne    8010bf <strncasecmp+0x2a>
+}
+  8010e9:	89 d8                	mov    %ebx,%eax
+  8010eb:	48 83 c4 08          	add    $0x8,%rsp
+  8010ef:	5b                   	pop    %rbx
+  8010f0:	41 5c                	pop    %r12
+  8010f2:	41 5d                	pop    %r13
+  8010f4:	41 5e                	pop    %r14
+  8010f6:	41 5f                	pop    %r15
+  8010f8:	5d                   	pop    %rbp
+  8010f9:	c3                   	ret
+    int d = 0;
+  8010fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  8010ff:	eb e8                	jmp    8010e9 <strncasecmp+0x54>
+
+0000000000801101 <toupper>:
+
+int toupper(int c) {
+  801101:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  801103:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801106:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801109:	83 f9 1a             	cmp    $0x1a,%ecx
+  80110c:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80110f:	c3                   	ret
+
+0000000000801110 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  801110:	83 ff 20             	cmp    $0x20,%edi
+  801113:	0f 94 c0             	sete   %al
+  801116:	0f b6 c0             	movzbl %al,%eax
+}
+  801119:	c3                   	ret
+
+000000000080111a <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  80111a:	89 f8                	mov    %edi,%eax
+  80111c:	f7 d8                	neg    %eax
+  80111e:	0f 48 c7             	cmovs  %edi,%eax
+}
+  801121:	c3                   	ret
+
+0000000000801122 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801122:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801125:	48 89 f8             	mov    %rdi,%rax
+  801128:	48 f7 d8             	neg    %rax
+  80112b:	83 e0 07             	and    $0x7,%eax
+  80112e:	49 89 d1             	mov    %rdx,%r9
+  801131:	49 29 c1             	sub    %rax,%r9
+  801134:	78 36                	js     80116c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801136:	40 0f b6 c6          	movzbl %sil,%eax
+  80113a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801141:	01 01 01 
+  801144:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801148:	40 f6 c7 07          	test   $0x7,%dil
+  80114c:	75 38                	jne    801186 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80114e:	4c 89 c9             	mov    %r9,%rcx
+  801151:	48 c1 f9 03          	sar    $0x3,%rcx
+  801155:	74 0c                	je     801163 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801157:	fc                   	cld
+  801158:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80115b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80115f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801163:	4d 85 c9             	test   %r9,%r9
+  801166:	75 45                	jne    8011ad <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801168:	4c 89 c0             	mov    %r8,%rax
+  80116b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80116c:	48 85 d2             	test   %rdx,%rdx
+  80116f:	74 f7                	je     801168 <memset+0x46>
+  801171:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801174:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801177:	48 83 c0 01          	add    $0x1,%rax
+  80117b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80117f:	48 39 c2             	cmp    %rax,%rdx
+  801182:	75 f3                	jne    801177 <memset+0x55>
+  801184:	eb e2                	jmp    801168 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801186:	40 f6 c7 01          	test   $0x1,%dil
+  80118a:	74 06                	je     801192 <memset+0x70>
+  80118c:	88 07                	mov    %al,(%rdi)
+  80118e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801192:	40 f6 c7 02          	test   $0x2,%dil
+  801196:	74 07                	je     80119f <memset+0x7d>
+  801198:	66 89 07             	mov    %ax,(%rdi)
+  80119b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80119f:	40 f6 c7 04          	test   $0x4,%dil
+  8011a3:	74 a9                	je     80114e <memset+0x2c>
+  8011a5:	89 07                	mov    %eax,(%rdi)
+  8011a7:	48 83 c7 04          	add    $0x4,%rdi
+  8011ab:	eb a1                	jmp    80114e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011ad:	41 f6 c1 04          	test   $0x4,%r9b
+  8011b1:	74 06                	je     8011b9 <memset+0x97>
+  8011b3:	89 07                	mov    %eax,(%rdi)
+  8011b5:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011b9:	41 f6 c1 02          	test   $0x2,%r9b
+  8011bd:	74 07                	je     8011c6 <memset+0xa4>
+  8011bf:	66 89 07             	mov    %ax,(%rdi)
+  8011c2:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8011c6:	41 f6 c1 01          	test   $0x1,%r9b
+  8011ca:	74 9c                	je     801168 <memset+0x46>
+  8011cc:	88 07                	mov    %al,(%rdi)
+  8011ce:	eb 98                	jmp    801168 <memset+0x46>
+
+00000000008011d0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8011d0:	48 89 f8             	mov    %rdi,%rax
+  8011d3:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8011d6:	48 39 fe             	cmp    %rdi,%rsi
+  8011d9:	73 3b                	jae    801216 <memmove+0x46>
+  8011db:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8011df:	48 39 d7             	cmp    %rdx,%rdi
+  8011e2:	73 32                	jae    801216 <memmove+0x46>
+        s += n;
+        d += n;
+  8011e4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011e8:	48 89 d6             	mov    %rdx,%rsi
+  8011eb:	48 09 fe             	or     %rdi,%rsi
+  8011ee:	48 09 ce             	or     %rcx,%rsi
+  8011f1:	40 f6 c6 07          	test   $0x7,%sil
+  8011f5:	75 12                	jne    801209 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8011f7:	48 83 ef 08          	sub    $0x8,%rdi
+  8011fb:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8011ff:	48 c1 e9 03          	shr    $0x3,%rcx
+  801203:	fd                   	std
+  801204:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801207:	fc                   	cld
+  801208:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801209:	48 83 ef 01          	sub    $0x1,%rdi
+  80120d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801211:	fd                   	std
+  801212:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801214:	eb f1                	jmp    801207 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801216:	48 89 f2             	mov    %rsi,%rdx
+  801219:	48 09 c2             	or     %rax,%rdx
+  80121c:	48 09 ca             	or     %rcx,%rdx
+  80121f:	f6 c2 07             	test   $0x7,%dl
+  801222:	75 0c                	jne    801230 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801224:	48 c1 e9 03          	shr    $0x3,%rcx
+  801228:	48 89 c7             	mov    %rax,%rdi
+  80122b:	fc                   	cld
+  80122c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80122f:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801230:	48 89 c7             	mov    %rax,%rdi
+  801233:	fc                   	cld
+  801234:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801236:	c3                   	ret
+
+0000000000801237 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801237:	55                   	push   %rbp
+  801238:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80123b:	48 b8 d0 11 80 00 00 	movabs $0x8011d0,%rax
+  801242:	00 00 00 
+  801245:	ff d0                	call   *%rax
+}
+  801247:	5d                   	pop    %rbp
+  801248:	c3                   	ret
+
+0000000000801249 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801249:	55                   	push   %rbp
+  80124a:	48 89 e5             	mov    %rsp,%rbp
+  80124d:	41 57                	push   %r15
+  80124f:	41 56                	push   %r14
+  801251:	41 55                	push   %r13
+  801253:	41 54                	push   %r12
+  801255:	53                   	push   %rbx
+  801256:	48 83 ec 08          	sub    $0x8,%rsp
+  80125a:	49 89 fe             	mov    %rdi,%r14
+  80125d:	49 89 f7             	mov    %rsi,%r15
+  801260:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801263:	48 89 f7             	mov    %rsi,%rdi
+  801266:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  80126d:	00 00 00 
+  801270:	ff d0                	call   *%rax
+  801272:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801275:	48 89 de             	mov    %rbx,%rsi
+  801278:	4c 89 f7             	mov    %r14,%rdi
+  80127b:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  801282:	00 00 00 
+  801285:	ff d0                	call   *%rax
+  801287:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80128a:	48 39 c3             	cmp    %rax,%rbx
+  80128d:	74 36                	je     8012c5 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80128f:	48 89 d8             	mov    %rbx,%rax
+  801292:	4c 29 e8             	sub    %r13,%rax
+  801295:	49 39 c4             	cmp    %rax,%r12
+  801298:	73 31                	jae    8012cb <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80129a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80129f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012a3:	4c 89 fe             	mov    %r15,%rsi
+  8012a6:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8012ad:	00 00 00 
+  8012b0:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8012b2:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8012b6:	48 83 c4 08          	add    $0x8,%rsp
+  8012ba:	5b                   	pop    %rbx
+  8012bb:	41 5c                	pop    %r12
+  8012bd:	41 5d                	pop    %r13
+  8012bf:	41 5e                	pop    %r14
+  8012c1:	41 5f                	pop    %r15
+  8012c3:	5d                   	pop    %rbp
+  8012c4:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012c5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012c9:	eb eb                	jmp    8012b6 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8012cb:	48 83 eb 01          	sub    $0x1,%rbx
+  8012cf:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012d3:	48 89 da             	mov    %rbx,%rdx
+  8012d6:	4c 89 fe             	mov    %r15,%rsi
+  8012d9:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8012e0:	00 00 00 
+  8012e3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8012e5:	49 01 de             	add    %rbx,%r14
+  8012e8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8012ed:	eb c3                	jmp    8012b2 <strlcat+0x69>
+
+00000000008012ef <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8012ef:	48 85 d2             	test   %rdx,%rdx
+  8012f2:	74 2d                	je     801321 <memcmp+0x32>
+  8012f4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8012f9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8012fd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801302:	44 38 c1             	cmp    %r8b,%cl
+  801305:	75 0f                	jne    801316 <memcmp+0x27>
+    while (n-- > 0) {
+  801307:	48 83 c0 01          	add    $0x1,%rax
+  80130b:	48 39 c2             	cmp    %rax,%rdx
+  80130e:	75 e9                	jne    8012f9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801310:	b8 00 00 00 00       	mov    $0x0,%eax
+  801315:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801316:	0f b6 c1             	movzbl %cl,%eax
+  801319:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80131d:	44 29 c0             	sub    %r8d,%eax
+  801320:	c3                   	ret
+    return 0;
+  801321:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801326:	c3                   	ret
+
+0000000000801327 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801327:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80132b:	48 39 c7             	cmp    %rax,%rdi
+  80132e:	73 0f                	jae    80133f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801330:	40 38 37             	cmp    %sil,(%rdi)
+  801333:	74 0e                	je     801343 <memfind+0x1c>
+    for (; src < end; src++) {
+  801335:	48 83 c7 01          	add    $0x1,%rdi
+  801339:	48 39 f8             	cmp    %rdi,%rax
+  80133c:	75 f2                	jne    801330 <memfind+0x9>
+  80133e:	c3                   	ret
+  80133f:	48 89 f8             	mov    %rdi,%rax
+  801342:	c3                   	ret
+  801343:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801346:	c3                   	ret
+
+0000000000801347 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801347:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80134a:	0f b6 37             	movzbl (%rdi),%esi
+  80134d:	40 80 fe 20          	cmp    $0x20,%sil
+  801351:	74 06                	je     801359 <strtol+0x12>
+  801353:	40 80 fe 09          	cmp    $0x9,%sil
+  801357:	75 13                	jne    80136c <strtol+0x25>
+  801359:	48 83 c7 01          	add    $0x1,%rdi
+  80135d:	0f b6 37             	movzbl (%rdi),%esi
+  801360:	40 80 fe 20          	cmp    $0x20,%sil
+  801364:	74 f3                	je     801359 <strtol+0x12>
+  801366:	40 80 fe 09          	cmp    $0x9,%sil
+  80136a:	74 ed                	je     801359 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80136c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80136f:	83 e0 fd             	and    $0xfffffffd,%eax
+  801372:	3c 01                	cmp    $0x1,%al
+  801374:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801378:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80137e:	75 0f                	jne    80138f <strtol+0x48>
+  801380:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801383:	74 14                	je     801399 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801385:	85 d2                	test   %edx,%edx
+  801387:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80138c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80138f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801394:	4c 63 ca             	movslq %edx,%r9
+  801397:	eb 36                	jmp    8013cf <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801399:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80139d:	74 0f                	je     8013ae <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80139f:	85 d2                	test   %edx,%edx
+  8013a1:	75 ec                	jne    80138f <strtol+0x48>
+        s++;
+  8013a3:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8013a7:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8013ac:	eb e1                	jmp    80138f <strtol+0x48>
+        s += 2;
+  8013ae:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8013b2:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013b7:	eb d6                	jmp    80138f <strtol+0x48>
+            dig -= '0';
+  8013b9:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8013bc:	44 0f b6 c1          	movzbl %cl,%r8d
+  8013c0:	41 39 d0             	cmp    %edx,%r8d
+  8013c3:	7d 21                	jge    8013e6 <strtol+0x9f>
+        val = val * base + dig;
+  8013c5:	49 0f af c1          	imul   %r9,%rax
+  8013c9:	0f b6 c9             	movzbl %cl,%ecx
+  8013cc:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8013cf:	48 83 c7 01          	add    $0x1,%rdi
+  8013d3:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8013d7:	80 f9 39             	cmp    $0x39,%cl
+  8013da:	76 dd                	jbe    8013b9 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8013dc:	80 f9 7b             	cmp    $0x7b,%cl
+  8013df:	77 05                	ja     8013e6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8013e1:	83 e9 57             	sub    $0x57,%ecx
+  8013e4:	eb d6                	jmp    8013bc <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8013e6:	4d 85 d2             	test   %r10,%r10
+  8013e9:	74 03                	je     8013ee <strtol+0xa7>
+  8013eb:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8013ee:	48 89 c2             	mov    %rax,%rdx
+  8013f1:	48 f7 da             	neg    %rdx
+  8013f4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8013f8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8013fc:	c3                   	ret
+
+00000000008013fd <atoi>:
+int atoi(const char *str) {
+  8013fd:	55                   	push   %rbp
+  8013fe:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801401:	ba 00 00 00 00       	mov    $0x0,%edx
+  801406:	be 00 00 00 00       	mov    $0x0,%esi
+  80140b:	48 b8 47 13 80 00 00 	movabs $0x801347,%rax
+  801412:	00 00 00 
+  801415:	ff d0                	call   *%rax
+}
+  801417:	5d                   	pop    %rbp
+  801418:	c3                   	ret
+
+0000000000801419 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801419:	55                   	push   %rbp
+  80141a:	48 89 e5             	mov    %rsp,%rbp
+  80141d:	53                   	push   %rbx
+  80141e:	48 89 fa             	mov    %rdi,%rdx
+  801421:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801424:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801429:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801433:	be 00 00 00 00       	mov    $0x0,%esi
+  801438:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801440:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801444:	c9                   	leave
+  801445:	c3                   	ret
+
+0000000000801446 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801446:	55                   	push   %rbp
+  801447:	48 89 e5             	mov    %rsp,%rbp
+  80144a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80144b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801450:	ba 00 00 00 00       	mov    $0x0,%edx
+  801455:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80145a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801464:	be 00 00 00 00       	mov    $0x0,%esi
+  801469:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801471:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801475:	c9                   	leave
+  801476:	c3                   	ret
+
+0000000000801477 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801477:	55                   	push   %rbp
+  801478:	48 89 e5             	mov    %rsp,%rbp
+  80147b:	53                   	push   %rbx
+  80147c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801480:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801483:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801488:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80148d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801492:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801497:	be 00 00 00 00       	mov    $0x0,%esi
+  80149c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a4:	48 85 c0             	test   %rax,%rax
+  8014a7:	7f 06                	jg     8014af <sys_env_destroy+0x38>
+}
+  8014a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ad:	c9                   	leave
+  8014ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014af:	49 89 c0             	mov    %rax,%r8
+  8014b2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8014b7:	48 ba e0 56 80 00 00 	movabs $0x8056e0,%rdx
+  8014be:	00 00 00 
+  8014c1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014c6:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  8014cd:	00 00 00 
+  8014d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d5:	49 b9 bb 43 80 00 00 	movabs $0x8043bb,%r9
+  8014dc:	00 00 00 
+  8014df:	41 ff d1             	call   *%r9
+
+00000000008014e2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8014e2:	55                   	push   %rbp
+  8014e3:	48 89 e5             	mov    %rsp,%rbp
+  8014e6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801500:	be 00 00 00 00       	mov    $0x0,%esi
+  801505:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80150d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801511:	c9                   	leave
+  801512:	c3                   	ret
+
+0000000000801513 <sys_yield>:
+
+void
+sys_yield(void) {
+  801513:	55                   	push   %rbp
+  801514:	48 89 e5             	mov    %rsp,%rbp
+  801517:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801518:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80151d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801522:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801527:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801531:	be 00 00 00 00       	mov    $0x0,%esi
+  801536:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80153e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801542:	c9                   	leave
+  801543:	c3                   	ret
+
+0000000000801544 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801544:	55                   	push   %rbp
+  801545:	48 89 e5             	mov    %rsp,%rbp
+  801548:	53                   	push   %rbx
+  801549:	48 89 fa             	mov    %rdi,%rdx
+  80154c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80154f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801554:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80155b:	00 00 00 
+  80155e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801563:	be 00 00 00 00       	mov    $0x0,%esi
+  801568:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801570:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801574:	c9                   	leave
+  801575:	c3                   	ret
+
+0000000000801576 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801576:	55                   	push   %rbp
+  801577:	48 89 e5             	mov    %rsp,%rbp
+  80157a:	53                   	push   %rbx
+  80157b:	49 89 f8             	mov    %rdi,%r8
+  80157e:	48 89 d3             	mov    %rdx,%rbx
+  801581:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801584:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801589:	4c 89 c2             	mov    %r8,%rdx
+  80158c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158f:	be 00 00 00 00       	mov    $0x0,%esi
+  801594:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80159c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a0:	c9                   	leave
+  8015a1:	c3                   	ret
+
+00000000008015a2 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8015a2:	55                   	push   %rbp
+  8015a3:	48 89 e5             	mov    %rsp,%rbp
+  8015a6:	53                   	push   %rbx
+  8015a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ab:	89 f8                	mov    %edi,%eax
+  8015ad:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8015b0:	48 63 f9             	movslq %ecx,%rdi
+  8015b3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b6:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015bb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015be:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015cb:	48 85 c0             	test   %rax,%rax
+  8015ce:	7f 06                	jg     8015d6 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8015d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d4:	c9                   	leave
+  8015d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d6:	49 89 c0             	mov    %rax,%r8
+  8015d9:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8015de:	48 ba e0 56 80 00 00 	movabs $0x8056e0,%rdx
+  8015e5:	00 00 00 
+  8015e8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015ed:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  8015f4:	00 00 00 
+  8015f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fc:	49 b9 bb 43 80 00 00 	movabs $0x8043bb,%r9
+  801603:	00 00 00 
+  801606:	41 ff d1             	call   *%r9
+
+0000000000801609 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801609:	55                   	push   %rbp
+  80160a:	48 89 e5             	mov    %rsp,%rbp
+  80160d:	53                   	push   %rbx
+  80160e:	48 83 ec 08          	sub    $0x8,%rsp
+  801612:	89 f8                	mov    %edi,%eax
+  801614:	49 89 f2             	mov    %rsi,%r10
+  801617:	48 89 cf             	mov    %rcx,%rdi
+  80161a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80161d:	48 63 da             	movslq %edx,%rbx
+  801620:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801623:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801628:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80162e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801630:	48 85 c0             	test   %rax,%rax
+  801633:	7f 06                	jg     80163b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801635:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801639:	c9                   	leave
+  80163a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163b:	49 89 c0             	mov    %rax,%r8
+  80163e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801643:	48 ba e0 56 80 00 00 	movabs $0x8056e0,%rdx
+  80164a:	00 00 00 
+  80164d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801652:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  801659:	00 00 00 
+  80165c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801661:	49 b9 bb 43 80 00 00 	movabs $0x8043bb,%r9
+  801668:	00 00 00 
+  80166b:	41 ff d1             	call   *%r9
+
+000000000080166e <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+  801672:	53                   	push   %rbx
+  801673:	48 83 ec 08          	sub    $0x8,%rsp
+  801677:	49 89 f9             	mov    %rdi,%r9
+  80167a:	89 f0                	mov    %esi,%eax
+  80167c:	48 89 d3             	mov    %rdx,%rbx
+  80167f:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801682:	49 63 f0             	movslq %r8d,%rsi
+  801685:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801688:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80168d:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801690:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801696:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801698:	48 85 c0             	test   %rax,%rax
+  80169b:	7f 06                	jg     8016a3 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80169d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a1:	c9                   	leave
+  8016a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a3:	49 89 c0             	mov    %rax,%r8
+  8016a6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8016ab:	48 ba e0 56 80 00 00 	movabs $0x8056e0,%rdx
+  8016b2:	00 00 00 
+  8016b5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016ba:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  8016c1:	00 00 00 
+  8016c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c9:	49 b9 bb 43 80 00 00 	movabs $0x8043bb,%r9
+  8016d0:	00 00 00 
+  8016d3:	41 ff d1             	call   *%r9
+
+00000000008016d6 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8016d6:	55                   	push   %rbp
+  8016d7:	48 89 e5             	mov    %rsp,%rbp
+  8016da:	53                   	push   %rbx
+  8016db:	89 f8                	mov    %edi,%eax
+  8016dd:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8016e0:	48 63 f9             	movslq %ecx,%rdi
+  8016e3:	48 63 da             	movslq %edx,%rbx
+  8016e6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016ee:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016fc:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8016fe:	89 c2                	mov    %eax,%edx
+  801700:	48 85 c0             	test   %rax,%rax
+  801703:	78 0d                	js     801712 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801705:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80170a:	4d 85 c9             	test   %r9,%r9
+  80170d:	74 03                	je     801712 <sys_alloc_dma_region+0x3c>
+  80170f:	49 89 01             	mov    %rax,(%r9)
+}
+  801712:	89 d0                	mov    %edx,%eax
+  801714:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801718:	c9                   	leave
+  801719:	c3                   	ret
+
+000000000080171a <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80171a:	55                   	push   %rbp
+  80171b:	48 89 e5             	mov    %rsp,%rbp
+  80171e:	53                   	push   %rbx
+  80171f:	48 83 ec 08          	sub    $0x8,%rsp
+  801723:	48 89 f1             	mov    %rsi,%rcx
+  801726:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801729:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172c:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801731:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801736:	be 00 00 00 00       	mov    $0x0,%esi
+  80173b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801741:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801743:	48 85 c0             	test   %rax,%rax
+  801746:	7f 06                	jg     80174e <sys_set_cache_region+0x34>
+}
+  801748:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80174c:	c9                   	leave
+  80174d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80174e:	49 89 c0             	mov    %rax,%r8
+  801751:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801756:	48 ba e0 56 80 00 00 	movabs $0x8056e0,%rdx
+  80175d:	00 00 00 
+  801760:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801765:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  80176c:	00 00 00 
+  80176f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801774:	49 b9 bb 43 80 00 00 	movabs $0x8043bb,%r9
+  80177b:	00 00 00 
+  80177e:	41 ff d1             	call   *%r9
+
+0000000000801781 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801781:	55                   	push   %rbp
+  801782:	48 89 e5             	mov    %rsp,%rbp
+  801785:	53                   	push   %rbx
+  801786:	48 83 ec 08          	sub    $0x8,%rsp
+  80178a:	48 89 f1             	mov    %rsi,%rcx
+  80178d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801790:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801793:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801798:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80179d:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017aa:	48 85 c0             	test   %rax,%rax
+  8017ad:	7f 06                	jg     8017b5 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8017af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b3:	c9                   	leave
+  8017b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017b5:	49 89 c0             	mov    %rax,%r8
+  8017b8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8017bd:	48 ba e0 56 80 00 00 	movabs $0x8056e0,%rdx
+  8017c4:	00 00 00 
+  8017c7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017cc:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  8017d3:	00 00 00 
+  8017d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017db:	49 b9 bb 43 80 00 00 	movabs $0x8043bb,%r9
+  8017e2:	00 00 00 
+  8017e5:	41 ff d1             	call   *%r9
+
+00000000008017e8 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8017e8:	55                   	push   %rbp
+  8017e9:	48 89 e5             	mov    %rsp,%rbp
+  8017ec:	53                   	push   %rbx
+  8017ed:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8017f1:	48 63 ce             	movslq %esi,%rcx
+  8017f4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801801:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801806:	be 00 00 00 00       	mov    $0x0,%esi
+  80180b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801811:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801813:	48 85 c0             	test   %rax,%rax
+  801816:	7f 06                	jg     80181e <sys_env_set_status+0x36>
+}
+  801818:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80181c:	c9                   	leave
+  80181d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80181e:	49 89 c0             	mov    %rax,%r8
+  801821:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801826:	48 ba e0 56 80 00 00 	movabs $0x8056e0,%rdx
+  80182d:	00 00 00 
+  801830:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801835:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  80183c:	00 00 00 
+  80183f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801844:	49 b9 bb 43 80 00 00 	movabs $0x8043bb,%r9
+  80184b:	00 00 00 
+  80184e:	41 ff d1             	call   *%r9
+
+0000000000801851 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801851:	55                   	push   %rbp
+  801852:	48 89 e5             	mov    %rsp,%rbp
+  801855:	53                   	push   %rbx
+  801856:	48 83 ec 08          	sub    $0x8,%rsp
+  80185a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80185d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801860:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801865:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80186f:	be 00 00 00 00       	mov    $0x0,%esi
+  801874:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80187a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80187c:	48 85 c0             	test   %rax,%rax
+  80187f:	7f 06                	jg     801887 <sys_env_set_trapframe+0x36>
+}
+  801881:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801885:	c9                   	leave
+  801886:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801887:	49 89 c0             	mov    %rax,%r8
+  80188a:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80188f:	48 ba e0 56 80 00 00 	movabs $0x8056e0,%rdx
+  801896:	00 00 00 
+  801899:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80189e:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  8018a5:	00 00 00 
+  8018a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ad:	49 b9 bb 43 80 00 00 	movabs $0x8043bb,%r9
+  8018b4:	00 00 00 
+  8018b7:	41 ff d1             	call   *%r9
+
+00000000008018ba <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8018ba:	55                   	push   %rbp
+  8018bb:	48 89 e5             	mov    %rsp,%rbp
+  8018be:	53                   	push   %rbx
+  8018bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8018c3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8018c6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018c9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018e5:	48 85 c0             	test   %rax,%rax
+  8018e8:	7f 06                	jg     8018f0 <sys_env_set_pgfault_upcall+0x36>
+}
+  8018ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ee:	c9                   	leave
+  8018ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018f0:	49 89 c0             	mov    %rax,%r8
+  8018f3:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8018f8:	48 ba e0 56 80 00 00 	movabs $0x8056e0,%rdx
+  8018ff:	00 00 00 
+  801902:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801907:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  80190e:	00 00 00 
+  801911:	b8 00 00 00 00       	mov    $0x0,%eax
+  801916:	49 b9 bb 43 80 00 00 	movabs $0x8043bb,%r9
+  80191d:	00 00 00 
+  801920:	41 ff d1             	call   *%r9
+
+0000000000801923 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801923:	55                   	push   %rbp
+  801924:	48 89 e5             	mov    %rsp,%rbp
+  801927:	53                   	push   %rbx
+  801928:	89 f8                	mov    %edi,%eax
+  80192a:	49 89 f1             	mov    %rsi,%r9
+  80192d:	48 89 d3             	mov    %rdx,%rbx
+  801930:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801933:	49 63 f0             	movslq %r8d,%rsi
+  801936:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801939:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80193e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801941:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801947:	cd 30                	int    $0x30
+}
+  801949:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80194d:	c9                   	leave
+  80194e:	c3                   	ret
+
+000000000080194f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80194f:	55                   	push   %rbp
+  801950:	48 89 e5             	mov    %rsp,%rbp
+  801953:	53                   	push   %rbx
+  801954:	48 83 ec 08          	sub    $0x8,%rsp
+  801958:	48 89 fa             	mov    %rdi,%rdx
+  80195b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80195e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801963:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801968:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80196d:	be 00 00 00 00       	mov    $0x0,%esi
+  801972:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801978:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80197a:	48 85 c0             	test   %rax,%rax
+  80197d:	7f 06                	jg     801985 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80197f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801983:	c9                   	leave
+  801984:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801985:	49 89 c0             	mov    %rax,%r8
+  801988:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80198d:	48 ba e0 56 80 00 00 	movabs $0x8056e0,%rdx
+  801994:	00 00 00 
+  801997:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80199c:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  8019a3:	00 00 00 
+  8019a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ab:	49 b9 bb 43 80 00 00 	movabs $0x8043bb,%r9
+  8019b2:	00 00 00 
+  8019b5:	41 ff d1             	call   *%r9
+
+00000000008019b8 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8019b8:	55                   	push   %rbp
+  8019b9:	48 89 e5             	mov    %rsp,%rbp
+  8019bc:	53                   	push   %rbx
+  8019bd:	48 89 fa             	mov    %rdi,%rdx
+  8019c0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019c3:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8019d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019dd:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019e3:	c9                   	leave
+  8019e4:	c3                   	ret
+
+00000000008019e5 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8019e5:	55                   	push   %rbp
+  8019e6:	48 89 e5             	mov    %rsp,%rbp
+  8019e9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8019ea:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a03:	be 00 00 00 00       	mov    $0x0,%esi
+  801a08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a0e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a14:	c9                   	leave
+  801a15:	c3                   	ret
+
+0000000000801a16 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801a16:	48 85 ff             	test   %rdi,%rdi
+  801a19:	0f 84 b6 01 00 00    	je     801bd5 <malloc+0x1bf>
+malloc(size_t size) {
+  801a1f:	55                   	push   %rbp
+  801a20:	48 89 e5             	mov    %rsp,%rbp
+  801a23:	41 56                	push   %r14
+  801a25:	41 55                	push   %r13
+  801a27:	41 54                	push   %r12
+  801a29:	53                   	push   %rbx
+  801a2a:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801a2d:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801a34:	00 00 00 
+  801a37:	4c 8b 20             	mov    (%rax),%r12
+  801a3a:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801a41:	0f 87 94 01 00 00    	ja     801bdb <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801a47:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801a4e:	00 00 00 
+  801a51:	48 85 c0             	test   %rax,%rax
+  801a54:	74 6b                	je     801ac1 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801a56:	4d 85 e4             	test   %r12,%r12
+  801a59:	74 66                	je     801ac1 <malloc+0xab>
+  801a5b:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801a62:	00 00 00 
+  801a65:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a6a:	eb 0d                	jmp    801a79 <malloc+0x63>
+  801a6c:	48 83 c1 01          	add    $0x1,%rcx
+  801a70:	48 83 c2 18          	add    $0x18,%rdx
+  801a74:	49 39 cc             	cmp    %rcx,%r12
+  801a77:	74 48                	je     801ac1 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801a79:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801a7e:	74 ec                	je     801a6c <malloc+0x56>
+  801a80:	48 39 1a             	cmp    %rbx,(%rdx)
+  801a83:	72 e7                	jb     801a6c <malloc+0x56>
+                real_freep_size--;
+  801a85:	48 83 e8 01          	sub    $0x1,%rax
+  801a89:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801a90:	00 00 00 
+                freep[i].is_free = false;
+  801a93:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801a9a:	00 00 00 
+  801a9d:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801aa1:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801aa5:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801aa9:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801ab0:	00 
+                freep[i].size = size;
+  801ab1:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801ab5:	48 01 c8             	add    %rcx,%rax
+  801ab8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801abc:	e9 0b 01 00 00       	jmp    801bcc <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801ac1:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801ac8:	00 00 00 
+  801acb:	48 01 d8             	add    %rbx,%rax
+  801ace:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801ad4:	76 7c                	jbe    801b52 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801ad6:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801add:	00 00 00 
+  801ae0:	4c 8b 30             	mov    (%rax),%r14
+  801ae3:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801aea:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801aed:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801af4:	00 00 00 
+  801af7:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801afe:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801b05:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801b0b:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801b0f:	48 b8 e2 14 80 00 00 	movabs $0x8014e2,%rax
+  801b16:	00 00 00 
+  801b19:	ff d0                	call   *%rax
+  801b1b:	89 c7                	mov    %eax,%edi
+  801b1d:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801b24:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801b2b:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801b32:	00 00 00 
+  801b35:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801b39:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801b3e:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  801b45:	00 00 00 
+  801b48:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	0f 88 90 00 00 00    	js     801be2 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801b52:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801b59:	00 00 00 
+  801b5c:	48 8b 31             	mov    (%rcx),%rsi
+  801b5f:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801b66:	00 00 00 
+  801b69:	4c 8b 07             	mov    (%rdi),%r8
+  801b6c:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801b70:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801b77:	00 00 00 
+  801b7a:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801b7e:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801b82:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801b89:	00 00 00 
+  801b8c:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801b90:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801b93:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801b97:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801b9e:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801b9f:	48 89 d8             	mov    %rbx,%rax
+  801ba2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ba7:	4c 01 c0             	add    %r8,%rax
+  801baa:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801bad:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801bb4:	48 01 f3             	add    %rsi,%rbx
+  801bb7:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801bba:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801bbf:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801bc6:	00 00 00 
+  801bc9:	48 89 d0             	mov    %rdx,%rax
+}
+  801bcc:	5b                   	pop    %rbx
+  801bcd:	41 5c                	pop    %r12
+  801bcf:	41 5d                	pop    %r13
+  801bd1:	41 5e                	pop    %r14
+  801bd3:	5d                   	pop    %rbp
+  801bd4:	c3                   	ret
+        return NULL;
+  801bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bda:	c3                   	ret
+        return NULL;
+  801bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be0:	eb ea                	jmp    801bcc <malloc+0x1b6>
+            return NULL;
+  801be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be7:	eb e3                	jmp    801bcc <malloc+0x1b6>
+
+0000000000801be9 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801be9:	55                   	push   %rbp
+  801bea:	48 89 e5             	mov    %rsp,%rbp
+  801bed:	53                   	push   %rbx
+  801bee:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801bf2:	48 89 fb             	mov    %rdi,%rbx
+  801bf5:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801bf9:	48 89 df             	mov    %rbx,%rdi
+  801bfc:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  801c03:	00 00 00 
+  801c06:	ff d0                	call   *%rax
+  801c08:	48 89 c7             	mov    %rax,%rdi
+  801c0b:	48 89 da             	mov    %rbx,%rdx
+  801c0e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c13:	48 b8 22 11 80 00 00 	movabs $0x801122,%rax
+  801c1a:	00 00 00 
+  801c1d:	ff d0                	call   *%rax
+}
+  801c1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c23:	c9                   	leave
+  801c24:	c3                   	ret
+
+0000000000801c25 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801c25:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801c2c:	00 00 00 
+  801c2f:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801c36:	00 00 00 
+  801c39:	48 3b 02             	cmp    (%rdx),%rax
+  801c3c:	74 4d                	je     801c8b <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801c3e:	48 85 c0             	test   %rax,%rax
+  801c41:	74 4d                	je     801c90 <get_allocsize+0x6b>
+  801c43:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801c4a:	00 00 00 
+  801c4d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801c52:	48 3b 39             	cmp    (%rcx),%rdi
+  801c55:	74 13                	je     801c6a <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801c57:	48 83 c2 01          	add    $0x1,%rdx
+  801c5b:	48 83 c1 18          	add    $0x18,%rcx
+  801c5f:	48 39 d0             	cmp    %rdx,%rax
+  801c62:	75 ee                	jne    801c52 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c69:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801c6a:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c73:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801c7a:	00 00 00 
+  801c7d:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801c83:	75 0b                	jne    801c90 <get_allocsize+0x6b>
+  801c85:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801c8a:	c3                   	ret
+        return 0;
+  801c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c90:	c3                   	ret
+
+0000000000801c91 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801c91:	48 85 ff             	test   %rdi,%rdi
+  801c94:	0f 84 01 01 00 00    	je     801d9b <free+0x10a>
+free(void *ptr) {
+  801c9a:	55                   	push   %rbp
+  801c9b:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801c9e:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801ca5:	00 00 00 
+  801ca8:	48 8b 30             	mov    (%rax),%rsi
+  801cab:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801cb2:	00 00 00 
+  801cb5:	48 39 c6             	cmp    %rax,%rsi
+  801cb8:	74 50                	je     801d0a <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801cba:	48 85 f6             	test   %rsi,%rsi
+  801cbd:	74 21                	je     801ce0 <free+0x4f>
+  801cbf:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801cc6:	00 00 00 
+  801cc9:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801cce:	48 3b 39             	cmp    (%rcx),%rdi
+  801cd1:	74 61                	je     801d34 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801cd3:	48 83 c2 01          	add    $0x1,%rdx
+  801cd7:	48 83 c1 18          	add    $0x18,%rcx
+  801cdb:	48 39 d6             	cmp    %rdx,%rsi
+  801cde:	75 ee                	jne    801cce <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801ce0:	48 ba 50 57 80 00 00 	movabs $0x805750,%rdx
+  801ce7:	00 00 00 
+  801cea:	be 12 01 00 00       	mov    $0x112,%esi
+  801cef:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  801cf6:	00 00 00 
+  801cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cfe:	48 b9 bb 43 80 00 00 	movabs $0x8043bb,%rcx
+  801d05:	00 00 00 
+  801d08:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801d0a:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  801d11:	00 00 00 
+  801d14:	be 06 01 00 00       	mov    $0x106,%esi
+  801d19:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  801d20:	00 00 00 
+  801d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d28:	48 b9 bb 43 80 00 00 	movabs $0x8043bb,%rcx
+  801d2f:	00 00 00 
+  801d32:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801d34:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d38:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801d3f:	00 00 00 
+  801d42:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801d48:	75 27                	jne    801d71 <free+0xe0>
+            freep[i].is_free = true;
+  801d4a:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d4e:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801d55:	00 00 00 
+  801d58:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801d5f:	00 00 
+            real_freep_size++;
+  801d61:	48 83 c0 01          	add    $0x1,%rax
+  801d65:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801d6c:	00 00 00 
+}
+  801d6f:	5d                   	pop    %rbp
+  801d70:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801d71:	48 ba 28 57 80 00 00 	movabs $0x805728,%rdx
+  801d78:	00 00 00 
+  801d7b:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801d80:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  801d87:	00 00 00 
+  801d8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8f:	48 b9 bb 43 80 00 00 	movabs $0x8043bb,%rcx
+  801d96:	00 00 00 
+  801d99:	ff d1                	call   *%rcx
+  801d9b:	c3                   	ret
+
+0000000000801d9c <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801d9c:	55                   	push   %rbp
+  801d9d:	48 89 e5             	mov    %rsp,%rbp
+  801da0:	41 55                	push   %r13
+  801da2:	41 54                	push   %r12
+  801da4:	53                   	push   %rbx
+  801da5:	48 83 ec 08          	sub    $0x8,%rsp
+  801da9:	48 89 fb             	mov    %rdi,%rbx
+  801dac:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801daf:	48 b8 25 1c 80 00 00 	movabs $0x801c25,%rax
+  801db6:	00 00 00 
+  801db9:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801dbb:	49 39 c5             	cmp    %rax,%r13
+  801dbe:	73 0e                	jae    801dce <realloc+0x32>
+}
+  801dc0:	48 89 d8             	mov    %rbx,%rax
+  801dc3:	48 83 c4 08          	add    $0x8,%rsp
+  801dc7:	5b                   	pop    %rbx
+  801dc8:	41 5c                	pop    %r12
+  801dca:	41 5d                	pop    %r13
+  801dcc:	5d                   	pop    %rbp
+  801dcd:	c3                   	ret
+  801dce:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801dd1:	4c 89 ef             	mov    %r13,%rdi
+  801dd4:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  801ddb:	00 00 00 
+  801dde:	ff d0                	call   *%rax
+  801de0:	48 89 c7             	mov    %rax,%rdi
+  801de3:	4c 89 e2             	mov    %r12,%rdx
+  801de6:	48 89 de             	mov    %rbx,%rsi
+  801de9:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  801df0:	00 00 00 
+  801df3:	ff d0                	call   *%rax
+  801df5:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801df8:	48 89 df             	mov    %rbx,%rdi
+  801dfb:	48 b8 91 1c 80 00 00 	movabs $0x801c91,%rax
+  801e02:	00 00 00 
+  801e05:	ff d0                	call   *%rax
+    return newptr;
+  801e07:	4c 89 e3             	mov    %r12,%rbx
+  801e0a:	eb b4                	jmp    801dc0 <realloc+0x24>
+
+0000000000801e0c <strdup>:
+
+char*
+strdup (const char *src) {
+  801e0c:	55                   	push   %rbp
+  801e0d:	48 89 e5             	mov    %rsp,%rbp
+  801e10:	41 54                	push   %r12
+  801e12:	53                   	push   %rbx
+  801e13:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801e16:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+  801e22:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801e26:	4c 89 e7             	mov    %r12,%rdi
+  801e29:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  801e30:	00 00 00 
+  801e33:	ff d0                	call   *%rax
+  801e35:	48 89 c7             	mov    %rax,%rdi
+  801e38:	4c 89 e2             	mov    %r12,%rdx
+  801e3b:	48 89 de             	mov    %rbx,%rsi
+  801e3e:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  801e45:	00 00 00 
+  801e48:	ff d0                	call   *%rax
+}
+  801e4a:	5b                   	pop    %rbx
+  801e4b:	41 5c                	pop    %r12
+  801e4d:	5d                   	pop    %rbp
+  801e4e:	c3                   	ret
+
+0000000000801e4f <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801e4f:	55                   	push   %rbp
+  801e50:	48 89 e5             	mov    %rsp,%rbp
+  801e53:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e54:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e68:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e6d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e78:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e7e:	c9                   	leave
+  801e7f:	c3                   	ret
+
+0000000000801e80 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801e80:	55                   	push   %rbp
+  801e81:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801e84:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801e8b:	00 00 00 
+  801e8e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801e92:	74 26                	je     801eba <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801e94:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801e96:	48 c1 e2 20          	shl    $0x20,%rdx
+  801e9a:	89 c0                	mov    %eax,%eax
+  801e9c:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801e9f:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801ea6:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801ead:	00 00 00 
+  801eb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb5:	48 f7 31             	divq   (%rcx)
+}
+  801eb8:	5d                   	pop    %rbp
+  801eb9:	c3                   	ret
+        freq = get_cpufreq();
+  801eba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebf:	48 ba 4f 1e 80 00 00 	movabs $0x801e4f,%rdx
+  801ec6:	00 00 00 
+  801ec9:	ff d2                	call   *%rdx
+  801ecb:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801ed2:	00 00 00 
+  801ed5:	eb bd                	jmp    801e94 <get_ticks+0x14>
+
+0000000000801ed7 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801ed7:	55                   	push   %rbp
+  801ed8:	48 89 e5             	mov    %rsp,%rbp
+  801edb:	53                   	push   %rbx
+  801edc:	48 83 ec 08          	sub    $0x8,%rsp
+  801ee0:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801ee3:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801eea:	00 00 00 
+  801eed:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801ef1:	74 50                	je     801f43 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801ef3:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801ef5:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ef9:	89 c0                	mov    %eax,%eax
+  801efb:	48 89 d6             	mov    %rdx,%rsi
+  801efe:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801f01:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801f08:	00 00 00 
+  801f0b:	48 0f af 18          	imul   (%rax),%rbx
+  801f0f:	48 c1 eb 03          	shr    $0x3,%rbx
+  801f13:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801f1a:	9b c4 20 
+  801f1d:	48 89 d8             	mov    %rbx,%rax
+  801f20:	48 f7 e2             	mul    %rdx
+  801f23:	48 89 d1             	mov    %rdx,%rcx
+  801f26:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801f2a:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f2c:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f30:	89 c0                	mov    %eax,%eax
+  801f32:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801f35:	48 29 f2             	sub    %rsi,%rdx
+  801f38:	48 39 ca             	cmp    %rcx,%rdx
+  801f3b:	72 ed                	jb     801f2a <sleep+0x53>
+}
+  801f3d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f41:	c9                   	leave
+  801f42:	c3                   	ret
+        freq = get_cpufreq();
+  801f43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f48:	48 ba 4f 1e 80 00 00 	movabs $0x801e4f,%rdx
+  801f4f:	00 00 00 
+  801f52:	ff d2                	call   *%rdx
+  801f54:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801f5b:	00 00 00 
+  801f5e:	eb 93                	jmp    801ef3 <sleep+0x1c>
+
+0000000000801f60 <poll_kbd>:
+
+int poll_kbd() {
+  801f60:	55                   	push   %rbp
+  801f61:	48 89 e5             	mov    %rsp,%rbp
+  801f64:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801f65:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f79:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f7e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f83:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f89:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f8f:	c9                   	leave
+  801f90:	c3                   	ret
+
+0000000000801f91 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801f91:	55                   	push   %rbp
+  801f92:	48 89 e5             	mov    %rsp,%rbp
+  801f95:	53                   	push   %rbx
+  801f96:	49 89 fa             	mov    %rdi,%r10
+  801f99:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801f9b:	44 89 c6             	mov    %r8d,%esi
+  801f9e:	89 cf                	mov    %ecx,%edi
+  801fa0:	89 d3                	mov    %edx,%ebx
+  801fa2:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801fa4:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fa9:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fac:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801fb0:	cd 30                	int    $0x30
+  801fb2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fb6:	c9                   	leave
+  801fb7:	c3                   	ret
+
+0000000000801fb8 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  801fb8:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  801fbb:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  801fbf:	83 3f 01             	cmpl   $0x1,(%rdi)
+  801fc2:	7e 0f                	jle    801fd3 <argstart+0x1b>
+  801fc4:	48 b8 1a 50 80 00 00 	movabs $0x80501a,%rax
+  801fcb:	00 00 00 
+  801fce:	48 85 f6             	test   %rsi,%rsi
+  801fd1:	75 05                	jne    801fd8 <argstart+0x20>
+  801fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd8:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  801fdc:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  801fe3:	00 
+}
+  801fe4:	c3                   	ret
+
+0000000000801fe5 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  801fe5:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801fec:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  801fed:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801ff1:	48 85 c0             	test   %rax,%rax
+  801ff4:	0f 84 8f 00 00 00    	je     802089 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  801ffa:	55                   	push   %rbp
+  801ffb:	48 89 e5             	mov    %rsp,%rbp
+  801ffe:	53                   	push   %rbx
+  801fff:	48 83 ec 08          	sub    $0x8,%rsp
+  802003:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  802006:	80 38 00             	cmpb   $0x0,(%rax)
+  802009:	75 52                	jne    80205d <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  80200b:	48 8b 17             	mov    (%rdi),%rdx
+  80200e:	83 3a 01             	cmpl   $0x1,(%rdx)
+  802011:	74 67                	je     80207a <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802013:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802017:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  80201b:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80201e:	75 5a                	jne    80207a <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802020:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802024:	74 54                	je     80207a <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  802026:	48 83 c0 01          	add    $0x1,%rax
+  80202a:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  80202e:	8b 12                	mov    (%rdx),%edx
+  802030:	83 ea 01             	sub    $0x1,%edx
+  802033:	48 63 d2             	movslq %edx,%rdx
+  802036:	48 c1 e2 03          	shl    $0x3,%rdx
+  80203a:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  80203e:	48 83 c7 08          	add    $0x8,%rdi
+  802042:	48 b8 d0 11 80 00 00 	movabs $0x8011d0,%rax
+  802049:	00 00 00 
+  80204c:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  80204e:	48 8b 03             	mov    (%rbx),%rax
+  802051:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  802054:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802058:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80205b:	74 17                	je     802074 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  80205d:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802061:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  802064:	48 83 c0 01          	add    $0x1,%rax
+  802068:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  80206c:	89 d0                	mov    %edx,%eax
+  80206e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802072:	c9                   	leave
+  802073:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  802074:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802078:	75 e3                	jne    80205d <argnext+0x78>
+    args->curarg = 0;
+  80207a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802081:	00 
+    return -1;
+  802082:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802087:	eb e3                	jmp    80206c <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  802089:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  80208e:	89 d0                	mov    %edx,%eax
+  802090:	c3                   	ret
+
+0000000000802091 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  802091:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802095:	48 85 c0             	test   %rax,%rax
+  802098:	74 7b                	je     802115 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  80209a:	55                   	push   %rbp
+  80209b:	48 89 e5             	mov    %rsp,%rbp
+  80209e:	53                   	push   %rbx
+  80209f:	48 83 ec 08          	sub    $0x8,%rsp
+  8020a3:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  8020a6:	80 38 00             	cmpb   $0x0,(%rax)
+  8020a9:	74 1c                	je     8020c7 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  8020ab:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  8020af:	48 b8 1a 50 80 00 00 	movabs $0x80501a,%rax
+  8020b6:	00 00 00 
+  8020b9:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  8020bd:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  8020c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020c5:	c9                   	leave
+  8020c6:	c3                   	ret
+    } else if (*args->argc > 1) {
+  8020c7:	48 8b 07             	mov    (%rdi),%rax
+  8020ca:	83 38 01             	cmpl   $0x1,(%rax)
+  8020cd:	7f 12                	jg     8020e1 <argnextvalue+0x50>
+        args->argvalue = 0;
+  8020cf:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8020d6:	00 
+        args->curarg = 0;
+  8020d7:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  8020de:	00 
+  8020df:	eb dc                	jmp    8020bd <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  8020e1:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8020e5:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8020e9:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8020ed:	8b 10                	mov    (%rax),%edx
+  8020ef:	83 ea 01             	sub    $0x1,%edx
+  8020f2:	48 63 d2             	movslq %edx,%rdx
+  8020f5:	48 c1 e2 03          	shl    $0x3,%rdx
+  8020f9:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8020fd:	48 83 c7 08          	add    $0x8,%rdi
+  802101:	48 b8 d0 11 80 00 00 	movabs $0x8011d0,%rax
+  802108:	00 00 00 
+  80210b:	ff d0                	call   *%rax
+        (*args->argc)--;
+  80210d:	48 8b 03             	mov    (%rbx),%rax
+  802110:	83 28 01             	subl   $0x1,(%rax)
+  802113:	eb a8                	jmp    8020bd <argnextvalue+0x2c>
+}
+  802115:	c3                   	ret
+
+0000000000802116 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802116:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  80211a:	48 85 c0             	test   %rax,%rax
+  80211d:	74 01                	je     802120 <argvalue+0xa>
+}
+  80211f:	c3                   	ret
+argvalue(struct Argstate *args) {
+  802120:	55                   	push   %rbp
+  802121:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802124:	48 b8 91 20 80 00 00 	movabs $0x802091,%rax
+  80212b:	00 00 00 
+  80212e:	ff d0                	call   *%rax
+}
+  802130:	5d                   	pop    %rbp
+  802131:	c3                   	ret
+
+0000000000802132 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802132:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802139:	ff ff ff 
+  80213c:	48 01 f8             	add    %rdi,%rax
+  80213f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802143:	c3                   	ret
+
+0000000000802144 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802144:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80214b:	ff ff ff 
+  80214e:	48 01 f8             	add    %rdi,%rax
+  802151:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802155:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80215b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80215f:	c3                   	ret
+
+0000000000802160 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802160:	55                   	push   %rbp
+  802161:	48 89 e5             	mov    %rsp,%rbp
+  802164:	41 57                	push   %r15
+  802166:	41 56                	push   %r14
+  802168:	41 55                	push   %r13
+  80216a:	41 54                	push   %r12
+  80216c:	53                   	push   %rbx
+  80216d:	48 83 ec 08          	sub    $0x8,%rsp
+  802171:	49 89 ff             	mov    %rdi,%r15
+  802174:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802179:	49 bd 14 40 80 00 00 	movabs $0x804014,%r13
+  802180:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802183:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802189:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80218c:	48 89 df             	mov    %rbx,%rdi
+  80218f:	41 ff d5             	call   *%r13
+  802192:	83 e0 04             	and    $0x4,%eax
+  802195:	74 17                	je     8021ae <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802197:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80219e:	4c 39 f3             	cmp    %r14,%rbx
+  8021a1:	75 e6                	jne    802189 <fd_alloc+0x29>
+  8021a3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8021a9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8021ae:	4d 89 27             	mov    %r12,(%r15)
+}
+  8021b1:	48 83 c4 08          	add    $0x8,%rsp
+  8021b5:	5b                   	pop    %rbx
+  8021b6:	41 5c                	pop    %r12
+  8021b8:	41 5d                	pop    %r13
+  8021ba:	41 5e                	pop    %r14
+  8021bc:	41 5f                	pop    %r15
+  8021be:	5d                   	pop    %rbp
+  8021bf:	c3                   	ret
+
+00000000008021c0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8021c0:	83 ff 1f             	cmp    $0x1f,%edi
+  8021c3:	77 39                	ja     8021fe <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8021c5:	55                   	push   %rbp
+  8021c6:	48 89 e5             	mov    %rsp,%rbp
+  8021c9:	41 54                	push   %r12
+  8021cb:	53                   	push   %rbx
+  8021cc:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8021cf:	48 63 df             	movslq %edi,%rbx
+  8021d2:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8021d9:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8021dd:	48 89 df             	mov    %rbx,%rdi
+  8021e0:	48 b8 14 40 80 00 00 	movabs $0x804014,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+  8021ec:	a8 04                	test   $0x4,%al
+  8021ee:	74 14                	je     802204 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8021f0:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8021f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021f9:	5b                   	pop    %rbx
+  8021fa:	41 5c                	pop    %r12
+  8021fc:	5d                   	pop    %rbp
+  8021fd:	c3                   	ret
+        return -E_INVAL;
+  8021fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802203:	c3                   	ret
+        return -E_INVAL;
+  802204:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802209:	eb ee                	jmp    8021f9 <fd_lookup+0x39>
+
+000000000080220b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80220b:	55                   	push   %rbp
+  80220c:	48 89 e5             	mov    %rsp,%rbp
+  80220f:	41 54                	push   %r12
+  802211:	53                   	push   %rbx
+  802212:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802215:	48 b8 20 58 80 00 00 	movabs $0x805820,%rax
+  80221c:	00 00 00 
+  80221f:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802226:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802229:	39 3b                	cmp    %edi,(%rbx)
+  80222b:	74 47                	je     802274 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80222d:	48 83 c0 08          	add    $0x8,%rax
+  802231:	48 8b 18             	mov    (%rax),%rbx
+  802234:	48 85 db             	test   %rbx,%rbx
+  802237:	75 f0                	jne    802229 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802239:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802240:	00 00 00 
+  802243:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802249:	89 fa                	mov    %edi,%edx
+  80224b:	48 bf 88 57 80 00 00 	movabs $0x805788,%rdi
+  802252:	00 00 00 
+  802255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225a:	48 b9 ca 04 80 00 00 	movabs $0x8004ca,%rcx
+  802261:	00 00 00 
+  802264:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802266:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80226b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80226f:	5b                   	pop    %rbx
+  802270:	41 5c                	pop    %r12
+  802272:	5d                   	pop    %rbp
+  802273:	c3                   	ret
+            return 0;
+  802274:	b8 00 00 00 00       	mov    $0x0,%eax
+  802279:	eb f0                	jmp    80226b <dev_lookup+0x60>
+
+000000000080227b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80227b:	55                   	push   %rbp
+  80227c:	48 89 e5             	mov    %rsp,%rbp
+  80227f:	41 55                	push   %r13
+  802281:	41 54                	push   %r12
+  802283:	53                   	push   %rbx
+  802284:	48 83 ec 18          	sub    $0x18,%rsp
+  802288:	48 89 fb             	mov    %rdi,%rbx
+  80228b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80228e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802295:	ff ff ff 
+  802298:	48 01 df             	add    %rbx,%rdi
+  80229b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80229f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022a3:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  8022aa:	00 00 00 
+  8022ad:	ff d0                	call   *%rax
+  8022af:	41 89 c5             	mov    %eax,%r13d
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	78 06                	js     8022bc <fd_close+0x41>
+  8022b6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8022ba:	74 1a                	je     8022d6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8022bc:	45 84 e4             	test   %r12b,%r12b
+  8022bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8022c8:	44 89 e8             	mov    %r13d,%eax
+  8022cb:	48 83 c4 18          	add    $0x18,%rsp
+  8022cf:	5b                   	pop    %rbx
+  8022d0:	41 5c                	pop    %r12
+  8022d2:	41 5d                	pop    %r13
+  8022d4:	5d                   	pop    %rbp
+  8022d5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8022d6:	8b 3b                	mov    (%rbx),%edi
+  8022d8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022dc:	48 b8 0b 22 80 00 00 	movabs $0x80220b,%rax
+  8022e3:	00 00 00 
+  8022e6:	ff d0                	call   *%rax
+  8022e8:	41 89 c5             	mov    %eax,%r13d
+  8022eb:	85 c0                	test   %eax,%eax
+  8022ed:	78 1b                	js     80230a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8022ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022f3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8022f7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8022fd:	48 85 c0             	test   %rax,%rax
+  802300:	74 08                	je     80230a <fd_close+0x8f>
+  802302:	48 89 df             	mov    %rbx,%rdi
+  802305:	ff d0                	call   *%rax
+  802307:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80230a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80230f:	48 89 de             	mov    %rbx,%rsi
+  802312:	bf 00 00 00 00       	mov    $0x0,%edi
+  802317:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  80231e:	00 00 00 
+  802321:	ff d0                	call   *%rax
+    return res;
+  802323:	eb a3                	jmp    8022c8 <fd_close+0x4d>
+
+0000000000802325 <close>:
+
+int
+close(int fdnum) {
+  802325:	55                   	push   %rbp
+  802326:	48 89 e5             	mov    %rsp,%rbp
+  802329:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80232d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802331:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  802338:	00 00 00 
+  80233b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80233d:	85 c0                	test   %eax,%eax
+  80233f:	78 15                	js     802356 <close+0x31>
+
+    return fd_close(fd, 1);
+  802341:	be 01 00 00 00       	mov    $0x1,%esi
+  802346:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80234a:	48 b8 7b 22 80 00 00 	movabs $0x80227b,%rax
+  802351:	00 00 00 
+  802354:	ff d0                	call   *%rax
+}
+  802356:	c9                   	leave
+  802357:	c3                   	ret
+
+0000000000802358 <close_all>:
+
+void
+close_all(void) {
+  802358:	55                   	push   %rbp
+  802359:	48 89 e5             	mov    %rsp,%rbp
+  80235c:	41 54                	push   %r12
+  80235e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80235f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802364:	49 bc 25 23 80 00 00 	movabs $0x802325,%r12
+  80236b:	00 00 00 
+  80236e:	89 df                	mov    %ebx,%edi
+  802370:	41 ff d4             	call   *%r12
+  802373:	83 c3 01             	add    $0x1,%ebx
+  802376:	83 fb 20             	cmp    $0x20,%ebx
+  802379:	75 f3                	jne    80236e <close_all+0x16>
+}
+  80237b:	5b                   	pop    %rbx
+  80237c:	41 5c                	pop    %r12
+  80237e:	5d                   	pop    %rbp
+  80237f:	c3                   	ret
+
+0000000000802380 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802380:	55                   	push   %rbp
+  802381:	48 89 e5             	mov    %rsp,%rbp
+  802384:	41 57                	push   %r15
+  802386:	41 56                	push   %r14
+  802388:	41 55                	push   %r13
+  80238a:	41 54                	push   %r12
+  80238c:	53                   	push   %rbx
+  80238d:	48 83 ec 18          	sub    $0x18,%rsp
+  802391:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802394:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802398:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  80239f:	00 00 00 
+  8023a2:	ff d0                	call   *%rax
+  8023a4:	89 c3                	mov    %eax,%ebx
+  8023a6:	85 c0                	test   %eax,%eax
+  8023a8:	0f 88 b8 00 00 00    	js     802466 <dup+0xe6>
+    close(newfdnum);
+  8023ae:	44 89 e7             	mov    %r12d,%edi
+  8023b1:	48 b8 25 23 80 00 00 	movabs $0x802325,%rax
+  8023b8:	00 00 00 
+  8023bb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8023bd:	4d 63 ec             	movslq %r12d,%r13
+  8023c0:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8023c7:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8023cb:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8023cf:	4c 89 ff             	mov    %r15,%rdi
+  8023d2:	49 be 44 21 80 00 00 	movabs $0x802144,%r14
+  8023d9:	00 00 00 
+  8023dc:	41 ff d6             	call   *%r14
+  8023df:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8023e2:	4c 89 ef             	mov    %r13,%rdi
+  8023e5:	41 ff d6             	call   *%r14
+  8023e8:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8023eb:	48 89 df             	mov    %rbx,%rdi
+  8023ee:	48 b8 14 40 80 00 00 	movabs $0x804014,%rax
+  8023f5:	00 00 00 
+  8023f8:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8023fa:	a8 04                	test   $0x4,%al
+  8023fc:	74 2b                	je     802429 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8023fe:	41 89 c1             	mov    %eax,%r9d
+  802401:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802407:	4c 89 f1             	mov    %r14,%rcx
+  80240a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80240f:	48 89 de             	mov    %rbx,%rsi
+  802412:	bf 00 00 00 00       	mov    $0x0,%edi
+  802417:	48 b8 09 16 80 00 00 	movabs $0x801609,%rax
+  80241e:	00 00 00 
+  802421:	ff d0                	call   *%rax
+  802423:	89 c3                	mov    %eax,%ebx
+  802425:	85 c0                	test   %eax,%eax
+  802427:	78 4e                	js     802477 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802429:	4c 89 ff             	mov    %r15,%rdi
+  80242c:	48 b8 14 40 80 00 00 	movabs $0x804014,%rax
+  802433:	00 00 00 
+  802436:	ff d0                	call   *%rax
+  802438:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80243b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802441:	4c 89 e9             	mov    %r13,%rcx
+  802444:	ba 00 00 00 00       	mov    $0x0,%edx
+  802449:	4c 89 fe             	mov    %r15,%rsi
+  80244c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802451:	48 b8 09 16 80 00 00 	movabs $0x801609,%rax
+  802458:	00 00 00 
+  80245b:	ff d0                	call   *%rax
+  80245d:	89 c3                	mov    %eax,%ebx
+  80245f:	85 c0                	test   %eax,%eax
+  802461:	78 14                	js     802477 <dup+0xf7>
+
+    return newfdnum;
+  802463:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802466:	89 d8                	mov    %ebx,%eax
+  802468:	48 83 c4 18          	add    $0x18,%rsp
+  80246c:	5b                   	pop    %rbx
+  80246d:	41 5c                	pop    %r12
+  80246f:	41 5d                	pop    %r13
+  802471:	41 5e                	pop    %r14
+  802473:	41 5f                	pop    %r15
+  802475:	5d                   	pop    %rbp
+  802476:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802477:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80247c:	4c 89 ee             	mov    %r13,%rsi
+  80247f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802484:	49 bc 81 17 80 00 00 	movabs $0x801781,%r12
+  80248b:	00 00 00 
+  80248e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802491:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802496:	4c 89 f6             	mov    %r14,%rsi
+  802499:	bf 00 00 00 00       	mov    $0x0,%edi
+  80249e:	41 ff d4             	call   *%r12
+    return res;
+  8024a1:	eb c3                	jmp    802466 <dup+0xe6>
+
+00000000008024a3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8024a3:	55                   	push   %rbp
+  8024a4:	48 89 e5             	mov    %rsp,%rbp
+  8024a7:	41 56                	push   %r14
+  8024a9:	41 55                	push   %r13
+  8024ab:	41 54                	push   %r12
+  8024ad:	53                   	push   %rbx
+  8024ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8024b2:	89 fb                	mov    %edi,%ebx
+  8024b4:	49 89 f4             	mov    %rsi,%r12
+  8024b7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024ba:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8024be:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+  8024ca:	85 c0                	test   %eax,%eax
+  8024cc:	78 4c                	js     80251a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024ce:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8024d2:	41 8b 3e             	mov    (%r14),%edi
+  8024d5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024d9:	48 b8 0b 22 80 00 00 	movabs $0x80220b,%rax
+  8024e0:	00 00 00 
+  8024e3:	ff d0                	call   *%rax
+  8024e5:	85 c0                	test   %eax,%eax
+  8024e7:	78 35                	js     80251e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8024e9:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8024ed:	83 e0 03             	and    $0x3,%eax
+  8024f0:	83 f8 01             	cmp    $0x1,%eax
+  8024f3:	74 2d                	je     802522 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8024f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024f9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8024fd:	48 85 c0             	test   %rax,%rax
+  802500:	74 56                	je     802558 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802502:	4c 89 ea             	mov    %r13,%rdx
+  802505:	4c 89 e6             	mov    %r12,%rsi
+  802508:	4c 89 f7             	mov    %r14,%rdi
+  80250b:	ff d0                	call   *%rax
+}
+  80250d:	48 83 c4 10          	add    $0x10,%rsp
+  802511:	5b                   	pop    %rbx
+  802512:	41 5c                	pop    %r12
+  802514:	41 5d                	pop    %r13
+  802516:	41 5e                	pop    %r14
+  802518:	5d                   	pop    %rbp
+  802519:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80251a:	48 98                	cltq
+  80251c:	eb ef                	jmp    80250d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80251e:	48 98                	cltq
+  802520:	eb eb                	jmp    80250d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802522:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802529:	00 00 00 
+  80252c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802532:	89 da                	mov    %ebx,%edx
+  802534:	48 bf c9 57 80 00 00 	movabs $0x8057c9,%rdi
+  80253b:	00 00 00 
+  80253e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802543:	48 b9 ca 04 80 00 00 	movabs $0x8004ca,%rcx
+  80254a:	00 00 00 
+  80254d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80254f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802556:	eb b5                	jmp    80250d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802558:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80255f:	eb ac                	jmp    80250d <read+0x6a>
+
+0000000000802561 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802561:	55                   	push   %rbp
+  802562:	48 89 e5             	mov    %rsp,%rbp
+  802565:	41 57                	push   %r15
+  802567:	41 56                	push   %r14
+  802569:	41 55                	push   %r13
+  80256b:	41 54                	push   %r12
+  80256d:	53                   	push   %rbx
+  80256e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802572:	48 85 d2             	test   %rdx,%rdx
+  802575:	74 54                	je     8025cb <readn+0x6a>
+  802577:	41 89 fd             	mov    %edi,%r13d
+  80257a:	49 89 f6             	mov    %rsi,%r14
+  80257d:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802580:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802585:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80258a:	49 bf a3 24 80 00 00 	movabs $0x8024a3,%r15
+  802591:	00 00 00 
+  802594:	4c 89 e2             	mov    %r12,%rdx
+  802597:	48 29 f2             	sub    %rsi,%rdx
+  80259a:	4c 01 f6             	add    %r14,%rsi
+  80259d:	44 89 ef             	mov    %r13d,%edi
+  8025a0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8025a3:	85 c0                	test   %eax,%eax
+  8025a5:	78 20                	js     8025c7 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8025a7:	01 c3                	add    %eax,%ebx
+  8025a9:	85 c0                	test   %eax,%eax
+  8025ab:	74 08                	je     8025b5 <readn+0x54>
+  8025ad:	48 63 f3             	movslq %ebx,%rsi
+  8025b0:	4c 39 e6             	cmp    %r12,%rsi
+  8025b3:	72 df                	jb     802594 <readn+0x33>
+    }
+    return res;
+  8025b5:	48 63 c3             	movslq %ebx,%rax
+}
+  8025b8:	48 83 c4 08          	add    $0x8,%rsp
+  8025bc:	5b                   	pop    %rbx
+  8025bd:	41 5c                	pop    %r12
+  8025bf:	41 5d                	pop    %r13
+  8025c1:	41 5e                	pop    %r14
+  8025c3:	41 5f                	pop    %r15
+  8025c5:	5d                   	pop    %rbp
+  8025c6:	c3                   	ret
+        if (inc < 0) return inc;
+  8025c7:	48 98                	cltq
+  8025c9:	eb ed                	jmp    8025b8 <readn+0x57>
+    int inc = 1, res = 0;
+  8025cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025d0:	eb e3                	jmp    8025b5 <readn+0x54>
+
+00000000008025d2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8025d2:	55                   	push   %rbp
+  8025d3:	48 89 e5             	mov    %rsp,%rbp
+  8025d6:	41 56                	push   %r14
+  8025d8:	41 55                	push   %r13
+  8025da:	41 54                	push   %r12
+  8025dc:	53                   	push   %rbx
+  8025dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8025e1:	89 fb                	mov    %edi,%ebx
+  8025e3:	49 89 f4             	mov    %rsi,%r12
+  8025e6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025e9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025ed:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  8025f4:	00 00 00 
+  8025f7:	ff d0                	call   *%rax
+  8025f9:	85 c0                	test   %eax,%eax
+  8025fb:	78 47                	js     802644 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025fd:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802601:	41 8b 3e             	mov    (%r14),%edi
+  802604:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802608:	48 b8 0b 22 80 00 00 	movabs $0x80220b,%rax
+  80260f:	00 00 00 
+  802612:	ff d0                	call   *%rax
+  802614:	85 c0                	test   %eax,%eax
+  802616:	78 30                	js     802648 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802618:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80261d:	74 2d                	je     80264c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80261f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802623:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802627:	48 85 c0             	test   %rax,%rax
+  80262a:	74 56                	je     802682 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80262c:	4c 89 ea             	mov    %r13,%rdx
+  80262f:	4c 89 e6             	mov    %r12,%rsi
+  802632:	4c 89 f7             	mov    %r14,%rdi
+  802635:	ff d0                	call   *%rax
+}
+  802637:	48 83 c4 10          	add    $0x10,%rsp
+  80263b:	5b                   	pop    %rbx
+  80263c:	41 5c                	pop    %r12
+  80263e:	41 5d                	pop    %r13
+  802640:	41 5e                	pop    %r14
+  802642:	5d                   	pop    %rbp
+  802643:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802644:	48 98                	cltq
+  802646:	eb ef                	jmp    802637 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802648:	48 98                	cltq
+  80264a:	eb eb                	jmp    802637 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80264c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802653:	00 00 00 
+  802656:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80265c:	89 da                	mov    %ebx,%edx
+  80265e:	48 bf e5 57 80 00 00 	movabs $0x8057e5,%rdi
+  802665:	00 00 00 
+  802668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266d:	48 b9 ca 04 80 00 00 	movabs $0x8004ca,%rcx
+  802674:	00 00 00 
+  802677:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802679:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802680:	eb b5                	jmp    802637 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802682:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802689:	eb ac                	jmp    802637 <write+0x65>
+
+000000000080268b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80268b:	55                   	push   %rbp
+  80268c:	48 89 e5             	mov    %rsp,%rbp
+  80268f:	53                   	push   %rbx
+  802690:	48 83 ec 18          	sub    $0x18,%rsp
+  802694:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802696:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80269a:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  8026a1:	00 00 00 
+  8026a4:	ff d0                	call   *%rax
+  8026a6:	85 c0                	test   %eax,%eax
+  8026a8:	78 0c                	js     8026b6 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8026aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026ae:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8026b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ba:	c9                   	leave
+  8026bb:	c3                   	ret
+
+00000000008026bc <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8026bc:	55                   	push   %rbp
+  8026bd:	48 89 e5             	mov    %rsp,%rbp
+  8026c0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8026c4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026c8:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  8026cf:	00 00 00 
+  8026d2:	ff d0                	call   *%rax
+  8026d4:	85 c0                	test   %eax,%eax
+  8026d6:	78 07                	js     8026df <tell+0x23>
+    return fdes->fd_offset;
+  8026d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026dc:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8026df:	c9                   	leave
+  8026e0:	c3                   	ret
+
+00000000008026e1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8026e1:	55                   	push   %rbp
+  8026e2:	48 89 e5             	mov    %rsp,%rbp
+  8026e5:	41 55                	push   %r13
+  8026e7:	41 54                	push   %r12
+  8026e9:	53                   	push   %rbx
+  8026ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8026ee:	89 fb                	mov    %edi,%ebx
+  8026f0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026f3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026f7:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  8026fe:	00 00 00 
+  802701:	ff d0                	call   *%rax
+  802703:	85 c0                	test   %eax,%eax
+  802705:	78 38                	js     80273f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802707:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80270b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80270f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802713:	48 b8 0b 22 80 00 00 	movabs $0x80220b,%rax
+  80271a:	00 00 00 
+  80271d:	ff d0                	call   *%rax
+  80271f:	85 c0                	test   %eax,%eax
+  802721:	78 1c                	js     80273f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802723:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802728:	74 20                	je     80274a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80272a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80272e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802732:	48 85 c0             	test   %rax,%rax
+  802735:	74 47                	je     80277e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802737:	44 89 e6             	mov    %r12d,%esi
+  80273a:	4c 89 ef             	mov    %r13,%rdi
+  80273d:	ff d0                	call   *%rax
+}
+  80273f:	48 83 c4 18          	add    $0x18,%rsp
+  802743:	5b                   	pop    %rbx
+  802744:	41 5c                	pop    %r12
+  802746:	41 5d                	pop    %r13
+  802748:	5d                   	pop    %rbp
+  802749:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80274a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802751:	00 00 00 
+  802754:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80275a:	89 da                	mov    %ebx,%edx
+  80275c:	48 bf a8 57 80 00 00 	movabs $0x8057a8,%rdi
+  802763:	00 00 00 
+  802766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276b:	48 b9 ca 04 80 00 00 	movabs $0x8004ca,%rcx
+  802772:	00 00 00 
+  802775:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802777:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80277c:	eb c1                	jmp    80273f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80277e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802783:	eb ba                	jmp    80273f <ftruncate+0x5e>
+
+0000000000802785 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802785:	55                   	push   %rbp
+  802786:	48 89 e5             	mov    %rsp,%rbp
+  802789:	41 54                	push   %r12
+  80278b:	53                   	push   %rbx
+  80278c:	48 83 ec 10          	sub    $0x10,%rsp
+  802790:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802793:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802797:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+  8027a3:	85 c0                	test   %eax,%eax
+  8027a5:	78 4e                	js     8027f5 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027a7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8027ab:	41 8b 3c 24          	mov    (%r12),%edi
+  8027af:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8027b3:	48 b8 0b 22 80 00 00 	movabs $0x80220b,%rax
+  8027ba:	00 00 00 
+  8027bd:	ff d0                	call   *%rax
+  8027bf:	85 c0                	test   %eax,%eax
+  8027c1:	78 32                	js     8027f5 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8027c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8027c7:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8027cc:	74 30                	je     8027fe <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8027ce:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8027d1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8027d8:	00 00 00 
+    stat->st_isdir = 0;
+  8027db:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027e2:	00 00 00 
+    stat->st_dev = dev;
+  8027e5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8027ec:	48 89 de             	mov    %rbx,%rsi
+  8027ef:	4c 89 e7             	mov    %r12,%rdi
+  8027f2:	ff 50 28             	call   *0x28(%rax)
+}
+  8027f5:	48 83 c4 10          	add    $0x10,%rsp
+  8027f9:	5b                   	pop    %rbx
+  8027fa:	41 5c                	pop    %r12
+  8027fc:	5d                   	pop    %rbp
+  8027fd:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8027fe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802803:	eb f0                	jmp    8027f5 <fstat+0x70>
+
+0000000000802805 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802805:	55                   	push   %rbp
+  802806:	48 89 e5             	mov    %rsp,%rbp
+  802809:	41 54                	push   %r12
+  80280b:	53                   	push   %rbx
+  80280c:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802813:	41 89 fc             	mov    %edi,%r12d
+  802816:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802818:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80281c:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  802823:	00 00 00 
+  802826:	ff d0                	call   *%rax
+  802828:	85 c0                	test   %eax,%eax
+  80282a:	78 31                	js     80285d <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  80282c:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802833:	44 89 e7             	mov    %r12d,%edi
+  802836:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  80283d:	00 00 00 
+  802840:	ff d0                	call   *%rax
+  802842:	85 c0                	test   %eax,%eax
+  802844:	78 17                	js     80285d <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802846:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80284a:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  80284d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802850:	39 d3                	cmp    %edx,%ebx
+  802852:	0f 4f da             	cmovg  %edx,%ebx
+  802855:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802858:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80285d:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802864:	5b                   	pop    %rbx
+  802865:	41 5c                	pop    %r12
+  802867:	5d                   	pop    %rbp
+  802868:	c3                   	ret
+
+0000000000802869 <seektoend>:
+{
+  802869:	55                   	push   %rbp
+  80286a:	48 89 e5             	mov    %rsp,%rbp
+  80286d:	53                   	push   %rbx
+  80286e:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802875:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802877:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80287b:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  802882:	00 00 00 
+  802885:	ff d0                	call   *%rax
+  802887:	85 c0                	test   %eax,%eax
+  802889:	78 28                	js     8028b3 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80288b:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802892:	89 df                	mov    %ebx,%edi
+  802894:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  80289b:	00 00 00 
+  80289e:	ff d0                	call   *%rax
+  8028a0:	85 c0                	test   %eax,%eax
+  8028a2:	78 0f                	js     8028b3 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8028a4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8028a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028ab:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8028ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b7:	c9                   	leave
+  8028b8:	c3                   	ret
+
+00000000008028b9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8028b9:	55                   	push   %rbp
+  8028ba:	48 89 e5             	mov    %rsp,%rbp
+  8028bd:	41 54                	push   %r12
+  8028bf:	53                   	push   %rbx
+  8028c0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8028c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c8:	48 b8 ac 34 80 00 00 	movabs $0x8034ac,%rax
+  8028cf:	00 00 00 
+  8028d2:	ff d0                	call   *%rax
+  8028d4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8028d6:	85 c0                	test   %eax,%eax
+  8028d8:	78 25                	js     8028ff <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8028da:	4c 89 e6             	mov    %r12,%rsi
+  8028dd:	89 c7                	mov    %eax,%edi
+  8028df:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  8028e6:	00 00 00 
+  8028e9:	ff d0                	call   *%rax
+  8028eb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8028ee:	89 df                	mov    %ebx,%edi
+  8028f0:	48 b8 25 23 80 00 00 	movabs $0x802325,%rax
+  8028f7:	00 00 00 
+  8028fa:	ff d0                	call   *%rax
+
+    return res;
+  8028fc:	44 89 e3             	mov    %r12d,%ebx
+}
+  8028ff:	89 d8                	mov    %ebx,%eax
+  802901:	5b                   	pop    %rbx
+  802902:	41 5c                	pop    %r12
+  802904:	5d                   	pop    %rbp
+  802905:	c3                   	ret
+
+0000000000802906 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802906:	55                   	push   %rbp
+  802907:	48 89 e5             	mov    %rsp,%rbp
+  80290a:	53                   	push   %rbx
+  80290b:	48 83 ec 08          	sub    $0x8,%rsp
+  80290f:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802912:	48 b8 32 21 80 00 00 	movabs $0x802132,%rax
+  802919:	00 00 00 
+  80291c:	ff d0                	call   *%rax
+  80291e:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802922:	0f 87 ea 00 00 00    	ja     802a12 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802928:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80292f:	00 00 00 
+  802932:	80 38 00             	cmpb   $0x0,(%rax)
+  802935:	75 35                	jne    80296c <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802937:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80293c:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802941:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802946:	bf 00 00 00 00       	mov    $0x0,%edi
+  80294b:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  802952:	00 00 00 
+  802955:	ff d0                	call   *%rax
+  802957:	85 c0                	test   %eax,%eax
+  802959:	0f 88 ba 00 00 00    	js     802a19 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80295f:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802966:	00 00 00 
+  802969:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  80296c:	48 89 df             	mov    %rbx,%rdi
+  80296f:	48 b8 32 21 80 00 00 	movabs $0x802132,%rax
+  802976:	00 00 00 
+  802979:	ff d0                	call   *%rax
+  80297b:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  80297f:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802986:	00 00 00 
+  802989:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80298d:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802990:	39 39                	cmp    %edi,(%rcx)
+  802992:	74 46                	je     8029da <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802994:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802998:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  80299f:	00 
+  8029a0:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8029a7:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8029ae:	00 
+  8029af:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8029b6:	00 
+  8029b7:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8029be:	00 
+  8029bf:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8029c6:	00 
+  8029c7:	89 39                	mov    %edi,(%rcx)
+  8029c9:	48 01 c6             	add    %rax,%rsi
+  8029cc:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8029d1:	48 89 c8             	mov    %rcx,%rax
+  8029d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029d8:	c9                   	leave
+  8029d9:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  8029da:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8029de:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  8029e5:	00 00 00 
+  8029e8:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8029eb:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  8029ef:	74 e0                	je     8029d1 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  8029f1:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8029f8:	00 
+  8029f9:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8029fd:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802a04:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802a06:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802a09:	48 01 c2             	add    %rax,%rdx
+  802a0c:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802a10:	eb bf                	jmp    8029d1 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802a12:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a17:	eb b8                	jmp    8029d1 <fbuf_get+0xcb>
+            return NULL;
+  802a19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a1e:	eb b1                	jmp    8029d1 <fbuf_get+0xcb>
+
+0000000000802a20 <fsipc_bulk>:
+fsipc_bulk(void) {
+  802a20:	55                   	push   %rbp
+  802a21:	48 89 e5             	mov    %rsp,%rbp
+  802a24:	53                   	push   %rbx
+  802a25:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802a29:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a30:	00 00 00 
+  802a33:	48 8b 18             	mov    (%rax),%rbx
+  802a36:	48 85 db             	test   %rbx,%rbx
+  802a39:	74 16                	je     802a51 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802a3b:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a42:	00 00 00 
+  802a45:	48 8b 18             	mov    (%rax),%rbx
+}
+  802a48:	48 89 d8             	mov    %rbx,%rax
+  802a4b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a4f:	c9                   	leave
+  802a50:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802a51:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a56:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802a5b:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802a60:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a65:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  802a6c:	00 00 00 
+  802a6f:	ff d0                	call   *%rax
+  802a71:	85 c0                	test   %eax,%eax
+  802a73:	78 d3                	js     802a48 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802a75:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802a7a:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802a81:	00 00 00 
+  802a84:	eb b5                	jmp    802a3b <fsipc_bulk+0x1b>
+
+0000000000802a86 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802a86:	55                   	push   %rbp
+  802a87:	48 89 e5             	mov    %rsp,%rbp
+  802a8a:	41 57                	push   %r15
+  802a8c:	41 56                	push   %r14
+  802a8e:	41 55                	push   %r13
+  802a90:	41 54                	push   %r12
+  802a92:	53                   	push   %rbx
+  802a93:	48 83 ec 08          	sub    $0x8,%rsp
+  802a97:	41 89 fd             	mov    %edi,%r13d
+  802a9a:	49 89 f6             	mov    %rsi,%r14
+  802a9d:	49 89 d7             	mov    %rdx,%r15
+  802aa0:	48 89 cb             	mov    %rcx,%rbx
+  802aa3:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802aa6:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802aad:	00 00 00 
+  802ab0:	83 38 00             	cmpl   $0x0,(%rax)
+  802ab3:	74 52                	je     802b07 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802ab5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802abb:	4c 89 f9             	mov    %r15,%rcx
+  802abe:	4c 89 f2             	mov    %r14,%rdx
+  802ac1:	44 89 ee             	mov    %r13d,%esi
+  802ac4:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802acb:	00 00 00 
+  802ace:	8b 38                	mov    (%rax),%edi
+  802ad0:	48 b8 0e 46 80 00 00 	movabs $0x80460e,%rax
+  802ad7:	00 00 00 
+  802ada:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802adc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ae1:	4c 89 e2             	mov    %r12,%rdx
+  802ae4:	48 89 de             	mov    %rbx,%rsi
+  802ae7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aec:	48 b8 5e 44 80 00 00 	movabs $0x80445e,%rax
+  802af3:	00 00 00 
+  802af6:	ff d0                	call   *%rax
+}
+  802af8:	48 83 c4 08          	add    $0x8,%rsp
+  802afc:	5b                   	pop    %rbx
+  802afd:	41 5c                	pop    %r12
+  802aff:	41 5d                	pop    %r13
+  802b01:	41 5e                	pop    %r14
+  802b03:	41 5f                	pop    %r15
+  802b05:	5d                   	pop    %rbp
+  802b06:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b07:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b0c:	48 b8 b1 46 80 00 00 	movabs $0x8046b1,%rax
+  802b13:	00 00 00 
+  802b16:	ff d0                	call   *%rax
+  802b18:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802b1f:	00 00 
+  802b21:	eb 92                	jmp    802ab5 <fsipc_region+0x2f>
+
+0000000000802b23 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802b23:	55                   	push   %rbp
+  802b24:	48 89 e5             	mov    %rsp,%rbp
+  802b27:	41 57                	push   %r15
+  802b29:	41 56                	push   %r14
+  802b2b:	41 55                	push   %r13
+  802b2d:	41 54                	push   %r12
+  802b2f:	53                   	push   %rbx
+  802b30:	48 83 ec 28          	sub    $0x28,%rsp
+  802b34:	49 89 ff             	mov    %rdi,%r15
+  802b37:	49 89 f6             	mov    %rsi,%r14
+  802b3a:	48 89 d3             	mov    %rdx,%rbx
+  802b3d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802b41:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802b44:	48 b8 20 2a 80 00 00 	movabs $0x802a20,%rax
+  802b4b:	00 00 00 
+  802b4e:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802b50:	48 85 c0             	test   %rax,%rax
+  802b53:	0f 84 cc 00 00 00    	je     802c25 <devfile_write_direct+0x102>
+  802b59:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802b5c:	48 85 db             	test   %rbx,%rbx
+  802b5f:	0f 84 ba 00 00 00    	je     802c1f <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802b65:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b6b:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802b72:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802b76:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802b7a:	4c 29 e3             	sub    %r12,%rbx
+  802b7d:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802b82:	48 39 c3             	cmp    %rax,%rbx
+  802b85:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b89:	48 89 da             	mov    %rbx,%rdx
+  802b8c:	4c 89 f6             	mov    %r14,%rsi
+  802b8f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802b93:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  802b9a:	00 00 00 
+  802b9d:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802b9f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802ba3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802ba7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802baa:	44 01 e0             	add    %r12d,%eax
+  802bad:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802bb1:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802bb5:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802bbc:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802bc3:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802bca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802bd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bd5:	4c 89 ee             	mov    %r13,%rsi
+  802bd8:	bf 04 00 00 00       	mov    $0x4,%edi
+  802bdd:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  802be4:	00 00 00 
+  802be7:	ff d0                	call   *%rax
+        if (res < 0)
+  802be9:	85 c0                	test   %eax,%eax
+  802beb:	78 29                	js     802c16 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802bed:	74 2b                	je     802c1a <devfile_write_direct+0xf7>
+        i += res;
+  802bef:	48 98                	cltq
+  802bf1:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802bf4:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802bf7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bfb:	49 39 c4             	cmp    %rax,%r12
+  802bfe:	0f 82 72 ff ff ff    	jb     802b76 <devfile_write_direct+0x53>
+    return i;
+  802c04:	4c 89 e0             	mov    %r12,%rax
+}
+  802c07:	48 83 c4 28          	add    $0x28,%rsp
+  802c0b:	5b                   	pop    %rbx
+  802c0c:	41 5c                	pop    %r12
+  802c0e:	41 5d                	pop    %r13
+  802c10:	41 5e                	pop    %r14
+  802c12:	41 5f                	pop    %r15
+  802c14:	5d                   	pop    %rbp
+  802c15:	c3                   	ret
+            return res;
+  802c16:	48 98                	cltq
+  802c18:	eb ed                	jmp    802c07 <devfile_write_direct+0xe4>
+            return i;
+  802c1a:	4c 89 e0             	mov    %r12,%rax
+  802c1d:	eb e8                	jmp    802c07 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802c1f:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802c23:	eb df                	jmp    802c04 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802c25:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802c2c:	eb d9                	jmp    802c07 <devfile_write_direct+0xe4>
+
+0000000000802c2e <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802c2e:	55                   	push   %rbp
+  802c2f:	48 89 e5             	mov    %rsp,%rbp
+  802c32:	41 56                	push   %r14
+  802c34:	41 55                	push   %r13
+  802c36:	41 54                	push   %r12
+  802c38:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802c39:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802c3d:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802c41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c46:	4d 39 ee             	cmp    %r13,%r14
+  802c49:	0f 84 99 00 00 00    	je     802ce8 <fbuf_flush+0xba>
+  802c4f:	49 89 fc             	mov    %rdi,%r12
+  802c52:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802c55:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c58:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c5c:	48 b8 32 21 80 00 00 	movabs $0x802132,%rax
+  802c63:	00 00 00 
+  802c66:	ff d0                	call   *%rax
+  802c68:	48 89 c2             	mov    %rax,%rdx
+  802c6b:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c6f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c73:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c77:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802c7c:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c7f:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c83:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802c8a:	00 
+  802c8b:	44 89 f1             	mov    %r14d,%ecx
+  802c8e:	4c 89 ea             	mov    %r13,%rdx
+  802c91:	4c 89 e7             	mov    %r12,%rdi
+  802c94:	48 b8 23 2b 80 00 00 	movabs $0x802b23,%rax
+  802c9b:	00 00 00 
+  802c9e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ca0:	48 85 c0             	test   %rax,%rax
+  802ca3:	78 43                	js     802ce8 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802ca5:	4c 39 e8             	cmp    %r13,%rax
+  802ca8:	72 47                	jb     802cf1 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802caa:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802caf:	83 c0 01             	add    $0x1,%eax
+  802cb2:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802cb7:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802cba:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802cbe:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802cc2:	72 0f                	jb     802cd3 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802cc4:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802cc8:	48 39 c2             	cmp    %rax,%rdx
+  802ccb:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802ccf:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802cd3:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802cda:	00 
+  802cdb:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802ce2:	00 
+    return 0;
+  802ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ce8:	5b                   	pop    %rbx
+  802ce9:	41 5c                	pop    %r12
+  802ceb:	41 5d                	pop    %r13
+  802ced:	41 5e                	pop    %r14
+  802cef:	5d                   	pop    %rbp
+  802cf0:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802cf1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802cf6:	eb f0                	jmp    802ce8 <fbuf_flush+0xba>
+
+0000000000802cf8 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802cf8:	55                   	push   %rbp
+  802cf9:	48 89 e5             	mov    %rsp,%rbp
+  802cfc:	53                   	push   %rbx
+  802cfd:	48 83 ec 08          	sub    $0x8,%rsp
+  802d01:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802d04:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  802d0b:	00 00 00 
+  802d0e:	ff d0                	call   *%rax
+  802d10:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d18:	48 85 f6             	test   %rsi,%rsi
+  802d1b:	74 0f                	je     802d2c <devfile_sync+0x34>
+  802d1d:	48 89 df             	mov    %rbx,%rdi
+  802d20:	48 b8 2e 2c 80 00 00 	movabs $0x802c2e,%rax
+  802d27:	00 00 00 
+  802d2a:	ff d0                	call   *%rax
+}
+  802d2c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d30:	c9                   	leave
+  802d31:	c3                   	ret
+
+0000000000802d32 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802d32:	55                   	push   %rbp
+  802d33:	48 89 e5             	mov    %rsp,%rbp
+  802d36:	48 83 ec 10          	sub    $0x10,%rsp
+  802d3a:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802d3d:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802d44:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802d45:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802d49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d4e:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802d55:	00 00 00 
+  802d58:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  802d5f:	00 00 00 
+  802d62:	ff d0                	call   *%rax
+}
+  802d64:	c9                   	leave
+  802d65:	c3                   	ret
+
+0000000000802d66 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d66:	55                   	push   %rbp
+  802d67:	48 89 e5             	mov    %rsp,%rbp
+  802d6a:	41 54                	push   %r12
+  802d6c:	53                   	push   %rbx
+  802d6d:	48 89 fb             	mov    %rdi,%rbx
+  802d70:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802d73:	48 b8 f8 2c 80 00 00 	movabs $0x802cf8,%rax
+  802d7a:	00 00 00 
+  802d7d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d7f:	85 c0                	test   %eax,%eax
+  802d81:	78 63                	js     802de6 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d83:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d86:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802d8d:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802d8f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d94:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d99:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  802da0:	00 00 00 
+  802da3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802da5:	85 c0                	test   %eax,%eax
+  802da7:	78 3d                	js     802de6 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802da9:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802db0:	00 00 00 
+  802db3:	48 89 de             	mov    %rbx,%rsi
+  802db6:	4c 89 e7             	mov    %r12,%rdi
+  802db9:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  802dc0:	00 00 00 
+  802dc3:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802dc5:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802dcb:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802dd2:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802dd3:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802dd9:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802de0:	00 
+
+    return 0;
+  802de1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802de6:	5b                   	pop    %rbx
+  802de7:	41 5c                	pop    %r12
+  802de9:	5d                   	pop    %rbp
+  802dea:	c3                   	ret
+
+0000000000802deb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802deb:	55                   	push   %rbp
+  802dec:	48 89 e5             	mov    %rsp,%rbp
+  802def:	41 54                	push   %r12
+  802df1:	53                   	push   %rbx
+  802df2:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802df5:	48 b8 f8 2c 80 00 00 	movabs $0x802cf8,%rax
+  802dfc:	00 00 00 
+  802dff:	ff d0                	call   *%rax
+  802e01:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802e04:	48 89 df             	mov    %rbx,%rdi
+  802e07:	48 b8 32 21 80 00 00 	movabs $0x802132,%rax
+  802e0e:	00 00 00 
+  802e11:	ff d0                	call   *%rax
+  802e13:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802e17:	76 2e                	jbe    802e47 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802e19:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e1c:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802e23:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802e25:	be 00 00 00 00       	mov    $0x0,%esi
+  802e2a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802e2f:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  802e36:	00 00 00 
+  802e39:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802e3b:	45 85 e4             	test   %r12d,%r12d
+  802e3e:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802e42:	5b                   	pop    %rbx
+  802e43:	41 5c                	pop    %r12
+  802e45:	5d                   	pop    %rbp
+  802e46:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802e47:	48 89 df             	mov    %rbx,%rdi
+  802e4a:	48 b8 32 21 80 00 00 	movabs $0x802132,%rax
+  802e51:	00 00 00 
+  802e54:	ff d0                	call   *%rax
+  802e56:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802e5a:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802e61:	00 00 00 
+  802e64:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802e6b:	48 89 df             	mov    %rbx,%rdi
+  802e6e:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  802e75:	00 00 00 
+  802e78:	ff d0                	call   *%rax
+  802e7a:	48 89 c6             	mov    %rax,%rsi
+  802e7d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e82:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e87:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  802e8e:	00 00 00 
+  802e91:	ff d0                	call   *%rax
+  802e93:	eb 84                	jmp    802e19 <devfile_flush+0x2e>
+
+0000000000802e95 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e95:	55                   	push   %rbp
+  802e96:	48 89 e5             	mov    %rsp,%rbp
+  802e99:	41 55                	push   %r13
+  802e9b:	41 54                	push   %r12
+  802e9d:	53                   	push   %rbx
+  802e9e:	48 83 ec 08          	sub    $0x8,%rsp
+  802ea2:	48 89 fb             	mov    %rdi,%rbx
+  802ea5:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802ea8:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  802eaf:	00 00 00 
+  802eb2:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802eb4:	48 85 c0             	test   %rax,%rax
+  802eb7:	74 51                	je     802f0a <devfile_trunc+0x75>
+  802eb9:	49 89 c4             	mov    %rax,%r12
+  802ebc:	48 89 c6             	mov    %rax,%rsi
+  802ebf:	48 89 df             	mov    %rbx,%rdi
+  802ec2:	48 b8 2e 2c 80 00 00 	movabs $0x802c2e,%rax
+  802ec9:	00 00 00 
+  802ecc:	ff d0                	call   *%rax
+  802ece:	85 c0                	test   %eax,%eax
+  802ed0:	78 2d                	js     802eff <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802ed2:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802ed9:	00 00 00 
+  802edc:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802edf:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802ee1:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ee5:	be 00 00 00 00       	mov    $0x0,%esi
+  802eea:	bf 02 00 00 00       	mov    $0x2,%edi
+  802eef:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  802ef6:	00 00 00 
+  802ef9:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802efb:	85 c0                	test   %eax,%eax
+  802efd:	79 3e                	jns    802f3d <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802eff:	48 83 c4 08          	add    $0x8,%rsp
+  802f03:	5b                   	pop    %rbx
+  802f04:	41 5c                	pop    %r12
+  802f06:	41 5d                	pop    %r13
+  802f08:	5d                   	pop    %rbp
+  802f09:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f0a:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802f11:	00 00 00 
+  802f14:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f17:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802f19:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802f1d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f22:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f27:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  802f2e:	00 00 00 
+  802f31:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802f33:	85 c0                	test   %eax,%eax
+  802f35:	78 c8                	js     802eff <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f37:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f3b:	eb c2                	jmp    802eff <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f3d:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802f40:	8d 51 01             	lea    0x1(%rcx),%edx
+  802f43:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f46:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802f4b:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f52:	00 00 
+  802f54:	eb a9                	jmp    802eff <devfile_trunc+0x6a>
+
+0000000000802f56 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802f56:	55                   	push   %rbp
+  802f57:	48 89 e5             	mov    %rsp,%rbp
+  802f5a:	41 57                	push   %r15
+  802f5c:	41 56                	push   %r14
+  802f5e:	41 55                	push   %r13
+  802f60:	41 54                	push   %r12
+  802f62:	53                   	push   %rbx
+  802f63:	48 83 ec 28          	sub    $0x28,%rsp
+  802f67:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f6b:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f6f:	49 89 d7             	mov    %rdx,%r15
+  802f72:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f76:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  802f7d:	00 00 00 
+  802f80:	ff d0                	call   *%rax
+  802f82:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802f85:	48 85 c0             	test   %rax,%rax
+  802f88:	74 31                	je     802fbb <devfile_write+0x65>
+  802f8a:	4c 89 f8             	mov    %r15,%rax
+  802f8d:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802f94:	77 25                	ja     802fbb <devfile_write+0x65>
+    size_t i = 0;
+  802f96:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802f9c:	48 85 c0             	test   %rax,%rax
+  802f9f:	0f 85 64 01 00 00    	jne    803109 <devfile_write+0x1b3>
+    size_t i = 0;
+  802fa5:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802fa9:	4c 89 f8             	mov    %r15,%rax
+}
+  802fac:	48 83 c4 28          	add    $0x28,%rsp
+  802fb0:	5b                   	pop    %rbx
+  802fb1:	41 5c                	pop    %r12
+  802fb3:	41 5d                	pop    %r13
+  802fb5:	41 5e                	pop    %r14
+  802fb7:	41 5f                	pop    %r15
+  802fb9:	5d                   	pop    %rbp
+  802fba:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802fbb:	48 85 db             	test   %rbx,%rbx
+  802fbe:	74 5b                	je     80301b <devfile_write+0xc5>
+  802fc0:	48 89 de             	mov    %rbx,%rsi
+  802fc3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fc7:	48 b8 2e 2c 80 00 00 	movabs $0x802c2e,%rax
+  802fce:	00 00 00 
+  802fd1:	ff d0                	call   *%rax
+  802fd3:	85 c0                	test   %eax,%eax
+  802fd5:	78 40                	js     803017 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802fd7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fdb:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802fde:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fe2:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802fe6:	48 b8 23 2b 80 00 00 	movabs $0x802b23,%rax
+  802fed:	00 00 00 
+  802ff0:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802ff2:	48 85 c0             	test   %rax,%rax
+  802ff5:	7e b5                	jle    802fac <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802ff7:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802ffb:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802ffe:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  803001:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803004:	8d 51 01             	lea    0x1(%rcx),%edx
+  803007:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80300a:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  80300d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803014:	00 
+  803015:	eb 95                	jmp    802fac <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803017:	48 98                	cltq
+  803019:	eb 91                	jmp    802fac <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80301b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80301f:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  803022:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803026:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80302a:	48 89 df             	mov    %rbx,%rdi
+  80302d:	48 b8 23 2b 80 00 00 	movabs $0x802b23,%rax
+  803034:	00 00 00 
+  803037:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803039:	48 85 c0             	test   %rax,%rax
+  80303c:	0f 8e 6a ff ff ff    	jle    802fac <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803042:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803045:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803049:	e9 5e ff ff ff       	jmp    802fac <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80304e:	48 98                	cltq
+  803050:	4d 85 ff             	test   %r15,%r15
+  803053:	49 0f 45 c7          	cmovne %r15,%rax
+  803057:	e9 50 ff ff ff       	jmp    802fac <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80305c:	48 89 de             	mov    %rbx,%rsi
+  80305f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803063:	48 b8 2e 2c 80 00 00 	movabs $0x802c2e,%rax
+  80306a:	00 00 00 
+  80306d:	ff d0                	call   *%rax
+  80306f:	85 c0                	test   %eax,%eax
+  803071:	0f 88 2b 01 00 00    	js     8031a2 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803077:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80307b:	4c 01 f8             	add    %r15,%rax
+  80307e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803082:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803086:	48 b9 32 21 80 00 00 	movabs $0x802132,%rcx
+  80308d:	00 00 00 
+  803090:	ff d1                	call   *%rcx
+  803092:	48 89 c2             	mov    %rax,%rdx
+  803095:	48 c1 e2 04          	shl    $0x4,%rdx
+  803099:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80309d:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030a1:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  8030a6:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8030a9:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8030b0:	00 
+  8030b1:	4c 89 ea             	mov    %r13,%rdx
+  8030b4:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8030b8:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8030bf:	00 00 00 
+  8030c2:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  8030c4:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8030c8:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8030cc:	48 39 c2             	cmp    %rax,%rdx
+  8030cf:	0f 84 db 00 00 00    	je     8031b0 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  8030d5:	4c 39 e2             	cmp    %r12,%rdx
+  8030d8:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  8030dc:	4d 01 ec             	add    %r13,%r12
+  8030df:	49 39 c4             	cmp    %rax,%r12
+  8030e2:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  8030e6:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  8030ea:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  8030ee:	45 01 ee             	add    %r13d,%r14d
+  8030f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030f5:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  8030f9:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  8030fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803100:	49 39 c7             	cmp    %rax,%r15
+  803103:	0f 83 a0 fe ff ff    	jae    802fa9 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803109:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80310d:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  803111:	8b 43 08             	mov    0x8(%rbx),%eax
+  803114:	44 39 f0             	cmp    %r14d,%eax
+  803117:	7f 10                	jg     803129 <devfile_write+0x1d3>
+  803119:	48 98                	cltq
+  80311b:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  803121:	49 63 d6             	movslq %r14d,%rdx
+  803124:	48 39 d0             	cmp    %rdx,%rax
+  803127:	7d 2d                	jge    803156 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803129:	48 89 de             	mov    %rbx,%rsi
+  80312c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803130:	48 b8 2e 2c 80 00 00 	movabs $0x802c2e,%rax
+  803137:	00 00 00 
+  80313a:	ff d0                	call   *%rax
+  80313c:	85 c0                	test   %eax,%eax
+  80313e:	0f 88 0a ff ff ff    	js     80304e <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803144:	44 89 f0             	mov    %r14d,%eax
+  803147:	66 b8 00 00          	mov    $0x0,%ax
+  80314b:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  80314e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803155:	00 
+        size_t off = pos - fb->fb_base;
+  803156:	45 89 f4             	mov    %r14d,%r12d
+  803159:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  80315d:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803160:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803164:	4d 29 fd             	sub    %r15,%r13
+  803167:	b8 00 00 01 00       	mov    $0x10000,%eax
+  80316c:	4c 29 e0             	sub    %r12,%rax
+  80316f:	49 39 c5             	cmp    %rax,%r13
+  803172:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803176:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80317a:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80317e:	48 39 c2             	cmp    %rax,%rdx
+  803181:	0f 84 f0 fe ff ff    	je     803077 <devfile_write+0x121>
+  803187:	4c 39 e0             	cmp    %r12,%rax
+  80318a:	0f 82 cc fe ff ff    	jb     80305c <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803190:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803194:	48 39 d0             	cmp    %rdx,%rax
+  803197:	0f 83 da fe ff ff    	jae    803077 <devfile_write+0x121>
+  80319d:	e9 ba fe ff ff       	jmp    80305c <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8031a2:	48 98                	cltq
+  8031a4:	4d 85 ff             	test   %r15,%r15
+  8031a7:	49 0f 45 c7          	cmovne %r15,%rax
+  8031ab:	e9 fc fd ff ff       	jmp    802fac <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  8031b0:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8031b4:	4c 89 e2             	mov    %r12,%rdx
+  8031b7:	e9 2a ff ff ff       	jmp    8030e6 <devfile_write+0x190>
+
+00000000008031bc <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8031bc:	55                   	push   %rbp
+  8031bd:	48 89 e5             	mov    %rsp,%rbp
+  8031c0:	41 57                	push   %r15
+  8031c2:	41 56                	push   %r14
+  8031c4:	41 55                	push   %r13
+  8031c6:	41 54                	push   %r12
+  8031c8:	53                   	push   %rbx
+  8031c9:	48 83 ec 28          	sub    $0x28,%rsp
+  8031cd:	49 89 ff             	mov    %rdi,%r15
+  8031d0:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8031d4:	48 89 d3             	mov    %rdx,%rbx
+  8031d7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8031db:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  8031e2:	00 00 00 
+  8031e5:	ff d0                	call   *%rax
+  8031e7:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8031ea:	48 85 c0             	test   %rax,%rax
+  8031ed:	74 0d                	je     8031fc <devfile_read+0x40>
+  8031ef:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8031f6:	0f 86 1a 01 00 00    	jbe    803316 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8031fc:	4d 85 e4             	test   %r12,%r12
+  8031ff:	74 1a                	je     80321b <devfile_read+0x5f>
+  803201:	4c 89 e6             	mov    %r12,%rsi
+  803204:	4c 89 ff             	mov    %r15,%rdi
+  803207:	48 b8 2e 2c 80 00 00 	movabs $0x802c2e,%rax
+  80320e:	00 00 00 
+  803211:	ff d0                	call   *%rax
+  803213:	85 c0                	test   %eax,%eax
+  803215:	0f 88 e8 00 00 00    	js     803303 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  80321b:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  80321f:	48 b8 20 2a 80 00 00 	movabs $0x802a20,%rax
+  803226:	00 00 00 
+  803229:	ff d0                	call   *%rax
+  80322b:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  80322e:	48 85 c0             	test   %rax,%rax
+  803231:	0f 84 69 02 00 00    	je     8034a0 <devfile_read+0x2e4>
+    while (i < n) {
+  803237:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80323c:	0f 84 ce 00 00 00    	je     803310 <devfile_read+0x154>
+    size_t i = 0;
+  803242:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803247:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80324e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803252:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803256:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  80325a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80325e:	48 29 da             	sub    %rbx,%rdx
+  803261:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803266:	48 39 c2             	cmp    %rax,%rdx
+  803269:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  80326d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803271:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803275:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803278:	01 d8                	add    %ebx,%eax
+  80327a:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  80327e:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803282:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803289:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803290:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803297:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80329d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032a2:	4c 89 ee             	mov    %r13,%rsi
+  8032a5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8032aa:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  8032b1:	00 00 00 
+  8032b4:	ff d0                	call   *%rax
+        if (res < 0)
+  8032b6:	85 c0                	test   %eax,%eax
+  8032b8:	78 4d                	js     803307 <devfile_read+0x14b>
+        if (res == 0)
+  8032ba:	74 4f                	je     80330b <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8032bc:	4c 63 e0             	movslq %eax,%r12
+  8032bf:	4c 89 e2             	mov    %r12,%rdx
+  8032c2:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8032c6:	4c 89 f7             	mov    %r14,%rdi
+  8032c9:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8032d0:	00 00 00 
+  8032d3:	ff d0                	call   *%rax
+        i += res;
+  8032d5:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8032d8:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8032db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032df:	48 39 c3             	cmp    %rax,%rbx
+  8032e2:	0f 82 72 ff ff ff    	jb     80325a <devfile_read+0x9e>
+    return i;
+  8032e8:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8032eb:	48 85 c0             	test   %rax,%rax
+  8032ee:	7e 04                	jle    8032f4 <devfile_read+0x138>
+  8032f0:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8032f4:	48 83 c4 28          	add    $0x28,%rsp
+  8032f8:	5b                   	pop    %rbx
+  8032f9:	41 5c                	pop    %r12
+  8032fb:	41 5d                	pop    %r13
+  8032fd:	41 5e                	pop    %r14
+  8032ff:	41 5f                	pop    %r15
+  803301:	5d                   	pop    %rbp
+  803302:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803303:	48 98                	cltq
+  803305:	eb ed                	jmp    8032f4 <devfile_read+0x138>
+            return res;
+  803307:	48 98                	cltq
+  803309:	eb e9                	jmp    8032f4 <devfile_read+0x138>
+            return i;
+  80330b:	48 89 d8             	mov    %rbx,%rax
+  80330e:	eb db                	jmp    8032eb <devfile_read+0x12f>
+    size_t i = 0;
+  803310:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803314:	eb d2                	jmp    8032e8 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803316:	48 89 c6             	mov    %rax,%rsi
+  803319:	4c 89 ff             	mov    %r15,%rdi
+  80331c:	48 b8 2e 2c 80 00 00 	movabs $0x802c2e,%rax
+  803323:	00 00 00 
+  803326:	ff d0                	call   *%rax
+  803328:	85 c0                	test   %eax,%eax
+  80332a:	78 40                	js     80336c <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80332c:	4c 89 ff             	mov    %r15,%rdi
+  80332f:	48 b8 32 21 80 00 00 	movabs $0x802132,%rax
+  803336:	00 00 00 
+  803339:	ff d0                	call   *%rax
+  80333b:	48 89 c2             	mov    %rax,%rdx
+  80333e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803342:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803346:	48 c1 e0 0c          	shl    $0xc,%rax
+  80334a:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80334f:	48 01 d0             	add    %rdx,%rax
+  803352:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803356:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80335b:	0f 84 33 01 00 00    	je     803494 <devfile_read+0x2d8>
+    size_t i = 0;
+  803361:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803367:	e9 f5 00 00 00       	jmp    803461 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80336c:	48 98                	cltq
+  80336e:	eb 84                	jmp    8032f4 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803370:	44 89 e8             	mov    %r13d,%eax
+  803373:	66 b8 00 00          	mov    $0x0,%ax
+  803377:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  80337c:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803383:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803385:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803389:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80338d:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  80338f:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803394:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803397:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  80339e:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  80339f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8033a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033aa:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8033af:	bf 03 00 00 00       	mov    $0x3,%edi
+  8033b4:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  8033bb:	00 00 00 
+  8033be:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8033c0:	85 c0                	test   %eax,%eax
+  8033c2:	0f 88 be 00 00 00    	js     803486 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8033c8:	48 63 d0             	movslq %eax,%rdx
+  8033cb:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8033d0:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8033d5:	44 39 e8             	cmp    %r13d,%eax
+  8033d8:	0f 8e ba 00 00 00    	jle    803498 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8033de:	49 63 c5             	movslq %r13d,%rax
+  8033e1:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8033e6:	48 29 c3             	sub    %rax,%rbx
+  8033e9:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8033ee:	48 01 c3             	add    %rax,%rbx
+  8033f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033f5:	4c 29 f0             	sub    %r14,%rax
+  8033f8:	48 39 c3             	cmp    %rax,%rbx
+  8033fb:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8033ff:	4c 89 ff             	mov    %r15,%rdi
+  803402:	48 b9 32 21 80 00 00 	movabs $0x802132,%rcx
+  803409:	00 00 00 
+  80340c:	ff d1                	call   *%rcx
+  80340e:	48 89 c2             	mov    %rax,%rdx
+  803411:	48 c1 e2 04          	shl    $0x4,%rdx
+  803415:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803419:	48 c1 e0 0c          	shl    $0xc,%rax
+  80341d:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803422:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803425:	44 89 ea             	mov    %r13d,%edx
+  803428:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  80342d:	48 63 d2             	movslq %edx,%rdx
+  803430:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803437:	00 
+  803438:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80343c:	4c 01 f7             	add    %r14,%rdi
+  80343f:	48 89 da             	mov    %rbx,%rdx
+  803442:	48 b9 37 12 80 00 00 	movabs $0x801237,%rcx
+  803449:	00 00 00 
+  80344c:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80344e:	41 01 dd             	add    %ebx,%r13d
+  803451:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803455:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803458:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80345c:	49 39 c6             	cmp    %rax,%r14
+  80345f:	73 37                	jae    803498 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803461:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803465:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80346a:	44 39 e8             	cmp    %r13d,%eax
+  80346d:	0f 8f fd fe ff ff    	jg     803370 <devfile_read+0x1b4>
+  803473:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803478:	44 39 e8             	cmp    %r13d,%eax
+  80347b:	0f 8f 5d ff ff ff    	jg     8033de <devfile_read+0x222>
+  803481:	e9 ea fe ff ff       	jmp    803370 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803486:	48 98                	cltq
+  803488:	4d 85 f6             	test   %r14,%r14
+  80348b:	49 0f 45 c6          	cmovne %r14,%rax
+  80348f:	e9 60 fe ff ff       	jmp    8032f4 <devfile_read+0x138>
+    size_t i = 0;
+  803494:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803498:	4c 89 f0             	mov    %r14,%rax
+  80349b:	e9 54 fe ff ff       	jmp    8032f4 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8034a0:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8034a7:	e9 48 fe ff ff       	jmp    8032f4 <devfile_read+0x138>
+
+00000000008034ac <open>:
+open(const char *path, int mode) {
+  8034ac:	55                   	push   %rbp
+  8034ad:	48 89 e5             	mov    %rsp,%rbp
+  8034b0:	41 55                	push   %r13
+  8034b2:	41 54                	push   %r12
+  8034b4:	53                   	push   %rbx
+  8034b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8034b9:	49 89 fc             	mov    %rdi,%r12
+  8034bc:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8034bf:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  8034c6:	00 00 00 
+  8034c9:	ff d0                	call   *%rax
+  8034cb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8034d1:	0f 87 8a 00 00 00    	ja     803561 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8034d7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8034db:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  8034e2:	00 00 00 
+  8034e5:	ff d0                	call   *%rax
+  8034e7:	89 c3                	mov    %eax,%ebx
+  8034e9:	85 c0                	test   %eax,%eax
+  8034eb:	78 50                	js     80353d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8034ed:	4c 89 e6             	mov    %r12,%rsi
+  8034f0:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8034f7:	00 00 00 
+  8034fa:	48 89 df             	mov    %rbx,%rdi
+  8034fd:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  803504:	00 00 00 
+  803507:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803509:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803510:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803514:	bf 01 00 00 00       	mov    $0x1,%edi
+  803519:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  803520:	00 00 00 
+  803523:	ff d0                	call   *%rax
+  803525:	89 c3                	mov    %eax,%ebx
+  803527:	85 c0                	test   %eax,%eax
+  803529:	78 1f                	js     80354a <open+0x9e>
+    return fd2num(fd);
+  80352b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80352f:	48 b8 32 21 80 00 00 	movabs $0x802132,%rax
+  803536:	00 00 00 
+  803539:	ff d0                	call   *%rax
+  80353b:	89 c3                	mov    %eax,%ebx
+}
+  80353d:	89 d8                	mov    %ebx,%eax
+  80353f:	48 83 c4 18          	add    $0x18,%rsp
+  803543:	5b                   	pop    %rbx
+  803544:	41 5c                	pop    %r12
+  803546:	41 5d                	pop    %r13
+  803548:	5d                   	pop    %rbp
+  803549:	c3                   	ret
+        fd_close(fd, 0);
+  80354a:	be 00 00 00 00       	mov    $0x0,%esi
+  80354f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803553:	48 b8 7b 22 80 00 00 	movabs $0x80227b,%rax
+  80355a:	00 00 00 
+  80355d:	ff d0                	call   *%rax
+        return res;
+  80355f:	eb dc                	jmp    80353d <open+0x91>
+        return -E_BAD_PATH;
+  803561:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803566:	eb d5                	jmp    80353d <open+0x91>
+
+0000000000803568 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803568:	55                   	push   %rbp
+  803569:	48 89 e5             	mov    %rsp,%rbp
+  80356c:	41 57                	push   %r15
+  80356e:	41 56                	push   %r14
+  803570:	41 55                	push   %r13
+  803572:	41 54                	push   %r12
+  803574:	53                   	push   %rbx
+  803575:	48 83 ec 18          	sub    $0x18,%rsp
+  803579:	41 89 f6             	mov    %esi,%r14d
+  80357c:	49 89 d7             	mov    %rdx,%r15
+  80357f:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803582:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803586:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  80358d:	00 00 00 
+  803590:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803592:	85 c0                	test   %eax,%eax
+  803594:	0f 88 db 00 00 00    	js     803675 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80359a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80359e:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8035a5:	00 00 00 
+  8035a8:	8b 00                	mov    (%rax),%eax
+  8035aa:	39 07                	cmp    %eax,(%rdi)
+  8035ac:	0f 85 db 00 00 00    	jne    80368d <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8035b2:	45 85 f6             	test   %r14d,%r14d
+  8035b5:	0f 88 db 00 00 00    	js     803696 <fmap+0x12e>
+  8035bb:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8035c2:	0f 85 d7 00 00 00    	jne    80369f <fmap+0x137>
+  8035c8:	4c 89 fb             	mov    %r15,%rbx
+  8035cb:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8035d1:	0f 85 d1 00 00 00    	jne    8036a8 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8035d7:	48 b8 f8 2c 80 00 00 	movabs $0x802cf8,%rax
+  8035de:	00 00 00 
+  8035e1:	ff d0                	call   *%rax
+  8035e3:	85 c0                	test   %eax,%eax
+  8035e5:	0f 88 8e 00 00 00    	js     803679 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8035eb:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8035f2:	00 00 00 
+    while (i < n) {
+  8035f5:	4d 85 ed             	test   %r13,%r13
+  8035f8:	0f 84 8a 00 00 00    	je     803688 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8035fe:	4c 89 ea             	mov    %r13,%rdx
+  803601:	48 29 da             	sub    %rbx,%rdx
+  803604:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80360b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803611:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803615:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803619:	8b 40 0c             	mov    0xc(%rax),%eax
+  80361c:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  803620:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803624:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803629:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80362e:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803632:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803636:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80363b:	4c 89 e6             	mov    %r12,%rsi
+  80363e:	bf 09 00 00 00       	mov    $0x9,%edi
+  803643:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  80364a:	00 00 00 
+  80364d:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80364f:	85 c0                	test   %eax,%eax
+  803651:	78 2a                	js     80367d <fmap+0x115>
+        i += res;
+  803653:	48 98                	cltq
+  803655:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803658:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  80365c:	72 05                	jb     803663 <fmap+0xfb>
+    while (i < n) {
+  80365e:	4c 39 eb             	cmp    %r13,%rbx
+  803661:	72 9b                	jb     8035fe <fmap+0x96>
+    }
+    return i;
+  803663:	48 89 d8             	mov    %rbx,%rax
+}
+  803666:	48 83 c4 18          	add    $0x18,%rsp
+  80366a:	5b                   	pop    %rbx
+  80366b:	41 5c                	pop    %r12
+  80366d:	41 5d                	pop    %r13
+  80366f:	41 5e                	pop    %r14
+  803671:	41 5f                	pop    %r15
+  803673:	5d                   	pop    %rbp
+  803674:	c3                   	ret
+    if (res < 0) return res;
+  803675:	48 98                	cltq
+  803677:	eb ed                	jmp    803666 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803679:	48 98                	cltq
+  80367b:	eb e9                	jmp    803666 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  80367d:	48 98                	cltq
+  80367f:	48 85 db             	test   %rbx,%rbx
+  803682:	48 0f 45 c3          	cmovne %rbx,%rax
+  803686:	eb de                	jmp    803666 <fmap+0xfe>
+    size_t i = 0;
+  803688:	4c 89 eb             	mov    %r13,%rbx
+  80368b:	eb d6                	jmp    803663 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80368d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803694:	eb d0                	jmp    803666 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803696:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80369d:	eb c7                	jmp    803666 <fmap+0xfe>
+  80369f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036a6:	eb be                	jmp    803666 <fmap+0xfe>
+  8036a8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036af:	eb b5                	jmp    803666 <fmap+0xfe>
+
+00000000008036b1 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8036b1:	55                   	push   %rbp
+  8036b2:	48 89 e5             	mov    %rsp,%rbp
+  8036b5:	41 56                	push   %r14
+  8036b7:	41 55                	push   %r13
+  8036b9:	41 54                	push   %r12
+  8036bb:	53                   	push   %rbx
+  8036bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8036c0:	89 fb                	mov    %edi,%ebx
+  8036c2:	41 89 f4             	mov    %esi,%r12d
+  8036c5:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8036c8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036cc:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  8036d3:	00 00 00 
+  8036d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036d8:	85 c0                	test   %eax,%eax
+  8036da:	78 63                	js     80373f <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8036dc:	45 85 e4             	test   %r12d,%r12d
+  8036df:	0f 88 80 00 00 00    	js     803765 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8036e5:	45 89 e6             	mov    %r12d,%r14d
+  8036e8:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8036ef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036f3:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  8036fa:	00 00 00 
+  8036fd:	ff d0                	call   *%rax
+  8036ff:	48 89 c2             	mov    %rax,%rdx
+  803702:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803707:	44 89 f6             	mov    %r14d,%esi
+  80370a:	89 df                	mov    %ebx,%edi
+  80370c:	48 b8 68 35 80 00 00 	movabs $0x803568,%rax
+  803713:	00 00 00 
+  803716:	ff d0                	call   *%rax
+  803718:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80371b:	45 29 f4             	sub    %r14d,%r12d
+  80371e:	4d 63 f4             	movslq %r12d,%r14
+  803721:	49 39 c6             	cmp    %rax,%r14
+  803724:	7c 1d                	jl     803743 <read_map+0x92>
+  803726:	48 85 c0             	test   %rax,%rax
+  803729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372e:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803732:	48 83 c4 10          	add    $0x10,%rsp
+  803736:	5b                   	pop    %rbx
+  803737:	41 5c                	pop    %r12
+  803739:	41 5d                	pop    %r13
+  80373b:	41 5e                	pop    %r14
+  80373d:	5d                   	pop    %rbp
+  80373e:	c3                   	ret
+    if (res < 0) return res;
+  80373f:	48 98                	cltq
+  803741:	eb ef                	jmp    803732 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803743:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803747:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  80374e:	00 00 00 
+  803751:	ff d0                	call   *%rax
+  803753:	4d 63 e4             	movslq %r12d,%r12
+  803756:	4c 01 e0             	add    %r12,%rax
+  803759:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  80375d:	48 89 d8             	mov    %rbx,%rax
+  803760:	4c 29 f0             	sub    %r14,%rax
+  803763:	eb cd                	jmp    803732 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803765:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80376c:	eb c4                	jmp    803732 <read_map+0x81>
+
+000000000080376e <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  80376e:	55                   	push   %rbp
+  80376f:	48 89 e5             	mov    %rsp,%rbp
+  803772:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803776:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80377a:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  803781:	00 00 00 
+  803784:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803786:	85 c0                	test   %eax,%eax
+  803788:	78 4a                	js     8037d4 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80378a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80378e:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803795:	00 00 00 
+  803798:	8b 00                	mov    (%rax),%eax
+  80379a:	39 07                	cmp    %eax,(%rdi)
+  80379c:	75 38                	jne    8037d6 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80379e:	48 b8 f8 2c 80 00 00 	movabs $0x802cf8,%rax
+  8037a5:	00 00 00 
+  8037a8:	ff d0                	call   *%rax
+  8037aa:	85 c0                	test   %eax,%eax
+  8037ac:	78 26                	js     8037d4 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8037ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037b2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037b5:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8037bc:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8037be:	be 00 00 00 00       	mov    $0x0,%esi
+  8037c3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037c8:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  8037cf:	00 00 00 
+  8037d2:	ff d0                	call   *%rax
+}
+  8037d4:	c9                   	leave
+  8037d5:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8037d6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8037db:	eb f7                	jmp    8037d4 <fsync+0x66>
+
+00000000008037dd <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8037dd:	55                   	push   %rbp
+  8037de:	48 89 e5             	mov    %rsp,%rbp
+  8037e1:	41 57                	push   %r15
+  8037e3:	41 56                	push   %r14
+  8037e5:	41 55                	push   %r13
+  8037e7:	41 54                	push   %r12
+  8037e9:	53                   	push   %rbx
+  8037ea:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8037ee:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8037f5:	00 00 00 
+  8037f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8037fd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803803:	49 bd c0 21 80 00 00 	movabs $0x8021c0,%r13
+  80380a:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80380d:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803814:	00 00 00 
+  803817:	eb 0c                	jmp    803825 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803819:	83 c3 01             	add    $0x1,%ebx
+  80381c:	49 83 c4 28          	add    $0x28,%r12
+  803820:	83 fb 20             	cmp    $0x20,%ebx
+  803823:	74 33                	je     803858 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803825:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80382a:	74 ed                	je     803819 <flushall+0x3c>
+  80382c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803830:	89 df                	mov    %ebx,%edi
+  803832:	41 ff d5             	call   *%r13
+  803835:	85 c0                	test   %eax,%eax
+  803837:	78 e0                	js     803819 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803839:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80383d:	41 8b 06             	mov    (%r14),%eax
+  803840:	39 07                	cmp    %eax,(%rdi)
+  803842:	75 d5                	jne    803819 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803844:	48 b8 f8 2c 80 00 00 	movabs $0x802cf8,%rax
+  80384b:	00 00 00 
+  80384e:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803850:	85 c0                	test   %eax,%eax
+  803852:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803856:	eb c1                	jmp    803819 <flushall+0x3c>
+    }
+    return res;
+}
+  803858:	44 89 f8             	mov    %r15d,%eax
+  80385b:	48 83 c4 18          	add    $0x18,%rsp
+  80385f:	5b                   	pop    %rbx
+  803860:	41 5c                	pop    %r12
+  803862:	41 5d                	pop    %r13
+  803864:	41 5e                	pop    %r14
+  803866:	41 5f                	pop    %r15
+  803868:	5d                   	pop    %rbp
+  803869:	c3                   	ret
+
+000000000080386a <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80386a:	55                   	push   %rbp
+  80386b:	48 89 e5             	mov    %rsp,%rbp
+  80386e:	53                   	push   %rbx
+  80386f:	48 83 ec 08          	sub    $0x8,%rsp
+  803873:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803876:	40 0f b6 c6          	movzbl %sil,%eax
+  80387a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803881:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803883:	be 00 00 00 00       	mov    $0x0,%esi
+  803888:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80388d:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  803894:	00 00 00 
+  803897:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803899:	85 c0                	test   %eax,%eax
+  80389b:	78 23                	js     8038c0 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80389d:	ba 58 06 00 00       	mov    $0x658,%edx
+  8038a2:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8038a9:	00 00 00 
+  8038ac:	48 89 df             	mov    %rbx,%rdi
+  8038af:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8038b6:	00 00 00 
+  8038b9:	ff d0                	call   *%rax
+    return 0;
+  8038bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038c4:	c9                   	leave
+  8038c5:	c3                   	ret
+
+00000000008038c6 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8038c6:	55                   	push   %rbp
+  8038c7:	48 89 e5             	mov    %rsp,%rbp
+  8038ca:	53                   	push   %rbx
+  8038cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8038cf:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8038d2:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  8038d9:	00 00 00 
+  8038dc:	ff d0                	call   *%rax
+  8038de:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8038e4:	77 35                	ja     80391b <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8038e6:	48 89 de             	mov    %rbx,%rsi
+  8038e9:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8038f0:	00 00 00 
+  8038f3:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  8038fa:	00 00 00 
+  8038fd:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8038ff:	be 00 00 00 00       	mov    $0x0,%esi
+  803904:	bf 07 00 00 00       	mov    $0x7,%edi
+  803909:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  803910:	00 00 00 
+  803913:	ff d0                	call   *%rax
+}
+  803915:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803919:	c9                   	leave
+  80391a:	c3                   	ret
+        return -E_BAD_PATH;
+  80391b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803920:	eb f3                	jmp    803915 <remove+0x4f>
+
+0000000000803922 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803922:	55                   	push   %rbp
+  803923:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803926:	48 b8 dd 37 80 00 00 	movabs $0x8037dd,%rax
+  80392d:	00 00 00 
+  803930:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803932:	be 00 00 00 00       	mov    $0x0,%esi
+  803937:	bf 08 00 00 00       	mov    $0x8,%edi
+  80393c:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  803943:	00 00 00 
+  803946:	ff d0                	call   *%rax
+}
+  803948:	5d                   	pop    %rbp
+  803949:	c3                   	ret
+
+000000000080394a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80394a:	55                   	push   %rbp
+  80394b:	48 89 e5             	mov    %rsp,%rbp
+  80394e:	41 54                	push   %r12
+  803950:	53                   	push   %rbx
+  803951:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803954:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  80395b:	00 00 00 
+  80395e:	ff d0                	call   *%rax
+  803960:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803963:	48 be 40 58 80 00 00 	movabs $0x805840,%rsi
+  80396a:	00 00 00 
+  80396d:	48 89 df             	mov    %rbx,%rdi
+  803970:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  803977:	00 00 00 
+  80397a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80397c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803981:	41 2b 04 24          	sub    (%r12),%eax
+  803985:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80398b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803992:	00 00 00 
+    stat->st_dev = &devpipe;
+  803995:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80399c:	00 00 00 
+  80399f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8039a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ab:	5b                   	pop    %rbx
+  8039ac:	41 5c                	pop    %r12
+  8039ae:	5d                   	pop    %rbp
+  8039af:	c3                   	ret
+
+00000000008039b0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8039b0:	55                   	push   %rbp
+  8039b1:	48 89 e5             	mov    %rsp,%rbp
+  8039b4:	41 54                	push   %r12
+  8039b6:	53                   	push   %rbx
+  8039b7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8039ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039bf:	48 89 fe             	mov    %rdi,%rsi
+  8039c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c7:	49 bc 81 17 80 00 00 	movabs $0x801781,%r12
+  8039ce:	00 00 00 
+  8039d1:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8039d4:	48 89 df             	mov    %rbx,%rdi
+  8039d7:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  8039de:	00 00 00 
+  8039e1:	ff d0                	call   *%rax
+  8039e3:	48 89 c6             	mov    %rax,%rsi
+  8039e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039f0:	41 ff d4             	call   *%r12
+}
+  8039f3:	5b                   	pop    %rbx
+  8039f4:	41 5c                	pop    %r12
+  8039f6:	5d                   	pop    %rbp
+  8039f7:	c3                   	ret
+
+00000000008039f8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039f8:	55                   	push   %rbp
+  8039f9:	48 89 e5             	mov    %rsp,%rbp
+  8039fc:	41 57                	push   %r15
+  8039fe:	41 56                	push   %r14
+  803a00:	41 55                	push   %r13
+  803a02:	41 54                	push   %r12
+  803a04:	53                   	push   %rbx
+  803a05:	48 83 ec 18          	sub    $0x18,%rsp
+  803a09:	49 89 fc             	mov    %rdi,%r12
+  803a0c:	49 89 f5             	mov    %rsi,%r13
+  803a0f:	49 89 d7             	mov    %rdx,%r15
+  803a12:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a16:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  803a1d:	00 00 00 
+  803a20:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803a22:	4d 85 ff             	test   %r15,%r15
+  803a25:	0f 84 af 00 00 00    	je     803ada <devpipe_write+0xe2>
+  803a2b:	48 89 c3             	mov    %rax,%rbx
+  803a2e:	4c 89 f8             	mov    %r15,%rax
+  803a31:	4d 89 ef             	mov    %r13,%r15
+  803a34:	4c 01 e8             	add    %r13,%rax
+  803a37:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a3b:	49 bd 76 15 80 00 00 	movabs $0x801576,%r13
+  803a42:	00 00 00 
+            sys_yield();
+  803a45:	49 be 13 15 80 00 00 	movabs $0x801513,%r14
+  803a4c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a4f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a52:	48 63 ce             	movslq %esi,%rcx
+  803a55:	48 63 03             	movslq (%rbx),%rax
+  803a58:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a5e:	48 39 c1             	cmp    %rax,%rcx
+  803a61:	72 2e                	jb     803a91 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a63:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a68:	48 89 da             	mov    %rbx,%rdx
+  803a6b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a70:	4c 89 e7             	mov    %r12,%rdi
+  803a73:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803a76:	85 c0                	test   %eax,%eax
+  803a78:	74 66                	je     803ae0 <devpipe_write+0xe8>
+            sys_yield();
+  803a7a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a7d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a80:	48 63 ce             	movslq %esi,%rcx
+  803a83:	48 63 03             	movslq (%rbx),%rax
+  803a86:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a8c:	48 39 c1             	cmp    %rax,%rcx
+  803a8f:	73 d2                	jae    803a63 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a91:	41 0f b6 3f          	movzbl (%r15),%edi
+  803a95:	48 89 ca             	mov    %rcx,%rdx
+  803a98:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a9c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803aa3:	08 10 20 
+  803aa6:	48 f7 e2             	mul    %rdx
+  803aa9:	48 c1 ea 06          	shr    $0x6,%rdx
+  803aad:	48 89 d0             	mov    %rdx,%rax
+  803ab0:	48 c1 e0 09          	shl    $0x9,%rax
+  803ab4:	48 29 d0             	sub    %rdx,%rax
+  803ab7:	48 c1 e0 03          	shl    $0x3,%rax
+  803abb:	48 29 c1             	sub    %rax,%rcx
+  803abe:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803ac3:	83 c6 01             	add    $0x1,%esi
+  803ac6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ac9:	49 83 c7 01          	add    $0x1,%r15
+  803acd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ad1:	49 39 c7             	cmp    %rax,%r15
+  803ad4:	0f 85 75 ff ff ff    	jne    803a4f <devpipe_write+0x57>
+    return n;
+  803ada:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ade:	eb 05                	jmp    803ae5 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ae5:	48 83 c4 18          	add    $0x18,%rsp
+  803ae9:	5b                   	pop    %rbx
+  803aea:	41 5c                	pop    %r12
+  803aec:	41 5d                	pop    %r13
+  803aee:	41 5e                	pop    %r14
+  803af0:	41 5f                	pop    %r15
+  803af2:	5d                   	pop    %rbp
+  803af3:	c3                   	ret
+
+0000000000803af4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803af4:	55                   	push   %rbp
+  803af5:	48 89 e5             	mov    %rsp,%rbp
+  803af8:	41 57                	push   %r15
+  803afa:	41 56                	push   %r14
+  803afc:	41 55                	push   %r13
+  803afe:	41 54                	push   %r12
+  803b00:	53                   	push   %rbx
+  803b01:	48 83 ec 18          	sub    $0x18,%rsp
+  803b05:	49 89 fc             	mov    %rdi,%r12
+  803b08:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b0c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b10:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  803b17:	00 00 00 
+  803b1a:	ff d0                	call   *%rax
+  803b1c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b1f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b25:	49 bd 76 15 80 00 00 	movabs $0x801576,%r13
+  803b2c:	00 00 00 
+            sys_yield();
+  803b2f:	49 be 13 15 80 00 00 	movabs $0x801513,%r14
+  803b36:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b39:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b3e:	74 7d                	je     803bbd <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b40:	8b 03                	mov    (%rbx),%eax
+  803b42:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b45:	75 26                	jne    803b6d <devpipe_read+0x79>
+            if (i > 0) return i;
+  803b47:	4d 85 ff             	test   %r15,%r15
+  803b4a:	75 77                	jne    803bc3 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b4c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b51:	48 89 da             	mov    %rbx,%rdx
+  803b54:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b59:	4c 89 e7             	mov    %r12,%rdi
+  803b5c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b5f:	85 c0                	test   %eax,%eax
+  803b61:	74 72                	je     803bd5 <devpipe_read+0xe1>
+            sys_yield();
+  803b63:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b66:	8b 03                	mov    (%rbx),%eax
+  803b68:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b6b:	74 df                	je     803b4c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b6d:	48 63 c8             	movslq %eax,%rcx
+  803b70:	48 89 ca             	mov    %rcx,%rdx
+  803b73:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b77:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803b7e:	08 10 20 
+  803b81:	48 89 d0             	mov    %rdx,%rax
+  803b84:	48 f7 e6             	mul    %rsi
+  803b87:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b8b:	48 89 d0             	mov    %rdx,%rax
+  803b8e:	48 c1 e0 09          	shl    $0x9,%rax
+  803b92:	48 29 d0             	sub    %rdx,%rax
+  803b95:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803b9c:	00 
+  803b9d:	48 89 c8             	mov    %rcx,%rax
+  803ba0:	48 29 d0             	sub    %rdx,%rax
+  803ba3:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803ba8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803bac:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803bb0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803bb3:	49 83 c7 01          	add    $0x1,%r15
+  803bb7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803bbb:	75 83                	jne    803b40 <devpipe_read+0x4c>
+    return n;
+  803bbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bc1:	eb 03                	jmp    803bc6 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803bc3:	4c 89 f8             	mov    %r15,%rax
+}
+  803bc6:	48 83 c4 18          	add    $0x18,%rsp
+  803bca:	5b                   	pop    %rbx
+  803bcb:	41 5c                	pop    %r12
+  803bcd:	41 5d                	pop    %r13
+  803bcf:	41 5e                	pop    %r14
+  803bd1:	41 5f                	pop    %r15
+  803bd3:	5d                   	pop    %rbp
+  803bd4:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bda:	eb ea                	jmp    803bc6 <devpipe_read+0xd2>
+
+0000000000803bdc <pipe>:
+pipe(int pfd[2]) {
+  803bdc:	55                   	push   %rbp
+  803bdd:	48 89 e5             	mov    %rsp,%rbp
+  803be0:	41 55                	push   %r13
+  803be2:	41 54                	push   %r12
+  803be4:	53                   	push   %rbx
+  803be5:	48 83 ec 18          	sub    $0x18,%rsp
+  803be9:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bec:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bf0:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  803bf7:	00 00 00 
+  803bfa:	ff d0                	call   *%rax
+  803bfc:	89 c3                	mov    %eax,%ebx
+  803bfe:	85 c0                	test   %eax,%eax
+  803c00:	0f 88 a0 01 00 00    	js     803da6 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803c06:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c10:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c14:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c19:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  803c20:	00 00 00 
+  803c23:	ff d0                	call   *%rax
+  803c25:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c27:	85 c0                	test   %eax,%eax
+  803c29:	0f 88 77 01 00 00    	js     803da6 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c2f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c33:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  803c3a:	00 00 00 
+  803c3d:	ff d0                	call   *%rax
+  803c3f:	89 c3                	mov    %eax,%ebx
+  803c41:	85 c0                	test   %eax,%eax
+  803c43:	0f 88 43 01 00 00    	js     803d8c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c49:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c53:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c57:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c5c:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  803c63:	00 00 00 
+  803c66:	ff d0                	call   *%rax
+  803c68:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c6a:	85 c0                	test   %eax,%eax
+  803c6c:	0f 88 1a 01 00 00    	js     803d8c <pipe+0x1b0>
+    va = fd2data(fd0);
+  803c72:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c76:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  803c7d:	00 00 00 
+  803c80:	ff d0                	call   *%rax
+  803c82:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c85:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c8a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c8f:	48 89 c6             	mov    %rax,%rsi
+  803c92:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c97:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  803c9e:	00 00 00 
+  803ca1:	ff d0                	call   *%rax
+  803ca3:	89 c3                	mov    %eax,%ebx
+  803ca5:	85 c0                	test   %eax,%eax
+  803ca7:	0f 88 c5 00 00 00    	js     803d72 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803cad:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803cb1:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  803cb8:	00 00 00 
+  803cbb:	ff d0                	call   *%rax
+  803cbd:	48 89 c1             	mov    %rax,%rcx
+  803cc0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803cc6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cd1:	4c 89 ee             	mov    %r13,%rsi
+  803cd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd9:	48 b8 09 16 80 00 00 	movabs $0x801609,%rax
+  803ce0:	00 00 00 
+  803ce3:	ff d0                	call   *%rax
+  803ce5:	89 c3                	mov    %eax,%ebx
+  803ce7:	85 c0                	test   %eax,%eax
+  803ce9:	78 6e                	js     803d59 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803ceb:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cf0:	4c 89 ef             	mov    %r13,%rdi
+  803cf3:	48 b8 44 15 80 00 00 	movabs $0x801544,%rax
+  803cfa:	00 00 00 
+  803cfd:	ff d0                	call   *%rax
+  803cff:	83 f8 02             	cmp    $0x2,%eax
+  803d02:	0f 85 ab 00 00 00    	jne    803db3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803d08:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803d0f:	00 00 
+  803d11:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d15:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803d17:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d1b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d22:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d26:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d2c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d33:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d37:	48 bb 32 21 80 00 00 	movabs $0x802132,%rbx
+  803d3e:	00 00 00 
+  803d41:	ff d3                	call   *%rbx
+  803d43:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d47:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d4b:	ff d3                	call   *%rbx
+  803d4d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d57:	eb 4d                	jmp    803da6 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d59:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d5e:	4c 89 ee             	mov    %r13,%rsi
+  803d61:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d66:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  803d6d:	00 00 00 
+  803d70:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d72:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d77:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d80:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  803d87:	00 00 00 
+  803d8a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d91:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d95:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d9a:	48 b8 81 17 80 00 00 	movabs $0x801781,%rax
+  803da1:	00 00 00 
+  803da4:	ff d0                	call   *%rax
+}
+  803da6:	89 d8                	mov    %ebx,%eax
+  803da8:	48 83 c4 18          	add    $0x18,%rsp
+  803dac:	5b                   	pop    %rbx
+  803dad:	41 5c                	pop    %r12
+  803daf:	41 5d                	pop    %r13
+  803db1:	5d                   	pop    %rbp
+  803db2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803db3:	48 b9 70 58 80 00 00 	movabs $0x805870,%rcx
+  803dba:	00 00 00 
+  803dbd:	48 ba 47 58 80 00 00 	movabs $0x805847,%rdx
+  803dc4:	00 00 00 
+  803dc7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803dcc:	48 bf 5c 58 80 00 00 	movabs $0x80585c,%rdi
+  803dd3:	00 00 00 
+  803dd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ddb:	49 b8 bb 43 80 00 00 	movabs $0x8043bb,%r8
+  803de2:	00 00 00 
+  803de5:	41 ff d0             	call   *%r8
+
+0000000000803de8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803de8:	55                   	push   %rbp
+  803de9:	48 89 e5             	mov    %rsp,%rbp
+  803dec:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803df0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803df4:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  803dfb:	00 00 00 
+  803dfe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e00:	85 c0                	test   %eax,%eax
+  803e02:	78 35                	js     803e39 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803e04:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e08:	48 b8 44 21 80 00 00 	movabs $0x802144,%rax
+  803e0f:	00 00 00 
+  803e12:	ff d0                	call   *%rax
+  803e14:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e17:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e1c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e21:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e25:	48 b8 76 15 80 00 00 	movabs $0x801576,%rax
+  803e2c:	00 00 00 
+  803e2f:	ff d0                	call   *%rax
+  803e31:	85 c0                	test   %eax,%eax
+  803e33:	0f 94 c0             	sete   %al
+  803e36:	0f b6 c0             	movzbl %al,%eax
+}
+  803e39:	c9                   	leave
+  803e3a:	c3                   	ret
+
+0000000000803e3b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e3b:	48 89 f8             	mov    %rdi,%rax
+  803e3e:	48 c1 e8 27          	shr    $0x27,%rax
+  803e42:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803e49:	7f 00 00 
+  803e4c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e50:	f6 c2 01             	test   $0x1,%dl
+  803e53:	74 6d                	je     803ec2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e55:	48 89 f8             	mov    %rdi,%rax
+  803e58:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e5c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e63:	7f 00 00 
+  803e66:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e6a:	f6 c2 01             	test   $0x1,%dl
+  803e6d:	74 62                	je     803ed1 <get_uvpt_entry+0x96>
+  803e6f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803e76:	7f 00 00 
+  803e79:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e7d:	f6 c2 80             	test   $0x80,%dl
+  803e80:	75 4f                	jne    803ed1 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e82:	48 89 f8             	mov    %rdi,%rax
+  803e85:	48 c1 e8 15          	shr    $0x15,%rax
+  803e89:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803e90:	7f 00 00 
+  803e93:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e97:	f6 c2 01             	test   $0x1,%dl
+  803e9a:	74 44                	je     803ee0 <get_uvpt_entry+0xa5>
+  803e9c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ea3:	7f 00 00 
+  803ea6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803eaa:	f6 c2 80             	test   $0x80,%dl
+  803ead:	75 31                	jne    803ee0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803eaf:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803eb3:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803eba:	7f 00 00 
+  803ebd:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803ec1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ec2:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803ec9:	7f 00 00 
+  803ecc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ed0:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ed1:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ed8:	7f 00 00 
+  803edb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803edf:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ee0:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ee7:	7f 00 00 
+  803eea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803eee:	c3                   	ret
+
+0000000000803eef <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803eef:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803ef2:	48 89 f9             	mov    %rdi,%rcx
+  803ef5:	48 c1 e9 27          	shr    $0x27,%rcx
+  803ef9:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803f00:	7f 00 00 
+  803f03:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803f07:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f0e:	f6 c1 01             	test   $0x1,%cl
+  803f11:	0f 84 b2 00 00 00    	je     803fc9 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f17:	48 89 f9             	mov    %rdi,%rcx
+  803f1a:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803f1e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f25:	7f 00 00 
+  803f28:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f2c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803f33:	40 f6 c6 01          	test   $0x1,%sil
+  803f37:	0f 84 8c 00 00 00    	je     803fc9 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803f3d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803f44:	7f 00 00 
+  803f47:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f4b:	a8 80                	test   $0x80,%al
+  803f4d:	75 7b                	jne    803fca <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f4f:	48 89 f9             	mov    %rdi,%rcx
+  803f52:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f56:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f5d:	7f 00 00 
+  803f60:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f64:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803f6b:	40 f6 c6 01          	test   $0x1,%sil
+  803f6f:	74 58                	je     803fc9 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803f71:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803f78:	7f 00 00 
+  803f7b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803f7f:	a8 80                	test   $0x80,%al
+  803f81:	75 6c                	jne    803fef <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f83:	48 89 f9             	mov    %rdi,%rcx
+  803f86:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803f8a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f91:	7f 00 00 
+  803f94:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803f98:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803f9f:	40 f6 c6 01          	test   $0x1,%sil
+  803fa3:	74 24                	je     803fc9 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803fa5:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803fac:	7f 00 00 
+  803faf:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fb3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fba:	ff ff 7f 
+  803fbd:	48 21 c8             	and    %rcx,%rax
+  803fc0:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803fc6:	48 09 d0             	or     %rdx,%rax
+}
+  803fc9:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803fca:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fd1:	7f 00 00 
+  803fd4:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fd8:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803fdf:	ff ff 7f 
+  803fe2:	48 21 c8             	and    %rcx,%rax
+  803fe5:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803feb:	48 01 d0             	add    %rdx,%rax
+  803fee:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803fef:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ff6:	7f 00 00 
+  803ff9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ffd:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804004:	ff ff 7f 
+  804007:	48 21 c8             	and    %rcx,%rax
+  80400a:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804010:	48 01 d0             	add    %rdx,%rax
+  804013:	c3                   	ret
+
+0000000000804014 <get_prot>:
+
+int
+get_prot(void *va) {
+  804014:	55                   	push   %rbp
+  804015:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804018:	48 b8 3b 3e 80 00 00 	movabs $0x803e3b,%rax
+  80401f:	00 00 00 
+  804022:	ff d0                	call   *%rax
+  804024:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804027:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80402c:	89 c1                	mov    %eax,%ecx
+  80402e:	83 c9 04             	or     $0x4,%ecx
+  804031:	f6 c2 01             	test   $0x1,%dl
+  804034:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804037:	89 c1                	mov    %eax,%ecx
+  804039:	83 c9 02             	or     $0x2,%ecx
+  80403c:	f6 c2 02             	test   $0x2,%dl
+  80403f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804042:	89 c1                	mov    %eax,%ecx
+  804044:	83 c9 01             	or     $0x1,%ecx
+  804047:	48 85 d2             	test   %rdx,%rdx
+  80404a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80404d:	89 c1                	mov    %eax,%ecx
+  80404f:	83 c9 40             	or     $0x40,%ecx
+  804052:	f6 c6 04             	test   $0x4,%dh
+  804055:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804058:	5d                   	pop    %rbp
+  804059:	c3                   	ret
+
+000000000080405a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80405a:	55                   	push   %rbp
+  80405b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80405e:	48 b8 3b 3e 80 00 00 	movabs $0x803e3b,%rax
+  804065:	00 00 00 
+  804068:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80406a:	48 c1 e8 06          	shr    $0x6,%rax
+  80406e:	83 e0 01             	and    $0x1,%eax
+}
+  804071:	5d                   	pop    %rbp
+  804072:	c3                   	ret
+
+0000000000804073 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804073:	55                   	push   %rbp
+  804074:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804077:	48 b8 3b 3e 80 00 00 	movabs $0x803e3b,%rax
+  80407e:	00 00 00 
+  804081:	ff d0                	call   *%rax
+  804083:	83 e0 01             	and    $0x1,%eax
+}
+  804086:	5d                   	pop    %rbp
+  804087:	c3                   	ret
+
+0000000000804088 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804088:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80408f:	7f 00 00 
+  804092:	a8 01                	test   $0x1,%al
+  804094:	75 06                	jne    80409c <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80409b:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+  8040a0:	41 57                	push   %r15
+  8040a2:	41 56                	push   %r14
+  8040a4:	41 55                	push   %r13
+  8040a6:	41 54                	push   %r12
+  8040a8:	53                   	push   %rbx
+  8040a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8040ad:	49 89 fe             	mov    %rdi,%r14
+  8040b0:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8040b3:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8040ba:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8040bb:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  8040c2:	7f 00 00 
+  8040c5:	e9 81 00 00 00       	jmp    80414b <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  8040ca:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040d1:	49 39 dd             	cmp    %rbx,%r13
+  8040d4:	74 2b                	je     804101 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8040d6:	48 89 d8             	mov    %rbx,%rax
+  8040d9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040dd:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  8040e1:	f6 c2 01             	test   $0x1,%dl
+  8040e4:	74 e4                	je     8040ca <foreach_shared_region+0x42>
+  8040e6:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  8040ea:	f6 c4 04             	test   $0x4,%ah
+  8040ed:	74 db                	je     8040ca <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  8040ef:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040f6:	4c 89 fa             	mov    %r15,%rdx
+  8040f9:	48 89 df             	mov    %rbx,%rdi
+  8040fc:	41 ff d6             	call   *%r14
+  8040ff:	eb c9                	jmp    8040ca <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804101:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804108:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  80410c:	74 22                	je     804130 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  80410e:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804115:	48 89 d8             	mov    %rbx,%rax
+  804118:	48 c1 e8 15          	shr    $0x15,%rax
+  80411c:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804123:	7f 00 00 
+  804126:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80412a:	a8 01                	test   $0x1,%al
+  80412c:	74 d3                	je     804101 <foreach_shared_region+0x79>
+  80412e:	eb a6                	jmp    8040d6 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804130:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804137:	40 
+  804138:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80413c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804143:	00 00 00 
+  804146:	48 39 c1             	cmp    %rax,%rcx
+  804149:	74 31                	je     80417c <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  80414b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80414f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804153:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  80415a:	7f 00 00 
+  80415d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804161:	a8 01                	test   $0x1,%al
+  804163:	74 cb                	je     804130 <foreach_shared_region+0xa8>
+  804165:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804169:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804170:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804176:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80417a:	eb 92                	jmp    80410e <foreach_shared_region+0x86>
+}
+  80417c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804181:	48 83 c4 18          	add    $0x18,%rsp
+  804185:	5b                   	pop    %rbx
+  804186:	41 5c                	pop    %r12
+  804188:	41 5d                	pop    %r13
+  80418a:	41 5e                	pop    %r14
+  80418c:	41 5f                	pop    %r15
+  80418e:	5d                   	pop    %rbp
+  80418f:	c3                   	ret
+
+0000000000804190 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804190:	b8 00 00 00 00       	mov    $0x0,%eax
+  804195:	c3                   	ret
+
+0000000000804196 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804196:	55                   	push   %rbp
+  804197:	48 89 e5             	mov    %rsp,%rbp
+  80419a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80419d:	48 be 94 58 80 00 00 	movabs $0x805894,%rsi
+  8041a4:	00 00 00 
+  8041a7:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  8041ae:	00 00 00 
+  8041b1:	ff d0                	call   *%rax
+    return 0;
+}
+  8041b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b8:	5d                   	pop    %rbp
+  8041b9:	c3                   	ret
+
+00000000008041ba <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8041ba:	55                   	push   %rbp
+  8041bb:	48 89 e5             	mov    %rsp,%rbp
+  8041be:	41 57                	push   %r15
+  8041c0:	41 56                	push   %r14
+  8041c2:	41 55                	push   %r13
+  8041c4:	41 54                	push   %r12
+  8041c6:	53                   	push   %rbx
+  8041c7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8041ce:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8041d5:	48 85 d2             	test   %rdx,%rdx
+  8041d8:	74 7a                	je     804254 <devcons_write+0x9a>
+  8041da:	49 89 d6             	mov    %rdx,%r14
+  8041dd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041e3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8041e8:	49 bf d0 11 80 00 00 	movabs $0x8011d0,%r15
+  8041ef:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8041f2:	4c 89 f3             	mov    %r14,%rbx
+  8041f5:	48 29 f3             	sub    %rsi,%rbx
+  8041f8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8041fd:	48 39 c3             	cmp    %rax,%rbx
+  804200:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804204:	4c 63 eb             	movslq %ebx,%r13
+  804207:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80420e:	48 01 c6             	add    %rax,%rsi
+  804211:	4c 89 ea             	mov    %r13,%rdx
+  804214:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80421b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80421e:	4c 89 ee             	mov    %r13,%rsi
+  804221:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804228:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  80422f:	00 00 00 
+  804232:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804234:	41 01 dc             	add    %ebx,%r12d
+  804237:	49 63 f4             	movslq %r12d,%rsi
+  80423a:	4c 39 f6             	cmp    %r14,%rsi
+  80423d:	72 b3                	jb     8041f2 <devcons_write+0x38>
+    return res;
+  80423f:	49 63 c4             	movslq %r12d,%rax
+}
+  804242:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804249:	5b                   	pop    %rbx
+  80424a:	41 5c                	pop    %r12
+  80424c:	41 5d                	pop    %r13
+  80424e:	41 5e                	pop    %r14
+  804250:	41 5f                	pop    %r15
+  804252:	5d                   	pop    %rbp
+  804253:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804254:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80425a:	eb e3                	jmp    80423f <devcons_write+0x85>
+
+000000000080425c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80425c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80425f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804264:	48 85 c0             	test   %rax,%rax
+  804267:	74 55                	je     8042be <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804269:	55                   	push   %rbp
+  80426a:	48 89 e5             	mov    %rsp,%rbp
+  80426d:	41 55                	push   %r13
+  80426f:	41 54                	push   %r12
+  804271:	53                   	push   %rbx
+  804272:	48 83 ec 08          	sub    $0x8,%rsp
+  804276:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804279:	48 bb 46 14 80 00 00 	movabs $0x801446,%rbx
+  804280:	00 00 00 
+  804283:	49 bc 13 15 80 00 00 	movabs $0x801513,%r12
+  80428a:	00 00 00 
+  80428d:	eb 03                	jmp    804292 <devcons_read+0x36>
+  80428f:	41 ff d4             	call   *%r12
+  804292:	ff d3                	call   *%rbx
+  804294:	85 c0                	test   %eax,%eax
+  804296:	74 f7                	je     80428f <devcons_read+0x33>
+    if (c < 0) return c;
+  804298:	48 63 d0             	movslq %eax,%rdx
+  80429b:	78 13                	js     8042b0 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80429d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042a2:	83 f8 04             	cmp    $0x4,%eax
+  8042a5:	74 09                	je     8042b0 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8042a7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8042ab:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8042b0:	48 89 d0             	mov    %rdx,%rax
+  8042b3:	48 83 c4 08          	add    $0x8,%rsp
+  8042b7:	5b                   	pop    %rbx
+  8042b8:	41 5c                	pop    %r12
+  8042ba:	41 5d                	pop    %r13
+  8042bc:	5d                   	pop    %rbp
+  8042bd:	c3                   	ret
+  8042be:	48 89 d0             	mov    %rdx,%rax
+  8042c1:	c3                   	ret
+
+00000000008042c2 <cputchar>:
+cputchar(int ch) {
+  8042c2:	55                   	push   %rbp
+  8042c3:	48 89 e5             	mov    %rsp,%rbp
+  8042c6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8042ca:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8042ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8042d3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8042d7:	48 b8 19 14 80 00 00 	movabs $0x801419,%rax
+  8042de:	00 00 00 
+  8042e1:	ff d0                	call   *%rax
+}
+  8042e3:	c9                   	leave
+  8042e4:	c3                   	ret
+
+00000000008042e5 <getchar>:
+getchar(void) {
+  8042e5:	55                   	push   %rbp
+  8042e6:	48 89 e5             	mov    %rsp,%rbp
+  8042e9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8042ed:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042f2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8042f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042fb:	48 b8 a3 24 80 00 00 	movabs $0x8024a3,%rax
+  804302:	00 00 00 
+  804305:	ff d0                	call   *%rax
+  804307:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804309:	85 c0                	test   %eax,%eax
+  80430b:	78 06                	js     804313 <getchar+0x2e>
+  80430d:	74 08                	je     804317 <getchar+0x32>
+  80430f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804313:	89 d0                	mov    %edx,%eax
+  804315:	c9                   	leave
+  804316:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804317:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80431c:	eb f5                	jmp    804313 <getchar+0x2e>
+
+000000000080431e <iscons>:
+iscons(int fdnum) {
+  80431e:	55                   	push   %rbp
+  80431f:	48 89 e5             	mov    %rsp,%rbp
+  804322:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804326:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80432a:	48 b8 c0 21 80 00 00 	movabs $0x8021c0,%rax
+  804331:	00 00 00 
+  804334:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804336:	85 c0                	test   %eax,%eax
+  804338:	78 18                	js     804352 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80433a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80433e:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804345:	00 00 00 
+  804348:	8b 00                	mov    (%rax),%eax
+  80434a:	39 02                	cmp    %eax,(%rdx)
+  80434c:	0f 94 c0             	sete   %al
+  80434f:	0f b6 c0             	movzbl %al,%eax
+}
+  804352:	c9                   	leave
+  804353:	c3                   	ret
+
+0000000000804354 <opencons>:
+opencons(void) {
+  804354:	55                   	push   %rbp
+  804355:	48 89 e5             	mov    %rsp,%rbp
+  804358:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80435c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804360:	48 b8 60 21 80 00 00 	movabs $0x802160,%rax
+  804367:	00 00 00 
+  80436a:	ff d0                	call   *%rax
+  80436c:	85 c0                	test   %eax,%eax
+  80436e:	78 49                	js     8043b9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804370:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804375:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80437a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80437e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804383:	48 b8 a2 15 80 00 00 	movabs $0x8015a2,%rax
+  80438a:	00 00 00 
+  80438d:	ff d0                	call   *%rax
+  80438f:	85 c0                	test   %eax,%eax
+  804391:	78 26                	js     8043b9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804393:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804397:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80439e:	00 00 
+  8043a0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8043a2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043a6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8043ad:	48 b8 32 21 80 00 00 	movabs $0x802132,%rax
+  8043b4:	00 00 00 
+  8043b7:	ff d0                	call   *%rax
+}
+  8043b9:	c9                   	leave
+  8043ba:	c3                   	ret
+
+00000000008043bb <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8043bb:	55                   	push   %rbp
+  8043bc:	48 89 e5             	mov    %rsp,%rbp
+  8043bf:	41 56                	push   %r14
+  8043c1:	41 55                	push   %r13
+  8043c3:	41 54                	push   %r12
+  8043c5:	53                   	push   %rbx
+  8043c6:	48 83 ec 50          	sub    $0x50,%rsp
+  8043ca:	49 89 fc             	mov    %rdi,%r12
+  8043cd:	41 89 f5             	mov    %esi,%r13d
+  8043d0:	48 89 d3             	mov    %rdx,%rbx
+  8043d3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8043d7:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8043db:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8043df:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8043e6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8043ea:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8043ee:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8043f2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8043f6:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8043fd:	00 00 00 
+  804400:	4c 8b 30             	mov    (%rax),%r14
+  804403:	48 b8 e2 14 80 00 00 	movabs $0x8014e2,%rax
+  80440a:	00 00 00 
+  80440d:	ff d0                	call   *%rax
+  80440f:	89 c6                	mov    %eax,%esi
+  804411:	45 89 e8             	mov    %r13d,%r8d
+  804414:	4c 89 e1             	mov    %r12,%rcx
+  804417:	4c 89 f2             	mov    %r14,%rdx
+  80441a:	48 bf a0 58 80 00 00 	movabs $0x8058a0,%rdi
+  804421:	00 00 00 
+  804424:	b8 00 00 00 00       	mov    $0x0,%eax
+  804429:	49 bc ca 04 80 00 00 	movabs $0x8004ca,%r12
+  804430:	00 00 00 
+  804433:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  804436:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80443a:	48 89 df             	mov    %rbx,%rdi
+  80443d:	48 b8 66 04 80 00 00 	movabs $0x800466,%rax
+  804444:	00 00 00 
+  804447:	ff d0                	call   *%rax
+    cprintf("\n");
+  804449:	48 bf 19 50 80 00 00 	movabs $0x805019,%rdi
+  804450:	00 00 00 
+  804453:	b8 00 00 00 00       	mov    $0x0,%eax
+  804458:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80445b:	cc                   	int3
+  80445c:	eb fd                	jmp    80445b <_panic+0xa0>
+
+000000000080445e <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80445e:	55                   	push   %rbp
+  80445f:	48 89 e5             	mov    %rsp,%rbp
+  804462:	41 55                	push   %r13
+  804464:	41 54                	push   %r12
+  804466:	53                   	push   %rbx
+  804467:	48 83 ec 08          	sub    $0x8,%rsp
+  80446b:	49 89 fc             	mov    %rdi,%r12
+  80446e:	48 89 f7             	mov    %rsi,%rdi
+  804471:	48 89 d3             	mov    %rdx,%rbx
+  804474:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804477:	48 85 f6             	test   %rsi,%rsi
+  80447a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804481:	00 00 00 
+  804484:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804488:	be 00 10 00 00       	mov    $0x1000,%esi
+  80448d:	48 85 d2             	test   %rdx,%rdx
+  804490:	74 03                	je     804495 <ipc_recv+0x37>
+  804492:	48 8b 32             	mov    (%rdx),%rsi
+  804495:	48 b8 4f 19 80 00 00 	movabs $0x80194f,%rax
+  80449c:	00 00 00 
+  80449f:	ff d0                	call   *%rax
+    if (errno) {
+  8044a1:	85 c0                	test   %eax,%eax
+  8044a3:	74 1c                	je     8044c1 <ipc_recv+0x63>
+        if (from_env_store)
+  8044a5:	4d 85 e4             	test   %r12,%r12
+  8044a8:	74 08                	je     8044b2 <ipc_recv+0x54>
+            *from_env_store = 0;
+  8044aa:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8044b1:	00 
+
+        if (perm_store)
+  8044b2:	4d 85 ed             	test   %r13,%r13
+  8044b5:	74 74                	je     80452b <ipc_recv+0xcd>
+            *perm_store = 0;
+  8044b7:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8044be:	00 
+  8044bf:	eb 6a                	jmp    80452b <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8044c1:	4d 85 e4             	test   %r12,%r12
+  8044c4:	74 14                	je     8044da <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8044c6:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044cd:	00 00 00 
+  8044d0:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8044d6:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  8044da:	48 85 db             	test   %rbx,%rbx
+  8044dd:	74 23                	je     804502 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8044df:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044e6:	00 00 00 
+  8044e9:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8044ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044f4:	85 c9                	test   %ecx,%ecx
+  8044f6:	74 07                	je     8044ff <ipc_recv+0xa1>
+  8044f8:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8044ff:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804502:	4d 85 ed             	test   %r13,%r13
+  804505:	74 14                	je     80451b <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804507:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80450e:	00 00 00 
+  804511:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804517:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  80451b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804522:	00 00 00 
+  804525:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  80452b:	48 83 c4 08          	add    $0x8,%rsp
+  80452f:	5b                   	pop    %rbx
+  804530:	41 5c                	pop    %r12
+  804532:	41 5d                	pop    %r13
+  804534:	5d                   	pop    %rbp
+  804535:	c3                   	ret
+
+0000000000804536 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804536:	55                   	push   %rbp
+  804537:	48 89 e5             	mov    %rsp,%rbp
+  80453a:	41 55                	push   %r13
+  80453c:	41 54                	push   %r12
+  80453e:	53                   	push   %rbx
+  80453f:	48 83 ec 08          	sub    $0x8,%rsp
+  804543:	49 89 fc             	mov    %rdi,%r12
+  804546:	48 89 f7             	mov    %rsi,%rdi
+  804549:	48 89 d3             	mov    %rdx,%rbx
+  80454c:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80454f:	48 85 f6             	test   %rsi,%rsi
+  804552:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804559:	00 00 00 
+  80455c:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804560:	be 00 10 00 00       	mov    $0x1000,%esi
+  804565:	48 85 d2             	test   %rdx,%rdx
+  804568:	74 03                	je     80456d <ipc_try_recv+0x37>
+  80456a:	48 8b 32             	mov    (%rdx),%rsi
+  80456d:	48 b8 b8 19 80 00 00 	movabs $0x8019b8,%rax
+  804574:	00 00 00 
+  804577:	ff d0                	call   *%rax
+    if (errno) {
+  804579:	85 c0                	test   %eax,%eax
+  80457b:	75 75                	jne    8045f2 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80457d:	4d 85 e4             	test   %r12,%r12
+  804580:	74 14                	je     804596 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804582:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804589:	00 00 00 
+  80458c:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804592:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804596:	48 85 db             	test   %rbx,%rbx
+  804599:	74 23                	je     8045be <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80459b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8045a2:	00 00 00 
+  8045a5:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8045ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045b0:	85 c9                	test   %ecx,%ecx
+  8045b2:	74 07                	je     8045bb <ipc_try_recv+0x85>
+  8045b4:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8045bb:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8045be:	4d 85 ed             	test   %r13,%r13
+  8045c1:	74 14                	je     8045d7 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8045c3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8045ca:	00 00 00 
+  8045cd:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8045d3:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8045d7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8045de:	00 00 00 
+  8045e1:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  8045e7:	48 83 c4 08          	add    $0x8,%rsp
+  8045eb:	5b                   	pop    %rbx
+  8045ec:	41 5c                	pop    %r12
+  8045ee:	41 5d                	pop    %r13
+  8045f0:	5d                   	pop    %rbp
+  8045f1:	c3                   	ret
+        if (from_env_store)
+  8045f2:	4d 85 e4             	test   %r12,%r12
+  8045f5:	74 08                	je     8045ff <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8045f7:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045fe:	00 
+        if (perm_store)
+  8045ff:	4d 85 ed             	test   %r13,%r13
+  804602:	74 e3                	je     8045e7 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804604:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80460b:	00 
+  80460c:	eb d9                	jmp    8045e7 <ipc_try_recv+0xb1>
+
+000000000080460e <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80460e:	55                   	push   %rbp
+  80460f:	48 89 e5             	mov    %rsp,%rbp
+  804612:	41 57                	push   %r15
+  804614:	41 56                	push   %r14
+  804616:	41 55                	push   %r13
+  804618:	41 54                	push   %r12
+  80461a:	53                   	push   %rbx
+  80461b:	48 83 ec 18          	sub    $0x18,%rsp
+  80461f:	41 89 fd             	mov    %edi,%r13d
+  804622:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804625:	48 89 d3             	mov    %rdx,%rbx
+  804628:	49 89 cc             	mov    %rcx,%r12
+  80462b:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80462f:	48 85 d2             	test   %rdx,%rdx
+  804632:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804639:	00 00 00 
+  80463c:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804640:	49 be 23 19 80 00 00 	movabs $0x801923,%r14
+  804647:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  80464a:	49 bf 13 15 80 00 00 	movabs $0x801513,%r15
+  804651:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804654:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804657:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80465b:	4c 89 e1             	mov    %r12,%rcx
+  80465e:	48 89 da             	mov    %rbx,%rdx
+  804661:	44 89 ef             	mov    %r13d,%edi
+  804664:	41 ff d6             	call   *%r14
+  804667:	85 c0                	test   %eax,%eax
+  804669:	74 37                	je     8046a2 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  80466b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80466e:	75 05                	jne    804675 <ipc_send+0x67>
+        sys_yield();
+  804670:	41 ff d7             	call   *%r15
+  804673:	eb df                	jmp    804654 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804675:	89 c1                	mov    %eax,%ecx
+  804677:	48 ba c3 58 80 00 00 	movabs $0x8058c3,%rdx
+  80467e:	00 00 00 
+  804681:	be 65 00 00 00       	mov    $0x65,%esi
+  804686:	48 bf de 58 80 00 00 	movabs $0x8058de,%rdi
+  80468d:	00 00 00 
+  804690:	b8 00 00 00 00       	mov    $0x0,%eax
+  804695:	49 b8 bb 43 80 00 00 	movabs $0x8043bb,%r8
+  80469c:	00 00 00 
+  80469f:	41 ff d0             	call   *%r8
+    }
+}
+  8046a2:	48 83 c4 18          	add    $0x18,%rsp
+  8046a6:	5b                   	pop    %rbx
+  8046a7:	41 5c                	pop    %r12
+  8046a9:	41 5d                	pop    %r13
+  8046ab:	41 5e                	pop    %r14
+  8046ad:	41 5f                	pop    %r15
+  8046af:	5d                   	pop    %rbp
+  8046b0:	c3                   	ret
+
+00000000008046b1 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8046b1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8046b6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8046bd:	00 00 00 
+  8046c0:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8046c7:	48 01 ca             	add    %rcx,%rdx
+  8046ca:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8046d0:	39 fa                	cmp    %edi,%edx
+  8046d2:	74 12                	je     8046e6 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8046d4:	48 83 c0 01          	add    $0x1,%rax
+  8046d8:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8046de:	75 e0                	jne    8046c0 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8046e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046e5:	c3                   	ret
+            return envs[i].env_id;
+  8046e6:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8046ed:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046f4:	00 00 00 
+  8046f7:	48 01 d0             	add    %rdx,%rax
+  8046fa:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804700:	c3                   	ret
+
+0000000000804701 <__text_end>:
+  804701:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804708:	00 00 00 
+  80470b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804712:	00 00 00 
+  804715:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471c:	00 00 00 
+  80471f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804726:	00 00 00 
+  804729:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804730:	00 00 00 
+  804733:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473a:	00 00 00 
+  80473d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804744:	00 00 00 
+  804747:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474e:	00 00 00 
+  804751:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804758:	00 00 00 
+  80475b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804762:	00 00 00 
+  804765:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476c:	00 00 00 
+  80476f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804776:	00 00 00 
+  804779:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804780:	00 00 00 
+  804783:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478a:	00 00 00 
+  80478d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804794:	00 00 00 
+  804797:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479e:	00 00 00 
+  8047a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a8:	00 00 00 
+  8047ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b2:	00 00 00 
+  8047b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bc:	00 00 00 
+  8047bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c6:	00 00 00 
+  8047c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d0:	00 00 00 
+  8047d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047da:	00 00 00 
+  8047dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e4:	00 00 00 
+  8047e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ee:	00 00 00 
+  8047f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f8:	00 00 00 
+  8047fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804802:	00 00 00 
+  804805:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480c:	00 00 00 
+  80480f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804816:	00 00 00 
+  804819:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804820:	00 00 00 
+  804823:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482a:	00 00 00 
+  80482d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804834:	00 00 00 
+  804837:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483e:	00 00 00 
+  804841:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804848:	00 00 00 
+  80484b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804852:	00 00 00 
+  804855:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485c:	00 00 00 
+  80485f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804866:	00 00 00 
+  804869:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804870:	00 00 00 
+  804873:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487a:	00 00 00 
+  80487d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804884:	00 00 00 
+  804887:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488e:	00 00 00 
+  804891:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804898:	00 00 00 
+  80489b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a2:	00 00 00 
+  8048a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ac:	00 00 00 
+  8048af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b6:	00 00 00 
+  8048b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c0:	00 00 00 
+  8048c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ca:	00 00 00 
+  8048cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d4:	00 00 00 
+  8048d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048de:	00 00 00 
+  8048e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e8:	00 00 00 
+  8048eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f2:	00 00 00 
+  8048f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fc:	00 00 00 
+  8048ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804906:	00 00 00 
+  804909:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804910:	00 00 00 
+  804913:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491a:	00 00 00 
+  80491d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804924:	00 00 00 
+  804927:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492e:	00 00 00 
+  804931:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804938:	00 00 00 
+  80493b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804942:	00 00 00 
+  804945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494c:	00 00 00 
+  80494f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804956:	00 00 00 
+  804959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804960:	00 00 00 
+  804963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496a:	00 00 00 
+  80496d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804974:	00 00 00 
+  804977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497e:	00 00 00 
+  804981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804988:	00 00 00 
+  80498b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804992:	00 00 00 
+  804995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499c:	00 00 00 
+  80499f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a6:	00 00 00 
+  8049a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b0:	00 00 00 
+  8049b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ba:	00 00 00 
+  8049bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c4:	00 00 00 
+  8049c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ce:	00 00 00 
+  8049d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d8:	00 00 00 
+  8049db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e2:	00 00 00 
+  8049e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ec:	00 00 00 
+  8049ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f6:	00 00 00 
+  8049f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a00:	00 00 00 
+  804a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0a:	00 00 00 
+  804a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a14:	00 00 00 
+  804a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1e:	00 00 00 
+  804a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a28:	00 00 00 
+  804a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a32:	00 00 00 
+  804a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3c:	00 00 00 
+  804a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a46:	00 00 00 
+  804a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a50:	00 00 00 
+  804a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5a:	00 00 00 
+  804a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a64:	00 00 00 
+  804a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6e:	00 00 00 
+  804a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a78:	00 00 00 
+  804a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a82:	00 00 00 
+  804a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8c:	00 00 00 
+  804a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a96:	00 00 00 
+  804a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa0:	00 00 00 
+  804aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaa:	00 00 00 
+  804aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab4:	00 00 00 
+  804ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abe:	00 00 00 
+  804ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac8:	00 00 00 
+  804acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad2:	00 00 00 
+  804ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adc:	00 00 00 
+  804adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae6:	00 00 00 
+  804ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af0:	00 00 00 
+  804af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afa:	00 00 00 
+  804afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b04:	00 00 00 
+  804b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0e:	00 00 00 
+  804b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b18:	00 00 00 
+  804b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b22:	00 00 00 
+  804b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2c:	00 00 00 
+  804b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b36:	00 00 00 
+  804b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b40:	00 00 00 
+  804b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4a:	00 00 00 
+  804b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b54:	00 00 00 
+  804b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5e:	00 00 00 
+  804b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b68:	00 00 00 
+  804b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b72:	00 00 00 
+  804b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7c:	00 00 00 
+  804b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b86:	00 00 00 
+  804b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b90:	00 00 00 
+  804b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9a:	00 00 00 
+  804b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba4:	00 00 00 
+  804ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bae:	00 00 00 
+  804bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb8:	00 00 00 
+  804bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc2:	00 00 00 
+  804bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcc:	00 00 00 
+  804bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd6:	00 00 00 
+  804bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be0:	00 00 00 
+  804be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bea:	00 00 00 
+  804bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf4:	00 00 00 
+  804bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfe:	00 00 00 
+  804c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c08:	00 00 00 
+  804c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c12:	00 00 00 
+  804c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1c:	00 00 00 
+  804c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c26:	00 00 00 
+  804c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c30:	00 00 00 
+  804c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3a:	00 00 00 
+  804c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c44:	00 00 00 
+  804c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4e:	00 00 00 
+  804c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c58:	00 00 00 
+  804c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c62:	00 00 00 
+  804c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6c:	00 00 00 
+  804c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c76:	00 00 00 
+  804c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c80:	00 00 00 
+  804c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8a:	00 00 00 
+  804c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c94:	00 00 00 
+  804c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9e:	00 00 00 
+  804ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca8:	00 00 00 
+  804cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb2:	00 00 00 
+  804cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbc:	00 00 00 
+  804cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc6:	00 00 00 
+  804cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd0:	00 00 00 
+  804cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cda:	00 00 00 
+  804cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce4:	00 00 00 
+  804ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cee:	00 00 00 
+  804cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf8:	00 00 00 
+  804cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d02:	00 00 00 
+  804d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0c:	00 00 00 
+  804d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d16:	00 00 00 
+  804d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d20:	00 00 00 
+  804d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2a:	00 00 00 
+  804d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d34:	00 00 00 
+  804d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3e:	00 00 00 
+  804d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d48:	00 00 00 
+  804d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d52:	00 00 00 
+  804d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5c:	00 00 00 
+  804d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d66:	00 00 00 
+  804d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d70:	00 00 00 
+  804d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7a:	00 00 00 
+  804d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d84:	00 00 00 
+  804d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8e:	00 00 00 
+  804d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d98:	00 00 00 
+  804d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da2:	00 00 00 
+  804da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dac:	00 00 00 
+  804daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db6:	00 00 00 
+  804db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc0:	00 00 00 
+  804dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dca:	00 00 00 
+  804dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd4:	00 00 00 
+  804dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dde:	00 00 00 
+  804de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de8:	00 00 00 
+  804deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df2:	00 00 00 
+  804df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfc:	00 00 00 
+  804dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e06:	00 00 00 
+  804e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e10:	00 00 00 
+  804e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1a:	00 00 00 
+  804e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e24:	00 00 00 
+  804e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2e:	00 00 00 
+  804e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e38:	00 00 00 
+  804e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e42:	00 00 00 
+  804e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4c:	00 00 00 
+  804e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e56:	00 00 00 
+  804e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e60:	00 00 00 
+  804e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6a:	00 00 00 
+  804e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e74:	00 00 00 
+  804e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7e:	00 00 00 
+  804e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e88:	00 00 00 
+  804e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e92:	00 00 00 
+  804e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9c:	00 00 00 
+  804e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea6:	00 00 00 
+  804ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb0:	00 00 00 
+  804eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eba:	00 00 00 
+  804ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec4:	00 00 00 
+  804ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ece:	00 00 00 
+  804ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed8:	00 00 00 
+  804edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee2:	00 00 00 
+  804ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eec:	00 00 00 
+  804eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef6:	00 00 00 
+  804ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f00:	00 00 00 
+  804f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0a:	00 00 00 
+  804f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f14:	00 00 00 
+  804f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1e:	00 00 00 
+  804f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f28:	00 00 00 
+  804f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f32:	00 00 00 
+  804f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3c:	00 00 00 
+  804f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f46:	00 00 00 
+  804f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f50:	00 00 00 
+  804f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5a:	00 00 00 
+  804f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f64:	00 00 00 
+  804f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6e:	00 00 00 
+  804f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f78:	00 00 00 
+  804f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f82:	00 00 00 
+  804f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8c:	00 00 00 
+  804f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f96:	00 00 00 
+  804f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa0:	00 00 00 
+  804fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faa:	00 00 00 
+  804fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb4:	00 00 00 
+  804fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbe:	00 00 00 
+  804fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc8:	00 00 00 
+  804fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd2:	00 00 00 
+  804fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdc:	00 00 00 
+  804fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe6:	00 00 00 
+  804fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff0:	00 00 00 
+  804ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffa:	00 00 00 
+  804ffd:	0f 1f 00             	nopl   (%rax)
@@ -0,0 +1,9900 @@
+
+obj/user/sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 8e 0a 00 00       	call   800ab1 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <_gettoken>:
+
+int
+_gettoken(char *s, char **p1, char **p2) {
+    int t;
+
+    if (s == 0) {
+  800025:	48 85 ff             	test   %rdi,%rdi
+  800028:	0f 84 e3 00 00 00    	je     800111 <_gettoken+0xec>
+_gettoken(char *s, char **p1, char **p2) {
+  80002e:	55                   	push   %rbp
+  80002f:	48 89 e5             	mov    %rsp,%rbp
+  800032:	41 57                	push   %r15
+  800034:	41 56                	push   %r14
+  800036:	41 55                	push   %r13
+  800038:	41 54                	push   %r12
+  80003a:	53                   	push   %rbx
+  80003b:	48 83 ec 08          	sub    $0x8,%rsp
+  80003f:	48 89 fb             	mov    %rdi,%rbx
+  800042:	49 89 f7             	mov    %rsi,%r15
+  800045:	49 89 d6             	mov    %rdx,%r14
+    }
+
+    if (debug > 1)
+        cprintf("GETTOKEN: %s\n", s);
+
+    *p1 = 0;
+  800048:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *p2 = 0;
+  80004f:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+
+    while (strchr(WHITESPACE, *s))
+  800056:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  80005d:	00 00 00 
+  800060:	49 bc 4a 17 80 00 00 	movabs $0x80174a,%r12
+  800067:	00 00 00 
+  80006a:	eb 08                	jmp    800074 <_gettoken+0x4f>
+        *s++ = 0;
+  80006c:	48 83 c3 01          	add    $0x1,%rbx
+  800070:	c6 43 ff 00          	movb   $0x0,-0x1(%rbx)
+    while (strchr(WHITESPACE, *s))
+  800074:	0f be 33             	movsbl (%rbx),%esi
+  800077:	4c 89 ef             	mov    %r13,%rdi
+  80007a:	41 ff d4             	call   *%r12
+  80007d:	48 85 c0             	test   %rax,%rax
+  800080:	75 ea                	jne    80006c <_gettoken+0x47>
+    if (*s == 0) {
+  800082:	0f b6 33             	movzbl (%rbx),%esi
+  800085:	40 84 f6             	test   %sil,%sil
+  800088:	75 0f                	jne    800099 <_gettoken+0x74>
+        **p2 = 0;
+        cprintf("WORD: %s\n", *p1);
+        **p2 = t;
+    }
+    return 'w';
+}
+  80008a:	48 83 c4 08          	add    $0x8,%rsp
+  80008e:	5b                   	pop    %rbx
+  80008f:	41 5c                	pop    %r12
+  800091:	41 5d                	pop    %r13
+  800093:	41 5e                	pop    %r14
+  800095:	41 5f                	pop    %r15
+  800097:	5d                   	pop    %rbp
+  800098:	c3                   	ret
+    if (strchr(SYMBOLS, *s)) {
+  800099:	40 0f be f6          	movsbl %sil,%esi
+  80009d:	48 bf 09 60 80 00 00 	movabs $0x806009,%rdi
+  8000a4:	00 00 00 
+  8000a7:	48 b8 4a 17 80 00 00 	movabs $0x80174a,%rax
+  8000ae:	00 00 00 
+  8000b1:	ff d0                	call   *%rax
+  8000b3:	48 85 c0             	test   %rax,%rax
+  8000b6:	74 12                	je     8000ca <_gettoken+0xa5>
+        t = *s;
+  8000b8:	0f be 03             	movsbl (%rbx),%eax
+        *p1 = s;
+  8000bb:	49 89 1f             	mov    %rbx,(%r15)
+        *s++ = 0;
+  8000be:	c6 03 00             	movb   $0x0,(%rbx)
+  8000c1:	48 83 c3 01          	add    $0x1,%rbx
+  8000c5:	49 89 1e             	mov    %rbx,(%r14)
+        return t;
+  8000c8:	eb c0                	jmp    80008a <_gettoken+0x65>
+    *p1 = s;
+  8000ca:	49 89 1f             	mov    %rbx,(%r15)
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8000cd:	0f b6 33             	movzbl (%rbx),%esi
+  8000d0:	49 bd 05 60 80 00 00 	movabs $0x806005,%r13
+  8000d7:	00 00 00 
+  8000da:	49 bc 4a 17 80 00 00 	movabs $0x80174a,%r12
+  8000e1:	00 00 00 
+  8000e4:	40 84 f6             	test   %sil,%sil
+  8000e7:	74 1b                	je     800104 <_gettoken+0xdf>
+  8000e9:	40 0f be f6          	movsbl %sil,%esi
+  8000ed:	4c 89 ef             	mov    %r13,%rdi
+  8000f0:	41 ff d4             	call   *%r12
+  8000f3:	48 85 c0             	test   %rax,%rax
+  8000f6:	75 0c                	jne    800104 <_gettoken+0xdf>
+        s++;
+  8000f8:	48 83 c3 01          	add    $0x1,%rbx
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8000fc:	0f b6 33             	movzbl (%rbx),%esi
+  8000ff:	40 84 f6             	test   %sil,%sil
+  800102:	75 e5                	jne    8000e9 <_gettoken+0xc4>
+    *p2 = s;
+  800104:	49 89 1e             	mov    %rbx,(%r14)
+    return 'w';
+  800107:	b8 77 00 00 00       	mov    $0x77,%eax
+  80010c:	e9 79 ff ff ff       	jmp    80008a <_gettoken+0x65>
+        return 0;
+  800111:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800116:	c3                   	ret
+
+0000000000800117 <gettoken>:
+
+int
+gettoken(char *s, char **p1) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+    static int c, nc;
+    static char *np1, *np2;
+
+    if (s) {
+  80011e:	48 85 ff             	test   %rdi,%rdi
+  800121:	74 33                	je     800156 <gettoken+0x3f>
+        nc = _gettoken(s, &np1, &np2);
+  800123:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  80012a:	00 00 00 
+  80012d:	48 be 10 80 80 00 00 	movabs $0x808010,%rsi
+  800134:	00 00 00 
+  800137:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80013e:	00 00 00 
+  800141:	ff d0                	call   *%rax
+  800143:	a3 04 80 80 00 00 00 	movabs %eax,0x808004
+  80014a:	00 00 
+        return 0;
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+    c = nc;
+    *p1 = np1;
+    nc = _gettoken(np2, &np1, &np2);
+    return c;
+}
+  800151:	5b                   	pop    %rbx
+  800152:	41 5c                	pop    %r12
+  800154:	5d                   	pop    %rbp
+  800155:	c3                   	ret
+    c = nc;
+  800156:	48 bb 00 80 80 00 00 	movabs $0x808000,%rbx
+  80015d:	00 00 00 
+  800160:	49 bc 04 80 80 00 00 	movabs $0x808004,%r12
+  800167:	00 00 00 
+  80016a:	41 8b 04 24          	mov    (%r12),%eax
+  80016e:	89 03                	mov    %eax,(%rbx)
+    *p1 = np1;
+  800170:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  800177:	00 00 00 
+  80017a:	48 8b 10             	mov    (%rax),%rdx
+  80017d:	48 89 16             	mov    %rdx,(%rsi)
+    nc = _gettoken(np2, &np1, &np2);
+  800180:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  800187:	00 00 00 
+  80018a:	48 8b 3a             	mov    (%rdx),%rdi
+  80018d:	48 89 c6             	mov    %rax,%rsi
+  800190:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800197:	00 00 00 
+  80019a:	ff d0                	call   *%rax
+  80019c:	41 89 04 24          	mov    %eax,(%r12)
+    return c;
+  8001a0:	8b 03                	mov    (%rbx),%eax
+  8001a2:	eb ad                	jmp    800151 <gettoken+0x3a>
+
+00000000008001a4 <runcmd>:
+runcmd(char *s) {
+  8001a4:	55                   	push   %rbp
+  8001a5:	48 89 e5             	mov    %rsp,%rbp
+  8001a8:	41 56                	push   %r14
+  8001aa:	41 55                	push   %r13
+  8001ac:	41 54                	push   %r12
+  8001ae:	53                   	push   %rbx
+  8001af:	48 81 ec 90 04 00 00 	sub    $0x490,%rsp
+    gettoken(s, 0);
+  8001b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bb:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+        switch ((c = gettoken(0, &t))) {
+  8001c7:	49 bd 17 01 80 00 00 	movabs $0x800117,%r13
+  8001ce:	00 00 00 
+    argc = 0;
+  8001d1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        switch ((c = gettoken(0, &t))) {
+  8001d7:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8001de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e3:	41 ff d5             	call   *%r13
+  8001e6:	89 c3                	mov    %eax,%ebx
+  8001e8:	83 f8 3e             	cmp    $0x3e,%eax
+  8001eb:	0f 84 93 01 00 00    	je     800384 <runcmd+0x1e0>
+  8001f1:	7f 5e                	jg     800251 <runcmd+0xad>
+  8001f3:	85 c0                	test   %eax,%eax
+  8001f5:	0f 84 c5 02 00 00    	je     8004c0 <runcmd+0x31c>
+  8001fb:	83 f8 3c             	cmp    $0x3c,%eax
+  8001fe:	0f 85 94 03 00 00    	jne    800598 <runcmd+0x3f4>
+            if (gettoken(0, &t) != 'w') {
+  800204:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80020b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800210:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800217:	00 00 00 
+  80021a:	ff d0                	call   *%rax
+  80021c:	83 f8 77             	cmp    $0x77,%eax
+  80021f:	0f 85 e1 00 00 00    	jne    800306 <runcmd+0x162>
+            if ((fd = open(t, O_RDONLY)) < 0) {
+  800225:	4c 8b b5 58 ff ff ff 	mov    -0xa8(%rbp),%r14
+  80022c:	be 00 00 00 00       	mov    $0x0,%esi
+  800231:	4c 89 f7             	mov    %r14,%rdi
+  800234:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+  800240:	89 c3                	mov    %eax,%ebx
+  800242:	85 c0                	test   %eax,%eax
+  800244:	0f 88 e8 00 00 00    	js     800332 <runcmd+0x18e>
+            if (fd != 0) {
+  80024a:	74 8b                	je     8001d7 <runcmd+0x33>
+  80024c:	e9 0d 01 00 00       	jmp    80035e <runcmd+0x1ba>
+        switch ((c = gettoken(0, &t))) {
+  800251:	83 f8 77             	cmp    $0x77,%eax
+  800254:	74 65                	je     8002bb <runcmd+0x117>
+  800256:	83 f8 7c             	cmp    $0x7c,%eax
+  800259:	0f 85 39 03 00 00    	jne    800598 <runcmd+0x3f4>
+            if ((r = pipe(p)) < 0) {
+  80025f:	48 8d bd 50 fb ff ff 	lea    -0x4b0(%rbp),%rdi
+  800266:	48 b8 86 50 80 00 00 	movabs $0x805086,%rax
+  80026d:	00 00 00 
+  800270:	ff d0                	call   *%rax
+  800272:	85 c0                	test   %eax,%eax
+  800274:	0f 88 ce 01 00 00    	js     800448 <runcmd+0x2a4>
+            if ((r = fork()) < 0) {
+  80027a:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  800281:	00 00 00 
+  800284:	ff d0                	call   *%rax
+  800286:	89 c3                	mov    %eax,%ebx
+  800288:	85 c0                	test   %eax,%eax
+  80028a:	0f 88 e6 01 00 00    	js     800476 <runcmd+0x2d2>
+            if (r == 0) {
+  800290:	0f 85 09 02 00 00    	jne    80049f <runcmd+0x2fb>
+                if (p[0] != 0) {
+  800296:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  80029c:	85 ff                	test   %edi,%edi
+  80029e:	0f 85 a4 02 00 00    	jne    800548 <runcmd+0x3a4>
+                close(p[1]);
+  8002a4:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  8002aa:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+                goto again;
+  8002b6:	e9 16 ff ff ff       	jmp    8001d1 <runcmd+0x2d>
+            if (argc == MAXARGS) {
+  8002bb:	41 83 fc 10          	cmp    $0x10,%r12d
+  8002bf:	74 1c                	je     8002dd <runcmd+0x139>
+            argv[argc++] = t;
+  8002c1:	49 63 c4             	movslq %r12d,%rax
+  8002c4:	48 8b 95 58 ff ff ff 	mov    -0xa8(%rbp),%rdx
+  8002cb:	48 89 94 c5 60 ff ff 	mov    %rdx,-0xa0(%rbp,%rax,8)
+  8002d2:	ff 
+  8002d3:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+            break;
+  8002d8:	e9 fa fe ff ff       	jmp    8001d7 <runcmd+0x33>
+                cprintf("too many arguments\n");
+  8002dd:	48 bf 11 60 80 00 00 	movabs $0x806011,%rdi
+  8002e4:	00 00 00 
+  8002e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ec:	48 ba cd 0c 80 00 00 	movabs $0x800ccd,%rdx
+  8002f3:	00 00 00 
+  8002f6:	ff d2                	call   *%rdx
+                exit();
+  8002f8:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  8002ff:	00 00 00 
+  800302:	ff d0                	call   *%rax
+  800304:	eb bb                	jmp    8002c1 <runcmd+0x11d>
+                cprintf("syntax error: < not followed by word\n");
+  800306:	48 bf c8 60 80 00 00 	movabs $0x8060c8,%rdi
+  80030d:	00 00 00 
+  800310:	b8 00 00 00 00       	mov    $0x0,%eax
+  800315:	48 ba cd 0c 80 00 00 	movabs $0x800ccd,%rdx
+  80031c:	00 00 00 
+  80031f:	ff d2                	call   *%rdx
+                exit();
+  800321:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  800328:	00 00 00 
+  80032b:	ff d0                	call   *%rax
+  80032d:	e9 f3 fe ff ff       	jmp    800225 <runcmd+0x81>
+                cprintf("open %s for read: %i", t, fd);
+  800332:	89 c2                	mov    %eax,%edx
+  800334:	4c 89 f6             	mov    %r14,%rsi
+  800337:	48 bf 25 60 80 00 00 	movabs $0x806025,%rdi
+  80033e:	00 00 00 
+  800341:	b8 00 00 00 00       	mov    $0x0,%eax
+  800346:	48 b9 cd 0c 80 00 00 	movabs $0x800ccd,%rcx
+  80034d:	00 00 00 
+  800350:	ff d1                	call   *%rcx
+                exit();
+  800352:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  800359:	00 00 00 
+  80035c:	ff d0                	call   *%rax
+                dup(fd, 0);
+  80035e:	be 00 00 00 00       	mov    $0x0,%esi
+  800363:	89 df                	mov    %ebx,%edi
+  800365:	48 b8 db 2d 80 00 00 	movabs $0x802ddb,%rax
+  80036c:	00 00 00 
+  80036f:	ff d0                	call   *%rax
+                close(fd);
+  800371:	89 df                	mov    %ebx,%edi
+  800373:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  80037a:	00 00 00 
+  80037d:	ff d0                	call   *%rax
+  80037f:	e9 53 fe ff ff       	jmp    8001d7 <runcmd+0x33>
+            if (gettoken(0, &t) != 'w') {
+  800384:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80038b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800390:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800397:	00 00 00 
+  80039a:	ff d0                	call   *%rax
+  80039c:	83 f8 77             	cmp    $0x77,%eax
+  80039f:	75 2c                	jne    8003cd <runcmd+0x229>
+            if ((fd = open(t, O_WRONLY | O_CREAT | O_TRUNC)) < 0) {
+  8003a1:	4c 8b b5 58 ff ff ff 	mov    -0xa8(%rbp),%r14
+  8003a8:	be 01 03 00 00       	mov    $0x301,%esi
+  8003ad:	4c 89 f7             	mov    %r14,%rdi
+  8003b0:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  8003b7:	00 00 00 
+  8003ba:	ff d0                	call   *%rax
+  8003bc:	89 c3                	mov    %eax,%ebx
+  8003be:	85 c0                	test   %eax,%eax
+  8003c0:	78 34                	js     8003f6 <runcmd+0x252>
+            if (fd != 1) {
+  8003c2:	83 f8 01             	cmp    $0x1,%eax
+  8003c5:	0f 84 0c fe ff ff    	je     8001d7 <runcmd+0x33>
+  8003cb:	eb 55                	jmp    800422 <runcmd+0x27e>
+                cprintf("syntax error: > not followed by word\n");
+  8003cd:	48 bf f0 60 80 00 00 	movabs $0x8060f0,%rdi
+  8003d4:	00 00 00 
+  8003d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dc:	48 ba cd 0c 80 00 00 	movabs $0x800ccd,%rdx
+  8003e3:	00 00 00 
+  8003e6:	ff d2                	call   *%rdx
+                exit();
+  8003e8:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  8003ef:	00 00 00 
+  8003f2:	ff d0                	call   *%rax
+  8003f4:	eb ab                	jmp    8003a1 <runcmd+0x1fd>
+                cprintf("open %s for write: %i", t, fd);
+  8003f6:	89 c2                	mov    %eax,%edx
+  8003f8:	4c 89 f6             	mov    %r14,%rsi
+  8003fb:	48 bf 3a 60 80 00 00 	movabs $0x80603a,%rdi
+  800402:	00 00 00 
+  800405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040a:	48 b9 cd 0c 80 00 00 	movabs $0x800ccd,%rcx
+  800411:	00 00 00 
+  800414:	ff d1                	call   *%rcx
+                exit();
+  800416:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  80041d:	00 00 00 
+  800420:	ff d0                	call   *%rax
+                dup(fd, 1);
+  800422:	be 01 00 00 00       	mov    $0x1,%esi
+  800427:	89 df                	mov    %ebx,%edi
+  800429:	48 b8 db 2d 80 00 00 	movabs $0x802ddb,%rax
+  800430:	00 00 00 
+  800433:	ff d0                	call   *%rax
+                close(fd);
+  800435:	89 df                	mov    %ebx,%edi
+  800437:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  80043e:	00 00 00 
+  800441:	ff d0                	call   *%rax
+  800443:	e9 8f fd ff ff       	jmp    8001d7 <runcmd+0x33>
+                cprintf("pipe: %i", r);
+  800448:	89 c6                	mov    %eax,%esi
+  80044a:	48 bf 50 60 80 00 00 	movabs $0x806050,%rdi
+  800451:	00 00 00 
+  800454:	b8 00 00 00 00       	mov    $0x0,%eax
+  800459:	48 ba cd 0c 80 00 00 	movabs $0x800ccd,%rdx
+  800460:	00 00 00 
+  800463:	ff d2                	call   *%rdx
+                exit();
+  800465:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  80046c:	00 00 00 
+  80046f:	ff d0                	call   *%rax
+  800471:	e9 04 fe ff ff       	jmp    80027a <runcmd+0xd6>
+                cprintf("fork: %i", r);
+  800476:	89 c6                	mov    %eax,%esi
+  800478:	48 bf 59 60 80 00 00 	movabs $0x806059,%rdi
+  80047f:	00 00 00 
+  800482:	b8 00 00 00 00       	mov    $0x0,%eax
+  800487:	48 ba cd 0c 80 00 00 	movabs $0x800ccd,%rdx
+  80048e:	00 00 00 
+  800491:	ff d2                	call   *%rdx
+                exit();
+  800493:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  80049a:	00 00 00 
+  80049d:	ff d0                	call   *%rax
+                if (p[1] != 1) {
+  80049f:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  8004a5:	83 ff 01             	cmp    $0x1,%edi
+  8004a8:	0f 85 c2 00 00 00    	jne    800570 <runcmd+0x3cc>
+                close(p[0]);
+  8004ae:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  8004b4:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  8004bb:	00 00 00 
+  8004be:	ff d0                	call   *%rax
+    if (argc == 0) {
+  8004c0:	45 85 e4             	test   %r12d,%r12d
+  8004c3:	74 73                	je     800538 <runcmd+0x394>
+    if (argv[0][0] != '/') {
+  8004c5:	48 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%rsi
+  8004cc:	80 3e 2f             	cmpb   $0x2f,(%rsi)
+  8004cf:	0f 85 f0 00 00 00    	jne    8005c5 <runcmd+0x421>
+    argv[argc] = 0;
+  8004d5:	4d 63 e4             	movslq %r12d,%r12
+  8004d8:	4a c7 84 e5 60 ff ff 	movq   $0x0,-0xa0(%rbp,%r12,8)
+  8004df:	ff 00 00 00 00 
+    if ((r = spawn(argv[0], (const char **)argv)) < 0)
+  8004e4:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  8004eb:	48 8b bd 60 ff ff ff 	mov    -0xa0(%rbp),%rdi
+  8004f2:	48 b8 bd 45 80 00 00 	movabs $0x8045bd,%rax
+  8004f9:	00 00 00 
+  8004fc:	ff d0                	call   *%rax
+  8004fe:	41 89 c4             	mov    %eax,%r12d
+  800501:	85 c0                	test   %eax,%eax
+  800503:	0f 88 e9 00 00 00    	js     8005f2 <runcmd+0x44e>
+    close_all();
+  800509:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  800510:	00 00 00 
+  800513:	ff d0                	call   *%rax
+        wait(r);
+  800515:	44 89 e7             	mov    %r12d,%edi
+  800518:	48 b8 e5 52 80 00 00 	movabs $0x8052e5,%rax
+  80051f:	00 00 00 
+  800522:	ff d0                	call   *%rax
+    if (pipe_child) {
+  800524:	85 db                	test   %ebx,%ebx
+  800526:	0f 85 fb 00 00 00    	jne    800627 <runcmd+0x483>
+    exit();
+  80052c:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  800533:	00 00 00 
+  800536:	ff d0                	call   *%rax
+}
+  800538:	48 81 c4 90 04 00 00 	add    $0x490,%rsp
+  80053f:	5b                   	pop    %rbx
+  800540:	41 5c                	pop    %r12
+  800542:	41 5d                	pop    %r13
+  800544:	41 5e                	pop    %r14
+  800546:	5d                   	pop    %rbp
+  800547:	c3                   	ret
+                    dup(p[0], 0);
+  800548:	be 00 00 00 00       	mov    $0x0,%esi
+  80054d:	48 b8 db 2d 80 00 00 	movabs $0x802ddb,%rax
+  800554:	00 00 00 
+  800557:	ff d0                	call   *%rax
+                    close(p[0]);
+  800559:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  80055f:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+  80056b:	e9 34 fd ff ff       	jmp    8002a4 <runcmd+0x100>
+                    dup(p[1], 1);
+  800570:	be 01 00 00 00       	mov    $0x1,%esi
+  800575:	48 b8 db 2d 80 00 00 	movabs $0x802ddb,%rax
+  80057c:	00 00 00 
+  80057f:	ff d0                	call   *%rax
+                    close(p[1]);
+  800581:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  800587:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  80058e:	00 00 00 
+  800591:	ff d0                	call   *%rax
+  800593:	e9 16 ff ff ff       	jmp    8004ae <runcmd+0x30a>
+            panic("bad return %d from gettoken", c);
+  800598:	89 d9                	mov    %ebx,%ecx
+  80059a:	48 ba 62 60 80 00 00 	movabs $0x806062,%rdx
+  8005a1:	00 00 00 
+  8005a4:	be 6e 00 00 00       	mov    $0x6e,%esi
+  8005a9:	48 bf 7e 60 80 00 00 	movabs $0x80607e,%rdi
+  8005b0:	00 00 00 
+  8005b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b8:	49 b8 7d 0b 80 00 00 	movabs $0x800b7d,%r8
+  8005bf:	00 00 00 
+  8005c2:	41 ff d0             	call   *%r8
+        argv0buf[0] = '/';
+  8005c5:	c6 85 58 fb ff ff 2f 	movb   $0x2f,-0x4a8(%rbp)
+        strcpy(argv0buf + 1, argv[0]);
+  8005cc:	4c 8d ad 58 fb ff ff 	lea    -0x4a8(%rbp),%r13
+  8005d3:	48 8d bd 59 fb ff ff 	lea    -0x4a7(%rbp),%rdi
+  8005da:	48 b8 45 16 80 00 00 	movabs $0x801645,%rax
+  8005e1:	00 00 00 
+  8005e4:	ff d0                	call   *%rax
+        argv[0] = argv0buf;
+  8005e6:	4c 89 ad 60 ff ff ff 	mov    %r13,-0xa0(%rbp)
+  8005ed:	e9 e3 fe ff ff       	jmp    8004d5 <runcmd+0x331>
+        cprintf("spawn %s: %i\n", argv[0], r);
+  8005f2:	89 c2                	mov    %eax,%edx
+  8005f4:	48 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%rsi
+  8005fb:	48 bf 88 60 80 00 00 	movabs $0x806088,%rdi
+  800602:	00 00 00 
+  800605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060a:	48 b9 cd 0c 80 00 00 	movabs $0x800ccd,%rcx
+  800611:	00 00 00 
+  800614:	ff d1                	call   *%rcx
+    close_all();
+  800616:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  80061d:	00 00 00 
+  800620:	ff d0                	call   *%rax
+    if (r >= 0) {
+  800622:	e9 fd fe ff ff       	jmp    800524 <runcmd+0x380>
+        wait(pipe_child);
+  800627:	89 df                	mov    %ebx,%edi
+  800629:	48 b8 e5 52 80 00 00 	movabs $0x8052e5,%rax
+  800630:	00 00 00 
+  800633:	ff d0                	call   *%rax
+        if (debug) cprintf("[%08x] wait finished\n", thisenv->env_id);
+  800635:	e9 f2 fe ff ff       	jmp    80052c <runcmd+0x388>
+
+000000000080063a <usage>:
+
+void
+usage(void) {
+  80063a:	55                   	push   %rbp
+  80063b:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: sh [-dix] [command-file]\n");
+  80063e:	48 bf 18 61 80 00 00 	movabs $0x806118,%rdi
+  800645:	00 00 00 
+  800648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064d:	48 ba cd 0c 80 00 00 	movabs $0x800ccd,%rdx
+  800654:	00 00 00 
+  800657:	ff d2                	call   *%rdx
+    exit();
+  800659:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  800660:	00 00 00 
+  800663:	ff d0                	call   *%rax
+}
+  800665:	5d                   	pop    %rbp
+  800666:	c3                   	ret
+
+0000000000800667 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800667:	55                   	push   %rbp
+  800668:	48 89 e5             	mov    %rsp,%rbp
+  80066b:	41 57                	push   %r15
+  80066d:	41 56                	push   %r14
+  80066f:	41 55                	push   %r13
+  800671:	41 54                	push   %r12
+  800673:	53                   	push   %rbx
+  800674:	48 83 ec 38          	sub    $0x38,%rsp
+  800678:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  80067b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+    int r, interactive, echocmds;
+    struct Argstate args;
+
+    interactive = '?';
+    echocmds = 0;
+    argstart(&argc, argv, &args);
+  80067f:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  800683:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  800687:	48 b8 13 2a 80 00 00 	movabs $0x802a13,%rax
+  80068e:	00 00 00 
+  800691:	ff d0                	call   *%rax
+    echocmds = 0;
+  800693:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    interactive = '?';
+  800699:	41 be 3f 00 00 00    	mov    $0x3f,%r14d
+    while ((r = argnext(&args)) >= 0) {
+  80069f:	48 bb 40 2a 80 00 00 	movabs $0x802a40,%rbx
+  8006a6:	00 00 00 
+        switch (r) {
+  8006a9:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            break;
+        case 'x':
+            echocmds = 1;
+            break;
+        default:
+            usage();
+  8006af:	49 bf 3a 06 80 00 00 	movabs $0x80063a,%r15
+  8006b6:	00 00 00 
+    while ((r = argnext(&args)) >= 0) {
+  8006b9:	eb 08                	jmp    8006c3 <umain+0x5c>
+        switch (r) {
+  8006bb:	45 89 e6             	mov    %r12d,%r14d
+  8006be:	eb 03                	jmp    8006c3 <umain+0x5c>
+            echocmds = 1;
+  8006c0:	45 89 e5             	mov    %r12d,%r13d
+    while ((r = argnext(&args)) >= 0) {
+  8006c3:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8006c7:	ff d3                	call   *%rbx
+  8006c9:	85 c0                	test   %eax,%eax
+  8006cb:	78 14                	js     8006e1 <umain+0x7a>
+        switch (r) {
+  8006cd:	83 f8 69             	cmp    $0x69,%eax
+  8006d0:	74 e9                	je     8006bb <umain+0x54>
+  8006d2:	83 f8 78             	cmp    $0x78,%eax
+  8006d5:	74 e9                	je     8006c0 <umain+0x59>
+  8006d7:	83 f8 64             	cmp    $0x64,%eax
+  8006da:	74 e7                	je     8006c3 <umain+0x5c>
+            usage();
+  8006dc:	41 ff d7             	call   *%r15
+  8006df:	eb e2                	jmp    8006c3 <umain+0x5c>
+        }
+    }
+
+    if (argc > 2)
+  8006e1:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  8006e5:	7f 3f                	jg     800726 <umain+0xbf>
+        usage();
+    if (argc == 2) {
+  8006e7:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  8006eb:	74 47                	je     800734 <umain+0xcd>
+        close(0);
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+            panic("open %s: %i", argv[1], r);
+        assert(r == 0);
+    }
+    if (interactive == '?')
+  8006ed:	41 83 fe 3f          	cmp    $0x3f,%r14d
+  8006f1:	0f 84 d8 00 00 00    	je     8007cf <umain+0x168>
+  8006f7:	45 85 f6             	test   %r14d,%r14d
+  8006fa:	49 bc be 60 80 00 00 	movabs $0x8060be,%r12
+  800701:	00 00 00 
+  800704:	b8 00 00 00 00       	mov    $0x0,%eax
+  800709:	4c 0f 44 e0          	cmove  %rax,%r12
+        interactive = iscons(0);
+
+    while (1) {
+        char *buf;
+
+        buf = readline(interactive ? "$ " : NULL);
+  80070d:	49 be 1c 1c 80 00 00 	movabs $0x801c1c,%r14
+  800714:	00 00 00 
+        if (buf == NULL) {
+            if (debug) cprintf("EXITING\n");
+            exit(); /* end of file */
+  800717:	49 bf 5a 0b 80 00 00 	movabs $0x800b5a,%r15
+  80071e:	00 00 00 
+  800721:	e9 22 01 00 00       	jmp    800848 <umain+0x1e1>
+        usage();
+  800726:	48 b8 3a 06 80 00 00 	movabs $0x80063a,%rax
+  80072d:	00 00 00 
+  800730:	ff d0                	call   *%rax
+  800732:	eb b3                	jmp    8006e7 <umain+0x80>
+        close(0);
+  800734:	bf 00 00 00 00       	mov    $0x0,%edi
+  800739:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  800740:	00 00 00 
+  800743:	ff d0                	call   *%rax
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+  800745:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800749:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80074d:	be 00 00 00 00       	mov    $0x0,%esi
+  800752:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  800759:	00 00 00 
+  80075c:	ff d0                	call   *%rax
+  80075e:	85 c0                	test   %eax,%eax
+  800760:	78 37                	js     800799 <umain+0x132>
+        assert(r == 0);
+  800762:	74 89                	je     8006ed <umain+0x86>
+  800764:	48 b9 a2 60 80 00 00 	movabs $0x8060a2,%rcx
+  80076b:	00 00 00 
+  80076e:	48 ba a9 60 80 00 00 	movabs $0x8060a9,%rdx
+  800775:	00 00 00 
+  800778:	be 14 01 00 00       	mov    $0x114,%esi
+  80077d:	48 bf 7e 60 80 00 00 	movabs $0x80607e,%rdi
+  800784:	00 00 00 
+  800787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078c:	49 b8 7d 0b 80 00 00 	movabs $0x800b7d,%r8
+  800793:	00 00 00 
+  800796:	41 ff d0             	call   *%r8
+            panic("open %s: %i", argv[1], r);
+  800799:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80079d:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  8007a1:	41 89 c0             	mov    %eax,%r8d
+  8007a4:	48 ba 96 60 80 00 00 	movabs $0x806096,%rdx
+  8007ab:	00 00 00 
+  8007ae:	be 13 01 00 00       	mov    $0x113,%esi
+  8007b3:	48 bf 7e 60 80 00 00 	movabs $0x80607e,%rdi
+  8007ba:	00 00 00 
+  8007bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c2:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  8007c9:	00 00 00 
+  8007cc:	41 ff d1             	call   *%r9
+        interactive = iscons(0);
+  8007cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007d4:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  8007db:	00 00 00 
+  8007de:	ff d0                	call   *%rax
+  8007e0:	41 89 c6             	mov    %eax,%r14d
+  8007e3:	e9 0f ff ff ff       	jmp    8006f7 <umain+0x90>
+            exit(); /* end of file */
+  8007e8:	41 ff d7             	call   *%r15
+  8007eb:	eb 69                	jmp    800856 <umain+0x1ef>
+        }
+        if (debug) cprintf("LINE: %s\n", buf);
+        if (buf[0] == '#') continue;
+        if (echocmds) printf("# %s\n", buf);
+  8007ed:	48 89 de             	mov    %rbx,%rsi
+  8007f0:	48 bf c1 60 80 00 00 	movabs $0x8060c1,%rdi
+  8007f7:	00 00 00 
+  8007fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ff:	48 b9 fc 44 80 00 00 	movabs $0x8044fc,%rcx
+  800806:	00 00 00 
+  800809:	ff d1                	call   *%rcx
+  80080b:	eb 53                	jmp    800860 <umain+0x1f9>
+        if (debug) cprintf("BEFORE FORK\n");
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  80080d:	89 c1                	mov    %eax,%ecx
+  80080f:	48 ba 59 60 80 00 00 	movabs $0x806059,%rdx
+  800816:	00 00 00 
+  800819:	be 25 01 00 00       	mov    $0x125,%esi
+  80081e:	48 bf 7e 60 80 00 00 	movabs $0x80607e,%rdi
+  800825:	00 00 00 
+  800828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082d:	49 b8 7d 0b 80 00 00 	movabs $0x800b7d,%r8
+  800834:	00 00 00 
+  800837:	41 ff d0             	call   *%r8
+        if (debug) cprintf("FORK: %d\n", r);
+        if (r == 0) {
+            runcmd(buf);
+            exit();
+        } else
+            wait(r);
+  80083a:	89 c7                	mov    %eax,%edi
+  80083c:	48 b8 e5 52 80 00 00 	movabs $0x8052e5,%rax
+  800843:	00 00 00 
+  800846:	ff d0                	call   *%rax
+        buf = readline(interactive ? "$ " : NULL);
+  800848:	4c 89 e7             	mov    %r12,%rdi
+  80084b:	41 ff d6             	call   *%r14
+  80084e:	48 89 c3             	mov    %rax,%rbx
+        if (buf == NULL) {
+  800851:	48 85 c0             	test   %rax,%rax
+  800854:	74 92                	je     8007e8 <umain+0x181>
+        if (buf[0] == '#') continue;
+  800856:	80 3b 23             	cmpb   $0x23,(%rbx)
+  800859:	74 ed                	je     800848 <umain+0x1e1>
+        if (echocmds) printf("# %s\n", buf);
+  80085b:	45 85 ed             	test   %r13d,%r13d
+  80085e:	75 8d                	jne    8007ed <umain+0x186>
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  800860:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  800867:	00 00 00 
+  80086a:	ff d0                	call   *%rax
+  80086c:	85 c0                	test   %eax,%eax
+  80086e:	78 9d                	js     80080d <umain+0x1a6>
+        if (r == 0) {
+  800870:	75 c8                	jne    80083a <umain+0x1d3>
+            runcmd(buf);
+  800872:	48 89 df             	mov    %rbx,%rdi
+  800875:	48 b8 a4 01 80 00 00 	movabs $0x8001a4,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+            exit();
+  800881:	41 ff d7             	call   *%r15
+  800884:	eb c2                	jmp    800848 <umain+0x1e1>
+
+0000000000800886 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  800886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088b:	c3                   	ret
+
+000000000080088c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80088c:	55                   	push   %rbp
+  80088d:	48 89 e5             	mov    %rsp,%rbp
+  800890:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800893:	48 be 39 61 80 00 00 	movabs $0x806139,%rsi
+  80089a:	00 00 00 
+  80089d:	48 b8 45 16 80 00 00 	movabs $0x801645,%rax
+  8008a4:	00 00 00 
+  8008a7:	ff d0                	call   *%rax
+    return 0;
+}
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ae:	5d                   	pop    %rbp
+  8008af:	c3                   	ret
+
+00000000008008b0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8008b0:	55                   	push   %rbp
+  8008b1:	48 89 e5             	mov    %rsp,%rbp
+  8008b4:	41 57                	push   %r15
+  8008b6:	41 56                	push   %r14
+  8008b8:	41 55                	push   %r13
+  8008ba:	41 54                	push   %r12
+  8008bc:	53                   	push   %rbx
+  8008bd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8008c4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8008cb:	48 85 d2             	test   %rdx,%rdx
+  8008ce:	74 7a                	je     80094a <devcons_write+0x9a>
+  8008d0:	49 89 d6             	mov    %rdx,%r14
+  8008d3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8008d9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8008de:	49 bf d3 19 80 00 00 	movabs $0x8019d3,%r15
+  8008e5:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8008e8:	4c 89 f3             	mov    %r14,%rbx
+  8008eb:	48 29 f3             	sub    %rsi,%rbx
+  8008ee:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8008f3:	48 39 c3             	cmp    %rax,%rbx
+  8008f6:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8008fa:	4c 63 eb             	movslq %ebx,%r13
+  8008fd:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800904:	48 01 c6             	add    %rax,%rsi
+  800907:	4c 89 ea             	mov    %r13,%rdx
+  80090a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800911:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  800914:	4c 89 ee             	mov    %r13,%rsi
+  800917:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80091e:	48 b8 66 1d 80 00 00 	movabs $0x801d66,%rax
+  800925:	00 00 00 
+  800928:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80092a:	41 01 dc             	add    %ebx,%r12d
+  80092d:	49 63 f4             	movslq %r12d,%rsi
+  800930:	4c 39 f6             	cmp    %r14,%rsi
+  800933:	72 b3                	jb     8008e8 <devcons_write+0x38>
+    return res;
+  800935:	49 63 c4             	movslq %r12d,%rax
+}
+  800938:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80093f:	5b                   	pop    %rbx
+  800940:	41 5c                	pop    %r12
+  800942:	41 5d                	pop    %r13
+  800944:	41 5e                	pop    %r14
+  800946:	41 5f                	pop    %r15
+  800948:	5d                   	pop    %rbp
+  800949:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80094a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800950:	eb e3                	jmp    800935 <devcons_write+0x85>
+
+0000000000800952 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800952:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800955:	ba 00 00 00 00       	mov    $0x0,%edx
+  80095a:	48 85 c0             	test   %rax,%rax
+  80095d:	74 55                	je     8009b4 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80095f:	55                   	push   %rbp
+  800960:	48 89 e5             	mov    %rsp,%rbp
+  800963:	41 55                	push   %r13
+  800965:	41 54                	push   %r12
+  800967:	53                   	push   %rbx
+  800968:	48 83 ec 08          	sub    $0x8,%rsp
+  80096c:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80096f:	48 bb 93 1d 80 00 00 	movabs $0x801d93,%rbx
+  800976:	00 00 00 
+  800979:	49 bc 60 1e 80 00 00 	movabs $0x801e60,%r12
+  800980:	00 00 00 
+  800983:	eb 03                	jmp    800988 <devcons_read+0x36>
+  800985:	41 ff d4             	call   *%r12
+  800988:	ff d3                	call   *%rbx
+  80098a:	85 c0                	test   %eax,%eax
+  80098c:	74 f7                	je     800985 <devcons_read+0x33>
+    if (c < 0) return c;
+  80098e:	48 63 d0             	movslq %eax,%rdx
+  800991:	78 13                	js     8009a6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800993:	ba 00 00 00 00       	mov    $0x0,%edx
+  800998:	83 f8 04             	cmp    $0x4,%eax
+  80099b:	74 09                	je     8009a6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80099d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8009a1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8009a6:	48 89 d0             	mov    %rdx,%rax
+  8009a9:	48 83 c4 08          	add    $0x8,%rsp
+  8009ad:	5b                   	pop    %rbx
+  8009ae:	41 5c                	pop    %r12
+  8009b0:	41 5d                	pop    %r13
+  8009b2:	5d                   	pop    %rbp
+  8009b3:	c3                   	ret
+  8009b4:	48 89 d0             	mov    %rdx,%rax
+  8009b7:	c3                   	ret
+
+00000000008009b8 <cputchar>:
+cputchar(int ch) {
+  8009b8:	55                   	push   %rbp
+  8009b9:	48 89 e5             	mov    %rsp,%rbp
+  8009bc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8009c0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8009c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8009c9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8009cd:	48 b8 66 1d 80 00 00 	movabs $0x801d66,%rax
+  8009d4:	00 00 00 
+  8009d7:	ff d0                	call   *%rax
+}
+  8009d9:	c9                   	leave
+  8009da:	c3                   	ret
+
+00000000008009db <getchar>:
+getchar(void) {
+  8009db:	55                   	push   %rbp
+  8009dc:	48 89 e5             	mov    %rsp,%rbp
+  8009df:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8009e3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8009e8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8009ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009f1:	48 b8 fe 2e 80 00 00 	movabs $0x802efe,%rax
+  8009f8:	00 00 00 
+  8009fb:	ff d0                	call   *%rax
+  8009fd:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8009ff:	85 c0                	test   %eax,%eax
+  800a01:	78 06                	js     800a09 <getchar+0x2e>
+  800a03:	74 08                	je     800a0d <getchar+0x32>
+  800a05:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  800a09:	89 d0                	mov    %edx,%eax
+  800a0b:	c9                   	leave
+  800a0c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  800a0d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800a12:	eb f5                	jmp    800a09 <getchar+0x2e>
+
+0000000000800a14 <iscons>:
+iscons(int fdnum) {
+  800a14:	55                   	push   %rbp
+  800a15:	48 89 e5             	mov    %rsp,%rbp
+  800a18:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  800a1c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a20:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  800a27:	00 00 00 
+  800a2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a2c:	85 c0                	test   %eax,%eax
+  800a2e:	78 18                	js     800a48 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800a30:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a34:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800a3b:	00 00 00 
+  800a3e:	8b 00                	mov    (%rax),%eax
+  800a40:	39 02                	cmp    %eax,(%rdx)
+  800a42:	0f 94 c0             	sete   %al
+  800a45:	0f b6 c0             	movzbl %al,%eax
+}
+  800a48:	c9                   	leave
+  800a49:	c3                   	ret
+
+0000000000800a4a <opencons>:
+opencons(void) {
+  800a4a:	55                   	push   %rbp
+  800a4b:	48 89 e5             	mov    %rsp,%rbp
+  800a4e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800a52:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800a56:	48 b8 bb 2b 80 00 00 	movabs $0x802bbb,%rax
+  800a5d:	00 00 00 
+  800a60:	ff d0                	call   *%rax
+  800a62:	85 c0                	test   %eax,%eax
+  800a64:	78 49                	js     800aaf <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800a66:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800a6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a70:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800a74:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a79:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  800a80:	00 00 00 
+  800a83:	ff d0                	call   *%rax
+  800a85:	85 c0                	test   %eax,%eax
+  800a87:	78 26                	js     800aaf <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  800a89:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a8d:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  800a94:	00 00 
+  800a96:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  800a98:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a9c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800aa3:	48 b8 8d 2b 80 00 00 	movabs $0x802b8d,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+}
+  800aaf:	c9                   	leave
+  800ab0:	c3                   	ret
+
+0000000000800ab1 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800ab1:	55                   	push   %rbp
+  800ab2:	48 89 e5             	mov    %rsp,%rbp
+  800ab5:	41 56                	push   %r14
+  800ab7:	41 55                	push   %r13
+  800ab9:	41 54                	push   %r12
+  800abb:	53                   	push   %rbx
+  800abc:	41 89 fd             	mov    %edi,%r13d
+  800abf:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ac2:	48 ba d8 70 80 00 00 	movabs $0x8070d8,%rdx
+  800ac9:	00 00 00 
+  800acc:	48 b8 d8 70 80 00 00 	movabs $0x8070d8,%rax
+  800ad3:	00 00 00 
+  800ad6:	48 39 c2             	cmp    %rax,%rdx
+  800ad9:	73 17                	jae    800af2 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800adb:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ade:	49 89 c4             	mov    %rax,%r12
+  800ae1:	48 83 c3 08          	add    $0x8,%rbx
+  800ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aea:	ff 53 f8             	call   *-0x8(%rbx)
+  800aed:	4c 39 e3             	cmp    %r12,%rbx
+  800af0:	72 ef                	jb     800ae1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800af2:	48 b8 2f 1e 80 00 00 	movabs $0x801e2f,%rax
+  800af9:	00 00 00 
+  800afc:	ff d0                	call   *%rax
+  800afe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800b03:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800b0a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800b11:	00 00 00 
+  800b14:	48 01 d0             	add    %rdx,%rax
+  800b17:	48 a3 18 80 80 00 00 	movabs %rax,0x808018
+  800b1e:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800b21:	45 85 ed             	test   %r13d,%r13d
+  800b24:	7e 0d                	jle    800b33 <libmain+0x82>
+  800b26:	49 8b 06             	mov    (%r14),%rax
+  800b29:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  800b30:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800b33:	4c 89 f6             	mov    %r14,%rsi
+  800b36:	44 89 ef             	mov    %r13d,%edi
+  800b39:	48 b8 67 06 80 00 00 	movabs $0x800667,%rax
+  800b40:	00 00 00 
+  800b43:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800b45:	48 b8 5a 0b 80 00 00 	movabs $0x800b5a,%rax
+  800b4c:	00 00 00 
+  800b4f:	ff d0                	call   *%rax
+#endif
+}
+  800b51:	5b                   	pop    %rbx
+  800b52:	41 5c                	pop    %r12
+  800b54:	41 5d                	pop    %r13
+  800b56:	41 5e                	pop    %r14
+  800b58:	5d                   	pop    %rbp
+  800b59:	c3                   	ret
+
+0000000000800b5a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800b5a:	55                   	push   %rbp
+  800b5b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800b5e:	48 b8 b3 2d 80 00 00 	movabs $0x802db3,%rax
+  800b65:	00 00 00 
+  800b68:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800b6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b6f:	48 b8 c4 1d 80 00 00 	movabs $0x801dc4,%rax
+  800b76:	00 00 00 
+  800b79:	ff d0                	call   *%rax
+}
+  800b7b:	5d                   	pop    %rbp
+  800b7c:	c3                   	ret
+
+0000000000800b7d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800b7d:	55                   	push   %rbp
+  800b7e:	48 89 e5             	mov    %rsp,%rbp
+  800b81:	41 56                	push   %r14
+  800b83:	41 55                	push   %r13
+  800b85:	41 54                	push   %r12
+  800b87:	53                   	push   %rbx
+  800b88:	48 83 ec 50          	sub    $0x50,%rsp
+  800b8c:	49 89 fc             	mov    %rdi,%r12
+  800b8f:	41 89 f5             	mov    %esi,%r13d
+  800b92:	48 89 d3             	mov    %rdx,%rbx
+  800b95:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800b99:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800b9d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ba1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800ba8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bac:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800bb0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800bb4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800bb8:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  800bbf:	00 00 00 
+  800bc2:	4c 8b 30             	mov    (%rax),%r14
+  800bc5:	48 b8 2f 1e 80 00 00 	movabs $0x801e2f,%rax
+  800bcc:	00 00 00 
+  800bcf:	ff d0                	call   *%rax
+  800bd1:	89 c6                	mov    %eax,%esi
+  800bd3:	45 89 e8             	mov    %r13d,%r8d
+  800bd6:	4c 89 e1             	mov    %r12,%rcx
+  800bd9:	4c 89 f2             	mov    %r14,%rdx
+  800bdc:	48 bf 50 61 80 00 00 	movabs $0x806150,%rdi
+  800be3:	00 00 00 
+  800be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800beb:	49 bc cd 0c 80 00 00 	movabs $0x800ccd,%r12
+  800bf2:	00 00 00 
+  800bf5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800bf8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800bfc:	48 89 df             	mov    %rbx,%rdi
+  800bff:	48 b8 69 0c 80 00 00 	movabs $0x800c69,%rax
+  800c06:	00 00 00 
+  800c09:	ff d0                	call   *%rax
+    cprintf("\n");
+  800c0b:	48 bf 03 60 80 00 00 	movabs $0x806003,%rdi
+  800c12:	00 00 00 
+  800c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800c1d:	cc                   	int3
+  800c1e:	eb fd                	jmp    800c1d <_panic+0xa0>
+
+0000000000800c20 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800c20:	55                   	push   %rbp
+  800c21:	48 89 e5             	mov    %rsp,%rbp
+  800c24:	53                   	push   %rbx
+  800c25:	48 83 ec 08          	sub    $0x8,%rsp
+  800c29:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800c2c:	8b 06                	mov    (%rsi),%eax
+  800c2e:	8d 50 01             	lea    0x1(%rax),%edx
+  800c31:	89 16                	mov    %edx,(%rsi)
+  800c33:	48 98                	cltq
+  800c35:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800c3a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800c40:	74 0a                	je     800c4c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800c42:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800c46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c4a:	c9                   	leave
+  800c4b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800c4c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800c50:	be ff 00 00 00       	mov    $0xff,%esi
+  800c55:	48 b8 66 1d 80 00 00 	movabs $0x801d66,%rax
+  800c5c:	00 00 00 
+  800c5f:	ff d0                	call   *%rax
+        state->offset = 0;
+  800c61:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800c67:	eb d9                	jmp    800c42 <putch+0x22>
+
+0000000000800c69 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800c69:	55                   	push   %rbp
+  800c6a:	48 89 e5             	mov    %rsp,%rbp
+  800c6d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800c74:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800c77:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800c7e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c88:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800c8b:	48 89 f1             	mov    %rsi,%rcx
+  800c8e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800c95:	48 bf 20 0c 80 00 00 	movabs $0x800c20,%rdi
+  800c9c:	00 00 00 
+  800c9f:	48 b8 1d 0e 80 00 00 	movabs $0x800e1d,%rax
+  800ca6:	00 00 00 
+  800ca9:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800cab:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800cb2:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800cb9:	48 b8 66 1d 80 00 00 	movabs $0x801d66,%rax
+  800cc0:	00 00 00 
+  800cc3:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800cc5:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800ccb:	c9                   	leave
+  800ccc:	c3                   	ret
+
+0000000000800ccd <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800ccd:	55                   	push   %rbp
+  800cce:	48 89 e5             	mov    %rsp,%rbp
+  800cd1:	48 83 ec 50          	sub    $0x50,%rsp
+  800cd5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800cd9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800cdd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ce1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ce5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800ce9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800cf0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cfc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800d00:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800d04:	48 b8 69 0c 80 00 00 	movabs $0x800c69,%rax
+  800d0b:	00 00 00 
+  800d0e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800d10:	c9                   	leave
+  800d11:	c3                   	ret
+
+0000000000800d12 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800d12:	55                   	push   %rbp
+  800d13:	48 89 e5             	mov    %rsp,%rbp
+  800d16:	41 57                	push   %r15
+  800d18:	41 56                	push   %r14
+  800d1a:	41 55                	push   %r13
+  800d1c:	41 54                	push   %r12
+  800d1e:	53                   	push   %rbx
+  800d1f:	48 83 ec 18          	sub    $0x18,%rsp
+  800d23:	49 89 fc             	mov    %rdi,%r12
+  800d26:	49 89 f5             	mov    %rsi,%r13
+  800d29:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d2d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800d30:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800d33:	41 89 cf             	mov    %ecx,%r15d
+  800d36:	4c 39 fa             	cmp    %r15,%rdx
+  800d39:	73 5b                	jae    800d96 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800d3b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800d3f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800d43:	85 db                	test   %ebx,%ebx
+  800d45:	7e 0e                	jle    800d55 <print_num+0x43>
+            putch(padc, put_arg);
+  800d47:	4c 89 ee             	mov    %r13,%rsi
+  800d4a:	44 89 f7             	mov    %r14d,%edi
+  800d4d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800d50:	83 eb 01             	sub    $0x1,%ebx
+  800d53:	75 f2                	jne    800d47 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800d55:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800d59:	48 b9 84 61 80 00 00 	movabs $0x806184,%rcx
+  800d60:	00 00 00 
+  800d63:	48 b8 73 61 80 00 00 	movabs $0x806173,%rax
+  800d6a:	00 00 00 
+  800d6d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800d71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7a:	49 f7 f7             	div    %r15
+  800d7d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800d81:	4c 89 ee             	mov    %r13,%rsi
+  800d84:	41 ff d4             	call   *%r12
+}
+  800d87:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d8b:	5b                   	pop    %rbx
+  800d8c:	41 5c                	pop    %r12
+  800d8e:	41 5d                	pop    %r13
+  800d90:	41 5e                	pop    %r14
+  800d92:	41 5f                	pop    %r15
+  800d94:	5d                   	pop    %rbp
+  800d95:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800d96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9f:	49 f7 f7             	div    %r15
+  800da2:	48 83 ec 08          	sub    $0x8,%rsp
+  800da6:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800daa:	52                   	push   %rdx
+  800dab:	45 0f be c9          	movsbl %r9b,%r9d
+  800daf:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800db3:	48 89 c2             	mov    %rax,%rdx
+  800db6:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  800dbd:	00 00 00 
+  800dc0:	ff d0                	call   *%rax
+  800dc2:	48 83 c4 10          	add    $0x10,%rsp
+  800dc6:	eb 8d                	jmp    800d55 <print_num+0x43>
+
+0000000000800dc8 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800dc8:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800dcc:	48 8b 06             	mov    (%rsi),%rax
+  800dcf:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800dd3:	73 0a                	jae    800ddf <sprintputch+0x17>
+        *state->start++ = ch;
+  800dd5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800dd9:	48 89 16             	mov    %rdx,(%rsi)
+  800ddc:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800ddf:	c3                   	ret
+
+0000000000800de0 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800de0:	55                   	push   %rbp
+  800de1:	48 89 e5             	mov    %rsp,%rbp
+  800de4:	48 83 ec 50          	sub    $0x50,%rsp
+  800de8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dec:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800df0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800df4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dfb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e03:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e07:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800e0b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e0f:	48 b8 1d 0e 80 00 00 	movabs $0x800e1d,%rax
+  800e16:	00 00 00 
+  800e19:	ff d0                	call   *%rax
+}
+  800e1b:	c9                   	leave
+  800e1c:	c3                   	ret
+
+0000000000800e1d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800e1d:	55                   	push   %rbp
+  800e1e:	48 89 e5             	mov    %rsp,%rbp
+  800e21:	41 57                	push   %r15
+  800e23:	41 56                	push   %r14
+  800e25:	41 55                	push   %r13
+  800e27:	41 54                	push   %r12
+  800e29:	53                   	push   %rbx
+  800e2a:	48 83 ec 38          	sub    $0x38,%rsp
+  800e2e:	49 89 fe             	mov    %rdi,%r14
+  800e31:	49 89 f5             	mov    %rsi,%r13
+  800e34:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800e37:	48 8b 01             	mov    (%rcx),%rax
+  800e3a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800e3e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800e42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e46:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800e4a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800e4e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800e52:	0f b6 3b             	movzbl (%rbx),%edi
+  800e55:	40 80 ff 25          	cmp    $0x25,%dil
+  800e59:	74 18                	je     800e73 <vprintfmt+0x56>
+            if (!ch) return;
+  800e5b:	40 84 ff             	test   %dil,%dil
+  800e5e:	0f 84 04 07 00 00    	je     801568 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800e64:	40 0f b6 ff          	movzbl %dil,%edi
+  800e68:	4c 89 ee             	mov    %r13,%rsi
+  800e6b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800e6e:	4c 89 e3             	mov    %r12,%rbx
+  800e71:	eb db                	jmp    800e4e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800e73:	be 00 00 00 00       	mov    $0x0,%esi
+  800e78:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800e7c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800e81:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800e87:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800e8e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800e92:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800e97:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800e9c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800e9f:	83 e8 23             	sub    $0x23,%eax
+  800ea2:	3c 57                	cmp    $0x57,%al
+  800ea4:	0f 87 a4 06 00 00    	ja     80154e <vprintfmt+0x731>
+  800eaa:	0f b6 c0             	movzbl %al,%eax
+  800ead:	48 b9 20 63 80 00 00 	movabs $0x806320,%rcx
+  800eb4:	00 00 00 
+  800eb7:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800eba:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800ebd:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800ec1:	eb cf                	jmp    800e92 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800ec3:	49 89 dc             	mov    %rbx,%r12
+  800ec6:	be 01 00 00 00       	mov    $0x1,%esi
+  800ecb:	eb c5                	jmp    800e92 <vprintfmt+0x75>
+            padc = ch;
+  800ecd:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800ed1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800ed4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800ed7:	eb b9                	jmp    800e92 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800ed9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800edc:	83 f8 2f             	cmp    $0x2f,%eax
+  800edf:	77 24                	ja     800f05 <vprintfmt+0xe8>
+  800ee1:	89 c1                	mov    %eax,%ecx
+  800ee3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800ee7:	83 c0 08             	add    $0x8,%eax
+  800eea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eed:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800ef0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800ef3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ef7:	79 99                	jns    800e92 <vprintfmt+0x75>
+                width = precision;
+  800ef9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800efd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800f03:	eb 8d                	jmp    800e92 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800f05:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800f09:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800f0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f11:	eb da                	jmp    800eed <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800f13:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800f18:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f1c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800f22:	3c 39                	cmp    $0x39,%al
+  800f24:	77 1c                	ja     800f42 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800f26:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800f2a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800f2e:	0f b6 c0             	movzbl %al,%eax
+  800f31:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f36:	0f b6 03             	movzbl (%rbx),%eax
+  800f39:	3c 39                	cmp    $0x39,%al
+  800f3b:	76 e9                	jbe    800f26 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800f3d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800f40:	eb b1                	jmp    800ef3 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800f42:	49 89 dc             	mov    %rbx,%r12
+  800f45:	eb ac                	jmp    800ef3 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800f47:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800f4a:	85 c9                	test   %ecx,%ecx
+  800f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f51:	0f 49 c1             	cmovns %ecx,%eax
+  800f54:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800f57:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f5a:	e9 33 ff ff ff       	jmp    800e92 <vprintfmt+0x75>
+            lflag++;
+  800f5f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800f62:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f65:	e9 28 ff ff ff       	jmp    800e92 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800f6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800f70:	77 19                	ja     800f8b <vprintfmt+0x16e>
+  800f72:	89 c2                	mov    %eax,%edx
+  800f74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f78:	83 c0 08             	add    $0x8,%eax
+  800f7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f7e:	8b 3a                	mov    (%rdx),%edi
+  800f80:	4c 89 ee             	mov    %r13,%rsi
+  800f83:	41 ff d6             	call   *%r14
+            break;
+  800f86:	e9 c3 fe ff ff       	jmp    800e4e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800f8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f97:	eb e5                	jmp    800f7e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800f99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f9f:	77 5a                	ja     800ffb <vprintfmt+0x1de>
+  800fa1:	89 c2                	mov    %eax,%edx
+  800fa3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fa7:	83 c0 08             	add    $0x8,%eax
+  800faa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800fad:	8b 02                	mov    (%rdx),%eax
+  800faf:	89 c1                	mov    %eax,%ecx
+  800fb1:	f7 d9                	neg    %ecx
+  800fb3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800fb6:	83 f9 13             	cmp    $0x13,%ecx
+  800fb9:	7f 4e                	jg     801009 <vprintfmt+0x1ec>
+  800fbb:	48 63 c1             	movslq %ecx,%rax
+  800fbe:	48 ba e0 65 80 00 00 	movabs $0x8065e0,%rdx
+  800fc5:	00 00 00 
+  800fc8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800fcc:	48 85 c0             	test   %rax,%rax
+  800fcf:	74 38                	je     801009 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800fd1:	48 89 c1             	mov    %rax,%rcx
+  800fd4:	48 ba bb 60 80 00 00 	movabs $0x8060bb,%rdx
+  800fdb:	00 00 00 
+  800fde:	4c 89 ee             	mov    %r13,%rsi
+  800fe1:	4c 89 f7             	mov    %r14,%rdi
+  800fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe9:	49 b8 e0 0d 80 00 00 	movabs $0x800de0,%r8
+  800ff0:	00 00 00 
+  800ff3:	41 ff d0             	call   *%r8
+  800ff6:	e9 53 fe ff ff       	jmp    800e4e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800ffb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801003:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801007:	eb a4                	jmp    800fad <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801009:	48 ba 9c 61 80 00 00 	movabs $0x80619c,%rdx
+  801010:	00 00 00 
+  801013:	4c 89 ee             	mov    %r13,%rsi
+  801016:	4c 89 f7             	mov    %r14,%rdi
+  801019:	b8 00 00 00 00       	mov    $0x0,%eax
+  80101e:	49 b8 e0 0d 80 00 00 	movabs $0x800de0,%r8
+  801025:	00 00 00 
+  801028:	41 ff d0             	call   *%r8
+  80102b:	e9 1e fe ff ff       	jmp    800e4e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801030:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801033:	83 f8 2f             	cmp    $0x2f,%eax
+  801036:	77 36                	ja     80106e <vprintfmt+0x251>
+  801038:	89 c2                	mov    %eax,%edx
+  80103a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80103e:	83 c0 08             	add    $0x8,%eax
+  801041:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801044:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801047:	48 85 f6             	test   %rsi,%rsi
+  80104a:	48 b8 95 61 80 00 00 	movabs $0x806195,%rax
+  801051:	00 00 00 
+  801054:	48 0f 45 c6          	cmovne %rsi,%rax
+  801058:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80105c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801060:	7e 06                	jle    801068 <vprintfmt+0x24b>
+  801062:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801066:	75 14                	jne    80107c <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801068:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80106c:	eb 5b                	jmp    8010c9 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  80106e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801072:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801076:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80107a:	eb c8                	jmp    801044 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80107c:	49 63 f7             	movslq %r15d,%rsi
+  80107f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801083:	48 b8 22 16 80 00 00 	movabs $0x801622,%rax
+  80108a:	00 00 00 
+  80108d:	ff d0                	call   *%rax
+  80108f:	48 89 c2             	mov    %rax,%rdx
+  801092:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801095:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801097:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80109a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	7e c7                	jle    801068 <vprintfmt+0x24b>
+  8010a1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8010a6:	4c 89 ee             	mov    %r13,%rsi
+  8010a9:	44 89 e7             	mov    %r12d,%edi
+  8010ac:	41 ff d6             	call   *%r14
+  8010af:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8010b3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010b6:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8010b9:	75 eb                	jne    8010a6 <vprintfmt+0x289>
+  8010bb:	eb ab                	jmp    801068 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8010bd:	0f b6 f8             	movzbl %al,%edi
+  8010c0:	4c 89 ee             	mov    %r13,%rsi
+  8010c3:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8010c6:	4c 89 e2             	mov    %r12,%rdx
+  8010c9:	45 85 ff             	test   %r15d,%r15d
+  8010cc:	78 06                	js     8010d4 <vprintfmt+0x2b7>
+  8010ce:	41 83 ef 01          	sub    $0x1,%r15d
+  8010d2:	78 23                	js     8010f7 <vprintfmt+0x2da>
+  8010d4:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8010d8:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8010de:	84 c0                	test   %al,%al
+  8010e0:	74 15                	je     8010f7 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8010e2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8010e6:	74 d5                	je     8010bd <vprintfmt+0x2a0>
+  8010e8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8010eb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8010f0:	80 fa 5e             	cmp    $0x5e,%dl
+  8010f3:	77 cb                	ja     8010c0 <vprintfmt+0x2a3>
+  8010f5:	eb c6                	jmp    8010bd <vprintfmt+0x2a0>
+  8010f7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010fa:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8010fd:	01 f0                	add    %esi,%eax
+  8010ff:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  801101:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801105:	85 c0                	test   %eax,%eax
+  801107:	0f 8e 41 fd ff ff    	jle    800e4e <vprintfmt+0x31>
+  80110d:	4c 89 ee             	mov    %r13,%rsi
+  801110:	bf 20 00 00 00       	mov    $0x20,%edi
+  801115:	41 ff d6             	call   *%r14
+  801118:	41 83 ec 01          	sub    $0x1,%r12d
+  80111c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801120:	75 eb                	jne    80110d <vprintfmt+0x2f0>
+  801122:	e9 27 fd ff ff       	jmp    800e4e <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  801127:	40 84 f6             	test   %sil,%sil
+  80112a:	75 26                	jne    801152 <vprintfmt+0x335>
+    switch (lflag) {
+  80112c:	85 d2                	test   %edx,%edx
+  80112e:	74 59                	je     801189 <vprintfmt+0x36c>
+  801130:	83 fa 01             	cmp    $0x1,%edx
+  801133:	74 7b                	je     8011b0 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  801135:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801138:	83 f8 2f             	cmp    $0x2f,%eax
+  80113b:	0f 87 96 00 00 00    	ja     8011d7 <vprintfmt+0x3ba>
+  801141:	89 c2                	mov    %eax,%edx
+  801143:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801147:	83 c0 08             	add    $0x8,%eax
+  80114a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80114d:	4c 8b 22             	mov    (%rdx),%r12
+  801150:	eb 17                	jmp    801169 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  801152:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801155:	83 f8 2f             	cmp    $0x2f,%eax
+  801158:	77 21                	ja     80117b <vprintfmt+0x35e>
+  80115a:	89 c2                	mov    %eax,%edx
+  80115c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801160:	83 c0 08             	add    $0x8,%eax
+  801163:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801166:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801169:	4d 85 e4             	test   %r12,%r12
+  80116c:	78 7a                	js     8011e8 <vprintfmt+0x3cb>
+            num = i;
+  80116e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801171:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801176:	e9 b5 02 00 00       	jmp    801430 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80117b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80117f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801183:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801187:	eb dd                	jmp    801166 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  801189:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80118c:	83 f8 2f             	cmp    $0x2f,%eax
+  80118f:	77 11                	ja     8011a2 <vprintfmt+0x385>
+  801191:	89 c2                	mov    %eax,%edx
+  801193:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801197:	83 c0 08             	add    $0x8,%eax
+  80119a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80119d:	4c 63 22             	movslq (%rdx),%r12
+  8011a0:	eb c7                	jmp    801169 <vprintfmt+0x34c>
+  8011a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011ae:	eb ed                	jmp    80119d <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8011b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8011b6:	77 11                	ja     8011c9 <vprintfmt+0x3ac>
+  8011b8:	89 c2                	mov    %eax,%edx
+  8011ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011be:	83 c0 08             	add    $0x8,%eax
+  8011c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011c4:	4c 8b 22             	mov    (%rdx),%r12
+  8011c7:	eb a0                	jmp    801169 <vprintfmt+0x34c>
+  8011c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011d5:	eb ed                	jmp    8011c4 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8011d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011e3:	e9 65 ff ff ff       	jmp    80114d <vprintfmt+0x330>
+                putch('-', put_arg);
+  8011e8:	4c 89 ee             	mov    %r13,%rsi
+  8011eb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8011f0:	41 ff d6             	call   *%r14
+                i = -i;
+  8011f3:	49 f7 dc             	neg    %r12
+  8011f6:	e9 73 ff ff ff       	jmp    80116e <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8011fb:	40 84 f6             	test   %sil,%sil
+  8011fe:	75 32                	jne    801232 <vprintfmt+0x415>
+    switch (lflag) {
+  801200:	85 d2                	test   %edx,%edx
+  801202:	74 5d                	je     801261 <vprintfmt+0x444>
+  801204:	83 fa 01             	cmp    $0x1,%edx
+  801207:	0f 84 82 00 00 00    	je     80128f <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  80120d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801210:	83 f8 2f             	cmp    $0x2f,%eax
+  801213:	0f 87 a5 00 00 00    	ja     8012be <vprintfmt+0x4a1>
+  801219:	89 c2                	mov    %eax,%edx
+  80121b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80121f:	83 c0 08             	add    $0x8,%eax
+  801222:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801225:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801228:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80122d:	e9 fe 01 00 00       	jmp    801430 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  801232:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801235:	83 f8 2f             	cmp    $0x2f,%eax
+  801238:	77 19                	ja     801253 <vprintfmt+0x436>
+  80123a:	89 c2                	mov    %eax,%edx
+  80123c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801240:	83 c0 08             	add    $0x8,%eax
+  801243:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801246:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801249:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80124e:	e9 dd 01 00 00       	jmp    801430 <vprintfmt+0x613>
+  801253:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801257:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80125b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80125f:	eb e5                	jmp    801246 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  801261:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801264:	83 f8 2f             	cmp    $0x2f,%eax
+  801267:	77 18                	ja     801281 <vprintfmt+0x464>
+  801269:	89 c2                	mov    %eax,%edx
+  80126b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80126f:	83 c0 08             	add    $0x8,%eax
+  801272:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801275:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801277:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80127c:	e9 af 01 00 00       	jmp    801430 <vprintfmt+0x613>
+  801281:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801285:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801289:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80128d:	eb e6                	jmp    801275 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80128f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801292:	83 f8 2f             	cmp    $0x2f,%eax
+  801295:	77 19                	ja     8012b0 <vprintfmt+0x493>
+  801297:	89 c2                	mov    %eax,%edx
+  801299:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80129d:	83 c0 08             	add    $0x8,%eax
+  8012a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012a3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8012a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8012ab:	e9 80 01 00 00       	jmp    801430 <vprintfmt+0x613>
+  8012b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012bc:	eb e5                	jmp    8012a3 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8012be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012ca:	e9 56 ff ff ff       	jmp    801225 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8012cf:	40 84 f6             	test   %sil,%sil
+  8012d2:	75 2e                	jne    801302 <vprintfmt+0x4e5>
+    switch (lflag) {
+  8012d4:	85 d2                	test   %edx,%edx
+  8012d6:	0f 84 b3 00 00 00    	je     80138f <vprintfmt+0x572>
+  8012dc:	83 fa 01             	cmp    $0x1,%edx
+  8012df:	0f 84 d3 00 00 00    	je     8013b8 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8012e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8012eb:	0f 87 f1 00 00 00    	ja     8013e2 <vprintfmt+0x5c5>
+  8012f1:	89 c2                	mov    %eax,%edx
+  8012f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012f7:	83 c0 08             	add    $0x8,%eax
+  8012fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012fd:	48 8b 02             	mov    (%rdx),%rax
+  801300:	eb 17                	jmp    801319 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  801302:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801305:	83 f8 2f             	cmp    $0x2f,%eax
+  801308:	77 77                	ja     801381 <vprintfmt+0x564>
+  80130a:	89 c2                	mov    %eax,%edx
+  80130c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801310:	83 c0 08             	add    $0x8,%eax
+  801313:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801316:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  801319:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80131b:	83 f8 07             	cmp    $0x7,%eax
+  80131e:	0f 8e cf 00 00 00    	jle    8013f3 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  801324:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80132a:	44 89 e7             	mov    %r12d,%edi
+  80132d:	41 c1 e4 03          	shl    $0x3,%r12d
+  801331:	89 d1                	mov    %edx,%ecx
+  801333:	8d 72 07             	lea    0x7(%rdx),%esi
+  801336:	85 d2                	test   %edx,%edx
+  801338:	0f 48 d6             	cmovs  %esi,%edx
+  80133b:	c1 fa 03             	sar    $0x3,%edx
+  80133e:	83 f9 3f             	cmp    $0x3f,%ecx
+  801341:	7f e7                	jg     80132a <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  801343:	85 ff                	test   %edi,%edi
+  801345:	0f 84 03 fb ff ff    	je     800e4e <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  80134b:	49 63 f4             	movslq %r12d,%rsi
+  80134e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801353:	48 f7 f6             	div    %rsi
+  801356:	49 89 d7             	mov    %rdx,%r15
+  801359:	83 c0 30             	add    $0x30,%eax
+  80135c:	0f be f8             	movsbl %al,%edi
+  80135f:	4c 89 ee             	mov    %r13,%rsi
+  801362:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  801365:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  801368:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  80136d:	45 85 e4             	test   %r12d,%r12d
+  801370:	41 0f 49 d4          	cmovns %r12d,%edx
+  801374:	c1 fa 03             	sar    $0x3,%edx
+  801377:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  80137a:	75 cf                	jne    80134b <vprintfmt+0x52e>
+  80137c:	e9 cd fa ff ff       	jmp    800e4e <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  801381:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801385:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801389:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80138d:	eb 87                	jmp    801316 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80138f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801392:	83 f8 2f             	cmp    $0x2f,%eax
+  801395:	77 13                	ja     8013aa <vprintfmt+0x58d>
+  801397:	89 c2                	mov    %eax,%edx
+  801399:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80139d:	83 c0 08             	add    $0x8,%eax
+  8013a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013a3:	8b 02                	mov    (%rdx),%eax
+  8013a5:	e9 6f ff ff ff       	jmp    801319 <vprintfmt+0x4fc>
+  8013aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013b6:	eb eb                	jmp    8013a3 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8013b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8013be:	77 14                	ja     8013d4 <vprintfmt+0x5b7>
+  8013c0:	89 c2                	mov    %eax,%edx
+  8013c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013c6:	83 c0 08             	add    $0x8,%eax
+  8013c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013cc:	48 8b 02             	mov    (%rdx),%rax
+  8013cf:	e9 45 ff ff ff       	jmp    801319 <vprintfmt+0x4fc>
+  8013d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013e0:	eb ea                	jmp    8013cc <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8013e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013ee:	e9 0a ff ff ff       	jmp    8012fd <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8013f3:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8013f9:	e9 4d ff ff ff       	jmp    80134b <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8013fe:	4c 89 ee             	mov    %r13,%rsi
+  801401:	bf 30 00 00 00       	mov    $0x30,%edi
+  801406:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801409:	4c 89 ee             	mov    %r13,%rsi
+  80140c:	bf 78 00 00 00       	mov    $0x78,%edi
+  801411:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801414:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801417:	83 f8 2f             	cmp    $0x2f,%eax
+  80141a:	77 47                	ja     801463 <vprintfmt+0x646>
+  80141c:	89 c2                	mov    %eax,%edx
+  80141e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801422:	83 c0 08             	add    $0x8,%eax
+  801425:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801428:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80142b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801430:	48 83 ec 08          	sub    $0x8,%rsp
+  801434:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801438:	0f 94 c0             	sete   %al
+  80143b:	0f b6 c0             	movzbl %al,%eax
+  80143e:	50                   	push   %rax
+  80143f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801444:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801448:	4c 89 ee             	mov    %r13,%rsi
+  80144b:	4c 89 f7             	mov    %r14,%rdi
+  80144e:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  801455:	00 00 00 
+  801458:	ff d0                	call   *%rax
+            break;
+  80145a:	48 83 c4 10          	add    $0x10,%rsp
+  80145e:	e9 eb f9 ff ff       	jmp    800e4e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801463:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801467:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80146b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80146f:	eb b7                	jmp    801428 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  801471:	40 84 f6             	test   %sil,%sil
+  801474:	75 2b                	jne    8014a1 <vprintfmt+0x684>
+    switch (lflag) {
+  801476:	85 d2                	test   %edx,%edx
+  801478:	74 56                	je     8014d0 <vprintfmt+0x6b3>
+  80147a:	83 fa 01             	cmp    $0x1,%edx
+  80147d:	74 7f                	je     8014fe <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  80147f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801482:	83 f8 2f             	cmp    $0x2f,%eax
+  801485:	0f 87 a2 00 00 00    	ja     80152d <vprintfmt+0x710>
+  80148b:	89 c2                	mov    %eax,%edx
+  80148d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801491:	83 c0 08             	add    $0x8,%eax
+  801494:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801497:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80149a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80149f:	eb 8f                	jmp    801430 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8014a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8014a7:	77 19                	ja     8014c2 <vprintfmt+0x6a5>
+  8014a9:	89 c2                	mov    %eax,%edx
+  8014ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014af:	83 c0 08             	add    $0x8,%eax
+  8014b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014b5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8014b8:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8014bd:	e9 6e ff ff ff       	jmp    801430 <vprintfmt+0x613>
+  8014c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014ce:	eb e5                	jmp    8014b5 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8014d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8014d6:	77 18                	ja     8014f0 <vprintfmt+0x6d3>
+  8014d8:	89 c2                	mov    %eax,%edx
+  8014da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014de:	83 c0 08             	add    $0x8,%eax
+  8014e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014e4:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8014e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8014eb:	e9 40 ff ff ff       	jmp    801430 <vprintfmt+0x613>
+  8014f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014fc:	eb e6                	jmp    8014e4 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8014fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801501:	83 f8 2f             	cmp    $0x2f,%eax
+  801504:	77 19                	ja     80151f <vprintfmt+0x702>
+  801506:	89 c2                	mov    %eax,%edx
+  801508:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80150c:	83 c0 08             	add    $0x8,%eax
+  80150f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801512:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801515:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80151a:	e9 11 ff ff ff       	jmp    801430 <vprintfmt+0x613>
+  80151f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801523:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801527:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80152b:	eb e5                	jmp    801512 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  80152d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801531:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801535:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801539:	e9 59 ff ff ff       	jmp    801497 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  80153e:	4c 89 ee             	mov    %r13,%rsi
+  801541:	bf 25 00 00 00       	mov    $0x25,%edi
+  801546:	41 ff d6             	call   *%r14
+            break;
+  801549:	e9 00 f9 ff ff       	jmp    800e4e <vprintfmt+0x31>
+            putch('%', put_arg);
+  80154e:	4c 89 ee             	mov    %r13,%rsi
+  801551:	bf 25 00 00 00       	mov    $0x25,%edi
+  801556:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801559:	48 83 eb 01          	sub    $0x1,%rbx
+  80155d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801561:	75 f6                	jne    801559 <vprintfmt+0x73c>
+  801563:	e9 e6 f8 ff ff       	jmp    800e4e <vprintfmt+0x31>
+}
+  801568:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80156c:	5b                   	pop    %rbx
+  80156d:	41 5c                	pop    %r12
+  80156f:	41 5d                	pop    %r13
+  801571:	41 5e                	pop    %r14
+  801573:	41 5f                	pop    %r15
+  801575:	5d                   	pop    %rbp
+  801576:	c3                   	ret
+
+0000000000801577 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801577:	55                   	push   %rbp
+  801578:	48 89 e5             	mov    %rsp,%rbp
+  80157b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80157f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801583:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801588:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80158c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801593:	48 85 ff             	test   %rdi,%rdi
+  801596:	74 2b                	je     8015c3 <vsnprintf+0x4c>
+  801598:	48 85 f6             	test   %rsi,%rsi
+  80159b:	74 26                	je     8015c3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80159d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8015a1:	48 bf c8 0d 80 00 00 	movabs $0x800dc8,%rdi
+  8015a8:	00 00 00 
+  8015ab:	48 b8 1d 0e 80 00 00 	movabs $0x800e1d,%rax
+  8015b2:	00 00 00 
+  8015b5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8015b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015bb:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8015be:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8015c1:	c9                   	leave
+  8015c2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8015c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c8:	eb f7                	jmp    8015c1 <vsnprintf+0x4a>
+
+00000000008015ca <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8015ca:	55                   	push   %rbp
+  8015cb:	48 89 e5             	mov    %rsp,%rbp
+  8015ce:	48 83 ec 50          	sub    $0x50,%rsp
+  8015d2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8015d6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8015da:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8015de:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8015e5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8015e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015ed:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8015f1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8015f5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8015f9:	48 b8 77 15 80 00 00 	movabs $0x801577,%rax
+  801600:	00 00 00 
+  801603:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801605:	c9                   	leave
+  801606:	c3                   	ret
+
+0000000000801607 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801607:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80160a:	74 10                	je     80161c <strlen+0x15>
+    size_t n = 0;
+  80160c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801611:	48 83 c0 01          	add    $0x1,%rax
+  801615:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801619:	75 f6                	jne    801611 <strlen+0xa>
+  80161b:	c3                   	ret
+    size_t n = 0;
+  80161c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801621:	c3                   	ret
+
+0000000000801622 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801622:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801625:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80162a:	48 85 f6             	test   %rsi,%rsi
+  80162d:	74 11                	je     801640 <strnlen+0x1e>
+  80162f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801633:	74 0c                	je     801641 <strnlen+0x1f>
+  801635:	48 83 c2 01          	add    $0x1,%rdx
+  801639:	48 39 d0             	cmp    %rdx,%rax
+  80163c:	75 f1                	jne    80162f <strnlen+0xd>
+  80163e:	eb 04                	jmp    801644 <strnlen+0x22>
+  801640:	c3                   	ret
+  801641:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801644:	c3                   	ret
+
+0000000000801645 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801645:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801648:	ba 00 00 00 00       	mov    $0x0,%edx
+  80164d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801651:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801654:	48 83 c2 01          	add    $0x1,%rdx
+  801658:	84 c9                	test   %cl,%cl
+  80165a:	75 f1                	jne    80164d <strcpy+0x8>
+        ;
+    return res;
+}
+  80165c:	c3                   	ret
+
+000000000080165d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80165d:	55                   	push   %rbp
+  80165e:	48 89 e5             	mov    %rsp,%rbp
+  801661:	41 54                	push   %r12
+  801663:	53                   	push   %rbx
+  801664:	48 89 fb             	mov    %rdi,%rbx
+  801667:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80166a:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  801671:	00 00 00 
+  801674:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801676:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80167a:	4c 89 e6             	mov    %r12,%rsi
+  80167d:	48 b8 45 16 80 00 00 	movabs $0x801645,%rax
+  801684:	00 00 00 
+  801687:	ff d0                	call   *%rax
+    return dst;
+}
+  801689:	48 89 d8             	mov    %rbx,%rax
+  80168c:	5b                   	pop    %rbx
+  80168d:	41 5c                	pop    %r12
+  80168f:	5d                   	pop    %rbp
+  801690:	c3                   	ret
+
+0000000000801691 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801691:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801694:	48 85 d2             	test   %rdx,%rdx
+  801697:	74 1f                	je     8016b8 <strncpy+0x27>
+  801699:	48 01 fa             	add    %rdi,%rdx
+  80169c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80169f:	48 83 c1 01          	add    $0x1,%rcx
+  8016a3:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8016a7:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8016ab:	41 80 f8 01          	cmp    $0x1,%r8b
+  8016af:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8016b3:	48 39 ca             	cmp    %rcx,%rdx
+  8016b6:	75 e7                	jne    80169f <strncpy+0xe>
+    }
+    return ret;
+}
+  8016b8:	c3                   	ret
+
+00000000008016b9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8016b9:	48 89 f8             	mov    %rdi,%rax
+  8016bc:	48 85 d2             	test   %rdx,%rdx
+  8016bf:	74 24                	je     8016e5 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8016c1:	48 83 ea 01          	sub    $0x1,%rdx
+  8016c5:	74 1b                	je     8016e2 <strlcpy+0x29>
+  8016c7:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8016cb:	0f b6 16             	movzbl (%rsi),%edx
+  8016ce:	84 d2                	test   %dl,%dl
+  8016d0:	74 10                	je     8016e2 <strlcpy+0x29>
+            *dst++ = *src++;
+  8016d2:	48 83 c6 01          	add    $0x1,%rsi
+  8016d6:	48 83 c0 01          	add    $0x1,%rax
+  8016da:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8016dd:	48 39 c8             	cmp    %rcx,%rax
+  8016e0:	75 e9                	jne    8016cb <strlcpy+0x12>
+        *dst = '\0';
+  8016e2:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8016e5:	48 29 f8             	sub    %rdi,%rax
+}
+  8016e8:	c3                   	ret
+
+00000000008016e9 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8016e9:	0f b6 07             	movzbl (%rdi),%eax
+  8016ec:	84 c0                	test   %al,%al
+  8016ee:	74 13                	je     801703 <strcmp+0x1a>
+  8016f0:	38 06                	cmp    %al,(%rsi)
+  8016f2:	75 0f                	jne    801703 <strcmp+0x1a>
+  8016f4:	48 83 c7 01          	add    $0x1,%rdi
+  8016f8:	48 83 c6 01          	add    $0x1,%rsi
+  8016fc:	0f b6 07             	movzbl (%rdi),%eax
+  8016ff:	84 c0                	test   %al,%al
+  801701:	75 ed                	jne    8016f0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801703:	0f b6 c0             	movzbl %al,%eax
+  801706:	0f b6 16             	movzbl (%rsi),%edx
+  801709:	29 d0                	sub    %edx,%eax
+}
+  80170b:	c3                   	ret
+
+000000000080170c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80170c:	48 85 d2             	test   %rdx,%rdx
+  80170f:	74 1f                	je     801730 <strncmp+0x24>
+  801711:	0f b6 07             	movzbl (%rdi),%eax
+  801714:	84 c0                	test   %al,%al
+  801716:	74 1e                	je     801736 <strncmp+0x2a>
+  801718:	3a 06                	cmp    (%rsi),%al
+  80171a:	75 1a                	jne    801736 <strncmp+0x2a>
+  80171c:	48 83 c7 01          	add    $0x1,%rdi
+  801720:	48 83 c6 01          	add    $0x1,%rsi
+  801724:	48 83 ea 01          	sub    $0x1,%rdx
+  801728:	75 e7                	jne    801711 <strncmp+0x5>
+
+    if (!n) return 0;
+  80172a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172f:	c3                   	ret
+  801730:	b8 00 00 00 00       	mov    $0x0,%eax
+  801735:	c3                   	ret
+  801736:	48 85 d2             	test   %rdx,%rdx
+  801739:	74 09                	je     801744 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80173b:	0f b6 07             	movzbl (%rdi),%eax
+  80173e:	0f b6 16             	movzbl (%rsi),%edx
+  801741:	29 d0                	sub    %edx,%eax
+  801743:	c3                   	ret
+    if (!n) return 0;
+  801744:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801749:	c3                   	ret
+
+000000000080174a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80174a:	0f b6 17             	movzbl (%rdi),%edx
+  80174d:	84 d2                	test   %dl,%dl
+  80174f:	74 18                	je     801769 <strchr+0x1f>
+        if (*str == c) {
+  801751:	0f be d2             	movsbl %dl,%edx
+  801754:	39 f2                	cmp    %esi,%edx
+  801756:	74 17                	je     80176f <strchr+0x25>
+    for (; *str; str++) {
+  801758:	48 83 c7 01          	add    $0x1,%rdi
+  80175c:	0f b6 17             	movzbl (%rdi),%edx
+  80175f:	84 d2                	test   %dl,%dl
+  801761:	75 ee                	jne    801751 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801763:	b8 00 00 00 00       	mov    $0x0,%eax
+  801768:	c3                   	ret
+  801769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176e:	c3                   	ret
+  80176f:	48 89 f8             	mov    %rdi,%rax
+}
+  801772:	c3                   	ret
+
+0000000000801773 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801773:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801776:	0f b6 17             	movzbl (%rdi),%edx
+  801779:	84 d2                	test   %dl,%dl
+  80177b:	74 13                	je     801790 <strfind+0x1d>
+  80177d:	0f be d2             	movsbl %dl,%edx
+  801780:	39 f2                	cmp    %esi,%edx
+  801782:	74 0b                	je     80178f <strfind+0x1c>
+  801784:	48 83 c0 01          	add    $0x1,%rax
+  801788:	0f b6 10             	movzbl (%rax),%edx
+  80178b:	84 d2                	test   %dl,%dl
+  80178d:	75 ee                	jne    80177d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80178f:	c3                   	ret
+  801790:	c3                   	ret
+
+0000000000801791 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  801791:	55                   	push   %rbp
+  801792:	48 89 e5             	mov    %rsp,%rbp
+  801795:	41 57                	push   %r15
+  801797:	41 56                	push   %r14
+  801799:	41 55                	push   %r13
+  80179b:	41 54                	push   %r12
+  80179d:	53                   	push   %rbx
+  80179e:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a2:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  8017a5:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  8017a9:	45 84 ed             	test   %r13b,%r13b
+  8017ac:	75 12                	jne    8017c0 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  8017ae:	4c 89 f8             	mov    %r15,%rax
+  8017b1:	48 83 c4 08          	add    $0x8,%rsp
+  8017b5:	5b                   	pop    %rbx
+  8017b6:	41 5c                	pop    %r12
+  8017b8:	41 5d                	pop    %r13
+  8017ba:	41 5e                	pop    %r14
+  8017bc:	41 5f                	pop    %r15
+  8017be:	5d                   	pop    %rbp
+  8017bf:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  8017c0:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  8017c4:	4c 89 e7             	mov    %r12,%rdi
+  8017c7:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  8017ce:	00 00 00 
+  8017d1:	ff d0                	call   *%rax
+  8017d3:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  8017d6:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  8017da:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  8017de:	49 bf 0c 17 80 00 00 	movabs $0x80170c,%r15
+  8017e5:	00 00 00 
+				if ((sc = *s++) == 0)
+  8017e8:	84 c0                	test   %al,%al
+  8017ea:	75 14                	jne    801800 <strstr+0x6f>
+					return NULL;
+  8017ec:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8017f2:	eb ba                	jmp    8017ae <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  8017f4:	48 83 c3 01          	add    $0x1,%rbx
+  8017f8:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8017fc:	84 c0                	test   %al,%al
+  8017fe:	74 1b                	je     80181b <strstr+0x8a>
+			} while (sc != c);
+  801800:	41 38 c5             	cmp    %al,%r13b
+  801803:	75 ef                	jne    8017f4 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  801805:	4c 89 f2             	mov    %r14,%rdx
+  801808:	4c 89 e6             	mov    %r12,%rsi
+  80180b:	48 89 df             	mov    %rbx,%rdi
+  80180e:	41 ff d7             	call   *%r15
+  801811:	85 c0                	test   %eax,%eax
+  801813:	75 df                	jne    8017f4 <strstr+0x63>
+  801815:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  801819:	eb 93                	jmp    8017ae <strstr+0x1d>
+					return NULL;
+  80181b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801821:	eb 8b                	jmp    8017ae <strstr+0x1d>
+
+0000000000801823 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  801823:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  801825:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  801828:	8d 57 20             	lea    0x20(%rdi),%edx
+  80182b:	83 f9 1a             	cmp    $0x1a,%ecx
+  80182e:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801831:	c3                   	ret
+
+0000000000801832 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  801832:	55                   	push   %rbp
+  801833:	48 89 e5             	mov    %rsp,%rbp
+  801836:	41 57                	push   %r15
+  801838:	41 56                	push   %r14
+  80183a:	41 55                	push   %r13
+  80183c:	41 54                	push   %r12
+  80183e:	53                   	push   %rbx
+  80183f:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  801843:	48 39 f7             	cmp    %rsi,%rdi
+  801846:	74 49                	je     801891 <strcasecmp+0x5f>
+  801848:	49 89 fd             	mov    %rdi,%r13
+  80184b:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  80184e:	49 bf 23 18 80 00 00 	movabs $0x801823,%r15
+  801855:	00 00 00 
+  801858:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  80185d:	41 0f b6 fe          	movzbl %r14b,%edi
+  801861:	41 ff d7             	call   *%r15
+  801864:	89 c3                	mov    %eax,%ebx
+  801866:	49 83 c4 01          	add    $0x1,%r12
+  80186a:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801870:	41 ff d7             	call   *%r15
+  801873:	29 c3                	sub    %eax,%ebx
+  801875:	75 09                	jne    801880 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  801877:	49 83 c5 01          	add    $0x1,%r13
+  80187b:	45 84 f6             	test   %r14b,%r14b
+  80187e:	75 d8                	jne    801858 <strcasecmp+0x26>
+}
+  801880:	89 d8                	mov    %ebx,%eax
+  801882:	48 83 c4 08          	add    $0x8,%rsp
+  801886:	5b                   	pop    %rbx
+  801887:	41 5c                	pop    %r12
+  801889:	41 5d                	pop    %r13
+  80188b:	41 5e                	pop    %r14
+  80188d:	41 5f                	pop    %r15
+  80188f:	5d                   	pop    %rbp
+  801890:	c3                   	ret
+        return 0;
+  801891:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801896:	eb e8                	jmp    801880 <strcasecmp+0x4e>
+
+0000000000801898 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  801898:	55                   	push   %rbp
+  801899:	48 89 e5             	mov    %rsp,%rbp
+  80189c:	41 57                	push   %r15
+  80189e:	41 56                	push   %r14
+  8018a0:	41 55                	push   %r13
+  8018a2:	41 54                	push   %r12
+  8018a4:	53                   	push   %rbx
+  8018a5:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  8018a9:	48 85 d2             	test   %rdx,%rdx
+  8018ac:	74 4f                	je     8018fd <strncasecmp+0x65>
+  8018ae:	49 89 fc             	mov    %rdi,%r12
+  8018b1:	49 89 f5             	mov    %rsi,%r13
+  8018b4:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  8018b8:	49 be 23 18 80 00 00 	movabs $0x801823,%r14
+  8018bf:	00 00 00 
+  8018c2:	49 83 c4 01          	add    $0x1,%r12
+  8018c6:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8018cc:	41 ff d6             	call   *%r14
+  8018cf:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  8018d1:	49 83 c5 01          	add    $0x1,%r13
+  8018d5:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  8018da:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  8018dd:	29 c3                	sub    %eax,%ebx
+  8018df:	85 c0                	test   %eax,%eax
+  8018e1:	74 09                	je     8018ec <strncasecmp+0x54>
+  8018e3:	85 db                	test   %ebx,%ebx
+  8018e5:	75 05                	jne    8018ec <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8018e7:	4d 39 fc             	cmp    %r15,%r12
+  8018ea:	75 d6                	jne    8018c2 <strncasecmp+0x2a>
+}
+  8018ec:	89 d8                	mov    %ebx,%eax
+  8018ee:	48 83 c4 08          	add    $0x8,%rsp
+  8018f2:	5b                   	pop    %rbx
+  8018f3:	41 5c                	pop    %r12
+  8018f5:	41 5d                	pop    %r13
+  8018f7:	41 5e                	pop    %r14
+  8018f9:	41 5f                	pop    %r15
+  8018fb:	5d                   	pop    %rbp
+  8018fc:	c3                   	ret
+    int d = 0;
+  8018fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  801902:	eb e8                	jmp    8018ec <strncasecmp+0x54>
+
+0000000000801904 <toupper>:
+
+int toupper(int c) {
+  801904:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  801906:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801909:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80190c:	83 f9 1a             	cmp    $0x1a,%ecx
+  80190f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801912:	c3                   	ret
+
+0000000000801913 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  801913:	83 ff 20             	cmp    $0x20,%edi
+  801916:	0f 94 c0             	sete   %al
+  801919:	0f b6 c0             	movzbl %al,%eax
+}
+  80191c:	c3                   	ret
+
+000000000080191d <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  80191d:	89 f8                	mov    %edi,%eax
+  80191f:	f7 d8                	neg    %eax
+  801921:	0f 48 c7             	cmovs  %edi,%eax
+}
+  801924:	c3                   	ret
+
+0000000000801925 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801925:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801928:	48 89 f8             	mov    %rdi,%rax
+  80192b:	48 f7 d8             	neg    %rax
+  80192e:	83 e0 07             	and    $0x7,%eax
+  801931:	49 89 d1             	mov    %rdx,%r9
+  801934:	49 29 c1             	sub    %rax,%r9
+  801937:	78 36                	js     80196f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801939:	40 0f b6 c6          	movzbl %sil,%eax
+  80193d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801944:	01 01 01 
+  801947:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80194b:	40 f6 c7 07          	test   $0x7,%dil
+  80194f:	75 38                	jne    801989 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801951:	4c 89 c9             	mov    %r9,%rcx
+  801954:	48 c1 f9 03          	sar    $0x3,%rcx
+  801958:	74 0c                	je     801966 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80195a:	fc                   	cld
+  80195b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80195e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801962:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801966:	4d 85 c9             	test   %r9,%r9
+  801969:	75 45                	jne    8019b0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80196b:	4c 89 c0             	mov    %r8,%rax
+  80196e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80196f:	48 85 d2             	test   %rdx,%rdx
+  801972:	74 f7                	je     80196b <memset+0x46>
+  801974:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801977:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80197a:	48 83 c0 01          	add    $0x1,%rax
+  80197e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801982:	48 39 c2             	cmp    %rax,%rdx
+  801985:	75 f3                	jne    80197a <memset+0x55>
+  801987:	eb e2                	jmp    80196b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801989:	40 f6 c7 01          	test   $0x1,%dil
+  80198d:	74 06                	je     801995 <memset+0x70>
+  80198f:	88 07                	mov    %al,(%rdi)
+  801991:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801995:	40 f6 c7 02          	test   $0x2,%dil
+  801999:	74 07                	je     8019a2 <memset+0x7d>
+  80199b:	66 89 07             	mov    %ax,(%rdi)
+  80199e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019a2:	40 f6 c7 04          	test   $0x4,%dil
+  8019a6:	74 a9                	je     801951 <memset+0x2c>
+  8019a8:	89 07                	mov    %eax,(%rdi)
+  8019aa:	48 83 c7 04          	add    $0x4,%rdi
+  8019ae:	eb a1                	jmp    801951 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019b0:	41 f6 c1 04          	test   $0x4,%r9b
+  8019b4:	74 06                	je     8019bc <memset+0x97>
+  8019b6:	89 07                	mov    %eax,(%rdi)
+  8019b8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8019bc:	41 f6 c1 02          	test   $0x2,%r9b
+  8019c0:	74 07                	je     8019c9 <memset+0xa4>
+  8019c2:	66 89 07             	mov    %ax,(%rdi)
+  8019c5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8019c9:	41 f6 c1 01          	test   $0x1,%r9b
+  8019cd:	74 9c                	je     80196b <memset+0x46>
+  8019cf:	88 07                	mov    %al,(%rdi)
+  8019d1:	eb 98                	jmp    80196b <memset+0x46>
+
+00000000008019d3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8019d3:	48 89 f8             	mov    %rdi,%rax
+  8019d6:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8019d9:	48 39 fe             	cmp    %rdi,%rsi
+  8019dc:	73 3b                	jae    801a19 <memmove+0x46>
+  8019de:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8019e2:	48 39 d7             	cmp    %rdx,%rdi
+  8019e5:	73 32                	jae    801a19 <memmove+0x46>
+        s += n;
+        d += n;
+  8019e7:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8019eb:	48 89 d6             	mov    %rdx,%rsi
+  8019ee:	48 09 fe             	or     %rdi,%rsi
+  8019f1:	48 09 ce             	or     %rcx,%rsi
+  8019f4:	40 f6 c6 07          	test   $0x7,%sil
+  8019f8:	75 12                	jne    801a0c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8019fa:	48 83 ef 08          	sub    $0x8,%rdi
+  8019fe:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801a02:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a06:	fd                   	std
+  801a07:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801a0a:	fc                   	cld
+  801a0b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801a0c:	48 83 ef 01          	sub    $0x1,%rdi
+  801a10:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801a14:	fd                   	std
+  801a15:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801a17:	eb f1                	jmp    801a0a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a19:	48 89 f2             	mov    %rsi,%rdx
+  801a1c:	48 09 c2             	or     %rax,%rdx
+  801a1f:	48 09 ca             	or     %rcx,%rdx
+  801a22:	f6 c2 07             	test   $0x7,%dl
+  801a25:	75 0c                	jne    801a33 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801a27:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a2b:	48 89 c7             	mov    %rax,%rdi
+  801a2e:	fc                   	cld
+  801a2f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a32:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801a33:	48 89 c7             	mov    %rax,%rdi
+  801a36:	fc                   	cld
+  801a37:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801a39:	c3                   	ret
+
+0000000000801a3a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801a3a:	55                   	push   %rbp
+  801a3b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801a3e:	48 b8 d3 19 80 00 00 	movabs $0x8019d3,%rax
+  801a45:	00 00 00 
+  801a48:	ff d0                	call   *%rax
+}
+  801a4a:	5d                   	pop    %rbp
+  801a4b:	c3                   	ret
+
+0000000000801a4c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801a4c:	55                   	push   %rbp
+  801a4d:	48 89 e5             	mov    %rsp,%rbp
+  801a50:	41 57                	push   %r15
+  801a52:	41 56                	push   %r14
+  801a54:	41 55                	push   %r13
+  801a56:	41 54                	push   %r12
+  801a58:	53                   	push   %rbx
+  801a59:	48 83 ec 08          	sub    $0x8,%rsp
+  801a5d:	49 89 fe             	mov    %rdi,%r14
+  801a60:	49 89 f7             	mov    %rsi,%r15
+  801a63:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801a66:	48 89 f7             	mov    %rsi,%rdi
+  801a69:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  801a70:	00 00 00 
+  801a73:	ff d0                	call   *%rax
+  801a75:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801a78:	48 89 de             	mov    %rbx,%rsi
+  801a7b:	4c 89 f7             	mov    %r14,%rdi
+  801a7e:	48 b8 22 16 80 00 00 	movabs $0x801622,%rax
+  801a85:	00 00 00 
+  801a88:	ff d0                	call   *%rax
+  801a8a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801a8d:	48 39 c3             	cmp    %rax,%rbx
+  801a90:	74 36                	je     801ac8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801a92:	48 89 d8             	mov    %rbx,%rax
+  801a95:	4c 29 e8             	sub    %r13,%rax
+  801a98:	49 39 c4             	cmp    %rax,%r12
+  801a9b:	73 31                	jae    801ace <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801a9d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801aa2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801aa6:	4c 89 fe             	mov    %r15,%rsi
+  801aa9:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801ab5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801ab9:	48 83 c4 08          	add    $0x8,%rsp
+  801abd:	5b                   	pop    %rbx
+  801abe:	41 5c                	pop    %r12
+  801ac0:	41 5d                	pop    %r13
+  801ac2:	41 5e                	pop    %r14
+  801ac4:	41 5f                	pop    %r15
+  801ac6:	5d                   	pop    %rbp
+  801ac7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801ac8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801acc:	eb eb                	jmp    801ab9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801ace:	48 83 eb 01          	sub    $0x1,%rbx
+  801ad2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801ad6:	48 89 da             	mov    %rbx,%rdx
+  801ad9:	4c 89 fe             	mov    %r15,%rsi
+  801adc:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  801ae3:	00 00 00 
+  801ae6:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801ae8:	49 01 de             	add    %rbx,%r14
+  801aeb:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801af0:	eb c3                	jmp    801ab5 <strlcat+0x69>
+
+0000000000801af2 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801af2:	48 85 d2             	test   %rdx,%rdx
+  801af5:	74 2d                	je     801b24 <memcmp+0x32>
+  801af7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801afc:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801b00:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801b05:	44 38 c1             	cmp    %r8b,%cl
+  801b08:	75 0f                	jne    801b19 <memcmp+0x27>
+    while (n-- > 0) {
+  801b0a:	48 83 c0 01          	add    $0x1,%rax
+  801b0e:	48 39 c2             	cmp    %rax,%rdx
+  801b11:	75 e9                	jne    801afc <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801b13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b18:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801b19:	0f b6 c1             	movzbl %cl,%eax
+  801b1c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801b20:	44 29 c0             	sub    %r8d,%eax
+  801b23:	c3                   	ret
+    return 0;
+  801b24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b29:	c3                   	ret
+
+0000000000801b2a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801b2a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801b2e:	48 39 c7             	cmp    %rax,%rdi
+  801b31:	73 0f                	jae    801b42 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801b33:	40 38 37             	cmp    %sil,(%rdi)
+  801b36:	74 0e                	je     801b46 <memfind+0x1c>
+    for (; src < end; src++) {
+  801b38:	48 83 c7 01          	add    $0x1,%rdi
+  801b3c:	48 39 f8             	cmp    %rdi,%rax
+  801b3f:	75 f2                	jne    801b33 <memfind+0x9>
+  801b41:	c3                   	ret
+  801b42:	48 89 f8             	mov    %rdi,%rax
+  801b45:	c3                   	ret
+  801b46:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801b49:	c3                   	ret
+
+0000000000801b4a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b4a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801b4d:	0f b6 37             	movzbl (%rdi),%esi
+  801b50:	40 80 fe 20          	cmp    $0x20,%sil
+  801b54:	74 06                	je     801b5c <strtol+0x12>
+  801b56:	40 80 fe 09          	cmp    $0x9,%sil
+  801b5a:	75 13                	jne    801b6f <strtol+0x25>
+  801b5c:	48 83 c7 01          	add    $0x1,%rdi
+  801b60:	0f b6 37             	movzbl (%rdi),%esi
+  801b63:	40 80 fe 20          	cmp    $0x20,%sil
+  801b67:	74 f3                	je     801b5c <strtol+0x12>
+  801b69:	40 80 fe 09          	cmp    $0x9,%sil
+  801b6d:	74 ed                	je     801b5c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801b6f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801b72:	83 e0 fd             	and    $0xfffffffd,%eax
+  801b75:	3c 01                	cmp    $0x1,%al
+  801b77:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801b7b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801b81:	75 0f                	jne    801b92 <strtol+0x48>
+  801b83:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801b86:	74 14                	je     801b9c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801b88:	85 d2                	test   %edx,%edx
+  801b8a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b8f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801b92:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801b97:	4c 63 ca             	movslq %edx,%r9
+  801b9a:	eb 36                	jmp    801bd2 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801b9c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801ba0:	74 0f                	je     801bb1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801ba2:	85 d2                	test   %edx,%edx
+  801ba4:	75 ec                	jne    801b92 <strtol+0x48>
+        s++;
+  801ba6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801baa:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801baf:	eb e1                	jmp    801b92 <strtol+0x48>
+        s += 2;
+  801bb1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801bb5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801bba:	eb d6                	jmp    801b92 <strtol+0x48>
+            dig -= '0';
+  801bbc:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801bbf:	44 0f b6 c1          	movzbl %cl,%r8d
+  801bc3:	41 39 d0             	cmp    %edx,%r8d
+  801bc6:	7d 21                	jge    801be9 <strtol+0x9f>
+        val = val * base + dig;
+  801bc8:	49 0f af c1          	imul   %r9,%rax
+  801bcc:	0f b6 c9             	movzbl %cl,%ecx
+  801bcf:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801bd2:	48 83 c7 01          	add    $0x1,%rdi
+  801bd6:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801bda:	80 f9 39             	cmp    $0x39,%cl
+  801bdd:	76 dd                	jbe    801bbc <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801bdf:	80 f9 7b             	cmp    $0x7b,%cl
+  801be2:	77 05                	ja     801be9 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801be4:	83 e9 57             	sub    $0x57,%ecx
+  801be7:	eb d6                	jmp    801bbf <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801be9:	4d 85 d2             	test   %r10,%r10
+  801bec:	74 03                	je     801bf1 <strtol+0xa7>
+  801bee:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801bf1:	48 89 c2             	mov    %rax,%rdx
+  801bf4:	48 f7 da             	neg    %rdx
+  801bf7:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801bfb:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801bff:	c3                   	ret
+
+0000000000801c00 <atoi>:
+int atoi(const char *str) {
+  801c00:	55                   	push   %rbp
+  801c01:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801c04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c09:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0e:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  801c15:	00 00 00 
+  801c18:	ff d0                	call   *%rax
+}
+  801c1a:	5d                   	pop    %rbp
+  801c1b:	c3                   	ret
+
+0000000000801c1c <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  801c1c:	55                   	push   %rbp
+  801c1d:	48 89 e5             	mov    %rsp,%rbp
+  801c20:	41 57                	push   %r15
+  801c22:	41 56                	push   %r14
+  801c24:	41 55                	push   %r13
+  801c26:	41 54                	push   %r12
+  801c28:	53                   	push   %rbx
+  801c29:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  801c2d:	48 85 ff             	test   %rdi,%rdi
+  801c30:	74 23                	je     801c55 <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  801c32:	48 89 fa             	mov    %rdi,%rdx
+  801c35:	48 be bb 60 80 00 00 	movabs $0x8060bb,%rsi
+  801c3c:	00 00 00 
+  801c3f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801c44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c49:	48 b9 bb 44 80 00 00 	movabs $0x8044bb,%rcx
+  801c50:	00 00 00 
+  801c53:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  801c55:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c5a:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  801c61:	00 00 00 
+  801c64:	ff d0                	call   *%rax
+  801c66:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  801c69:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  801c6f:	49 bd db 09 80 00 00 	movabs $0x8009db,%r13
+  801c76:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  801c79:	49 bf b8 09 80 00 00 	movabs $0x8009b8,%r15
+  801c80:	00 00 00 
+  801c83:	eb 46                	jmp    801ccb <readline+0xaf>
+            return NULL;
+  801c85:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  801c8a:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  801c8d:	75 0f                	jne    801c9e <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  801c8f:	48 83 c4 08          	add    $0x8,%rsp
+  801c93:	5b                   	pop    %rbx
+  801c94:	41 5c                	pop    %r12
+  801c96:	41 5d                	pop    %r13
+  801c98:	41 5e                	pop    %r14
+  801c9a:	41 5f                	pop    %r15
+  801c9c:	5d                   	pop    %rbp
+  801c9d:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  801c9e:	89 de                	mov    %ebx,%esi
+  801ca0:	48 bf 9f 66 80 00 00 	movabs $0x80669f,%rdi
+  801ca7:	00 00 00 
+  801caa:	48 ba cd 0c 80 00 00 	movabs $0x800ccd,%rdx
+  801cb1:	00 00 00 
+  801cb4:	ff d2                	call   *%rdx
+            return NULL;
+  801cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbb:	eb d2                	jmp    801c8f <readline+0x73>
+            if (i) {
+  801cbd:	4d 85 e4             	test   %r12,%r12
+  801cc0:	74 09                	je     801ccb <readline+0xaf>
+                if (echo) {
+  801cc2:	45 85 f6             	test   %r14d,%r14d
+  801cc5:	75 3f                	jne    801d06 <readline+0xea>
+                i--;
+  801cc7:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  801ccb:	41 ff d5             	call   *%r13
+  801cce:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	78 b1                	js     801c85 <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  801cd4:	83 f8 08             	cmp    $0x8,%eax
+  801cd7:	74 e4                	je     801cbd <readline+0xa1>
+  801cd9:	83 f8 7f             	cmp    $0x7f,%eax
+  801cdc:	74 df                	je     801cbd <readline+0xa1>
+        } else if (c >= ' ') {
+  801cde:	83 f8 1f             	cmp    $0x1f,%eax
+  801ce1:	7e 4d                	jle    801d30 <readline+0x114>
+            if (i < BUFLEN - 1) {
+  801ce3:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  801cea:	77 df                	ja     801ccb <readline+0xaf>
+                if (echo) {
+  801cec:	45 85 f6             	test   %r14d,%r14d
+  801cef:	75 2f                	jne    801d20 <readline+0x104>
+                buf[i++] = (char)c;
+  801cf1:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  801cf8:	00 00 00 
+  801cfb:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  801cff:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  801d04:	eb c5                	jmp    801ccb <readline+0xaf>
+                    cputchar('\b');
+  801d06:	bf 08 00 00 00       	mov    $0x8,%edi
+  801d0b:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  801d0e:	bf 20 00 00 00       	mov    $0x20,%edi
+  801d13:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  801d16:	bf 08 00 00 00       	mov    $0x8,%edi
+  801d1b:	41 ff d7             	call   *%r15
+  801d1e:	eb a7                	jmp    801cc7 <readline+0xab>
+                    cputchar(c);
+  801d20:	89 c7                	mov    %eax,%edi
+  801d22:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  801d29:	00 00 00 
+  801d2c:	ff d0                	call   *%rax
+  801d2e:	eb c1                	jmp    801cf1 <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  801d30:	83 f8 0a             	cmp    $0xa,%eax
+  801d33:	74 05                	je     801d3a <readline+0x11e>
+  801d35:	83 f8 0d             	cmp    $0xd,%eax
+  801d38:	75 91                	jne    801ccb <readline+0xaf>
+            if (echo) {
+  801d3a:	45 85 f6             	test   %r14d,%r14d
+  801d3d:	75 14                	jne    801d53 <readline+0x137>
+            buf[i] = 0;
+  801d3f:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  801d46:	00 00 00 
+  801d49:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  801d4e:	e9 3c ff ff ff       	jmp    801c8f <readline+0x73>
+                cputchar('\n');
+  801d53:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801d58:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  801d5f:	00 00 00 
+  801d62:	ff d0                	call   *%rax
+  801d64:	eb d9                	jmp    801d3f <readline+0x123>
+
+0000000000801d66 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801d66:	55                   	push   %rbp
+  801d67:	48 89 e5             	mov    %rsp,%rbp
+  801d6a:	53                   	push   %rbx
+  801d6b:	48 89 fa             	mov    %rdi,%rdx
+  801d6e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d71:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d7b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d80:	be 00 00 00 00       	mov    $0x0,%esi
+  801d85:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d8b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801d8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d91:	c9                   	leave
+  801d92:	c3                   	ret
+
+0000000000801d93 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801d93:	55                   	push   %rbp
+  801d94:	48 89 e5             	mov    %rsp,%rbp
+  801d97:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d98:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801da7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801db1:	be 00 00 00 00       	mov    $0x0,%esi
+  801db6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dbc:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801dbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dc2:	c9                   	leave
+  801dc3:	c3                   	ret
+
+0000000000801dc4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801dc4:	55                   	push   %rbp
+  801dc5:	48 89 e5             	mov    %rsp,%rbp
+  801dc8:	53                   	push   %rbx
+  801dc9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801dcd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801dd0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801dd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801dda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ddf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801de4:	be 00 00 00 00       	mov    $0x0,%esi
+  801de9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801def:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801df1:	48 85 c0             	test   %rax,%rax
+  801df4:	7f 06                	jg     801dfc <sys_env_destroy+0x38>
+}
+  801df6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dfa:	c9                   	leave
+  801dfb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801dfc:	49 89 c0             	mov    %rax,%r8
+  801dff:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801e04:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  801e0b:	00 00 00 
+  801e0e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801e13:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  801e1a:	00 00 00 
+  801e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e22:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  801e29:	00 00 00 
+  801e2c:	41 ff d1             	call   *%r9
+
+0000000000801e2f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801e2f:	55                   	push   %rbp
+  801e30:	48 89 e5             	mov    %rsp,%rbp
+  801e33:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e34:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e48:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e4d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e52:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e58:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e5e:	c9                   	leave
+  801e5f:	c3                   	ret
+
+0000000000801e60 <sys_yield>:
+
+void
+sys_yield(void) {
+  801e60:	55                   	push   %rbp
+  801e61:	48 89 e5             	mov    %rsp,%rbp
+  801e64:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e65:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e79:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e7e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e83:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e89:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e8f:	c9                   	leave
+  801e90:	c3                   	ret
+
+0000000000801e91 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801e91:	55                   	push   %rbp
+  801e92:	48 89 e5             	mov    %rsp,%rbp
+  801e95:	53                   	push   %rbx
+  801e96:	48 89 fa             	mov    %rdi,%rdx
+  801e99:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801e9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ea1:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801ea8:	00 00 00 
+  801eab:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801eb0:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ebb:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801ebd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ec1:	c9                   	leave
+  801ec2:	c3                   	ret
+
+0000000000801ec3 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801ec3:	55                   	push   %rbp
+  801ec4:	48 89 e5             	mov    %rsp,%rbp
+  801ec7:	53                   	push   %rbx
+  801ec8:	49 89 f8             	mov    %rdi,%r8
+  801ecb:	48 89 d3             	mov    %rdx,%rbx
+  801ece:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801ed1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ed6:	4c 89 c2             	mov    %r8,%rdx
+  801ed9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801edc:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ee7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801ee9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eed:	c9                   	leave
+  801eee:	c3                   	ret
+
+0000000000801eef <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801eef:	55                   	push   %rbp
+  801ef0:	48 89 e5             	mov    %rsp,%rbp
+  801ef3:	53                   	push   %rbx
+  801ef4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef8:	89 f8                	mov    %edi,%eax
+  801efa:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801efd:	48 63 f9             	movslq %ecx,%rdi
+  801f00:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f03:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f08:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f0b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f16:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f18:	48 85 c0             	test   %rax,%rax
+  801f1b:	7f 06                	jg     801f23 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801f1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f21:	c9                   	leave
+  801f22:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f23:	49 89 c0             	mov    %rax,%r8
+  801f26:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801f2b:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  801f32:	00 00 00 
+  801f35:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801f3a:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  801f41:	00 00 00 
+  801f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f49:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  801f50:	00 00 00 
+  801f53:	41 ff d1             	call   *%r9
+
+0000000000801f56 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801f56:	55                   	push   %rbp
+  801f57:	48 89 e5             	mov    %rsp,%rbp
+  801f5a:	53                   	push   %rbx
+  801f5b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f5f:	89 f8                	mov    %edi,%eax
+  801f61:	49 89 f2             	mov    %rsi,%r10
+  801f64:	48 89 cf             	mov    %rcx,%rdi
+  801f67:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801f6a:	48 63 da             	movslq %edx,%rbx
+  801f6d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f70:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f75:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f78:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801f7b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f7d:	48 85 c0             	test   %rax,%rax
+  801f80:	7f 06                	jg     801f88 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801f82:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f86:	c9                   	leave
+  801f87:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f88:	49 89 c0             	mov    %rax,%r8
+  801f8b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801f90:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  801f97:	00 00 00 
+  801f9a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801f9f:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  801fa6:	00 00 00 
+  801fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fae:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  801fb5:	00 00 00 
+  801fb8:	41 ff d1             	call   *%r9
+
+0000000000801fbb <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801fbb:	55                   	push   %rbp
+  801fbc:	48 89 e5             	mov    %rsp,%rbp
+  801fbf:	53                   	push   %rbx
+  801fc0:	48 83 ec 08          	sub    $0x8,%rsp
+  801fc4:	49 89 f9             	mov    %rdi,%r9
+  801fc7:	89 f0                	mov    %esi,%eax
+  801fc9:	48 89 d3             	mov    %rdx,%rbx
+  801fcc:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801fcf:	49 63 f0             	movslq %r8d,%rsi
+  801fd2:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801fd5:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fda:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fdd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fe3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801fe5:	48 85 c0             	test   %rax,%rax
+  801fe8:	7f 06                	jg     801ff0 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801fea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fee:	c9                   	leave
+  801fef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ff0:	49 89 c0             	mov    %rax,%r8
+  801ff3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801ff8:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  801fff:	00 00 00 
+  802002:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802007:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  80200e:	00 00 00 
+  802011:	b8 00 00 00 00       	mov    $0x0,%eax
+  802016:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  80201d:	00 00 00 
+  802020:	41 ff d1             	call   *%r9
+
+0000000000802023 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  802023:	55                   	push   %rbp
+  802024:	48 89 e5             	mov    %rsp,%rbp
+  802027:	53                   	push   %rbx
+  802028:	89 f8                	mov    %edi,%eax
+  80202a:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80202d:	48 63 f9             	movslq %ecx,%rdi
+  802030:	48 63 da             	movslq %edx,%rbx
+  802033:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802036:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80203b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80203e:	be 00 00 00 00       	mov    $0x0,%esi
+  802043:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802049:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80204b:	89 c2                	mov    %eax,%edx
+  80204d:	48 85 c0             	test   %rax,%rax
+  802050:	78 0d                	js     80205f <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  802052:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  802057:	4d 85 c9             	test   %r9,%r9
+  80205a:	74 03                	je     80205f <sys_alloc_dma_region+0x3c>
+  80205c:	49 89 01             	mov    %rax,(%r9)
+}
+  80205f:	89 d0                	mov    %edx,%eax
+  802061:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802065:	c9                   	leave
+  802066:	c3                   	ret
+
+0000000000802067 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  802067:	55                   	push   %rbp
+  802068:	48 89 e5             	mov    %rsp,%rbp
+  80206b:	53                   	push   %rbx
+  80206c:	48 83 ec 08          	sub    $0x8,%rsp
+  802070:	48 89 f1             	mov    %rsi,%rcx
+  802073:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  802076:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802079:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80207e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802083:	be 00 00 00 00       	mov    $0x0,%esi
+  802088:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80208e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802090:	48 85 c0             	test   %rax,%rax
+  802093:	7f 06                	jg     80209b <sys_set_cache_region+0x34>
+}
+  802095:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802099:	c9                   	leave
+  80209a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80209b:	49 89 c0             	mov    %rax,%r8
+  80209e:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8020a3:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  8020aa:	00 00 00 
+  8020ad:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8020b2:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  8020b9:	00 00 00 
+  8020bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c1:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  8020c8:	00 00 00 
+  8020cb:	41 ff d1             	call   *%r9
+
+00000000008020ce <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8020ce:	55                   	push   %rbp
+  8020cf:	48 89 e5             	mov    %rsp,%rbp
+  8020d2:	53                   	push   %rbx
+  8020d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8020d7:	48 89 f1             	mov    %rsi,%rcx
+  8020da:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8020dd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020e0:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020f7:	48 85 c0             	test   %rax,%rax
+  8020fa:	7f 06                	jg     802102 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8020fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802100:	c9                   	leave
+  802101:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802102:	49 89 c0             	mov    %rax,%r8
+  802105:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80210a:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  802111:	00 00 00 
+  802114:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802119:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  802120:	00 00 00 
+  802123:	b8 00 00 00 00       	mov    $0x0,%eax
+  802128:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  80212f:	00 00 00 
+  802132:	41 ff d1             	call   *%r9
+
+0000000000802135 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802135:	55                   	push   %rbp
+  802136:	48 89 e5             	mov    %rsp,%rbp
+  802139:	53                   	push   %rbx
+  80213a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80213e:	48 63 ce             	movslq %esi,%rcx
+  802141:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802144:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802149:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80214e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802153:	be 00 00 00 00       	mov    $0x0,%esi
+  802158:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80215e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802160:	48 85 c0             	test   %rax,%rax
+  802163:	7f 06                	jg     80216b <sys_env_set_status+0x36>
+}
+  802165:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802169:	c9                   	leave
+  80216a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80216b:	49 89 c0             	mov    %rax,%r8
+  80216e:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  802173:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  80217a:	00 00 00 
+  80217d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802182:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  802189:	00 00 00 
+  80218c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802191:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  802198:	00 00 00 
+  80219b:	41 ff d1             	call   *%r9
+
+000000000080219e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80219e:	55                   	push   %rbp
+  80219f:	48 89 e5             	mov    %rsp,%rbp
+  8021a2:	53                   	push   %rbx
+  8021a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8021aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8021ad:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8021c9:	48 85 c0             	test   %rax,%rax
+  8021cc:	7f 06                	jg     8021d4 <sys_env_set_trapframe+0x36>
+}
+  8021ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021d2:	c9                   	leave
+  8021d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8021d4:	49 89 c0             	mov    %rax,%r8
+  8021d7:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8021dc:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  8021e3:	00 00 00 
+  8021e6:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8021eb:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  8021f2:	00 00 00 
+  8021f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021fa:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  802201:	00 00 00 
+  802204:	41 ff d1             	call   *%r9
+
+0000000000802207 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802207:	55                   	push   %rbp
+  802208:	48 89 e5             	mov    %rsp,%rbp
+  80220b:	53                   	push   %rbx
+  80220c:	48 83 ec 08          	sub    $0x8,%rsp
+  802210:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  802213:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802216:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80221b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802220:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802225:	be 00 00 00 00       	mov    $0x0,%esi
+  80222a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802230:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802232:	48 85 c0             	test   %rax,%rax
+  802235:	7f 06                	jg     80223d <sys_env_set_pgfault_upcall+0x36>
+}
+  802237:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80223b:	c9                   	leave
+  80223c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80223d:	49 89 c0             	mov    %rax,%r8
+  802240:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  802245:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  80224c:	00 00 00 
+  80224f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802254:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  80225b:	00 00 00 
+  80225e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802263:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  80226a:	00 00 00 
+  80226d:	41 ff d1             	call   *%r9
+
+0000000000802270 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802270:	55                   	push   %rbp
+  802271:	48 89 e5             	mov    %rsp,%rbp
+  802274:	53                   	push   %rbx
+  802275:	89 f8                	mov    %edi,%eax
+  802277:	49 89 f1             	mov    %rsi,%r9
+  80227a:	48 89 d3             	mov    %rdx,%rbx
+  80227d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  802280:	49 63 f0             	movslq %r8d,%rsi
+  802283:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802286:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80228b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80228e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802294:	cd 30                	int    $0x30
+}
+  802296:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80229a:	c9                   	leave
+  80229b:	c3                   	ret
+
+000000000080229c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80229c:	55                   	push   %rbp
+  80229d:	48 89 e5             	mov    %rsp,%rbp
+  8022a0:	53                   	push   %rbx
+  8022a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a5:	48 89 fa             	mov    %rdi,%rdx
+  8022a8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8022ab:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8022b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8022ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8022bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8022c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8022c7:	48 85 c0             	test   %rax,%rax
+  8022ca:	7f 06                	jg     8022d2 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8022cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022d0:	c9                   	leave
+  8022d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8022d2:	49 89 c0             	mov    %rax,%r8
+  8022d5:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8022da:	48 ba b0 66 80 00 00 	movabs $0x8066b0,%rdx
+  8022e1:	00 00 00 
+  8022e4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8022e9:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  8022f0:	00 00 00 
+  8022f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f8:	49 b9 7d 0b 80 00 00 	movabs $0x800b7d,%r9
+  8022ff:	00 00 00 
+  802302:	41 ff d1             	call   *%r9
+
+0000000000802305 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  802305:	55                   	push   %rbp
+  802306:	48 89 e5             	mov    %rsp,%rbp
+  802309:	53                   	push   %rbx
+  80230a:	48 89 fa             	mov    %rdi,%rdx
+  80230d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802310:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802315:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80231a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80231f:	be 00 00 00 00       	mov    $0x0,%esi
+  802324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80232a:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80232c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802330:	c9                   	leave
+  802331:	c3                   	ret
+
+0000000000802332 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802332:	55                   	push   %rbp
+  802333:	48 89 e5             	mov    %rsp,%rbp
+  802336:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802337:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80233c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802341:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802346:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80234b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802350:	be 00 00 00 00       	mov    $0x0,%esi
+  802355:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80235b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80235d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802361:	c9                   	leave
+  802362:	c3                   	ret
+
+0000000000802363 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  802363:	48 85 ff             	test   %rdi,%rdi
+  802366:	0f 84 b6 01 00 00    	je     802522 <malloc+0x1bf>
+malloc(size_t size) {
+  80236c:	55                   	push   %rbp
+  80236d:	48 89 e5             	mov    %rsp,%rbp
+  802370:	41 56                	push   %r14
+  802372:	41 55                	push   %r13
+  802374:	41 54                	push   %r12
+  802376:	53                   	push   %rbx
+  802377:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80237a:	48 b8 28 84 80 00 00 	movabs $0x808428,%rax
+  802381:	00 00 00 
+  802384:	4c 8b 20             	mov    (%rax),%r12
+  802387:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80238e:	0f 87 94 01 00 00    	ja     802528 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  802394:	48 a1 20 84 80 00 00 	movabs 0x808420,%rax
+  80239b:	00 00 00 
+  80239e:	48 85 c0             	test   %rax,%rax
+  8023a1:	74 6b                	je     80240e <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  8023a3:	4d 85 e4             	test   %r12,%r12
+  8023a6:	74 66                	je     80240e <malloc+0xab>
+  8023a8:	48 ba 48 84 80 00 00 	movabs $0x808448,%rdx
+  8023af:	00 00 00 
+  8023b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023b7:	eb 0d                	jmp    8023c6 <malloc+0x63>
+  8023b9:	48 83 c1 01          	add    $0x1,%rcx
+  8023bd:	48 83 c2 18          	add    $0x18,%rdx
+  8023c1:	49 39 cc             	cmp    %rcx,%r12
+  8023c4:	74 48                	je     80240e <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  8023c6:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  8023cb:	74 ec                	je     8023b9 <malloc+0x56>
+  8023cd:	48 39 1a             	cmp    %rbx,(%rdx)
+  8023d0:	72 e7                	jb     8023b9 <malloc+0x56>
+                real_freep_size--;
+  8023d2:	48 83 e8 01          	sub    $0x1,%rax
+  8023d6:	48 a3 20 84 80 00 00 	movabs %rax,0x808420
+  8023dd:	00 00 00 
+                freep[i].is_free = false;
+  8023e0:	48 ba 40 84 80 00 00 	movabs $0x808440,%rdx
+  8023e7:	00 00 00 
+  8023ea:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8023ee:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8023f2:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8023f6:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8023fd:	00 
+                freep[i].size = size;
+  8023fe:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  802402:	48 01 c8             	add    %rcx,%rax
+  802405:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802409:	e9 0b 01 00 00       	jmp    802519 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  80240e:	48 a1 40 70 80 00 00 	movabs 0x807040,%rax
+  802415:	00 00 00 
+  802418:	48 01 d8             	add    %rbx,%rax
+  80241b:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  802421:	76 7c                	jbe    80249f <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  802423:	48 b8 48 70 80 00 00 	movabs $0x807048,%rax
+  80242a:	00 00 00 
+  80242d:	4c 8b 30             	mov    (%rax),%r14
+  802430:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  802437:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  80243a:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  802441:	00 00 00 
+  802444:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  80244b:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  802452:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802458:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80245c:	48 b8 2f 1e 80 00 00 	movabs $0x801e2f,%rax
+  802463:	00 00 00 
+  802466:	ff d0                	call   *%rax
+  802468:	89 c7                	mov    %eax,%edi
+  80246a:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802471:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802478:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80247f:	00 00 00 
+  802482:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  802486:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80248b:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  802492:	00 00 00 
+  802495:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  802497:	85 c0                	test   %eax,%eax
+  802499:	0f 88 90 00 00 00    	js     80252f <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80249f:	48 b9 48 70 80 00 00 	movabs $0x807048,%rcx
+  8024a6:	00 00 00 
+  8024a9:	48 8b 31             	mov    (%rcx),%rsi
+  8024ac:	48 bf 40 70 80 00 00 	movabs $0x807040,%rdi
+  8024b3:	00 00 00 
+  8024b6:	4c 8b 07             	mov    (%rdi),%r8
+  8024b9:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  8024bd:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  8024c4:	00 00 00 
+  8024c7:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  8024cb:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  8024cf:	48 b8 40 84 80 00 00 	movabs $0x808440,%rax
+  8024d6:	00 00 00 
+  8024d9:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  8024dd:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  8024e0:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8024e4:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8024eb:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8024ec:	48 89 d8             	mov    %rbx,%rax
+  8024ef:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024f4:	4c 01 c0             	add    %r8,%rax
+  8024f7:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8024fa:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802501:	48 01 f3             	add    %rsi,%rbx
+  802504:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  802507:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  80250c:	48 a3 28 84 80 00 00 	movabs %rax,0x808428
+  802513:	00 00 00 
+  802516:	48 89 d0             	mov    %rdx,%rax
+}
+  802519:	5b                   	pop    %rbx
+  80251a:	41 5c                	pop    %r12
+  80251c:	41 5d                	pop    %r13
+  80251e:	41 5e                	pop    %r14
+  802520:	5d                   	pop    %rbp
+  802521:	c3                   	ret
+        return NULL;
+  802522:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802527:	c3                   	ret
+        return NULL;
+  802528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80252d:	eb ea                	jmp    802519 <malloc+0x1b6>
+            return NULL;
+  80252f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802534:	eb e3                	jmp    802519 <malloc+0x1b6>
+
+0000000000802536 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  802536:	55                   	push   %rbp
+  802537:	48 89 e5             	mov    %rsp,%rbp
+  80253a:	53                   	push   %rbx
+  80253b:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  80253f:	48 89 fb             	mov    %rdi,%rbx
+  802542:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  802546:	48 89 df             	mov    %rbx,%rdi
+  802549:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+  802555:	48 89 c7             	mov    %rax,%rdi
+  802558:	48 89 da             	mov    %rbx,%rdx
+  80255b:	be 00 00 00 00       	mov    $0x0,%esi
+  802560:	48 b8 25 19 80 00 00 	movabs $0x801925,%rax
+  802567:	00 00 00 
+  80256a:	ff d0                	call   *%rax
+}
+  80256c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802570:	c9                   	leave
+  802571:	c3                   	ret
+
+0000000000802572 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  802572:	48 a1 28 84 80 00 00 	movabs 0x808428,%rax
+  802579:	00 00 00 
+  80257c:	48 ba 20 84 80 00 00 	movabs $0x808420,%rdx
+  802583:	00 00 00 
+  802586:	48 3b 02             	cmp    (%rdx),%rax
+  802589:	74 4d                	je     8025d8 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  80258b:	48 85 c0             	test   %rax,%rax
+  80258e:	74 4d                	je     8025dd <get_allocsize+0x6b>
+  802590:	48 b9 40 84 80 00 00 	movabs $0x808440,%rcx
+  802597:	00 00 00 
+  80259a:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80259f:	48 3b 39             	cmp    (%rcx),%rdi
+  8025a2:	74 13                	je     8025b7 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  8025a4:	48 83 c2 01          	add    $0x1,%rdx
+  8025a8:	48 83 c1 18          	add    $0x18,%rcx
+  8025ac:	48 39 d0             	cmp    %rdx,%rax
+  8025af:	75 ee                	jne    80259f <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  8025b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b6:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  8025b7:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  8025bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c0:	48 be 40 84 80 00 00 	movabs $0x808440,%rsi
+  8025c7:	00 00 00 
+  8025ca:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  8025d0:	75 0b                	jne    8025dd <get_allocsize+0x6b>
+  8025d2:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  8025d7:	c3                   	ret
+        return 0;
+  8025d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025dd:	c3                   	ret
+
+00000000008025de <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  8025de:	48 85 ff             	test   %rdi,%rdi
+  8025e1:	0f 84 01 01 00 00    	je     8026e8 <free+0x10a>
+free(void *ptr) {
+  8025e7:	55                   	push   %rbp
+  8025e8:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8025eb:	48 b8 28 84 80 00 00 	movabs $0x808428,%rax
+  8025f2:	00 00 00 
+  8025f5:	48 8b 30             	mov    (%rax),%rsi
+  8025f8:	48 a1 20 84 80 00 00 	movabs 0x808420,%rax
+  8025ff:	00 00 00 
+  802602:	48 39 c6             	cmp    %rax,%rsi
+  802605:	74 50                	je     802657 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  802607:	48 85 f6             	test   %rsi,%rsi
+  80260a:	74 21                	je     80262d <free+0x4f>
+  80260c:	48 b9 40 84 80 00 00 	movabs $0x808440,%rcx
+  802613:	00 00 00 
+  802616:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  80261b:	48 3b 39             	cmp    (%rcx),%rdi
+  80261e:	74 61                	je     802681 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  802620:	48 83 c2 01          	add    $0x1,%rdx
+  802624:	48 83 c1 18          	add    $0x18,%rcx
+  802628:	48 39 d6             	cmp    %rdx,%rsi
+  80262b:	75 ee                	jne    80261b <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  80262d:	48 ba 20 67 80 00 00 	movabs $0x806720,%rdx
+  802634:	00 00 00 
+  802637:	be 12 01 00 00       	mov    $0x112,%esi
+  80263c:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  802643:	00 00 00 
+  802646:	b8 00 00 00 00       	mov    $0x0,%eax
+  80264b:	48 b9 7d 0b 80 00 00 	movabs $0x800b7d,%rcx
+  802652:	00 00 00 
+  802655:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  802657:	48 ba d0 66 80 00 00 	movabs $0x8066d0,%rdx
+  80265e:	00 00 00 
+  802661:	be 06 01 00 00       	mov    $0x106,%esi
+  802666:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  80266d:	00 00 00 
+  802670:	b8 00 00 00 00       	mov    $0x0,%eax
+  802675:	48 b9 7d 0b 80 00 00 	movabs $0x800b7d,%rcx
+  80267c:	00 00 00 
+  80267f:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  802681:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  802685:	48 be 40 84 80 00 00 	movabs $0x808440,%rsi
+  80268c:	00 00 00 
+  80268f:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  802695:	75 27                	jne    8026be <free+0xe0>
+            freep[i].is_free = true;
+  802697:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80269b:	48 ba 40 84 80 00 00 	movabs $0x808440,%rdx
+  8026a2:	00 00 00 
+  8026a5:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  8026ac:	00 00 
+            real_freep_size++;
+  8026ae:	48 83 c0 01          	add    $0x1,%rax
+  8026b2:	48 a3 20 84 80 00 00 	movabs %rax,0x808420
+  8026b9:	00 00 00 
+}
+  8026bc:	5d                   	pop    %rbp
+  8026bd:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  8026be:	48 ba f8 66 80 00 00 	movabs $0x8066f8,%rdx
+  8026c5:	00 00 00 
+  8026c8:	be 0b 01 00 00       	mov    $0x10b,%esi
+  8026cd:	48 bf 48 67 80 00 00 	movabs $0x806748,%rdi
+  8026d4:	00 00 00 
+  8026d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026dc:	48 b9 7d 0b 80 00 00 	movabs $0x800b7d,%rcx
+  8026e3:	00 00 00 
+  8026e6:	ff d1                	call   *%rcx
+  8026e8:	c3                   	ret
+
+00000000008026e9 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  8026e9:	55                   	push   %rbp
+  8026ea:	48 89 e5             	mov    %rsp,%rbp
+  8026ed:	41 55                	push   %r13
+  8026ef:	41 54                	push   %r12
+  8026f1:	53                   	push   %rbx
+  8026f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8026f6:	48 89 fb             	mov    %rdi,%rbx
+  8026f9:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  8026fc:	48 b8 72 25 80 00 00 	movabs $0x802572,%rax
+  802703:	00 00 00 
+  802706:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  802708:	49 39 c5             	cmp    %rax,%r13
+  80270b:	73 0e                	jae    80271b <realloc+0x32>
+}
+  80270d:	48 89 d8             	mov    %rbx,%rax
+  802710:	48 83 c4 08          	add    $0x8,%rsp
+  802714:	5b                   	pop    %rbx
+  802715:	41 5c                	pop    %r12
+  802717:	41 5d                	pop    %r13
+  802719:	5d                   	pop    %rbp
+  80271a:	c3                   	ret
+  80271b:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  80271e:	4c 89 ef             	mov    %r13,%rdi
+  802721:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  802728:	00 00 00 
+  80272b:	ff d0                	call   *%rax
+  80272d:	48 89 c7             	mov    %rax,%rdi
+  802730:	4c 89 e2             	mov    %r12,%rdx
+  802733:	48 89 de             	mov    %rbx,%rsi
+  802736:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  80273d:	00 00 00 
+  802740:	ff d0                	call   *%rax
+  802742:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  802745:	48 89 df             	mov    %rbx,%rdi
+  802748:	48 b8 de 25 80 00 00 	movabs $0x8025de,%rax
+  80274f:	00 00 00 
+  802752:	ff d0                	call   *%rax
+    return newptr;
+  802754:	4c 89 e3             	mov    %r12,%rbx
+  802757:	eb b4                	jmp    80270d <realloc+0x24>
+
+0000000000802759 <strdup>:
+
+char*
+strdup (const char *src) {
+  802759:	55                   	push   %rbp
+  80275a:	48 89 e5             	mov    %rsp,%rbp
+  80275d:	41 54                	push   %r12
+  80275f:	53                   	push   %rbx
+  802760:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  802763:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  80276a:	00 00 00 
+  80276d:	ff d0                	call   *%rax
+  80276f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  802773:	4c 89 e7             	mov    %r12,%rdi
+  802776:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  80277d:	00 00 00 
+  802780:	ff d0                	call   *%rax
+  802782:	48 89 c7             	mov    %rax,%rdi
+  802785:	4c 89 e2             	mov    %r12,%rdx
+  802788:	48 89 de             	mov    %rbx,%rsi
+  80278b:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  802792:	00 00 00 
+  802795:	ff d0                	call   *%rax
+}
+  802797:	5b                   	pop    %rbx
+  802798:	41 5c                	pop    %r12
+  80279a:	5d                   	pop    %rbp
+  80279b:	c3                   	ret
+
+000000000080279c <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  80279c:	55                   	push   %rbp
+  80279d:	48 89 e5             	mov    %rsp,%rbp
+  8027a0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8027a1:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8027ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8027bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8027c5:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027cb:	c9                   	leave
+  8027cc:	c3                   	ret
+
+00000000008027cd <get_ticks>:
+
+uint64_t
+get_ticks() {
+  8027cd:	55                   	push   %rbp
+  8027ce:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  8027d1:	48 b8 40 84 98 00 00 	movabs $0x988440,%rax
+  8027d8:	00 00 00 
+  8027db:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8027df:	74 26                	je     802807 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8027e1:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8027e3:	48 c1 e2 20          	shl    $0x20,%rdx
+  8027e7:	89 c0                	mov    %eax,%eax
+  8027e9:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  8027ec:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  8027f3:	48 b9 40 84 98 00 00 	movabs $0x988440,%rcx
+  8027fa:	00 00 00 
+  8027fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802802:	48 f7 31             	divq   (%rcx)
+}
+  802805:	5d                   	pop    %rbp
+  802806:	c3                   	ret
+        freq = get_cpufreq();
+  802807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280c:	48 ba 9c 27 80 00 00 	movabs $0x80279c,%rdx
+  802813:	00 00 00 
+  802816:	ff d2                	call   *%rdx
+  802818:	48 a3 40 84 98 00 00 	movabs %rax,0x988440
+  80281f:	00 00 00 
+  802822:	eb bd                	jmp    8027e1 <get_ticks+0x14>
+
+0000000000802824 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  802824:	55                   	push   %rbp
+  802825:	48 89 e5             	mov    %rsp,%rbp
+  802828:	53                   	push   %rbx
+  802829:	48 83 ec 08          	sub    $0x8,%rsp
+  80282d:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  802830:	48 b8 40 84 98 00 00 	movabs $0x988440,%rax
+  802837:	00 00 00 
+  80283a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80283e:	74 50                	je     802890 <sleep+0x6c>
+    asm volatile("rdtsc"
+  802840:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802842:	48 c1 e2 20          	shl    $0x20,%rdx
+  802846:	89 c0                	mov    %eax,%eax
+  802848:	48 89 d6             	mov    %rdx,%rsi
+  80284b:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  80284e:	48 b8 40 84 98 00 00 	movabs $0x988440,%rax
+  802855:	00 00 00 
+  802858:	48 0f af 18          	imul   (%rax),%rbx
+  80285c:	48 c1 eb 03          	shr    $0x3,%rbx
+  802860:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  802867:	9b c4 20 
+  80286a:	48 89 d8             	mov    %rbx,%rax
+  80286d:	48 f7 e2             	mul    %rdx
+  802870:	48 89 d1             	mov    %rdx,%rcx
+  802873:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  802877:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802879:	48 c1 e2 20          	shl    $0x20,%rdx
+  80287d:	89 c0                	mov    %eax,%eax
+  80287f:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  802882:	48 29 f2             	sub    %rsi,%rdx
+  802885:	48 39 ca             	cmp    %rcx,%rdx
+  802888:	72 ed                	jb     802877 <sleep+0x53>
+}
+  80288a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80288e:	c9                   	leave
+  80288f:	c3                   	ret
+        freq = get_cpufreq();
+  802890:	b8 00 00 00 00       	mov    $0x0,%eax
+  802895:	48 ba 9c 27 80 00 00 	movabs $0x80279c,%rdx
+  80289c:	00 00 00 
+  80289f:	ff d2                	call   *%rdx
+  8028a1:	48 a3 40 84 98 00 00 	movabs %rax,0x988440
+  8028a8:	00 00 00 
+  8028ab:	eb 93                	jmp    802840 <sleep+0x1c>
+
+00000000008028ad <poll_kbd>:
+
+int poll_kbd() {
+  8028ad:	55                   	push   %rbp
+  8028ae:	48 89 e5             	mov    %rsp,%rbp
+  8028b1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028b2:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8028cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8028d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8028d6:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028dc:	c9                   	leave
+  8028dd:	c3                   	ret
+
+00000000008028de <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  8028de:	55                   	push   %rbp
+  8028df:	48 89 e5             	mov    %rsp,%rbp
+  8028e2:	53                   	push   %rbx
+  8028e3:	49 89 fa             	mov    %rdi,%r10
+  8028e6:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  8028e8:	44 89 c6             	mov    %r8d,%esi
+  8028eb:	89 cf                	mov    %ecx,%edi
+  8028ed:	89 d3                	mov    %edx,%ebx
+  8028ef:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8028f1:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028f6:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8028f9:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  8028fd:	cd 30                	int    $0x30
+  8028ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802903:	c9                   	leave
+  802904:	c3                   	ret
+
+0000000000802905 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802905:	55                   	push   %rbp
+  802906:	48 89 e5             	mov    %rsp,%rbp
+  802909:	41 54                	push   %r12
+  80290b:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  80290c:	48 b8 38 42 80 00 00 	movabs $0x804238,%rax
+  802913:	00 00 00 
+  802916:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802918:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80291d:	cd 30                	int    $0x30
+  80291f:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  802922:	85 c0                	test   %eax,%eax
+  802924:	78 76                	js     80299c <fork+0x97>
+        return envid;
+    if (!envid) {
+  802926:	74 7c                	je     8029a4 <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  802928:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80292e:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802935:	00 00 00 
+  802938:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80293d:	89 c2                	mov    %eax,%edx
+  80293f:	be 00 00 00 00       	mov    $0x0,%esi
+  802944:	bf 00 00 00 00       	mov    $0x0,%edi
+  802949:	48 b8 56 1f 80 00 00 	movabs $0x801f56,%rax
+  802950:	00 00 00 
+  802953:	ff d0                	call   *%rax
+  802955:	85 c0                	test   %eax,%eax
+  802957:	75 7c                	jne    8029d5 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  802959:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  802960:	00 00 00 
+  802963:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  80296a:	44 89 e7             	mov    %r12d,%edi
+  80296d:	48 b8 07 22 80 00 00 	movabs $0x802207,%rax
+  802974:	00 00 00 
+  802977:	ff d0                	call   *%rax
+  802979:	85 c0                	test   %eax,%eax
+  80297b:	75 60                	jne    8029dd <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  80297d:	be 02 00 00 00       	mov    $0x2,%esi
+  802982:	44 89 e7             	mov    %r12d,%edi
+  802985:	48 b8 35 21 80 00 00 	movabs $0x802135,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+        return -1;
+  802991:	85 c0                	test   %eax,%eax
+  802993:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802998:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  80299c:	44 89 e0             	mov    %r12d,%eax
+  80299f:	5b                   	pop    %rbx
+  8029a0:	41 5c                	pop    %r12
+  8029a2:	5d                   	pop    %rbp
+  8029a3:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8029a4:	48 b8 2f 1e 80 00 00 	movabs $0x801e2f,%rax
+  8029ab:	00 00 00 
+  8029ae:	ff d0                	call   *%rax
+  8029b0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029b5:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8029bc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8029c3:	00 00 00 
+  8029c6:	48 01 d0             	add    %rdx,%rax
+  8029c9:	48 a3 18 80 80 00 00 	movabs %rax,0x808018
+  8029d0:	00 00 00 
+        return 0;
+  8029d3:	eb c7                	jmp    80299c <fork+0x97>
+        return -1;
+  8029d5:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8029db:	eb bf                	jmp    80299c <fork+0x97>
+  8029dd:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8029e3:	eb b7                	jmp    80299c <fork+0x97>
+
+00000000008029e5 <sfork>:
+
+envid_t
+sfork() {
+  8029e5:	55                   	push   %rbp
+  8029e6:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8029e9:	48 ba 56 67 80 00 00 	movabs $0x806756,%rdx
+  8029f0:	00 00 00 
+  8029f3:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8029f8:	48 bf 71 67 80 00 00 	movabs $0x806771,%rdi
+  8029ff:	00 00 00 
+  802a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a07:	48 b9 7d 0b 80 00 00 	movabs $0x800b7d,%rcx
+  802a0e:	00 00 00 
+  802a11:	ff d1                	call   *%rcx
+
+0000000000802a13 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  802a13:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  802a16:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  802a1a:	83 3f 01             	cmpl   $0x1,(%rdi)
+  802a1d:	7e 0f                	jle    802a2e <argstart+0x1b>
+  802a1f:	48 b8 04 60 80 00 00 	movabs $0x806004,%rax
+  802a26:	00 00 00 
+  802a29:	48 85 f6             	test   %rsi,%rsi
+  802a2c:	75 05                	jne    802a33 <argstart+0x20>
+  802a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a33:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  802a37:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  802a3e:	00 
+}
+  802a3f:	c3                   	ret
+
+0000000000802a40 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  802a40:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802a47:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  802a48:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802a4c:	48 85 c0             	test   %rax,%rax
+  802a4f:	0f 84 8f 00 00 00    	je     802ae4 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  802a55:	55                   	push   %rbp
+  802a56:	48 89 e5             	mov    %rsp,%rbp
+  802a59:	53                   	push   %rbx
+  802a5a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a5e:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  802a61:	80 38 00             	cmpb   $0x0,(%rax)
+  802a64:	75 52                	jne    802ab8 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  802a66:	48 8b 17             	mov    (%rdi),%rdx
+  802a69:	83 3a 01             	cmpl   $0x1,(%rdx)
+  802a6c:	74 67                	je     802ad5 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802a6e:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802a72:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  802a76:	80 38 2d             	cmpb   $0x2d,(%rax)
+  802a79:	75 5a                	jne    802ad5 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  802a7b:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802a7f:	74 54                	je     802ad5 <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  802a81:	48 83 c0 01          	add    $0x1,%rax
+  802a85:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802a89:	8b 12                	mov    (%rdx),%edx
+  802a8b:	83 ea 01             	sub    $0x1,%edx
+  802a8e:	48 63 d2             	movslq %edx,%rdx
+  802a91:	48 c1 e2 03          	shl    $0x3,%rdx
+  802a95:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  802a99:	48 83 c7 08          	add    $0x8,%rdi
+  802a9d:	48 b8 d3 19 80 00 00 	movabs $0x8019d3,%rax
+  802aa4:	00 00 00 
+  802aa7:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  802aa9:	48 8b 03             	mov    (%rbx),%rax
+  802aac:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  802aaf:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802ab3:	80 38 2d             	cmpb   $0x2d,(%rax)
+  802ab6:	74 17                	je     802acf <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  802ab8:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802abc:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  802abf:	48 83 c0 01          	add    $0x1,%rax
+  802ac3:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  802ac7:	89 d0                	mov    %edx,%eax
+  802ac9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802acd:	c9                   	leave
+  802ace:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  802acf:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802ad3:	75 e3                	jne    802ab8 <argnext+0x78>
+    args->curarg = 0;
+  802ad5:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802adc:	00 
+    return -1;
+  802add:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802ae2:	eb e3                	jmp    802ac7 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  802ae4:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  802ae9:	89 d0                	mov    %edx,%eax
+  802aeb:	c3                   	ret
+
+0000000000802aec <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  802aec:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802af0:	48 85 c0             	test   %rax,%rax
+  802af3:	74 7b                	je     802b70 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  802af5:	55                   	push   %rbp
+  802af6:	48 89 e5             	mov    %rsp,%rbp
+  802af9:	53                   	push   %rbx
+  802afa:	48 83 ec 08          	sub    $0x8,%rsp
+  802afe:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  802b01:	80 38 00             	cmpb   $0x0,(%rax)
+  802b04:	74 1c                	je     802b22 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  802b06:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  802b0a:	48 b8 04 60 80 00 00 	movabs $0x806004,%rax
+  802b11:	00 00 00 
+  802b14:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  802b18:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  802b1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b20:	c9                   	leave
+  802b21:	c3                   	ret
+    } else if (*args->argc > 1) {
+  802b22:	48 8b 07             	mov    (%rdi),%rax
+  802b25:	83 38 01             	cmpl   $0x1,(%rax)
+  802b28:	7f 12                	jg     802b3c <argnextvalue+0x50>
+        args->argvalue = 0;
+  802b2a:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802b31:	00 
+        args->curarg = 0;
+  802b32:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  802b39:	00 
+  802b3a:	eb dc                	jmp    802b18 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  802b3c:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802b40:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802b44:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802b48:	8b 10                	mov    (%rax),%edx
+  802b4a:	83 ea 01             	sub    $0x1,%edx
+  802b4d:	48 63 d2             	movslq %edx,%rdx
+  802b50:	48 c1 e2 03          	shl    $0x3,%rdx
+  802b54:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  802b58:	48 83 c7 08          	add    $0x8,%rdi
+  802b5c:	48 b8 d3 19 80 00 00 	movabs $0x8019d3,%rax
+  802b63:	00 00 00 
+  802b66:	ff d0                	call   *%rax
+        (*args->argc)--;
+  802b68:	48 8b 03             	mov    (%rbx),%rax
+  802b6b:	83 28 01             	subl   $0x1,(%rax)
+  802b6e:	eb a8                	jmp    802b18 <argnextvalue+0x2c>
+}
+  802b70:	c3                   	ret
+
+0000000000802b71 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802b71:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  802b75:	48 85 c0             	test   %rax,%rax
+  802b78:	74 01                	je     802b7b <argvalue+0xa>
+}
+  802b7a:	c3                   	ret
+argvalue(struct Argstate *args) {
+  802b7b:	55                   	push   %rbp
+  802b7c:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802b7f:	48 b8 ec 2a 80 00 00 	movabs $0x802aec,%rax
+  802b86:	00 00 00 
+  802b89:	ff d0                	call   *%rax
+}
+  802b8b:	5d                   	pop    %rbp
+  802b8c:	c3                   	ret
+
+0000000000802b8d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802b8d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802b94:	ff ff ff 
+  802b97:	48 01 f8             	add    %rdi,%rax
+  802b9a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802b9e:	c3                   	ret
+
+0000000000802b9f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802b9f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802ba6:	ff ff ff 
+  802ba9:	48 01 f8             	add    %rdi,%rax
+  802bac:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802bb0:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802bb6:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802bba:	c3                   	ret
+
+0000000000802bbb <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802bbb:	55                   	push   %rbp
+  802bbc:	48 89 e5             	mov    %rsp,%rbp
+  802bbf:	41 57                	push   %r15
+  802bc1:	41 56                	push   %r14
+  802bc3:	41 55                	push   %r13
+  802bc5:	41 54                	push   %r12
+  802bc7:	53                   	push   %rbx
+  802bc8:	48 83 ec 08          	sub    $0x8,%rsp
+  802bcc:	49 89 ff             	mov    %rdi,%r15
+  802bcf:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802bd4:	49 bd 77 55 80 00 00 	movabs $0x805577,%r13
+  802bdb:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802bde:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802be4:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802be7:	48 89 df             	mov    %rbx,%rdi
+  802bea:	41 ff d5             	call   *%r13
+  802bed:	83 e0 04             	and    $0x4,%eax
+  802bf0:	74 17                	je     802c09 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802bf2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802bf9:	4c 39 f3             	cmp    %r14,%rbx
+  802bfc:	75 e6                	jne    802be4 <fd_alloc+0x29>
+  802bfe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802c04:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802c09:	4d 89 27             	mov    %r12,(%r15)
+}
+  802c0c:	48 83 c4 08          	add    $0x8,%rsp
+  802c10:	5b                   	pop    %rbx
+  802c11:	41 5c                	pop    %r12
+  802c13:	41 5d                	pop    %r13
+  802c15:	41 5e                	pop    %r14
+  802c17:	41 5f                	pop    %r15
+  802c19:	5d                   	pop    %rbp
+  802c1a:	c3                   	ret
+
+0000000000802c1b <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802c1b:	83 ff 1f             	cmp    $0x1f,%edi
+  802c1e:	77 39                	ja     802c59 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802c20:	55                   	push   %rbp
+  802c21:	48 89 e5             	mov    %rsp,%rbp
+  802c24:	41 54                	push   %r12
+  802c26:	53                   	push   %rbx
+  802c27:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802c2a:	48 63 df             	movslq %edi,%rbx
+  802c2d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802c34:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802c38:	48 89 df             	mov    %rbx,%rdi
+  802c3b:	48 b8 77 55 80 00 00 	movabs $0x805577,%rax
+  802c42:	00 00 00 
+  802c45:	ff d0                	call   *%rax
+  802c47:	a8 04                	test   $0x4,%al
+  802c49:	74 14                	je     802c5f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802c4b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c54:	5b                   	pop    %rbx
+  802c55:	41 5c                	pop    %r12
+  802c57:	5d                   	pop    %rbp
+  802c58:	c3                   	ret
+        return -E_INVAL;
+  802c59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c5e:	c3                   	ret
+        return -E_INVAL;
+  802c5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c64:	eb ee                	jmp    802c54 <fd_lookup+0x39>
+
+0000000000802c66 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802c66:	55                   	push   %rbp
+  802c67:	48 89 e5             	mov    %rsp,%rbp
+  802c6a:	41 54                	push   %r12
+  802c6c:	53                   	push   %rbx
+  802c6d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802c70:	48 b8 00 68 80 00 00 	movabs $0x806800,%rax
+  802c77:	00 00 00 
+  802c7a:	48 bb 60 70 80 00 00 	movabs $0x807060,%rbx
+  802c81:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802c84:	39 3b                	cmp    %edi,(%rbx)
+  802c86:	74 47                	je     802ccf <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802c88:	48 83 c0 08          	add    $0x8,%rax
+  802c8c:	48 8b 18             	mov    (%rax),%rbx
+  802c8f:	48 85 db             	test   %rbx,%rbx
+  802c92:	75 f0                	jne    802c84 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802c94:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  802c9b:	00 00 00 
+  802c9e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802ca4:	89 fa                	mov    %edi,%edx
+  802ca6:	48 bf 80 67 80 00 00 	movabs $0x806780,%rdi
+  802cad:	00 00 00 
+  802cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb5:	48 b9 cd 0c 80 00 00 	movabs $0x800ccd,%rcx
+  802cbc:	00 00 00 
+  802cbf:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802cc1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802cc6:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802cca:	5b                   	pop    %rbx
+  802ccb:	41 5c                	pop    %r12
+  802ccd:	5d                   	pop    %rbp
+  802cce:	c3                   	ret
+            return 0;
+  802ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd4:	eb f0                	jmp    802cc6 <dev_lookup+0x60>
+
+0000000000802cd6 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802cd6:	55                   	push   %rbp
+  802cd7:	48 89 e5             	mov    %rsp,%rbp
+  802cda:	41 55                	push   %r13
+  802cdc:	41 54                	push   %r12
+  802cde:	53                   	push   %rbx
+  802cdf:	48 83 ec 18          	sub    $0x18,%rsp
+  802ce3:	48 89 fb             	mov    %rdi,%rbx
+  802ce6:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ce9:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802cf0:	ff ff ff 
+  802cf3:	48 01 df             	add    %rbx,%rdi
+  802cf6:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802cfa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802cfe:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  802d05:	00 00 00 
+  802d08:	ff d0                	call   *%rax
+  802d0a:	41 89 c5             	mov    %eax,%r13d
+  802d0d:	85 c0                	test   %eax,%eax
+  802d0f:	78 06                	js     802d17 <fd_close+0x41>
+  802d11:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802d15:	74 1a                	je     802d31 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802d17:	45 84 e4             	test   %r12b,%r12b
+  802d1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1f:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802d23:	44 89 e8             	mov    %r13d,%eax
+  802d26:	48 83 c4 18          	add    $0x18,%rsp
+  802d2a:	5b                   	pop    %rbx
+  802d2b:	41 5c                	pop    %r12
+  802d2d:	41 5d                	pop    %r13
+  802d2f:	5d                   	pop    %rbp
+  802d30:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802d31:	8b 3b                	mov    (%rbx),%edi
+  802d33:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802d37:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  802d3e:	00 00 00 
+  802d41:	ff d0                	call   *%rax
+  802d43:	41 89 c5             	mov    %eax,%r13d
+  802d46:	85 c0                	test   %eax,%eax
+  802d48:	78 1b                	js     802d65 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802d4a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d4e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802d52:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802d58:	48 85 c0             	test   %rax,%rax
+  802d5b:	74 08                	je     802d65 <fd_close+0x8f>
+  802d5d:	48 89 df             	mov    %rbx,%rdi
+  802d60:	ff d0                	call   *%rax
+  802d62:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d65:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d6a:	48 89 de             	mov    %rbx,%rsi
+  802d6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d72:	48 b8 ce 20 80 00 00 	movabs $0x8020ce,%rax
+  802d79:	00 00 00 
+  802d7c:	ff d0                	call   *%rax
+    return res;
+  802d7e:	eb a3                	jmp    802d23 <fd_close+0x4d>
+
+0000000000802d80 <close>:
+
+int
+close(int fdnum) {
+  802d80:	55                   	push   %rbp
+  802d81:	48 89 e5             	mov    %rsp,%rbp
+  802d84:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802d88:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d8c:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  802d93:	00 00 00 
+  802d96:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d98:	85 c0                	test   %eax,%eax
+  802d9a:	78 15                	js     802db1 <close+0x31>
+
+    return fd_close(fd, 1);
+  802d9c:	be 01 00 00 00       	mov    $0x1,%esi
+  802da1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802da5:	48 b8 d6 2c 80 00 00 	movabs $0x802cd6,%rax
+  802dac:	00 00 00 
+  802daf:	ff d0                	call   *%rax
+}
+  802db1:	c9                   	leave
+  802db2:	c3                   	ret
+
+0000000000802db3 <close_all>:
+
+void
+close_all(void) {
+  802db3:	55                   	push   %rbp
+  802db4:	48 89 e5             	mov    %rsp,%rbp
+  802db7:	41 54                	push   %r12
+  802db9:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802dba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dbf:	49 bc 80 2d 80 00 00 	movabs $0x802d80,%r12
+  802dc6:	00 00 00 
+  802dc9:	89 df                	mov    %ebx,%edi
+  802dcb:	41 ff d4             	call   *%r12
+  802dce:	83 c3 01             	add    $0x1,%ebx
+  802dd1:	83 fb 20             	cmp    $0x20,%ebx
+  802dd4:	75 f3                	jne    802dc9 <close_all+0x16>
+}
+  802dd6:	5b                   	pop    %rbx
+  802dd7:	41 5c                	pop    %r12
+  802dd9:	5d                   	pop    %rbp
+  802dda:	c3                   	ret
+
+0000000000802ddb <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802ddb:	55                   	push   %rbp
+  802ddc:	48 89 e5             	mov    %rsp,%rbp
+  802ddf:	41 57                	push   %r15
+  802de1:	41 56                	push   %r14
+  802de3:	41 55                	push   %r13
+  802de5:	41 54                	push   %r12
+  802de7:	53                   	push   %rbx
+  802de8:	48 83 ec 18          	sub    $0x18,%rsp
+  802dec:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802def:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802df3:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  802dfa:	00 00 00 
+  802dfd:	ff d0                	call   *%rax
+  802dff:	89 c3                	mov    %eax,%ebx
+  802e01:	85 c0                	test   %eax,%eax
+  802e03:	0f 88 b8 00 00 00    	js     802ec1 <dup+0xe6>
+    close(newfdnum);
+  802e09:	44 89 e7             	mov    %r12d,%edi
+  802e0c:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  802e13:	00 00 00 
+  802e16:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802e18:	4d 63 ec             	movslq %r12d,%r13
+  802e1b:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802e22:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802e26:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802e2a:	4c 89 ff             	mov    %r15,%rdi
+  802e2d:	49 be 9f 2b 80 00 00 	movabs $0x802b9f,%r14
+  802e34:	00 00 00 
+  802e37:	41 ff d6             	call   *%r14
+  802e3a:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802e3d:	4c 89 ef             	mov    %r13,%rdi
+  802e40:	41 ff d6             	call   *%r14
+  802e43:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802e46:	48 89 df             	mov    %rbx,%rdi
+  802e49:	48 b8 77 55 80 00 00 	movabs $0x805577,%rax
+  802e50:	00 00 00 
+  802e53:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802e55:	a8 04                	test   $0x4,%al
+  802e57:	74 2b                	je     802e84 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802e59:	41 89 c1             	mov    %eax,%r9d
+  802e5c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802e62:	4c 89 f1             	mov    %r14,%rcx
+  802e65:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e6a:	48 89 de             	mov    %rbx,%rsi
+  802e6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e72:	48 b8 56 1f 80 00 00 	movabs $0x801f56,%rax
+  802e79:	00 00 00 
+  802e7c:	ff d0                	call   *%rax
+  802e7e:	89 c3                	mov    %eax,%ebx
+  802e80:	85 c0                	test   %eax,%eax
+  802e82:	78 4e                	js     802ed2 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802e84:	4c 89 ff             	mov    %r15,%rdi
+  802e87:	48 b8 77 55 80 00 00 	movabs $0x805577,%rax
+  802e8e:	00 00 00 
+  802e91:	ff d0                	call   *%rax
+  802e93:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802e96:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802e9c:	4c 89 e9             	mov    %r13,%rcx
+  802e9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea4:	4c 89 fe             	mov    %r15,%rsi
+  802ea7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eac:	48 b8 56 1f 80 00 00 	movabs $0x801f56,%rax
+  802eb3:	00 00 00 
+  802eb6:	ff d0                	call   *%rax
+  802eb8:	89 c3                	mov    %eax,%ebx
+  802eba:	85 c0                	test   %eax,%eax
+  802ebc:	78 14                	js     802ed2 <dup+0xf7>
+
+    return newfdnum;
+  802ebe:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802ec1:	89 d8                	mov    %ebx,%eax
+  802ec3:	48 83 c4 18          	add    $0x18,%rsp
+  802ec7:	5b                   	pop    %rbx
+  802ec8:	41 5c                	pop    %r12
+  802eca:	41 5d                	pop    %r13
+  802ecc:	41 5e                	pop    %r14
+  802ece:	41 5f                	pop    %r15
+  802ed0:	5d                   	pop    %rbp
+  802ed1:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802ed2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ed7:	4c 89 ee             	mov    %r13,%rsi
+  802eda:	bf 00 00 00 00       	mov    $0x0,%edi
+  802edf:	49 bc ce 20 80 00 00 	movabs $0x8020ce,%r12
+  802ee6:	00 00 00 
+  802ee9:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802eec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ef1:	4c 89 f6             	mov    %r14,%rsi
+  802ef4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef9:	41 ff d4             	call   *%r12
+    return res;
+  802efc:	eb c3                	jmp    802ec1 <dup+0xe6>
+
+0000000000802efe <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802efe:	55                   	push   %rbp
+  802eff:	48 89 e5             	mov    %rsp,%rbp
+  802f02:	41 56                	push   %r14
+  802f04:	41 55                	push   %r13
+  802f06:	41 54                	push   %r12
+  802f08:	53                   	push   %rbx
+  802f09:	48 83 ec 10          	sub    $0x10,%rsp
+  802f0d:	89 fb                	mov    %edi,%ebx
+  802f0f:	49 89 f4             	mov    %rsi,%r12
+  802f12:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802f15:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f19:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  802f20:	00 00 00 
+  802f23:	ff d0                	call   *%rax
+  802f25:	85 c0                	test   %eax,%eax
+  802f27:	78 4c                	js     802f75 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802f29:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802f2d:	41 8b 3e             	mov    (%r14),%edi
+  802f30:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f34:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  802f3b:	00 00 00 
+  802f3e:	ff d0                	call   *%rax
+  802f40:	85 c0                	test   %eax,%eax
+  802f42:	78 35                	js     802f79 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802f44:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802f48:	83 e0 03             	and    $0x3,%eax
+  802f4b:	83 f8 01             	cmp    $0x1,%eax
+  802f4e:	74 2d                	je     802f7d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802f50:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f54:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802f58:	48 85 c0             	test   %rax,%rax
+  802f5b:	74 56                	je     802fb3 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802f5d:	4c 89 ea             	mov    %r13,%rdx
+  802f60:	4c 89 e6             	mov    %r12,%rsi
+  802f63:	4c 89 f7             	mov    %r14,%rdi
+  802f66:	ff d0                	call   *%rax
+}
+  802f68:	48 83 c4 10          	add    $0x10,%rsp
+  802f6c:	5b                   	pop    %rbx
+  802f6d:	41 5c                	pop    %r12
+  802f6f:	41 5d                	pop    %r13
+  802f71:	41 5e                	pop    %r14
+  802f73:	5d                   	pop    %rbp
+  802f74:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802f75:	48 98                	cltq
+  802f77:	eb ef                	jmp    802f68 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802f79:	48 98                	cltq
+  802f7b:	eb eb                	jmp    802f68 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802f7d:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  802f84:	00 00 00 
+  802f87:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802f8d:	89 da                	mov    %ebx,%edx
+  802f8f:	48 bf c1 67 80 00 00 	movabs $0x8067c1,%rdi
+  802f96:	00 00 00 
+  802f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9e:	48 b9 cd 0c 80 00 00 	movabs $0x800ccd,%rcx
+  802fa5:	00 00 00 
+  802fa8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802faa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802fb1:	eb b5                	jmp    802f68 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802fb3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802fba:	eb ac                	jmp    802f68 <read+0x6a>
+
+0000000000802fbc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802fbc:	55                   	push   %rbp
+  802fbd:	48 89 e5             	mov    %rsp,%rbp
+  802fc0:	41 57                	push   %r15
+  802fc2:	41 56                	push   %r14
+  802fc4:	41 55                	push   %r13
+  802fc6:	41 54                	push   %r12
+  802fc8:	53                   	push   %rbx
+  802fc9:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802fcd:	48 85 d2             	test   %rdx,%rdx
+  802fd0:	74 54                	je     803026 <readn+0x6a>
+  802fd2:	41 89 fd             	mov    %edi,%r13d
+  802fd5:	49 89 f6             	mov    %rsi,%r14
+  802fd8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802fdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802fe0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802fe5:	49 bf fe 2e 80 00 00 	movabs $0x802efe,%r15
+  802fec:	00 00 00 
+  802fef:	4c 89 e2             	mov    %r12,%rdx
+  802ff2:	48 29 f2             	sub    %rsi,%rdx
+  802ff5:	4c 01 f6             	add    %r14,%rsi
+  802ff8:	44 89 ef             	mov    %r13d,%edi
+  802ffb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802ffe:	85 c0                	test   %eax,%eax
+  803000:	78 20                	js     803022 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803002:	01 c3                	add    %eax,%ebx
+  803004:	85 c0                	test   %eax,%eax
+  803006:	74 08                	je     803010 <readn+0x54>
+  803008:	48 63 f3             	movslq %ebx,%rsi
+  80300b:	4c 39 e6             	cmp    %r12,%rsi
+  80300e:	72 df                	jb     802fef <readn+0x33>
+    }
+    return res;
+  803010:	48 63 c3             	movslq %ebx,%rax
+}
+  803013:	48 83 c4 08          	add    $0x8,%rsp
+  803017:	5b                   	pop    %rbx
+  803018:	41 5c                	pop    %r12
+  80301a:	41 5d                	pop    %r13
+  80301c:	41 5e                	pop    %r14
+  80301e:	41 5f                	pop    %r15
+  803020:	5d                   	pop    %rbp
+  803021:	c3                   	ret
+        if (inc < 0) return inc;
+  803022:	48 98                	cltq
+  803024:	eb ed                	jmp    803013 <readn+0x57>
+    int inc = 1, res = 0;
+  803026:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80302b:	eb e3                	jmp    803010 <readn+0x54>
+
+000000000080302d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80302d:	55                   	push   %rbp
+  80302e:	48 89 e5             	mov    %rsp,%rbp
+  803031:	41 56                	push   %r14
+  803033:	41 55                	push   %r13
+  803035:	41 54                	push   %r12
+  803037:	53                   	push   %rbx
+  803038:	48 83 ec 10          	sub    $0x10,%rsp
+  80303c:	89 fb                	mov    %edi,%ebx
+  80303e:	49 89 f4             	mov    %rsi,%r12
+  803041:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803044:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803048:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  80304f:	00 00 00 
+  803052:	ff d0                	call   *%rax
+  803054:	85 c0                	test   %eax,%eax
+  803056:	78 47                	js     80309f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803058:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80305c:	41 8b 3e             	mov    (%r14),%edi
+  80305f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803063:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  80306a:	00 00 00 
+  80306d:	ff d0                	call   *%rax
+  80306f:	85 c0                	test   %eax,%eax
+  803071:	78 30                	js     8030a3 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803073:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803078:	74 2d                	je     8030a7 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80307a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80307e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803082:	48 85 c0             	test   %rax,%rax
+  803085:	74 56                	je     8030dd <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803087:	4c 89 ea             	mov    %r13,%rdx
+  80308a:	4c 89 e6             	mov    %r12,%rsi
+  80308d:	4c 89 f7             	mov    %r14,%rdi
+  803090:	ff d0                	call   *%rax
+}
+  803092:	48 83 c4 10          	add    $0x10,%rsp
+  803096:	5b                   	pop    %rbx
+  803097:	41 5c                	pop    %r12
+  803099:	41 5d                	pop    %r13
+  80309b:	41 5e                	pop    %r14
+  80309d:	5d                   	pop    %rbp
+  80309e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80309f:	48 98                	cltq
+  8030a1:	eb ef                	jmp    803092 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8030a3:	48 98                	cltq
+  8030a5:	eb eb                	jmp    803092 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8030a7:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  8030ae:	00 00 00 
+  8030b1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8030b7:	89 da                	mov    %ebx,%edx
+  8030b9:	48 bf dd 67 80 00 00 	movabs $0x8067dd,%rdi
+  8030c0:	00 00 00 
+  8030c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c8:	48 b9 cd 0c 80 00 00 	movabs $0x800ccd,%rcx
+  8030cf:	00 00 00 
+  8030d2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8030d4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8030db:	eb b5                	jmp    803092 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8030dd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8030e4:	eb ac                	jmp    803092 <write+0x65>
+
+00000000008030e6 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8030e6:	55                   	push   %rbp
+  8030e7:	48 89 e5             	mov    %rsp,%rbp
+  8030ea:	53                   	push   %rbx
+  8030eb:	48 83 ec 18          	sub    $0x18,%rsp
+  8030ef:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8030f1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8030f5:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  8030fc:	00 00 00 
+  8030ff:	ff d0                	call   *%rax
+  803101:	85 c0                	test   %eax,%eax
+  803103:	78 0c                	js     803111 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803105:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803109:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80310c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803111:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803115:	c9                   	leave
+  803116:	c3                   	ret
+
+0000000000803117 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  803117:	55                   	push   %rbp
+  803118:	48 89 e5             	mov    %rsp,%rbp
+  80311b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80311f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803123:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  80312a:	00 00 00 
+  80312d:	ff d0                	call   *%rax
+  80312f:	85 c0                	test   %eax,%eax
+  803131:	78 07                	js     80313a <tell+0x23>
+    return fdes->fd_offset;
+  803133:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803137:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80313a:	c9                   	leave
+  80313b:	c3                   	ret
+
+000000000080313c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80313c:	55                   	push   %rbp
+  80313d:	48 89 e5             	mov    %rsp,%rbp
+  803140:	41 55                	push   %r13
+  803142:	41 54                	push   %r12
+  803144:	53                   	push   %rbx
+  803145:	48 83 ec 18          	sub    $0x18,%rsp
+  803149:	89 fb                	mov    %edi,%ebx
+  80314b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80314e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803152:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  803159:	00 00 00 
+  80315c:	ff d0                	call   *%rax
+  80315e:	85 c0                	test   %eax,%eax
+  803160:	78 38                	js     80319a <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803162:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803166:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80316a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80316e:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  803175:	00 00 00 
+  803178:	ff d0                	call   *%rax
+  80317a:	85 c0                	test   %eax,%eax
+  80317c:	78 1c                	js     80319a <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80317e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803183:	74 20                	je     8031a5 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803185:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803189:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80318d:	48 85 c0             	test   %rax,%rax
+  803190:	74 47                	je     8031d9 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803192:	44 89 e6             	mov    %r12d,%esi
+  803195:	4c 89 ef             	mov    %r13,%rdi
+  803198:	ff d0                	call   *%rax
+}
+  80319a:	48 83 c4 18          	add    $0x18,%rsp
+  80319e:	5b                   	pop    %rbx
+  80319f:	41 5c                	pop    %r12
+  8031a1:	41 5d                	pop    %r13
+  8031a3:	5d                   	pop    %rbp
+  8031a4:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8031a5:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  8031ac:	00 00 00 
+  8031af:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8031b5:	89 da                	mov    %ebx,%edx
+  8031b7:	48 bf a0 67 80 00 00 	movabs $0x8067a0,%rdi
+  8031be:	00 00 00 
+  8031c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c6:	48 b9 cd 0c 80 00 00 	movabs $0x800ccd,%rcx
+  8031cd:	00 00 00 
+  8031d0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031d7:	eb c1                	jmp    80319a <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8031d9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8031de:	eb ba                	jmp    80319a <ftruncate+0x5e>
+
+00000000008031e0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8031e0:	55                   	push   %rbp
+  8031e1:	48 89 e5             	mov    %rsp,%rbp
+  8031e4:	41 54                	push   %r12
+  8031e6:	53                   	push   %rbx
+  8031e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8031eb:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8031ee:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8031f2:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  8031f9:	00 00 00 
+  8031fc:	ff d0                	call   *%rax
+  8031fe:	85 c0                	test   %eax,%eax
+  803200:	78 4e                	js     803250 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803202:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803206:	41 8b 3c 24          	mov    (%r12),%edi
+  80320a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80320e:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  803215:	00 00 00 
+  803218:	ff d0                	call   *%rax
+  80321a:	85 c0                	test   %eax,%eax
+  80321c:	78 32                	js     803250 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80321e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803222:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803227:	74 30                	je     803259 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  803229:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80322c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803233:	00 00 00 
+    stat->st_isdir = 0;
+  803236:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80323d:	00 00 00 
+    stat->st_dev = dev;
+  803240:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803247:	48 89 de             	mov    %rbx,%rsi
+  80324a:	4c 89 e7             	mov    %r12,%rdi
+  80324d:	ff 50 28             	call   *0x28(%rax)
+}
+  803250:	48 83 c4 10          	add    $0x10,%rsp
+  803254:	5b                   	pop    %rbx
+  803255:	41 5c                	pop    %r12
+  803257:	5d                   	pop    %rbp
+  803258:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803259:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80325e:	eb f0                	jmp    803250 <fstat+0x70>
+
+0000000000803260 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  803260:	55                   	push   %rbp
+  803261:	48 89 e5             	mov    %rsp,%rbp
+  803264:	41 54                	push   %r12
+  803266:	53                   	push   %rbx
+  803267:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80326e:	41 89 fc             	mov    %edi,%r12d
+  803271:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803273:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803277:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  80327e:	00 00 00 
+  803281:	ff d0                	call   *%rax
+  803283:	85 c0                	test   %eax,%eax
+  803285:	78 31                	js     8032b8 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  803287:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80328e:	44 89 e7             	mov    %r12d,%edi
+  803291:	48 b8 e0 31 80 00 00 	movabs $0x8031e0,%rax
+  803298:	00 00 00 
+  80329b:	ff d0                	call   *%rax
+  80329d:	85 c0                	test   %eax,%eax
+  80329f:	78 17                	js     8032b8 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8032a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032a5:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8032a8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8032ab:	39 d3                	cmp    %edx,%ebx
+  8032ad:	0f 4f da             	cmovg  %edx,%ebx
+  8032b0:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8032b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032b8:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8032bf:	5b                   	pop    %rbx
+  8032c0:	41 5c                	pop    %r12
+  8032c2:	5d                   	pop    %rbp
+  8032c3:	c3                   	ret
+
+00000000008032c4 <seektoend>:
+{
+  8032c4:	55                   	push   %rbp
+  8032c5:	48 89 e5             	mov    %rsp,%rbp
+  8032c8:	53                   	push   %rbx
+  8032c9:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8032d0:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8032d2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8032d6:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  8032dd:	00 00 00 
+  8032e0:	ff d0                	call   *%rax
+  8032e2:	85 c0                	test   %eax,%eax
+  8032e4:	78 28                	js     80330e <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8032e6:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8032ed:	89 df                	mov    %ebx,%edi
+  8032ef:	48 b8 e0 31 80 00 00 	movabs $0x8031e0,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+  8032fb:	85 c0                	test   %eax,%eax
+  8032fd:	78 0f                	js     80330e <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8032ff:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803302:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803306:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  803309:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80330e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803312:	c9                   	leave
+  803313:	c3                   	ret
+
+0000000000803314 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803314:	55                   	push   %rbp
+  803315:	48 89 e5             	mov    %rsp,%rbp
+  803318:	41 54                	push   %r12
+  80331a:	53                   	push   %rbx
+  80331b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80331e:	be 00 00 00 00       	mov    $0x0,%esi
+  803323:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  80332a:	00 00 00 
+  80332d:	ff d0                	call   *%rax
+  80332f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803331:	85 c0                	test   %eax,%eax
+  803333:	78 25                	js     80335a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803335:	4c 89 e6             	mov    %r12,%rsi
+  803338:	89 c7                	mov    %eax,%edi
+  80333a:	48 b8 e0 31 80 00 00 	movabs $0x8031e0,%rax
+  803341:	00 00 00 
+  803344:	ff d0                	call   *%rax
+  803346:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803349:	89 df                	mov    %ebx,%edi
+  80334b:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  803352:	00 00 00 
+  803355:	ff d0                	call   *%rax
+
+    return res;
+  803357:	44 89 e3             	mov    %r12d,%ebx
+}
+  80335a:	89 d8                	mov    %ebx,%eax
+  80335c:	5b                   	pop    %rbx
+  80335d:	41 5c                	pop    %r12
+  80335f:	5d                   	pop    %rbp
+  803360:	c3                   	ret
+
+0000000000803361 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  803361:	55                   	push   %rbp
+  803362:	48 89 e5             	mov    %rsp,%rbp
+  803365:	53                   	push   %rbx
+  803366:	48 83 ec 08          	sub    $0x8,%rsp
+  80336a:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80336d:	48 b8 8d 2b 80 00 00 	movabs $0x802b8d,%rax
+  803374:	00 00 00 
+  803377:	ff d0                	call   *%rax
+  803379:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80337d:	0f 87 ea 00 00 00    	ja     80346d <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  803383:	48 b8 04 a0 98 00 00 	movabs $0x98a004,%rax
+  80338a:	00 00 00 
+  80338d:	80 38 00             	cmpb   $0x0,(%rax)
+  803390:	75 35                	jne    8033c7 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  803392:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803397:	ba 00 00 22 00       	mov    $0x220000,%edx
+  80339c:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8033a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033a6:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  8033ad:	00 00 00 
+  8033b0:	ff d0                	call   *%rax
+  8033b2:	85 c0                	test   %eax,%eax
+  8033b4:	0f 88 ba 00 00 00    	js     803474 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8033ba:	48 b8 04 a0 98 00 00 	movabs $0x98a004,%rax
+  8033c1:	00 00 00 
+  8033c4:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8033c7:	48 89 df             	mov    %rbx,%rdi
+  8033ca:	48 b8 8d 2b 80 00 00 	movabs $0x802b8d,%rax
+  8033d1:	00 00 00 
+  8033d4:	ff d0                	call   *%rax
+  8033d6:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8033da:	48 ba 20 a0 98 00 00 	movabs $0x98a020,%rdx
+  8033e1:	00 00 00 
+  8033e4:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8033e8:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8033eb:	39 39                	cmp    %edi,(%rcx)
+  8033ed:	74 46                	je     803435 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8033ef:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8033f3:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8033fa:	00 
+  8033fb:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  803402:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  803409:	00 
+  80340a:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  803411:	00 
+  803412:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  803419:	00 
+  80341a:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  803421:	00 
+  803422:	89 39                	mov    %edi,(%rcx)
+  803424:	48 01 c6             	add    %rax,%rsi
+  803427:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  80342c:	48 89 c8             	mov    %rcx,%rax
+  80342f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803433:	c9                   	leave
+  803434:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  803435:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  803439:	48 be 20 a0 98 00 00 	movabs $0x98a020,%rsi
+  803440:	00 00 00 
+  803443:	8b 7b 10             	mov    0x10(%rbx),%edi
+  803446:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80344a:	74 e0                	je     80342c <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80344c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  803453:	00 
+  803454:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  803458:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  80345f:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  803461:	8b 7b 10             	mov    0x10(%rbx),%edi
+  803464:	48 01 c2             	add    %rax,%rdx
+  803467:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80346b:	eb bf                	jmp    80342c <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80346d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803472:	eb b8                	jmp    80342c <fbuf_get+0xcb>
+            return NULL;
+  803474:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803479:	eb b1                	jmp    80342c <fbuf_get+0xcb>
+
+000000000080347b <fsipc_bulk>:
+fsipc_bulk(void) {
+  80347b:	55                   	push   %rbp
+  80347c:	48 89 e5             	mov    %rsp,%rbp
+  80347f:	53                   	push   %rbx
+  803480:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  803484:	48 b8 20 a5 98 00 00 	movabs $0x98a520,%rax
+  80348b:	00 00 00 
+  80348e:	48 8b 18             	mov    (%rax),%rbx
+  803491:	48 85 db             	test   %rbx,%rbx
+  803494:	74 16                	je     8034ac <fsipc_bulk+0x31>
+    return fsipcbulk;
+  803496:	48 b8 20 a5 98 00 00 	movabs $0x98a520,%rax
+  80349d:	00 00 00 
+  8034a0:	48 8b 18             	mov    (%rax),%rbx
+}
+  8034a3:	48 89 d8             	mov    %rbx,%rax
+  8034a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034aa:	c9                   	leave
+  8034ab:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8034ac:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8034b1:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8034b6:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8034bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c0:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  8034c7:	00 00 00 
+  8034ca:	ff d0                	call   *%rax
+  8034cc:	85 c0                	test   %eax,%eax
+  8034ce:	78 d3                	js     8034a3 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8034d0:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8034d5:	48 a3 20 a5 98 00 00 	movabs %rax,0x98a520
+  8034dc:	00 00 00 
+  8034df:	eb b5                	jmp    803496 <fsipc_bulk+0x1b>
+
+00000000008034e1 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8034e1:	55                   	push   %rbp
+  8034e2:	48 89 e5             	mov    %rsp,%rbp
+  8034e5:	41 57                	push   %r15
+  8034e7:	41 56                	push   %r14
+  8034e9:	41 55                	push   %r13
+  8034eb:	41 54                	push   %r12
+  8034ed:	53                   	push   %rbx
+  8034ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8034f2:	41 89 fd             	mov    %edi,%r13d
+  8034f5:	49 89 f6             	mov    %rsi,%r14
+  8034f8:	49 89 d7             	mov    %rdx,%r15
+  8034fb:	48 89 cb             	mov    %rcx,%rbx
+  8034fe:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803501:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  803508:	00 00 00 
+  80350b:	83 38 00             	cmpl   $0x0,(%rax)
+  80350e:	74 52                	je     803562 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  803510:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803516:	4c 89 f9             	mov    %r15,%rcx
+  803519:	4c 89 f2             	mov    %r14,%rdx
+  80351c:	44 89 ee             	mov    %r13d,%esi
+  80351f:	48 b8 00 a0 98 00 00 	movabs $0x98a000,%rax
+  803526:	00 00 00 
+  803529:	8b 38                	mov    (%rax),%edi
+  80352b:	48 b8 a3 58 80 00 00 	movabs $0x8058a3,%rax
+  803532:	00 00 00 
+  803535:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  803537:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80353c:	4c 89 e2             	mov    %r12,%rdx
+  80353f:	48 89 de             	mov    %rbx,%rsi
+  803542:	bf 00 00 00 00       	mov    $0x0,%edi
+  803547:	48 b8 f3 56 80 00 00 	movabs $0x8056f3,%rax
+  80354e:	00 00 00 
+  803551:	ff d0                	call   *%rax
+}
+  803553:	48 83 c4 08          	add    $0x8,%rsp
+  803557:	5b                   	pop    %rbx
+  803558:	41 5c                	pop    %r12
+  80355a:	41 5d                	pop    %r13
+  80355c:	41 5e                	pop    %r14
+  80355e:	41 5f                	pop    %r15
+  803560:	5d                   	pop    %rbp
+  803561:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803562:	bf 03 00 00 00       	mov    $0x3,%edi
+  803567:	48 b8 46 59 80 00 00 	movabs $0x805946,%rax
+  80356e:	00 00 00 
+  803571:	ff d0                	call   *%rax
+  803573:	a3 00 a0 98 00 00 00 	movabs %eax,0x98a000
+  80357a:	00 00 
+  80357c:	eb 92                	jmp    803510 <fsipc_region+0x2f>
+
+000000000080357e <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80357e:	55                   	push   %rbp
+  80357f:	48 89 e5             	mov    %rsp,%rbp
+  803582:	41 57                	push   %r15
+  803584:	41 56                	push   %r14
+  803586:	41 55                	push   %r13
+  803588:	41 54                	push   %r12
+  80358a:	53                   	push   %rbx
+  80358b:	48 83 ec 28          	sub    $0x28,%rsp
+  80358f:	49 89 ff             	mov    %rdi,%r15
+  803592:	49 89 f6             	mov    %rsi,%r14
+  803595:	48 89 d3             	mov    %rdx,%rbx
+  803598:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80359c:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  80359f:	48 b8 7b 34 80 00 00 	movabs $0x80347b,%rax
+  8035a6:	00 00 00 
+  8035a9:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8035ab:	48 85 c0             	test   %rax,%rax
+  8035ae:	0f 84 cc 00 00 00    	je     803680 <devfile_write_direct+0x102>
+  8035b4:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8035b7:	48 85 db             	test   %rbx,%rbx
+  8035ba:	0f 84 ba 00 00 00    	je     80367a <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8035c0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8035c6:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8035cd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8035d1:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8035d5:	4c 29 e3             	sub    %r12,%rbx
+  8035d8:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8035dd:	48 39 c3             	cmp    %rax,%rbx
+  8035e0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8035e4:	48 89 da             	mov    %rbx,%rdx
+  8035e7:	4c 89 f6             	mov    %r14,%rsi
+  8035ea:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8035ee:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  8035f5:	00 00 00 
+  8035f8:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8035fa:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8035fe:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  803602:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803605:	44 01 e0             	add    %r12d,%eax
+  803608:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  80360c:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  803610:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  803617:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80361e:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  803625:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80362b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803630:	4c 89 ee             	mov    %r13,%rsi
+  803633:	bf 04 00 00 00       	mov    $0x4,%edi
+  803638:	48 b8 e1 34 80 00 00 	movabs $0x8034e1,%rax
+  80363f:	00 00 00 
+  803642:	ff d0                	call   *%rax
+        if (res < 0)
+  803644:	85 c0                	test   %eax,%eax
+  803646:	78 29                	js     803671 <devfile_write_direct+0xf3>
+        if (res == 0)
+  803648:	74 2b                	je     803675 <devfile_write_direct+0xf7>
+        i += res;
+  80364a:	48 98                	cltq
+  80364c:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  80364f:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  803652:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803656:	49 39 c4             	cmp    %rax,%r12
+  803659:	0f 82 72 ff ff ff    	jb     8035d1 <devfile_write_direct+0x53>
+    return i;
+  80365f:	4c 89 e0             	mov    %r12,%rax
+}
+  803662:	48 83 c4 28          	add    $0x28,%rsp
+  803666:	5b                   	pop    %rbx
+  803667:	41 5c                	pop    %r12
+  803669:	41 5d                	pop    %r13
+  80366b:	41 5e                	pop    %r14
+  80366d:	41 5f                	pop    %r15
+  80366f:	5d                   	pop    %rbp
+  803670:	c3                   	ret
+            return res;
+  803671:	48 98                	cltq
+  803673:	eb ed                	jmp    803662 <devfile_write_direct+0xe4>
+            return i;
+  803675:	4c 89 e0             	mov    %r12,%rax
+  803678:	eb e8                	jmp    803662 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80367a:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  80367e:	eb df                	jmp    80365f <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  803680:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  803687:	eb d9                	jmp    803662 <devfile_write_direct+0xe4>
+
+0000000000803689 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  803689:	55                   	push   %rbp
+  80368a:	48 89 e5             	mov    %rsp,%rbp
+  80368d:	41 56                	push   %r14
+  80368f:	41 55                	push   %r13
+  803691:	41 54                	push   %r12
+  803693:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  803694:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  803698:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  80369c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a1:	4d 39 ee             	cmp    %r13,%r14
+  8036a4:	0f 84 99 00 00 00    	je     803743 <fbuf_flush+0xba>
+  8036aa:	49 89 fc             	mov    %rdi,%r12
+  8036ad:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8036b0:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8036b3:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8036b7:	48 b8 8d 2b 80 00 00 	movabs $0x802b8d,%rax
+  8036be:	00 00 00 
+  8036c1:	ff d0                	call   *%rax
+  8036c3:	48 89 c2             	mov    %rax,%rdx
+  8036c6:	48 c1 e2 04          	shl    $0x4,%rdx
+  8036ca:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8036ce:	48 c1 e0 0c          	shl    $0xc,%rax
+  8036d2:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8036d7:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8036da:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8036de:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8036e5:	00 
+  8036e6:	44 89 f1             	mov    %r14d,%ecx
+  8036e9:	4c 89 ea             	mov    %r13,%rdx
+  8036ec:	4c 89 e7             	mov    %r12,%rdi
+  8036ef:	48 b8 7e 35 80 00 00 	movabs $0x80357e,%rax
+  8036f6:	00 00 00 
+  8036f9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036fb:	48 85 c0             	test   %rax,%rax
+  8036fe:	78 43                	js     803743 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  803700:	4c 39 e8             	cmp    %r13,%rax
+  803703:	72 47                	jb     80374c <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  803705:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80370a:	83 c0 01             	add    $0x1,%eax
+  80370d:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803712:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  803715:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  803719:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  80371d:	72 0f                	jb     80372e <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  80371f:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  803723:	48 39 c2             	cmp    %rax,%rdx
+  803726:	48 0f 42 d0          	cmovb  %rax,%rdx
+  80372a:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  80372e:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  803735:	00 
+  803736:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  80373d:	00 
+    return 0;
+  80373e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803743:	5b                   	pop    %rbx
+  803744:	41 5c                	pop    %r12
+  803746:	41 5d                	pop    %r13
+  803748:	41 5e                	pop    %r14
+  80374a:	5d                   	pop    %rbp
+  80374b:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  80374c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803751:	eb f0                	jmp    803743 <fbuf_flush+0xba>
+
+0000000000803753 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  803753:	55                   	push   %rbp
+  803754:	48 89 e5             	mov    %rsp,%rbp
+  803757:	53                   	push   %rbx
+  803758:	48 83 ec 08          	sub    $0x8,%rsp
+  80375c:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  80375f:	48 b8 61 33 80 00 00 	movabs $0x803361,%rax
+  803766:	00 00 00 
+  803769:	ff d0                	call   *%rax
+  80376b:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  80376e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803773:	48 85 f6             	test   %rsi,%rsi
+  803776:	74 0f                	je     803787 <devfile_sync+0x34>
+  803778:	48 89 df             	mov    %rbx,%rdi
+  80377b:	48 b8 89 36 80 00 00 	movabs $0x803689,%rax
+  803782:	00 00 00 
+  803785:	ff d0                	call   *%rax
+}
+  803787:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80378b:	c9                   	leave
+  80378c:	c3                   	ret
+
+000000000080378d <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  80378d:	55                   	push   %rbp
+  80378e:	48 89 e5             	mov    %rsp,%rbp
+  803791:	48 83 ec 10          	sub    $0x10,%rsp
+  803795:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  803798:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80379f:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8037a0:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8037a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037a9:	48 be 00 90 98 00 00 	movabs $0x989000,%rsi
+  8037b0:	00 00 00 
+  8037b3:	48 b8 e1 34 80 00 00 	movabs $0x8034e1,%rax
+  8037ba:	00 00 00 
+  8037bd:	ff d0                	call   *%rax
+}
+  8037bf:	c9                   	leave
+  8037c0:	c3                   	ret
+
+00000000008037c1 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8037c1:	55                   	push   %rbp
+  8037c2:	48 89 e5             	mov    %rsp,%rbp
+  8037c5:	41 54                	push   %r12
+  8037c7:	53                   	push   %rbx
+  8037c8:	48 89 fb             	mov    %rdi,%rbx
+  8037cb:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8037ce:	48 b8 53 37 80 00 00 	movabs $0x803753,%rax
+  8037d5:	00 00 00 
+  8037d8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037da:	85 c0                	test   %eax,%eax
+  8037dc:	78 63                	js     803841 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8037de:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8037e1:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8037e8:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  8037ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ef:	bf 05 00 00 00       	mov    $0x5,%edi
+  8037f4:	48 b8 8d 37 80 00 00 	movabs $0x80378d,%rax
+  8037fb:	00 00 00 
+  8037fe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803800:	85 c0                	test   %eax,%eax
+  803802:	78 3d                	js     803841 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803804:	48 bb 00 90 98 00 00 	movabs $0x989000,%rbx
+  80380b:	00 00 00 
+  80380e:	48 89 de             	mov    %rbx,%rsi
+  803811:	4c 89 e7             	mov    %r12,%rdi
+  803814:	48 b8 45 16 80 00 00 	movabs $0x801645,%rax
+  80381b:	00 00 00 
+  80381e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803820:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  803826:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  80382d:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80382e:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  803834:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  80383b:	00 
+
+    return 0;
+  80383c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803841:	5b                   	pop    %rbx
+  803842:	41 5c                	pop    %r12
+  803844:	5d                   	pop    %rbp
+  803845:	c3                   	ret
+
+0000000000803846 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803846:	55                   	push   %rbp
+  803847:	48 89 e5             	mov    %rsp,%rbp
+  80384a:	41 54                	push   %r12
+  80384c:	53                   	push   %rbx
+  80384d:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  803850:	48 b8 53 37 80 00 00 	movabs $0x803753,%rax
+  803857:	00 00 00 
+  80385a:	ff d0                	call   *%rax
+  80385c:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  80385f:	48 89 df             	mov    %rbx,%rdi
+  803862:	48 b8 8d 2b 80 00 00 	movabs $0x802b8d,%rax
+  803869:	00 00 00 
+  80386c:	ff d0                	call   *%rax
+  80386e:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803872:	76 2e                	jbe    8038a2 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  803874:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803877:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80387e:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  803880:	be 00 00 00 00       	mov    $0x0,%esi
+  803885:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80388a:	48 b8 8d 37 80 00 00 	movabs $0x80378d,%rax
+  803891:	00 00 00 
+  803894:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  803896:	45 85 e4             	test   %r12d,%r12d
+  803899:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  80389d:	5b                   	pop    %rbx
+  80389e:	41 5c                	pop    %r12
+  8038a0:	5d                   	pop    %rbp
+  8038a1:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8038a2:	48 89 df             	mov    %rbx,%rdi
+  8038a5:	48 b8 8d 2b 80 00 00 	movabs $0x802b8d,%rax
+  8038ac:	00 00 00 
+  8038af:	ff d0                	call   *%rax
+  8038b1:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8038b5:	48 b8 20 a0 98 00 00 	movabs $0x98a020,%rax
+  8038bc:	00 00 00 
+  8038bf:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8038c6:	48 89 df             	mov    %rbx,%rdi
+  8038c9:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  8038d0:	00 00 00 
+  8038d3:	ff d0                	call   *%rax
+  8038d5:	48 89 c6             	mov    %rax,%rsi
+  8038d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038e2:	48 b8 ce 20 80 00 00 	movabs $0x8020ce,%rax
+  8038e9:	00 00 00 
+  8038ec:	ff d0                	call   *%rax
+  8038ee:	eb 84                	jmp    803874 <devfile_flush+0x2e>
+
+00000000008038f0 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8038f0:	55                   	push   %rbp
+  8038f1:	48 89 e5             	mov    %rsp,%rbp
+  8038f4:	41 55                	push   %r13
+  8038f6:	41 54                	push   %r12
+  8038f8:	53                   	push   %rbx
+  8038f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8038fd:	48 89 fb             	mov    %rdi,%rbx
+  803900:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  803903:	48 b8 61 33 80 00 00 	movabs $0x803361,%rax
+  80390a:	00 00 00 
+  80390d:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80390f:	48 85 c0             	test   %rax,%rax
+  803912:	74 51                	je     803965 <devfile_trunc+0x75>
+  803914:	49 89 c4             	mov    %rax,%r12
+  803917:	48 89 c6             	mov    %rax,%rsi
+  80391a:	48 89 df             	mov    %rbx,%rdi
+  80391d:	48 b8 89 36 80 00 00 	movabs $0x803689,%rax
+  803924:	00 00 00 
+  803927:	ff d0                	call   *%rax
+  803929:	85 c0                	test   %eax,%eax
+  80392b:	78 2d                	js     80395a <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80392d:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  803934:	00 00 00 
+  803937:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80393a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80393c:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803940:	be 00 00 00 00       	mov    $0x0,%esi
+  803945:	bf 02 00 00 00       	mov    $0x2,%edi
+  80394a:	48 b8 8d 37 80 00 00 	movabs $0x80378d,%rax
+  803951:	00 00 00 
+  803954:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803956:	85 c0                	test   %eax,%eax
+  803958:	79 3e                	jns    803998 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  80395a:	48 83 c4 08          	add    $0x8,%rsp
+  80395e:	5b                   	pop    %rbx
+  80395f:	41 5c                	pop    %r12
+  803961:	41 5d                	pop    %r13
+  803963:	5d                   	pop    %rbp
+  803964:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803965:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80396c:	00 00 00 
+  80396f:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803972:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803974:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803978:	be 00 00 00 00       	mov    $0x0,%esi
+  80397d:	bf 02 00 00 00       	mov    $0x2,%edi
+  803982:	48 b8 8d 37 80 00 00 	movabs $0x80378d,%rax
+  803989:	00 00 00 
+  80398c:	ff d0                	call   *%rax
+    if (res >= 0) {
+  80398e:	85 c0                	test   %eax,%eax
+  803990:	78 c8                	js     80395a <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803992:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803996:	eb c2                	jmp    80395a <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803998:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  80399b:	8d 51 01             	lea    0x1(%rcx),%edx
+  80399e:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8039a1:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  8039a6:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8039ad:	00 00 
+  8039af:	eb a9                	jmp    80395a <devfile_trunc+0x6a>
+
+00000000008039b1 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8039b1:	55                   	push   %rbp
+  8039b2:	48 89 e5             	mov    %rsp,%rbp
+  8039b5:	41 57                	push   %r15
+  8039b7:	41 56                	push   %r14
+  8039b9:	41 55                	push   %r13
+  8039bb:	41 54                	push   %r12
+  8039bd:	53                   	push   %rbx
+  8039be:	48 83 ec 28          	sub    $0x28,%rsp
+  8039c2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8039c6:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8039ca:	49 89 d7             	mov    %rdx,%r15
+  8039cd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8039d1:	48 b8 61 33 80 00 00 	movabs $0x803361,%rax
+  8039d8:	00 00 00 
+  8039db:	ff d0                	call   *%rax
+  8039dd:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  8039e0:	48 85 c0             	test   %rax,%rax
+  8039e3:	74 31                	je     803a16 <devfile_write+0x65>
+  8039e5:	4c 89 f8             	mov    %r15,%rax
+  8039e8:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  8039ef:	77 25                	ja     803a16 <devfile_write+0x65>
+    size_t i = 0;
+  8039f1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  8039f7:	48 85 c0             	test   %rax,%rax
+  8039fa:	0f 85 64 01 00 00    	jne    803b64 <devfile_write+0x1b3>
+    size_t i = 0;
+  803a00:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  803a04:	4c 89 f8             	mov    %r15,%rax
+}
+  803a07:	48 83 c4 28          	add    $0x28,%rsp
+  803a0b:	5b                   	pop    %rbx
+  803a0c:	41 5c                	pop    %r12
+  803a0e:	41 5d                	pop    %r13
+  803a10:	41 5e                	pop    %r14
+  803a12:	41 5f                	pop    %r15
+  803a14:	5d                   	pop    %rbp
+  803a15:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803a16:	48 85 db             	test   %rbx,%rbx
+  803a19:	74 5b                	je     803a76 <devfile_write+0xc5>
+  803a1b:	48 89 de             	mov    %rbx,%rsi
+  803a1e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a22:	48 b8 89 36 80 00 00 	movabs $0x803689,%rax
+  803a29:	00 00 00 
+  803a2c:	ff d0                	call   *%rax
+  803a2e:	85 c0                	test   %eax,%eax
+  803a30:	78 40                	js     803a72 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803a32:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a36:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  803a39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a3d:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803a41:	48 b8 7e 35 80 00 00 	movabs $0x80357e,%rax
+  803a48:	00 00 00 
+  803a4b:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803a4d:	48 85 c0             	test   %rax,%rax
+  803a50:	7e b5                	jle    803a07 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803a52:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803a56:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  803a59:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  803a5c:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803a5f:	8d 51 01             	lea    0x1(%rcx),%edx
+  803a62:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803a65:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  803a68:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803a6f:	00 
+  803a70:	eb 95                	jmp    803a07 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803a72:	48 98                	cltq
+  803a74:	eb 91                	jmp    803a07 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803a76:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803a7a:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  803a7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a81:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803a85:	48 89 df             	mov    %rbx,%rdi
+  803a88:	48 b8 7e 35 80 00 00 	movabs $0x80357e,%rax
+  803a8f:	00 00 00 
+  803a92:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803a94:	48 85 c0             	test   %rax,%rax
+  803a97:	0f 8e 6a ff ff ff    	jle    803a07 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803a9d:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803aa0:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803aa4:	e9 5e ff ff ff       	jmp    803a07 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803aa9:	48 98                	cltq
+  803aab:	4d 85 ff             	test   %r15,%r15
+  803aae:	49 0f 45 c7          	cmovne %r15,%rax
+  803ab2:	e9 50 ff ff ff       	jmp    803a07 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803ab7:	48 89 de             	mov    %rbx,%rsi
+  803aba:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803abe:	48 b8 89 36 80 00 00 	movabs $0x803689,%rax
+  803ac5:	00 00 00 
+  803ac8:	ff d0                	call   *%rax
+  803aca:	85 c0                	test   %eax,%eax
+  803acc:	0f 88 2b 01 00 00    	js     803bfd <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803ad2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803ad6:	4c 01 f8             	add    %r15,%rax
+  803ad9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803add:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ae1:	48 b9 8d 2b 80 00 00 	movabs $0x802b8d,%rcx
+  803ae8:	00 00 00 
+  803aeb:	ff d1                	call   *%rcx
+  803aed:	48 89 c2             	mov    %rax,%rdx
+  803af0:	48 c1 e2 04          	shl    $0x4,%rdx
+  803af4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803af8:	48 c1 e0 0c          	shl    $0xc,%rax
+  803afc:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803b01:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803b04:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803b0b:	00 
+  803b0c:	4c 89 ea             	mov    %r13,%rdx
+  803b0f:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803b13:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  803b1a:	00 00 00 
+  803b1d:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803b1f:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803b23:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803b27:	48 39 c2             	cmp    %rax,%rdx
+  803b2a:	0f 84 db 00 00 00    	je     803c0b <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803b30:	4c 39 e2             	cmp    %r12,%rdx
+  803b33:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  803b37:	4d 01 ec             	add    %r13,%r12
+  803b3a:	49 39 c4             	cmp    %rax,%r12
+  803b3d:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803b41:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803b45:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  803b49:	45 01 ee             	add    %r13d,%r14d
+  803b4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b50:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803b54:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803b57:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b5b:	49 39 c7             	cmp    %rax,%r15
+  803b5e:	0f 83 a0 fe ff ff    	jae    803a04 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803b64:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b68:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  803b6c:	8b 43 08             	mov    0x8(%rbx),%eax
+  803b6f:	44 39 f0             	cmp    %r14d,%eax
+  803b72:	7f 10                	jg     803b84 <devfile_write+0x1d3>
+  803b74:	48 98                	cltq
+  803b76:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  803b7c:	49 63 d6             	movslq %r14d,%rdx
+  803b7f:	48 39 d0             	cmp    %rdx,%rax
+  803b82:	7d 2d                	jge    803bb1 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803b84:	48 89 de             	mov    %rbx,%rsi
+  803b87:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b8b:	48 b8 89 36 80 00 00 	movabs $0x803689,%rax
+  803b92:	00 00 00 
+  803b95:	ff d0                	call   *%rax
+  803b97:	85 c0                	test   %eax,%eax
+  803b99:	0f 88 0a ff ff ff    	js     803aa9 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803b9f:	44 89 f0             	mov    %r14d,%eax
+  803ba2:	66 b8 00 00          	mov    $0x0,%ax
+  803ba6:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803ba9:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803bb0:	00 
+        size_t off = pos - fb->fb_base;
+  803bb1:	45 89 f4             	mov    %r14d,%r12d
+  803bb4:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803bb8:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803bbb:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803bbf:	4d 29 fd             	sub    %r15,%r13
+  803bc2:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803bc7:	4c 29 e0             	sub    %r12,%rax
+  803bca:	49 39 c5             	cmp    %rax,%r13
+  803bcd:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803bd1:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803bd5:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803bd9:	48 39 c2             	cmp    %rax,%rdx
+  803bdc:	0f 84 f0 fe ff ff    	je     803ad2 <devfile_write+0x121>
+  803be2:	4c 39 e0             	cmp    %r12,%rax
+  803be5:	0f 82 cc fe ff ff    	jb     803ab7 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803beb:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803bef:	48 39 d0             	cmp    %rdx,%rax
+  803bf2:	0f 83 da fe ff ff    	jae    803ad2 <devfile_write+0x121>
+  803bf8:	e9 ba fe ff ff       	jmp    803ab7 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803bfd:	48 98                	cltq
+  803bff:	4d 85 ff             	test   %r15,%r15
+  803c02:	49 0f 45 c7          	cmovne %r15,%rax
+  803c06:	e9 fc fd ff ff       	jmp    803a07 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803c0b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803c0f:	4c 89 e2             	mov    %r12,%rdx
+  803c12:	e9 2a ff ff ff       	jmp    803b41 <devfile_write+0x190>
+
+0000000000803c17 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803c17:	55                   	push   %rbp
+  803c18:	48 89 e5             	mov    %rsp,%rbp
+  803c1b:	41 57                	push   %r15
+  803c1d:	41 56                	push   %r14
+  803c1f:	41 55                	push   %r13
+  803c21:	41 54                	push   %r12
+  803c23:	53                   	push   %rbx
+  803c24:	48 83 ec 28          	sub    $0x28,%rsp
+  803c28:	49 89 ff             	mov    %rdi,%r15
+  803c2b:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803c2f:	48 89 d3             	mov    %rdx,%rbx
+  803c32:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803c36:	48 b8 61 33 80 00 00 	movabs $0x803361,%rax
+  803c3d:	00 00 00 
+  803c40:	ff d0                	call   *%rax
+  803c42:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803c45:	48 85 c0             	test   %rax,%rax
+  803c48:	74 0d                	je     803c57 <devfile_read+0x40>
+  803c4a:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803c51:	0f 86 1a 01 00 00    	jbe    803d71 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803c57:	4d 85 e4             	test   %r12,%r12
+  803c5a:	74 1a                	je     803c76 <devfile_read+0x5f>
+  803c5c:	4c 89 e6             	mov    %r12,%rsi
+  803c5f:	4c 89 ff             	mov    %r15,%rdi
+  803c62:	48 b8 89 36 80 00 00 	movabs $0x803689,%rax
+  803c69:	00 00 00 
+  803c6c:	ff d0                	call   *%rax
+  803c6e:	85 c0                	test   %eax,%eax
+  803c70:	0f 88 e8 00 00 00    	js     803d5e <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803c76:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  803c7a:	48 b8 7b 34 80 00 00 	movabs $0x80347b,%rax
+  803c81:	00 00 00 
+  803c84:	ff d0                	call   *%rax
+  803c86:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803c89:	48 85 c0             	test   %rax,%rax
+  803c8c:	0f 84 69 02 00 00    	je     803efb <devfile_read+0x2e4>
+    while (i < n) {
+  803c92:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c97:	0f 84 ce 00 00 00    	je     803d6b <devfile_read+0x154>
+    size_t i = 0;
+  803c9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803ca2:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803ca9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803cad:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803cb1:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803cb5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803cb9:	48 29 da             	sub    %rbx,%rdx
+  803cbc:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803cc1:	48 39 c2             	cmp    %rax,%rdx
+  803cc4:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803cc8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803ccc:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803cd0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803cd3:	01 d8                	add    %ebx,%eax
+  803cd5:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803cd9:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803cdd:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803ce4:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803ceb:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803cf2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803cf8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cfd:	4c 89 ee             	mov    %r13,%rsi
+  803d00:	bf 03 00 00 00       	mov    $0x3,%edi
+  803d05:	48 b8 e1 34 80 00 00 	movabs $0x8034e1,%rax
+  803d0c:	00 00 00 
+  803d0f:	ff d0                	call   *%rax
+        if (res < 0)
+  803d11:	85 c0                	test   %eax,%eax
+  803d13:	78 4d                	js     803d62 <devfile_read+0x14b>
+        if (res == 0)
+  803d15:	74 4f                	je     803d66 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803d17:	4c 63 e0             	movslq %eax,%r12
+  803d1a:	4c 89 e2             	mov    %r12,%rdx
+  803d1d:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803d21:	4c 89 f7             	mov    %r14,%rdi
+  803d24:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  803d2b:	00 00 00 
+  803d2e:	ff d0                	call   *%rax
+        i += res;
+  803d30:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803d33:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803d36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d3a:	48 39 c3             	cmp    %rax,%rbx
+  803d3d:	0f 82 72 ff ff ff    	jb     803cb5 <devfile_read+0x9e>
+    return i;
+  803d43:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803d46:	48 85 c0             	test   %rax,%rax
+  803d49:	7e 04                	jle    803d4f <devfile_read+0x138>
+  803d4b:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803d4f:	48 83 c4 28          	add    $0x28,%rsp
+  803d53:	5b                   	pop    %rbx
+  803d54:	41 5c                	pop    %r12
+  803d56:	41 5d                	pop    %r13
+  803d58:	41 5e                	pop    %r14
+  803d5a:	41 5f                	pop    %r15
+  803d5c:	5d                   	pop    %rbp
+  803d5d:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803d5e:	48 98                	cltq
+  803d60:	eb ed                	jmp    803d4f <devfile_read+0x138>
+            return res;
+  803d62:	48 98                	cltq
+  803d64:	eb e9                	jmp    803d4f <devfile_read+0x138>
+            return i;
+  803d66:	48 89 d8             	mov    %rbx,%rax
+  803d69:	eb db                	jmp    803d46 <devfile_read+0x12f>
+    size_t i = 0;
+  803d6b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803d6f:	eb d2                	jmp    803d43 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803d71:	48 89 c6             	mov    %rax,%rsi
+  803d74:	4c 89 ff             	mov    %r15,%rdi
+  803d77:	48 b8 89 36 80 00 00 	movabs $0x803689,%rax
+  803d7e:	00 00 00 
+  803d81:	ff d0                	call   *%rax
+  803d83:	85 c0                	test   %eax,%eax
+  803d85:	78 40                	js     803dc7 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803d87:	4c 89 ff             	mov    %r15,%rdi
+  803d8a:	48 b8 8d 2b 80 00 00 	movabs $0x802b8d,%rax
+  803d91:	00 00 00 
+  803d94:	ff d0                	call   *%rax
+  803d96:	48 89 c2             	mov    %rax,%rdx
+  803d99:	48 c1 e2 04          	shl    $0x4,%rdx
+  803d9d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803da1:	48 c1 e0 0c          	shl    $0xc,%rax
+  803da5:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803daa:	48 01 d0             	add    %rdx,%rax
+  803dad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803db1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803db6:	0f 84 33 01 00 00    	je     803eef <devfile_read+0x2d8>
+    size_t i = 0;
+  803dbc:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803dc2:	e9 f5 00 00 00       	jmp    803ebc <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803dc7:	48 98                	cltq
+  803dc9:	eb 84                	jmp    803d4f <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803dcb:	44 89 e8             	mov    %r13d,%eax
+  803dce:	66 b8 00 00          	mov    $0x0,%ax
+  803dd2:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803dd7:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803dde:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803de0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803de4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803de8:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803dea:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803def:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803df2:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803df9:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803dfa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803e00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e05:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803e0a:	bf 03 00 00 00       	mov    $0x3,%edi
+  803e0f:	48 b8 e1 34 80 00 00 	movabs $0x8034e1,%rax
+  803e16:	00 00 00 
+  803e19:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803e1b:	85 c0                	test   %eax,%eax
+  803e1d:	0f 88 be 00 00 00    	js     803ee1 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803e23:	48 63 d0             	movslq %eax,%rdx
+  803e26:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803e2b:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803e30:	44 39 e8             	cmp    %r13d,%eax
+  803e33:	0f 8e ba 00 00 00    	jle    803ef3 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803e39:	49 63 c5             	movslq %r13d,%rax
+  803e3c:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803e41:	48 29 c3             	sub    %rax,%rbx
+  803e44:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803e49:	48 01 c3             	add    %rax,%rbx
+  803e4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e50:	4c 29 f0             	sub    %r14,%rax
+  803e53:	48 39 c3             	cmp    %rax,%rbx
+  803e56:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803e5a:	4c 89 ff             	mov    %r15,%rdi
+  803e5d:	48 b9 8d 2b 80 00 00 	movabs $0x802b8d,%rcx
+  803e64:	00 00 00 
+  803e67:	ff d1                	call   *%rcx
+  803e69:	48 89 c2             	mov    %rax,%rdx
+  803e6c:	48 c1 e2 04          	shl    $0x4,%rdx
+  803e70:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803e74:	48 c1 e0 0c          	shl    $0xc,%rax
+  803e78:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803e7d:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803e80:	44 89 ea             	mov    %r13d,%edx
+  803e83:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803e88:	48 63 d2             	movslq %edx,%rdx
+  803e8b:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803e92:	00 
+  803e93:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803e97:	4c 01 f7             	add    %r14,%rdi
+  803e9a:	48 89 da             	mov    %rbx,%rdx
+  803e9d:	48 b9 3a 1a 80 00 00 	movabs $0x801a3a,%rcx
+  803ea4:	00 00 00 
+  803ea7:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803ea9:	41 01 dd             	add    %ebx,%r13d
+  803eac:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803eb0:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803eb3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eb7:	49 39 c6             	cmp    %rax,%r14
+  803eba:	73 37                	jae    803ef3 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803ebc:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803ec0:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803ec5:	44 39 e8             	cmp    %r13d,%eax
+  803ec8:	0f 8f fd fe ff ff    	jg     803dcb <devfile_read+0x1b4>
+  803ece:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803ed3:	44 39 e8             	cmp    %r13d,%eax
+  803ed6:	0f 8f 5d ff ff ff    	jg     803e39 <devfile_read+0x222>
+  803edc:	e9 ea fe ff ff       	jmp    803dcb <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803ee1:	48 98                	cltq
+  803ee3:	4d 85 f6             	test   %r14,%r14
+  803ee6:	49 0f 45 c6          	cmovne %r14,%rax
+  803eea:	e9 60 fe ff ff       	jmp    803d4f <devfile_read+0x138>
+    size_t i = 0;
+  803eef:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803ef3:	4c 89 f0             	mov    %r14,%rax
+  803ef6:	e9 54 fe ff ff       	jmp    803d4f <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803efb:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803f02:	e9 48 fe ff ff       	jmp    803d4f <devfile_read+0x138>
+
+0000000000803f07 <open>:
+open(const char *path, int mode) {
+  803f07:	55                   	push   %rbp
+  803f08:	48 89 e5             	mov    %rsp,%rbp
+  803f0b:	41 55                	push   %r13
+  803f0d:	41 54                	push   %r12
+  803f0f:	53                   	push   %rbx
+  803f10:	48 83 ec 18          	sub    $0x18,%rsp
+  803f14:	49 89 fc             	mov    %rdi,%r12
+  803f17:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803f1a:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  803f21:	00 00 00 
+  803f24:	ff d0                	call   *%rax
+  803f26:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803f2c:	0f 87 8a 00 00 00    	ja     803fbc <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f32:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f36:	48 b8 bb 2b 80 00 00 	movabs $0x802bbb,%rax
+  803f3d:	00 00 00 
+  803f40:	ff d0                	call   *%rax
+  803f42:	89 c3                	mov    %eax,%ebx
+  803f44:	85 c0                	test   %eax,%eax
+  803f46:	78 50                	js     803f98 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803f48:	4c 89 e6             	mov    %r12,%rsi
+  803f4b:	48 bb 00 90 98 00 00 	movabs $0x989000,%rbx
+  803f52:	00 00 00 
+  803f55:	48 89 df             	mov    %rbx,%rdi
+  803f58:	48 b8 45 16 80 00 00 	movabs $0x801645,%rax
+  803f5f:	00 00 00 
+  803f62:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803f64:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f6b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f6f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f74:	48 b8 8d 37 80 00 00 	movabs $0x80378d,%rax
+  803f7b:	00 00 00 
+  803f7e:	ff d0                	call   *%rax
+  803f80:	89 c3                	mov    %eax,%ebx
+  803f82:	85 c0                	test   %eax,%eax
+  803f84:	78 1f                	js     803fa5 <open+0x9e>
+    return fd2num(fd);
+  803f86:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f8a:	48 b8 8d 2b 80 00 00 	movabs $0x802b8d,%rax
+  803f91:	00 00 00 
+  803f94:	ff d0                	call   *%rax
+  803f96:	89 c3                	mov    %eax,%ebx
+}
+  803f98:	89 d8                	mov    %ebx,%eax
+  803f9a:	48 83 c4 18          	add    $0x18,%rsp
+  803f9e:	5b                   	pop    %rbx
+  803f9f:	41 5c                	pop    %r12
+  803fa1:	41 5d                	pop    %r13
+  803fa3:	5d                   	pop    %rbp
+  803fa4:	c3                   	ret
+        fd_close(fd, 0);
+  803fa5:	be 00 00 00 00       	mov    $0x0,%esi
+  803faa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fae:	48 b8 d6 2c 80 00 00 	movabs $0x802cd6,%rax
+  803fb5:	00 00 00 
+  803fb8:	ff d0                	call   *%rax
+        return res;
+  803fba:	eb dc                	jmp    803f98 <open+0x91>
+        return -E_BAD_PATH;
+  803fbc:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803fc1:	eb d5                	jmp    803f98 <open+0x91>
+
+0000000000803fc3 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803fc3:	55                   	push   %rbp
+  803fc4:	48 89 e5             	mov    %rsp,%rbp
+  803fc7:	41 57                	push   %r15
+  803fc9:	41 56                	push   %r14
+  803fcb:	41 55                	push   %r13
+  803fcd:	41 54                	push   %r12
+  803fcf:	53                   	push   %rbx
+  803fd0:	48 83 ec 18          	sub    $0x18,%rsp
+  803fd4:	41 89 f6             	mov    %esi,%r14d
+  803fd7:	49 89 d7             	mov    %rdx,%r15
+  803fda:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803fdd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803fe1:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  803fe8:	00 00 00 
+  803feb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fed:	85 c0                	test   %eax,%eax
+  803fef:	0f 88 db 00 00 00    	js     8040d0 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ff5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ff9:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  804000:	00 00 00 
+  804003:	8b 00                	mov    (%rax),%eax
+  804005:	39 07                	cmp    %eax,(%rdi)
+  804007:	0f 85 db 00 00 00    	jne    8040e8 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80400d:	45 85 f6             	test   %r14d,%r14d
+  804010:	0f 88 db 00 00 00    	js     8040f1 <fmap+0x12e>
+  804016:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80401d:	0f 85 d7 00 00 00    	jne    8040fa <fmap+0x137>
+  804023:	4c 89 fb             	mov    %r15,%rbx
+  804026:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80402c:	0f 85 d1 00 00 00    	jne    804103 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  804032:	48 b8 53 37 80 00 00 	movabs $0x803753,%rax
+  804039:	00 00 00 
+  80403c:	ff d0                	call   *%rax
+  80403e:	85 c0                	test   %eax,%eax
+  804040:	0f 88 8e 00 00 00    	js     8040d4 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804046:	49 bc 00 90 98 00 00 	movabs $0x989000,%r12
+  80404d:	00 00 00 
+    while (i < n) {
+  804050:	4d 85 ed             	test   %r13,%r13
+  804053:	0f 84 8a 00 00 00    	je     8040e3 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  804059:	4c 89 ea             	mov    %r13,%rdx
+  80405c:	48 29 da             	sub    %rbx,%rdx
+  80405f:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  804066:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80406c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804070:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804074:	8b 40 0c             	mov    0xc(%rax),%eax
+  804077:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80407b:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  80407f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  804084:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  804089:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80408d:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  804091:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804096:	4c 89 e6             	mov    %r12,%rsi
+  804099:	bf 09 00 00 00       	mov    $0x9,%edi
+  80409e:	48 b8 e1 34 80 00 00 	movabs $0x8034e1,%rax
+  8040a5:	00 00 00 
+  8040a8:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8040aa:	85 c0                	test   %eax,%eax
+  8040ac:	78 2a                	js     8040d8 <fmap+0x115>
+        i += res;
+  8040ae:	48 98                	cltq
+  8040b0:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8040b3:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8040b7:	72 05                	jb     8040be <fmap+0xfb>
+    while (i < n) {
+  8040b9:	4c 39 eb             	cmp    %r13,%rbx
+  8040bc:	72 9b                	jb     804059 <fmap+0x96>
+    }
+    return i;
+  8040be:	48 89 d8             	mov    %rbx,%rax
+}
+  8040c1:	48 83 c4 18          	add    $0x18,%rsp
+  8040c5:	5b                   	pop    %rbx
+  8040c6:	41 5c                	pop    %r12
+  8040c8:	41 5d                	pop    %r13
+  8040ca:	41 5e                	pop    %r14
+  8040cc:	41 5f                	pop    %r15
+  8040ce:	5d                   	pop    %rbp
+  8040cf:	c3                   	ret
+    if (res < 0) return res;
+  8040d0:	48 98                	cltq
+  8040d2:	eb ed                	jmp    8040c1 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8040d4:	48 98                	cltq
+  8040d6:	eb e9                	jmp    8040c1 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8040d8:	48 98                	cltq
+  8040da:	48 85 db             	test   %rbx,%rbx
+  8040dd:	48 0f 45 c3          	cmovne %rbx,%rax
+  8040e1:	eb de                	jmp    8040c1 <fmap+0xfe>
+    size_t i = 0;
+  8040e3:	4c 89 eb             	mov    %r13,%rbx
+  8040e6:	eb d6                	jmp    8040be <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040e8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8040ef:	eb d0                	jmp    8040c1 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8040f1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8040f8:	eb c7                	jmp    8040c1 <fmap+0xfe>
+  8040fa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804101:	eb be                	jmp    8040c1 <fmap+0xfe>
+  804103:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80410a:	eb b5                	jmp    8040c1 <fmap+0xfe>
+
+000000000080410c <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80410c:	55                   	push   %rbp
+  80410d:	48 89 e5             	mov    %rsp,%rbp
+  804110:	41 56                	push   %r14
+  804112:	41 55                	push   %r13
+  804114:	41 54                	push   %r12
+  804116:	53                   	push   %rbx
+  804117:	48 83 ec 10          	sub    $0x10,%rsp
+  80411b:	89 fb                	mov    %edi,%ebx
+  80411d:	41 89 f4             	mov    %esi,%r12d
+  804120:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804123:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804127:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  80412e:	00 00 00 
+  804131:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804133:	85 c0                	test   %eax,%eax
+  804135:	78 63                	js     80419a <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  804137:	45 85 e4             	test   %r12d,%r12d
+  80413a:	0f 88 80 00 00 00    	js     8041c0 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  804140:	45 89 e6             	mov    %r12d,%r14d
+  804143:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80414a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80414e:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  804155:	00 00 00 
+  804158:	ff d0                	call   *%rax
+  80415a:	48 89 c2             	mov    %rax,%rdx
+  80415d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804162:	44 89 f6             	mov    %r14d,%esi
+  804165:	89 df                	mov    %ebx,%edi
+  804167:	48 b8 c3 3f 80 00 00 	movabs $0x803fc3,%rax
+  80416e:	00 00 00 
+  804171:	ff d0                	call   *%rax
+  804173:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  804176:	45 29 f4             	sub    %r14d,%r12d
+  804179:	4d 63 f4             	movslq %r12d,%r14
+  80417c:	49 39 c6             	cmp    %rax,%r14
+  80417f:	7c 1d                	jl     80419e <read_map+0x92>
+  804181:	48 85 c0             	test   %rax,%rax
+  804184:	b8 00 00 00 00       	mov    $0x0,%eax
+  804189:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80418d:	48 83 c4 10          	add    $0x10,%rsp
+  804191:	5b                   	pop    %rbx
+  804192:	41 5c                	pop    %r12
+  804194:	41 5d                	pop    %r13
+  804196:	41 5e                	pop    %r14
+  804198:	5d                   	pop    %rbp
+  804199:	c3                   	ret
+    if (res < 0) return res;
+  80419a:	48 98                	cltq
+  80419c:	eb ef                	jmp    80418d <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  80419e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8041a2:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  8041a9:	00 00 00 
+  8041ac:	ff d0                	call   *%rax
+  8041ae:	4d 63 e4             	movslq %r12d,%r12
+  8041b1:	4c 01 e0             	add    %r12,%rax
+  8041b4:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8041b8:	48 89 d8             	mov    %rbx,%rax
+  8041bb:	4c 29 f0             	sub    %r14,%rax
+  8041be:	eb cd                	jmp    80418d <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8041c0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8041c7:	eb c4                	jmp    80418d <read_map+0x81>
+
+00000000008041c9 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8041c9:	55                   	push   %rbp
+  8041ca:	48 89 e5             	mov    %rsp,%rbp
+  8041cd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8041d1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041d5:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  8041dc:	00 00 00 
+  8041df:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041e1:	85 c0                	test   %eax,%eax
+  8041e3:	78 4a                	js     80422f <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8041e5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041e9:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  8041f0:	00 00 00 
+  8041f3:	8b 00                	mov    (%rax),%eax
+  8041f5:	39 07                	cmp    %eax,(%rdi)
+  8041f7:	75 38                	jne    804231 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8041f9:	48 b8 53 37 80 00 00 	movabs $0x803753,%rax
+  804200:	00 00 00 
+  804203:	ff d0                	call   *%rax
+  804205:	85 c0                	test   %eax,%eax
+  804207:	78 26                	js     80422f <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804209:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80420d:	8b 40 0c             	mov    0xc(%rax),%eax
+  804210:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  804217:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  804219:	be 00 00 00 00       	mov    $0x0,%esi
+  80421e:	bf 06 00 00 00       	mov    $0x6,%edi
+  804223:	48 b8 8d 37 80 00 00 	movabs $0x80378d,%rax
+  80422a:	00 00 00 
+  80422d:	ff d0                	call   *%rax
+}
+  80422f:	c9                   	leave
+  804230:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804231:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804236:	eb f7                	jmp    80422f <fsync+0x66>
+
+0000000000804238 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  804238:	55                   	push   %rbp
+  804239:	48 89 e5             	mov    %rsp,%rbp
+  80423c:	41 57                	push   %r15
+  80423e:	41 56                	push   %r14
+  804240:	41 55                	push   %r13
+  804242:	41 54                	push   %r12
+  804244:	53                   	push   %rbx
+  804245:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  804249:	49 bc 20 a0 98 00 00 	movabs $0x98a020,%r12
+  804250:	00 00 00 
+  804253:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  804258:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80425e:	49 bd 1b 2c 80 00 00 	movabs $0x802c1b,%r13
+  804265:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  804268:	49 be 60 70 80 00 00 	movabs $0x807060,%r14
+  80426f:	00 00 00 
+  804272:	eb 0c                	jmp    804280 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  804274:	83 c3 01             	add    $0x1,%ebx
+  804277:	49 83 c4 28          	add    $0x28,%r12
+  80427b:	83 fb 20             	cmp    $0x20,%ebx
+  80427e:	74 33                	je     8042b3 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  804280:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  804285:	74 ed                	je     804274 <flushall+0x3c>
+  804287:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80428b:	89 df                	mov    %ebx,%edi
+  80428d:	41 ff d5             	call   *%r13
+  804290:	85 c0                	test   %eax,%eax
+  804292:	78 e0                	js     804274 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  804294:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  804298:	41 8b 06             	mov    (%r14),%eax
+  80429b:	39 07                	cmp    %eax,(%rdi)
+  80429d:	75 d5                	jne    804274 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  80429f:	48 b8 53 37 80 00 00 	movabs $0x803753,%rax
+  8042a6:	00 00 00 
+  8042a9:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8042ab:	85 c0                	test   %eax,%eax
+  8042ad:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8042b1:	eb c1                	jmp    804274 <flushall+0x3c>
+    }
+    return res;
+}
+  8042b3:	44 89 f8             	mov    %r15d,%eax
+  8042b6:	48 83 c4 18          	add    $0x18,%rsp
+  8042ba:	5b                   	pop    %rbx
+  8042bb:	41 5c                	pop    %r12
+  8042bd:	41 5d                	pop    %r13
+  8042bf:	41 5e                	pop    %r14
+  8042c1:	41 5f                	pop    %r15
+  8042c3:	5d                   	pop    %rbp
+  8042c4:	c3                   	ret
+
+00000000008042c5 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8042c5:	55                   	push   %rbp
+  8042c6:	48 89 e5             	mov    %rsp,%rbp
+  8042c9:	53                   	push   %rbx
+  8042ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8042ce:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8042d1:	40 0f b6 c6          	movzbl %sil,%eax
+  8042d5:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8042dc:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8042de:	be 00 00 00 00       	mov    $0x0,%esi
+  8042e3:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8042e8:	48 b8 8d 37 80 00 00 	movabs $0x80378d,%rax
+  8042ef:	00 00 00 
+  8042f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042f4:	85 c0                	test   %eax,%eax
+  8042f6:	78 23                	js     80431b <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8042f8:	ba 58 06 00 00       	mov    $0x658,%edx
+  8042fd:	48 be 00 90 98 00 00 	movabs $0x989000,%rsi
+  804304:	00 00 00 
+  804307:	48 89 df             	mov    %rbx,%rdi
+  80430a:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  804311:	00 00 00 
+  804314:	ff d0                	call   *%rax
+    return 0;
+  804316:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80431b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80431f:	c9                   	leave
+  804320:	c3                   	ret
+
+0000000000804321 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  804321:	55                   	push   %rbp
+  804322:	48 89 e5             	mov    %rsp,%rbp
+  804325:	53                   	push   %rbx
+  804326:	48 83 ec 08          	sub    $0x8,%rsp
+  80432a:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  80432d:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  804334:	00 00 00 
+  804337:	ff d0                	call   *%rax
+  804339:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80433f:	77 35                	ja     804376 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  804341:	48 89 de             	mov    %rbx,%rsi
+  804344:	48 bf 00 90 98 00 00 	movabs $0x989000,%rdi
+  80434b:	00 00 00 
+  80434e:	48 b8 45 16 80 00 00 	movabs $0x801645,%rax
+  804355:	00 00 00 
+  804358:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80435a:	be 00 00 00 00       	mov    $0x0,%esi
+  80435f:	bf 07 00 00 00       	mov    $0x7,%edi
+  804364:	48 b8 8d 37 80 00 00 	movabs $0x80378d,%rax
+  80436b:	00 00 00 
+  80436e:	ff d0                	call   *%rax
+}
+  804370:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804374:	c9                   	leave
+  804375:	c3                   	ret
+        return -E_BAD_PATH;
+  804376:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80437b:	eb f3                	jmp    804370 <remove+0x4f>
+
+000000000080437d <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80437d:	55                   	push   %rbp
+  80437e:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  804381:	48 b8 38 42 80 00 00 	movabs $0x804238,%rax
+  804388:	00 00 00 
+  80438b:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80438d:	be 00 00 00 00       	mov    $0x0,%esi
+  804392:	bf 08 00 00 00       	mov    $0x8,%edi
+  804397:	48 b8 8d 37 80 00 00 	movabs $0x80378d,%rax
+  80439e:	00 00 00 
+  8043a1:	ff d0                	call   *%rax
+}
+  8043a3:	5d                   	pop    %rbp
+  8043a4:	c3                   	ret
+
+00000000008043a5 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8043a5:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8043a9:	7f 01                	jg     8043ac <writebuf+0x7>
+  8043ab:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8043ac:	55                   	push   %rbp
+  8043ad:	48 89 e5             	mov    %rsp,%rbp
+  8043b0:	53                   	push   %rbx
+  8043b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8043b5:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8043b8:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8043bc:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8043c0:	8b 3f                	mov    (%rdi),%edi
+  8043c2:	48 b8 2d 30 80 00 00 	movabs $0x80302d,%rax
+  8043c9:	00 00 00 
+  8043cc:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8043ce:	48 85 c0             	test   %rax,%rax
+  8043d1:	7e 04                	jle    8043d7 <writebuf+0x32>
+  8043d3:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8043d7:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8043db:	48 39 c2             	cmp    %rax,%rdx
+  8043de:	74 0f                	je     8043ef <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8043e0:	48 85 c0             	test   %rax,%rax
+  8043e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043e8:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8043ec:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8043ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043f3:	c9                   	leave
+  8043f4:	c3                   	ret
+
+00000000008043f5 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8043f5:	8b 46 04             	mov    0x4(%rsi),%eax
+  8043f8:	8d 50 01             	lea    0x1(%rax),%edx
+  8043fb:	89 56 04             	mov    %edx,0x4(%rsi)
+  8043fe:	48 98                	cltq
+  804400:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804405:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80440b:	74 01                	je     80440e <putch+0x19>
+  80440d:	c3                   	ret
+putch(int ch, void *arg) {
+  80440e:	55                   	push   %rbp
+  80440f:	48 89 e5             	mov    %rsp,%rbp
+  804412:	53                   	push   %rbx
+  804413:	48 83 ec 08          	sub    $0x8,%rsp
+  804417:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80441a:	48 89 f7             	mov    %rsi,%rdi
+  80441d:	48 b8 a5 43 80 00 00 	movabs $0x8043a5,%rax
+  804424:	00 00 00 
+  804427:	ff d0                	call   *%rax
+        state->offset = 0;
+  804429:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804430:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804434:	c9                   	leave
+  804435:	c3                   	ret
+
+0000000000804436 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804436:	55                   	push   %rbp
+  804437:	48 89 e5             	mov    %rsp,%rbp
+  80443a:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804441:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804444:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  80444a:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  804451:	00 00 00 
+    state.result = 0;
+  804454:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80445b:	00 00 00 00 
+    state.error = 1;
+  80445f:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804466:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  804469:	48 89 f2             	mov    %rsi,%rdx
+  80446c:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804473:	48 bf f5 43 80 00 00 	movabs $0x8043f5,%rdi
+  80447a:	00 00 00 
+  80447d:	48 b8 1d 0e 80 00 00 	movabs $0x800e1d,%rax
+  804484:	00 00 00 
+  804487:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  804489:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804490:	7f 14                	jg     8044a6 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804492:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  804499:	48 85 c0             	test   %rax,%rax
+  80449c:	75 06                	jne    8044a4 <vfprintf+0x6e>
+  80449e:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8044a4:	c9                   	leave
+  8044a5:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8044a6:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8044ad:	48 b8 a5 43 80 00 00 	movabs $0x8043a5,%rax
+  8044b4:	00 00 00 
+  8044b7:	ff d0                	call   *%rax
+  8044b9:	eb d7                	jmp    804492 <vfprintf+0x5c>
+
+00000000008044bb <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8044bb:	55                   	push   %rbp
+  8044bc:	48 89 e5             	mov    %rsp,%rbp
+  8044bf:	48 83 ec 50          	sub    $0x50,%rsp
+  8044c3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8044c7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8044cb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8044cf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8044d3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8044da:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8044e2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8044e6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8044ea:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8044ee:	48 b8 36 44 80 00 00 	movabs $0x804436,%rax
+  8044f5:	00 00 00 
+  8044f8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8044fa:	c9                   	leave
+  8044fb:	c3                   	ret
+
+00000000008044fc <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8044fc:	55                   	push   %rbp
+  8044fd:	48 89 e5             	mov    %rsp,%rbp
+  804500:	48 83 ec 50          	sub    $0x50,%rsp
+  804504:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804508:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80450c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804510:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804514:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804518:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80451f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804523:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804527:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80452b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80452f:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804533:	48 89 fe             	mov    %rdi,%rsi
+  804536:	bf 01 00 00 00       	mov    $0x1,%edi
+  80453b:	48 b8 36 44 80 00 00 	movabs $0x804436,%rax
+  804542:	00 00 00 
+  804545:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804547:	c9                   	leave
+  804548:	c3                   	ret
+
+0000000000804549 <puts>:
+
+int
+puts(const char *str) {
+  804549:	55                   	push   %rbp
+  80454a:	48 89 e5             	mov    %rsp,%rbp
+  80454d:	48 89 fe             	mov    %rdi,%rsi
+    return printf("%s\n", str);
+  804550:	48 bf c3 60 80 00 00 	movabs $0x8060c3,%rdi
+  804557:	00 00 00 
+  80455a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80455f:	48 ba fc 44 80 00 00 	movabs $0x8044fc,%rdx
+  804566:	00 00 00 
+  804569:	ff d2                	call   *%rdx
+}
+  80456b:	5d                   	pop    %rbp
+  80456c:	c3                   	ret
+
+000000000080456d <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  80456d:	55                   	push   %rbp
+  80456e:	48 89 e5             	mov    %rsp,%rbp
+  804571:	41 55                	push   %r13
+  804573:	41 54                	push   %r12
+  804575:	53                   	push   %rbx
+  804576:	48 83 ec 08          	sub    $0x8,%rsp
+  80457a:	48 89 fb             	mov    %rdi,%rbx
+  80457d:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  804580:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  804583:	48 b8 77 55 80 00 00 	movabs $0x805577,%rax
+  80458a:	00 00 00 
+  80458d:	ff d0                	call   *%rax
+  80458f:	41 89 c1             	mov    %eax,%r9d
+  804592:	4d 89 e0             	mov    %r12,%r8
+  804595:	49 29 d8             	sub    %rbx,%r8
+  804598:	48 89 d9             	mov    %rbx,%rcx
+  80459b:	44 89 ea             	mov    %r13d,%edx
+  80459e:	48 89 de             	mov    %rbx,%rsi
+  8045a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045a6:	48 b8 56 1f 80 00 00 	movabs $0x801f56,%rax
+  8045ad:	00 00 00 
+  8045b0:	ff d0                	call   *%rax
+}
+  8045b2:	48 83 c4 08          	add    $0x8,%rsp
+  8045b6:	5b                   	pop    %rbx
+  8045b7:	41 5c                	pop    %r12
+  8045b9:	41 5d                	pop    %r13
+  8045bb:	5d                   	pop    %rbp
+  8045bc:	c3                   	ret
+
+00000000008045bd <spawn>:
+spawn(const char *prog, const char **argv) {
+  8045bd:	55                   	push   %rbp
+  8045be:	48 89 e5             	mov    %rsp,%rbp
+  8045c1:	41 57                	push   %r15
+  8045c3:	41 56                	push   %r14
+  8045c5:	41 55                	push   %r13
+  8045c7:	41 54                	push   %r12
+  8045c9:	53                   	push   %rbx
+  8045ca:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  8045d1:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  8045d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8045d9:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  8045e0:	00 00 00 
+  8045e3:	ff d0                	call   *%rax
+  8045e5:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+    if (fd < 0) return fd;
+  8045eb:	85 c0                	test   %eax,%eax
+  8045ed:	0f 88 8f 06 00 00    	js     804c82 <spawn+0x6c5>
+  8045f3:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  8045f5:	ba 00 02 00 00       	mov    $0x200,%edx
+  8045fa:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  804601:	48 b8 bc 2f 80 00 00 	movabs $0x802fbc,%rax
+  804608:	00 00 00 
+  80460b:	ff d0                	call   *%rax
+  80460d:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  80460f:	3d 00 02 00 00       	cmp    $0x200,%eax
+  804614:	0f 85 88 02 00 00    	jne    8048a2 <spawn+0x2e5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  80461a:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  804621:	ff ff 00 
+  804624:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  80462b:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  804632:	01 01 00 
+  804635:	48 39 d0             	cmp    %rdx,%rax
+  804638:	0f 85 a0 02 00 00    	jne    8048de <spawn+0x321>
+        elf->e_type != ET_EXEC /* executable */ ||
+  80463e:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  804645:	00 3e 00 
+  804648:	0f 85 90 02 00 00    	jne    8048de <spawn+0x321>
+    flushall();
+  80464e:	48 b8 38 42 80 00 00 	movabs $0x804238,%rax
+  804655:	00 00 00 
+  804658:	ff d0                	call   *%rax
+  80465a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80465f:	cd 30                	int    $0x30
+  804661:	41 89 c7             	mov    %eax,%r15d
+  804664:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  80466a:	85 c0                	test   %eax,%eax
+  80466c:	0f 88 f2 05 00 00    	js     804c64 <spawn+0x6a7>
+    envid_t child = res;
+  804672:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  804678:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80467d:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804684:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  80468b:	00 00 00 
+  80468e:	48 01 c6             	add    %rax,%rsi
+  804691:	48 8b 06             	mov    (%rsi),%rax
+  804694:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  80469b:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  8046a2:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  8046a9:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  8046b0:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  8046b7:	48 29 ce             	sub    %rcx,%rsi
+  8046ba:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  8046c0:	c1 e9 03             	shr    $0x3,%ecx
+  8046c3:	89 c9                	mov    %ecx,%ecx
+  8046c5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  8046c8:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  8046cf:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  8046d6:	48 8b 3b             	mov    (%rbx),%rdi
+  8046d9:	48 85 ff             	test   %rdi,%rdi
+  8046dc:	0f 84 b8 05 00 00    	je     804c9a <spawn+0x6dd>
+  8046e2:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  8046e8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  8046ee:	49 be 07 16 80 00 00 	movabs $0x801607,%r14
+  8046f5:	00 00 00 
+  8046f8:	41 ff d6             	call   *%r14
+  8046fb:	4c 01 e8             	add    %r13,%rax
+  8046fe:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  804702:	4c 89 a5 f8 fc ff ff 	mov    %r12,-0x308(%rbp)
+  804709:	49 83 c4 01          	add    $0x1,%r12
+  80470d:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  804712:	48 85 ff             	test   %rdi,%rdi
+  804715:	75 e1                	jne    8046f8 <spawn+0x13b>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  804717:	48 f7 d0             	not    %rax
+  80471a:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804721:	4d 89 e6             	mov    %r12,%r14
+  804724:	49 83 e6 f8          	and    $0xfffffffffffffff8,%r14
+  804728:	4c 89 b5 f0 fc ff ff 	mov    %r14,-0x310(%rbp)
+  80472f:	4c 8b ad f8 fc ff ff 	mov    -0x308(%rbp),%r13
+  804736:	44 89 e8             	mov    %r13d,%eax
+  804739:	83 c0 01             	add    $0x1,%eax
+  80473c:	48 98                	cltq
+  80473e:	48 c1 e0 03          	shl    $0x3,%rax
+  804742:	49 29 c6             	sub    %rax,%r14
+  804745:	4c 89 b5 e0 fc ff ff 	mov    %r14,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80474c:	49 8d 46 f0          	lea    -0x10(%r14),%rax
+  804750:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  804756:	0f 86 eb 04 00 00    	jbe    804c47 <spawn+0x68a>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80475c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804761:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804766:	be 00 00 40 00       	mov    $0x400000,%esi
+  80476b:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  804772:	00 00 00 
+  804775:	ff d0                	call   *%rax
+  804777:	85 c0                	test   %eax,%eax
+  804779:	0f 88 cd 04 00 00    	js     804c4c <spawn+0x68f>
+    for (i = 0; i < argc; i++) {
+  80477f:	4c 89 e8             	mov    %r13,%rax
+  804782:	45 85 ed             	test   %r13d,%r13d
+  804785:	7e 52                	jle    8047d9 <spawn+0x21c>
+  804787:	4d 89 f5             	mov    %r14,%r13
+  80478a:	48 98                	cltq
+  80478c:	4d 8d 34 c6          	lea    (%r14,%rax,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  804790:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  804797:	00 00 00 
+  80479a:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  8047a1:	ff 
+  8047a2:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  8047a6:	48 8b 33             	mov    (%rbx),%rsi
+  8047a9:	4c 89 e7             	mov    %r12,%rdi
+  8047ac:	48 b8 45 16 80 00 00 	movabs $0x801645,%rax
+  8047b3:	00 00 00 
+  8047b6:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  8047b8:	48 8b 3b             	mov    (%rbx),%rdi
+  8047bb:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  8047c2:	00 00 00 
+  8047c5:	ff d0                	call   *%rax
+  8047c7:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  8047cc:	49 83 c5 08          	add    $0x8,%r13
+  8047d0:	48 83 c3 08          	add    $0x8,%rbx
+  8047d4:	4d 39 f5             	cmp    %r14,%r13
+  8047d7:	75 b7                	jne    804790 <spawn+0x1d3>
+    argv_store[argc] = 0;
+  8047d9:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  8047e0:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8047e7:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8047e8:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  8047ef:	0f 85 30 01 00 00    	jne    804925 <spawn+0x368>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8047f5:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  8047fc:	00 00 00 
+  8047ff:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  804806:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  80480d:	ff 
+  80480e:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  804812:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  804819:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  80481d:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  804824:	00 00 00 
+  804827:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80482e:	ff 
+  80482f:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  804836:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  80483c:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  804842:	44 89 fa             	mov    %r15d,%edx
+  804845:	be 00 00 40 00       	mov    $0x400000,%esi
+  80484a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80484f:	48 b8 56 1f 80 00 00 	movabs $0x801f56,%rax
+  804856:	00 00 00 
+  804859:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  80485b:	48 bb ce 20 80 00 00 	movabs $0x8020ce,%rbx
+  804862:	00 00 00 
+  804865:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80486a:	be 00 00 40 00       	mov    $0x400000,%esi
+  80486f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804874:	ff d3                	call   *%rbx
+  804876:	85 c0                	test   %eax,%eax
+  804878:	78 eb                	js     804865 <spawn+0x2a8>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80487a:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  804881:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  804888:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804889:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  804890:	00 
+  804891:	0f 84 a1 02 00 00    	je     804b38 <spawn+0x57b>
+  804897:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80489d:	e9 dd 00 00 00       	jmp    80497f <spawn+0x3c2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  8048a2:	48 bf 20 68 80 00 00 	movabs $0x806820,%rdi
+  8048a9:	00 00 00 
+  8048ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048b1:	48 ba cd 0c 80 00 00 	movabs $0x800ccd,%rdx
+  8048b8:	00 00 00 
+  8048bb:	ff d2                	call   *%rdx
+        close(fd);
+  8048bd:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  8048c3:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  8048ca:	00 00 00 
+  8048cd:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8048cf:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  8048d6:	ff ff ff 
+  8048d9:	e9 a4 03 00 00       	jmp    804c82 <spawn+0x6c5>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8048de:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8048e3:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8048e9:	48 bf 80 68 80 00 00 	movabs $0x806880,%rdi
+  8048f0:	00 00 00 
+  8048f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048f8:	48 b9 cd 0c 80 00 00 	movabs $0x800ccd,%rcx
+  8048ff:	00 00 00 
+  804902:	ff d1                	call   *%rcx
+        close(fd);
+  804904:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  80490a:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  804911:	00 00 00 
+  804914:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  804916:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  80491d:	ff ff ff 
+  804920:	e9 5d 03 00 00       	jmp    804c82 <spawn+0x6c5>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  804925:	48 b9 50 68 80 00 00 	movabs $0x806850,%rcx
+  80492c:	00 00 00 
+  80492f:	48 ba a9 60 80 00 00 	movabs $0x8060a9,%rdx
+  804936:	00 00 00 
+  804939:	be f3 00 00 00       	mov    $0xf3,%esi
+  80493e:	48 bf 9a 68 80 00 00 	movabs $0x80689a,%rdi
+  804945:	00 00 00 
+  804948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80494d:	49 b8 7d 0b 80 00 00 	movabs $0x800b7d,%r8
+  804954:	00 00 00 
+  804957:	41 ff d0             	call   *%r8
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80495a:	83 bd f8 fc ff ff 00 	cmpl   $0x0,-0x308(%rbp)
+  804961:	0f 88 eb 02 00 00    	js     804c52 <spawn+0x695>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804967:	49 83 c7 01          	add    $0x1,%r15
+  80496b:	48 83 c3 38          	add    $0x38,%rbx
+  80496f:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  804976:	49 39 c7             	cmp    %rax,%r15
+  804979:	0f 83 b9 01 00 00    	jae    804b38 <spawn+0x57b>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  80497f:	83 3b 01             	cmpl   $0x1,(%rbx)
+  804982:	75 e3                	jne    804967 <spawn+0x3aa>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  804984:	8b 43 04             	mov    0x4(%rbx),%eax
+  804987:	41 89 c4             	mov    %eax,%r12d
+  80498a:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  80498e:	44 89 e2             	mov    %r12d,%edx
+  804991:	83 ca 04             	or     $0x4,%edx
+  804994:	a8 04                	test   $0x4,%al
+  804996:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  80499a:	44 89 e2             	mov    %r12d,%edx
+  80499d:	83 ca 01             	or     $0x1,%edx
+  8049a0:	a8 01                	test   $0x1,%al
+  8049a2:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8049a6:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  8049aa:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+  8049b0:	4c 8b 6b 20          	mov    0x20(%rbx),%r13
+  8049b4:	4c 8b 73 28          	mov    0x28(%rbx),%r14
+  8049b8:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  8049bc:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  8049c3:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  8049c9:	89 8d e0 fc ff ff    	mov    %ecx,-0x320(%rbp)
+
+    // cprintf("map_segment %x+%x\n", va, memsz);
+
+    /* Fixup unaligned destination */
+    int res = PAGE_OFFSET(va);
+    if (res) {
+  8049cf:	89 f2                	mov    %esi,%edx
+  8049d1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8049d7:	74 1b                	je     8049f4 <spawn+0x437>
+        va -= res;
+  8049d9:	48 63 ca             	movslq %edx,%rcx
+  8049dc:	48 29 ce             	sub    %rcx,%rsi
+  8049df:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  8049e6:	49 01 ce             	add    %rcx,%r14
+        filesz += res;
+  8049e9:	49 01 cd             	add    %rcx,%r13
+        fileoffset -= res;
+  8049ec:	29 d0                	sub    %edx,%eax
+  8049ee:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+    }
+
+    /* NOTE: There's restriction on maximal filesz
+     * for each program segment (HUGE_PAGE_SIZE) */
+    if (filesz > HUGE_PAGE_SIZE || filesz > memsz)
+  8049f4:	b8 00 00 20 00       	mov    $0x200000,%eax
+  8049f9:	49 39 c6             	cmp    %rax,%r14
+  8049fc:	49 0f 46 c6          	cmovbe %r14,%rax
+  804a00:	4c 39 e8             	cmp    %r13,%rax
+  804a03:	0f 82 32 02 00 00    	jb     804c3b <spawn+0x67e>
+    /* Allocate filesz in parent to UTEMP */
+    /* seek() fd to fileoffset  */
+    /* read filesz to UTEMP */
+    /* Map read section conents to child */
+    /* Unmap it from parent */
+    res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, 4096), memsz, perm);
+  804a09:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  804a10:	49 8d b4 05 ff 0f 00 	lea    0xfff(%r13,%rax,1),%rsi
+  804a17:	00 
+  804a18:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804a1f:	44 89 e1             	mov    %r12d,%ecx
+  804a22:	4c 89 f2             	mov    %r14,%rdx
+  804a25:	8b bd e0 fc ff ff    	mov    -0x320(%rbp),%edi
+  804a2b:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  804a32:	00 00 00 
+  804a35:	ff d0                	call   *%rax
+  804a37:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (memsz > filesz && res)
+  804a3d:	4d 39 f5             	cmp    %r14,%r13
+  804a40:	73 08                	jae    804a4a <spawn+0x48d>
+  804a42:	85 c0                	test   %eax,%eax
+  804a44:	0f 85 10 ff ff ff    	jne    80495a <spawn+0x39d>
+        return res;
+
+    if (filesz == 0)
+  804a4a:	4d 85 ed             	test   %r13,%r13
+  804a4d:	0f 84 14 ff ff ff    	je     804967 <spawn+0x3aa>
+        return 0;
+
+    res = sys_alloc_region(0, UTEMP, ROUNDUP(filesz, 4096), PTE_P | PTE_U | PTE_W);
+  804a53:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  804a5a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  804a60:	49 89 c6             	mov    %rax,%r14
+  804a63:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804a68:	48 89 c2             	mov    %rax,%rdx
+  804a6b:	be 00 00 40 00       	mov    $0x400000,%esi
+  804a70:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a75:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  804a7c:	00 00 00 
+  804a7f:	ff d0                	call   *%rax
+  804a81:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  804a87:	85 c0                	test   %eax,%eax
+  804a89:	0f 85 cb fe ff ff    	jne    80495a <spawn+0x39d>
+        return res;
+    res = seek(fd, fileoffset);
+  804a8f:	8b b5 e8 fc ff ff    	mov    -0x318(%rbp),%esi
+  804a95:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  804a9b:	48 b8 e6 30 80 00 00 	movabs $0x8030e6,%rax
+  804aa2:	00 00 00 
+  804aa5:	ff d0                	call   *%rax
+  804aa7:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  804aad:	85 c0                	test   %eax,%eax
+  804aaf:	0f 85 a5 fe ff ff    	jne    80495a <spawn+0x39d>
+        return res;
+    res = readn(fd, UTEMP, filesz);
+  804ab5:	4c 89 ea             	mov    %r13,%rdx
+  804ab8:	be 00 00 40 00       	mov    $0x400000,%esi
+  804abd:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  804ac3:	48 b8 bc 2f 80 00 00 	movabs $0x802fbc,%rax
+  804aca:	00 00 00 
+  804acd:	ff d0                	call   *%rax
+  804acf:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res < 0)
+  804ad5:	85 c0                	test   %eax,%eax
+  804ad7:	0f 88 75 01 00 00    	js     804c52 <spawn+0x695>
+        return res;
+    res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, 4096), perm);
+  804add:	45 89 e1             	mov    %r12d,%r9d
+  804ae0:	4d 89 f0             	mov    %r14,%r8
+  804ae3:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  804aea:	8b 95 e0 fc ff ff    	mov    -0x320(%rbp),%edx
+  804af0:	be 00 00 40 00       	mov    $0x400000,%esi
+  804af5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804afa:	48 b8 56 1f 80 00 00 	movabs $0x801f56,%rax
+  804b01:	00 00 00 
+  804b04:	ff d0                	call   *%rax
+  804b06:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  804b0c:	85 c0                	test   %eax,%eax
+  804b0e:	0f 85 46 fe ff ff    	jne    80495a <spawn+0x39d>
+        return res;
+    res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, 4096));
+  804b14:	4c 89 f2             	mov    %r14,%rdx
+  804b17:	be 00 00 40 00       	mov    $0x400000,%esi
+  804b1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b21:	48 b8 ce 20 80 00 00 	movabs $0x8020ce,%rax
+  804b28:	00 00 00 
+  804b2b:	ff d0                	call   *%rax
+  804b2d:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  804b33:	e9 22 fe ff ff       	jmp    80495a <spawn+0x39d>
+    close(fd);
+  804b38:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  804b3e:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  804b45:	00 00 00 
+  804b48:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  804b4a:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  804b51:	48 bf 6d 45 80 00 00 	movabs $0x80456d,%rdi
+  804b58:	00 00 00 
+  804b5b:	48 b8 eb 55 80 00 00 	movabs $0x8055eb,%rax
+  804b62:	00 00 00 
+  804b65:	ff d0                	call   *%rax
+  804b67:	85 c0                	test   %eax,%eax
+  804b69:	78 49                	js     804bb4 <spawn+0x5f7>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  804b6b:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  804b72:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804b78:	48 b8 9e 21 80 00 00 	movabs $0x80219e,%rax
+  804b7f:	00 00 00 
+  804b82:	ff d0                	call   *%rax
+  804b84:	85 c0                	test   %eax,%eax
+  804b86:	78 59                	js     804be1 <spawn+0x624>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  804b88:	be 02 00 00 00       	mov    $0x2,%esi
+  804b8d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804b93:	48 b8 35 21 80 00 00 	movabs $0x802135,%rax
+  804b9a:	00 00 00 
+  804b9d:	ff d0                	call   *%rax
+  804b9f:	85 c0                	test   %eax,%eax
+  804ba1:	78 6b                	js     804c0e <spawn+0x651>
+    return child;
+  804ba3:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  804ba9:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+  804baf:	e9 ce 00 00 00       	jmp    804c82 <spawn+0x6c5>
+        panic("copy_shared_region: %i", res);
+  804bb4:	89 c1                	mov    %eax,%ecx
+  804bb6:	48 ba a6 68 80 00 00 	movabs $0x8068a6,%rdx
+  804bbd:	00 00 00 
+  804bc0:	be 87 00 00 00       	mov    $0x87,%esi
+  804bc5:	48 bf 9a 68 80 00 00 	movabs $0x80689a,%rdi
+  804bcc:	00 00 00 
+  804bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd4:	49 b8 7d 0b 80 00 00 	movabs $0x800b7d,%r8
+  804bdb:	00 00 00 
+  804bde:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  804be1:	89 c1                	mov    %eax,%ecx
+  804be3:	48 ba bd 68 80 00 00 	movabs $0x8068bd,%rdx
+  804bea:	00 00 00 
+  804bed:	be 8a 00 00 00       	mov    $0x8a,%esi
+  804bf2:	48 bf 9a 68 80 00 00 	movabs $0x80689a,%rdi
+  804bf9:	00 00 00 
+  804bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c01:	49 b8 7d 0b 80 00 00 	movabs $0x800b7d,%r8
+  804c08:	00 00 00 
+  804c0b:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  804c0e:	89 c1                	mov    %eax,%ecx
+  804c10:	48 ba d7 68 80 00 00 	movabs $0x8068d7,%rdx
+  804c17:	00 00 00 
+  804c1a:	be 8d 00 00 00       	mov    $0x8d,%esi
+  804c1f:	48 bf 9a 68 80 00 00 	movabs $0x80689a,%rdi
+  804c26:	00 00 00 
+  804c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c2e:	49 b8 7d 0b 80 00 00 	movabs $0x800b7d,%r8
+  804c35:	00 00 00 
+  804c38:	41 ff d0             	call   *%r8
+        return -E_INVALID_EXE;
+  804c3b:	c7 85 f8 fc ff ff f8 	movl   $0xfffffff8,-0x308(%rbp)
+  804c42:	ff ff ff 
+  804c45:	eb 0b                	jmp    804c52 <spawn+0x695>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  804c47:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804c4c:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    sys_env_destroy(child);
+  804c52:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804c58:	48 b8 c4 1d 80 00 00 	movabs $0x801dc4,%rax
+  804c5f:	00 00 00 
+  804c62:	ff d0                	call   *%rax
+    close(fd);
+  804c64:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  804c6a:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  804c71:	00 00 00 
+  804c74:	ff d0                	call   *%rax
+    return res;
+  804c76:	8b 85 f8 fc ff ff    	mov    -0x308(%rbp),%eax
+  804c7c:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+}
+  804c82:	8b 85 ec fc ff ff    	mov    -0x314(%rbp),%eax
+  804c88:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  804c8f:	5b                   	pop    %rbx
+  804c90:	41 5c                	pop    %r12
+  804c92:	41 5d                	pop    %r13
+  804c94:	41 5e                	pop    %r14
+  804c96:	41 5f                	pop    %r15
+  804c98:	5d                   	pop    %rbp
+  804c99:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  804c9a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804c9f:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804ca4:	be 00 00 40 00       	mov    $0x400000,%esi
+  804ca9:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cae:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  804cb5:	00 00 00 
+  804cb8:	ff d0                	call   *%rax
+  804cba:	85 c0                	test   %eax,%eax
+  804cbc:	78 8e                	js     804c4c <spawn+0x68f>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804cbe:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  804cc5:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804cc9:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  804cd0:	f8 ff 40 00 
+  804cd4:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  804cdb:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  804cdf:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  804ce5:	e9 ef fa ff ff       	jmp    8047d9 <spawn+0x21c>
+
+0000000000804cea <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804cea:	55                   	push   %rbp
+  804ceb:	48 89 e5             	mov    %rsp,%rbp
+  804cee:	48 83 ec 50          	sub    $0x50,%rsp
+  804cf2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804cf6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804cfa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804cfe:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  804d02:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804d09:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804d0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d11:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804d15:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804d19:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804d1e:	eb 15                	jmp    804d35 <spawnl+0x4b>
+  804d20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804d24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804d28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d2c:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  804d30:	74 1c                	je     804d4e <spawnl+0x64>
+  804d32:	83 c1 01             	add    $0x1,%ecx
+  804d35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804d38:	83 f8 2f             	cmp    $0x2f,%eax
+  804d3b:	77 e3                	ja     804d20 <spawnl+0x36>
+  804d3d:	89 c2                	mov    %eax,%edx
+  804d3f:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  804d43:	4c 01 d2             	add    %r10,%rdx
+  804d46:	83 c0 08             	add    $0x8,%eax
+  804d49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804d4c:	eb de                	jmp    804d2c <spawnl+0x42>
+    const char *argv[argc + 2];
+  804d4e:	8d 41 02             	lea    0x2(%rcx),%eax
+  804d51:	48 98                	cltq
+  804d53:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  804d5a:	00 
+  804d5b:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  804d5f:	48 29 c4             	sub    %rax,%rsp
+  804d62:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  804d67:	4c 89 c0             	mov    %r8,%rax
+  804d6a:	48 c1 e8 03          	shr    $0x3,%rax
+  804d6e:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  804d72:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  804d79:	00 
+    argv[argc + 1] = NULL;
+  804d7a:	8d 41 01             	lea    0x1(%rcx),%eax
+  804d7d:	48 98                	cltq
+  804d7f:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  804d86:	00 
+    va_start(vl, arg0);
+  804d87:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804d8e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804d92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d96:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804d9a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804d9e:	85 c9                	test   %ecx,%ecx
+  804da0:	74 41                	je     804de3 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804da2:	49 89 c1             	mov    %rax,%r9
+  804da5:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804da9:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804dac:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  804db1:	eb 1b                	jmp    804dce <spawnl+0xe4>
+  804db3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804db7:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804dbb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804dbf:	48 8b 11             	mov    (%rcx),%rdx
+  804dc2:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  804dc5:	48 83 c0 08          	add    $0x8,%rax
+  804dc9:	48 39 f0             	cmp    %rsi,%rax
+  804dcc:	74 15                	je     804de3 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804dce:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804dd1:	83 fa 2f             	cmp    $0x2f,%edx
+  804dd4:	77 dd                	ja     804db3 <spawnl+0xc9>
+  804dd6:	89 d1                	mov    %edx,%ecx
+  804dd8:	4c 01 c9             	add    %r9,%rcx
+  804ddb:	83 c2 08             	add    $0x8,%edx
+  804dde:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804de1:	eb dc                	jmp    804dbf <spawnl+0xd5>
+    return spawn(prog, argv);
+  804de3:	4c 89 c6             	mov    %r8,%rsi
+  804de6:	48 b8 bd 45 80 00 00 	movabs $0x8045bd,%rax
+  804ded:	00 00 00 
+  804df0:	ff d0                	call   *%rax
+}
+  804df2:	c9                   	leave
+  804df3:	c3                   	ret
+
+0000000000804df4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804df4:	55                   	push   %rbp
+  804df5:	48 89 e5             	mov    %rsp,%rbp
+  804df8:	41 54                	push   %r12
+  804dfa:	53                   	push   %rbx
+  804dfb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804dfe:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  804e05:	00 00 00 
+  804e08:	ff d0                	call   *%rax
+  804e0a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804e0d:	48 be ee 68 80 00 00 	movabs $0x8068ee,%rsi
+  804e14:	00 00 00 
+  804e17:	48 89 df             	mov    %rbx,%rdi
+  804e1a:	48 b8 45 16 80 00 00 	movabs $0x801645,%rax
+  804e21:	00 00 00 
+  804e24:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804e26:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804e2b:	41 2b 04 24          	sub    (%r12),%eax
+  804e2f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804e35:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804e3c:	00 00 00 
+    stat->st_dev = &devpipe;
+  804e3f:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  804e46:	00 00 00 
+  804e49:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  804e50:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e55:	5b                   	pop    %rbx
+  804e56:	41 5c                	pop    %r12
+  804e58:	5d                   	pop    %rbp
+  804e59:	c3                   	ret
+
+0000000000804e5a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804e5a:	55                   	push   %rbp
+  804e5b:	48 89 e5             	mov    %rsp,%rbp
+  804e5e:	41 54                	push   %r12
+  804e60:	53                   	push   %rbx
+  804e61:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804e64:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e69:	48 89 fe             	mov    %rdi,%rsi
+  804e6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e71:	49 bc ce 20 80 00 00 	movabs $0x8020ce,%r12
+  804e78:	00 00 00 
+  804e7b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804e7e:	48 89 df             	mov    %rbx,%rdi
+  804e81:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  804e88:	00 00 00 
+  804e8b:	ff d0                	call   *%rax
+  804e8d:	48 89 c6             	mov    %rax,%rsi
+  804e90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e95:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e9a:	41 ff d4             	call   *%r12
+}
+  804e9d:	5b                   	pop    %rbx
+  804e9e:	41 5c                	pop    %r12
+  804ea0:	5d                   	pop    %rbp
+  804ea1:	c3                   	ret
+
+0000000000804ea2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804ea2:	55                   	push   %rbp
+  804ea3:	48 89 e5             	mov    %rsp,%rbp
+  804ea6:	41 57                	push   %r15
+  804ea8:	41 56                	push   %r14
+  804eaa:	41 55                	push   %r13
+  804eac:	41 54                	push   %r12
+  804eae:	53                   	push   %rbx
+  804eaf:	48 83 ec 18          	sub    $0x18,%rsp
+  804eb3:	49 89 fc             	mov    %rdi,%r12
+  804eb6:	49 89 f5             	mov    %rsi,%r13
+  804eb9:	49 89 d7             	mov    %rdx,%r15
+  804ebc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804ec0:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  804ec7:	00 00 00 
+  804eca:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804ecc:	4d 85 ff             	test   %r15,%r15
+  804ecf:	0f 84 af 00 00 00    	je     804f84 <devpipe_write+0xe2>
+  804ed5:	48 89 c3             	mov    %rax,%rbx
+  804ed8:	4c 89 f8             	mov    %r15,%rax
+  804edb:	4d 89 ef             	mov    %r13,%r15
+  804ede:	4c 01 e8             	add    %r13,%rax
+  804ee1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804ee5:	49 bd c3 1e 80 00 00 	movabs $0x801ec3,%r13
+  804eec:	00 00 00 
+            sys_yield();
+  804eef:	49 be 60 1e 80 00 00 	movabs $0x801e60,%r14
+  804ef6:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804ef9:	8b 73 04             	mov    0x4(%rbx),%esi
+  804efc:	48 63 ce             	movslq %esi,%rcx
+  804eff:	48 63 03             	movslq (%rbx),%rax
+  804f02:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804f08:	48 39 c1             	cmp    %rax,%rcx
+  804f0b:	72 2e                	jb     804f3b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804f0d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804f12:	48 89 da             	mov    %rbx,%rdx
+  804f15:	be 00 10 00 00       	mov    $0x1000,%esi
+  804f1a:	4c 89 e7             	mov    %r12,%rdi
+  804f1d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804f20:	85 c0                	test   %eax,%eax
+  804f22:	74 66                	je     804f8a <devpipe_write+0xe8>
+            sys_yield();
+  804f24:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804f27:	8b 73 04             	mov    0x4(%rbx),%esi
+  804f2a:	48 63 ce             	movslq %esi,%rcx
+  804f2d:	48 63 03             	movslq (%rbx),%rax
+  804f30:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804f36:	48 39 c1             	cmp    %rax,%rcx
+  804f39:	73 d2                	jae    804f0d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804f3b:	41 0f b6 3f          	movzbl (%r15),%edi
+  804f3f:	48 89 ca             	mov    %rcx,%rdx
+  804f42:	48 c1 ea 03          	shr    $0x3,%rdx
+  804f46:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804f4d:	08 10 20 
+  804f50:	48 f7 e2             	mul    %rdx
+  804f53:	48 c1 ea 06          	shr    $0x6,%rdx
+  804f57:	48 89 d0             	mov    %rdx,%rax
+  804f5a:	48 c1 e0 09          	shl    $0x9,%rax
+  804f5e:	48 29 d0             	sub    %rdx,%rax
+  804f61:	48 c1 e0 03          	shl    $0x3,%rax
+  804f65:	48 29 c1             	sub    %rax,%rcx
+  804f68:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804f6d:	83 c6 01             	add    $0x1,%esi
+  804f70:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804f73:	49 83 c7 01          	add    $0x1,%r15
+  804f77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f7b:	49 39 c7             	cmp    %rax,%r15
+  804f7e:	0f 85 75 ff ff ff    	jne    804ef9 <devpipe_write+0x57>
+    return n;
+  804f84:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f88:	eb 05                	jmp    804f8f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f8f:	48 83 c4 18          	add    $0x18,%rsp
+  804f93:	5b                   	pop    %rbx
+  804f94:	41 5c                	pop    %r12
+  804f96:	41 5d                	pop    %r13
+  804f98:	41 5e                	pop    %r14
+  804f9a:	41 5f                	pop    %r15
+  804f9c:	5d                   	pop    %rbp
+  804f9d:	c3                   	ret
+
+0000000000804f9e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f9e:	55                   	push   %rbp
+  804f9f:	48 89 e5             	mov    %rsp,%rbp
+  804fa2:	41 57                	push   %r15
+  804fa4:	41 56                	push   %r14
+  804fa6:	41 55                	push   %r13
+  804fa8:	41 54                	push   %r12
+  804faa:	53                   	push   %rbx
+  804fab:	48 83 ec 18          	sub    $0x18,%rsp
+  804faf:	49 89 fc             	mov    %rdi,%r12
+  804fb2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804fb6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804fba:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  804fc1:	00 00 00 
+  804fc4:	ff d0                	call   *%rax
+  804fc6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804fc9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804fcf:	49 bd c3 1e 80 00 00 	movabs $0x801ec3,%r13
+  804fd6:	00 00 00 
+            sys_yield();
+  804fd9:	49 be 60 1e 80 00 00 	movabs $0x801e60,%r14
+  804fe0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804fe3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804fe8:	74 7d                	je     805067 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804fea:	8b 03                	mov    (%rbx),%eax
+  804fec:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804fef:	75 26                	jne    805017 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804ff1:	4d 85 ff             	test   %r15,%r15
+  804ff4:	75 77                	jne    80506d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804ff6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804ffb:	48 89 da             	mov    %rbx,%rdx
+  804ffe:	be 00 10 00 00       	mov    $0x1000,%esi
+  805003:	4c 89 e7             	mov    %r12,%rdi
+  805006:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  805009:	85 c0                	test   %eax,%eax
+  80500b:	74 72                	je     80507f <devpipe_read+0xe1>
+            sys_yield();
+  80500d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  805010:	8b 03                	mov    (%rbx),%eax
+  805012:	3b 43 04             	cmp    0x4(%rbx),%eax
+  805015:	74 df                	je     804ff6 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805017:	48 63 c8             	movslq %eax,%rcx
+  80501a:	48 89 ca             	mov    %rcx,%rdx
+  80501d:	48 c1 ea 03          	shr    $0x3,%rdx
+  805021:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  805028:	08 10 20 
+  80502b:	48 89 d0             	mov    %rdx,%rax
+  80502e:	48 f7 e6             	mul    %rsi
+  805031:	48 c1 ea 06          	shr    $0x6,%rdx
+  805035:	48 89 d0             	mov    %rdx,%rax
+  805038:	48 c1 e0 09          	shl    $0x9,%rax
+  80503c:	48 29 d0             	sub    %rdx,%rax
+  80503f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805046:	00 
+  805047:	48 89 c8             	mov    %rcx,%rax
+  80504a:	48 29 d0             	sub    %rdx,%rax
+  80504d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  805052:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  805056:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80505a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80505d:	49 83 c7 01          	add    $0x1,%r15
+  805061:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  805065:	75 83                	jne    804fea <devpipe_read+0x4c>
+    return n;
+  805067:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80506b:	eb 03                	jmp    805070 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80506d:	4c 89 f8             	mov    %r15,%rax
+}
+  805070:	48 83 c4 18          	add    $0x18,%rsp
+  805074:	5b                   	pop    %rbx
+  805075:	41 5c                	pop    %r12
+  805077:	41 5d                	pop    %r13
+  805079:	41 5e                	pop    %r14
+  80507b:	41 5f                	pop    %r15
+  80507d:	5d                   	pop    %rbp
+  80507e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80507f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805084:	eb ea                	jmp    805070 <devpipe_read+0xd2>
+
+0000000000805086 <pipe>:
+pipe(int pfd[2]) {
+  805086:	55                   	push   %rbp
+  805087:	48 89 e5             	mov    %rsp,%rbp
+  80508a:	41 55                	push   %r13
+  80508c:	41 54                	push   %r12
+  80508e:	53                   	push   %rbx
+  80508f:	48 83 ec 18          	sub    $0x18,%rsp
+  805093:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  805096:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80509a:	48 b8 bb 2b 80 00 00 	movabs $0x802bbb,%rax
+  8050a1:	00 00 00 
+  8050a4:	ff d0                	call   *%rax
+  8050a6:	89 c3                	mov    %eax,%ebx
+  8050a8:	85 c0                	test   %eax,%eax
+  8050aa:	0f 88 a0 01 00 00    	js     805250 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8050b0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8050b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8050ba:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8050be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050c3:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  8050ca:	00 00 00 
+  8050cd:	ff d0                	call   *%rax
+  8050cf:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8050d1:	85 c0                	test   %eax,%eax
+  8050d3:	0f 88 77 01 00 00    	js     805250 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8050d9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8050dd:	48 b8 bb 2b 80 00 00 	movabs $0x802bbb,%rax
+  8050e4:	00 00 00 
+  8050e7:	ff d0                	call   *%rax
+  8050e9:	89 c3                	mov    %eax,%ebx
+  8050eb:	85 c0                	test   %eax,%eax
+  8050ed:	0f 88 43 01 00 00    	js     805236 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8050f3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8050f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8050fd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  805101:	bf 00 00 00 00       	mov    $0x0,%edi
+  805106:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  80510d:	00 00 00 
+  805110:	ff d0                	call   *%rax
+  805112:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  805114:	85 c0                	test   %eax,%eax
+  805116:	0f 88 1a 01 00 00    	js     805236 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80511c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  805120:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  805127:	00 00 00 
+  80512a:	ff d0                	call   *%rax
+  80512c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80512f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805134:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805139:	48 89 c6             	mov    %rax,%rsi
+  80513c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805141:	48 b8 ef 1e 80 00 00 	movabs $0x801eef,%rax
+  805148:	00 00 00 
+  80514b:	ff d0                	call   *%rax
+  80514d:	89 c3                	mov    %eax,%ebx
+  80514f:	85 c0                	test   %eax,%eax
+  805151:	0f 88 c5 00 00 00    	js     80521c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  805157:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80515b:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  805162:	00 00 00 
+  805165:	ff d0                	call   *%rax
+  805167:	48 89 c1             	mov    %rax,%rcx
+  80516a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  805170:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  805176:	ba 00 00 00 00       	mov    $0x0,%edx
+  80517b:	4c 89 ee             	mov    %r13,%rsi
+  80517e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805183:	48 b8 56 1f 80 00 00 	movabs $0x801f56,%rax
+  80518a:	00 00 00 
+  80518d:	ff d0                	call   *%rax
+  80518f:	89 c3                	mov    %eax,%ebx
+  805191:	85 c0                	test   %eax,%eax
+  805193:	78 6e                	js     805203 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  805195:	be 00 10 00 00       	mov    $0x1000,%esi
+  80519a:	4c 89 ef             	mov    %r13,%rdi
+  80519d:	48 b8 91 1e 80 00 00 	movabs $0x801e91,%rax
+  8051a4:	00 00 00 
+  8051a7:	ff d0                	call   *%rax
+  8051a9:	83 f8 02             	cmp    $0x2,%eax
+  8051ac:	0f 85 ab 00 00 00    	jne    80525d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8051b2:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  8051b9:	00 00 
+  8051bb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8051bf:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8051c1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8051c5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8051cc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8051d0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8051d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8051d6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8051dd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8051e1:	48 bb 8d 2b 80 00 00 	movabs $0x802b8d,%rbx
+  8051e8:	00 00 00 
+  8051eb:	ff d3                	call   *%rbx
+  8051ed:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8051f1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8051f5:	ff d3                	call   *%rbx
+  8051f7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8051fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805201:	eb 4d                	jmp    805250 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  805203:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805208:	4c 89 ee             	mov    %r13,%rsi
+  80520b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805210:	48 b8 ce 20 80 00 00 	movabs $0x8020ce,%rax
+  805217:	00 00 00 
+  80521a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80521c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805221:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  805225:	bf 00 00 00 00       	mov    $0x0,%edi
+  80522a:	48 b8 ce 20 80 00 00 	movabs $0x8020ce,%rax
+  805231:	00 00 00 
+  805234:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  805236:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80523b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80523f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805244:	48 b8 ce 20 80 00 00 	movabs $0x8020ce,%rax
+  80524b:	00 00 00 
+  80524e:	ff d0                	call   *%rax
+}
+  805250:	89 d8                	mov    %ebx,%eax
+  805252:	48 83 c4 18          	add    $0x18,%rsp
+  805256:	5b                   	pop    %rbx
+  805257:	41 5c                	pop    %r12
+  805259:	41 5d                	pop    %r13
+  80525b:	5d                   	pop    %rbp
+  80525c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80525d:	48 b9 08 69 80 00 00 	movabs $0x806908,%rcx
+  805264:	00 00 00 
+  805267:	48 ba a9 60 80 00 00 	movabs $0x8060a9,%rdx
+  80526e:	00 00 00 
+  805271:	be 2e 00 00 00       	mov    $0x2e,%esi
+  805276:	48 bf f5 68 80 00 00 	movabs $0x8068f5,%rdi
+  80527d:	00 00 00 
+  805280:	b8 00 00 00 00       	mov    $0x0,%eax
+  805285:	49 b8 7d 0b 80 00 00 	movabs $0x800b7d,%r8
+  80528c:	00 00 00 
+  80528f:	41 ff d0             	call   *%r8
+
+0000000000805292 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  805292:	55                   	push   %rbp
+  805293:	48 89 e5             	mov    %rsp,%rbp
+  805296:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80529a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80529e:	48 b8 1b 2c 80 00 00 	movabs $0x802c1b,%rax
+  8052a5:	00 00 00 
+  8052a8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8052aa:	85 c0                	test   %eax,%eax
+  8052ac:	78 35                	js     8052e3 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8052ae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8052b2:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  8052b9:	00 00 00 
+  8052bc:	ff d0                	call   *%rax
+  8052be:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8052c1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8052c6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8052cb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8052cf:	48 b8 c3 1e 80 00 00 	movabs $0x801ec3,%rax
+  8052d6:	00 00 00 
+  8052d9:	ff d0                	call   *%rax
+  8052db:	85 c0                	test   %eax,%eax
+  8052dd:	0f 94 c0             	sete   %al
+  8052e0:	0f b6 c0             	movzbl %al,%eax
+}
+  8052e3:	c9                   	leave
+  8052e4:	c3                   	ret
+
+00000000008052e5 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8052e5:	55                   	push   %rbp
+  8052e6:	48 89 e5             	mov    %rsp,%rbp
+  8052e9:	41 55                	push   %r13
+  8052eb:	41 54                	push   %r12
+  8052ed:	53                   	push   %rbx
+  8052ee:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  8052f2:	85 ff                	test   %edi,%edi
+  8052f4:	74 73                	je     805369 <wait+0x84>
+  8052f6:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8052f9:	89 f8                	mov    %edi,%eax
+  8052fb:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  805300:	89 f9                	mov    %edi,%ecx
+  805302:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  805308:	48 69 c9 68 01 00 00 	imul   $0x168,%rcx,%rcx
+  80530f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805316:	00 00 00 
+  805319:	48 01 ca             	add    %rcx,%rdx
+  80531c:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  805322:	39 d7                	cmp    %edx,%edi
+  805324:	75 38                	jne    80535e <wait+0x79>
+           env->env_status != ENV_FREE) {
+  805326:	48 98                	cltq
+  805328:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80532f:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  805336:	00 00 00 
+  805339:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  80533c:	49 bd 60 1e 80 00 00 	movabs $0x801e60,%r13
+  805343:	00 00 00 
+           env->env_status != ENV_FREE) {
+  805346:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  80534c:	85 c0                	test   %eax,%eax
+  80534e:	74 0e                	je     80535e <wait+0x79>
+        sys_yield();
+  805350:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  805353:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  805359:	44 39 e0             	cmp    %r12d,%eax
+  80535c:	74 e8                	je     805346 <wait+0x61>
+    }
+}
+  80535e:	48 83 c4 08          	add    $0x8,%rsp
+  805362:	5b                   	pop    %rbx
+  805363:	41 5c                	pop    %r12
+  805365:	41 5d                	pop    %r13
+  805367:	5d                   	pop    %rbp
+  805368:	c3                   	ret
+    assert(envid != 0);
+  805369:	48 b9 2c 69 80 00 00 	movabs $0x80692c,%rcx
+  805370:	00 00 00 
+  805373:	48 ba a9 60 80 00 00 	movabs $0x8060a9,%rdx
+  80537a:	00 00 00 
+  80537d:	be 06 00 00 00       	mov    $0x6,%esi
+  805382:	48 bf 37 69 80 00 00 	movabs $0x806937,%rdi
+  805389:	00 00 00 
+  80538c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805391:	49 b8 7d 0b 80 00 00 	movabs $0x800b7d,%r8
+  805398:	00 00 00 
+  80539b:	41 ff d0             	call   *%r8
+
+000000000080539e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80539e:	48 89 f8             	mov    %rdi,%rax
+  8053a1:	48 c1 e8 27          	shr    $0x27,%rax
+  8053a5:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8053ac:	7f 00 00 
+  8053af:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8053b3:	f6 c2 01             	test   $0x1,%dl
+  8053b6:	74 6d                	je     805425 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8053b8:	48 89 f8             	mov    %rdi,%rax
+  8053bb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8053bf:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8053c6:	7f 00 00 
+  8053c9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8053cd:	f6 c2 01             	test   $0x1,%dl
+  8053d0:	74 62                	je     805434 <get_uvpt_entry+0x96>
+  8053d2:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8053d9:	7f 00 00 
+  8053dc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8053e0:	f6 c2 80             	test   $0x80,%dl
+  8053e3:	75 4f                	jne    805434 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8053e5:	48 89 f8             	mov    %rdi,%rax
+  8053e8:	48 c1 e8 15          	shr    $0x15,%rax
+  8053ec:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8053f3:	7f 00 00 
+  8053f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8053fa:	f6 c2 01             	test   $0x1,%dl
+  8053fd:	74 44                	je     805443 <get_uvpt_entry+0xa5>
+  8053ff:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  805406:	7f 00 00 
+  805409:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80540d:	f6 c2 80             	test   $0x80,%dl
+  805410:	75 31                	jne    805443 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  805412:	48 c1 ef 0c          	shr    $0xc,%rdi
+  805416:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80541d:	7f 00 00 
+  805420:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  805424:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  805425:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80542c:	7f 00 00 
+  80542f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805433:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805434:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80543b:	7f 00 00 
+  80543e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805442:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  805443:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80544a:	7f 00 00 
+  80544d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805451:	c3                   	ret
+
+0000000000805452 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  805452:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  805455:	48 89 f9             	mov    %rdi,%rcx
+  805458:	48 c1 e9 27          	shr    $0x27,%rcx
+  80545c:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  805463:	7f 00 00 
+  805466:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80546a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  805471:	f6 c1 01             	test   $0x1,%cl
+  805474:	0f 84 b2 00 00 00    	je     80552c <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80547a:	48 89 f9             	mov    %rdi,%rcx
+  80547d:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  805481:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  805488:	7f 00 00 
+  80548b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80548f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  805496:	40 f6 c6 01          	test   $0x1,%sil
+  80549a:	0f 84 8c 00 00 00    	je     80552c <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8054a0:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8054a7:	7f 00 00 
+  8054aa:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8054ae:	a8 80                	test   $0x80,%al
+  8054b0:	75 7b                	jne    80552d <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8054b2:	48 89 f9             	mov    %rdi,%rcx
+  8054b5:	48 c1 e9 15          	shr    $0x15,%rcx
+  8054b9:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8054c0:	7f 00 00 
+  8054c3:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8054c7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8054ce:	40 f6 c6 01          	test   $0x1,%sil
+  8054d2:	74 58                	je     80552c <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8054d4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8054db:	7f 00 00 
+  8054de:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8054e2:	a8 80                	test   $0x80,%al
+  8054e4:	75 6c                	jne    805552 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8054e6:	48 89 f9             	mov    %rdi,%rcx
+  8054e9:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8054ed:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8054f4:	7f 00 00 
+  8054f7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8054fb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  805502:	40 f6 c6 01          	test   $0x1,%sil
+  805506:	74 24                	je     80552c <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  805508:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80550f:	7f 00 00 
+  805512:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  805516:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80551d:	ff ff 7f 
+  805520:	48 21 c8             	and    %rcx,%rax
+  805523:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  805529:	48 09 d0             	or     %rdx,%rax
+}
+  80552c:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80552d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  805534:	7f 00 00 
+  805537:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80553b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  805542:	ff ff 7f 
+  805545:	48 21 c8             	and    %rcx,%rax
+  805548:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80554e:	48 01 d0             	add    %rdx,%rax
+  805551:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  805552:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  805559:	7f 00 00 
+  80555c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  805560:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  805567:	ff ff 7f 
+  80556a:	48 21 c8             	and    %rcx,%rax
+  80556d:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  805573:	48 01 d0             	add    %rdx,%rax
+  805576:	c3                   	ret
+
+0000000000805577 <get_prot>:
+
+int
+get_prot(void *va) {
+  805577:	55                   	push   %rbp
+  805578:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80557b:	48 b8 9e 53 80 00 00 	movabs $0x80539e,%rax
+  805582:	00 00 00 
+  805585:	ff d0                	call   *%rax
+  805587:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80558a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80558f:	89 c1                	mov    %eax,%ecx
+  805591:	83 c9 04             	or     $0x4,%ecx
+  805594:	f6 c2 01             	test   $0x1,%dl
+  805597:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80559a:	89 c1                	mov    %eax,%ecx
+  80559c:	83 c9 02             	or     $0x2,%ecx
+  80559f:	f6 c2 02             	test   $0x2,%dl
+  8055a2:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8055a5:	89 c1                	mov    %eax,%ecx
+  8055a7:	83 c9 01             	or     $0x1,%ecx
+  8055aa:	48 85 d2             	test   %rdx,%rdx
+  8055ad:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8055b0:	89 c1                	mov    %eax,%ecx
+  8055b2:	83 c9 40             	or     $0x40,%ecx
+  8055b5:	f6 c6 04             	test   $0x4,%dh
+  8055b8:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8055bb:	5d                   	pop    %rbp
+  8055bc:	c3                   	ret
+
+00000000008055bd <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8055bd:	55                   	push   %rbp
+  8055be:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8055c1:	48 b8 9e 53 80 00 00 	movabs $0x80539e,%rax
+  8055c8:	00 00 00 
+  8055cb:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8055cd:	48 c1 e8 06          	shr    $0x6,%rax
+  8055d1:	83 e0 01             	and    $0x1,%eax
+}
+  8055d4:	5d                   	pop    %rbp
+  8055d5:	c3                   	ret
+
+00000000008055d6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8055d6:	55                   	push   %rbp
+  8055d7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8055da:	48 b8 9e 53 80 00 00 	movabs $0x80539e,%rax
+  8055e1:	00 00 00 
+  8055e4:	ff d0                	call   *%rax
+  8055e6:	83 e0 01             	and    $0x1,%eax
+}
+  8055e9:	5d                   	pop    %rbp
+  8055ea:	c3                   	ret
+
+00000000008055eb <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8055eb:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8055f2:	7f 00 00 
+  8055f5:	a8 01                	test   $0x1,%al
+  8055f7:	75 06                	jne    8055ff <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8055f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055fe:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8055ff:	55                   	push   %rbp
+  805600:	48 89 e5             	mov    %rsp,%rbp
+  805603:	41 57                	push   %r15
+  805605:	41 56                	push   %r14
+  805607:	41 55                	push   %r13
+  805609:	41 54                	push   %r12
+  80560b:	53                   	push   %rbx
+  80560c:	48 83 ec 18          	sub    $0x18,%rsp
+  805610:	49 89 fe             	mov    %rdi,%r14
+  805613:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  805616:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80561d:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80561e:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  805625:	7f 00 00 
+  805628:	e9 81 00 00 00       	jmp    8056ae <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  80562d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  805634:	49 39 dd             	cmp    %rbx,%r13
+  805637:	74 2b                	je     805664 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  805639:	48 89 d8             	mov    %rbx,%rax
+  80563c:	48 c1 e8 0c          	shr    $0xc,%rax
+  805640:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  805644:	f6 c2 01             	test   $0x1,%dl
+  805647:	74 e4                	je     80562d <foreach_shared_region+0x42>
+  805649:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  80564d:	f6 c4 04             	test   $0x4,%ah
+  805650:	74 db                	je     80562d <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  805652:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  805659:	4c 89 fa             	mov    %r15,%rdx
+  80565c:	48 89 df             	mov    %rbx,%rdi
+  80565f:	41 ff d6             	call   *%r14
+  805662:	eb c9                	jmp    80562d <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  805664:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  80566b:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  80566f:	74 22                	je     805693 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  805671:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  805678:	48 89 d8             	mov    %rbx,%rax
+  80567b:	48 c1 e8 15          	shr    $0x15,%rax
+  80567f:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  805686:	7f 00 00 
+  805689:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80568d:	a8 01                	test   $0x1,%al
+  80568f:	74 d3                	je     805664 <foreach_shared_region+0x79>
+  805691:	eb a6                	jmp    805639 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  805693:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  80569a:	40 
+  80569b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80569f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8056a6:	00 00 00 
+  8056a9:	48 39 c1             	cmp    %rax,%rcx
+  8056ac:	74 31                	je     8056df <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  8056ae:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8056b2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8056b6:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8056bd:	7f 00 00 
+  8056c0:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8056c4:	a8 01                	test   $0x1,%al
+  8056c6:	74 cb                	je     805693 <foreach_shared_region+0xa8>
+  8056c8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8056cc:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8056d3:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8056d9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8056dd:	eb 92                	jmp    805671 <foreach_shared_region+0x86>
+}
+  8056df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056e4:	48 83 c4 18          	add    $0x18,%rsp
+  8056e8:	5b                   	pop    %rbx
+  8056e9:	41 5c                	pop    %r12
+  8056eb:	41 5d                	pop    %r13
+  8056ed:	41 5e                	pop    %r14
+  8056ef:	41 5f                	pop    %r15
+  8056f1:	5d                   	pop    %rbp
+  8056f2:	c3                   	ret
+
+00000000008056f3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8056f3:	55                   	push   %rbp
+  8056f4:	48 89 e5             	mov    %rsp,%rbp
+  8056f7:	41 55                	push   %r13
+  8056f9:	41 54                	push   %r12
+  8056fb:	53                   	push   %rbx
+  8056fc:	48 83 ec 08          	sub    $0x8,%rsp
+  805700:	49 89 fc             	mov    %rdi,%r12
+  805703:	48 89 f7             	mov    %rsi,%rdi
+  805706:	48 89 d3             	mov    %rdx,%rbx
+  805709:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80570c:	48 85 f6             	test   %rsi,%rsi
+  80570f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805716:	00 00 00 
+  805719:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80571d:	be 00 10 00 00       	mov    $0x1000,%esi
+  805722:	48 85 d2             	test   %rdx,%rdx
+  805725:	74 03                	je     80572a <ipc_recv+0x37>
+  805727:	48 8b 32             	mov    (%rdx),%rsi
+  80572a:	48 b8 9c 22 80 00 00 	movabs $0x80229c,%rax
+  805731:	00 00 00 
+  805734:	ff d0                	call   *%rax
+    if (errno) {
+  805736:	85 c0                	test   %eax,%eax
+  805738:	74 1c                	je     805756 <ipc_recv+0x63>
+        if (from_env_store)
+  80573a:	4d 85 e4             	test   %r12,%r12
+  80573d:	74 08                	je     805747 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80573f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  805746:	00 
+
+        if (perm_store)
+  805747:	4d 85 ed             	test   %r13,%r13
+  80574a:	74 74                	je     8057c0 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80574c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  805753:	00 
+  805754:	eb 6a                	jmp    8057c0 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  805756:	4d 85 e4             	test   %r12,%r12
+  805759:	74 14                	je     80576f <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80575b:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  805762:	00 00 00 
+  805765:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80576b:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80576f:	48 85 db             	test   %rbx,%rbx
+  805772:	74 23                	je     805797 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  805774:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  80577b:	00 00 00 
+  80577e:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  805784:	ba 00 00 00 00       	mov    $0x0,%edx
+  805789:	85 c9                	test   %ecx,%ecx
+  80578b:	74 07                	je     805794 <ipc_recv+0xa1>
+  80578d:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  805794:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  805797:	4d 85 ed             	test   %r13,%r13
+  80579a:	74 14                	je     8057b0 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80579c:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  8057a3:	00 00 00 
+  8057a6:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8057ac:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8057b0:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  8057b7:	00 00 00 
+  8057ba:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8057c0:	48 83 c4 08          	add    $0x8,%rsp
+  8057c4:	5b                   	pop    %rbx
+  8057c5:	41 5c                	pop    %r12
+  8057c7:	41 5d                	pop    %r13
+  8057c9:	5d                   	pop    %rbp
+  8057ca:	c3                   	ret
+
+00000000008057cb <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8057cb:	55                   	push   %rbp
+  8057cc:	48 89 e5             	mov    %rsp,%rbp
+  8057cf:	41 55                	push   %r13
+  8057d1:	41 54                	push   %r12
+  8057d3:	53                   	push   %rbx
+  8057d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8057d8:	49 89 fc             	mov    %rdi,%r12
+  8057db:	48 89 f7             	mov    %rsi,%rdi
+  8057de:	48 89 d3             	mov    %rdx,%rbx
+  8057e1:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8057e4:	48 85 f6             	test   %rsi,%rsi
+  8057e7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057ee:	00 00 00 
+  8057f1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8057f5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8057fa:	48 85 d2             	test   %rdx,%rdx
+  8057fd:	74 03                	je     805802 <ipc_try_recv+0x37>
+  8057ff:	48 8b 32             	mov    (%rdx),%rsi
+  805802:	48 b8 05 23 80 00 00 	movabs $0x802305,%rax
+  805809:	00 00 00 
+  80580c:	ff d0                	call   *%rax
+    if (errno) {
+  80580e:	85 c0                	test   %eax,%eax
+  805810:	75 75                	jne    805887 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  805812:	4d 85 e4             	test   %r12,%r12
+  805815:	74 14                	je     80582b <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  805817:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  80581e:	00 00 00 
+  805821:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  805827:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80582b:	48 85 db             	test   %rbx,%rbx
+  80582e:	74 23                	je     805853 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  805830:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  805837:	00 00 00 
+  80583a:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  805840:	ba 00 00 00 00       	mov    $0x0,%edx
+  805845:	85 c9                	test   %ecx,%ecx
+  805847:	74 07                	je     805850 <ipc_try_recv+0x85>
+  805849:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  805850:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  805853:	4d 85 ed             	test   %r13,%r13
+  805856:	74 14                	je     80586c <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  805858:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  80585f:	00 00 00 
+  805862:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  805868:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80586c:	48 a1 18 80 80 00 00 	movabs 0x808018,%rax
+  805873:	00 00 00 
+  805876:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80587c:	48 83 c4 08          	add    $0x8,%rsp
+  805880:	5b                   	pop    %rbx
+  805881:	41 5c                	pop    %r12
+  805883:	41 5d                	pop    %r13
+  805885:	5d                   	pop    %rbp
+  805886:	c3                   	ret
+        if (from_env_store)
+  805887:	4d 85 e4             	test   %r12,%r12
+  80588a:	74 08                	je     805894 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80588c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  805893:	00 
+        if (perm_store)
+  805894:	4d 85 ed             	test   %r13,%r13
+  805897:	74 e3                	je     80587c <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  805899:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8058a0:	00 
+  8058a1:	eb d9                	jmp    80587c <ipc_try_recv+0xb1>
+
+00000000008058a3 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8058a3:	55                   	push   %rbp
+  8058a4:	48 89 e5             	mov    %rsp,%rbp
+  8058a7:	41 57                	push   %r15
+  8058a9:	41 56                	push   %r14
+  8058ab:	41 55                	push   %r13
+  8058ad:	41 54                	push   %r12
+  8058af:	53                   	push   %rbx
+  8058b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8058b4:	41 89 fd             	mov    %edi,%r13d
+  8058b7:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8058ba:	48 89 d3             	mov    %rdx,%rbx
+  8058bd:	49 89 cc             	mov    %rcx,%r12
+  8058c0:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8058c4:	48 85 d2             	test   %rdx,%rdx
+  8058c7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8058ce:	00 00 00 
+  8058d1:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8058d5:	49 be 70 22 80 00 00 	movabs $0x802270,%r14
+  8058dc:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8058df:	49 bf 60 1e 80 00 00 	movabs $0x801e60,%r15
+  8058e6:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8058e9:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8058ec:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8058f0:	4c 89 e1             	mov    %r12,%rcx
+  8058f3:	48 89 da             	mov    %rbx,%rdx
+  8058f6:	44 89 ef             	mov    %r13d,%edi
+  8058f9:	41 ff d6             	call   *%r14
+  8058fc:	85 c0                	test   %eax,%eax
+  8058fe:	74 37                	je     805937 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  805900:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  805903:	75 05                	jne    80590a <ipc_send+0x67>
+        sys_yield();
+  805905:	41 ff d7             	call   *%r15
+  805908:	eb df                	jmp    8058e9 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80590a:	89 c1                	mov    %eax,%ecx
+  80590c:	48 ba 42 69 80 00 00 	movabs $0x806942,%rdx
+  805913:	00 00 00 
+  805916:	be 65 00 00 00       	mov    $0x65,%esi
+  80591b:	48 bf 5d 69 80 00 00 	movabs $0x80695d,%rdi
+  805922:	00 00 00 
+  805925:	b8 00 00 00 00       	mov    $0x0,%eax
+  80592a:	49 b8 7d 0b 80 00 00 	movabs $0x800b7d,%r8
+  805931:	00 00 00 
+  805934:	41 ff d0             	call   *%r8
+    }
+}
+  805937:	48 83 c4 18          	add    $0x18,%rsp
+  80593b:	5b                   	pop    %rbx
+  80593c:	41 5c                	pop    %r12
+  80593e:	41 5d                	pop    %r13
+  805940:	41 5e                	pop    %r14
+  805942:	41 5f                	pop    %r15
+  805944:	5d                   	pop    %rbp
+  805945:	c3                   	ret
+
+0000000000805946 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805946:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80594b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805952:	00 00 00 
+  805955:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80595c:	48 01 ca             	add    %rcx,%rdx
+  80595f:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  805965:	39 fa                	cmp    %edi,%edx
+  805967:	74 12                	je     80597b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805969:	48 83 c0 01          	add    $0x1,%rax
+  80596d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805973:	75 e0                	jne    805955 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805975:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80597a:	c3                   	ret
+            return envs[i].env_id;
+  80597b:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  805982:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805989:	00 00 00 
+  80598c:	48 01 d0             	add    %rdx,%rax
+  80598f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805995:	c3                   	ret
+
+0000000000805996 <__text_end>:
+  805996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80599d:	00 00 00 
+  8059a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059a7:	00 00 00 
+  8059aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059b1:	00 00 00 
+  8059b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059bb:	00 00 00 
+  8059be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059c5:	00 00 00 
+  8059c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059cf:	00 00 00 
+  8059d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059d9:	00 00 00 
+  8059dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059e3:	00 00 00 
+  8059e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059ed:	00 00 00 
+  8059f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059f7:	00 00 00 
+  8059fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a01:	00 00 00 
+  805a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a0b:	00 00 00 
+  805a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a15:	00 00 00 
+  805a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a1f:	00 00 00 
+  805a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a29:	00 00 00 
+  805a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a33:	00 00 00 
+  805a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a3d:	00 00 00 
+  805a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a47:	00 00 00 
+  805a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a51:	00 00 00 
+  805a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a5b:	00 00 00 
+  805a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a65:	00 00 00 
+  805a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a6f:	00 00 00 
+  805a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a79:	00 00 00 
+  805a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a83:	00 00 00 
+  805a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a8d:	00 00 00 
+  805a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a97:	00 00 00 
+  805a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aa1:	00 00 00 
+  805aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805aab:	00 00 00 
+  805aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ab5:	00 00 00 
+  805ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805abf:	00 00 00 
+  805ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ac9:	00 00 00 
+  805acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ad3:	00 00 00 
+  805ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805add:	00 00 00 
+  805ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ae7:	00 00 00 
+  805aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805af1:	00 00 00 
+  805af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805afb:	00 00 00 
+  805afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b05:	00 00 00 
+  805b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b0f:	00 00 00 
+  805b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b19:	00 00 00 
+  805b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b23:	00 00 00 
+  805b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b2d:	00 00 00 
+  805b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b37:	00 00 00 
+  805b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b41:	00 00 00 
+  805b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b4b:	00 00 00 
+  805b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b55:	00 00 00 
+  805b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b5f:	00 00 00 
+  805b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b69:	00 00 00 
+  805b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b73:	00 00 00 
+  805b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b7d:	00 00 00 
+  805b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b87:	00 00 00 
+  805b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b91:	00 00 00 
+  805b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805b9b:	00 00 00 
+  805b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ba5:	00 00 00 
+  805ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805baf:	00 00 00 
+  805bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bb9:	00 00 00 
+  805bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bc3:	00 00 00 
+  805bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bcd:	00 00 00 
+  805bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bd7:	00 00 00 
+  805bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805be1:	00 00 00 
+  805be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805beb:	00 00 00 
+  805bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bf5:	00 00 00 
+  805bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805bff:	00 00 00 
+  805c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c09:	00 00 00 
+  805c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c13:	00 00 00 
+  805c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c1d:	00 00 00 
+  805c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c27:	00 00 00 
+  805c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c31:	00 00 00 
+  805c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c3b:	00 00 00 
+  805c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c45:	00 00 00 
+  805c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c4f:	00 00 00 
+  805c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c59:	00 00 00 
+  805c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c63:	00 00 00 
+  805c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c6d:	00 00 00 
+  805c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c77:	00 00 00 
+  805c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c81:	00 00 00 
+  805c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c8b:	00 00 00 
+  805c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c95:	00 00 00 
+  805c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805c9f:	00 00 00 
+  805ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ca9:	00 00 00 
+  805cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cb3:	00 00 00 
+  805cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cbd:	00 00 00 
+  805cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cc7:	00 00 00 
+  805cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cd1:	00 00 00 
+  805cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cdb:	00 00 00 
+  805cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ce5:	00 00 00 
+  805ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cef:	00 00 00 
+  805cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805cf9:	00 00 00 
+  805cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d03:	00 00 00 
+  805d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d0d:	00 00 00 
+  805d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d17:	00 00 00 
+  805d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d21:	00 00 00 
+  805d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d2b:	00 00 00 
+  805d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d35:	00 00 00 
+  805d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d3f:	00 00 00 
+  805d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d49:	00 00 00 
+  805d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d53:	00 00 00 
+  805d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d5d:	00 00 00 
+  805d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d67:	00 00 00 
+  805d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d71:	00 00 00 
+  805d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d7b:	00 00 00 
+  805d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d85:	00 00 00 
+  805d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d8f:	00 00 00 
+  805d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805d99:	00 00 00 
+  805d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805da3:	00 00 00 
+  805da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dad:	00 00 00 
+  805db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805db7:	00 00 00 
+  805dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dc1:	00 00 00 
+  805dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dcb:	00 00 00 
+  805dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dd5:	00 00 00 
+  805dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ddf:	00 00 00 
+  805de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805de9:	00 00 00 
+  805dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805df3:	00 00 00 
+  805df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805dfd:	00 00 00 
+  805e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e07:	00 00 00 
+  805e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e11:	00 00 00 
+  805e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e1b:	00 00 00 
+  805e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e25:	00 00 00 
+  805e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e2f:	00 00 00 
+  805e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e39:	00 00 00 
+  805e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e43:	00 00 00 
+  805e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e4d:	00 00 00 
+  805e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e57:	00 00 00 
+  805e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e61:	00 00 00 
+  805e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e6b:	00 00 00 
+  805e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e75:	00 00 00 
+  805e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e7f:	00 00 00 
+  805e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e89:	00 00 00 
+  805e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e93:	00 00 00 
+  805e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805e9d:	00 00 00 
+  805ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ea7:	00 00 00 
+  805eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eb1:	00 00 00 
+  805eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ebb:	00 00 00 
+  805ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ec5:	00 00 00 
+  805ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ecf:	00 00 00 
+  805ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ed9:	00 00 00 
+  805edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ee3:	00 00 00 
+  805ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805eed:	00 00 00 
+  805ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ef7:	00 00 00 
+  805efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f01:	00 00 00 
+  805f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f0b:	00 00 00 
+  805f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f15:	00 00 00 
+  805f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f1f:	00 00 00 
+  805f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f29:	00 00 00 
+  805f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f33:	00 00 00 
+  805f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f3d:	00 00 00 
+  805f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f47:	00 00 00 
+  805f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f51:	00 00 00 
+  805f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f5b:	00 00 00 
+  805f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f65:	00 00 00 
+  805f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f6f:	00 00 00 
+  805f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f79:	00 00 00 
+  805f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f83:	00 00 00 
+  805f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f8d:	00 00 00 
+  805f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805f97:	00 00 00 
+  805f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fa1:	00 00 00 
+  805fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fab:	00 00 00 
+  805fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fb5:	00 00 00 
+  805fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fbf:	00 00 00 
+  805fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fc9:	00 00 00 
+  805fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fd3:	00 00 00 
+  805fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fdd:	00 00 00 
+  805fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805fe7:	00 00 00 
+  805fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ff1:	00 00 00 
+  805ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805ffb:	00 00 00 
+  805ffe:	66 90                	xchg   %ax,%ax
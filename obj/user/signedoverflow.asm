@@ -0,0 +1,8102 @@
+
+obj/user/signedoverflow:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 28 00 00 00       	call   80004b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - signed integer overflow */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* Creating a 32-bit integer variable with the maximum integer value it can contain */
+    int a = 2147483647;
+    /* Trying to add 1 to the "a" variable and print its contents (which causes undefined behavior). */
+    /* The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable. */
+    cprintf("%d\n", a + 1);
+  800029:	be 00 00 00 80       	mov    $0x80000000,%esi
+  80002e:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 ba c4 01 80 00 00 	movabs $0x8001c4,%rdx
+  800044:	00 00 00 
+  800047:	ff d2                	call   *%rdx
+}
+  800049:	5d                   	pop    %rbp
+  80004a:	c3                   	ret
+
+000000000080004b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004b:	55                   	push   %rbp
+  80004c:	48 89 e5             	mov    %rsp,%rbp
+  80004f:	41 56                	push   %r14
+  800051:	41 55                	push   %r13
+  800053:	41 54                	push   %r12
+  800055:	53                   	push   %rbx
+  800056:	41 89 fd             	mov    %edi,%r13d
+  800059:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005c:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800063:	00 00 00 
+  800066:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80006d:	00 00 00 
+  800070:	48 39 c2             	cmp    %rax,%rdx
+  800073:	73 17                	jae    80008c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800075:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800078:	49 89 c4             	mov    %rax,%r12
+  80007b:	48 83 c3 08          	add    $0x8,%rbx
+  80007f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800084:	ff 53 f8             	call   *-0x8(%rbx)
+  800087:	4c 39 e3             	cmp    %r12,%rbx
+  80008a:	72 ef                	jb     80007b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80008c:	48 b8 dc 11 80 00 00 	movabs $0x8011dc,%rax
+  800093:	00 00 00 
+  800096:	ff d0                	call   *%rax
+  800098:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009d:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000a4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ab:	00 00 00 
+  8000ae:	48 01 d0             	add    %rdx,%rax
+  8000b1:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8000b8:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000bb:	45 85 ed             	test   %r13d,%r13d
+  8000be:	7e 0d                	jle    8000cd <libmain+0x82>
+  8000c0:	49 8b 06             	mov    (%r14),%rax
+  8000c3:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8000ca:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000cd:	4c 89 f6             	mov    %r14,%rsi
+  8000d0:	44 89 ef             	mov    %r13d,%edi
+  8000d3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000da:	00 00 00 
+  8000dd:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000df:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+#endif
+}
+  8000eb:	5b                   	pop    %rbx
+  8000ec:	41 5c                	pop    %r12
+  8000ee:	41 5d                	pop    %r13
+  8000f0:	41 5e                	pop    %r14
+  8000f2:	5d                   	pop    %rbp
+  8000f3:	c3                   	ret
+
+00000000008000f4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f4:	55                   	push   %rbp
+  8000f5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f8:	48 b8 d8 1e 80 00 00 	movabs $0x801ed8,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800104:	bf 00 00 00 00       	mov    $0x0,%edi
+  800109:	48 b8 71 11 80 00 00 	movabs $0x801171,%rax
+  800110:	00 00 00 
+  800113:	ff d0                	call   *%rax
+}
+  800115:	5d                   	pop    %rbp
+  800116:	c3                   	ret
+
+0000000000800117 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	53                   	push   %rbx
+  80011c:	48 83 ec 08          	sub    $0x8,%rsp
+  800120:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800123:	8b 06                	mov    (%rsi),%eax
+  800125:	8d 50 01             	lea    0x1(%rax),%edx
+  800128:	89 16                	mov    %edx,(%rsi)
+  80012a:	48 98                	cltq
+  80012c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800131:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800137:	74 0a                	je     800143 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800139:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80013d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800141:	c9                   	leave
+  800142:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800143:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800147:	be ff 00 00 00       	mov    $0xff,%esi
+  80014c:	48 b8 13 11 80 00 00 	movabs $0x801113,%rax
+  800153:	00 00 00 
+  800156:	ff d0                	call   *%rax
+        state->offset = 0;
+  800158:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80015e:	eb d9                	jmp    800139 <putch+0x22>
+
+0000000000800160 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800160:	55                   	push   %rbp
+  800161:	48 89 e5             	mov    %rsp,%rbp
+  800164:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80016b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80016e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800175:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80017a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800182:	48 89 f1             	mov    %rsi,%rcx
+  800185:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80018c:	48 bf 17 01 80 00 00 	movabs $0x800117,%rdi
+  800193:	00 00 00 
+  800196:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001a9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001b0:	48 b8 13 11 80 00 00 	movabs $0x801113,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001bc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c2:	c9                   	leave
+  8001c3:	c3                   	ret
+
+00000000008001c4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001c4:	55                   	push   %rbp
+  8001c5:	48 89 e5             	mov    %rsp,%rbp
+  8001c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8001cc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001d8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001dc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001e0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001ef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001f7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8001fb:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+0000000000800209 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800209:	55                   	push   %rbp
+  80020a:	48 89 e5             	mov    %rsp,%rbp
+  80020d:	41 57                	push   %r15
+  80020f:	41 56                	push   %r14
+  800211:	41 55                	push   %r13
+  800213:	41 54                	push   %r12
+  800215:	53                   	push   %rbx
+  800216:	48 83 ec 18          	sub    $0x18,%rsp
+  80021a:	49 89 fc             	mov    %rdi,%r12
+  80021d:	49 89 f5             	mov    %rsi,%r13
+  800220:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800224:	8b 45 10             	mov    0x10(%rbp),%eax
+  800227:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80022a:	41 89 cf             	mov    %ecx,%r15d
+  80022d:	4c 39 fa             	cmp    %r15,%rdx
+  800230:	73 5b                	jae    80028d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800232:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800236:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80023a:	85 db                	test   %ebx,%ebx
+  80023c:	7e 0e                	jle    80024c <print_num+0x43>
+            putch(padc, put_arg);
+  80023e:	4c 89 ee             	mov    %r13,%rsi
+  800241:	44 89 f7             	mov    %r14d,%edi
+  800244:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800247:	83 eb 01             	sub    $0x1,%ebx
+  80024a:	75 f2                	jne    80023e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80024c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800250:	48 b9 1f 50 80 00 00 	movabs $0x80501f,%rcx
+  800257:	00 00 00 
+  80025a:	48 b8 0e 50 80 00 00 	movabs $0x80500e,%rax
+  800261:	00 00 00 
+  800264:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800268:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80026c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800271:	49 f7 f7             	div    %r15
+  800274:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800278:	4c 89 ee             	mov    %r13,%rsi
+  80027b:	41 ff d4             	call   *%r12
+}
+  80027e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800282:	5b                   	pop    %rbx
+  800283:	41 5c                	pop    %r12
+  800285:	41 5d                	pop    %r13
+  800287:	41 5e                	pop    %r14
+  800289:	41 5f                	pop    %r15
+  80028b:	5d                   	pop    %rbp
+  80028c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80028d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800291:	ba 00 00 00 00       	mov    $0x0,%edx
+  800296:	49 f7 f7             	div    %r15
+  800299:	48 83 ec 08          	sub    $0x8,%rsp
+  80029d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002a1:	52                   	push   %rdx
+  8002a2:	45 0f be c9          	movsbl %r9b,%r9d
+  8002a6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002aa:	48 89 c2             	mov    %rax,%rdx
+  8002ad:	48 b8 09 02 80 00 00 	movabs $0x800209,%rax
+  8002b4:	00 00 00 
+  8002b7:	ff d0                	call   *%rax
+  8002b9:	48 83 c4 10          	add    $0x10,%rsp
+  8002bd:	eb 8d                	jmp    80024c <print_num+0x43>
+
+00000000008002bf <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002bf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002c3:	48 8b 06             	mov    (%rsi),%rax
+  8002c6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002ca:	73 0a                	jae    8002d6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002d0:	48 89 16             	mov    %rdx,(%rsi)
+  8002d3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002d6:	c3                   	ret
+
+00000000008002d7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002d7:	55                   	push   %rbp
+  8002d8:	48 89 e5             	mov    %rsp,%rbp
+  8002db:	48 83 ec 50          	sub    $0x50,%rsp
+  8002df:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002e3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002e7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002eb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002fa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800302:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800306:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  80030d:	00 00 00 
+  800310:	ff d0                	call   *%rax
+}
+  800312:	c9                   	leave
+  800313:	c3                   	ret
+
+0000000000800314 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800314:	55                   	push   %rbp
+  800315:	48 89 e5             	mov    %rsp,%rbp
+  800318:	41 57                	push   %r15
+  80031a:	41 56                	push   %r14
+  80031c:	41 55                	push   %r13
+  80031e:	41 54                	push   %r12
+  800320:	53                   	push   %rbx
+  800321:	48 83 ec 38          	sub    $0x38,%rsp
+  800325:	49 89 fe             	mov    %rdi,%r14
+  800328:	49 89 f5             	mov    %rsi,%r13
+  80032b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80032e:	48 8b 01             	mov    (%rcx),%rax
+  800331:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800335:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800339:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80033d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800341:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800345:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800349:	0f b6 3b             	movzbl (%rbx),%edi
+  80034c:	40 80 ff 25          	cmp    $0x25,%dil
+  800350:	74 18                	je     80036a <vprintfmt+0x56>
+            if (!ch) return;
+  800352:	40 84 ff             	test   %dil,%dil
+  800355:	0f 84 04 07 00 00    	je     800a5f <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80035b:	40 0f b6 ff          	movzbl %dil,%edi
+  80035f:	4c 89 ee             	mov    %r13,%rsi
+  800362:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800365:	4c 89 e3             	mov    %r12,%rbx
+  800368:	eb db                	jmp    800345 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80036a:	be 00 00 00 00       	mov    $0x0,%esi
+  80036f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800373:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800378:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80037e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800385:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800389:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80038e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800393:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800396:	83 e8 23             	sub    $0x23,%eax
+  800399:	3c 57                	cmp    $0x57,%al
+  80039b:	0f 87 a4 06 00 00    	ja     800a45 <vprintfmt+0x731>
+  8003a1:	0f b6 c0             	movzbl %al,%eax
+  8003a4:	48 b9 a0 51 80 00 00 	movabs $0x8051a0,%rcx
+  8003ab:	00 00 00 
+  8003ae:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003b1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003b4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003b8:	eb cf                	jmp    800389 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003ba:	49 89 dc             	mov    %rbx,%r12
+  8003bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c2:	eb c5                	jmp    800389 <vprintfmt+0x75>
+            padc = ch;
+  8003c4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003c8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003cb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003ce:	eb b9                	jmp    800389 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8003d6:	77 24                	ja     8003fc <vprintfmt+0xe8>
+  8003d8:	89 c1                	mov    %eax,%ecx
+  8003da:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003de:	83 c0 08             	add    $0x8,%eax
+  8003e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003e4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003e7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003ea:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003ee:	79 99                	jns    800389 <vprintfmt+0x75>
+                width = precision;
+  8003f0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003f4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003fa:	eb 8d                	jmp    800389 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003fc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800400:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800404:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800408:	eb da                	jmp    8003e4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80040a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80040f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800413:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800419:	3c 39                	cmp    $0x39,%al
+  80041b:	77 1c                	ja     800439 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80041d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800421:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800425:	0f b6 c0             	movzbl %al,%eax
+  800428:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80042d:	0f b6 03             	movzbl (%rbx),%eax
+  800430:	3c 39                	cmp    $0x39,%al
+  800432:	76 e9                	jbe    80041d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800434:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800437:	eb b1                	jmp    8003ea <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800439:	49 89 dc             	mov    %rbx,%r12
+  80043c:	eb ac                	jmp    8003ea <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80043e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800441:	85 c9                	test   %ecx,%ecx
+  800443:	b8 00 00 00 00       	mov    $0x0,%eax
+  800448:	0f 49 c1             	cmovns %ecx,%eax
+  80044b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80044e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800451:	e9 33 ff ff ff       	jmp    800389 <vprintfmt+0x75>
+            lflag++;
+  800456:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800459:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80045c:	e9 28 ff ff ff       	jmp    800389 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800461:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800464:	83 f8 2f             	cmp    $0x2f,%eax
+  800467:	77 19                	ja     800482 <vprintfmt+0x16e>
+  800469:	89 c2                	mov    %eax,%edx
+  80046b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80046f:	83 c0 08             	add    $0x8,%eax
+  800472:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800475:	8b 3a                	mov    (%rdx),%edi
+  800477:	4c 89 ee             	mov    %r13,%rsi
+  80047a:	41 ff d6             	call   *%r14
+            break;
+  80047d:	e9 c3 fe ff ff       	jmp    800345 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800482:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800486:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80048a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80048e:	eb e5                	jmp    800475 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800490:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800493:	83 f8 2f             	cmp    $0x2f,%eax
+  800496:	77 5a                	ja     8004f2 <vprintfmt+0x1de>
+  800498:	89 c2                	mov    %eax,%edx
+  80049a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80049e:	83 c0 08             	add    $0x8,%eax
+  8004a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004a4:	8b 02                	mov    (%rdx),%eax
+  8004a6:	89 c1                	mov    %eax,%ecx
+  8004a8:	f7 d9                	neg    %ecx
+  8004aa:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004ad:	83 f9 13             	cmp    $0x13,%ecx
+  8004b0:	7f 4e                	jg     800500 <vprintfmt+0x1ec>
+  8004b2:	48 63 c1             	movslq %ecx,%rax
+  8004b5:	48 ba 60 54 80 00 00 	movabs $0x805460,%rdx
+  8004bc:	00 00 00 
+  8004bf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004c3:	48 85 c0             	test   %rax,%rax
+  8004c6:	74 38                	je     800500 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004c8:	48 89 c1             	mov    %rax,%rcx
+  8004cb:	48 ba 99 56 80 00 00 	movabs $0x805699,%rdx
+  8004d2:	00 00 00 
+  8004d5:	4c 89 ee             	mov    %r13,%rsi
+  8004d8:	4c 89 f7             	mov    %r14,%rdi
+  8004db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e0:	49 b8 d7 02 80 00 00 	movabs $0x8002d7,%r8
+  8004e7:	00 00 00 
+  8004ea:	41 ff d0             	call   *%r8
+  8004ed:	e9 53 fe ff ff       	jmp    800345 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004fe:	eb a4                	jmp    8004a4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800500:	48 ba 37 50 80 00 00 	movabs $0x805037,%rdx
+  800507:	00 00 00 
+  80050a:	4c 89 ee             	mov    %r13,%rsi
+  80050d:	4c 89 f7             	mov    %r14,%rdi
+  800510:	b8 00 00 00 00       	mov    $0x0,%eax
+  800515:	49 b8 d7 02 80 00 00 	movabs $0x8002d7,%r8
+  80051c:	00 00 00 
+  80051f:	41 ff d0             	call   *%r8
+  800522:	e9 1e fe ff ff       	jmp    800345 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800527:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052a:	83 f8 2f             	cmp    $0x2f,%eax
+  80052d:	77 36                	ja     800565 <vprintfmt+0x251>
+  80052f:	89 c2                	mov    %eax,%edx
+  800531:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800535:	83 c0 08             	add    $0x8,%eax
+  800538:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80053b:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80053e:	48 85 f6             	test   %rsi,%rsi
+  800541:	48 b8 30 50 80 00 00 	movabs $0x805030,%rax
+  800548:	00 00 00 
+  80054b:	48 0f 45 c6          	cmovne %rsi,%rax
+  80054f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800553:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800557:	7e 06                	jle    80055f <vprintfmt+0x24b>
+  800559:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80055d:	75 14                	jne    800573 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80055f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800563:	eb 5b                	jmp    8005c0 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800565:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800569:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80056d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800571:	eb c8                	jmp    80053b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800573:	49 63 f7             	movslq %r15d,%rsi
+  800576:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80057a:	48 b8 19 0b 80 00 00 	movabs $0x800b19,%rax
+  800581:	00 00 00 
+  800584:	ff d0                	call   *%rax
+  800586:	48 89 c2             	mov    %rax,%rdx
+  800589:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80058c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80058e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800591:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800594:	85 c0                	test   %eax,%eax
+  800596:	7e c7                	jle    80055f <vprintfmt+0x24b>
+  800598:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80059d:	4c 89 ee             	mov    %r13,%rsi
+  8005a0:	44 89 e7             	mov    %r12d,%edi
+  8005a3:	41 ff d6             	call   *%r14
+  8005a6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005aa:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ad:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005b0:	75 eb                	jne    80059d <vprintfmt+0x289>
+  8005b2:	eb ab                	jmp    80055f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005b4:	0f b6 f8             	movzbl %al,%edi
+  8005b7:	4c 89 ee             	mov    %r13,%rsi
+  8005ba:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8005bd:	4c 89 e2             	mov    %r12,%rdx
+  8005c0:	45 85 ff             	test   %r15d,%r15d
+  8005c3:	78 06                	js     8005cb <vprintfmt+0x2b7>
+  8005c5:	41 83 ef 01          	sub    $0x1,%r15d
+  8005c9:	78 23                	js     8005ee <vprintfmt+0x2da>
+  8005cb:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8005cf:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8005d5:	84 c0                	test   %al,%al
+  8005d7:	74 15                	je     8005ee <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005d9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8005dd:	74 d5                	je     8005b4 <vprintfmt+0x2a0>
+  8005df:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8005e2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8005e7:	80 fa 5e             	cmp    $0x5e,%dl
+  8005ea:	77 cb                	ja     8005b7 <vprintfmt+0x2a3>
+  8005ec:	eb c6                	jmp    8005b4 <vprintfmt+0x2a0>
+  8005ee:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005f1:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8005f4:	01 f0                	add    %esi,%eax
+  8005f6:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8005f8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005fc:	85 c0                	test   %eax,%eax
+  8005fe:	0f 8e 41 fd ff ff    	jle    800345 <vprintfmt+0x31>
+  800604:	4c 89 ee             	mov    %r13,%rsi
+  800607:	bf 20 00 00 00       	mov    $0x20,%edi
+  80060c:	41 ff d6             	call   *%r14
+  80060f:	41 83 ec 01          	sub    $0x1,%r12d
+  800613:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800617:	75 eb                	jne    800604 <vprintfmt+0x2f0>
+  800619:	e9 27 fd ff ff       	jmp    800345 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80061e:	40 84 f6             	test   %sil,%sil
+  800621:	75 26                	jne    800649 <vprintfmt+0x335>
+    switch (lflag) {
+  800623:	85 d2                	test   %edx,%edx
+  800625:	74 59                	je     800680 <vprintfmt+0x36c>
+  800627:	83 fa 01             	cmp    $0x1,%edx
+  80062a:	74 7b                	je     8006a7 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80062c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80062f:	83 f8 2f             	cmp    $0x2f,%eax
+  800632:	0f 87 96 00 00 00    	ja     8006ce <vprintfmt+0x3ba>
+  800638:	89 c2                	mov    %eax,%edx
+  80063a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80063e:	83 c0 08             	add    $0x8,%eax
+  800641:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800644:	4c 8b 22             	mov    (%rdx),%r12
+  800647:	eb 17                	jmp    800660 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800649:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80064c:	83 f8 2f             	cmp    $0x2f,%eax
+  80064f:	77 21                	ja     800672 <vprintfmt+0x35e>
+  800651:	89 c2                	mov    %eax,%edx
+  800653:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800657:	83 c0 08             	add    $0x8,%eax
+  80065a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80065d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800660:	4d 85 e4             	test   %r12,%r12
+  800663:	78 7a                	js     8006df <vprintfmt+0x3cb>
+            num = i;
+  800665:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800668:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80066d:	e9 b5 02 00 00       	jmp    800927 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800672:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800676:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80067a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80067e:	eb dd                	jmp    80065d <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800680:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800683:	83 f8 2f             	cmp    $0x2f,%eax
+  800686:	77 11                	ja     800699 <vprintfmt+0x385>
+  800688:	89 c2                	mov    %eax,%edx
+  80068a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80068e:	83 c0 08             	add    $0x8,%eax
+  800691:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800694:	4c 63 22             	movslq (%rdx),%r12
+  800697:	eb c7                	jmp    800660 <vprintfmt+0x34c>
+  800699:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80069d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a5:	eb ed                	jmp    800694 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8006a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ad:	77 11                	ja     8006c0 <vprintfmt+0x3ac>
+  8006af:	89 c2                	mov    %eax,%edx
+  8006b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b5:	83 c0 08             	add    $0x8,%eax
+  8006b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006bb:	4c 8b 22             	mov    (%rdx),%r12
+  8006be:	eb a0                	jmp    800660 <vprintfmt+0x34c>
+  8006c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006cc:	eb ed                	jmp    8006bb <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8006ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006da:	e9 65 ff ff ff       	jmp    800644 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8006df:	4c 89 ee             	mov    %r13,%rsi
+  8006e2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006e7:	41 ff d6             	call   *%r14
+                i = -i;
+  8006ea:	49 f7 dc             	neg    %r12
+  8006ed:	e9 73 ff ff ff       	jmp    800665 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8006f2:	40 84 f6             	test   %sil,%sil
+  8006f5:	75 32                	jne    800729 <vprintfmt+0x415>
+    switch (lflag) {
+  8006f7:	85 d2                	test   %edx,%edx
+  8006f9:	74 5d                	je     800758 <vprintfmt+0x444>
+  8006fb:	83 fa 01             	cmp    $0x1,%edx
+  8006fe:	0f 84 82 00 00 00    	je     800786 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800704:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800707:	83 f8 2f             	cmp    $0x2f,%eax
+  80070a:	0f 87 a5 00 00 00    	ja     8007b5 <vprintfmt+0x4a1>
+  800710:	89 c2                	mov    %eax,%edx
+  800712:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800716:	83 c0 08             	add    $0x8,%eax
+  800719:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80071f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800724:	e9 fe 01 00 00       	jmp    800927 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800729:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072c:	83 f8 2f             	cmp    $0x2f,%eax
+  80072f:	77 19                	ja     80074a <vprintfmt+0x436>
+  800731:	89 c2                	mov    %eax,%edx
+  800733:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800737:	83 c0 08             	add    $0x8,%eax
+  80073a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800740:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800745:	e9 dd 01 00 00       	jmp    800927 <vprintfmt+0x613>
+  80074a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800752:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800756:	eb e5                	jmp    80073d <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800758:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075b:	83 f8 2f             	cmp    $0x2f,%eax
+  80075e:	77 18                	ja     800778 <vprintfmt+0x464>
+  800760:	89 c2                	mov    %eax,%edx
+  800762:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800766:	83 c0 08             	add    $0x8,%eax
+  800769:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80076e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800773:	e9 af 01 00 00       	jmp    800927 <vprintfmt+0x613>
+  800778:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800780:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800784:	eb e6                	jmp    80076c <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800786:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800789:	83 f8 2f             	cmp    $0x2f,%eax
+  80078c:	77 19                	ja     8007a7 <vprintfmt+0x493>
+  80078e:	89 c2                	mov    %eax,%edx
+  800790:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800794:	83 c0 08             	add    $0x8,%eax
+  800797:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80079d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007a2:	e9 80 01 00 00       	jmp    800927 <vprintfmt+0x613>
+  8007a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b3:	eb e5                	jmp    80079a <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8007b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c1:	e9 56 ff ff ff       	jmp    80071c <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c6:	40 84 f6             	test   %sil,%sil
+  8007c9:	75 2e                	jne    8007f9 <vprintfmt+0x4e5>
+    switch (lflag) {
+  8007cb:	85 d2                	test   %edx,%edx
+  8007cd:	0f 84 b3 00 00 00    	je     800886 <vprintfmt+0x572>
+  8007d3:	83 fa 01             	cmp    $0x1,%edx
+  8007d6:	0f 84 d3 00 00 00    	je     8008af <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8007dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007df:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e2:	0f 87 f1 00 00 00    	ja     8008d9 <vprintfmt+0x5c5>
+  8007e8:	89 c2                	mov    %eax,%edx
+  8007ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ee:	83 c0 08             	add    $0x8,%eax
+  8007f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f4:	48 8b 02             	mov    (%rdx),%rax
+  8007f7:	eb 17                	jmp    800810 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ff:	77 77                	ja     800878 <vprintfmt+0x564>
+  800801:	89 c2                	mov    %eax,%edx
+  800803:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800807:	83 c0 08             	add    $0x8,%eax
+  80080a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080d:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800810:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800812:	83 f8 07             	cmp    $0x7,%eax
+  800815:	0f 8e cf 00 00 00    	jle    8008ea <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  80081b:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800821:	44 89 e7             	mov    %r12d,%edi
+  800824:	41 c1 e4 03          	shl    $0x3,%r12d
+  800828:	89 d1                	mov    %edx,%ecx
+  80082a:	8d 72 07             	lea    0x7(%rdx),%esi
+  80082d:	85 d2                	test   %edx,%edx
+  80082f:	0f 48 d6             	cmovs  %esi,%edx
+  800832:	c1 fa 03             	sar    $0x3,%edx
+  800835:	83 f9 3f             	cmp    $0x3f,%ecx
+  800838:	7f e7                	jg     800821 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80083a:	85 ff                	test   %edi,%edi
+  80083c:	0f 84 03 fb ff ff    	je     800345 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800842:	49 63 f4             	movslq %r12d,%rsi
+  800845:	ba 00 00 00 00       	mov    $0x0,%edx
+  80084a:	48 f7 f6             	div    %rsi
+  80084d:	49 89 d7             	mov    %rdx,%r15
+  800850:	83 c0 30             	add    $0x30,%eax
+  800853:	0f be f8             	movsbl %al,%edi
+  800856:	4c 89 ee             	mov    %r13,%rsi
+  800859:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80085c:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  80085f:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800864:	45 85 e4             	test   %r12d,%r12d
+  800867:	41 0f 49 d4          	cmovns %r12d,%edx
+  80086b:	c1 fa 03             	sar    $0x3,%edx
+  80086e:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800871:	75 cf                	jne    800842 <vprintfmt+0x52e>
+  800873:	e9 cd fa ff ff       	jmp    800345 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800878:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800880:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800884:	eb 87                	jmp    80080d <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800886:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800889:	83 f8 2f             	cmp    $0x2f,%eax
+  80088c:	77 13                	ja     8008a1 <vprintfmt+0x58d>
+  80088e:	89 c2                	mov    %eax,%edx
+  800890:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800894:	83 c0 08             	add    $0x8,%eax
+  800897:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089a:	8b 02                	mov    (%rdx),%eax
+  80089c:	e9 6f ff ff ff       	jmp    800810 <vprintfmt+0x4fc>
+  8008a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ad:	eb eb                	jmp    80089a <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8008af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b5:	77 14                	ja     8008cb <vprintfmt+0x5b7>
+  8008b7:	89 c2                	mov    %eax,%edx
+  8008b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bd:	83 c0 08             	add    $0x8,%eax
+  8008c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c3:	48 8b 02             	mov    (%rdx),%rax
+  8008c6:	e9 45 ff ff ff       	jmp    800810 <vprintfmt+0x4fc>
+  8008cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d7:	eb ea                	jmp    8008c3 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8008d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e5:	e9 0a ff ff ff       	jmp    8007f4 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8008ea:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8008f0:	e9 4d ff ff ff       	jmp    800842 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8008f5:	4c 89 ee             	mov    %r13,%rsi
+  8008f8:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008fd:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800900:	4c 89 ee             	mov    %r13,%rsi
+  800903:	bf 78 00 00 00       	mov    $0x78,%edi
+  800908:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80090b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090e:	83 f8 2f             	cmp    $0x2f,%eax
+  800911:	77 47                	ja     80095a <vprintfmt+0x646>
+  800913:	89 c2                	mov    %eax,%edx
+  800915:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800919:	83 c0 08             	add    $0x8,%eax
+  80091c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800922:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800927:	48 83 ec 08          	sub    $0x8,%rsp
+  80092b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80092f:	0f 94 c0             	sete   %al
+  800932:	0f b6 c0             	movzbl %al,%eax
+  800935:	50                   	push   %rax
+  800936:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80093b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80093f:	4c 89 ee             	mov    %r13,%rsi
+  800942:	4c 89 f7             	mov    %r14,%rdi
+  800945:	48 b8 09 02 80 00 00 	movabs $0x800209,%rax
+  80094c:	00 00 00 
+  80094f:	ff d0                	call   *%rax
+            break;
+  800951:	48 83 c4 10          	add    $0x10,%rsp
+  800955:	e9 eb f9 ff ff       	jmp    800345 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80095a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800962:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800966:	eb b7                	jmp    80091f <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800968:	40 84 f6             	test   %sil,%sil
+  80096b:	75 2b                	jne    800998 <vprintfmt+0x684>
+    switch (lflag) {
+  80096d:	85 d2                	test   %edx,%edx
+  80096f:	74 56                	je     8009c7 <vprintfmt+0x6b3>
+  800971:	83 fa 01             	cmp    $0x1,%edx
+  800974:	74 7f                	je     8009f5 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800976:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800979:	83 f8 2f             	cmp    $0x2f,%eax
+  80097c:	0f 87 a2 00 00 00    	ja     800a24 <vprintfmt+0x710>
+  800982:	89 c2                	mov    %eax,%edx
+  800984:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800988:	83 c0 08             	add    $0x8,%eax
+  80098b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800991:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800996:	eb 8f                	jmp    800927 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800998:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099b:	83 f8 2f             	cmp    $0x2f,%eax
+  80099e:	77 19                	ja     8009b9 <vprintfmt+0x6a5>
+  8009a0:	89 c2                	mov    %eax,%edx
+  8009a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a6:	83 c0 08             	add    $0x8,%eax
+  8009a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ac:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009af:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009b4:	e9 6e ff ff ff       	jmp    800927 <vprintfmt+0x613>
+  8009b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c5:	eb e5                	jmp    8009ac <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8009c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cd:	77 18                	ja     8009e7 <vprintfmt+0x6d3>
+  8009cf:	89 c2                	mov    %eax,%edx
+  8009d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d5:	83 c0 08             	add    $0x8,%eax
+  8009d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009db:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009dd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009e2:	e9 40 ff ff ff       	jmp    800927 <vprintfmt+0x613>
+  8009e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f3:	eb e6                	jmp    8009db <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  8009f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fb:	77 19                	ja     800a16 <vprintfmt+0x702>
+  8009fd:	89 c2                	mov    %eax,%edx
+  8009ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a03:	83 c0 08             	add    $0x8,%eax
+  800a06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a09:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a0c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a11:	e9 11 ff ff ff       	jmp    800927 <vprintfmt+0x613>
+  800a16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a22:	eb e5                	jmp    800a09 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800a24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a30:	e9 59 ff ff ff       	jmp    80098e <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800a35:	4c 89 ee             	mov    %r13,%rsi
+  800a38:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a3d:	41 ff d6             	call   *%r14
+            break;
+  800a40:	e9 00 f9 ff ff       	jmp    800345 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a45:	4c 89 ee             	mov    %r13,%rsi
+  800a48:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a4d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a50:	48 83 eb 01          	sub    $0x1,%rbx
+  800a54:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a58:	75 f6                	jne    800a50 <vprintfmt+0x73c>
+  800a5a:	e9 e6 f8 ff ff       	jmp    800345 <vprintfmt+0x31>
+}
+  800a5f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a63:	5b                   	pop    %rbx
+  800a64:	41 5c                	pop    %r12
+  800a66:	41 5d                	pop    %r13
+  800a68:	41 5e                	pop    %r14
+  800a6a:	41 5f                	pop    %r15
+  800a6c:	5d                   	pop    %rbp
+  800a6d:	c3                   	ret
+
+0000000000800a6e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a6e:	55                   	push   %rbp
+  800a6f:	48 89 e5             	mov    %rsp,%rbp
+  800a72:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a7a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a7f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a83:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a8a:	48 85 ff             	test   %rdi,%rdi
+  800a8d:	74 2b                	je     800aba <vsnprintf+0x4c>
+  800a8f:	48 85 f6             	test   %rsi,%rsi
+  800a92:	74 26                	je     800aba <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a94:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a98:	48 bf bf 02 80 00 00 	movabs $0x8002bf,%rdi
+  800a9f:	00 00 00 
+  800aa2:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  800aa9:	00 00 00 
+  800aac:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800aae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ab5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ab8:	c9                   	leave
+  800ab9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800aba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800abf:	eb f7                	jmp    800ab8 <vsnprintf+0x4a>
+
+0000000000800ac1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ac1:	55                   	push   %rbp
+  800ac2:	48 89 e5             	mov    %rsp,%rbp
+  800ac5:	48 83 ec 50          	sub    $0x50,%rsp
+  800ac9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800acd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ad1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ad5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800adc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ae0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ae8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aec:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800af0:	48 b8 6e 0a 80 00 00 	movabs $0x800a6e,%rax
+  800af7:	00 00 00 
+  800afa:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800afc:	c9                   	leave
+  800afd:	c3                   	ret
+
+0000000000800afe <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800afe:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b01:	74 10                	je     800b13 <strlen+0x15>
+    size_t n = 0;
+  800b03:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b08:	48 83 c0 01          	add    $0x1,%rax
+  800b0c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b10:	75 f6                	jne    800b08 <strlen+0xa>
+  800b12:	c3                   	ret
+    size_t n = 0;
+  800b13:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b18:	c3                   	ret
+
+0000000000800b19 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b19:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b1c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b21:	48 85 f6             	test   %rsi,%rsi
+  800b24:	74 11                	je     800b37 <strnlen+0x1e>
+  800b26:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b2a:	74 0c                	je     800b38 <strnlen+0x1f>
+  800b2c:	48 83 c2 01          	add    $0x1,%rdx
+  800b30:	48 39 d0             	cmp    %rdx,%rax
+  800b33:	75 f1                	jne    800b26 <strnlen+0xd>
+  800b35:	eb 04                	jmp    800b3b <strnlen+0x22>
+  800b37:	c3                   	ret
+  800b38:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b3b:	c3                   	ret
+
+0000000000800b3c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b3c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b44:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b48:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b4b:	48 83 c2 01          	add    $0x1,%rdx
+  800b4f:	84 c9                	test   %cl,%cl
+  800b51:	75 f1                	jne    800b44 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b53:	c3                   	ret
+
+0000000000800b54 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b54:	55                   	push   %rbp
+  800b55:	48 89 e5             	mov    %rsp,%rbp
+  800b58:	41 54                	push   %r12
+  800b5a:	53                   	push   %rbx
+  800b5b:	48 89 fb             	mov    %rdi,%rbx
+  800b5e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b61:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  800b68:	00 00 00 
+  800b6b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b6d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b71:	4c 89 e6             	mov    %r12,%rsi
+  800b74:	48 b8 3c 0b 80 00 00 	movabs $0x800b3c,%rax
+  800b7b:	00 00 00 
+  800b7e:	ff d0                	call   *%rax
+    return dst;
+}
+  800b80:	48 89 d8             	mov    %rbx,%rax
+  800b83:	5b                   	pop    %rbx
+  800b84:	41 5c                	pop    %r12
+  800b86:	5d                   	pop    %rbp
+  800b87:	c3                   	ret
+
+0000000000800b88 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b88:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b8b:	48 85 d2             	test   %rdx,%rdx
+  800b8e:	74 1f                	je     800baf <strncpy+0x27>
+  800b90:	48 01 fa             	add    %rdi,%rdx
+  800b93:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b96:	48 83 c1 01          	add    $0x1,%rcx
+  800b9a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b9e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ba2:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ba6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800baa:	48 39 ca             	cmp    %rcx,%rdx
+  800bad:	75 e7                	jne    800b96 <strncpy+0xe>
+    }
+    return ret;
+}
+  800baf:	c3                   	ret
+
+0000000000800bb0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bb0:	48 89 f8             	mov    %rdi,%rax
+  800bb3:	48 85 d2             	test   %rdx,%rdx
+  800bb6:	74 24                	je     800bdc <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bb8:	48 83 ea 01          	sub    $0x1,%rdx
+  800bbc:	74 1b                	je     800bd9 <strlcpy+0x29>
+  800bbe:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bc2:	0f b6 16             	movzbl (%rsi),%edx
+  800bc5:	84 d2                	test   %dl,%dl
+  800bc7:	74 10                	je     800bd9 <strlcpy+0x29>
+            *dst++ = *src++;
+  800bc9:	48 83 c6 01          	add    $0x1,%rsi
+  800bcd:	48 83 c0 01          	add    $0x1,%rax
+  800bd1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bd4:	48 39 c8             	cmp    %rcx,%rax
+  800bd7:	75 e9                	jne    800bc2 <strlcpy+0x12>
+        *dst = '\0';
+  800bd9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bdc:	48 29 f8             	sub    %rdi,%rax
+}
+  800bdf:	c3                   	ret
+
+0000000000800be0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800be0:	0f b6 07             	movzbl (%rdi),%eax
+  800be3:	84 c0                	test   %al,%al
+  800be5:	74 13                	je     800bfa <strcmp+0x1a>
+  800be7:	38 06                	cmp    %al,(%rsi)
+  800be9:	75 0f                	jne    800bfa <strcmp+0x1a>
+  800beb:	48 83 c7 01          	add    $0x1,%rdi
+  800bef:	48 83 c6 01          	add    $0x1,%rsi
+  800bf3:	0f b6 07             	movzbl (%rdi),%eax
+  800bf6:	84 c0                	test   %al,%al
+  800bf8:	75 ed                	jne    800be7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bfa:	0f b6 c0             	movzbl %al,%eax
+  800bfd:	0f b6 16             	movzbl (%rsi),%edx
+  800c00:	29 d0                	sub    %edx,%eax
+}
+  800c02:	c3                   	ret
+
+0000000000800c03 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c03:	48 85 d2             	test   %rdx,%rdx
+  800c06:	74 1f                	je     800c27 <strncmp+0x24>
+  800c08:	0f b6 07             	movzbl (%rdi),%eax
+  800c0b:	84 c0                	test   %al,%al
+  800c0d:	74 1e                	je     800c2d <strncmp+0x2a>
+  800c0f:	3a 06                	cmp    (%rsi),%al
+  800c11:	75 1a                	jne    800c2d <strncmp+0x2a>
+  800c13:	48 83 c7 01          	add    $0x1,%rdi
+  800c17:	48 83 c6 01          	add    $0x1,%rsi
+  800c1b:	48 83 ea 01          	sub    $0x1,%rdx
+  800c1f:	75 e7                	jne    800c08 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c26:	c3                   	ret
+  800c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2c:	c3                   	ret
+  800c2d:	48 85 d2             	test   %rdx,%rdx
+  800c30:	74 09                	je     800c3b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c32:	0f b6 07             	movzbl (%rdi),%eax
+  800c35:	0f b6 16             	movzbl (%rsi),%edx
+  800c38:	29 d0                	sub    %edx,%eax
+  800c3a:	c3                   	ret
+    if (!n) return 0;
+  800c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c40:	c3                   	ret
+
+0000000000800c41 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c41:	0f b6 17             	movzbl (%rdi),%edx
+  800c44:	84 d2                	test   %dl,%dl
+  800c46:	74 18                	je     800c60 <strchr+0x1f>
+        if (*str == c) {
+  800c48:	0f be d2             	movsbl %dl,%edx
+  800c4b:	39 f2                	cmp    %esi,%edx
+  800c4d:	74 17                	je     800c66 <strchr+0x25>
+    for (; *str; str++) {
+  800c4f:	48 83 c7 01          	add    $0x1,%rdi
+  800c53:	0f b6 17             	movzbl (%rdi),%edx
+  800c56:	84 d2                	test   %dl,%dl
+  800c58:	75 ee                	jne    800c48 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5f:	c3                   	ret
+  800c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c65:	c3                   	ret
+  800c66:	48 89 f8             	mov    %rdi,%rax
+}
+  800c69:	c3                   	ret
+
+0000000000800c6a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c6a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c6d:	0f b6 17             	movzbl (%rdi),%edx
+  800c70:	84 d2                	test   %dl,%dl
+  800c72:	74 13                	je     800c87 <strfind+0x1d>
+  800c74:	0f be d2             	movsbl %dl,%edx
+  800c77:	39 f2                	cmp    %esi,%edx
+  800c79:	74 0b                	je     800c86 <strfind+0x1c>
+  800c7b:	48 83 c0 01          	add    $0x1,%rax
+  800c7f:	0f b6 10             	movzbl (%rax),%edx
+  800c82:	84 d2                	test   %dl,%dl
+  800c84:	75 ee                	jne    800c74 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c86:	c3                   	ret
+  800c87:	c3                   	ret
+
+0000000000800c88 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800c88:	55                   	push   %rbp
+  800c89:	48 89 e5             	mov    %rsp,%rbp
+  800c8c:	41 57                	push   %r15
+  800c8e:	41 56                	push   %r14
+  800c90:	41 55                	push   %r13
+  800c92:	41 54                	push   %r12
+  800c94:	53                   	push   %rbx
+  800c95:	48 83 ec 08          	sub    $0x8,%rsp
+  800c99:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800c9c:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800ca0:	45 84 ed             	test   %r13b,%r13b
+  800ca3:	75 12                	jne    800cb7 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800ca5:	4c 89 f8             	mov    %r15,%rax
+  800ca8:	48 83 c4 08          	add    $0x8,%rsp
+  800cac:	5b                   	pop    %rbx
+  800cad:	41 5c                	pop    %r12
+  800caf:	41 5d                	pop    %r13
+  800cb1:	41 5e                	pop    %r14
+  800cb3:	41 5f                	pop    %r15
+  800cb5:	5d                   	pop    %rbp
+  800cb6:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800cb7:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800cbb:	4c 89 e7             	mov    %r12,%rdi
+  800cbe:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  800cc5:	00 00 00 
+  800cc8:	ff d0                	call   *%rax
+  800cca:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800ccd:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800cd1:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800cd5:	49 bf 03 0c 80 00 00 	movabs $0x800c03,%r15
+  800cdc:	00 00 00 
+				if ((sc = *s++) == 0)
+  800cdf:	84 c0                	test   %al,%al
+  800ce1:	75 14                	jne    800cf7 <strstr+0x6f>
+					return NULL;
+  800ce3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800ce9:	eb ba                	jmp    800ca5 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800ceb:	48 83 c3 01          	add    $0x1,%rbx
+  800cef:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800cf3:	84 c0                	test   %al,%al
+  800cf5:	74 1b                	je     800d12 <strstr+0x8a>
+			} while (sc != c);
+  800cf7:	41 38 c5             	cmp    %al,%r13b
+  800cfa:	75 ef                	jne    800ceb <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800cfc:	4c 89 f2             	mov    %r14,%rdx
+  800cff:	4c 89 e6             	mov    %r12,%rsi
+  800d02:	48 89 df             	mov    %rbx,%rdi
+  800d05:	41 ff d7             	call   *%r15
+  800d08:	85 c0                	test   %eax,%eax
+  800d0a:	75 df                	jne    800ceb <strstr+0x63>
+  800d0c:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800d10:	eb 93                	jmp    800ca5 <strstr+0x1d>
+					return NULL;
+  800d12:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d18:	eb 8b                	jmp    800ca5 <strstr+0x1d>
+
+0000000000800d1a <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800d1a:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800d1c:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800d1f:	8d 57 20             	lea    0x20(%rdi),%edx
+  800d22:	83 f9 1a             	cmp    $0x1a,%ecx
+  800d25:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800d28:	c3                   	ret
+
+0000000000800d29 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800d29:	55                   	push   %rbp
+  800d2a:	48 89 e5             	mov    %rsp,%rbp
+  800d2d:	41 57                	push   %r15
+  800d2f:	41 56                	push   %r14
+  800d31:	41 55                	push   %r13
+  800d33:	41 54                	push   %r12
+  800d35:	53                   	push   %rbx
+  800d36:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800d3a:	48 39 f7             	cmp    %rsi,%rdi
+  800d3d:	74 49                	je     800d88 <strcasecmp+0x5f>
+  800d3f:	49 89 fd             	mov    %rdi,%r13
+  800d42:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800d45:	49 bf 1a 0d 80 00 00 	movabs $0x800d1a,%r15
+  800d4c:	00 00 00 
+  800d4f:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800d54:	41 0f b6 fe          	movzbl %r14b,%edi
+  800d58:	41 ff d7             	call   *%r15
+  800d5b:	89 c3                	mov    %eax,%ebx
+  800d5d:	49 83 c4 01          	add    $0x1,%r12
+  800d61:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800d67:	41 ff d7             	call   *%r15
+  800d6a:	29 c3                	sub    %eax,%ebx
+  800d6c:	75 09                	jne    800d77 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800d6e:	49 83 c5 01          	add    $0x1,%r13
+  800d72:	45 84 f6             	test   %r14b,%r14b
+  800d75:	75 d8                	jne    800d4f <strcasecmp+0x26>
+}
+  800d77:	89 d8                	mov    %ebx,%eax
+  800d79:	48 83 c4 08          	add    $0x8,%rsp
+  800d7d:	5b                   	pop    %rbx
+  800d7e:	41 5c                	pop    %r12
+  800d80:	41 5d                	pop    %r13
+  800d82:	41 5e                	pop    %r14
+  800d84:	41 5f                	pop    %r15
+  800d86:	5d                   	pop    %rbp
+  800d87:	c3                   	ret
+        return 0;
+  800d88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8d:	eb e8                	jmp    800d77 <strcasecmp+0x4e>
+
+0000000000800d8f <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800d8f:	55                   	push   %rbp
+  800d90:	48 89 e5             	mov    %rsp,%rbp
+  800d93:	41 57                	push   %r15
+  800d95:	41 56                	push   %r14
+  800d97:	41 55                	push   %r13
+  800d99:	41 54                	push   %r12
+  800d9b:	53                   	push   %rbx
+  800d9c:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800da0:	48 85 d2             	test   %rdx,%rdx
+  800da3:	74 4f                	je     800df4 <strncasecmp+0x65>
+  800da5:	49 89 fc             	mov    %rdi,%r12
+  800da8:	49 89 f5             	mov    %rsi,%r13
+  800dab:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800daf:	49 be 1a 0d 80 00 00 	movabs $0x800d1a,%r14
+  800db6:	00 00 00 
+  800db9:	49 83 c4 01          	add    $0x1,%r12
+  800dbd:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800dc3:	41 ff d6             	call   *%r14
+  800dc6:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800dc8:	49 83 c5 01          	add    $0x1,%r13
+  800dcc:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800dd1:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800dd4:	29 c3                	sub    %eax,%ebx
+  800dd6:	85 c0                	test   %eax,%eax
+  800dd8:	74 09                	je     800de3 <strncasecmp+0x54>
+  800dda:	85 db                	test   %ebx,%ebx
+  800ddc:	75 05                	jne    800de3 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800dde:	4d 39 fc             	cmp    %r15,%r12
+  800de1:	75 d6                	jne    800db9 <strncasecmp+0x2a>
+}
+  800de3:	89 d8                	mov    %ebx,%eax
+  800de5:	48 83 c4 08          	add    $0x8,%rsp
+  800de9:	5b                   	pop    %rbx
+  800dea:	41 5c                	pop    %r12
+  800dec:	41 5d                	pop    %r13
+  800dee:	41 5e                	pop    %r14
+  800df0:	41 5f                	pop    %r15
+  800df2:	5d                   	pop    %rbp
+  800df3:	c3                   	ret
+    int d = 0;
+  800df4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800df9:	eb e8                	jmp    800de3 <strncasecmp+0x54>
+
+0000000000800dfb <toupper>:
+
+int toupper(int c) {
+  800dfb:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800dfd:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800e00:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800e03:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e06:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e09:	c3                   	ret
+
+0000000000800e0a <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800e0a:	83 ff 20             	cmp    $0x20,%edi
+  800e0d:	0f 94 c0             	sete   %al
+  800e10:	0f b6 c0             	movzbl %al,%eax
+}
+  800e13:	c3                   	ret
+
+0000000000800e14 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800e14:	89 f8                	mov    %edi,%eax
+  800e16:	f7 d8                	neg    %eax
+  800e18:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800e1b:	c3                   	ret
+
+0000000000800e1c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e1c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e1f:	48 89 f8             	mov    %rdi,%rax
+  800e22:	48 f7 d8             	neg    %rax
+  800e25:	83 e0 07             	and    $0x7,%eax
+  800e28:	49 89 d1             	mov    %rdx,%r9
+  800e2b:	49 29 c1             	sub    %rax,%r9
+  800e2e:	78 36                	js     800e66 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e30:	40 0f b6 c6          	movzbl %sil,%eax
+  800e34:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e3b:	01 01 01 
+  800e3e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e42:	40 f6 c7 07          	test   $0x7,%dil
+  800e46:	75 38                	jne    800e80 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e48:	4c 89 c9             	mov    %r9,%rcx
+  800e4b:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e4f:	74 0c                	je     800e5d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e51:	fc                   	cld
+  800e52:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e55:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e59:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e5d:	4d 85 c9             	test   %r9,%r9
+  800e60:	75 45                	jne    800ea7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e62:	4c 89 c0             	mov    %r8,%rax
+  800e65:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e66:	48 85 d2             	test   %rdx,%rdx
+  800e69:	74 f7                	je     800e62 <memset+0x46>
+  800e6b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e6e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e71:	48 83 c0 01          	add    $0x1,%rax
+  800e75:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e79:	48 39 c2             	cmp    %rax,%rdx
+  800e7c:	75 f3                	jne    800e71 <memset+0x55>
+  800e7e:	eb e2                	jmp    800e62 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e80:	40 f6 c7 01          	test   $0x1,%dil
+  800e84:	74 06                	je     800e8c <memset+0x70>
+  800e86:	88 07                	mov    %al,(%rdi)
+  800e88:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e8c:	40 f6 c7 02          	test   $0x2,%dil
+  800e90:	74 07                	je     800e99 <memset+0x7d>
+  800e92:	66 89 07             	mov    %ax,(%rdi)
+  800e95:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e99:	40 f6 c7 04          	test   $0x4,%dil
+  800e9d:	74 a9                	je     800e48 <memset+0x2c>
+  800e9f:	89 07                	mov    %eax,(%rdi)
+  800ea1:	48 83 c7 04          	add    $0x4,%rdi
+  800ea5:	eb a1                	jmp    800e48 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ea7:	41 f6 c1 04          	test   $0x4,%r9b
+  800eab:	74 06                	je     800eb3 <memset+0x97>
+  800ead:	89 07                	mov    %eax,(%rdi)
+  800eaf:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eb3:	41 f6 c1 02          	test   $0x2,%r9b
+  800eb7:	74 07                	je     800ec0 <memset+0xa4>
+  800eb9:	66 89 07             	mov    %ax,(%rdi)
+  800ebc:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ec0:	41 f6 c1 01          	test   $0x1,%r9b
+  800ec4:	74 9c                	je     800e62 <memset+0x46>
+  800ec6:	88 07                	mov    %al,(%rdi)
+  800ec8:	eb 98                	jmp    800e62 <memset+0x46>
+
+0000000000800eca <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800eca:	48 89 f8             	mov    %rdi,%rax
+  800ecd:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ed0:	48 39 fe             	cmp    %rdi,%rsi
+  800ed3:	73 3b                	jae    800f10 <memmove+0x46>
+  800ed5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ed9:	48 39 d7             	cmp    %rdx,%rdi
+  800edc:	73 32                	jae    800f10 <memmove+0x46>
+        s += n;
+        d += n;
+  800ede:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ee2:	48 89 d6             	mov    %rdx,%rsi
+  800ee5:	48 09 fe             	or     %rdi,%rsi
+  800ee8:	48 09 ce             	or     %rcx,%rsi
+  800eeb:	40 f6 c6 07          	test   $0x7,%sil
+  800eef:	75 12                	jne    800f03 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ef1:	48 83 ef 08          	sub    $0x8,%rdi
+  800ef5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ef9:	48 c1 e9 03          	shr    $0x3,%rcx
+  800efd:	fd                   	std
+  800efe:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f01:	fc                   	cld
+  800f02:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f03:	48 83 ef 01          	sub    $0x1,%rdi
+  800f07:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f0b:	fd                   	std
+  800f0c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f0e:	eb f1                	jmp    800f01 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f10:	48 89 f2             	mov    %rsi,%rdx
+  800f13:	48 09 c2             	or     %rax,%rdx
+  800f16:	48 09 ca             	or     %rcx,%rdx
+  800f19:	f6 c2 07             	test   $0x7,%dl
+  800f1c:	75 0c                	jne    800f2a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f1e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f22:	48 89 c7             	mov    %rax,%rdi
+  800f25:	fc                   	cld
+  800f26:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f29:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f2a:	48 89 c7             	mov    %rax,%rdi
+  800f2d:	fc                   	cld
+  800f2e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f30:	c3                   	ret
+
+0000000000800f31 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f31:	55                   	push   %rbp
+  800f32:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f35:	48 b8 ca 0e 80 00 00 	movabs $0x800eca,%rax
+  800f3c:	00 00 00 
+  800f3f:	ff d0                	call   *%rax
+}
+  800f41:	5d                   	pop    %rbp
+  800f42:	c3                   	ret
+
+0000000000800f43 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f43:	55                   	push   %rbp
+  800f44:	48 89 e5             	mov    %rsp,%rbp
+  800f47:	41 57                	push   %r15
+  800f49:	41 56                	push   %r14
+  800f4b:	41 55                	push   %r13
+  800f4d:	41 54                	push   %r12
+  800f4f:	53                   	push   %rbx
+  800f50:	48 83 ec 08          	sub    $0x8,%rsp
+  800f54:	49 89 fe             	mov    %rdi,%r14
+  800f57:	49 89 f7             	mov    %rsi,%r15
+  800f5a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f5d:	48 89 f7             	mov    %rsi,%rdi
+  800f60:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  800f67:	00 00 00 
+  800f6a:	ff d0                	call   *%rax
+  800f6c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f6f:	48 89 de             	mov    %rbx,%rsi
+  800f72:	4c 89 f7             	mov    %r14,%rdi
+  800f75:	48 b8 19 0b 80 00 00 	movabs $0x800b19,%rax
+  800f7c:	00 00 00 
+  800f7f:	ff d0                	call   *%rax
+  800f81:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f84:	48 39 c3             	cmp    %rax,%rbx
+  800f87:	74 36                	je     800fbf <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f89:	48 89 d8             	mov    %rbx,%rax
+  800f8c:	4c 29 e8             	sub    %r13,%rax
+  800f8f:	49 39 c4             	cmp    %rax,%r12
+  800f92:	73 31                	jae    800fc5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f94:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f99:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f9d:	4c 89 fe             	mov    %r15,%rsi
+  800fa0:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  800fa7:	00 00 00 
+  800faa:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fac:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fb0:	48 83 c4 08          	add    $0x8,%rsp
+  800fb4:	5b                   	pop    %rbx
+  800fb5:	41 5c                	pop    %r12
+  800fb7:	41 5d                	pop    %r13
+  800fb9:	41 5e                	pop    %r14
+  800fbb:	41 5f                	pop    %r15
+  800fbd:	5d                   	pop    %rbp
+  800fbe:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fbf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fc3:	eb eb                	jmp    800fb0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fc5:	48 83 eb 01          	sub    $0x1,%rbx
+  800fc9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fcd:	48 89 da             	mov    %rbx,%rdx
+  800fd0:	4c 89 fe             	mov    %r15,%rsi
+  800fd3:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  800fda:	00 00 00 
+  800fdd:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fdf:	49 01 de             	add    %rbx,%r14
+  800fe2:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fe7:	eb c3                	jmp    800fac <strlcat+0x69>
+
+0000000000800fe9 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fe9:	48 85 d2             	test   %rdx,%rdx
+  800fec:	74 2d                	je     80101b <memcmp+0x32>
+  800fee:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ff3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ff7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ffc:	44 38 c1             	cmp    %r8b,%cl
+  800fff:	75 0f                	jne    801010 <memcmp+0x27>
+    while (n-- > 0) {
+  801001:	48 83 c0 01          	add    $0x1,%rax
+  801005:	48 39 c2             	cmp    %rax,%rdx
+  801008:	75 e9                	jne    800ff3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80100a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80100f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801010:	0f b6 c1             	movzbl %cl,%eax
+  801013:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801017:	44 29 c0             	sub    %r8d,%eax
+  80101a:	c3                   	ret
+    return 0;
+  80101b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801020:	c3                   	ret
+
+0000000000801021 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801021:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801025:	48 39 c7             	cmp    %rax,%rdi
+  801028:	73 0f                	jae    801039 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80102a:	40 38 37             	cmp    %sil,(%rdi)
+  80102d:	74 0e                	je     80103d <memfind+0x1c>
+    for (; src < end; src++) {
+  80102f:	48 83 c7 01          	add    $0x1,%rdi
+  801033:	48 39 f8             	cmp    %rdi,%rax
+  801036:	75 f2                	jne    80102a <memfind+0x9>
+  801038:	c3                   	ret
+  801039:	48 89 f8             	mov    %rdi,%rax
+  80103c:	c3                   	ret
+  80103d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801040:	c3                   	ret
+
+0000000000801041 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801041:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801044:	0f b6 37             	movzbl (%rdi),%esi
+  801047:	40 80 fe 20          	cmp    $0x20,%sil
+  80104b:	74 06                	je     801053 <strtol+0x12>
+  80104d:	40 80 fe 09          	cmp    $0x9,%sil
+  801051:	75 13                	jne    801066 <strtol+0x25>
+  801053:	48 83 c7 01          	add    $0x1,%rdi
+  801057:	0f b6 37             	movzbl (%rdi),%esi
+  80105a:	40 80 fe 20          	cmp    $0x20,%sil
+  80105e:	74 f3                	je     801053 <strtol+0x12>
+  801060:	40 80 fe 09          	cmp    $0x9,%sil
+  801064:	74 ed                	je     801053 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801066:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801069:	83 e0 fd             	and    $0xfffffffd,%eax
+  80106c:	3c 01                	cmp    $0x1,%al
+  80106e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801072:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801078:	75 0f                	jne    801089 <strtol+0x48>
+  80107a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80107d:	74 14                	je     801093 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80107f:	85 d2                	test   %edx,%edx
+  801081:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801086:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801089:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80108e:	4c 63 ca             	movslq %edx,%r9
+  801091:	eb 36                	jmp    8010c9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801093:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801097:	74 0f                	je     8010a8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801099:	85 d2                	test   %edx,%edx
+  80109b:	75 ec                	jne    801089 <strtol+0x48>
+        s++;
+  80109d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010a1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010a6:	eb e1                	jmp    801089 <strtol+0x48>
+        s += 2;
+  8010a8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010ac:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010b1:	eb d6                	jmp    801089 <strtol+0x48>
+            dig -= '0';
+  8010b3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010b6:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010ba:	41 39 d0             	cmp    %edx,%r8d
+  8010bd:	7d 21                	jge    8010e0 <strtol+0x9f>
+        val = val * base + dig;
+  8010bf:	49 0f af c1          	imul   %r9,%rax
+  8010c3:	0f b6 c9             	movzbl %cl,%ecx
+  8010c6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010c9:	48 83 c7 01          	add    $0x1,%rdi
+  8010cd:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010d1:	80 f9 39             	cmp    $0x39,%cl
+  8010d4:	76 dd                	jbe    8010b3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010d6:	80 f9 7b             	cmp    $0x7b,%cl
+  8010d9:	77 05                	ja     8010e0 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010db:	83 e9 57             	sub    $0x57,%ecx
+  8010de:	eb d6                	jmp    8010b6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010e0:	4d 85 d2             	test   %r10,%r10
+  8010e3:	74 03                	je     8010e8 <strtol+0xa7>
+  8010e5:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010e8:	48 89 c2             	mov    %rax,%rdx
+  8010eb:	48 f7 da             	neg    %rdx
+  8010ee:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010f2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010f6:	c3                   	ret
+
+00000000008010f7 <atoi>:
+int atoi(const char *str) {
+  8010f7:	55                   	push   %rbp
+  8010f8:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8010fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801100:	be 00 00 00 00       	mov    $0x0,%esi
+  801105:	48 b8 41 10 80 00 00 	movabs $0x801041,%rax
+  80110c:	00 00 00 
+  80110f:	ff d0                	call   *%rax
+}
+  801111:	5d                   	pop    %rbp
+  801112:	c3                   	ret
+
+0000000000801113 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801113:	55                   	push   %rbp
+  801114:	48 89 e5             	mov    %rsp,%rbp
+  801117:	53                   	push   %rbx
+  801118:	48 89 fa             	mov    %rdi,%rdx
+  80111b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80111e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801123:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801128:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80112d:	be 00 00 00 00       	mov    $0x0,%esi
+  801132:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801138:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80113a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80113e:	c9                   	leave
+  80113f:	c3                   	ret
+
+0000000000801140 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801140:	55                   	push   %rbp
+  801141:	48 89 e5             	mov    %rsp,%rbp
+  801144:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801145:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80114a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801154:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801159:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115e:	be 00 00 00 00       	mov    $0x0,%esi
+  801163:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801169:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80116b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80116f:	c9                   	leave
+  801170:	c3                   	ret
+
+0000000000801171 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801171:	55                   	push   %rbp
+  801172:	48 89 e5             	mov    %rsp,%rbp
+  801175:	53                   	push   %rbx
+  801176:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80117a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80117d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801182:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801191:	be 00 00 00 00       	mov    $0x0,%esi
+  801196:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80119e:	48 85 c0             	test   %rax,%rax
+  8011a1:	7f 06                	jg     8011a9 <sys_env_destroy+0x38>
+}
+  8011a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a7:	c9                   	leave
+  8011a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011a9:	49 89 c0             	mov    %rax,%r8
+  8011ac:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011b1:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8011b8:	00 00 00 
+  8011bb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8011c0:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  8011c7:	00 00 00 
+  8011ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cf:	49 b9 3b 3f 80 00 00 	movabs $0x803f3b,%r9
+  8011d6:	00 00 00 
+  8011d9:	41 ff d1             	call   *%r9
+
+00000000008011dc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011dc:	55                   	push   %rbp
+  8011dd:	48 89 e5             	mov    %rsp,%rbp
+  8011e0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801205:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801207:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120b:	c9                   	leave
+  80120c:	c3                   	ret
+
+000000000080120d <sys_yield>:
+
+void
+sys_yield(void) {
+  80120d:	55                   	push   %rbp
+  80120e:	48 89 e5             	mov    %rsp,%rbp
+  801211:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801212:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801217:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801221:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801226:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122b:	be 00 00 00 00       	mov    $0x0,%esi
+  801230:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801236:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801238:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80123c:	c9                   	leave
+  80123d:	c3                   	ret
+
+000000000080123e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80123e:	55                   	push   %rbp
+  80123f:	48 89 e5             	mov    %rsp,%rbp
+  801242:	53                   	push   %rbx
+  801243:	48 89 fa             	mov    %rdi,%rdx
+  801246:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801249:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80124e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801255:	00 00 00 
+  801258:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125d:	be 00 00 00 00       	mov    $0x0,%esi
+  801262:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801268:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80126a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126e:	c9                   	leave
+  80126f:	c3                   	ret
+
+0000000000801270 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801270:	55                   	push   %rbp
+  801271:	48 89 e5             	mov    %rsp,%rbp
+  801274:	53                   	push   %rbx
+  801275:	49 89 f8             	mov    %rdi,%r8
+  801278:	48 89 d3             	mov    %rdx,%rbx
+  80127b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80127e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801283:	4c 89 c2             	mov    %r8,%rdx
+  801286:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801289:	be 00 00 00 00       	mov    $0x0,%esi
+  80128e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801294:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801296:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129a:	c9                   	leave
+  80129b:	c3                   	ret
+
+000000000080129c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80129c:	55                   	push   %rbp
+  80129d:	48 89 e5             	mov    %rsp,%rbp
+  8012a0:	53                   	push   %rbx
+  8012a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8012a5:	89 f8                	mov    %edi,%eax
+  8012a7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012aa:	48 63 f9             	movslq %ecx,%rdi
+  8012ad:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c5:	48 85 c0             	test   %rax,%rax
+  8012c8:	7f 06                	jg     8012d0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ce:	c9                   	leave
+  8012cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d0:	49 89 c0             	mov    %rax,%r8
+  8012d3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012d8:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8012df:	00 00 00 
+  8012e2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8012e7:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  8012ee:	00 00 00 
+  8012f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f6:	49 b9 3b 3f 80 00 00 	movabs $0x803f3b,%r9
+  8012fd:	00 00 00 
+  801300:	41 ff d1             	call   *%r9
+
+0000000000801303 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801303:	55                   	push   %rbp
+  801304:	48 89 e5             	mov    %rsp,%rbp
+  801307:	53                   	push   %rbx
+  801308:	48 83 ec 08          	sub    $0x8,%rsp
+  80130c:	89 f8                	mov    %edi,%eax
+  80130e:	49 89 f2             	mov    %rsi,%r10
+  801311:	48 89 cf             	mov    %rcx,%rdi
+  801314:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801317:	48 63 da             	movslq %edx,%rbx
+  80131a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801322:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801325:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801328:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80132a:	48 85 c0             	test   %rax,%rax
+  80132d:	7f 06                	jg     801335 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80132f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801333:	c9                   	leave
+  801334:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801335:	49 89 c0             	mov    %rax,%r8
+  801338:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80133d:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  801344:	00 00 00 
+  801347:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80134c:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801353:	00 00 00 
+  801356:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135b:	49 b9 3b 3f 80 00 00 	movabs $0x803f3b,%r9
+  801362:	00 00 00 
+  801365:	41 ff d1             	call   *%r9
+
+0000000000801368 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801368:	55                   	push   %rbp
+  801369:	48 89 e5             	mov    %rsp,%rbp
+  80136c:	53                   	push   %rbx
+  80136d:	48 83 ec 08          	sub    $0x8,%rsp
+  801371:	49 89 f9             	mov    %rdi,%r9
+  801374:	89 f0                	mov    %esi,%eax
+  801376:	48 89 d3             	mov    %rdx,%rbx
+  801379:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80137c:	49 63 f0             	movslq %r8d,%rsi
+  80137f:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801382:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801387:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801390:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801392:	48 85 c0             	test   %rax,%rax
+  801395:	7f 06                	jg     80139d <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801397:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139b:	c9                   	leave
+  80139c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139d:	49 89 c0             	mov    %rax,%r8
+  8013a0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013a5:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8013ac:	00 00 00 
+  8013af:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013b4:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  8013bb:	00 00 00 
+  8013be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c3:	49 b9 3b 3f 80 00 00 	movabs $0x803f3b,%r9
+  8013ca:	00 00 00 
+  8013cd:	41 ff d1             	call   *%r9
+
+00000000008013d0 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8013d0:	55                   	push   %rbp
+  8013d1:	48 89 e5             	mov    %rsp,%rbp
+  8013d4:	53                   	push   %rbx
+  8013d5:	89 f8                	mov    %edi,%eax
+  8013d7:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8013da:	48 63 f9             	movslq %ecx,%rdi
+  8013dd:	48 63 da             	movslq %edx,%rbx
+  8013e0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013e8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f6:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8013f8:	89 c2                	mov    %eax,%edx
+  8013fa:	48 85 c0             	test   %rax,%rax
+  8013fd:	78 0d                	js     80140c <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8013ff:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801404:	4d 85 c9             	test   %r9,%r9
+  801407:	74 03                	je     80140c <sys_alloc_dma_region+0x3c>
+  801409:	49 89 01             	mov    %rax,(%r9)
+}
+  80140c:	89 d0                	mov    %edx,%eax
+  80140e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801412:	c9                   	leave
+  801413:	c3                   	ret
+
+0000000000801414 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801414:	55                   	push   %rbp
+  801415:	48 89 e5             	mov    %rsp,%rbp
+  801418:	53                   	push   %rbx
+  801419:	48 83 ec 08          	sub    $0x8,%rsp
+  80141d:	48 89 f1             	mov    %rsi,%rcx
+  801420:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801423:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801426:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801430:	be 00 00 00 00       	mov    $0x0,%esi
+  801435:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143d:	48 85 c0             	test   %rax,%rax
+  801440:	7f 06                	jg     801448 <sys_set_cache_region+0x34>
+}
+  801442:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801446:	c9                   	leave
+  801447:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801448:	49 89 c0             	mov    %rax,%r8
+  80144b:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801450:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  801457:	00 00 00 
+  80145a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80145f:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801466:	00 00 00 
+  801469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146e:	49 b9 3b 3f 80 00 00 	movabs $0x803f3b,%r9
+  801475:	00 00 00 
+  801478:	41 ff d1             	call   *%r9
+
+000000000080147b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80147b:	55                   	push   %rbp
+  80147c:	48 89 e5             	mov    %rsp,%rbp
+  80147f:	53                   	push   %rbx
+  801480:	48 83 ec 08          	sub    $0x8,%rsp
+  801484:	48 89 f1             	mov    %rsi,%rcx
+  801487:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80148a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80148d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801492:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801497:	be 00 00 00 00       	mov    $0x0,%esi
+  80149c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a4:	48 85 c0             	test   %rax,%rax
+  8014a7:	7f 06                	jg     8014af <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ad:	c9                   	leave
+  8014ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014af:	49 89 c0             	mov    %rax,%r8
+  8014b2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014b7:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8014be:	00 00 00 
+  8014c1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014c6:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  8014cd:	00 00 00 
+  8014d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d5:	49 b9 3b 3f 80 00 00 	movabs $0x803f3b,%r9
+  8014dc:	00 00 00 
+  8014df:	41 ff d1             	call   *%r9
+
+00000000008014e2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014e2:	55                   	push   %rbp
+  8014e3:	48 89 e5             	mov    %rsp,%rbp
+  8014e6:	53                   	push   %rbx
+  8014e7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014eb:	48 63 ce             	movslq %esi,%rcx
+  8014ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801500:	be 00 00 00 00       	mov    $0x0,%esi
+  801505:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150d:	48 85 c0             	test   %rax,%rax
+  801510:	7f 06                	jg     801518 <sys_env_set_status+0x36>
+}
+  801512:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801516:	c9                   	leave
+  801517:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801518:	49 89 c0             	mov    %rax,%r8
+  80151b:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801520:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  801527:	00 00 00 
+  80152a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80152f:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801536:	00 00 00 
+  801539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153e:	49 b9 3b 3f 80 00 00 	movabs $0x803f3b,%r9
+  801545:	00 00 00 
+  801548:	41 ff d1             	call   *%r9
+
+000000000080154b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80154b:	55                   	push   %rbp
+  80154c:	48 89 e5             	mov    %rsp,%rbp
+  80154f:	53                   	push   %rbx
+  801550:	48 83 ec 08          	sub    $0x8,%rsp
+  801554:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801557:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80155f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801564:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801569:	be 00 00 00 00       	mov    $0x0,%esi
+  80156e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801574:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801576:	48 85 c0             	test   %rax,%rax
+  801579:	7f 06                	jg     801581 <sys_env_set_trapframe+0x36>
+}
+  80157b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157f:	c9                   	leave
+  801580:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801581:	49 89 c0             	mov    %rax,%r8
+  801584:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801589:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  801590:	00 00 00 
+  801593:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801598:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  80159f:	00 00 00 
+  8015a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a7:	49 b9 3b 3f 80 00 00 	movabs $0x803f3b,%r9
+  8015ae:	00 00 00 
+  8015b1:	41 ff d1             	call   *%r9
+
+00000000008015b4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015b4:	55                   	push   %rbp
+  8015b5:	48 89 e5             	mov    %rsp,%rbp
+  8015b8:	53                   	push   %rbx
+  8015b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8015bd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015df:	48 85 c0             	test   %rax,%rax
+  8015e2:	7f 06                	jg     8015ea <sys_env_set_pgfault_upcall+0x36>
+}
+  8015e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e8:	c9                   	leave
+  8015e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ea:	49 89 c0             	mov    %rax,%r8
+  8015ed:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015f2:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  8015f9:	00 00 00 
+  8015fc:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801601:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801608:	00 00 00 
+  80160b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801610:	49 b9 3b 3f 80 00 00 	movabs $0x803f3b,%r9
+  801617:	00 00 00 
+  80161a:	41 ff d1             	call   *%r9
+
+000000000080161d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80161d:	55                   	push   %rbp
+  80161e:	48 89 e5             	mov    %rsp,%rbp
+  801621:	53                   	push   %rbx
+  801622:	89 f8                	mov    %edi,%eax
+  801624:	49 89 f1             	mov    %rsi,%r9
+  801627:	48 89 d3             	mov    %rdx,%rbx
+  80162a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80162d:	49 63 f0             	movslq %r8d,%rsi
+  801630:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801633:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801638:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80163b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801641:	cd 30                	int    $0x30
+}
+  801643:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801647:	c9                   	leave
+  801648:	c3                   	ret
+
+0000000000801649 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801649:	55                   	push   %rbp
+  80164a:	48 89 e5             	mov    %rsp,%rbp
+  80164d:	53                   	push   %rbx
+  80164e:	48 83 ec 08          	sub    $0x8,%rsp
+  801652:	48 89 fa             	mov    %rdi,%rdx
+  801655:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801658:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80165d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801662:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801667:	be 00 00 00 00       	mov    $0x0,%esi
+  80166c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801672:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801674:	48 85 c0             	test   %rax,%rax
+  801677:	7f 06                	jg     80167f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801679:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167d:	c9                   	leave
+  80167e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167f:	49 89 c0             	mov    %rax,%r8
+  801682:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801687:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  80168e:	00 00 00 
+  801691:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801696:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  80169d:	00 00 00 
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a5:	49 b9 3b 3f 80 00 00 	movabs $0x803f3b,%r9
+  8016ac:	00 00 00 
+  8016af:	41 ff d1             	call   *%r9
+
+00000000008016b2 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8016b2:	55                   	push   %rbp
+  8016b3:	48 89 e5             	mov    %rsp,%rbp
+  8016b6:	53                   	push   %rbx
+  8016b7:	48 89 fa             	mov    %rdi,%rdx
+  8016ba:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016bd:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d7:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016dd:	c9                   	leave
+  8016de:	c3                   	ret
+
+00000000008016df <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8016df:	55                   	push   %rbp
+  8016e0:	48 89 e5             	mov    %rsp,%rbp
+  8016e3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801702:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801708:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80170a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170e:	c9                   	leave
+  80170f:	c3                   	ret
+
+0000000000801710 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801710:	48 85 ff             	test   %rdi,%rdi
+  801713:	0f 84 b6 01 00 00    	je     8018cf <malloc+0x1bf>
+malloc(size_t size) {
+  801719:	55                   	push   %rbp
+  80171a:	48 89 e5             	mov    %rsp,%rbp
+  80171d:	41 56                	push   %r14
+  80171f:	41 55                	push   %r13
+  801721:	41 54                	push   %r12
+  801723:	53                   	push   %rbx
+  801724:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801727:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80172e:	00 00 00 
+  801731:	4c 8b 20             	mov    (%rax),%r12
+  801734:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80173b:	0f 87 94 01 00 00    	ja     8018d5 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801741:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801748:	00 00 00 
+  80174b:	48 85 c0             	test   %rax,%rax
+  80174e:	74 6b                	je     8017bb <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801750:	4d 85 e4             	test   %r12,%r12
+  801753:	74 66                	je     8017bb <malloc+0xab>
+  801755:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80175c:	00 00 00 
+  80175f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801764:	eb 0d                	jmp    801773 <malloc+0x63>
+  801766:	48 83 c1 01          	add    $0x1,%rcx
+  80176a:	48 83 c2 18          	add    $0x18,%rdx
+  80176e:	49 39 cc             	cmp    %rcx,%r12
+  801771:	74 48                	je     8017bb <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801773:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801778:	74 ec                	je     801766 <malloc+0x56>
+  80177a:	48 39 1a             	cmp    %rbx,(%rdx)
+  80177d:	72 e7                	jb     801766 <malloc+0x56>
+                real_freep_size--;
+  80177f:	48 83 e8 01          	sub    $0x1,%rax
+  801783:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80178a:	00 00 00 
+                freep[i].is_free = false;
+  80178d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801794:	00 00 00 
+  801797:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80179b:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  80179f:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8017a3:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8017aa:	00 
+                freep[i].size = size;
+  8017ab:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8017af:	48 01 c8             	add    %rcx,%rax
+  8017b2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017b6:	e9 0b 01 00 00       	jmp    8018c6 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8017bb:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8017c2:	00 00 00 
+  8017c5:	48 01 d8             	add    %rbx,%rax
+  8017c8:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8017ce:	76 7c                	jbe    80184c <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8017d0:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8017d7:	00 00 00 
+  8017da:	4c 8b 30             	mov    (%rax),%r14
+  8017dd:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8017e4:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8017e7:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8017ee:	00 00 00 
+  8017f1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8017f8:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8017ff:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801805:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801809:	48 b8 dc 11 80 00 00 	movabs $0x8011dc,%rax
+  801810:	00 00 00 
+  801813:	ff d0                	call   *%rax
+  801815:	89 c7                	mov    %eax,%edi
+  801817:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80181e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801825:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80182c:	00 00 00 
+  80182f:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801833:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801838:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  80183f:	00 00 00 
+  801842:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801844:	85 c0                	test   %eax,%eax
+  801846:	0f 88 90 00 00 00    	js     8018dc <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80184c:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801853:	00 00 00 
+  801856:	48 8b 31             	mov    (%rcx),%rsi
+  801859:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801860:	00 00 00 
+  801863:	4c 8b 07             	mov    (%rdi),%r8
+  801866:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80186a:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801871:	00 00 00 
+  801874:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801878:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80187c:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801883:	00 00 00 
+  801886:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80188a:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80188d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801891:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801898:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801899:	48 89 d8             	mov    %rbx,%rax
+  80189c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8018a1:	4c 01 c0             	add    %r8,%rax
+  8018a4:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8018a7:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8018ae:	48 01 f3             	add    %rsi,%rbx
+  8018b1:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8018b4:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8018b9:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8018c0:	00 00 00 
+  8018c3:	48 89 d0             	mov    %rdx,%rax
+}
+  8018c6:	5b                   	pop    %rbx
+  8018c7:	41 5c                	pop    %r12
+  8018c9:	41 5d                	pop    %r13
+  8018cb:	41 5e                	pop    %r14
+  8018cd:	5d                   	pop    %rbp
+  8018ce:	c3                   	ret
+        return NULL;
+  8018cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018d4:	c3                   	ret
+        return NULL;
+  8018d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018da:	eb ea                	jmp    8018c6 <malloc+0x1b6>
+            return NULL;
+  8018dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e1:	eb e3                	jmp    8018c6 <malloc+0x1b6>
+
+00000000008018e3 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8018e3:	55                   	push   %rbp
+  8018e4:	48 89 e5             	mov    %rsp,%rbp
+  8018e7:	53                   	push   %rbx
+  8018e8:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8018ec:	48 89 fb             	mov    %rdi,%rbx
+  8018ef:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8018f3:	48 89 df             	mov    %rbx,%rdi
+  8018f6:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  8018fd:	00 00 00 
+  801900:	ff d0                	call   *%rax
+  801902:	48 89 c7             	mov    %rax,%rdi
+  801905:	48 89 da             	mov    %rbx,%rdx
+  801908:	be 00 00 00 00       	mov    $0x0,%esi
+  80190d:	48 b8 1c 0e 80 00 00 	movabs $0x800e1c,%rax
+  801914:	00 00 00 
+  801917:	ff d0                	call   *%rax
+}
+  801919:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80191d:	c9                   	leave
+  80191e:	c3                   	ret
+
+000000000080191f <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  80191f:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801926:	00 00 00 
+  801929:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801930:	00 00 00 
+  801933:	48 3b 02             	cmp    (%rdx),%rax
+  801936:	74 4d                	je     801985 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801938:	48 85 c0             	test   %rax,%rax
+  80193b:	74 4d                	je     80198a <get_allocsize+0x6b>
+  80193d:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801944:	00 00 00 
+  801947:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80194c:	48 3b 39             	cmp    (%rcx),%rdi
+  80194f:	74 13                	je     801964 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801951:	48 83 c2 01          	add    $0x1,%rdx
+  801955:	48 83 c1 18          	add    $0x18,%rcx
+  801959:	48 39 d0             	cmp    %rdx,%rax
+  80195c:	75 ee                	jne    80194c <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  80195e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801963:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801964:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196d:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801974:	00 00 00 
+  801977:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80197d:	75 0b                	jne    80198a <get_allocsize+0x6b>
+  80197f:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801984:	c3                   	ret
+        return 0;
+  801985:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80198a:	c3                   	ret
+
+000000000080198b <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80198b:	48 85 ff             	test   %rdi,%rdi
+  80198e:	0f 84 01 01 00 00    	je     801a95 <free+0x10a>
+free(void *ptr) {
+  801994:	55                   	push   %rbp
+  801995:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801998:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80199f:	00 00 00 
+  8019a2:	48 8b 30             	mov    (%rax),%rsi
+  8019a5:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8019ac:	00 00 00 
+  8019af:	48 39 c6             	cmp    %rax,%rsi
+  8019b2:	74 50                	je     801a04 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8019b4:	48 85 f6             	test   %rsi,%rsi
+  8019b7:	74 21                	je     8019da <free+0x4f>
+  8019b9:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8019c0:	00 00 00 
+  8019c3:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8019c8:	48 3b 39             	cmp    (%rcx),%rdi
+  8019cb:	74 61                	je     801a2e <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8019cd:	48 83 c2 01          	add    $0x1,%rdx
+  8019d1:	48 83 c1 18          	add    $0x18,%rcx
+  8019d5:	48 39 d6             	cmp    %rdx,%rsi
+  8019d8:	75 ee                	jne    8019c8 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8019da:	48 ba 90 55 80 00 00 	movabs $0x805590,%rdx
+  8019e1:	00 00 00 
+  8019e4:	be 12 01 00 00       	mov    $0x112,%esi
+  8019e9:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  8019f0:	00 00 00 
+  8019f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f8:	48 b9 3b 3f 80 00 00 	movabs $0x803f3b,%rcx
+  8019ff:	00 00 00 
+  801a02:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801a04:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  801a0b:	00 00 00 
+  801a0e:	be 06 01 00 00       	mov    $0x106,%esi
+  801a13:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801a1a:	00 00 00 
+  801a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a22:	48 b9 3b 3f 80 00 00 	movabs $0x803f3b,%rcx
+  801a29:	00 00 00 
+  801a2c:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801a2e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a32:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a39:	00 00 00 
+  801a3c:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a42:	75 27                	jne    801a6b <free+0xe0>
+            freep[i].is_free = true;
+  801a44:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a48:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801a4f:	00 00 00 
+  801a52:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801a59:	00 00 
+            real_freep_size++;
+  801a5b:	48 83 c0 01          	add    $0x1,%rax
+  801a5f:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801a66:	00 00 00 
+}
+  801a69:	5d                   	pop    %rbp
+  801a6a:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801a6b:	48 ba 68 55 80 00 00 	movabs $0x805568,%rdx
+  801a72:	00 00 00 
+  801a75:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801a7a:	48 bf b8 55 80 00 00 	movabs $0x8055b8,%rdi
+  801a81:	00 00 00 
+  801a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a89:	48 b9 3b 3f 80 00 00 	movabs $0x803f3b,%rcx
+  801a90:	00 00 00 
+  801a93:	ff d1                	call   *%rcx
+  801a95:	c3                   	ret
+
+0000000000801a96 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801a96:	55                   	push   %rbp
+  801a97:	48 89 e5             	mov    %rsp,%rbp
+  801a9a:	41 55                	push   %r13
+  801a9c:	41 54                	push   %r12
+  801a9e:	53                   	push   %rbx
+  801a9f:	48 83 ec 08          	sub    $0x8,%rsp
+  801aa3:	48 89 fb             	mov    %rdi,%rbx
+  801aa6:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801aa9:	48 b8 1f 19 80 00 00 	movabs $0x80191f,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801ab5:	49 39 c5             	cmp    %rax,%r13
+  801ab8:	73 0e                	jae    801ac8 <realloc+0x32>
+}
+  801aba:	48 89 d8             	mov    %rbx,%rax
+  801abd:	48 83 c4 08          	add    $0x8,%rsp
+  801ac1:	5b                   	pop    %rbx
+  801ac2:	41 5c                	pop    %r12
+  801ac4:	41 5d                	pop    %r13
+  801ac6:	5d                   	pop    %rbp
+  801ac7:	c3                   	ret
+  801ac8:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801acb:	4c 89 ef             	mov    %r13,%rdi
+  801ace:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  801ad5:	00 00 00 
+  801ad8:	ff d0                	call   *%rax
+  801ada:	48 89 c7             	mov    %rax,%rdi
+  801add:	4c 89 e2             	mov    %r12,%rdx
+  801ae0:	48 89 de             	mov    %rbx,%rsi
+  801ae3:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+  801aef:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801af2:	48 89 df             	mov    %rbx,%rdi
+  801af5:	48 b8 8b 19 80 00 00 	movabs $0x80198b,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+    return newptr;
+  801b01:	4c 89 e3             	mov    %r12,%rbx
+  801b04:	eb b4                	jmp    801aba <realloc+0x24>
+
+0000000000801b06 <strdup>:
+
+char*
+strdup (const char *src) {
+  801b06:	55                   	push   %rbp
+  801b07:	48 89 e5             	mov    %rsp,%rbp
+  801b0a:	41 54                	push   %r12
+  801b0c:	53                   	push   %rbx
+  801b0d:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801b10:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  801b17:	00 00 00 
+  801b1a:	ff d0                	call   *%rax
+  801b1c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801b20:	4c 89 e7             	mov    %r12,%rdi
+  801b23:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  801b2a:	00 00 00 
+  801b2d:	ff d0                	call   *%rax
+  801b2f:	48 89 c7             	mov    %rax,%rdi
+  801b32:	4c 89 e2             	mov    %r12,%rdx
+  801b35:	48 89 de             	mov    %rbx,%rsi
+  801b38:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  801b3f:	00 00 00 
+  801b42:	ff d0                	call   *%rax
+}
+  801b44:	5b                   	pop    %rbx
+  801b45:	41 5c                	pop    %r12
+  801b47:	5d                   	pop    %rbp
+  801b48:	c3                   	ret
+
+0000000000801b49 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801b49:	55                   	push   %rbp
+  801b4a:	48 89 e5             	mov    %rsp,%rbp
+  801b4d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b4e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b58:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b62:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b67:	be 00 00 00 00       	mov    $0x0,%esi
+  801b6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b72:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b78:	c9                   	leave
+  801b79:	c3                   	ret
+
+0000000000801b7a <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801b7a:	55                   	push   %rbp
+  801b7b:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801b7e:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801b85:	00 00 00 
+  801b88:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801b8c:	74 26                	je     801bb4 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801b8e:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801b90:	48 c1 e2 20          	shl    $0x20,%rdx
+  801b94:	89 c0                	mov    %eax,%eax
+  801b96:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801b99:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801ba0:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801ba7:	00 00 00 
+  801baa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801baf:	48 f7 31             	divq   (%rcx)
+}
+  801bb2:	5d                   	pop    %rbp
+  801bb3:	c3                   	ret
+        freq = get_cpufreq();
+  801bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb9:	48 ba 49 1b 80 00 00 	movabs $0x801b49,%rdx
+  801bc0:	00 00 00 
+  801bc3:	ff d2                	call   *%rdx
+  801bc5:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801bcc:	00 00 00 
+  801bcf:	eb bd                	jmp    801b8e <get_ticks+0x14>
+
+0000000000801bd1 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801bd1:	55                   	push   %rbp
+  801bd2:	48 89 e5             	mov    %rsp,%rbp
+  801bd5:	53                   	push   %rbx
+  801bd6:	48 83 ec 08          	sub    $0x8,%rsp
+  801bda:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801bdd:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801be4:	00 00 00 
+  801be7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801beb:	74 50                	je     801c3d <sleep+0x6c>
+    asm volatile("rdtsc"
+  801bed:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801bef:	48 c1 e2 20          	shl    $0x20,%rdx
+  801bf3:	89 c0                	mov    %eax,%eax
+  801bf5:	48 89 d6             	mov    %rdx,%rsi
+  801bf8:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801bfb:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c02:	00 00 00 
+  801c05:	48 0f af 18          	imul   (%rax),%rbx
+  801c09:	48 c1 eb 03          	shr    $0x3,%rbx
+  801c0d:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801c14:	9b c4 20 
+  801c17:	48 89 d8             	mov    %rbx,%rax
+  801c1a:	48 f7 e2             	mul    %rdx
+  801c1d:	48 89 d1             	mov    %rdx,%rcx
+  801c20:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801c24:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c26:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c2a:	89 c0                	mov    %eax,%eax
+  801c2c:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801c2f:	48 29 f2             	sub    %rsi,%rdx
+  801c32:	48 39 ca             	cmp    %rcx,%rdx
+  801c35:	72 ed                	jb     801c24 <sleep+0x53>
+}
+  801c37:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c3b:	c9                   	leave
+  801c3c:	c3                   	ret
+        freq = get_cpufreq();
+  801c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c42:	48 ba 49 1b 80 00 00 	movabs $0x801b49,%rdx
+  801c49:	00 00 00 
+  801c4c:	ff d2                	call   *%rdx
+  801c4e:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c55:	00 00 00 
+  801c58:	eb 93                	jmp    801bed <sleep+0x1c>
+
+0000000000801c5a <poll_kbd>:
+
+int poll_kbd() {
+  801c5a:	55                   	push   %rbp
+  801c5b:	48 89 e5             	mov    %rsp,%rbp
+  801c5e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c5f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c69:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c73:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c78:	be 00 00 00 00       	mov    $0x0,%esi
+  801c7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c83:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c89:	c9                   	leave
+  801c8a:	c3                   	ret
+
+0000000000801c8b <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801c8b:	55                   	push   %rbp
+  801c8c:	48 89 e5             	mov    %rsp,%rbp
+  801c8f:	53                   	push   %rbx
+  801c90:	49 89 fa             	mov    %rdi,%r10
+  801c93:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801c95:	44 89 c6             	mov    %r8d,%esi
+  801c98:	89 cf                	mov    %ecx,%edi
+  801c9a:	89 d3                	mov    %edx,%ebx
+  801c9c:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801c9e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ca3:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ca6:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801caa:	cd 30                	int    $0x30
+  801cac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cb0:	c9                   	leave
+  801cb1:	c3                   	ret
+
+0000000000801cb2 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cb2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801cb9:	ff ff ff 
+  801cbc:	48 01 f8             	add    %rdi,%rax
+  801cbf:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801cc3:	c3                   	ret
+
+0000000000801cc4 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cc4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ccb:	ff ff ff 
+  801cce:	48 01 f8             	add    %rdi,%rax
+  801cd1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801cd5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801cdb:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801cdf:	c3                   	ret
+
+0000000000801ce0 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ce0:	55                   	push   %rbp
+  801ce1:	48 89 e5             	mov    %rsp,%rbp
+  801ce4:	41 57                	push   %r15
+  801ce6:	41 56                	push   %r14
+  801ce8:	41 55                	push   %r13
+  801cea:	41 54                	push   %r12
+  801cec:	53                   	push   %rbx
+  801ced:	48 83 ec 08          	sub    $0x8,%rsp
+  801cf1:	49 89 ff             	mov    %rdi,%r15
+  801cf4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801cf9:	49 bd 94 3b 80 00 00 	movabs $0x803b94,%r13
+  801d00:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801d03:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801d09:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801d0c:	48 89 df             	mov    %rbx,%rdi
+  801d0f:	41 ff d5             	call   *%r13
+  801d12:	83 e0 04             	and    $0x4,%eax
+  801d15:	74 17                	je     801d2e <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801d17:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d1e:	4c 39 f3             	cmp    %r14,%rbx
+  801d21:	75 e6                	jne    801d09 <fd_alloc+0x29>
+  801d23:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801d29:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801d2e:	4d 89 27             	mov    %r12,(%r15)
+}
+  801d31:	48 83 c4 08          	add    $0x8,%rsp
+  801d35:	5b                   	pop    %rbx
+  801d36:	41 5c                	pop    %r12
+  801d38:	41 5d                	pop    %r13
+  801d3a:	41 5e                	pop    %r14
+  801d3c:	41 5f                	pop    %r15
+  801d3e:	5d                   	pop    %rbp
+  801d3f:	c3                   	ret
+
+0000000000801d40 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801d40:	83 ff 1f             	cmp    $0x1f,%edi
+  801d43:	77 39                	ja     801d7e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801d45:	55                   	push   %rbp
+  801d46:	48 89 e5             	mov    %rsp,%rbp
+  801d49:	41 54                	push   %r12
+  801d4b:	53                   	push   %rbx
+  801d4c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801d4f:	48 63 df             	movslq %edi,%rbx
+  801d52:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801d59:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801d5d:	48 89 df             	mov    %rbx,%rdi
+  801d60:	48 b8 94 3b 80 00 00 	movabs $0x803b94,%rax
+  801d67:	00 00 00 
+  801d6a:	ff d0                	call   *%rax
+  801d6c:	a8 04                	test   $0x4,%al
+  801d6e:	74 14                	je     801d84 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801d70:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801d74:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d79:	5b                   	pop    %rbx
+  801d7a:	41 5c                	pop    %r12
+  801d7c:	5d                   	pop    %rbp
+  801d7d:	c3                   	ret
+        return -E_INVAL;
+  801d7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801d83:	c3                   	ret
+        return -E_INVAL;
+  801d84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d89:	eb ee                	jmp    801d79 <fd_lookup+0x39>
+
+0000000000801d8b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801d8b:	55                   	push   %rbp
+  801d8c:	48 89 e5             	mov    %rsp,%rbp
+  801d8f:	41 54                	push   %r12
+  801d91:	53                   	push   %rbx
+  801d92:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801d95:	48 b8 60 56 80 00 00 	movabs $0x805660,%rax
+  801d9c:	00 00 00 
+  801d9f:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801da6:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801da9:	39 3b                	cmp    %edi,(%rbx)
+  801dab:	74 47                	je     801df4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801dad:	48 83 c0 08          	add    $0x8,%rax
+  801db1:	48 8b 18             	mov    (%rax),%rbx
+  801db4:	48 85 db             	test   %rbx,%rbx
+  801db7:	75 f0                	jne    801da9 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801db9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801dc0:	00 00 00 
+  801dc3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dc9:	89 fa                	mov    %edi,%edx
+  801dcb:	48 bf c8 55 80 00 00 	movabs $0x8055c8,%rdi
+  801dd2:	00 00 00 
+  801dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dda:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  801de1:	00 00 00 
+  801de4:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801de6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801deb:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801def:	5b                   	pop    %rbx
+  801df0:	41 5c                	pop    %r12
+  801df2:	5d                   	pop    %rbp
+  801df3:	c3                   	ret
+            return 0;
+  801df4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df9:	eb f0                	jmp    801deb <dev_lookup+0x60>
+
+0000000000801dfb <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801dfb:	55                   	push   %rbp
+  801dfc:	48 89 e5             	mov    %rsp,%rbp
+  801dff:	41 55                	push   %r13
+  801e01:	41 54                	push   %r12
+  801e03:	53                   	push   %rbx
+  801e04:	48 83 ec 18          	sub    $0x18,%rsp
+  801e08:	48 89 fb             	mov    %rdi,%rbx
+  801e0b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e0e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801e15:	ff ff ff 
+  801e18:	48 01 df             	add    %rbx,%rdi
+  801e1b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801e1f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e23:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  801e2a:	00 00 00 
+  801e2d:	ff d0                	call   *%rax
+  801e2f:	41 89 c5             	mov    %eax,%r13d
+  801e32:	85 c0                	test   %eax,%eax
+  801e34:	78 06                	js     801e3c <fd_close+0x41>
+  801e36:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801e3a:	74 1a                	je     801e56 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801e3c:	45 84 e4             	test   %r12b,%r12b
+  801e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e44:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801e48:	44 89 e8             	mov    %r13d,%eax
+  801e4b:	48 83 c4 18          	add    $0x18,%rsp
+  801e4f:	5b                   	pop    %rbx
+  801e50:	41 5c                	pop    %r12
+  801e52:	41 5d                	pop    %r13
+  801e54:	5d                   	pop    %rbp
+  801e55:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e56:	8b 3b                	mov    (%rbx),%edi
+  801e58:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e5c:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  801e63:	00 00 00 
+  801e66:	ff d0                	call   *%rax
+  801e68:	41 89 c5             	mov    %eax,%r13d
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 1b                	js     801e8a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801e6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e73:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e77:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e7d:	48 85 c0             	test   %rax,%rax
+  801e80:	74 08                	je     801e8a <fd_close+0x8f>
+  801e82:	48 89 df             	mov    %rbx,%rdi
+  801e85:	ff d0                	call   *%rax
+  801e87:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801e8a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e8f:	48 89 de             	mov    %rbx,%rsi
+  801e92:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e97:	48 b8 7b 14 80 00 00 	movabs $0x80147b,%rax
+  801e9e:	00 00 00 
+  801ea1:	ff d0                	call   *%rax
+    return res;
+  801ea3:	eb a3                	jmp    801e48 <fd_close+0x4d>
+
+0000000000801ea5 <close>:
+
+int
+close(int fdnum) {
+  801ea5:	55                   	push   %rbp
+  801ea6:	48 89 e5             	mov    %rsp,%rbp
+  801ea9:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ead:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801eb1:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  801eb8:	00 00 00 
+  801ebb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ebd:	85 c0                	test   %eax,%eax
+  801ebf:	78 15                	js     801ed6 <close+0x31>
+
+    return fd_close(fd, 1);
+  801ec1:	be 01 00 00 00       	mov    $0x1,%esi
+  801ec6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801eca:	48 b8 fb 1d 80 00 00 	movabs $0x801dfb,%rax
+  801ed1:	00 00 00 
+  801ed4:	ff d0                	call   *%rax
+}
+  801ed6:	c9                   	leave
+  801ed7:	c3                   	ret
+
+0000000000801ed8 <close_all>:
+
+void
+close_all(void) {
+  801ed8:	55                   	push   %rbp
+  801ed9:	48 89 e5             	mov    %rsp,%rbp
+  801edc:	41 54                	push   %r12
+  801ede:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801edf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ee4:	49 bc a5 1e 80 00 00 	movabs $0x801ea5,%r12
+  801eeb:	00 00 00 
+  801eee:	89 df                	mov    %ebx,%edi
+  801ef0:	41 ff d4             	call   *%r12
+  801ef3:	83 c3 01             	add    $0x1,%ebx
+  801ef6:	83 fb 20             	cmp    $0x20,%ebx
+  801ef9:	75 f3                	jne    801eee <close_all+0x16>
+}
+  801efb:	5b                   	pop    %rbx
+  801efc:	41 5c                	pop    %r12
+  801efe:	5d                   	pop    %rbp
+  801eff:	c3                   	ret
+
+0000000000801f00 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801f00:	55                   	push   %rbp
+  801f01:	48 89 e5             	mov    %rsp,%rbp
+  801f04:	41 57                	push   %r15
+  801f06:	41 56                	push   %r14
+  801f08:	41 55                	push   %r13
+  801f0a:	41 54                	push   %r12
+  801f0c:	53                   	push   %rbx
+  801f0d:	48 83 ec 18          	sub    $0x18,%rsp
+  801f11:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801f14:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801f18:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  801f1f:	00 00 00 
+  801f22:	ff d0                	call   *%rax
+  801f24:	89 c3                	mov    %eax,%ebx
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	0f 88 b8 00 00 00    	js     801fe6 <dup+0xe6>
+    close(newfdnum);
+  801f2e:	44 89 e7             	mov    %r12d,%edi
+  801f31:	48 b8 a5 1e 80 00 00 	movabs $0x801ea5,%rax
+  801f38:	00 00 00 
+  801f3b:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801f3d:	4d 63 ec             	movslq %r12d,%r13
+  801f40:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801f47:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801f4b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801f4f:	4c 89 ff             	mov    %r15,%rdi
+  801f52:	49 be c4 1c 80 00 00 	movabs $0x801cc4,%r14
+  801f59:	00 00 00 
+  801f5c:	41 ff d6             	call   *%r14
+  801f5f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801f62:	4c 89 ef             	mov    %r13,%rdi
+  801f65:	41 ff d6             	call   *%r14
+  801f68:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801f6b:	48 89 df             	mov    %rbx,%rdi
+  801f6e:	48 b8 94 3b 80 00 00 	movabs $0x803b94,%rax
+  801f75:	00 00 00 
+  801f78:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801f7a:	a8 04                	test   $0x4,%al
+  801f7c:	74 2b                	je     801fa9 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801f7e:	41 89 c1             	mov    %eax,%r9d
+  801f81:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f87:	4c 89 f1             	mov    %r14,%rcx
+  801f8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8f:	48 89 de             	mov    %rbx,%rsi
+  801f92:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f97:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  801f9e:	00 00 00 
+  801fa1:	ff d0                	call   *%rax
+  801fa3:	89 c3                	mov    %eax,%ebx
+  801fa5:	85 c0                	test   %eax,%eax
+  801fa7:	78 4e                	js     801ff7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801fa9:	4c 89 ff             	mov    %r15,%rdi
+  801fac:	48 b8 94 3b 80 00 00 	movabs $0x803b94,%rax
+  801fb3:	00 00 00 
+  801fb6:	ff d0                	call   *%rax
+  801fb8:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801fbb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fc1:	4c 89 e9             	mov    %r13,%rcx
+  801fc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc9:	4c 89 fe             	mov    %r15,%rsi
+  801fcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fd1:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  801fd8:	00 00 00 
+  801fdb:	ff d0                	call   *%rax
+  801fdd:	89 c3                	mov    %eax,%ebx
+  801fdf:	85 c0                	test   %eax,%eax
+  801fe1:	78 14                	js     801ff7 <dup+0xf7>
+
+    return newfdnum;
+  801fe3:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801fe6:	89 d8                	mov    %ebx,%eax
+  801fe8:	48 83 c4 18          	add    $0x18,%rsp
+  801fec:	5b                   	pop    %rbx
+  801fed:	41 5c                	pop    %r12
+  801fef:	41 5d                	pop    %r13
+  801ff1:	41 5e                	pop    %r14
+  801ff3:	41 5f                	pop    %r15
+  801ff5:	5d                   	pop    %rbp
+  801ff6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ff7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ffc:	4c 89 ee             	mov    %r13,%rsi
+  801fff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802004:	49 bc 7b 14 80 00 00 	movabs $0x80147b,%r12
+  80200b:	00 00 00 
+  80200e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802011:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802016:	4c 89 f6             	mov    %r14,%rsi
+  802019:	bf 00 00 00 00       	mov    $0x0,%edi
+  80201e:	41 ff d4             	call   *%r12
+    return res;
+  802021:	eb c3                	jmp    801fe6 <dup+0xe6>
+
+0000000000802023 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802023:	55                   	push   %rbp
+  802024:	48 89 e5             	mov    %rsp,%rbp
+  802027:	41 56                	push   %r14
+  802029:	41 55                	push   %r13
+  80202b:	41 54                	push   %r12
+  80202d:	53                   	push   %rbx
+  80202e:	48 83 ec 10          	sub    $0x10,%rsp
+  802032:	89 fb                	mov    %edi,%ebx
+  802034:	49 89 f4             	mov    %rsi,%r12
+  802037:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80203a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80203e:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  802045:	00 00 00 
+  802048:	ff d0                	call   *%rax
+  80204a:	85 c0                	test   %eax,%eax
+  80204c:	78 4c                	js     80209a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80204e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802052:	41 8b 3e             	mov    (%r14),%edi
+  802055:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802059:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+  802065:	85 c0                	test   %eax,%eax
+  802067:	78 35                	js     80209e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802069:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80206d:	83 e0 03             	and    $0x3,%eax
+  802070:	83 f8 01             	cmp    $0x1,%eax
+  802073:	74 2d                	je     8020a2 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802075:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802079:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80207d:	48 85 c0             	test   %rax,%rax
+  802080:	74 56                	je     8020d8 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802082:	4c 89 ea             	mov    %r13,%rdx
+  802085:	4c 89 e6             	mov    %r12,%rsi
+  802088:	4c 89 f7             	mov    %r14,%rdi
+  80208b:	ff d0                	call   *%rax
+}
+  80208d:	48 83 c4 10          	add    $0x10,%rsp
+  802091:	5b                   	pop    %rbx
+  802092:	41 5c                	pop    %r12
+  802094:	41 5d                	pop    %r13
+  802096:	41 5e                	pop    %r14
+  802098:	5d                   	pop    %rbp
+  802099:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80209a:	48 98                	cltq
+  80209c:	eb ef                	jmp    80208d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80209e:	48 98                	cltq
+  8020a0:	eb eb                	jmp    80208d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020a2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020a9:	00 00 00 
+  8020ac:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020b2:	89 da                	mov    %ebx,%edx
+  8020b4:	48 bf 09 56 80 00 00 	movabs $0x805609,%rdi
+  8020bb:	00 00 00 
+  8020be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c3:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  8020ca:	00 00 00 
+  8020cd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020cf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020d6:	eb b5                	jmp    80208d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020d8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020df:	eb ac                	jmp    80208d <read+0x6a>
+
+00000000008020e1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8020e1:	55                   	push   %rbp
+  8020e2:	48 89 e5             	mov    %rsp,%rbp
+  8020e5:	41 57                	push   %r15
+  8020e7:	41 56                	push   %r14
+  8020e9:	41 55                	push   %r13
+  8020eb:	41 54                	push   %r12
+  8020ed:	53                   	push   %rbx
+  8020ee:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8020f2:	48 85 d2             	test   %rdx,%rdx
+  8020f5:	74 54                	je     80214b <readn+0x6a>
+  8020f7:	41 89 fd             	mov    %edi,%r13d
+  8020fa:	49 89 f6             	mov    %rsi,%r14
+  8020fd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802100:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802105:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80210a:	49 bf 23 20 80 00 00 	movabs $0x802023,%r15
+  802111:	00 00 00 
+  802114:	4c 89 e2             	mov    %r12,%rdx
+  802117:	48 29 f2             	sub    %rsi,%rdx
+  80211a:	4c 01 f6             	add    %r14,%rsi
+  80211d:	44 89 ef             	mov    %r13d,%edi
+  802120:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802123:	85 c0                	test   %eax,%eax
+  802125:	78 20                	js     802147 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802127:	01 c3                	add    %eax,%ebx
+  802129:	85 c0                	test   %eax,%eax
+  80212b:	74 08                	je     802135 <readn+0x54>
+  80212d:	48 63 f3             	movslq %ebx,%rsi
+  802130:	4c 39 e6             	cmp    %r12,%rsi
+  802133:	72 df                	jb     802114 <readn+0x33>
+    }
+    return res;
+  802135:	48 63 c3             	movslq %ebx,%rax
+}
+  802138:	48 83 c4 08          	add    $0x8,%rsp
+  80213c:	5b                   	pop    %rbx
+  80213d:	41 5c                	pop    %r12
+  80213f:	41 5d                	pop    %r13
+  802141:	41 5e                	pop    %r14
+  802143:	41 5f                	pop    %r15
+  802145:	5d                   	pop    %rbp
+  802146:	c3                   	ret
+        if (inc < 0) return inc;
+  802147:	48 98                	cltq
+  802149:	eb ed                	jmp    802138 <readn+0x57>
+    int inc = 1, res = 0;
+  80214b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802150:	eb e3                	jmp    802135 <readn+0x54>
+
+0000000000802152 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802152:	55                   	push   %rbp
+  802153:	48 89 e5             	mov    %rsp,%rbp
+  802156:	41 56                	push   %r14
+  802158:	41 55                	push   %r13
+  80215a:	41 54                	push   %r12
+  80215c:	53                   	push   %rbx
+  80215d:	48 83 ec 10          	sub    $0x10,%rsp
+  802161:	89 fb                	mov    %edi,%ebx
+  802163:	49 89 f4             	mov    %rsi,%r12
+  802166:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802169:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80216d:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  802174:	00 00 00 
+  802177:	ff d0                	call   *%rax
+  802179:	85 c0                	test   %eax,%eax
+  80217b:	78 47                	js     8021c4 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80217d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802181:	41 8b 3e             	mov    (%r14),%edi
+  802184:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802188:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  80218f:	00 00 00 
+  802192:	ff d0                	call   *%rax
+  802194:	85 c0                	test   %eax,%eax
+  802196:	78 30                	js     8021c8 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802198:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80219d:	74 2d                	je     8021cc <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80219f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021a3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8021a7:	48 85 c0             	test   %rax,%rax
+  8021aa:	74 56                	je     802202 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8021ac:	4c 89 ea             	mov    %r13,%rdx
+  8021af:	4c 89 e6             	mov    %r12,%rsi
+  8021b2:	4c 89 f7             	mov    %r14,%rdi
+  8021b5:	ff d0                	call   *%rax
+}
+  8021b7:	48 83 c4 10          	add    $0x10,%rsp
+  8021bb:	5b                   	pop    %rbx
+  8021bc:	41 5c                	pop    %r12
+  8021be:	41 5d                	pop    %r13
+  8021c0:	41 5e                	pop    %r14
+  8021c2:	5d                   	pop    %rbp
+  8021c3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021c4:	48 98                	cltq
+  8021c6:	eb ef                	jmp    8021b7 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021c8:	48 98                	cltq
+  8021ca:	eb eb                	jmp    8021b7 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021cc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021d3:	00 00 00 
+  8021d6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021dc:	89 da                	mov    %ebx,%edx
+  8021de:	48 bf 25 56 80 00 00 	movabs $0x805625,%rdi
+  8021e5:	00 00 00 
+  8021e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ed:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  8021f4:	00 00 00 
+  8021f7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021f9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802200:	eb b5                	jmp    8021b7 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802202:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802209:	eb ac                	jmp    8021b7 <write+0x65>
+
+000000000080220b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80220b:	55                   	push   %rbp
+  80220c:	48 89 e5             	mov    %rsp,%rbp
+  80220f:	53                   	push   %rbx
+  802210:	48 83 ec 18          	sub    $0x18,%rsp
+  802214:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802216:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80221a:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  802221:	00 00 00 
+  802224:	ff d0                	call   *%rax
+  802226:	85 c0                	test   %eax,%eax
+  802228:	78 0c                	js     802236 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80222a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80222e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802231:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802236:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+
+000000000080223c <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80223c:	55                   	push   %rbp
+  80223d:	48 89 e5             	mov    %rsp,%rbp
+  802240:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802244:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802248:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  80224f:	00 00 00 
+  802252:	ff d0                	call   *%rax
+  802254:	85 c0                	test   %eax,%eax
+  802256:	78 07                	js     80225f <tell+0x23>
+    return fdes->fd_offset;
+  802258:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80225c:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80225f:	c9                   	leave
+  802260:	c3                   	ret
+
+0000000000802261 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802261:	55                   	push   %rbp
+  802262:	48 89 e5             	mov    %rsp,%rbp
+  802265:	41 55                	push   %r13
+  802267:	41 54                	push   %r12
+  802269:	53                   	push   %rbx
+  80226a:	48 83 ec 18          	sub    $0x18,%rsp
+  80226e:	89 fb                	mov    %edi,%ebx
+  802270:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802273:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802277:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  80227e:	00 00 00 
+  802281:	ff d0                	call   *%rax
+  802283:	85 c0                	test   %eax,%eax
+  802285:	78 38                	js     8022bf <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802287:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80228b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80228f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802293:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  80229a:	00 00 00 
+  80229d:	ff d0                	call   *%rax
+  80229f:	85 c0                	test   %eax,%eax
+  8022a1:	78 1c                	js     8022bf <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022a3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8022a8:	74 20                	je     8022ca <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022ae:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8022b2:	48 85 c0             	test   %rax,%rax
+  8022b5:	74 47                	je     8022fe <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8022b7:	44 89 e6             	mov    %r12d,%esi
+  8022ba:	4c 89 ef             	mov    %r13,%rdi
+  8022bd:	ff d0                	call   *%rax
+}
+  8022bf:	48 83 c4 18          	add    $0x18,%rsp
+  8022c3:	5b                   	pop    %rbx
+  8022c4:	41 5c                	pop    %r12
+  8022c6:	41 5d                	pop    %r13
+  8022c8:	5d                   	pop    %rbp
+  8022c9:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8022ca:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022d1:	00 00 00 
+  8022d4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022da:	89 da                	mov    %ebx,%edx
+  8022dc:	48 bf e8 55 80 00 00 	movabs $0x8055e8,%rdi
+  8022e3:	00 00 00 
+  8022e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022eb:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  8022f2:	00 00 00 
+  8022f5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022fc:	eb c1                	jmp    8022bf <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022fe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802303:	eb ba                	jmp    8022bf <ftruncate+0x5e>
+
+0000000000802305 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802305:	55                   	push   %rbp
+  802306:	48 89 e5             	mov    %rsp,%rbp
+  802309:	41 54                	push   %r12
+  80230b:	53                   	push   %rbx
+  80230c:	48 83 ec 10          	sub    $0x10,%rsp
+  802310:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802313:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802317:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  80231e:	00 00 00 
+  802321:	ff d0                	call   *%rax
+  802323:	85 c0                	test   %eax,%eax
+  802325:	78 4e                	js     802375 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802327:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80232b:	41 8b 3c 24          	mov    (%r12),%edi
+  80232f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802333:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  80233a:	00 00 00 
+  80233d:	ff d0                	call   *%rax
+  80233f:	85 c0                	test   %eax,%eax
+  802341:	78 32                	js     802375 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802343:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802347:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80234c:	74 30                	je     80237e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80234e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802351:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802358:	00 00 00 
+    stat->st_isdir = 0;
+  80235b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802362:	00 00 00 
+    stat->st_dev = dev;
+  802365:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80236c:	48 89 de             	mov    %rbx,%rsi
+  80236f:	4c 89 e7             	mov    %r12,%rdi
+  802372:	ff 50 28             	call   *0x28(%rax)
+}
+  802375:	48 83 c4 10          	add    $0x10,%rsp
+  802379:	5b                   	pop    %rbx
+  80237a:	41 5c                	pop    %r12
+  80237c:	5d                   	pop    %rbp
+  80237d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80237e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802383:	eb f0                	jmp    802375 <fstat+0x70>
+
+0000000000802385 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802385:	55                   	push   %rbp
+  802386:	48 89 e5             	mov    %rsp,%rbp
+  802389:	41 54                	push   %r12
+  80238b:	53                   	push   %rbx
+  80238c:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802393:	41 89 fc             	mov    %edi,%r12d
+  802396:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802398:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80239c:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  8023a3:	00 00 00 
+  8023a6:	ff d0                	call   *%rax
+  8023a8:	85 c0                	test   %eax,%eax
+  8023aa:	78 31                	js     8023dd <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8023ac:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8023b3:	44 89 e7             	mov    %r12d,%edi
+  8023b6:	48 b8 05 23 80 00 00 	movabs $0x802305,%rax
+  8023bd:	00 00 00 
+  8023c0:	ff d0                	call   *%rax
+  8023c2:	85 c0                	test   %eax,%eax
+  8023c4:	78 17                	js     8023dd <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8023c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023ca:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8023cd:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8023d0:	39 d3                	cmp    %edx,%ebx
+  8023d2:	0f 4f da             	cmovg  %edx,%ebx
+  8023d5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023dd:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8023e4:	5b                   	pop    %rbx
+  8023e5:	41 5c                	pop    %r12
+  8023e7:	5d                   	pop    %rbp
+  8023e8:	c3                   	ret
+
+00000000008023e9 <seektoend>:
+{
+  8023e9:	55                   	push   %rbp
+  8023ea:	48 89 e5             	mov    %rsp,%rbp
+  8023ed:	53                   	push   %rbx
+  8023ee:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8023f5:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8023f7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023fb:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  802402:	00 00 00 
+  802405:	ff d0                	call   *%rax
+  802407:	85 c0                	test   %eax,%eax
+  802409:	78 28                	js     802433 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80240b:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802412:	89 df                	mov    %ebx,%edi
+  802414:	48 b8 05 23 80 00 00 	movabs $0x802305,%rax
+  80241b:	00 00 00 
+  80241e:	ff d0                	call   *%rax
+  802420:	85 c0                	test   %eax,%eax
+  802422:	78 0f                	js     802433 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802424:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802427:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80242b:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  80242e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802433:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802437:	c9                   	leave
+  802438:	c3                   	ret
+
+0000000000802439 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802439:	55                   	push   %rbp
+  80243a:	48 89 e5             	mov    %rsp,%rbp
+  80243d:	41 54                	push   %r12
+  80243f:	53                   	push   %rbx
+  802440:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802443:	be 00 00 00 00       	mov    $0x0,%esi
+  802448:	48 b8 2c 30 80 00 00 	movabs $0x80302c,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+  802454:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802456:	85 c0                	test   %eax,%eax
+  802458:	78 25                	js     80247f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80245a:	4c 89 e6             	mov    %r12,%rsi
+  80245d:	89 c7                	mov    %eax,%edi
+  80245f:	48 b8 05 23 80 00 00 	movabs $0x802305,%rax
+  802466:	00 00 00 
+  802469:	ff d0                	call   *%rax
+  80246b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80246e:	89 df                	mov    %ebx,%edi
+  802470:	48 b8 a5 1e 80 00 00 	movabs $0x801ea5,%rax
+  802477:	00 00 00 
+  80247a:	ff d0                	call   *%rax
+
+    return res;
+  80247c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80247f:	89 d8                	mov    %ebx,%eax
+  802481:	5b                   	pop    %rbx
+  802482:	41 5c                	pop    %r12
+  802484:	5d                   	pop    %rbp
+  802485:	c3                   	ret
+
+0000000000802486 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802486:	55                   	push   %rbp
+  802487:	48 89 e5             	mov    %rsp,%rbp
+  80248a:	53                   	push   %rbx
+  80248b:	48 83 ec 08          	sub    $0x8,%rsp
+  80248f:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802492:	48 b8 b2 1c 80 00 00 	movabs $0x801cb2,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+  80249e:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8024a2:	0f 87 ea 00 00 00    	ja     802592 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8024a8:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024af:	00 00 00 
+  8024b2:	80 38 00             	cmpb   $0x0,(%rax)
+  8024b5:	75 35                	jne    8024ec <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8024b7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8024bc:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8024c1:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8024c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024cb:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  8024d2:	00 00 00 
+  8024d5:	ff d0                	call   *%rax
+  8024d7:	85 c0                	test   %eax,%eax
+  8024d9:	0f 88 ba 00 00 00    	js     802599 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8024df:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8024e6:	00 00 00 
+  8024e9:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8024ec:	48 89 df             	mov    %rbx,%rdi
+  8024ef:	48 b8 b2 1c 80 00 00 	movabs $0x801cb2,%rax
+  8024f6:	00 00 00 
+  8024f9:	ff d0                	call   *%rax
+  8024fb:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8024ff:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802506:	00 00 00 
+  802509:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80250d:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802510:	39 39                	cmp    %edi,(%rcx)
+  802512:	74 46                	je     80255a <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802514:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802518:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  80251f:	00 
+  802520:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802527:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  80252e:	00 
+  80252f:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802536:	00 
+  802537:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  80253e:	00 
+  80253f:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802546:	00 
+  802547:	89 39                	mov    %edi,(%rcx)
+  802549:	48 01 c6             	add    %rax,%rsi
+  80254c:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802551:	48 89 c8             	mov    %rcx,%rax
+  802554:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802558:	c9                   	leave
+  802559:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80255a:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80255e:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802565:	00 00 00 
+  802568:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80256b:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80256f:	74 e0                	je     802551 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802571:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802578:	00 
+  802579:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80257d:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802584:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802586:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802589:	48 01 c2             	add    %rax,%rdx
+  80258c:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802590:	eb bf                	jmp    802551 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802592:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802597:	eb b8                	jmp    802551 <fbuf_get+0xcb>
+            return NULL;
+  802599:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80259e:	eb b1                	jmp    802551 <fbuf_get+0xcb>
+
+00000000008025a0 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8025a0:	55                   	push   %rbp
+  8025a1:	48 89 e5             	mov    %rsp,%rbp
+  8025a4:	53                   	push   %rbx
+  8025a5:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8025a9:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025b0:	00 00 00 
+  8025b3:	48 8b 18             	mov    (%rax),%rbx
+  8025b6:	48 85 db             	test   %rbx,%rbx
+  8025b9:	74 16                	je     8025d1 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8025bb:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8025c2:	00 00 00 
+  8025c5:	48 8b 18             	mov    (%rax),%rbx
+}
+  8025c8:	48 89 d8             	mov    %rbx,%rax
+  8025cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025cf:	c9                   	leave
+  8025d0:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8025d1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8025d6:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8025db:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8025e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025e5:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  8025ec:	00 00 00 
+  8025ef:	ff d0                	call   *%rax
+  8025f1:	85 c0                	test   %eax,%eax
+  8025f3:	78 d3                	js     8025c8 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8025f5:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8025fa:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802601:	00 00 00 
+  802604:	eb b5                	jmp    8025bb <fsipc_bulk+0x1b>
+
+0000000000802606 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802606:	55                   	push   %rbp
+  802607:	48 89 e5             	mov    %rsp,%rbp
+  80260a:	41 57                	push   %r15
+  80260c:	41 56                	push   %r14
+  80260e:	41 55                	push   %r13
+  802610:	41 54                	push   %r12
+  802612:	53                   	push   %rbx
+  802613:	48 83 ec 08          	sub    $0x8,%rsp
+  802617:	41 89 fd             	mov    %edi,%r13d
+  80261a:	49 89 f6             	mov    %rsi,%r14
+  80261d:	49 89 d7             	mov    %rdx,%r15
+  802620:	48 89 cb             	mov    %rcx,%rbx
+  802623:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802626:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80262d:	00 00 00 
+  802630:	83 38 00             	cmpl   $0x0,(%rax)
+  802633:	74 52                	je     802687 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802635:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80263b:	4c 89 f9             	mov    %r15,%rcx
+  80263e:	4c 89 f2             	mov    %r14,%rdx
+  802641:	44 89 ee             	mov    %r13d,%esi
+  802644:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80264b:	00 00 00 
+  80264e:	8b 38                	mov    (%rax),%edi
+  802650:	48 b8 8e 41 80 00 00 	movabs $0x80418e,%rax
+  802657:	00 00 00 
+  80265a:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80265c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802661:	4c 89 e2             	mov    %r12,%rdx
+  802664:	48 89 de             	mov    %rbx,%rsi
+  802667:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266c:	48 b8 de 3f 80 00 00 	movabs $0x803fde,%rax
+  802673:	00 00 00 
+  802676:	ff d0                	call   *%rax
+}
+  802678:	48 83 c4 08          	add    $0x8,%rsp
+  80267c:	5b                   	pop    %rbx
+  80267d:	41 5c                	pop    %r12
+  80267f:	41 5d                	pop    %r13
+  802681:	41 5e                	pop    %r14
+  802683:	41 5f                	pop    %r15
+  802685:	5d                   	pop    %rbp
+  802686:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802687:	bf 03 00 00 00       	mov    $0x3,%edi
+  80268c:	48 b8 31 42 80 00 00 	movabs $0x804231,%rax
+  802693:	00 00 00 
+  802696:	ff d0                	call   *%rax
+  802698:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80269f:	00 00 
+  8026a1:	eb 92                	jmp    802635 <fsipc_region+0x2f>
+
+00000000008026a3 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8026a3:	55                   	push   %rbp
+  8026a4:	48 89 e5             	mov    %rsp,%rbp
+  8026a7:	41 57                	push   %r15
+  8026a9:	41 56                	push   %r14
+  8026ab:	41 55                	push   %r13
+  8026ad:	41 54                	push   %r12
+  8026af:	53                   	push   %rbx
+  8026b0:	48 83 ec 28          	sub    $0x28,%rsp
+  8026b4:	49 89 ff             	mov    %rdi,%r15
+  8026b7:	49 89 f6             	mov    %rsi,%r14
+  8026ba:	48 89 d3             	mov    %rdx,%rbx
+  8026bd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026c1:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8026c4:	48 b8 a0 25 80 00 00 	movabs $0x8025a0,%rax
+  8026cb:	00 00 00 
+  8026ce:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8026d0:	48 85 c0             	test   %rax,%rax
+  8026d3:	0f 84 cc 00 00 00    	je     8027a5 <devfile_write_direct+0x102>
+  8026d9:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8026dc:	48 85 db             	test   %rbx,%rbx
+  8026df:	0f 84 ba 00 00 00    	je     80279f <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8026e5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8026eb:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8026f2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8026f6:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8026fa:	4c 29 e3             	sub    %r12,%rbx
+  8026fd:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802702:	48 39 c3             	cmp    %rax,%rbx
+  802705:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802709:	48 89 da             	mov    %rbx,%rdx
+  80270c:	4c 89 f6             	mov    %r14,%rsi
+  80270f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802713:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  80271a:	00 00 00 
+  80271d:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  80271f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802723:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802727:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80272a:	44 01 e0             	add    %r12d,%eax
+  80272d:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802731:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802735:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80273c:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802743:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80274a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802750:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802755:	4c 89 ee             	mov    %r13,%rsi
+  802758:	bf 04 00 00 00       	mov    $0x4,%edi
+  80275d:	48 b8 06 26 80 00 00 	movabs $0x802606,%rax
+  802764:	00 00 00 
+  802767:	ff d0                	call   *%rax
+        if (res < 0)
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	78 29                	js     802796 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80276d:	74 2b                	je     80279a <devfile_write_direct+0xf7>
+        i += res;
+  80276f:	48 98                	cltq
+  802771:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802774:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802777:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80277b:	49 39 c4             	cmp    %rax,%r12
+  80277e:	0f 82 72 ff ff ff    	jb     8026f6 <devfile_write_direct+0x53>
+    return i;
+  802784:	4c 89 e0             	mov    %r12,%rax
+}
+  802787:	48 83 c4 28          	add    $0x28,%rsp
+  80278b:	5b                   	pop    %rbx
+  80278c:	41 5c                	pop    %r12
+  80278e:	41 5d                	pop    %r13
+  802790:	41 5e                	pop    %r14
+  802792:	41 5f                	pop    %r15
+  802794:	5d                   	pop    %rbp
+  802795:	c3                   	ret
+            return res;
+  802796:	48 98                	cltq
+  802798:	eb ed                	jmp    802787 <devfile_write_direct+0xe4>
+            return i;
+  80279a:	4c 89 e0             	mov    %r12,%rax
+  80279d:	eb e8                	jmp    802787 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80279f:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8027a3:	eb df                	jmp    802784 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8027a5:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8027ac:	eb d9                	jmp    802787 <devfile_write_direct+0xe4>
+
+00000000008027ae <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8027ae:	55                   	push   %rbp
+  8027af:	48 89 e5             	mov    %rsp,%rbp
+  8027b2:	41 56                	push   %r14
+  8027b4:	41 55                	push   %r13
+  8027b6:	41 54                	push   %r12
+  8027b8:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8027b9:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8027bd:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8027c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c6:	4d 39 ee             	cmp    %r13,%r14
+  8027c9:	0f 84 99 00 00 00    	je     802868 <fbuf_flush+0xba>
+  8027cf:	49 89 fc             	mov    %rdi,%r12
+  8027d2:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8027d5:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8027d8:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8027dc:	48 b8 b2 1c 80 00 00 	movabs $0x801cb2,%rax
+  8027e3:	00 00 00 
+  8027e6:	ff d0                	call   *%rax
+  8027e8:	48 89 c2             	mov    %rax,%rdx
+  8027eb:	48 c1 e2 04          	shl    $0x4,%rdx
+  8027ef:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8027f3:	48 c1 e0 0c          	shl    $0xc,%rax
+  8027f7:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8027fc:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8027ff:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802803:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80280a:	00 
+  80280b:	44 89 f1             	mov    %r14d,%ecx
+  80280e:	4c 89 ea             	mov    %r13,%rdx
+  802811:	4c 89 e7             	mov    %r12,%rdi
+  802814:	48 b8 a3 26 80 00 00 	movabs $0x8026a3,%rax
+  80281b:	00 00 00 
+  80281e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802820:	48 85 c0             	test   %rax,%rax
+  802823:	78 43                	js     802868 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802825:	4c 39 e8             	cmp    %r13,%rax
+  802828:	72 47                	jb     802871 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80282a:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80282f:	83 c0 01             	add    $0x1,%eax
+  802832:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802837:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80283a:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80283e:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802842:	72 0f                	jb     802853 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802844:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802848:	48 39 c2             	cmp    %rax,%rdx
+  80284b:	48 0f 42 d0          	cmovb  %rax,%rdx
+  80284f:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802853:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80285a:	00 
+  80285b:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802862:	00 
+    return 0;
+  802863:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802868:	5b                   	pop    %rbx
+  802869:	41 5c                	pop    %r12
+  80286b:	41 5d                	pop    %r13
+  80286d:	41 5e                	pop    %r14
+  80286f:	5d                   	pop    %rbp
+  802870:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802871:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802876:	eb f0                	jmp    802868 <fbuf_flush+0xba>
+
+0000000000802878 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802878:	55                   	push   %rbp
+  802879:	48 89 e5             	mov    %rsp,%rbp
+  80287c:	53                   	push   %rbx
+  80287d:	48 83 ec 08          	sub    $0x8,%rsp
+  802881:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802884:	48 b8 86 24 80 00 00 	movabs $0x802486,%rax
+  80288b:	00 00 00 
+  80288e:	ff d0                	call   *%rax
+  802890:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802893:	b8 00 00 00 00       	mov    $0x0,%eax
+  802898:	48 85 f6             	test   %rsi,%rsi
+  80289b:	74 0f                	je     8028ac <devfile_sync+0x34>
+  80289d:	48 89 df             	mov    %rbx,%rdi
+  8028a0:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  8028a7:	00 00 00 
+  8028aa:	ff d0                	call   *%rax
+}
+  8028ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b0:	c9                   	leave
+  8028b1:	c3                   	ret
+
+00000000008028b2 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8028b2:	55                   	push   %rbp
+  8028b3:	48 89 e5             	mov    %rsp,%rbp
+  8028b6:	48 83 ec 10          	sub    $0x10,%rsp
+  8028ba:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8028bd:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8028c4:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8028c5:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8028c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028ce:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8028d5:	00 00 00 
+  8028d8:	48 b8 06 26 80 00 00 	movabs $0x802606,%rax
+  8028df:	00 00 00 
+  8028e2:	ff d0                	call   *%rax
+}
+  8028e4:	c9                   	leave
+  8028e5:	c3                   	ret
+
+00000000008028e6 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8028e6:	55                   	push   %rbp
+  8028e7:	48 89 e5             	mov    %rsp,%rbp
+  8028ea:	41 54                	push   %r12
+  8028ec:	53                   	push   %rbx
+  8028ed:	48 89 fb             	mov    %rdi,%rbx
+  8028f0:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8028f3:	48 b8 78 28 80 00 00 	movabs $0x802878,%rax
+  8028fa:	00 00 00 
+  8028fd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028ff:	85 c0                	test   %eax,%eax
+  802901:	78 63                	js     802966 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802903:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802906:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80290d:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  80290f:	be 00 00 00 00       	mov    $0x0,%esi
+  802914:	bf 05 00 00 00       	mov    $0x5,%edi
+  802919:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  802920:	00 00 00 
+  802923:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802925:	85 c0                	test   %eax,%eax
+  802927:	78 3d                	js     802966 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802929:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802930:	00 00 00 
+  802933:	48 89 de             	mov    %rbx,%rsi
+  802936:	4c 89 e7             	mov    %r12,%rdi
+  802939:	48 b8 3c 0b 80 00 00 	movabs $0x800b3c,%rax
+  802940:	00 00 00 
+  802943:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802945:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  80294b:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802952:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802953:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802959:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802960:	00 
+
+    return 0;
+  802961:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802966:	5b                   	pop    %rbx
+  802967:	41 5c                	pop    %r12
+  802969:	5d                   	pop    %rbp
+  80296a:	c3                   	ret
+
+000000000080296b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80296b:	55                   	push   %rbp
+  80296c:	48 89 e5             	mov    %rsp,%rbp
+  80296f:	41 54                	push   %r12
+  802971:	53                   	push   %rbx
+  802972:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802975:	48 b8 78 28 80 00 00 	movabs $0x802878,%rax
+  80297c:	00 00 00 
+  80297f:	ff d0                	call   *%rax
+  802981:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802984:	48 89 df             	mov    %rbx,%rdi
+  802987:	48 b8 b2 1c 80 00 00 	movabs $0x801cb2,%rax
+  80298e:	00 00 00 
+  802991:	ff d0                	call   *%rax
+  802993:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802997:	76 2e                	jbe    8029c7 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802999:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80299c:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8029a3:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8029a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8029aa:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029af:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  8029b6:	00 00 00 
+  8029b9:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8029bb:	45 85 e4             	test   %r12d,%r12d
+  8029be:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8029c2:	5b                   	pop    %rbx
+  8029c3:	41 5c                	pop    %r12
+  8029c5:	5d                   	pop    %rbp
+  8029c6:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8029c7:	48 89 df             	mov    %rbx,%rdi
+  8029ca:	48 b8 b2 1c 80 00 00 	movabs $0x801cb2,%rax
+  8029d1:	00 00 00 
+  8029d4:	ff d0                	call   *%rax
+  8029d6:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8029da:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8029e1:	00 00 00 
+  8029e4:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8029eb:	48 89 df             	mov    %rbx,%rdi
+  8029ee:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  8029f5:	00 00 00 
+  8029f8:	ff d0                	call   *%rax
+  8029fa:	48 89 c6             	mov    %rax,%rsi
+  8029fd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a02:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a07:	48 b8 7b 14 80 00 00 	movabs $0x80147b,%rax
+  802a0e:	00 00 00 
+  802a11:	ff d0                	call   *%rax
+  802a13:	eb 84                	jmp    802999 <devfile_flush+0x2e>
+
+0000000000802a15 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802a15:	55                   	push   %rbp
+  802a16:	48 89 e5             	mov    %rsp,%rbp
+  802a19:	41 55                	push   %r13
+  802a1b:	41 54                	push   %r12
+  802a1d:	53                   	push   %rbx
+  802a1e:	48 83 ec 08          	sub    $0x8,%rsp
+  802a22:	48 89 fb             	mov    %rdi,%rbx
+  802a25:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802a28:	48 b8 86 24 80 00 00 	movabs $0x802486,%rax
+  802a2f:	00 00 00 
+  802a32:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802a34:	48 85 c0             	test   %rax,%rax
+  802a37:	74 51                	je     802a8a <devfile_trunc+0x75>
+  802a39:	49 89 c4             	mov    %rax,%r12
+  802a3c:	48 89 c6             	mov    %rax,%rsi
+  802a3f:	48 89 df             	mov    %rbx,%rdi
+  802a42:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  802a49:	00 00 00 
+  802a4c:	ff d0                	call   *%rax
+  802a4e:	85 c0                	test   %eax,%eax
+  802a50:	78 2d                	js     802a7f <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a52:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802a59:	00 00 00 
+  802a5c:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802a5f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802a61:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802a65:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6a:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a6f:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  802a76:	00 00 00 
+  802a79:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802a7b:	85 c0                	test   %eax,%eax
+  802a7d:	79 3e                	jns    802abd <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802a7f:	48 83 c4 08          	add    $0x8,%rsp
+  802a83:	5b                   	pop    %rbx
+  802a84:	41 5c                	pop    %r12
+  802a86:	41 5d                	pop    %r13
+  802a88:	5d                   	pop    %rbp
+  802a89:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802a8a:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802a91:	00 00 00 
+  802a94:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802a97:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802a99:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802a9d:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa2:	bf 02 00 00 00       	mov    $0x2,%edi
+  802aa7:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  802aae:	00 00 00 
+  802ab1:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ab3:	85 c0                	test   %eax,%eax
+  802ab5:	78 c8                	js     802a7f <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ab7:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802abb:	eb c2                	jmp    802a7f <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802abd:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802ac0:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ac3:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ac6:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802acb:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802ad2:	00 00 
+  802ad4:	eb a9                	jmp    802a7f <devfile_trunc+0x6a>
+
+0000000000802ad6 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802ad6:	55                   	push   %rbp
+  802ad7:	48 89 e5             	mov    %rsp,%rbp
+  802ada:	41 57                	push   %r15
+  802adc:	41 56                	push   %r14
+  802ade:	41 55                	push   %r13
+  802ae0:	41 54                	push   %r12
+  802ae2:	53                   	push   %rbx
+  802ae3:	48 83 ec 28          	sub    $0x28,%rsp
+  802ae7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802aeb:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802aef:	49 89 d7             	mov    %rdx,%r15
+  802af2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802af6:	48 b8 86 24 80 00 00 	movabs $0x802486,%rax
+  802afd:	00 00 00 
+  802b00:	ff d0                	call   *%rax
+  802b02:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802b05:	48 85 c0             	test   %rax,%rax
+  802b08:	74 31                	je     802b3b <devfile_write+0x65>
+  802b0a:	4c 89 f8             	mov    %r15,%rax
+  802b0d:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802b14:	77 25                	ja     802b3b <devfile_write+0x65>
+    size_t i = 0;
+  802b16:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802b1c:	48 85 c0             	test   %rax,%rax
+  802b1f:	0f 85 64 01 00 00    	jne    802c89 <devfile_write+0x1b3>
+    size_t i = 0;
+  802b25:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802b29:	4c 89 f8             	mov    %r15,%rax
+}
+  802b2c:	48 83 c4 28          	add    $0x28,%rsp
+  802b30:	5b                   	pop    %rbx
+  802b31:	41 5c                	pop    %r12
+  802b33:	41 5d                	pop    %r13
+  802b35:	41 5e                	pop    %r14
+  802b37:	41 5f                	pop    %r15
+  802b39:	5d                   	pop    %rbp
+  802b3a:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802b3b:	48 85 db             	test   %rbx,%rbx
+  802b3e:	74 5b                	je     802b9b <devfile_write+0xc5>
+  802b40:	48 89 de             	mov    %rbx,%rsi
+  802b43:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b47:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  802b4e:	00 00 00 
+  802b51:	ff d0                	call   *%rax
+  802b53:	85 c0                	test   %eax,%eax
+  802b55:	78 40                	js     802b97 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802b57:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802b5b:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802b5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b62:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802b66:	48 b8 a3 26 80 00 00 	movabs $0x8026a3,%rax
+  802b6d:	00 00 00 
+  802b70:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802b72:	48 85 c0             	test   %rax,%rax
+  802b75:	7e b5                	jle    802b2c <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802b77:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802b7b:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802b7e:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802b81:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802b84:	8d 51 01             	lea    0x1(%rcx),%edx
+  802b87:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802b8a:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802b8d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802b94:	00 
+  802b95:	eb 95                	jmp    802b2c <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802b97:	48 98                	cltq
+  802b99:	eb 91                	jmp    802b2c <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802b9b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802b9f:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802ba2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ba6:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802baa:	48 89 df             	mov    %rbx,%rdi
+  802bad:	48 b8 a3 26 80 00 00 	movabs $0x8026a3,%rax
+  802bb4:	00 00 00 
+  802bb7:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802bb9:	48 85 c0             	test   %rax,%rax
+  802bbc:	0f 8e 6a ff ff ff    	jle    802b2c <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802bc2:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802bc5:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802bc9:	e9 5e ff ff ff       	jmp    802b2c <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802bce:	48 98                	cltq
+  802bd0:	4d 85 ff             	test   %r15,%r15
+  802bd3:	49 0f 45 c7          	cmovne %r15,%rax
+  802bd7:	e9 50 ff ff ff       	jmp    802b2c <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802bdc:	48 89 de             	mov    %rbx,%rsi
+  802bdf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802be3:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  802bea:	00 00 00 
+  802bed:	ff d0                	call   *%rax
+  802bef:	85 c0                	test   %eax,%eax
+  802bf1:	0f 88 2b 01 00 00    	js     802d22 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802bf7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802bfb:	4c 01 f8             	add    %r15,%rax
+  802bfe:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c02:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c06:	48 b9 b2 1c 80 00 00 	movabs $0x801cb2,%rcx
+  802c0d:	00 00 00 
+  802c10:	ff d1                	call   *%rcx
+  802c12:	48 89 c2             	mov    %rax,%rdx
+  802c15:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c19:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c1d:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c21:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802c26:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802c29:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802c30:	00 
+  802c31:	4c 89 ea             	mov    %r13,%rdx
+  802c34:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802c38:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  802c3f:	00 00 00 
+  802c42:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802c44:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c48:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802c4c:	48 39 c2             	cmp    %rax,%rdx
+  802c4f:	0f 84 db 00 00 00    	je     802d30 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802c55:	4c 39 e2             	cmp    %r12,%rdx
+  802c58:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802c5c:	4d 01 ec             	add    %r13,%r12
+  802c5f:	49 39 c4             	cmp    %rax,%r12
+  802c62:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802c66:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802c6a:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802c6e:	45 01 ee             	add    %r13d,%r14d
+  802c71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c75:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802c79:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802c7c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c80:	49 39 c7             	cmp    %rax,%r15
+  802c83:	0f 83 a0 fe ff ff    	jae    802b29 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802c89:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c8d:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802c91:	8b 43 08             	mov    0x8(%rbx),%eax
+  802c94:	44 39 f0             	cmp    %r14d,%eax
+  802c97:	7f 10                	jg     802ca9 <devfile_write+0x1d3>
+  802c99:	48 98                	cltq
+  802c9b:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802ca1:	49 63 d6             	movslq %r14d,%rdx
+  802ca4:	48 39 d0             	cmp    %rdx,%rax
+  802ca7:	7d 2d                	jge    802cd6 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802ca9:	48 89 de             	mov    %rbx,%rsi
+  802cac:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802cb0:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  802cb7:	00 00 00 
+  802cba:	ff d0                	call   *%rax
+  802cbc:	85 c0                	test   %eax,%eax
+  802cbe:	0f 88 0a ff ff ff    	js     802bce <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802cc4:	44 89 f0             	mov    %r14d,%eax
+  802cc7:	66 b8 00 00          	mov    $0x0,%ax
+  802ccb:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802cce:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802cd5:	00 
+        size_t off = pos - fb->fb_base;
+  802cd6:	45 89 f4             	mov    %r14d,%r12d
+  802cd9:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802cdd:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802ce0:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802ce4:	4d 29 fd             	sub    %r15,%r13
+  802ce7:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802cec:	4c 29 e0             	sub    %r12,%rax
+  802cef:	49 39 c5             	cmp    %rax,%r13
+  802cf2:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802cf6:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802cfa:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802cfe:	48 39 c2             	cmp    %rax,%rdx
+  802d01:	0f 84 f0 fe ff ff    	je     802bf7 <devfile_write+0x121>
+  802d07:	4c 39 e0             	cmp    %r12,%rax
+  802d0a:	0f 82 cc fe ff ff    	jb     802bdc <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802d10:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d14:	48 39 d0             	cmp    %rdx,%rax
+  802d17:	0f 83 da fe ff ff    	jae    802bf7 <devfile_write+0x121>
+  802d1d:	e9 ba fe ff ff       	jmp    802bdc <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d22:	48 98                	cltq
+  802d24:	4d 85 ff             	test   %r15,%r15
+  802d27:	49 0f 45 c7          	cmovne %r15,%rax
+  802d2b:	e9 fc fd ff ff       	jmp    802b2c <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802d30:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802d34:	4c 89 e2             	mov    %r12,%rdx
+  802d37:	e9 2a ff ff ff       	jmp    802c66 <devfile_write+0x190>
+
+0000000000802d3c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d3c:	55                   	push   %rbp
+  802d3d:	48 89 e5             	mov    %rsp,%rbp
+  802d40:	41 57                	push   %r15
+  802d42:	41 56                	push   %r14
+  802d44:	41 55                	push   %r13
+  802d46:	41 54                	push   %r12
+  802d48:	53                   	push   %rbx
+  802d49:	48 83 ec 28          	sub    $0x28,%rsp
+  802d4d:	49 89 ff             	mov    %rdi,%r15
+  802d50:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d54:	48 89 d3             	mov    %rdx,%rbx
+  802d57:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802d5b:	48 b8 86 24 80 00 00 	movabs $0x802486,%rax
+  802d62:	00 00 00 
+  802d65:	ff d0                	call   *%rax
+  802d67:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802d6a:	48 85 c0             	test   %rax,%rax
+  802d6d:	74 0d                	je     802d7c <devfile_read+0x40>
+  802d6f:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802d76:	0f 86 1a 01 00 00    	jbe    802e96 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d7c:	4d 85 e4             	test   %r12,%r12
+  802d7f:	74 1a                	je     802d9b <devfile_read+0x5f>
+  802d81:	4c 89 e6             	mov    %r12,%rsi
+  802d84:	4c 89 ff             	mov    %r15,%rdi
+  802d87:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  802d8e:	00 00 00 
+  802d91:	ff d0                	call   *%rax
+  802d93:	85 c0                	test   %eax,%eax
+  802d95:	0f 88 e8 00 00 00    	js     802e83 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802d9b:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802d9f:	48 b8 a0 25 80 00 00 	movabs $0x8025a0,%rax
+  802da6:	00 00 00 
+  802da9:	ff d0                	call   *%rax
+  802dab:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802dae:	48 85 c0             	test   %rax,%rax
+  802db1:	0f 84 69 02 00 00    	je     803020 <devfile_read+0x2e4>
+    while (i < n) {
+  802db7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802dbc:	0f 84 ce 00 00 00    	je     802e90 <devfile_read+0x154>
+    size_t i = 0;
+  802dc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802dc7:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802dce:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802dd2:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802dd6:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802dda:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802dde:	48 29 da             	sub    %rbx,%rdx
+  802de1:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802de6:	48 39 c2             	cmp    %rax,%rdx
+  802de9:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802ded:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802df1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802df5:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802df8:	01 d8                	add    %ebx,%eax
+  802dfa:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802dfe:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802e02:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802e09:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e10:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802e17:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e22:	4c 89 ee             	mov    %r13,%rsi
+  802e25:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e2a:	48 b8 06 26 80 00 00 	movabs $0x802606,%rax
+  802e31:	00 00 00 
+  802e34:	ff d0                	call   *%rax
+        if (res < 0)
+  802e36:	85 c0                	test   %eax,%eax
+  802e38:	78 4d                	js     802e87 <devfile_read+0x14b>
+        if (res == 0)
+  802e3a:	74 4f                	je     802e8b <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802e3c:	4c 63 e0             	movslq %eax,%r12
+  802e3f:	4c 89 e2             	mov    %r12,%rdx
+  802e42:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802e46:	4c 89 f7             	mov    %r14,%rdi
+  802e49:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  802e50:	00 00 00 
+  802e53:	ff d0                	call   *%rax
+        i += res;
+  802e55:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  802e58:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  802e5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e5f:	48 39 c3             	cmp    %rax,%rbx
+  802e62:	0f 82 72 ff ff ff    	jb     802dda <devfile_read+0x9e>
+    return i;
+  802e68:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802e6b:	48 85 c0             	test   %rax,%rax
+  802e6e:	7e 04                	jle    802e74 <devfile_read+0x138>
+  802e70:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  802e74:	48 83 c4 28          	add    $0x28,%rsp
+  802e78:	5b                   	pop    %rbx
+  802e79:	41 5c                	pop    %r12
+  802e7b:	41 5d                	pop    %r13
+  802e7d:	41 5e                	pop    %r14
+  802e7f:	41 5f                	pop    %r15
+  802e81:	5d                   	pop    %rbp
+  802e82:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e83:	48 98                	cltq
+  802e85:	eb ed                	jmp    802e74 <devfile_read+0x138>
+            return res;
+  802e87:	48 98                	cltq
+  802e89:	eb e9                	jmp    802e74 <devfile_read+0x138>
+            return i;
+  802e8b:	48 89 d8             	mov    %rbx,%rax
+  802e8e:	eb db                	jmp    802e6b <devfile_read+0x12f>
+    size_t i = 0;
+  802e90:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802e94:	eb d2                	jmp    802e68 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802e96:	48 89 c6             	mov    %rax,%rsi
+  802e99:	4c 89 ff             	mov    %r15,%rdi
+  802e9c:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  802ea3:	00 00 00 
+  802ea6:	ff d0                	call   *%rax
+  802ea8:	85 c0                	test   %eax,%eax
+  802eaa:	78 40                	js     802eec <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802eac:	4c 89 ff             	mov    %r15,%rdi
+  802eaf:	48 b8 b2 1c 80 00 00 	movabs $0x801cb2,%rax
+  802eb6:	00 00 00 
+  802eb9:	ff d0                	call   *%rax
+  802ebb:	48 89 c2             	mov    %rax,%rdx
+  802ebe:	48 c1 e2 04          	shl    $0x4,%rdx
+  802ec2:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802ec6:	48 c1 e0 0c          	shl    $0xc,%rax
+  802eca:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802ecf:	48 01 d0             	add    %rdx,%rax
+  802ed2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  802ed6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802edb:	0f 84 33 01 00 00    	je     803014 <devfile_read+0x2d8>
+    size_t i = 0;
+  802ee1:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802ee7:	e9 f5 00 00 00       	jmp    802fe1 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802eec:	48 98                	cltq
+  802eee:	eb 84                	jmp    802e74 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802ef0:	44 89 e8             	mov    %r13d,%eax
+  802ef3:	66 b8 00 00          	mov    $0x0,%ax
+  802ef7:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  802efc:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f03:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  802f05:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f09:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f0d:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  802f0f:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802f14:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  802f17:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  802f1e:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  802f1f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f2a:	ba 00 10 01 00       	mov    $0x11000,%edx
+  802f2f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f34:	48 b8 06 26 80 00 00 	movabs $0x802606,%rax
+  802f3b:	00 00 00 
+  802f3e:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  802f40:	85 c0                	test   %eax,%eax
+  802f42:	0f 88 be 00 00 00    	js     803006 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  802f48:	48 63 d0             	movslq %eax,%rdx
+  802f4b:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  802f50:	41 03 44 24 08       	add    0x8(%r12),%eax
+  802f55:	44 39 e8             	cmp    %r13d,%eax
+  802f58:	0f 8e ba 00 00 00    	jle    803018 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  802f5e:	49 63 c5             	movslq %r13d,%rax
+  802f61:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802f66:	48 29 c3             	sub    %rax,%rbx
+  802f69:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  802f6e:	48 01 c3             	add    %rax,%rbx
+  802f71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f75:	4c 29 f0             	sub    %r14,%rax
+  802f78:	48 39 c3             	cmp    %rax,%rbx
+  802f7b:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802f7f:	4c 89 ff             	mov    %r15,%rdi
+  802f82:	48 b9 b2 1c 80 00 00 	movabs $0x801cb2,%rcx
+  802f89:	00 00 00 
+  802f8c:	ff d1                	call   *%rcx
+  802f8e:	48 89 c2             	mov    %rax,%rdx
+  802f91:	48 c1 e2 04          	shl    $0x4,%rdx
+  802f95:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802f99:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f9d:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  802fa2:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  802fa5:	44 89 ea             	mov    %r13d,%edx
+  802fa8:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  802fad:	48 63 d2             	movslq %edx,%rdx
+  802fb0:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802fb7:	00 
+  802fb8:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802fbc:	4c 01 f7             	add    %r14,%rdi
+  802fbf:	48 89 da             	mov    %rbx,%rdx
+  802fc2:	48 b9 31 0f 80 00 00 	movabs $0x800f31,%rcx
+  802fc9:	00 00 00 
+  802fcc:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  802fce:	41 01 dd             	add    %ebx,%r13d
+  802fd1:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  802fd5:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  802fd8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fdc:	49 39 c6             	cmp    %rax,%r14
+  802fdf:	73 37                	jae    803018 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  802fe1:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  802fe5:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802fea:	44 39 e8             	cmp    %r13d,%eax
+  802fed:	0f 8f fd fe ff ff    	jg     802ef0 <devfile_read+0x1b4>
+  802ff3:	41 03 44 24 10       	add    0x10(%r12),%eax
+  802ff8:	44 39 e8             	cmp    %r13d,%eax
+  802ffb:	0f 8f 5d ff ff ff    	jg     802f5e <devfile_read+0x222>
+  803001:	e9 ea fe ff ff       	jmp    802ef0 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803006:	48 98                	cltq
+  803008:	4d 85 f6             	test   %r14,%r14
+  80300b:	49 0f 45 c6          	cmovne %r14,%rax
+  80300f:	e9 60 fe ff ff       	jmp    802e74 <devfile_read+0x138>
+    size_t i = 0;
+  803014:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803018:	4c 89 f0             	mov    %r14,%rax
+  80301b:	e9 54 fe ff ff       	jmp    802e74 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803020:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803027:	e9 48 fe ff ff       	jmp    802e74 <devfile_read+0x138>
+
+000000000080302c <open>:
+open(const char *path, int mode) {
+  80302c:	55                   	push   %rbp
+  80302d:	48 89 e5             	mov    %rsp,%rbp
+  803030:	41 55                	push   %r13
+  803032:	41 54                	push   %r12
+  803034:	53                   	push   %rbx
+  803035:	48 83 ec 18          	sub    $0x18,%rsp
+  803039:	49 89 fc             	mov    %rdi,%r12
+  80303c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80303f:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  803046:	00 00 00 
+  803049:	ff d0                	call   *%rax
+  80304b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803051:	0f 87 8a 00 00 00    	ja     8030e1 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803057:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80305b:	48 b8 e0 1c 80 00 00 	movabs $0x801ce0,%rax
+  803062:	00 00 00 
+  803065:	ff d0                	call   *%rax
+  803067:	89 c3                	mov    %eax,%ebx
+  803069:	85 c0                	test   %eax,%eax
+  80306b:	78 50                	js     8030bd <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80306d:	4c 89 e6             	mov    %r12,%rsi
+  803070:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803077:	00 00 00 
+  80307a:	48 89 df             	mov    %rbx,%rdi
+  80307d:	48 b8 3c 0b 80 00 00 	movabs $0x800b3c,%rax
+  803084:	00 00 00 
+  803087:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803089:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803090:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803094:	bf 01 00 00 00       	mov    $0x1,%edi
+  803099:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  8030a0:	00 00 00 
+  8030a3:	ff d0                	call   *%rax
+  8030a5:	89 c3                	mov    %eax,%ebx
+  8030a7:	85 c0                	test   %eax,%eax
+  8030a9:	78 1f                	js     8030ca <open+0x9e>
+    return fd2num(fd);
+  8030ab:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030af:	48 b8 b2 1c 80 00 00 	movabs $0x801cb2,%rax
+  8030b6:	00 00 00 
+  8030b9:	ff d0                	call   *%rax
+  8030bb:	89 c3                	mov    %eax,%ebx
+}
+  8030bd:	89 d8                	mov    %ebx,%eax
+  8030bf:	48 83 c4 18          	add    $0x18,%rsp
+  8030c3:	5b                   	pop    %rbx
+  8030c4:	41 5c                	pop    %r12
+  8030c6:	41 5d                	pop    %r13
+  8030c8:	5d                   	pop    %rbp
+  8030c9:	c3                   	ret
+        fd_close(fd, 0);
+  8030ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8030cf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030d3:	48 b8 fb 1d 80 00 00 	movabs $0x801dfb,%rax
+  8030da:	00 00 00 
+  8030dd:	ff d0                	call   *%rax
+        return res;
+  8030df:	eb dc                	jmp    8030bd <open+0x91>
+        return -E_BAD_PATH;
+  8030e1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030e6:	eb d5                	jmp    8030bd <open+0x91>
+
+00000000008030e8 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8030e8:	55                   	push   %rbp
+  8030e9:	48 89 e5             	mov    %rsp,%rbp
+  8030ec:	41 57                	push   %r15
+  8030ee:	41 56                	push   %r14
+  8030f0:	41 55                	push   %r13
+  8030f2:	41 54                	push   %r12
+  8030f4:	53                   	push   %rbx
+  8030f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8030f9:	41 89 f6             	mov    %esi,%r14d
+  8030fc:	49 89 d7             	mov    %rdx,%r15
+  8030ff:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803102:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803106:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  80310d:	00 00 00 
+  803110:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803112:	85 c0                	test   %eax,%eax
+  803114:	0f 88 db 00 00 00    	js     8031f5 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80311a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80311e:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803125:	00 00 00 
+  803128:	8b 00                	mov    (%rax),%eax
+  80312a:	39 07                	cmp    %eax,(%rdi)
+  80312c:	0f 85 db 00 00 00    	jne    80320d <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803132:	45 85 f6             	test   %r14d,%r14d
+  803135:	0f 88 db 00 00 00    	js     803216 <fmap+0x12e>
+  80313b:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803142:	0f 85 d7 00 00 00    	jne    80321f <fmap+0x137>
+  803148:	4c 89 fb             	mov    %r15,%rbx
+  80314b:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803151:	0f 85 d1 00 00 00    	jne    803228 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803157:	48 b8 78 28 80 00 00 	movabs $0x802878,%rax
+  80315e:	00 00 00 
+  803161:	ff d0                	call   *%rax
+  803163:	85 c0                	test   %eax,%eax
+  803165:	0f 88 8e 00 00 00    	js     8031f9 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80316b:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803172:	00 00 00 
+    while (i < n) {
+  803175:	4d 85 ed             	test   %r13,%r13
+  803178:	0f 84 8a 00 00 00    	je     803208 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80317e:	4c 89 ea             	mov    %r13,%rdx
+  803181:	48 29 da             	sub    %rbx,%rdx
+  803184:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80318b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803191:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803195:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803199:	8b 40 0c             	mov    0xc(%rax),%eax
+  80319c:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8031a0:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8031a4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8031a9:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8031ae:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8031b2:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8031b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031bb:	4c 89 e6             	mov    %r12,%rsi
+  8031be:	bf 09 00 00 00       	mov    $0x9,%edi
+  8031c3:	48 b8 06 26 80 00 00 	movabs $0x802606,%rax
+  8031ca:	00 00 00 
+  8031cd:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8031cf:	85 c0                	test   %eax,%eax
+  8031d1:	78 2a                	js     8031fd <fmap+0x115>
+        i += res;
+  8031d3:	48 98                	cltq
+  8031d5:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8031d8:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8031dc:	72 05                	jb     8031e3 <fmap+0xfb>
+    while (i < n) {
+  8031de:	4c 39 eb             	cmp    %r13,%rbx
+  8031e1:	72 9b                	jb     80317e <fmap+0x96>
+    }
+    return i;
+  8031e3:	48 89 d8             	mov    %rbx,%rax
+}
+  8031e6:	48 83 c4 18          	add    $0x18,%rsp
+  8031ea:	5b                   	pop    %rbx
+  8031eb:	41 5c                	pop    %r12
+  8031ed:	41 5d                	pop    %r13
+  8031ef:	41 5e                	pop    %r14
+  8031f1:	41 5f                	pop    %r15
+  8031f3:	5d                   	pop    %rbp
+  8031f4:	c3                   	ret
+    if (res < 0) return res;
+  8031f5:	48 98                	cltq
+  8031f7:	eb ed                	jmp    8031e6 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8031f9:	48 98                	cltq
+  8031fb:	eb e9                	jmp    8031e6 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8031fd:	48 98                	cltq
+  8031ff:	48 85 db             	test   %rbx,%rbx
+  803202:	48 0f 45 c3          	cmovne %rbx,%rax
+  803206:	eb de                	jmp    8031e6 <fmap+0xfe>
+    size_t i = 0;
+  803208:	4c 89 eb             	mov    %r13,%rbx
+  80320b:	eb d6                	jmp    8031e3 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80320d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803214:	eb d0                	jmp    8031e6 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803216:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80321d:	eb c7                	jmp    8031e6 <fmap+0xfe>
+  80321f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803226:	eb be                	jmp    8031e6 <fmap+0xfe>
+  803228:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80322f:	eb b5                	jmp    8031e6 <fmap+0xfe>
+
+0000000000803231 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803231:	55                   	push   %rbp
+  803232:	48 89 e5             	mov    %rsp,%rbp
+  803235:	41 56                	push   %r14
+  803237:	41 55                	push   %r13
+  803239:	41 54                	push   %r12
+  80323b:	53                   	push   %rbx
+  80323c:	48 83 ec 10          	sub    $0x10,%rsp
+  803240:	89 fb                	mov    %edi,%ebx
+  803242:	41 89 f4             	mov    %esi,%r12d
+  803245:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803248:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80324c:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  803253:	00 00 00 
+  803256:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803258:	85 c0                	test   %eax,%eax
+  80325a:	78 63                	js     8032bf <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80325c:	45 85 e4             	test   %r12d,%r12d
+  80325f:	0f 88 80 00 00 00    	js     8032e5 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803265:	45 89 e6             	mov    %r12d,%r14d
+  803268:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80326f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803273:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  80327a:	00 00 00 
+  80327d:	ff d0                	call   *%rax
+  80327f:	48 89 c2             	mov    %rax,%rdx
+  803282:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803287:	44 89 f6             	mov    %r14d,%esi
+  80328a:	89 df                	mov    %ebx,%edi
+  80328c:	48 b8 e8 30 80 00 00 	movabs $0x8030e8,%rax
+  803293:	00 00 00 
+  803296:	ff d0                	call   *%rax
+  803298:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80329b:	45 29 f4             	sub    %r14d,%r12d
+  80329e:	4d 63 f4             	movslq %r12d,%r14
+  8032a1:	49 39 c6             	cmp    %rax,%r14
+  8032a4:	7c 1d                	jl     8032c3 <read_map+0x92>
+  8032a6:	48 85 c0             	test   %rax,%rax
+  8032a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ae:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8032b2:	48 83 c4 10          	add    $0x10,%rsp
+  8032b6:	5b                   	pop    %rbx
+  8032b7:	41 5c                	pop    %r12
+  8032b9:	41 5d                	pop    %r13
+  8032bb:	41 5e                	pop    %r14
+  8032bd:	5d                   	pop    %rbp
+  8032be:	c3                   	ret
+    if (res < 0) return res;
+  8032bf:	48 98                	cltq
+  8032c1:	eb ef                	jmp    8032b2 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8032c3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032c7:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  8032ce:	00 00 00 
+  8032d1:	ff d0                	call   *%rax
+  8032d3:	4d 63 e4             	movslq %r12d,%r12
+  8032d6:	4c 01 e0             	add    %r12,%rax
+  8032d9:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8032dd:	48 89 d8             	mov    %rbx,%rax
+  8032e0:	4c 29 f0             	sub    %r14,%rax
+  8032e3:	eb cd                	jmp    8032b2 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8032e5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032ec:	eb c4                	jmp    8032b2 <read_map+0x81>
+
+00000000008032ee <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8032ee:	55                   	push   %rbp
+  8032ef:	48 89 e5             	mov    %rsp,%rbp
+  8032f2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032f6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032fa:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  803301:	00 00 00 
+  803304:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803306:	85 c0                	test   %eax,%eax
+  803308:	78 4a                	js     803354 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80330a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80330e:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803315:	00 00 00 
+  803318:	8b 00                	mov    (%rax),%eax
+  80331a:	39 07                	cmp    %eax,(%rdi)
+  80331c:	75 38                	jne    803356 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80331e:	48 b8 78 28 80 00 00 	movabs $0x802878,%rax
+  803325:	00 00 00 
+  803328:	ff d0                	call   *%rax
+  80332a:	85 c0                	test   %eax,%eax
+  80332c:	78 26                	js     803354 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80332e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803332:	8b 40 0c             	mov    0xc(%rax),%eax
+  803335:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80333c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80333e:	be 00 00 00 00       	mov    $0x0,%esi
+  803343:	bf 06 00 00 00       	mov    $0x6,%edi
+  803348:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  80334f:	00 00 00 
+  803352:	ff d0                	call   *%rax
+}
+  803354:	c9                   	leave
+  803355:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803356:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80335b:	eb f7                	jmp    803354 <fsync+0x66>
+
+000000000080335d <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80335d:	55                   	push   %rbp
+  80335e:	48 89 e5             	mov    %rsp,%rbp
+  803361:	41 57                	push   %r15
+  803363:	41 56                	push   %r14
+  803365:	41 55                	push   %r13
+  803367:	41 54                	push   %r12
+  803369:	53                   	push   %rbx
+  80336a:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80336e:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803375:	00 00 00 
+  803378:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80337d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803383:	49 bd 40 1d 80 00 00 	movabs $0x801d40,%r13
+  80338a:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80338d:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803394:	00 00 00 
+  803397:	eb 0c                	jmp    8033a5 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803399:	83 c3 01             	add    $0x1,%ebx
+  80339c:	49 83 c4 28          	add    $0x28,%r12
+  8033a0:	83 fb 20             	cmp    $0x20,%ebx
+  8033a3:	74 33                	je     8033d8 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033a5:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8033aa:	74 ed                	je     803399 <flushall+0x3c>
+  8033ac:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033b0:	89 df                	mov    %ebx,%edi
+  8033b2:	41 ff d5             	call   *%r13
+  8033b5:	85 c0                	test   %eax,%eax
+  8033b7:	78 e0                	js     803399 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8033b9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8033bd:	41 8b 06             	mov    (%r14),%eax
+  8033c0:	39 07                	cmp    %eax,(%rdi)
+  8033c2:	75 d5                	jne    803399 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8033c4:	48 b8 78 28 80 00 00 	movabs $0x802878,%rax
+  8033cb:	00 00 00 
+  8033ce:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8033d0:	85 c0                	test   %eax,%eax
+  8033d2:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8033d6:	eb c1                	jmp    803399 <flushall+0x3c>
+    }
+    return res;
+}
+  8033d8:	44 89 f8             	mov    %r15d,%eax
+  8033db:	48 83 c4 18          	add    $0x18,%rsp
+  8033df:	5b                   	pop    %rbx
+  8033e0:	41 5c                	pop    %r12
+  8033e2:	41 5d                	pop    %r13
+  8033e4:	41 5e                	pop    %r14
+  8033e6:	41 5f                	pop    %r15
+  8033e8:	5d                   	pop    %rbp
+  8033e9:	c3                   	ret
+
+00000000008033ea <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8033ea:	55                   	push   %rbp
+  8033eb:	48 89 e5             	mov    %rsp,%rbp
+  8033ee:	53                   	push   %rbx
+  8033ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8033f3:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8033f6:	40 0f b6 c6          	movzbl %sil,%eax
+  8033fa:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803401:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803403:	be 00 00 00 00       	mov    $0x0,%esi
+  803408:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80340d:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  803414:	00 00 00 
+  803417:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803419:	85 c0                	test   %eax,%eax
+  80341b:	78 23                	js     803440 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80341d:	ba 58 06 00 00       	mov    $0x658,%edx
+  803422:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803429:	00 00 00 
+  80342c:	48 89 df             	mov    %rbx,%rdi
+  80342f:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  803436:	00 00 00 
+  803439:	ff d0                	call   *%rax
+    return 0;
+  80343b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803440:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803444:	c9                   	leave
+  803445:	c3                   	ret
+
+0000000000803446 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803446:	55                   	push   %rbp
+  803447:	48 89 e5             	mov    %rsp,%rbp
+  80344a:	53                   	push   %rbx
+  80344b:	48 83 ec 08          	sub    $0x8,%rsp
+  80344f:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803452:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  803459:	00 00 00 
+  80345c:	ff d0                	call   *%rax
+  80345e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803464:	77 35                	ja     80349b <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803466:	48 89 de             	mov    %rbx,%rsi
+  803469:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803470:	00 00 00 
+  803473:	48 b8 3c 0b 80 00 00 	movabs $0x800b3c,%rax
+  80347a:	00 00 00 
+  80347d:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80347f:	be 00 00 00 00       	mov    $0x0,%esi
+  803484:	bf 07 00 00 00       	mov    $0x7,%edi
+  803489:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  803490:	00 00 00 
+  803493:	ff d0                	call   *%rax
+}
+  803495:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803499:	c9                   	leave
+  80349a:	c3                   	ret
+        return -E_BAD_PATH;
+  80349b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034a0:	eb f3                	jmp    803495 <remove+0x4f>
+
+00000000008034a2 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8034a2:	55                   	push   %rbp
+  8034a3:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8034a6:	48 b8 5d 33 80 00 00 	movabs $0x80335d,%rax
+  8034ad:	00 00 00 
+  8034b0:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8034b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8034bc:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  8034c3:	00 00 00 
+  8034c6:	ff d0                	call   *%rax
+}
+  8034c8:	5d                   	pop    %rbp
+  8034c9:	c3                   	ret
+
+00000000008034ca <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8034ca:	55                   	push   %rbp
+  8034cb:	48 89 e5             	mov    %rsp,%rbp
+  8034ce:	41 54                	push   %r12
+  8034d0:	53                   	push   %rbx
+  8034d1:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8034d4:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  8034db:	00 00 00 
+  8034de:	ff d0                	call   *%rax
+  8034e0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8034e3:	48 be 80 56 80 00 00 	movabs $0x805680,%rsi
+  8034ea:	00 00 00 
+  8034ed:	48 89 df             	mov    %rbx,%rdi
+  8034f0:	48 b8 3c 0b 80 00 00 	movabs $0x800b3c,%rax
+  8034f7:	00 00 00 
+  8034fa:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8034fc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803501:	41 2b 04 24          	sub    (%r12),%eax
+  803505:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80350b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803512:	00 00 00 
+    stat->st_dev = &devpipe;
+  803515:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80351c:	00 00 00 
+  80351f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803526:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352b:	5b                   	pop    %rbx
+  80352c:	41 5c                	pop    %r12
+  80352e:	5d                   	pop    %rbp
+  80352f:	c3                   	ret
+
+0000000000803530 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803530:	55                   	push   %rbp
+  803531:	48 89 e5             	mov    %rsp,%rbp
+  803534:	41 54                	push   %r12
+  803536:	53                   	push   %rbx
+  803537:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80353a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80353f:	48 89 fe             	mov    %rdi,%rsi
+  803542:	bf 00 00 00 00       	mov    $0x0,%edi
+  803547:	49 bc 7b 14 80 00 00 	movabs $0x80147b,%r12
+  80354e:	00 00 00 
+  803551:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803554:	48 89 df             	mov    %rbx,%rdi
+  803557:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  80355e:	00 00 00 
+  803561:	ff d0                	call   *%rax
+  803563:	48 89 c6             	mov    %rax,%rsi
+  803566:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80356b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803570:	41 ff d4             	call   *%r12
+}
+  803573:	5b                   	pop    %rbx
+  803574:	41 5c                	pop    %r12
+  803576:	5d                   	pop    %rbp
+  803577:	c3                   	ret
+
+0000000000803578 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803578:	55                   	push   %rbp
+  803579:	48 89 e5             	mov    %rsp,%rbp
+  80357c:	41 57                	push   %r15
+  80357e:	41 56                	push   %r14
+  803580:	41 55                	push   %r13
+  803582:	41 54                	push   %r12
+  803584:	53                   	push   %rbx
+  803585:	48 83 ec 18          	sub    $0x18,%rsp
+  803589:	49 89 fc             	mov    %rdi,%r12
+  80358c:	49 89 f5             	mov    %rsi,%r13
+  80358f:	49 89 d7             	mov    %rdx,%r15
+  803592:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803596:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  80359d:	00 00 00 
+  8035a0:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8035a2:	4d 85 ff             	test   %r15,%r15
+  8035a5:	0f 84 af 00 00 00    	je     80365a <devpipe_write+0xe2>
+  8035ab:	48 89 c3             	mov    %rax,%rbx
+  8035ae:	4c 89 f8             	mov    %r15,%rax
+  8035b1:	4d 89 ef             	mov    %r13,%r15
+  8035b4:	4c 01 e8             	add    %r13,%rax
+  8035b7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035bb:	49 bd 70 12 80 00 00 	movabs $0x801270,%r13
+  8035c2:	00 00 00 
+            sys_yield();
+  8035c5:	49 be 0d 12 80 00 00 	movabs $0x80120d,%r14
+  8035cc:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8035cf:	8b 73 04             	mov    0x4(%rbx),%esi
+  8035d2:	48 63 ce             	movslq %esi,%rcx
+  8035d5:	48 63 03             	movslq (%rbx),%rax
+  8035d8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8035de:	48 39 c1             	cmp    %rax,%rcx
+  8035e1:	72 2e                	jb     803611 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8035e3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8035e8:	48 89 da             	mov    %rbx,%rdx
+  8035eb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035f0:	4c 89 e7             	mov    %r12,%rdi
+  8035f3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8035f6:	85 c0                	test   %eax,%eax
+  8035f8:	74 66                	je     803660 <devpipe_write+0xe8>
+            sys_yield();
+  8035fa:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8035fd:	8b 73 04             	mov    0x4(%rbx),%esi
+  803600:	48 63 ce             	movslq %esi,%rcx
+  803603:	48 63 03             	movslq (%rbx),%rax
+  803606:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80360c:	48 39 c1             	cmp    %rax,%rcx
+  80360f:	73 d2                	jae    8035e3 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803611:	41 0f b6 3f          	movzbl (%r15),%edi
+  803615:	48 89 ca             	mov    %rcx,%rdx
+  803618:	48 c1 ea 03          	shr    $0x3,%rdx
+  80361c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803623:	08 10 20 
+  803626:	48 f7 e2             	mul    %rdx
+  803629:	48 c1 ea 06          	shr    $0x6,%rdx
+  80362d:	48 89 d0             	mov    %rdx,%rax
+  803630:	48 c1 e0 09          	shl    $0x9,%rax
+  803634:	48 29 d0             	sub    %rdx,%rax
+  803637:	48 c1 e0 03          	shl    $0x3,%rax
+  80363b:	48 29 c1             	sub    %rax,%rcx
+  80363e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803643:	83 c6 01             	add    $0x1,%esi
+  803646:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803649:	49 83 c7 01          	add    $0x1,%r15
+  80364d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803651:	49 39 c7             	cmp    %rax,%r15
+  803654:	0f 85 75 ff ff ff    	jne    8035cf <devpipe_write+0x57>
+    return n;
+  80365a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80365e:	eb 05                	jmp    803665 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803660:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803665:	48 83 c4 18          	add    $0x18,%rsp
+  803669:	5b                   	pop    %rbx
+  80366a:	41 5c                	pop    %r12
+  80366c:	41 5d                	pop    %r13
+  80366e:	41 5e                	pop    %r14
+  803670:	41 5f                	pop    %r15
+  803672:	5d                   	pop    %rbp
+  803673:	c3                   	ret
+
+0000000000803674 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803674:	55                   	push   %rbp
+  803675:	48 89 e5             	mov    %rsp,%rbp
+  803678:	41 57                	push   %r15
+  80367a:	41 56                	push   %r14
+  80367c:	41 55                	push   %r13
+  80367e:	41 54                	push   %r12
+  803680:	53                   	push   %rbx
+  803681:	48 83 ec 18          	sub    $0x18,%rsp
+  803685:	49 89 fc             	mov    %rdi,%r12
+  803688:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80368c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803690:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  803697:	00 00 00 
+  80369a:	ff d0                	call   *%rax
+  80369c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80369f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036a5:	49 bd 70 12 80 00 00 	movabs $0x801270,%r13
+  8036ac:	00 00 00 
+            sys_yield();
+  8036af:	49 be 0d 12 80 00 00 	movabs $0x80120d,%r14
+  8036b6:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8036b9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8036be:	74 7d                	je     80373d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036c0:	8b 03                	mov    (%rbx),%eax
+  8036c2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036c5:	75 26                	jne    8036ed <devpipe_read+0x79>
+            if (i > 0) return i;
+  8036c7:	4d 85 ff             	test   %r15,%r15
+  8036ca:	75 77                	jne    803743 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036cc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036d1:	48 89 da             	mov    %rbx,%rdx
+  8036d4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036d9:	4c 89 e7             	mov    %r12,%rdi
+  8036dc:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8036df:	85 c0                	test   %eax,%eax
+  8036e1:	74 72                	je     803755 <devpipe_read+0xe1>
+            sys_yield();
+  8036e3:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8036e6:	8b 03                	mov    (%rbx),%eax
+  8036e8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8036eb:	74 df                	je     8036cc <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8036ed:	48 63 c8             	movslq %eax,%rcx
+  8036f0:	48 89 ca             	mov    %rcx,%rdx
+  8036f3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8036f7:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8036fe:	08 10 20 
+  803701:	48 89 d0             	mov    %rdx,%rax
+  803704:	48 f7 e6             	mul    %rsi
+  803707:	48 c1 ea 06          	shr    $0x6,%rdx
+  80370b:	48 89 d0             	mov    %rdx,%rax
+  80370e:	48 c1 e0 09          	shl    $0x9,%rax
+  803712:	48 29 d0             	sub    %rdx,%rax
+  803715:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80371c:	00 
+  80371d:	48 89 c8             	mov    %rcx,%rax
+  803720:	48 29 d0             	sub    %rdx,%rax
+  803723:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803728:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80372c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803730:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803733:	49 83 c7 01          	add    $0x1,%r15
+  803737:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80373b:	75 83                	jne    8036c0 <devpipe_read+0x4c>
+    return n;
+  80373d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803741:	eb 03                	jmp    803746 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803743:	4c 89 f8             	mov    %r15,%rax
+}
+  803746:	48 83 c4 18          	add    $0x18,%rsp
+  80374a:	5b                   	pop    %rbx
+  80374b:	41 5c                	pop    %r12
+  80374d:	41 5d                	pop    %r13
+  80374f:	41 5e                	pop    %r14
+  803751:	41 5f                	pop    %r15
+  803753:	5d                   	pop    %rbp
+  803754:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375a:	eb ea                	jmp    803746 <devpipe_read+0xd2>
+
+000000000080375c <pipe>:
+pipe(int pfd[2]) {
+  80375c:	55                   	push   %rbp
+  80375d:	48 89 e5             	mov    %rsp,%rbp
+  803760:	41 55                	push   %r13
+  803762:	41 54                	push   %r12
+  803764:	53                   	push   %rbx
+  803765:	48 83 ec 18          	sub    $0x18,%rsp
+  803769:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80376c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803770:	48 b8 e0 1c 80 00 00 	movabs $0x801ce0,%rax
+  803777:	00 00 00 
+  80377a:	ff d0                	call   *%rax
+  80377c:	89 c3                	mov    %eax,%ebx
+  80377e:	85 c0                	test   %eax,%eax
+  803780:	0f 88 a0 01 00 00    	js     803926 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803786:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80378b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803790:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803794:	bf 00 00 00 00       	mov    $0x0,%edi
+  803799:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  8037a0:	00 00 00 
+  8037a3:	ff d0                	call   *%rax
+  8037a5:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8037a7:	85 c0                	test   %eax,%eax
+  8037a9:	0f 88 77 01 00 00    	js     803926 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037af:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8037b3:	48 b8 e0 1c 80 00 00 	movabs $0x801ce0,%rax
+  8037ba:	00 00 00 
+  8037bd:	ff d0                	call   *%rax
+  8037bf:	89 c3                	mov    %eax,%ebx
+  8037c1:	85 c0                	test   %eax,%eax
+  8037c3:	0f 88 43 01 00 00    	js     80390c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8037c9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8037ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037d3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8037d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037dc:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  8037e3:	00 00 00 
+  8037e6:	ff d0                	call   *%rax
+  8037e8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8037ea:	85 c0                	test   %eax,%eax
+  8037ec:	0f 88 1a 01 00 00    	js     80390c <pipe+0x1b0>
+    va = fd2data(fd0);
+  8037f2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8037f6:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  8037fd:	00 00 00 
+  803800:	ff d0                	call   *%rax
+  803802:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803805:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80380a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80380f:	48 89 c6             	mov    %rax,%rsi
+  803812:	bf 00 00 00 00       	mov    $0x0,%edi
+  803817:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  80381e:	00 00 00 
+  803821:	ff d0                	call   *%rax
+  803823:	89 c3                	mov    %eax,%ebx
+  803825:	85 c0                	test   %eax,%eax
+  803827:	0f 88 c5 00 00 00    	js     8038f2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80382d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803831:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  803838:	00 00 00 
+  80383b:	ff d0                	call   *%rax
+  80383d:	48 89 c1             	mov    %rax,%rcx
+  803840:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803846:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80384c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803851:	4c 89 ee             	mov    %r13,%rsi
+  803854:	bf 00 00 00 00       	mov    $0x0,%edi
+  803859:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  803860:	00 00 00 
+  803863:	ff d0                	call   *%rax
+  803865:	89 c3                	mov    %eax,%ebx
+  803867:	85 c0                	test   %eax,%eax
+  803869:	78 6e                	js     8038d9 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80386b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803870:	4c 89 ef             	mov    %r13,%rdi
+  803873:	48 b8 3e 12 80 00 00 	movabs $0x80123e,%rax
+  80387a:	00 00 00 
+  80387d:	ff d0                	call   *%rax
+  80387f:	83 f8 02             	cmp    $0x2,%eax
+  803882:	0f 85 ab 00 00 00    	jne    803933 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803888:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80388f:	00 00 
+  803891:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803895:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803897:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80389b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8038a2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8038a6:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8038a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038ac:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8038b3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8038b7:	48 bb b2 1c 80 00 00 	movabs $0x801cb2,%rbx
+  8038be:	00 00 00 
+  8038c1:	ff d3                	call   *%rbx
+  8038c3:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8038c7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8038cb:	ff d3                	call   *%rbx
+  8038cd:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8038d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038d7:	eb 4d                	jmp    803926 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8038d9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038de:	4c 89 ee             	mov    %r13,%rsi
+  8038e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038e6:	48 b8 7b 14 80 00 00 	movabs $0x80147b,%rax
+  8038ed:	00 00 00 
+  8038f0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8038f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038f7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8038fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803900:	48 b8 7b 14 80 00 00 	movabs $0x80147b,%rax
+  803907:	00 00 00 
+  80390a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80390c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803911:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803915:	bf 00 00 00 00       	mov    $0x0,%edi
+  80391a:	48 b8 7b 14 80 00 00 	movabs $0x80147b,%rax
+  803921:	00 00 00 
+  803924:	ff d0                	call   *%rax
+}
+  803926:	89 d8                	mov    %ebx,%eax
+  803928:	48 83 c4 18          	add    $0x18,%rsp
+  80392c:	5b                   	pop    %rbx
+  80392d:	41 5c                	pop    %r12
+  80392f:	41 5d                	pop    %r13
+  803931:	5d                   	pop    %rbp
+  803932:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803933:	48 b9 b0 56 80 00 00 	movabs $0x8056b0,%rcx
+  80393a:	00 00 00 
+  80393d:	48 ba 87 56 80 00 00 	movabs $0x805687,%rdx
+  803944:	00 00 00 
+  803947:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80394c:	48 bf 9c 56 80 00 00 	movabs $0x80569c,%rdi
+  803953:	00 00 00 
+  803956:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395b:	49 b8 3b 3f 80 00 00 	movabs $0x803f3b,%r8
+  803962:	00 00 00 
+  803965:	41 ff d0             	call   *%r8
+
+0000000000803968 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803968:	55                   	push   %rbp
+  803969:	48 89 e5             	mov    %rsp,%rbp
+  80396c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803970:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803974:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  80397b:	00 00 00 
+  80397e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803980:	85 c0                	test   %eax,%eax
+  803982:	78 35                	js     8039b9 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803984:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803988:	48 b8 c4 1c 80 00 00 	movabs $0x801cc4,%rax
+  80398f:	00 00 00 
+  803992:	ff d0                	call   *%rax
+  803994:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803997:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80399c:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039a1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8039a5:	48 b8 70 12 80 00 00 	movabs $0x801270,%rax
+  8039ac:	00 00 00 
+  8039af:	ff d0                	call   *%rax
+  8039b1:	85 c0                	test   %eax,%eax
+  8039b3:	0f 94 c0             	sete   %al
+  8039b6:	0f b6 c0             	movzbl %al,%eax
+}
+  8039b9:	c9                   	leave
+  8039ba:	c3                   	ret
+
+00000000008039bb <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8039bb:	48 89 f8             	mov    %rdi,%rax
+  8039be:	48 c1 e8 27          	shr    $0x27,%rax
+  8039c2:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8039c9:	7f 00 00 
+  8039cc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039d0:	f6 c2 01             	test   $0x1,%dl
+  8039d3:	74 6d                	je     803a42 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8039d5:	48 89 f8             	mov    %rdi,%rax
+  8039d8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039dc:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039e3:	7f 00 00 
+  8039e6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039ea:	f6 c2 01             	test   $0x1,%dl
+  8039ed:	74 62                	je     803a51 <get_uvpt_entry+0x96>
+  8039ef:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8039f6:	7f 00 00 
+  8039f9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8039fd:	f6 c2 80             	test   $0x80,%dl
+  803a00:	75 4f                	jne    803a51 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a02:	48 89 f8             	mov    %rdi,%rax
+  803a05:	48 c1 e8 15          	shr    $0x15,%rax
+  803a09:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a10:	7f 00 00 
+  803a13:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a17:	f6 c2 01             	test   $0x1,%dl
+  803a1a:	74 44                	je     803a60 <get_uvpt_entry+0xa5>
+  803a1c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a23:	7f 00 00 
+  803a26:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a2a:	f6 c2 80             	test   $0x80,%dl
+  803a2d:	75 31                	jne    803a60 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803a2f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803a33:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803a3a:	7f 00 00 
+  803a3d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803a41:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803a42:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803a49:	7f 00 00 
+  803a4c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a50:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803a51:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803a58:	7f 00 00 
+  803a5b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a5f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803a60:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803a67:	7f 00 00 
+  803a6a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a6e:	c3                   	ret
+
+0000000000803a6f <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803a6f:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a72:	48 89 f9             	mov    %rdi,%rcx
+  803a75:	48 c1 e9 27          	shr    $0x27,%rcx
+  803a79:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803a80:	7f 00 00 
+  803a83:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803a87:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803a8e:	f6 c1 01             	test   $0x1,%cl
+  803a91:	0f 84 b2 00 00 00    	je     803b49 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803a97:	48 89 f9             	mov    %rdi,%rcx
+  803a9a:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803a9e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803aa5:	7f 00 00 
+  803aa8:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803aac:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803ab3:	40 f6 c6 01          	test   $0x1,%sil
+  803ab7:	0f 84 8c 00 00 00    	je     803b49 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803abd:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803ac4:	7f 00 00 
+  803ac7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803acb:	a8 80                	test   $0x80,%al
+  803acd:	75 7b                	jne    803b4a <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803acf:	48 89 f9             	mov    %rdi,%rcx
+  803ad2:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ad6:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803add:	7f 00 00 
+  803ae0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ae4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803aeb:	40 f6 c6 01          	test   $0x1,%sil
+  803aef:	74 58                	je     803b49 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803af1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803af8:	7f 00 00 
+  803afb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803aff:	a8 80                	test   $0x80,%al
+  803b01:	75 6c                	jne    803b6f <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b03:	48 89 f9             	mov    %rdi,%rcx
+  803b06:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803b0a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b11:	7f 00 00 
+  803b14:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803b18:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803b1f:	40 f6 c6 01          	test   $0x1,%sil
+  803b23:	74 24                	je     803b49 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803b25:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803b2c:	7f 00 00 
+  803b2f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b33:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b3a:	ff ff 7f 
+  803b3d:	48 21 c8             	and    %rcx,%rax
+  803b40:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803b46:	48 09 d0             	or     %rdx,%rax
+}
+  803b49:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803b4a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803b51:	7f 00 00 
+  803b54:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b58:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b5f:	ff ff 7f 
+  803b62:	48 21 c8             	and    %rcx,%rax
+  803b65:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803b6b:	48 01 d0             	add    %rdx,%rax
+  803b6e:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803b6f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803b76:	7f 00 00 
+  803b79:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803b7d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803b84:	ff ff 7f 
+  803b87:	48 21 c8             	and    %rcx,%rax
+  803b8a:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803b90:	48 01 d0             	add    %rdx,%rax
+  803b93:	c3                   	ret
+
+0000000000803b94 <get_prot>:
+
+int
+get_prot(void *va) {
+  803b94:	55                   	push   %rbp
+  803b95:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803b98:	48 b8 bb 39 80 00 00 	movabs $0x8039bb,%rax
+  803b9f:	00 00 00 
+  803ba2:	ff d0                	call   *%rax
+  803ba4:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803ba7:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803bac:	89 c1                	mov    %eax,%ecx
+  803bae:	83 c9 04             	or     $0x4,%ecx
+  803bb1:	f6 c2 01             	test   $0x1,%dl
+  803bb4:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803bb7:	89 c1                	mov    %eax,%ecx
+  803bb9:	83 c9 02             	or     $0x2,%ecx
+  803bbc:	f6 c2 02             	test   $0x2,%dl
+  803bbf:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803bc2:	89 c1                	mov    %eax,%ecx
+  803bc4:	83 c9 01             	or     $0x1,%ecx
+  803bc7:	48 85 d2             	test   %rdx,%rdx
+  803bca:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803bcd:	89 c1                	mov    %eax,%ecx
+  803bcf:	83 c9 40             	or     $0x40,%ecx
+  803bd2:	f6 c6 04             	test   $0x4,%dh
+  803bd5:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803bd8:	5d                   	pop    %rbp
+  803bd9:	c3                   	ret
+
+0000000000803bda <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803bda:	55                   	push   %rbp
+  803bdb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803bde:	48 b8 bb 39 80 00 00 	movabs $0x8039bb,%rax
+  803be5:	00 00 00 
+  803be8:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803bea:	48 c1 e8 06          	shr    $0x6,%rax
+  803bee:	83 e0 01             	and    $0x1,%eax
+}
+  803bf1:	5d                   	pop    %rbp
+  803bf2:	c3                   	ret
+
+0000000000803bf3 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803bf3:	55                   	push   %rbp
+  803bf4:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803bf7:	48 b8 bb 39 80 00 00 	movabs $0x8039bb,%rax
+  803bfe:	00 00 00 
+  803c01:	ff d0                	call   *%rax
+  803c03:	83 e0 01             	and    $0x1,%eax
+}
+  803c06:	5d                   	pop    %rbp
+  803c07:	c3                   	ret
+
+0000000000803c08 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803c08:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803c0f:	7f 00 00 
+  803c12:	a8 01                	test   $0x1,%al
+  803c14:	75 06                	jne    803c1c <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c1b:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803c1c:	55                   	push   %rbp
+  803c1d:	48 89 e5             	mov    %rsp,%rbp
+  803c20:	41 57                	push   %r15
+  803c22:	41 56                	push   %r14
+  803c24:	41 55                	push   %r13
+  803c26:	41 54                	push   %r12
+  803c28:	53                   	push   %rbx
+  803c29:	48 83 ec 18          	sub    $0x18,%rsp
+  803c2d:	49 89 fe             	mov    %rdi,%r14
+  803c30:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803c33:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803c3a:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c3b:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803c42:	7f 00 00 
+  803c45:	e9 81 00 00 00       	jmp    803ccb <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803c4a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803c51:	49 39 dd             	cmp    %rbx,%r13
+  803c54:	74 2b                	je     803c81 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803c56:	48 89 d8             	mov    %rbx,%rax
+  803c59:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c5d:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803c61:	f6 c2 01             	test   $0x1,%dl
+  803c64:	74 e4                	je     803c4a <foreach_shared_region+0x42>
+  803c66:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803c6a:	f6 c4 04             	test   $0x4,%ah
+  803c6d:	74 db                	je     803c4a <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803c6f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803c76:	4c 89 fa             	mov    %r15,%rdx
+  803c79:	48 89 df             	mov    %rbx,%rdi
+  803c7c:	41 ff d6             	call   *%r14
+  803c7f:	eb c9                	jmp    803c4a <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803c81:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803c88:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803c8c:	74 22                	je     803cb0 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803c8e:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803c95:	48 89 d8             	mov    %rbx,%rax
+  803c98:	48 c1 e8 15          	shr    $0x15,%rax
+  803c9c:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803ca3:	7f 00 00 
+  803ca6:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803caa:	a8 01                	test   $0x1,%al
+  803cac:	74 d3                	je     803c81 <foreach_shared_region+0x79>
+  803cae:	eb a6                	jmp    803c56 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803cb0:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803cb7:	40 
+  803cb8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803cbc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803cc3:	00 00 00 
+  803cc6:	48 39 c1             	cmp    %rax,%rcx
+  803cc9:	74 31                	je     803cfc <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803ccb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ccf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803cd3:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803cda:	7f 00 00 
+  803cdd:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803ce1:	a8 01                	test   $0x1,%al
+  803ce3:	74 cb                	je     803cb0 <foreach_shared_region+0xa8>
+  803ce5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ce9:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803cf0:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803cf6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803cfa:	eb 92                	jmp    803c8e <foreach_shared_region+0x86>
+}
+  803cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d01:	48 83 c4 18          	add    $0x18,%rsp
+  803d05:	5b                   	pop    %rbx
+  803d06:	41 5c                	pop    %r12
+  803d08:	41 5d                	pop    %r13
+  803d0a:	41 5e                	pop    %r14
+  803d0c:	41 5f                	pop    %r15
+  803d0e:	5d                   	pop    %rbp
+  803d0f:	c3                   	ret
+
+0000000000803d10 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803d10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d15:	c3                   	ret
+
+0000000000803d16 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803d16:	55                   	push   %rbp
+  803d17:	48 89 e5             	mov    %rsp,%rbp
+  803d1a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803d1d:	48 be d4 56 80 00 00 	movabs $0x8056d4,%rsi
+  803d24:	00 00 00 
+  803d27:	48 b8 3c 0b 80 00 00 	movabs $0x800b3c,%rax
+  803d2e:	00 00 00 
+  803d31:	ff d0                	call   *%rax
+    return 0;
+}
+  803d33:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d38:	5d                   	pop    %rbp
+  803d39:	c3                   	ret
+
+0000000000803d3a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d3a:	55                   	push   %rbp
+  803d3b:	48 89 e5             	mov    %rsp,%rbp
+  803d3e:	41 57                	push   %r15
+  803d40:	41 56                	push   %r14
+  803d42:	41 55                	push   %r13
+  803d44:	41 54                	push   %r12
+  803d46:	53                   	push   %rbx
+  803d47:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803d4e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803d55:	48 85 d2             	test   %rdx,%rdx
+  803d58:	74 7a                	je     803dd4 <devcons_write+0x9a>
+  803d5a:	49 89 d6             	mov    %rdx,%r14
+  803d5d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803d63:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803d68:	49 bf ca 0e 80 00 00 	movabs $0x800eca,%r15
+  803d6f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803d72:	4c 89 f3             	mov    %r14,%rbx
+  803d75:	48 29 f3             	sub    %rsi,%rbx
+  803d78:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803d7d:	48 39 c3             	cmp    %rax,%rbx
+  803d80:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803d84:	4c 63 eb             	movslq %ebx,%r13
+  803d87:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803d8e:	48 01 c6             	add    %rax,%rsi
+  803d91:	4c 89 ea             	mov    %r13,%rdx
+  803d94:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803d9b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803d9e:	4c 89 ee             	mov    %r13,%rsi
+  803da1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803da8:	48 b8 13 11 80 00 00 	movabs $0x801113,%rax
+  803daf:	00 00 00 
+  803db2:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803db4:	41 01 dc             	add    %ebx,%r12d
+  803db7:	49 63 f4             	movslq %r12d,%rsi
+  803dba:	4c 39 f6             	cmp    %r14,%rsi
+  803dbd:	72 b3                	jb     803d72 <devcons_write+0x38>
+    return res;
+  803dbf:	49 63 c4             	movslq %r12d,%rax
+}
+  803dc2:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803dc9:	5b                   	pop    %rbx
+  803dca:	41 5c                	pop    %r12
+  803dcc:	41 5d                	pop    %r13
+  803dce:	41 5e                	pop    %r14
+  803dd0:	41 5f                	pop    %r15
+  803dd2:	5d                   	pop    %rbp
+  803dd3:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803dd4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803dda:	eb e3                	jmp    803dbf <devcons_write+0x85>
+
+0000000000803ddc <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ddc:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803ddf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803de4:	48 85 c0             	test   %rax,%rax
+  803de7:	74 55                	je     803e3e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803de9:	55                   	push   %rbp
+  803dea:	48 89 e5             	mov    %rsp,%rbp
+  803ded:	41 55                	push   %r13
+  803def:	41 54                	push   %r12
+  803df1:	53                   	push   %rbx
+  803df2:	48 83 ec 08          	sub    $0x8,%rsp
+  803df6:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803df9:	48 bb 40 11 80 00 00 	movabs $0x801140,%rbx
+  803e00:	00 00 00 
+  803e03:	49 bc 0d 12 80 00 00 	movabs $0x80120d,%r12
+  803e0a:	00 00 00 
+  803e0d:	eb 03                	jmp    803e12 <devcons_read+0x36>
+  803e0f:	41 ff d4             	call   *%r12
+  803e12:	ff d3                	call   *%rbx
+  803e14:	85 c0                	test   %eax,%eax
+  803e16:	74 f7                	je     803e0f <devcons_read+0x33>
+    if (c < 0) return c;
+  803e18:	48 63 d0             	movslq %eax,%rdx
+  803e1b:	78 13                	js     803e30 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803e1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e22:	83 f8 04             	cmp    $0x4,%eax
+  803e25:	74 09                	je     803e30 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803e27:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803e2b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803e30:	48 89 d0             	mov    %rdx,%rax
+  803e33:	48 83 c4 08          	add    $0x8,%rsp
+  803e37:	5b                   	pop    %rbx
+  803e38:	41 5c                	pop    %r12
+  803e3a:	41 5d                	pop    %r13
+  803e3c:	5d                   	pop    %rbp
+  803e3d:	c3                   	ret
+  803e3e:	48 89 d0             	mov    %rdx,%rax
+  803e41:	c3                   	ret
+
+0000000000803e42 <cputchar>:
+cputchar(int ch) {
+  803e42:	55                   	push   %rbp
+  803e43:	48 89 e5             	mov    %rsp,%rbp
+  803e46:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803e4a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803e4e:	be 01 00 00 00       	mov    $0x1,%esi
+  803e53:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803e57:	48 b8 13 11 80 00 00 	movabs $0x801113,%rax
+  803e5e:	00 00 00 
+  803e61:	ff d0                	call   *%rax
+}
+  803e63:	c9                   	leave
+  803e64:	c3                   	ret
+
+0000000000803e65 <getchar>:
+getchar(void) {
+  803e65:	55                   	push   %rbp
+  803e66:	48 89 e5             	mov    %rsp,%rbp
+  803e69:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803e6d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e72:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803e76:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e7b:	48 b8 23 20 80 00 00 	movabs $0x802023,%rax
+  803e82:	00 00 00 
+  803e85:	ff d0                	call   *%rax
+  803e87:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803e89:	85 c0                	test   %eax,%eax
+  803e8b:	78 06                	js     803e93 <getchar+0x2e>
+  803e8d:	74 08                	je     803e97 <getchar+0x32>
+  803e8f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803e93:	89 d0                	mov    %edx,%eax
+  803e95:	c9                   	leave
+  803e96:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803e97:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803e9c:	eb f5                	jmp    803e93 <getchar+0x2e>
+
+0000000000803e9e <iscons>:
+iscons(int fdnum) {
+  803e9e:	55                   	push   %rbp
+  803e9f:	48 89 e5             	mov    %rsp,%rbp
+  803ea2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ea6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803eaa:	48 b8 40 1d 80 00 00 	movabs $0x801d40,%rax
+  803eb1:	00 00 00 
+  803eb4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803eb6:	85 c0                	test   %eax,%eax
+  803eb8:	78 18                	js     803ed2 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803eba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ebe:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803ec5:	00 00 00 
+  803ec8:	8b 00                	mov    (%rax),%eax
+  803eca:	39 02                	cmp    %eax,(%rdx)
+  803ecc:	0f 94 c0             	sete   %al
+  803ecf:	0f b6 c0             	movzbl %al,%eax
+}
+  803ed2:	c9                   	leave
+  803ed3:	c3                   	ret
+
+0000000000803ed4 <opencons>:
+opencons(void) {
+  803ed4:	55                   	push   %rbp
+  803ed5:	48 89 e5             	mov    %rsp,%rbp
+  803ed8:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803edc:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803ee0:	48 b8 e0 1c 80 00 00 	movabs $0x801ce0,%rax
+  803ee7:	00 00 00 
+  803eea:	ff d0                	call   *%rax
+  803eec:	85 c0                	test   %eax,%eax
+  803eee:	78 49                	js     803f39 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803ef0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ef5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803efa:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803efe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f03:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  803f0a:	00 00 00 
+  803f0d:	ff d0                	call   *%rax
+  803f0f:	85 c0                	test   %eax,%eax
+  803f11:	78 26                	js     803f39 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803f13:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f17:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803f1e:	00 00 
+  803f20:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803f22:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f26:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803f2d:	48 b8 b2 1c 80 00 00 	movabs $0x801cb2,%rax
+  803f34:	00 00 00 
+  803f37:	ff d0                	call   *%rax
+}
+  803f39:	c9                   	leave
+  803f3a:	c3                   	ret
+
+0000000000803f3b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803f3b:	55                   	push   %rbp
+  803f3c:	48 89 e5             	mov    %rsp,%rbp
+  803f3f:	41 56                	push   %r14
+  803f41:	41 55                	push   %r13
+  803f43:	41 54                	push   %r12
+  803f45:	53                   	push   %rbx
+  803f46:	48 83 ec 50          	sub    $0x50,%rsp
+  803f4a:	49 89 fc             	mov    %rdi,%r12
+  803f4d:	41 89 f5             	mov    %esi,%r13d
+  803f50:	48 89 d3             	mov    %rdx,%rbx
+  803f53:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f57:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803f5b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803f5f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803f66:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f6a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803f6e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803f72:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803f76:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803f7d:	00 00 00 
+  803f80:	4c 8b 30             	mov    (%rax),%r14
+  803f83:	48 b8 dc 11 80 00 00 	movabs $0x8011dc,%rax
+  803f8a:	00 00 00 
+  803f8d:	ff d0                	call   *%rax
+  803f8f:	89 c6                	mov    %eax,%esi
+  803f91:	45 89 e8             	mov    %r13d,%r8d
+  803f94:	4c 89 e1             	mov    %r12,%rcx
+  803f97:	4c 89 f2             	mov    %r14,%rdx
+  803f9a:	48 bf e0 56 80 00 00 	movabs $0x8056e0,%rdi
+  803fa1:	00 00 00 
+  803fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa9:	49 bc c4 01 80 00 00 	movabs $0x8001c4,%r12
+  803fb0:	00 00 00 
+  803fb3:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803fb6:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803fba:	48 89 df             	mov    %rbx,%rdi
+  803fbd:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  803fc4:	00 00 00 
+  803fc7:	ff d0                	call   *%rax
+    cprintf("\n");
+  803fc9:	48 bf 02 50 80 00 00 	movabs $0x805002,%rdi
+  803fd0:	00 00 00 
+  803fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803fdb:	cc                   	int3
+  803fdc:	eb fd                	jmp    803fdb <_panic+0xa0>
+
+0000000000803fde <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803fde:	55                   	push   %rbp
+  803fdf:	48 89 e5             	mov    %rsp,%rbp
+  803fe2:	41 55                	push   %r13
+  803fe4:	41 54                	push   %r12
+  803fe6:	53                   	push   %rbx
+  803fe7:	48 83 ec 08          	sub    $0x8,%rsp
+  803feb:	49 89 fc             	mov    %rdi,%r12
+  803fee:	48 89 f7             	mov    %rsi,%rdi
+  803ff1:	48 89 d3             	mov    %rdx,%rbx
+  803ff4:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  803ff7:	48 85 f6             	test   %rsi,%rsi
+  803ffa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804001:	00 00 00 
+  804004:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804008:	be 00 10 00 00       	mov    $0x1000,%esi
+  80400d:	48 85 d2             	test   %rdx,%rdx
+  804010:	74 03                	je     804015 <ipc_recv+0x37>
+  804012:	48 8b 32             	mov    (%rdx),%rsi
+  804015:	48 b8 49 16 80 00 00 	movabs $0x801649,%rax
+  80401c:	00 00 00 
+  80401f:	ff d0                	call   *%rax
+    if (errno) {
+  804021:	85 c0                	test   %eax,%eax
+  804023:	74 1c                	je     804041 <ipc_recv+0x63>
+        if (from_env_store)
+  804025:	4d 85 e4             	test   %r12,%r12
+  804028:	74 08                	je     804032 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80402a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804031:	00 
+
+        if (perm_store)
+  804032:	4d 85 ed             	test   %r13,%r13
+  804035:	74 74                	je     8040ab <ipc_recv+0xcd>
+            *perm_store = 0;
+  804037:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80403e:	00 
+  80403f:	eb 6a                	jmp    8040ab <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804041:	4d 85 e4             	test   %r12,%r12
+  804044:	74 14                	je     80405a <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804046:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80404d:	00 00 00 
+  804050:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804056:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80405a:	48 85 db             	test   %rbx,%rbx
+  80405d:	74 23                	je     804082 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80405f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804066:	00 00 00 
+  804069:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80406f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804074:	85 c9                	test   %ecx,%ecx
+  804076:	74 07                	je     80407f <ipc_recv+0xa1>
+  804078:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80407f:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804082:	4d 85 ed             	test   %r13,%r13
+  804085:	74 14                	je     80409b <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804087:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80408e:	00 00 00 
+  804091:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804097:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  80409b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8040a2:	00 00 00 
+  8040a5:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8040ab:	48 83 c4 08          	add    $0x8,%rsp
+  8040af:	5b                   	pop    %rbx
+  8040b0:	41 5c                	pop    %r12
+  8040b2:	41 5d                	pop    %r13
+  8040b4:	5d                   	pop    %rbp
+  8040b5:	c3                   	ret
+
+00000000008040b6 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040b6:	55                   	push   %rbp
+  8040b7:	48 89 e5             	mov    %rsp,%rbp
+  8040ba:	41 55                	push   %r13
+  8040bc:	41 54                	push   %r12
+  8040be:	53                   	push   %rbx
+  8040bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8040c3:	49 89 fc             	mov    %rdi,%r12
+  8040c6:	48 89 f7             	mov    %rsi,%rdi
+  8040c9:	48 89 d3             	mov    %rdx,%rbx
+  8040cc:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8040cf:	48 85 f6             	test   %rsi,%rsi
+  8040d2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040d9:	00 00 00 
+  8040dc:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8040e0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040e5:	48 85 d2             	test   %rdx,%rdx
+  8040e8:	74 03                	je     8040ed <ipc_try_recv+0x37>
+  8040ea:	48 8b 32             	mov    (%rdx),%rsi
+  8040ed:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  8040f4:	00 00 00 
+  8040f7:	ff d0                	call   *%rax
+    if (errno) {
+  8040f9:	85 c0                	test   %eax,%eax
+  8040fb:	75 75                	jne    804172 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8040fd:	4d 85 e4             	test   %r12,%r12
+  804100:	74 14                	je     804116 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804102:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804109:	00 00 00 
+  80410c:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804112:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804116:	48 85 db             	test   %rbx,%rbx
+  804119:	74 23                	je     80413e <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80411b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804122:	00 00 00 
+  804125:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80412b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804130:	85 c9                	test   %ecx,%ecx
+  804132:	74 07                	je     80413b <ipc_try_recv+0x85>
+  804134:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80413b:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80413e:	4d 85 ed             	test   %r13,%r13
+  804141:	74 14                	je     804157 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804143:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80414a:	00 00 00 
+  80414d:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804153:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804157:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80415e:	00 00 00 
+  804161:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804167:	48 83 c4 08          	add    $0x8,%rsp
+  80416b:	5b                   	pop    %rbx
+  80416c:	41 5c                	pop    %r12
+  80416e:	41 5d                	pop    %r13
+  804170:	5d                   	pop    %rbp
+  804171:	c3                   	ret
+        if (from_env_store)
+  804172:	4d 85 e4             	test   %r12,%r12
+  804175:	74 08                	je     80417f <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804177:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80417e:	00 
+        if (perm_store)
+  80417f:	4d 85 ed             	test   %r13,%r13
+  804182:	74 e3                	je     804167 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804184:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80418b:	00 
+  80418c:	eb d9                	jmp    804167 <ipc_try_recv+0xb1>
+
+000000000080418e <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80418e:	55                   	push   %rbp
+  80418f:	48 89 e5             	mov    %rsp,%rbp
+  804192:	41 57                	push   %r15
+  804194:	41 56                	push   %r14
+  804196:	41 55                	push   %r13
+  804198:	41 54                	push   %r12
+  80419a:	53                   	push   %rbx
+  80419b:	48 83 ec 18          	sub    $0x18,%rsp
+  80419f:	41 89 fd             	mov    %edi,%r13d
+  8041a2:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8041a5:	48 89 d3             	mov    %rdx,%rbx
+  8041a8:	49 89 cc             	mov    %rcx,%r12
+  8041ab:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041af:	48 85 d2             	test   %rdx,%rdx
+  8041b2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041b9:	00 00 00 
+  8041bc:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041c0:	49 be 1d 16 80 00 00 	movabs $0x80161d,%r14
+  8041c7:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8041ca:	49 bf 0d 12 80 00 00 	movabs $0x80120d,%r15
+  8041d1:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8041d4:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8041d7:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8041db:	4c 89 e1             	mov    %r12,%rcx
+  8041de:	48 89 da             	mov    %rbx,%rdx
+  8041e1:	44 89 ef             	mov    %r13d,%edi
+  8041e4:	41 ff d6             	call   *%r14
+  8041e7:	85 c0                	test   %eax,%eax
+  8041e9:	74 37                	je     804222 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8041eb:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8041ee:	75 05                	jne    8041f5 <ipc_send+0x67>
+        sys_yield();
+  8041f0:	41 ff d7             	call   *%r15
+  8041f3:	eb df                	jmp    8041d4 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8041f5:	89 c1                	mov    %eax,%ecx
+  8041f7:	48 ba 03 57 80 00 00 	movabs $0x805703,%rdx
+  8041fe:	00 00 00 
+  804201:	be 65 00 00 00       	mov    $0x65,%esi
+  804206:	48 bf 1e 57 80 00 00 	movabs $0x80571e,%rdi
+  80420d:	00 00 00 
+  804210:	b8 00 00 00 00       	mov    $0x0,%eax
+  804215:	49 b8 3b 3f 80 00 00 	movabs $0x803f3b,%r8
+  80421c:	00 00 00 
+  80421f:	41 ff d0             	call   *%r8
+    }
+}
+  804222:	48 83 c4 18          	add    $0x18,%rsp
+  804226:	5b                   	pop    %rbx
+  804227:	41 5c                	pop    %r12
+  804229:	41 5d                	pop    %r13
+  80422b:	41 5e                	pop    %r14
+  80422d:	41 5f                	pop    %r15
+  80422f:	5d                   	pop    %rbp
+  804230:	c3                   	ret
+
+0000000000804231 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804231:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804236:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80423d:	00 00 00 
+  804240:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804247:	48 01 ca             	add    %rcx,%rdx
+  80424a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804250:	39 fa                	cmp    %edi,%edx
+  804252:	74 12                	je     804266 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804254:	48 83 c0 01          	add    $0x1,%rax
+  804258:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80425e:	75 e0                	jne    804240 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804260:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804265:	c3                   	ret
+            return envs[i].env_id;
+  804266:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80426d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804274:	00 00 00 
+  804277:	48 01 d0             	add    %rdx,%rax
+  80427a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804280:	c3                   	ret
+
+0000000000804281 <__text_end>:
+  804281:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804288:	00 00 00 
+  80428b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804292:	00 00 00 
+  804295:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80429c:	00 00 00 
+  80429f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042a6:	00 00 00 
+  8042a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042b0:	00 00 00 
+  8042b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ba:	00 00 00 
+  8042bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042c4:	00 00 00 
+  8042c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ce:	00 00 00 
+  8042d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042d8:	00 00 00 
+  8042db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042e2:	00 00 00 
+  8042e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042ec:	00 00 00 
+  8042ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8042f6:	00 00 00 
+  8042f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804300:	00 00 00 
+  804303:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80430a:	00 00 00 
+  80430d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804314:	00 00 00 
+  804317:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80431e:	00 00 00 
+  804321:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804328:	00 00 00 
+  80432b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804332:	00 00 00 
+  804335:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80433c:	00 00 00 
+  80433f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804346:	00 00 00 
+  804349:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804350:	00 00 00 
+  804353:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80435a:	00 00 00 
+  80435d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804364:	00 00 00 
+  804367:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80436e:	00 00 00 
+  804371:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804378:	00 00 00 
+  80437b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804382:	00 00 00 
+  804385:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80438c:	00 00 00 
+  80438f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804396:	00 00 00 
+  804399:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a0:	00 00 00 
+  8043a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043aa:	00 00 00 
+  8043ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b4:	00 00 00 
+  8043b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043be:	00 00 00 
+  8043c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c8:	00 00 00 
+  8043cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d2:	00 00 00 
+  8043d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043dc:	00 00 00 
+  8043df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e6:	00 00 00 
+  8043e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f0:	00 00 00 
+  8043f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043fa:	00 00 00 
+  8043fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804404:	00 00 00 
+  804407:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440e:	00 00 00 
+  804411:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804418:	00 00 00 
+  80441b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804422:	00 00 00 
+  804425:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442c:	00 00 00 
+  80442f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804436:	00 00 00 
+  804439:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804440:	00 00 00 
+  804443:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444a:	00 00 00 
+  80444d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804454:	00 00 00 
+  804457:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445e:	00 00 00 
+  804461:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804468:	00 00 00 
+  80446b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804472:	00 00 00 
+  804475:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447c:	00 00 00 
+  80447f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804486:	00 00 00 
+  804489:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804490:	00 00 00 
+  804493:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449a:	00 00 00 
+  80449d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a4:	00 00 00 
+  8044a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ae:	00 00 00 
+  8044b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b8:	00 00 00 
+  8044bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c2:	00 00 00 
+  8044c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cc:	00 00 00 
+  8044cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d6:	00 00 00 
+  8044d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e0:	00 00 00 
+  8044e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ea:	00 00 00 
+  8044ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f4:	00 00 00 
+  8044f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fe:	00 00 00 
+  804501:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804508:	00 00 00 
+  80450b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804512:	00 00 00 
+  804515:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451c:	00 00 00 
+  80451f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804526:	00 00 00 
+  804529:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804530:	00 00 00 
+  804533:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453a:	00 00 00 
+  80453d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804544:	00 00 00 
+  804547:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454e:	00 00 00 
+  804551:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804558:	00 00 00 
+  80455b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804562:	00 00 00 
+  804565:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456c:	00 00 00 
+  80456f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804576:	00 00 00 
+  804579:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804580:	00 00 00 
+  804583:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458a:	00 00 00 
+  80458d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804594:	00 00 00 
+  804597:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459e:	00 00 00 
+  8045a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a8:	00 00 00 
+  8045ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b2:	00 00 00 
+  8045b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bc:	00 00 00 
+  8045bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c6:	00 00 00 
+  8045c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d0:	00 00 00 
+  8045d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045da:	00 00 00 
+  8045dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e4:	00 00 00 
+  8045e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ee:	00 00 00 
+  8045f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f8:	00 00 00 
+  8045fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804602:	00 00 00 
+  804605:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460c:	00 00 00 
+  80460f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804616:	00 00 00 
+  804619:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804620:	00 00 00 
+  804623:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462a:	00 00 00 
+  80462d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804634:	00 00 00 
+  804637:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463e:	00 00 00 
+  804641:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804648:	00 00 00 
+  80464b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804652:	00 00 00 
+  804655:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465c:	00 00 00 
+  80465f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804666:	00 00 00 
+  804669:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804670:	00 00 00 
+  804673:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467a:	00 00 00 
+  80467d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804684:	00 00 00 
+  804687:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468e:	00 00 00 
+  804691:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804698:	00 00 00 
+  80469b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a2:	00 00 00 
+  8046a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ac:	00 00 00 
+  8046af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b6:	00 00 00 
+  8046b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c0:	00 00 00 
+  8046c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ca:	00 00 00 
+  8046cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d4:	00 00 00 
+  8046d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046de:	00 00 00 
+  8046e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e8:	00 00 00 
+  8046eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f2:	00 00 00 
+  8046f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fc:	00 00 00 
+  8046ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804706:	00 00 00 
+  804709:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804710:	00 00 00 
+  804713:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471a:	00 00 00 
+  80471d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804724:	00 00 00 
+  804727:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472e:	00 00 00 
+  804731:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804738:	00 00 00 
+  80473b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804742:	00 00 00 
+  804745:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474c:	00 00 00 
+  80474f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804756:	00 00 00 
+  804759:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804760:	00 00 00 
+  804763:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476a:	00 00 00 
+  80476d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804774:	00 00 00 
+  804777:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477e:	00 00 00 
+  804781:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804788:	00 00 00 
+  80478b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804792:	00 00 00 
+  804795:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479c:	00 00 00 
+  80479f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a6:	00 00 00 
+  8047a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b0:	00 00 00 
+  8047b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ba:	00 00 00 
+  8047bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c4:	00 00 00 
+  8047c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ce:	00 00 00 
+  8047d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d8:	00 00 00 
+  8047db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e2:	00 00 00 
+  8047e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ec:	00 00 00 
+  8047ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f6:	00 00 00 
+  8047f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804800:	00 00 00 
+  804803:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480a:	00 00 00 
+  80480d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804814:	00 00 00 
+  804817:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481e:	00 00 00 
+  804821:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804828:	00 00 00 
+  80482b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804832:	00 00 00 
+  804835:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483c:	00 00 00 
+  80483f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804846:	00 00 00 
+  804849:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804850:	00 00 00 
+  804853:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485a:	00 00 00 
+  80485d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804864:	00 00 00 
+  804867:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486e:	00 00 00 
+  804871:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804878:	00 00 00 
+  80487b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804882:	00 00 00 
+  804885:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488c:	00 00 00 
+  80488f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804896:	00 00 00 
+  804899:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a0:	00 00 00 
+  8048a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048aa:	00 00 00 
+  8048ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b4:	00 00 00 
+  8048b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048be:	00 00 00 
+  8048c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c8:	00 00 00 
+  8048cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d2:	00 00 00 
+  8048d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dc:	00 00 00 
+  8048df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e6:	00 00 00 
+  8048e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f0:	00 00 00 
+  8048f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fa:	00 00 00 
+  8048fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804904:	00 00 00 
+  804907:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490e:	00 00 00 
+  804911:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804918:	00 00 00 
+  80491b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804922:	00 00 00 
+  804925:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492c:	00 00 00 
+  80492f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804936:	00 00 00 
+  804939:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804940:	00 00 00 
+  804943:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494a:	00 00 00 
+  80494d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804954:	00 00 00 
+  804957:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495e:	00 00 00 
+  804961:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804968:	00 00 00 
+  80496b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804972:	00 00 00 
+  804975:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497c:	00 00 00 
+  80497f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804986:	00 00 00 
+  804989:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804990:	00 00 00 
+  804993:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499a:	00 00 00 
+  80499d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a4:	00 00 00 
+  8049a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ae:	00 00 00 
+  8049b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b8:	00 00 00 
+  8049bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c2:	00 00 00 
+  8049c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cc:	00 00 00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e0:	00 00 00 
+  8049e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ea:	00 00 00 
+  8049ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f4:	00 00 00 
+  8049f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fe:	00 00 00 
+  804a01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a08:	00 00 00 
+  804a0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a12:	00 00 00 
+  804a15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1c:	00 00 00 
+  804a1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a26:	00 00 00 
+  804a29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a30:	00 00 00 
+  804a33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3a:	00 00 00 
+  804a3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a44:	00 00 00 
+  804a47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4e:	00 00 00 
+  804a51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a58:	00 00 00 
+  804a5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a62:	00 00 00 
+  804a65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6c:	00 00 00 
+  804a6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a76:	00 00 00 
+  804a79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a80:	00 00 00 
+  804a83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8a:	00 00 00 
+  804a8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a94:	00 00 00 
+  804a97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9e:	00 00 00 
+  804aa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa8:	00 00 00 
+  804aab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab2:	00 00 00 
+  804ab5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abc:	00 00 00 
+  804abf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac6:	00 00 00 
+  804ac9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad0:	00 00 00 
+  804ad3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ada:	00 00 00 
+  804add:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae4:	00 00 00 
+  804ae7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aee:	00 00 00 
+  804af1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af8:	00 00 00 
+  804afb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b02:	00 00 00 
+  804b05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0c:	00 00 00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b20:	00 00 00 
+  804b23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2a:	00 00 00 
+  804b2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b34:	00 00 00 
+  804b37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3e:	00 00 00 
+  804b41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b48:	00 00 00 
+  804b4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b52:	00 00 00 
+  804b55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5c:	00 00 00 
+  804b5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b66:	00 00 00 
+  804b69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b70:	00 00 00 
+  804b73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7a:	00 00 00 
+  804b7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b84:	00 00 00 
+  804b87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8e:	00 00 00 
+  804b91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b98:	00 00 00 
+  804b9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba2:	00 00 00 
+  804ba5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bac:	00 00 00 
+  804baf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb6:	00 00 00 
+  804bb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc0:	00 00 00 
+  804bc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bca:	00 00 00 
+  804bcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd4:	00 00 00 
+  804bd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bde:	00 00 00 
+  804be1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be8:	00 00 00 
+  804beb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf2:	00 00 00 
+  804bf5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfc:	00 00 00 
+  804bff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c06:	00 00 00 
+  804c09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c10:	00 00 00 
+  804c13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1a:	00 00 00 
+  804c1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c24:	00 00 00 
+  804c27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2e:	00 00 00 
+  804c31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c38:	00 00 00 
+  804c3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c42:	00 00 00 
+  804c45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4c:	00 00 00 
+  804c4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c56:	00 00 00 
+  804c59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c60:	00 00 00 
+  804c63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6a:	00 00 00 
+  804c6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c74:	00 00 00 
+  804c77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7e:	00 00 00 
+  804c81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c88:	00 00 00 
+  804c8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c92:	00 00 00 
+  804c95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9c:	00 00 00 
+  804c9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca6:	00 00 00 
+  804ca9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb0:	00 00 00 
+  804cb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cba:	00 00 00 
+  804cbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc4:	00 00 00 
+  804cc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cce:	00 00 00 
+  804cd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd8:	00 00 00 
+  804cdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce2:	00 00 00 
+  804ce5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cec:	00 00 00 
+  804cef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf6:	00 00 00 
+  804cf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d00:	00 00 00 
+  804d03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0a:	00 00 00 
+  804d0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d14:	00 00 00 
+  804d17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1e:	00 00 00 
+  804d21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d28:	00 00 00 
+  804d2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d32:	00 00 00 
+  804d35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3c:	00 00 00 
+  804d3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d46:	00 00 00 
+  804d49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d50:	00 00 00 
+  804d53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5a:	00 00 00 
+  804d5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d64:	00 00 00 
+  804d67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6e:	00 00 00 
+  804d71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d78:	00 00 00 
+  804d7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d82:	00 00 00 
+  804d85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8c:	00 00 00 
+  804d8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d96:	00 00 00 
+  804d99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da0:	00 00 00 
+  804da3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804daa:	00 00 00 
+  804dad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db4:	00 00 00 
+  804db7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbe:	00 00 00 
+  804dc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc8:	00 00 00 
+  804dcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd2:	00 00 00 
+  804dd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddc:	00 00 00 
+  804ddf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de6:	00 00 00 
+  804de9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df0:	00 00 00 
+  804df3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfa:	00 00 00 
+  804dfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e04:	00 00 00 
+  804e07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0e:	00 00 00 
+  804e11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e18:	00 00 00 
+  804e1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e22:	00 00 00 
+  804e25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2c:	00 00 00 
+  804e2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e36:	00 00 00 
+  804e39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e40:	00 00 00 
+  804e43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4a:	00 00 00 
+  804e4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e54:	00 00 00 
+  804e57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5e:	00 00 00 
+  804e61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e68:	00 00 00 
+  804e6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e72:	00 00 00 
+  804e75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7c:	00 00 00 
+  804e7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e86:	00 00 00 
+  804e89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e90:	00 00 00 
+  804e93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9a:	00 00 00 
+  804e9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea4:	00 00 00 
+  804ea7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eae:	00 00 00 
+  804eb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb8:	00 00 00 
+  804ebb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec2:	00 00 00 
+  804ec5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecc:	00 00 00 
+  804ecf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed6:	00 00 00 
+  804ed9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee0:	00 00 00 
+  804ee3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eea:	00 00 00 
+  804eed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef4:	00 00 00 
+  804ef7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efe:	00 00 00 
+  804f01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f08:	00 00 00 
+  804f0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f12:	00 00 00 
+  804f15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1c:	00 00 00 
+  804f1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f26:	00 00 00 
+  804f29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f30:	00 00 00 
+  804f33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3a:	00 00 00 
+  804f3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f44:	00 00 00 
+  804f47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4e:	00 00 00 
+  804f51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f58:	00 00 00 
+  804f5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f62:	00 00 00 
+  804f65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6c:	00 00 00 
+  804f6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f76:	00 00 00 
+  804f79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f80:	00 00 00 
+  804f83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8a:	00 00 00 
+  804f8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f94:	00 00 00 
+  804f97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9e:	00 00 00 
+  804fa1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa8:	00 00 00 
+  804fab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb2:	00 00 00 
+  804fb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbc:	00 00 00 
+  804fbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc6:	00 00 00 
+  804fc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd0:	00 00 00 
+  804fd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fda:	00 00 00 
+  804fdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe4:	00 00 00 
+  804fe7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fee:	00 00 00 
+  804ff1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff8:	00 00 00 
+  804ffb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
@@ -0,0 +1,8334 @@
+
+obj/user/spawnhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 87 00 00 00       	call   8000aa <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+    cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800029:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  800030:	00 00 00 
+  800033:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800039:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800040:	00 00 00 
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	48 ba c6 02 80 00 00 	movabs $0x8002c6,%rdx
+  80004f:	00 00 00 
+  800052:	ff d2                	call   *%rdx
+    if ((r = spawnl("hello", "hello", 0)) < 0)
+  800054:	ba 00 00 00 00       	mov    $0x0,%edx
+  800059:	48 bf 1e 50 80 00 00 	movabs $0x80501e,%rdi
+  800060:	00 00 00 
+  800063:	48 89 fe             	mov    %rdi,%rsi
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	48 b9 49 3d 80 00 00 	movabs $0x803d49,%rcx
+  800072:	00 00 00 
+  800075:	ff d1                	call   *%rcx
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 02                	js     80007d <umain+0x58>
+        panic("spawn(hello) failed: %i", r);
+}
+  80007b:	5d                   	pop    %rbp
+  80007c:	c3                   	ret
+        panic("spawn(hello) failed: %i", r);
+  80007d:	89 c1                	mov    %eax,%ecx
+  80007f:	48 ba 24 50 80 00 00 	movabs $0x805024,%rdx
+  800086:	00 00 00 
+  800089:	be 08 00 00 00       	mov    $0x8,%esi
+  80008e:	48 bf 3c 50 80 00 00 	movabs $0x80503c,%rdi
+  800095:	00 00 00 
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  8000a4:	00 00 00 
+  8000a7:	41 ff d0             	call   *%r8
+
+00000000008000aa <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000aa:	55                   	push   %rbp
+  8000ab:	48 89 e5             	mov    %rsp,%rbp
+  8000ae:	41 56                	push   %r14
+  8000b0:	41 55                	push   %r13
+  8000b2:	41 54                	push   %r12
+  8000b4:	53                   	push   %rbx
+  8000b5:	41 89 fd             	mov    %edi,%r13d
+  8000b8:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000bb:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8000c2:	00 00 00 
+  8000c5:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8000cc:	00 00 00 
+  8000cf:	48 39 c2             	cmp    %rax,%rdx
+  8000d2:	73 17                	jae    8000eb <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8000d4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000d7:	49 89 c4             	mov    %rax,%r12
+  8000da:	48 83 c3 08          	add    $0x8,%rbx
+  8000de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e3:	ff 53 f8             	call   *-0x8(%rbx)
+  8000e6:	4c 39 e3             	cmp    %r12,%rbx
+  8000e9:	72 ef                	jb     8000da <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000eb:	48 b8 de 12 80 00 00 	movabs $0x8012de,%rax
+  8000f2:	00 00 00 
+  8000f5:	ff d0                	call   *%rax
+  8000f7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000fc:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800103:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80010a:	00 00 00 
+  80010d:	48 01 d0             	add    %rdx,%rax
+  800110:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800117:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80011a:	45 85 ed             	test   %r13d,%r13d
+  80011d:	7e 0d                	jle    80012c <libmain+0x82>
+  80011f:	49 8b 06             	mov    (%r14),%rax
+  800122:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800129:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80012c:	4c 89 f6             	mov    %r14,%rsi
+  80012f:	44 89 ef             	mov    %r13d,%edi
+  800132:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800139:	00 00 00 
+  80013c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80013e:	48 b8 53 01 80 00 00 	movabs $0x800153,%rax
+  800145:	00 00 00 
+  800148:	ff d0                	call   *%rax
+#endif
+}
+  80014a:	5b                   	pop    %rbx
+  80014b:	41 5c                	pop    %r12
+  80014d:	41 5d                	pop    %r13
+  80014f:	41 5e                	pop    %r14
+  800151:	5d                   	pop    %rbp
+  800152:	c3                   	ret
+
+0000000000800153 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800153:	55                   	push   %rbp
+  800154:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800157:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  80015e:	00 00 00 
+  800161:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800163:	bf 00 00 00 00       	mov    $0x0,%edi
+  800168:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+}
+  800174:	5d                   	pop    %rbp
+  800175:	c3                   	ret
+
+0000000000800176 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800176:	55                   	push   %rbp
+  800177:	48 89 e5             	mov    %rsp,%rbp
+  80017a:	41 56                	push   %r14
+  80017c:	41 55                	push   %r13
+  80017e:	41 54                	push   %r12
+  800180:	53                   	push   %rbx
+  800181:	48 83 ec 50          	sub    $0x50,%rsp
+  800185:	49 89 fc             	mov    %rdi,%r12
+  800188:	41 89 f5             	mov    %esi,%r13d
+  80018b:	48 89 d3             	mov    %rdx,%rbx
+  80018e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800192:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800196:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80019a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8001a1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001a5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8001a9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8001ad:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001b1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8001b8:	00 00 00 
+  8001bb:	4c 8b 30             	mov    (%rax),%r14
+  8001be:	48 b8 de 12 80 00 00 	movabs $0x8012de,%rax
+  8001c5:	00 00 00 
+  8001c8:	ff d0                	call   *%rax
+  8001ca:	89 c6                	mov    %eax,%esi
+  8001cc:	45 89 e8             	mov    %r13d,%r8d
+  8001cf:	4c 89 e1             	mov    %r12,%rcx
+  8001d2:	4c 89 f2             	mov    %r14,%rdx
+  8001d5:	48 bf 58 50 80 00 00 	movabs $0x805058,%rdi
+  8001dc:	00 00 00 
+  8001df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e4:	49 bc c6 02 80 00 00 	movabs $0x8002c6,%r12
+  8001eb:	00 00 00 
+  8001ee:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8001f1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8001f5:	48 89 df             	mov    %rbx,%rdi
+  8001f8:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  8001ff:	00 00 00 
+  800202:	ff d0                	call   *%rax
+    cprintf("\n");
+  800204:	48 bf a3 56 80 00 00 	movabs $0x8056a3,%rdi
+  80020b:	00 00 00 
+  80020e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800213:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800216:	cc                   	int3
+  800217:	eb fd                	jmp    800216 <_panic+0xa0>
+
+0000000000800219 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800219:	55                   	push   %rbp
+  80021a:	48 89 e5             	mov    %rsp,%rbp
+  80021d:	53                   	push   %rbx
+  80021e:	48 83 ec 08          	sub    $0x8,%rsp
+  800222:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800225:	8b 06                	mov    (%rsi),%eax
+  800227:	8d 50 01             	lea    0x1(%rax),%edx
+  80022a:	89 16                	mov    %edx,(%rsi)
+  80022c:	48 98                	cltq
+  80022e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800233:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800239:	74 0a                	je     800245 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80023b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80023f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800243:	c9                   	leave
+  800244:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800245:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800249:	be ff 00 00 00       	mov    $0xff,%esi
+  80024e:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  800255:	00 00 00 
+  800258:	ff d0                	call   *%rax
+        state->offset = 0;
+  80025a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800260:	eb d9                	jmp    80023b <putch+0x22>
+
+0000000000800262 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800262:	55                   	push   %rbp
+  800263:	48 89 e5             	mov    %rsp,%rbp
+  800266:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80026d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800270:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800277:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80027c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800281:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800284:	48 89 f1             	mov    %rsi,%rcx
+  800287:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80028e:	48 bf 19 02 80 00 00 	movabs $0x800219,%rdi
+  800295:	00 00 00 
+  800298:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  80029f:	00 00 00 
+  8002a2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002a4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002ab:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002b2:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  8002b9:	00 00 00 
+  8002bc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002be:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+
+00000000008002c6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002c6:	55                   	push   %rbp
+  8002c7:	48 89 e5             	mov    %rsp,%rbp
+  8002ca:	48 83 ec 50          	sub    $0x50,%rsp
+  8002ce:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002d2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002d6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002da:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002de:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002e2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002e9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002f1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002f9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002fd:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  800304:	00 00 00 
+  800307:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+
+000000000080030b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80030b:	55                   	push   %rbp
+  80030c:	48 89 e5             	mov    %rsp,%rbp
+  80030f:	41 57                	push   %r15
+  800311:	41 56                	push   %r14
+  800313:	41 55                	push   %r13
+  800315:	41 54                	push   %r12
+  800317:	53                   	push   %rbx
+  800318:	48 83 ec 18          	sub    $0x18,%rsp
+  80031c:	49 89 fc             	mov    %rdi,%r12
+  80031f:	49 89 f5             	mov    %rsi,%r13
+  800322:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800326:	8b 45 10             	mov    0x10(%rbp),%eax
+  800329:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80032c:	41 89 cf             	mov    %ecx,%r15d
+  80032f:	4c 39 fa             	cmp    %r15,%rdx
+  800332:	73 5b                	jae    80038f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800334:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800338:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80033c:	85 db                	test   %ebx,%ebx
+  80033e:	7e 0e                	jle    80034e <print_num+0x43>
+            putch(padc, put_arg);
+  800340:	4c 89 ee             	mov    %r13,%rsi
+  800343:	44 89 f7             	mov    %r14d,%edi
+  800346:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800349:	83 eb 01             	sub    $0x1,%ebx
+  80034c:	75 f2                	jne    800340 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80034e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800352:	48 b9 8c 50 80 00 00 	movabs $0x80508c,%rcx
+  800359:	00 00 00 
+  80035c:	48 b8 7b 50 80 00 00 	movabs $0x80507b,%rax
+  800363:	00 00 00 
+  800366:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80036a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80036e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800373:	49 f7 f7             	div    %r15
+  800376:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80037a:	4c 89 ee             	mov    %r13,%rsi
+  80037d:	41 ff d4             	call   *%r12
+}
+  800380:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800384:	5b                   	pop    %rbx
+  800385:	41 5c                	pop    %r12
+  800387:	41 5d                	pop    %r13
+  800389:	41 5e                	pop    %r14
+  80038b:	41 5f                	pop    %r15
+  80038d:	5d                   	pop    %rbp
+  80038e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80038f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800393:	ba 00 00 00 00       	mov    $0x0,%edx
+  800398:	49 f7 f7             	div    %r15
+  80039b:	48 83 ec 08          	sub    $0x8,%rsp
+  80039f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003a3:	52                   	push   %rdx
+  8003a4:	45 0f be c9          	movsbl %r9b,%r9d
+  8003a8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003ac:	48 89 c2             	mov    %rax,%rdx
+  8003af:	48 b8 0b 03 80 00 00 	movabs $0x80030b,%rax
+  8003b6:	00 00 00 
+  8003b9:	ff d0                	call   *%rax
+  8003bb:	48 83 c4 10          	add    $0x10,%rsp
+  8003bf:	eb 8d                	jmp    80034e <print_num+0x43>
+
+00000000008003c1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003c1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003c5:	48 8b 06             	mov    (%rsi),%rax
+  8003c8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003cc:	73 0a                	jae    8003d8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003ce:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003d2:	48 89 16             	mov    %rdx,(%rsi)
+  8003d5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003d8:	c3                   	ret
+
+00000000008003d9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003d9:	55                   	push   %rbp
+  8003da:	48 89 e5             	mov    %rsp,%rbp
+  8003dd:	48 83 ec 50          	sub    $0x50,%rsp
+  8003e1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003e5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003e9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003ed:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003f4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003fc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800400:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800404:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800408:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  80040f:	00 00 00 
+  800412:	ff d0                	call   *%rax
+}
+  800414:	c9                   	leave
+  800415:	c3                   	ret
+
+0000000000800416 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800416:	55                   	push   %rbp
+  800417:	48 89 e5             	mov    %rsp,%rbp
+  80041a:	41 57                	push   %r15
+  80041c:	41 56                	push   %r14
+  80041e:	41 55                	push   %r13
+  800420:	41 54                	push   %r12
+  800422:	53                   	push   %rbx
+  800423:	48 83 ec 38          	sub    $0x38,%rsp
+  800427:	49 89 fe             	mov    %rdi,%r14
+  80042a:	49 89 f5             	mov    %rsi,%r13
+  80042d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800430:	48 8b 01             	mov    (%rcx),%rax
+  800433:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800437:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80043b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80043f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800443:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800447:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80044b:	0f b6 3b             	movzbl (%rbx),%edi
+  80044e:	40 80 ff 25          	cmp    $0x25,%dil
+  800452:	74 18                	je     80046c <vprintfmt+0x56>
+            if (!ch) return;
+  800454:	40 84 ff             	test   %dil,%dil
+  800457:	0f 84 04 07 00 00    	je     800b61 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80045d:	40 0f b6 ff          	movzbl %dil,%edi
+  800461:	4c 89 ee             	mov    %r13,%rsi
+  800464:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800467:	4c 89 e3             	mov    %r12,%rbx
+  80046a:	eb db                	jmp    800447 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80046c:	be 00 00 00 00       	mov    $0x0,%esi
+  800471:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800475:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80047a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800480:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800487:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80048b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800490:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800495:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800498:	83 e8 23             	sub    $0x23,%eax
+  80049b:	3c 57                	cmp    $0x57,%al
+  80049d:	0f 87 a4 06 00 00    	ja     800b47 <vprintfmt+0x731>
+  8004a3:	0f b6 c0             	movzbl %al,%eax
+  8004a6:	48 b9 20 52 80 00 00 	movabs $0x805220,%rcx
+  8004ad:	00 00 00 
+  8004b0:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004b3:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004b6:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004ba:	eb cf                	jmp    80048b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004bc:	49 89 dc             	mov    %rbx,%r12
+  8004bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8004c4:	eb c5                	jmp    80048b <vprintfmt+0x75>
+            padc = ch;
+  8004c6:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004ca:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004cd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004d0:	eb b9                	jmp    80048b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8004d8:	77 24                	ja     8004fe <vprintfmt+0xe8>
+  8004da:	89 c1                	mov    %eax,%ecx
+  8004dc:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004e0:	83 c0 08             	add    $0x8,%eax
+  8004e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004e6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004e9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004ec:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004f0:	79 99                	jns    80048b <vprintfmt+0x75>
+                width = precision;
+  8004f2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004f6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004fc:	eb 8d                	jmp    80048b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004fe:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800502:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800506:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80050a:	eb da                	jmp    8004e6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80050c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800511:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800515:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80051b:	3c 39                	cmp    $0x39,%al
+  80051d:	77 1c                	ja     80053b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80051f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800523:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800527:	0f b6 c0             	movzbl %al,%eax
+  80052a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80052f:	0f b6 03             	movzbl (%rbx),%eax
+  800532:	3c 39                	cmp    $0x39,%al
+  800534:	76 e9                	jbe    80051f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800536:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800539:	eb b1                	jmp    8004ec <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80053b:	49 89 dc             	mov    %rbx,%r12
+  80053e:	eb ac                	jmp    8004ec <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800540:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800543:	85 c9                	test   %ecx,%ecx
+  800545:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054a:	0f 49 c1             	cmovns %ecx,%eax
+  80054d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800550:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800553:	e9 33 ff ff ff       	jmp    80048b <vprintfmt+0x75>
+            lflag++;
+  800558:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80055b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80055e:	e9 28 ff ff ff       	jmp    80048b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800563:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800566:	83 f8 2f             	cmp    $0x2f,%eax
+  800569:	77 19                	ja     800584 <vprintfmt+0x16e>
+  80056b:	89 c2                	mov    %eax,%edx
+  80056d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800571:	83 c0 08             	add    $0x8,%eax
+  800574:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800577:	8b 3a                	mov    (%rdx),%edi
+  800579:	4c 89 ee             	mov    %r13,%rsi
+  80057c:	41 ff d6             	call   *%r14
+            break;
+  80057f:	e9 c3 fe ff ff       	jmp    800447 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800584:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800588:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	eb e5                	jmp    800577 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800592:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800595:	83 f8 2f             	cmp    $0x2f,%eax
+  800598:	77 5a                	ja     8005f4 <vprintfmt+0x1de>
+  80059a:	89 c2                	mov    %eax,%edx
+  80059c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005a0:	83 c0 08             	add    $0x8,%eax
+  8005a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005a6:	8b 02                	mov    (%rdx),%eax
+  8005a8:	89 c1                	mov    %eax,%ecx
+  8005aa:	f7 d9                	neg    %ecx
+  8005ac:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005af:	83 f9 13             	cmp    $0x13,%ecx
+  8005b2:	7f 4e                	jg     800602 <vprintfmt+0x1ec>
+  8005b4:	48 63 c1             	movslq %ecx,%rax
+  8005b7:	48 ba e0 54 80 00 00 	movabs $0x8054e0,%rdx
+  8005be:	00 00 00 
+  8005c1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005c5:	48 85 c0             	test   %rax,%rax
+  8005c8:	74 38                	je     800602 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005ca:	48 89 c1             	mov    %rax,%rcx
+  8005cd:	48 ba 8c 57 80 00 00 	movabs $0x80578c,%rdx
+  8005d4:	00 00 00 
+  8005d7:	4c 89 ee             	mov    %r13,%rsi
+  8005da:	4c 89 f7             	mov    %r14,%rdi
+  8005dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e2:	49 b8 d9 03 80 00 00 	movabs $0x8003d9,%r8
+  8005e9:	00 00 00 
+  8005ec:	41 ff d0             	call   *%r8
+  8005ef:	e9 53 fe ff ff       	jmp    800447 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800600:	eb a4                	jmp    8005a6 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800602:	48 ba a4 50 80 00 00 	movabs $0x8050a4,%rdx
+  800609:	00 00 00 
+  80060c:	4c 89 ee             	mov    %r13,%rsi
+  80060f:	4c 89 f7             	mov    %r14,%rdi
+  800612:	b8 00 00 00 00       	mov    $0x0,%eax
+  800617:	49 b8 d9 03 80 00 00 	movabs $0x8003d9,%r8
+  80061e:	00 00 00 
+  800621:	41 ff d0             	call   *%r8
+  800624:	e9 1e fe ff ff       	jmp    800447 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800629:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80062c:	83 f8 2f             	cmp    $0x2f,%eax
+  80062f:	77 36                	ja     800667 <vprintfmt+0x251>
+  800631:	89 c2                	mov    %eax,%edx
+  800633:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800637:	83 c0 08             	add    $0x8,%eax
+  80063a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80063d:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800640:	48 85 f6             	test   %rsi,%rsi
+  800643:	48 b8 9d 50 80 00 00 	movabs $0x80509d,%rax
+  80064a:	00 00 00 
+  80064d:	48 0f 45 c6          	cmovne %rsi,%rax
+  800651:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800655:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800659:	7e 06                	jle    800661 <vprintfmt+0x24b>
+  80065b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80065f:	75 14                	jne    800675 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800661:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800665:	eb 5b                	jmp    8006c2 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800667:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80066b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80066f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800673:	eb c8                	jmp    80063d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800675:	49 63 f7             	movslq %r15d,%rsi
+  800678:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80067c:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  800683:	00 00 00 
+  800686:	ff d0                	call   *%rax
+  800688:	48 89 c2             	mov    %rax,%rdx
+  80068b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80068e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800690:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800693:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800696:	85 c0                	test   %eax,%eax
+  800698:	7e c7                	jle    800661 <vprintfmt+0x24b>
+  80069a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80069f:	4c 89 ee             	mov    %r13,%rsi
+  8006a2:	44 89 e7             	mov    %r12d,%edi
+  8006a5:	41 ff d6             	call   *%r14
+  8006a8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006ac:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006af:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006b2:	75 eb                	jne    80069f <vprintfmt+0x289>
+  8006b4:	eb ab                	jmp    800661 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006b6:	0f b6 f8             	movzbl %al,%edi
+  8006b9:	4c 89 ee             	mov    %r13,%rsi
+  8006bc:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8006bf:	4c 89 e2             	mov    %r12,%rdx
+  8006c2:	45 85 ff             	test   %r15d,%r15d
+  8006c5:	78 06                	js     8006cd <vprintfmt+0x2b7>
+  8006c7:	41 83 ef 01          	sub    $0x1,%r15d
+  8006cb:	78 23                	js     8006f0 <vprintfmt+0x2da>
+  8006cd:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8006d1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006d7:	84 c0                	test   %al,%al
+  8006d9:	74 15                	je     8006f0 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006db:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006df:	74 d5                	je     8006b6 <vprintfmt+0x2a0>
+  8006e1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006e4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006e9:	80 fa 5e             	cmp    $0x5e,%dl
+  8006ec:	77 cb                	ja     8006b9 <vprintfmt+0x2a3>
+  8006ee:	eb c6                	jmp    8006b6 <vprintfmt+0x2a0>
+  8006f0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006f3:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8006f6:	01 f0                	add    %esi,%eax
+  8006f8:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8006fa:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006fe:	85 c0                	test   %eax,%eax
+  800700:	0f 8e 41 fd ff ff    	jle    800447 <vprintfmt+0x31>
+  800706:	4c 89 ee             	mov    %r13,%rsi
+  800709:	bf 20 00 00 00       	mov    $0x20,%edi
+  80070e:	41 ff d6             	call   *%r14
+  800711:	41 83 ec 01          	sub    $0x1,%r12d
+  800715:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800719:	75 eb                	jne    800706 <vprintfmt+0x2f0>
+  80071b:	e9 27 fd ff ff       	jmp    800447 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800720:	40 84 f6             	test   %sil,%sil
+  800723:	75 26                	jne    80074b <vprintfmt+0x335>
+    switch (lflag) {
+  800725:	85 d2                	test   %edx,%edx
+  800727:	74 59                	je     800782 <vprintfmt+0x36c>
+  800729:	83 fa 01             	cmp    $0x1,%edx
+  80072c:	74 7b                	je     8007a9 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80072e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800731:	83 f8 2f             	cmp    $0x2f,%eax
+  800734:	0f 87 96 00 00 00    	ja     8007d0 <vprintfmt+0x3ba>
+  80073a:	89 c2                	mov    %eax,%edx
+  80073c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800740:	83 c0 08             	add    $0x8,%eax
+  800743:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800746:	4c 8b 22             	mov    (%rdx),%r12
+  800749:	eb 17                	jmp    800762 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  80074b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074e:	83 f8 2f             	cmp    $0x2f,%eax
+  800751:	77 21                	ja     800774 <vprintfmt+0x35e>
+  800753:	89 c2                	mov    %eax,%edx
+  800755:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800759:	83 c0 08             	add    $0x8,%eax
+  80075c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800762:	4d 85 e4             	test   %r12,%r12
+  800765:	78 7a                	js     8007e1 <vprintfmt+0x3cb>
+            num = i;
+  800767:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80076a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80076f:	e9 b5 02 00 00       	jmp    800a29 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800774:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800778:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80077c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800780:	eb dd                	jmp    80075f <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800782:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800785:	83 f8 2f             	cmp    $0x2f,%eax
+  800788:	77 11                	ja     80079b <vprintfmt+0x385>
+  80078a:	89 c2                	mov    %eax,%edx
+  80078c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800790:	83 c0 08             	add    $0x8,%eax
+  800793:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800796:	4c 63 22             	movslq (%rdx),%r12
+  800799:	eb c7                	jmp    800762 <vprintfmt+0x34c>
+  80079b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a7:	eb ed                	jmp    800796 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8007a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8007af:	77 11                	ja     8007c2 <vprintfmt+0x3ac>
+  8007b1:	89 c2                	mov    %eax,%edx
+  8007b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b7:	83 c0 08             	add    $0x8,%eax
+  8007ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bd:	4c 8b 22             	mov    (%rdx),%r12
+  8007c0:	eb a0                	jmp    800762 <vprintfmt+0x34c>
+  8007c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ce:	eb ed                	jmp    8007bd <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8007d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007dc:	e9 65 ff ff ff       	jmp    800746 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8007e1:	4c 89 ee             	mov    %r13,%rsi
+  8007e4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007e9:	41 ff d6             	call   *%r14
+                i = -i;
+  8007ec:	49 f7 dc             	neg    %r12
+  8007ef:	e9 73 ff ff ff       	jmp    800767 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f4:	40 84 f6             	test   %sil,%sil
+  8007f7:	75 32                	jne    80082b <vprintfmt+0x415>
+    switch (lflag) {
+  8007f9:	85 d2                	test   %edx,%edx
+  8007fb:	74 5d                	je     80085a <vprintfmt+0x444>
+  8007fd:	83 fa 01             	cmp    $0x1,%edx
+  800800:	0f 84 82 00 00 00    	je     800888 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800806:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800809:	83 f8 2f             	cmp    $0x2f,%eax
+  80080c:	0f 87 a5 00 00 00    	ja     8008b7 <vprintfmt+0x4a1>
+  800812:	89 c2                	mov    %eax,%edx
+  800814:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800818:	83 c0 08             	add    $0x8,%eax
+  80081b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800821:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800826:	e9 fe 01 00 00       	jmp    800a29 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80082b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082e:	83 f8 2f             	cmp    $0x2f,%eax
+  800831:	77 19                	ja     80084c <vprintfmt+0x436>
+  800833:	89 c2                	mov    %eax,%edx
+  800835:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800839:	83 c0 08             	add    $0x8,%eax
+  80083c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800842:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800847:	e9 dd 01 00 00       	jmp    800a29 <vprintfmt+0x613>
+  80084c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800850:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800854:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800858:	eb e5                	jmp    80083f <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  80085a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085d:	83 f8 2f             	cmp    $0x2f,%eax
+  800860:	77 18                	ja     80087a <vprintfmt+0x464>
+  800862:	89 c2                	mov    %eax,%edx
+  800864:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800868:	83 c0 08             	add    $0x8,%eax
+  80086b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800870:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800875:	e9 af 01 00 00       	jmp    800a29 <vprintfmt+0x613>
+  80087a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800882:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800886:	eb e6                	jmp    80086e <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800888:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088b:	83 f8 2f             	cmp    $0x2f,%eax
+  80088e:	77 19                	ja     8008a9 <vprintfmt+0x493>
+  800890:	89 c2                	mov    %eax,%edx
+  800892:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800896:	83 c0 08             	add    $0x8,%eax
+  800899:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80089f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008a4:	e9 80 01 00 00       	jmp    800a29 <vprintfmt+0x613>
+  8008a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b5:	eb e5                	jmp    80089c <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8008b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c3:	e9 56 ff ff ff       	jmp    80081e <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c8:	40 84 f6             	test   %sil,%sil
+  8008cb:	75 2e                	jne    8008fb <vprintfmt+0x4e5>
+    switch (lflag) {
+  8008cd:	85 d2                	test   %edx,%edx
+  8008cf:	0f 84 b3 00 00 00    	je     800988 <vprintfmt+0x572>
+  8008d5:	83 fa 01             	cmp    $0x1,%edx
+  8008d8:	0f 84 d3 00 00 00    	je     8009b1 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8008de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e4:	0f 87 f1 00 00 00    	ja     8009db <vprintfmt+0x5c5>
+  8008ea:	89 c2                	mov    %eax,%edx
+  8008ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f0:	83 c0 08             	add    $0x8,%eax
+  8008f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f6:	48 8b 02             	mov    (%rdx),%rax
+  8008f9:	eb 17                	jmp    800912 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8008fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800901:	77 77                	ja     80097a <vprintfmt+0x564>
+  800903:	89 c2                	mov    %eax,%edx
+  800905:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800909:	83 c0 08             	add    $0x8,%eax
+  80090c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090f:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800912:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800914:	83 f8 07             	cmp    $0x7,%eax
+  800917:	0f 8e cf 00 00 00    	jle    8009ec <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  80091d:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800923:	44 89 e7             	mov    %r12d,%edi
+  800926:	41 c1 e4 03          	shl    $0x3,%r12d
+  80092a:	89 d1                	mov    %edx,%ecx
+  80092c:	8d 72 07             	lea    0x7(%rdx),%esi
+  80092f:	85 d2                	test   %edx,%edx
+  800931:	0f 48 d6             	cmovs  %esi,%edx
+  800934:	c1 fa 03             	sar    $0x3,%edx
+  800937:	83 f9 3f             	cmp    $0x3f,%ecx
+  80093a:	7f e7                	jg     800923 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80093c:	85 ff                	test   %edi,%edi
+  80093e:	0f 84 03 fb ff ff    	je     800447 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800944:	49 63 f4             	movslq %r12d,%rsi
+  800947:	ba 00 00 00 00       	mov    $0x0,%edx
+  80094c:	48 f7 f6             	div    %rsi
+  80094f:	49 89 d7             	mov    %rdx,%r15
+  800952:	83 c0 30             	add    $0x30,%eax
+  800955:	0f be f8             	movsbl %al,%edi
+  800958:	4c 89 ee             	mov    %r13,%rsi
+  80095b:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80095e:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800961:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800966:	45 85 e4             	test   %r12d,%r12d
+  800969:	41 0f 49 d4          	cmovns %r12d,%edx
+  80096d:	c1 fa 03             	sar    $0x3,%edx
+  800970:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800973:	75 cf                	jne    800944 <vprintfmt+0x52e>
+  800975:	e9 cd fa ff ff       	jmp    800447 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80097a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800982:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800986:	eb 87                	jmp    80090f <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800988:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098b:	83 f8 2f             	cmp    $0x2f,%eax
+  80098e:	77 13                	ja     8009a3 <vprintfmt+0x58d>
+  800990:	89 c2                	mov    %eax,%edx
+  800992:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800996:	83 c0 08             	add    $0x8,%eax
+  800999:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099c:	8b 02                	mov    (%rdx),%eax
+  80099e:	e9 6f ff ff ff       	jmp    800912 <vprintfmt+0x4fc>
+  8009a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009af:	eb eb                	jmp    80099c <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8009b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b7:	77 14                	ja     8009cd <vprintfmt+0x5b7>
+  8009b9:	89 c2                	mov    %eax,%edx
+  8009bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bf:	83 c0 08             	add    $0x8,%eax
+  8009c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c5:	48 8b 02             	mov    (%rdx),%rax
+  8009c8:	e9 45 ff ff ff       	jmp    800912 <vprintfmt+0x4fc>
+  8009cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d9:	eb ea                	jmp    8009c5 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8009db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e7:	e9 0a ff ff ff       	jmp    8008f6 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8009ec:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8009f2:	e9 4d ff ff ff       	jmp    800944 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  8009f7:	4c 89 ee             	mov    %r13,%rsi
+  8009fa:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009ff:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a02:	4c 89 ee             	mov    %r13,%rsi
+  800a05:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a0a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a10:	83 f8 2f             	cmp    $0x2f,%eax
+  800a13:	77 47                	ja     800a5c <vprintfmt+0x646>
+  800a15:	89 c2                	mov    %eax,%edx
+  800a17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1b:	83 c0 08             	add    $0x8,%eax
+  800a1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a21:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a24:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a29:	48 83 ec 08          	sub    $0x8,%rsp
+  800a2d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a31:	0f 94 c0             	sete   %al
+  800a34:	0f b6 c0             	movzbl %al,%eax
+  800a37:	50                   	push   %rax
+  800a38:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a3d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a41:	4c 89 ee             	mov    %r13,%rsi
+  800a44:	4c 89 f7             	mov    %r14,%rdi
+  800a47:	48 b8 0b 03 80 00 00 	movabs $0x80030b,%rax
+  800a4e:	00 00 00 
+  800a51:	ff d0                	call   *%rax
+            break;
+  800a53:	48 83 c4 10          	add    $0x10,%rsp
+  800a57:	e9 eb f9 ff ff       	jmp    800447 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a68:	eb b7                	jmp    800a21 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6a:	40 84 f6             	test   %sil,%sil
+  800a6d:	75 2b                	jne    800a9a <vprintfmt+0x684>
+    switch (lflag) {
+  800a6f:	85 d2                	test   %edx,%edx
+  800a71:	74 56                	je     800ac9 <vprintfmt+0x6b3>
+  800a73:	83 fa 01             	cmp    $0x1,%edx
+  800a76:	74 7f                	je     800af7 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800a78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7e:	0f 87 a2 00 00 00    	ja     800b26 <vprintfmt+0x710>
+  800a84:	89 c2                	mov    %eax,%edx
+  800a86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8a:	83 c0 08             	add    $0x8,%eax
+  800a8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a90:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a93:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a98:	eb 8f                	jmp    800a29 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9d:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa0:	77 19                	ja     800abb <vprintfmt+0x6a5>
+  800aa2:	89 c2                	mov    %eax,%edx
+  800aa4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa8:	83 c0 08             	add    $0x8,%eax
+  800aab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ab1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ab6:	e9 6e ff ff ff       	jmp    800a29 <vprintfmt+0x613>
+  800abb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac7:	eb e5                	jmp    800aae <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800ac9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acc:	83 f8 2f             	cmp    $0x2f,%eax
+  800acf:	77 18                	ja     800ae9 <vprintfmt+0x6d3>
+  800ad1:	89 c2                	mov    %eax,%edx
+  800ad3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad7:	83 c0 08             	add    $0x8,%eax
+  800ada:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800add:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800adf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ae4:	e9 40 ff ff ff       	jmp    800a29 <vprintfmt+0x613>
+  800ae9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af5:	eb e6                	jmp    800add <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800af7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afa:	83 f8 2f             	cmp    $0x2f,%eax
+  800afd:	77 19                	ja     800b18 <vprintfmt+0x702>
+  800aff:	89 c2                	mov    %eax,%edx
+  800b01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b05:	83 c0 08             	add    $0x8,%eax
+  800b08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b0e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b13:	e9 11 ff ff ff       	jmp    800a29 <vprintfmt+0x613>
+  800b18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b24:	eb e5                	jmp    800b0b <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800b26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b32:	e9 59 ff ff ff       	jmp    800a90 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800b37:	4c 89 ee             	mov    %r13,%rsi
+  800b3a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b3f:	41 ff d6             	call   *%r14
+            break;
+  800b42:	e9 00 f9 ff ff       	jmp    800447 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b47:	4c 89 ee             	mov    %r13,%rsi
+  800b4a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b4f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b52:	48 83 eb 01          	sub    $0x1,%rbx
+  800b56:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b5a:	75 f6                	jne    800b52 <vprintfmt+0x73c>
+  800b5c:	e9 e6 f8 ff ff       	jmp    800447 <vprintfmt+0x31>
+}
+  800b61:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b65:	5b                   	pop    %rbx
+  800b66:	41 5c                	pop    %r12
+  800b68:	41 5d                	pop    %r13
+  800b6a:	41 5e                	pop    %r14
+  800b6c:	41 5f                	pop    %r15
+  800b6e:	5d                   	pop    %rbp
+  800b6f:	c3                   	ret
+
+0000000000800b70 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b70:	55                   	push   %rbp
+  800b71:	48 89 e5             	mov    %rsp,%rbp
+  800b74:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b78:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b7c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b81:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b85:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b8c:	48 85 ff             	test   %rdi,%rdi
+  800b8f:	74 2b                	je     800bbc <vsnprintf+0x4c>
+  800b91:	48 85 f6             	test   %rsi,%rsi
+  800b94:	74 26                	je     800bbc <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b96:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b9a:	48 bf c1 03 80 00 00 	movabs $0x8003c1,%rdi
+  800ba1:	00 00 00 
+  800ba4:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  800bab:	00 00 00 
+  800bae:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bb4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bb7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bba:	c9                   	leave
+  800bbb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bbc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bc1:	eb f7                	jmp    800bba <vsnprintf+0x4a>
+
+0000000000800bc3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bc3:	55                   	push   %rbp
+  800bc4:	48 89 e5             	mov    %rsp,%rbp
+  800bc7:	48 83 ec 50          	sub    $0x50,%rsp
+  800bcb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bcf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bd3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bd7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bde:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800be2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bee:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800bf2:	48 b8 70 0b 80 00 00 	movabs $0x800b70,%rax
+  800bf9:	00 00 00 
+  800bfc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bfe:	c9                   	leave
+  800bff:	c3                   	ret
+
+0000000000800c00 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c00:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c03:	74 10                	je     800c15 <strlen+0x15>
+    size_t n = 0;
+  800c05:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c0a:	48 83 c0 01          	add    $0x1,%rax
+  800c0e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c12:	75 f6                	jne    800c0a <strlen+0xa>
+  800c14:	c3                   	ret
+    size_t n = 0;
+  800c15:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c1a:	c3                   	ret
+
+0000000000800c1b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c1b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c1e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c23:	48 85 f6             	test   %rsi,%rsi
+  800c26:	74 11                	je     800c39 <strnlen+0x1e>
+  800c28:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c2c:	74 0c                	je     800c3a <strnlen+0x1f>
+  800c2e:	48 83 c2 01          	add    $0x1,%rdx
+  800c32:	48 39 d0             	cmp    %rdx,%rax
+  800c35:	75 f1                	jne    800c28 <strnlen+0xd>
+  800c37:	eb 04                	jmp    800c3d <strnlen+0x22>
+  800c39:	c3                   	ret
+  800c3a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c3d:	c3                   	ret
+
+0000000000800c3e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c3e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c46:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c4a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c4d:	48 83 c2 01          	add    $0x1,%rdx
+  800c51:	84 c9                	test   %cl,%cl
+  800c53:	75 f1                	jne    800c46 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c55:	c3                   	ret
+
+0000000000800c56 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c56:	55                   	push   %rbp
+  800c57:	48 89 e5             	mov    %rsp,%rbp
+  800c5a:	41 54                	push   %r12
+  800c5c:	53                   	push   %rbx
+  800c5d:	48 89 fb             	mov    %rdi,%rbx
+  800c60:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c63:	48 b8 00 0c 80 00 00 	movabs $0x800c00,%rax
+  800c6a:	00 00 00 
+  800c6d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c6f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c73:	4c 89 e6             	mov    %r12,%rsi
+  800c76:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  800c7d:	00 00 00 
+  800c80:	ff d0                	call   *%rax
+    return dst;
+}
+  800c82:	48 89 d8             	mov    %rbx,%rax
+  800c85:	5b                   	pop    %rbx
+  800c86:	41 5c                	pop    %r12
+  800c88:	5d                   	pop    %rbp
+  800c89:	c3                   	ret
+
+0000000000800c8a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c8a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c8d:	48 85 d2             	test   %rdx,%rdx
+  800c90:	74 1f                	je     800cb1 <strncpy+0x27>
+  800c92:	48 01 fa             	add    %rdi,%rdx
+  800c95:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c98:	48 83 c1 01          	add    $0x1,%rcx
+  800c9c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ca0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ca4:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ca8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cac:	48 39 ca             	cmp    %rcx,%rdx
+  800caf:	75 e7                	jne    800c98 <strncpy+0xe>
+    }
+    return ret;
+}
+  800cb1:	c3                   	ret
+
+0000000000800cb2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cb2:	48 89 f8             	mov    %rdi,%rax
+  800cb5:	48 85 d2             	test   %rdx,%rdx
+  800cb8:	74 24                	je     800cde <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cba:	48 83 ea 01          	sub    $0x1,%rdx
+  800cbe:	74 1b                	je     800cdb <strlcpy+0x29>
+  800cc0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cc4:	0f b6 16             	movzbl (%rsi),%edx
+  800cc7:	84 d2                	test   %dl,%dl
+  800cc9:	74 10                	je     800cdb <strlcpy+0x29>
+            *dst++ = *src++;
+  800ccb:	48 83 c6 01          	add    $0x1,%rsi
+  800ccf:	48 83 c0 01          	add    $0x1,%rax
+  800cd3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cd6:	48 39 c8             	cmp    %rcx,%rax
+  800cd9:	75 e9                	jne    800cc4 <strlcpy+0x12>
+        *dst = '\0';
+  800cdb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cde:	48 29 f8             	sub    %rdi,%rax
+}
+  800ce1:	c3                   	ret
+
+0000000000800ce2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ce2:	0f b6 07             	movzbl (%rdi),%eax
+  800ce5:	84 c0                	test   %al,%al
+  800ce7:	74 13                	je     800cfc <strcmp+0x1a>
+  800ce9:	38 06                	cmp    %al,(%rsi)
+  800ceb:	75 0f                	jne    800cfc <strcmp+0x1a>
+  800ced:	48 83 c7 01          	add    $0x1,%rdi
+  800cf1:	48 83 c6 01          	add    $0x1,%rsi
+  800cf5:	0f b6 07             	movzbl (%rdi),%eax
+  800cf8:	84 c0                	test   %al,%al
+  800cfa:	75 ed                	jne    800ce9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cfc:	0f b6 c0             	movzbl %al,%eax
+  800cff:	0f b6 16             	movzbl (%rsi),%edx
+  800d02:	29 d0                	sub    %edx,%eax
+}
+  800d04:	c3                   	ret
+
+0000000000800d05 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d05:	48 85 d2             	test   %rdx,%rdx
+  800d08:	74 1f                	je     800d29 <strncmp+0x24>
+  800d0a:	0f b6 07             	movzbl (%rdi),%eax
+  800d0d:	84 c0                	test   %al,%al
+  800d0f:	74 1e                	je     800d2f <strncmp+0x2a>
+  800d11:	3a 06                	cmp    (%rsi),%al
+  800d13:	75 1a                	jne    800d2f <strncmp+0x2a>
+  800d15:	48 83 c7 01          	add    $0x1,%rdi
+  800d19:	48 83 c6 01          	add    $0x1,%rsi
+  800d1d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d21:	75 e7                	jne    800d0a <strncmp+0x5>
+
+    if (!n) return 0;
+  800d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d28:	c3                   	ret
+  800d29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2e:	c3                   	ret
+  800d2f:	48 85 d2             	test   %rdx,%rdx
+  800d32:	74 09                	je     800d3d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d34:	0f b6 07             	movzbl (%rdi),%eax
+  800d37:	0f b6 16             	movzbl (%rsi),%edx
+  800d3a:	29 d0                	sub    %edx,%eax
+  800d3c:	c3                   	ret
+    if (!n) return 0;
+  800d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d42:	c3                   	ret
+
+0000000000800d43 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d43:	0f b6 17             	movzbl (%rdi),%edx
+  800d46:	84 d2                	test   %dl,%dl
+  800d48:	74 18                	je     800d62 <strchr+0x1f>
+        if (*str == c) {
+  800d4a:	0f be d2             	movsbl %dl,%edx
+  800d4d:	39 f2                	cmp    %esi,%edx
+  800d4f:	74 17                	je     800d68 <strchr+0x25>
+    for (; *str; str++) {
+  800d51:	48 83 c7 01          	add    $0x1,%rdi
+  800d55:	0f b6 17             	movzbl (%rdi),%edx
+  800d58:	84 d2                	test   %dl,%dl
+  800d5a:	75 ee                	jne    800d4a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d61:	c3                   	ret
+  800d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d67:	c3                   	ret
+  800d68:	48 89 f8             	mov    %rdi,%rax
+}
+  800d6b:	c3                   	ret
+
+0000000000800d6c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d6c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d6f:	0f b6 17             	movzbl (%rdi),%edx
+  800d72:	84 d2                	test   %dl,%dl
+  800d74:	74 13                	je     800d89 <strfind+0x1d>
+  800d76:	0f be d2             	movsbl %dl,%edx
+  800d79:	39 f2                	cmp    %esi,%edx
+  800d7b:	74 0b                	je     800d88 <strfind+0x1c>
+  800d7d:	48 83 c0 01          	add    $0x1,%rax
+  800d81:	0f b6 10             	movzbl (%rax),%edx
+  800d84:	84 d2                	test   %dl,%dl
+  800d86:	75 ee                	jne    800d76 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d88:	c3                   	ret
+  800d89:	c3                   	ret
+
+0000000000800d8a <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800d8a:	55                   	push   %rbp
+  800d8b:	48 89 e5             	mov    %rsp,%rbp
+  800d8e:	41 57                	push   %r15
+  800d90:	41 56                	push   %r14
+  800d92:	41 55                	push   %r13
+  800d94:	41 54                	push   %r12
+  800d96:	53                   	push   %rbx
+  800d97:	48 83 ec 08          	sub    $0x8,%rsp
+  800d9b:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800d9e:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800da2:	45 84 ed             	test   %r13b,%r13b
+  800da5:	75 12                	jne    800db9 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800da7:	4c 89 f8             	mov    %r15,%rax
+  800daa:	48 83 c4 08          	add    $0x8,%rsp
+  800dae:	5b                   	pop    %rbx
+  800daf:	41 5c                	pop    %r12
+  800db1:	41 5d                	pop    %r13
+  800db3:	41 5e                	pop    %r14
+  800db5:	41 5f                	pop    %r15
+  800db7:	5d                   	pop    %rbp
+  800db8:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800db9:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800dbd:	4c 89 e7             	mov    %r12,%rdi
+  800dc0:	48 b8 00 0c 80 00 00 	movabs $0x800c00,%rax
+  800dc7:	00 00 00 
+  800dca:	ff d0                	call   *%rax
+  800dcc:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800dcf:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800dd3:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800dd7:	49 bf 05 0d 80 00 00 	movabs $0x800d05,%r15
+  800dde:	00 00 00 
+				if ((sc = *s++) == 0)
+  800de1:	84 c0                	test   %al,%al
+  800de3:	75 14                	jne    800df9 <strstr+0x6f>
+					return NULL;
+  800de5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800deb:	eb ba                	jmp    800da7 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800ded:	48 83 c3 01          	add    $0x1,%rbx
+  800df1:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800df5:	84 c0                	test   %al,%al
+  800df7:	74 1b                	je     800e14 <strstr+0x8a>
+			} while (sc != c);
+  800df9:	41 38 c5             	cmp    %al,%r13b
+  800dfc:	75 ef                	jne    800ded <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800dfe:	4c 89 f2             	mov    %r14,%rdx
+  800e01:	4c 89 e6             	mov    %r12,%rsi
+  800e04:	48 89 df             	mov    %rbx,%rdi
+  800e07:	41 ff d7             	call   *%r15
+  800e0a:	85 c0                	test   %eax,%eax
+  800e0c:	75 df                	jne    800ded <strstr+0x63>
+  800e0e:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800e12:	eb 93                	jmp    800da7 <strstr+0x1d>
+					return NULL;
+  800e14:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e1a:	eb 8b                	jmp    800da7 <strstr+0x1d>
+
+0000000000800e1c <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800e1c:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800e1e:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800e21:	8d 57 20             	lea    0x20(%rdi),%edx
+  800e24:	83 f9 1a             	cmp    $0x1a,%ecx
+  800e27:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800e2a:	c3                   	ret
+
+0000000000800e2b <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800e2b:	55                   	push   %rbp
+  800e2c:	48 89 e5             	mov    %rsp,%rbp
+  800e2f:	41 57                	push   %r15
+  800e31:	41 56                	push   %r14
+  800e33:	41 55                	push   %r13
+  800e35:	41 54                	push   %r12
+  800e37:	53                   	push   %rbx
+  800e38:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800e3c:	48 39 f7             	cmp    %rsi,%rdi
+  800e3f:	74 49                	je     800e8a <strcasecmp+0x5f>
+  800e41:	49 89 fd             	mov    %rdi,%r13
+  800e44:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800e47:	49 bf 1c 0e 80 00 00 	movabs $0x800e1c,%r15
+  800e4e:	00 00 00 
+  800e51:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800e56:	41 0f b6 fe          	movzbl %r14b,%edi
+  800e5a:	41 ff d7             	call   *%r15
+  800e5d:	89 c3                	mov    %eax,%ebx
+  800e5f:	49 83 c4 01          	add    $0x1,%r12
+  800e63:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e69:	41 ff d7             	call   *%r15
+  800e6c:	29 c3                	sub    %eax,%ebx
+  800e6e:	75 09                	jne    800e79 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800e70:	49 83 c5 01          	add    $0x1,%r13
+  800e74:	45 84 f6             	test   %r14b,%r14b
+  800e77:	75 d8                	jne    800e51 <strcasecmp+0x26>
+}
+  800e79:	89 d8                	mov    %ebx,%eax
+  800e7b:	48 83 c4 08          	add    $0x8,%rsp
+  800e7f:	5b                   	pop    %rbx
+  800e80:	41 5c                	pop    %r12
+  800e82:	41 5d                	pop    %r13
+  800e84:	41 5e                	pop    %r14
+  800e86:	41 5f                	pop    %r15
+  800e88:	5d                   	pop    %rbp
+  800e89:	c3                   	ret
+        return 0;
+  800e8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e8f:	eb e8                	jmp    800e79 <strcasecmp+0x4e>
+
+0000000000800e91 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800e91:	55                   	push   %rbp
+  800e92:	48 89 e5             	mov    %rsp,%rbp
+  800e95:	41 57                	push   %r15
+  800e97:	41 56                	push   %r14
+  800e99:	41 55                	push   %r13
+  800e9b:	41 54                	push   %r12
+  800e9d:	53                   	push   %rbx
+  800e9e:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800ea2:	48 85 d2             	test   %rdx,%rdx
+  800ea5:	74 4f                	je     800ef6 <strncasecmp+0x65>
+  800ea7:	49 89 fc             	mov    %rdi,%r12
+  800eaa:	49 89 f5             	mov    %rsi,%r13
+  800ead:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800eb1:	49 be 1c 0e 80 00 00 	movabs $0x800e1c,%r14
+  800eb8:	00 00 00 
+  800ebb:	49 83 c4 01          	add    $0x1,%r12
+  800ebf:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800ec5:	41 ff d6             	call   *%r14
+  800ec8:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800eca:	49 83 c5 01          	add    $0x1,%r13
+  800ece:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800ed3:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800ed6:	29 c3                	sub    %eax,%ebx
+  800ed8:	85 c0                	test   %eax,%eax
+  800eda:	74 09                	je     800ee5 <strncasecmp+0x54>
+  800edc:	85 db                	test   %ebx,%ebx
+  800ede:	75 05                	jne    800ee5 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800ee0:	4d 39 fc             	cmp    %r15,%r12
+  800ee3:	75 d6                	jne    800ebb <strncasecmp+0x2a>
+}
+  800ee5:	89 d8                	mov    %ebx,%eax
+  800ee7:	48 83 c4 08          	add    $0x8,%rsp
+  800eeb:	5b                   	pop    %rbx
+  800eec:	41 5c                	pop    %r12
+  800eee:	41 5d                	pop    %r13
+  800ef0:	41 5e                	pop    %r14
+  800ef2:	41 5f                	pop    %r15
+  800ef4:	5d                   	pop    %rbp
+  800ef5:	c3                   	ret
+    int d = 0;
+  800ef6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800efb:	eb e8                	jmp    800ee5 <strncasecmp+0x54>
+
+0000000000800efd <toupper>:
+
+int toupper(int c) {
+  800efd:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800eff:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800f02:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800f05:	83 f9 1a             	cmp    $0x1a,%ecx
+  800f08:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800f0b:	c3                   	ret
+
+0000000000800f0c <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800f0c:	83 ff 20             	cmp    $0x20,%edi
+  800f0f:	0f 94 c0             	sete   %al
+  800f12:	0f b6 c0             	movzbl %al,%eax
+}
+  800f15:	c3                   	ret
+
+0000000000800f16 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800f16:	89 f8                	mov    %edi,%eax
+  800f18:	f7 d8                	neg    %eax
+  800f1a:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800f1d:	c3                   	ret
+
+0000000000800f1e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f1e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f21:	48 89 f8             	mov    %rdi,%rax
+  800f24:	48 f7 d8             	neg    %rax
+  800f27:	83 e0 07             	and    $0x7,%eax
+  800f2a:	49 89 d1             	mov    %rdx,%r9
+  800f2d:	49 29 c1             	sub    %rax,%r9
+  800f30:	78 36                	js     800f68 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f32:	40 0f b6 c6          	movzbl %sil,%eax
+  800f36:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f3d:	01 01 01 
+  800f40:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f44:	40 f6 c7 07          	test   $0x7,%dil
+  800f48:	75 38                	jne    800f82 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f4a:	4c 89 c9             	mov    %r9,%rcx
+  800f4d:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f51:	74 0c                	je     800f5f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f53:	fc                   	cld
+  800f54:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f57:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f5b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f5f:	4d 85 c9             	test   %r9,%r9
+  800f62:	75 45                	jne    800fa9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f64:	4c 89 c0             	mov    %r8,%rax
+  800f67:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f68:	48 85 d2             	test   %rdx,%rdx
+  800f6b:	74 f7                	je     800f64 <memset+0x46>
+  800f6d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f70:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f73:	48 83 c0 01          	add    $0x1,%rax
+  800f77:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f7b:	48 39 c2             	cmp    %rax,%rdx
+  800f7e:	75 f3                	jne    800f73 <memset+0x55>
+  800f80:	eb e2                	jmp    800f64 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f82:	40 f6 c7 01          	test   $0x1,%dil
+  800f86:	74 06                	je     800f8e <memset+0x70>
+  800f88:	88 07                	mov    %al,(%rdi)
+  800f8a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f8e:	40 f6 c7 02          	test   $0x2,%dil
+  800f92:	74 07                	je     800f9b <memset+0x7d>
+  800f94:	66 89 07             	mov    %ax,(%rdi)
+  800f97:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f9b:	40 f6 c7 04          	test   $0x4,%dil
+  800f9f:	74 a9                	je     800f4a <memset+0x2c>
+  800fa1:	89 07                	mov    %eax,(%rdi)
+  800fa3:	48 83 c7 04          	add    $0x4,%rdi
+  800fa7:	eb a1                	jmp    800f4a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fa9:	41 f6 c1 04          	test   $0x4,%r9b
+  800fad:	74 06                	je     800fb5 <memset+0x97>
+  800faf:	89 07                	mov    %eax,(%rdi)
+  800fb1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fb5:	41 f6 c1 02          	test   $0x2,%r9b
+  800fb9:	74 07                	je     800fc2 <memset+0xa4>
+  800fbb:	66 89 07             	mov    %ax,(%rdi)
+  800fbe:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800fc2:	41 f6 c1 01          	test   $0x1,%r9b
+  800fc6:	74 9c                	je     800f64 <memset+0x46>
+  800fc8:	88 07                	mov    %al,(%rdi)
+  800fca:	eb 98                	jmp    800f64 <memset+0x46>
+
+0000000000800fcc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fcc:	48 89 f8             	mov    %rdi,%rax
+  800fcf:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fd2:	48 39 fe             	cmp    %rdi,%rsi
+  800fd5:	73 3b                	jae    801012 <memmove+0x46>
+  800fd7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fdb:	48 39 d7             	cmp    %rdx,%rdi
+  800fde:	73 32                	jae    801012 <memmove+0x46>
+        s += n;
+        d += n;
+  800fe0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fe4:	48 89 d6             	mov    %rdx,%rsi
+  800fe7:	48 09 fe             	or     %rdi,%rsi
+  800fea:	48 09 ce             	or     %rcx,%rsi
+  800fed:	40 f6 c6 07          	test   $0x7,%sil
+  800ff1:	75 12                	jne    801005 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ff3:	48 83 ef 08          	sub    $0x8,%rdi
+  800ff7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ffb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fff:	fd                   	std
+  801000:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801003:	fc                   	cld
+  801004:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801005:	48 83 ef 01          	sub    $0x1,%rdi
+  801009:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80100d:	fd                   	std
+  80100e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801010:	eb f1                	jmp    801003 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801012:	48 89 f2             	mov    %rsi,%rdx
+  801015:	48 09 c2             	or     %rax,%rdx
+  801018:	48 09 ca             	or     %rcx,%rdx
+  80101b:	f6 c2 07             	test   $0x7,%dl
+  80101e:	75 0c                	jne    80102c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801020:	48 c1 e9 03          	shr    $0x3,%rcx
+  801024:	48 89 c7             	mov    %rax,%rdi
+  801027:	fc                   	cld
+  801028:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80102b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80102c:	48 89 c7             	mov    %rax,%rdi
+  80102f:	fc                   	cld
+  801030:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801032:	c3                   	ret
+
+0000000000801033 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801033:	55                   	push   %rbp
+  801034:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801037:	48 b8 cc 0f 80 00 00 	movabs $0x800fcc,%rax
+  80103e:	00 00 00 
+  801041:	ff d0                	call   *%rax
+}
+  801043:	5d                   	pop    %rbp
+  801044:	c3                   	ret
+
+0000000000801045 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801045:	55                   	push   %rbp
+  801046:	48 89 e5             	mov    %rsp,%rbp
+  801049:	41 57                	push   %r15
+  80104b:	41 56                	push   %r14
+  80104d:	41 55                	push   %r13
+  80104f:	41 54                	push   %r12
+  801051:	53                   	push   %rbx
+  801052:	48 83 ec 08          	sub    $0x8,%rsp
+  801056:	49 89 fe             	mov    %rdi,%r14
+  801059:	49 89 f7             	mov    %rsi,%r15
+  80105c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80105f:	48 89 f7             	mov    %rsi,%rdi
+  801062:	48 b8 00 0c 80 00 00 	movabs $0x800c00,%rax
+  801069:	00 00 00 
+  80106c:	ff d0                	call   *%rax
+  80106e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801071:	48 89 de             	mov    %rbx,%rsi
+  801074:	4c 89 f7             	mov    %r14,%rdi
+  801077:	48 b8 1b 0c 80 00 00 	movabs $0x800c1b,%rax
+  80107e:	00 00 00 
+  801081:	ff d0                	call   *%rax
+  801083:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801086:	48 39 c3             	cmp    %rax,%rbx
+  801089:	74 36                	je     8010c1 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80108b:	48 89 d8             	mov    %rbx,%rax
+  80108e:	4c 29 e8             	sub    %r13,%rax
+  801091:	49 39 c4             	cmp    %rax,%r12
+  801094:	73 31                	jae    8010c7 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801096:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80109b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80109f:	4c 89 fe             	mov    %r15,%rsi
+  8010a2:	48 b8 33 10 80 00 00 	movabs $0x801033,%rax
+  8010a9:	00 00 00 
+  8010ac:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8010ae:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8010b2:	48 83 c4 08          	add    $0x8,%rsp
+  8010b6:	5b                   	pop    %rbx
+  8010b7:	41 5c                	pop    %r12
+  8010b9:	41 5d                	pop    %r13
+  8010bb:	41 5e                	pop    %r14
+  8010bd:	41 5f                	pop    %r15
+  8010bf:	5d                   	pop    %rbp
+  8010c0:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010c1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010c5:	eb eb                	jmp    8010b2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010c7:	48 83 eb 01          	sub    $0x1,%rbx
+  8010cb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010cf:	48 89 da             	mov    %rbx,%rdx
+  8010d2:	4c 89 fe             	mov    %r15,%rsi
+  8010d5:	48 b8 33 10 80 00 00 	movabs $0x801033,%rax
+  8010dc:	00 00 00 
+  8010df:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010e1:	49 01 de             	add    %rbx,%r14
+  8010e4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010e9:	eb c3                	jmp    8010ae <strlcat+0x69>
+
+00000000008010eb <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010eb:	48 85 d2             	test   %rdx,%rdx
+  8010ee:	74 2d                	je     80111d <memcmp+0x32>
+  8010f0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010f5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010f9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010fe:	44 38 c1             	cmp    %r8b,%cl
+  801101:	75 0f                	jne    801112 <memcmp+0x27>
+    while (n-- > 0) {
+  801103:	48 83 c0 01          	add    $0x1,%rax
+  801107:	48 39 c2             	cmp    %rax,%rdx
+  80110a:	75 e9                	jne    8010f5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80110c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801111:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801112:	0f b6 c1             	movzbl %cl,%eax
+  801115:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801119:	44 29 c0             	sub    %r8d,%eax
+  80111c:	c3                   	ret
+    return 0;
+  80111d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801122:	c3                   	ret
+
+0000000000801123 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801123:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801127:	48 39 c7             	cmp    %rax,%rdi
+  80112a:	73 0f                	jae    80113b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80112c:	40 38 37             	cmp    %sil,(%rdi)
+  80112f:	74 0e                	je     80113f <memfind+0x1c>
+    for (; src < end; src++) {
+  801131:	48 83 c7 01          	add    $0x1,%rdi
+  801135:	48 39 f8             	cmp    %rdi,%rax
+  801138:	75 f2                	jne    80112c <memfind+0x9>
+  80113a:	c3                   	ret
+  80113b:	48 89 f8             	mov    %rdi,%rax
+  80113e:	c3                   	ret
+  80113f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801142:	c3                   	ret
+
+0000000000801143 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801143:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801146:	0f b6 37             	movzbl (%rdi),%esi
+  801149:	40 80 fe 20          	cmp    $0x20,%sil
+  80114d:	74 06                	je     801155 <strtol+0x12>
+  80114f:	40 80 fe 09          	cmp    $0x9,%sil
+  801153:	75 13                	jne    801168 <strtol+0x25>
+  801155:	48 83 c7 01          	add    $0x1,%rdi
+  801159:	0f b6 37             	movzbl (%rdi),%esi
+  80115c:	40 80 fe 20          	cmp    $0x20,%sil
+  801160:	74 f3                	je     801155 <strtol+0x12>
+  801162:	40 80 fe 09          	cmp    $0x9,%sil
+  801166:	74 ed                	je     801155 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801168:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80116b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80116e:	3c 01                	cmp    $0x1,%al
+  801170:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801174:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80117a:	75 0f                	jne    80118b <strtol+0x48>
+  80117c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80117f:	74 14                	je     801195 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801181:	85 d2                	test   %edx,%edx
+  801183:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801188:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80118b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801190:	4c 63 ca             	movslq %edx,%r9
+  801193:	eb 36                	jmp    8011cb <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801195:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801199:	74 0f                	je     8011aa <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80119b:	85 d2                	test   %edx,%edx
+  80119d:	75 ec                	jne    80118b <strtol+0x48>
+        s++;
+  80119f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011a3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8011a8:	eb e1                	jmp    80118b <strtol+0x48>
+        s += 2;
+  8011aa:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8011ae:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8011b3:	eb d6                	jmp    80118b <strtol+0x48>
+            dig -= '0';
+  8011b5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011b8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011bc:	41 39 d0             	cmp    %edx,%r8d
+  8011bf:	7d 21                	jge    8011e2 <strtol+0x9f>
+        val = val * base + dig;
+  8011c1:	49 0f af c1          	imul   %r9,%rax
+  8011c5:	0f b6 c9             	movzbl %cl,%ecx
+  8011c8:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011cb:	48 83 c7 01          	add    $0x1,%rdi
+  8011cf:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011d3:	80 f9 39             	cmp    $0x39,%cl
+  8011d6:	76 dd                	jbe    8011b5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011d8:	80 f9 7b             	cmp    $0x7b,%cl
+  8011db:	77 05                	ja     8011e2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011dd:	83 e9 57             	sub    $0x57,%ecx
+  8011e0:	eb d6                	jmp    8011b8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011e2:	4d 85 d2             	test   %r10,%r10
+  8011e5:	74 03                	je     8011ea <strtol+0xa7>
+  8011e7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011ea:	48 89 c2             	mov    %rax,%rdx
+  8011ed:	48 f7 da             	neg    %rdx
+  8011f0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011f4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011f8:	c3                   	ret
+
+00000000008011f9 <atoi>:
+int atoi(const char *str) {
+  8011f9:	55                   	push   %rbp
+  8011fa:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8011fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801202:	be 00 00 00 00       	mov    $0x0,%esi
+  801207:	48 b8 43 11 80 00 00 	movabs $0x801143,%rax
+  80120e:	00 00 00 
+  801211:	ff d0                	call   *%rax
+}
+  801213:	5d                   	pop    %rbp
+  801214:	c3                   	ret
+
+0000000000801215 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801215:	55                   	push   %rbp
+  801216:	48 89 e5             	mov    %rsp,%rbp
+  801219:	53                   	push   %rbx
+  80121a:	48 89 fa             	mov    %rdi,%rdx
+  80121d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801220:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801225:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122f:	be 00 00 00 00       	mov    $0x0,%esi
+  801234:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80123c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801240:	c9                   	leave
+  801241:	c3                   	ret
+
+0000000000801242 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801242:	55                   	push   %rbp
+  801243:	48 89 e5             	mov    %rsp,%rbp
+  801246:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801247:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801251:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801256:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801260:	be 00 00 00 00       	mov    $0x0,%esi
+  801265:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80126b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80126d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801271:	c9                   	leave
+  801272:	c3                   	ret
+
+0000000000801273 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801273:	55                   	push   %rbp
+  801274:	48 89 e5             	mov    %rsp,%rbp
+  801277:	53                   	push   %rbx
+  801278:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80127c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80127f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801284:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801289:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801293:	be 00 00 00 00       	mov    $0x0,%esi
+  801298:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012a0:	48 85 c0             	test   %rax,%rax
+  8012a3:	7f 06                	jg     8012ab <sys_env_destroy+0x38>
+}
+  8012a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a9:	c9                   	leave
+  8012aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ab:	49 89 c0             	mov    %rax,%r8
+  8012ae:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012b3:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8012ba:	00 00 00 
+  8012bd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8012c2:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8012c9:	00 00 00 
+  8012cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d1:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8012d8:	00 00 00 
+  8012db:	41 ff d1             	call   *%r9
+
+00000000008012de <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012de:	55                   	push   %rbp
+  8012df:	48 89 e5             	mov    %rsp,%rbp
+  8012e2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801301:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801307:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+
+000000000080130f <sys_yield>:
+
+void
+sys_yield(void) {
+  80130f:	55                   	push   %rbp
+  801310:	48 89 e5             	mov    %rsp,%rbp
+  801313:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801314:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801319:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801323:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801328:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132d:	be 00 00 00 00       	mov    $0x0,%esi
+  801332:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801338:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80133a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133e:	c9                   	leave
+  80133f:	c3                   	ret
+
+0000000000801340 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801340:	55                   	push   %rbp
+  801341:	48 89 e5             	mov    %rsp,%rbp
+  801344:	53                   	push   %rbx
+  801345:	48 89 fa             	mov    %rdi,%rdx
+  801348:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80134b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801350:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801357:	00 00 00 
+  80135a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80135f:	be 00 00 00 00       	mov    $0x0,%esi
+  801364:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80136a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80136c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801370:	c9                   	leave
+  801371:	c3                   	ret
+
+0000000000801372 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801372:	55                   	push   %rbp
+  801373:	48 89 e5             	mov    %rsp,%rbp
+  801376:	53                   	push   %rbx
+  801377:	49 89 f8             	mov    %rdi,%r8
+  80137a:	48 89 d3             	mov    %rdx,%rbx
+  80137d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801380:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801385:	4c 89 c2             	mov    %r8,%rdx
+  801388:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138b:	be 00 00 00 00       	mov    $0x0,%esi
+  801390:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801396:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801398:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139c:	c9                   	leave
+  80139d:	c3                   	ret
+
+000000000080139e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80139e:	55                   	push   %rbp
+  80139f:	48 89 e5             	mov    %rsp,%rbp
+  8013a2:	53                   	push   %rbx
+  8013a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8013a7:	89 f8                	mov    %edi,%eax
+  8013a9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013ac:	48 63 f9             	movslq %ecx,%rdi
+  8013af:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c7:	48 85 c0             	test   %rax,%rax
+  8013ca:	7f 06                	jg     8013d2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d0:	c9                   	leave
+  8013d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d2:	49 89 c0             	mov    %rax,%r8
+  8013d5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013da:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8013e1:	00 00 00 
+  8013e4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013e9:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8013f0:	00 00 00 
+  8013f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f8:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8013ff:	00 00 00 
+  801402:	41 ff d1             	call   *%r9
+
+0000000000801405 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801405:	55                   	push   %rbp
+  801406:	48 89 e5             	mov    %rsp,%rbp
+  801409:	53                   	push   %rbx
+  80140a:	48 83 ec 08          	sub    $0x8,%rsp
+  80140e:	89 f8                	mov    %edi,%eax
+  801410:	49 89 f2             	mov    %rsi,%r10
+  801413:	48 89 cf             	mov    %rcx,%rdi
+  801416:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801419:	48 63 da             	movslq %edx,%rbx
+  80141c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80141f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801424:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801427:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80142a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142c:	48 85 c0             	test   %rax,%rax
+  80142f:	7f 06                	jg     801437 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801431:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801435:	c9                   	leave
+  801436:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801437:	49 89 c0             	mov    %rax,%r8
+  80143a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80143f:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801446:	00 00 00 
+  801449:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80144e:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801455:	00 00 00 
+  801458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145d:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  801464:	00 00 00 
+  801467:	41 ff d1             	call   *%r9
+
+000000000080146a <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80146a:	55                   	push   %rbp
+  80146b:	48 89 e5             	mov    %rsp,%rbp
+  80146e:	53                   	push   %rbx
+  80146f:	48 83 ec 08          	sub    $0x8,%rsp
+  801473:	49 89 f9             	mov    %rdi,%r9
+  801476:	89 f0                	mov    %esi,%eax
+  801478:	48 89 d3             	mov    %rdx,%rbx
+  80147b:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80147e:	49 63 f0             	movslq %r8d,%rsi
+  801481:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801484:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801489:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801492:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801494:	48 85 c0             	test   %rax,%rax
+  801497:	7f 06                	jg     80149f <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801499:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149d:	c9                   	leave
+  80149e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80149f:	49 89 c0             	mov    %rax,%r8
+  8014a2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014a7:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8014ae:	00 00 00 
+  8014b1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014b6:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8014bd:	00 00 00 
+  8014c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c5:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8014cc:	00 00 00 
+  8014cf:	41 ff d1             	call   *%r9
+
+00000000008014d2 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8014d2:	55                   	push   %rbp
+  8014d3:	48 89 e5             	mov    %rsp,%rbp
+  8014d6:	53                   	push   %rbx
+  8014d7:	89 f8                	mov    %edi,%eax
+  8014d9:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8014dc:	48 63 f9             	movslq %ecx,%rdi
+  8014df:	48 63 da             	movslq %edx,%rbx
+  8014e2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ea:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f8:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8014fa:	89 c2                	mov    %eax,%edx
+  8014fc:	48 85 c0             	test   %rax,%rax
+  8014ff:	78 0d                	js     80150e <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801501:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801506:	4d 85 c9             	test   %r9,%r9
+  801509:	74 03                	je     80150e <sys_alloc_dma_region+0x3c>
+  80150b:	49 89 01             	mov    %rax,(%r9)
+}
+  80150e:	89 d0                	mov    %edx,%eax
+  801510:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801514:	c9                   	leave
+  801515:	c3                   	ret
+
+0000000000801516 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801516:	55                   	push   %rbp
+  801517:	48 89 e5             	mov    %rsp,%rbp
+  80151a:	53                   	push   %rbx
+  80151b:	48 83 ec 08          	sub    $0x8,%rsp
+  80151f:	48 89 f1             	mov    %rsi,%rcx
+  801522:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801525:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801528:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801532:	be 00 00 00 00       	mov    $0x0,%esi
+  801537:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153f:	48 85 c0             	test   %rax,%rax
+  801542:	7f 06                	jg     80154a <sys_set_cache_region+0x34>
+}
+  801544:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801548:	c9                   	leave
+  801549:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154a:	49 89 c0             	mov    %rax,%r8
+  80154d:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801552:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801559:	00 00 00 
+  80155c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801561:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801568:	00 00 00 
+  80156b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801570:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  801577:	00 00 00 
+  80157a:	41 ff d1             	call   *%r9
+
+000000000080157d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80157d:	55                   	push   %rbp
+  80157e:	48 89 e5             	mov    %rsp,%rbp
+  801581:	53                   	push   %rbx
+  801582:	48 83 ec 08          	sub    $0x8,%rsp
+  801586:	48 89 f1             	mov    %rsi,%rcx
+  801589:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80158c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801594:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801599:	be 00 00 00 00       	mov    $0x0,%esi
+  80159e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a6:	48 85 c0             	test   %rax,%rax
+  8015a9:	7f 06                	jg     8015b1 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b1:	49 89 c0             	mov    %rax,%r8
+  8015b4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015b9:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8015c0:	00 00 00 
+  8015c3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015c8:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8015cf:	00 00 00 
+  8015d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d7:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8015de:	00 00 00 
+  8015e1:	41 ff d1             	call   *%r9
+
+00000000008015e4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015e4:	55                   	push   %rbp
+  8015e5:	48 89 e5             	mov    %rsp,%rbp
+  8015e8:	53                   	push   %rbx
+  8015e9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015ed:	48 63 ce             	movslq %esi,%rcx
+  8015f0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801602:	be 00 00 00 00       	mov    $0x0,%esi
+  801607:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160f:	48 85 c0             	test   %rax,%rax
+  801612:	7f 06                	jg     80161a <sys_env_set_status+0x36>
+}
+  801614:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801618:	c9                   	leave
+  801619:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161a:	49 89 c0             	mov    %rax,%r8
+  80161d:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801622:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801629:	00 00 00 
+  80162c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801631:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801638:	00 00 00 
+  80163b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801640:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  801647:	00 00 00 
+  80164a:	41 ff d1             	call   *%r9
+
+000000000080164d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80164d:	55                   	push   %rbp
+  80164e:	48 89 e5             	mov    %rsp,%rbp
+  801651:	53                   	push   %rbx
+  801652:	48 83 ec 08          	sub    $0x8,%rsp
+  801656:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801659:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801661:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801666:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166b:	be 00 00 00 00       	mov    $0x0,%esi
+  801670:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801676:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801678:	48 85 c0             	test   %rax,%rax
+  80167b:	7f 06                	jg     801683 <sys_env_set_trapframe+0x36>
+}
+  80167d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801681:	c9                   	leave
+  801682:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801683:	49 89 c0             	mov    %rax,%r8
+  801686:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80168b:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801692:	00 00 00 
+  801695:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80169a:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  8016a1:	00 00 00 
+  8016a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a9:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8016b0:	00 00 00 
+  8016b3:	41 ff d1             	call   *%r9
+
+00000000008016b6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016b6:	55                   	push   %rbp
+  8016b7:	48 89 e5             	mov    %rsp,%rbp
+  8016ba:	53                   	push   %rbx
+  8016bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8016bf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016c2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c5:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e1:	48 85 c0             	test   %rax,%rax
+  8016e4:	7f 06                	jg     8016ec <sys_env_set_pgfault_upcall+0x36>
+}
+  8016e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ea:	c9                   	leave
+  8016eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ec:	49 89 c0             	mov    %rax,%r8
+  8016ef:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016f4:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  8016fb:	00 00 00 
+  8016fe:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801703:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80170a:	00 00 00 
+  80170d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801712:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  801719:	00 00 00 
+  80171c:	41 ff d1             	call   *%r9
+
+000000000080171f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80171f:	55                   	push   %rbp
+  801720:	48 89 e5             	mov    %rsp,%rbp
+  801723:	53                   	push   %rbx
+  801724:	89 f8                	mov    %edi,%eax
+  801726:	49 89 f1             	mov    %rsi,%r9
+  801729:	48 89 d3             	mov    %rdx,%rbx
+  80172c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80172f:	49 63 f0             	movslq %r8d,%rsi
+  801732:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801735:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80173a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801743:	cd 30                	int    $0x30
+}
+  801745:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801749:	c9                   	leave
+  80174a:	c3                   	ret
+
+000000000080174b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80174b:	55                   	push   %rbp
+  80174c:	48 89 e5             	mov    %rsp,%rbp
+  80174f:	53                   	push   %rbx
+  801750:	48 83 ec 08          	sub    $0x8,%rsp
+  801754:	48 89 fa             	mov    %rdi,%rdx
+  801757:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80175a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80175f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801764:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801769:	be 00 00 00 00       	mov    $0x0,%esi
+  80176e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801774:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801776:	48 85 c0             	test   %rax,%rax
+  801779:	7f 06                	jg     801781 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80177b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80177f:	c9                   	leave
+  801780:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801781:	49 89 c0             	mov    %rax,%r8
+  801784:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801789:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801790:	00 00 00 
+  801793:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801798:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  80179f:	00 00 00 
+  8017a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a7:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8017ae:	00 00 00 
+  8017b1:	41 ff d1             	call   *%r9
+
+00000000008017b4 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8017b4:	55                   	push   %rbp
+  8017b5:	48 89 e5             	mov    %rsp,%rbp
+  8017b8:	53                   	push   %rbx
+  8017b9:	48 89 fa             	mov    %rdi,%rdx
+  8017bc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017bf:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017d9:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017df:	c9                   	leave
+  8017e0:	c3                   	ret
+
+00000000008017e1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8017e1:	55                   	push   %rbp
+  8017e2:	48 89 e5             	mov    %rsp,%rbp
+  8017e5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801804:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80180a:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80180c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801810:	c9                   	leave
+  801811:	c3                   	ret
+
+0000000000801812 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801812:	48 85 ff             	test   %rdi,%rdi
+  801815:	0f 84 b6 01 00 00    	je     8019d1 <malloc+0x1bf>
+malloc(size_t size) {
+  80181b:	55                   	push   %rbp
+  80181c:	48 89 e5             	mov    %rsp,%rbp
+  80181f:	41 56                	push   %r14
+  801821:	41 55                	push   %r13
+  801823:	41 54                	push   %r12
+  801825:	53                   	push   %rbx
+  801826:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801829:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801830:	00 00 00 
+  801833:	4c 8b 20             	mov    (%rax),%r12
+  801836:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80183d:	0f 87 94 01 00 00    	ja     8019d7 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801843:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  80184a:	00 00 00 
+  80184d:	48 85 c0             	test   %rax,%rax
+  801850:	74 6b                	je     8018bd <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801852:	4d 85 e4             	test   %r12,%r12
+  801855:	74 66                	je     8018bd <malloc+0xab>
+  801857:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80185e:	00 00 00 
+  801861:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801866:	eb 0d                	jmp    801875 <malloc+0x63>
+  801868:	48 83 c1 01          	add    $0x1,%rcx
+  80186c:	48 83 c2 18          	add    $0x18,%rdx
+  801870:	49 39 cc             	cmp    %rcx,%r12
+  801873:	74 48                	je     8018bd <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801875:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  80187a:	74 ec                	je     801868 <malloc+0x56>
+  80187c:	48 39 1a             	cmp    %rbx,(%rdx)
+  80187f:	72 e7                	jb     801868 <malloc+0x56>
+                real_freep_size--;
+  801881:	48 83 e8 01          	sub    $0x1,%rax
+  801885:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80188c:	00 00 00 
+                freep[i].is_free = false;
+  80188f:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801896:	00 00 00 
+  801899:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80189d:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8018a1:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8018a5:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8018ac:	00 
+                freep[i].size = size;
+  8018ad:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8018b1:	48 01 c8             	add    %rcx,%rax
+  8018b4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8018b8:	e9 0b 01 00 00       	jmp    8019c8 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8018bd:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8018c4:	00 00 00 
+  8018c7:	48 01 d8             	add    %rbx,%rax
+  8018ca:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8018d0:	76 7c                	jbe    80194e <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8018d2:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8018d9:	00 00 00 
+  8018dc:	4c 8b 30             	mov    (%rax),%r14
+  8018df:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8018e6:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8018e9:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8018f0:	00 00 00 
+  8018f3:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8018fa:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801901:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801907:	4c 0f 45 eb          	cmovne %rbx,%r13
+  80190b:	48 b8 de 12 80 00 00 	movabs $0x8012de,%rax
+  801912:	00 00 00 
+  801915:	ff d0                	call   *%rax
+  801917:	89 c7                	mov    %eax,%edi
+  801919:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801920:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801927:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80192e:	00 00 00 
+  801931:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801935:	b9 26 00 00 00       	mov    $0x26,%ecx
+  80193a:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  801941:	00 00 00 
+  801944:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801946:	85 c0                	test   %eax,%eax
+  801948:	0f 88 90 00 00 00    	js     8019de <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80194e:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801955:	00 00 00 
+  801958:	48 8b 31             	mov    (%rcx),%rsi
+  80195b:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801962:	00 00 00 
+  801965:	4c 8b 07             	mov    (%rdi),%r8
+  801968:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80196c:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801973:	00 00 00 
+  801976:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  80197a:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80197e:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801985:	00 00 00 
+  801988:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80198c:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80198f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801993:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80199a:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  80199b:	48 89 d8             	mov    %rbx,%rax
+  80199e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019a3:	4c 01 c0             	add    %r8,%rax
+  8019a6:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8019a9:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8019b0:	48 01 f3             	add    %rsi,%rbx
+  8019b3:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8019b6:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8019bb:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8019c2:	00 00 00 
+  8019c5:	48 89 d0             	mov    %rdx,%rax
+}
+  8019c8:	5b                   	pop    %rbx
+  8019c9:	41 5c                	pop    %r12
+  8019cb:	41 5d                	pop    %r13
+  8019cd:	41 5e                	pop    %r14
+  8019cf:	5d                   	pop    %rbp
+  8019d0:	c3                   	ret
+        return NULL;
+  8019d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019d6:	c3                   	ret
+        return NULL;
+  8019d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019dc:	eb ea                	jmp    8019c8 <malloc+0x1b6>
+            return NULL;
+  8019de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e3:	eb e3                	jmp    8019c8 <malloc+0x1b6>
+
+00000000008019e5 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8019e5:	55                   	push   %rbp
+  8019e6:	48 89 e5             	mov    %rsp,%rbp
+  8019e9:	53                   	push   %rbx
+  8019ea:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8019ee:	48 89 fb             	mov    %rdi,%rbx
+  8019f1:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8019f5:	48 89 df             	mov    %rbx,%rdi
+  8019f8:	48 b8 12 18 80 00 00 	movabs $0x801812,%rax
+  8019ff:	00 00 00 
+  801a02:	ff d0                	call   *%rax
+  801a04:	48 89 c7             	mov    %rax,%rdi
+  801a07:	48 89 da             	mov    %rbx,%rdx
+  801a0a:	be 00 00 00 00       	mov    $0x0,%esi
+  801a0f:	48 b8 1e 0f 80 00 00 	movabs $0x800f1e,%rax
+  801a16:	00 00 00 
+  801a19:	ff d0                	call   *%rax
+}
+  801a1b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a1f:	c9                   	leave
+  801a20:	c3                   	ret
+
+0000000000801a21 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801a21:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801a28:	00 00 00 
+  801a2b:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801a32:	00 00 00 
+  801a35:	48 3b 02             	cmp    (%rdx),%rax
+  801a38:	74 4d                	je     801a87 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801a3a:	48 85 c0             	test   %rax,%rax
+  801a3d:	74 4d                	je     801a8c <get_allocsize+0x6b>
+  801a3f:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801a46:	00 00 00 
+  801a49:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801a4e:	48 3b 39             	cmp    (%rcx),%rdi
+  801a51:	74 13                	je     801a66 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801a53:	48 83 c2 01          	add    $0x1,%rdx
+  801a57:	48 83 c1 18          	add    $0x18,%rcx
+  801a5b:	48 39 d0             	cmp    %rdx,%rax
+  801a5e:	75 ee                	jne    801a4e <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a65:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801a66:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6f:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a76:	00 00 00 
+  801a79:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a7f:	75 0b                	jne    801a8c <get_allocsize+0x6b>
+  801a81:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801a86:	c3                   	ret
+        return 0;
+  801a87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a8c:	c3                   	ret
+
+0000000000801a8d <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801a8d:	48 85 ff             	test   %rdi,%rdi
+  801a90:	0f 84 01 01 00 00    	je     801b97 <free+0x10a>
+free(void *ptr) {
+  801a96:	55                   	push   %rbp
+  801a97:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801a9a:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801aa1:	00 00 00 
+  801aa4:	48 8b 30             	mov    (%rax),%rsi
+  801aa7:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801aae:	00 00 00 
+  801ab1:	48 39 c6             	cmp    %rax,%rsi
+  801ab4:	74 50                	je     801b06 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801ab6:	48 85 f6             	test   %rsi,%rsi
+  801ab9:	74 21                	je     801adc <free+0x4f>
+  801abb:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801ac2:	00 00 00 
+  801ac5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801aca:	48 3b 39             	cmp    (%rcx),%rdi
+  801acd:	74 61                	je     801b30 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801acf:	48 83 c2 01          	add    $0x1,%rdx
+  801ad3:	48 83 c1 18          	add    $0x18,%rcx
+  801ad7:	48 39 d6             	cmp    %rdx,%rsi
+  801ada:	75 ee                	jne    801aca <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801adc:	48 ba 10 56 80 00 00 	movabs $0x805610,%rdx
+  801ae3:	00 00 00 
+  801ae6:	be 12 01 00 00       	mov    $0x112,%esi
+  801aeb:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801af2:	00 00 00 
+  801af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afa:	48 b9 76 01 80 00 00 	movabs $0x800176,%rcx
+  801b01:	00 00 00 
+  801b04:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801b06:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801b0d:	00 00 00 
+  801b10:	be 06 01 00 00       	mov    $0x106,%esi
+  801b15:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801b1c:	00 00 00 
+  801b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b24:	48 b9 76 01 80 00 00 	movabs $0x800176,%rcx
+  801b2b:	00 00 00 
+  801b2e:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801b30:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b34:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801b3b:	00 00 00 
+  801b3e:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b44:	75 27                	jne    801b6d <free+0xe0>
+            freep[i].is_free = true;
+  801b46:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b4a:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801b51:	00 00 00 
+  801b54:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801b5b:	00 00 
+            real_freep_size++;
+  801b5d:	48 83 c0 01          	add    $0x1,%rax
+  801b61:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801b68:	00 00 00 
+}
+  801b6b:	5d                   	pop    %rbp
+  801b6c:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801b6d:	48 ba e8 55 80 00 00 	movabs $0x8055e8,%rdx
+  801b74:	00 00 00 
+  801b77:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801b7c:	48 bf 38 56 80 00 00 	movabs $0x805638,%rdi
+  801b83:	00 00 00 
+  801b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8b:	48 b9 76 01 80 00 00 	movabs $0x800176,%rcx
+  801b92:	00 00 00 
+  801b95:	ff d1                	call   *%rcx
+  801b97:	c3                   	ret
+
+0000000000801b98 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801b98:	55                   	push   %rbp
+  801b99:	48 89 e5             	mov    %rsp,%rbp
+  801b9c:	41 55                	push   %r13
+  801b9e:	41 54                	push   %r12
+  801ba0:	53                   	push   %rbx
+  801ba1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ba5:	48 89 fb             	mov    %rdi,%rbx
+  801ba8:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801bab:	48 b8 21 1a 80 00 00 	movabs $0x801a21,%rax
+  801bb2:	00 00 00 
+  801bb5:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801bb7:	49 39 c5             	cmp    %rax,%r13
+  801bba:	73 0e                	jae    801bca <realloc+0x32>
+}
+  801bbc:	48 89 d8             	mov    %rbx,%rax
+  801bbf:	48 83 c4 08          	add    $0x8,%rsp
+  801bc3:	5b                   	pop    %rbx
+  801bc4:	41 5c                	pop    %r12
+  801bc6:	41 5d                	pop    %r13
+  801bc8:	5d                   	pop    %rbp
+  801bc9:	c3                   	ret
+  801bca:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801bcd:	4c 89 ef             	mov    %r13,%rdi
+  801bd0:	48 b8 12 18 80 00 00 	movabs $0x801812,%rax
+  801bd7:	00 00 00 
+  801bda:	ff d0                	call   *%rax
+  801bdc:	48 89 c7             	mov    %rax,%rdi
+  801bdf:	4c 89 e2             	mov    %r12,%rdx
+  801be2:	48 89 de             	mov    %rbx,%rsi
+  801be5:	48 b8 33 10 80 00 00 	movabs $0x801033,%rax
+  801bec:	00 00 00 
+  801bef:	ff d0                	call   *%rax
+  801bf1:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801bf4:	48 89 df             	mov    %rbx,%rdi
+  801bf7:	48 b8 8d 1a 80 00 00 	movabs $0x801a8d,%rax
+  801bfe:	00 00 00 
+  801c01:	ff d0                	call   *%rax
+    return newptr;
+  801c03:	4c 89 e3             	mov    %r12,%rbx
+  801c06:	eb b4                	jmp    801bbc <realloc+0x24>
+
+0000000000801c08 <strdup>:
+
+char*
+strdup (const char *src) {
+  801c08:	55                   	push   %rbp
+  801c09:	48 89 e5             	mov    %rsp,%rbp
+  801c0c:	41 54                	push   %r12
+  801c0e:	53                   	push   %rbx
+  801c0f:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801c12:	48 b8 00 0c 80 00 00 	movabs $0x800c00,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+  801c1e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801c22:	4c 89 e7             	mov    %r12,%rdi
+  801c25:	48 b8 12 18 80 00 00 	movabs $0x801812,%rax
+  801c2c:	00 00 00 
+  801c2f:	ff d0                	call   *%rax
+  801c31:	48 89 c7             	mov    %rax,%rdi
+  801c34:	4c 89 e2             	mov    %r12,%rdx
+  801c37:	48 89 de             	mov    %rbx,%rsi
+  801c3a:	48 b8 33 10 80 00 00 	movabs $0x801033,%rax
+  801c41:	00 00 00 
+  801c44:	ff d0                	call   *%rax
+}
+  801c46:	5b                   	pop    %rbx
+  801c47:	41 5c                	pop    %r12
+  801c49:	5d                   	pop    %rbp
+  801c4a:	c3                   	ret
+
+0000000000801c4b <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801c4b:	55                   	push   %rbp
+  801c4c:	48 89 e5             	mov    %rsp,%rbp
+  801c4f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c50:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c55:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c64:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c69:	be 00 00 00 00       	mov    $0x0,%esi
+  801c6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c74:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c7a:	c9                   	leave
+  801c7b:	c3                   	ret
+
+0000000000801c7c <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801c7c:	55                   	push   %rbp
+  801c7d:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801c80:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c87:	00 00 00 
+  801c8a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c8e:	74 26                	je     801cb6 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801c90:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c92:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c96:	89 c0                	mov    %eax,%eax
+  801c98:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801c9b:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801ca2:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801ca9:	00 00 00 
+  801cac:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb1:	48 f7 31             	divq   (%rcx)
+}
+  801cb4:	5d                   	pop    %rbp
+  801cb5:	c3                   	ret
+        freq = get_cpufreq();
+  801cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbb:	48 ba 4b 1c 80 00 00 	movabs $0x801c4b,%rdx
+  801cc2:	00 00 00 
+  801cc5:	ff d2                	call   *%rdx
+  801cc7:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801cce:	00 00 00 
+  801cd1:	eb bd                	jmp    801c90 <get_ticks+0x14>
+
+0000000000801cd3 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801cd3:	55                   	push   %rbp
+  801cd4:	48 89 e5             	mov    %rsp,%rbp
+  801cd7:	53                   	push   %rbx
+  801cd8:	48 83 ec 08          	sub    $0x8,%rsp
+  801cdc:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801cdf:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801ce6:	00 00 00 
+  801ce9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801ced:	74 50                	je     801d3f <sleep+0x6c>
+    asm volatile("rdtsc"
+  801cef:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801cf1:	48 c1 e2 20          	shl    $0x20,%rdx
+  801cf5:	89 c0                	mov    %eax,%eax
+  801cf7:	48 89 d6             	mov    %rdx,%rsi
+  801cfa:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801cfd:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d04:	00 00 00 
+  801d07:	48 0f af 18          	imul   (%rax),%rbx
+  801d0b:	48 c1 eb 03          	shr    $0x3,%rbx
+  801d0f:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801d16:	9b c4 20 
+  801d19:	48 89 d8             	mov    %rbx,%rax
+  801d1c:	48 f7 e2             	mul    %rdx
+  801d1f:	48 89 d1             	mov    %rdx,%rcx
+  801d22:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801d26:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d28:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d2c:	89 c0                	mov    %eax,%eax
+  801d2e:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801d31:	48 29 f2             	sub    %rsi,%rdx
+  801d34:	48 39 ca             	cmp    %rcx,%rdx
+  801d37:	72 ed                	jb     801d26 <sleep+0x53>
+}
+  801d39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d3d:	c9                   	leave
+  801d3e:	c3                   	ret
+        freq = get_cpufreq();
+  801d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d44:	48 ba 4b 1c 80 00 00 	movabs $0x801c4b,%rdx
+  801d4b:	00 00 00 
+  801d4e:	ff d2                	call   *%rdx
+  801d50:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801d57:	00 00 00 
+  801d5a:	eb 93                	jmp    801cef <sleep+0x1c>
+
+0000000000801d5c <poll_kbd>:
+
+int poll_kbd() {
+  801d5c:	55                   	push   %rbp
+  801d5d:	48 89 e5             	mov    %rsp,%rbp
+  801d60:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d61:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d75:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d7a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d85:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d8b:	c9                   	leave
+  801d8c:	c3                   	ret
+
+0000000000801d8d <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801d8d:	55                   	push   %rbp
+  801d8e:	48 89 e5             	mov    %rsp,%rbp
+  801d91:	53                   	push   %rbx
+  801d92:	49 89 fa             	mov    %rdi,%r10
+  801d95:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801d97:	44 89 c6             	mov    %r8d,%esi
+  801d9a:	89 cf                	mov    %ecx,%edi
+  801d9c:	89 d3                	mov    %edx,%ebx
+  801d9e:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801da0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801da5:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801da8:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801dac:	cd 30                	int    $0x30
+  801dae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801db2:	c9                   	leave
+  801db3:	c3                   	ret
+
+0000000000801db4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801db4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801dbb:	ff ff ff 
+  801dbe:	48 01 f8             	add    %rdi,%rax
+  801dc1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801dc5:	c3                   	ret
+
+0000000000801dc6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801dc6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801dcd:	ff ff ff 
+  801dd0:	48 01 f8             	add    %rdi,%rax
+  801dd3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801dd7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801ddd:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801de1:	c3                   	ret
+
+0000000000801de2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801de2:	55                   	push   %rbp
+  801de3:	48 89 e5             	mov    %rsp,%rbp
+  801de6:	41 57                	push   %r15
+  801de8:	41 56                	push   %r14
+  801dea:	41 55                	push   %r13
+  801dec:	41 54                	push   %r12
+  801dee:	53                   	push   %rbx
+  801def:	48 83 ec 08          	sub    $0x8,%rsp
+  801df3:	49 89 ff             	mov    %rdi,%r15
+  801df6:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801dfb:	49 bd 1d 45 80 00 00 	movabs $0x80451d,%r13
+  801e02:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801e05:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801e0b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801e0e:	48 89 df             	mov    %rbx,%rdi
+  801e11:	41 ff d5             	call   *%r13
+  801e14:	83 e0 04             	and    $0x4,%eax
+  801e17:	74 17                	je     801e30 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801e19:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e20:	4c 39 f3             	cmp    %r14,%rbx
+  801e23:	75 e6                	jne    801e0b <fd_alloc+0x29>
+  801e25:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801e2b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801e30:	4d 89 27             	mov    %r12,(%r15)
+}
+  801e33:	48 83 c4 08          	add    $0x8,%rsp
+  801e37:	5b                   	pop    %rbx
+  801e38:	41 5c                	pop    %r12
+  801e3a:	41 5d                	pop    %r13
+  801e3c:	41 5e                	pop    %r14
+  801e3e:	41 5f                	pop    %r15
+  801e40:	5d                   	pop    %rbp
+  801e41:	c3                   	ret
+
+0000000000801e42 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801e42:	83 ff 1f             	cmp    $0x1f,%edi
+  801e45:	77 39                	ja     801e80 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801e47:	55                   	push   %rbp
+  801e48:	48 89 e5             	mov    %rsp,%rbp
+  801e4b:	41 54                	push   %r12
+  801e4d:	53                   	push   %rbx
+  801e4e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801e51:	48 63 df             	movslq %edi,%rbx
+  801e54:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801e5b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801e5f:	48 89 df             	mov    %rbx,%rdi
+  801e62:	48 b8 1d 45 80 00 00 	movabs $0x80451d,%rax
+  801e69:	00 00 00 
+  801e6c:	ff d0                	call   *%rax
+  801e6e:	a8 04                	test   $0x4,%al
+  801e70:	74 14                	je     801e86 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801e72:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801e76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e7b:	5b                   	pop    %rbx
+  801e7c:	41 5c                	pop    %r12
+  801e7e:	5d                   	pop    %rbp
+  801e7f:	c3                   	ret
+        return -E_INVAL;
+  801e80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801e85:	c3                   	ret
+        return -E_INVAL;
+  801e86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e8b:	eb ee                	jmp    801e7b <fd_lookup+0x39>
+
+0000000000801e8d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801e8d:	55                   	push   %rbp
+  801e8e:	48 89 e5             	mov    %rsp,%rbp
+  801e91:	41 54                	push   %r12
+  801e93:	53                   	push   %rbx
+  801e94:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801e97:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  801e9e:	00 00 00 
+  801ea1:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801ea8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801eab:	39 3b                	cmp    %edi,(%rbx)
+  801ead:	74 47                	je     801ef6 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801eaf:	48 83 c0 08          	add    $0x8,%rax
+  801eb3:	48 8b 18             	mov    (%rax),%rbx
+  801eb6:	48 85 db             	test   %rbx,%rbx
+  801eb9:	75 f0                	jne    801eab <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ebb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801ec2:	00 00 00 
+  801ec5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ecb:	89 fa                	mov    %edi,%edx
+  801ecd:	48 bf 48 56 80 00 00 	movabs $0x805648,%rdi
+  801ed4:	00 00 00 
+  801ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801edc:	48 b9 c6 02 80 00 00 	movabs $0x8002c6,%rcx
+  801ee3:	00 00 00 
+  801ee6:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ee8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801eed:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ef1:	5b                   	pop    %rbx
+  801ef2:	41 5c                	pop    %r12
+  801ef4:	5d                   	pop    %rbp
+  801ef5:	c3                   	ret
+            return 0;
+  801ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efb:	eb f0                	jmp    801eed <dev_lookup+0x60>
+
+0000000000801efd <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801efd:	55                   	push   %rbp
+  801efe:	48 89 e5             	mov    %rsp,%rbp
+  801f01:	41 55                	push   %r13
+  801f03:	41 54                	push   %r12
+  801f05:	53                   	push   %rbx
+  801f06:	48 83 ec 18          	sub    $0x18,%rsp
+  801f0a:	48 89 fb             	mov    %rdi,%rbx
+  801f0d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f10:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801f17:	ff ff ff 
+  801f1a:	48 01 df             	add    %rbx,%rdi
+  801f1d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801f21:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f25:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  801f2c:	00 00 00 
+  801f2f:	ff d0                	call   *%rax
+  801f31:	41 89 c5             	mov    %eax,%r13d
+  801f34:	85 c0                	test   %eax,%eax
+  801f36:	78 06                	js     801f3e <fd_close+0x41>
+  801f38:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801f3c:	74 1a                	je     801f58 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801f3e:	45 84 e4             	test   %r12b,%r12b
+  801f41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f46:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801f4a:	44 89 e8             	mov    %r13d,%eax
+  801f4d:	48 83 c4 18          	add    $0x18,%rsp
+  801f51:	5b                   	pop    %rbx
+  801f52:	41 5c                	pop    %r12
+  801f54:	41 5d                	pop    %r13
+  801f56:	5d                   	pop    %rbp
+  801f57:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f58:	8b 3b                	mov    (%rbx),%edi
+  801f5a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f5e:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  801f65:	00 00 00 
+  801f68:	ff d0                	call   *%rax
+  801f6a:	41 89 c5             	mov    %eax,%r13d
+  801f6d:	85 c0                	test   %eax,%eax
+  801f6f:	78 1b                	js     801f8c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801f71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f75:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f79:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801f7f:	48 85 c0             	test   %rax,%rax
+  801f82:	74 08                	je     801f8c <fd_close+0x8f>
+  801f84:	48 89 df             	mov    %rbx,%rdi
+  801f87:	ff d0                	call   *%rax
+  801f89:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801f8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f91:	48 89 de             	mov    %rbx,%rsi
+  801f94:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f99:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  801fa0:	00 00 00 
+  801fa3:	ff d0                	call   *%rax
+    return res;
+  801fa5:	eb a3                	jmp    801f4a <fd_close+0x4d>
+
+0000000000801fa7 <close>:
+
+int
+close(int fdnum) {
+  801fa7:	55                   	push   %rbp
+  801fa8:	48 89 e5             	mov    %rsp,%rbp
+  801fab:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801faf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fb3:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  801fba:	00 00 00 
+  801fbd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	78 15                	js     801fd8 <close+0x31>
+
+    return fd_close(fd, 1);
+  801fc3:	be 01 00 00 00       	mov    $0x1,%esi
+  801fc8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801fcc:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  801fd3:	00 00 00 
+  801fd6:	ff d0                	call   *%rax
+}
+  801fd8:	c9                   	leave
+  801fd9:	c3                   	ret
+
+0000000000801fda <close_all>:
+
+void
+close_all(void) {
+  801fda:	55                   	push   %rbp
+  801fdb:	48 89 e5             	mov    %rsp,%rbp
+  801fde:	41 54                	push   %r12
+  801fe0:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801fe1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fe6:	49 bc a7 1f 80 00 00 	movabs $0x801fa7,%r12
+  801fed:	00 00 00 
+  801ff0:	89 df                	mov    %ebx,%edi
+  801ff2:	41 ff d4             	call   *%r12
+  801ff5:	83 c3 01             	add    $0x1,%ebx
+  801ff8:	83 fb 20             	cmp    $0x20,%ebx
+  801ffb:	75 f3                	jne    801ff0 <close_all+0x16>
+}
+  801ffd:	5b                   	pop    %rbx
+  801ffe:	41 5c                	pop    %r12
+  802000:	5d                   	pop    %rbp
+  802001:	c3                   	ret
+
+0000000000802002 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802002:	55                   	push   %rbp
+  802003:	48 89 e5             	mov    %rsp,%rbp
+  802006:	41 57                	push   %r15
+  802008:	41 56                	push   %r14
+  80200a:	41 55                	push   %r13
+  80200c:	41 54                	push   %r12
+  80200e:	53                   	push   %rbx
+  80200f:	48 83 ec 18          	sub    $0x18,%rsp
+  802013:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802016:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80201a:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  802021:	00 00 00 
+  802024:	ff d0                	call   *%rax
+  802026:	89 c3                	mov    %eax,%ebx
+  802028:	85 c0                	test   %eax,%eax
+  80202a:	0f 88 b8 00 00 00    	js     8020e8 <dup+0xe6>
+    close(newfdnum);
+  802030:	44 89 e7             	mov    %r12d,%edi
+  802033:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  80203a:	00 00 00 
+  80203d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80203f:	4d 63 ec             	movslq %r12d,%r13
+  802042:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802049:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80204d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802051:	4c 89 ff             	mov    %r15,%rdi
+  802054:	49 be c6 1d 80 00 00 	movabs $0x801dc6,%r14
+  80205b:	00 00 00 
+  80205e:	41 ff d6             	call   *%r14
+  802061:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802064:	4c 89 ef             	mov    %r13,%rdi
+  802067:	41 ff d6             	call   *%r14
+  80206a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80206d:	48 89 df             	mov    %rbx,%rdi
+  802070:	48 b8 1d 45 80 00 00 	movabs $0x80451d,%rax
+  802077:	00 00 00 
+  80207a:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80207c:	a8 04                	test   $0x4,%al
+  80207e:	74 2b                	je     8020ab <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802080:	41 89 c1             	mov    %eax,%r9d
+  802083:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802089:	4c 89 f1             	mov    %r14,%rcx
+  80208c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802091:	48 89 de             	mov    %rbx,%rsi
+  802094:	bf 00 00 00 00       	mov    $0x0,%edi
+  802099:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  8020a0:	00 00 00 
+  8020a3:	ff d0                	call   *%rax
+  8020a5:	89 c3                	mov    %eax,%ebx
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	78 4e                	js     8020f9 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8020ab:	4c 89 ff             	mov    %r15,%rdi
+  8020ae:	48 b8 1d 45 80 00 00 	movabs $0x80451d,%rax
+  8020b5:	00 00 00 
+  8020b8:	ff d0                	call   *%rax
+  8020ba:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8020bd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8020c3:	4c 89 e9             	mov    %r13,%rcx
+  8020c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020cb:	4c 89 fe             	mov    %r15,%rsi
+  8020ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020d3:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  8020da:	00 00 00 
+  8020dd:	ff d0                	call   *%rax
+  8020df:	89 c3                	mov    %eax,%ebx
+  8020e1:	85 c0                	test   %eax,%eax
+  8020e3:	78 14                	js     8020f9 <dup+0xf7>
+
+    return newfdnum;
+  8020e5:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8020e8:	89 d8                	mov    %ebx,%eax
+  8020ea:	48 83 c4 18          	add    $0x18,%rsp
+  8020ee:	5b                   	pop    %rbx
+  8020ef:	41 5c                	pop    %r12
+  8020f1:	41 5d                	pop    %r13
+  8020f3:	41 5e                	pop    %r14
+  8020f5:	41 5f                	pop    %r15
+  8020f7:	5d                   	pop    %rbp
+  8020f8:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8020f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020fe:	4c 89 ee             	mov    %r13,%rsi
+  802101:	bf 00 00 00 00       	mov    $0x0,%edi
+  802106:	49 bc 7d 15 80 00 00 	movabs $0x80157d,%r12
+  80210d:	00 00 00 
+  802110:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802113:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802118:	4c 89 f6             	mov    %r14,%rsi
+  80211b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802120:	41 ff d4             	call   *%r12
+    return res;
+  802123:	eb c3                	jmp    8020e8 <dup+0xe6>
+
+0000000000802125 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802125:	55                   	push   %rbp
+  802126:	48 89 e5             	mov    %rsp,%rbp
+  802129:	41 56                	push   %r14
+  80212b:	41 55                	push   %r13
+  80212d:	41 54                	push   %r12
+  80212f:	53                   	push   %rbx
+  802130:	48 83 ec 10          	sub    $0x10,%rsp
+  802134:	89 fb                	mov    %edi,%ebx
+  802136:	49 89 f4             	mov    %rsi,%r12
+  802139:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80213c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802140:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  802147:	00 00 00 
+  80214a:	ff d0                	call   *%rax
+  80214c:	85 c0                	test   %eax,%eax
+  80214e:	78 4c                	js     80219c <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802150:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802154:	41 8b 3e             	mov    (%r14),%edi
+  802157:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80215b:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  802162:	00 00 00 
+  802165:	ff d0                	call   *%rax
+  802167:	85 c0                	test   %eax,%eax
+  802169:	78 35                	js     8021a0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80216b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80216f:	83 e0 03             	and    $0x3,%eax
+  802172:	83 f8 01             	cmp    $0x1,%eax
+  802175:	74 2d                	je     8021a4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802177:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80217b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80217f:	48 85 c0             	test   %rax,%rax
+  802182:	74 56                	je     8021da <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802184:	4c 89 ea             	mov    %r13,%rdx
+  802187:	4c 89 e6             	mov    %r12,%rsi
+  80218a:	4c 89 f7             	mov    %r14,%rdi
+  80218d:	ff d0                	call   *%rax
+}
+  80218f:	48 83 c4 10          	add    $0x10,%rsp
+  802193:	5b                   	pop    %rbx
+  802194:	41 5c                	pop    %r12
+  802196:	41 5d                	pop    %r13
+  802198:	41 5e                	pop    %r14
+  80219a:	5d                   	pop    %rbp
+  80219b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80219c:	48 98                	cltq
+  80219e:	eb ef                	jmp    80218f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021a0:	48 98                	cltq
+  8021a2:	eb eb                	jmp    80218f <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021a4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021ab:	00 00 00 
+  8021ae:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021b4:	89 da                	mov    %ebx,%edx
+  8021b6:	48 bf 89 56 80 00 00 	movabs $0x805689,%rdi
+  8021bd:	00 00 00 
+  8021c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c5:	48 b9 c6 02 80 00 00 	movabs $0x8002c6,%rcx
+  8021cc:	00 00 00 
+  8021cf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021d1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8021d8:	eb b5                	jmp    80218f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8021da:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8021e1:	eb ac                	jmp    80218f <read+0x6a>
+
+00000000008021e3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8021e3:	55                   	push   %rbp
+  8021e4:	48 89 e5             	mov    %rsp,%rbp
+  8021e7:	41 57                	push   %r15
+  8021e9:	41 56                	push   %r14
+  8021eb:	41 55                	push   %r13
+  8021ed:	41 54                	push   %r12
+  8021ef:	53                   	push   %rbx
+  8021f0:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8021f4:	48 85 d2             	test   %rdx,%rdx
+  8021f7:	74 54                	je     80224d <readn+0x6a>
+  8021f9:	41 89 fd             	mov    %edi,%r13d
+  8021fc:	49 89 f6             	mov    %rsi,%r14
+  8021ff:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802202:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802207:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80220c:	49 bf 25 21 80 00 00 	movabs $0x802125,%r15
+  802213:	00 00 00 
+  802216:	4c 89 e2             	mov    %r12,%rdx
+  802219:	48 29 f2             	sub    %rsi,%rdx
+  80221c:	4c 01 f6             	add    %r14,%rsi
+  80221f:	44 89 ef             	mov    %r13d,%edi
+  802222:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802225:	85 c0                	test   %eax,%eax
+  802227:	78 20                	js     802249 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802229:	01 c3                	add    %eax,%ebx
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	74 08                	je     802237 <readn+0x54>
+  80222f:	48 63 f3             	movslq %ebx,%rsi
+  802232:	4c 39 e6             	cmp    %r12,%rsi
+  802235:	72 df                	jb     802216 <readn+0x33>
+    }
+    return res;
+  802237:	48 63 c3             	movslq %ebx,%rax
+}
+  80223a:	48 83 c4 08          	add    $0x8,%rsp
+  80223e:	5b                   	pop    %rbx
+  80223f:	41 5c                	pop    %r12
+  802241:	41 5d                	pop    %r13
+  802243:	41 5e                	pop    %r14
+  802245:	41 5f                	pop    %r15
+  802247:	5d                   	pop    %rbp
+  802248:	c3                   	ret
+        if (inc < 0) return inc;
+  802249:	48 98                	cltq
+  80224b:	eb ed                	jmp    80223a <readn+0x57>
+    int inc = 1, res = 0;
+  80224d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802252:	eb e3                	jmp    802237 <readn+0x54>
+
+0000000000802254 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802254:	55                   	push   %rbp
+  802255:	48 89 e5             	mov    %rsp,%rbp
+  802258:	41 56                	push   %r14
+  80225a:	41 55                	push   %r13
+  80225c:	41 54                	push   %r12
+  80225e:	53                   	push   %rbx
+  80225f:	48 83 ec 10          	sub    $0x10,%rsp
+  802263:	89 fb                	mov    %edi,%ebx
+  802265:	49 89 f4             	mov    %rsi,%r12
+  802268:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80226b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80226f:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  802276:	00 00 00 
+  802279:	ff d0                	call   *%rax
+  80227b:	85 c0                	test   %eax,%eax
+  80227d:	78 47                	js     8022c6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80227f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802283:	41 8b 3e             	mov    (%r14),%edi
+  802286:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80228a:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  802291:	00 00 00 
+  802294:	ff d0                	call   *%rax
+  802296:	85 c0                	test   %eax,%eax
+  802298:	78 30                	js     8022ca <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80229a:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80229f:	74 2d                	je     8022ce <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8022a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022a5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8022a9:	48 85 c0             	test   %rax,%rax
+  8022ac:	74 56                	je     802304 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8022ae:	4c 89 ea             	mov    %r13,%rdx
+  8022b1:	4c 89 e6             	mov    %r12,%rsi
+  8022b4:	4c 89 f7             	mov    %r14,%rdi
+  8022b7:	ff d0                	call   *%rax
+}
+  8022b9:	48 83 c4 10          	add    $0x10,%rsp
+  8022bd:	5b                   	pop    %rbx
+  8022be:	41 5c                	pop    %r12
+  8022c0:	41 5d                	pop    %r13
+  8022c2:	41 5e                	pop    %r14
+  8022c4:	5d                   	pop    %rbp
+  8022c5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022c6:	48 98                	cltq
+  8022c8:	eb ef                	jmp    8022b9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022ca:	48 98                	cltq
+  8022cc:	eb eb                	jmp    8022b9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022ce:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022d5:	00 00 00 
+  8022d8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022de:	89 da                	mov    %ebx,%edx
+  8022e0:	48 bf a5 56 80 00 00 	movabs $0x8056a5,%rdi
+  8022e7:	00 00 00 
+  8022ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ef:	48 b9 c6 02 80 00 00 	movabs $0x8002c6,%rcx
+  8022f6:	00 00 00 
+  8022f9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8022fb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802302:	eb b5                	jmp    8022b9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802304:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80230b:	eb ac                	jmp    8022b9 <write+0x65>
+
+000000000080230d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80230d:	55                   	push   %rbp
+  80230e:	48 89 e5             	mov    %rsp,%rbp
+  802311:	53                   	push   %rbx
+  802312:	48 83 ec 18          	sub    $0x18,%rsp
+  802316:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802318:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80231c:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  802323:	00 00 00 
+  802326:	ff d0                	call   *%rax
+  802328:	85 c0                	test   %eax,%eax
+  80232a:	78 0c                	js     802338 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80232c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802330:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802333:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802338:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80233c:	c9                   	leave
+  80233d:	c3                   	ret
+
+000000000080233e <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80233e:	55                   	push   %rbp
+  80233f:	48 89 e5             	mov    %rsp,%rbp
+  802342:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802346:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80234a:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  802351:	00 00 00 
+  802354:	ff d0                	call   *%rax
+  802356:	85 c0                	test   %eax,%eax
+  802358:	78 07                	js     802361 <tell+0x23>
+    return fdes->fd_offset;
+  80235a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80235e:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802361:	c9                   	leave
+  802362:	c3                   	ret
+
+0000000000802363 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802363:	55                   	push   %rbp
+  802364:	48 89 e5             	mov    %rsp,%rbp
+  802367:	41 55                	push   %r13
+  802369:	41 54                	push   %r12
+  80236b:	53                   	push   %rbx
+  80236c:	48 83 ec 18          	sub    $0x18,%rsp
+  802370:	89 fb                	mov    %edi,%ebx
+  802372:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802375:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802379:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  802380:	00 00 00 
+  802383:	ff d0                	call   *%rax
+  802385:	85 c0                	test   %eax,%eax
+  802387:	78 38                	js     8023c1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802389:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80238d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802391:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802395:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  80239c:	00 00 00 
+  80239f:	ff d0                	call   *%rax
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	78 1c                	js     8023c1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023a5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8023aa:	74 20                	je     8023cc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8023ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023b0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8023b4:	48 85 c0             	test   %rax,%rax
+  8023b7:	74 47                	je     802400 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8023b9:	44 89 e6             	mov    %r12d,%esi
+  8023bc:	4c 89 ef             	mov    %r13,%rdi
+  8023bf:	ff d0                	call   *%rax
+}
+  8023c1:	48 83 c4 18          	add    $0x18,%rsp
+  8023c5:	5b                   	pop    %rbx
+  8023c6:	41 5c                	pop    %r12
+  8023c8:	41 5d                	pop    %r13
+  8023ca:	5d                   	pop    %rbp
+  8023cb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8023cc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8023d3:	00 00 00 
+  8023d6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8023dc:	89 da                	mov    %ebx,%edx
+  8023de:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  8023e5:	00 00 00 
+  8023e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ed:	48 b9 c6 02 80 00 00 	movabs $0x8002c6,%rcx
+  8023f4:	00 00 00 
+  8023f7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023fe:	eb c1                	jmp    8023c1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802400:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802405:	eb ba                	jmp    8023c1 <ftruncate+0x5e>
+
+0000000000802407 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802407:	55                   	push   %rbp
+  802408:	48 89 e5             	mov    %rsp,%rbp
+  80240b:	41 54                	push   %r12
+  80240d:	53                   	push   %rbx
+  80240e:	48 83 ec 10          	sub    $0x10,%rsp
+  802412:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802415:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802419:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  802420:	00 00 00 
+  802423:	ff d0                	call   *%rax
+  802425:	85 c0                	test   %eax,%eax
+  802427:	78 4e                	js     802477 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802429:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80242d:	41 8b 3c 24          	mov    (%r12),%edi
+  802431:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802435:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+  802441:	85 c0                	test   %eax,%eax
+  802443:	78 32                	js     802477 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802445:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802449:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80244e:	74 30                	je     802480 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802450:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802453:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80245a:	00 00 00 
+    stat->st_isdir = 0;
+  80245d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802464:	00 00 00 
+    stat->st_dev = dev;
+  802467:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80246e:	48 89 de             	mov    %rbx,%rsi
+  802471:	4c 89 e7             	mov    %r12,%rdi
+  802474:	ff 50 28             	call   *0x28(%rax)
+}
+  802477:	48 83 c4 10          	add    $0x10,%rsp
+  80247b:	5b                   	pop    %rbx
+  80247c:	41 5c                	pop    %r12
+  80247e:	5d                   	pop    %rbp
+  80247f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802480:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802485:	eb f0                	jmp    802477 <fstat+0x70>
+
+0000000000802487 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802487:	55                   	push   %rbp
+  802488:	48 89 e5             	mov    %rsp,%rbp
+  80248b:	41 54                	push   %r12
+  80248d:	53                   	push   %rbx
+  80248e:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802495:	41 89 fc             	mov    %edi,%r12d
+  802498:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80249a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80249e:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  8024a5:	00 00 00 
+  8024a8:	ff d0                	call   *%rax
+  8024aa:	85 c0                	test   %eax,%eax
+  8024ac:	78 31                	js     8024df <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8024ae:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8024b5:	44 89 e7             	mov    %r12d,%edi
+  8024b8:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  8024bf:	00 00 00 
+  8024c2:	ff d0                	call   *%rax
+  8024c4:	85 c0                	test   %eax,%eax
+  8024c6:	78 17                	js     8024df <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8024c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024cc:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8024cf:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8024d2:	39 d3                	cmp    %edx,%ebx
+  8024d4:	0f 4f da             	cmovg  %edx,%ebx
+  8024d7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8024da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024df:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8024e6:	5b                   	pop    %rbx
+  8024e7:	41 5c                	pop    %r12
+  8024e9:	5d                   	pop    %rbp
+  8024ea:	c3                   	ret
+
+00000000008024eb <seektoend>:
+{
+  8024eb:	55                   	push   %rbp
+  8024ec:	48 89 e5             	mov    %rsp,%rbp
+  8024ef:	53                   	push   %rbx
+  8024f0:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8024f7:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8024f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024fd:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  802504:	00 00 00 
+  802507:	ff d0                	call   *%rax
+  802509:	85 c0                	test   %eax,%eax
+  80250b:	78 28                	js     802535 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  80250d:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802514:	89 df                	mov    %ebx,%edi
+  802516:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  80251d:	00 00 00 
+  802520:	ff d0                	call   *%rax
+  802522:	85 c0                	test   %eax,%eax
+  802524:	78 0f                	js     802535 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802526:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802529:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80252d:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802530:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802535:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802539:	c9                   	leave
+  80253a:	c3                   	ret
+
+000000000080253b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80253b:	55                   	push   %rbp
+  80253c:	48 89 e5             	mov    %rsp,%rbp
+  80253f:	41 54                	push   %r12
+  802541:	53                   	push   %rbx
+  802542:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802545:	be 00 00 00 00       	mov    $0x0,%esi
+  80254a:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+  802556:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802558:	85 c0                	test   %eax,%eax
+  80255a:	78 25                	js     802581 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80255c:	4c 89 e6             	mov    %r12,%rsi
+  80255f:	89 c7                	mov    %eax,%edi
+  802561:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802568:	00 00 00 
+  80256b:	ff d0                	call   *%rax
+  80256d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802570:	89 df                	mov    %ebx,%edi
+  802572:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  802579:	00 00 00 
+  80257c:	ff d0                	call   *%rax
+
+    return res;
+  80257e:	44 89 e3             	mov    %r12d,%ebx
+}
+  802581:	89 d8                	mov    %ebx,%eax
+  802583:	5b                   	pop    %rbx
+  802584:	41 5c                	pop    %r12
+  802586:	5d                   	pop    %rbp
+  802587:	c3                   	ret
+
+0000000000802588 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802588:	55                   	push   %rbp
+  802589:	48 89 e5             	mov    %rsp,%rbp
+  80258c:	53                   	push   %rbx
+  80258d:	48 83 ec 08          	sub    $0x8,%rsp
+  802591:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802594:	48 b8 b4 1d 80 00 00 	movabs $0x801db4,%rax
+  80259b:	00 00 00 
+  80259e:	ff d0                	call   *%rax
+  8025a0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8025a4:	0f 87 ea 00 00 00    	ja     802694 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8025aa:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8025b1:	00 00 00 
+  8025b4:	80 38 00             	cmpb   $0x0,(%rax)
+  8025b7:	75 35                	jne    8025ee <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8025b9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8025be:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8025c3:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8025c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025cd:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  8025d4:	00 00 00 
+  8025d7:	ff d0                	call   *%rax
+  8025d9:	85 c0                	test   %eax,%eax
+  8025db:	0f 88 ba 00 00 00    	js     80269b <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  8025e1:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8025e8:	00 00 00 
+  8025eb:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  8025ee:	48 89 df             	mov    %rbx,%rdi
+  8025f1:	48 b8 b4 1d 80 00 00 	movabs $0x801db4,%rax
+  8025f8:	00 00 00 
+  8025fb:	ff d0                	call   *%rax
+  8025fd:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802601:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802608:	00 00 00 
+  80260b:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  80260f:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802612:	39 39                	cmp    %edi,(%rcx)
+  802614:	74 46                	je     80265c <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802616:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  80261a:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802621:	00 
+  802622:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802629:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802630:	00 
+  802631:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802638:	00 
+  802639:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802640:	00 
+  802641:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802648:	00 
+  802649:	89 39                	mov    %edi,(%rcx)
+  80264b:	48 01 c6             	add    %rax,%rsi
+  80264e:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802653:	48 89 c8             	mov    %rcx,%rax
+  802656:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80265a:	c9                   	leave
+  80265b:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80265c:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802660:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802667:	00 00 00 
+  80266a:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80266d:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802671:	74 e0                	je     802653 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802673:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80267a:	00 
+  80267b:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80267f:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802686:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802688:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80268b:	48 01 c2             	add    %rax,%rdx
+  80268e:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802692:	eb bf                	jmp    802653 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802694:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802699:	eb b8                	jmp    802653 <fbuf_get+0xcb>
+            return NULL;
+  80269b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026a0:	eb b1                	jmp    802653 <fbuf_get+0xcb>
+
+00000000008026a2 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8026a2:	55                   	push   %rbp
+  8026a3:	48 89 e5             	mov    %rsp,%rbp
+  8026a6:	53                   	push   %rbx
+  8026a7:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8026ab:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8026b2:	00 00 00 
+  8026b5:	48 8b 18             	mov    (%rax),%rbx
+  8026b8:	48 85 db             	test   %rbx,%rbx
+  8026bb:	74 16                	je     8026d3 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8026bd:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8026c4:	00 00 00 
+  8026c7:	48 8b 18             	mov    (%rax),%rbx
+}
+  8026ca:	48 89 d8             	mov    %rbx,%rax
+  8026cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8026d3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8026d8:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8026dd:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8026e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026e7:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  8026ee:	00 00 00 
+  8026f1:	ff d0                	call   *%rax
+  8026f3:	85 c0                	test   %eax,%eax
+  8026f5:	78 d3                	js     8026ca <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8026f7:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8026fc:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802703:	00 00 00 
+  802706:	eb b5                	jmp    8026bd <fsipc_bulk+0x1b>
+
+0000000000802708 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802708:	55                   	push   %rbp
+  802709:	48 89 e5             	mov    %rsp,%rbp
+  80270c:	41 57                	push   %r15
+  80270e:	41 56                	push   %r14
+  802710:	41 55                	push   %r13
+  802712:	41 54                	push   %r12
+  802714:	53                   	push   %rbx
+  802715:	48 83 ec 08          	sub    $0x8,%rsp
+  802719:	41 89 fd             	mov    %edi,%r13d
+  80271c:	49 89 f6             	mov    %rsi,%r14
+  80271f:	49 89 d7             	mov    %rdx,%r15
+  802722:	48 89 cb             	mov    %rcx,%rbx
+  802725:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802728:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80272f:	00 00 00 
+  802732:	83 38 00             	cmpl   $0x0,(%rax)
+  802735:	74 52                	je     802789 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802737:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80273d:	4c 89 f9             	mov    %r15,%rcx
+  802740:	4c 89 f2             	mov    %r14,%rdx
+  802743:	44 89 ee             	mov    %r13d,%esi
+  802746:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  80274d:	00 00 00 
+  802750:	8b 38                	mov    (%rax),%edi
+  802752:	48 b8 74 4a 80 00 00 	movabs $0x804a74,%rax
+  802759:	00 00 00 
+  80275c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80275e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802763:	4c 89 e2             	mov    %r12,%rdx
+  802766:	48 89 de             	mov    %rbx,%rsi
+  802769:	bf 00 00 00 00       	mov    $0x0,%edi
+  80276e:	48 b8 c4 48 80 00 00 	movabs $0x8048c4,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+}
+  80277a:	48 83 c4 08          	add    $0x8,%rsp
+  80277e:	5b                   	pop    %rbx
+  80277f:	41 5c                	pop    %r12
+  802781:	41 5d                	pop    %r13
+  802783:	41 5e                	pop    %r14
+  802785:	41 5f                	pop    %r15
+  802787:	5d                   	pop    %rbp
+  802788:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802789:	bf 03 00 00 00       	mov    $0x3,%edi
+  80278e:	48 b8 17 4b 80 00 00 	movabs $0x804b17,%rax
+  802795:	00 00 00 
+  802798:	ff d0                	call   *%rax
+  80279a:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  8027a1:	00 00 
+  8027a3:	eb 92                	jmp    802737 <fsipc_region+0x2f>
+
+00000000008027a5 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8027a5:	55                   	push   %rbp
+  8027a6:	48 89 e5             	mov    %rsp,%rbp
+  8027a9:	41 57                	push   %r15
+  8027ab:	41 56                	push   %r14
+  8027ad:	41 55                	push   %r13
+  8027af:	41 54                	push   %r12
+  8027b1:	53                   	push   %rbx
+  8027b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8027b6:	49 89 ff             	mov    %rdi,%r15
+  8027b9:	49 89 f6             	mov    %rsi,%r14
+  8027bc:	48 89 d3             	mov    %rdx,%rbx
+  8027bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8027c3:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8027c6:	48 b8 a2 26 80 00 00 	movabs $0x8026a2,%rax
+  8027cd:	00 00 00 
+  8027d0:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8027d2:	48 85 c0             	test   %rax,%rax
+  8027d5:	0f 84 cc 00 00 00    	je     8028a7 <devfile_write_direct+0x102>
+  8027db:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8027de:	48 85 db             	test   %rbx,%rbx
+  8027e1:	0f 84 ba 00 00 00    	je     8028a1 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8027e7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8027ed:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8027f4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8027f8:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8027fc:	4c 29 e3             	sub    %r12,%rbx
+  8027ff:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802804:	48 39 c3             	cmp    %rax,%rbx
+  802807:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80280b:	48 89 da             	mov    %rbx,%rdx
+  80280e:	4c 89 f6             	mov    %r14,%rsi
+  802811:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802815:	48 b8 33 10 80 00 00 	movabs $0x801033,%rax
+  80281c:	00 00 00 
+  80281f:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802821:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802825:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802829:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80282c:	44 01 e0             	add    %r12d,%eax
+  80282f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802833:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802837:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  80283e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802845:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  80284c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802852:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802857:	4c 89 ee             	mov    %r13,%rsi
+  80285a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80285f:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  802866:	00 00 00 
+  802869:	ff d0                	call   *%rax
+        if (res < 0)
+  80286b:	85 c0                	test   %eax,%eax
+  80286d:	78 29                	js     802898 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80286f:	74 2b                	je     80289c <devfile_write_direct+0xf7>
+        i += res;
+  802871:	48 98                	cltq
+  802873:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802876:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802879:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80287d:	49 39 c4             	cmp    %rax,%r12
+  802880:	0f 82 72 ff ff ff    	jb     8027f8 <devfile_write_direct+0x53>
+    return i;
+  802886:	4c 89 e0             	mov    %r12,%rax
+}
+  802889:	48 83 c4 28          	add    $0x28,%rsp
+  80288d:	5b                   	pop    %rbx
+  80288e:	41 5c                	pop    %r12
+  802890:	41 5d                	pop    %r13
+  802892:	41 5e                	pop    %r14
+  802894:	41 5f                	pop    %r15
+  802896:	5d                   	pop    %rbp
+  802897:	c3                   	ret
+            return res;
+  802898:	48 98                	cltq
+  80289a:	eb ed                	jmp    802889 <devfile_write_direct+0xe4>
+            return i;
+  80289c:	4c 89 e0             	mov    %r12,%rax
+  80289f:	eb e8                	jmp    802889 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  8028a1:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  8028a5:	eb df                	jmp    802886 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  8028a7:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8028ae:	eb d9                	jmp    802889 <devfile_write_direct+0xe4>
+
+00000000008028b0 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8028b0:	55                   	push   %rbp
+  8028b1:	48 89 e5             	mov    %rsp,%rbp
+  8028b4:	41 56                	push   %r14
+  8028b6:	41 55                	push   %r13
+  8028b8:	41 54                	push   %r12
+  8028ba:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8028bb:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8028bf:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8028c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c8:	4d 39 ee             	cmp    %r13,%r14
+  8028cb:	0f 84 99 00 00 00    	je     80296a <fbuf_flush+0xba>
+  8028d1:	49 89 fc             	mov    %rdi,%r12
+  8028d4:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8028d7:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8028da:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8028de:	48 b8 b4 1d 80 00 00 	movabs $0x801db4,%rax
+  8028e5:	00 00 00 
+  8028e8:	ff d0                	call   *%rax
+  8028ea:	48 89 c2             	mov    %rax,%rdx
+  8028ed:	48 c1 e2 04          	shl    $0x4,%rdx
+  8028f1:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8028f5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8028f9:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8028fe:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802901:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802905:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80290c:	00 
+  80290d:	44 89 f1             	mov    %r14d,%ecx
+  802910:	4c 89 ea             	mov    %r13,%rdx
+  802913:	4c 89 e7             	mov    %r12,%rdi
+  802916:	48 b8 a5 27 80 00 00 	movabs $0x8027a5,%rax
+  80291d:	00 00 00 
+  802920:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802922:	48 85 c0             	test   %rax,%rax
+  802925:	78 43                	js     80296a <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802927:	4c 39 e8             	cmp    %r13,%rax
+  80292a:	72 47                	jb     802973 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  80292c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802931:	83 c0 01             	add    $0x1,%eax
+  802934:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802939:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  80293c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802940:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802944:	72 0f                	jb     802955 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802946:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80294a:	48 39 c2             	cmp    %rax,%rdx
+  80294d:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802951:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802955:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80295c:	00 
+  80295d:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802964:	00 
+    return 0;
+  802965:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80296a:	5b                   	pop    %rbx
+  80296b:	41 5c                	pop    %r12
+  80296d:	41 5d                	pop    %r13
+  80296f:	41 5e                	pop    %r14
+  802971:	5d                   	pop    %rbp
+  802972:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802973:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802978:	eb f0                	jmp    80296a <fbuf_flush+0xba>
+
+000000000080297a <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80297a:	55                   	push   %rbp
+  80297b:	48 89 e5             	mov    %rsp,%rbp
+  80297e:	53                   	push   %rbx
+  80297f:	48 83 ec 08          	sub    $0x8,%rsp
+  802983:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802986:	48 b8 88 25 80 00 00 	movabs $0x802588,%rax
+  80298d:	00 00 00 
+  802990:	ff d0                	call   *%rax
+  802992:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299a:	48 85 f6             	test   %rsi,%rsi
+  80299d:	74 0f                	je     8029ae <devfile_sync+0x34>
+  80299f:	48 89 df             	mov    %rbx,%rdi
+  8029a2:	48 b8 b0 28 80 00 00 	movabs $0x8028b0,%rax
+  8029a9:	00 00 00 
+  8029ac:	ff d0                	call   *%rax
+}
+  8029ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029b2:	c9                   	leave
+  8029b3:	c3                   	ret
+
+00000000008029b4 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8029b4:	55                   	push   %rbp
+  8029b5:	48 89 e5             	mov    %rsp,%rbp
+  8029b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8029bc:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8029bf:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8029c6:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8029c7:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8029cb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029d0:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8029d7:	00 00 00 
+  8029da:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  8029e1:	00 00 00 
+  8029e4:	ff d0                	call   *%rax
+}
+  8029e6:	c9                   	leave
+  8029e7:	c3                   	ret
+
+00000000008029e8 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8029e8:	55                   	push   %rbp
+  8029e9:	48 89 e5             	mov    %rsp,%rbp
+  8029ec:	41 54                	push   %r12
+  8029ee:	53                   	push   %rbx
+  8029ef:	48 89 fb             	mov    %rdi,%rbx
+  8029f2:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8029f5:	48 b8 7a 29 80 00 00 	movabs $0x80297a,%rax
+  8029fc:	00 00 00 
+  8029ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a01:	85 c0                	test   %eax,%eax
+  802a03:	78 63                	js     802a68 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802a05:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802a08:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802a0f:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802a11:	be 00 00 00 00       	mov    $0x0,%esi
+  802a16:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a1b:	48 b8 b4 29 80 00 00 	movabs $0x8029b4,%rax
+  802a22:	00 00 00 
+  802a25:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a27:	85 c0                	test   %eax,%eax
+  802a29:	78 3d                	js     802a68 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a2b:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802a32:	00 00 00 
+  802a35:	48 89 de             	mov    %rbx,%rsi
+  802a38:	4c 89 e7             	mov    %r12,%rdi
+  802a3b:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  802a42:	00 00 00 
+  802a45:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802a47:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802a4d:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802a54:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a55:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802a5b:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802a62:	00 
+
+    return 0;
+  802a63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a68:	5b                   	pop    %rbx
+  802a69:	41 5c                	pop    %r12
+  802a6b:	5d                   	pop    %rbp
+  802a6c:	c3                   	ret
+
+0000000000802a6d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802a6d:	55                   	push   %rbp
+  802a6e:	48 89 e5             	mov    %rsp,%rbp
+  802a71:	41 54                	push   %r12
+  802a73:	53                   	push   %rbx
+  802a74:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802a77:	48 b8 7a 29 80 00 00 	movabs $0x80297a,%rax
+  802a7e:	00 00 00 
+  802a81:	ff d0                	call   *%rax
+  802a83:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802a86:	48 89 df             	mov    %rbx,%rdi
+  802a89:	48 b8 b4 1d 80 00 00 	movabs $0x801db4,%rax
+  802a90:	00 00 00 
+  802a93:	ff d0                	call   *%rax
+  802a95:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802a99:	76 2e                	jbe    802ac9 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802a9b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802a9e:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802aa5:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802aa7:	be 00 00 00 00       	mov    $0x0,%esi
+  802aac:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ab1:	48 b8 b4 29 80 00 00 	movabs $0x8029b4,%rax
+  802ab8:	00 00 00 
+  802abb:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802abd:	45 85 e4             	test   %r12d,%r12d
+  802ac0:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802ac4:	5b                   	pop    %rbx
+  802ac5:	41 5c                	pop    %r12
+  802ac7:	5d                   	pop    %rbp
+  802ac8:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802ac9:	48 89 df             	mov    %rbx,%rdi
+  802acc:	48 b8 b4 1d 80 00 00 	movabs $0x801db4,%rax
+  802ad3:	00 00 00 
+  802ad6:	ff d0                	call   *%rax
+  802ad8:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802adc:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802ae3:	00 00 00 
+  802ae6:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802aed:	48 89 df             	mov    %rbx,%rdi
+  802af0:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  802af7:	00 00 00 
+  802afa:	ff d0                	call   *%rax
+  802afc:	48 89 c6             	mov    %rax,%rsi
+  802aff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b04:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b09:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  802b10:	00 00 00 
+  802b13:	ff d0                	call   *%rax
+  802b15:	eb 84                	jmp    802a9b <devfile_flush+0x2e>
+
+0000000000802b17 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802b17:	55                   	push   %rbp
+  802b18:	48 89 e5             	mov    %rsp,%rbp
+  802b1b:	41 55                	push   %r13
+  802b1d:	41 54                	push   %r12
+  802b1f:	53                   	push   %rbx
+  802b20:	48 83 ec 08          	sub    $0x8,%rsp
+  802b24:	48 89 fb             	mov    %rdi,%rbx
+  802b27:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802b2a:	48 b8 88 25 80 00 00 	movabs $0x802588,%rax
+  802b31:	00 00 00 
+  802b34:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802b36:	48 85 c0             	test   %rax,%rax
+  802b39:	74 51                	je     802b8c <devfile_trunc+0x75>
+  802b3b:	49 89 c4             	mov    %rax,%r12
+  802b3e:	48 89 c6             	mov    %rax,%rsi
+  802b41:	48 89 df             	mov    %rbx,%rdi
+  802b44:	48 b8 b0 28 80 00 00 	movabs $0x8028b0,%rax
+  802b4b:	00 00 00 
+  802b4e:	ff d0                	call   *%rax
+  802b50:	85 c0                	test   %eax,%eax
+  802b52:	78 2d                	js     802b81 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802b54:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802b5b:	00 00 00 
+  802b5e:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802b61:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802b63:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802b67:	be 00 00 00 00       	mov    $0x0,%esi
+  802b6c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802b71:	48 b8 b4 29 80 00 00 	movabs $0x8029b4,%rax
+  802b78:	00 00 00 
+  802b7b:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802b7d:	85 c0                	test   %eax,%eax
+  802b7f:	79 3e                	jns    802bbf <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802b81:	48 83 c4 08          	add    $0x8,%rsp
+  802b85:	5b                   	pop    %rbx
+  802b86:	41 5c                	pop    %r12
+  802b88:	41 5d                	pop    %r13
+  802b8a:	5d                   	pop    %rbp
+  802b8b:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802b8c:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802b93:	00 00 00 
+  802b96:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802b99:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802b9b:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802b9f:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba4:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ba9:	48 b8 b4 29 80 00 00 	movabs $0x8029b4,%rax
+  802bb0:	00 00 00 
+  802bb3:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802bb5:	85 c0                	test   %eax,%eax
+  802bb7:	78 c8                	js     802b81 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802bb9:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802bbd:	eb c2                	jmp    802b81 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802bbf:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802bc2:	8d 51 01             	lea    0x1(%rcx),%edx
+  802bc5:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802bc8:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802bcd:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802bd4:	00 00 
+  802bd6:	eb a9                	jmp    802b81 <devfile_trunc+0x6a>
+
+0000000000802bd8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802bd8:	55                   	push   %rbp
+  802bd9:	48 89 e5             	mov    %rsp,%rbp
+  802bdc:	41 57                	push   %r15
+  802bde:	41 56                	push   %r14
+  802be0:	41 55                	push   %r13
+  802be2:	41 54                	push   %r12
+  802be4:	53                   	push   %rbx
+  802be5:	48 83 ec 28          	sub    $0x28,%rsp
+  802be9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802bed:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802bf1:	49 89 d7             	mov    %rdx,%r15
+  802bf4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802bf8:	48 b8 88 25 80 00 00 	movabs $0x802588,%rax
+  802bff:	00 00 00 
+  802c02:	ff d0                	call   *%rax
+  802c04:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802c07:	48 85 c0             	test   %rax,%rax
+  802c0a:	74 31                	je     802c3d <devfile_write+0x65>
+  802c0c:	4c 89 f8             	mov    %r15,%rax
+  802c0f:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802c16:	77 25                	ja     802c3d <devfile_write+0x65>
+    size_t i = 0;
+  802c18:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802c1e:	48 85 c0             	test   %rax,%rax
+  802c21:	0f 85 64 01 00 00    	jne    802d8b <devfile_write+0x1b3>
+    size_t i = 0;
+  802c27:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802c2b:	4c 89 f8             	mov    %r15,%rax
+}
+  802c2e:	48 83 c4 28          	add    $0x28,%rsp
+  802c32:	5b                   	pop    %rbx
+  802c33:	41 5c                	pop    %r12
+  802c35:	41 5d                	pop    %r13
+  802c37:	41 5e                	pop    %r14
+  802c39:	41 5f                	pop    %r15
+  802c3b:	5d                   	pop    %rbp
+  802c3c:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802c3d:	48 85 db             	test   %rbx,%rbx
+  802c40:	74 5b                	je     802c9d <devfile_write+0xc5>
+  802c42:	48 89 de             	mov    %rbx,%rsi
+  802c45:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c49:	48 b8 b0 28 80 00 00 	movabs $0x8028b0,%rax
+  802c50:	00 00 00 
+  802c53:	ff d0                	call   *%rax
+  802c55:	85 c0                	test   %eax,%eax
+  802c57:	78 40                	js     802c99 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802c59:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c5d:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802c60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c64:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802c68:	48 b8 a5 27 80 00 00 	movabs $0x8027a5,%rax
+  802c6f:	00 00 00 
+  802c72:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802c74:	48 85 c0             	test   %rax,%rax
+  802c77:	7e b5                	jle    802c2e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802c79:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802c7d:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802c80:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802c83:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802c86:	8d 51 01             	lea    0x1(%rcx),%edx
+  802c89:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c8c:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802c8f:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802c96:	00 
+  802c97:	eb 95                	jmp    802c2e <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802c99:	48 98                	cltq
+  802c9b:	eb 91                	jmp    802c2e <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802c9d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802ca1:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802ca4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ca8:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802cac:	48 89 df             	mov    %rbx,%rdi
+  802caf:	48 b8 a5 27 80 00 00 	movabs $0x8027a5,%rax
+  802cb6:	00 00 00 
+  802cb9:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802cbb:	48 85 c0             	test   %rax,%rax
+  802cbe:	0f 8e 6a ff ff ff    	jle    802c2e <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802cc4:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802cc7:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ccb:	e9 5e ff ff ff       	jmp    802c2e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802cd0:	48 98                	cltq
+  802cd2:	4d 85 ff             	test   %r15,%r15
+  802cd5:	49 0f 45 c7          	cmovne %r15,%rax
+  802cd9:	e9 50 ff ff ff       	jmp    802c2e <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802cde:	48 89 de             	mov    %rbx,%rsi
+  802ce1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802ce5:	48 b8 b0 28 80 00 00 	movabs $0x8028b0,%rax
+  802cec:	00 00 00 
+  802cef:	ff d0                	call   *%rax
+  802cf1:	85 c0                	test   %eax,%eax
+  802cf3:	0f 88 2b 01 00 00    	js     802e24 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802cf9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802cfd:	4c 01 f8             	add    %r15,%rax
+  802d00:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802d04:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d08:	48 b9 b4 1d 80 00 00 	movabs $0x801db4,%rcx
+  802d0f:	00 00 00 
+  802d12:	ff d1                	call   *%rcx
+  802d14:	48 89 c2             	mov    %rax,%rdx
+  802d17:	48 c1 e2 04          	shl    $0x4,%rdx
+  802d1b:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802d1f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d23:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802d28:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802d2b:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802d32:	00 
+  802d33:	4c 89 ea             	mov    %r13,%rdx
+  802d36:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802d3a:	48 b8 33 10 80 00 00 	movabs $0x801033,%rax
+  802d41:	00 00 00 
+  802d44:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802d46:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802d4a:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802d4e:	48 39 c2             	cmp    %rax,%rdx
+  802d51:	0f 84 db 00 00 00    	je     802e32 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802d57:	4c 39 e2             	cmp    %r12,%rdx
+  802d5a:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802d5e:	4d 01 ec             	add    %r13,%r12
+  802d61:	49 39 c4             	cmp    %rax,%r12
+  802d64:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802d68:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802d6c:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802d70:	45 01 ee             	add    %r13d,%r14d
+  802d73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d77:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802d7b:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802d7e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d82:	49 39 c7             	cmp    %rax,%r15
+  802d85:	0f 83 a0 fe ff ff    	jae    802c2b <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802d8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d8f:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802d93:	8b 43 08             	mov    0x8(%rbx),%eax
+  802d96:	44 39 f0             	cmp    %r14d,%eax
+  802d99:	7f 10                	jg     802dab <devfile_write+0x1d3>
+  802d9b:	48 98                	cltq
+  802d9d:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802da3:	49 63 d6             	movslq %r14d,%rdx
+  802da6:	48 39 d0             	cmp    %rdx,%rax
+  802da9:	7d 2d                	jge    802dd8 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802dab:	48 89 de             	mov    %rbx,%rsi
+  802dae:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802db2:	48 b8 b0 28 80 00 00 	movabs $0x8028b0,%rax
+  802db9:	00 00 00 
+  802dbc:	ff d0                	call   *%rax
+  802dbe:	85 c0                	test   %eax,%eax
+  802dc0:	0f 88 0a ff ff ff    	js     802cd0 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802dc6:	44 89 f0             	mov    %r14d,%eax
+  802dc9:	66 b8 00 00          	mov    $0x0,%ax
+  802dcd:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802dd0:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802dd7:	00 
+        size_t off = pos - fb->fb_base;
+  802dd8:	45 89 f4             	mov    %r14d,%r12d
+  802ddb:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802ddf:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802de2:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802de6:	4d 29 fd             	sub    %r15,%r13
+  802de9:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802dee:	4c 29 e0             	sub    %r12,%rax
+  802df1:	49 39 c5             	cmp    %rax,%r13
+  802df4:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802df8:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802dfc:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802e00:	48 39 c2             	cmp    %rax,%rdx
+  802e03:	0f 84 f0 fe ff ff    	je     802cf9 <devfile_write+0x121>
+  802e09:	4c 39 e0             	cmp    %r12,%rax
+  802e0c:	0f 82 cc fe ff ff    	jb     802cde <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802e12:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802e16:	48 39 d0             	cmp    %rdx,%rax
+  802e19:	0f 83 da fe ff ff    	jae    802cf9 <devfile_write+0x121>
+  802e1f:	e9 ba fe ff ff       	jmp    802cde <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e24:	48 98                	cltq
+  802e26:	4d 85 ff             	test   %r15,%r15
+  802e29:	49 0f 45 c7          	cmovne %r15,%rax
+  802e2d:	e9 fc fd ff ff       	jmp    802c2e <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802e32:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802e36:	4c 89 e2             	mov    %r12,%rdx
+  802e39:	e9 2a ff ff ff       	jmp    802d68 <devfile_write+0x190>
+
+0000000000802e3e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e3e:	55                   	push   %rbp
+  802e3f:	48 89 e5             	mov    %rsp,%rbp
+  802e42:	41 57                	push   %r15
+  802e44:	41 56                	push   %r14
+  802e46:	41 55                	push   %r13
+  802e48:	41 54                	push   %r12
+  802e4a:	53                   	push   %rbx
+  802e4b:	48 83 ec 28          	sub    $0x28,%rsp
+  802e4f:	49 89 ff             	mov    %rdi,%r15
+  802e52:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802e56:	48 89 d3             	mov    %rdx,%rbx
+  802e59:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802e5d:	48 b8 88 25 80 00 00 	movabs $0x802588,%rax
+  802e64:	00 00 00 
+  802e67:	ff d0                	call   *%rax
+  802e69:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802e6c:	48 85 c0             	test   %rax,%rax
+  802e6f:	74 0d                	je     802e7e <devfile_read+0x40>
+  802e71:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802e78:	0f 86 1a 01 00 00    	jbe    802f98 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e7e:	4d 85 e4             	test   %r12,%r12
+  802e81:	74 1a                	je     802e9d <devfile_read+0x5f>
+  802e83:	4c 89 e6             	mov    %r12,%rsi
+  802e86:	4c 89 ff             	mov    %r15,%rdi
+  802e89:	48 b8 b0 28 80 00 00 	movabs $0x8028b0,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+  802e95:	85 c0                	test   %eax,%eax
+  802e97:	0f 88 e8 00 00 00    	js     802f85 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802e9d:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802ea1:	48 b8 a2 26 80 00 00 	movabs $0x8026a2,%rax
+  802ea8:	00 00 00 
+  802eab:	ff d0                	call   *%rax
+  802ead:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802eb0:	48 85 c0             	test   %rax,%rax
+  802eb3:	0f 84 69 02 00 00    	je     803122 <devfile_read+0x2e4>
+    while (i < n) {
+  802eb9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802ebe:	0f 84 ce 00 00 00    	je     802f92 <devfile_read+0x154>
+    size_t i = 0;
+  802ec4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802ec9:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802ed0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ed4:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802ed8:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802edc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802ee0:	48 29 da             	sub    %rbx,%rdx
+  802ee3:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802ee8:	48 39 c2             	cmp    %rax,%rdx
+  802eeb:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802eef:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802ef3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802ef7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802efa:	01 d8                	add    %ebx,%eax
+  802efc:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802f00:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802f04:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802f0b:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802f12:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802f19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f24:	4c 89 ee             	mov    %r13,%rsi
+  802f27:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f2c:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  802f33:	00 00 00 
+  802f36:	ff d0                	call   *%rax
+        if (res < 0)
+  802f38:	85 c0                	test   %eax,%eax
+  802f3a:	78 4d                	js     802f89 <devfile_read+0x14b>
+        if (res == 0)
+  802f3c:	74 4f                	je     802f8d <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802f3e:	4c 63 e0             	movslq %eax,%r12
+  802f41:	4c 89 e2             	mov    %r12,%rdx
+  802f44:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802f48:	4c 89 f7             	mov    %r14,%rdi
+  802f4b:	48 b8 33 10 80 00 00 	movabs $0x801033,%rax
+  802f52:	00 00 00 
+  802f55:	ff d0                	call   *%rax
+        i += res;
+  802f57:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  802f5a:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  802f5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f61:	48 39 c3             	cmp    %rax,%rbx
+  802f64:	0f 82 72 ff ff ff    	jb     802edc <devfile_read+0x9e>
+    return i;
+  802f6a:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802f6d:	48 85 c0             	test   %rax,%rax
+  802f70:	7e 04                	jle    802f76 <devfile_read+0x138>
+  802f72:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  802f76:	48 83 c4 28          	add    $0x28,%rsp
+  802f7a:	5b                   	pop    %rbx
+  802f7b:	41 5c                	pop    %r12
+  802f7d:	41 5d                	pop    %r13
+  802f7f:	41 5e                	pop    %r14
+  802f81:	41 5f                	pop    %r15
+  802f83:	5d                   	pop    %rbp
+  802f84:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f85:	48 98                	cltq
+  802f87:	eb ed                	jmp    802f76 <devfile_read+0x138>
+            return res;
+  802f89:	48 98                	cltq
+  802f8b:	eb e9                	jmp    802f76 <devfile_read+0x138>
+            return i;
+  802f8d:	48 89 d8             	mov    %rbx,%rax
+  802f90:	eb db                	jmp    802f6d <devfile_read+0x12f>
+    size_t i = 0;
+  802f92:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f96:	eb d2                	jmp    802f6a <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802f98:	48 89 c6             	mov    %rax,%rsi
+  802f9b:	4c 89 ff             	mov    %r15,%rdi
+  802f9e:	48 b8 b0 28 80 00 00 	movabs $0x8028b0,%rax
+  802fa5:	00 00 00 
+  802fa8:	ff d0                	call   *%rax
+  802faa:	85 c0                	test   %eax,%eax
+  802fac:	78 40                	js     802fee <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802fae:	4c 89 ff             	mov    %r15,%rdi
+  802fb1:	48 b8 b4 1d 80 00 00 	movabs $0x801db4,%rax
+  802fb8:	00 00 00 
+  802fbb:	ff d0                	call   *%rax
+  802fbd:	48 89 c2             	mov    %rax,%rdx
+  802fc0:	48 c1 e2 04          	shl    $0x4,%rdx
+  802fc4:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802fc8:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fcc:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802fd1:	48 01 d0             	add    %rdx,%rax
+  802fd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  802fd8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802fdd:	0f 84 33 01 00 00    	je     803116 <devfile_read+0x2d8>
+    size_t i = 0;
+  802fe3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802fe9:	e9 f5 00 00 00       	jmp    8030e3 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  802fee:	48 98                	cltq
+  802ff0:	eb 84                	jmp    802f76 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802ff2:	44 89 e8             	mov    %r13d,%eax
+  802ff5:	66 b8 00 00          	mov    $0x0,%ax
+  802ff9:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  802ffe:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803005:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803007:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80300b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80300f:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803011:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803016:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803019:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803020:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803021:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803027:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80302c:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803031:	bf 03 00 00 00       	mov    $0x3,%edi
+  803036:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  80303d:	00 00 00 
+  803040:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803042:	85 c0                	test   %eax,%eax
+  803044:	0f 88 be 00 00 00    	js     803108 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80304a:	48 63 d0             	movslq %eax,%rdx
+  80304d:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803052:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803057:	44 39 e8             	cmp    %r13d,%eax
+  80305a:	0f 8e ba 00 00 00    	jle    80311a <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803060:	49 63 c5             	movslq %r13d,%rax
+  803063:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803068:	48 29 c3             	sub    %rax,%rbx
+  80306b:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803070:	48 01 c3             	add    %rax,%rbx
+  803073:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803077:	4c 29 f0             	sub    %r14,%rax
+  80307a:	48 39 c3             	cmp    %rax,%rbx
+  80307d:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803081:	4c 89 ff             	mov    %r15,%rdi
+  803084:	48 b9 b4 1d 80 00 00 	movabs $0x801db4,%rcx
+  80308b:	00 00 00 
+  80308e:	ff d1                	call   *%rcx
+  803090:	48 89 c2             	mov    %rax,%rdx
+  803093:	48 c1 e2 04          	shl    $0x4,%rdx
+  803097:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80309b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80309f:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8030a4:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8030a7:	44 89 ea             	mov    %r13d,%edx
+  8030aa:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8030af:	48 63 d2             	movslq %edx,%rdx
+  8030b2:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8030b9:	00 
+  8030ba:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8030be:	4c 01 f7             	add    %r14,%rdi
+  8030c1:	48 89 da             	mov    %rbx,%rdx
+  8030c4:	48 b9 33 10 80 00 00 	movabs $0x801033,%rcx
+  8030cb:	00 00 00 
+  8030ce:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8030d0:	41 01 dd             	add    %ebx,%r13d
+  8030d3:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8030d7:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8030da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030de:	49 39 c6             	cmp    %rax,%r14
+  8030e1:	73 37                	jae    80311a <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8030e3:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8030e7:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8030ec:	44 39 e8             	cmp    %r13d,%eax
+  8030ef:	0f 8f fd fe ff ff    	jg     802ff2 <devfile_read+0x1b4>
+  8030f5:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8030fa:	44 39 e8             	cmp    %r13d,%eax
+  8030fd:	0f 8f 5d ff ff ff    	jg     803060 <devfile_read+0x222>
+  803103:	e9 ea fe ff ff       	jmp    802ff2 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803108:	48 98                	cltq
+  80310a:	4d 85 f6             	test   %r14,%r14
+  80310d:	49 0f 45 c6          	cmovne %r14,%rax
+  803111:	e9 60 fe ff ff       	jmp    802f76 <devfile_read+0x138>
+    size_t i = 0;
+  803116:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80311a:	4c 89 f0             	mov    %r14,%rax
+  80311d:	e9 54 fe ff ff       	jmp    802f76 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803122:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803129:	e9 48 fe ff ff       	jmp    802f76 <devfile_read+0x138>
+
+000000000080312e <open>:
+open(const char *path, int mode) {
+  80312e:	55                   	push   %rbp
+  80312f:	48 89 e5             	mov    %rsp,%rbp
+  803132:	41 55                	push   %r13
+  803134:	41 54                	push   %r12
+  803136:	53                   	push   %rbx
+  803137:	48 83 ec 18          	sub    $0x18,%rsp
+  80313b:	49 89 fc             	mov    %rdi,%r12
+  80313e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803141:	48 b8 00 0c 80 00 00 	movabs $0x800c00,%rax
+  803148:	00 00 00 
+  80314b:	ff d0                	call   *%rax
+  80314d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803153:	0f 87 8a 00 00 00    	ja     8031e3 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803159:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80315d:	48 b8 e2 1d 80 00 00 	movabs $0x801de2,%rax
+  803164:	00 00 00 
+  803167:	ff d0                	call   *%rax
+  803169:	89 c3                	mov    %eax,%ebx
+  80316b:	85 c0                	test   %eax,%eax
+  80316d:	78 50                	js     8031bf <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80316f:	4c 89 e6             	mov    %r12,%rsi
+  803172:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803179:	00 00 00 
+  80317c:	48 89 df             	mov    %rbx,%rdi
+  80317f:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  803186:	00 00 00 
+  803189:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80318b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803192:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803196:	bf 01 00 00 00       	mov    $0x1,%edi
+  80319b:	48 b8 b4 29 80 00 00 	movabs $0x8029b4,%rax
+  8031a2:	00 00 00 
+  8031a5:	ff d0                	call   *%rax
+  8031a7:	89 c3                	mov    %eax,%ebx
+  8031a9:	85 c0                	test   %eax,%eax
+  8031ab:	78 1f                	js     8031cc <open+0x9e>
+    return fd2num(fd);
+  8031ad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031b1:	48 b8 b4 1d 80 00 00 	movabs $0x801db4,%rax
+  8031b8:	00 00 00 
+  8031bb:	ff d0                	call   *%rax
+  8031bd:	89 c3                	mov    %eax,%ebx
+}
+  8031bf:	89 d8                	mov    %ebx,%eax
+  8031c1:	48 83 c4 18          	add    $0x18,%rsp
+  8031c5:	5b                   	pop    %rbx
+  8031c6:	41 5c                	pop    %r12
+  8031c8:	41 5d                	pop    %r13
+  8031ca:	5d                   	pop    %rbp
+  8031cb:	c3                   	ret
+        fd_close(fd, 0);
+  8031cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8031d1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031d5:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  8031dc:	00 00 00 
+  8031df:	ff d0                	call   *%rax
+        return res;
+  8031e1:	eb dc                	jmp    8031bf <open+0x91>
+        return -E_BAD_PATH;
+  8031e3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8031e8:	eb d5                	jmp    8031bf <open+0x91>
+
+00000000008031ea <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8031ea:	55                   	push   %rbp
+  8031eb:	48 89 e5             	mov    %rsp,%rbp
+  8031ee:	41 57                	push   %r15
+  8031f0:	41 56                	push   %r14
+  8031f2:	41 55                	push   %r13
+  8031f4:	41 54                	push   %r12
+  8031f6:	53                   	push   %rbx
+  8031f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8031fb:	41 89 f6             	mov    %esi,%r14d
+  8031fe:	49 89 d7             	mov    %rdx,%r15
+  803201:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803204:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803208:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  80320f:	00 00 00 
+  803212:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803214:	85 c0                	test   %eax,%eax
+  803216:	0f 88 db 00 00 00    	js     8032f7 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80321c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803220:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803227:	00 00 00 
+  80322a:	8b 00                	mov    (%rax),%eax
+  80322c:	39 07                	cmp    %eax,(%rdi)
+  80322e:	0f 85 db 00 00 00    	jne    80330f <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803234:	45 85 f6             	test   %r14d,%r14d
+  803237:	0f 88 db 00 00 00    	js     803318 <fmap+0x12e>
+  80323d:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803244:	0f 85 d7 00 00 00    	jne    803321 <fmap+0x137>
+  80324a:	4c 89 fb             	mov    %r15,%rbx
+  80324d:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803253:	0f 85 d1 00 00 00    	jne    80332a <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803259:	48 b8 7a 29 80 00 00 	movabs $0x80297a,%rax
+  803260:	00 00 00 
+  803263:	ff d0                	call   *%rax
+  803265:	85 c0                	test   %eax,%eax
+  803267:	0f 88 8e 00 00 00    	js     8032fb <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80326d:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803274:	00 00 00 
+    while (i < n) {
+  803277:	4d 85 ed             	test   %r13,%r13
+  80327a:	0f 84 8a 00 00 00    	je     80330a <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803280:	4c 89 ea             	mov    %r13,%rdx
+  803283:	48 29 da             	sub    %rbx,%rdx
+  803286:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80328d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803293:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803297:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80329b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80329e:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8032a2:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8032a6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8032ab:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8032b0:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8032b4:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8032b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032bd:	4c 89 e6             	mov    %r12,%rsi
+  8032c0:	bf 09 00 00 00       	mov    $0x9,%edi
+  8032c5:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  8032cc:	00 00 00 
+  8032cf:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8032d1:	85 c0                	test   %eax,%eax
+  8032d3:	78 2a                	js     8032ff <fmap+0x115>
+        i += res;
+  8032d5:	48 98                	cltq
+  8032d7:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8032da:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8032de:	72 05                	jb     8032e5 <fmap+0xfb>
+    while (i < n) {
+  8032e0:	4c 39 eb             	cmp    %r13,%rbx
+  8032e3:	72 9b                	jb     803280 <fmap+0x96>
+    }
+    return i;
+  8032e5:	48 89 d8             	mov    %rbx,%rax
+}
+  8032e8:	48 83 c4 18          	add    $0x18,%rsp
+  8032ec:	5b                   	pop    %rbx
+  8032ed:	41 5c                	pop    %r12
+  8032ef:	41 5d                	pop    %r13
+  8032f1:	41 5e                	pop    %r14
+  8032f3:	41 5f                	pop    %r15
+  8032f5:	5d                   	pop    %rbp
+  8032f6:	c3                   	ret
+    if (res < 0) return res;
+  8032f7:	48 98                	cltq
+  8032f9:	eb ed                	jmp    8032e8 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8032fb:	48 98                	cltq
+  8032fd:	eb e9                	jmp    8032e8 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8032ff:	48 98                	cltq
+  803301:	48 85 db             	test   %rbx,%rbx
+  803304:	48 0f 45 c3          	cmovne %rbx,%rax
+  803308:	eb de                	jmp    8032e8 <fmap+0xfe>
+    size_t i = 0;
+  80330a:	4c 89 eb             	mov    %r13,%rbx
+  80330d:	eb d6                	jmp    8032e5 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80330f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803316:	eb d0                	jmp    8032e8 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803318:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80331f:	eb c7                	jmp    8032e8 <fmap+0xfe>
+  803321:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803328:	eb be                	jmp    8032e8 <fmap+0xfe>
+  80332a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803331:	eb b5                	jmp    8032e8 <fmap+0xfe>
+
+0000000000803333 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803333:	55                   	push   %rbp
+  803334:	48 89 e5             	mov    %rsp,%rbp
+  803337:	41 56                	push   %r14
+  803339:	41 55                	push   %r13
+  80333b:	41 54                	push   %r12
+  80333d:	53                   	push   %rbx
+  80333e:	48 83 ec 10          	sub    $0x10,%rsp
+  803342:	89 fb                	mov    %edi,%ebx
+  803344:	41 89 f4             	mov    %esi,%r12d
+  803347:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80334a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80334e:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  803355:	00 00 00 
+  803358:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80335a:	85 c0                	test   %eax,%eax
+  80335c:	78 63                	js     8033c1 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80335e:	45 85 e4             	test   %r12d,%r12d
+  803361:	0f 88 80 00 00 00    	js     8033e7 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803367:	45 89 e6             	mov    %r12d,%r14d
+  80336a:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803371:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803375:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  80337c:	00 00 00 
+  80337f:	ff d0                	call   *%rax
+  803381:	48 89 c2             	mov    %rax,%rdx
+  803384:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803389:	44 89 f6             	mov    %r14d,%esi
+  80338c:	89 df                	mov    %ebx,%edi
+  80338e:	48 b8 ea 31 80 00 00 	movabs $0x8031ea,%rax
+  803395:	00 00 00 
+  803398:	ff d0                	call   *%rax
+  80339a:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80339d:	45 29 f4             	sub    %r14d,%r12d
+  8033a0:	4d 63 f4             	movslq %r12d,%r14
+  8033a3:	49 39 c6             	cmp    %rax,%r14
+  8033a6:	7c 1d                	jl     8033c5 <read_map+0x92>
+  8033a8:	48 85 c0             	test   %rax,%rax
+  8033ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b0:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8033b4:	48 83 c4 10          	add    $0x10,%rsp
+  8033b8:	5b                   	pop    %rbx
+  8033b9:	41 5c                	pop    %r12
+  8033bb:	41 5d                	pop    %r13
+  8033bd:	41 5e                	pop    %r14
+  8033bf:	5d                   	pop    %rbp
+  8033c0:	c3                   	ret
+    if (res < 0) return res;
+  8033c1:	48 98                	cltq
+  8033c3:	eb ef                	jmp    8033b4 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8033c5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033c9:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  8033d0:	00 00 00 
+  8033d3:	ff d0                	call   *%rax
+  8033d5:	4d 63 e4             	movslq %r12d,%r12
+  8033d8:	4c 01 e0             	add    %r12,%rax
+  8033db:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8033df:	48 89 d8             	mov    %rbx,%rax
+  8033e2:	4c 29 f0             	sub    %r14,%rax
+  8033e5:	eb cd                	jmp    8033b4 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8033e7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033ee:	eb c4                	jmp    8033b4 <read_map+0x81>
+
+00000000008033f0 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8033f0:	55                   	push   %rbp
+  8033f1:	48 89 e5             	mov    %rsp,%rbp
+  8033f4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8033f8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033fc:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  803403:	00 00 00 
+  803406:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803408:	85 c0                	test   %eax,%eax
+  80340a:	78 4a                	js     803456 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80340c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803410:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803417:	00 00 00 
+  80341a:	8b 00                	mov    (%rax),%eax
+  80341c:	39 07                	cmp    %eax,(%rdi)
+  80341e:	75 38                	jne    803458 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803420:	48 b8 7a 29 80 00 00 	movabs $0x80297a,%rax
+  803427:	00 00 00 
+  80342a:	ff d0                	call   *%rax
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	78 26                	js     803456 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803430:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803434:	8b 40 0c             	mov    0xc(%rax),%eax
+  803437:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80343e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803440:	be 00 00 00 00       	mov    $0x0,%esi
+  803445:	bf 06 00 00 00       	mov    $0x6,%edi
+  80344a:	48 b8 b4 29 80 00 00 	movabs $0x8029b4,%rax
+  803451:	00 00 00 
+  803454:	ff d0                	call   *%rax
+}
+  803456:	c9                   	leave
+  803457:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803458:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80345d:	eb f7                	jmp    803456 <fsync+0x66>
+
+000000000080345f <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80345f:	55                   	push   %rbp
+  803460:	48 89 e5             	mov    %rsp,%rbp
+  803463:	41 57                	push   %r15
+  803465:	41 56                	push   %r14
+  803467:	41 55                	push   %r13
+  803469:	41 54                	push   %r12
+  80346b:	53                   	push   %rbx
+  80346c:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803470:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803477:	00 00 00 
+  80347a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80347f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803485:	49 bd 42 1e 80 00 00 	movabs $0x801e42,%r13
+  80348c:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80348f:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803496:	00 00 00 
+  803499:	eb 0c                	jmp    8034a7 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80349b:	83 c3 01             	add    $0x1,%ebx
+  80349e:	49 83 c4 28          	add    $0x28,%r12
+  8034a2:	83 fb 20             	cmp    $0x20,%ebx
+  8034a5:	74 33                	je     8034da <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8034a7:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8034ac:	74 ed                	je     80349b <flushall+0x3c>
+  8034ae:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8034b2:	89 df                	mov    %ebx,%edi
+  8034b4:	41 ff d5             	call   *%r13
+  8034b7:	85 c0                	test   %eax,%eax
+  8034b9:	78 e0                	js     80349b <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8034bb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8034bf:	41 8b 06             	mov    (%r14),%eax
+  8034c2:	39 07                	cmp    %eax,(%rdi)
+  8034c4:	75 d5                	jne    80349b <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8034c6:	48 b8 7a 29 80 00 00 	movabs $0x80297a,%rax
+  8034cd:	00 00 00 
+  8034d0:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8034d2:	85 c0                	test   %eax,%eax
+  8034d4:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8034d8:	eb c1                	jmp    80349b <flushall+0x3c>
+    }
+    return res;
+}
+  8034da:	44 89 f8             	mov    %r15d,%eax
+  8034dd:	48 83 c4 18          	add    $0x18,%rsp
+  8034e1:	5b                   	pop    %rbx
+  8034e2:	41 5c                	pop    %r12
+  8034e4:	41 5d                	pop    %r13
+  8034e6:	41 5e                	pop    %r14
+  8034e8:	41 5f                	pop    %r15
+  8034ea:	5d                   	pop    %rbp
+  8034eb:	c3                   	ret
+
+00000000008034ec <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8034ec:	55                   	push   %rbp
+  8034ed:	48 89 e5             	mov    %rsp,%rbp
+  8034f0:	53                   	push   %rbx
+  8034f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8034f5:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8034f8:	40 0f b6 c6          	movzbl %sil,%eax
+  8034fc:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803503:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803505:	be 00 00 00 00       	mov    $0x0,%esi
+  80350a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80350f:	48 b8 b4 29 80 00 00 	movabs $0x8029b4,%rax
+  803516:	00 00 00 
+  803519:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80351b:	85 c0                	test   %eax,%eax
+  80351d:	78 23                	js     803542 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  80351f:	ba 58 06 00 00       	mov    $0x658,%edx
+  803524:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80352b:	00 00 00 
+  80352e:	48 89 df             	mov    %rbx,%rdi
+  803531:	48 b8 33 10 80 00 00 	movabs $0x801033,%rax
+  803538:	00 00 00 
+  80353b:	ff d0                	call   *%rax
+    return 0;
+  80353d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803542:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803546:	c9                   	leave
+  803547:	c3                   	ret
+
+0000000000803548 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803548:	55                   	push   %rbp
+  803549:	48 89 e5             	mov    %rsp,%rbp
+  80354c:	53                   	push   %rbx
+  80354d:	48 83 ec 08          	sub    $0x8,%rsp
+  803551:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803554:	48 b8 00 0c 80 00 00 	movabs $0x800c00,%rax
+  80355b:	00 00 00 
+  80355e:	ff d0                	call   *%rax
+  803560:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803566:	77 35                	ja     80359d <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803568:	48 89 de             	mov    %rbx,%rsi
+  80356b:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803572:	00 00 00 
+  803575:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  80357c:	00 00 00 
+  80357f:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803581:	be 00 00 00 00       	mov    $0x0,%esi
+  803586:	bf 07 00 00 00       	mov    $0x7,%edi
+  80358b:	48 b8 b4 29 80 00 00 	movabs $0x8029b4,%rax
+  803592:	00 00 00 
+  803595:	ff d0                	call   *%rax
+}
+  803597:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80359b:	c9                   	leave
+  80359c:	c3                   	ret
+        return -E_BAD_PATH;
+  80359d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8035a2:	eb f3                	jmp    803597 <remove+0x4f>
+
+00000000008035a4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8035a4:	55                   	push   %rbp
+  8035a5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8035a8:	48 b8 5f 34 80 00 00 	movabs $0x80345f,%rax
+  8035af:	00 00 00 
+  8035b2:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8035b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8035b9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8035be:	48 b8 b4 29 80 00 00 	movabs $0x8029b4,%rax
+  8035c5:	00 00 00 
+  8035c8:	ff d0                	call   *%rax
+}
+  8035ca:	5d                   	pop    %rbp
+  8035cb:	c3                   	ret
+
+00000000008035cc <copy_shared_region>:
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+    return res;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8035cc:	55                   	push   %rbp
+  8035cd:	48 89 e5             	mov    %rsp,%rbp
+  8035d0:	41 55                	push   %r13
+  8035d2:	41 54                	push   %r12
+  8035d4:	53                   	push   %rbx
+  8035d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8035d9:	48 89 fb             	mov    %rdi,%rbx
+  8035dc:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  8035df:	44 8b 2a             	mov    (%rdx),%r13d
+    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+  8035e2:	48 b8 1d 45 80 00 00 	movabs $0x80451d,%rax
+  8035e9:	00 00 00 
+  8035ec:	ff d0                	call   *%rax
+  8035ee:	41 89 c1             	mov    %eax,%r9d
+  8035f1:	4d 89 e0             	mov    %r12,%r8
+  8035f4:	49 29 d8             	sub    %rbx,%r8
+  8035f7:	48 89 d9             	mov    %rbx,%rcx
+  8035fa:	44 89 ea             	mov    %r13d,%edx
+  8035fd:	48 89 de             	mov    %rbx,%rsi
+  803600:	bf 00 00 00 00       	mov    $0x0,%edi
+  803605:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  80360c:	00 00 00 
+  80360f:	ff d0                	call   *%rax
+}
+  803611:	48 83 c4 08          	add    $0x8,%rsp
+  803615:	5b                   	pop    %rbx
+  803616:	41 5c                	pop    %r12
+  803618:	41 5d                	pop    %r13
+  80361a:	5d                   	pop    %rbp
+  80361b:	c3                   	ret
+
+000000000080361c <spawn>:
+spawn(const char *prog, const char **argv) {
+  80361c:	55                   	push   %rbp
+  80361d:	48 89 e5             	mov    %rsp,%rbp
+  803620:	41 57                	push   %r15
+  803622:	41 56                	push   %r14
+  803624:	41 55                	push   %r13
+  803626:	41 54                	push   %r12
+  803628:	53                   	push   %rbx
+  803629:	48 81 ec f8 02 00 00 	sub    $0x2f8,%rsp
+  803630:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  803633:	be 00 00 00 00       	mov    $0x0,%esi
+  803638:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  80363f:	00 00 00 
+  803642:	ff d0                	call   *%rax
+  803644:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+    if (fd < 0) return fd;
+  80364a:	85 c0                	test   %eax,%eax
+  80364c:	0f 88 8f 06 00 00    	js     803ce1 <spawn+0x6c5>
+  803652:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803654:	ba 00 02 00 00       	mov    $0x200,%edx
+  803659:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803660:	48 b8 e3 21 80 00 00 	movabs $0x8021e3,%rax
+  803667:	00 00 00 
+  80366a:	ff d0                	call   *%rax
+  80366c:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  80366e:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803673:	0f 85 88 02 00 00    	jne    803901 <spawn+0x2e5>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803679:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803680:	ff ff 00 
+  803683:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  80368a:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803691:	01 01 00 
+  803694:	48 39 d0             	cmp    %rdx,%rax
+  803697:	0f 85 a0 02 00 00    	jne    80393d <spawn+0x321>
+        elf->e_type != ET_EXEC /* executable */ ||
+  80369d:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  8036a4:	00 3e 00 
+  8036a7:	0f 85 90 02 00 00    	jne    80393d <spawn+0x321>
+    flushall();
+  8036ad:	48 b8 5f 34 80 00 00 	movabs $0x80345f,%rax
+  8036b4:	00 00 00 
+  8036b7:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8036b9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8036be:	cd 30                	int    $0x30
+  8036c0:	41 89 c7             	mov    %eax,%r15d
+  8036c3:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  8036c9:	85 c0                	test   %eax,%eax
+  8036cb:	0f 88 f2 05 00 00    	js     803cc3 <spawn+0x6a7>
+    envid_t child = res;
+  8036d1:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  8036d7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8036dc:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8036e3:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8036ea:	00 00 00 
+  8036ed:	48 01 c6             	add    %rax,%rsi
+  8036f0:	48 8b 06             	mov    (%rsi),%rax
+  8036f3:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  8036fa:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803701:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803708:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  80370f:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803716:	48 29 ce             	sub    %rcx,%rsi
+  803719:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  80371f:	c1 e9 03             	shr    $0x3,%ecx
+  803722:	89 c9                	mov    %ecx,%ecx
+  803724:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803727:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  80372e:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803735:	48 8b 3b             	mov    (%rbx),%rdi
+  803738:	48 85 ff             	test   %rdi,%rdi
+  80373b:	0f 84 b8 05 00 00    	je     803cf9 <spawn+0x6dd>
+  803741:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  803747:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  80374d:	49 be 00 0c 80 00 00 	movabs $0x800c00,%r14
+  803754:	00 00 00 
+  803757:	41 ff d6             	call   *%r14
+  80375a:	4c 01 e8             	add    %r13,%rax
+  80375d:	4c 8d 68 01          	lea    0x1(%rax),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  803761:	4c 89 a5 f8 fc ff ff 	mov    %r12,-0x308(%rbp)
+  803768:	49 83 c4 01          	add    $0x1,%r12
+  80376c:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  803771:	48 85 ff             	test   %rdi,%rdi
+  803774:	75 e1                	jne    803757 <spawn+0x13b>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803776:	48 f7 d0             	not    %rax
+  803779:	4c 8d a0 00 00 41 00 	lea    0x410000(%rax),%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803780:	4d 89 e6             	mov    %r12,%r14
+  803783:	49 83 e6 f8          	and    $0xfffffffffffffff8,%r14
+  803787:	4c 89 b5 f0 fc ff ff 	mov    %r14,-0x310(%rbp)
+  80378e:	4c 8b ad f8 fc ff ff 	mov    -0x308(%rbp),%r13
+  803795:	44 89 e8             	mov    %r13d,%eax
+  803798:	83 c0 01             	add    $0x1,%eax
+  80379b:	48 98                	cltq
+  80379d:	48 c1 e0 03          	shl    $0x3,%rax
+  8037a1:	49 29 c6             	sub    %rax,%r14
+  8037a4:	4c 89 b5 e0 fc ff ff 	mov    %r14,-0x320(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8037ab:	49 8d 46 f0          	lea    -0x10(%r14),%rax
+  8037af:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8037b5:	0f 86 eb 04 00 00    	jbe    803ca6 <spawn+0x68a>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8037bb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8037c0:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8037c5:	be 00 00 40 00       	mov    $0x400000,%esi
+  8037ca:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  8037d1:	00 00 00 
+  8037d4:	ff d0                	call   *%rax
+  8037d6:	85 c0                	test   %eax,%eax
+  8037d8:	0f 88 cd 04 00 00    	js     803cab <spawn+0x68f>
+    for (i = 0; i < argc; i++) {
+  8037de:	4c 89 e8             	mov    %r13,%rax
+  8037e1:	45 85 ed             	test   %r13d,%r13d
+  8037e4:	7e 52                	jle    803838 <spawn+0x21c>
+  8037e6:	4d 89 f5             	mov    %r14,%r13
+  8037e9:	48 98                	cltq
+  8037eb:	4d 8d 34 c6          	lea    (%r14,%rax,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8037ef:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  8037f6:	00 00 00 
+  8037f9:	49 8d 84 04 00 00 c0 	lea    -0x400000(%r12,%rax,1),%rax
+  803800:	ff 
+  803801:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803805:	48 8b 33             	mov    (%rbx),%rsi
+  803808:	4c 89 e7             	mov    %r12,%rdi
+  80380b:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  803812:	00 00 00 
+  803815:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803817:	48 8b 3b             	mov    (%rbx),%rdi
+  80381a:	48 b8 00 0c 80 00 00 	movabs $0x800c00,%rax
+  803821:	00 00 00 
+  803824:	ff d0                	call   *%rax
+  803826:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  80382b:	49 83 c5 08          	add    $0x8,%r13
+  80382f:	48 83 c3 08          	add    $0x8,%rbx
+  803833:	4d 39 f5             	cmp    %r14,%r13
+  803836:	75 b7                	jne    8037ef <spawn+0x1d3>
+    argv_store[argc] = 0;
+  803838:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  80383f:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803846:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803847:	49 81 fc 00 00 41 00 	cmp    $0x410000,%r12
+  80384e:	0f 85 30 01 00 00    	jne    803984 <spawn+0x368>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803854:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  80385b:	00 00 00 
+  80385e:	48 8b 9d e0 fc ff ff 	mov    -0x320(%rbp),%rbx
+  803865:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  80386c:	ff 
+  80386d:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803871:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803878:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  80387c:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803883:	00 00 00 
+  803886:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80388d:	ff 
+  80388e:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803895:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  80389b:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  8038a1:	44 89 fa             	mov    %r15d,%edx
+  8038a4:	be 00 00 40 00       	mov    $0x400000,%esi
+  8038a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ae:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  8038b5:	00 00 00 
+  8038b8:	ff d0                	call   *%rax
+    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
+  8038ba:	48 bb 7d 15 80 00 00 	movabs $0x80157d,%rbx
+  8038c1:	00 00 00 
+  8038c4:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8038c9:	be 00 00 40 00       	mov    $0x400000,%esi
+  8038ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038d3:	ff d3                	call   *%rbx
+  8038d5:	85 c0                	test   %eax,%eax
+  8038d7:	78 eb                	js     8038c4 <spawn+0x2a8>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  8038d9:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8038e0:	48 8d 9c 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%rbx
+  8038e7:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8038e8:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  8038ef:	00 
+  8038f0:	0f 84 a1 02 00 00    	je     803b97 <spawn+0x57b>
+  8038f6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8038fc:	e9 dd 00 00 00       	jmp    8039de <spawn+0x3c2>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803901:	48 bf 00 57 80 00 00 	movabs $0x805700,%rdi
+  803908:	00 00 00 
+  80390b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803910:	48 ba c6 02 80 00 00 	movabs $0x8002c6,%rdx
+  803917:	00 00 00 
+  80391a:	ff d2                	call   *%rdx
+        close(fd);
+  80391c:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803922:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  803929:	00 00 00 
+  80392c:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80392e:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  803935:	ff ff ff 
+  803938:	e9 a4 03 00 00       	jmp    803ce1 <spawn+0x6c5>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80393d:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803942:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803948:	48 bf 60 57 80 00 00 	movabs $0x805760,%rdi
+  80394f:	00 00 00 
+  803952:	b8 00 00 00 00       	mov    $0x0,%eax
+  803957:	48 b9 c6 02 80 00 00 	movabs $0x8002c6,%rcx
+  80395e:	00 00 00 
+  803961:	ff d1                	call   *%rcx
+        close(fd);
+  803963:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803969:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  803970:	00 00 00 
+  803973:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803975:	c7 85 ec fc ff ff ee 	movl   $0xffffffee,-0x314(%rbp)
+  80397c:	ff ff ff 
+  80397f:	e9 5d 03 00 00       	jmp    803ce1 <spawn+0x6c5>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803984:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  80398b:	00 00 00 
+  80398e:	48 ba 7a 57 80 00 00 	movabs $0x80577a,%rdx
+  803995:	00 00 00 
+  803998:	be f3 00 00 00       	mov    $0xf3,%esi
+  80399d:	48 bf 8f 57 80 00 00 	movabs $0x80578f,%rdi
+  8039a4:	00 00 00 
+  8039a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ac:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  8039b3:	00 00 00 
+  8039b6:	41 ff d0             	call   *%r8
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8039b9:	83 bd f8 fc ff ff 00 	cmpl   $0x0,-0x308(%rbp)
+  8039c0:	0f 88 eb 02 00 00    	js     803cb1 <spawn+0x695>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8039c6:	49 83 c7 01          	add    $0x1,%r15
+  8039ca:	48 83 c3 38          	add    $0x38,%rbx
+  8039ce:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  8039d5:	49 39 c7             	cmp    %rax,%r15
+  8039d8:	0f 83 b9 01 00 00    	jae    803b97 <spawn+0x57b>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  8039de:	83 3b 01             	cmpl   $0x1,(%rbx)
+  8039e1:	75 e3                	jne    8039c6 <spawn+0x3aa>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  8039e3:	8b 43 04             	mov    0x4(%rbx),%eax
+  8039e6:	41 89 c4             	mov    %eax,%r12d
+  8039e9:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  8039ed:	44 89 e2             	mov    %r12d,%edx
+  8039f0:	83 ca 04             	or     $0x4,%edx
+  8039f3:	a8 04                	test   $0x4,%al
+  8039f5:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  8039f9:	44 89 e2             	mov    %r12d,%edx
+  8039fc:	83 ca 01             	or     $0x1,%edx
+  8039ff:	a8 01                	test   $0x1,%al
+  803a01:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803a05:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  803a09:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+  803a0f:	4c 8b 6b 20          	mov    0x20(%rbx),%r13
+  803a13:	4c 8b 73 28          	mov    0x28(%rbx),%r14
+  803a17:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+  803a1b:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  803a22:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803a28:	89 8d e0 fc ff ff    	mov    %ecx,-0x320(%rbp)
+
+    // cprintf("map_segment %x+%x\n", va, memsz);
+
+    /* Fixup unaligned destination */
+    int res = PAGE_OFFSET(va);
+    if (res) {
+  803a2e:	89 f2                	mov    %esi,%edx
+  803a30:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803a36:	74 1b                	je     803a53 <spawn+0x437>
+        va -= res;
+  803a38:	48 63 ca             	movslq %edx,%rcx
+  803a3b:	48 29 ce             	sub    %rcx,%rsi
+  803a3e:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  803a45:	49 01 ce             	add    %rcx,%r14
+        filesz += res;
+  803a48:	49 01 cd             	add    %rcx,%r13
+        fileoffset -= res;
+  803a4b:	29 d0                	sub    %edx,%eax
+  803a4d:	89 85 e8 fc ff ff    	mov    %eax,-0x318(%rbp)
+    }
+
+    /* NOTE: There's restriction on maximal filesz
+     * for each program segment (HUGE_PAGE_SIZE) */
+    if (filesz > HUGE_PAGE_SIZE || filesz > memsz)
+  803a53:	b8 00 00 20 00       	mov    $0x200000,%eax
+  803a58:	49 39 c6             	cmp    %rax,%r14
+  803a5b:	49 0f 46 c6          	cmovbe %r14,%rax
+  803a5f:	4c 39 e8             	cmp    %r13,%rax
+  803a62:	0f 82 32 02 00 00    	jb     803c9a <spawn+0x67e>
+    /* Allocate filesz in parent to UTEMP */
+    /* seek() fd to fileoffset  */
+    /* read filesz to UTEMP */
+    /* Map read section conents to child */
+    /* Unmap it from parent */
+    res = sys_alloc_region(child, (void *)ROUNDUP(va + filesz, 4096), memsz, perm);
+  803a68:	48 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%rax
+  803a6f:	49 8d b4 05 ff 0f 00 	lea    0xfff(%r13,%rax,1),%rsi
+  803a76:	00 
+  803a77:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803a7e:	44 89 e1             	mov    %r12d,%ecx
+  803a81:	4c 89 f2             	mov    %r14,%rdx
+  803a84:	8b bd e0 fc ff ff    	mov    -0x320(%rbp),%edi
+  803a8a:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  803a91:	00 00 00 
+  803a94:	ff d0                	call   *%rax
+  803a96:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (memsz > filesz && res)
+  803a9c:	4d 39 f5             	cmp    %r14,%r13
+  803a9f:	73 08                	jae    803aa9 <spawn+0x48d>
+  803aa1:	85 c0                	test   %eax,%eax
+  803aa3:	0f 85 10 ff ff ff    	jne    8039b9 <spawn+0x39d>
+        return res;
+
+    if (filesz == 0)
+  803aa9:	4d 85 ed             	test   %r13,%r13
+  803aac:	0f 84 14 ff ff ff    	je     8039c6 <spawn+0x3aa>
+        return 0;
+
+    res = sys_alloc_region(0, UTEMP, ROUNDUP(filesz, 4096), PTE_P | PTE_U | PTE_W);
+  803ab2:	49 8d 85 ff 0f 00 00 	lea    0xfff(%r13),%rax
+  803ab9:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803abf:	49 89 c6             	mov    %rax,%r14
+  803ac2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803ac7:	48 89 c2             	mov    %rax,%rdx
+  803aca:	be 00 00 40 00       	mov    $0x400000,%esi
+  803acf:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ad4:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  803adb:	00 00 00 
+  803ade:	ff d0                	call   *%rax
+  803ae0:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803ae6:	85 c0                	test   %eax,%eax
+  803ae8:	0f 85 cb fe ff ff    	jne    8039b9 <spawn+0x39d>
+        return res;
+    res = seek(fd, fileoffset);
+  803aee:	8b b5 e8 fc ff ff    	mov    -0x318(%rbp),%esi
+  803af4:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803afa:	48 b8 0d 23 80 00 00 	movabs $0x80230d,%rax
+  803b01:	00 00 00 
+  803b04:	ff d0                	call   *%rax
+  803b06:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803b0c:	85 c0                	test   %eax,%eax
+  803b0e:	0f 85 a5 fe ff ff    	jne    8039b9 <spawn+0x39d>
+        return res;
+    res = readn(fd, UTEMP, filesz);
+  803b14:	4c 89 ea             	mov    %r13,%rdx
+  803b17:	be 00 00 40 00       	mov    $0x400000,%esi
+  803b1c:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803b22:	48 b8 e3 21 80 00 00 	movabs $0x8021e3,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+  803b2e:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res < 0)
+  803b34:	85 c0                	test   %eax,%eax
+  803b36:	0f 88 75 01 00 00    	js     803cb1 <spawn+0x695>
+        return res;
+    res = sys_map_region(0, UTEMP, child, (void *)va, ROUNDUP(filesz, 4096), perm);
+  803b3c:	45 89 e1             	mov    %r12d,%r9d
+  803b3f:	4d 89 f0             	mov    %r14,%r8
+  803b42:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  803b49:	8b 95 e0 fc ff ff    	mov    -0x320(%rbp),%edx
+  803b4f:	be 00 00 40 00       	mov    $0x400000,%esi
+  803b54:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b59:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  803b60:	00 00 00 
+  803b63:	ff d0                	call   *%rax
+  803b65:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803b6b:	85 c0                	test   %eax,%eax
+  803b6d:	0f 85 46 fe ff ff    	jne    8039b9 <spawn+0x39d>
+        return res;
+    res = sys_unmap_region(0, UTEMP, ROUNDUP(filesz, 4096));
+  803b73:	4c 89 f2             	mov    %r14,%rdx
+  803b76:	be 00 00 40 00       	mov    $0x400000,%esi
+  803b7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b80:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  803b87:	00 00 00 
+  803b8a:	ff d0                	call   *%rax
+  803b8c:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    if (res)
+  803b92:	e9 22 fe ff ff       	jmp    8039b9 <spawn+0x39d>
+    close(fd);
+  803b97:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803b9d:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  803ba4:	00 00 00 
+  803ba7:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+  803ba9:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803bb0:	48 bf cc 35 80 00 00 	movabs $0x8035cc,%rdi
+  803bb7:	00 00 00 
+  803bba:	48 b8 91 45 80 00 00 	movabs $0x804591,%rax
+  803bc1:	00 00 00 
+  803bc4:	ff d0                	call   *%rax
+  803bc6:	85 c0                	test   %eax,%eax
+  803bc8:	78 49                	js     803c13 <spawn+0x5f7>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803bca:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803bd1:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803bd7:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  803bde:	00 00 00 
+  803be1:	ff d0                	call   *%rax
+  803be3:	85 c0                	test   %eax,%eax
+  803be5:	78 59                	js     803c40 <spawn+0x624>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803be7:	be 02 00 00 00       	mov    $0x2,%esi
+  803bec:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803bf2:	48 b8 e4 15 80 00 00 	movabs $0x8015e4,%rax
+  803bf9:	00 00 00 
+  803bfc:	ff d0                	call   *%rax
+  803bfe:	85 c0                	test   %eax,%eax
+  803c00:	78 6b                	js     803c6d <spawn+0x651>
+    return child;
+  803c02:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803c08:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+  803c0e:	e9 ce 00 00 00       	jmp    803ce1 <spawn+0x6c5>
+        panic("copy_shared_region: %i", res);
+  803c13:	89 c1                	mov    %eax,%ecx
+  803c15:	48 ba 9b 57 80 00 00 	movabs $0x80579b,%rdx
+  803c1c:	00 00 00 
+  803c1f:	be 87 00 00 00       	mov    $0x87,%esi
+  803c24:	48 bf 8f 57 80 00 00 	movabs $0x80578f,%rdi
+  803c2b:	00 00 00 
+  803c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c33:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  803c3a:	00 00 00 
+  803c3d:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  803c40:	89 c1                	mov    %eax,%ecx
+  803c42:	48 ba b2 57 80 00 00 	movabs $0x8057b2,%rdx
+  803c49:	00 00 00 
+  803c4c:	be 8a 00 00 00       	mov    $0x8a,%esi
+  803c51:	48 bf 8f 57 80 00 00 	movabs $0x80578f,%rdi
+  803c58:	00 00 00 
+  803c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c60:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  803c67:	00 00 00 
+  803c6a:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803c6d:	89 c1                	mov    %eax,%ecx
+  803c6f:	48 ba cc 57 80 00 00 	movabs $0x8057cc,%rdx
+  803c76:	00 00 00 
+  803c79:	be 8d 00 00 00       	mov    $0x8d,%esi
+  803c7e:	48 bf 8f 57 80 00 00 	movabs $0x80578f,%rdi
+  803c85:	00 00 00 
+  803c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c8d:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  803c94:	00 00 00 
+  803c97:	41 ff d0             	call   *%r8
+        return -E_INVALID_EXE;
+  803c9a:	c7 85 f8 fc ff ff f8 	movl   $0xfffffff8,-0x308(%rbp)
+  803ca1:	ff ff ff 
+  803ca4:	eb 0b                	jmp    803cb1 <spawn+0x695>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803ca6:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803cab:	89 85 f8 fc ff ff    	mov    %eax,-0x308(%rbp)
+    sys_env_destroy(child);
+  803cb1:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803cb7:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  803cbe:	00 00 00 
+  803cc1:	ff d0                	call   *%rax
+    close(fd);
+  803cc3:	8b bd ec fc ff ff    	mov    -0x314(%rbp),%edi
+  803cc9:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  803cd0:	00 00 00 
+  803cd3:	ff d0                	call   *%rax
+    return res;
+  803cd5:	8b 85 f8 fc ff ff    	mov    -0x308(%rbp),%eax
+  803cdb:	89 85 ec fc ff ff    	mov    %eax,-0x314(%rbp)
+}
+  803ce1:	8b 85 ec fc ff ff    	mov    -0x314(%rbp),%eax
+  803ce7:	48 81 c4 f8 02 00 00 	add    $0x2f8,%rsp
+  803cee:	5b                   	pop    %rbx
+  803cef:	41 5c                	pop    %r12
+  803cf1:	41 5d                	pop    %r13
+  803cf3:	41 5e                	pop    %r14
+  803cf5:	41 5f                	pop    %r15
+  803cf7:	5d                   	pop    %rbp
+  803cf8:	c3                   	ret
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803cf9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803cfe:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803d03:	be 00 00 40 00       	mov    $0x400000,%esi
+  803d08:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d0d:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  803d14:	00 00 00 
+  803d17:	ff d0                	call   *%rax
+  803d19:	85 c0                	test   %eax,%eax
+  803d1b:	78 8e                	js     803cab <spawn+0x68f>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803d1d:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  803d24:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803d28:	48 c7 85 e0 fc ff ff 	movq   $0x40fff8,-0x320(%rbp)
+  803d2f:	f8 ff 40 00 
+  803d33:	48 c7 85 f0 fc ff ff 	movq   $0x410000,-0x310(%rbp)
+  803d3a:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803d3e:	41 bc 00 00 41 00    	mov    $0x410000,%r12d
+  803d44:	e9 ef fa ff ff       	jmp    803838 <spawn+0x21c>
+
+0000000000803d49 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803d49:	55                   	push   %rbp
+  803d4a:	48 89 e5             	mov    %rsp,%rbp
+  803d4d:	48 83 ec 50          	sub    $0x50,%rsp
+  803d51:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803d55:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d59:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d5d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803d61:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803d68:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d70:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d74:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803d78:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803d7d:	eb 15                	jmp    803d94 <spawnl+0x4b>
+  803d7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803d87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d8b:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803d8f:	74 1c                	je     803dad <spawnl+0x64>
+  803d91:	83 c1 01             	add    $0x1,%ecx
+  803d94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803d97:	83 f8 2f             	cmp    $0x2f,%eax
+  803d9a:	77 e3                	ja     803d7f <spawnl+0x36>
+  803d9c:	89 c2                	mov    %eax,%edx
+  803d9e:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803da2:	4c 01 d2             	add    %r10,%rdx
+  803da5:	83 c0 08             	add    $0x8,%eax
+  803da8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803dab:	eb de                	jmp    803d8b <spawnl+0x42>
+    const char *argv[argc + 2];
+  803dad:	8d 41 02             	lea    0x2(%rcx),%eax
+  803db0:	48 98                	cltq
+  803db2:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803db9:	00 
+  803dba:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803dbe:	48 29 c4             	sub    %rax,%rsp
+  803dc1:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803dc6:	4c 89 c0             	mov    %r8,%rax
+  803dc9:	48 c1 e8 03          	shr    $0x3,%rax
+  803dcd:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803dd1:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803dd8:	00 
+    argv[argc + 1] = NULL;
+  803dd9:	8d 41 01             	lea    0x1(%rcx),%eax
+  803ddc:	48 98                	cltq
+  803dde:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803de5:	00 
+    va_start(vl, arg0);
+  803de6:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803ded:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803df1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803df5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803df9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803dfd:	85 c9                	test   %ecx,%ecx
+  803dff:	74 41                	je     803e42 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803e01:	49 89 c1             	mov    %rax,%r9
+  803e04:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803e08:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803e0b:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803e10:	eb 1b                	jmp    803e2d <spawnl+0xe4>
+  803e12:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e16:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  803e1a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803e1e:	48 8b 11             	mov    (%rcx),%rdx
+  803e21:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803e24:	48 83 c0 08          	add    $0x8,%rax
+  803e28:	48 39 f0             	cmp    %rsi,%rax
+  803e2b:	74 15                	je     803e42 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803e2d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803e30:	83 fa 2f             	cmp    $0x2f,%edx
+  803e33:	77 dd                	ja     803e12 <spawnl+0xc9>
+  803e35:	89 d1                	mov    %edx,%ecx
+  803e37:	4c 01 c9             	add    %r9,%rcx
+  803e3a:	83 c2 08             	add    $0x8,%edx
+  803e3d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803e40:	eb dc                	jmp    803e1e <spawnl+0xd5>
+    return spawn(prog, argv);
+  803e42:	4c 89 c6             	mov    %r8,%rsi
+  803e45:	48 b8 1c 36 80 00 00 	movabs $0x80361c,%rax
+  803e4c:	00 00 00 
+  803e4f:	ff d0                	call   *%rax
+}
+  803e51:	c9                   	leave
+  803e52:	c3                   	ret
+
+0000000000803e53 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803e53:	55                   	push   %rbp
+  803e54:	48 89 e5             	mov    %rsp,%rbp
+  803e57:	41 54                	push   %r12
+  803e59:	53                   	push   %rbx
+  803e5a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e5d:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  803e64:	00 00 00 
+  803e67:	ff d0                	call   *%rax
+  803e69:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803e6c:	48 be e3 57 80 00 00 	movabs $0x8057e3,%rsi
+  803e73:	00 00 00 
+  803e76:	48 89 df             	mov    %rbx,%rdi
+  803e79:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  803e80:	00 00 00 
+  803e83:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803e85:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803e8a:	41 2b 04 24          	sub    (%r12),%eax
+  803e8e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803e94:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803e9b:	00 00 00 
+    stat->st_dev = &devpipe;
+  803e9e:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803ea5:	00 00 00 
+  803ea8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb4:	5b                   	pop    %rbx
+  803eb5:	41 5c                	pop    %r12
+  803eb7:	5d                   	pop    %rbp
+  803eb8:	c3                   	ret
+
+0000000000803eb9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803eb9:	55                   	push   %rbp
+  803eba:	48 89 e5             	mov    %rsp,%rbp
+  803ebd:	41 54                	push   %r12
+  803ebf:	53                   	push   %rbx
+  803ec0:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803ec3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ec8:	48 89 fe             	mov    %rdi,%rsi
+  803ecb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ed0:	49 bc 7d 15 80 00 00 	movabs $0x80157d,%r12
+  803ed7:	00 00 00 
+  803eda:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803edd:	48 89 df             	mov    %rbx,%rdi
+  803ee0:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  803ee7:	00 00 00 
+  803eea:	ff d0                	call   *%rax
+  803eec:	48 89 c6             	mov    %rax,%rsi
+  803eef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ef4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ef9:	41 ff d4             	call   *%r12
+}
+  803efc:	5b                   	pop    %rbx
+  803efd:	41 5c                	pop    %r12
+  803eff:	5d                   	pop    %rbp
+  803f00:	c3                   	ret
+
+0000000000803f01 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f01:	55                   	push   %rbp
+  803f02:	48 89 e5             	mov    %rsp,%rbp
+  803f05:	41 57                	push   %r15
+  803f07:	41 56                	push   %r14
+  803f09:	41 55                	push   %r13
+  803f0b:	41 54                	push   %r12
+  803f0d:	53                   	push   %rbx
+  803f0e:	48 83 ec 18          	sub    $0x18,%rsp
+  803f12:	49 89 fc             	mov    %rdi,%r12
+  803f15:	49 89 f5             	mov    %rsi,%r13
+  803f18:	49 89 d7             	mov    %rdx,%r15
+  803f1b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f1f:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  803f26:	00 00 00 
+  803f29:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803f2b:	4d 85 ff             	test   %r15,%r15
+  803f2e:	0f 84 af 00 00 00    	je     803fe3 <devpipe_write+0xe2>
+  803f34:	48 89 c3             	mov    %rax,%rbx
+  803f37:	4c 89 f8             	mov    %r15,%rax
+  803f3a:	4d 89 ef             	mov    %r13,%r15
+  803f3d:	4c 01 e8             	add    %r13,%rax
+  803f40:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f44:	49 bd 72 13 80 00 00 	movabs $0x801372,%r13
+  803f4b:	00 00 00 
+            sys_yield();
+  803f4e:	49 be 0f 13 80 00 00 	movabs $0x80130f,%r14
+  803f55:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803f58:	8b 73 04             	mov    0x4(%rbx),%esi
+  803f5b:	48 63 ce             	movslq %esi,%rcx
+  803f5e:	48 63 03             	movslq (%rbx),%rax
+  803f61:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803f67:	48 39 c1             	cmp    %rax,%rcx
+  803f6a:	72 2e                	jb     803f9a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f6c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f71:	48 89 da             	mov    %rbx,%rdx
+  803f74:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f79:	4c 89 e7             	mov    %r12,%rdi
+  803f7c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f7f:	85 c0                	test   %eax,%eax
+  803f81:	74 66                	je     803fe9 <devpipe_write+0xe8>
+            sys_yield();
+  803f83:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803f86:	8b 73 04             	mov    0x4(%rbx),%esi
+  803f89:	48 63 ce             	movslq %esi,%rcx
+  803f8c:	48 63 03             	movslq (%rbx),%rax
+  803f8f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803f95:	48 39 c1             	cmp    %rax,%rcx
+  803f98:	73 d2                	jae    803f6c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803f9a:	41 0f b6 3f          	movzbl (%r15),%edi
+  803f9e:	48 89 ca             	mov    %rcx,%rdx
+  803fa1:	48 c1 ea 03          	shr    $0x3,%rdx
+  803fa5:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803fac:	08 10 20 
+  803faf:	48 f7 e2             	mul    %rdx
+  803fb2:	48 c1 ea 06          	shr    $0x6,%rdx
+  803fb6:	48 89 d0             	mov    %rdx,%rax
+  803fb9:	48 c1 e0 09          	shl    $0x9,%rax
+  803fbd:	48 29 d0             	sub    %rdx,%rax
+  803fc0:	48 c1 e0 03          	shl    $0x3,%rax
+  803fc4:	48 29 c1             	sub    %rax,%rcx
+  803fc7:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803fcc:	83 c6 01             	add    $0x1,%esi
+  803fcf:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803fd2:	49 83 c7 01          	add    $0x1,%r15
+  803fd6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fda:	49 39 c7             	cmp    %rax,%r15
+  803fdd:	0f 85 75 ff ff ff    	jne    803f58 <devpipe_write+0x57>
+    return n;
+  803fe3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fe7:	eb 05                	jmp    803fee <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fee:	48 83 c4 18          	add    $0x18,%rsp
+  803ff2:	5b                   	pop    %rbx
+  803ff3:	41 5c                	pop    %r12
+  803ff5:	41 5d                	pop    %r13
+  803ff7:	41 5e                	pop    %r14
+  803ff9:	41 5f                	pop    %r15
+  803ffb:	5d                   	pop    %rbp
+  803ffc:	c3                   	ret
+
+0000000000803ffd <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ffd:	55                   	push   %rbp
+  803ffe:	48 89 e5             	mov    %rsp,%rbp
+  804001:	41 57                	push   %r15
+  804003:	41 56                	push   %r14
+  804005:	41 55                	push   %r13
+  804007:	41 54                	push   %r12
+  804009:	53                   	push   %rbx
+  80400a:	48 83 ec 18          	sub    $0x18,%rsp
+  80400e:	49 89 fc             	mov    %rdi,%r12
+  804011:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804015:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804019:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  804020:	00 00 00 
+  804023:	ff d0                	call   *%rax
+  804025:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804028:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80402e:	49 bd 72 13 80 00 00 	movabs $0x801372,%r13
+  804035:	00 00 00 
+            sys_yield();
+  804038:	49 be 0f 13 80 00 00 	movabs $0x80130f,%r14
+  80403f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804042:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804047:	74 7d                	je     8040c6 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804049:	8b 03                	mov    (%rbx),%eax
+  80404b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80404e:	75 26                	jne    804076 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804050:	4d 85 ff             	test   %r15,%r15
+  804053:	75 77                	jne    8040cc <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804055:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80405a:	48 89 da             	mov    %rbx,%rdx
+  80405d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804062:	4c 89 e7             	mov    %r12,%rdi
+  804065:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804068:	85 c0                	test   %eax,%eax
+  80406a:	74 72                	je     8040de <devpipe_read+0xe1>
+            sys_yield();
+  80406c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80406f:	8b 03                	mov    (%rbx),%eax
+  804071:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804074:	74 df                	je     804055 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804076:	48 63 c8             	movslq %eax,%rcx
+  804079:	48 89 ca             	mov    %rcx,%rdx
+  80407c:	48 c1 ea 03          	shr    $0x3,%rdx
+  804080:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804087:	08 10 20 
+  80408a:	48 89 d0             	mov    %rdx,%rax
+  80408d:	48 f7 e6             	mul    %rsi
+  804090:	48 c1 ea 06          	shr    $0x6,%rdx
+  804094:	48 89 d0             	mov    %rdx,%rax
+  804097:	48 c1 e0 09          	shl    $0x9,%rax
+  80409b:	48 29 d0             	sub    %rdx,%rax
+  80409e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8040a5:	00 
+  8040a6:	48 89 c8             	mov    %rcx,%rax
+  8040a9:	48 29 d0             	sub    %rdx,%rax
+  8040ac:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8040b1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8040b5:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8040b9:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8040bc:	49 83 c7 01          	add    $0x1,%r15
+  8040c0:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8040c4:	75 83                	jne    804049 <devpipe_read+0x4c>
+    return n;
+  8040c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040ca:	eb 03                	jmp    8040cf <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8040cc:	4c 89 f8             	mov    %r15,%rax
+}
+  8040cf:	48 83 c4 18          	add    $0x18,%rsp
+  8040d3:	5b                   	pop    %rbx
+  8040d4:	41 5c                	pop    %r12
+  8040d6:	41 5d                	pop    %r13
+  8040d8:	41 5e                	pop    %r14
+  8040da:	41 5f                	pop    %r15
+  8040dc:	5d                   	pop    %rbp
+  8040dd:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8040de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040e3:	eb ea                	jmp    8040cf <devpipe_read+0xd2>
+
+00000000008040e5 <pipe>:
+pipe(int pfd[2]) {
+  8040e5:	55                   	push   %rbp
+  8040e6:	48 89 e5             	mov    %rsp,%rbp
+  8040e9:	41 55                	push   %r13
+  8040eb:	41 54                	push   %r12
+  8040ed:	53                   	push   %rbx
+  8040ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8040f2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8040f5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8040f9:	48 b8 e2 1d 80 00 00 	movabs $0x801de2,%rax
+  804100:	00 00 00 
+  804103:	ff d0                	call   *%rax
+  804105:	89 c3                	mov    %eax,%ebx
+  804107:	85 c0                	test   %eax,%eax
+  804109:	0f 88 a0 01 00 00    	js     8042af <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80410f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804114:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804119:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80411d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804122:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  804129:	00 00 00 
+  80412c:	ff d0                	call   *%rax
+  80412e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804130:	85 c0                	test   %eax,%eax
+  804132:	0f 88 77 01 00 00    	js     8042af <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804138:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80413c:	48 b8 e2 1d 80 00 00 	movabs $0x801de2,%rax
+  804143:	00 00 00 
+  804146:	ff d0                	call   *%rax
+  804148:	89 c3                	mov    %eax,%ebx
+  80414a:	85 c0                	test   %eax,%eax
+  80414c:	0f 88 43 01 00 00    	js     804295 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804152:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804157:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80415c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804160:	bf 00 00 00 00       	mov    $0x0,%edi
+  804165:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  80416c:	00 00 00 
+  80416f:	ff d0                	call   *%rax
+  804171:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804173:	85 c0                	test   %eax,%eax
+  804175:	0f 88 1a 01 00 00    	js     804295 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80417b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80417f:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  804186:	00 00 00 
+  804189:	ff d0                	call   *%rax
+  80418b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80418e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804193:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804198:	48 89 c6             	mov    %rax,%rsi
+  80419b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041a0:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  8041a7:	00 00 00 
+  8041aa:	ff d0                	call   *%rax
+  8041ac:	89 c3                	mov    %eax,%ebx
+  8041ae:	85 c0                	test   %eax,%eax
+  8041b0:	0f 88 c5 00 00 00    	js     80427b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8041b6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8041ba:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  8041c1:	00 00 00 
+  8041c4:	ff d0                	call   *%rax
+  8041c6:	48 89 c1             	mov    %rax,%rcx
+  8041c9:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8041cf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8041d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041da:	4c 89 ee             	mov    %r13,%rsi
+  8041dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041e2:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  8041e9:	00 00 00 
+  8041ec:	ff d0                	call   *%rax
+  8041ee:	89 c3                	mov    %eax,%ebx
+  8041f0:	85 c0                	test   %eax,%eax
+  8041f2:	78 6e                	js     804262 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8041f4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041f9:	4c 89 ef             	mov    %r13,%rdi
+  8041fc:	48 b8 40 13 80 00 00 	movabs $0x801340,%rax
+  804203:	00 00 00 
+  804206:	ff d0                	call   *%rax
+  804208:	83 f8 02             	cmp    $0x2,%eax
+  80420b:	0f 85 ab 00 00 00    	jne    8042bc <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804211:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804218:	00 00 
+  80421a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80421e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804220:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804224:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80422b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80422f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804231:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804235:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80423c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804240:	48 bb b4 1d 80 00 00 	movabs $0x801db4,%rbx
+  804247:	00 00 00 
+  80424a:	ff d3                	call   *%rbx
+  80424c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804250:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804254:	ff d3                	call   *%rbx
+  804256:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80425b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804260:	eb 4d                	jmp    8042af <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804262:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804267:	4c 89 ee             	mov    %r13,%rsi
+  80426a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80426f:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  804276:	00 00 00 
+  804279:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80427b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804280:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804284:	bf 00 00 00 00       	mov    $0x0,%edi
+  804289:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  804290:	00 00 00 
+  804293:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804295:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80429a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80429e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042a3:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  8042aa:	00 00 00 
+  8042ad:	ff d0                	call   *%rax
+}
+  8042af:	89 d8                	mov    %ebx,%eax
+  8042b1:	48 83 c4 18          	add    $0x18,%rsp
+  8042b5:	5b                   	pop    %rbx
+  8042b6:	41 5c                	pop    %r12
+  8042b8:	41 5d                	pop    %r13
+  8042ba:	5d                   	pop    %rbp
+  8042bb:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8042bc:	48 b9 00 58 80 00 00 	movabs $0x805800,%rcx
+  8042c3:	00 00 00 
+  8042c6:	48 ba 7a 57 80 00 00 	movabs $0x80577a,%rdx
+  8042cd:	00 00 00 
+  8042d0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8042d5:	48 bf ea 57 80 00 00 	movabs $0x8057ea,%rdi
+  8042dc:	00 00 00 
+  8042df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e4:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  8042eb:	00 00 00 
+  8042ee:	41 ff d0             	call   *%r8
+
+00000000008042f1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8042f1:	55                   	push   %rbp
+  8042f2:	48 89 e5             	mov    %rsp,%rbp
+  8042f5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8042f9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042fd:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  804304:	00 00 00 
+  804307:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804309:	85 c0                	test   %eax,%eax
+  80430b:	78 35                	js     804342 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80430d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804311:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  804318:	00 00 00 
+  80431b:	ff d0                	call   *%rax
+  80431d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804320:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804325:	be 00 10 00 00       	mov    $0x1000,%esi
+  80432a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80432e:	48 b8 72 13 80 00 00 	movabs $0x801372,%rax
+  804335:	00 00 00 
+  804338:	ff d0                	call   *%rax
+  80433a:	85 c0                	test   %eax,%eax
+  80433c:	0f 94 c0             	sete   %al
+  80433f:	0f b6 c0             	movzbl %al,%eax
+}
+  804342:	c9                   	leave
+  804343:	c3                   	ret
+
+0000000000804344 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804344:	48 89 f8             	mov    %rdi,%rax
+  804347:	48 c1 e8 27          	shr    $0x27,%rax
+  80434b:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804352:	7f 00 00 
+  804355:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804359:	f6 c2 01             	test   $0x1,%dl
+  80435c:	74 6d                	je     8043cb <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80435e:	48 89 f8             	mov    %rdi,%rax
+  804361:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804365:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80436c:	7f 00 00 
+  80436f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804373:	f6 c2 01             	test   $0x1,%dl
+  804376:	74 62                	je     8043da <get_uvpt_entry+0x96>
+  804378:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80437f:	7f 00 00 
+  804382:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804386:	f6 c2 80             	test   $0x80,%dl
+  804389:	75 4f                	jne    8043da <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80438b:	48 89 f8             	mov    %rdi,%rax
+  80438e:	48 c1 e8 15          	shr    $0x15,%rax
+  804392:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804399:	7f 00 00 
+  80439c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8043a0:	f6 c2 01             	test   $0x1,%dl
+  8043a3:	74 44                	je     8043e9 <get_uvpt_entry+0xa5>
+  8043a5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8043ac:	7f 00 00 
+  8043af:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8043b3:	f6 c2 80             	test   $0x80,%dl
+  8043b6:	75 31                	jne    8043e9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8043b8:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8043bc:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8043c3:	7f 00 00 
+  8043c6:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8043ca:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8043cb:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8043d2:	7f 00 00 
+  8043d5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043d9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8043da:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8043e1:	7f 00 00 
+  8043e4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043e8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8043e9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8043f0:	7f 00 00 
+  8043f3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043f7:	c3                   	ret
+
+00000000008043f8 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8043f8:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8043fb:	48 89 f9             	mov    %rdi,%rcx
+  8043fe:	48 c1 e9 27          	shr    $0x27,%rcx
+  804402:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804409:	7f 00 00 
+  80440c:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  804410:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804417:	f6 c1 01             	test   $0x1,%cl
+  80441a:	0f 84 b2 00 00 00    	je     8044d2 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804420:	48 89 f9             	mov    %rdi,%rcx
+  804423:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804427:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80442e:	7f 00 00 
+  804431:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804435:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80443c:	40 f6 c6 01          	test   $0x1,%sil
+  804440:	0f 84 8c 00 00 00    	je     8044d2 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804446:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80444d:	7f 00 00 
+  804450:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804454:	a8 80                	test   $0x80,%al
+  804456:	75 7b                	jne    8044d3 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804458:	48 89 f9             	mov    %rdi,%rcx
+  80445b:	48 c1 e9 15          	shr    $0x15,%rcx
+  80445f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804466:	7f 00 00 
+  804469:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80446d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804474:	40 f6 c6 01          	test   $0x1,%sil
+  804478:	74 58                	je     8044d2 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  80447a:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804481:	7f 00 00 
+  804484:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804488:	a8 80                	test   $0x80,%al
+  80448a:	75 6c                	jne    8044f8 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80448c:	48 89 f9             	mov    %rdi,%rcx
+  80448f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804493:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80449a:	7f 00 00 
+  80449d:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8044a1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8044a8:	40 f6 c6 01          	test   $0x1,%sil
+  8044ac:	74 24                	je     8044d2 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8044ae:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8044b5:	7f 00 00 
+  8044b8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8044bc:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8044c3:	ff ff 7f 
+  8044c6:	48 21 c8             	and    %rcx,%rax
+  8044c9:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8044cf:	48 09 d0             	or     %rdx,%rax
+}
+  8044d2:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8044d3:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8044da:	7f 00 00 
+  8044dd:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8044e1:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8044e8:	ff ff 7f 
+  8044eb:	48 21 c8             	and    %rcx,%rax
+  8044ee:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8044f4:	48 01 d0             	add    %rdx,%rax
+  8044f7:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8044f8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8044ff:	7f 00 00 
+  804502:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804506:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80450d:	ff ff 7f 
+  804510:	48 21 c8             	and    %rcx,%rax
+  804513:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804519:	48 01 d0             	add    %rdx,%rax
+  80451c:	c3                   	ret
+
+000000000080451d <get_prot>:
+
+int
+get_prot(void *va) {
+  80451d:	55                   	push   %rbp
+  80451e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804521:	48 b8 44 43 80 00 00 	movabs $0x804344,%rax
+  804528:	00 00 00 
+  80452b:	ff d0                	call   *%rax
+  80452d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804530:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804535:	89 c1                	mov    %eax,%ecx
+  804537:	83 c9 04             	or     $0x4,%ecx
+  80453a:	f6 c2 01             	test   $0x1,%dl
+  80453d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804540:	89 c1                	mov    %eax,%ecx
+  804542:	83 c9 02             	or     $0x2,%ecx
+  804545:	f6 c2 02             	test   $0x2,%dl
+  804548:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80454b:	89 c1                	mov    %eax,%ecx
+  80454d:	83 c9 01             	or     $0x1,%ecx
+  804550:	48 85 d2             	test   %rdx,%rdx
+  804553:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804556:	89 c1                	mov    %eax,%ecx
+  804558:	83 c9 40             	or     $0x40,%ecx
+  80455b:	f6 c6 04             	test   $0x4,%dh
+  80455e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804561:	5d                   	pop    %rbp
+  804562:	c3                   	ret
+
+0000000000804563 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804563:	55                   	push   %rbp
+  804564:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804567:	48 b8 44 43 80 00 00 	movabs $0x804344,%rax
+  80456e:	00 00 00 
+  804571:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804573:	48 c1 e8 06          	shr    $0x6,%rax
+  804577:	83 e0 01             	and    $0x1,%eax
+}
+  80457a:	5d                   	pop    %rbp
+  80457b:	c3                   	ret
+
+000000000080457c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80457c:	55                   	push   %rbp
+  80457d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804580:	48 b8 44 43 80 00 00 	movabs $0x804344,%rax
+  804587:	00 00 00 
+  80458a:	ff d0                	call   *%rax
+  80458c:	83 e0 01             	and    $0x1,%eax
+}
+  80458f:	5d                   	pop    %rbp
+  804590:	c3                   	ret
+
+0000000000804591 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804591:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804598:	7f 00 00 
+  80459b:	a8 01                	test   $0x1,%al
+  80459d:	75 06                	jne    8045a5 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  80459f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a4:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8045a5:	55                   	push   %rbp
+  8045a6:	48 89 e5             	mov    %rsp,%rbp
+  8045a9:	41 57                	push   %r15
+  8045ab:	41 56                	push   %r14
+  8045ad:	41 55                	push   %r13
+  8045af:	41 54                	push   %r12
+  8045b1:	53                   	push   %rbx
+  8045b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8045b6:	49 89 fe             	mov    %rdi,%r14
+  8045b9:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8045bc:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8045c3:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8045c4:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  8045cb:	7f 00 00 
+  8045ce:	e9 81 00 00 00       	jmp    804654 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  8045d3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8045da:	49 39 dd             	cmp    %rbx,%r13
+  8045dd:	74 2b                	je     80460a <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8045df:	48 89 d8             	mov    %rbx,%rax
+  8045e2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8045e6:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  8045ea:	f6 c2 01             	test   $0x1,%dl
+  8045ed:	74 e4                	je     8045d3 <foreach_shared_region+0x42>
+  8045ef:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  8045f3:	f6 c4 04             	test   $0x4,%ah
+  8045f6:	74 db                	je     8045d3 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  8045f8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8045ff:	4c 89 fa             	mov    %r15,%rdx
+  804602:	48 89 df             	mov    %rbx,%rdi
+  804605:	41 ff d6             	call   *%r14
+  804608:	eb c9                	jmp    8045d3 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80460a:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804611:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804615:	74 22                	je     804639 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804617:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  80461e:	48 89 d8             	mov    %rbx,%rax
+  804621:	48 c1 e8 15          	shr    $0x15,%rax
+  804625:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  80462c:	7f 00 00 
+  80462f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804633:	a8 01                	test   $0x1,%al
+  804635:	74 d3                	je     80460a <foreach_shared_region+0x79>
+  804637:	eb a6                	jmp    8045df <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804639:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804640:	40 
+  804641:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804645:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80464c:	00 00 00 
+  80464f:	48 39 c1             	cmp    %rax,%rcx
+  804652:	74 31                	je     804685 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804654:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804658:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80465c:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804663:	7f 00 00 
+  804666:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80466a:	a8 01                	test   $0x1,%al
+  80466c:	74 cb                	je     804639 <foreach_shared_region+0xa8>
+  80466e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804672:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804679:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  80467f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804683:	eb 92                	jmp    804617 <foreach_shared_region+0x86>
+}
+  804685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80468a:	48 83 c4 18          	add    $0x18,%rsp
+  80468e:	5b                   	pop    %rbx
+  80468f:	41 5c                	pop    %r12
+  804691:	41 5d                	pop    %r13
+  804693:	41 5e                	pop    %r14
+  804695:	41 5f                	pop    %r15
+  804697:	5d                   	pop    %rbp
+  804698:	c3                   	ret
+
+0000000000804699 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804699:	b8 00 00 00 00       	mov    $0x0,%eax
+  80469e:	c3                   	ret
+
+000000000080469f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80469f:	55                   	push   %rbp
+  8046a0:	48 89 e5             	mov    %rsp,%rbp
+  8046a3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8046a6:	48 be 24 58 80 00 00 	movabs $0x805824,%rsi
+  8046ad:	00 00 00 
+  8046b0:	48 b8 3e 0c 80 00 00 	movabs $0x800c3e,%rax
+  8046b7:	00 00 00 
+  8046ba:	ff d0                	call   *%rax
+    return 0;
+}
+  8046bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c1:	5d                   	pop    %rbp
+  8046c2:	c3                   	ret
+
+00000000008046c3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8046c3:	55                   	push   %rbp
+  8046c4:	48 89 e5             	mov    %rsp,%rbp
+  8046c7:	41 57                	push   %r15
+  8046c9:	41 56                	push   %r14
+  8046cb:	41 55                	push   %r13
+  8046cd:	41 54                	push   %r12
+  8046cf:	53                   	push   %rbx
+  8046d0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8046d7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8046de:	48 85 d2             	test   %rdx,%rdx
+  8046e1:	74 7a                	je     80475d <devcons_write+0x9a>
+  8046e3:	49 89 d6             	mov    %rdx,%r14
+  8046e6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8046ec:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8046f1:	49 bf cc 0f 80 00 00 	movabs $0x800fcc,%r15
+  8046f8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8046fb:	4c 89 f3             	mov    %r14,%rbx
+  8046fe:	48 29 f3             	sub    %rsi,%rbx
+  804701:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804706:	48 39 c3             	cmp    %rax,%rbx
+  804709:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80470d:	4c 63 eb             	movslq %ebx,%r13
+  804710:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804717:	48 01 c6             	add    %rax,%rsi
+  80471a:	4c 89 ea             	mov    %r13,%rdx
+  80471d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804724:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804727:	4c 89 ee             	mov    %r13,%rsi
+  80472a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804731:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  804738:	00 00 00 
+  80473b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80473d:	41 01 dc             	add    %ebx,%r12d
+  804740:	49 63 f4             	movslq %r12d,%rsi
+  804743:	4c 39 f6             	cmp    %r14,%rsi
+  804746:	72 b3                	jb     8046fb <devcons_write+0x38>
+    return res;
+  804748:	49 63 c4             	movslq %r12d,%rax
+}
+  80474b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804752:	5b                   	pop    %rbx
+  804753:	41 5c                	pop    %r12
+  804755:	41 5d                	pop    %r13
+  804757:	41 5e                	pop    %r14
+  804759:	41 5f                	pop    %r15
+  80475b:	5d                   	pop    %rbp
+  80475c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80475d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804763:	eb e3                	jmp    804748 <devcons_write+0x85>
+
+0000000000804765 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804765:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804768:	ba 00 00 00 00       	mov    $0x0,%edx
+  80476d:	48 85 c0             	test   %rax,%rax
+  804770:	74 55                	je     8047c7 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804772:	55                   	push   %rbp
+  804773:	48 89 e5             	mov    %rsp,%rbp
+  804776:	41 55                	push   %r13
+  804778:	41 54                	push   %r12
+  80477a:	53                   	push   %rbx
+  80477b:	48 83 ec 08          	sub    $0x8,%rsp
+  80477f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804782:	48 bb 42 12 80 00 00 	movabs $0x801242,%rbx
+  804789:	00 00 00 
+  80478c:	49 bc 0f 13 80 00 00 	movabs $0x80130f,%r12
+  804793:	00 00 00 
+  804796:	eb 03                	jmp    80479b <devcons_read+0x36>
+  804798:	41 ff d4             	call   *%r12
+  80479b:	ff d3                	call   *%rbx
+  80479d:	85 c0                	test   %eax,%eax
+  80479f:	74 f7                	je     804798 <devcons_read+0x33>
+    if (c < 0) return c;
+  8047a1:	48 63 d0             	movslq %eax,%rdx
+  8047a4:	78 13                	js     8047b9 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8047a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047ab:	83 f8 04             	cmp    $0x4,%eax
+  8047ae:	74 09                	je     8047b9 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8047b0:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8047b4:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8047b9:	48 89 d0             	mov    %rdx,%rax
+  8047bc:	48 83 c4 08          	add    $0x8,%rsp
+  8047c0:	5b                   	pop    %rbx
+  8047c1:	41 5c                	pop    %r12
+  8047c3:	41 5d                	pop    %r13
+  8047c5:	5d                   	pop    %rbp
+  8047c6:	c3                   	ret
+  8047c7:	48 89 d0             	mov    %rdx,%rax
+  8047ca:	c3                   	ret
+
+00000000008047cb <cputchar>:
+cputchar(int ch) {
+  8047cb:	55                   	push   %rbp
+  8047cc:	48 89 e5             	mov    %rsp,%rbp
+  8047cf:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8047d3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8047d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8047dc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8047e0:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  8047e7:	00 00 00 
+  8047ea:	ff d0                	call   *%rax
+}
+  8047ec:	c9                   	leave
+  8047ed:	c3                   	ret
+
+00000000008047ee <getchar>:
+getchar(void) {
+  8047ee:	55                   	push   %rbp
+  8047ef:	48 89 e5             	mov    %rsp,%rbp
+  8047f2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8047f6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047fb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8047ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  804804:	48 b8 25 21 80 00 00 	movabs $0x802125,%rax
+  80480b:	00 00 00 
+  80480e:	ff d0                	call   *%rax
+  804810:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804812:	85 c0                	test   %eax,%eax
+  804814:	78 06                	js     80481c <getchar+0x2e>
+  804816:	74 08                	je     804820 <getchar+0x32>
+  804818:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80481c:	89 d0                	mov    %edx,%eax
+  80481e:	c9                   	leave
+  80481f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804820:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804825:	eb f5                	jmp    80481c <getchar+0x2e>
+
+0000000000804827 <iscons>:
+iscons(int fdnum) {
+  804827:	55                   	push   %rbp
+  804828:	48 89 e5             	mov    %rsp,%rbp
+  80482b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80482f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804833:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  80483a:	00 00 00 
+  80483d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80483f:	85 c0                	test   %eax,%eax
+  804841:	78 18                	js     80485b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804843:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804847:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80484e:	00 00 00 
+  804851:	8b 00                	mov    (%rax),%eax
+  804853:	39 02                	cmp    %eax,(%rdx)
+  804855:	0f 94 c0             	sete   %al
+  804858:	0f b6 c0             	movzbl %al,%eax
+}
+  80485b:	c9                   	leave
+  80485c:	c3                   	ret
+
+000000000080485d <opencons>:
+opencons(void) {
+  80485d:	55                   	push   %rbp
+  80485e:	48 89 e5             	mov    %rsp,%rbp
+  804861:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804865:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804869:	48 b8 e2 1d 80 00 00 	movabs $0x801de2,%rax
+  804870:	00 00 00 
+  804873:	ff d0                	call   *%rax
+  804875:	85 c0                	test   %eax,%eax
+  804877:	78 49                	js     8048c2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804879:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80487e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804883:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804887:	bf 00 00 00 00       	mov    $0x0,%edi
+  80488c:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  804893:	00 00 00 
+  804896:	ff d0                	call   *%rax
+  804898:	85 c0                	test   %eax,%eax
+  80489a:	78 26                	js     8048c2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80489c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8048a0:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8048a7:	00 00 
+  8048a9:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8048ab:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8048af:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8048b6:	48 b8 b4 1d 80 00 00 	movabs $0x801db4,%rax
+  8048bd:	00 00 00 
+  8048c0:	ff d0                	call   *%rax
+}
+  8048c2:	c9                   	leave
+  8048c3:	c3                   	ret
+
+00000000008048c4 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8048c4:	55                   	push   %rbp
+  8048c5:	48 89 e5             	mov    %rsp,%rbp
+  8048c8:	41 55                	push   %r13
+  8048ca:	41 54                	push   %r12
+  8048cc:	53                   	push   %rbx
+  8048cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8048d1:	49 89 fc             	mov    %rdi,%r12
+  8048d4:	48 89 f7             	mov    %rsi,%rdi
+  8048d7:	48 89 d3             	mov    %rdx,%rbx
+  8048da:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8048dd:	48 85 f6             	test   %rsi,%rsi
+  8048e0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8048e7:	00 00 00 
+  8048ea:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8048ee:	be 00 10 00 00       	mov    $0x1000,%esi
+  8048f3:	48 85 d2             	test   %rdx,%rdx
+  8048f6:	74 03                	je     8048fb <ipc_recv+0x37>
+  8048f8:	48 8b 32             	mov    (%rdx),%rsi
+  8048fb:	48 b8 4b 17 80 00 00 	movabs $0x80174b,%rax
+  804902:	00 00 00 
+  804905:	ff d0                	call   *%rax
+    if (errno) {
+  804907:	85 c0                	test   %eax,%eax
+  804909:	74 1c                	je     804927 <ipc_recv+0x63>
+        if (from_env_store)
+  80490b:	4d 85 e4             	test   %r12,%r12
+  80490e:	74 08                	je     804918 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804910:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804917:	00 
+
+        if (perm_store)
+  804918:	4d 85 ed             	test   %r13,%r13
+  80491b:	74 74                	je     804991 <ipc_recv+0xcd>
+            *perm_store = 0;
+  80491d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804924:	00 
+  804925:	eb 6a                	jmp    804991 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804927:	4d 85 e4             	test   %r12,%r12
+  80492a:	74 14                	je     804940 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80492c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804933:	00 00 00 
+  804936:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80493c:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804940:	48 85 db             	test   %rbx,%rbx
+  804943:	74 23                	je     804968 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804945:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80494c:	00 00 00 
+  80494f:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804955:	ba 00 00 00 00       	mov    $0x0,%edx
+  80495a:	85 c9                	test   %ecx,%ecx
+  80495c:	74 07                	je     804965 <ipc_recv+0xa1>
+  80495e:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804965:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804968:	4d 85 ed             	test   %r13,%r13
+  80496b:	74 14                	je     804981 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80496d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804974:	00 00 00 
+  804977:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80497d:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804981:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804988:	00 00 00 
+  80498b:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804991:	48 83 c4 08          	add    $0x8,%rsp
+  804995:	5b                   	pop    %rbx
+  804996:	41 5c                	pop    %r12
+  804998:	41 5d                	pop    %r13
+  80499a:	5d                   	pop    %rbp
+  80499b:	c3                   	ret
+
+000000000080499c <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80499c:	55                   	push   %rbp
+  80499d:	48 89 e5             	mov    %rsp,%rbp
+  8049a0:	41 55                	push   %r13
+  8049a2:	41 54                	push   %r12
+  8049a4:	53                   	push   %rbx
+  8049a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8049a9:	49 89 fc             	mov    %rdi,%r12
+  8049ac:	48 89 f7             	mov    %rsi,%rdi
+  8049af:	48 89 d3             	mov    %rdx,%rbx
+  8049b2:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8049b5:	48 85 f6             	test   %rsi,%rsi
+  8049b8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8049bf:	00 00 00 
+  8049c2:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8049c6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8049cb:	48 85 d2             	test   %rdx,%rdx
+  8049ce:	74 03                	je     8049d3 <ipc_try_recv+0x37>
+  8049d0:	48 8b 32             	mov    (%rdx),%rsi
+  8049d3:	48 b8 b4 17 80 00 00 	movabs $0x8017b4,%rax
+  8049da:	00 00 00 
+  8049dd:	ff d0                	call   *%rax
+    if (errno) {
+  8049df:	85 c0                	test   %eax,%eax
+  8049e1:	75 75                	jne    804a58 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8049e3:	4d 85 e4             	test   %r12,%r12
+  8049e6:	74 14                	je     8049fc <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8049e8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8049ef:	00 00 00 
+  8049f2:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8049f8:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8049fc:	48 85 db             	test   %rbx,%rbx
+  8049ff:	74 23                	je     804a24 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804a01:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804a08:	00 00 00 
+  804a0b:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804a11:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a16:	85 c9                	test   %ecx,%ecx
+  804a18:	74 07                	je     804a21 <ipc_try_recv+0x85>
+  804a1a:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804a21:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804a24:	4d 85 ed             	test   %r13,%r13
+  804a27:	74 14                	je     804a3d <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804a29:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804a30:	00 00 00 
+  804a33:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804a39:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804a3d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804a44:	00 00 00 
+  804a47:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804a4d:	48 83 c4 08          	add    $0x8,%rsp
+  804a51:	5b                   	pop    %rbx
+  804a52:	41 5c                	pop    %r12
+  804a54:	41 5d                	pop    %r13
+  804a56:	5d                   	pop    %rbp
+  804a57:	c3                   	ret
+        if (from_env_store)
+  804a58:	4d 85 e4             	test   %r12,%r12
+  804a5b:	74 08                	je     804a65 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804a5d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804a64:	00 
+        if (perm_store)
+  804a65:	4d 85 ed             	test   %r13,%r13
+  804a68:	74 e3                	je     804a4d <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804a6a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804a71:	00 
+  804a72:	eb d9                	jmp    804a4d <ipc_try_recv+0xb1>
+
+0000000000804a74 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804a74:	55                   	push   %rbp
+  804a75:	48 89 e5             	mov    %rsp,%rbp
+  804a78:	41 57                	push   %r15
+  804a7a:	41 56                	push   %r14
+  804a7c:	41 55                	push   %r13
+  804a7e:	41 54                	push   %r12
+  804a80:	53                   	push   %rbx
+  804a81:	48 83 ec 18          	sub    $0x18,%rsp
+  804a85:	41 89 fd             	mov    %edi,%r13d
+  804a88:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804a8b:	48 89 d3             	mov    %rdx,%rbx
+  804a8e:	49 89 cc             	mov    %rcx,%r12
+  804a91:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804a95:	48 85 d2             	test   %rdx,%rdx
+  804a98:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804a9f:	00 00 00 
+  804aa2:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804aa6:	49 be 1f 17 80 00 00 	movabs $0x80171f,%r14
+  804aad:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804ab0:	49 bf 0f 13 80 00 00 	movabs $0x80130f,%r15
+  804ab7:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804aba:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804abd:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804ac1:	4c 89 e1             	mov    %r12,%rcx
+  804ac4:	48 89 da             	mov    %rbx,%rdx
+  804ac7:	44 89 ef             	mov    %r13d,%edi
+  804aca:	41 ff d6             	call   *%r14
+  804acd:	85 c0                	test   %eax,%eax
+  804acf:	74 37                	je     804b08 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804ad1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804ad4:	75 05                	jne    804adb <ipc_send+0x67>
+        sys_yield();
+  804ad6:	41 ff d7             	call   *%r15
+  804ad9:	eb df                	jmp    804aba <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804adb:	89 c1                	mov    %eax,%ecx
+  804add:	48 ba 30 58 80 00 00 	movabs $0x805830,%rdx
+  804ae4:	00 00 00 
+  804ae7:	be 65 00 00 00       	mov    $0x65,%esi
+  804aec:	48 bf 4b 58 80 00 00 	movabs $0x80584b,%rdi
+  804af3:	00 00 00 
+  804af6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804afb:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  804b02:	00 00 00 
+  804b05:	41 ff d0             	call   *%r8
+    }
+}
+  804b08:	48 83 c4 18          	add    $0x18,%rsp
+  804b0c:	5b                   	pop    %rbx
+  804b0d:	41 5c                	pop    %r12
+  804b0f:	41 5d                	pop    %r13
+  804b11:	41 5e                	pop    %r14
+  804b13:	41 5f                	pop    %r15
+  804b15:	5d                   	pop    %rbp
+  804b16:	c3                   	ret
+
+0000000000804b17 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804b17:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804b1c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804b23:	00 00 00 
+  804b26:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804b2d:	48 01 ca             	add    %rcx,%rdx
+  804b30:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804b36:	39 fa                	cmp    %edi,%edx
+  804b38:	74 12                	je     804b4c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804b3a:	48 83 c0 01          	add    $0x1,%rax
+  804b3e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804b44:	75 e0                	jne    804b26 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804b46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804b4b:	c3                   	ret
+            return envs[i].env_id;
+  804b4c:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804b53:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804b5a:	00 00 00 
+  804b5d:	48 01 d0             	add    %rdx,%rax
+  804b60:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804b66:	c3                   	ret
+
+0000000000804b67 <__text_end>:
+  804b67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6e:	00 00 00 
+  804b71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b78:	00 00 00 
+  804b7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b82:	00 00 00 
+  804b85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8c:	00 00 00 
+  804b8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b96:	00 00 00 
+  804b99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba0:	00 00 00 
+  804ba3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baa:	00 00 00 
+  804bad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb4:	00 00 00 
+  804bb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbe:	00 00 00 
+  804bc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc8:	00 00 00 
+  804bcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd2:	00 00 00 
+  804bd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdc:	00 00 00 
+  804bdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be6:	00 00 00 
+  804be9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf0:	00 00 00 
+  804bf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfa:	00 00 00 
+  804bfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c04:	00 00 00 
+  804c07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0e:	00 00 00 
+  804c11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c18:	00 00 00 
+  804c1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c22:	00 00 00 
+  804c25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2c:	00 00 00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c40:	00 00 00 
+  804c43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4a:	00 00 00 
+  804c4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c54:	00 00 00 
+  804c57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5e:	00 00 00 
+  804c61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c68:	00 00 00 
+  804c6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c72:	00 00 00 
+  804c75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7c:	00 00 00 
+  804c7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c86:	00 00 00 
+  804c89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c90:	00 00 00 
+  804c93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9a:	00 00 00 
+  804c9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca4:	00 00 00 
+  804ca7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cae:	00 00 00 
+  804cb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb8:	00 00 00 
+  804cbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc2:	00 00 00 
+  804cc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccc:	00 00 00 
+  804ccf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd6:	00 00 00 
+  804cd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce0:	00 00 00 
+  804ce3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cea:	00 00 00 
+  804ced:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf4:	00 00 00 
+  804cf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfe:	00 00 00 
+  804d01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d08:	00 00 00 
+  804d0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d12:	00 00 00 
+  804d15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1c:	00 00 00 
+  804d1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d26:	00 00 00 
+  804d29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d30:	00 00 00 
+  804d33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3a:	00 00 00 
+  804d3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d44:	00 00 00 
+  804d47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4e:	00 00 00 
+  804d51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d58:	00 00 00 
+  804d5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d62:	00 00 00 
+  804d65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6c:	00 00 00 
+  804d6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d76:	00 00 00 
+  804d79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d80:	00 00 00 
+  804d83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8a:	00 00 00 
+  804d8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d94:	00 00 00 
+  804d97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9e:	00 00 00 
+  804da1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da8:	00 00 00 
+  804dab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db2:	00 00 00 
+  804db5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbc:	00 00 00 
+  804dbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc6:	00 00 00 
+  804dc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd0:	00 00 00 
+  804dd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dda:	00 00 00 
+  804ddd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de4:	00 00 00 
+  804de7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dee:	00 00 00 
+  804df1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df8:	00 00 00 
+  804dfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e02:	00 00 00 
+  804e05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0c:	00 00 00 
+  804e0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e16:	00 00 00 
+  804e19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e20:	00 00 00 
+  804e23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2a:	00 00 00 
+  804e2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e34:	00 00 00 
+  804e37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3e:	00 00 00 
+  804e41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e48:	00 00 00 
+  804e4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e52:	00 00 00 
+  804e55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5c:	00 00 00 
+  804e5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e66:	00 00 00 
+  804e69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e70:	00 00 00 
+  804e73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7a:	00 00 00 
+  804e7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e84:	00 00 00 
+  804e87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8e:	00 00 00 
+  804e91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e98:	00 00 00 
+  804e9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea2:	00 00 00 
+  804ea5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eac:	00 00 00 
+  804eaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb6:	00 00 00 
+  804eb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec0:	00 00 00 
+  804ec3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eca:	00 00 00 
+  804ecd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed4:	00 00 00 
+  804ed7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ede:	00 00 00 
+  804ee1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee8:	00 00 00 
+  804eeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef2:	00 00 00 
+  804ef5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efc:	00 00 00 
+  804eff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f06:	00 00 00 
+  804f09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f10:	00 00 00 
+  804f13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1a:	00 00 00 
+  804f1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f24:	00 00 00 
+  804f27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2e:	00 00 00 
+  804f31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f38:	00 00 00 
+  804f3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f42:	00 00 00 
+  804f45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4c:	00 00 00 
+  804f4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f56:	00 00 00 
+  804f59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f60:	00 00 00 
+  804f63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6a:	00 00 00 
+  804f6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f74:	00 00 00 
+  804f77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7e:	00 00 00 
+  804f81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f88:	00 00 00 
+  804f8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f92:	00 00 00 
+  804f95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9c:	00 00 00 
+  804f9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa6:	00 00 00 
+  804fa9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb0:	00 00 00 
+  804fb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fba:	00 00 00 
+  804fbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc4:	00 00 00 
+  804fc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fce:	00 00 00 
+  804fd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd8:	00 00 00 
+  804fdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe2:	00 00 00 
+  804fe5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fec:	00 00 00 
+  804fef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff6:	00 00 00 
+  804ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
@@ -0,0 +1,8192 @@
+
+obj/user/spin:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c2 00 00 00       	call   8000e5 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Let it run for a couple time slices, then kill it. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    envid_t env;
+
+    cprintf("I am the parent.  Forking the child...\n");
+  800032:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 ba 5e 02 80 00 00 	movabs $0x80025e,%rdx
+  800048:	00 00 00 
+  80004b:	ff d2                	call   *%rdx
+    if ((env = fork()) == 0) {
+  80004d:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	85 c0                	test   %eax,%eax
+  80005b:	75 1d                	jne    80007a <umain+0x55>
+        cprintf("I am the child.  Spinning...\n");
+  80005d:	48 bf 78 50 80 00 00 	movabs $0x805078,%rdi
+  800064:	00 00 00 
+  800067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006c:	48 ba 5e 02 80 00 00 	movabs $0x80025e,%rdx
+  800073:	00 00 00 
+  800076:	ff d2                	call   *%rdx
+        while (1) /* do nothing */
+  800078:	eb fe                	jmp    800078 <umain+0x53>
+  80007a:	89 c3                	mov    %eax,%ebx
+            ;
+    }
+
+    cprintf("I am the parent.  Running the child...\n");
+  80007c:	48 bf 28 50 80 00 00 	movabs $0x805028,%rdi
+  800083:	00 00 00 
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	49 bd 5e 02 80 00 00 	movabs $0x80025e,%r13
+  800092:	00 00 00 
+  800095:	41 ff d5             	call   *%r13
+    sys_yield();
+  800098:	49 bc a7 12 80 00 00 	movabs $0x8012a7,%r12
+  80009f:	00 00 00 
+  8000a2:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a5:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a8:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ab:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ae:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b1:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b4:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b7:	41 ff d4             	call   *%r12
+
+    cprintf("I am the parent.  Killing the child...\n");
+  8000ba:	48 bf 50 50 80 00 00 	movabs $0x805050,%rdi
+  8000c1:	00 00 00 
+  8000c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c9:	41 ff d5             	call   *%r13
+    sys_env_destroy(env);
+  8000cc:	89 df                	mov    %ebx,%edi
+  8000ce:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	5d                   	pop    %rbp
+  8000e4:	c3                   	ret
+
+00000000008000e5 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e5:	55                   	push   %rbp
+  8000e6:	48 89 e5             	mov    %rsp,%rbp
+  8000e9:	41 56                	push   %r14
+  8000eb:	41 55                	push   %r13
+  8000ed:	41 54                	push   %r12
+  8000ef:	53                   	push   %rbx
+  8000f0:	41 89 fd             	mov    %edi,%r13d
+  8000f3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000f6:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8000fd:	00 00 00 
+  800100:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800107:	00 00 00 
+  80010a:	48 39 c2             	cmp    %rax,%rdx
+  80010d:	73 17                	jae    800126 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80010f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800112:	49 89 c4             	mov    %rax,%r12
+  800115:	48 83 c3 08          	add    $0x8,%rbx
+  800119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011e:	ff 53 f8             	call   *-0x8(%rbx)
+  800121:	4c 39 e3             	cmp    %r12,%rbx
+  800124:	72 ef                	jb     800115 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800126:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  80012d:	00 00 00 
+  800130:	ff d0                	call   *%rax
+  800132:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800137:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80013e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800145:	00 00 00 
+  800148:	48 01 d0             	add    %rdx,%rax
+  80014b:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800152:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800155:	45 85 ed             	test   %r13d,%r13d
+  800158:	7e 0d                	jle    800167 <libmain+0x82>
+  80015a:	49 8b 06             	mov    (%r14),%rax
+  80015d:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800164:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800167:	4c 89 f6             	mov    %r14,%rsi
+  80016a:	44 89 ef             	mov    %r13d,%edi
+  80016d:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800174:	00 00 00 
+  800177:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800179:	48 b8 8e 01 80 00 00 	movabs $0x80018e,%rax
+  800180:	00 00 00 
+  800183:	ff d0                	call   *%rax
+#endif
+}
+  800185:	5b                   	pop    %rbx
+  800186:	41 5c                	pop    %r12
+  800188:	41 5d                	pop    %r13
+  80018a:	41 5e                	pop    %r14
+  80018c:	5d                   	pop    %rbp
+  80018d:	c3                   	ret
+
+000000000080018e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80018e:	55                   	push   %rbp
+  80018f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800192:	48 b8 80 20 80 00 00 	movabs $0x802080,%rax
+  800199:	00 00 00 
+  80019c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80019e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a3:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8001aa:	00 00 00 
+  8001ad:	ff d0                	call   *%rax
+}
+  8001af:	5d                   	pop    %rbp
+  8001b0:	c3                   	ret
+
+00000000008001b1 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001b1:	55                   	push   %rbp
+  8001b2:	48 89 e5             	mov    %rsp,%rbp
+  8001b5:	53                   	push   %rbx
+  8001b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ba:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001bd:	8b 06                	mov    (%rsi),%eax
+  8001bf:	8d 50 01             	lea    0x1(%rax),%edx
+  8001c2:	89 16                	mov    %edx,(%rsi)
+  8001c4:	48 98                	cltq
+  8001c6:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001cb:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001d1:	74 0a                	je     8001dd <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001d3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001db:	c9                   	leave
+  8001dc:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001dd:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001e1:	be ff 00 00 00       	mov    $0xff,%esi
+  8001e6:	48 b8 ad 11 80 00 00 	movabs $0x8011ad,%rax
+  8001ed:	00 00 00 
+  8001f0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001f2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001f8:	eb d9                	jmp    8001d3 <putch+0x22>
+
+00000000008001fa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001fa:	55                   	push   %rbp
+  8001fb:	48 89 e5             	mov    %rsp,%rbp
+  8001fe:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800205:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800208:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80020f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800214:	b8 00 00 00 00       	mov    $0x0,%eax
+  800219:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80021c:	48 89 f1             	mov    %rsi,%rcx
+  80021f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800226:	48 bf b1 01 80 00 00 	movabs $0x8001b1,%rdi
+  80022d:	00 00 00 
+  800230:	48 b8 ae 03 80 00 00 	movabs $0x8003ae,%rax
+  800237:	00 00 00 
+  80023a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80023c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800243:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80024a:	48 b8 ad 11 80 00 00 	movabs $0x8011ad,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800256:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+
+000000000080025e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80025e:	55                   	push   %rbp
+  80025f:	48 89 e5             	mov    %rsp,%rbp
+  800262:	48 83 ec 50          	sub    $0x50,%rsp
+  800266:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80026a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80026e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800272:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800276:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80027a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800281:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800285:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800289:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80028d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800291:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800295:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  80029c:	00 00 00 
+  80029f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002a1:	c9                   	leave
+  8002a2:	c3                   	ret
+
+00000000008002a3 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002a3:	55                   	push   %rbp
+  8002a4:	48 89 e5             	mov    %rsp,%rbp
+  8002a7:	41 57                	push   %r15
+  8002a9:	41 56                	push   %r14
+  8002ab:	41 55                	push   %r13
+  8002ad:	41 54                	push   %r12
+  8002af:	53                   	push   %rbx
+  8002b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8002b4:	49 89 fc             	mov    %rdi,%r12
+  8002b7:	49 89 f5             	mov    %rsi,%r13
+  8002ba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002be:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002c1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002c4:	41 89 cf             	mov    %ecx,%r15d
+  8002c7:	4c 39 fa             	cmp    %r15,%rdx
+  8002ca:	73 5b                	jae    800327 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002cc:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002d0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002d4:	85 db                	test   %ebx,%ebx
+  8002d6:	7e 0e                	jle    8002e6 <print_num+0x43>
+            putch(padc, put_arg);
+  8002d8:	4c 89 ee             	mov    %r13,%rsi
+  8002db:	44 89 f7             	mov    %r14d,%edi
+  8002de:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002e1:	83 eb 01             	sub    $0x1,%ebx
+  8002e4:	75 f2                	jne    8002d8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002e6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002ea:	48 b9 b1 50 80 00 00 	movabs $0x8050b1,%rcx
+  8002f1:	00 00 00 
+  8002f4:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8002fb:	00 00 00 
+  8002fe:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800302:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800306:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030b:	49 f7 f7             	div    %r15
+  80030e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800312:	4c 89 ee             	mov    %r13,%rsi
+  800315:	41 ff d4             	call   *%r12
+}
+  800318:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80031c:	5b                   	pop    %rbx
+  80031d:	41 5c                	pop    %r12
+  80031f:	41 5d                	pop    %r13
+  800321:	41 5e                	pop    %r14
+  800323:	41 5f                	pop    %r15
+  800325:	5d                   	pop    %rbp
+  800326:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800327:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80032b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800330:	49 f7 f7             	div    %r15
+  800333:	48 83 ec 08          	sub    $0x8,%rsp
+  800337:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80033b:	52                   	push   %rdx
+  80033c:	45 0f be c9          	movsbl %r9b,%r9d
+  800340:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800344:	48 89 c2             	mov    %rax,%rdx
+  800347:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  80034e:	00 00 00 
+  800351:	ff d0                	call   *%rax
+  800353:	48 83 c4 10          	add    $0x10,%rsp
+  800357:	eb 8d                	jmp    8002e6 <print_num+0x43>
+
+0000000000800359 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800359:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80035d:	48 8b 06             	mov    (%rsi),%rax
+  800360:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800364:	73 0a                	jae    800370 <sprintputch+0x17>
+        *state->start++ = ch;
+  800366:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80036a:	48 89 16             	mov    %rdx,(%rsi)
+  80036d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800370:	c3                   	ret
+
+0000000000800371 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800371:	55                   	push   %rbp
+  800372:	48 89 e5             	mov    %rsp,%rbp
+  800375:	48 83 ec 50          	sub    $0x50,%rsp
+  800379:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80037d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800381:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800385:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80038c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800390:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800394:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800398:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80039c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003a0:	48 b8 ae 03 80 00 00 	movabs $0x8003ae,%rax
+  8003a7:	00 00 00 
+  8003aa:	ff d0                	call   *%rax
+}
+  8003ac:	c9                   	leave
+  8003ad:	c3                   	ret
+
+00000000008003ae <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003ae:	55                   	push   %rbp
+  8003af:	48 89 e5             	mov    %rsp,%rbp
+  8003b2:	41 57                	push   %r15
+  8003b4:	41 56                	push   %r14
+  8003b6:	41 55                	push   %r13
+  8003b8:	41 54                	push   %r12
+  8003ba:	53                   	push   %rbx
+  8003bb:	48 83 ec 38          	sub    $0x38,%rsp
+  8003bf:	49 89 fe             	mov    %rdi,%r14
+  8003c2:	49 89 f5             	mov    %rsi,%r13
+  8003c5:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003c8:	48 8b 01             	mov    (%rcx),%rax
+  8003cb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003cf:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003db:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003df:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003e3:	0f b6 3b             	movzbl (%rbx),%edi
+  8003e6:	40 80 ff 25          	cmp    $0x25,%dil
+  8003ea:	74 18                	je     800404 <vprintfmt+0x56>
+            if (!ch) return;
+  8003ec:	40 84 ff             	test   %dil,%dil
+  8003ef:	0f 84 04 07 00 00    	je     800af9 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8003f5:	40 0f b6 ff          	movzbl %dil,%edi
+  8003f9:	4c 89 ee             	mov    %r13,%rsi
+  8003fc:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003ff:	4c 89 e3             	mov    %r12,%rbx
+  800402:	eb db                	jmp    8003df <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800404:	be 00 00 00 00       	mov    $0x0,%esi
+  800409:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80040d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800412:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800418:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80041f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800423:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800428:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80042d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800430:	83 e8 23             	sub    $0x23,%eax
+  800433:	3c 57                	cmp    $0x57,%al
+  800435:	0f 87 a4 06 00 00    	ja     800adf <vprintfmt+0x731>
+  80043b:	0f b6 c0             	movzbl %al,%eax
+  80043e:	48 b9 40 52 80 00 00 	movabs $0x805240,%rcx
+  800445:	00 00 00 
+  800448:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80044b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80044e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800452:	eb cf                	jmp    800423 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800454:	49 89 dc             	mov    %rbx,%r12
+  800457:	be 01 00 00 00       	mov    $0x1,%esi
+  80045c:	eb c5                	jmp    800423 <vprintfmt+0x75>
+            padc = ch;
+  80045e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800462:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800465:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800468:	eb b9                	jmp    800423 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80046a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80046d:	83 f8 2f             	cmp    $0x2f,%eax
+  800470:	77 24                	ja     800496 <vprintfmt+0xe8>
+  800472:	89 c1                	mov    %eax,%ecx
+  800474:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800478:	83 c0 08             	add    $0x8,%eax
+  80047b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80047e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800481:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800484:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800488:	79 99                	jns    800423 <vprintfmt+0x75>
+                width = precision;
+  80048a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80048e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800494:	eb 8d                	jmp    800423 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800496:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80049a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80049e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a2:	eb da                	jmp    80047e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004a4:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004a9:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004ad:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004b3:	3c 39                	cmp    $0x39,%al
+  8004b5:	77 1c                	ja     8004d3 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004b7:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004bb:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004bf:	0f b6 c0             	movzbl %al,%eax
+  8004c2:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004c7:	0f b6 03             	movzbl (%rbx),%eax
+  8004ca:	3c 39                	cmp    $0x39,%al
+  8004cc:	76 e9                	jbe    8004b7 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004ce:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004d1:	eb b1                	jmp    800484 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004d3:	49 89 dc             	mov    %rbx,%r12
+  8004d6:	eb ac                	jmp    800484 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004d8:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004db:	85 c9                	test   %ecx,%ecx
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	0f 49 c1             	cmovns %ecx,%eax
+  8004e5:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004e8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004eb:	e9 33 ff ff ff       	jmp    800423 <vprintfmt+0x75>
+            lflag++;
+  8004f0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004f3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f6:	e9 28 ff ff ff       	jmp    800423 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800501:	77 19                	ja     80051c <vprintfmt+0x16e>
+  800503:	89 c2                	mov    %eax,%edx
+  800505:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800509:	83 c0 08             	add    $0x8,%eax
+  80050c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80050f:	8b 3a                	mov    (%rdx),%edi
+  800511:	4c 89 ee             	mov    %r13,%rsi
+  800514:	41 ff d6             	call   *%r14
+            break;
+  800517:	e9 c3 fe ff ff       	jmp    8003df <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80051c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800520:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800524:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800528:	eb e5                	jmp    80050f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80052a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052d:	83 f8 2f             	cmp    $0x2f,%eax
+  800530:	77 5a                	ja     80058c <vprintfmt+0x1de>
+  800532:	89 c2                	mov    %eax,%edx
+  800534:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800538:	83 c0 08             	add    $0x8,%eax
+  80053b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80053e:	8b 02                	mov    (%rdx),%eax
+  800540:	89 c1                	mov    %eax,%ecx
+  800542:	f7 d9                	neg    %ecx
+  800544:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800547:	83 f9 13             	cmp    $0x13,%ecx
+  80054a:	7f 4e                	jg     80059a <vprintfmt+0x1ec>
+  80054c:	48 63 c1             	movslq %ecx,%rax
+  80054f:	48 ba 00 55 80 00 00 	movabs $0x805500,%rdx
+  800556:	00 00 00 
+  800559:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80055d:	48 85 c0             	test   %rax,%rax
+  800560:	74 38                	je     80059a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800562:	48 89 c1             	mov    %rax,%rcx
+  800565:	48 ba 59 57 80 00 00 	movabs $0x805759,%rdx
+  80056c:	00 00 00 
+  80056f:	4c 89 ee             	mov    %r13,%rsi
+  800572:	4c 89 f7             	mov    %r14,%rdi
+  800575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057a:	49 b8 71 03 80 00 00 	movabs $0x800371,%r8
+  800581:	00 00 00 
+  800584:	41 ff d0             	call   *%r8
+  800587:	e9 53 fe ff ff       	jmp    8003df <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80058c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800590:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800594:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800598:	eb a4                	jmp    80053e <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80059a:	48 ba c9 50 80 00 00 	movabs $0x8050c9,%rdx
+  8005a1:	00 00 00 
+  8005a4:	4c 89 ee             	mov    %r13,%rsi
+  8005a7:	4c 89 f7             	mov    %r14,%rdi
+  8005aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005af:	49 b8 71 03 80 00 00 	movabs $0x800371,%r8
+  8005b6:	00 00 00 
+  8005b9:	41 ff d0             	call   *%r8
+  8005bc:	e9 1e fe ff ff       	jmp    8003df <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c7:	77 36                	ja     8005ff <vprintfmt+0x251>
+  8005c9:	89 c2                	mov    %eax,%edx
+  8005cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005cf:	83 c0 08             	add    $0x8,%eax
+  8005d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d5:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8005d8:	48 85 f6             	test   %rsi,%rsi
+  8005db:	48 b8 c2 50 80 00 00 	movabs $0x8050c2,%rax
+  8005e2:	00 00 00 
+  8005e5:	48 0f 45 c6          	cmovne %rsi,%rax
+  8005e9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005ed:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005f1:	7e 06                	jle    8005f9 <vprintfmt+0x24b>
+  8005f3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005f7:	75 14                	jne    80060d <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005f9:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8005fd:	eb 5b                	jmp    80065a <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8005ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800603:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800607:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80060b:	eb c8                	jmp    8005d5 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80060d:	49 63 f7             	movslq %r15d,%rsi
+  800610:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800614:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	48 89 c2             	mov    %rax,%rdx
+  800623:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800626:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800628:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80062b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80062e:	85 c0                	test   %eax,%eax
+  800630:	7e c7                	jle    8005f9 <vprintfmt+0x24b>
+  800632:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800637:	4c 89 ee             	mov    %r13,%rsi
+  80063a:	44 89 e7             	mov    %r12d,%edi
+  80063d:	41 ff d6             	call   *%r14
+  800640:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800644:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800647:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80064a:	75 eb                	jne    800637 <vprintfmt+0x289>
+  80064c:	eb ab                	jmp    8005f9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80064e:	0f b6 f8             	movzbl %al,%edi
+  800651:	4c 89 ee             	mov    %r13,%rsi
+  800654:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800657:	4c 89 e2             	mov    %r12,%rdx
+  80065a:	45 85 ff             	test   %r15d,%r15d
+  80065d:	78 06                	js     800665 <vprintfmt+0x2b7>
+  80065f:	41 83 ef 01          	sub    $0x1,%r15d
+  800663:	78 23                	js     800688 <vprintfmt+0x2da>
+  800665:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800669:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80066f:	84 c0                	test   %al,%al
+  800671:	74 15                	je     800688 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800673:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800677:	74 d5                	je     80064e <vprintfmt+0x2a0>
+  800679:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80067c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800681:	80 fa 5e             	cmp    $0x5e,%dl
+  800684:	77 cb                	ja     800651 <vprintfmt+0x2a3>
+  800686:	eb c6                	jmp    80064e <vprintfmt+0x2a0>
+  800688:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80068b:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  80068e:	01 f0                	add    %esi,%eax
+  800690:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800692:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800696:	85 c0                	test   %eax,%eax
+  800698:	0f 8e 41 fd ff ff    	jle    8003df <vprintfmt+0x31>
+  80069e:	4c 89 ee             	mov    %r13,%rsi
+  8006a1:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006a6:	41 ff d6             	call   *%r14
+  8006a9:	41 83 ec 01          	sub    $0x1,%r12d
+  8006ad:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006b1:	75 eb                	jne    80069e <vprintfmt+0x2f0>
+  8006b3:	e9 27 fd ff ff       	jmp    8003df <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8006b8:	40 84 f6             	test   %sil,%sil
+  8006bb:	75 26                	jne    8006e3 <vprintfmt+0x335>
+    switch (lflag) {
+  8006bd:	85 d2                	test   %edx,%edx
+  8006bf:	74 59                	je     80071a <vprintfmt+0x36c>
+  8006c1:	83 fa 01             	cmp    $0x1,%edx
+  8006c4:	74 7b                	je     800741 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8006c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006cc:	0f 87 96 00 00 00    	ja     800768 <vprintfmt+0x3ba>
+  8006d2:	89 c2                	mov    %eax,%edx
+  8006d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d8:	83 c0 08             	add    $0x8,%eax
+  8006db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006de:	4c 8b 22             	mov    (%rdx),%r12
+  8006e1:	eb 17                	jmp    8006fa <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8006e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e9:	77 21                	ja     80070c <vprintfmt+0x35e>
+  8006eb:	89 c2                	mov    %eax,%edx
+  8006ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f1:	83 c0 08             	add    $0x8,%eax
+  8006f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f7:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006fa:	4d 85 e4             	test   %r12,%r12
+  8006fd:	78 7a                	js     800779 <vprintfmt+0x3cb>
+            num = i;
+  8006ff:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800702:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800707:	e9 b5 02 00 00       	jmp    8009c1 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80070c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800710:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800714:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800718:	eb dd                	jmp    8006f7 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  80071a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071d:	83 f8 2f             	cmp    $0x2f,%eax
+  800720:	77 11                	ja     800733 <vprintfmt+0x385>
+  800722:	89 c2                	mov    %eax,%edx
+  800724:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800728:	83 c0 08             	add    $0x8,%eax
+  80072b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072e:	4c 63 22             	movslq (%rdx),%r12
+  800731:	eb c7                	jmp    8006fa <vprintfmt+0x34c>
+  800733:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800737:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80073f:	eb ed                	jmp    80072e <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800741:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800744:	83 f8 2f             	cmp    $0x2f,%eax
+  800747:	77 11                	ja     80075a <vprintfmt+0x3ac>
+  800749:	89 c2                	mov    %eax,%edx
+  80074b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80074f:	83 c0 08             	add    $0x8,%eax
+  800752:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800755:	4c 8b 22             	mov    (%rdx),%r12
+  800758:	eb a0                	jmp    8006fa <vprintfmt+0x34c>
+  80075a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800762:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800766:	eb ed                	jmp    800755 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800768:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800770:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800774:	e9 65 ff ff ff       	jmp    8006de <vprintfmt+0x330>
+                putch('-', put_arg);
+  800779:	4c 89 ee             	mov    %r13,%rsi
+  80077c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800781:	41 ff d6             	call   *%r14
+                i = -i;
+  800784:	49 f7 dc             	neg    %r12
+  800787:	e9 73 ff ff ff       	jmp    8006ff <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  80078c:	40 84 f6             	test   %sil,%sil
+  80078f:	75 32                	jne    8007c3 <vprintfmt+0x415>
+    switch (lflag) {
+  800791:	85 d2                	test   %edx,%edx
+  800793:	74 5d                	je     8007f2 <vprintfmt+0x444>
+  800795:	83 fa 01             	cmp    $0x1,%edx
+  800798:	0f 84 82 00 00 00    	je     800820 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  80079e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a4:	0f 87 a5 00 00 00    	ja     80084f <vprintfmt+0x4a1>
+  8007aa:	89 c2                	mov    %eax,%edx
+  8007ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b0:	83 c0 08             	add    $0x8,%eax
+  8007b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007b9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007be:	e9 fe 01 00 00       	jmp    8009c1 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c9:	77 19                	ja     8007e4 <vprintfmt+0x436>
+  8007cb:	89 c2                	mov    %eax,%edx
+  8007cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d1:	83 c0 08             	add    $0x8,%eax
+  8007d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007da:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007df:	e9 dd 01 00 00       	jmp    8009c1 <vprintfmt+0x613>
+  8007e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f0:	eb e5                	jmp    8007d7 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8007f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f8:	77 18                	ja     800812 <vprintfmt+0x464>
+  8007fa:	89 c2                	mov    %eax,%edx
+  8007fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800800:	83 c0 08             	add    $0x8,%eax
+  800803:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800806:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800808:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80080d:	e9 af 01 00 00       	jmp    8009c1 <vprintfmt+0x613>
+  800812:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800816:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081e:	eb e6                	jmp    800806 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800820:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800823:	83 f8 2f             	cmp    $0x2f,%eax
+  800826:	77 19                	ja     800841 <vprintfmt+0x493>
+  800828:	89 c2                	mov    %eax,%edx
+  80082a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082e:	83 c0 08             	add    $0x8,%eax
+  800831:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800834:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800837:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80083c:	e9 80 01 00 00       	jmp    8009c1 <vprintfmt+0x613>
+  800841:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800845:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800849:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084d:	eb e5                	jmp    800834 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80084f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800853:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800857:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085b:	e9 56 ff ff ff       	jmp    8007b6 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800860:	40 84 f6             	test   %sil,%sil
+  800863:	75 2e                	jne    800893 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800865:	85 d2                	test   %edx,%edx
+  800867:	0f 84 b3 00 00 00    	je     800920 <vprintfmt+0x572>
+  80086d:	83 fa 01             	cmp    $0x1,%edx
+  800870:	0f 84 d3 00 00 00    	je     800949 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800876:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800879:	83 f8 2f             	cmp    $0x2f,%eax
+  80087c:	0f 87 f1 00 00 00    	ja     800973 <vprintfmt+0x5c5>
+  800882:	89 c2                	mov    %eax,%edx
+  800884:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800888:	83 c0 08             	add    $0x8,%eax
+  80088b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088e:	48 8b 02             	mov    (%rdx),%rax
+  800891:	eb 17                	jmp    8008aa <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800893:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800896:	83 f8 2f             	cmp    $0x2f,%eax
+  800899:	77 77                	ja     800912 <vprintfmt+0x564>
+  80089b:	89 c2                	mov    %eax,%edx
+  80089d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a1:	83 c0 08             	add    $0x8,%eax
+  8008a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a7:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8008aa:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8008ac:	83 f8 07             	cmp    $0x7,%eax
+  8008af:	0f 8e cf 00 00 00    	jle    800984 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8008b5:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8008bb:	44 89 e7             	mov    %r12d,%edi
+  8008be:	41 c1 e4 03          	shl    $0x3,%r12d
+  8008c2:	89 d1                	mov    %edx,%ecx
+  8008c4:	8d 72 07             	lea    0x7(%rdx),%esi
+  8008c7:	85 d2                	test   %edx,%edx
+  8008c9:	0f 48 d6             	cmovs  %esi,%edx
+  8008cc:	c1 fa 03             	sar    $0x3,%edx
+  8008cf:	83 f9 3f             	cmp    $0x3f,%ecx
+  8008d2:	7f e7                	jg     8008bb <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8008d4:	85 ff                	test   %edi,%edi
+  8008d6:	0f 84 03 fb ff ff    	je     8003df <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8008dc:	49 63 f4             	movslq %r12d,%rsi
+  8008df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008e4:	48 f7 f6             	div    %rsi
+  8008e7:	49 89 d7             	mov    %rdx,%r15
+  8008ea:	83 c0 30             	add    $0x30,%eax
+  8008ed:	0f be f8             	movsbl %al,%edi
+  8008f0:	4c 89 ee             	mov    %r13,%rsi
+  8008f3:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  8008f6:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  8008f9:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  8008fe:	45 85 e4             	test   %r12d,%r12d
+  800901:	41 0f 49 d4          	cmovns %r12d,%edx
+  800905:	c1 fa 03             	sar    $0x3,%edx
+  800908:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  80090b:	75 cf                	jne    8008dc <vprintfmt+0x52e>
+  80090d:	e9 cd fa ff ff       	jmp    8003df <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800912:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800916:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091e:	eb 87                	jmp    8008a7 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800920:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800923:	83 f8 2f             	cmp    $0x2f,%eax
+  800926:	77 13                	ja     80093b <vprintfmt+0x58d>
+  800928:	89 c2                	mov    %eax,%edx
+  80092a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092e:	83 c0 08             	add    $0x8,%eax
+  800931:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800934:	8b 02                	mov    (%rdx),%eax
+  800936:	e9 6f ff ff ff       	jmp    8008aa <vprintfmt+0x4fc>
+  80093b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800943:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800947:	eb eb                	jmp    800934 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800949:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094c:	83 f8 2f             	cmp    $0x2f,%eax
+  80094f:	77 14                	ja     800965 <vprintfmt+0x5b7>
+  800951:	89 c2                	mov    %eax,%edx
+  800953:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800957:	83 c0 08             	add    $0x8,%eax
+  80095a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095d:	48 8b 02             	mov    (%rdx),%rax
+  800960:	e9 45 ff ff ff       	jmp    8008aa <vprintfmt+0x4fc>
+  800965:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800969:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800971:	eb ea                	jmp    80095d <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800973:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800977:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097f:	e9 0a ff ff ff       	jmp    80088e <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800984:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  80098a:	e9 4d ff ff ff       	jmp    8008dc <vprintfmt+0x52e>
+            putch('0', put_arg);
+  80098f:	4c 89 ee             	mov    %r13,%rsi
+  800992:	bf 30 00 00 00       	mov    $0x30,%edi
+  800997:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80099a:	4c 89 ee             	mov    %r13,%rsi
+  80099d:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009a2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ab:	77 47                	ja     8009f4 <vprintfmt+0x646>
+  8009ad:	89 c2                	mov    %eax,%edx
+  8009af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b3:	83 c0 08             	add    $0x8,%eax
+  8009b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009bc:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8009c5:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009c9:	0f 94 c0             	sete   %al
+  8009cc:	0f b6 c0             	movzbl %al,%eax
+  8009cf:	50                   	push   %rax
+  8009d0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009d5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009d9:	4c 89 ee             	mov    %r13,%rsi
+  8009dc:	4c 89 f7             	mov    %r14,%rdi
+  8009df:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  8009e6:	00 00 00 
+  8009e9:	ff d0                	call   *%rax
+            break;
+  8009eb:	48 83 c4 10          	add    $0x10,%rsp
+  8009ef:	e9 eb f9 ff ff       	jmp    8003df <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a00:	eb b7                	jmp    8009b9 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800a02:	40 84 f6             	test   %sil,%sil
+  800a05:	75 2b                	jne    800a32 <vprintfmt+0x684>
+    switch (lflag) {
+  800a07:	85 d2                	test   %edx,%edx
+  800a09:	74 56                	je     800a61 <vprintfmt+0x6b3>
+  800a0b:	83 fa 01             	cmp    $0x1,%edx
+  800a0e:	74 7f                	je     800a8f <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800a10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a13:	83 f8 2f             	cmp    $0x2f,%eax
+  800a16:	0f 87 a2 00 00 00    	ja     800abe <vprintfmt+0x710>
+  800a1c:	89 c2                	mov    %eax,%edx
+  800a1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a22:	83 c0 08             	add    $0x8,%eax
+  800a25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a28:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a2b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a30:	eb 8f                	jmp    8009c1 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a35:	83 f8 2f             	cmp    $0x2f,%eax
+  800a38:	77 19                	ja     800a53 <vprintfmt+0x6a5>
+  800a3a:	89 c2                	mov    %eax,%edx
+  800a3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a40:	83 c0 08             	add    $0x8,%eax
+  800a43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a49:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a4e:	e9 6e ff ff ff       	jmp    8009c1 <vprintfmt+0x613>
+  800a53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5f:	eb e5                	jmp    800a46 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800a61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a64:	83 f8 2f             	cmp    $0x2f,%eax
+  800a67:	77 18                	ja     800a81 <vprintfmt+0x6d3>
+  800a69:	89 c2                	mov    %eax,%edx
+  800a6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6f:	83 c0 08             	add    $0x8,%eax
+  800a72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a75:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a77:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a7c:	e9 40 ff ff ff       	jmp    8009c1 <vprintfmt+0x613>
+  800a81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8d:	eb e6                	jmp    800a75 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800a8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a92:	83 f8 2f             	cmp    $0x2f,%eax
+  800a95:	77 19                	ja     800ab0 <vprintfmt+0x702>
+  800a97:	89 c2                	mov    %eax,%edx
+  800a99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9d:	83 c0 08             	add    $0x8,%eax
+  800aa0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800aab:	e9 11 ff ff ff       	jmp    8009c1 <vprintfmt+0x613>
+  800ab0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abc:	eb e5                	jmp    800aa3 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800abe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aca:	e9 59 ff ff ff       	jmp    800a28 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800acf:	4c 89 ee             	mov    %r13,%rsi
+  800ad2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ad7:	41 ff d6             	call   *%r14
+            break;
+  800ada:	e9 00 f9 ff ff       	jmp    8003df <vprintfmt+0x31>
+            putch('%', put_arg);
+  800adf:	4c 89 ee             	mov    %r13,%rsi
+  800ae2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ae7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800aea:	48 83 eb 01          	sub    $0x1,%rbx
+  800aee:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800af2:	75 f6                	jne    800aea <vprintfmt+0x73c>
+  800af4:	e9 e6 f8 ff ff       	jmp    8003df <vprintfmt+0x31>
+}
+  800af9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800afd:	5b                   	pop    %rbx
+  800afe:	41 5c                	pop    %r12
+  800b00:	41 5d                	pop    %r13
+  800b02:	41 5e                	pop    %r14
+  800b04:	41 5f                	pop    %r15
+  800b06:	5d                   	pop    %rbp
+  800b07:	c3                   	ret
+
+0000000000800b08 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b08:	55                   	push   %rbp
+  800b09:	48 89 e5             	mov    %rsp,%rbp
+  800b0c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b14:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b19:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b1d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b24:	48 85 ff             	test   %rdi,%rdi
+  800b27:	74 2b                	je     800b54 <vsnprintf+0x4c>
+  800b29:	48 85 f6             	test   %rsi,%rsi
+  800b2c:	74 26                	je     800b54 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b2e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b32:	48 bf 59 03 80 00 00 	movabs $0x800359,%rdi
+  800b39:	00 00 00 
+  800b3c:	48 b8 ae 03 80 00 00 	movabs $0x8003ae,%rax
+  800b43:	00 00 00 
+  800b46:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b4f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b52:	c9                   	leave
+  800b53:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b59:	eb f7                	jmp    800b52 <vsnprintf+0x4a>
+
+0000000000800b5b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b5b:	55                   	push   %rbp
+  800b5c:	48 89 e5             	mov    %rsp,%rbp
+  800b5f:	48 83 ec 50          	sub    $0x50,%rsp
+  800b63:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b67:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b6b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b6f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b76:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b82:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b86:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b8a:	48 b8 08 0b 80 00 00 	movabs $0x800b08,%rax
+  800b91:	00 00 00 
+  800b94:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b96:	c9                   	leave
+  800b97:	c3                   	ret
+
+0000000000800b98 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b98:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b9b:	74 10                	je     800bad <strlen+0x15>
+    size_t n = 0;
+  800b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ba2:	48 83 c0 01          	add    $0x1,%rax
+  800ba6:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800baa:	75 f6                	jne    800ba2 <strlen+0xa>
+  800bac:	c3                   	ret
+    size_t n = 0;
+  800bad:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bb2:	c3                   	ret
+
+0000000000800bb3 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bb3:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bb6:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bbb:	48 85 f6             	test   %rsi,%rsi
+  800bbe:	74 11                	je     800bd1 <strnlen+0x1e>
+  800bc0:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bc4:	74 0c                	je     800bd2 <strnlen+0x1f>
+  800bc6:	48 83 c2 01          	add    $0x1,%rdx
+  800bca:	48 39 d0             	cmp    %rdx,%rax
+  800bcd:	75 f1                	jne    800bc0 <strnlen+0xd>
+  800bcf:	eb 04                	jmp    800bd5 <strnlen+0x22>
+  800bd1:	c3                   	ret
+  800bd2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bd5:	c3                   	ret
+
+0000000000800bd6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bd6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bde:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800be2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800be5:	48 83 c2 01          	add    $0x1,%rdx
+  800be9:	84 c9                	test   %cl,%cl
+  800beb:	75 f1                	jne    800bde <strcpy+0x8>
+        ;
+    return res;
+}
+  800bed:	c3                   	ret
+
+0000000000800bee <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bee:	55                   	push   %rbp
+  800bef:	48 89 e5             	mov    %rsp,%rbp
+  800bf2:	41 54                	push   %r12
+  800bf4:	53                   	push   %rbx
+  800bf5:	48 89 fb             	mov    %rdi,%rbx
+  800bf8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bfb:	48 b8 98 0b 80 00 00 	movabs $0x800b98,%rax
+  800c02:	00 00 00 
+  800c05:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c07:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c0b:	4c 89 e6             	mov    %r12,%rsi
+  800c0e:	48 b8 d6 0b 80 00 00 	movabs $0x800bd6,%rax
+  800c15:	00 00 00 
+  800c18:	ff d0                	call   *%rax
+    return dst;
+}
+  800c1a:	48 89 d8             	mov    %rbx,%rax
+  800c1d:	5b                   	pop    %rbx
+  800c1e:	41 5c                	pop    %r12
+  800c20:	5d                   	pop    %rbp
+  800c21:	c3                   	ret
+
+0000000000800c22 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c22:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c25:	48 85 d2             	test   %rdx,%rdx
+  800c28:	74 1f                	je     800c49 <strncpy+0x27>
+  800c2a:	48 01 fa             	add    %rdi,%rdx
+  800c2d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c30:	48 83 c1 01          	add    $0x1,%rcx
+  800c34:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c38:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c3c:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c40:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c44:	48 39 ca             	cmp    %rcx,%rdx
+  800c47:	75 e7                	jne    800c30 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c49:	c3                   	ret
+
+0000000000800c4a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c4a:	48 89 f8             	mov    %rdi,%rax
+  800c4d:	48 85 d2             	test   %rdx,%rdx
+  800c50:	74 24                	je     800c76 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c52:	48 83 ea 01          	sub    $0x1,%rdx
+  800c56:	74 1b                	je     800c73 <strlcpy+0x29>
+  800c58:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c5c:	0f b6 16             	movzbl (%rsi),%edx
+  800c5f:	84 d2                	test   %dl,%dl
+  800c61:	74 10                	je     800c73 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c63:	48 83 c6 01          	add    $0x1,%rsi
+  800c67:	48 83 c0 01          	add    $0x1,%rax
+  800c6b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c6e:	48 39 c8             	cmp    %rcx,%rax
+  800c71:	75 e9                	jne    800c5c <strlcpy+0x12>
+        *dst = '\0';
+  800c73:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c76:	48 29 f8             	sub    %rdi,%rax
+}
+  800c79:	c3                   	ret
+
+0000000000800c7a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c7a:	0f b6 07             	movzbl (%rdi),%eax
+  800c7d:	84 c0                	test   %al,%al
+  800c7f:	74 13                	je     800c94 <strcmp+0x1a>
+  800c81:	38 06                	cmp    %al,(%rsi)
+  800c83:	75 0f                	jne    800c94 <strcmp+0x1a>
+  800c85:	48 83 c7 01          	add    $0x1,%rdi
+  800c89:	48 83 c6 01          	add    $0x1,%rsi
+  800c8d:	0f b6 07             	movzbl (%rdi),%eax
+  800c90:	84 c0                	test   %al,%al
+  800c92:	75 ed                	jne    800c81 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c94:	0f b6 c0             	movzbl %al,%eax
+  800c97:	0f b6 16             	movzbl (%rsi),%edx
+  800c9a:	29 d0                	sub    %edx,%eax
+}
+  800c9c:	c3                   	ret
+
+0000000000800c9d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c9d:	48 85 d2             	test   %rdx,%rdx
+  800ca0:	74 1f                	je     800cc1 <strncmp+0x24>
+  800ca2:	0f b6 07             	movzbl (%rdi),%eax
+  800ca5:	84 c0                	test   %al,%al
+  800ca7:	74 1e                	je     800cc7 <strncmp+0x2a>
+  800ca9:	3a 06                	cmp    (%rsi),%al
+  800cab:	75 1a                	jne    800cc7 <strncmp+0x2a>
+  800cad:	48 83 c7 01          	add    $0x1,%rdi
+  800cb1:	48 83 c6 01          	add    $0x1,%rsi
+  800cb5:	48 83 ea 01          	sub    $0x1,%rdx
+  800cb9:	75 e7                	jne    800ca2 <strncmp+0x5>
+
+    if (!n) return 0;
+  800cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc0:	c3                   	ret
+  800cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc6:	c3                   	ret
+  800cc7:	48 85 d2             	test   %rdx,%rdx
+  800cca:	74 09                	je     800cd5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ccc:	0f b6 07             	movzbl (%rdi),%eax
+  800ccf:	0f b6 16             	movzbl (%rsi),%edx
+  800cd2:	29 d0                	sub    %edx,%eax
+  800cd4:	c3                   	ret
+    if (!n) return 0;
+  800cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cda:	c3                   	ret
+
+0000000000800cdb <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cdb:	0f b6 17             	movzbl (%rdi),%edx
+  800cde:	84 d2                	test   %dl,%dl
+  800ce0:	74 18                	je     800cfa <strchr+0x1f>
+        if (*str == c) {
+  800ce2:	0f be d2             	movsbl %dl,%edx
+  800ce5:	39 f2                	cmp    %esi,%edx
+  800ce7:	74 17                	je     800d00 <strchr+0x25>
+    for (; *str; str++) {
+  800ce9:	48 83 c7 01          	add    $0x1,%rdi
+  800ced:	0f b6 17             	movzbl (%rdi),%edx
+  800cf0:	84 d2                	test   %dl,%dl
+  800cf2:	75 ee                	jne    800ce2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf9:	c3                   	ret
+  800cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cff:	c3                   	ret
+  800d00:	48 89 f8             	mov    %rdi,%rax
+}
+  800d03:	c3                   	ret
+
+0000000000800d04 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d04:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d07:	0f b6 17             	movzbl (%rdi),%edx
+  800d0a:	84 d2                	test   %dl,%dl
+  800d0c:	74 13                	je     800d21 <strfind+0x1d>
+  800d0e:	0f be d2             	movsbl %dl,%edx
+  800d11:	39 f2                	cmp    %esi,%edx
+  800d13:	74 0b                	je     800d20 <strfind+0x1c>
+  800d15:	48 83 c0 01          	add    $0x1,%rax
+  800d19:	0f b6 10             	movzbl (%rax),%edx
+  800d1c:	84 d2                	test   %dl,%dl
+  800d1e:	75 ee                	jne    800d0e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d20:	c3                   	ret
+  800d21:	c3                   	ret
+
+0000000000800d22 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800d22:	55                   	push   %rbp
+  800d23:	48 89 e5             	mov    %rsp,%rbp
+  800d26:	41 57                	push   %r15
+  800d28:	41 56                	push   %r14
+  800d2a:	41 55                	push   %r13
+  800d2c:	41 54                	push   %r12
+  800d2e:	53                   	push   %rbx
+  800d2f:	48 83 ec 08          	sub    $0x8,%rsp
+  800d33:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800d36:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800d3a:	45 84 ed             	test   %r13b,%r13b
+  800d3d:	75 12                	jne    800d51 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800d3f:	4c 89 f8             	mov    %r15,%rax
+  800d42:	48 83 c4 08          	add    $0x8,%rsp
+  800d46:	5b                   	pop    %rbx
+  800d47:	41 5c                	pop    %r12
+  800d49:	41 5d                	pop    %r13
+  800d4b:	41 5e                	pop    %r14
+  800d4d:	41 5f                	pop    %r15
+  800d4f:	5d                   	pop    %rbp
+  800d50:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800d51:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800d55:	4c 89 e7             	mov    %r12,%rdi
+  800d58:	48 b8 98 0b 80 00 00 	movabs $0x800b98,%rax
+  800d5f:	00 00 00 
+  800d62:	ff d0                	call   *%rax
+  800d64:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800d67:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800d6b:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800d6f:	49 bf 9d 0c 80 00 00 	movabs $0x800c9d,%r15
+  800d76:	00 00 00 
+				if ((sc = *s++) == 0)
+  800d79:	84 c0                	test   %al,%al
+  800d7b:	75 14                	jne    800d91 <strstr+0x6f>
+					return NULL;
+  800d7d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800d83:	eb ba                	jmp    800d3f <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800d85:	48 83 c3 01          	add    $0x1,%rbx
+  800d89:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800d8d:	84 c0                	test   %al,%al
+  800d8f:	74 1b                	je     800dac <strstr+0x8a>
+			} while (sc != c);
+  800d91:	41 38 c5             	cmp    %al,%r13b
+  800d94:	75 ef                	jne    800d85 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800d96:	4c 89 f2             	mov    %r14,%rdx
+  800d99:	4c 89 e6             	mov    %r12,%rsi
+  800d9c:	48 89 df             	mov    %rbx,%rdi
+  800d9f:	41 ff d7             	call   *%r15
+  800da2:	85 c0                	test   %eax,%eax
+  800da4:	75 df                	jne    800d85 <strstr+0x63>
+  800da6:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800daa:	eb 93                	jmp    800d3f <strstr+0x1d>
+					return NULL;
+  800dac:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800db2:	eb 8b                	jmp    800d3f <strstr+0x1d>
+
+0000000000800db4 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800db4:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800db6:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800db9:	8d 57 20             	lea    0x20(%rdi),%edx
+  800dbc:	83 f9 1a             	cmp    $0x1a,%ecx
+  800dbf:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800dc2:	c3                   	ret
+
+0000000000800dc3 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800dc3:	55                   	push   %rbp
+  800dc4:	48 89 e5             	mov    %rsp,%rbp
+  800dc7:	41 57                	push   %r15
+  800dc9:	41 56                	push   %r14
+  800dcb:	41 55                	push   %r13
+  800dcd:	41 54                	push   %r12
+  800dcf:	53                   	push   %rbx
+  800dd0:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800dd4:	48 39 f7             	cmp    %rsi,%rdi
+  800dd7:	74 49                	je     800e22 <strcasecmp+0x5f>
+  800dd9:	49 89 fd             	mov    %rdi,%r13
+  800ddc:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800ddf:	49 bf b4 0d 80 00 00 	movabs $0x800db4,%r15
+  800de6:	00 00 00 
+  800de9:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800dee:	41 0f b6 fe          	movzbl %r14b,%edi
+  800df2:	41 ff d7             	call   *%r15
+  800df5:	89 c3                	mov    %eax,%ebx
+  800df7:	49 83 c4 01          	add    $0x1,%r12
+  800dfb:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e01:	41 ff d7             	call   *%r15
+  800e04:	29 c3                	sub    %eax,%ebx
+  800e06:	75 09                	jne    800e11 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800e08:	49 83 c5 01          	add    $0x1,%r13
+  800e0c:	45 84 f6             	test   %r14b,%r14b
+  800e0f:	75 d8                	jne    800de9 <strcasecmp+0x26>
+}
+  800e11:	89 d8                	mov    %ebx,%eax
+  800e13:	48 83 c4 08          	add    $0x8,%rsp
+  800e17:	5b                   	pop    %rbx
+  800e18:	41 5c                	pop    %r12
+  800e1a:	41 5d                	pop    %r13
+  800e1c:	41 5e                	pop    %r14
+  800e1e:	41 5f                	pop    %r15
+  800e20:	5d                   	pop    %rbp
+  800e21:	c3                   	ret
+        return 0;
+  800e22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e27:	eb e8                	jmp    800e11 <strcasecmp+0x4e>
+
+0000000000800e29 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800e29:	55                   	push   %rbp
+  800e2a:	48 89 e5             	mov    %rsp,%rbp
+  800e2d:	41 57                	push   %r15
+  800e2f:	41 56                	push   %r14
+  800e31:	41 55                	push   %r13
+  800e33:	41 54                	push   %r12
+  800e35:	53                   	push   %rbx
+  800e36:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800e3a:	48 85 d2             	test   %rdx,%rdx
+  800e3d:	74 4f                	je     800e8e <strncasecmp+0x65>
+  800e3f:	49 89 fc             	mov    %rdi,%r12
+  800e42:	49 89 f5             	mov    %rsi,%r13
+  800e45:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800e49:	49 be b4 0d 80 00 00 	movabs $0x800db4,%r14
+  800e50:	00 00 00 
+  800e53:	49 83 c4 01          	add    $0x1,%r12
+  800e57:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800e5d:	41 ff d6             	call   *%r14
+  800e60:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800e62:	49 83 c5 01          	add    $0x1,%r13
+  800e66:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800e6b:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800e6e:	29 c3                	sub    %eax,%ebx
+  800e70:	85 c0                	test   %eax,%eax
+  800e72:	74 09                	je     800e7d <strncasecmp+0x54>
+  800e74:	85 db                	test   %ebx,%ebx
+  800e76:	75 05                	jne    800e7d <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800e78:	4d 39 fc             	cmp    %r15,%r12
+  800e7b:	75 d6                	jne    800e53 <strncasecmp+0x2a>
+}
+  800e7d:	89 d8                	mov    %ebx,%eax
+  800e7f:	48 83 c4 08          	add    $0x8,%rsp
+  800e83:	5b                   	pop    %rbx
+  800e84:	41 5c                	pop    %r12
+  800e86:	41 5d                	pop    %r13
+  800e88:	41 5e                	pop    %r14
+  800e8a:	41 5f                	pop    %r15
+  800e8c:	5d                   	pop    %rbp
+  800e8d:	c3                   	ret
+    int d = 0;
+  800e8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800e93:	eb e8                	jmp    800e7d <strncasecmp+0x54>
+
+0000000000800e95 <toupper>:
+
+int toupper(int c) {
+  800e95:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800e97:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800e9a:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800e9d:	83 f9 1a             	cmp    $0x1a,%ecx
+  800ea0:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800ea3:	c3                   	ret
+
+0000000000800ea4 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800ea4:	83 ff 20             	cmp    $0x20,%edi
+  800ea7:	0f 94 c0             	sete   %al
+  800eaa:	0f b6 c0             	movzbl %al,%eax
+}
+  800ead:	c3                   	ret
+
+0000000000800eae <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800eae:	89 f8                	mov    %edi,%eax
+  800eb0:	f7 d8                	neg    %eax
+  800eb2:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800eb5:	c3                   	ret
+
+0000000000800eb6 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800eb6:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800eb9:	48 89 f8             	mov    %rdi,%rax
+  800ebc:	48 f7 d8             	neg    %rax
+  800ebf:	83 e0 07             	and    $0x7,%eax
+  800ec2:	49 89 d1             	mov    %rdx,%r9
+  800ec5:	49 29 c1             	sub    %rax,%r9
+  800ec8:	78 36                	js     800f00 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800eca:	40 0f b6 c6          	movzbl %sil,%eax
+  800ece:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ed5:	01 01 01 
+  800ed8:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800edc:	40 f6 c7 07          	test   $0x7,%dil
+  800ee0:	75 38                	jne    800f1a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ee2:	4c 89 c9             	mov    %r9,%rcx
+  800ee5:	48 c1 f9 03          	sar    $0x3,%rcx
+  800ee9:	74 0c                	je     800ef7 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800eeb:	fc                   	cld
+  800eec:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800eef:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ef3:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ef7:	4d 85 c9             	test   %r9,%r9
+  800efa:	75 45                	jne    800f41 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800efc:	4c 89 c0             	mov    %r8,%rax
+  800eff:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f00:	48 85 d2             	test   %rdx,%rdx
+  800f03:	74 f7                	je     800efc <memset+0x46>
+  800f05:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f08:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f0b:	48 83 c0 01          	add    $0x1,%rax
+  800f0f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f13:	48 39 c2             	cmp    %rax,%rdx
+  800f16:	75 f3                	jne    800f0b <memset+0x55>
+  800f18:	eb e2                	jmp    800efc <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f1a:	40 f6 c7 01          	test   $0x1,%dil
+  800f1e:	74 06                	je     800f26 <memset+0x70>
+  800f20:	88 07                	mov    %al,(%rdi)
+  800f22:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f26:	40 f6 c7 02          	test   $0x2,%dil
+  800f2a:	74 07                	je     800f33 <memset+0x7d>
+  800f2c:	66 89 07             	mov    %ax,(%rdi)
+  800f2f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f33:	40 f6 c7 04          	test   $0x4,%dil
+  800f37:	74 a9                	je     800ee2 <memset+0x2c>
+  800f39:	89 07                	mov    %eax,(%rdi)
+  800f3b:	48 83 c7 04          	add    $0x4,%rdi
+  800f3f:	eb a1                	jmp    800ee2 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f41:	41 f6 c1 04          	test   $0x4,%r9b
+  800f45:	74 06                	je     800f4d <memset+0x97>
+  800f47:	89 07                	mov    %eax,(%rdi)
+  800f49:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f4d:	41 f6 c1 02          	test   $0x2,%r9b
+  800f51:	74 07                	je     800f5a <memset+0xa4>
+  800f53:	66 89 07             	mov    %ax,(%rdi)
+  800f56:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f5a:	41 f6 c1 01          	test   $0x1,%r9b
+  800f5e:	74 9c                	je     800efc <memset+0x46>
+  800f60:	88 07                	mov    %al,(%rdi)
+  800f62:	eb 98                	jmp    800efc <memset+0x46>
+
+0000000000800f64 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f64:	48 89 f8             	mov    %rdi,%rax
+  800f67:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f6a:	48 39 fe             	cmp    %rdi,%rsi
+  800f6d:	73 3b                	jae    800faa <memmove+0x46>
+  800f6f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f73:	48 39 d7             	cmp    %rdx,%rdi
+  800f76:	73 32                	jae    800faa <memmove+0x46>
+        s += n;
+        d += n;
+  800f78:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f7c:	48 89 d6             	mov    %rdx,%rsi
+  800f7f:	48 09 fe             	or     %rdi,%rsi
+  800f82:	48 09 ce             	or     %rcx,%rsi
+  800f85:	40 f6 c6 07          	test   $0x7,%sil
+  800f89:	75 12                	jne    800f9d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f8b:	48 83 ef 08          	sub    $0x8,%rdi
+  800f8f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f93:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f97:	fd                   	std
+  800f98:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f9b:	fc                   	cld
+  800f9c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f9d:	48 83 ef 01          	sub    $0x1,%rdi
+  800fa1:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fa5:	fd                   	std
+  800fa6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fa8:	eb f1                	jmp    800f9b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800faa:	48 89 f2             	mov    %rsi,%rdx
+  800fad:	48 09 c2             	or     %rax,%rdx
+  800fb0:	48 09 ca             	or     %rcx,%rdx
+  800fb3:	f6 c2 07             	test   $0x7,%dl
+  800fb6:	75 0c                	jne    800fc4 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fb8:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fbc:	48 89 c7             	mov    %rax,%rdi
+  800fbf:	fc                   	cld
+  800fc0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fc3:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fc4:	48 89 c7             	mov    %rax,%rdi
+  800fc7:	fc                   	cld
+  800fc8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fca:	c3                   	ret
+
+0000000000800fcb <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fcb:	55                   	push   %rbp
+  800fcc:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fcf:	48 b8 64 0f 80 00 00 	movabs $0x800f64,%rax
+  800fd6:	00 00 00 
+  800fd9:	ff d0                	call   *%rax
+}
+  800fdb:	5d                   	pop    %rbp
+  800fdc:	c3                   	ret
+
+0000000000800fdd <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fdd:	55                   	push   %rbp
+  800fde:	48 89 e5             	mov    %rsp,%rbp
+  800fe1:	41 57                	push   %r15
+  800fe3:	41 56                	push   %r14
+  800fe5:	41 55                	push   %r13
+  800fe7:	41 54                	push   %r12
+  800fe9:	53                   	push   %rbx
+  800fea:	48 83 ec 08          	sub    $0x8,%rsp
+  800fee:	49 89 fe             	mov    %rdi,%r14
+  800ff1:	49 89 f7             	mov    %rsi,%r15
+  800ff4:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ff7:	48 89 f7             	mov    %rsi,%rdi
+  800ffa:	48 b8 98 0b 80 00 00 	movabs $0x800b98,%rax
+  801001:	00 00 00 
+  801004:	ff d0                	call   *%rax
+  801006:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801009:	48 89 de             	mov    %rbx,%rsi
+  80100c:	4c 89 f7             	mov    %r14,%rdi
+  80100f:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  801016:	00 00 00 
+  801019:	ff d0                	call   *%rax
+  80101b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80101e:	48 39 c3             	cmp    %rax,%rbx
+  801021:	74 36                	je     801059 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801023:	48 89 d8             	mov    %rbx,%rax
+  801026:	4c 29 e8             	sub    %r13,%rax
+  801029:	49 39 c4             	cmp    %rax,%r12
+  80102c:	73 31                	jae    80105f <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80102e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801033:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801037:	4c 89 fe             	mov    %r15,%rsi
+  80103a:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  801041:	00 00 00 
+  801044:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801046:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80104a:	48 83 c4 08          	add    $0x8,%rsp
+  80104e:	5b                   	pop    %rbx
+  80104f:	41 5c                	pop    %r12
+  801051:	41 5d                	pop    %r13
+  801053:	41 5e                	pop    %r14
+  801055:	41 5f                	pop    %r15
+  801057:	5d                   	pop    %rbp
+  801058:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801059:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80105d:	eb eb                	jmp    80104a <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80105f:	48 83 eb 01          	sub    $0x1,%rbx
+  801063:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801067:	48 89 da             	mov    %rbx,%rdx
+  80106a:	4c 89 fe             	mov    %r15,%rsi
+  80106d:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  801074:	00 00 00 
+  801077:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801079:	49 01 de             	add    %rbx,%r14
+  80107c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801081:	eb c3                	jmp    801046 <strlcat+0x69>
+
+0000000000801083 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801083:	48 85 d2             	test   %rdx,%rdx
+  801086:	74 2d                	je     8010b5 <memcmp+0x32>
+  801088:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80108d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801091:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801096:	44 38 c1             	cmp    %r8b,%cl
+  801099:	75 0f                	jne    8010aa <memcmp+0x27>
+    while (n-- > 0) {
+  80109b:	48 83 c0 01          	add    $0x1,%rax
+  80109f:	48 39 c2             	cmp    %rax,%rdx
+  8010a2:	75 e9                	jne    80108d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a9:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010aa:	0f b6 c1             	movzbl %cl,%eax
+  8010ad:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010b1:	44 29 c0             	sub    %r8d,%eax
+  8010b4:	c3                   	ret
+    return 0;
+  8010b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010ba:	c3                   	ret
+
+00000000008010bb <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010bb:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010bf:	48 39 c7             	cmp    %rax,%rdi
+  8010c2:	73 0f                	jae    8010d3 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010c4:	40 38 37             	cmp    %sil,(%rdi)
+  8010c7:	74 0e                	je     8010d7 <memfind+0x1c>
+    for (; src < end; src++) {
+  8010c9:	48 83 c7 01          	add    $0x1,%rdi
+  8010cd:	48 39 f8             	cmp    %rdi,%rax
+  8010d0:	75 f2                	jne    8010c4 <memfind+0x9>
+  8010d2:	c3                   	ret
+  8010d3:	48 89 f8             	mov    %rdi,%rax
+  8010d6:	c3                   	ret
+  8010d7:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010da:	c3                   	ret
+
+00000000008010db <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010db:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010de:	0f b6 37             	movzbl (%rdi),%esi
+  8010e1:	40 80 fe 20          	cmp    $0x20,%sil
+  8010e5:	74 06                	je     8010ed <strtol+0x12>
+  8010e7:	40 80 fe 09          	cmp    $0x9,%sil
+  8010eb:	75 13                	jne    801100 <strtol+0x25>
+  8010ed:	48 83 c7 01          	add    $0x1,%rdi
+  8010f1:	0f b6 37             	movzbl (%rdi),%esi
+  8010f4:	40 80 fe 20          	cmp    $0x20,%sil
+  8010f8:	74 f3                	je     8010ed <strtol+0x12>
+  8010fa:	40 80 fe 09          	cmp    $0x9,%sil
+  8010fe:	74 ed                	je     8010ed <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801100:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801103:	83 e0 fd             	and    $0xfffffffd,%eax
+  801106:	3c 01                	cmp    $0x1,%al
+  801108:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80110c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801112:	75 0f                	jne    801123 <strtol+0x48>
+  801114:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801117:	74 14                	je     80112d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801119:	85 d2                	test   %edx,%edx
+  80111b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801120:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801123:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801128:	4c 63 ca             	movslq %edx,%r9
+  80112b:	eb 36                	jmp    801163 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80112d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801131:	74 0f                	je     801142 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801133:	85 d2                	test   %edx,%edx
+  801135:	75 ec                	jne    801123 <strtol+0x48>
+        s++;
+  801137:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80113b:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801140:	eb e1                	jmp    801123 <strtol+0x48>
+        s += 2;
+  801142:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801146:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80114b:	eb d6                	jmp    801123 <strtol+0x48>
+            dig -= '0';
+  80114d:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801150:	44 0f b6 c1          	movzbl %cl,%r8d
+  801154:	41 39 d0             	cmp    %edx,%r8d
+  801157:	7d 21                	jge    80117a <strtol+0x9f>
+        val = val * base + dig;
+  801159:	49 0f af c1          	imul   %r9,%rax
+  80115d:	0f b6 c9             	movzbl %cl,%ecx
+  801160:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801163:	48 83 c7 01          	add    $0x1,%rdi
+  801167:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80116b:	80 f9 39             	cmp    $0x39,%cl
+  80116e:	76 dd                	jbe    80114d <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801170:	80 f9 7b             	cmp    $0x7b,%cl
+  801173:	77 05                	ja     80117a <strtol+0x9f>
+            dig -= 'a' - 10;
+  801175:	83 e9 57             	sub    $0x57,%ecx
+  801178:	eb d6                	jmp    801150 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80117a:	4d 85 d2             	test   %r10,%r10
+  80117d:	74 03                	je     801182 <strtol+0xa7>
+  80117f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801182:	48 89 c2             	mov    %rax,%rdx
+  801185:	48 f7 da             	neg    %rdx
+  801188:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80118c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801190:	c3                   	ret
+
+0000000000801191 <atoi>:
+int atoi(const char *str) {
+  801191:	55                   	push   %rbp
+  801192:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801195:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119a:	be 00 00 00 00       	mov    $0x0,%esi
+  80119f:	48 b8 db 10 80 00 00 	movabs $0x8010db,%rax
+  8011a6:	00 00 00 
+  8011a9:	ff d0                	call   *%rax
+}
+  8011ab:	5d                   	pop    %rbp
+  8011ac:	c3                   	ret
+
+00000000008011ad <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011ad:	55                   	push   %rbp
+  8011ae:	48 89 e5             	mov    %rsp,%rbp
+  8011b1:	53                   	push   %rbx
+  8011b2:	48 89 fa             	mov    %rdi,%rdx
+  8011b5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b8:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d2:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d8:	c9                   	leave
+  8011d9:	c3                   	ret
+
+00000000008011da <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011da:	55                   	push   %rbp
+  8011db:	48 89 e5             	mov    %rsp,%rbp
+  8011de:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011df:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801203:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801205:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801209:	c9                   	leave
+  80120a:	c3                   	ret
+
+000000000080120b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80120b:	55                   	push   %rbp
+  80120c:	48 89 e5             	mov    %rsp,%rbp
+  80120f:	53                   	push   %rbx
+  801210:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801214:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801217:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80121c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801221:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801226:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122b:	be 00 00 00 00       	mov    $0x0,%esi
+  801230:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801236:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801238:	48 85 c0             	test   %rax,%rax
+  80123b:	7f 06                	jg     801243 <sys_env_destroy+0x38>
+}
+  80123d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801241:	c9                   	leave
+  801242:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801243:	49 89 c0             	mov    %rax,%r8
+  801246:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80124b:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801252:	00 00 00 
+  801255:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80125a:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801261:	00 00 00 
+  801264:	b8 00 00 00 00       	mov    $0x0,%eax
+  801269:	49 b9 e3 40 80 00 00 	movabs $0x8040e3,%r9
+  801270:	00 00 00 
+  801273:	41 ff d1             	call   *%r9
+
+0000000000801276 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801276:	55                   	push   %rbp
+  801277:	48 89 e5             	mov    %rsp,%rbp
+  80127a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80127b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801280:	ba 00 00 00 00       	mov    $0x0,%edx
+  801285:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80128a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801294:	be 00 00 00 00       	mov    $0x0,%esi
+  801299:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a5:	c9                   	leave
+  8012a6:	c3                   	ret
+
+00000000008012a7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012a7:	55                   	push   %rbp
+  8012a8:	48 89 e5             	mov    %rsp,%rbp
+  8012ab:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d0:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d6:	c9                   	leave
+  8012d7:	c3                   	ret
+
+00000000008012d8 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012d8:	55                   	push   %rbp
+  8012d9:	48 89 e5             	mov    %rsp,%rbp
+  8012dc:	53                   	push   %rbx
+  8012dd:	48 89 fa             	mov    %rdi,%rdx
+  8012e0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e8:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012ef:	00 00 00 
+  8012f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801302:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801304:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801308:	c9                   	leave
+  801309:	c3                   	ret
+
+000000000080130a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80130a:	55                   	push   %rbp
+  80130b:	48 89 e5             	mov    %rsp,%rbp
+  80130e:	53                   	push   %rbx
+  80130f:	49 89 f8             	mov    %rdi,%r8
+  801312:	48 89 d3             	mov    %rdx,%rbx
+  801315:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801318:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80131d:	4c 89 c2             	mov    %r8,%rdx
+  801320:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801323:	be 00 00 00 00       	mov    $0x0,%esi
+  801328:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801330:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801334:	c9                   	leave
+  801335:	c3                   	ret
+
+0000000000801336 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801336:	55                   	push   %rbp
+  801337:	48 89 e5             	mov    %rsp,%rbp
+  80133a:	53                   	push   %rbx
+  80133b:	48 83 ec 08          	sub    $0x8,%rsp
+  80133f:	89 f8                	mov    %edi,%eax
+  801341:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801344:	48 63 f9             	movslq %ecx,%rdi
+  801347:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80134a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80134f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801352:	be 00 00 00 00       	mov    $0x0,%esi
+  801357:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80135f:	48 85 c0             	test   %rax,%rax
+  801362:	7f 06                	jg     80136a <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801364:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801368:	c9                   	leave
+  801369:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80136a:	49 89 c0             	mov    %rax,%r8
+  80136d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801372:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801379:	00 00 00 
+  80137c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801381:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801388:	00 00 00 
+  80138b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801390:	49 b9 e3 40 80 00 00 	movabs $0x8040e3,%r9
+  801397:	00 00 00 
+  80139a:	41 ff d1             	call   *%r9
+
+000000000080139d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80139d:	55                   	push   %rbp
+  80139e:	48 89 e5             	mov    %rsp,%rbp
+  8013a1:	53                   	push   %rbx
+  8013a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013a6:	89 f8                	mov    %edi,%eax
+  8013a8:	49 89 f2             	mov    %rsi,%r10
+  8013ab:	48 89 cf             	mov    %rcx,%rdi
+  8013ae:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013b1:	48 63 da             	movslq %edx,%rbx
+  8013b4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b7:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013bc:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013bf:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c4:	48 85 c0             	test   %rax,%rax
+  8013c7:	7f 06                	jg     8013cf <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013cd:	c9                   	leave
+  8013ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013cf:	49 89 c0             	mov    %rax,%r8
+  8013d2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013d7:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8013de:	00 00 00 
+  8013e1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8013e6:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  8013ed:	00 00 00 
+  8013f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f5:	49 b9 e3 40 80 00 00 	movabs $0x8040e3,%r9
+  8013fc:	00 00 00 
+  8013ff:	41 ff d1             	call   *%r9
+
+0000000000801402 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801402:	55                   	push   %rbp
+  801403:	48 89 e5             	mov    %rsp,%rbp
+  801406:	53                   	push   %rbx
+  801407:	48 83 ec 08          	sub    $0x8,%rsp
+  80140b:	49 89 f9             	mov    %rdi,%r9
+  80140e:	89 f0                	mov    %esi,%eax
+  801410:	48 89 d3             	mov    %rdx,%rbx
+  801413:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801416:	49 63 f0             	movslq %r8d,%rsi
+  801419:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80141c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801421:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801424:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142c:	48 85 c0             	test   %rax,%rax
+  80142f:	7f 06                	jg     801437 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801431:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801435:	c9                   	leave
+  801436:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801437:	49 89 c0             	mov    %rax,%r8
+  80143a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80143f:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801446:	00 00 00 
+  801449:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80144e:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801455:	00 00 00 
+  801458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145d:	49 b9 e3 40 80 00 00 	movabs $0x8040e3,%r9
+  801464:	00 00 00 
+  801467:	41 ff d1             	call   *%r9
+
+000000000080146a <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  80146a:	55                   	push   %rbp
+  80146b:	48 89 e5             	mov    %rsp,%rbp
+  80146e:	53                   	push   %rbx
+  80146f:	89 f8                	mov    %edi,%eax
+  801471:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801474:	48 63 f9             	movslq %ecx,%rdi
+  801477:	48 63 da             	movslq %edx,%rbx
+  80147a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80147d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801482:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801485:	be 00 00 00 00       	mov    $0x0,%esi
+  80148a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801490:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  801492:	89 c2                	mov    %eax,%edx
+  801494:	48 85 c0             	test   %rax,%rax
+  801497:	78 0d                	js     8014a6 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801499:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80149e:	4d 85 c9             	test   %r9,%r9
+  8014a1:	74 03                	je     8014a6 <sys_alloc_dma_region+0x3c>
+  8014a3:	49 89 01             	mov    %rax,(%r9)
+}
+  8014a6:	89 d0                	mov    %edx,%eax
+  8014a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ac:	c9                   	leave
+  8014ad:	c3                   	ret
+
+00000000008014ae <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8014ae:	55                   	push   %rbp
+  8014af:	48 89 e5             	mov    %rsp,%rbp
+  8014b2:	53                   	push   %rbx
+  8014b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b7:	48 89 f1             	mov    %rsi,%rcx
+  8014ba:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014bd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c0:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8014cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d7:	48 85 c0             	test   %rax,%rax
+  8014da:	7f 06                	jg     8014e2 <sys_set_cache_region+0x34>
+}
+  8014dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e2:	49 89 c0             	mov    %rax,%r8
+  8014e5:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8014ea:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8014f1:	00 00 00 
+  8014f4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014f9:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801500:	00 00 00 
+  801503:	b8 00 00 00 00       	mov    $0x0,%eax
+  801508:	49 b9 e3 40 80 00 00 	movabs $0x8040e3,%r9
+  80150f:	00 00 00 
+  801512:	41 ff d1             	call   *%r9
+
+0000000000801515 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801515:	55                   	push   %rbp
+  801516:	48 89 e5             	mov    %rsp,%rbp
+  801519:	53                   	push   %rbx
+  80151a:	48 83 ec 08          	sub    $0x8,%rsp
+  80151e:	48 89 f1             	mov    %rsi,%rcx
+  801521:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801524:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801527:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801531:	be 00 00 00 00       	mov    $0x0,%esi
+  801536:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153e:	48 85 c0             	test   %rax,%rax
+  801541:	7f 06                	jg     801549 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801543:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801547:	c9                   	leave
+  801548:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801549:	49 89 c0             	mov    %rax,%r8
+  80154c:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801551:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801558:	00 00 00 
+  80155b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801560:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801567:	00 00 00 
+  80156a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156f:	49 b9 e3 40 80 00 00 	movabs $0x8040e3,%r9
+  801576:	00 00 00 
+  801579:	41 ff d1             	call   *%r9
+
+000000000080157c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80157c:	55                   	push   %rbp
+  80157d:	48 89 e5             	mov    %rsp,%rbp
+  801580:	53                   	push   %rbx
+  801581:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801585:	48 63 ce             	movslq %esi,%rcx
+  801588:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801590:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801595:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159a:	be 00 00 00 00       	mov    $0x0,%esi
+  80159f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a7:	48 85 c0             	test   %rax,%rax
+  8015aa:	7f 06                	jg     8015b2 <sys_env_set_status+0x36>
+}
+  8015ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b0:	c9                   	leave
+  8015b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b2:	49 89 c0             	mov    %rax,%r8
+  8015b5:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8015ba:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  8015c1:	00 00 00 
+  8015c4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015c9:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  8015d0:	00 00 00 
+  8015d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d8:	49 b9 e3 40 80 00 00 	movabs $0x8040e3,%r9
+  8015df:	00 00 00 
+  8015e2:	41 ff d1             	call   *%r9
+
+00000000008015e5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015e5:	55                   	push   %rbp
+  8015e6:	48 89 e5             	mov    %rsp,%rbp
+  8015e9:	53                   	push   %rbx
+  8015ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ee:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015f1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801603:	be 00 00 00 00       	mov    $0x0,%esi
+  801608:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801610:	48 85 c0             	test   %rax,%rax
+  801613:	7f 06                	jg     80161b <sys_env_set_trapframe+0x36>
+}
+  801615:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801619:	c9                   	leave
+  80161a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161b:	49 89 c0             	mov    %rax,%r8
+  80161e:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801623:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  80162a:	00 00 00 
+  80162d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801632:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801639:	00 00 00 
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801641:	49 b9 e3 40 80 00 00 	movabs $0x8040e3,%r9
+  801648:	00 00 00 
+  80164b:	41 ff d1             	call   *%r9
+
+000000000080164e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80164e:	55                   	push   %rbp
+  80164f:	48 89 e5             	mov    %rsp,%rbp
+  801652:	53                   	push   %rbx
+  801653:	48 83 ec 08          	sub    $0x8,%rsp
+  801657:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80165a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801662:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801667:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166c:	be 00 00 00 00       	mov    $0x0,%esi
+  801671:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801677:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801679:	48 85 c0             	test   %rax,%rax
+  80167c:	7f 06                	jg     801684 <sys_env_set_pgfault_upcall+0x36>
+}
+  80167e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801682:	c9                   	leave
+  801683:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801684:	49 89 c0             	mov    %rax,%r8
+  801687:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80168c:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801693:	00 00 00 
+  801696:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80169b:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  8016a2:	00 00 00 
+  8016a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016aa:	49 b9 e3 40 80 00 00 	movabs $0x8040e3,%r9
+  8016b1:	00 00 00 
+  8016b4:	41 ff d1             	call   *%r9
+
+00000000008016b7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016b7:	55                   	push   %rbp
+  8016b8:	48 89 e5             	mov    %rsp,%rbp
+  8016bb:	53                   	push   %rbx
+  8016bc:	89 f8                	mov    %edi,%eax
+  8016be:	49 89 f1             	mov    %rsi,%r9
+  8016c1:	48 89 d3             	mov    %rdx,%rbx
+  8016c4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016c7:	49 63 f0             	movslq %r8d,%rsi
+  8016ca:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cd:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016d2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016db:	cd 30                	int    $0x30
+}
+  8016dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e1:	c9                   	leave
+  8016e2:	c3                   	ret
+
+00000000008016e3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016e3:	55                   	push   %rbp
+  8016e4:	48 89 e5             	mov    %rsp,%rbp
+  8016e7:	53                   	push   %rbx
+  8016e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ec:	48 89 fa             	mov    %rdi,%rdx
+  8016ef:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f2:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801701:	be 00 00 00 00       	mov    $0x0,%esi
+  801706:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80170c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80170e:	48 85 c0             	test   %rax,%rax
+  801711:	7f 06                	jg     801719 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801713:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801717:	c9                   	leave
+  801718:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801719:	49 89 c0             	mov    %rax,%r8
+  80171c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801721:	48 ba c0 55 80 00 00 	movabs $0x8055c0,%rdx
+  801728:	00 00 00 
+  80172b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801730:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801737:	00 00 00 
+  80173a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173f:	49 b9 e3 40 80 00 00 	movabs $0x8040e3,%r9
+  801746:	00 00 00 
+  801749:	41 ff d1             	call   *%r9
+
+000000000080174c <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  80174c:	55                   	push   %rbp
+  80174d:	48 89 e5             	mov    %rsp,%rbp
+  801750:	53                   	push   %rbx
+  801751:	48 89 fa             	mov    %rdi,%rdx
+  801754:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801757:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80175c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801761:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801766:	be 00 00 00 00       	mov    $0x0,%esi
+  80176b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801771:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801773:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801777:	c9                   	leave
+  801778:	c3                   	ret
+
+0000000000801779 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801779:	55                   	push   %rbp
+  80177a:	48 89 e5             	mov    %rsp,%rbp
+  80177d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80177e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801783:	ba 00 00 00 00       	mov    $0x0,%edx
+  801788:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80178d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801792:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801797:	be 00 00 00 00       	mov    $0x0,%esi
+  80179c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a2:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a8:	c9                   	leave
+  8017a9:	c3                   	ret
+
+00000000008017aa <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8017aa:	48 85 ff             	test   %rdi,%rdi
+  8017ad:	0f 84 b6 01 00 00    	je     801969 <malloc+0x1bf>
+malloc(size_t size) {
+  8017b3:	55                   	push   %rbp
+  8017b4:	48 89 e5             	mov    %rsp,%rbp
+  8017b7:	41 56                	push   %r14
+  8017b9:	41 55                	push   %r13
+  8017bb:	41 54                	push   %r12
+  8017bd:	53                   	push   %rbx
+  8017be:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8017c1:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8017c8:	00 00 00 
+  8017cb:	4c 8b 20             	mov    (%rax),%r12
+  8017ce:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  8017d5:	0f 87 94 01 00 00    	ja     80196f <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  8017db:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8017e2:	00 00 00 
+  8017e5:	48 85 c0             	test   %rax,%rax
+  8017e8:	74 6b                	je     801855 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  8017ea:	4d 85 e4             	test   %r12,%r12
+  8017ed:	74 66                	je     801855 <malloc+0xab>
+  8017ef:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  8017f6:	00 00 00 
+  8017f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017fe:	eb 0d                	jmp    80180d <malloc+0x63>
+  801800:	48 83 c1 01          	add    $0x1,%rcx
+  801804:	48 83 c2 18          	add    $0x18,%rdx
+  801808:	49 39 cc             	cmp    %rcx,%r12
+  80180b:	74 48                	je     801855 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80180d:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801812:	74 ec                	je     801800 <malloc+0x56>
+  801814:	48 39 1a             	cmp    %rbx,(%rdx)
+  801817:	72 e7                	jb     801800 <malloc+0x56>
+                real_freep_size--;
+  801819:	48 83 e8 01          	sub    $0x1,%rax
+  80181d:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801824:	00 00 00 
+                freep[i].is_free = false;
+  801827:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80182e:	00 00 00 
+  801831:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801835:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801839:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  80183d:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801844:	00 
+                freep[i].size = size;
+  801845:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801849:	48 01 c8             	add    %rcx,%rax
+  80184c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801850:	e9 0b 01 00 00       	jmp    801960 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801855:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  80185c:	00 00 00 
+  80185f:	48 01 d8             	add    %rbx,%rax
+  801862:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801868:	76 7c                	jbe    8018e6 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  80186a:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801871:	00 00 00 
+  801874:	4c 8b 30             	mov    (%rax),%r14
+  801877:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  80187e:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801881:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801888:	00 00 00 
+  80188b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801892:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801899:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80189f:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8018a3:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  8018aa:	00 00 00 
+  8018ad:	ff d0                	call   *%rax
+  8018af:	89 c7                	mov    %eax,%edi
+  8018b1:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8018b8:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8018bf:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  8018c6:	00 00 00 
+  8018c9:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  8018cd:	b9 26 00 00 00       	mov    $0x26,%ecx
+  8018d2:	48 b8 36 13 80 00 00 	movabs $0x801336,%rax
+  8018d9:	00 00 00 
+  8018dc:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  8018de:	85 c0                	test   %eax,%eax
+  8018e0:	0f 88 90 00 00 00    	js     801976 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  8018e6:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  8018ed:	00 00 00 
+  8018f0:	48 8b 31             	mov    (%rcx),%rsi
+  8018f3:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  8018fa:	00 00 00 
+  8018fd:	4c 8b 07             	mov    (%rdi),%r8
+  801900:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801904:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  80190b:	00 00 00 
+  80190e:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801912:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801916:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80191d:	00 00 00 
+  801920:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801924:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801927:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  80192b:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801932:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801933:	48 89 d8             	mov    %rbx,%rax
+  801936:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80193b:	4c 01 c0             	add    %r8,%rax
+  80193e:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801941:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801948:	48 01 f3             	add    %rsi,%rbx
+  80194b:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  80194e:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801953:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  80195a:	00 00 00 
+  80195d:	48 89 d0             	mov    %rdx,%rax
+}
+  801960:	5b                   	pop    %rbx
+  801961:	41 5c                	pop    %r12
+  801963:	41 5d                	pop    %r13
+  801965:	41 5e                	pop    %r14
+  801967:	5d                   	pop    %rbp
+  801968:	c3                   	ret
+        return NULL;
+  801969:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80196e:	c3                   	ret
+        return NULL;
+  80196f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801974:	eb ea                	jmp    801960 <malloc+0x1b6>
+            return NULL;
+  801976:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197b:	eb e3                	jmp    801960 <malloc+0x1b6>
+
+000000000080197d <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  80197d:	55                   	push   %rbp
+  80197e:	48 89 e5             	mov    %rsp,%rbp
+  801981:	53                   	push   %rbx
+  801982:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801986:	48 89 fb             	mov    %rdi,%rbx
+  801989:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  80198d:	48 89 df             	mov    %rbx,%rdi
+  801990:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  801997:	00 00 00 
+  80199a:	ff d0                	call   *%rax
+  80199c:	48 89 c7             	mov    %rax,%rdi
+  80199f:	48 89 da             	mov    %rbx,%rdx
+  8019a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a7:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  8019ae:	00 00 00 
+  8019b1:	ff d0                	call   *%rax
+}
+  8019b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019b7:	c9                   	leave
+  8019b8:	c3                   	ret
+
+00000000008019b9 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  8019b9:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  8019c0:	00 00 00 
+  8019c3:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8019ca:	00 00 00 
+  8019cd:	48 3b 02             	cmp    (%rdx),%rax
+  8019d0:	74 4d                	je     801a1f <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  8019d2:	48 85 c0             	test   %rax,%rax
+  8019d5:	74 4d                	je     801a24 <get_allocsize+0x6b>
+  8019d7:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8019de:	00 00 00 
+  8019e1:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  8019e6:	48 3b 39             	cmp    (%rcx),%rdi
+  8019e9:	74 13                	je     8019fe <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  8019eb:	48 83 c2 01          	add    $0x1,%rdx
+  8019ef:	48 83 c1 18          	add    $0x18,%rcx
+  8019f3:	48 39 d0             	cmp    %rdx,%rax
+  8019f6:	75 ee                	jne    8019e6 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  8019f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fd:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  8019fe:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a07:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801a0e:	00 00 00 
+  801a11:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801a17:	75 0b                	jne    801a24 <get_allocsize+0x6b>
+  801a19:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801a1e:	c3                   	ret
+        return 0;
+  801a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a24:	c3                   	ret
+
+0000000000801a25 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801a25:	48 85 ff             	test   %rdi,%rdi
+  801a28:	0f 84 01 01 00 00    	je     801b2f <free+0x10a>
+free(void *ptr) {
+  801a2e:	55                   	push   %rbp
+  801a2f:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801a32:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801a39:	00 00 00 
+  801a3c:	48 8b 30             	mov    (%rax),%rsi
+  801a3f:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801a46:	00 00 00 
+  801a49:	48 39 c6             	cmp    %rax,%rsi
+  801a4c:	74 50                	je     801a9e <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801a4e:	48 85 f6             	test   %rsi,%rsi
+  801a51:	74 21                	je     801a74 <free+0x4f>
+  801a53:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801a5a:	00 00 00 
+  801a5d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801a62:	48 3b 39             	cmp    (%rcx),%rdi
+  801a65:	74 61                	je     801ac8 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801a67:	48 83 c2 01          	add    $0x1,%rdx
+  801a6b:	48 83 c1 18          	add    $0x18,%rcx
+  801a6f:	48 39 d6             	cmp    %rdx,%rsi
+  801a72:	75 ee                	jne    801a62 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801a74:	48 ba 30 56 80 00 00 	movabs $0x805630,%rdx
+  801a7b:	00 00 00 
+  801a7e:	be 12 01 00 00       	mov    $0x112,%esi
+  801a83:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801a8a:	00 00 00 
+  801a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a92:	48 b9 e3 40 80 00 00 	movabs $0x8040e3,%rcx
+  801a99:	00 00 00 
+  801a9c:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801a9e:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  801aa5:	00 00 00 
+  801aa8:	be 06 01 00 00       	mov    $0x106,%esi
+  801aad:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801ab4:	00 00 00 
+  801ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abc:	48 b9 e3 40 80 00 00 	movabs $0x8040e3,%rcx
+  801ac3:	00 00 00 
+  801ac6:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801ac8:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801acc:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801ad3:	00 00 00 
+  801ad6:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801adc:	75 27                	jne    801b05 <free+0xe0>
+            freep[i].is_free = true;
+  801ade:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801ae2:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801ae9:	00 00 00 
+  801aec:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801af3:	00 00 
+            real_freep_size++;
+  801af5:	48 83 c0 01          	add    $0x1,%rax
+  801af9:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801b00:	00 00 00 
+}
+  801b03:	5d                   	pop    %rbp
+  801b04:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801b05:	48 ba 08 56 80 00 00 	movabs $0x805608,%rdx
+  801b0c:	00 00 00 
+  801b0f:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801b14:	48 bf 58 56 80 00 00 	movabs $0x805658,%rdi
+  801b1b:	00 00 00 
+  801b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b23:	48 b9 e3 40 80 00 00 	movabs $0x8040e3,%rcx
+  801b2a:	00 00 00 
+  801b2d:	ff d1                	call   *%rcx
+  801b2f:	c3                   	ret
+
+0000000000801b30 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801b30:	55                   	push   %rbp
+  801b31:	48 89 e5             	mov    %rsp,%rbp
+  801b34:	41 55                	push   %r13
+  801b36:	41 54                	push   %r12
+  801b38:	53                   	push   %rbx
+  801b39:	48 83 ec 08          	sub    $0x8,%rsp
+  801b3d:	48 89 fb             	mov    %rdi,%rbx
+  801b40:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801b43:	48 b8 b9 19 80 00 00 	movabs $0x8019b9,%rax
+  801b4a:	00 00 00 
+  801b4d:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801b4f:	49 39 c5             	cmp    %rax,%r13
+  801b52:	73 0e                	jae    801b62 <realloc+0x32>
+}
+  801b54:	48 89 d8             	mov    %rbx,%rax
+  801b57:	48 83 c4 08          	add    $0x8,%rsp
+  801b5b:	5b                   	pop    %rbx
+  801b5c:	41 5c                	pop    %r12
+  801b5e:	41 5d                	pop    %r13
+  801b60:	5d                   	pop    %rbp
+  801b61:	c3                   	ret
+  801b62:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801b65:	4c 89 ef             	mov    %r13,%rdi
+  801b68:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  801b6f:	00 00 00 
+  801b72:	ff d0                	call   *%rax
+  801b74:	48 89 c7             	mov    %rax,%rdi
+  801b77:	4c 89 e2             	mov    %r12,%rdx
+  801b7a:	48 89 de             	mov    %rbx,%rsi
+  801b7d:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  801b84:	00 00 00 
+  801b87:	ff d0                	call   *%rax
+  801b89:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801b8c:	48 89 df             	mov    %rbx,%rdi
+  801b8f:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801b96:	00 00 00 
+  801b99:	ff d0                	call   *%rax
+    return newptr;
+  801b9b:	4c 89 e3             	mov    %r12,%rbx
+  801b9e:	eb b4                	jmp    801b54 <realloc+0x24>
+
+0000000000801ba0 <strdup>:
+
+char*
+strdup (const char *src) {
+  801ba0:	55                   	push   %rbp
+  801ba1:	48 89 e5             	mov    %rsp,%rbp
+  801ba4:	41 54                	push   %r12
+  801ba6:	53                   	push   %rbx
+  801ba7:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801baa:	48 b8 98 0b 80 00 00 	movabs $0x800b98,%rax
+  801bb1:	00 00 00 
+  801bb4:	ff d0                	call   *%rax
+  801bb6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801bba:	4c 89 e7             	mov    %r12,%rdi
+  801bbd:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  801bc4:	00 00 00 
+  801bc7:	ff d0                	call   *%rax
+  801bc9:	48 89 c7             	mov    %rax,%rdi
+  801bcc:	4c 89 e2             	mov    %r12,%rdx
+  801bcf:	48 89 de             	mov    %rbx,%rsi
+  801bd2:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  801bd9:	00 00 00 
+  801bdc:	ff d0                	call   *%rax
+}
+  801bde:	5b                   	pop    %rbx
+  801bdf:	41 5c                	pop    %r12
+  801be1:	5d                   	pop    %rbp
+  801be2:	c3                   	ret
+
+0000000000801be3 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801be3:	55                   	push   %rbp
+  801be4:	48 89 e5             	mov    %rsp,%rbp
+  801be7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801be8:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bed:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bf7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bfc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c01:	be 00 00 00 00       	mov    $0x0,%esi
+  801c06:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c0c:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c12:	c9                   	leave
+  801c13:	c3                   	ret
+
+0000000000801c14 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801c14:	55                   	push   %rbp
+  801c15:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801c18:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c1f:	00 00 00 
+  801c22:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c26:	74 26                	je     801c4e <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801c28:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c2a:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c2e:	89 c0                	mov    %eax,%eax
+  801c30:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801c33:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801c3a:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801c41:	00 00 00 
+  801c44:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c49:	48 f7 31             	divq   (%rcx)
+}
+  801c4c:	5d                   	pop    %rbp
+  801c4d:	c3                   	ret
+        freq = get_cpufreq();
+  801c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c53:	48 ba e3 1b 80 00 00 	movabs $0x801be3,%rdx
+  801c5a:	00 00 00 
+  801c5d:	ff d2                	call   *%rdx
+  801c5f:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801c66:	00 00 00 
+  801c69:	eb bd                	jmp    801c28 <get_ticks+0x14>
+
+0000000000801c6b <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801c6b:	55                   	push   %rbp
+  801c6c:	48 89 e5             	mov    %rsp,%rbp
+  801c6f:	53                   	push   %rbx
+  801c70:	48 83 ec 08          	sub    $0x8,%rsp
+  801c74:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801c77:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c7e:	00 00 00 
+  801c81:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801c85:	74 50                	je     801cd7 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801c87:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801c89:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c8d:	89 c0                	mov    %eax,%eax
+  801c8f:	48 89 d6             	mov    %rdx,%rsi
+  801c92:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801c95:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801c9c:	00 00 00 
+  801c9f:	48 0f af 18          	imul   (%rax),%rbx
+  801ca3:	48 c1 eb 03          	shr    $0x3,%rbx
+  801ca7:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801cae:	9b c4 20 
+  801cb1:	48 89 d8             	mov    %rbx,%rax
+  801cb4:	48 f7 e2             	mul    %rdx
+  801cb7:	48 89 d1             	mov    %rdx,%rcx
+  801cba:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801cbe:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801cc0:	48 c1 e2 20          	shl    $0x20,%rdx
+  801cc4:	89 c0                	mov    %eax,%eax
+  801cc6:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801cc9:	48 29 f2             	sub    %rsi,%rdx
+  801ccc:	48 39 ca             	cmp    %rcx,%rdx
+  801ccf:	72 ed                	jb     801cbe <sleep+0x53>
+}
+  801cd1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cd5:	c9                   	leave
+  801cd6:	c3                   	ret
+        freq = get_cpufreq();
+  801cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdc:	48 ba e3 1b 80 00 00 	movabs $0x801be3,%rdx
+  801ce3:	00 00 00 
+  801ce6:	ff d2                	call   *%rdx
+  801ce8:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801cef:	00 00 00 
+  801cf2:	eb 93                	jmp    801c87 <sleep+0x1c>
+
+0000000000801cf4 <poll_kbd>:
+
+int poll_kbd() {
+  801cf4:	55                   	push   %rbp
+  801cf5:	48 89 e5             	mov    %rsp,%rbp
+  801cf8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cf9:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d03:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d0d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d12:	be 00 00 00 00       	mov    $0x0,%esi
+  801d17:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d1d:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d23:	c9                   	leave
+  801d24:	c3                   	ret
+
+0000000000801d25 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801d25:	55                   	push   %rbp
+  801d26:	48 89 e5             	mov    %rsp,%rbp
+  801d29:	53                   	push   %rbx
+  801d2a:	49 89 fa             	mov    %rdi,%r10
+  801d2d:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801d2f:	44 89 c6             	mov    %r8d,%esi
+  801d32:	89 cf                	mov    %ecx,%edi
+  801d34:	89 d3                	mov    %edx,%ebx
+  801d36:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801d38:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d3d:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d40:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801d44:	cd 30                	int    $0x30
+  801d46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d4a:	c9                   	leave
+  801d4b:	c3                   	ret
+
+0000000000801d4c <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801d4c:	55                   	push   %rbp
+  801d4d:	48 89 e5             	mov    %rsp,%rbp
+  801d50:	41 54                	push   %r12
+  801d52:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  801d53:	48 b8 05 35 80 00 00 	movabs $0x803505,%rax
+  801d5a:	00 00 00 
+  801d5d:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801d5f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801d64:	cd 30                	int    $0x30
+  801d66:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801d69:	85 c0                	test   %eax,%eax
+  801d6b:	78 76                	js     801de3 <fork+0x97>
+        return envid;
+    if (!envid) {
+  801d6d:	74 7c                	je     801deb <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801d6f:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801d75:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801d7c:	00 00 00 
+  801d7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d84:	89 c2                	mov    %eax,%edx
+  801d86:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d90:	48 b8 9d 13 80 00 00 	movabs $0x80139d,%rax
+  801d97:	00 00 00 
+  801d9a:	ff d0                	call   *%rax
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	75 7c                	jne    801e1c <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801da0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801da7:	00 00 00 
+  801daa:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801db1:	44 89 e7             	mov    %r12d,%edi
+  801db4:	48 b8 4e 16 80 00 00 	movabs $0x80164e,%rax
+  801dbb:	00 00 00 
+  801dbe:	ff d0                	call   *%rax
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	75 60                	jne    801e24 <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  801dc4:	be 02 00 00 00       	mov    $0x2,%esi
+  801dc9:	44 89 e7             	mov    %r12d,%edi
+  801dcc:	48 b8 7c 15 80 00 00 	movabs $0x80157c,%rax
+  801dd3:	00 00 00 
+  801dd6:	ff d0                	call   *%rax
+        return -1;
+  801dd8:	85 c0                	test   %eax,%eax
+  801dda:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801ddf:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  801de3:	44 89 e0             	mov    %r12d,%eax
+  801de6:	5b                   	pop    %rbx
+  801de7:	41 5c                	pop    %r12
+  801de9:	5d                   	pop    %rbp
+  801dea:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801deb:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  801df2:	00 00 00 
+  801df5:	ff d0                	call   *%rax
+  801df7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801dfc:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  801e03:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801e0a:	00 00 00 
+  801e0d:	48 01 d0             	add    %rdx,%rax
+  801e10:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  801e17:	00 00 00 
+        return 0;
+  801e1a:	eb c7                	jmp    801de3 <fork+0x97>
+        return -1;
+  801e1c:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e22:	eb bf                	jmp    801de3 <fork+0x97>
+  801e24:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801e2a:	eb b7                	jmp    801de3 <fork+0x97>
+
+0000000000801e2c <sfork>:
+
+envid_t
+sfork() {
+  801e2c:	55                   	push   %rbp
+  801e2d:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801e30:	48 ba 66 56 80 00 00 	movabs $0x805666,%rdx
+  801e37:	00 00 00 
+  801e3a:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801e3f:	48 bf 81 56 80 00 00 	movabs $0x805681,%rdi
+  801e46:	00 00 00 
+  801e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4e:	48 b9 e3 40 80 00 00 	movabs $0x8040e3,%rcx
+  801e55:	00 00 00 
+  801e58:	ff d1                	call   *%rcx
+
+0000000000801e5a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e5a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e61:	ff ff ff 
+  801e64:	48 01 f8             	add    %rdi,%rax
+  801e67:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801e6b:	c3                   	ret
+
+0000000000801e6c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e6c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e73:	ff ff ff 
+  801e76:	48 01 f8             	add    %rdi,%rax
+  801e79:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801e7d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801e83:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801e87:	c3                   	ret
+
+0000000000801e88 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801e88:	55                   	push   %rbp
+  801e89:	48 89 e5             	mov    %rsp,%rbp
+  801e8c:	41 57                	push   %r15
+  801e8e:	41 56                	push   %r14
+  801e90:	41 55                	push   %r13
+  801e92:	41 54                	push   %r12
+  801e94:	53                   	push   %rbx
+  801e95:	48 83 ec 08          	sub    $0x8,%rsp
+  801e99:	49 89 ff             	mov    %rdi,%r15
+  801e9c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ea1:	49 bd 3c 3d 80 00 00 	movabs $0x803d3c,%r13
+  801ea8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801eab:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801eb1:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801eb4:	48 89 df             	mov    %rbx,%rdi
+  801eb7:	41 ff d5             	call   *%r13
+  801eba:	83 e0 04             	and    $0x4,%eax
+  801ebd:	74 17                	je     801ed6 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801ebf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ec6:	4c 39 f3             	cmp    %r14,%rbx
+  801ec9:	75 e6                	jne    801eb1 <fd_alloc+0x29>
+  801ecb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801ed1:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801ed6:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ed9:	48 83 c4 08          	add    $0x8,%rsp
+  801edd:	5b                   	pop    %rbx
+  801ede:	41 5c                	pop    %r12
+  801ee0:	41 5d                	pop    %r13
+  801ee2:	41 5e                	pop    %r14
+  801ee4:	41 5f                	pop    %r15
+  801ee6:	5d                   	pop    %rbp
+  801ee7:	c3                   	ret
+
+0000000000801ee8 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801ee8:	83 ff 1f             	cmp    $0x1f,%edi
+  801eeb:	77 39                	ja     801f26 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801eed:	55                   	push   %rbp
+  801eee:	48 89 e5             	mov    %rsp,%rbp
+  801ef1:	41 54                	push   %r12
+  801ef3:	53                   	push   %rbx
+  801ef4:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ef7:	48 63 df             	movslq %edi,%rbx
+  801efa:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801f01:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801f05:	48 89 df             	mov    %rbx,%rdi
+  801f08:	48 b8 3c 3d 80 00 00 	movabs $0x803d3c,%rax
+  801f0f:	00 00 00 
+  801f12:	ff d0                	call   *%rax
+  801f14:	a8 04                	test   $0x4,%al
+  801f16:	74 14                	je     801f2c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801f18:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f21:	5b                   	pop    %rbx
+  801f22:	41 5c                	pop    %r12
+  801f24:	5d                   	pop    %rbp
+  801f25:	c3                   	ret
+        return -E_INVAL;
+  801f26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801f2b:	c3                   	ret
+        return -E_INVAL;
+  801f2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f31:	eb ee                	jmp    801f21 <fd_lookup+0x39>
+
+0000000000801f33 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801f33:	55                   	push   %rbp
+  801f34:	48 89 e5             	mov    %rsp,%rbp
+  801f37:	41 54                	push   %r12
+  801f39:	53                   	push   %rbx
+  801f3a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801f3d:	48 b8 20 57 80 00 00 	movabs $0x805720,%rax
+  801f44:	00 00 00 
+  801f47:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801f4e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801f51:	39 3b                	cmp    %edi,(%rbx)
+  801f53:	74 47                	je     801f9c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801f55:	48 83 c0 08          	add    $0x8,%rax
+  801f59:	48 8b 18             	mov    (%rax),%rbx
+  801f5c:	48 85 db             	test   %rbx,%rbx
+  801f5f:	75 f0                	jne    801f51 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801f61:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801f68:	00 00 00 
+  801f6b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f71:	89 fa                	mov    %edi,%edx
+  801f73:	48 bf 90 56 80 00 00 	movabs $0x805690,%rdi
+  801f7a:	00 00 00 
+  801f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f82:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  801f89:	00 00 00 
+  801f8c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801f8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801f93:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801f97:	5b                   	pop    %rbx
+  801f98:	41 5c                	pop    %r12
+  801f9a:	5d                   	pop    %rbp
+  801f9b:	c3                   	ret
+            return 0;
+  801f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa1:	eb f0                	jmp    801f93 <dev_lookup+0x60>
+
+0000000000801fa3 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801fa3:	55                   	push   %rbp
+  801fa4:	48 89 e5             	mov    %rsp,%rbp
+  801fa7:	41 55                	push   %r13
+  801fa9:	41 54                	push   %r12
+  801fab:	53                   	push   %rbx
+  801fac:	48 83 ec 18          	sub    $0x18,%rsp
+  801fb0:	48 89 fb             	mov    %rdi,%rbx
+  801fb3:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801fb6:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801fbd:	ff ff ff 
+  801fc0:	48 01 df             	add    %rbx,%rdi
+  801fc3:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801fc7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fcb:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  801fd2:	00 00 00 
+  801fd5:	ff d0                	call   *%rax
+  801fd7:	41 89 c5             	mov    %eax,%r13d
+  801fda:	85 c0                	test   %eax,%eax
+  801fdc:	78 06                	js     801fe4 <fd_close+0x41>
+  801fde:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801fe2:	74 1a                	je     801ffe <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801fe4:	45 84 e4             	test   %r12b,%r12b
+  801fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fec:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ff0:	44 89 e8             	mov    %r13d,%eax
+  801ff3:	48 83 c4 18          	add    $0x18,%rsp
+  801ff7:	5b                   	pop    %rbx
+  801ff8:	41 5c                	pop    %r12
+  801ffa:	41 5d                	pop    %r13
+  801ffc:	5d                   	pop    %rbp
+  801ffd:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ffe:	8b 3b                	mov    (%rbx),%edi
+  802000:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802004:	48 b8 33 1f 80 00 00 	movabs $0x801f33,%rax
+  80200b:	00 00 00 
+  80200e:	ff d0                	call   *%rax
+  802010:	41 89 c5             	mov    %eax,%r13d
+  802013:	85 c0                	test   %eax,%eax
+  802015:	78 1b                	js     802032 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802017:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80201b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80201f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802025:	48 85 c0             	test   %rax,%rax
+  802028:	74 08                	je     802032 <fd_close+0x8f>
+  80202a:	48 89 df             	mov    %rbx,%rdi
+  80202d:	ff d0                	call   *%rax
+  80202f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802032:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802037:	48 89 de             	mov    %rbx,%rsi
+  80203a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80203f:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  802046:	00 00 00 
+  802049:	ff d0                	call   *%rax
+    return res;
+  80204b:	eb a3                	jmp    801ff0 <fd_close+0x4d>
+
+000000000080204d <close>:
+
+int
+close(int fdnum) {
+  80204d:	55                   	push   %rbp
+  80204e:	48 89 e5             	mov    %rsp,%rbp
+  802051:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802055:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802059:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802065:	85 c0                	test   %eax,%eax
+  802067:	78 15                	js     80207e <close+0x31>
+
+    return fd_close(fd, 1);
+  802069:	be 01 00 00 00       	mov    $0x1,%esi
+  80206e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802072:	48 b8 a3 1f 80 00 00 	movabs $0x801fa3,%rax
+  802079:	00 00 00 
+  80207c:	ff d0                	call   *%rax
+}
+  80207e:	c9                   	leave
+  80207f:	c3                   	ret
+
+0000000000802080 <close_all>:
+
+void
+close_all(void) {
+  802080:	55                   	push   %rbp
+  802081:	48 89 e5             	mov    %rsp,%rbp
+  802084:	41 54                	push   %r12
+  802086:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80208c:	49 bc 4d 20 80 00 00 	movabs $0x80204d,%r12
+  802093:	00 00 00 
+  802096:	89 df                	mov    %ebx,%edi
+  802098:	41 ff d4             	call   *%r12
+  80209b:	83 c3 01             	add    $0x1,%ebx
+  80209e:	83 fb 20             	cmp    $0x20,%ebx
+  8020a1:	75 f3                	jne    802096 <close_all+0x16>
+}
+  8020a3:	5b                   	pop    %rbx
+  8020a4:	41 5c                	pop    %r12
+  8020a6:	5d                   	pop    %rbp
+  8020a7:	c3                   	ret
+
+00000000008020a8 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8020a8:	55                   	push   %rbp
+  8020a9:	48 89 e5             	mov    %rsp,%rbp
+  8020ac:	41 57                	push   %r15
+  8020ae:	41 56                	push   %r14
+  8020b0:	41 55                	push   %r13
+  8020b2:	41 54                	push   %r12
+  8020b4:	53                   	push   %rbx
+  8020b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8020b9:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8020bc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8020c0:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  8020c7:	00 00 00 
+  8020ca:	ff d0                	call   *%rax
+  8020cc:	89 c3                	mov    %eax,%ebx
+  8020ce:	85 c0                	test   %eax,%eax
+  8020d0:	0f 88 b8 00 00 00    	js     80218e <dup+0xe6>
+    close(newfdnum);
+  8020d6:	44 89 e7             	mov    %r12d,%edi
+  8020d9:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  8020e0:	00 00 00 
+  8020e3:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8020e5:	4d 63 ec             	movslq %r12d,%r13
+  8020e8:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8020ef:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8020f3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8020f7:	4c 89 ff             	mov    %r15,%rdi
+  8020fa:	49 be 6c 1e 80 00 00 	movabs $0x801e6c,%r14
+  802101:	00 00 00 
+  802104:	41 ff d6             	call   *%r14
+  802107:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80210a:	4c 89 ef             	mov    %r13,%rdi
+  80210d:	41 ff d6             	call   *%r14
+  802110:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802113:	48 89 df             	mov    %rbx,%rdi
+  802116:	48 b8 3c 3d 80 00 00 	movabs $0x803d3c,%rax
+  80211d:	00 00 00 
+  802120:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802122:	a8 04                	test   $0x4,%al
+  802124:	74 2b                	je     802151 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802126:	41 89 c1             	mov    %eax,%r9d
+  802129:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80212f:	4c 89 f1             	mov    %r14,%rcx
+  802132:	ba 00 00 00 00       	mov    $0x0,%edx
+  802137:	48 89 de             	mov    %rbx,%rsi
+  80213a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80213f:	48 b8 9d 13 80 00 00 	movabs $0x80139d,%rax
+  802146:	00 00 00 
+  802149:	ff d0                	call   *%rax
+  80214b:	89 c3                	mov    %eax,%ebx
+  80214d:	85 c0                	test   %eax,%eax
+  80214f:	78 4e                	js     80219f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802151:	4c 89 ff             	mov    %r15,%rdi
+  802154:	48 b8 3c 3d 80 00 00 	movabs $0x803d3c,%rax
+  80215b:	00 00 00 
+  80215e:	ff d0                	call   *%rax
+  802160:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802163:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802169:	4c 89 e9             	mov    %r13,%rcx
+  80216c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802171:	4c 89 fe             	mov    %r15,%rsi
+  802174:	bf 00 00 00 00       	mov    $0x0,%edi
+  802179:	48 b8 9d 13 80 00 00 	movabs $0x80139d,%rax
+  802180:	00 00 00 
+  802183:	ff d0                	call   *%rax
+  802185:	89 c3                	mov    %eax,%ebx
+  802187:	85 c0                	test   %eax,%eax
+  802189:	78 14                	js     80219f <dup+0xf7>
+
+    return newfdnum;
+  80218b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80218e:	89 d8                	mov    %ebx,%eax
+  802190:	48 83 c4 18          	add    $0x18,%rsp
+  802194:	5b                   	pop    %rbx
+  802195:	41 5c                	pop    %r12
+  802197:	41 5d                	pop    %r13
+  802199:	41 5e                	pop    %r14
+  80219b:	41 5f                	pop    %r15
+  80219d:	5d                   	pop    %rbp
+  80219e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80219f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021a4:	4c 89 ee             	mov    %r13,%rsi
+  8021a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021ac:	49 bc 15 15 80 00 00 	movabs $0x801515,%r12
+  8021b3:	00 00 00 
+  8021b6:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8021b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021be:	4c 89 f6             	mov    %r14,%rsi
+  8021c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021c6:	41 ff d4             	call   *%r12
+    return res;
+  8021c9:	eb c3                	jmp    80218e <dup+0xe6>
+
+00000000008021cb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8021cb:	55                   	push   %rbp
+  8021cc:	48 89 e5             	mov    %rsp,%rbp
+  8021cf:	41 56                	push   %r14
+  8021d1:	41 55                	push   %r13
+  8021d3:	41 54                	push   %r12
+  8021d5:	53                   	push   %rbx
+  8021d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8021da:	89 fb                	mov    %edi,%ebx
+  8021dc:	49 89 f4             	mov    %rsi,%r12
+  8021df:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021e2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021e6:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  8021ed:	00 00 00 
+  8021f0:	ff d0                	call   *%rax
+  8021f2:	85 c0                	test   %eax,%eax
+  8021f4:	78 4c                	js     802242 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021f6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8021fa:	41 8b 3e             	mov    (%r14),%edi
+  8021fd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802201:	48 b8 33 1f 80 00 00 	movabs $0x801f33,%rax
+  802208:	00 00 00 
+  80220b:	ff d0                	call   *%rax
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	78 35                	js     802246 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802211:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802215:	83 e0 03             	and    $0x3,%eax
+  802218:	83 f8 01             	cmp    $0x1,%eax
+  80221b:	74 2d                	je     80224a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80221d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802221:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802225:	48 85 c0             	test   %rax,%rax
+  802228:	74 56                	je     802280 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80222a:	4c 89 ea             	mov    %r13,%rdx
+  80222d:	4c 89 e6             	mov    %r12,%rsi
+  802230:	4c 89 f7             	mov    %r14,%rdi
+  802233:	ff d0                	call   *%rax
+}
+  802235:	48 83 c4 10          	add    $0x10,%rsp
+  802239:	5b                   	pop    %rbx
+  80223a:	41 5c                	pop    %r12
+  80223c:	41 5d                	pop    %r13
+  80223e:	41 5e                	pop    %r14
+  802240:	5d                   	pop    %rbp
+  802241:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802242:	48 98                	cltq
+  802244:	eb ef                	jmp    802235 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802246:	48 98                	cltq
+  802248:	eb eb                	jmp    802235 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80224a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802251:	00 00 00 
+  802254:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80225a:	89 da                	mov    %ebx,%edx
+  80225c:	48 bf d1 56 80 00 00 	movabs $0x8056d1,%rdi
+  802263:	00 00 00 
+  802266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226b:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  802272:	00 00 00 
+  802275:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802277:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80227e:	eb b5                	jmp    802235 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802280:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802287:	eb ac                	jmp    802235 <read+0x6a>
+
+0000000000802289 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802289:	55                   	push   %rbp
+  80228a:	48 89 e5             	mov    %rsp,%rbp
+  80228d:	41 57                	push   %r15
+  80228f:	41 56                	push   %r14
+  802291:	41 55                	push   %r13
+  802293:	41 54                	push   %r12
+  802295:	53                   	push   %rbx
+  802296:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80229a:	48 85 d2             	test   %rdx,%rdx
+  80229d:	74 54                	je     8022f3 <readn+0x6a>
+  80229f:	41 89 fd             	mov    %edi,%r13d
+  8022a2:	49 89 f6             	mov    %rsi,%r14
+  8022a5:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8022a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8022ad:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8022b2:	49 bf cb 21 80 00 00 	movabs $0x8021cb,%r15
+  8022b9:	00 00 00 
+  8022bc:	4c 89 e2             	mov    %r12,%rdx
+  8022bf:	48 29 f2             	sub    %rsi,%rdx
+  8022c2:	4c 01 f6             	add    %r14,%rsi
+  8022c5:	44 89 ef             	mov    %r13d,%edi
+  8022c8:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8022cb:	85 c0                	test   %eax,%eax
+  8022cd:	78 20                	js     8022ef <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8022cf:	01 c3                	add    %eax,%ebx
+  8022d1:	85 c0                	test   %eax,%eax
+  8022d3:	74 08                	je     8022dd <readn+0x54>
+  8022d5:	48 63 f3             	movslq %ebx,%rsi
+  8022d8:	4c 39 e6             	cmp    %r12,%rsi
+  8022db:	72 df                	jb     8022bc <readn+0x33>
+    }
+    return res;
+  8022dd:	48 63 c3             	movslq %ebx,%rax
+}
+  8022e0:	48 83 c4 08          	add    $0x8,%rsp
+  8022e4:	5b                   	pop    %rbx
+  8022e5:	41 5c                	pop    %r12
+  8022e7:	41 5d                	pop    %r13
+  8022e9:	41 5e                	pop    %r14
+  8022eb:	41 5f                	pop    %r15
+  8022ed:	5d                   	pop    %rbp
+  8022ee:	c3                   	ret
+        if (inc < 0) return inc;
+  8022ef:	48 98                	cltq
+  8022f1:	eb ed                	jmp    8022e0 <readn+0x57>
+    int inc = 1, res = 0;
+  8022f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022f8:	eb e3                	jmp    8022dd <readn+0x54>
+
+00000000008022fa <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8022fa:	55                   	push   %rbp
+  8022fb:	48 89 e5             	mov    %rsp,%rbp
+  8022fe:	41 56                	push   %r14
+  802300:	41 55                	push   %r13
+  802302:	41 54                	push   %r12
+  802304:	53                   	push   %rbx
+  802305:	48 83 ec 10          	sub    $0x10,%rsp
+  802309:	89 fb                	mov    %edi,%ebx
+  80230b:	49 89 f4             	mov    %rsi,%r12
+  80230e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802311:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802315:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  80231c:	00 00 00 
+  80231f:	ff d0                	call   *%rax
+  802321:	85 c0                	test   %eax,%eax
+  802323:	78 47                	js     80236c <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802325:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802329:	41 8b 3e             	mov    (%r14),%edi
+  80232c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802330:	48 b8 33 1f 80 00 00 	movabs $0x801f33,%rax
+  802337:	00 00 00 
+  80233a:	ff d0                	call   *%rax
+  80233c:	85 c0                	test   %eax,%eax
+  80233e:	78 30                	js     802370 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802340:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802345:	74 2d                	je     802374 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802347:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80234b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80234f:	48 85 c0             	test   %rax,%rax
+  802352:	74 56                	je     8023aa <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802354:	4c 89 ea             	mov    %r13,%rdx
+  802357:	4c 89 e6             	mov    %r12,%rsi
+  80235a:	4c 89 f7             	mov    %r14,%rdi
+  80235d:	ff d0                	call   *%rax
+}
+  80235f:	48 83 c4 10          	add    $0x10,%rsp
+  802363:	5b                   	pop    %rbx
+  802364:	41 5c                	pop    %r12
+  802366:	41 5d                	pop    %r13
+  802368:	41 5e                	pop    %r14
+  80236a:	5d                   	pop    %rbp
+  80236b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80236c:	48 98                	cltq
+  80236e:	eb ef                	jmp    80235f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802370:	48 98                	cltq
+  802372:	eb eb                	jmp    80235f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802374:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80237b:	00 00 00 
+  80237e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802384:	89 da                	mov    %ebx,%edx
+  802386:	48 bf ed 56 80 00 00 	movabs $0x8056ed,%rdi
+  80238d:	00 00 00 
+  802390:	b8 00 00 00 00       	mov    $0x0,%eax
+  802395:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  80239c:	00 00 00 
+  80239f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023a1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023a8:	eb b5                	jmp    80235f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023aa:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8023b1:	eb ac                	jmp    80235f <write+0x65>
+
+00000000008023b3 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8023b3:	55                   	push   %rbp
+  8023b4:	48 89 e5             	mov    %rsp,%rbp
+  8023b7:	53                   	push   %rbx
+  8023b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8023bc:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023be:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023c2:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  8023c9:	00 00 00 
+  8023cc:	ff d0                	call   *%rax
+  8023ce:	85 c0                	test   %eax,%eax
+  8023d0:	78 0c                	js     8023de <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8023d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023d6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023e2:	c9                   	leave
+  8023e3:	c3                   	ret
+
+00000000008023e4 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8023e4:	55                   	push   %rbp
+  8023e5:	48 89 e5             	mov    %rsp,%rbp
+  8023e8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8023ec:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023f0:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  8023f7:	00 00 00 
+  8023fa:	ff d0                	call   *%rax
+  8023fc:	85 c0                	test   %eax,%eax
+  8023fe:	78 07                	js     802407 <tell+0x23>
+    return fdes->fd_offset;
+  802400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802404:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802407:	c9                   	leave
+  802408:	c3                   	ret
+
+0000000000802409 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802409:	55                   	push   %rbp
+  80240a:	48 89 e5             	mov    %rsp,%rbp
+  80240d:	41 55                	push   %r13
+  80240f:	41 54                	push   %r12
+  802411:	53                   	push   %rbx
+  802412:	48 83 ec 18          	sub    $0x18,%rsp
+  802416:	89 fb                	mov    %edi,%ebx
+  802418:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80241b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80241f:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  802426:	00 00 00 
+  802429:	ff d0                	call   *%rax
+  80242b:	85 c0                	test   %eax,%eax
+  80242d:	78 38                	js     802467 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80242f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802433:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802437:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80243b:	48 b8 33 1f 80 00 00 	movabs $0x801f33,%rax
+  802442:	00 00 00 
+  802445:	ff d0                	call   *%rax
+  802447:	85 c0                	test   %eax,%eax
+  802449:	78 1c                	js     802467 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80244b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802450:	74 20                	je     802472 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802452:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802456:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80245a:	48 85 c0             	test   %rax,%rax
+  80245d:	74 47                	je     8024a6 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80245f:	44 89 e6             	mov    %r12d,%esi
+  802462:	4c 89 ef             	mov    %r13,%rdi
+  802465:	ff d0                	call   *%rax
+}
+  802467:	48 83 c4 18          	add    $0x18,%rsp
+  80246b:	5b                   	pop    %rbx
+  80246c:	41 5c                	pop    %r12
+  80246e:	41 5d                	pop    %r13
+  802470:	5d                   	pop    %rbp
+  802471:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802472:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802479:	00 00 00 
+  80247c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802482:	89 da                	mov    %ebx,%edx
+  802484:	48 bf b0 56 80 00 00 	movabs $0x8056b0,%rdi
+  80248b:	00 00 00 
+  80248e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802493:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  80249a:	00 00 00 
+  80249d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80249f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024a4:	eb c1                	jmp    802467 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024a6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024ab:	eb ba                	jmp    802467 <ftruncate+0x5e>
+
+00000000008024ad <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8024ad:	55                   	push   %rbp
+  8024ae:	48 89 e5             	mov    %rsp,%rbp
+  8024b1:	41 54                	push   %r12
+  8024b3:	53                   	push   %rbx
+  8024b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8024b8:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024bb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024bf:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  8024c6:	00 00 00 
+  8024c9:	ff d0                	call   *%rax
+  8024cb:	85 c0                	test   %eax,%eax
+  8024cd:	78 4e                	js     80251d <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024cf:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8024d3:	41 8b 3c 24          	mov    (%r12),%edi
+  8024d7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8024db:	48 b8 33 1f 80 00 00 	movabs $0x801f33,%rax
+  8024e2:	00 00 00 
+  8024e5:	ff d0                	call   *%rax
+  8024e7:	85 c0                	test   %eax,%eax
+  8024e9:	78 32                	js     80251d <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8024eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024ef:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8024f4:	74 30                	je     802526 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8024f6:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8024f9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802500:	00 00 00 
+    stat->st_isdir = 0;
+  802503:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80250a:	00 00 00 
+    stat->st_dev = dev;
+  80250d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802514:	48 89 de             	mov    %rbx,%rsi
+  802517:	4c 89 e7             	mov    %r12,%rdi
+  80251a:	ff 50 28             	call   *0x28(%rax)
+}
+  80251d:	48 83 c4 10          	add    $0x10,%rsp
+  802521:	5b                   	pop    %rbx
+  802522:	41 5c                	pop    %r12
+  802524:	5d                   	pop    %rbp
+  802525:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802526:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80252b:	eb f0                	jmp    80251d <fstat+0x70>
+
+000000000080252d <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  80252d:	55                   	push   %rbp
+  80252e:	48 89 e5             	mov    %rsp,%rbp
+  802531:	41 54                	push   %r12
+  802533:	53                   	push   %rbx
+  802534:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80253b:	41 89 fc             	mov    %edi,%r12d
+  80253e:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802540:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802544:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  80254b:	00 00 00 
+  80254e:	ff d0                	call   *%rax
+  802550:	85 c0                	test   %eax,%eax
+  802552:	78 31                	js     802585 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802554:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80255b:	44 89 e7             	mov    %r12d,%edi
+  80255e:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  802565:	00 00 00 
+  802568:	ff d0                	call   *%rax
+  80256a:	85 c0                	test   %eax,%eax
+  80256c:	78 17                	js     802585 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  80256e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802572:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802575:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802578:	39 d3                	cmp    %edx,%ebx
+  80257a:	0f 4f da             	cmovg  %edx,%ebx
+  80257d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802580:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802585:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  80258c:	5b                   	pop    %rbx
+  80258d:	41 5c                	pop    %r12
+  80258f:	5d                   	pop    %rbp
+  802590:	c3                   	ret
+
+0000000000802591 <seektoend>:
+{
+  802591:	55                   	push   %rbp
+  802592:	48 89 e5             	mov    %rsp,%rbp
+  802595:	53                   	push   %rbx
+  802596:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80259d:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80259f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025a3:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  8025aa:	00 00 00 
+  8025ad:	ff d0                	call   *%rax
+  8025af:	85 c0                	test   %eax,%eax
+  8025b1:	78 28                	js     8025db <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8025b3:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8025ba:	89 df                	mov    %ebx,%edi
+  8025bc:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  8025c3:	00 00 00 
+  8025c6:	ff d0                	call   *%rax
+  8025c8:	85 c0                	test   %eax,%eax
+  8025ca:	78 0f                	js     8025db <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8025cc:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8025cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025d3:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8025d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025df:	c9                   	leave
+  8025e0:	c3                   	ret
+
+00000000008025e1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8025e1:	55                   	push   %rbp
+  8025e2:	48 89 e5             	mov    %rsp,%rbp
+  8025e5:	41 54                	push   %r12
+  8025e7:	53                   	push   %rbx
+  8025e8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8025eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f0:	48 b8 d4 31 80 00 00 	movabs $0x8031d4,%rax
+  8025f7:	00 00 00 
+  8025fa:	ff d0                	call   *%rax
+  8025fc:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8025fe:	85 c0                	test   %eax,%eax
+  802600:	78 25                	js     802627 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802602:	4c 89 e6             	mov    %r12,%rsi
+  802605:	89 c7                	mov    %eax,%edi
+  802607:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  80260e:	00 00 00 
+  802611:	ff d0                	call   *%rax
+  802613:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802616:	89 df                	mov    %ebx,%edi
+  802618:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  80261f:	00 00 00 
+  802622:	ff d0                	call   *%rax
+
+    return res;
+  802624:	44 89 e3             	mov    %r12d,%ebx
+}
+  802627:	89 d8                	mov    %ebx,%eax
+  802629:	5b                   	pop    %rbx
+  80262a:	41 5c                	pop    %r12
+  80262c:	5d                   	pop    %rbp
+  80262d:	c3                   	ret
+
+000000000080262e <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  80262e:	55                   	push   %rbp
+  80262f:	48 89 e5             	mov    %rsp,%rbp
+  802632:	53                   	push   %rbx
+  802633:	48 83 ec 08          	sub    $0x8,%rsp
+  802637:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80263a:	48 b8 5a 1e 80 00 00 	movabs $0x801e5a,%rax
+  802641:	00 00 00 
+  802644:	ff d0                	call   *%rax
+  802646:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80264a:	0f 87 ea 00 00 00    	ja     80273a <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802650:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802657:	00 00 00 
+  80265a:	80 38 00             	cmpb   $0x0,(%rax)
+  80265d:	75 35                	jne    802694 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  80265f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802664:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802669:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  80266e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802673:	48 b8 36 13 80 00 00 	movabs $0x801336,%rax
+  80267a:	00 00 00 
+  80267d:	ff d0                	call   *%rax
+  80267f:	85 c0                	test   %eax,%eax
+  802681:	0f 88 ba 00 00 00    	js     802741 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802687:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80268e:	00 00 00 
+  802691:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802694:	48 89 df             	mov    %rbx,%rdi
+  802697:	48 b8 5a 1e 80 00 00 	movabs $0x801e5a,%rax
+  80269e:	00 00 00 
+  8026a1:	ff d0                	call   *%rax
+  8026a3:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8026a7:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8026ae:	00 00 00 
+  8026b1:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8026b5:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8026b8:	39 39                	cmp    %edi,(%rcx)
+  8026ba:	74 46                	je     802702 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8026bc:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8026c0:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8026c7:	00 
+  8026c8:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8026cf:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8026d6:	00 
+  8026d7:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8026de:	00 
+  8026df:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8026e6:	00 
+  8026e7:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8026ee:	00 
+  8026ef:	89 39                	mov    %edi,(%rcx)
+  8026f1:	48 01 c6             	add    %rax,%rsi
+  8026f4:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8026f9:	48 89 c8             	mov    %rcx,%rax
+  8026fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802700:	c9                   	leave
+  802701:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802702:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802706:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80270d:	00 00 00 
+  802710:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802713:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802717:	74 e0                	je     8026f9 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802719:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802720:	00 
+  802721:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802725:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  80272c:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80272e:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802731:	48 01 c2             	add    %rax,%rdx
+  802734:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802738:	eb bf                	jmp    8026f9 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80273a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80273f:	eb b8                	jmp    8026f9 <fbuf_get+0xcb>
+            return NULL;
+  802741:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802746:	eb b1                	jmp    8026f9 <fbuf_get+0xcb>
+
+0000000000802748 <fsipc_bulk>:
+fsipc_bulk(void) {
+  802748:	55                   	push   %rbp
+  802749:	48 89 e5             	mov    %rsp,%rbp
+  80274c:	53                   	push   %rbx
+  80274d:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802751:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802758:	00 00 00 
+  80275b:	48 8b 18             	mov    (%rax),%rbx
+  80275e:	48 85 db             	test   %rbx,%rbx
+  802761:	74 16                	je     802779 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802763:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  80276a:	00 00 00 
+  80276d:	48 8b 18             	mov    (%rax),%rbx
+}
+  802770:	48 89 d8             	mov    %rbx,%rax
+  802773:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802777:	c9                   	leave
+  802778:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802779:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80277e:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802783:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802788:	bf 00 00 00 00       	mov    $0x0,%edi
+  80278d:	48 b8 36 13 80 00 00 	movabs $0x801336,%rax
+  802794:	00 00 00 
+  802797:	ff d0                	call   *%rax
+  802799:	85 c0                	test   %eax,%eax
+  80279b:	78 d3                	js     802770 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  80279d:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8027a2:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8027a9:	00 00 00 
+  8027ac:	eb b5                	jmp    802763 <fsipc_bulk+0x1b>
+
+00000000008027ae <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8027ae:	55                   	push   %rbp
+  8027af:	48 89 e5             	mov    %rsp,%rbp
+  8027b2:	41 57                	push   %r15
+  8027b4:	41 56                	push   %r14
+  8027b6:	41 55                	push   %r13
+  8027b8:	41 54                	push   %r12
+  8027ba:	53                   	push   %rbx
+  8027bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8027bf:	41 89 fd             	mov    %edi,%r13d
+  8027c2:	49 89 f6             	mov    %rsi,%r14
+  8027c5:	49 89 d7             	mov    %rdx,%r15
+  8027c8:	48 89 cb             	mov    %rcx,%rbx
+  8027cb:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027ce:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8027d5:	00 00 00 
+  8027d8:	83 38 00             	cmpl   $0x0,(%rax)
+  8027db:	74 52                	je     80282f <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  8027dd:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8027e3:	4c 89 f9             	mov    %r15,%rcx
+  8027e6:	4c 89 f2             	mov    %r14,%rdx
+  8027e9:	44 89 ee             	mov    %r13d,%esi
+  8027ec:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8027f3:	00 00 00 
+  8027f6:	8b 38                	mov    (%rax),%edi
+  8027f8:	48 b8 36 43 80 00 00 	movabs $0x804336,%rax
+  8027ff:	00 00 00 
+  802802:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802804:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802809:	4c 89 e2             	mov    %r12,%rdx
+  80280c:	48 89 de             	mov    %rbx,%rsi
+  80280f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802814:	48 b8 86 41 80 00 00 	movabs $0x804186,%rax
+  80281b:	00 00 00 
+  80281e:	ff d0                	call   *%rax
+}
+  802820:	48 83 c4 08          	add    $0x8,%rsp
+  802824:	5b                   	pop    %rbx
+  802825:	41 5c                	pop    %r12
+  802827:	41 5d                	pop    %r13
+  802829:	41 5e                	pop    %r14
+  80282b:	41 5f                	pop    %r15
+  80282d:	5d                   	pop    %rbp
+  80282e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80282f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802834:	48 b8 d9 43 80 00 00 	movabs $0x8043d9,%rax
+  80283b:	00 00 00 
+  80283e:	ff d0                	call   *%rax
+  802840:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802847:	00 00 
+  802849:	eb 92                	jmp    8027dd <fsipc_region+0x2f>
+
+000000000080284b <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80284b:	55                   	push   %rbp
+  80284c:	48 89 e5             	mov    %rsp,%rbp
+  80284f:	41 57                	push   %r15
+  802851:	41 56                	push   %r14
+  802853:	41 55                	push   %r13
+  802855:	41 54                	push   %r12
+  802857:	53                   	push   %rbx
+  802858:	48 83 ec 28          	sub    $0x28,%rsp
+  80285c:	49 89 ff             	mov    %rdi,%r15
+  80285f:	49 89 f6             	mov    %rsi,%r14
+  802862:	48 89 d3             	mov    %rdx,%rbx
+  802865:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802869:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  80286c:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802873:	00 00 00 
+  802876:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802878:	48 85 c0             	test   %rax,%rax
+  80287b:	0f 84 cc 00 00 00    	je     80294d <devfile_write_direct+0x102>
+  802881:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802884:	48 85 db             	test   %rbx,%rbx
+  802887:	0f 84 ba 00 00 00    	je     802947 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  80288d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802893:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80289a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  80289e:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8028a2:	4c 29 e3             	sub    %r12,%rbx
+  8028a5:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8028aa:	48 39 c3             	cmp    %rax,%rbx
+  8028ad:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8028b1:	48 89 da             	mov    %rbx,%rdx
+  8028b4:	4c 89 f6             	mov    %r14,%rsi
+  8028b7:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8028bb:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  8028c2:	00 00 00 
+  8028c5:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8028c7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028cb:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  8028cf:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8028d2:	44 01 e0             	add    %r12d,%eax
+  8028d5:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  8028d9:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  8028dd:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  8028e4:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8028eb:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  8028f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028fd:	4c 89 ee             	mov    %r13,%rsi
+  802900:	bf 04 00 00 00       	mov    $0x4,%edi
+  802905:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  80290c:	00 00 00 
+  80290f:	ff d0                	call   *%rax
+        if (res < 0)
+  802911:	85 c0                	test   %eax,%eax
+  802913:	78 29                	js     80293e <devfile_write_direct+0xf3>
+        if (res == 0)
+  802915:	74 2b                	je     802942 <devfile_write_direct+0xf7>
+        i += res;
+  802917:	48 98                	cltq
+  802919:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  80291c:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  80291f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802923:	49 39 c4             	cmp    %rax,%r12
+  802926:	0f 82 72 ff ff ff    	jb     80289e <devfile_write_direct+0x53>
+    return i;
+  80292c:	4c 89 e0             	mov    %r12,%rax
+}
+  80292f:	48 83 c4 28          	add    $0x28,%rsp
+  802933:	5b                   	pop    %rbx
+  802934:	41 5c                	pop    %r12
+  802936:	41 5d                	pop    %r13
+  802938:	41 5e                	pop    %r14
+  80293a:	41 5f                	pop    %r15
+  80293c:	5d                   	pop    %rbp
+  80293d:	c3                   	ret
+            return res;
+  80293e:	48 98                	cltq
+  802940:	eb ed                	jmp    80292f <devfile_write_direct+0xe4>
+            return i;
+  802942:	4c 89 e0             	mov    %r12,%rax
+  802945:	eb e8                	jmp    80292f <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802947:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  80294b:	eb df                	jmp    80292c <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  80294d:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802954:	eb d9                	jmp    80292f <devfile_write_direct+0xe4>
+
+0000000000802956 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802956:	55                   	push   %rbp
+  802957:	48 89 e5             	mov    %rsp,%rbp
+  80295a:	41 56                	push   %r14
+  80295c:	41 55                	push   %r13
+  80295e:	41 54                	push   %r12
+  802960:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802961:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802965:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296e:	4d 39 ee             	cmp    %r13,%r14
+  802971:	0f 84 99 00 00 00    	je     802a10 <fbuf_flush+0xba>
+  802977:	49 89 fc             	mov    %rdi,%r12
+  80297a:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  80297d:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802980:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802984:	48 b8 5a 1e 80 00 00 	movabs $0x801e5a,%rax
+  80298b:	00 00 00 
+  80298e:	ff d0                	call   *%rax
+  802990:	48 89 c2             	mov    %rax,%rdx
+  802993:	48 c1 e2 04          	shl    $0x4,%rdx
+  802997:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80299b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80299f:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8029a4:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8029a7:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8029ab:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8029b2:	00 
+  8029b3:	44 89 f1             	mov    %r14d,%ecx
+  8029b6:	4c 89 ea             	mov    %r13,%rdx
+  8029b9:	4c 89 e7             	mov    %r12,%rdi
+  8029bc:	48 b8 4b 28 80 00 00 	movabs $0x80284b,%rax
+  8029c3:	00 00 00 
+  8029c6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029c8:	48 85 c0             	test   %rax,%rax
+  8029cb:	78 43                	js     802a10 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  8029cd:	4c 39 e8             	cmp    %r13,%rax
+  8029d0:	72 47                	jb     802a19 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  8029d2:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8029d7:	83 c0 01             	add    $0x1,%eax
+  8029da:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8029df:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  8029e2:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8029e6:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  8029ea:	72 0f                	jb     8029fb <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  8029ec:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8029f0:	48 39 c2             	cmp    %rax,%rdx
+  8029f3:	48 0f 42 d0          	cmovb  %rax,%rdx
+  8029f7:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  8029fb:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802a02:	00 
+  802a03:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802a0a:	00 
+    return 0;
+  802a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a10:	5b                   	pop    %rbx
+  802a11:	41 5c                	pop    %r12
+  802a13:	41 5d                	pop    %r13
+  802a15:	41 5e                	pop    %r14
+  802a17:	5d                   	pop    %rbp
+  802a18:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802a19:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802a1e:	eb f0                	jmp    802a10 <fbuf_flush+0xba>
+
+0000000000802a20 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802a20:	55                   	push   %rbp
+  802a21:	48 89 e5             	mov    %rsp,%rbp
+  802a24:	53                   	push   %rbx
+  802a25:	48 83 ec 08          	sub    $0x8,%rsp
+  802a29:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802a2c:	48 b8 2e 26 80 00 00 	movabs $0x80262e,%rax
+  802a33:	00 00 00 
+  802a36:	ff d0                	call   *%rax
+  802a38:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a40:	48 85 f6             	test   %rsi,%rsi
+  802a43:	74 0f                	je     802a54 <devfile_sync+0x34>
+  802a45:	48 89 df             	mov    %rbx,%rdi
+  802a48:	48 b8 56 29 80 00 00 	movabs $0x802956,%rax
+  802a4f:	00 00 00 
+  802a52:	ff d0                	call   *%rax
+}
+  802a54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a58:	c9                   	leave
+  802a59:	c3                   	ret
+
+0000000000802a5a <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802a5a:	55                   	push   %rbp
+  802a5b:	48 89 e5             	mov    %rsp,%rbp
+  802a5e:	48 83 ec 10          	sub    $0x10,%rsp
+  802a62:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802a65:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802a6c:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802a6d:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802a71:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a76:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802a7d:	00 00 00 
+  802a80:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  802a87:	00 00 00 
+  802a8a:	ff d0                	call   *%rax
+}
+  802a8c:	c9                   	leave
+  802a8d:	c3                   	ret
+
+0000000000802a8e <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802a8e:	55                   	push   %rbp
+  802a8f:	48 89 e5             	mov    %rsp,%rbp
+  802a92:	41 54                	push   %r12
+  802a94:	53                   	push   %rbx
+  802a95:	48 89 fb             	mov    %rdi,%rbx
+  802a98:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802a9b:	48 b8 20 2a 80 00 00 	movabs $0x802a20,%rax
+  802aa2:	00 00 00 
+  802aa5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802aa7:	85 c0                	test   %eax,%eax
+  802aa9:	78 63                	js     802b0e <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802aab:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802aae:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802ab5:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802ab7:	be 00 00 00 00       	mov    $0x0,%esi
+  802abc:	bf 05 00 00 00       	mov    $0x5,%edi
+  802ac1:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802ac8:	00 00 00 
+  802acb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802acd:	85 c0                	test   %eax,%eax
+  802acf:	78 3d                	js     802b0e <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802ad1:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802ad8:	00 00 00 
+  802adb:	48 89 de             	mov    %rbx,%rsi
+  802ade:	4c 89 e7             	mov    %r12,%rdi
+  802ae1:	48 b8 d6 0b 80 00 00 	movabs $0x800bd6,%rax
+  802ae8:	00 00 00 
+  802aeb:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802aed:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802af3:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802afa:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802afb:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802b01:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802b08:	00 
+
+    return 0;
+  802b09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b0e:	5b                   	pop    %rbx
+  802b0f:	41 5c                	pop    %r12
+  802b11:	5d                   	pop    %rbp
+  802b12:	c3                   	ret
+
+0000000000802b13 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b13:	55                   	push   %rbp
+  802b14:	48 89 e5             	mov    %rsp,%rbp
+  802b17:	41 54                	push   %r12
+  802b19:	53                   	push   %rbx
+  802b1a:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802b1d:	48 b8 20 2a 80 00 00 	movabs $0x802a20,%rax
+  802b24:	00 00 00 
+  802b27:	ff d0                	call   *%rax
+  802b29:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802b2c:	48 89 df             	mov    %rbx,%rdi
+  802b2f:	48 b8 5a 1e 80 00 00 	movabs $0x801e5a,%rax
+  802b36:	00 00 00 
+  802b39:	ff d0                	call   *%rax
+  802b3b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802b3f:	76 2e                	jbe    802b6f <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802b41:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b44:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802b4b:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802b4d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b52:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802b57:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802b5e:	00 00 00 
+  802b61:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802b63:	45 85 e4             	test   %r12d,%r12d
+  802b66:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802b6a:	5b                   	pop    %rbx
+  802b6b:	41 5c                	pop    %r12
+  802b6d:	5d                   	pop    %rbp
+  802b6e:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802b6f:	48 89 df             	mov    %rbx,%rdi
+  802b72:	48 b8 5a 1e 80 00 00 	movabs $0x801e5a,%rax
+  802b79:	00 00 00 
+  802b7c:	ff d0                	call   *%rax
+  802b7e:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802b82:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802b89:	00 00 00 
+  802b8c:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802b93:	48 89 df             	mov    %rbx,%rdi
+  802b96:	48 b8 6c 1e 80 00 00 	movabs $0x801e6c,%rax
+  802b9d:	00 00 00 
+  802ba0:	ff d0                	call   *%rax
+  802ba2:	48 89 c6             	mov    %rax,%rsi
+  802ba5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802baa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802baf:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  802bb6:	00 00 00 
+  802bb9:	ff d0                	call   *%rax
+  802bbb:	eb 84                	jmp    802b41 <devfile_flush+0x2e>
+
+0000000000802bbd <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802bbd:	55                   	push   %rbp
+  802bbe:	48 89 e5             	mov    %rsp,%rbp
+  802bc1:	41 55                	push   %r13
+  802bc3:	41 54                	push   %r12
+  802bc5:	53                   	push   %rbx
+  802bc6:	48 83 ec 08          	sub    $0x8,%rsp
+  802bca:	48 89 fb             	mov    %rdi,%rbx
+  802bcd:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802bd0:	48 b8 2e 26 80 00 00 	movabs $0x80262e,%rax
+  802bd7:	00 00 00 
+  802bda:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802bdc:	48 85 c0             	test   %rax,%rax
+  802bdf:	74 51                	je     802c32 <devfile_trunc+0x75>
+  802be1:	49 89 c4             	mov    %rax,%r12
+  802be4:	48 89 c6             	mov    %rax,%rsi
+  802be7:	48 89 df             	mov    %rbx,%rdi
+  802bea:	48 b8 56 29 80 00 00 	movabs $0x802956,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+  802bf6:	85 c0                	test   %eax,%eax
+  802bf8:	78 2d                	js     802c27 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802bfa:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802c01:	00 00 00 
+  802c04:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802c07:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802c09:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802c0d:	be 00 00 00 00       	mov    $0x0,%esi
+  802c12:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c17:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802c1e:	00 00 00 
+  802c21:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802c23:	85 c0                	test   %eax,%eax
+  802c25:	79 3e                	jns    802c65 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802c27:	48 83 c4 08          	add    $0x8,%rsp
+  802c2b:	5b                   	pop    %rbx
+  802c2c:	41 5c                	pop    %r12
+  802c2e:	41 5d                	pop    %r13
+  802c30:	5d                   	pop    %rbp
+  802c31:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802c32:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802c39:	00 00 00 
+  802c3c:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802c3f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802c41:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802c45:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4a:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c4f:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802c56:	00 00 00 
+  802c59:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802c5b:	85 c0                	test   %eax,%eax
+  802c5d:	78 c8                	js     802c27 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802c5f:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c63:	eb c2                	jmp    802c27 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802c65:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802c68:	8d 51 01             	lea    0x1(%rcx),%edx
+  802c6b:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c6e:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802c73:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802c7a:	00 00 
+  802c7c:	eb a9                	jmp    802c27 <devfile_trunc+0x6a>
+
+0000000000802c7e <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802c7e:	55                   	push   %rbp
+  802c7f:	48 89 e5             	mov    %rsp,%rbp
+  802c82:	41 57                	push   %r15
+  802c84:	41 56                	push   %r14
+  802c86:	41 55                	push   %r13
+  802c88:	41 54                	push   %r12
+  802c8a:	53                   	push   %rbx
+  802c8b:	48 83 ec 28          	sub    $0x28,%rsp
+  802c8f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802c93:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802c97:	49 89 d7             	mov    %rdx,%r15
+  802c9a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802c9e:	48 b8 2e 26 80 00 00 	movabs $0x80262e,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+  802caa:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802cad:	48 85 c0             	test   %rax,%rax
+  802cb0:	74 31                	je     802ce3 <devfile_write+0x65>
+  802cb2:	4c 89 f8             	mov    %r15,%rax
+  802cb5:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802cbc:	77 25                	ja     802ce3 <devfile_write+0x65>
+    size_t i = 0;
+  802cbe:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802cc4:	48 85 c0             	test   %rax,%rax
+  802cc7:	0f 85 64 01 00 00    	jne    802e31 <devfile_write+0x1b3>
+    size_t i = 0;
+  802ccd:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802cd1:	4c 89 f8             	mov    %r15,%rax
+}
+  802cd4:	48 83 c4 28          	add    $0x28,%rsp
+  802cd8:	5b                   	pop    %rbx
+  802cd9:	41 5c                	pop    %r12
+  802cdb:	41 5d                	pop    %r13
+  802cdd:	41 5e                	pop    %r14
+  802cdf:	41 5f                	pop    %r15
+  802ce1:	5d                   	pop    %rbp
+  802ce2:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ce3:	48 85 db             	test   %rbx,%rbx
+  802ce6:	74 5b                	je     802d43 <devfile_write+0xc5>
+  802ce8:	48 89 de             	mov    %rbx,%rsi
+  802ceb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802cef:	48 b8 56 29 80 00 00 	movabs $0x802956,%rax
+  802cf6:	00 00 00 
+  802cf9:	ff d0                	call   *%rax
+  802cfb:	85 c0                	test   %eax,%eax
+  802cfd:	78 40                	js     802d3f <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802cff:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d03:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802d06:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d0a:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802d0e:	48 b8 4b 28 80 00 00 	movabs $0x80284b,%rax
+  802d15:	00 00 00 
+  802d18:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802d1a:	48 85 c0             	test   %rax,%rax
+  802d1d:	7e b5                	jle    802cd4 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802d1f:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802d23:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802d26:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802d29:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802d2c:	8d 51 01             	lea    0x1(%rcx),%edx
+  802d2f:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d32:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802d35:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802d3c:	00 
+  802d3d:	eb 95                	jmp    802cd4 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d3f:	48 98                	cltq
+  802d41:	eb 91                	jmp    802cd4 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802d43:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802d47:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802d4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d4e:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802d52:	48 89 df             	mov    %rbx,%rdi
+  802d55:	48 b8 4b 28 80 00 00 	movabs $0x80284b,%rax
+  802d5c:	00 00 00 
+  802d5f:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802d61:	48 85 c0             	test   %rax,%rax
+  802d64:	0f 8e 6a ff ff ff    	jle    802cd4 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802d6a:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802d6d:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d71:	e9 5e ff ff ff       	jmp    802cd4 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d76:	48 98                	cltq
+  802d78:	4d 85 ff             	test   %r15,%r15
+  802d7b:	49 0f 45 c7          	cmovne %r15,%rax
+  802d7f:	e9 50 ff ff ff       	jmp    802cd4 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d84:	48 89 de             	mov    %rbx,%rsi
+  802d87:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d8b:	48 b8 56 29 80 00 00 	movabs $0x802956,%rax
+  802d92:	00 00 00 
+  802d95:	ff d0                	call   *%rax
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	0f 88 2b 01 00 00    	js     802eca <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802d9f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802da3:	4c 01 f8             	add    %r15,%rax
+  802da6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802daa:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802dae:	48 b9 5a 1e 80 00 00 	movabs $0x801e5a,%rcx
+  802db5:	00 00 00 
+  802db8:	ff d1                	call   *%rcx
+  802dba:	48 89 c2             	mov    %rax,%rdx
+  802dbd:	48 c1 e2 04          	shl    $0x4,%rdx
+  802dc1:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802dc5:	48 c1 e0 0c          	shl    $0xc,%rax
+  802dc9:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802dce:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802dd1:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802dd8:	00 
+  802dd9:	4c 89 ea             	mov    %r13,%rdx
+  802ddc:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802de0:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  802de7:	00 00 00 
+  802dea:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802dec:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802df0:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802df4:	48 39 c2             	cmp    %rax,%rdx
+  802df7:	0f 84 db 00 00 00    	je     802ed8 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802dfd:	4c 39 e2             	cmp    %r12,%rdx
+  802e00:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802e04:	4d 01 ec             	add    %r13,%r12
+  802e07:	49 39 c4             	cmp    %rax,%r12
+  802e0a:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802e0e:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802e12:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802e16:	45 01 ee             	add    %r13d,%r14d
+  802e19:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e1d:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802e21:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802e24:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e28:	49 39 c7             	cmp    %rax,%r15
+  802e2b:	0f 83 a0 fe ff ff    	jae    802cd1 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802e31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e35:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802e39:	8b 43 08             	mov    0x8(%rbx),%eax
+  802e3c:	44 39 f0             	cmp    %r14d,%eax
+  802e3f:	7f 10                	jg     802e51 <devfile_write+0x1d3>
+  802e41:	48 98                	cltq
+  802e43:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802e49:	49 63 d6             	movslq %r14d,%rdx
+  802e4c:	48 39 d0             	cmp    %rdx,%rax
+  802e4f:	7d 2d                	jge    802e7e <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e51:	48 89 de             	mov    %rbx,%rsi
+  802e54:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e58:	48 b8 56 29 80 00 00 	movabs $0x802956,%rax
+  802e5f:	00 00 00 
+  802e62:	ff d0                	call   *%rax
+  802e64:	85 c0                	test   %eax,%eax
+  802e66:	0f 88 0a ff ff ff    	js     802d76 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802e6c:	44 89 f0             	mov    %r14d,%eax
+  802e6f:	66 b8 00 00          	mov    $0x0,%ax
+  802e73:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802e76:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802e7d:	00 
+        size_t off = pos - fb->fb_base;
+  802e7e:	45 89 f4             	mov    %r14d,%r12d
+  802e81:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802e85:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802e88:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802e8c:	4d 29 fd             	sub    %r15,%r13
+  802e8f:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802e94:	4c 29 e0             	sub    %r12,%rax
+  802e97:	49 39 c5             	cmp    %rax,%r13
+  802e9a:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802e9e:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802ea2:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802ea6:	48 39 c2             	cmp    %rax,%rdx
+  802ea9:	0f 84 f0 fe ff ff    	je     802d9f <devfile_write+0x121>
+  802eaf:	4c 39 e0             	cmp    %r12,%rax
+  802eb2:	0f 82 cc fe ff ff    	jb     802d84 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802eb8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802ebc:	48 39 d0             	cmp    %rdx,%rax
+  802ebf:	0f 83 da fe ff ff    	jae    802d9f <devfile_write+0x121>
+  802ec5:	e9 ba fe ff ff       	jmp    802d84 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802eca:	48 98                	cltq
+  802ecc:	4d 85 ff             	test   %r15,%r15
+  802ecf:	49 0f 45 c7          	cmovne %r15,%rax
+  802ed3:	e9 fc fd ff ff       	jmp    802cd4 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802ed8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802edc:	4c 89 e2             	mov    %r12,%rdx
+  802edf:	e9 2a ff ff ff       	jmp    802e0e <devfile_write+0x190>
+
+0000000000802ee4 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802ee4:	55                   	push   %rbp
+  802ee5:	48 89 e5             	mov    %rsp,%rbp
+  802ee8:	41 57                	push   %r15
+  802eea:	41 56                	push   %r14
+  802eec:	41 55                	push   %r13
+  802eee:	41 54                	push   %r12
+  802ef0:	53                   	push   %rbx
+  802ef1:	48 83 ec 28          	sub    $0x28,%rsp
+  802ef5:	49 89 ff             	mov    %rdi,%r15
+  802ef8:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802efc:	48 89 d3             	mov    %rdx,%rbx
+  802eff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f03:	48 b8 2e 26 80 00 00 	movabs $0x80262e,%rax
+  802f0a:	00 00 00 
+  802f0d:	ff d0                	call   *%rax
+  802f0f:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802f12:	48 85 c0             	test   %rax,%rax
+  802f15:	74 0d                	je     802f24 <devfile_read+0x40>
+  802f17:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802f1e:	0f 86 1a 01 00 00    	jbe    80303e <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f24:	4d 85 e4             	test   %r12,%r12
+  802f27:	74 1a                	je     802f43 <devfile_read+0x5f>
+  802f29:	4c 89 e6             	mov    %r12,%rsi
+  802f2c:	4c 89 ff             	mov    %r15,%rdi
+  802f2f:	48 b8 56 29 80 00 00 	movabs $0x802956,%rax
+  802f36:	00 00 00 
+  802f39:	ff d0                	call   *%rax
+  802f3b:	85 c0                	test   %eax,%eax
+  802f3d:	0f 88 e8 00 00 00    	js     80302b <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802f43:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802f47:	48 b8 48 27 80 00 00 	movabs $0x802748,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+  802f53:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802f56:	48 85 c0             	test   %rax,%rax
+  802f59:	0f 84 69 02 00 00    	je     8031c8 <devfile_read+0x2e4>
+    while (i < n) {
+  802f5f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802f64:	0f 84 ce 00 00 00    	je     803038 <devfile_read+0x154>
+    size_t i = 0;
+  802f6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802f6f:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802f76:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802f7a:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802f7e:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802f82:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802f86:	48 29 da             	sub    %rbx,%rdx
+  802f89:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802f8e:	48 39 c2             	cmp    %rax,%rdx
+  802f91:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802f95:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802f99:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802f9d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802fa0:	01 d8                	add    %ebx,%eax
+  802fa2:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802fa6:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802faa:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802fb1:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802fb8:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802fbf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fca:	4c 89 ee             	mov    %r13,%rsi
+  802fcd:	bf 03 00 00 00       	mov    $0x3,%edi
+  802fd2:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  802fd9:	00 00 00 
+  802fdc:	ff d0                	call   *%rax
+        if (res < 0)
+  802fde:	85 c0                	test   %eax,%eax
+  802fe0:	78 4d                	js     80302f <devfile_read+0x14b>
+        if (res == 0)
+  802fe2:	74 4f                	je     803033 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802fe4:	4c 63 e0             	movslq %eax,%r12
+  802fe7:	4c 89 e2             	mov    %r12,%rdx
+  802fea:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802fee:	4c 89 f7             	mov    %r14,%rdi
+  802ff1:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  802ff8:	00 00 00 
+  802ffb:	ff d0                	call   *%rax
+        i += res;
+  802ffd:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803000:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803003:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803007:	48 39 c3             	cmp    %rax,%rbx
+  80300a:	0f 82 72 ff ff ff    	jb     802f82 <devfile_read+0x9e>
+    return i;
+  803010:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803013:	48 85 c0             	test   %rax,%rax
+  803016:	7e 04                	jle    80301c <devfile_read+0x138>
+  803018:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  80301c:	48 83 c4 28          	add    $0x28,%rsp
+  803020:	5b                   	pop    %rbx
+  803021:	41 5c                	pop    %r12
+  803023:	41 5d                	pop    %r13
+  803025:	41 5e                	pop    %r14
+  803027:	41 5f                	pop    %r15
+  803029:	5d                   	pop    %rbp
+  80302a:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80302b:	48 98                	cltq
+  80302d:	eb ed                	jmp    80301c <devfile_read+0x138>
+            return res;
+  80302f:	48 98                	cltq
+  803031:	eb e9                	jmp    80301c <devfile_read+0x138>
+            return i;
+  803033:	48 89 d8             	mov    %rbx,%rax
+  803036:	eb db                	jmp    803013 <devfile_read+0x12f>
+    size_t i = 0;
+  803038:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80303c:	eb d2                	jmp    803010 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80303e:	48 89 c6             	mov    %rax,%rsi
+  803041:	4c 89 ff             	mov    %r15,%rdi
+  803044:	48 b8 56 29 80 00 00 	movabs $0x802956,%rax
+  80304b:	00 00 00 
+  80304e:	ff d0                	call   *%rax
+  803050:	85 c0                	test   %eax,%eax
+  803052:	78 40                	js     803094 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803054:	4c 89 ff             	mov    %r15,%rdi
+  803057:	48 b8 5a 1e 80 00 00 	movabs $0x801e5a,%rax
+  80305e:	00 00 00 
+  803061:	ff d0                	call   *%rax
+  803063:	48 89 c2             	mov    %rax,%rdx
+  803066:	48 c1 e2 04          	shl    $0x4,%rdx
+  80306a:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80306e:	48 c1 e0 0c          	shl    $0xc,%rax
+  803072:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803077:	48 01 d0             	add    %rdx,%rax
+  80307a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80307e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803083:	0f 84 33 01 00 00    	je     8031bc <devfile_read+0x2d8>
+    size_t i = 0;
+  803089:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80308f:	e9 f5 00 00 00       	jmp    803189 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803094:	48 98                	cltq
+  803096:	eb 84                	jmp    80301c <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803098:	44 89 e8             	mov    %r13d,%eax
+  80309b:	66 b8 00 00          	mov    $0x0,%ax
+  80309f:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8030a4:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8030ab:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8030ad:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8030b1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8030b5:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8030b7:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8030bc:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8030bf:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8030c6:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8030c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030d2:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8030d7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8030dc:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  8030e3:	00 00 00 
+  8030e6:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8030e8:	85 c0                	test   %eax,%eax
+  8030ea:	0f 88 be 00 00 00    	js     8031ae <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8030f0:	48 63 d0             	movslq %eax,%rdx
+  8030f3:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8030f8:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8030fd:	44 39 e8             	cmp    %r13d,%eax
+  803100:	0f 8e ba 00 00 00    	jle    8031c0 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803106:	49 63 c5             	movslq %r13d,%rax
+  803109:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  80310e:	48 29 c3             	sub    %rax,%rbx
+  803111:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803116:	48 01 c3             	add    %rax,%rbx
+  803119:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80311d:	4c 29 f0             	sub    %r14,%rax
+  803120:	48 39 c3             	cmp    %rax,%rbx
+  803123:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803127:	4c 89 ff             	mov    %r15,%rdi
+  80312a:	48 b9 5a 1e 80 00 00 	movabs $0x801e5a,%rcx
+  803131:	00 00 00 
+  803134:	ff d1                	call   *%rcx
+  803136:	48 89 c2             	mov    %rax,%rdx
+  803139:	48 c1 e2 04          	shl    $0x4,%rdx
+  80313d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803141:	48 c1 e0 0c          	shl    $0xc,%rax
+  803145:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  80314a:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  80314d:	44 89 ea             	mov    %r13d,%edx
+  803150:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803155:	48 63 d2             	movslq %edx,%rdx
+  803158:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80315f:	00 
+  803160:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803164:	4c 01 f7             	add    %r14,%rdi
+  803167:	48 89 da             	mov    %rbx,%rdx
+  80316a:	48 b9 cb 0f 80 00 00 	movabs $0x800fcb,%rcx
+  803171:	00 00 00 
+  803174:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803176:	41 01 dd             	add    %ebx,%r13d
+  803179:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  80317d:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803180:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803184:	49 39 c6             	cmp    %rax,%r14
+  803187:	73 37                	jae    8031c0 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803189:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  80318d:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803192:	44 39 e8             	cmp    %r13d,%eax
+  803195:	0f 8f fd fe ff ff    	jg     803098 <devfile_read+0x1b4>
+  80319b:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8031a0:	44 39 e8             	cmp    %r13d,%eax
+  8031a3:	0f 8f 5d ff ff ff    	jg     803106 <devfile_read+0x222>
+  8031a9:	e9 ea fe ff ff       	jmp    803098 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8031ae:	48 98                	cltq
+  8031b0:	4d 85 f6             	test   %r14,%r14
+  8031b3:	49 0f 45 c6          	cmovne %r14,%rax
+  8031b7:	e9 60 fe ff ff       	jmp    80301c <devfile_read+0x138>
+    size_t i = 0;
+  8031bc:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8031c0:	4c 89 f0             	mov    %r14,%rax
+  8031c3:	e9 54 fe ff ff       	jmp    80301c <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8031c8:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8031cf:	e9 48 fe ff ff       	jmp    80301c <devfile_read+0x138>
+
+00000000008031d4 <open>:
+open(const char *path, int mode) {
+  8031d4:	55                   	push   %rbp
+  8031d5:	48 89 e5             	mov    %rsp,%rbp
+  8031d8:	41 55                	push   %r13
+  8031da:	41 54                	push   %r12
+  8031dc:	53                   	push   %rbx
+  8031dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8031e1:	49 89 fc             	mov    %rdi,%r12
+  8031e4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8031e7:	48 b8 98 0b 80 00 00 	movabs $0x800b98,%rax
+  8031ee:	00 00 00 
+  8031f1:	ff d0                	call   *%rax
+  8031f3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8031f9:	0f 87 8a 00 00 00    	ja     803289 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8031ff:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803203:	48 b8 88 1e 80 00 00 	movabs $0x801e88,%rax
+  80320a:	00 00 00 
+  80320d:	ff d0                	call   *%rax
+  80320f:	89 c3                	mov    %eax,%ebx
+  803211:	85 c0                	test   %eax,%eax
+  803213:	78 50                	js     803265 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803215:	4c 89 e6             	mov    %r12,%rsi
+  803218:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80321f:	00 00 00 
+  803222:	48 89 df             	mov    %rbx,%rdi
+  803225:	48 b8 d6 0b 80 00 00 	movabs $0x800bd6,%rax
+  80322c:	00 00 00 
+  80322f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803231:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803238:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80323c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803241:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  803248:	00 00 00 
+  80324b:	ff d0                	call   *%rax
+  80324d:	89 c3                	mov    %eax,%ebx
+  80324f:	85 c0                	test   %eax,%eax
+  803251:	78 1f                	js     803272 <open+0x9e>
+    return fd2num(fd);
+  803253:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803257:	48 b8 5a 1e 80 00 00 	movabs $0x801e5a,%rax
+  80325e:	00 00 00 
+  803261:	ff d0                	call   *%rax
+  803263:	89 c3                	mov    %eax,%ebx
+}
+  803265:	89 d8                	mov    %ebx,%eax
+  803267:	48 83 c4 18          	add    $0x18,%rsp
+  80326b:	5b                   	pop    %rbx
+  80326c:	41 5c                	pop    %r12
+  80326e:	41 5d                	pop    %r13
+  803270:	5d                   	pop    %rbp
+  803271:	c3                   	ret
+        fd_close(fd, 0);
+  803272:	be 00 00 00 00       	mov    $0x0,%esi
+  803277:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80327b:	48 b8 a3 1f 80 00 00 	movabs $0x801fa3,%rax
+  803282:	00 00 00 
+  803285:	ff d0                	call   *%rax
+        return res;
+  803287:	eb dc                	jmp    803265 <open+0x91>
+        return -E_BAD_PATH;
+  803289:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80328e:	eb d5                	jmp    803265 <open+0x91>
+
+0000000000803290 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803290:	55                   	push   %rbp
+  803291:	48 89 e5             	mov    %rsp,%rbp
+  803294:	41 57                	push   %r15
+  803296:	41 56                	push   %r14
+  803298:	41 55                	push   %r13
+  80329a:	41 54                	push   %r12
+  80329c:	53                   	push   %rbx
+  80329d:	48 83 ec 18          	sub    $0x18,%rsp
+  8032a1:	41 89 f6             	mov    %esi,%r14d
+  8032a4:	49 89 d7             	mov    %rdx,%r15
+  8032a7:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032aa:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8032ae:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  8032b5:	00 00 00 
+  8032b8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032ba:	85 c0                	test   %eax,%eax
+  8032bc:	0f 88 db 00 00 00    	js     80339d <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8032c2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8032c6:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8032cd:	00 00 00 
+  8032d0:	8b 00                	mov    (%rax),%eax
+  8032d2:	39 07                	cmp    %eax,(%rdi)
+  8032d4:	0f 85 db 00 00 00    	jne    8033b5 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8032da:	45 85 f6             	test   %r14d,%r14d
+  8032dd:	0f 88 db 00 00 00    	js     8033be <fmap+0x12e>
+  8032e3:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8032ea:	0f 85 d7 00 00 00    	jne    8033c7 <fmap+0x137>
+  8032f0:	4c 89 fb             	mov    %r15,%rbx
+  8032f3:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8032f9:	0f 85 d1 00 00 00    	jne    8033d0 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8032ff:	48 b8 20 2a 80 00 00 	movabs $0x802a20,%rax
+  803306:	00 00 00 
+  803309:	ff d0                	call   *%rax
+  80330b:	85 c0                	test   %eax,%eax
+  80330d:	0f 88 8e 00 00 00    	js     8033a1 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803313:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80331a:	00 00 00 
+    while (i < n) {
+  80331d:	4d 85 ed             	test   %r13,%r13
+  803320:	0f 84 8a 00 00 00    	je     8033b0 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803326:	4c 89 ea             	mov    %r13,%rdx
+  803329:	48 29 da             	sub    %rbx,%rdx
+  80332c:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803333:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803339:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80333d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803341:	8b 40 0c             	mov    0xc(%rax),%eax
+  803344:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  803348:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  80334c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803351:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803356:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80335a:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80335e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803363:	4c 89 e6             	mov    %r12,%rsi
+  803366:	bf 09 00 00 00       	mov    $0x9,%edi
+  80336b:	48 b8 ae 27 80 00 00 	movabs $0x8027ae,%rax
+  803372:	00 00 00 
+  803375:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803377:	85 c0                	test   %eax,%eax
+  803379:	78 2a                	js     8033a5 <fmap+0x115>
+        i += res;
+  80337b:	48 98                	cltq
+  80337d:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803380:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803384:	72 05                	jb     80338b <fmap+0xfb>
+    while (i < n) {
+  803386:	4c 39 eb             	cmp    %r13,%rbx
+  803389:	72 9b                	jb     803326 <fmap+0x96>
+    }
+    return i;
+  80338b:	48 89 d8             	mov    %rbx,%rax
+}
+  80338e:	48 83 c4 18          	add    $0x18,%rsp
+  803392:	5b                   	pop    %rbx
+  803393:	41 5c                	pop    %r12
+  803395:	41 5d                	pop    %r13
+  803397:	41 5e                	pop    %r14
+  803399:	41 5f                	pop    %r15
+  80339b:	5d                   	pop    %rbp
+  80339c:	c3                   	ret
+    if (res < 0) return res;
+  80339d:	48 98                	cltq
+  80339f:	eb ed                	jmp    80338e <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8033a1:	48 98                	cltq
+  8033a3:	eb e9                	jmp    80338e <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8033a5:	48 98                	cltq
+  8033a7:	48 85 db             	test   %rbx,%rbx
+  8033aa:	48 0f 45 c3          	cmovne %rbx,%rax
+  8033ae:	eb de                	jmp    80338e <fmap+0xfe>
+    size_t i = 0;
+  8033b0:	4c 89 eb             	mov    %r13,%rbx
+  8033b3:	eb d6                	jmp    80338b <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8033b5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8033bc:	eb d0                	jmp    80338e <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8033be:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033c5:	eb c7                	jmp    80338e <fmap+0xfe>
+  8033c7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033ce:	eb be                	jmp    80338e <fmap+0xfe>
+  8033d0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033d7:	eb b5                	jmp    80338e <fmap+0xfe>
+
+00000000008033d9 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8033d9:	55                   	push   %rbp
+  8033da:	48 89 e5             	mov    %rsp,%rbp
+  8033dd:	41 56                	push   %r14
+  8033df:	41 55                	push   %r13
+  8033e1:	41 54                	push   %r12
+  8033e3:	53                   	push   %rbx
+  8033e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8033e8:	89 fb                	mov    %edi,%ebx
+  8033ea:	41 89 f4             	mov    %esi,%r12d
+  8033ed:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8033f0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033f4:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  8033fb:	00 00 00 
+  8033fe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803400:	85 c0                	test   %eax,%eax
+  803402:	78 63                	js     803467 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803404:	45 85 e4             	test   %r12d,%r12d
+  803407:	0f 88 80 00 00 00    	js     80348d <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80340d:	45 89 e6             	mov    %r12d,%r14d
+  803410:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803417:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80341b:	48 b8 6c 1e 80 00 00 	movabs $0x801e6c,%rax
+  803422:	00 00 00 
+  803425:	ff d0                	call   *%rax
+  803427:	48 89 c2             	mov    %rax,%rdx
+  80342a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80342f:	44 89 f6             	mov    %r14d,%esi
+  803432:	89 df                	mov    %ebx,%edi
+  803434:	48 b8 90 32 80 00 00 	movabs $0x803290,%rax
+  80343b:	00 00 00 
+  80343e:	ff d0                	call   *%rax
+  803440:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803443:	45 29 f4             	sub    %r14d,%r12d
+  803446:	4d 63 f4             	movslq %r12d,%r14
+  803449:	49 39 c6             	cmp    %rax,%r14
+  80344c:	7c 1d                	jl     80346b <read_map+0x92>
+  80344e:	48 85 c0             	test   %rax,%rax
+  803451:	b8 00 00 00 00       	mov    $0x0,%eax
+  803456:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80345a:	48 83 c4 10          	add    $0x10,%rsp
+  80345e:	5b                   	pop    %rbx
+  80345f:	41 5c                	pop    %r12
+  803461:	41 5d                	pop    %r13
+  803463:	41 5e                	pop    %r14
+  803465:	5d                   	pop    %rbp
+  803466:	c3                   	ret
+    if (res < 0) return res;
+  803467:	48 98                	cltq
+  803469:	eb ef                	jmp    80345a <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  80346b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80346f:	48 b8 6c 1e 80 00 00 	movabs $0x801e6c,%rax
+  803476:	00 00 00 
+  803479:	ff d0                	call   *%rax
+  80347b:	4d 63 e4             	movslq %r12d,%r12
+  80347e:	4c 01 e0             	add    %r12,%rax
+  803481:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803485:	48 89 d8             	mov    %rbx,%rax
+  803488:	4c 29 f0             	sub    %r14,%rax
+  80348b:	eb cd                	jmp    80345a <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  80348d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803494:	eb c4                	jmp    80345a <read_map+0x81>
+
+0000000000803496 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803496:	55                   	push   %rbp
+  803497:	48 89 e5             	mov    %rsp,%rbp
+  80349a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80349e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034a2:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  8034a9:	00 00 00 
+  8034ac:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034ae:	85 c0                	test   %eax,%eax
+  8034b0:	78 4a                	js     8034fc <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8034b2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034b6:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8034bd:	00 00 00 
+  8034c0:	8b 00                	mov    (%rax),%eax
+  8034c2:	39 07                	cmp    %eax,(%rdi)
+  8034c4:	75 38                	jne    8034fe <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8034c6:	48 b8 20 2a 80 00 00 	movabs $0x802a20,%rax
+  8034cd:	00 00 00 
+  8034d0:	ff d0                	call   *%rax
+  8034d2:	85 c0                	test   %eax,%eax
+  8034d4:	78 26                	js     8034fc <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8034d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034da:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034dd:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8034e4:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8034e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8034eb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8034f0:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  8034f7:	00 00 00 
+  8034fa:	ff d0                	call   *%rax
+}
+  8034fc:	c9                   	leave
+  8034fd:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8034fe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803503:	eb f7                	jmp    8034fc <fsync+0x66>
+
+0000000000803505 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803505:	55                   	push   %rbp
+  803506:	48 89 e5             	mov    %rsp,%rbp
+  803509:	41 57                	push   %r15
+  80350b:	41 56                	push   %r14
+  80350d:	41 55                	push   %r13
+  80350f:	41 54                	push   %r12
+  803511:	53                   	push   %rbx
+  803512:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803516:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  80351d:	00 00 00 
+  803520:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803525:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80352b:	49 bd e8 1e 80 00 00 	movabs $0x801ee8,%r13
+  803532:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803535:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  80353c:	00 00 00 
+  80353f:	eb 0c                	jmp    80354d <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803541:	83 c3 01             	add    $0x1,%ebx
+  803544:	49 83 c4 28          	add    $0x28,%r12
+  803548:	83 fb 20             	cmp    $0x20,%ebx
+  80354b:	74 33                	je     803580 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80354d:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803552:	74 ed                	je     803541 <flushall+0x3c>
+  803554:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803558:	89 df                	mov    %ebx,%edi
+  80355a:	41 ff d5             	call   *%r13
+  80355d:	85 c0                	test   %eax,%eax
+  80355f:	78 e0                	js     803541 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803561:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803565:	41 8b 06             	mov    (%r14),%eax
+  803568:	39 07                	cmp    %eax,(%rdi)
+  80356a:	75 d5                	jne    803541 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  80356c:	48 b8 20 2a 80 00 00 	movabs $0x802a20,%rax
+  803573:	00 00 00 
+  803576:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803578:	85 c0                	test   %eax,%eax
+  80357a:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80357e:	eb c1                	jmp    803541 <flushall+0x3c>
+    }
+    return res;
+}
+  803580:	44 89 f8             	mov    %r15d,%eax
+  803583:	48 83 c4 18          	add    $0x18,%rsp
+  803587:	5b                   	pop    %rbx
+  803588:	41 5c                	pop    %r12
+  80358a:	41 5d                	pop    %r13
+  80358c:	41 5e                	pop    %r14
+  80358e:	41 5f                	pop    %r15
+  803590:	5d                   	pop    %rbp
+  803591:	c3                   	ret
+
+0000000000803592 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803592:	55                   	push   %rbp
+  803593:	48 89 e5             	mov    %rsp,%rbp
+  803596:	53                   	push   %rbx
+  803597:	48 83 ec 08          	sub    $0x8,%rsp
+  80359b:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80359e:	40 0f b6 c6          	movzbl %sil,%eax
+  8035a2:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8035a9:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8035ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8035b0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8035b5:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  8035bc:	00 00 00 
+  8035bf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035c1:	85 c0                	test   %eax,%eax
+  8035c3:	78 23                	js     8035e8 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8035c5:	ba 58 06 00 00       	mov    $0x658,%edx
+  8035ca:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8035d1:	00 00 00 
+  8035d4:	48 89 df             	mov    %rbx,%rdi
+  8035d7:	48 b8 cb 0f 80 00 00 	movabs $0x800fcb,%rax
+  8035de:	00 00 00 
+  8035e1:	ff d0                	call   *%rax
+    return 0;
+  8035e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035ec:	c9                   	leave
+  8035ed:	c3                   	ret
+
+00000000008035ee <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8035ee:	55                   	push   %rbp
+  8035ef:	48 89 e5             	mov    %rsp,%rbp
+  8035f2:	53                   	push   %rbx
+  8035f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8035f7:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8035fa:	48 b8 98 0b 80 00 00 	movabs $0x800b98,%rax
+  803601:	00 00 00 
+  803604:	ff d0                	call   *%rax
+  803606:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80360c:	77 35                	ja     803643 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80360e:	48 89 de             	mov    %rbx,%rsi
+  803611:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803618:	00 00 00 
+  80361b:	48 b8 d6 0b 80 00 00 	movabs $0x800bd6,%rax
+  803622:	00 00 00 
+  803625:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803627:	be 00 00 00 00       	mov    $0x0,%esi
+  80362c:	bf 07 00 00 00       	mov    $0x7,%edi
+  803631:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  803638:	00 00 00 
+  80363b:	ff d0                	call   *%rax
+}
+  80363d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803641:	c9                   	leave
+  803642:	c3                   	ret
+        return -E_BAD_PATH;
+  803643:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803648:	eb f3                	jmp    80363d <remove+0x4f>
+
+000000000080364a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80364a:	55                   	push   %rbp
+  80364b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  80364e:	48 b8 05 35 80 00 00 	movabs $0x803505,%rax
+  803655:	00 00 00 
+  803658:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80365a:	be 00 00 00 00       	mov    $0x0,%esi
+  80365f:	bf 08 00 00 00       	mov    $0x8,%edi
+  803664:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  80366b:	00 00 00 
+  80366e:	ff d0                	call   *%rax
+}
+  803670:	5d                   	pop    %rbp
+  803671:	c3                   	ret
+
+0000000000803672 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803672:	55                   	push   %rbp
+  803673:	48 89 e5             	mov    %rsp,%rbp
+  803676:	41 54                	push   %r12
+  803678:	53                   	push   %rbx
+  803679:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80367c:	48 b8 6c 1e 80 00 00 	movabs $0x801e6c,%rax
+  803683:	00 00 00 
+  803686:	ff d0                	call   *%rax
+  803688:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80368b:	48 be 40 57 80 00 00 	movabs $0x805740,%rsi
+  803692:	00 00 00 
+  803695:	48 89 df             	mov    %rbx,%rdi
+  803698:	48 b8 d6 0b 80 00 00 	movabs $0x800bd6,%rax
+  80369f:	00 00 00 
+  8036a2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8036a4:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8036a9:	41 2b 04 24          	sub    (%r12),%eax
+  8036ad:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8036b3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8036ba:	00 00 00 
+    stat->st_dev = &devpipe;
+  8036bd:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8036c4:	00 00 00 
+  8036c7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8036ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d3:	5b                   	pop    %rbx
+  8036d4:	41 5c                	pop    %r12
+  8036d6:	5d                   	pop    %rbp
+  8036d7:	c3                   	ret
+
+00000000008036d8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8036d8:	55                   	push   %rbp
+  8036d9:	48 89 e5             	mov    %rsp,%rbp
+  8036dc:	41 54                	push   %r12
+  8036de:	53                   	push   %rbx
+  8036df:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8036e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036e7:	48 89 fe             	mov    %rdi,%rsi
+  8036ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ef:	49 bc 15 15 80 00 00 	movabs $0x801515,%r12
+  8036f6:	00 00 00 
+  8036f9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8036fc:	48 89 df             	mov    %rbx,%rdi
+  8036ff:	48 b8 6c 1e 80 00 00 	movabs $0x801e6c,%rax
+  803706:	00 00 00 
+  803709:	ff d0                	call   *%rax
+  80370b:	48 89 c6             	mov    %rax,%rsi
+  80370e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803713:	bf 00 00 00 00       	mov    $0x0,%edi
+  803718:	41 ff d4             	call   *%r12
+}
+  80371b:	5b                   	pop    %rbx
+  80371c:	41 5c                	pop    %r12
+  80371e:	5d                   	pop    %rbp
+  80371f:	c3                   	ret
+
+0000000000803720 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803720:	55                   	push   %rbp
+  803721:	48 89 e5             	mov    %rsp,%rbp
+  803724:	41 57                	push   %r15
+  803726:	41 56                	push   %r14
+  803728:	41 55                	push   %r13
+  80372a:	41 54                	push   %r12
+  80372c:	53                   	push   %rbx
+  80372d:	48 83 ec 18          	sub    $0x18,%rsp
+  803731:	49 89 fc             	mov    %rdi,%r12
+  803734:	49 89 f5             	mov    %rsi,%r13
+  803737:	49 89 d7             	mov    %rdx,%r15
+  80373a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80373e:	48 b8 6c 1e 80 00 00 	movabs $0x801e6c,%rax
+  803745:	00 00 00 
+  803748:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80374a:	4d 85 ff             	test   %r15,%r15
+  80374d:	0f 84 af 00 00 00    	je     803802 <devpipe_write+0xe2>
+  803753:	48 89 c3             	mov    %rax,%rbx
+  803756:	4c 89 f8             	mov    %r15,%rax
+  803759:	4d 89 ef             	mov    %r13,%r15
+  80375c:	4c 01 e8             	add    %r13,%rax
+  80375f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803763:	49 bd 0a 13 80 00 00 	movabs $0x80130a,%r13
+  80376a:	00 00 00 
+            sys_yield();
+  80376d:	49 be a7 12 80 00 00 	movabs $0x8012a7,%r14
+  803774:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803777:	8b 73 04             	mov    0x4(%rbx),%esi
+  80377a:	48 63 ce             	movslq %esi,%rcx
+  80377d:	48 63 03             	movslq (%rbx),%rax
+  803780:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803786:	48 39 c1             	cmp    %rax,%rcx
+  803789:	72 2e                	jb     8037b9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80378b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803790:	48 89 da             	mov    %rbx,%rdx
+  803793:	be 00 10 00 00       	mov    $0x1000,%esi
+  803798:	4c 89 e7             	mov    %r12,%rdi
+  80379b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80379e:	85 c0                	test   %eax,%eax
+  8037a0:	74 66                	je     803808 <devpipe_write+0xe8>
+            sys_yield();
+  8037a2:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8037a5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8037a8:	48 63 ce             	movslq %esi,%rcx
+  8037ab:	48 63 03             	movslq (%rbx),%rax
+  8037ae:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8037b4:	48 39 c1             	cmp    %rax,%rcx
+  8037b7:	73 d2                	jae    80378b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8037b9:	41 0f b6 3f          	movzbl (%r15),%edi
+  8037bd:	48 89 ca             	mov    %rcx,%rdx
+  8037c0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8037c4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8037cb:	08 10 20 
+  8037ce:	48 f7 e2             	mul    %rdx
+  8037d1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8037d5:	48 89 d0             	mov    %rdx,%rax
+  8037d8:	48 c1 e0 09          	shl    $0x9,%rax
+  8037dc:	48 29 d0             	sub    %rdx,%rax
+  8037df:	48 c1 e0 03          	shl    $0x3,%rax
+  8037e3:	48 29 c1             	sub    %rax,%rcx
+  8037e6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8037eb:	83 c6 01             	add    $0x1,%esi
+  8037ee:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8037f1:	49 83 c7 01          	add    $0x1,%r15
+  8037f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037f9:	49 39 c7             	cmp    %rax,%r15
+  8037fc:	0f 85 75 ff ff ff    	jne    803777 <devpipe_write+0x57>
+    return n;
+  803802:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803806:	eb 05                	jmp    80380d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803808:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80380d:	48 83 c4 18          	add    $0x18,%rsp
+  803811:	5b                   	pop    %rbx
+  803812:	41 5c                	pop    %r12
+  803814:	41 5d                	pop    %r13
+  803816:	41 5e                	pop    %r14
+  803818:	41 5f                	pop    %r15
+  80381a:	5d                   	pop    %rbp
+  80381b:	c3                   	ret
+
+000000000080381c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80381c:	55                   	push   %rbp
+  80381d:	48 89 e5             	mov    %rsp,%rbp
+  803820:	41 57                	push   %r15
+  803822:	41 56                	push   %r14
+  803824:	41 55                	push   %r13
+  803826:	41 54                	push   %r12
+  803828:	53                   	push   %rbx
+  803829:	48 83 ec 18          	sub    $0x18,%rsp
+  80382d:	49 89 fc             	mov    %rdi,%r12
+  803830:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803834:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803838:	48 b8 6c 1e 80 00 00 	movabs $0x801e6c,%rax
+  80383f:	00 00 00 
+  803842:	ff d0                	call   *%rax
+  803844:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803847:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80384d:	49 bd 0a 13 80 00 00 	movabs $0x80130a,%r13
+  803854:	00 00 00 
+            sys_yield();
+  803857:	49 be a7 12 80 00 00 	movabs $0x8012a7,%r14
+  80385e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803861:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803866:	74 7d                	je     8038e5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803868:	8b 03                	mov    (%rbx),%eax
+  80386a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80386d:	75 26                	jne    803895 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80386f:	4d 85 ff             	test   %r15,%r15
+  803872:	75 77                	jne    8038eb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803874:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803879:	48 89 da             	mov    %rbx,%rdx
+  80387c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803881:	4c 89 e7             	mov    %r12,%rdi
+  803884:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803887:	85 c0                	test   %eax,%eax
+  803889:	74 72                	je     8038fd <devpipe_read+0xe1>
+            sys_yield();
+  80388b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80388e:	8b 03                	mov    (%rbx),%eax
+  803890:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803893:	74 df                	je     803874 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803895:	48 63 c8             	movslq %eax,%rcx
+  803898:	48 89 ca             	mov    %rcx,%rdx
+  80389b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80389f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8038a6:	08 10 20 
+  8038a9:	48 89 d0             	mov    %rdx,%rax
+  8038ac:	48 f7 e6             	mul    %rsi
+  8038af:	48 c1 ea 06          	shr    $0x6,%rdx
+  8038b3:	48 89 d0             	mov    %rdx,%rax
+  8038b6:	48 c1 e0 09          	shl    $0x9,%rax
+  8038ba:	48 29 d0             	sub    %rdx,%rax
+  8038bd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8038c4:	00 
+  8038c5:	48 89 c8             	mov    %rcx,%rax
+  8038c8:	48 29 d0             	sub    %rdx,%rax
+  8038cb:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8038d0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8038d4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8038d8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8038db:	49 83 c7 01          	add    $0x1,%r15
+  8038df:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8038e3:	75 83                	jne    803868 <devpipe_read+0x4c>
+    return n;
+  8038e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038e9:	eb 03                	jmp    8038ee <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8038eb:	4c 89 f8             	mov    %r15,%rax
+}
+  8038ee:	48 83 c4 18          	add    $0x18,%rsp
+  8038f2:	5b                   	pop    %rbx
+  8038f3:	41 5c                	pop    %r12
+  8038f5:	41 5d                	pop    %r13
+  8038f7:	41 5e                	pop    %r14
+  8038f9:	41 5f                	pop    %r15
+  8038fb:	5d                   	pop    %rbp
+  8038fc:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8038fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803902:	eb ea                	jmp    8038ee <devpipe_read+0xd2>
+
+0000000000803904 <pipe>:
+pipe(int pfd[2]) {
+  803904:	55                   	push   %rbp
+  803905:	48 89 e5             	mov    %rsp,%rbp
+  803908:	41 55                	push   %r13
+  80390a:	41 54                	push   %r12
+  80390c:	53                   	push   %rbx
+  80390d:	48 83 ec 18          	sub    $0x18,%rsp
+  803911:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803914:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803918:	48 b8 88 1e 80 00 00 	movabs $0x801e88,%rax
+  80391f:	00 00 00 
+  803922:	ff d0                	call   *%rax
+  803924:	89 c3                	mov    %eax,%ebx
+  803926:	85 c0                	test   %eax,%eax
+  803928:	0f 88 a0 01 00 00    	js     803ace <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80392e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803933:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803938:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80393c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803941:	48 b8 36 13 80 00 00 	movabs $0x801336,%rax
+  803948:	00 00 00 
+  80394b:	ff d0                	call   *%rax
+  80394d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80394f:	85 c0                	test   %eax,%eax
+  803951:	0f 88 77 01 00 00    	js     803ace <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803957:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80395b:	48 b8 88 1e 80 00 00 	movabs $0x801e88,%rax
+  803962:	00 00 00 
+  803965:	ff d0                	call   *%rax
+  803967:	89 c3                	mov    %eax,%ebx
+  803969:	85 c0                	test   %eax,%eax
+  80396b:	0f 88 43 01 00 00    	js     803ab4 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803971:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803976:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80397b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80397f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803984:	48 b8 36 13 80 00 00 	movabs $0x801336,%rax
+  80398b:	00 00 00 
+  80398e:	ff d0                	call   *%rax
+  803990:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803992:	85 c0                	test   %eax,%eax
+  803994:	0f 88 1a 01 00 00    	js     803ab4 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80399a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80399e:	48 b8 6c 1e 80 00 00 	movabs $0x801e6c,%rax
+  8039a5:	00 00 00 
+  8039a8:	ff d0                	call   *%rax
+  8039aa:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8039ad:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039b7:	48 89 c6             	mov    %rax,%rsi
+  8039ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039bf:	48 b8 36 13 80 00 00 	movabs $0x801336,%rax
+  8039c6:	00 00 00 
+  8039c9:	ff d0                	call   *%rax
+  8039cb:	89 c3                	mov    %eax,%ebx
+  8039cd:	85 c0                	test   %eax,%eax
+  8039cf:	0f 88 c5 00 00 00    	js     803a9a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8039d5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8039d9:	48 b8 6c 1e 80 00 00 	movabs $0x801e6c,%rax
+  8039e0:	00 00 00 
+  8039e3:	ff d0                	call   *%rax
+  8039e5:	48 89 c1             	mov    %rax,%rcx
+  8039e8:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8039ee:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8039f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039f9:	4c 89 ee             	mov    %r13,%rsi
+  8039fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a01:	48 b8 9d 13 80 00 00 	movabs $0x80139d,%rax
+  803a08:	00 00 00 
+  803a0b:	ff d0                	call   *%rax
+  803a0d:	89 c3                	mov    %eax,%ebx
+  803a0f:	85 c0                	test   %eax,%eax
+  803a11:	78 6e                	js     803a81 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a13:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a18:	4c 89 ef             	mov    %r13,%rdi
+  803a1b:	48 b8 d8 12 80 00 00 	movabs $0x8012d8,%rax
+  803a22:	00 00 00 
+  803a25:	ff d0                	call   *%rax
+  803a27:	83 f8 02             	cmp    $0x2,%eax
+  803a2a:	0f 85 ab 00 00 00    	jne    803adb <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a30:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803a37:	00 00 
+  803a39:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a3d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a3f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a43:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a4a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a4e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803a50:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a54:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803a5b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a5f:	48 bb 5a 1e 80 00 00 	movabs $0x801e5a,%rbx
+  803a66:	00 00 00 
+  803a69:	ff d3                	call   *%rbx
+  803a6b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803a6f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a73:	ff d3                	call   *%rbx
+  803a75:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803a7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a7f:	eb 4d                	jmp    803ace <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803a81:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a86:	4c 89 ee             	mov    %r13,%rsi
+  803a89:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a8e:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803a95:	00 00 00 
+  803a98:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803a9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a9f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803aa3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aa8:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803aaf:	00 00 00 
+  803ab2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803ab4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ab9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803abd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ac2:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803ac9:	00 00 00 
+  803acc:	ff d0                	call   *%rax
+}
+  803ace:	89 d8                	mov    %ebx,%eax
+  803ad0:	48 83 c4 18          	add    $0x18,%rsp
+  803ad4:	5b                   	pop    %rbx
+  803ad5:	41 5c                	pop    %r12
+  803ad7:	41 5d                	pop    %r13
+  803ad9:	5d                   	pop    %rbp
+  803ada:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803adb:	48 b9 70 57 80 00 00 	movabs $0x805770,%rcx
+  803ae2:	00 00 00 
+  803ae5:	48 ba 47 57 80 00 00 	movabs $0x805747,%rdx
+  803aec:	00 00 00 
+  803aef:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803af4:	48 bf 5c 57 80 00 00 	movabs $0x80575c,%rdi
+  803afb:	00 00 00 
+  803afe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b03:	49 b8 e3 40 80 00 00 	movabs $0x8040e3,%r8
+  803b0a:	00 00 00 
+  803b0d:	41 ff d0             	call   *%r8
+
+0000000000803b10 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b10:	55                   	push   %rbp
+  803b11:	48 89 e5             	mov    %rsp,%rbp
+  803b14:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b18:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b1c:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  803b23:	00 00 00 
+  803b26:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b28:	85 c0                	test   %eax,%eax
+  803b2a:	78 35                	js     803b61 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b2c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b30:	48 b8 6c 1e 80 00 00 	movabs $0x801e6c,%rax
+  803b37:	00 00 00 
+  803b3a:	ff d0                	call   *%rax
+  803b3c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b3f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b44:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b49:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b4d:	48 b8 0a 13 80 00 00 	movabs $0x80130a,%rax
+  803b54:	00 00 00 
+  803b57:	ff d0                	call   *%rax
+  803b59:	85 c0                	test   %eax,%eax
+  803b5b:	0f 94 c0             	sete   %al
+  803b5e:	0f b6 c0             	movzbl %al,%eax
+}
+  803b61:	c9                   	leave
+  803b62:	c3                   	ret
+
+0000000000803b63 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803b63:	48 89 f8             	mov    %rdi,%rax
+  803b66:	48 c1 e8 27          	shr    $0x27,%rax
+  803b6a:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803b71:	7f 00 00 
+  803b74:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b78:	f6 c2 01             	test   $0x1,%dl
+  803b7b:	74 6d                	je     803bea <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803b7d:	48 89 f8             	mov    %rdi,%rax
+  803b80:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b84:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803b8b:	7f 00 00 
+  803b8e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b92:	f6 c2 01             	test   $0x1,%dl
+  803b95:	74 62                	je     803bf9 <get_uvpt_entry+0x96>
+  803b97:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803b9e:	7f 00 00 
+  803ba1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ba5:	f6 c2 80             	test   $0x80,%dl
+  803ba8:	75 4f                	jne    803bf9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803baa:	48 89 f8             	mov    %rdi,%rax
+  803bad:	48 c1 e8 15          	shr    $0x15,%rax
+  803bb1:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803bb8:	7f 00 00 
+  803bbb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bbf:	f6 c2 01             	test   $0x1,%dl
+  803bc2:	74 44                	je     803c08 <get_uvpt_entry+0xa5>
+  803bc4:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803bcb:	7f 00 00 
+  803bce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bd2:	f6 c2 80             	test   $0x80,%dl
+  803bd5:	75 31                	jne    803c08 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803bd7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803bdb:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803be2:	7f 00 00 
+  803be5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803be9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803bea:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803bf1:	7f 00 00 
+  803bf4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803bf8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803bf9:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c00:	7f 00 00 
+  803c03:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c07:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c08:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803c0f:	7f 00 00 
+  803c12:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c16:	c3                   	ret
+
+0000000000803c17 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803c17:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803c1a:	48 89 f9             	mov    %rdi,%rcx
+  803c1d:	48 c1 e9 27          	shr    $0x27,%rcx
+  803c21:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803c28:	7f 00 00 
+  803c2b:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803c2f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803c36:	f6 c1 01             	test   $0x1,%cl
+  803c39:	0f 84 b2 00 00 00    	je     803cf1 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803c3f:	48 89 f9             	mov    %rdi,%rcx
+  803c42:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803c46:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803c4d:	7f 00 00 
+  803c50:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803c54:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803c5b:	40 f6 c6 01          	test   $0x1,%sil
+  803c5f:	0f 84 8c 00 00 00    	je     803cf1 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803c65:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803c6c:	7f 00 00 
+  803c6f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c73:	a8 80                	test   $0x80,%al
+  803c75:	75 7b                	jne    803cf2 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803c77:	48 89 f9             	mov    %rdi,%rcx
+  803c7a:	48 c1 e9 15          	shr    $0x15,%rcx
+  803c7e:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803c85:	7f 00 00 
+  803c88:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803c8c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803c93:	40 f6 c6 01          	test   $0x1,%sil
+  803c97:	74 58                	je     803cf1 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803c99:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ca0:	7f 00 00 
+  803ca3:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ca7:	a8 80                	test   $0x80,%al
+  803ca9:	75 6c                	jne    803d17 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803cab:	48 89 f9             	mov    %rdi,%rcx
+  803cae:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803cb2:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803cb9:	7f 00 00 
+  803cbc:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803cc0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803cc7:	40 f6 c6 01          	test   $0x1,%sil
+  803ccb:	74 24                	je     803cf1 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803ccd:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803cd4:	7f 00 00 
+  803cd7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803cdb:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803ce2:	ff ff 7f 
+  803ce5:	48 21 c8             	and    %rcx,%rax
+  803ce8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803cee:	48 09 d0             	or     %rdx,%rax
+}
+  803cf1:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803cf2:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803cf9:	7f 00 00 
+  803cfc:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d00:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d07:	ff ff 7f 
+  803d0a:	48 21 c8             	and    %rcx,%rax
+  803d0d:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803d13:	48 01 d0             	add    %rdx,%rax
+  803d16:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803d17:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803d1e:	7f 00 00 
+  803d21:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d25:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d2c:	ff ff 7f 
+  803d2f:	48 21 c8             	and    %rcx,%rax
+  803d32:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803d38:	48 01 d0             	add    %rdx,%rax
+  803d3b:	c3                   	ret
+
+0000000000803d3c <get_prot>:
+
+int
+get_prot(void *va) {
+  803d3c:	55                   	push   %rbp
+  803d3d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803d40:	48 b8 63 3b 80 00 00 	movabs $0x803b63,%rax
+  803d47:	00 00 00 
+  803d4a:	ff d0                	call   *%rax
+  803d4c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803d4f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803d54:	89 c1                	mov    %eax,%ecx
+  803d56:	83 c9 04             	or     $0x4,%ecx
+  803d59:	f6 c2 01             	test   $0x1,%dl
+  803d5c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803d5f:	89 c1                	mov    %eax,%ecx
+  803d61:	83 c9 02             	or     $0x2,%ecx
+  803d64:	f6 c2 02             	test   $0x2,%dl
+  803d67:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803d6a:	89 c1                	mov    %eax,%ecx
+  803d6c:	83 c9 01             	or     $0x1,%ecx
+  803d6f:	48 85 d2             	test   %rdx,%rdx
+  803d72:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803d75:	89 c1                	mov    %eax,%ecx
+  803d77:	83 c9 40             	or     $0x40,%ecx
+  803d7a:	f6 c6 04             	test   $0x4,%dh
+  803d7d:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803d80:	5d                   	pop    %rbp
+  803d81:	c3                   	ret
+
+0000000000803d82 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803d82:	55                   	push   %rbp
+  803d83:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803d86:	48 b8 63 3b 80 00 00 	movabs $0x803b63,%rax
+  803d8d:	00 00 00 
+  803d90:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803d92:	48 c1 e8 06          	shr    $0x6,%rax
+  803d96:	83 e0 01             	and    $0x1,%eax
+}
+  803d99:	5d                   	pop    %rbp
+  803d9a:	c3                   	ret
+
+0000000000803d9b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803d9b:	55                   	push   %rbp
+  803d9c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803d9f:	48 b8 63 3b 80 00 00 	movabs $0x803b63,%rax
+  803da6:	00 00 00 
+  803da9:	ff d0                	call   *%rax
+  803dab:	83 e0 01             	and    $0x1,%eax
+}
+  803dae:	5d                   	pop    %rbp
+  803daf:	c3                   	ret
+
+0000000000803db0 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803db0:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803db7:	7f 00 00 
+  803dba:	a8 01                	test   $0x1,%al
+  803dbc:	75 06                	jne    803dc4 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc3:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803dc4:	55                   	push   %rbp
+  803dc5:	48 89 e5             	mov    %rsp,%rbp
+  803dc8:	41 57                	push   %r15
+  803dca:	41 56                	push   %r14
+  803dcc:	41 55                	push   %r13
+  803dce:	41 54                	push   %r12
+  803dd0:	53                   	push   %rbx
+  803dd1:	48 83 ec 18          	sub    $0x18,%rsp
+  803dd5:	49 89 fe             	mov    %rdi,%r14
+  803dd8:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803ddb:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803de2:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803de3:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803dea:	7f 00 00 
+  803ded:	e9 81 00 00 00       	jmp    803e73 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803df2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803df9:	49 39 dd             	cmp    %rbx,%r13
+  803dfc:	74 2b                	je     803e29 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803dfe:	48 89 d8             	mov    %rbx,%rax
+  803e01:	48 c1 e8 0c          	shr    $0xc,%rax
+  803e05:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803e09:	f6 c2 01             	test   $0x1,%dl
+  803e0c:	74 e4                	je     803df2 <foreach_shared_region+0x42>
+  803e0e:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803e12:	f6 c4 04             	test   $0x4,%ah
+  803e15:	74 db                	je     803df2 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803e17:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803e1e:	4c 89 fa             	mov    %r15,%rdx
+  803e21:	48 89 df             	mov    %rbx,%rdi
+  803e24:	41 ff d6             	call   *%r14
+  803e27:	eb c9                	jmp    803df2 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803e29:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803e30:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803e34:	74 22                	je     803e58 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803e36:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803e3d:	48 89 d8             	mov    %rbx,%rax
+  803e40:	48 c1 e8 15          	shr    $0x15,%rax
+  803e44:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803e4b:	7f 00 00 
+  803e4e:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803e52:	a8 01                	test   $0x1,%al
+  803e54:	74 d3                	je     803e29 <foreach_shared_region+0x79>
+  803e56:	eb a6                	jmp    803dfe <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803e58:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803e5f:	40 
+  803e60:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e64:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e6b:	00 00 00 
+  803e6e:	48 39 c1             	cmp    %rax,%rcx
+  803e71:	74 31                	je     803ea4 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803e73:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e77:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e7b:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803e82:	7f 00 00 
+  803e85:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803e89:	a8 01                	test   $0x1,%al
+  803e8b:	74 cb                	je     803e58 <foreach_shared_region+0xa8>
+  803e8d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e91:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803e98:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803e9e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803ea2:	eb 92                	jmp    803e36 <foreach_shared_region+0x86>
+}
+  803ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea9:	48 83 c4 18          	add    $0x18,%rsp
+  803ead:	5b                   	pop    %rbx
+  803eae:	41 5c                	pop    %r12
+  803eb0:	41 5d                	pop    %r13
+  803eb2:	41 5e                	pop    %r14
+  803eb4:	41 5f                	pop    %r15
+  803eb6:	5d                   	pop    %rbp
+  803eb7:	c3                   	ret
+
+0000000000803eb8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ebd:	c3                   	ret
+
+0000000000803ebe <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803ebe:	55                   	push   %rbp
+  803ebf:	48 89 e5             	mov    %rsp,%rbp
+  803ec2:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803ec5:	48 be 94 57 80 00 00 	movabs $0x805794,%rsi
+  803ecc:	00 00 00 
+  803ecf:	48 b8 d6 0b 80 00 00 	movabs $0x800bd6,%rax
+  803ed6:	00 00 00 
+  803ed9:	ff d0                	call   *%rax
+    return 0;
+}
+  803edb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee0:	5d                   	pop    %rbp
+  803ee1:	c3                   	ret
+
+0000000000803ee2 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803ee2:	55                   	push   %rbp
+  803ee3:	48 89 e5             	mov    %rsp,%rbp
+  803ee6:	41 57                	push   %r15
+  803ee8:	41 56                	push   %r14
+  803eea:	41 55                	push   %r13
+  803eec:	41 54                	push   %r12
+  803eee:	53                   	push   %rbx
+  803eef:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803ef6:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803efd:	48 85 d2             	test   %rdx,%rdx
+  803f00:	74 7a                	je     803f7c <devcons_write+0x9a>
+  803f02:	49 89 d6             	mov    %rdx,%r14
+  803f05:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f0b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803f10:	49 bf 64 0f 80 00 00 	movabs $0x800f64,%r15
+  803f17:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803f1a:	4c 89 f3             	mov    %r14,%rbx
+  803f1d:	48 29 f3             	sub    %rsi,%rbx
+  803f20:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803f25:	48 39 c3             	cmp    %rax,%rbx
+  803f28:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803f2c:	4c 63 eb             	movslq %ebx,%r13
+  803f2f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803f36:	48 01 c6             	add    %rax,%rsi
+  803f39:	4c 89 ea             	mov    %r13,%rdx
+  803f3c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803f43:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803f46:	4c 89 ee             	mov    %r13,%rsi
+  803f49:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803f50:	48 b8 ad 11 80 00 00 	movabs $0x8011ad,%rax
+  803f57:	00 00 00 
+  803f5a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803f5c:	41 01 dc             	add    %ebx,%r12d
+  803f5f:	49 63 f4             	movslq %r12d,%rsi
+  803f62:	4c 39 f6             	cmp    %r14,%rsi
+  803f65:	72 b3                	jb     803f1a <devcons_write+0x38>
+    return res;
+  803f67:	49 63 c4             	movslq %r12d,%rax
+}
+  803f6a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803f71:	5b                   	pop    %rbx
+  803f72:	41 5c                	pop    %r12
+  803f74:	41 5d                	pop    %r13
+  803f76:	41 5e                	pop    %r14
+  803f78:	41 5f                	pop    %r15
+  803f7a:	5d                   	pop    %rbp
+  803f7b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803f7c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f82:	eb e3                	jmp    803f67 <devcons_write+0x85>
+
+0000000000803f84 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f84:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803f87:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f8c:	48 85 c0             	test   %rax,%rax
+  803f8f:	74 55                	je     803fe6 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f91:	55                   	push   %rbp
+  803f92:	48 89 e5             	mov    %rsp,%rbp
+  803f95:	41 55                	push   %r13
+  803f97:	41 54                	push   %r12
+  803f99:	53                   	push   %rbx
+  803f9a:	48 83 ec 08          	sub    $0x8,%rsp
+  803f9e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803fa1:	48 bb da 11 80 00 00 	movabs $0x8011da,%rbx
+  803fa8:	00 00 00 
+  803fab:	49 bc a7 12 80 00 00 	movabs $0x8012a7,%r12
+  803fb2:	00 00 00 
+  803fb5:	eb 03                	jmp    803fba <devcons_read+0x36>
+  803fb7:	41 ff d4             	call   *%r12
+  803fba:	ff d3                	call   *%rbx
+  803fbc:	85 c0                	test   %eax,%eax
+  803fbe:	74 f7                	je     803fb7 <devcons_read+0x33>
+    if (c < 0) return c;
+  803fc0:	48 63 d0             	movslq %eax,%rdx
+  803fc3:	78 13                	js     803fd8 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803fc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fca:	83 f8 04             	cmp    $0x4,%eax
+  803fcd:	74 09                	je     803fd8 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803fcf:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803fd3:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803fd8:	48 89 d0             	mov    %rdx,%rax
+  803fdb:	48 83 c4 08          	add    $0x8,%rsp
+  803fdf:	5b                   	pop    %rbx
+  803fe0:	41 5c                	pop    %r12
+  803fe2:	41 5d                	pop    %r13
+  803fe4:	5d                   	pop    %rbp
+  803fe5:	c3                   	ret
+  803fe6:	48 89 d0             	mov    %rdx,%rax
+  803fe9:	c3                   	ret
+
+0000000000803fea <cputchar>:
+cputchar(int ch) {
+  803fea:	55                   	push   %rbp
+  803feb:	48 89 e5             	mov    %rsp,%rbp
+  803fee:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803ff2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803ff6:	be 01 00 00 00       	mov    $0x1,%esi
+  803ffb:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803fff:	48 b8 ad 11 80 00 00 	movabs $0x8011ad,%rax
+  804006:	00 00 00 
+  804009:	ff d0                	call   *%rax
+}
+  80400b:	c9                   	leave
+  80400c:	c3                   	ret
+
+000000000080400d <getchar>:
+getchar(void) {
+  80400d:	55                   	push   %rbp
+  80400e:	48 89 e5             	mov    %rsp,%rbp
+  804011:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804015:	ba 01 00 00 00       	mov    $0x1,%edx
+  80401a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80401e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804023:	48 b8 cb 21 80 00 00 	movabs $0x8021cb,%rax
+  80402a:	00 00 00 
+  80402d:	ff d0                	call   *%rax
+  80402f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804031:	85 c0                	test   %eax,%eax
+  804033:	78 06                	js     80403b <getchar+0x2e>
+  804035:	74 08                	je     80403f <getchar+0x32>
+  804037:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80403b:	89 d0                	mov    %edx,%eax
+  80403d:	c9                   	leave
+  80403e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80403f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804044:	eb f5                	jmp    80403b <getchar+0x2e>
+
+0000000000804046 <iscons>:
+iscons(int fdnum) {
+  804046:	55                   	push   %rbp
+  804047:	48 89 e5             	mov    %rsp,%rbp
+  80404a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80404e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804052:	48 b8 e8 1e 80 00 00 	movabs $0x801ee8,%rax
+  804059:	00 00 00 
+  80405c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80405e:	85 c0                	test   %eax,%eax
+  804060:	78 18                	js     80407a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804062:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804066:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80406d:	00 00 00 
+  804070:	8b 00                	mov    (%rax),%eax
+  804072:	39 02                	cmp    %eax,(%rdx)
+  804074:	0f 94 c0             	sete   %al
+  804077:	0f b6 c0             	movzbl %al,%eax
+}
+  80407a:	c9                   	leave
+  80407b:	c3                   	ret
+
+000000000080407c <opencons>:
+opencons(void) {
+  80407c:	55                   	push   %rbp
+  80407d:	48 89 e5             	mov    %rsp,%rbp
+  804080:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804084:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804088:	48 b8 88 1e 80 00 00 	movabs $0x801e88,%rax
+  80408f:	00 00 00 
+  804092:	ff d0                	call   *%rax
+  804094:	85 c0                	test   %eax,%eax
+  804096:	78 49                	js     8040e1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804098:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80409d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040a2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8040a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ab:	48 b8 36 13 80 00 00 	movabs $0x801336,%rax
+  8040b2:	00 00 00 
+  8040b5:	ff d0                	call   *%rax
+  8040b7:	85 c0                	test   %eax,%eax
+  8040b9:	78 26                	js     8040e1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8040bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040bf:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8040c6:	00 00 
+  8040c8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8040ca:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040ce:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8040d5:	48 b8 5a 1e 80 00 00 	movabs $0x801e5a,%rax
+  8040dc:	00 00 00 
+  8040df:	ff d0                	call   *%rax
+}
+  8040e1:	c9                   	leave
+  8040e2:	c3                   	ret
+
+00000000008040e3 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8040e3:	55                   	push   %rbp
+  8040e4:	48 89 e5             	mov    %rsp,%rbp
+  8040e7:	41 56                	push   %r14
+  8040e9:	41 55                	push   %r13
+  8040eb:	41 54                	push   %r12
+  8040ed:	53                   	push   %rbx
+  8040ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8040f2:	49 89 fc             	mov    %rdi,%r12
+  8040f5:	41 89 f5             	mov    %esi,%r13d
+  8040f8:	48 89 d3             	mov    %rdx,%rbx
+  8040fb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8040ff:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  804103:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804107:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80410e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804112:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  804116:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80411a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80411e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804125:	00 00 00 
+  804128:	4c 8b 30             	mov    (%rax),%r14
+  80412b:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  804132:	00 00 00 
+  804135:	ff d0                	call   *%rax
+  804137:	89 c6                	mov    %eax,%esi
+  804139:	45 89 e8             	mov    %r13d,%r8d
+  80413c:	4c 89 e1             	mov    %r12,%rcx
+  80413f:	4c 89 f2             	mov    %r14,%rdx
+  804142:	48 bf a0 57 80 00 00 	movabs $0x8057a0,%rdi
+  804149:	00 00 00 
+  80414c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804151:	49 bc 5e 02 80 00 00 	movabs $0x80025e,%r12
+  804158:	00 00 00 
+  80415b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80415e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  804162:	48 89 df             	mov    %rbx,%rdi
+  804165:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  80416c:	00 00 00 
+  80416f:	ff d0                	call   *%rax
+    cprintf("\n");
+  804171:	48 bf 94 50 80 00 00 	movabs $0x805094,%rdi
+  804178:	00 00 00 
+  80417b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804180:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804183:	cc                   	int3
+  804184:	eb fd                	jmp    804183 <_panic+0xa0>
+
+0000000000804186 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804186:	55                   	push   %rbp
+  804187:	48 89 e5             	mov    %rsp,%rbp
+  80418a:	41 55                	push   %r13
+  80418c:	41 54                	push   %r12
+  80418e:	53                   	push   %rbx
+  80418f:	48 83 ec 08          	sub    $0x8,%rsp
+  804193:	49 89 fc             	mov    %rdi,%r12
+  804196:	48 89 f7             	mov    %rsi,%rdi
+  804199:	48 89 d3             	mov    %rdx,%rbx
+  80419c:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80419f:	48 85 f6             	test   %rsi,%rsi
+  8041a2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041a9:	00 00 00 
+  8041ac:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8041b0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041b5:	48 85 d2             	test   %rdx,%rdx
+  8041b8:	74 03                	je     8041bd <ipc_recv+0x37>
+  8041ba:	48 8b 32             	mov    (%rdx),%rsi
+  8041bd:	48 b8 e3 16 80 00 00 	movabs $0x8016e3,%rax
+  8041c4:	00 00 00 
+  8041c7:	ff d0                	call   *%rax
+    if (errno) {
+  8041c9:	85 c0                	test   %eax,%eax
+  8041cb:	74 1c                	je     8041e9 <ipc_recv+0x63>
+        if (from_env_store)
+  8041cd:	4d 85 e4             	test   %r12,%r12
+  8041d0:	74 08                	je     8041da <ipc_recv+0x54>
+            *from_env_store = 0;
+  8041d2:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8041d9:	00 
+
+        if (perm_store)
+  8041da:	4d 85 ed             	test   %r13,%r13
+  8041dd:	74 74                	je     804253 <ipc_recv+0xcd>
+            *perm_store = 0;
+  8041df:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8041e6:	00 
+  8041e7:	eb 6a                	jmp    804253 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8041e9:	4d 85 e4             	test   %r12,%r12
+  8041ec:	74 14                	je     804202 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8041ee:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8041f5:	00 00 00 
+  8041f8:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8041fe:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804202:	48 85 db             	test   %rbx,%rbx
+  804205:	74 23                	je     80422a <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804207:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80420e:	00 00 00 
+  804211:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804217:	ba 00 00 00 00       	mov    $0x0,%edx
+  80421c:	85 c9                	test   %ecx,%ecx
+  80421e:	74 07                	je     804227 <ipc_recv+0xa1>
+  804220:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804227:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80422a:	4d 85 ed             	test   %r13,%r13
+  80422d:	74 14                	je     804243 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80422f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804236:	00 00 00 
+  804239:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80423f:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804243:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80424a:	00 00 00 
+  80424d:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804253:	48 83 c4 08          	add    $0x8,%rsp
+  804257:	5b                   	pop    %rbx
+  804258:	41 5c                	pop    %r12
+  80425a:	41 5d                	pop    %r13
+  80425c:	5d                   	pop    %rbp
+  80425d:	c3                   	ret
+
+000000000080425e <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80425e:	55                   	push   %rbp
+  80425f:	48 89 e5             	mov    %rsp,%rbp
+  804262:	41 55                	push   %r13
+  804264:	41 54                	push   %r12
+  804266:	53                   	push   %rbx
+  804267:	48 83 ec 08          	sub    $0x8,%rsp
+  80426b:	49 89 fc             	mov    %rdi,%r12
+  80426e:	48 89 f7             	mov    %rsi,%rdi
+  804271:	48 89 d3             	mov    %rdx,%rbx
+  804274:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804277:	48 85 f6             	test   %rsi,%rsi
+  80427a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804281:	00 00 00 
+  804284:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804288:	be 00 10 00 00       	mov    $0x1000,%esi
+  80428d:	48 85 d2             	test   %rdx,%rdx
+  804290:	74 03                	je     804295 <ipc_try_recv+0x37>
+  804292:	48 8b 32             	mov    (%rdx),%rsi
+  804295:	48 b8 4c 17 80 00 00 	movabs $0x80174c,%rax
+  80429c:	00 00 00 
+  80429f:	ff d0                	call   *%rax
+    if (errno) {
+  8042a1:	85 c0                	test   %eax,%eax
+  8042a3:	75 75                	jne    80431a <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8042a5:	4d 85 e4             	test   %r12,%r12
+  8042a8:	74 14                	je     8042be <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8042aa:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8042b1:	00 00 00 
+  8042b4:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8042ba:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8042be:	48 85 db             	test   %rbx,%rbx
+  8042c1:	74 23                	je     8042e6 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8042c3:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8042ca:	00 00 00 
+  8042cd:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8042d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042d8:	85 c9                	test   %ecx,%ecx
+  8042da:	74 07                	je     8042e3 <ipc_try_recv+0x85>
+  8042dc:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8042e3:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8042e6:	4d 85 ed             	test   %r13,%r13
+  8042e9:	74 14                	je     8042ff <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8042eb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8042f2:	00 00 00 
+  8042f5:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8042fb:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8042ff:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804306:	00 00 00 
+  804309:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80430f:	48 83 c4 08          	add    $0x8,%rsp
+  804313:	5b                   	pop    %rbx
+  804314:	41 5c                	pop    %r12
+  804316:	41 5d                	pop    %r13
+  804318:	5d                   	pop    %rbp
+  804319:	c3                   	ret
+        if (from_env_store)
+  80431a:	4d 85 e4             	test   %r12,%r12
+  80431d:	74 08                	je     804327 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80431f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804326:	00 
+        if (perm_store)
+  804327:	4d 85 ed             	test   %r13,%r13
+  80432a:	74 e3                	je     80430f <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80432c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804333:	00 
+  804334:	eb d9                	jmp    80430f <ipc_try_recv+0xb1>
+
+0000000000804336 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804336:	55                   	push   %rbp
+  804337:	48 89 e5             	mov    %rsp,%rbp
+  80433a:	41 57                	push   %r15
+  80433c:	41 56                	push   %r14
+  80433e:	41 55                	push   %r13
+  804340:	41 54                	push   %r12
+  804342:	53                   	push   %rbx
+  804343:	48 83 ec 18          	sub    $0x18,%rsp
+  804347:	41 89 fd             	mov    %edi,%r13d
+  80434a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80434d:	48 89 d3             	mov    %rdx,%rbx
+  804350:	49 89 cc             	mov    %rcx,%r12
+  804353:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804357:	48 85 d2             	test   %rdx,%rdx
+  80435a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804361:	00 00 00 
+  804364:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804368:	49 be b7 16 80 00 00 	movabs $0x8016b7,%r14
+  80436f:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804372:	49 bf a7 12 80 00 00 	movabs $0x8012a7,%r15
+  804379:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80437c:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80437f:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804383:	4c 89 e1             	mov    %r12,%rcx
+  804386:	48 89 da             	mov    %rbx,%rdx
+  804389:	44 89 ef             	mov    %r13d,%edi
+  80438c:	41 ff d6             	call   *%r14
+  80438f:	85 c0                	test   %eax,%eax
+  804391:	74 37                	je     8043ca <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804393:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804396:	75 05                	jne    80439d <ipc_send+0x67>
+        sys_yield();
+  804398:	41 ff d7             	call   *%r15
+  80439b:	eb df                	jmp    80437c <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80439d:	89 c1                	mov    %eax,%ecx
+  80439f:	48 ba c3 57 80 00 00 	movabs $0x8057c3,%rdx
+  8043a6:	00 00 00 
+  8043a9:	be 65 00 00 00       	mov    $0x65,%esi
+  8043ae:	48 bf de 57 80 00 00 	movabs $0x8057de,%rdi
+  8043b5:	00 00 00 
+  8043b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043bd:	49 b8 e3 40 80 00 00 	movabs $0x8040e3,%r8
+  8043c4:	00 00 00 
+  8043c7:	41 ff d0             	call   *%r8
+    }
+}
+  8043ca:	48 83 c4 18          	add    $0x18,%rsp
+  8043ce:	5b                   	pop    %rbx
+  8043cf:	41 5c                	pop    %r12
+  8043d1:	41 5d                	pop    %r13
+  8043d3:	41 5e                	pop    %r14
+  8043d5:	41 5f                	pop    %r15
+  8043d7:	5d                   	pop    %rbp
+  8043d8:	c3                   	ret
+
+00000000008043d9 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8043d9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8043de:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8043e5:	00 00 00 
+  8043e8:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8043ef:	48 01 ca             	add    %rcx,%rdx
+  8043f2:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8043f8:	39 fa                	cmp    %edi,%edx
+  8043fa:	74 12                	je     80440e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8043fc:	48 83 c0 01          	add    $0x1,%rax
+  804400:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804406:	75 e0                	jne    8043e8 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804408:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80440d:	c3                   	ret
+            return envs[i].env_id;
+  80440e:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804415:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80441c:	00 00 00 
+  80441f:	48 01 d0             	add    %rdx,%rax
+  804422:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804428:	c3                   	ret
+
+0000000000804429 <__text_end>:
+  804429:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804430:	00 00 00 
+  804433:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443a:	00 00 00 
+  80443d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804444:	00 00 00 
+  804447:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80444e:	00 00 00 
+  804451:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804458:	00 00 00 
+  80445b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804462:	00 00 00 
+  804465:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80446c:	00 00 00 
+  80446f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804476:	00 00 00 
+  804479:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804480:	00 00 00 
+  804483:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448a:	00 00 00 
+  80448d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804494:	00 00 00 
+  804497:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449e:	00 00 00 
+  8044a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a8:	00 00 00 
+  8044ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b2:	00 00 00 
+  8044b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044bc:	00 00 00 
+  8044bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c6:	00 00 00 
+  8044c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d0:	00 00 00 
+  8044d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044da:	00 00 00 
+  8044dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e4:	00 00 00 
+  8044e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ee:	00 00 00 
+  8044f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f8:	00 00 00 
+  8044fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804502:	00 00 00 
+  804505:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80450c:	00 00 00 
+  80450f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804516:	00 00 00 
+  804519:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804520:	00 00 00 
+  804523:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452a:	00 00 00 
+  80452d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804534:	00 00 00 
+  804537:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453e:	00 00 00 
+  804541:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804548:	00 00 00 
+  80454b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804552:	00 00 00 
+  804555:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80455c:	00 00 00 
+  80455f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804566:	00 00 00 
+  804569:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804570:	00 00 00 
+  804573:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457a:	00 00 00 
+  80457d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804584:	00 00 00 
+  804587:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458e:	00 00 00 
+  804591:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804598:	00 00 00 
+  80459b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a2:	00 00 00 
+  8045a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ac:	00 00 00 
+  8045af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b6:	00 00 00 
+  8045b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c0:	00 00 00 
+  8045c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ca:	00 00 00 
+  8045cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d4:	00 00 00 
+  8045d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045de:	00 00 00 
+  8045e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e8:	00 00 00 
+  8045eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f2:	00 00 00 
+  8045f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045fc:	00 00 00 
+  8045ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804606:	00 00 00 
+  804609:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804610:	00 00 00 
+  804613:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461a:	00 00 00 
+  80461d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804624:	00 00 00 
+  804627:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462e:	00 00 00 
+  804631:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804638:	00 00 00 
+  80463b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804642:	00 00 00 
+  804645:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80464c:	00 00 00 
+  80464f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804656:	00 00 00 
+  804659:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804660:	00 00 00 
+  804663:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466a:	00 00 00 
+  80466d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804674:	00 00 00 
+  804677:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467e:	00 00 00 
+  804681:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804688:	00 00 00 
+  80468b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804692:	00 00 00 
+  804695:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80469c:	00 00 00 
+  80469f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a6:	00 00 00 
+  8046a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b0:	00 00 00 
+  8046b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ba:	00 00 00 
+  8046bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c4:	00 00 00 
+  8046c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ce:	00 00 00 
+  8046d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d8:	00 00 00 
+  8046db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e2:	00 00 00 
+  8046e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ec:	00 00 00 
+  8046ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f6:	00 00 00 
+  8046f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804700:	00 00 00 
+  804703:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470a:	00 00 00 
+  80470d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804714:	00 00 00 
+  804717:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471e:	00 00 00 
+  804721:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804728:	00 00 00 
+  80472b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804732:	00 00 00 
+  804735:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473c:	00 00 00 
+  80473f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804746:	00 00 00 
+  804749:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804750:	00 00 00 
+  804753:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475a:	00 00 00 
+  80475d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804764:	00 00 00 
+  804767:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476e:	00 00 00 
+  804771:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804778:	00 00 00 
+  80477b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804782:	00 00 00 
+  804785:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478c:	00 00 00 
+  80478f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804796:	00 00 00 
+  804799:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a0:	00 00 00 
+  8047a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047aa:	00 00 00 
+  8047ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b4:	00 00 00 
+  8047b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047be:	00 00 00 
+  8047c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c8:	00 00 00 
+  8047cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d2:	00 00 00 
+  8047d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dc:	00 00 00 
+  8047df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e6:	00 00 00 
+  8047e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f0:	00 00 00 
+  8047f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fa:	00 00 00 
+  8047fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804804:	00 00 00 
+  804807:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480e:	00 00 00 
+  804811:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804818:	00 00 00 
+  80481b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804822:	00 00 00 
+  804825:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482c:	00 00 00 
+  80482f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804836:	00 00 00 
+  804839:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804840:	00 00 00 
+  804843:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484a:	00 00 00 
+  80484d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804854:	00 00 00 
+  804857:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485e:	00 00 00 
+  804861:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804868:	00 00 00 
+  80486b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804872:	00 00 00 
+  804875:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487c:	00 00 00 
+  80487f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804886:	00 00 00 
+  804889:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804890:	00 00 00 
+  804893:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489a:	00 00 00 
+  80489d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a4:	00 00 00 
+  8048a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ae:	00 00 00 
+  8048b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b8:	00 00 00 
+  8048bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c2:	00 00 00 
+  8048c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cc:	00 00 00 
+  8048cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d6:	00 00 00 
+  8048d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e0:	00 00 00 
+  8048e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ea:	00 00 00 
+  8048ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f4:	00 00 00 
+  8048f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fe:	00 00 00 
+  804901:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804908:	00 00 00 
+  80490b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804912:	00 00 00 
+  804915:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491c:	00 00 00 
+  80491f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804926:	00 00 00 
+  804929:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804930:	00 00 00 
+  804933:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493a:	00 00 00 
+  80493d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804944:	00 00 00 
+  804947:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494e:	00 00 00 
+  804951:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804958:	00 00 00 
+  80495b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804962:	00 00 00 
+  804965:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496c:	00 00 00 
+  80496f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804976:	00 00 00 
+  804979:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804980:	00 00 00 
+  804983:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498a:	00 00 00 
+  80498d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804994:	00 00 00 
+  804997:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499e:	00 00 00 
+  8049a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a8:	00 00 00 
+  8049ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b2:	00 00 00 
+  8049b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bc:	00 00 00 
+  8049bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c6:	00 00 00 
+  8049c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d0:	00 00 00 
+  8049d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049da:	00 00 00 
+  8049dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e4:	00 00 00 
+  8049e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ee:	00 00 00 
+  8049f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f8:	00 00 00 
+  8049fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a02:	00 00 00 
+  804a05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0c:	00 00 00 
+  804a0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a16:	00 00 00 
+  804a19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a20:	00 00 00 
+  804a23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2a:	00 00 00 
+  804a2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a34:	00 00 00 
+  804a37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3e:	00 00 00 
+  804a41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a48:	00 00 00 
+  804a4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a52:	00 00 00 
+  804a55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5c:	00 00 00 
+  804a5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a66:	00 00 00 
+  804a69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a70:	00 00 00 
+  804a73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7a:	00 00 00 
+  804a7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a84:	00 00 00 
+  804a87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8e:	00 00 00 
+  804a91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a98:	00 00 00 
+  804a9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa2:	00 00 00 
+  804aa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aac:	00 00 00 
+  804aaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab6:	00 00 00 
+  804ab9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac0:	00 00 00 
+  804ac3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aca:	00 00 00 
+  804acd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad4:	00 00 00 
+  804ad7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ade:	00 00 00 
+  804ae1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae8:	00 00 00 
+  804aeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af2:	00 00 00 
+  804af5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afc:	00 00 00 
+  804aff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b06:	00 00 00 
+  804b09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b10:	00 00 00 
+  804b13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1a:	00 00 00 
+  804b1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b24:	00 00 00 
+  804b27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2e:	00 00 00 
+  804b31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b38:	00 00 00 
+  804b3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b42:	00 00 00 
+  804b45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4c:	00 00 00 
+  804b4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b56:	00 00 00 
+  804b59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b60:	00 00 00 
+  804b63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6a:	00 00 00 
+  804b6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b74:	00 00 00 
+  804b77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7e:	00 00 00 
+  804b81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b88:	00 00 00 
+  804b8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b92:	00 00 00 
+  804b95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9c:	00 00 00 
+  804b9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba6:	00 00 00 
+  804ba9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb0:	00 00 00 
+  804bb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bba:	00 00 00 
+  804bbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc4:	00 00 00 
+  804bc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bce:	00 00 00 
+  804bd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd8:	00 00 00 
+  804bdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be2:	00 00 00 
+  804be5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bec:	00 00 00 
+  804bef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf6:	00 00 00 
+  804bf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c00:	00 00 00 
+  804c03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0a:	00 00 00 
+  804c0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c14:	00 00 00 
+  804c17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1e:	00 00 00 
+  804c21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c28:	00 00 00 
+  804c2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c32:	00 00 00 
+  804c35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3c:	00 00 00 
+  804c3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c46:	00 00 00 
+  804c49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c50:	00 00 00 
+  804c53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5a:	00 00 00 
+  804c5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c64:	00 00 00 
+  804c67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6e:	00 00 00 
+  804c71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c78:	00 00 00 
+  804c7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c82:	00 00 00 
+  804c85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8c:	00 00 00 
+  804c8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c96:	00 00 00 
+  804c99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca0:	00 00 00 
+  804ca3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caa:	00 00 00 
+  804cad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb4:	00 00 00 
+  804cb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbe:	00 00 00 
+  804cc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc8:	00 00 00 
+  804ccb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd2:	00 00 00 
+  804cd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdc:	00 00 00 
+  804cdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce6:	00 00 00 
+  804ce9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf0:	00 00 00 
+  804cf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfa:	00 00 00 
+  804cfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d04:	00 00 00 
+  804d07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0e:	00 00 00 
+  804d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d18:	00 00 00 
+  804d1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d22:	00 00 00 
+  804d25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2c:	00 00 00 
+  804d2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d36:	00 00 00 
+  804d39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d40:	00 00 00 
+  804d43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4a:	00 00 00 
+  804d4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d54:	00 00 00 
+  804d57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5e:	00 00 00 
+  804d61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d68:	00 00 00 
+  804d6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d72:	00 00 00 
+  804d75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7c:	00 00 00 
+  804d7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d86:	00 00 00 
+  804d89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d90:	00 00 00 
+  804d93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9a:	00 00 00 
+  804d9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da4:	00 00 00 
+  804da7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dae:	00 00 00 
+  804db1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db8:	00 00 00 
+  804dbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc2:	00 00 00 
+  804dc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcc:	00 00 00 
+  804dcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd6:	00 00 00 
+  804dd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de0:	00 00 00 
+  804de3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dea:	00 00 00 
+  804ded:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df4:	00 00 00 
+  804df7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfe:	00 00 00 
+  804e01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e08:	00 00 00 
+  804e0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e12:	00 00 00 
+  804e15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1c:	00 00 00 
+  804e1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e26:	00 00 00 
+  804e29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e30:	00 00 00 
+  804e33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3a:	00 00 00 
+  804e3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e44:	00 00 00 
+  804e47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4e:	00 00 00 
+  804e51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e58:	00 00 00 
+  804e5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e62:	00 00 00 
+  804e65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6c:	00 00 00 
+  804e6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e76:	00 00 00 
+  804e79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e80:	00 00 00 
+  804e83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8a:	00 00 00 
+  804e8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e94:	00 00 00 
+  804e97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9e:	00 00 00 
+  804ea1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea8:	00 00 00 
+  804eab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb2:	00 00 00 
+  804eb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebc:	00 00 00 
+  804ebf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec6:	00 00 00 
+  804ec9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed0:	00 00 00 
+  804ed3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eda:	00 00 00 
+  804edd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee4:	00 00 00 
+  804ee7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eee:	00 00 00 
+  804ef1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef8:	00 00 00 
+  804efb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f02:	00 00 00 
+  804f05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0c:	00 00 00 
+  804f0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f16:	00 00 00 
+  804f19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f20:	00 00 00 
+  804f23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2a:	00 00 00 
+  804f2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f34:	00 00 00 
+  804f37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3e:	00 00 00 
+  804f41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f48:	00 00 00 
+  804f4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f52:	00 00 00 
+  804f55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5c:	00 00 00 
+  804f5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f66:	00 00 00 
+  804f69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f70:	00 00 00 
+  804f73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7a:	00 00 00 
+  804f7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f84:	00 00 00 
+  804f87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8e:	00 00 00 
+  804f91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f98:	00 00 00 
+  804f9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa2:	00 00 00 
+  804fa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fac:	00 00 00 
+  804faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb6:	00 00 00 
+  804fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc0:	00 00 00 
+  804fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fca:	00 00 00 
+  804fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd4:	00 00 00 
+  804fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fde:	00 00 00 
+  804fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe8:	00 00 00 
+  804feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff2:	00 00 00 
+  804ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffc:	00 00 00 
+  804fff:	90                   	nop
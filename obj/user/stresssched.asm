@@ -0,0 +1,8213 @@
+
+obj/user/stresssched:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 23 01 00 00       	call   800146 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int counter;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    int i, j;
+    envid_t parent = sys_getenvid();
+  800032:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  800039:	00 00 00 
+  80003c:	ff d0                	call   *%rax
+  80003e:	41 89 c5             	mov    %eax,%r13d
+
+    /* Fork several environments */
+    for (i = 0; i < 20; i++)
+  800041:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fork() == 0)
+  800046:	49 bc 50 1e 80 00 00 	movabs $0x801e50,%r12
+  80004d:	00 00 00 
+  800050:	41 ff d4             	call   *%r12
+  800053:	85 c0                	test   %eax,%eax
+  800055:	74 19                	je     800070 <umain+0x4b>
+    for (i = 0; i < 20; i++)
+  800057:	83 c3 01             	add    $0x1,%ebx
+  80005a:	83 fb 14             	cmp    $0x14,%ebx
+  80005d:	75 f1                	jne    800050 <umain+0x2b>
+            break;
+    if (i == 20) {
+        sys_yield();
+  80005f:	48 b8 ab 13 80 00 00 	movabs $0x8013ab,%rax
+  800066:	00 00 00 
+  800069:	ff d0                	call   *%rax
+        return;
+  80006b:	e9 94 00 00 00       	jmp    800104 <umain+0xdf>
+    if (i == 20) {
+  800070:	83 fb 14             	cmp    $0x14,%ebx
+  800073:	74 ea                	je     80005f <umain+0x3a>
+    }
+
+    /* Wait for the parent to finish forking */
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800075:	44 89 ea             	mov    %r13d,%edx
+  800078:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80007e:	44 89 e8             	mov    %r13d,%eax
+  800081:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800086:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80008d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800094:	00 00 00 
+  800097:	48 01 c8             	add    %rcx,%rax
+  80009a:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8000a0:	85 c0                	test   %eax,%eax
+  8000a2:	74 1c                	je     8000c0 <umain+0x9b>
+  8000a4:	48 63 c2             	movslq %edx,%rax
+  8000a7:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8000ae:	48 89 ca             	mov    %rcx,%rdx
+  8000b1:	48 01 c2             	add    %rax,%rdx
+        asm volatile("pause");
+  8000b4:	f3 90                	pause
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  8000b6:	8b 82 d4 00 00 00    	mov    0xd4(%rdx),%eax
+  8000bc:	85 c0                	test   %eax,%eax
+  8000be:	75 f4                	jne    8000b4 <umain+0x8f>
+    for (i = 0; i < 20; i++)
+  8000c0:	41 bc 0a 00 00 00    	mov    $0xa,%r12d
+
+    /* Check that one environment doesn't run on two CPUs at once */
+    for (i = 0; i < 10; i++) {
+        sys_yield();
+  8000c6:	49 bd ab 13 80 00 00 	movabs $0x8013ab,%r13
+  8000cd:	00 00 00 
+        for (j = 0; j < 10000; j++)
+            counter++;
+  8000d0:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8000d7:	00 00 00 
+        sys_yield();
+  8000da:	41 ff d5             	call   *%r13
+  8000dd:	ba 10 27 00 00       	mov    $0x2710,%edx
+            counter++;
+  8000e2:	8b 03                	mov    (%rbx),%eax
+  8000e4:	83 c0 01             	add    $0x1,%eax
+  8000e7:	89 03                	mov    %eax,(%rbx)
+        for (j = 0; j < 10000; j++)
+  8000e9:	83 ea 01             	sub    $0x1,%edx
+  8000ec:	75 f4                	jne    8000e2 <umain+0xbd>
+    for (i = 0; i < 10; i++) {
+  8000ee:	41 83 ec 01          	sub    $0x1,%r12d
+  8000f2:	75 e6                	jne    8000da <umain+0xb5>
+    }
+
+    if (counter != 10 * 10000)
+  8000f4:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  8000fb:	00 00 
+  8000fd:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  800102:	75 0b                	jne    80010f <umain+0xea>
+        panic("ran on two CPUs at once (counter is %d)", counter);
+
+    /* Check that we see environments running on different CPUs */
+    // cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+}
+  800104:	48 83 c4 08          	add    $0x8,%rsp
+  800108:	5b                   	pop    %rbx
+  800109:	41 5c                	pop    %r12
+  80010b:	41 5d                	pop    %r13
+  80010d:	5d                   	pop    %rbp
+  80010e:	c3                   	ret
+        panic("ran on two CPUs at once (counter is %d)", counter);
+  80010f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800116:	00 00 00 
+  800119:	8b 08                	mov    (%rax),%ecx
+  80011b:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800122:	00 00 00 
+  800125:	be 1f 00 00 00       	mov    $0x1f,%esi
+  80012a:	48 bf 28 50 80 00 00 	movabs $0x805028,%rdi
+  800131:	00 00 00 
+  800134:	b8 00 00 00 00       	mov    $0x0,%eax
+  800139:	49 b8 12 02 80 00 00 	movabs $0x800212,%r8
+  800140:	00 00 00 
+  800143:	41 ff d0             	call   *%r8
+
+0000000000800146 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800146:	55                   	push   %rbp
+  800147:	48 89 e5             	mov    %rsp,%rbp
+  80014a:	41 56                	push   %r14
+  80014c:	41 55                	push   %r13
+  80014e:	41 54                	push   %r12
+  800150:	53                   	push   %rbx
+  800151:	41 89 fd             	mov    %edi,%r13d
+  800154:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800157:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80015e:	00 00 00 
+  800161:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800168:	00 00 00 
+  80016b:	48 39 c2             	cmp    %rax,%rdx
+  80016e:	73 17                	jae    800187 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800170:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800173:	49 89 c4             	mov    %rax,%r12
+  800176:	48 83 c3 08          	add    $0x8,%rbx
+  80017a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017f:	ff 53 f8             	call   *-0x8(%rbx)
+  800182:	4c 39 e3             	cmp    %r12,%rbx
+  800185:	72 ef                	jb     800176 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800187:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  80018e:	00 00 00 
+  800191:	ff d0                	call   *%rax
+  800193:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800198:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80019f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001a6:	00 00 00 
+  8001a9:	48 01 d0             	add    %rdx,%rax
+  8001ac:	48 a3 08 70 80 00 00 	movabs %rax,0x807008
+  8001b3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001b6:	45 85 ed             	test   %r13d,%r13d
+  8001b9:	7e 0d                	jle    8001c8 <libmain+0x82>
+  8001bb:	49 8b 06             	mov    (%r14),%rax
+  8001be:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001c5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001c8:	4c 89 f6             	mov    %r14,%rsi
+  8001cb:	44 89 ef             	mov    %r13d,%edi
+  8001ce:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001d5:	00 00 00 
+  8001d8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001da:	48 b8 ef 01 80 00 00 	movabs $0x8001ef,%rax
+  8001e1:	00 00 00 
+  8001e4:	ff d0                	call   *%rax
+#endif
+}
+  8001e6:	5b                   	pop    %rbx
+  8001e7:	41 5c                	pop    %r12
+  8001e9:	41 5d                	pop    %r13
+  8001eb:	41 5e                	pop    %r14
+  8001ed:	5d                   	pop    %rbp
+  8001ee:	c3                   	ret
+
+00000000008001ef <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001ef:	55                   	push   %rbp
+  8001f0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001f3:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  8001fa:	00 00 00 
+  8001fd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800204:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  80020b:	00 00 00 
+  80020e:	ff d0                	call   *%rax
+}
+  800210:	5d                   	pop    %rbp
+  800211:	c3                   	ret
+
+0000000000800212 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800212:	55                   	push   %rbp
+  800213:	48 89 e5             	mov    %rsp,%rbp
+  800216:	41 56                	push   %r14
+  800218:	41 55                	push   %r13
+  80021a:	41 54                	push   %r12
+  80021c:	53                   	push   %rbx
+  80021d:	48 83 ec 50          	sub    $0x50,%rsp
+  800221:	49 89 fc             	mov    %rdi,%r12
+  800224:	41 89 f5             	mov    %esi,%r13d
+  800227:	48 89 d3             	mov    %rdx,%rbx
+  80022a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80022e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800232:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800236:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80023d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800241:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800245:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800249:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80024d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800254:	00 00 00 
+  800257:	4c 8b 30             	mov    (%rax),%r14
+  80025a:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  800261:	00 00 00 
+  800264:	ff d0                	call   *%rax
+  800266:	89 c6                	mov    %eax,%esi
+  800268:	45 89 e8             	mov    %r13d,%r8d
+  80026b:	4c 89 e1             	mov    %r12,%rcx
+  80026e:	4c 89 f2             	mov    %r14,%rdx
+  800271:	48 bf 48 50 80 00 00 	movabs $0x805048,%rdi
+  800278:	00 00 00 
+  80027b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800280:	49 bc 62 03 80 00 00 	movabs $0x800362,%r12
+  800287:	00 00 00 
+  80028a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80028d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800291:	48 89 df             	mov    %rbx,%rdi
+  800294:	48 b8 fe 02 80 00 00 	movabs $0x8002fe,%rax
+  80029b:	00 00 00 
+  80029e:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002a0:	48 bf ab 56 80 00 00 	movabs $0x8056ab,%rdi
+  8002a7:	00 00 00 
+  8002aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002af:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002b2:	cc                   	int3
+  8002b3:	eb fd                	jmp    8002b2 <_panic+0xa0>
+
+00000000008002b5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002b5:	55                   	push   %rbp
+  8002b6:	48 89 e5             	mov    %rsp,%rbp
+  8002b9:	53                   	push   %rbx
+  8002ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8002be:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002c1:	8b 06                	mov    (%rsi),%eax
+  8002c3:	8d 50 01             	lea    0x1(%rax),%edx
+  8002c6:	89 16                	mov    %edx,(%rsi)
+  8002c8:	48 98                	cltq
+  8002ca:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002cf:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002d5:	74 0a                	je     8002e1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002d7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002df:	c9                   	leave
+  8002e0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002e1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002e5:	be ff 00 00 00       	mov    $0xff,%esi
+  8002ea:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  8002f1:	00 00 00 
+  8002f4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002f6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002fc:	eb d9                	jmp    8002d7 <putch+0x22>
+
+00000000008002fe <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002fe:	55                   	push   %rbp
+  8002ff:	48 89 e5             	mov    %rsp,%rbp
+  800302:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800309:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80030c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800313:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800320:	48 89 f1             	mov    %rsi,%rcx
+  800323:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80032a:	48 bf b5 02 80 00 00 	movabs $0x8002b5,%rdi
+  800331:	00 00 00 
+  800334:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  80033b:	00 00 00 
+  80033e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800340:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800347:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80034e:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  800355:	00 00 00 
+  800358:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80035a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800360:	c9                   	leave
+  800361:	c3                   	ret
+
+0000000000800362 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800362:	55                   	push   %rbp
+  800363:	48 89 e5             	mov    %rsp,%rbp
+  800366:	48 83 ec 50          	sub    $0x50,%rsp
+  80036a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80036e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800372:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800376:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80037a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80037e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800385:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800389:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80038d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800391:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800395:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800399:	48 b8 fe 02 80 00 00 	movabs $0x8002fe,%rax
+  8003a0:	00 00 00 
+  8003a3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003a5:	c9                   	leave
+  8003a6:	c3                   	ret
+
+00000000008003a7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003a7:	55                   	push   %rbp
+  8003a8:	48 89 e5             	mov    %rsp,%rbp
+  8003ab:	41 57                	push   %r15
+  8003ad:	41 56                	push   %r14
+  8003af:	41 55                	push   %r13
+  8003b1:	41 54                	push   %r12
+  8003b3:	53                   	push   %rbx
+  8003b4:	48 83 ec 18          	sub    $0x18,%rsp
+  8003b8:	49 89 fc             	mov    %rdi,%r12
+  8003bb:	49 89 f5             	mov    %rsi,%r13
+  8003be:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003c2:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003c5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003c8:	41 89 cf             	mov    %ecx,%r15d
+  8003cb:	4c 39 fa             	cmp    %r15,%rdx
+  8003ce:	73 5b                	jae    80042b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003d0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003d4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003d8:	85 db                	test   %ebx,%ebx
+  8003da:	7e 0e                	jle    8003ea <print_num+0x43>
+            putch(padc, put_arg);
+  8003dc:	4c 89 ee             	mov    %r13,%rsi
+  8003df:	44 89 f7             	mov    %r14d,%edi
+  8003e2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003e5:	83 eb 01             	sub    $0x1,%ebx
+  8003e8:	75 f2                	jne    8003dc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003ea:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003ee:	48 b9 7c 50 80 00 00 	movabs $0x80507c,%rcx
+  8003f5:	00 00 00 
+  8003f8:	48 b8 6b 50 80 00 00 	movabs $0x80506b,%rax
+  8003ff:	00 00 00 
+  800402:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800406:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80040a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040f:	49 f7 f7             	div    %r15
+  800412:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800416:	4c 89 ee             	mov    %r13,%rsi
+  800419:	41 ff d4             	call   *%r12
+}
+  80041c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800420:	5b                   	pop    %rbx
+  800421:	41 5c                	pop    %r12
+  800423:	41 5d                	pop    %r13
+  800425:	41 5e                	pop    %r14
+  800427:	41 5f                	pop    %r15
+  800429:	5d                   	pop    %rbp
+  80042a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80042b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80042f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800434:	49 f7 f7             	div    %r15
+  800437:	48 83 ec 08          	sub    $0x8,%rsp
+  80043b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80043f:	52                   	push   %rdx
+  800440:	45 0f be c9          	movsbl %r9b,%r9d
+  800444:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800448:	48 89 c2             	mov    %rax,%rdx
+  80044b:	48 b8 a7 03 80 00 00 	movabs $0x8003a7,%rax
+  800452:	00 00 00 
+  800455:	ff d0                	call   *%rax
+  800457:	48 83 c4 10          	add    $0x10,%rsp
+  80045b:	eb 8d                	jmp    8003ea <print_num+0x43>
+
+000000000080045d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80045d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800461:	48 8b 06             	mov    (%rsi),%rax
+  800464:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800468:	73 0a                	jae    800474 <sprintputch+0x17>
+        *state->start++ = ch;
+  80046a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80046e:	48 89 16             	mov    %rdx,(%rsi)
+  800471:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800474:	c3                   	ret
+
+0000000000800475 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800475:	55                   	push   %rbp
+  800476:	48 89 e5             	mov    %rsp,%rbp
+  800479:	48 83 ec 50          	sub    $0x50,%rsp
+  80047d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800481:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800485:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800489:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800490:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800494:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800498:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80049c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004a0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004a4:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  8004ab:	00 00 00 
+  8004ae:	ff d0                	call   *%rax
+}
+  8004b0:	c9                   	leave
+  8004b1:	c3                   	ret
+
+00000000008004b2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004b2:	55                   	push   %rbp
+  8004b3:	48 89 e5             	mov    %rsp,%rbp
+  8004b6:	41 57                	push   %r15
+  8004b8:	41 56                	push   %r14
+  8004ba:	41 55                	push   %r13
+  8004bc:	41 54                	push   %r12
+  8004be:	53                   	push   %rbx
+  8004bf:	48 83 ec 38          	sub    $0x38,%rsp
+  8004c3:	49 89 fe             	mov    %rdi,%r14
+  8004c6:	49 89 f5             	mov    %rsi,%r13
+  8004c9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004cc:	48 8b 01             	mov    (%rcx),%rax
+  8004cf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004d3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004db:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004e3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004e7:	0f b6 3b             	movzbl (%rbx),%edi
+  8004ea:	40 80 ff 25          	cmp    $0x25,%dil
+  8004ee:	74 18                	je     800508 <vprintfmt+0x56>
+            if (!ch) return;
+  8004f0:	40 84 ff             	test   %dil,%dil
+  8004f3:	0f 84 04 07 00 00    	je     800bfd <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8004f9:	40 0f b6 ff          	movzbl %dil,%edi
+  8004fd:	4c 89 ee             	mov    %r13,%rsi
+  800500:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800503:	4c 89 e3             	mov    %r12,%rbx
+  800506:	eb db                	jmp    8004e3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800508:	be 00 00 00 00       	mov    $0x0,%esi
+  80050d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800511:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800516:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80051c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800523:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800527:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80052c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800531:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800534:	83 e8 23             	sub    $0x23,%eax
+  800537:	3c 57                	cmp    $0x57,%al
+  800539:	0f 87 a4 06 00 00    	ja     800be3 <vprintfmt+0x731>
+  80053f:	0f b6 c0             	movzbl %al,%eax
+  800542:	48 b9 00 52 80 00 00 	movabs $0x805200,%rcx
+  800549:	00 00 00 
+  80054c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80054f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800552:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800556:	eb cf                	jmp    800527 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800558:	49 89 dc             	mov    %rbx,%r12
+  80055b:	be 01 00 00 00       	mov    $0x1,%esi
+  800560:	eb c5                	jmp    800527 <vprintfmt+0x75>
+            padc = ch;
+  800562:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800566:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800569:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80056c:	eb b9                	jmp    800527 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80056e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800571:	83 f8 2f             	cmp    $0x2f,%eax
+  800574:	77 24                	ja     80059a <vprintfmt+0xe8>
+  800576:	89 c1                	mov    %eax,%ecx
+  800578:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80057c:	83 c0 08             	add    $0x8,%eax
+  80057f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800582:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800585:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800588:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80058c:	79 99                	jns    800527 <vprintfmt+0x75>
+                width = precision;
+  80058e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800592:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800598:	eb 8d                	jmp    800527 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80059a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80059e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a6:	eb da                	jmp    800582 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005a8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005ad:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005b1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005b7:	3c 39                	cmp    $0x39,%al
+  8005b9:	77 1c                	ja     8005d7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005bb:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005bf:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005c3:	0f b6 c0             	movzbl %al,%eax
+  8005c6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005cb:	0f b6 03             	movzbl (%rbx),%eax
+  8005ce:	3c 39                	cmp    $0x39,%al
+  8005d0:	76 e9                	jbe    8005bb <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005d2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005d5:	eb b1                	jmp    800588 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005d7:	49 89 dc             	mov    %rbx,%r12
+  8005da:	eb ac                	jmp    800588 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005dc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005df:	85 c9                	test   %ecx,%ecx
+  8005e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e6:	0f 49 c1             	cmovns %ecx,%eax
+  8005e9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005ec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ef:	e9 33 ff ff ff       	jmp    800527 <vprintfmt+0x75>
+            lflag++;
+  8005f4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005f7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005fa:	e9 28 ff ff ff       	jmp    800527 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800602:	83 f8 2f             	cmp    $0x2f,%eax
+  800605:	77 19                	ja     800620 <vprintfmt+0x16e>
+  800607:	89 c2                	mov    %eax,%edx
+  800609:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80060d:	83 c0 08             	add    $0x8,%eax
+  800610:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800613:	8b 3a                	mov    (%rdx),%edi
+  800615:	4c 89 ee             	mov    %r13,%rsi
+  800618:	41 ff d6             	call   *%r14
+            break;
+  80061b:	e9 c3 fe ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800620:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800624:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800628:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062c:	eb e5                	jmp    800613 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80062e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800631:	83 f8 2f             	cmp    $0x2f,%eax
+  800634:	77 5a                	ja     800690 <vprintfmt+0x1de>
+  800636:	89 c2                	mov    %eax,%edx
+  800638:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80063c:	83 c0 08             	add    $0x8,%eax
+  80063f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800642:	8b 02                	mov    (%rdx),%eax
+  800644:	89 c1                	mov    %eax,%ecx
+  800646:	f7 d9                	neg    %ecx
+  800648:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80064b:	83 f9 13             	cmp    $0x13,%ecx
+  80064e:	7f 4e                	jg     80069e <vprintfmt+0x1ec>
+  800650:	48 63 c1             	movslq %ecx,%rax
+  800653:	48 ba c0 54 80 00 00 	movabs $0x8054c0,%rdx
+  80065a:	00 00 00 
+  80065d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800661:	48 85 c0             	test   %rax,%rax
+  800664:	74 38                	je     80069e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800666:	48 89 c1             	mov    %rax,%rcx
+  800669:	48 ba 19 57 80 00 00 	movabs $0x805719,%rdx
+  800670:	00 00 00 
+  800673:	4c 89 ee             	mov    %r13,%rsi
+  800676:	4c 89 f7             	mov    %r14,%rdi
+  800679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067e:	49 b8 75 04 80 00 00 	movabs $0x800475,%r8
+  800685:	00 00 00 
+  800688:	41 ff d0             	call   *%r8
+  80068b:	e9 53 fe ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800690:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800694:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800698:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069c:	eb a4                	jmp    800642 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80069e:	48 ba 94 50 80 00 00 	movabs $0x805094,%rdx
+  8006a5:	00 00 00 
+  8006a8:	4c 89 ee             	mov    %r13,%rsi
+  8006ab:	4c 89 f7             	mov    %r14,%rdi
+  8006ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b3:	49 b8 75 04 80 00 00 	movabs $0x800475,%r8
+  8006ba:	00 00 00 
+  8006bd:	41 ff d0             	call   *%r8
+  8006c0:	e9 1e fe ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006cb:	77 36                	ja     800703 <vprintfmt+0x251>
+  8006cd:	89 c2                	mov    %eax,%edx
+  8006cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d3:	83 c0 08             	add    $0x8,%eax
+  8006d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d9:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8006dc:	48 85 f6             	test   %rsi,%rsi
+  8006df:	48 b8 8d 50 80 00 00 	movabs $0x80508d,%rax
+  8006e6:	00 00 00 
+  8006e9:	48 0f 45 c6          	cmovne %rsi,%rax
+  8006ed:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006f5:	7e 06                	jle    8006fd <vprintfmt+0x24b>
+  8006f7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006fb:	75 14                	jne    800711 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006fd:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800701:	eb 5b                	jmp    80075e <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800703:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800707:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80070b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070f:	eb c8                	jmp    8006d9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800711:	49 63 f7             	movslq %r15d,%rsi
+  800714:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800718:	48 b8 b7 0c 80 00 00 	movabs $0x800cb7,%rax
+  80071f:	00 00 00 
+  800722:	ff d0                	call   *%rax
+  800724:	48 89 c2             	mov    %rax,%rdx
+  800727:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80072a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80072c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80072f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800732:	85 c0                	test   %eax,%eax
+  800734:	7e c7                	jle    8006fd <vprintfmt+0x24b>
+  800736:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80073b:	4c 89 ee             	mov    %r13,%rsi
+  80073e:	44 89 e7             	mov    %r12d,%edi
+  800741:	41 ff d6             	call   *%r14
+  800744:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800748:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80074b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80074e:	75 eb                	jne    80073b <vprintfmt+0x289>
+  800750:	eb ab                	jmp    8006fd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800752:	0f b6 f8             	movzbl %al,%edi
+  800755:	4c 89 ee             	mov    %r13,%rsi
+  800758:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  80075b:	4c 89 e2             	mov    %r12,%rdx
+  80075e:	45 85 ff             	test   %r15d,%r15d
+  800761:	78 06                	js     800769 <vprintfmt+0x2b7>
+  800763:	41 83 ef 01          	sub    $0x1,%r15d
+  800767:	78 23                	js     80078c <vprintfmt+0x2da>
+  800769:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80076d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800773:	84 c0                	test   %al,%al
+  800775:	74 15                	je     80078c <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800777:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80077b:	74 d5                	je     800752 <vprintfmt+0x2a0>
+  80077d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800780:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800785:	80 fa 5e             	cmp    $0x5e,%dl
+  800788:	77 cb                	ja     800755 <vprintfmt+0x2a3>
+  80078a:	eb c6                	jmp    800752 <vprintfmt+0x2a0>
+  80078c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80078f:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800792:	01 f0                	add    %esi,%eax
+  800794:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800796:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80079a:	85 c0                	test   %eax,%eax
+  80079c:	0f 8e 41 fd ff ff    	jle    8004e3 <vprintfmt+0x31>
+  8007a2:	4c 89 ee             	mov    %r13,%rsi
+  8007a5:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007aa:	41 ff d6             	call   *%r14
+  8007ad:	41 83 ec 01          	sub    $0x1,%r12d
+  8007b1:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007b5:	75 eb                	jne    8007a2 <vprintfmt+0x2f0>
+  8007b7:	e9 27 fd ff ff       	jmp    8004e3 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8007bc:	40 84 f6             	test   %sil,%sil
+  8007bf:	75 26                	jne    8007e7 <vprintfmt+0x335>
+    switch (lflag) {
+  8007c1:	85 d2                	test   %edx,%edx
+  8007c3:	74 59                	je     80081e <vprintfmt+0x36c>
+  8007c5:	83 fa 01             	cmp    $0x1,%edx
+  8007c8:	74 7b                	je     800845 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8007ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d0:	0f 87 96 00 00 00    	ja     80086c <vprintfmt+0x3ba>
+  8007d6:	89 c2                	mov    %eax,%edx
+  8007d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007dc:	83 c0 08             	add    $0x8,%eax
+  8007df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e2:	4c 8b 22             	mov    (%rdx),%r12
+  8007e5:	eb 17                	jmp    8007fe <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ed:	77 21                	ja     800810 <vprintfmt+0x35e>
+  8007ef:	89 c2                	mov    %eax,%edx
+  8007f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f5:	83 c0 08             	add    $0x8,%eax
+  8007f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007fb:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007fe:	4d 85 e4             	test   %r12,%r12
+  800801:	78 7a                	js     80087d <vprintfmt+0x3cb>
+            num = i;
+  800803:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80080b:	e9 b5 02 00 00       	jmp    800ac5 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800814:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800818:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081c:	eb dd                	jmp    8007fb <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  80081e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800821:	83 f8 2f             	cmp    $0x2f,%eax
+  800824:	77 11                	ja     800837 <vprintfmt+0x385>
+  800826:	89 c2                	mov    %eax,%edx
+  800828:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082c:	83 c0 08             	add    $0x8,%eax
+  80082f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800832:	4c 63 22             	movslq (%rdx),%r12
+  800835:	eb c7                	jmp    8007fe <vprintfmt+0x34c>
+  800837:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800843:	eb ed                	jmp    800832 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800845:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800848:	83 f8 2f             	cmp    $0x2f,%eax
+  80084b:	77 11                	ja     80085e <vprintfmt+0x3ac>
+  80084d:	89 c2                	mov    %eax,%edx
+  80084f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800853:	83 c0 08             	add    $0x8,%eax
+  800856:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800859:	4c 8b 22             	mov    (%rdx),%r12
+  80085c:	eb a0                	jmp    8007fe <vprintfmt+0x34c>
+  80085e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800862:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800866:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086a:	eb ed                	jmp    800859 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  80086c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800870:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800874:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800878:	e9 65 ff ff ff       	jmp    8007e2 <vprintfmt+0x330>
+                putch('-', put_arg);
+  80087d:	4c 89 ee             	mov    %r13,%rsi
+  800880:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800885:	41 ff d6             	call   *%r14
+                i = -i;
+  800888:	49 f7 dc             	neg    %r12
+  80088b:	e9 73 ff ff ff       	jmp    800803 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800890:	40 84 f6             	test   %sil,%sil
+  800893:	75 32                	jne    8008c7 <vprintfmt+0x415>
+    switch (lflag) {
+  800895:	85 d2                	test   %edx,%edx
+  800897:	74 5d                	je     8008f6 <vprintfmt+0x444>
+  800899:	83 fa 01             	cmp    $0x1,%edx
+  80089c:	0f 84 82 00 00 00    	je     800924 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8008a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a8:	0f 87 a5 00 00 00    	ja     800953 <vprintfmt+0x4a1>
+  8008ae:	89 c2                	mov    %eax,%edx
+  8008b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b4:	83 c0 08             	add    $0x8,%eax
+  8008b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ba:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008bd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008c2:	e9 fe 01 00 00       	jmp    800ac5 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cd:	77 19                	ja     8008e8 <vprintfmt+0x436>
+  8008cf:	89 c2                	mov    %eax,%edx
+  8008d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d5:	83 c0 08             	add    $0x8,%eax
+  8008d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008db:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008e3:	e9 dd 01 00 00       	jmp    800ac5 <vprintfmt+0x613>
+  8008e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f4:	eb e5                	jmp    8008db <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8008f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fc:	77 18                	ja     800916 <vprintfmt+0x464>
+  8008fe:	89 c2                	mov    %eax,%edx
+  800900:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800904:	83 c0 08             	add    $0x8,%eax
+  800907:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80090c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800911:	e9 af 01 00 00       	jmp    800ac5 <vprintfmt+0x613>
+  800916:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800922:	eb e6                	jmp    80090a <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800924:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800927:	83 f8 2f             	cmp    $0x2f,%eax
+  80092a:	77 19                	ja     800945 <vprintfmt+0x493>
+  80092c:	89 c2                	mov    %eax,%edx
+  80092e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800932:	83 c0 08             	add    $0x8,%eax
+  800935:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800938:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80093b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800940:	e9 80 01 00 00       	jmp    800ac5 <vprintfmt+0x613>
+  800945:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800949:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800951:	eb e5                	jmp    800938 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800953:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800957:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095f:	e9 56 ff ff ff       	jmp    8008ba <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800964:	40 84 f6             	test   %sil,%sil
+  800967:	75 2e                	jne    800997 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800969:	85 d2                	test   %edx,%edx
+  80096b:	0f 84 b3 00 00 00    	je     800a24 <vprintfmt+0x572>
+  800971:	83 fa 01             	cmp    $0x1,%edx
+  800974:	0f 84 d3 00 00 00    	je     800a4d <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  80097a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097d:	83 f8 2f             	cmp    $0x2f,%eax
+  800980:	0f 87 f1 00 00 00    	ja     800a77 <vprintfmt+0x5c5>
+  800986:	89 c2                	mov    %eax,%edx
+  800988:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098c:	83 c0 08             	add    $0x8,%eax
+  80098f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800992:	48 8b 02             	mov    (%rdx),%rax
+  800995:	eb 17                	jmp    8009ae <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800997:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099a:	83 f8 2f             	cmp    $0x2f,%eax
+  80099d:	77 77                	ja     800a16 <vprintfmt+0x564>
+  80099f:	89 c2                	mov    %eax,%edx
+  8009a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a5:	83 c0 08             	add    $0x8,%eax
+  8009a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ab:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8009ae:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8009b0:	83 f8 07             	cmp    $0x7,%eax
+  8009b3:	0f 8e cf 00 00 00    	jle    800a88 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8009b9:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8009bf:	44 89 e7             	mov    %r12d,%edi
+  8009c2:	41 c1 e4 03          	shl    $0x3,%r12d
+  8009c6:	89 d1                	mov    %edx,%ecx
+  8009c8:	8d 72 07             	lea    0x7(%rdx),%esi
+  8009cb:	85 d2                	test   %edx,%edx
+  8009cd:	0f 48 d6             	cmovs  %esi,%edx
+  8009d0:	c1 fa 03             	sar    $0x3,%edx
+  8009d3:	83 f9 3f             	cmp    $0x3f,%ecx
+  8009d6:	7f e7                	jg     8009bf <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8009d8:	85 ff                	test   %edi,%edi
+  8009da:	0f 84 03 fb ff ff    	je     8004e3 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8009e0:	49 63 f4             	movslq %r12d,%rsi
+  8009e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009e8:	48 f7 f6             	div    %rsi
+  8009eb:	49 89 d7             	mov    %rdx,%r15
+  8009ee:	83 c0 30             	add    $0x30,%eax
+  8009f1:	0f be f8             	movsbl %al,%edi
+  8009f4:	4c 89 ee             	mov    %r13,%rsi
+  8009f7:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  8009fa:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  8009fd:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800a02:	45 85 e4             	test   %r12d,%r12d
+  800a05:	41 0f 49 d4          	cmovns %r12d,%edx
+  800a09:	c1 fa 03             	sar    $0x3,%edx
+  800a0c:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800a0f:	75 cf                	jne    8009e0 <vprintfmt+0x52e>
+  800a11:	e9 cd fa ff ff       	jmp    8004e3 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800a16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a22:	eb 87                	jmp    8009ab <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800a24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a27:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2a:	77 13                	ja     800a3f <vprintfmt+0x58d>
+  800a2c:	89 c2                	mov    %eax,%edx
+  800a2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a32:	83 c0 08             	add    $0x8,%eax
+  800a35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a38:	8b 02                	mov    (%rdx),%eax
+  800a3a:	e9 6f ff ff ff       	jmp    8009ae <vprintfmt+0x4fc>
+  800a3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4b:	eb eb                	jmp    800a38 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800a4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a50:	83 f8 2f             	cmp    $0x2f,%eax
+  800a53:	77 14                	ja     800a69 <vprintfmt+0x5b7>
+  800a55:	89 c2                	mov    %eax,%edx
+  800a57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5b:	83 c0 08             	add    $0x8,%eax
+  800a5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a61:	48 8b 02             	mov    (%rdx),%rax
+  800a64:	e9 45 ff ff ff       	jmp    8009ae <vprintfmt+0x4fc>
+  800a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a75:	eb ea                	jmp    800a61 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800a77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a83:	e9 0a ff ff ff       	jmp    800992 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800a88:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800a8e:	e9 4d ff ff ff       	jmp    8009e0 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800a93:	4c 89 ee             	mov    %r13,%rsi
+  800a96:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a9b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a9e:	4c 89 ee             	mov    %r13,%rsi
+  800aa1:	bf 78 00 00 00       	mov    $0x78,%edi
+  800aa6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800aa9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aac:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaf:	77 47                	ja     800af8 <vprintfmt+0x646>
+  800ab1:	89 c2                	mov    %eax,%edx
+  800ab3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab7:	83 c0 08             	add    $0x8,%eax
+  800aba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ac5:	48 83 ec 08          	sub    $0x8,%rsp
+  800ac9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800acd:	0f 94 c0             	sete   %al
+  800ad0:	0f b6 c0             	movzbl %al,%eax
+  800ad3:	50                   	push   %rax
+  800ad4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ad9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800add:	4c 89 ee             	mov    %r13,%rsi
+  800ae0:	4c 89 f7             	mov    %r14,%rdi
+  800ae3:	48 b8 a7 03 80 00 00 	movabs $0x8003a7,%rax
+  800aea:	00 00 00 
+  800aed:	ff d0                	call   *%rax
+            break;
+  800aef:	48 83 c4 10          	add    $0x10,%rsp
+  800af3:	e9 eb f9 ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800af8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b04:	eb b7                	jmp    800abd <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800b06:	40 84 f6             	test   %sil,%sil
+  800b09:	75 2b                	jne    800b36 <vprintfmt+0x684>
+    switch (lflag) {
+  800b0b:	85 d2                	test   %edx,%edx
+  800b0d:	74 56                	je     800b65 <vprintfmt+0x6b3>
+  800b0f:	83 fa 01             	cmp    $0x1,%edx
+  800b12:	74 7f                	je     800b93 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800b14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b17:	83 f8 2f             	cmp    $0x2f,%eax
+  800b1a:	0f 87 a2 00 00 00    	ja     800bc2 <vprintfmt+0x710>
+  800b20:	89 c2                	mov    %eax,%edx
+  800b22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b26:	83 c0 08             	add    $0x8,%eax
+  800b29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b2f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b34:	eb 8f                	jmp    800ac5 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800b36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b39:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3c:	77 19                	ja     800b57 <vprintfmt+0x6a5>
+  800b3e:	89 c2                	mov    %eax,%edx
+  800b40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b44:	83 c0 08             	add    $0x8,%eax
+  800b47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b4d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b52:	e9 6e ff ff ff       	jmp    800ac5 <vprintfmt+0x613>
+  800b57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b63:	eb e5                	jmp    800b4a <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800b65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b68:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6b:	77 18                	ja     800b85 <vprintfmt+0x6d3>
+  800b6d:	89 c2                	mov    %eax,%edx
+  800b6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b73:	83 c0 08             	add    $0x8,%eax
+  800b76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b79:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b7b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b80:	e9 40 ff ff ff       	jmp    800ac5 <vprintfmt+0x613>
+  800b85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b91:	eb e6                	jmp    800b79 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800b93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b96:	83 f8 2f             	cmp    $0x2f,%eax
+  800b99:	77 19                	ja     800bb4 <vprintfmt+0x702>
+  800b9b:	89 c2                	mov    %eax,%edx
+  800b9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba1:	83 c0 08             	add    $0x8,%eax
+  800ba4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800baa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800baf:	e9 11 ff ff ff       	jmp    800ac5 <vprintfmt+0x613>
+  800bb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc0:	eb e5                	jmp    800ba7 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800bc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bce:	e9 59 ff ff ff       	jmp    800b2c <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800bd3:	4c 89 ee             	mov    %r13,%rsi
+  800bd6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bdb:	41 ff d6             	call   *%r14
+            break;
+  800bde:	e9 00 f9 ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800be3:	4c 89 ee             	mov    %r13,%rsi
+  800be6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800beb:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bee:	48 83 eb 01          	sub    $0x1,%rbx
+  800bf2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bf6:	75 f6                	jne    800bee <vprintfmt+0x73c>
+  800bf8:	e9 e6 f8 ff ff       	jmp    8004e3 <vprintfmt+0x31>
+}
+  800bfd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c01:	5b                   	pop    %rbx
+  800c02:	41 5c                	pop    %r12
+  800c04:	41 5d                	pop    %r13
+  800c06:	41 5e                	pop    %r14
+  800c08:	41 5f                	pop    %r15
+  800c0a:	5d                   	pop    %rbp
+  800c0b:	c3                   	ret
+
+0000000000800c0c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c0c:	55                   	push   %rbp
+  800c0d:	48 89 e5             	mov    %rsp,%rbp
+  800c10:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c14:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c18:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c1d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c21:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c28:	48 85 ff             	test   %rdi,%rdi
+  800c2b:	74 2b                	je     800c58 <vsnprintf+0x4c>
+  800c2d:	48 85 f6             	test   %rsi,%rsi
+  800c30:	74 26                	je     800c58 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c32:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c36:	48 bf 5d 04 80 00 00 	movabs $0x80045d,%rdi
+  800c3d:	00 00 00 
+  800c40:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  800c47:	00 00 00 
+  800c4a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c50:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c53:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c56:	c9                   	leave
+  800c57:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c5d:	eb f7                	jmp    800c56 <vsnprintf+0x4a>
+
+0000000000800c5f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c5f:	55                   	push   %rbp
+  800c60:	48 89 e5             	mov    %rsp,%rbp
+  800c63:	48 83 ec 50          	sub    $0x50,%rsp
+  800c67:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c6b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c6f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c73:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c7a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c82:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c86:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c8a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c8e:	48 b8 0c 0c 80 00 00 	movabs $0x800c0c,%rax
+  800c95:	00 00 00 
+  800c98:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c9a:	c9                   	leave
+  800c9b:	c3                   	ret
+
+0000000000800c9c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c9c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c9f:	74 10                	je     800cb1 <strlen+0x15>
+    size_t n = 0;
+  800ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ca6:	48 83 c0 01          	add    $0x1,%rax
+  800caa:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cae:	75 f6                	jne    800ca6 <strlen+0xa>
+  800cb0:	c3                   	ret
+    size_t n = 0;
+  800cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cb6:	c3                   	ret
+
+0000000000800cb7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cb7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cba:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cbf:	48 85 f6             	test   %rsi,%rsi
+  800cc2:	74 11                	je     800cd5 <strnlen+0x1e>
+  800cc4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cc8:	74 0c                	je     800cd6 <strnlen+0x1f>
+  800cca:	48 83 c2 01          	add    $0x1,%rdx
+  800cce:	48 39 d0             	cmp    %rdx,%rax
+  800cd1:	75 f1                	jne    800cc4 <strnlen+0xd>
+  800cd3:	eb 04                	jmp    800cd9 <strnlen+0x22>
+  800cd5:	c3                   	ret
+  800cd6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cd9:	c3                   	ret
+
+0000000000800cda <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cda:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ce6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ce9:	48 83 c2 01          	add    $0x1,%rdx
+  800ced:	84 c9                	test   %cl,%cl
+  800cef:	75 f1                	jne    800ce2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cf1:	c3                   	ret
+
+0000000000800cf2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cf2:	55                   	push   %rbp
+  800cf3:	48 89 e5             	mov    %rsp,%rbp
+  800cf6:	41 54                	push   %r12
+  800cf8:	53                   	push   %rbx
+  800cf9:	48 89 fb             	mov    %rdi,%rbx
+  800cfc:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cff:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  800d06:	00 00 00 
+  800d09:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d0b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d0f:	4c 89 e6             	mov    %r12,%rsi
+  800d12:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  800d19:	00 00 00 
+  800d1c:	ff d0                	call   *%rax
+    return dst;
+}
+  800d1e:	48 89 d8             	mov    %rbx,%rax
+  800d21:	5b                   	pop    %rbx
+  800d22:	41 5c                	pop    %r12
+  800d24:	5d                   	pop    %rbp
+  800d25:	c3                   	ret
+
+0000000000800d26 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d26:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d29:	48 85 d2             	test   %rdx,%rdx
+  800d2c:	74 1f                	je     800d4d <strncpy+0x27>
+  800d2e:	48 01 fa             	add    %rdi,%rdx
+  800d31:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d34:	48 83 c1 01          	add    $0x1,%rcx
+  800d38:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d3c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d40:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d44:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d48:	48 39 ca             	cmp    %rcx,%rdx
+  800d4b:	75 e7                	jne    800d34 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d4d:	c3                   	ret
+
+0000000000800d4e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d4e:	48 89 f8             	mov    %rdi,%rax
+  800d51:	48 85 d2             	test   %rdx,%rdx
+  800d54:	74 24                	je     800d7a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d56:	48 83 ea 01          	sub    $0x1,%rdx
+  800d5a:	74 1b                	je     800d77 <strlcpy+0x29>
+  800d5c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d60:	0f b6 16             	movzbl (%rsi),%edx
+  800d63:	84 d2                	test   %dl,%dl
+  800d65:	74 10                	je     800d77 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d67:	48 83 c6 01          	add    $0x1,%rsi
+  800d6b:	48 83 c0 01          	add    $0x1,%rax
+  800d6f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d72:	48 39 c8             	cmp    %rcx,%rax
+  800d75:	75 e9                	jne    800d60 <strlcpy+0x12>
+        *dst = '\0';
+  800d77:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d7a:	48 29 f8             	sub    %rdi,%rax
+}
+  800d7d:	c3                   	ret
+
+0000000000800d7e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d7e:	0f b6 07             	movzbl (%rdi),%eax
+  800d81:	84 c0                	test   %al,%al
+  800d83:	74 13                	je     800d98 <strcmp+0x1a>
+  800d85:	38 06                	cmp    %al,(%rsi)
+  800d87:	75 0f                	jne    800d98 <strcmp+0x1a>
+  800d89:	48 83 c7 01          	add    $0x1,%rdi
+  800d8d:	48 83 c6 01          	add    $0x1,%rsi
+  800d91:	0f b6 07             	movzbl (%rdi),%eax
+  800d94:	84 c0                	test   %al,%al
+  800d96:	75 ed                	jne    800d85 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d98:	0f b6 c0             	movzbl %al,%eax
+  800d9b:	0f b6 16             	movzbl (%rsi),%edx
+  800d9e:	29 d0                	sub    %edx,%eax
+}
+  800da0:	c3                   	ret
+
+0000000000800da1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800da1:	48 85 d2             	test   %rdx,%rdx
+  800da4:	74 1f                	je     800dc5 <strncmp+0x24>
+  800da6:	0f b6 07             	movzbl (%rdi),%eax
+  800da9:	84 c0                	test   %al,%al
+  800dab:	74 1e                	je     800dcb <strncmp+0x2a>
+  800dad:	3a 06                	cmp    (%rsi),%al
+  800daf:	75 1a                	jne    800dcb <strncmp+0x2a>
+  800db1:	48 83 c7 01          	add    $0x1,%rdi
+  800db5:	48 83 c6 01          	add    $0x1,%rsi
+  800db9:	48 83 ea 01          	sub    $0x1,%rdx
+  800dbd:	75 e7                	jne    800da6 <strncmp+0x5>
+
+    if (!n) return 0;
+  800dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc4:	c3                   	ret
+  800dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dca:	c3                   	ret
+  800dcb:	48 85 d2             	test   %rdx,%rdx
+  800dce:	74 09                	je     800dd9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dd0:	0f b6 07             	movzbl (%rdi),%eax
+  800dd3:	0f b6 16             	movzbl (%rsi),%edx
+  800dd6:	29 d0                	sub    %edx,%eax
+  800dd8:	c3                   	ret
+    if (!n) return 0;
+  800dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dde:	c3                   	ret
+
+0000000000800ddf <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ddf:	0f b6 17             	movzbl (%rdi),%edx
+  800de2:	84 d2                	test   %dl,%dl
+  800de4:	74 18                	je     800dfe <strchr+0x1f>
+        if (*str == c) {
+  800de6:	0f be d2             	movsbl %dl,%edx
+  800de9:	39 f2                	cmp    %esi,%edx
+  800deb:	74 17                	je     800e04 <strchr+0x25>
+    for (; *str; str++) {
+  800ded:	48 83 c7 01          	add    $0x1,%rdi
+  800df1:	0f b6 17             	movzbl (%rdi),%edx
+  800df4:	84 d2                	test   %dl,%dl
+  800df6:	75 ee                	jne    800de6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfd:	c3                   	ret
+  800dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e03:	c3                   	ret
+  800e04:	48 89 f8             	mov    %rdi,%rax
+}
+  800e07:	c3                   	ret
+
+0000000000800e08 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e08:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e0b:	0f b6 17             	movzbl (%rdi),%edx
+  800e0e:	84 d2                	test   %dl,%dl
+  800e10:	74 13                	je     800e25 <strfind+0x1d>
+  800e12:	0f be d2             	movsbl %dl,%edx
+  800e15:	39 f2                	cmp    %esi,%edx
+  800e17:	74 0b                	je     800e24 <strfind+0x1c>
+  800e19:	48 83 c0 01          	add    $0x1,%rax
+  800e1d:	0f b6 10             	movzbl (%rax),%edx
+  800e20:	84 d2                	test   %dl,%dl
+  800e22:	75 ee                	jne    800e12 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e24:	c3                   	ret
+  800e25:	c3                   	ret
+
+0000000000800e26 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800e26:	55                   	push   %rbp
+  800e27:	48 89 e5             	mov    %rsp,%rbp
+  800e2a:	41 57                	push   %r15
+  800e2c:	41 56                	push   %r14
+  800e2e:	41 55                	push   %r13
+  800e30:	41 54                	push   %r12
+  800e32:	53                   	push   %rbx
+  800e33:	48 83 ec 08          	sub    $0x8,%rsp
+  800e37:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800e3a:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800e3e:	45 84 ed             	test   %r13b,%r13b
+  800e41:	75 12                	jne    800e55 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800e43:	4c 89 f8             	mov    %r15,%rax
+  800e46:	48 83 c4 08          	add    $0x8,%rsp
+  800e4a:	5b                   	pop    %rbx
+  800e4b:	41 5c                	pop    %r12
+  800e4d:	41 5d                	pop    %r13
+  800e4f:	41 5e                	pop    %r14
+  800e51:	41 5f                	pop    %r15
+  800e53:	5d                   	pop    %rbp
+  800e54:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800e55:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800e59:	4c 89 e7             	mov    %r12,%rdi
+  800e5c:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  800e63:	00 00 00 
+  800e66:	ff d0                	call   *%rax
+  800e68:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800e6b:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800e6f:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800e73:	49 bf a1 0d 80 00 00 	movabs $0x800da1,%r15
+  800e7a:	00 00 00 
+				if ((sc = *s++) == 0)
+  800e7d:	84 c0                	test   %al,%al
+  800e7f:	75 14                	jne    800e95 <strstr+0x6f>
+					return NULL;
+  800e81:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e87:	eb ba                	jmp    800e43 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800e89:	48 83 c3 01          	add    $0x1,%rbx
+  800e8d:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800e91:	84 c0                	test   %al,%al
+  800e93:	74 1b                	je     800eb0 <strstr+0x8a>
+			} while (sc != c);
+  800e95:	41 38 c5             	cmp    %al,%r13b
+  800e98:	75 ef                	jne    800e89 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800e9a:	4c 89 f2             	mov    %r14,%rdx
+  800e9d:	4c 89 e6             	mov    %r12,%rsi
+  800ea0:	48 89 df             	mov    %rbx,%rdi
+  800ea3:	41 ff d7             	call   *%r15
+  800ea6:	85 c0                	test   %eax,%eax
+  800ea8:	75 df                	jne    800e89 <strstr+0x63>
+  800eaa:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800eae:	eb 93                	jmp    800e43 <strstr+0x1d>
+					return NULL;
+  800eb0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800eb6:	eb 8b                	jmp    800e43 <strstr+0x1d>
+
+0000000000800eb8 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800eb8:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800eba:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800ebd:	8d 57 20             	lea    0x20(%rdi),%edx
+  800ec0:	83 f9 1a             	cmp    $0x1a,%ecx
+  800ec3:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800ec6:	c3                   	ret
+
+0000000000800ec7 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800ec7:	55                   	push   %rbp
+  800ec8:	48 89 e5             	mov    %rsp,%rbp
+  800ecb:	41 57                	push   %r15
+  800ecd:	41 56                	push   %r14
+  800ecf:	41 55                	push   %r13
+  800ed1:	41 54                	push   %r12
+  800ed3:	53                   	push   %rbx
+  800ed4:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800ed8:	48 39 f7             	cmp    %rsi,%rdi
+  800edb:	74 49                	je     800f26 <strcasecmp+0x5f>
+  800edd:	49 89 fd             	mov    %rdi,%r13
+  800ee0:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800ee3:	49 bf b8 0e 80 00 00 	movabs $0x800eb8,%r15
+  800eea:	00 00 00 
+  800eed:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800ef2:	41 0f b6 fe          	movzbl %r14b,%edi
+  800ef6:	41 ff d7             	call   *%r15
+  800ef9:	89 c3                	mov    %eax,%ebx
+  800efb:	49 83 c4 01          	add    $0x1,%r12
+  800eff:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800f05:	41 ff d7             	call   *%r15
+  800f08:	29 c3                	sub    %eax,%ebx
+  800f0a:	75 09                	jne    800f15 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800f0c:	49 83 c5 01          	add    $0x1,%r13
+  800f10:	45 84 f6             	test   %r14b,%r14b
+  800f13:	75 d8                	jne    800eed <strcasecmp+0x26>
+}
+  800f15:	89 d8                	mov    %ebx,%eax
+  800f17:	48 83 c4 08          	add    $0x8,%rsp
+  800f1b:	5b                   	pop    %rbx
+  800f1c:	41 5c                	pop    %r12
+  800f1e:	41 5d                	pop    %r13
+  800f20:	41 5e                	pop    %r14
+  800f22:	41 5f                	pop    %r15
+  800f24:	5d                   	pop    %rbp
+  800f25:	c3                   	ret
+        return 0;
+  800f26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2b:	eb e8                	jmp    800f15 <strcasecmp+0x4e>
+
+0000000000800f2d <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800f2d:	55                   	push   %rbp
+  800f2e:	48 89 e5             	mov    %rsp,%rbp
+  800f31:	41 57                	push   %r15
+  800f33:	41 56                	push   %r14
+  800f35:	41 55                	push   %r13
+  800f37:	41 54                	push   %r12
+  800f39:	53                   	push   %rbx
+  800f3a:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800f3e:	48 85 d2             	test   %rdx,%rdx
+  800f41:	74 4f                	je     800f92 <strncasecmp+0x65>
+  800f43:	49 89 fc             	mov    %rdi,%r12
+  800f46:	49 89 f5             	mov    %rsi,%r13
+  800f49:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800f4d:	49 be b8 0e 80 00 00 	movabs $0x800eb8,%r14
+  800f54:	00 00 00 
+  800f57:	49 83 c4 01          	add    $0x1,%r12
+  800f5b:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800f61:	41 ff d6             	call   *%r14
+  800f64:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800f66:	49 83 c5 01          	add    $0x1,%r13
+  800f6a:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800f6f:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800f72:	29 c3                	sub    %eax,%ebx
+  800f74:	85 c0                	test   %eax,%eax
+  800f76:	74 09                	je     800f81 <strncasecmp+0x54>
+  800f78:	85 db                	test   %ebx,%ebx
+  800f7a:	75 05                	jne    800f81 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800f7c:	4d 39 fc             	cmp    %r15,%r12
+  800f7f:	75 d6                	jne    800f57 <strncasecmp+0x2a>
+}
+  800f81:	89 d8                	mov    %ebx,%eax
+  800f83:	48 83 c4 08          	add    $0x8,%rsp
+  800f87:	5b                   	pop    %rbx
+  800f88:	41 5c                	pop    %r12
+  800f8a:	41 5d                	pop    %r13
+  800f8c:	41 5e                	pop    %r14
+  800f8e:	41 5f                	pop    %r15
+  800f90:	5d                   	pop    %rbp
+  800f91:	c3                   	ret
+    int d = 0;
+  800f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800f97:	eb e8                	jmp    800f81 <strncasecmp+0x54>
+
+0000000000800f99 <toupper>:
+
+int toupper(int c) {
+  800f99:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800f9b:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800f9e:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800fa1:	83 f9 1a             	cmp    $0x1a,%ecx
+  800fa4:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800fa7:	c3                   	ret
+
+0000000000800fa8 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800fa8:	83 ff 20             	cmp    $0x20,%edi
+  800fab:	0f 94 c0             	sete   %al
+  800fae:	0f b6 c0             	movzbl %al,%eax
+}
+  800fb1:	c3                   	ret
+
+0000000000800fb2 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800fb2:	89 f8                	mov    %edi,%eax
+  800fb4:	f7 d8                	neg    %eax
+  800fb6:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800fb9:	c3                   	ret
+
+0000000000800fba <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fba:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fbd:	48 89 f8             	mov    %rdi,%rax
+  800fc0:	48 f7 d8             	neg    %rax
+  800fc3:	83 e0 07             	and    $0x7,%eax
+  800fc6:	49 89 d1             	mov    %rdx,%r9
+  800fc9:	49 29 c1             	sub    %rax,%r9
+  800fcc:	78 36                	js     801004 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fce:	40 0f b6 c6          	movzbl %sil,%eax
+  800fd2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fd9:	01 01 01 
+  800fdc:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fe0:	40 f6 c7 07          	test   $0x7,%dil
+  800fe4:	75 38                	jne    80101e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fe6:	4c 89 c9             	mov    %r9,%rcx
+  800fe9:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fed:	74 0c                	je     800ffb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fef:	fc                   	cld
+  800ff0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ff3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ff7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ffb:	4d 85 c9             	test   %r9,%r9
+  800ffe:	75 45                	jne    801045 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801000:	4c 89 c0             	mov    %r8,%rax
+  801003:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801004:	48 85 d2             	test   %rdx,%rdx
+  801007:	74 f7                	je     801000 <memset+0x46>
+  801009:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80100c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80100f:	48 83 c0 01          	add    $0x1,%rax
+  801013:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801017:	48 39 c2             	cmp    %rax,%rdx
+  80101a:	75 f3                	jne    80100f <memset+0x55>
+  80101c:	eb e2                	jmp    801000 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80101e:	40 f6 c7 01          	test   $0x1,%dil
+  801022:	74 06                	je     80102a <memset+0x70>
+  801024:	88 07                	mov    %al,(%rdi)
+  801026:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80102a:	40 f6 c7 02          	test   $0x2,%dil
+  80102e:	74 07                	je     801037 <memset+0x7d>
+  801030:	66 89 07             	mov    %ax,(%rdi)
+  801033:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801037:	40 f6 c7 04          	test   $0x4,%dil
+  80103b:	74 a9                	je     800fe6 <memset+0x2c>
+  80103d:	89 07                	mov    %eax,(%rdi)
+  80103f:	48 83 c7 04          	add    $0x4,%rdi
+  801043:	eb a1                	jmp    800fe6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801045:	41 f6 c1 04          	test   $0x4,%r9b
+  801049:	74 06                	je     801051 <memset+0x97>
+  80104b:	89 07                	mov    %eax,(%rdi)
+  80104d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801051:	41 f6 c1 02          	test   $0x2,%r9b
+  801055:	74 07                	je     80105e <memset+0xa4>
+  801057:	66 89 07             	mov    %ax,(%rdi)
+  80105a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80105e:	41 f6 c1 01          	test   $0x1,%r9b
+  801062:	74 9c                	je     801000 <memset+0x46>
+  801064:	88 07                	mov    %al,(%rdi)
+  801066:	eb 98                	jmp    801000 <memset+0x46>
+
+0000000000801068 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801068:	48 89 f8             	mov    %rdi,%rax
+  80106b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80106e:	48 39 fe             	cmp    %rdi,%rsi
+  801071:	73 3b                	jae    8010ae <memmove+0x46>
+  801073:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801077:	48 39 d7             	cmp    %rdx,%rdi
+  80107a:	73 32                	jae    8010ae <memmove+0x46>
+        s += n;
+        d += n;
+  80107c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801080:	48 89 d6             	mov    %rdx,%rsi
+  801083:	48 09 fe             	or     %rdi,%rsi
+  801086:	48 09 ce             	or     %rcx,%rsi
+  801089:	40 f6 c6 07          	test   $0x7,%sil
+  80108d:	75 12                	jne    8010a1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80108f:	48 83 ef 08          	sub    $0x8,%rdi
+  801093:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801097:	48 c1 e9 03          	shr    $0x3,%rcx
+  80109b:	fd                   	std
+  80109c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80109f:	fc                   	cld
+  8010a0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010a1:	48 83 ef 01          	sub    $0x1,%rdi
+  8010a5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010a9:	fd                   	std
+  8010aa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010ac:	eb f1                	jmp    80109f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010ae:	48 89 f2             	mov    %rsi,%rdx
+  8010b1:	48 09 c2             	or     %rax,%rdx
+  8010b4:	48 09 ca             	or     %rcx,%rdx
+  8010b7:	f6 c2 07             	test   $0x7,%dl
+  8010ba:	75 0c                	jne    8010c8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010bc:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010c0:	48 89 c7             	mov    %rax,%rdi
+  8010c3:	fc                   	cld
+  8010c4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010c7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010c8:	48 89 c7             	mov    %rax,%rdi
+  8010cb:	fc                   	cld
+  8010cc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010ce:	c3                   	ret
+
+00000000008010cf <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010cf:	55                   	push   %rbp
+  8010d0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010d3:	48 b8 68 10 80 00 00 	movabs $0x801068,%rax
+  8010da:	00 00 00 
+  8010dd:	ff d0                	call   *%rax
+}
+  8010df:	5d                   	pop    %rbp
+  8010e0:	c3                   	ret
+
+00000000008010e1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010e1:	55                   	push   %rbp
+  8010e2:	48 89 e5             	mov    %rsp,%rbp
+  8010e5:	41 57                	push   %r15
+  8010e7:	41 56                	push   %r14
+  8010e9:	41 55                	push   %r13
+  8010eb:	41 54                	push   %r12
+  8010ed:	53                   	push   %rbx
+  8010ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8010f2:	49 89 fe             	mov    %rdi,%r14
+  8010f5:	49 89 f7             	mov    %rsi,%r15
+  8010f8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010fb:	48 89 f7             	mov    %rsi,%rdi
+  8010fe:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  801105:	00 00 00 
+  801108:	ff d0                	call   *%rax
+  80110a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80110d:	48 89 de             	mov    %rbx,%rsi
+  801110:	4c 89 f7             	mov    %r14,%rdi
+  801113:	48 b8 b7 0c 80 00 00 	movabs $0x800cb7,%rax
+  80111a:	00 00 00 
+  80111d:	ff d0                	call   *%rax
+  80111f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801122:	48 39 c3             	cmp    %rax,%rbx
+  801125:	74 36                	je     80115d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801127:	48 89 d8             	mov    %rbx,%rax
+  80112a:	4c 29 e8             	sub    %r13,%rax
+  80112d:	49 39 c4             	cmp    %rax,%r12
+  801130:	73 31                	jae    801163 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801132:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801137:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80113b:	4c 89 fe             	mov    %r15,%rsi
+  80113e:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  801145:	00 00 00 
+  801148:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80114a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80114e:	48 83 c4 08          	add    $0x8,%rsp
+  801152:	5b                   	pop    %rbx
+  801153:	41 5c                	pop    %r12
+  801155:	41 5d                	pop    %r13
+  801157:	41 5e                	pop    %r14
+  801159:	41 5f                	pop    %r15
+  80115b:	5d                   	pop    %rbp
+  80115c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80115d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801161:	eb eb                	jmp    80114e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801163:	48 83 eb 01          	sub    $0x1,%rbx
+  801167:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80116b:	48 89 da             	mov    %rbx,%rdx
+  80116e:	4c 89 fe             	mov    %r15,%rsi
+  801171:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  801178:	00 00 00 
+  80117b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80117d:	49 01 de             	add    %rbx,%r14
+  801180:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801185:	eb c3                	jmp    80114a <strlcat+0x69>
+
+0000000000801187 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801187:	48 85 d2             	test   %rdx,%rdx
+  80118a:	74 2d                	je     8011b9 <memcmp+0x32>
+  80118c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801191:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801195:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80119a:	44 38 c1             	cmp    %r8b,%cl
+  80119d:	75 0f                	jne    8011ae <memcmp+0x27>
+    while (n-- > 0) {
+  80119f:	48 83 c0 01          	add    $0x1,%rax
+  8011a3:	48 39 c2             	cmp    %rax,%rdx
+  8011a6:	75 e9                	jne    801191 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ad:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011ae:	0f b6 c1             	movzbl %cl,%eax
+  8011b1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011b5:	44 29 c0             	sub    %r8d,%eax
+  8011b8:	c3                   	ret
+    return 0;
+  8011b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011be:	c3                   	ret
+
+00000000008011bf <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011bf:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011c3:	48 39 c7             	cmp    %rax,%rdi
+  8011c6:	73 0f                	jae    8011d7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011c8:	40 38 37             	cmp    %sil,(%rdi)
+  8011cb:	74 0e                	je     8011db <memfind+0x1c>
+    for (; src < end; src++) {
+  8011cd:	48 83 c7 01          	add    $0x1,%rdi
+  8011d1:	48 39 f8             	cmp    %rdi,%rax
+  8011d4:	75 f2                	jne    8011c8 <memfind+0x9>
+  8011d6:	c3                   	ret
+  8011d7:	48 89 f8             	mov    %rdi,%rax
+  8011da:	c3                   	ret
+  8011db:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011de:	c3                   	ret
+
+00000000008011df <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011df:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011e2:	0f b6 37             	movzbl (%rdi),%esi
+  8011e5:	40 80 fe 20          	cmp    $0x20,%sil
+  8011e9:	74 06                	je     8011f1 <strtol+0x12>
+  8011eb:	40 80 fe 09          	cmp    $0x9,%sil
+  8011ef:	75 13                	jne    801204 <strtol+0x25>
+  8011f1:	48 83 c7 01          	add    $0x1,%rdi
+  8011f5:	0f b6 37             	movzbl (%rdi),%esi
+  8011f8:	40 80 fe 20          	cmp    $0x20,%sil
+  8011fc:	74 f3                	je     8011f1 <strtol+0x12>
+  8011fe:	40 80 fe 09          	cmp    $0x9,%sil
+  801202:	74 ed                	je     8011f1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801204:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801207:	83 e0 fd             	and    $0xfffffffd,%eax
+  80120a:	3c 01                	cmp    $0x1,%al
+  80120c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801210:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801216:	75 0f                	jne    801227 <strtol+0x48>
+  801218:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80121b:	74 14                	je     801231 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80121d:	85 d2                	test   %edx,%edx
+  80121f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801224:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801227:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80122c:	4c 63 ca             	movslq %edx,%r9
+  80122f:	eb 36                	jmp    801267 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801231:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801235:	74 0f                	je     801246 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801237:	85 d2                	test   %edx,%edx
+  801239:	75 ec                	jne    801227 <strtol+0x48>
+        s++;
+  80123b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80123f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801244:	eb e1                	jmp    801227 <strtol+0x48>
+        s += 2;
+  801246:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80124a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80124f:	eb d6                	jmp    801227 <strtol+0x48>
+            dig -= '0';
+  801251:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801254:	44 0f b6 c1          	movzbl %cl,%r8d
+  801258:	41 39 d0             	cmp    %edx,%r8d
+  80125b:	7d 21                	jge    80127e <strtol+0x9f>
+        val = val * base + dig;
+  80125d:	49 0f af c1          	imul   %r9,%rax
+  801261:	0f b6 c9             	movzbl %cl,%ecx
+  801264:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801267:	48 83 c7 01          	add    $0x1,%rdi
+  80126b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80126f:	80 f9 39             	cmp    $0x39,%cl
+  801272:	76 dd                	jbe    801251 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801274:	80 f9 7b             	cmp    $0x7b,%cl
+  801277:	77 05                	ja     80127e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801279:	83 e9 57             	sub    $0x57,%ecx
+  80127c:	eb d6                	jmp    801254 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80127e:	4d 85 d2             	test   %r10,%r10
+  801281:	74 03                	je     801286 <strtol+0xa7>
+  801283:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801286:	48 89 c2             	mov    %rax,%rdx
+  801289:	48 f7 da             	neg    %rdx
+  80128c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801290:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801294:	c3                   	ret
+
+0000000000801295 <atoi>:
+int atoi(const char *str) {
+  801295:	55                   	push   %rbp
+  801296:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801299:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129e:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a3:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  8012aa:	00 00 00 
+  8012ad:	ff d0                	call   *%rax
+}
+  8012af:	5d                   	pop    %rbp
+  8012b0:	c3                   	ret
+
+00000000008012b1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012b1:	55                   	push   %rbp
+  8012b2:	48 89 e5             	mov    %rsp,%rbp
+  8012b5:	53                   	push   %rbx
+  8012b6:	48 89 fa             	mov    %rdi,%rdx
+  8012b9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012bc:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d6:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012dc:	c9                   	leave
+  8012dd:	c3                   	ret
+
+00000000008012de <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012de:	55                   	push   %rbp
+  8012df:	48 89 e5             	mov    %rsp,%rbp
+  8012e2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e3:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801301:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801307:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+
+000000000080130f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80130f:	55                   	push   %rbp
+  801310:	48 89 e5             	mov    %rsp,%rbp
+  801313:	53                   	push   %rbx
+  801314:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801318:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801320:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801325:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132f:	be 00 00 00 00       	mov    $0x0,%esi
+  801334:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80133c:	48 85 c0             	test   %rax,%rax
+  80133f:	7f 06                	jg     801347 <sys_env_destroy+0x38>
+}
+  801341:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801347:	49 89 c0             	mov    %rax,%r8
+  80134a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80134f:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801356:	00 00 00 
+  801359:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80135e:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801365:	00 00 00 
+  801368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136d:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  801374:	00 00 00 
+  801377:	41 ff d1             	call   *%r9
+
+000000000080137a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80137a:	55                   	push   %rbp
+  80137b:	48 89 e5             	mov    %rsp,%rbp
+  80137e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80137f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801384:	ba 00 00 00 00       	mov    $0x0,%edx
+  801389:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80138e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801393:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801398:	be 00 00 00 00       	mov    $0x0,%esi
+  80139d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a9:	c9                   	leave
+  8013aa:	c3                   	ret
+
+00000000008013ab <sys_yield>:
+
+void
+sys_yield(void) {
+  8013ab:	55                   	push   %rbp
+  8013ac:	48 89 e5             	mov    %rsp,%rbp
+  8013af:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d4:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013da:	c9                   	leave
+  8013db:	c3                   	ret
+
+00000000008013dc <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013dc:	55                   	push   %rbp
+  8013dd:	48 89 e5             	mov    %rsp,%rbp
+  8013e0:	53                   	push   %rbx
+  8013e1:	48 89 fa             	mov    %rdi,%rdx
+  8013e4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ec:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013f3:	00 00 00 
+  8013f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801400:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801406:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801408:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140c:	c9                   	leave
+  80140d:	c3                   	ret
+
+000000000080140e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80140e:	55                   	push   %rbp
+  80140f:	48 89 e5             	mov    %rsp,%rbp
+  801412:	53                   	push   %rbx
+  801413:	49 89 f8             	mov    %rdi,%r8
+  801416:	48 89 d3             	mov    %rdx,%rbx
+  801419:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80141c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801421:	4c 89 c2             	mov    %r8,%rdx
+  801424:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801427:	be 00 00 00 00       	mov    $0x0,%esi
+  80142c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801432:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801434:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801438:	c9                   	leave
+  801439:	c3                   	ret
+
+000000000080143a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80143a:	55                   	push   %rbp
+  80143b:	48 89 e5             	mov    %rsp,%rbp
+  80143e:	53                   	push   %rbx
+  80143f:	48 83 ec 08          	sub    $0x8,%rsp
+  801443:	89 f8                	mov    %edi,%eax
+  801445:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801448:	48 63 f9             	movslq %ecx,%rdi
+  80144b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80144e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801453:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801456:	be 00 00 00 00       	mov    $0x0,%esi
+  80145b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801461:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801463:	48 85 c0             	test   %rax,%rax
+  801466:	7f 06                	jg     80146e <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801468:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146c:	c9                   	leave
+  80146d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80146e:	49 89 c0             	mov    %rax,%r8
+  801471:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801476:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  80147d:	00 00 00 
+  801480:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801485:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  80148c:	00 00 00 
+  80148f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801494:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  80149b:	00 00 00 
+  80149e:	41 ff d1             	call   *%r9
+
+00000000008014a1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014a1:	55                   	push   %rbp
+  8014a2:	48 89 e5             	mov    %rsp,%rbp
+  8014a5:	53                   	push   %rbx
+  8014a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8014aa:	89 f8                	mov    %edi,%eax
+  8014ac:	49 89 f2             	mov    %rsi,%r10
+  8014af:	48 89 cf             	mov    %rcx,%rdi
+  8014b2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014b5:	48 63 da             	movslq %edx,%rbx
+  8014b8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c0:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c3:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c8:	48 85 c0             	test   %rax,%rax
+  8014cb:	7f 06                	jg     8014d3 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d1:	c9                   	leave
+  8014d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d3:	49 89 c0             	mov    %rax,%r8
+  8014d6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014db:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  8014e2:	00 00 00 
+  8014e5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014ea:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  8014f1:	00 00 00 
+  8014f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f9:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  801500:	00 00 00 
+  801503:	41 ff d1             	call   *%r9
+
+0000000000801506 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801506:	55                   	push   %rbp
+  801507:	48 89 e5             	mov    %rsp,%rbp
+  80150a:	53                   	push   %rbx
+  80150b:	48 83 ec 08          	sub    $0x8,%rsp
+  80150f:	49 89 f9             	mov    %rdi,%r9
+  801512:	89 f0                	mov    %esi,%eax
+  801514:	48 89 d3             	mov    %rdx,%rbx
+  801517:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80151a:	49 63 f0             	movslq %r8d,%rsi
+  80151d:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801520:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801525:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801528:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801530:	48 85 c0             	test   %rax,%rax
+  801533:	7f 06                	jg     80153b <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801535:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801539:	c9                   	leave
+  80153a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153b:	49 89 c0             	mov    %rax,%r8
+  80153e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801543:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  80154a:	00 00 00 
+  80154d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801552:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801559:	00 00 00 
+  80155c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801561:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  801568:	00 00 00 
+  80156b:	41 ff d1             	call   *%r9
+
+000000000080156e <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  80156e:	55                   	push   %rbp
+  80156f:	48 89 e5             	mov    %rsp,%rbp
+  801572:	53                   	push   %rbx
+  801573:	89 f8                	mov    %edi,%eax
+  801575:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801578:	48 63 f9             	movslq %ecx,%rdi
+  80157b:	48 63 da             	movslq %edx,%rbx
+  80157e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801581:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801586:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801589:	be 00 00 00 00       	mov    $0x0,%esi
+  80158e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801594:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  801596:	89 c2                	mov    %eax,%edx
+  801598:	48 85 c0             	test   %rax,%rax
+  80159b:	78 0d                	js     8015aa <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  80159d:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8015a2:	4d 85 c9             	test   %r9,%r9
+  8015a5:	74 03                	je     8015aa <sys_alloc_dma_region+0x3c>
+  8015a7:	49 89 01             	mov    %rax,(%r9)
+}
+  8015aa:	89 d0                	mov    %edx,%eax
+  8015ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b0:	c9                   	leave
+  8015b1:	c3                   	ret
+
+00000000008015b2 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8015b2:	55                   	push   %rbp
+  8015b3:	48 89 e5             	mov    %rsp,%rbp
+  8015b6:	53                   	push   %rbx
+  8015b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8015bb:	48 89 f1             	mov    %rsi,%rcx
+  8015be:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015c1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c4:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015db:	48 85 c0             	test   %rax,%rax
+  8015de:	7f 06                	jg     8015e6 <sys_set_cache_region+0x34>
+}
+  8015e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e4:	c9                   	leave
+  8015e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e6:	49 89 c0             	mov    %rax,%r8
+  8015e9:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8015ee:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  8015f5:	00 00 00 
+  8015f8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8015fd:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801604:	00 00 00 
+  801607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160c:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  801613:	00 00 00 
+  801616:	41 ff d1             	call   *%r9
+
+0000000000801619 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801619:	55                   	push   %rbp
+  80161a:	48 89 e5             	mov    %rsp,%rbp
+  80161d:	53                   	push   %rbx
+  80161e:	48 83 ec 08          	sub    $0x8,%rsp
+  801622:	48 89 f1             	mov    %rsi,%rcx
+  801625:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801628:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80162b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801630:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801635:	be 00 00 00 00       	mov    $0x0,%esi
+  80163a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801640:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801642:	48 85 c0             	test   %rax,%rax
+  801645:	7f 06                	jg     80164d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801647:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164b:	c9                   	leave
+  80164c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80164d:	49 89 c0             	mov    %rax,%r8
+  801650:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801655:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  80165c:	00 00 00 
+  80165f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801664:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  80166b:	00 00 00 
+  80166e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801673:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  80167a:	00 00 00 
+  80167d:	41 ff d1             	call   *%r9
+
+0000000000801680 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801680:	55                   	push   %rbp
+  801681:	48 89 e5             	mov    %rsp,%rbp
+  801684:	53                   	push   %rbx
+  801685:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801689:	48 63 ce             	movslq %esi,%rcx
+  80168c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80168f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801694:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801699:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80169e:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ab:	48 85 c0             	test   %rax,%rax
+  8016ae:	7f 06                	jg     8016b6 <sys_env_set_status+0x36>
+}
+  8016b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b4:	c9                   	leave
+  8016b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016b6:	49 89 c0             	mov    %rax,%r8
+  8016b9:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8016be:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  8016c5:	00 00 00 
+  8016c8:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016cd:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  8016d4:	00 00 00 
+  8016d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dc:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  8016e3:	00 00 00 
+  8016e6:	41 ff d1             	call   *%r9
+
+00000000008016e9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016e9:	55                   	push   %rbp
+  8016ea:	48 89 e5             	mov    %rsp,%rbp
+  8016ed:	53                   	push   %rbx
+  8016ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8016f2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016f5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801702:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801707:	be 00 00 00 00       	mov    $0x0,%esi
+  80170c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801712:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801714:	48 85 c0             	test   %rax,%rax
+  801717:	7f 06                	jg     80171f <sys_env_set_trapframe+0x36>
+}
+  801719:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171d:	c9                   	leave
+  80171e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80171f:	49 89 c0             	mov    %rax,%r8
+  801722:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801727:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  80172e:	00 00 00 
+  801731:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801736:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  80173d:	00 00 00 
+  801740:	b8 00 00 00 00       	mov    $0x0,%eax
+  801745:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  80174c:	00 00 00 
+  80174f:	41 ff d1             	call   *%r9
+
+0000000000801752 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801752:	55                   	push   %rbp
+  801753:	48 89 e5             	mov    %rsp,%rbp
+  801756:	53                   	push   %rbx
+  801757:	48 83 ec 08          	sub    $0x8,%rsp
+  80175b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80175e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801761:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801766:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801770:	be 00 00 00 00       	mov    $0x0,%esi
+  801775:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80177b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80177d:	48 85 c0             	test   %rax,%rax
+  801780:	7f 06                	jg     801788 <sys_env_set_pgfault_upcall+0x36>
+}
+  801782:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801786:	c9                   	leave
+  801787:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801788:	49 89 c0             	mov    %rax,%r8
+  80178b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801790:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  801797:	00 00 00 
+  80179a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80179f:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  8017a6:	00 00 00 
+  8017a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ae:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  8017b5:	00 00 00 
+  8017b8:	41 ff d1             	call   *%r9
+
+00000000008017bb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017bb:	55                   	push   %rbp
+  8017bc:	48 89 e5             	mov    %rsp,%rbp
+  8017bf:	53                   	push   %rbx
+  8017c0:	89 f8                	mov    %edi,%eax
+  8017c2:	49 89 f1             	mov    %rsi,%r9
+  8017c5:	48 89 d3             	mov    %rdx,%rbx
+  8017c8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017cb:	49 63 f0             	movslq %r8d,%rsi
+  8017ce:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017d6:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017df:	cd 30                	int    $0x30
+}
+  8017e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e5:	c9                   	leave
+  8017e6:	c3                   	ret
+
+00000000008017e7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017e7:	55                   	push   %rbp
+  8017e8:	48 89 e5             	mov    %rsp,%rbp
+  8017eb:	53                   	push   %rbx
+  8017ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8017f0:	48 89 fa             	mov    %rdi,%rdx
+  8017f3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f6:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801800:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801805:	be 00 00 00 00       	mov    $0x0,%esi
+  80180a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801810:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801812:	48 85 c0             	test   %rax,%rax
+  801815:	7f 06                	jg     80181d <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801817:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80181b:	c9                   	leave
+  80181c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80181d:	49 89 c0             	mov    %rax,%r8
+  801820:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801825:	48 ba 80 55 80 00 00 	movabs $0x805580,%rdx
+  80182c:	00 00 00 
+  80182f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801834:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  80183b:	00 00 00 
+  80183e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801843:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  80184a:	00 00 00 
+  80184d:	41 ff d1             	call   *%r9
+
+0000000000801850 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801850:	55                   	push   %rbp
+  801851:	48 89 e5             	mov    %rsp,%rbp
+  801854:	53                   	push   %rbx
+  801855:	48 89 fa             	mov    %rdi,%rdx
+  801858:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80185b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801860:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801865:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80186a:	be 00 00 00 00       	mov    $0x0,%esi
+  80186f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801875:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801877:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80187b:	c9                   	leave
+  80187c:	c3                   	ret
+
+000000000080187d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80187d:	55                   	push   %rbp
+  80187e:	48 89 e5             	mov    %rsp,%rbp
+  801881:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801882:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801887:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801891:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801896:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80189b:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018a6:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ac:	c9                   	leave
+  8018ad:	c3                   	ret
+
+00000000008018ae <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8018ae:	48 85 ff             	test   %rdi,%rdi
+  8018b1:	0f 84 b6 01 00 00    	je     801a6d <malloc+0x1bf>
+malloc(size_t size) {
+  8018b7:	55                   	push   %rbp
+  8018b8:	48 89 e5             	mov    %rsp,%rbp
+  8018bb:	41 56                	push   %r14
+  8018bd:	41 55                	push   %r13
+  8018bf:	41 54                	push   %r12
+  8018c1:	53                   	push   %rbx
+  8018c2:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8018c5:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8018cc:	00 00 00 
+  8018cf:	4c 8b 20             	mov    (%rax),%r12
+  8018d2:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  8018d9:	0f 87 94 01 00 00    	ja     801a73 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  8018df:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8018e6:	00 00 00 
+  8018e9:	48 85 c0             	test   %rax,%rax
+  8018ec:	74 6b                	je     801959 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  8018ee:	4d 85 e4             	test   %r12,%r12
+  8018f1:	74 66                	je     801959 <malloc+0xab>
+  8018f3:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  8018fa:	00 00 00 
+  8018fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801902:	eb 0d                	jmp    801911 <malloc+0x63>
+  801904:	48 83 c1 01          	add    $0x1,%rcx
+  801908:	48 83 c2 18          	add    $0x18,%rdx
+  80190c:	49 39 cc             	cmp    %rcx,%r12
+  80190f:	74 48                	je     801959 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801911:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801916:	74 ec                	je     801904 <malloc+0x56>
+  801918:	48 39 1a             	cmp    %rbx,(%rdx)
+  80191b:	72 e7                	jb     801904 <malloc+0x56>
+                real_freep_size--;
+  80191d:	48 83 e8 01          	sub    $0x1,%rax
+  801921:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801928:	00 00 00 
+                freep[i].is_free = false;
+  80192b:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801932:	00 00 00 
+  801935:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801939:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  80193d:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801941:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801948:	00 
+                freep[i].size = size;
+  801949:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  80194d:	48 01 c8             	add    %rcx,%rax
+  801950:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801954:	e9 0b 01 00 00       	jmp    801a64 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801959:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801960:	00 00 00 
+  801963:	48 01 d8             	add    %rbx,%rax
+  801966:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  80196c:	76 7c                	jbe    8019ea <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  80196e:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801975:	00 00 00 
+  801978:	4c 8b 30             	mov    (%rax),%r14
+  80197b:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801982:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801985:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  80198c:	00 00 00 
+  80198f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801996:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  80199d:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8019a3:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8019a7:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  8019ae:	00 00 00 
+  8019b1:	ff d0                	call   *%rax
+  8019b3:	89 c7                	mov    %eax,%edi
+  8019b5:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8019bc:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8019c3:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  8019ca:	00 00 00 
+  8019cd:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  8019d1:	b9 26 00 00 00       	mov    $0x26,%ecx
+  8019d6:	48 b8 3a 14 80 00 00 	movabs $0x80143a,%rax
+  8019dd:	00 00 00 
+  8019e0:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  8019e2:	85 c0                	test   %eax,%eax
+  8019e4:	0f 88 90 00 00 00    	js     801a7a <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  8019ea:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  8019f1:	00 00 00 
+  8019f4:	48 8b 31             	mov    (%rcx),%rsi
+  8019f7:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  8019fe:	00 00 00 
+  801a01:	4c 8b 07             	mov    (%rdi),%r8
+  801a04:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801a08:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801a0f:	00 00 00 
+  801a12:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801a16:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801a1a:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801a21:	00 00 00 
+  801a24:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801a28:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801a2b:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801a2f:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801a36:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801a37:	48 89 d8             	mov    %rbx,%rax
+  801a3a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a3f:	4c 01 c0             	add    %r8,%rax
+  801a42:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801a45:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801a4c:	48 01 f3             	add    %rsi,%rbx
+  801a4f:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801a52:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801a57:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801a5e:	00 00 00 
+  801a61:	48 89 d0             	mov    %rdx,%rax
+}
+  801a64:	5b                   	pop    %rbx
+  801a65:	41 5c                	pop    %r12
+  801a67:	41 5d                	pop    %r13
+  801a69:	41 5e                	pop    %r14
+  801a6b:	5d                   	pop    %rbp
+  801a6c:	c3                   	ret
+        return NULL;
+  801a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a72:	c3                   	ret
+        return NULL;
+  801a73:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a78:	eb ea                	jmp    801a64 <malloc+0x1b6>
+            return NULL;
+  801a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7f:	eb e3                	jmp    801a64 <malloc+0x1b6>
+
+0000000000801a81 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801a81:	55                   	push   %rbp
+  801a82:	48 89 e5             	mov    %rsp,%rbp
+  801a85:	53                   	push   %rbx
+  801a86:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801a8a:	48 89 fb             	mov    %rdi,%rbx
+  801a8d:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801a91:	48 89 df             	mov    %rbx,%rdi
+  801a94:	48 b8 ae 18 80 00 00 	movabs $0x8018ae,%rax
+  801a9b:	00 00 00 
+  801a9e:	ff d0                	call   *%rax
+  801aa0:	48 89 c7             	mov    %rax,%rdi
+  801aa3:	48 89 da             	mov    %rbx,%rdx
+  801aa6:	be 00 00 00 00       	mov    $0x0,%esi
+  801aab:	48 b8 ba 0f 80 00 00 	movabs $0x800fba,%rax
+  801ab2:	00 00 00 
+  801ab5:	ff d0                	call   *%rax
+}
+  801ab7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801abb:	c9                   	leave
+  801abc:	c3                   	ret
+
+0000000000801abd <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801abd:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801ac4:	00 00 00 
+  801ac7:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801ace:	00 00 00 
+  801ad1:	48 3b 02             	cmp    (%rdx),%rax
+  801ad4:	74 4d                	je     801b23 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801ad6:	48 85 c0             	test   %rax,%rax
+  801ad9:	74 4d                	je     801b28 <get_allocsize+0x6b>
+  801adb:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801ae2:	00 00 00 
+  801ae5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801aea:	48 3b 39             	cmp    (%rcx),%rdi
+  801aed:	74 13                	je     801b02 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801aef:	48 83 c2 01          	add    $0x1,%rdx
+  801af3:	48 83 c1 18          	add    $0x18,%rcx
+  801af7:	48 39 d0             	cmp    %rdx,%rax
+  801afa:	75 ee                	jne    801aea <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801afc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b01:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801b02:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0b:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801b12:	00 00 00 
+  801b15:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b1b:	75 0b                	jne    801b28 <get_allocsize+0x6b>
+  801b1d:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801b22:	c3                   	ret
+        return 0;
+  801b23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b28:	c3                   	ret
+
+0000000000801b29 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801b29:	48 85 ff             	test   %rdi,%rdi
+  801b2c:	0f 84 01 01 00 00    	je     801c33 <free+0x10a>
+free(void *ptr) {
+  801b32:	55                   	push   %rbp
+  801b33:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801b36:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801b3d:	00 00 00 
+  801b40:	48 8b 30             	mov    (%rax),%rsi
+  801b43:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801b4a:	00 00 00 
+  801b4d:	48 39 c6             	cmp    %rax,%rsi
+  801b50:	74 50                	je     801ba2 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801b52:	48 85 f6             	test   %rsi,%rsi
+  801b55:	74 21                	je     801b78 <free+0x4f>
+  801b57:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801b5e:	00 00 00 
+  801b61:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801b66:	48 3b 39             	cmp    (%rcx),%rdi
+  801b69:	74 61                	je     801bcc <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801b6b:	48 83 c2 01          	add    $0x1,%rdx
+  801b6f:	48 83 c1 18          	add    $0x18,%rcx
+  801b73:	48 39 d6             	cmp    %rdx,%rsi
+  801b76:	75 ee                	jne    801b66 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801b78:	48 ba f0 55 80 00 00 	movabs $0x8055f0,%rdx
+  801b7f:	00 00 00 
+  801b82:	be 12 01 00 00       	mov    $0x112,%esi
+  801b87:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801b8e:	00 00 00 
+  801b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b96:	48 b9 12 02 80 00 00 	movabs $0x800212,%rcx
+  801b9d:	00 00 00 
+  801ba0:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801ba2:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  801ba9:	00 00 00 
+  801bac:	be 06 01 00 00       	mov    $0x106,%esi
+  801bb1:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801bb8:	00 00 00 
+  801bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc0:	48 b9 12 02 80 00 00 	movabs $0x800212,%rcx
+  801bc7:	00 00 00 
+  801bca:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801bcc:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801bd0:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801bd7:	00 00 00 
+  801bda:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801be0:	75 27                	jne    801c09 <free+0xe0>
+            freep[i].is_free = true;
+  801be2:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801be6:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801bed:	00 00 00 
+  801bf0:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801bf7:	00 00 
+            real_freep_size++;
+  801bf9:	48 83 c0 01          	add    $0x1,%rax
+  801bfd:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801c04:	00 00 00 
+}
+  801c07:	5d                   	pop    %rbp
+  801c08:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801c09:	48 ba c8 55 80 00 00 	movabs $0x8055c8,%rdx
+  801c10:	00 00 00 
+  801c13:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801c18:	48 bf 18 56 80 00 00 	movabs $0x805618,%rdi
+  801c1f:	00 00 00 
+  801c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c27:	48 b9 12 02 80 00 00 	movabs $0x800212,%rcx
+  801c2e:	00 00 00 
+  801c31:	ff d1                	call   *%rcx
+  801c33:	c3                   	ret
+
+0000000000801c34 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801c34:	55                   	push   %rbp
+  801c35:	48 89 e5             	mov    %rsp,%rbp
+  801c38:	41 55                	push   %r13
+  801c3a:	41 54                	push   %r12
+  801c3c:	53                   	push   %rbx
+  801c3d:	48 83 ec 08          	sub    $0x8,%rsp
+  801c41:	48 89 fb             	mov    %rdi,%rbx
+  801c44:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801c47:	48 b8 bd 1a 80 00 00 	movabs $0x801abd,%rax
+  801c4e:	00 00 00 
+  801c51:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801c53:	49 39 c5             	cmp    %rax,%r13
+  801c56:	73 0e                	jae    801c66 <realloc+0x32>
+}
+  801c58:	48 89 d8             	mov    %rbx,%rax
+  801c5b:	48 83 c4 08          	add    $0x8,%rsp
+  801c5f:	5b                   	pop    %rbx
+  801c60:	41 5c                	pop    %r12
+  801c62:	41 5d                	pop    %r13
+  801c64:	5d                   	pop    %rbp
+  801c65:	c3                   	ret
+  801c66:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801c69:	4c 89 ef             	mov    %r13,%rdi
+  801c6c:	48 b8 ae 18 80 00 00 	movabs $0x8018ae,%rax
+  801c73:	00 00 00 
+  801c76:	ff d0                	call   *%rax
+  801c78:	48 89 c7             	mov    %rax,%rdi
+  801c7b:	4c 89 e2             	mov    %r12,%rdx
+  801c7e:	48 89 de             	mov    %rbx,%rsi
+  801c81:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  801c88:	00 00 00 
+  801c8b:	ff d0                	call   *%rax
+  801c8d:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801c90:	48 89 df             	mov    %rbx,%rdi
+  801c93:	48 b8 29 1b 80 00 00 	movabs $0x801b29,%rax
+  801c9a:	00 00 00 
+  801c9d:	ff d0                	call   *%rax
+    return newptr;
+  801c9f:	4c 89 e3             	mov    %r12,%rbx
+  801ca2:	eb b4                	jmp    801c58 <realloc+0x24>
+
+0000000000801ca4 <strdup>:
+
+char*
+strdup (const char *src) {
+  801ca4:	55                   	push   %rbp
+  801ca5:	48 89 e5             	mov    %rsp,%rbp
+  801ca8:	41 54                	push   %r12
+  801caa:	53                   	push   %rbx
+  801cab:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801cae:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  801cb5:	00 00 00 
+  801cb8:	ff d0                	call   *%rax
+  801cba:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801cbe:	4c 89 e7             	mov    %r12,%rdi
+  801cc1:	48 b8 ae 18 80 00 00 	movabs $0x8018ae,%rax
+  801cc8:	00 00 00 
+  801ccb:	ff d0                	call   *%rax
+  801ccd:	48 89 c7             	mov    %rax,%rdi
+  801cd0:	4c 89 e2             	mov    %r12,%rdx
+  801cd3:	48 89 de             	mov    %rbx,%rsi
+  801cd6:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  801cdd:	00 00 00 
+  801ce0:	ff d0                	call   *%rax
+}
+  801ce2:	5b                   	pop    %rbx
+  801ce3:	41 5c                	pop    %r12
+  801ce5:	5d                   	pop    %rbp
+  801ce6:	c3                   	ret
+
+0000000000801ce7 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801ce7:	55                   	push   %rbp
+  801ce8:	48 89 e5             	mov    %rsp,%rbp
+  801ceb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cec:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d00:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d05:	be 00 00 00 00       	mov    $0x0,%esi
+  801d0a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d10:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d16:	c9                   	leave
+  801d17:	c3                   	ret
+
+0000000000801d18 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801d18:	55                   	push   %rbp
+  801d19:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801d1c:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d23:	00 00 00 
+  801d26:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d2a:	74 26                	je     801d52 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801d2c:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d2e:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d32:	89 c0                	mov    %eax,%eax
+  801d34:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801d37:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801d3e:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801d45:	00 00 00 
+  801d48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4d:	48 f7 31             	divq   (%rcx)
+}
+  801d50:	5d                   	pop    %rbp
+  801d51:	c3                   	ret
+        freq = get_cpufreq();
+  801d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d57:	48 ba e7 1c 80 00 00 	movabs $0x801ce7,%rdx
+  801d5e:	00 00 00 
+  801d61:	ff d2                	call   *%rdx
+  801d63:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801d6a:	00 00 00 
+  801d6d:	eb bd                	jmp    801d2c <get_ticks+0x14>
+
+0000000000801d6f <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801d6f:	55                   	push   %rbp
+  801d70:	48 89 e5             	mov    %rsp,%rbp
+  801d73:	53                   	push   %rbx
+  801d74:	48 83 ec 08          	sub    $0x8,%rsp
+  801d78:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801d7b:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801d82:	00 00 00 
+  801d85:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d89:	74 50                	je     801ddb <sleep+0x6c>
+    asm volatile("rdtsc"
+  801d8b:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d8d:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d91:	89 c0                	mov    %eax,%eax
+  801d93:	48 89 d6             	mov    %rdx,%rsi
+  801d96:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801d99:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801da0:	00 00 00 
+  801da3:	48 0f af 18          	imul   (%rax),%rbx
+  801da7:	48 c1 eb 03          	shr    $0x3,%rbx
+  801dab:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801db2:	9b c4 20 
+  801db5:	48 89 d8             	mov    %rbx,%rax
+  801db8:	48 f7 e2             	mul    %rdx
+  801dbb:	48 89 d1             	mov    %rdx,%rcx
+  801dbe:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801dc2:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801dc4:	48 c1 e2 20          	shl    $0x20,%rdx
+  801dc8:	89 c0                	mov    %eax,%eax
+  801dca:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801dcd:	48 29 f2             	sub    %rsi,%rdx
+  801dd0:	48 39 ca             	cmp    %rcx,%rdx
+  801dd3:	72 ed                	jb     801dc2 <sleep+0x53>
+}
+  801dd5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dd9:	c9                   	leave
+  801dda:	c3                   	ret
+        freq = get_cpufreq();
+  801ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de0:	48 ba e7 1c 80 00 00 	movabs $0x801ce7,%rdx
+  801de7:	00 00 00 
+  801dea:	ff d2                	call   *%rdx
+  801dec:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801df3:	00 00 00 
+  801df6:	eb 93                	jmp    801d8b <sleep+0x1c>
+
+0000000000801df8 <poll_kbd>:
+
+int poll_kbd() {
+  801df8:	55                   	push   %rbp
+  801df9:	48 89 e5             	mov    %rsp,%rbp
+  801dfc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801dfd:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e02:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e07:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e11:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e16:	be 00 00 00 00       	mov    $0x0,%esi
+  801e1b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e21:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e27:	c9                   	leave
+  801e28:	c3                   	ret
+
+0000000000801e29 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801e29:	55                   	push   %rbp
+  801e2a:	48 89 e5             	mov    %rsp,%rbp
+  801e2d:	53                   	push   %rbx
+  801e2e:	49 89 fa             	mov    %rdi,%r10
+  801e31:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801e33:	44 89 c6             	mov    %r8d,%esi
+  801e36:	89 cf                	mov    %ecx,%edi
+  801e38:	89 d3                	mov    %edx,%ebx
+  801e3a:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801e3c:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e41:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e44:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801e48:	cd 30                	int    $0x30
+  801e4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e4e:	c9                   	leave
+  801e4f:	c3                   	ret
+
+0000000000801e50 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801e50:	55                   	push   %rbp
+  801e51:	48 89 e5             	mov    %rsp,%rbp
+  801e54:	41 54                	push   %r12
+  801e56:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  801e57:	48 b8 09 36 80 00 00 	movabs $0x803609,%rax
+  801e5e:	00 00 00 
+  801e61:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801e63:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801e68:	cd 30                	int    $0x30
+  801e6a:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  801e6d:	85 c0                	test   %eax,%eax
+  801e6f:	78 76                	js     801ee7 <fork+0x97>
+        return envid;
+    if (!envid) {
+  801e71:	74 7c                	je     801eef <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  801e73:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801e79:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801e80:	00 00 00 
+  801e83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e88:	89 c2                	mov    %eax,%edx
+  801e8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e94:	48 b8 a1 14 80 00 00 	movabs $0x8014a1,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	75 7c                	jne    801f20 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  801ea4:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  801eab:	00 00 00 
+  801eae:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801eb5:	44 89 e7             	mov    %r12d,%edi
+  801eb8:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+  801ec4:	85 c0                	test   %eax,%eax
+  801ec6:	75 60                	jne    801f28 <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  801ec8:	be 02 00 00 00       	mov    $0x2,%esi
+  801ecd:	44 89 e7             	mov    %r12d,%edi
+  801ed0:	48 b8 80 16 80 00 00 	movabs $0x801680,%rax
+  801ed7:	00 00 00 
+  801eda:	ff d0                	call   *%rax
+        return -1;
+  801edc:	85 c0                	test   %eax,%eax
+  801ede:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801ee3:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  801ee7:	44 89 e0             	mov    %r12d,%eax
+  801eea:	5b                   	pop    %rbx
+  801eeb:	41 5c                	pop    %r12
+  801eed:	5d                   	pop    %rbp
+  801eee:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801eef:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  801ef6:	00 00 00 
+  801ef9:	ff d0                	call   *%rax
+  801efb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f00:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  801f07:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801f0e:	00 00 00 
+  801f11:	48 01 d0             	add    %rdx,%rax
+  801f14:	48 a3 08 70 80 00 00 	movabs %rax,0x807008
+  801f1b:	00 00 00 
+        return 0;
+  801f1e:	eb c7                	jmp    801ee7 <fork+0x97>
+        return -1;
+  801f20:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801f26:	eb bf                	jmp    801ee7 <fork+0x97>
+  801f28:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801f2e:	eb b7                	jmp    801ee7 <fork+0x97>
+
+0000000000801f30 <sfork>:
+
+envid_t
+sfork() {
+  801f30:	55                   	push   %rbp
+  801f31:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801f34:	48 ba 26 56 80 00 00 	movabs $0x805626,%rdx
+  801f3b:	00 00 00 
+  801f3e:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801f43:	48 bf 41 56 80 00 00 	movabs $0x805641,%rdi
+  801f4a:	00 00 00 
+  801f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f52:	48 b9 12 02 80 00 00 	movabs $0x800212,%rcx
+  801f59:	00 00 00 
+  801f5c:	ff d1                	call   *%rcx
+
+0000000000801f5e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f5e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801f65:	ff ff ff 
+  801f68:	48 01 f8             	add    %rdi,%rax
+  801f6b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801f6f:	c3                   	ret
+
+0000000000801f70 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f70:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801f77:	ff ff ff 
+  801f7a:	48 01 f8             	add    %rdi,%rax
+  801f7d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801f81:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801f87:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801f8b:	c3                   	ret
+
+0000000000801f8c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801f8c:	55                   	push   %rbp
+  801f8d:	48 89 e5             	mov    %rsp,%rbp
+  801f90:	41 57                	push   %r15
+  801f92:	41 56                	push   %r14
+  801f94:	41 55                	push   %r13
+  801f96:	41 54                	push   %r12
+  801f98:	53                   	push   %rbx
+  801f99:	48 83 ec 08          	sub    $0x8,%rsp
+  801f9d:	49 89 ff             	mov    %rdi,%r15
+  801fa0:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801fa5:	49 bd 40 3e 80 00 00 	movabs $0x803e40,%r13
+  801fac:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801faf:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801fb5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801fb8:	48 89 df             	mov    %rbx,%rdi
+  801fbb:	41 ff d5             	call   *%r13
+  801fbe:	83 e0 04             	and    $0x4,%eax
+  801fc1:	74 17                	je     801fda <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801fc3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801fca:	4c 39 f3             	cmp    %r14,%rbx
+  801fcd:	75 e6                	jne    801fb5 <fd_alloc+0x29>
+  801fcf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801fd5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801fda:	4d 89 27             	mov    %r12,(%r15)
+}
+  801fdd:	48 83 c4 08          	add    $0x8,%rsp
+  801fe1:	5b                   	pop    %rbx
+  801fe2:	41 5c                	pop    %r12
+  801fe4:	41 5d                	pop    %r13
+  801fe6:	41 5e                	pop    %r14
+  801fe8:	41 5f                	pop    %r15
+  801fea:	5d                   	pop    %rbp
+  801feb:	c3                   	ret
+
+0000000000801fec <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801fec:	83 ff 1f             	cmp    $0x1f,%edi
+  801fef:	77 39                	ja     80202a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ff1:	55                   	push   %rbp
+  801ff2:	48 89 e5             	mov    %rsp,%rbp
+  801ff5:	41 54                	push   %r12
+  801ff7:	53                   	push   %rbx
+  801ff8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ffb:	48 63 df             	movslq %edi,%rbx
+  801ffe:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802005:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802009:	48 89 df             	mov    %rbx,%rdi
+  80200c:	48 b8 40 3e 80 00 00 	movabs $0x803e40,%rax
+  802013:	00 00 00 
+  802016:	ff d0                	call   *%rax
+  802018:	a8 04                	test   $0x4,%al
+  80201a:	74 14                	je     802030 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80201c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802020:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802025:	5b                   	pop    %rbx
+  802026:	41 5c                	pop    %r12
+  802028:	5d                   	pop    %rbp
+  802029:	c3                   	ret
+        return -E_INVAL;
+  80202a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80202f:	c3                   	ret
+        return -E_INVAL;
+  802030:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802035:	eb ee                	jmp    802025 <fd_lookup+0x39>
+
+0000000000802037 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802037:	55                   	push   %rbp
+  802038:	48 89 e5             	mov    %rsp,%rbp
+  80203b:	41 54                	push   %r12
+  80203d:	53                   	push   %rbx
+  80203e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802041:	48 b8 e0 56 80 00 00 	movabs $0x8056e0,%rax
+  802048:	00 00 00 
+  80204b:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802052:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802055:	39 3b                	cmp    %edi,(%rbx)
+  802057:	74 47                	je     8020a0 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802059:	48 83 c0 08          	add    $0x8,%rax
+  80205d:	48 8b 18             	mov    (%rax),%rbx
+  802060:	48 85 db             	test   %rbx,%rbx
+  802063:	75 f0                	jne    802055 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802065:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80206c:	00 00 00 
+  80206f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802075:	89 fa                	mov    %edi,%edx
+  802077:	48 bf 50 56 80 00 00 	movabs $0x805650,%rdi
+  80207e:	00 00 00 
+  802081:	b8 00 00 00 00       	mov    $0x0,%eax
+  802086:	48 b9 62 03 80 00 00 	movabs $0x800362,%rcx
+  80208d:	00 00 00 
+  802090:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802092:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802097:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80209b:	5b                   	pop    %rbx
+  80209c:	41 5c                	pop    %r12
+  80209e:	5d                   	pop    %rbp
+  80209f:	c3                   	ret
+            return 0;
+  8020a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a5:	eb f0                	jmp    802097 <dev_lookup+0x60>
+
+00000000008020a7 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8020a7:	55                   	push   %rbp
+  8020a8:	48 89 e5             	mov    %rsp,%rbp
+  8020ab:	41 55                	push   %r13
+  8020ad:	41 54                	push   %r12
+  8020af:	53                   	push   %rbx
+  8020b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8020b4:	48 89 fb             	mov    %rdi,%rbx
+  8020b7:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8020ba:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8020c1:	ff ff ff 
+  8020c4:	48 01 df             	add    %rbx,%rdi
+  8020c7:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8020cb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020cf:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8020d6:	00 00 00 
+  8020d9:	ff d0                	call   *%rax
+  8020db:	41 89 c5             	mov    %eax,%r13d
+  8020de:	85 c0                	test   %eax,%eax
+  8020e0:	78 06                	js     8020e8 <fd_close+0x41>
+  8020e2:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8020e6:	74 1a                	je     802102 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8020e8:	45 84 e4             	test   %r12b,%r12b
+  8020eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f0:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8020f4:	44 89 e8             	mov    %r13d,%eax
+  8020f7:	48 83 c4 18          	add    $0x18,%rsp
+  8020fb:	5b                   	pop    %rbx
+  8020fc:	41 5c                	pop    %r12
+  8020fe:	41 5d                	pop    %r13
+  802100:	5d                   	pop    %rbp
+  802101:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802102:	8b 3b                	mov    (%rbx),%edi
+  802104:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802108:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  80210f:	00 00 00 
+  802112:	ff d0                	call   *%rax
+  802114:	41 89 c5             	mov    %eax,%r13d
+  802117:	85 c0                	test   %eax,%eax
+  802119:	78 1b                	js     802136 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80211b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80211f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802123:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802129:	48 85 c0             	test   %rax,%rax
+  80212c:	74 08                	je     802136 <fd_close+0x8f>
+  80212e:	48 89 df             	mov    %rbx,%rdi
+  802131:	ff d0                	call   *%rax
+  802133:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802136:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80213b:	48 89 de             	mov    %rbx,%rsi
+  80213e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802143:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  80214a:	00 00 00 
+  80214d:	ff d0                	call   *%rax
+    return res;
+  80214f:	eb a3                	jmp    8020f4 <fd_close+0x4d>
+
+0000000000802151 <close>:
+
+int
+close(int fdnum) {
+  802151:	55                   	push   %rbp
+  802152:	48 89 e5             	mov    %rsp,%rbp
+  802155:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802159:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80215d:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  802164:	00 00 00 
+  802167:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802169:	85 c0                	test   %eax,%eax
+  80216b:	78 15                	js     802182 <close+0x31>
+
+    return fd_close(fd, 1);
+  80216d:	be 01 00 00 00       	mov    $0x1,%esi
+  802172:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802176:	48 b8 a7 20 80 00 00 	movabs $0x8020a7,%rax
+  80217d:	00 00 00 
+  802180:	ff d0                	call   *%rax
+}
+  802182:	c9                   	leave
+  802183:	c3                   	ret
+
+0000000000802184 <close_all>:
+
+void
+close_all(void) {
+  802184:	55                   	push   %rbp
+  802185:	48 89 e5             	mov    %rsp,%rbp
+  802188:	41 54                	push   %r12
+  80218a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80218b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802190:	49 bc 51 21 80 00 00 	movabs $0x802151,%r12
+  802197:	00 00 00 
+  80219a:	89 df                	mov    %ebx,%edi
+  80219c:	41 ff d4             	call   *%r12
+  80219f:	83 c3 01             	add    $0x1,%ebx
+  8021a2:	83 fb 20             	cmp    $0x20,%ebx
+  8021a5:	75 f3                	jne    80219a <close_all+0x16>
+}
+  8021a7:	5b                   	pop    %rbx
+  8021a8:	41 5c                	pop    %r12
+  8021aa:	5d                   	pop    %rbp
+  8021ab:	c3                   	ret
+
+00000000008021ac <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8021ac:	55                   	push   %rbp
+  8021ad:	48 89 e5             	mov    %rsp,%rbp
+  8021b0:	41 57                	push   %r15
+  8021b2:	41 56                	push   %r14
+  8021b4:	41 55                	push   %r13
+  8021b6:	41 54                	push   %r12
+  8021b8:	53                   	push   %rbx
+  8021b9:	48 83 ec 18          	sub    $0x18,%rsp
+  8021bd:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8021c0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8021c4:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8021cb:	00 00 00 
+  8021ce:	ff d0                	call   *%rax
+  8021d0:	89 c3                	mov    %eax,%ebx
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	0f 88 b8 00 00 00    	js     802292 <dup+0xe6>
+    close(newfdnum);
+  8021da:	44 89 e7             	mov    %r12d,%edi
+  8021dd:	48 b8 51 21 80 00 00 	movabs $0x802151,%rax
+  8021e4:	00 00 00 
+  8021e7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8021e9:	4d 63 ec             	movslq %r12d,%r13
+  8021ec:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8021f3:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8021f7:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8021fb:	4c 89 ff             	mov    %r15,%rdi
+  8021fe:	49 be 70 1f 80 00 00 	movabs $0x801f70,%r14
+  802205:	00 00 00 
+  802208:	41 ff d6             	call   *%r14
+  80220b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80220e:	4c 89 ef             	mov    %r13,%rdi
+  802211:	41 ff d6             	call   *%r14
+  802214:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802217:	48 89 df             	mov    %rbx,%rdi
+  80221a:	48 b8 40 3e 80 00 00 	movabs $0x803e40,%rax
+  802221:	00 00 00 
+  802224:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802226:	a8 04                	test   $0x4,%al
+  802228:	74 2b                	je     802255 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80222a:	41 89 c1             	mov    %eax,%r9d
+  80222d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802233:	4c 89 f1             	mov    %r14,%rcx
+  802236:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223b:	48 89 de             	mov    %rbx,%rsi
+  80223e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802243:	48 b8 a1 14 80 00 00 	movabs $0x8014a1,%rax
+  80224a:	00 00 00 
+  80224d:	ff d0                	call   *%rax
+  80224f:	89 c3                	mov    %eax,%ebx
+  802251:	85 c0                	test   %eax,%eax
+  802253:	78 4e                	js     8022a3 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802255:	4c 89 ff             	mov    %r15,%rdi
+  802258:	48 b8 40 3e 80 00 00 	movabs $0x803e40,%rax
+  80225f:	00 00 00 
+  802262:	ff d0                	call   *%rax
+  802264:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802267:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80226d:	4c 89 e9             	mov    %r13,%rcx
+  802270:	ba 00 00 00 00       	mov    $0x0,%edx
+  802275:	4c 89 fe             	mov    %r15,%rsi
+  802278:	bf 00 00 00 00       	mov    $0x0,%edi
+  80227d:	48 b8 a1 14 80 00 00 	movabs $0x8014a1,%rax
+  802284:	00 00 00 
+  802287:	ff d0                	call   *%rax
+  802289:	89 c3                	mov    %eax,%ebx
+  80228b:	85 c0                	test   %eax,%eax
+  80228d:	78 14                	js     8022a3 <dup+0xf7>
+
+    return newfdnum;
+  80228f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802292:	89 d8                	mov    %ebx,%eax
+  802294:	48 83 c4 18          	add    $0x18,%rsp
+  802298:	5b                   	pop    %rbx
+  802299:	41 5c                	pop    %r12
+  80229b:	41 5d                	pop    %r13
+  80229d:	41 5e                	pop    %r14
+  80229f:	41 5f                	pop    %r15
+  8022a1:	5d                   	pop    %rbp
+  8022a2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8022a3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022a8:	4c 89 ee             	mov    %r13,%rsi
+  8022ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b0:	49 bc 19 16 80 00 00 	movabs $0x801619,%r12
+  8022b7:	00 00 00 
+  8022ba:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8022bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022c2:	4c 89 f6             	mov    %r14,%rsi
+  8022c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ca:	41 ff d4             	call   *%r12
+    return res;
+  8022cd:	eb c3                	jmp    802292 <dup+0xe6>
+
+00000000008022cf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8022cf:	55                   	push   %rbp
+  8022d0:	48 89 e5             	mov    %rsp,%rbp
+  8022d3:	41 56                	push   %r14
+  8022d5:	41 55                	push   %r13
+  8022d7:	41 54                	push   %r12
+  8022d9:	53                   	push   %rbx
+  8022da:	48 83 ec 10          	sub    $0x10,%rsp
+  8022de:	89 fb                	mov    %edi,%ebx
+  8022e0:	49 89 f4             	mov    %rsi,%r12
+  8022e3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022e6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022ea:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8022f1:	00 00 00 
+  8022f4:	ff d0                	call   *%rax
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	78 4c                	js     802346 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022fa:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8022fe:	41 8b 3e             	mov    (%r14),%edi
+  802301:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802305:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  80230c:	00 00 00 
+  80230f:	ff d0                	call   *%rax
+  802311:	85 c0                	test   %eax,%eax
+  802313:	78 35                	js     80234a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802315:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802319:	83 e0 03             	and    $0x3,%eax
+  80231c:	83 f8 01             	cmp    $0x1,%eax
+  80231f:	74 2d                	je     80234e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802321:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802325:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802329:	48 85 c0             	test   %rax,%rax
+  80232c:	74 56                	je     802384 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80232e:	4c 89 ea             	mov    %r13,%rdx
+  802331:	4c 89 e6             	mov    %r12,%rsi
+  802334:	4c 89 f7             	mov    %r14,%rdi
+  802337:	ff d0                	call   *%rax
+}
+  802339:	48 83 c4 10          	add    $0x10,%rsp
+  80233d:	5b                   	pop    %rbx
+  80233e:	41 5c                	pop    %r12
+  802340:	41 5d                	pop    %r13
+  802342:	41 5e                	pop    %r14
+  802344:	5d                   	pop    %rbp
+  802345:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802346:	48 98                	cltq
+  802348:	eb ef                	jmp    802339 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80234a:	48 98                	cltq
+  80234c:	eb eb                	jmp    802339 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80234e:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  802355:	00 00 00 
+  802358:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80235e:	89 da                	mov    %ebx,%edx
+  802360:	48 bf 91 56 80 00 00 	movabs $0x805691,%rdi
+  802367:	00 00 00 
+  80236a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236f:	48 b9 62 03 80 00 00 	movabs $0x800362,%rcx
+  802376:	00 00 00 
+  802379:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80237b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802382:	eb b5                	jmp    802339 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802384:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80238b:	eb ac                	jmp    802339 <read+0x6a>
+
+000000000080238d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80238d:	55                   	push   %rbp
+  80238e:	48 89 e5             	mov    %rsp,%rbp
+  802391:	41 57                	push   %r15
+  802393:	41 56                	push   %r14
+  802395:	41 55                	push   %r13
+  802397:	41 54                	push   %r12
+  802399:	53                   	push   %rbx
+  80239a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80239e:	48 85 d2             	test   %rdx,%rdx
+  8023a1:	74 54                	je     8023f7 <readn+0x6a>
+  8023a3:	41 89 fd             	mov    %edi,%r13d
+  8023a6:	49 89 f6             	mov    %rsi,%r14
+  8023a9:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8023ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8023b1:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8023b6:	49 bf cf 22 80 00 00 	movabs $0x8022cf,%r15
+  8023bd:	00 00 00 
+  8023c0:	4c 89 e2             	mov    %r12,%rdx
+  8023c3:	48 29 f2             	sub    %rsi,%rdx
+  8023c6:	4c 01 f6             	add    %r14,%rsi
+  8023c9:	44 89 ef             	mov    %r13d,%edi
+  8023cc:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8023cf:	85 c0                	test   %eax,%eax
+  8023d1:	78 20                	js     8023f3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8023d3:	01 c3                	add    %eax,%ebx
+  8023d5:	85 c0                	test   %eax,%eax
+  8023d7:	74 08                	je     8023e1 <readn+0x54>
+  8023d9:	48 63 f3             	movslq %ebx,%rsi
+  8023dc:	4c 39 e6             	cmp    %r12,%rsi
+  8023df:	72 df                	jb     8023c0 <readn+0x33>
+    }
+    return res;
+  8023e1:	48 63 c3             	movslq %ebx,%rax
+}
+  8023e4:	48 83 c4 08          	add    $0x8,%rsp
+  8023e8:	5b                   	pop    %rbx
+  8023e9:	41 5c                	pop    %r12
+  8023eb:	41 5d                	pop    %r13
+  8023ed:	41 5e                	pop    %r14
+  8023ef:	41 5f                	pop    %r15
+  8023f1:	5d                   	pop    %rbp
+  8023f2:	c3                   	ret
+        if (inc < 0) return inc;
+  8023f3:	48 98                	cltq
+  8023f5:	eb ed                	jmp    8023e4 <readn+0x57>
+    int inc = 1, res = 0;
+  8023f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023fc:	eb e3                	jmp    8023e1 <readn+0x54>
+
+00000000008023fe <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8023fe:	55                   	push   %rbp
+  8023ff:	48 89 e5             	mov    %rsp,%rbp
+  802402:	41 56                	push   %r14
+  802404:	41 55                	push   %r13
+  802406:	41 54                	push   %r12
+  802408:	53                   	push   %rbx
+  802409:	48 83 ec 10          	sub    $0x10,%rsp
+  80240d:	89 fb                	mov    %edi,%ebx
+  80240f:	49 89 f4             	mov    %rsi,%r12
+  802412:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802415:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802419:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  802420:	00 00 00 
+  802423:	ff d0                	call   *%rax
+  802425:	85 c0                	test   %eax,%eax
+  802427:	78 47                	js     802470 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802429:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80242d:	41 8b 3e             	mov    (%r14),%edi
+  802430:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802434:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  80243b:	00 00 00 
+  80243e:	ff d0                	call   *%rax
+  802440:	85 c0                	test   %eax,%eax
+  802442:	78 30                	js     802474 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802444:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802449:	74 2d                	je     802478 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80244b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80244f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802453:	48 85 c0             	test   %rax,%rax
+  802456:	74 56                	je     8024ae <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802458:	4c 89 ea             	mov    %r13,%rdx
+  80245b:	4c 89 e6             	mov    %r12,%rsi
+  80245e:	4c 89 f7             	mov    %r14,%rdi
+  802461:	ff d0                	call   *%rax
+}
+  802463:	48 83 c4 10          	add    $0x10,%rsp
+  802467:	5b                   	pop    %rbx
+  802468:	41 5c                	pop    %r12
+  80246a:	41 5d                	pop    %r13
+  80246c:	41 5e                	pop    %r14
+  80246e:	5d                   	pop    %rbp
+  80246f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802470:	48 98                	cltq
+  802472:	eb ef                	jmp    802463 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802474:	48 98                	cltq
+  802476:	eb eb                	jmp    802463 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802478:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80247f:	00 00 00 
+  802482:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802488:	89 da                	mov    %ebx,%edx
+  80248a:	48 bf ad 56 80 00 00 	movabs $0x8056ad,%rdi
+  802491:	00 00 00 
+  802494:	b8 00 00 00 00       	mov    $0x0,%eax
+  802499:	48 b9 62 03 80 00 00 	movabs $0x800362,%rcx
+  8024a0:	00 00 00 
+  8024a3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8024a5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8024ac:	eb b5                	jmp    802463 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8024ae:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8024b5:	eb ac                	jmp    802463 <write+0x65>
+
+00000000008024b7 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8024b7:	55                   	push   %rbp
+  8024b8:	48 89 e5             	mov    %rsp,%rbp
+  8024bb:	53                   	push   %rbx
+  8024bc:	48 83 ec 18          	sub    $0x18,%rsp
+  8024c0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024c2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024c6:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8024cd:	00 00 00 
+  8024d0:	ff d0                	call   *%rax
+  8024d2:	85 c0                	test   %eax,%eax
+  8024d4:	78 0c                	js     8024e2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8024d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024da:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8024dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024e6:	c9                   	leave
+  8024e7:	c3                   	ret
+
+00000000008024e8 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8024e8:	55                   	push   %rbp
+  8024e9:	48 89 e5             	mov    %rsp,%rbp
+  8024ec:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8024f0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024f4:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8024fb:	00 00 00 
+  8024fe:	ff d0                	call   *%rax
+  802500:	85 c0                	test   %eax,%eax
+  802502:	78 07                	js     80250b <tell+0x23>
+    return fdes->fd_offset;
+  802504:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802508:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80250b:	c9                   	leave
+  80250c:	c3                   	ret
+
+000000000080250d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80250d:	55                   	push   %rbp
+  80250e:	48 89 e5             	mov    %rsp,%rbp
+  802511:	41 55                	push   %r13
+  802513:	41 54                	push   %r12
+  802515:	53                   	push   %rbx
+  802516:	48 83 ec 18          	sub    $0x18,%rsp
+  80251a:	89 fb                	mov    %edi,%ebx
+  80251c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80251f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802523:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  80252a:	00 00 00 
+  80252d:	ff d0                	call   *%rax
+  80252f:	85 c0                	test   %eax,%eax
+  802531:	78 38                	js     80256b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802533:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802537:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80253b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80253f:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  802546:	00 00 00 
+  802549:	ff d0                	call   *%rax
+  80254b:	85 c0                	test   %eax,%eax
+  80254d:	78 1c                	js     80256b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80254f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802554:	74 20                	je     802576 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802556:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80255a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80255e:	48 85 c0             	test   %rax,%rax
+  802561:	74 47                	je     8025aa <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802563:	44 89 e6             	mov    %r12d,%esi
+  802566:	4c 89 ef             	mov    %r13,%rdi
+  802569:	ff d0                	call   *%rax
+}
+  80256b:	48 83 c4 18          	add    $0x18,%rsp
+  80256f:	5b                   	pop    %rbx
+  802570:	41 5c                	pop    %r12
+  802572:	41 5d                	pop    %r13
+  802574:	5d                   	pop    %rbp
+  802575:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802576:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80257d:	00 00 00 
+  802580:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802586:	89 da                	mov    %ebx,%edx
+  802588:	48 bf 70 56 80 00 00 	movabs $0x805670,%rdi
+  80258f:	00 00 00 
+  802592:	b8 00 00 00 00       	mov    $0x0,%eax
+  802597:	48 b9 62 03 80 00 00 	movabs $0x800362,%rcx
+  80259e:	00 00 00 
+  8025a1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8025a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025a8:	eb c1                	jmp    80256b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8025aa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8025af:	eb ba                	jmp    80256b <ftruncate+0x5e>
+
+00000000008025b1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8025b1:	55                   	push   %rbp
+  8025b2:	48 89 e5             	mov    %rsp,%rbp
+  8025b5:	41 54                	push   %r12
+  8025b7:	53                   	push   %rbx
+  8025b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8025bc:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025bf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025c3:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8025ca:	00 00 00 
+  8025cd:	ff d0                	call   *%rax
+  8025cf:	85 c0                	test   %eax,%eax
+  8025d1:	78 4e                	js     802621 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025d3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8025d7:	41 8b 3c 24          	mov    (%r12),%edi
+  8025db:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8025df:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  8025e6:	00 00 00 
+  8025e9:	ff d0                	call   *%rax
+  8025eb:	85 c0                	test   %eax,%eax
+  8025ed:	78 32                	js     802621 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8025ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8025f3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8025f8:	74 30                	je     80262a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8025fa:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8025fd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802604:	00 00 00 
+    stat->st_isdir = 0;
+  802607:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80260e:	00 00 00 
+    stat->st_dev = dev;
+  802611:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802618:	48 89 de             	mov    %rbx,%rsi
+  80261b:	4c 89 e7             	mov    %r12,%rdi
+  80261e:	ff 50 28             	call   *0x28(%rax)
+}
+  802621:	48 83 c4 10          	add    $0x10,%rsp
+  802625:	5b                   	pop    %rbx
+  802626:	41 5c                	pop    %r12
+  802628:	5d                   	pop    %rbp
+  802629:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80262a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80262f:	eb f0                	jmp    802621 <fstat+0x70>
+
+0000000000802631 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802631:	55                   	push   %rbp
+  802632:	48 89 e5             	mov    %rsp,%rbp
+  802635:	41 54                	push   %r12
+  802637:	53                   	push   %rbx
+  802638:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  80263f:	41 89 fc             	mov    %edi,%r12d
+  802642:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802644:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802648:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+  802654:	85 c0                	test   %eax,%eax
+  802656:	78 31                	js     802689 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802658:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80265f:	44 89 e7             	mov    %r12d,%edi
+  802662:	48 b8 b1 25 80 00 00 	movabs $0x8025b1,%rax
+  802669:	00 00 00 
+  80266c:	ff d0                	call   *%rax
+  80266e:	85 c0                	test   %eax,%eax
+  802670:	78 17                	js     802689 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802672:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802676:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802679:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80267c:	39 d3                	cmp    %edx,%ebx
+  80267e:	0f 4f da             	cmovg  %edx,%ebx
+  802681:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802684:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802689:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802690:	5b                   	pop    %rbx
+  802691:	41 5c                	pop    %r12
+  802693:	5d                   	pop    %rbp
+  802694:	c3                   	ret
+
+0000000000802695 <seektoend>:
+{
+  802695:	55                   	push   %rbp
+  802696:	48 89 e5             	mov    %rsp,%rbp
+  802699:	53                   	push   %rbx
+  80269a:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8026a1:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8026a3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8026a7:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8026ae:	00 00 00 
+  8026b1:	ff d0                	call   *%rax
+  8026b3:	85 c0                	test   %eax,%eax
+  8026b5:	78 28                	js     8026df <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8026b7:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8026be:	89 df                	mov    %ebx,%edi
+  8026c0:	48 b8 b1 25 80 00 00 	movabs $0x8025b1,%rax
+  8026c7:	00 00 00 
+  8026ca:	ff d0                	call   *%rax
+  8026cc:	85 c0                	test   %eax,%eax
+  8026ce:	78 0f                	js     8026df <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8026d0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8026d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026d7:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8026da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026e3:	c9                   	leave
+  8026e4:	c3                   	ret
+
+00000000008026e5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8026e5:	55                   	push   %rbp
+  8026e6:	48 89 e5             	mov    %rsp,%rbp
+  8026e9:	41 54                	push   %r12
+  8026eb:	53                   	push   %rbx
+  8026ec:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8026ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f4:	48 b8 d8 32 80 00 00 	movabs $0x8032d8,%rax
+  8026fb:	00 00 00 
+  8026fe:	ff d0                	call   *%rax
+  802700:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802702:	85 c0                	test   %eax,%eax
+  802704:	78 25                	js     80272b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802706:	4c 89 e6             	mov    %r12,%rsi
+  802709:	89 c7                	mov    %eax,%edi
+  80270b:	48 b8 b1 25 80 00 00 	movabs $0x8025b1,%rax
+  802712:	00 00 00 
+  802715:	ff d0                	call   *%rax
+  802717:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80271a:	89 df                	mov    %ebx,%edi
+  80271c:	48 b8 51 21 80 00 00 	movabs $0x802151,%rax
+  802723:	00 00 00 
+  802726:	ff d0                	call   *%rax
+
+    return res;
+  802728:	44 89 e3             	mov    %r12d,%ebx
+}
+  80272b:	89 d8                	mov    %ebx,%eax
+  80272d:	5b                   	pop    %rbx
+  80272e:	41 5c                	pop    %r12
+  802730:	5d                   	pop    %rbp
+  802731:	c3                   	ret
+
+0000000000802732 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802732:	55                   	push   %rbp
+  802733:	48 89 e5             	mov    %rsp,%rbp
+  802736:	53                   	push   %rbx
+  802737:	48 83 ec 08          	sub    $0x8,%rsp
+  80273b:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80273e:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  802745:	00 00 00 
+  802748:	ff d0                	call   *%rax
+  80274a:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80274e:	0f 87 ea 00 00 00    	ja     80283e <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802754:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80275b:	00 00 00 
+  80275e:	80 38 00             	cmpb   $0x0,(%rax)
+  802761:	75 35                	jne    802798 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802763:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802768:	ba 00 00 22 00       	mov    $0x220000,%edx
+  80276d:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802772:	bf 00 00 00 00       	mov    $0x0,%edi
+  802777:	48 b8 3a 14 80 00 00 	movabs $0x80143a,%rax
+  80277e:	00 00 00 
+  802781:	ff d0                	call   *%rax
+  802783:	85 c0                	test   %eax,%eax
+  802785:	0f 88 ba 00 00 00    	js     802845 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80278b:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802792:	00 00 00 
+  802795:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802798:	48 89 df             	mov    %rbx,%rdi
+  80279b:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  8027a2:	00 00 00 
+  8027a5:	ff d0                	call   *%rax
+  8027a7:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8027ab:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8027b2:	00 00 00 
+  8027b5:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8027b9:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8027bc:	39 39                	cmp    %edi,(%rcx)
+  8027be:	74 46                	je     802806 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8027c0:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8027c4:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8027cb:	00 
+  8027cc:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8027d3:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8027da:	00 
+  8027db:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8027e2:	00 
+  8027e3:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8027ea:	00 
+  8027eb:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8027f2:	00 
+  8027f3:	89 39                	mov    %edi,(%rcx)
+  8027f5:	48 01 c6             	add    %rax,%rsi
+  8027f8:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8027fd:	48 89 c8             	mov    %rcx,%rax
+  802800:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802804:	c9                   	leave
+  802805:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802806:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80280a:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802811:	00 00 00 
+  802814:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802817:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80281b:	74 e0                	je     8027fd <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  80281d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802824:	00 
+  802825:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802829:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802830:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802832:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802835:	48 01 c2             	add    %rax,%rdx
+  802838:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  80283c:	eb bf                	jmp    8027fd <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80283e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802843:	eb b8                	jmp    8027fd <fbuf_get+0xcb>
+            return NULL;
+  802845:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80284a:	eb b1                	jmp    8027fd <fbuf_get+0xcb>
+
+000000000080284c <fsipc_bulk>:
+fsipc_bulk(void) {
+  80284c:	55                   	push   %rbp
+  80284d:	48 89 e5             	mov    %rsp,%rbp
+  802850:	53                   	push   %rbx
+  802851:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802855:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  80285c:	00 00 00 
+  80285f:	48 8b 18             	mov    (%rax),%rbx
+  802862:	48 85 db             	test   %rbx,%rbx
+  802865:	74 16                	je     80287d <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802867:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  80286e:	00 00 00 
+  802871:	48 8b 18             	mov    (%rax),%rbx
+}
+  802874:	48 89 d8             	mov    %rbx,%rax
+  802877:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80287b:	c9                   	leave
+  80287c:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  80287d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802882:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802887:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  80288c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802891:	48 b8 3a 14 80 00 00 	movabs $0x80143a,%rax
+  802898:	00 00 00 
+  80289b:	ff d0                	call   *%rax
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	78 d3                	js     802874 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8028a1:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8028a6:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8028ad:	00 00 00 
+  8028b0:	eb b5                	jmp    802867 <fsipc_bulk+0x1b>
+
+00000000008028b2 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8028b2:	55                   	push   %rbp
+  8028b3:	48 89 e5             	mov    %rsp,%rbp
+  8028b6:	41 57                	push   %r15
+  8028b8:	41 56                	push   %r14
+  8028ba:	41 55                	push   %r13
+  8028bc:	41 54                	push   %r12
+  8028be:	53                   	push   %rbx
+  8028bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c3:	41 89 fd             	mov    %edi,%r13d
+  8028c6:	49 89 f6             	mov    %rsi,%r14
+  8028c9:	49 89 d7             	mov    %rdx,%r15
+  8028cc:	48 89 cb             	mov    %rcx,%rbx
+  8028cf:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028d2:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8028d9:	00 00 00 
+  8028dc:	83 38 00             	cmpl   $0x0,(%rax)
+  8028df:	74 52                	je     802933 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  8028e1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8028e7:	4c 89 f9             	mov    %r15,%rcx
+  8028ea:	4c 89 f2             	mov    %r14,%rdx
+  8028ed:	44 89 ee             	mov    %r13d,%esi
+  8028f0:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8028f7:	00 00 00 
+  8028fa:	8b 38                	mov    (%rax),%edi
+  8028fc:	48 b8 97 43 80 00 00 	movabs $0x804397,%rax
+  802903:	00 00 00 
+  802906:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802908:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80290d:	4c 89 e2             	mov    %r12,%rdx
+  802910:	48 89 de             	mov    %rbx,%rsi
+  802913:	bf 00 00 00 00       	mov    $0x0,%edi
+  802918:	48 b8 e7 41 80 00 00 	movabs $0x8041e7,%rax
+  80291f:	00 00 00 
+  802922:	ff d0                	call   *%rax
+}
+  802924:	48 83 c4 08          	add    $0x8,%rsp
+  802928:	5b                   	pop    %rbx
+  802929:	41 5c                	pop    %r12
+  80292b:	41 5d                	pop    %r13
+  80292d:	41 5e                	pop    %r14
+  80292f:	41 5f                	pop    %r15
+  802931:	5d                   	pop    %rbp
+  802932:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802933:	bf 03 00 00 00       	mov    $0x3,%edi
+  802938:	48 b8 3a 44 80 00 00 	movabs $0x80443a,%rax
+  80293f:	00 00 00 
+  802942:	ff d0                	call   *%rax
+  802944:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  80294b:	00 00 
+  80294d:	eb 92                	jmp    8028e1 <fsipc_region+0x2f>
+
+000000000080294f <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80294f:	55                   	push   %rbp
+  802950:	48 89 e5             	mov    %rsp,%rbp
+  802953:	41 57                	push   %r15
+  802955:	41 56                	push   %r14
+  802957:	41 55                	push   %r13
+  802959:	41 54                	push   %r12
+  80295b:	53                   	push   %rbx
+  80295c:	48 83 ec 28          	sub    $0x28,%rsp
+  802960:	49 89 ff             	mov    %rdi,%r15
+  802963:	49 89 f6             	mov    %rsi,%r14
+  802966:	48 89 d3             	mov    %rdx,%rbx
+  802969:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80296d:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802970:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  802977:	00 00 00 
+  80297a:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  80297c:	48 85 c0             	test   %rax,%rax
+  80297f:	0f 84 cc 00 00 00    	je     802a51 <devfile_write_direct+0x102>
+  802985:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802988:	48 85 db             	test   %rbx,%rbx
+  80298b:	0f 84 ba 00 00 00    	je     802a4b <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802991:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802997:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80299e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8029a2:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8029a6:	4c 29 e3             	sub    %r12,%rbx
+  8029a9:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8029ae:	48 39 c3             	cmp    %rax,%rbx
+  8029b1:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8029b5:	48 89 da             	mov    %rbx,%rdx
+  8029b8:	4c 89 f6             	mov    %r14,%rsi
+  8029bb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8029bf:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  8029c6:	00 00 00 
+  8029c9:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8029cb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8029cf:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  8029d3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8029d6:	44 01 e0             	add    %r12d,%eax
+  8029d9:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  8029dd:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  8029e1:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  8029e8:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8029ef:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  8029f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a01:	4c 89 ee             	mov    %r13,%rsi
+  802a04:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a09:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  802a10:	00 00 00 
+  802a13:	ff d0                	call   *%rax
+        if (res < 0)
+  802a15:	85 c0                	test   %eax,%eax
+  802a17:	78 29                	js     802a42 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802a19:	74 2b                	je     802a46 <devfile_write_direct+0xf7>
+        i += res;
+  802a1b:	48 98                	cltq
+  802a1d:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802a20:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802a23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a27:	49 39 c4             	cmp    %rax,%r12
+  802a2a:	0f 82 72 ff ff ff    	jb     8029a2 <devfile_write_direct+0x53>
+    return i;
+  802a30:	4c 89 e0             	mov    %r12,%rax
+}
+  802a33:	48 83 c4 28          	add    $0x28,%rsp
+  802a37:	5b                   	pop    %rbx
+  802a38:	41 5c                	pop    %r12
+  802a3a:	41 5d                	pop    %r13
+  802a3c:	41 5e                	pop    %r14
+  802a3e:	41 5f                	pop    %r15
+  802a40:	5d                   	pop    %rbp
+  802a41:	c3                   	ret
+            return res;
+  802a42:	48 98                	cltq
+  802a44:	eb ed                	jmp    802a33 <devfile_write_direct+0xe4>
+            return i;
+  802a46:	4c 89 e0             	mov    %r12,%rax
+  802a49:	eb e8                	jmp    802a33 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802a4b:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802a4f:	eb df                	jmp    802a30 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802a51:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802a58:	eb d9                	jmp    802a33 <devfile_write_direct+0xe4>
+
+0000000000802a5a <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802a5a:	55                   	push   %rbp
+  802a5b:	48 89 e5             	mov    %rsp,%rbp
+  802a5e:	41 56                	push   %r14
+  802a60:	41 55                	push   %r13
+  802a62:	41 54                	push   %r12
+  802a64:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802a65:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802a69:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a72:	4d 39 ee             	cmp    %r13,%r14
+  802a75:	0f 84 99 00 00 00    	je     802b14 <fbuf_flush+0xba>
+  802a7b:	49 89 fc             	mov    %rdi,%r12
+  802a7e:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802a81:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802a84:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802a88:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+  802a94:	48 89 c2             	mov    %rax,%rdx
+  802a97:	48 c1 e2 04          	shl    $0x4,%rdx
+  802a9b:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802a9f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802aa3:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802aa8:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802aab:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802aaf:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802ab6:	00 
+  802ab7:	44 89 f1             	mov    %r14d,%ecx
+  802aba:	4c 89 ea             	mov    %r13,%rdx
+  802abd:	4c 89 e7             	mov    %r12,%rdi
+  802ac0:	48 b8 4f 29 80 00 00 	movabs $0x80294f,%rax
+  802ac7:	00 00 00 
+  802aca:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802acc:	48 85 c0             	test   %rax,%rax
+  802acf:	78 43                	js     802b14 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802ad1:	4c 39 e8             	cmp    %r13,%rax
+  802ad4:	72 47                	jb     802b1d <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802ad6:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802adb:	83 c0 01             	add    $0x1,%eax
+  802ade:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ae3:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802ae6:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802aea:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802aee:	72 0f                	jb     802aff <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802af0:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802af4:	48 39 c2             	cmp    %rax,%rdx
+  802af7:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802afb:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802aff:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802b06:	00 
+  802b07:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802b0e:	00 
+    return 0;
+  802b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b14:	5b                   	pop    %rbx
+  802b15:	41 5c                	pop    %r12
+  802b17:	41 5d                	pop    %r13
+  802b19:	41 5e                	pop    %r14
+  802b1b:	5d                   	pop    %rbp
+  802b1c:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802b1d:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802b22:	eb f0                	jmp    802b14 <fbuf_flush+0xba>
+
+0000000000802b24 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802b24:	55                   	push   %rbp
+  802b25:	48 89 e5             	mov    %rsp,%rbp
+  802b28:	53                   	push   %rbx
+  802b29:	48 83 ec 08          	sub    $0x8,%rsp
+  802b2d:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802b30:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  802b37:	00 00 00 
+  802b3a:	ff d0                	call   *%rax
+  802b3c:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b44:	48 85 f6             	test   %rsi,%rsi
+  802b47:	74 0f                	je     802b58 <devfile_sync+0x34>
+  802b49:	48 89 df             	mov    %rbx,%rdi
+  802b4c:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802b53:	00 00 00 
+  802b56:	ff d0                	call   *%rax
+}
+  802b58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b5c:	c9                   	leave
+  802b5d:	c3                   	ret
+
+0000000000802b5e <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802b5e:	55                   	push   %rbp
+  802b5f:	48 89 e5             	mov    %rsp,%rbp
+  802b62:	48 83 ec 10          	sub    $0x10,%rsp
+  802b66:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802b69:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802b70:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802b71:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802b75:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b7a:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802b81:	00 00 00 
+  802b84:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  802b8b:	00 00 00 
+  802b8e:	ff d0                	call   *%rax
+}
+  802b90:	c9                   	leave
+  802b91:	c3                   	ret
+
+0000000000802b92 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802b92:	55                   	push   %rbp
+  802b93:	48 89 e5             	mov    %rsp,%rbp
+  802b96:	41 54                	push   %r12
+  802b98:	53                   	push   %rbx
+  802b99:	48 89 fb             	mov    %rdi,%rbx
+  802b9c:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802b9f:	48 b8 24 2b 80 00 00 	movabs $0x802b24,%rax
+  802ba6:	00 00 00 
+  802ba9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bab:	85 c0                	test   %eax,%eax
+  802bad:	78 63                	js     802c12 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802baf:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802bb2:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802bb9:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802bbb:	be 00 00 00 00       	mov    $0x0,%esi
+  802bc0:	bf 05 00 00 00       	mov    $0x5,%edi
+  802bc5:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bd1:	85 c0                	test   %eax,%eax
+  802bd3:	78 3d                	js     802c12 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802bd5:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802bdc:	00 00 00 
+  802bdf:	48 89 de             	mov    %rbx,%rsi
+  802be2:	4c 89 e7             	mov    %r12,%rdi
+  802be5:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  802bec:	00 00 00 
+  802bef:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802bf1:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802bf7:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802bfe:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802bff:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802c05:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802c0c:	00 
+
+    return 0;
+  802c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c12:	5b                   	pop    %rbx
+  802c13:	41 5c                	pop    %r12
+  802c15:	5d                   	pop    %rbp
+  802c16:	c3                   	ret
+
+0000000000802c17 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802c17:	55                   	push   %rbp
+  802c18:	48 89 e5             	mov    %rsp,%rbp
+  802c1b:	41 54                	push   %r12
+  802c1d:	53                   	push   %rbx
+  802c1e:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802c21:	48 b8 24 2b 80 00 00 	movabs $0x802b24,%rax
+  802c28:	00 00 00 
+  802c2b:	ff d0                	call   *%rax
+  802c2d:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802c30:	48 89 df             	mov    %rbx,%rdi
+  802c33:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  802c3a:	00 00 00 
+  802c3d:	ff d0                	call   *%rax
+  802c3f:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802c43:	76 2e                	jbe    802c73 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802c45:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c48:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802c4f:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802c51:	be 00 00 00 00       	mov    $0x0,%esi
+  802c56:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802c5b:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  802c62:	00 00 00 
+  802c65:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802c67:	45 85 e4             	test   %r12d,%r12d
+  802c6a:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802c6e:	5b                   	pop    %rbx
+  802c6f:	41 5c                	pop    %r12
+  802c71:	5d                   	pop    %rbp
+  802c72:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802c73:	48 89 df             	mov    %rbx,%rdi
+  802c76:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  802c7d:	00 00 00 
+  802c80:	ff d0                	call   *%rax
+  802c82:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802c86:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802c8d:	00 00 00 
+  802c90:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802c97:	48 89 df             	mov    %rbx,%rdi
+  802c9a:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  802ca1:	00 00 00 
+  802ca4:	ff d0                	call   *%rax
+  802ca6:	48 89 c6             	mov    %rax,%rsi
+  802ca9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cae:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb3:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  802cba:	00 00 00 
+  802cbd:	ff d0                	call   *%rax
+  802cbf:	eb 84                	jmp    802c45 <devfile_flush+0x2e>
+
+0000000000802cc1 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802cc1:	55                   	push   %rbp
+  802cc2:	48 89 e5             	mov    %rsp,%rbp
+  802cc5:	41 55                	push   %r13
+  802cc7:	41 54                	push   %r12
+  802cc9:	53                   	push   %rbx
+  802cca:	48 83 ec 08          	sub    $0x8,%rsp
+  802cce:	48 89 fb             	mov    %rdi,%rbx
+  802cd1:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802cd4:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  802cdb:	00 00 00 
+  802cde:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ce0:	48 85 c0             	test   %rax,%rax
+  802ce3:	74 51                	je     802d36 <devfile_trunc+0x75>
+  802ce5:	49 89 c4             	mov    %rax,%r12
+  802ce8:	48 89 c6             	mov    %rax,%rsi
+  802ceb:	48 89 df             	mov    %rbx,%rdi
+  802cee:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802cf5:	00 00 00 
+  802cf8:	ff d0                	call   *%rax
+  802cfa:	85 c0                	test   %eax,%eax
+  802cfc:	78 2d                	js     802d2b <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802cfe:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802d05:	00 00 00 
+  802d08:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802d0b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802d0d:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802d11:	be 00 00 00 00       	mov    $0x0,%esi
+  802d16:	bf 02 00 00 00       	mov    $0x2,%edi
+  802d1b:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  802d22:	00 00 00 
+  802d25:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802d27:	85 c0                	test   %eax,%eax
+  802d29:	79 3e                	jns    802d69 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802d2b:	48 83 c4 08          	add    $0x8,%rsp
+  802d2f:	5b                   	pop    %rbx
+  802d30:	41 5c                	pop    %r12
+  802d32:	41 5d                	pop    %r13
+  802d34:	5d                   	pop    %rbp
+  802d35:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802d36:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802d3d:	00 00 00 
+  802d40:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802d43:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802d45:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802d49:	be 00 00 00 00       	mov    $0x0,%esi
+  802d4e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802d53:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  802d5a:	00 00 00 
+  802d5d:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802d5f:	85 c0                	test   %eax,%eax
+  802d61:	78 c8                	js     802d2b <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802d63:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d67:	eb c2                	jmp    802d2b <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802d69:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802d6c:	8d 51 01             	lea    0x1(%rcx),%edx
+  802d6f:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d72:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802d77:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802d7e:	00 00 
+  802d80:	eb a9                	jmp    802d2b <devfile_trunc+0x6a>
+
+0000000000802d82 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d82:	55                   	push   %rbp
+  802d83:	48 89 e5             	mov    %rsp,%rbp
+  802d86:	41 57                	push   %r15
+  802d88:	41 56                	push   %r14
+  802d8a:	41 55                	push   %r13
+  802d8c:	41 54                	push   %r12
+  802d8e:	53                   	push   %rbx
+  802d8f:	48 83 ec 28          	sub    $0x28,%rsp
+  802d93:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802d97:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802d9b:	49 89 d7             	mov    %rdx,%r15
+  802d9e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802da2:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  802da9:	00 00 00 
+  802dac:	ff d0                	call   *%rax
+  802dae:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802db1:	48 85 c0             	test   %rax,%rax
+  802db4:	74 31                	je     802de7 <devfile_write+0x65>
+  802db6:	4c 89 f8             	mov    %r15,%rax
+  802db9:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802dc0:	77 25                	ja     802de7 <devfile_write+0x65>
+    size_t i = 0;
+  802dc2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802dc8:	48 85 c0             	test   %rax,%rax
+  802dcb:	0f 85 64 01 00 00    	jne    802f35 <devfile_write+0x1b3>
+    size_t i = 0;
+  802dd1:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802dd5:	4c 89 f8             	mov    %r15,%rax
+}
+  802dd8:	48 83 c4 28          	add    $0x28,%rsp
+  802ddc:	5b                   	pop    %rbx
+  802ddd:	41 5c                	pop    %r12
+  802ddf:	41 5d                	pop    %r13
+  802de1:	41 5e                	pop    %r14
+  802de3:	41 5f                	pop    %r15
+  802de5:	5d                   	pop    %rbp
+  802de6:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802de7:	48 85 db             	test   %rbx,%rbx
+  802dea:	74 5b                	je     802e47 <devfile_write+0xc5>
+  802dec:	48 89 de             	mov    %rbx,%rsi
+  802def:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802df3:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802dfa:	00 00 00 
+  802dfd:	ff d0                	call   *%rax
+  802dff:	85 c0                	test   %eax,%eax
+  802e01:	78 40                	js     802e43 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802e03:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e07:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802e0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e0e:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802e12:	48 b8 4f 29 80 00 00 	movabs $0x80294f,%rax
+  802e19:	00 00 00 
+  802e1c:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802e1e:	48 85 c0             	test   %rax,%rax
+  802e21:	7e b5                	jle    802dd8 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802e23:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802e27:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802e2a:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802e2d:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802e30:	8d 51 01             	lea    0x1(%rcx),%edx
+  802e33:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e36:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802e39:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802e40:	00 
+  802e41:	eb 95                	jmp    802dd8 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e43:	48 98                	cltq
+  802e45:	eb 91                	jmp    802dd8 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802e47:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802e4b:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802e4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e52:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802e56:	48 89 df             	mov    %rbx,%rdi
+  802e59:	48 b8 4f 29 80 00 00 	movabs $0x80294f,%rax
+  802e60:	00 00 00 
+  802e63:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802e65:	48 85 c0             	test   %rax,%rax
+  802e68:	0f 8e 6a ff ff ff    	jle    802dd8 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802e6e:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802e71:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e75:	e9 5e ff ff ff       	jmp    802dd8 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e7a:	48 98                	cltq
+  802e7c:	4d 85 ff             	test   %r15,%r15
+  802e7f:	49 0f 45 c7          	cmovne %r15,%rax
+  802e83:	e9 50 ff ff ff       	jmp    802dd8 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e88:	48 89 de             	mov    %rbx,%rsi
+  802e8b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e8f:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802e96:	00 00 00 
+  802e99:	ff d0                	call   *%rax
+  802e9b:	85 c0                	test   %eax,%eax
+  802e9d:	0f 88 2b 01 00 00    	js     802fce <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802ea3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ea7:	4c 01 f8             	add    %r15,%rax
+  802eaa:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802eae:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802eb2:	48 b9 5e 1f 80 00 00 	movabs $0x801f5e,%rcx
+  802eb9:	00 00 00 
+  802ebc:	ff d1                	call   *%rcx
+  802ebe:	48 89 c2             	mov    %rax,%rdx
+  802ec1:	48 c1 e2 04          	shl    $0x4,%rdx
+  802ec5:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802ec9:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ecd:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802ed2:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802ed5:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802edc:	00 
+  802edd:	4c 89 ea             	mov    %r13,%rdx
+  802ee0:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802ee4:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  802eeb:	00 00 00 
+  802eee:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802ef0:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802ef4:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802ef8:	48 39 c2             	cmp    %rax,%rdx
+  802efb:	0f 84 db 00 00 00    	je     802fdc <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802f01:	4c 39 e2             	cmp    %r12,%rdx
+  802f04:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802f08:	4d 01 ec             	add    %r13,%r12
+  802f0b:	49 39 c4             	cmp    %rax,%r12
+  802f0e:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802f12:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802f16:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802f1a:	45 01 ee             	add    %r13d,%r14d
+  802f1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f21:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802f25:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802f28:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f2c:	49 39 c7             	cmp    %rax,%r15
+  802f2f:	0f 83 a0 fe ff ff    	jae    802dd5 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802f35:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f39:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802f3d:	8b 43 08             	mov    0x8(%rbx),%eax
+  802f40:	44 39 f0             	cmp    %r14d,%eax
+  802f43:	7f 10                	jg     802f55 <devfile_write+0x1d3>
+  802f45:	48 98                	cltq
+  802f47:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802f4d:	49 63 d6             	movslq %r14d,%rdx
+  802f50:	48 39 d0             	cmp    %rdx,%rax
+  802f53:	7d 2d                	jge    802f82 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802f55:	48 89 de             	mov    %rbx,%rsi
+  802f58:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f5c:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802f63:	00 00 00 
+  802f66:	ff d0                	call   *%rax
+  802f68:	85 c0                	test   %eax,%eax
+  802f6a:	0f 88 0a ff ff ff    	js     802e7a <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802f70:	44 89 f0             	mov    %r14d,%eax
+  802f73:	66 b8 00 00          	mov    $0x0,%ax
+  802f77:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802f7a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802f81:	00 
+        size_t off = pos - fb->fb_base;
+  802f82:	45 89 f4             	mov    %r14d,%r12d
+  802f85:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802f89:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802f8c:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802f90:	4d 29 fd             	sub    %r15,%r13
+  802f93:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802f98:	4c 29 e0             	sub    %r12,%rax
+  802f9b:	49 39 c5             	cmp    %rax,%r13
+  802f9e:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802fa2:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802fa6:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802faa:	48 39 c2             	cmp    %rax,%rdx
+  802fad:	0f 84 f0 fe ff ff    	je     802ea3 <devfile_write+0x121>
+  802fb3:	4c 39 e0             	cmp    %r12,%rax
+  802fb6:	0f 82 cc fe ff ff    	jb     802e88 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802fbc:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802fc0:	48 39 d0             	cmp    %rdx,%rax
+  802fc3:	0f 83 da fe ff ff    	jae    802ea3 <devfile_write+0x121>
+  802fc9:	e9 ba fe ff ff       	jmp    802e88 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802fce:	48 98                	cltq
+  802fd0:	4d 85 ff             	test   %r15,%r15
+  802fd3:	49 0f 45 c7          	cmovne %r15,%rax
+  802fd7:	e9 fc fd ff ff       	jmp    802dd8 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802fdc:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802fe0:	4c 89 e2             	mov    %r12,%rdx
+  802fe3:	e9 2a ff ff ff       	jmp    802f12 <devfile_write+0x190>
+
+0000000000802fe8 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802fe8:	55                   	push   %rbp
+  802fe9:	48 89 e5             	mov    %rsp,%rbp
+  802fec:	41 57                	push   %r15
+  802fee:	41 56                	push   %r14
+  802ff0:	41 55                	push   %r13
+  802ff2:	41 54                	push   %r12
+  802ff4:	53                   	push   %rbx
+  802ff5:	48 83 ec 28          	sub    $0x28,%rsp
+  802ff9:	49 89 ff             	mov    %rdi,%r15
+  802ffc:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803000:	48 89 d3             	mov    %rdx,%rbx
+  803003:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803007:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  80300e:	00 00 00 
+  803011:	ff d0                	call   *%rax
+  803013:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803016:	48 85 c0             	test   %rax,%rax
+  803019:	74 0d                	je     803028 <devfile_read+0x40>
+  80301b:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803022:	0f 86 1a 01 00 00    	jbe    803142 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803028:	4d 85 e4             	test   %r12,%r12
+  80302b:	74 1a                	je     803047 <devfile_read+0x5f>
+  80302d:	4c 89 e6             	mov    %r12,%rsi
+  803030:	4c 89 ff             	mov    %r15,%rdi
+  803033:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  80303a:	00 00 00 
+  80303d:	ff d0                	call   *%rax
+  80303f:	85 c0                	test   %eax,%eax
+  803041:	0f 88 e8 00 00 00    	js     80312f <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803047:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  80304b:	48 b8 4c 28 80 00 00 	movabs $0x80284c,%rax
+  803052:	00 00 00 
+  803055:	ff d0                	call   *%rax
+  803057:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  80305a:	48 85 c0             	test   %rax,%rax
+  80305d:	0f 84 69 02 00 00    	je     8032cc <devfile_read+0x2e4>
+    while (i < n) {
+  803063:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803068:	0f 84 ce 00 00 00    	je     80313c <devfile_read+0x154>
+    size_t i = 0;
+  80306e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803073:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  80307a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80307e:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803082:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803086:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80308a:	48 29 da             	sub    %rbx,%rdx
+  80308d:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803092:	48 39 c2             	cmp    %rax,%rdx
+  803095:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803099:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80309d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  8030a1:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8030a4:	01 d8                	add    %ebx,%eax
+  8030a6:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  8030aa:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  8030ae:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  8030b5:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8030bc:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  8030c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030ce:	4c 89 ee             	mov    %r13,%rsi
+  8030d1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8030d6:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  8030dd:	00 00 00 
+  8030e0:	ff d0                	call   *%rax
+        if (res < 0)
+  8030e2:	85 c0                	test   %eax,%eax
+  8030e4:	78 4d                	js     803133 <devfile_read+0x14b>
+        if (res == 0)
+  8030e6:	74 4f                	je     803137 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8030e8:	4c 63 e0             	movslq %eax,%r12
+  8030eb:	4c 89 e2             	mov    %r12,%rdx
+  8030ee:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8030f2:	4c 89 f7             	mov    %r14,%rdi
+  8030f5:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  8030fc:	00 00 00 
+  8030ff:	ff d0                	call   *%rax
+        i += res;
+  803101:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803104:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803107:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80310b:	48 39 c3             	cmp    %rax,%rbx
+  80310e:	0f 82 72 ff ff ff    	jb     803086 <devfile_read+0x9e>
+    return i;
+  803114:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803117:	48 85 c0             	test   %rax,%rax
+  80311a:	7e 04                	jle    803120 <devfile_read+0x138>
+  80311c:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803120:	48 83 c4 28          	add    $0x28,%rsp
+  803124:	5b                   	pop    %rbx
+  803125:	41 5c                	pop    %r12
+  803127:	41 5d                	pop    %r13
+  803129:	41 5e                	pop    %r14
+  80312b:	41 5f                	pop    %r15
+  80312d:	5d                   	pop    %rbp
+  80312e:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80312f:	48 98                	cltq
+  803131:	eb ed                	jmp    803120 <devfile_read+0x138>
+            return res;
+  803133:	48 98                	cltq
+  803135:	eb e9                	jmp    803120 <devfile_read+0x138>
+            return i;
+  803137:	48 89 d8             	mov    %rbx,%rax
+  80313a:	eb db                	jmp    803117 <devfile_read+0x12f>
+    size_t i = 0;
+  80313c:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803140:	eb d2                	jmp    803114 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803142:	48 89 c6             	mov    %rax,%rsi
+  803145:	4c 89 ff             	mov    %r15,%rdi
+  803148:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  80314f:	00 00 00 
+  803152:	ff d0                	call   *%rax
+  803154:	85 c0                	test   %eax,%eax
+  803156:	78 40                	js     803198 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803158:	4c 89 ff             	mov    %r15,%rdi
+  80315b:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  803162:	00 00 00 
+  803165:	ff d0                	call   *%rax
+  803167:	48 89 c2             	mov    %rax,%rdx
+  80316a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80316e:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803172:	48 c1 e0 0c          	shl    $0xc,%rax
+  803176:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80317b:	48 01 d0             	add    %rdx,%rax
+  80317e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803182:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803187:	0f 84 33 01 00 00    	je     8032c0 <devfile_read+0x2d8>
+    size_t i = 0;
+  80318d:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803193:	e9 f5 00 00 00       	jmp    80328d <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803198:	48 98                	cltq
+  80319a:	eb 84                	jmp    803120 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80319c:	44 89 e8             	mov    %r13d,%eax
+  80319f:	66 b8 00 00          	mov    $0x0,%ax
+  8031a3:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8031a8:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8031af:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8031b1:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8031b5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8031b9:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8031bb:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8031c0:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8031c3:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8031ca:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8031cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031d6:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8031db:	bf 03 00 00 00       	mov    $0x3,%edi
+  8031e0:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  8031e7:	00 00 00 
+  8031ea:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8031ec:	85 c0                	test   %eax,%eax
+  8031ee:	0f 88 be 00 00 00    	js     8032b2 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8031f4:	48 63 d0             	movslq %eax,%rdx
+  8031f7:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8031fc:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803201:	44 39 e8             	cmp    %r13d,%eax
+  803204:	0f 8e ba 00 00 00    	jle    8032c4 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80320a:	49 63 c5             	movslq %r13d,%rax
+  80320d:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803212:	48 29 c3             	sub    %rax,%rbx
+  803215:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80321a:	48 01 c3             	add    %rax,%rbx
+  80321d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803221:	4c 29 f0             	sub    %r14,%rax
+  803224:	48 39 c3             	cmp    %rax,%rbx
+  803227:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80322b:	4c 89 ff             	mov    %r15,%rdi
+  80322e:	48 b9 5e 1f 80 00 00 	movabs $0x801f5e,%rcx
+  803235:	00 00 00 
+  803238:	ff d1                	call   *%rcx
+  80323a:	48 89 c2             	mov    %rax,%rdx
+  80323d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803241:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803245:	48 c1 e0 0c          	shl    $0xc,%rax
+  803249:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  80324e:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803251:	44 89 ea             	mov    %r13d,%edx
+  803254:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803259:	48 63 d2             	movslq %edx,%rdx
+  80325c:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803263:	00 
+  803264:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803268:	4c 01 f7             	add    %r14,%rdi
+  80326b:	48 89 da             	mov    %rbx,%rdx
+  80326e:	48 b9 cf 10 80 00 00 	movabs $0x8010cf,%rcx
+  803275:	00 00 00 
+  803278:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80327a:	41 01 dd             	add    %ebx,%r13d
+  80327d:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803281:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803284:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803288:	49 39 c6             	cmp    %rax,%r14
+  80328b:	73 37                	jae    8032c4 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  80328d:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803291:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803296:	44 39 e8             	cmp    %r13d,%eax
+  803299:	0f 8f fd fe ff ff    	jg     80319c <devfile_read+0x1b4>
+  80329f:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8032a4:	44 39 e8             	cmp    %r13d,%eax
+  8032a7:	0f 8f 5d ff ff ff    	jg     80320a <devfile_read+0x222>
+  8032ad:	e9 ea fe ff ff       	jmp    80319c <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8032b2:	48 98                	cltq
+  8032b4:	4d 85 f6             	test   %r14,%r14
+  8032b7:	49 0f 45 c6          	cmovne %r14,%rax
+  8032bb:	e9 60 fe ff ff       	jmp    803120 <devfile_read+0x138>
+    size_t i = 0;
+  8032c0:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8032c4:	4c 89 f0             	mov    %r14,%rax
+  8032c7:	e9 54 fe ff ff       	jmp    803120 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8032cc:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8032d3:	e9 48 fe ff ff       	jmp    803120 <devfile_read+0x138>
+
+00000000008032d8 <open>:
+open(const char *path, int mode) {
+  8032d8:	55                   	push   %rbp
+  8032d9:	48 89 e5             	mov    %rsp,%rbp
+  8032dc:	41 55                	push   %r13
+  8032de:	41 54                	push   %r12
+  8032e0:	53                   	push   %rbx
+  8032e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8032e5:	49 89 fc             	mov    %rdi,%r12
+  8032e8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8032eb:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  8032f2:	00 00 00 
+  8032f5:	ff d0                	call   *%rax
+  8032f7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8032fd:	0f 87 8a 00 00 00    	ja     80338d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803303:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803307:	48 b8 8c 1f 80 00 00 	movabs $0x801f8c,%rax
+  80330e:	00 00 00 
+  803311:	ff d0                	call   *%rax
+  803313:	89 c3                	mov    %eax,%ebx
+  803315:	85 c0                	test   %eax,%eax
+  803317:	78 50                	js     803369 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803319:	4c 89 e6             	mov    %r12,%rsi
+  80331c:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803323:	00 00 00 
+  803326:	48 89 df             	mov    %rbx,%rdi
+  803329:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  803330:	00 00 00 
+  803333:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803335:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80333c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803340:	bf 01 00 00 00       	mov    $0x1,%edi
+  803345:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  80334c:	00 00 00 
+  80334f:	ff d0                	call   *%rax
+  803351:	89 c3                	mov    %eax,%ebx
+  803353:	85 c0                	test   %eax,%eax
+  803355:	78 1f                	js     803376 <open+0x9e>
+    return fd2num(fd);
+  803357:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80335b:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  803362:	00 00 00 
+  803365:	ff d0                	call   *%rax
+  803367:	89 c3                	mov    %eax,%ebx
+}
+  803369:	89 d8                	mov    %ebx,%eax
+  80336b:	48 83 c4 18          	add    $0x18,%rsp
+  80336f:	5b                   	pop    %rbx
+  803370:	41 5c                	pop    %r12
+  803372:	41 5d                	pop    %r13
+  803374:	5d                   	pop    %rbp
+  803375:	c3                   	ret
+        fd_close(fd, 0);
+  803376:	be 00 00 00 00       	mov    $0x0,%esi
+  80337b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80337f:	48 b8 a7 20 80 00 00 	movabs $0x8020a7,%rax
+  803386:	00 00 00 
+  803389:	ff d0                	call   *%rax
+        return res;
+  80338b:	eb dc                	jmp    803369 <open+0x91>
+        return -E_BAD_PATH;
+  80338d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803392:	eb d5                	jmp    803369 <open+0x91>
+
+0000000000803394 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803394:	55                   	push   %rbp
+  803395:	48 89 e5             	mov    %rsp,%rbp
+  803398:	41 57                	push   %r15
+  80339a:	41 56                	push   %r14
+  80339c:	41 55                	push   %r13
+  80339e:	41 54                	push   %r12
+  8033a0:	53                   	push   %rbx
+  8033a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8033a5:	41 89 f6             	mov    %esi,%r14d
+  8033a8:	49 89 d7             	mov    %rdx,%r15
+  8033ab:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8033ae:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033b2:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8033b9:	00 00 00 
+  8033bc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033be:	85 c0                	test   %eax,%eax
+  8033c0:	0f 88 db 00 00 00    	js     8034a1 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8033c6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033ca:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8033d1:	00 00 00 
+  8033d4:	8b 00                	mov    (%rax),%eax
+  8033d6:	39 07                	cmp    %eax,(%rdi)
+  8033d8:	0f 85 db 00 00 00    	jne    8034b9 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8033de:	45 85 f6             	test   %r14d,%r14d
+  8033e1:	0f 88 db 00 00 00    	js     8034c2 <fmap+0x12e>
+  8033e7:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8033ee:	0f 85 d7 00 00 00    	jne    8034cb <fmap+0x137>
+  8033f4:	4c 89 fb             	mov    %r15,%rbx
+  8033f7:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8033fd:	0f 85 d1 00 00 00    	jne    8034d4 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803403:	48 b8 24 2b 80 00 00 	movabs $0x802b24,%rax
+  80340a:	00 00 00 
+  80340d:	ff d0                	call   *%rax
+  80340f:	85 c0                	test   %eax,%eax
+  803411:	0f 88 8e 00 00 00    	js     8034a5 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803417:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  80341e:	00 00 00 
+    while (i < n) {
+  803421:	4d 85 ed             	test   %r13,%r13
+  803424:	0f 84 8a 00 00 00    	je     8034b4 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80342a:	4c 89 ea             	mov    %r13,%rdx
+  80342d:	48 29 da             	sub    %rbx,%rdx
+  803430:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803437:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80343d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803441:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803445:	8b 40 0c             	mov    0xc(%rax),%eax
+  803448:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  80344c:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803450:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803455:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80345a:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80345e:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803462:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803467:	4c 89 e6             	mov    %r12,%rsi
+  80346a:	bf 09 00 00 00       	mov    $0x9,%edi
+  80346f:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  803476:	00 00 00 
+  803479:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80347b:	85 c0                	test   %eax,%eax
+  80347d:	78 2a                	js     8034a9 <fmap+0x115>
+        i += res;
+  80347f:	48 98                	cltq
+  803481:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803484:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803488:	72 05                	jb     80348f <fmap+0xfb>
+    while (i < n) {
+  80348a:	4c 39 eb             	cmp    %r13,%rbx
+  80348d:	72 9b                	jb     80342a <fmap+0x96>
+    }
+    return i;
+  80348f:	48 89 d8             	mov    %rbx,%rax
+}
+  803492:	48 83 c4 18          	add    $0x18,%rsp
+  803496:	5b                   	pop    %rbx
+  803497:	41 5c                	pop    %r12
+  803499:	41 5d                	pop    %r13
+  80349b:	41 5e                	pop    %r14
+  80349d:	41 5f                	pop    %r15
+  80349f:	5d                   	pop    %rbp
+  8034a0:	c3                   	ret
+    if (res < 0) return res;
+  8034a1:	48 98                	cltq
+  8034a3:	eb ed                	jmp    803492 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8034a5:	48 98                	cltq
+  8034a7:	eb e9                	jmp    803492 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8034a9:	48 98                	cltq
+  8034ab:	48 85 db             	test   %rbx,%rbx
+  8034ae:	48 0f 45 c3          	cmovne %rbx,%rax
+  8034b2:	eb de                	jmp    803492 <fmap+0xfe>
+    size_t i = 0;
+  8034b4:	4c 89 eb             	mov    %r13,%rbx
+  8034b7:	eb d6                	jmp    80348f <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8034b9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8034c0:	eb d0                	jmp    803492 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8034c2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034c9:	eb c7                	jmp    803492 <fmap+0xfe>
+  8034cb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034d2:	eb be                	jmp    803492 <fmap+0xfe>
+  8034d4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034db:	eb b5                	jmp    803492 <fmap+0xfe>
+
+00000000008034dd <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8034dd:	55                   	push   %rbp
+  8034de:	48 89 e5             	mov    %rsp,%rbp
+  8034e1:	41 56                	push   %r14
+  8034e3:	41 55                	push   %r13
+  8034e5:	41 54                	push   %r12
+  8034e7:	53                   	push   %rbx
+  8034e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8034ec:	89 fb                	mov    %edi,%ebx
+  8034ee:	41 89 f4             	mov    %esi,%r12d
+  8034f1:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034f4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034f8:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8034ff:	00 00 00 
+  803502:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803504:	85 c0                	test   %eax,%eax
+  803506:	78 63                	js     80356b <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803508:	45 85 e4             	test   %r12d,%r12d
+  80350b:	0f 88 80 00 00 00    	js     803591 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803511:	45 89 e6             	mov    %r12d,%r14d
+  803514:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80351b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80351f:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  803526:	00 00 00 
+  803529:	ff d0                	call   *%rax
+  80352b:	48 89 c2             	mov    %rax,%rdx
+  80352e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803533:	44 89 f6             	mov    %r14d,%esi
+  803536:	89 df                	mov    %ebx,%edi
+  803538:	48 b8 94 33 80 00 00 	movabs $0x803394,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+  803544:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803547:	45 29 f4             	sub    %r14d,%r12d
+  80354a:	4d 63 f4             	movslq %r12d,%r14
+  80354d:	49 39 c6             	cmp    %rax,%r14
+  803550:	7c 1d                	jl     80356f <read_map+0x92>
+  803552:	48 85 c0             	test   %rax,%rax
+  803555:	b8 00 00 00 00       	mov    $0x0,%eax
+  80355a:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80355e:	48 83 c4 10          	add    $0x10,%rsp
+  803562:	5b                   	pop    %rbx
+  803563:	41 5c                	pop    %r12
+  803565:	41 5d                	pop    %r13
+  803567:	41 5e                	pop    %r14
+  803569:	5d                   	pop    %rbp
+  80356a:	c3                   	ret
+    if (res < 0) return res;
+  80356b:	48 98                	cltq
+  80356d:	eb ef                	jmp    80355e <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  80356f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803573:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  80357a:	00 00 00 
+  80357d:	ff d0                	call   *%rax
+  80357f:	4d 63 e4             	movslq %r12d,%r12
+  803582:	4c 01 e0             	add    %r12,%rax
+  803585:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803589:	48 89 d8             	mov    %rbx,%rax
+  80358c:	4c 29 f0             	sub    %r14,%rax
+  80358f:	eb cd                	jmp    80355e <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803591:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803598:	eb c4                	jmp    80355e <read_map+0x81>
+
+000000000080359a <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  80359a:	55                   	push   %rbp
+  80359b:	48 89 e5             	mov    %rsp,%rbp
+  80359e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8035a2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035a6:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  8035ad:	00 00 00 
+  8035b0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035b2:	85 c0                	test   %eax,%eax
+  8035b4:	78 4a                	js     803600 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8035b6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8035ba:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8035c1:	00 00 00 
+  8035c4:	8b 00                	mov    (%rax),%eax
+  8035c6:	39 07                	cmp    %eax,(%rdi)
+  8035c8:	75 38                	jne    803602 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8035ca:	48 b8 24 2b 80 00 00 	movabs $0x802b24,%rax
+  8035d1:	00 00 00 
+  8035d4:	ff d0                	call   *%rax
+  8035d6:	85 c0                	test   %eax,%eax
+  8035d8:	78 26                	js     803600 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8035da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035de:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035e1:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8035e8:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8035ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8035ef:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035f4:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  8035fb:	00 00 00 
+  8035fe:	ff d0                	call   *%rax
+}
+  803600:	c9                   	leave
+  803601:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803602:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803607:	eb f7                	jmp    803600 <fsync+0x66>
+
+0000000000803609 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803609:	55                   	push   %rbp
+  80360a:	48 89 e5             	mov    %rsp,%rbp
+  80360d:	41 57                	push   %r15
+  80360f:	41 56                	push   %r14
+  803611:	41 55                	push   %r13
+  803613:	41 54                	push   %r12
+  803615:	53                   	push   %rbx
+  803616:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80361a:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803621:	00 00 00 
+  803624:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803629:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80362f:	49 bd ec 1f 80 00 00 	movabs $0x801fec,%r13
+  803636:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803639:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803640:	00 00 00 
+  803643:	eb 0c                	jmp    803651 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803645:	83 c3 01             	add    $0x1,%ebx
+  803648:	49 83 c4 28          	add    $0x28,%r12
+  80364c:	83 fb 20             	cmp    $0x20,%ebx
+  80364f:	74 33                	je     803684 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803651:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803656:	74 ed                	je     803645 <flushall+0x3c>
+  803658:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80365c:	89 df                	mov    %ebx,%edi
+  80365e:	41 ff d5             	call   *%r13
+  803661:	85 c0                	test   %eax,%eax
+  803663:	78 e0                	js     803645 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803665:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803669:	41 8b 06             	mov    (%r14),%eax
+  80366c:	39 07                	cmp    %eax,(%rdi)
+  80366e:	75 d5                	jne    803645 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803670:	48 b8 24 2b 80 00 00 	movabs $0x802b24,%rax
+  803677:	00 00 00 
+  80367a:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  80367c:	85 c0                	test   %eax,%eax
+  80367e:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803682:	eb c1                	jmp    803645 <flushall+0x3c>
+    }
+    return res;
+}
+  803684:	44 89 f8             	mov    %r15d,%eax
+  803687:	48 83 c4 18          	add    $0x18,%rsp
+  80368b:	5b                   	pop    %rbx
+  80368c:	41 5c                	pop    %r12
+  80368e:	41 5d                	pop    %r13
+  803690:	41 5e                	pop    %r14
+  803692:	41 5f                	pop    %r15
+  803694:	5d                   	pop    %rbp
+  803695:	c3                   	ret
+
+0000000000803696 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803696:	55                   	push   %rbp
+  803697:	48 89 e5             	mov    %rsp,%rbp
+  80369a:	53                   	push   %rbx
+  80369b:	48 83 ec 08          	sub    $0x8,%rsp
+  80369f:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8036a2:	40 0f b6 c6          	movzbl %sil,%eax
+  8036a6:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8036ad:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8036af:	be 00 00 00 00       	mov    $0x0,%esi
+  8036b4:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8036b9:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  8036c0:	00 00 00 
+  8036c3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036c5:	85 c0                	test   %eax,%eax
+  8036c7:	78 23                	js     8036ec <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8036c9:	ba 58 06 00 00       	mov    $0x658,%edx
+  8036ce:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8036d5:	00 00 00 
+  8036d8:	48 89 df             	mov    %rbx,%rdi
+  8036db:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  8036e2:	00 00 00 
+  8036e5:	ff d0                	call   *%rax
+    return 0;
+  8036e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036f0:	c9                   	leave
+  8036f1:	c3                   	ret
+
+00000000008036f2 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8036f2:	55                   	push   %rbp
+  8036f3:	48 89 e5             	mov    %rsp,%rbp
+  8036f6:	53                   	push   %rbx
+  8036f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8036fb:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8036fe:	48 b8 9c 0c 80 00 00 	movabs $0x800c9c,%rax
+  803705:	00 00 00 
+  803708:	ff d0                	call   *%rax
+  80370a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803710:	77 35                	ja     803747 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803712:	48 89 de             	mov    %rbx,%rsi
+  803715:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  80371c:	00 00 00 
+  80371f:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  803726:	00 00 00 
+  803729:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80372b:	be 00 00 00 00       	mov    $0x0,%esi
+  803730:	bf 07 00 00 00       	mov    $0x7,%edi
+  803735:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  80373c:	00 00 00 
+  80373f:	ff d0                	call   *%rax
+}
+  803741:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803745:	c9                   	leave
+  803746:	c3                   	ret
+        return -E_BAD_PATH;
+  803747:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80374c:	eb f3                	jmp    803741 <remove+0x4f>
+
+000000000080374e <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80374e:	55                   	push   %rbp
+  80374f:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803752:	48 b8 09 36 80 00 00 	movabs $0x803609,%rax
+  803759:	00 00 00 
+  80375c:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80375e:	be 00 00 00 00       	mov    $0x0,%esi
+  803763:	bf 08 00 00 00       	mov    $0x8,%edi
+  803768:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  80376f:	00 00 00 
+  803772:	ff d0                	call   *%rax
+}
+  803774:	5d                   	pop    %rbp
+  803775:	c3                   	ret
+
+0000000000803776 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803776:	55                   	push   %rbp
+  803777:	48 89 e5             	mov    %rsp,%rbp
+  80377a:	41 54                	push   %r12
+  80377c:	53                   	push   %rbx
+  80377d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803780:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  803787:	00 00 00 
+  80378a:	ff d0                	call   *%rax
+  80378c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80378f:	48 be 00 57 80 00 00 	movabs $0x805700,%rsi
+  803796:	00 00 00 
+  803799:	48 89 df             	mov    %rbx,%rdi
+  80379c:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  8037a3:	00 00 00 
+  8037a6:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8037a8:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8037ad:	41 2b 04 24          	sub    (%r12),%eax
+  8037b1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8037b7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8037be:	00 00 00 
+    stat->st_dev = &devpipe;
+  8037c1:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8037c8:	00 00 00 
+  8037cb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8037d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d7:	5b                   	pop    %rbx
+  8037d8:	41 5c                	pop    %r12
+  8037da:	5d                   	pop    %rbp
+  8037db:	c3                   	ret
+
+00000000008037dc <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8037dc:	55                   	push   %rbp
+  8037dd:	48 89 e5             	mov    %rsp,%rbp
+  8037e0:	41 54                	push   %r12
+  8037e2:	53                   	push   %rbx
+  8037e3:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037eb:	48 89 fe             	mov    %rdi,%rsi
+  8037ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f3:	49 bc 19 16 80 00 00 	movabs $0x801619,%r12
+  8037fa:	00 00 00 
+  8037fd:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803800:	48 89 df             	mov    %rbx,%rdi
+  803803:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  80380a:	00 00 00 
+  80380d:	ff d0                	call   *%rax
+  80380f:	48 89 c6             	mov    %rax,%rsi
+  803812:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803817:	bf 00 00 00 00       	mov    $0x0,%edi
+  80381c:	41 ff d4             	call   *%r12
+}
+  80381f:	5b                   	pop    %rbx
+  803820:	41 5c                	pop    %r12
+  803822:	5d                   	pop    %rbp
+  803823:	c3                   	ret
+
+0000000000803824 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803824:	55                   	push   %rbp
+  803825:	48 89 e5             	mov    %rsp,%rbp
+  803828:	41 57                	push   %r15
+  80382a:	41 56                	push   %r14
+  80382c:	41 55                	push   %r13
+  80382e:	41 54                	push   %r12
+  803830:	53                   	push   %rbx
+  803831:	48 83 ec 18          	sub    $0x18,%rsp
+  803835:	49 89 fc             	mov    %rdi,%r12
+  803838:	49 89 f5             	mov    %rsi,%r13
+  80383b:	49 89 d7             	mov    %rdx,%r15
+  80383e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803842:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  803849:	00 00 00 
+  80384c:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80384e:	4d 85 ff             	test   %r15,%r15
+  803851:	0f 84 af 00 00 00    	je     803906 <devpipe_write+0xe2>
+  803857:	48 89 c3             	mov    %rax,%rbx
+  80385a:	4c 89 f8             	mov    %r15,%rax
+  80385d:	4d 89 ef             	mov    %r13,%r15
+  803860:	4c 01 e8             	add    %r13,%rax
+  803863:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803867:	49 bd 0e 14 80 00 00 	movabs $0x80140e,%r13
+  80386e:	00 00 00 
+            sys_yield();
+  803871:	49 be ab 13 80 00 00 	movabs $0x8013ab,%r14
+  803878:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80387b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80387e:	48 63 ce             	movslq %esi,%rcx
+  803881:	48 63 03             	movslq (%rbx),%rax
+  803884:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80388a:	48 39 c1             	cmp    %rax,%rcx
+  80388d:	72 2e                	jb     8038bd <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80388f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803894:	48 89 da             	mov    %rbx,%rdx
+  803897:	be 00 10 00 00       	mov    $0x1000,%esi
+  80389c:	4c 89 e7             	mov    %r12,%rdi
+  80389f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8038a2:	85 c0                	test   %eax,%eax
+  8038a4:	74 66                	je     80390c <devpipe_write+0xe8>
+            sys_yield();
+  8038a6:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8038a9:	8b 73 04             	mov    0x4(%rbx),%esi
+  8038ac:	48 63 ce             	movslq %esi,%rcx
+  8038af:	48 63 03             	movslq (%rbx),%rax
+  8038b2:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8038b8:	48 39 c1             	cmp    %rax,%rcx
+  8038bb:	73 d2                	jae    80388f <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8038bd:	41 0f b6 3f          	movzbl (%r15),%edi
+  8038c1:	48 89 ca             	mov    %rcx,%rdx
+  8038c4:	48 c1 ea 03          	shr    $0x3,%rdx
+  8038c8:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8038cf:	08 10 20 
+  8038d2:	48 f7 e2             	mul    %rdx
+  8038d5:	48 c1 ea 06          	shr    $0x6,%rdx
+  8038d9:	48 89 d0             	mov    %rdx,%rax
+  8038dc:	48 c1 e0 09          	shl    $0x9,%rax
+  8038e0:	48 29 d0             	sub    %rdx,%rax
+  8038e3:	48 c1 e0 03          	shl    $0x3,%rax
+  8038e7:	48 29 c1             	sub    %rax,%rcx
+  8038ea:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8038ef:	83 c6 01             	add    $0x1,%esi
+  8038f2:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8038f5:	49 83 c7 01          	add    $0x1,%r15
+  8038f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038fd:	49 39 c7             	cmp    %rax,%r15
+  803900:	0f 85 75 ff ff ff    	jne    80387b <devpipe_write+0x57>
+    return n;
+  803906:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80390a:	eb 05                	jmp    803911 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80390c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803911:	48 83 c4 18          	add    $0x18,%rsp
+  803915:	5b                   	pop    %rbx
+  803916:	41 5c                	pop    %r12
+  803918:	41 5d                	pop    %r13
+  80391a:	41 5e                	pop    %r14
+  80391c:	41 5f                	pop    %r15
+  80391e:	5d                   	pop    %rbp
+  80391f:	c3                   	ret
+
+0000000000803920 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803920:	55                   	push   %rbp
+  803921:	48 89 e5             	mov    %rsp,%rbp
+  803924:	41 57                	push   %r15
+  803926:	41 56                	push   %r14
+  803928:	41 55                	push   %r13
+  80392a:	41 54                	push   %r12
+  80392c:	53                   	push   %rbx
+  80392d:	48 83 ec 18          	sub    $0x18,%rsp
+  803931:	49 89 fc             	mov    %rdi,%r12
+  803934:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803938:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80393c:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  803943:	00 00 00 
+  803946:	ff d0                	call   *%rax
+  803948:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80394b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803951:	49 bd 0e 14 80 00 00 	movabs $0x80140e,%r13
+  803958:	00 00 00 
+            sys_yield();
+  80395b:	49 be ab 13 80 00 00 	movabs $0x8013ab,%r14
+  803962:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803965:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80396a:	74 7d                	je     8039e9 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80396c:	8b 03                	mov    (%rbx),%eax
+  80396e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803971:	75 26                	jne    803999 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803973:	4d 85 ff             	test   %r15,%r15
+  803976:	75 77                	jne    8039ef <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803978:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80397d:	48 89 da             	mov    %rbx,%rdx
+  803980:	be 00 10 00 00       	mov    $0x1000,%esi
+  803985:	4c 89 e7             	mov    %r12,%rdi
+  803988:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80398b:	85 c0                	test   %eax,%eax
+  80398d:	74 72                	je     803a01 <devpipe_read+0xe1>
+            sys_yield();
+  80398f:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803992:	8b 03                	mov    (%rbx),%eax
+  803994:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803997:	74 df                	je     803978 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803999:	48 63 c8             	movslq %eax,%rcx
+  80399c:	48 89 ca             	mov    %rcx,%rdx
+  80399f:	48 c1 ea 03          	shr    $0x3,%rdx
+  8039a3:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8039aa:	08 10 20 
+  8039ad:	48 89 d0             	mov    %rdx,%rax
+  8039b0:	48 f7 e6             	mul    %rsi
+  8039b3:	48 c1 ea 06          	shr    $0x6,%rdx
+  8039b7:	48 89 d0             	mov    %rdx,%rax
+  8039ba:	48 c1 e0 09          	shl    $0x9,%rax
+  8039be:	48 29 d0             	sub    %rdx,%rax
+  8039c1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8039c8:	00 
+  8039c9:	48 89 c8             	mov    %rcx,%rax
+  8039cc:	48 29 d0             	sub    %rdx,%rax
+  8039cf:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8039d4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039d8:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8039dc:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8039df:	49 83 c7 01          	add    $0x1,%r15
+  8039e3:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8039e7:	75 83                	jne    80396c <devpipe_read+0x4c>
+    return n;
+  8039e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039ed:	eb 03                	jmp    8039f2 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8039ef:	4c 89 f8             	mov    %r15,%rax
+}
+  8039f2:	48 83 c4 18          	add    $0x18,%rsp
+  8039f6:	5b                   	pop    %rbx
+  8039f7:	41 5c                	pop    %r12
+  8039f9:	41 5d                	pop    %r13
+  8039fb:	41 5e                	pop    %r14
+  8039fd:	41 5f                	pop    %r15
+  8039ff:	5d                   	pop    %rbp
+  803a00:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a06:	eb ea                	jmp    8039f2 <devpipe_read+0xd2>
+
+0000000000803a08 <pipe>:
+pipe(int pfd[2]) {
+  803a08:	55                   	push   %rbp
+  803a09:	48 89 e5             	mov    %rsp,%rbp
+  803a0c:	41 55                	push   %r13
+  803a0e:	41 54                	push   %r12
+  803a10:	53                   	push   %rbx
+  803a11:	48 83 ec 18          	sub    $0x18,%rsp
+  803a15:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803a18:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803a1c:	48 b8 8c 1f 80 00 00 	movabs $0x801f8c,%rax
+  803a23:	00 00 00 
+  803a26:	ff d0                	call   *%rax
+  803a28:	89 c3                	mov    %eax,%ebx
+  803a2a:	85 c0                	test   %eax,%eax
+  803a2c:	0f 88 a0 01 00 00    	js     803bd2 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803a32:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a37:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a3c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a40:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a45:	48 b8 3a 14 80 00 00 	movabs $0x80143a,%rax
+  803a4c:	00 00 00 
+  803a4f:	ff d0                	call   *%rax
+  803a51:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803a53:	85 c0                	test   %eax,%eax
+  803a55:	0f 88 77 01 00 00    	js     803bd2 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803a5b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803a5f:	48 b8 8c 1f 80 00 00 	movabs $0x801f8c,%rax
+  803a66:	00 00 00 
+  803a69:	ff d0                	call   *%rax
+  803a6b:	89 c3                	mov    %eax,%ebx
+  803a6d:	85 c0                	test   %eax,%eax
+  803a6f:	0f 88 43 01 00 00    	js     803bb8 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803a75:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a7a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a7f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803a83:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a88:	48 b8 3a 14 80 00 00 	movabs $0x80143a,%rax
+  803a8f:	00 00 00 
+  803a92:	ff d0                	call   *%rax
+  803a94:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803a96:	85 c0                	test   %eax,%eax
+  803a98:	0f 88 1a 01 00 00    	js     803bb8 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803a9e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803aa2:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  803aa9:	00 00 00 
+  803aac:	ff d0                	call   *%rax
+  803aae:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803ab1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ab6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803abb:	48 89 c6             	mov    %rax,%rsi
+  803abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ac3:	48 b8 3a 14 80 00 00 	movabs $0x80143a,%rax
+  803aca:	00 00 00 
+  803acd:	ff d0                	call   *%rax
+  803acf:	89 c3                	mov    %eax,%ebx
+  803ad1:	85 c0                	test   %eax,%eax
+  803ad3:	0f 88 c5 00 00 00    	js     803b9e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803ad9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803add:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  803ae4:	00 00 00 
+  803ae7:	ff d0                	call   *%rax
+  803ae9:	48 89 c1             	mov    %rax,%rcx
+  803aec:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803af2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803af8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803afd:	4c 89 ee             	mov    %r13,%rsi
+  803b00:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b05:	48 b8 a1 14 80 00 00 	movabs $0x8014a1,%rax
+  803b0c:	00 00 00 
+  803b0f:	ff d0                	call   *%rax
+  803b11:	89 c3                	mov    %eax,%ebx
+  803b13:	85 c0                	test   %eax,%eax
+  803b15:	78 6e                	js     803b85 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b17:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b1c:	4c 89 ef             	mov    %r13,%rdi
+  803b1f:	48 b8 dc 13 80 00 00 	movabs $0x8013dc,%rax
+  803b26:	00 00 00 
+  803b29:	ff d0                	call   *%rax
+  803b2b:	83 f8 02             	cmp    $0x2,%eax
+  803b2e:	0f 85 ab 00 00 00    	jne    803bdf <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803b34:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803b3b:	00 00 
+  803b3d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b41:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803b43:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b47:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803b4e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803b52:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803b54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b58:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803b5f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b63:	48 bb 5e 1f 80 00 00 	movabs $0x801f5e,%rbx
+  803b6a:	00 00 00 
+  803b6d:	ff d3                	call   *%rbx
+  803b6f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803b73:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803b77:	ff d3                	call   *%rbx
+  803b79:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803b7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b83:	eb 4d                	jmp    803bd2 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803b85:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b8a:	4c 89 ee             	mov    %r13,%rsi
+  803b8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b92:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  803b99:	00 00 00 
+  803b9c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803b9e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ba3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ba7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bac:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  803bb3:	00 00 00 
+  803bb6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803bb8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bbd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bc6:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  803bcd:	00 00 00 
+  803bd0:	ff d0                	call   *%rax
+}
+  803bd2:	89 d8                	mov    %ebx,%eax
+  803bd4:	48 83 c4 18          	add    $0x18,%rsp
+  803bd8:	5b                   	pop    %rbx
+  803bd9:	41 5c                	pop    %r12
+  803bdb:	41 5d                	pop    %r13
+  803bdd:	5d                   	pop    %rbp
+  803bde:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803bdf:	48 b9 30 57 80 00 00 	movabs $0x805730,%rcx
+  803be6:	00 00 00 
+  803be9:	48 ba 07 57 80 00 00 	movabs $0x805707,%rdx
+  803bf0:	00 00 00 
+  803bf3:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803bf8:	48 bf 1c 57 80 00 00 	movabs $0x80571c,%rdi
+  803bff:	00 00 00 
+  803c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c07:	49 b8 12 02 80 00 00 	movabs $0x800212,%r8
+  803c0e:	00 00 00 
+  803c11:	41 ff d0             	call   *%r8
+
+0000000000803c14 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803c14:	55                   	push   %rbp
+  803c15:	48 89 e5             	mov    %rsp,%rbp
+  803c18:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803c1c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803c20:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  803c27:	00 00 00 
+  803c2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c2c:	85 c0                	test   %eax,%eax
+  803c2e:	78 35                	js     803c65 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803c30:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c34:	48 b8 70 1f 80 00 00 	movabs $0x801f70,%rax
+  803c3b:	00 00 00 
+  803c3e:	ff d0                	call   *%rax
+  803c40:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803c43:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c48:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c4d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c51:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  803c58:	00 00 00 
+  803c5b:	ff d0                	call   *%rax
+  803c5d:	85 c0                	test   %eax,%eax
+  803c5f:	0f 94 c0             	sete   %al
+  803c62:	0f b6 c0             	movzbl %al,%eax
+}
+  803c65:	c9                   	leave
+  803c66:	c3                   	ret
+
+0000000000803c67 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c67:	48 89 f8             	mov    %rdi,%rax
+  803c6a:	48 c1 e8 27          	shr    $0x27,%rax
+  803c6e:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803c75:	7f 00 00 
+  803c78:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c7c:	f6 c2 01             	test   $0x1,%dl
+  803c7f:	74 6d                	je     803cee <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c81:	48 89 f8             	mov    %rdi,%rax
+  803c84:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803c88:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c8f:	7f 00 00 
+  803c92:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c96:	f6 c2 01             	test   $0x1,%dl
+  803c99:	74 62                	je     803cfd <get_uvpt_entry+0x96>
+  803c9b:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ca2:	7f 00 00 
+  803ca5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ca9:	f6 c2 80             	test   $0x80,%dl
+  803cac:	75 4f                	jne    803cfd <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803cae:	48 89 f8             	mov    %rdi,%rax
+  803cb1:	48 c1 e8 15          	shr    $0x15,%rax
+  803cb5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803cbc:	7f 00 00 
+  803cbf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803cc3:	f6 c2 01             	test   $0x1,%dl
+  803cc6:	74 44                	je     803d0c <get_uvpt_entry+0xa5>
+  803cc8:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803ccf:	7f 00 00 
+  803cd2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803cd6:	f6 c2 80             	test   $0x80,%dl
+  803cd9:	75 31                	jne    803d0c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803cdb:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803cdf:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803ce6:	7f 00 00 
+  803ce9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803ced:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803cee:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803cf5:	7f 00 00 
+  803cf8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803cfc:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803cfd:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803d04:	7f 00 00 
+  803d07:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d0b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d0c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803d13:	7f 00 00 
+  803d16:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d1a:	c3                   	ret
+
+0000000000803d1b <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803d1b:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803d1e:	48 89 f9             	mov    %rdi,%rcx
+  803d21:	48 c1 e9 27          	shr    $0x27,%rcx
+  803d25:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803d2c:	7f 00 00 
+  803d2f:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803d33:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803d3a:	f6 c1 01             	test   $0x1,%cl
+  803d3d:	0f 84 b2 00 00 00    	je     803df5 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803d43:	48 89 f9             	mov    %rdi,%rcx
+  803d46:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803d4a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803d51:	7f 00 00 
+  803d54:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803d58:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803d5f:	40 f6 c6 01          	test   $0x1,%sil
+  803d63:	0f 84 8c 00 00 00    	je     803df5 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803d69:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803d70:	7f 00 00 
+  803d73:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d77:	a8 80                	test   $0x80,%al
+  803d79:	75 7b                	jne    803df6 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803d7b:	48 89 f9             	mov    %rdi,%rcx
+  803d7e:	48 c1 e9 15          	shr    $0x15,%rcx
+  803d82:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803d89:	7f 00 00 
+  803d8c:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803d90:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803d97:	40 f6 c6 01          	test   $0x1,%sil
+  803d9b:	74 58                	je     803df5 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803d9d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803da4:	7f 00 00 
+  803da7:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803dab:	a8 80                	test   $0x80,%al
+  803dad:	75 6c                	jne    803e1b <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803daf:	48 89 f9             	mov    %rdi,%rcx
+  803db2:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803db6:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803dbd:	7f 00 00 
+  803dc0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803dc4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803dcb:	40 f6 c6 01          	test   $0x1,%sil
+  803dcf:	74 24                	je     803df5 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803dd1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803dd8:	7f 00 00 
+  803ddb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ddf:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803de6:	ff ff 7f 
+  803de9:	48 21 c8             	and    %rcx,%rax
+  803dec:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803df2:	48 09 d0             	or     %rdx,%rax
+}
+  803df5:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803df6:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803dfd:	7f 00 00 
+  803e00:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e04:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e0b:	ff ff 7f 
+  803e0e:	48 21 c8             	and    %rcx,%rax
+  803e11:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803e17:	48 01 d0             	add    %rdx,%rax
+  803e1a:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803e1b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803e22:	7f 00 00 
+  803e25:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803e29:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803e30:	ff ff 7f 
+  803e33:	48 21 c8             	and    %rcx,%rax
+  803e36:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803e3c:	48 01 d0             	add    %rdx,%rax
+  803e3f:	c3                   	ret
+
+0000000000803e40 <get_prot>:
+
+int
+get_prot(void *va) {
+  803e40:	55                   	push   %rbp
+  803e41:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e44:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  803e4b:	00 00 00 
+  803e4e:	ff d0                	call   *%rax
+  803e50:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803e53:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803e58:	89 c1                	mov    %eax,%ecx
+  803e5a:	83 c9 04             	or     $0x4,%ecx
+  803e5d:	f6 c2 01             	test   $0x1,%dl
+  803e60:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803e63:	89 c1                	mov    %eax,%ecx
+  803e65:	83 c9 02             	or     $0x2,%ecx
+  803e68:	f6 c2 02             	test   $0x2,%dl
+  803e6b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803e6e:	89 c1                	mov    %eax,%ecx
+  803e70:	83 c9 01             	or     $0x1,%ecx
+  803e73:	48 85 d2             	test   %rdx,%rdx
+  803e76:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803e79:	89 c1                	mov    %eax,%ecx
+  803e7b:	83 c9 40             	or     $0x40,%ecx
+  803e7e:	f6 c6 04             	test   $0x4,%dh
+  803e81:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803e84:	5d                   	pop    %rbp
+  803e85:	c3                   	ret
+
+0000000000803e86 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803e86:	55                   	push   %rbp
+  803e87:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e8a:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  803e91:	00 00 00 
+  803e94:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803e96:	48 c1 e8 06          	shr    $0x6,%rax
+  803e9a:	83 e0 01             	and    $0x1,%eax
+}
+  803e9d:	5d                   	pop    %rbp
+  803e9e:	c3                   	ret
+
+0000000000803e9f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803e9f:	55                   	push   %rbp
+  803ea0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803ea3:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  803eaa:	00 00 00 
+  803ead:	ff d0                	call   *%rax
+  803eaf:	83 e0 01             	and    $0x1,%eax
+}
+  803eb2:	5d                   	pop    %rbp
+  803eb3:	c3                   	ret
+
+0000000000803eb4 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803eb4:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803ebb:	7f 00 00 
+  803ebe:	a8 01                	test   $0x1,%al
+  803ec0:	75 06                	jne    803ec8 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec7:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803ec8:	55                   	push   %rbp
+  803ec9:	48 89 e5             	mov    %rsp,%rbp
+  803ecc:	41 57                	push   %r15
+  803ece:	41 56                	push   %r14
+  803ed0:	41 55                	push   %r13
+  803ed2:	41 54                	push   %r12
+  803ed4:	53                   	push   %rbx
+  803ed5:	48 83 ec 18          	sub    $0x18,%rsp
+  803ed9:	49 89 fe             	mov    %rdi,%r14
+  803edc:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803edf:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803ee6:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803ee7:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803eee:	7f 00 00 
+  803ef1:	e9 81 00 00 00       	jmp    803f77 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803ef6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803efd:	49 39 dd             	cmp    %rbx,%r13
+  803f00:	74 2b                	je     803f2d <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803f02:	48 89 d8             	mov    %rbx,%rax
+  803f05:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f09:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803f0d:	f6 c2 01             	test   $0x1,%dl
+  803f10:	74 e4                	je     803ef6 <foreach_shared_region+0x42>
+  803f12:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803f16:	f6 c4 04             	test   $0x4,%ah
+  803f19:	74 db                	je     803ef6 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803f1b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803f22:	4c 89 fa             	mov    %r15,%rdx
+  803f25:	48 89 df             	mov    %rbx,%rdi
+  803f28:	41 ff d6             	call   *%r14
+  803f2b:	eb c9                	jmp    803ef6 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803f2d:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803f34:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803f38:	74 22                	je     803f5c <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803f3a:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803f41:	48 89 d8             	mov    %rbx,%rax
+  803f44:	48 c1 e8 15          	shr    $0x15,%rax
+  803f48:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803f4f:	7f 00 00 
+  803f52:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803f56:	a8 01                	test   $0x1,%al
+  803f58:	74 d3                	je     803f2d <foreach_shared_region+0x79>
+  803f5a:	eb a6                	jmp    803f02 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803f5c:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803f63:	40 
+  803f64:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f68:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f6f:	00 00 00 
+  803f72:	48 39 c1             	cmp    %rax,%rcx
+  803f75:	74 31                	je     803fa8 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803f77:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f7b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f7f:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803f86:	7f 00 00 
+  803f89:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803f8d:	a8 01                	test   $0x1,%al
+  803f8f:	74 cb                	je     803f5c <foreach_shared_region+0xa8>
+  803f91:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f95:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803f9c:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803fa2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803fa6:	eb 92                	jmp    803f3a <foreach_shared_region+0x86>
+}
+  803fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fad:	48 83 c4 18          	add    $0x18,%rsp
+  803fb1:	5b                   	pop    %rbx
+  803fb2:	41 5c                	pop    %r12
+  803fb4:	41 5d                	pop    %r13
+  803fb6:	41 5e                	pop    %r14
+  803fb8:	41 5f                	pop    %r15
+  803fba:	5d                   	pop    %rbp
+  803fbb:	c3                   	ret
+
+0000000000803fbc <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc1:	c3                   	ret
+
+0000000000803fc2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803fc2:	55                   	push   %rbp
+  803fc3:	48 89 e5             	mov    %rsp,%rbp
+  803fc6:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803fc9:	48 be 54 57 80 00 00 	movabs $0x805754,%rsi
+  803fd0:	00 00 00 
+  803fd3:	48 b8 da 0c 80 00 00 	movabs $0x800cda,%rax
+  803fda:	00 00 00 
+  803fdd:	ff d0                	call   *%rax
+    return 0;
+}
+  803fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe4:	5d                   	pop    %rbp
+  803fe5:	c3                   	ret
+
+0000000000803fe6 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803fe6:	55                   	push   %rbp
+  803fe7:	48 89 e5             	mov    %rsp,%rbp
+  803fea:	41 57                	push   %r15
+  803fec:	41 56                	push   %r14
+  803fee:	41 55                	push   %r13
+  803ff0:	41 54                	push   %r12
+  803ff2:	53                   	push   %rbx
+  803ff3:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803ffa:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804001:	48 85 d2             	test   %rdx,%rdx
+  804004:	74 7a                	je     804080 <devcons_write+0x9a>
+  804006:	49 89 d6             	mov    %rdx,%r14
+  804009:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80400f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804014:	49 bf 68 10 80 00 00 	movabs $0x801068,%r15
+  80401b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80401e:	4c 89 f3             	mov    %r14,%rbx
+  804021:	48 29 f3             	sub    %rsi,%rbx
+  804024:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804029:	48 39 c3             	cmp    %rax,%rbx
+  80402c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804030:	4c 63 eb             	movslq %ebx,%r13
+  804033:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80403a:	48 01 c6             	add    %rax,%rsi
+  80403d:	4c 89 ea             	mov    %r13,%rdx
+  804040:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804047:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80404a:	4c 89 ee             	mov    %r13,%rsi
+  80404d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804054:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  80405b:	00 00 00 
+  80405e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804060:	41 01 dc             	add    %ebx,%r12d
+  804063:	49 63 f4             	movslq %r12d,%rsi
+  804066:	4c 39 f6             	cmp    %r14,%rsi
+  804069:	72 b3                	jb     80401e <devcons_write+0x38>
+    return res;
+  80406b:	49 63 c4             	movslq %r12d,%rax
+}
+  80406e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804075:	5b                   	pop    %rbx
+  804076:	41 5c                	pop    %r12
+  804078:	41 5d                	pop    %r13
+  80407a:	41 5e                	pop    %r14
+  80407c:	41 5f                	pop    %r15
+  80407e:	5d                   	pop    %rbp
+  80407f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804080:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804086:	eb e3                	jmp    80406b <devcons_write+0x85>
+
+0000000000804088 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804088:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80408b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804090:	48 85 c0             	test   %rax,%rax
+  804093:	74 55                	je     8040ea <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804095:	55                   	push   %rbp
+  804096:	48 89 e5             	mov    %rsp,%rbp
+  804099:	41 55                	push   %r13
+  80409b:	41 54                	push   %r12
+  80409d:	53                   	push   %rbx
+  80409e:	48 83 ec 08          	sub    $0x8,%rsp
+  8040a2:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8040a5:	48 bb de 12 80 00 00 	movabs $0x8012de,%rbx
+  8040ac:	00 00 00 
+  8040af:	49 bc ab 13 80 00 00 	movabs $0x8013ab,%r12
+  8040b6:	00 00 00 
+  8040b9:	eb 03                	jmp    8040be <devcons_read+0x36>
+  8040bb:	41 ff d4             	call   *%r12
+  8040be:	ff d3                	call   *%rbx
+  8040c0:	85 c0                	test   %eax,%eax
+  8040c2:	74 f7                	je     8040bb <devcons_read+0x33>
+    if (c < 0) return c;
+  8040c4:	48 63 d0             	movslq %eax,%rdx
+  8040c7:	78 13                	js     8040dc <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8040c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040ce:	83 f8 04             	cmp    $0x4,%eax
+  8040d1:	74 09                	je     8040dc <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8040d3:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8040d7:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8040dc:	48 89 d0             	mov    %rdx,%rax
+  8040df:	48 83 c4 08          	add    $0x8,%rsp
+  8040e3:	5b                   	pop    %rbx
+  8040e4:	41 5c                	pop    %r12
+  8040e6:	41 5d                	pop    %r13
+  8040e8:	5d                   	pop    %rbp
+  8040e9:	c3                   	ret
+  8040ea:	48 89 d0             	mov    %rdx,%rax
+  8040ed:	c3                   	ret
+
+00000000008040ee <cputchar>:
+cputchar(int ch) {
+  8040ee:	55                   	push   %rbp
+  8040ef:	48 89 e5             	mov    %rsp,%rbp
+  8040f2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8040f6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8040fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8040ff:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804103:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  80410a:	00 00 00 
+  80410d:	ff d0                	call   *%rax
+}
+  80410f:	c9                   	leave
+  804110:	c3                   	ret
+
+0000000000804111 <getchar>:
+getchar(void) {
+  804111:	55                   	push   %rbp
+  804112:	48 89 e5             	mov    %rsp,%rbp
+  804115:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804119:	ba 01 00 00 00       	mov    $0x1,%edx
+  80411e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804122:	bf 00 00 00 00       	mov    $0x0,%edi
+  804127:	48 b8 cf 22 80 00 00 	movabs $0x8022cf,%rax
+  80412e:	00 00 00 
+  804131:	ff d0                	call   *%rax
+  804133:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804135:	85 c0                	test   %eax,%eax
+  804137:	78 06                	js     80413f <getchar+0x2e>
+  804139:	74 08                	je     804143 <getchar+0x32>
+  80413b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80413f:	89 d0                	mov    %edx,%eax
+  804141:	c9                   	leave
+  804142:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804143:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804148:	eb f5                	jmp    80413f <getchar+0x2e>
+
+000000000080414a <iscons>:
+iscons(int fdnum) {
+  80414a:	55                   	push   %rbp
+  80414b:	48 89 e5             	mov    %rsp,%rbp
+  80414e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804152:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804156:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  80415d:	00 00 00 
+  804160:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804162:	85 c0                	test   %eax,%eax
+  804164:	78 18                	js     80417e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804166:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80416a:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804171:	00 00 00 
+  804174:	8b 00                	mov    (%rax),%eax
+  804176:	39 02                	cmp    %eax,(%rdx)
+  804178:	0f 94 c0             	sete   %al
+  80417b:	0f b6 c0             	movzbl %al,%eax
+}
+  80417e:	c9                   	leave
+  80417f:	c3                   	ret
+
+0000000000804180 <opencons>:
+opencons(void) {
+  804180:	55                   	push   %rbp
+  804181:	48 89 e5             	mov    %rsp,%rbp
+  804184:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804188:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80418c:	48 b8 8c 1f 80 00 00 	movabs $0x801f8c,%rax
+  804193:	00 00 00 
+  804196:	ff d0                	call   *%rax
+  804198:	85 c0                	test   %eax,%eax
+  80419a:	78 49                	js     8041e5 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80419c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8041a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041a6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8041aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041af:	48 b8 3a 14 80 00 00 	movabs $0x80143a,%rax
+  8041b6:	00 00 00 
+  8041b9:	ff d0                	call   *%rax
+  8041bb:	85 c0                	test   %eax,%eax
+  8041bd:	78 26                	js     8041e5 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8041bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041c3:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8041ca:	00 00 
+  8041cc:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8041ce:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041d2:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8041d9:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  8041e0:	00 00 00 
+  8041e3:	ff d0                	call   *%rax
+}
+  8041e5:	c9                   	leave
+  8041e6:	c3                   	ret
+
+00000000008041e7 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8041e7:	55                   	push   %rbp
+  8041e8:	48 89 e5             	mov    %rsp,%rbp
+  8041eb:	41 55                	push   %r13
+  8041ed:	41 54                	push   %r12
+  8041ef:	53                   	push   %rbx
+  8041f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8041f4:	49 89 fc             	mov    %rdi,%r12
+  8041f7:	48 89 f7             	mov    %rsi,%rdi
+  8041fa:	48 89 d3             	mov    %rdx,%rbx
+  8041fd:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804200:	48 85 f6             	test   %rsi,%rsi
+  804203:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80420a:	00 00 00 
+  80420d:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804211:	be 00 10 00 00       	mov    $0x1000,%esi
+  804216:	48 85 d2             	test   %rdx,%rdx
+  804219:	74 03                	je     80421e <ipc_recv+0x37>
+  80421b:	48 8b 32             	mov    (%rdx),%rsi
+  80421e:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  804225:	00 00 00 
+  804228:	ff d0                	call   *%rax
+    if (errno) {
+  80422a:	85 c0                	test   %eax,%eax
+  80422c:	74 1c                	je     80424a <ipc_recv+0x63>
+        if (from_env_store)
+  80422e:	4d 85 e4             	test   %r12,%r12
+  804231:	74 08                	je     80423b <ipc_recv+0x54>
+            *from_env_store = 0;
+  804233:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80423a:	00 
+
+        if (perm_store)
+  80423b:	4d 85 ed             	test   %r13,%r13
+  80423e:	74 74                	je     8042b4 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804240:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804247:	00 
+  804248:	eb 6a                	jmp    8042b4 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80424a:	4d 85 e4             	test   %r12,%r12
+  80424d:	74 14                	je     804263 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80424f:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804256:	00 00 00 
+  804259:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80425f:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804263:	48 85 db             	test   %rbx,%rbx
+  804266:	74 23                	je     80428b <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804268:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80426f:	00 00 00 
+  804272:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804278:	ba 00 00 00 00       	mov    $0x0,%edx
+  80427d:	85 c9                	test   %ecx,%ecx
+  80427f:	74 07                	je     804288 <ipc_recv+0xa1>
+  804281:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804288:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80428b:	4d 85 ed             	test   %r13,%r13
+  80428e:	74 14                	je     8042a4 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804290:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804297:	00 00 00 
+  80429a:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8042a0:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8042a4:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  8042ab:	00 00 00 
+  8042ae:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8042b4:	48 83 c4 08          	add    $0x8,%rsp
+  8042b8:	5b                   	pop    %rbx
+  8042b9:	41 5c                	pop    %r12
+  8042bb:	41 5d                	pop    %r13
+  8042bd:	5d                   	pop    %rbp
+  8042be:	c3                   	ret
+
+00000000008042bf <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8042bf:	55                   	push   %rbp
+  8042c0:	48 89 e5             	mov    %rsp,%rbp
+  8042c3:	41 55                	push   %r13
+  8042c5:	41 54                	push   %r12
+  8042c7:	53                   	push   %rbx
+  8042c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8042cc:	49 89 fc             	mov    %rdi,%r12
+  8042cf:	48 89 f7             	mov    %rsi,%rdi
+  8042d2:	48 89 d3             	mov    %rdx,%rbx
+  8042d5:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8042d8:	48 85 f6             	test   %rsi,%rsi
+  8042db:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8042e2:	00 00 00 
+  8042e5:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8042e9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042ee:	48 85 d2             	test   %rdx,%rdx
+  8042f1:	74 03                	je     8042f6 <ipc_try_recv+0x37>
+  8042f3:	48 8b 32             	mov    (%rdx),%rsi
+  8042f6:	48 b8 50 18 80 00 00 	movabs $0x801850,%rax
+  8042fd:	00 00 00 
+  804300:	ff d0                	call   *%rax
+    if (errno) {
+  804302:	85 c0                	test   %eax,%eax
+  804304:	75 75                	jne    80437b <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804306:	4d 85 e4             	test   %r12,%r12
+  804309:	74 14                	je     80431f <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  80430b:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804312:	00 00 00 
+  804315:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80431b:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80431f:	48 85 db             	test   %rbx,%rbx
+  804322:	74 23                	je     804347 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804324:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  80432b:	00 00 00 
+  80432e:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804334:	ba 00 00 00 00       	mov    $0x0,%edx
+  804339:	85 c9                	test   %ecx,%ecx
+  80433b:	74 07                	je     804344 <ipc_try_recv+0x85>
+  80433d:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804344:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804347:	4d 85 ed             	test   %r13,%r13
+  80434a:	74 14                	je     804360 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  80434c:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804353:	00 00 00 
+  804356:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80435c:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804360:	48 a1 08 70 80 00 00 	movabs 0x807008,%rax
+  804367:	00 00 00 
+  80436a:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804370:	48 83 c4 08          	add    $0x8,%rsp
+  804374:	5b                   	pop    %rbx
+  804375:	41 5c                	pop    %r12
+  804377:	41 5d                	pop    %r13
+  804379:	5d                   	pop    %rbp
+  80437a:	c3                   	ret
+        if (from_env_store)
+  80437b:	4d 85 e4             	test   %r12,%r12
+  80437e:	74 08                	je     804388 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804380:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804387:	00 
+        if (perm_store)
+  804388:	4d 85 ed             	test   %r13,%r13
+  80438b:	74 e3                	je     804370 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80438d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804394:	00 
+  804395:	eb d9                	jmp    804370 <ipc_try_recv+0xb1>
+
+0000000000804397 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804397:	55                   	push   %rbp
+  804398:	48 89 e5             	mov    %rsp,%rbp
+  80439b:	41 57                	push   %r15
+  80439d:	41 56                	push   %r14
+  80439f:	41 55                	push   %r13
+  8043a1:	41 54                	push   %r12
+  8043a3:	53                   	push   %rbx
+  8043a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8043a8:	41 89 fd             	mov    %edi,%r13d
+  8043ab:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8043ae:	48 89 d3             	mov    %rdx,%rbx
+  8043b1:	49 89 cc             	mov    %rcx,%r12
+  8043b4:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8043b8:	48 85 d2             	test   %rdx,%rdx
+  8043bb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8043c2:	00 00 00 
+  8043c5:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8043c9:	49 be bb 17 80 00 00 	movabs $0x8017bb,%r14
+  8043d0:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8043d3:	49 bf ab 13 80 00 00 	movabs $0x8013ab,%r15
+  8043da:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8043dd:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8043e0:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8043e4:	4c 89 e1             	mov    %r12,%rcx
+  8043e7:	48 89 da             	mov    %rbx,%rdx
+  8043ea:	44 89 ef             	mov    %r13d,%edi
+  8043ed:	41 ff d6             	call   *%r14
+  8043f0:	85 c0                	test   %eax,%eax
+  8043f2:	74 37                	je     80442b <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8043f4:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8043f7:	75 05                	jne    8043fe <ipc_send+0x67>
+        sys_yield();
+  8043f9:	41 ff d7             	call   *%r15
+  8043fc:	eb df                	jmp    8043dd <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8043fe:	89 c1                	mov    %eax,%ecx
+  804400:	48 ba 60 57 80 00 00 	movabs $0x805760,%rdx
+  804407:	00 00 00 
+  80440a:	be 65 00 00 00       	mov    $0x65,%esi
+  80440f:	48 bf 7b 57 80 00 00 	movabs $0x80577b,%rdi
+  804416:	00 00 00 
+  804419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80441e:	49 b8 12 02 80 00 00 	movabs $0x800212,%r8
+  804425:	00 00 00 
+  804428:	41 ff d0             	call   *%r8
+    }
+}
+  80442b:	48 83 c4 18          	add    $0x18,%rsp
+  80442f:	5b                   	pop    %rbx
+  804430:	41 5c                	pop    %r12
+  804432:	41 5d                	pop    %r13
+  804434:	41 5e                	pop    %r14
+  804436:	41 5f                	pop    %r15
+  804438:	5d                   	pop    %rbp
+  804439:	c3                   	ret
+
+000000000080443a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80443a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80443f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804446:	00 00 00 
+  804449:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804450:	48 01 ca             	add    %rcx,%rdx
+  804453:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804459:	39 fa                	cmp    %edi,%edx
+  80445b:	74 12                	je     80446f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80445d:	48 83 c0 01          	add    $0x1,%rax
+  804461:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804467:	75 e0                	jne    804449 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804469:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80446e:	c3                   	ret
+            return envs[i].env_id;
+  80446f:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804476:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80447d:	00 00 00 
+  804480:	48 01 d0             	add    %rdx,%rax
+  804483:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804489:	c3                   	ret
+
+000000000080448a <__text_end>:
+  80448a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804491:	00 00 00 
+  804494:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80449b:	00 00 00 
+  80449e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a5:	00 00 00 
+  8044a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044af:	00 00 00 
+  8044b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b9:	00 00 00 
+  8044bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c3:	00 00 00 
+  8044c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cd:	00 00 00 
+  8044d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d7:	00 00 00 
+  8044da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e1:	00 00 00 
+  8044e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044eb:	00 00 00 
+  8044ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f5:	00 00 00 
+  8044f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ff:	00 00 00 
+  804502:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804509:	00 00 00 
+  80450c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804513:	00 00 00 
+  804516:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451d:	00 00 00 
+  804520:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804527:	00 00 00 
+  80452a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804531:	00 00 00 
+  804534:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80453b:	00 00 00 
+  80453e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804545:	00 00 00 
+  804548:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454f:	00 00 00 
+  804552:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804559:	00 00 00 
+  80455c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804563:	00 00 00 
+  804566:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456d:	00 00 00 
+  804570:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804577:	00 00 00 
+  80457a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804581:	00 00 00 
+  804584:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80458b:	00 00 00 
+  80458e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804595:	00 00 00 
+  804598:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459f:	00 00 00 
+  8045a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a9:	00 00 00 
+  8045ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b3:	00 00 00 
+  8045b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bd:	00 00 00 
+  8045c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c7:	00 00 00 
+  8045ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d1:	00 00 00 
+  8045d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045db:	00 00 00 
+  8045de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e5:	00 00 00 
+  8045e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ef:	00 00 00 
+  8045f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f9:	00 00 00 
+  8045fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804603:	00 00 00 
+  804606:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460d:	00 00 00 
+  804610:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804617:	00 00 00 
+  80461a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804621:	00 00 00 
+  804624:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80462b:	00 00 00 
+  80462e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804635:	00 00 00 
+  804638:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463f:	00 00 00 
+  804642:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804649:	00 00 00 
+  80464c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804653:	00 00 00 
+  804656:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465d:	00 00 00 
+  804660:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804667:	00 00 00 
+  80466a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804671:	00 00 00 
+  804674:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80467b:	00 00 00 
+  80467e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804685:	00 00 00 
+  804688:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468f:	00 00 00 
+  804692:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804699:	00 00 00 
+  80469c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a3:	00 00 00 
+  8046a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ad:	00 00 00 
+  8046b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b7:	00 00 00 
+  8046ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c1:	00 00 00 
+  8046c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cb:	00 00 00 
+  8046ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d5:	00 00 00 
+  8046d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046df:	00 00 00 
+  8046e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e9:	00 00 00 
+  8046ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f3:	00 00 00 
+  8046f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fd:	00 00 00 
+  804700:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804707:	00 00 00 
+  80470a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804711:	00 00 00 
+  804714:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471b:	00 00 00 
+  80471e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804725:	00 00 00 
+  804728:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472f:	00 00 00 
+  804732:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804739:	00 00 00 
+  80473c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804743:	00 00 00 
+  804746:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474d:	00 00 00 
+  804750:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804757:	00 00 00 
+  80475a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804761:	00 00 00 
+  804764:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476b:	00 00 00 
+  80476e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804775:	00 00 00 
+  804778:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477f:	00 00 00 
+  804782:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804789:	00 00 00 
+  80478c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804793:	00 00 00 
+  804796:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479d:	00 00 00 
+  8047a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a7:	00 00 00 
+  8047aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b1:	00 00 00 
+  8047b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bb:	00 00 00 
+  8047be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c5:	00 00 00 
+  8047c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cf:	00 00 00 
+  8047d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d9:	00 00 00 
+  8047dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e3:	00 00 00 
+  8047e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ed:	00 00 00 
+  8047f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f7:	00 00 00 
+  8047fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804801:	00 00 00 
+  804804:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480b:	00 00 00 
+  80480e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804815:	00 00 00 
+  804818:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481f:	00 00 00 
+  804822:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804829:	00 00 00 
+  80482c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804833:	00 00 00 
+  804836:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483d:	00 00 00 
+  804840:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804847:	00 00 00 
+  80484a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804851:	00 00 00 
+  804854:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485b:	00 00 00 
+  80485e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804865:	00 00 00 
+  804868:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486f:	00 00 00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804883:	00 00 00 
+  804886:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488d:	00 00 00 
+  804890:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804897:	00 00 00 
+  80489a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a1:	00 00 00 
+  8048a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ab:	00 00 00 
+  8048ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b5:	00 00 00 
+  8048b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bf:	00 00 00 
+  8048c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c9:	00 00 00 
+  8048cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d3:	00 00 00 
+  8048d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048dd:	00 00 00 
+  8048e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e7:	00 00 00 
+  8048ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f1:	00 00 00 
+  8048f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fb:	00 00 00 
+  8048fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804905:	00 00 00 
+  804908:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490f:	00 00 00 
+  804912:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804919:	00 00 00 
+  80491c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804923:	00 00 00 
+  804926:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492d:	00 00 00 
+  804930:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804937:	00 00 00 
+  80493a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804941:	00 00 00 
+  804944:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494b:	00 00 00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495f:	00 00 00 
+  804962:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804969:	00 00 00 
+  80496c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804973:	00 00 00 
+  804976:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497d:	00 00 00 
+  804980:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804987:	00 00 00 
+  80498a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804991:	00 00 00 
+  804994:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499b:	00 00 00 
+  80499e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a5:	00 00 00 
+  8049a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049af:	00 00 00 
+  8049b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b9:	00 00 00 
+  8049bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c3:	00 00 00 
+  8049c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cd:	00 00 00 
+  8049d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d7:	00 00 00 
+  8049da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e1:	00 00 00 
+  8049e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049eb:	00 00 00 
+  8049ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f5:	00 00 00 
+  8049f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ff:	00 00 00 
+  804a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a09:	00 00 00 
+  804a0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a13:	00 00 00 
+  804a16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1d:	00 00 00 
+  804a20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a27:	00 00 00 
+  804a2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a31:	00 00 00 
+  804a34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3b:	00 00 00 
+  804a3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a45:	00 00 00 
+  804a48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4f:	00 00 00 
+  804a52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a59:	00 00 00 
+  804a5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a63:	00 00 00 
+  804a66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6d:	00 00 00 
+  804a70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a77:	00 00 00 
+  804a7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a81:	00 00 00 
+  804a84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8b:	00 00 00 
+  804a8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a95:	00 00 00 
+  804a98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9f:	00 00 00 
+  804aa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa9:	00 00 00 
+  804aac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab3:	00 00 00 
+  804ab6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abd:	00 00 00 
+  804ac0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac7:	00 00 00 
+  804aca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad1:	00 00 00 
+  804ad4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adb:	00 00 00 
+  804ade:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae5:	00 00 00 
+  804ae8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aef:	00 00 00 
+  804af2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af9:	00 00 00 
+  804afc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b03:	00 00 00 
+  804b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0d:	00 00 00 
+  804b10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b17:	00 00 00 
+  804b1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b21:	00 00 00 
+  804b24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2b:	00 00 00 
+  804b2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b35:	00 00 00 
+  804b38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3f:	00 00 00 
+  804b42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b49:	00 00 00 
+  804b4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b53:	00 00 00 
+  804b56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5d:	00 00 00 
+  804b60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b67:	00 00 00 
+  804b6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b71:	00 00 00 
+  804b74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7b:	00 00 00 
+  804b7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b85:	00 00 00 
+  804b88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8f:	00 00 00 
+  804b92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b99:	00 00 00 
+  804b9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba3:	00 00 00 
+  804ba6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bad:	00 00 00 
+  804bb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb7:	00 00 00 
+  804bba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc1:	00 00 00 
+  804bc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcb:	00 00 00 
+  804bce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd5:	00 00 00 
+  804bd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdf:	00 00 00 
+  804be2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be9:	00 00 00 
+  804bec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf3:	00 00 00 
+  804bf6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfd:	00 00 00 
+  804c00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c07:	00 00 00 
+  804c0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c11:	00 00 00 
+  804c14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1b:	00 00 00 
+  804c1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c25:	00 00 00 
+  804c28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2f:	00 00 00 
+  804c32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c39:	00 00 00 
+  804c3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c43:	00 00 00 
+  804c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4d:	00 00 00 
+  804c50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c57:	00 00 00 
+  804c5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c61:	00 00 00 
+  804c64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6b:	00 00 00 
+  804c6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c75:	00 00 00 
+  804c78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7f:	00 00 00 
+  804c82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c89:	00 00 00 
+  804c8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c93:	00 00 00 
+  804c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9d:	00 00 00 
+  804ca0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca7:	00 00 00 
+  804caa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb1:	00 00 00 
+  804cb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbb:	00 00 00 
+  804cbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc5:	00 00 00 
+  804cc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccf:	00 00 00 
+  804cd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd9:	00 00 00 
+  804cdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce3:	00 00 00 
+  804ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ced:	00 00 00 
+  804cf0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf7:	00 00 00 
+  804cfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d01:	00 00 00 
+  804d04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0b:	00 00 00 
+  804d0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d15:	00 00 00 
+  804d18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1f:	00 00 00 
+  804d22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d29:	00 00 00 
+  804d2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d33:	00 00 00 
+  804d36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3d:	00 00 00 
+  804d40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d47:	00 00 00 
+  804d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d51:	00 00 00 
+  804d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5b:	00 00 00 
+  804d5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d65:	00 00 00 
+  804d68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6f:	00 00 00 
+  804d72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d79:	00 00 00 
+  804d7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d83:	00 00 00 
+  804d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8d:	00 00 00 
+  804d90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d97:	00 00 00 
+  804d9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da1:	00 00 00 
+  804da4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dab:	00 00 00 
+  804dae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db5:	00 00 00 
+  804db8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbf:	00 00 00 
+  804dc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc9:	00 00 00 
+  804dcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd3:	00 00 00 
+  804dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddd:	00 00 00 
+  804de0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de7:	00 00 00 
+  804dea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df1:	00 00 00 
+  804df4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfb:	00 00 00 
+  804dfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e05:	00 00 00 
+  804e08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0f:	00 00 00 
+  804e12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e19:	00 00 00 
+  804e1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e23:	00 00 00 
+  804e26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2d:	00 00 00 
+  804e30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e37:	00 00 00 
+  804e3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e41:	00 00 00 
+  804e44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4b:	00 00 00 
+  804e4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e55:	00 00 00 
+  804e58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5f:	00 00 00 
+  804e62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e69:	00 00 00 
+  804e6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e73:	00 00 00 
+  804e76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7d:	00 00 00 
+  804e80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e87:	00 00 00 
+  804e8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e91:	00 00 00 
+  804e94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9b:	00 00 00 
+  804e9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea5:	00 00 00 
+  804ea8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eaf:	00 00 00 
+  804eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb9:	00 00 00 
+  804ebc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec3:	00 00 00 
+  804ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecd:	00 00 00 
+  804ed0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed7:	00 00 00 
+  804eda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee1:	00 00 00 
+  804ee4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eeb:	00 00 00 
+  804eee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef5:	00 00 00 
+  804ef8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eff:	00 00 00 
+  804f02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f09:	00 00 00 
+  804f0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f13:	00 00 00 
+  804f16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1d:	00 00 00 
+  804f20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f27:	00 00 00 
+  804f2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f31:	00 00 00 
+  804f34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3b:	00 00 00 
+  804f3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f45:	00 00 00 
+  804f48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4f:	00 00 00 
+  804f52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f59:	00 00 00 
+  804f5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f63:	00 00 00 
+  804f66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6d:	00 00 00 
+  804f70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f77:	00 00 00 
+  804f7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f81:	00 00 00 
+  804f84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8b:	00 00 00 
+  804f8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f95:	00 00 00 
+  804f98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9f:	00 00 00 
+  804fa2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa9:	00 00 00 
+  804fac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb3:	00 00 00 
+  804fb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbd:	00 00 00 
+  804fc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc7:	00 00 00 
+  804fca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd1:	00 00 00 
+  804fd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdb:	00 00 00 
+  804fde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe5:	00 00 00 
+  804fe8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fef:	00 00 00 
+  804ff2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff9:	00 00 00 
+  804ffc:	0f 1f 40 00          	nopl   0x0(%rax)
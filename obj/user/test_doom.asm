@@ -0,0 +1,8355 @@
+
+obj/user/test_doom:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 07 05 00 00       	call   80052a <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+    printf("Testing string funcs:\n");
+  800039:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800040:	00 00 00 
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	48 bb 19 31 80 00 00 	movabs $0x803119,%rbx
+  80004f:	00 00 00 
+  800052:	ff d3                	call   *%rbx
+    int i = -3;
+    char c = 'a';
+    char a[9] = "abcdzbcd", b[5] = "zbcd";
+  800054:	48 b8 61 62 63 64 7a 	movabs $0x6463627a64636261,%rax
+  80005b:	62 63 64 
+  80005e:	48 89 45 c7          	mov    %rax,-0x39(%rbp)
+  800062:	c6 45 cf 00          	movb   $0x0,-0x31(%rbp)
+  800066:	c7 45 c2 7a 62 63 64 	movl   $0x6463627a,-0x3e(%rbp)
+  80006d:	c6 45 c6 00          	movb   $0x0,-0x3a(%rbp)
+    printf("%d\n", abs(i));
+  800071:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+  800076:	48 b8 0c 09 80 00 00 	movabs $0x80090c,%rax
+  80007d:	00 00 00 
+  800080:	ff d0                	call   *%rax
+  800082:	89 c6                	mov    %eax,%esi
+  800084:	48 bf 35 50 80 00 00 	movabs $0x805035,%rdi
+  80008b:	00 00 00 
+  80008e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800093:	ff d3                	call   *%rbx
+    printf("%c\n", toupper(c));
+  800095:	bf 61 00 00 00       	mov    $0x61,%edi
+  80009a:	49 bd f3 08 80 00 00 	movabs $0x8008f3,%r13
+  8000a1:	00 00 00 
+  8000a4:	41 ff d5             	call   *%r13
+  8000a7:	89 c6                	mov    %eax,%esi
+  8000a9:	49 bc 17 50 80 00 00 	movabs $0x805017,%r12
+  8000b0:	00 00 00 
+  8000b3:	4c 89 e7             	mov    %r12,%rdi
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	ff d3                	call   *%rbx
+    printf("%c\n", tolower(toupper(c)));
+  8000bd:	bf 61 00 00 00       	mov    $0x61,%edi
+  8000c2:	41 ff d5             	call   *%r13
+  8000c5:	89 c7                	mov    %eax,%edi
+  8000c7:	48 b8 12 08 80 00 00 	movabs $0x800812,%rax
+  8000ce:	00 00 00 
+  8000d1:	ff d0                	call   *%rax
+  8000d3:	89 c6                	mov    %eax,%esi
+  8000d5:	4c 89 e7             	mov    %r12,%rdi
+  8000d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000dd:	ff d3                	call   *%rbx
+    printf("%s\n", strstr(a, b));
+  8000df:	48 8d 75 c2          	lea    -0x3e(%rbp),%rsi
+  8000e3:	48 8d 7d c7          	lea    -0x39(%rbp),%rdi
+  8000e7:	48 b8 80 07 80 00 00 	movabs $0x800780,%rax
+  8000ee:	00 00 00 
+  8000f1:	ff d0                	call   *%rax
+  8000f3:	48 89 c6             	mov    %rax,%rsi
+  8000f6:	49 bf 1b 50 80 00 00 	movabs $0x80501b,%r15
+  8000fd:	00 00 00 
+  800100:	4c 89 ff             	mov    %r15,%rdi
+  800103:	b8 00 00 00 00       	mov    $0x0,%eax
+  800108:	ff d3                	call   *%rbx
+    puts("abcd");
+  80010a:	48 bf 1f 50 80 00 00 	movabs $0x80501f,%rdi
+  800111:	00 00 00 
+  800114:	48 b8 66 31 80 00 00 	movabs $0x803166,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+    printf("strdup: (empty string) %s (normal string) %s\n\n", strdup(""), strdup(a));
+  800120:	48 8d 7d c7          	lea    -0x39(%rbp),%rdi
+  800124:	49 bd fe 15 80 00 00 	movabs $0x8015fe,%r13
+  80012b:	00 00 00 
+  80012e:	41 ff d5             	call   *%r13
+  800131:	49 89 c4             	mov    %rax,%r12
+  800134:	48 bf bb 50 80 00 00 	movabs $0x8050bb,%rdi
+  80013b:	00 00 00 
+  80013e:	41 ff d5             	call   *%r13
+  800141:	48 89 c6             	mov    %rax,%rsi
+  800144:	4c 89 e2             	mov    %r12,%rdx
+  800147:	48 bf 28 51 80 00 00 	movabs $0x805128,%rdi
+  80014e:	00 00 00 
+  800151:	b8 00 00 00 00       	mov    $0x0,%eax
+  800156:	ff d3                	call   *%rbx
+
+    printf("Testing file funcs (tell, seek-to-end):\n");
+  800158:	48 bf 58 51 80 00 00 	movabs $0x805158,%rdi
+  80015f:	00 00 00 
+  800162:	b8 00 00 00 00       	mov    $0x0,%eax
+  800167:	ff d3                	call   *%rbx
+    struct Stat st;
+    stat("/doom1.wad", &st);
+  800169:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800170:	49 bc 24 50 80 00 00 	movabs $0x805024,%r12
+  800177:	00 00 00 
+  80017a:	4c 89 e7             	mov    %r12,%rdi
+  80017d:	48 b8 31 1f 80 00 00 	movabs $0x801f31,%rax
+  800184:	00 00 00 
+  800187:	ff d0                	call   *%rax
+    printf("size: %d\n", st.st_size);
+  800189:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  80018c:	48 bf 2f 50 80 00 00 	movabs $0x80502f,%rdi
+  800193:	00 00 00 
+  800196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019b:	ff d3                	call   *%rbx
+    int fd = open("/doom1.wad", O_RDONLY);
+  80019d:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a2:	4c 89 e7             	mov    %r12,%rdi
+  8001a5:	48 b8 24 2b 80 00 00 	movabs $0x802b24,%rax
+  8001ac:	00 00 00 
+  8001af:	ff d0                	call   *%rax
+  8001b1:	41 89 c4             	mov    %eax,%r12d
+    seek(fd, 3);
+  8001b4:	be 03 00 00 00       	mov    $0x3,%esi
+  8001b9:	89 c7                	mov    %eax,%edi
+  8001bb:	49 bd 03 1d 80 00 00 	movabs $0x801d03,%r13
+  8001c2:	00 00 00 
+  8001c5:	41 ff d5             	call   *%r13
+    printf("seek 3 tell: %d\n", tell(fd));
+  8001c8:	44 89 e7             	mov    %r12d,%edi
+  8001cb:	49 be 34 1d 80 00 00 	movabs $0x801d34,%r14
+  8001d2:	00 00 00 
+  8001d5:	41 ff d6             	call   *%r14
+  8001d8:	89 c6                	mov    %eax,%esi
+  8001da:	48 bf 39 50 80 00 00 	movabs $0x805039,%rdi
+  8001e1:	00 00 00 
+  8001e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e9:	ff d3                	call   *%rbx
+    seek(fd, 5);
+  8001eb:	be 05 00 00 00       	mov    $0x5,%esi
+  8001f0:	44 89 e7             	mov    %r12d,%edi
+  8001f3:	41 ff d5             	call   *%r13
+    printf("seek 5 tell: %d\n", tell(fd));
+  8001f6:	44 89 e7             	mov    %r12d,%edi
+  8001f9:	41 ff d6             	call   *%r14
+  8001fc:	89 c6                	mov    %eax,%esi
+  8001fe:	48 bf 4a 50 80 00 00 	movabs $0x80504a,%rdi
+  800205:	00 00 00 
+  800208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020d:	ff d3                	call   *%rbx
+    seekfromcur(fd, 5);
+  80020f:	be 05 00 00 00       	mov    $0x5,%esi
+  800214:	44 89 e7             	mov    %r12d,%edi
+  800217:	48 b8 7d 1e 80 00 00 	movabs $0x801e7d,%rax
+  80021e:	00 00 00 
+  800221:	ff d0                	call   *%rax
+    printf("seekfromcur 5 tell: %d\n", tell(fd));
+  800223:	44 89 e7             	mov    %r12d,%edi
+  800226:	41 ff d6             	call   *%r14
+  800229:	89 c6                	mov    %eax,%esi
+  80022b:	48 bf 5b 50 80 00 00 	movabs $0x80505b,%rdi
+  800232:	00 00 00 
+  800235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023a:	ff d3                	call   *%rbx
+    seektoend(fd);
+  80023c:	44 89 e7             	mov    %r12d,%edi
+  80023f:	48 b8 e1 1e 80 00 00 	movabs $0x801ee1,%rax
+  800246:	00 00 00 
+  800249:	ff d0                	call   *%rax
+    printf("seektoend tell: %d\n", tell(fd));
+  80024b:	44 89 e7             	mov    %r12d,%edi
+  80024e:	41 ff d6             	call   *%r14
+  800251:	89 c6                	mov    %eax,%esi
+  800253:	48 bf 73 50 80 00 00 	movabs $0x805073,%rdi
+  80025a:	00 00 00 
+  80025d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800262:	ff d3                	call   *%rbx
+    void *buf = malloc(100000);
+  800264:	bf a0 86 01 00       	mov    $0x186a0,%edi
+  800269:	49 be 08 12 80 00 00 	movabs $0x801208,%r14
+  800270:	00 00 00 
+  800273:	41 ff d6             	call   *%r14
+  800276:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+    seek(fd, 0);
+  80027d:	be 00 00 00 00       	mov    $0x0,%esi
+  800282:	44 89 e7             	mov    %r12d,%edi
+  800285:	41 ff d5             	call   *%r13
+    size_t rd = read(fd, buf, 9234);
+  800288:	ba 12 24 00 00       	mov    $0x2412,%edx
+  80028d:	4c 8b ad 28 ff ff ff 	mov    -0xd8(%rbp),%r13
+  800294:	4c 89 ee             	mov    %r13,%rsi
+  800297:	44 89 e7             	mov    %r12d,%edi
+  80029a:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  8002a1:	00 00 00 
+  8002a4:	ff d0                	call   *%rax
+  8002a6:	48 89 c6             	mov    %rax,%rsi
+    printf("read: %lu\n\n", rd);
+  8002a9:	48 bf 87 50 80 00 00 	movabs $0x805087,%rdi
+  8002b0:	00 00 00 
+  8002b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b8:	ff d3                	call   *%rbx
+    close(fd);
+  8002ba:	44 89 e7             	mov    %r12d,%edi
+  8002bd:	48 b8 9d 19 80 00 00 	movabs $0x80199d,%rax
+  8002c4:	00 00 00 
+  8002c7:	ff d0                	call   *%rax
+    free(buf);
+  8002c9:	4c 89 ef             	mov    %r13,%rdi
+  8002cc:	49 bd 83 14 80 00 00 	movabs $0x801483,%r13
+  8002d3:	00 00 00 
+  8002d6:	41 ff d5             	call   *%r13
+
+    printf("Testing malloc/free:\n");
+  8002d9:	48 bf 93 50 80 00 00 	movabs $0x805093,%rdi
+  8002e0:	00 00 00 
+  8002e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e8:	ff d3                	call   *%rbx
+    char *ptr = malloc(1024000), *oldptr = NULL;
+  8002ea:	bf 00 a0 0f 00       	mov    $0xfa000,%edi
+  8002ef:	41 ff d6             	call   *%r14
+  8002f2:	49 89 c4             	mov    %rax,%r12
+    printf("ptr: %p\n", ptr);
+  8002f5:	48 89 c6             	mov    %rax,%rsi
+  8002f8:	48 bf a9 50 80 00 00 	movabs $0x8050a9,%rdi
+  8002ff:	00 00 00 
+  800302:	b8 00 00 00 00       	mov    $0x0,%eax
+  800307:	ff d3                	call   *%rbx
+    ptr[0] = 'a', ptr[1] = 'b', ptr[2] = 0;
+  800309:	41 c6 04 24 61       	movb   $0x61,(%r12)
+  80030e:	41 c6 44 24 01 62    	movb   $0x62,0x1(%r12)
+  800314:	41 c6 44 24 02 00    	movb   $0x0,0x2(%r12)
+    printf("%s\n", ptr);
+  80031a:	4c 89 e6             	mov    %r12,%rsi
+  80031d:	4c 89 ff             	mov    %r15,%rdi
+  800320:	b8 00 00 00 00       	mov    $0x0,%eax
+  800325:	ff d3                	call   *%rbx
+    oldptr = ptr;
+    ptr = malloc(123);
+  800327:	bf 7b 00 00 00       	mov    $0x7b,%edi
+  80032c:	41 ff d6             	call   *%r14
+  80032f:	49 89 c7             	mov    %rax,%r15
+    printf("ptr: %p\n", ptr);
+  800332:	48 89 c6             	mov    %rax,%rsi
+  800335:	48 bf a9 50 80 00 00 	movabs $0x8050a9,%rdi
+  80033c:	00 00 00 
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	ff d3                	call   *%rbx
+    ptr[0] = 1;
+  800346:	41 c6 07 01          	movb   $0x1,(%r15)
+    free(ptr);
+  80034a:	4c 89 ff             	mov    %r15,%rdi
+  80034d:	41 ff d5             	call   *%r13
+    ptr = malloc(8);
+  800350:	bf 08 00 00 00       	mov    $0x8,%edi
+  800355:	41 ff d6             	call   *%r14
+  800358:	49 89 c7             	mov    %rax,%r15
+    printf("ptr: %p\n\n", ptr);
+  80035b:	48 89 c6             	mov    %rax,%rsi
+  80035e:	48 bf b2 50 80 00 00 	movabs $0x8050b2,%rdi
+  800365:	00 00 00 
+  800368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036d:	ff d3                	call   *%rbx
+    ptr[0] = 1;
+  80036f:	41 c6 07 01          	movb   $0x1,(%r15)
+    free(oldptr);
+  800373:	4c 89 e7             	mov    %r12,%rdi
+  800376:	41 ff d5             	call   *%r13
+    free(ptr);
+  800379:	4c 89 ff             	mov    %r15,%rdi
+  80037c:	41 ff d5             	call   *%r13
+
+    printf("Testing calloc and realloc:\n");
+  80037f:	48 bf bc 50 80 00 00 	movabs $0x8050bc,%rdi
+  800386:	00 00 00 
+  800389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038e:	ff d3                	call   *%rbx
+    ptr = calloc(3, 2);
+  800390:	be 02 00 00 00       	mov    $0x2,%esi
+  800395:	bf 03 00 00 00       	mov    $0x3,%edi
+  80039a:	48 b8 db 13 80 00 00 	movabs $0x8013db,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+  8003a6:	49 89 c4             	mov    %rax,%r12
+    printf("ptr: %p\n", ptr);
+  8003a9:	48 89 c6             	mov    %rax,%rsi
+  8003ac:	48 bf a9 50 80 00 00 	movabs $0x8050a9,%rdi
+  8003b3:	00 00 00 
+  8003b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bb:	ff d3                	call   *%rbx
+    ptr[0] = 1;
+  8003bd:	41 c6 04 24 01       	movb   $0x1,(%r12)
+    free(ptr);
+  8003c2:	4c 89 e7             	mov    %r12,%rdi
+  8003c5:	41 ff d5             	call   *%r13
+    ptr = malloc(123);
+  8003c8:	bf 7b 00 00 00       	mov    $0x7b,%edi
+  8003cd:	41 ff d6             	call   *%r14
+  8003d0:	49 89 c4             	mov    %rax,%r12
+    ptr[0] = 1;
+  8003d3:	c6 00 01             	movb   $0x1,(%rax)
+    ptr[122] = 101;
+  8003d6:	c6 40 7a 65          	movb   $0x65,0x7a(%rax)
+    printf("ptr: %p\n", ptr);
+  8003da:	48 89 c6             	mov    %rax,%rsi
+  8003dd:	48 bf a9 50 80 00 00 	movabs $0x8050a9,%rdi
+  8003e4:	00 00 00 
+  8003e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ec:	ff d3                	call   *%rbx
+    oldptr = ptr;
+    ptr = realloc(ptr, 600 * 400 * 4);
+  8003ee:	be 00 a6 0e 00       	mov    $0xea600,%esi
+  8003f3:	4c 89 e7             	mov    %r12,%rdi
+  8003f6:	48 b8 8e 15 80 00 00 	movabs $0x80158e,%rax
+  8003fd:	00 00 00 
+  800400:	ff d0                	call   *%rax
+  800402:	49 89 c6             	mov    %rax,%r14
+    ptr[600 * 400 * 4 - 1] = 123;
+  800405:	c6 80 ff a5 0e 00 7b 	movb   $0x7b,0xea5ff(%rax)
+    printf("new ptr: %p, old ptr: %p, checksum1: %d, checksum2: %d\n\n", ptr, oldptr, ptr[600 * 400 * 4 - 1], ptr[122]);
+  80040c:	44 0f be 40 7a       	movsbl 0x7a(%rax),%r8d
+  800411:	b9 7b 00 00 00       	mov    $0x7b,%ecx
+  800416:	4c 89 e2             	mov    %r12,%rdx
+  800419:	48 89 c6             	mov    %rax,%rsi
+  80041c:	48 bf 88 51 80 00 00 	movabs $0x805188,%rdi
+  800423:	00 00 00 
+  800426:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042b:	ff d3                	call   *%rbx
+    free(ptr);
+  80042d:	4c 89 f7             	mov    %r14,%rdi
+  800430:	41 ff d5             	call   *%r13
+
+    printf("Tick test.\n");
+  800433:	48 bf d9 50 80 00 00 	movabs $0x8050d9,%rdi
+  80043a:	00 00 00 
+  80043d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800442:	ff d3                	call   *%rbx
+    printf("Get ticks1: %lu\n", get_ticks());
+  800444:	b8 00 00 00 00       	mov    $0x0,%eax
+  800449:	49 bc 72 16 80 00 00 	movabs $0x801672,%r12
+  800450:	00 00 00 
+  800453:	41 ff d4             	call   *%r12
+  800456:	48 89 c6             	mov    %rax,%rsi
+  800459:	48 bf e5 50 80 00 00 	movabs $0x8050e5,%rdi
+  800460:	00 00 00 
+  800463:	b8 00 00 00 00       	mov    $0x0,%eax
+  800468:	ff d3                	call   *%rbx
+    printf("Wait 1000ms\n");
+  80046a:	48 bf f6 50 80 00 00 	movabs $0x8050f6,%rdi
+  800471:	00 00 00 
+  800474:	b8 00 00 00 00       	mov    $0x0,%eax
+  800479:	ff d3                	call   *%rbx
+    sleep(1000);
+  80047b:	bf e8 03 00 00       	mov    $0x3e8,%edi
+  800480:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  800487:	00 00 00 
+  80048a:	ff d0                	call   *%rax
+    printf("Get ticks2: %lu\n\n", get_ticks());
+  80048c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800491:	41 ff d4             	call   *%r12
+  800494:	48 89 c6             	mov    %rax,%rsi
+  800497:	48 bf 03 51 80 00 00 	movabs $0x805103,%rdi
+  80049e:	00 00 00 
+  8004a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a6:	ff d3                	call   *%rbx
+
+    printf("Tesing poll keys (press q to exit):\n");
+  8004a8:	48 bf c8 51 80 00 00 	movabs $0x8051c8,%rdi
+  8004af:	00 00 00 
+  8004b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b7:	ff d3                	call   *%rbx
+    char sym;
+    while((sym = poll_kbd()) != 'q')
+  8004b9:	48 bb 52 17 80 00 00 	movabs $0x801752,%rbx
+  8004c0:	00 00 00 
+  8004c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c8:	ff d3                	call   *%rbx
+  8004ca:	3c 71                	cmp    $0x71,%al
+  8004cc:	74 2f                	je     8004fd <umain+0x4d8>
+        if(sym != -1)
+  8004ce:	3c ff                	cmp    $0xff,%al
+  8004d0:	74 f1                	je     8004c3 <umain+0x49e>
+            printf("Read key: %u\n", sym & 0x80 ? (uint8_t)(sym) ^ 0x80 : (uint8_t)sym);
+  8004d2:	8d 50 80             	lea    -0x80(%rax),%edx
+  8004d5:	0f b6 d2             	movzbl %dl,%edx
+  8004d8:	0f b6 f0             	movzbl %al,%esi
+  8004db:	84 c0                	test   %al,%al
+  8004dd:	0f 48 f2             	cmovs  %edx,%esi
+  8004e0:	48 bf 15 51 80 00 00 	movabs $0x805115,%rdi
+  8004e7:	00 00 00 
+  8004ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ef:	48 ba 19 31 80 00 00 	movabs $0x803119,%rdx
+  8004f6:	00 00 00 
+  8004f9:	ff d2                	call   *%rdx
+  8004fb:	eb c6                	jmp    8004c3 <umain+0x49e>
+    printf("\n");
+  8004fd:	48 bf ba 50 80 00 00 	movabs $0x8050ba,%rdi
+  800504:	00 00 00 
+  800507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050c:	48 ba 19 31 80 00 00 	movabs $0x803119,%rdx
+  800513:	00 00 00 
+  800516:	ff d2                	call   *%rdx
+}
+  800518:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80051f:	5b                   	pop    %rbx
+  800520:	41 5c                	pop    %r12
+  800522:	41 5d                	pop    %r13
+  800524:	41 5e                	pop    %r14
+  800526:	41 5f                	pop    %r15
+  800528:	5d                   	pop    %rbp
+  800529:	c3                   	ret
+
+000000000080052a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	41 56                	push   %r14
+  800530:	41 55                	push   %r13
+  800532:	41 54                	push   %r12
+  800534:	53                   	push   %rbx
+  800535:	41 89 fd             	mov    %edi,%r13d
+  800538:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80053b:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800542:	00 00 00 
+  800545:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80054c:	00 00 00 
+  80054f:	48 39 c2             	cmp    %rax,%rdx
+  800552:	73 17                	jae    80056b <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800554:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800557:	49 89 c4             	mov    %rax,%r12
+  80055a:	48 83 c3 08          	add    $0x8,%rbx
+  80055e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800563:	ff 53 f8             	call   *-0x8(%rbx)
+  800566:	4c 39 e3             	cmp    %r12,%rbx
+  800569:	72 ef                	jb     80055a <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80056b:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  800572:	00 00 00 
+  800575:	ff d0                	call   *%rax
+  800577:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80057c:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800583:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80058a:	00 00 00 
+  80058d:	48 01 d0             	add    %rdx,%rax
+  800590:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800597:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80059a:	45 85 ed             	test   %r13d,%r13d
+  80059d:	7e 0d                	jle    8005ac <libmain+0x82>
+  80059f:	49 8b 06             	mov    (%r14),%rax
+  8005a2:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8005a9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8005ac:	4c 89 f6             	mov    %r14,%rsi
+  8005af:	44 89 ef             	mov    %r13d,%edi
+  8005b2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8005b9:	00 00 00 
+  8005bc:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8005be:	48 b8 d3 05 80 00 00 	movabs $0x8005d3,%rax
+  8005c5:	00 00 00 
+  8005c8:	ff d0                	call   *%rax
+#endif
+}
+  8005ca:	5b                   	pop    %rbx
+  8005cb:	41 5c                	pop    %r12
+  8005cd:	41 5d                	pop    %r13
+  8005cf:	41 5e                	pop    %r14
+  8005d1:	5d                   	pop    %rbp
+  8005d2:	c3                   	ret
+
+00000000008005d3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8005d3:	55                   	push   %rbp
+  8005d4:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8005d7:	48 b8 d0 19 80 00 00 	movabs $0x8019d0,%rax
+  8005de:	00 00 00 
+  8005e1:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8005e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005e8:	48 b8 69 0c 80 00 00 	movabs $0x800c69,%rax
+  8005ef:	00 00 00 
+  8005f2:	ff d0                	call   *%rax
+}
+  8005f4:	5d                   	pop    %rbp
+  8005f5:	c3                   	ret
+
+00000000008005f6 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8005f6:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8005f9:	74 10                	je     80060b <strlen+0x15>
+    size_t n = 0;
+  8005fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800600:	48 83 c0 01          	add    $0x1,%rax
+  800604:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800608:	75 f6                	jne    800600 <strlen+0xa>
+  80060a:	c3                   	ret
+    size_t n = 0;
+  80060b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800610:	c3                   	ret
+
+0000000000800611 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800611:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800614:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800619:	48 85 f6             	test   %rsi,%rsi
+  80061c:	74 11                	je     80062f <strnlen+0x1e>
+  80061e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800622:	74 0c                	je     800630 <strnlen+0x1f>
+  800624:	48 83 c2 01          	add    $0x1,%rdx
+  800628:	48 39 d0             	cmp    %rdx,%rax
+  80062b:	75 f1                	jne    80061e <strnlen+0xd>
+  80062d:	eb 04                	jmp    800633 <strnlen+0x22>
+  80062f:	c3                   	ret
+  800630:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800633:	c3                   	ret
+
+0000000000800634 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800634:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800637:	ba 00 00 00 00       	mov    $0x0,%edx
+  80063c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800640:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800643:	48 83 c2 01          	add    $0x1,%rdx
+  800647:	84 c9                	test   %cl,%cl
+  800649:	75 f1                	jne    80063c <strcpy+0x8>
+        ;
+    return res;
+}
+  80064b:	c3                   	ret
+
+000000000080064c <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80064c:	55                   	push   %rbp
+  80064d:	48 89 e5             	mov    %rsp,%rbp
+  800650:	41 54                	push   %r12
+  800652:	53                   	push   %rbx
+  800653:	48 89 fb             	mov    %rdi,%rbx
+  800656:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800659:	48 b8 f6 05 80 00 00 	movabs $0x8005f6,%rax
+  800660:	00 00 00 
+  800663:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800665:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800669:	4c 89 e6             	mov    %r12,%rsi
+  80066c:	48 b8 34 06 80 00 00 	movabs $0x800634,%rax
+  800673:	00 00 00 
+  800676:	ff d0                	call   *%rax
+    return dst;
+}
+  800678:	48 89 d8             	mov    %rbx,%rax
+  80067b:	5b                   	pop    %rbx
+  80067c:	41 5c                	pop    %r12
+  80067e:	5d                   	pop    %rbp
+  80067f:	c3                   	ret
+
+0000000000800680 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800680:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800683:	48 85 d2             	test   %rdx,%rdx
+  800686:	74 1f                	je     8006a7 <strncpy+0x27>
+  800688:	48 01 fa             	add    %rdi,%rdx
+  80068b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80068e:	48 83 c1 01          	add    $0x1,%rcx
+  800692:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800696:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80069a:	41 80 f8 01          	cmp    $0x1,%r8b
+  80069e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8006a2:	48 39 ca             	cmp    %rcx,%rdx
+  8006a5:	75 e7                	jne    80068e <strncpy+0xe>
+    }
+    return ret;
+}
+  8006a7:	c3                   	ret
+
+00000000008006a8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8006a8:	48 89 f8             	mov    %rdi,%rax
+  8006ab:	48 85 d2             	test   %rdx,%rdx
+  8006ae:	74 24                	je     8006d4 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8006b0:	48 83 ea 01          	sub    $0x1,%rdx
+  8006b4:	74 1b                	je     8006d1 <strlcpy+0x29>
+  8006b6:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8006ba:	0f b6 16             	movzbl (%rsi),%edx
+  8006bd:	84 d2                	test   %dl,%dl
+  8006bf:	74 10                	je     8006d1 <strlcpy+0x29>
+            *dst++ = *src++;
+  8006c1:	48 83 c6 01          	add    $0x1,%rsi
+  8006c5:	48 83 c0 01          	add    $0x1,%rax
+  8006c9:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8006cc:	48 39 c8             	cmp    %rcx,%rax
+  8006cf:	75 e9                	jne    8006ba <strlcpy+0x12>
+        *dst = '\0';
+  8006d1:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8006d4:	48 29 f8             	sub    %rdi,%rax
+}
+  8006d7:	c3                   	ret
+
+00000000008006d8 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8006d8:	0f b6 07             	movzbl (%rdi),%eax
+  8006db:	84 c0                	test   %al,%al
+  8006dd:	74 13                	je     8006f2 <strcmp+0x1a>
+  8006df:	38 06                	cmp    %al,(%rsi)
+  8006e1:	75 0f                	jne    8006f2 <strcmp+0x1a>
+  8006e3:	48 83 c7 01          	add    $0x1,%rdi
+  8006e7:	48 83 c6 01          	add    $0x1,%rsi
+  8006eb:	0f b6 07             	movzbl (%rdi),%eax
+  8006ee:	84 c0                	test   %al,%al
+  8006f0:	75 ed                	jne    8006df <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8006f2:	0f b6 c0             	movzbl %al,%eax
+  8006f5:	0f b6 16             	movzbl (%rsi),%edx
+  8006f8:	29 d0                	sub    %edx,%eax
+}
+  8006fa:	c3                   	ret
+
+00000000008006fb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8006fb:	48 85 d2             	test   %rdx,%rdx
+  8006fe:	74 1f                	je     80071f <strncmp+0x24>
+  800700:	0f b6 07             	movzbl (%rdi),%eax
+  800703:	84 c0                	test   %al,%al
+  800705:	74 1e                	je     800725 <strncmp+0x2a>
+  800707:	3a 06                	cmp    (%rsi),%al
+  800709:	75 1a                	jne    800725 <strncmp+0x2a>
+  80070b:	48 83 c7 01          	add    $0x1,%rdi
+  80070f:	48 83 c6 01          	add    $0x1,%rsi
+  800713:	48 83 ea 01          	sub    $0x1,%rdx
+  800717:	75 e7                	jne    800700 <strncmp+0x5>
+
+    if (!n) return 0;
+  800719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071e:	c3                   	ret
+  80071f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800724:	c3                   	ret
+  800725:	48 85 d2             	test   %rdx,%rdx
+  800728:	74 09                	je     800733 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80072a:	0f b6 07             	movzbl (%rdi),%eax
+  80072d:	0f b6 16             	movzbl (%rsi),%edx
+  800730:	29 d0                	sub    %edx,%eax
+  800732:	c3                   	ret
+    if (!n) return 0;
+  800733:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800738:	c3                   	ret
+
+0000000000800739 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800739:	0f b6 17             	movzbl (%rdi),%edx
+  80073c:	84 d2                	test   %dl,%dl
+  80073e:	74 18                	je     800758 <strchr+0x1f>
+        if (*str == c) {
+  800740:	0f be d2             	movsbl %dl,%edx
+  800743:	39 f2                	cmp    %esi,%edx
+  800745:	74 17                	je     80075e <strchr+0x25>
+    for (; *str; str++) {
+  800747:	48 83 c7 01          	add    $0x1,%rdi
+  80074b:	0f b6 17             	movzbl (%rdi),%edx
+  80074e:	84 d2                	test   %dl,%dl
+  800750:	75 ee                	jne    800740 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800752:	b8 00 00 00 00       	mov    $0x0,%eax
+  800757:	c3                   	ret
+  800758:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075d:	c3                   	ret
+  80075e:	48 89 f8             	mov    %rdi,%rax
+}
+  800761:	c3                   	ret
+
+0000000000800762 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800762:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800765:	0f b6 17             	movzbl (%rdi),%edx
+  800768:	84 d2                	test   %dl,%dl
+  80076a:	74 13                	je     80077f <strfind+0x1d>
+  80076c:	0f be d2             	movsbl %dl,%edx
+  80076f:	39 f2                	cmp    %esi,%edx
+  800771:	74 0b                	je     80077e <strfind+0x1c>
+  800773:	48 83 c0 01          	add    $0x1,%rax
+  800777:	0f b6 10             	movzbl (%rax),%edx
+  80077a:	84 d2                	test   %dl,%dl
+  80077c:	75 ee                	jne    80076c <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80077e:	c3                   	ret
+  80077f:	c3                   	ret
+
+0000000000800780 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800780:	55                   	push   %rbp
+  800781:	48 89 e5             	mov    %rsp,%rbp
+  800784:	41 57                	push   %r15
+  800786:	41 56                	push   %r14
+  800788:	41 55                	push   %r13
+  80078a:	41 54                	push   %r12
+  80078c:	53                   	push   %rbx
+  80078d:	48 83 ec 08          	sub    $0x8,%rsp
+  800791:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800794:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800798:	45 84 ed             	test   %r13b,%r13b
+  80079b:	75 12                	jne    8007af <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  80079d:	4c 89 f8             	mov    %r15,%rax
+  8007a0:	48 83 c4 08          	add    $0x8,%rsp
+  8007a4:	5b                   	pop    %rbx
+  8007a5:	41 5c                	pop    %r12
+  8007a7:	41 5d                	pop    %r13
+  8007a9:	41 5e                	pop    %r14
+  8007ab:	41 5f                	pop    %r15
+  8007ad:	5d                   	pop    %rbp
+  8007ae:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  8007af:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  8007b3:	4c 89 e7             	mov    %r12,%rdi
+  8007b6:	48 b8 f6 05 80 00 00 	movabs $0x8005f6,%rax
+  8007bd:	00 00 00 
+  8007c0:	ff d0                	call   *%rax
+  8007c2:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  8007c5:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  8007c9:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  8007cd:	49 bf fb 06 80 00 00 	movabs $0x8006fb,%r15
+  8007d4:	00 00 00 
+				if ((sc = *s++) == 0)
+  8007d7:	84 c0                	test   %al,%al
+  8007d9:	75 14                	jne    8007ef <strstr+0x6f>
+					return NULL;
+  8007db:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8007e1:	eb ba                	jmp    80079d <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  8007e3:	48 83 c3 01          	add    $0x1,%rbx
+  8007e7:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8007eb:	84 c0                	test   %al,%al
+  8007ed:	74 1b                	je     80080a <strstr+0x8a>
+			} while (sc != c);
+  8007ef:	41 38 c5             	cmp    %al,%r13b
+  8007f2:	75 ef                	jne    8007e3 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  8007f4:	4c 89 f2             	mov    %r14,%rdx
+  8007f7:	4c 89 e6             	mov    %r12,%rsi
+  8007fa:	48 89 df             	mov    %rbx,%rdi
+  8007fd:	41 ff d7             	call   *%r15
+  800800:	85 c0                	test   %eax,%eax
+  800802:	75 df                	jne    8007e3 <strstr+0x63>
+  800804:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800808:	eb 93                	jmp    80079d <strstr+0x1d>
+					return NULL;
+  80080a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800810:	eb 8b                	jmp    80079d <strstr+0x1d>
+
+0000000000800812 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800812:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800814:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800817:	8d 57 20             	lea    0x20(%rdi),%edx
+  80081a:	83 f9 1a             	cmp    $0x1a,%ecx
+  80081d:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800820:	c3                   	ret
+
+0000000000800821 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800821:	55                   	push   %rbp
+  800822:	48 89 e5             	mov    %rsp,%rbp
+  800825:	41 57                	push   %r15
+  800827:	41 56                	push   %r14
+  800829:	41 55                	push   %r13
+  80082b:	41 54                	push   %r12
+  80082d:	53                   	push   %rbx
+  80082e:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800832:	48 39 f7             	cmp    %rsi,%rdi
+  800835:	74 49                	je     800880 <strcasecmp+0x5f>
+  800837:	49 89 fd             	mov    %rdi,%r13
+  80083a:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  80083d:	49 bf 12 08 80 00 00 	movabs $0x800812,%r15
+  800844:	00 00 00 
+  800847:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  80084c:	41 0f b6 fe          	movzbl %r14b,%edi
+  800850:	41 ff d7             	call   *%r15
+  800853:	89 c3                	mov    %eax,%ebx
+  800855:	49 83 c4 01          	add    $0x1,%r12
+  800859:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  80085f:	41 ff d7             	call   *%r15
+  800862:	29 c3                	sub    %eax,%ebx
+  800864:	75 09                	jne    80086f <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800866:	49 83 c5 01          	add    $0x1,%r13
+  80086a:	45 84 f6             	test   %r14b,%r14b
+  80086d:	75 d8                	jne    800847 <strcasecmp+0x26>
+}
+  80086f:	89 d8                	mov    %ebx,%eax
+  800871:	48 83 c4 08          	add    $0x8,%rsp
+  800875:	5b                   	pop    %rbx
+  800876:	41 5c                	pop    %r12
+  800878:	41 5d                	pop    %r13
+  80087a:	41 5e                	pop    %r14
+  80087c:	41 5f                	pop    %r15
+  80087e:	5d                   	pop    %rbp
+  80087f:	c3                   	ret
+        return 0;
+  800880:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800885:	eb e8                	jmp    80086f <strcasecmp+0x4e>
+
+0000000000800887 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800887:	55                   	push   %rbp
+  800888:	48 89 e5             	mov    %rsp,%rbp
+  80088b:	41 57                	push   %r15
+  80088d:	41 56                	push   %r14
+  80088f:	41 55                	push   %r13
+  800891:	41 54                	push   %r12
+  800893:	53                   	push   %rbx
+  800894:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800898:	48 85 d2             	test   %rdx,%rdx
+  80089b:	74 4f                	je     8008ec <strncasecmp+0x65>
+  80089d:	49 89 fc             	mov    %rdi,%r12
+  8008a0:	49 89 f5             	mov    %rsi,%r13
+  8008a3:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  8008a7:	49 be 12 08 80 00 00 	movabs $0x800812,%r14
+  8008ae:	00 00 00 
+  8008b1:	49 83 c4 01          	add    $0x1,%r12
+  8008b5:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8008bb:	41 ff d6             	call   *%r14
+  8008be:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  8008c0:	49 83 c5 01          	add    $0x1,%r13
+  8008c4:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  8008c9:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  8008cc:	29 c3                	sub    %eax,%ebx
+  8008ce:	85 c0                	test   %eax,%eax
+  8008d0:	74 09                	je     8008db <strncasecmp+0x54>
+  8008d2:	85 db                	test   %ebx,%ebx
+  8008d4:	75 05                	jne    8008db <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8008d6:	4d 39 fc             	cmp    %r15,%r12
+  8008d9:	75 d6                	jne    8008b1 <strncasecmp+0x2a>
+}
+  8008db:	89 d8                	mov    %ebx,%eax
+  8008dd:	48 83 c4 08          	add    $0x8,%rsp
+  8008e1:	5b                   	pop    %rbx
+  8008e2:	41 5c                	pop    %r12
+  8008e4:	41 5d                	pop    %r13
+  8008e6:	41 5e                	pop    %r14
+  8008e8:	41 5f                	pop    %r15
+  8008ea:	5d                   	pop    %rbp
+  8008eb:	c3                   	ret
+    int d = 0;
+  8008ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  8008f1:	eb e8                	jmp    8008db <strncasecmp+0x54>
+
+00000000008008f3 <toupper>:
+
+int toupper(int c) {
+  8008f3:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  8008f5:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  8008f8:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8008fb:	83 f9 1a             	cmp    $0x1a,%ecx
+  8008fe:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800901:	c3                   	ret
+
+0000000000800902 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800902:	83 ff 20             	cmp    $0x20,%edi
+  800905:	0f 94 c0             	sete   %al
+  800908:	0f b6 c0             	movzbl %al,%eax
+}
+  80090b:	c3                   	ret
+
+000000000080090c <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  80090c:	89 f8                	mov    %edi,%eax
+  80090e:	f7 d8                	neg    %eax
+  800910:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800913:	c3                   	ret
+
+0000000000800914 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800914:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800917:	48 89 f8             	mov    %rdi,%rax
+  80091a:	48 f7 d8             	neg    %rax
+  80091d:	83 e0 07             	and    $0x7,%eax
+  800920:	49 89 d1             	mov    %rdx,%r9
+  800923:	49 29 c1             	sub    %rax,%r9
+  800926:	78 36                	js     80095e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800928:	40 0f b6 c6          	movzbl %sil,%eax
+  80092c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800933:	01 01 01 
+  800936:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80093a:	40 f6 c7 07          	test   $0x7,%dil
+  80093e:	75 38                	jne    800978 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800940:	4c 89 c9             	mov    %r9,%rcx
+  800943:	48 c1 f9 03          	sar    $0x3,%rcx
+  800947:	74 0c                	je     800955 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800949:	fc                   	cld
+  80094a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80094d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800951:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800955:	4d 85 c9             	test   %r9,%r9
+  800958:	75 45                	jne    80099f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80095a:	4c 89 c0             	mov    %r8,%rax
+  80095d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80095e:	48 85 d2             	test   %rdx,%rdx
+  800961:	74 f7                	je     80095a <memset+0x46>
+  800963:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800966:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800969:	48 83 c0 01          	add    $0x1,%rax
+  80096d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800971:	48 39 c2             	cmp    %rax,%rdx
+  800974:	75 f3                	jne    800969 <memset+0x55>
+  800976:	eb e2                	jmp    80095a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800978:	40 f6 c7 01          	test   $0x1,%dil
+  80097c:	74 06                	je     800984 <memset+0x70>
+  80097e:	88 07                	mov    %al,(%rdi)
+  800980:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800984:	40 f6 c7 02          	test   $0x2,%dil
+  800988:	74 07                	je     800991 <memset+0x7d>
+  80098a:	66 89 07             	mov    %ax,(%rdi)
+  80098d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800991:	40 f6 c7 04          	test   $0x4,%dil
+  800995:	74 a9                	je     800940 <memset+0x2c>
+  800997:	89 07                	mov    %eax,(%rdi)
+  800999:	48 83 c7 04          	add    $0x4,%rdi
+  80099d:	eb a1                	jmp    800940 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80099f:	41 f6 c1 04          	test   $0x4,%r9b
+  8009a3:	74 06                	je     8009ab <memset+0x97>
+  8009a5:	89 07                	mov    %eax,(%rdi)
+  8009a7:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8009ab:	41 f6 c1 02          	test   $0x2,%r9b
+  8009af:	74 07                	je     8009b8 <memset+0xa4>
+  8009b1:	66 89 07             	mov    %ax,(%rdi)
+  8009b4:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8009b8:	41 f6 c1 01          	test   $0x1,%r9b
+  8009bc:	74 9c                	je     80095a <memset+0x46>
+  8009be:	88 07                	mov    %al,(%rdi)
+  8009c0:	eb 98                	jmp    80095a <memset+0x46>
+
+00000000008009c2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8009c2:	48 89 f8             	mov    %rdi,%rax
+  8009c5:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8009c8:	48 39 fe             	cmp    %rdi,%rsi
+  8009cb:	73 3b                	jae    800a08 <memmove+0x46>
+  8009cd:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8009d1:	48 39 d7             	cmp    %rdx,%rdi
+  8009d4:	73 32                	jae    800a08 <memmove+0x46>
+        s += n;
+        d += n;
+  8009d6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8009da:	48 89 d6             	mov    %rdx,%rsi
+  8009dd:	48 09 fe             	or     %rdi,%rsi
+  8009e0:	48 09 ce             	or     %rcx,%rsi
+  8009e3:	40 f6 c6 07          	test   $0x7,%sil
+  8009e7:	75 12                	jne    8009fb <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8009e9:	48 83 ef 08          	sub    $0x8,%rdi
+  8009ed:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8009f1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8009f5:	fd                   	std
+  8009f6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8009f9:	fc                   	cld
+  8009fa:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8009fb:	48 83 ef 01          	sub    $0x1,%rdi
+  8009ff:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800a03:	fd                   	std
+  800a04:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800a06:	eb f1                	jmp    8009f9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800a08:	48 89 f2             	mov    %rsi,%rdx
+  800a0b:	48 09 c2             	or     %rax,%rdx
+  800a0e:	48 09 ca             	or     %rcx,%rdx
+  800a11:	f6 c2 07             	test   $0x7,%dl
+  800a14:	75 0c                	jne    800a22 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800a16:	48 c1 e9 03          	shr    $0x3,%rcx
+  800a1a:	48 89 c7             	mov    %rax,%rdi
+  800a1d:	fc                   	cld
+  800a1e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800a21:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800a22:	48 89 c7             	mov    %rax,%rdi
+  800a25:	fc                   	cld
+  800a26:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800a28:	c3                   	ret
+
+0000000000800a29 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800a29:	55                   	push   %rbp
+  800a2a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800a2d:	48 b8 c2 09 80 00 00 	movabs $0x8009c2,%rax
+  800a34:	00 00 00 
+  800a37:	ff d0                	call   *%rax
+}
+  800a39:	5d                   	pop    %rbp
+  800a3a:	c3                   	ret
+
+0000000000800a3b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800a3b:	55                   	push   %rbp
+  800a3c:	48 89 e5             	mov    %rsp,%rbp
+  800a3f:	41 57                	push   %r15
+  800a41:	41 56                	push   %r14
+  800a43:	41 55                	push   %r13
+  800a45:	41 54                	push   %r12
+  800a47:	53                   	push   %rbx
+  800a48:	48 83 ec 08          	sub    $0x8,%rsp
+  800a4c:	49 89 fe             	mov    %rdi,%r14
+  800a4f:	49 89 f7             	mov    %rsi,%r15
+  800a52:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800a55:	48 89 f7             	mov    %rsi,%rdi
+  800a58:	48 b8 f6 05 80 00 00 	movabs $0x8005f6,%rax
+  800a5f:	00 00 00 
+  800a62:	ff d0                	call   *%rax
+  800a64:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800a67:	48 89 de             	mov    %rbx,%rsi
+  800a6a:	4c 89 f7             	mov    %r14,%rdi
+  800a6d:	48 b8 11 06 80 00 00 	movabs $0x800611,%rax
+  800a74:	00 00 00 
+  800a77:	ff d0                	call   *%rax
+  800a79:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800a7c:	48 39 c3             	cmp    %rax,%rbx
+  800a7f:	74 36                	je     800ab7 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800a81:	48 89 d8             	mov    %rbx,%rax
+  800a84:	4c 29 e8             	sub    %r13,%rax
+  800a87:	49 39 c4             	cmp    %rax,%r12
+  800a8a:	73 31                	jae    800abd <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800a8c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800a91:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800a95:	4c 89 fe             	mov    %r15,%rsi
+  800a98:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  800a9f:	00 00 00 
+  800aa2:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800aa4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800aa8:	48 83 c4 08          	add    $0x8,%rsp
+  800aac:	5b                   	pop    %rbx
+  800aad:	41 5c                	pop    %r12
+  800aaf:	41 5d                	pop    %r13
+  800ab1:	41 5e                	pop    %r14
+  800ab3:	41 5f                	pop    %r15
+  800ab5:	5d                   	pop    %rbp
+  800ab6:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ab7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800abb:	eb eb                	jmp    800aa8 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800abd:	48 83 eb 01          	sub    $0x1,%rbx
+  800ac1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ac5:	48 89 da             	mov    %rbx,%rdx
+  800ac8:	4c 89 fe             	mov    %r15,%rsi
+  800acb:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  800ad2:	00 00 00 
+  800ad5:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ad7:	49 01 de             	add    %rbx,%r14
+  800ada:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800adf:	eb c3                	jmp    800aa4 <strlcat+0x69>
+
+0000000000800ae1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ae1:	48 85 d2             	test   %rdx,%rdx
+  800ae4:	74 2d                	je     800b13 <memcmp+0x32>
+  800ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800aeb:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800aef:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800af4:	44 38 c1             	cmp    %r8b,%cl
+  800af7:	75 0f                	jne    800b08 <memcmp+0x27>
+    while (n-- > 0) {
+  800af9:	48 83 c0 01          	add    $0x1,%rax
+  800afd:	48 39 c2             	cmp    %rax,%rdx
+  800b00:	75 e9                	jne    800aeb <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b07:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800b08:	0f b6 c1             	movzbl %cl,%eax
+  800b0b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800b0f:	44 29 c0             	sub    %r8d,%eax
+  800b12:	c3                   	ret
+    return 0;
+  800b13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b18:	c3                   	ret
+
+0000000000800b19 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800b19:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800b1d:	48 39 c7             	cmp    %rax,%rdi
+  800b20:	73 0f                	jae    800b31 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800b22:	40 38 37             	cmp    %sil,(%rdi)
+  800b25:	74 0e                	je     800b35 <memfind+0x1c>
+    for (; src < end; src++) {
+  800b27:	48 83 c7 01          	add    $0x1,%rdi
+  800b2b:	48 39 f8             	cmp    %rdi,%rax
+  800b2e:	75 f2                	jne    800b22 <memfind+0x9>
+  800b30:	c3                   	ret
+  800b31:	48 89 f8             	mov    %rdi,%rax
+  800b34:	c3                   	ret
+  800b35:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800b38:	c3                   	ret
+
+0000000000800b39 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800b39:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800b3c:	0f b6 37             	movzbl (%rdi),%esi
+  800b3f:	40 80 fe 20          	cmp    $0x20,%sil
+  800b43:	74 06                	je     800b4b <strtol+0x12>
+  800b45:	40 80 fe 09          	cmp    $0x9,%sil
+  800b49:	75 13                	jne    800b5e <strtol+0x25>
+  800b4b:	48 83 c7 01          	add    $0x1,%rdi
+  800b4f:	0f b6 37             	movzbl (%rdi),%esi
+  800b52:	40 80 fe 20          	cmp    $0x20,%sil
+  800b56:	74 f3                	je     800b4b <strtol+0x12>
+  800b58:	40 80 fe 09          	cmp    $0x9,%sil
+  800b5c:	74 ed                	je     800b4b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800b5e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800b61:	83 e0 fd             	and    $0xfffffffd,%eax
+  800b64:	3c 01                	cmp    $0x1,%al
+  800b66:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800b6a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800b70:	75 0f                	jne    800b81 <strtol+0x48>
+  800b72:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800b75:	74 14                	je     800b8b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800b77:	85 d2                	test   %edx,%edx
+  800b79:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b7e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800b81:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800b86:	4c 63 ca             	movslq %edx,%r9
+  800b89:	eb 36                	jmp    800bc1 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800b8b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800b8f:	74 0f                	je     800ba0 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800b91:	85 d2                	test   %edx,%edx
+  800b93:	75 ec                	jne    800b81 <strtol+0x48>
+        s++;
+  800b95:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800b99:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800b9e:	eb e1                	jmp    800b81 <strtol+0x48>
+        s += 2;
+  800ba0:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ba4:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ba9:	eb d6                	jmp    800b81 <strtol+0x48>
+            dig -= '0';
+  800bab:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800bae:	44 0f b6 c1          	movzbl %cl,%r8d
+  800bb2:	41 39 d0             	cmp    %edx,%r8d
+  800bb5:	7d 21                	jge    800bd8 <strtol+0x9f>
+        val = val * base + dig;
+  800bb7:	49 0f af c1          	imul   %r9,%rax
+  800bbb:	0f b6 c9             	movzbl %cl,%ecx
+  800bbe:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800bc1:	48 83 c7 01          	add    $0x1,%rdi
+  800bc5:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800bc9:	80 f9 39             	cmp    $0x39,%cl
+  800bcc:	76 dd                	jbe    800bab <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800bce:	80 f9 7b             	cmp    $0x7b,%cl
+  800bd1:	77 05                	ja     800bd8 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800bd3:	83 e9 57             	sub    $0x57,%ecx
+  800bd6:	eb d6                	jmp    800bae <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800bd8:	4d 85 d2             	test   %r10,%r10
+  800bdb:	74 03                	je     800be0 <strtol+0xa7>
+  800bdd:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800be0:	48 89 c2             	mov    %rax,%rdx
+  800be3:	48 f7 da             	neg    %rdx
+  800be6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800bea:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800bee:	c3                   	ret
+
+0000000000800bef <atoi>:
+int atoi(const char *str) {
+  800bef:	55                   	push   %rbp
+  800bf0:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  800bf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf8:	be 00 00 00 00       	mov    $0x0,%esi
+  800bfd:	48 b8 39 0b 80 00 00 	movabs $0x800b39,%rax
+  800c04:	00 00 00 
+  800c07:	ff d0                	call   *%rax
+}
+  800c09:	5d                   	pop    %rbp
+  800c0a:	c3                   	ret
+
+0000000000800c0b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800c0b:	55                   	push   %rbp
+  800c0c:	48 89 e5             	mov    %rsp,%rbp
+  800c0f:	53                   	push   %rbx
+  800c10:	48 89 fa             	mov    %rdi,%rdx
+  800c13:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800c16:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c20:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c25:	be 00 00 00 00       	mov    $0x0,%esi
+  800c2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c30:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800c32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c36:	c9                   	leave
+  800c37:	c3                   	ret
+
+0000000000800c38 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800c38:	55                   	push   %rbp
+  800c39:	48 89 e5             	mov    %rsp,%rbp
+  800c3c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800c3d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c47:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c51:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c56:	be 00 00 00 00       	mov    $0x0,%esi
+  800c5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c61:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800c63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c67:	c9                   	leave
+  800c68:	c3                   	ret
+
+0000000000800c69 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800c69:	55                   	push   %rbp
+  800c6a:	48 89 e5             	mov    %rsp,%rbp
+  800c6d:	53                   	push   %rbx
+  800c6e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800c72:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800c75:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800c7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800c7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c84:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800c89:	be 00 00 00 00       	mov    $0x0,%esi
+  800c8e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800c94:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800c96:	48 85 c0             	test   %rax,%rax
+  800c99:	7f 06                	jg     800ca1 <sys_env_destroy+0x38>
+}
+  800c9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c9f:	c9                   	leave
+  800ca0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800ca1:	49 89 c0             	mov    %rax,%r8
+  800ca4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800ca9:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800cb0:	00 00 00 
+  800cb3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800cb8:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  800cbf:	00 00 00 
+  800cc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc7:	49 b9 fb 3b 80 00 00 	movabs $0x803bfb,%r9
+  800cce:	00 00 00 
+  800cd1:	41 ff d1             	call   *%r9
+
+0000000000800cd4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800cd4:	55                   	push   %rbp
+  800cd5:	48 89 e5             	mov    %rsp,%rbp
+  800cd8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800cd9:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800cde:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ce8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ced:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800cf2:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800cfd:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800cff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d03:	c9                   	leave
+  800d04:	c3                   	ret
+
+0000000000800d05 <sys_yield>:
+
+void
+sys_yield(void) {
+  800d05:	55                   	push   %rbp
+  800d06:	48 89 e5             	mov    %rsp,%rbp
+  800d09:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800d0a:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800d0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d14:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800d19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d1e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800d23:	be 00 00 00 00       	mov    $0x0,%esi
+  800d28:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800d2e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800d30:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d34:	c9                   	leave
+  800d35:	c3                   	ret
+
+0000000000800d36 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800d36:	55                   	push   %rbp
+  800d37:	48 89 e5             	mov    %rsp,%rbp
+  800d3a:	53                   	push   %rbx
+  800d3b:	48 89 fa             	mov    %rdi,%rdx
+  800d3e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800d41:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800d46:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800d4d:	00 00 00 
+  800d50:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800d55:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800d60:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800d62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d66:	c9                   	leave
+  800d67:	c3                   	ret
+
+0000000000800d68 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800d68:	55                   	push   %rbp
+  800d69:	48 89 e5             	mov    %rsp,%rbp
+  800d6c:	53                   	push   %rbx
+  800d6d:	49 89 f8             	mov    %rdi,%r8
+  800d70:	48 89 d3             	mov    %rdx,%rbx
+  800d73:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800d76:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800d7b:	4c 89 c2             	mov    %r8,%rdx
+  800d7e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800d81:	be 00 00 00 00       	mov    $0x0,%esi
+  800d86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800d8c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800d8e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d92:	c9                   	leave
+  800d93:	c3                   	ret
+
+0000000000800d94 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800d94:	55                   	push   %rbp
+  800d95:	48 89 e5             	mov    %rsp,%rbp
+  800d98:	53                   	push   %rbx
+  800d99:	48 83 ec 08          	sub    $0x8,%rsp
+  800d9d:	89 f8                	mov    %edi,%eax
+  800d9f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800da2:	48 63 f9             	movslq %ecx,%rdi
+  800da5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800da8:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800dad:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800db0:	be 00 00 00 00       	mov    $0x0,%esi
+  800db5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800dbb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800dbd:	48 85 c0             	test   %rax,%rax
+  800dc0:	7f 06                	jg     800dc8 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800dc2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800dc6:	c9                   	leave
+  800dc7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800dc8:	49 89 c0             	mov    %rax,%r8
+  800dcb:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800dd0:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800dd7:	00 00 00 
+  800dda:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800ddf:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  800de6:	00 00 00 
+  800de9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dee:	49 b9 fb 3b 80 00 00 	movabs $0x803bfb,%r9
+  800df5:	00 00 00 
+  800df8:	41 ff d1             	call   *%r9
+
+0000000000800dfb <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800dfb:	55                   	push   %rbp
+  800dfc:	48 89 e5             	mov    %rsp,%rbp
+  800dff:	53                   	push   %rbx
+  800e00:	48 83 ec 08          	sub    $0x8,%rsp
+  800e04:	89 f8                	mov    %edi,%eax
+  800e06:	49 89 f2             	mov    %rsi,%r10
+  800e09:	48 89 cf             	mov    %rcx,%rdi
+  800e0c:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800e0f:	48 63 da             	movslq %edx,%rbx
+  800e12:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800e15:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800e1a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800e1d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800e20:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800e22:	48 85 c0             	test   %rax,%rax
+  800e25:	7f 06                	jg     800e2d <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800e27:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e2b:	c9                   	leave
+  800e2c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800e2d:	49 89 c0             	mov    %rax,%r8
+  800e30:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800e35:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800e3c:	00 00 00 
+  800e3f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800e44:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  800e4b:	00 00 00 
+  800e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e53:	49 b9 fb 3b 80 00 00 	movabs $0x803bfb,%r9
+  800e5a:	00 00 00 
+  800e5d:	41 ff d1             	call   *%r9
+
+0000000000800e60 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800e60:	55                   	push   %rbp
+  800e61:	48 89 e5             	mov    %rsp,%rbp
+  800e64:	53                   	push   %rbx
+  800e65:	48 83 ec 08          	sub    $0x8,%rsp
+  800e69:	49 89 f9             	mov    %rdi,%r9
+  800e6c:	89 f0                	mov    %esi,%eax
+  800e6e:	48 89 d3             	mov    %rdx,%rbx
+  800e71:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  800e74:	49 63 f0             	movslq %r8d,%rsi
+  800e77:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800e7a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800e7f:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800e82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800e88:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800e8a:	48 85 c0             	test   %rax,%rax
+  800e8d:	7f 06                	jg     800e95 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800e8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e93:	c9                   	leave
+  800e94:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800e95:	49 89 c0             	mov    %rax,%r8
+  800e98:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800e9d:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800ea4:	00 00 00 
+  800ea7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800eac:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  800eb3:	00 00 00 
+  800eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ebb:	49 b9 fb 3b 80 00 00 	movabs $0x803bfb,%r9
+  800ec2:	00 00 00 
+  800ec5:	41 ff d1             	call   *%r9
+
+0000000000800ec8 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  800ec8:	55                   	push   %rbp
+  800ec9:	48 89 e5             	mov    %rsp,%rbp
+  800ecc:	53                   	push   %rbx
+  800ecd:	89 f8                	mov    %edi,%eax
+  800ecf:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  800ed2:	48 63 f9             	movslq %ecx,%rdi
+  800ed5:	48 63 da             	movslq %edx,%rbx
+  800ed8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800edb:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ee0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ee3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800eee:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  800ef0:	89 c2                	mov    %eax,%edx
+  800ef2:	48 85 c0             	test   %rax,%rax
+  800ef5:	78 0d                	js     800f04 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  800ef7:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  800efc:	4d 85 c9             	test   %r9,%r9
+  800eff:	74 03                	je     800f04 <sys_alloc_dma_region+0x3c>
+  800f01:	49 89 01             	mov    %rax,(%r9)
+}
+  800f04:	89 d0                	mov    %edx,%eax
+  800f06:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f0a:	c9                   	leave
+  800f0b:	c3                   	ret
+
+0000000000800f0c <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  800f0c:	55                   	push   %rbp
+  800f0d:	48 89 e5             	mov    %rsp,%rbp
+  800f10:	53                   	push   %rbx
+  800f11:	48 83 ec 08          	sub    $0x8,%rsp
+  800f15:	48 89 f1             	mov    %rsi,%rcx
+  800f18:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800f1b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f1e:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f23:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f28:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f33:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800f35:	48 85 c0             	test   %rax,%rax
+  800f38:	7f 06                	jg     800f40 <sys_set_cache_region+0x34>
+}
+  800f3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f3e:	c9                   	leave
+  800f3f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800f40:	49 89 c0             	mov    %rax,%r8
+  800f43:	b9 08 00 00 00       	mov    $0x8,%ecx
+  800f48:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800f4f:	00 00 00 
+  800f52:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800f57:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  800f5e:	00 00 00 
+  800f61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f66:	49 b9 fb 3b 80 00 00 	movabs $0x803bfb,%r9
+  800f6d:	00 00 00 
+  800f70:	41 ff d1             	call   *%r9
+
+0000000000800f73 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800f73:	55                   	push   %rbp
+  800f74:	48 89 e5             	mov    %rsp,%rbp
+  800f77:	53                   	push   %rbx
+  800f78:	48 83 ec 08          	sub    $0x8,%rsp
+  800f7c:	48 89 f1             	mov    %rsi,%rcx
+  800f7f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800f82:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f85:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f8f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f9a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	7f 06                	jg     800fa7 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800fa1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fa5:	c9                   	leave
+  800fa6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fa7:	49 89 c0             	mov    %rax,%r8
+  800faa:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800faf:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  800fb6:	00 00 00 
+  800fb9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800fbe:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  800fc5:	00 00 00 
+  800fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcd:	49 b9 fb 3b 80 00 00 	movabs $0x803bfb,%r9
+  800fd4:	00 00 00 
+  800fd7:	41 ff d1             	call   *%r9
+
+0000000000800fda <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800fda:	55                   	push   %rbp
+  800fdb:	48 89 e5             	mov    %rsp,%rbp
+  800fde:	53                   	push   %rbx
+  800fdf:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800fe3:	48 63 ce             	movslq %esi,%rcx
+  800fe6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800fe9:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ff8:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801003:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801005:	48 85 c0             	test   %rax,%rax
+  801008:	7f 06                	jg     801010 <sys_env_set_status+0x36>
+}
+  80100a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80100e:	c9                   	leave
+  80100f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801010:	49 89 c0             	mov    %rax,%r8
+  801013:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801018:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  80101f:	00 00 00 
+  801022:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801027:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  80102e:	00 00 00 
+  801031:	b8 00 00 00 00       	mov    $0x0,%eax
+  801036:	49 b9 fb 3b 80 00 00 	movabs $0x803bfb,%r9
+  80103d:	00 00 00 
+  801040:	41 ff d1             	call   *%r9
+
+0000000000801043 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801043:	55                   	push   %rbp
+  801044:	48 89 e5             	mov    %rsp,%rbp
+  801047:	53                   	push   %rbx
+  801048:	48 83 ec 08          	sub    $0x8,%rsp
+  80104c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80104f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801052:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801057:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801061:	be 00 00 00 00       	mov    $0x0,%esi
+  801066:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80106c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80106e:	48 85 c0             	test   %rax,%rax
+  801071:	7f 06                	jg     801079 <sys_env_set_trapframe+0x36>
+}
+  801073:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801077:	c9                   	leave
+  801078:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801079:	49 89 c0             	mov    %rax,%r8
+  80107c:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801081:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  801088:	00 00 00 
+  80108b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801090:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  801097:	00 00 00 
+  80109a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109f:	49 b9 fb 3b 80 00 00 	movabs $0x803bfb,%r9
+  8010a6:	00 00 00 
+  8010a9:	41 ff d1             	call   *%r9
+
+00000000008010ac <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8010ac:	55                   	push   %rbp
+  8010ad:	48 89 e5             	mov    %rsp,%rbp
+  8010b0:	53                   	push   %rbx
+  8010b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8010b8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010d7:	48 85 c0             	test   %rax,%rax
+  8010da:	7f 06                	jg     8010e2 <sys_env_set_pgfault_upcall+0x36>
+}
+  8010dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e0:	c9                   	leave
+  8010e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010e2:	49 89 c0             	mov    %rax,%r8
+  8010e5:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8010ea:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  8010f1:	00 00 00 
+  8010f4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8010f9:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  801100:	00 00 00 
+  801103:	b8 00 00 00 00       	mov    $0x0,%eax
+  801108:	49 b9 fb 3b 80 00 00 	movabs $0x803bfb,%r9
+  80110f:	00 00 00 
+  801112:	41 ff d1             	call   *%r9
+
+0000000000801115 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801115:	55                   	push   %rbp
+  801116:	48 89 e5             	mov    %rsp,%rbp
+  801119:	53                   	push   %rbx
+  80111a:	89 f8                	mov    %edi,%eax
+  80111c:	49 89 f1             	mov    %rsi,%r9
+  80111f:	48 89 d3             	mov    %rdx,%rbx
+  801122:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801125:	49 63 f0             	movslq %r8d,%rsi
+  801128:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80112b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801130:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801133:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801139:	cd 30                	int    $0x30
+}
+  80113b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80113f:	c9                   	leave
+  801140:	c3                   	ret
+
+0000000000801141 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801141:	55                   	push   %rbp
+  801142:	48 89 e5             	mov    %rsp,%rbp
+  801145:	53                   	push   %rbx
+  801146:	48 83 ec 08          	sub    $0x8,%rsp
+  80114a:	48 89 fa             	mov    %rdi,%rdx
+  80114d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801150:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115f:	be 00 00 00 00       	mov    $0x0,%esi
+  801164:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80116a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80116c:	48 85 c0             	test   %rax,%rax
+  80116f:	7f 06                	jg     801177 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801171:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801175:	c9                   	leave
+  801176:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801177:	49 89 c0             	mov    %rax,%r8
+  80117a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80117f:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  801186:	00 00 00 
+  801189:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80118e:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  801195:	00 00 00 
+  801198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119d:	49 b9 fb 3b 80 00 00 	movabs $0x803bfb,%r9
+  8011a4:	00 00 00 
+  8011a7:	41 ff d1             	call   *%r9
+
+00000000008011aa <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8011aa:	55                   	push   %rbp
+  8011ab:	48 89 e5             	mov    %rsp,%rbp
+  8011ae:	53                   	push   %rbx
+  8011af:	48 89 fa             	mov    %rdi,%rdx
+  8011b2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b5:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011cf:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8011d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d5:	c9                   	leave
+  8011d6:	c3                   	ret
+
+00000000008011d7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8011d7:	55                   	push   %rbp
+  8011d8:	48 89 e5             	mov    %rsp,%rbp
+  8011db:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011dc:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801200:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801202:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801206:	c9                   	leave
+  801207:	c3                   	ret
+
+0000000000801208 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801208:	48 85 ff             	test   %rdi,%rdi
+  80120b:	0f 84 b6 01 00 00    	je     8013c7 <malloc+0x1bf>
+malloc(size_t size) {
+  801211:	55                   	push   %rbp
+  801212:	48 89 e5             	mov    %rsp,%rbp
+  801215:	41 56                	push   %r14
+  801217:	41 55                	push   %r13
+  801219:	41 54                	push   %r12
+  80121b:	53                   	push   %rbx
+  80121c:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  80121f:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801226:	00 00 00 
+  801229:	4c 8b 20             	mov    (%rax),%r12
+  80122c:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801233:	0f 87 94 01 00 00    	ja     8013cd <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801239:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801240:	00 00 00 
+  801243:	48 85 c0             	test   %rax,%rax
+  801246:	74 6b                	je     8012b3 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801248:	4d 85 e4             	test   %r12,%r12
+  80124b:	74 66                	je     8012b3 <malloc+0xab>
+  80124d:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801254:	00 00 00 
+  801257:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80125c:	eb 0d                	jmp    80126b <malloc+0x63>
+  80125e:	48 83 c1 01          	add    $0x1,%rcx
+  801262:	48 83 c2 18          	add    $0x18,%rdx
+  801266:	49 39 cc             	cmp    %rcx,%r12
+  801269:	74 48                	je     8012b3 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  80126b:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801270:	74 ec                	je     80125e <malloc+0x56>
+  801272:	48 39 1a             	cmp    %rbx,(%rdx)
+  801275:	72 e7                	jb     80125e <malloc+0x56>
+                real_freep_size--;
+  801277:	48 83 e8 01          	sub    $0x1,%rax
+  80127b:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801282:	00 00 00 
+                freep[i].is_free = false;
+  801285:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80128c:	00 00 00 
+  80128f:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801293:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801297:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  80129b:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8012a2:	00 
+                freep[i].size = size;
+  8012a3:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8012a7:	48 01 c8             	add    %rcx,%rax
+  8012aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8012ae:	e9 0b 01 00 00       	jmp    8013be <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8012b3:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  8012ba:	00 00 00 
+  8012bd:	48 01 d8             	add    %rbx,%rax
+  8012c0:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8012c6:	76 7c                	jbe    801344 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8012c8:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8012cf:	00 00 00 
+  8012d2:	4c 8b 30             	mov    (%rax),%r14
+  8012d5:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8012dc:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8012df:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8012e6:	00 00 00 
+  8012e9:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8012f0:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8012f7:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8012fd:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801301:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  801308:	00 00 00 
+  80130b:	ff d0                	call   *%rax
+  80130d:	89 c7                	mov    %eax,%edi
+  80130f:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801316:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80131d:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801324:	00 00 00 
+  801327:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  80132b:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801330:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  80133c:	85 c0                	test   %eax,%eax
+  80133e:	0f 88 90 00 00 00    	js     8013d4 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801344:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  80134b:	00 00 00 
+  80134e:	48 8b 31             	mov    (%rcx),%rsi
+  801351:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801358:	00 00 00 
+  80135b:	4c 8b 07             	mov    (%rdi),%r8
+  80135e:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801362:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801369:	00 00 00 
+  80136c:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801370:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801374:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80137b:	00 00 00 
+  80137e:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801382:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801385:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801389:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801390:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801391:	48 89 d8             	mov    %rbx,%rax
+  801394:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801399:	4c 01 c0             	add    %r8,%rax
+  80139c:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  80139f:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8013a6:	48 01 f3             	add    %rsi,%rbx
+  8013a9:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8013ac:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8013b1:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8013b8:	00 00 00 
+  8013bb:	48 89 d0             	mov    %rdx,%rax
+}
+  8013be:	5b                   	pop    %rbx
+  8013bf:	41 5c                	pop    %r12
+  8013c1:	41 5d                	pop    %r13
+  8013c3:	41 5e                	pop    %r14
+  8013c5:	5d                   	pop    %rbp
+  8013c6:	c3                   	ret
+        return NULL;
+  8013c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013cc:	c3                   	ret
+        return NULL;
+  8013cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d2:	eb ea                	jmp    8013be <malloc+0x1b6>
+            return NULL;
+  8013d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d9:	eb e3                	jmp    8013be <malloc+0x1b6>
+
+00000000008013db <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8013db:	55                   	push   %rbp
+  8013dc:	48 89 e5             	mov    %rsp,%rbp
+  8013df:	53                   	push   %rbx
+  8013e0:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8013e4:	48 89 fb             	mov    %rdi,%rbx
+  8013e7:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  8013eb:	48 89 df             	mov    %rbx,%rdi
+  8013ee:	48 b8 08 12 80 00 00 	movabs $0x801208,%rax
+  8013f5:	00 00 00 
+  8013f8:	ff d0                	call   *%rax
+  8013fa:	48 89 c7             	mov    %rax,%rdi
+  8013fd:	48 89 da             	mov    %rbx,%rdx
+  801400:	be 00 00 00 00       	mov    $0x0,%esi
+  801405:	48 b8 14 09 80 00 00 	movabs $0x800914,%rax
+  80140c:	00 00 00 
+  80140f:	ff d0                	call   *%rax
+}
+  801411:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801415:	c9                   	leave
+  801416:	c3                   	ret
+
+0000000000801417 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801417:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  80141e:	00 00 00 
+  801421:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801428:	00 00 00 
+  80142b:	48 3b 02             	cmp    (%rdx),%rax
+  80142e:	74 4d                	je     80147d <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801430:	48 85 c0             	test   %rax,%rax
+  801433:	74 4d                	je     801482 <get_allocsize+0x6b>
+  801435:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80143c:	00 00 00 
+  80143f:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801444:	48 3b 39             	cmp    (%rcx),%rdi
+  801447:	74 13                	je     80145c <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801449:	48 83 c2 01          	add    $0x1,%rdx
+  80144d:	48 83 c1 18          	add    $0x18,%rcx
+  801451:	48 39 d0             	cmp    %rdx,%rax
+  801454:	75 ee                	jne    801444 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145b:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  80145c:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801460:	b8 00 00 00 00       	mov    $0x0,%eax
+  801465:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  80146c:	00 00 00 
+  80146f:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801475:	75 0b                	jne    801482 <get_allocsize+0x6b>
+  801477:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  80147c:	c3                   	ret
+        return 0;
+  80147d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801482:	c3                   	ret
+
+0000000000801483 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801483:	48 85 ff             	test   %rdi,%rdi
+  801486:	0f 84 01 01 00 00    	je     80158d <free+0x10a>
+free(void *ptr) {
+  80148c:	55                   	push   %rbp
+  80148d:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801490:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801497:	00 00 00 
+  80149a:	48 8b 30             	mov    (%rax),%rsi
+  80149d:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8014a4:	00 00 00 
+  8014a7:	48 39 c6             	cmp    %rax,%rsi
+  8014aa:	74 50                	je     8014fc <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8014ac:	48 85 f6             	test   %rsi,%rsi
+  8014af:	74 21                	je     8014d2 <free+0x4f>
+  8014b1:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8014b8:	00 00 00 
+  8014bb:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8014c0:	48 3b 39             	cmp    (%rcx),%rdi
+  8014c3:	74 61                	je     801526 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8014c5:	48 83 c2 01          	add    $0x1,%rdx
+  8014c9:	48 83 c1 18          	add    $0x18,%rcx
+  8014cd:	48 39 d6             	cmp    %rdx,%rsi
+  8014d0:	75 ee                	jne    8014c0 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8014d2:	48 ba 68 52 80 00 00 	movabs $0x805268,%rdx
+  8014d9:	00 00 00 
+  8014dc:	be 12 01 00 00       	mov    $0x112,%esi
+  8014e1:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  8014e8:	00 00 00 
+  8014eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f0:	48 b9 fb 3b 80 00 00 	movabs $0x803bfb,%rcx
+  8014f7:	00 00 00 
+  8014fa:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  8014fc:	48 ba 18 52 80 00 00 	movabs $0x805218,%rdx
+  801503:	00 00 00 
+  801506:	be 06 01 00 00       	mov    $0x106,%esi
+  80150b:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  801512:	00 00 00 
+  801515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151a:	48 b9 fb 3b 80 00 00 	movabs $0x803bfb,%rcx
+  801521:	00 00 00 
+  801524:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801526:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  80152a:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801531:	00 00 00 
+  801534:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80153a:	75 27                	jne    801563 <free+0xe0>
+            freep[i].is_free = true;
+  80153c:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801540:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801547:	00 00 00 
+  80154a:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801551:	00 00 
+            real_freep_size++;
+  801553:	48 83 c0 01          	add    $0x1,%rax
+  801557:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80155e:	00 00 00 
+}
+  801561:	5d                   	pop    %rbp
+  801562:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801563:	48 ba 40 52 80 00 00 	movabs $0x805240,%rdx
+  80156a:	00 00 00 
+  80156d:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801572:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  801579:	00 00 00 
+  80157c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801581:	48 b9 fb 3b 80 00 00 	movabs $0x803bfb,%rcx
+  801588:	00 00 00 
+  80158b:	ff d1                	call   *%rcx
+  80158d:	c3                   	ret
+
+000000000080158e <realloc>:
+realloc(void *ptr, size_t newsize) {
+  80158e:	55                   	push   %rbp
+  80158f:	48 89 e5             	mov    %rsp,%rbp
+  801592:	41 55                	push   %r13
+  801594:	41 54                	push   %r12
+  801596:	53                   	push   %rbx
+  801597:	48 83 ec 08          	sub    $0x8,%rsp
+  80159b:	48 89 fb             	mov    %rdi,%rbx
+  80159e:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  8015a1:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  8015a8:	00 00 00 
+  8015ab:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  8015ad:	49 39 c5             	cmp    %rax,%r13
+  8015b0:	73 0e                	jae    8015c0 <realloc+0x32>
+}
+  8015b2:	48 89 d8             	mov    %rbx,%rax
+  8015b5:	48 83 c4 08          	add    $0x8,%rsp
+  8015b9:	5b                   	pop    %rbx
+  8015ba:	41 5c                	pop    %r12
+  8015bc:	41 5d                	pop    %r13
+  8015be:	5d                   	pop    %rbp
+  8015bf:	c3                   	ret
+  8015c0:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  8015c3:	4c 89 ef             	mov    %r13,%rdi
+  8015c6:	48 b8 08 12 80 00 00 	movabs $0x801208,%rax
+  8015cd:	00 00 00 
+  8015d0:	ff d0                	call   *%rax
+  8015d2:	48 89 c7             	mov    %rax,%rdi
+  8015d5:	4c 89 e2             	mov    %r12,%rdx
+  8015d8:	48 89 de             	mov    %rbx,%rsi
+  8015db:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  8015e2:	00 00 00 
+  8015e5:	ff d0                	call   *%rax
+  8015e7:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  8015ea:	48 89 df             	mov    %rbx,%rdi
+  8015ed:	48 b8 83 14 80 00 00 	movabs $0x801483,%rax
+  8015f4:	00 00 00 
+  8015f7:	ff d0                	call   *%rax
+    return newptr;
+  8015f9:	4c 89 e3             	mov    %r12,%rbx
+  8015fc:	eb b4                	jmp    8015b2 <realloc+0x24>
+
+00000000008015fe <strdup>:
+
+char*
+strdup (const char *src) {
+  8015fe:	55                   	push   %rbp
+  8015ff:	48 89 e5             	mov    %rsp,%rbp
+  801602:	41 54                	push   %r12
+  801604:	53                   	push   %rbx
+  801605:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801608:	48 b8 f6 05 80 00 00 	movabs $0x8005f6,%rax
+  80160f:	00 00 00 
+  801612:	ff d0                	call   *%rax
+  801614:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801618:	4c 89 e7             	mov    %r12,%rdi
+  80161b:	48 b8 08 12 80 00 00 	movabs $0x801208,%rax
+  801622:	00 00 00 
+  801625:	ff d0                	call   *%rax
+  801627:	48 89 c7             	mov    %rax,%rdi
+  80162a:	4c 89 e2             	mov    %r12,%rdx
+  80162d:	48 89 de             	mov    %rbx,%rsi
+  801630:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  801637:	00 00 00 
+  80163a:	ff d0                	call   *%rax
+}
+  80163c:	5b                   	pop    %rbx
+  80163d:	41 5c                	pop    %r12
+  80163f:	5d                   	pop    %rbp
+  801640:	c3                   	ret
+
+0000000000801641 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801641:	55                   	push   %rbp
+  801642:	48 89 e5             	mov    %rsp,%rbp
+  801645:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801646:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801650:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801655:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165f:	be 00 00 00 00       	mov    $0x0,%esi
+  801664:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80166a:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  80166c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801670:	c9                   	leave
+  801671:	c3                   	ret
+
+0000000000801672 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801672:	55                   	push   %rbp
+  801673:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801676:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  80167d:	00 00 00 
+  801680:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801684:	74 26                	je     8016ac <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801686:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801688:	48 c1 e2 20          	shl    $0x20,%rdx
+  80168c:	89 c0                	mov    %eax,%eax
+  80168e:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801691:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801698:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  80169f:	00 00 00 
+  8016a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a7:	48 f7 31             	divq   (%rcx)
+}
+  8016aa:	5d                   	pop    %rbp
+  8016ab:	c3                   	ret
+        freq = get_cpufreq();
+  8016ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b1:	48 ba 41 16 80 00 00 	movabs $0x801641,%rdx
+  8016b8:	00 00 00 
+  8016bb:	ff d2                	call   *%rdx
+  8016bd:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  8016c4:	00 00 00 
+  8016c7:	eb bd                	jmp    801686 <get_ticks+0x14>
+
+00000000008016c9 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  8016c9:	55                   	push   %rbp
+  8016ca:	48 89 e5             	mov    %rsp,%rbp
+  8016cd:	53                   	push   %rbx
+  8016ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d2:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  8016d5:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  8016dc:	00 00 00 
+  8016df:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8016e3:	74 50                	je     801735 <sleep+0x6c>
+    asm volatile("rdtsc"
+  8016e5:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8016e7:	48 c1 e2 20          	shl    $0x20,%rdx
+  8016eb:	89 c0                	mov    %eax,%eax
+  8016ed:	48 89 d6             	mov    %rdx,%rsi
+  8016f0:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  8016f3:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  8016fa:	00 00 00 
+  8016fd:	48 0f af 18          	imul   (%rax),%rbx
+  801701:	48 c1 eb 03          	shr    $0x3,%rbx
+  801705:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  80170c:	9b c4 20 
+  80170f:	48 89 d8             	mov    %rbx,%rax
+  801712:	48 f7 e2             	mul    %rdx
+  801715:	48 89 d1             	mov    %rdx,%rcx
+  801718:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  80171c:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80171e:	48 c1 e2 20          	shl    $0x20,%rdx
+  801722:	89 c0                	mov    %eax,%eax
+  801724:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801727:	48 29 f2             	sub    %rsi,%rdx
+  80172a:	48 39 ca             	cmp    %rcx,%rdx
+  80172d:	72 ed                	jb     80171c <sleep+0x53>
+}
+  80172f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801733:	c9                   	leave
+  801734:	c3                   	ret
+        freq = get_cpufreq();
+  801735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173a:	48 ba 41 16 80 00 00 	movabs $0x801641,%rdx
+  801741:	00 00 00 
+  801744:	ff d2                	call   *%rdx
+  801746:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  80174d:	00 00 00 
+  801750:	eb 93                	jmp    8016e5 <sleep+0x1c>
+
+0000000000801752 <poll_kbd>:
+
+int poll_kbd() {
+  801752:	55                   	push   %rbp
+  801753:	48 89 e5             	mov    %rsp,%rbp
+  801756:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801757:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80175c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801761:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801766:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801770:	be 00 00 00 00       	mov    $0x0,%esi
+  801775:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80177b:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  80177d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801781:	c9                   	leave
+  801782:	c3                   	ret
+
+0000000000801783 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801783:	55                   	push   %rbp
+  801784:	48 89 e5             	mov    %rsp,%rbp
+  801787:	53                   	push   %rbx
+  801788:	49 89 fa             	mov    %rdi,%r10
+  80178b:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  80178d:	44 89 c6             	mov    %r8d,%esi
+  801790:	89 cf                	mov    %ecx,%edi
+  801792:	89 d3                	mov    %edx,%ebx
+  801794:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801796:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80179b:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80179e:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  8017a2:	cd 30                	int    $0x30
+  8017a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a8:	c9                   	leave
+  8017a9:	c3                   	ret
+
+00000000008017aa <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017aa:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017b1:	ff ff ff 
+  8017b4:	48 01 f8             	add    %rdi,%rax
+  8017b7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017bb:	c3                   	ret
+
+00000000008017bc <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017bc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017c3:	ff ff ff 
+  8017c6:	48 01 f8             	add    %rdi,%rax
+  8017c9:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8017cd:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8017d3:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8017d7:	c3                   	ret
+
+00000000008017d8 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8017d8:	55                   	push   %rbp
+  8017d9:	48 89 e5             	mov    %rsp,%rbp
+  8017dc:	41 57                	push   %r15
+  8017de:	41 56                	push   %r14
+  8017e0:	41 55                	push   %r13
+  8017e2:	41 54                	push   %r12
+  8017e4:	53                   	push   %rbx
+  8017e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e9:	49 89 ff             	mov    %rdi,%r15
+  8017ec:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8017f1:	49 bd 54 38 80 00 00 	movabs $0x803854,%r13
+  8017f8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8017fb:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801801:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801804:	48 89 df             	mov    %rbx,%rdi
+  801807:	41 ff d5             	call   *%r13
+  80180a:	83 e0 04             	and    $0x4,%eax
+  80180d:	74 17                	je     801826 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80180f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801816:	4c 39 f3             	cmp    %r14,%rbx
+  801819:	75 e6                	jne    801801 <fd_alloc+0x29>
+  80181b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801821:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801826:	4d 89 27             	mov    %r12,(%r15)
+}
+  801829:	48 83 c4 08          	add    $0x8,%rsp
+  80182d:	5b                   	pop    %rbx
+  80182e:	41 5c                	pop    %r12
+  801830:	41 5d                	pop    %r13
+  801832:	41 5e                	pop    %r14
+  801834:	41 5f                	pop    %r15
+  801836:	5d                   	pop    %rbp
+  801837:	c3                   	ret
+
+0000000000801838 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801838:	83 ff 1f             	cmp    $0x1f,%edi
+  80183b:	77 39                	ja     801876 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80183d:	55                   	push   %rbp
+  80183e:	48 89 e5             	mov    %rsp,%rbp
+  801841:	41 54                	push   %r12
+  801843:	53                   	push   %rbx
+  801844:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801847:	48 63 df             	movslq %edi,%rbx
+  80184a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801851:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801855:	48 89 df             	mov    %rbx,%rdi
+  801858:	48 b8 54 38 80 00 00 	movabs $0x803854,%rax
+  80185f:	00 00 00 
+  801862:	ff d0                	call   *%rax
+  801864:	a8 04                	test   $0x4,%al
+  801866:	74 14                	je     80187c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801868:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80186c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801871:	5b                   	pop    %rbx
+  801872:	41 5c                	pop    %r12
+  801874:	5d                   	pop    %rbp
+  801875:	c3                   	ret
+        return -E_INVAL;
+  801876:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80187b:	c3                   	ret
+        return -E_INVAL;
+  80187c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801881:	eb ee                	jmp    801871 <fd_lookup+0x39>
+
+0000000000801883 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801883:	55                   	push   %rbp
+  801884:	48 89 e5             	mov    %rsp,%rbp
+  801887:	41 54                	push   %r12
+  801889:	53                   	push   %rbx
+  80188a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80188d:	48 b8 20 53 80 00 00 	movabs $0x805320,%rax
+  801894:	00 00 00 
+  801897:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80189e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8018a1:	39 3b                	cmp    %edi,(%rbx)
+  8018a3:	74 47                	je     8018ec <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8018a5:	48 83 c0 08          	add    $0x8,%rax
+  8018a9:	48 8b 18             	mov    (%rax),%rbx
+  8018ac:	48 85 db             	test   %rbx,%rbx
+  8018af:	75 f0                	jne    8018a1 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018b1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8018b8:	00 00 00 
+  8018bb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8018c1:	89 fa                	mov    %edi,%edx
+  8018c3:	48 bf a0 52 80 00 00 	movabs $0x8052a0,%rdi
+  8018ca:	00 00 00 
+  8018cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d2:	48 b9 4b 3d 80 00 00 	movabs $0x803d4b,%rcx
+  8018d9:	00 00 00 
+  8018dc:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8018de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8018e3:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8018e7:	5b                   	pop    %rbx
+  8018e8:	41 5c                	pop    %r12
+  8018ea:	5d                   	pop    %rbp
+  8018eb:	c3                   	ret
+            return 0;
+  8018ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f1:	eb f0                	jmp    8018e3 <dev_lookup+0x60>
+
+00000000008018f3 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8018f3:	55                   	push   %rbp
+  8018f4:	48 89 e5             	mov    %rsp,%rbp
+  8018f7:	41 55                	push   %r13
+  8018f9:	41 54                	push   %r12
+  8018fb:	53                   	push   %rbx
+  8018fc:	48 83 ec 18          	sub    $0x18,%rsp
+  801900:	48 89 fb             	mov    %rdi,%rbx
+  801903:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801906:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80190d:	ff ff ff 
+  801910:	48 01 df             	add    %rbx,%rdi
+  801913:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801917:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80191b:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  801922:	00 00 00 
+  801925:	ff d0                	call   *%rax
+  801927:	41 89 c5             	mov    %eax,%r13d
+  80192a:	85 c0                	test   %eax,%eax
+  80192c:	78 06                	js     801934 <fd_close+0x41>
+  80192e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801932:	74 1a                	je     80194e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801934:	45 84 e4             	test   %r12b,%r12b
+  801937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801940:	44 89 e8             	mov    %r13d,%eax
+  801943:	48 83 c4 18          	add    $0x18,%rsp
+  801947:	5b                   	pop    %rbx
+  801948:	41 5c                	pop    %r12
+  80194a:	41 5d                	pop    %r13
+  80194c:	5d                   	pop    %rbp
+  80194d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80194e:	8b 3b                	mov    (%rbx),%edi
+  801950:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801954:	48 b8 83 18 80 00 00 	movabs $0x801883,%rax
+  80195b:	00 00 00 
+  80195e:	ff d0                	call   *%rax
+  801960:	41 89 c5             	mov    %eax,%r13d
+  801963:	85 c0                	test   %eax,%eax
+  801965:	78 1b                	js     801982 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801967:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80196b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80196f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801975:	48 85 c0             	test   %rax,%rax
+  801978:	74 08                	je     801982 <fd_close+0x8f>
+  80197a:	48 89 df             	mov    %rbx,%rdi
+  80197d:	ff d0                	call   *%rax
+  80197f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801982:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801987:	48 89 de             	mov    %rbx,%rsi
+  80198a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80198f:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  801996:	00 00 00 
+  801999:	ff d0                	call   *%rax
+    return res;
+  80199b:	eb a3                	jmp    801940 <fd_close+0x4d>
+
+000000000080199d <close>:
+
+int
+close(int fdnum) {
+  80199d:	55                   	push   %rbp
+  80199e:	48 89 e5             	mov    %rsp,%rbp
+  8019a1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8019a5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8019a9:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  8019b0:	00 00 00 
+  8019b3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019b5:	85 c0                	test   %eax,%eax
+  8019b7:	78 15                	js     8019ce <close+0x31>
+
+    return fd_close(fd, 1);
+  8019b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8019be:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8019c2:	48 b8 f3 18 80 00 00 	movabs $0x8018f3,%rax
+  8019c9:	00 00 00 
+  8019cc:	ff d0                	call   *%rax
+}
+  8019ce:	c9                   	leave
+  8019cf:	c3                   	ret
+
+00000000008019d0 <close_all>:
+
+void
+close_all(void) {
+  8019d0:	55                   	push   %rbp
+  8019d1:	48 89 e5             	mov    %rsp,%rbp
+  8019d4:	41 54                	push   %r12
+  8019d6:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8019d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019dc:	49 bc 9d 19 80 00 00 	movabs $0x80199d,%r12
+  8019e3:	00 00 00 
+  8019e6:	89 df                	mov    %ebx,%edi
+  8019e8:	41 ff d4             	call   *%r12
+  8019eb:	83 c3 01             	add    $0x1,%ebx
+  8019ee:	83 fb 20             	cmp    $0x20,%ebx
+  8019f1:	75 f3                	jne    8019e6 <close_all+0x16>
+}
+  8019f3:	5b                   	pop    %rbx
+  8019f4:	41 5c                	pop    %r12
+  8019f6:	5d                   	pop    %rbp
+  8019f7:	c3                   	ret
+
+00000000008019f8 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8019f8:	55                   	push   %rbp
+  8019f9:	48 89 e5             	mov    %rsp,%rbp
+  8019fc:	41 57                	push   %r15
+  8019fe:	41 56                	push   %r14
+  801a00:	41 55                	push   %r13
+  801a02:	41 54                	push   %r12
+  801a04:	53                   	push   %rbx
+  801a05:	48 83 ec 18          	sub    $0x18,%rsp
+  801a09:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a0c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a10:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  801a17:	00 00 00 
+  801a1a:	ff d0                	call   *%rax
+  801a1c:	89 c3                	mov    %eax,%ebx
+  801a1e:	85 c0                	test   %eax,%eax
+  801a20:	0f 88 b8 00 00 00    	js     801ade <dup+0xe6>
+    close(newfdnum);
+  801a26:	44 89 e7             	mov    %r12d,%edi
+  801a29:	48 b8 9d 19 80 00 00 	movabs $0x80199d,%rax
+  801a30:	00 00 00 
+  801a33:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a35:	4d 63 ec             	movslq %r12d,%r13
+  801a38:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a3f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a43:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a47:	4c 89 ff             	mov    %r15,%rdi
+  801a4a:	49 be bc 17 80 00 00 	movabs $0x8017bc,%r14
+  801a51:	00 00 00 
+  801a54:	41 ff d6             	call   *%r14
+  801a57:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a5a:	4c 89 ef             	mov    %r13,%rdi
+  801a5d:	41 ff d6             	call   *%r14
+  801a60:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a63:	48 89 df             	mov    %rbx,%rdi
+  801a66:	48 b8 54 38 80 00 00 	movabs $0x803854,%rax
+  801a6d:	00 00 00 
+  801a70:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a72:	a8 04                	test   $0x4,%al
+  801a74:	74 2b                	je     801aa1 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a76:	41 89 c1             	mov    %eax,%r9d
+  801a79:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a7f:	4c 89 f1             	mov    %r14,%rcx
+  801a82:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a87:	48 89 de             	mov    %rbx,%rsi
+  801a8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a8f:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  801a96:	00 00 00 
+  801a99:	ff d0                	call   *%rax
+  801a9b:	89 c3                	mov    %eax,%ebx
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	78 4e                	js     801aef <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801aa1:	4c 89 ff             	mov    %r15,%rdi
+  801aa4:	48 b8 54 38 80 00 00 	movabs $0x803854,%rax
+  801aab:	00 00 00 
+  801aae:	ff d0                	call   *%rax
+  801ab0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ab3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ab9:	4c 89 e9             	mov    %r13,%rcx
+  801abc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac1:	4c 89 fe             	mov    %r15,%rsi
+  801ac4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac9:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  801ad0:	00 00 00 
+  801ad3:	ff d0                	call   *%rax
+  801ad5:	89 c3                	mov    %eax,%ebx
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	78 14                	js     801aef <dup+0xf7>
+
+    return newfdnum;
+  801adb:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ade:	89 d8                	mov    %ebx,%eax
+  801ae0:	48 83 c4 18          	add    $0x18,%rsp
+  801ae4:	5b                   	pop    %rbx
+  801ae5:	41 5c                	pop    %r12
+  801ae7:	41 5d                	pop    %r13
+  801ae9:	41 5e                	pop    %r14
+  801aeb:	41 5f                	pop    %r15
+  801aed:	5d                   	pop    %rbp
+  801aee:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801aef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801af4:	4c 89 ee             	mov    %r13,%rsi
+  801af7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801afc:	49 bc 73 0f 80 00 00 	movabs $0x800f73,%r12
+  801b03:	00 00 00 
+  801b06:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b0e:	4c 89 f6             	mov    %r14,%rsi
+  801b11:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b16:	41 ff d4             	call   *%r12
+    return res;
+  801b19:	eb c3                	jmp    801ade <dup+0xe6>
+
+0000000000801b1b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b1b:	55                   	push   %rbp
+  801b1c:	48 89 e5             	mov    %rsp,%rbp
+  801b1f:	41 56                	push   %r14
+  801b21:	41 55                	push   %r13
+  801b23:	41 54                	push   %r12
+  801b25:	53                   	push   %rbx
+  801b26:	48 83 ec 10          	sub    $0x10,%rsp
+  801b2a:	89 fb                	mov    %edi,%ebx
+  801b2c:	49 89 f4             	mov    %rsi,%r12
+  801b2f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b32:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b36:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  801b3d:	00 00 00 
+  801b40:	ff d0                	call   *%rax
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	78 4c                	js     801b92 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b46:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b4a:	41 8b 3e             	mov    (%r14),%edi
+  801b4d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b51:	48 b8 83 18 80 00 00 	movabs $0x801883,%rax
+  801b58:	00 00 00 
+  801b5b:	ff d0                	call   *%rax
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	78 35                	js     801b96 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b61:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b65:	83 e0 03             	and    $0x3,%eax
+  801b68:	83 f8 01             	cmp    $0x1,%eax
+  801b6b:	74 2d                	je     801b9a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b71:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b75:	48 85 c0             	test   %rax,%rax
+  801b78:	74 56                	je     801bd0 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b7a:	4c 89 ea             	mov    %r13,%rdx
+  801b7d:	4c 89 e6             	mov    %r12,%rsi
+  801b80:	4c 89 f7             	mov    %r14,%rdi
+  801b83:	ff d0                	call   *%rax
+}
+  801b85:	48 83 c4 10          	add    $0x10,%rsp
+  801b89:	5b                   	pop    %rbx
+  801b8a:	41 5c                	pop    %r12
+  801b8c:	41 5d                	pop    %r13
+  801b8e:	41 5e                	pop    %r14
+  801b90:	5d                   	pop    %rbp
+  801b91:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b92:	48 98                	cltq
+  801b94:	eb ef                	jmp    801b85 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b96:	48 98                	cltq
+  801b98:	eb eb                	jmp    801b85 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b9a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801ba1:	00 00 00 
+  801ba4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801baa:	89 da                	mov    %ebx,%edx
+  801bac:	48 bf e1 52 80 00 00 	movabs $0x8052e1,%rdi
+  801bb3:	00 00 00 
+  801bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bbb:	48 b9 4b 3d 80 00 00 	movabs $0x803d4b,%rcx
+  801bc2:	00 00 00 
+  801bc5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bc7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bce:	eb b5                	jmp    801b85 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bd0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801bd7:	eb ac                	jmp    801b85 <read+0x6a>
+
+0000000000801bd9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801bd9:	55                   	push   %rbp
+  801bda:	48 89 e5             	mov    %rsp,%rbp
+  801bdd:	41 57                	push   %r15
+  801bdf:	41 56                	push   %r14
+  801be1:	41 55                	push   %r13
+  801be3:	41 54                	push   %r12
+  801be5:	53                   	push   %rbx
+  801be6:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801bea:	48 85 d2             	test   %rdx,%rdx
+  801bed:	74 54                	je     801c43 <readn+0x6a>
+  801bef:	41 89 fd             	mov    %edi,%r13d
+  801bf2:	49 89 f6             	mov    %rsi,%r14
+  801bf5:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801bf8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801bfd:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c02:	49 bf 1b 1b 80 00 00 	movabs $0x801b1b,%r15
+  801c09:	00 00 00 
+  801c0c:	4c 89 e2             	mov    %r12,%rdx
+  801c0f:	48 29 f2             	sub    %rsi,%rdx
+  801c12:	4c 01 f6             	add    %r14,%rsi
+  801c15:	44 89 ef             	mov    %r13d,%edi
+  801c18:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c1b:	85 c0                	test   %eax,%eax
+  801c1d:	78 20                	js     801c3f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c1f:	01 c3                	add    %eax,%ebx
+  801c21:	85 c0                	test   %eax,%eax
+  801c23:	74 08                	je     801c2d <readn+0x54>
+  801c25:	48 63 f3             	movslq %ebx,%rsi
+  801c28:	4c 39 e6             	cmp    %r12,%rsi
+  801c2b:	72 df                	jb     801c0c <readn+0x33>
+    }
+    return res;
+  801c2d:	48 63 c3             	movslq %ebx,%rax
+}
+  801c30:	48 83 c4 08          	add    $0x8,%rsp
+  801c34:	5b                   	pop    %rbx
+  801c35:	41 5c                	pop    %r12
+  801c37:	41 5d                	pop    %r13
+  801c39:	41 5e                	pop    %r14
+  801c3b:	41 5f                	pop    %r15
+  801c3d:	5d                   	pop    %rbp
+  801c3e:	c3                   	ret
+        if (inc < 0) return inc;
+  801c3f:	48 98                	cltq
+  801c41:	eb ed                	jmp    801c30 <readn+0x57>
+    int inc = 1, res = 0;
+  801c43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c48:	eb e3                	jmp    801c2d <readn+0x54>
+
+0000000000801c4a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c4a:	55                   	push   %rbp
+  801c4b:	48 89 e5             	mov    %rsp,%rbp
+  801c4e:	41 56                	push   %r14
+  801c50:	41 55                	push   %r13
+  801c52:	41 54                	push   %r12
+  801c54:	53                   	push   %rbx
+  801c55:	48 83 ec 10          	sub    $0x10,%rsp
+  801c59:	89 fb                	mov    %edi,%ebx
+  801c5b:	49 89 f4             	mov    %rsi,%r12
+  801c5e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c61:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c65:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  801c6c:	00 00 00 
+  801c6f:	ff d0                	call   *%rax
+  801c71:	85 c0                	test   %eax,%eax
+  801c73:	78 47                	js     801cbc <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c75:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c79:	41 8b 3e             	mov    (%r14),%edi
+  801c7c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c80:	48 b8 83 18 80 00 00 	movabs $0x801883,%rax
+  801c87:	00 00 00 
+  801c8a:	ff d0                	call   *%rax
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	78 30                	js     801cc0 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c90:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c95:	74 2d                	je     801cc4 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c97:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c9b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c9f:	48 85 c0             	test   %rax,%rax
+  801ca2:	74 56                	je     801cfa <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801ca4:	4c 89 ea             	mov    %r13,%rdx
+  801ca7:	4c 89 e6             	mov    %r12,%rsi
+  801caa:	4c 89 f7             	mov    %r14,%rdi
+  801cad:	ff d0                	call   *%rax
+}
+  801caf:	48 83 c4 10          	add    $0x10,%rsp
+  801cb3:	5b                   	pop    %rbx
+  801cb4:	41 5c                	pop    %r12
+  801cb6:	41 5d                	pop    %r13
+  801cb8:	41 5e                	pop    %r14
+  801cba:	5d                   	pop    %rbp
+  801cbb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cbc:	48 98                	cltq
+  801cbe:	eb ef                	jmp    801caf <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cc0:	48 98                	cltq
+  801cc2:	eb eb                	jmp    801caf <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cc4:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801ccb:	00 00 00 
+  801cce:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cd4:	89 da                	mov    %ebx,%edx
+  801cd6:	48 bf fd 52 80 00 00 	movabs $0x8052fd,%rdi
+  801cdd:	00 00 00 
+  801ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce5:	48 b9 4b 3d 80 00 00 	movabs $0x803d4b,%rcx
+  801cec:	00 00 00 
+  801cef:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cf1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cf8:	eb b5                	jmp    801caf <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cfa:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d01:	eb ac                	jmp    801caf <write+0x65>
+
+0000000000801d03 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d03:	55                   	push   %rbp
+  801d04:	48 89 e5             	mov    %rsp,%rbp
+  801d07:	53                   	push   %rbx
+  801d08:	48 83 ec 18          	sub    $0x18,%rsp
+  801d0c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d0e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d12:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  801d19:	00 00 00 
+  801d1c:	ff d0                	call   *%rax
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	78 0c                	js     801d2e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801d22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d26:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d2e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d32:	c9                   	leave
+  801d33:	c3                   	ret
+
+0000000000801d34 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  801d34:	55                   	push   %rbp
+  801d35:	48 89 e5             	mov    %rsp,%rbp
+  801d38:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801d3c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d40:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  801d47:	00 00 00 
+  801d4a:	ff d0                	call   *%rax
+  801d4c:	85 c0                	test   %eax,%eax
+  801d4e:	78 07                	js     801d57 <tell+0x23>
+    return fdes->fd_offset;
+  801d50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d54:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  801d57:	c9                   	leave
+  801d58:	c3                   	ret
+
+0000000000801d59 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d59:	55                   	push   %rbp
+  801d5a:	48 89 e5             	mov    %rsp,%rbp
+  801d5d:	41 55                	push   %r13
+  801d5f:	41 54                	push   %r12
+  801d61:	53                   	push   %rbx
+  801d62:	48 83 ec 18          	sub    $0x18,%rsp
+  801d66:	89 fb                	mov    %edi,%ebx
+  801d68:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d6b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d6f:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  801d76:	00 00 00 
+  801d79:	ff d0                	call   *%rax
+  801d7b:	85 c0                	test   %eax,%eax
+  801d7d:	78 38                	js     801db7 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d7f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d83:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d87:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d8b:	48 b8 83 18 80 00 00 	movabs $0x801883,%rax
+  801d92:	00 00 00 
+  801d95:	ff d0                	call   *%rax
+  801d97:	85 c0                	test   %eax,%eax
+  801d99:	78 1c                	js     801db7 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d9b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801da0:	74 20                	je     801dc2 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801da2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801da6:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801daa:	48 85 c0             	test   %rax,%rax
+  801dad:	74 47                	je     801df6 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801daf:	44 89 e6             	mov    %r12d,%esi
+  801db2:	4c 89 ef             	mov    %r13,%rdi
+  801db5:	ff d0                	call   *%rax
+}
+  801db7:	48 83 c4 18          	add    $0x18,%rsp
+  801dbb:	5b                   	pop    %rbx
+  801dbc:	41 5c                	pop    %r12
+  801dbe:	41 5d                	pop    %r13
+  801dc0:	5d                   	pop    %rbp
+  801dc1:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801dc2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  801dc9:	00 00 00 
+  801dcc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dd2:	89 da                	mov    %ebx,%edx
+  801dd4:	48 bf c0 52 80 00 00 	movabs $0x8052c0,%rdi
+  801ddb:	00 00 00 
+  801dde:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de3:	48 b9 4b 3d 80 00 00 	movabs $0x803d4b,%rcx
+  801dea:	00 00 00 
+  801ded:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801def:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df4:	eb c1                	jmp    801db7 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801df6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dfb:	eb ba                	jmp    801db7 <ftruncate+0x5e>
+
+0000000000801dfd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801dfd:	55                   	push   %rbp
+  801dfe:	48 89 e5             	mov    %rsp,%rbp
+  801e01:	41 54                	push   %r12
+  801e03:	53                   	push   %rbx
+  801e04:	48 83 ec 10          	sub    $0x10,%rsp
+  801e08:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e0f:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  801e16:	00 00 00 
+  801e19:	ff d0                	call   *%rax
+  801e1b:	85 c0                	test   %eax,%eax
+  801e1d:	78 4e                	js     801e6d <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e1f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e23:	41 8b 3c 24          	mov    (%r12),%edi
+  801e27:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e2b:	48 b8 83 18 80 00 00 	movabs $0x801883,%rax
+  801e32:	00 00 00 
+  801e35:	ff d0                	call   *%rax
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	78 32                	js     801e6d <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e3f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801e44:	74 30                	je     801e76 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e46:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e49:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e50:	00 00 00 
+    stat->st_isdir = 0;
+  801e53:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e5a:	00 00 00 
+    stat->st_dev = dev;
+  801e5d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e64:	48 89 de             	mov    %rbx,%rsi
+  801e67:	4c 89 e7             	mov    %r12,%rdi
+  801e6a:	ff 50 28             	call   *0x28(%rax)
+}
+  801e6d:	48 83 c4 10          	add    $0x10,%rsp
+  801e71:	5b                   	pop    %rbx
+  801e72:	41 5c                	pop    %r12
+  801e74:	5d                   	pop    %rbp
+  801e75:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e76:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e7b:	eb f0                	jmp    801e6d <fstat+0x70>
+
+0000000000801e7d <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  801e7d:	55                   	push   %rbp
+  801e7e:	48 89 e5             	mov    %rsp,%rbp
+  801e81:	41 54                	push   %r12
+  801e83:	53                   	push   %rbx
+  801e84:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  801e8b:	41 89 fc             	mov    %edi,%r12d
+  801e8e:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e90:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e94:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	78 31                	js     801ed5 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  801ea4:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801eab:	44 89 e7             	mov    %r12d,%edi
+  801eae:	48 b8 fd 1d 80 00 00 	movabs $0x801dfd,%rax
+  801eb5:	00 00 00 
+  801eb8:	ff d0                	call   *%rax
+  801eba:	85 c0                	test   %eax,%eax
+  801ebc:	78 17                	js     801ed5 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  801ebe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ec2:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  801ec5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801ec8:	39 d3                	cmp    %edx,%ebx
+  801eca:	0f 4f da             	cmovg  %edx,%ebx
+  801ecd:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ed5:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  801edc:	5b                   	pop    %rbx
+  801edd:	41 5c                	pop    %r12
+  801edf:	5d                   	pop    %rbp
+  801ee0:	c3                   	ret
+
+0000000000801ee1 <seektoend>:
+{
+  801ee1:	55                   	push   %rbp
+  801ee2:	48 89 e5             	mov    %rsp,%rbp
+  801ee5:	53                   	push   %rbx
+  801ee6:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  801eed:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  801eef:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ef3:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  801efa:	00 00 00 
+  801efd:	ff d0                	call   *%rax
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	78 28                	js     801f2b <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  801f03:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801f0a:	89 df                	mov    %ebx,%edi
+  801f0c:	48 b8 fd 1d 80 00 00 	movabs $0x801dfd,%rax
+  801f13:	00 00 00 
+  801f16:	ff d0                	call   *%rax
+  801f18:	85 c0                	test   %eax,%eax
+  801f1a:	78 0f                	js     801f2b <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  801f1c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801f1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f23:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  801f26:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f2f:	c9                   	leave
+  801f30:	c3                   	ret
+
+0000000000801f31 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f31:	55                   	push   %rbp
+  801f32:	48 89 e5             	mov    %rsp,%rbp
+  801f35:	41 54                	push   %r12
+  801f37:	53                   	push   %rbx
+  801f38:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f3b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f40:	48 b8 24 2b 80 00 00 	movabs $0x802b24,%rax
+  801f47:	00 00 00 
+  801f4a:	ff d0                	call   *%rax
+  801f4c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f4e:	85 c0                	test   %eax,%eax
+  801f50:	78 25                	js     801f77 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f52:	4c 89 e6             	mov    %r12,%rsi
+  801f55:	89 c7                	mov    %eax,%edi
+  801f57:	48 b8 fd 1d 80 00 00 	movabs $0x801dfd,%rax
+  801f5e:	00 00 00 
+  801f61:	ff d0                	call   *%rax
+  801f63:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f66:	89 df                	mov    %ebx,%edi
+  801f68:	48 b8 9d 19 80 00 00 	movabs $0x80199d,%rax
+  801f6f:	00 00 00 
+  801f72:	ff d0                	call   *%rax
+
+    return res;
+  801f74:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f77:	89 d8                	mov    %ebx,%eax
+  801f79:	5b                   	pop    %rbx
+  801f7a:	41 5c                	pop    %r12
+  801f7c:	5d                   	pop    %rbp
+  801f7d:	c3                   	ret
+
+0000000000801f7e <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  801f7e:	55                   	push   %rbp
+  801f7f:	48 89 e5             	mov    %rsp,%rbp
+  801f82:	53                   	push   %rbx
+  801f83:	48 83 ec 08          	sub    $0x8,%rsp
+  801f87:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  801f8a:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  801f91:	00 00 00 
+  801f94:	ff d0                	call   *%rax
+  801f96:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801f9a:	0f 87 ea 00 00 00    	ja     80208a <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  801fa0:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  801fa7:	00 00 00 
+  801faa:	80 38 00             	cmpb   $0x0,(%rax)
+  801fad:	75 35                	jne    801fe4 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  801faf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801fb4:	ba 00 00 22 00       	mov    $0x220000,%edx
+  801fb9:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  801fbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fc3:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  801fca:	00 00 00 
+  801fcd:	ff d0                	call   *%rax
+  801fcf:	85 c0                	test   %eax,%eax
+  801fd1:	0f 88 ba 00 00 00    	js     802091 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  801fd7:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  801fde:	00 00 00 
+  801fe1:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  801fe4:	48 89 df             	mov    %rbx,%rdi
+  801fe7:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+  801ff3:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  801ff7:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  801ffe:	00 00 00 
+  802001:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802005:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802008:	39 39                	cmp    %edi,(%rcx)
+  80200a:	74 46                	je     802052 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80200c:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802010:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802017:	00 
+  802018:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80201f:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802026:	00 
+  802027:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80202e:	00 
+  80202f:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802036:	00 
+  802037:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80203e:	00 
+  80203f:	89 39                	mov    %edi,(%rcx)
+  802041:	48 01 c6             	add    %rax,%rsi
+  802044:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802049:	48 89 c8             	mov    %rcx,%rax
+  80204c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802050:	c9                   	leave
+  802051:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802052:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802056:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  80205d:	00 00 00 
+  802060:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802063:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802067:	74 e0                	je     802049 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802069:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802070:	00 
+  802071:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802075:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  80207c:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80207e:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802081:	48 01 c2             	add    %rax,%rdx
+  802084:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802088:	eb bf                	jmp    802049 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  80208a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80208f:	eb b8                	jmp    802049 <fbuf_get+0xcb>
+            return NULL;
+  802091:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802096:	eb b1                	jmp    802049 <fbuf_get+0xcb>
+
+0000000000802098 <fsipc_bulk>:
+fsipc_bulk(void) {
+  802098:	55                   	push   %rbp
+  802099:	48 89 e5             	mov    %rsp,%rbp
+  80209c:	53                   	push   %rbx
+  80209d:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  8020a1:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8020a8:	00 00 00 
+  8020ab:	48 8b 18             	mov    (%rax),%rbx
+  8020ae:	48 85 db             	test   %rbx,%rbx
+  8020b1:	74 16                	je     8020c9 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  8020b3:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  8020ba:	00 00 00 
+  8020bd:	48 8b 18             	mov    (%rax),%rbx
+}
+  8020c0:	48 89 d8             	mov    %rbx,%rax
+  8020c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020c7:	c9                   	leave
+  8020c8:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  8020c9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8020ce:	ba 00 10 04 00       	mov    $0x41000,%edx
+  8020d3:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  8020d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020dd:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  8020e4:	00 00 00 
+  8020e7:	ff d0                	call   *%rax
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	78 d3                	js     8020c0 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8020ed:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8020f2:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8020f9:	00 00 00 
+  8020fc:	eb b5                	jmp    8020b3 <fsipc_bulk+0x1b>
+
+00000000008020fe <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8020fe:	55                   	push   %rbp
+  8020ff:	48 89 e5             	mov    %rsp,%rbp
+  802102:	41 57                	push   %r15
+  802104:	41 56                	push   %r14
+  802106:	41 55                	push   %r13
+  802108:	41 54                	push   %r12
+  80210a:	53                   	push   %rbx
+  80210b:	48 83 ec 08          	sub    $0x8,%rsp
+  80210f:	41 89 fd             	mov    %edi,%r13d
+  802112:	49 89 f6             	mov    %rsi,%r14
+  802115:	49 89 d7             	mov    %rdx,%r15
+  802118:	48 89 cb             	mov    %rcx,%rbx
+  80211b:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80211e:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802125:	00 00 00 
+  802128:	83 38 00             	cmpl   $0x0,(%rax)
+  80212b:	74 52                	je     80217f <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  80212d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802133:	4c 89 f9             	mov    %r15,%rcx
+  802136:	4c 89 f2             	mov    %r14,%rdx
+  802139:	44 89 ee             	mov    %r13d,%esi
+  80213c:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802143:	00 00 00 
+  802146:	8b 38                	mov    (%rax),%edi
+  802148:	48 b8 35 48 80 00 00 	movabs $0x804835,%rax
+  80214f:	00 00 00 
+  802152:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802154:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802159:	4c 89 e2             	mov    %r12,%rdx
+  80215c:	48 89 de             	mov    %rbx,%rsi
+  80215f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802164:	48 b8 85 46 80 00 00 	movabs $0x804685,%rax
+  80216b:	00 00 00 
+  80216e:	ff d0                	call   *%rax
+}
+  802170:	48 83 c4 08          	add    $0x8,%rsp
+  802174:	5b                   	pop    %rbx
+  802175:	41 5c                	pop    %r12
+  802177:	41 5d                	pop    %r13
+  802179:	41 5e                	pop    %r14
+  80217b:	41 5f                	pop    %r15
+  80217d:	5d                   	pop    %rbp
+  80217e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80217f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802184:	48 b8 d8 48 80 00 00 	movabs $0x8048d8,%rax
+  80218b:	00 00 00 
+  80218e:	ff d0                	call   *%rax
+  802190:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802197:	00 00 
+  802199:	eb 92                	jmp    80212d <fsipc_region+0x2f>
+
+000000000080219b <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80219b:	55                   	push   %rbp
+  80219c:	48 89 e5             	mov    %rsp,%rbp
+  80219f:	41 57                	push   %r15
+  8021a1:	41 56                	push   %r14
+  8021a3:	41 55                	push   %r13
+  8021a5:	41 54                	push   %r12
+  8021a7:	53                   	push   %rbx
+  8021a8:	48 83 ec 28          	sub    $0x28,%rsp
+  8021ac:	49 89 ff             	mov    %rdi,%r15
+  8021af:	49 89 f6             	mov    %rsi,%r14
+  8021b2:	48 89 d3             	mov    %rdx,%rbx
+  8021b5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8021b9:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  8021bc:	48 b8 98 20 80 00 00 	movabs $0x802098,%rax
+  8021c3:	00 00 00 
+  8021c6:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  8021c8:	48 85 c0             	test   %rax,%rax
+  8021cb:	0f 84 cc 00 00 00    	je     80229d <devfile_write_direct+0x102>
+  8021d1:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  8021d4:	48 85 db             	test   %rbx,%rbx
+  8021d7:	0f 84 ba 00 00 00    	je     802297 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  8021dd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8021e3:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8021ea:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8021ee:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8021f2:	4c 29 e3             	sub    %r12,%rbx
+  8021f5:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8021fa:	48 39 c3             	cmp    %rax,%rbx
+  8021fd:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802201:	48 89 da             	mov    %rbx,%rdx
+  802204:	4c 89 f6             	mov    %r14,%rsi
+  802207:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80220b:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802217:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80221b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  80221f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802222:	44 01 e0             	add    %r12d,%eax
+  802225:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802229:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  80222d:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802234:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80223b:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802248:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80224d:	4c 89 ee             	mov    %r13,%rsi
+  802250:	bf 04 00 00 00       	mov    $0x4,%edi
+  802255:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+        if (res < 0)
+  802261:	85 c0                	test   %eax,%eax
+  802263:	78 29                	js     80228e <devfile_write_direct+0xf3>
+        if (res == 0)
+  802265:	74 2b                	je     802292 <devfile_write_direct+0xf7>
+        i += res;
+  802267:	48 98                	cltq
+  802269:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  80226c:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  80226f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802273:	49 39 c4             	cmp    %rax,%r12
+  802276:	0f 82 72 ff ff ff    	jb     8021ee <devfile_write_direct+0x53>
+    return i;
+  80227c:	4c 89 e0             	mov    %r12,%rax
+}
+  80227f:	48 83 c4 28          	add    $0x28,%rsp
+  802283:	5b                   	pop    %rbx
+  802284:	41 5c                	pop    %r12
+  802286:	41 5d                	pop    %r13
+  802288:	41 5e                	pop    %r14
+  80228a:	41 5f                	pop    %r15
+  80228c:	5d                   	pop    %rbp
+  80228d:	c3                   	ret
+            return res;
+  80228e:	48 98                	cltq
+  802290:	eb ed                	jmp    80227f <devfile_write_direct+0xe4>
+            return i;
+  802292:	4c 89 e0             	mov    %r12,%rax
+  802295:	eb e8                	jmp    80227f <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802297:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  80229b:	eb df                	jmp    80227c <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  80229d:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  8022a4:	eb d9                	jmp    80227f <devfile_write_direct+0xe4>
+
+00000000008022a6 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  8022a6:	55                   	push   %rbp
+  8022a7:	48 89 e5             	mov    %rsp,%rbp
+  8022aa:	41 56                	push   %r14
+  8022ac:	41 55                	push   %r13
+  8022ae:	41 54                	push   %r12
+  8022b0:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  8022b1:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  8022b5:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  8022b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022be:	4d 39 ee             	cmp    %r13,%r14
+  8022c1:	0f 84 99 00 00 00    	je     802360 <fbuf_flush+0xba>
+  8022c7:	49 89 fc             	mov    %rdi,%r12
+  8022ca:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  8022cd:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8022d0:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8022d4:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  8022db:	00 00 00 
+  8022de:	ff d0                	call   *%rax
+  8022e0:	48 89 c2             	mov    %rax,%rdx
+  8022e3:	48 c1 e2 04          	shl    $0x4,%rdx
+  8022e7:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8022eb:	48 c1 e0 0c          	shl    $0xc,%rax
+  8022ef:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8022f4:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8022f7:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8022fb:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802302:	00 
+  802303:	44 89 f1             	mov    %r14d,%ecx
+  802306:	4c 89 ea             	mov    %r13,%rdx
+  802309:	4c 89 e7             	mov    %r12,%rdi
+  80230c:	48 b8 9b 21 80 00 00 	movabs $0x80219b,%rax
+  802313:	00 00 00 
+  802316:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802318:	48 85 c0             	test   %rax,%rax
+  80231b:	78 43                	js     802360 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  80231d:	4c 39 e8             	cmp    %r13,%rax
+  802320:	72 47                	jb     802369 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802322:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802327:	83 c0 01             	add    $0x1,%eax
+  80232a:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80232f:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802332:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802336:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  80233a:	72 0f                	jb     80234b <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  80233c:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802340:	48 39 c2             	cmp    %rax,%rdx
+  802343:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802347:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  80234b:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802352:	00 
+  802353:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  80235a:	00 
+    return 0;
+  80235b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802360:	5b                   	pop    %rbx
+  802361:	41 5c                	pop    %r12
+  802363:	41 5d                	pop    %r13
+  802365:	41 5e                	pop    %r14
+  802367:	5d                   	pop    %rbp
+  802368:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802369:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80236e:	eb f0                	jmp    802360 <fbuf_flush+0xba>
+
+0000000000802370 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802370:	55                   	push   %rbp
+  802371:	48 89 e5             	mov    %rsp,%rbp
+  802374:	53                   	push   %rbx
+  802375:	48 83 ec 08          	sub    $0x8,%rsp
+  802379:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  80237c:	48 b8 7e 1f 80 00 00 	movabs $0x801f7e,%rax
+  802383:	00 00 00 
+  802386:	ff d0                	call   *%rax
+  802388:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  80238b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802390:	48 85 f6             	test   %rsi,%rsi
+  802393:	74 0f                	je     8023a4 <devfile_sync+0x34>
+  802395:	48 89 df             	mov    %rbx,%rdi
+  802398:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  80239f:	00 00 00 
+  8023a2:	ff d0                	call   *%rax
+}
+  8023a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023a8:	c9                   	leave
+  8023a9:	c3                   	ret
+
+00000000008023aa <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  8023aa:	55                   	push   %rbp
+  8023ab:	48 89 e5             	mov    %rsp,%rbp
+  8023ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8023b2:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  8023b5:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8023bc:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  8023bd:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  8023c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023c6:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8023cd:	00 00 00 
+  8023d0:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  8023d7:	00 00 00 
+  8023da:	ff d0                	call   *%rax
+}
+  8023dc:	c9                   	leave
+  8023dd:	c3                   	ret
+
+00000000008023de <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8023de:	55                   	push   %rbp
+  8023df:	48 89 e5             	mov    %rsp,%rbp
+  8023e2:	41 54                	push   %r12
+  8023e4:	53                   	push   %rbx
+  8023e5:	48 89 fb             	mov    %rdi,%rbx
+  8023e8:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8023eb:	48 b8 70 23 80 00 00 	movabs $0x802370,%rax
+  8023f2:	00 00 00 
+  8023f5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023f7:	85 c0                	test   %eax,%eax
+  8023f9:	78 63                	js     80245e <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8023fb:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8023fe:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802405:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802407:	be 00 00 00 00       	mov    $0x0,%esi
+  80240c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802411:	48 b8 aa 23 80 00 00 	movabs $0x8023aa,%rax
+  802418:	00 00 00 
+  80241b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80241d:	85 c0                	test   %eax,%eax
+  80241f:	78 3d                	js     80245e <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802421:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802428:	00 00 00 
+  80242b:	48 89 de             	mov    %rbx,%rsi
+  80242e:	4c 89 e7             	mov    %r12,%rdi
+  802431:	48 b8 34 06 80 00 00 	movabs $0x800634,%rax
+  802438:	00 00 00 
+  80243b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80243d:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802443:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  80244a:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80244b:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802451:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802458:	00 
+
+    return 0;
+  802459:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80245e:	5b                   	pop    %rbx
+  80245f:	41 5c                	pop    %r12
+  802461:	5d                   	pop    %rbp
+  802462:	c3                   	ret
+
+0000000000802463 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802463:	55                   	push   %rbp
+  802464:	48 89 e5             	mov    %rsp,%rbp
+  802467:	41 54                	push   %r12
+  802469:	53                   	push   %rbx
+  80246a:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  80246d:	48 b8 70 23 80 00 00 	movabs $0x802370,%rax
+  802474:	00 00 00 
+  802477:	ff d0                	call   *%rax
+  802479:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  80247c:	48 89 df             	mov    %rbx,%rdi
+  80247f:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  802486:	00 00 00 
+  802489:	ff d0                	call   *%rax
+  80248b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80248f:	76 2e                	jbe    8024bf <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802491:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802494:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80249b:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  80249d:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8024a7:	48 b8 aa 23 80 00 00 	movabs $0x8023aa,%rax
+  8024ae:	00 00 00 
+  8024b1:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8024b3:	45 85 e4             	test   %r12d,%r12d
+  8024b6:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8024ba:	5b                   	pop    %rbx
+  8024bb:	41 5c                	pop    %r12
+  8024bd:	5d                   	pop    %rbp
+  8024be:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  8024bf:	48 89 df             	mov    %rbx,%rdi
+  8024c2:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  8024c9:	00 00 00 
+  8024cc:	ff d0                	call   *%rax
+  8024ce:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8024d2:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  8024d9:	00 00 00 
+  8024dc:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  8024e3:	48 89 df             	mov    %rbx,%rdi
+  8024e6:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+  8024f2:	48 89 c6             	mov    %rax,%rsi
+  8024f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ff:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  802506:	00 00 00 
+  802509:	ff d0                	call   *%rax
+  80250b:	eb 84                	jmp    802491 <devfile_flush+0x2e>
+
+000000000080250d <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80250d:	55                   	push   %rbp
+  80250e:	48 89 e5             	mov    %rsp,%rbp
+  802511:	41 55                	push   %r13
+  802513:	41 54                	push   %r12
+  802515:	53                   	push   %rbx
+  802516:	48 83 ec 08          	sub    $0x8,%rsp
+  80251a:	48 89 fb             	mov    %rdi,%rbx
+  80251d:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802520:	48 b8 7e 1f 80 00 00 	movabs $0x801f7e,%rax
+  802527:	00 00 00 
+  80252a:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80252c:	48 85 c0             	test   %rax,%rax
+  80252f:	74 51                	je     802582 <devfile_trunc+0x75>
+  802531:	49 89 c4             	mov    %rax,%r12
+  802534:	48 89 c6             	mov    %rax,%rsi
+  802537:	48 89 df             	mov    %rbx,%rdi
+  80253a:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  802541:	00 00 00 
+  802544:	ff d0                	call   *%rax
+  802546:	85 c0                	test   %eax,%eax
+  802548:	78 2d                	js     802577 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80254a:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802551:	00 00 00 
+  802554:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802557:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802559:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  80255d:	be 00 00 00 00       	mov    $0x0,%esi
+  802562:	bf 02 00 00 00       	mov    $0x2,%edi
+  802567:	48 b8 aa 23 80 00 00 	movabs $0x8023aa,%rax
+  80256e:	00 00 00 
+  802571:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802573:	85 c0                	test   %eax,%eax
+  802575:	79 3e                	jns    8025b5 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802577:	48 83 c4 08          	add    $0x8,%rsp
+  80257b:	5b                   	pop    %rbx
+  80257c:	41 5c                	pop    %r12
+  80257e:	41 5d                	pop    %r13
+  802580:	5d                   	pop    %rbp
+  802581:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802582:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802589:	00 00 00 
+  80258c:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80258f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802591:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802595:	be 00 00 00 00       	mov    $0x0,%esi
+  80259a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80259f:	48 b8 aa 23 80 00 00 	movabs $0x8023aa,%rax
+  8025a6:	00 00 00 
+  8025a9:	ff d0                	call   *%rax
+    if (res >= 0) {
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	78 c8                	js     802577 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  8025af:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8025b3:	eb c2                	jmp    802577 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  8025b5:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  8025b8:	8d 51 01             	lea    0x1(%rcx),%edx
+  8025bb:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8025be:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  8025c3:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8025ca:	00 00 
+  8025cc:	eb a9                	jmp    802577 <devfile_trunc+0x6a>
+
+00000000008025ce <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8025ce:	55                   	push   %rbp
+  8025cf:	48 89 e5             	mov    %rsp,%rbp
+  8025d2:	41 57                	push   %r15
+  8025d4:	41 56                	push   %r14
+  8025d6:	41 55                	push   %r13
+  8025d8:	41 54                	push   %r12
+  8025da:	53                   	push   %rbx
+  8025db:	48 83 ec 28          	sub    $0x28,%rsp
+  8025df:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8025e3:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8025e7:	49 89 d7             	mov    %rdx,%r15
+  8025ea:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8025ee:	48 b8 7e 1f 80 00 00 	movabs $0x801f7e,%rax
+  8025f5:	00 00 00 
+  8025f8:	ff d0                	call   *%rax
+  8025fa:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  8025fd:	48 85 c0             	test   %rax,%rax
+  802600:	74 31                	je     802633 <devfile_write+0x65>
+  802602:	4c 89 f8             	mov    %r15,%rax
+  802605:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  80260c:	77 25                	ja     802633 <devfile_write+0x65>
+    size_t i = 0;
+  80260e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802614:	48 85 c0             	test   %rax,%rax
+  802617:	0f 85 64 01 00 00    	jne    802781 <devfile_write+0x1b3>
+    size_t i = 0;
+  80261d:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802621:	4c 89 f8             	mov    %r15,%rax
+}
+  802624:	48 83 c4 28          	add    $0x28,%rsp
+  802628:	5b                   	pop    %rbx
+  802629:	41 5c                	pop    %r12
+  80262b:	41 5d                	pop    %r13
+  80262d:	41 5e                	pop    %r14
+  80262f:	41 5f                	pop    %r15
+  802631:	5d                   	pop    %rbp
+  802632:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802633:	48 85 db             	test   %rbx,%rbx
+  802636:	74 5b                	je     802693 <devfile_write+0xc5>
+  802638:	48 89 de             	mov    %rbx,%rsi
+  80263b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80263f:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  802646:	00 00 00 
+  802649:	ff d0                	call   *%rax
+  80264b:	85 c0                	test   %eax,%eax
+  80264d:	78 40                	js     80268f <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80264f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802653:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802656:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80265a:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80265e:	48 b8 9b 21 80 00 00 	movabs $0x80219b,%rax
+  802665:	00 00 00 
+  802668:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80266a:	48 85 c0             	test   %rax,%rax
+  80266d:	7e b5                	jle    802624 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80266f:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802673:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802676:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802679:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  80267c:	8d 51 01             	lea    0x1(%rcx),%edx
+  80267f:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802682:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802685:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80268c:	00 
+  80268d:	eb 95                	jmp    802624 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80268f:	48 98                	cltq
+  802691:	eb 91                	jmp    802624 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802693:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802697:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  80269a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80269e:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8026a2:	48 89 df             	mov    %rbx,%rdi
+  8026a5:	48 b8 9b 21 80 00 00 	movabs $0x80219b,%rax
+  8026ac:	00 00 00 
+  8026af:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8026b1:	48 85 c0             	test   %rax,%rax
+  8026b4:	0f 8e 6a ff ff ff    	jle    802624 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8026ba:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  8026bd:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8026c1:	e9 5e ff ff ff       	jmp    802624 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8026c6:	48 98                	cltq
+  8026c8:	4d 85 ff             	test   %r15,%r15
+  8026cb:	49 0f 45 c7          	cmovne %r15,%rax
+  8026cf:	e9 50 ff ff ff       	jmp    802624 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8026d4:	48 89 de             	mov    %rbx,%rsi
+  8026d7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8026db:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  8026e2:	00 00 00 
+  8026e5:	ff d0                	call   *%rax
+  8026e7:	85 c0                	test   %eax,%eax
+  8026e9:	0f 88 2b 01 00 00    	js     80281a <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8026ef:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8026f3:	4c 01 f8             	add    %r15,%rax
+  8026f6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8026fa:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8026fe:	48 b9 aa 17 80 00 00 	movabs $0x8017aa,%rcx
+  802705:	00 00 00 
+  802708:	ff d1                	call   *%rcx
+  80270a:	48 89 c2             	mov    %rax,%rdx
+  80270d:	48 c1 e2 04          	shl    $0x4,%rdx
+  802711:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802715:	48 c1 e0 0c          	shl    $0xc,%rax
+  802719:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  80271e:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802721:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802728:	00 
+  802729:	4c 89 ea             	mov    %r13,%rdx
+  80272c:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802730:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  802737:	00 00 00 
+  80273a:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  80273c:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802740:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802744:	48 39 c2             	cmp    %rax,%rdx
+  802747:	0f 84 db 00 00 00    	je     802828 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  80274d:	4c 39 e2             	cmp    %r12,%rdx
+  802750:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802754:	4d 01 ec             	add    %r13,%r12
+  802757:	49 39 c4             	cmp    %rax,%r12
+  80275a:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  80275e:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802762:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802766:	45 01 ee             	add    %r13d,%r14d
+  802769:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80276d:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802771:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802774:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802778:	49 39 c7             	cmp    %rax,%r15
+  80277b:	0f 83 a0 fe ff ff    	jae    802621 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802781:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802785:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802789:	8b 43 08             	mov    0x8(%rbx),%eax
+  80278c:	44 39 f0             	cmp    %r14d,%eax
+  80278f:	7f 10                	jg     8027a1 <devfile_write+0x1d3>
+  802791:	48 98                	cltq
+  802793:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802799:	49 63 d6             	movslq %r14d,%rdx
+  80279c:	48 39 d0             	cmp    %rdx,%rax
+  80279f:	7d 2d                	jge    8027ce <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8027a1:	48 89 de             	mov    %rbx,%rsi
+  8027a4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8027a8:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  8027af:	00 00 00 
+  8027b2:	ff d0                	call   *%rax
+  8027b4:	85 c0                	test   %eax,%eax
+  8027b6:	0f 88 0a ff ff ff    	js     8026c6 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8027bc:	44 89 f0             	mov    %r14d,%eax
+  8027bf:	66 b8 00 00          	mov    $0x0,%ax
+  8027c3:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  8027c6:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8027cd:	00 
+        size_t off = pos - fb->fb_base;
+  8027ce:	45 89 f4             	mov    %r14d,%r12d
+  8027d1:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  8027d5:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  8027d8:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  8027dc:	4d 29 fd             	sub    %r15,%r13
+  8027df:	b8 00 00 01 00       	mov    $0x10000,%eax
+  8027e4:	4c 29 e0             	sub    %r12,%rax
+  8027e7:	49 39 c5             	cmp    %rax,%r13
+  8027ea:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  8027ee:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8027f2:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8027f6:	48 39 c2             	cmp    %rax,%rdx
+  8027f9:	0f 84 f0 fe ff ff    	je     8026ef <devfile_write+0x121>
+  8027ff:	4c 39 e0             	cmp    %r12,%rax
+  802802:	0f 82 cc fe ff ff    	jb     8026d4 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802808:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80280c:	48 39 d0             	cmp    %rdx,%rax
+  80280f:	0f 83 da fe ff ff    	jae    8026ef <devfile_write+0x121>
+  802815:	e9 ba fe ff ff       	jmp    8026d4 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80281a:	48 98                	cltq
+  80281c:	4d 85 ff             	test   %r15,%r15
+  80281f:	49 0f 45 c7          	cmovne %r15,%rax
+  802823:	e9 fc fd ff ff       	jmp    802624 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802828:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80282c:	4c 89 e2             	mov    %r12,%rdx
+  80282f:	e9 2a ff ff ff       	jmp    80275e <devfile_write+0x190>
+
+0000000000802834 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802834:	55                   	push   %rbp
+  802835:	48 89 e5             	mov    %rsp,%rbp
+  802838:	41 57                	push   %r15
+  80283a:	41 56                	push   %r14
+  80283c:	41 55                	push   %r13
+  80283e:	41 54                	push   %r12
+  802840:	53                   	push   %rbx
+  802841:	48 83 ec 28          	sub    $0x28,%rsp
+  802845:	49 89 ff             	mov    %rdi,%r15
+  802848:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80284c:	48 89 d3             	mov    %rdx,%rbx
+  80284f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802853:	48 b8 7e 1f 80 00 00 	movabs $0x801f7e,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+  80285f:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802862:	48 85 c0             	test   %rax,%rax
+  802865:	74 0d                	je     802874 <devfile_read+0x40>
+  802867:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  80286e:	0f 86 1a 01 00 00    	jbe    80298e <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802874:	4d 85 e4             	test   %r12,%r12
+  802877:	74 1a                	je     802893 <devfile_read+0x5f>
+  802879:	4c 89 e6             	mov    %r12,%rsi
+  80287c:	4c 89 ff             	mov    %r15,%rdi
+  80287f:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  802886:	00 00 00 
+  802889:	ff d0                	call   *%rax
+  80288b:	85 c0                	test   %eax,%eax
+  80288d:	0f 88 e8 00 00 00    	js     80297b <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802893:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802897:	48 b8 98 20 80 00 00 	movabs $0x802098,%rax
+  80289e:	00 00 00 
+  8028a1:	ff d0                	call   *%rax
+  8028a3:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  8028a6:	48 85 c0             	test   %rax,%rax
+  8028a9:	0f 84 69 02 00 00    	je     802b18 <devfile_read+0x2e4>
+    while (i < n) {
+  8028af:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8028b4:	0f 84 ce 00 00 00    	je     802988 <devfile_read+0x154>
+    size_t i = 0;
+  8028ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8028bf:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8028c6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8028ca:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  8028ce:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  8028d2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8028d6:	48 29 da             	sub    %rbx,%rdx
+  8028d9:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8028de:	48 39 c2             	cmp    %rax,%rdx
+  8028e1:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  8028e5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028e9:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  8028ed:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8028f0:	01 d8                	add    %ebx,%eax
+  8028f2:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  8028f6:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  8028fa:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802901:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802908:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80290f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802915:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80291a:	4c 89 ee             	mov    %r13,%rsi
+  80291d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802922:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  802929:	00 00 00 
+  80292c:	ff d0                	call   *%rax
+        if (res < 0)
+  80292e:	85 c0                	test   %eax,%eax
+  802930:	78 4d                	js     80297f <devfile_read+0x14b>
+        if (res == 0)
+  802932:	74 4f                	je     802983 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802934:	4c 63 e0             	movslq %eax,%r12
+  802937:	4c 89 e2             	mov    %r12,%rdx
+  80293a:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80293e:	4c 89 f7             	mov    %r14,%rdi
+  802941:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  802948:	00 00 00 
+  80294b:	ff d0                	call   *%rax
+        i += res;
+  80294d:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  802950:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  802953:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802957:	48 39 c3             	cmp    %rax,%rbx
+  80295a:	0f 82 72 ff ff ff    	jb     8028d2 <devfile_read+0x9e>
+    return i;
+  802960:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802963:	48 85 c0             	test   %rax,%rax
+  802966:	7e 04                	jle    80296c <devfile_read+0x138>
+  802968:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  80296c:	48 83 c4 28          	add    $0x28,%rsp
+  802970:	5b                   	pop    %rbx
+  802971:	41 5c                	pop    %r12
+  802973:	41 5d                	pop    %r13
+  802975:	41 5e                	pop    %r14
+  802977:	41 5f                	pop    %r15
+  802979:	5d                   	pop    %rbp
+  80297a:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80297b:	48 98                	cltq
+  80297d:	eb ed                	jmp    80296c <devfile_read+0x138>
+            return res;
+  80297f:	48 98                	cltq
+  802981:	eb e9                	jmp    80296c <devfile_read+0x138>
+            return i;
+  802983:	48 89 d8             	mov    %rbx,%rax
+  802986:	eb db                	jmp    802963 <devfile_read+0x12f>
+    size_t i = 0;
+  802988:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80298c:	eb d2                	jmp    802960 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80298e:	48 89 c6             	mov    %rax,%rsi
+  802991:	4c 89 ff             	mov    %r15,%rdi
+  802994:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  80299b:	00 00 00 
+  80299e:	ff d0                	call   *%rax
+  8029a0:	85 c0                	test   %eax,%eax
+  8029a2:	78 40                	js     8029e4 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8029a4:	4c 89 ff             	mov    %r15,%rdi
+  8029a7:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+  8029b3:	48 89 c2             	mov    %rax,%rdx
+  8029b6:	48 c1 e2 04          	shl    $0x4,%rdx
+  8029ba:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8029be:	48 c1 e0 0c          	shl    $0xc,%rax
+  8029c2:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8029c7:	48 01 d0             	add    %rdx,%rax
+  8029ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8029ce:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8029d3:	0f 84 33 01 00 00    	je     802b0c <devfile_read+0x2d8>
+    size_t i = 0;
+  8029d9:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8029df:	e9 f5 00 00 00       	jmp    802ad9 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8029e4:	48 98                	cltq
+  8029e6:	eb 84                	jmp    80296c <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8029e8:	44 89 e8             	mov    %r13d,%eax
+  8029eb:	66 b8 00 00          	mov    $0x0,%ax
+  8029ef:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8029f4:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8029fb:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8029fd:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802a01:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802a05:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  802a07:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802a0c:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  802a0f:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  802a16:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  802a17:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a22:	ba 00 10 01 00       	mov    $0x11000,%edx
+  802a27:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a2c:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  802a33:	00 00 00 
+  802a36:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  802a38:	85 c0                	test   %eax,%eax
+  802a3a:	0f 88 be 00 00 00    	js     802afe <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  802a40:	48 63 d0             	movslq %eax,%rdx
+  802a43:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  802a48:	41 03 44 24 08       	add    0x8(%r12),%eax
+  802a4d:	44 39 e8             	cmp    %r13d,%eax
+  802a50:	0f 8e ba 00 00 00    	jle    802b10 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  802a56:	49 63 c5             	movslq %r13d,%rax
+  802a59:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  802a5e:	48 29 c3             	sub    %rax,%rbx
+  802a61:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  802a66:	48 01 c3             	add    %rax,%rbx
+  802a69:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a6d:	4c 29 f0             	sub    %r14,%rax
+  802a70:	48 39 c3             	cmp    %rax,%rbx
+  802a73:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802a77:	4c 89 ff             	mov    %r15,%rdi
+  802a7a:	48 b9 aa 17 80 00 00 	movabs $0x8017aa,%rcx
+  802a81:	00 00 00 
+  802a84:	ff d1                	call   *%rcx
+  802a86:	48 89 c2             	mov    %rax,%rdx
+  802a89:	48 c1 e2 04          	shl    $0x4,%rdx
+  802a8d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802a91:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a95:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  802a9a:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  802a9d:	44 89 ea             	mov    %r13d,%edx
+  802aa0:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  802aa5:	48 63 d2             	movslq %edx,%rdx
+  802aa8:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802aaf:	00 
+  802ab0:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802ab4:	4c 01 f7             	add    %r14,%rdi
+  802ab7:	48 89 da             	mov    %rbx,%rdx
+  802aba:	48 b9 29 0a 80 00 00 	movabs $0x800a29,%rcx
+  802ac1:	00 00 00 
+  802ac4:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  802ac6:	41 01 dd             	add    %ebx,%r13d
+  802ac9:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  802acd:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  802ad0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ad4:	49 39 c6             	cmp    %rax,%r14
+  802ad7:	73 37                	jae    802b10 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  802ad9:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  802add:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  802ae2:	44 39 e8             	cmp    %r13d,%eax
+  802ae5:	0f 8f fd fe ff ff    	jg     8029e8 <devfile_read+0x1b4>
+  802aeb:	41 03 44 24 10       	add    0x10(%r12),%eax
+  802af0:	44 39 e8             	cmp    %r13d,%eax
+  802af3:	0f 8f 5d ff ff ff    	jg     802a56 <devfile_read+0x222>
+  802af9:	e9 ea fe ff ff       	jmp    8029e8 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  802afe:	48 98                	cltq
+  802b00:	4d 85 f6             	test   %r14,%r14
+  802b03:	49 0f 45 c6          	cmovne %r14,%rax
+  802b07:	e9 60 fe ff ff       	jmp    80296c <devfile_read+0x138>
+    size_t i = 0;
+  802b0c:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  802b10:	4c 89 f0             	mov    %r14,%rax
+  802b13:	e9 54 fe ff ff       	jmp    80296c <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  802b18:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  802b1f:	e9 48 fe ff ff       	jmp    80296c <devfile_read+0x138>
+
+0000000000802b24 <open>:
+open(const char *path, int mode) {
+  802b24:	55                   	push   %rbp
+  802b25:	48 89 e5             	mov    %rsp,%rbp
+  802b28:	41 55                	push   %r13
+  802b2a:	41 54                	push   %r12
+  802b2c:	53                   	push   %rbx
+  802b2d:	48 83 ec 18          	sub    $0x18,%rsp
+  802b31:	49 89 fc             	mov    %rdi,%r12
+  802b34:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802b37:	48 b8 f6 05 80 00 00 	movabs $0x8005f6,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+  802b43:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802b49:	0f 87 8a 00 00 00    	ja     802bd9 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b4f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b53:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  802b5a:	00 00 00 
+  802b5d:	ff d0                	call   *%rax
+  802b5f:	89 c3                	mov    %eax,%ebx
+  802b61:	85 c0                	test   %eax,%eax
+  802b63:	78 50                	js     802bb5 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802b65:	4c 89 e6             	mov    %r12,%rsi
+  802b68:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802b6f:	00 00 00 
+  802b72:	48 89 df             	mov    %rbx,%rdi
+  802b75:	48 b8 34 06 80 00 00 	movabs $0x800634,%rax
+  802b7c:	00 00 00 
+  802b7f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802b81:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b88:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b8c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b91:	48 b8 aa 23 80 00 00 	movabs $0x8023aa,%rax
+  802b98:	00 00 00 
+  802b9b:	ff d0                	call   *%rax
+  802b9d:	89 c3                	mov    %eax,%ebx
+  802b9f:	85 c0                	test   %eax,%eax
+  802ba1:	78 1f                	js     802bc2 <open+0x9e>
+    return fd2num(fd);
+  802ba3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ba7:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  802bae:	00 00 00 
+  802bb1:	ff d0                	call   *%rax
+  802bb3:	89 c3                	mov    %eax,%ebx
+}
+  802bb5:	89 d8                	mov    %ebx,%eax
+  802bb7:	48 83 c4 18          	add    $0x18,%rsp
+  802bbb:	5b                   	pop    %rbx
+  802bbc:	41 5c                	pop    %r12
+  802bbe:	41 5d                	pop    %r13
+  802bc0:	5d                   	pop    %rbp
+  802bc1:	c3                   	ret
+        fd_close(fd, 0);
+  802bc2:	be 00 00 00 00       	mov    $0x0,%esi
+  802bc7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bcb:	48 b8 f3 18 80 00 00 	movabs $0x8018f3,%rax
+  802bd2:	00 00 00 
+  802bd5:	ff d0                	call   *%rax
+        return res;
+  802bd7:	eb dc                	jmp    802bb5 <open+0x91>
+        return -E_BAD_PATH;
+  802bd9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802bde:	eb d5                	jmp    802bb5 <open+0x91>
+
+0000000000802be0 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  802be0:	55                   	push   %rbp
+  802be1:	48 89 e5             	mov    %rsp,%rbp
+  802be4:	41 57                	push   %r15
+  802be6:	41 56                	push   %r14
+  802be8:	41 55                	push   %r13
+  802bea:	41 54                	push   %r12
+  802bec:	53                   	push   %rbx
+  802bed:	48 83 ec 18          	sub    $0x18,%rsp
+  802bf1:	41 89 f6             	mov    %esi,%r14d
+  802bf4:	49 89 d7             	mov    %rdx,%r15
+  802bf7:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802bfa:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802bfe:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  802c05:	00 00 00 
+  802c08:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c0a:	85 c0                	test   %eax,%eax
+  802c0c:	0f 88 db 00 00 00    	js     802ced <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802c12:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802c16:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802c1d:	00 00 00 
+  802c20:	8b 00                	mov    (%rax),%eax
+  802c22:	39 07                	cmp    %eax,(%rdi)
+  802c24:	0f 85 db 00 00 00    	jne    802d05 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802c2a:	45 85 f6             	test   %r14d,%r14d
+  802c2d:	0f 88 db 00 00 00    	js     802d0e <fmap+0x12e>
+  802c33:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  802c3a:	0f 85 d7 00 00 00    	jne    802d17 <fmap+0x137>
+  802c40:	4c 89 fb             	mov    %r15,%rbx
+  802c43:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802c49:	0f 85 d1 00 00 00    	jne    802d20 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802c4f:	48 b8 70 23 80 00 00 	movabs $0x802370,%rax
+  802c56:	00 00 00 
+  802c59:	ff d0                	call   *%rax
+  802c5b:	85 c0                	test   %eax,%eax
+  802c5d:	0f 88 8e 00 00 00    	js     802cf1 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802c63:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  802c6a:	00 00 00 
+    while (i < n) {
+  802c6d:	4d 85 ed             	test   %r13,%r13
+  802c70:	0f 84 8a 00 00 00    	je     802d00 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  802c76:	4c 89 ea             	mov    %r13,%rdx
+  802c79:	48 29 da             	sub    %rbx,%rdx
+  802c7c:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  802c83:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802c8d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c91:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c94:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  802c98:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  802c9c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  802ca1:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  802ca6:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  802caa:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  802cae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cb3:	4c 89 e6             	mov    %r12,%rsi
+  802cb6:	bf 09 00 00 00       	mov    $0x9,%edi
+  802cbb:	48 b8 fe 20 80 00 00 	movabs $0x8020fe,%rax
+  802cc2:	00 00 00 
+  802cc5:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  802cc7:	85 c0                	test   %eax,%eax
+  802cc9:	78 2a                	js     802cf5 <fmap+0x115>
+        i += res;
+  802ccb:	48 98                	cltq
+  802ccd:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  802cd0:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  802cd4:	72 05                	jb     802cdb <fmap+0xfb>
+    while (i < n) {
+  802cd6:	4c 39 eb             	cmp    %r13,%rbx
+  802cd9:	72 9b                	jb     802c76 <fmap+0x96>
+    }
+    return i;
+  802cdb:	48 89 d8             	mov    %rbx,%rax
+}
+  802cde:	48 83 c4 18          	add    $0x18,%rsp
+  802ce2:	5b                   	pop    %rbx
+  802ce3:	41 5c                	pop    %r12
+  802ce5:	41 5d                	pop    %r13
+  802ce7:	41 5e                	pop    %r14
+  802ce9:	41 5f                	pop    %r15
+  802ceb:	5d                   	pop    %rbp
+  802cec:	c3                   	ret
+    if (res < 0) return res;
+  802ced:	48 98                	cltq
+  802cef:	eb ed                	jmp    802cde <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802cf1:	48 98                	cltq
+  802cf3:	eb e9                	jmp    802cde <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  802cf5:	48 98                	cltq
+  802cf7:	48 85 db             	test   %rbx,%rbx
+  802cfa:	48 0f 45 c3          	cmovne %rbx,%rax
+  802cfe:	eb de                	jmp    802cde <fmap+0xfe>
+    size_t i = 0;
+  802d00:	4c 89 eb             	mov    %r13,%rbx
+  802d03:	eb d6                	jmp    802cdb <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802d05:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802d0c:	eb d0                	jmp    802cde <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  802d0e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802d15:	eb c7                	jmp    802cde <fmap+0xfe>
+  802d17:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802d1e:	eb be                	jmp    802cde <fmap+0xfe>
+  802d20:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802d27:	eb b5                	jmp    802cde <fmap+0xfe>
+
+0000000000802d29 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  802d29:	55                   	push   %rbp
+  802d2a:	48 89 e5             	mov    %rsp,%rbp
+  802d2d:	41 56                	push   %r14
+  802d2f:	41 55                	push   %r13
+  802d31:	41 54                	push   %r12
+  802d33:	53                   	push   %rbx
+  802d34:	48 83 ec 10          	sub    $0x10,%rsp
+  802d38:	89 fb                	mov    %edi,%ebx
+  802d3a:	41 89 f4             	mov    %esi,%r12d
+  802d3d:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802d40:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802d44:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  802d4b:	00 00 00 
+  802d4e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d50:	85 c0                	test   %eax,%eax
+  802d52:	78 63                	js     802db7 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  802d54:	45 85 e4             	test   %r12d,%r12d
+  802d57:	0f 88 80 00 00 00    	js     802ddd <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  802d5d:	45 89 e6             	mov    %r12d,%r14d
+  802d60:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  802d67:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d6b:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  802d72:	00 00 00 
+  802d75:	ff d0                	call   *%rax
+  802d77:	48 89 c2             	mov    %rax,%rdx
+  802d7a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d7f:	44 89 f6             	mov    %r14d,%esi
+  802d82:	89 df                	mov    %ebx,%edi
+  802d84:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  802d8b:	00 00 00 
+  802d8e:	ff d0                	call   *%rax
+  802d90:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  802d93:	45 29 f4             	sub    %r14d,%r12d
+  802d96:	4d 63 f4             	movslq %r12d,%r14
+  802d99:	49 39 c6             	cmp    %rax,%r14
+  802d9c:	7c 1d                	jl     802dbb <read_map+0x92>
+  802d9e:	48 85 c0             	test   %rax,%rax
+  802da1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da6:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  802daa:	48 83 c4 10          	add    $0x10,%rsp
+  802dae:	5b                   	pop    %rbx
+  802daf:	41 5c                	pop    %r12
+  802db1:	41 5d                	pop    %r13
+  802db3:	41 5e                	pop    %r14
+  802db5:	5d                   	pop    %rbp
+  802db6:	c3                   	ret
+    if (res < 0) return res;
+  802db7:	48 98                	cltq
+  802db9:	eb ef                	jmp    802daa <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  802dbb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802dbf:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  802dc6:	00 00 00 
+  802dc9:	ff d0                	call   *%rax
+  802dcb:	4d 63 e4             	movslq %r12d,%r12
+  802dce:	4c 01 e0             	add    %r12,%rax
+  802dd1:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  802dd5:	48 89 d8             	mov    %rbx,%rax
+  802dd8:	4c 29 f0             	sub    %r14,%rax
+  802ddb:	eb cd                	jmp    802daa <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  802ddd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802de4:	eb c4                	jmp    802daa <read_map+0x81>
+
+0000000000802de6 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  802de6:	55                   	push   %rbp
+  802de7:	48 89 e5             	mov    %rsp,%rbp
+  802dea:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802dee:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802df2:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  802df9:	00 00 00 
+  802dfc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802dfe:	85 c0                	test   %eax,%eax
+  802e00:	78 4a                	js     802e4c <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802e02:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e06:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  802e0d:	00 00 00 
+  802e10:	8b 00                	mov    (%rax),%eax
+  802e12:	39 07                	cmp    %eax,(%rdi)
+  802e14:	75 38                	jne    802e4e <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  802e16:	48 b8 70 23 80 00 00 	movabs $0x802370,%rax
+  802e1d:	00 00 00 
+  802e20:	ff d0                	call   *%rax
+  802e22:	85 c0                	test   %eax,%eax
+  802e24:	78 26                	js     802e4c <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802e26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e2a:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e2d:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802e34:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802e36:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3b:	bf 06 00 00 00       	mov    $0x6,%edi
+  802e40:	48 b8 aa 23 80 00 00 	movabs $0x8023aa,%rax
+  802e47:	00 00 00 
+  802e4a:	ff d0                	call   *%rax
+}
+  802e4c:	c9                   	leave
+  802e4d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  802e4e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802e53:	eb f7                	jmp    802e4c <fsync+0x66>
+
+0000000000802e55 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  802e55:	55                   	push   %rbp
+  802e56:	48 89 e5             	mov    %rsp,%rbp
+  802e59:	41 57                	push   %r15
+  802e5b:	41 56                	push   %r14
+  802e5d:	41 55                	push   %r13
+  802e5f:	41 54                	push   %r12
+  802e61:	53                   	push   %rbx
+  802e62:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  802e66:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  802e6d:	00 00 00 
+  802e70:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  802e75:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802e7b:	49 bd 38 18 80 00 00 	movabs $0x801838,%r13
+  802e82:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  802e85:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  802e8c:	00 00 00 
+  802e8f:	eb 0c                	jmp    802e9d <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  802e91:	83 c3 01             	add    $0x1,%ebx
+  802e94:	49 83 c4 28          	add    $0x28,%r12
+  802e98:	83 fb 20             	cmp    $0x20,%ebx
+  802e9b:	74 33                	je     802ed0 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802e9d:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  802ea2:	74 ed                	je     802e91 <flushall+0x3c>
+  802ea4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ea8:	89 df                	mov    %ebx,%edi
+  802eaa:	41 ff d5             	call   *%r13
+  802ead:	85 c0                	test   %eax,%eax
+  802eaf:	78 e0                	js     802e91 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  802eb1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  802eb5:	41 8b 06             	mov    (%r14),%eax
+  802eb8:	39 07                	cmp    %eax,(%rdi)
+  802eba:	75 d5                	jne    802e91 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  802ebc:	48 b8 70 23 80 00 00 	movabs $0x802370,%rax
+  802ec3:	00 00 00 
+  802ec6:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  802ec8:	85 c0                	test   %eax,%eax
+  802eca:	44 0f 48 f8          	cmovs  %eax,%r15d
+  802ece:	eb c1                	jmp    802e91 <flushall+0x3c>
+    }
+    return res;
+}
+  802ed0:	44 89 f8             	mov    %r15d,%eax
+  802ed3:	48 83 c4 18          	add    $0x18,%rsp
+  802ed7:	5b                   	pop    %rbx
+  802ed8:	41 5c                	pop    %r12
+  802eda:	41 5d                	pop    %r13
+  802edc:	41 5e                	pop    %r14
+  802ede:	41 5f                	pop    %r15
+  802ee0:	5d                   	pop    %rbp
+  802ee1:	c3                   	ret
+
+0000000000802ee2 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  802ee2:	55                   	push   %rbp
+  802ee3:	48 89 e5             	mov    %rsp,%rbp
+  802ee6:	53                   	push   %rbx
+  802ee7:	48 83 ec 08          	sub    $0x8,%rsp
+  802eeb:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  802eee:	40 0f b6 c6          	movzbl %sil,%eax
+  802ef2:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802ef9:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  802efb:	be 00 00 00 00       	mov    $0x0,%esi
+  802f00:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802f05:	48 b8 aa 23 80 00 00 	movabs $0x8023aa,%rax
+  802f0c:	00 00 00 
+  802f0f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f11:	85 c0                	test   %eax,%eax
+  802f13:	78 23                	js     802f38 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  802f15:	ba 58 06 00 00       	mov    $0x658,%edx
+  802f1a:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802f21:	00 00 00 
+  802f24:	48 89 df             	mov    %rbx,%rdi
+  802f27:	48 b8 29 0a 80 00 00 	movabs $0x800a29,%rax
+  802f2e:	00 00 00 
+  802f31:	ff d0                	call   *%rax
+    return 0;
+  802f33:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f3c:	c9                   	leave
+  802f3d:	c3                   	ret
+
+0000000000802f3e <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  802f3e:	55                   	push   %rbp
+  802f3f:	48 89 e5             	mov    %rsp,%rbp
+  802f42:	53                   	push   %rbx
+  802f43:	48 83 ec 08          	sub    $0x8,%rsp
+  802f47:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  802f4a:	48 b8 f6 05 80 00 00 	movabs $0x8005f6,%rax
+  802f51:	00 00 00 
+  802f54:	ff d0                	call   *%rax
+  802f56:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f5c:	77 35                	ja     802f93 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  802f5e:	48 89 de             	mov    %rbx,%rsi
+  802f61:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  802f68:	00 00 00 
+  802f6b:	48 b8 34 06 80 00 00 	movabs $0x800634,%rax
+  802f72:	00 00 00 
+  802f75:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  802f77:	be 00 00 00 00       	mov    $0x0,%esi
+  802f7c:	bf 07 00 00 00       	mov    $0x7,%edi
+  802f81:	48 b8 aa 23 80 00 00 	movabs $0x8023aa,%rax
+  802f88:	00 00 00 
+  802f8b:	ff d0                	call   *%rax
+}
+  802f8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f91:	c9                   	leave
+  802f92:	c3                   	ret
+        return -E_BAD_PATH;
+  802f93:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802f98:	eb f3                	jmp    802f8d <remove+0x4f>
+
+0000000000802f9a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802f9a:	55                   	push   %rbp
+  802f9b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  802f9e:	48 b8 55 2e 80 00 00 	movabs $0x802e55,%rax
+  802fa5:	00 00 00 
+  802fa8:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802faa:	be 00 00 00 00       	mov    $0x0,%esi
+  802faf:	bf 08 00 00 00       	mov    $0x8,%edi
+  802fb4:	48 b8 aa 23 80 00 00 	movabs $0x8023aa,%rax
+  802fbb:	00 00 00 
+  802fbe:	ff d0                	call   *%rax
+}
+  802fc0:	5d                   	pop    %rbp
+  802fc1:	c3                   	ret
+
+0000000000802fc2 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  802fc2:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  802fc6:	7f 01                	jg     802fc9 <writebuf+0x7>
+  802fc8:	c3                   	ret
+writebuf(struct printbuf *state) {
+  802fc9:	55                   	push   %rbp
+  802fca:	48 89 e5             	mov    %rsp,%rbp
+  802fcd:	53                   	push   %rbx
+  802fce:	48 83 ec 08          	sub    $0x8,%rsp
+  802fd2:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  802fd5:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  802fd9:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  802fdd:	8b 3f                	mov    (%rdi),%edi
+  802fdf:	48 b8 4a 1c 80 00 00 	movabs $0x801c4a,%rax
+  802fe6:	00 00 00 
+  802fe9:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  802feb:	48 85 c0             	test   %rax,%rax
+  802fee:	7e 04                	jle    802ff4 <writebuf+0x32>
+  802ff0:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  802ff4:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  802ff8:	48 39 c2             	cmp    %rax,%rdx
+  802ffb:	74 0f                	je     80300c <writebuf+0x4a>
+            state->error = MIN(0, result);
+  802ffd:	48 85 c0             	test   %rax,%rax
+  803000:	ba 00 00 00 00       	mov    $0x0,%edx
+  803005:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803009:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  80300c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803010:	c9                   	leave
+  803011:	c3                   	ret
+
+0000000000803012 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803012:	8b 46 04             	mov    0x4(%rsi),%eax
+  803015:	8d 50 01             	lea    0x1(%rax),%edx
+  803018:	89 56 04             	mov    %edx,0x4(%rsi)
+  80301b:	48 98                	cltq
+  80301d:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803022:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803028:	74 01                	je     80302b <putch+0x19>
+  80302a:	c3                   	ret
+putch(int ch, void *arg) {
+  80302b:	55                   	push   %rbp
+  80302c:	48 89 e5             	mov    %rsp,%rbp
+  80302f:	53                   	push   %rbx
+  803030:	48 83 ec 08          	sub    $0x8,%rsp
+  803034:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803037:	48 89 f7             	mov    %rsi,%rdi
+  80303a:	48 b8 c2 2f 80 00 00 	movabs $0x802fc2,%rax
+  803041:	00 00 00 
+  803044:	ff d0                	call   *%rax
+        state->offset = 0;
+  803046:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80304d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803051:	c9                   	leave
+  803052:	c3                   	ret
+
+0000000000803053 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803053:	55                   	push   %rbp
+  803054:	48 89 e5             	mov    %rsp,%rbp
+  803057:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80305e:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803061:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803067:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80306e:	00 00 00 
+    state.result = 0;
+  803071:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803078:	00 00 00 00 
+    state.error = 1;
+  80307c:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803083:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803086:	48 89 f2             	mov    %rsi,%rdx
+  803089:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803090:	48 bf 12 30 80 00 00 	movabs $0x803012,%rdi
+  803097:	00 00 00 
+  80309a:	48 b8 9b 3e 80 00 00 	movabs $0x803e9b,%rax
+  8030a1:	00 00 00 
+  8030a4:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8030a6:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8030ad:	7f 14                	jg     8030c3 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8030af:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8030b6:	48 85 c0             	test   %rax,%rax
+  8030b9:	75 06                	jne    8030c1 <vfprintf+0x6e>
+  8030bb:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8030c1:	c9                   	leave
+  8030c2:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8030c3:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8030ca:	48 b8 c2 2f 80 00 00 	movabs $0x802fc2,%rax
+  8030d1:	00 00 00 
+  8030d4:	ff d0                	call   *%rax
+  8030d6:	eb d7                	jmp    8030af <vfprintf+0x5c>
+
+00000000008030d8 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8030d8:	55                   	push   %rbp
+  8030d9:	48 89 e5             	mov    %rsp,%rbp
+  8030dc:	48 83 ec 50          	sub    $0x50,%rsp
+  8030e0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8030e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8030e8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8030ec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8030f0:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8030f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8030fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030ff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803103:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803107:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80310b:	48 b8 53 30 80 00 00 	movabs $0x803053,%rax
+  803112:	00 00 00 
+  803115:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803117:	c9                   	leave
+  803118:	c3                   	ret
+
+0000000000803119 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803119:	55                   	push   %rbp
+  80311a:	48 89 e5             	mov    %rsp,%rbp
+  80311d:	48 83 ec 50          	sub    $0x50,%rsp
+  803121:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803125:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803129:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80312d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803131:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803135:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80313c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803140:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803144:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803148:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80314c:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803150:	48 89 fe             	mov    %rdi,%rsi
+  803153:	bf 01 00 00 00       	mov    $0x1,%edi
+  803158:	48 b8 53 30 80 00 00 	movabs $0x803053,%rax
+  80315f:	00 00 00 
+  803162:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803164:	c9                   	leave
+  803165:	c3                   	ret
+
+0000000000803166 <puts>:
+
+int
+puts(const char *str) {
+  803166:	55                   	push   %rbp
+  803167:	48 89 e5             	mov    %rsp,%rbp
+  80316a:	48 89 fe             	mov    %rdi,%rsi
+    return printf("%s\n", str);
+  80316d:	48 bf 1b 50 80 00 00 	movabs $0x80501b,%rdi
+  803174:	00 00 00 
+  803177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80317c:	48 ba 19 31 80 00 00 	movabs $0x803119,%rdx
+  803183:	00 00 00 
+  803186:	ff d2                	call   *%rdx
+}
+  803188:	5d                   	pop    %rbp
+  803189:	c3                   	ret
+
+000000000080318a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80318a:	55                   	push   %rbp
+  80318b:	48 89 e5             	mov    %rsp,%rbp
+  80318e:	41 54                	push   %r12
+  803190:	53                   	push   %rbx
+  803191:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803194:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  80319b:	00 00 00 
+  80319e:	ff d0                	call   *%rax
+  8031a0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8031a3:	48 be 40 53 80 00 00 	movabs $0x805340,%rsi
+  8031aa:	00 00 00 
+  8031ad:	48 89 df             	mov    %rbx,%rdi
+  8031b0:	48 b8 34 06 80 00 00 	movabs $0x800634,%rax
+  8031b7:	00 00 00 
+  8031ba:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8031bc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8031c1:	41 2b 04 24          	sub    (%r12),%eax
+  8031c5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8031cb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8031d2:	00 00 00 
+    stat->st_dev = &devpipe;
+  8031d5:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8031dc:	00 00 00 
+  8031df:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8031e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031eb:	5b                   	pop    %rbx
+  8031ec:	41 5c                	pop    %r12
+  8031ee:	5d                   	pop    %rbp
+  8031ef:	c3                   	ret
+
+00000000008031f0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8031f0:	55                   	push   %rbp
+  8031f1:	48 89 e5             	mov    %rsp,%rbp
+  8031f4:	41 54                	push   %r12
+  8031f6:	53                   	push   %rbx
+  8031f7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8031fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031ff:	48 89 fe             	mov    %rdi,%rsi
+  803202:	bf 00 00 00 00       	mov    $0x0,%edi
+  803207:	49 bc 73 0f 80 00 00 	movabs $0x800f73,%r12
+  80320e:	00 00 00 
+  803211:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803214:	48 89 df             	mov    %rbx,%rdi
+  803217:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  80321e:	00 00 00 
+  803221:	ff d0                	call   *%rax
+  803223:	48 89 c6             	mov    %rax,%rsi
+  803226:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80322b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803230:	41 ff d4             	call   *%r12
+}
+  803233:	5b                   	pop    %rbx
+  803234:	41 5c                	pop    %r12
+  803236:	5d                   	pop    %rbp
+  803237:	c3                   	ret
+
+0000000000803238 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803238:	55                   	push   %rbp
+  803239:	48 89 e5             	mov    %rsp,%rbp
+  80323c:	41 57                	push   %r15
+  80323e:	41 56                	push   %r14
+  803240:	41 55                	push   %r13
+  803242:	41 54                	push   %r12
+  803244:	53                   	push   %rbx
+  803245:	48 83 ec 18          	sub    $0x18,%rsp
+  803249:	49 89 fc             	mov    %rdi,%r12
+  80324c:	49 89 f5             	mov    %rsi,%r13
+  80324f:	49 89 d7             	mov    %rdx,%r15
+  803252:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803256:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  80325d:	00 00 00 
+  803260:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803262:	4d 85 ff             	test   %r15,%r15
+  803265:	0f 84 af 00 00 00    	je     80331a <devpipe_write+0xe2>
+  80326b:	48 89 c3             	mov    %rax,%rbx
+  80326e:	4c 89 f8             	mov    %r15,%rax
+  803271:	4d 89 ef             	mov    %r13,%r15
+  803274:	4c 01 e8             	add    %r13,%rax
+  803277:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80327b:	49 bd 68 0d 80 00 00 	movabs $0x800d68,%r13
+  803282:	00 00 00 
+            sys_yield();
+  803285:	49 be 05 0d 80 00 00 	movabs $0x800d05,%r14
+  80328c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80328f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803292:	48 63 ce             	movslq %esi,%rcx
+  803295:	48 63 03             	movslq (%rbx),%rax
+  803298:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80329e:	48 39 c1             	cmp    %rax,%rcx
+  8032a1:	72 2e                	jb     8032d1 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8032a3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8032a8:	48 89 da             	mov    %rbx,%rdx
+  8032ab:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032b0:	4c 89 e7             	mov    %r12,%rdi
+  8032b3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8032b6:	85 c0                	test   %eax,%eax
+  8032b8:	74 66                	je     803320 <devpipe_write+0xe8>
+            sys_yield();
+  8032ba:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8032bd:	8b 73 04             	mov    0x4(%rbx),%esi
+  8032c0:	48 63 ce             	movslq %esi,%rcx
+  8032c3:	48 63 03             	movslq (%rbx),%rax
+  8032c6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8032cc:	48 39 c1             	cmp    %rax,%rcx
+  8032cf:	73 d2                	jae    8032a3 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8032d1:	41 0f b6 3f          	movzbl (%r15),%edi
+  8032d5:	48 89 ca             	mov    %rcx,%rdx
+  8032d8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8032dc:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8032e3:	08 10 20 
+  8032e6:	48 f7 e2             	mul    %rdx
+  8032e9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8032ed:	48 89 d0             	mov    %rdx,%rax
+  8032f0:	48 c1 e0 09          	shl    $0x9,%rax
+  8032f4:	48 29 d0             	sub    %rdx,%rax
+  8032f7:	48 c1 e0 03          	shl    $0x3,%rax
+  8032fb:	48 29 c1             	sub    %rax,%rcx
+  8032fe:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803303:	83 c6 01             	add    $0x1,%esi
+  803306:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803309:	49 83 c7 01          	add    $0x1,%r15
+  80330d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803311:	49 39 c7             	cmp    %rax,%r15
+  803314:	0f 85 75 ff ff ff    	jne    80328f <devpipe_write+0x57>
+    return n;
+  80331a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80331e:	eb 05                	jmp    803325 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803320:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803325:	48 83 c4 18          	add    $0x18,%rsp
+  803329:	5b                   	pop    %rbx
+  80332a:	41 5c                	pop    %r12
+  80332c:	41 5d                	pop    %r13
+  80332e:	41 5e                	pop    %r14
+  803330:	41 5f                	pop    %r15
+  803332:	5d                   	pop    %rbp
+  803333:	c3                   	ret
+
+0000000000803334 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803334:	55                   	push   %rbp
+  803335:	48 89 e5             	mov    %rsp,%rbp
+  803338:	41 57                	push   %r15
+  80333a:	41 56                	push   %r14
+  80333c:	41 55                	push   %r13
+  80333e:	41 54                	push   %r12
+  803340:	53                   	push   %rbx
+  803341:	48 83 ec 18          	sub    $0x18,%rsp
+  803345:	49 89 fc             	mov    %rdi,%r12
+  803348:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80334c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803350:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  803357:	00 00 00 
+  80335a:	ff d0                	call   *%rax
+  80335c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80335f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803365:	49 bd 68 0d 80 00 00 	movabs $0x800d68,%r13
+  80336c:	00 00 00 
+            sys_yield();
+  80336f:	49 be 05 0d 80 00 00 	movabs $0x800d05,%r14
+  803376:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803379:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80337e:	74 7d                	je     8033fd <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803380:	8b 03                	mov    (%rbx),%eax
+  803382:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803385:	75 26                	jne    8033ad <devpipe_read+0x79>
+            if (i > 0) return i;
+  803387:	4d 85 ff             	test   %r15,%r15
+  80338a:	75 77                	jne    803403 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80338c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803391:	48 89 da             	mov    %rbx,%rdx
+  803394:	be 00 10 00 00       	mov    $0x1000,%esi
+  803399:	4c 89 e7             	mov    %r12,%rdi
+  80339c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80339f:	85 c0                	test   %eax,%eax
+  8033a1:	74 72                	je     803415 <devpipe_read+0xe1>
+            sys_yield();
+  8033a3:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8033a6:	8b 03                	mov    (%rbx),%eax
+  8033a8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8033ab:	74 df                	je     80338c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8033ad:	48 63 c8             	movslq %eax,%rcx
+  8033b0:	48 89 ca             	mov    %rcx,%rdx
+  8033b3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8033b7:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8033be:	08 10 20 
+  8033c1:	48 89 d0             	mov    %rdx,%rax
+  8033c4:	48 f7 e6             	mul    %rsi
+  8033c7:	48 c1 ea 06          	shr    $0x6,%rdx
+  8033cb:	48 89 d0             	mov    %rdx,%rax
+  8033ce:	48 c1 e0 09          	shl    $0x9,%rax
+  8033d2:	48 29 d0             	sub    %rdx,%rax
+  8033d5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8033dc:	00 
+  8033dd:	48 89 c8             	mov    %rcx,%rax
+  8033e0:	48 29 d0             	sub    %rdx,%rax
+  8033e3:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8033e8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8033ec:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8033f0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8033f3:	49 83 c7 01          	add    $0x1,%r15
+  8033f7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8033fb:	75 83                	jne    803380 <devpipe_read+0x4c>
+    return n;
+  8033fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803401:	eb 03                	jmp    803406 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803403:	4c 89 f8             	mov    %r15,%rax
+}
+  803406:	48 83 c4 18          	add    $0x18,%rsp
+  80340a:	5b                   	pop    %rbx
+  80340b:	41 5c                	pop    %r12
+  80340d:	41 5d                	pop    %r13
+  80340f:	41 5e                	pop    %r14
+  803411:	41 5f                	pop    %r15
+  803413:	5d                   	pop    %rbp
+  803414:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80341a:	eb ea                	jmp    803406 <devpipe_read+0xd2>
+
+000000000080341c <pipe>:
+pipe(int pfd[2]) {
+  80341c:	55                   	push   %rbp
+  80341d:	48 89 e5             	mov    %rsp,%rbp
+  803420:	41 55                	push   %r13
+  803422:	41 54                	push   %r12
+  803424:	53                   	push   %rbx
+  803425:	48 83 ec 18          	sub    $0x18,%rsp
+  803429:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80342c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803430:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  803437:	00 00 00 
+  80343a:	ff d0                	call   *%rax
+  80343c:	89 c3                	mov    %eax,%ebx
+  80343e:	85 c0                	test   %eax,%eax
+  803440:	0f 88 a0 01 00 00    	js     8035e6 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803446:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80344b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803450:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803454:	bf 00 00 00 00       	mov    $0x0,%edi
+  803459:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  803460:	00 00 00 
+  803463:	ff d0                	call   *%rax
+  803465:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803467:	85 c0                	test   %eax,%eax
+  803469:	0f 88 77 01 00 00    	js     8035e6 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80346f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803473:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  80347a:	00 00 00 
+  80347d:	ff d0                	call   *%rax
+  80347f:	89 c3                	mov    %eax,%ebx
+  803481:	85 c0                	test   %eax,%eax
+  803483:	0f 88 43 01 00 00    	js     8035cc <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803489:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80348e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803493:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803497:	bf 00 00 00 00       	mov    $0x0,%edi
+  80349c:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  8034a3:	00 00 00 
+  8034a6:	ff d0                	call   *%rax
+  8034a8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8034aa:	85 c0                	test   %eax,%eax
+  8034ac:	0f 88 1a 01 00 00    	js     8035cc <pipe+0x1b0>
+    va = fd2data(fd0);
+  8034b2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034b6:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  8034bd:	00 00 00 
+  8034c0:	ff d0                	call   *%rax
+  8034c2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8034c5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034cf:	48 89 c6             	mov    %rax,%rsi
+  8034d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034d7:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  8034de:	00 00 00 
+  8034e1:	ff d0                	call   *%rax
+  8034e3:	89 c3                	mov    %eax,%ebx
+  8034e5:	85 c0                	test   %eax,%eax
+  8034e7:	0f 88 c5 00 00 00    	js     8035b2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8034ed:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8034f1:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  8034f8:	00 00 00 
+  8034fb:	ff d0                	call   *%rax
+  8034fd:	48 89 c1             	mov    %rax,%rcx
+  803500:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803506:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80350c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803511:	4c 89 ee             	mov    %r13,%rsi
+  803514:	bf 00 00 00 00       	mov    $0x0,%edi
+  803519:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  803520:	00 00 00 
+  803523:	ff d0                	call   *%rax
+  803525:	89 c3                	mov    %eax,%ebx
+  803527:	85 c0                	test   %eax,%eax
+  803529:	78 6e                	js     803599 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80352b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803530:	4c 89 ef             	mov    %r13,%rdi
+  803533:	48 b8 36 0d 80 00 00 	movabs $0x800d36,%rax
+  80353a:	00 00 00 
+  80353d:	ff d0                	call   *%rax
+  80353f:	83 f8 02             	cmp    $0x2,%eax
+  803542:	0f 85 ab 00 00 00    	jne    8035f3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803548:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80354f:	00 00 
+  803551:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803555:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803557:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80355b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803562:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803566:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803568:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80356c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803573:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803577:	48 bb aa 17 80 00 00 	movabs $0x8017aa,%rbx
+  80357e:	00 00 00 
+  803581:	ff d3                	call   *%rbx
+  803583:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803587:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80358b:	ff d3                	call   *%rbx
+  80358d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803592:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803597:	eb 4d                	jmp    8035e6 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803599:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80359e:	4c 89 ee             	mov    %r13,%rsi
+  8035a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035a6:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  8035ad:	00 00 00 
+  8035b0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8035b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035b7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8035bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035c0:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  8035c7:	00 00 00 
+  8035ca:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8035cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035d1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8035d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035da:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  8035e1:	00 00 00 
+  8035e4:	ff d0                	call   *%rax
+}
+  8035e6:	89 d8                	mov    %ebx,%eax
+  8035e8:	48 83 c4 18          	add    $0x18,%rsp
+  8035ec:	5b                   	pop    %rbx
+  8035ed:	41 5c                	pop    %r12
+  8035ef:	41 5d                	pop    %r13
+  8035f1:	5d                   	pop    %rbp
+  8035f2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8035f3:	48 b9 70 53 80 00 00 	movabs $0x805370,%rcx
+  8035fa:	00 00 00 
+  8035fd:	48 ba 47 53 80 00 00 	movabs $0x805347,%rdx
+  803604:	00 00 00 
+  803607:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80360c:	48 bf 5c 53 80 00 00 	movabs $0x80535c,%rdi
+  803613:	00 00 00 
+  803616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80361b:	49 b8 fb 3b 80 00 00 	movabs $0x803bfb,%r8
+  803622:	00 00 00 
+  803625:	41 ff d0             	call   *%r8
+
+0000000000803628 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803628:	55                   	push   %rbp
+  803629:	48 89 e5             	mov    %rsp,%rbp
+  80362c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803630:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803634:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  80363b:	00 00 00 
+  80363e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803640:	85 c0                	test   %eax,%eax
+  803642:	78 35                	js     803679 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803644:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803648:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  80364f:	00 00 00 
+  803652:	ff d0                	call   *%rax
+  803654:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803657:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80365c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803661:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803665:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  80366c:	00 00 00 
+  80366f:	ff d0                	call   *%rax
+  803671:	85 c0                	test   %eax,%eax
+  803673:	0f 94 c0             	sete   %al
+  803676:	0f b6 c0             	movzbl %al,%eax
+}
+  803679:	c9                   	leave
+  80367a:	c3                   	ret
+
+000000000080367b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80367b:	48 89 f8             	mov    %rdi,%rax
+  80367e:	48 c1 e8 27          	shr    $0x27,%rax
+  803682:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803689:	7f 00 00 
+  80368c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803690:	f6 c2 01             	test   $0x1,%dl
+  803693:	74 6d                	je     803702 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803695:	48 89 f8             	mov    %rdi,%rax
+  803698:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80369c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036a3:	7f 00 00 
+  8036a6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036aa:	f6 c2 01             	test   $0x1,%dl
+  8036ad:	74 62                	je     803711 <get_uvpt_entry+0x96>
+  8036af:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8036b6:	7f 00 00 
+  8036b9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036bd:	f6 c2 80             	test   $0x80,%dl
+  8036c0:	75 4f                	jne    803711 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8036c2:	48 89 f8             	mov    %rdi,%rax
+  8036c5:	48 c1 e8 15          	shr    $0x15,%rax
+  8036c9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036d0:	7f 00 00 
+  8036d3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036d7:	f6 c2 01             	test   $0x1,%dl
+  8036da:	74 44                	je     803720 <get_uvpt_entry+0xa5>
+  8036dc:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8036e3:	7f 00 00 
+  8036e6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8036ea:	f6 c2 80             	test   $0x80,%dl
+  8036ed:	75 31                	jne    803720 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8036ef:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8036f3:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8036fa:	7f 00 00 
+  8036fd:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803701:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803702:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803709:	7f 00 00 
+  80370c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803710:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803711:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803718:	7f 00 00 
+  80371b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80371f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803720:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803727:	7f 00 00 
+  80372a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80372e:	c3                   	ret
+
+000000000080372f <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80372f:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803732:	48 89 f9             	mov    %rdi,%rcx
+  803735:	48 c1 e9 27          	shr    $0x27,%rcx
+  803739:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803740:	7f 00 00 
+  803743:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803747:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80374e:	f6 c1 01             	test   $0x1,%cl
+  803751:	0f 84 b2 00 00 00    	je     803809 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803757:	48 89 f9             	mov    %rdi,%rcx
+  80375a:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80375e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803765:	7f 00 00 
+  803768:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80376c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803773:	40 f6 c6 01          	test   $0x1,%sil
+  803777:	0f 84 8c 00 00 00    	je     803809 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  80377d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803784:	7f 00 00 
+  803787:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80378b:	a8 80                	test   $0x80,%al
+  80378d:	75 7b                	jne    80380a <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80378f:	48 89 f9             	mov    %rdi,%rcx
+  803792:	48 c1 e9 15          	shr    $0x15,%rcx
+  803796:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80379d:	7f 00 00 
+  8037a0:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037a4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8037ab:	40 f6 c6 01          	test   $0x1,%sil
+  8037af:	74 58                	je     803809 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8037b1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8037b8:	7f 00 00 
+  8037bb:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037bf:	a8 80                	test   $0x80,%al
+  8037c1:	75 6c                	jne    80382f <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8037c3:	48 89 f9             	mov    %rdi,%rcx
+  8037c6:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8037ca:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037d1:	7f 00 00 
+  8037d4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8037d8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8037df:	40 f6 c6 01          	test   $0x1,%sil
+  8037e3:	74 24                	je     803809 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8037e5:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8037ec:	7f 00 00 
+  8037ef:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8037f3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8037fa:	ff ff 7f 
+  8037fd:	48 21 c8             	and    %rcx,%rax
+  803800:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803806:	48 09 d0             	or     %rdx,%rax
+}
+  803809:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80380a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803811:	7f 00 00 
+  803814:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803818:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80381f:	ff ff 7f 
+  803822:	48 21 c8             	and    %rcx,%rax
+  803825:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80382b:	48 01 d0             	add    %rdx,%rax
+  80382e:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80382f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803836:	7f 00 00 
+  803839:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80383d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803844:	ff ff 7f 
+  803847:	48 21 c8             	and    %rcx,%rax
+  80384a:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803850:	48 01 d0             	add    %rdx,%rax
+  803853:	c3                   	ret
+
+0000000000803854 <get_prot>:
+
+int
+get_prot(void *va) {
+  803854:	55                   	push   %rbp
+  803855:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803858:	48 b8 7b 36 80 00 00 	movabs $0x80367b,%rax
+  80385f:	00 00 00 
+  803862:	ff d0                	call   *%rax
+  803864:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803867:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80386c:	89 c1                	mov    %eax,%ecx
+  80386e:	83 c9 04             	or     $0x4,%ecx
+  803871:	f6 c2 01             	test   $0x1,%dl
+  803874:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803877:	89 c1                	mov    %eax,%ecx
+  803879:	83 c9 02             	or     $0x2,%ecx
+  80387c:	f6 c2 02             	test   $0x2,%dl
+  80387f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803882:	89 c1                	mov    %eax,%ecx
+  803884:	83 c9 01             	or     $0x1,%ecx
+  803887:	48 85 d2             	test   %rdx,%rdx
+  80388a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80388d:	89 c1                	mov    %eax,%ecx
+  80388f:	83 c9 40             	or     $0x40,%ecx
+  803892:	f6 c6 04             	test   $0x4,%dh
+  803895:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803898:	5d                   	pop    %rbp
+  803899:	c3                   	ret
+
+000000000080389a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80389a:	55                   	push   %rbp
+  80389b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80389e:	48 b8 7b 36 80 00 00 	movabs $0x80367b,%rax
+  8038a5:	00 00 00 
+  8038a8:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8038aa:	48 c1 e8 06          	shr    $0x6,%rax
+  8038ae:	83 e0 01             	and    $0x1,%eax
+}
+  8038b1:	5d                   	pop    %rbp
+  8038b2:	c3                   	ret
+
+00000000008038b3 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8038b3:	55                   	push   %rbp
+  8038b4:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8038b7:	48 b8 7b 36 80 00 00 	movabs $0x80367b,%rax
+  8038be:	00 00 00 
+  8038c1:	ff d0                	call   *%rax
+  8038c3:	83 e0 01             	and    $0x1,%eax
+}
+  8038c6:	5d                   	pop    %rbp
+  8038c7:	c3                   	ret
+
+00000000008038c8 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8038c8:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8038cf:	7f 00 00 
+  8038d2:	a8 01                	test   $0x1,%al
+  8038d4:	75 06                	jne    8038dc <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8038d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038db:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8038dc:	55                   	push   %rbp
+  8038dd:	48 89 e5             	mov    %rsp,%rbp
+  8038e0:	41 57                	push   %r15
+  8038e2:	41 56                	push   %r14
+  8038e4:	41 55                	push   %r13
+  8038e6:	41 54                	push   %r12
+  8038e8:	53                   	push   %rbx
+  8038e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8038ed:	49 89 fe             	mov    %rdi,%r14
+  8038f0:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8038f3:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8038fa:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8038fb:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803902:	7f 00 00 
+  803905:	e9 81 00 00 00       	jmp    80398b <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  80390a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803911:	49 39 dd             	cmp    %rbx,%r13
+  803914:	74 2b                	je     803941 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803916:	48 89 d8             	mov    %rbx,%rax
+  803919:	48 c1 e8 0c          	shr    $0xc,%rax
+  80391d:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803921:	f6 c2 01             	test   $0x1,%dl
+  803924:	74 e4                	je     80390a <foreach_shared_region+0x42>
+  803926:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  80392a:	f6 c4 04             	test   $0x4,%ah
+  80392d:	74 db                	je     80390a <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  80392f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803936:	4c 89 fa             	mov    %r15,%rdx
+  803939:	48 89 df             	mov    %rbx,%rdi
+  80393c:	41 ff d6             	call   *%r14
+  80393f:	eb c9                	jmp    80390a <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803941:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803948:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  80394c:	74 22                	je     803970 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  80394e:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803955:	48 89 d8             	mov    %rbx,%rax
+  803958:	48 c1 e8 15          	shr    $0x15,%rax
+  80395c:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803963:	7f 00 00 
+  803966:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80396a:	a8 01                	test   $0x1,%al
+  80396c:	74 d3                	je     803941 <foreach_shared_region+0x79>
+  80396e:	eb a6                	jmp    803916 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803970:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803977:	40 
+  803978:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80397c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803983:	00 00 00 
+  803986:	48 39 c1             	cmp    %rax,%rcx
+  803989:	74 31                	je     8039bc <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  80398b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80398f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803993:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  80399a:	7f 00 00 
+  80399d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8039a1:	a8 01                	test   $0x1,%al
+  8039a3:	74 cb                	je     803970 <foreach_shared_region+0xa8>
+  8039a5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8039a9:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8039b0:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8039b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8039ba:	eb 92                	jmp    80394e <foreach_shared_region+0x86>
+}
+  8039bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c1:	48 83 c4 18          	add    $0x18,%rsp
+  8039c5:	5b                   	pop    %rbx
+  8039c6:	41 5c                	pop    %r12
+  8039c8:	41 5d                	pop    %r13
+  8039ca:	41 5e                	pop    %r14
+  8039cc:	41 5f                	pop    %r15
+  8039ce:	5d                   	pop    %rbp
+  8039cf:	c3                   	ret
+
+00000000008039d0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8039d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039d5:	c3                   	ret
+
+00000000008039d6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8039d6:	55                   	push   %rbp
+  8039d7:	48 89 e5             	mov    %rsp,%rbp
+  8039da:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8039dd:	48 be 94 53 80 00 00 	movabs $0x805394,%rsi
+  8039e4:	00 00 00 
+  8039e7:	48 b8 34 06 80 00 00 	movabs $0x800634,%rax
+  8039ee:	00 00 00 
+  8039f1:	ff d0                	call   *%rax
+    return 0;
+}
+  8039f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039f8:	5d                   	pop    %rbp
+  8039f9:	c3                   	ret
+
+00000000008039fa <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039fa:	55                   	push   %rbp
+  8039fb:	48 89 e5             	mov    %rsp,%rbp
+  8039fe:	41 57                	push   %r15
+  803a00:	41 56                	push   %r14
+  803a02:	41 55                	push   %r13
+  803a04:	41 54                	push   %r12
+  803a06:	53                   	push   %rbx
+  803a07:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803a0e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803a15:	48 85 d2             	test   %rdx,%rdx
+  803a18:	74 7a                	je     803a94 <devcons_write+0x9a>
+  803a1a:	49 89 d6             	mov    %rdx,%r14
+  803a1d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803a23:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803a28:	49 bf c2 09 80 00 00 	movabs $0x8009c2,%r15
+  803a2f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803a32:	4c 89 f3             	mov    %r14,%rbx
+  803a35:	48 29 f3             	sub    %rsi,%rbx
+  803a38:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803a3d:	48 39 c3             	cmp    %rax,%rbx
+  803a40:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803a44:	4c 63 eb             	movslq %ebx,%r13
+  803a47:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803a4e:	48 01 c6             	add    %rax,%rsi
+  803a51:	4c 89 ea             	mov    %r13,%rdx
+  803a54:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a5b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803a5e:	4c 89 ee             	mov    %r13,%rsi
+  803a61:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803a68:	48 b8 0b 0c 80 00 00 	movabs $0x800c0b,%rax
+  803a6f:	00 00 00 
+  803a72:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803a74:	41 01 dc             	add    %ebx,%r12d
+  803a77:	49 63 f4             	movslq %r12d,%rsi
+  803a7a:	4c 39 f6             	cmp    %r14,%rsi
+  803a7d:	72 b3                	jb     803a32 <devcons_write+0x38>
+    return res;
+  803a7f:	49 63 c4             	movslq %r12d,%rax
+}
+  803a82:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803a89:	5b                   	pop    %rbx
+  803a8a:	41 5c                	pop    %r12
+  803a8c:	41 5d                	pop    %r13
+  803a8e:	41 5e                	pop    %r14
+  803a90:	41 5f                	pop    %r15
+  803a92:	5d                   	pop    %rbp
+  803a93:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803a94:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803a9a:	eb e3                	jmp    803a7f <devcons_write+0x85>
+
+0000000000803a9c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a9c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803a9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803aa4:	48 85 c0             	test   %rax,%rax
+  803aa7:	74 55                	je     803afe <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803aa9:	55                   	push   %rbp
+  803aaa:	48 89 e5             	mov    %rsp,%rbp
+  803aad:	41 55                	push   %r13
+  803aaf:	41 54                	push   %r12
+  803ab1:	53                   	push   %rbx
+  803ab2:	48 83 ec 08          	sub    $0x8,%rsp
+  803ab6:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803ab9:	48 bb 38 0c 80 00 00 	movabs $0x800c38,%rbx
+  803ac0:	00 00 00 
+  803ac3:	49 bc 05 0d 80 00 00 	movabs $0x800d05,%r12
+  803aca:	00 00 00 
+  803acd:	eb 03                	jmp    803ad2 <devcons_read+0x36>
+  803acf:	41 ff d4             	call   *%r12
+  803ad2:	ff d3                	call   *%rbx
+  803ad4:	85 c0                	test   %eax,%eax
+  803ad6:	74 f7                	je     803acf <devcons_read+0x33>
+    if (c < 0) return c;
+  803ad8:	48 63 d0             	movslq %eax,%rdx
+  803adb:	78 13                	js     803af0 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803add:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ae2:	83 f8 04             	cmp    $0x4,%eax
+  803ae5:	74 09                	je     803af0 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803ae7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803aeb:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803af0:	48 89 d0             	mov    %rdx,%rax
+  803af3:	48 83 c4 08          	add    $0x8,%rsp
+  803af7:	5b                   	pop    %rbx
+  803af8:	41 5c                	pop    %r12
+  803afa:	41 5d                	pop    %r13
+  803afc:	5d                   	pop    %rbp
+  803afd:	c3                   	ret
+  803afe:	48 89 d0             	mov    %rdx,%rax
+  803b01:	c3                   	ret
+
+0000000000803b02 <cputchar>:
+cputchar(int ch) {
+  803b02:	55                   	push   %rbp
+  803b03:	48 89 e5             	mov    %rsp,%rbp
+  803b06:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803b0a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803b0e:	be 01 00 00 00       	mov    $0x1,%esi
+  803b13:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803b17:	48 b8 0b 0c 80 00 00 	movabs $0x800c0b,%rax
+  803b1e:	00 00 00 
+  803b21:	ff d0                	call   *%rax
+}
+  803b23:	c9                   	leave
+  803b24:	c3                   	ret
+
+0000000000803b25 <getchar>:
+getchar(void) {
+  803b25:	55                   	push   %rbp
+  803b26:	48 89 e5             	mov    %rsp,%rbp
+  803b29:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803b2d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b32:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803b36:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b3b:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  803b42:	00 00 00 
+  803b45:	ff d0                	call   *%rax
+  803b47:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803b49:	85 c0                	test   %eax,%eax
+  803b4b:	78 06                	js     803b53 <getchar+0x2e>
+  803b4d:	74 08                	je     803b57 <getchar+0x32>
+  803b4f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803b53:	89 d0                	mov    %edx,%eax
+  803b55:	c9                   	leave
+  803b56:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803b57:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803b5c:	eb f5                	jmp    803b53 <getchar+0x2e>
+
+0000000000803b5e <iscons>:
+iscons(int fdnum) {
+  803b5e:	55                   	push   %rbp
+  803b5f:	48 89 e5             	mov    %rsp,%rbp
+  803b62:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b66:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b6a:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  803b71:	00 00 00 
+  803b74:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b76:	85 c0                	test   %eax,%eax
+  803b78:	78 18                	js     803b92 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803b7a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803b7e:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803b85:	00 00 00 
+  803b88:	8b 00                	mov    (%rax),%eax
+  803b8a:	39 02                	cmp    %eax,(%rdx)
+  803b8c:	0f 94 c0             	sete   %al
+  803b8f:	0f b6 c0             	movzbl %al,%eax
+}
+  803b92:	c9                   	leave
+  803b93:	c3                   	ret
+
+0000000000803b94 <opencons>:
+opencons(void) {
+  803b94:	55                   	push   %rbp
+  803b95:	48 89 e5             	mov    %rsp,%rbp
+  803b98:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803b9c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803ba0:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  803ba7:	00 00 00 
+  803baa:	ff d0                	call   *%rax
+  803bac:	85 c0                	test   %eax,%eax
+  803bae:	78 49                	js     803bf9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803bb0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bb5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bba:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803bbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bc3:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  803bca:	00 00 00 
+  803bcd:	ff d0                	call   *%rax
+  803bcf:	85 c0                	test   %eax,%eax
+  803bd1:	78 26                	js     803bf9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803bd3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803bd7:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803bde:	00 00 
+  803be0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803be2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803be6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803bed:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  803bf4:	00 00 00 
+  803bf7:	ff d0                	call   *%rax
+}
+  803bf9:	c9                   	leave
+  803bfa:	c3                   	ret
+
+0000000000803bfb <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803bfb:	55                   	push   %rbp
+  803bfc:	48 89 e5             	mov    %rsp,%rbp
+  803bff:	41 56                	push   %r14
+  803c01:	41 55                	push   %r13
+  803c03:	41 54                	push   %r12
+  803c05:	53                   	push   %rbx
+  803c06:	48 83 ec 50          	sub    $0x50,%rsp
+  803c0a:	49 89 fc             	mov    %rdi,%r12
+  803c0d:	41 89 f5             	mov    %esi,%r13d
+  803c10:	48 89 d3             	mov    %rdx,%rbx
+  803c13:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c17:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803c1b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803c1f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803c26:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c2a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803c2e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803c32:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803c36:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803c3d:	00 00 00 
+  803c40:	4c 8b 30             	mov    (%rax),%r14
+  803c43:	48 b8 d4 0c 80 00 00 	movabs $0x800cd4,%rax
+  803c4a:	00 00 00 
+  803c4d:	ff d0                	call   *%rax
+  803c4f:	89 c6                	mov    %eax,%esi
+  803c51:	45 89 e8             	mov    %r13d,%r8d
+  803c54:	4c 89 e1             	mov    %r12,%rcx
+  803c57:	4c 89 f2             	mov    %r14,%rdx
+  803c5a:	48 bf a0 53 80 00 00 	movabs $0x8053a0,%rdi
+  803c61:	00 00 00 
+  803c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c69:	49 bc 4b 3d 80 00 00 	movabs $0x803d4b,%r12
+  803c70:	00 00 00 
+  803c73:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803c76:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803c7a:	48 89 df             	mov    %rbx,%rdi
+  803c7d:	48 b8 e7 3c 80 00 00 	movabs $0x803ce7,%rax
+  803c84:	00 00 00 
+  803c87:	ff d0                	call   *%rax
+    cprintf("\n");
+  803c89:	48 bf ba 50 80 00 00 	movabs $0x8050ba,%rdi
+  803c90:	00 00 00 
+  803c93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c98:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803c9b:	cc                   	int3
+  803c9c:	eb fd                	jmp    803c9b <_panic+0xa0>
+
+0000000000803c9e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803c9e:	55                   	push   %rbp
+  803c9f:	48 89 e5             	mov    %rsp,%rbp
+  803ca2:	53                   	push   %rbx
+  803ca3:	48 83 ec 08          	sub    $0x8,%rsp
+  803ca7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803caa:	8b 06                	mov    (%rsi),%eax
+  803cac:	8d 50 01             	lea    0x1(%rax),%edx
+  803caf:	89 16                	mov    %edx,(%rsi)
+  803cb1:	48 98                	cltq
+  803cb3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803cb8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803cbe:	74 0a                	je     803cca <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803cc0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803cc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803cc8:	c9                   	leave
+  803cc9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803cca:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803cce:	be ff 00 00 00       	mov    $0xff,%esi
+  803cd3:	48 b8 0b 0c 80 00 00 	movabs $0x800c0b,%rax
+  803cda:	00 00 00 
+  803cdd:	ff d0                	call   *%rax
+        state->offset = 0;
+  803cdf:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803ce5:	eb d9                	jmp    803cc0 <putch+0x22>
+
+0000000000803ce7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803ce7:	55                   	push   %rbp
+  803ce8:	48 89 e5             	mov    %rsp,%rbp
+  803ceb:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803cf2:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803cf5:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803cfc:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d06:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803d09:	48 89 f1             	mov    %rsi,%rcx
+  803d0c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803d13:	48 bf 9e 3c 80 00 00 	movabs $0x803c9e,%rdi
+  803d1a:	00 00 00 
+  803d1d:	48 b8 9b 3e 80 00 00 	movabs $0x803e9b,%rax
+  803d24:	00 00 00 
+  803d27:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803d29:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803d30:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803d37:	48 b8 0b 0c 80 00 00 	movabs $0x800c0b,%rax
+  803d3e:	00 00 00 
+  803d41:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  803d43:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  803d49:	c9                   	leave
+  803d4a:	c3                   	ret
+
+0000000000803d4b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803d4b:	55                   	push   %rbp
+  803d4c:	48 89 e5             	mov    %rsp,%rbp
+  803d4f:	48 83 ec 50          	sub    $0x50,%rsp
+  803d53:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803d57:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803d5b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d5f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d63:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803d67:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803d6e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d76:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d7a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  803d7e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  803d82:	48 b8 e7 3c 80 00 00 	movabs $0x803ce7,%rax
+  803d89:	00 00 00 
+  803d8c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  803d8e:	c9                   	leave
+  803d8f:	c3                   	ret
+
+0000000000803d90 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  803d90:	55                   	push   %rbp
+  803d91:	48 89 e5             	mov    %rsp,%rbp
+  803d94:	41 57                	push   %r15
+  803d96:	41 56                	push   %r14
+  803d98:	41 55                	push   %r13
+  803d9a:	41 54                	push   %r12
+  803d9c:	53                   	push   %rbx
+  803d9d:	48 83 ec 18          	sub    $0x18,%rsp
+  803da1:	49 89 fc             	mov    %rdi,%r12
+  803da4:	49 89 f5             	mov    %rsi,%r13
+  803da7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803dab:	8b 45 10             	mov    0x10(%rbp),%eax
+  803dae:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803db1:	41 89 cf             	mov    %ecx,%r15d
+  803db4:	4c 39 fa             	cmp    %r15,%rdx
+  803db7:	73 5b                	jae    803e14 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803db9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803dbd:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803dc1:	85 db                	test   %ebx,%ebx
+  803dc3:	7e 0e                	jle    803dd3 <print_num+0x43>
+            putch(padc, put_arg);
+  803dc5:	4c 89 ee             	mov    %r13,%rsi
+  803dc8:	44 89 f7             	mov    %r14d,%edi
+  803dcb:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803dce:	83 eb 01             	sub    $0x1,%ebx
+  803dd1:	75 f2                	jne    803dc5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803dd3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803dd7:	48 b9 d4 53 80 00 00 	movabs $0x8053d4,%rcx
+  803dde:	00 00 00 
+  803de1:	48 b8 c3 53 80 00 00 	movabs $0x8053c3,%rax
+  803de8:	00 00 00 
+  803deb:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803def:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803df3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803df8:	49 f7 f7             	div    %r15
+  803dfb:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803dff:	4c 89 ee             	mov    %r13,%rsi
+  803e02:	41 ff d4             	call   *%r12
+}
+  803e05:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803e09:	5b                   	pop    %rbx
+  803e0a:	41 5c                	pop    %r12
+  803e0c:	41 5d                	pop    %r13
+  803e0e:	41 5e                	pop    %r14
+  803e10:	41 5f                	pop    %r15
+  803e12:	5d                   	pop    %rbp
+  803e13:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803e14:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e18:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e1d:	49 f7 f7             	div    %r15
+  803e20:	48 83 ec 08          	sub    $0x8,%rsp
+  803e24:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803e28:	52                   	push   %rdx
+  803e29:	45 0f be c9          	movsbl %r9b,%r9d
+  803e2d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803e31:	48 89 c2             	mov    %rax,%rdx
+  803e34:	48 b8 90 3d 80 00 00 	movabs $0x803d90,%rax
+  803e3b:	00 00 00 
+  803e3e:	ff d0                	call   *%rax
+  803e40:	48 83 c4 10          	add    $0x10,%rsp
+  803e44:	eb 8d                	jmp    803dd3 <print_num+0x43>
+
+0000000000803e46 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803e46:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  803e4a:	48 8b 06             	mov    (%rsi),%rax
+  803e4d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  803e51:	73 0a                	jae    803e5d <sprintputch+0x17>
+        *state->start++ = ch;
+  803e53:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803e57:	48 89 16             	mov    %rdx,(%rsi)
+  803e5a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  803e5d:	c3                   	ret
+
+0000000000803e5e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803e5e:	55                   	push   %rbp
+  803e5f:	48 89 e5             	mov    %rsp,%rbp
+  803e62:	48 83 ec 50          	sub    $0x50,%rsp
+  803e66:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803e6a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803e6e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  803e72:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803e79:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803e7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e81:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803e85:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  803e89:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803e8d:	48 b8 9b 3e 80 00 00 	movabs $0x803e9b,%rax
+  803e94:	00 00 00 
+  803e97:	ff d0                	call   *%rax
+}
+  803e99:	c9                   	leave
+  803e9a:	c3                   	ret
+
+0000000000803e9b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  803e9b:	55                   	push   %rbp
+  803e9c:	48 89 e5             	mov    %rsp,%rbp
+  803e9f:	41 57                	push   %r15
+  803ea1:	41 56                	push   %r14
+  803ea3:	41 55                	push   %r13
+  803ea5:	41 54                	push   %r12
+  803ea7:	53                   	push   %rbx
+  803ea8:	48 83 ec 38          	sub    $0x38,%rsp
+  803eac:	49 89 fe             	mov    %rdi,%r14
+  803eaf:	49 89 f5             	mov    %rsi,%r13
+  803eb2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  803eb5:	48 8b 01             	mov    (%rcx),%rax
+  803eb8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803ebc:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803ec0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ec4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803ec8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803ecc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803ed0:	0f b6 3b             	movzbl (%rbx),%edi
+  803ed3:	40 80 ff 25          	cmp    $0x25,%dil
+  803ed7:	74 18                	je     803ef1 <vprintfmt+0x56>
+            if (!ch) return;
+  803ed9:	40 84 ff             	test   %dil,%dil
+  803edc:	0f 84 04 07 00 00    	je     8045e6 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  803ee2:	40 0f b6 ff          	movzbl %dil,%edi
+  803ee6:	4c 89 ee             	mov    %r13,%rsi
+  803ee9:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803eec:	4c 89 e3             	mov    %r12,%rbx
+  803eef:	eb db                	jmp    803ecc <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803ef1:	be 00 00 00 00       	mov    $0x0,%esi
+  803ef6:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803efa:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803eff:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803f05:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803f0c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803f10:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803f15:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803f1a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803f1d:	83 e8 23             	sub    $0x23,%eax
+  803f20:	3c 57                	cmp    $0x57,%al
+  803f22:	0f 87 a4 06 00 00    	ja     8045cc <vprintfmt+0x731>
+  803f28:	0f b6 c0             	movzbl %al,%eax
+  803f2b:	48 b9 60 55 80 00 00 	movabs $0x805560,%rcx
+  803f32:	00 00 00 
+  803f35:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803f38:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803f3b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803f3f:	eb cf                	jmp    803f10 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  803f41:	49 89 dc             	mov    %rbx,%r12
+  803f44:	be 01 00 00 00       	mov    $0x1,%esi
+  803f49:	eb c5                	jmp    803f10 <vprintfmt+0x75>
+            padc = ch;
+  803f4b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  803f4f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803f52:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803f55:	eb b9                	jmp    803f10 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803f57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f5a:	83 f8 2f             	cmp    $0x2f,%eax
+  803f5d:	77 24                	ja     803f83 <vprintfmt+0xe8>
+  803f5f:	89 c1                	mov    %eax,%ecx
+  803f61:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  803f65:	83 c0 08             	add    $0x8,%eax
+  803f68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803f6b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  803f6e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  803f71:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803f75:	79 99                	jns    803f10 <vprintfmt+0x75>
+                width = precision;
+  803f77:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  803f7b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803f81:	eb 8d                	jmp    803f10 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803f83:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f87:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  803f8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f8f:	eb da                	jmp    803f6b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  803f91:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  803f96:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803f9a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  803fa0:	3c 39                	cmp    $0x39,%al
+  803fa2:	77 1c                	ja     803fc0 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  803fa4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  803fa8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803fac:	0f b6 c0             	movzbl %al,%eax
+  803faf:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803fb4:	0f b6 03             	movzbl (%rbx),%eax
+  803fb7:	3c 39                	cmp    $0x39,%al
+  803fb9:	76 e9                	jbe    803fa4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803fbb:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803fbe:	eb b1                	jmp    803f71 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803fc0:	49 89 dc             	mov    %rbx,%r12
+  803fc3:	eb ac                	jmp    803f71 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803fc5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803fc8:	85 c9                	test   %ecx,%ecx
+  803fca:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fcf:	0f 49 c1             	cmovns %ecx,%eax
+  803fd2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803fd5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803fd8:	e9 33 ff ff ff       	jmp    803f10 <vprintfmt+0x75>
+            lflag++;
+  803fdd:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803fe0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803fe3:	e9 28 ff ff ff       	jmp    803f10 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803fe8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803feb:	83 f8 2f             	cmp    $0x2f,%eax
+  803fee:	77 19                	ja     804009 <vprintfmt+0x16e>
+  803ff0:	89 c2                	mov    %eax,%edx
+  803ff2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ff6:	83 c0 08             	add    $0x8,%eax
+  803ff9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ffc:	8b 3a                	mov    (%rdx),%edi
+  803ffe:	4c 89 ee             	mov    %r13,%rsi
+  804001:	41 ff d6             	call   *%r14
+            break;
+  804004:	e9 c3 fe ff ff       	jmp    803ecc <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  804009:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80400d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804011:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804015:	eb e5                	jmp    803ffc <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  804017:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80401a:	83 f8 2f             	cmp    $0x2f,%eax
+  80401d:	77 5a                	ja     804079 <vprintfmt+0x1de>
+  80401f:	89 c2                	mov    %eax,%edx
+  804021:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804025:	83 c0 08             	add    $0x8,%eax
+  804028:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80402b:	8b 02                	mov    (%rdx),%eax
+  80402d:	89 c1                	mov    %eax,%ecx
+  80402f:	f7 d9                	neg    %ecx
+  804031:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  804034:	83 f9 13             	cmp    $0x13,%ecx
+  804037:	7f 4e                	jg     804087 <vprintfmt+0x1ec>
+  804039:	48 63 c1             	movslq %ecx,%rax
+  80403c:	48 ba 20 58 80 00 00 	movabs $0x805820,%rdx
+  804043:	00 00 00 
+  804046:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80404a:	48 85 c0             	test   %rax,%rax
+  80404d:	74 38                	je     804087 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80404f:	48 89 c1             	mov    %rax,%rcx
+  804052:	48 ba 59 53 80 00 00 	movabs $0x805359,%rdx
+  804059:	00 00 00 
+  80405c:	4c 89 ee             	mov    %r13,%rsi
+  80405f:	4c 89 f7             	mov    %r14,%rdi
+  804062:	b8 00 00 00 00       	mov    $0x0,%eax
+  804067:	49 b8 5e 3e 80 00 00 	movabs $0x803e5e,%r8
+  80406e:	00 00 00 
+  804071:	41 ff d0             	call   *%r8
+  804074:	e9 53 fe ff ff       	jmp    803ecc <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  804079:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80407d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804081:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804085:	eb a4                	jmp    80402b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  804087:	48 ba ec 53 80 00 00 	movabs $0x8053ec,%rdx
+  80408e:	00 00 00 
+  804091:	4c 89 ee             	mov    %r13,%rsi
+  804094:	4c 89 f7             	mov    %r14,%rdi
+  804097:	b8 00 00 00 00       	mov    $0x0,%eax
+  80409c:	49 b8 5e 3e 80 00 00 	movabs $0x803e5e,%r8
+  8040a3:	00 00 00 
+  8040a6:	41 ff d0             	call   *%r8
+  8040a9:	e9 1e fe ff ff       	jmp    803ecc <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8040ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8040b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8040b4:	77 36                	ja     8040ec <vprintfmt+0x251>
+  8040b6:	89 c2                	mov    %eax,%edx
+  8040b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8040bc:	83 c0 08             	add    $0x8,%eax
+  8040bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8040c2:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8040c5:	48 85 f6             	test   %rsi,%rsi
+  8040c8:	48 b8 e5 53 80 00 00 	movabs $0x8053e5,%rax
+  8040cf:	00 00 00 
+  8040d2:	48 0f 45 c6          	cmovne %rsi,%rax
+  8040d6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8040da:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8040de:	7e 06                	jle    8040e6 <vprintfmt+0x24b>
+  8040e0:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8040e4:	75 14                	jne    8040fa <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8040e6:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8040ea:	eb 5b                	jmp    804147 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8040ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8040f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8040f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8040f8:	eb c8                	jmp    8040c2 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8040fa:	49 63 f7             	movslq %r15d,%rsi
+  8040fd:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  804101:	48 b8 11 06 80 00 00 	movabs $0x800611,%rax
+  804108:	00 00 00 
+  80410b:	ff d0                	call   *%rax
+  80410d:	48 89 c2             	mov    %rax,%rdx
+  804110:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  804113:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  804115:	8d 70 ff             	lea    -0x1(%rax),%esi
+  804118:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80411b:	85 c0                	test   %eax,%eax
+  80411d:	7e c7                	jle    8040e6 <vprintfmt+0x24b>
+  80411f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  804124:	4c 89 ee             	mov    %r13,%rsi
+  804127:	44 89 e7             	mov    %r12d,%edi
+  80412a:	41 ff d6             	call   *%r14
+  80412d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  804131:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  804134:	83 f8 ff             	cmp    $0xffffffff,%eax
+  804137:	75 eb                	jne    804124 <vprintfmt+0x289>
+  804139:	eb ab                	jmp    8040e6 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80413b:	0f b6 f8             	movzbl %al,%edi
+  80413e:	4c 89 ee             	mov    %r13,%rsi
+  804141:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  804144:	4c 89 e2             	mov    %r12,%rdx
+  804147:	45 85 ff             	test   %r15d,%r15d
+  80414a:	78 06                	js     804152 <vprintfmt+0x2b7>
+  80414c:	41 83 ef 01          	sub    $0x1,%r15d
+  804150:	78 23                	js     804175 <vprintfmt+0x2da>
+  804152:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  804156:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80415c:	84 c0                	test   %al,%al
+  80415e:	74 15                	je     804175 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  804160:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  804164:	74 d5                	je     80413b <vprintfmt+0x2a0>
+  804166:	8d 50 e0             	lea    -0x20(%rax),%edx
+  804169:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80416e:	80 fa 5e             	cmp    $0x5e,%dl
+  804171:	77 cb                	ja     80413e <vprintfmt+0x2a3>
+  804173:	eb c6                	jmp    80413b <vprintfmt+0x2a0>
+  804175:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  804178:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  80417b:	01 f0                	add    %esi,%eax
+  80417d:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80417f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  804183:	85 c0                	test   %eax,%eax
+  804185:	0f 8e 41 fd ff ff    	jle    803ecc <vprintfmt+0x31>
+  80418b:	4c 89 ee             	mov    %r13,%rsi
+  80418e:	bf 20 00 00 00       	mov    $0x20,%edi
+  804193:	41 ff d6             	call   *%r14
+  804196:	41 83 ec 01          	sub    $0x1,%r12d
+  80419a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80419e:	75 eb                	jne    80418b <vprintfmt+0x2f0>
+  8041a0:	e9 27 fd ff ff       	jmp    803ecc <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8041a5:	40 84 f6             	test   %sil,%sil
+  8041a8:	75 26                	jne    8041d0 <vprintfmt+0x335>
+    switch (lflag) {
+  8041aa:	85 d2                	test   %edx,%edx
+  8041ac:	74 59                	je     804207 <vprintfmt+0x36c>
+  8041ae:	83 fa 01             	cmp    $0x1,%edx
+  8041b1:	74 7b                	je     80422e <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8041b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8041b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8041b9:	0f 87 96 00 00 00    	ja     804255 <vprintfmt+0x3ba>
+  8041bf:	89 c2                	mov    %eax,%edx
+  8041c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8041c5:	83 c0 08             	add    $0x8,%eax
+  8041c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8041cb:	4c 8b 22             	mov    (%rdx),%r12
+  8041ce:	eb 17                	jmp    8041e7 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8041d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8041d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8041d6:	77 21                	ja     8041f9 <vprintfmt+0x35e>
+  8041d8:	89 c2                	mov    %eax,%edx
+  8041da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8041de:	83 c0 08             	add    $0x8,%eax
+  8041e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8041e4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8041e7:	4d 85 e4             	test   %r12,%r12
+  8041ea:	78 7a                	js     804266 <vprintfmt+0x3cb>
+            num = i;
+  8041ec:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8041ef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8041f4:	e9 b5 02 00 00       	jmp    8044ae <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8041f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8041fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804201:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804205:	eb dd                	jmp    8041e4 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  804207:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80420a:	83 f8 2f             	cmp    $0x2f,%eax
+  80420d:	77 11                	ja     804220 <vprintfmt+0x385>
+  80420f:	89 c2                	mov    %eax,%edx
+  804211:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804215:	83 c0 08             	add    $0x8,%eax
+  804218:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80421b:	4c 63 22             	movslq (%rdx),%r12
+  80421e:	eb c7                	jmp    8041e7 <vprintfmt+0x34c>
+  804220:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804224:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804228:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80422c:	eb ed                	jmp    80421b <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  80422e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804231:	83 f8 2f             	cmp    $0x2f,%eax
+  804234:	77 11                	ja     804247 <vprintfmt+0x3ac>
+  804236:	89 c2                	mov    %eax,%edx
+  804238:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80423c:	83 c0 08             	add    $0x8,%eax
+  80423f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804242:	4c 8b 22             	mov    (%rdx),%r12
+  804245:	eb a0                	jmp    8041e7 <vprintfmt+0x34c>
+  804247:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80424b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80424f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804253:	eb ed                	jmp    804242 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  804255:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804259:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80425d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804261:	e9 65 ff ff ff       	jmp    8041cb <vprintfmt+0x330>
+                putch('-', put_arg);
+  804266:	4c 89 ee             	mov    %r13,%rsi
+  804269:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80426e:	41 ff d6             	call   *%r14
+                i = -i;
+  804271:	49 f7 dc             	neg    %r12
+  804274:	e9 73 ff ff ff       	jmp    8041ec <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  804279:	40 84 f6             	test   %sil,%sil
+  80427c:	75 32                	jne    8042b0 <vprintfmt+0x415>
+    switch (lflag) {
+  80427e:	85 d2                	test   %edx,%edx
+  804280:	74 5d                	je     8042df <vprintfmt+0x444>
+  804282:	83 fa 01             	cmp    $0x1,%edx
+  804285:	0f 84 82 00 00 00    	je     80430d <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  80428b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80428e:	83 f8 2f             	cmp    $0x2f,%eax
+  804291:	0f 87 a5 00 00 00    	ja     80433c <vprintfmt+0x4a1>
+  804297:	89 c2                	mov    %eax,%edx
+  804299:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80429d:	83 c0 08             	add    $0x8,%eax
+  8042a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8042a3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8042a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8042ab:	e9 fe 01 00 00       	jmp    8044ae <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8042b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8042b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8042b6:	77 19                	ja     8042d1 <vprintfmt+0x436>
+  8042b8:	89 c2                	mov    %eax,%edx
+  8042ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8042be:	83 c0 08             	add    $0x8,%eax
+  8042c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8042c4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8042c7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8042cc:	e9 dd 01 00 00       	jmp    8044ae <vprintfmt+0x613>
+  8042d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8042d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8042d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042dd:	eb e5                	jmp    8042c4 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8042df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8042e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8042e5:	77 18                	ja     8042ff <vprintfmt+0x464>
+  8042e7:	89 c2                	mov    %eax,%edx
+  8042e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8042ed:	83 c0 08             	add    $0x8,%eax
+  8042f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8042f3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8042f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8042fa:	e9 af 01 00 00       	jmp    8044ae <vprintfmt+0x613>
+  8042ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804303:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804307:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80430b:	eb e6                	jmp    8042f3 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  80430d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804310:	83 f8 2f             	cmp    $0x2f,%eax
+  804313:	77 19                	ja     80432e <vprintfmt+0x493>
+  804315:	89 c2                	mov    %eax,%edx
+  804317:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80431b:	83 c0 08             	add    $0x8,%eax
+  80431e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804321:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  804324:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  804329:	e9 80 01 00 00       	jmp    8044ae <vprintfmt+0x613>
+  80432e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804332:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804336:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80433a:	eb e5                	jmp    804321 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80433c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804340:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804344:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804348:	e9 56 ff ff ff       	jmp    8042a3 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80434d:	40 84 f6             	test   %sil,%sil
+  804350:	75 2e                	jne    804380 <vprintfmt+0x4e5>
+    switch (lflag) {
+  804352:	85 d2                	test   %edx,%edx
+  804354:	0f 84 b3 00 00 00    	je     80440d <vprintfmt+0x572>
+  80435a:	83 fa 01             	cmp    $0x1,%edx
+  80435d:	0f 84 d3 00 00 00    	je     804436 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  804363:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804366:	83 f8 2f             	cmp    $0x2f,%eax
+  804369:	0f 87 f1 00 00 00    	ja     804460 <vprintfmt+0x5c5>
+  80436f:	89 c2                	mov    %eax,%edx
+  804371:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804375:	83 c0 08             	add    $0x8,%eax
+  804378:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80437b:	48 8b 02             	mov    (%rdx),%rax
+  80437e:	eb 17                	jmp    804397 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  804380:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804383:	83 f8 2f             	cmp    $0x2f,%eax
+  804386:	77 77                	ja     8043ff <vprintfmt+0x564>
+  804388:	89 c2                	mov    %eax,%edx
+  80438a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80438e:	83 c0 08             	add    $0x8,%eax
+  804391:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804394:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  804397:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  804399:	83 f8 07             	cmp    $0x7,%eax
+  80439c:	0f 8e cf 00 00 00    	jle    804471 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8043a2:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8043a8:	44 89 e7             	mov    %r12d,%edi
+  8043ab:	41 c1 e4 03          	shl    $0x3,%r12d
+  8043af:	89 d1                	mov    %edx,%ecx
+  8043b1:	8d 72 07             	lea    0x7(%rdx),%esi
+  8043b4:	85 d2                	test   %edx,%edx
+  8043b6:	0f 48 d6             	cmovs  %esi,%edx
+  8043b9:	c1 fa 03             	sar    $0x3,%edx
+  8043bc:	83 f9 3f             	cmp    $0x3f,%ecx
+  8043bf:	7f e7                	jg     8043a8 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8043c1:	85 ff                	test   %edi,%edi
+  8043c3:	0f 84 03 fb ff ff    	je     803ecc <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8043c9:	49 63 f4             	movslq %r12d,%rsi
+  8043cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043d1:	48 f7 f6             	div    %rsi
+  8043d4:	49 89 d7             	mov    %rdx,%r15
+  8043d7:	83 c0 30             	add    $0x30,%eax
+  8043da:	0f be f8             	movsbl %al,%edi
+  8043dd:	4c 89 ee             	mov    %r13,%rsi
+  8043e0:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  8043e3:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  8043e6:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  8043eb:	45 85 e4             	test   %r12d,%r12d
+  8043ee:	41 0f 49 d4          	cmovns %r12d,%edx
+  8043f2:	c1 fa 03             	sar    $0x3,%edx
+  8043f5:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  8043f8:	75 cf                	jne    8043c9 <vprintfmt+0x52e>
+  8043fa:	e9 cd fa ff ff       	jmp    803ecc <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8043ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804403:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804407:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80440b:	eb 87                	jmp    804394 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  80440d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804410:	83 f8 2f             	cmp    $0x2f,%eax
+  804413:	77 13                	ja     804428 <vprintfmt+0x58d>
+  804415:	89 c2                	mov    %eax,%edx
+  804417:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80441b:	83 c0 08             	add    $0x8,%eax
+  80441e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804421:	8b 02                	mov    (%rdx),%eax
+  804423:	e9 6f ff ff ff       	jmp    804397 <vprintfmt+0x4fc>
+  804428:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80442c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804430:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804434:	eb eb                	jmp    804421 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  804436:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804439:	83 f8 2f             	cmp    $0x2f,%eax
+  80443c:	77 14                	ja     804452 <vprintfmt+0x5b7>
+  80443e:	89 c2                	mov    %eax,%edx
+  804440:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804444:	83 c0 08             	add    $0x8,%eax
+  804447:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80444a:	48 8b 02             	mov    (%rdx),%rax
+  80444d:	e9 45 ff ff ff       	jmp    804397 <vprintfmt+0x4fc>
+  804452:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804456:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80445a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80445e:	eb ea                	jmp    80444a <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  804460:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804464:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804468:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80446c:	e9 0a ff ff ff       	jmp    80437b <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  804471:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  804477:	e9 4d ff ff ff       	jmp    8043c9 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  80447c:	4c 89 ee             	mov    %r13,%rsi
+  80447f:	bf 30 00 00 00       	mov    $0x30,%edi
+  804484:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  804487:	4c 89 ee             	mov    %r13,%rsi
+  80448a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80448f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  804492:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804495:	83 f8 2f             	cmp    $0x2f,%eax
+  804498:	77 47                	ja     8044e1 <vprintfmt+0x646>
+  80449a:	89 c2                	mov    %eax,%edx
+  80449c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8044a0:	83 c0 08             	add    $0x8,%eax
+  8044a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8044a6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8044a9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8044ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8044b2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8044b6:	0f 94 c0             	sete   %al
+  8044b9:	0f b6 c0             	movzbl %al,%eax
+  8044bc:	50                   	push   %rax
+  8044bd:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8044c2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8044c6:	4c 89 ee             	mov    %r13,%rsi
+  8044c9:	4c 89 f7             	mov    %r14,%rdi
+  8044cc:	48 b8 90 3d 80 00 00 	movabs $0x803d90,%rax
+  8044d3:	00 00 00 
+  8044d6:	ff d0                	call   *%rax
+            break;
+  8044d8:	48 83 c4 10          	add    $0x10,%rsp
+  8044dc:	e9 eb f9 ff ff       	jmp    803ecc <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8044e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8044e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8044e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8044ed:	eb b7                	jmp    8044a6 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  8044ef:	40 84 f6             	test   %sil,%sil
+  8044f2:	75 2b                	jne    80451f <vprintfmt+0x684>
+    switch (lflag) {
+  8044f4:	85 d2                	test   %edx,%edx
+  8044f6:	74 56                	je     80454e <vprintfmt+0x6b3>
+  8044f8:	83 fa 01             	cmp    $0x1,%edx
+  8044fb:	74 7f                	je     80457c <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  8044fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804500:	83 f8 2f             	cmp    $0x2f,%eax
+  804503:	0f 87 a2 00 00 00    	ja     8045ab <vprintfmt+0x710>
+  804509:	89 c2                	mov    %eax,%edx
+  80450b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80450f:	83 c0 08             	add    $0x8,%eax
+  804512:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804515:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  804518:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80451d:	eb 8f                	jmp    8044ae <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  80451f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804522:	83 f8 2f             	cmp    $0x2f,%eax
+  804525:	77 19                	ja     804540 <vprintfmt+0x6a5>
+  804527:	89 c2                	mov    %eax,%edx
+  804529:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80452d:	83 c0 08             	add    $0x8,%eax
+  804530:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804533:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  804536:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80453b:	e9 6e ff ff ff       	jmp    8044ae <vprintfmt+0x613>
+  804540:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804544:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804548:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80454c:	eb e5                	jmp    804533 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  80454e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804551:	83 f8 2f             	cmp    $0x2f,%eax
+  804554:	77 18                	ja     80456e <vprintfmt+0x6d3>
+  804556:	89 c2                	mov    %eax,%edx
+  804558:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80455c:	83 c0 08             	add    $0x8,%eax
+  80455f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804562:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  804564:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  804569:	e9 40 ff ff ff       	jmp    8044ae <vprintfmt+0x613>
+  80456e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804572:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804576:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80457a:	eb e6                	jmp    804562 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  80457c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80457f:	83 f8 2f             	cmp    $0x2f,%eax
+  804582:	77 19                	ja     80459d <vprintfmt+0x702>
+  804584:	89 c2                	mov    %eax,%edx
+  804586:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80458a:	83 c0 08             	add    $0x8,%eax
+  80458d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804590:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  804593:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  804598:	e9 11 ff ff ff       	jmp    8044ae <vprintfmt+0x613>
+  80459d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8045a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8045a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8045a9:	eb e5                	jmp    804590 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  8045ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8045af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8045b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8045b7:	e9 59 ff ff ff       	jmp    804515 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8045bc:	4c 89 ee             	mov    %r13,%rsi
+  8045bf:	bf 25 00 00 00       	mov    $0x25,%edi
+  8045c4:	41 ff d6             	call   *%r14
+            break;
+  8045c7:	e9 00 f9 ff ff       	jmp    803ecc <vprintfmt+0x31>
+            putch('%', put_arg);
+  8045cc:	4c 89 ee             	mov    %r13,%rsi
+  8045cf:	bf 25 00 00 00       	mov    $0x25,%edi
+  8045d4:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8045d7:	48 83 eb 01          	sub    $0x1,%rbx
+  8045db:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8045df:	75 f6                	jne    8045d7 <vprintfmt+0x73c>
+  8045e1:	e9 e6 f8 ff ff       	jmp    803ecc <vprintfmt+0x31>
+}
+  8045e6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8045ea:	5b                   	pop    %rbx
+  8045eb:	41 5c                	pop    %r12
+  8045ed:	41 5d                	pop    %r13
+  8045ef:	41 5e                	pop    %r14
+  8045f1:	41 5f                	pop    %r15
+  8045f3:	5d                   	pop    %rbp
+  8045f4:	c3                   	ret
+
+00000000008045f5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8045f5:	55                   	push   %rbp
+  8045f6:	48 89 e5             	mov    %rsp,%rbp
+  8045f9:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8045fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804601:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  804606:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80460a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  804611:	48 85 ff             	test   %rdi,%rdi
+  804614:	74 2b                	je     804641 <vsnprintf+0x4c>
+  804616:	48 85 f6             	test   %rsi,%rsi
+  804619:	74 26                	je     804641 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80461b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80461f:	48 bf 46 3e 80 00 00 	movabs $0x803e46,%rdi
+  804626:	00 00 00 
+  804629:	48 b8 9b 3e 80 00 00 	movabs $0x803e9b,%rax
+  804630:	00 00 00 
+  804633:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  804635:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804639:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80463c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80463f:	c9                   	leave
+  804640:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  804641:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804646:	eb f7                	jmp    80463f <vsnprintf+0x4a>
+
+0000000000804648 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  804648:	55                   	push   %rbp
+  804649:	48 89 e5             	mov    %rsp,%rbp
+  80464c:	48 83 ec 50          	sub    $0x50,%rsp
+  804650:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804654:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804658:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80465c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  804663:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804667:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80466b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80466f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  804673:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  804677:	48 b8 f5 45 80 00 00 	movabs $0x8045f5,%rax
+  80467e:	00 00 00 
+  804681:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  804683:	c9                   	leave
+  804684:	c3                   	ret
+
+0000000000804685 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804685:	55                   	push   %rbp
+  804686:	48 89 e5             	mov    %rsp,%rbp
+  804689:	41 55                	push   %r13
+  80468b:	41 54                	push   %r12
+  80468d:	53                   	push   %rbx
+  80468e:	48 83 ec 08          	sub    $0x8,%rsp
+  804692:	49 89 fc             	mov    %rdi,%r12
+  804695:	48 89 f7             	mov    %rsi,%rdi
+  804698:	48 89 d3             	mov    %rdx,%rbx
+  80469b:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80469e:	48 85 f6             	test   %rsi,%rsi
+  8046a1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046a8:	00 00 00 
+  8046ab:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8046af:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046b4:	48 85 d2             	test   %rdx,%rdx
+  8046b7:	74 03                	je     8046bc <ipc_recv+0x37>
+  8046b9:	48 8b 32             	mov    (%rdx),%rsi
+  8046bc:	48 b8 41 11 80 00 00 	movabs $0x801141,%rax
+  8046c3:	00 00 00 
+  8046c6:	ff d0                	call   *%rax
+    if (errno) {
+  8046c8:	85 c0                	test   %eax,%eax
+  8046ca:	74 1c                	je     8046e8 <ipc_recv+0x63>
+        if (from_env_store)
+  8046cc:	4d 85 e4             	test   %r12,%r12
+  8046cf:	74 08                	je     8046d9 <ipc_recv+0x54>
+            *from_env_store = 0;
+  8046d1:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8046d8:	00 
+
+        if (perm_store)
+  8046d9:	4d 85 ed             	test   %r13,%r13
+  8046dc:	74 74                	je     804752 <ipc_recv+0xcd>
+            *perm_store = 0;
+  8046de:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8046e5:	00 
+  8046e6:	eb 6a                	jmp    804752 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8046e8:	4d 85 e4             	test   %r12,%r12
+  8046eb:	74 14                	je     804701 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8046ed:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8046f4:	00 00 00 
+  8046f7:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8046fd:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804701:	48 85 db             	test   %rbx,%rbx
+  804704:	74 23                	je     804729 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804706:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80470d:	00 00 00 
+  804710:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804716:	ba 00 00 00 00       	mov    $0x0,%edx
+  80471b:	85 c9                	test   %ecx,%ecx
+  80471d:	74 07                	je     804726 <ipc_recv+0xa1>
+  80471f:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804726:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804729:	4d 85 ed             	test   %r13,%r13
+  80472c:	74 14                	je     804742 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80472e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804735:	00 00 00 
+  804738:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80473e:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804742:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804749:	00 00 00 
+  80474c:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804752:	48 83 c4 08          	add    $0x8,%rsp
+  804756:	5b                   	pop    %rbx
+  804757:	41 5c                	pop    %r12
+  804759:	41 5d                	pop    %r13
+  80475b:	5d                   	pop    %rbp
+  80475c:	c3                   	ret
+
+000000000080475d <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80475d:	55                   	push   %rbp
+  80475e:	48 89 e5             	mov    %rsp,%rbp
+  804761:	41 55                	push   %r13
+  804763:	41 54                	push   %r12
+  804765:	53                   	push   %rbx
+  804766:	48 83 ec 08          	sub    $0x8,%rsp
+  80476a:	49 89 fc             	mov    %rdi,%r12
+  80476d:	48 89 f7             	mov    %rsi,%rdi
+  804770:	48 89 d3             	mov    %rdx,%rbx
+  804773:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804776:	48 85 f6             	test   %rsi,%rsi
+  804779:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804780:	00 00 00 
+  804783:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804787:	be 00 10 00 00       	mov    $0x1000,%esi
+  80478c:	48 85 d2             	test   %rdx,%rdx
+  80478f:	74 03                	je     804794 <ipc_try_recv+0x37>
+  804791:	48 8b 32             	mov    (%rdx),%rsi
+  804794:	48 b8 aa 11 80 00 00 	movabs $0x8011aa,%rax
+  80479b:	00 00 00 
+  80479e:	ff d0                	call   *%rax
+    if (errno) {
+  8047a0:	85 c0                	test   %eax,%eax
+  8047a2:	75 75                	jne    804819 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8047a4:	4d 85 e4             	test   %r12,%r12
+  8047a7:	74 14                	je     8047bd <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8047a9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8047b0:	00 00 00 
+  8047b3:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8047b9:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8047bd:	48 85 db             	test   %rbx,%rbx
+  8047c0:	74 23                	je     8047e5 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8047c2:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8047c9:	00 00 00 
+  8047cc:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8047d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047d7:	85 c9                	test   %ecx,%ecx
+  8047d9:	74 07                	je     8047e2 <ipc_try_recv+0x85>
+  8047db:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8047e2:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8047e5:	4d 85 ed             	test   %r13,%r13
+  8047e8:	74 14                	je     8047fe <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8047ea:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8047f1:	00 00 00 
+  8047f4:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8047fa:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8047fe:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804805:	00 00 00 
+  804808:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80480e:	48 83 c4 08          	add    $0x8,%rsp
+  804812:	5b                   	pop    %rbx
+  804813:	41 5c                	pop    %r12
+  804815:	41 5d                	pop    %r13
+  804817:	5d                   	pop    %rbp
+  804818:	c3                   	ret
+        if (from_env_store)
+  804819:	4d 85 e4             	test   %r12,%r12
+  80481c:	74 08                	je     804826 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80481e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804825:	00 
+        if (perm_store)
+  804826:	4d 85 ed             	test   %r13,%r13
+  804829:	74 e3                	je     80480e <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80482b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804832:	00 
+  804833:	eb d9                	jmp    80480e <ipc_try_recv+0xb1>
+
+0000000000804835 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804835:	55                   	push   %rbp
+  804836:	48 89 e5             	mov    %rsp,%rbp
+  804839:	41 57                	push   %r15
+  80483b:	41 56                	push   %r14
+  80483d:	41 55                	push   %r13
+  80483f:	41 54                	push   %r12
+  804841:	53                   	push   %rbx
+  804842:	48 83 ec 18          	sub    $0x18,%rsp
+  804846:	41 89 fd             	mov    %edi,%r13d
+  804849:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80484c:	48 89 d3             	mov    %rdx,%rbx
+  80484f:	49 89 cc             	mov    %rcx,%r12
+  804852:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804856:	48 85 d2             	test   %rdx,%rdx
+  804859:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804860:	00 00 00 
+  804863:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804867:	49 be 15 11 80 00 00 	movabs $0x801115,%r14
+  80486e:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804871:	49 bf 05 0d 80 00 00 	movabs $0x800d05,%r15
+  804878:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80487b:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80487e:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804882:	4c 89 e1             	mov    %r12,%rcx
+  804885:	48 89 da             	mov    %rbx,%rdx
+  804888:	44 89 ef             	mov    %r13d,%edi
+  80488b:	41 ff d6             	call   *%r14
+  80488e:	85 c0                	test   %eax,%eax
+  804890:	74 37                	je     8048c9 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804892:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804895:	75 05                	jne    80489c <ipc_send+0x67>
+        sys_yield();
+  804897:	41 ff d7             	call   *%r15
+  80489a:	eb df                	jmp    80487b <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80489c:	89 c1                	mov    %eax,%ecx
+  80489e:	48 ba df 58 80 00 00 	movabs $0x8058df,%rdx
+  8048a5:	00 00 00 
+  8048a8:	be 65 00 00 00       	mov    $0x65,%esi
+  8048ad:	48 bf fa 58 80 00 00 	movabs $0x8058fa,%rdi
+  8048b4:	00 00 00 
+  8048b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048bc:	49 b8 fb 3b 80 00 00 	movabs $0x803bfb,%r8
+  8048c3:	00 00 00 
+  8048c6:	41 ff d0             	call   *%r8
+    }
+}
+  8048c9:	48 83 c4 18          	add    $0x18,%rsp
+  8048cd:	5b                   	pop    %rbx
+  8048ce:	41 5c                	pop    %r12
+  8048d0:	41 5d                	pop    %r13
+  8048d2:	41 5e                	pop    %r14
+  8048d4:	41 5f                	pop    %r15
+  8048d6:	5d                   	pop    %rbp
+  8048d7:	c3                   	ret
+
+00000000008048d8 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8048d8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8048dd:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8048e4:	00 00 00 
+  8048e7:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8048ee:	48 01 ca             	add    %rcx,%rdx
+  8048f1:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8048f7:	39 fa                	cmp    %edi,%edx
+  8048f9:	74 12                	je     80490d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8048fb:	48 83 c0 01          	add    $0x1,%rax
+  8048ff:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804905:	75 e0                	jne    8048e7 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804907:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80490c:	c3                   	ret
+            return envs[i].env_id;
+  80490d:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804914:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80491b:	00 00 00 
+  80491e:	48 01 d0             	add    %rdx,%rax
+  804921:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804927:	c3                   	ret
+
+0000000000804928 <__text_end>:
+  804928:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492f:	00 00 00 
+  804932:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804939:	00 00 00 
+  80493c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804943:	00 00 00 
+  804946:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494d:	00 00 00 
+  804950:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804957:	00 00 00 
+  80495a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804961:	00 00 00 
+  804964:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496b:	00 00 00 
+  80496e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804975:	00 00 00 
+  804978:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497f:	00 00 00 
+  804982:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804989:	00 00 00 
+  80498c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804993:	00 00 00 
+  804996:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499d:	00 00 00 
+  8049a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a7:	00 00 00 
+  8049aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b1:	00 00 00 
+  8049b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bb:	00 00 00 
+  8049be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c5:	00 00 00 
+  8049c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cf:	00 00 00 
+  8049d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d9:	00 00 00 
+  8049dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e3:	00 00 00 
+  8049e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ed:	00 00 00 
+  8049f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f7:	00 00 00 
+  8049fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a01:	00 00 00 
+  804a04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0b:	00 00 00 
+  804a0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a15:	00 00 00 
+  804a18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1f:	00 00 00 
+  804a22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a29:	00 00 00 
+  804a2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a33:	00 00 00 
+  804a36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3d:	00 00 00 
+  804a40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a47:	00 00 00 
+  804a4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a51:	00 00 00 
+  804a54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5b:	00 00 00 
+  804a5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a65:	00 00 00 
+  804a68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6f:	00 00 00 
+  804a72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a79:	00 00 00 
+  804a7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a83:	00 00 00 
+  804a86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8d:	00 00 00 
+  804a90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a97:	00 00 00 
+  804a9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa1:	00 00 00 
+  804aa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aab:	00 00 00 
+  804aae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab5:	00 00 00 
+  804ab8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abf:	00 00 00 
+  804ac2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac9:	00 00 00 
+  804acc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad3:	00 00 00 
+  804ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804add:	00 00 00 
+  804ae0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae7:	00 00 00 
+  804aea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af1:	00 00 00 
+  804af4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afb:	00 00 00 
+  804afe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b05:	00 00 00 
+  804b08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0f:	00 00 00 
+  804b12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b19:	00 00 00 
+  804b1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b23:	00 00 00 
+  804b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2d:	00 00 00 
+  804b30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b37:	00 00 00 
+  804b3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b41:	00 00 00 
+  804b44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4b:	00 00 00 
+  804b4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b55:	00 00 00 
+  804b58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5f:	00 00 00 
+  804b62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b69:	00 00 00 
+  804b6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b73:	00 00 00 
+  804b76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7d:	00 00 00 
+  804b80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b87:	00 00 00 
+  804b8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b91:	00 00 00 
+  804b94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9b:	00 00 00 
+  804b9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba5:	00 00 00 
+  804ba8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804baf:	00 00 00 
+  804bb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb9:	00 00 00 
+  804bbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc3:	00 00 00 
+  804bc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcd:	00 00 00 
+  804bd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd7:	00 00 00 
+  804bda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be1:	00 00 00 
+  804be4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804beb:	00 00 00 
+  804bee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf5:	00 00 00 
+  804bf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bff:	00 00 00 
+  804c02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c09:	00 00 00 
+  804c0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c13:	00 00 00 
+  804c16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1d:	00 00 00 
+  804c20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c27:	00 00 00 
+  804c2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c31:	00 00 00 
+  804c34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3b:	00 00 00 
+  804c3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c45:	00 00 00 
+  804c48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4f:	00 00 00 
+  804c52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c59:	00 00 00 
+  804c5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c63:	00 00 00 
+  804c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6d:	00 00 00 
+  804c70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c77:	00 00 00 
+  804c7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c81:	00 00 00 
+  804c84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8b:	00 00 00 
+  804c8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c95:	00 00 00 
+  804c98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9f:	00 00 00 
+  804ca2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca9:	00 00 00 
+  804cac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb3:	00 00 00 
+  804cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbd:	00 00 00 
+  804cc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc7:	00 00 00 
+  804cca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd1:	00 00 00 
+  804cd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdb:	00 00 00 
+  804cde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce5:	00 00 00 
+  804ce8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cef:	00 00 00 
+  804cf2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf9:	00 00 00 
+  804cfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d03:	00 00 00 
+  804d06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0d:	00 00 00 
+  804d10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d17:	00 00 00 
+  804d1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d21:	00 00 00 
+  804d24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2b:	00 00 00 
+  804d2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d35:	00 00 00 
+  804d38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3f:	00 00 00 
+  804d42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d49:	00 00 00 
+  804d4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d53:	00 00 00 
+  804d56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5d:	00 00 00 
+  804d60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d67:	00 00 00 
+  804d6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d71:	00 00 00 
+  804d74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7b:	00 00 00 
+  804d7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d85:	00 00 00 
+  804d88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8f:	00 00 00 
+  804d92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d99:	00 00 00 
+  804d9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da3:	00 00 00 
+  804da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dad:	00 00 00 
+  804db0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db7:	00 00 00 
+  804dba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc1:	00 00 00 
+  804dc4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcb:	00 00 00 
+  804dce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd5:	00 00 00 
+  804dd8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddf:	00 00 00 
+  804de2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de9:	00 00 00 
+  804dec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df3:	00 00 00 
+  804df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfd:	00 00 00 
+  804e00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e07:	00 00 00 
+  804e0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e11:	00 00 00 
+  804e14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1b:	00 00 00 
+  804e1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e25:	00 00 00 
+  804e28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2f:	00 00 00 
+  804e32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e39:	00 00 00 
+  804e3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e43:	00 00 00 
+  804e46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4d:	00 00 00 
+  804e50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e57:	00 00 00 
+  804e5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e61:	00 00 00 
+  804e64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6b:	00 00 00 
+  804e6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e75:	00 00 00 
+  804e78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7f:	00 00 00 
+  804e82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e89:	00 00 00 
+  804e8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e93:	00 00 00 
+  804e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9d:	00 00 00 
+  804ea0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea7:	00 00 00 
+  804eaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb1:	00 00 00 
+  804eb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebb:	00 00 00 
+  804ebe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec5:	00 00 00 
+  804ec8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecf:	00 00 00 
+  804ed2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed9:	00 00 00 
+  804edc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee3:	00 00 00 
+  804ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eed:	00 00 00 
+  804ef0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef7:	00 00 00 
+  804efa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f01:	00 00 00 
+  804f04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0b:	00 00 00 
+  804f0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f15:	00 00 00 
+  804f18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1f:	00 00 00 
+  804f22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f29:	00 00 00 
+  804f2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f33:	00 00 00 
+  804f36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3d:	00 00 00 
+  804f40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f47:	00 00 00 
+  804f4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f51:	00 00 00 
+  804f54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5b:	00 00 00 
+  804f5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f65:	00 00 00 
+  804f68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6f:	00 00 00 
+  804f72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f79:	00 00 00 
+  804f7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f83:	00 00 00 
+  804f86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8d:	00 00 00 
+  804f90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f97:	00 00 00 
+  804f9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa1:	00 00 00 
+  804fa4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fab:	00 00 00 
+  804fae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb5:	00 00 00 
+  804fb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbf:	00 00 00 
+  804fc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc9:	00 00 00 
+  804fcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd3:	00 00 00 
+  804fd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdd:	00 00 00 
+  804fe0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe7:	00 00 00 
+  804fea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff1:	00 00 00 
+  804ff4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffb:	00 00 00 
+  804ffe:	66 90                	xchg   %ax,%ax
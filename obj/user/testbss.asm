@@ -0,0 +1,8120 @@
+
+obj/user/testbss:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 35 01 00 00       	call   800158 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define ARRAYSIZE (1024 * 1024)
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int i;
+
+    cprintf("Making sure bss works right...\n");
+  800029:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba 74 03 80 00 00 	movabs $0x800374,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+  800044:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != 0)
+  800049:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800050:	00 00 00 
+  800053:	83 3c 88 00          	cmpl   $0x0,(%rax,%rcx,4)
+  800057:	0f 85 a5 00 00 00    	jne    800102 <umain+0xdd>
+    for (i = 0; i < ARRAYSIZE; i++)
+  80005d:	48 83 c1 01          	add    $0x1,%rcx
+  800061:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  800068:	75 e9                	jne    800053 <umain+0x2e>
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+            panic("bigarray[%d] isn't cleared!\n", i);
+    for (i = 0; i < ARRAYSIZE; i++)
+        bigarray[i] = i;
+  80006f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800076:	00 00 00 
+  800079:	89 04 82             	mov    %eax,(%rdx,%rax,4)
+    for (i = 0; i < ARRAYSIZE; i++)
+  80007c:	48 83 c0 01          	add    $0x1,%rax
+  800080:	48 3d 00 00 10 00    	cmp    $0x100000,%rax
+  800086:	75 f1                	jne    800079 <umain+0x54>
+  800088:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != i)
+  80008d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800094:	00 00 00 
+  800097:	39 0c 88             	cmp    %ecx,(%rax,%rcx,4)
+  80009a:	0f 85 8d 00 00 00    	jne    80012d <umain+0x108>
+    for (i = 0; i < ARRAYSIZE; i++)
+  8000a0:	48 83 c1 01          	add    $0x1,%rcx
+  8000a4:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  8000ab:	75 ea                	jne    800097 <umain+0x72>
+            panic("bigarray[%d] didn't hold its value!\n", i);
+
+    cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  8000ad:	48 bf 48 50 80 00 00 	movabs $0x805048,%rdi
+  8000b4:	00 00 00 
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bc:	48 ba 74 03 80 00 00 	movabs $0x800374,%rdx
+  8000c3:	00 00 00 
+  8000c6:	ff d2                	call   *%rdx
+
+    /* Accessing via subscript operator ([]) will result in -Warray-bounds warning. */
+    *((volatile uint32_t *)bigarray + ARRAYSIZE + 0x800000) = 0;
+  8000c8:	48 b8 00 70 c0 02 00 	movabs $0x2c07000,%rax
+  8000cf:	00 00 00 
+  8000d2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    panic("SHOULD HAVE TRAPPED!!!");
+  8000d8:	48 ba a7 50 80 00 00 	movabs $0x8050a7,%rdx
+  8000df:	00 00 00 
+  8000e2:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8000e7:	48 bf 98 50 80 00 00 	movabs $0x805098,%rdi
+  8000ee:	00 00 00 
+  8000f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f6:	48 b9 24 02 80 00 00 	movabs $0x800224,%rcx
+  8000fd:	00 00 00 
+  800100:	ff d1                	call   *%rcx
+            panic("bigarray[%d] isn't cleared!\n", i);
+  800102:	48 ba 7b 50 80 00 00 	movabs $0x80507b,%rdx
+  800109:	00 00 00 
+  80010c:	be 10 00 00 00       	mov    $0x10,%esi
+  800111:	48 bf 98 50 80 00 00 	movabs $0x805098,%rdi
+  800118:	00 00 00 
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800120:	49 b8 24 02 80 00 00 	movabs $0x800224,%r8
+  800127:	00 00 00 
+  80012a:	41 ff d0             	call   *%r8
+            panic("bigarray[%d] didn't hold its value!\n", i);
+  80012d:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  800134:	00 00 00 
+  800137:	be 15 00 00 00       	mov    $0x15,%esi
+  80013c:	48 bf 98 50 80 00 00 	movabs $0x805098,%rdi
+  800143:	00 00 00 
+  800146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014b:	49 b8 24 02 80 00 00 	movabs $0x800224,%r8
+  800152:	00 00 00 
+  800155:	41 ff d0             	call   *%r8
+
+0000000000800158 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800158:	55                   	push   %rbp
+  800159:	48 89 e5             	mov    %rsp,%rbp
+  80015c:	41 56                	push   %r14
+  80015e:	41 55                	push   %r13
+  800160:	41 54                	push   %r12
+  800162:	53                   	push   %rbx
+  800163:	41 89 fd             	mov    %edi,%r13d
+  800166:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800169:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800170:	00 00 00 
+  800173:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80017a:	00 00 00 
+  80017d:	48 39 c2             	cmp    %rax,%rdx
+  800180:	73 17                	jae    800199 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800182:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800185:	49 89 c4             	mov    %rax,%r12
+  800188:	48 83 c3 08          	add    $0x8,%rbx
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	ff 53 f8             	call   *-0x8(%rbx)
+  800194:	4c 39 e3             	cmp    %r12,%rbx
+  800197:	72 ef                	jb     800188 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800199:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  8001a0:	00 00 00 
+  8001a3:	ff d0                	call   *%rax
+  8001a5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001aa:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8001b1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001b8:	00 00 00 
+  8001bb:	48 01 d0             	add    %rdx,%rax
+  8001be:	48 a3 00 70 c0 00 00 	movabs %rax,0xc07000
+  8001c5:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001c8:	45 85 ed             	test   %r13d,%r13d
+  8001cb:	7e 0d                	jle    8001da <libmain+0x82>
+  8001cd:	49 8b 06             	mov    (%r14),%rax
+  8001d0:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001d7:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001da:	4c 89 f6             	mov    %r14,%rsi
+  8001dd:	44 89 ef             	mov    %r13d,%edi
+  8001e0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001ec:	48 b8 01 02 80 00 00 	movabs $0x800201,%rax
+  8001f3:	00 00 00 
+  8001f6:	ff d0                	call   *%rax
+#endif
+}
+  8001f8:	5b                   	pop    %rbx
+  8001f9:	41 5c                	pop    %r12
+  8001fb:	41 5d                	pop    %r13
+  8001fd:	41 5e                	pop    %r14
+  8001ff:	5d                   	pop    %rbp
+  800200:	c3                   	ret
+
+0000000000800201 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800201:	55                   	push   %rbp
+  800202:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800205:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  80020c:	00 00 00 
+  80020f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800211:	bf 00 00 00 00       	mov    $0x0,%edi
+  800216:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  80021d:	00 00 00 
+  800220:	ff d0                	call   *%rax
+}
+  800222:	5d                   	pop    %rbp
+  800223:	c3                   	ret
+
+0000000000800224 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800224:	55                   	push   %rbp
+  800225:	48 89 e5             	mov    %rsp,%rbp
+  800228:	41 56                	push   %r14
+  80022a:	41 55                	push   %r13
+  80022c:	41 54                	push   %r12
+  80022e:	53                   	push   %rbx
+  80022f:	48 83 ec 50          	sub    $0x50,%rsp
+  800233:	49 89 fc             	mov    %rdi,%r12
+  800236:	41 89 f5             	mov    %esi,%r13d
+  800239:	48 89 d3             	mov    %rdx,%rbx
+  80023c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800240:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800244:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800248:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80024f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800253:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800257:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80025b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80025f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800266:	00 00 00 
+  800269:	4c 8b 30             	mov    (%rax),%r14
+  80026c:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  800273:	00 00 00 
+  800276:	ff d0                	call   *%rax
+  800278:	89 c6                	mov    %eax,%esi
+  80027a:	45 89 e8             	mov    %r13d,%r8d
+  80027d:	4c 89 e1             	mov    %r12,%rcx
+  800280:	4c 89 f2             	mov    %r14,%rdx
+  800283:	48 bf c8 50 80 00 00 	movabs $0x8050c8,%rdi
+  80028a:	00 00 00 
+  80028d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800292:	49 bc 74 03 80 00 00 	movabs $0x800374,%r12
+  800299:	00 00 00 
+  80029c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80029f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002a3:	48 89 df             	mov    %rbx,%rdi
+  8002a6:	48 b8 10 03 80 00 00 	movabs $0x800310,%rax
+  8002ad:	00 00 00 
+  8002b0:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002b2:	48 bf 96 50 80 00 00 	movabs $0x805096,%rdi
+  8002b9:	00 00 00 
+  8002bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c1:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002c4:	cc                   	int3
+  8002c5:	eb fd                	jmp    8002c4 <_panic+0xa0>
+
+00000000008002c7 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002c7:	55                   	push   %rbp
+  8002c8:	48 89 e5             	mov    %rsp,%rbp
+  8002cb:	53                   	push   %rbx
+  8002cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d0:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002d3:	8b 06                	mov    (%rsi),%eax
+  8002d5:	8d 50 01             	lea    0x1(%rax),%edx
+  8002d8:	89 16                	mov    %edx,(%rsi)
+  8002da:	48 98                	cltq
+  8002dc:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002e1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002e7:	74 0a                	je     8002f3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002e9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f1:	c9                   	leave
+  8002f2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002f3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002f7:	be ff 00 00 00       	mov    $0xff,%esi
+  8002fc:	48 b8 c3 12 80 00 00 	movabs $0x8012c3,%rax
+  800303:	00 00 00 
+  800306:	ff d0                	call   *%rax
+        state->offset = 0;
+  800308:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80030e:	eb d9                	jmp    8002e9 <putch+0x22>
+
+0000000000800310 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800310:	55                   	push   %rbp
+  800311:	48 89 e5             	mov    %rsp,%rbp
+  800314:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80031b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80031e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800325:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800332:	48 89 f1             	mov    %rsi,%rcx
+  800335:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80033c:	48 bf c7 02 80 00 00 	movabs $0x8002c7,%rdi
+  800343:	00 00 00 
+  800346:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  80034d:	00 00 00 
+  800350:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800352:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800359:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800360:	48 b8 c3 12 80 00 00 	movabs $0x8012c3,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80036c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800372:	c9                   	leave
+  800373:	c3                   	ret
+
+0000000000800374 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800374:	55                   	push   %rbp
+  800375:	48 89 e5             	mov    %rsp,%rbp
+  800378:	48 83 ec 50          	sub    $0x50,%rsp
+  80037c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800380:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800384:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800388:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80038c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800390:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800397:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80039b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80039f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003a3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003a7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003ab:	48 b8 10 03 80 00 00 	movabs $0x800310,%rax
+  8003b2:	00 00 00 
+  8003b5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003b7:	c9                   	leave
+  8003b8:	c3                   	ret
+
+00000000008003b9 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003b9:	55                   	push   %rbp
+  8003ba:	48 89 e5             	mov    %rsp,%rbp
+  8003bd:	41 57                	push   %r15
+  8003bf:	41 56                	push   %r14
+  8003c1:	41 55                	push   %r13
+  8003c3:	41 54                	push   %r12
+  8003c5:	53                   	push   %rbx
+  8003c6:	48 83 ec 18          	sub    $0x18,%rsp
+  8003ca:	49 89 fc             	mov    %rdi,%r12
+  8003cd:	49 89 f5             	mov    %rsi,%r13
+  8003d0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003d4:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003d7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003da:	41 89 cf             	mov    %ecx,%r15d
+  8003dd:	4c 39 fa             	cmp    %r15,%rdx
+  8003e0:	73 5b                	jae    80043d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003e2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003e6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003ea:	85 db                	test   %ebx,%ebx
+  8003ec:	7e 0e                	jle    8003fc <print_num+0x43>
+            putch(padc, put_arg);
+  8003ee:	4c 89 ee             	mov    %r13,%rsi
+  8003f1:	44 89 f7             	mov    %r14d,%edi
+  8003f4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003f7:	83 eb 01             	sub    $0x1,%ebx
+  8003fa:	75 f2                	jne    8003ee <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003fc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800400:	48 b9 fc 50 80 00 00 	movabs $0x8050fc,%rcx
+  800407:	00 00 00 
+  80040a:	48 b8 eb 50 80 00 00 	movabs $0x8050eb,%rax
+  800411:	00 00 00 
+  800414:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800418:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80041c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800421:	49 f7 f7             	div    %r15
+  800424:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800428:	4c 89 ee             	mov    %r13,%rsi
+  80042b:	41 ff d4             	call   *%r12
+}
+  80042e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800432:	5b                   	pop    %rbx
+  800433:	41 5c                	pop    %r12
+  800435:	41 5d                	pop    %r13
+  800437:	41 5e                	pop    %r14
+  800439:	41 5f                	pop    %r15
+  80043b:	5d                   	pop    %rbp
+  80043c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80043d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800441:	ba 00 00 00 00       	mov    $0x0,%edx
+  800446:	49 f7 f7             	div    %r15
+  800449:	48 83 ec 08          	sub    $0x8,%rsp
+  80044d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800451:	52                   	push   %rdx
+  800452:	45 0f be c9          	movsbl %r9b,%r9d
+  800456:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80045a:	48 89 c2             	mov    %rax,%rdx
+  80045d:	48 b8 b9 03 80 00 00 	movabs $0x8003b9,%rax
+  800464:	00 00 00 
+  800467:	ff d0                	call   *%rax
+  800469:	48 83 c4 10          	add    $0x10,%rsp
+  80046d:	eb 8d                	jmp    8003fc <print_num+0x43>
+
+000000000080046f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80046f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800473:	48 8b 06             	mov    (%rsi),%rax
+  800476:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80047a:	73 0a                	jae    800486 <sprintputch+0x17>
+        *state->start++ = ch;
+  80047c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800480:	48 89 16             	mov    %rdx,(%rsi)
+  800483:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800486:	c3                   	ret
+
+0000000000800487 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800487:	55                   	push   %rbp
+  800488:	48 89 e5             	mov    %rsp,%rbp
+  80048b:	48 83 ec 50          	sub    $0x50,%rsp
+  80048f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800493:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800497:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80049b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004aa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004ae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004b2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004b6:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  8004bd:	00 00 00 
+  8004c0:	ff d0                	call   *%rax
+}
+  8004c2:	c9                   	leave
+  8004c3:	c3                   	ret
+
+00000000008004c4 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004c4:	55                   	push   %rbp
+  8004c5:	48 89 e5             	mov    %rsp,%rbp
+  8004c8:	41 57                	push   %r15
+  8004ca:	41 56                	push   %r14
+  8004cc:	41 55                	push   %r13
+  8004ce:	41 54                	push   %r12
+  8004d0:	53                   	push   %rbx
+  8004d1:	48 83 ec 38          	sub    $0x38,%rsp
+  8004d5:	49 89 fe             	mov    %rdi,%r14
+  8004d8:	49 89 f5             	mov    %rsi,%r13
+  8004db:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004de:	48 8b 01             	mov    (%rcx),%rax
+  8004e1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004e5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ed:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004f1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004f5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004f9:	0f b6 3b             	movzbl (%rbx),%edi
+  8004fc:	40 80 ff 25          	cmp    $0x25,%dil
+  800500:	74 18                	je     80051a <vprintfmt+0x56>
+            if (!ch) return;
+  800502:	40 84 ff             	test   %dil,%dil
+  800505:	0f 84 04 07 00 00    	je     800c0f <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80050b:	40 0f b6 ff          	movzbl %dil,%edi
+  80050f:	4c 89 ee             	mov    %r13,%rsi
+  800512:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800515:	4c 89 e3             	mov    %r12,%rbx
+  800518:	eb db                	jmp    8004f5 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80051a:	be 00 00 00 00       	mov    $0x0,%esi
+  80051f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800523:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800528:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80052e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800535:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800539:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80053e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800543:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800546:	83 e8 23             	sub    $0x23,%eax
+  800549:	3c 57                	cmp    $0x57,%al
+  80054b:	0f 87 a4 06 00 00    	ja     800bf5 <vprintfmt+0x731>
+  800551:	0f b6 c0             	movzbl %al,%eax
+  800554:	48 b9 80 52 80 00 00 	movabs $0x805280,%rcx
+  80055b:	00 00 00 
+  80055e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800561:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800564:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800568:	eb cf                	jmp    800539 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80056a:	49 89 dc             	mov    %rbx,%r12
+  80056d:	be 01 00 00 00       	mov    $0x1,%esi
+  800572:	eb c5                	jmp    800539 <vprintfmt+0x75>
+            padc = ch;
+  800574:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800578:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80057b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80057e:	eb b9                	jmp    800539 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800580:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800583:	83 f8 2f             	cmp    $0x2f,%eax
+  800586:	77 24                	ja     8005ac <vprintfmt+0xe8>
+  800588:	89 c1                	mov    %eax,%ecx
+  80058a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80058e:	83 c0 08             	add    $0x8,%eax
+  800591:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800594:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800597:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80059a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80059e:	79 99                	jns    800539 <vprintfmt+0x75>
+                width = precision;
+  8005a0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005a4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005aa:	eb 8d                	jmp    800539 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005ac:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005b0:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b8:	eb da                	jmp    800594 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005ba:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005bf:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005c3:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005c9:	3c 39                	cmp    $0x39,%al
+  8005cb:	77 1c                	ja     8005e9 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005cd:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005d1:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005d5:	0f b6 c0             	movzbl %al,%eax
+  8005d8:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005dd:	0f b6 03             	movzbl (%rbx),%eax
+  8005e0:	3c 39                	cmp    $0x39,%al
+  8005e2:	76 e9                	jbe    8005cd <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005e4:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005e7:	eb b1                	jmp    80059a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005e9:	49 89 dc             	mov    %rbx,%r12
+  8005ec:	eb ac                	jmp    80059a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005ee:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005f1:	85 c9                	test   %ecx,%ecx
+  8005f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f8:	0f 49 c1             	cmovns %ecx,%eax
+  8005fb:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005fe:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800601:	e9 33 ff ff ff       	jmp    800539 <vprintfmt+0x75>
+            lflag++;
+  800606:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800609:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80060c:	e9 28 ff ff ff       	jmp    800539 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800611:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800614:	83 f8 2f             	cmp    $0x2f,%eax
+  800617:	77 19                	ja     800632 <vprintfmt+0x16e>
+  800619:	89 c2                	mov    %eax,%edx
+  80061b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80061f:	83 c0 08             	add    $0x8,%eax
+  800622:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800625:	8b 3a                	mov    (%rdx),%edi
+  800627:	4c 89 ee             	mov    %r13,%rsi
+  80062a:	41 ff d6             	call   *%r14
+            break;
+  80062d:	e9 c3 fe ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800632:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800636:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80063e:	eb e5                	jmp    800625 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800640:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800643:	83 f8 2f             	cmp    $0x2f,%eax
+  800646:	77 5a                	ja     8006a2 <vprintfmt+0x1de>
+  800648:	89 c2                	mov    %eax,%edx
+  80064a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80064e:	83 c0 08             	add    $0x8,%eax
+  800651:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800654:	8b 02                	mov    (%rdx),%eax
+  800656:	89 c1                	mov    %eax,%ecx
+  800658:	f7 d9                	neg    %ecx
+  80065a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80065d:	83 f9 13             	cmp    $0x13,%ecx
+  800660:	7f 4e                	jg     8006b0 <vprintfmt+0x1ec>
+  800662:	48 63 c1             	movslq %ecx,%rax
+  800665:	48 ba 40 55 80 00 00 	movabs $0x805540,%rdx
+  80066c:	00 00 00 
+  80066f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800673:	48 85 c0             	test   %rax,%rax
+  800676:	74 38                	je     8006b0 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800678:	48 89 c1             	mov    %rax,%rcx
+  80067b:	48 ba 79 57 80 00 00 	movabs $0x805779,%rdx
+  800682:	00 00 00 
+  800685:	4c 89 ee             	mov    %r13,%rsi
+  800688:	4c 89 f7             	mov    %r14,%rdi
+  80068b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800690:	49 b8 87 04 80 00 00 	movabs $0x800487,%r8
+  800697:	00 00 00 
+  80069a:	41 ff d0             	call   *%r8
+  80069d:	e9 53 fe ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ae:	eb a4                	jmp    800654 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006b0:	48 ba 14 51 80 00 00 	movabs $0x805114,%rdx
+  8006b7:	00 00 00 
+  8006ba:	4c 89 ee             	mov    %r13,%rsi
+  8006bd:	4c 89 f7             	mov    %r14,%rdi
+  8006c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c5:	49 b8 87 04 80 00 00 	movabs $0x800487,%r8
+  8006cc:	00 00 00 
+  8006cf:	41 ff d0             	call   *%r8
+  8006d2:	e9 1e fe ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006da:	83 f8 2f             	cmp    $0x2f,%eax
+  8006dd:	77 36                	ja     800715 <vprintfmt+0x251>
+  8006df:	89 c2                	mov    %eax,%edx
+  8006e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e5:	83 c0 08             	add    $0x8,%eax
+  8006e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006eb:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8006ee:	48 85 f6             	test   %rsi,%rsi
+  8006f1:	48 b8 0d 51 80 00 00 	movabs $0x80510d,%rax
+  8006f8:	00 00 00 
+  8006fb:	48 0f 45 c6          	cmovne %rsi,%rax
+  8006ff:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800703:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800707:	7e 06                	jle    80070f <vprintfmt+0x24b>
+  800709:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80070d:	75 14                	jne    800723 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80070f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800713:	eb 5b                	jmp    800770 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800715:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800719:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80071d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800721:	eb c8                	jmp    8006eb <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800723:	49 63 f7             	movslq %r15d,%rsi
+  800726:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80072a:	48 b8 c9 0c 80 00 00 	movabs $0x800cc9,%rax
+  800731:	00 00 00 
+  800734:	ff d0                	call   *%rax
+  800736:	48 89 c2             	mov    %rax,%rdx
+  800739:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80073c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80073e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800741:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800744:	85 c0                	test   %eax,%eax
+  800746:	7e c7                	jle    80070f <vprintfmt+0x24b>
+  800748:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80074d:	4c 89 ee             	mov    %r13,%rsi
+  800750:	44 89 e7             	mov    %r12d,%edi
+  800753:	41 ff d6             	call   *%r14
+  800756:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80075a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80075d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800760:	75 eb                	jne    80074d <vprintfmt+0x289>
+  800762:	eb ab                	jmp    80070f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800764:	0f b6 f8             	movzbl %al,%edi
+  800767:	4c 89 ee             	mov    %r13,%rsi
+  80076a:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  80076d:	4c 89 e2             	mov    %r12,%rdx
+  800770:	45 85 ff             	test   %r15d,%r15d
+  800773:	78 06                	js     80077b <vprintfmt+0x2b7>
+  800775:	41 83 ef 01          	sub    $0x1,%r15d
+  800779:	78 23                	js     80079e <vprintfmt+0x2da>
+  80077b:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  80077f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800785:	84 c0                	test   %al,%al
+  800787:	74 15                	je     80079e <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800789:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80078d:	74 d5                	je     800764 <vprintfmt+0x2a0>
+  80078f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800792:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800797:	80 fa 5e             	cmp    $0x5e,%dl
+  80079a:	77 cb                	ja     800767 <vprintfmt+0x2a3>
+  80079c:	eb c6                	jmp    800764 <vprintfmt+0x2a0>
+  80079e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007a1:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8007a4:	01 f0                	add    %esi,%eax
+  8007a6:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8007a8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007ac:	85 c0                	test   %eax,%eax
+  8007ae:	0f 8e 41 fd ff ff    	jle    8004f5 <vprintfmt+0x31>
+  8007b4:	4c 89 ee             	mov    %r13,%rsi
+  8007b7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007bc:	41 ff d6             	call   *%r14
+  8007bf:	41 83 ec 01          	sub    $0x1,%r12d
+  8007c3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007c7:	75 eb                	jne    8007b4 <vprintfmt+0x2f0>
+  8007c9:	e9 27 fd ff ff       	jmp    8004f5 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ce:	40 84 f6             	test   %sil,%sil
+  8007d1:	75 26                	jne    8007f9 <vprintfmt+0x335>
+    switch (lflag) {
+  8007d3:	85 d2                	test   %edx,%edx
+  8007d5:	74 59                	je     800830 <vprintfmt+0x36c>
+  8007d7:	83 fa 01             	cmp    $0x1,%edx
+  8007da:	74 7b                	je     800857 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8007dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007df:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e2:	0f 87 96 00 00 00    	ja     80087e <vprintfmt+0x3ba>
+  8007e8:	89 c2                	mov    %eax,%edx
+  8007ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ee:	83 c0 08             	add    $0x8,%eax
+  8007f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f4:	4c 8b 22             	mov    (%rdx),%r12
+  8007f7:	eb 17                	jmp    800810 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ff:	77 21                	ja     800822 <vprintfmt+0x35e>
+  800801:	89 c2                	mov    %eax,%edx
+  800803:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800807:	83 c0 08             	add    $0x8,%eax
+  80080a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800810:	4d 85 e4             	test   %r12,%r12
+  800813:	78 7a                	js     80088f <vprintfmt+0x3cb>
+            num = i;
+  800815:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800818:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80081d:	e9 b5 02 00 00       	jmp    800ad7 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800822:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800826:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082e:	eb dd                	jmp    80080d <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 11                	ja     800849 <vprintfmt+0x385>
+  800838:	89 c2                	mov    %eax,%edx
+  80083a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083e:	83 c0 08             	add    $0x8,%eax
+  800841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800844:	4c 63 22             	movslq (%rdx),%r12
+  800847:	eb c7                	jmp    800810 <vprintfmt+0x34c>
+  800849:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800851:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800855:	eb ed                	jmp    800844 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800857:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085a:	83 f8 2f             	cmp    $0x2f,%eax
+  80085d:	77 11                	ja     800870 <vprintfmt+0x3ac>
+  80085f:	89 c2                	mov    %eax,%edx
+  800861:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800865:	83 c0 08             	add    $0x8,%eax
+  800868:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086b:	4c 8b 22             	mov    (%rdx),%r12
+  80086e:	eb a0                	jmp    800810 <vprintfmt+0x34c>
+  800870:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800874:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800878:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087c:	eb ed                	jmp    80086b <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  80087e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800882:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800886:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088a:	e9 65 ff ff ff       	jmp    8007f4 <vprintfmt+0x330>
+                putch('-', put_arg);
+  80088f:	4c 89 ee             	mov    %r13,%rsi
+  800892:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800897:	41 ff d6             	call   *%r14
+                i = -i;
+  80089a:	49 f7 dc             	neg    %r12
+  80089d:	e9 73 ff ff ff       	jmp    800815 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a2:	40 84 f6             	test   %sil,%sil
+  8008a5:	75 32                	jne    8008d9 <vprintfmt+0x415>
+    switch (lflag) {
+  8008a7:	85 d2                	test   %edx,%edx
+  8008a9:	74 5d                	je     800908 <vprintfmt+0x444>
+  8008ab:	83 fa 01             	cmp    $0x1,%edx
+  8008ae:	0f 84 82 00 00 00    	je     800936 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  8008b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ba:	0f 87 a5 00 00 00    	ja     800965 <vprintfmt+0x4a1>
+  8008c0:	89 c2                	mov    %eax,%edx
+  8008c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c6:	83 c0 08             	add    $0x8,%eax
+  8008c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008d4:	e9 fe 01 00 00       	jmp    800ad7 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8008d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008df:	77 19                	ja     8008fa <vprintfmt+0x436>
+  8008e1:	89 c2                	mov    %eax,%edx
+  8008e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e7:	83 c0 08             	add    $0x8,%eax
+  8008ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ed:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008f0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008f5:	e9 dd 01 00 00       	jmp    800ad7 <vprintfmt+0x613>
+  8008fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800902:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800906:	eb e5                	jmp    8008ed <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800908:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090b:	83 f8 2f             	cmp    $0x2f,%eax
+  80090e:	77 18                	ja     800928 <vprintfmt+0x464>
+  800910:	89 c2                	mov    %eax,%edx
+  800912:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800916:	83 c0 08             	add    $0x8,%eax
+  800919:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80091e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800923:	e9 af 01 00 00       	jmp    800ad7 <vprintfmt+0x613>
+  800928:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800930:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800934:	eb e6                	jmp    80091c <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800936:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800939:	83 f8 2f             	cmp    $0x2f,%eax
+  80093c:	77 19                	ja     800957 <vprintfmt+0x493>
+  80093e:	89 c2                	mov    %eax,%edx
+  800940:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800944:	83 c0 08             	add    $0x8,%eax
+  800947:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80094d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800952:	e9 80 01 00 00       	jmp    800ad7 <vprintfmt+0x613>
+  800957:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800963:	eb e5                	jmp    80094a <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800965:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800969:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800971:	e9 56 ff ff ff       	jmp    8008cc <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800976:	40 84 f6             	test   %sil,%sil
+  800979:	75 2e                	jne    8009a9 <vprintfmt+0x4e5>
+    switch (lflag) {
+  80097b:	85 d2                	test   %edx,%edx
+  80097d:	0f 84 b3 00 00 00    	je     800a36 <vprintfmt+0x572>
+  800983:	83 fa 01             	cmp    $0x1,%edx
+  800986:	0f 84 d3 00 00 00    	je     800a5f <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  80098c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098f:	83 f8 2f             	cmp    $0x2f,%eax
+  800992:	0f 87 f1 00 00 00    	ja     800a89 <vprintfmt+0x5c5>
+  800998:	89 c2                	mov    %eax,%edx
+  80099a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099e:	83 c0 08             	add    $0x8,%eax
+  8009a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a4:	48 8b 02             	mov    (%rdx),%rax
+  8009a7:	eb 17                	jmp    8009c0 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8009af:	77 77                	ja     800a28 <vprintfmt+0x564>
+  8009b1:	89 c2                	mov    %eax,%edx
+  8009b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b7:	83 c0 08             	add    $0x8,%eax
+  8009ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bd:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  8009c0:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8009c2:	83 f8 07             	cmp    $0x7,%eax
+  8009c5:	0f 8e cf 00 00 00    	jle    800a9a <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  8009cb:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  8009d1:	44 89 e7             	mov    %r12d,%edi
+  8009d4:	41 c1 e4 03          	shl    $0x3,%r12d
+  8009d8:	89 d1                	mov    %edx,%ecx
+  8009da:	8d 72 07             	lea    0x7(%rdx),%esi
+  8009dd:	85 d2                	test   %edx,%edx
+  8009df:	0f 48 d6             	cmovs  %esi,%edx
+  8009e2:	c1 fa 03             	sar    $0x3,%edx
+  8009e5:	83 f9 3f             	cmp    $0x3f,%ecx
+  8009e8:	7f e7                	jg     8009d1 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8009ea:	85 ff                	test   %edi,%edi
+  8009ec:	0f 84 03 fb ff ff    	je     8004f5 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8009f2:	49 63 f4             	movslq %r12d,%rsi
+  8009f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009fa:	48 f7 f6             	div    %rsi
+  8009fd:	49 89 d7             	mov    %rdx,%r15
+  800a00:	83 c0 30             	add    $0x30,%eax
+  800a03:	0f be f8             	movsbl %al,%edi
+  800a06:	4c 89 ee             	mov    %r13,%rsi
+  800a09:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800a0c:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800a0f:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800a14:	45 85 e4             	test   %r12d,%r12d
+  800a17:	41 0f 49 d4          	cmovns %r12d,%edx
+  800a1b:	c1 fa 03             	sar    $0x3,%edx
+  800a1e:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800a21:	75 cf                	jne    8009f2 <vprintfmt+0x52e>
+  800a23:	e9 cd fa ff ff       	jmp    8004f5 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a34:	eb 87                	jmp    8009bd <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800a36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a39:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3c:	77 13                	ja     800a51 <vprintfmt+0x58d>
+  800a3e:	89 c2                	mov    %eax,%edx
+  800a40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a44:	83 c0 08             	add    $0x8,%eax
+  800a47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4a:	8b 02                	mov    (%rdx),%eax
+  800a4c:	e9 6f ff ff ff       	jmp    8009c0 <vprintfmt+0x4fc>
+  800a51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5d:	eb eb                	jmp    800a4a <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800a5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a62:	83 f8 2f             	cmp    $0x2f,%eax
+  800a65:	77 14                	ja     800a7b <vprintfmt+0x5b7>
+  800a67:	89 c2                	mov    %eax,%edx
+  800a69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6d:	83 c0 08             	add    $0x8,%eax
+  800a70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a73:	48 8b 02             	mov    (%rdx),%rax
+  800a76:	e9 45 ff ff ff       	jmp    8009c0 <vprintfmt+0x4fc>
+  800a7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a87:	eb ea                	jmp    800a73 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800a89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a95:	e9 0a ff ff ff       	jmp    8009a4 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800a9a:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800aa0:	e9 4d ff ff ff       	jmp    8009f2 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800aa5:	4c 89 ee             	mov    %r13,%rsi
+  800aa8:	bf 30 00 00 00       	mov    $0x30,%edi
+  800aad:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ab0:	4c 89 ee             	mov    %r13,%rsi
+  800ab3:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ab8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800abb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abe:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac1:	77 47                	ja     800b0a <vprintfmt+0x646>
+  800ac3:	89 c2                	mov    %eax,%edx
+  800ac5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac9:	83 c0 08             	add    $0x8,%eax
+  800acc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ad2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ad7:	48 83 ec 08          	sub    $0x8,%rsp
+  800adb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800adf:	0f 94 c0             	sete   %al
+  800ae2:	0f b6 c0             	movzbl %al,%eax
+  800ae5:	50                   	push   %rax
+  800ae6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800aeb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800aef:	4c 89 ee             	mov    %r13,%rsi
+  800af2:	4c 89 f7             	mov    %r14,%rdi
+  800af5:	48 b8 b9 03 80 00 00 	movabs $0x8003b9,%rax
+  800afc:	00 00 00 
+  800aff:	ff d0                	call   *%rax
+            break;
+  800b01:	48 83 c4 10          	add    $0x10,%rsp
+  800b05:	e9 eb f9 ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b16:	eb b7                	jmp    800acf <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800b18:	40 84 f6             	test   %sil,%sil
+  800b1b:	75 2b                	jne    800b48 <vprintfmt+0x684>
+    switch (lflag) {
+  800b1d:	85 d2                	test   %edx,%edx
+  800b1f:	74 56                	je     800b77 <vprintfmt+0x6b3>
+  800b21:	83 fa 01             	cmp    $0x1,%edx
+  800b24:	74 7f                	je     800ba5 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800b26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b29:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2c:	0f 87 a2 00 00 00    	ja     800bd4 <vprintfmt+0x710>
+  800b32:	89 c2                	mov    %eax,%edx
+  800b34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b38:	83 c0 08             	add    $0x8,%eax
+  800b3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b41:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b46:	eb 8f                	jmp    800ad7 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800b48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4e:	77 19                	ja     800b69 <vprintfmt+0x6a5>
+  800b50:	89 c2                	mov    %eax,%edx
+  800b52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b56:	83 c0 08             	add    $0x8,%eax
+  800b59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b5f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b64:	e9 6e ff ff ff       	jmp    800ad7 <vprintfmt+0x613>
+  800b69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b75:	eb e5                	jmp    800b5c <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800b77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7d:	77 18                	ja     800b97 <vprintfmt+0x6d3>
+  800b7f:	89 c2                	mov    %eax,%edx
+  800b81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b85:	83 c0 08             	add    $0x8,%eax
+  800b88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b8d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b92:	e9 40 ff ff ff       	jmp    800ad7 <vprintfmt+0x613>
+  800b97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba3:	eb e6                	jmp    800b8b <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800ba5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bab:	77 19                	ja     800bc6 <vprintfmt+0x702>
+  800bad:	89 c2                	mov    %eax,%edx
+  800baf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb3:	83 c0 08             	add    $0x8,%eax
+  800bb6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bbc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bc1:	e9 11 ff ff ff       	jmp    800ad7 <vprintfmt+0x613>
+  800bc6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd2:	eb e5                	jmp    800bb9 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800bd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be0:	e9 59 ff ff ff       	jmp    800b3e <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800be5:	4c 89 ee             	mov    %r13,%rsi
+  800be8:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bed:	41 ff d6             	call   *%r14
+            break;
+  800bf0:	e9 00 f9 ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bf5:	4c 89 ee             	mov    %r13,%rsi
+  800bf8:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bfd:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c00:	48 83 eb 01          	sub    $0x1,%rbx
+  800c04:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c08:	75 f6                	jne    800c00 <vprintfmt+0x73c>
+  800c0a:	e9 e6 f8 ff ff       	jmp    8004f5 <vprintfmt+0x31>
+}
+  800c0f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c13:	5b                   	pop    %rbx
+  800c14:	41 5c                	pop    %r12
+  800c16:	41 5d                	pop    %r13
+  800c18:	41 5e                	pop    %r14
+  800c1a:	41 5f                	pop    %r15
+  800c1c:	5d                   	pop    %rbp
+  800c1d:	c3                   	ret
+
+0000000000800c1e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c1e:	55                   	push   %rbp
+  800c1f:	48 89 e5             	mov    %rsp,%rbp
+  800c22:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c26:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c2a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c2f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c33:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c3a:	48 85 ff             	test   %rdi,%rdi
+  800c3d:	74 2b                	je     800c6a <vsnprintf+0x4c>
+  800c3f:	48 85 f6             	test   %rsi,%rsi
+  800c42:	74 26                	je     800c6a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c44:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c48:	48 bf 6f 04 80 00 00 	movabs $0x80046f,%rdi
+  800c4f:	00 00 00 
+  800c52:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  800c59:	00 00 00 
+  800c5c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c62:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c65:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c68:	c9                   	leave
+  800c69:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c6f:	eb f7                	jmp    800c68 <vsnprintf+0x4a>
+
+0000000000800c71 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c71:	55                   	push   %rbp
+  800c72:	48 89 e5             	mov    %rsp,%rbp
+  800c75:	48 83 ec 50          	sub    $0x50,%rsp
+  800c79:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c7d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c81:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c85:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c8c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c94:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c98:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c9c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ca0:	48 b8 1e 0c 80 00 00 	movabs $0x800c1e,%rax
+  800ca7:	00 00 00 
+  800caa:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cac:	c9                   	leave
+  800cad:	c3                   	ret
+
+0000000000800cae <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cae:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cb1:	74 10                	je     800cc3 <strlen+0x15>
+    size_t n = 0;
+  800cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cb8:	48 83 c0 01          	add    $0x1,%rax
+  800cbc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cc0:	75 f6                	jne    800cb8 <strlen+0xa>
+  800cc2:	c3                   	ret
+    size_t n = 0;
+  800cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cc8:	c3                   	ret
+
+0000000000800cc9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cc9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cd1:	48 85 f6             	test   %rsi,%rsi
+  800cd4:	74 11                	je     800ce7 <strnlen+0x1e>
+  800cd6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cda:	74 0c                	je     800ce8 <strnlen+0x1f>
+  800cdc:	48 83 c2 01          	add    $0x1,%rdx
+  800ce0:	48 39 d0             	cmp    %rdx,%rax
+  800ce3:	75 f1                	jne    800cd6 <strnlen+0xd>
+  800ce5:	eb 04                	jmp    800ceb <strnlen+0x22>
+  800ce7:	c3                   	ret
+  800ce8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ceb:	c3                   	ret
+
+0000000000800cec <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cec:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf4:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cf8:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cfb:	48 83 c2 01          	add    $0x1,%rdx
+  800cff:	84 c9                	test   %cl,%cl
+  800d01:	75 f1                	jne    800cf4 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d03:	c3                   	ret
+
+0000000000800d04 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d04:	55                   	push   %rbp
+  800d05:	48 89 e5             	mov    %rsp,%rbp
+  800d08:	41 54                	push   %r12
+  800d0a:	53                   	push   %rbx
+  800d0b:	48 89 fb             	mov    %rdi,%rbx
+  800d0e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d11:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  800d18:	00 00 00 
+  800d1b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d1d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d21:	4c 89 e6             	mov    %r12,%rsi
+  800d24:	48 b8 ec 0c 80 00 00 	movabs $0x800cec,%rax
+  800d2b:	00 00 00 
+  800d2e:	ff d0                	call   *%rax
+    return dst;
+}
+  800d30:	48 89 d8             	mov    %rbx,%rax
+  800d33:	5b                   	pop    %rbx
+  800d34:	41 5c                	pop    %r12
+  800d36:	5d                   	pop    %rbp
+  800d37:	c3                   	ret
+
+0000000000800d38 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d38:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d3b:	48 85 d2             	test   %rdx,%rdx
+  800d3e:	74 1f                	je     800d5f <strncpy+0x27>
+  800d40:	48 01 fa             	add    %rdi,%rdx
+  800d43:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d46:	48 83 c1 01          	add    $0x1,%rcx
+  800d4a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d4e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d52:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d56:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d5a:	48 39 ca             	cmp    %rcx,%rdx
+  800d5d:	75 e7                	jne    800d46 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d5f:	c3                   	ret
+
+0000000000800d60 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d60:	48 89 f8             	mov    %rdi,%rax
+  800d63:	48 85 d2             	test   %rdx,%rdx
+  800d66:	74 24                	je     800d8c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d68:	48 83 ea 01          	sub    $0x1,%rdx
+  800d6c:	74 1b                	je     800d89 <strlcpy+0x29>
+  800d6e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d72:	0f b6 16             	movzbl (%rsi),%edx
+  800d75:	84 d2                	test   %dl,%dl
+  800d77:	74 10                	je     800d89 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d79:	48 83 c6 01          	add    $0x1,%rsi
+  800d7d:	48 83 c0 01          	add    $0x1,%rax
+  800d81:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d84:	48 39 c8             	cmp    %rcx,%rax
+  800d87:	75 e9                	jne    800d72 <strlcpy+0x12>
+        *dst = '\0';
+  800d89:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d8c:	48 29 f8             	sub    %rdi,%rax
+}
+  800d8f:	c3                   	ret
+
+0000000000800d90 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d90:	0f b6 07             	movzbl (%rdi),%eax
+  800d93:	84 c0                	test   %al,%al
+  800d95:	74 13                	je     800daa <strcmp+0x1a>
+  800d97:	38 06                	cmp    %al,(%rsi)
+  800d99:	75 0f                	jne    800daa <strcmp+0x1a>
+  800d9b:	48 83 c7 01          	add    $0x1,%rdi
+  800d9f:	48 83 c6 01          	add    $0x1,%rsi
+  800da3:	0f b6 07             	movzbl (%rdi),%eax
+  800da6:	84 c0                	test   %al,%al
+  800da8:	75 ed                	jne    800d97 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800daa:	0f b6 c0             	movzbl %al,%eax
+  800dad:	0f b6 16             	movzbl (%rsi),%edx
+  800db0:	29 d0                	sub    %edx,%eax
+}
+  800db2:	c3                   	ret
+
+0000000000800db3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800db3:	48 85 d2             	test   %rdx,%rdx
+  800db6:	74 1f                	je     800dd7 <strncmp+0x24>
+  800db8:	0f b6 07             	movzbl (%rdi),%eax
+  800dbb:	84 c0                	test   %al,%al
+  800dbd:	74 1e                	je     800ddd <strncmp+0x2a>
+  800dbf:	3a 06                	cmp    (%rsi),%al
+  800dc1:	75 1a                	jne    800ddd <strncmp+0x2a>
+  800dc3:	48 83 c7 01          	add    $0x1,%rdi
+  800dc7:	48 83 c6 01          	add    $0x1,%rsi
+  800dcb:	48 83 ea 01          	sub    $0x1,%rdx
+  800dcf:	75 e7                	jne    800db8 <strncmp+0x5>
+
+    if (!n) return 0;
+  800dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd6:	c3                   	ret
+  800dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ddc:	c3                   	ret
+  800ddd:	48 85 d2             	test   %rdx,%rdx
+  800de0:	74 09                	je     800deb <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800de2:	0f b6 07             	movzbl (%rdi),%eax
+  800de5:	0f b6 16             	movzbl (%rsi),%edx
+  800de8:	29 d0                	sub    %edx,%eax
+  800dea:	c3                   	ret
+    if (!n) return 0;
+  800deb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800df0:	c3                   	ret
+
+0000000000800df1 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800df1:	0f b6 17             	movzbl (%rdi),%edx
+  800df4:	84 d2                	test   %dl,%dl
+  800df6:	74 18                	je     800e10 <strchr+0x1f>
+        if (*str == c) {
+  800df8:	0f be d2             	movsbl %dl,%edx
+  800dfb:	39 f2                	cmp    %esi,%edx
+  800dfd:	74 17                	je     800e16 <strchr+0x25>
+    for (; *str; str++) {
+  800dff:	48 83 c7 01          	add    $0x1,%rdi
+  800e03:	0f b6 17             	movzbl (%rdi),%edx
+  800e06:	84 d2                	test   %dl,%dl
+  800e08:	75 ee                	jne    800df8 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0f:	c3                   	ret
+  800e10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e15:	c3                   	ret
+  800e16:	48 89 f8             	mov    %rdi,%rax
+}
+  800e19:	c3                   	ret
+
+0000000000800e1a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e1a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e1d:	0f b6 17             	movzbl (%rdi),%edx
+  800e20:	84 d2                	test   %dl,%dl
+  800e22:	74 13                	je     800e37 <strfind+0x1d>
+  800e24:	0f be d2             	movsbl %dl,%edx
+  800e27:	39 f2                	cmp    %esi,%edx
+  800e29:	74 0b                	je     800e36 <strfind+0x1c>
+  800e2b:	48 83 c0 01          	add    $0x1,%rax
+  800e2f:	0f b6 10             	movzbl (%rax),%edx
+  800e32:	84 d2                	test   %dl,%dl
+  800e34:	75 ee                	jne    800e24 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e36:	c3                   	ret
+  800e37:	c3                   	ret
+
+0000000000800e38 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800e38:	55                   	push   %rbp
+  800e39:	48 89 e5             	mov    %rsp,%rbp
+  800e3c:	41 57                	push   %r15
+  800e3e:	41 56                	push   %r14
+  800e40:	41 55                	push   %r13
+  800e42:	41 54                	push   %r12
+  800e44:	53                   	push   %rbx
+  800e45:	48 83 ec 08          	sub    $0x8,%rsp
+  800e49:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800e4c:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800e50:	45 84 ed             	test   %r13b,%r13b
+  800e53:	75 12                	jne    800e67 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800e55:	4c 89 f8             	mov    %r15,%rax
+  800e58:	48 83 c4 08          	add    $0x8,%rsp
+  800e5c:	5b                   	pop    %rbx
+  800e5d:	41 5c                	pop    %r12
+  800e5f:	41 5d                	pop    %r13
+  800e61:	41 5e                	pop    %r14
+  800e63:	41 5f                	pop    %r15
+  800e65:	5d                   	pop    %rbp
+  800e66:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  800e67:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  800e6b:	4c 89 e7             	mov    %r12,%rdi
+  800e6e:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  800e75:	00 00 00 
+  800e78:	ff d0                	call   *%rax
+  800e7a:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  800e7d:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  800e81:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  800e85:	49 bf b3 0d 80 00 00 	movabs $0x800db3,%r15
+  800e8c:	00 00 00 
+				if ((sc = *s++) == 0)
+  800e8f:	84 c0                	test   %al,%al
+  800e91:	75 14                	jne    800ea7 <strstr+0x6f>
+					return NULL;
+  800e93:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800e99:	eb ba                	jmp    800e55 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  800e9b:	48 83 c3 01          	add    $0x1,%rbx
+  800e9f:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  800ea3:	84 c0                	test   %al,%al
+  800ea5:	74 1b                	je     800ec2 <strstr+0x8a>
+			} while (sc != c);
+  800ea7:	41 38 c5             	cmp    %al,%r13b
+  800eaa:	75 ef                	jne    800e9b <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  800eac:	4c 89 f2             	mov    %r14,%rdx
+  800eaf:	4c 89 e6             	mov    %r12,%rsi
+  800eb2:	48 89 df             	mov    %rbx,%rdi
+  800eb5:	41 ff d7             	call   *%r15
+  800eb8:	85 c0                	test   %eax,%eax
+  800eba:	75 df                	jne    800e9b <strstr+0x63>
+  800ebc:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  800ec0:	eb 93                	jmp    800e55 <strstr+0x1d>
+					return NULL;
+  800ec2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  800ec8:	eb 8b                	jmp    800e55 <strstr+0x1d>
+
+0000000000800eca <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  800eca:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  800ecc:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  800ecf:	8d 57 20             	lea    0x20(%rdi),%edx
+  800ed2:	83 f9 1a             	cmp    $0x1a,%ecx
+  800ed5:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800ed8:	c3                   	ret
+
+0000000000800ed9 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  800ed9:	55                   	push   %rbp
+  800eda:	48 89 e5             	mov    %rsp,%rbp
+  800edd:	41 57                	push   %r15
+  800edf:	41 56                	push   %r14
+  800ee1:	41 55                	push   %r13
+  800ee3:	41 54                	push   %r12
+  800ee5:	53                   	push   %rbx
+  800ee6:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  800eea:	48 39 f7             	cmp    %rsi,%rdi
+  800eed:	74 49                	je     800f38 <strcasecmp+0x5f>
+  800eef:	49 89 fd             	mov    %rdi,%r13
+  800ef2:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  800ef5:	49 bf ca 0e 80 00 00 	movabs $0x800eca,%r15
+  800efc:	00 00 00 
+  800eff:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  800f04:	41 0f b6 fe          	movzbl %r14b,%edi
+  800f08:	41 ff d7             	call   *%r15
+  800f0b:	89 c3                	mov    %eax,%ebx
+  800f0d:	49 83 c4 01          	add    $0x1,%r12
+  800f11:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800f17:	41 ff d7             	call   *%r15
+  800f1a:	29 c3                	sub    %eax,%ebx
+  800f1c:	75 09                	jne    800f27 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  800f1e:	49 83 c5 01          	add    $0x1,%r13
+  800f22:	45 84 f6             	test   %r14b,%r14b
+  800f25:	75 d8                	jne    800eff <strcasecmp+0x26>
+}
+  800f27:	89 d8                	mov    %ebx,%eax
+  800f29:	48 83 c4 08          	add    $0x8,%rsp
+  800f2d:	5b                   	pop    %rbx
+  800f2e:	41 5c                	pop    %r12
+  800f30:	41 5d                	pop    %r13
+  800f32:	41 5e                	pop    %r14
+  800f34:	41 5f                	pop    %r15
+  800f36:	5d                   	pop    %rbp
+  800f37:	c3                   	ret
+        return 0;
+  800f38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3d:	eb e8                	jmp    800f27 <strcasecmp+0x4e>
+
+0000000000800f3f <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  800f3f:	55                   	push   %rbp
+  800f40:	48 89 e5             	mov    %rsp,%rbp
+  800f43:	41 57                	push   %r15
+  800f45:	41 56                	push   %r14
+  800f47:	41 55                	push   %r13
+  800f49:	41 54                	push   %r12
+  800f4b:	53                   	push   %rbx
+  800f4c:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  800f50:	48 85 d2             	test   %rdx,%rdx
+  800f53:	74 4f                	je     800fa4 <strncasecmp+0x65>
+  800f55:	49 89 fc             	mov    %rdi,%r12
+  800f58:	49 89 f5             	mov    %rsi,%r13
+  800f5b:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  800f5f:	49 be ca 0e 80 00 00 	movabs $0x800eca,%r14
+  800f66:	00 00 00 
+  800f69:	49 83 c4 01          	add    $0x1,%r12
+  800f6d:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  800f73:	41 ff d6             	call   *%r14
+  800f76:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  800f78:	49 83 c5 01          	add    $0x1,%r13
+  800f7c:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  800f81:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  800f84:	29 c3                	sub    %eax,%ebx
+  800f86:	85 c0                	test   %eax,%eax
+  800f88:	74 09                	je     800f93 <strncasecmp+0x54>
+  800f8a:	85 db                	test   %ebx,%ebx
+  800f8c:	75 05                	jne    800f93 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  800f8e:	4d 39 fc             	cmp    %r15,%r12
+  800f91:	75 d6                	jne    800f69 <strncasecmp+0x2a>
+}
+  800f93:	89 d8                	mov    %ebx,%eax
+  800f95:	48 83 c4 08          	add    $0x8,%rsp
+  800f99:	5b                   	pop    %rbx
+  800f9a:	41 5c                	pop    %r12
+  800f9c:	41 5d                	pop    %r13
+  800f9e:	41 5e                	pop    %r14
+  800fa0:	41 5f                	pop    %r15
+  800fa2:	5d                   	pop    %rbp
+  800fa3:	c3                   	ret
+    int d = 0;
+  800fa4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  800fa9:	eb e8                	jmp    800f93 <strncasecmp+0x54>
+
+0000000000800fab <toupper>:
+
+int toupper(int c) {
+  800fab:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  800fad:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  800fb0:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  800fb3:	83 f9 1a             	cmp    $0x1a,%ecx
+  800fb6:	0f 42 c2             	cmovb  %edx,%eax
+}
+  800fb9:	c3                   	ret
+
+0000000000800fba <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  800fba:	83 ff 20             	cmp    $0x20,%edi
+  800fbd:	0f 94 c0             	sete   %al
+  800fc0:	0f b6 c0             	movzbl %al,%eax
+}
+  800fc3:	c3                   	ret
+
+0000000000800fc4 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  800fc4:	89 f8                	mov    %edi,%eax
+  800fc6:	f7 d8                	neg    %eax
+  800fc8:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800fcb:	c3                   	ret
+
+0000000000800fcc <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fcc:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fcf:	48 89 f8             	mov    %rdi,%rax
+  800fd2:	48 f7 d8             	neg    %rax
+  800fd5:	83 e0 07             	and    $0x7,%eax
+  800fd8:	49 89 d1             	mov    %rdx,%r9
+  800fdb:	49 29 c1             	sub    %rax,%r9
+  800fde:	78 36                	js     801016 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fe0:	40 0f b6 c6          	movzbl %sil,%eax
+  800fe4:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800feb:	01 01 01 
+  800fee:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ff2:	40 f6 c7 07          	test   $0x7,%dil
+  800ff6:	75 38                	jne    801030 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ff8:	4c 89 c9             	mov    %r9,%rcx
+  800ffb:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fff:	74 0c                	je     80100d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801001:	fc                   	cld
+  801002:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801005:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801009:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80100d:	4d 85 c9             	test   %r9,%r9
+  801010:	75 45                	jne    801057 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801012:	4c 89 c0             	mov    %r8,%rax
+  801015:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801016:	48 85 d2             	test   %rdx,%rdx
+  801019:	74 f7                	je     801012 <memset+0x46>
+  80101b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80101e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801021:	48 83 c0 01          	add    $0x1,%rax
+  801025:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801029:	48 39 c2             	cmp    %rax,%rdx
+  80102c:	75 f3                	jne    801021 <memset+0x55>
+  80102e:	eb e2                	jmp    801012 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801030:	40 f6 c7 01          	test   $0x1,%dil
+  801034:	74 06                	je     80103c <memset+0x70>
+  801036:	88 07                	mov    %al,(%rdi)
+  801038:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80103c:	40 f6 c7 02          	test   $0x2,%dil
+  801040:	74 07                	je     801049 <memset+0x7d>
+  801042:	66 89 07             	mov    %ax,(%rdi)
+  801045:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801049:	40 f6 c7 04          	test   $0x4,%dil
+  80104d:	74 a9                	je     800ff8 <memset+0x2c>
+  80104f:	89 07                	mov    %eax,(%rdi)
+  801051:	48 83 c7 04          	add    $0x4,%rdi
+  801055:	eb a1                	jmp    800ff8 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801057:	41 f6 c1 04          	test   $0x4,%r9b
+  80105b:	74 06                	je     801063 <memset+0x97>
+  80105d:	89 07                	mov    %eax,(%rdi)
+  80105f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801063:	41 f6 c1 02          	test   $0x2,%r9b
+  801067:	74 07                	je     801070 <memset+0xa4>
+  801069:	66 89 07             	mov    %ax,(%rdi)
+  80106c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801070:	41 f6 c1 01          	test   $0x1,%r9b
+  801074:	74 9c                	je     801012 <memset+0x46>
+  801076:	88 07                	mov    %al,(%rdi)
+  801078:	eb 98                	jmp    801012 <memset+0x46>
+
+000000000080107a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80107a:	48 89 f8             	mov    %rdi,%rax
+  80107d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801080:	48 39 fe             	cmp    %rdi,%rsi
+  801083:	73 3b                	jae    8010c0 <memmove+0x46>
+  801085:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801089:	48 39 d7             	cmp    %rdx,%rdi
+  80108c:	73 32                	jae    8010c0 <memmove+0x46>
+        s += n;
+        d += n;
+  80108e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801092:	48 89 d6             	mov    %rdx,%rsi
+  801095:	48 09 fe             	or     %rdi,%rsi
+  801098:	48 09 ce             	or     %rcx,%rsi
+  80109b:	40 f6 c6 07          	test   $0x7,%sil
+  80109f:	75 12                	jne    8010b3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010a1:	48 83 ef 08          	sub    $0x8,%rdi
+  8010a5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010a9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010ad:	fd                   	std
+  8010ae:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010b1:	fc                   	cld
+  8010b2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010b3:	48 83 ef 01          	sub    $0x1,%rdi
+  8010b7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010bb:	fd                   	std
+  8010bc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010be:	eb f1                	jmp    8010b1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010c0:	48 89 f2             	mov    %rsi,%rdx
+  8010c3:	48 09 c2             	or     %rax,%rdx
+  8010c6:	48 09 ca             	or     %rcx,%rdx
+  8010c9:	f6 c2 07             	test   $0x7,%dl
+  8010cc:	75 0c                	jne    8010da <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010ce:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010d2:	48 89 c7             	mov    %rax,%rdi
+  8010d5:	fc                   	cld
+  8010d6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010d9:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010da:	48 89 c7             	mov    %rax,%rdi
+  8010dd:	fc                   	cld
+  8010de:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010e0:	c3                   	ret
+
+00000000008010e1 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010e1:	55                   	push   %rbp
+  8010e2:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010e5:	48 b8 7a 10 80 00 00 	movabs $0x80107a,%rax
+  8010ec:	00 00 00 
+  8010ef:	ff d0                	call   *%rax
+}
+  8010f1:	5d                   	pop    %rbp
+  8010f2:	c3                   	ret
+
+00000000008010f3 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010f3:	55                   	push   %rbp
+  8010f4:	48 89 e5             	mov    %rsp,%rbp
+  8010f7:	41 57                	push   %r15
+  8010f9:	41 56                	push   %r14
+  8010fb:	41 55                	push   %r13
+  8010fd:	41 54                	push   %r12
+  8010ff:	53                   	push   %rbx
+  801100:	48 83 ec 08          	sub    $0x8,%rsp
+  801104:	49 89 fe             	mov    %rdi,%r14
+  801107:	49 89 f7             	mov    %rsi,%r15
+  80110a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80110d:	48 89 f7             	mov    %rsi,%rdi
+  801110:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  801117:	00 00 00 
+  80111a:	ff d0                	call   *%rax
+  80111c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80111f:	48 89 de             	mov    %rbx,%rsi
+  801122:	4c 89 f7             	mov    %r14,%rdi
+  801125:	48 b8 c9 0c 80 00 00 	movabs $0x800cc9,%rax
+  80112c:	00 00 00 
+  80112f:	ff d0                	call   *%rax
+  801131:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801134:	48 39 c3             	cmp    %rax,%rbx
+  801137:	74 36                	je     80116f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801139:	48 89 d8             	mov    %rbx,%rax
+  80113c:	4c 29 e8             	sub    %r13,%rax
+  80113f:	49 39 c4             	cmp    %rax,%r12
+  801142:	73 31                	jae    801175 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801144:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801149:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80114d:	4c 89 fe             	mov    %r15,%rsi
+  801150:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  801157:	00 00 00 
+  80115a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80115c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801160:	48 83 c4 08          	add    $0x8,%rsp
+  801164:	5b                   	pop    %rbx
+  801165:	41 5c                	pop    %r12
+  801167:	41 5d                	pop    %r13
+  801169:	41 5e                	pop    %r14
+  80116b:	41 5f                	pop    %r15
+  80116d:	5d                   	pop    %rbp
+  80116e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80116f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801173:	eb eb                	jmp    801160 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801175:	48 83 eb 01          	sub    $0x1,%rbx
+  801179:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80117d:	48 89 da             	mov    %rbx,%rdx
+  801180:	4c 89 fe             	mov    %r15,%rsi
+  801183:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  80118a:	00 00 00 
+  80118d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80118f:	49 01 de             	add    %rbx,%r14
+  801192:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801197:	eb c3                	jmp    80115c <strlcat+0x69>
+
+0000000000801199 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801199:	48 85 d2             	test   %rdx,%rdx
+  80119c:	74 2d                	je     8011cb <memcmp+0x32>
+  80119e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011a3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011a7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011ac:	44 38 c1             	cmp    %r8b,%cl
+  8011af:	75 0f                	jne    8011c0 <memcmp+0x27>
+    while (n-- > 0) {
+  8011b1:	48 83 c0 01          	add    $0x1,%rax
+  8011b5:	48 39 c2             	cmp    %rax,%rdx
+  8011b8:	75 e9                	jne    8011a3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011bf:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011c0:	0f b6 c1             	movzbl %cl,%eax
+  8011c3:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011c7:	44 29 c0             	sub    %r8d,%eax
+  8011ca:	c3                   	ret
+    return 0;
+  8011cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011d0:	c3                   	ret
+
+00000000008011d1 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011d1:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011d5:	48 39 c7             	cmp    %rax,%rdi
+  8011d8:	73 0f                	jae    8011e9 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011da:	40 38 37             	cmp    %sil,(%rdi)
+  8011dd:	74 0e                	je     8011ed <memfind+0x1c>
+    for (; src < end; src++) {
+  8011df:	48 83 c7 01          	add    $0x1,%rdi
+  8011e3:	48 39 f8             	cmp    %rdi,%rax
+  8011e6:	75 f2                	jne    8011da <memfind+0x9>
+  8011e8:	c3                   	ret
+  8011e9:	48 89 f8             	mov    %rdi,%rax
+  8011ec:	c3                   	ret
+  8011ed:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011f0:	c3                   	ret
+
+00000000008011f1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011f1:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011f4:	0f b6 37             	movzbl (%rdi),%esi
+  8011f7:	40 80 fe 20          	cmp    $0x20,%sil
+  8011fb:	74 06                	je     801203 <strtol+0x12>
+  8011fd:	40 80 fe 09          	cmp    $0x9,%sil
+  801201:	75 13                	jne    801216 <strtol+0x25>
+  801203:	48 83 c7 01          	add    $0x1,%rdi
+  801207:	0f b6 37             	movzbl (%rdi),%esi
+  80120a:	40 80 fe 20          	cmp    $0x20,%sil
+  80120e:	74 f3                	je     801203 <strtol+0x12>
+  801210:	40 80 fe 09          	cmp    $0x9,%sil
+  801214:	74 ed                	je     801203 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801216:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801219:	83 e0 fd             	and    $0xfffffffd,%eax
+  80121c:	3c 01                	cmp    $0x1,%al
+  80121e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801222:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801228:	75 0f                	jne    801239 <strtol+0x48>
+  80122a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80122d:	74 14                	je     801243 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80122f:	85 d2                	test   %edx,%edx
+  801231:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801236:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801239:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80123e:	4c 63 ca             	movslq %edx,%r9
+  801241:	eb 36                	jmp    801279 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801243:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801247:	74 0f                	je     801258 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801249:	85 d2                	test   %edx,%edx
+  80124b:	75 ec                	jne    801239 <strtol+0x48>
+        s++;
+  80124d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801251:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801256:	eb e1                	jmp    801239 <strtol+0x48>
+        s += 2;
+  801258:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80125c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801261:	eb d6                	jmp    801239 <strtol+0x48>
+            dig -= '0';
+  801263:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801266:	44 0f b6 c1          	movzbl %cl,%r8d
+  80126a:	41 39 d0             	cmp    %edx,%r8d
+  80126d:	7d 21                	jge    801290 <strtol+0x9f>
+        val = val * base + dig;
+  80126f:	49 0f af c1          	imul   %r9,%rax
+  801273:	0f b6 c9             	movzbl %cl,%ecx
+  801276:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801279:	48 83 c7 01          	add    $0x1,%rdi
+  80127d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801281:	80 f9 39             	cmp    $0x39,%cl
+  801284:	76 dd                	jbe    801263 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801286:	80 f9 7b             	cmp    $0x7b,%cl
+  801289:	77 05                	ja     801290 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80128b:	83 e9 57             	sub    $0x57,%ecx
+  80128e:	eb d6                	jmp    801266 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801290:	4d 85 d2             	test   %r10,%r10
+  801293:	74 03                	je     801298 <strtol+0xa7>
+  801295:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801298:	48 89 c2             	mov    %rax,%rdx
+  80129b:	48 f7 da             	neg    %rdx
+  80129e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012a2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012a6:	c3                   	ret
+
+00000000008012a7 <atoi>:
+int atoi(const char *str) {
+  8012a7:	55                   	push   %rbp
+  8012a8:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8012ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b5:	48 b8 f1 11 80 00 00 	movabs $0x8011f1,%rax
+  8012bc:	00 00 00 
+  8012bf:	ff d0                	call   *%rax
+}
+  8012c1:	5d                   	pop    %rbp
+  8012c2:	c3                   	ret
+
+00000000008012c3 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012c3:	55                   	push   %rbp
+  8012c4:	48 89 e5             	mov    %rsp,%rbp
+  8012c7:	53                   	push   %rbx
+  8012c8:	48 89 fa             	mov    %rdi,%rdx
+  8012cb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ce:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e8:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ee:	c9                   	leave
+  8012ef:	c3                   	ret
+
+00000000008012f0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012f0:	55                   	push   %rbp
+  8012f1:	48 89 e5             	mov    %rsp,%rbp
+  8012f4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f5:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801304:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801309:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130e:	be 00 00 00 00       	mov    $0x0,%esi
+  801313:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801319:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80131b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131f:	c9                   	leave
+  801320:	c3                   	ret
+
+0000000000801321 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801321:	55                   	push   %rbp
+  801322:	48 89 e5             	mov    %rsp,%rbp
+  801325:	53                   	push   %rbx
+  801326:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80132a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80132d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801332:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801337:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801341:	be 00 00 00 00       	mov    $0x0,%esi
+  801346:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134e:	48 85 c0             	test   %rax,%rax
+  801351:	7f 06                	jg     801359 <sys_env_destroy+0x38>
+}
+  801353:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801357:	c9                   	leave
+  801358:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801359:	49 89 c0             	mov    %rax,%r8
+  80135c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801361:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801368:	00 00 00 
+  80136b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801370:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801377:	00 00 00 
+  80137a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137f:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  801386:	00 00 00 
+  801389:	41 ff d1             	call   *%r9
+
+000000000080138c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80138c:	55                   	push   %rbp
+  80138d:	48 89 e5             	mov    %rsp,%rbp
+  801390:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801391:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801396:	ba 00 00 00 00       	mov    $0x0,%edx
+  80139b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8013af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b5:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013bb:	c9                   	leave
+  8013bc:	c3                   	ret
+
+00000000008013bd <sys_yield>:
+
+void
+sys_yield(void) {
+  8013bd:	55                   	push   %rbp
+  8013be:	48 89 e5             	mov    %rsp,%rbp
+  8013c1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c2:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013db:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e6:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ec:	c9                   	leave
+  8013ed:	c3                   	ret
+
+00000000008013ee <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013ee:	55                   	push   %rbp
+  8013ef:	48 89 e5             	mov    %rsp,%rbp
+  8013f2:	53                   	push   %rbx
+  8013f3:	48 89 fa             	mov    %rdi,%rdx
+  8013f6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013fe:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801405:	00 00 00 
+  801408:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140d:	be 00 00 00 00       	mov    $0x0,%esi
+  801412:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801418:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80141a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141e:	c9                   	leave
+  80141f:	c3                   	ret
+
+0000000000801420 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801420:	55                   	push   %rbp
+  801421:	48 89 e5             	mov    %rsp,%rbp
+  801424:	53                   	push   %rbx
+  801425:	49 89 f8             	mov    %rdi,%r8
+  801428:	48 89 d3             	mov    %rdx,%rbx
+  80142b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80142e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801433:	4c 89 c2             	mov    %r8,%rdx
+  801436:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801439:	be 00 00 00 00       	mov    $0x0,%esi
+  80143e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801444:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801446:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144a:	c9                   	leave
+  80144b:	c3                   	ret
+
+000000000080144c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80144c:	55                   	push   %rbp
+  80144d:	48 89 e5             	mov    %rsp,%rbp
+  801450:	53                   	push   %rbx
+  801451:	48 83 ec 08          	sub    $0x8,%rsp
+  801455:	89 f8                	mov    %edi,%eax
+  801457:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80145a:	48 63 f9             	movslq %ecx,%rdi
+  80145d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801460:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801465:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801468:	be 00 00 00 00       	mov    $0x0,%esi
+  80146d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801473:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801475:	48 85 c0             	test   %rax,%rax
+  801478:	7f 06                	jg     801480 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80147a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147e:	c9                   	leave
+  80147f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801480:	49 89 c0             	mov    %rax,%r8
+  801483:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801488:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  80148f:	00 00 00 
+  801492:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801497:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80149e:	00 00 00 
+  8014a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a6:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  8014ad:	00 00 00 
+  8014b0:	41 ff d1             	call   *%r9
+
+00000000008014b3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014b3:	55                   	push   %rbp
+  8014b4:	48 89 e5             	mov    %rsp,%rbp
+  8014b7:	53                   	push   %rbx
+  8014b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8014bc:	89 f8                	mov    %edi,%eax
+  8014be:	49 89 f2             	mov    %rsi,%r10
+  8014c1:	48 89 cf             	mov    %rcx,%rdi
+  8014c4:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014c7:	48 63 da             	movslq %edx,%rbx
+  8014ca:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014cd:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014d2:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d5:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014da:	48 85 c0             	test   %rax,%rax
+  8014dd:	7f 06                	jg     8014e5 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e3:	c9                   	leave
+  8014e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e5:	49 89 c0             	mov    %rax,%r8
+  8014e8:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014ed:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  8014f4:	00 00 00 
+  8014f7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8014fc:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801503:	00 00 00 
+  801506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150b:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  801512:	00 00 00 
+  801515:	41 ff d1             	call   *%r9
+
+0000000000801518 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801518:	55                   	push   %rbp
+  801519:	48 89 e5             	mov    %rsp,%rbp
+  80151c:	53                   	push   %rbx
+  80151d:	48 83 ec 08          	sub    $0x8,%rsp
+  801521:	49 89 f9             	mov    %rdi,%r9
+  801524:	89 f0                	mov    %esi,%eax
+  801526:	48 89 d3             	mov    %rdx,%rbx
+  801529:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80152c:	49 63 f0             	movslq %r8d,%rsi
+  80152f:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801532:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801537:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801540:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801542:	48 85 c0             	test   %rax,%rax
+  801545:	7f 06                	jg     80154d <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801547:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154b:	c9                   	leave
+  80154c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154d:	49 89 c0             	mov    %rax,%r8
+  801550:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801555:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  80155c:	00 00 00 
+  80155f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801564:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80156b:	00 00 00 
+  80156e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801573:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  80157a:	00 00 00 
+  80157d:	41 ff d1             	call   *%r9
+
+0000000000801580 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+  801584:	53                   	push   %rbx
+  801585:	89 f8                	mov    %edi,%eax
+  801587:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80158a:	48 63 f9             	movslq %ecx,%rdi
+  80158d:	48 63 da             	movslq %edx,%rbx
+  801590:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801593:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801598:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159b:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a6:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8015a8:	89 c2                	mov    %eax,%edx
+  8015aa:	48 85 c0             	test   %rax,%rax
+  8015ad:	78 0d                	js     8015bc <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8015af:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8015b4:	4d 85 c9             	test   %r9,%r9
+  8015b7:	74 03                	je     8015bc <sys_alloc_dma_region+0x3c>
+  8015b9:	49 89 01             	mov    %rax,(%r9)
+}
+  8015bc:	89 d0                	mov    %edx,%eax
+  8015be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+
+00000000008015c4 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8015c4:	55                   	push   %rbp
+  8015c5:	48 89 e5             	mov    %rsp,%rbp
+  8015c8:	53                   	push   %rbx
+  8015c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8015cd:	48 89 f1             	mov    %rsi,%rcx
+  8015d0:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015d3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d6:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ed:	48 85 c0             	test   %rax,%rax
+  8015f0:	7f 06                	jg     8015f8 <sys_set_cache_region+0x34>
+}
+  8015f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f6:	c9                   	leave
+  8015f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f8:	49 89 c0             	mov    %rax,%r8
+  8015fb:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801600:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801607:	00 00 00 
+  80160a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80160f:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801616:	00 00 00 
+  801619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161e:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  801625:	00 00 00 
+  801628:	41 ff d1             	call   *%r9
+
+000000000080162b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80162b:	55                   	push   %rbp
+  80162c:	48 89 e5             	mov    %rsp,%rbp
+  80162f:	53                   	push   %rbx
+  801630:	48 83 ec 08          	sub    $0x8,%rsp
+  801634:	48 89 f1             	mov    %rsi,%rcx
+  801637:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80163a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80163d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801642:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801647:	be 00 00 00 00       	mov    $0x0,%esi
+  80164c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801652:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801654:	48 85 c0             	test   %rax,%rax
+  801657:	7f 06                	jg     80165f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801659:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80165d:	c9                   	leave
+  80165e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80165f:	49 89 c0             	mov    %rax,%r8
+  801662:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801667:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  80166e:	00 00 00 
+  801671:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801676:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80167d:	00 00 00 
+  801680:	b8 00 00 00 00       	mov    $0x0,%eax
+  801685:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  80168c:	00 00 00 
+  80168f:	41 ff d1             	call   *%r9
+
+0000000000801692 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801692:	55                   	push   %rbp
+  801693:	48 89 e5             	mov    %rsp,%rbp
+  801696:	53                   	push   %rbx
+  801697:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80169b:	48 63 ce             	movslq %esi,%rcx
+  80169e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ab:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016bb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016bd:	48 85 c0             	test   %rax,%rax
+  8016c0:	7f 06                	jg     8016c8 <sys_env_set_status+0x36>
+}
+  8016c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c6:	c9                   	leave
+  8016c7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c8:	49 89 c0             	mov    %rax,%r8
+  8016cb:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8016d0:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  8016d7:	00 00 00 
+  8016da:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016df:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  8016e6:	00 00 00 
+  8016e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ee:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  8016f5:	00 00 00 
+  8016f8:	41 ff d1             	call   *%r9
+
+00000000008016fb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016fb:	55                   	push   %rbp
+  8016fc:	48 89 e5             	mov    %rsp,%rbp
+  8016ff:	53                   	push   %rbx
+  801700:	48 83 ec 08          	sub    $0x8,%rsp
+  801704:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801707:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80170a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80170f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801714:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801719:	be 00 00 00 00       	mov    $0x0,%esi
+  80171e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801724:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801726:	48 85 c0             	test   %rax,%rax
+  801729:	7f 06                	jg     801731 <sys_env_set_trapframe+0x36>
+}
+  80172b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80172f:	c9                   	leave
+  801730:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801731:	49 89 c0             	mov    %rax,%r8
+  801734:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801739:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  801740:	00 00 00 
+  801743:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801748:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80174f:	00 00 00 
+  801752:	b8 00 00 00 00       	mov    $0x0,%eax
+  801757:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  80175e:	00 00 00 
+  801761:	41 ff d1             	call   *%r9
+
+0000000000801764 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801764:	55                   	push   %rbp
+  801765:	48 89 e5             	mov    %rsp,%rbp
+  801768:	53                   	push   %rbx
+  801769:	48 83 ec 08          	sub    $0x8,%rsp
+  80176d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801770:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801773:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801778:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801782:	be 00 00 00 00       	mov    $0x0,%esi
+  801787:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80178d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80178f:	48 85 c0             	test   %rax,%rax
+  801792:	7f 06                	jg     80179a <sys_env_set_pgfault_upcall+0x36>
+}
+  801794:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801798:	c9                   	leave
+  801799:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80179a:	49 89 c0             	mov    %rax,%r8
+  80179d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8017a2:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  8017a9:	00 00 00 
+  8017ac:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017b1:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  8017b8:	00 00 00 
+  8017bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c0:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  8017c7:	00 00 00 
+  8017ca:	41 ff d1             	call   *%r9
+
+00000000008017cd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+  8017d1:	53                   	push   %rbx
+  8017d2:	89 f8                	mov    %edi,%eax
+  8017d4:	49 89 f1             	mov    %rsi,%r9
+  8017d7:	48 89 d3             	mov    %rdx,%rbx
+  8017da:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017dd:	49 63 f0             	movslq %r8d,%rsi
+  8017e0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e3:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017e8:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f1:	cd 30                	int    $0x30
+}
+  8017f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f7:	c9                   	leave
+  8017f8:	c3                   	ret
+
+00000000008017f9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017f9:	55                   	push   %rbp
+  8017fa:	48 89 e5             	mov    %rsp,%rbp
+  8017fd:	53                   	push   %rbx
+  8017fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801802:	48 89 fa             	mov    %rdi,%rdx
+  801805:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801808:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80180d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801812:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801817:	be 00 00 00 00       	mov    $0x0,%esi
+  80181c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801822:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801824:	48 85 c0             	test   %rax,%rax
+  801827:	7f 06                	jg     80182f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801829:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182d:	c9                   	leave
+  80182e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80182f:	49 89 c0             	mov    %rax,%r8
+  801832:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801837:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  80183e:	00 00 00 
+  801841:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801846:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  80184d:	00 00 00 
+  801850:	b8 00 00 00 00       	mov    $0x0,%eax
+  801855:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  80185c:	00 00 00 
+  80185f:	41 ff d1             	call   *%r9
+
+0000000000801862 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801862:	55                   	push   %rbp
+  801863:	48 89 e5             	mov    %rsp,%rbp
+  801866:	53                   	push   %rbx
+  801867:	48 89 fa             	mov    %rdi,%rdx
+  80186a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80186d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801872:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801877:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80187c:	be 00 00 00 00       	mov    $0x0,%esi
+  801881:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801887:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801889:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80188d:	c9                   	leave
+  80188e:	c3                   	ret
+
+000000000080188f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80188f:	55                   	push   %rbp
+  801890:	48 89 e5             	mov    %rsp,%rbp
+  801893:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801894:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801899:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018b8:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018be:	c9                   	leave
+  8018bf:	c3                   	ret
+
+00000000008018c0 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8018c0:	48 85 ff             	test   %rdi,%rdi
+  8018c3:	0f 84 b6 01 00 00    	je     801a7f <malloc+0x1bf>
+malloc(size_t size) {
+  8018c9:	55                   	push   %rbp
+  8018ca:	48 89 e5             	mov    %rsp,%rbp
+  8018cd:	41 56                	push   %r14
+  8018cf:	41 55                	push   %r13
+  8018d1:	41 54                	push   %r12
+  8018d3:	53                   	push   %rbx
+  8018d4:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8018d7:	48 b8 28 70 c0 00 00 	movabs $0xc07028,%rax
+  8018de:	00 00 00 
+  8018e1:	4c 8b 20             	mov    (%rax),%r12
+  8018e4:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  8018eb:	0f 87 94 01 00 00    	ja     801a85 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  8018f1:	48 a1 20 70 c0 00 00 	movabs 0xc07020,%rax
+  8018f8:	00 00 00 
+  8018fb:	48 85 c0             	test   %rax,%rax
+  8018fe:	74 6b                	je     80196b <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801900:	4d 85 e4             	test   %r12,%r12
+  801903:	74 66                	je     80196b <malloc+0xab>
+  801905:	48 ba 48 70 c0 00 00 	movabs $0xc07048,%rdx
+  80190c:	00 00 00 
+  80190f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801914:	eb 0d                	jmp    801923 <malloc+0x63>
+  801916:	48 83 c1 01          	add    $0x1,%rcx
+  80191a:	48 83 c2 18          	add    $0x18,%rdx
+  80191e:	49 39 cc             	cmp    %rcx,%r12
+  801921:	74 48                	je     80196b <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801923:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801928:	74 ec                	je     801916 <malloc+0x56>
+  80192a:	48 39 1a             	cmp    %rbx,(%rdx)
+  80192d:	72 e7                	jb     801916 <malloc+0x56>
+                real_freep_size--;
+  80192f:	48 83 e8 01          	sub    $0x1,%rax
+  801933:	48 a3 20 70 c0 00 00 	movabs %rax,0xc07020
+  80193a:	00 00 00 
+                freep[i].is_free = false;
+  80193d:	48 ba 40 70 c0 00 00 	movabs $0xc07040,%rdx
+  801944:	00 00 00 
+  801947:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  80194b:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  80194f:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801953:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  80195a:	00 
+                freep[i].size = size;
+  80195b:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  80195f:	48 01 c8             	add    %rcx,%rax
+  801962:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801966:	e9 0b 01 00 00       	jmp    801a76 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  80196b:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801972:	00 00 00 
+  801975:	48 01 d8             	add    %rbx,%rax
+  801978:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  80197e:	76 7c                	jbe    8019fc <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801980:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801987:	00 00 00 
+  80198a:	4c 8b 30             	mov    (%rax),%r14
+  80198d:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801994:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801997:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  80199e:	00 00 00 
+  8019a1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  8019a8:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  8019af:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8019b5:	4c 0f 45 eb          	cmovne %rbx,%r13
+  8019b9:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  8019c0:	00 00 00 
+  8019c3:	ff d0                	call   *%rax
+  8019c5:	89 c7                	mov    %eax,%edi
+  8019c7:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  8019ce:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8019d5:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  8019dc:	00 00 00 
+  8019df:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  8019e3:	b9 26 00 00 00       	mov    $0x26,%ecx
+  8019e8:	48 b8 4c 14 80 00 00 	movabs $0x80144c,%rax
+  8019ef:	00 00 00 
+  8019f2:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  8019f4:	85 c0                	test   %eax,%eax
+  8019f6:	0f 88 90 00 00 00    	js     801a8c <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  8019fc:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801a03:	00 00 00 
+  801a06:	48 8b 31             	mov    (%rcx),%rsi
+  801a09:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801a10:	00 00 00 
+  801a13:	4c 8b 07             	mov    (%rdi),%r8
+  801a16:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801a1a:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801a21:	00 00 00 
+  801a24:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801a28:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801a2c:	48 b8 40 70 c0 00 00 	movabs $0xc07040,%rax
+  801a33:	00 00 00 
+  801a36:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801a3a:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801a3d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801a41:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801a48:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801a49:	48 89 d8             	mov    %rbx,%rax
+  801a4c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a51:	4c 01 c0             	add    %r8,%rax
+  801a54:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801a57:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801a5e:	48 01 f3             	add    %rsi,%rbx
+  801a61:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801a64:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801a69:	48 a3 28 70 c0 00 00 	movabs %rax,0xc07028
+  801a70:	00 00 00 
+  801a73:	48 89 d0             	mov    %rdx,%rax
+}
+  801a76:	5b                   	pop    %rbx
+  801a77:	41 5c                	pop    %r12
+  801a79:	41 5d                	pop    %r13
+  801a7b:	41 5e                	pop    %r14
+  801a7d:	5d                   	pop    %rbp
+  801a7e:	c3                   	ret
+        return NULL;
+  801a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a84:	c3                   	ret
+        return NULL;
+  801a85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a8a:	eb ea                	jmp    801a76 <malloc+0x1b6>
+            return NULL;
+  801a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a91:	eb e3                	jmp    801a76 <malloc+0x1b6>
+
+0000000000801a93 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801a93:	55                   	push   %rbp
+  801a94:	48 89 e5             	mov    %rsp,%rbp
+  801a97:	53                   	push   %rbx
+  801a98:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801a9c:	48 89 fb             	mov    %rdi,%rbx
+  801a9f:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801aa3:	48 89 df             	mov    %rbx,%rdi
+  801aa6:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  801aad:	00 00 00 
+  801ab0:	ff d0                	call   *%rax
+  801ab2:	48 89 c7             	mov    %rax,%rdi
+  801ab5:	48 89 da             	mov    %rbx,%rdx
+  801ab8:	be 00 00 00 00       	mov    $0x0,%esi
+  801abd:	48 b8 cc 0f 80 00 00 	movabs $0x800fcc,%rax
+  801ac4:	00 00 00 
+  801ac7:	ff d0                	call   *%rax
+}
+  801ac9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801acd:	c9                   	leave
+  801ace:	c3                   	ret
+
+0000000000801acf <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801acf:	48 a1 28 70 c0 00 00 	movabs 0xc07028,%rax
+  801ad6:	00 00 00 
+  801ad9:	48 ba 20 70 c0 00 00 	movabs $0xc07020,%rdx
+  801ae0:	00 00 00 
+  801ae3:	48 3b 02             	cmp    (%rdx),%rax
+  801ae6:	74 4d                	je     801b35 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801ae8:	48 85 c0             	test   %rax,%rax
+  801aeb:	74 4d                	je     801b3a <get_allocsize+0x6b>
+  801aed:	48 b9 40 70 c0 00 00 	movabs $0xc07040,%rcx
+  801af4:	00 00 00 
+  801af7:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801afc:	48 3b 39             	cmp    (%rcx),%rdi
+  801aff:	74 13                	je     801b14 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801b01:	48 83 c2 01          	add    $0x1,%rdx
+  801b05:	48 83 c1 18          	add    $0x18,%rcx
+  801b09:	48 39 d0             	cmp    %rdx,%rax
+  801b0c:	75 ee                	jne    801afc <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b13:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801b14:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1d:	48 be 40 70 c0 00 00 	movabs $0xc07040,%rsi
+  801b24:	00 00 00 
+  801b27:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801b2d:	75 0b                	jne    801b3a <get_allocsize+0x6b>
+  801b2f:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801b34:	c3                   	ret
+        return 0;
+  801b35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b3a:	c3                   	ret
+
+0000000000801b3b <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801b3b:	48 85 ff             	test   %rdi,%rdi
+  801b3e:	0f 84 01 01 00 00    	je     801c45 <free+0x10a>
+free(void *ptr) {
+  801b44:	55                   	push   %rbp
+  801b45:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801b48:	48 b8 28 70 c0 00 00 	movabs $0xc07028,%rax
+  801b4f:	00 00 00 
+  801b52:	48 8b 30             	mov    (%rax),%rsi
+  801b55:	48 a1 20 70 c0 00 00 	movabs 0xc07020,%rax
+  801b5c:	00 00 00 
+  801b5f:	48 39 c6             	cmp    %rax,%rsi
+  801b62:	74 50                	je     801bb4 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801b64:	48 85 f6             	test   %rsi,%rsi
+  801b67:	74 21                	je     801b8a <free+0x4f>
+  801b69:	48 b9 40 70 c0 00 00 	movabs $0xc07040,%rcx
+  801b70:	00 00 00 
+  801b73:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801b78:	48 3b 39             	cmp    (%rcx),%rdi
+  801b7b:	74 61                	je     801bde <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801b7d:	48 83 c2 01          	add    $0x1,%rdx
+  801b81:	48 83 c1 18          	add    $0x18,%rcx
+  801b85:	48 39 d6             	cmp    %rdx,%rsi
+  801b88:	75 ee                	jne    801b78 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801b8a:	48 ba 70 56 80 00 00 	movabs $0x805670,%rdx
+  801b91:	00 00 00 
+  801b94:	be 12 01 00 00       	mov    $0x112,%esi
+  801b99:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801ba0:	00 00 00 
+  801ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba8:	48 b9 24 02 80 00 00 	movabs $0x800224,%rcx
+  801baf:	00 00 00 
+  801bb2:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801bb4:	48 ba 20 56 80 00 00 	movabs $0x805620,%rdx
+  801bbb:	00 00 00 
+  801bbe:	be 06 01 00 00       	mov    $0x106,%esi
+  801bc3:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801bca:	00 00 00 
+  801bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd2:	48 b9 24 02 80 00 00 	movabs $0x800224,%rcx
+  801bd9:	00 00 00 
+  801bdc:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801bde:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801be2:	48 be 40 70 c0 00 00 	movabs $0xc07040,%rsi
+  801be9:	00 00 00 
+  801bec:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801bf2:	75 27                	jne    801c1b <free+0xe0>
+            freep[i].is_free = true;
+  801bf4:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801bf8:	48 ba 40 70 c0 00 00 	movabs $0xc07040,%rdx
+  801bff:	00 00 00 
+  801c02:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801c09:	00 00 
+            real_freep_size++;
+  801c0b:	48 83 c0 01          	add    $0x1,%rax
+  801c0f:	48 a3 20 70 c0 00 00 	movabs %rax,0xc07020
+  801c16:	00 00 00 
+}
+  801c19:	5d                   	pop    %rbp
+  801c1a:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801c1b:	48 ba 48 56 80 00 00 	movabs $0x805648,%rdx
+  801c22:	00 00 00 
+  801c25:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801c2a:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  801c31:	00 00 00 
+  801c34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c39:	48 b9 24 02 80 00 00 	movabs $0x800224,%rcx
+  801c40:	00 00 00 
+  801c43:	ff d1                	call   *%rcx
+  801c45:	c3                   	ret
+
+0000000000801c46 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801c46:	55                   	push   %rbp
+  801c47:	48 89 e5             	mov    %rsp,%rbp
+  801c4a:	41 55                	push   %r13
+  801c4c:	41 54                	push   %r12
+  801c4e:	53                   	push   %rbx
+  801c4f:	48 83 ec 08          	sub    $0x8,%rsp
+  801c53:	48 89 fb             	mov    %rdi,%rbx
+  801c56:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801c59:	48 b8 cf 1a 80 00 00 	movabs $0x801acf,%rax
+  801c60:	00 00 00 
+  801c63:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801c65:	49 39 c5             	cmp    %rax,%r13
+  801c68:	73 0e                	jae    801c78 <realloc+0x32>
+}
+  801c6a:	48 89 d8             	mov    %rbx,%rax
+  801c6d:	48 83 c4 08          	add    $0x8,%rsp
+  801c71:	5b                   	pop    %rbx
+  801c72:	41 5c                	pop    %r12
+  801c74:	41 5d                	pop    %r13
+  801c76:	5d                   	pop    %rbp
+  801c77:	c3                   	ret
+  801c78:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801c7b:	4c 89 ef             	mov    %r13,%rdi
+  801c7e:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  801c85:	00 00 00 
+  801c88:	ff d0                	call   *%rax
+  801c8a:	48 89 c7             	mov    %rax,%rdi
+  801c8d:	4c 89 e2             	mov    %r12,%rdx
+  801c90:	48 89 de             	mov    %rbx,%rsi
+  801c93:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  801c9a:	00 00 00 
+  801c9d:	ff d0                	call   *%rax
+  801c9f:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801ca2:	48 89 df             	mov    %rbx,%rdi
+  801ca5:	48 b8 3b 1b 80 00 00 	movabs $0x801b3b,%rax
+  801cac:	00 00 00 
+  801caf:	ff d0                	call   *%rax
+    return newptr;
+  801cb1:	4c 89 e3             	mov    %r12,%rbx
+  801cb4:	eb b4                	jmp    801c6a <realloc+0x24>
+
+0000000000801cb6 <strdup>:
+
+char*
+strdup (const char *src) {
+  801cb6:	55                   	push   %rbp
+  801cb7:	48 89 e5             	mov    %rsp,%rbp
+  801cba:	41 54                	push   %r12
+  801cbc:	53                   	push   %rbx
+  801cbd:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801cc0:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  801cc7:	00 00 00 
+  801cca:	ff d0                	call   *%rax
+  801ccc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801cd0:	4c 89 e7             	mov    %r12,%rdi
+  801cd3:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  801cda:	00 00 00 
+  801cdd:	ff d0                	call   *%rax
+  801cdf:	48 89 c7             	mov    %rax,%rdi
+  801ce2:	4c 89 e2             	mov    %r12,%rdx
+  801ce5:	48 89 de             	mov    %rbx,%rsi
+  801ce8:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  801cef:	00 00 00 
+  801cf2:	ff d0                	call   *%rax
+}
+  801cf4:	5b                   	pop    %rbx
+  801cf5:	41 5c                	pop    %r12
+  801cf7:	5d                   	pop    %rbp
+  801cf8:	c3                   	ret
+
+0000000000801cf9 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801cf9:	55                   	push   %rbp
+  801cfa:	48 89 e5             	mov    %rsp,%rbp
+  801cfd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cfe:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d08:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d12:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d17:	be 00 00 00 00       	mov    $0x0,%esi
+  801d1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d22:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d24:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d28:	c9                   	leave
+  801d29:	c3                   	ret
+
+0000000000801d2a <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801d2a:	55                   	push   %rbp
+  801d2b:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801d2e:	48 b8 40 70 d8 00 00 	movabs $0xd87040,%rax
+  801d35:	00 00 00 
+  801d38:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d3c:	74 26                	je     801d64 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801d3e:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d40:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d44:	89 c0                	mov    %eax,%eax
+  801d46:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801d49:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801d50:	48 b9 40 70 d8 00 00 	movabs $0xd87040,%rcx
+  801d57:	00 00 00 
+  801d5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5f:	48 f7 31             	divq   (%rcx)
+}
+  801d62:	5d                   	pop    %rbp
+  801d63:	c3                   	ret
+        freq = get_cpufreq();
+  801d64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d69:	48 ba f9 1c 80 00 00 	movabs $0x801cf9,%rdx
+  801d70:	00 00 00 
+  801d73:	ff d2                	call   *%rdx
+  801d75:	48 a3 40 70 d8 00 00 	movabs %rax,0xd87040
+  801d7c:	00 00 00 
+  801d7f:	eb bd                	jmp    801d3e <get_ticks+0x14>
+
+0000000000801d81 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801d81:	55                   	push   %rbp
+  801d82:	48 89 e5             	mov    %rsp,%rbp
+  801d85:	53                   	push   %rbx
+  801d86:	48 83 ec 08          	sub    $0x8,%rsp
+  801d8a:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801d8d:	48 b8 40 70 d8 00 00 	movabs $0xd87040,%rax
+  801d94:	00 00 00 
+  801d97:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801d9b:	74 50                	je     801ded <sleep+0x6c>
+    asm volatile("rdtsc"
+  801d9d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801d9f:	48 c1 e2 20          	shl    $0x20,%rdx
+  801da3:	89 c0                	mov    %eax,%eax
+  801da5:	48 89 d6             	mov    %rdx,%rsi
+  801da8:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801dab:	48 b8 40 70 d8 00 00 	movabs $0xd87040,%rax
+  801db2:	00 00 00 
+  801db5:	48 0f af 18          	imul   (%rax),%rbx
+  801db9:	48 c1 eb 03          	shr    $0x3,%rbx
+  801dbd:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801dc4:	9b c4 20 
+  801dc7:	48 89 d8             	mov    %rbx,%rax
+  801dca:	48 f7 e2             	mul    %rdx
+  801dcd:	48 89 d1             	mov    %rdx,%rcx
+  801dd0:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801dd4:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801dd6:	48 c1 e2 20          	shl    $0x20,%rdx
+  801dda:	89 c0                	mov    %eax,%eax
+  801ddc:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801ddf:	48 29 f2             	sub    %rsi,%rdx
+  801de2:	48 39 ca             	cmp    %rcx,%rdx
+  801de5:	72 ed                	jb     801dd4 <sleep+0x53>
+}
+  801de7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801deb:	c9                   	leave
+  801dec:	c3                   	ret
+        freq = get_cpufreq();
+  801ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df2:	48 ba f9 1c 80 00 00 	movabs $0x801cf9,%rdx
+  801df9:	00 00 00 
+  801dfc:	ff d2                	call   *%rdx
+  801dfe:	48 a3 40 70 d8 00 00 	movabs %rax,0xd87040
+  801e05:	00 00 00 
+  801e08:	eb 93                	jmp    801d9d <sleep+0x1c>
+
+0000000000801e0a <poll_kbd>:
+
+int poll_kbd() {
+  801e0a:	55                   	push   %rbp
+  801e0b:	48 89 e5             	mov    %rsp,%rbp
+  801e0e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e0f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e14:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e19:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e23:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e28:	be 00 00 00 00       	mov    $0x0,%esi
+  801e2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e33:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e35:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e39:	c9                   	leave
+  801e3a:	c3                   	ret
+
+0000000000801e3b <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801e3b:	55                   	push   %rbp
+  801e3c:	48 89 e5             	mov    %rsp,%rbp
+  801e3f:	53                   	push   %rbx
+  801e40:	49 89 fa             	mov    %rdi,%r10
+  801e43:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801e45:	44 89 c6             	mov    %r8d,%esi
+  801e48:	89 cf                	mov    %ecx,%edi
+  801e4a:	89 d3                	mov    %edx,%ebx
+  801e4c:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801e4e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e53:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e56:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801e5a:	cd 30                	int    $0x30
+  801e5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e60:	c9                   	leave
+  801e61:	c3                   	ret
+
+0000000000801e62 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e62:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e69:	ff ff ff 
+  801e6c:	48 01 f8             	add    %rdi,%rax
+  801e6f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801e73:	c3                   	ret
+
+0000000000801e74 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e74:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801e7b:	ff ff ff 
+  801e7e:	48 01 f8             	add    %rdi,%rax
+  801e81:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801e85:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801e8b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801e8f:	c3                   	ret
+
+0000000000801e90 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801e90:	55                   	push   %rbp
+  801e91:	48 89 e5             	mov    %rsp,%rbp
+  801e94:	41 57                	push   %r15
+  801e96:	41 56                	push   %r14
+  801e98:	41 55                	push   %r13
+  801e9a:	41 54                	push   %r12
+  801e9c:	53                   	push   %rbx
+  801e9d:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea1:	49 89 ff             	mov    %rdi,%r15
+  801ea4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ea9:	49 bd 44 3d 80 00 00 	movabs $0x803d44,%r13
+  801eb0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801eb3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801eb9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801ebc:	48 89 df             	mov    %rbx,%rdi
+  801ebf:	41 ff d5             	call   *%r13
+  801ec2:	83 e0 04             	and    $0x4,%eax
+  801ec5:	74 17                	je     801ede <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801ec7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801ece:	4c 39 f3             	cmp    %r14,%rbx
+  801ed1:	75 e6                	jne    801eb9 <fd_alloc+0x29>
+  801ed3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801ed9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801ede:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ee1:	48 83 c4 08          	add    $0x8,%rsp
+  801ee5:	5b                   	pop    %rbx
+  801ee6:	41 5c                	pop    %r12
+  801ee8:	41 5d                	pop    %r13
+  801eea:	41 5e                	pop    %r14
+  801eec:	41 5f                	pop    %r15
+  801eee:	5d                   	pop    %rbp
+  801eef:	c3                   	ret
+
+0000000000801ef0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801ef0:	83 ff 1f             	cmp    $0x1f,%edi
+  801ef3:	77 39                	ja     801f2e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ef5:	55                   	push   %rbp
+  801ef6:	48 89 e5             	mov    %rsp,%rbp
+  801ef9:	41 54                	push   %r12
+  801efb:	53                   	push   %rbx
+  801efc:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801eff:	48 63 df             	movslq %edi,%rbx
+  801f02:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801f09:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801f0d:	48 89 df             	mov    %rbx,%rdi
+  801f10:	48 b8 44 3d 80 00 00 	movabs $0x803d44,%rax
+  801f17:	00 00 00 
+  801f1a:	ff d0                	call   *%rax
+  801f1c:	a8 04                	test   $0x4,%al
+  801f1e:	74 14                	je     801f34 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801f20:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801f24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f29:	5b                   	pop    %rbx
+  801f2a:	41 5c                	pop    %r12
+  801f2c:	5d                   	pop    %rbp
+  801f2d:	c3                   	ret
+        return -E_INVAL;
+  801f2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801f33:	c3                   	ret
+        return -E_INVAL;
+  801f34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f39:	eb ee                	jmp    801f29 <fd_lookup+0x39>
+
+0000000000801f3b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801f3b:	55                   	push   %rbp
+  801f3c:	48 89 e5             	mov    %rsp,%rbp
+  801f3f:	41 54                	push   %r12
+  801f41:	53                   	push   %rbx
+  801f42:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801f45:	48 b8 40 57 80 00 00 	movabs $0x805740,%rax
+  801f4c:	00 00 00 
+  801f4f:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801f56:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801f59:	39 3b                	cmp    %edi,(%rbx)
+  801f5b:	74 47                	je     801fa4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801f5d:	48 83 c0 08          	add    $0x8,%rax
+  801f61:	48 8b 18             	mov    (%rax),%rbx
+  801f64:	48 85 db             	test   %rbx,%rbx
+  801f67:	75 f0                	jne    801f59 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801f69:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  801f70:	00 00 00 
+  801f73:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f79:	89 fa                	mov    %edi,%edx
+  801f7b:	48 bf a8 56 80 00 00 	movabs $0x8056a8,%rdi
+  801f82:	00 00 00 
+  801f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f8a:	48 b9 74 03 80 00 00 	movabs $0x800374,%rcx
+  801f91:	00 00 00 
+  801f94:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801f96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801f9b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801f9f:	5b                   	pop    %rbx
+  801fa0:	41 5c                	pop    %r12
+  801fa2:	5d                   	pop    %rbp
+  801fa3:	c3                   	ret
+            return 0;
+  801fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa9:	eb f0                	jmp    801f9b <dev_lookup+0x60>
+
+0000000000801fab <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801fab:	55                   	push   %rbp
+  801fac:	48 89 e5             	mov    %rsp,%rbp
+  801faf:	41 55                	push   %r13
+  801fb1:	41 54                	push   %r12
+  801fb3:	53                   	push   %rbx
+  801fb4:	48 83 ec 18          	sub    $0x18,%rsp
+  801fb8:	48 89 fb             	mov    %rdi,%rbx
+  801fbb:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801fbe:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801fc5:	ff ff ff 
+  801fc8:	48 01 df             	add    %rbx,%rdi
+  801fcb:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801fcf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fd3:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  801fda:	00 00 00 
+  801fdd:	ff d0                	call   *%rax
+  801fdf:	41 89 c5             	mov    %eax,%r13d
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	78 06                	js     801fec <fd_close+0x41>
+  801fe6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801fea:	74 1a                	je     802006 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801fec:	45 84 e4             	test   %r12b,%r12b
+  801fef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ff8:	44 89 e8             	mov    %r13d,%eax
+  801ffb:	48 83 c4 18          	add    $0x18,%rsp
+  801fff:	5b                   	pop    %rbx
+  802000:	41 5c                	pop    %r12
+  802002:	41 5d                	pop    %r13
+  802004:	5d                   	pop    %rbp
+  802005:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802006:	8b 3b                	mov    (%rbx),%edi
+  802008:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80200c:	48 b8 3b 1f 80 00 00 	movabs $0x801f3b,%rax
+  802013:	00 00 00 
+  802016:	ff d0                	call   *%rax
+  802018:	41 89 c5             	mov    %eax,%r13d
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	78 1b                	js     80203a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80201f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802023:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802027:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80202d:	48 85 c0             	test   %rax,%rax
+  802030:	74 08                	je     80203a <fd_close+0x8f>
+  802032:	48 89 df             	mov    %rbx,%rdi
+  802035:	ff d0                	call   *%rax
+  802037:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80203a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80203f:	48 89 de             	mov    %rbx,%rsi
+  802042:	bf 00 00 00 00       	mov    $0x0,%edi
+  802047:	48 b8 2b 16 80 00 00 	movabs $0x80162b,%rax
+  80204e:	00 00 00 
+  802051:	ff d0                	call   *%rax
+    return res;
+  802053:	eb a3                	jmp    801ff8 <fd_close+0x4d>
+
+0000000000802055 <close>:
+
+int
+close(int fdnum) {
+  802055:	55                   	push   %rbp
+  802056:	48 89 e5             	mov    %rsp,%rbp
+  802059:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80205d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802061:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  802068:	00 00 00 
+  80206b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	78 15                	js     802086 <close+0x31>
+
+    return fd_close(fd, 1);
+  802071:	be 01 00 00 00       	mov    $0x1,%esi
+  802076:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80207a:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  802081:	00 00 00 
+  802084:	ff d0                	call   *%rax
+}
+  802086:	c9                   	leave
+  802087:	c3                   	ret
+
+0000000000802088 <close_all>:
+
+void
+close_all(void) {
+  802088:	55                   	push   %rbp
+  802089:	48 89 e5             	mov    %rsp,%rbp
+  80208c:	41 54                	push   %r12
+  80208e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80208f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802094:	49 bc 55 20 80 00 00 	movabs $0x802055,%r12
+  80209b:	00 00 00 
+  80209e:	89 df                	mov    %ebx,%edi
+  8020a0:	41 ff d4             	call   *%r12
+  8020a3:	83 c3 01             	add    $0x1,%ebx
+  8020a6:	83 fb 20             	cmp    $0x20,%ebx
+  8020a9:	75 f3                	jne    80209e <close_all+0x16>
+}
+  8020ab:	5b                   	pop    %rbx
+  8020ac:	41 5c                	pop    %r12
+  8020ae:	5d                   	pop    %rbp
+  8020af:	c3                   	ret
+
+00000000008020b0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8020b0:	55                   	push   %rbp
+  8020b1:	48 89 e5             	mov    %rsp,%rbp
+  8020b4:	41 57                	push   %r15
+  8020b6:	41 56                	push   %r14
+  8020b8:	41 55                	push   %r13
+  8020ba:	41 54                	push   %r12
+  8020bc:	53                   	push   %rbx
+  8020bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8020c1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8020c4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8020c8:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  8020cf:	00 00 00 
+  8020d2:	ff d0                	call   *%rax
+  8020d4:	89 c3                	mov    %eax,%ebx
+  8020d6:	85 c0                	test   %eax,%eax
+  8020d8:	0f 88 b8 00 00 00    	js     802196 <dup+0xe6>
+    close(newfdnum);
+  8020de:	44 89 e7             	mov    %r12d,%edi
+  8020e1:	48 b8 55 20 80 00 00 	movabs $0x802055,%rax
+  8020e8:	00 00 00 
+  8020eb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8020ed:	4d 63 ec             	movslq %r12d,%r13
+  8020f0:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8020f7:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8020fb:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8020ff:	4c 89 ff             	mov    %r15,%rdi
+  802102:	49 be 74 1e 80 00 00 	movabs $0x801e74,%r14
+  802109:	00 00 00 
+  80210c:	41 ff d6             	call   *%r14
+  80210f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802112:	4c 89 ef             	mov    %r13,%rdi
+  802115:	41 ff d6             	call   *%r14
+  802118:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80211b:	48 89 df             	mov    %rbx,%rdi
+  80211e:	48 b8 44 3d 80 00 00 	movabs $0x803d44,%rax
+  802125:	00 00 00 
+  802128:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80212a:	a8 04                	test   $0x4,%al
+  80212c:	74 2b                	je     802159 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80212e:	41 89 c1             	mov    %eax,%r9d
+  802131:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802137:	4c 89 f1             	mov    %r14,%rcx
+  80213a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213f:	48 89 de             	mov    %rbx,%rsi
+  802142:	bf 00 00 00 00       	mov    $0x0,%edi
+  802147:	48 b8 b3 14 80 00 00 	movabs $0x8014b3,%rax
+  80214e:	00 00 00 
+  802151:	ff d0                	call   *%rax
+  802153:	89 c3                	mov    %eax,%ebx
+  802155:	85 c0                	test   %eax,%eax
+  802157:	78 4e                	js     8021a7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802159:	4c 89 ff             	mov    %r15,%rdi
+  80215c:	48 b8 44 3d 80 00 00 	movabs $0x803d44,%rax
+  802163:	00 00 00 
+  802166:	ff d0                	call   *%rax
+  802168:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80216b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802171:	4c 89 e9             	mov    %r13,%rcx
+  802174:	ba 00 00 00 00       	mov    $0x0,%edx
+  802179:	4c 89 fe             	mov    %r15,%rsi
+  80217c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802181:	48 b8 b3 14 80 00 00 	movabs $0x8014b3,%rax
+  802188:	00 00 00 
+  80218b:	ff d0                	call   *%rax
+  80218d:	89 c3                	mov    %eax,%ebx
+  80218f:	85 c0                	test   %eax,%eax
+  802191:	78 14                	js     8021a7 <dup+0xf7>
+
+    return newfdnum;
+  802193:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802196:	89 d8                	mov    %ebx,%eax
+  802198:	48 83 c4 18          	add    $0x18,%rsp
+  80219c:	5b                   	pop    %rbx
+  80219d:	41 5c                	pop    %r12
+  80219f:	41 5d                	pop    %r13
+  8021a1:	41 5e                	pop    %r14
+  8021a3:	41 5f                	pop    %r15
+  8021a5:	5d                   	pop    %rbp
+  8021a6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8021a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021ac:	4c 89 ee             	mov    %r13,%rsi
+  8021af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b4:	49 bc 2b 16 80 00 00 	movabs $0x80162b,%r12
+  8021bb:	00 00 00 
+  8021be:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8021c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021c6:	4c 89 f6             	mov    %r14,%rsi
+  8021c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021ce:	41 ff d4             	call   *%r12
+    return res;
+  8021d1:	eb c3                	jmp    802196 <dup+0xe6>
+
+00000000008021d3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8021d3:	55                   	push   %rbp
+  8021d4:	48 89 e5             	mov    %rsp,%rbp
+  8021d7:	41 56                	push   %r14
+  8021d9:	41 55                	push   %r13
+  8021db:	41 54                	push   %r12
+  8021dd:	53                   	push   %rbx
+  8021de:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e2:	89 fb                	mov    %edi,%ebx
+  8021e4:	49 89 f4             	mov    %rsi,%r12
+  8021e7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021ea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021ee:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  8021f5:	00 00 00 
+  8021f8:	ff d0                	call   *%rax
+  8021fa:	85 c0                	test   %eax,%eax
+  8021fc:	78 4c                	js     80224a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021fe:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802202:	41 8b 3e             	mov    (%r14),%edi
+  802205:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802209:	48 b8 3b 1f 80 00 00 	movabs $0x801f3b,%rax
+  802210:	00 00 00 
+  802213:	ff d0                	call   *%rax
+  802215:	85 c0                	test   %eax,%eax
+  802217:	78 35                	js     80224e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802219:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80221d:	83 e0 03             	and    $0x3,%eax
+  802220:	83 f8 01             	cmp    $0x1,%eax
+  802223:	74 2d                	je     802252 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802225:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802229:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80222d:	48 85 c0             	test   %rax,%rax
+  802230:	74 56                	je     802288 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802232:	4c 89 ea             	mov    %r13,%rdx
+  802235:	4c 89 e6             	mov    %r12,%rsi
+  802238:	4c 89 f7             	mov    %r14,%rdi
+  80223b:	ff d0                	call   *%rax
+}
+  80223d:	48 83 c4 10          	add    $0x10,%rsp
+  802241:	5b                   	pop    %rbx
+  802242:	41 5c                	pop    %r12
+  802244:	41 5d                	pop    %r13
+  802246:	41 5e                	pop    %r14
+  802248:	5d                   	pop    %rbp
+  802249:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80224a:	48 98                	cltq
+  80224c:	eb ef                	jmp    80223d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80224e:	48 98                	cltq
+  802250:	eb eb                	jmp    80223d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802252:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  802259:	00 00 00 
+  80225c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802262:	89 da                	mov    %ebx,%edx
+  802264:	48 bf e9 56 80 00 00 	movabs $0x8056e9,%rdi
+  80226b:	00 00 00 
+  80226e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802273:	48 b9 74 03 80 00 00 	movabs $0x800374,%rcx
+  80227a:	00 00 00 
+  80227d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80227f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802286:	eb b5                	jmp    80223d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802288:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80228f:	eb ac                	jmp    80223d <read+0x6a>
+
+0000000000802291 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802291:	55                   	push   %rbp
+  802292:	48 89 e5             	mov    %rsp,%rbp
+  802295:	41 57                	push   %r15
+  802297:	41 56                	push   %r14
+  802299:	41 55                	push   %r13
+  80229b:	41 54                	push   %r12
+  80229d:	53                   	push   %rbx
+  80229e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8022a2:	48 85 d2             	test   %rdx,%rdx
+  8022a5:	74 54                	je     8022fb <readn+0x6a>
+  8022a7:	41 89 fd             	mov    %edi,%r13d
+  8022aa:	49 89 f6             	mov    %rsi,%r14
+  8022ad:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8022b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8022b5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8022ba:	49 bf d3 21 80 00 00 	movabs $0x8021d3,%r15
+  8022c1:	00 00 00 
+  8022c4:	4c 89 e2             	mov    %r12,%rdx
+  8022c7:	48 29 f2             	sub    %rsi,%rdx
+  8022ca:	4c 01 f6             	add    %r14,%rsi
+  8022cd:	44 89 ef             	mov    %r13d,%edi
+  8022d0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8022d3:	85 c0                	test   %eax,%eax
+  8022d5:	78 20                	js     8022f7 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8022d7:	01 c3                	add    %eax,%ebx
+  8022d9:	85 c0                	test   %eax,%eax
+  8022db:	74 08                	je     8022e5 <readn+0x54>
+  8022dd:	48 63 f3             	movslq %ebx,%rsi
+  8022e0:	4c 39 e6             	cmp    %r12,%rsi
+  8022e3:	72 df                	jb     8022c4 <readn+0x33>
+    }
+    return res;
+  8022e5:	48 63 c3             	movslq %ebx,%rax
+}
+  8022e8:	48 83 c4 08          	add    $0x8,%rsp
+  8022ec:	5b                   	pop    %rbx
+  8022ed:	41 5c                	pop    %r12
+  8022ef:	41 5d                	pop    %r13
+  8022f1:	41 5e                	pop    %r14
+  8022f3:	41 5f                	pop    %r15
+  8022f5:	5d                   	pop    %rbp
+  8022f6:	c3                   	ret
+        if (inc < 0) return inc;
+  8022f7:	48 98                	cltq
+  8022f9:	eb ed                	jmp    8022e8 <readn+0x57>
+    int inc = 1, res = 0;
+  8022fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802300:	eb e3                	jmp    8022e5 <readn+0x54>
+
+0000000000802302 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802302:	55                   	push   %rbp
+  802303:	48 89 e5             	mov    %rsp,%rbp
+  802306:	41 56                	push   %r14
+  802308:	41 55                	push   %r13
+  80230a:	41 54                	push   %r12
+  80230c:	53                   	push   %rbx
+  80230d:	48 83 ec 10          	sub    $0x10,%rsp
+  802311:	89 fb                	mov    %edi,%ebx
+  802313:	49 89 f4             	mov    %rsi,%r12
+  802316:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802319:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80231d:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  802324:	00 00 00 
+  802327:	ff d0                	call   *%rax
+  802329:	85 c0                	test   %eax,%eax
+  80232b:	78 47                	js     802374 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80232d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802331:	41 8b 3e             	mov    (%r14),%edi
+  802334:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802338:	48 b8 3b 1f 80 00 00 	movabs $0x801f3b,%rax
+  80233f:	00 00 00 
+  802342:	ff d0                	call   *%rax
+  802344:	85 c0                	test   %eax,%eax
+  802346:	78 30                	js     802378 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802348:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80234d:	74 2d                	je     80237c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80234f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802353:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802357:	48 85 c0             	test   %rax,%rax
+  80235a:	74 56                	je     8023b2 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80235c:	4c 89 ea             	mov    %r13,%rdx
+  80235f:	4c 89 e6             	mov    %r12,%rsi
+  802362:	4c 89 f7             	mov    %r14,%rdi
+  802365:	ff d0                	call   *%rax
+}
+  802367:	48 83 c4 10          	add    $0x10,%rsp
+  80236b:	5b                   	pop    %rbx
+  80236c:	41 5c                	pop    %r12
+  80236e:	41 5d                	pop    %r13
+  802370:	41 5e                	pop    %r14
+  802372:	5d                   	pop    %rbp
+  802373:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802374:	48 98                	cltq
+  802376:	eb ef                	jmp    802367 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802378:	48 98                	cltq
+  80237a:	eb eb                	jmp    802367 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80237c:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  802383:	00 00 00 
+  802386:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80238c:	89 da                	mov    %ebx,%edx
+  80238e:	48 bf 05 57 80 00 00 	movabs $0x805705,%rdi
+  802395:	00 00 00 
+  802398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239d:	48 b9 74 03 80 00 00 	movabs $0x800374,%rcx
+  8023a4:	00 00 00 
+  8023a7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023a9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8023b0:	eb b5                	jmp    802367 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8023b2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8023b9:	eb ac                	jmp    802367 <write+0x65>
+
+00000000008023bb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8023bb:	55                   	push   %rbp
+  8023bc:	48 89 e5             	mov    %rsp,%rbp
+  8023bf:	53                   	push   %rbx
+  8023c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8023c4:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023c6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023ca:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  8023d1:	00 00 00 
+  8023d4:	ff d0                	call   *%rax
+  8023d6:	85 c0                	test   %eax,%eax
+  8023d8:	78 0c                	js     8023e6 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8023da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023de:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8023e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023ea:	c9                   	leave
+  8023eb:	c3                   	ret
+
+00000000008023ec <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  8023ec:	55                   	push   %rbp
+  8023ed:	48 89 e5             	mov    %rsp,%rbp
+  8023f0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8023f4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023f8:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  8023ff:	00 00 00 
+  802402:	ff d0                	call   *%rax
+  802404:	85 c0                	test   %eax,%eax
+  802406:	78 07                	js     80240f <tell+0x23>
+    return fdes->fd_offset;
+  802408:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80240c:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80240f:	c9                   	leave
+  802410:	c3                   	ret
+
+0000000000802411 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802411:	55                   	push   %rbp
+  802412:	48 89 e5             	mov    %rsp,%rbp
+  802415:	41 55                	push   %r13
+  802417:	41 54                	push   %r12
+  802419:	53                   	push   %rbx
+  80241a:	48 83 ec 18          	sub    $0x18,%rsp
+  80241e:	89 fb                	mov    %edi,%ebx
+  802420:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802423:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802427:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  80242e:	00 00 00 
+  802431:	ff d0                	call   *%rax
+  802433:	85 c0                	test   %eax,%eax
+  802435:	78 38                	js     80246f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802437:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80243b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80243f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802443:	48 b8 3b 1f 80 00 00 	movabs $0x801f3b,%rax
+  80244a:	00 00 00 
+  80244d:	ff d0                	call   *%rax
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	78 1c                	js     80246f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802453:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802458:	74 20                	je     80247a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80245a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80245e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802462:	48 85 c0             	test   %rax,%rax
+  802465:	74 47                	je     8024ae <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802467:	44 89 e6             	mov    %r12d,%esi
+  80246a:	4c 89 ef             	mov    %r13,%rdi
+  80246d:	ff d0                	call   *%rax
+}
+  80246f:	48 83 c4 18          	add    $0x18,%rsp
+  802473:	5b                   	pop    %rbx
+  802474:	41 5c                	pop    %r12
+  802476:	41 5d                	pop    %r13
+  802478:	5d                   	pop    %rbp
+  802479:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80247a:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  802481:	00 00 00 
+  802484:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80248a:	89 da                	mov    %ebx,%edx
+  80248c:	48 bf c8 56 80 00 00 	movabs $0x8056c8,%rdi
+  802493:	00 00 00 
+  802496:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249b:	48 b9 74 03 80 00 00 	movabs $0x800374,%rcx
+  8024a2:	00 00 00 
+  8024a5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8024a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024ac:	eb c1                	jmp    80246f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8024ae:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024b3:	eb ba                	jmp    80246f <ftruncate+0x5e>
+
+00000000008024b5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8024b5:	55                   	push   %rbp
+  8024b6:	48 89 e5             	mov    %rsp,%rbp
+  8024b9:	41 54                	push   %r12
+  8024bb:	53                   	push   %rbx
+  8024bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8024c0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024c3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8024c7:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  8024ce:	00 00 00 
+  8024d1:	ff d0                	call   *%rax
+  8024d3:	85 c0                	test   %eax,%eax
+  8024d5:	78 4e                	js     802525 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024d7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8024db:	41 8b 3c 24          	mov    (%r12),%edi
+  8024df:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8024e3:	48 b8 3b 1f 80 00 00 	movabs $0x801f3b,%rax
+  8024ea:	00 00 00 
+  8024ed:	ff d0                	call   *%rax
+  8024ef:	85 c0                	test   %eax,%eax
+  8024f1:	78 32                	js     802525 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8024f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024f7:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8024fc:	74 30                	je     80252e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8024fe:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802501:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802508:	00 00 00 
+    stat->st_isdir = 0;
+  80250b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802512:	00 00 00 
+    stat->st_dev = dev;
+  802515:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80251c:	48 89 de             	mov    %rbx,%rsi
+  80251f:	4c 89 e7             	mov    %r12,%rdi
+  802522:	ff 50 28             	call   *0x28(%rax)
+}
+  802525:	48 83 c4 10          	add    $0x10,%rsp
+  802529:	5b                   	pop    %rbx
+  80252a:	41 5c                	pop    %r12
+  80252c:	5d                   	pop    %rbp
+  80252d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80252e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802533:	eb f0                	jmp    802525 <fstat+0x70>
+
+0000000000802535 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802535:	55                   	push   %rbp
+  802536:	48 89 e5             	mov    %rsp,%rbp
+  802539:	41 54                	push   %r12
+  80253b:	53                   	push   %rbx
+  80253c:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802543:	41 89 fc             	mov    %edi,%r12d
+  802546:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802548:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80254c:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  802553:	00 00 00 
+  802556:	ff d0                	call   *%rax
+  802558:	85 c0                	test   %eax,%eax
+  80255a:	78 31                	js     80258d <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  80255c:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802563:	44 89 e7             	mov    %r12d,%edi
+  802566:	48 b8 b5 24 80 00 00 	movabs $0x8024b5,%rax
+  80256d:	00 00 00 
+  802570:	ff d0                	call   *%rax
+  802572:	85 c0                	test   %eax,%eax
+  802574:	78 17                	js     80258d <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802576:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80257a:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  80257d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802580:	39 d3                	cmp    %edx,%ebx
+  802582:	0f 4f da             	cmovg  %edx,%ebx
+  802585:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802588:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80258d:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802594:	5b                   	pop    %rbx
+  802595:	41 5c                	pop    %r12
+  802597:	5d                   	pop    %rbp
+  802598:	c3                   	ret
+
+0000000000802599 <seektoend>:
+{
+  802599:	55                   	push   %rbp
+  80259a:	48 89 e5             	mov    %rsp,%rbp
+  80259d:	53                   	push   %rbx
+  80259e:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8025a5:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8025a7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025ab:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+  8025b7:	85 c0                	test   %eax,%eax
+  8025b9:	78 28                	js     8025e3 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8025bb:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8025c2:	89 df                	mov    %ebx,%edi
+  8025c4:	48 b8 b5 24 80 00 00 	movabs $0x8024b5,%rax
+  8025cb:	00 00 00 
+  8025ce:	ff d0                	call   *%rax
+  8025d0:	85 c0                	test   %eax,%eax
+  8025d2:	78 0f                	js     8025e3 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8025d4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8025d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025db:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8025de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025e7:	c9                   	leave
+  8025e8:	c3                   	ret
+
+00000000008025e9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8025e9:	55                   	push   %rbp
+  8025ea:	48 89 e5             	mov    %rsp,%rbp
+  8025ed:	41 54                	push   %r12
+  8025ef:	53                   	push   %rbx
+  8025f0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8025f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f8:	48 b8 dc 31 80 00 00 	movabs $0x8031dc,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+  802604:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802606:	85 c0                	test   %eax,%eax
+  802608:	78 25                	js     80262f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80260a:	4c 89 e6             	mov    %r12,%rsi
+  80260d:	89 c7                	mov    %eax,%edi
+  80260f:	48 b8 b5 24 80 00 00 	movabs $0x8024b5,%rax
+  802616:	00 00 00 
+  802619:	ff d0                	call   *%rax
+  80261b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80261e:	89 df                	mov    %ebx,%edi
+  802620:	48 b8 55 20 80 00 00 	movabs $0x802055,%rax
+  802627:	00 00 00 
+  80262a:	ff d0                	call   *%rax
+
+    return res;
+  80262c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80262f:	89 d8                	mov    %ebx,%eax
+  802631:	5b                   	pop    %rbx
+  802632:	41 5c                	pop    %r12
+  802634:	5d                   	pop    %rbp
+  802635:	c3                   	ret
+
+0000000000802636 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802636:	55                   	push   %rbp
+  802637:	48 89 e5             	mov    %rsp,%rbp
+  80263a:	53                   	push   %rbx
+  80263b:	48 83 ec 08          	sub    $0x8,%rsp
+  80263f:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802642:	48 b8 62 1e 80 00 00 	movabs $0x801e62,%rax
+  802649:	00 00 00 
+  80264c:	ff d0                	call   *%rax
+  80264e:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802652:	0f 87 ea 00 00 00    	ja     802742 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802658:	48 b8 04 90 d8 00 00 	movabs $0xd89004,%rax
+  80265f:	00 00 00 
+  802662:	80 38 00             	cmpb   $0x0,(%rax)
+  802665:	75 35                	jne    80269c <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802667:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80266c:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802671:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802676:	bf 00 00 00 00       	mov    $0x0,%edi
+  80267b:	48 b8 4c 14 80 00 00 	movabs $0x80144c,%rax
+  802682:	00 00 00 
+  802685:	ff d0                	call   *%rax
+  802687:	85 c0                	test   %eax,%eax
+  802689:	0f 88 ba 00 00 00    	js     802749 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  80268f:	48 b8 04 90 d8 00 00 	movabs $0xd89004,%rax
+  802696:	00 00 00 
+  802699:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  80269c:	48 89 df             	mov    %rbx,%rdi
+  80269f:	48 b8 62 1e 80 00 00 	movabs $0x801e62,%rax
+  8026a6:	00 00 00 
+  8026a9:	ff d0                	call   *%rax
+  8026ab:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8026af:	48 ba 20 90 d8 00 00 	movabs $0xd89020,%rdx
+  8026b6:	00 00 00 
+  8026b9:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8026bd:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8026c0:	39 39                	cmp    %edi,(%rcx)
+  8026c2:	74 46                	je     80270a <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8026c4:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8026c8:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8026cf:	00 
+  8026d0:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8026d7:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8026de:	00 
+  8026df:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8026e6:	00 
+  8026e7:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8026ee:	00 
+  8026ef:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8026f6:	00 
+  8026f7:	89 39                	mov    %edi,(%rcx)
+  8026f9:	48 01 c6             	add    %rax,%rsi
+  8026fc:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802701:	48 89 c8             	mov    %rcx,%rax
+  802704:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802708:	c9                   	leave
+  802709:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80270a:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80270e:	48 be 20 90 d8 00 00 	movabs $0xd89020,%rsi
+  802715:	00 00 00 
+  802718:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80271b:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  80271f:	74 e0                	je     802701 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802721:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802728:	00 
+  802729:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  80272d:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802734:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802736:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802739:	48 01 c2             	add    %rax,%rdx
+  80273c:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802740:	eb bf                	jmp    802701 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802742:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802747:	eb b8                	jmp    802701 <fbuf_get+0xcb>
+            return NULL;
+  802749:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80274e:	eb b1                	jmp    802701 <fbuf_get+0xcb>
+
+0000000000802750 <fsipc_bulk>:
+fsipc_bulk(void) {
+  802750:	55                   	push   %rbp
+  802751:	48 89 e5             	mov    %rsp,%rbp
+  802754:	53                   	push   %rbx
+  802755:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802759:	48 b8 20 95 d8 00 00 	movabs $0xd89520,%rax
+  802760:	00 00 00 
+  802763:	48 8b 18             	mov    (%rax),%rbx
+  802766:	48 85 db             	test   %rbx,%rbx
+  802769:	74 16                	je     802781 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  80276b:	48 b8 20 95 d8 00 00 	movabs $0xd89520,%rax
+  802772:	00 00 00 
+  802775:	48 8b 18             	mov    (%rax),%rbx
+}
+  802778:	48 89 d8             	mov    %rbx,%rax
+  80277b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80277f:	c9                   	leave
+  802780:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802781:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802786:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80278b:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802790:	bf 00 00 00 00       	mov    $0x0,%edi
+  802795:	48 b8 4c 14 80 00 00 	movabs $0x80144c,%rax
+  80279c:	00 00 00 
+  80279f:	ff d0                	call   *%rax
+  8027a1:	85 c0                	test   %eax,%eax
+  8027a3:	78 d3                	js     802778 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8027a5:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8027aa:	48 a3 20 95 d8 00 00 	movabs %rax,0xd89520
+  8027b1:	00 00 00 
+  8027b4:	eb b5                	jmp    80276b <fsipc_bulk+0x1b>
+
+00000000008027b6 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8027b6:	55                   	push   %rbp
+  8027b7:	48 89 e5             	mov    %rsp,%rbp
+  8027ba:	41 57                	push   %r15
+  8027bc:	41 56                	push   %r14
+  8027be:	41 55                	push   %r13
+  8027c0:	41 54                	push   %r12
+  8027c2:	53                   	push   %rbx
+  8027c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c7:	41 89 fd             	mov    %edi,%r13d
+  8027ca:	49 89 f6             	mov    %rsi,%r14
+  8027cd:	49 89 d7             	mov    %rdx,%r15
+  8027d0:	48 89 cb             	mov    %rcx,%rbx
+  8027d3:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027d6:	48 b8 00 90 d8 00 00 	movabs $0xd89000,%rax
+  8027dd:	00 00 00 
+  8027e0:	83 38 00             	cmpl   $0x0,(%rax)
+  8027e3:	74 52                	je     802837 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  8027e5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8027eb:	4c 89 f9             	mov    %r15,%rcx
+  8027ee:	4c 89 f2             	mov    %r14,%rdx
+  8027f1:	44 89 ee             	mov    %r13d,%esi
+  8027f4:	48 b8 00 90 d8 00 00 	movabs $0xd89000,%rax
+  8027fb:	00 00 00 
+  8027fe:	8b 38                	mov    (%rax),%edi
+  802800:	48 b8 9b 42 80 00 00 	movabs $0x80429b,%rax
+  802807:	00 00 00 
+  80280a:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80280c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802811:	4c 89 e2             	mov    %r12,%rdx
+  802814:	48 89 de             	mov    %rbx,%rsi
+  802817:	bf 00 00 00 00       	mov    $0x0,%edi
+  80281c:	48 b8 eb 40 80 00 00 	movabs $0x8040eb,%rax
+  802823:	00 00 00 
+  802826:	ff d0                	call   *%rax
+}
+  802828:	48 83 c4 08          	add    $0x8,%rsp
+  80282c:	5b                   	pop    %rbx
+  80282d:	41 5c                	pop    %r12
+  80282f:	41 5d                	pop    %r13
+  802831:	41 5e                	pop    %r14
+  802833:	41 5f                	pop    %r15
+  802835:	5d                   	pop    %rbp
+  802836:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802837:	bf 03 00 00 00       	mov    $0x3,%edi
+  80283c:	48 b8 3e 43 80 00 00 	movabs $0x80433e,%rax
+  802843:	00 00 00 
+  802846:	ff d0                	call   *%rax
+  802848:	a3 00 90 d8 00 00 00 	movabs %eax,0xd89000
+  80284f:	00 00 
+  802851:	eb 92                	jmp    8027e5 <fsipc_region+0x2f>
+
+0000000000802853 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802853:	55                   	push   %rbp
+  802854:	48 89 e5             	mov    %rsp,%rbp
+  802857:	41 57                	push   %r15
+  802859:	41 56                	push   %r14
+  80285b:	41 55                	push   %r13
+  80285d:	41 54                	push   %r12
+  80285f:	53                   	push   %rbx
+  802860:	48 83 ec 28          	sub    $0x28,%rsp
+  802864:	49 89 ff             	mov    %rdi,%r15
+  802867:	49 89 f6             	mov    %rsi,%r14
+  80286a:	48 89 d3             	mov    %rdx,%rbx
+  80286d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802871:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802874:	48 b8 50 27 80 00 00 	movabs $0x802750,%rax
+  80287b:	00 00 00 
+  80287e:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802880:	48 85 c0             	test   %rax,%rax
+  802883:	0f 84 cc 00 00 00    	je     802955 <devfile_write_direct+0x102>
+  802889:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  80288c:	48 85 db             	test   %rbx,%rbx
+  80288f:	0f 84 ba 00 00 00    	je     80294f <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802895:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80289b:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8028a2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8028a6:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8028aa:	4c 29 e3             	sub    %r12,%rbx
+  8028ad:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8028b2:	48 39 c3             	cmp    %rax,%rbx
+  8028b5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8028b9:	48 89 da             	mov    %rbx,%rdx
+  8028bc:	4c 89 f6             	mov    %r14,%rsi
+  8028bf:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8028c3:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  8028ca:	00 00 00 
+  8028cd:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8028cf:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8028d3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  8028d7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8028da:	44 01 e0             	add    %r12d,%eax
+  8028dd:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  8028e1:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  8028e5:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  8028ec:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8028f3:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  8028fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802900:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802905:	4c 89 ee             	mov    %r13,%rsi
+  802908:	bf 04 00 00 00       	mov    $0x4,%edi
+  80290d:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  802914:	00 00 00 
+  802917:	ff d0                	call   *%rax
+        if (res < 0)
+  802919:	85 c0                	test   %eax,%eax
+  80291b:	78 29                	js     802946 <devfile_write_direct+0xf3>
+        if (res == 0)
+  80291d:	74 2b                	je     80294a <devfile_write_direct+0xf7>
+        i += res;
+  80291f:	48 98                	cltq
+  802921:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802924:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802927:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80292b:	49 39 c4             	cmp    %rax,%r12
+  80292e:	0f 82 72 ff ff ff    	jb     8028a6 <devfile_write_direct+0x53>
+    return i;
+  802934:	4c 89 e0             	mov    %r12,%rax
+}
+  802937:	48 83 c4 28          	add    $0x28,%rsp
+  80293b:	5b                   	pop    %rbx
+  80293c:	41 5c                	pop    %r12
+  80293e:	41 5d                	pop    %r13
+  802940:	41 5e                	pop    %r14
+  802942:	41 5f                	pop    %r15
+  802944:	5d                   	pop    %rbp
+  802945:	c3                   	ret
+            return res;
+  802946:	48 98                	cltq
+  802948:	eb ed                	jmp    802937 <devfile_write_direct+0xe4>
+            return i;
+  80294a:	4c 89 e0             	mov    %r12,%rax
+  80294d:	eb e8                	jmp    802937 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  80294f:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802953:	eb df                	jmp    802934 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802955:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  80295c:	eb d9                	jmp    802937 <devfile_write_direct+0xe4>
+
+000000000080295e <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  80295e:	55                   	push   %rbp
+  80295f:	48 89 e5             	mov    %rsp,%rbp
+  802962:	41 56                	push   %r14
+  802964:	41 55                	push   %r13
+  802966:	41 54                	push   %r12
+  802968:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802969:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  80296d:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802971:	b8 00 00 00 00       	mov    $0x0,%eax
+  802976:	4d 39 ee             	cmp    %r13,%r14
+  802979:	0f 84 99 00 00 00    	je     802a18 <fbuf_flush+0xba>
+  80297f:	49 89 fc             	mov    %rdi,%r12
+  802982:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802985:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802988:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80298c:	48 b8 62 1e 80 00 00 	movabs $0x801e62,%rax
+  802993:	00 00 00 
+  802996:	ff d0                	call   *%rax
+  802998:	48 89 c2             	mov    %rax,%rdx
+  80299b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80299f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8029a3:	48 c1 e0 0c          	shl    $0xc,%rax
+  8029a7:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8029ac:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8029af:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8029b3:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8029ba:	00 
+  8029bb:	44 89 f1             	mov    %r14d,%ecx
+  8029be:	4c 89 ea             	mov    %r13,%rdx
+  8029c1:	4c 89 e7             	mov    %r12,%rdi
+  8029c4:	48 b8 53 28 80 00 00 	movabs $0x802853,%rax
+  8029cb:	00 00 00 
+  8029ce:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029d0:	48 85 c0             	test   %rax,%rax
+  8029d3:	78 43                	js     802a18 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  8029d5:	4c 39 e8             	cmp    %r13,%rax
+  8029d8:	72 47                	jb     802a21 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  8029da:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8029df:	83 c0 01             	add    $0x1,%eax
+  8029e2:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8029e7:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  8029ea:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8029ee:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  8029f2:	72 0f                	jb     802a03 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  8029f4:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8029f8:	48 39 c2             	cmp    %rax,%rdx
+  8029fb:	48 0f 42 d0          	cmovb  %rax,%rdx
+  8029ff:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802a03:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802a0a:	00 
+  802a0b:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802a12:	00 
+    return 0;
+  802a13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a18:	5b                   	pop    %rbx
+  802a19:	41 5c                	pop    %r12
+  802a1b:	41 5d                	pop    %r13
+  802a1d:	41 5e                	pop    %r14
+  802a1f:	5d                   	pop    %rbp
+  802a20:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802a21:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802a26:	eb f0                	jmp    802a18 <fbuf_flush+0xba>
+
+0000000000802a28 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802a28:	55                   	push   %rbp
+  802a29:	48 89 e5             	mov    %rsp,%rbp
+  802a2c:	53                   	push   %rbx
+  802a2d:	48 83 ec 08          	sub    $0x8,%rsp
+  802a31:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802a34:	48 b8 36 26 80 00 00 	movabs $0x802636,%rax
+  802a3b:	00 00 00 
+  802a3e:	ff d0                	call   *%rax
+  802a40:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802a43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a48:	48 85 f6             	test   %rsi,%rsi
+  802a4b:	74 0f                	je     802a5c <devfile_sync+0x34>
+  802a4d:	48 89 df             	mov    %rbx,%rdi
+  802a50:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  802a57:	00 00 00 
+  802a5a:	ff d0                	call   *%rax
+}
+  802a5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a60:	c9                   	leave
+  802a61:	c3                   	ret
+
+0000000000802a62 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802a62:	55                   	push   %rbp
+  802a63:	48 89 e5             	mov    %rsp,%rbp
+  802a66:	48 83 ec 10          	sub    $0x10,%rsp
+  802a6a:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802a6d:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802a74:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802a75:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802a79:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a7e:	48 be 00 80 d8 00 00 	movabs $0xd88000,%rsi
+  802a85:	00 00 00 
+  802a88:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+}
+  802a94:	c9                   	leave
+  802a95:	c3                   	ret
+
+0000000000802a96 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802a96:	55                   	push   %rbp
+  802a97:	48 89 e5             	mov    %rsp,%rbp
+  802a9a:	41 54                	push   %r12
+  802a9c:	53                   	push   %rbx
+  802a9d:	48 89 fb             	mov    %rdi,%rbx
+  802aa0:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802aa3:	48 b8 28 2a 80 00 00 	movabs $0x802a28,%rax
+  802aaa:	00 00 00 
+  802aad:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	78 63                	js     802b16 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ab3:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ab6:	a3 00 80 d8 00 00 00 	movabs %eax,0xd88000
+  802abd:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802abf:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac4:	bf 05 00 00 00       	mov    $0x5,%edi
+  802ac9:	48 b8 62 2a 80 00 00 	movabs $0x802a62,%rax
+  802ad0:	00 00 00 
+  802ad3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ad5:	85 c0                	test   %eax,%eax
+  802ad7:	78 3d                	js     802b16 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802ad9:	48 bb 00 80 d8 00 00 	movabs $0xd88000,%rbx
+  802ae0:	00 00 00 
+  802ae3:	48 89 de             	mov    %rbx,%rsi
+  802ae6:	4c 89 e7             	mov    %r12,%rdi
+  802ae9:	48 b8 ec 0c 80 00 00 	movabs $0x800cec,%rax
+  802af0:	00 00 00 
+  802af3:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802af5:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802afb:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802b02:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802b03:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802b09:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802b10:	00 
+
+    return 0;
+  802b11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b16:	5b                   	pop    %rbx
+  802b17:	41 5c                	pop    %r12
+  802b19:	5d                   	pop    %rbp
+  802b1a:	c3                   	ret
+
+0000000000802b1b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b1b:	55                   	push   %rbp
+  802b1c:	48 89 e5             	mov    %rsp,%rbp
+  802b1f:	41 54                	push   %r12
+  802b21:	53                   	push   %rbx
+  802b22:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802b25:	48 b8 28 2a 80 00 00 	movabs $0x802a28,%rax
+  802b2c:	00 00 00 
+  802b2f:	ff d0                	call   *%rax
+  802b31:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802b34:	48 89 df             	mov    %rbx,%rdi
+  802b37:	48 b8 62 1e 80 00 00 	movabs $0x801e62,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+  802b43:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802b47:	76 2e                	jbe    802b77 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802b49:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b4c:	a3 00 80 d8 00 00 00 	movabs %eax,0xd88000
+  802b53:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802b55:	be 00 00 00 00       	mov    $0x0,%esi
+  802b5a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802b5f:	48 b8 62 2a 80 00 00 	movabs $0x802a62,%rax
+  802b66:	00 00 00 
+  802b69:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802b6b:	45 85 e4             	test   %r12d,%r12d
+  802b6e:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802b72:	5b                   	pop    %rbx
+  802b73:	41 5c                	pop    %r12
+  802b75:	5d                   	pop    %rbp
+  802b76:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802b77:	48 89 df             	mov    %rbx,%rdi
+  802b7a:	48 b8 62 1e 80 00 00 	movabs $0x801e62,%rax
+  802b81:	00 00 00 
+  802b84:	ff d0                	call   *%rax
+  802b86:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802b8a:	48 b8 20 90 d8 00 00 	movabs $0xd89020,%rax
+  802b91:	00 00 00 
+  802b94:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802b9b:	48 89 df             	mov    %rbx,%rdi
+  802b9e:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  802ba5:	00 00 00 
+  802ba8:	ff d0                	call   *%rax
+  802baa:	48 89 c6             	mov    %rax,%rsi
+  802bad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bb7:	48 b8 2b 16 80 00 00 	movabs $0x80162b,%rax
+  802bbe:	00 00 00 
+  802bc1:	ff d0                	call   *%rax
+  802bc3:	eb 84                	jmp    802b49 <devfile_flush+0x2e>
+
+0000000000802bc5 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802bc5:	55                   	push   %rbp
+  802bc6:	48 89 e5             	mov    %rsp,%rbp
+  802bc9:	41 55                	push   %r13
+  802bcb:	41 54                	push   %r12
+  802bcd:	53                   	push   %rbx
+  802bce:	48 83 ec 08          	sub    $0x8,%rsp
+  802bd2:	48 89 fb             	mov    %rdi,%rbx
+  802bd5:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802bd8:	48 b8 36 26 80 00 00 	movabs $0x802636,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802be4:	48 85 c0             	test   %rax,%rax
+  802be7:	74 51                	je     802c3a <devfile_trunc+0x75>
+  802be9:	49 89 c4             	mov    %rax,%r12
+  802bec:	48 89 c6             	mov    %rax,%rsi
+  802bef:	48 89 df             	mov    %rbx,%rdi
+  802bf2:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  802bf9:	00 00 00 
+  802bfc:	ff d0                	call   *%rax
+  802bfe:	85 c0                	test   %eax,%eax
+  802c00:	78 2d                	js     802c2f <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802c02:	48 b8 00 80 d8 00 00 	movabs $0xd88000,%rax
+  802c09:	00 00 00 
+  802c0c:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802c0f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802c11:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802c15:	be 00 00 00 00       	mov    $0x0,%esi
+  802c1a:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c1f:	48 b8 62 2a 80 00 00 	movabs $0x802a62,%rax
+  802c26:	00 00 00 
+  802c29:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802c2b:	85 c0                	test   %eax,%eax
+  802c2d:	79 3e                	jns    802c6d <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802c2f:	48 83 c4 08          	add    $0x8,%rsp
+  802c33:	5b                   	pop    %rbx
+  802c34:	41 5c                	pop    %r12
+  802c36:	41 5d                	pop    %r13
+  802c38:	5d                   	pop    %rbp
+  802c39:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802c3a:	48 b8 00 80 d8 00 00 	movabs $0xd88000,%rax
+  802c41:	00 00 00 
+  802c44:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802c47:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802c49:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802c4d:	be 00 00 00 00       	mov    $0x0,%esi
+  802c52:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c57:	48 b8 62 2a 80 00 00 	movabs $0x802a62,%rax
+  802c5e:	00 00 00 
+  802c61:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802c63:	85 c0                	test   %eax,%eax
+  802c65:	78 c8                	js     802c2f <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802c67:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c6b:	eb c2                	jmp    802c2f <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802c6d:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802c70:	8d 51 01             	lea    0x1(%rcx),%edx
+  802c73:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c76:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802c7b:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802c82:	00 00 
+  802c84:	eb a9                	jmp    802c2f <devfile_trunc+0x6a>
+
+0000000000802c86 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802c86:	55                   	push   %rbp
+  802c87:	48 89 e5             	mov    %rsp,%rbp
+  802c8a:	41 57                	push   %r15
+  802c8c:	41 56                	push   %r14
+  802c8e:	41 55                	push   %r13
+  802c90:	41 54                	push   %r12
+  802c92:	53                   	push   %rbx
+  802c93:	48 83 ec 28          	sub    $0x28,%rsp
+  802c97:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802c9b:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802c9f:	49 89 d7             	mov    %rdx,%r15
+  802ca2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802ca6:	48 b8 36 26 80 00 00 	movabs $0x802636,%rax
+  802cad:	00 00 00 
+  802cb0:	ff d0                	call   *%rax
+  802cb2:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802cb5:	48 85 c0             	test   %rax,%rax
+  802cb8:	74 31                	je     802ceb <devfile_write+0x65>
+  802cba:	4c 89 f8             	mov    %r15,%rax
+  802cbd:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802cc4:	77 25                	ja     802ceb <devfile_write+0x65>
+    size_t i = 0;
+  802cc6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802ccc:	48 85 c0             	test   %rax,%rax
+  802ccf:	0f 85 64 01 00 00    	jne    802e39 <devfile_write+0x1b3>
+    size_t i = 0;
+  802cd5:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802cd9:	4c 89 f8             	mov    %r15,%rax
+}
+  802cdc:	48 83 c4 28          	add    $0x28,%rsp
+  802ce0:	5b                   	pop    %rbx
+  802ce1:	41 5c                	pop    %r12
+  802ce3:	41 5d                	pop    %r13
+  802ce5:	41 5e                	pop    %r14
+  802ce7:	41 5f                	pop    %r15
+  802ce9:	5d                   	pop    %rbp
+  802cea:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802ceb:	48 85 db             	test   %rbx,%rbx
+  802cee:	74 5b                	je     802d4b <devfile_write+0xc5>
+  802cf0:	48 89 de             	mov    %rbx,%rsi
+  802cf3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802cf7:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  802cfe:	00 00 00 
+  802d01:	ff d0                	call   *%rax
+  802d03:	85 c0                	test   %eax,%eax
+  802d05:	78 40                	js     802d47 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802d07:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d0b:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802d0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d12:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802d16:	48 b8 53 28 80 00 00 	movabs $0x802853,%rax
+  802d1d:	00 00 00 
+  802d20:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802d22:	48 85 c0             	test   %rax,%rax
+  802d25:	7e b5                	jle    802cdc <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802d27:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802d2b:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802d2e:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802d31:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802d34:	8d 51 01             	lea    0x1(%rcx),%edx
+  802d37:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d3a:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802d3d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802d44:	00 
+  802d45:	eb 95                	jmp    802cdc <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802d47:	48 98                	cltq
+  802d49:	eb 91                	jmp    802cdc <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802d4b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802d4f:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802d52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d56:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802d5a:	48 89 df             	mov    %rbx,%rdi
+  802d5d:	48 b8 53 28 80 00 00 	movabs $0x802853,%rax
+  802d64:	00 00 00 
+  802d67:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802d69:	48 85 c0             	test   %rax,%rax
+  802d6c:	0f 8e 6a ff ff ff    	jle    802cdc <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802d72:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  802d75:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d79:	e9 5e ff ff ff       	jmp    802cdc <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d7e:	48 98                	cltq
+  802d80:	4d 85 ff             	test   %r15,%r15
+  802d83:	49 0f 45 c7          	cmovne %r15,%rax
+  802d87:	e9 50 ff ff ff       	jmp    802cdc <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802d8c:	48 89 de             	mov    %rbx,%rsi
+  802d8f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802d93:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  802d9a:	00 00 00 
+  802d9d:	ff d0                	call   *%rax
+  802d9f:	85 c0                	test   %eax,%eax
+  802da1:	0f 88 2b 01 00 00    	js     802ed2 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802da7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802dab:	4c 01 f8             	add    %r15,%rax
+  802dae:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802db2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802db6:	48 b9 62 1e 80 00 00 	movabs $0x801e62,%rcx
+  802dbd:	00 00 00 
+  802dc0:	ff d1                	call   *%rcx
+  802dc2:	48 89 c2             	mov    %rax,%rdx
+  802dc5:	48 c1 e2 04          	shl    $0x4,%rdx
+  802dc9:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802dcd:	48 c1 e0 0c          	shl    $0xc,%rax
+  802dd1:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  802dd6:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  802dd9:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  802de0:	00 
+  802de1:	4c 89 ea             	mov    %r13,%rdx
+  802de4:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802de8:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  802def:	00 00 00 
+  802df2:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  802df4:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802df8:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802dfc:	48 39 c2             	cmp    %rax,%rdx
+  802dff:	0f 84 db 00 00 00    	je     802ee0 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  802e05:	4c 39 e2             	cmp    %r12,%rdx
+  802e08:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  802e0c:	4d 01 ec             	add    %r13,%r12
+  802e0f:	49 39 c4             	cmp    %rax,%r12
+  802e12:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  802e16:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  802e1a:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  802e1e:	45 01 ee             	add    %r13d,%r14d
+  802e21:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e25:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  802e29:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  802e2c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e30:	49 39 c7             	cmp    %rax,%r15
+  802e33:	0f 83 a0 fe ff ff    	jae    802cd9 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  802e39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e3d:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  802e41:	8b 43 08             	mov    0x8(%rbx),%eax
+  802e44:	44 39 f0             	cmp    %r14d,%eax
+  802e47:	7f 10                	jg     802e59 <devfile_write+0x1d3>
+  802e49:	48 98                	cltq
+  802e4b:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  802e51:	49 63 d6             	movslq %r14d,%rdx
+  802e54:	48 39 d0             	cmp    %rdx,%rax
+  802e57:	7d 2d                	jge    802e86 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802e59:	48 89 de             	mov    %rbx,%rsi
+  802e5c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e60:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  802e67:	00 00 00 
+  802e6a:	ff d0                	call   *%rax
+  802e6c:	85 c0                	test   %eax,%eax
+  802e6e:	0f 88 0a ff ff ff    	js     802d7e <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  802e74:	44 89 f0             	mov    %r14d,%eax
+  802e77:	66 b8 00 00          	mov    $0x0,%ax
+  802e7b:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  802e7e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802e85:	00 
+        size_t off = pos - fb->fb_base;
+  802e86:	45 89 f4             	mov    %r14d,%r12d
+  802e89:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  802e8d:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  802e90:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  802e94:	4d 29 fd             	sub    %r15,%r13
+  802e97:	b8 00 00 01 00       	mov    $0x10000,%eax
+  802e9c:	4c 29 e0             	sub    %r12,%rax
+  802e9f:	49 39 c5             	cmp    %rax,%r13
+  802ea2:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  802ea6:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802eaa:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  802eae:	48 39 c2             	cmp    %rax,%rdx
+  802eb1:	0f 84 f0 fe ff ff    	je     802da7 <devfile_write+0x121>
+  802eb7:	4c 39 e0             	cmp    %r12,%rax
+  802eba:	0f 82 cc fe ff ff    	jb     802d8c <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  802ec0:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802ec4:	48 39 d0             	cmp    %rdx,%rax
+  802ec7:	0f 83 da fe ff ff    	jae    802da7 <devfile_write+0x121>
+  802ecd:	e9 ba fe ff ff       	jmp    802d8c <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  802ed2:	48 98                	cltq
+  802ed4:	4d 85 ff             	test   %r15,%r15
+  802ed7:	49 0f 45 c7          	cmovne %r15,%rax
+  802edb:	e9 fc fd ff ff       	jmp    802cdc <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  802ee0:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  802ee4:	4c 89 e2             	mov    %r12,%rdx
+  802ee7:	e9 2a ff ff ff       	jmp    802e16 <devfile_write+0x190>
+
+0000000000802eec <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802eec:	55                   	push   %rbp
+  802eed:	48 89 e5             	mov    %rsp,%rbp
+  802ef0:	41 57                	push   %r15
+  802ef2:	41 56                	push   %r14
+  802ef4:	41 55                	push   %r13
+  802ef6:	41 54                	push   %r12
+  802ef8:	53                   	push   %rbx
+  802ef9:	48 83 ec 28          	sub    $0x28,%rsp
+  802efd:	49 89 ff             	mov    %rdi,%r15
+  802f00:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f04:	48 89 d3             	mov    %rdx,%rbx
+  802f07:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f0b:	48 b8 36 26 80 00 00 	movabs $0x802636,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+  802f17:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  802f1a:	48 85 c0             	test   %rax,%rax
+  802f1d:	74 0d                	je     802f2c <devfile_read+0x40>
+  802f1f:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  802f26:	0f 86 1a 01 00 00    	jbe    803046 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f2c:	4d 85 e4             	test   %r12,%r12
+  802f2f:	74 1a                	je     802f4b <devfile_read+0x5f>
+  802f31:	4c 89 e6             	mov    %r12,%rsi
+  802f34:	4c 89 ff             	mov    %r15,%rdi
+  802f37:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  802f3e:	00 00 00 
+  802f41:	ff d0                	call   *%rax
+  802f43:	85 c0                	test   %eax,%eax
+  802f45:	0f 88 e8 00 00 00    	js     803033 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  802f4b:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  802f4f:	48 b8 50 27 80 00 00 	movabs $0x802750,%rax
+  802f56:	00 00 00 
+  802f59:	ff d0                	call   *%rax
+  802f5b:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  802f5e:	48 85 c0             	test   %rax,%rax
+  802f61:	0f 84 69 02 00 00    	je     8031d0 <devfile_read+0x2e4>
+    while (i < n) {
+  802f67:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802f6c:	0f 84 ce 00 00 00    	je     803040 <devfile_read+0x154>
+    size_t i = 0;
+  802f72:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802f77:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802f7e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802f82:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  802f86:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  802f8a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802f8e:	48 29 da             	sub    %rbx,%rdx
+  802f91:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802f96:	48 39 c2             	cmp    %rax,%rdx
+  802f99:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  802f9d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802fa1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  802fa5:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  802fa8:	01 d8                	add    %ebx,%eax
+  802faa:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  802fae:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  802fb2:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  802fb9:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802fc0:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  802fc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fcd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fd2:	4c 89 ee             	mov    %r13,%rsi
+  802fd5:	bf 03 00 00 00       	mov    $0x3,%edi
+  802fda:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  802fe1:	00 00 00 
+  802fe4:	ff d0                	call   *%rax
+        if (res < 0)
+  802fe6:	85 c0                	test   %eax,%eax
+  802fe8:	78 4d                	js     803037 <devfile_read+0x14b>
+        if (res == 0)
+  802fea:	74 4f                	je     80303b <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  802fec:	4c 63 e0             	movslq %eax,%r12
+  802fef:	4c 89 e2             	mov    %r12,%rdx
+  802ff2:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802ff6:	4c 89 f7             	mov    %r14,%rdi
+  802ff9:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  803000:	00 00 00 
+  803003:	ff d0                	call   *%rax
+        i += res;
+  803005:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803008:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  80300b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80300f:	48 39 c3             	cmp    %rax,%rbx
+  803012:	0f 82 72 ff ff ff    	jb     802f8a <devfile_read+0x9e>
+    return i;
+  803018:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80301b:	48 85 c0             	test   %rax,%rax
+  80301e:	7e 04                	jle    803024 <devfile_read+0x138>
+  803020:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803024:	48 83 c4 28          	add    $0x28,%rsp
+  803028:	5b                   	pop    %rbx
+  803029:	41 5c                	pop    %r12
+  80302b:	41 5d                	pop    %r13
+  80302d:	41 5e                	pop    %r14
+  80302f:	41 5f                	pop    %r15
+  803031:	5d                   	pop    %rbp
+  803032:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803033:	48 98                	cltq
+  803035:	eb ed                	jmp    803024 <devfile_read+0x138>
+            return res;
+  803037:	48 98                	cltq
+  803039:	eb e9                	jmp    803024 <devfile_read+0x138>
+            return i;
+  80303b:	48 89 d8             	mov    %rbx,%rax
+  80303e:	eb db                	jmp    80301b <devfile_read+0x12f>
+    size_t i = 0;
+  803040:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803044:	eb d2                	jmp    803018 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803046:	48 89 c6             	mov    %rax,%rsi
+  803049:	4c 89 ff             	mov    %r15,%rdi
+  80304c:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  803053:	00 00 00 
+  803056:	ff d0                	call   *%rax
+  803058:	85 c0                	test   %eax,%eax
+  80305a:	78 40                	js     80309c <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80305c:	4c 89 ff             	mov    %r15,%rdi
+  80305f:	48 b8 62 1e 80 00 00 	movabs $0x801e62,%rax
+  803066:	00 00 00 
+  803069:	ff d0                	call   *%rax
+  80306b:	48 89 c2             	mov    %rax,%rdx
+  80306e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803072:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803076:	48 c1 e0 0c          	shl    $0xc,%rax
+  80307a:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  80307f:	48 01 d0             	add    %rdx,%rax
+  803082:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803086:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80308b:	0f 84 33 01 00 00    	je     8031c4 <devfile_read+0x2d8>
+    size_t i = 0;
+  803091:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803097:	e9 f5 00 00 00       	jmp    803191 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80309c:	48 98                	cltq
+  80309e:	eb 84                	jmp    803024 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8030a0:	44 89 e8             	mov    %r13d,%eax
+  8030a3:	66 b8 00 00          	mov    $0x0,%ax
+  8030a7:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  8030ac:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8030b3:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  8030b5:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8030b9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8030bd:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  8030bf:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8030c4:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  8030c7:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8030ce:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8030cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030da:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8030df:	bf 03 00 00 00       	mov    $0x3,%edi
+  8030e4:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  8030eb:	00 00 00 
+  8030ee:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8030f0:	85 c0                	test   %eax,%eax
+  8030f2:	0f 88 be 00 00 00    	js     8031b6 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8030f8:	48 63 d0             	movslq %eax,%rdx
+  8030fb:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803100:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803105:	44 39 e8             	cmp    %r13d,%eax
+  803108:	0f 8e ba 00 00 00    	jle    8031c8 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80310e:	49 63 c5             	movslq %r13d,%rax
+  803111:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803116:	48 29 c3             	sub    %rax,%rbx
+  803119:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80311e:	48 01 c3             	add    %rax,%rbx
+  803121:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803125:	4c 29 f0             	sub    %r14,%rax
+  803128:	48 39 c3             	cmp    %rax,%rbx
+  80312b:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80312f:	4c 89 ff             	mov    %r15,%rdi
+  803132:	48 b9 62 1e 80 00 00 	movabs $0x801e62,%rcx
+  803139:	00 00 00 
+  80313c:	ff d1                	call   *%rcx
+  80313e:	48 89 c2             	mov    %rax,%rdx
+  803141:	48 c1 e2 04          	shl    $0x4,%rdx
+  803145:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803149:	48 c1 e0 0c          	shl    $0xc,%rax
+  80314d:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803152:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803155:	44 89 ea             	mov    %r13d,%edx
+  803158:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  80315d:	48 63 d2             	movslq %edx,%rdx
+  803160:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803167:	00 
+  803168:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80316c:	4c 01 f7             	add    %r14,%rdi
+  80316f:	48 89 da             	mov    %rbx,%rdx
+  803172:	48 b9 e1 10 80 00 00 	movabs $0x8010e1,%rcx
+  803179:	00 00 00 
+  80317c:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  80317e:	41 01 dd             	add    %ebx,%r13d
+  803181:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803185:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803188:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80318c:	49 39 c6             	cmp    %rax,%r14
+  80318f:	73 37                	jae    8031c8 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803191:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803195:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80319a:	44 39 e8             	cmp    %r13d,%eax
+  80319d:	0f 8f fd fe ff ff    	jg     8030a0 <devfile_read+0x1b4>
+  8031a3:	41 03 44 24 10       	add    0x10(%r12),%eax
+  8031a8:	44 39 e8             	cmp    %r13d,%eax
+  8031ab:	0f 8f 5d ff ff ff    	jg     80310e <devfile_read+0x222>
+  8031b1:	e9 ea fe ff ff       	jmp    8030a0 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  8031b6:	48 98                	cltq
+  8031b8:	4d 85 f6             	test   %r14,%r14
+  8031bb:	49 0f 45 c6          	cmovne %r14,%rax
+  8031bf:	e9 60 fe ff ff       	jmp    803024 <devfile_read+0x138>
+    size_t i = 0;
+  8031c4:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  8031c8:	4c 89 f0             	mov    %r14,%rax
+  8031cb:	e9 54 fe ff ff       	jmp    803024 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  8031d0:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8031d7:	e9 48 fe ff ff       	jmp    803024 <devfile_read+0x138>
+
+00000000008031dc <open>:
+open(const char *path, int mode) {
+  8031dc:	55                   	push   %rbp
+  8031dd:	48 89 e5             	mov    %rsp,%rbp
+  8031e0:	41 55                	push   %r13
+  8031e2:	41 54                	push   %r12
+  8031e4:	53                   	push   %rbx
+  8031e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8031e9:	49 89 fc             	mov    %rdi,%r12
+  8031ec:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8031ef:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  8031f6:	00 00 00 
+  8031f9:	ff d0                	call   *%rax
+  8031fb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803201:	0f 87 8a 00 00 00    	ja     803291 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803207:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80320b:	48 b8 90 1e 80 00 00 	movabs $0x801e90,%rax
+  803212:	00 00 00 
+  803215:	ff d0                	call   *%rax
+  803217:	89 c3                	mov    %eax,%ebx
+  803219:	85 c0                	test   %eax,%eax
+  80321b:	78 50                	js     80326d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80321d:	4c 89 e6             	mov    %r12,%rsi
+  803220:	48 bb 00 80 d8 00 00 	movabs $0xd88000,%rbx
+  803227:	00 00 00 
+  80322a:	48 89 df             	mov    %rbx,%rdi
+  80322d:	48 b8 ec 0c 80 00 00 	movabs $0x800cec,%rax
+  803234:	00 00 00 
+  803237:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803239:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803240:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803244:	bf 01 00 00 00       	mov    $0x1,%edi
+  803249:	48 b8 62 2a 80 00 00 	movabs $0x802a62,%rax
+  803250:	00 00 00 
+  803253:	ff d0                	call   *%rax
+  803255:	89 c3                	mov    %eax,%ebx
+  803257:	85 c0                	test   %eax,%eax
+  803259:	78 1f                	js     80327a <open+0x9e>
+    return fd2num(fd);
+  80325b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80325f:	48 b8 62 1e 80 00 00 	movabs $0x801e62,%rax
+  803266:	00 00 00 
+  803269:	ff d0                	call   *%rax
+  80326b:	89 c3                	mov    %eax,%ebx
+}
+  80326d:	89 d8                	mov    %ebx,%eax
+  80326f:	48 83 c4 18          	add    $0x18,%rsp
+  803273:	5b                   	pop    %rbx
+  803274:	41 5c                	pop    %r12
+  803276:	41 5d                	pop    %r13
+  803278:	5d                   	pop    %rbp
+  803279:	c3                   	ret
+        fd_close(fd, 0);
+  80327a:	be 00 00 00 00       	mov    $0x0,%esi
+  80327f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803283:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  80328a:	00 00 00 
+  80328d:	ff d0                	call   *%rax
+        return res;
+  80328f:	eb dc                	jmp    80326d <open+0x91>
+        return -E_BAD_PATH;
+  803291:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803296:	eb d5                	jmp    80326d <open+0x91>
+
+0000000000803298 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803298:	55                   	push   %rbp
+  803299:	48 89 e5             	mov    %rsp,%rbp
+  80329c:	41 57                	push   %r15
+  80329e:	41 56                	push   %r14
+  8032a0:	41 55                	push   %r13
+  8032a2:	41 54                	push   %r12
+  8032a4:	53                   	push   %rbx
+  8032a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8032a9:	41 89 f6             	mov    %esi,%r14d
+  8032ac:	49 89 d7             	mov    %rdx,%r15
+  8032af:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032b2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8032b6:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  8032bd:	00 00 00 
+  8032c0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032c2:	85 c0                	test   %eax,%eax
+  8032c4:	0f 88 db 00 00 00    	js     8033a5 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8032ca:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8032ce:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8032d5:	00 00 00 
+  8032d8:	8b 00                	mov    (%rax),%eax
+  8032da:	39 07                	cmp    %eax,(%rdi)
+  8032dc:	0f 85 db 00 00 00    	jne    8033bd <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8032e2:	45 85 f6             	test   %r14d,%r14d
+  8032e5:	0f 88 db 00 00 00    	js     8033c6 <fmap+0x12e>
+  8032eb:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  8032f2:	0f 85 d7 00 00 00    	jne    8033cf <fmap+0x137>
+  8032f8:	4c 89 fb             	mov    %r15,%rbx
+  8032fb:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803301:	0f 85 d1 00 00 00    	jne    8033d8 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803307:	48 b8 28 2a 80 00 00 	movabs $0x802a28,%rax
+  80330e:	00 00 00 
+  803311:	ff d0                	call   *%rax
+  803313:	85 c0                	test   %eax,%eax
+  803315:	0f 88 8e 00 00 00    	js     8033a9 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80331b:	49 bc 00 80 d8 00 00 	movabs $0xd88000,%r12
+  803322:	00 00 00 
+    while (i < n) {
+  803325:	4d 85 ed             	test   %r13,%r13
+  803328:	0f 84 8a 00 00 00    	je     8033b8 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80332e:	4c 89 ea             	mov    %r13,%rdx
+  803331:	48 29 da             	sub    %rbx,%rdx
+  803334:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80333b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803341:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803345:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803349:	8b 40 0c             	mov    0xc(%rax),%eax
+  80334c:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  803350:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803354:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803359:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  80335e:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803362:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803366:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80336b:	4c 89 e6             	mov    %r12,%rsi
+  80336e:	bf 09 00 00 00       	mov    $0x9,%edi
+  803373:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  80337a:	00 00 00 
+  80337d:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  80337f:	85 c0                	test   %eax,%eax
+  803381:	78 2a                	js     8033ad <fmap+0x115>
+        i += res;
+  803383:	48 98                	cltq
+  803385:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803388:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  80338c:	72 05                	jb     803393 <fmap+0xfb>
+    while (i < n) {
+  80338e:	4c 39 eb             	cmp    %r13,%rbx
+  803391:	72 9b                	jb     80332e <fmap+0x96>
+    }
+    return i;
+  803393:	48 89 d8             	mov    %rbx,%rax
+}
+  803396:	48 83 c4 18          	add    $0x18,%rsp
+  80339a:	5b                   	pop    %rbx
+  80339b:	41 5c                	pop    %r12
+  80339d:	41 5d                	pop    %r13
+  80339f:	41 5e                	pop    %r14
+  8033a1:	41 5f                	pop    %r15
+  8033a3:	5d                   	pop    %rbp
+  8033a4:	c3                   	ret
+    if (res < 0) return res;
+  8033a5:	48 98                	cltq
+  8033a7:	eb ed                	jmp    803396 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8033a9:	48 98                	cltq
+  8033ab:	eb e9                	jmp    803396 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  8033ad:	48 98                	cltq
+  8033af:	48 85 db             	test   %rbx,%rbx
+  8033b2:	48 0f 45 c3          	cmovne %rbx,%rax
+  8033b6:	eb de                	jmp    803396 <fmap+0xfe>
+    size_t i = 0;
+  8033b8:	4c 89 eb             	mov    %r13,%rbx
+  8033bb:	eb d6                	jmp    803393 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8033bd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8033c4:	eb d0                	jmp    803396 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  8033c6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033cd:	eb c7                	jmp    803396 <fmap+0xfe>
+  8033cf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033d6:	eb be                	jmp    803396 <fmap+0xfe>
+  8033d8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033df:	eb b5                	jmp    803396 <fmap+0xfe>
+
+00000000008033e1 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  8033e1:	55                   	push   %rbp
+  8033e2:	48 89 e5             	mov    %rsp,%rbp
+  8033e5:	41 56                	push   %r14
+  8033e7:	41 55                	push   %r13
+  8033e9:	41 54                	push   %r12
+  8033eb:	53                   	push   %rbx
+  8033ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8033f0:	89 fb                	mov    %edi,%ebx
+  8033f2:	41 89 f4             	mov    %esi,%r12d
+  8033f5:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8033f8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033fc:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  803403:	00 00 00 
+  803406:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803408:	85 c0                	test   %eax,%eax
+  80340a:	78 63                	js     80346f <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80340c:	45 85 e4             	test   %r12d,%r12d
+  80340f:	0f 88 80 00 00 00    	js     803495 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803415:	45 89 e6             	mov    %r12d,%r14d
+  803418:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80341f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803423:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  80342a:	00 00 00 
+  80342d:	ff d0                	call   *%rax
+  80342f:	48 89 c2             	mov    %rax,%rdx
+  803432:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803437:	44 89 f6             	mov    %r14d,%esi
+  80343a:	89 df                	mov    %ebx,%edi
+  80343c:	48 b8 98 32 80 00 00 	movabs $0x803298,%rax
+  803443:	00 00 00 
+  803446:	ff d0                	call   *%rax
+  803448:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80344b:	45 29 f4             	sub    %r14d,%r12d
+  80344e:	4d 63 f4             	movslq %r12d,%r14
+  803451:	49 39 c6             	cmp    %rax,%r14
+  803454:	7c 1d                	jl     803473 <read_map+0x92>
+  803456:	48 85 c0             	test   %rax,%rax
+  803459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345e:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803462:	48 83 c4 10          	add    $0x10,%rsp
+  803466:	5b                   	pop    %rbx
+  803467:	41 5c                	pop    %r12
+  803469:	41 5d                	pop    %r13
+  80346b:	41 5e                	pop    %r14
+  80346d:	5d                   	pop    %rbp
+  80346e:	c3                   	ret
+    if (res < 0) return res;
+  80346f:	48 98                	cltq
+  803471:	eb ef                	jmp    803462 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803473:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803477:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+  803483:	4d 63 e4             	movslq %r12d,%r12
+  803486:	4c 01 e0             	add    %r12,%rax
+  803489:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  80348d:	48 89 d8             	mov    %rbx,%rax
+  803490:	4c 29 f0             	sub    %r14,%rax
+  803493:	eb cd                	jmp    803462 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803495:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80349c:	eb c4                	jmp    803462 <read_map+0x81>
+
+000000000080349e <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  80349e:	55                   	push   %rbp
+  80349f:	48 89 e5             	mov    %rsp,%rbp
+  8034a2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034a6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034aa:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  8034b1:	00 00 00 
+  8034b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034b6:	85 c0                	test   %eax,%eax
+  8034b8:	78 4a                	js     803504 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8034ba:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034be:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8034c5:	00 00 00 
+  8034c8:	8b 00                	mov    (%rax),%eax
+  8034ca:	39 07                	cmp    %eax,(%rdi)
+  8034cc:	75 38                	jne    803506 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8034ce:	48 b8 28 2a 80 00 00 	movabs $0x802a28,%rax
+  8034d5:	00 00 00 
+  8034d8:	ff d0                	call   *%rax
+  8034da:	85 c0                	test   %eax,%eax
+  8034dc:	78 26                	js     803504 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8034de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034e2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034e5:	a3 00 80 d8 00 00 00 	movabs %eax,0xd88000
+  8034ec:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8034ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8034f3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8034f8:	48 b8 62 2a 80 00 00 	movabs $0x802a62,%rax
+  8034ff:	00 00 00 
+  803502:	ff d0                	call   *%rax
+}
+  803504:	c9                   	leave
+  803505:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803506:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80350b:	eb f7                	jmp    803504 <fsync+0x66>
+
+000000000080350d <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80350d:	55                   	push   %rbp
+  80350e:	48 89 e5             	mov    %rsp,%rbp
+  803511:	41 57                	push   %r15
+  803513:	41 56                	push   %r14
+  803515:	41 55                	push   %r13
+  803517:	41 54                	push   %r12
+  803519:	53                   	push   %rbx
+  80351a:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80351e:	49 bc 20 90 d8 00 00 	movabs $0xd89020,%r12
+  803525:	00 00 00 
+  803528:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80352d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803533:	49 bd f0 1e 80 00 00 	movabs $0x801ef0,%r13
+  80353a:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80353d:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803544:	00 00 00 
+  803547:	eb 0c                	jmp    803555 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803549:	83 c3 01             	add    $0x1,%ebx
+  80354c:	49 83 c4 28          	add    $0x28,%r12
+  803550:	83 fb 20             	cmp    $0x20,%ebx
+  803553:	74 33                	je     803588 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803555:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80355a:	74 ed                	je     803549 <flushall+0x3c>
+  80355c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803560:	89 df                	mov    %ebx,%edi
+  803562:	41 ff d5             	call   *%r13
+  803565:	85 c0                	test   %eax,%eax
+  803567:	78 e0                	js     803549 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803569:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  80356d:	41 8b 06             	mov    (%r14),%eax
+  803570:	39 07                	cmp    %eax,(%rdi)
+  803572:	75 d5                	jne    803549 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803574:	48 b8 28 2a 80 00 00 	movabs $0x802a28,%rax
+  80357b:	00 00 00 
+  80357e:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803580:	85 c0                	test   %eax,%eax
+  803582:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803586:	eb c1                	jmp    803549 <flushall+0x3c>
+    }
+    return res;
+}
+  803588:	44 89 f8             	mov    %r15d,%eax
+  80358b:	48 83 c4 18          	add    $0x18,%rsp
+  80358f:	5b                   	pop    %rbx
+  803590:	41 5c                	pop    %r12
+  803592:	41 5d                	pop    %r13
+  803594:	41 5e                	pop    %r14
+  803596:	41 5f                	pop    %r15
+  803598:	5d                   	pop    %rbp
+  803599:	c3                   	ret
+
+000000000080359a <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80359a:	55                   	push   %rbp
+  80359b:	48 89 e5             	mov    %rsp,%rbp
+  80359e:	53                   	push   %rbx
+  80359f:	48 83 ec 08          	sub    $0x8,%rsp
+  8035a3:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8035a6:	40 0f b6 c6          	movzbl %sil,%eax
+  8035aa:	a3 00 80 d8 00 00 00 	movabs %eax,0xd88000
+  8035b1:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8035b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8035b8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8035bd:	48 b8 62 2a 80 00 00 	movabs $0x802a62,%rax
+  8035c4:	00 00 00 
+  8035c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035c9:	85 c0                	test   %eax,%eax
+  8035cb:	78 23                	js     8035f0 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8035cd:	ba 58 06 00 00       	mov    $0x658,%edx
+  8035d2:	48 be 00 80 d8 00 00 	movabs $0xd88000,%rsi
+  8035d9:	00 00 00 
+  8035dc:	48 89 df             	mov    %rbx,%rdi
+  8035df:	48 b8 e1 10 80 00 00 	movabs $0x8010e1,%rax
+  8035e6:	00 00 00 
+  8035e9:	ff d0                	call   *%rax
+    return 0;
+  8035eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035f4:	c9                   	leave
+  8035f5:	c3                   	ret
+
+00000000008035f6 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8035f6:	55                   	push   %rbp
+  8035f7:	48 89 e5             	mov    %rsp,%rbp
+  8035fa:	53                   	push   %rbx
+  8035fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8035ff:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803602:	48 b8 ae 0c 80 00 00 	movabs $0x800cae,%rax
+  803609:	00 00 00 
+  80360c:	ff d0                	call   *%rax
+  80360e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803614:	77 35                	ja     80364b <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803616:	48 89 de             	mov    %rbx,%rsi
+  803619:	48 bf 00 80 d8 00 00 	movabs $0xd88000,%rdi
+  803620:	00 00 00 
+  803623:	48 b8 ec 0c 80 00 00 	movabs $0x800cec,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  80362f:	be 00 00 00 00       	mov    $0x0,%esi
+  803634:	bf 07 00 00 00       	mov    $0x7,%edi
+  803639:	48 b8 62 2a 80 00 00 	movabs $0x802a62,%rax
+  803640:	00 00 00 
+  803643:	ff d0                	call   *%rax
+}
+  803645:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803649:	c9                   	leave
+  80364a:	c3                   	ret
+        return -E_BAD_PATH;
+  80364b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803650:	eb f3                	jmp    803645 <remove+0x4f>
+
+0000000000803652 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803652:	55                   	push   %rbp
+  803653:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803656:	48 b8 0d 35 80 00 00 	movabs $0x80350d,%rax
+  80365d:	00 00 00 
+  803660:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803662:	be 00 00 00 00       	mov    $0x0,%esi
+  803667:	bf 08 00 00 00       	mov    $0x8,%edi
+  80366c:	48 b8 62 2a 80 00 00 	movabs $0x802a62,%rax
+  803673:	00 00 00 
+  803676:	ff d0                	call   *%rax
+}
+  803678:	5d                   	pop    %rbp
+  803679:	c3                   	ret
+
+000000000080367a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80367a:	55                   	push   %rbp
+  80367b:	48 89 e5             	mov    %rsp,%rbp
+  80367e:	41 54                	push   %r12
+  803680:	53                   	push   %rbx
+  803681:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803684:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  80368b:	00 00 00 
+  80368e:	ff d0                	call   *%rax
+  803690:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803693:	48 be 60 57 80 00 00 	movabs $0x805760,%rsi
+  80369a:	00 00 00 
+  80369d:	48 89 df             	mov    %rbx,%rdi
+  8036a0:	48 b8 ec 0c 80 00 00 	movabs $0x800cec,%rax
+  8036a7:	00 00 00 
+  8036aa:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8036ac:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8036b1:	41 2b 04 24          	sub    (%r12),%eax
+  8036b5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8036bb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8036c2:	00 00 00 
+    stat->st_dev = &devpipe;
+  8036c5:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8036cc:	00 00 00 
+  8036cf:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8036d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036db:	5b                   	pop    %rbx
+  8036dc:	41 5c                	pop    %r12
+  8036de:	5d                   	pop    %rbp
+  8036df:	c3                   	ret
+
+00000000008036e0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8036e0:	55                   	push   %rbp
+  8036e1:	48 89 e5             	mov    %rsp,%rbp
+  8036e4:	41 54                	push   %r12
+  8036e6:	53                   	push   %rbx
+  8036e7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8036ea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036ef:	48 89 fe             	mov    %rdi,%rsi
+  8036f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f7:	49 bc 2b 16 80 00 00 	movabs $0x80162b,%r12
+  8036fe:	00 00 00 
+  803701:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803704:	48 89 df             	mov    %rbx,%rdi
+  803707:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  80370e:	00 00 00 
+  803711:	ff d0                	call   *%rax
+  803713:	48 89 c6             	mov    %rax,%rsi
+  803716:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80371b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803720:	41 ff d4             	call   *%r12
+}
+  803723:	5b                   	pop    %rbx
+  803724:	41 5c                	pop    %r12
+  803726:	5d                   	pop    %rbp
+  803727:	c3                   	ret
+
+0000000000803728 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803728:	55                   	push   %rbp
+  803729:	48 89 e5             	mov    %rsp,%rbp
+  80372c:	41 57                	push   %r15
+  80372e:	41 56                	push   %r14
+  803730:	41 55                	push   %r13
+  803732:	41 54                	push   %r12
+  803734:	53                   	push   %rbx
+  803735:	48 83 ec 18          	sub    $0x18,%rsp
+  803739:	49 89 fc             	mov    %rdi,%r12
+  80373c:	49 89 f5             	mov    %rsi,%r13
+  80373f:	49 89 d7             	mov    %rdx,%r15
+  803742:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803746:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  80374d:	00 00 00 
+  803750:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803752:	4d 85 ff             	test   %r15,%r15
+  803755:	0f 84 af 00 00 00    	je     80380a <devpipe_write+0xe2>
+  80375b:	48 89 c3             	mov    %rax,%rbx
+  80375e:	4c 89 f8             	mov    %r15,%rax
+  803761:	4d 89 ef             	mov    %r13,%r15
+  803764:	4c 01 e8             	add    %r13,%rax
+  803767:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80376b:	49 bd 20 14 80 00 00 	movabs $0x801420,%r13
+  803772:	00 00 00 
+            sys_yield();
+  803775:	49 be bd 13 80 00 00 	movabs $0x8013bd,%r14
+  80377c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80377f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803782:	48 63 ce             	movslq %esi,%rcx
+  803785:	48 63 03             	movslq (%rbx),%rax
+  803788:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80378e:	48 39 c1             	cmp    %rax,%rcx
+  803791:	72 2e                	jb     8037c1 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803793:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803798:	48 89 da             	mov    %rbx,%rdx
+  80379b:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037a0:	4c 89 e7             	mov    %r12,%rdi
+  8037a3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8037a6:	85 c0                	test   %eax,%eax
+  8037a8:	74 66                	je     803810 <devpipe_write+0xe8>
+            sys_yield();
+  8037aa:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8037ad:	8b 73 04             	mov    0x4(%rbx),%esi
+  8037b0:	48 63 ce             	movslq %esi,%rcx
+  8037b3:	48 63 03             	movslq (%rbx),%rax
+  8037b6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8037bc:	48 39 c1             	cmp    %rax,%rcx
+  8037bf:	73 d2                	jae    803793 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8037c1:	41 0f b6 3f          	movzbl (%r15),%edi
+  8037c5:	48 89 ca             	mov    %rcx,%rdx
+  8037c8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8037cc:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8037d3:	08 10 20 
+  8037d6:	48 f7 e2             	mul    %rdx
+  8037d9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8037dd:	48 89 d0             	mov    %rdx,%rax
+  8037e0:	48 c1 e0 09          	shl    $0x9,%rax
+  8037e4:	48 29 d0             	sub    %rdx,%rax
+  8037e7:	48 c1 e0 03          	shl    $0x3,%rax
+  8037eb:	48 29 c1             	sub    %rax,%rcx
+  8037ee:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8037f3:	83 c6 01             	add    $0x1,%esi
+  8037f6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8037f9:	49 83 c7 01          	add    $0x1,%r15
+  8037fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803801:	49 39 c7             	cmp    %rax,%r15
+  803804:	0f 85 75 ff ff ff    	jne    80377f <devpipe_write+0x57>
+    return n;
+  80380a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80380e:	eb 05                	jmp    803815 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803810:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803815:	48 83 c4 18          	add    $0x18,%rsp
+  803819:	5b                   	pop    %rbx
+  80381a:	41 5c                	pop    %r12
+  80381c:	41 5d                	pop    %r13
+  80381e:	41 5e                	pop    %r14
+  803820:	41 5f                	pop    %r15
+  803822:	5d                   	pop    %rbp
+  803823:	c3                   	ret
+
+0000000000803824 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803824:	55                   	push   %rbp
+  803825:	48 89 e5             	mov    %rsp,%rbp
+  803828:	41 57                	push   %r15
+  80382a:	41 56                	push   %r14
+  80382c:	41 55                	push   %r13
+  80382e:	41 54                	push   %r12
+  803830:	53                   	push   %rbx
+  803831:	48 83 ec 18          	sub    $0x18,%rsp
+  803835:	49 89 fc             	mov    %rdi,%r12
+  803838:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80383c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803840:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  803847:	00 00 00 
+  80384a:	ff d0                	call   *%rax
+  80384c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80384f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803855:	49 bd 20 14 80 00 00 	movabs $0x801420,%r13
+  80385c:	00 00 00 
+            sys_yield();
+  80385f:	49 be bd 13 80 00 00 	movabs $0x8013bd,%r14
+  803866:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803869:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80386e:	74 7d                	je     8038ed <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803870:	8b 03                	mov    (%rbx),%eax
+  803872:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803875:	75 26                	jne    80389d <devpipe_read+0x79>
+            if (i > 0) return i;
+  803877:	4d 85 ff             	test   %r15,%r15
+  80387a:	75 77                	jne    8038f3 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80387c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803881:	48 89 da             	mov    %rbx,%rdx
+  803884:	be 00 10 00 00       	mov    $0x1000,%esi
+  803889:	4c 89 e7             	mov    %r12,%rdi
+  80388c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80388f:	85 c0                	test   %eax,%eax
+  803891:	74 72                	je     803905 <devpipe_read+0xe1>
+            sys_yield();
+  803893:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803896:	8b 03                	mov    (%rbx),%eax
+  803898:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80389b:	74 df                	je     80387c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80389d:	48 63 c8             	movslq %eax,%rcx
+  8038a0:	48 89 ca             	mov    %rcx,%rdx
+  8038a3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8038a7:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8038ae:	08 10 20 
+  8038b1:	48 89 d0             	mov    %rdx,%rax
+  8038b4:	48 f7 e6             	mul    %rsi
+  8038b7:	48 c1 ea 06          	shr    $0x6,%rdx
+  8038bb:	48 89 d0             	mov    %rdx,%rax
+  8038be:	48 c1 e0 09          	shl    $0x9,%rax
+  8038c2:	48 29 d0             	sub    %rdx,%rax
+  8038c5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8038cc:	00 
+  8038cd:	48 89 c8             	mov    %rcx,%rax
+  8038d0:	48 29 d0             	sub    %rdx,%rax
+  8038d3:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8038d8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8038dc:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8038e0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8038e3:	49 83 c7 01          	add    $0x1,%r15
+  8038e7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8038eb:	75 83                	jne    803870 <devpipe_read+0x4c>
+    return n;
+  8038ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038f1:	eb 03                	jmp    8038f6 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8038f3:	4c 89 f8             	mov    %r15,%rax
+}
+  8038f6:	48 83 c4 18          	add    $0x18,%rsp
+  8038fa:	5b                   	pop    %rbx
+  8038fb:	41 5c                	pop    %r12
+  8038fd:	41 5d                	pop    %r13
+  8038ff:	41 5e                	pop    %r14
+  803901:	41 5f                	pop    %r15
+  803903:	5d                   	pop    %rbp
+  803904:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80390a:	eb ea                	jmp    8038f6 <devpipe_read+0xd2>
+
+000000000080390c <pipe>:
+pipe(int pfd[2]) {
+  80390c:	55                   	push   %rbp
+  80390d:	48 89 e5             	mov    %rsp,%rbp
+  803910:	41 55                	push   %r13
+  803912:	41 54                	push   %r12
+  803914:	53                   	push   %rbx
+  803915:	48 83 ec 18          	sub    $0x18,%rsp
+  803919:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80391c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803920:	48 b8 90 1e 80 00 00 	movabs $0x801e90,%rax
+  803927:	00 00 00 
+  80392a:	ff d0                	call   *%rax
+  80392c:	89 c3                	mov    %eax,%ebx
+  80392e:	85 c0                	test   %eax,%eax
+  803930:	0f 88 a0 01 00 00    	js     803ad6 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803936:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80393b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803940:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803944:	bf 00 00 00 00       	mov    $0x0,%edi
+  803949:	48 b8 4c 14 80 00 00 	movabs $0x80144c,%rax
+  803950:	00 00 00 
+  803953:	ff d0                	call   *%rax
+  803955:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803957:	85 c0                	test   %eax,%eax
+  803959:	0f 88 77 01 00 00    	js     803ad6 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80395f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803963:	48 b8 90 1e 80 00 00 	movabs $0x801e90,%rax
+  80396a:	00 00 00 
+  80396d:	ff d0                	call   *%rax
+  80396f:	89 c3                	mov    %eax,%ebx
+  803971:	85 c0                	test   %eax,%eax
+  803973:	0f 88 43 01 00 00    	js     803abc <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803979:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80397e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803983:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803987:	bf 00 00 00 00       	mov    $0x0,%edi
+  80398c:	48 b8 4c 14 80 00 00 	movabs $0x80144c,%rax
+  803993:	00 00 00 
+  803996:	ff d0                	call   *%rax
+  803998:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80399a:	85 c0                	test   %eax,%eax
+  80399c:	0f 88 1a 01 00 00    	js     803abc <pipe+0x1b0>
+    va = fd2data(fd0);
+  8039a2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8039a6:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  8039ad:	00 00 00 
+  8039b0:	ff d0                	call   *%rax
+  8039b2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8039b5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039bf:	48 89 c6             	mov    %rax,%rsi
+  8039c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c7:	48 b8 4c 14 80 00 00 	movabs $0x80144c,%rax
+  8039ce:	00 00 00 
+  8039d1:	ff d0                	call   *%rax
+  8039d3:	89 c3                	mov    %eax,%ebx
+  8039d5:	85 c0                	test   %eax,%eax
+  8039d7:	0f 88 c5 00 00 00    	js     803aa2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8039dd:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8039e1:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  8039e8:	00 00 00 
+  8039eb:	ff d0                	call   *%rax
+  8039ed:	48 89 c1             	mov    %rax,%rcx
+  8039f0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8039f6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8039fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a01:	4c 89 ee             	mov    %r13,%rsi
+  803a04:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a09:	48 b8 b3 14 80 00 00 	movabs $0x8014b3,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+  803a15:	89 c3                	mov    %eax,%ebx
+  803a17:	85 c0                	test   %eax,%eax
+  803a19:	78 6e                	js     803a89 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a1b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a20:	4c 89 ef             	mov    %r13,%rdi
+  803a23:	48 b8 ee 13 80 00 00 	movabs $0x8013ee,%rax
+  803a2a:	00 00 00 
+  803a2d:	ff d0                	call   *%rax
+  803a2f:	83 f8 02             	cmp    $0x2,%eax
+  803a32:	0f 85 ab 00 00 00    	jne    803ae3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a38:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803a3f:	00 00 
+  803a41:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a45:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a47:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a4b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a52:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a56:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803a58:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a5c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803a63:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a67:	48 bb 62 1e 80 00 00 	movabs $0x801e62,%rbx
+  803a6e:	00 00 00 
+  803a71:	ff d3                	call   *%rbx
+  803a73:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803a77:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a7b:	ff d3                	call   *%rbx
+  803a7d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803a82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a87:	eb 4d                	jmp    803ad6 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803a89:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a8e:	4c 89 ee             	mov    %r13,%rsi
+  803a91:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a96:	48 b8 2b 16 80 00 00 	movabs $0x80162b,%rax
+  803a9d:	00 00 00 
+  803aa0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803aa2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aa7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803aab:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ab0:	48 b8 2b 16 80 00 00 	movabs $0x80162b,%rax
+  803ab7:	00 00 00 
+  803aba:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803abc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ac1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ac5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aca:	48 b8 2b 16 80 00 00 	movabs $0x80162b,%rax
+  803ad1:	00 00 00 
+  803ad4:	ff d0                	call   *%rax
+}
+  803ad6:	89 d8                	mov    %ebx,%eax
+  803ad8:	48 83 c4 18          	add    $0x18,%rsp
+  803adc:	5b                   	pop    %rbx
+  803add:	41 5c                	pop    %r12
+  803adf:	41 5d                	pop    %r13
+  803ae1:	5d                   	pop    %rbp
+  803ae2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803ae3:	48 b9 90 57 80 00 00 	movabs $0x805790,%rcx
+  803aea:	00 00 00 
+  803aed:	48 ba 67 57 80 00 00 	movabs $0x805767,%rdx
+  803af4:	00 00 00 
+  803af7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803afc:	48 bf 7c 57 80 00 00 	movabs $0x80577c,%rdi
+  803b03:	00 00 00 
+  803b06:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0b:	49 b8 24 02 80 00 00 	movabs $0x800224,%r8
+  803b12:	00 00 00 
+  803b15:	41 ff d0             	call   *%r8
+
+0000000000803b18 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b18:	55                   	push   %rbp
+  803b19:	48 89 e5             	mov    %rsp,%rbp
+  803b1c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b20:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b24:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  803b2b:	00 00 00 
+  803b2e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b30:	85 c0                	test   %eax,%eax
+  803b32:	78 35                	js     803b69 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b34:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b38:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  803b3f:	00 00 00 
+  803b42:	ff d0                	call   *%rax
+  803b44:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b47:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b4c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b51:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b55:	48 b8 20 14 80 00 00 	movabs $0x801420,%rax
+  803b5c:	00 00 00 
+  803b5f:	ff d0                	call   *%rax
+  803b61:	85 c0                	test   %eax,%eax
+  803b63:	0f 94 c0             	sete   %al
+  803b66:	0f b6 c0             	movzbl %al,%eax
+}
+  803b69:	c9                   	leave
+  803b6a:	c3                   	ret
+
+0000000000803b6b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803b6b:	48 89 f8             	mov    %rdi,%rax
+  803b6e:	48 c1 e8 27          	shr    $0x27,%rax
+  803b72:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803b79:	7f 00 00 
+  803b7c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b80:	f6 c2 01             	test   $0x1,%dl
+  803b83:	74 6d                	je     803bf2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803b85:	48 89 f8             	mov    %rdi,%rax
+  803b88:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b8c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803b93:	7f 00 00 
+  803b96:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b9a:	f6 c2 01             	test   $0x1,%dl
+  803b9d:	74 62                	je     803c01 <get_uvpt_entry+0x96>
+  803b9f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ba6:	7f 00 00 
+  803ba9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bad:	f6 c2 80             	test   $0x80,%dl
+  803bb0:	75 4f                	jne    803c01 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803bb2:	48 89 f8             	mov    %rdi,%rax
+  803bb5:	48 c1 e8 15          	shr    $0x15,%rax
+  803bb9:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803bc0:	7f 00 00 
+  803bc3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bc7:	f6 c2 01             	test   $0x1,%dl
+  803bca:	74 44                	je     803c10 <get_uvpt_entry+0xa5>
+  803bcc:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803bd3:	7f 00 00 
+  803bd6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bda:	f6 c2 80             	test   $0x80,%dl
+  803bdd:	75 31                	jne    803c10 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803bdf:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803be3:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803bea:	7f 00 00 
+  803bed:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803bf1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803bf2:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803bf9:	7f 00 00 
+  803bfc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c00:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c01:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803c08:	7f 00 00 
+  803c0b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c0f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c10:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803c17:	7f 00 00 
+  803c1a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c1e:	c3                   	ret
+
+0000000000803c1f <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803c1f:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803c22:	48 89 f9             	mov    %rdi,%rcx
+  803c25:	48 c1 e9 27          	shr    $0x27,%rcx
+  803c29:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803c30:	7f 00 00 
+  803c33:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803c37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803c3e:	f6 c1 01             	test   $0x1,%cl
+  803c41:	0f 84 b2 00 00 00    	je     803cf9 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803c47:	48 89 f9             	mov    %rdi,%rcx
+  803c4a:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803c4e:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803c55:	7f 00 00 
+  803c58:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803c5c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803c63:	40 f6 c6 01          	test   $0x1,%sil
+  803c67:	0f 84 8c 00 00 00    	je     803cf9 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803c6d:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803c74:	7f 00 00 
+  803c77:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803c7b:	a8 80                	test   $0x80,%al
+  803c7d:	75 7b                	jne    803cfa <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803c7f:	48 89 f9             	mov    %rdi,%rcx
+  803c82:	48 c1 e9 15          	shr    $0x15,%rcx
+  803c86:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803c8d:	7f 00 00 
+  803c90:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803c94:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803c9b:	40 f6 c6 01          	test   $0x1,%sil
+  803c9f:	74 58                	je     803cf9 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  803ca1:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803ca8:	7f 00 00 
+  803cab:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803caf:	a8 80                	test   $0x80,%al
+  803cb1:	75 6c                	jne    803d1f <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803cb3:	48 89 f9             	mov    %rdi,%rcx
+  803cb6:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803cba:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803cc1:	7f 00 00 
+  803cc4:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803cc8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  803ccf:	40 f6 c6 01          	test   $0x1,%sil
+  803cd3:	74 24                	je     803cf9 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  803cd5:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803cdc:	7f 00 00 
+  803cdf:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803ce3:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803cea:	ff ff 7f 
+  803ced:	48 21 c8             	and    %rcx,%rax
+  803cf0:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803cf6:	48 09 d0             	or     %rdx,%rax
+}
+  803cf9:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  803cfa:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803d01:	7f 00 00 
+  803d04:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d08:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d0f:	ff ff 7f 
+  803d12:	48 21 c8             	and    %rcx,%rax
+  803d15:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  803d1b:	48 01 d0             	add    %rdx,%rax
+  803d1e:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  803d1f:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803d26:	7f 00 00 
+  803d29:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803d2d:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  803d34:	ff ff 7f 
+  803d37:	48 21 c8             	and    %rcx,%rax
+  803d3a:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  803d40:	48 01 d0             	add    %rdx,%rax
+  803d43:	c3                   	ret
+
+0000000000803d44 <get_prot>:
+
+int
+get_prot(void *va) {
+  803d44:	55                   	push   %rbp
+  803d45:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803d48:	48 b8 6b 3b 80 00 00 	movabs $0x803b6b,%rax
+  803d4f:	00 00 00 
+  803d52:	ff d0                	call   *%rax
+  803d54:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803d57:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803d5c:	89 c1                	mov    %eax,%ecx
+  803d5e:	83 c9 04             	or     $0x4,%ecx
+  803d61:	f6 c2 01             	test   $0x1,%dl
+  803d64:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803d67:	89 c1                	mov    %eax,%ecx
+  803d69:	83 c9 02             	or     $0x2,%ecx
+  803d6c:	f6 c2 02             	test   $0x2,%dl
+  803d6f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803d72:	89 c1                	mov    %eax,%ecx
+  803d74:	83 c9 01             	or     $0x1,%ecx
+  803d77:	48 85 d2             	test   %rdx,%rdx
+  803d7a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803d7d:	89 c1                	mov    %eax,%ecx
+  803d7f:	83 c9 40             	or     $0x40,%ecx
+  803d82:	f6 c6 04             	test   $0x4,%dh
+  803d85:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803d88:	5d                   	pop    %rbp
+  803d89:	c3                   	ret
+
+0000000000803d8a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803d8a:	55                   	push   %rbp
+  803d8b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803d8e:	48 b8 6b 3b 80 00 00 	movabs $0x803b6b,%rax
+  803d95:	00 00 00 
+  803d98:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803d9a:	48 c1 e8 06          	shr    $0x6,%rax
+  803d9e:	83 e0 01             	and    $0x1,%eax
+}
+  803da1:	5d                   	pop    %rbp
+  803da2:	c3                   	ret
+
+0000000000803da3 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803da3:	55                   	push   %rbp
+  803da4:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803da7:	48 b8 6b 3b 80 00 00 	movabs $0x803b6b,%rax
+  803dae:	00 00 00 
+  803db1:	ff d0                	call   *%rax
+  803db3:	83 e0 01             	and    $0x1,%eax
+}
+  803db6:	5d                   	pop    %rbp
+  803db7:	c3                   	ret
+
+0000000000803db8 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  803db8:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  803dbf:	7f 00 00 
+  803dc2:	a8 01                	test   $0x1,%al
+  803dc4:	75 06                	jne    803dcc <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  803dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dcb:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803dcc:	55                   	push   %rbp
+  803dcd:	48 89 e5             	mov    %rsp,%rbp
+  803dd0:	41 57                	push   %r15
+  803dd2:	41 56                	push   %r14
+  803dd4:	41 55                	push   %r13
+  803dd6:	41 54                	push   %r12
+  803dd8:	53                   	push   %rbx
+  803dd9:	48 83 ec 18          	sub    $0x18,%rsp
+  803ddd:	49 89 fe             	mov    %rdi,%r14
+  803de0:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803de3:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  803dea:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803deb:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  803df2:	7f 00 00 
+  803df5:	e9 81 00 00 00       	jmp    803e7b <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  803dfa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803e01:	49 39 dd             	cmp    %rbx,%r13
+  803e04:	74 2b                	je     803e31 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  803e06:	48 89 d8             	mov    %rbx,%rax
+  803e09:	48 c1 e8 0c          	shr    $0xc,%rax
+  803e0d:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  803e11:	f6 c2 01             	test   $0x1,%dl
+  803e14:	74 e4                	je     803dfa <foreach_shared_region+0x42>
+  803e16:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  803e1a:	f6 c4 04             	test   $0x4,%ah
+  803e1d:	74 db                	je     803dfa <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  803e1f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803e26:	4c 89 fa             	mov    %r15,%rdx
+  803e29:	48 89 df             	mov    %rbx,%rdi
+  803e2c:	41 ff d6             	call   *%r14
+  803e2f:	eb c9                	jmp    803dfa <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803e31:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  803e38:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  803e3c:	74 22                	je     803e60 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  803e3e:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  803e45:	48 89 d8             	mov    %rbx,%rax
+  803e48:	48 c1 e8 15          	shr    $0x15,%rax
+  803e4c:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  803e53:	7f 00 00 
+  803e56:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803e5a:	a8 01                	test   $0x1,%al
+  803e5c:	74 d3                	je     803e31 <foreach_shared_region+0x79>
+  803e5e:	eb a6                	jmp    803e06 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  803e60:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  803e67:	40 
+  803e68:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e6c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e73:	00 00 00 
+  803e76:	48 39 c1             	cmp    %rax,%rcx
+  803e79:	74 31                	je     803eac <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  803e7b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e7f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e83:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  803e8a:	7f 00 00 
+  803e8d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803e91:	a8 01                	test   $0x1,%al
+  803e93:	74 cb                	je     803e60 <foreach_shared_region+0xa8>
+  803e95:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e99:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  803ea0:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  803ea6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803eaa:	eb 92                	jmp    803e3e <foreach_shared_region+0x86>
+}
+  803eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb1:	48 83 c4 18          	add    $0x18,%rsp
+  803eb5:	5b                   	pop    %rbx
+  803eb6:	41 5c                	pop    %r12
+  803eb8:	41 5d                	pop    %r13
+  803eba:	41 5e                	pop    %r14
+  803ebc:	41 5f                	pop    %r15
+  803ebe:	5d                   	pop    %rbp
+  803ebf:	c3                   	ret
+
+0000000000803ec0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec5:	c3                   	ret
+
+0000000000803ec6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803ec6:	55                   	push   %rbp
+  803ec7:	48 89 e5             	mov    %rsp,%rbp
+  803eca:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803ecd:	48 be b4 57 80 00 00 	movabs $0x8057b4,%rsi
+  803ed4:	00 00 00 
+  803ed7:	48 b8 ec 0c 80 00 00 	movabs $0x800cec,%rax
+  803ede:	00 00 00 
+  803ee1:	ff d0                	call   *%rax
+    return 0;
+}
+  803ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee8:	5d                   	pop    %rbp
+  803ee9:	c3                   	ret
+
+0000000000803eea <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803eea:	55                   	push   %rbp
+  803eeb:	48 89 e5             	mov    %rsp,%rbp
+  803eee:	41 57                	push   %r15
+  803ef0:	41 56                	push   %r14
+  803ef2:	41 55                	push   %r13
+  803ef4:	41 54                	push   %r12
+  803ef6:	53                   	push   %rbx
+  803ef7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803efe:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803f05:	48 85 d2             	test   %rdx,%rdx
+  803f08:	74 7a                	je     803f84 <devcons_write+0x9a>
+  803f0a:	49 89 d6             	mov    %rdx,%r14
+  803f0d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f13:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803f18:	49 bf 7a 10 80 00 00 	movabs $0x80107a,%r15
+  803f1f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803f22:	4c 89 f3             	mov    %r14,%rbx
+  803f25:	48 29 f3             	sub    %rsi,%rbx
+  803f28:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803f2d:	48 39 c3             	cmp    %rax,%rbx
+  803f30:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803f34:	4c 63 eb             	movslq %ebx,%r13
+  803f37:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803f3e:	48 01 c6             	add    %rax,%rsi
+  803f41:	4c 89 ea             	mov    %r13,%rdx
+  803f44:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803f4b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803f4e:	4c 89 ee             	mov    %r13,%rsi
+  803f51:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803f58:	48 b8 c3 12 80 00 00 	movabs $0x8012c3,%rax
+  803f5f:	00 00 00 
+  803f62:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803f64:	41 01 dc             	add    %ebx,%r12d
+  803f67:	49 63 f4             	movslq %r12d,%rsi
+  803f6a:	4c 39 f6             	cmp    %r14,%rsi
+  803f6d:	72 b3                	jb     803f22 <devcons_write+0x38>
+    return res;
+  803f6f:	49 63 c4             	movslq %r12d,%rax
+}
+  803f72:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803f79:	5b                   	pop    %rbx
+  803f7a:	41 5c                	pop    %r12
+  803f7c:	41 5d                	pop    %r13
+  803f7e:	41 5e                	pop    %r14
+  803f80:	41 5f                	pop    %r15
+  803f82:	5d                   	pop    %rbp
+  803f83:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803f84:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f8a:	eb e3                	jmp    803f6f <devcons_write+0x85>
+
+0000000000803f8c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f8c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803f8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f94:	48 85 c0             	test   %rax,%rax
+  803f97:	74 55                	je     803fee <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f99:	55                   	push   %rbp
+  803f9a:	48 89 e5             	mov    %rsp,%rbp
+  803f9d:	41 55                	push   %r13
+  803f9f:	41 54                	push   %r12
+  803fa1:	53                   	push   %rbx
+  803fa2:	48 83 ec 08          	sub    $0x8,%rsp
+  803fa6:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803fa9:	48 bb f0 12 80 00 00 	movabs $0x8012f0,%rbx
+  803fb0:	00 00 00 
+  803fb3:	49 bc bd 13 80 00 00 	movabs $0x8013bd,%r12
+  803fba:	00 00 00 
+  803fbd:	eb 03                	jmp    803fc2 <devcons_read+0x36>
+  803fbf:	41 ff d4             	call   *%r12
+  803fc2:	ff d3                	call   *%rbx
+  803fc4:	85 c0                	test   %eax,%eax
+  803fc6:	74 f7                	je     803fbf <devcons_read+0x33>
+    if (c < 0) return c;
+  803fc8:	48 63 d0             	movslq %eax,%rdx
+  803fcb:	78 13                	js     803fe0 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803fcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fd2:	83 f8 04             	cmp    $0x4,%eax
+  803fd5:	74 09                	je     803fe0 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803fd7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803fdb:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803fe0:	48 89 d0             	mov    %rdx,%rax
+  803fe3:	48 83 c4 08          	add    $0x8,%rsp
+  803fe7:	5b                   	pop    %rbx
+  803fe8:	41 5c                	pop    %r12
+  803fea:	41 5d                	pop    %r13
+  803fec:	5d                   	pop    %rbp
+  803fed:	c3                   	ret
+  803fee:	48 89 d0             	mov    %rdx,%rax
+  803ff1:	c3                   	ret
+
+0000000000803ff2 <cputchar>:
+cputchar(int ch) {
+  803ff2:	55                   	push   %rbp
+  803ff3:	48 89 e5             	mov    %rsp,%rbp
+  803ff6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803ffa:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803ffe:	be 01 00 00 00       	mov    $0x1,%esi
+  804003:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804007:	48 b8 c3 12 80 00 00 	movabs $0x8012c3,%rax
+  80400e:	00 00 00 
+  804011:	ff d0                	call   *%rax
+}
+  804013:	c9                   	leave
+  804014:	c3                   	ret
+
+0000000000804015 <getchar>:
+getchar(void) {
+  804015:	55                   	push   %rbp
+  804016:	48 89 e5             	mov    %rsp,%rbp
+  804019:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80401d:	ba 01 00 00 00       	mov    $0x1,%edx
+  804022:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804026:	bf 00 00 00 00       	mov    $0x0,%edi
+  80402b:	48 b8 d3 21 80 00 00 	movabs $0x8021d3,%rax
+  804032:	00 00 00 
+  804035:	ff d0                	call   *%rax
+  804037:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804039:	85 c0                	test   %eax,%eax
+  80403b:	78 06                	js     804043 <getchar+0x2e>
+  80403d:	74 08                	je     804047 <getchar+0x32>
+  80403f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804043:	89 d0                	mov    %edx,%eax
+  804045:	c9                   	leave
+  804046:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804047:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80404c:	eb f5                	jmp    804043 <getchar+0x2e>
+
+000000000080404e <iscons>:
+iscons(int fdnum) {
+  80404e:	55                   	push   %rbp
+  80404f:	48 89 e5             	mov    %rsp,%rbp
+  804052:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804056:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80405a:	48 b8 f0 1e 80 00 00 	movabs $0x801ef0,%rax
+  804061:	00 00 00 
+  804064:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804066:	85 c0                	test   %eax,%eax
+  804068:	78 18                	js     804082 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80406a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80406e:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804075:	00 00 00 
+  804078:	8b 00                	mov    (%rax),%eax
+  80407a:	39 02                	cmp    %eax,(%rdx)
+  80407c:	0f 94 c0             	sete   %al
+  80407f:	0f b6 c0             	movzbl %al,%eax
+}
+  804082:	c9                   	leave
+  804083:	c3                   	ret
+
+0000000000804084 <opencons>:
+opencons(void) {
+  804084:	55                   	push   %rbp
+  804085:	48 89 e5             	mov    %rsp,%rbp
+  804088:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80408c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804090:	48 b8 90 1e 80 00 00 	movabs $0x801e90,%rax
+  804097:	00 00 00 
+  80409a:	ff d0                	call   *%rax
+  80409c:	85 c0                	test   %eax,%eax
+  80409e:	78 49                	js     8040e9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8040a0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040aa:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8040ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040b3:	48 b8 4c 14 80 00 00 	movabs $0x80144c,%rax
+  8040ba:	00 00 00 
+  8040bd:	ff d0                	call   *%rax
+  8040bf:	85 c0                	test   %eax,%eax
+  8040c1:	78 26                	js     8040e9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8040c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040c7:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8040ce:	00 00 
+  8040d0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8040d2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040d6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8040dd:	48 b8 62 1e 80 00 00 	movabs $0x801e62,%rax
+  8040e4:	00 00 00 
+  8040e7:	ff d0                	call   *%rax
+}
+  8040e9:	c9                   	leave
+  8040ea:	c3                   	ret
+
+00000000008040eb <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8040eb:	55                   	push   %rbp
+  8040ec:	48 89 e5             	mov    %rsp,%rbp
+  8040ef:	41 55                	push   %r13
+  8040f1:	41 54                	push   %r12
+  8040f3:	53                   	push   %rbx
+  8040f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8040f8:	49 89 fc             	mov    %rdi,%r12
+  8040fb:	48 89 f7             	mov    %rsi,%rdi
+  8040fe:	48 89 d3             	mov    %rdx,%rbx
+  804101:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804104:	48 85 f6             	test   %rsi,%rsi
+  804107:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80410e:	00 00 00 
+  804111:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804115:	be 00 10 00 00       	mov    $0x1000,%esi
+  80411a:	48 85 d2             	test   %rdx,%rdx
+  80411d:	74 03                	je     804122 <ipc_recv+0x37>
+  80411f:	48 8b 32             	mov    (%rdx),%rsi
+  804122:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  804129:	00 00 00 
+  80412c:	ff d0                	call   *%rax
+    if (errno) {
+  80412e:	85 c0                	test   %eax,%eax
+  804130:	74 1c                	je     80414e <ipc_recv+0x63>
+        if (from_env_store)
+  804132:	4d 85 e4             	test   %r12,%r12
+  804135:	74 08                	je     80413f <ipc_recv+0x54>
+            *from_env_store = 0;
+  804137:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80413e:	00 
+
+        if (perm_store)
+  80413f:	4d 85 ed             	test   %r13,%r13
+  804142:	74 74                	je     8041b8 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804144:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80414b:	00 
+  80414c:	eb 6a                	jmp    8041b8 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  80414e:	4d 85 e4             	test   %r12,%r12
+  804151:	74 14                	je     804167 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804153:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  80415a:	00 00 00 
+  80415d:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804163:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804167:	48 85 db             	test   %rbx,%rbx
+  80416a:	74 23                	je     80418f <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80416c:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  804173:	00 00 00 
+  804176:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80417c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804181:	85 c9                	test   %ecx,%ecx
+  804183:	74 07                	je     80418c <ipc_recv+0xa1>
+  804185:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80418c:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  80418f:	4d 85 ed             	test   %r13,%r13
+  804192:	74 14                	je     8041a8 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804194:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  80419b:	00 00 00 
+  80419e:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8041a4:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8041a8:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  8041af:	00 00 00 
+  8041b2:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8041b8:	48 83 c4 08          	add    $0x8,%rsp
+  8041bc:	5b                   	pop    %rbx
+  8041bd:	41 5c                	pop    %r12
+  8041bf:	41 5d                	pop    %r13
+  8041c1:	5d                   	pop    %rbp
+  8041c2:	c3                   	ret
+
+00000000008041c3 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8041c3:	55                   	push   %rbp
+  8041c4:	48 89 e5             	mov    %rsp,%rbp
+  8041c7:	41 55                	push   %r13
+  8041c9:	41 54                	push   %r12
+  8041cb:	53                   	push   %rbx
+  8041cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8041d0:	49 89 fc             	mov    %rdi,%r12
+  8041d3:	48 89 f7             	mov    %rsi,%rdi
+  8041d6:	48 89 d3             	mov    %rdx,%rbx
+  8041d9:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8041dc:	48 85 f6             	test   %rsi,%rsi
+  8041df:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041e6:	00 00 00 
+  8041e9:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8041ed:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041f2:	48 85 d2             	test   %rdx,%rdx
+  8041f5:	74 03                	je     8041fa <ipc_try_recv+0x37>
+  8041f7:	48 8b 32             	mov    (%rdx),%rsi
+  8041fa:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  804201:	00 00 00 
+  804204:	ff d0                	call   *%rax
+    if (errno) {
+  804206:	85 c0                	test   %eax,%eax
+  804208:	75 75                	jne    80427f <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80420a:	4d 85 e4             	test   %r12,%r12
+  80420d:	74 14                	je     804223 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  80420f:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  804216:	00 00 00 
+  804219:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80421f:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804223:	48 85 db             	test   %rbx,%rbx
+  804226:	74 23                	je     80424b <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804228:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  80422f:	00 00 00 
+  804232:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80423d:	85 c9                	test   %ecx,%ecx
+  80423f:	74 07                	je     804248 <ipc_try_recv+0x85>
+  804241:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804248:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80424b:	4d 85 ed             	test   %r13,%r13
+  80424e:	74 14                	je     804264 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804250:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  804257:	00 00 00 
+  80425a:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804260:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804264:	48 a1 00 70 c0 00 00 	movabs 0xc07000,%rax
+  80426b:	00 00 00 
+  80426e:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804274:	48 83 c4 08          	add    $0x8,%rsp
+  804278:	5b                   	pop    %rbx
+  804279:	41 5c                	pop    %r12
+  80427b:	41 5d                	pop    %r13
+  80427d:	5d                   	pop    %rbp
+  80427e:	c3                   	ret
+        if (from_env_store)
+  80427f:	4d 85 e4             	test   %r12,%r12
+  804282:	74 08                	je     80428c <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804284:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80428b:	00 
+        if (perm_store)
+  80428c:	4d 85 ed             	test   %r13,%r13
+  80428f:	74 e3                	je     804274 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804291:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804298:	00 
+  804299:	eb d9                	jmp    804274 <ipc_try_recv+0xb1>
+
+000000000080429b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80429b:	55                   	push   %rbp
+  80429c:	48 89 e5             	mov    %rsp,%rbp
+  80429f:	41 57                	push   %r15
+  8042a1:	41 56                	push   %r14
+  8042a3:	41 55                	push   %r13
+  8042a5:	41 54                	push   %r12
+  8042a7:	53                   	push   %rbx
+  8042a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8042ac:	41 89 fd             	mov    %edi,%r13d
+  8042af:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8042b2:	48 89 d3             	mov    %rdx,%rbx
+  8042b5:	49 89 cc             	mov    %rcx,%r12
+  8042b8:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8042bc:	48 85 d2             	test   %rdx,%rdx
+  8042bf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8042c6:	00 00 00 
+  8042c9:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8042cd:	49 be cd 17 80 00 00 	movabs $0x8017cd,%r14
+  8042d4:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8042d7:	49 bf bd 13 80 00 00 	movabs $0x8013bd,%r15
+  8042de:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8042e1:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8042e4:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8042e8:	4c 89 e1             	mov    %r12,%rcx
+  8042eb:	48 89 da             	mov    %rbx,%rdx
+  8042ee:	44 89 ef             	mov    %r13d,%edi
+  8042f1:	41 ff d6             	call   *%r14
+  8042f4:	85 c0                	test   %eax,%eax
+  8042f6:	74 37                	je     80432f <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8042f8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8042fb:	75 05                	jne    804302 <ipc_send+0x67>
+        sys_yield();
+  8042fd:	41 ff d7             	call   *%r15
+  804300:	eb df                	jmp    8042e1 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804302:	89 c1                	mov    %eax,%ecx
+  804304:	48 ba c0 57 80 00 00 	movabs $0x8057c0,%rdx
+  80430b:	00 00 00 
+  80430e:	be 65 00 00 00       	mov    $0x65,%esi
+  804313:	48 bf db 57 80 00 00 	movabs $0x8057db,%rdi
+  80431a:	00 00 00 
+  80431d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804322:	49 b8 24 02 80 00 00 	movabs $0x800224,%r8
+  804329:	00 00 00 
+  80432c:	41 ff d0             	call   *%r8
+    }
+}
+  80432f:	48 83 c4 18          	add    $0x18,%rsp
+  804333:	5b                   	pop    %rbx
+  804334:	41 5c                	pop    %r12
+  804336:	41 5d                	pop    %r13
+  804338:	41 5e                	pop    %r14
+  80433a:	41 5f                	pop    %r15
+  80433c:	5d                   	pop    %rbp
+  80433d:	c3                   	ret
+
+000000000080433e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80433e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804343:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80434a:	00 00 00 
+  80434d:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804354:	48 01 ca             	add    %rcx,%rdx
+  804357:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  80435d:	39 fa                	cmp    %edi,%edx
+  80435f:	74 12                	je     804373 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804361:	48 83 c0 01          	add    $0x1,%rax
+  804365:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80436b:	75 e0                	jne    80434d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80436d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804372:	c3                   	ret
+            return envs[i].env_id;
+  804373:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80437a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804381:	00 00 00 
+  804384:	48 01 d0             	add    %rdx,%rax
+  804387:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80438d:	c3                   	ret
+
+000000000080438e <__text_end>:
+  80438e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804395:	00 00 00 
+  804398:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80439f:	00 00 00 
+  8043a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043a9:	00 00 00 
+  8043ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043b3:	00 00 00 
+  8043b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043bd:	00 00 00 
+  8043c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043c7:	00 00 00 
+  8043ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043d1:	00 00 00 
+  8043d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043db:	00 00 00 
+  8043de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043e5:	00 00 00 
+  8043e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043ef:	00 00 00 
+  8043f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8043f9:	00 00 00 
+  8043fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804403:	00 00 00 
+  804406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80440d:	00 00 00 
+  804410:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804417:	00 00 00 
+  80441a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804421:	00 00 00 
+  804424:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80442b:	00 00 00 
+  80442e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804435:	00 00 00 
+  804438:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80443f:	00 00 00 
+  804442:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804449:	00 00 00 
+  80444c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804453:	00 00 00 
+  804456:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80445d:	00 00 00 
+  804460:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804467:	00 00 00 
+  80446a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804471:	00 00 00 
+  804474:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80447b:	00 00 00 
+  80447e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804485:	00 00 00 
+  804488:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80448f:	00 00 00 
+  804492:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804499:	00 00 00 
+  80449c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044a3:	00 00 00 
+  8044a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044ad:	00 00 00 
+  8044b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044b7:	00 00 00 
+  8044ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044c1:	00 00 00 
+  8044c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044cb:	00 00 00 
+  8044ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044d5:	00 00 00 
+  8044d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044df:	00 00 00 
+  8044e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044e9:	00 00 00 
+  8044ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044f3:	00 00 00 
+  8044f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8044fd:	00 00 00 
+  804500:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804507:	00 00 00 
+  80450a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804511:	00 00 00 
+  804514:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80451b:	00 00 00 
+  80451e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804525:	00 00 00 
+  804528:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80452f:	00 00 00 
+  804532:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804539:	00 00 00 
+  80453c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804543:	00 00 00 
+  804546:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80454d:	00 00 00 
+  804550:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804557:	00 00 00 
+  80455a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804561:	00 00 00 
+  804564:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80456b:	00 00 00 
+  80456e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804575:	00 00 00 
+  804578:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80457f:	00 00 00 
+  804582:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804589:	00 00 00 
+  80458c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804593:	00 00 00 
+  804596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80459d:	00 00 00 
+  8045a0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045a7:	00 00 00 
+  8045aa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045b1:	00 00 00 
+  8045b4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045bb:	00 00 00 
+  8045be:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045c5:	00 00 00 
+  8045c8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045cf:	00 00 00 
+  8045d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045d9:	00 00 00 
+  8045dc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045e3:	00 00 00 
+  8045e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045ed:	00 00 00 
+  8045f0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8045f7:	00 00 00 
+  8045fa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804601:	00 00 00 
+  804604:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80460b:	00 00 00 
+  80460e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804615:	00 00 00 
+  804618:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80461f:	00 00 00 
+  804622:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804629:	00 00 00 
+  80462c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804633:	00 00 00 
+  804636:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80463d:	00 00 00 
+  804640:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804647:	00 00 00 
+  80464a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804651:	00 00 00 
+  804654:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80465b:	00 00 00 
+  80465e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804665:	00 00 00 
+  804668:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80466f:	00 00 00 
+  804672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804679:	00 00 00 
+  80467c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804683:	00 00 00 
+  804686:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80468d:	00 00 00 
+  804690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804697:	00 00 00 
+  80469a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a1:	00 00 00 
+  8046a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ab:	00 00 00 
+  8046ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b5:	00 00 00 
+  8046b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bf:	00 00 00 
+  8046c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c9:	00 00 00 
+  8046cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d3:	00 00 00 
+  8046d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dd:	00 00 00 
+  8046e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e7:	00 00 00 
+  8046ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f1:	00 00 00 
+  8046f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fb:	00 00 00 
+  8046fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804705:	00 00 00 
+  804708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470f:	00 00 00 
+  804712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804719:	00 00 00 
+  80471c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804723:	00 00 00 
+  804726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472d:	00 00 00 
+  804730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804737:	00 00 00 
+  80473a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804741:	00 00 00 
+  804744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474b:	00 00 00 
+  80474e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804755:	00 00 00 
+  804758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475f:	00 00 00 
+  804762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804769:	00 00 00 
+  80476c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804773:	00 00 00 
+  804776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477d:	00 00 00 
+  804780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804787:	00 00 00 
+  80478a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804791:	00 00 00 
+  804794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479b:	00 00 00 
+  80479e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a5:	00 00 00 
+  8047a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047af:	00 00 00 
+  8047b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b9:	00 00 00 
+  8047bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c3:	00 00 00 
+  8047c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cd:	00 00 00 
+  8047d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d7:	00 00 00 
+  8047da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e1:	00 00 00 
+  8047e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047eb:	00 00 00 
+  8047ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f5:	00 00 00 
+  8047f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ff:	00 00 00 
+  804802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804809:	00 00 00 
+  80480c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804813:	00 00 00 
+  804816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481d:	00 00 00 
+  804820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804827:	00 00 00 
+  80482a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804831:	00 00 00 
+  804834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483b:	00 00 00 
+  80483e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804845:	00 00 00 
+  804848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484f:	00 00 00 
+  804852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804859:	00 00 00 
+  80485c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804863:	00 00 00 
+  804866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486d:	00 00 00 
+  804870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804877:	00 00 00 
+  80487a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804881:	00 00 00 
+  804884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488b:	00 00 00 
+  80488e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804895:	00 00 00 
+  804898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489f:	00 00 00 
+  8048a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a9:	00 00 00 
+  8048ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b3:	00 00 00 
+  8048b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bd:	00 00 00 
+  8048c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c7:	00 00 00 
+  8048ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d1:	00 00 00 
+  8048d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048db:	00 00 00 
+  8048de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e5:	00 00 00 
+  8048e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ef:	00 00 00 
+  8048f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f9:	00 00 00 
+  8048fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804903:	00 00 00 
+  804906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490d:	00 00 00 
+  804910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804917:	00 00 00 
+  80491a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804921:	00 00 00 
+  804924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492b:	00 00 00 
+  80492e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804935:	00 00 00 
+  804938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493f:	00 00 00 
+  804942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804949:	00 00 00 
+  80494c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804953:	00 00 00 
+  804956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495d:	00 00 00 
+  804960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804967:	00 00 00 
+  80496a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804971:	00 00 00 
+  804974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497b:	00 00 00 
+  80497e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804985:	00 00 00 
+  804988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498f:	00 00 00 
+  804992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804999:	00 00 00 
+  80499c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a3:	00 00 00 
+  8049a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ad:	00 00 00 
+  8049b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b7:	00 00 00 
+  8049ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c1:	00 00 00 
+  8049c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cb:	00 00 00 
+  8049ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d5:	00 00 00 
+  8049d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049df:	00 00 00 
+  8049e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e9:	00 00 00 
+  8049ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f3:	00 00 00 
+  8049f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fd:	00 00 00 
+  804a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a07:	00 00 00 
+  804a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a11:	00 00 00 
+  804a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1b:	00 00 00 
+  804a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a25:	00 00 00 
+  804a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2f:	00 00 00 
+  804a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a39:	00 00 00 
+  804a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a43:	00 00 00 
+  804a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4d:	00 00 00 
+  804a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a57:	00 00 00 
+  804a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a61:	00 00 00 
+  804a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6b:	00 00 00 
+  804a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a75:	00 00 00 
+  804a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7f:	00 00 00 
+  804a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a89:	00 00 00 
+  804a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a93:	00 00 00 
+  804a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9d:	00 00 00 
+  804aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa7:	00 00 00 
+  804aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab1:	00 00 00 
+  804ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abb:	00 00 00 
+  804abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac5:	00 00 00 
+  804ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acf:	00 00 00 
+  804ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad9:	00 00 00 
+  804adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae3:	00 00 00 
+  804ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aed:	00 00 00 
+  804af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af7:	00 00 00 
+  804afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b01:	00 00 00 
+  804b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0b:	00 00 00 
+  804b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b15:	00 00 00 
+  804b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1f:	00 00 00 
+  804b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b29:	00 00 00 
+  804b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b33:	00 00 00 
+  804b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3d:	00 00 00 
+  804b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b47:	00 00 00 
+  804b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b51:	00 00 00 
+  804b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5b:	00 00 00 
+  804b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b65:	00 00 00 
+  804b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6f:	00 00 00 
+  804b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b79:	00 00 00 
+  804b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b83:	00 00 00 
+  804b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8d:	00 00 00 
+  804b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b97:	00 00 00 
+  804b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba1:	00 00 00 
+  804ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bab:	00 00 00 
+  804bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb5:	00 00 00 
+  804bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbf:	00 00 00 
+  804bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc9:	00 00 00 
+  804bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd3:	00 00 00 
+  804bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdd:	00 00 00 
+  804be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be7:	00 00 00 
+  804bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf1:	00 00 00 
+  804bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfb:	00 00 00 
+  804bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c05:	00 00 00 
+  804c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0f:	00 00 00 
+  804c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c19:	00 00 00 
+  804c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c23:	00 00 00 
+  804c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2d:	00 00 00 
+  804c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c37:	00 00 00 
+  804c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c41:	00 00 00 
+  804c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4b:	00 00 00 
+  804c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c55:	00 00 00 
+  804c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5f:	00 00 00 
+  804c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c69:	00 00 00 
+  804c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c73:	00 00 00 
+  804c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7d:	00 00 00 
+  804c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c87:	00 00 00 
+  804c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c91:	00 00 00 
+  804c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9b:	00 00 00 
+  804c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca5:	00 00 00 
+  804ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caf:	00 00 00 
+  804cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb9:	00 00 00 
+  804cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc3:	00 00 00 
+  804cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccd:	00 00 00 
+  804cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd7:	00 00 00 
+  804cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce1:	00 00 00 
+  804ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ceb:	00 00 00 
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cff:	00 00 00 
+  804d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d09:	00 00 00 
+  804d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d13:	00 00 00 
+  804d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1d:	00 00 00 
+  804d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d27:	00 00 00 
+  804d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d31:	00 00 00 
+  804d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3b:	00 00 00 
+  804d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d45:	00 00 00 
+  804d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4f:	00 00 00 
+  804d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d59:	00 00 00 
+  804d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d63:	00 00 00 
+  804d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6d:	00 00 00 
+  804d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d77:	00 00 00 
+  804d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d81:	00 00 00 
+  804d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8b:	00 00 00 
+  804d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d95:	00 00 00 
+  804d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9f:	00 00 00 
+  804da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da9:	00 00 00 
+  804dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db3:	00 00 00 
+  804db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbd:	00 00 00 
+  804dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc7:	00 00 00 
+  804dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd1:	00 00 00 
+  804dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddb:	00 00 00 
+  804dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de5:	00 00 00 
+  804de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804def:	00 00 00 
+  804df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df9:	00 00 00 
+  804dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e03:	00 00 00 
+  804e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0d:	00 00 00 
+  804e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e17:	00 00 00 
+  804e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e21:	00 00 00 
+  804e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2b:	00 00 00 
+  804e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e35:	00 00 00 
+  804e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3f:	00 00 00 
+  804e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e49:	00 00 00 
+  804e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e53:	00 00 00 
+  804e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5d:	00 00 00 
+  804e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e67:	00 00 00 
+  804e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e71:	00 00 00 
+  804e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7b:	00 00 00 
+  804e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e85:	00 00 00 
+  804e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8f:	00 00 00 
+  804e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e99:	00 00 00 
+  804e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea3:	00 00 00 
+  804ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ead:	00 00 00 
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
@@ -0,0 +1,8264 @@
+
+obj/user/testfdsharing:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 cf 02 00 00       	call   8002f2 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+    int fd, r, n, n2;
+
+    if ((fd = open("motd", O_RDONLY)) < 0)
+  800030:	be 00 00 00 00       	mov    $0x0,%esi
+  800035:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003c:	00 00 00 
+  80003f:	48 b8 84 34 80 00 00 	movabs $0x803484,%rax
+  800046:	00 00 00 
+  800049:	ff d0                	call   *%rax
+  80004b:	89 c3                	mov    %eax,%ebx
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 8a 01 00 00    	js     8001df <umain+0x1ba>
+        panic("open motd: %i", fd);
+    seek(fd, 0);
+  800055:	be 00 00 00 00       	mov    $0x0,%esi
+  80005a:	89 c7                	mov    %eax,%edi
+  80005c:	48 b8 63 26 80 00 00 	movabs $0x802663,%rax
+  800063:	00 00 00 
+  800066:	ff d0                	call   *%rax
+    if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800068:	ba 00 02 00 00       	mov    $0x200,%edx
+  80006d:	48 be 00 72 80 00 00 	movabs $0x807200,%rsi
+  800074:	00 00 00 
+  800077:	89 df                	mov    %ebx,%edi
+  800079:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  800080:	00 00 00 
+  800083:	ff d0                	call   *%rax
+  800085:	49 89 c4             	mov    %rax,%r12
+  800088:	41 89 c6             	mov    %eax,%r14d
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	0f 8e 79 01 00 00    	jle    80020c <umain+0x1e7>
+        panic("readn: %i", n);
+
+    if ((r = fork()) < 0)
+  800093:	48 b8 fc 1f 80 00 00 	movabs $0x801ffc,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  80009f:	41 89 c5             	mov    %eax,%r13d
+  8000a2:	85 c0                	test   %eax,%eax
+  8000a4:	0f 88 8f 01 00 00    	js     800239 <umain+0x214>
+        panic("fork: %i", r);
+    if (r == 0) {
+  8000aa:	0f 85 c7 00 00 00    	jne    800177 <umain+0x152>
+        seek(fd, 0);
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	89 df                	mov    %ebx,%edi
+  8000b7:	48 b8 63 26 80 00 00 	movabs $0x802663,%rax
+  8000be:	00 00 00 
+  8000c1:	ff d0                	call   *%rax
+        cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  8000c3:	48 bf 70 50 80 00 00 	movabs $0x805070,%rdi
+  8000ca:	00 00 00 
+  8000cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d2:	48 ba 0e 05 80 00 00 	movabs $0x80050e,%rdx
+  8000d9:	00 00 00 
+  8000dc:	ff d2                	call   *%rdx
+        if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000de:	ba 00 02 00 00       	mov    $0x200,%edx
+  8000e3:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  8000ea:	00 00 00 
+  8000ed:	89 df                	mov    %ebx,%edi
+  8000ef:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+  8000fb:	41 39 c4             	cmp    %eax,%r12d
+  8000fe:	0f 85 62 01 00 00    	jne    800266 <umain+0x241>
+            panic("read in parent got %d, read in child got %d", n, n2);
+        if (memcmp(buf, buf2, n) != 0)
+  800104:	49 63 d4             	movslq %r12d,%rdx
+  800107:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  80010e:	00 00 00 
+  800111:	48 bf 00 72 80 00 00 	movabs $0x807200,%rdi
+  800118:	00 00 00 
+  80011b:	48 b8 33 13 80 00 00 	movabs $0x801333,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+  800127:	85 c0                	test   %eax,%eax
+  800129:	0f 85 68 01 00 00    	jne    800297 <umain+0x272>
+            panic("read in parent got different bytes from read in child");
+        cprintf("read in child succeeded\n");
+  80012f:	48 bf 3b 50 80 00 00 	movabs $0x80503b,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 ba 0e 05 80 00 00 	movabs $0x80050e,%rdx
+  800145:	00 00 00 
+  800148:	ff d2                	call   *%rdx
+        seek(fd, 0);
+  80014a:	be 00 00 00 00       	mov    $0x0,%esi
+  80014f:	89 df                	mov    %ebx,%edi
+  800151:	48 b8 63 26 80 00 00 	movabs $0x802663,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+        close(fd);
+  80015d:	89 df                	mov    %ebx,%edi
+  80015f:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        exit();
+  80016b:	48 b8 9b 03 80 00 00 	movabs $0x80039b,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+    }
+    wait(r);
+  800177:	44 89 ef             	mov    %r13d,%edi
+  80017a:	48 b8 13 3e 80 00 00 	movabs $0x803e13,%rax
+  800181:	00 00 00 
+  800184:	ff d0                	call   *%rax
+    if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800186:	ba 00 02 00 00       	mov    $0x200,%edx
+  80018b:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  800192:	00 00 00 
+  800195:	89 df                	mov    %ebx,%edi
+  800197:	48 b8 39 25 80 00 00 	movabs $0x802539,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+  8001a3:	41 39 c4             	cmp    %eax,%r12d
+  8001a6:	0f 85 15 01 00 00    	jne    8002c1 <umain+0x29c>
+        panic("read in parent got %d, then got %d", n, n2);
+    cprintf("read in parent succeeded\n");
+  8001ac:	48 bf 54 50 80 00 00 	movabs $0x805054,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	48 ba 0e 05 80 00 00 	movabs $0x80050e,%rdx
+  8001c2:	00 00 00 
+  8001c5:	ff d2                	call   *%rdx
+    close(fd);
+  8001c7:	89 df                	mov    %ebx,%edi
+  8001c9:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8001d0:	00 00 00 
+  8001d3:	ff d0                	call   *%rax
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001d5:	cc                   	int3
+
+    breakpoint();
+}
+  8001d6:	5b                   	pop    %rbx
+  8001d7:	41 5c                	pop    %r12
+  8001d9:	41 5d                	pop    %r13
+  8001db:	41 5e                	pop    %r14
+  8001dd:	5d                   	pop    %rbp
+  8001de:	c3                   	ret
+        panic("open motd: %i", fd);
+  8001df:	89 c1                	mov    %eax,%ecx
+  8001e1:	48 ba 05 50 80 00 00 	movabs $0x805005,%rdx
+  8001e8:	00 00 00 
+  8001eb:	be 0b 00 00 00       	mov    $0xb,%esi
+  8001f0:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  8001f7:	00 00 00 
+  8001fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ff:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  800206:	00 00 00 
+  800209:	41 ff d0             	call   *%r8
+        panic("readn: %i", n);
+  80020c:	89 c1                	mov    %eax,%ecx
+  80020e:	48 ba 28 50 80 00 00 	movabs $0x805028,%rdx
+  800215:	00 00 00 
+  800218:	be 0e 00 00 00       	mov    $0xe,%esi
+  80021d:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  800224:	00 00 00 
+  800227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022c:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  800233:	00 00 00 
+  800236:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800239:	89 c1                	mov    %eax,%ecx
+  80023b:	48 ba 32 50 80 00 00 	movabs $0x805032,%rdx
+  800242:	00 00 00 
+  800245:	be 11 00 00 00       	mov    $0x11,%esi
+  80024a:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  800251:	00 00 00 
+  800254:	b8 00 00 00 00       	mov    $0x0,%eax
+  800259:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  800260:	00 00 00 
+  800263:	41 ff d0             	call   *%r8
+            panic("read in parent got %d, read in child got %d", n, n2);
+  800266:	41 89 c0             	mov    %eax,%r8d
+  800269:	44 89 e1             	mov    %r12d,%ecx
+  80026c:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  800273:	00 00 00 
+  800276:	be 16 00 00 00       	mov    $0x16,%esi
+  80027b:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  800282:	00 00 00 
+  800285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028a:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  800291:	00 00 00 
+  800294:	41 ff d1             	call   *%r9
+            panic("read in parent got different bytes from read in child");
+  800297:	48 ba e8 50 80 00 00 	movabs $0x8050e8,%rdx
+  80029e:	00 00 00 
+  8002a1:	be 18 00 00 00       	mov    $0x18,%esi
+  8002a6:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  8002ad:	00 00 00 
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b5:	48 b9 be 03 80 00 00 	movabs $0x8003be,%rcx
+  8002bc:	00 00 00 
+  8002bf:	ff d1                	call   *%rcx
+        panic("read in parent got %d, then got %d", n, n2);
+  8002c1:	41 89 c0             	mov    %eax,%r8d
+  8002c4:	44 89 f1             	mov    %r14d,%ecx
+  8002c7:	48 ba 20 51 80 00 00 	movabs $0x805120,%rdx
+  8002ce:	00 00 00 
+  8002d1:	be 20 00 00 00       	mov    $0x20,%esi
+  8002d6:	48 bf 13 50 80 00 00 	movabs $0x805013,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  8002ec:	00 00 00 
+  8002ef:	41 ff d1             	call   *%r9
+
+00000000008002f2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002f2:	55                   	push   %rbp
+  8002f3:	48 89 e5             	mov    %rsp,%rbp
+  8002f6:	41 56                	push   %r14
+  8002f8:	41 55                	push   %r13
+  8002fa:	41 54                	push   %r12
+  8002fc:	53                   	push   %rbx
+  8002fd:	41 89 fd             	mov    %edi,%r13d
+  800300:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800303:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  80030a:	00 00 00 
+  80030d:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800314:	00 00 00 
+  800317:	48 39 c2             	cmp    %rax,%rdx
+  80031a:	73 17                	jae    800333 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80031c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80031f:	49 89 c4             	mov    %rax,%r12
+  800322:	48 83 c3 08          	add    $0x8,%rbx
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	ff 53 f8             	call   *-0x8(%rbx)
+  80032e:	4c 39 e3             	cmp    %r12,%rbx
+  800331:	72 ef                	jb     800322 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800333:	48 b8 26 15 80 00 00 	movabs $0x801526,%rax
+  80033a:	00 00 00 
+  80033d:	ff d0                	call   *%rax
+  80033f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800344:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80034b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800352:	00 00 00 
+  800355:	48 01 d0             	add    %rdx,%rax
+  800358:	48 a3 00 74 80 00 00 	movabs %rax,0x807400
+  80035f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800362:	45 85 ed             	test   %r13d,%r13d
+  800365:	7e 0d                	jle    800374 <libmain+0x82>
+  800367:	49 8b 06             	mov    (%r14),%rax
+  80036a:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800371:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800374:	4c 89 f6             	mov    %r14,%rsi
+  800377:	44 89 ef             	mov    %r13d,%edi
+  80037a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800381:	00 00 00 
+  800384:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800386:	48 b8 9b 03 80 00 00 	movabs $0x80039b,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+#endif
+}
+  800392:	5b                   	pop    %rbx
+  800393:	41 5c                	pop    %r12
+  800395:	41 5d                	pop    %r13
+  800397:	41 5e                	pop    %r14
+  800399:	5d                   	pop    %rbp
+  80039a:	c3                   	ret
+
+000000000080039b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80039b:	55                   	push   %rbp
+  80039c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80039f:	48 b8 30 23 80 00 00 	movabs $0x802330,%rax
+  8003a6:	00 00 00 
+  8003a9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003b0:	48 b8 bb 14 80 00 00 	movabs $0x8014bb,%rax
+  8003b7:	00 00 00 
+  8003ba:	ff d0                	call   *%rax
+}
+  8003bc:	5d                   	pop    %rbp
+  8003bd:	c3                   	ret
+
+00000000008003be <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003be:	55                   	push   %rbp
+  8003bf:	48 89 e5             	mov    %rsp,%rbp
+  8003c2:	41 56                	push   %r14
+  8003c4:	41 55                	push   %r13
+  8003c6:	41 54                	push   %r12
+  8003c8:	53                   	push   %rbx
+  8003c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8003cd:	49 89 fc             	mov    %rdi,%r12
+  8003d0:	41 89 f5             	mov    %esi,%r13d
+  8003d3:	48 89 d3             	mov    %rdx,%rbx
+  8003d6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003da:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003de:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003e2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003e9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003ed:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003f1:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003f5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003f9:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800400:	00 00 00 
+  800403:	4c 8b 30             	mov    (%rax),%r14
+  800406:	48 b8 26 15 80 00 00 	movabs $0x801526,%rax
+  80040d:	00 00 00 
+  800410:	ff d0                	call   *%rax
+  800412:	89 c6                	mov    %eax,%esi
+  800414:	45 89 e8             	mov    %r13d,%r8d
+  800417:	4c 89 e1             	mov    %r12,%rcx
+  80041a:	4c 89 f2             	mov    %r14,%rdx
+  80041d:	48 bf 50 51 80 00 00 	movabs $0x805150,%rdi
+  800424:	00 00 00 
+  800427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042c:	49 bc 0e 05 80 00 00 	movabs $0x80050e,%r12
+  800433:	00 00 00 
+  800436:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800439:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80043d:	48 89 df             	mov    %rbx,%rdi
+  800440:	48 b8 aa 04 80 00 00 	movabs $0x8004aa,%rax
+  800447:	00 00 00 
+  80044a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80044c:	48 bf 52 50 80 00 00 	movabs $0x805052,%rdi
+  800453:	00 00 00 
+  800456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80045e:	cc                   	int3
+  80045f:	eb fd                	jmp    80045e <_panic+0xa0>
+
+0000000000800461 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800461:	55                   	push   %rbp
+  800462:	48 89 e5             	mov    %rsp,%rbp
+  800465:	53                   	push   %rbx
+  800466:	48 83 ec 08          	sub    $0x8,%rsp
+  80046a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80046d:	8b 06                	mov    (%rsi),%eax
+  80046f:	8d 50 01             	lea    0x1(%rax),%edx
+  800472:	89 16                	mov    %edx,(%rsi)
+  800474:	48 98                	cltq
+  800476:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80047b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800481:	74 0a                	je     80048d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800483:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800487:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80048b:	c9                   	leave
+  80048c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80048d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800491:	be ff 00 00 00       	mov    $0xff,%esi
+  800496:	48 b8 5d 14 80 00 00 	movabs $0x80145d,%rax
+  80049d:	00 00 00 
+  8004a0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004a2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004a8:	eb d9                	jmp    800483 <putch+0x22>
+
+00000000008004aa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004aa:	55                   	push   %rbp
+  8004ab:	48 89 e5             	mov    %rsp,%rbp
+  8004ae:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004b5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004b8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004bf:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004cc:	48 89 f1             	mov    %rsi,%rcx
+  8004cf:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004d6:	48 bf 61 04 80 00 00 	movabs $0x800461,%rdi
+  8004dd:	00 00 00 
+  8004e0:	48 b8 5e 06 80 00 00 	movabs $0x80065e,%rax
+  8004e7:	00 00 00 
+  8004ea:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004ec:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004f3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004fa:	48 b8 5d 14 80 00 00 	movabs $0x80145d,%rax
+  800501:	00 00 00 
+  800504:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800506:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80050c:	c9                   	leave
+  80050d:	c3                   	ret
+
+000000000080050e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80050e:	55                   	push   %rbp
+  80050f:	48 89 e5             	mov    %rsp,%rbp
+  800512:	48 83 ec 50          	sub    $0x50,%rsp
+  800516:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80051a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80051e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800522:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800526:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80052a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800531:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800535:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800539:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80053d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800541:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800545:	48 b8 aa 04 80 00 00 	movabs $0x8004aa,%rax
+  80054c:	00 00 00 
+  80054f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800551:	c9                   	leave
+  800552:	c3                   	ret
+
+0000000000800553 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800553:	55                   	push   %rbp
+  800554:	48 89 e5             	mov    %rsp,%rbp
+  800557:	41 57                	push   %r15
+  800559:	41 56                	push   %r14
+  80055b:	41 55                	push   %r13
+  80055d:	41 54                	push   %r12
+  80055f:	53                   	push   %rbx
+  800560:	48 83 ec 18          	sub    $0x18,%rsp
+  800564:	49 89 fc             	mov    %rdi,%r12
+  800567:	49 89 f5             	mov    %rsi,%r13
+  80056a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80056e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800571:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800574:	41 89 cf             	mov    %ecx,%r15d
+  800577:	4c 39 fa             	cmp    %r15,%rdx
+  80057a:	73 5b                	jae    8005d7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80057c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800580:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800584:	85 db                	test   %ebx,%ebx
+  800586:	7e 0e                	jle    800596 <print_num+0x43>
+            putch(padc, put_arg);
+  800588:	4c 89 ee             	mov    %r13,%rsi
+  80058b:	44 89 f7             	mov    %r14d,%edi
+  80058e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800591:	83 eb 01             	sub    $0x1,%ebx
+  800594:	75 f2                	jne    800588 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800596:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80059a:	48 b9 84 51 80 00 00 	movabs $0x805184,%rcx
+  8005a1:	00 00 00 
+  8005a4:	48 b8 73 51 80 00 00 	movabs $0x805173,%rax
+  8005ab:	00 00 00 
+  8005ae:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005bb:	49 f7 f7             	div    %r15
+  8005be:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005c2:	4c 89 ee             	mov    %r13,%rsi
+  8005c5:	41 ff d4             	call   *%r12
+}
+  8005c8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005cc:	5b                   	pop    %rbx
+  8005cd:	41 5c                	pop    %r12
+  8005cf:	41 5d                	pop    %r13
+  8005d1:	41 5e                	pop    %r14
+  8005d3:	41 5f                	pop    %r15
+  8005d5:	5d                   	pop    %rbp
+  8005d6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e0:	49 f7 f7             	div    %r15
+  8005e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005e7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005eb:	52                   	push   %rdx
+  8005ec:	45 0f be c9          	movsbl %r9b,%r9d
+  8005f0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005f4:	48 89 c2             	mov    %rax,%rdx
+  8005f7:	48 b8 53 05 80 00 00 	movabs $0x800553,%rax
+  8005fe:	00 00 00 
+  800601:	ff d0                	call   *%rax
+  800603:	48 83 c4 10          	add    $0x10,%rsp
+  800607:	eb 8d                	jmp    800596 <print_num+0x43>
+
+0000000000800609 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800609:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80060d:	48 8b 06             	mov    (%rsi),%rax
+  800610:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800614:	73 0a                	jae    800620 <sprintputch+0x17>
+        *state->start++ = ch;
+  800616:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80061a:	48 89 16             	mov    %rdx,(%rsi)
+  80061d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800620:	c3                   	ret
+
+0000000000800621 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800621:	55                   	push   %rbp
+  800622:	48 89 e5             	mov    %rsp,%rbp
+  800625:	48 83 ec 50          	sub    $0x50,%rsp
+  800629:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80062d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800631:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800635:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80063c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800640:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800644:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800648:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80064c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800650:	48 b8 5e 06 80 00 00 	movabs $0x80065e,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+}
+  80065c:	c9                   	leave
+  80065d:	c3                   	ret
+
+000000000080065e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80065e:	55                   	push   %rbp
+  80065f:	48 89 e5             	mov    %rsp,%rbp
+  800662:	41 57                	push   %r15
+  800664:	41 56                	push   %r14
+  800666:	41 55                	push   %r13
+  800668:	41 54                	push   %r12
+  80066a:	53                   	push   %rbx
+  80066b:	48 83 ec 38          	sub    $0x38,%rsp
+  80066f:	49 89 fe             	mov    %rdi,%r14
+  800672:	49 89 f5             	mov    %rsi,%r13
+  800675:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800678:	48 8b 01             	mov    (%rcx),%rax
+  80067b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80067f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800683:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800687:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80068b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80068f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800693:	0f b6 3b             	movzbl (%rbx),%edi
+  800696:	40 80 ff 25          	cmp    $0x25,%dil
+  80069a:	74 18                	je     8006b4 <vprintfmt+0x56>
+            if (!ch) return;
+  80069c:	40 84 ff             	test   %dil,%dil
+  80069f:	0f 84 04 07 00 00    	je     800da9 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8006a5:	40 0f b6 ff          	movzbl %dil,%edi
+  8006a9:	4c 89 ee             	mov    %r13,%rsi
+  8006ac:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006af:	4c 89 e3             	mov    %r12,%rbx
+  8006b2:	eb db                	jmp    80068f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006bd:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006c2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006c8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006cf:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006d3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006d8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006dd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006e0:	83 e8 23             	sub    $0x23,%eax
+  8006e3:	3c 57                	cmp    $0x57,%al
+  8006e5:	0f 87 a4 06 00 00    	ja     800d8f <vprintfmt+0x731>
+  8006eb:	0f b6 c0             	movzbl %al,%eax
+  8006ee:	48 b9 20 53 80 00 00 	movabs $0x805320,%rcx
+  8006f5:	00 00 00 
+  8006f8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006fb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006fe:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800702:	eb cf                	jmp    8006d3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800704:	49 89 dc             	mov    %rbx,%r12
+  800707:	be 01 00 00 00       	mov    $0x1,%esi
+  80070c:	eb c5                	jmp    8006d3 <vprintfmt+0x75>
+            padc = ch;
+  80070e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800712:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800715:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800718:	eb b9                	jmp    8006d3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80071a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071d:	83 f8 2f             	cmp    $0x2f,%eax
+  800720:	77 24                	ja     800746 <vprintfmt+0xe8>
+  800722:	89 c1                	mov    %eax,%ecx
+  800724:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800728:	83 c0 08             	add    $0x8,%eax
+  80072b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800731:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800734:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800738:	79 99                	jns    8006d3 <vprintfmt+0x75>
+                width = precision;
+  80073a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80073e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800744:	eb 8d                	jmp    8006d3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800746:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80074a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80074e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800752:	eb da                	jmp    80072e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800754:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800759:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80075d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800763:	3c 39                	cmp    $0x39,%al
+  800765:	77 1c                	ja     800783 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800767:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80076b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80076f:	0f b6 c0             	movzbl %al,%eax
+  800772:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800777:	0f b6 03             	movzbl (%rbx),%eax
+  80077a:	3c 39                	cmp    $0x39,%al
+  80077c:	76 e9                	jbe    800767 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80077e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800781:	eb b1                	jmp    800734 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800783:	49 89 dc             	mov    %rbx,%r12
+  800786:	eb ac                	jmp    800734 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800788:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80078b:	85 c9                	test   %ecx,%ecx
+  80078d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800792:	0f 49 c1             	cmovns %ecx,%eax
+  800795:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800798:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80079b:	e9 33 ff ff ff       	jmp    8006d3 <vprintfmt+0x75>
+            lflag++;
+  8007a0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007a3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007a6:	e9 28 ff ff ff       	jmp    8006d3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b1:	77 19                	ja     8007cc <vprintfmt+0x16e>
+  8007b3:	89 c2                	mov    %eax,%edx
+  8007b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b9:	83 c0 08             	add    $0x8,%eax
+  8007bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bf:	8b 3a                	mov    (%rdx),%edi
+  8007c1:	4c 89 ee             	mov    %r13,%rsi
+  8007c4:	41 ff d6             	call   *%r14
+            break;
+  8007c7:	e9 c3 fe ff ff       	jmp    80068f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d8:	eb e5                	jmp    8007bf <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e0:	77 5a                	ja     80083c <vprintfmt+0x1de>
+  8007e2:	89 c2                	mov    %eax,%edx
+  8007e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e8:	83 c0 08             	add    $0x8,%eax
+  8007eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007ee:	8b 02                	mov    (%rdx),%eax
+  8007f0:	89 c1                	mov    %eax,%ecx
+  8007f2:	f7 d9                	neg    %ecx
+  8007f4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007f7:	83 f9 13             	cmp    $0x13,%ecx
+  8007fa:	7f 4e                	jg     80084a <vprintfmt+0x1ec>
+  8007fc:	48 63 c1             	movslq %ecx,%rax
+  8007ff:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  800806:	00 00 00 
+  800809:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80080d:	48 85 c0             	test   %rax,%rax
+  800810:	74 38                	je     80084a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800812:	48 89 c1             	mov    %rax,%rcx
+  800815:	48 ba 39 58 80 00 00 	movabs $0x805839,%rdx
+  80081c:	00 00 00 
+  80081f:	4c 89 ee             	mov    %r13,%rsi
+  800822:	4c 89 f7             	mov    %r14,%rdi
+  800825:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082a:	49 b8 21 06 80 00 00 	movabs $0x800621,%r8
+  800831:	00 00 00 
+  800834:	41 ff d0             	call   *%r8
+  800837:	e9 53 fe ff ff       	jmp    80068f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80083c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800840:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800844:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800848:	eb a4                	jmp    8007ee <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80084a:	48 ba 9c 51 80 00 00 	movabs $0x80519c,%rdx
+  800851:	00 00 00 
+  800854:	4c 89 ee             	mov    %r13,%rsi
+  800857:	4c 89 f7             	mov    %r14,%rdi
+  80085a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085f:	49 b8 21 06 80 00 00 	movabs $0x800621,%r8
+  800866:	00 00 00 
+  800869:	41 ff d0             	call   *%r8
+  80086c:	e9 1e fe ff ff       	jmp    80068f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800871:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800874:	83 f8 2f             	cmp    $0x2f,%eax
+  800877:	77 36                	ja     8008af <vprintfmt+0x251>
+  800879:	89 c2                	mov    %eax,%edx
+  80087b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087f:	83 c0 08             	add    $0x8,%eax
+  800882:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800885:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800888:	48 85 f6             	test   %rsi,%rsi
+  80088b:	48 b8 95 51 80 00 00 	movabs $0x805195,%rax
+  800892:	00 00 00 
+  800895:	48 0f 45 c6          	cmovne %rsi,%rax
+  800899:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80089d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008a1:	7e 06                	jle    8008a9 <vprintfmt+0x24b>
+  8008a3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008a7:	75 14                	jne    8008bd <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008a9:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8008ad:	eb 5b                	jmp    80090a <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  8008af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bb:	eb c8                	jmp    800885 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008bd:	49 63 f7             	movslq %r15d,%rsi
+  8008c0:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008c4:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  8008cb:	00 00 00 
+  8008ce:	ff d0                	call   *%rax
+  8008d0:	48 89 c2             	mov    %rax,%rdx
+  8008d3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008d6:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8008d8:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8008db:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8008de:	85 c0                	test   %eax,%eax
+  8008e0:	7e c7                	jle    8008a9 <vprintfmt+0x24b>
+  8008e2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008e7:	4c 89 ee             	mov    %r13,%rsi
+  8008ea:	44 89 e7             	mov    %r12d,%edi
+  8008ed:	41 ff d6             	call   *%r14
+  8008f0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008f4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008f7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008fa:	75 eb                	jne    8008e7 <vprintfmt+0x289>
+  8008fc:	eb ab                	jmp    8008a9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008fe:	0f b6 f8             	movzbl %al,%edi
+  800901:	4c 89 ee             	mov    %r13,%rsi
+  800904:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800907:	4c 89 e2             	mov    %r12,%rdx
+  80090a:	45 85 ff             	test   %r15d,%r15d
+  80090d:	78 06                	js     800915 <vprintfmt+0x2b7>
+  80090f:	41 83 ef 01          	sub    $0x1,%r15d
+  800913:	78 23                	js     800938 <vprintfmt+0x2da>
+  800915:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800919:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80091f:	84 c0                	test   %al,%al
+  800921:	74 15                	je     800938 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800923:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800927:	74 d5                	je     8008fe <vprintfmt+0x2a0>
+  800929:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80092c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800931:	80 fa 5e             	cmp    $0x5e,%dl
+  800934:	77 cb                	ja     800901 <vprintfmt+0x2a3>
+  800936:	eb c6                	jmp    8008fe <vprintfmt+0x2a0>
+  800938:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80093b:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  80093e:	01 f0                	add    %esi,%eax
+  800940:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800942:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800946:	85 c0                	test   %eax,%eax
+  800948:	0f 8e 41 fd ff ff    	jle    80068f <vprintfmt+0x31>
+  80094e:	4c 89 ee             	mov    %r13,%rsi
+  800951:	bf 20 00 00 00       	mov    $0x20,%edi
+  800956:	41 ff d6             	call   *%r14
+  800959:	41 83 ec 01          	sub    $0x1,%r12d
+  80095d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800961:	75 eb                	jne    80094e <vprintfmt+0x2f0>
+  800963:	e9 27 fd ff ff       	jmp    80068f <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800968:	40 84 f6             	test   %sil,%sil
+  80096b:	75 26                	jne    800993 <vprintfmt+0x335>
+    switch (lflag) {
+  80096d:	85 d2                	test   %edx,%edx
+  80096f:	74 59                	je     8009ca <vprintfmt+0x36c>
+  800971:	83 fa 01             	cmp    $0x1,%edx
+  800974:	74 7b                	je     8009f1 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800976:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800979:	83 f8 2f             	cmp    $0x2f,%eax
+  80097c:	0f 87 96 00 00 00    	ja     800a18 <vprintfmt+0x3ba>
+  800982:	89 c2                	mov    %eax,%edx
+  800984:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800988:	83 c0 08             	add    $0x8,%eax
+  80098b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098e:	4c 8b 22             	mov    (%rdx),%r12
+  800991:	eb 17                	jmp    8009aa <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800993:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800996:	83 f8 2f             	cmp    $0x2f,%eax
+  800999:	77 21                	ja     8009bc <vprintfmt+0x35e>
+  80099b:	89 c2                	mov    %eax,%edx
+  80099d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a1:	83 c0 08             	add    $0x8,%eax
+  8009a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a7:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009aa:	4d 85 e4             	test   %r12,%r12
+  8009ad:	78 7a                	js     800a29 <vprintfmt+0x3cb>
+            num = i;
+  8009af:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009b2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009b7:	e9 b5 02 00 00       	jmp    800c71 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c8:	eb dd                	jmp    8009a7 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  8009ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d0:	77 11                	ja     8009e3 <vprintfmt+0x385>
+  8009d2:	89 c2                	mov    %eax,%edx
+  8009d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d8:	83 c0 08             	add    $0x8,%eax
+  8009db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009de:	4c 63 22             	movslq (%rdx),%r12
+  8009e1:	eb c7                	jmp    8009aa <vprintfmt+0x34c>
+  8009e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ef:	eb ed                	jmp    8009de <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8009f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f7:	77 11                	ja     800a0a <vprintfmt+0x3ac>
+  8009f9:	89 c2                	mov    %eax,%edx
+  8009fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ff:	83 c0 08             	add    $0x8,%eax
+  800a02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a05:	4c 8b 22             	mov    (%rdx),%r12
+  800a08:	eb a0                	jmp    8009aa <vprintfmt+0x34c>
+  800a0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a16:	eb ed                	jmp    800a05 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800a18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a24:	e9 65 ff ff ff       	jmp    80098e <vprintfmt+0x330>
+                putch('-', put_arg);
+  800a29:	4c 89 ee             	mov    %r13,%rsi
+  800a2c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a31:	41 ff d6             	call   *%r14
+                i = -i;
+  800a34:	49 f7 dc             	neg    %r12
+  800a37:	e9 73 ff ff ff       	jmp    8009af <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3c:	40 84 f6             	test   %sil,%sil
+  800a3f:	75 32                	jne    800a73 <vprintfmt+0x415>
+    switch (lflag) {
+  800a41:	85 d2                	test   %edx,%edx
+  800a43:	74 5d                	je     800aa2 <vprintfmt+0x444>
+  800a45:	83 fa 01             	cmp    $0x1,%edx
+  800a48:	0f 84 82 00 00 00    	je     800ad0 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800a4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a51:	83 f8 2f             	cmp    $0x2f,%eax
+  800a54:	0f 87 a5 00 00 00    	ja     800aff <vprintfmt+0x4a1>
+  800a5a:	89 c2                	mov    %eax,%edx
+  800a5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a60:	83 c0 08             	add    $0x8,%eax
+  800a63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a66:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a69:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a6e:	e9 fe 01 00 00       	jmp    800c71 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a76:	83 f8 2f             	cmp    $0x2f,%eax
+  800a79:	77 19                	ja     800a94 <vprintfmt+0x436>
+  800a7b:	89 c2                	mov    %eax,%edx
+  800a7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a81:	83 c0 08             	add    $0x8,%eax
+  800a84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a87:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a8a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a8f:	e9 dd 01 00 00       	jmp    800c71 <vprintfmt+0x613>
+  800a94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa0:	eb e5                	jmp    800a87 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800aa2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa5:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa8:	77 18                	ja     800ac2 <vprintfmt+0x464>
+  800aaa:	89 c2                	mov    %eax,%edx
+  800aac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab0:	83 c0 08             	add    $0x8,%eax
+  800ab3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab6:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ab8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800abd:	e9 af 01 00 00       	jmp    800c71 <vprintfmt+0x613>
+  800ac2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ace:	eb e6                	jmp    800ab6 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800ad0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad6:	77 19                	ja     800af1 <vprintfmt+0x493>
+  800ad8:	89 c2                	mov    %eax,%edx
+  800ada:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ade:	83 c0 08             	add    $0x8,%eax
+  800ae1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800aec:	e9 80 01 00 00       	jmp    800c71 <vprintfmt+0x613>
+  800af1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afd:	eb e5                	jmp    800ae4 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800aff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0b:	e9 56 ff ff ff       	jmp    800a66 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800b10:	40 84 f6             	test   %sil,%sil
+  800b13:	75 2e                	jne    800b43 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800b15:	85 d2                	test   %edx,%edx
+  800b17:	0f 84 b3 00 00 00    	je     800bd0 <vprintfmt+0x572>
+  800b1d:	83 fa 01             	cmp    $0x1,%edx
+  800b20:	0f 84 d3 00 00 00    	je     800bf9 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800b26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b29:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2c:	0f 87 f1 00 00 00    	ja     800c23 <vprintfmt+0x5c5>
+  800b32:	89 c2                	mov    %eax,%edx
+  800b34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b38:	83 c0 08             	add    $0x8,%eax
+  800b3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3e:	48 8b 02             	mov    (%rdx),%rax
+  800b41:	eb 17                	jmp    800b5a <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800b43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b46:	83 f8 2f             	cmp    $0x2f,%eax
+  800b49:	77 77                	ja     800bc2 <vprintfmt+0x564>
+  800b4b:	89 c2                	mov    %eax,%edx
+  800b4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b51:	83 c0 08             	add    $0x8,%eax
+  800b54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b57:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800b5a:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800b5c:	83 f8 07             	cmp    $0x7,%eax
+  800b5f:	0f 8e cf 00 00 00    	jle    800c34 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800b65:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800b6b:	44 89 e7             	mov    %r12d,%edi
+  800b6e:	41 c1 e4 03          	shl    $0x3,%r12d
+  800b72:	89 d1                	mov    %edx,%ecx
+  800b74:	8d 72 07             	lea    0x7(%rdx),%esi
+  800b77:	85 d2                	test   %edx,%edx
+  800b79:	0f 48 d6             	cmovs  %esi,%edx
+  800b7c:	c1 fa 03             	sar    $0x3,%edx
+  800b7f:	83 f9 3f             	cmp    $0x3f,%ecx
+  800b82:	7f e7                	jg     800b6b <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800b84:	85 ff                	test   %edi,%edi
+  800b86:	0f 84 03 fb ff ff    	je     80068f <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800b8c:	49 63 f4             	movslq %r12d,%rsi
+  800b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b94:	48 f7 f6             	div    %rsi
+  800b97:	49 89 d7             	mov    %rdx,%r15
+  800b9a:	83 c0 30             	add    $0x30,%eax
+  800b9d:	0f be f8             	movsbl %al,%edi
+  800ba0:	4c 89 ee             	mov    %r13,%rsi
+  800ba3:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800ba6:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800ba9:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800bae:	45 85 e4             	test   %r12d,%r12d
+  800bb1:	41 0f 49 d4          	cmovns %r12d,%edx
+  800bb5:	c1 fa 03             	sar    $0x3,%edx
+  800bb8:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800bbb:	75 cf                	jne    800b8c <vprintfmt+0x52e>
+  800bbd:	e9 cd fa ff ff       	jmp    80068f <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bce:	eb 87                	jmp    800b57 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800bd0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd3:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd6:	77 13                	ja     800beb <vprintfmt+0x58d>
+  800bd8:	89 c2                	mov    %eax,%edx
+  800bda:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bde:	83 c0 08             	add    $0x8,%eax
+  800be1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be4:	8b 02                	mov    (%rdx),%eax
+  800be6:	e9 6f ff ff ff       	jmp    800b5a <vprintfmt+0x4fc>
+  800beb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf7:	eb eb                	jmp    800be4 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800bf9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bff:	77 14                	ja     800c15 <vprintfmt+0x5b7>
+  800c01:	89 c2                	mov    %eax,%edx
+  800c03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c07:	83 c0 08             	add    $0x8,%eax
+  800c0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0d:	48 8b 02             	mov    (%rdx),%rax
+  800c10:	e9 45 ff ff ff       	jmp    800b5a <vprintfmt+0x4fc>
+  800c15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c21:	eb ea                	jmp    800c0d <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800c23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2f:	e9 0a ff ff ff       	jmp    800b3e <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800c34:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800c3a:	e9 4d ff ff ff       	jmp    800b8c <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800c3f:	4c 89 ee             	mov    %r13,%rsi
+  800c42:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c47:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c4a:	4c 89 ee             	mov    %r13,%rsi
+  800c4d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c52:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c58:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5b:	77 47                	ja     800ca4 <vprintfmt+0x646>
+  800c5d:	89 c2                	mov    %eax,%edx
+  800c5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c63:	83 c0 08             	add    $0x8,%eax
+  800c66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c69:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c6c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c71:	48 83 ec 08          	sub    $0x8,%rsp
+  800c75:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c79:	0f 94 c0             	sete   %al
+  800c7c:	0f b6 c0             	movzbl %al,%eax
+  800c7f:	50                   	push   %rax
+  800c80:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c85:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c89:	4c 89 ee             	mov    %r13,%rsi
+  800c8c:	4c 89 f7             	mov    %r14,%rdi
+  800c8f:	48 b8 53 05 80 00 00 	movabs $0x800553,%rax
+  800c96:	00 00 00 
+  800c99:	ff d0                	call   *%rax
+            break;
+  800c9b:	48 83 c4 10          	add    $0x10,%rsp
+  800c9f:	e9 eb f9 ff ff       	jmp    80068f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ca4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb0:	eb b7                	jmp    800c69 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800cb2:	40 84 f6             	test   %sil,%sil
+  800cb5:	75 2b                	jne    800ce2 <vprintfmt+0x684>
+    switch (lflag) {
+  800cb7:	85 d2                	test   %edx,%edx
+  800cb9:	74 56                	je     800d11 <vprintfmt+0x6b3>
+  800cbb:	83 fa 01             	cmp    $0x1,%edx
+  800cbe:	74 7f                	je     800d3f <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800cc0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc3:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc6:	0f 87 a2 00 00 00    	ja     800d6e <vprintfmt+0x710>
+  800ccc:	89 c2                	mov    %eax,%edx
+  800cce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd2:	83 c0 08             	add    $0x8,%eax
+  800cd5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cdb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ce0:	eb 8f                	jmp    800c71 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce8:	77 19                	ja     800d03 <vprintfmt+0x6a5>
+  800cea:	89 c2                	mov    %eax,%edx
+  800cec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf0:	83 c0 08             	add    $0x8,%eax
+  800cf3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cf9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cfe:	e9 6e ff ff ff       	jmp    800c71 <vprintfmt+0x613>
+  800d03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d0f:	eb e5                	jmp    800cf6 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800d11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d14:	83 f8 2f             	cmp    $0x2f,%eax
+  800d17:	77 18                	ja     800d31 <vprintfmt+0x6d3>
+  800d19:	89 c2                	mov    %eax,%edx
+  800d1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d1f:	83 c0 08             	add    $0x8,%eax
+  800d22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d25:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d27:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d2c:	e9 40 ff ff ff       	jmp    800c71 <vprintfmt+0x613>
+  800d31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d3d:	eb e6                	jmp    800d25 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800d3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d42:	83 f8 2f             	cmp    $0x2f,%eax
+  800d45:	77 19                	ja     800d60 <vprintfmt+0x702>
+  800d47:	89 c2                	mov    %eax,%edx
+  800d49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4d:	83 c0 08             	add    $0x8,%eax
+  800d50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d53:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d56:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d5b:	e9 11 ff ff ff       	jmp    800c71 <vprintfmt+0x613>
+  800d60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6c:	eb e5                	jmp    800d53 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800d6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d7a:	e9 59 ff ff ff       	jmp    800cd8 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800d7f:	4c 89 ee             	mov    %r13,%rsi
+  800d82:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d87:	41 ff d6             	call   *%r14
+            break;
+  800d8a:	e9 00 f9 ff ff       	jmp    80068f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d8f:	4c 89 ee             	mov    %r13,%rsi
+  800d92:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d97:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d9a:	48 83 eb 01          	sub    $0x1,%rbx
+  800d9e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800da2:	75 f6                	jne    800d9a <vprintfmt+0x73c>
+  800da4:	e9 e6 f8 ff ff       	jmp    80068f <vprintfmt+0x31>
+}
+  800da9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800dad:	5b                   	pop    %rbx
+  800dae:	41 5c                	pop    %r12
+  800db0:	41 5d                	pop    %r13
+  800db2:	41 5e                	pop    %r14
+  800db4:	41 5f                	pop    %r15
+  800db6:	5d                   	pop    %rbp
+  800db7:	c3                   	ret
+
+0000000000800db8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800db8:	55                   	push   %rbp
+  800db9:	48 89 e5             	mov    %rsp,%rbp
+  800dbc:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800dc0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800dc4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800dc9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dcd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800dd4:	48 85 ff             	test   %rdi,%rdi
+  800dd7:	74 2b                	je     800e04 <vsnprintf+0x4c>
+  800dd9:	48 85 f6             	test   %rsi,%rsi
+  800ddc:	74 26                	je     800e04 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800dde:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800de2:	48 bf 09 06 80 00 00 	movabs $0x800609,%rdi
+  800de9:	00 00 00 
+  800dec:	48 b8 5e 06 80 00 00 	movabs $0x80065e,%rax
+  800df3:	00 00 00 
+  800df6:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800df8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dfc:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800dff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e02:	c9                   	leave
+  800e03:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e09:	eb f7                	jmp    800e02 <vsnprintf+0x4a>
+
+0000000000800e0b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e0b:	55                   	push   %rbp
+  800e0c:	48 89 e5             	mov    %rsp,%rbp
+  800e0f:	48 83 ec 50          	sub    $0x50,%rsp
+  800e13:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e17:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e1b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e1f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e26:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e2e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e32:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e36:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e3a:	48 b8 b8 0d 80 00 00 	movabs $0x800db8,%rax
+  800e41:	00 00 00 
+  800e44:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e46:	c9                   	leave
+  800e47:	c3                   	ret
+
+0000000000800e48 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e48:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e4b:	74 10                	je     800e5d <strlen+0x15>
+    size_t n = 0;
+  800e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e52:	48 83 c0 01          	add    $0x1,%rax
+  800e56:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e5a:	75 f6                	jne    800e52 <strlen+0xa>
+  800e5c:	c3                   	ret
+    size_t n = 0;
+  800e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e62:	c3                   	ret
+
+0000000000800e63 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e63:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e66:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e6b:	48 85 f6             	test   %rsi,%rsi
+  800e6e:	74 11                	je     800e81 <strnlen+0x1e>
+  800e70:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e74:	74 0c                	je     800e82 <strnlen+0x1f>
+  800e76:	48 83 c2 01          	add    $0x1,%rdx
+  800e7a:	48 39 d0             	cmp    %rdx,%rax
+  800e7d:	75 f1                	jne    800e70 <strnlen+0xd>
+  800e7f:	eb 04                	jmp    800e85 <strnlen+0x22>
+  800e81:	c3                   	ret
+  800e82:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e85:	c3                   	ret
+
+0000000000800e86 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e86:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e92:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e95:	48 83 c2 01          	add    $0x1,%rdx
+  800e99:	84 c9                	test   %cl,%cl
+  800e9b:	75 f1                	jne    800e8e <strcpy+0x8>
+        ;
+    return res;
+}
+  800e9d:	c3                   	ret
+
+0000000000800e9e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e9e:	55                   	push   %rbp
+  800e9f:	48 89 e5             	mov    %rsp,%rbp
+  800ea2:	41 54                	push   %r12
+  800ea4:	53                   	push   %rbx
+  800ea5:	48 89 fb             	mov    %rdi,%rbx
+  800ea8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800eab:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  800eb2:	00 00 00 
+  800eb5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800eb7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ebb:	4c 89 e6             	mov    %r12,%rsi
+  800ebe:	48 b8 86 0e 80 00 00 	movabs $0x800e86,%rax
+  800ec5:	00 00 00 
+  800ec8:	ff d0                	call   *%rax
+    return dst;
+}
+  800eca:	48 89 d8             	mov    %rbx,%rax
+  800ecd:	5b                   	pop    %rbx
+  800ece:	41 5c                	pop    %r12
+  800ed0:	5d                   	pop    %rbp
+  800ed1:	c3                   	ret
+
+0000000000800ed2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ed2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ed5:	48 85 d2             	test   %rdx,%rdx
+  800ed8:	74 1f                	je     800ef9 <strncpy+0x27>
+  800eda:	48 01 fa             	add    %rdi,%rdx
+  800edd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ee0:	48 83 c1 01          	add    $0x1,%rcx
+  800ee4:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ee8:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800eec:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ef0:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ef4:	48 39 ca             	cmp    %rcx,%rdx
+  800ef7:	75 e7                	jne    800ee0 <strncpy+0xe>
+    }
+    return ret;
+}
+  800ef9:	c3                   	ret
+
+0000000000800efa <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800efa:	48 89 f8             	mov    %rdi,%rax
+  800efd:	48 85 d2             	test   %rdx,%rdx
+  800f00:	74 24                	je     800f26 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f02:	48 83 ea 01          	sub    $0x1,%rdx
+  800f06:	74 1b                	je     800f23 <strlcpy+0x29>
+  800f08:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f0c:	0f b6 16             	movzbl (%rsi),%edx
+  800f0f:	84 d2                	test   %dl,%dl
+  800f11:	74 10                	je     800f23 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f13:	48 83 c6 01          	add    $0x1,%rsi
+  800f17:	48 83 c0 01          	add    $0x1,%rax
+  800f1b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f1e:	48 39 c8             	cmp    %rcx,%rax
+  800f21:	75 e9                	jne    800f0c <strlcpy+0x12>
+        *dst = '\0';
+  800f23:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f26:	48 29 f8             	sub    %rdi,%rax
+}
+  800f29:	c3                   	ret
+
+0000000000800f2a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f2a:	0f b6 07             	movzbl (%rdi),%eax
+  800f2d:	84 c0                	test   %al,%al
+  800f2f:	74 13                	je     800f44 <strcmp+0x1a>
+  800f31:	38 06                	cmp    %al,(%rsi)
+  800f33:	75 0f                	jne    800f44 <strcmp+0x1a>
+  800f35:	48 83 c7 01          	add    $0x1,%rdi
+  800f39:	48 83 c6 01          	add    $0x1,%rsi
+  800f3d:	0f b6 07             	movzbl (%rdi),%eax
+  800f40:	84 c0                	test   %al,%al
+  800f42:	75 ed                	jne    800f31 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f44:	0f b6 c0             	movzbl %al,%eax
+  800f47:	0f b6 16             	movzbl (%rsi),%edx
+  800f4a:	29 d0                	sub    %edx,%eax
+}
+  800f4c:	c3                   	ret
+
+0000000000800f4d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f4d:	48 85 d2             	test   %rdx,%rdx
+  800f50:	74 1f                	je     800f71 <strncmp+0x24>
+  800f52:	0f b6 07             	movzbl (%rdi),%eax
+  800f55:	84 c0                	test   %al,%al
+  800f57:	74 1e                	je     800f77 <strncmp+0x2a>
+  800f59:	3a 06                	cmp    (%rsi),%al
+  800f5b:	75 1a                	jne    800f77 <strncmp+0x2a>
+  800f5d:	48 83 c7 01          	add    $0x1,%rdi
+  800f61:	48 83 c6 01          	add    $0x1,%rsi
+  800f65:	48 83 ea 01          	sub    $0x1,%rdx
+  800f69:	75 e7                	jne    800f52 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f70:	c3                   	ret
+  800f71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f76:	c3                   	ret
+  800f77:	48 85 d2             	test   %rdx,%rdx
+  800f7a:	74 09                	je     800f85 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f7c:	0f b6 07             	movzbl (%rdi),%eax
+  800f7f:	0f b6 16             	movzbl (%rsi),%edx
+  800f82:	29 d0                	sub    %edx,%eax
+  800f84:	c3                   	ret
+    if (!n) return 0;
+  800f85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f8a:	c3                   	ret
+
+0000000000800f8b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f8b:	0f b6 17             	movzbl (%rdi),%edx
+  800f8e:	84 d2                	test   %dl,%dl
+  800f90:	74 18                	je     800faa <strchr+0x1f>
+        if (*str == c) {
+  800f92:	0f be d2             	movsbl %dl,%edx
+  800f95:	39 f2                	cmp    %esi,%edx
+  800f97:	74 17                	je     800fb0 <strchr+0x25>
+    for (; *str; str++) {
+  800f99:	48 83 c7 01          	add    $0x1,%rdi
+  800f9d:	0f b6 17             	movzbl (%rdi),%edx
+  800fa0:	84 d2                	test   %dl,%dl
+  800fa2:	75 ee                	jne    800f92 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa9:	c3                   	ret
+  800faa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800faf:	c3                   	ret
+  800fb0:	48 89 f8             	mov    %rdi,%rax
+}
+  800fb3:	c3                   	ret
+
+0000000000800fb4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fb4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fb7:	0f b6 17             	movzbl (%rdi),%edx
+  800fba:	84 d2                	test   %dl,%dl
+  800fbc:	74 13                	je     800fd1 <strfind+0x1d>
+  800fbe:	0f be d2             	movsbl %dl,%edx
+  800fc1:	39 f2                	cmp    %esi,%edx
+  800fc3:	74 0b                	je     800fd0 <strfind+0x1c>
+  800fc5:	48 83 c0 01          	add    $0x1,%rax
+  800fc9:	0f b6 10             	movzbl (%rax),%edx
+  800fcc:	84 d2                	test   %dl,%dl
+  800fce:	75 ee                	jne    800fbe <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fd0:	c3                   	ret
+  800fd1:	c3                   	ret
+
+0000000000800fd2 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  800fd2:	55                   	push   %rbp
+  800fd3:	48 89 e5             	mov    %rsp,%rbp
+  800fd6:	41 57                	push   %r15
+  800fd8:	41 56                	push   %r14
+  800fda:	41 55                	push   %r13
+  800fdc:	41 54                	push   %r12
+  800fde:	53                   	push   %rbx
+  800fdf:	48 83 ec 08          	sub    $0x8,%rsp
+  800fe3:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  800fe6:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  800fea:	45 84 ed             	test   %r13b,%r13b
+  800fed:	75 12                	jne    801001 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  800fef:	4c 89 f8             	mov    %r15,%rax
+  800ff2:	48 83 c4 08          	add    $0x8,%rsp
+  800ff6:	5b                   	pop    %rbx
+  800ff7:	41 5c                	pop    %r12
+  800ff9:	41 5d                	pop    %r13
+  800ffb:	41 5e                	pop    %r14
+  800ffd:	41 5f                	pop    %r15
+  800fff:	5d                   	pop    %rbp
+  801000:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  801001:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  801005:	4c 89 e7             	mov    %r12,%rdi
+  801008:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  80100f:	00 00 00 
+  801012:	ff d0                	call   *%rax
+  801014:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  801017:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  80101b:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  80101f:	49 bf 4d 0f 80 00 00 	movabs $0x800f4d,%r15
+  801026:	00 00 00 
+				if ((sc = *s++) == 0)
+  801029:	84 c0                	test   %al,%al
+  80102b:	75 14                	jne    801041 <strstr+0x6f>
+					return NULL;
+  80102d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801033:	eb ba                	jmp    800fef <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  801035:	48 83 c3 01          	add    $0x1,%rbx
+  801039:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80103d:	84 c0                	test   %al,%al
+  80103f:	74 1b                	je     80105c <strstr+0x8a>
+			} while (sc != c);
+  801041:	41 38 c5             	cmp    %al,%r13b
+  801044:	75 ef                	jne    801035 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  801046:	4c 89 f2             	mov    %r14,%rdx
+  801049:	4c 89 e6             	mov    %r12,%rsi
+  80104c:	48 89 df             	mov    %rbx,%rdi
+  80104f:	41 ff d7             	call   *%r15
+  801052:	85 c0                	test   %eax,%eax
+  801054:	75 df                	jne    801035 <strstr+0x63>
+  801056:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  80105a:	eb 93                	jmp    800fef <strstr+0x1d>
+					return NULL;
+  80105c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801062:	eb 8b                	jmp    800fef <strstr+0x1d>
+
+0000000000801064 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  801064:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  801066:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  801069:	8d 57 20             	lea    0x20(%rdi),%edx
+  80106c:	83 f9 1a             	cmp    $0x1a,%ecx
+  80106f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801072:	c3                   	ret
+
+0000000000801073 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  801073:	55                   	push   %rbp
+  801074:	48 89 e5             	mov    %rsp,%rbp
+  801077:	41 57                	push   %r15
+  801079:	41 56                	push   %r14
+  80107b:	41 55                	push   %r13
+  80107d:	41 54                	push   %r12
+  80107f:	53                   	push   %rbx
+  801080:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  801084:	48 39 f7             	cmp    %rsi,%rdi
+  801087:	74 49                	je     8010d2 <strcasecmp+0x5f>
+  801089:	49 89 fd             	mov    %rdi,%r13
+  80108c:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  80108f:	49 bf 64 10 80 00 00 	movabs $0x801064,%r15
+  801096:	00 00 00 
+  801099:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  80109e:	41 0f b6 fe          	movzbl %r14b,%edi
+  8010a2:	41 ff d7             	call   *%r15
+  8010a5:	89 c3                	mov    %eax,%ebx
+  8010a7:	49 83 c4 01          	add    $0x1,%r12
+  8010ab:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8010b1:	41 ff d7             	call   *%r15
+  8010b4:	29 c3                	sub    %eax,%ebx
+  8010b6:	75 09                	jne    8010c1 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  8010b8:	49 83 c5 01          	add    $0x1,%r13
+  8010bc:	45 84 f6             	test   %r14b,%r14b
+  8010bf:	75 d8                	jne    801099 <strcasecmp+0x26>
+}
+  8010c1:	89 d8                	mov    %ebx,%eax
+  8010c3:	48 83 c4 08          	add    $0x8,%rsp
+  8010c7:	5b                   	pop    %rbx
+  8010c8:	41 5c                	pop    %r12
+  8010ca:	41 5d                	pop    %r13
+  8010cc:	41 5e                	pop    %r14
+  8010ce:	41 5f                	pop    %r15
+  8010d0:	5d                   	pop    %rbp
+  8010d1:	c3                   	ret
+        return 0;
+  8010d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d7:	eb e8                	jmp    8010c1 <strcasecmp+0x4e>
+
+00000000008010d9 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8010d9:	55                   	push   %rbp
+  8010da:	48 89 e5             	mov    %rsp,%rbp
+  8010dd:	41 57                	push   %r15
+  8010df:	41 56                	push   %r14
+  8010e1:	41 55                	push   %r13
+  8010e3:	41 54                	push   %r12
+  8010e5:	53                   	push   %rbx
+  8010e6:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  8010ea:	48 85 d2             	test   %rdx,%rdx
+  8010ed:	74 4f                	je     80113e <strncasecmp+0x65>
+  8010ef:	49 89 fc             	mov    %rdi,%r12
+  8010f2:	49 89 f5             	mov    %rsi,%r13
+  8010f5:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  8010f9:	49 be 64 10 80 00 00 	movabs $0x801064,%r14
+  801100:	00 00 00 
+  801103:	49 83 c4 01          	add    $0x1,%r12
+  801107:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  80110d:	41 ff d6             	call   *%r14
+  801110:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  801112:	49 83 c5 01          	add    $0x1,%r13
+  801116:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  80111b:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  80111e:	29 c3                	sub    %eax,%ebx
+  801120:	85 c0                	test   %eax,%eax
+  801122:	74 09                	je     80112d <strncasecmp+0x54>
+  801124:	85 db                	test   %ebx,%ebx
+  801126:	75 05                	jne    80112d <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  801128:	4d 39 fc             	cmp    %r15,%r12
+  80112b:	75 d6                	jne    801103 <strncasecmp+0x2a>
+}
+  80112d:	89 d8                	mov    %ebx,%eax
+  80112f:	48 83 c4 08          	add    $0x8,%rsp
+  801133:	5b                   	pop    %rbx
+  801134:	41 5c                	pop    %r12
+  801136:	41 5d                	pop    %r13
+  801138:	41 5e                	pop    %r14
+  80113a:	41 5f                	pop    %r15
+  80113c:	5d                   	pop    %rbp
+  80113d:	c3                   	ret
+    int d = 0;
+  80113e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  801143:	eb e8                	jmp    80112d <strncasecmp+0x54>
+
+0000000000801145 <toupper>:
+
+int toupper(int c) {
+  801145:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  801147:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80114a:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80114d:	83 f9 1a             	cmp    $0x1a,%ecx
+  801150:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801153:	c3                   	ret
+
+0000000000801154 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  801154:	83 ff 20             	cmp    $0x20,%edi
+  801157:	0f 94 c0             	sete   %al
+  80115a:	0f b6 c0             	movzbl %al,%eax
+}
+  80115d:	c3                   	ret
+
+000000000080115e <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  80115e:	89 f8                	mov    %edi,%eax
+  801160:	f7 d8                	neg    %eax
+  801162:	0f 48 c7             	cmovs  %edi,%eax
+}
+  801165:	c3                   	ret
+
+0000000000801166 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801166:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801169:	48 89 f8             	mov    %rdi,%rax
+  80116c:	48 f7 d8             	neg    %rax
+  80116f:	83 e0 07             	and    $0x7,%eax
+  801172:	49 89 d1             	mov    %rdx,%r9
+  801175:	49 29 c1             	sub    %rax,%r9
+  801178:	78 36                	js     8011b0 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80117a:	40 0f b6 c6          	movzbl %sil,%eax
+  80117e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801185:	01 01 01 
+  801188:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80118c:	40 f6 c7 07          	test   $0x7,%dil
+  801190:	75 38                	jne    8011ca <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801192:	4c 89 c9             	mov    %r9,%rcx
+  801195:	48 c1 f9 03          	sar    $0x3,%rcx
+  801199:	74 0c                	je     8011a7 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80119b:	fc                   	cld
+  80119c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80119f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8011a3:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8011a7:	4d 85 c9             	test   %r9,%r9
+  8011aa:	75 45                	jne    8011f1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8011ac:	4c 89 c0             	mov    %r8,%rax
+  8011af:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8011b0:	48 85 d2             	test   %rdx,%rdx
+  8011b3:	74 f7                	je     8011ac <memset+0x46>
+  8011b5:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8011b8:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8011bb:	48 83 c0 01          	add    $0x1,%rax
+  8011bf:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8011c3:	48 39 c2             	cmp    %rax,%rdx
+  8011c6:	75 f3                	jne    8011bb <memset+0x55>
+  8011c8:	eb e2                	jmp    8011ac <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8011ca:	40 f6 c7 01          	test   $0x1,%dil
+  8011ce:	74 06                	je     8011d6 <memset+0x70>
+  8011d0:	88 07                	mov    %al,(%rdi)
+  8011d2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011d6:	40 f6 c7 02          	test   $0x2,%dil
+  8011da:	74 07                	je     8011e3 <memset+0x7d>
+  8011dc:	66 89 07             	mov    %ax,(%rdi)
+  8011df:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011e3:	40 f6 c7 04          	test   $0x4,%dil
+  8011e7:	74 a9                	je     801192 <memset+0x2c>
+  8011e9:	89 07                	mov    %eax,(%rdi)
+  8011eb:	48 83 c7 04          	add    $0x4,%rdi
+  8011ef:	eb a1                	jmp    801192 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011f1:	41 f6 c1 04          	test   $0x4,%r9b
+  8011f5:	74 06                	je     8011fd <memset+0x97>
+  8011f7:	89 07                	mov    %eax,(%rdi)
+  8011f9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011fd:	41 f6 c1 02          	test   $0x2,%r9b
+  801201:	74 07                	je     80120a <memset+0xa4>
+  801203:	66 89 07             	mov    %ax,(%rdi)
+  801206:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80120a:	41 f6 c1 01          	test   $0x1,%r9b
+  80120e:	74 9c                	je     8011ac <memset+0x46>
+  801210:	88 07                	mov    %al,(%rdi)
+  801212:	eb 98                	jmp    8011ac <memset+0x46>
+
+0000000000801214 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801214:	48 89 f8             	mov    %rdi,%rax
+  801217:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80121a:	48 39 fe             	cmp    %rdi,%rsi
+  80121d:	73 3b                	jae    80125a <memmove+0x46>
+  80121f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801223:	48 39 d7             	cmp    %rdx,%rdi
+  801226:	73 32                	jae    80125a <memmove+0x46>
+        s += n;
+        d += n;
+  801228:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80122c:	48 89 d6             	mov    %rdx,%rsi
+  80122f:	48 09 fe             	or     %rdi,%rsi
+  801232:	48 09 ce             	or     %rcx,%rsi
+  801235:	40 f6 c6 07          	test   $0x7,%sil
+  801239:	75 12                	jne    80124d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80123b:	48 83 ef 08          	sub    $0x8,%rdi
+  80123f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801243:	48 c1 e9 03          	shr    $0x3,%rcx
+  801247:	fd                   	std
+  801248:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80124b:	fc                   	cld
+  80124c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80124d:	48 83 ef 01          	sub    $0x1,%rdi
+  801251:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801255:	fd                   	std
+  801256:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801258:	eb f1                	jmp    80124b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80125a:	48 89 f2             	mov    %rsi,%rdx
+  80125d:	48 09 c2             	or     %rax,%rdx
+  801260:	48 09 ca             	or     %rcx,%rdx
+  801263:	f6 c2 07             	test   $0x7,%dl
+  801266:	75 0c                	jne    801274 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801268:	48 c1 e9 03          	shr    $0x3,%rcx
+  80126c:	48 89 c7             	mov    %rax,%rdi
+  80126f:	fc                   	cld
+  801270:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801273:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801274:	48 89 c7             	mov    %rax,%rdi
+  801277:	fc                   	cld
+  801278:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80127a:	c3                   	ret
+
+000000000080127b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80127b:	55                   	push   %rbp
+  80127c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80127f:	48 b8 14 12 80 00 00 	movabs $0x801214,%rax
+  801286:	00 00 00 
+  801289:	ff d0                	call   *%rax
+}
+  80128b:	5d                   	pop    %rbp
+  80128c:	c3                   	ret
+
+000000000080128d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80128d:	55                   	push   %rbp
+  80128e:	48 89 e5             	mov    %rsp,%rbp
+  801291:	41 57                	push   %r15
+  801293:	41 56                	push   %r14
+  801295:	41 55                	push   %r13
+  801297:	41 54                	push   %r12
+  801299:	53                   	push   %rbx
+  80129a:	48 83 ec 08          	sub    $0x8,%rsp
+  80129e:	49 89 fe             	mov    %rdi,%r14
+  8012a1:	49 89 f7             	mov    %rsi,%r15
+  8012a4:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8012a7:	48 89 f7             	mov    %rsi,%rdi
+  8012aa:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  8012b1:	00 00 00 
+  8012b4:	ff d0                	call   *%rax
+  8012b6:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8012b9:	48 89 de             	mov    %rbx,%rsi
+  8012bc:	4c 89 f7             	mov    %r14,%rdi
+  8012bf:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  8012c6:	00 00 00 
+  8012c9:	ff d0                	call   *%rax
+  8012cb:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012ce:	48 39 c3             	cmp    %rax,%rbx
+  8012d1:	74 36                	je     801309 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8012d3:	48 89 d8             	mov    %rbx,%rax
+  8012d6:	4c 29 e8             	sub    %r13,%rax
+  8012d9:	49 39 c4             	cmp    %rax,%r12
+  8012dc:	73 31                	jae    80130f <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8012de:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8012e3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012e7:	4c 89 fe             	mov    %r15,%rsi
+  8012ea:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  8012f1:	00 00 00 
+  8012f4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8012f6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8012fa:	48 83 c4 08          	add    $0x8,%rsp
+  8012fe:	5b                   	pop    %rbx
+  8012ff:	41 5c                	pop    %r12
+  801301:	41 5d                	pop    %r13
+  801303:	41 5e                	pop    %r14
+  801305:	41 5f                	pop    %r15
+  801307:	5d                   	pop    %rbp
+  801308:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801309:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80130d:	eb eb                	jmp    8012fa <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80130f:	48 83 eb 01          	sub    $0x1,%rbx
+  801313:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801317:	48 89 da             	mov    %rbx,%rdx
+  80131a:	4c 89 fe             	mov    %r15,%rsi
+  80131d:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  801324:	00 00 00 
+  801327:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801329:	49 01 de             	add    %rbx,%r14
+  80132c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801331:	eb c3                	jmp    8012f6 <strlcat+0x69>
+
+0000000000801333 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801333:	48 85 d2             	test   %rdx,%rdx
+  801336:	74 2d                	je     801365 <memcmp+0x32>
+  801338:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80133d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801341:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801346:	44 38 c1             	cmp    %r8b,%cl
+  801349:	75 0f                	jne    80135a <memcmp+0x27>
+    while (n-- > 0) {
+  80134b:	48 83 c0 01          	add    $0x1,%rax
+  80134f:	48 39 c2             	cmp    %rax,%rdx
+  801352:	75 e9                	jne    80133d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801354:	b8 00 00 00 00       	mov    $0x0,%eax
+  801359:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80135a:	0f b6 c1             	movzbl %cl,%eax
+  80135d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801361:	44 29 c0             	sub    %r8d,%eax
+  801364:	c3                   	ret
+    return 0;
+  801365:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80136a:	c3                   	ret
+
+000000000080136b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80136b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80136f:	48 39 c7             	cmp    %rax,%rdi
+  801372:	73 0f                	jae    801383 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801374:	40 38 37             	cmp    %sil,(%rdi)
+  801377:	74 0e                	je     801387 <memfind+0x1c>
+    for (; src < end; src++) {
+  801379:	48 83 c7 01          	add    $0x1,%rdi
+  80137d:	48 39 f8             	cmp    %rdi,%rax
+  801380:	75 f2                	jne    801374 <memfind+0x9>
+  801382:	c3                   	ret
+  801383:	48 89 f8             	mov    %rdi,%rax
+  801386:	c3                   	ret
+  801387:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80138a:	c3                   	ret
+
+000000000080138b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80138b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80138e:	0f b6 37             	movzbl (%rdi),%esi
+  801391:	40 80 fe 20          	cmp    $0x20,%sil
+  801395:	74 06                	je     80139d <strtol+0x12>
+  801397:	40 80 fe 09          	cmp    $0x9,%sil
+  80139b:	75 13                	jne    8013b0 <strtol+0x25>
+  80139d:	48 83 c7 01          	add    $0x1,%rdi
+  8013a1:	0f b6 37             	movzbl (%rdi),%esi
+  8013a4:	40 80 fe 20          	cmp    $0x20,%sil
+  8013a8:	74 f3                	je     80139d <strtol+0x12>
+  8013aa:	40 80 fe 09          	cmp    $0x9,%sil
+  8013ae:	74 ed                	je     80139d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8013b0:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8013b3:	83 e0 fd             	and    $0xfffffffd,%eax
+  8013b6:	3c 01                	cmp    $0x1,%al
+  8013b8:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013bc:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8013c2:	75 0f                	jne    8013d3 <strtol+0x48>
+  8013c4:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8013c7:	74 14                	je     8013dd <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8013c9:	85 d2                	test   %edx,%edx
+  8013cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013d0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8013d3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8013d8:	4c 63 ca             	movslq %edx,%r9
+  8013db:	eb 36                	jmp    801413 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013dd:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8013e1:	74 0f                	je     8013f2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8013e3:	85 d2                	test   %edx,%edx
+  8013e5:	75 ec                	jne    8013d3 <strtol+0x48>
+        s++;
+  8013e7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8013eb:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8013f0:	eb e1                	jmp    8013d3 <strtol+0x48>
+        s += 2;
+  8013f2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8013f6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013fb:	eb d6                	jmp    8013d3 <strtol+0x48>
+            dig -= '0';
+  8013fd:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801400:	44 0f b6 c1          	movzbl %cl,%r8d
+  801404:	41 39 d0             	cmp    %edx,%r8d
+  801407:	7d 21                	jge    80142a <strtol+0x9f>
+        val = val * base + dig;
+  801409:	49 0f af c1          	imul   %r9,%rax
+  80140d:	0f b6 c9             	movzbl %cl,%ecx
+  801410:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801413:	48 83 c7 01          	add    $0x1,%rdi
+  801417:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80141b:	80 f9 39             	cmp    $0x39,%cl
+  80141e:	76 dd                	jbe    8013fd <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801420:	80 f9 7b             	cmp    $0x7b,%cl
+  801423:	77 05                	ja     80142a <strtol+0x9f>
+            dig -= 'a' - 10;
+  801425:	83 e9 57             	sub    $0x57,%ecx
+  801428:	eb d6                	jmp    801400 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80142a:	4d 85 d2             	test   %r10,%r10
+  80142d:	74 03                	je     801432 <strtol+0xa7>
+  80142f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801432:	48 89 c2             	mov    %rax,%rdx
+  801435:	48 f7 da             	neg    %rdx
+  801438:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80143c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801440:	c3                   	ret
+
+0000000000801441 <atoi>:
+int atoi(const char *str) {
+  801441:	55                   	push   %rbp
+  801442:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801445:	ba 00 00 00 00       	mov    $0x0,%edx
+  80144a:	be 00 00 00 00       	mov    $0x0,%esi
+  80144f:	48 b8 8b 13 80 00 00 	movabs $0x80138b,%rax
+  801456:	00 00 00 
+  801459:	ff d0                	call   *%rax
+}
+  80145b:	5d                   	pop    %rbp
+  80145c:	c3                   	ret
+
+000000000080145d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80145d:	55                   	push   %rbp
+  80145e:	48 89 e5             	mov    %rsp,%rbp
+  801461:	53                   	push   %rbx
+  801462:	48 89 fa             	mov    %rdi,%rdx
+  801465:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801468:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80146d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801472:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801477:	be 00 00 00 00       	mov    $0x0,%esi
+  80147c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801482:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801484:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801488:	c9                   	leave
+  801489:	c3                   	ret
+
+000000000080148a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80148a:	55                   	push   %rbp
+  80148b:	48 89 e5             	mov    %rsp,%rbp
+  80148e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80148f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801494:	ba 00 00 00 00       	mov    $0x0,%edx
+  801499:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80149e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b3:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b9:	c9                   	leave
+  8014ba:	c3                   	ret
+
+00000000008014bb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8014bb:	55                   	push   %rbp
+  8014bc:	48 89 e5             	mov    %rsp,%rbp
+  8014bf:	53                   	push   %rbx
+  8014c0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8014c4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c7:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014db:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e8:	48 85 c0             	test   %rax,%rax
+  8014eb:	7f 06                	jg     8014f3 <sys_env_destroy+0x38>
+}
+  8014ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f1:	c9                   	leave
+  8014f2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f3:	49 89 c0             	mov    %rax,%r8
+  8014f6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8014fb:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801502:	00 00 00 
+  801505:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80150a:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801511:	00 00 00 
+  801514:	b8 00 00 00 00       	mov    $0x0,%eax
+  801519:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  801520:	00 00 00 
+  801523:	41 ff d1             	call   *%r9
+
+0000000000801526 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801526:	55                   	push   %rbp
+  801527:	48 89 e5             	mov    %rsp,%rbp
+  80152a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80152b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801530:	ba 00 00 00 00       	mov    $0x0,%edx
+  801535:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80153a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801544:	be 00 00 00 00       	mov    $0x0,%esi
+  801549:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80154f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801551:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801555:	c9                   	leave
+  801556:	c3                   	ret
+
+0000000000801557 <sys_yield>:
+
+void
+sys_yield(void) {
+  801557:	55                   	push   %rbp
+  801558:	48 89 e5             	mov    %rsp,%rbp
+  80155b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80155c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801561:	ba 00 00 00 00       	mov    $0x0,%edx
+  801566:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80156b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801570:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801575:	be 00 00 00 00       	mov    $0x0,%esi
+  80157a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801580:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801582:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801586:	c9                   	leave
+  801587:	c3                   	ret
+
+0000000000801588 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801588:	55                   	push   %rbp
+  801589:	48 89 e5             	mov    %rsp,%rbp
+  80158c:	53                   	push   %rbx
+  80158d:	48 89 fa             	mov    %rdi,%rdx
+  801590:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801593:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801598:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80159f:	00 00 00 
+  8015a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8015b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b8:	c9                   	leave
+  8015b9:	c3                   	ret
+
+00000000008015ba <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8015ba:	55                   	push   %rbp
+  8015bb:	48 89 e5             	mov    %rsp,%rbp
+  8015be:	53                   	push   %rbx
+  8015bf:	49 89 f8             	mov    %rdi,%r8
+  8015c2:	48 89 d3             	mov    %rdx,%rbx
+  8015c5:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015cd:	4c 89 c2             	mov    %r8,%rdx
+  8015d0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015de:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8015e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e4:	c9                   	leave
+  8015e5:	c3                   	ret
+
+00000000008015e6 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8015e6:	55                   	push   %rbp
+  8015e7:	48 89 e5             	mov    %rsp,%rbp
+  8015ea:	53                   	push   %rbx
+  8015eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ef:	89 f8                	mov    %edi,%eax
+  8015f1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8015f4:	48 63 f9             	movslq %ecx,%rdi
+  8015f7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015fa:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ff:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801602:	be 00 00 00 00       	mov    $0x0,%esi
+  801607:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80160f:	48 85 c0             	test   %rax,%rax
+  801612:	7f 06                	jg     80161a <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801614:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801618:	c9                   	leave
+  801619:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161a:	49 89 c0             	mov    %rax,%r8
+  80161d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801622:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801629:	00 00 00 
+  80162c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801631:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801638:	00 00 00 
+  80163b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801640:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  801647:	00 00 00 
+  80164a:	41 ff d1             	call   *%r9
+
+000000000080164d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80164d:	55                   	push   %rbp
+  80164e:	48 89 e5             	mov    %rsp,%rbp
+  801651:	53                   	push   %rbx
+  801652:	48 83 ec 08          	sub    $0x8,%rsp
+  801656:	89 f8                	mov    %edi,%eax
+  801658:	49 89 f2             	mov    %rsi,%r10
+  80165b:	48 89 cf             	mov    %rcx,%rdi
+  80165e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801661:	48 63 da             	movslq %edx,%rbx
+  801664:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801667:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80166c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801672:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801674:	48 85 c0             	test   %rax,%rax
+  801677:	7f 06                	jg     80167f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801679:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80167d:	c9                   	leave
+  80167e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167f:	49 89 c0             	mov    %rax,%r8
+  801682:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801687:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  80168e:	00 00 00 
+  801691:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801696:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  80169d:	00 00 00 
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a5:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  8016ac:	00 00 00 
+  8016af:	41 ff d1             	call   *%r9
+
+00000000008016b2 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016b2:	55                   	push   %rbp
+  8016b3:	48 89 e5             	mov    %rsp,%rbp
+  8016b6:	53                   	push   %rbx
+  8016b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8016bb:	49 89 f9             	mov    %rdi,%r9
+  8016be:	89 f0                	mov    %esi,%eax
+  8016c0:	48 89 d3             	mov    %rdx,%rbx
+  8016c3:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8016c6:	49 63 f0             	movslq %r8d,%rsi
+  8016c9:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cc:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016d1:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016dc:	48 85 c0             	test   %rax,%rax
+  8016df:	7f 06                	jg     8016e7 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e5:	c9                   	leave
+  8016e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e7:	49 89 c0             	mov    %rax,%r8
+  8016ea:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8016ef:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  8016f6:	00 00 00 
+  8016f9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016fe:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801705:	00 00 00 
+  801708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170d:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  801714:	00 00 00 
+  801717:	41 ff d1             	call   *%r9
+
+000000000080171a <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  80171a:	55                   	push   %rbp
+  80171b:	48 89 e5             	mov    %rsp,%rbp
+  80171e:	53                   	push   %rbx
+  80171f:	89 f8                	mov    %edi,%eax
+  801721:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801724:	48 63 f9             	movslq %ecx,%rdi
+  801727:	48 63 da             	movslq %edx,%rbx
+  80172a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801732:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801735:	be 00 00 00 00       	mov    $0x0,%esi
+  80173a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801740:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  801742:	89 c2                	mov    %eax,%edx
+  801744:	48 85 c0             	test   %rax,%rax
+  801747:	78 0d                	js     801756 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801749:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80174e:	4d 85 c9             	test   %r9,%r9
+  801751:	74 03                	je     801756 <sys_alloc_dma_region+0x3c>
+  801753:	49 89 01             	mov    %rax,(%r9)
+}
+  801756:	89 d0                	mov    %edx,%eax
+  801758:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80175c:	c9                   	leave
+  80175d:	c3                   	ret
+
+000000000080175e <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80175e:	55                   	push   %rbp
+  80175f:	48 89 e5             	mov    %rsp,%rbp
+  801762:	53                   	push   %rbx
+  801763:	48 83 ec 08          	sub    $0x8,%rsp
+  801767:	48 89 f1             	mov    %rsi,%rcx
+  80176a:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80176d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801770:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801775:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80177a:	be 00 00 00 00       	mov    $0x0,%esi
+  80177f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801785:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801787:	48 85 c0             	test   %rax,%rax
+  80178a:	7f 06                	jg     801792 <sys_set_cache_region+0x34>
+}
+  80178c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801790:	c9                   	leave
+  801791:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801792:	49 89 c0             	mov    %rax,%r8
+  801795:	b9 08 00 00 00       	mov    $0x8,%ecx
+  80179a:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  8017a1:	00 00 00 
+  8017a4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017a9:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  8017b0:	00 00 00 
+  8017b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b8:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  8017bf:	00 00 00 
+  8017c2:	41 ff d1             	call   *%r9
+
+00000000008017c5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8017c5:	55                   	push   %rbp
+  8017c6:	48 89 e5             	mov    %rsp,%rbp
+  8017c9:	53                   	push   %rbx
+  8017ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ce:	48 89 f1             	mov    %rsi,%rcx
+  8017d1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017d4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d7:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ee:	48 85 c0             	test   %rax,%rax
+  8017f1:	7f 06                	jg     8017f9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8017f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f7:	c9                   	leave
+  8017f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017f9:	49 89 c0             	mov    %rax,%r8
+  8017fc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801801:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801808:	00 00 00 
+  80180b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801810:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801817:	00 00 00 
+  80181a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181f:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  801826:	00 00 00 
+  801829:	41 ff d1             	call   *%r9
+
+000000000080182c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80182c:	55                   	push   %rbp
+  80182d:	48 89 e5             	mov    %rsp,%rbp
+  801830:	53                   	push   %rbx
+  801831:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801835:	48 63 ce             	movslq %esi,%rcx
+  801838:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80183b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801840:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801845:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80184a:	be 00 00 00 00       	mov    $0x0,%esi
+  80184f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801855:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801857:	48 85 c0             	test   %rax,%rax
+  80185a:	7f 06                	jg     801862 <sys_env_set_status+0x36>
+}
+  80185c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801860:	c9                   	leave
+  801861:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801862:	49 89 c0             	mov    %rax,%r8
+  801865:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  80186a:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801871:	00 00 00 
+  801874:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801879:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801880:	00 00 00 
+  801883:	b8 00 00 00 00       	mov    $0x0,%eax
+  801888:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  80188f:	00 00 00 
+  801892:	41 ff d1             	call   *%r9
+
+0000000000801895 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801895:	55                   	push   %rbp
+  801896:	48 89 e5             	mov    %rsp,%rbp
+  801899:	53                   	push   %rbx
+  80189a:	48 83 ec 08          	sub    $0x8,%rsp
+  80189e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8018a1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018a4:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018c0:	48 85 c0             	test   %rax,%rax
+  8018c3:	7f 06                	jg     8018cb <sys_env_set_trapframe+0x36>
+}
+  8018c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018c9:	c9                   	leave
+  8018ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018cb:	49 89 c0             	mov    %rax,%r8
+  8018ce:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  8018d3:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  8018da:	00 00 00 
+  8018dd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018e2:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  8018e9:	00 00 00 
+  8018ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f1:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  8018f8:	00 00 00 
+  8018fb:	41 ff d1             	call   *%r9
+
+00000000008018fe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8018fe:	55                   	push   %rbp
+  8018ff:	48 89 e5             	mov    %rsp,%rbp
+  801902:	53                   	push   %rbx
+  801903:	48 83 ec 08          	sub    $0x8,%rsp
+  801907:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80190a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80190d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801912:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801917:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80191c:	be 00 00 00 00       	mov    $0x0,%esi
+  801921:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801927:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801929:	48 85 c0             	test   %rax,%rax
+  80192c:	7f 06                	jg     801934 <sys_env_set_pgfault_upcall+0x36>
+}
+  80192e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801932:	c9                   	leave
+  801933:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801934:	49 89 c0             	mov    %rax,%r8
+  801937:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80193c:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801943:	00 00 00 
+  801946:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80194b:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801952:	00 00 00 
+  801955:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195a:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  801961:	00 00 00 
+  801964:	41 ff d1             	call   *%r9
+
+0000000000801967 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801967:	55                   	push   %rbp
+  801968:	48 89 e5             	mov    %rsp,%rbp
+  80196b:	53                   	push   %rbx
+  80196c:	89 f8                	mov    %edi,%eax
+  80196e:	49 89 f1             	mov    %rsi,%r9
+  801971:	48 89 d3             	mov    %rdx,%rbx
+  801974:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801977:	49 63 f0             	movslq %r8d,%rsi
+  80197a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80197d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801982:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801985:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80198b:	cd 30                	int    $0x30
+}
+  80198d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801991:	c9                   	leave
+  801992:	c3                   	ret
+
+0000000000801993 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801993:	55                   	push   %rbp
+  801994:	48 89 e5             	mov    %rsp,%rbp
+  801997:	53                   	push   %rbx
+  801998:	48 83 ec 08          	sub    $0x8,%rsp
+  80199c:	48 89 fa             	mov    %rdi,%rdx
+  80199f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a2:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019be:	48 85 c0             	test   %rax,%rax
+  8019c1:	7f 06                	jg     8019c9 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c7:	c9                   	leave
+  8019c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019c9:	49 89 c0             	mov    %rax,%r8
+  8019cc:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8019d1:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  8019d8:	00 00 00 
+  8019db:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019e0:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  8019e7:	00 00 00 
+  8019ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ef:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  8019f6:	00 00 00 
+  8019f9:	41 ff d1             	call   *%r9
+
+00000000008019fc <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8019fc:	55                   	push   %rbp
+  8019fd:	48 89 e5             	mov    %rsp,%rbp
+  801a00:	53                   	push   %rbx
+  801a01:	48 89 fa             	mov    %rdi,%rdx
+  801a04:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a07:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a11:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a16:	be 00 00 00 00       	mov    $0x0,%esi
+  801a1b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a21:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a27:	c9                   	leave
+  801a28:	c3                   	ret
+
+0000000000801a29 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a29:	55                   	push   %rbp
+  801a2a:	48 89 e5             	mov    %rsp,%rbp
+  801a2d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a2e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a38:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a42:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a47:	be 00 00 00 00       	mov    $0x0,%esi
+  801a4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a52:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a58:	c9                   	leave
+  801a59:	c3                   	ret
+
+0000000000801a5a <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801a5a:	48 85 ff             	test   %rdi,%rdi
+  801a5d:	0f 84 b6 01 00 00    	je     801c19 <malloc+0x1bf>
+malloc(size_t size) {
+  801a63:	55                   	push   %rbp
+  801a64:	48 89 e5             	mov    %rsp,%rbp
+  801a67:	41 56                	push   %r14
+  801a69:	41 55                	push   %r13
+  801a6b:	41 54                	push   %r12
+  801a6d:	53                   	push   %rbx
+  801a6e:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801a71:	48 b8 28 74 80 00 00 	movabs $0x807428,%rax
+  801a78:	00 00 00 
+  801a7b:	4c 8b 20             	mov    (%rax),%r12
+  801a7e:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801a85:	0f 87 94 01 00 00    	ja     801c1f <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801a8b:	48 a1 20 74 80 00 00 	movabs 0x807420,%rax
+  801a92:	00 00 00 
+  801a95:	48 85 c0             	test   %rax,%rax
+  801a98:	74 6b                	je     801b05 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801a9a:	4d 85 e4             	test   %r12,%r12
+  801a9d:	74 66                	je     801b05 <malloc+0xab>
+  801a9f:	48 ba 48 74 80 00 00 	movabs $0x807448,%rdx
+  801aa6:	00 00 00 
+  801aa9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aae:	eb 0d                	jmp    801abd <malloc+0x63>
+  801ab0:	48 83 c1 01          	add    $0x1,%rcx
+  801ab4:	48 83 c2 18          	add    $0x18,%rdx
+  801ab8:	49 39 cc             	cmp    %rcx,%r12
+  801abb:	74 48                	je     801b05 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801abd:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801ac2:	74 ec                	je     801ab0 <malloc+0x56>
+  801ac4:	48 39 1a             	cmp    %rbx,(%rdx)
+  801ac7:	72 e7                	jb     801ab0 <malloc+0x56>
+                real_freep_size--;
+  801ac9:	48 83 e8 01          	sub    $0x1,%rax
+  801acd:	48 a3 20 74 80 00 00 	movabs %rax,0x807420
+  801ad4:	00 00 00 
+                freep[i].is_free = false;
+  801ad7:	48 ba 40 74 80 00 00 	movabs $0x807440,%rdx
+  801ade:	00 00 00 
+  801ae1:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801ae5:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801ae9:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801aed:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801af4:	00 
+                freep[i].size = size;
+  801af5:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801af9:	48 01 c8             	add    %rcx,%rax
+  801afc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b00:	e9 0b 01 00 00       	jmp    801c10 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801b05:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801b0c:	00 00 00 
+  801b0f:	48 01 d8             	add    %rbx,%rax
+  801b12:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801b18:	76 7c                	jbe    801b96 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801b1a:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801b21:	00 00 00 
+  801b24:	4c 8b 30             	mov    (%rax),%r14
+  801b27:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801b2e:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801b31:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801b38:	00 00 00 
+  801b3b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801b42:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801b49:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801b4f:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801b53:	48 b8 26 15 80 00 00 	movabs $0x801526,%rax
+  801b5a:	00 00 00 
+  801b5d:	ff d0                	call   *%rax
+  801b5f:	89 c7                	mov    %eax,%edi
+  801b61:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801b68:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801b6f:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801b76:	00 00 00 
+  801b79:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801b7d:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801b82:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  801b89:	00 00 00 
+  801b8c:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	0f 88 90 00 00 00    	js     801c26 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801b96:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801b9d:	00 00 00 
+  801ba0:	48 8b 31             	mov    (%rcx),%rsi
+  801ba3:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801baa:	00 00 00 
+  801bad:	4c 8b 07             	mov    (%rdi),%r8
+  801bb0:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801bb4:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801bbb:	00 00 00 
+  801bbe:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801bc2:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801bc6:	48 b8 40 74 80 00 00 	movabs $0x807440,%rax
+  801bcd:	00 00 00 
+  801bd0:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801bd4:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801bd7:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801bdb:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801be2:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801be3:	48 89 d8             	mov    %rbx,%rax
+  801be6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801beb:	4c 01 c0             	add    %r8,%rax
+  801bee:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801bf1:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801bf8:	48 01 f3             	add    %rsi,%rbx
+  801bfb:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801bfe:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801c03:	48 a3 28 74 80 00 00 	movabs %rax,0x807428
+  801c0a:	00 00 00 
+  801c0d:	48 89 d0             	mov    %rdx,%rax
+}
+  801c10:	5b                   	pop    %rbx
+  801c11:	41 5c                	pop    %r12
+  801c13:	41 5d                	pop    %r13
+  801c15:	41 5e                	pop    %r14
+  801c17:	5d                   	pop    %rbp
+  801c18:	c3                   	ret
+        return NULL;
+  801c19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c1e:	c3                   	ret
+        return NULL;
+  801c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c24:	eb ea                	jmp    801c10 <malloc+0x1b6>
+            return NULL;
+  801c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2b:	eb e3                	jmp    801c10 <malloc+0x1b6>
+
+0000000000801c2d <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801c2d:	55                   	push   %rbp
+  801c2e:	48 89 e5             	mov    %rsp,%rbp
+  801c31:	53                   	push   %rbx
+  801c32:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801c36:	48 89 fb             	mov    %rdi,%rbx
+  801c39:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801c3d:	48 89 df             	mov    %rbx,%rdi
+  801c40:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  801c47:	00 00 00 
+  801c4a:	ff d0                	call   *%rax
+  801c4c:	48 89 c7             	mov    %rax,%rdi
+  801c4f:	48 89 da             	mov    %rbx,%rdx
+  801c52:	be 00 00 00 00       	mov    $0x0,%esi
+  801c57:	48 b8 66 11 80 00 00 	movabs $0x801166,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+}
+  801c63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c67:	c9                   	leave
+  801c68:	c3                   	ret
+
+0000000000801c69 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801c69:	48 a1 28 74 80 00 00 	movabs 0x807428,%rax
+  801c70:	00 00 00 
+  801c73:	48 ba 20 74 80 00 00 	movabs $0x807420,%rdx
+  801c7a:	00 00 00 
+  801c7d:	48 3b 02             	cmp    (%rdx),%rax
+  801c80:	74 4d                	je     801ccf <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801c82:	48 85 c0             	test   %rax,%rax
+  801c85:	74 4d                	je     801cd4 <get_allocsize+0x6b>
+  801c87:	48 b9 40 74 80 00 00 	movabs $0x807440,%rcx
+  801c8e:	00 00 00 
+  801c91:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801c96:	48 3b 39             	cmp    (%rcx),%rdi
+  801c99:	74 13                	je     801cae <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801c9b:	48 83 c2 01          	add    $0x1,%rdx
+  801c9f:	48 83 c1 18          	add    $0x18,%rcx
+  801ca3:	48 39 d0             	cmp    %rdx,%rax
+  801ca6:	75 ee                	jne    801c96 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cad:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801cae:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb7:	48 be 40 74 80 00 00 	movabs $0x807440,%rsi
+  801cbe:	00 00 00 
+  801cc1:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801cc7:	75 0b                	jne    801cd4 <get_allocsize+0x6b>
+  801cc9:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801cce:	c3                   	ret
+        return 0;
+  801ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cd4:	c3                   	ret
+
+0000000000801cd5 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801cd5:	48 85 ff             	test   %rdi,%rdi
+  801cd8:	0f 84 01 01 00 00    	je     801ddf <free+0x10a>
+free(void *ptr) {
+  801cde:	55                   	push   %rbp
+  801cdf:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801ce2:	48 b8 28 74 80 00 00 	movabs $0x807428,%rax
+  801ce9:	00 00 00 
+  801cec:	48 8b 30             	mov    (%rax),%rsi
+  801cef:	48 a1 20 74 80 00 00 	movabs 0x807420,%rax
+  801cf6:	00 00 00 
+  801cf9:	48 39 c6             	cmp    %rax,%rsi
+  801cfc:	74 50                	je     801d4e <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801cfe:	48 85 f6             	test   %rsi,%rsi
+  801d01:	74 21                	je     801d24 <free+0x4f>
+  801d03:	48 b9 40 74 80 00 00 	movabs $0x807440,%rcx
+  801d0a:	00 00 00 
+  801d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801d12:	48 3b 39             	cmp    (%rcx),%rdi
+  801d15:	74 61                	je     801d78 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801d17:	48 83 c2 01          	add    $0x1,%rdx
+  801d1b:	48 83 c1 18          	add    $0x18,%rcx
+  801d1f:	48 39 d6             	cmp    %rdx,%rsi
+  801d22:	75 ee                	jne    801d12 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801d24:	48 ba 10 57 80 00 00 	movabs $0x805710,%rdx
+  801d2b:	00 00 00 
+  801d2e:	be 12 01 00 00       	mov    $0x112,%esi
+  801d33:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801d3a:	00 00 00 
+  801d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d42:	48 b9 be 03 80 00 00 	movabs $0x8003be,%rcx
+  801d49:	00 00 00 
+  801d4c:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801d4e:	48 ba c0 56 80 00 00 	movabs $0x8056c0,%rdx
+  801d55:	00 00 00 
+  801d58:	be 06 01 00 00       	mov    $0x106,%esi
+  801d5d:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801d64:	00 00 00 
+  801d67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6c:	48 b9 be 03 80 00 00 	movabs $0x8003be,%rcx
+  801d73:	00 00 00 
+  801d76:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801d78:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d7c:	48 be 40 74 80 00 00 	movabs $0x807440,%rsi
+  801d83:	00 00 00 
+  801d86:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801d8c:	75 27                	jne    801db5 <free+0xe0>
+            freep[i].is_free = true;
+  801d8e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d92:	48 ba 40 74 80 00 00 	movabs $0x807440,%rdx
+  801d99:	00 00 00 
+  801d9c:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801da3:	00 00 
+            real_freep_size++;
+  801da5:	48 83 c0 01          	add    $0x1,%rax
+  801da9:	48 a3 20 74 80 00 00 	movabs %rax,0x807420
+  801db0:	00 00 00 
+}
+  801db3:	5d                   	pop    %rbp
+  801db4:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801db5:	48 ba e8 56 80 00 00 	movabs $0x8056e8,%rdx
+  801dbc:	00 00 00 
+  801dbf:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801dc4:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801dcb:	00 00 00 
+  801dce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd3:	48 b9 be 03 80 00 00 	movabs $0x8003be,%rcx
+  801dda:	00 00 00 
+  801ddd:	ff d1                	call   *%rcx
+  801ddf:	c3                   	ret
+
+0000000000801de0 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801de0:	55                   	push   %rbp
+  801de1:	48 89 e5             	mov    %rsp,%rbp
+  801de4:	41 55                	push   %r13
+  801de6:	41 54                	push   %r12
+  801de8:	53                   	push   %rbx
+  801de9:	48 83 ec 08          	sub    $0x8,%rsp
+  801ded:	48 89 fb             	mov    %rdi,%rbx
+  801df0:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801df3:	48 b8 69 1c 80 00 00 	movabs $0x801c69,%rax
+  801dfa:	00 00 00 
+  801dfd:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801dff:	49 39 c5             	cmp    %rax,%r13
+  801e02:	73 0e                	jae    801e12 <realloc+0x32>
+}
+  801e04:	48 89 d8             	mov    %rbx,%rax
+  801e07:	48 83 c4 08          	add    $0x8,%rsp
+  801e0b:	5b                   	pop    %rbx
+  801e0c:	41 5c                	pop    %r12
+  801e0e:	41 5d                	pop    %r13
+  801e10:	5d                   	pop    %rbp
+  801e11:	c3                   	ret
+  801e12:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801e15:	4c 89 ef             	mov    %r13,%rdi
+  801e18:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  801e1f:	00 00 00 
+  801e22:	ff d0                	call   *%rax
+  801e24:	48 89 c7             	mov    %rax,%rdi
+  801e27:	4c 89 e2             	mov    %r12,%rdx
+  801e2a:	48 89 de             	mov    %rbx,%rsi
+  801e2d:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  801e34:	00 00 00 
+  801e37:	ff d0                	call   *%rax
+  801e39:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801e3c:	48 89 df             	mov    %rbx,%rdi
+  801e3f:	48 b8 d5 1c 80 00 00 	movabs $0x801cd5,%rax
+  801e46:	00 00 00 
+  801e49:	ff d0                	call   *%rax
+    return newptr;
+  801e4b:	4c 89 e3             	mov    %r12,%rbx
+  801e4e:	eb b4                	jmp    801e04 <realloc+0x24>
+
+0000000000801e50 <strdup>:
+
+char*
+strdup (const char *src) {
+  801e50:	55                   	push   %rbp
+  801e51:	48 89 e5             	mov    %rsp,%rbp
+  801e54:	41 54                	push   %r12
+  801e56:	53                   	push   %rbx
+  801e57:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801e5a:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  801e61:	00 00 00 
+  801e64:	ff d0                	call   *%rax
+  801e66:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801e6a:	4c 89 e7             	mov    %r12,%rdi
+  801e6d:	48 b8 5a 1a 80 00 00 	movabs $0x801a5a,%rax
+  801e74:	00 00 00 
+  801e77:	ff d0                	call   *%rax
+  801e79:	48 89 c7             	mov    %rax,%rdi
+  801e7c:	4c 89 e2             	mov    %r12,%rdx
+  801e7f:	48 89 de             	mov    %rbx,%rsi
+  801e82:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  801e89:	00 00 00 
+  801e8c:	ff d0                	call   *%rax
+}
+  801e8e:	5b                   	pop    %rbx
+  801e8f:	41 5c                	pop    %r12
+  801e91:	5d                   	pop    %rbp
+  801e92:	c3                   	ret
+
+0000000000801e93 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801e93:	55                   	push   %rbp
+  801e94:	48 89 e5             	mov    %rsp,%rbp
+  801e97:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801e98:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ea7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801eb1:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ebc:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ebe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ec2:	c9                   	leave
+  801ec3:	c3                   	ret
+
+0000000000801ec4 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801ec4:	55                   	push   %rbp
+  801ec5:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801ec8:	48 b8 40 74 98 00 00 	movabs $0x987440,%rax
+  801ecf:	00 00 00 
+  801ed2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801ed6:	74 26                	je     801efe <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801ed8:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801eda:	48 c1 e2 20          	shl    $0x20,%rdx
+  801ede:	89 c0                	mov    %eax,%eax
+  801ee0:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801ee3:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801eea:	48 b9 40 74 98 00 00 	movabs $0x987440,%rcx
+  801ef1:	00 00 00 
+  801ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef9:	48 f7 31             	divq   (%rcx)
+}
+  801efc:	5d                   	pop    %rbp
+  801efd:	c3                   	ret
+        freq = get_cpufreq();
+  801efe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f03:	48 ba 93 1e 80 00 00 	movabs $0x801e93,%rdx
+  801f0a:	00 00 00 
+  801f0d:	ff d2                	call   *%rdx
+  801f0f:	48 a3 40 74 98 00 00 	movabs %rax,0x987440
+  801f16:	00 00 00 
+  801f19:	eb bd                	jmp    801ed8 <get_ticks+0x14>
+
+0000000000801f1b <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801f1b:	55                   	push   %rbp
+  801f1c:	48 89 e5             	mov    %rsp,%rbp
+  801f1f:	53                   	push   %rbx
+  801f20:	48 83 ec 08          	sub    $0x8,%rsp
+  801f24:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801f27:	48 b8 40 74 98 00 00 	movabs $0x987440,%rax
+  801f2e:	00 00 00 
+  801f31:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801f35:	74 50                	je     801f87 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801f37:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f39:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f3d:	89 c0                	mov    %eax,%eax
+  801f3f:	48 89 d6             	mov    %rdx,%rsi
+  801f42:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801f45:	48 b8 40 74 98 00 00 	movabs $0x987440,%rax
+  801f4c:	00 00 00 
+  801f4f:	48 0f af 18          	imul   (%rax),%rbx
+  801f53:	48 c1 eb 03          	shr    $0x3,%rbx
+  801f57:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801f5e:	9b c4 20 
+  801f61:	48 89 d8             	mov    %rbx,%rax
+  801f64:	48 f7 e2             	mul    %rdx
+  801f67:	48 89 d1             	mov    %rdx,%rcx
+  801f6a:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801f6e:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f70:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f74:	89 c0                	mov    %eax,%eax
+  801f76:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801f79:	48 29 f2             	sub    %rsi,%rdx
+  801f7c:	48 39 ca             	cmp    %rcx,%rdx
+  801f7f:	72 ed                	jb     801f6e <sleep+0x53>
+}
+  801f81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f85:	c9                   	leave
+  801f86:	c3                   	ret
+        freq = get_cpufreq();
+  801f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f8c:	48 ba 93 1e 80 00 00 	movabs $0x801e93,%rdx
+  801f93:	00 00 00 
+  801f96:	ff d2                	call   *%rdx
+  801f98:	48 a3 40 74 98 00 00 	movabs %rax,0x987440
+  801f9f:	00 00 00 
+  801fa2:	eb 93                	jmp    801f37 <sleep+0x1c>
+
+0000000000801fa4 <poll_kbd>:
+
+int poll_kbd() {
+  801fa4:	55                   	push   %rbp
+  801fa5:	48 89 e5             	mov    %rsp,%rbp
+  801fa8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801fa9:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fae:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fbd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fc2:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fcd:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  801fcf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fd3:	c9                   	leave
+  801fd4:	c3                   	ret
+
+0000000000801fd5 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  801fd5:	55                   	push   %rbp
+  801fd6:	48 89 e5             	mov    %rsp,%rbp
+  801fd9:	53                   	push   %rbx
+  801fda:	49 89 fa             	mov    %rdi,%r10
+  801fdd:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  801fdf:	44 89 c6             	mov    %r8d,%esi
+  801fe2:	89 cf                	mov    %ecx,%edi
+  801fe4:	89 d3                	mov    %edx,%ebx
+  801fe6:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  801fe8:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fed:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ff0:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  801ff4:	cd 30                	int    $0x30
+  801ff6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ffa:	c9                   	leave
+  801ffb:	c3                   	ret
+
+0000000000801ffc <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801ffc:	55                   	push   %rbp
+  801ffd:	48 89 e5             	mov    %rsp,%rbp
+  802000:	41 54                	push   %r12
+  802002:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  802003:	48 b8 b5 37 80 00 00 	movabs $0x8037b5,%rax
+  80200a:	00 00 00 
+  80200d:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80200f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802014:	cd 30                	int    $0x30
+  802016:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	78 76                	js     802093 <fork+0x97>
+        return envid;
+    if (!envid) {
+  80201d:	74 7c                	je     80209b <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  80201f:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802025:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80202c:	00 00 00 
+  80202f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802034:	89 c2                	mov    %eax,%edx
+  802036:	be 00 00 00 00       	mov    $0x0,%esi
+  80203b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802040:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	75 7c                	jne    8020cc <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  802050:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  802057:	00 00 00 
+  80205a:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  802061:	44 89 e7             	mov    %r12d,%edi
+  802064:	48 b8 fe 18 80 00 00 	movabs $0x8018fe,%rax
+  80206b:	00 00 00 
+  80206e:	ff d0                	call   *%rax
+  802070:	85 c0                	test   %eax,%eax
+  802072:	75 60                	jne    8020d4 <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  802074:	be 02 00 00 00       	mov    $0x2,%esi
+  802079:	44 89 e7             	mov    %r12d,%edi
+  80207c:	48 b8 2c 18 80 00 00 	movabs $0x80182c,%rax
+  802083:	00 00 00 
+  802086:	ff d0                	call   *%rax
+        return -1;
+  802088:	85 c0                	test   %eax,%eax
+  80208a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80208f:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  802093:	44 89 e0             	mov    %r12d,%eax
+  802096:	5b                   	pop    %rbx
+  802097:	41 5c                	pop    %r12
+  802099:	5d                   	pop    %rbp
+  80209a:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80209b:	48 b8 26 15 80 00 00 	movabs $0x801526,%rax
+  8020a2:	00 00 00 
+  8020a5:	ff d0                	call   *%rax
+  8020a7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8020ac:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8020b3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8020ba:	00 00 00 
+  8020bd:	48 01 d0             	add    %rdx,%rax
+  8020c0:	48 a3 00 74 80 00 00 	movabs %rax,0x807400
+  8020c7:	00 00 00 
+        return 0;
+  8020ca:	eb c7                	jmp    802093 <fork+0x97>
+        return -1;
+  8020cc:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8020d2:	eb bf                	jmp    802093 <fork+0x97>
+  8020d4:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8020da:	eb b7                	jmp    802093 <fork+0x97>
+
+00000000008020dc <sfork>:
+
+envid_t
+sfork() {
+  8020dc:	55                   	push   %rbp
+  8020dd:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8020e0:	48 ba 46 57 80 00 00 	movabs $0x805746,%rdx
+  8020e7:	00 00 00 
+  8020ea:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8020ef:	48 bf 61 57 80 00 00 	movabs $0x805761,%rdi
+  8020f6:	00 00 00 
+  8020f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fe:	48 b9 be 03 80 00 00 	movabs $0x8003be,%rcx
+  802105:	00 00 00 
+  802108:	ff d1                	call   *%rcx
+
+000000000080210a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80210a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802111:	ff ff ff 
+  802114:	48 01 f8             	add    %rdi,%rax
+  802117:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80211b:	c3                   	ret
+
+000000000080211c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80211c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802123:	ff ff ff 
+  802126:	48 01 f8             	add    %rdi,%rax
+  802129:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80212d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802133:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802137:	c3                   	ret
+
+0000000000802138 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802138:	55                   	push   %rbp
+  802139:	48 89 e5             	mov    %rsp,%rbp
+  80213c:	41 57                	push   %r15
+  80213e:	41 56                	push   %r14
+  802140:	41 55                	push   %r13
+  802142:	41 54                	push   %r12
+  802144:	53                   	push   %rbx
+  802145:	48 83 ec 08          	sub    $0x8,%rsp
+  802149:	49 89 ff             	mov    %rdi,%r15
+  80214c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802151:	49 bd a5 40 80 00 00 	movabs $0x8040a5,%r13
+  802158:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80215b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802161:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802164:	48 89 df             	mov    %rbx,%rdi
+  802167:	41 ff d5             	call   *%r13
+  80216a:	83 e0 04             	and    $0x4,%eax
+  80216d:	74 17                	je     802186 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80216f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802176:	4c 39 f3             	cmp    %r14,%rbx
+  802179:	75 e6                	jne    802161 <fd_alloc+0x29>
+  80217b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802181:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802186:	4d 89 27             	mov    %r12,(%r15)
+}
+  802189:	48 83 c4 08          	add    $0x8,%rsp
+  80218d:	5b                   	pop    %rbx
+  80218e:	41 5c                	pop    %r12
+  802190:	41 5d                	pop    %r13
+  802192:	41 5e                	pop    %r14
+  802194:	41 5f                	pop    %r15
+  802196:	5d                   	pop    %rbp
+  802197:	c3                   	ret
+
+0000000000802198 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802198:	83 ff 1f             	cmp    $0x1f,%edi
+  80219b:	77 39                	ja     8021d6 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80219d:	55                   	push   %rbp
+  80219e:	48 89 e5             	mov    %rsp,%rbp
+  8021a1:	41 54                	push   %r12
+  8021a3:	53                   	push   %rbx
+  8021a4:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8021a7:	48 63 df             	movslq %edi,%rbx
+  8021aa:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8021b1:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8021b5:	48 89 df             	mov    %rbx,%rdi
+  8021b8:	48 b8 a5 40 80 00 00 	movabs $0x8040a5,%rax
+  8021bf:	00 00 00 
+  8021c2:	ff d0                	call   *%rax
+  8021c4:	a8 04                	test   $0x4,%al
+  8021c6:	74 14                	je     8021dc <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8021c8:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8021cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021d1:	5b                   	pop    %rbx
+  8021d2:	41 5c                	pop    %r12
+  8021d4:	5d                   	pop    %rbp
+  8021d5:	c3                   	ret
+        return -E_INVAL;
+  8021d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8021db:	c3                   	ret
+        return -E_INVAL;
+  8021dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021e1:	eb ee                	jmp    8021d1 <fd_lookup+0x39>
+
+00000000008021e3 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8021e3:	55                   	push   %rbp
+  8021e4:	48 89 e5             	mov    %rsp,%rbp
+  8021e7:	41 54                	push   %r12
+  8021e9:	53                   	push   %rbx
+  8021ea:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8021ed:	48 b8 00 58 80 00 00 	movabs $0x805800,%rax
+  8021f4:	00 00 00 
+  8021f7:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8021fe:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802201:	39 3b                	cmp    %edi,(%rbx)
+  802203:	74 47                	je     80224c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802205:	48 83 c0 08          	add    $0x8,%rax
+  802209:	48 8b 18             	mov    (%rax),%rbx
+  80220c:	48 85 db             	test   %rbx,%rbx
+  80220f:	75 f0                	jne    802201 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802211:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  802218:	00 00 00 
+  80221b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802221:	89 fa                	mov    %edi,%edx
+  802223:	48 bf 70 57 80 00 00 	movabs $0x805770,%rdi
+  80222a:	00 00 00 
+  80222d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802232:	48 b9 0e 05 80 00 00 	movabs $0x80050e,%rcx
+  802239:	00 00 00 
+  80223c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80223e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802243:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802247:	5b                   	pop    %rbx
+  802248:	41 5c                	pop    %r12
+  80224a:	5d                   	pop    %rbp
+  80224b:	c3                   	ret
+            return 0;
+  80224c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802251:	eb f0                	jmp    802243 <dev_lookup+0x60>
+
+0000000000802253 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802253:	55                   	push   %rbp
+  802254:	48 89 e5             	mov    %rsp,%rbp
+  802257:	41 55                	push   %r13
+  802259:	41 54                	push   %r12
+  80225b:	53                   	push   %rbx
+  80225c:	48 83 ec 18          	sub    $0x18,%rsp
+  802260:	48 89 fb             	mov    %rdi,%rbx
+  802263:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802266:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80226d:	ff ff ff 
+  802270:	48 01 df             	add    %rbx,%rdi
+  802273:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802277:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80227b:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  802282:	00 00 00 
+  802285:	ff d0                	call   *%rax
+  802287:	41 89 c5             	mov    %eax,%r13d
+  80228a:	85 c0                	test   %eax,%eax
+  80228c:	78 06                	js     802294 <fd_close+0x41>
+  80228e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802292:	74 1a                	je     8022ae <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802294:	45 84 e4             	test   %r12b,%r12b
+  802297:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8022a0:	44 89 e8             	mov    %r13d,%eax
+  8022a3:	48 83 c4 18          	add    $0x18,%rsp
+  8022a7:	5b                   	pop    %rbx
+  8022a8:	41 5c                	pop    %r12
+  8022aa:	41 5d                	pop    %r13
+  8022ac:	5d                   	pop    %rbp
+  8022ad:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8022ae:	8b 3b                	mov    (%rbx),%edi
+  8022b0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022b4:	48 b8 e3 21 80 00 00 	movabs $0x8021e3,%rax
+  8022bb:	00 00 00 
+  8022be:	ff d0                	call   *%rax
+  8022c0:	41 89 c5             	mov    %eax,%r13d
+  8022c3:	85 c0                	test   %eax,%eax
+  8022c5:	78 1b                	js     8022e2 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8022c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022cb:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8022cf:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8022d5:	48 85 c0             	test   %rax,%rax
+  8022d8:	74 08                	je     8022e2 <fd_close+0x8f>
+  8022da:	48 89 df             	mov    %rbx,%rdi
+  8022dd:	ff d0                	call   *%rax
+  8022df:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8022e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022e7:	48 89 de             	mov    %rbx,%rsi
+  8022ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ef:	48 b8 c5 17 80 00 00 	movabs $0x8017c5,%rax
+  8022f6:	00 00 00 
+  8022f9:	ff d0                	call   *%rax
+    return res;
+  8022fb:	eb a3                	jmp    8022a0 <fd_close+0x4d>
+
+00000000008022fd <close>:
+
+int
+close(int fdnum) {
+  8022fd:	55                   	push   %rbp
+  8022fe:	48 89 e5             	mov    %rsp,%rbp
+  802301:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802305:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802309:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  802310:	00 00 00 
+  802313:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802315:	85 c0                	test   %eax,%eax
+  802317:	78 15                	js     80232e <close+0x31>
+
+    return fd_close(fd, 1);
+  802319:	be 01 00 00 00       	mov    $0x1,%esi
+  80231e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802322:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  802329:	00 00 00 
+  80232c:	ff d0                	call   *%rax
+}
+  80232e:	c9                   	leave
+  80232f:	c3                   	ret
+
+0000000000802330 <close_all>:
+
+void
+close_all(void) {
+  802330:	55                   	push   %rbp
+  802331:	48 89 e5             	mov    %rsp,%rbp
+  802334:	41 54                	push   %r12
+  802336:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802337:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80233c:	49 bc fd 22 80 00 00 	movabs $0x8022fd,%r12
+  802343:	00 00 00 
+  802346:	89 df                	mov    %ebx,%edi
+  802348:	41 ff d4             	call   *%r12
+  80234b:	83 c3 01             	add    $0x1,%ebx
+  80234e:	83 fb 20             	cmp    $0x20,%ebx
+  802351:	75 f3                	jne    802346 <close_all+0x16>
+}
+  802353:	5b                   	pop    %rbx
+  802354:	41 5c                	pop    %r12
+  802356:	5d                   	pop    %rbp
+  802357:	c3                   	ret
+
+0000000000802358 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802358:	55                   	push   %rbp
+  802359:	48 89 e5             	mov    %rsp,%rbp
+  80235c:	41 57                	push   %r15
+  80235e:	41 56                	push   %r14
+  802360:	41 55                	push   %r13
+  802362:	41 54                	push   %r12
+  802364:	53                   	push   %rbx
+  802365:	48 83 ec 18          	sub    $0x18,%rsp
+  802369:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80236c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802370:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  802377:	00 00 00 
+  80237a:	ff d0                	call   *%rax
+  80237c:	89 c3                	mov    %eax,%ebx
+  80237e:	85 c0                	test   %eax,%eax
+  802380:	0f 88 b8 00 00 00    	js     80243e <dup+0xe6>
+    close(newfdnum);
+  802386:	44 89 e7             	mov    %r12d,%edi
+  802389:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  802390:	00 00 00 
+  802393:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802395:	4d 63 ec             	movslq %r12d,%r13
+  802398:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80239f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8023a3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8023a7:	4c 89 ff             	mov    %r15,%rdi
+  8023aa:	49 be 1c 21 80 00 00 	movabs $0x80211c,%r14
+  8023b1:	00 00 00 
+  8023b4:	41 ff d6             	call   *%r14
+  8023b7:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8023ba:	4c 89 ef             	mov    %r13,%rdi
+  8023bd:	41 ff d6             	call   *%r14
+  8023c0:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8023c3:	48 89 df             	mov    %rbx,%rdi
+  8023c6:	48 b8 a5 40 80 00 00 	movabs $0x8040a5,%rax
+  8023cd:	00 00 00 
+  8023d0:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8023d2:	a8 04                	test   $0x4,%al
+  8023d4:	74 2b                	je     802401 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8023d6:	41 89 c1             	mov    %eax,%r9d
+  8023d9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023df:	4c 89 f1             	mov    %r14,%rcx
+  8023e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e7:	48 89 de             	mov    %rbx,%rsi
+  8023ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ef:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  8023f6:	00 00 00 
+  8023f9:	ff d0                	call   *%rax
+  8023fb:	89 c3                	mov    %eax,%ebx
+  8023fd:	85 c0                	test   %eax,%eax
+  8023ff:	78 4e                	js     80244f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802401:	4c 89 ff             	mov    %r15,%rdi
+  802404:	48 b8 a5 40 80 00 00 	movabs $0x8040a5,%rax
+  80240b:	00 00 00 
+  80240e:	ff d0                	call   *%rax
+  802410:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802413:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802419:	4c 89 e9             	mov    %r13,%rcx
+  80241c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802421:	4c 89 fe             	mov    %r15,%rsi
+  802424:	bf 00 00 00 00       	mov    $0x0,%edi
+  802429:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  802430:	00 00 00 
+  802433:	ff d0                	call   *%rax
+  802435:	89 c3                	mov    %eax,%ebx
+  802437:	85 c0                	test   %eax,%eax
+  802439:	78 14                	js     80244f <dup+0xf7>
+
+    return newfdnum;
+  80243b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80243e:	89 d8                	mov    %ebx,%eax
+  802440:	48 83 c4 18          	add    $0x18,%rsp
+  802444:	5b                   	pop    %rbx
+  802445:	41 5c                	pop    %r12
+  802447:	41 5d                	pop    %r13
+  802449:	41 5e                	pop    %r14
+  80244b:	41 5f                	pop    %r15
+  80244d:	5d                   	pop    %rbp
+  80244e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80244f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802454:	4c 89 ee             	mov    %r13,%rsi
+  802457:	bf 00 00 00 00       	mov    $0x0,%edi
+  80245c:	49 bc c5 17 80 00 00 	movabs $0x8017c5,%r12
+  802463:	00 00 00 
+  802466:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802469:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80246e:	4c 89 f6             	mov    %r14,%rsi
+  802471:	bf 00 00 00 00       	mov    $0x0,%edi
+  802476:	41 ff d4             	call   *%r12
+    return res;
+  802479:	eb c3                	jmp    80243e <dup+0xe6>
+
+000000000080247b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80247b:	55                   	push   %rbp
+  80247c:	48 89 e5             	mov    %rsp,%rbp
+  80247f:	41 56                	push   %r14
+  802481:	41 55                	push   %r13
+  802483:	41 54                	push   %r12
+  802485:	53                   	push   %rbx
+  802486:	48 83 ec 10          	sub    $0x10,%rsp
+  80248a:	89 fb                	mov    %edi,%ebx
+  80248c:	49 89 f4             	mov    %rsi,%r12
+  80248f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802492:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802496:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  80249d:	00 00 00 
+  8024a0:	ff d0                	call   *%rax
+  8024a2:	85 c0                	test   %eax,%eax
+  8024a4:	78 4c                	js     8024f2 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024a6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8024aa:	41 8b 3e             	mov    (%r14),%edi
+  8024ad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024b1:	48 b8 e3 21 80 00 00 	movabs $0x8021e3,%rax
+  8024b8:	00 00 00 
+  8024bb:	ff d0                	call   *%rax
+  8024bd:	85 c0                	test   %eax,%eax
+  8024bf:	78 35                	js     8024f6 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8024c1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8024c5:	83 e0 03             	and    $0x3,%eax
+  8024c8:	83 f8 01             	cmp    $0x1,%eax
+  8024cb:	74 2d                	je     8024fa <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8024cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024d1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8024d5:	48 85 c0             	test   %rax,%rax
+  8024d8:	74 56                	je     802530 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8024da:	4c 89 ea             	mov    %r13,%rdx
+  8024dd:	4c 89 e6             	mov    %r12,%rsi
+  8024e0:	4c 89 f7             	mov    %r14,%rdi
+  8024e3:	ff d0                	call   *%rax
+}
+  8024e5:	48 83 c4 10          	add    $0x10,%rsp
+  8024e9:	5b                   	pop    %rbx
+  8024ea:	41 5c                	pop    %r12
+  8024ec:	41 5d                	pop    %r13
+  8024ee:	41 5e                	pop    %r14
+  8024f0:	5d                   	pop    %rbp
+  8024f1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024f2:	48 98                	cltq
+  8024f4:	eb ef                	jmp    8024e5 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8024f6:	48 98                	cltq
+  8024f8:	eb eb                	jmp    8024e5 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024fa:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  802501:	00 00 00 
+  802504:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80250a:	89 da                	mov    %ebx,%edx
+  80250c:	48 bf b1 57 80 00 00 	movabs $0x8057b1,%rdi
+  802513:	00 00 00 
+  802516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80251b:	48 b9 0e 05 80 00 00 	movabs $0x80050e,%rcx
+  802522:	00 00 00 
+  802525:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802527:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80252e:	eb b5                	jmp    8024e5 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802530:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802537:	eb ac                	jmp    8024e5 <read+0x6a>
+
+0000000000802539 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802539:	55                   	push   %rbp
+  80253a:	48 89 e5             	mov    %rsp,%rbp
+  80253d:	41 57                	push   %r15
+  80253f:	41 56                	push   %r14
+  802541:	41 55                	push   %r13
+  802543:	41 54                	push   %r12
+  802545:	53                   	push   %rbx
+  802546:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80254a:	48 85 d2             	test   %rdx,%rdx
+  80254d:	74 54                	je     8025a3 <readn+0x6a>
+  80254f:	41 89 fd             	mov    %edi,%r13d
+  802552:	49 89 f6             	mov    %rsi,%r14
+  802555:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802558:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80255d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802562:	49 bf 7b 24 80 00 00 	movabs $0x80247b,%r15
+  802569:	00 00 00 
+  80256c:	4c 89 e2             	mov    %r12,%rdx
+  80256f:	48 29 f2             	sub    %rsi,%rdx
+  802572:	4c 01 f6             	add    %r14,%rsi
+  802575:	44 89 ef             	mov    %r13d,%edi
+  802578:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80257b:	85 c0                	test   %eax,%eax
+  80257d:	78 20                	js     80259f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80257f:	01 c3                	add    %eax,%ebx
+  802581:	85 c0                	test   %eax,%eax
+  802583:	74 08                	je     80258d <readn+0x54>
+  802585:	48 63 f3             	movslq %ebx,%rsi
+  802588:	4c 39 e6             	cmp    %r12,%rsi
+  80258b:	72 df                	jb     80256c <readn+0x33>
+    }
+    return res;
+  80258d:	48 63 c3             	movslq %ebx,%rax
+}
+  802590:	48 83 c4 08          	add    $0x8,%rsp
+  802594:	5b                   	pop    %rbx
+  802595:	41 5c                	pop    %r12
+  802597:	41 5d                	pop    %r13
+  802599:	41 5e                	pop    %r14
+  80259b:	41 5f                	pop    %r15
+  80259d:	5d                   	pop    %rbp
+  80259e:	c3                   	ret
+        if (inc < 0) return inc;
+  80259f:	48 98                	cltq
+  8025a1:	eb ed                	jmp    802590 <readn+0x57>
+    int inc = 1, res = 0;
+  8025a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025a8:	eb e3                	jmp    80258d <readn+0x54>
+
+00000000008025aa <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8025aa:	55                   	push   %rbp
+  8025ab:	48 89 e5             	mov    %rsp,%rbp
+  8025ae:	41 56                	push   %r14
+  8025b0:	41 55                	push   %r13
+  8025b2:	41 54                	push   %r12
+  8025b4:	53                   	push   %rbx
+  8025b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b9:	89 fb                	mov    %edi,%ebx
+  8025bb:	49 89 f4             	mov    %rsi,%r12
+  8025be:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025c1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025c5:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  8025cc:	00 00 00 
+  8025cf:	ff d0                	call   *%rax
+  8025d1:	85 c0                	test   %eax,%eax
+  8025d3:	78 47                	js     80261c <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025d5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8025d9:	41 8b 3e             	mov    (%r14),%edi
+  8025dc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025e0:	48 b8 e3 21 80 00 00 	movabs $0x8021e3,%rax
+  8025e7:	00 00 00 
+  8025ea:	ff d0                	call   *%rax
+  8025ec:	85 c0                	test   %eax,%eax
+  8025ee:	78 30                	js     802620 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025f0:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8025f5:	74 2d                	je     802624 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8025f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025fb:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8025ff:	48 85 c0             	test   %rax,%rax
+  802602:	74 56                	je     80265a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802604:	4c 89 ea             	mov    %r13,%rdx
+  802607:	4c 89 e6             	mov    %r12,%rsi
+  80260a:	4c 89 f7             	mov    %r14,%rdi
+  80260d:	ff d0                	call   *%rax
+}
+  80260f:	48 83 c4 10          	add    $0x10,%rsp
+  802613:	5b                   	pop    %rbx
+  802614:	41 5c                	pop    %r12
+  802616:	41 5d                	pop    %r13
+  802618:	41 5e                	pop    %r14
+  80261a:	5d                   	pop    %rbp
+  80261b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80261c:	48 98                	cltq
+  80261e:	eb ef                	jmp    80260f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802620:	48 98                	cltq
+  802622:	eb eb                	jmp    80260f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802624:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  80262b:	00 00 00 
+  80262e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802634:	89 da                	mov    %ebx,%edx
+  802636:	48 bf cd 57 80 00 00 	movabs $0x8057cd,%rdi
+  80263d:	00 00 00 
+  802640:	b8 00 00 00 00       	mov    $0x0,%eax
+  802645:	48 b9 0e 05 80 00 00 	movabs $0x80050e,%rcx
+  80264c:	00 00 00 
+  80264f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802651:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802658:	eb b5                	jmp    80260f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80265a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802661:	eb ac                	jmp    80260f <write+0x65>
+
+0000000000802663 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802663:	55                   	push   %rbp
+  802664:	48 89 e5             	mov    %rsp,%rbp
+  802667:	53                   	push   %rbx
+  802668:	48 83 ec 18          	sub    $0x18,%rsp
+  80266c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80266e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802672:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  802679:	00 00 00 
+  80267c:	ff d0                	call   *%rax
+  80267e:	85 c0                	test   %eax,%eax
+  802680:	78 0c                	js     80268e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802682:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802686:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802689:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802692:	c9                   	leave
+  802693:	c3                   	ret
+
+0000000000802694 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802694:	55                   	push   %rbp
+  802695:	48 89 e5             	mov    %rsp,%rbp
+  802698:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80269c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026a0:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  8026a7:	00 00 00 
+  8026aa:	ff d0                	call   *%rax
+  8026ac:	85 c0                	test   %eax,%eax
+  8026ae:	78 07                	js     8026b7 <tell+0x23>
+    return fdes->fd_offset;
+  8026b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026b4:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8026b7:	c9                   	leave
+  8026b8:	c3                   	ret
+
+00000000008026b9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8026b9:	55                   	push   %rbp
+  8026ba:	48 89 e5             	mov    %rsp,%rbp
+  8026bd:	41 55                	push   %r13
+  8026bf:	41 54                	push   %r12
+  8026c1:	53                   	push   %rbx
+  8026c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8026c6:	89 fb                	mov    %edi,%ebx
+  8026c8:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026cb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026cf:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  8026d6:	00 00 00 
+  8026d9:	ff d0                	call   *%rax
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	78 38                	js     802717 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026df:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8026e3:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8026e7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026eb:	48 b8 e3 21 80 00 00 	movabs $0x8021e3,%rax
+  8026f2:	00 00 00 
+  8026f5:	ff d0                	call   *%rax
+  8026f7:	85 c0                	test   %eax,%eax
+  8026f9:	78 1c                	js     802717 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026fb:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802700:	74 20                	je     802722 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802702:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802706:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80270a:	48 85 c0             	test   %rax,%rax
+  80270d:	74 47                	je     802756 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80270f:	44 89 e6             	mov    %r12d,%esi
+  802712:	4c 89 ef             	mov    %r13,%rdi
+  802715:	ff d0                	call   *%rax
+}
+  802717:	48 83 c4 18          	add    $0x18,%rsp
+  80271b:	5b                   	pop    %rbx
+  80271c:	41 5c                	pop    %r12
+  80271e:	41 5d                	pop    %r13
+  802720:	5d                   	pop    %rbp
+  802721:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802722:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  802729:	00 00 00 
+  80272c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802732:	89 da                	mov    %ebx,%edx
+  802734:	48 bf 90 57 80 00 00 	movabs $0x805790,%rdi
+  80273b:	00 00 00 
+  80273e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802743:	48 b9 0e 05 80 00 00 	movabs $0x80050e,%rcx
+  80274a:	00 00 00 
+  80274d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80274f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802754:	eb c1                	jmp    802717 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802756:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80275b:	eb ba                	jmp    802717 <ftruncate+0x5e>
+
+000000000080275d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80275d:	55                   	push   %rbp
+  80275e:	48 89 e5             	mov    %rsp,%rbp
+  802761:	41 54                	push   %r12
+  802763:	53                   	push   %rbx
+  802764:	48 83 ec 10          	sub    $0x10,%rsp
+  802768:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80276b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80276f:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  802776:	00 00 00 
+  802779:	ff d0                	call   *%rax
+  80277b:	85 c0                	test   %eax,%eax
+  80277d:	78 4e                	js     8027cd <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80277f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802783:	41 8b 3c 24          	mov    (%r12),%edi
+  802787:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80278b:	48 b8 e3 21 80 00 00 	movabs $0x8021e3,%rax
+  802792:	00 00 00 
+  802795:	ff d0                	call   *%rax
+  802797:	85 c0                	test   %eax,%eax
+  802799:	78 32                	js     8027cd <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80279b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80279f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8027a4:	74 30                	je     8027d6 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8027a6:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8027a9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8027b0:	00 00 00 
+    stat->st_isdir = 0;
+  8027b3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027ba:	00 00 00 
+    stat->st_dev = dev;
+  8027bd:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8027c4:	48 89 de             	mov    %rbx,%rsi
+  8027c7:	4c 89 e7             	mov    %r12,%rdi
+  8027ca:	ff 50 28             	call   *0x28(%rax)
+}
+  8027cd:	48 83 c4 10          	add    $0x10,%rsp
+  8027d1:	5b                   	pop    %rbx
+  8027d2:	41 5c                	pop    %r12
+  8027d4:	5d                   	pop    %rbp
+  8027d5:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8027d6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8027db:	eb f0                	jmp    8027cd <fstat+0x70>
+
+00000000008027dd <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8027dd:	55                   	push   %rbp
+  8027de:	48 89 e5             	mov    %rsp,%rbp
+  8027e1:	41 54                	push   %r12
+  8027e3:	53                   	push   %rbx
+  8027e4:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8027eb:	41 89 fc             	mov    %edi,%r12d
+  8027ee:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027f0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8027f4:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  8027fb:	00 00 00 
+  8027fe:	ff d0                	call   *%rax
+  802800:	85 c0                	test   %eax,%eax
+  802802:	78 31                	js     802835 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802804:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80280b:	44 89 e7             	mov    %r12d,%edi
+  80280e:	48 b8 5d 27 80 00 00 	movabs $0x80275d,%rax
+  802815:	00 00 00 
+  802818:	ff d0                	call   *%rax
+  80281a:	85 c0                	test   %eax,%eax
+  80281c:	78 17                	js     802835 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  80281e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802822:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802825:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802828:	39 d3                	cmp    %edx,%ebx
+  80282a:	0f 4f da             	cmovg  %edx,%ebx
+  80282d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802830:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802835:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  80283c:	5b                   	pop    %rbx
+  80283d:	41 5c                	pop    %r12
+  80283f:	5d                   	pop    %rbp
+  802840:	c3                   	ret
+
+0000000000802841 <seektoend>:
+{
+  802841:	55                   	push   %rbp
+  802842:	48 89 e5             	mov    %rsp,%rbp
+  802845:	53                   	push   %rbx
+  802846:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80284d:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80284f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802853:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+  80285f:	85 c0                	test   %eax,%eax
+  802861:	78 28                	js     80288b <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802863:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80286a:	89 df                	mov    %ebx,%edi
+  80286c:	48 b8 5d 27 80 00 00 	movabs $0x80275d,%rax
+  802873:	00 00 00 
+  802876:	ff d0                	call   *%rax
+  802878:	85 c0                	test   %eax,%eax
+  80287a:	78 0f                	js     80288b <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80287c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80287f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802883:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802886:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80288f:	c9                   	leave
+  802890:	c3                   	ret
+
+0000000000802891 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802891:	55                   	push   %rbp
+  802892:	48 89 e5             	mov    %rsp,%rbp
+  802895:	41 54                	push   %r12
+  802897:	53                   	push   %rbx
+  802898:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80289b:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a0:	48 b8 84 34 80 00 00 	movabs $0x803484,%rax
+  8028a7:	00 00 00 
+  8028aa:	ff d0                	call   *%rax
+  8028ac:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8028ae:	85 c0                	test   %eax,%eax
+  8028b0:	78 25                	js     8028d7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8028b2:	4c 89 e6             	mov    %r12,%rsi
+  8028b5:	89 c7                	mov    %eax,%edi
+  8028b7:	48 b8 5d 27 80 00 00 	movabs $0x80275d,%rax
+  8028be:	00 00 00 
+  8028c1:	ff d0                	call   *%rax
+  8028c3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8028c6:	89 df                	mov    %ebx,%edi
+  8028c8:	48 b8 fd 22 80 00 00 	movabs $0x8022fd,%rax
+  8028cf:	00 00 00 
+  8028d2:	ff d0                	call   *%rax
+
+    return res;
+  8028d4:	44 89 e3             	mov    %r12d,%ebx
+}
+  8028d7:	89 d8                	mov    %ebx,%eax
+  8028d9:	5b                   	pop    %rbx
+  8028da:	41 5c                	pop    %r12
+  8028dc:	5d                   	pop    %rbp
+  8028dd:	c3                   	ret
+
+00000000008028de <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8028de:	55                   	push   %rbp
+  8028df:	48 89 e5             	mov    %rsp,%rbp
+  8028e2:	53                   	push   %rbx
+  8028e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e7:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8028ea:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  8028f1:	00 00 00 
+  8028f4:	ff d0                	call   *%rax
+  8028f6:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8028fa:	0f 87 ea 00 00 00    	ja     8029ea <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802900:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802907:	00 00 00 
+  80290a:	80 38 00             	cmpb   $0x0,(%rax)
+  80290d:	75 35                	jne    802944 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  80290f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802914:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802919:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  80291e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802923:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  80292a:	00 00 00 
+  80292d:	ff d0                	call   *%rax
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	0f 88 ba 00 00 00    	js     8029f1 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802937:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  80293e:	00 00 00 
+  802941:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802944:	48 89 df             	mov    %rbx,%rdi
+  802947:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  80294e:	00 00 00 
+  802951:	ff d0                	call   *%rax
+  802953:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802957:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  80295e:	00 00 00 
+  802961:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802965:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802968:	39 39                	cmp    %edi,(%rcx)
+  80296a:	74 46                	je     8029b2 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  80296c:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802970:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802977:	00 
+  802978:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  80297f:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802986:	00 
+  802987:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  80298e:	00 
+  80298f:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802996:	00 
+  802997:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  80299e:	00 
+  80299f:	89 39                	mov    %edi,(%rcx)
+  8029a1:	48 01 c6             	add    %rax,%rsi
+  8029a4:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  8029a9:	48 89 c8             	mov    %rcx,%rax
+  8029ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029b0:	c9                   	leave
+  8029b1:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  8029b2:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  8029b6:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  8029bd:	00 00 00 
+  8029c0:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8029c3:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  8029c7:	74 e0                	je     8029a9 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  8029c9:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8029d0:	00 
+  8029d1:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  8029d5:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  8029dc:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  8029de:	8b 7b 10             	mov    0x10(%rbx),%edi
+  8029e1:	48 01 c2             	add    %rax,%rdx
+  8029e4:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  8029e8:	eb bf                	jmp    8029a9 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8029ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029ef:	eb b8                	jmp    8029a9 <fbuf_get+0xcb>
+            return NULL;
+  8029f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029f6:	eb b1                	jmp    8029a9 <fbuf_get+0xcb>
+
+00000000008029f8 <fsipc_bulk>:
+fsipc_bulk(void) {
+  8029f8:	55                   	push   %rbp
+  8029f9:	48 89 e5             	mov    %rsp,%rbp
+  8029fc:	53                   	push   %rbx
+  8029fd:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802a01:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a08:	00 00 00 
+  802a0b:	48 8b 18             	mov    (%rax),%rbx
+  802a0e:	48 85 db             	test   %rbx,%rbx
+  802a11:	74 16                	je     802a29 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802a13:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802a1a:	00 00 00 
+  802a1d:	48 8b 18             	mov    (%rax),%rbx
+}
+  802a20:	48 89 d8             	mov    %rbx,%rax
+  802a23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a27:	c9                   	leave
+  802a28:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802a29:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a2e:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802a33:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802a38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a3d:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  802a44:	00 00 00 
+  802a47:	ff d0                	call   *%rax
+  802a49:	85 c0                	test   %eax,%eax
+  802a4b:	78 d3                	js     802a20 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802a4d:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802a52:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802a59:	00 00 00 
+  802a5c:	eb b5                	jmp    802a13 <fsipc_bulk+0x1b>
+
+0000000000802a5e <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802a5e:	55                   	push   %rbp
+  802a5f:	48 89 e5             	mov    %rsp,%rbp
+  802a62:	41 57                	push   %r15
+  802a64:	41 56                	push   %r14
+  802a66:	41 55                	push   %r13
+  802a68:	41 54                	push   %r12
+  802a6a:	53                   	push   %rbx
+  802a6b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a6f:	41 89 fd             	mov    %edi,%r13d
+  802a72:	49 89 f6             	mov    %rsi,%r14
+  802a75:	49 89 d7             	mov    %rdx,%r15
+  802a78:	48 89 cb             	mov    %rcx,%rbx
+  802a7b:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a7e:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802a85:	00 00 00 
+  802a88:	83 38 00             	cmpl   $0x0,(%rax)
+  802a8b:	74 52                	je     802adf <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802a8d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a93:	4c 89 f9             	mov    %r15,%rcx
+  802a96:	4c 89 f2             	mov    %r14,%rdx
+  802a99:	44 89 ee             	mov    %r13d,%esi
+  802a9c:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802aa3:	00 00 00 
+  802aa6:	8b 38                	mov    (%rax),%edi
+  802aa8:	48 b8 fc 45 80 00 00 	movabs $0x8045fc,%rax
+  802aaf:	00 00 00 
+  802ab2:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802ab4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ab9:	4c 89 e2             	mov    %r12,%rdx
+  802abc:	48 89 de             	mov    %rbx,%rsi
+  802abf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ac4:	48 b8 4c 44 80 00 00 	movabs $0x80444c,%rax
+  802acb:	00 00 00 
+  802ace:	ff d0                	call   *%rax
+}
+  802ad0:	48 83 c4 08          	add    $0x8,%rsp
+  802ad4:	5b                   	pop    %rbx
+  802ad5:	41 5c                	pop    %r12
+  802ad7:	41 5d                	pop    %r13
+  802ad9:	41 5e                	pop    %r14
+  802adb:	41 5f                	pop    %r15
+  802add:	5d                   	pop    %rbp
+  802ade:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802adf:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ae4:	48 b8 9f 46 80 00 00 	movabs $0x80469f,%rax
+  802aeb:	00 00 00 
+  802aee:	ff d0                	call   *%rax
+  802af0:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802af7:	00 00 
+  802af9:	eb 92                	jmp    802a8d <fsipc_region+0x2f>
+
+0000000000802afb <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802afb:	55                   	push   %rbp
+  802afc:	48 89 e5             	mov    %rsp,%rbp
+  802aff:	41 57                	push   %r15
+  802b01:	41 56                	push   %r14
+  802b03:	41 55                	push   %r13
+  802b05:	41 54                	push   %r12
+  802b07:	53                   	push   %rbx
+  802b08:	48 83 ec 28          	sub    $0x28,%rsp
+  802b0c:	49 89 ff             	mov    %rdi,%r15
+  802b0f:	49 89 f6             	mov    %rsi,%r14
+  802b12:	48 89 d3             	mov    %rdx,%rbx
+  802b15:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802b19:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802b1c:	48 b8 f8 29 80 00 00 	movabs $0x8029f8,%rax
+  802b23:	00 00 00 
+  802b26:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802b28:	48 85 c0             	test   %rax,%rax
+  802b2b:	0f 84 cc 00 00 00    	je     802bfd <devfile_write_direct+0x102>
+  802b31:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802b34:	48 85 db             	test   %rbx,%rbx
+  802b37:	0f 84 ba 00 00 00    	je     802bf7 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802b3d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b43:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802b4a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802b4e:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802b52:	4c 29 e3             	sub    %r12,%rbx
+  802b55:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802b5a:	48 39 c3             	cmp    %rax,%rbx
+  802b5d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802b61:	48 89 da             	mov    %rbx,%rdx
+  802b64:	4c 89 f6             	mov    %r14,%rsi
+  802b67:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802b6b:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  802b72:	00 00 00 
+  802b75:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802b77:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802b7b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802b7f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802b82:	44 01 e0             	add    %r12d,%eax
+  802b85:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802b89:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802b8d:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802b94:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802b9b:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802ba2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ba8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bad:	4c 89 ee             	mov    %r13,%rsi
+  802bb0:	bf 04 00 00 00       	mov    $0x4,%edi
+  802bb5:	48 b8 5e 2a 80 00 00 	movabs $0x802a5e,%rax
+  802bbc:	00 00 00 
+  802bbf:	ff d0                	call   *%rax
+        if (res < 0)
+  802bc1:	85 c0                	test   %eax,%eax
+  802bc3:	78 29                	js     802bee <devfile_write_direct+0xf3>
+        if (res == 0)
+  802bc5:	74 2b                	je     802bf2 <devfile_write_direct+0xf7>
+        i += res;
+  802bc7:	48 98                	cltq
+  802bc9:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802bcc:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802bcf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bd3:	49 39 c4             	cmp    %rax,%r12
+  802bd6:	0f 82 72 ff ff ff    	jb     802b4e <devfile_write_direct+0x53>
+    return i;
+  802bdc:	4c 89 e0             	mov    %r12,%rax
+}
+  802bdf:	48 83 c4 28          	add    $0x28,%rsp
+  802be3:	5b                   	pop    %rbx
+  802be4:	41 5c                	pop    %r12
+  802be6:	41 5d                	pop    %r13
+  802be8:	41 5e                	pop    %r14
+  802bea:	41 5f                	pop    %r15
+  802bec:	5d                   	pop    %rbp
+  802bed:	c3                   	ret
+            return res;
+  802bee:	48 98                	cltq
+  802bf0:	eb ed                	jmp    802bdf <devfile_write_direct+0xe4>
+            return i;
+  802bf2:	4c 89 e0             	mov    %r12,%rax
+  802bf5:	eb e8                	jmp    802bdf <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802bf7:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802bfb:	eb df                	jmp    802bdc <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802bfd:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802c04:	eb d9                	jmp    802bdf <devfile_write_direct+0xe4>
+
+0000000000802c06 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802c06:	55                   	push   %rbp
+  802c07:	48 89 e5             	mov    %rsp,%rbp
+  802c0a:	41 56                	push   %r14
+  802c0c:	41 55                	push   %r13
+  802c0e:	41 54                	push   %r12
+  802c10:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802c11:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802c15:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1e:	4d 39 ee             	cmp    %r13,%r14
+  802c21:	0f 84 99 00 00 00    	je     802cc0 <fbuf_flush+0xba>
+  802c27:	49 89 fc             	mov    %rdi,%r12
+  802c2a:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802c2d:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c30:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802c34:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802c3b:	00 00 00 
+  802c3e:	ff d0                	call   *%rax
+  802c40:	48 89 c2             	mov    %rax,%rdx
+  802c43:	48 c1 e2 04          	shl    $0x4,%rdx
+  802c47:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802c4b:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c4f:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802c54:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802c57:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802c5b:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802c62:	00 
+  802c63:	44 89 f1             	mov    %r14d,%ecx
+  802c66:	4c 89 ea             	mov    %r13,%rdx
+  802c69:	4c 89 e7             	mov    %r12,%rdi
+  802c6c:	48 b8 fb 2a 80 00 00 	movabs $0x802afb,%rax
+  802c73:	00 00 00 
+  802c76:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c78:	48 85 c0             	test   %rax,%rax
+  802c7b:	78 43                	js     802cc0 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802c7d:	4c 39 e8             	cmp    %r13,%rax
+  802c80:	72 47                	jb     802cc9 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802c82:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802c87:	83 c0 01             	add    $0x1,%eax
+  802c8a:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802c8f:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802c92:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802c96:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802c9a:	72 0f                	jb     802cab <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802c9c:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802ca0:	48 39 c2             	cmp    %rax,%rdx
+  802ca3:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802ca7:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802cab:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802cb2:	00 
+  802cb3:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802cba:	00 
+    return 0;
+  802cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cc0:	5b                   	pop    %rbx
+  802cc1:	41 5c                	pop    %r12
+  802cc3:	41 5d                	pop    %r13
+  802cc5:	41 5e                	pop    %r14
+  802cc7:	5d                   	pop    %rbp
+  802cc8:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802cc9:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802cce:	eb f0                	jmp    802cc0 <fbuf_flush+0xba>
+
+0000000000802cd0 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802cd0:	55                   	push   %rbp
+  802cd1:	48 89 e5             	mov    %rsp,%rbp
+  802cd4:	53                   	push   %rbx
+  802cd5:	48 83 ec 08          	sub    $0x8,%rsp
+  802cd9:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802cdc:	48 b8 de 28 80 00 00 	movabs $0x8028de,%rax
+  802ce3:	00 00 00 
+  802ce6:	ff d0                	call   *%rax
+  802ce8:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf0:	48 85 f6             	test   %rsi,%rsi
+  802cf3:	74 0f                	je     802d04 <devfile_sync+0x34>
+  802cf5:	48 89 df             	mov    %rbx,%rdi
+  802cf8:	48 b8 06 2c 80 00 00 	movabs $0x802c06,%rax
+  802cff:	00 00 00 
+  802d02:	ff d0                	call   *%rax
+}
+  802d04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d08:	c9                   	leave
+  802d09:	c3                   	ret
+
+0000000000802d0a <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802d0a:	55                   	push   %rbp
+  802d0b:	48 89 e5             	mov    %rsp,%rbp
+  802d0e:	48 83 ec 10          	sub    $0x10,%rsp
+  802d12:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802d15:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802d1c:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802d1d:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802d21:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d26:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802d2d:	00 00 00 
+  802d30:	48 b8 5e 2a 80 00 00 	movabs $0x802a5e,%rax
+  802d37:	00 00 00 
+  802d3a:	ff d0                	call   *%rax
+}
+  802d3c:	c9                   	leave
+  802d3d:	c3                   	ret
+
+0000000000802d3e <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d3e:	55                   	push   %rbp
+  802d3f:	48 89 e5             	mov    %rsp,%rbp
+  802d42:	41 54                	push   %r12
+  802d44:	53                   	push   %rbx
+  802d45:	48 89 fb             	mov    %rdi,%rbx
+  802d48:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802d4b:	48 b8 d0 2c 80 00 00 	movabs $0x802cd0,%rax
+  802d52:	00 00 00 
+  802d55:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	78 63                	js     802dbe <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d5b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d5e:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802d65:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802d67:	be 00 00 00 00       	mov    $0x0,%esi
+  802d6c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d71:	48 b8 0a 2d 80 00 00 	movabs $0x802d0a,%rax
+  802d78:	00 00 00 
+  802d7b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d7d:	85 c0                	test   %eax,%eax
+  802d7f:	78 3d                	js     802dbe <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802d81:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802d88:	00 00 00 
+  802d8b:	48 89 de             	mov    %rbx,%rsi
+  802d8e:	4c 89 e7             	mov    %r12,%rdi
+  802d91:	48 b8 86 0e 80 00 00 	movabs $0x800e86,%rax
+  802d98:	00 00 00 
+  802d9b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802d9d:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802da3:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802daa:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802dab:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802db1:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802db8:	00 
+
+    return 0;
+  802db9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dbe:	5b                   	pop    %rbx
+  802dbf:	41 5c                	pop    %r12
+  802dc1:	5d                   	pop    %rbp
+  802dc2:	c3                   	ret
+
+0000000000802dc3 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802dc3:	55                   	push   %rbp
+  802dc4:	48 89 e5             	mov    %rsp,%rbp
+  802dc7:	41 54                	push   %r12
+  802dc9:	53                   	push   %rbx
+  802dca:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802dcd:	48 b8 d0 2c 80 00 00 	movabs $0x802cd0,%rax
+  802dd4:	00 00 00 
+  802dd7:	ff d0                	call   *%rax
+  802dd9:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802ddc:	48 89 df             	mov    %rbx,%rdi
+  802ddf:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802de6:	00 00 00 
+  802de9:	ff d0                	call   *%rax
+  802deb:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802def:	76 2e                	jbe    802e1f <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802df1:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802df4:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802dfb:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802dfd:	be 00 00 00 00       	mov    $0x0,%esi
+  802e02:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802e07:	48 b8 0a 2d 80 00 00 	movabs $0x802d0a,%rax
+  802e0e:	00 00 00 
+  802e11:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802e13:	45 85 e4             	test   %r12d,%r12d
+  802e16:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802e1a:	5b                   	pop    %rbx
+  802e1b:	41 5c                	pop    %r12
+  802e1d:	5d                   	pop    %rbp
+  802e1e:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802e1f:	48 89 df             	mov    %rbx,%rdi
+  802e22:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  802e29:	00 00 00 
+  802e2c:	ff d0                	call   *%rax
+  802e2e:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802e32:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802e39:	00 00 00 
+  802e3c:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802e43:	48 89 df             	mov    %rbx,%rdi
+  802e46:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  802e4d:	00 00 00 
+  802e50:	ff d0                	call   *%rax
+  802e52:	48 89 c6             	mov    %rax,%rsi
+  802e55:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5f:	48 b8 c5 17 80 00 00 	movabs $0x8017c5,%rax
+  802e66:	00 00 00 
+  802e69:	ff d0                	call   *%rax
+  802e6b:	eb 84                	jmp    802df1 <devfile_flush+0x2e>
+
+0000000000802e6d <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e6d:	55                   	push   %rbp
+  802e6e:	48 89 e5             	mov    %rsp,%rbp
+  802e71:	41 55                	push   %r13
+  802e73:	41 54                	push   %r12
+  802e75:	53                   	push   %rbx
+  802e76:	48 83 ec 08          	sub    $0x8,%rsp
+  802e7a:	48 89 fb             	mov    %rdi,%rbx
+  802e7d:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802e80:	48 b8 de 28 80 00 00 	movabs $0x8028de,%rax
+  802e87:	00 00 00 
+  802e8a:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802e8c:	48 85 c0             	test   %rax,%rax
+  802e8f:	74 51                	je     802ee2 <devfile_trunc+0x75>
+  802e91:	49 89 c4             	mov    %rax,%r12
+  802e94:	48 89 c6             	mov    %rax,%rsi
+  802e97:	48 89 df             	mov    %rbx,%rdi
+  802e9a:	48 b8 06 2c 80 00 00 	movabs $0x802c06,%rax
+  802ea1:	00 00 00 
+  802ea4:	ff d0                	call   *%rax
+  802ea6:	85 c0                	test   %eax,%eax
+  802ea8:	78 2d                	js     802ed7 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802eaa:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802eb1:	00 00 00 
+  802eb4:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802eb7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802eb9:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ebd:	be 00 00 00 00       	mov    $0x0,%esi
+  802ec2:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ec7:	48 b8 0a 2d 80 00 00 	movabs $0x802d0a,%rax
+  802ece:	00 00 00 
+  802ed1:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802ed3:	85 c0                	test   %eax,%eax
+  802ed5:	79 3e                	jns    802f15 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802ed7:	48 83 c4 08          	add    $0x8,%rsp
+  802edb:	5b                   	pop    %rbx
+  802edc:	41 5c                	pop    %r12
+  802ede:	41 5d                	pop    %r13
+  802ee0:	5d                   	pop    %rbp
+  802ee1:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802ee2:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802ee9:	00 00 00 
+  802eec:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802eef:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802ef1:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802ef5:	be 00 00 00 00       	mov    $0x0,%esi
+  802efa:	bf 02 00 00 00       	mov    $0x2,%edi
+  802eff:	48 b8 0a 2d 80 00 00 	movabs $0x802d0a,%rax
+  802f06:	00 00 00 
+  802f09:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802f0b:	85 c0                	test   %eax,%eax
+  802f0d:	78 c8                	js     802ed7 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f0f:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f13:	eb c2                	jmp    802ed7 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802f15:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802f18:	8d 51 01             	lea    0x1(%rcx),%edx
+  802f1b:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f1e:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  802f23:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  802f2a:	00 00 
+  802f2c:	eb a9                	jmp    802ed7 <devfile_trunc+0x6a>
+
+0000000000802f2e <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802f2e:	55                   	push   %rbp
+  802f2f:	48 89 e5             	mov    %rsp,%rbp
+  802f32:	41 57                	push   %r15
+  802f34:	41 56                	push   %r14
+  802f36:	41 55                	push   %r13
+  802f38:	41 54                	push   %r12
+  802f3a:	53                   	push   %rbx
+  802f3b:	48 83 ec 28          	sub    $0x28,%rsp
+  802f3f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802f43:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802f47:	49 89 d7             	mov    %rdx,%r15
+  802f4a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  802f4e:	48 b8 de 28 80 00 00 	movabs $0x8028de,%rax
+  802f55:	00 00 00 
+  802f58:	ff d0                	call   *%rax
+  802f5a:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  802f5d:	48 85 c0             	test   %rax,%rax
+  802f60:	74 31                	je     802f93 <devfile_write+0x65>
+  802f62:	4c 89 f8             	mov    %r15,%rax
+  802f65:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  802f6c:	77 25                	ja     802f93 <devfile_write+0x65>
+    size_t i = 0;
+  802f6e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  802f74:	48 85 c0             	test   %rax,%rax
+  802f77:	0f 85 64 01 00 00    	jne    8030e1 <devfile_write+0x1b3>
+    size_t i = 0;
+  802f7d:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  802f81:	4c 89 f8             	mov    %r15,%rax
+}
+  802f84:	48 83 c4 28          	add    $0x28,%rsp
+  802f88:	5b                   	pop    %rbx
+  802f89:	41 5c                	pop    %r12
+  802f8b:	41 5d                	pop    %r13
+  802f8d:	41 5e                	pop    %r14
+  802f8f:	41 5f                	pop    %r15
+  802f91:	5d                   	pop    %rbp
+  802f92:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f93:	48 85 db             	test   %rbx,%rbx
+  802f96:	74 5b                	je     802ff3 <devfile_write+0xc5>
+  802f98:	48 89 de             	mov    %rbx,%rsi
+  802f9b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802f9f:	48 b8 06 2c 80 00 00 	movabs $0x802c06,%rax
+  802fa6:	00 00 00 
+  802fa9:	ff d0                	call   *%rax
+  802fab:	85 c0                	test   %eax,%eax
+  802fad:	78 40                	js     802fef <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802faf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fb3:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  802fb6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fba:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  802fbe:	48 b8 fb 2a 80 00 00 	movabs $0x802afb,%rax
+  802fc5:	00 00 00 
+  802fc8:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  802fca:	48 85 c0             	test   %rax,%rax
+  802fcd:	7e b5                	jle    802f84 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  802fcf:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802fd3:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  802fd6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  802fd9:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  802fdc:	8d 51 01             	lea    0x1(%rcx),%edx
+  802fdf:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802fe2:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  802fe5:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802fec:	00 
+  802fed:	eb 95                	jmp    802f84 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802fef:	48 98                	cltq
+  802ff1:	eb 91                	jmp    802f84 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  802ff3:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802ff7:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  802ffa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ffe:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803002:	48 89 df             	mov    %rbx,%rdi
+  803005:	48 b8 fb 2a 80 00 00 	movabs $0x802afb,%rax
+  80300c:	00 00 00 
+  80300f:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803011:	48 85 c0             	test   %rax,%rax
+  803014:	0f 8e 6a ff ff ff    	jle    802f84 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80301a:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  80301d:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803021:	e9 5e ff ff ff       	jmp    802f84 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803026:	48 98                	cltq
+  803028:	4d 85 ff             	test   %r15,%r15
+  80302b:	49 0f 45 c7          	cmovne %r15,%rax
+  80302f:	e9 50 ff ff ff       	jmp    802f84 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803034:	48 89 de             	mov    %rbx,%rsi
+  803037:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80303b:	48 b8 06 2c 80 00 00 	movabs $0x802c06,%rax
+  803042:	00 00 00 
+  803045:	ff d0                	call   *%rax
+  803047:	85 c0                	test   %eax,%eax
+  803049:	0f 88 2b 01 00 00    	js     80317a <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80304f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803053:	4c 01 f8             	add    %r15,%rax
+  803056:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80305a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80305e:	48 b9 0a 21 80 00 00 	movabs $0x80210a,%rcx
+  803065:	00 00 00 
+  803068:	ff d1                	call   *%rcx
+  80306a:	48 89 c2             	mov    %rax,%rdx
+  80306d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803071:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803075:	48 c1 e0 0c          	shl    $0xc,%rax
+  803079:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  80307e:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803081:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803088:	00 
+  803089:	4c 89 ea             	mov    %r13,%rdx
+  80308c:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803090:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  803097:	00 00 00 
+  80309a:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  80309c:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8030a0:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8030a4:	48 39 c2             	cmp    %rax,%rdx
+  8030a7:	0f 84 db 00 00 00    	je     803188 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  8030ad:	4c 39 e2             	cmp    %r12,%rdx
+  8030b0:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  8030b4:	4d 01 ec             	add    %r13,%r12
+  8030b7:	49 39 c4             	cmp    %rax,%r12
+  8030ba:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  8030be:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  8030c2:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  8030c6:	45 01 ee             	add    %r13d,%r14d
+  8030c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030cd:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  8030d1:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  8030d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030d8:	49 39 c7             	cmp    %rax,%r15
+  8030db:	0f 83 a0 fe ff ff    	jae    802f81 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  8030e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030e5:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  8030e9:	8b 43 08             	mov    0x8(%rbx),%eax
+  8030ec:	44 39 f0             	cmp    %r14d,%eax
+  8030ef:	7f 10                	jg     803101 <devfile_write+0x1d3>
+  8030f1:	48 98                	cltq
+  8030f3:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  8030f9:	49 63 d6             	movslq %r14d,%rdx
+  8030fc:	48 39 d0             	cmp    %rdx,%rax
+  8030ff:	7d 2d                	jge    80312e <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803101:	48 89 de             	mov    %rbx,%rsi
+  803104:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803108:	48 b8 06 2c 80 00 00 	movabs $0x802c06,%rax
+  80310f:	00 00 00 
+  803112:	ff d0                	call   *%rax
+  803114:	85 c0                	test   %eax,%eax
+  803116:	0f 88 0a ff ff ff    	js     803026 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80311c:	44 89 f0             	mov    %r14d,%eax
+  80311f:	66 b8 00 00          	mov    $0x0,%ax
+  803123:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803126:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80312d:	00 
+        size_t off = pos - fb->fb_base;
+  80312e:	45 89 f4             	mov    %r14d,%r12d
+  803131:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803135:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803138:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  80313c:	4d 29 fd             	sub    %r15,%r13
+  80313f:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803144:	4c 29 e0             	sub    %r12,%rax
+  803147:	49 39 c5             	cmp    %rax,%r13
+  80314a:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  80314e:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803152:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803156:	48 39 c2             	cmp    %rax,%rdx
+  803159:	0f 84 f0 fe ff ff    	je     80304f <devfile_write+0x121>
+  80315f:	4c 39 e0             	cmp    %r12,%rax
+  803162:	0f 82 cc fe ff ff    	jb     803034 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803168:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80316c:	48 39 d0             	cmp    %rdx,%rax
+  80316f:	0f 83 da fe ff ff    	jae    80304f <devfile_write+0x121>
+  803175:	e9 ba fe ff ff       	jmp    803034 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80317a:	48 98                	cltq
+  80317c:	4d 85 ff             	test   %r15,%r15
+  80317f:	49 0f 45 c7          	cmovne %r15,%rax
+  803183:	e9 fc fd ff ff       	jmp    802f84 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803188:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80318c:	4c 89 e2             	mov    %r12,%rdx
+  80318f:	e9 2a ff ff ff       	jmp    8030be <devfile_write+0x190>
+
+0000000000803194 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803194:	55                   	push   %rbp
+  803195:	48 89 e5             	mov    %rsp,%rbp
+  803198:	41 57                	push   %r15
+  80319a:	41 56                	push   %r14
+  80319c:	41 55                	push   %r13
+  80319e:	41 54                	push   %r12
+  8031a0:	53                   	push   %rbx
+  8031a1:	48 83 ec 28          	sub    $0x28,%rsp
+  8031a5:	49 89 ff             	mov    %rdi,%r15
+  8031a8:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8031ac:	48 89 d3             	mov    %rdx,%rbx
+  8031af:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8031b3:	48 b8 de 28 80 00 00 	movabs $0x8028de,%rax
+  8031ba:	00 00 00 
+  8031bd:	ff d0                	call   *%rax
+  8031bf:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8031c2:	48 85 c0             	test   %rax,%rax
+  8031c5:	74 0d                	je     8031d4 <devfile_read+0x40>
+  8031c7:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8031ce:	0f 86 1a 01 00 00    	jbe    8032ee <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8031d4:	4d 85 e4             	test   %r12,%r12
+  8031d7:	74 1a                	je     8031f3 <devfile_read+0x5f>
+  8031d9:	4c 89 e6             	mov    %r12,%rsi
+  8031dc:	4c 89 ff             	mov    %r15,%rdi
+  8031df:	48 b8 06 2c 80 00 00 	movabs $0x802c06,%rax
+  8031e6:	00 00 00 
+  8031e9:	ff d0                	call   *%rax
+  8031eb:	85 c0                	test   %eax,%eax
+  8031ed:	0f 88 e8 00 00 00    	js     8032db <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8031f3:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8031f7:	48 b8 f8 29 80 00 00 	movabs $0x8029f8,%rax
+  8031fe:	00 00 00 
+  803201:	ff d0                	call   *%rax
+  803203:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803206:	48 85 c0             	test   %rax,%rax
+  803209:	0f 84 69 02 00 00    	je     803478 <devfile_read+0x2e4>
+    while (i < n) {
+  80320f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803214:	0f 84 ce 00 00 00    	je     8032e8 <devfile_read+0x154>
+    size_t i = 0;
+  80321a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80321f:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803226:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80322a:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80322e:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803232:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803236:	48 29 da             	sub    %rbx,%rdx
+  803239:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80323e:	48 39 c2             	cmp    %rax,%rdx
+  803241:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803245:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803249:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  80324d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803250:	01 d8                	add    %ebx,%eax
+  803252:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803256:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  80325a:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803261:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803268:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80326f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803275:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80327a:	4c 89 ee             	mov    %r13,%rsi
+  80327d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803282:	48 b8 5e 2a 80 00 00 	movabs $0x802a5e,%rax
+  803289:	00 00 00 
+  80328c:	ff d0                	call   *%rax
+        if (res < 0)
+  80328e:	85 c0                	test   %eax,%eax
+  803290:	78 4d                	js     8032df <devfile_read+0x14b>
+        if (res == 0)
+  803292:	74 4f                	je     8032e3 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803294:	4c 63 e0             	movslq %eax,%r12
+  803297:	4c 89 e2             	mov    %r12,%rdx
+  80329a:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80329e:	4c 89 f7             	mov    %r14,%rdi
+  8032a1:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  8032a8:	00 00 00 
+  8032ab:	ff d0                	call   *%rax
+        i += res;
+  8032ad:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8032b0:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8032b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032b7:	48 39 c3             	cmp    %rax,%rbx
+  8032ba:	0f 82 72 ff ff ff    	jb     803232 <devfile_read+0x9e>
+    return i;
+  8032c0:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8032c3:	48 85 c0             	test   %rax,%rax
+  8032c6:	7e 04                	jle    8032cc <devfile_read+0x138>
+  8032c8:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8032cc:	48 83 c4 28          	add    $0x28,%rsp
+  8032d0:	5b                   	pop    %rbx
+  8032d1:	41 5c                	pop    %r12
+  8032d3:	41 5d                	pop    %r13
+  8032d5:	41 5e                	pop    %r14
+  8032d7:	41 5f                	pop    %r15
+  8032d9:	5d                   	pop    %rbp
+  8032da:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8032db:	48 98                	cltq
+  8032dd:	eb ed                	jmp    8032cc <devfile_read+0x138>
+            return res;
+  8032df:	48 98                	cltq
+  8032e1:	eb e9                	jmp    8032cc <devfile_read+0x138>
+            return i;
+  8032e3:	48 89 d8             	mov    %rbx,%rax
+  8032e6:	eb db                	jmp    8032c3 <devfile_read+0x12f>
+    size_t i = 0;
+  8032e8:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8032ec:	eb d2                	jmp    8032c0 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8032ee:	48 89 c6             	mov    %rax,%rsi
+  8032f1:	4c 89 ff             	mov    %r15,%rdi
+  8032f4:	48 b8 06 2c 80 00 00 	movabs $0x802c06,%rax
+  8032fb:	00 00 00 
+  8032fe:	ff d0                	call   *%rax
+  803300:	85 c0                	test   %eax,%eax
+  803302:	78 40                	js     803344 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803304:	4c 89 ff             	mov    %r15,%rdi
+  803307:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  80330e:	00 00 00 
+  803311:	ff d0                	call   *%rax
+  803313:	48 89 c2             	mov    %rax,%rdx
+  803316:	48 c1 e2 04          	shl    $0x4,%rdx
+  80331a:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80331e:	48 c1 e0 0c          	shl    $0xc,%rax
+  803322:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803327:	48 01 d0             	add    %rdx,%rax
+  80332a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80332e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803333:	0f 84 33 01 00 00    	je     80346c <devfile_read+0x2d8>
+    size_t i = 0;
+  803339:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80333f:	e9 f5 00 00 00       	jmp    803439 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803344:	48 98                	cltq
+  803346:	eb 84                	jmp    8032cc <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803348:	44 89 e8             	mov    %r13d,%eax
+  80334b:	66 b8 00 00          	mov    $0x0,%ax
+  80334f:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803354:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80335b:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  80335d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803361:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803365:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803367:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80336c:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80336f:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803376:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803377:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80337d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803382:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803387:	bf 03 00 00 00       	mov    $0x3,%edi
+  80338c:	48 b8 5e 2a 80 00 00 	movabs $0x802a5e,%rax
+  803393:	00 00 00 
+  803396:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803398:	85 c0                	test   %eax,%eax
+  80339a:	0f 88 be 00 00 00    	js     80345e <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8033a0:	48 63 d0             	movslq %eax,%rdx
+  8033a3:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8033a8:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8033ad:	44 39 e8             	cmp    %r13d,%eax
+  8033b0:	0f 8e ba 00 00 00    	jle    803470 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8033b6:	49 63 c5             	movslq %r13d,%rax
+  8033b9:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8033be:	48 29 c3             	sub    %rax,%rbx
+  8033c1:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8033c6:	48 01 c3             	add    %rax,%rbx
+  8033c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033cd:	4c 29 f0             	sub    %r14,%rax
+  8033d0:	48 39 c3             	cmp    %rax,%rbx
+  8033d3:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8033d7:	4c 89 ff             	mov    %r15,%rdi
+  8033da:	48 b9 0a 21 80 00 00 	movabs $0x80210a,%rcx
+  8033e1:	00 00 00 
+  8033e4:	ff d1                	call   *%rcx
+  8033e6:	48 89 c2             	mov    %rax,%rdx
+  8033e9:	48 c1 e2 04          	shl    $0x4,%rdx
+  8033ed:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8033f1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8033f5:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8033fa:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8033fd:	44 89 ea             	mov    %r13d,%edx
+  803400:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803405:	48 63 d2             	movslq %edx,%rdx
+  803408:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80340f:	00 
+  803410:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803414:	4c 01 f7             	add    %r14,%rdi
+  803417:	48 89 da             	mov    %rbx,%rdx
+  80341a:	48 b9 7b 12 80 00 00 	movabs $0x80127b,%rcx
+  803421:	00 00 00 
+  803424:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803426:	41 01 dd             	add    %ebx,%r13d
+  803429:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  80342d:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803430:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803434:	49 39 c6             	cmp    %rax,%r14
+  803437:	73 37                	jae    803470 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803439:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  80343d:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803442:	44 39 e8             	cmp    %r13d,%eax
+  803445:	0f 8f fd fe ff ff    	jg     803348 <devfile_read+0x1b4>
+  80344b:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803450:	44 39 e8             	cmp    %r13d,%eax
+  803453:	0f 8f 5d ff ff ff    	jg     8033b6 <devfile_read+0x222>
+  803459:	e9 ea fe ff ff       	jmp    803348 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80345e:	48 98                	cltq
+  803460:	4d 85 f6             	test   %r14,%r14
+  803463:	49 0f 45 c6          	cmovne %r14,%rax
+  803467:	e9 60 fe ff ff       	jmp    8032cc <devfile_read+0x138>
+    size_t i = 0;
+  80346c:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803470:	4c 89 f0             	mov    %r14,%rax
+  803473:	e9 54 fe ff ff       	jmp    8032cc <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803478:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80347f:	e9 48 fe ff ff       	jmp    8032cc <devfile_read+0x138>
+
+0000000000803484 <open>:
+open(const char *path, int mode) {
+  803484:	55                   	push   %rbp
+  803485:	48 89 e5             	mov    %rsp,%rbp
+  803488:	41 55                	push   %r13
+  80348a:	41 54                	push   %r12
+  80348c:	53                   	push   %rbx
+  80348d:	48 83 ec 18          	sub    $0x18,%rsp
+  803491:	49 89 fc             	mov    %rdi,%r12
+  803494:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803497:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  80349e:	00 00 00 
+  8034a1:	ff d0                	call   *%rax
+  8034a3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8034a9:	0f 87 8a 00 00 00    	ja     803539 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8034af:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8034b3:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  8034ba:	00 00 00 
+  8034bd:	ff d0                	call   *%rax
+  8034bf:	89 c3                	mov    %eax,%ebx
+  8034c1:	85 c0                	test   %eax,%eax
+  8034c3:	78 50                	js     803515 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8034c5:	4c 89 e6             	mov    %r12,%rsi
+  8034c8:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8034cf:	00 00 00 
+  8034d2:	48 89 df             	mov    %rbx,%rdi
+  8034d5:	48 b8 86 0e 80 00 00 	movabs $0x800e86,%rax
+  8034dc:	00 00 00 
+  8034df:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8034e1:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8034e8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8034ec:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034f1:	48 b8 0a 2d 80 00 00 	movabs $0x802d0a,%rax
+  8034f8:	00 00 00 
+  8034fb:	ff d0                	call   *%rax
+  8034fd:	89 c3                	mov    %eax,%ebx
+  8034ff:	85 c0                	test   %eax,%eax
+  803501:	78 1f                	js     803522 <open+0x9e>
+    return fd2num(fd);
+  803503:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803507:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  80350e:	00 00 00 
+  803511:	ff d0                	call   *%rax
+  803513:	89 c3                	mov    %eax,%ebx
+}
+  803515:	89 d8                	mov    %ebx,%eax
+  803517:	48 83 c4 18          	add    $0x18,%rsp
+  80351b:	5b                   	pop    %rbx
+  80351c:	41 5c                	pop    %r12
+  80351e:	41 5d                	pop    %r13
+  803520:	5d                   	pop    %rbp
+  803521:	c3                   	ret
+        fd_close(fd, 0);
+  803522:	be 00 00 00 00       	mov    $0x0,%esi
+  803527:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80352b:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  803532:	00 00 00 
+  803535:	ff d0                	call   *%rax
+        return res;
+  803537:	eb dc                	jmp    803515 <open+0x91>
+        return -E_BAD_PATH;
+  803539:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80353e:	eb d5                	jmp    803515 <open+0x91>
+
+0000000000803540 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803540:	55                   	push   %rbp
+  803541:	48 89 e5             	mov    %rsp,%rbp
+  803544:	41 57                	push   %r15
+  803546:	41 56                	push   %r14
+  803548:	41 55                	push   %r13
+  80354a:	41 54                	push   %r12
+  80354c:	53                   	push   %rbx
+  80354d:	48 83 ec 18          	sub    $0x18,%rsp
+  803551:	41 89 f6             	mov    %esi,%r14d
+  803554:	49 89 d7             	mov    %rdx,%r15
+  803557:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80355a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80355e:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  803565:	00 00 00 
+  803568:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80356a:	85 c0                	test   %eax,%eax
+  80356c:	0f 88 db 00 00 00    	js     80364d <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803572:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803576:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80357d:	00 00 00 
+  803580:	8b 00                	mov    (%rax),%eax
+  803582:	39 07                	cmp    %eax,(%rdi)
+  803584:	0f 85 db 00 00 00    	jne    803665 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80358a:	45 85 f6             	test   %r14d,%r14d
+  80358d:	0f 88 db 00 00 00    	js     80366e <fmap+0x12e>
+  803593:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  80359a:	0f 85 d7 00 00 00    	jne    803677 <fmap+0x137>
+  8035a0:	4c 89 fb             	mov    %r15,%rbx
+  8035a3:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8035a9:	0f 85 d1 00 00 00    	jne    803680 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8035af:	48 b8 d0 2c 80 00 00 	movabs $0x802cd0,%rax
+  8035b6:	00 00 00 
+  8035b9:	ff d0                	call   *%rax
+  8035bb:	85 c0                	test   %eax,%eax
+  8035bd:	0f 88 8e 00 00 00    	js     803651 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8035c3:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8035ca:	00 00 00 
+    while (i < n) {
+  8035cd:	4d 85 ed             	test   %r13,%r13
+  8035d0:	0f 84 8a 00 00 00    	je     803660 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8035d6:	4c 89 ea             	mov    %r13,%rdx
+  8035d9:	48 29 da             	sub    %rbx,%rdx
+  8035dc:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8035e3:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8035e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8035ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035f1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035f4:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8035f8:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8035fc:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803601:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803606:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  80360a:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80360e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803613:	4c 89 e6             	mov    %r12,%rsi
+  803616:	bf 09 00 00 00       	mov    $0x9,%edi
+  80361b:	48 b8 5e 2a 80 00 00 	movabs $0x802a5e,%rax
+  803622:	00 00 00 
+  803625:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803627:	85 c0                	test   %eax,%eax
+  803629:	78 2a                	js     803655 <fmap+0x115>
+        i += res;
+  80362b:	48 98                	cltq
+  80362d:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803630:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803634:	72 05                	jb     80363b <fmap+0xfb>
+    while (i < n) {
+  803636:	4c 39 eb             	cmp    %r13,%rbx
+  803639:	72 9b                	jb     8035d6 <fmap+0x96>
+    }
+    return i;
+  80363b:	48 89 d8             	mov    %rbx,%rax
+}
+  80363e:	48 83 c4 18          	add    $0x18,%rsp
+  803642:	5b                   	pop    %rbx
+  803643:	41 5c                	pop    %r12
+  803645:	41 5d                	pop    %r13
+  803647:	41 5e                	pop    %r14
+  803649:	41 5f                	pop    %r15
+  80364b:	5d                   	pop    %rbp
+  80364c:	c3                   	ret
+    if (res < 0) return res;
+  80364d:	48 98                	cltq
+  80364f:	eb ed                	jmp    80363e <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803651:	48 98                	cltq
+  803653:	eb e9                	jmp    80363e <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803655:	48 98                	cltq
+  803657:	48 85 db             	test   %rbx,%rbx
+  80365a:	48 0f 45 c3          	cmovne %rbx,%rax
+  80365e:	eb de                	jmp    80363e <fmap+0xfe>
+    size_t i = 0;
+  803660:	4c 89 eb             	mov    %r13,%rbx
+  803663:	eb d6                	jmp    80363b <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803665:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80366c:	eb d0                	jmp    80363e <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80366e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803675:	eb c7                	jmp    80363e <fmap+0xfe>
+  803677:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80367e:	eb be                	jmp    80363e <fmap+0xfe>
+  803680:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803687:	eb b5                	jmp    80363e <fmap+0xfe>
+
+0000000000803689 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803689:	55                   	push   %rbp
+  80368a:	48 89 e5             	mov    %rsp,%rbp
+  80368d:	41 56                	push   %r14
+  80368f:	41 55                	push   %r13
+  803691:	41 54                	push   %r12
+  803693:	53                   	push   %rbx
+  803694:	48 83 ec 10          	sub    $0x10,%rsp
+  803698:	89 fb                	mov    %edi,%ebx
+  80369a:	41 89 f4             	mov    %esi,%r12d
+  80369d:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8036a0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036a4:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  8036ab:	00 00 00 
+  8036ae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036b0:	85 c0                	test   %eax,%eax
+  8036b2:	78 63                	js     803717 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8036b4:	45 85 e4             	test   %r12d,%r12d
+  8036b7:	0f 88 80 00 00 00    	js     80373d <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8036bd:	45 89 e6             	mov    %r12d,%r14d
+  8036c0:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8036c7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036cb:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  8036d2:	00 00 00 
+  8036d5:	ff d0                	call   *%rax
+  8036d7:	48 89 c2             	mov    %rax,%rdx
+  8036da:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036df:	44 89 f6             	mov    %r14d,%esi
+  8036e2:	89 df                	mov    %ebx,%edi
+  8036e4:	48 b8 40 35 80 00 00 	movabs $0x803540,%rax
+  8036eb:	00 00 00 
+  8036ee:	ff d0                	call   *%rax
+  8036f0:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8036f3:	45 29 f4             	sub    %r14d,%r12d
+  8036f6:	4d 63 f4             	movslq %r12d,%r14
+  8036f9:	49 39 c6             	cmp    %rax,%r14
+  8036fc:	7c 1d                	jl     80371b <read_map+0x92>
+  8036fe:	48 85 c0             	test   %rax,%rax
+  803701:	b8 00 00 00 00       	mov    $0x0,%eax
+  803706:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  80370a:	48 83 c4 10          	add    $0x10,%rsp
+  80370e:	5b                   	pop    %rbx
+  80370f:	41 5c                	pop    %r12
+  803711:	41 5d                	pop    %r13
+  803713:	41 5e                	pop    %r14
+  803715:	5d                   	pop    %rbp
+  803716:	c3                   	ret
+    if (res < 0) return res;
+  803717:	48 98                	cltq
+  803719:	eb ef                	jmp    80370a <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  80371b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80371f:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  803726:	00 00 00 
+  803729:	ff d0                	call   *%rax
+  80372b:	4d 63 e4             	movslq %r12d,%r12
+  80372e:	4c 01 e0             	add    %r12,%rax
+  803731:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803735:	48 89 d8             	mov    %rbx,%rax
+  803738:	4c 29 f0             	sub    %r14,%rax
+  80373b:	eb cd                	jmp    80370a <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  80373d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803744:	eb c4                	jmp    80370a <read_map+0x81>
+
+0000000000803746 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803746:	55                   	push   %rbp
+  803747:	48 89 e5             	mov    %rsp,%rbp
+  80374a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80374e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803752:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  803759:	00 00 00 
+  80375c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80375e:	85 c0                	test   %eax,%eax
+  803760:	78 4a                	js     8037ac <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803762:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803766:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80376d:	00 00 00 
+  803770:	8b 00                	mov    (%rax),%eax
+  803772:	39 07                	cmp    %eax,(%rdi)
+  803774:	75 38                	jne    8037ae <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803776:	48 b8 d0 2c 80 00 00 	movabs $0x802cd0,%rax
+  80377d:	00 00 00 
+  803780:	ff d0                	call   *%rax
+  803782:	85 c0                	test   %eax,%eax
+  803784:	78 26                	js     8037ac <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80378a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80378d:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803794:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803796:	be 00 00 00 00       	mov    $0x0,%esi
+  80379b:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037a0:	48 b8 0a 2d 80 00 00 	movabs $0x802d0a,%rax
+  8037a7:	00 00 00 
+  8037aa:	ff d0                	call   *%rax
+}
+  8037ac:	c9                   	leave
+  8037ad:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8037ae:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8037b3:	eb f7                	jmp    8037ac <fsync+0x66>
+
+00000000008037b5 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  8037b5:	55                   	push   %rbp
+  8037b6:	48 89 e5             	mov    %rsp,%rbp
+  8037b9:	41 57                	push   %r15
+  8037bb:	41 56                	push   %r14
+  8037bd:	41 55                	push   %r13
+  8037bf:	41 54                	push   %r12
+  8037c1:	53                   	push   %rbx
+  8037c2:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8037c6:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8037cd:	00 00 00 
+  8037d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8037d5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8037db:	49 bd 98 21 80 00 00 	movabs $0x802198,%r13
+  8037e2:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8037e5:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8037ec:	00 00 00 
+  8037ef:	eb 0c                	jmp    8037fd <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8037f1:	83 c3 01             	add    $0x1,%ebx
+  8037f4:	49 83 c4 28          	add    $0x28,%r12
+  8037f8:	83 fb 20             	cmp    $0x20,%ebx
+  8037fb:	74 33                	je     803830 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8037fd:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803802:	74 ed                	je     8037f1 <flushall+0x3c>
+  803804:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803808:	89 df                	mov    %ebx,%edi
+  80380a:	41 ff d5             	call   *%r13
+  80380d:	85 c0                	test   %eax,%eax
+  80380f:	78 e0                	js     8037f1 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803811:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803815:	41 8b 06             	mov    (%r14),%eax
+  803818:	39 07                	cmp    %eax,(%rdi)
+  80381a:	75 d5                	jne    8037f1 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  80381c:	48 b8 d0 2c 80 00 00 	movabs $0x802cd0,%rax
+  803823:	00 00 00 
+  803826:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803828:	85 c0                	test   %eax,%eax
+  80382a:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80382e:	eb c1                	jmp    8037f1 <flushall+0x3c>
+    }
+    return res;
+}
+  803830:	44 89 f8             	mov    %r15d,%eax
+  803833:	48 83 c4 18          	add    $0x18,%rsp
+  803837:	5b                   	pop    %rbx
+  803838:	41 5c                	pop    %r12
+  80383a:	41 5d                	pop    %r13
+  80383c:	41 5e                	pop    %r14
+  80383e:	41 5f                	pop    %r15
+  803840:	5d                   	pop    %rbp
+  803841:	c3                   	ret
+
+0000000000803842 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803842:	55                   	push   %rbp
+  803843:	48 89 e5             	mov    %rsp,%rbp
+  803846:	53                   	push   %rbx
+  803847:	48 83 ec 08          	sub    $0x8,%rsp
+  80384b:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80384e:	40 0f b6 c6          	movzbl %sil,%eax
+  803852:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803859:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  80385b:	be 00 00 00 00       	mov    $0x0,%esi
+  803860:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803865:	48 b8 0a 2d 80 00 00 	movabs $0x802d0a,%rax
+  80386c:	00 00 00 
+  80386f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803871:	85 c0                	test   %eax,%eax
+  803873:	78 23                	js     803898 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803875:	ba 58 06 00 00       	mov    $0x658,%edx
+  80387a:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803881:	00 00 00 
+  803884:	48 89 df             	mov    %rbx,%rdi
+  803887:	48 b8 7b 12 80 00 00 	movabs $0x80127b,%rax
+  80388e:	00 00 00 
+  803891:	ff d0                	call   *%rax
+    return 0;
+  803893:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803898:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80389c:	c9                   	leave
+  80389d:	c3                   	ret
+
+000000000080389e <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80389e:	55                   	push   %rbp
+  80389f:	48 89 e5             	mov    %rsp,%rbp
+  8038a2:	53                   	push   %rbx
+  8038a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8038a7:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  8038aa:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  8038b1:	00 00 00 
+  8038b4:	ff d0                	call   *%rax
+  8038b6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8038bc:	77 35                	ja     8038f3 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  8038be:	48 89 de             	mov    %rbx,%rsi
+  8038c1:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8038c8:	00 00 00 
+  8038cb:	48 b8 86 0e 80 00 00 	movabs $0x800e86,%rax
+  8038d2:	00 00 00 
+  8038d5:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8038d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8038dc:	bf 07 00 00 00       	mov    $0x7,%edi
+  8038e1:	48 b8 0a 2d 80 00 00 	movabs $0x802d0a,%rax
+  8038e8:	00 00 00 
+  8038eb:	ff d0                	call   *%rax
+}
+  8038ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038f1:	c9                   	leave
+  8038f2:	c3                   	ret
+        return -E_BAD_PATH;
+  8038f3:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8038f8:	eb f3                	jmp    8038ed <remove+0x4f>
+
+00000000008038fa <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8038fa:	55                   	push   %rbp
+  8038fb:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8038fe:	48 b8 b5 37 80 00 00 	movabs $0x8037b5,%rax
+  803905:	00 00 00 
+  803908:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80390a:	be 00 00 00 00       	mov    $0x0,%esi
+  80390f:	bf 08 00 00 00       	mov    $0x8,%edi
+  803914:	48 b8 0a 2d 80 00 00 	movabs $0x802d0a,%rax
+  80391b:	00 00 00 
+  80391e:	ff d0                	call   *%rax
+}
+  803920:	5d                   	pop    %rbp
+  803921:	c3                   	ret
+
+0000000000803922 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803922:	55                   	push   %rbp
+  803923:	48 89 e5             	mov    %rsp,%rbp
+  803926:	41 54                	push   %r12
+  803928:	53                   	push   %rbx
+  803929:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80392c:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  803933:	00 00 00 
+  803936:	ff d0                	call   *%rax
+  803938:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80393b:	48 be 20 58 80 00 00 	movabs $0x805820,%rsi
+  803942:	00 00 00 
+  803945:	48 89 df             	mov    %rbx,%rdi
+  803948:	48 b8 86 0e 80 00 00 	movabs $0x800e86,%rax
+  80394f:	00 00 00 
+  803952:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803954:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803959:	41 2b 04 24          	sub    (%r12),%eax
+  80395d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803963:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80396a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80396d:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803974:	00 00 00 
+  803977:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80397e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803983:	5b                   	pop    %rbx
+  803984:	41 5c                	pop    %r12
+  803986:	5d                   	pop    %rbp
+  803987:	c3                   	ret
+
+0000000000803988 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803988:	55                   	push   %rbp
+  803989:	48 89 e5             	mov    %rsp,%rbp
+  80398c:	41 54                	push   %r12
+  80398e:	53                   	push   %rbx
+  80398f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803992:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803997:	48 89 fe             	mov    %rdi,%rsi
+  80399a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80399f:	49 bc c5 17 80 00 00 	movabs $0x8017c5,%r12
+  8039a6:	00 00 00 
+  8039a9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8039ac:	48 89 df             	mov    %rbx,%rdi
+  8039af:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  8039b6:	00 00 00 
+  8039b9:	ff d0                	call   *%rax
+  8039bb:	48 89 c6             	mov    %rax,%rsi
+  8039be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c8:	41 ff d4             	call   *%r12
+}
+  8039cb:	5b                   	pop    %rbx
+  8039cc:	41 5c                	pop    %r12
+  8039ce:	5d                   	pop    %rbp
+  8039cf:	c3                   	ret
+
+00000000008039d0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039d0:	55                   	push   %rbp
+  8039d1:	48 89 e5             	mov    %rsp,%rbp
+  8039d4:	41 57                	push   %r15
+  8039d6:	41 56                	push   %r14
+  8039d8:	41 55                	push   %r13
+  8039da:	41 54                	push   %r12
+  8039dc:	53                   	push   %rbx
+  8039dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8039e1:	49 89 fc             	mov    %rdi,%r12
+  8039e4:	49 89 f5             	mov    %rsi,%r13
+  8039e7:	49 89 d7             	mov    %rdx,%r15
+  8039ea:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039ee:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  8039f5:	00 00 00 
+  8039f8:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8039fa:	4d 85 ff             	test   %r15,%r15
+  8039fd:	0f 84 af 00 00 00    	je     803ab2 <devpipe_write+0xe2>
+  803a03:	48 89 c3             	mov    %rax,%rbx
+  803a06:	4c 89 f8             	mov    %r15,%rax
+  803a09:	4d 89 ef             	mov    %r13,%r15
+  803a0c:	4c 01 e8             	add    %r13,%rax
+  803a0f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a13:	49 bd ba 15 80 00 00 	movabs $0x8015ba,%r13
+  803a1a:	00 00 00 
+            sys_yield();
+  803a1d:	49 be 57 15 80 00 00 	movabs $0x801557,%r14
+  803a24:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a27:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a2a:	48 63 ce             	movslq %esi,%rcx
+  803a2d:	48 63 03             	movslq (%rbx),%rax
+  803a30:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a36:	48 39 c1             	cmp    %rax,%rcx
+  803a39:	72 2e                	jb     803a69 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a3b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a40:	48 89 da             	mov    %rbx,%rdx
+  803a43:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a48:	4c 89 e7             	mov    %r12,%rdi
+  803a4b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803a4e:	85 c0                	test   %eax,%eax
+  803a50:	74 66                	je     803ab8 <devpipe_write+0xe8>
+            sys_yield();
+  803a52:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a55:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a58:	48 63 ce             	movslq %esi,%rcx
+  803a5b:	48 63 03             	movslq (%rbx),%rax
+  803a5e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803a64:	48 39 c1             	cmp    %rax,%rcx
+  803a67:	73 d2                	jae    803a3b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a69:	41 0f b6 3f          	movzbl (%r15),%edi
+  803a6d:	48 89 ca             	mov    %rcx,%rdx
+  803a70:	48 c1 ea 03          	shr    $0x3,%rdx
+  803a74:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803a7b:	08 10 20 
+  803a7e:	48 f7 e2             	mul    %rdx
+  803a81:	48 c1 ea 06          	shr    $0x6,%rdx
+  803a85:	48 89 d0             	mov    %rdx,%rax
+  803a88:	48 c1 e0 09          	shl    $0x9,%rax
+  803a8c:	48 29 d0             	sub    %rdx,%rax
+  803a8f:	48 c1 e0 03          	shl    $0x3,%rax
+  803a93:	48 29 c1             	sub    %rax,%rcx
+  803a96:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803a9b:	83 c6 01             	add    $0x1,%esi
+  803a9e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803aa1:	49 83 c7 01          	add    $0x1,%r15
+  803aa5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803aa9:	49 39 c7             	cmp    %rax,%r15
+  803aac:	0f 85 75 ff ff ff    	jne    803a27 <devpipe_write+0x57>
+    return n;
+  803ab2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ab6:	eb 05                	jmp    803abd <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803abd:	48 83 c4 18          	add    $0x18,%rsp
+  803ac1:	5b                   	pop    %rbx
+  803ac2:	41 5c                	pop    %r12
+  803ac4:	41 5d                	pop    %r13
+  803ac6:	41 5e                	pop    %r14
+  803ac8:	41 5f                	pop    %r15
+  803aca:	5d                   	pop    %rbp
+  803acb:	c3                   	ret
+
+0000000000803acc <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803acc:	55                   	push   %rbp
+  803acd:	48 89 e5             	mov    %rsp,%rbp
+  803ad0:	41 57                	push   %r15
+  803ad2:	41 56                	push   %r14
+  803ad4:	41 55                	push   %r13
+  803ad6:	41 54                	push   %r12
+  803ad8:	53                   	push   %rbx
+  803ad9:	48 83 ec 18          	sub    $0x18,%rsp
+  803add:	49 89 fc             	mov    %rdi,%r12
+  803ae0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ae4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ae8:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  803aef:	00 00 00 
+  803af2:	ff d0                	call   *%rax
+  803af4:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803af7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803afd:	49 bd ba 15 80 00 00 	movabs $0x8015ba,%r13
+  803b04:	00 00 00 
+            sys_yield();
+  803b07:	49 be 57 15 80 00 00 	movabs $0x801557,%r14
+  803b0e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b11:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b16:	74 7d                	je     803b95 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b18:	8b 03                	mov    (%rbx),%eax
+  803b1a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b1d:	75 26                	jne    803b45 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803b1f:	4d 85 ff             	test   %r15,%r15
+  803b22:	75 77                	jne    803b9b <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b24:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b29:	48 89 da             	mov    %rbx,%rdx
+  803b2c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b31:	4c 89 e7             	mov    %r12,%rdi
+  803b34:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803b37:	85 c0                	test   %eax,%eax
+  803b39:	74 72                	je     803bad <devpipe_read+0xe1>
+            sys_yield();
+  803b3b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b3e:	8b 03                	mov    (%rbx),%eax
+  803b40:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b43:	74 df                	je     803b24 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b45:	48 63 c8             	movslq %eax,%rcx
+  803b48:	48 89 ca             	mov    %rcx,%rdx
+  803b4b:	48 c1 ea 03          	shr    $0x3,%rdx
+  803b4f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803b56:	08 10 20 
+  803b59:	48 89 d0             	mov    %rdx,%rax
+  803b5c:	48 f7 e6             	mul    %rsi
+  803b5f:	48 c1 ea 06          	shr    $0x6,%rdx
+  803b63:	48 89 d0             	mov    %rdx,%rax
+  803b66:	48 c1 e0 09          	shl    $0x9,%rax
+  803b6a:	48 29 d0             	sub    %rdx,%rax
+  803b6d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803b74:	00 
+  803b75:	48 89 c8             	mov    %rcx,%rax
+  803b78:	48 29 d0             	sub    %rdx,%rax
+  803b7b:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803b80:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b84:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803b88:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b8b:	49 83 c7 01          	add    $0x1,%r15
+  803b8f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803b93:	75 83                	jne    803b18 <devpipe_read+0x4c>
+    return n;
+  803b95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b99:	eb 03                	jmp    803b9e <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803b9b:	4c 89 f8             	mov    %r15,%rax
+}
+  803b9e:	48 83 c4 18          	add    $0x18,%rsp
+  803ba2:	5b                   	pop    %rbx
+  803ba3:	41 5c                	pop    %r12
+  803ba5:	41 5d                	pop    %r13
+  803ba7:	41 5e                	pop    %r14
+  803ba9:	41 5f                	pop    %r15
+  803bab:	5d                   	pop    %rbp
+  803bac:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb2:	eb ea                	jmp    803b9e <devpipe_read+0xd2>
+
+0000000000803bb4 <pipe>:
+pipe(int pfd[2]) {
+  803bb4:	55                   	push   %rbp
+  803bb5:	48 89 e5             	mov    %rsp,%rbp
+  803bb8:	41 55                	push   %r13
+  803bba:	41 54                	push   %r12
+  803bbc:	53                   	push   %rbx
+  803bbd:	48 83 ec 18          	sub    $0x18,%rsp
+  803bc1:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bc4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bc8:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  803bcf:	00 00 00 
+  803bd2:	ff d0                	call   *%rax
+  803bd4:	89 c3                	mov    %eax,%ebx
+  803bd6:	85 c0                	test   %eax,%eax
+  803bd8:	0f 88 a0 01 00 00    	js     803d7e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803bde:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803be3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803be8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803bec:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bf1:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  803bf8:	00 00 00 
+  803bfb:	ff d0                	call   *%rax
+  803bfd:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bff:	85 c0                	test   %eax,%eax
+  803c01:	0f 88 77 01 00 00    	js     803d7e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c07:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c0b:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  803c12:	00 00 00 
+  803c15:	ff d0                	call   *%rax
+  803c17:	89 c3                	mov    %eax,%ebx
+  803c19:	85 c0                	test   %eax,%eax
+  803c1b:	0f 88 43 01 00 00    	js     803d64 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c21:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c26:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c2b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c34:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  803c3b:	00 00 00 
+  803c3e:	ff d0                	call   *%rax
+  803c40:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c42:	85 c0                	test   %eax,%eax
+  803c44:	0f 88 1a 01 00 00    	js     803d64 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803c4a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c4e:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  803c55:	00 00 00 
+  803c58:	ff d0                	call   *%rax
+  803c5a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c5d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c62:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c67:	48 89 c6             	mov    %rax,%rsi
+  803c6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c6f:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  803c76:	00 00 00 
+  803c79:	ff d0                	call   *%rax
+  803c7b:	89 c3                	mov    %eax,%ebx
+  803c7d:	85 c0                	test   %eax,%eax
+  803c7f:	0f 88 c5 00 00 00    	js     803d4a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c85:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c89:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  803c90:	00 00 00 
+  803c93:	ff d0                	call   *%rax
+  803c95:	48 89 c1             	mov    %rax,%rcx
+  803c98:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c9e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803ca4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ca9:	4c 89 ee             	mov    %r13,%rsi
+  803cac:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb1:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  803cb8:	00 00 00 
+  803cbb:	ff d0                	call   *%rax
+  803cbd:	89 c3                	mov    %eax,%ebx
+  803cbf:	85 c0                	test   %eax,%eax
+  803cc1:	78 6e                	js     803d31 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803cc3:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cc8:	4c 89 ef             	mov    %r13,%rdi
+  803ccb:	48 b8 88 15 80 00 00 	movabs $0x801588,%rax
+  803cd2:	00 00 00 
+  803cd5:	ff d0                	call   *%rax
+  803cd7:	83 f8 02             	cmp    $0x2,%eax
+  803cda:	0f 85 ab 00 00 00    	jne    803d8b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803ce0:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803ce7:	00 00 
+  803ce9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ced:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803cef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cf3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803cfa:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803cfe:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d00:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d04:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d0b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d0f:	48 bb 0a 21 80 00 00 	movabs $0x80210a,%rbx
+  803d16:	00 00 00 
+  803d19:	ff d3                	call   *%rbx
+  803d1b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d1f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d23:	ff d3                	call   *%rbx
+  803d25:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d2f:	eb 4d                	jmp    803d7e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d31:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d36:	4c 89 ee             	mov    %r13,%rsi
+  803d39:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d3e:	48 b8 c5 17 80 00 00 	movabs $0x8017c5,%rax
+  803d45:	00 00 00 
+  803d48:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d4f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d53:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d58:	48 b8 c5 17 80 00 00 	movabs $0x8017c5,%rax
+  803d5f:	00 00 00 
+  803d62:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d64:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d69:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d72:	48 b8 c5 17 80 00 00 	movabs $0x8017c5,%rax
+  803d79:	00 00 00 
+  803d7c:	ff d0                	call   *%rax
+}
+  803d7e:	89 d8                	mov    %ebx,%eax
+  803d80:	48 83 c4 18          	add    $0x18,%rsp
+  803d84:	5b                   	pop    %rbx
+  803d85:	41 5c                	pop    %r12
+  803d87:	41 5d                	pop    %r13
+  803d89:	5d                   	pop    %rbp
+  803d8a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d8b:	48 b9 50 58 80 00 00 	movabs $0x805850,%rcx
+  803d92:	00 00 00 
+  803d95:	48 ba 27 58 80 00 00 	movabs $0x805827,%rdx
+  803d9c:	00 00 00 
+  803d9f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803da4:	48 bf 3c 58 80 00 00 	movabs $0x80583c,%rdi
+  803dab:	00 00 00 
+  803dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803db3:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  803dba:	00 00 00 
+  803dbd:	41 ff d0             	call   *%r8
+
+0000000000803dc0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803dc0:	55                   	push   %rbp
+  803dc1:	48 89 e5             	mov    %rsp,%rbp
+  803dc4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803dc8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803dcc:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  803dd3:	00 00 00 
+  803dd6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803dd8:	85 c0                	test   %eax,%eax
+  803dda:	78 35                	js     803e11 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803ddc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803de0:	48 b8 1c 21 80 00 00 	movabs $0x80211c,%rax
+  803de7:	00 00 00 
+  803dea:	ff d0                	call   *%rax
+  803dec:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803def:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803df4:	be 00 10 00 00       	mov    $0x1000,%esi
+  803df9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dfd:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  803e04:	00 00 00 
+  803e07:	ff d0                	call   *%rax
+  803e09:	85 c0                	test   %eax,%eax
+  803e0b:	0f 94 c0             	sete   %al
+  803e0e:	0f b6 c0             	movzbl %al,%eax
+}
+  803e11:	c9                   	leave
+  803e12:	c3                   	ret
+
+0000000000803e13 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803e13:	55                   	push   %rbp
+  803e14:	48 89 e5             	mov    %rsp,%rbp
+  803e17:	41 55                	push   %r13
+  803e19:	41 54                	push   %r12
+  803e1b:	53                   	push   %rbx
+  803e1c:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  803e20:	85 ff                	test   %edi,%edi
+  803e22:	74 73                	je     803e97 <wait+0x84>
+  803e24:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803e27:	89 f8                	mov    %edi,%eax
+  803e29:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  803e2e:	89 f9                	mov    %edi,%ecx
+  803e30:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803e36:	48 69 c9 68 01 00 00 	imul   $0x168,%rcx,%rcx
+  803e3d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803e44:	00 00 00 
+  803e47:	48 01 ca             	add    %rcx,%rdx
+  803e4a:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  803e50:	39 d7                	cmp    %edx,%edi
+  803e52:	75 38                	jne    803e8c <wait+0x79>
+           env->env_status != ENV_FREE) {
+  803e54:	48 98                	cltq
+  803e56:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  803e5d:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803e64:	00 00 00 
+  803e67:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  803e6a:	49 bd 57 15 80 00 00 	movabs $0x801557,%r13
+  803e71:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803e74:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  803e7a:	85 c0                	test   %eax,%eax
+  803e7c:	74 0e                	je     803e8c <wait+0x79>
+        sys_yield();
+  803e7e:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803e81:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  803e87:	44 39 e0             	cmp    %r12d,%eax
+  803e8a:	74 e8                	je     803e74 <wait+0x61>
+    }
+}
+  803e8c:	48 83 c4 08          	add    $0x8,%rsp
+  803e90:	5b                   	pop    %rbx
+  803e91:	41 5c                	pop    %r12
+  803e93:	41 5d                	pop    %r13
+  803e95:	5d                   	pop    %rbp
+  803e96:	c3                   	ret
+    assert(envid != 0);
+  803e97:	48 b9 74 58 80 00 00 	movabs $0x805874,%rcx
+  803e9e:	00 00 00 
+  803ea1:	48 ba 27 58 80 00 00 	movabs $0x805827,%rdx
+  803ea8:	00 00 00 
+  803eab:	be 06 00 00 00       	mov    $0x6,%esi
+  803eb0:	48 bf 7f 58 80 00 00 	movabs $0x80587f,%rdi
+  803eb7:	00 00 00 
+  803eba:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ebf:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  803ec6:	00 00 00 
+  803ec9:	41 ff d0             	call   *%r8
+
+0000000000803ecc <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ecc:	48 89 f8             	mov    %rdi,%rax
+  803ecf:	48 c1 e8 27          	shr    $0x27,%rax
+  803ed3:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803eda:	7f 00 00 
+  803edd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ee1:	f6 c2 01             	test   $0x1,%dl
+  803ee4:	74 6d                	je     803f53 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ee6:	48 89 f8             	mov    %rdi,%rax
+  803ee9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803eed:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803ef4:	7f 00 00 
+  803ef7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803efb:	f6 c2 01             	test   $0x1,%dl
+  803efe:	74 62                	je     803f62 <get_uvpt_entry+0x96>
+  803f00:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f07:	7f 00 00 
+  803f0a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f0e:	f6 c2 80             	test   $0x80,%dl
+  803f11:	75 4f                	jne    803f62 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f13:	48 89 f8             	mov    %rdi,%rax
+  803f16:	48 c1 e8 15          	shr    $0x15,%rax
+  803f1a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f21:	7f 00 00 
+  803f24:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f28:	f6 c2 01             	test   $0x1,%dl
+  803f2b:	74 44                	je     803f71 <get_uvpt_entry+0xa5>
+  803f2d:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f34:	7f 00 00 
+  803f37:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f3b:	f6 c2 80             	test   $0x80,%dl
+  803f3e:	75 31                	jne    803f71 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803f40:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803f44:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  803f4b:	7f 00 00 
+  803f4e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803f52:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f53:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  803f5a:	7f 00 00 
+  803f5d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f61:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f62:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  803f69:	7f 00 00 
+  803f6c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f70:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f71:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  803f78:	7f 00 00 
+  803f7b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f7f:	c3                   	ret
+
+0000000000803f80 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  803f80:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f83:	48 89 f9             	mov    %rdi,%rcx
+  803f86:	48 c1 e9 27          	shr    $0x27,%rcx
+  803f8a:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  803f91:	7f 00 00 
+  803f94:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  803f98:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  803f9f:	f6 c1 01             	test   $0x1,%cl
+  803fa2:	0f 84 b2 00 00 00    	je     80405a <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803fa8:	48 89 f9             	mov    %rdi,%rcx
+  803fab:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  803faf:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fb6:	7f 00 00 
+  803fb9:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803fbd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  803fc4:	40 f6 c6 01          	test   $0x1,%sil
+  803fc8:	0f 84 8c 00 00 00    	je     80405a <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  803fce:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  803fd5:	7f 00 00 
+  803fd8:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  803fdc:	a8 80                	test   $0x80,%al
+  803fde:	75 7b                	jne    80405b <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803fe0:	48 89 f9             	mov    %rdi,%rcx
+  803fe3:	48 c1 e9 15          	shr    $0x15,%rcx
+  803fe7:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  803fee:	7f 00 00 
+  803ff1:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  803ff5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  803ffc:	40 f6 c6 01          	test   $0x1,%sil
+  804000:	74 58                	je     80405a <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  804002:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804009:	7f 00 00 
+  80400c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804010:	a8 80                	test   $0x80,%al
+  804012:	75 6c                	jne    804080 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804014:	48 89 f9             	mov    %rdi,%rcx
+  804017:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80401b:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804022:	7f 00 00 
+  804025:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804029:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804030:	40 f6 c6 01          	test   $0x1,%sil
+  804034:	74 24                	je     80405a <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804036:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80403d:	7f 00 00 
+  804040:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804044:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80404b:	ff ff 7f 
+  80404e:	48 21 c8             	and    %rcx,%rax
+  804051:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804057:	48 09 d0             	or     %rdx,%rax
+}
+  80405a:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80405b:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804062:	7f 00 00 
+  804065:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804069:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804070:	ff ff 7f 
+  804073:	48 21 c8             	and    %rcx,%rax
+  804076:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80407c:	48 01 d0             	add    %rdx,%rax
+  80407f:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804080:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804087:	7f 00 00 
+  80408a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80408e:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804095:	ff ff 7f 
+  804098:	48 21 c8             	and    %rcx,%rax
+  80409b:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8040a1:	48 01 d0             	add    %rdx,%rax
+  8040a4:	c3                   	ret
+
+00000000008040a5 <get_prot>:
+
+int
+get_prot(void *va) {
+  8040a5:	55                   	push   %rbp
+  8040a6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040a9:	48 b8 cc 3e 80 00 00 	movabs $0x803ecc,%rax
+  8040b0:	00 00 00 
+  8040b3:	ff d0                	call   *%rax
+  8040b5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8040b8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8040bd:	89 c1                	mov    %eax,%ecx
+  8040bf:	83 c9 04             	or     $0x4,%ecx
+  8040c2:	f6 c2 01             	test   $0x1,%dl
+  8040c5:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8040c8:	89 c1                	mov    %eax,%ecx
+  8040ca:	83 c9 02             	or     $0x2,%ecx
+  8040cd:	f6 c2 02             	test   $0x2,%dl
+  8040d0:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040d3:	89 c1                	mov    %eax,%ecx
+  8040d5:	83 c9 01             	or     $0x1,%ecx
+  8040d8:	48 85 d2             	test   %rdx,%rdx
+  8040db:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040de:	89 c1                	mov    %eax,%ecx
+  8040e0:	83 c9 40             	or     $0x40,%ecx
+  8040e3:	f6 c6 04             	test   $0x4,%dh
+  8040e6:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040e9:	5d                   	pop    %rbp
+  8040ea:	c3                   	ret
+
+00000000008040eb <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040eb:	55                   	push   %rbp
+  8040ec:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040ef:	48 b8 cc 3e 80 00 00 	movabs $0x803ecc,%rax
+  8040f6:	00 00 00 
+  8040f9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040fb:	48 c1 e8 06          	shr    $0x6,%rax
+  8040ff:	83 e0 01             	and    $0x1,%eax
+}
+  804102:	5d                   	pop    %rbp
+  804103:	c3                   	ret
+
+0000000000804104 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804104:	55                   	push   %rbp
+  804105:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804108:	48 b8 cc 3e 80 00 00 	movabs $0x803ecc,%rax
+  80410f:	00 00 00 
+  804112:	ff d0                	call   *%rax
+  804114:	83 e0 01             	and    $0x1,%eax
+}
+  804117:	5d                   	pop    %rbp
+  804118:	c3                   	ret
+
+0000000000804119 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804119:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804120:	7f 00 00 
+  804123:	a8 01                	test   $0x1,%al
+  804125:	75 06                	jne    80412d <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80412c:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80412d:	55                   	push   %rbp
+  80412e:	48 89 e5             	mov    %rsp,%rbp
+  804131:	41 57                	push   %r15
+  804133:	41 56                	push   %r14
+  804135:	41 55                	push   %r13
+  804137:	41 54                	push   %r12
+  804139:	53                   	push   %rbx
+  80413a:	48 83 ec 18          	sub    $0x18,%rsp
+  80413e:	49 89 fe             	mov    %rdi,%r14
+  804141:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804144:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80414b:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80414c:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804153:	7f 00 00 
+  804156:	e9 81 00 00 00       	jmp    8041dc <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  80415b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804162:	49 39 dd             	cmp    %rbx,%r13
+  804165:	74 2b                	je     804192 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804167:	48 89 d8             	mov    %rbx,%rax
+  80416a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80416e:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804172:	f6 c2 01             	test   $0x1,%dl
+  804175:	74 e4                	je     80415b <foreach_shared_region+0x42>
+  804177:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  80417b:	f6 c4 04             	test   $0x4,%ah
+  80417e:	74 db                	je     80415b <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804180:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804187:	4c 89 fa             	mov    %r15,%rdx
+  80418a:	48 89 df             	mov    %rbx,%rdi
+  80418d:	41 ff d6             	call   *%r14
+  804190:	eb c9                	jmp    80415b <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804192:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804199:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  80419d:	74 22                	je     8041c1 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  80419f:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  8041a6:	48 89 d8             	mov    %rbx,%rax
+  8041a9:	48 c1 e8 15          	shr    $0x15,%rax
+  8041ad:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  8041b4:	7f 00 00 
+  8041b7:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041bb:	a8 01                	test   $0x1,%al
+  8041bd:	74 d3                	je     804192 <foreach_shared_region+0x79>
+  8041bf:	eb a6                	jmp    804167 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8041c1:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  8041c8:	40 
+  8041c9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8041cd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041d4:	00 00 00 
+  8041d7:	48 39 c1             	cmp    %rax,%rcx
+  8041da:	74 31                	je     80420d <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  8041dc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041e0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041e4:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8041eb:	7f 00 00 
+  8041ee:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041f2:	a8 01                	test   $0x1,%al
+  8041f4:	74 cb                	je     8041c1 <foreach_shared_region+0xa8>
+  8041f6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041fa:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804201:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804207:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80420b:	eb 92                	jmp    80419f <foreach_shared_region+0x86>
+}
+  80420d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804212:	48 83 c4 18          	add    $0x18,%rsp
+  804216:	5b                   	pop    %rbx
+  804217:	41 5c                	pop    %r12
+  804219:	41 5d                	pop    %r13
+  80421b:	41 5e                	pop    %r14
+  80421d:	41 5f                	pop    %r15
+  80421f:	5d                   	pop    %rbp
+  804220:	c3                   	ret
+
+0000000000804221 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804221:	b8 00 00 00 00       	mov    $0x0,%eax
+  804226:	c3                   	ret
+
+0000000000804227 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804227:	55                   	push   %rbp
+  804228:	48 89 e5             	mov    %rsp,%rbp
+  80422b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80422e:	48 be 8a 58 80 00 00 	movabs $0x80588a,%rsi
+  804235:	00 00 00 
+  804238:	48 b8 86 0e 80 00 00 	movabs $0x800e86,%rax
+  80423f:	00 00 00 
+  804242:	ff d0                	call   *%rax
+    return 0;
+}
+  804244:	b8 00 00 00 00       	mov    $0x0,%eax
+  804249:	5d                   	pop    %rbp
+  80424a:	c3                   	ret
+
+000000000080424b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80424b:	55                   	push   %rbp
+  80424c:	48 89 e5             	mov    %rsp,%rbp
+  80424f:	41 57                	push   %r15
+  804251:	41 56                	push   %r14
+  804253:	41 55                	push   %r13
+  804255:	41 54                	push   %r12
+  804257:	53                   	push   %rbx
+  804258:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80425f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804266:	48 85 d2             	test   %rdx,%rdx
+  804269:	74 7a                	je     8042e5 <devcons_write+0x9a>
+  80426b:	49 89 d6             	mov    %rdx,%r14
+  80426e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804274:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804279:	49 bf 14 12 80 00 00 	movabs $0x801214,%r15
+  804280:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804283:	4c 89 f3             	mov    %r14,%rbx
+  804286:	48 29 f3             	sub    %rsi,%rbx
+  804289:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80428e:	48 39 c3             	cmp    %rax,%rbx
+  804291:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804295:	4c 63 eb             	movslq %ebx,%r13
+  804298:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80429f:	48 01 c6             	add    %rax,%rsi
+  8042a2:	4c 89 ea             	mov    %r13,%rdx
+  8042a5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042ac:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8042af:	4c 89 ee             	mov    %r13,%rsi
+  8042b2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042b9:	48 b8 5d 14 80 00 00 	movabs $0x80145d,%rax
+  8042c0:	00 00 00 
+  8042c3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8042c5:	41 01 dc             	add    %ebx,%r12d
+  8042c8:	49 63 f4             	movslq %r12d,%rsi
+  8042cb:	4c 39 f6             	cmp    %r14,%rsi
+  8042ce:	72 b3                	jb     804283 <devcons_write+0x38>
+    return res;
+  8042d0:	49 63 c4             	movslq %r12d,%rax
+}
+  8042d3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8042da:	5b                   	pop    %rbx
+  8042db:	41 5c                	pop    %r12
+  8042dd:	41 5d                	pop    %r13
+  8042df:	41 5e                	pop    %r14
+  8042e1:	41 5f                	pop    %r15
+  8042e3:	5d                   	pop    %rbp
+  8042e4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8042e5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042eb:	eb e3                	jmp    8042d0 <devcons_write+0x85>
+
+00000000008042ed <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042ed:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8042f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042f5:	48 85 c0             	test   %rax,%rax
+  8042f8:	74 55                	je     80434f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042fa:	55                   	push   %rbp
+  8042fb:	48 89 e5             	mov    %rsp,%rbp
+  8042fe:	41 55                	push   %r13
+  804300:	41 54                	push   %r12
+  804302:	53                   	push   %rbx
+  804303:	48 83 ec 08          	sub    $0x8,%rsp
+  804307:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80430a:	48 bb 8a 14 80 00 00 	movabs $0x80148a,%rbx
+  804311:	00 00 00 
+  804314:	49 bc 57 15 80 00 00 	movabs $0x801557,%r12
+  80431b:	00 00 00 
+  80431e:	eb 03                	jmp    804323 <devcons_read+0x36>
+  804320:	41 ff d4             	call   *%r12
+  804323:	ff d3                	call   *%rbx
+  804325:	85 c0                	test   %eax,%eax
+  804327:	74 f7                	je     804320 <devcons_read+0x33>
+    if (c < 0) return c;
+  804329:	48 63 d0             	movslq %eax,%rdx
+  80432c:	78 13                	js     804341 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80432e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804333:	83 f8 04             	cmp    $0x4,%eax
+  804336:	74 09                	je     804341 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804338:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80433c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804341:	48 89 d0             	mov    %rdx,%rax
+  804344:	48 83 c4 08          	add    $0x8,%rsp
+  804348:	5b                   	pop    %rbx
+  804349:	41 5c                	pop    %r12
+  80434b:	41 5d                	pop    %r13
+  80434d:	5d                   	pop    %rbp
+  80434e:	c3                   	ret
+  80434f:	48 89 d0             	mov    %rdx,%rax
+  804352:	c3                   	ret
+
+0000000000804353 <cputchar>:
+cputchar(int ch) {
+  804353:	55                   	push   %rbp
+  804354:	48 89 e5             	mov    %rsp,%rbp
+  804357:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80435b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80435f:	be 01 00 00 00       	mov    $0x1,%esi
+  804364:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804368:	48 b8 5d 14 80 00 00 	movabs $0x80145d,%rax
+  80436f:	00 00 00 
+  804372:	ff d0                	call   *%rax
+}
+  804374:	c9                   	leave
+  804375:	c3                   	ret
+
+0000000000804376 <getchar>:
+getchar(void) {
+  804376:	55                   	push   %rbp
+  804377:	48 89 e5             	mov    %rsp,%rbp
+  80437a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80437e:	ba 01 00 00 00       	mov    $0x1,%edx
+  804383:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804387:	bf 00 00 00 00       	mov    $0x0,%edi
+  80438c:	48 b8 7b 24 80 00 00 	movabs $0x80247b,%rax
+  804393:	00 00 00 
+  804396:	ff d0                	call   *%rax
+  804398:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80439a:	85 c0                	test   %eax,%eax
+  80439c:	78 06                	js     8043a4 <getchar+0x2e>
+  80439e:	74 08                	je     8043a8 <getchar+0x32>
+  8043a0:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8043a4:	89 d0                	mov    %edx,%eax
+  8043a6:	c9                   	leave
+  8043a7:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8043a8:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8043ad:	eb f5                	jmp    8043a4 <getchar+0x2e>
+
+00000000008043af <iscons>:
+iscons(int fdnum) {
+  8043af:	55                   	push   %rbp
+  8043b0:	48 89 e5             	mov    %rsp,%rbp
+  8043b3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043b7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043bb:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  8043c2:	00 00 00 
+  8043c5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8043c7:	85 c0                	test   %eax,%eax
+  8043c9:	78 18                	js     8043e3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8043cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043cf:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8043d6:	00 00 00 
+  8043d9:	8b 00                	mov    (%rax),%eax
+  8043db:	39 02                	cmp    %eax,(%rdx)
+  8043dd:	0f 94 c0             	sete   %al
+  8043e0:	0f b6 c0             	movzbl %al,%eax
+}
+  8043e3:	c9                   	leave
+  8043e4:	c3                   	ret
+
+00000000008043e5 <opencons>:
+opencons(void) {
+  8043e5:	55                   	push   %rbp
+  8043e6:	48 89 e5             	mov    %rsp,%rbp
+  8043e9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8043ed:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8043f1:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  8043f8:	00 00 00 
+  8043fb:	ff d0                	call   *%rax
+  8043fd:	85 c0                	test   %eax,%eax
+  8043ff:	78 49                	js     80444a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804401:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804406:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80440b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80440f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804414:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  80441b:	00 00 00 
+  80441e:	ff d0                	call   *%rax
+  804420:	85 c0                	test   %eax,%eax
+  804422:	78 26                	js     80444a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804424:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804428:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80442f:	00 00 
+  804431:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804433:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804437:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80443e:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  804445:	00 00 00 
+  804448:	ff d0                	call   *%rax
+}
+  80444a:	c9                   	leave
+  80444b:	c3                   	ret
+
+000000000080444c <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80444c:	55                   	push   %rbp
+  80444d:	48 89 e5             	mov    %rsp,%rbp
+  804450:	41 55                	push   %r13
+  804452:	41 54                	push   %r12
+  804454:	53                   	push   %rbx
+  804455:	48 83 ec 08          	sub    $0x8,%rsp
+  804459:	49 89 fc             	mov    %rdi,%r12
+  80445c:	48 89 f7             	mov    %rsi,%rdi
+  80445f:	48 89 d3             	mov    %rdx,%rbx
+  804462:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804465:	48 85 f6             	test   %rsi,%rsi
+  804468:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80446f:	00 00 00 
+  804472:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804476:	be 00 10 00 00       	mov    $0x1000,%esi
+  80447b:	48 85 d2             	test   %rdx,%rdx
+  80447e:	74 03                	je     804483 <ipc_recv+0x37>
+  804480:	48 8b 32             	mov    (%rdx),%rsi
+  804483:	48 b8 93 19 80 00 00 	movabs $0x801993,%rax
+  80448a:	00 00 00 
+  80448d:	ff d0                	call   *%rax
+    if (errno) {
+  80448f:	85 c0                	test   %eax,%eax
+  804491:	74 1c                	je     8044af <ipc_recv+0x63>
+        if (from_env_store)
+  804493:	4d 85 e4             	test   %r12,%r12
+  804496:	74 08                	je     8044a0 <ipc_recv+0x54>
+            *from_env_store = 0;
+  804498:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80449f:	00 
+
+        if (perm_store)
+  8044a0:	4d 85 ed             	test   %r13,%r13
+  8044a3:	74 74                	je     804519 <ipc_recv+0xcd>
+            *perm_store = 0;
+  8044a5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8044ac:	00 
+  8044ad:	eb 6a                	jmp    804519 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8044af:	4d 85 e4             	test   %r12,%r12
+  8044b2:	74 14                	je     8044c8 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8044b4:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8044bb:	00 00 00 
+  8044be:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8044c4:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  8044c8:	48 85 db             	test   %rbx,%rbx
+  8044cb:	74 23                	je     8044f0 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8044cd:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8044d4:	00 00 00 
+  8044d7:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8044dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044e2:	85 c9                	test   %ecx,%ecx
+  8044e4:	74 07                	je     8044ed <ipc_recv+0xa1>
+  8044e6:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8044ed:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8044f0:	4d 85 ed             	test   %r13,%r13
+  8044f3:	74 14                	je     804509 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8044f5:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8044fc:	00 00 00 
+  8044ff:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804505:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804509:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  804510:	00 00 00 
+  804513:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804519:	48 83 c4 08          	add    $0x8,%rsp
+  80451d:	5b                   	pop    %rbx
+  80451e:	41 5c                	pop    %r12
+  804520:	41 5d                	pop    %r13
+  804522:	5d                   	pop    %rbp
+  804523:	c3                   	ret
+
+0000000000804524 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804524:	55                   	push   %rbp
+  804525:	48 89 e5             	mov    %rsp,%rbp
+  804528:	41 55                	push   %r13
+  80452a:	41 54                	push   %r12
+  80452c:	53                   	push   %rbx
+  80452d:	48 83 ec 08          	sub    $0x8,%rsp
+  804531:	49 89 fc             	mov    %rdi,%r12
+  804534:	48 89 f7             	mov    %rsi,%rdi
+  804537:	48 89 d3             	mov    %rdx,%rbx
+  80453a:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80453d:	48 85 f6             	test   %rsi,%rsi
+  804540:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804547:	00 00 00 
+  80454a:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  80454e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804553:	48 85 d2             	test   %rdx,%rdx
+  804556:	74 03                	je     80455b <ipc_try_recv+0x37>
+  804558:	48 8b 32             	mov    (%rdx),%rsi
+  80455b:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  804562:	00 00 00 
+  804565:	ff d0                	call   *%rax
+    if (errno) {
+  804567:	85 c0                	test   %eax,%eax
+  804569:	75 75                	jne    8045e0 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80456b:	4d 85 e4             	test   %r12,%r12
+  80456e:	74 14                	je     804584 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804570:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  804577:	00 00 00 
+  80457a:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804580:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804584:	48 85 db             	test   %rbx,%rbx
+  804587:	74 23                	je     8045ac <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804589:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  804590:	00 00 00 
+  804593:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804599:	ba 00 00 00 00       	mov    $0x0,%edx
+  80459e:	85 c9                	test   %ecx,%ecx
+  8045a0:	74 07                	je     8045a9 <ipc_try_recv+0x85>
+  8045a2:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8045a9:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8045ac:	4d 85 ed             	test   %r13,%r13
+  8045af:	74 14                	je     8045c5 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8045b1:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8045b8:	00 00 00 
+  8045bb:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8045c1:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8045c5:	48 a1 00 74 80 00 00 	movabs 0x807400,%rax
+  8045cc:	00 00 00 
+  8045cf:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  8045d5:	48 83 c4 08          	add    $0x8,%rsp
+  8045d9:	5b                   	pop    %rbx
+  8045da:	41 5c                	pop    %r12
+  8045dc:	41 5d                	pop    %r13
+  8045de:	5d                   	pop    %rbp
+  8045df:	c3                   	ret
+        if (from_env_store)
+  8045e0:	4d 85 e4             	test   %r12,%r12
+  8045e3:	74 08                	je     8045ed <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8045e5:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045ec:	00 
+        if (perm_store)
+  8045ed:	4d 85 ed             	test   %r13,%r13
+  8045f0:	74 e3                	je     8045d5 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8045f2:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045f9:	00 
+  8045fa:	eb d9                	jmp    8045d5 <ipc_try_recv+0xb1>
+
+00000000008045fc <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045fc:	55                   	push   %rbp
+  8045fd:	48 89 e5             	mov    %rsp,%rbp
+  804600:	41 57                	push   %r15
+  804602:	41 56                	push   %r14
+  804604:	41 55                	push   %r13
+  804606:	41 54                	push   %r12
+  804608:	53                   	push   %rbx
+  804609:	48 83 ec 18          	sub    $0x18,%rsp
+  80460d:	41 89 fd             	mov    %edi,%r13d
+  804610:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804613:	48 89 d3             	mov    %rdx,%rbx
+  804616:	49 89 cc             	mov    %rcx,%r12
+  804619:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80461d:	48 85 d2             	test   %rdx,%rdx
+  804620:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804627:	00 00 00 
+  80462a:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80462e:	49 be 67 19 80 00 00 	movabs $0x801967,%r14
+  804635:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804638:	49 bf 57 15 80 00 00 	movabs $0x801557,%r15
+  80463f:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804642:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804645:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804649:	4c 89 e1             	mov    %r12,%rcx
+  80464c:	48 89 da             	mov    %rbx,%rdx
+  80464f:	44 89 ef             	mov    %r13d,%edi
+  804652:	41 ff d6             	call   *%r14
+  804655:	85 c0                	test   %eax,%eax
+  804657:	74 37                	je     804690 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804659:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80465c:	75 05                	jne    804663 <ipc_send+0x67>
+        sys_yield();
+  80465e:	41 ff d7             	call   *%r15
+  804661:	eb df                	jmp    804642 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804663:	89 c1                	mov    %eax,%ecx
+  804665:	48 ba 96 58 80 00 00 	movabs $0x805896,%rdx
+  80466c:	00 00 00 
+  80466f:	be 65 00 00 00       	mov    $0x65,%esi
+  804674:	48 bf b1 58 80 00 00 	movabs $0x8058b1,%rdi
+  80467b:	00 00 00 
+  80467e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804683:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  80468a:	00 00 00 
+  80468d:	41 ff d0             	call   *%r8
+    }
+}
+  804690:	48 83 c4 18          	add    $0x18,%rsp
+  804694:	5b                   	pop    %rbx
+  804695:	41 5c                	pop    %r12
+  804697:	41 5d                	pop    %r13
+  804699:	41 5e                	pop    %r14
+  80469b:	41 5f                	pop    %r15
+  80469d:	5d                   	pop    %rbp
+  80469e:	c3                   	ret
+
+000000000080469f <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80469f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8046a4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8046ab:	00 00 00 
+  8046ae:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8046b5:	48 01 ca             	add    %rcx,%rdx
+  8046b8:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8046be:	39 fa                	cmp    %edi,%edx
+  8046c0:	74 12                	je     8046d4 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8046c2:	48 83 c0 01          	add    $0x1,%rax
+  8046c6:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8046cc:	75 e0                	jne    8046ae <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8046ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046d3:	c3                   	ret
+            return envs[i].env_id;
+  8046d4:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8046db:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046e2:	00 00 00 
+  8046e5:	48 01 d0             	add    %rdx,%rax
+  8046e8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046ee:	c3                   	ret
+
+00000000008046ef <__text_end>:
+  8046ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f6:	00 00 00 
+  8046f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804700:	00 00 00 
+  804703:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470a:	00 00 00 
+  80470d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804714:	00 00 00 
+  804717:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471e:	00 00 00 
+  804721:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804728:	00 00 00 
+  80472b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804732:	00 00 00 
+  804735:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473c:	00 00 00 
+  80473f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804746:	00 00 00 
+  804749:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804750:	00 00 00 
+  804753:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475a:	00 00 00 
+  80475d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804764:	00 00 00 
+  804767:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476e:	00 00 00 
+  804771:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804778:	00 00 00 
+  80477b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804782:	00 00 00 
+  804785:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478c:	00 00 00 
+  80478f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804796:	00 00 00 
+  804799:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a0:	00 00 00 
+  8047a3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047aa:	00 00 00 
+  8047ad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b4:	00 00 00 
+  8047b7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047be:	00 00 00 
+  8047c1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c8:	00 00 00 
+  8047cb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d2:	00 00 00 
+  8047d5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047dc:	00 00 00 
+  8047df:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e6:	00 00 00 
+  8047e9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f0:	00 00 00 
+  8047f3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047fa:	00 00 00 
+  8047fd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804804:	00 00 00 
+  804807:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480e:	00 00 00 
+  804811:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804818:	00 00 00 
+  80481b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804822:	00 00 00 
+  804825:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482c:	00 00 00 
+  80482f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804836:	00 00 00 
+  804839:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804840:	00 00 00 
+  804843:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484a:	00 00 00 
+  80484d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804854:	00 00 00 
+  804857:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485e:	00 00 00 
+  804861:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804868:	00 00 00 
+  80486b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804872:	00 00 00 
+  804875:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487c:	00 00 00 
+  80487f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804886:	00 00 00 
+  804889:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804890:	00 00 00 
+  804893:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489a:	00 00 00 
+  80489d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a4:	00 00 00 
+  8048a7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ae:	00 00 00 
+  8048b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b8:	00 00 00 
+  8048bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c2:	00 00 00 
+  8048c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048cc:	00 00 00 
+  8048cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d6:	00 00 00 
+  8048d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e0:	00 00 00 
+  8048e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ea:	00 00 00 
+  8048ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f4:	00 00 00 
+  8048f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fe:	00 00 00 
+  804901:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804908:	00 00 00 
+  80490b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804912:	00 00 00 
+  804915:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491c:	00 00 00 
+  80491f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804926:	00 00 00 
+  804929:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804930:	00 00 00 
+  804933:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493a:	00 00 00 
+  80493d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804944:	00 00 00 
+  804947:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494e:	00 00 00 
+  804951:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804958:	00 00 00 
+  80495b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804962:	00 00 00 
+  804965:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496c:	00 00 00 
+  80496f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804976:	00 00 00 
+  804979:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804980:	00 00 00 
+  804983:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498a:	00 00 00 
+  80498d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804994:	00 00 00 
+  804997:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499e:	00 00 00 
+  8049a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a8:	00 00 00 
+  8049ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b2:	00 00 00 
+  8049b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049bc:	00 00 00 
+  8049bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c6:	00 00 00 
+  8049c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d0:	00 00 00 
+  8049d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049da:	00 00 00 
+  8049dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e4:	00 00 00 
+  8049e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ee:	00 00 00 
+  8049f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f8:	00 00 00 
+  8049fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a02:	00 00 00 
+  804a05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0c:	00 00 00 
+  804a0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a16:	00 00 00 
+  804a19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a20:	00 00 00 
+  804a23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2a:	00 00 00 
+  804a2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a34:	00 00 00 
+  804a37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3e:	00 00 00 
+  804a41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a48:	00 00 00 
+  804a4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a52:	00 00 00 
+  804a55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5c:	00 00 00 
+  804a5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a66:	00 00 00 
+  804a69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a70:	00 00 00 
+  804a73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7a:	00 00 00 
+  804a7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a84:	00 00 00 
+  804a87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8e:	00 00 00 
+  804a91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a98:	00 00 00 
+  804a9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa2:	00 00 00 
+  804aa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aac:	00 00 00 
+  804aaf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab6:	00 00 00 
+  804ab9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac0:	00 00 00 
+  804ac3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aca:	00 00 00 
+  804acd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad4:	00 00 00 
+  804ad7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ade:	00 00 00 
+  804ae1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae8:	00 00 00 
+  804aeb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af2:	00 00 00 
+  804af5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afc:	00 00 00 
+  804aff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b06:	00 00 00 
+  804b09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b10:	00 00 00 
+  804b13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1a:	00 00 00 
+  804b1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b24:	00 00 00 
+  804b27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2e:	00 00 00 
+  804b31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b38:	00 00 00 
+  804b3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b42:	00 00 00 
+  804b45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4c:	00 00 00 
+  804b4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b56:	00 00 00 
+  804b59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b60:	00 00 00 
+  804b63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6a:	00 00 00 
+  804b6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b74:	00 00 00 
+  804b77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7e:	00 00 00 
+  804b81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b88:	00 00 00 
+  804b8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b92:	00 00 00 
+  804b95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9c:	00 00 00 
+  804b9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba6:	00 00 00 
+  804ba9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb0:	00 00 00 
+  804bb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bba:	00 00 00 
+  804bbd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc4:	00 00 00 
+  804bc7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bce:	00 00 00 
+  804bd1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd8:	00 00 00 
+  804bdb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be2:	00 00 00 
+  804be5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bec:	00 00 00 
+  804bef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf6:	00 00 00 
+  804bf9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c00:	00 00 00 
+  804c03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0a:	00 00 00 
+  804c0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c14:	00 00 00 
+  804c17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1e:	00 00 00 
+  804c21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c28:	00 00 00 
+  804c2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c32:	00 00 00 
+  804c35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3c:	00 00 00 
+  804c3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c46:	00 00 00 
+  804c49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c50:	00 00 00 
+  804c53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5a:	00 00 00 
+  804c5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c64:	00 00 00 
+  804c67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6e:	00 00 00 
+  804c71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c78:	00 00 00 
+  804c7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c82:	00 00 00 
+  804c85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8c:	00 00 00 
+  804c8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c96:	00 00 00 
+  804c99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca0:	00 00 00 
+  804ca3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caa:	00 00 00 
+  804cad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb4:	00 00 00 
+  804cb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbe:	00 00 00 
+  804cc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc8:	00 00 00 
+  804ccb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd2:	00 00 00 
+  804cd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cdc:	00 00 00 
+  804cdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce6:	00 00 00 
+  804ce9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf0:	00 00 00 
+  804cf3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cfa:	00 00 00 
+  804cfd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d04:	00 00 00 
+  804d07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0e:	00 00 00 
+  804d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d18:	00 00 00 
+  804d1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d22:	00 00 00 
+  804d25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2c:	00 00 00 
+  804d2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d36:	00 00 00 
+  804d39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d40:	00 00 00 
+  804d43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4a:	00 00 00 
+  804d4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d54:	00 00 00 
+  804d57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5e:	00 00 00 
+  804d61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d68:	00 00 00 
+  804d6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d72:	00 00 00 
+  804d75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7c:	00 00 00 
+  804d7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d86:	00 00 00 
+  804d89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d90:	00 00 00 
+  804d93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9a:	00 00 00 
+  804d9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da4:	00 00 00 
+  804da7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dae:	00 00 00 
+  804db1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db8:	00 00 00 
+  804dbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc2:	00 00 00 
+  804dc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcc:	00 00 00 
+  804dcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd6:	00 00 00 
+  804dd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de0:	00 00 00 
+  804de3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dea:	00 00 00 
+  804ded:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df4:	00 00 00 
+  804df7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfe:	00 00 00 
+  804e01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e08:	00 00 00 
+  804e0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e12:	00 00 00 
+  804e15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1c:	00 00 00 
+  804e1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e26:	00 00 00 
+  804e29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e30:	00 00 00 
+  804e33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3a:	00 00 00 
+  804e3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e44:	00 00 00 
+  804e47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4e:	00 00 00 
+  804e51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e58:	00 00 00 
+  804e5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e62:	00 00 00 
+  804e65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6c:	00 00 00 
+  804e6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e76:	00 00 00 
+  804e79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e80:	00 00 00 
+  804e83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8a:	00 00 00 
+  804e8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e94:	00 00 00 
+  804e97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9e:	00 00 00 
+  804ea1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea8:	00 00 00 
+  804eab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb2:	00 00 00 
+  804eb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebc:	00 00 00 
+  804ebf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec6:	00 00 00 
+  804ec9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed0:	00 00 00 
+  804ed3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eda:	00 00 00 
+  804edd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee4:	00 00 00 
+  804ee7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eee:	00 00 00 
+  804ef1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef8:	00 00 00 
+  804efb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f02:	00 00 00 
+  804f05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0c:	00 00 00 
+  804f0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f16:	00 00 00 
+  804f19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f20:	00 00 00 
+  804f23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2a:	00 00 00 
+  804f2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f34:	00 00 00 
+  804f37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3e:	00 00 00 
+  804f41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f48:	00 00 00 
+  804f4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f52:	00 00 00 
+  804f55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5c:	00 00 00 
+  804f5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f66:	00 00 00 
+  804f69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f70:	00 00 00 
+  804f73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7a:	00 00 00 
+  804f7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f84:	00 00 00 
+  804f87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8e:	00 00 00 
+  804f91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f98:	00 00 00 
+  804f9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa2:	00 00 00 
+  804fa5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fac:	00 00 00 
+  804faf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb6:	00 00 00 
+  804fb9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc0:	00 00 00 
+  804fc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fca:	00 00 00 
+  804fcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd4:	00 00 00 
+  804fd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fde:	00 00 00 
+  804fe1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe8:	00 00 00 
+  804feb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff2:	00 00 00 
+  804ff5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffc:	00 00 00 
+  804fff:	90                   	nop
@@ -0,0 +1,8309 @@
+
+obj/user/testfile:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 95 0a 00 00       	call   800ab8 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <xopen>:
+const char *msg = "This is the NEW message of the day!\n\n";
+
+#define FVA ((struct Fd *)0xA000000)
+
+static int
+xopen(const char *path, int mode) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 83 ec 10          	sub    $0x10,%rsp
+  800030:	41 89 f4             	mov    %esi,%r12d
+    extern union Fsipc fsipcbuf;
+    envid_t fsenv;
+
+    strcpy(fsipcbuf.open.req_path, path);
+  800033:	48 89 fe             	mov    %rdi,%rsi
+  800036:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  80003d:	00 00 00 
+  800040:	48 89 df             	mov    %rbx,%rdi
+  800043:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  80004a:	00 00 00 
+  80004d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80004f:	44 89 a3 00 04 00 00 	mov    %r12d,0x400(%rbx)
+
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800056:	bf 03 00 00 00       	mov    $0x3,%edi
+  80005b:	48 b8 15 2a 80 00 00 	movabs $0x802a15,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	89 c7                	mov    %eax,%edi
+    size_t sz = PAGE_SIZE;
+  800069:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800070:	00 
+    ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, sz, PROT_RW);
+  800071:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800077:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80007c:	48 89 da             	mov    %rbx,%rdx
+  80007f:	be 01 00 00 00       	mov    $0x1,%esi
+  800084:	48 b8 72 29 80 00 00 	movabs $0x802972,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, FVA, &sz, NULL);
+  800090:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800095:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800099:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  80009e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a3:	48 b8 c2 27 80 00 00 	movabs $0x8027c2,%rax
+  8000aa:	00 00 00 
+  8000ad:	ff d0                	call   *%rax
+}
+  8000af:	48 83 c4 10          	add    $0x10,%rsp
+  8000b3:	5b                   	pop    %rbx
+  8000b4:	41 5c                	pop    %r12
+  8000b6:	5d                   	pop    %rbp
+  8000b7:	c3                   	ret
+
+00000000008000b8 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000b8:	55                   	push   %rbp
+  8000b9:	48 89 e5             	mov    %rsp,%rbp
+  8000bc:	41 55                	push   %r13
+  8000be:	41 54                	push   %r12
+  8000c0:	53                   	push   %rbx
+  8000c1:	48 81 ec b8 02 00 00 	sub    $0x2b8,%rsp
+    struct Fd fdcopy;
+    struct Stat st;
+    char buf[512];
+
+    /* We open files manually first, to avoid the FD layer */
+    if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  8000c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8000cd:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  8000d4:	00 00 00 
+  8000d7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000de:	00 00 00 
+  8000e1:	ff d0                	call   *%rax
+  8000e3:	48 63 c8             	movslq %eax,%rcx
+  8000e6:	48 85 c9             	test   %rcx,%rcx
+  8000e9:	0f 89 7a 05 00 00    	jns    800669 <umain+0x5b1>
+  8000ef:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  8000f3:	0f 85 45 05 00 00    	jne    80063e <umain+0x586>
+        panic("serve_open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("serve_open /not-found succeeded!");
+
+    if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8000fe:	48 bf 36 50 80 00 00 	movabs $0x805036,%rdi
+  800105:	00 00 00 
+  800108:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+  800114:	48 63 c8             	movslq %eax,%rcx
+  800117:	48 85 c9             	test   %rcx,%rcx
+  80011a:	0f 88 73 05 00 00    	js     800693 <umain+0x5db>
+        panic("serve_open /newmotd: %ld", (long)r);
+    if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  800120:	83 3c 25 00 00 00 0a 	cmpl   $0x66,0xa000000
+  800127:	66 
+  800128:	0f 85 90 05 00 00    	jne    8006be <umain+0x606>
+  80012e:	83 3c 25 04 00 00 0a 	cmpl   $0x0,0xa000004
+  800135:	00 
+  800136:	0f 85 82 05 00 00    	jne    8006be <umain+0x606>
+  80013c:	83 3c 25 08 00 00 0a 	cmpl   $0x0,0xa000008
+  800143:	00 
+  800144:	0f 85 74 05 00 00    	jne    8006be <umain+0x606>
+        panic("serve_open did not fill struct Fd correctly\n");
+    cprintf("serve_open is good\n");
+  80014a:	48 bf 58 50 80 00 00 	movabs $0x805058,%rdi
+  800151:	00 00 00 
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	48 ba d4 0c 80 00 00 	movabs $0x800cd4,%rdx
+  800160:	00 00 00 
+  800163:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  800165:	48 8d b5 38 ff ff ff 	lea    -0xc8(%rbp),%rsi
+  80016c:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800171:	48 a1 48 60 80 00 00 	movabs 0x806048,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+  80017d:	48 63 c8             	movslq %eax,%rcx
+  800180:	48 85 c9             	test   %rcx,%rcx
+  800183:	0f 88 5f 05 00 00    	js     8006e8 <umain+0x630>
+        panic("file_stat: %ld", (long)r);
+    if (strlen(msg) != st.st_size)
+  800189:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800190:	00 00 00 
+  800193:	48 8b 38             	mov    (%rax),%rdi
+  800196:	48 b8 0e 16 80 00 00 	movabs $0x80160e,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+  8001a2:	48 89 c2             	mov    %rax,%rdx
+  8001a5:	48 63 45 b8          	movslq -0x48(%rbp),%rax
+  8001a9:	48 39 c2             	cmp    %rax,%rdx
+  8001ac:	0f 85 61 05 00 00    	jne    800713 <umain+0x65b>
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+    cprintf("file_stat is good\n");
+  8001b2:	48 bf 7b 50 80 00 00 	movabs $0x80507b,%rdi
+  8001b9:	00 00 00 
+  8001bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c1:	48 ba d4 0c 80 00 00 	movabs $0x800cd4,%rdx
+  8001c8:	00 00 00 
+  8001cb:	ff d2                	call   *%rdx
+
+    memset(buf, 0, sizeof buf);
+  8001cd:	ba 00 02 00 00       	mov    $0x200,%edx
+  8001d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d7:	48 8d bd 38 fd ff ff 	lea    -0x2c8(%rbp),%rdi
+  8001de:	48 b8 2c 19 80 00 00 	movabs $0x80192c,%rax
+  8001e5:	00 00 00 
+  8001e8:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8001ea:	ba 00 02 00 00       	mov    $0x200,%edx
+  8001ef:	48 8d b5 38 fd ff ff 	lea    -0x2c8(%rbp),%rsi
+  8001f6:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8001fb:	48 a1 30 60 80 00 00 	movabs 0x806030,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+  800207:	48 85 c0             	test   %rax,%rax
+  80020a:	0f 88 4e 05 00 00    	js     80075e <umain+0x6a6>
+        panic("file_read: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  800210:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800217:	00 00 00 
+  80021a:	48 8b 30             	mov    (%rax),%rsi
+  80021d:	48 8d bd 38 fd ff ff 	lea    -0x2c8(%rbp),%rdi
+  800224:	48 b8 f0 16 80 00 00 	movabs $0x8016f0,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+  800230:	85 c0                	test   %eax,%eax
+  800232:	0f 85 54 05 00 00    	jne    80078c <umain+0x6d4>
+        panic("file_read returned wrong data");
+    cprintf("file_read is good\n");
+  800238:	48 bf bb 50 80 00 00 	movabs $0x8050bb,%rdi
+  80023f:	00 00 00 
+  800242:	b8 00 00 00 00       	mov    $0x0,%eax
+  800247:	48 ba d4 0c 80 00 00 	movabs $0x800cd4,%rdx
+  80024e:	00 00 00 
+  800251:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_close(FVA)) < 0)
+  800253:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800258:	48 a1 40 60 80 00 00 	movabs 0x806040,%rax
+  80025f:	00 00 00 
+  800262:	ff d0                	call   *%rax
+  800264:	48 63 c8             	movslq %eax,%rcx
+  800267:	48 85 c9             	test   %rcx,%rcx
+  80026a:	0f 88 46 05 00 00    	js     8007b6 <umain+0x6fe>
+        panic("file_close: %ld", (long)r);
+    cprintf("file_close is good\n");
+  800270:	48 bf de 50 80 00 00 	movabs $0x8050de,%rdi
+  800277:	00 00 00 
+  80027a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027f:	48 ba d4 0c 80 00 00 	movabs $0x800cd4,%rdx
+  800286:	00 00 00 
+  800289:	ff d2                	call   *%rdx
+
+    /* We're about to unmap the FD, but still need a way to get
+     * the stale filenum to serve_read, so we make a local copy.
+     * The file server won't think it's stale until we unmap the
+     * FD page. */
+    fdcopy = *FVA;
+  80028b:	48 8b 04 25 00 00 00 	mov    0xa000000,%rax
+  800292:	0a 
+  800293:	48 89 45 cc          	mov    %rax,-0x34(%rbp)
+  800297:	48 8b 04 25 08 00 00 	mov    0xa000008,%rax
+  80029e:	0a 
+  80029f:	48 89 45 d4          	mov    %rax,-0x2c(%rbp)
+  8002a3:	8b 04 25 10 00 00 0a 	mov    0xa000010,%eax
+  8002aa:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    sys_unmap_region(0, FVA, PAGE_SIZE);
+  8002ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8002b2:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  8002b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002bc:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  8002c3:	00 00 00 
+  8002c6:	ff d0                	call   *%rax
+
+    if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8002c8:	ba 00 02 00 00       	mov    $0x200,%edx
+  8002cd:	48 8d b5 38 fd ff ff 	lea    -0x2c8(%rbp),%rsi
+  8002d4:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  8002d8:	48 a1 30 60 80 00 00 	movabs 0x806030,%rax
+  8002df:	00 00 00 
+  8002e2:	ff d0                	call   *%rax
+  8002e4:	48 83 f8 fd          	cmp    $0xfffffffffffffffd,%rax
+  8002e8:	0f 85 f3 04 00 00    	jne    8007e1 <umain+0x729>
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+    cprintf("stale fileid is good\n");
+  8002ee:	48 bf f2 50 80 00 00 	movabs $0x8050f2,%rdi
+  8002f5:	00 00 00 
+  8002f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fd:	48 ba d4 0c 80 00 00 	movabs $0x800cd4,%rdx
+  800304:	00 00 00 
+  800307:	ff d2                	call   *%rdx
+
+    /* Try writing */
+    if ((r = xopen("/new-file", O_RDWR | O_CREAT)) < 0)
+  800309:	be 02 01 00 00       	mov    $0x102,%esi
+  80030e:	48 bf 08 51 80 00 00 	movabs $0x805108,%rdi
+  800315:	00 00 00 
+  800318:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	48 63 c8             	movslq %eax,%rcx
+  800327:	48 85 c9             	test   %rcx,%rcx
+  80032a:	0f 88 df 04 00 00    	js     80080f <umain+0x757>
+        panic("serve_open /new-file: %ld", (long)r);
+
+    if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  800330:	48 b8 38 60 80 00 00 	movabs $0x806038,%rax
+  800337:	00 00 00 
+  80033a:	48 8b 18             	mov    (%rax),%rbx
+  80033d:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800344:	00 00 00 
+  800347:	49 8b 3c 24          	mov    (%r12),%rdi
+  80034b:	49 bd 0e 16 80 00 00 	movabs $0x80160e,%r13
+  800352:	00 00 00 
+  800355:	41 ff d5             	call   *%r13
+  800358:	48 89 c2             	mov    %rax,%rdx
+  80035b:	49 8b 34 24          	mov    (%r12),%rsi
+  80035f:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800364:	ff d3                	call   *%rbx
+  800366:	48 89 c3             	mov    %rax,%rbx
+  800369:	49 8b 3c 24          	mov    (%r12),%rdi
+  80036d:	41 ff d5             	call   *%r13
+  800370:	48 39 c3             	cmp    %rax,%rbx
+  800373:	0f 85 c1 04 00 00    	jne    80083a <umain+0x782>
+        panic("file_write: %ld", (long)r);
+    cprintf("file_write is good\n");
+  800379:	48 bf 3c 51 80 00 00 	movabs $0x80513c,%rdi
+  800380:	00 00 00 
+  800383:	b8 00 00 00 00       	mov    $0x0,%eax
+  800388:	48 ba d4 0c 80 00 00 	movabs $0x800cd4,%rdx
+  80038f:	00 00 00 
+  800392:	ff d2                	call   *%rdx
+
+    FVA->fd_offset = 0;
+  800394:	c7 04 25 04 00 00 0a 	movl   $0x0,0xa000004
+  80039b:	00 00 00 00 
+    memset(buf, 0, sizeof buf);
+  80039f:	ba 00 02 00 00       	mov    $0x200,%edx
+  8003a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a9:	48 8d bd 38 fd ff ff 	lea    -0x2c8(%rbp),%rdi
+  8003b0:	48 b8 2c 19 80 00 00 	movabs $0x80192c,%rax
+  8003b7:	00 00 00 
+  8003ba:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8003bc:	ba 00 02 00 00       	mov    $0x200,%edx
+  8003c1:	48 8d b5 38 fd ff ff 	lea    -0x2c8(%rbp),%rsi
+  8003c8:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8003cd:	48 a1 30 60 80 00 00 	movabs 0x806030,%rax
+  8003d4:	00 00 00 
+  8003d7:	ff d0                	call   *%rax
+  8003d9:	48 89 c3             	mov    %rax,%rbx
+  8003dc:	48 85 c0             	test   %rax,%rax
+  8003df:	0f 88 83 04 00 00    	js     800868 <umain+0x7b0>
+        panic("file_read after file_write: %ld", (long)r);
+    if (r != strlen(msg))
+  8003e5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8003ec:	00 00 00 
+  8003ef:	48 8b 38             	mov    (%rax),%rdi
+  8003f2:	48 b8 0e 16 80 00 00 	movabs $0x80160e,%rax
+  8003f9:	00 00 00 
+  8003fc:	ff d0                	call   *%rax
+  8003fe:	48 39 d8             	cmp    %rbx,%rax
+  800401:	0f 85 8f 04 00 00    	jne    800896 <umain+0x7de>
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  800407:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80040e:	00 00 00 
+  800411:	48 8b 30             	mov    (%rax),%rsi
+  800414:	48 8d bd 38 fd ff ff 	lea    -0x2c8(%rbp),%rdi
+  80041b:	48 b8 f0 16 80 00 00 	movabs $0x8016f0,%rax
+  800422:	00 00 00 
+  800425:	ff d0                	call   *%rax
+  800427:	85 c0                	test   %eax,%eax
+  800429:	0f 85 95 04 00 00    	jne    8008c4 <umain+0x80c>
+        panic("file_read after file_write returned wrong data");
+    cprintf("file_read after file_write is good\n");
+  80042f:	48 bf 10 53 80 00 00 	movabs $0x805310,%rdi
+  800436:	00 00 00 
+  800439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043e:	48 ba d4 0c 80 00 00 	movabs $0x800cd4,%rdx
+  800445:	00 00 00 
+  800448:	ff d2                	call   *%rdx
+
+    /* Now we'll try out open */
+    if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80044a:	be 00 00 00 00       	mov    $0x0,%esi
+  80044f:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  800456:	00 00 00 
+  800459:	48 b8 df 3d 80 00 00 	movabs $0x803ddf,%rax
+  800460:	00 00 00 
+  800463:	ff d0                	call   *%rax
+  800465:	48 63 c8             	movslq %eax,%rcx
+  800468:	48 85 c9             	test   %rcx,%rcx
+  80046b:	0f 89 a8 04 00 00    	jns    800919 <umain+0x861>
+  800471:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  800475:	0f 85 73 04 00 00    	jne    8008ee <umain+0x836>
+        panic("open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("open /not-found succeeded!");
+
+    if ((r = open("/newmotd", O_RDONLY)) < 0)
+  80047b:	be 00 00 00 00       	mov    $0x0,%esi
+  800480:	48 bf 36 50 80 00 00 	movabs $0x805036,%rdi
+  800487:	00 00 00 
+  80048a:	48 b8 df 3d 80 00 00 	movabs $0x803ddf,%rax
+  800491:	00 00 00 
+  800494:	ff d0                	call   *%rax
+  800496:	48 98                	cltq
+  800498:	48 85 c0             	test   %rax,%rax
+  80049b:	0f 88 a2 04 00 00    	js     800943 <umain+0x88b>
+        panic("open /newmotd: %ld", (long)r);
+    fd = (struct Fd *)(0xD0000000 + r * PAGE_SIZE);
+  8004a1:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8004a7:	48 c1 e0 0c          	shl    $0xc,%rax
+    if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  8004ab:	83 38 66             	cmpl   $0x66,(%rax)
+  8004ae:	0f 85 bd 04 00 00    	jne    800971 <umain+0x8b9>
+  8004b4:	83 78 04 00          	cmpl   $0x0,0x4(%rax)
+  8004b8:	0f 85 b3 04 00 00    	jne    800971 <umain+0x8b9>
+  8004be:	83 78 08 00          	cmpl   $0x0,0x8(%rax)
+  8004c2:	0f 85 a9 04 00 00    	jne    800971 <umain+0x8b9>
+        panic("open did not fill struct Fd correctly\n");
+    cprintf("open is good\n");
+  8004c8:	48 bf 5e 50 80 00 00 	movabs $0x80505e,%rdi
+  8004cf:	00 00 00 
+  8004d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d7:	48 ba d4 0c 80 00 00 	movabs $0x800cd4,%rdx
+  8004de:	00 00 00 
+  8004e1:	ff d2                	call   *%rdx
+
+    /* Try files with indirect blocks */
+    if ((f = open("/big", O_WRONLY | O_CREAT)) < 0)
+  8004e3:	be 01 01 00 00       	mov    $0x101,%esi
+  8004e8:	48 bf 6b 51 80 00 00 	movabs $0x80516b,%rdi
+  8004ef:	00 00 00 
+  8004f2:	48 b8 df 3d 80 00 00 	movabs $0x803ddf,%rax
+  8004f9:	00 00 00 
+  8004fc:	ff d0                	call   *%rax
+  8004fe:	41 89 c4             	mov    %eax,%r12d
+  800501:	48 63 c8             	movslq %eax,%rcx
+  800504:	48 85 c9             	test   %rcx,%rcx
+  800507:	0f 88 8e 04 00 00    	js     80099b <umain+0x8e3>
+        panic("creat /big: %ld", (long)f);
+    memset(buf, 0, sizeof(buf));
+  80050d:	ba 00 02 00 00       	mov    $0x200,%edx
+  800512:	be 00 00 00 00       	mov    $0x0,%esi
+  800517:	48 8d bd 38 fd ff ff 	lea    -0x2c8(%rbp),%rdi
+  80051e:	48 b8 2c 19 80 00 00 	movabs $0x80192c,%rax
+  800525:	00 00 00 
+  800528:	ff d0                	call   *%rax
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  80052a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  80052f:	49 bd 05 2f 80 00 00 	movabs $0x802f05,%r13
+  800536:	00 00 00 
+        *(int *)buf = i;
+  800539:	89 9d 38 fd ff ff    	mov    %ebx,-0x2c8(%rbp)
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  80053f:	ba 00 02 00 00       	mov    $0x200,%edx
+  800544:	48 8d b5 38 fd ff ff 	lea    -0x2c8(%rbp),%rsi
+  80054b:	44 89 e7             	mov    %r12d,%edi
+  80054e:	41 ff d5             	call   *%r13
+  800551:	48 85 c0             	test   %rax,%rax
+  800554:	0f 88 6c 04 00 00    	js     8009c6 <umain+0x90e>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  80055a:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  800561:	48 89 c3             	mov    %rax,%rbx
+  800564:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  80056a:	75 cd                	jne    800539 <umain+0x481>
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+    }
+    close(f);
+  80056c:	44 89 e7             	mov    %r12d,%edi
+  80056f:	48 b8 58 2c 80 00 00 	movabs $0x802c58,%rax
+  800576:	00 00 00 
+  800579:	ff d0                	call   *%rax
+
+    if ((f = open("/big", O_RDONLY)) < 0)
+  80057b:	be 00 00 00 00       	mov    $0x0,%esi
+  800580:	48 bf 6b 51 80 00 00 	movabs $0x80516b,%rdi
+  800587:	00 00 00 
+  80058a:	48 b8 df 3d 80 00 00 	movabs $0x803ddf,%rax
+  800591:	00 00 00 
+  800594:	ff d0                	call   *%rax
+  800596:	41 89 c4             	mov    %eax,%r12d
+  800599:	48 63 c8             	movslq %eax,%rcx
+  80059c:	48 85 c9             	test   %rcx,%rcx
+  80059f:	0f 88 52 04 00 00    	js     8009f7 <umain+0x93f>
+        panic("open /big: %ld", (long)f);
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  8005a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  8005aa:	49 bd 94 2e 80 00 00 	movabs $0x802e94,%r13
+  8005b1:	00 00 00 
+        *(int *)buf = i;
+  8005b4:	89 9d 38 fd ff ff    	mov    %ebx,-0x2c8(%rbp)
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  8005ba:	ba 00 02 00 00       	mov    $0x200,%edx
+  8005bf:	48 8d b5 38 fd ff ff 	lea    -0x2c8(%rbp),%rsi
+  8005c6:	44 89 e7             	mov    %r12d,%edi
+  8005c9:	41 ff d5             	call   *%r13
+  8005cc:	48 85 c0             	test   %rax,%rax
+  8005cf:	0f 88 4d 04 00 00    	js     800a22 <umain+0x96a>
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+        if (r != sizeof(buf))
+  8005d5:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  8005db:	0f 85 72 04 00 00    	jne    800a53 <umain+0x99b>
+            panic("read /big from %ld returned %ld < %d bytes",
+                  (long)i, (long)r, (uint32_t)sizeof(buf));
+        if (*(int *)buf != i)
+  8005e1:	44 8b 85 38 fd ff ff 	mov    -0x2c8(%rbp),%r8d
+  8005e8:	49 63 c0             	movslq %r8d,%rax
+  8005eb:	48 39 d8             	cmp    %rbx,%rax
+  8005ee:	0f 85 96 04 00 00    	jne    800a8a <umain+0x9d2>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  8005f4:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  8005fb:	48 89 c3             	mov    %rax,%rbx
+  8005fe:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  800604:	75 ae                	jne    8005b4 <umain+0x4fc>
+            panic("read /big from %ld returned bad data %d",
+                  (long)i, *(int *)buf);
+    }
+    close(f);
+  800606:	44 89 e7             	mov    %r12d,%edi
+  800609:	48 b8 58 2c 80 00 00 	movabs $0x802c58,%rax
+  800610:	00 00 00 
+  800613:	ff d0                	call   *%rax
+    cprintf("large file is good\n");
+  800615:	48 bf b6 51 80 00 00 	movabs $0x8051b6,%rdi
+  80061c:	00 00 00 
+  80061f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800624:	48 ba d4 0c 80 00 00 	movabs $0x800cd4,%rdx
+  80062b:	00 00 00 
+  80062e:	ff d2                	call   *%rdx
+}
+  800630:	48 81 c4 b8 02 00 00 	add    $0x2b8,%rsp
+  800637:	5b                   	pop    %rbx
+  800638:	41 5c                	pop    %r12
+  80063a:	41 5d                	pop    %r13
+  80063c:	5d                   	pop    %rbp
+  80063d:	c3                   	ret
+        panic("serve_open /not-found: %ld", (long)r);
+  80063e:	48 ba 0b 50 80 00 00 	movabs $0x80500b,%rdx
+  800645:	00 00 00 
+  800648:	be 1f 00 00 00       	mov    $0x1f,%esi
+  80064d:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800654:	00 00 00 
+  800657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065c:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  800663:	00 00 00 
+  800666:	41 ff d0             	call   *%r8
+        panic("serve_open /not-found succeeded!");
+  800669:	48 ba d0 51 80 00 00 	movabs $0x8051d0,%rdx
+  800670:	00 00 00 
+  800673:	be 21 00 00 00       	mov    $0x21,%esi
+  800678:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  80067f:	00 00 00 
+  800682:	b8 00 00 00 00       	mov    $0x0,%eax
+  800687:	48 b9 84 0b 80 00 00 	movabs $0x800b84,%rcx
+  80068e:	00 00 00 
+  800691:	ff d1                	call   *%rcx
+        panic("serve_open /newmotd: %ld", (long)r);
+  800693:	48 ba 3f 50 80 00 00 	movabs $0x80503f,%rdx
+  80069a:	00 00 00 
+  80069d:	be 24 00 00 00       	mov    $0x24,%esi
+  8006a2:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8006a9:	00 00 00 
+  8006ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b1:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  8006b8:	00 00 00 
+  8006bb:	41 ff d0             	call   *%r8
+        panic("serve_open did not fill struct Fd correctly\n");
+  8006be:	48 ba f8 51 80 00 00 	movabs $0x8051f8,%rdx
+  8006c5:	00 00 00 
+  8006c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8006cd:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8006d4:	00 00 00 
+  8006d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006dc:	48 b9 84 0b 80 00 00 	movabs $0x800b84,%rcx
+  8006e3:	00 00 00 
+  8006e6:	ff d1                	call   *%rcx
+        panic("file_stat: %ld", (long)r);
+  8006e8:	48 ba 6c 50 80 00 00 	movabs $0x80506c,%rdx
+  8006ef:	00 00 00 
+  8006f2:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8006f7:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8006fe:	00 00 00 
+  800701:	b8 00 00 00 00       	mov    $0x0,%eax
+  800706:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  80070d:	00 00 00 
+  800710:	41 ff d0             	call   *%r8
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+  800713:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80071a:	00 00 00 
+  80071d:	48 8b 38             	mov    (%rax),%rdi
+  800720:	48 b8 0e 16 80 00 00 	movabs $0x80160e,%rax
+  800727:	00 00 00 
+  80072a:	ff d0                	call   *%rax
+  80072c:	49 89 c0             	mov    %rax,%r8
+  80072f:	48 63 4d b8          	movslq -0x48(%rbp),%rcx
+  800733:	48 ba 28 52 80 00 00 	movabs $0x805228,%rdx
+  80073a:	00 00 00 
+  80073d:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800742:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800749:	00 00 00 
+  80074c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800751:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  800758:	00 00 00 
+  80075b:	41 ff d1             	call   *%r9
+        panic("file_read: %ld", (long)r);
+  80075e:	48 89 c1             	mov    %rax,%rcx
+  800761:	48 ba 8e 50 80 00 00 	movabs $0x80508e,%rdx
+  800768:	00 00 00 
+  80076b:	be 31 00 00 00       	mov    $0x31,%esi
+  800770:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800777:	00 00 00 
+  80077a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077f:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  800786:	00 00 00 
+  800789:	41 ff d0             	call   *%r8
+        panic("file_read returned wrong data");
+  80078c:	48 ba 9d 50 80 00 00 	movabs $0x80509d,%rdx
+  800793:	00 00 00 
+  800796:	be 33 00 00 00       	mov    $0x33,%esi
+  80079b:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8007a2:	00 00 00 
+  8007a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007aa:	48 b9 84 0b 80 00 00 	movabs $0x800b84,%rcx
+  8007b1:	00 00 00 
+  8007b4:	ff d1                	call   *%rcx
+        panic("file_close: %ld", (long)r);
+  8007b6:	48 ba ce 50 80 00 00 	movabs $0x8050ce,%rdx
+  8007bd:	00 00 00 
+  8007c0:	be 37 00 00 00       	mov    $0x37,%esi
+  8007c5:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8007cc:	00 00 00 
+  8007cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d4:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  8007db:	00 00 00 
+  8007de:	41 ff d0             	call   *%r8
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+  8007e1:	48 89 c1             	mov    %rax,%rcx
+  8007e4:	48 ba 50 52 80 00 00 	movabs $0x805250,%rdx
+  8007eb:	00 00 00 
+  8007ee:	be 42 00 00 00       	mov    $0x42,%esi
+  8007f3:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8007fa:	00 00 00 
+  8007fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800802:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  800809:	00 00 00 
+  80080c:	41 ff d0             	call   *%r8
+        panic("serve_open /new-file: %ld", (long)r);
+  80080f:	48 ba 12 51 80 00 00 	movabs $0x805112,%rdx
+  800816:	00 00 00 
+  800819:	be 47 00 00 00       	mov    $0x47,%esi
+  80081e:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800825:	00 00 00 
+  800828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082d:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  800834:	00 00 00 
+  800837:	41 ff d0             	call   *%r8
+        panic("file_write: %ld", (long)r);
+  80083a:	48 89 d9             	mov    %rbx,%rcx
+  80083d:	48 ba 2c 51 80 00 00 	movabs $0x80512c,%rdx
+  800844:	00 00 00 
+  800847:	be 4a 00 00 00       	mov    $0x4a,%esi
+  80084c:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800853:	00 00 00 
+  800856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085b:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  800862:	00 00 00 
+  800865:	41 ff d0             	call   *%r8
+        panic("file_read after file_write: %ld", (long)r);
+  800868:	48 89 c1             	mov    %rax,%rcx
+  80086b:	48 ba 88 52 80 00 00 	movabs $0x805288,%rdx
+  800872:	00 00 00 
+  800875:	be 50 00 00 00       	mov    $0x50,%esi
+  80087a:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800881:	00 00 00 
+  800884:	b8 00 00 00 00       	mov    $0x0,%eax
+  800889:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  800890:	00 00 00 
+  800893:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+  800896:	48 89 d9             	mov    %rbx,%rcx
+  800899:	48 ba a8 52 80 00 00 	movabs $0x8052a8,%rdx
+  8008a0:	00 00 00 
+  8008a3:	be 52 00 00 00       	mov    $0x52,%esi
+  8008a8:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8008af:	00 00 00 
+  8008b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b7:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  8008be:	00 00 00 
+  8008c1:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong data");
+  8008c4:	48 ba e0 52 80 00 00 	movabs $0x8052e0,%rdx
+  8008cb:	00 00 00 
+  8008ce:	be 54 00 00 00       	mov    $0x54,%esi
+  8008d3:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8008da:	00 00 00 
+  8008dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e2:	48 b9 84 0b 80 00 00 	movabs $0x800b84,%rcx
+  8008e9:	00 00 00 
+  8008ec:	ff d1                	call   *%rcx
+        panic("open /not-found: %ld", (long)r);
+  8008ee:	48 ba 11 50 80 00 00 	movabs $0x805011,%rdx
+  8008f5:	00 00 00 
+  8008f8:	be 59 00 00 00       	mov    $0x59,%esi
+  8008fd:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800904:	00 00 00 
+  800907:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090c:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  800913:	00 00 00 
+  800916:	41 ff d0             	call   *%r8
+        panic("open /not-found succeeded!");
+  800919:	48 ba 50 51 80 00 00 	movabs $0x805150,%rdx
+  800920:	00 00 00 
+  800923:	be 5b 00 00 00       	mov    $0x5b,%esi
+  800928:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  80092f:	00 00 00 
+  800932:	b8 00 00 00 00       	mov    $0x0,%eax
+  800937:	48 b9 84 0b 80 00 00 	movabs $0x800b84,%rcx
+  80093e:	00 00 00 
+  800941:	ff d1                	call   *%rcx
+        panic("open /newmotd: %ld", (long)r);
+  800943:	48 89 c1             	mov    %rax,%rcx
+  800946:	48 ba 45 50 80 00 00 	movabs $0x805045,%rdx
+  80094d:	00 00 00 
+  800950:	be 5e 00 00 00       	mov    $0x5e,%esi
+  800955:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  80095c:	00 00 00 
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800964:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  80096b:	00 00 00 
+  80096e:	41 ff d0             	call   *%r8
+        panic("open did not fill struct Fd correctly\n");
+  800971:	48 ba 38 53 80 00 00 	movabs $0x805338,%rdx
+  800978:	00 00 00 
+  80097b:	be 61 00 00 00       	mov    $0x61,%esi
+  800980:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800987:	00 00 00 
+  80098a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098f:	48 b9 84 0b 80 00 00 	movabs $0x800b84,%rcx
+  800996:	00 00 00 
+  800999:	ff d1                	call   *%rcx
+        panic("creat /big: %ld", (long)f);
+  80099b:	48 ba 70 51 80 00 00 	movabs $0x805170,%rdx
+  8009a2:	00 00 00 
+  8009a5:	be 66 00 00 00       	mov    $0x66,%esi
+  8009aa:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8009b1:	00 00 00 
+  8009b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b9:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  8009c0:	00 00 00 
+  8009c3:	41 ff d0             	call   *%r8
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+  8009c6:	49 89 c0             	mov    %rax,%r8
+  8009c9:	48 89 d9             	mov    %rbx,%rcx
+  8009cc:	48 ba 80 51 80 00 00 	movabs $0x805180,%rdx
+  8009d3:	00 00 00 
+  8009d6:	be 6b 00 00 00       	mov    $0x6b,%esi
+  8009db:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  8009e2:	00 00 00 
+  8009e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ea:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  8009f1:	00 00 00 
+  8009f4:	41 ff d1             	call   *%r9
+        panic("open /big: %ld", (long)f);
+  8009f7:	48 ba 94 51 80 00 00 	movabs $0x805194,%rdx
+  8009fe:	00 00 00 
+  800a01:	be 70 00 00 00       	mov    $0x70,%esi
+  800a06:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800a0d:	00 00 00 
+  800a10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a15:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  800a1c:	00 00 00 
+  800a1f:	41 ff d0             	call   *%r8
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+  800a22:	49 89 c0             	mov    %rax,%r8
+  800a25:	48 89 d9             	mov    %rbx,%rcx
+  800a28:	48 ba a3 51 80 00 00 	movabs $0x8051a3,%rdx
+  800a2f:	00 00 00 
+  800a32:	be 74 00 00 00       	mov    $0x74,%esi
+  800a37:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800a3e:	00 00 00 
+  800a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a46:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  800a4d:	00 00 00 
+  800a50:	41 ff d1             	call   *%r9
+            panic("read /big from %ld returned %ld < %d bytes",
+  800a53:	41 b9 00 02 00 00    	mov    $0x200,%r9d
+  800a59:	49 89 c0             	mov    %rax,%r8
+  800a5c:	48 89 d9             	mov    %rbx,%rcx
+  800a5f:	48 ba 60 53 80 00 00 	movabs $0x805360,%rdx
+  800a66:	00 00 00 
+  800a69:	be 76 00 00 00       	mov    $0x76,%esi
+  800a6e:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800a75:	00 00 00 
+  800a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7d:	49 ba 84 0b 80 00 00 	movabs $0x800b84,%r10
+  800a84:	00 00 00 
+  800a87:	41 ff d2             	call   *%r10
+            panic("read /big from %ld returned bad data %d",
+  800a8a:	48 89 d9             	mov    %rbx,%rcx
+  800a8d:	48 ba 90 53 80 00 00 	movabs $0x805390,%rdx
+  800a94:	00 00 00 
+  800a97:	be 79 00 00 00       	mov    $0x79,%esi
+  800a9c:	48 bf 26 50 80 00 00 	movabs $0x805026,%rdi
+  800aa3:	00 00 00 
+  800aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aab:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  800ab2:	00 00 00 
+  800ab5:	41 ff d1             	call   *%r9
+
+0000000000800ab8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800ab8:	55                   	push   %rbp
+  800ab9:	48 89 e5             	mov    %rsp,%rbp
+  800abc:	41 56                	push   %r14
+  800abe:	41 55                	push   %r13
+  800ac0:	41 54                	push   %r12
+  800ac2:	53                   	push   %rbx
+  800ac3:	41 89 fd             	mov    %edi,%r13d
+  800ac6:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ac9:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800ad0:	00 00 00 
+  800ad3:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800ada:	00 00 00 
+  800add:	48 39 c2             	cmp    %rax,%rdx
+  800ae0:	73 17                	jae    800af9 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800ae2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ae5:	49 89 c4             	mov    %rax,%r12
+  800ae8:	48 83 c3 08          	add    $0x8,%rbx
+  800aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af1:	ff 53 f8             	call   *-0x8(%rbx)
+  800af4:	4c 39 e3             	cmp    %r12,%rbx
+  800af7:	72 ef                	jb     800ae8 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800af9:	48 b8 ec 1c 80 00 00 	movabs $0x801cec,%rax
+  800b00:	00 00 00 
+  800b03:	ff d0                	call   *%rax
+  800b05:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800b0a:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800b11:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800b18:	00 00 00 
+  800b1b:	48 01 d0             	add    %rdx,%rax
+  800b1e:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800b25:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800b28:	45 85 ed             	test   %r13d,%r13d
+  800b2b:	7e 0d                	jle    800b3a <libmain+0x82>
+  800b2d:	49 8b 06             	mov    (%r14),%rax
+  800b30:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800b37:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800b3a:	4c 89 f6             	mov    %r14,%rsi
+  800b3d:	44 89 ef             	mov    %r13d,%edi
+  800b40:	48 b8 b8 00 80 00 00 	movabs $0x8000b8,%rax
+  800b47:	00 00 00 
+  800b4a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800b4c:	48 b8 61 0b 80 00 00 	movabs $0x800b61,%rax
+  800b53:	00 00 00 
+  800b56:	ff d0                	call   *%rax
+#endif
+}
+  800b58:	5b                   	pop    %rbx
+  800b59:	41 5c                	pop    %r12
+  800b5b:	41 5d                	pop    %r13
+  800b5d:	41 5e                	pop    %r14
+  800b5f:	5d                   	pop    %rbp
+  800b60:	c3                   	ret
+
+0000000000800b61 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800b61:	55                   	push   %rbp
+  800b62:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800b65:	48 b8 8b 2c 80 00 00 	movabs $0x802c8b,%rax
+  800b6c:	00 00 00 
+  800b6f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800b71:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b76:	48 b8 81 1c 80 00 00 	movabs $0x801c81,%rax
+  800b7d:	00 00 00 
+  800b80:	ff d0                	call   *%rax
+}
+  800b82:	5d                   	pop    %rbp
+  800b83:	c3                   	ret
+
+0000000000800b84 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800b84:	55                   	push   %rbp
+  800b85:	48 89 e5             	mov    %rsp,%rbp
+  800b88:	41 56                	push   %r14
+  800b8a:	41 55                	push   %r13
+  800b8c:	41 54                	push   %r12
+  800b8e:	53                   	push   %rbx
+  800b8f:	48 83 ec 50          	sub    $0x50,%rsp
+  800b93:	49 89 fc             	mov    %rdi,%r12
+  800b96:	41 89 f5             	mov    %esi,%r13d
+  800b99:	48 89 d3             	mov    %rdx,%rbx
+  800b9c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800ba0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800ba4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ba8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800baf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bb3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800bb7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800bbb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800bbf:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800bc6:	00 00 00 
+  800bc9:	4c 8b 30             	mov    (%rax),%r14
+  800bcc:	48 b8 ec 1c 80 00 00 	movabs $0x801cec,%rax
+  800bd3:	00 00 00 
+  800bd6:	ff d0                	call   *%rax
+  800bd8:	89 c6                	mov    %eax,%esi
+  800bda:	45 89 e8             	mov    %r13d,%r8d
+  800bdd:	4c 89 e1             	mov    %r12,%rcx
+  800be0:	4c 89 f2             	mov    %r14,%rdx
+  800be3:	48 bf e8 53 80 00 00 	movabs $0x8053e8,%rdi
+  800bea:	00 00 00 
+  800bed:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf2:	49 bc d4 0c 80 00 00 	movabs $0x800cd4,%r12
+  800bf9:	00 00 00 
+  800bfc:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800bff:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800c03:	48 89 df             	mov    %rbx,%rdi
+  800c06:	48 b8 70 0c 80 00 00 	movabs $0x800c70,%rax
+  800c0d:	00 00 00 
+  800c10:	ff d0                	call   *%rax
+    cprintf("\n");
+  800c12:	48 bf cc 50 80 00 00 	movabs $0x8050cc,%rdi
+  800c19:	00 00 00 
+  800c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c21:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800c24:	cc                   	int3
+  800c25:	eb fd                	jmp    800c24 <_panic+0xa0>
+
+0000000000800c27 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800c27:	55                   	push   %rbp
+  800c28:	48 89 e5             	mov    %rsp,%rbp
+  800c2b:	53                   	push   %rbx
+  800c2c:	48 83 ec 08          	sub    $0x8,%rsp
+  800c30:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800c33:	8b 06                	mov    (%rsi),%eax
+  800c35:	8d 50 01             	lea    0x1(%rax),%edx
+  800c38:	89 16                	mov    %edx,(%rsi)
+  800c3a:	48 98                	cltq
+  800c3c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800c41:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800c47:	74 0a                	je     800c53 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800c49:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800c4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c51:	c9                   	leave
+  800c52:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800c53:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800c57:	be ff 00 00 00       	mov    $0xff,%esi
+  800c5c:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  800c63:	00 00 00 
+  800c66:	ff d0                	call   *%rax
+        state->offset = 0;
+  800c68:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800c6e:	eb d9                	jmp    800c49 <putch+0x22>
+
+0000000000800c70 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800c70:	55                   	push   %rbp
+  800c71:	48 89 e5             	mov    %rsp,%rbp
+  800c74:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800c7b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800c7e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800c85:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800c92:	48 89 f1             	mov    %rsi,%rcx
+  800c95:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800c9c:	48 bf 27 0c 80 00 00 	movabs $0x800c27,%rdi
+  800ca3:	00 00 00 
+  800ca6:	48 b8 24 0e 80 00 00 	movabs $0x800e24,%rax
+  800cad:	00 00 00 
+  800cb0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800cb2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800cb9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800cc0:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  800cc7:	00 00 00 
+  800cca:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800ccc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800cd2:	c9                   	leave
+  800cd3:	c3                   	ret
+
+0000000000800cd4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800cd4:	55                   	push   %rbp
+  800cd5:	48 89 e5             	mov    %rsp,%rbp
+  800cd8:	48 83 ec 50          	sub    $0x50,%rsp
+  800cdc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800ce0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800ce4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ce8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800cf0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800cf7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d03:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800d07:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800d0b:	48 b8 70 0c 80 00 00 	movabs $0x800c70,%rax
+  800d12:	00 00 00 
+  800d15:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800d17:	c9                   	leave
+  800d18:	c3                   	ret
+
+0000000000800d19 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800d19:	55                   	push   %rbp
+  800d1a:	48 89 e5             	mov    %rsp,%rbp
+  800d1d:	41 57                	push   %r15
+  800d1f:	41 56                	push   %r14
+  800d21:	41 55                	push   %r13
+  800d23:	41 54                	push   %r12
+  800d25:	53                   	push   %rbx
+  800d26:	48 83 ec 18          	sub    $0x18,%rsp
+  800d2a:	49 89 fc             	mov    %rdi,%r12
+  800d2d:	49 89 f5             	mov    %rsi,%r13
+  800d30:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d34:	8b 45 10             	mov    0x10(%rbp),%eax
+  800d37:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800d3a:	41 89 cf             	mov    %ecx,%r15d
+  800d3d:	4c 39 fa             	cmp    %r15,%rdx
+  800d40:	73 5b                	jae    800d9d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800d42:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800d46:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800d4a:	85 db                	test   %ebx,%ebx
+  800d4c:	7e 0e                	jle    800d5c <print_num+0x43>
+            putch(padc, put_arg);
+  800d4e:	4c 89 ee             	mov    %r13,%rsi
+  800d51:	44 89 f7             	mov    %r14d,%edi
+  800d54:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800d57:	83 eb 01             	sub    $0x1,%ebx
+  800d5a:	75 f2                	jne    800d4e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800d5c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800d60:	48 b9 1c 54 80 00 00 	movabs $0x80541c,%rcx
+  800d67:	00 00 00 
+  800d6a:	48 b8 0b 54 80 00 00 	movabs $0x80540b,%rax
+  800d71:	00 00 00 
+  800d74:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800d78:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d81:	49 f7 f7             	div    %r15
+  800d84:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800d88:	4c 89 ee             	mov    %r13,%rsi
+  800d8b:	41 ff d4             	call   *%r12
+}
+  800d8e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d92:	5b                   	pop    %rbx
+  800d93:	41 5c                	pop    %r12
+  800d95:	41 5d                	pop    %r13
+  800d97:	41 5e                	pop    %r14
+  800d99:	41 5f                	pop    %r15
+  800d9b:	5d                   	pop    %rbp
+  800d9c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800d9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800da1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da6:	49 f7 f7             	div    %r15
+  800da9:	48 83 ec 08          	sub    $0x8,%rsp
+  800dad:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800db1:	52                   	push   %rdx
+  800db2:	45 0f be c9          	movsbl %r9b,%r9d
+  800db6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800dba:	48 89 c2             	mov    %rax,%rdx
+  800dbd:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  800dc4:	00 00 00 
+  800dc7:	ff d0                	call   *%rax
+  800dc9:	48 83 c4 10          	add    $0x10,%rsp
+  800dcd:	eb 8d                	jmp    800d5c <print_num+0x43>
+
+0000000000800dcf <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800dcf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800dd3:	48 8b 06             	mov    (%rsi),%rax
+  800dd6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800dda:	73 0a                	jae    800de6 <sprintputch+0x17>
+        *state->start++ = ch;
+  800ddc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800de0:	48 89 16             	mov    %rdx,(%rsi)
+  800de3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800de6:	c3                   	ret
+
+0000000000800de7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800de7:	55                   	push   %rbp
+  800de8:	48 89 e5             	mov    %rsp,%rbp
+  800deb:	48 83 ec 50          	sub    $0x50,%rsp
+  800def:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800df3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800df7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800dfb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e02:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e0a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e0e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800e12:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e16:	48 b8 24 0e 80 00 00 	movabs $0x800e24,%rax
+  800e1d:	00 00 00 
+  800e20:	ff d0                	call   *%rax
+}
+  800e22:	c9                   	leave
+  800e23:	c3                   	ret
+
+0000000000800e24 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800e24:	55                   	push   %rbp
+  800e25:	48 89 e5             	mov    %rsp,%rbp
+  800e28:	41 57                	push   %r15
+  800e2a:	41 56                	push   %r14
+  800e2c:	41 55                	push   %r13
+  800e2e:	41 54                	push   %r12
+  800e30:	53                   	push   %rbx
+  800e31:	48 83 ec 38          	sub    $0x38,%rsp
+  800e35:	49 89 fe             	mov    %rdi,%r14
+  800e38:	49 89 f5             	mov    %rsi,%r13
+  800e3b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800e3e:	48 8b 01             	mov    (%rcx),%rax
+  800e41:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800e45:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800e49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e4d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800e51:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800e55:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800e59:	0f b6 3b             	movzbl (%rbx),%edi
+  800e5c:	40 80 ff 25          	cmp    $0x25,%dil
+  800e60:	74 18                	je     800e7a <vprintfmt+0x56>
+            if (!ch) return;
+  800e62:	40 84 ff             	test   %dil,%dil
+  800e65:	0f 84 04 07 00 00    	je     80156f <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800e6b:	40 0f b6 ff          	movzbl %dil,%edi
+  800e6f:	4c 89 ee             	mov    %r13,%rsi
+  800e72:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800e75:	4c 89 e3             	mov    %r12,%rbx
+  800e78:	eb db                	jmp    800e55 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800e7a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e7f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800e83:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800e88:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800e8e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800e95:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800e99:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800e9e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800ea3:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800ea6:	83 e8 23             	sub    $0x23,%eax
+  800ea9:	3c 57                	cmp    $0x57,%al
+  800eab:	0f 87 a4 06 00 00    	ja     801555 <vprintfmt+0x731>
+  800eb1:	0f b6 c0             	movzbl %al,%eax
+  800eb4:	48 b9 a0 55 80 00 00 	movabs $0x8055a0,%rcx
+  800ebb:	00 00 00 
+  800ebe:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800ec1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800ec4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800ec8:	eb cf                	jmp    800e99 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800eca:	49 89 dc             	mov    %rbx,%r12
+  800ecd:	be 01 00 00 00       	mov    $0x1,%esi
+  800ed2:	eb c5                	jmp    800e99 <vprintfmt+0x75>
+            padc = ch;
+  800ed4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800ed8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800edb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800ede:	eb b9                	jmp    800e99 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800ee0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ee3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ee6:	77 24                	ja     800f0c <vprintfmt+0xe8>
+  800ee8:	89 c1                	mov    %eax,%ecx
+  800eea:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800eee:	83 c0 08             	add    $0x8,%eax
+  800ef1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ef4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800ef7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800efa:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800efe:	79 99                	jns    800e99 <vprintfmt+0x75>
+                width = precision;
+  800f00:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800f04:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800f0a:	eb 8d                	jmp    800e99 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800f0c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800f10:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800f14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f18:	eb da                	jmp    800ef4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800f1a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800f1f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f23:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800f29:	3c 39                	cmp    $0x39,%al
+  800f2b:	77 1c                	ja     800f49 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800f2d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800f31:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800f35:	0f b6 c0             	movzbl %al,%eax
+  800f38:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f3d:	0f b6 03             	movzbl (%rbx),%eax
+  800f40:	3c 39                	cmp    $0x39,%al
+  800f42:	76 e9                	jbe    800f2d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800f44:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800f47:	eb b1                	jmp    800efa <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800f49:	49 89 dc             	mov    %rbx,%r12
+  800f4c:	eb ac                	jmp    800efa <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800f4e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800f51:	85 c9                	test   %ecx,%ecx
+  800f53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f58:	0f 49 c1             	cmovns %ecx,%eax
+  800f5b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800f5e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f61:	e9 33 ff ff ff       	jmp    800e99 <vprintfmt+0x75>
+            lflag++;
+  800f66:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800f69:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f6c:	e9 28 ff ff ff       	jmp    800e99 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800f71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f74:	83 f8 2f             	cmp    $0x2f,%eax
+  800f77:	77 19                	ja     800f92 <vprintfmt+0x16e>
+  800f79:	89 c2                	mov    %eax,%edx
+  800f7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f7f:	83 c0 08             	add    $0x8,%eax
+  800f82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f85:	8b 3a                	mov    (%rdx),%edi
+  800f87:	4c 89 ee             	mov    %r13,%rsi
+  800f8a:	41 ff d6             	call   *%r14
+            break;
+  800f8d:	e9 c3 fe ff ff       	jmp    800e55 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800f92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f9e:	eb e5                	jmp    800f85 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800fa0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fa3:	83 f8 2f             	cmp    $0x2f,%eax
+  800fa6:	77 5a                	ja     801002 <vprintfmt+0x1de>
+  800fa8:	89 c2                	mov    %eax,%edx
+  800faa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fae:	83 c0 08             	add    $0x8,%eax
+  800fb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800fb4:	8b 02                	mov    (%rdx),%eax
+  800fb6:	89 c1                	mov    %eax,%ecx
+  800fb8:	f7 d9                	neg    %ecx
+  800fba:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800fbd:	83 f9 13             	cmp    $0x13,%ecx
+  800fc0:	7f 4e                	jg     801010 <vprintfmt+0x1ec>
+  800fc2:	48 63 c1             	movslq %ecx,%rax
+  800fc5:	48 ba 60 58 80 00 00 	movabs $0x805860,%rdx
+  800fcc:	00 00 00 
+  800fcf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800fd3:	48 85 c0             	test   %rax,%rax
+  800fd6:	74 38                	je     801010 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800fd8:	48 89 c1             	mov    %rax,%rcx
+  800fdb:	48 ba b9 5a 80 00 00 	movabs $0x805ab9,%rdx
+  800fe2:	00 00 00 
+  800fe5:	4c 89 ee             	mov    %r13,%rsi
+  800fe8:	4c 89 f7             	mov    %r14,%rdi
+  800feb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff0:	49 b8 e7 0d 80 00 00 	movabs $0x800de7,%r8
+  800ff7:	00 00 00 
+  800ffa:	41 ff d0             	call   *%r8
+  800ffd:	e9 53 fe ff ff       	jmp    800e55 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801002:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801006:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80100a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80100e:	eb a4                	jmp    800fb4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801010:	48 ba 34 54 80 00 00 	movabs $0x805434,%rdx
+  801017:	00 00 00 
+  80101a:	4c 89 ee             	mov    %r13,%rsi
+  80101d:	4c 89 f7             	mov    %r14,%rdi
+  801020:	b8 00 00 00 00       	mov    $0x0,%eax
+  801025:	49 b8 e7 0d 80 00 00 	movabs $0x800de7,%r8
+  80102c:	00 00 00 
+  80102f:	41 ff d0             	call   *%r8
+  801032:	e9 1e fe ff ff       	jmp    800e55 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801037:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80103a:	83 f8 2f             	cmp    $0x2f,%eax
+  80103d:	77 36                	ja     801075 <vprintfmt+0x251>
+  80103f:	89 c2                	mov    %eax,%edx
+  801041:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801045:	83 c0 08             	add    $0x8,%eax
+  801048:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80104b:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80104e:	48 85 f6             	test   %rsi,%rsi
+  801051:	48 b8 2d 54 80 00 00 	movabs $0x80542d,%rax
+  801058:	00 00 00 
+  80105b:	48 0f 45 c6          	cmovne %rsi,%rax
+  80105f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801063:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801067:	7e 06                	jle    80106f <vprintfmt+0x24b>
+  801069:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80106d:	75 14                	jne    801083 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80106f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801073:	eb 5b                	jmp    8010d0 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  801075:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801079:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80107d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801081:	eb c8                	jmp    80104b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  801083:	49 63 f7             	movslq %r15d,%rsi
+  801086:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80108a:	48 b8 29 16 80 00 00 	movabs $0x801629,%rax
+  801091:	00 00 00 
+  801094:	ff d0                	call   *%rax
+  801096:	48 89 c2             	mov    %rax,%rdx
+  801099:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80109c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80109e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8010a1:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8010a4:	85 c0                	test   %eax,%eax
+  8010a6:	7e c7                	jle    80106f <vprintfmt+0x24b>
+  8010a8:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8010ad:	4c 89 ee             	mov    %r13,%rsi
+  8010b0:	44 89 e7             	mov    %r12d,%edi
+  8010b3:	41 ff d6             	call   *%r14
+  8010b6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8010ba:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010bd:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8010c0:	75 eb                	jne    8010ad <vprintfmt+0x289>
+  8010c2:	eb ab                	jmp    80106f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8010c4:	0f b6 f8             	movzbl %al,%edi
+  8010c7:	4c 89 ee             	mov    %r13,%rsi
+  8010ca:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8010cd:	4c 89 e2             	mov    %r12,%rdx
+  8010d0:	45 85 ff             	test   %r15d,%r15d
+  8010d3:	78 06                	js     8010db <vprintfmt+0x2b7>
+  8010d5:	41 83 ef 01          	sub    $0x1,%r15d
+  8010d9:	78 23                	js     8010fe <vprintfmt+0x2da>
+  8010db:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8010df:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8010e5:	84 c0                	test   %al,%al
+  8010e7:	74 15                	je     8010fe <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8010e9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8010ed:	74 d5                	je     8010c4 <vprintfmt+0x2a0>
+  8010ef:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8010f2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8010f7:	80 fa 5e             	cmp    $0x5e,%dl
+  8010fa:	77 cb                	ja     8010c7 <vprintfmt+0x2a3>
+  8010fc:	eb c6                	jmp    8010c4 <vprintfmt+0x2a0>
+  8010fe:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801101:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  801104:	01 f0                	add    %esi,%eax
+  801106:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  801108:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80110c:	85 c0                	test   %eax,%eax
+  80110e:	0f 8e 41 fd ff ff    	jle    800e55 <vprintfmt+0x31>
+  801114:	4c 89 ee             	mov    %r13,%rsi
+  801117:	bf 20 00 00 00       	mov    $0x20,%edi
+  80111c:	41 ff d6             	call   *%r14
+  80111f:	41 83 ec 01          	sub    $0x1,%r12d
+  801123:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801127:	75 eb                	jne    801114 <vprintfmt+0x2f0>
+  801129:	e9 27 fd ff ff       	jmp    800e55 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  80112e:	40 84 f6             	test   %sil,%sil
+  801131:	75 26                	jne    801159 <vprintfmt+0x335>
+    switch (lflag) {
+  801133:	85 d2                	test   %edx,%edx
+  801135:	74 59                	je     801190 <vprintfmt+0x36c>
+  801137:	83 fa 01             	cmp    $0x1,%edx
+  80113a:	74 7b                	je     8011b7 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  80113c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80113f:	83 f8 2f             	cmp    $0x2f,%eax
+  801142:	0f 87 96 00 00 00    	ja     8011de <vprintfmt+0x3ba>
+  801148:	89 c2                	mov    %eax,%edx
+  80114a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80114e:	83 c0 08             	add    $0x8,%eax
+  801151:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801154:	4c 8b 22             	mov    (%rdx),%r12
+  801157:	eb 17                	jmp    801170 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  801159:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80115c:	83 f8 2f             	cmp    $0x2f,%eax
+  80115f:	77 21                	ja     801182 <vprintfmt+0x35e>
+  801161:	89 c2                	mov    %eax,%edx
+  801163:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801167:	83 c0 08             	add    $0x8,%eax
+  80116a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80116d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801170:	4d 85 e4             	test   %r12,%r12
+  801173:	78 7a                	js     8011ef <vprintfmt+0x3cb>
+            num = i;
+  801175:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801178:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80117d:	e9 b5 02 00 00       	jmp    801437 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  801182:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801186:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80118a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80118e:	eb dd                	jmp    80116d <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  801190:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801193:	83 f8 2f             	cmp    $0x2f,%eax
+  801196:	77 11                	ja     8011a9 <vprintfmt+0x385>
+  801198:	89 c2                	mov    %eax,%edx
+  80119a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80119e:	83 c0 08             	add    $0x8,%eax
+  8011a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011a4:	4c 63 22             	movslq (%rdx),%r12
+  8011a7:	eb c7                	jmp    801170 <vprintfmt+0x34c>
+  8011a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011b5:	eb ed                	jmp    8011a4 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  8011b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8011bd:	77 11                	ja     8011d0 <vprintfmt+0x3ac>
+  8011bf:	89 c2                	mov    %eax,%edx
+  8011c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011c5:	83 c0 08             	add    $0x8,%eax
+  8011c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011cb:	4c 8b 22             	mov    (%rdx),%r12
+  8011ce:	eb a0                	jmp    801170 <vprintfmt+0x34c>
+  8011d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011dc:	eb ed                	jmp    8011cb <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  8011de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011ea:	e9 65 ff ff ff       	jmp    801154 <vprintfmt+0x330>
+                putch('-', put_arg);
+  8011ef:	4c 89 ee             	mov    %r13,%rsi
+  8011f2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8011f7:	41 ff d6             	call   *%r14
+                i = -i;
+  8011fa:	49 f7 dc             	neg    %r12
+  8011fd:	e9 73 ff ff ff       	jmp    801175 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  801202:	40 84 f6             	test   %sil,%sil
+  801205:	75 32                	jne    801239 <vprintfmt+0x415>
+    switch (lflag) {
+  801207:	85 d2                	test   %edx,%edx
+  801209:	74 5d                	je     801268 <vprintfmt+0x444>
+  80120b:	83 fa 01             	cmp    $0x1,%edx
+  80120e:	0f 84 82 00 00 00    	je     801296 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  801214:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801217:	83 f8 2f             	cmp    $0x2f,%eax
+  80121a:	0f 87 a5 00 00 00    	ja     8012c5 <vprintfmt+0x4a1>
+  801220:	89 c2                	mov    %eax,%edx
+  801222:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801226:	83 c0 08             	add    $0x8,%eax
+  801229:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80122c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80122f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801234:	e9 fe 01 00 00       	jmp    801437 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  801239:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80123c:	83 f8 2f             	cmp    $0x2f,%eax
+  80123f:	77 19                	ja     80125a <vprintfmt+0x436>
+  801241:	89 c2                	mov    %eax,%edx
+  801243:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801247:	83 c0 08             	add    $0x8,%eax
+  80124a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80124d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801250:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801255:	e9 dd 01 00 00       	jmp    801437 <vprintfmt+0x613>
+  80125a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80125e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801262:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801266:	eb e5                	jmp    80124d <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  801268:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80126b:	83 f8 2f             	cmp    $0x2f,%eax
+  80126e:	77 18                	ja     801288 <vprintfmt+0x464>
+  801270:	89 c2                	mov    %eax,%edx
+  801272:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801276:	83 c0 08             	add    $0x8,%eax
+  801279:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80127c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80127e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801283:	e9 af 01 00 00       	jmp    801437 <vprintfmt+0x613>
+  801288:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80128c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801290:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801294:	eb e6                	jmp    80127c <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  801296:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801299:	83 f8 2f             	cmp    $0x2f,%eax
+  80129c:	77 19                	ja     8012b7 <vprintfmt+0x493>
+  80129e:	89 c2                	mov    %eax,%edx
+  8012a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012a4:	83 c0 08             	add    $0x8,%eax
+  8012a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012aa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8012ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8012b2:	e9 80 01 00 00       	jmp    801437 <vprintfmt+0x613>
+  8012b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012c3:	eb e5                	jmp    8012aa <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  8012c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012d1:	e9 56 ff ff ff       	jmp    80122c <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  8012d6:	40 84 f6             	test   %sil,%sil
+  8012d9:	75 2e                	jne    801309 <vprintfmt+0x4e5>
+    switch (lflag) {
+  8012db:	85 d2                	test   %edx,%edx
+  8012dd:	0f 84 b3 00 00 00    	je     801396 <vprintfmt+0x572>
+  8012e3:	83 fa 01             	cmp    $0x1,%edx
+  8012e6:	0f 84 d3 00 00 00    	je     8013bf <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  8012ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8012f2:	0f 87 f1 00 00 00    	ja     8013e9 <vprintfmt+0x5c5>
+  8012f8:	89 c2                	mov    %eax,%edx
+  8012fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012fe:	83 c0 08             	add    $0x8,%eax
+  801301:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801304:	48 8b 02             	mov    (%rdx),%rax
+  801307:	eb 17                	jmp    801320 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  801309:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80130c:	83 f8 2f             	cmp    $0x2f,%eax
+  80130f:	77 77                	ja     801388 <vprintfmt+0x564>
+  801311:	89 c2                	mov    %eax,%edx
+  801313:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801317:	83 c0 08             	add    $0x8,%eax
+  80131a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80131d:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  801320:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  801322:	83 f8 07             	cmp    $0x7,%eax
+  801325:	0f 8e cf 00 00 00    	jle    8013fa <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  80132b:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  801331:	44 89 e7             	mov    %r12d,%edi
+  801334:	41 c1 e4 03          	shl    $0x3,%r12d
+  801338:	89 d1                	mov    %edx,%ecx
+  80133a:	8d 72 07             	lea    0x7(%rdx),%esi
+  80133d:	85 d2                	test   %edx,%edx
+  80133f:	0f 48 d6             	cmovs  %esi,%edx
+  801342:	c1 fa 03             	sar    $0x3,%edx
+  801345:	83 f9 3f             	cmp    $0x3f,%ecx
+  801348:	7f e7                	jg     801331 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  80134a:	85 ff                	test   %edi,%edi
+  80134c:	0f 84 03 fb ff ff    	je     800e55 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  801352:	49 63 f4             	movslq %r12d,%rsi
+  801355:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135a:	48 f7 f6             	div    %rsi
+  80135d:	49 89 d7             	mov    %rdx,%r15
+  801360:	83 c0 30             	add    $0x30,%eax
+  801363:	0f be f8             	movsbl %al,%edi
+  801366:	4c 89 ee             	mov    %r13,%rsi
+  801369:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  80136c:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  80136f:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  801374:	45 85 e4             	test   %r12d,%r12d
+  801377:	41 0f 49 d4          	cmovns %r12d,%edx
+  80137b:	c1 fa 03             	sar    $0x3,%edx
+  80137e:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  801381:	75 cf                	jne    801352 <vprintfmt+0x52e>
+  801383:	e9 cd fa ff ff       	jmp    800e55 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  801388:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80138c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801390:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801394:	eb 87                	jmp    80131d <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  801396:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801399:	83 f8 2f             	cmp    $0x2f,%eax
+  80139c:	77 13                	ja     8013b1 <vprintfmt+0x58d>
+  80139e:	89 c2                	mov    %eax,%edx
+  8013a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013a4:	83 c0 08             	add    $0x8,%eax
+  8013a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013aa:	8b 02                	mov    (%rdx),%eax
+  8013ac:	e9 6f ff ff ff       	jmp    801320 <vprintfmt+0x4fc>
+  8013b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013bd:	eb eb                	jmp    8013aa <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  8013bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8013c5:	77 14                	ja     8013db <vprintfmt+0x5b7>
+  8013c7:	89 c2                	mov    %eax,%edx
+  8013c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013cd:	83 c0 08             	add    $0x8,%eax
+  8013d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013d3:	48 8b 02             	mov    (%rdx),%rax
+  8013d6:	e9 45 ff ff ff       	jmp    801320 <vprintfmt+0x4fc>
+  8013db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013e7:	eb ea                	jmp    8013d3 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  8013e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013f5:	e9 0a ff ff ff       	jmp    801304 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  8013fa:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  801400:	e9 4d ff ff ff       	jmp    801352 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  801405:	4c 89 ee             	mov    %r13,%rsi
+  801408:	bf 30 00 00 00       	mov    $0x30,%edi
+  80140d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801410:	4c 89 ee             	mov    %r13,%rsi
+  801413:	bf 78 00 00 00       	mov    $0x78,%edi
+  801418:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80141b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80141e:	83 f8 2f             	cmp    $0x2f,%eax
+  801421:	77 47                	ja     80146a <vprintfmt+0x646>
+  801423:	89 c2                	mov    %eax,%edx
+  801425:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801429:	83 c0 08             	add    $0x8,%eax
+  80142c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80142f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801432:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801437:	48 83 ec 08          	sub    $0x8,%rsp
+  80143b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80143f:	0f 94 c0             	sete   %al
+  801442:	0f b6 c0             	movzbl %al,%eax
+  801445:	50                   	push   %rax
+  801446:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80144b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80144f:	4c 89 ee             	mov    %r13,%rsi
+  801452:	4c 89 f7             	mov    %r14,%rdi
+  801455:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  80145c:	00 00 00 
+  80145f:	ff d0                	call   *%rax
+            break;
+  801461:	48 83 c4 10          	add    $0x10,%rsp
+  801465:	e9 eb f9 ff ff       	jmp    800e55 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80146a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80146e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801472:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801476:	eb b7                	jmp    80142f <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  801478:	40 84 f6             	test   %sil,%sil
+  80147b:	75 2b                	jne    8014a8 <vprintfmt+0x684>
+    switch (lflag) {
+  80147d:	85 d2                	test   %edx,%edx
+  80147f:	74 56                	je     8014d7 <vprintfmt+0x6b3>
+  801481:	83 fa 01             	cmp    $0x1,%edx
+  801484:	74 7f                	je     801505 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  801486:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801489:	83 f8 2f             	cmp    $0x2f,%eax
+  80148c:	0f 87 a2 00 00 00    	ja     801534 <vprintfmt+0x710>
+  801492:	89 c2                	mov    %eax,%edx
+  801494:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801498:	83 c0 08             	add    $0x8,%eax
+  80149b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80149e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8014a1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8014a6:	eb 8f                	jmp    801437 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8014a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8014ae:	77 19                	ja     8014c9 <vprintfmt+0x6a5>
+  8014b0:	89 c2                	mov    %eax,%edx
+  8014b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014b6:	83 c0 08             	add    $0x8,%eax
+  8014b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014bc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8014bf:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8014c4:	e9 6e ff ff ff       	jmp    801437 <vprintfmt+0x613>
+  8014c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014d5:	eb e5                	jmp    8014bc <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  8014d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014da:	83 f8 2f             	cmp    $0x2f,%eax
+  8014dd:	77 18                	ja     8014f7 <vprintfmt+0x6d3>
+  8014df:	89 c2                	mov    %eax,%edx
+  8014e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014e5:	83 c0 08             	add    $0x8,%eax
+  8014e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014eb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8014ed:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8014f2:	e9 40 ff ff ff       	jmp    801437 <vprintfmt+0x613>
+  8014f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801503:	eb e6                	jmp    8014eb <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  801505:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801508:	83 f8 2f             	cmp    $0x2f,%eax
+  80150b:	77 19                	ja     801526 <vprintfmt+0x702>
+  80150d:	89 c2                	mov    %eax,%edx
+  80150f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801513:	83 c0 08             	add    $0x8,%eax
+  801516:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801519:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80151c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801521:	e9 11 ff ff ff       	jmp    801437 <vprintfmt+0x613>
+  801526:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80152a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80152e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801532:	eb e5                	jmp    801519 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  801534:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801538:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80153c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801540:	e9 59 ff ff ff       	jmp    80149e <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  801545:	4c 89 ee             	mov    %r13,%rsi
+  801548:	bf 25 00 00 00       	mov    $0x25,%edi
+  80154d:	41 ff d6             	call   *%r14
+            break;
+  801550:	e9 00 f9 ff ff       	jmp    800e55 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801555:	4c 89 ee             	mov    %r13,%rsi
+  801558:	bf 25 00 00 00       	mov    $0x25,%edi
+  80155d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801560:	48 83 eb 01          	sub    $0x1,%rbx
+  801564:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801568:	75 f6                	jne    801560 <vprintfmt+0x73c>
+  80156a:	e9 e6 f8 ff ff       	jmp    800e55 <vprintfmt+0x31>
+}
+  80156f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801573:	5b                   	pop    %rbx
+  801574:	41 5c                	pop    %r12
+  801576:	41 5d                	pop    %r13
+  801578:	41 5e                	pop    %r14
+  80157a:	41 5f                	pop    %r15
+  80157c:	5d                   	pop    %rbp
+  80157d:	c3                   	ret
+
+000000000080157e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80157e:	55                   	push   %rbp
+  80157f:	48 89 e5             	mov    %rsp,%rbp
+  801582:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801586:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80158a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80158f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801593:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80159a:	48 85 ff             	test   %rdi,%rdi
+  80159d:	74 2b                	je     8015ca <vsnprintf+0x4c>
+  80159f:	48 85 f6             	test   %rsi,%rsi
+  8015a2:	74 26                	je     8015ca <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8015a4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8015a8:	48 bf cf 0d 80 00 00 	movabs $0x800dcf,%rdi
+  8015af:	00 00 00 
+  8015b2:	48 b8 24 0e 80 00 00 	movabs $0x800e24,%rax
+  8015b9:	00 00 00 
+  8015bc:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8015be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015c2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8015c5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8015c8:	c9                   	leave
+  8015c9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8015ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015cf:	eb f7                	jmp    8015c8 <vsnprintf+0x4a>
+
+00000000008015d1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8015d1:	55                   	push   %rbp
+  8015d2:	48 89 e5             	mov    %rsp,%rbp
+  8015d5:	48 83 ec 50          	sub    $0x50,%rsp
+  8015d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8015dd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8015e1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8015e5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8015ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8015f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015f4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8015f8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8015fc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801600:	48 b8 7e 15 80 00 00 	movabs $0x80157e,%rax
+  801607:	00 00 00 
+  80160a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80160c:	c9                   	leave
+  80160d:	c3                   	ret
+
+000000000080160e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80160e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801611:	74 10                	je     801623 <strlen+0x15>
+    size_t n = 0;
+  801613:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801618:	48 83 c0 01          	add    $0x1,%rax
+  80161c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801620:	75 f6                	jne    801618 <strlen+0xa>
+  801622:	c3                   	ret
+    size_t n = 0;
+  801623:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801628:	c3                   	ret
+
+0000000000801629 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801629:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80162c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801631:	48 85 f6             	test   %rsi,%rsi
+  801634:	74 11                	je     801647 <strnlen+0x1e>
+  801636:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80163a:	74 0c                	je     801648 <strnlen+0x1f>
+  80163c:	48 83 c2 01          	add    $0x1,%rdx
+  801640:	48 39 d0             	cmp    %rdx,%rax
+  801643:	75 f1                	jne    801636 <strnlen+0xd>
+  801645:	eb 04                	jmp    80164b <strnlen+0x22>
+  801647:	c3                   	ret
+  801648:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80164b:	c3                   	ret
+
+000000000080164c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80164c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80164f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801654:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801658:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80165b:	48 83 c2 01          	add    $0x1,%rdx
+  80165f:	84 c9                	test   %cl,%cl
+  801661:	75 f1                	jne    801654 <strcpy+0x8>
+        ;
+    return res;
+}
+  801663:	c3                   	ret
+
+0000000000801664 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801664:	55                   	push   %rbp
+  801665:	48 89 e5             	mov    %rsp,%rbp
+  801668:	41 54                	push   %r12
+  80166a:	53                   	push   %rbx
+  80166b:	48 89 fb             	mov    %rdi,%rbx
+  80166e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801671:	48 b8 0e 16 80 00 00 	movabs $0x80160e,%rax
+  801678:	00 00 00 
+  80167b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80167d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801681:	4c 89 e6             	mov    %r12,%rsi
+  801684:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  80168b:	00 00 00 
+  80168e:	ff d0                	call   *%rax
+    return dst;
+}
+  801690:	48 89 d8             	mov    %rbx,%rax
+  801693:	5b                   	pop    %rbx
+  801694:	41 5c                	pop    %r12
+  801696:	5d                   	pop    %rbp
+  801697:	c3                   	ret
+
+0000000000801698 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801698:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80169b:	48 85 d2             	test   %rdx,%rdx
+  80169e:	74 1f                	je     8016bf <strncpy+0x27>
+  8016a0:	48 01 fa             	add    %rdi,%rdx
+  8016a3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8016a6:	48 83 c1 01          	add    $0x1,%rcx
+  8016aa:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8016ae:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8016b2:	41 80 f8 01          	cmp    $0x1,%r8b
+  8016b6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8016ba:	48 39 ca             	cmp    %rcx,%rdx
+  8016bd:	75 e7                	jne    8016a6 <strncpy+0xe>
+    }
+    return ret;
+}
+  8016bf:	c3                   	ret
+
+00000000008016c0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8016c0:	48 89 f8             	mov    %rdi,%rax
+  8016c3:	48 85 d2             	test   %rdx,%rdx
+  8016c6:	74 24                	je     8016ec <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8016c8:	48 83 ea 01          	sub    $0x1,%rdx
+  8016cc:	74 1b                	je     8016e9 <strlcpy+0x29>
+  8016ce:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8016d2:	0f b6 16             	movzbl (%rsi),%edx
+  8016d5:	84 d2                	test   %dl,%dl
+  8016d7:	74 10                	je     8016e9 <strlcpy+0x29>
+            *dst++ = *src++;
+  8016d9:	48 83 c6 01          	add    $0x1,%rsi
+  8016dd:	48 83 c0 01          	add    $0x1,%rax
+  8016e1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8016e4:	48 39 c8             	cmp    %rcx,%rax
+  8016e7:	75 e9                	jne    8016d2 <strlcpy+0x12>
+        *dst = '\0';
+  8016e9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8016ec:	48 29 f8             	sub    %rdi,%rax
+}
+  8016ef:	c3                   	ret
+
+00000000008016f0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8016f0:	0f b6 07             	movzbl (%rdi),%eax
+  8016f3:	84 c0                	test   %al,%al
+  8016f5:	74 13                	je     80170a <strcmp+0x1a>
+  8016f7:	38 06                	cmp    %al,(%rsi)
+  8016f9:	75 0f                	jne    80170a <strcmp+0x1a>
+  8016fb:	48 83 c7 01          	add    $0x1,%rdi
+  8016ff:	48 83 c6 01          	add    $0x1,%rsi
+  801703:	0f b6 07             	movzbl (%rdi),%eax
+  801706:	84 c0                	test   %al,%al
+  801708:	75 ed                	jne    8016f7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80170a:	0f b6 c0             	movzbl %al,%eax
+  80170d:	0f b6 16             	movzbl (%rsi),%edx
+  801710:	29 d0                	sub    %edx,%eax
+}
+  801712:	c3                   	ret
+
+0000000000801713 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801713:	48 85 d2             	test   %rdx,%rdx
+  801716:	74 1f                	je     801737 <strncmp+0x24>
+  801718:	0f b6 07             	movzbl (%rdi),%eax
+  80171b:	84 c0                	test   %al,%al
+  80171d:	74 1e                	je     80173d <strncmp+0x2a>
+  80171f:	3a 06                	cmp    (%rsi),%al
+  801721:	75 1a                	jne    80173d <strncmp+0x2a>
+  801723:	48 83 c7 01          	add    $0x1,%rdi
+  801727:	48 83 c6 01          	add    $0x1,%rsi
+  80172b:	48 83 ea 01          	sub    $0x1,%rdx
+  80172f:	75 e7                	jne    801718 <strncmp+0x5>
+
+    if (!n) return 0;
+  801731:	b8 00 00 00 00       	mov    $0x0,%eax
+  801736:	c3                   	ret
+  801737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173c:	c3                   	ret
+  80173d:	48 85 d2             	test   %rdx,%rdx
+  801740:	74 09                	je     80174b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801742:	0f b6 07             	movzbl (%rdi),%eax
+  801745:	0f b6 16             	movzbl (%rsi),%edx
+  801748:	29 d0                	sub    %edx,%eax
+  80174a:	c3                   	ret
+    if (!n) return 0;
+  80174b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801750:	c3                   	ret
+
+0000000000801751 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801751:	0f b6 17             	movzbl (%rdi),%edx
+  801754:	84 d2                	test   %dl,%dl
+  801756:	74 18                	je     801770 <strchr+0x1f>
+        if (*str == c) {
+  801758:	0f be d2             	movsbl %dl,%edx
+  80175b:	39 f2                	cmp    %esi,%edx
+  80175d:	74 17                	je     801776 <strchr+0x25>
+    for (; *str; str++) {
+  80175f:	48 83 c7 01          	add    $0x1,%rdi
+  801763:	0f b6 17             	movzbl (%rdi),%edx
+  801766:	84 d2                	test   %dl,%dl
+  801768:	75 ee                	jne    801758 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80176a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176f:	c3                   	ret
+  801770:	b8 00 00 00 00       	mov    $0x0,%eax
+  801775:	c3                   	ret
+  801776:	48 89 f8             	mov    %rdi,%rax
+}
+  801779:	c3                   	ret
+
+000000000080177a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80177a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80177d:	0f b6 17             	movzbl (%rdi),%edx
+  801780:	84 d2                	test   %dl,%dl
+  801782:	74 13                	je     801797 <strfind+0x1d>
+  801784:	0f be d2             	movsbl %dl,%edx
+  801787:	39 f2                	cmp    %esi,%edx
+  801789:	74 0b                	je     801796 <strfind+0x1c>
+  80178b:	48 83 c0 01          	add    $0x1,%rax
+  80178f:	0f b6 10             	movzbl (%rax),%edx
+  801792:	84 d2                	test   %dl,%dl
+  801794:	75 ee                	jne    801784 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801796:	c3                   	ret
+  801797:	c3                   	ret
+
+0000000000801798 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  801798:	55                   	push   %rbp
+  801799:	48 89 e5             	mov    %rsp,%rbp
+  80179c:	41 57                	push   %r15
+  80179e:	41 56                	push   %r14
+  8017a0:	41 55                	push   %r13
+  8017a2:	41 54                	push   %r12
+  8017a4:	53                   	push   %rbx
+  8017a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a9:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  8017ac:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  8017b0:	45 84 ed             	test   %r13b,%r13b
+  8017b3:	75 12                	jne    8017c7 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  8017b5:	4c 89 f8             	mov    %r15,%rax
+  8017b8:	48 83 c4 08          	add    $0x8,%rsp
+  8017bc:	5b                   	pop    %rbx
+  8017bd:	41 5c                	pop    %r12
+  8017bf:	41 5d                	pop    %r13
+  8017c1:	41 5e                	pop    %r14
+  8017c3:	41 5f                	pop    %r15
+  8017c5:	5d                   	pop    %rbp
+  8017c6:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  8017c7:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  8017cb:	4c 89 e7             	mov    %r12,%rdi
+  8017ce:	48 b8 0e 16 80 00 00 	movabs $0x80160e,%rax
+  8017d5:	00 00 00 
+  8017d8:	ff d0                	call   *%rax
+  8017da:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  8017dd:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  8017e1:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  8017e5:	49 bf 13 17 80 00 00 	movabs $0x801713,%r15
+  8017ec:	00 00 00 
+				if ((sc = *s++) == 0)
+  8017ef:	84 c0                	test   %al,%al
+  8017f1:	75 14                	jne    801807 <strstr+0x6f>
+					return NULL;
+  8017f3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8017f9:	eb ba                	jmp    8017b5 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  8017fb:	48 83 c3 01          	add    $0x1,%rbx
+  8017ff:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  801803:	84 c0                	test   %al,%al
+  801805:	74 1b                	je     801822 <strstr+0x8a>
+			} while (sc != c);
+  801807:	41 38 c5             	cmp    %al,%r13b
+  80180a:	75 ef                	jne    8017fb <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  80180c:	4c 89 f2             	mov    %r14,%rdx
+  80180f:	4c 89 e6             	mov    %r12,%rsi
+  801812:	48 89 df             	mov    %rbx,%rdi
+  801815:	41 ff d7             	call   *%r15
+  801818:	85 c0                	test   %eax,%eax
+  80181a:	75 df                	jne    8017fb <strstr+0x63>
+  80181c:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  801820:	eb 93                	jmp    8017b5 <strstr+0x1d>
+					return NULL;
+  801822:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801828:	eb 8b                	jmp    8017b5 <strstr+0x1d>
+
+000000000080182a <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  80182a:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  80182c:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  80182f:	8d 57 20             	lea    0x20(%rdi),%edx
+  801832:	83 f9 1a             	cmp    $0x1a,%ecx
+  801835:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801838:	c3                   	ret
+
+0000000000801839 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  801839:	55                   	push   %rbp
+  80183a:	48 89 e5             	mov    %rsp,%rbp
+  80183d:	41 57                	push   %r15
+  80183f:	41 56                	push   %r14
+  801841:	41 55                	push   %r13
+  801843:	41 54                	push   %r12
+  801845:	53                   	push   %rbx
+  801846:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  80184a:	48 39 f7             	cmp    %rsi,%rdi
+  80184d:	74 49                	je     801898 <strcasecmp+0x5f>
+  80184f:	49 89 fd             	mov    %rdi,%r13
+  801852:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  801855:	49 bf 2a 18 80 00 00 	movabs $0x80182a,%r15
+  80185c:	00 00 00 
+  80185f:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801864:	41 0f b6 fe          	movzbl %r14b,%edi
+  801868:	41 ff d7             	call   *%r15
+  80186b:	89 c3                	mov    %eax,%ebx
+  80186d:	49 83 c4 01          	add    $0x1,%r12
+  801871:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801877:	41 ff d7             	call   *%r15
+  80187a:	29 c3                	sub    %eax,%ebx
+  80187c:	75 09                	jne    801887 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  80187e:	49 83 c5 01          	add    $0x1,%r13
+  801882:	45 84 f6             	test   %r14b,%r14b
+  801885:	75 d8                	jne    80185f <strcasecmp+0x26>
+}
+  801887:	89 d8                	mov    %ebx,%eax
+  801889:	48 83 c4 08          	add    $0x8,%rsp
+  80188d:	5b                   	pop    %rbx
+  80188e:	41 5c                	pop    %r12
+  801890:	41 5d                	pop    %r13
+  801892:	41 5e                	pop    %r14
+  801894:	41 5f                	pop    %r15
+  801896:	5d                   	pop    %rbp
+  801897:	c3                   	ret
+        return 0;
+  801898:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189d:	eb e8                	jmp    801887 <strcasecmp+0x4e>
+
+000000000080189f <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80189f:	55                   	push   %rbp
+  8018a0:	48 89 e5             	mov    %rsp,%rbp
+  8018a3:	41 57                	push   %r15
+  8018a5:	41 56                	push   %r14
+  8018a7:	41 55                	push   %r13
+  8018a9:	41 54                	push   %r12
+  8018ab:	53                   	push   %rbx
+  8018ac:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  8018b0:	48 85 d2             	test   %rdx,%rdx
+  8018b3:	74 4f                	je     801904 <strncasecmp+0x65>
+  8018b5:	49 89 fc             	mov    %rdi,%r12
+  8018b8:	49 89 f5             	mov    %rsi,%r13
+  8018bb:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  8018bf:	49 be 2a 18 80 00 00 	movabs $0x80182a,%r14
+  8018c6:	00 00 00 
+  8018c9:	49 83 c4 01          	add    $0x1,%r12
+  8018cd:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8018d3:	41 ff d6             	call   *%r14
+  8018d6:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  8018d8:	49 83 c5 01          	add    $0x1,%r13
+  8018dc:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  8018e1:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  8018e4:	29 c3                	sub    %eax,%ebx
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	74 09                	je     8018f3 <strncasecmp+0x54>
+  8018ea:	85 db                	test   %ebx,%ebx
+  8018ec:	75 05                	jne    8018f3 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8018ee:	4d 39 fc             	cmp    %r15,%r12
+  8018f1:	75 d6                	jne    8018c9 <strncasecmp+0x2a>
+}
+  8018f3:	89 d8                	mov    %ebx,%eax
+  8018f5:	48 83 c4 08          	add    $0x8,%rsp
+  8018f9:	5b                   	pop    %rbx
+  8018fa:	41 5c                	pop    %r12
+  8018fc:	41 5d                	pop    %r13
+  8018fe:	41 5e                	pop    %r14
+  801900:	41 5f                	pop    %r15
+  801902:	5d                   	pop    %rbp
+  801903:	c3                   	ret
+    int d = 0;
+  801904:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  801909:	eb e8                	jmp    8018f3 <strncasecmp+0x54>
+
+000000000080190b <toupper>:
+
+int toupper(int c) {
+  80190b:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  80190d:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801910:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801913:	83 f9 1a             	cmp    $0x1a,%ecx
+  801916:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801919:	c3                   	ret
+
+000000000080191a <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  80191a:	83 ff 20             	cmp    $0x20,%edi
+  80191d:	0f 94 c0             	sete   %al
+  801920:	0f b6 c0             	movzbl %al,%eax
+}
+  801923:	c3                   	ret
+
+0000000000801924 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  801924:	89 f8                	mov    %edi,%eax
+  801926:	f7 d8                	neg    %eax
+  801928:	0f 48 c7             	cmovs  %edi,%eax
+}
+  80192b:	c3                   	ret
+
+000000000080192c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80192c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80192f:	48 89 f8             	mov    %rdi,%rax
+  801932:	48 f7 d8             	neg    %rax
+  801935:	83 e0 07             	and    $0x7,%eax
+  801938:	49 89 d1             	mov    %rdx,%r9
+  80193b:	49 29 c1             	sub    %rax,%r9
+  80193e:	78 36                	js     801976 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801940:	40 0f b6 c6          	movzbl %sil,%eax
+  801944:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80194b:	01 01 01 
+  80194e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801952:	40 f6 c7 07          	test   $0x7,%dil
+  801956:	75 38                	jne    801990 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801958:	4c 89 c9             	mov    %r9,%rcx
+  80195b:	48 c1 f9 03          	sar    $0x3,%rcx
+  80195f:	74 0c                	je     80196d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801961:	fc                   	cld
+  801962:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801965:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801969:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80196d:	4d 85 c9             	test   %r9,%r9
+  801970:	75 45                	jne    8019b7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801972:	4c 89 c0             	mov    %r8,%rax
+  801975:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801976:	48 85 d2             	test   %rdx,%rdx
+  801979:	74 f7                	je     801972 <memset+0x46>
+  80197b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80197e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801981:	48 83 c0 01          	add    $0x1,%rax
+  801985:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801989:	48 39 c2             	cmp    %rax,%rdx
+  80198c:	75 f3                	jne    801981 <memset+0x55>
+  80198e:	eb e2                	jmp    801972 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801990:	40 f6 c7 01          	test   $0x1,%dil
+  801994:	74 06                	je     80199c <memset+0x70>
+  801996:	88 07                	mov    %al,(%rdi)
+  801998:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80199c:	40 f6 c7 02          	test   $0x2,%dil
+  8019a0:	74 07                	je     8019a9 <memset+0x7d>
+  8019a2:	66 89 07             	mov    %ax,(%rdi)
+  8019a5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019a9:	40 f6 c7 04          	test   $0x4,%dil
+  8019ad:	74 a9                	je     801958 <memset+0x2c>
+  8019af:	89 07                	mov    %eax,(%rdi)
+  8019b1:	48 83 c7 04          	add    $0x4,%rdi
+  8019b5:	eb a1                	jmp    801958 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019b7:	41 f6 c1 04          	test   $0x4,%r9b
+  8019bb:	74 06                	je     8019c3 <memset+0x97>
+  8019bd:	89 07                	mov    %eax,(%rdi)
+  8019bf:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8019c3:	41 f6 c1 02          	test   $0x2,%r9b
+  8019c7:	74 07                	je     8019d0 <memset+0xa4>
+  8019c9:	66 89 07             	mov    %ax,(%rdi)
+  8019cc:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8019d0:	41 f6 c1 01          	test   $0x1,%r9b
+  8019d4:	74 9c                	je     801972 <memset+0x46>
+  8019d6:	88 07                	mov    %al,(%rdi)
+  8019d8:	eb 98                	jmp    801972 <memset+0x46>
+
+00000000008019da <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8019da:	48 89 f8             	mov    %rdi,%rax
+  8019dd:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8019e0:	48 39 fe             	cmp    %rdi,%rsi
+  8019e3:	73 3b                	jae    801a20 <memmove+0x46>
+  8019e5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8019e9:	48 39 d7             	cmp    %rdx,%rdi
+  8019ec:	73 32                	jae    801a20 <memmove+0x46>
+        s += n;
+        d += n;
+  8019ee:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8019f2:	48 89 d6             	mov    %rdx,%rsi
+  8019f5:	48 09 fe             	or     %rdi,%rsi
+  8019f8:	48 09 ce             	or     %rcx,%rsi
+  8019fb:	40 f6 c6 07          	test   $0x7,%sil
+  8019ff:	75 12                	jne    801a13 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801a01:	48 83 ef 08          	sub    $0x8,%rdi
+  801a05:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801a09:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a0d:	fd                   	std
+  801a0e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801a11:	fc                   	cld
+  801a12:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801a13:	48 83 ef 01          	sub    $0x1,%rdi
+  801a17:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801a1b:	fd                   	std
+  801a1c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801a1e:	eb f1                	jmp    801a11 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a20:	48 89 f2             	mov    %rsi,%rdx
+  801a23:	48 09 c2             	or     %rax,%rdx
+  801a26:	48 09 ca             	or     %rcx,%rdx
+  801a29:	f6 c2 07             	test   $0x7,%dl
+  801a2c:	75 0c                	jne    801a3a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801a2e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a32:	48 89 c7             	mov    %rax,%rdi
+  801a35:	fc                   	cld
+  801a36:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a39:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801a3a:	48 89 c7             	mov    %rax,%rdi
+  801a3d:	fc                   	cld
+  801a3e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801a40:	c3                   	ret
+
+0000000000801a41 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801a41:	55                   	push   %rbp
+  801a42:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801a45:	48 b8 da 19 80 00 00 	movabs $0x8019da,%rax
+  801a4c:	00 00 00 
+  801a4f:	ff d0                	call   *%rax
+}
+  801a51:	5d                   	pop    %rbp
+  801a52:	c3                   	ret
+
+0000000000801a53 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801a53:	55                   	push   %rbp
+  801a54:	48 89 e5             	mov    %rsp,%rbp
+  801a57:	41 57                	push   %r15
+  801a59:	41 56                	push   %r14
+  801a5b:	41 55                	push   %r13
+  801a5d:	41 54                	push   %r12
+  801a5f:	53                   	push   %rbx
+  801a60:	48 83 ec 08          	sub    $0x8,%rsp
+  801a64:	49 89 fe             	mov    %rdi,%r14
+  801a67:	49 89 f7             	mov    %rsi,%r15
+  801a6a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801a6d:	48 89 f7             	mov    %rsi,%rdi
+  801a70:	48 b8 0e 16 80 00 00 	movabs $0x80160e,%rax
+  801a77:	00 00 00 
+  801a7a:	ff d0                	call   *%rax
+  801a7c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801a7f:	48 89 de             	mov    %rbx,%rsi
+  801a82:	4c 89 f7             	mov    %r14,%rdi
+  801a85:	48 b8 29 16 80 00 00 	movabs $0x801629,%rax
+  801a8c:	00 00 00 
+  801a8f:	ff d0                	call   *%rax
+  801a91:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801a94:	48 39 c3             	cmp    %rax,%rbx
+  801a97:	74 36                	je     801acf <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801a99:	48 89 d8             	mov    %rbx,%rax
+  801a9c:	4c 29 e8             	sub    %r13,%rax
+  801a9f:	49 39 c4             	cmp    %rax,%r12
+  801aa2:	73 31                	jae    801ad5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801aa4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801aa9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801aad:	4c 89 fe             	mov    %r15,%rsi
+  801ab0:	48 b8 41 1a 80 00 00 	movabs $0x801a41,%rax
+  801ab7:	00 00 00 
+  801aba:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801abc:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801ac0:	48 83 c4 08          	add    $0x8,%rsp
+  801ac4:	5b                   	pop    %rbx
+  801ac5:	41 5c                	pop    %r12
+  801ac7:	41 5d                	pop    %r13
+  801ac9:	41 5e                	pop    %r14
+  801acb:	41 5f                	pop    %r15
+  801acd:	5d                   	pop    %rbp
+  801ace:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801acf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801ad3:	eb eb                	jmp    801ac0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801ad5:	48 83 eb 01          	sub    $0x1,%rbx
+  801ad9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801add:	48 89 da             	mov    %rbx,%rdx
+  801ae0:	4c 89 fe             	mov    %r15,%rsi
+  801ae3:	48 b8 41 1a 80 00 00 	movabs $0x801a41,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801aef:	49 01 de             	add    %rbx,%r14
+  801af2:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801af7:	eb c3                	jmp    801abc <strlcat+0x69>
+
+0000000000801af9 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801af9:	48 85 d2             	test   %rdx,%rdx
+  801afc:	74 2d                	je     801b2b <memcmp+0x32>
+  801afe:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801b03:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801b07:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801b0c:	44 38 c1             	cmp    %r8b,%cl
+  801b0f:	75 0f                	jne    801b20 <memcmp+0x27>
+    while (n-- > 0) {
+  801b11:	48 83 c0 01          	add    $0x1,%rax
+  801b15:	48 39 c2             	cmp    %rax,%rdx
+  801b18:	75 e9                	jne    801b03 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801b20:	0f b6 c1             	movzbl %cl,%eax
+  801b23:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801b27:	44 29 c0             	sub    %r8d,%eax
+  801b2a:	c3                   	ret
+    return 0;
+  801b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b30:	c3                   	ret
+
+0000000000801b31 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801b31:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801b35:	48 39 c7             	cmp    %rax,%rdi
+  801b38:	73 0f                	jae    801b49 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801b3a:	40 38 37             	cmp    %sil,(%rdi)
+  801b3d:	74 0e                	je     801b4d <memfind+0x1c>
+    for (; src < end; src++) {
+  801b3f:	48 83 c7 01          	add    $0x1,%rdi
+  801b43:	48 39 f8             	cmp    %rdi,%rax
+  801b46:	75 f2                	jne    801b3a <memfind+0x9>
+  801b48:	c3                   	ret
+  801b49:	48 89 f8             	mov    %rdi,%rax
+  801b4c:	c3                   	ret
+  801b4d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801b50:	c3                   	ret
+
+0000000000801b51 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b51:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801b54:	0f b6 37             	movzbl (%rdi),%esi
+  801b57:	40 80 fe 20          	cmp    $0x20,%sil
+  801b5b:	74 06                	je     801b63 <strtol+0x12>
+  801b5d:	40 80 fe 09          	cmp    $0x9,%sil
+  801b61:	75 13                	jne    801b76 <strtol+0x25>
+  801b63:	48 83 c7 01          	add    $0x1,%rdi
+  801b67:	0f b6 37             	movzbl (%rdi),%esi
+  801b6a:	40 80 fe 20          	cmp    $0x20,%sil
+  801b6e:	74 f3                	je     801b63 <strtol+0x12>
+  801b70:	40 80 fe 09          	cmp    $0x9,%sil
+  801b74:	74 ed                	je     801b63 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801b76:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801b79:	83 e0 fd             	and    $0xfffffffd,%eax
+  801b7c:	3c 01                	cmp    $0x1,%al
+  801b7e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801b82:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801b88:	75 0f                	jne    801b99 <strtol+0x48>
+  801b8a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801b8d:	74 14                	je     801ba3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801b8f:	85 d2                	test   %edx,%edx
+  801b91:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b96:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801b99:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801b9e:	4c 63 ca             	movslq %edx,%r9
+  801ba1:	eb 36                	jmp    801bd9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801ba3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801ba7:	74 0f                	je     801bb8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801ba9:	85 d2                	test   %edx,%edx
+  801bab:	75 ec                	jne    801b99 <strtol+0x48>
+        s++;
+  801bad:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801bb1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801bb6:	eb e1                	jmp    801b99 <strtol+0x48>
+        s += 2;
+  801bb8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801bbc:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801bc1:	eb d6                	jmp    801b99 <strtol+0x48>
+            dig -= '0';
+  801bc3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801bc6:	44 0f b6 c1          	movzbl %cl,%r8d
+  801bca:	41 39 d0             	cmp    %edx,%r8d
+  801bcd:	7d 21                	jge    801bf0 <strtol+0x9f>
+        val = val * base + dig;
+  801bcf:	49 0f af c1          	imul   %r9,%rax
+  801bd3:	0f b6 c9             	movzbl %cl,%ecx
+  801bd6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801bd9:	48 83 c7 01          	add    $0x1,%rdi
+  801bdd:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801be1:	80 f9 39             	cmp    $0x39,%cl
+  801be4:	76 dd                	jbe    801bc3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801be6:	80 f9 7b             	cmp    $0x7b,%cl
+  801be9:	77 05                	ja     801bf0 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801beb:	83 e9 57             	sub    $0x57,%ecx
+  801bee:	eb d6                	jmp    801bc6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801bf0:	4d 85 d2             	test   %r10,%r10
+  801bf3:	74 03                	je     801bf8 <strtol+0xa7>
+  801bf5:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801bf8:	48 89 c2             	mov    %rax,%rdx
+  801bfb:	48 f7 da             	neg    %rdx
+  801bfe:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801c02:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801c06:	c3                   	ret
+
+0000000000801c07 <atoi>:
+int atoi(const char *str) {
+  801c07:	55                   	push   %rbp
+  801c08:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801c0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c10:	be 00 00 00 00       	mov    $0x0,%esi
+  801c15:	48 b8 51 1b 80 00 00 	movabs $0x801b51,%rax
+  801c1c:	00 00 00 
+  801c1f:	ff d0                	call   *%rax
+}
+  801c21:	5d                   	pop    %rbp
+  801c22:	c3                   	ret
+
+0000000000801c23 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801c23:	55                   	push   %rbp
+  801c24:	48 89 e5             	mov    %rsp,%rbp
+  801c27:	53                   	push   %rbx
+  801c28:	48 89 fa             	mov    %rdi,%rdx
+  801c2b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c2e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c38:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c3d:	be 00 00 00 00       	mov    $0x0,%esi
+  801c42:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c48:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801c4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c4e:	c9                   	leave
+  801c4f:	c3                   	ret
+
+0000000000801c50 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801c50:	55                   	push   %rbp
+  801c51:	48 89 e5             	mov    %rsp,%rbp
+  801c54:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c55:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c69:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c6e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c79:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c7f:	c9                   	leave
+  801c80:	c3                   	ret
+
+0000000000801c81 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801c81:	55                   	push   %rbp
+  801c82:	48 89 e5             	mov    %rsp,%rbp
+  801c85:	53                   	push   %rbx
+  801c86:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801c8a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c8d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c92:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ca1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ca6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801cae:	48 85 c0             	test   %rax,%rax
+  801cb1:	7f 06                	jg     801cb9 <sys_env_destroy+0x38>
+}
+  801cb3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cb7:	c9                   	leave
+  801cb8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801cb9:	49 89 c0             	mov    %rax,%r8
+  801cbc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801cc1:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  801cc8:	00 00 00 
+  801ccb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801cd0:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  801cd7:	00 00 00 
+  801cda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdf:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  801ce6:	00 00 00 
+  801ce9:	41 ff d1             	call   *%r9
+
+0000000000801cec <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801cec:	55                   	push   %rbp
+  801ced:	48 89 e5             	mov    %rsp,%rbp
+  801cf0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801cf1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cfb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d05:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d0a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d0f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d15:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d1b:	c9                   	leave
+  801d1c:	c3                   	ret
+
+0000000000801d1d <sys_yield>:
+
+void
+sys_yield(void) {
+  801d1d:	55                   	push   %rbp
+  801d1e:	48 89 e5             	mov    %rsp,%rbp
+  801d21:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d22:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d27:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d36:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d3b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d40:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d46:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d4c:	c9                   	leave
+  801d4d:	c3                   	ret
+
+0000000000801d4e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801d4e:	55                   	push   %rbp
+  801d4f:	48 89 e5             	mov    %rsp,%rbp
+  801d52:	53                   	push   %rbx
+  801d53:	48 89 fa             	mov    %rdi,%rdx
+  801d56:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d59:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d5e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801d65:	00 00 00 
+  801d68:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d6d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d78:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801d7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d7e:	c9                   	leave
+  801d7f:	c3                   	ret
+
+0000000000801d80 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801d80:	55                   	push   %rbp
+  801d81:	48 89 e5             	mov    %rsp,%rbp
+  801d84:	53                   	push   %rbx
+  801d85:	49 89 f8             	mov    %rdi,%r8
+  801d88:	48 89 d3             	mov    %rdx,%rbx
+  801d8b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801d8e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d93:	4c 89 c2             	mov    %r8,%rdx
+  801d96:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d99:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801da4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801da6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801daa:	c9                   	leave
+  801dab:	c3                   	ret
+
+0000000000801dac <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801dac:	55                   	push   %rbp
+  801dad:	48 89 e5             	mov    %rsp,%rbp
+  801db0:	53                   	push   %rbx
+  801db1:	48 83 ec 08          	sub    $0x8,%rsp
+  801db5:	89 f8                	mov    %edi,%eax
+  801db7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801dba:	48 63 f9             	movslq %ecx,%rdi
+  801dbd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801dc0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801dc5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dc8:	be 00 00 00 00       	mov    $0x0,%esi
+  801dcd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dd3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801dd5:	48 85 c0             	test   %rax,%rax
+  801dd8:	7f 06                	jg     801de0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801dda:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dde:	c9                   	leave
+  801ddf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801de0:	49 89 c0             	mov    %rax,%r8
+  801de3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801de8:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  801def:	00 00 00 
+  801df2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801df7:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  801dfe:	00 00 00 
+  801e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e06:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  801e0d:	00 00 00 
+  801e10:	41 ff d1             	call   *%r9
+
+0000000000801e13 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801e13:	55                   	push   %rbp
+  801e14:	48 89 e5             	mov    %rsp,%rbp
+  801e17:	53                   	push   %rbx
+  801e18:	48 83 ec 08          	sub    $0x8,%rsp
+  801e1c:	89 f8                	mov    %edi,%eax
+  801e1e:	49 89 f2             	mov    %rsi,%r10
+  801e21:	48 89 cf             	mov    %rcx,%rdi
+  801e24:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801e27:	48 63 da             	movslq %edx,%rbx
+  801e2a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e2d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e32:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e35:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801e38:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e3a:	48 85 c0             	test   %rax,%rax
+  801e3d:	7f 06                	jg     801e45 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801e3f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e43:	c9                   	leave
+  801e44:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e45:	49 89 c0             	mov    %rax,%r8
+  801e48:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801e4d:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  801e54:	00 00 00 
+  801e57:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801e5c:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  801e63:	00 00 00 
+  801e66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6b:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  801e72:	00 00 00 
+  801e75:	41 ff d1             	call   *%r9
+
+0000000000801e78 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801e78:	55                   	push   %rbp
+  801e79:	48 89 e5             	mov    %rsp,%rbp
+  801e7c:	53                   	push   %rbx
+  801e7d:	48 83 ec 08          	sub    $0x8,%rsp
+  801e81:	49 89 f9             	mov    %rdi,%r9
+  801e84:	89 f0                	mov    %esi,%eax
+  801e86:	48 89 d3             	mov    %rdx,%rbx
+  801e89:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801e8c:	49 63 f0             	movslq %r8d,%rsi
+  801e8f:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801e92:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e97:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ea0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ea2:	48 85 c0             	test   %rax,%rax
+  801ea5:	7f 06                	jg     801ead <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801ea7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eab:	c9                   	leave
+  801eac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ead:	49 89 c0             	mov    %rax,%r8
+  801eb0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801eb5:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  801ebc:	00 00 00 
+  801ebf:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801ec4:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  801ecb:	00 00 00 
+  801ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed3:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  801eda:	00 00 00 
+  801edd:	41 ff d1             	call   *%r9
+
+0000000000801ee0 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801ee0:	55                   	push   %rbp
+  801ee1:	48 89 e5             	mov    %rsp,%rbp
+  801ee4:	53                   	push   %rbx
+  801ee5:	89 f8                	mov    %edi,%eax
+  801ee7:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801eea:	48 63 f9             	movslq %ecx,%rdi
+  801eed:	48 63 da             	movslq %edx,%rbx
+  801ef0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ef3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ef8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801efb:	be 00 00 00 00       	mov    $0x0,%esi
+  801f00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f06:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  801f08:	89 c2                	mov    %eax,%edx
+  801f0a:	48 85 c0             	test   %rax,%rax
+  801f0d:	78 0d                	js     801f1c <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801f0f:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801f14:	4d 85 c9             	test   %r9,%r9
+  801f17:	74 03                	je     801f1c <sys_alloc_dma_region+0x3c>
+  801f19:	49 89 01             	mov    %rax,(%r9)
+}
+  801f1c:	89 d0                	mov    %edx,%eax
+  801f1e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f22:	c9                   	leave
+  801f23:	c3                   	ret
+
+0000000000801f24 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801f24:	55                   	push   %rbp
+  801f25:	48 89 e5             	mov    %rsp,%rbp
+  801f28:	53                   	push   %rbx
+  801f29:	48 83 ec 08          	sub    $0x8,%rsp
+  801f2d:	48 89 f1             	mov    %rsi,%rcx
+  801f30:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801f33:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f36:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f3b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f40:	be 00 00 00 00       	mov    $0x0,%esi
+  801f45:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f4b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f4d:	48 85 c0             	test   %rax,%rax
+  801f50:	7f 06                	jg     801f58 <sys_set_cache_region+0x34>
+}
+  801f52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f56:	c9                   	leave
+  801f57:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f58:	49 89 c0             	mov    %rax,%r8
+  801f5b:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801f60:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  801f67:	00 00 00 
+  801f6a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801f6f:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  801f76:	00 00 00 
+  801f79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7e:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  801f85:	00 00 00 
+  801f88:	41 ff d1             	call   *%r9
+
+0000000000801f8b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801f8b:	55                   	push   %rbp
+  801f8c:	48 89 e5             	mov    %rsp,%rbp
+  801f8f:	53                   	push   %rbx
+  801f90:	48 83 ec 08          	sub    $0x8,%rsp
+  801f94:	48 89 f1             	mov    %rsi,%rcx
+  801f97:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801f9a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f9d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fa2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fa7:	be 00 00 00 00       	mov    $0x0,%esi
+  801fac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fb2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801fb4:	48 85 c0             	test   %rax,%rax
+  801fb7:	7f 06                	jg     801fbf <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801fb9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fbd:	c9                   	leave
+  801fbe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801fbf:	49 89 c0             	mov    %rax,%r8
+  801fc2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801fc7:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  801fce:	00 00 00 
+  801fd1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801fd6:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  801fdd:	00 00 00 
+  801fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe5:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  801fec:	00 00 00 
+  801fef:	41 ff d1             	call   *%r9
+
+0000000000801ff2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801ff2:	55                   	push   %rbp
+  801ff3:	48 89 e5             	mov    %rsp,%rbp
+  801ff6:	53                   	push   %rbx
+  801ff7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801ffb:	48 63 ce             	movslq %esi,%rcx
+  801ffe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802001:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802006:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80200b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802010:	be 00 00 00 00       	mov    $0x0,%esi
+  802015:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80201b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80201d:	48 85 c0             	test   %rax,%rax
+  802020:	7f 06                	jg     802028 <sys_env_set_status+0x36>
+}
+  802022:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802026:	c9                   	leave
+  802027:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802028:	49 89 c0             	mov    %rax,%r8
+  80202b:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  802030:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  802037:	00 00 00 
+  80203a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80203f:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  802046:	00 00 00 
+  802049:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204e:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  802055:	00 00 00 
+  802058:	41 ff d1             	call   *%r9
+
+000000000080205b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80205b:	55                   	push   %rbp
+  80205c:	48 89 e5             	mov    %rsp,%rbp
+  80205f:	53                   	push   %rbx
+  802060:	48 83 ec 08          	sub    $0x8,%rsp
+  802064:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  802067:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80206a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80206f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802074:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802079:	be 00 00 00 00       	mov    $0x0,%esi
+  80207e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802084:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802086:	48 85 c0             	test   %rax,%rax
+  802089:	7f 06                	jg     802091 <sys_env_set_trapframe+0x36>
+}
+  80208b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80208f:	c9                   	leave
+  802090:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802091:	49 89 c0             	mov    %rax,%r8
+  802094:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  802099:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  8020a0:	00 00 00 
+  8020a3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8020a8:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  8020af:	00 00 00 
+  8020b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b7:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  8020be:	00 00 00 
+  8020c1:	41 ff d1             	call   *%r9
+
+00000000008020c4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8020c4:	55                   	push   %rbp
+  8020c5:	48 89 e5             	mov    %rsp,%rbp
+  8020c8:	53                   	push   %rbx
+  8020c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8020cd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8020d0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020ed:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020ef:	48 85 c0             	test   %rax,%rax
+  8020f2:	7f 06                	jg     8020fa <sys_env_set_pgfault_upcall+0x36>
+}
+  8020f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020f8:	c9                   	leave
+  8020f9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020fa:	49 89 c0             	mov    %rax,%r8
+  8020fd:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  802102:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  802109:	00 00 00 
+  80210c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  802111:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  802118:	00 00 00 
+  80211b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802120:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  802127:	00 00 00 
+  80212a:	41 ff d1             	call   *%r9
+
+000000000080212d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80212d:	55                   	push   %rbp
+  80212e:	48 89 e5             	mov    %rsp,%rbp
+  802131:	53                   	push   %rbx
+  802132:	89 f8                	mov    %edi,%eax
+  802134:	49 89 f1             	mov    %rsi,%r9
+  802137:	48 89 d3             	mov    %rdx,%rbx
+  80213a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80213d:	49 63 f0             	movslq %r8d,%rsi
+  802140:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802143:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802148:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80214b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802151:	cd 30                	int    $0x30
+}
+  802153:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802157:	c9                   	leave
+  802158:	c3                   	ret
+
+0000000000802159 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802159:	55                   	push   %rbp
+  80215a:	48 89 e5             	mov    %rsp,%rbp
+  80215d:	53                   	push   %rbx
+  80215e:	48 83 ec 08          	sub    $0x8,%rsp
+  802162:	48 89 fa             	mov    %rdi,%rdx
+  802165:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802168:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80216d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802172:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802177:	be 00 00 00 00       	mov    $0x0,%esi
+  80217c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802182:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802184:	48 85 c0             	test   %rax,%rax
+  802187:	7f 06                	jg     80218f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802189:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80218d:	c9                   	leave
+  80218e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80218f:	49 89 c0             	mov    %rax,%r8
+  802192:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802197:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  80219e:	00 00 00 
+  8021a1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8021a6:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  8021ad:	00 00 00 
+  8021b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b5:	49 b9 84 0b 80 00 00 	movabs $0x800b84,%r9
+  8021bc:	00 00 00 
+  8021bf:	41 ff d1             	call   *%r9
+
+00000000008021c2 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  8021c2:	55                   	push   %rbp
+  8021c3:	48 89 e5             	mov    %rsp,%rbp
+  8021c6:	53                   	push   %rbx
+  8021c7:	48 89 fa             	mov    %rdi,%rdx
+  8021ca:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8021cd:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021e7:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8021e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021ed:	c9                   	leave
+  8021ee:	c3                   	ret
+
+00000000008021ef <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8021ef:	55                   	push   %rbp
+  8021f0:	48 89 e5             	mov    %rsp,%rbp
+  8021f3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8021f4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8021f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802203:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802208:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80220d:	be 00 00 00 00       	mov    $0x0,%esi
+  802212:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802218:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80221a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80221e:	c9                   	leave
+  80221f:	c3                   	ret
+
+0000000000802220 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  802220:	48 85 ff             	test   %rdi,%rdi
+  802223:	0f 84 b6 01 00 00    	je     8023df <malloc+0x1bf>
+malloc(size_t size) {
+  802229:	55                   	push   %rbp
+  80222a:	48 89 e5             	mov    %rsp,%rbp
+  80222d:	41 56                	push   %r14
+  80222f:	41 55                	push   %r13
+  802231:	41 54                	push   %r12
+  802233:	53                   	push   %rbx
+  802234:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  802237:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  80223e:	00 00 00 
+  802241:	4c 8b 20             	mov    (%rax),%r12
+  802244:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  80224b:	0f 87 94 01 00 00    	ja     8023e5 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  802251:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  802258:	00 00 00 
+  80225b:	48 85 c0             	test   %rax,%rax
+  80225e:	74 6b                	je     8022cb <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  802260:	4d 85 e4             	test   %r12,%r12
+  802263:	74 66                	je     8022cb <malloc+0xab>
+  802265:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  80226c:	00 00 00 
+  80226f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802274:	eb 0d                	jmp    802283 <malloc+0x63>
+  802276:	48 83 c1 01          	add    $0x1,%rcx
+  80227a:	48 83 c2 18          	add    $0x18,%rdx
+  80227e:	49 39 cc             	cmp    %rcx,%r12
+  802281:	74 48                	je     8022cb <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  802283:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  802288:	74 ec                	je     802276 <malloc+0x56>
+  80228a:	48 39 1a             	cmp    %rbx,(%rdx)
+  80228d:	72 e7                	jb     802276 <malloc+0x56>
+                real_freep_size--;
+  80228f:	48 83 e8 01          	sub    $0x1,%rax
+  802293:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  80229a:	00 00 00 
+                freep[i].is_free = false;
+  80229d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  8022a4:	00 00 00 
+  8022a7:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  8022ab:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  8022af:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  8022b3:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  8022ba:	00 
+                freep[i].size = size;
+  8022bb:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  8022bf:	48 01 c8             	add    %rcx,%rax
+  8022c2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8022c6:	e9 0b 01 00 00       	jmp    8023d6 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  8022cb:	48 a1 10 60 80 00 00 	movabs 0x806010,%rax
+  8022d2:	00 00 00 
+  8022d5:	48 01 d8             	add    %rbx,%rax
+  8022d8:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8022de:	76 7c                	jbe    80235c <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  8022e0:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  8022e7:	00 00 00 
+  8022ea:	4c 8b 30             	mov    (%rax),%r14
+  8022ed:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  8022f4:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  8022f7:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8022fe:	00 00 00 
+  802301:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  802308:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  80230f:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802315:	4c 0f 45 eb          	cmovne %rbx,%r13
+  802319:	48 b8 ec 1c 80 00 00 	movabs $0x801cec,%rax
+  802320:	00 00 00 
+  802323:	ff d0                	call   *%rax
+  802325:	89 c7                	mov    %eax,%edi
+  802327:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  80232e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802335:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  80233c:	00 00 00 
+  80233f:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  802343:	b9 26 00 00 00       	mov    $0x26,%ecx
+  802348:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  80234f:	00 00 00 
+  802352:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  802354:	85 c0                	test   %eax,%eax
+  802356:	0f 88 90 00 00 00    	js     8023ec <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  80235c:	48 b9 18 60 80 00 00 	movabs $0x806018,%rcx
+  802363:	00 00 00 
+  802366:	48 8b 31             	mov    (%rcx),%rsi
+  802369:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802370:	00 00 00 
+  802373:	4c 8b 07             	mov    (%rdi),%r8
+  802376:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  80237a:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  802381:	00 00 00 
+  802384:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  802388:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  80238c:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  802393:	00 00 00 
+  802396:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  80239a:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  80239d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  8023a1:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8023a8:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  8023a9:	48 89 d8             	mov    %rbx,%rax
+  8023ac:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023b1:	4c 01 c0             	add    %r8,%rax
+  8023b4:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  8023b7:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  8023be:	48 01 f3             	add    %rsi,%rbx
+  8023c1:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  8023c4:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  8023c9:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  8023d0:	00 00 00 
+  8023d3:	48 89 d0             	mov    %rdx,%rax
+}
+  8023d6:	5b                   	pop    %rbx
+  8023d7:	41 5c                	pop    %r12
+  8023d9:	41 5d                	pop    %r13
+  8023db:	41 5e                	pop    %r14
+  8023dd:	5d                   	pop    %rbp
+  8023de:	c3                   	ret
+        return NULL;
+  8023df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e4:	c3                   	ret
+        return NULL;
+  8023e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ea:	eb ea                	jmp    8023d6 <malloc+0x1b6>
+            return NULL;
+  8023ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f1:	eb e3                	jmp    8023d6 <malloc+0x1b6>
+
+00000000008023f3 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  8023f3:	55                   	push   %rbp
+  8023f4:	48 89 e5             	mov    %rsp,%rbp
+  8023f7:	53                   	push   %rbx
+  8023f8:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  8023fc:	48 89 fb             	mov    %rdi,%rbx
+  8023ff:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  802403:	48 89 df             	mov    %rbx,%rdi
+  802406:	48 b8 20 22 80 00 00 	movabs $0x802220,%rax
+  80240d:	00 00 00 
+  802410:	ff d0                	call   *%rax
+  802412:	48 89 c7             	mov    %rax,%rdi
+  802415:	48 89 da             	mov    %rbx,%rdx
+  802418:	be 00 00 00 00       	mov    $0x0,%esi
+  80241d:	48 b8 2c 19 80 00 00 	movabs $0x80192c,%rax
+  802424:	00 00 00 
+  802427:	ff d0                	call   *%rax
+}
+  802429:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80242d:	c9                   	leave
+  80242e:	c3                   	ret
+
+000000000080242f <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  80242f:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  802436:	00 00 00 
+  802439:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802440:	00 00 00 
+  802443:	48 3b 02             	cmp    (%rdx),%rax
+  802446:	74 4d                	je     802495 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  802448:	48 85 c0             	test   %rax,%rax
+  80244b:	74 4d                	je     80249a <get_allocsize+0x6b>
+  80244d:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  802454:	00 00 00 
+  802457:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  80245c:	48 3b 39             	cmp    (%rcx),%rdi
+  80245f:	74 13                	je     802474 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  802461:	48 83 c2 01          	add    $0x1,%rdx
+  802465:	48 83 c1 18          	add    $0x18,%rcx
+  802469:	48 39 d0             	cmp    %rdx,%rax
+  80246c:	75 ee                	jne    80245c <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  80246e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802473:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  802474:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  802478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247d:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  802484:	00 00 00 
+  802487:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  80248d:	75 0b                	jne    80249a <get_allocsize+0x6b>
+  80248f:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  802494:	c3                   	ret
+        return 0;
+  802495:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80249a:	c3                   	ret
+
+000000000080249b <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  80249b:	48 85 ff             	test   %rdi,%rdi
+  80249e:	0f 84 01 01 00 00    	je     8025a5 <free+0x10a>
+free(void *ptr) {
+  8024a4:	55                   	push   %rbp
+  8024a5:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  8024a8:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  8024af:	00 00 00 
+  8024b2:	48 8b 30             	mov    (%rax),%rsi
+  8024b5:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  8024bc:	00 00 00 
+  8024bf:	48 39 c6             	cmp    %rax,%rsi
+  8024c2:	74 50                	je     802514 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  8024c4:	48 85 f6             	test   %rsi,%rsi
+  8024c7:	74 21                	je     8024ea <free+0x4f>
+  8024c9:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  8024d0:	00 00 00 
+  8024d3:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  8024d8:	48 3b 39             	cmp    (%rcx),%rdi
+  8024db:	74 61                	je     80253e <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  8024dd:	48 83 c2 01          	add    $0x1,%rdx
+  8024e1:	48 83 c1 18          	add    $0x18,%rcx
+  8024e5:	48 39 d6             	cmp    %rdx,%rsi
+  8024e8:	75 ee                	jne    8024d8 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  8024ea:	48 ba 90 59 80 00 00 	movabs $0x805990,%rdx
+  8024f1:	00 00 00 
+  8024f4:	be 12 01 00 00       	mov    $0x112,%esi
+  8024f9:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  802500:	00 00 00 
+  802503:	b8 00 00 00 00       	mov    $0x0,%eax
+  802508:	48 b9 84 0b 80 00 00 	movabs $0x800b84,%rcx
+  80250f:	00 00 00 
+  802512:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  802514:	48 ba 40 59 80 00 00 	movabs $0x805940,%rdx
+  80251b:	00 00 00 
+  80251e:	be 06 01 00 00       	mov    $0x106,%esi
+  802523:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  80252a:	00 00 00 
+  80252d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802532:	48 b9 84 0b 80 00 00 	movabs $0x800b84,%rcx
+  802539:	00 00 00 
+  80253c:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  80253e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  802542:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  802549:	00 00 00 
+  80254c:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  802552:	75 27                	jne    80257b <free+0xe0>
+            freep[i].is_free = true;
+  802554:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  802558:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80255f:	00 00 00 
+  802562:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  802569:	00 00 
+            real_freep_size++;
+  80256b:	48 83 c0 01          	add    $0x1,%rax
+  80256f:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  802576:	00 00 00 
+}
+  802579:	5d                   	pop    %rbp
+  80257a:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  80257b:	48 ba 68 59 80 00 00 	movabs $0x805968,%rdx
+  802582:	00 00 00 
+  802585:	be 0b 01 00 00       	mov    $0x10b,%esi
+  80258a:	48 bf b8 59 80 00 00 	movabs $0x8059b8,%rdi
+  802591:	00 00 00 
+  802594:	b8 00 00 00 00       	mov    $0x0,%eax
+  802599:	48 b9 84 0b 80 00 00 	movabs $0x800b84,%rcx
+  8025a0:	00 00 00 
+  8025a3:	ff d1                	call   *%rcx
+  8025a5:	c3                   	ret
+
+00000000008025a6 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  8025a6:	55                   	push   %rbp
+  8025a7:	48 89 e5             	mov    %rsp,%rbp
+  8025aa:	41 55                	push   %r13
+  8025ac:	41 54                	push   %r12
+  8025ae:	53                   	push   %rbx
+  8025af:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b3:	48 89 fb             	mov    %rdi,%rbx
+  8025b6:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  8025b9:	48 b8 2f 24 80 00 00 	movabs $0x80242f,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  8025c5:	49 39 c5             	cmp    %rax,%r13
+  8025c8:	73 0e                	jae    8025d8 <realloc+0x32>
+}
+  8025ca:	48 89 d8             	mov    %rbx,%rax
+  8025cd:	48 83 c4 08          	add    $0x8,%rsp
+  8025d1:	5b                   	pop    %rbx
+  8025d2:	41 5c                	pop    %r12
+  8025d4:	41 5d                	pop    %r13
+  8025d6:	5d                   	pop    %rbp
+  8025d7:	c3                   	ret
+  8025d8:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  8025db:	4c 89 ef             	mov    %r13,%rdi
+  8025de:	48 b8 20 22 80 00 00 	movabs $0x802220,%rax
+  8025e5:	00 00 00 
+  8025e8:	ff d0                	call   *%rax
+  8025ea:	48 89 c7             	mov    %rax,%rdi
+  8025ed:	4c 89 e2             	mov    %r12,%rdx
+  8025f0:	48 89 de             	mov    %rbx,%rsi
+  8025f3:	48 b8 41 1a 80 00 00 	movabs $0x801a41,%rax
+  8025fa:	00 00 00 
+  8025fd:	ff d0                	call   *%rax
+  8025ff:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  802602:	48 89 df             	mov    %rbx,%rdi
+  802605:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  80260c:	00 00 00 
+  80260f:	ff d0                	call   *%rax
+    return newptr;
+  802611:	4c 89 e3             	mov    %r12,%rbx
+  802614:	eb b4                	jmp    8025ca <realloc+0x24>
+
+0000000000802616 <strdup>:
+
+char*
+strdup (const char *src) {
+  802616:	55                   	push   %rbp
+  802617:	48 89 e5             	mov    %rsp,%rbp
+  80261a:	41 54                	push   %r12
+  80261c:	53                   	push   %rbx
+  80261d:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  802620:	48 b8 0e 16 80 00 00 	movabs $0x80160e,%rax
+  802627:	00 00 00 
+  80262a:	ff d0                	call   *%rax
+  80262c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  802630:	4c 89 e7             	mov    %r12,%rdi
+  802633:	48 b8 20 22 80 00 00 	movabs $0x802220,%rax
+  80263a:	00 00 00 
+  80263d:	ff d0                	call   *%rax
+  80263f:	48 89 c7             	mov    %rax,%rdi
+  802642:	4c 89 e2             	mov    %r12,%rdx
+  802645:	48 89 de             	mov    %rbx,%rsi
+  802648:	48 b8 41 1a 80 00 00 	movabs $0x801a41,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+}
+  802654:	5b                   	pop    %rbx
+  802655:	41 5c                	pop    %r12
+  802657:	5d                   	pop    %rbp
+  802658:	c3                   	ret
+
+0000000000802659 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  802659:	55                   	push   %rbp
+  80265a:	48 89 e5             	mov    %rsp,%rbp
+  80265d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80265e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802663:	ba 00 00 00 00       	mov    $0x0,%edx
+  802668:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80266d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802672:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802677:	be 00 00 00 00       	mov    $0x0,%esi
+  80267c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802682:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  802684:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802688:	c9                   	leave
+  802689:	c3                   	ret
+
+000000000080268a <get_ticks>:
+
+uint64_t
+get_ticks() {
+  80268a:	55                   	push   %rbp
+  80268b:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  80268e:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  802695:	00 00 00 
+  802698:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80269c:	74 26                	je     8026c4 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80269e:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8026a0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8026a4:	89 c0                	mov    %eax,%eax
+  8026a6:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  8026a9:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  8026b0:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  8026b7:	00 00 00 
+  8026ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026bf:	48 f7 31             	divq   (%rcx)
+}
+  8026c2:	5d                   	pop    %rbp
+  8026c3:	c3                   	ret
+        freq = get_cpufreq();
+  8026c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c9:	48 ba 59 26 80 00 00 	movabs $0x802659,%rdx
+  8026d0:	00 00 00 
+  8026d3:	ff d2                	call   *%rdx
+  8026d5:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  8026dc:	00 00 00 
+  8026df:	eb bd                	jmp    80269e <get_ticks+0x14>
+
+00000000008026e1 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  8026e1:	55                   	push   %rbp
+  8026e2:	48 89 e5             	mov    %rsp,%rbp
+  8026e5:	53                   	push   %rbx
+  8026e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ea:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  8026ed:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  8026f4:	00 00 00 
+  8026f7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8026fb:	74 50                	je     80274d <sleep+0x6c>
+    asm volatile("rdtsc"
+  8026fd:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8026ff:	48 c1 e2 20          	shl    $0x20,%rdx
+  802703:	89 c0                	mov    %eax,%eax
+  802705:	48 89 d6             	mov    %rdx,%rsi
+  802708:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  80270b:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  802712:	00 00 00 
+  802715:	48 0f af 18          	imul   (%rax),%rbx
+  802719:	48 c1 eb 03          	shr    $0x3,%rbx
+  80271d:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  802724:	9b c4 20 
+  802727:	48 89 d8             	mov    %rbx,%rax
+  80272a:	48 f7 e2             	mul    %rdx
+  80272d:	48 89 d1             	mov    %rdx,%rcx
+  802730:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  802734:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802736:	48 c1 e2 20          	shl    $0x20,%rdx
+  80273a:	89 c0                	mov    %eax,%eax
+  80273c:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  80273f:	48 29 f2             	sub    %rsi,%rdx
+  802742:	48 39 ca             	cmp    %rcx,%rdx
+  802745:	72 ed                	jb     802734 <sleep+0x53>
+}
+  802747:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80274b:	c9                   	leave
+  80274c:	c3                   	ret
+        freq = get_cpufreq();
+  80274d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802752:	48 ba 59 26 80 00 00 	movabs $0x802659,%rdx
+  802759:	00 00 00 
+  80275c:	ff d2                	call   *%rdx
+  80275e:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  802765:	00 00 00 
+  802768:	eb 93                	jmp    8026fd <sleep+0x1c>
+
+000000000080276a <poll_kbd>:
+
+int poll_kbd() {
+  80276a:	55                   	push   %rbp
+  80276b:	48 89 e5             	mov    %rsp,%rbp
+  80276e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80276f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802774:	ba 00 00 00 00       	mov    $0x0,%edx
+  802779:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80277e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802783:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802788:	be 00 00 00 00       	mov    $0x0,%esi
+  80278d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802793:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  802795:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802799:	c9                   	leave
+  80279a:	c3                   	ret
+
+000000000080279b <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  80279b:	55                   	push   %rbp
+  80279c:	48 89 e5             	mov    %rsp,%rbp
+  80279f:	53                   	push   %rbx
+  8027a0:	49 89 fa             	mov    %rdi,%r10
+  8027a3:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  8027a5:	44 89 c6             	mov    %r8d,%esi
+  8027a8:	89 cf                	mov    %ecx,%edi
+  8027aa:	89 d3                	mov    %edx,%ebx
+  8027ac:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8027ae:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027b3:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8027b6:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  8027ba:	cd 30                	int    $0x30
+  8027bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027c0:	c9                   	leave
+  8027c1:	c3                   	ret
+
+00000000008027c2 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8027c2:	55                   	push   %rbp
+  8027c3:	48 89 e5             	mov    %rsp,%rbp
+  8027c6:	41 55                	push   %r13
+  8027c8:	41 54                	push   %r12
+  8027ca:	53                   	push   %rbx
+  8027cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8027cf:	49 89 fc             	mov    %rdi,%r12
+  8027d2:	48 89 f7             	mov    %rsi,%rdi
+  8027d5:	48 89 d3             	mov    %rdx,%rbx
+  8027d8:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8027db:	48 85 f6             	test   %rsi,%rsi
+  8027de:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8027e5:	00 00 00 
+  8027e8:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  8027ec:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027f1:	48 85 d2             	test   %rdx,%rdx
+  8027f4:	74 03                	je     8027f9 <ipc_recv+0x37>
+  8027f6:	48 8b 32             	mov    (%rdx),%rsi
+  8027f9:	48 b8 59 21 80 00 00 	movabs $0x802159,%rax
+  802800:	00 00 00 
+  802803:	ff d0                	call   *%rax
+    if (errno) {
+  802805:	85 c0                	test   %eax,%eax
+  802807:	74 1c                	je     802825 <ipc_recv+0x63>
+        if (from_env_store)
+  802809:	4d 85 e4             	test   %r12,%r12
+  80280c:	74 08                	je     802816 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80280e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802815:	00 
+
+        if (perm_store)
+  802816:	4d 85 ed             	test   %r13,%r13
+  802819:	74 74                	je     80288f <ipc_recv+0xcd>
+            *perm_store = 0;
+  80281b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802822:	00 
+  802823:	eb 6a                	jmp    80288f <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  802825:	4d 85 e4             	test   %r12,%r12
+  802828:	74 14                	je     80283e <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80282a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802831:	00 00 00 
+  802834:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80283a:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80283e:	48 85 db             	test   %rbx,%rbx
+  802841:	74 23                	je     802866 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  802843:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80284a:	00 00 00 
+  80284d:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  802853:	ba 00 00 00 00       	mov    $0x0,%edx
+  802858:	85 c9                	test   %ecx,%ecx
+  80285a:	74 07                	je     802863 <ipc_recv+0xa1>
+  80285c:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  802863:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  802866:	4d 85 ed             	test   %r13,%r13
+  802869:	74 14                	je     80287f <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80286b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802872:	00 00 00 
+  802875:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80287b:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  80287f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802886:	00 00 00 
+  802889:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  80288f:	48 83 c4 08          	add    $0x8,%rsp
+  802893:	5b                   	pop    %rbx
+  802894:	41 5c                	pop    %r12
+  802896:	41 5d                	pop    %r13
+  802898:	5d                   	pop    %rbp
+  802899:	c3                   	ret
+
+000000000080289a <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80289a:	55                   	push   %rbp
+  80289b:	48 89 e5             	mov    %rsp,%rbp
+  80289e:	41 55                	push   %r13
+  8028a0:	41 54                	push   %r12
+  8028a2:	53                   	push   %rbx
+  8028a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a7:	49 89 fc             	mov    %rdi,%r12
+  8028aa:	48 89 f7             	mov    %rsi,%rdi
+  8028ad:	48 89 d3             	mov    %rdx,%rbx
+  8028b0:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8028b3:	48 85 f6             	test   %rsi,%rsi
+  8028b6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8028bd:	00 00 00 
+  8028c0:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  8028c4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028c9:	48 85 d2             	test   %rdx,%rdx
+  8028cc:	74 03                	je     8028d1 <ipc_try_recv+0x37>
+  8028ce:	48 8b 32             	mov    (%rdx),%rsi
+  8028d1:	48 b8 c2 21 80 00 00 	movabs $0x8021c2,%rax
+  8028d8:	00 00 00 
+  8028db:	ff d0                	call   *%rax
+    if (errno) {
+  8028dd:	85 c0                	test   %eax,%eax
+  8028df:	75 75                	jne    802956 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  8028e1:	4d 85 e4             	test   %r12,%r12
+  8028e4:	74 14                	je     8028fa <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8028e6:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8028ed:	00 00 00 
+  8028f0:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8028f6:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  8028fa:	48 85 db             	test   %rbx,%rbx
+  8028fd:	74 23                	je     802922 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8028ff:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802906:	00 00 00 
+  802909:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80290f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802914:	85 c9                	test   %ecx,%ecx
+  802916:	74 07                	je     80291f <ipc_try_recv+0x85>
+  802918:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80291f:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  802922:	4d 85 ed             	test   %r13,%r13
+  802925:	74 14                	je     80293b <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  802927:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80292e:	00 00 00 
+  802931:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  802937:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80293b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802942:	00 00 00 
+  802945:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80294b:	48 83 c4 08          	add    $0x8,%rsp
+  80294f:	5b                   	pop    %rbx
+  802950:	41 5c                	pop    %r12
+  802952:	41 5d                	pop    %r13
+  802954:	5d                   	pop    %rbp
+  802955:	c3                   	ret
+        if (from_env_store)
+  802956:	4d 85 e4             	test   %r12,%r12
+  802959:	74 08                	je     802963 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80295b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802962:	00 
+        if (perm_store)
+  802963:	4d 85 ed             	test   %r13,%r13
+  802966:	74 e3                	je     80294b <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  802968:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80296f:	00 
+  802970:	eb d9                	jmp    80294b <ipc_try_recv+0xb1>
+
+0000000000802972 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802972:	55                   	push   %rbp
+  802973:	48 89 e5             	mov    %rsp,%rbp
+  802976:	41 57                	push   %r15
+  802978:	41 56                	push   %r14
+  80297a:	41 55                	push   %r13
+  80297c:	41 54                	push   %r12
+  80297e:	53                   	push   %rbx
+  80297f:	48 83 ec 18          	sub    $0x18,%rsp
+  802983:	41 89 fd             	mov    %edi,%r13d
+  802986:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802989:	48 89 d3             	mov    %rdx,%rbx
+  80298c:	49 89 cc             	mov    %rcx,%r12
+  80298f:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  802993:	48 85 d2             	test   %rdx,%rdx
+  802996:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80299d:	00 00 00 
+  8029a0:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8029a4:	49 be 2d 21 80 00 00 	movabs $0x80212d,%r14
+  8029ab:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8029ae:	49 bf 1d 1d 80 00 00 	movabs $0x801d1d,%r15
+  8029b5:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8029b8:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8029bb:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8029bf:	4c 89 e1             	mov    %r12,%rcx
+  8029c2:	48 89 da             	mov    %rbx,%rdx
+  8029c5:	44 89 ef             	mov    %r13d,%edi
+  8029c8:	41 ff d6             	call   *%r14
+  8029cb:	85 c0                	test   %eax,%eax
+  8029cd:	74 37                	je     802a06 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  8029cf:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8029d2:	75 05                	jne    8029d9 <ipc_send+0x67>
+        sys_yield();
+  8029d4:	41 ff d7             	call   *%r15
+  8029d7:	eb df                	jmp    8029b8 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  8029d9:	89 c1                	mov    %eax,%ecx
+  8029db:	48 ba c6 59 80 00 00 	movabs $0x8059c6,%rdx
+  8029e2:	00 00 00 
+  8029e5:	be 65 00 00 00       	mov    $0x65,%esi
+  8029ea:	48 bf e1 59 80 00 00 	movabs $0x8059e1,%rdi
+  8029f1:	00 00 00 
+  8029f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f9:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  802a00:	00 00 00 
+  802a03:	41 ff d0             	call   *%r8
+    }
+}
+  802a06:	48 83 c4 18          	add    $0x18,%rsp
+  802a0a:	5b                   	pop    %rbx
+  802a0b:	41 5c                	pop    %r12
+  802a0d:	41 5d                	pop    %r13
+  802a0f:	41 5e                	pop    %r14
+  802a11:	41 5f                	pop    %r15
+  802a13:	5d                   	pop    %rbp
+  802a14:	c3                   	ret
+
+0000000000802a15 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802a15:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802a1a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802a21:	00 00 00 
+  802a24:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  802a2b:	48 01 ca             	add    %rcx,%rdx
+  802a2e:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  802a34:	39 fa                	cmp    %edi,%edx
+  802a36:	74 12                	je     802a4a <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802a38:	48 83 c0 01          	add    $0x1,%rax
+  802a3c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802a42:	75 e0                	jne    802a24 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802a44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a49:	c3                   	ret
+            return envs[i].env_id;
+  802a4a:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  802a51:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802a58:	00 00 00 
+  802a5b:	48 01 d0             	add    %rdx,%rax
+  802a5e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802a64:	c3                   	ret
+
+0000000000802a65 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802a65:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802a6c:	ff ff ff 
+  802a6f:	48 01 f8             	add    %rdi,%rax
+  802a72:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802a76:	c3                   	ret
+
+0000000000802a77 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802a77:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802a7e:	ff ff ff 
+  802a81:	48 01 f8             	add    %rdi,%rax
+  802a84:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802a88:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802a8e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802a92:	c3                   	ret
+
+0000000000802a93 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802a93:	55                   	push   %rbp
+  802a94:	48 89 e5             	mov    %rsp,%rbp
+  802a97:	41 57                	push   %r15
+  802a99:	41 56                	push   %r14
+  802a9b:	41 55                	push   %r13
+  802a9d:	41 54                	push   %r12
+  802a9f:	53                   	push   %rbx
+  802aa0:	48 83 ec 08          	sub    $0x8,%rsp
+  802aa4:	49 89 ff             	mov    %rdi,%r15
+  802aa7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802aac:	49 bd 47 49 80 00 00 	movabs $0x804947,%r13
+  802ab3:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802ab6:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802abc:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802abf:	48 89 df             	mov    %rbx,%rdi
+  802ac2:	41 ff d5             	call   *%r13
+  802ac5:	83 e0 04             	and    $0x4,%eax
+  802ac8:	74 17                	je     802ae1 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802aca:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ad1:	4c 39 f3             	cmp    %r14,%rbx
+  802ad4:	75 e6                	jne    802abc <fd_alloc+0x29>
+  802ad6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802adc:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802ae1:	4d 89 27             	mov    %r12,(%r15)
+}
+  802ae4:	48 83 c4 08          	add    $0x8,%rsp
+  802ae8:	5b                   	pop    %rbx
+  802ae9:	41 5c                	pop    %r12
+  802aeb:	41 5d                	pop    %r13
+  802aed:	41 5e                	pop    %r14
+  802aef:	41 5f                	pop    %r15
+  802af1:	5d                   	pop    %rbp
+  802af2:	c3                   	ret
+
+0000000000802af3 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802af3:	83 ff 1f             	cmp    $0x1f,%edi
+  802af6:	77 39                	ja     802b31 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802af8:	55                   	push   %rbp
+  802af9:	48 89 e5             	mov    %rsp,%rbp
+  802afc:	41 54                	push   %r12
+  802afe:	53                   	push   %rbx
+  802aff:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802b02:	48 63 df             	movslq %edi,%rbx
+  802b05:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802b0c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802b10:	48 89 df             	mov    %rbx,%rdi
+  802b13:	48 b8 47 49 80 00 00 	movabs $0x804947,%rax
+  802b1a:	00 00 00 
+  802b1d:	ff d0                	call   *%rax
+  802b1f:	a8 04                	test   $0x4,%al
+  802b21:	74 14                	je     802b37 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802b23:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802b27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b2c:	5b                   	pop    %rbx
+  802b2d:	41 5c                	pop    %r12
+  802b2f:	5d                   	pop    %rbp
+  802b30:	c3                   	ret
+        return -E_INVAL;
+  802b31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b36:	c3                   	ret
+        return -E_INVAL;
+  802b37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b3c:	eb ee                	jmp    802b2c <fd_lookup+0x39>
+
+0000000000802b3e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802b3e:	55                   	push   %rbp
+  802b3f:	48 89 e5             	mov    %rsp,%rbp
+  802b42:	41 54                	push   %r12
+  802b44:	53                   	push   %rbx
+  802b45:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802b48:	48 b8 80 5a 80 00 00 	movabs $0x805a80,%rax
+  802b4f:	00 00 00 
+  802b52:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  802b59:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802b5c:	39 3b                	cmp    %edi,(%rbx)
+  802b5e:	74 47                	je     802ba7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802b60:	48 83 c0 08          	add    $0x8,%rax
+  802b64:	48 8b 18             	mov    (%rax),%rbx
+  802b67:	48 85 db             	test   %rbx,%rbx
+  802b6a:	75 f0                	jne    802b5c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802b6c:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802b73:	00 00 00 
+  802b76:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802b7c:	89 fa                	mov    %edi,%edx
+  802b7e:	48 bf f0 59 80 00 00 	movabs $0x8059f0,%rdi
+  802b85:	00 00 00 
+  802b88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8d:	48 b9 d4 0c 80 00 00 	movabs $0x800cd4,%rcx
+  802b94:	00 00 00 
+  802b97:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802b99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802b9e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802ba2:	5b                   	pop    %rbx
+  802ba3:	41 5c                	pop    %r12
+  802ba5:	5d                   	pop    %rbp
+  802ba6:	c3                   	ret
+            return 0;
+  802ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bac:	eb f0                	jmp    802b9e <dev_lookup+0x60>
+
+0000000000802bae <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802bae:	55                   	push   %rbp
+  802baf:	48 89 e5             	mov    %rsp,%rbp
+  802bb2:	41 55                	push   %r13
+  802bb4:	41 54                	push   %r12
+  802bb6:	53                   	push   %rbx
+  802bb7:	48 83 ec 18          	sub    $0x18,%rsp
+  802bbb:	48 89 fb             	mov    %rdi,%rbx
+  802bbe:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802bc1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802bc8:	ff ff ff 
+  802bcb:	48 01 df             	add    %rbx,%rdi
+  802bce:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802bd2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802bd6:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  802bdd:	00 00 00 
+  802be0:	ff d0                	call   *%rax
+  802be2:	41 89 c5             	mov    %eax,%r13d
+  802be5:	85 c0                	test   %eax,%eax
+  802be7:	78 06                	js     802bef <fd_close+0x41>
+  802be9:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802bed:	74 1a                	je     802c09 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802bef:	45 84 e4             	test   %r12b,%r12b
+  802bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf7:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802bfb:	44 89 e8             	mov    %r13d,%eax
+  802bfe:	48 83 c4 18          	add    $0x18,%rsp
+  802c02:	5b                   	pop    %rbx
+  802c03:	41 5c                	pop    %r12
+  802c05:	41 5d                	pop    %r13
+  802c07:	5d                   	pop    %rbp
+  802c08:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802c09:	8b 3b                	mov    (%rbx),%edi
+  802c0b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802c0f:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  802c16:	00 00 00 
+  802c19:	ff d0                	call   *%rax
+  802c1b:	41 89 c5             	mov    %eax,%r13d
+  802c1e:	85 c0                	test   %eax,%eax
+  802c20:	78 1b                	js     802c3d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802c22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c26:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802c2a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802c30:	48 85 c0             	test   %rax,%rax
+  802c33:	74 08                	je     802c3d <fd_close+0x8f>
+  802c35:	48 89 df             	mov    %rbx,%rdi
+  802c38:	ff d0                	call   *%rax
+  802c3a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802c3d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c42:	48 89 de             	mov    %rbx,%rsi
+  802c45:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c4a:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  802c51:	00 00 00 
+  802c54:	ff d0                	call   *%rax
+    return res;
+  802c56:	eb a3                	jmp    802bfb <fd_close+0x4d>
+
+0000000000802c58 <close>:
+
+int
+close(int fdnum) {
+  802c58:	55                   	push   %rbp
+  802c59:	48 89 e5             	mov    %rsp,%rbp
+  802c5c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802c60:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c64:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  802c6b:	00 00 00 
+  802c6e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c70:	85 c0                	test   %eax,%eax
+  802c72:	78 15                	js     802c89 <close+0x31>
+
+    return fd_close(fd, 1);
+  802c74:	be 01 00 00 00       	mov    $0x1,%esi
+  802c79:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c7d:	48 b8 ae 2b 80 00 00 	movabs $0x802bae,%rax
+  802c84:	00 00 00 
+  802c87:	ff d0                	call   *%rax
+}
+  802c89:	c9                   	leave
+  802c8a:	c3                   	ret
+
+0000000000802c8b <close_all>:
+
+void
+close_all(void) {
+  802c8b:	55                   	push   %rbp
+  802c8c:	48 89 e5             	mov    %rsp,%rbp
+  802c8f:	41 54                	push   %r12
+  802c91:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802c92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c97:	49 bc 58 2c 80 00 00 	movabs $0x802c58,%r12
+  802c9e:	00 00 00 
+  802ca1:	89 df                	mov    %ebx,%edi
+  802ca3:	41 ff d4             	call   *%r12
+  802ca6:	83 c3 01             	add    $0x1,%ebx
+  802ca9:	83 fb 20             	cmp    $0x20,%ebx
+  802cac:	75 f3                	jne    802ca1 <close_all+0x16>
+}
+  802cae:	5b                   	pop    %rbx
+  802caf:	41 5c                	pop    %r12
+  802cb1:	5d                   	pop    %rbp
+  802cb2:	c3                   	ret
+
+0000000000802cb3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802cb3:	55                   	push   %rbp
+  802cb4:	48 89 e5             	mov    %rsp,%rbp
+  802cb7:	41 57                	push   %r15
+  802cb9:	41 56                	push   %r14
+  802cbb:	41 55                	push   %r13
+  802cbd:	41 54                	push   %r12
+  802cbf:	53                   	push   %rbx
+  802cc0:	48 83 ec 18          	sub    $0x18,%rsp
+  802cc4:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802cc7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802ccb:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  802cd2:	00 00 00 
+  802cd5:	ff d0                	call   *%rax
+  802cd7:	89 c3                	mov    %eax,%ebx
+  802cd9:	85 c0                	test   %eax,%eax
+  802cdb:	0f 88 b8 00 00 00    	js     802d99 <dup+0xe6>
+    close(newfdnum);
+  802ce1:	44 89 e7             	mov    %r12d,%edi
+  802ce4:	48 b8 58 2c 80 00 00 	movabs $0x802c58,%rax
+  802ceb:	00 00 00 
+  802cee:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802cf0:	4d 63 ec             	movslq %r12d,%r13
+  802cf3:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802cfa:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802cfe:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802d02:	4c 89 ff             	mov    %r15,%rdi
+  802d05:	49 be 77 2a 80 00 00 	movabs $0x802a77,%r14
+  802d0c:	00 00 00 
+  802d0f:	41 ff d6             	call   *%r14
+  802d12:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802d15:	4c 89 ef             	mov    %r13,%rdi
+  802d18:	41 ff d6             	call   *%r14
+  802d1b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802d1e:	48 89 df             	mov    %rbx,%rdi
+  802d21:	48 b8 47 49 80 00 00 	movabs $0x804947,%rax
+  802d28:	00 00 00 
+  802d2b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802d2d:	a8 04                	test   $0x4,%al
+  802d2f:	74 2b                	je     802d5c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802d31:	41 89 c1             	mov    %eax,%r9d
+  802d34:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802d3a:	4c 89 f1             	mov    %r14,%rcx
+  802d3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d42:	48 89 de             	mov    %rbx,%rsi
+  802d45:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d4a:	48 b8 13 1e 80 00 00 	movabs $0x801e13,%rax
+  802d51:	00 00 00 
+  802d54:	ff d0                	call   *%rax
+  802d56:	89 c3                	mov    %eax,%ebx
+  802d58:	85 c0                	test   %eax,%eax
+  802d5a:	78 4e                	js     802daa <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802d5c:	4c 89 ff             	mov    %r15,%rdi
+  802d5f:	48 b8 47 49 80 00 00 	movabs $0x804947,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+  802d6b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802d6e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802d74:	4c 89 e9             	mov    %r13,%rcx
+  802d77:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d7c:	4c 89 fe             	mov    %r15,%rsi
+  802d7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d84:	48 b8 13 1e 80 00 00 	movabs $0x801e13,%rax
+  802d8b:	00 00 00 
+  802d8e:	ff d0                	call   *%rax
+  802d90:	89 c3                	mov    %eax,%ebx
+  802d92:	85 c0                	test   %eax,%eax
+  802d94:	78 14                	js     802daa <dup+0xf7>
+
+    return newfdnum;
+  802d96:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802d99:	89 d8                	mov    %ebx,%eax
+  802d9b:	48 83 c4 18          	add    $0x18,%rsp
+  802d9f:	5b                   	pop    %rbx
+  802da0:	41 5c                	pop    %r12
+  802da2:	41 5d                	pop    %r13
+  802da4:	41 5e                	pop    %r14
+  802da6:	41 5f                	pop    %r15
+  802da8:	5d                   	pop    %rbp
+  802da9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802daa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802daf:	4c 89 ee             	mov    %r13,%rsi
+  802db2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802db7:	49 bc 8b 1f 80 00 00 	movabs $0x801f8b,%r12
+  802dbe:	00 00 00 
+  802dc1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802dc4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dc9:	4c 89 f6             	mov    %r14,%rsi
+  802dcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd1:	41 ff d4             	call   *%r12
+    return res;
+  802dd4:	eb c3                	jmp    802d99 <dup+0xe6>
+
+0000000000802dd6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802dd6:	55                   	push   %rbp
+  802dd7:	48 89 e5             	mov    %rsp,%rbp
+  802dda:	41 56                	push   %r14
+  802ddc:	41 55                	push   %r13
+  802dde:	41 54                	push   %r12
+  802de0:	53                   	push   %rbx
+  802de1:	48 83 ec 10          	sub    $0x10,%rsp
+  802de5:	89 fb                	mov    %edi,%ebx
+  802de7:	49 89 f4             	mov    %rsi,%r12
+  802dea:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ded:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802df1:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  802df8:	00 00 00 
+  802dfb:	ff d0                	call   *%rax
+  802dfd:	85 c0                	test   %eax,%eax
+  802dff:	78 4c                	js     802e4d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802e01:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802e05:	41 8b 3e             	mov    (%r14),%edi
+  802e08:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802e0c:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  802e13:	00 00 00 
+  802e16:	ff d0                	call   *%rax
+  802e18:	85 c0                	test   %eax,%eax
+  802e1a:	78 35                	js     802e51 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802e1c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802e20:	83 e0 03             	and    $0x3,%eax
+  802e23:	83 f8 01             	cmp    $0x1,%eax
+  802e26:	74 2d                	je     802e55 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802e28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e2c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802e30:	48 85 c0             	test   %rax,%rax
+  802e33:	74 56                	je     802e8b <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802e35:	4c 89 ea             	mov    %r13,%rdx
+  802e38:	4c 89 e6             	mov    %r12,%rsi
+  802e3b:	4c 89 f7             	mov    %r14,%rdi
+  802e3e:	ff d0                	call   *%rax
+}
+  802e40:	48 83 c4 10          	add    $0x10,%rsp
+  802e44:	5b                   	pop    %rbx
+  802e45:	41 5c                	pop    %r12
+  802e47:	41 5d                	pop    %r13
+  802e49:	41 5e                	pop    %r14
+  802e4b:	5d                   	pop    %rbp
+  802e4c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802e4d:	48 98                	cltq
+  802e4f:	eb ef                	jmp    802e40 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802e51:	48 98                	cltq
+  802e53:	eb eb                	jmp    802e40 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802e55:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802e5c:	00 00 00 
+  802e5f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802e65:	89 da                	mov    %ebx,%edx
+  802e67:	48 bf 31 5a 80 00 00 	movabs $0x805a31,%rdi
+  802e6e:	00 00 00 
+  802e71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e76:	48 b9 d4 0c 80 00 00 	movabs $0x800cd4,%rcx
+  802e7d:	00 00 00 
+  802e80:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802e82:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e89:	eb b5                	jmp    802e40 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802e8b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802e92:	eb ac                	jmp    802e40 <read+0x6a>
+
+0000000000802e94 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802e94:	55                   	push   %rbp
+  802e95:	48 89 e5             	mov    %rsp,%rbp
+  802e98:	41 57                	push   %r15
+  802e9a:	41 56                	push   %r14
+  802e9c:	41 55                	push   %r13
+  802e9e:	41 54                	push   %r12
+  802ea0:	53                   	push   %rbx
+  802ea1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802ea5:	48 85 d2             	test   %rdx,%rdx
+  802ea8:	74 54                	je     802efe <readn+0x6a>
+  802eaa:	41 89 fd             	mov    %edi,%r13d
+  802ead:	49 89 f6             	mov    %rsi,%r14
+  802eb0:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802eb8:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802ebd:	49 bf d6 2d 80 00 00 	movabs $0x802dd6,%r15
+  802ec4:	00 00 00 
+  802ec7:	4c 89 e2             	mov    %r12,%rdx
+  802eca:	48 29 f2             	sub    %rsi,%rdx
+  802ecd:	4c 01 f6             	add    %r14,%rsi
+  802ed0:	44 89 ef             	mov    %r13d,%edi
+  802ed3:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802ed6:	85 c0                	test   %eax,%eax
+  802ed8:	78 20                	js     802efa <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802eda:	01 c3                	add    %eax,%ebx
+  802edc:	85 c0                	test   %eax,%eax
+  802ede:	74 08                	je     802ee8 <readn+0x54>
+  802ee0:	48 63 f3             	movslq %ebx,%rsi
+  802ee3:	4c 39 e6             	cmp    %r12,%rsi
+  802ee6:	72 df                	jb     802ec7 <readn+0x33>
+    }
+    return res;
+  802ee8:	48 63 c3             	movslq %ebx,%rax
+}
+  802eeb:	48 83 c4 08          	add    $0x8,%rsp
+  802eef:	5b                   	pop    %rbx
+  802ef0:	41 5c                	pop    %r12
+  802ef2:	41 5d                	pop    %r13
+  802ef4:	41 5e                	pop    %r14
+  802ef6:	41 5f                	pop    %r15
+  802ef8:	5d                   	pop    %rbp
+  802ef9:	c3                   	ret
+        if (inc < 0) return inc;
+  802efa:	48 98                	cltq
+  802efc:	eb ed                	jmp    802eeb <readn+0x57>
+    int inc = 1, res = 0;
+  802efe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f03:	eb e3                	jmp    802ee8 <readn+0x54>
+
+0000000000802f05 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802f05:	55                   	push   %rbp
+  802f06:	48 89 e5             	mov    %rsp,%rbp
+  802f09:	41 56                	push   %r14
+  802f0b:	41 55                	push   %r13
+  802f0d:	41 54                	push   %r12
+  802f0f:	53                   	push   %rbx
+  802f10:	48 83 ec 10          	sub    $0x10,%rsp
+  802f14:	89 fb                	mov    %edi,%ebx
+  802f16:	49 89 f4             	mov    %rsi,%r12
+  802f19:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802f1c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f20:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  802f27:	00 00 00 
+  802f2a:	ff d0                	call   *%rax
+  802f2c:	85 c0                	test   %eax,%eax
+  802f2e:	78 47                	js     802f77 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802f30:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802f34:	41 8b 3e             	mov    (%r14),%edi
+  802f37:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f3b:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  802f42:	00 00 00 
+  802f45:	ff d0                	call   *%rax
+  802f47:	85 c0                	test   %eax,%eax
+  802f49:	78 30                	js     802f7b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802f4b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802f50:	74 2d                	je     802f7f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802f52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f56:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802f5a:	48 85 c0             	test   %rax,%rax
+  802f5d:	74 56                	je     802fb5 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802f5f:	4c 89 ea             	mov    %r13,%rdx
+  802f62:	4c 89 e6             	mov    %r12,%rsi
+  802f65:	4c 89 f7             	mov    %r14,%rdi
+  802f68:	ff d0                	call   *%rax
+}
+  802f6a:	48 83 c4 10          	add    $0x10,%rsp
+  802f6e:	5b                   	pop    %rbx
+  802f6f:	41 5c                	pop    %r12
+  802f71:	41 5d                	pop    %r13
+  802f73:	41 5e                	pop    %r14
+  802f75:	5d                   	pop    %rbp
+  802f76:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802f77:	48 98                	cltq
+  802f79:	eb ef                	jmp    802f6a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802f7b:	48 98                	cltq
+  802f7d:	eb eb                	jmp    802f6a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802f7f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802f86:	00 00 00 
+  802f89:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802f8f:	89 da                	mov    %ebx,%edx
+  802f91:	48 bf 4d 5a 80 00 00 	movabs $0x805a4d,%rdi
+  802f98:	00 00 00 
+  802f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa0:	48 b9 d4 0c 80 00 00 	movabs $0x800cd4,%rcx
+  802fa7:	00 00 00 
+  802faa:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802fac:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802fb3:	eb b5                	jmp    802f6a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802fb5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802fbc:	eb ac                	jmp    802f6a <write+0x65>
+
+0000000000802fbe <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802fbe:	55                   	push   %rbp
+  802fbf:	48 89 e5             	mov    %rsp,%rbp
+  802fc2:	53                   	push   %rbx
+  802fc3:	48 83 ec 18          	sub    $0x18,%rsp
+  802fc7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802fc9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802fcd:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  802fd4:	00 00 00 
+  802fd7:	ff d0                	call   *%rax
+  802fd9:	85 c0                	test   %eax,%eax
+  802fdb:	78 0c                	js     802fe9 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802fdd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fe1:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fe9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fed:	c9                   	leave
+  802fee:	c3                   	ret
+
+0000000000802fef <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802fef:	55                   	push   %rbp
+  802ff0:	48 89 e5             	mov    %rsp,%rbp
+  802ff3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802ff7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ffb:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  803002:	00 00 00 
+  803005:	ff d0                	call   *%rax
+  803007:	85 c0                	test   %eax,%eax
+  803009:	78 07                	js     803012 <tell+0x23>
+    return fdes->fd_offset;
+  80300b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80300f:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803012:	c9                   	leave
+  803013:	c3                   	ret
+
+0000000000803014 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803014:	55                   	push   %rbp
+  803015:	48 89 e5             	mov    %rsp,%rbp
+  803018:	41 55                	push   %r13
+  80301a:	41 54                	push   %r12
+  80301c:	53                   	push   %rbx
+  80301d:	48 83 ec 18          	sub    $0x18,%rsp
+  803021:	89 fb                	mov    %edi,%ebx
+  803023:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803026:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80302a:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  803031:	00 00 00 
+  803034:	ff d0                	call   *%rax
+  803036:	85 c0                	test   %eax,%eax
+  803038:	78 38                	js     803072 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80303a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80303e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803042:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803046:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+  803052:	85 c0                	test   %eax,%eax
+  803054:	78 1c                	js     803072 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803056:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80305b:	74 20                	je     80307d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80305d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803061:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803065:	48 85 c0             	test   %rax,%rax
+  803068:	74 47                	je     8030b1 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80306a:	44 89 e6             	mov    %r12d,%esi
+  80306d:	4c 89 ef             	mov    %r13,%rdi
+  803070:	ff d0                	call   *%rax
+}
+  803072:	48 83 c4 18          	add    $0x18,%rsp
+  803076:	5b                   	pop    %rbx
+  803077:	41 5c                	pop    %r12
+  803079:	41 5d                	pop    %r13
+  80307b:	5d                   	pop    %rbp
+  80307c:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80307d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  803084:	00 00 00 
+  803087:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80308d:	89 da                	mov    %ebx,%edx
+  80308f:	48 bf 10 5a 80 00 00 	movabs $0x805a10,%rdi
+  803096:	00 00 00 
+  803099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309e:	48 b9 d4 0c 80 00 00 	movabs $0x800cd4,%rcx
+  8030a5:	00 00 00 
+  8030a8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8030aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030af:	eb c1                	jmp    803072 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8030b1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8030b6:	eb ba                	jmp    803072 <ftruncate+0x5e>
+
+00000000008030b8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8030b8:	55                   	push   %rbp
+  8030b9:	48 89 e5             	mov    %rsp,%rbp
+  8030bc:	41 54                	push   %r12
+  8030be:	53                   	push   %rbx
+  8030bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8030c3:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8030c6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8030ca:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  8030d1:	00 00 00 
+  8030d4:	ff d0                	call   *%rax
+  8030d6:	85 c0                	test   %eax,%eax
+  8030d8:	78 4e                	js     803128 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8030da:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8030de:	41 8b 3c 24          	mov    (%r12),%edi
+  8030e2:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8030e6:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  8030ed:	00 00 00 
+  8030f0:	ff d0                	call   *%rax
+  8030f2:	85 c0                	test   %eax,%eax
+  8030f4:	78 32                	js     803128 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8030f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030fa:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8030ff:	74 30                	je     803131 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  803101:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803104:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80310b:	00 00 00 
+    stat->st_isdir = 0;
+  80310e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803115:	00 00 00 
+    stat->st_dev = dev;
+  803118:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80311f:	48 89 de             	mov    %rbx,%rsi
+  803122:	4c 89 e7             	mov    %r12,%rdi
+  803125:	ff 50 28             	call   *0x28(%rax)
+}
+  803128:	48 83 c4 10          	add    $0x10,%rsp
+  80312c:	5b                   	pop    %rbx
+  80312d:	41 5c                	pop    %r12
+  80312f:	5d                   	pop    %rbp
+  803130:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803131:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803136:	eb f0                	jmp    803128 <fstat+0x70>
+
+0000000000803138 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  803138:	55                   	push   %rbp
+  803139:	48 89 e5             	mov    %rsp,%rbp
+  80313c:	41 54                	push   %r12
+  80313e:	53                   	push   %rbx
+  80313f:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  803146:	41 89 fc             	mov    %edi,%r12d
+  803149:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80314b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80314f:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  803156:	00 00 00 
+  803159:	ff d0                	call   *%rax
+  80315b:	85 c0                	test   %eax,%eax
+  80315d:	78 31                	js     803190 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  80315f:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  803166:	44 89 e7             	mov    %r12d,%edi
+  803169:	48 b8 b8 30 80 00 00 	movabs $0x8030b8,%rax
+  803170:	00 00 00 
+  803173:	ff d0                	call   *%rax
+  803175:	85 c0                	test   %eax,%eax
+  803177:	78 17                	js     803190 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  803179:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80317d:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  803180:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803183:	39 d3                	cmp    %edx,%ebx
+  803185:	0f 4f da             	cmovg  %edx,%ebx
+  803188:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80318b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803190:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  803197:	5b                   	pop    %rbx
+  803198:	41 5c                	pop    %r12
+  80319a:	5d                   	pop    %rbp
+  80319b:	c3                   	ret
+
+000000000080319c <seektoend>:
+{
+  80319c:	55                   	push   %rbp
+  80319d:	48 89 e5             	mov    %rsp,%rbp
+  8031a0:	53                   	push   %rbx
+  8031a1:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  8031a8:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  8031aa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8031ae:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  8031b5:	00 00 00 
+  8031b8:	ff d0                	call   *%rax
+  8031ba:	85 c0                	test   %eax,%eax
+  8031bc:	78 28                	js     8031e6 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  8031be:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8031c5:	89 df                	mov    %ebx,%edi
+  8031c7:	48 b8 b8 30 80 00 00 	movabs $0x8030b8,%rax
+  8031ce:	00 00 00 
+  8031d1:	ff d0                	call   *%rax
+  8031d3:	85 c0                	test   %eax,%eax
+  8031d5:	78 0f                	js     8031e6 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  8031d7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8031da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031de:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  8031e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031ea:	c9                   	leave
+  8031eb:	c3                   	ret
+
+00000000008031ec <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8031ec:	55                   	push   %rbp
+  8031ed:	48 89 e5             	mov    %rsp,%rbp
+  8031f0:	41 54                	push   %r12
+  8031f2:	53                   	push   %rbx
+  8031f3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8031f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8031fb:	48 b8 df 3d 80 00 00 	movabs $0x803ddf,%rax
+  803202:	00 00 00 
+  803205:	ff d0                	call   *%rax
+  803207:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803209:	85 c0                	test   %eax,%eax
+  80320b:	78 25                	js     803232 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80320d:	4c 89 e6             	mov    %r12,%rsi
+  803210:	89 c7                	mov    %eax,%edi
+  803212:	48 b8 b8 30 80 00 00 	movabs $0x8030b8,%rax
+  803219:	00 00 00 
+  80321c:	ff d0                	call   *%rax
+  80321e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803221:	89 df                	mov    %ebx,%edi
+  803223:	48 b8 58 2c 80 00 00 	movabs $0x802c58,%rax
+  80322a:	00 00 00 
+  80322d:	ff d0                	call   *%rax
+
+    return res;
+  80322f:	44 89 e3             	mov    %r12d,%ebx
+}
+  803232:	89 d8                	mov    %ebx,%eax
+  803234:	5b                   	pop    %rbx
+  803235:	41 5c                	pop    %r12
+  803237:	5d                   	pop    %rbp
+  803238:	c3                   	ret
+
+0000000000803239 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  803239:	55                   	push   %rbp
+  80323a:	48 89 e5             	mov    %rsp,%rbp
+  80323d:	53                   	push   %rbx
+  80323e:	48 83 ec 08          	sub    $0x8,%rsp
+  803242:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  803245:	48 b8 65 2a 80 00 00 	movabs $0x802a65,%rax
+  80324c:	00 00 00 
+  80324f:	ff d0                	call   *%rax
+  803251:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803255:	0f 87 ea 00 00 00    	ja     803345 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  80325b:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  803262:	00 00 00 
+  803265:	80 38 00             	cmpb   $0x0,(%rax)
+  803268:	75 35                	jne    80329f <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  80326a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80326f:	ba 00 00 22 00       	mov    $0x220000,%edx
+  803274:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  803279:	bf 00 00 00 00       	mov    $0x0,%edi
+  80327e:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  803285:	00 00 00 
+  803288:	ff d0                	call   *%rax
+  80328a:	85 c0                	test   %eax,%eax
+  80328c:	0f 88 ba 00 00 00    	js     80334c <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  803292:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  803299:	00 00 00 
+  80329c:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  80329f:	48 89 df             	mov    %rbx,%rdi
+  8032a2:	48 b8 65 2a 80 00 00 	movabs $0x802a65,%rax
+  8032a9:	00 00 00 
+  8032ac:	ff d0                	call   *%rax
+  8032ae:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  8032b2:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  8032b9:	00 00 00 
+  8032bc:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  8032c0:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  8032c3:	39 39                	cmp    %edi,(%rcx)
+  8032c5:	74 46                	je     80330d <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  8032c7:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  8032cb:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  8032d2:	00 
+  8032d3:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  8032da:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  8032e1:	00 
+  8032e2:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  8032e9:	00 
+  8032ea:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  8032f1:	00 
+  8032f2:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  8032f9:	00 
+  8032fa:	89 39                	mov    %edi,(%rcx)
+  8032fc:	48 01 c6             	add    %rax,%rsi
+  8032ff:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  803304:	48 89 c8             	mov    %rcx,%rax
+  803307:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80330b:	c9                   	leave
+  80330c:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  80330d:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  803311:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  803318:	00 00 00 
+  80331b:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80331e:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  803322:	74 e0                	je     803304 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  803324:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80332b:	00 
+  80332c:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  803330:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  803337:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  803339:	8b 7b 10             	mov    0x10(%rbx),%edi
+  80333c:	48 01 c2             	add    %rax,%rdx
+  80333f:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  803343:	eb bf                	jmp    803304 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  803345:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80334a:	eb b8                	jmp    803304 <fbuf_get+0xcb>
+            return NULL;
+  80334c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803351:	eb b1                	jmp    803304 <fbuf_get+0xcb>
+
+0000000000803353 <fsipc_bulk>:
+fsipc_bulk(void) {
+  803353:	55                   	push   %rbp
+  803354:	48 89 e5             	mov    %rsp,%rbp
+  803357:	53                   	push   %rbx
+  803358:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  80335c:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  803363:	00 00 00 
+  803366:	48 8b 18             	mov    (%rax),%rbx
+  803369:	48 85 db             	test   %rbx,%rbx
+  80336c:	74 16                	je     803384 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  80336e:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  803375:	00 00 00 
+  803378:	48 8b 18             	mov    (%rax),%rbx
+}
+  80337b:	48 89 d8             	mov    %rbx,%rax
+  80337e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803382:	c9                   	leave
+  803383:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  803384:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803389:	ba 00 10 04 00       	mov    $0x41000,%edx
+  80338e:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  803393:	bf 00 00 00 00       	mov    $0x0,%edi
+  803398:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  80339f:	00 00 00 
+  8033a2:	ff d0                	call   *%rax
+  8033a4:	85 c0                	test   %eax,%eax
+  8033a6:	78 d3                	js     80337b <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  8033a8:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  8033ad:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  8033b4:	00 00 00 
+  8033b7:	eb b5                	jmp    80336e <fsipc_bulk+0x1b>
+
+00000000008033b9 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  8033b9:	55                   	push   %rbp
+  8033ba:	48 89 e5             	mov    %rsp,%rbp
+  8033bd:	41 57                	push   %r15
+  8033bf:	41 56                	push   %r14
+  8033c1:	41 55                	push   %r13
+  8033c3:	41 54                	push   %r12
+  8033c5:	53                   	push   %rbx
+  8033c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8033ca:	41 89 fd             	mov    %edi,%r13d
+  8033cd:	49 89 f6             	mov    %rsi,%r14
+  8033d0:	49 89 d7             	mov    %rdx,%r15
+  8033d3:	48 89 cb             	mov    %rcx,%rbx
+  8033d6:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8033d9:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8033e0:	00 00 00 
+  8033e3:	83 38 00             	cmpl   $0x0,(%rax)
+  8033e6:	74 52                	je     80343a <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  8033e8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8033ee:	4c 89 f9             	mov    %r15,%rcx
+  8033f1:	4c 89 f2             	mov    %r14,%rdx
+  8033f4:	44 89 ee             	mov    %r13d,%esi
+  8033f7:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8033fe:	00 00 00 
+  803401:	8b 38                	mov    (%rax),%edi
+  803403:	48 b8 72 29 80 00 00 	movabs $0x802972,%rax
+  80340a:	00 00 00 
+  80340d:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  80340f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803414:	4c 89 e2             	mov    %r12,%rdx
+  803417:	48 89 de             	mov    %rbx,%rsi
+  80341a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80341f:	48 b8 c2 27 80 00 00 	movabs $0x8027c2,%rax
+  803426:	00 00 00 
+  803429:	ff d0                	call   *%rax
+}
+  80342b:	48 83 c4 08          	add    $0x8,%rsp
+  80342f:	5b                   	pop    %rbx
+  803430:	41 5c                	pop    %r12
+  803432:	41 5d                	pop    %r13
+  803434:	41 5e                	pop    %r14
+  803436:	41 5f                	pop    %r15
+  803438:	5d                   	pop    %rbp
+  803439:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80343a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80343f:	48 b8 15 2a 80 00 00 	movabs $0x802a15,%rax
+  803446:	00 00 00 
+  803449:	ff d0                	call   *%rax
+  80344b:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  803452:	00 00 
+  803454:	eb 92                	jmp    8033e8 <fsipc_region+0x2f>
+
+0000000000803456 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  803456:	55                   	push   %rbp
+  803457:	48 89 e5             	mov    %rsp,%rbp
+  80345a:	41 57                	push   %r15
+  80345c:	41 56                	push   %r14
+  80345e:	41 55                	push   %r13
+  803460:	41 54                	push   %r12
+  803462:	53                   	push   %rbx
+  803463:	48 83 ec 28          	sub    $0x28,%rsp
+  803467:	49 89 ff             	mov    %rdi,%r15
+  80346a:	49 89 f6             	mov    %rsi,%r14
+  80346d:	48 89 d3             	mov    %rdx,%rbx
+  803470:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803474:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  803477:	48 b8 53 33 80 00 00 	movabs $0x803353,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  803483:	48 85 c0             	test   %rax,%rax
+  803486:	0f 84 cc 00 00 00    	je     803558 <devfile_write_direct+0x102>
+  80348c:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  80348f:	48 85 db             	test   %rbx,%rbx
+  803492:	0f 84 ba 00 00 00    	je     803552 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  803498:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  80349e:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8034a5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  8034a9:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8034ad:	4c 29 e3             	sub    %r12,%rbx
+  8034b0:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8034b5:	48 39 c3             	cmp    %rax,%rbx
+  8034b8:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  8034bc:	48 89 da             	mov    %rbx,%rdx
+  8034bf:	4c 89 f6             	mov    %r14,%rsi
+  8034c2:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8034c6:	48 b8 41 1a 80 00 00 	movabs $0x801a41,%rax
+  8034cd:	00 00 00 
+  8034d0:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8034d2:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8034d6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  8034da:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8034dd:	44 01 e0             	add    %r12d,%eax
+  8034e0:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  8034e4:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  8034e8:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  8034ef:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8034f6:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  8034fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803503:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803508:	4c 89 ee             	mov    %r13,%rsi
+  80350b:	bf 04 00 00 00       	mov    $0x4,%edi
+  803510:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  803517:	00 00 00 
+  80351a:	ff d0                	call   *%rax
+        if (res < 0)
+  80351c:	85 c0                	test   %eax,%eax
+  80351e:	78 29                	js     803549 <devfile_write_direct+0xf3>
+        if (res == 0)
+  803520:	74 2b                	je     80354d <devfile_write_direct+0xf7>
+        i += res;
+  803522:	48 98                	cltq
+  803524:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  803527:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  80352a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80352e:	49 39 c4             	cmp    %rax,%r12
+  803531:	0f 82 72 ff ff ff    	jb     8034a9 <devfile_write_direct+0x53>
+    return i;
+  803537:	4c 89 e0             	mov    %r12,%rax
+}
+  80353a:	48 83 c4 28          	add    $0x28,%rsp
+  80353e:	5b                   	pop    %rbx
+  80353f:	41 5c                	pop    %r12
+  803541:	41 5d                	pop    %r13
+  803543:	41 5e                	pop    %r14
+  803545:	41 5f                	pop    %r15
+  803547:	5d                   	pop    %rbp
+  803548:	c3                   	ret
+            return res;
+  803549:	48 98                	cltq
+  80354b:	eb ed                	jmp    80353a <devfile_write_direct+0xe4>
+            return i;
+  80354d:	4c 89 e0             	mov    %r12,%rax
+  803550:	eb e8                	jmp    80353a <devfile_write_direct+0xe4>
+    size_t i = 0;
+  803552:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  803556:	eb df                	jmp    803537 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  803558:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  80355f:	eb d9                	jmp    80353a <devfile_write_direct+0xe4>
+
+0000000000803561 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  803561:	55                   	push   %rbp
+  803562:	48 89 e5             	mov    %rsp,%rbp
+  803565:	41 56                	push   %r14
+  803567:	41 55                	push   %r13
+  803569:	41 54                	push   %r12
+  80356b:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  80356c:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  803570:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  803574:	b8 00 00 00 00       	mov    $0x0,%eax
+  803579:	4d 39 ee             	cmp    %r13,%r14
+  80357c:	0f 84 99 00 00 00    	je     80361b <fbuf_flush+0xba>
+  803582:	49 89 fc             	mov    %rdi,%r12
+  803585:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  803588:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  80358b:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80358f:	48 b8 65 2a 80 00 00 	movabs $0x802a65,%rax
+  803596:	00 00 00 
+  803599:	ff d0                	call   *%rax
+  80359b:	48 89 c2             	mov    %rax,%rdx
+  80359e:	48 c1 e2 04          	shl    $0x4,%rdx
+  8035a2:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8035a6:	48 c1 e0 0c          	shl    $0xc,%rax
+  8035aa:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8035af:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  8035b2:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8035b6:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8035bd:	00 
+  8035be:	44 89 f1             	mov    %r14d,%ecx
+  8035c1:	4c 89 ea             	mov    %r13,%rdx
+  8035c4:	4c 89 e7             	mov    %r12,%rdi
+  8035c7:	48 b8 56 34 80 00 00 	movabs $0x803456,%rax
+  8035ce:	00 00 00 
+  8035d1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035d3:	48 85 c0             	test   %rax,%rax
+  8035d6:	78 43                	js     80361b <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  8035d8:	4c 39 e8             	cmp    %r13,%rax
+  8035db:	72 47                	jb     803624 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  8035dd:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8035e2:	83 c0 01             	add    $0x1,%eax
+  8035e5:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8035ea:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  8035ed:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8035f1:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  8035f5:	72 0f                	jb     803606 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  8035f7:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8035fb:	48 39 c2             	cmp    %rax,%rdx
+  8035fe:	48 0f 42 d0          	cmovb  %rax,%rdx
+  803602:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  803606:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  80360d:	00 
+  80360e:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  803615:	00 
+    return 0;
+  803616:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80361b:	5b                   	pop    %rbx
+  80361c:	41 5c                	pop    %r12
+  80361e:	41 5d                	pop    %r13
+  803620:	41 5e                	pop    %r14
+  803622:	5d                   	pop    %rbp
+  803623:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  803624:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803629:	eb f0                	jmp    80361b <fbuf_flush+0xba>
+
+000000000080362b <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  80362b:	55                   	push   %rbp
+  80362c:	48 89 e5             	mov    %rsp,%rbp
+  80362f:	53                   	push   %rbx
+  803630:	48 83 ec 08          	sub    $0x8,%rsp
+  803634:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  803637:	48 b8 39 32 80 00 00 	movabs $0x803239,%rax
+  80363e:	00 00 00 
+  803641:	ff d0                	call   *%rax
+  803643:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  803646:	b8 00 00 00 00       	mov    $0x0,%eax
+  80364b:	48 85 f6             	test   %rsi,%rsi
+  80364e:	74 0f                	je     80365f <devfile_sync+0x34>
+  803650:	48 89 df             	mov    %rbx,%rdi
+  803653:	48 b8 61 35 80 00 00 	movabs $0x803561,%rax
+  80365a:	00 00 00 
+  80365d:	ff d0                	call   *%rax
+}
+  80365f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803663:	c9                   	leave
+  803664:	c3                   	ret
+
+0000000000803665 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  803665:	55                   	push   %rbp
+  803666:	48 89 e5             	mov    %rsp,%rbp
+  803669:	48 83 ec 10          	sub    $0x10,%rsp
+  80366d:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  803670:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  803677:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  803678:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  80367c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803681:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803688:	00 00 00 
+  80368b:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  803692:	00 00 00 
+  803695:	ff d0                	call   *%rax
+}
+  803697:	c9                   	leave
+  803698:	c3                   	ret
+
+0000000000803699 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803699:	55                   	push   %rbp
+  80369a:	48 89 e5             	mov    %rsp,%rbp
+  80369d:	41 54                	push   %r12
+  80369f:	53                   	push   %rbx
+  8036a0:	48 89 fb             	mov    %rdi,%rbx
+  8036a3:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  8036a6:	48 b8 2b 36 80 00 00 	movabs $0x80362b,%rax
+  8036ad:	00 00 00 
+  8036b0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036b2:	85 c0                	test   %eax,%eax
+  8036b4:	78 63                	js     803719 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8036b6:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8036b9:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8036c0:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  8036c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8036c7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8036cc:	48 b8 65 36 80 00 00 	movabs $0x803665,%rax
+  8036d3:	00 00 00 
+  8036d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036d8:	85 c0                	test   %eax,%eax
+  8036da:	78 3d                	js     803719 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8036dc:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8036e3:	00 00 00 
+  8036e6:	48 89 de             	mov    %rbx,%rsi
+  8036e9:	4c 89 e7             	mov    %r12,%rdi
+  8036ec:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  8036f3:	00 00 00 
+  8036f6:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036f8:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  8036fe:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  803705:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803706:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  80370c:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  803713:	00 
+
+    return 0;
+  803714:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803719:	5b                   	pop    %rbx
+  80371a:	41 5c                	pop    %r12
+  80371c:	5d                   	pop    %rbp
+  80371d:	c3                   	ret
+
+000000000080371e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80371e:	55                   	push   %rbp
+  80371f:	48 89 e5             	mov    %rsp,%rbp
+  803722:	41 54                	push   %r12
+  803724:	53                   	push   %rbx
+  803725:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  803728:	48 b8 2b 36 80 00 00 	movabs $0x80362b,%rax
+  80372f:	00 00 00 
+  803732:	ff d0                	call   *%rax
+  803734:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  803737:	48 89 df             	mov    %rbx,%rdi
+  80373a:	48 b8 65 2a 80 00 00 	movabs $0x802a65,%rax
+  803741:	00 00 00 
+  803744:	ff d0                	call   *%rax
+  803746:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80374a:	76 2e                	jbe    80377a <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  80374c:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80374f:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803756:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  803758:	be 00 00 00 00       	mov    $0x0,%esi
+  80375d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803762:	48 b8 65 36 80 00 00 	movabs $0x803665,%rax
+  803769:	00 00 00 
+  80376c:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  80376e:	45 85 e4             	test   %r12d,%r12d
+  803771:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  803775:	5b                   	pop    %rbx
+  803776:	41 5c                	pop    %r12
+  803778:	5d                   	pop    %rbp
+  803779:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  80377a:	48 89 df             	mov    %rbx,%rdi
+  80377d:	48 b8 65 2a 80 00 00 	movabs $0x802a65,%rax
+  803784:	00 00 00 
+  803787:	ff d0                	call   *%rax
+  803789:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80378d:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  803794:	00 00 00 
+  803797:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  80379e:	48 89 df             	mov    %rbx,%rdi
+  8037a1:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  8037a8:	00 00 00 
+  8037ab:	ff d0                	call   *%rax
+  8037ad:	48 89 c6             	mov    %rax,%rsi
+  8037b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ba:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  8037c1:	00 00 00 
+  8037c4:	ff d0                	call   *%rax
+  8037c6:	eb 84                	jmp    80374c <devfile_flush+0x2e>
+
+00000000008037c8 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8037c8:	55                   	push   %rbp
+  8037c9:	48 89 e5             	mov    %rsp,%rbp
+  8037cc:	41 55                	push   %r13
+  8037ce:	41 54                	push   %r12
+  8037d0:	53                   	push   %rbx
+  8037d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8037d5:	48 89 fb             	mov    %rdi,%rbx
+  8037d8:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  8037db:	48 b8 39 32 80 00 00 	movabs $0x803239,%rax
+  8037e2:	00 00 00 
+  8037e5:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8037e7:	48 85 c0             	test   %rax,%rax
+  8037ea:	74 51                	je     80383d <devfile_trunc+0x75>
+  8037ec:	49 89 c4             	mov    %rax,%r12
+  8037ef:	48 89 c6             	mov    %rax,%rsi
+  8037f2:	48 89 df             	mov    %rbx,%rdi
+  8037f5:	48 b8 61 35 80 00 00 	movabs $0x803561,%rax
+  8037fc:	00 00 00 
+  8037ff:	ff d0                	call   *%rax
+  803801:	85 c0                	test   %eax,%eax
+  803803:	78 2d                	js     803832 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803805:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  80380c:	00 00 00 
+  80380f:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803812:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803814:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803818:	be 00 00 00 00       	mov    $0x0,%esi
+  80381d:	bf 02 00 00 00       	mov    $0x2,%edi
+  803822:	48 b8 65 36 80 00 00 	movabs $0x803665,%rax
+  803829:	00 00 00 
+  80382c:	ff d0                	call   *%rax
+    if (res >= 0) {
+  80382e:	85 c0                	test   %eax,%eax
+  803830:	79 3e                	jns    803870 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  803832:	48 83 c4 08          	add    $0x8,%rsp
+  803836:	5b                   	pop    %rbx
+  803837:	41 5c                	pop    %r12
+  803839:	41 5d                	pop    %r13
+  80383b:	5d                   	pop    %rbp
+  80383c:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80383d:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  803844:	00 00 00 
+  803847:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80384a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80384c:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803850:	be 00 00 00 00       	mov    $0x0,%esi
+  803855:	bf 02 00 00 00       	mov    $0x2,%edi
+  80385a:	48 b8 65 36 80 00 00 	movabs $0x803665,%rax
+  803861:	00 00 00 
+  803864:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803866:	85 c0                	test   %eax,%eax
+  803868:	78 c8                	js     803832 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  80386a:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80386e:	eb c2                	jmp    803832 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803870:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  803873:	8d 51 01             	lea    0x1(%rcx),%edx
+  803876:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803879:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  80387e:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803885:	00 00 
+  803887:	eb a9                	jmp    803832 <devfile_trunc+0x6a>
+
+0000000000803889 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803889:	55                   	push   %rbp
+  80388a:	48 89 e5             	mov    %rsp,%rbp
+  80388d:	41 57                	push   %r15
+  80388f:	41 56                	push   %r14
+  803891:	41 55                	push   %r13
+  803893:	41 54                	push   %r12
+  803895:	53                   	push   %rbx
+  803896:	48 83 ec 28          	sub    $0x28,%rsp
+  80389a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80389e:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8038a2:	49 89 d7             	mov    %rdx,%r15
+  8038a5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8038a9:	48 b8 39 32 80 00 00 	movabs $0x803239,%rax
+  8038b0:	00 00 00 
+  8038b3:	ff d0                	call   *%rax
+  8038b5:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  8038b8:	48 85 c0             	test   %rax,%rax
+  8038bb:	74 31                	je     8038ee <devfile_write+0x65>
+  8038bd:	4c 89 f8             	mov    %r15,%rax
+  8038c0:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  8038c7:	77 25                	ja     8038ee <devfile_write+0x65>
+    size_t i = 0;
+  8038c9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  8038cf:	48 85 c0             	test   %rax,%rax
+  8038d2:	0f 85 64 01 00 00    	jne    803a3c <devfile_write+0x1b3>
+    size_t i = 0;
+  8038d8:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  8038dc:	4c 89 f8             	mov    %r15,%rax
+}
+  8038df:	48 83 c4 28          	add    $0x28,%rsp
+  8038e3:	5b                   	pop    %rbx
+  8038e4:	41 5c                	pop    %r12
+  8038e6:	41 5d                	pop    %r13
+  8038e8:	41 5e                	pop    %r14
+  8038ea:	41 5f                	pop    %r15
+  8038ec:	5d                   	pop    %rbp
+  8038ed:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8038ee:	48 85 db             	test   %rbx,%rbx
+  8038f1:	74 5b                	je     80394e <devfile_write+0xc5>
+  8038f3:	48 89 de             	mov    %rbx,%rsi
+  8038f6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038fa:	48 b8 61 35 80 00 00 	movabs $0x803561,%rax
+  803901:	00 00 00 
+  803904:	ff d0                	call   *%rax
+  803906:	85 c0                	test   %eax,%eax
+  803908:	78 40                	js     80394a <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80390a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80390e:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  803911:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803915:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803919:	48 b8 56 34 80 00 00 	movabs $0x803456,%rax
+  803920:	00 00 00 
+  803923:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803925:	48 85 c0             	test   %rax,%rax
+  803928:	7e b5                	jle    8038df <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  80392a:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  80392e:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  803931:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  803934:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803937:	8d 51 01             	lea    0x1(%rcx),%edx
+  80393a:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80393d:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  803940:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803947:	00 
+  803948:	eb 95                	jmp    8038df <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80394a:	48 98                	cltq
+  80394c:	eb 91                	jmp    8038df <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80394e:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803952:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  803955:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803959:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80395d:	48 89 df             	mov    %rbx,%rdi
+  803960:	48 b8 56 34 80 00 00 	movabs $0x803456,%rax
+  803967:	00 00 00 
+  80396a:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80396c:	48 85 c0             	test   %rax,%rax
+  80396f:	0f 8e 6a ff ff ff    	jle    8038df <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803975:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  803978:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80397c:	e9 5e ff ff ff       	jmp    8038df <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803981:	48 98                	cltq
+  803983:	4d 85 ff             	test   %r15,%r15
+  803986:	49 0f 45 c7          	cmovne %r15,%rax
+  80398a:	e9 50 ff ff ff       	jmp    8038df <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  80398f:	48 89 de             	mov    %rbx,%rsi
+  803992:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803996:	48 b8 61 35 80 00 00 	movabs $0x803561,%rax
+  80399d:	00 00 00 
+  8039a0:	ff d0                	call   *%rax
+  8039a2:	85 c0                	test   %eax,%eax
+  8039a4:	0f 88 2b 01 00 00    	js     803ad5 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8039aa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039ae:	4c 01 f8             	add    %r15,%rax
+  8039b1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8039b5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039b9:	48 b9 65 2a 80 00 00 	movabs $0x802a65,%rcx
+  8039c0:	00 00 00 
+  8039c3:	ff d1                	call   *%rcx
+  8039c5:	48 89 c2             	mov    %rax,%rdx
+  8039c8:	48 c1 e2 04          	shl    $0x4,%rdx
+  8039cc:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8039d0:	48 c1 e0 0c          	shl    $0xc,%rax
+  8039d4:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  8039d9:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8039dc:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8039e3:	00 
+  8039e4:	4c 89 ea             	mov    %r13,%rdx
+  8039e7:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8039eb:	48 b8 41 1a 80 00 00 	movabs $0x801a41,%rax
+  8039f2:	00 00 00 
+  8039f5:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  8039f7:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8039fb:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8039ff:	48 39 c2             	cmp    %rax,%rdx
+  803a02:	0f 84 db 00 00 00    	je     803ae3 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803a08:	4c 39 e2             	cmp    %r12,%rdx
+  803a0b:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  803a0f:	4d 01 ec             	add    %r13,%r12
+  803a12:	49 39 c4             	cmp    %rax,%r12
+  803a15:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803a19:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803a1d:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  803a21:	45 01 ee             	add    %r13d,%r14d
+  803a24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a28:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803a2c:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803a2f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a33:	49 39 c7             	cmp    %rax,%r15
+  803a36:	0f 83 a0 fe ff ff    	jae    8038dc <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803a3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a40:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  803a44:	8b 43 08             	mov    0x8(%rbx),%eax
+  803a47:	44 39 f0             	cmp    %r14d,%eax
+  803a4a:	7f 10                	jg     803a5c <devfile_write+0x1d3>
+  803a4c:	48 98                	cltq
+  803a4e:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  803a54:	49 63 d6             	movslq %r14d,%rdx
+  803a57:	48 39 d0             	cmp    %rdx,%rax
+  803a5a:	7d 2d                	jge    803a89 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803a5c:	48 89 de             	mov    %rbx,%rsi
+  803a5f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a63:	48 b8 61 35 80 00 00 	movabs $0x803561,%rax
+  803a6a:	00 00 00 
+  803a6d:	ff d0                	call   *%rax
+  803a6f:	85 c0                	test   %eax,%eax
+  803a71:	0f 88 0a ff ff ff    	js     803981 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803a77:	44 89 f0             	mov    %r14d,%eax
+  803a7a:	66 b8 00 00          	mov    $0x0,%ax
+  803a7e:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803a81:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803a88:	00 
+        size_t off = pos - fb->fb_base;
+  803a89:	45 89 f4             	mov    %r14d,%r12d
+  803a8c:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803a90:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803a93:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803a97:	4d 29 fd             	sub    %r15,%r13
+  803a9a:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803a9f:	4c 29 e0             	sub    %r12,%rax
+  803aa2:	49 39 c5             	cmp    %rax,%r13
+  803aa5:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803aa9:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803aad:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803ab1:	48 39 c2             	cmp    %rax,%rdx
+  803ab4:	0f 84 f0 fe ff ff    	je     8039aa <devfile_write+0x121>
+  803aba:	4c 39 e0             	cmp    %r12,%rax
+  803abd:	0f 82 cc fe ff ff    	jb     80398f <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803ac3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803ac7:	48 39 d0             	cmp    %rdx,%rax
+  803aca:	0f 83 da fe ff ff    	jae    8039aa <devfile_write+0x121>
+  803ad0:	e9 ba fe ff ff       	jmp    80398f <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803ad5:	48 98                	cltq
+  803ad7:	4d 85 ff             	test   %r15,%r15
+  803ada:	49 0f 45 c7          	cmovne %r15,%rax
+  803ade:	e9 fc fd ff ff       	jmp    8038df <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803ae3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803ae7:	4c 89 e2             	mov    %r12,%rdx
+  803aea:	e9 2a ff ff ff       	jmp    803a19 <devfile_write+0x190>
+
+0000000000803aef <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803aef:	55                   	push   %rbp
+  803af0:	48 89 e5             	mov    %rsp,%rbp
+  803af3:	41 57                	push   %r15
+  803af5:	41 56                	push   %r14
+  803af7:	41 55                	push   %r13
+  803af9:	41 54                	push   %r12
+  803afb:	53                   	push   %rbx
+  803afc:	48 83 ec 28          	sub    $0x28,%rsp
+  803b00:	49 89 ff             	mov    %rdi,%r15
+  803b03:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803b07:	48 89 d3             	mov    %rdx,%rbx
+  803b0a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803b0e:	48 b8 39 32 80 00 00 	movabs $0x803239,%rax
+  803b15:	00 00 00 
+  803b18:	ff d0                	call   *%rax
+  803b1a:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803b1d:	48 85 c0             	test   %rax,%rax
+  803b20:	74 0d                	je     803b2f <devfile_read+0x40>
+  803b22:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803b29:	0f 86 1a 01 00 00    	jbe    803c49 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803b2f:	4d 85 e4             	test   %r12,%r12
+  803b32:	74 1a                	je     803b4e <devfile_read+0x5f>
+  803b34:	4c 89 e6             	mov    %r12,%rsi
+  803b37:	4c 89 ff             	mov    %r15,%rdi
+  803b3a:	48 b8 61 35 80 00 00 	movabs $0x803561,%rax
+  803b41:	00 00 00 
+  803b44:	ff d0                	call   *%rax
+  803b46:	85 c0                	test   %eax,%eax
+  803b48:	0f 88 e8 00 00 00    	js     803c36 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803b4e:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  803b52:	48 b8 53 33 80 00 00 	movabs $0x803353,%rax
+  803b59:	00 00 00 
+  803b5c:	ff d0                	call   *%rax
+  803b5e:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803b61:	48 85 c0             	test   %rax,%rax
+  803b64:	0f 84 69 02 00 00    	je     803dd3 <devfile_read+0x2e4>
+    while (i < n) {
+  803b6a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b6f:	0f 84 ce 00 00 00    	je     803c43 <devfile_read+0x154>
+    size_t i = 0;
+  803b75:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803b7a:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803b81:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803b85:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  803b89:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803b8d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b91:	48 29 da             	sub    %rbx,%rdx
+  803b94:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803b99:	48 39 c2             	cmp    %rax,%rdx
+  803b9c:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803ba0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803ba4:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803ba8:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803bab:	01 d8                	add    %ebx,%eax
+  803bad:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803bb1:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803bb5:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803bbc:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803bc3:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803bca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803bd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803bd5:	4c 89 ee             	mov    %r13,%rsi
+  803bd8:	bf 03 00 00 00       	mov    $0x3,%edi
+  803bdd:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  803be4:	00 00 00 
+  803be7:	ff d0                	call   *%rax
+        if (res < 0)
+  803be9:	85 c0                	test   %eax,%eax
+  803beb:	78 4d                	js     803c3a <devfile_read+0x14b>
+        if (res == 0)
+  803bed:	74 4f                	je     803c3e <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803bef:	4c 63 e0             	movslq %eax,%r12
+  803bf2:	4c 89 e2             	mov    %r12,%rdx
+  803bf5:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803bf9:	4c 89 f7             	mov    %r14,%rdi
+  803bfc:	48 b8 41 1a 80 00 00 	movabs $0x801a41,%rax
+  803c03:	00 00 00 
+  803c06:	ff d0                	call   *%rax
+        i += res;
+  803c08:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803c0b:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803c0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c12:	48 39 c3             	cmp    %rax,%rbx
+  803c15:	0f 82 72 ff ff ff    	jb     803b8d <devfile_read+0x9e>
+    return i;
+  803c1b:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803c1e:	48 85 c0             	test   %rax,%rax
+  803c21:	7e 04                	jle    803c27 <devfile_read+0x138>
+  803c23:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803c27:	48 83 c4 28          	add    $0x28,%rsp
+  803c2b:	5b                   	pop    %rbx
+  803c2c:	41 5c                	pop    %r12
+  803c2e:	41 5d                	pop    %r13
+  803c30:	41 5e                	pop    %r14
+  803c32:	41 5f                	pop    %r15
+  803c34:	5d                   	pop    %rbp
+  803c35:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803c36:	48 98                	cltq
+  803c38:	eb ed                	jmp    803c27 <devfile_read+0x138>
+            return res;
+  803c3a:	48 98                	cltq
+  803c3c:	eb e9                	jmp    803c27 <devfile_read+0x138>
+            return i;
+  803c3e:	48 89 d8             	mov    %rbx,%rax
+  803c41:	eb db                	jmp    803c1e <devfile_read+0x12f>
+    size_t i = 0;
+  803c43:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803c47:	eb d2                	jmp    803c1b <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803c49:	48 89 c6             	mov    %rax,%rsi
+  803c4c:	4c 89 ff             	mov    %r15,%rdi
+  803c4f:	48 b8 61 35 80 00 00 	movabs $0x803561,%rax
+  803c56:	00 00 00 
+  803c59:	ff d0                	call   *%rax
+  803c5b:	85 c0                	test   %eax,%eax
+  803c5d:	78 40                	js     803c9f <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803c5f:	4c 89 ff             	mov    %r15,%rdi
+  803c62:	48 b8 65 2a 80 00 00 	movabs $0x802a65,%rax
+  803c69:	00 00 00 
+  803c6c:	ff d0                	call   *%rax
+  803c6e:	48 89 c2             	mov    %rax,%rdx
+  803c71:	48 c1 e2 04          	shl    $0x4,%rdx
+  803c75:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803c79:	48 c1 e0 0c          	shl    $0xc,%rax
+  803c7d:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803c82:	48 01 d0             	add    %rdx,%rax
+  803c85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  803c89:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c8e:	0f 84 33 01 00 00    	je     803dc7 <devfile_read+0x2d8>
+    size_t i = 0;
+  803c94:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803c9a:	e9 f5 00 00 00       	jmp    803d94 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803c9f:	48 98                	cltq
+  803ca1:	eb 84                	jmp    803c27 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803ca3:	44 89 e8             	mov    %r13d,%eax
+  803ca6:	66 b8 00 00          	mov    $0x0,%ax
+  803caa:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803caf:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803cb6:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803cb8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803cbc:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803cc0:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803cc2:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803cc7:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803cca:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803cd1:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803cd2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803cd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cdd:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803ce2:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ce7:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  803cee:	00 00 00 
+  803cf1:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803cf3:	85 c0                	test   %eax,%eax
+  803cf5:	0f 88 be 00 00 00    	js     803db9 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803cfb:	48 63 d0             	movslq %eax,%rdx
+  803cfe:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803d03:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803d08:	44 39 e8             	cmp    %r13d,%eax
+  803d0b:	0f 8e ba 00 00 00    	jle    803dcb <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803d11:	49 63 c5             	movslq %r13d,%rax
+  803d14:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803d19:	48 29 c3             	sub    %rax,%rbx
+  803d1c:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  803d21:	48 01 c3             	add    %rax,%rbx
+  803d24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d28:	4c 29 f0             	sub    %r14,%rax
+  803d2b:	48 39 c3             	cmp    %rax,%rbx
+  803d2e:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803d32:	4c 89 ff             	mov    %r15,%rdi
+  803d35:	48 b9 65 2a 80 00 00 	movabs $0x802a65,%rcx
+  803d3c:	00 00 00 
+  803d3f:	ff d1                	call   *%rcx
+  803d41:	48 89 c2             	mov    %rax,%rdx
+  803d44:	48 c1 e2 04          	shl    $0x4,%rdx
+  803d48:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803d4c:	48 c1 e0 0c          	shl    $0xc,%rax
+  803d50:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803d55:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803d58:	44 89 ea             	mov    %r13d,%edx
+  803d5b:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803d60:	48 63 d2             	movslq %edx,%rdx
+  803d63:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803d6a:	00 
+  803d6b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803d6f:	4c 01 f7             	add    %r14,%rdi
+  803d72:	48 89 da             	mov    %rbx,%rdx
+  803d75:	48 b9 41 1a 80 00 00 	movabs $0x801a41,%rcx
+  803d7c:	00 00 00 
+  803d7f:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803d81:	41 01 dd             	add    %ebx,%r13d
+  803d84:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803d88:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803d8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d8f:	49 39 c6             	cmp    %rax,%r14
+  803d92:	73 37                	jae    803dcb <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803d94:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803d98:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803d9d:	44 39 e8             	cmp    %r13d,%eax
+  803da0:	0f 8f fd fe ff ff    	jg     803ca3 <devfile_read+0x1b4>
+  803da6:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803dab:	44 39 e8             	cmp    %r13d,%eax
+  803dae:	0f 8f 5d ff ff ff    	jg     803d11 <devfile_read+0x222>
+  803db4:	e9 ea fe ff ff       	jmp    803ca3 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803db9:	48 98                	cltq
+  803dbb:	4d 85 f6             	test   %r14,%r14
+  803dbe:	49 0f 45 c6          	cmovne %r14,%rax
+  803dc2:	e9 60 fe ff ff       	jmp    803c27 <devfile_read+0x138>
+    size_t i = 0;
+  803dc7:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803dcb:	4c 89 f0             	mov    %r14,%rax
+  803dce:	e9 54 fe ff ff       	jmp    803c27 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803dd3:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803dda:	e9 48 fe ff ff       	jmp    803c27 <devfile_read+0x138>
+
+0000000000803ddf <open>:
+open(const char *path, int mode) {
+  803ddf:	55                   	push   %rbp
+  803de0:	48 89 e5             	mov    %rsp,%rbp
+  803de3:	41 55                	push   %r13
+  803de5:	41 54                	push   %r12
+  803de7:	53                   	push   %rbx
+  803de8:	48 83 ec 18          	sub    $0x18,%rsp
+  803dec:	49 89 fc             	mov    %rdi,%r12
+  803def:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803df2:	48 b8 0e 16 80 00 00 	movabs $0x80160e,%rax
+  803df9:	00 00 00 
+  803dfc:	ff d0                	call   *%rax
+  803dfe:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803e04:	0f 87 8a 00 00 00    	ja     803e94 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803e0a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803e0e:	48 b8 93 2a 80 00 00 	movabs $0x802a93,%rax
+  803e15:	00 00 00 
+  803e18:	ff d0                	call   *%rax
+  803e1a:	89 c3                	mov    %eax,%ebx
+  803e1c:	85 c0                	test   %eax,%eax
+  803e1e:	78 50                	js     803e70 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803e20:	4c 89 e6             	mov    %r12,%rsi
+  803e23:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803e2a:	00 00 00 
+  803e2d:	48 89 df             	mov    %rbx,%rdi
+  803e30:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  803e37:	00 00 00 
+  803e3a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803e3c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803e43:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e47:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e4c:	48 b8 65 36 80 00 00 	movabs $0x803665,%rax
+  803e53:	00 00 00 
+  803e56:	ff d0                	call   *%rax
+  803e58:	89 c3                	mov    %eax,%ebx
+  803e5a:	85 c0                	test   %eax,%eax
+  803e5c:	78 1f                	js     803e7d <open+0x9e>
+    return fd2num(fd);
+  803e5e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e62:	48 b8 65 2a 80 00 00 	movabs $0x802a65,%rax
+  803e69:	00 00 00 
+  803e6c:	ff d0                	call   *%rax
+  803e6e:	89 c3                	mov    %eax,%ebx
+}
+  803e70:	89 d8                	mov    %ebx,%eax
+  803e72:	48 83 c4 18          	add    $0x18,%rsp
+  803e76:	5b                   	pop    %rbx
+  803e77:	41 5c                	pop    %r12
+  803e79:	41 5d                	pop    %r13
+  803e7b:	5d                   	pop    %rbp
+  803e7c:	c3                   	ret
+        fd_close(fd, 0);
+  803e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  803e82:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e86:	48 b8 ae 2b 80 00 00 	movabs $0x802bae,%rax
+  803e8d:	00 00 00 
+  803e90:	ff d0                	call   *%rax
+        return res;
+  803e92:	eb dc                	jmp    803e70 <open+0x91>
+        return -E_BAD_PATH;
+  803e94:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803e99:	eb d5                	jmp    803e70 <open+0x91>
+
+0000000000803e9b <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803e9b:	55                   	push   %rbp
+  803e9c:	48 89 e5             	mov    %rsp,%rbp
+  803e9f:	41 57                	push   %r15
+  803ea1:	41 56                	push   %r14
+  803ea3:	41 55                	push   %r13
+  803ea5:	41 54                	push   %r12
+  803ea7:	53                   	push   %rbx
+  803ea8:	48 83 ec 18          	sub    $0x18,%rsp
+  803eac:	41 89 f6             	mov    %esi,%r14d
+  803eaf:	49 89 d7             	mov    %rdx,%r15
+  803eb2:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803eb5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803eb9:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  803ec0:	00 00 00 
+  803ec3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ec5:	85 c0                	test   %eax,%eax
+  803ec7:	0f 88 db 00 00 00    	js     803fa8 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ecd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ed1:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803ed8:	00 00 00 
+  803edb:	8b 00                	mov    (%rax),%eax
+  803edd:	39 07                	cmp    %eax,(%rdi)
+  803edf:	0f 85 db 00 00 00    	jne    803fc0 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803ee5:	45 85 f6             	test   %r14d,%r14d
+  803ee8:	0f 88 db 00 00 00    	js     803fc9 <fmap+0x12e>
+  803eee:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803ef5:	0f 85 d7 00 00 00    	jne    803fd2 <fmap+0x137>
+  803efb:	4c 89 fb             	mov    %r15,%rbx
+  803efe:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803f04:	0f 85 d1 00 00 00    	jne    803fdb <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803f0a:	48 b8 2b 36 80 00 00 	movabs $0x80362b,%rax
+  803f11:	00 00 00 
+  803f14:	ff d0                	call   *%rax
+  803f16:	85 c0                	test   %eax,%eax
+  803f18:	0f 88 8e 00 00 00    	js     803fac <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803f1e:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803f25:	00 00 00 
+    while (i < n) {
+  803f28:	4d 85 ed             	test   %r13,%r13
+  803f2b:	0f 84 8a 00 00 00    	je     803fbb <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803f31:	4c 89 ea             	mov    %r13,%rdx
+  803f34:	48 29 da             	sub    %rbx,%rdx
+  803f37:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803f3e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803f44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803f48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f4c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803f4f:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  803f53:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803f57:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803f5c:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803f61:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803f65:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803f69:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f6e:	4c 89 e6             	mov    %r12,%rsi
+  803f71:	bf 09 00 00 00       	mov    $0x9,%edi
+  803f76:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  803f7d:	00 00 00 
+  803f80:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803f82:	85 c0                	test   %eax,%eax
+  803f84:	78 2a                	js     803fb0 <fmap+0x115>
+        i += res;
+  803f86:	48 98                	cltq
+  803f88:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803f8b:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803f8f:	72 05                	jb     803f96 <fmap+0xfb>
+    while (i < n) {
+  803f91:	4c 39 eb             	cmp    %r13,%rbx
+  803f94:	72 9b                	jb     803f31 <fmap+0x96>
+    }
+    return i;
+  803f96:	48 89 d8             	mov    %rbx,%rax
+}
+  803f99:	48 83 c4 18          	add    $0x18,%rsp
+  803f9d:	5b                   	pop    %rbx
+  803f9e:	41 5c                	pop    %r12
+  803fa0:	41 5d                	pop    %r13
+  803fa2:	41 5e                	pop    %r14
+  803fa4:	41 5f                	pop    %r15
+  803fa6:	5d                   	pop    %rbp
+  803fa7:	c3                   	ret
+    if (res < 0) return res;
+  803fa8:	48 98                	cltq
+  803faa:	eb ed                	jmp    803f99 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803fac:	48 98                	cltq
+  803fae:	eb e9                	jmp    803f99 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803fb0:	48 98                	cltq
+  803fb2:	48 85 db             	test   %rbx,%rbx
+  803fb5:	48 0f 45 c3          	cmovne %rbx,%rax
+  803fb9:	eb de                	jmp    803f99 <fmap+0xfe>
+    size_t i = 0;
+  803fbb:	4c 89 eb             	mov    %r13,%rbx
+  803fbe:	eb d6                	jmp    803f96 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803fc0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803fc7:	eb d0                	jmp    803f99 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803fc9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803fd0:	eb c7                	jmp    803f99 <fmap+0xfe>
+  803fd2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803fd9:	eb be                	jmp    803f99 <fmap+0xfe>
+  803fdb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803fe2:	eb b5                	jmp    803f99 <fmap+0xfe>
+
+0000000000803fe4 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803fe4:	55                   	push   %rbp
+  803fe5:	48 89 e5             	mov    %rsp,%rbp
+  803fe8:	41 56                	push   %r14
+  803fea:	41 55                	push   %r13
+  803fec:	41 54                	push   %r12
+  803fee:	53                   	push   %rbx
+  803fef:	48 83 ec 10          	sub    $0x10,%rsp
+  803ff3:	89 fb                	mov    %edi,%ebx
+  803ff5:	41 89 f4             	mov    %esi,%r12d
+  803ff8:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ffb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803fff:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  804006:	00 00 00 
+  804009:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80400b:	85 c0                	test   %eax,%eax
+  80400d:	78 63                	js     804072 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80400f:	45 85 e4             	test   %r12d,%r12d
+  804012:	0f 88 80 00 00 00    	js     804098 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  804018:	45 89 e6             	mov    %r12d,%r14d
+  80401b:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  804022:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804026:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  80402d:	00 00 00 
+  804030:	ff d0                	call   *%rax
+  804032:	48 89 c2             	mov    %rax,%rdx
+  804035:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80403a:	44 89 f6             	mov    %r14d,%esi
+  80403d:	89 df                	mov    %ebx,%edi
+  80403f:	48 b8 9b 3e 80 00 00 	movabs $0x803e9b,%rax
+  804046:	00 00 00 
+  804049:	ff d0                	call   *%rax
+  80404b:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  80404e:	45 29 f4             	sub    %r14d,%r12d
+  804051:	4d 63 f4             	movslq %r12d,%r14
+  804054:	49 39 c6             	cmp    %rax,%r14
+  804057:	7c 1d                	jl     804076 <read_map+0x92>
+  804059:	48 85 c0             	test   %rax,%rax
+  80405c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804061:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  804065:	48 83 c4 10          	add    $0x10,%rsp
+  804069:	5b                   	pop    %rbx
+  80406a:	41 5c                	pop    %r12
+  80406c:	41 5d                	pop    %r13
+  80406e:	41 5e                	pop    %r14
+  804070:	5d                   	pop    %rbp
+  804071:	c3                   	ret
+    if (res < 0) return res;
+  804072:	48 98                	cltq
+  804074:	eb ef                	jmp    804065 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  804076:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80407a:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  804081:	00 00 00 
+  804084:	ff d0                	call   *%rax
+  804086:	4d 63 e4             	movslq %r12d,%r12
+  804089:	4c 01 e0             	add    %r12,%rax
+  80408c:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  804090:	48 89 d8             	mov    %rbx,%rax
+  804093:	4c 29 f0             	sub    %r14,%rax
+  804096:	eb cd                	jmp    804065 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  804098:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80409f:	eb c4                	jmp    804065 <read_map+0x81>
+
+00000000008040a1 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8040a1:	55                   	push   %rbp
+  8040a2:	48 89 e5             	mov    %rsp,%rbp
+  8040a5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8040a9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040ad:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  8040b4:	00 00 00 
+  8040b7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040b9:	85 c0                	test   %eax,%eax
+  8040bb:	78 4a                	js     804107 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040bd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040c1:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8040c8:	00 00 00 
+  8040cb:	8b 00                	mov    (%rax),%eax
+  8040cd:	39 07                	cmp    %eax,(%rdi)
+  8040cf:	75 38                	jne    804109 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8040d1:	48 b8 2b 36 80 00 00 	movabs $0x80362b,%rax
+  8040d8:	00 00 00 
+  8040db:	ff d0                	call   *%rax
+  8040dd:	85 c0                	test   %eax,%eax
+  8040df:	78 26                	js     804107 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8040e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040e5:	8b 40 0c             	mov    0xc(%rax),%eax
+  8040e8:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8040ef:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8040f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8040f6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8040fb:	48 b8 65 36 80 00 00 	movabs $0x803665,%rax
+  804102:	00 00 00 
+  804105:	ff d0                	call   *%rax
+}
+  804107:	c9                   	leave
+  804108:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804109:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80410e:	eb f7                	jmp    804107 <fsync+0x66>
+
+0000000000804110 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  804110:	55                   	push   %rbp
+  804111:	48 89 e5             	mov    %rsp,%rbp
+  804114:	41 57                	push   %r15
+  804116:	41 56                	push   %r14
+  804118:	41 55                	push   %r13
+  80411a:	41 54                	push   %r12
+  80411c:	53                   	push   %rbx
+  80411d:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  804121:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  804128:	00 00 00 
+  80412b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  804130:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  804136:	49 bd f3 2a 80 00 00 	movabs $0x802af3,%r13
+  80413d:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  804140:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  804147:	00 00 00 
+  80414a:	eb 0c                	jmp    804158 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  80414c:	83 c3 01             	add    $0x1,%ebx
+  80414f:	49 83 c4 28          	add    $0x28,%r12
+  804153:	83 fb 20             	cmp    $0x20,%ebx
+  804156:	74 33                	je     80418b <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  804158:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80415d:	74 ed                	je     80414c <flushall+0x3c>
+  80415f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804163:	89 df                	mov    %ebx,%edi
+  804165:	41 ff d5             	call   *%r13
+  804168:	85 c0                	test   %eax,%eax
+  80416a:	78 e0                	js     80414c <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80416c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  804170:	41 8b 06             	mov    (%r14),%eax
+  804173:	39 07                	cmp    %eax,(%rdi)
+  804175:	75 d5                	jne    80414c <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  804177:	48 b8 2b 36 80 00 00 	movabs $0x80362b,%rax
+  80417e:	00 00 00 
+  804181:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  804183:	85 c0                	test   %eax,%eax
+  804185:	44 0f 48 f8          	cmovs  %eax,%r15d
+  804189:	eb c1                	jmp    80414c <flushall+0x3c>
+    }
+    return res;
+}
+  80418b:	44 89 f8             	mov    %r15d,%eax
+  80418e:	48 83 c4 18          	add    $0x18,%rsp
+  804192:	5b                   	pop    %rbx
+  804193:	41 5c                	pop    %r12
+  804195:	41 5d                	pop    %r13
+  804197:	41 5e                	pop    %r14
+  804199:	41 5f                	pop    %r15
+  80419b:	5d                   	pop    %rbp
+  80419c:	c3                   	ret
+
+000000000080419d <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  80419d:	55                   	push   %rbp
+  80419e:	48 89 e5             	mov    %rsp,%rbp
+  8041a1:	53                   	push   %rbx
+  8041a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8041a6:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  8041a9:	40 0f b6 c6          	movzbl %sil,%eax
+  8041ad:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8041b4:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  8041b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8041bb:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8041c0:	48 b8 65 36 80 00 00 	movabs $0x803665,%rax
+  8041c7:	00 00 00 
+  8041ca:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041cc:	85 c0                	test   %eax,%eax
+  8041ce:	78 23                	js     8041f3 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  8041d0:	ba 58 06 00 00       	mov    $0x658,%edx
+  8041d5:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  8041dc:	00 00 00 
+  8041df:	48 89 df             	mov    %rbx,%rdi
+  8041e2:	48 b8 41 1a 80 00 00 	movabs $0x801a41,%rax
+  8041e9:	00 00 00 
+  8041ec:	ff d0                	call   *%rax
+    return 0;
+  8041ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041f7:	c9                   	leave
+  8041f8:	c3                   	ret
+
+00000000008041f9 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  8041f9:	55                   	push   %rbp
+  8041fa:	48 89 e5             	mov    %rsp,%rbp
+  8041fd:	53                   	push   %rbx
+  8041fe:	48 83 ec 08          	sub    $0x8,%rsp
+  804202:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  804205:	48 b8 0e 16 80 00 00 	movabs $0x80160e,%rax
+  80420c:	00 00 00 
+  80420f:	ff d0                	call   *%rax
+  804211:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804217:	77 35                	ja     80424e <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  804219:	48 89 de             	mov    %rbx,%rsi
+  80421c:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  804223:	00 00 00 
+  804226:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  80422d:	00 00 00 
+  804230:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  804232:	be 00 00 00 00       	mov    $0x0,%esi
+  804237:	bf 07 00 00 00       	mov    $0x7,%edi
+  80423c:	48 b8 65 36 80 00 00 	movabs $0x803665,%rax
+  804243:	00 00 00 
+  804246:	ff d0                	call   *%rax
+}
+  804248:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80424c:	c9                   	leave
+  80424d:	c3                   	ret
+        return -E_BAD_PATH;
+  80424e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804253:	eb f3                	jmp    804248 <remove+0x4f>
+
+0000000000804255 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  804255:	55                   	push   %rbp
+  804256:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  804259:	48 b8 10 41 80 00 00 	movabs $0x804110,%rax
+  804260:	00 00 00 
+  804263:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  804265:	be 00 00 00 00       	mov    $0x0,%esi
+  80426a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80426f:	48 b8 65 36 80 00 00 	movabs $0x803665,%rax
+  804276:	00 00 00 
+  804279:	ff d0                	call   *%rax
+}
+  80427b:	5d                   	pop    %rbp
+  80427c:	c3                   	ret
+
+000000000080427d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80427d:	55                   	push   %rbp
+  80427e:	48 89 e5             	mov    %rsp,%rbp
+  804281:	41 54                	push   %r12
+  804283:	53                   	push   %rbx
+  804284:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804287:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  80428e:	00 00 00 
+  804291:	ff d0                	call   *%rax
+  804293:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804296:	48 be a0 5a 80 00 00 	movabs $0x805aa0,%rsi
+  80429d:	00 00 00 
+  8042a0:	48 89 df             	mov    %rbx,%rdi
+  8042a3:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  8042aa:	00 00 00 
+  8042ad:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8042af:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8042b4:	41 2b 04 24          	sub    (%r12),%eax
+  8042b8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8042be:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8042c5:	00 00 00 
+    stat->st_dev = &devpipe;
+  8042c8:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8042cf:	00 00 00 
+  8042d2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8042d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042de:	5b                   	pop    %rbx
+  8042df:	41 5c                	pop    %r12
+  8042e1:	5d                   	pop    %rbp
+  8042e2:	c3                   	ret
+
+00000000008042e3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8042e3:	55                   	push   %rbp
+  8042e4:	48 89 e5             	mov    %rsp,%rbp
+  8042e7:	41 54                	push   %r12
+  8042e9:	53                   	push   %rbx
+  8042ea:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8042ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042f2:	48 89 fe             	mov    %rdi,%rsi
+  8042f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042fa:	49 bc 8b 1f 80 00 00 	movabs $0x801f8b,%r12
+  804301:	00 00 00 
+  804304:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804307:	48 89 df             	mov    %rbx,%rdi
+  80430a:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  804311:	00 00 00 
+  804314:	ff d0                	call   *%rax
+  804316:	48 89 c6             	mov    %rax,%rsi
+  804319:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80431e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804323:	41 ff d4             	call   *%r12
+}
+  804326:	5b                   	pop    %rbx
+  804327:	41 5c                	pop    %r12
+  804329:	5d                   	pop    %rbp
+  80432a:	c3                   	ret
+
+000000000080432b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80432b:	55                   	push   %rbp
+  80432c:	48 89 e5             	mov    %rsp,%rbp
+  80432f:	41 57                	push   %r15
+  804331:	41 56                	push   %r14
+  804333:	41 55                	push   %r13
+  804335:	41 54                	push   %r12
+  804337:	53                   	push   %rbx
+  804338:	48 83 ec 18          	sub    $0x18,%rsp
+  80433c:	49 89 fc             	mov    %rdi,%r12
+  80433f:	49 89 f5             	mov    %rsi,%r13
+  804342:	49 89 d7             	mov    %rdx,%r15
+  804345:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804349:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  804350:	00 00 00 
+  804353:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804355:	4d 85 ff             	test   %r15,%r15
+  804358:	0f 84 af 00 00 00    	je     80440d <devpipe_write+0xe2>
+  80435e:	48 89 c3             	mov    %rax,%rbx
+  804361:	4c 89 f8             	mov    %r15,%rax
+  804364:	4d 89 ef             	mov    %r13,%r15
+  804367:	4c 01 e8             	add    %r13,%rax
+  80436a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80436e:	49 bd 80 1d 80 00 00 	movabs $0x801d80,%r13
+  804375:	00 00 00 
+            sys_yield();
+  804378:	49 be 1d 1d 80 00 00 	movabs $0x801d1d,%r14
+  80437f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804382:	8b 73 04             	mov    0x4(%rbx),%esi
+  804385:	48 63 ce             	movslq %esi,%rcx
+  804388:	48 63 03             	movslq (%rbx),%rax
+  80438b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804391:	48 39 c1             	cmp    %rax,%rcx
+  804394:	72 2e                	jb     8043c4 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804396:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80439b:	48 89 da             	mov    %rbx,%rdx
+  80439e:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043a3:	4c 89 e7             	mov    %r12,%rdi
+  8043a6:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8043a9:	85 c0                	test   %eax,%eax
+  8043ab:	74 66                	je     804413 <devpipe_write+0xe8>
+            sys_yield();
+  8043ad:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8043b0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8043b3:	48 63 ce             	movslq %esi,%rcx
+  8043b6:	48 63 03             	movslq (%rbx),%rax
+  8043b9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8043bf:	48 39 c1             	cmp    %rax,%rcx
+  8043c2:	73 d2                	jae    804396 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8043c4:	41 0f b6 3f          	movzbl (%r15),%edi
+  8043c8:	48 89 ca             	mov    %rcx,%rdx
+  8043cb:	48 c1 ea 03          	shr    $0x3,%rdx
+  8043cf:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8043d6:	08 10 20 
+  8043d9:	48 f7 e2             	mul    %rdx
+  8043dc:	48 c1 ea 06          	shr    $0x6,%rdx
+  8043e0:	48 89 d0             	mov    %rdx,%rax
+  8043e3:	48 c1 e0 09          	shl    $0x9,%rax
+  8043e7:	48 29 d0             	sub    %rdx,%rax
+  8043ea:	48 c1 e0 03          	shl    $0x3,%rax
+  8043ee:	48 29 c1             	sub    %rax,%rcx
+  8043f1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8043f6:	83 c6 01             	add    $0x1,%esi
+  8043f9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8043fc:	49 83 c7 01          	add    $0x1,%r15
+  804400:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804404:	49 39 c7             	cmp    %rax,%r15
+  804407:	0f 85 75 ff ff ff    	jne    804382 <devpipe_write+0x57>
+    return n;
+  80440d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804411:	eb 05                	jmp    804418 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804413:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804418:	48 83 c4 18          	add    $0x18,%rsp
+  80441c:	5b                   	pop    %rbx
+  80441d:	41 5c                	pop    %r12
+  80441f:	41 5d                	pop    %r13
+  804421:	41 5e                	pop    %r14
+  804423:	41 5f                	pop    %r15
+  804425:	5d                   	pop    %rbp
+  804426:	c3                   	ret
+
+0000000000804427 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804427:	55                   	push   %rbp
+  804428:	48 89 e5             	mov    %rsp,%rbp
+  80442b:	41 57                	push   %r15
+  80442d:	41 56                	push   %r14
+  80442f:	41 55                	push   %r13
+  804431:	41 54                	push   %r12
+  804433:	53                   	push   %rbx
+  804434:	48 83 ec 18          	sub    $0x18,%rsp
+  804438:	49 89 fc             	mov    %rdi,%r12
+  80443b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80443f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804443:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  80444a:	00 00 00 
+  80444d:	ff d0                	call   *%rax
+  80444f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804452:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804458:	49 bd 80 1d 80 00 00 	movabs $0x801d80,%r13
+  80445f:	00 00 00 
+            sys_yield();
+  804462:	49 be 1d 1d 80 00 00 	movabs $0x801d1d,%r14
+  804469:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80446c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804471:	74 7d                	je     8044f0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804473:	8b 03                	mov    (%rbx),%eax
+  804475:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804478:	75 26                	jne    8044a0 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80447a:	4d 85 ff             	test   %r15,%r15
+  80447d:	75 77                	jne    8044f6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80447f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804484:	48 89 da             	mov    %rbx,%rdx
+  804487:	be 00 10 00 00       	mov    $0x1000,%esi
+  80448c:	4c 89 e7             	mov    %r12,%rdi
+  80448f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804492:	85 c0                	test   %eax,%eax
+  804494:	74 72                	je     804508 <devpipe_read+0xe1>
+            sys_yield();
+  804496:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804499:	8b 03                	mov    (%rbx),%eax
+  80449b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80449e:	74 df                	je     80447f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8044a0:	48 63 c8             	movslq %eax,%rcx
+  8044a3:	48 89 ca             	mov    %rcx,%rdx
+  8044a6:	48 c1 ea 03          	shr    $0x3,%rdx
+  8044aa:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8044b1:	08 10 20 
+  8044b4:	48 89 d0             	mov    %rdx,%rax
+  8044b7:	48 f7 e6             	mul    %rsi
+  8044ba:	48 c1 ea 06          	shr    $0x6,%rdx
+  8044be:	48 89 d0             	mov    %rdx,%rax
+  8044c1:	48 c1 e0 09          	shl    $0x9,%rax
+  8044c5:	48 29 d0             	sub    %rdx,%rax
+  8044c8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8044cf:	00 
+  8044d0:	48 89 c8             	mov    %rcx,%rax
+  8044d3:	48 29 d0             	sub    %rdx,%rax
+  8044d6:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8044db:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8044df:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8044e3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8044e6:	49 83 c7 01          	add    $0x1,%r15
+  8044ea:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8044ee:	75 83                	jne    804473 <devpipe_read+0x4c>
+    return n;
+  8044f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044f4:	eb 03                	jmp    8044f9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8044f6:	4c 89 f8             	mov    %r15,%rax
+}
+  8044f9:	48 83 c4 18          	add    $0x18,%rsp
+  8044fd:	5b                   	pop    %rbx
+  8044fe:	41 5c                	pop    %r12
+  804500:	41 5d                	pop    %r13
+  804502:	41 5e                	pop    %r14
+  804504:	41 5f                	pop    %r15
+  804506:	5d                   	pop    %rbp
+  804507:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80450d:	eb ea                	jmp    8044f9 <devpipe_read+0xd2>
+
+000000000080450f <pipe>:
+pipe(int pfd[2]) {
+  80450f:	55                   	push   %rbp
+  804510:	48 89 e5             	mov    %rsp,%rbp
+  804513:	41 55                	push   %r13
+  804515:	41 54                	push   %r12
+  804517:	53                   	push   %rbx
+  804518:	48 83 ec 18          	sub    $0x18,%rsp
+  80451c:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80451f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804523:	48 b8 93 2a 80 00 00 	movabs $0x802a93,%rax
+  80452a:	00 00 00 
+  80452d:	ff d0                	call   *%rax
+  80452f:	89 c3                	mov    %eax,%ebx
+  804531:	85 c0                	test   %eax,%eax
+  804533:	0f 88 a0 01 00 00    	js     8046d9 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804539:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80453e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804543:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804547:	bf 00 00 00 00       	mov    $0x0,%edi
+  80454c:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  804553:	00 00 00 
+  804556:	ff d0                	call   *%rax
+  804558:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80455a:	85 c0                	test   %eax,%eax
+  80455c:	0f 88 77 01 00 00    	js     8046d9 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804562:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804566:	48 b8 93 2a 80 00 00 	movabs $0x802a93,%rax
+  80456d:	00 00 00 
+  804570:	ff d0                	call   *%rax
+  804572:	89 c3                	mov    %eax,%ebx
+  804574:	85 c0                	test   %eax,%eax
+  804576:	0f 88 43 01 00 00    	js     8046bf <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80457c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804581:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804586:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80458a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80458f:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  804596:	00 00 00 
+  804599:	ff d0                	call   *%rax
+  80459b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80459d:	85 c0                	test   %eax,%eax
+  80459f:	0f 88 1a 01 00 00    	js     8046bf <pipe+0x1b0>
+    va = fd2data(fd0);
+  8045a5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8045a9:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  8045b0:	00 00 00 
+  8045b3:	ff d0                	call   *%rax
+  8045b5:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8045b8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045c2:	48 89 c6             	mov    %rax,%rsi
+  8045c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ca:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  8045d1:	00 00 00 
+  8045d4:	ff d0                	call   *%rax
+  8045d6:	89 c3                	mov    %eax,%ebx
+  8045d8:	85 c0                	test   %eax,%eax
+  8045da:	0f 88 c5 00 00 00    	js     8046a5 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8045e0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8045e4:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  8045eb:	00 00 00 
+  8045ee:	ff d0                	call   *%rax
+  8045f0:	48 89 c1             	mov    %rax,%rcx
+  8045f3:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8045f9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8045ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  804604:	4c 89 ee             	mov    %r13,%rsi
+  804607:	bf 00 00 00 00       	mov    $0x0,%edi
+  80460c:	48 b8 13 1e 80 00 00 	movabs $0x801e13,%rax
+  804613:	00 00 00 
+  804616:	ff d0                	call   *%rax
+  804618:	89 c3                	mov    %eax,%ebx
+  80461a:	85 c0                	test   %eax,%eax
+  80461c:	78 6e                	js     80468c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80461e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804623:	4c 89 ef             	mov    %r13,%rdi
+  804626:	48 b8 4e 1d 80 00 00 	movabs $0x801d4e,%rax
+  80462d:	00 00 00 
+  804630:	ff d0                	call   *%rax
+  804632:	83 f8 02             	cmp    $0x2,%eax
+  804635:	0f 85 ab 00 00 00    	jne    8046e6 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80463b:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804642:	00 00 
+  804644:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804648:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80464a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80464e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804655:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804659:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80465b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80465f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804666:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80466a:	48 bb 65 2a 80 00 00 	movabs $0x802a65,%rbx
+  804671:	00 00 00 
+  804674:	ff d3                	call   *%rbx
+  804676:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80467a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80467e:	ff d3                	call   *%rbx
+  804680:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804685:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80468a:	eb 4d                	jmp    8046d9 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80468c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804691:	4c 89 ee             	mov    %r13,%rsi
+  804694:	bf 00 00 00 00       	mov    $0x0,%edi
+  804699:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  8046a0:	00 00 00 
+  8046a3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8046a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046aa:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8046ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046b3:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  8046ba:	00 00 00 
+  8046bd:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8046bf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046c4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8046c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046cd:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  8046d4:	00 00 00 
+  8046d7:	ff d0                	call   *%rax
+}
+  8046d9:	89 d8                	mov    %ebx,%eax
+  8046db:	48 83 c4 18          	add    $0x18,%rsp
+  8046df:	5b                   	pop    %rbx
+  8046e0:	41 5c                	pop    %r12
+  8046e2:	41 5d                	pop    %r13
+  8046e4:	5d                   	pop    %rbp
+  8046e5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8046e6:	48 b9 d0 5a 80 00 00 	movabs $0x805ad0,%rcx
+  8046ed:	00 00 00 
+  8046f0:	48 ba a7 5a 80 00 00 	movabs $0x805aa7,%rdx
+  8046f7:	00 00 00 
+  8046fa:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8046ff:	48 bf bc 5a 80 00 00 	movabs $0x805abc,%rdi
+  804706:	00 00 00 
+  804709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80470e:	49 b8 84 0b 80 00 00 	movabs $0x800b84,%r8
+  804715:	00 00 00 
+  804718:	41 ff d0             	call   *%r8
+
+000000000080471b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80471b:	55                   	push   %rbp
+  80471c:	48 89 e5             	mov    %rsp,%rbp
+  80471f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804723:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804727:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  80472e:	00 00 00 
+  804731:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804733:	85 c0                	test   %eax,%eax
+  804735:	78 35                	js     80476c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804737:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80473b:	48 b8 77 2a 80 00 00 	movabs $0x802a77,%rax
+  804742:	00 00 00 
+  804745:	ff d0                	call   *%rax
+  804747:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80474a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80474f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804754:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804758:	48 b8 80 1d 80 00 00 	movabs $0x801d80,%rax
+  80475f:	00 00 00 
+  804762:	ff d0                	call   *%rax
+  804764:	85 c0                	test   %eax,%eax
+  804766:	0f 94 c0             	sete   %al
+  804769:	0f b6 c0             	movzbl %al,%eax
+}
+  80476c:	c9                   	leave
+  80476d:	c3                   	ret
+
+000000000080476e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80476e:	48 89 f8             	mov    %rdi,%rax
+  804771:	48 c1 e8 27          	shr    $0x27,%rax
+  804775:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80477c:	7f 00 00 
+  80477f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804783:	f6 c2 01             	test   $0x1,%dl
+  804786:	74 6d                	je     8047f5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804788:	48 89 f8             	mov    %rdi,%rax
+  80478b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80478f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804796:	7f 00 00 
+  804799:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80479d:	f6 c2 01             	test   $0x1,%dl
+  8047a0:	74 62                	je     804804 <get_uvpt_entry+0x96>
+  8047a2:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8047a9:	7f 00 00 
+  8047ac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047b0:	f6 c2 80             	test   $0x80,%dl
+  8047b3:	75 4f                	jne    804804 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8047b5:	48 89 f8             	mov    %rdi,%rax
+  8047b8:	48 c1 e8 15          	shr    $0x15,%rax
+  8047bc:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8047c3:	7f 00 00 
+  8047c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047ca:	f6 c2 01             	test   $0x1,%dl
+  8047cd:	74 44                	je     804813 <get_uvpt_entry+0xa5>
+  8047cf:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8047d6:	7f 00 00 
+  8047d9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047dd:	f6 c2 80             	test   $0x80,%dl
+  8047e0:	75 31                	jne    804813 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8047e2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8047e6:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8047ed:	7f 00 00 
+  8047f0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8047f4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8047f5:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8047fc:	7f 00 00 
+  8047ff:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804803:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804804:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80480b:	7f 00 00 
+  80480e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804812:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804813:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80481a:	7f 00 00 
+  80481d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804821:	c3                   	ret
+
+0000000000804822 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  804822:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804825:	48 89 f9             	mov    %rdi,%rcx
+  804828:	48 c1 e9 27          	shr    $0x27,%rcx
+  80482c:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804833:	7f 00 00 
+  804836:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80483a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804841:	f6 c1 01             	test   $0x1,%cl
+  804844:	0f 84 b2 00 00 00    	je     8048fc <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80484a:	48 89 f9             	mov    %rdi,%rcx
+  80484d:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804851:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804858:	7f 00 00 
+  80485b:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80485f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804866:	40 f6 c6 01          	test   $0x1,%sil
+  80486a:	0f 84 8c 00 00 00    	je     8048fc <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804870:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804877:	7f 00 00 
+  80487a:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80487e:	a8 80                	test   $0x80,%al
+  804880:	75 7b                	jne    8048fd <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804882:	48 89 f9             	mov    %rdi,%rcx
+  804885:	48 c1 e9 15          	shr    $0x15,%rcx
+  804889:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804890:	7f 00 00 
+  804893:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804897:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80489e:	40 f6 c6 01          	test   $0x1,%sil
+  8048a2:	74 58                	je     8048fc <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8048a4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8048ab:	7f 00 00 
+  8048ae:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8048b2:	a8 80                	test   $0x80,%al
+  8048b4:	75 6c                	jne    804922 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8048b6:	48 89 f9             	mov    %rdi,%rcx
+  8048b9:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8048bd:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8048c4:	7f 00 00 
+  8048c7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8048cb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8048d2:	40 f6 c6 01          	test   $0x1,%sil
+  8048d6:	74 24                	je     8048fc <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8048d8:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8048df:	7f 00 00 
+  8048e2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8048e6:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8048ed:	ff ff 7f 
+  8048f0:	48 21 c8             	and    %rcx,%rax
+  8048f3:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8048f9:	48 09 d0             	or     %rdx,%rax
+}
+  8048fc:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  8048fd:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804904:	7f 00 00 
+  804907:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80490b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804912:	ff ff 7f 
+  804915:	48 21 c8             	and    %rcx,%rax
+  804918:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  80491e:	48 01 d0             	add    %rdx,%rax
+  804921:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804922:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804929:	7f 00 00 
+  80492c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804930:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804937:	ff ff 7f 
+  80493a:	48 21 c8             	and    %rcx,%rax
+  80493d:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804943:	48 01 d0             	add    %rdx,%rax
+  804946:	c3                   	ret
+
+0000000000804947 <get_prot>:
+
+int
+get_prot(void *va) {
+  804947:	55                   	push   %rbp
+  804948:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80494b:	48 b8 6e 47 80 00 00 	movabs $0x80476e,%rax
+  804952:	00 00 00 
+  804955:	ff d0                	call   *%rax
+  804957:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80495a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80495f:	89 c1                	mov    %eax,%ecx
+  804961:	83 c9 04             	or     $0x4,%ecx
+  804964:	f6 c2 01             	test   $0x1,%dl
+  804967:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80496a:	89 c1                	mov    %eax,%ecx
+  80496c:	83 c9 02             	or     $0x2,%ecx
+  80496f:	f6 c2 02             	test   $0x2,%dl
+  804972:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804975:	89 c1                	mov    %eax,%ecx
+  804977:	83 c9 01             	or     $0x1,%ecx
+  80497a:	48 85 d2             	test   %rdx,%rdx
+  80497d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804980:	89 c1                	mov    %eax,%ecx
+  804982:	83 c9 40             	or     $0x40,%ecx
+  804985:	f6 c6 04             	test   $0x4,%dh
+  804988:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80498b:	5d                   	pop    %rbp
+  80498c:	c3                   	ret
+
+000000000080498d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80498d:	55                   	push   %rbp
+  80498e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804991:	48 b8 6e 47 80 00 00 	movabs $0x80476e,%rax
+  804998:	00 00 00 
+  80499b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80499d:	48 c1 e8 06          	shr    $0x6,%rax
+  8049a1:	83 e0 01             	and    $0x1,%eax
+}
+  8049a4:	5d                   	pop    %rbp
+  8049a5:	c3                   	ret
+
+00000000008049a6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8049a6:	55                   	push   %rbp
+  8049a7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8049aa:	48 b8 6e 47 80 00 00 	movabs $0x80476e,%rax
+  8049b1:	00 00 00 
+  8049b4:	ff d0                	call   *%rax
+  8049b6:	83 e0 01             	and    $0x1,%eax
+}
+  8049b9:	5d                   	pop    %rbp
+  8049ba:	c3                   	ret
+
+00000000008049bb <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8049bb:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8049c2:	7f 00 00 
+  8049c5:	a8 01                	test   $0x1,%al
+  8049c7:	75 06                	jne    8049cf <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8049c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049ce:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8049cf:	55                   	push   %rbp
+  8049d0:	48 89 e5             	mov    %rsp,%rbp
+  8049d3:	41 57                	push   %r15
+  8049d5:	41 56                	push   %r14
+  8049d7:	41 55                	push   %r13
+  8049d9:	41 54                	push   %r12
+  8049db:	53                   	push   %rbx
+  8049dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8049e0:	49 89 fe             	mov    %rdi,%r14
+  8049e3:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8049e6:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8049ed:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8049ee:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  8049f5:	7f 00 00 
+  8049f8:	e9 81 00 00 00       	jmp    804a7e <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  8049fd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804a04:	49 39 dd             	cmp    %rbx,%r13
+  804a07:	74 2b                	je     804a34 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804a09:	48 89 d8             	mov    %rbx,%rax
+  804a0c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a10:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804a14:	f6 c2 01             	test   $0x1,%dl
+  804a17:	74 e4                	je     8049fd <foreach_shared_region+0x42>
+  804a19:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804a1d:	f6 c4 04             	test   $0x4,%ah
+  804a20:	74 db                	je     8049fd <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804a22:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804a29:	4c 89 fa             	mov    %r15,%rdx
+  804a2c:	48 89 df             	mov    %rbx,%rdi
+  804a2f:	41 ff d6             	call   *%r14
+  804a32:	eb c9                	jmp    8049fd <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804a34:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804a3b:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804a3f:	74 22                	je     804a63 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804a41:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804a48:	48 89 d8             	mov    %rbx,%rax
+  804a4b:	48 c1 e8 15          	shr    $0x15,%rax
+  804a4f:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  804a56:	7f 00 00 
+  804a59:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804a5d:	a8 01                	test   $0x1,%al
+  804a5f:	74 d3                	je     804a34 <foreach_shared_region+0x79>
+  804a61:	eb a6                	jmp    804a09 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804a63:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  804a6a:	40 
+  804a6b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804a6f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804a76:	00 00 00 
+  804a79:	48 39 c1             	cmp    %rax,%rcx
+  804a7c:	74 31                	je     804aaf <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804a7e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a82:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804a86:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  804a8d:	7f 00 00 
+  804a90:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804a94:	a8 01                	test   $0x1,%al
+  804a96:	74 cb                	je     804a63 <foreach_shared_region+0xa8>
+  804a98:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a9c:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804aa3:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804aa9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804aad:	eb 92                	jmp    804a41 <foreach_shared_region+0x86>
+}
+  804aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ab4:	48 83 c4 18          	add    $0x18,%rsp
+  804ab8:	5b                   	pop    %rbx
+  804ab9:	41 5c                	pop    %r12
+  804abb:	41 5d                	pop    %r13
+  804abd:	41 5e                	pop    %r14
+  804abf:	41 5f                	pop    %r15
+  804ac1:	5d                   	pop    %rbp
+  804ac2:	c3                   	ret
+
+0000000000804ac3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ac8:	c3                   	ret
+
+0000000000804ac9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804ac9:	55                   	push   %rbp
+  804aca:	48 89 e5             	mov    %rsp,%rbp
+  804acd:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804ad0:	48 be f4 5a 80 00 00 	movabs $0x805af4,%rsi
+  804ad7:	00 00 00 
+  804ada:	48 b8 4c 16 80 00 00 	movabs $0x80164c,%rax
+  804ae1:	00 00 00 
+  804ae4:	ff d0                	call   *%rax
+    return 0;
+}
+  804ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804aeb:	5d                   	pop    %rbp
+  804aec:	c3                   	ret
+
+0000000000804aed <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804aed:	55                   	push   %rbp
+  804aee:	48 89 e5             	mov    %rsp,%rbp
+  804af1:	41 57                	push   %r15
+  804af3:	41 56                	push   %r14
+  804af5:	41 55                	push   %r13
+  804af7:	41 54                	push   %r12
+  804af9:	53                   	push   %rbx
+  804afa:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804b01:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804b08:	48 85 d2             	test   %rdx,%rdx
+  804b0b:	74 7a                	je     804b87 <devcons_write+0x9a>
+  804b0d:	49 89 d6             	mov    %rdx,%r14
+  804b10:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b16:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804b1b:	49 bf da 19 80 00 00 	movabs $0x8019da,%r15
+  804b22:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804b25:	4c 89 f3             	mov    %r14,%rbx
+  804b28:	48 29 f3             	sub    %rsi,%rbx
+  804b2b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804b30:	48 39 c3             	cmp    %rax,%rbx
+  804b33:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804b37:	4c 63 eb             	movslq %ebx,%r13
+  804b3a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804b41:	48 01 c6             	add    %rax,%rsi
+  804b44:	4c 89 ea             	mov    %r13,%rdx
+  804b47:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804b4e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804b51:	4c 89 ee             	mov    %r13,%rsi
+  804b54:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804b5b:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  804b62:	00 00 00 
+  804b65:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804b67:	41 01 dc             	add    %ebx,%r12d
+  804b6a:	49 63 f4             	movslq %r12d,%rsi
+  804b6d:	4c 39 f6             	cmp    %r14,%rsi
+  804b70:	72 b3                	jb     804b25 <devcons_write+0x38>
+    return res;
+  804b72:	49 63 c4             	movslq %r12d,%rax
+}
+  804b75:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804b7c:	5b                   	pop    %rbx
+  804b7d:	41 5c                	pop    %r12
+  804b7f:	41 5d                	pop    %r13
+  804b81:	41 5e                	pop    %r14
+  804b83:	41 5f                	pop    %r15
+  804b85:	5d                   	pop    %rbp
+  804b86:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804b87:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b8d:	eb e3                	jmp    804b72 <devcons_write+0x85>
+
+0000000000804b8f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804b8f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804b92:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b97:	48 85 c0             	test   %rax,%rax
+  804b9a:	74 55                	je     804bf1 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804b9c:	55                   	push   %rbp
+  804b9d:	48 89 e5             	mov    %rsp,%rbp
+  804ba0:	41 55                	push   %r13
+  804ba2:	41 54                	push   %r12
+  804ba4:	53                   	push   %rbx
+  804ba5:	48 83 ec 08          	sub    $0x8,%rsp
+  804ba9:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804bac:	48 bb 50 1c 80 00 00 	movabs $0x801c50,%rbx
+  804bb3:	00 00 00 
+  804bb6:	49 bc 1d 1d 80 00 00 	movabs $0x801d1d,%r12
+  804bbd:	00 00 00 
+  804bc0:	eb 03                	jmp    804bc5 <devcons_read+0x36>
+  804bc2:	41 ff d4             	call   *%r12
+  804bc5:	ff d3                	call   *%rbx
+  804bc7:	85 c0                	test   %eax,%eax
+  804bc9:	74 f7                	je     804bc2 <devcons_read+0x33>
+    if (c < 0) return c;
+  804bcb:	48 63 d0             	movslq %eax,%rdx
+  804bce:	78 13                	js     804be3 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bd5:	83 f8 04             	cmp    $0x4,%eax
+  804bd8:	74 09                	je     804be3 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804bda:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804bde:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804be3:	48 89 d0             	mov    %rdx,%rax
+  804be6:	48 83 c4 08          	add    $0x8,%rsp
+  804bea:	5b                   	pop    %rbx
+  804beb:	41 5c                	pop    %r12
+  804bed:	41 5d                	pop    %r13
+  804bef:	5d                   	pop    %rbp
+  804bf0:	c3                   	ret
+  804bf1:	48 89 d0             	mov    %rdx,%rax
+  804bf4:	c3                   	ret
+
+0000000000804bf5 <cputchar>:
+cputchar(int ch) {
+  804bf5:	55                   	push   %rbp
+  804bf6:	48 89 e5             	mov    %rsp,%rbp
+  804bf9:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804bfd:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804c01:	be 01 00 00 00       	mov    $0x1,%esi
+  804c06:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804c0a:	48 b8 23 1c 80 00 00 	movabs $0x801c23,%rax
+  804c11:	00 00 00 
+  804c14:	ff d0                	call   *%rax
+}
+  804c16:	c9                   	leave
+  804c17:	c3                   	ret
+
+0000000000804c18 <getchar>:
+getchar(void) {
+  804c18:	55                   	push   %rbp
+  804c19:	48 89 e5             	mov    %rsp,%rbp
+  804c1c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804c20:	ba 01 00 00 00       	mov    $0x1,%edx
+  804c25:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804c29:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c2e:	48 b8 d6 2d 80 00 00 	movabs $0x802dd6,%rax
+  804c35:	00 00 00 
+  804c38:	ff d0                	call   *%rax
+  804c3a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804c3c:	85 c0                	test   %eax,%eax
+  804c3e:	78 06                	js     804c46 <getchar+0x2e>
+  804c40:	74 08                	je     804c4a <getchar+0x32>
+  804c42:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804c46:	89 d0                	mov    %edx,%eax
+  804c48:	c9                   	leave
+  804c49:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804c4a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804c4f:	eb f5                	jmp    804c46 <getchar+0x2e>
+
+0000000000804c51 <iscons>:
+iscons(int fdnum) {
+  804c51:	55                   	push   %rbp
+  804c52:	48 89 e5             	mov    %rsp,%rbp
+  804c55:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804c59:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804c5d:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  804c64:	00 00 00 
+  804c67:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804c69:	85 c0                	test   %eax,%eax
+  804c6b:	78 18                	js     804c85 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804c6d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804c71:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804c78:	00 00 00 
+  804c7b:	8b 00                	mov    (%rax),%eax
+  804c7d:	39 02                	cmp    %eax,(%rdx)
+  804c7f:	0f 94 c0             	sete   %al
+  804c82:	0f b6 c0             	movzbl %al,%eax
+}
+  804c85:	c9                   	leave
+  804c86:	c3                   	ret
+
+0000000000804c87 <opencons>:
+opencons(void) {
+  804c87:	55                   	push   %rbp
+  804c88:	48 89 e5             	mov    %rsp,%rbp
+  804c8b:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804c8f:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804c93:	48 b8 93 2a 80 00 00 	movabs $0x802a93,%rax
+  804c9a:	00 00 00 
+  804c9d:	ff d0                	call   *%rax
+  804c9f:	85 c0                	test   %eax,%eax
+  804ca1:	78 49                	js     804cec <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804ca3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804ca8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804cad:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804cb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cb6:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  804cbd:	00 00 00 
+  804cc0:	ff d0                	call   *%rax
+  804cc2:	85 c0                	test   %eax,%eax
+  804cc4:	78 26                	js     804cec <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804cc6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804cca:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804cd1:	00 00 
+  804cd3:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804cd5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804cd9:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804ce0:	48 b8 65 2a 80 00 00 	movabs $0x802a65,%rax
+  804ce7:	00 00 00 
+  804cea:	ff d0                	call   *%rax
+}
+  804cec:	c9                   	leave
+  804ced:	c3                   	ret
+
+0000000000804cee <__text_end>:
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cff:	00 00 00 
+  804d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d09:	00 00 00 
+  804d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d13:	00 00 00 
+  804d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1d:	00 00 00 
+  804d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d27:	00 00 00 
+  804d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d31:	00 00 00 
+  804d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3b:	00 00 00 
+  804d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d45:	00 00 00 
+  804d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4f:	00 00 00 
+  804d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d59:	00 00 00 
+  804d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d63:	00 00 00 
+  804d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6d:	00 00 00 
+  804d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d77:	00 00 00 
+  804d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d81:	00 00 00 
+  804d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8b:	00 00 00 
+  804d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d95:	00 00 00 
+  804d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9f:	00 00 00 
+  804da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da9:	00 00 00 
+  804dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db3:	00 00 00 
+  804db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbd:	00 00 00 
+  804dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc7:	00 00 00 
+  804dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd1:	00 00 00 
+  804dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddb:	00 00 00 
+  804dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de5:	00 00 00 
+  804de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804def:	00 00 00 
+  804df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df9:	00 00 00 
+  804dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e03:	00 00 00 
+  804e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0d:	00 00 00 
+  804e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e17:	00 00 00 
+  804e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e21:	00 00 00 
+  804e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2b:	00 00 00 
+  804e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e35:	00 00 00 
+  804e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3f:	00 00 00 
+  804e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e49:	00 00 00 
+  804e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e53:	00 00 00 
+  804e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5d:	00 00 00 
+  804e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e67:	00 00 00 
+  804e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e71:	00 00 00 
+  804e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7b:	00 00 00 
+  804e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e85:	00 00 00 
+  804e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8f:	00 00 00 
+  804e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e99:	00 00 00 
+  804e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea3:	00 00 00 
+  804ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ead:	00 00 00 
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
@@ -0,0 +1,8385 @@
+
+obj/user/testfilecache:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 fe 08 00 00       	call   800921 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <nrequests>:
+
+static char rec[RECSIZE], buf[RECSIZE];
+
+/* Number of requests of given type handled by the server */
+static uint64_t
+nrequests(int req) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+  80002e:	89 fb                	mov    %edi,%ebx
+    static struct Fsret_stats st;
+    int r = fsstats(&st, 0);
+  800030:	be 00 00 00 00       	mov    $0x0,%esi
+  800035:	48 bf 00 70 80 00 00 	movabs $0x807000,%rdi
+  80003c:	00 00 00 
+  80003f:	48 b8 71 3e 80 00 00 	movabs $0x803e71,%rax
+  800046:	00 00 00 
+  800049:	ff d0                	call   *%rax
+    if (r < 0) panic("fsstats: %i", r);
+  80004b:	85 c0                	test   %eax,%eax
+  80004d:	78 1b                	js     80006a <nrequests+0x45>
+    return st.ret_req[req].count;
+  80004f:	48 63 fb             	movslq %ebx,%rdi
+  800052:	48 c1 e7 07          	shl    $0x7,%rdi
+  800056:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80005d:	00 00 00 
+  800060:	48 8b 04 38          	mov    (%rax,%rdi,1),%rax
+}
+  800064:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800068:	c9                   	leave
+  800069:	c3                   	ret
+    if (r < 0) panic("fsstats: %i", r);
+  80006a:	89 c1                	mov    %eax,%ecx
+  80006c:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800073:	00 00 00 
+  800076:	be 12 00 00 00       	mov    $0x12,%esi
+  80007b:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  800091:	00 00 00 
+  800094:	41 ff d0             	call   *%r8
+
+0000000000800097 <umain>:
+fill(char *dst, int n) {
+    memset(dst, 'a' + n % 26, RECSIZE);
+}
+
+void
+umain(int argc, char **argv) {
+  800097:	55                   	push   %rbp
+  800098:	48 89 e5             	mov    %rsp,%rbp
+  80009b:	41 57                	push   %r15
+  80009d:	41 56                	push   %r14
+  80009f:	41 55                	push   %r13
+  8000a1:	41 54                	push   %r12
+  8000a3:	53                   	push   %rbx
+  8000a4:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+    int fd, r;
+    uint64_t n;
+    struct Stat st;
+
+    if ((fd = open(PATH, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  8000ab:	be 02 03 00 00       	mov    $0x302,%esi
+  8000b0:	48 bf 21 50 80 00 00 	movabs $0x805021,%rdi
+  8000b7:	00 00 00 
+  8000ba:	48 b8 b3 3a 80 00 00 	movabs $0x803ab3,%rax
+  8000c1:	00 00 00 
+  8000c4:	ff d0                	call   *%rax
+  8000c6:	41 89 c4             	mov    %eax,%r12d
+  8000c9:	85 c0                	test   %eax,%eax
+  8000cb:	0f 88 00 05 00 00    	js     8005d1 <umain+0x53a>
+        panic("open %s: %i", PATH, fd);
+
+    /* Records are collected in the window and written at once */
+    n = nrequests(FSREQ_WRITE);
+  8000d1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8000d6:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+  8000e2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+    for (int i = 0; i < NRECORDS; i++) {
+  8000e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    memset(dst, 'a' + n % 26, RECSIZE);
+  8000ee:	49 bd e0 76 80 00 00 	movabs $0x8076e0,%r13
+  8000f5:	00 00 00 
+  8000f8:	49 bf 95 17 80 00 00 	movabs $0x801795,%r15
+  8000ff:	00 00 00 
+        fill(rec, i);
+        if ((r = write(fd, rec, RECSIZE)) != RECSIZE)
+  800102:	49 be d9 2b 80 00 00 	movabs $0x802bd9,%r14
+  800109:	00 00 00 
+    memset(dst, 'a' + n % 26, RECSIZE);
+  80010c:	48 63 c3             	movslq %ebx,%rax
+  80010f:	48 69 c0 4f ec c4 4e 	imul   $0x4ec4ec4f,%rax,%rax
+  800116:	48 c1 f8 23          	sar    $0x23,%rax
+  80011a:	89 da                	mov    %ebx,%edx
+  80011c:	c1 fa 1f             	sar    $0x1f,%edx
+  80011f:	29 d0                	sub    %edx,%eax
+  800121:	6b c0 1a             	imul   $0x1a,%eax,%eax
+  800124:	89 de                	mov    %ebx,%esi
+  800126:	29 c6                	sub    %eax,%esi
+  800128:	83 c6 61             	add    $0x61,%esi
+  80012b:	ba 64 00 00 00       	mov    $0x64,%edx
+  800130:	4c 89 ef             	mov    %r13,%rdi
+  800133:	41 ff d7             	call   *%r15
+        if ((r = write(fd, rec, RECSIZE)) != RECSIZE)
+  800136:	ba 64 00 00 00       	mov    $0x64,%edx
+  80013b:	4c 89 ee             	mov    %r13,%rsi
+  80013e:	44 89 e7             	mov    %r12d,%edi
+  800141:	41 ff d6             	call   *%r14
+  800144:	89 c1                	mov    %eax,%ecx
+  800146:	83 f8 64             	cmp    $0x64,%eax
+  800149:	0f 85 ba 04 00 00    	jne    800609 <umain+0x572>
+    for (int i = 0; i < NRECORDS; i++) {
+  80014f:	83 c3 01             	add    $0x1,%ebx
+  800152:	83 fb 40             	cmp    $0x40,%ebx
+  800155:	75 b5                	jne    80010c <umain+0x75>
+            panic("write: %i", r);
+    }
+    assert(nrequests(FSREQ_WRITE) == n);
+  800157:	bf 04 00 00 00       	mov    $0x4,%edi
+  80015c:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800163:	00 00 00 
+  800166:	ff d0                	call   *%rax
+  800168:	48 8b 8d 38 ff ff ff 	mov    -0xc8(%rbp),%rcx
+  80016f:	48 39 c8             	cmp    %rcx,%rax
+  800172:	0f 85 bc 04 00 00    	jne    800634 <umain+0x59d>
+    if ((r = fsync(fd)) < 0) panic("fsync: %i", r);
+  800178:	44 89 e7             	mov    %r12d,%edi
+  80017b:	48 b8 75 3d 80 00 00 	movabs $0x803d75,%rax
+  800182:	00 00 00 
+  800185:	ff d0                	call   *%rax
+  800187:	85 c0                	test   %eax,%eax
+  800189:	0f 88 da 04 00 00    	js     800669 <umain+0x5d2>
+    assert(nrequests(FSREQ_WRITE) == n + 1);
+  80018f:	bf 04 00 00 00       	mov    $0x4,%edi
+  800194:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+  8001a0:	48 89 c2             	mov    %rax,%rdx
+  8001a3:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  8001aa:	48 83 c0 01          	add    $0x1,%rax
+  8001ae:	48 39 c2             	cmp    %rax,%rdx
+  8001b1:	0f 85 df 04 00 00    	jne    800696 <umain+0x5ff>
+    cprintf("small writes are good\n");
+  8001b7:	48 bf 81 50 80 00 00 	movabs $0x805081,%rdi
+  8001be:	00 00 00 
+  8001c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c6:	48 ba 3d 0b 80 00 00 	movabs $0x800b3d,%rdx
+  8001cd:	00 00 00 
+  8001d0:	ff d2                	call   *%rdx
+
+    /* Records are read back from at most one window fill */
+    seek(fd, 0);
+  8001d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d7:	44 89 e7             	mov    %r12d,%edi
+  8001da:	48 b8 92 2c 80 00 00 	movabs $0x802c92,%rax
+  8001e1:	00 00 00 
+  8001e4:	ff d0                	call   *%rax
+    n = nrequests(FSREQ_READ);
+  8001e6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8001eb:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001f2:	00 00 00 
+  8001f5:	ff d0                	call   *%rax
+  8001f7:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+    for (int i = 0; i < NRECORDS; i++) {
+  8001fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+    memset(dst, 'a' + n % 26, RECSIZE);
+  800203:	49 be e0 76 80 00 00 	movabs $0x8076e0,%r14
+  80020a:	00 00 00 
+  80020d:	49 bf 95 17 80 00 00 	movabs $0x801795,%r15
+  800214:	00 00 00 
+        fill(rec, i);
+        if ((r = readn(fd, buf, RECSIZE)) != RECSIZE)
+  800217:	49 bd 60 76 80 00 00 	movabs $0x807660,%r13
+  80021e:	00 00 00 
+    memset(dst, 'a' + n % 26, RECSIZE);
+  800221:	48 63 c3             	movslq %ebx,%rax
+  800224:	48 69 c0 4f ec c4 4e 	imul   $0x4ec4ec4f,%rax,%rax
+  80022b:	48 c1 f8 23          	sar    $0x23,%rax
+  80022f:	89 da                	mov    %ebx,%edx
+  800231:	c1 fa 1f             	sar    $0x1f,%edx
+  800234:	29 d0                	sub    %edx,%eax
+  800236:	6b c0 1a             	imul   $0x1a,%eax,%eax
+  800239:	89 de                	mov    %ebx,%esi
+  80023b:	29 c6                	sub    %eax,%esi
+  80023d:	83 c6 61             	add    $0x61,%esi
+  800240:	ba 64 00 00 00       	mov    $0x64,%edx
+  800245:	4c 89 f7             	mov    %r14,%rdi
+  800248:	41 ff d7             	call   *%r15
+        if ((r = readn(fd, buf, RECSIZE)) != RECSIZE)
+  80024b:	ba 64 00 00 00       	mov    $0x64,%edx
+  800250:	4c 89 ee             	mov    %r13,%rsi
+  800253:	44 89 e7             	mov    %r12d,%edi
+  800256:	48 b8 68 2b 80 00 00 	movabs $0x802b68,%rax
+  80025d:	00 00 00 
+  800260:	ff d0                	call   *%rax
+  800262:	89 c1                	mov    %eax,%ecx
+  800264:	83 f8 64             	cmp    $0x64,%eax
+  800267:	0f 85 5e 04 00 00    	jne    8006cb <umain+0x634>
+            panic("read: %i", r);
+        if (memcmp(buf, rec, RECSIZE))
+  80026d:	ba 64 00 00 00       	mov    $0x64,%edx
+  800272:	4c 89 f6             	mov    %r14,%rsi
+  800275:	4c 89 ef             	mov    %r13,%rdi
+  800278:	48 b8 62 19 80 00 00 	movabs $0x801962,%rax
+  80027f:	00 00 00 
+  800282:	ff d0                	call   *%rax
+  800284:	85 c0                	test   %eax,%eax
+  800286:	0f 85 6a 04 00 00    	jne    8006f6 <umain+0x65f>
+    for (int i = 0; i < NRECORDS; i++) {
+  80028c:	83 c3 01             	add    $0x1,%ebx
+  80028f:	83 fb 40             	cmp    $0x40,%ebx
+  800292:	75 8d                	jne    800221 <umain+0x18a>
+            panic("record %d read back wrong", i);
+    }
+    assert(nrequests(FSREQ_READ) - n <= 1);
+  800294:	bf 03 00 00 00       	mov    $0x3,%edi
+  800299:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002a0:	00 00 00 
+  8002a3:	ff d0                	call   *%rax
+  8002a5:	48 8b 8d 38 ff ff ff 	mov    -0xc8(%rbp),%rcx
+  8002ac:	48 29 c8             	sub    %rcx,%rax
+  8002af:	48 83 f8 01          	cmp    $0x1,%rax
+  8002b3:	0f 87 6a 04 00 00    	ja     800723 <umain+0x68c>
+    cprintf("small reads are good\n");
+  8002b9:	48 bf bb 50 80 00 00 	movabs $0x8050bb,%rdi
+  8002c0:	00 00 00 
+  8002c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c8:	48 ba 3d 0b 80 00 00 	movabs $0x800b3d,%rdx
+  8002cf:	00 00 00 
+  8002d2:	ff d2                	call   *%rdx
+    memset(dst, 'a' + n % 26, RECSIZE);
+  8002d4:	ba 64 00 00 00       	mov    $0x64,%edx
+  8002d9:	be 6d 00 00 00       	mov    $0x6d,%esi
+  8002de:	48 bb e0 76 80 00 00 	movabs $0x8076e0,%rbx
+  8002e5:	00 00 00 
+  8002e8:	48 89 df             	mov    %rbx,%rdi
+  8002eb:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+
+    /* Read and stat see unwritten changes of the same descriptor */
+    fill(rec, NRECORDS);
+    seek(fd, 2 * RECSIZE);
+  8002f7:	be c8 00 00 00       	mov    $0xc8,%esi
+  8002fc:	44 89 e7             	mov    %r12d,%edi
+  8002ff:	48 b8 92 2c 80 00 00 	movabs $0x802c92,%rax
+  800306:	00 00 00 
+  800309:	ff d0                	call   *%rax
+    if ((r = write(fd, rec, RECSIZE)) != RECSIZE)
+  80030b:	ba 64 00 00 00       	mov    $0x64,%edx
+  800310:	48 89 de             	mov    %rbx,%rsi
+  800313:	44 89 e7             	mov    %r12d,%edi
+  800316:	48 b8 d9 2b 80 00 00 	movabs $0x802bd9,%rax
+  80031d:	00 00 00 
+  800320:	ff d0                	call   *%rax
+  800322:	89 c1                	mov    %eax,%ecx
+  800324:	83 f8 64             	cmp    $0x64,%eax
+  800327:	0f 85 2b 04 00 00    	jne    800758 <umain+0x6c1>
+        panic("write: %i", r);
+    seek(fd, 2 * RECSIZE);
+  80032d:	be c8 00 00 00       	mov    $0xc8,%esi
+  800332:	44 89 e7             	mov    %r12d,%edi
+  800335:	48 b8 92 2c 80 00 00 	movabs $0x802c92,%rax
+  80033c:	00 00 00 
+  80033f:	ff d0                	call   *%rax
+    if ((r = readn(fd, buf, RECSIZE)) != RECSIZE || memcmp(buf, rec, RECSIZE))
+  800341:	ba 64 00 00 00       	mov    $0x64,%edx
+  800346:	48 be 60 76 80 00 00 	movabs $0x807660,%rsi
+  80034d:	00 00 00 
+  800350:	44 89 e7             	mov    %r12d,%edi
+  800353:	48 b8 68 2b 80 00 00 	movabs $0x802b68,%rax
+  80035a:	00 00 00 
+  80035d:	ff d0                	call   *%rax
+  80035f:	83 f8 64             	cmp    $0x64,%eax
+  800362:	0f 85 1b 04 00 00    	jne    800783 <umain+0x6ec>
+  800368:	ba 64 00 00 00       	mov    $0x64,%edx
+  80036d:	48 be e0 76 80 00 00 	movabs $0x8076e0,%rsi
+  800374:	00 00 00 
+  800377:	48 bf 60 76 80 00 00 	movabs $0x807660,%rdi
+  80037e:	00 00 00 
+  800381:	48 b8 62 19 80 00 00 	movabs $0x801962,%rax
+  800388:	00 00 00 
+  80038b:	ff d0                	call   *%rax
+  80038d:	85 c0                	test   %eax,%eax
+  80038f:	0f 85 ee 03 00 00    	jne    800783 <umain+0x6ec>
+        panic("read after write got stale data");
+    seek(fd, NRECORDS * RECSIZE);
+  800395:	be 00 19 00 00       	mov    $0x1900,%esi
+  80039a:	44 89 e7             	mov    %r12d,%edi
+  80039d:	48 b8 92 2c 80 00 00 	movabs $0x802c92,%rax
+  8003a4:	00 00 00 
+  8003a7:	ff d0                	call   *%rax
+    if ((r = write(fd, rec, RECSIZE)) != RECSIZE)
+  8003a9:	ba 64 00 00 00       	mov    $0x64,%edx
+  8003ae:	48 be e0 76 80 00 00 	movabs $0x8076e0,%rsi
+  8003b5:	00 00 00 
+  8003b8:	44 89 e7             	mov    %r12d,%edi
+  8003bb:	48 b8 d9 2b 80 00 00 	movabs $0x802bd9,%rax
+  8003c2:	00 00 00 
+  8003c5:	ff d0                	call   *%rax
+  8003c7:	89 c1                	mov    %eax,%ecx
+  8003c9:	83 f8 64             	cmp    $0x64,%eax
+  8003cc:	0f 85 db 03 00 00    	jne    8007ad <umain+0x716>
+        panic("write: %i", r);
+    if ((r = fstat(fd, &st)) < 0) panic("fstat: %i", r);
+  8003d2:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  8003d9:	44 89 e7             	mov    %r12d,%edi
+  8003dc:	48 b8 8c 2d 80 00 00 	movabs $0x802d8c,%rax
+  8003e3:	00 00 00 
+  8003e6:	ff d0                	call   *%rax
+  8003e8:	85 c0                	test   %eax,%eax
+  8003ea:	0f 88 e8 03 00 00    	js     8007d8 <umain+0x741>
+    assert(st.st_size == (NRECORDS + 1) * RECSIZE);
+  8003f0:	81 7d c0 64 19 00 00 	cmpl   $0x1964,-0x40(%rbp)
+  8003f7:	0f 85 08 04 00 00    	jne    800805 <umain+0x76e>
+    cprintf("read after write is good\n");
+  8003fd:	48 bf db 50 80 00 00 	movabs $0x8050db,%rdi
+  800404:	00 00 00 
+  800407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040c:	48 ba 3d 0b 80 00 00 	movabs $0x800b3d,%rdx
+  800413:	00 00 00 
+  800416:	ff d2                	call   *%rdx
+
+    /* Parent's window is filled, then child writes through shared descriptor */
+    seek(fd, 0);
+  800418:	be 00 00 00 00       	mov    $0x0,%esi
+  80041d:	44 89 e7             	mov    %r12d,%edi
+  800420:	48 b8 92 2c 80 00 00 	movabs $0x802c92,%rax
+  800427:	00 00 00 
+  80042a:	ff d0                	call   *%rax
+    if ((r = readn(fd, buf, RECSIZE)) != RECSIZE)
+  80042c:	ba 64 00 00 00       	mov    $0x64,%edx
+  800431:	48 be 60 76 80 00 00 	movabs $0x807660,%rsi
+  800438:	00 00 00 
+  80043b:	44 89 e7             	mov    %r12d,%edi
+  80043e:	48 b8 68 2b 80 00 00 	movabs $0x802b68,%rax
+  800445:	00 00 00 
+  800448:	ff d0                	call   *%rax
+  80044a:	89 c1                	mov    %eax,%ecx
+  80044c:	83 f8 64             	cmp    $0x64,%eax
+  80044f:	0f 85 e5 03 00 00    	jne    80083a <umain+0x7a3>
+        panic("read: %i", r);
+    if ((r = fork()) < 0) panic("fork: %i", r);
+  800455:	48 b8 2b 26 80 00 00 	movabs $0x80262b,%rax
+  80045c:	00 00 00 
+  80045f:	ff d0                	call   *%rax
+  800461:	89 c3                	mov    %eax,%ebx
+  800463:	85 c0                	test   %eax,%eax
+  800465:	0f 88 fa 03 00 00    	js     800865 <umain+0x7ce>
+    if (r == 0) {
+  80046b:	75 74                	jne    8004e1 <umain+0x44a>
+    memset(dst, 'a' + n % 26, RECSIZE);
+  80046d:	ba 64 00 00 00       	mov    $0x64,%edx
+  800472:	be 6e 00 00 00       	mov    $0x6e,%esi
+  800477:	48 bb e0 76 80 00 00 	movabs $0x8076e0,%rbx
+  80047e:	00 00 00 
+  800481:	48 89 df             	mov    %rbx,%rdi
+  800484:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  80048b:	00 00 00 
+  80048e:	ff d0                	call   *%rax
+        fill(rec, NRECORDS + 1);
+        seek(fd, 0);
+  800490:	be 00 00 00 00       	mov    $0x0,%esi
+  800495:	44 89 e7             	mov    %r12d,%edi
+  800498:	48 b8 92 2c 80 00 00 	movabs $0x802c92,%rax
+  80049f:	00 00 00 
+  8004a2:	ff d0                	call   *%rax
+        if ((r = write(fd, rec, RECSIZE)) != RECSIZE)
+  8004a4:	ba 64 00 00 00       	mov    $0x64,%edx
+  8004a9:	48 89 de             	mov    %rbx,%rsi
+  8004ac:	44 89 e7             	mov    %r12d,%edi
+  8004af:	48 b8 d9 2b 80 00 00 	movabs $0x802bd9,%rax
+  8004b6:	00 00 00 
+  8004b9:	ff d0                	call   *%rax
+  8004bb:	89 c3                	mov    %eax,%ebx
+  8004bd:	83 f8 64             	cmp    $0x64,%eax
+  8004c0:	0f 85 cc 03 00 00    	jne    800892 <umain+0x7fb>
+            panic("write in child: %i", r);
+        close(fd);
+  8004c6:	44 89 e7             	mov    %r12d,%edi
+  8004c9:	48 b8 2c 29 80 00 00 	movabs $0x80292c,%rax
+  8004d0:	00 00 00 
+  8004d3:	ff d0                	call   *%rax
+        exit();
+  8004d5:	48 b8 ca 09 80 00 00 	movabs $0x8009ca,%rax
+  8004dc:	00 00 00 
+  8004df:	ff d0                	call   *%rax
+    }
+    wait(r);
+  8004e1:	89 df                	mov    %ebx,%edi
+  8004e3:	48 b8 42 44 80 00 00 	movabs $0x804442,%rax
+  8004ea:	00 00 00 
+  8004ed:	ff d0                	call   *%rax
+    memset(dst, 'a' + n % 26, RECSIZE);
+  8004ef:	ba 64 00 00 00       	mov    $0x64,%edx
+  8004f4:	be 6e 00 00 00       	mov    $0x6e,%esi
+  8004f9:	48 bf e0 76 80 00 00 	movabs $0x8076e0,%rdi
+  800500:	00 00 00 
+  800503:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  80050a:	00 00 00 
+  80050d:	ff d0                	call   *%rax
+
+    fill(rec, NRECORDS + 1);
+    seek(fd, 0);
+  80050f:	be 00 00 00 00       	mov    $0x0,%esi
+  800514:	44 89 e7             	mov    %r12d,%edi
+  800517:	48 b8 92 2c 80 00 00 	movabs $0x802c92,%rax
+  80051e:	00 00 00 
+  800521:	ff d0                	call   *%rax
+    if ((r = readn(fd, buf, RECSIZE)) != RECSIZE || memcmp(buf, rec, RECSIZE))
+  800523:	ba 64 00 00 00       	mov    $0x64,%edx
+  800528:	48 be 60 76 80 00 00 	movabs $0x807660,%rsi
+  80052f:	00 00 00 
+  800532:	44 89 e7             	mov    %r12d,%edi
+  800535:	48 b8 68 2b 80 00 00 	movabs $0x802b68,%rax
+  80053c:	00 00 00 
+  80053f:	ff d0                	call   *%rax
+  800541:	83 f8 64             	cmp    $0x64,%eax
+  800544:	0f 85 75 03 00 00    	jne    8008bf <umain+0x828>
+  80054a:	ba 64 00 00 00       	mov    $0x64,%edx
+  80054f:	48 be e0 76 80 00 00 	movabs $0x8076e0,%rsi
+  800556:	00 00 00 
+  800559:	48 bf 60 76 80 00 00 	movabs $0x807660,%rdi
+  800560:	00 00 00 
+  800563:	48 b8 62 19 80 00 00 	movabs $0x801962,%rax
+  80056a:	00 00 00 
+  80056d:	ff d0                	call   *%rax
+  80056f:	85 c0                	test   %eax,%eax
+  800571:	0f 85 48 03 00 00    	jne    8008bf <umain+0x828>
+        panic("parent did not see write of child");
+    cprintf("shared descriptor is good\n");
+  800577:	48 bf 11 51 80 00 00 	movabs $0x805111,%rdi
+  80057e:	00 00 00 
+  800581:	b8 00 00 00 00       	mov    $0x0,%eax
+  800586:	48 ba 3d 0b 80 00 00 	movabs $0x800b3d,%rdx
+  80058d:	00 00 00 
+  800590:	ff d2                	call   *%rdx
+
+    close(fd);
+  800592:	44 89 e7             	mov    %r12d,%edi
+  800595:	48 b8 2c 29 80 00 00 	movabs $0x80292c,%rax
+  80059c:	00 00 00 
+  80059f:	ff d0                	call   *%rax
+    if ((r = remove(PATH)) < 0) panic("remove %s: %i", PATH, r);
+  8005a1:	48 bf 21 50 80 00 00 	movabs $0x805021,%rdi
+  8005a8:	00 00 00 
+  8005ab:	48 b8 cd 3e 80 00 00 	movabs $0x803ecd,%rax
+  8005b2:	00 00 00 
+  8005b5:	ff d0                	call   *%rax
+  8005b7:	85 c0                	test   %eax,%eax
+  8005b9:	0f 88 2a 03 00 00    	js     8008e9 <umain+0x852>
+}
+  8005bf:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8005c6:	5b                   	pop    %rbx
+  8005c7:	41 5c                	pop    %r12
+  8005c9:	41 5d                	pop    %r13
+  8005cb:	41 5e                	pop    %r14
+  8005cd:	41 5f                	pop    %r15
+  8005cf:	5d                   	pop    %rbp
+  8005d0:	c3                   	ret
+        panic("open %s: %i", PATH, fd);
+  8005d1:	41 89 c0             	mov    %eax,%r8d
+  8005d4:	48 b9 21 50 80 00 00 	movabs $0x805021,%rcx
+  8005db:	00 00 00 
+  8005de:	48 ba 30 50 80 00 00 	movabs $0x805030,%rdx
+  8005e5:	00 00 00 
+  8005e8:	be 22 00 00 00       	mov    $0x22,%esi
+  8005ed:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8005f4:	00 00 00 
+  8005f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fc:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  800603:	00 00 00 
+  800606:	41 ff d1             	call   *%r9
+            panic("write: %i", r);
+  800609:	48 ba 3c 50 80 00 00 	movabs $0x80503c,%rdx
+  800610:	00 00 00 
+  800613:	be 29 00 00 00       	mov    $0x29,%esi
+  800618:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  80061f:	00 00 00 
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  80062e:	00 00 00 
+  800631:	41 ff d0             	call   *%r8
+    assert(nrequests(FSREQ_WRITE) == n);
+  800634:	48 b9 46 50 80 00 00 	movabs $0x805046,%rcx
+  80063b:	00 00 00 
+  80063e:	48 ba 62 50 80 00 00 	movabs $0x805062,%rdx
+  800645:	00 00 00 
+  800648:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80064d:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800654:	00 00 00 
+  800657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065c:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  800663:	00 00 00 
+  800666:	41 ff d0             	call   *%r8
+    if ((r = fsync(fd)) < 0) panic("fsync: %i", r);
+  800669:	89 c1                	mov    %eax,%ecx
+  80066b:	48 ba 77 50 80 00 00 	movabs $0x805077,%rdx
+  800672:	00 00 00 
+  800675:	be 2c 00 00 00       	mov    $0x2c,%esi
+  80067a:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800681:	00 00 00 
+  800684:	b8 00 00 00 00       	mov    $0x0,%eax
+  800689:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  800690:	00 00 00 
+  800693:	41 ff d0             	call   *%r8
+    assert(nrequests(FSREQ_WRITE) == n + 1);
+  800696:	48 b9 40 51 80 00 00 	movabs $0x805140,%rcx
+  80069d:	00 00 00 
+  8006a0:	48 ba 62 50 80 00 00 	movabs $0x805062,%rdx
+  8006a7:	00 00 00 
+  8006aa:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8006af:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8006b6:	00 00 00 
+  8006b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006be:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  8006c5:	00 00 00 
+  8006c8:	41 ff d0             	call   *%r8
+            panic("read: %i", r);
+  8006cb:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8006d2:	00 00 00 
+  8006d5:	be 36 00 00 00       	mov    $0x36,%esi
+  8006da:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8006e1:	00 00 00 
+  8006e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e9:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  8006f0:	00 00 00 
+  8006f3:	41 ff d0             	call   *%r8
+            panic("record %d read back wrong", i);
+  8006f6:	89 d9                	mov    %ebx,%ecx
+  8006f8:	48 ba a1 50 80 00 00 	movabs $0x8050a1,%rdx
+  8006ff:	00 00 00 
+  800702:	be 38 00 00 00       	mov    $0x38,%esi
+  800707:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  80070e:	00 00 00 
+  800711:	b8 00 00 00 00       	mov    $0x0,%eax
+  800716:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  80071d:	00 00 00 
+  800720:	41 ff d0             	call   *%r8
+    assert(nrequests(FSREQ_READ) - n <= 1);
+  800723:	48 b9 60 51 80 00 00 	movabs $0x805160,%rcx
+  80072a:	00 00 00 
+  80072d:	48 ba 62 50 80 00 00 	movabs $0x805062,%rdx
+  800734:	00 00 00 
+  800737:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80073c:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800743:	00 00 00 
+  800746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074b:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  800752:	00 00 00 
+  800755:	41 ff d0             	call   *%r8
+        panic("write: %i", r);
+  800758:	48 ba 3c 50 80 00 00 	movabs $0x80503c,%rdx
+  80075f:	00 00 00 
+  800762:	be 41 00 00 00       	mov    $0x41,%esi
+  800767:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  80076e:	00 00 00 
+  800771:	b8 00 00 00 00       	mov    $0x0,%eax
+  800776:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  80077d:	00 00 00 
+  800780:	41 ff d0             	call   *%r8
+        panic("read after write got stale data");
+  800783:	48 ba 80 51 80 00 00 	movabs $0x805180,%rdx
+  80078a:	00 00 00 
+  80078d:	be 44 00 00 00       	mov    $0x44,%esi
+  800792:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800799:	00 00 00 
+  80079c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a1:	48 b9 ed 09 80 00 00 	movabs $0x8009ed,%rcx
+  8007a8:	00 00 00 
+  8007ab:	ff d1                	call   *%rcx
+        panic("write: %i", r);
+  8007ad:	48 ba 3c 50 80 00 00 	movabs $0x80503c,%rdx
+  8007b4:	00 00 00 
+  8007b7:	be 47 00 00 00       	mov    $0x47,%esi
+  8007bc:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8007c3:	00 00 00 
+  8007c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cb:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  8007d2:	00 00 00 
+  8007d5:	41 ff d0             	call   *%r8
+    if ((r = fstat(fd, &st)) < 0) panic("fstat: %i", r);
+  8007d8:	89 c1                	mov    %eax,%ecx
+  8007da:	48 ba d1 50 80 00 00 	movabs $0x8050d1,%rdx
+  8007e1:	00 00 00 
+  8007e4:	be 48 00 00 00       	mov    $0x48,%esi
+  8007e9:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8007f0:	00 00 00 
+  8007f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f8:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  8007ff:	00 00 00 
+  800802:	41 ff d0             	call   *%r8
+    assert(st.st_size == (NRECORDS + 1) * RECSIZE);
+  800805:	48 b9 a0 51 80 00 00 	movabs $0x8051a0,%rcx
+  80080c:	00 00 00 
+  80080f:	48 ba 62 50 80 00 00 	movabs $0x805062,%rdx
+  800816:	00 00 00 
+  800819:	be 49 00 00 00       	mov    $0x49,%esi
+  80081e:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800825:	00 00 00 
+  800828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082d:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  800834:	00 00 00 
+  800837:	41 ff d0             	call   *%r8
+        panic("read: %i", r);
+  80083a:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  800841:	00 00 00 
+  800844:	be 4f 00 00 00       	mov    $0x4f,%esi
+  800849:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  800850:	00 00 00 
+  800853:	b8 00 00 00 00       	mov    $0x0,%eax
+  800858:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  80085f:	00 00 00 
+  800862:	41 ff d0             	call   *%r8
+    if ((r = fork()) < 0) panic("fork: %i", r);
+  800865:	89 c1                	mov    %eax,%ecx
+  800867:	48 ba f5 50 80 00 00 	movabs $0x8050f5,%rdx
+  80086e:	00 00 00 
+  800871:	be 50 00 00 00       	mov    $0x50,%esi
+  800876:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  80087d:	00 00 00 
+  800880:	b8 00 00 00 00       	mov    $0x0,%eax
+  800885:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  80088c:	00 00 00 
+  80088f:	41 ff d0             	call   *%r8
+            panic("write in child: %i", r);
+  800892:	89 c1                	mov    %eax,%ecx
+  800894:	48 ba fe 50 80 00 00 	movabs $0x8050fe,%rdx
+  80089b:	00 00 00 
+  80089e:	be 55 00 00 00       	mov    $0x55,%esi
+  8008a3:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8008aa:	00 00 00 
+  8008ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b2:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  8008b9:	00 00 00 
+  8008bc:	41 ff d0             	call   *%r8
+        panic("parent did not see write of child");
+  8008bf:	48 ba c8 51 80 00 00 	movabs $0x8051c8,%rdx
+  8008c6:	00 00 00 
+  8008c9:	be 5e 00 00 00       	mov    $0x5e,%esi
+  8008ce:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  8008d5:	00 00 00 
+  8008d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dd:	48 b9 ed 09 80 00 00 	movabs $0x8009ed,%rcx
+  8008e4:	00 00 00 
+  8008e7:	ff d1                	call   *%rcx
+    if ((r = remove(PATH)) < 0) panic("remove %s: %i", PATH, r);
+  8008e9:	41 89 c0             	mov    %eax,%r8d
+  8008ec:	48 b9 21 50 80 00 00 	movabs $0x805021,%rcx
+  8008f3:	00 00 00 
+  8008f6:	48 ba 2c 51 80 00 00 	movabs $0x80512c,%rdx
+  8008fd:	00 00 00 
+  800900:	be 62 00 00 00       	mov    $0x62,%esi
+  800905:	48 bf 0c 50 80 00 00 	movabs $0x80500c,%rdi
+  80090c:	00 00 00 
+  80090f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800914:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  80091b:	00 00 00 
+  80091e:	41 ff d1             	call   *%r9
+
+0000000000800921 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800921:	55                   	push   %rbp
+  800922:	48 89 e5             	mov    %rsp,%rbp
+  800925:	41 56                	push   %r14
+  800927:	41 55                	push   %r13
+  800929:	41 54                	push   %r12
+  80092b:	53                   	push   %rbx
+  80092c:	41 89 fd             	mov    %edi,%r13d
+  80092f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800932:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800939:	00 00 00 
+  80093c:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  800943:	00 00 00 
+  800946:	48 39 c2             	cmp    %rax,%rdx
+  800949:	73 17                	jae    800962 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80094b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80094e:	49 89 c4             	mov    %rax,%r12
+  800951:	48 83 c3 08          	add    $0x8,%rbx
+  800955:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095a:	ff 53 f8             	call   *-0x8(%rbx)
+  80095d:	4c 39 e3             	cmp    %r12,%rbx
+  800960:	72 ef                	jb     800951 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800962:	48 b8 55 1b 80 00 00 	movabs $0x801b55,%rax
+  800969:	00 00 00 
+  80096c:	ff d0                	call   *%rax
+  80096e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800973:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80097a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800981:	00 00 00 
+  800984:	48 01 d0             	add    %rdx,%rax
+  800987:	48 a3 48 77 80 00 00 	movabs %rax,0x807748
+  80098e:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800991:	45 85 ed             	test   %r13d,%r13d
+  800994:	7e 0d                	jle    8009a3 <libmain+0x82>
+  800996:	49 8b 06             	mov    (%r14),%rax
+  800999:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8009a0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8009a3:	4c 89 f6             	mov    %r14,%rsi
+  8009a6:	44 89 ef             	mov    %r13d,%edi
+  8009a9:	48 b8 97 00 80 00 00 	movabs $0x800097,%rax
+  8009b0:	00 00 00 
+  8009b3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8009b5:	48 b8 ca 09 80 00 00 	movabs $0x8009ca,%rax
+  8009bc:	00 00 00 
+  8009bf:	ff d0                	call   *%rax
+#endif
+}
+  8009c1:	5b                   	pop    %rbx
+  8009c2:	41 5c                	pop    %r12
+  8009c4:	41 5d                	pop    %r13
+  8009c6:	41 5e                	pop    %r14
+  8009c8:	5d                   	pop    %rbp
+  8009c9:	c3                   	ret
+
+00000000008009ca <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8009ca:	55                   	push   %rbp
+  8009cb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8009ce:	48 b8 5f 29 80 00 00 	movabs $0x80295f,%rax
+  8009d5:	00 00 00 
+  8009d8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8009da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009df:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  8009e6:	00 00 00 
+  8009e9:	ff d0                	call   *%rax
+}
+  8009eb:	5d                   	pop    %rbp
+  8009ec:	c3                   	ret
+
+00000000008009ed <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8009ed:	55                   	push   %rbp
+  8009ee:	48 89 e5             	mov    %rsp,%rbp
+  8009f1:	41 56                	push   %r14
+  8009f3:	41 55                	push   %r13
+  8009f5:	41 54                	push   %r12
+  8009f7:	53                   	push   %rbx
+  8009f8:	48 83 ec 50          	sub    $0x50,%rsp
+  8009fc:	49 89 fc             	mov    %rdi,%r12
+  8009ff:	41 89 f5             	mov    %esi,%r13d
+  800a02:	48 89 d3             	mov    %rdx,%rbx
+  800a05:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800a09:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800a0d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a11:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800a18:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a1c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800a20:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800a24:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800a28:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800a2f:	00 00 00 
+  800a32:	4c 8b 30             	mov    (%rax),%r14
+  800a35:	48 b8 55 1b 80 00 00 	movabs $0x801b55,%rax
+  800a3c:	00 00 00 
+  800a3f:	ff d0                	call   *%rax
+  800a41:	89 c6                	mov    %eax,%esi
+  800a43:	45 89 e8             	mov    %r13d,%r8d
+  800a46:	4c 89 e1             	mov    %r12,%rcx
+  800a49:	4c 89 f2             	mov    %r14,%rdx
+  800a4c:	48 bf f8 51 80 00 00 	movabs $0x8051f8,%rdi
+  800a53:	00 00 00 
+  800a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5b:	49 bc 3d 0b 80 00 00 	movabs $0x800b3d,%r12
+  800a62:	00 00 00 
+  800a65:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800a68:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800a6c:	48 89 df             	mov    %rbx,%rdi
+  800a6f:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  800a76:	00 00 00 
+  800a79:	ff d0                	call   *%rax
+    cprintf("\n");
+  800a7b:	48 bf cf 50 80 00 00 	movabs $0x8050cf,%rdi
+  800a82:	00 00 00 
+  800a85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800a8d:	cc                   	int3
+  800a8e:	eb fd                	jmp    800a8d <_panic+0xa0>
+
+0000000000800a90 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800a90:	55                   	push   %rbp
+  800a91:	48 89 e5             	mov    %rsp,%rbp
+  800a94:	53                   	push   %rbx
+  800a95:	48 83 ec 08          	sub    $0x8,%rsp
+  800a99:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800a9c:	8b 06                	mov    (%rsi),%eax
+  800a9e:	8d 50 01             	lea    0x1(%rax),%edx
+  800aa1:	89 16                	mov    %edx,(%rsi)
+  800aa3:	48 98                	cltq
+  800aa5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800aaa:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800ab0:	74 0a                	je     800abc <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800ab2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800ab6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800aba:	c9                   	leave
+  800abb:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800abc:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800ac0:	be ff 00 00 00       	mov    $0xff,%esi
+  800ac5:	48 b8 8c 1a 80 00 00 	movabs $0x801a8c,%rax
+  800acc:	00 00 00 
+  800acf:	ff d0                	call   *%rax
+        state->offset = 0;
+  800ad1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800ad7:	eb d9                	jmp    800ab2 <putch+0x22>
+
+0000000000800ad9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800ad9:	55                   	push   %rbp
+  800ada:	48 89 e5             	mov    %rsp,%rbp
+  800add:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800ae4:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800ae7:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800aee:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800af3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800afb:	48 89 f1             	mov    %rsi,%rcx
+  800afe:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800b05:	48 bf 90 0a 80 00 00 	movabs $0x800a90,%rdi
+  800b0c:	00 00 00 
+  800b0f:	48 b8 8d 0c 80 00 00 	movabs $0x800c8d,%rax
+  800b16:	00 00 00 
+  800b19:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800b1b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800b22:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800b29:	48 b8 8c 1a 80 00 00 	movabs $0x801a8c,%rax
+  800b30:	00 00 00 
+  800b33:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800b35:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800b3b:	c9                   	leave
+  800b3c:	c3                   	ret
+
+0000000000800b3d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800b3d:	55                   	push   %rbp
+  800b3e:	48 89 e5             	mov    %rsp,%rbp
+  800b41:	48 83 ec 50          	sub    $0x50,%rsp
+  800b45:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800b49:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800b4d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b51:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b55:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800b59:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800b60:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b68:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b6c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800b70:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800b74:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  800b7b:	00 00 00 
+  800b7e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800b80:	c9                   	leave
+  800b81:	c3                   	ret
+
+0000000000800b82 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800b82:	55                   	push   %rbp
+  800b83:	48 89 e5             	mov    %rsp,%rbp
+  800b86:	41 57                	push   %r15
+  800b88:	41 56                	push   %r14
+  800b8a:	41 55                	push   %r13
+  800b8c:	41 54                	push   %r12
+  800b8e:	53                   	push   %rbx
+  800b8f:	48 83 ec 18          	sub    $0x18,%rsp
+  800b93:	49 89 fc             	mov    %rdi,%r12
+  800b96:	49 89 f5             	mov    %rsi,%r13
+  800b99:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800b9d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800ba0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800ba3:	41 89 cf             	mov    %ecx,%r15d
+  800ba6:	4c 39 fa             	cmp    %r15,%rdx
+  800ba9:	73 5b                	jae    800c06 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800bab:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800baf:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800bb3:	85 db                	test   %ebx,%ebx
+  800bb5:	7e 0e                	jle    800bc5 <print_num+0x43>
+            putch(padc, put_arg);
+  800bb7:	4c 89 ee             	mov    %r13,%rsi
+  800bba:	44 89 f7             	mov    %r14d,%edi
+  800bbd:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800bc0:	83 eb 01             	sub    $0x1,%ebx
+  800bc3:	75 f2                	jne    800bb7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800bc5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800bc9:	48 b9 2c 52 80 00 00 	movabs $0x80522c,%rcx
+  800bd0:	00 00 00 
+  800bd3:	48 b8 1b 52 80 00 00 	movabs $0x80521b,%rax
+  800bda:	00 00 00 
+  800bdd:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800be1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800be5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bea:	49 f7 f7             	div    %r15
+  800bed:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800bf1:	4c 89 ee             	mov    %r13,%rsi
+  800bf4:	41 ff d4             	call   *%r12
+}
+  800bf7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bfb:	5b                   	pop    %rbx
+  800bfc:	41 5c                	pop    %r12
+  800bfe:	41 5d                	pop    %r13
+  800c00:	41 5e                	pop    %r14
+  800c02:	41 5f                	pop    %r15
+  800c04:	5d                   	pop    %rbp
+  800c05:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800c06:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0f:	49 f7 f7             	div    %r15
+  800c12:	48 83 ec 08          	sub    $0x8,%rsp
+  800c16:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800c1a:	52                   	push   %rdx
+  800c1b:	45 0f be c9          	movsbl %r9b,%r9d
+  800c1f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800c23:	48 89 c2             	mov    %rax,%rdx
+  800c26:	48 b8 82 0b 80 00 00 	movabs $0x800b82,%rax
+  800c2d:	00 00 00 
+  800c30:	ff d0                	call   *%rax
+  800c32:	48 83 c4 10          	add    $0x10,%rsp
+  800c36:	eb 8d                	jmp    800bc5 <print_num+0x43>
+
+0000000000800c38 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800c38:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800c3c:	48 8b 06             	mov    (%rsi),%rax
+  800c3f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800c43:	73 0a                	jae    800c4f <sprintputch+0x17>
+        *state->start++ = ch;
+  800c45:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c49:	48 89 16             	mov    %rdx,(%rsi)
+  800c4c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800c4f:	c3                   	ret
+
+0000000000800c50 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800c50:	55                   	push   %rbp
+  800c51:	48 89 e5             	mov    %rsp,%rbp
+  800c54:	48 83 ec 50          	sub    $0x50,%rsp
+  800c58:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c5c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c60:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800c64:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c6b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c73:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c77:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800c7b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c7f:	48 b8 8d 0c 80 00 00 	movabs $0x800c8d,%rax
+  800c86:	00 00 00 
+  800c89:	ff d0                	call   *%rax
+}
+  800c8b:	c9                   	leave
+  800c8c:	c3                   	ret
+
+0000000000800c8d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800c8d:	55                   	push   %rbp
+  800c8e:	48 89 e5             	mov    %rsp,%rbp
+  800c91:	41 57                	push   %r15
+  800c93:	41 56                	push   %r14
+  800c95:	41 55                	push   %r13
+  800c97:	41 54                	push   %r12
+  800c99:	53                   	push   %rbx
+  800c9a:	48 83 ec 38          	sub    $0x38,%rsp
+  800c9e:	49 89 fe             	mov    %rdi,%r14
+  800ca1:	49 89 f5             	mov    %rsi,%r13
+  800ca4:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800ca7:	48 8b 01             	mov    (%rcx),%rax
+  800caa:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800cae:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800cba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800cbe:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800cc2:	0f b6 3b             	movzbl (%rbx),%edi
+  800cc5:	40 80 ff 25          	cmp    $0x25,%dil
+  800cc9:	74 18                	je     800ce3 <vprintfmt+0x56>
+            if (!ch) return;
+  800ccb:	40 84 ff             	test   %dil,%dil
+  800cce:	0f 84 04 07 00 00    	je     8013d8 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800cd4:	40 0f b6 ff          	movzbl %dil,%edi
+  800cd8:	4c 89 ee             	mov    %r13,%rsi
+  800cdb:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800cde:	4c 89 e3             	mov    %r12,%rbx
+  800ce1:	eb db                	jmp    800cbe <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800ce3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ce8:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800cec:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800cf1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800cf7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800cfe:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800d02:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800d07:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800d0c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800d0f:	83 e8 23             	sub    $0x23,%eax
+  800d12:	3c 57                	cmp    $0x57,%al
+  800d14:	0f 87 a4 06 00 00    	ja     8013be <vprintfmt+0x731>
+  800d1a:	0f b6 c0             	movzbl %al,%eax
+  800d1d:	48 b9 c0 53 80 00 00 	movabs $0x8053c0,%rcx
+  800d24:	00 00 00 
+  800d27:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800d2a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800d2d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800d31:	eb cf                	jmp    800d02 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800d33:	49 89 dc             	mov    %rbx,%r12
+  800d36:	be 01 00 00 00       	mov    $0x1,%esi
+  800d3b:	eb c5                	jmp    800d02 <vprintfmt+0x75>
+            padc = ch;
+  800d3d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800d41:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800d44:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800d47:	eb b9                	jmp    800d02 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800d49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4f:	77 24                	ja     800d75 <vprintfmt+0xe8>
+  800d51:	89 c1                	mov    %eax,%ecx
+  800d53:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800d57:	83 c0 08             	add    $0x8,%eax
+  800d5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d5d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800d60:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800d63:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800d67:	79 99                	jns    800d02 <vprintfmt+0x75>
+                width = precision;
+  800d69:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800d6d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800d73:	eb 8d                	jmp    800d02 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800d75:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800d79:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800d7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d81:	eb da                	jmp    800d5d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800d83:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800d88:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800d8c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800d92:	3c 39                	cmp    $0x39,%al
+  800d94:	77 1c                	ja     800db2 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800d96:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800d9a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800d9e:	0f b6 c0             	movzbl %al,%eax
+  800da1:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800da6:	0f b6 03             	movzbl (%rbx),%eax
+  800da9:	3c 39                	cmp    $0x39,%al
+  800dab:	76 e9                	jbe    800d96 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800dad:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800db0:	eb b1                	jmp    800d63 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800db2:	49 89 dc             	mov    %rbx,%r12
+  800db5:	eb ac                	jmp    800d63 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800db7:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800dba:	85 c9                	test   %ecx,%ecx
+  800dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc1:	0f 49 c1             	cmovns %ecx,%eax
+  800dc4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800dc7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800dca:	e9 33 ff ff ff       	jmp    800d02 <vprintfmt+0x75>
+            lflag++;
+  800dcf:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800dd2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800dd5:	e9 28 ff ff ff       	jmp    800d02 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800dda:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ddd:	83 f8 2f             	cmp    $0x2f,%eax
+  800de0:	77 19                	ja     800dfb <vprintfmt+0x16e>
+  800de2:	89 c2                	mov    %eax,%edx
+  800de4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800de8:	83 c0 08             	add    $0x8,%eax
+  800deb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dee:	8b 3a                	mov    (%rdx),%edi
+  800df0:	4c 89 ee             	mov    %r13,%rsi
+  800df3:	41 ff d6             	call   *%r14
+            break;
+  800df6:	e9 c3 fe ff ff       	jmp    800cbe <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800dfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e07:	eb e5                	jmp    800dee <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800e09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e0f:	77 5a                	ja     800e6b <vprintfmt+0x1de>
+  800e11:	89 c2                	mov    %eax,%edx
+  800e13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e17:	83 c0 08             	add    $0x8,%eax
+  800e1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800e1d:	8b 02                	mov    (%rdx),%eax
+  800e1f:	89 c1                	mov    %eax,%ecx
+  800e21:	f7 d9                	neg    %ecx
+  800e23:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800e26:	83 f9 13             	cmp    $0x13,%ecx
+  800e29:	7f 4e                	jg     800e79 <vprintfmt+0x1ec>
+  800e2b:	48 63 c1             	movslq %ecx,%rax
+  800e2e:	48 ba 80 56 80 00 00 	movabs $0x805680,%rdx
+  800e35:	00 00 00 
+  800e38:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800e3c:	48 85 c0             	test   %rax,%rax
+  800e3f:	74 38                	je     800e79 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800e41:	48 89 c1             	mov    %rax,%rcx
+  800e44:	48 ba 74 50 80 00 00 	movabs $0x805074,%rdx
+  800e4b:	00 00 00 
+  800e4e:	4c 89 ee             	mov    %r13,%rsi
+  800e51:	4c 89 f7             	mov    %r14,%rdi
+  800e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e59:	49 b8 50 0c 80 00 00 	movabs $0x800c50,%r8
+  800e60:	00 00 00 
+  800e63:	41 ff d0             	call   *%r8
+  800e66:	e9 53 fe ff ff       	jmp    800cbe <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800e6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e77:	eb a4                	jmp    800e1d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800e79:	48 ba 44 52 80 00 00 	movabs $0x805244,%rdx
+  800e80:	00 00 00 
+  800e83:	4c 89 ee             	mov    %r13,%rsi
+  800e86:	4c 89 f7             	mov    %r14,%rdi
+  800e89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e8e:	49 b8 50 0c 80 00 00 	movabs $0x800c50,%r8
+  800e95:	00 00 00 
+  800e98:	41 ff d0             	call   *%r8
+  800e9b:	e9 1e fe ff ff       	jmp    800cbe <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800ea0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ea3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ea6:	77 36                	ja     800ede <vprintfmt+0x251>
+  800ea8:	89 c2                	mov    %eax,%edx
+  800eaa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800eae:	83 c0 08             	add    $0x8,%eax
+  800eb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eb4:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800eb7:	48 85 f6             	test   %rsi,%rsi
+  800eba:	48 b8 3d 52 80 00 00 	movabs $0x80523d,%rax
+  800ec1:	00 00 00 
+  800ec4:	48 0f 45 c6          	cmovne %rsi,%rax
+  800ec8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800ecc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ed0:	7e 06                	jle    800ed8 <vprintfmt+0x24b>
+  800ed2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800ed6:	75 14                	jne    800eec <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800ed8:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800edc:	eb 5b                	jmp    800f39 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800ede:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ee2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ee6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eea:	eb c8                	jmp    800eb4 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800eec:	49 63 f7             	movslq %r15d,%rsi
+  800eef:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800ef3:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  800efa:	00 00 00 
+  800efd:	ff d0                	call   *%rax
+  800eff:	48 89 c2             	mov    %rax,%rdx
+  800f02:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800f05:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800f07:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800f0a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800f0d:	85 c0                	test   %eax,%eax
+  800f0f:	7e c7                	jle    800ed8 <vprintfmt+0x24b>
+  800f11:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800f16:	4c 89 ee             	mov    %r13,%rsi
+  800f19:	44 89 e7             	mov    %r12d,%edi
+  800f1c:	41 ff d6             	call   *%r14
+  800f1f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800f23:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800f26:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800f29:	75 eb                	jne    800f16 <vprintfmt+0x289>
+  800f2b:	eb ab                	jmp    800ed8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800f2d:	0f b6 f8             	movzbl %al,%edi
+  800f30:	4c 89 ee             	mov    %r13,%rsi
+  800f33:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800f36:	4c 89 e2             	mov    %r12,%rdx
+  800f39:	45 85 ff             	test   %r15d,%r15d
+  800f3c:	78 06                	js     800f44 <vprintfmt+0x2b7>
+  800f3e:	41 83 ef 01          	sub    $0x1,%r15d
+  800f42:	78 23                	js     800f67 <vprintfmt+0x2da>
+  800f44:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800f48:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800f4e:	84 c0                	test   %al,%al
+  800f50:	74 15                	je     800f67 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800f52:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800f56:	74 d5                	je     800f2d <vprintfmt+0x2a0>
+  800f58:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800f5b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800f60:	80 fa 5e             	cmp    $0x5e,%dl
+  800f63:	77 cb                	ja     800f30 <vprintfmt+0x2a3>
+  800f65:	eb c6                	jmp    800f2d <vprintfmt+0x2a0>
+  800f67:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800f6a:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800f6d:	01 f0                	add    %esi,%eax
+  800f6f:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800f71:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800f75:	85 c0                	test   %eax,%eax
+  800f77:	0f 8e 41 fd ff ff    	jle    800cbe <vprintfmt+0x31>
+  800f7d:	4c 89 ee             	mov    %r13,%rsi
+  800f80:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f85:	41 ff d6             	call   *%r14
+  800f88:	41 83 ec 01          	sub    $0x1,%r12d
+  800f8c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800f90:	75 eb                	jne    800f7d <vprintfmt+0x2f0>
+  800f92:	e9 27 fd ff ff       	jmp    800cbe <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800f97:	40 84 f6             	test   %sil,%sil
+  800f9a:	75 26                	jne    800fc2 <vprintfmt+0x335>
+    switch (lflag) {
+  800f9c:	85 d2                	test   %edx,%edx
+  800f9e:	74 59                	je     800ff9 <vprintfmt+0x36c>
+  800fa0:	83 fa 01             	cmp    $0x1,%edx
+  800fa3:	74 7b                	je     801020 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800fa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fa8:	83 f8 2f             	cmp    $0x2f,%eax
+  800fab:	0f 87 96 00 00 00    	ja     801047 <vprintfmt+0x3ba>
+  800fb1:	89 c2                	mov    %eax,%edx
+  800fb3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fb7:	83 c0 08             	add    $0x8,%eax
+  800fba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fbd:	4c 8b 22             	mov    (%rdx),%r12
+  800fc0:	eb 17                	jmp    800fd9 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800fc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fc5:	83 f8 2f             	cmp    $0x2f,%eax
+  800fc8:	77 21                	ja     800feb <vprintfmt+0x35e>
+  800fca:	89 c2                	mov    %eax,%edx
+  800fcc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fd0:	83 c0 08             	add    $0x8,%eax
+  800fd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fd6:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800fd9:	4d 85 e4             	test   %r12,%r12
+  800fdc:	78 7a                	js     801058 <vprintfmt+0x3cb>
+            num = i;
+  800fde:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800fe1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800fe6:	e9 b5 02 00 00       	jmp    8012a0 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800feb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ff3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ff7:	eb dd                	jmp    800fd6 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800ff9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ffc:	83 f8 2f             	cmp    $0x2f,%eax
+  800fff:	77 11                	ja     801012 <vprintfmt+0x385>
+  801001:	89 c2                	mov    %eax,%edx
+  801003:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801007:	83 c0 08             	add    $0x8,%eax
+  80100a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80100d:	4c 63 22             	movslq (%rdx),%r12
+  801010:	eb c7                	jmp    800fd9 <vprintfmt+0x34c>
+  801012:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801016:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80101a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80101e:	eb ed                	jmp    80100d <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  801020:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801023:	83 f8 2f             	cmp    $0x2f,%eax
+  801026:	77 11                	ja     801039 <vprintfmt+0x3ac>
+  801028:	89 c2                	mov    %eax,%edx
+  80102a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80102e:	83 c0 08             	add    $0x8,%eax
+  801031:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801034:	4c 8b 22             	mov    (%rdx),%r12
+  801037:	eb a0                	jmp    800fd9 <vprintfmt+0x34c>
+  801039:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80103d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801041:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801045:	eb ed                	jmp    801034 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  801047:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80104b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80104f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801053:	e9 65 ff ff ff       	jmp    800fbd <vprintfmt+0x330>
+                putch('-', put_arg);
+  801058:	4c 89 ee             	mov    %r13,%rsi
+  80105b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801060:	41 ff d6             	call   *%r14
+                i = -i;
+  801063:	49 f7 dc             	neg    %r12
+  801066:	e9 73 ff ff ff       	jmp    800fde <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  80106b:	40 84 f6             	test   %sil,%sil
+  80106e:	75 32                	jne    8010a2 <vprintfmt+0x415>
+    switch (lflag) {
+  801070:	85 d2                	test   %edx,%edx
+  801072:	74 5d                	je     8010d1 <vprintfmt+0x444>
+  801074:	83 fa 01             	cmp    $0x1,%edx
+  801077:	0f 84 82 00 00 00    	je     8010ff <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  80107d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801080:	83 f8 2f             	cmp    $0x2f,%eax
+  801083:	0f 87 a5 00 00 00    	ja     80112e <vprintfmt+0x4a1>
+  801089:	89 c2                	mov    %eax,%edx
+  80108b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80108f:	83 c0 08             	add    $0x8,%eax
+  801092:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801095:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801098:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80109d:	e9 fe 01 00 00       	jmp    8012a0 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  8010a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8010a8:	77 19                	ja     8010c3 <vprintfmt+0x436>
+  8010aa:	89 c2                	mov    %eax,%edx
+  8010ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010b0:	83 c0 08             	add    $0x8,%eax
+  8010b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010b6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8010b9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8010be:	e9 dd 01 00 00       	jmp    8012a0 <vprintfmt+0x613>
+  8010c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010cf:	eb e5                	jmp    8010b6 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  8010d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8010d7:	77 18                	ja     8010f1 <vprintfmt+0x464>
+  8010d9:	89 c2                	mov    %eax,%edx
+  8010db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010df:	83 c0 08             	add    $0x8,%eax
+  8010e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010e5:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8010e7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8010ec:	e9 af 01 00 00       	jmp    8012a0 <vprintfmt+0x613>
+  8010f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010fd:	eb e6                	jmp    8010e5 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  8010ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801102:	83 f8 2f             	cmp    $0x2f,%eax
+  801105:	77 19                	ja     801120 <vprintfmt+0x493>
+  801107:	89 c2                	mov    %eax,%edx
+  801109:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80110d:	83 c0 08             	add    $0x8,%eax
+  801110:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801113:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801116:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80111b:	e9 80 01 00 00       	jmp    8012a0 <vprintfmt+0x613>
+  801120:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801124:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801128:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80112c:	eb e5                	jmp    801113 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  80112e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801132:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801136:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80113a:	e9 56 ff ff ff       	jmp    801095 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  80113f:	40 84 f6             	test   %sil,%sil
+  801142:	75 2e                	jne    801172 <vprintfmt+0x4e5>
+    switch (lflag) {
+  801144:	85 d2                	test   %edx,%edx
+  801146:	0f 84 b3 00 00 00    	je     8011ff <vprintfmt+0x572>
+  80114c:	83 fa 01             	cmp    $0x1,%edx
+  80114f:	0f 84 d3 00 00 00    	je     801228 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  801155:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801158:	83 f8 2f             	cmp    $0x2f,%eax
+  80115b:	0f 87 f1 00 00 00    	ja     801252 <vprintfmt+0x5c5>
+  801161:	89 c2                	mov    %eax,%edx
+  801163:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801167:	83 c0 08             	add    $0x8,%eax
+  80116a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80116d:	48 8b 02             	mov    (%rdx),%rax
+  801170:	eb 17                	jmp    801189 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  801172:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801175:	83 f8 2f             	cmp    $0x2f,%eax
+  801178:	77 77                	ja     8011f1 <vprintfmt+0x564>
+  80117a:	89 c2                	mov    %eax,%edx
+  80117c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801180:	83 c0 08             	add    $0x8,%eax
+  801183:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801186:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  801189:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80118b:	83 f8 07             	cmp    $0x7,%eax
+  80118e:	0f 8e cf 00 00 00    	jle    801263 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  801194:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  80119a:	44 89 e7             	mov    %r12d,%edi
+  80119d:	41 c1 e4 03          	shl    $0x3,%r12d
+  8011a1:	89 d1                	mov    %edx,%ecx
+  8011a3:	8d 72 07             	lea    0x7(%rdx),%esi
+  8011a6:	85 d2                	test   %edx,%edx
+  8011a8:	0f 48 d6             	cmovs  %esi,%edx
+  8011ab:	c1 fa 03             	sar    $0x3,%edx
+  8011ae:	83 f9 3f             	cmp    $0x3f,%ecx
+  8011b1:	7f e7                	jg     80119a <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  8011b3:	85 ff                	test   %edi,%edi
+  8011b5:	0f 84 03 fb ff ff    	je     800cbe <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  8011bb:	49 63 f4             	movslq %r12d,%rsi
+  8011be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c3:	48 f7 f6             	div    %rsi
+  8011c6:	49 89 d7             	mov    %rdx,%r15
+  8011c9:	83 c0 30             	add    $0x30,%eax
+  8011cc:	0f be f8             	movsbl %al,%edi
+  8011cf:	4c 89 ee             	mov    %r13,%rsi
+  8011d2:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  8011d5:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  8011d8:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  8011dd:	45 85 e4             	test   %r12d,%r12d
+  8011e0:	41 0f 49 d4          	cmovns %r12d,%edx
+  8011e4:	c1 fa 03             	sar    $0x3,%edx
+  8011e7:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  8011ea:	75 cf                	jne    8011bb <vprintfmt+0x52e>
+  8011ec:	e9 cd fa ff ff       	jmp    800cbe <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8011f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011fd:	eb 87                	jmp    801186 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  8011ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801202:	83 f8 2f             	cmp    $0x2f,%eax
+  801205:	77 13                	ja     80121a <vprintfmt+0x58d>
+  801207:	89 c2                	mov    %eax,%edx
+  801209:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80120d:	83 c0 08             	add    $0x8,%eax
+  801210:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801213:	8b 02                	mov    (%rdx),%eax
+  801215:	e9 6f ff ff ff       	jmp    801189 <vprintfmt+0x4fc>
+  80121a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80121e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801222:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801226:	eb eb                	jmp    801213 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  801228:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80122b:	83 f8 2f             	cmp    $0x2f,%eax
+  80122e:	77 14                	ja     801244 <vprintfmt+0x5b7>
+  801230:	89 c2                	mov    %eax,%edx
+  801232:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801236:	83 c0 08             	add    $0x8,%eax
+  801239:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80123c:	48 8b 02             	mov    (%rdx),%rax
+  80123f:	e9 45 ff ff ff       	jmp    801189 <vprintfmt+0x4fc>
+  801244:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801248:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80124c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801250:	eb ea                	jmp    80123c <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  801252:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801256:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80125a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80125e:	e9 0a ff ff ff       	jmp    80116d <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  801263:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  801269:	e9 4d ff ff ff       	jmp    8011bb <vprintfmt+0x52e>
+            putch('0', put_arg);
+  80126e:	4c 89 ee             	mov    %r13,%rsi
+  801271:	bf 30 00 00 00       	mov    $0x30,%edi
+  801276:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801279:	4c 89 ee             	mov    %r13,%rsi
+  80127c:	bf 78 00 00 00       	mov    $0x78,%edi
+  801281:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801284:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801287:	83 f8 2f             	cmp    $0x2f,%eax
+  80128a:	77 47                	ja     8012d3 <vprintfmt+0x646>
+  80128c:	89 c2                	mov    %eax,%edx
+  80128e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801292:	83 c0 08             	add    $0x8,%eax
+  801295:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801298:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80129b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8012a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8012a4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8012a8:	0f 94 c0             	sete   %al
+  8012ab:	0f b6 c0             	movzbl %al,%eax
+  8012ae:	50                   	push   %rax
+  8012af:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8012b4:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8012b8:	4c 89 ee             	mov    %r13,%rsi
+  8012bb:	4c 89 f7             	mov    %r14,%rdi
+  8012be:	48 b8 82 0b 80 00 00 	movabs $0x800b82,%rax
+  8012c5:	00 00 00 
+  8012c8:	ff d0                	call   *%rax
+            break;
+  8012ca:	48 83 c4 10          	add    $0x10,%rsp
+  8012ce:	e9 eb f9 ff ff       	jmp    800cbe <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8012d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012df:	eb b7                	jmp    801298 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  8012e1:	40 84 f6             	test   %sil,%sil
+  8012e4:	75 2b                	jne    801311 <vprintfmt+0x684>
+    switch (lflag) {
+  8012e6:	85 d2                	test   %edx,%edx
+  8012e8:	74 56                	je     801340 <vprintfmt+0x6b3>
+  8012ea:	83 fa 01             	cmp    $0x1,%edx
+  8012ed:	74 7f                	je     80136e <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  8012ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8012f5:	0f 87 a2 00 00 00    	ja     80139d <vprintfmt+0x710>
+  8012fb:	89 c2                	mov    %eax,%edx
+  8012fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801301:	83 c0 08             	add    $0x8,%eax
+  801304:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801307:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80130a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80130f:	eb 8f                	jmp    8012a0 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  801311:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801314:	83 f8 2f             	cmp    $0x2f,%eax
+  801317:	77 19                	ja     801332 <vprintfmt+0x6a5>
+  801319:	89 c2                	mov    %eax,%edx
+  80131b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80131f:	83 c0 08             	add    $0x8,%eax
+  801322:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801325:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801328:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80132d:	e9 6e ff ff ff       	jmp    8012a0 <vprintfmt+0x613>
+  801332:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801336:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80133a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80133e:	eb e5                	jmp    801325 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  801340:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801343:	83 f8 2f             	cmp    $0x2f,%eax
+  801346:	77 18                	ja     801360 <vprintfmt+0x6d3>
+  801348:	89 c2                	mov    %eax,%edx
+  80134a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80134e:	83 c0 08             	add    $0x8,%eax
+  801351:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801354:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801356:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80135b:	e9 40 ff ff ff       	jmp    8012a0 <vprintfmt+0x613>
+  801360:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801364:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801368:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80136c:	eb e6                	jmp    801354 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  80136e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801371:	83 f8 2f             	cmp    $0x2f,%eax
+  801374:	77 19                	ja     80138f <vprintfmt+0x702>
+  801376:	89 c2                	mov    %eax,%edx
+  801378:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80137c:	83 c0 08             	add    $0x8,%eax
+  80137f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801382:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801385:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80138a:	e9 11 ff ff ff       	jmp    8012a0 <vprintfmt+0x613>
+  80138f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801393:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801397:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80139b:	eb e5                	jmp    801382 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  80139d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013a9:	e9 59 ff ff ff       	jmp    801307 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  8013ae:	4c 89 ee             	mov    %r13,%rsi
+  8013b1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8013b6:	41 ff d6             	call   *%r14
+            break;
+  8013b9:	e9 00 f9 ff ff       	jmp    800cbe <vprintfmt+0x31>
+            putch('%', put_arg);
+  8013be:	4c 89 ee             	mov    %r13,%rsi
+  8013c1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8013c6:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8013c9:	48 83 eb 01          	sub    $0x1,%rbx
+  8013cd:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8013d1:	75 f6                	jne    8013c9 <vprintfmt+0x73c>
+  8013d3:	e9 e6 f8 ff ff       	jmp    800cbe <vprintfmt+0x31>
+}
+  8013d8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8013dc:	5b                   	pop    %rbx
+  8013dd:	41 5c                	pop    %r12
+  8013df:	41 5d                	pop    %r13
+  8013e1:	41 5e                	pop    %r14
+  8013e3:	41 5f                	pop    %r15
+  8013e5:	5d                   	pop    %rbp
+  8013e6:	c3                   	ret
+
+00000000008013e7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8013e7:	55                   	push   %rbp
+  8013e8:	48 89 e5             	mov    %rsp,%rbp
+  8013eb:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8013ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013f3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8013f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8013fc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801403:	48 85 ff             	test   %rdi,%rdi
+  801406:	74 2b                	je     801433 <vsnprintf+0x4c>
+  801408:	48 85 f6             	test   %rsi,%rsi
+  80140b:	74 26                	je     801433 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80140d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801411:	48 bf 38 0c 80 00 00 	movabs $0x800c38,%rdi
+  801418:	00 00 00 
+  80141b:	48 b8 8d 0c 80 00 00 	movabs $0x800c8d,%rax
+  801422:	00 00 00 
+  801425:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801427:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80142b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80142e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801431:	c9                   	leave
+  801432:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801433:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801438:	eb f7                	jmp    801431 <vsnprintf+0x4a>
+
+000000000080143a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80143a:	55                   	push   %rbp
+  80143b:	48 89 e5             	mov    %rsp,%rbp
+  80143e:	48 83 ec 50          	sub    $0x50,%rsp
+  801442:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801446:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80144a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80144e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801455:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801459:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80145d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801461:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801465:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801469:	48 b8 e7 13 80 00 00 	movabs $0x8013e7,%rax
+  801470:	00 00 00 
+  801473:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801475:	c9                   	leave
+  801476:	c3                   	ret
+
+0000000000801477 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801477:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80147a:	74 10                	je     80148c <strlen+0x15>
+    size_t n = 0;
+  80147c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801481:	48 83 c0 01          	add    $0x1,%rax
+  801485:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801489:	75 f6                	jne    801481 <strlen+0xa>
+  80148b:	c3                   	ret
+    size_t n = 0;
+  80148c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801491:	c3                   	ret
+
+0000000000801492 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801492:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801495:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80149a:	48 85 f6             	test   %rsi,%rsi
+  80149d:	74 11                	je     8014b0 <strnlen+0x1e>
+  80149f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8014a3:	74 0c                	je     8014b1 <strnlen+0x1f>
+  8014a5:	48 83 c2 01          	add    $0x1,%rdx
+  8014a9:	48 39 d0             	cmp    %rdx,%rax
+  8014ac:	75 f1                	jne    80149f <strnlen+0xd>
+  8014ae:	eb 04                	jmp    8014b4 <strnlen+0x22>
+  8014b0:	c3                   	ret
+  8014b1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8014b4:	c3                   	ret
+
+00000000008014b5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8014b5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8014b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014bd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8014c1:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8014c4:	48 83 c2 01          	add    $0x1,%rdx
+  8014c8:	84 c9                	test   %cl,%cl
+  8014ca:	75 f1                	jne    8014bd <strcpy+0x8>
+        ;
+    return res;
+}
+  8014cc:	c3                   	ret
+
+00000000008014cd <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8014cd:	55                   	push   %rbp
+  8014ce:	48 89 e5             	mov    %rsp,%rbp
+  8014d1:	41 54                	push   %r12
+  8014d3:	53                   	push   %rbx
+  8014d4:	48 89 fb             	mov    %rdi,%rbx
+  8014d7:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8014da:	48 b8 77 14 80 00 00 	movabs $0x801477,%rax
+  8014e1:	00 00 00 
+  8014e4:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8014e6:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8014ea:	4c 89 e6             	mov    %r12,%rsi
+  8014ed:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  8014f4:	00 00 00 
+  8014f7:	ff d0                	call   *%rax
+    return dst;
+}
+  8014f9:	48 89 d8             	mov    %rbx,%rax
+  8014fc:	5b                   	pop    %rbx
+  8014fd:	41 5c                	pop    %r12
+  8014ff:	5d                   	pop    %rbp
+  801500:	c3                   	ret
+
+0000000000801501 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801501:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801504:	48 85 d2             	test   %rdx,%rdx
+  801507:	74 1f                	je     801528 <strncpy+0x27>
+  801509:	48 01 fa             	add    %rdi,%rdx
+  80150c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80150f:	48 83 c1 01          	add    $0x1,%rcx
+  801513:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801517:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80151b:	41 80 f8 01          	cmp    $0x1,%r8b
+  80151f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801523:	48 39 ca             	cmp    %rcx,%rdx
+  801526:	75 e7                	jne    80150f <strncpy+0xe>
+    }
+    return ret;
+}
+  801528:	c3                   	ret
+
+0000000000801529 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801529:	48 89 f8             	mov    %rdi,%rax
+  80152c:	48 85 d2             	test   %rdx,%rdx
+  80152f:	74 24                	je     801555 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801531:	48 83 ea 01          	sub    $0x1,%rdx
+  801535:	74 1b                	je     801552 <strlcpy+0x29>
+  801537:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80153b:	0f b6 16             	movzbl (%rsi),%edx
+  80153e:	84 d2                	test   %dl,%dl
+  801540:	74 10                	je     801552 <strlcpy+0x29>
+            *dst++ = *src++;
+  801542:	48 83 c6 01          	add    $0x1,%rsi
+  801546:	48 83 c0 01          	add    $0x1,%rax
+  80154a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80154d:	48 39 c8             	cmp    %rcx,%rax
+  801550:	75 e9                	jne    80153b <strlcpy+0x12>
+        *dst = '\0';
+  801552:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801555:	48 29 f8             	sub    %rdi,%rax
+}
+  801558:	c3                   	ret
+
+0000000000801559 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801559:	0f b6 07             	movzbl (%rdi),%eax
+  80155c:	84 c0                	test   %al,%al
+  80155e:	74 13                	je     801573 <strcmp+0x1a>
+  801560:	38 06                	cmp    %al,(%rsi)
+  801562:	75 0f                	jne    801573 <strcmp+0x1a>
+  801564:	48 83 c7 01          	add    $0x1,%rdi
+  801568:	48 83 c6 01          	add    $0x1,%rsi
+  80156c:	0f b6 07             	movzbl (%rdi),%eax
+  80156f:	84 c0                	test   %al,%al
+  801571:	75 ed                	jne    801560 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801573:	0f b6 c0             	movzbl %al,%eax
+  801576:	0f b6 16             	movzbl (%rsi),%edx
+  801579:	29 d0                	sub    %edx,%eax
+}
+  80157b:	c3                   	ret
+
+000000000080157c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80157c:	48 85 d2             	test   %rdx,%rdx
+  80157f:	74 1f                	je     8015a0 <strncmp+0x24>
+  801581:	0f b6 07             	movzbl (%rdi),%eax
+  801584:	84 c0                	test   %al,%al
+  801586:	74 1e                	je     8015a6 <strncmp+0x2a>
+  801588:	3a 06                	cmp    (%rsi),%al
+  80158a:	75 1a                	jne    8015a6 <strncmp+0x2a>
+  80158c:	48 83 c7 01          	add    $0x1,%rdi
+  801590:	48 83 c6 01          	add    $0x1,%rsi
+  801594:	48 83 ea 01          	sub    $0x1,%rdx
+  801598:	75 e7                	jne    801581 <strncmp+0x5>
+
+    if (!n) return 0;
+  80159a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159f:	c3                   	ret
+  8015a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a5:	c3                   	ret
+  8015a6:	48 85 d2             	test   %rdx,%rdx
+  8015a9:	74 09                	je     8015b4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8015ab:	0f b6 07             	movzbl (%rdi),%eax
+  8015ae:	0f b6 16             	movzbl (%rsi),%edx
+  8015b1:	29 d0                	sub    %edx,%eax
+  8015b3:	c3                   	ret
+    if (!n) return 0;
+  8015b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015b9:	c3                   	ret
+
+00000000008015ba <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8015ba:	0f b6 17             	movzbl (%rdi),%edx
+  8015bd:	84 d2                	test   %dl,%dl
+  8015bf:	74 18                	je     8015d9 <strchr+0x1f>
+        if (*str == c) {
+  8015c1:	0f be d2             	movsbl %dl,%edx
+  8015c4:	39 f2                	cmp    %esi,%edx
+  8015c6:	74 17                	je     8015df <strchr+0x25>
+    for (; *str; str++) {
+  8015c8:	48 83 c7 01          	add    $0x1,%rdi
+  8015cc:	0f b6 17             	movzbl (%rdi),%edx
+  8015cf:	84 d2                	test   %dl,%dl
+  8015d1:	75 ee                	jne    8015c1 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8015d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d8:	c3                   	ret
+  8015d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015de:	c3                   	ret
+  8015df:	48 89 f8             	mov    %rdi,%rax
+}
+  8015e2:	c3                   	ret
+
+00000000008015e3 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8015e3:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8015e6:	0f b6 17             	movzbl (%rdi),%edx
+  8015e9:	84 d2                	test   %dl,%dl
+  8015eb:	74 13                	je     801600 <strfind+0x1d>
+  8015ed:	0f be d2             	movsbl %dl,%edx
+  8015f0:	39 f2                	cmp    %esi,%edx
+  8015f2:	74 0b                	je     8015ff <strfind+0x1c>
+  8015f4:	48 83 c0 01          	add    $0x1,%rax
+  8015f8:	0f b6 10             	movzbl (%rax),%edx
+  8015fb:	84 d2                	test   %dl,%dl
+  8015fd:	75 ee                	jne    8015ed <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8015ff:	c3                   	ret
+  801600:	c3                   	ret
+
+0000000000801601 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  801601:	55                   	push   %rbp
+  801602:	48 89 e5             	mov    %rsp,%rbp
+  801605:	41 57                	push   %r15
+  801607:	41 56                	push   %r14
+  801609:	41 55                	push   %r13
+  80160b:	41 54                	push   %r12
+  80160d:	53                   	push   %rbx
+  80160e:	48 83 ec 08          	sub    $0x8,%rsp
+  801612:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  801615:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  801619:	45 84 ed             	test   %r13b,%r13b
+  80161c:	75 12                	jne    801630 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  80161e:	4c 89 f8             	mov    %r15,%rax
+  801621:	48 83 c4 08          	add    $0x8,%rsp
+  801625:	5b                   	pop    %rbx
+  801626:	41 5c                	pop    %r12
+  801628:	41 5d                	pop    %r13
+  80162a:	41 5e                	pop    %r14
+  80162c:	41 5f                	pop    %r15
+  80162e:	5d                   	pop    %rbp
+  80162f:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  801630:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  801634:	4c 89 e7             	mov    %r12,%rdi
+  801637:	48 b8 77 14 80 00 00 	movabs $0x801477,%rax
+  80163e:	00 00 00 
+  801641:	ff d0                	call   *%rax
+  801643:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  801646:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  80164a:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  80164e:	49 bf 7c 15 80 00 00 	movabs $0x80157c,%r15
+  801655:	00 00 00 
+				if ((sc = *s++) == 0)
+  801658:	84 c0                	test   %al,%al
+  80165a:	75 14                	jne    801670 <strstr+0x6f>
+					return NULL;
+  80165c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801662:	eb ba                	jmp    80161e <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  801664:	48 83 c3 01          	add    $0x1,%rbx
+  801668:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80166c:	84 c0                	test   %al,%al
+  80166e:	74 1b                	je     80168b <strstr+0x8a>
+			} while (sc != c);
+  801670:	41 38 c5             	cmp    %al,%r13b
+  801673:	75 ef                	jne    801664 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  801675:	4c 89 f2             	mov    %r14,%rdx
+  801678:	4c 89 e6             	mov    %r12,%rsi
+  80167b:	48 89 df             	mov    %rbx,%rdi
+  80167e:	41 ff d7             	call   *%r15
+  801681:	85 c0                	test   %eax,%eax
+  801683:	75 df                	jne    801664 <strstr+0x63>
+  801685:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  801689:	eb 93                	jmp    80161e <strstr+0x1d>
+					return NULL;
+  80168b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801691:	eb 8b                	jmp    80161e <strstr+0x1d>
+
+0000000000801693 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  801693:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  801695:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  801698:	8d 57 20             	lea    0x20(%rdi),%edx
+  80169b:	83 f9 1a             	cmp    $0x1a,%ecx
+  80169e:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8016a1:	c3                   	ret
+
+00000000008016a2 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  8016a2:	55                   	push   %rbp
+  8016a3:	48 89 e5             	mov    %rsp,%rbp
+  8016a6:	41 57                	push   %r15
+  8016a8:	41 56                	push   %r14
+  8016aa:	41 55                	push   %r13
+  8016ac:	41 54                	push   %r12
+  8016ae:	53                   	push   %rbx
+  8016af:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  8016b3:	48 39 f7             	cmp    %rsi,%rdi
+  8016b6:	74 49                	je     801701 <strcasecmp+0x5f>
+  8016b8:	49 89 fd             	mov    %rdi,%r13
+  8016bb:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  8016be:	49 bf 93 16 80 00 00 	movabs $0x801693,%r15
+  8016c5:	00 00 00 
+  8016c8:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  8016cd:	41 0f b6 fe          	movzbl %r14b,%edi
+  8016d1:	41 ff d7             	call   *%r15
+  8016d4:	89 c3                	mov    %eax,%ebx
+  8016d6:	49 83 c4 01          	add    $0x1,%r12
+  8016da:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8016e0:	41 ff d7             	call   *%r15
+  8016e3:	29 c3                	sub    %eax,%ebx
+  8016e5:	75 09                	jne    8016f0 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  8016e7:	49 83 c5 01          	add    $0x1,%r13
+  8016eb:	45 84 f6             	test   %r14b,%r14b
+  8016ee:	75 d8                	jne    8016c8 <strcasecmp+0x26>
+}
+  8016f0:	89 d8                	mov    %ebx,%eax
+  8016f2:	48 83 c4 08          	add    $0x8,%rsp
+  8016f6:	5b                   	pop    %rbx
+  8016f7:	41 5c                	pop    %r12
+  8016f9:	41 5d                	pop    %r13
+  8016fb:	41 5e                	pop    %r14
+  8016fd:	41 5f                	pop    %r15
+  8016ff:	5d                   	pop    %rbp
+  801700:	c3                   	ret
+        return 0;
+  801701:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801706:	eb e8                	jmp    8016f0 <strcasecmp+0x4e>
+
+0000000000801708 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  801708:	55                   	push   %rbp
+  801709:	48 89 e5             	mov    %rsp,%rbp
+  80170c:	41 57                	push   %r15
+  80170e:	41 56                	push   %r14
+  801710:	41 55                	push   %r13
+  801712:	41 54                	push   %r12
+  801714:	53                   	push   %rbx
+  801715:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  801719:	48 85 d2             	test   %rdx,%rdx
+  80171c:	74 4f                	je     80176d <strncasecmp+0x65>
+  80171e:	49 89 fc             	mov    %rdi,%r12
+  801721:	49 89 f5             	mov    %rsi,%r13
+  801724:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  801728:	49 be 93 16 80 00 00 	movabs $0x801693,%r14
+  80172f:	00 00 00 
+  801732:	49 83 c4 01          	add    $0x1,%r12
+  801736:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  80173c:	41 ff d6             	call   *%r14
+  80173f:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  801741:	49 83 c5 01          	add    $0x1,%r13
+  801745:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  80174a:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  80174d:	29 c3                	sub    %eax,%ebx
+  80174f:	85 c0                	test   %eax,%eax
+  801751:	74 09                	je     80175c <strncasecmp+0x54>
+  801753:	85 db                	test   %ebx,%ebx
+  801755:	75 05                	jne    80175c <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  801757:	4d 39 fc             	cmp    %r15,%r12
+  80175a:	75 d6                	jne    801732 <strncasecmp+0x2a>
+}
+  80175c:	89 d8                	mov    %ebx,%eax
+  80175e:	48 83 c4 08          	add    $0x8,%rsp
+  801762:	5b                   	pop    %rbx
+  801763:	41 5c                	pop    %r12
+  801765:	41 5d                	pop    %r13
+  801767:	41 5e                	pop    %r14
+  801769:	41 5f                	pop    %r15
+  80176b:	5d                   	pop    %rbp
+  80176c:	c3                   	ret
+    int d = 0;
+  80176d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  801772:	eb e8                	jmp    80175c <strncasecmp+0x54>
+
+0000000000801774 <toupper>:
+
+int toupper(int c) {
+  801774:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  801776:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801779:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80177c:	83 f9 1a             	cmp    $0x1a,%ecx
+  80177f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801782:	c3                   	ret
+
+0000000000801783 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  801783:	83 ff 20             	cmp    $0x20,%edi
+  801786:	0f 94 c0             	sete   %al
+  801789:	0f b6 c0             	movzbl %al,%eax
+}
+  80178c:	c3                   	ret
+
+000000000080178d <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  80178d:	89 f8                	mov    %edi,%eax
+  80178f:	f7 d8                	neg    %eax
+  801791:	0f 48 c7             	cmovs  %edi,%eax
+}
+  801794:	c3                   	ret
+
+0000000000801795 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801795:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801798:	48 89 f8             	mov    %rdi,%rax
+  80179b:	48 f7 d8             	neg    %rax
+  80179e:	83 e0 07             	and    $0x7,%eax
+  8017a1:	49 89 d1             	mov    %rdx,%r9
+  8017a4:	49 29 c1             	sub    %rax,%r9
+  8017a7:	78 36                	js     8017df <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8017a9:	40 0f b6 c6          	movzbl %sil,%eax
+  8017ad:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8017b4:	01 01 01 
+  8017b7:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8017bb:	40 f6 c7 07          	test   $0x7,%dil
+  8017bf:	75 38                	jne    8017f9 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8017c1:	4c 89 c9             	mov    %r9,%rcx
+  8017c4:	48 c1 f9 03          	sar    $0x3,%rcx
+  8017c8:	74 0c                	je     8017d6 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8017ca:	fc                   	cld
+  8017cb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8017ce:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8017d2:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8017d6:	4d 85 c9             	test   %r9,%r9
+  8017d9:	75 45                	jne    801820 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8017db:	4c 89 c0             	mov    %r8,%rax
+  8017de:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8017df:	48 85 d2             	test   %rdx,%rdx
+  8017e2:	74 f7                	je     8017db <memset+0x46>
+  8017e4:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8017e7:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8017ea:	48 83 c0 01          	add    $0x1,%rax
+  8017ee:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8017f2:	48 39 c2             	cmp    %rax,%rdx
+  8017f5:	75 f3                	jne    8017ea <memset+0x55>
+  8017f7:	eb e2                	jmp    8017db <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8017f9:	40 f6 c7 01          	test   $0x1,%dil
+  8017fd:	74 06                	je     801805 <memset+0x70>
+  8017ff:	88 07                	mov    %al,(%rdi)
+  801801:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801805:	40 f6 c7 02          	test   $0x2,%dil
+  801809:	74 07                	je     801812 <memset+0x7d>
+  80180b:	66 89 07             	mov    %ax,(%rdi)
+  80180e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801812:	40 f6 c7 04          	test   $0x4,%dil
+  801816:	74 a9                	je     8017c1 <memset+0x2c>
+  801818:	89 07                	mov    %eax,(%rdi)
+  80181a:	48 83 c7 04          	add    $0x4,%rdi
+  80181e:	eb a1                	jmp    8017c1 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801820:	41 f6 c1 04          	test   $0x4,%r9b
+  801824:	74 06                	je     80182c <memset+0x97>
+  801826:	89 07                	mov    %eax,(%rdi)
+  801828:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80182c:	41 f6 c1 02          	test   $0x2,%r9b
+  801830:	74 07                	je     801839 <memset+0xa4>
+  801832:	66 89 07             	mov    %ax,(%rdi)
+  801835:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801839:	41 f6 c1 01          	test   $0x1,%r9b
+  80183d:	74 9c                	je     8017db <memset+0x46>
+  80183f:	88 07                	mov    %al,(%rdi)
+  801841:	eb 98                	jmp    8017db <memset+0x46>
+
+0000000000801843 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801843:	48 89 f8             	mov    %rdi,%rax
+  801846:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801849:	48 39 fe             	cmp    %rdi,%rsi
+  80184c:	73 3b                	jae    801889 <memmove+0x46>
+  80184e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801852:	48 39 d7             	cmp    %rdx,%rdi
+  801855:	73 32                	jae    801889 <memmove+0x46>
+        s += n;
+        d += n;
+  801857:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80185b:	48 89 d6             	mov    %rdx,%rsi
+  80185e:	48 09 fe             	or     %rdi,%rsi
+  801861:	48 09 ce             	or     %rcx,%rsi
+  801864:	40 f6 c6 07          	test   $0x7,%sil
+  801868:	75 12                	jne    80187c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80186a:	48 83 ef 08          	sub    $0x8,%rdi
+  80186e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801872:	48 c1 e9 03          	shr    $0x3,%rcx
+  801876:	fd                   	std
+  801877:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80187a:	fc                   	cld
+  80187b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80187c:	48 83 ef 01          	sub    $0x1,%rdi
+  801880:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801884:	fd                   	std
+  801885:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801887:	eb f1                	jmp    80187a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801889:	48 89 f2             	mov    %rsi,%rdx
+  80188c:	48 09 c2             	or     %rax,%rdx
+  80188f:	48 09 ca             	or     %rcx,%rdx
+  801892:	f6 c2 07             	test   $0x7,%dl
+  801895:	75 0c                	jne    8018a3 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801897:	48 c1 e9 03          	shr    $0x3,%rcx
+  80189b:	48 89 c7             	mov    %rax,%rdi
+  80189e:	fc                   	cld
+  80189f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018a2:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8018a3:	48 89 c7             	mov    %rax,%rdi
+  8018a6:	fc                   	cld
+  8018a7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8018a9:	c3                   	ret
+
+00000000008018aa <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8018aa:	55                   	push   %rbp
+  8018ab:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8018ae:	48 b8 43 18 80 00 00 	movabs $0x801843,%rax
+  8018b5:	00 00 00 
+  8018b8:	ff d0                	call   *%rax
+}
+  8018ba:	5d                   	pop    %rbp
+  8018bb:	c3                   	ret
+
+00000000008018bc <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8018bc:	55                   	push   %rbp
+  8018bd:	48 89 e5             	mov    %rsp,%rbp
+  8018c0:	41 57                	push   %r15
+  8018c2:	41 56                	push   %r14
+  8018c4:	41 55                	push   %r13
+  8018c6:	41 54                	push   %r12
+  8018c8:	53                   	push   %rbx
+  8018c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8018cd:	49 89 fe             	mov    %rdi,%r14
+  8018d0:	49 89 f7             	mov    %rsi,%r15
+  8018d3:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8018d6:	48 89 f7             	mov    %rsi,%rdi
+  8018d9:	48 b8 77 14 80 00 00 	movabs $0x801477,%rax
+  8018e0:	00 00 00 
+  8018e3:	ff d0                	call   *%rax
+  8018e5:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8018e8:	48 89 de             	mov    %rbx,%rsi
+  8018eb:	4c 89 f7             	mov    %r14,%rdi
+  8018ee:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  8018f5:	00 00 00 
+  8018f8:	ff d0                	call   *%rax
+  8018fa:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8018fd:	48 39 c3             	cmp    %rax,%rbx
+  801900:	74 36                	je     801938 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801902:	48 89 d8             	mov    %rbx,%rax
+  801905:	4c 29 e8             	sub    %r13,%rax
+  801908:	49 39 c4             	cmp    %rax,%r12
+  80190b:	73 31                	jae    80193e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80190d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801912:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801916:	4c 89 fe             	mov    %r15,%rsi
+  801919:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801920:	00 00 00 
+  801923:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801925:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801929:	48 83 c4 08          	add    $0x8,%rsp
+  80192d:	5b                   	pop    %rbx
+  80192e:	41 5c                	pop    %r12
+  801930:	41 5d                	pop    %r13
+  801932:	41 5e                	pop    %r14
+  801934:	41 5f                	pop    %r15
+  801936:	5d                   	pop    %rbp
+  801937:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801938:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80193c:	eb eb                	jmp    801929 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80193e:	48 83 eb 01          	sub    $0x1,%rbx
+  801942:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801946:	48 89 da             	mov    %rbx,%rdx
+  801949:	4c 89 fe             	mov    %r15,%rsi
+  80194c:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801953:	00 00 00 
+  801956:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801958:	49 01 de             	add    %rbx,%r14
+  80195b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801960:	eb c3                	jmp    801925 <strlcat+0x69>
+
+0000000000801962 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801962:	48 85 d2             	test   %rdx,%rdx
+  801965:	74 2d                	je     801994 <memcmp+0x32>
+  801967:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80196c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801970:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801975:	44 38 c1             	cmp    %r8b,%cl
+  801978:	75 0f                	jne    801989 <memcmp+0x27>
+    while (n-- > 0) {
+  80197a:	48 83 c0 01          	add    $0x1,%rax
+  80197e:	48 39 c2             	cmp    %rax,%rdx
+  801981:	75 e9                	jne    80196c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801983:	b8 00 00 00 00       	mov    $0x0,%eax
+  801988:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801989:	0f b6 c1             	movzbl %cl,%eax
+  80198c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801990:	44 29 c0             	sub    %r8d,%eax
+  801993:	c3                   	ret
+    return 0;
+  801994:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801999:	c3                   	ret
+
+000000000080199a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80199a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80199e:	48 39 c7             	cmp    %rax,%rdi
+  8019a1:	73 0f                	jae    8019b2 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8019a3:	40 38 37             	cmp    %sil,(%rdi)
+  8019a6:	74 0e                	je     8019b6 <memfind+0x1c>
+    for (; src < end; src++) {
+  8019a8:	48 83 c7 01          	add    $0x1,%rdi
+  8019ac:	48 39 f8             	cmp    %rdi,%rax
+  8019af:	75 f2                	jne    8019a3 <memfind+0x9>
+  8019b1:	c3                   	ret
+  8019b2:	48 89 f8             	mov    %rdi,%rax
+  8019b5:	c3                   	ret
+  8019b6:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8019b9:	c3                   	ret
+
+00000000008019ba <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8019ba:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8019bd:	0f b6 37             	movzbl (%rdi),%esi
+  8019c0:	40 80 fe 20          	cmp    $0x20,%sil
+  8019c4:	74 06                	je     8019cc <strtol+0x12>
+  8019c6:	40 80 fe 09          	cmp    $0x9,%sil
+  8019ca:	75 13                	jne    8019df <strtol+0x25>
+  8019cc:	48 83 c7 01          	add    $0x1,%rdi
+  8019d0:	0f b6 37             	movzbl (%rdi),%esi
+  8019d3:	40 80 fe 20          	cmp    $0x20,%sil
+  8019d7:	74 f3                	je     8019cc <strtol+0x12>
+  8019d9:	40 80 fe 09          	cmp    $0x9,%sil
+  8019dd:	74 ed                	je     8019cc <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8019df:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8019e2:	83 e0 fd             	and    $0xfffffffd,%eax
+  8019e5:	3c 01                	cmp    $0x1,%al
+  8019e7:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8019eb:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8019f1:	75 0f                	jne    801a02 <strtol+0x48>
+  8019f3:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8019f6:	74 14                	je     801a0c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8019f8:	85 d2                	test   %edx,%edx
+  8019fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8019ff:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801a02:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801a07:	4c 63 ca             	movslq %edx,%r9
+  801a0a:	eb 36                	jmp    801a42 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801a0c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801a10:	74 0f                	je     801a21 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801a12:	85 d2                	test   %edx,%edx
+  801a14:	75 ec                	jne    801a02 <strtol+0x48>
+        s++;
+  801a16:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801a1a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801a1f:	eb e1                	jmp    801a02 <strtol+0x48>
+        s += 2;
+  801a21:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801a25:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801a2a:	eb d6                	jmp    801a02 <strtol+0x48>
+            dig -= '0';
+  801a2c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801a2f:	44 0f b6 c1          	movzbl %cl,%r8d
+  801a33:	41 39 d0             	cmp    %edx,%r8d
+  801a36:	7d 21                	jge    801a59 <strtol+0x9f>
+        val = val * base + dig;
+  801a38:	49 0f af c1          	imul   %r9,%rax
+  801a3c:	0f b6 c9             	movzbl %cl,%ecx
+  801a3f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801a42:	48 83 c7 01          	add    $0x1,%rdi
+  801a46:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801a4a:	80 f9 39             	cmp    $0x39,%cl
+  801a4d:	76 dd                	jbe    801a2c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801a4f:	80 f9 7b             	cmp    $0x7b,%cl
+  801a52:	77 05                	ja     801a59 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801a54:	83 e9 57             	sub    $0x57,%ecx
+  801a57:	eb d6                	jmp    801a2f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801a59:	4d 85 d2             	test   %r10,%r10
+  801a5c:	74 03                	je     801a61 <strtol+0xa7>
+  801a5e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801a61:	48 89 c2             	mov    %rax,%rdx
+  801a64:	48 f7 da             	neg    %rdx
+  801a67:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801a6b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801a6f:	c3                   	ret
+
+0000000000801a70 <atoi>:
+int atoi(const char *str) {
+  801a70:	55                   	push   %rbp
+  801a71:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  801a74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a79:	be 00 00 00 00       	mov    $0x0,%esi
+  801a7e:	48 b8 ba 19 80 00 00 	movabs $0x8019ba,%rax
+  801a85:	00 00 00 
+  801a88:	ff d0                	call   *%rax
+}
+  801a8a:	5d                   	pop    %rbp
+  801a8b:	c3                   	ret
+
+0000000000801a8c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801a8c:	55                   	push   %rbp
+  801a8d:	48 89 e5             	mov    %rsp,%rbp
+  801a90:	53                   	push   %rbx
+  801a91:	48 89 fa             	mov    %rdi,%rdx
+  801a94:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a97:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aa6:	be 00 00 00 00       	mov    $0x0,%esi
+  801aab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ab1:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801ab3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ab7:	c9                   	leave
+  801ab8:	c3                   	ret
+
+0000000000801ab9 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801ab9:	55                   	push   %rbp
+  801aba:	48 89 e5             	mov    %rsp,%rbp
+  801abd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801abe:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ac3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801acd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ad7:	be 00 00 00 00       	mov    $0x0,%esi
+  801adc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ae2:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ae4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ae8:	c9                   	leave
+  801ae9:	c3                   	ret
+
+0000000000801aea <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801aea:	55                   	push   %rbp
+  801aeb:	48 89 e5             	mov    %rsp,%rbp
+  801aee:	53                   	push   %rbx
+  801aef:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801af3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801af6:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801afb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b05:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b0a:	be 00 00 00 00       	mov    $0x0,%esi
+  801b0f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b15:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b17:	48 85 c0             	test   %rax,%rax
+  801b1a:	7f 06                	jg     801b22 <sys_env_destroy+0x38>
+}
+  801b1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b20:	c9                   	leave
+  801b21:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b22:	49 89 c0             	mov    %rax,%r8
+  801b25:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801b2a:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  801b31:	00 00 00 
+  801b34:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801b39:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  801b40:	00 00 00 
+  801b43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b48:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  801b4f:	00 00 00 
+  801b52:	41 ff d1             	call   *%r9
+
+0000000000801b55 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801b55:	55                   	push   %rbp
+  801b56:	48 89 e5             	mov    %rsp,%rbp
+  801b59:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b5a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b64:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b6e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b73:	be 00 00 00 00       	mov    $0x0,%esi
+  801b78:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b7e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b84:	c9                   	leave
+  801b85:	c3                   	ret
+
+0000000000801b86 <sys_yield>:
+
+void
+sys_yield(void) {
+  801b86:	55                   	push   %rbp
+  801b87:	48 89 e5             	mov    %rsp,%rbp
+  801b8a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b8b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b90:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b95:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b9f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ba4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801baf:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801bb1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bb5:	c9                   	leave
+  801bb6:	c3                   	ret
+
+0000000000801bb7 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801bb7:	55                   	push   %rbp
+  801bb8:	48 89 e5             	mov    %rsp,%rbp
+  801bbb:	53                   	push   %rbx
+  801bbc:	48 89 fa             	mov    %rdi,%rdx
+  801bbf:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801bc2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bc7:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801bce:	00 00 00 
+  801bd1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bd6:	be 00 00 00 00       	mov    $0x0,%esi
+  801bdb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801be1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801be3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801be7:	c9                   	leave
+  801be8:	c3                   	ret
+
+0000000000801be9 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801be9:	55                   	push   %rbp
+  801bea:	48 89 e5             	mov    %rsp,%rbp
+  801bed:	53                   	push   %rbx
+  801bee:	49 89 f8             	mov    %rdi,%r8
+  801bf1:	48 89 d3             	mov    %rdx,%rbx
+  801bf4:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801bf7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bfc:	4c 89 c2             	mov    %r8,%rdx
+  801bff:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c02:	be 00 00 00 00       	mov    $0x0,%esi
+  801c07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c0d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801c0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c13:	c9                   	leave
+  801c14:	c3                   	ret
+
+0000000000801c15 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801c15:	55                   	push   %rbp
+  801c16:	48 89 e5             	mov    %rsp,%rbp
+  801c19:	53                   	push   %rbx
+  801c1a:	48 83 ec 08          	sub    $0x8,%rsp
+  801c1e:	89 f8                	mov    %edi,%eax
+  801c20:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801c23:	48 63 f9             	movslq %ecx,%rdi
+  801c26:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c29:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c2e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c31:	be 00 00 00 00       	mov    $0x0,%esi
+  801c36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c3c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c3e:	48 85 c0             	test   %rax,%rax
+  801c41:	7f 06                	jg     801c49 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801c43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c47:	c9                   	leave
+  801c48:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c49:	49 89 c0             	mov    %rax,%r8
+  801c4c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801c51:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  801c58:	00 00 00 
+  801c5b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801c60:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  801c67:	00 00 00 
+  801c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6f:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  801c76:	00 00 00 
+  801c79:	41 ff d1             	call   *%r9
+
+0000000000801c7c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801c7c:	55                   	push   %rbp
+  801c7d:	48 89 e5             	mov    %rsp,%rbp
+  801c80:	53                   	push   %rbx
+  801c81:	48 83 ec 08          	sub    $0x8,%rsp
+  801c85:	89 f8                	mov    %edi,%eax
+  801c87:	49 89 f2             	mov    %rsi,%r10
+  801c8a:	48 89 cf             	mov    %rcx,%rdi
+  801c8d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801c90:	48 63 da             	movslq %edx,%rbx
+  801c93:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c96:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c9b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c9e:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801ca1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ca3:	48 85 c0             	test   %rax,%rax
+  801ca6:	7f 06                	jg     801cae <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801ca8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cac:	c9                   	leave
+  801cad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801cae:	49 89 c0             	mov    %rax,%r8
+  801cb1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801cb6:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  801cbd:	00 00 00 
+  801cc0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801cc5:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  801ccc:	00 00 00 
+  801ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd4:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  801cdb:	00 00 00 
+  801cde:	41 ff d1             	call   *%r9
+
+0000000000801ce1 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801ce1:	55                   	push   %rbp
+  801ce2:	48 89 e5             	mov    %rsp,%rbp
+  801ce5:	53                   	push   %rbx
+  801ce6:	48 83 ec 08          	sub    $0x8,%rsp
+  801cea:	49 89 f9             	mov    %rdi,%r9
+  801ced:	89 f0                	mov    %esi,%eax
+  801cef:	48 89 d3             	mov    %rdx,%rbx
+  801cf2:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801cf5:	49 63 f0             	movslq %r8d,%rsi
+  801cf8:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801cfb:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d00:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d03:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d09:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d0b:	48 85 c0             	test   %rax,%rax
+  801d0e:	7f 06                	jg     801d16 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801d10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d14:	c9                   	leave
+  801d15:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d16:	49 89 c0             	mov    %rax,%r8
+  801d19:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d1e:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  801d25:	00 00 00 
+  801d28:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801d2d:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  801d34:	00 00 00 
+  801d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3c:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  801d43:	00 00 00 
+  801d46:	41 ff d1             	call   *%r9
+
+0000000000801d49 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801d49:	55                   	push   %rbp
+  801d4a:	48 89 e5             	mov    %rsp,%rbp
+  801d4d:	53                   	push   %rbx
+  801d4e:	89 f8                	mov    %edi,%eax
+  801d50:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801d53:	48 63 f9             	movslq %ecx,%rdi
+  801d56:	48 63 da             	movslq %edx,%rbx
+  801d59:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d5c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d61:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d64:	be 00 00 00 00       	mov    $0x0,%esi
+  801d69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d6f:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  801d71:	89 c2                	mov    %eax,%edx
+  801d73:	48 85 c0             	test   %rax,%rax
+  801d76:	78 0d                	js     801d85 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801d78:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801d7d:	4d 85 c9             	test   %r9,%r9
+  801d80:	74 03                	je     801d85 <sys_alloc_dma_region+0x3c>
+  801d82:	49 89 01             	mov    %rax,(%r9)
+}
+  801d85:	89 d0                	mov    %edx,%eax
+  801d87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d8b:	c9                   	leave
+  801d8c:	c3                   	ret
+
+0000000000801d8d <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801d8d:	55                   	push   %rbp
+  801d8e:	48 89 e5             	mov    %rsp,%rbp
+  801d91:	53                   	push   %rbx
+  801d92:	48 83 ec 08          	sub    $0x8,%rsp
+  801d96:	48 89 f1             	mov    %rsi,%rcx
+  801d99:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801d9c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d9f:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801da4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801da9:	be 00 00 00 00       	mov    $0x0,%esi
+  801dae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801db4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801db6:	48 85 c0             	test   %rax,%rax
+  801db9:	7f 06                	jg     801dc1 <sys_set_cache_region+0x34>
+}
+  801dbb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dbf:	c9                   	leave
+  801dc0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801dc1:	49 89 c0             	mov    %rax,%r8
+  801dc4:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801dc9:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  801dd0:	00 00 00 
+  801dd3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801dd8:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  801ddf:	00 00 00 
+  801de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de7:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  801dee:	00 00 00 
+  801df1:	41 ff d1             	call   *%r9
+
+0000000000801df4 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801df4:	55                   	push   %rbp
+  801df5:	48 89 e5             	mov    %rsp,%rbp
+  801df8:	53                   	push   %rbx
+  801df9:	48 83 ec 08          	sub    $0x8,%rsp
+  801dfd:	48 89 f1             	mov    %rsi,%rcx
+  801e00:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801e03:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e06:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e10:	be 00 00 00 00       	mov    $0x0,%esi
+  801e15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e1b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e1d:	48 85 c0             	test   %rax,%rax
+  801e20:	7f 06                	jg     801e28 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801e22:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e26:	c9                   	leave
+  801e27:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e28:	49 89 c0             	mov    %rax,%r8
+  801e2b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801e30:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  801e37:	00 00 00 
+  801e3a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801e3f:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  801e46:	00 00 00 
+  801e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4e:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  801e55:	00 00 00 
+  801e58:	41 ff d1             	call   *%r9
+
+0000000000801e5b <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801e5b:	55                   	push   %rbp
+  801e5c:	48 89 e5             	mov    %rsp,%rbp
+  801e5f:	53                   	push   %rbx
+  801e60:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801e64:	48 63 ce             	movslq %esi,%rcx
+  801e67:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e6a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e74:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e79:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e84:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e86:	48 85 c0             	test   %rax,%rax
+  801e89:	7f 06                	jg     801e91 <sys_env_set_status+0x36>
+}
+  801e8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e8f:	c9                   	leave
+  801e90:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e91:	49 89 c0             	mov    %rax,%r8
+  801e94:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801e99:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  801ea0:	00 00 00 
+  801ea3:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801ea8:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  801eaf:	00 00 00 
+  801eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb7:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  801ebe:	00 00 00 
+  801ec1:	41 ff d1             	call   *%r9
+
+0000000000801ec4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801ec4:	55                   	push   %rbp
+  801ec5:	48 89 e5             	mov    %rsp,%rbp
+  801ec8:	53                   	push   %rbx
+  801ec9:	48 83 ec 08          	sub    $0x8,%rsp
+  801ecd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801ed0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ed3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ed8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801edd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ee2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801eed:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801eef:	48 85 c0             	test   %rax,%rax
+  801ef2:	7f 06                	jg     801efa <sys_env_set_trapframe+0x36>
+}
+  801ef4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef8:	c9                   	leave
+  801ef9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801efa:	49 89 c0             	mov    %rax,%r8
+  801efd:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801f02:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  801f09:	00 00 00 
+  801f0c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801f11:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  801f18:	00 00 00 
+  801f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f20:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  801f27:	00 00 00 
+  801f2a:	41 ff d1             	call   *%r9
+
+0000000000801f2d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801f2d:	55                   	push   %rbp
+  801f2e:	48 89 e5             	mov    %rsp,%rbp
+  801f31:	53                   	push   %rbx
+  801f32:	48 83 ec 08          	sub    $0x8,%rsp
+  801f36:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801f39:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f3c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f46:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f4b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f50:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f56:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f58:	48 85 c0             	test   %rax,%rax
+  801f5b:	7f 06                	jg     801f63 <sys_env_set_pgfault_upcall+0x36>
+}
+  801f5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f61:	c9                   	leave
+  801f62:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f63:	49 89 c0             	mov    %rax,%r8
+  801f66:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801f6b:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  801f72:	00 00 00 
+  801f75:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801f7a:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  801f81:	00 00 00 
+  801f84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f89:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  801f90:	00 00 00 
+  801f93:	41 ff d1             	call   *%r9
+
+0000000000801f96 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801f96:	55                   	push   %rbp
+  801f97:	48 89 e5             	mov    %rsp,%rbp
+  801f9a:	53                   	push   %rbx
+  801f9b:	89 f8                	mov    %edi,%eax
+  801f9d:	49 89 f1             	mov    %rsi,%r9
+  801fa0:	48 89 d3             	mov    %rdx,%rbx
+  801fa3:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801fa6:	49 63 f0             	movslq %r8d,%rsi
+  801fa9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fac:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801fb1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fb4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801fba:	cd 30                	int    $0x30
+}
+  801fbc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fc0:	c9                   	leave
+  801fc1:	c3                   	ret
+
+0000000000801fc2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801fc2:	55                   	push   %rbp
+  801fc3:	48 89 e5             	mov    %rsp,%rbp
+  801fc6:	53                   	push   %rbx
+  801fc7:	48 83 ec 08          	sub    $0x8,%rsp
+  801fcb:	48 89 fa             	mov    %rdi,%rdx
+  801fce:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801fd1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fdb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801fe0:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801feb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801fed:	48 85 c0             	test   %rax,%rax
+  801ff0:	7f 06                	jg     801ff8 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801ff2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ff6:	c9                   	leave
+  801ff7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ff8:	49 89 c0             	mov    %rax,%r8
+  801ffb:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802000:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  802007:	00 00 00 
+  80200a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80200f:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  802016:	00 00 00 
+  802019:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201e:	49 b9 ed 09 80 00 00 	movabs $0x8009ed,%r9
+  802025:	00 00 00 
+  802028:	41 ff d1             	call   *%r9
+
+000000000080202b <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  80202b:	55                   	push   %rbp
+  80202c:	48 89 e5             	mov    %rsp,%rbp
+  80202f:	53                   	push   %rbx
+  802030:	48 89 fa             	mov    %rdi,%rdx
+  802033:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802036:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80203b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802040:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802045:	be 00 00 00 00       	mov    $0x0,%esi
+  80204a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802050:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802052:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802056:	c9                   	leave
+  802057:	c3                   	ret
+
+0000000000802058 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802058:	55                   	push   %rbp
+  802059:	48 89 e5             	mov    %rsp,%rbp
+  80205c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80205d:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802062:	ba 00 00 00 00       	mov    $0x0,%edx
+  802067:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80206c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802071:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802076:	be 00 00 00 00       	mov    $0x0,%esi
+  80207b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802081:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  802083:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802087:	c9                   	leave
+  802088:	c3                   	ret
+
+0000000000802089 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  802089:	48 85 ff             	test   %rdi,%rdi
+  80208c:	0f 84 b6 01 00 00    	je     802248 <malloc+0x1bf>
+malloc(size_t size) {
+  802092:	55                   	push   %rbp
+  802093:	48 89 e5             	mov    %rsp,%rbp
+  802096:	41 56                	push   %r14
+  802098:	41 55                	push   %r13
+  80209a:	41 54                	push   %r12
+  80209c:	53                   	push   %rbx
+  80209d:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  8020a0:	48 b8 68 77 80 00 00 	movabs $0x807768,%rax
+  8020a7:	00 00 00 
+  8020aa:	4c 8b 20             	mov    (%rax),%r12
+  8020ad:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  8020b4:	0f 87 94 01 00 00    	ja     80224e <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  8020ba:	48 a1 60 77 80 00 00 	movabs 0x807760,%rax
+  8020c1:	00 00 00 
+  8020c4:	48 85 c0             	test   %rax,%rax
+  8020c7:	74 6b                	je     802134 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  8020c9:	4d 85 e4             	test   %r12,%r12
+  8020cc:	74 66                	je     802134 <malloc+0xab>
+  8020ce:	48 ba 88 77 80 00 00 	movabs $0x807788,%rdx
+  8020d5:	00 00 00 
+  8020d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020dd:	eb 0d                	jmp    8020ec <malloc+0x63>
+  8020df:	48 83 c1 01          	add    $0x1,%rcx
+  8020e3:	48 83 c2 18          	add    $0x18,%rdx
+  8020e7:	49 39 cc             	cmp    %rcx,%r12
+  8020ea:	74 48                	je     802134 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  8020ec:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  8020f1:	74 ec                	je     8020df <malloc+0x56>
+  8020f3:	48 39 1a             	cmp    %rbx,(%rdx)
+  8020f6:	72 e7                	jb     8020df <malloc+0x56>
+                real_freep_size--;
+  8020f8:	48 83 e8 01          	sub    $0x1,%rax
+  8020fc:	48 a3 60 77 80 00 00 	movabs %rax,0x807760
+  802103:	00 00 00 
+                freep[i].is_free = false;
+  802106:	48 ba 80 77 80 00 00 	movabs $0x807780,%rdx
+  80210d:	00 00 00 
+  802110:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  802114:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  802118:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  80211c:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  802123:	00 
+                freep[i].size = size;
+  802124:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  802128:	48 01 c8             	add    %rcx,%rax
+  80212b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80212f:	e9 0b 01 00 00       	jmp    80223f <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  802134:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  80213b:	00 00 00 
+  80213e:	48 01 d8             	add    %rbx,%rax
+  802141:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  802147:	76 7c                	jbe    8021c5 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  802149:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  802150:	00 00 00 
+  802153:	4c 8b 30             	mov    (%rax),%r14
+  802156:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  80215d:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  802160:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  802167:	00 00 00 
+  80216a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  802171:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  802178:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80217e:	4c 0f 45 eb          	cmovne %rbx,%r13
+  802182:	48 b8 55 1b 80 00 00 	movabs $0x801b55,%rax
+  802189:	00 00 00 
+  80218c:	ff d0                	call   *%rax
+  80218e:	89 c7                	mov    %eax,%edi
+  802190:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  802197:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80219e:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  8021a5:	00 00 00 
+  8021a8:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  8021ac:	b9 26 00 00 00       	mov    $0x26,%ecx
+  8021b1:	48 b8 15 1c 80 00 00 	movabs $0x801c15,%rax
+  8021b8:	00 00 00 
+  8021bb:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  8021bd:	85 c0                	test   %eax,%eax
+  8021bf:	0f 88 90 00 00 00    	js     802255 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  8021c5:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  8021cc:	00 00 00 
+  8021cf:	48 8b 31             	mov    (%rcx),%rsi
+  8021d2:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  8021d9:	00 00 00 
+  8021dc:	4c 8b 07             	mov    (%rdi),%r8
+  8021df:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  8021e3:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  8021ea:	00 00 00 
+  8021ed:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  8021f1:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  8021f5:	48 b8 80 77 80 00 00 	movabs $0x807780,%rax
+  8021fc:	00 00 00 
+  8021ff:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  802203:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  802206:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  80220a:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802211:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  802212:	48 89 d8             	mov    %rbx,%rax
+  802215:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80221a:	4c 01 c0             	add    %r8,%rax
+  80221d:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  802220:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  802227:	48 01 f3             	add    %rsi,%rbx
+  80222a:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  80222d:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  802232:	48 a3 68 77 80 00 00 	movabs %rax,0x807768
+  802239:	00 00 00 
+  80223c:	48 89 d0             	mov    %rdx,%rax
+}
+  80223f:	5b                   	pop    %rbx
+  802240:	41 5c                	pop    %r12
+  802242:	41 5d                	pop    %r13
+  802244:	41 5e                	pop    %r14
+  802246:	5d                   	pop    %rbp
+  802247:	c3                   	ret
+        return NULL;
+  802248:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80224d:	c3                   	ret
+        return NULL;
+  80224e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802253:	eb ea                	jmp    80223f <malloc+0x1b6>
+            return NULL;
+  802255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225a:	eb e3                	jmp    80223f <malloc+0x1b6>
+
+000000000080225c <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  80225c:	55                   	push   %rbp
+  80225d:	48 89 e5             	mov    %rsp,%rbp
+  802260:	53                   	push   %rbx
+  802261:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  802265:	48 89 fb             	mov    %rdi,%rbx
+  802268:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  80226c:	48 89 df             	mov    %rbx,%rdi
+  80226f:	48 b8 89 20 80 00 00 	movabs $0x802089,%rax
+  802276:	00 00 00 
+  802279:	ff d0                	call   *%rax
+  80227b:	48 89 c7             	mov    %rax,%rdi
+  80227e:	48 89 da             	mov    %rbx,%rdx
+  802281:	be 00 00 00 00       	mov    $0x0,%esi
+  802286:	48 b8 95 17 80 00 00 	movabs $0x801795,%rax
+  80228d:	00 00 00 
+  802290:	ff d0                	call   *%rax
+}
+  802292:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802296:	c9                   	leave
+  802297:	c3                   	ret
+
+0000000000802298 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  802298:	48 a1 68 77 80 00 00 	movabs 0x807768,%rax
+  80229f:	00 00 00 
+  8022a2:	48 ba 60 77 80 00 00 	movabs $0x807760,%rdx
+  8022a9:	00 00 00 
+  8022ac:	48 3b 02             	cmp    (%rdx),%rax
+  8022af:	74 4d                	je     8022fe <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  8022b1:	48 85 c0             	test   %rax,%rax
+  8022b4:	74 4d                	je     802303 <get_allocsize+0x6b>
+  8022b6:	48 b9 80 77 80 00 00 	movabs $0x807780,%rcx
+  8022bd:	00 00 00 
+  8022c0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  8022c5:	48 3b 39             	cmp    (%rcx),%rdi
+  8022c8:	74 13                	je     8022dd <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  8022ca:	48 83 c2 01          	add    $0x1,%rdx
+  8022ce:	48 83 c1 18          	add    $0x18,%rcx
+  8022d2:	48 39 d0             	cmp    %rdx,%rax
+  8022d5:	75 ee                	jne    8022c5 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  8022d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022dc:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  8022dd:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  8022e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e6:	48 be 80 77 80 00 00 	movabs $0x807780,%rsi
+  8022ed:	00 00 00 
+  8022f0:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  8022f6:	75 0b                	jne    802303 <get_allocsize+0x6b>
+  8022f8:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  8022fd:	c3                   	ret
+        return 0;
+  8022fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802303:	c3                   	ret
+
+0000000000802304 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  802304:	48 85 ff             	test   %rdi,%rdi
+  802307:	0f 84 01 01 00 00    	je     80240e <free+0x10a>
+free(void *ptr) {
+  80230d:	55                   	push   %rbp
+  80230e:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  802311:	48 b8 68 77 80 00 00 	movabs $0x807768,%rax
+  802318:	00 00 00 
+  80231b:	48 8b 30             	mov    (%rax),%rsi
+  80231e:	48 a1 60 77 80 00 00 	movabs 0x807760,%rax
+  802325:	00 00 00 
+  802328:	48 39 c6             	cmp    %rax,%rsi
+  80232b:	74 50                	je     80237d <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  80232d:	48 85 f6             	test   %rsi,%rsi
+  802330:	74 21                	je     802353 <free+0x4f>
+  802332:	48 b9 80 77 80 00 00 	movabs $0x807780,%rcx
+  802339:	00 00 00 
+  80233c:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  802341:	48 3b 39             	cmp    (%rcx),%rdi
+  802344:	74 61                	je     8023a7 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  802346:	48 83 c2 01          	add    $0x1,%rdx
+  80234a:	48 83 c1 18          	add    $0x18,%rcx
+  80234e:	48 39 d6             	cmp    %rdx,%rsi
+  802351:	75 ee                	jne    802341 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  802353:	48 ba b0 57 80 00 00 	movabs $0x8057b0,%rdx
+  80235a:	00 00 00 
+  80235d:	be 12 01 00 00       	mov    $0x112,%esi
+  802362:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  802369:	00 00 00 
+  80236c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802371:	48 b9 ed 09 80 00 00 	movabs $0x8009ed,%rcx
+  802378:	00 00 00 
+  80237b:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  80237d:	48 ba 60 57 80 00 00 	movabs $0x805760,%rdx
+  802384:	00 00 00 
+  802387:	be 06 01 00 00       	mov    $0x106,%esi
+  80238c:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  802393:	00 00 00 
+  802396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239b:	48 b9 ed 09 80 00 00 	movabs $0x8009ed,%rcx
+  8023a2:	00 00 00 
+  8023a5:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  8023a7:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  8023ab:	48 be 80 77 80 00 00 	movabs $0x807780,%rsi
+  8023b2:	00 00 00 
+  8023b5:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  8023bb:	75 27                	jne    8023e4 <free+0xe0>
+            freep[i].is_free = true;
+  8023bd:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  8023c1:	48 ba 80 77 80 00 00 	movabs $0x807780,%rdx
+  8023c8:	00 00 00 
+  8023cb:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  8023d2:	00 00 
+            real_freep_size++;
+  8023d4:	48 83 c0 01          	add    $0x1,%rax
+  8023d8:	48 a3 60 77 80 00 00 	movabs %rax,0x807760
+  8023df:	00 00 00 
+}
+  8023e2:	5d                   	pop    %rbp
+  8023e3:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  8023e4:	48 ba 88 57 80 00 00 	movabs $0x805788,%rdx
+  8023eb:	00 00 00 
+  8023ee:	be 0b 01 00 00       	mov    $0x10b,%esi
+  8023f3:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  8023fa:	00 00 00 
+  8023fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802402:	48 b9 ed 09 80 00 00 	movabs $0x8009ed,%rcx
+  802409:	00 00 00 
+  80240c:	ff d1                	call   *%rcx
+  80240e:	c3                   	ret
+
+000000000080240f <realloc>:
+realloc(void *ptr, size_t newsize) {
+  80240f:	55                   	push   %rbp
+  802410:	48 89 e5             	mov    %rsp,%rbp
+  802413:	41 55                	push   %r13
+  802415:	41 54                	push   %r12
+  802417:	53                   	push   %rbx
+  802418:	48 83 ec 08          	sub    $0x8,%rsp
+  80241c:	48 89 fb             	mov    %rdi,%rbx
+  80241f:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  802422:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  802429:	00 00 00 
+  80242c:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  80242e:	49 39 c5             	cmp    %rax,%r13
+  802431:	73 0e                	jae    802441 <realloc+0x32>
+}
+  802433:	48 89 d8             	mov    %rbx,%rax
+  802436:	48 83 c4 08          	add    $0x8,%rsp
+  80243a:	5b                   	pop    %rbx
+  80243b:	41 5c                	pop    %r12
+  80243d:	41 5d                	pop    %r13
+  80243f:	5d                   	pop    %rbp
+  802440:	c3                   	ret
+  802441:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  802444:	4c 89 ef             	mov    %r13,%rdi
+  802447:	48 b8 89 20 80 00 00 	movabs $0x802089,%rax
+  80244e:	00 00 00 
+  802451:	ff d0                	call   *%rax
+  802453:	48 89 c7             	mov    %rax,%rdi
+  802456:	4c 89 e2             	mov    %r12,%rdx
+  802459:	48 89 de             	mov    %rbx,%rsi
+  80245c:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  802463:	00 00 00 
+  802466:	ff d0                	call   *%rax
+  802468:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  80246b:	48 89 df             	mov    %rbx,%rdi
+  80246e:	48 b8 04 23 80 00 00 	movabs $0x802304,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+    return newptr;
+  80247a:	4c 89 e3             	mov    %r12,%rbx
+  80247d:	eb b4                	jmp    802433 <realloc+0x24>
+
+000000000080247f <strdup>:
+
+char*
+strdup (const char *src) {
+  80247f:	55                   	push   %rbp
+  802480:	48 89 e5             	mov    %rsp,%rbp
+  802483:	41 54                	push   %r12
+  802485:	53                   	push   %rbx
+  802486:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  802489:	48 b8 77 14 80 00 00 	movabs $0x801477,%rax
+  802490:	00 00 00 
+  802493:	ff d0                	call   *%rax
+  802495:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  802499:	4c 89 e7             	mov    %r12,%rdi
+  80249c:	48 b8 89 20 80 00 00 	movabs $0x802089,%rax
+  8024a3:	00 00 00 
+  8024a6:	ff d0                	call   *%rax
+  8024a8:	48 89 c7             	mov    %rax,%rdi
+  8024ab:	4c 89 e2             	mov    %r12,%rdx
+  8024ae:	48 89 de             	mov    %rbx,%rsi
+  8024b1:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  8024b8:	00 00 00 
+  8024bb:	ff d0                	call   *%rax
+}
+  8024bd:	5b                   	pop    %rbx
+  8024be:	41 5c                	pop    %r12
+  8024c0:	5d                   	pop    %rbp
+  8024c1:	c3                   	ret
+
+00000000008024c2 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  8024c2:	55                   	push   %rbp
+  8024c3:	48 89 e5             	mov    %rsp,%rbp
+  8024c6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8024c7:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8024cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8024d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8024e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8024eb:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  8024ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8024f1:	c9                   	leave
+  8024f2:	c3                   	ret
+
+00000000008024f3 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  8024f3:	55                   	push   %rbp
+  8024f4:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  8024f7:	48 b8 80 77 98 00 00 	movabs $0x987780,%rax
+  8024fe:	00 00 00 
+  802501:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802505:	74 26                	je     80252d <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  802507:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802509:	48 c1 e2 20          	shl    $0x20,%rdx
+  80250d:	89 c0                	mov    %eax,%eax
+  80250f:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  802512:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  802519:	48 b9 80 77 98 00 00 	movabs $0x987780,%rcx
+  802520:	00 00 00 
+  802523:	ba 00 00 00 00       	mov    $0x0,%edx
+  802528:	48 f7 31             	divq   (%rcx)
+}
+  80252b:	5d                   	pop    %rbp
+  80252c:	c3                   	ret
+        freq = get_cpufreq();
+  80252d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802532:	48 ba c2 24 80 00 00 	movabs $0x8024c2,%rdx
+  802539:	00 00 00 
+  80253c:	ff d2                	call   *%rdx
+  80253e:	48 a3 80 77 98 00 00 	movabs %rax,0x987780
+  802545:	00 00 00 
+  802548:	eb bd                	jmp    802507 <get_ticks+0x14>
+
+000000000080254a <sleep>:
+
+void
+sleep(uint64_t ms) {
+  80254a:	55                   	push   %rbp
+  80254b:	48 89 e5             	mov    %rsp,%rbp
+  80254e:	53                   	push   %rbx
+  80254f:	48 83 ec 08          	sub    $0x8,%rsp
+  802553:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  802556:	48 b8 80 77 98 00 00 	movabs $0x987780,%rax
+  80255d:	00 00 00 
+  802560:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802564:	74 50                	je     8025b6 <sleep+0x6c>
+    asm volatile("rdtsc"
+  802566:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802568:	48 c1 e2 20          	shl    $0x20,%rdx
+  80256c:	89 c0                	mov    %eax,%eax
+  80256e:	48 89 d6             	mov    %rdx,%rsi
+  802571:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  802574:	48 b8 80 77 98 00 00 	movabs $0x987780,%rax
+  80257b:	00 00 00 
+  80257e:	48 0f af 18          	imul   (%rax),%rbx
+  802582:	48 c1 eb 03          	shr    $0x3,%rbx
+  802586:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  80258d:	9b c4 20 
+  802590:	48 89 d8             	mov    %rbx,%rax
+  802593:	48 f7 e2             	mul    %rdx
+  802596:	48 89 d1             	mov    %rdx,%rcx
+  802599:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  80259d:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80259f:	48 c1 e2 20          	shl    $0x20,%rdx
+  8025a3:	89 c0                	mov    %eax,%eax
+  8025a5:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  8025a8:	48 29 f2             	sub    %rsi,%rdx
+  8025ab:	48 39 ca             	cmp    %rcx,%rdx
+  8025ae:	72 ed                	jb     80259d <sleep+0x53>
+}
+  8025b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025b4:	c9                   	leave
+  8025b5:	c3                   	ret
+        freq = get_cpufreq();
+  8025b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025bb:	48 ba c2 24 80 00 00 	movabs $0x8024c2,%rdx
+  8025c2:	00 00 00 
+  8025c5:	ff d2                	call   *%rdx
+  8025c7:	48 a3 80 77 98 00 00 	movabs %rax,0x987780
+  8025ce:	00 00 00 
+  8025d1:	eb 93                	jmp    802566 <sleep+0x1c>
+
+00000000008025d3 <poll_kbd>:
+
+int poll_kbd() {
+  8025d3:	55                   	push   %rbp
+  8025d4:	48 89 e5             	mov    %rsp,%rbp
+  8025d7:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8025d8:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8025f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8025fc:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802602:	c9                   	leave
+  802603:	c3                   	ret
+
+0000000000802604 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  802604:	55                   	push   %rbp
+  802605:	48 89 e5             	mov    %rsp,%rbp
+  802608:	53                   	push   %rbx
+  802609:	49 89 fa             	mov    %rdi,%r10
+  80260c:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  80260e:	44 89 c6             	mov    %r8d,%esi
+  802611:	89 cf                	mov    %ecx,%edi
+  802613:	89 d3                	mov    %edx,%ebx
+  802615:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  802617:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80261c:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80261f:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  802623:	cd 30                	int    $0x30
+  802625:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802629:	c9                   	leave
+  80262a:	c3                   	ret
+
+000000000080262b <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80262b:	55                   	push   %rbp
+  80262c:	48 89 e5             	mov    %rsp,%rbp
+  80262f:	41 54                	push   %r12
+  802631:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  802632:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80263e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802643:	cd 30                	int    $0x30
+  802645:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  802648:	85 c0                	test   %eax,%eax
+  80264a:	78 76                	js     8026c2 <fork+0x97>
+        return envid;
+    if (!envid) {
+  80264c:	74 7c                	je     8026ca <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  80264e:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802654:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80265b:	00 00 00 
+  80265e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802663:	89 c2                	mov    %eax,%edx
+  802665:	be 00 00 00 00       	mov    $0x0,%esi
+  80266a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266f:	48 b8 7c 1c 80 00 00 	movabs $0x801c7c,%rax
+  802676:	00 00 00 
+  802679:	ff d0                	call   *%rax
+  80267b:	85 c0                	test   %eax,%eax
+  80267d:	75 7c                	jne    8026fb <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  80267f:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  802686:	00 00 00 
+  802689:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  802690:	44 89 e7             	mov    %r12d,%edi
+  802693:	48 b8 2d 1f 80 00 00 	movabs $0x801f2d,%rax
+  80269a:	00 00 00 
+  80269d:	ff d0                	call   *%rax
+  80269f:	85 c0                	test   %eax,%eax
+  8026a1:	75 60                	jne    802703 <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  8026a3:	be 02 00 00 00       	mov    $0x2,%esi
+  8026a8:	44 89 e7             	mov    %r12d,%edi
+  8026ab:	48 b8 5b 1e 80 00 00 	movabs $0x801e5b,%rax
+  8026b2:	00 00 00 
+  8026b5:	ff d0                	call   *%rax
+        return -1;
+  8026b7:	85 c0                	test   %eax,%eax
+  8026b9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8026be:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  8026c2:	44 89 e0             	mov    %r12d,%eax
+  8026c5:	5b                   	pop    %rbx
+  8026c6:	41 5c                	pop    %r12
+  8026c8:	5d                   	pop    %rbp
+  8026c9:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8026ca:	48 b8 55 1b 80 00 00 	movabs $0x801b55,%rax
+  8026d1:	00 00 00 
+  8026d4:	ff d0                	call   *%rax
+  8026d6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8026db:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8026e2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8026e9:	00 00 00 
+  8026ec:	48 01 d0             	add    %rdx,%rax
+  8026ef:	48 a3 48 77 80 00 00 	movabs %rax,0x807748
+  8026f6:	00 00 00 
+        return 0;
+  8026f9:	eb c7                	jmp    8026c2 <fork+0x97>
+        return -1;
+  8026fb:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802701:	eb bf                	jmp    8026c2 <fork+0x97>
+  802703:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802709:	eb b7                	jmp    8026c2 <fork+0x97>
+
+000000000080270b <sfork>:
+
+envid_t
+sfork() {
+  80270b:	55                   	push   %rbp
+  80270c:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80270f:	48 ba e6 57 80 00 00 	movabs $0x8057e6,%rdx
+  802716:	00 00 00 
+  802719:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80271e:	48 bf 01 58 80 00 00 	movabs $0x805801,%rdi
+  802725:	00 00 00 
+  802728:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272d:	48 b9 ed 09 80 00 00 	movabs $0x8009ed,%rcx
+  802734:	00 00 00 
+  802737:	ff d1                	call   *%rcx
+
+0000000000802739 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802739:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802740:	ff ff ff 
+  802743:	48 01 f8             	add    %rdi,%rax
+  802746:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80274a:	c3                   	ret
+
+000000000080274b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80274b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802752:	ff ff ff 
+  802755:	48 01 f8             	add    %rdi,%rax
+  802758:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80275c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802762:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802766:	c3                   	ret
+
+0000000000802767 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802767:	55                   	push   %rbp
+  802768:	48 89 e5             	mov    %rsp,%rbp
+  80276b:	41 57                	push   %r15
+  80276d:	41 56                	push   %r14
+  80276f:	41 55                	push   %r13
+  802771:	41 54                	push   %r12
+  802773:	53                   	push   %rbx
+  802774:	48 83 ec 08          	sub    $0x8,%rsp
+  802778:	49 89 ff             	mov    %rdi,%r15
+  80277b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802780:	49 bd d4 46 80 00 00 	movabs $0x8046d4,%r13
+  802787:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80278a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802790:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802793:	48 89 df             	mov    %rbx,%rdi
+  802796:	41 ff d5             	call   *%r13
+  802799:	83 e0 04             	and    $0x4,%eax
+  80279c:	74 17                	je     8027b5 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80279e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8027a5:	4c 39 f3             	cmp    %r14,%rbx
+  8027a8:	75 e6                	jne    802790 <fd_alloc+0x29>
+  8027aa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8027b0:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8027b5:	4d 89 27             	mov    %r12,(%r15)
+}
+  8027b8:	48 83 c4 08          	add    $0x8,%rsp
+  8027bc:	5b                   	pop    %rbx
+  8027bd:	41 5c                	pop    %r12
+  8027bf:	41 5d                	pop    %r13
+  8027c1:	41 5e                	pop    %r14
+  8027c3:	41 5f                	pop    %r15
+  8027c5:	5d                   	pop    %rbp
+  8027c6:	c3                   	ret
+
+00000000008027c7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8027c7:	83 ff 1f             	cmp    $0x1f,%edi
+  8027ca:	77 39                	ja     802805 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8027cc:	55                   	push   %rbp
+  8027cd:	48 89 e5             	mov    %rsp,%rbp
+  8027d0:	41 54                	push   %r12
+  8027d2:	53                   	push   %rbx
+  8027d3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8027d6:	48 63 df             	movslq %edi,%rbx
+  8027d9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8027e0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8027e4:	48 89 df             	mov    %rbx,%rdi
+  8027e7:	48 b8 d4 46 80 00 00 	movabs $0x8046d4,%rax
+  8027ee:	00 00 00 
+  8027f1:	ff d0                	call   *%rax
+  8027f3:	a8 04                	test   $0x4,%al
+  8027f5:	74 14                	je     80280b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8027f7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8027fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802800:	5b                   	pop    %rbx
+  802801:	41 5c                	pop    %r12
+  802803:	5d                   	pop    %rbp
+  802804:	c3                   	ret
+        return -E_INVAL;
+  802805:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80280a:	c3                   	ret
+        return -E_INVAL;
+  80280b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802810:	eb ee                	jmp    802800 <fd_lookup+0x39>
+
+0000000000802812 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802812:	55                   	push   %rbp
+  802813:	48 89 e5             	mov    %rsp,%rbp
+  802816:	41 54                	push   %r12
+  802818:	53                   	push   %rbx
+  802819:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80281c:	48 b8 a0 58 80 00 00 	movabs $0x8058a0,%rax
+  802823:	00 00 00 
+  802826:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80282d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802830:	39 3b                	cmp    %edi,(%rbx)
+  802832:	74 47                	je     80287b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802834:	48 83 c0 08          	add    $0x8,%rax
+  802838:	48 8b 18             	mov    (%rax),%rbx
+  80283b:	48 85 db             	test   %rbx,%rbx
+  80283e:	75 f0                	jne    802830 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802840:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  802847:	00 00 00 
+  80284a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802850:	89 fa                	mov    %edi,%edx
+  802852:	48 bf 10 58 80 00 00 	movabs $0x805810,%rdi
+  802859:	00 00 00 
+  80285c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802861:	48 b9 3d 0b 80 00 00 	movabs $0x800b3d,%rcx
+  802868:	00 00 00 
+  80286b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80286d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802872:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802876:	5b                   	pop    %rbx
+  802877:	41 5c                	pop    %r12
+  802879:	5d                   	pop    %rbp
+  80287a:	c3                   	ret
+            return 0;
+  80287b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802880:	eb f0                	jmp    802872 <dev_lookup+0x60>
+
+0000000000802882 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802882:	55                   	push   %rbp
+  802883:	48 89 e5             	mov    %rsp,%rbp
+  802886:	41 55                	push   %r13
+  802888:	41 54                	push   %r12
+  80288a:	53                   	push   %rbx
+  80288b:	48 83 ec 18          	sub    $0x18,%rsp
+  80288f:	48 89 fb             	mov    %rdi,%rbx
+  802892:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802895:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80289c:	ff ff ff 
+  80289f:	48 01 df             	add    %rbx,%rdi
+  8028a2:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8028a6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8028aa:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  8028b1:	00 00 00 
+  8028b4:	ff d0                	call   *%rax
+  8028b6:	41 89 c5             	mov    %eax,%r13d
+  8028b9:	85 c0                	test   %eax,%eax
+  8028bb:	78 06                	js     8028c3 <fd_close+0x41>
+  8028bd:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8028c1:	74 1a                	je     8028dd <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8028c3:	45 84 e4             	test   %r12b,%r12b
+  8028c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028cb:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8028cf:	44 89 e8             	mov    %r13d,%eax
+  8028d2:	48 83 c4 18          	add    $0x18,%rsp
+  8028d6:	5b                   	pop    %rbx
+  8028d7:	41 5c                	pop    %r12
+  8028d9:	41 5d                	pop    %r13
+  8028db:	5d                   	pop    %rbp
+  8028dc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8028dd:	8b 3b                	mov    (%rbx),%edi
+  8028df:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028e3:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  8028ea:	00 00 00 
+  8028ed:	ff d0                	call   *%rax
+  8028ef:	41 89 c5             	mov    %eax,%r13d
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	78 1b                	js     802911 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8028f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028fa:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8028fe:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802904:	48 85 c0             	test   %rax,%rax
+  802907:	74 08                	je     802911 <fd_close+0x8f>
+  802909:	48 89 df             	mov    %rbx,%rdi
+  80290c:	ff d0                	call   *%rax
+  80290e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802911:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802916:	48 89 de             	mov    %rbx,%rsi
+  802919:	bf 00 00 00 00       	mov    $0x0,%edi
+  80291e:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  802925:	00 00 00 
+  802928:	ff d0                	call   *%rax
+    return res;
+  80292a:	eb a3                	jmp    8028cf <fd_close+0x4d>
+
+000000000080292c <close>:
+
+int
+close(int fdnum) {
+  80292c:	55                   	push   %rbp
+  80292d:	48 89 e5             	mov    %rsp,%rbp
+  802930:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802934:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802938:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  80293f:	00 00 00 
+  802942:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802944:	85 c0                	test   %eax,%eax
+  802946:	78 15                	js     80295d <close+0x31>
+
+    return fd_close(fd, 1);
+  802948:	be 01 00 00 00       	mov    $0x1,%esi
+  80294d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802951:	48 b8 82 28 80 00 00 	movabs $0x802882,%rax
+  802958:	00 00 00 
+  80295b:	ff d0                	call   *%rax
+}
+  80295d:	c9                   	leave
+  80295e:	c3                   	ret
+
+000000000080295f <close_all>:
+
+void
+close_all(void) {
+  80295f:	55                   	push   %rbp
+  802960:	48 89 e5             	mov    %rsp,%rbp
+  802963:	41 54                	push   %r12
+  802965:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802966:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80296b:	49 bc 2c 29 80 00 00 	movabs $0x80292c,%r12
+  802972:	00 00 00 
+  802975:	89 df                	mov    %ebx,%edi
+  802977:	41 ff d4             	call   *%r12
+  80297a:	83 c3 01             	add    $0x1,%ebx
+  80297d:	83 fb 20             	cmp    $0x20,%ebx
+  802980:	75 f3                	jne    802975 <close_all+0x16>
+}
+  802982:	5b                   	pop    %rbx
+  802983:	41 5c                	pop    %r12
+  802985:	5d                   	pop    %rbp
+  802986:	c3                   	ret
+
+0000000000802987 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802987:	55                   	push   %rbp
+  802988:	48 89 e5             	mov    %rsp,%rbp
+  80298b:	41 57                	push   %r15
+  80298d:	41 56                	push   %r14
+  80298f:	41 55                	push   %r13
+  802991:	41 54                	push   %r12
+  802993:	53                   	push   %rbx
+  802994:	48 83 ec 18          	sub    $0x18,%rsp
+  802998:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80299b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80299f:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  8029a6:	00 00 00 
+  8029a9:	ff d0                	call   *%rax
+  8029ab:	89 c3                	mov    %eax,%ebx
+  8029ad:	85 c0                	test   %eax,%eax
+  8029af:	0f 88 b8 00 00 00    	js     802a6d <dup+0xe6>
+    close(newfdnum);
+  8029b5:	44 89 e7             	mov    %r12d,%edi
+  8029b8:	48 b8 2c 29 80 00 00 	movabs $0x80292c,%rax
+  8029bf:	00 00 00 
+  8029c2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8029c4:	4d 63 ec             	movslq %r12d,%r13
+  8029c7:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8029ce:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8029d2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8029d6:	4c 89 ff             	mov    %r15,%rdi
+  8029d9:	49 be 4b 27 80 00 00 	movabs $0x80274b,%r14
+  8029e0:	00 00 00 
+  8029e3:	41 ff d6             	call   *%r14
+  8029e6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8029e9:	4c 89 ef             	mov    %r13,%rdi
+  8029ec:	41 ff d6             	call   *%r14
+  8029ef:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8029f2:	48 89 df             	mov    %rbx,%rdi
+  8029f5:	48 b8 d4 46 80 00 00 	movabs $0x8046d4,%rax
+  8029fc:	00 00 00 
+  8029ff:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802a01:	a8 04                	test   $0x4,%al
+  802a03:	74 2b                	je     802a30 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802a05:	41 89 c1             	mov    %eax,%r9d
+  802a08:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802a0e:	4c 89 f1             	mov    %r14,%rcx
+  802a11:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a16:	48 89 de             	mov    %rbx,%rsi
+  802a19:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a1e:	48 b8 7c 1c 80 00 00 	movabs $0x801c7c,%rax
+  802a25:	00 00 00 
+  802a28:	ff d0                	call   *%rax
+  802a2a:	89 c3                	mov    %eax,%ebx
+  802a2c:	85 c0                	test   %eax,%eax
+  802a2e:	78 4e                	js     802a7e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802a30:	4c 89 ff             	mov    %r15,%rdi
+  802a33:	48 b8 d4 46 80 00 00 	movabs $0x8046d4,%rax
+  802a3a:	00 00 00 
+  802a3d:	ff d0                	call   *%rax
+  802a3f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802a42:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802a48:	4c 89 e9             	mov    %r13,%rcx
+  802a4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a50:	4c 89 fe             	mov    %r15,%rsi
+  802a53:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a58:	48 b8 7c 1c 80 00 00 	movabs $0x801c7c,%rax
+  802a5f:	00 00 00 
+  802a62:	ff d0                	call   *%rax
+  802a64:	89 c3                	mov    %eax,%ebx
+  802a66:	85 c0                	test   %eax,%eax
+  802a68:	78 14                	js     802a7e <dup+0xf7>
+
+    return newfdnum;
+  802a6a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802a6d:	89 d8                	mov    %ebx,%eax
+  802a6f:	48 83 c4 18          	add    $0x18,%rsp
+  802a73:	5b                   	pop    %rbx
+  802a74:	41 5c                	pop    %r12
+  802a76:	41 5d                	pop    %r13
+  802a78:	41 5e                	pop    %r14
+  802a7a:	41 5f                	pop    %r15
+  802a7c:	5d                   	pop    %rbp
+  802a7d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802a7e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a83:	4c 89 ee             	mov    %r13,%rsi
+  802a86:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a8b:	49 bc f4 1d 80 00 00 	movabs $0x801df4,%r12
+  802a92:	00 00 00 
+  802a95:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802a98:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a9d:	4c 89 f6             	mov    %r14,%rsi
+  802aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aa5:	41 ff d4             	call   *%r12
+    return res;
+  802aa8:	eb c3                	jmp    802a6d <dup+0xe6>
+
+0000000000802aaa <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802aaa:	55                   	push   %rbp
+  802aab:	48 89 e5             	mov    %rsp,%rbp
+  802aae:	41 56                	push   %r14
+  802ab0:	41 55                	push   %r13
+  802ab2:	41 54                	push   %r12
+  802ab4:	53                   	push   %rbx
+  802ab5:	48 83 ec 10          	sub    $0x10,%rsp
+  802ab9:	89 fb                	mov    %edi,%ebx
+  802abb:	49 89 f4             	mov    %rsi,%r12
+  802abe:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ac1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802ac5:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  802acc:	00 00 00 
+  802acf:	ff d0                	call   *%rax
+  802ad1:	85 c0                	test   %eax,%eax
+  802ad3:	78 4c                	js     802b21 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802ad5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802ad9:	41 8b 3e             	mov    (%r14),%edi
+  802adc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802ae0:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  802ae7:	00 00 00 
+  802aea:	ff d0                	call   *%rax
+  802aec:	85 c0                	test   %eax,%eax
+  802aee:	78 35                	js     802b25 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802af0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802af4:	83 e0 03             	and    $0x3,%eax
+  802af7:	83 f8 01             	cmp    $0x1,%eax
+  802afa:	74 2d                	je     802b29 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802afc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b00:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802b04:	48 85 c0             	test   %rax,%rax
+  802b07:	74 56                	je     802b5f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802b09:	4c 89 ea             	mov    %r13,%rdx
+  802b0c:	4c 89 e6             	mov    %r12,%rsi
+  802b0f:	4c 89 f7             	mov    %r14,%rdi
+  802b12:	ff d0                	call   *%rax
+}
+  802b14:	48 83 c4 10          	add    $0x10,%rsp
+  802b18:	5b                   	pop    %rbx
+  802b19:	41 5c                	pop    %r12
+  802b1b:	41 5d                	pop    %r13
+  802b1d:	41 5e                	pop    %r14
+  802b1f:	5d                   	pop    %rbp
+  802b20:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b21:	48 98                	cltq
+  802b23:	eb ef                	jmp    802b14 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b25:	48 98                	cltq
+  802b27:	eb eb                	jmp    802b14 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802b29:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  802b30:	00 00 00 
+  802b33:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802b39:	89 da                	mov    %ebx,%edx
+  802b3b:	48 bf 51 58 80 00 00 	movabs $0x805851,%rdi
+  802b42:	00 00 00 
+  802b45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4a:	48 b9 3d 0b 80 00 00 	movabs $0x800b3d,%rcx
+  802b51:	00 00 00 
+  802b54:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802b56:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802b5d:	eb b5                	jmp    802b14 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802b5f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802b66:	eb ac                	jmp    802b14 <read+0x6a>
+
+0000000000802b68 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802b68:	55                   	push   %rbp
+  802b69:	48 89 e5             	mov    %rsp,%rbp
+  802b6c:	41 57                	push   %r15
+  802b6e:	41 56                	push   %r14
+  802b70:	41 55                	push   %r13
+  802b72:	41 54                	push   %r12
+  802b74:	53                   	push   %rbx
+  802b75:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802b79:	48 85 d2             	test   %rdx,%rdx
+  802b7c:	74 54                	je     802bd2 <readn+0x6a>
+  802b7e:	41 89 fd             	mov    %edi,%r13d
+  802b81:	49 89 f6             	mov    %rsi,%r14
+  802b84:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802b87:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802b8c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802b91:	49 bf aa 2a 80 00 00 	movabs $0x802aaa,%r15
+  802b98:	00 00 00 
+  802b9b:	4c 89 e2             	mov    %r12,%rdx
+  802b9e:	48 29 f2             	sub    %rsi,%rdx
+  802ba1:	4c 01 f6             	add    %r14,%rsi
+  802ba4:	44 89 ef             	mov    %r13d,%edi
+  802ba7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802baa:	85 c0                	test   %eax,%eax
+  802bac:	78 20                	js     802bce <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802bae:	01 c3                	add    %eax,%ebx
+  802bb0:	85 c0                	test   %eax,%eax
+  802bb2:	74 08                	je     802bbc <readn+0x54>
+  802bb4:	48 63 f3             	movslq %ebx,%rsi
+  802bb7:	4c 39 e6             	cmp    %r12,%rsi
+  802bba:	72 df                	jb     802b9b <readn+0x33>
+    }
+    return res;
+  802bbc:	48 63 c3             	movslq %ebx,%rax
+}
+  802bbf:	48 83 c4 08          	add    $0x8,%rsp
+  802bc3:	5b                   	pop    %rbx
+  802bc4:	41 5c                	pop    %r12
+  802bc6:	41 5d                	pop    %r13
+  802bc8:	41 5e                	pop    %r14
+  802bca:	41 5f                	pop    %r15
+  802bcc:	5d                   	pop    %rbp
+  802bcd:	c3                   	ret
+        if (inc < 0) return inc;
+  802bce:	48 98                	cltq
+  802bd0:	eb ed                	jmp    802bbf <readn+0x57>
+    int inc = 1, res = 0;
+  802bd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bd7:	eb e3                	jmp    802bbc <readn+0x54>
+
+0000000000802bd9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802bd9:	55                   	push   %rbp
+  802bda:	48 89 e5             	mov    %rsp,%rbp
+  802bdd:	41 56                	push   %r14
+  802bdf:	41 55                	push   %r13
+  802be1:	41 54                	push   %r12
+  802be3:	53                   	push   %rbx
+  802be4:	48 83 ec 10          	sub    $0x10,%rsp
+  802be8:	89 fb                	mov    %edi,%ebx
+  802bea:	49 89 f4             	mov    %rsi,%r12
+  802bed:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bf0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802bf4:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  802bfb:	00 00 00 
+  802bfe:	ff d0                	call   *%rax
+  802c00:	85 c0                	test   %eax,%eax
+  802c02:	78 47                	js     802c4b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c04:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802c08:	41 8b 3e             	mov    (%r14),%edi
+  802c0b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802c0f:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  802c16:	00 00 00 
+  802c19:	ff d0                	call   *%rax
+  802c1b:	85 c0                	test   %eax,%eax
+  802c1d:	78 30                	js     802c4f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802c1f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802c24:	74 2d                	je     802c53 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802c26:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c2a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802c2e:	48 85 c0             	test   %rax,%rax
+  802c31:	74 56                	je     802c89 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802c33:	4c 89 ea             	mov    %r13,%rdx
+  802c36:	4c 89 e6             	mov    %r12,%rsi
+  802c39:	4c 89 f7             	mov    %r14,%rdi
+  802c3c:	ff d0                	call   *%rax
+}
+  802c3e:	48 83 c4 10          	add    $0x10,%rsp
+  802c42:	5b                   	pop    %rbx
+  802c43:	41 5c                	pop    %r12
+  802c45:	41 5d                	pop    %r13
+  802c47:	41 5e                	pop    %r14
+  802c49:	5d                   	pop    %rbp
+  802c4a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c4b:	48 98                	cltq
+  802c4d:	eb ef                	jmp    802c3e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c4f:	48 98                	cltq
+  802c51:	eb eb                	jmp    802c3e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802c53:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  802c5a:	00 00 00 
+  802c5d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802c63:	89 da                	mov    %ebx,%edx
+  802c65:	48 bf 6d 58 80 00 00 	movabs $0x80586d,%rdi
+  802c6c:	00 00 00 
+  802c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c74:	48 b9 3d 0b 80 00 00 	movabs $0x800b3d,%rcx
+  802c7b:	00 00 00 
+  802c7e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802c80:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802c87:	eb b5                	jmp    802c3e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802c89:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802c90:	eb ac                	jmp    802c3e <write+0x65>
+
+0000000000802c92 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802c92:	55                   	push   %rbp
+  802c93:	48 89 e5             	mov    %rsp,%rbp
+  802c96:	53                   	push   %rbx
+  802c97:	48 83 ec 18          	sub    $0x18,%rsp
+  802c9b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c9d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ca1:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  802ca8:	00 00 00 
+  802cab:	ff d0                	call   *%rax
+  802cad:	85 c0                	test   %eax,%eax
+  802caf:	78 0c                	js     802cbd <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802cb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cb5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cbd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc1:	c9                   	leave
+  802cc2:	c3                   	ret
+
+0000000000802cc3 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802cc3:	55                   	push   %rbp
+  802cc4:	48 89 e5             	mov    %rsp,%rbp
+  802cc7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802ccb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ccf:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  802cd6:	00 00 00 
+  802cd9:	ff d0                	call   *%rax
+  802cdb:	85 c0                	test   %eax,%eax
+  802cdd:	78 07                	js     802ce6 <tell+0x23>
+    return fdes->fd_offset;
+  802cdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ce3:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802ce6:	c9                   	leave
+  802ce7:	c3                   	ret
+
+0000000000802ce8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802ce8:	55                   	push   %rbp
+  802ce9:	48 89 e5             	mov    %rsp,%rbp
+  802cec:	41 55                	push   %r13
+  802cee:	41 54                	push   %r12
+  802cf0:	53                   	push   %rbx
+  802cf1:	48 83 ec 18          	sub    $0x18,%rsp
+  802cf5:	89 fb                	mov    %edi,%ebx
+  802cf7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802cfa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802cfe:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  802d05:	00 00 00 
+  802d08:	ff d0                	call   *%rax
+  802d0a:	85 c0                	test   %eax,%eax
+  802d0c:	78 38                	js     802d46 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802d0e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802d12:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802d16:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802d1a:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  802d21:	00 00 00 
+  802d24:	ff d0                	call   *%rax
+  802d26:	85 c0                	test   %eax,%eax
+  802d28:	78 1c                	js     802d46 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802d2a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802d2f:	74 20                	je     802d51 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802d31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d35:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802d39:	48 85 c0             	test   %rax,%rax
+  802d3c:	74 47                	je     802d85 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802d3e:	44 89 e6             	mov    %r12d,%esi
+  802d41:	4c 89 ef             	mov    %r13,%rdi
+  802d44:	ff d0                	call   *%rax
+}
+  802d46:	48 83 c4 18          	add    $0x18,%rsp
+  802d4a:	5b                   	pop    %rbx
+  802d4b:	41 5c                	pop    %r12
+  802d4d:	41 5d                	pop    %r13
+  802d4f:	5d                   	pop    %rbp
+  802d50:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802d51:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  802d58:	00 00 00 
+  802d5b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802d61:	89 da                	mov    %ebx,%edx
+  802d63:	48 bf 30 58 80 00 00 	movabs $0x805830,%rdi
+  802d6a:	00 00 00 
+  802d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d72:	48 b9 3d 0b 80 00 00 	movabs $0x800b3d,%rcx
+  802d79:	00 00 00 
+  802d7c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802d7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d83:	eb c1                	jmp    802d46 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802d85:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d8a:	eb ba                	jmp    802d46 <ftruncate+0x5e>
+
+0000000000802d8c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802d8c:	55                   	push   %rbp
+  802d8d:	48 89 e5             	mov    %rsp,%rbp
+  802d90:	41 54                	push   %r12
+  802d92:	53                   	push   %rbx
+  802d93:	48 83 ec 10          	sub    $0x10,%rsp
+  802d97:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d9a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802d9e:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  802da5:	00 00 00 
+  802da8:	ff d0                	call   *%rax
+  802daa:	85 c0                	test   %eax,%eax
+  802dac:	78 4e                	js     802dfc <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802dae:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802db2:	41 8b 3c 24          	mov    (%r12),%edi
+  802db6:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802dba:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  802dc1:	00 00 00 
+  802dc4:	ff d0                	call   *%rax
+  802dc6:	85 c0                	test   %eax,%eax
+  802dc8:	78 32                	js     802dfc <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802dca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802dce:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802dd3:	74 30                	je     802e05 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802dd5:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802dd8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802ddf:	00 00 00 
+    stat->st_isdir = 0;
+  802de2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802de9:	00 00 00 
+    stat->st_dev = dev;
+  802dec:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802df3:	48 89 de             	mov    %rbx,%rsi
+  802df6:	4c 89 e7             	mov    %r12,%rdi
+  802df9:	ff 50 28             	call   *0x28(%rax)
+}
+  802dfc:	48 83 c4 10          	add    $0x10,%rsp
+  802e00:	5b                   	pop    %rbx
+  802e01:	41 5c                	pop    %r12
+  802e03:	5d                   	pop    %rbp
+  802e04:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802e05:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802e0a:	eb f0                	jmp    802dfc <fstat+0x70>
+
+0000000000802e0c <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802e0c:	55                   	push   %rbp
+  802e0d:	48 89 e5             	mov    %rsp,%rbp
+  802e10:	41 54                	push   %r12
+  802e12:	53                   	push   %rbx
+  802e13:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802e1a:	41 89 fc             	mov    %edi,%r12d
+  802e1d:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802e1f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802e23:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  802e2a:	00 00 00 
+  802e2d:	ff d0                	call   *%rax
+  802e2f:	85 c0                	test   %eax,%eax
+  802e31:	78 31                	js     802e64 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802e33:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802e3a:	44 89 e7             	mov    %r12d,%edi
+  802e3d:	48 b8 8c 2d 80 00 00 	movabs $0x802d8c,%rax
+  802e44:	00 00 00 
+  802e47:	ff d0                	call   *%rax
+  802e49:	85 c0                	test   %eax,%eax
+  802e4b:	78 17                	js     802e64 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802e4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e51:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802e54:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802e57:	39 d3                	cmp    %edx,%ebx
+  802e59:	0f 4f da             	cmovg  %edx,%ebx
+  802e5c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e64:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802e6b:	5b                   	pop    %rbx
+  802e6c:	41 5c                	pop    %r12
+  802e6e:	5d                   	pop    %rbp
+  802e6f:	c3                   	ret
+
+0000000000802e70 <seektoend>:
+{
+  802e70:	55                   	push   %rbp
+  802e71:	48 89 e5             	mov    %rsp,%rbp
+  802e74:	53                   	push   %rbx
+  802e75:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802e7c:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802e7e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802e82:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  802e89:	00 00 00 
+  802e8c:	ff d0                	call   *%rax
+  802e8e:	85 c0                	test   %eax,%eax
+  802e90:	78 28                	js     802eba <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802e92:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802e99:	89 df                	mov    %ebx,%edi
+  802e9b:	48 b8 8c 2d 80 00 00 	movabs $0x802d8c,%rax
+  802ea2:	00 00 00 
+  802ea5:	ff d0                	call   *%rax
+  802ea7:	85 c0                	test   %eax,%eax
+  802ea9:	78 0f                	js     802eba <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802eab:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802eae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eb2:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ebe:	c9                   	leave
+  802ebf:	c3                   	ret
+
+0000000000802ec0 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802ec0:	55                   	push   %rbp
+  802ec1:	48 89 e5             	mov    %rsp,%rbp
+  802ec4:	41 54                	push   %r12
+  802ec6:	53                   	push   %rbx
+  802ec7:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802eca:	be 00 00 00 00       	mov    $0x0,%esi
+  802ecf:	48 b8 b3 3a 80 00 00 	movabs $0x803ab3,%rax
+  802ed6:	00 00 00 
+  802ed9:	ff d0                	call   *%rax
+  802edb:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802edd:	85 c0                	test   %eax,%eax
+  802edf:	78 25                	js     802f06 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802ee1:	4c 89 e6             	mov    %r12,%rsi
+  802ee4:	89 c7                	mov    %eax,%edi
+  802ee6:	48 b8 8c 2d 80 00 00 	movabs $0x802d8c,%rax
+  802eed:	00 00 00 
+  802ef0:	ff d0                	call   *%rax
+  802ef2:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802ef5:	89 df                	mov    %ebx,%edi
+  802ef7:	48 b8 2c 29 80 00 00 	movabs $0x80292c,%rax
+  802efe:	00 00 00 
+  802f01:	ff d0                	call   *%rax
+
+    return res;
+  802f03:	44 89 e3             	mov    %r12d,%ebx
+}
+  802f06:	89 d8                	mov    %ebx,%eax
+  802f08:	5b                   	pop    %rbx
+  802f09:	41 5c                	pop    %r12
+  802f0b:	5d                   	pop    %rbp
+  802f0c:	c3                   	ret
+
+0000000000802f0d <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802f0d:	55                   	push   %rbp
+  802f0e:	48 89 e5             	mov    %rsp,%rbp
+  802f11:	53                   	push   %rbx
+  802f12:	48 83 ec 08          	sub    $0x8,%rsp
+  802f16:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802f19:	48 b8 39 27 80 00 00 	movabs $0x802739,%rax
+  802f20:	00 00 00 
+  802f23:	ff d0                	call   *%rax
+  802f25:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802f29:	0f 87 ea 00 00 00    	ja     803019 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802f2f:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802f36:	00 00 00 
+  802f39:	80 38 00             	cmpb   $0x0,(%rax)
+  802f3c:	75 35                	jne    802f73 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802f3e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802f43:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802f48:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802f4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f52:	48 b8 15 1c 80 00 00 	movabs $0x801c15,%rax
+  802f59:	00 00 00 
+  802f5c:	ff d0                	call   *%rax
+  802f5e:	85 c0                	test   %eax,%eax
+  802f60:	0f 88 ba 00 00 00    	js     803020 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802f66:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802f6d:	00 00 00 
+  802f70:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802f73:	48 89 df             	mov    %rbx,%rdi
+  802f76:	48 b8 39 27 80 00 00 	movabs $0x802739,%rax
+  802f7d:	00 00 00 
+  802f80:	ff d0                	call   *%rax
+  802f82:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802f86:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802f8d:	00 00 00 
+  802f90:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802f94:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802f97:	39 39                	cmp    %edi,(%rcx)
+  802f99:	74 46                	je     802fe1 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802f9b:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802f9f:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802fa6:	00 
+  802fa7:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802fae:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802fb5:	00 
+  802fb6:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802fbd:	00 
+  802fbe:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802fc5:	00 
+  802fc6:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802fcd:	00 
+  802fce:	89 39                	mov    %edi,(%rcx)
+  802fd0:	48 01 c6             	add    %rax,%rsi
+  802fd3:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802fd8:	48 89 c8             	mov    %rcx,%rax
+  802fdb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fdf:	c9                   	leave
+  802fe0:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802fe1:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802fe5:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802fec:	00 00 00 
+  802fef:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802ff2:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802ff6:	74 e0                	je     802fd8 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802ff8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802fff:	00 
+  803000:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  803004:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  80300b:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  80300d:	8b 7b 10             	mov    0x10(%rbx),%edi
+  803010:	48 01 c2             	add    %rax,%rdx
+  803013:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  803017:	eb bf                	jmp    802fd8 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  803019:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80301e:	eb b8                	jmp    802fd8 <fbuf_get+0xcb>
+            return NULL;
+  803020:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803025:	eb b1                	jmp    802fd8 <fbuf_get+0xcb>
+
+0000000000803027 <fsipc_bulk>:
+fsipc_bulk(void) {
+  803027:	55                   	push   %rbp
+  803028:	48 89 e5             	mov    %rsp,%rbp
+  80302b:	53                   	push   %rbx
+  80302c:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  803030:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  803037:	00 00 00 
+  80303a:	48 8b 18             	mov    (%rax),%rbx
+  80303d:	48 85 db             	test   %rbx,%rbx
+  803040:	74 16                	je     803058 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  803042:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  803049:	00 00 00 
+  80304c:	48 8b 18             	mov    (%rax),%rbx
+}
+  80304f:	48 89 d8             	mov    %rbx,%rax
+  803052:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803056:	c9                   	leave
+  803057:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  803058:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80305d:	ba 00 10 04 00       	mov    $0x41000,%edx
+  803062:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  803067:	bf 00 00 00 00       	mov    $0x0,%edi
+  80306c:	48 b8 15 1c 80 00 00 	movabs $0x801c15,%rax
+  803073:	00 00 00 
+  803076:	ff d0                	call   *%rax
+  803078:	85 c0                	test   %eax,%eax
+  80307a:	78 d3                	js     80304f <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  80307c:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  803081:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  803088:	00 00 00 
+  80308b:	eb b5                	jmp    803042 <fsipc_bulk+0x1b>
+
+000000000080308d <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  80308d:	55                   	push   %rbp
+  80308e:	48 89 e5             	mov    %rsp,%rbp
+  803091:	41 57                	push   %r15
+  803093:	41 56                	push   %r14
+  803095:	41 55                	push   %r13
+  803097:	41 54                	push   %r12
+  803099:	53                   	push   %rbx
+  80309a:	48 83 ec 08          	sub    $0x8,%rsp
+  80309e:	41 89 fd             	mov    %edi,%r13d
+  8030a1:	49 89 f6             	mov    %rsi,%r14
+  8030a4:	49 89 d7             	mov    %rdx,%r15
+  8030a7:	48 89 cb             	mov    %rcx,%rbx
+  8030aa:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8030ad:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8030b4:	00 00 00 
+  8030b7:	83 38 00             	cmpl   $0x0,(%rax)
+  8030ba:	74 52                	je     80310e <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  8030bc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8030c2:	4c 89 f9             	mov    %r15,%rcx
+  8030c5:	4c 89 f2             	mov    %r14,%rdx
+  8030c8:	44 89 ee             	mov    %r13d,%esi
+  8030cb:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  8030d2:	00 00 00 
+  8030d5:	8b 38                	mov    (%rax),%edi
+  8030d7:	48 b8 2b 4c 80 00 00 	movabs $0x804c2b,%rax
+  8030de:	00 00 00 
+  8030e1:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  8030e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030e8:	4c 89 e2             	mov    %r12,%rdx
+  8030eb:	48 89 de             	mov    %rbx,%rsi
+  8030ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f3:	48 b8 7b 4a 80 00 00 	movabs $0x804a7b,%rax
+  8030fa:	00 00 00 
+  8030fd:	ff d0                	call   *%rax
+}
+  8030ff:	48 83 c4 08          	add    $0x8,%rsp
+  803103:	5b                   	pop    %rbx
+  803104:	41 5c                	pop    %r12
+  803106:	41 5d                	pop    %r13
+  803108:	41 5e                	pop    %r14
+  80310a:	41 5f                	pop    %r15
+  80310c:	5d                   	pop    %rbp
+  80310d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80310e:	bf 03 00 00 00       	mov    $0x3,%edi
+  803113:	48 b8 ce 4c 80 00 00 	movabs $0x804cce,%rax
+  80311a:	00 00 00 
+  80311d:	ff d0                	call   *%rax
+  80311f:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  803126:	00 00 
+  803128:	eb 92                	jmp    8030bc <fsipc_region+0x2f>
+
+000000000080312a <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80312a:	55                   	push   %rbp
+  80312b:	48 89 e5             	mov    %rsp,%rbp
+  80312e:	41 57                	push   %r15
+  803130:	41 56                	push   %r14
+  803132:	41 55                	push   %r13
+  803134:	41 54                	push   %r12
+  803136:	53                   	push   %rbx
+  803137:	48 83 ec 28          	sub    $0x28,%rsp
+  80313b:	49 89 ff             	mov    %rdi,%r15
+  80313e:	49 89 f6             	mov    %rsi,%r14
+  803141:	48 89 d3             	mov    %rdx,%rbx
+  803144:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803148:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  80314b:	48 b8 27 30 80 00 00 	movabs $0x803027,%rax
+  803152:	00 00 00 
+  803155:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  803157:	48 85 c0             	test   %rax,%rax
+  80315a:	0f 84 cc 00 00 00    	je     80322c <devfile_write_direct+0x102>
+  803160:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  803163:	48 85 db             	test   %rbx,%rbx
+  803166:	0f 84 ba 00 00 00    	je     803226 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  80316c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  803172:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803179:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  80317d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803181:	4c 29 e3             	sub    %r12,%rbx
+  803184:	b8 00 00 04 00       	mov    $0x40000,%eax
+  803189:	48 39 c3             	cmp    %rax,%rbx
+  80318c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  803190:	48 89 da             	mov    %rbx,%rdx
+  803193:	4c 89 f6             	mov    %r14,%rsi
+  803196:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80319a:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  8031a1:	00 00 00 
+  8031a4:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  8031a6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8031aa:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  8031ae:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8031b1:	44 01 e0             	add    %r12d,%eax
+  8031b4:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  8031b8:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  8031bc:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  8031c3:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  8031ca:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  8031d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031dc:	4c 89 ee             	mov    %r13,%rsi
+  8031df:	bf 04 00 00 00       	mov    $0x4,%edi
+  8031e4:	48 b8 8d 30 80 00 00 	movabs $0x80308d,%rax
+  8031eb:	00 00 00 
+  8031ee:	ff d0                	call   *%rax
+        if (res < 0)
+  8031f0:	85 c0                	test   %eax,%eax
+  8031f2:	78 29                	js     80321d <devfile_write_direct+0xf3>
+        if (res == 0)
+  8031f4:	74 2b                	je     803221 <devfile_write_direct+0xf7>
+        i += res;
+  8031f6:	48 98                	cltq
+  8031f8:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  8031fb:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  8031fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803202:	49 39 c4             	cmp    %rax,%r12
+  803205:	0f 82 72 ff ff ff    	jb     80317d <devfile_write_direct+0x53>
+    return i;
+  80320b:	4c 89 e0             	mov    %r12,%rax
+}
+  80320e:	48 83 c4 28          	add    $0x28,%rsp
+  803212:	5b                   	pop    %rbx
+  803213:	41 5c                	pop    %r12
+  803215:	41 5d                	pop    %r13
+  803217:	41 5e                	pop    %r14
+  803219:	41 5f                	pop    %r15
+  80321b:	5d                   	pop    %rbp
+  80321c:	c3                   	ret
+            return res;
+  80321d:	48 98                	cltq
+  80321f:	eb ed                	jmp    80320e <devfile_write_direct+0xe4>
+            return i;
+  803221:	4c 89 e0             	mov    %r12,%rax
+  803224:	eb e8                	jmp    80320e <devfile_write_direct+0xe4>
+    size_t i = 0;
+  803226:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  80322a:	eb df                	jmp    80320b <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  80322c:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  803233:	eb d9                	jmp    80320e <devfile_write_direct+0xe4>
+
+0000000000803235 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  803235:	55                   	push   %rbp
+  803236:	48 89 e5             	mov    %rsp,%rbp
+  803239:	41 56                	push   %r14
+  80323b:	41 55                	push   %r13
+  80323d:	41 54                	push   %r12
+  80323f:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  803240:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  803244:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  803248:	b8 00 00 00 00       	mov    $0x0,%eax
+  80324d:	4d 39 ee             	cmp    %r13,%r14
+  803250:	0f 84 99 00 00 00    	je     8032ef <fbuf_flush+0xba>
+  803256:	49 89 fc             	mov    %rdi,%r12
+  803259:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  80325c:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  80325f:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803263:	48 b8 39 27 80 00 00 	movabs $0x802739,%rax
+  80326a:	00 00 00 
+  80326d:	ff d0                	call   *%rax
+  80326f:	48 89 c2             	mov    %rax,%rdx
+  803272:	48 c1 e2 04          	shl    $0x4,%rdx
+  803276:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80327a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80327e:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803283:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  803286:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80328a:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803291:	00 
+  803292:	44 89 f1             	mov    %r14d,%ecx
+  803295:	4c 89 ea             	mov    %r13,%rdx
+  803298:	4c 89 e7             	mov    %r12,%rdi
+  80329b:	48 b8 2a 31 80 00 00 	movabs $0x80312a,%rax
+  8032a2:	00 00 00 
+  8032a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032a7:	48 85 c0             	test   %rax,%rax
+  8032aa:	78 43                	js     8032ef <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  8032ac:	4c 39 e8             	cmp    %r13,%rax
+  8032af:	72 47                	jb     8032f8 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  8032b1:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8032b6:	83 c0 01             	add    $0x1,%eax
+  8032b9:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8032be:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  8032c1:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8032c5:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  8032c9:	72 0f                	jb     8032da <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  8032cb:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8032cf:	48 39 c2             	cmp    %rax,%rdx
+  8032d2:	48 0f 42 d0          	cmovb  %rax,%rdx
+  8032d6:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  8032da:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  8032e1:	00 
+  8032e2:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  8032e9:	00 
+    return 0;
+  8032ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032ef:	5b                   	pop    %rbx
+  8032f0:	41 5c                	pop    %r12
+  8032f2:	41 5d                	pop    %r13
+  8032f4:	41 5e                	pop    %r14
+  8032f6:	5d                   	pop    %rbp
+  8032f7:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  8032f8:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8032fd:	eb f0                	jmp    8032ef <fbuf_flush+0xba>
+
+00000000008032ff <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  8032ff:	55                   	push   %rbp
+  803300:	48 89 e5             	mov    %rsp,%rbp
+  803303:	53                   	push   %rbx
+  803304:	48 83 ec 08          	sub    $0x8,%rsp
+  803308:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  80330b:	48 b8 0d 2f 80 00 00 	movabs $0x802f0d,%rax
+  803312:	00 00 00 
+  803315:	ff d0                	call   *%rax
+  803317:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  80331a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80331f:	48 85 f6             	test   %rsi,%rsi
+  803322:	74 0f                	je     803333 <devfile_sync+0x34>
+  803324:	48 89 df             	mov    %rbx,%rdi
+  803327:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  80332e:	00 00 00 
+  803331:	ff d0                	call   *%rax
+}
+  803333:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803337:	c9                   	leave
+  803338:	c3                   	ret
+
+0000000000803339 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  803339:	55                   	push   %rbp
+  80333a:	48 89 e5             	mov    %rsp,%rbp
+  80333d:	48 83 ec 10          	sub    $0x10,%rsp
+  803341:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  803344:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  80334b:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  80334c:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  803350:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803355:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80335c:	00 00 00 
+  80335f:	48 b8 8d 30 80 00 00 	movabs $0x80308d,%rax
+  803366:	00 00 00 
+  803369:	ff d0                	call   *%rax
+}
+  80336b:	c9                   	leave
+  80336c:	c3                   	ret
+
+000000000080336d <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80336d:	55                   	push   %rbp
+  80336e:	48 89 e5             	mov    %rsp,%rbp
+  803371:	41 54                	push   %r12
+  803373:	53                   	push   %rbx
+  803374:	48 89 fb             	mov    %rdi,%rbx
+  803377:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  80337a:	48 b8 ff 32 80 00 00 	movabs $0x8032ff,%rax
+  803381:	00 00 00 
+  803384:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803386:	85 c0                	test   %eax,%eax
+  803388:	78 63                	js     8033ed <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80338a:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80338d:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803394:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  803396:	be 00 00 00 00       	mov    $0x0,%esi
+  80339b:	bf 05 00 00 00       	mov    $0x5,%edi
+  8033a0:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  8033a7:	00 00 00 
+  8033aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033ac:	85 c0                	test   %eax,%eax
+  8033ae:	78 3d                	js     8033ed <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8033b0:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8033b7:	00 00 00 
+  8033ba:	48 89 de             	mov    %rbx,%rsi
+  8033bd:	4c 89 e7             	mov    %r12,%rdi
+  8033c0:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  8033c7:	00 00 00 
+  8033ca:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8033cc:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  8033d2:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  8033d9:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8033da:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  8033e0:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  8033e7:	00 
+
+    return 0;
+  8033e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033ed:	5b                   	pop    %rbx
+  8033ee:	41 5c                	pop    %r12
+  8033f0:	5d                   	pop    %rbp
+  8033f1:	c3                   	ret
+
+00000000008033f2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8033f2:	55                   	push   %rbp
+  8033f3:	48 89 e5             	mov    %rsp,%rbp
+  8033f6:	41 54                	push   %r12
+  8033f8:	53                   	push   %rbx
+  8033f9:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  8033fc:	48 b8 ff 32 80 00 00 	movabs $0x8032ff,%rax
+  803403:	00 00 00 
+  803406:	ff d0                	call   *%rax
+  803408:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  80340b:	48 89 df             	mov    %rbx,%rdi
+  80340e:	48 b8 39 27 80 00 00 	movabs $0x802739,%rax
+  803415:	00 00 00 
+  803418:	ff d0                	call   *%rax
+  80341a:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80341e:	76 2e                	jbe    80344e <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  803420:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803423:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80342a:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  80342c:	be 00 00 00 00       	mov    $0x0,%esi
+  803431:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803436:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  80343d:	00 00 00 
+  803440:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  803442:	45 85 e4             	test   %r12d,%r12d
+  803445:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  803449:	5b                   	pop    %rbx
+  80344a:	41 5c                	pop    %r12
+  80344c:	5d                   	pop    %rbp
+  80344d:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  80344e:	48 89 df             	mov    %rbx,%rdi
+  803451:	48 b8 39 27 80 00 00 	movabs $0x802739,%rax
+  803458:	00 00 00 
+  80345b:	ff d0                	call   *%rax
+  80345d:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  803461:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  803468:	00 00 00 
+  80346b:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  803472:	48 89 df             	mov    %rbx,%rdi
+  803475:	48 b8 4b 27 80 00 00 	movabs $0x80274b,%rax
+  80347c:	00 00 00 
+  80347f:	ff d0                	call   *%rax
+  803481:	48 89 c6             	mov    %rax,%rsi
+  803484:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803489:	bf 00 00 00 00       	mov    $0x0,%edi
+  80348e:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  803495:	00 00 00 
+  803498:	ff d0                	call   *%rax
+  80349a:	eb 84                	jmp    803420 <devfile_flush+0x2e>
+
+000000000080349c <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80349c:	55                   	push   %rbp
+  80349d:	48 89 e5             	mov    %rsp,%rbp
+  8034a0:	41 55                	push   %r13
+  8034a2:	41 54                	push   %r12
+  8034a4:	53                   	push   %rbx
+  8034a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8034a9:	48 89 fb             	mov    %rdi,%rbx
+  8034ac:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  8034af:	48 b8 0d 2f 80 00 00 	movabs $0x802f0d,%rax
+  8034b6:	00 00 00 
+  8034b9:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8034bb:	48 85 c0             	test   %rax,%rax
+  8034be:	74 51                	je     803511 <devfile_trunc+0x75>
+  8034c0:	49 89 c4             	mov    %rax,%r12
+  8034c3:	48 89 c6             	mov    %rax,%rsi
+  8034c6:	48 89 df             	mov    %rbx,%rdi
+  8034c9:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  8034d0:	00 00 00 
+  8034d3:	ff d0                	call   *%rax
+  8034d5:	85 c0                	test   %eax,%eax
+  8034d7:	78 2d                	js     803506 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8034d9:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  8034e0:	00 00 00 
+  8034e3:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8034e6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8034e8:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  8034ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8034f1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8034f6:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  8034fd:	00 00 00 
+  803500:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803502:	85 c0                	test   %eax,%eax
+  803504:	79 3e                	jns    803544 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  803506:	48 83 c4 08          	add    $0x8,%rsp
+  80350a:	5b                   	pop    %rbx
+  80350b:	41 5c                	pop    %r12
+  80350d:	41 5d                	pop    %r13
+  80350f:	5d                   	pop    %rbp
+  803510:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803511:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  803518:	00 00 00 
+  80351b:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80351e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803520:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803524:	be 00 00 00 00       	mov    $0x0,%esi
+  803529:	bf 02 00 00 00       	mov    $0x2,%edi
+  80352e:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  803535:	00 00 00 
+  803538:	ff d0                	call   *%rax
+    if (res >= 0) {
+  80353a:	85 c0                	test   %eax,%eax
+  80353c:	78 c8                	js     803506 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  80353e:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803542:	eb c2                	jmp    803506 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803544:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  803547:	8d 51 01             	lea    0x1(%rcx),%edx
+  80354a:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80354d:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  803552:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803559:	00 00 
+  80355b:	eb a9                	jmp    803506 <devfile_trunc+0x6a>
+
+000000000080355d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80355d:	55                   	push   %rbp
+  80355e:	48 89 e5             	mov    %rsp,%rbp
+  803561:	41 57                	push   %r15
+  803563:	41 56                	push   %r14
+  803565:	41 55                	push   %r13
+  803567:	41 54                	push   %r12
+  803569:	53                   	push   %rbx
+  80356a:	48 83 ec 28          	sub    $0x28,%rsp
+  80356e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803572:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803576:	49 89 d7             	mov    %rdx,%r15
+  803579:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  80357d:	48 b8 0d 2f 80 00 00 	movabs $0x802f0d,%rax
+  803584:	00 00 00 
+  803587:	ff d0                	call   *%rax
+  803589:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  80358c:	48 85 c0             	test   %rax,%rax
+  80358f:	74 31                	je     8035c2 <devfile_write+0x65>
+  803591:	4c 89 f8             	mov    %r15,%rax
+  803594:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  80359b:	77 25                	ja     8035c2 <devfile_write+0x65>
+    size_t i = 0;
+  80359d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  8035a3:	48 85 c0             	test   %rax,%rax
+  8035a6:	0f 85 64 01 00 00    	jne    803710 <devfile_write+0x1b3>
+    size_t i = 0;
+  8035ac:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  8035b0:	4c 89 f8             	mov    %r15,%rax
+}
+  8035b3:	48 83 c4 28          	add    $0x28,%rsp
+  8035b7:	5b                   	pop    %rbx
+  8035b8:	41 5c                	pop    %r12
+  8035ba:	41 5d                	pop    %r13
+  8035bc:	41 5e                	pop    %r14
+  8035be:	41 5f                	pop    %r15
+  8035c0:	5d                   	pop    %rbp
+  8035c1:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8035c2:	48 85 db             	test   %rbx,%rbx
+  8035c5:	74 5b                	je     803622 <devfile_write+0xc5>
+  8035c7:	48 89 de             	mov    %rbx,%rsi
+  8035ca:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035ce:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  8035d5:	00 00 00 
+  8035d8:	ff d0                	call   *%rax
+  8035da:	85 c0                	test   %eax,%eax
+  8035dc:	78 40                	js     80361e <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  8035de:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035e2:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  8035e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035e9:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8035ed:	48 b8 2a 31 80 00 00 	movabs $0x80312a,%rax
+  8035f4:	00 00 00 
+  8035f7:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8035f9:	48 85 c0             	test   %rax,%rax
+  8035fc:	7e b5                	jle    8035b3 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8035fe:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803602:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  803605:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  803608:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  80360b:	8d 51 01             	lea    0x1(%rcx),%edx
+  80360e:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803611:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  803614:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80361b:	00 
+  80361c:	eb 95                	jmp    8035b3 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80361e:	48 98                	cltq
+  803620:	eb 91                	jmp    8035b3 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803622:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803626:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  803629:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80362d:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803631:	48 89 df             	mov    %rbx,%rdi
+  803634:	48 b8 2a 31 80 00 00 	movabs $0x80312a,%rax
+  80363b:	00 00 00 
+  80363e:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803640:	48 85 c0             	test   %rax,%rax
+  803643:	0f 8e 6a ff ff ff    	jle    8035b3 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803649:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  80364c:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803650:	e9 5e ff ff ff       	jmp    8035b3 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803655:	48 98                	cltq
+  803657:	4d 85 ff             	test   %r15,%r15
+  80365a:	49 0f 45 c7          	cmovne %r15,%rax
+  80365e:	e9 50 ff ff ff       	jmp    8035b3 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803663:	48 89 de             	mov    %rbx,%rsi
+  803666:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80366a:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  803671:	00 00 00 
+  803674:	ff d0                	call   *%rax
+  803676:	85 c0                	test   %eax,%eax
+  803678:	0f 88 2b 01 00 00    	js     8037a9 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80367e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803682:	4c 01 f8             	add    %r15,%rax
+  803685:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803689:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80368d:	48 b9 39 27 80 00 00 	movabs $0x802739,%rcx
+  803694:	00 00 00 
+  803697:	ff d1                	call   *%rcx
+  803699:	48 89 c2             	mov    %rax,%rdx
+  80369c:	48 c1 e2 04          	shl    $0x4,%rdx
+  8036a0:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8036a4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8036a8:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  8036ad:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  8036b0:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  8036b7:	00 
+  8036b8:	4c 89 ea             	mov    %r13,%rdx
+  8036bb:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8036bf:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  8036c6:	00 00 00 
+  8036c9:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  8036cb:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  8036cf:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8036d3:	48 39 c2             	cmp    %rax,%rdx
+  8036d6:	0f 84 db 00 00 00    	je     8037b7 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  8036dc:	4c 39 e2             	cmp    %r12,%rdx
+  8036df:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  8036e3:	4d 01 ec             	add    %r13,%r12
+  8036e6:	49 39 c4             	cmp    %rax,%r12
+  8036e9:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  8036ed:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  8036f1:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  8036f5:	45 01 ee             	add    %r13d,%r14d
+  8036f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036fc:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803700:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  803703:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803707:	49 39 c7             	cmp    %rax,%r15
+  80370a:	0f 83 a0 fe ff ff    	jae    8035b0 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803710:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803714:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  803718:	8b 43 08             	mov    0x8(%rbx),%eax
+  80371b:	44 39 f0             	cmp    %r14d,%eax
+  80371e:	7f 10                	jg     803730 <devfile_write+0x1d3>
+  803720:	48 98                	cltq
+  803722:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  803728:	49 63 d6             	movslq %r14d,%rdx
+  80372b:	48 39 d0             	cmp    %rdx,%rax
+  80372e:	7d 2d                	jge    80375d <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803730:	48 89 de             	mov    %rbx,%rsi
+  803733:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803737:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  80373e:	00 00 00 
+  803741:	ff d0                	call   *%rax
+  803743:	85 c0                	test   %eax,%eax
+  803745:	0f 88 0a ff ff ff    	js     803655 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  80374b:	44 89 f0             	mov    %r14d,%eax
+  80374e:	66 b8 00 00          	mov    $0x0,%ax
+  803752:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803755:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80375c:	00 
+        size_t off = pos - fb->fb_base;
+  80375d:	45 89 f4             	mov    %r14d,%r12d
+  803760:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803764:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803767:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  80376b:	4d 29 fd             	sub    %r15,%r13
+  80376e:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803773:	4c 29 e0             	sub    %r12,%rax
+  803776:	49 39 c5             	cmp    %rax,%r13
+  803779:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  80377d:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803781:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803785:	48 39 c2             	cmp    %rax,%rdx
+  803788:	0f 84 f0 fe ff ff    	je     80367e <devfile_write+0x121>
+  80378e:	4c 39 e0             	cmp    %r12,%rax
+  803791:	0f 82 cc fe ff ff    	jb     803663 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803797:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80379b:	48 39 d0             	cmp    %rdx,%rax
+  80379e:	0f 83 da fe ff ff    	jae    80367e <devfile_write+0x121>
+  8037a4:	e9 ba fe ff ff       	jmp    803663 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8037a9:	48 98                	cltq
+  8037ab:	4d 85 ff             	test   %r15,%r15
+  8037ae:	49 0f 45 c7          	cmovne %r15,%rax
+  8037b2:	e9 fc fd ff ff       	jmp    8035b3 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  8037b7:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  8037bb:	4c 89 e2             	mov    %r12,%rdx
+  8037be:	e9 2a ff ff ff       	jmp    8036ed <devfile_write+0x190>
+
+00000000008037c3 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8037c3:	55                   	push   %rbp
+  8037c4:	48 89 e5             	mov    %rsp,%rbp
+  8037c7:	41 57                	push   %r15
+  8037c9:	41 56                	push   %r14
+  8037cb:	41 55                	push   %r13
+  8037cd:	41 54                	push   %r12
+  8037cf:	53                   	push   %rbx
+  8037d0:	48 83 ec 28          	sub    $0x28,%rsp
+  8037d4:	49 89 ff             	mov    %rdi,%r15
+  8037d7:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8037db:	48 89 d3             	mov    %rdx,%rbx
+  8037de:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8037e2:	48 b8 0d 2f 80 00 00 	movabs $0x802f0d,%rax
+  8037e9:	00 00 00 
+  8037ec:	ff d0                	call   *%rax
+  8037ee:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8037f1:	48 85 c0             	test   %rax,%rax
+  8037f4:	74 0d                	je     803803 <devfile_read+0x40>
+  8037f6:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8037fd:	0f 86 1a 01 00 00    	jbe    80391d <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803803:	4d 85 e4             	test   %r12,%r12
+  803806:	74 1a                	je     803822 <devfile_read+0x5f>
+  803808:	4c 89 e6             	mov    %r12,%rsi
+  80380b:	4c 89 ff             	mov    %r15,%rdi
+  80380e:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  803815:	00 00 00 
+  803818:	ff d0                	call   *%rax
+  80381a:	85 c0                	test   %eax,%eax
+  80381c:	0f 88 e8 00 00 00    	js     80390a <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  803822:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  803826:	48 b8 27 30 80 00 00 	movabs $0x803027,%rax
+  80382d:	00 00 00 
+  803830:	ff d0                	call   *%rax
+  803832:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803835:	48 85 c0             	test   %rax,%rax
+  803838:	0f 84 69 02 00 00    	je     803aa7 <devfile_read+0x2e4>
+    while (i < n) {
+  80383e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803843:	0f 84 ce 00 00 00    	je     803917 <devfile_read+0x154>
+    size_t i = 0;
+  803849:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80384e:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803855:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803859:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80385d:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803861:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803865:	48 29 da             	sub    %rbx,%rdx
+  803868:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80386d:	48 39 c2             	cmp    %rax,%rdx
+  803870:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803874:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803878:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  80387c:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80387f:	01 d8                	add    %ebx,%eax
+  803881:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803885:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803889:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803890:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803897:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80389e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8038a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8038a9:	4c 89 ee             	mov    %r13,%rsi
+  8038ac:	bf 03 00 00 00       	mov    $0x3,%edi
+  8038b1:	48 b8 8d 30 80 00 00 	movabs $0x80308d,%rax
+  8038b8:	00 00 00 
+  8038bb:	ff d0                	call   *%rax
+        if (res < 0)
+  8038bd:	85 c0                	test   %eax,%eax
+  8038bf:	78 4d                	js     80390e <devfile_read+0x14b>
+        if (res == 0)
+  8038c1:	74 4f                	je     803912 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8038c3:	4c 63 e0             	movslq %eax,%r12
+  8038c6:	4c 89 e2             	mov    %r12,%rdx
+  8038c9:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8038cd:	4c 89 f7             	mov    %r14,%rdi
+  8038d0:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  8038d7:	00 00 00 
+  8038da:	ff d0                	call   *%rax
+        i += res;
+  8038dc:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8038df:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8038e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038e6:	48 39 c3             	cmp    %rax,%rbx
+  8038e9:	0f 82 72 ff ff ff    	jb     803861 <devfile_read+0x9e>
+    return i;
+  8038ef:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8038f2:	48 85 c0             	test   %rax,%rax
+  8038f5:	7e 04                	jle    8038fb <devfile_read+0x138>
+  8038f7:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8038fb:	48 83 c4 28          	add    $0x28,%rsp
+  8038ff:	5b                   	pop    %rbx
+  803900:	41 5c                	pop    %r12
+  803902:	41 5d                	pop    %r13
+  803904:	41 5e                	pop    %r14
+  803906:	41 5f                	pop    %r15
+  803908:	5d                   	pop    %rbp
+  803909:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80390a:	48 98                	cltq
+  80390c:	eb ed                	jmp    8038fb <devfile_read+0x138>
+            return res;
+  80390e:	48 98                	cltq
+  803910:	eb e9                	jmp    8038fb <devfile_read+0x138>
+            return i;
+  803912:	48 89 d8             	mov    %rbx,%rax
+  803915:	eb db                	jmp    8038f2 <devfile_read+0x12f>
+    size_t i = 0;
+  803917:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80391b:	eb d2                	jmp    8038ef <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  80391d:	48 89 c6             	mov    %rax,%rsi
+  803920:	4c 89 ff             	mov    %r15,%rdi
+  803923:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  80392a:	00 00 00 
+  80392d:	ff d0                	call   *%rax
+  80392f:	85 c0                	test   %eax,%eax
+  803931:	78 40                	js     803973 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803933:	4c 89 ff             	mov    %r15,%rdi
+  803936:	48 b8 39 27 80 00 00 	movabs $0x802739,%rax
+  80393d:	00 00 00 
+  803940:	ff d0                	call   *%rax
+  803942:	48 89 c2             	mov    %rax,%rdx
+  803945:	48 c1 e2 04          	shl    $0x4,%rdx
+  803949:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80394d:	48 c1 e0 0c          	shl    $0xc,%rax
+  803951:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803956:	48 01 d0             	add    %rdx,%rax
+  803959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80395d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803962:	0f 84 33 01 00 00    	je     803a9b <devfile_read+0x2d8>
+    size_t i = 0;
+  803968:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80396e:	e9 f5 00 00 00       	jmp    803a68 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803973:	48 98                	cltq
+  803975:	eb 84                	jmp    8038fb <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803977:	44 89 e8             	mov    %r13d,%eax
+  80397a:	66 b8 00 00          	mov    $0x0,%ax
+  80397e:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803983:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  80398a:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  80398c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803990:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803994:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803996:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80399b:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80399e:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  8039a5:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  8039a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8039ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8039b1:	ba 00 10 01 00       	mov    $0x11000,%edx
+  8039b6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039bb:	48 b8 8d 30 80 00 00 	movabs $0x80308d,%rax
+  8039c2:	00 00 00 
+  8039c5:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  8039c7:	85 c0                	test   %eax,%eax
+  8039c9:	0f 88 be 00 00 00    	js     803a8d <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  8039cf:	48 63 d0             	movslq %eax,%rdx
+  8039d2:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8039d7:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8039dc:	44 39 e8             	cmp    %r13d,%eax
+  8039df:	0f 8e ba 00 00 00    	jle    803a9f <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8039e5:	49 63 c5             	movslq %r13d,%rax
+  8039e8:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8039ed:	48 29 c3             	sub    %rax,%rbx
+  8039f0:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8039f5:	48 01 c3             	add    %rax,%rbx
+  8039f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039fc:	4c 29 f0             	sub    %r14,%rax
+  8039ff:	48 39 c3             	cmp    %rax,%rbx
+  803a02:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803a06:	4c 89 ff             	mov    %r15,%rdi
+  803a09:	48 b9 39 27 80 00 00 	movabs $0x802739,%rcx
+  803a10:	00 00 00 
+  803a13:	ff d1                	call   *%rcx
+  803a15:	48 89 c2             	mov    %rax,%rdx
+  803a18:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a1c:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803a20:	48 c1 e0 0c          	shl    $0xc,%rax
+  803a24:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  803a29:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  803a2c:	44 89 ea             	mov    %r13d,%edx
+  803a2f:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803a34:	48 63 d2             	movslq %edx,%rdx
+  803a37:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  803a3e:	00 
+  803a3f:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803a43:	4c 01 f7             	add    %r14,%rdi
+  803a46:	48 89 da             	mov    %rbx,%rdx
+  803a49:	48 b9 aa 18 80 00 00 	movabs $0x8018aa,%rcx
+  803a50:	00 00 00 
+  803a53:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803a55:	41 01 dd             	add    %ebx,%r13d
+  803a58:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  803a5c:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  803a5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a63:	49 39 c6             	cmp    %rax,%r14
+  803a66:	73 37                	jae    803a9f <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803a68:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  803a6c:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803a71:	44 39 e8             	cmp    %r13d,%eax
+  803a74:	0f 8f fd fe ff ff    	jg     803977 <devfile_read+0x1b4>
+  803a7a:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803a7f:	44 39 e8             	cmp    %r13d,%eax
+  803a82:	0f 8f 5d ff ff ff    	jg     8039e5 <devfile_read+0x222>
+  803a88:	e9 ea fe ff ff       	jmp    803977 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803a8d:	48 98                	cltq
+  803a8f:	4d 85 f6             	test   %r14,%r14
+  803a92:	49 0f 45 c6          	cmovne %r14,%rax
+  803a96:	e9 60 fe ff ff       	jmp    8038fb <devfile_read+0x138>
+    size_t i = 0;
+  803a9b:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803a9f:	4c 89 f0             	mov    %r14,%rax
+  803aa2:	e9 54 fe ff ff       	jmp    8038fb <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803aa7:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803aae:	e9 48 fe ff ff       	jmp    8038fb <devfile_read+0x138>
+
+0000000000803ab3 <open>:
+open(const char *path, int mode) {
+  803ab3:	55                   	push   %rbp
+  803ab4:	48 89 e5             	mov    %rsp,%rbp
+  803ab7:	41 55                	push   %r13
+  803ab9:	41 54                	push   %r12
+  803abb:	53                   	push   %rbx
+  803abc:	48 83 ec 18          	sub    $0x18,%rsp
+  803ac0:	49 89 fc             	mov    %rdi,%r12
+  803ac3:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803ac6:	48 b8 77 14 80 00 00 	movabs $0x801477,%rax
+  803acd:	00 00 00 
+  803ad0:	ff d0                	call   *%rax
+  803ad2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803ad8:	0f 87 8a 00 00 00    	ja     803b68 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803ade:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ae2:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  803ae9:	00 00 00 
+  803aec:	ff d0                	call   *%rax
+  803aee:	89 c3                	mov    %eax,%ebx
+  803af0:	85 c0                	test   %eax,%eax
+  803af2:	78 50                	js     803b44 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  803af4:	4c 89 e6             	mov    %r12,%rsi
+  803af7:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803afe:	00 00 00 
+  803b01:	48 89 df             	mov    %rbx,%rdi
+  803b04:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  803b0b:	00 00 00 
+  803b0e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803b10:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803b17:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b1b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b20:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  803b27:	00 00 00 
+  803b2a:	ff d0                	call   *%rax
+  803b2c:	89 c3                	mov    %eax,%ebx
+  803b2e:	85 c0                	test   %eax,%eax
+  803b30:	78 1f                	js     803b51 <open+0x9e>
+    return fd2num(fd);
+  803b32:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b36:	48 b8 39 27 80 00 00 	movabs $0x802739,%rax
+  803b3d:	00 00 00 
+  803b40:	ff d0                	call   *%rax
+  803b42:	89 c3                	mov    %eax,%ebx
+}
+  803b44:	89 d8                	mov    %ebx,%eax
+  803b46:	48 83 c4 18          	add    $0x18,%rsp
+  803b4a:	5b                   	pop    %rbx
+  803b4b:	41 5c                	pop    %r12
+  803b4d:	41 5d                	pop    %r13
+  803b4f:	5d                   	pop    %rbp
+  803b50:	c3                   	ret
+        fd_close(fd, 0);
+  803b51:	be 00 00 00 00       	mov    $0x0,%esi
+  803b56:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b5a:	48 b8 82 28 80 00 00 	movabs $0x802882,%rax
+  803b61:	00 00 00 
+  803b64:	ff d0                	call   *%rax
+        return res;
+  803b66:	eb dc                	jmp    803b44 <open+0x91>
+        return -E_BAD_PATH;
+  803b68:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803b6d:	eb d5                	jmp    803b44 <open+0x91>
+
+0000000000803b6f <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  803b6f:	55                   	push   %rbp
+  803b70:	48 89 e5             	mov    %rsp,%rbp
+  803b73:	41 57                	push   %r15
+  803b75:	41 56                	push   %r14
+  803b77:	41 55                	push   %r13
+  803b79:	41 54                	push   %r12
+  803b7b:	53                   	push   %rbx
+  803b7c:	48 83 ec 18          	sub    $0x18,%rsp
+  803b80:	41 89 f6             	mov    %esi,%r14d
+  803b83:	49 89 d7             	mov    %rdx,%r15
+  803b86:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b89:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803b8d:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  803b94:	00 00 00 
+  803b97:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b99:	85 c0                	test   %eax,%eax
+  803b9b:	0f 88 db 00 00 00    	js     803c7c <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ba1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ba5:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803bac:	00 00 00 
+  803baf:	8b 00                	mov    (%rax),%eax
+  803bb1:	39 07                	cmp    %eax,(%rdi)
+  803bb3:	0f 85 db 00 00 00    	jne    803c94 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803bb9:	45 85 f6             	test   %r14d,%r14d
+  803bbc:	0f 88 db 00 00 00    	js     803c9d <fmap+0x12e>
+  803bc2:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803bc9:	0f 85 d7 00 00 00    	jne    803ca6 <fmap+0x137>
+  803bcf:	4c 89 fb             	mov    %r15,%rbx
+  803bd2:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803bd8:	0f 85 d1 00 00 00    	jne    803caf <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803bde:	48 b8 ff 32 80 00 00 	movabs $0x8032ff,%rax
+  803be5:	00 00 00 
+  803be8:	ff d0                	call   *%rax
+  803bea:	85 c0                	test   %eax,%eax
+  803bec:	0f 88 8e 00 00 00    	js     803c80 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803bf2:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803bf9:	00 00 00 
+    while (i < n) {
+  803bfc:	4d 85 ed             	test   %r13,%r13
+  803bff:	0f 84 8a 00 00 00    	je     803c8f <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  803c05:	4c 89 ea             	mov    %r13,%rdx
+  803c08:	48 29 da             	sub    %rbx,%rdx
+  803c0b:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803c12:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803c18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803c1c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c20:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c23:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  803c27:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  803c2b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  803c30:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803c35:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803c39:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  803c3d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c42:	4c 89 e6             	mov    %r12,%rsi
+  803c45:	bf 09 00 00 00       	mov    $0x9,%edi
+  803c4a:	48 b8 8d 30 80 00 00 	movabs $0x80308d,%rax
+  803c51:	00 00 00 
+  803c54:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803c56:	85 c0                	test   %eax,%eax
+  803c58:	78 2a                	js     803c84 <fmap+0x115>
+        i += res;
+  803c5a:	48 98                	cltq
+  803c5c:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  803c5f:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803c63:	72 05                	jb     803c6a <fmap+0xfb>
+    while (i < n) {
+  803c65:	4c 39 eb             	cmp    %r13,%rbx
+  803c68:	72 9b                	jb     803c05 <fmap+0x96>
+    }
+    return i;
+  803c6a:	48 89 d8             	mov    %rbx,%rax
+}
+  803c6d:	48 83 c4 18          	add    $0x18,%rsp
+  803c71:	5b                   	pop    %rbx
+  803c72:	41 5c                	pop    %r12
+  803c74:	41 5d                	pop    %r13
+  803c76:	41 5e                	pop    %r14
+  803c78:	41 5f                	pop    %r15
+  803c7a:	5d                   	pop    %rbp
+  803c7b:	c3                   	ret
+    if (res < 0) return res;
+  803c7c:	48 98                	cltq
+  803c7e:	eb ed                	jmp    803c6d <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803c80:	48 98                	cltq
+  803c82:	eb e9                	jmp    803c6d <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803c84:	48 98                	cltq
+  803c86:	48 85 db             	test   %rbx,%rbx
+  803c89:	48 0f 45 c3          	cmovne %rbx,%rax
+  803c8d:	eb de                	jmp    803c6d <fmap+0xfe>
+    size_t i = 0;
+  803c8f:	4c 89 eb             	mov    %r13,%rbx
+  803c92:	eb d6                	jmp    803c6a <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803c94:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803c9b:	eb d0                	jmp    803c6d <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803c9d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803ca4:	eb c7                	jmp    803c6d <fmap+0xfe>
+  803ca6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803cad:	eb be                	jmp    803c6d <fmap+0xfe>
+  803caf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803cb6:	eb b5                	jmp    803c6d <fmap+0xfe>
+
+0000000000803cb8 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803cb8:	55                   	push   %rbp
+  803cb9:	48 89 e5             	mov    %rsp,%rbp
+  803cbc:	41 56                	push   %r14
+  803cbe:	41 55                	push   %r13
+  803cc0:	41 54                	push   %r12
+  803cc2:	53                   	push   %rbx
+  803cc3:	48 83 ec 10          	sub    $0x10,%rsp
+  803cc7:	89 fb                	mov    %edi,%ebx
+  803cc9:	41 89 f4             	mov    %esi,%r12d
+  803ccc:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ccf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803cd3:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  803cda:	00 00 00 
+  803cdd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cdf:	85 c0                	test   %eax,%eax
+  803ce1:	78 63                	js     803d46 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803ce3:	45 85 e4             	test   %r12d,%r12d
+  803ce6:	0f 88 80 00 00 00    	js     803d6c <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803cec:	45 89 e6             	mov    %r12d,%r14d
+  803cef:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  803cf6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cfa:	48 b8 4b 27 80 00 00 	movabs $0x80274b,%rax
+  803d01:	00 00 00 
+  803d04:	ff d0                	call   *%rax
+  803d06:	48 89 c2             	mov    %rax,%rdx
+  803d09:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803d0e:	44 89 f6             	mov    %r14d,%esi
+  803d11:	89 df                	mov    %ebx,%edi
+  803d13:	48 b8 6f 3b 80 00 00 	movabs $0x803b6f,%rax
+  803d1a:	00 00 00 
+  803d1d:	ff d0                	call   *%rax
+  803d1f:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  803d22:	45 29 f4             	sub    %r14d,%r12d
+  803d25:	4d 63 f4             	movslq %r12d,%r14
+  803d28:	49 39 c6             	cmp    %rax,%r14
+  803d2b:	7c 1d                	jl     803d4a <read_map+0x92>
+  803d2d:	48 85 c0             	test   %rax,%rax
+  803d30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d35:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803d39:	48 83 c4 10          	add    $0x10,%rsp
+  803d3d:	5b                   	pop    %rbx
+  803d3e:	41 5c                	pop    %r12
+  803d40:	41 5d                	pop    %r13
+  803d42:	41 5e                	pop    %r14
+  803d44:	5d                   	pop    %rbp
+  803d45:	c3                   	ret
+    if (res < 0) return res;
+  803d46:	48 98                	cltq
+  803d48:	eb ef                	jmp    803d39 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803d4a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d4e:	48 b8 4b 27 80 00 00 	movabs $0x80274b,%rax
+  803d55:	00 00 00 
+  803d58:	ff d0                	call   *%rax
+  803d5a:	4d 63 e4             	movslq %r12d,%r12
+  803d5d:	4c 01 e0             	add    %r12,%rax
+  803d60:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803d64:	48 89 d8             	mov    %rbx,%rax
+  803d67:	4c 29 f0             	sub    %r14,%rax
+  803d6a:	eb cd                	jmp    803d39 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803d6c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803d73:	eb c4                	jmp    803d39 <read_map+0x81>
+
+0000000000803d75 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803d75:	55                   	push   %rbp
+  803d76:	48 89 e5             	mov    %rsp,%rbp
+  803d79:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803d7d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d81:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  803d88:	00 00 00 
+  803d8b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d8d:	85 c0                	test   %eax,%eax
+  803d8f:	78 4a                	js     803ddb <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d91:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d95:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803d9c:	00 00 00 
+  803d9f:	8b 00                	mov    (%rax),%eax
+  803da1:	39 07                	cmp    %eax,(%rdi)
+  803da3:	75 38                	jne    803ddd <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803da5:	48 b8 ff 32 80 00 00 	movabs $0x8032ff,%rax
+  803dac:	00 00 00 
+  803daf:	ff d0                	call   *%rax
+  803db1:	85 c0                	test   %eax,%eax
+  803db3:	78 26                	js     803ddb <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803db5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803db9:	8b 40 0c             	mov    0xc(%rax),%eax
+  803dbc:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803dc3:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803dc5:	be 00 00 00 00       	mov    $0x0,%esi
+  803dca:	bf 06 00 00 00       	mov    $0x6,%edi
+  803dcf:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  803dd6:	00 00 00 
+  803dd9:	ff d0                	call   *%rax
+}
+  803ddb:	c9                   	leave
+  803ddc:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ddd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803de2:	eb f7                	jmp    803ddb <fsync+0x66>
+
+0000000000803de4 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803de4:	55                   	push   %rbp
+  803de5:	48 89 e5             	mov    %rsp,%rbp
+  803de8:	41 57                	push   %r15
+  803dea:	41 56                	push   %r14
+  803dec:	41 55                	push   %r13
+  803dee:	41 54                	push   %r12
+  803df0:	53                   	push   %rbx
+  803df1:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803df5:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803dfc:	00 00 00 
+  803dff:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803e04:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803e0a:	49 bd c7 27 80 00 00 	movabs $0x8027c7,%r13
+  803e11:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803e14:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803e1b:	00 00 00 
+  803e1e:	eb 0c                	jmp    803e2c <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803e20:	83 c3 01             	add    $0x1,%ebx
+  803e23:	49 83 c4 28          	add    $0x28,%r12
+  803e27:	83 fb 20             	cmp    $0x20,%ebx
+  803e2a:	74 33                	je     803e5f <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803e2c:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803e31:	74 ed                	je     803e20 <flushall+0x3c>
+  803e33:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803e37:	89 df                	mov    %ebx,%edi
+  803e39:	41 ff d5             	call   *%r13
+  803e3c:	85 c0                	test   %eax,%eax
+  803e3e:	78 e0                	js     803e20 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803e40:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803e44:	41 8b 06             	mov    (%r14),%eax
+  803e47:	39 07                	cmp    %eax,(%rdi)
+  803e49:	75 d5                	jne    803e20 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803e4b:	48 b8 ff 32 80 00 00 	movabs $0x8032ff,%rax
+  803e52:	00 00 00 
+  803e55:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803e57:	85 c0                	test   %eax,%eax
+  803e59:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803e5d:	eb c1                	jmp    803e20 <flushall+0x3c>
+    }
+    return res;
+}
+  803e5f:	44 89 f8             	mov    %r15d,%eax
+  803e62:	48 83 c4 18          	add    $0x18,%rsp
+  803e66:	5b                   	pop    %rbx
+  803e67:	41 5c                	pop    %r12
+  803e69:	41 5d                	pop    %r13
+  803e6b:	41 5e                	pop    %r14
+  803e6d:	41 5f                	pop    %r15
+  803e6f:	5d                   	pop    %rbp
+  803e70:	c3                   	ret
+
+0000000000803e71 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803e71:	55                   	push   %rbp
+  803e72:	48 89 e5             	mov    %rsp,%rbp
+  803e75:	53                   	push   %rbx
+  803e76:	48 83 ec 08          	sub    $0x8,%rsp
+  803e7a:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803e7d:	40 0f b6 c6          	movzbl %sil,%eax
+  803e81:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803e88:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803e8a:	be 00 00 00 00       	mov    $0x0,%esi
+  803e8f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803e94:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  803e9b:	00 00 00 
+  803e9e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ea0:	85 c0                	test   %eax,%eax
+  803ea2:	78 23                	js     803ec7 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803ea4:	ba 58 06 00 00       	mov    $0x658,%edx
+  803ea9:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803eb0:	00 00 00 
+  803eb3:	48 89 df             	mov    %rbx,%rdi
+  803eb6:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  803ebd:	00 00 00 
+  803ec0:	ff d0                	call   *%rax
+    return 0;
+  803ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ec7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ecb:	c9                   	leave
+  803ecc:	c3                   	ret
+
+0000000000803ecd <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803ecd:	55                   	push   %rbp
+  803ece:	48 89 e5             	mov    %rsp,%rbp
+  803ed1:	53                   	push   %rbx
+  803ed2:	48 83 ec 08          	sub    $0x8,%rsp
+  803ed6:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803ed9:	48 b8 77 14 80 00 00 	movabs $0x801477,%rax
+  803ee0:	00 00 00 
+  803ee3:	ff d0                	call   *%rax
+  803ee5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803eeb:	77 35                	ja     803f22 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803eed:	48 89 de             	mov    %rbx,%rsi
+  803ef0:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803ef7:	00 00 00 
+  803efa:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  803f01:	00 00 00 
+  803f04:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803f06:	be 00 00 00 00       	mov    $0x0,%esi
+  803f0b:	bf 07 00 00 00       	mov    $0x7,%edi
+  803f10:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  803f17:	00 00 00 
+  803f1a:	ff d0                	call   *%rax
+}
+  803f1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f20:	c9                   	leave
+  803f21:	c3                   	ret
+        return -E_BAD_PATH;
+  803f22:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f27:	eb f3                	jmp    803f1c <remove+0x4f>
+
+0000000000803f29 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803f29:	55                   	push   %rbp
+  803f2a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803f2d:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  803f34:	00 00 00 
+  803f37:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803f39:	be 00 00 00 00       	mov    $0x0,%esi
+  803f3e:	bf 08 00 00 00       	mov    $0x8,%edi
+  803f43:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  803f4a:	00 00 00 
+  803f4d:	ff d0                	call   *%rax
+}
+  803f4f:	5d                   	pop    %rbp
+  803f50:	c3                   	ret
+
+0000000000803f51 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803f51:	55                   	push   %rbp
+  803f52:	48 89 e5             	mov    %rsp,%rbp
+  803f55:	41 54                	push   %r12
+  803f57:	53                   	push   %rbx
+  803f58:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f5b:	48 b8 4b 27 80 00 00 	movabs $0x80274b,%rax
+  803f62:	00 00 00 
+  803f65:	ff d0                	call   *%rax
+  803f67:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803f6a:	48 be c0 58 80 00 00 	movabs $0x8058c0,%rsi
+  803f71:	00 00 00 
+  803f74:	48 89 df             	mov    %rbx,%rdi
+  803f77:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  803f7e:	00 00 00 
+  803f81:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803f83:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803f88:	41 2b 04 24          	sub    (%r12),%eax
+  803f8c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803f92:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803f99:	00 00 00 
+    stat->st_dev = &devpipe;
+  803f9c:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803fa3:	00 00 00 
+  803fa6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb2:	5b                   	pop    %rbx
+  803fb3:	41 5c                	pop    %r12
+  803fb5:	5d                   	pop    %rbp
+  803fb6:	c3                   	ret
+
+0000000000803fb7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803fb7:	55                   	push   %rbp
+  803fb8:	48 89 e5             	mov    %rsp,%rbp
+  803fbb:	41 54                	push   %r12
+  803fbd:	53                   	push   %rbx
+  803fbe:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803fc1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc6:	48 89 fe             	mov    %rdi,%rsi
+  803fc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fce:	49 bc f4 1d 80 00 00 	movabs $0x801df4,%r12
+  803fd5:	00 00 00 
+  803fd8:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803fdb:	48 89 df             	mov    %rbx,%rdi
+  803fde:	48 b8 4b 27 80 00 00 	movabs $0x80274b,%rax
+  803fe5:	00 00 00 
+  803fe8:	ff d0                	call   *%rax
+  803fea:	48 89 c6             	mov    %rax,%rsi
+  803fed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ff2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ff7:	41 ff d4             	call   *%r12
+}
+  803ffa:	5b                   	pop    %rbx
+  803ffb:	41 5c                	pop    %r12
+  803ffd:	5d                   	pop    %rbp
+  803ffe:	c3                   	ret
+
+0000000000803fff <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803fff:	55                   	push   %rbp
+  804000:	48 89 e5             	mov    %rsp,%rbp
+  804003:	41 57                	push   %r15
+  804005:	41 56                	push   %r14
+  804007:	41 55                	push   %r13
+  804009:	41 54                	push   %r12
+  80400b:	53                   	push   %rbx
+  80400c:	48 83 ec 18          	sub    $0x18,%rsp
+  804010:	49 89 fc             	mov    %rdi,%r12
+  804013:	49 89 f5             	mov    %rsi,%r13
+  804016:	49 89 d7             	mov    %rdx,%r15
+  804019:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80401d:	48 b8 4b 27 80 00 00 	movabs $0x80274b,%rax
+  804024:	00 00 00 
+  804027:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804029:	4d 85 ff             	test   %r15,%r15
+  80402c:	0f 84 af 00 00 00    	je     8040e1 <devpipe_write+0xe2>
+  804032:	48 89 c3             	mov    %rax,%rbx
+  804035:	4c 89 f8             	mov    %r15,%rax
+  804038:	4d 89 ef             	mov    %r13,%r15
+  80403b:	4c 01 e8             	add    %r13,%rax
+  80403e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804042:	49 bd e9 1b 80 00 00 	movabs $0x801be9,%r13
+  804049:	00 00 00 
+            sys_yield();
+  80404c:	49 be 86 1b 80 00 00 	movabs $0x801b86,%r14
+  804053:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804056:	8b 73 04             	mov    0x4(%rbx),%esi
+  804059:	48 63 ce             	movslq %esi,%rcx
+  80405c:	48 63 03             	movslq (%rbx),%rax
+  80405f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804065:	48 39 c1             	cmp    %rax,%rcx
+  804068:	72 2e                	jb     804098 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80406a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80406f:	48 89 da             	mov    %rbx,%rdx
+  804072:	be 00 10 00 00       	mov    $0x1000,%esi
+  804077:	4c 89 e7             	mov    %r12,%rdi
+  80407a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80407d:	85 c0                	test   %eax,%eax
+  80407f:	74 66                	je     8040e7 <devpipe_write+0xe8>
+            sys_yield();
+  804081:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804084:	8b 73 04             	mov    0x4(%rbx),%esi
+  804087:	48 63 ce             	movslq %esi,%rcx
+  80408a:	48 63 03             	movslq (%rbx),%rax
+  80408d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804093:	48 39 c1             	cmp    %rax,%rcx
+  804096:	73 d2                	jae    80406a <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804098:	41 0f b6 3f          	movzbl (%r15),%edi
+  80409c:	48 89 ca             	mov    %rcx,%rdx
+  80409f:	48 c1 ea 03          	shr    $0x3,%rdx
+  8040a3:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8040aa:	08 10 20 
+  8040ad:	48 f7 e2             	mul    %rdx
+  8040b0:	48 c1 ea 06          	shr    $0x6,%rdx
+  8040b4:	48 89 d0             	mov    %rdx,%rax
+  8040b7:	48 c1 e0 09          	shl    $0x9,%rax
+  8040bb:	48 29 d0             	sub    %rdx,%rax
+  8040be:	48 c1 e0 03          	shl    $0x3,%rax
+  8040c2:	48 29 c1             	sub    %rax,%rcx
+  8040c5:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8040ca:	83 c6 01             	add    $0x1,%esi
+  8040cd:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8040d0:	49 83 c7 01          	add    $0x1,%r15
+  8040d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040d8:	49 39 c7             	cmp    %rax,%r15
+  8040db:	0f 85 75 ff ff ff    	jne    804056 <devpipe_write+0x57>
+    return n;
+  8040e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040e5:	eb 05                	jmp    8040ec <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8040e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040ec:	48 83 c4 18          	add    $0x18,%rsp
+  8040f0:	5b                   	pop    %rbx
+  8040f1:	41 5c                	pop    %r12
+  8040f3:	41 5d                	pop    %r13
+  8040f5:	41 5e                	pop    %r14
+  8040f7:	41 5f                	pop    %r15
+  8040f9:	5d                   	pop    %rbp
+  8040fa:	c3                   	ret
+
+00000000008040fb <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040fb:	55                   	push   %rbp
+  8040fc:	48 89 e5             	mov    %rsp,%rbp
+  8040ff:	41 57                	push   %r15
+  804101:	41 56                	push   %r14
+  804103:	41 55                	push   %r13
+  804105:	41 54                	push   %r12
+  804107:	53                   	push   %rbx
+  804108:	48 83 ec 18          	sub    $0x18,%rsp
+  80410c:	49 89 fc             	mov    %rdi,%r12
+  80410f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804113:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804117:	48 b8 4b 27 80 00 00 	movabs $0x80274b,%rax
+  80411e:	00 00 00 
+  804121:	ff d0                	call   *%rax
+  804123:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804126:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80412c:	49 bd e9 1b 80 00 00 	movabs $0x801be9,%r13
+  804133:	00 00 00 
+            sys_yield();
+  804136:	49 be 86 1b 80 00 00 	movabs $0x801b86,%r14
+  80413d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804140:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804145:	74 7d                	je     8041c4 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804147:	8b 03                	mov    (%rbx),%eax
+  804149:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80414c:	75 26                	jne    804174 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80414e:	4d 85 ff             	test   %r15,%r15
+  804151:	75 77                	jne    8041ca <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804153:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804158:	48 89 da             	mov    %rbx,%rdx
+  80415b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804160:	4c 89 e7             	mov    %r12,%rdi
+  804163:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804166:	85 c0                	test   %eax,%eax
+  804168:	74 72                	je     8041dc <devpipe_read+0xe1>
+            sys_yield();
+  80416a:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80416d:	8b 03                	mov    (%rbx),%eax
+  80416f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804172:	74 df                	je     804153 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804174:	48 63 c8             	movslq %eax,%rcx
+  804177:	48 89 ca             	mov    %rcx,%rdx
+  80417a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80417e:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804185:	08 10 20 
+  804188:	48 89 d0             	mov    %rdx,%rax
+  80418b:	48 f7 e6             	mul    %rsi
+  80418e:	48 c1 ea 06          	shr    $0x6,%rdx
+  804192:	48 89 d0             	mov    %rdx,%rax
+  804195:	48 c1 e0 09          	shl    $0x9,%rax
+  804199:	48 29 d0             	sub    %rdx,%rax
+  80419c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8041a3:	00 
+  8041a4:	48 89 c8             	mov    %rcx,%rax
+  8041a7:	48 29 d0             	sub    %rdx,%rax
+  8041aa:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8041af:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8041b3:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8041b7:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8041ba:	49 83 c7 01          	add    $0x1,%r15
+  8041be:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8041c2:	75 83                	jne    804147 <devpipe_read+0x4c>
+    return n;
+  8041c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041c8:	eb 03                	jmp    8041cd <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8041ca:	4c 89 f8             	mov    %r15,%rax
+}
+  8041cd:	48 83 c4 18          	add    $0x18,%rsp
+  8041d1:	5b                   	pop    %rbx
+  8041d2:	41 5c                	pop    %r12
+  8041d4:	41 5d                	pop    %r13
+  8041d6:	41 5e                	pop    %r14
+  8041d8:	41 5f                	pop    %r15
+  8041da:	5d                   	pop    %rbp
+  8041db:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8041dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e1:	eb ea                	jmp    8041cd <devpipe_read+0xd2>
+
+00000000008041e3 <pipe>:
+pipe(int pfd[2]) {
+  8041e3:	55                   	push   %rbp
+  8041e4:	48 89 e5             	mov    %rsp,%rbp
+  8041e7:	41 55                	push   %r13
+  8041e9:	41 54                	push   %r12
+  8041eb:	53                   	push   %rbx
+  8041ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8041f0:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8041f3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8041f7:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  8041fe:	00 00 00 
+  804201:	ff d0                	call   *%rax
+  804203:	89 c3                	mov    %eax,%ebx
+  804205:	85 c0                	test   %eax,%eax
+  804207:	0f 88 a0 01 00 00    	js     8043ad <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80420d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804212:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804217:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80421b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804220:	48 b8 15 1c 80 00 00 	movabs $0x801c15,%rax
+  804227:	00 00 00 
+  80422a:	ff d0                	call   *%rax
+  80422c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80422e:	85 c0                	test   %eax,%eax
+  804230:	0f 88 77 01 00 00    	js     8043ad <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804236:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80423a:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  804241:	00 00 00 
+  804244:	ff d0                	call   *%rax
+  804246:	89 c3                	mov    %eax,%ebx
+  804248:	85 c0                	test   %eax,%eax
+  80424a:	0f 88 43 01 00 00    	js     804393 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804250:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804255:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80425a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80425e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804263:	48 b8 15 1c 80 00 00 	movabs $0x801c15,%rax
+  80426a:	00 00 00 
+  80426d:	ff d0                	call   *%rax
+  80426f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804271:	85 c0                	test   %eax,%eax
+  804273:	0f 88 1a 01 00 00    	js     804393 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804279:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80427d:	48 b8 4b 27 80 00 00 	movabs $0x80274b,%rax
+  804284:	00 00 00 
+  804287:	ff d0                	call   *%rax
+  804289:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80428c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804291:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804296:	48 89 c6             	mov    %rax,%rsi
+  804299:	bf 00 00 00 00       	mov    $0x0,%edi
+  80429e:	48 b8 15 1c 80 00 00 	movabs $0x801c15,%rax
+  8042a5:	00 00 00 
+  8042a8:	ff d0                	call   *%rax
+  8042aa:	89 c3                	mov    %eax,%ebx
+  8042ac:	85 c0                	test   %eax,%eax
+  8042ae:	0f 88 c5 00 00 00    	js     804379 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8042b4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8042b8:	48 b8 4b 27 80 00 00 	movabs $0x80274b,%rax
+  8042bf:	00 00 00 
+  8042c2:	ff d0                	call   *%rax
+  8042c4:	48 89 c1             	mov    %rax,%rcx
+  8042c7:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8042cd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8042d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042d8:	4c 89 ee             	mov    %r13,%rsi
+  8042db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042e0:	48 b8 7c 1c 80 00 00 	movabs $0x801c7c,%rax
+  8042e7:	00 00 00 
+  8042ea:	ff d0                	call   *%rax
+  8042ec:	89 c3                	mov    %eax,%ebx
+  8042ee:	85 c0                	test   %eax,%eax
+  8042f0:	78 6e                	js     804360 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8042f2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042f7:	4c 89 ef             	mov    %r13,%rdi
+  8042fa:	48 b8 b7 1b 80 00 00 	movabs $0x801bb7,%rax
+  804301:	00 00 00 
+  804304:	ff d0                	call   *%rax
+  804306:	83 f8 02             	cmp    $0x2,%eax
+  804309:	0f 85 ab 00 00 00    	jne    8043ba <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80430f:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804316:	00 00 
+  804318:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80431c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80431e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804322:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804329:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80432d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80432f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804333:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80433a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80433e:	48 bb 39 27 80 00 00 	movabs $0x802739,%rbx
+  804345:	00 00 00 
+  804348:	ff d3                	call   *%rbx
+  80434a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80434e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804352:	ff d3                	call   *%rbx
+  804354:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804359:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80435e:	eb 4d                	jmp    8043ad <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804360:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804365:	4c 89 ee             	mov    %r13,%rsi
+  804368:	bf 00 00 00 00       	mov    $0x0,%edi
+  80436d:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  804374:	00 00 00 
+  804377:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804379:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80437e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804382:	bf 00 00 00 00       	mov    $0x0,%edi
+  804387:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  80438e:	00 00 00 
+  804391:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804393:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804398:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80439c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043a1:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  8043a8:	00 00 00 
+  8043ab:	ff d0                	call   *%rax
+}
+  8043ad:	89 d8                	mov    %ebx,%eax
+  8043af:	48 83 c4 18          	add    $0x18,%rsp
+  8043b3:	5b                   	pop    %rbx
+  8043b4:	41 5c                	pop    %r12
+  8043b6:	41 5d                	pop    %r13
+  8043b8:	5d                   	pop    %rbp
+  8043b9:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8043ba:	48 b9 d8 58 80 00 00 	movabs $0x8058d8,%rcx
+  8043c1:	00 00 00 
+  8043c4:	48 ba 62 50 80 00 00 	movabs $0x805062,%rdx
+  8043cb:	00 00 00 
+  8043ce:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8043d3:	48 bf c7 58 80 00 00 	movabs $0x8058c7,%rdi
+  8043da:	00 00 00 
+  8043dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e2:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  8043e9:	00 00 00 
+  8043ec:	41 ff d0             	call   *%r8
+
+00000000008043ef <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8043ef:	55                   	push   %rbp
+  8043f0:	48 89 e5             	mov    %rsp,%rbp
+  8043f3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043f7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043fb:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  804402:	00 00 00 
+  804405:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804407:	85 c0                	test   %eax,%eax
+  804409:	78 35                	js     804440 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80440b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80440f:	48 b8 4b 27 80 00 00 	movabs $0x80274b,%rax
+  804416:	00 00 00 
+  804419:	ff d0                	call   *%rax
+  80441b:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80441e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804423:	be 00 10 00 00       	mov    $0x1000,%esi
+  804428:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80442c:	48 b8 e9 1b 80 00 00 	movabs $0x801be9,%rax
+  804433:	00 00 00 
+  804436:	ff d0                	call   *%rax
+  804438:	85 c0                	test   %eax,%eax
+  80443a:	0f 94 c0             	sete   %al
+  80443d:	0f b6 c0             	movzbl %al,%eax
+}
+  804440:	c9                   	leave
+  804441:	c3                   	ret
+
+0000000000804442 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804442:	55                   	push   %rbp
+  804443:	48 89 e5             	mov    %rsp,%rbp
+  804446:	41 55                	push   %r13
+  804448:	41 54                	push   %r12
+  80444a:	53                   	push   %rbx
+  80444b:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  80444f:	85 ff                	test   %edi,%edi
+  804451:	74 73                	je     8044c6 <wait+0x84>
+  804453:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804456:	89 f8                	mov    %edi,%eax
+  804458:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  80445d:	89 f9                	mov    %edi,%ecx
+  80445f:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804465:	48 69 c9 68 01 00 00 	imul   $0x168,%rcx,%rcx
+  80446c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804473:	00 00 00 
+  804476:	48 01 ca             	add    %rcx,%rdx
+  804479:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80447f:	39 d7                	cmp    %edx,%edi
+  804481:	75 38                	jne    8044bb <wait+0x79>
+           env->env_status != ENV_FREE) {
+  804483:	48 98                	cltq
+  804485:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80448c:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804493:	00 00 00 
+  804496:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  804499:	49 bd 86 1b 80 00 00 	movabs $0x801b86,%r13
+  8044a0:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8044a3:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  8044a9:	85 c0                	test   %eax,%eax
+  8044ab:	74 0e                	je     8044bb <wait+0x79>
+        sys_yield();
+  8044ad:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8044b0:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8044b6:	44 39 e0             	cmp    %r12d,%eax
+  8044b9:	74 e8                	je     8044a3 <wait+0x61>
+    }
+}
+  8044bb:	48 83 c4 08          	add    $0x8,%rsp
+  8044bf:	5b                   	pop    %rbx
+  8044c0:	41 5c                	pop    %r12
+  8044c2:	41 5d                	pop    %r13
+  8044c4:	5d                   	pop    %rbp
+  8044c5:	c3                   	ret
+    assert(envid != 0);
+  8044c6:	48 b9 fc 58 80 00 00 	movabs $0x8058fc,%rcx
+  8044cd:	00 00 00 
+  8044d0:	48 ba 62 50 80 00 00 	movabs $0x805062,%rdx
+  8044d7:	00 00 00 
+  8044da:	be 06 00 00 00       	mov    $0x6,%esi
+  8044df:	48 bf 07 59 80 00 00 	movabs $0x805907,%rdi
+  8044e6:	00 00 00 
+  8044e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044ee:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  8044f5:	00 00 00 
+  8044f8:	41 ff d0             	call   *%r8
+
+00000000008044fb <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8044fb:	48 89 f8             	mov    %rdi,%rax
+  8044fe:	48 c1 e8 27          	shr    $0x27,%rax
+  804502:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804509:	7f 00 00 
+  80450c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804510:	f6 c2 01             	test   $0x1,%dl
+  804513:	74 6d                	je     804582 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804515:	48 89 f8             	mov    %rdi,%rax
+  804518:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80451c:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804523:	7f 00 00 
+  804526:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80452a:	f6 c2 01             	test   $0x1,%dl
+  80452d:	74 62                	je     804591 <get_uvpt_entry+0x96>
+  80452f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804536:	7f 00 00 
+  804539:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80453d:	f6 c2 80             	test   $0x80,%dl
+  804540:	75 4f                	jne    804591 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804542:	48 89 f8             	mov    %rdi,%rax
+  804545:	48 c1 e8 15          	shr    $0x15,%rax
+  804549:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804550:	7f 00 00 
+  804553:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804557:	f6 c2 01             	test   $0x1,%dl
+  80455a:	74 44                	je     8045a0 <get_uvpt_entry+0xa5>
+  80455c:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804563:	7f 00 00 
+  804566:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80456a:	f6 c2 80             	test   $0x80,%dl
+  80456d:	75 31                	jne    8045a0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80456f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804573:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80457a:	7f 00 00 
+  80457d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804581:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804582:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804589:	7f 00 00 
+  80458c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804590:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804591:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804598:	7f 00 00 
+  80459b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80459f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8045a0:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8045a7:	7f 00 00 
+  8045aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045ae:	c3                   	ret
+
+00000000008045af <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8045af:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8045b2:	48 89 f9             	mov    %rdi,%rcx
+  8045b5:	48 c1 e9 27          	shr    $0x27,%rcx
+  8045b9:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8045c0:	7f 00 00 
+  8045c3:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8045c7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8045ce:	f6 c1 01             	test   $0x1,%cl
+  8045d1:	0f 84 b2 00 00 00    	je     804689 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8045d7:	48 89 f9             	mov    %rdi,%rcx
+  8045da:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8045de:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8045e5:	7f 00 00 
+  8045e8:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8045ec:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8045f3:	40 f6 c6 01          	test   $0x1,%sil
+  8045f7:	0f 84 8c 00 00 00    	je     804689 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8045fd:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804604:	7f 00 00 
+  804607:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80460b:	a8 80                	test   $0x80,%al
+  80460d:	75 7b                	jne    80468a <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80460f:	48 89 f9             	mov    %rdi,%rcx
+  804612:	48 c1 e9 15          	shr    $0x15,%rcx
+  804616:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80461d:	7f 00 00 
+  804620:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804624:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  80462b:	40 f6 c6 01          	test   $0x1,%sil
+  80462f:	74 58                	je     804689 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  804631:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804638:	7f 00 00 
+  80463b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80463f:	a8 80                	test   $0x80,%al
+  804641:	75 6c                	jne    8046af <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804643:	48 89 f9             	mov    %rdi,%rcx
+  804646:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80464a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804651:	7f 00 00 
+  804654:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804658:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80465f:	40 f6 c6 01          	test   $0x1,%sil
+  804663:	74 24                	je     804689 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804665:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80466c:	7f 00 00 
+  80466f:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804673:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80467a:	ff ff 7f 
+  80467d:	48 21 c8             	and    %rcx,%rax
+  804680:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804686:	48 09 d0             	or     %rdx,%rax
+}
+  804689:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80468a:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804691:	7f 00 00 
+  804694:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804698:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80469f:	ff ff 7f 
+  8046a2:	48 21 c8             	and    %rcx,%rax
+  8046a5:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8046ab:	48 01 d0             	add    %rdx,%rax
+  8046ae:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8046af:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8046b6:	7f 00 00 
+  8046b9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8046bd:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8046c4:	ff ff 7f 
+  8046c7:	48 21 c8             	and    %rcx,%rax
+  8046ca:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8046d0:	48 01 d0             	add    %rdx,%rax
+  8046d3:	c3                   	ret
+
+00000000008046d4 <get_prot>:
+
+int
+get_prot(void *va) {
+  8046d4:	55                   	push   %rbp
+  8046d5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8046d8:	48 b8 fb 44 80 00 00 	movabs $0x8044fb,%rax
+  8046df:	00 00 00 
+  8046e2:	ff d0                	call   *%rax
+  8046e4:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8046e7:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8046ec:	89 c1                	mov    %eax,%ecx
+  8046ee:	83 c9 04             	or     $0x4,%ecx
+  8046f1:	f6 c2 01             	test   $0x1,%dl
+  8046f4:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8046f7:	89 c1                	mov    %eax,%ecx
+  8046f9:	83 c9 02             	or     $0x2,%ecx
+  8046fc:	f6 c2 02             	test   $0x2,%dl
+  8046ff:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804702:	89 c1                	mov    %eax,%ecx
+  804704:	83 c9 01             	or     $0x1,%ecx
+  804707:	48 85 d2             	test   %rdx,%rdx
+  80470a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80470d:	89 c1                	mov    %eax,%ecx
+  80470f:	83 c9 40             	or     $0x40,%ecx
+  804712:	f6 c6 04             	test   $0x4,%dh
+  804715:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804718:	5d                   	pop    %rbp
+  804719:	c3                   	ret
+
+000000000080471a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80471a:	55                   	push   %rbp
+  80471b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80471e:	48 b8 fb 44 80 00 00 	movabs $0x8044fb,%rax
+  804725:	00 00 00 
+  804728:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80472a:	48 c1 e8 06          	shr    $0x6,%rax
+  80472e:	83 e0 01             	and    $0x1,%eax
+}
+  804731:	5d                   	pop    %rbp
+  804732:	c3                   	ret
+
+0000000000804733 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804733:	55                   	push   %rbp
+  804734:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804737:	48 b8 fb 44 80 00 00 	movabs $0x8044fb,%rax
+  80473e:	00 00 00 
+  804741:	ff d0                	call   *%rax
+  804743:	83 e0 01             	and    $0x1,%eax
+}
+  804746:	5d                   	pop    %rbp
+  804747:	c3                   	ret
+
+0000000000804748 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804748:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80474f:	7f 00 00 
+  804752:	a8 01                	test   $0x1,%al
+  804754:	75 06                	jne    80475c <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80475b:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80475c:	55                   	push   %rbp
+  80475d:	48 89 e5             	mov    %rsp,%rbp
+  804760:	41 57                	push   %r15
+  804762:	41 56                	push   %r14
+  804764:	41 55                	push   %r13
+  804766:	41 54                	push   %r12
+  804768:	53                   	push   %rbx
+  804769:	48 83 ec 18          	sub    $0x18,%rsp
+  80476d:	49 89 fe             	mov    %rdi,%r14
+  804770:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804773:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80477a:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80477b:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804782:	7f 00 00 
+  804785:	e9 81 00 00 00       	jmp    80480b <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  80478a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804791:	49 39 dd             	cmp    %rbx,%r13
+  804794:	74 2b                	je     8047c1 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804796:	48 89 d8             	mov    %rbx,%rax
+  804799:	48 c1 e8 0c          	shr    $0xc,%rax
+  80479d:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  8047a1:	f6 c2 01             	test   $0x1,%dl
+  8047a4:	74 e4                	je     80478a <foreach_shared_region+0x42>
+  8047a6:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  8047aa:	f6 c4 04             	test   $0x4,%ah
+  8047ad:	74 db                	je     80478a <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  8047af:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8047b6:	4c 89 fa             	mov    %r15,%rdx
+  8047b9:	48 89 df             	mov    %rbx,%rdi
+  8047bc:	41 ff d6             	call   *%r14
+  8047bf:	eb c9                	jmp    80478a <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8047c1:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  8047c8:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  8047cc:	74 22                	je     8047f0 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  8047ce:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  8047d5:	48 89 d8             	mov    %rbx,%rax
+  8047d8:	48 c1 e8 15          	shr    $0x15,%rax
+  8047dc:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  8047e3:	7f 00 00 
+  8047e6:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8047ea:	a8 01                	test   $0x1,%al
+  8047ec:	74 d3                	je     8047c1 <foreach_shared_region+0x79>
+  8047ee:	eb a6                	jmp    804796 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8047f0:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  8047f7:	40 
+  8047f8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8047fc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804803:	00 00 00 
+  804806:	48 39 c1             	cmp    %rax,%rcx
+  804809:	74 31                	je     80483c <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  80480b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80480f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804813:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  80481a:	7f 00 00 
+  80481d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804821:	a8 01                	test   $0x1,%al
+  804823:	74 cb                	je     8047f0 <foreach_shared_region+0xa8>
+  804825:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804829:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804830:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  804836:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80483a:	eb 92                	jmp    8047ce <foreach_shared_region+0x86>
+}
+  80483c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804841:	48 83 c4 18          	add    $0x18,%rsp
+  804845:	5b                   	pop    %rbx
+  804846:	41 5c                	pop    %r12
+  804848:	41 5d                	pop    %r13
+  80484a:	41 5e                	pop    %r14
+  80484c:	41 5f                	pop    %r15
+  80484e:	5d                   	pop    %rbp
+  80484f:	c3                   	ret
+
+0000000000804850 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804850:	b8 00 00 00 00       	mov    $0x0,%eax
+  804855:	c3                   	ret
+
+0000000000804856 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804856:	55                   	push   %rbp
+  804857:	48 89 e5             	mov    %rsp,%rbp
+  80485a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80485d:	48 be 12 59 80 00 00 	movabs $0x805912,%rsi
+  804864:	00 00 00 
+  804867:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  80486e:	00 00 00 
+  804871:	ff d0                	call   *%rax
+    return 0;
+}
+  804873:	b8 00 00 00 00       	mov    $0x0,%eax
+  804878:	5d                   	pop    %rbp
+  804879:	c3                   	ret
+
+000000000080487a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80487a:	55                   	push   %rbp
+  80487b:	48 89 e5             	mov    %rsp,%rbp
+  80487e:	41 57                	push   %r15
+  804880:	41 56                	push   %r14
+  804882:	41 55                	push   %r13
+  804884:	41 54                	push   %r12
+  804886:	53                   	push   %rbx
+  804887:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80488e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804895:	48 85 d2             	test   %rdx,%rdx
+  804898:	74 7a                	je     804914 <devcons_write+0x9a>
+  80489a:	49 89 d6             	mov    %rdx,%r14
+  80489d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8048a3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8048a8:	49 bf 43 18 80 00 00 	movabs $0x801843,%r15
+  8048af:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8048b2:	4c 89 f3             	mov    %r14,%rbx
+  8048b5:	48 29 f3             	sub    %rsi,%rbx
+  8048b8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8048bd:	48 39 c3             	cmp    %rax,%rbx
+  8048c0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8048c4:	4c 63 eb             	movslq %ebx,%r13
+  8048c7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8048ce:	48 01 c6             	add    %rax,%rsi
+  8048d1:	4c 89 ea             	mov    %r13,%rdx
+  8048d4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8048db:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8048de:	4c 89 ee             	mov    %r13,%rsi
+  8048e1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8048e8:	48 b8 8c 1a 80 00 00 	movabs $0x801a8c,%rax
+  8048ef:	00 00 00 
+  8048f2:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8048f4:	41 01 dc             	add    %ebx,%r12d
+  8048f7:	49 63 f4             	movslq %r12d,%rsi
+  8048fa:	4c 39 f6             	cmp    %r14,%rsi
+  8048fd:	72 b3                	jb     8048b2 <devcons_write+0x38>
+    return res;
+  8048ff:	49 63 c4             	movslq %r12d,%rax
+}
+  804902:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804909:	5b                   	pop    %rbx
+  80490a:	41 5c                	pop    %r12
+  80490c:	41 5d                	pop    %r13
+  80490e:	41 5e                	pop    %r14
+  804910:	41 5f                	pop    %r15
+  804912:	5d                   	pop    %rbp
+  804913:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804914:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80491a:	eb e3                	jmp    8048ff <devcons_write+0x85>
+
+000000000080491c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80491c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80491f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804924:	48 85 c0             	test   %rax,%rax
+  804927:	74 55                	je     80497e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804929:	55                   	push   %rbp
+  80492a:	48 89 e5             	mov    %rsp,%rbp
+  80492d:	41 55                	push   %r13
+  80492f:	41 54                	push   %r12
+  804931:	53                   	push   %rbx
+  804932:	48 83 ec 08          	sub    $0x8,%rsp
+  804936:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804939:	48 bb b9 1a 80 00 00 	movabs $0x801ab9,%rbx
+  804940:	00 00 00 
+  804943:	49 bc 86 1b 80 00 00 	movabs $0x801b86,%r12
+  80494a:	00 00 00 
+  80494d:	eb 03                	jmp    804952 <devcons_read+0x36>
+  80494f:	41 ff d4             	call   *%r12
+  804952:	ff d3                	call   *%rbx
+  804954:	85 c0                	test   %eax,%eax
+  804956:	74 f7                	je     80494f <devcons_read+0x33>
+    if (c < 0) return c;
+  804958:	48 63 d0             	movslq %eax,%rdx
+  80495b:	78 13                	js     804970 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80495d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804962:	83 f8 04             	cmp    $0x4,%eax
+  804965:	74 09                	je     804970 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804967:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80496b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804970:	48 89 d0             	mov    %rdx,%rax
+  804973:	48 83 c4 08          	add    $0x8,%rsp
+  804977:	5b                   	pop    %rbx
+  804978:	41 5c                	pop    %r12
+  80497a:	41 5d                	pop    %r13
+  80497c:	5d                   	pop    %rbp
+  80497d:	c3                   	ret
+  80497e:	48 89 d0             	mov    %rdx,%rax
+  804981:	c3                   	ret
+
+0000000000804982 <cputchar>:
+cputchar(int ch) {
+  804982:	55                   	push   %rbp
+  804983:	48 89 e5             	mov    %rsp,%rbp
+  804986:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80498a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80498e:	be 01 00 00 00       	mov    $0x1,%esi
+  804993:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804997:	48 b8 8c 1a 80 00 00 	movabs $0x801a8c,%rax
+  80499e:	00 00 00 
+  8049a1:	ff d0                	call   *%rax
+}
+  8049a3:	c9                   	leave
+  8049a4:	c3                   	ret
+
+00000000008049a5 <getchar>:
+getchar(void) {
+  8049a5:	55                   	push   %rbp
+  8049a6:	48 89 e5             	mov    %rsp,%rbp
+  8049a9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8049ad:	ba 01 00 00 00       	mov    $0x1,%edx
+  8049b2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8049b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049bb:	48 b8 aa 2a 80 00 00 	movabs $0x802aaa,%rax
+  8049c2:	00 00 00 
+  8049c5:	ff d0                	call   *%rax
+  8049c7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8049c9:	85 c0                	test   %eax,%eax
+  8049cb:	78 06                	js     8049d3 <getchar+0x2e>
+  8049cd:	74 08                	je     8049d7 <getchar+0x32>
+  8049cf:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8049d3:	89 d0                	mov    %edx,%eax
+  8049d5:	c9                   	leave
+  8049d6:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8049d7:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8049dc:	eb f5                	jmp    8049d3 <getchar+0x2e>
+
+00000000008049de <iscons>:
+iscons(int fdnum) {
+  8049de:	55                   	push   %rbp
+  8049df:	48 89 e5             	mov    %rsp,%rbp
+  8049e2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8049e6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8049ea:	48 b8 c7 27 80 00 00 	movabs $0x8027c7,%rax
+  8049f1:	00 00 00 
+  8049f4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8049f6:	85 c0                	test   %eax,%eax
+  8049f8:	78 18                	js     804a12 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8049fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8049fe:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804a05:	00 00 00 
+  804a08:	8b 00                	mov    (%rax),%eax
+  804a0a:	39 02                	cmp    %eax,(%rdx)
+  804a0c:	0f 94 c0             	sete   %al
+  804a0f:	0f b6 c0             	movzbl %al,%eax
+}
+  804a12:	c9                   	leave
+  804a13:	c3                   	ret
+
+0000000000804a14 <opencons>:
+opencons(void) {
+  804a14:	55                   	push   %rbp
+  804a15:	48 89 e5             	mov    %rsp,%rbp
+  804a18:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804a1c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804a20:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  804a27:	00 00 00 
+  804a2a:	ff d0                	call   *%rax
+  804a2c:	85 c0                	test   %eax,%eax
+  804a2e:	78 49                	js     804a79 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804a30:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804a35:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a3a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804a3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a43:	48 b8 15 1c 80 00 00 	movabs $0x801c15,%rax
+  804a4a:	00 00 00 
+  804a4d:	ff d0                	call   *%rax
+  804a4f:	85 c0                	test   %eax,%eax
+  804a51:	78 26                	js     804a79 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804a53:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a57:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804a5e:	00 00 
+  804a60:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804a62:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a66:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804a6d:	48 b8 39 27 80 00 00 	movabs $0x802739,%rax
+  804a74:	00 00 00 
+  804a77:	ff d0                	call   *%rax
+}
+  804a79:	c9                   	leave
+  804a7a:	c3                   	ret
+
+0000000000804a7b <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804a7b:	55                   	push   %rbp
+  804a7c:	48 89 e5             	mov    %rsp,%rbp
+  804a7f:	41 55                	push   %r13
+  804a81:	41 54                	push   %r12
+  804a83:	53                   	push   %rbx
+  804a84:	48 83 ec 08          	sub    $0x8,%rsp
+  804a88:	49 89 fc             	mov    %rdi,%r12
+  804a8b:	48 89 f7             	mov    %rsi,%rdi
+  804a8e:	48 89 d3             	mov    %rdx,%rbx
+  804a91:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804a94:	48 85 f6             	test   %rsi,%rsi
+  804a97:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804a9e:	00 00 00 
+  804aa1:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804aa5:	be 00 10 00 00       	mov    $0x1000,%esi
+  804aaa:	48 85 d2             	test   %rdx,%rdx
+  804aad:	74 03                	je     804ab2 <ipc_recv+0x37>
+  804aaf:	48 8b 32             	mov    (%rdx),%rsi
+  804ab2:	48 b8 c2 1f 80 00 00 	movabs $0x801fc2,%rax
+  804ab9:	00 00 00 
+  804abc:	ff d0                	call   *%rax
+    if (errno) {
+  804abe:	85 c0                	test   %eax,%eax
+  804ac0:	74 1c                	je     804ade <ipc_recv+0x63>
+        if (from_env_store)
+  804ac2:	4d 85 e4             	test   %r12,%r12
+  804ac5:	74 08                	je     804acf <ipc_recv+0x54>
+            *from_env_store = 0;
+  804ac7:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804ace:	00 
+
+        if (perm_store)
+  804acf:	4d 85 ed             	test   %r13,%r13
+  804ad2:	74 74                	je     804b48 <ipc_recv+0xcd>
+            *perm_store = 0;
+  804ad4:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804adb:	00 
+  804adc:	eb 6a                	jmp    804b48 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804ade:	4d 85 e4             	test   %r12,%r12
+  804ae1:	74 14                	je     804af7 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804ae3:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  804aea:	00 00 00 
+  804aed:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804af3:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  804af7:	48 85 db             	test   %rbx,%rbx
+  804afa:	74 23                	je     804b1f <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804afc:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  804b03:	00 00 00 
+  804b06:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804b0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b11:	85 c9                	test   %ecx,%ecx
+  804b13:	74 07                	je     804b1c <ipc_recv+0xa1>
+  804b15:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804b1c:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  804b1f:	4d 85 ed             	test   %r13,%r13
+  804b22:	74 14                	je     804b38 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  804b24:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  804b2b:	00 00 00 
+  804b2e:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804b34:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  804b38:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  804b3f:	00 00 00 
+  804b42:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  804b48:	48 83 c4 08          	add    $0x8,%rsp
+  804b4c:	5b                   	pop    %rbx
+  804b4d:	41 5c                	pop    %r12
+  804b4f:	41 5d                	pop    %r13
+  804b51:	5d                   	pop    %rbp
+  804b52:	c3                   	ret
+
+0000000000804b53 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804b53:	55                   	push   %rbp
+  804b54:	48 89 e5             	mov    %rsp,%rbp
+  804b57:	41 55                	push   %r13
+  804b59:	41 54                	push   %r12
+  804b5b:	53                   	push   %rbx
+  804b5c:	48 83 ec 08          	sub    $0x8,%rsp
+  804b60:	49 89 fc             	mov    %rdi,%r12
+  804b63:	48 89 f7             	mov    %rsi,%rdi
+  804b66:	48 89 d3             	mov    %rdx,%rbx
+  804b69:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804b6c:	48 85 f6             	test   %rsi,%rsi
+  804b6f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804b76:	00 00 00 
+  804b79:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804b7d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804b82:	48 85 d2             	test   %rdx,%rdx
+  804b85:	74 03                	je     804b8a <ipc_try_recv+0x37>
+  804b87:	48 8b 32             	mov    (%rdx),%rsi
+  804b8a:	48 b8 2b 20 80 00 00 	movabs $0x80202b,%rax
+  804b91:	00 00 00 
+  804b94:	ff d0                	call   *%rax
+    if (errno) {
+  804b96:	85 c0                	test   %eax,%eax
+  804b98:	75 75                	jne    804c0f <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804b9a:	4d 85 e4             	test   %r12,%r12
+  804b9d:	74 14                	je     804bb3 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804b9f:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  804ba6:	00 00 00 
+  804ba9:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804baf:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804bb3:	48 85 db             	test   %rbx,%rbx
+  804bb6:	74 23                	je     804bdb <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804bb8:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  804bbf:	00 00 00 
+  804bc2:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804bc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bcd:	85 c9                	test   %ecx,%ecx
+  804bcf:	74 07                	je     804bd8 <ipc_try_recv+0x85>
+  804bd1:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  804bd8:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804bdb:	4d 85 ed             	test   %r13,%r13
+  804bde:	74 14                	je     804bf4 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804be0:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  804be7:	00 00 00 
+  804bea:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804bf0:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804bf4:	48 a1 48 77 80 00 00 	movabs 0x807748,%rax
+  804bfb:	00 00 00 
+  804bfe:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804c04:	48 83 c4 08          	add    $0x8,%rsp
+  804c08:	5b                   	pop    %rbx
+  804c09:	41 5c                	pop    %r12
+  804c0b:	41 5d                	pop    %r13
+  804c0d:	5d                   	pop    %rbp
+  804c0e:	c3                   	ret
+        if (from_env_store)
+  804c0f:	4d 85 e4             	test   %r12,%r12
+  804c12:	74 08                	je     804c1c <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  804c14:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804c1b:	00 
+        if (perm_store)
+  804c1c:	4d 85 ed             	test   %r13,%r13
+  804c1f:	74 e3                	je     804c04 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  804c21:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804c28:	00 
+  804c29:	eb d9                	jmp    804c04 <ipc_try_recv+0xb1>
+
+0000000000804c2b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804c2b:	55                   	push   %rbp
+  804c2c:	48 89 e5             	mov    %rsp,%rbp
+  804c2f:	41 57                	push   %r15
+  804c31:	41 56                	push   %r14
+  804c33:	41 55                	push   %r13
+  804c35:	41 54                	push   %r12
+  804c37:	53                   	push   %rbx
+  804c38:	48 83 ec 18          	sub    $0x18,%rsp
+  804c3c:	41 89 fd             	mov    %edi,%r13d
+  804c3f:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  804c42:	48 89 d3             	mov    %rdx,%rbx
+  804c45:	49 89 cc             	mov    %rcx,%r12
+  804c48:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804c4c:	48 85 d2             	test   %rdx,%rdx
+  804c4f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c56:	00 00 00 
+  804c59:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804c5d:	49 be 96 1f 80 00 00 	movabs $0x801f96,%r14
+  804c64:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  804c67:	49 bf 86 1b 80 00 00 	movabs $0x801b86,%r15
+  804c6e:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804c71:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804c74:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  804c78:	4c 89 e1             	mov    %r12,%rcx
+  804c7b:	48 89 da             	mov    %rbx,%rdx
+  804c7e:	44 89 ef             	mov    %r13d,%edi
+  804c81:	41 ff d6             	call   *%r14
+  804c84:	85 c0                	test   %eax,%eax
+  804c86:	74 37                	je     804cbf <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  804c88:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804c8b:	75 05                	jne    804c92 <ipc_send+0x67>
+        sys_yield();
+  804c8d:	41 ff d7             	call   *%r15
+  804c90:	eb df                	jmp    804c71 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804c92:	89 c1                	mov    %eax,%ecx
+  804c94:	48 ba 1e 59 80 00 00 	movabs $0x80591e,%rdx
+  804c9b:	00 00 00 
+  804c9e:	be 65 00 00 00       	mov    $0x65,%esi
+  804ca3:	48 bf 39 59 80 00 00 	movabs $0x805939,%rdi
+  804caa:	00 00 00 
+  804cad:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cb2:	49 b8 ed 09 80 00 00 	movabs $0x8009ed,%r8
+  804cb9:	00 00 00 
+  804cbc:	41 ff d0             	call   *%r8
+    }
+}
+  804cbf:	48 83 c4 18          	add    $0x18,%rsp
+  804cc3:	5b                   	pop    %rbx
+  804cc4:	41 5c                	pop    %r12
+  804cc6:	41 5d                	pop    %r13
+  804cc8:	41 5e                	pop    %r14
+  804cca:	41 5f                	pop    %r15
+  804ccc:	5d                   	pop    %rbp
+  804ccd:	c3                   	ret
+
+0000000000804cce <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804cce:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804cd3:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804cda:	00 00 00 
+  804cdd:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804ce4:	48 01 ca             	add    %rcx,%rdx
+  804ce7:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804ced:	39 fa                	cmp    %edi,%edx
+  804cef:	74 12                	je     804d03 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804cf1:	48 83 c0 01          	add    $0x1,%rax
+  804cf5:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804cfb:	75 e0                	jne    804cdd <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804cfd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d02:	c3                   	ret
+            return envs[i].env_id;
+  804d03:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804d0a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804d11:	00 00 00 
+  804d14:	48 01 d0             	add    %rdx,%rax
+  804d17:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804d1d:	c3                   	ret
+
+0000000000804d1e <__text_end>:
+  804d1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d25:	00 00 00 
+  804d28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2f:	00 00 00 
+  804d32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d39:	00 00 00 
+  804d3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d43:	00 00 00 
+  804d46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4d:	00 00 00 
+  804d50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d57:	00 00 00 
+  804d5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d61:	00 00 00 
+  804d64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6b:	00 00 00 
+  804d6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d75:	00 00 00 
+  804d78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7f:	00 00 00 
+  804d82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d89:	00 00 00 
+  804d8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d93:	00 00 00 
+  804d96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9d:	00 00 00 
+  804da0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da7:	00 00 00 
+  804daa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db1:	00 00 00 
+  804db4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbb:	00 00 00 
+  804dbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc5:	00 00 00 
+  804dc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dcf:	00 00 00 
+  804dd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd9:	00 00 00 
+  804ddc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de3:	00 00 00 
+  804de6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ded:	00 00 00 
+  804df0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df7:	00 00 00 
+  804dfa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e01:	00 00 00 
+  804e04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0b:	00 00 00 
+  804e0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e15:	00 00 00 
+  804e18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1f:	00 00 00 
+  804e22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e29:	00 00 00 
+  804e2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e33:	00 00 00 
+  804e36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3d:	00 00 00 
+  804e40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e47:	00 00 00 
+  804e4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e51:	00 00 00 
+  804e54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5b:	00 00 00 
+  804e5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e65:	00 00 00 
+  804e68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6f:	00 00 00 
+  804e72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e79:	00 00 00 
+  804e7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e83:	00 00 00 
+  804e86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8d:	00 00 00 
+  804e90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e97:	00 00 00 
+  804e9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea1:	00 00 00 
+  804ea4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eab:	00 00 00 
+  804eae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb5:	00 00 00 
+  804eb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ebf:	00 00 00 
+  804ec2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec9:	00 00 00 
+  804ecc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed3:	00 00 00 
+  804ed6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edd:	00 00 00 
+  804ee0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee7:	00 00 00 
+  804eea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef1:	00 00 00 
+  804ef4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efb:	00 00 00 
+  804efe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f05:	00 00 00 
+  804f08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0f:	00 00 00 
+  804f12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f19:	00 00 00 
+  804f1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f23:	00 00 00 
+  804f26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2d:	00 00 00 
+  804f30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f37:	00 00 00 
+  804f3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f41:	00 00 00 
+  804f44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4b:	00 00 00 
+  804f4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f55:	00 00 00 
+  804f58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5f:	00 00 00 
+  804f62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f69:	00 00 00 
+  804f6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f73:	00 00 00 
+  804f76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7d:	00 00 00 
+  804f80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f87:	00 00 00 
+  804f8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f91:	00 00 00 
+  804f94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9b:	00 00 00 
+  804f9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa5:	00 00 00 
+  804fa8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faf:	00 00 00 
+  804fb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb9:	00 00 00 
+  804fbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc3:	00 00 00 
+  804fc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcd:	00 00 00 
+  804fd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd7:	00 00 00 
+  804fda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe1:	00 00 00 
+  804fe4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804feb:	00 00 00 
+  804fee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff5:	00 00 00 
+  804ff8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804fff:	00 
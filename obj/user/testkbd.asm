@@ -0,0 +1,8343 @@
+
+obj/user/testkbd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 71 03 00 00       	call   800394 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    int r;
+
+    /* Spin for a bit to let the console quiet */
+    for (int i = 0; i < 10; ++i)
+        sys_yield();
+  800035:	49 bc 43 17 80 00 00 	movabs $0x801743,%r12
+  80003c:	00 00 00 
+  80003f:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 10; ++i)
+  800042:	83 eb 01             	sub    $0x1,%ebx
+  800045:	75 f8                	jne    80003f <umain+0x1a>
+
+    close(0);
+  800047:	bf 00 00 00 00       	mov    $0x0,%edi
+  80004c:	48 b8 db 23 80 00 00 	movabs $0x8023db,%rax
+  800053:	00 00 00 
+  800056:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  800058:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+  800064:	85 c0                	test   %eax,%eax
+  800066:	78 2f                	js     800097 <umain+0x72>
+        panic("opencons: %i", r);
+    if (r != 0)
+  800068:	74 5a                	je     8000c4 <umain+0x9f>
+        panic("first opencons used fd %d", r);
+  80006a:	89 c1                	mov    %eax,%ecx
+  80006c:	48 ba 1c 50 80 00 00 	movabs $0x80501c,%rdx
+  800073:	00 00 00 
+  800076:	be 10 00 00 00       	mov    $0x10,%esi
+  80007b:	48 bf 0d 50 80 00 00 	movabs $0x80500d,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	49 b8 60 04 80 00 00 	movabs $0x800460,%r8
+  800091:	00 00 00 
+  800094:	41 ff d0             	call   *%r8
+        panic("opencons: %i", r);
+  800097:	89 c1                	mov    %eax,%ecx
+  800099:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  8000a0:	00 00 00 
+  8000a3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000a8:	48 bf 0d 50 80 00 00 	movabs $0x80500d,%rdi
+  8000af:	00 00 00 
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	49 b8 60 04 80 00 00 	movabs $0x800460,%r8
+  8000be:	00 00 00 
+  8000c1:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  8000c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8000c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ce:	48 b8 36 24 80 00 00 	movabs $0x802436,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+
+    for (;;) {
+        char *buf;
+
+        buf = readline("Type a line: ");
+  8000da:	49 bc 3e 50 80 00 00 	movabs $0x80503e,%r12
+  8000e1:	00 00 00 
+  8000e4:	48 bb ff 14 80 00 00 	movabs $0x8014ff,%rbx
+  8000eb:	00 00 00 
+        if (buf != NULL)
+            fprintf(1, "%s\n", buf);
+        else
+            fprintf(1, "(end of file received)\n");
+  8000ee:	49 be 50 50 80 00 00 	movabs $0x805050,%r14
+  8000f5:	00 00 00 
+  8000f8:	49 bd 16 3b 80 00 00 	movabs $0x803b16,%r13
+  8000ff:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  800102:	85 c0                	test   %eax,%eax
+  800104:	79 44                	jns    80014a <umain+0x125>
+        panic("dup: %i", r);
+  800106:	89 c1                	mov    %eax,%ecx
+  800108:	48 ba 36 50 80 00 00 	movabs $0x805036,%rdx
+  80010f:	00 00 00 
+  800112:	be 12 00 00 00       	mov    $0x12,%esi
+  800117:	48 bf 0d 50 80 00 00 	movabs $0x80500d,%rdi
+  80011e:	00 00 00 
+  800121:	b8 00 00 00 00       	mov    $0x0,%eax
+  800126:	49 b8 60 04 80 00 00 	movabs $0x800460,%r8
+  80012d:	00 00 00 
+  800130:	41 ff d0             	call   *%r8
+            fprintf(1, "%s\n", buf);
+  800133:	48 be 4c 50 80 00 00 	movabs $0x80504c,%rsi
+  80013a:	00 00 00 
+  80013d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	41 ff d5             	call   *%r13
+        buf = readline("Type a line: ");
+  80014a:	4c 89 e7             	mov    %r12,%rdi
+  80014d:	ff d3                	call   *%rbx
+  80014f:	48 89 c2             	mov    %rax,%rdx
+        if (buf != NULL)
+  800152:	48 85 c0             	test   %rax,%rax
+  800155:	75 dc                	jne    800133 <umain+0x10e>
+            fprintf(1, "(end of file received)\n");
+  800157:	4c 89 f6             	mov    %r14,%rsi
+  80015a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80015f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800164:	41 ff d5             	call   *%r13
+  800167:	eb e1                	jmp    80014a <umain+0x125>
+
+0000000000800169 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  800169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016e:	c3                   	ret
+
+000000000080016f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80016f:	55                   	push   %rbp
+  800170:	48 89 e5             	mov    %rsp,%rbp
+  800173:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800176:	48 be 68 50 80 00 00 	movabs $0x805068,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  800187:	00 00 00 
+  80018a:	ff d0                	call   *%rax
+    return 0;
+}
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	5d                   	pop    %rbp
+  800192:	c3                   	ret
+
+0000000000800193 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+  800197:	41 57                	push   %r15
+  800199:	41 56                	push   %r14
+  80019b:	41 55                	push   %r13
+  80019d:	41 54                	push   %r12
+  80019f:	53                   	push   %rbx
+  8001a0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8001a7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8001ae:	48 85 d2             	test   %rdx,%rdx
+  8001b1:	74 7a                	je     80022d <devcons_write+0x9a>
+  8001b3:	49 89 d6             	mov    %rdx,%r14
+  8001b6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8001bc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8001c1:	49 bf b6 12 80 00 00 	movabs $0x8012b6,%r15
+  8001c8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8001cb:	4c 89 f3             	mov    %r14,%rbx
+  8001ce:	48 29 f3             	sub    %rsi,%rbx
+  8001d1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8001d6:	48 39 c3             	cmp    %rax,%rbx
+  8001d9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8001dd:	4c 63 eb             	movslq %ebx,%r13
+  8001e0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8001e7:	48 01 c6             	add    %rax,%rsi
+  8001ea:	4c 89 ea             	mov    %r13,%rdx
+  8001ed:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8001f4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8001f7:	4c 89 ee             	mov    %r13,%rsi
+  8001fa:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800201:	48 b8 49 16 80 00 00 	movabs $0x801649,%rax
+  800208:	00 00 00 
+  80020b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80020d:	41 01 dc             	add    %ebx,%r12d
+  800210:	49 63 f4             	movslq %r12d,%rsi
+  800213:	4c 39 f6             	cmp    %r14,%rsi
+  800216:	72 b3                	jb     8001cb <devcons_write+0x38>
+    return res;
+  800218:	49 63 c4             	movslq %r12d,%rax
+}
+  80021b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800222:	5b                   	pop    %rbx
+  800223:	41 5c                	pop    %r12
+  800225:	41 5d                	pop    %r13
+  800227:	41 5e                	pop    %r14
+  800229:	41 5f                	pop    %r15
+  80022b:	5d                   	pop    %rbp
+  80022c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80022d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800233:	eb e3                	jmp    800218 <devcons_write+0x85>
+
+0000000000800235 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800235:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80023d:	48 85 c0             	test   %rax,%rax
+  800240:	74 55                	je     800297 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800242:	55                   	push   %rbp
+  800243:	48 89 e5             	mov    %rsp,%rbp
+  800246:	41 55                	push   %r13
+  800248:	41 54                	push   %r12
+  80024a:	53                   	push   %rbx
+  80024b:	48 83 ec 08          	sub    $0x8,%rsp
+  80024f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  800252:	48 bb 76 16 80 00 00 	movabs $0x801676,%rbx
+  800259:	00 00 00 
+  80025c:	49 bc 43 17 80 00 00 	movabs $0x801743,%r12
+  800263:	00 00 00 
+  800266:	eb 03                	jmp    80026b <devcons_read+0x36>
+  800268:	41 ff d4             	call   *%r12
+  80026b:	ff d3                	call   *%rbx
+  80026d:	85 c0                	test   %eax,%eax
+  80026f:	74 f7                	je     800268 <devcons_read+0x33>
+    if (c < 0) return c;
+  800271:	48 63 d0             	movslq %eax,%rdx
+  800274:	78 13                	js     800289 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027b:	83 f8 04             	cmp    $0x4,%eax
+  80027e:	74 09                	je     800289 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  800280:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800284:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800289:	48 89 d0             	mov    %rdx,%rax
+  80028c:	48 83 c4 08          	add    $0x8,%rsp
+  800290:	5b                   	pop    %rbx
+  800291:	41 5c                	pop    %r12
+  800293:	41 5d                	pop    %r13
+  800295:	5d                   	pop    %rbp
+  800296:	c3                   	ret
+  800297:	48 89 d0             	mov    %rdx,%rax
+  80029a:	c3                   	ret
+
+000000000080029b <cputchar>:
+cputchar(int ch) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8002a3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8002a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8002ac:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8002b0:	48 b8 49 16 80 00 00 	movabs $0x801649,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+}
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+00000000008002be <getchar>:
+getchar(void) {
+  8002be:	55                   	push   %rbp
+  8002bf:	48 89 e5             	mov    %rsp,%rbp
+  8002c2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8002c6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8002cb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8002cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002d4:	48 b8 59 25 80 00 00 	movabs $0x802559,%rax
+  8002db:	00 00 00 
+  8002de:	ff d0                	call   *%rax
+  8002e0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8002e2:	85 c0                	test   %eax,%eax
+  8002e4:	78 06                	js     8002ec <getchar+0x2e>
+  8002e6:	74 08                	je     8002f0 <getchar+0x32>
+  8002e8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8002ec:	89 d0                	mov    %edx,%eax
+  8002ee:	c9                   	leave
+  8002ef:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8002f0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8002f5:	eb f5                	jmp    8002ec <getchar+0x2e>
+
+00000000008002f7 <iscons>:
+iscons(int fdnum) {
+  8002f7:	55                   	push   %rbp
+  8002f8:	48 89 e5             	mov    %rsp,%rbp
+  8002fb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8002ff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800303:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  80030a:	00 00 00 
+  80030d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	78 18                	js     80032b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800313:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800317:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80031e:	00 00 00 
+  800321:	8b 00                	mov    (%rax),%eax
+  800323:	39 02                	cmp    %eax,(%rdx)
+  800325:	0f 94 c0             	sete   %al
+  800328:	0f b6 c0             	movzbl %al,%eax
+}
+  80032b:	c9                   	leave
+  80032c:	c3                   	ret
+
+000000000080032d <opencons>:
+opencons(void) {
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  800331:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800335:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800339:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  800340:	00 00 00 
+  800343:	ff d0                	call   *%rax
+  800345:	85 c0                	test   %eax,%eax
+  800347:	78 49                	js     800392 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800349:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80034e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800353:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800357:	bf 00 00 00 00       	mov    $0x0,%edi
+  80035c:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+  800368:	85 c0                	test   %eax,%eax
+  80036a:	78 26                	js     800392 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80036c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800370:	a1 00 60 80 00 00 00 	movabs 0x806000,%eax
+  800377:	00 00 
+  800379:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80037b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80037f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800386:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+}
+  800392:	c9                   	leave
+  800393:	c3                   	ret
+
+0000000000800394 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800394:	55                   	push   %rbp
+  800395:	48 89 e5             	mov    %rsp,%rbp
+  800398:	41 56                	push   %r14
+  80039a:	41 55                	push   %r13
+  80039c:	41 54                	push   %r12
+  80039e:	53                   	push   %rbx
+  80039f:	41 89 fd             	mov    %edi,%r13d
+  8003a2:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a5:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8003ac:	00 00 00 
+  8003af:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8003b6:	00 00 00 
+  8003b9:	48 39 c2             	cmp    %rax,%rdx
+  8003bc:	73 17                	jae    8003d5 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8003be:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003c1:	49 89 c4             	mov    %rax,%r12
+  8003c4:	48 83 c3 08          	add    $0x8,%rbx
+  8003c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cd:	ff 53 f8             	call   *-0x8(%rbx)
+  8003d0:	4c 39 e3             	cmp    %r12,%rbx
+  8003d3:	72 ef                	jb     8003c4 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8003d5:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  8003dc:	00 00 00 
+  8003df:	ff d0                	call   *%rax
+  8003e1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003e6:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8003ed:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003f4:	00 00 00 
+  8003f7:	48 01 d0             	add    %rdx,%rax
+  8003fa:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800401:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800404:	45 85 ed             	test   %r13d,%r13d
+  800407:	7e 0d                	jle    800416 <libmain+0x82>
+  800409:	49 8b 06             	mov    (%r14),%rax
+  80040c:	48 a3 38 60 80 00 00 	movabs %rax,0x806038
+  800413:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800416:	4c 89 f6             	mov    %r14,%rsi
+  800419:	44 89 ef             	mov    %r13d,%edi
+  80041c:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800423:	00 00 00 
+  800426:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800428:	48 b8 3d 04 80 00 00 	movabs $0x80043d,%rax
+  80042f:	00 00 00 
+  800432:	ff d0                	call   *%rax
+#endif
+}
+  800434:	5b                   	pop    %rbx
+  800435:	41 5c                	pop    %r12
+  800437:	41 5d                	pop    %r13
+  800439:	41 5e                	pop    %r14
+  80043b:	5d                   	pop    %rbp
+  80043c:	c3                   	ret
+
+000000000080043d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80043d:	55                   	push   %rbp
+  80043e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800441:	48 b8 0e 24 80 00 00 	movabs $0x80240e,%rax
+  800448:	00 00 00 
+  80044b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80044d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800452:	48 b8 a7 16 80 00 00 	movabs $0x8016a7,%rax
+  800459:	00 00 00 
+  80045c:	ff d0                	call   *%rax
+}
+  80045e:	5d                   	pop    %rbp
+  80045f:	c3                   	ret
+
+0000000000800460 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800460:	55                   	push   %rbp
+  800461:	48 89 e5             	mov    %rsp,%rbp
+  800464:	41 56                	push   %r14
+  800466:	41 55                	push   %r13
+  800468:	41 54                	push   %r12
+  80046a:	53                   	push   %rbx
+  80046b:	48 83 ec 50          	sub    $0x50,%rsp
+  80046f:	49 89 fc             	mov    %rdi,%r12
+  800472:	41 89 f5             	mov    %esi,%r13d
+  800475:	48 89 d3             	mov    %rdx,%rbx
+  800478:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80047c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800480:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800484:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80048b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80048f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800493:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800497:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80049b:	48 b8 38 60 80 00 00 	movabs $0x806038,%rax
+  8004a2:	00 00 00 
+  8004a5:	4c 8b 30             	mov    (%rax),%r14
+  8004a8:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  8004af:	00 00 00 
+  8004b2:	ff d0                	call   *%rax
+  8004b4:	89 c6                	mov    %eax,%esi
+  8004b6:	45 89 e8             	mov    %r13d,%r8d
+  8004b9:	4c 89 e1             	mov    %r12,%rcx
+  8004bc:	4c 89 f2             	mov    %r14,%rdx
+  8004bf:	48 bf 80 50 80 00 00 	movabs $0x805080,%rdi
+  8004c6:	00 00 00 
+  8004c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ce:	49 bc b0 05 80 00 00 	movabs $0x8005b0,%r12
+  8004d5:	00 00 00 
+  8004d8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004db:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004df:	48 89 df             	mov    %rbx,%rdi
+  8004e2:	48 b8 4c 05 80 00 00 	movabs $0x80054c,%rax
+  8004e9:	00 00 00 
+  8004ec:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004ee:	48 bf 66 50 80 00 00 	movabs $0x805066,%rdi
+  8004f5:	00 00 00 
+  8004f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fd:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800500:	cc                   	int3
+  800501:	eb fd                	jmp    800500 <_panic+0xa0>
+
+0000000000800503 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800503:	55                   	push   %rbp
+  800504:	48 89 e5             	mov    %rsp,%rbp
+  800507:	53                   	push   %rbx
+  800508:	48 83 ec 08          	sub    $0x8,%rsp
+  80050c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80050f:	8b 06                	mov    (%rsi),%eax
+  800511:	8d 50 01             	lea    0x1(%rax),%edx
+  800514:	89 16                	mov    %edx,(%rsi)
+  800516:	48 98                	cltq
+  800518:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80051d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800523:	74 0a                	je     80052f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800525:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800529:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80052d:	c9                   	leave
+  80052e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80052f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800533:	be ff 00 00 00       	mov    $0xff,%esi
+  800538:	48 b8 49 16 80 00 00 	movabs $0x801649,%rax
+  80053f:	00 00 00 
+  800542:	ff d0                	call   *%rax
+        state->offset = 0;
+  800544:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80054a:	eb d9                	jmp    800525 <putch+0x22>
+
+000000000080054c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80054c:	55                   	push   %rbp
+  80054d:	48 89 e5             	mov    %rsp,%rbp
+  800550:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800557:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80055a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800561:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80056e:	48 89 f1             	mov    %rsi,%rcx
+  800571:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800578:	48 bf 03 05 80 00 00 	movabs $0x800503,%rdi
+  80057f:	00 00 00 
+  800582:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  800589:	00 00 00 
+  80058c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80058e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800595:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80059c:	48 b8 49 16 80 00 00 	movabs $0x801649,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005a8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005ae:	c9                   	leave
+  8005af:	c3                   	ret
+
+00000000008005b0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005b0:	55                   	push   %rbp
+  8005b1:	48 89 e5             	mov    %rsp,%rbp
+  8005b4:	48 83 ec 50          	sub    $0x50,%rsp
+  8005b8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005bc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005c0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005c4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005c8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005cc:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005db:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005e3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005e7:	48 b8 4c 05 80 00 00 	movabs $0x80054c,%rax
+  8005ee:	00 00 00 
+  8005f1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005f3:	c9                   	leave
+  8005f4:	c3                   	ret
+
+00000000008005f5 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005f5:	55                   	push   %rbp
+  8005f6:	48 89 e5             	mov    %rsp,%rbp
+  8005f9:	41 57                	push   %r15
+  8005fb:	41 56                	push   %r14
+  8005fd:	41 55                	push   %r13
+  8005ff:	41 54                	push   %r12
+  800601:	53                   	push   %rbx
+  800602:	48 83 ec 18          	sub    $0x18,%rsp
+  800606:	49 89 fc             	mov    %rdi,%r12
+  800609:	49 89 f5             	mov    %rsi,%r13
+  80060c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800610:	8b 45 10             	mov    0x10(%rbp),%eax
+  800613:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800616:	41 89 cf             	mov    %ecx,%r15d
+  800619:	4c 39 fa             	cmp    %r15,%rdx
+  80061c:	73 5b                	jae    800679 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80061e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800622:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800626:	85 db                	test   %ebx,%ebx
+  800628:	7e 0e                	jle    800638 <print_num+0x43>
+            putch(padc, put_arg);
+  80062a:	4c 89 ee             	mov    %r13,%rsi
+  80062d:	44 89 f7             	mov    %r14d,%edi
+  800630:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800633:	83 eb 01             	sub    $0x1,%ebx
+  800636:	75 f2                	jne    80062a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800638:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80063c:	48 b9 b4 50 80 00 00 	movabs $0x8050b4,%rcx
+  800643:	00 00 00 
+  800646:	48 b8 a3 50 80 00 00 	movabs $0x8050a3,%rax
+  80064d:	00 00 00 
+  800650:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800654:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800658:	ba 00 00 00 00       	mov    $0x0,%edx
+  80065d:	49 f7 f7             	div    %r15
+  800660:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800664:	4c 89 ee             	mov    %r13,%rsi
+  800667:	41 ff d4             	call   *%r12
+}
+  80066a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80066e:	5b                   	pop    %rbx
+  80066f:	41 5c                	pop    %r12
+  800671:	41 5d                	pop    %r13
+  800673:	41 5e                	pop    %r14
+  800675:	41 5f                	pop    %r15
+  800677:	5d                   	pop    %rbp
+  800678:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800679:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80067d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800682:	49 f7 f7             	div    %r15
+  800685:	48 83 ec 08          	sub    $0x8,%rsp
+  800689:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80068d:	52                   	push   %rdx
+  80068e:	45 0f be c9          	movsbl %r9b,%r9d
+  800692:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800696:	48 89 c2             	mov    %rax,%rdx
+  800699:	48 b8 f5 05 80 00 00 	movabs $0x8005f5,%rax
+  8006a0:	00 00 00 
+  8006a3:	ff d0                	call   *%rax
+  8006a5:	48 83 c4 10          	add    $0x10,%rsp
+  8006a9:	eb 8d                	jmp    800638 <print_num+0x43>
+
+00000000008006ab <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006ab:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006af:	48 8b 06             	mov    (%rsi),%rax
+  8006b2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006b6:	73 0a                	jae    8006c2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8006b8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006bc:	48 89 16             	mov    %rdx,(%rsi)
+  8006bf:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006c2:	c3                   	ret
+
+00000000008006c3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006c3:	55                   	push   %rbp
+  8006c4:	48 89 e5             	mov    %rsp,%rbp
+  8006c7:	48 83 ec 50          	sub    $0x50,%rsp
+  8006cb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006cf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006d3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006d7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006de:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006ea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006ee:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006f2:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  8006f9:	00 00 00 
+  8006fc:	ff d0                	call   *%rax
+}
+  8006fe:	c9                   	leave
+  8006ff:	c3                   	ret
+
+0000000000800700 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800700:	55                   	push   %rbp
+  800701:	48 89 e5             	mov    %rsp,%rbp
+  800704:	41 57                	push   %r15
+  800706:	41 56                	push   %r14
+  800708:	41 55                	push   %r13
+  80070a:	41 54                	push   %r12
+  80070c:	53                   	push   %rbx
+  80070d:	48 83 ec 38          	sub    $0x38,%rsp
+  800711:	49 89 fe             	mov    %rdi,%r14
+  800714:	49 89 f5             	mov    %rsi,%r13
+  800717:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80071a:	48 8b 01             	mov    (%rcx),%rax
+  80071d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800721:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800725:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800729:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80072d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800731:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800735:	0f b6 3b             	movzbl (%rbx),%edi
+  800738:	40 80 ff 25          	cmp    $0x25,%dil
+  80073c:	74 18                	je     800756 <vprintfmt+0x56>
+            if (!ch) return;
+  80073e:	40 84 ff             	test   %dil,%dil
+  800741:	0f 84 04 07 00 00    	je     800e4b <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  800747:	40 0f b6 ff          	movzbl %dil,%edi
+  80074b:	4c 89 ee             	mov    %r13,%rsi
+  80074e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800751:	4c 89 e3             	mov    %r12,%rbx
+  800754:	eb db                	jmp    800731 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800756:	be 00 00 00 00       	mov    $0x0,%esi
+  80075b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80075f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800764:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80076a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800771:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800775:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80077a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80077f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800782:	83 e8 23             	sub    $0x23,%eax
+  800785:	3c 57                	cmp    $0x57,%al
+  800787:	0f 87 a4 06 00 00    	ja     800e31 <vprintfmt+0x731>
+  80078d:	0f b6 c0             	movzbl %al,%eax
+  800790:	48 b9 40 52 80 00 00 	movabs $0x805240,%rcx
+  800797:	00 00 00 
+  80079a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80079d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007a0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007a4:	eb cf                	jmp    800775 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007a6:	49 89 dc             	mov    %rbx,%r12
+  8007a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8007ae:	eb c5                	jmp    800775 <vprintfmt+0x75>
+            padc = ch;
+  8007b0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007b4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007b7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007ba:	eb b9                	jmp    800775 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c2:	77 24                	ja     8007e8 <vprintfmt+0xe8>
+  8007c4:	89 c1                	mov    %eax,%ecx
+  8007c6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007ca:	83 c0 08             	add    $0x8,%eax
+  8007cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007d3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007d6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007da:	79 99                	jns    800775 <vprintfmt+0x75>
+                width = precision;
+  8007dc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007e0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007e6:	eb 8d                	jmp    800775 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007e8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007ec:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f4:	eb da                	jmp    8007d0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007f6:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007fb:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007ff:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800805:	3c 39                	cmp    $0x39,%al
+  800807:	77 1c                	ja     800825 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800809:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80080d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800811:	0f b6 c0             	movzbl %al,%eax
+  800814:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800819:	0f b6 03             	movzbl (%rbx),%eax
+  80081c:	3c 39                	cmp    $0x39,%al
+  80081e:	76 e9                	jbe    800809 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800820:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800823:	eb b1                	jmp    8007d6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800825:	49 89 dc             	mov    %rbx,%r12
+  800828:	eb ac                	jmp    8007d6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80082a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80082d:	85 c9                	test   %ecx,%ecx
+  80082f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800834:	0f 49 c1             	cmovns %ecx,%eax
+  800837:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80083a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80083d:	e9 33 ff ff ff       	jmp    800775 <vprintfmt+0x75>
+            lflag++;
+  800842:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800845:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800848:	e9 28 ff ff ff       	jmp    800775 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80084d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800850:	83 f8 2f             	cmp    $0x2f,%eax
+  800853:	77 19                	ja     80086e <vprintfmt+0x16e>
+  800855:	89 c2                	mov    %eax,%edx
+  800857:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085b:	83 c0 08             	add    $0x8,%eax
+  80085e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800861:	8b 3a                	mov    (%rdx),%edi
+  800863:	4c 89 ee             	mov    %r13,%rsi
+  800866:	41 ff d6             	call   *%r14
+            break;
+  800869:	e9 c3 fe ff ff       	jmp    800731 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80086e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800872:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800876:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087a:	eb e5                	jmp    800861 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80087c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087f:	83 f8 2f             	cmp    $0x2f,%eax
+  800882:	77 5a                	ja     8008de <vprintfmt+0x1de>
+  800884:	89 c2                	mov    %eax,%edx
+  800886:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088a:	83 c0 08             	add    $0x8,%eax
+  80088d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800890:	8b 02                	mov    (%rdx),%eax
+  800892:	89 c1                	mov    %eax,%ecx
+  800894:	f7 d9                	neg    %ecx
+  800896:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800899:	83 f9 13             	cmp    $0x13,%ecx
+  80089c:	7f 4e                	jg     8008ec <vprintfmt+0x1ec>
+  80089e:	48 63 c1             	movslq %ecx,%rax
+  8008a1:	48 ba 00 55 80 00 00 	movabs $0x805500,%rdx
+  8008a8:	00 00 00 
+  8008ab:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008af:	48 85 c0             	test   %rax,%rax
+  8008b2:	74 38                	je     8008ec <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008b4:	48 89 c1             	mov    %rax,%rcx
+  8008b7:	48 ba 39 57 80 00 00 	movabs $0x805739,%rdx
+  8008be:	00 00 00 
+  8008c1:	4c 89 ee             	mov    %r13,%rsi
+  8008c4:	4c 89 f7             	mov    %r14,%rdi
+  8008c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cc:	49 b8 c3 06 80 00 00 	movabs $0x8006c3,%r8
+  8008d3:	00 00 00 
+  8008d6:	41 ff d0             	call   *%r8
+  8008d9:	e9 53 fe ff ff       	jmp    800731 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ea:	eb a4                	jmp    800890 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008ec:	48 ba cc 50 80 00 00 	movabs $0x8050cc,%rdx
+  8008f3:	00 00 00 
+  8008f6:	4c 89 ee             	mov    %r13,%rsi
+  8008f9:	4c 89 f7             	mov    %r14,%rdi
+  8008fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800901:	49 b8 c3 06 80 00 00 	movabs $0x8006c3,%r8
+  800908:	00 00 00 
+  80090b:	41 ff d0             	call   *%r8
+  80090e:	e9 1e fe ff ff       	jmp    800731 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800913:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800916:	83 f8 2f             	cmp    $0x2f,%eax
+  800919:	77 36                	ja     800951 <vprintfmt+0x251>
+  80091b:	89 c2                	mov    %eax,%edx
+  80091d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800921:	83 c0 08             	add    $0x8,%eax
+  800924:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800927:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  80092a:	48 85 f6             	test   %rsi,%rsi
+  80092d:	48 b8 c5 50 80 00 00 	movabs $0x8050c5,%rax
+  800934:	00 00 00 
+  800937:	48 0f 45 c6          	cmovne %rsi,%rax
+  80093b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80093f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800943:	7e 06                	jle    80094b <vprintfmt+0x24b>
+  800945:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800949:	75 14                	jne    80095f <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80094b:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80094f:	eb 5b                	jmp    8009ac <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800951:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800955:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095d:	eb c8                	jmp    800927 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80095f:	49 63 f7             	movslq %r15d,%rsi
+  800962:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800966:	48 b8 05 0f 80 00 00 	movabs $0x800f05,%rax
+  80096d:	00 00 00 
+  800970:	ff d0                	call   *%rax
+  800972:	48 89 c2             	mov    %rax,%rdx
+  800975:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800978:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80097a:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80097d:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800980:	85 c0                	test   %eax,%eax
+  800982:	7e c7                	jle    80094b <vprintfmt+0x24b>
+  800984:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800989:	4c 89 ee             	mov    %r13,%rsi
+  80098c:	44 89 e7             	mov    %r12d,%edi
+  80098f:	41 ff d6             	call   *%r14
+  800992:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800996:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800999:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80099c:	75 eb                	jne    800989 <vprintfmt+0x289>
+  80099e:	eb ab                	jmp    80094b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009a0:	0f b6 f8             	movzbl %al,%edi
+  8009a3:	4c 89 ee             	mov    %r13,%rsi
+  8009a6:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  8009a9:	4c 89 e2             	mov    %r12,%rdx
+  8009ac:	45 85 ff             	test   %r15d,%r15d
+  8009af:	78 06                	js     8009b7 <vprintfmt+0x2b7>
+  8009b1:	41 83 ef 01          	sub    $0x1,%r15d
+  8009b5:	78 23                	js     8009da <vprintfmt+0x2da>
+  8009b7:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  8009bb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009c1:	84 c0                	test   %al,%al
+  8009c3:	74 15                	je     8009da <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009c5:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009c9:	74 d5                	je     8009a0 <vprintfmt+0x2a0>
+  8009cb:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009ce:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009d3:	80 fa 5e             	cmp    $0x5e,%dl
+  8009d6:	77 cb                	ja     8009a3 <vprintfmt+0x2a3>
+  8009d8:	eb c6                	jmp    8009a0 <vprintfmt+0x2a0>
+  8009da:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009dd:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  8009e0:	01 f0                	add    %esi,%eax
+  8009e2:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  8009e4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009e8:	85 c0                	test   %eax,%eax
+  8009ea:	0f 8e 41 fd ff ff    	jle    800731 <vprintfmt+0x31>
+  8009f0:	4c 89 ee             	mov    %r13,%rsi
+  8009f3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009f8:	41 ff d6             	call   *%r14
+  8009fb:	41 83 ec 01          	sub    $0x1,%r12d
+  8009ff:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a03:	75 eb                	jne    8009f0 <vprintfmt+0x2f0>
+  800a05:	e9 27 fd ff ff       	jmp    800731 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800a0a:	40 84 f6             	test   %sil,%sil
+  800a0d:	75 26                	jne    800a35 <vprintfmt+0x335>
+    switch (lflag) {
+  800a0f:	85 d2                	test   %edx,%edx
+  800a11:	74 59                	je     800a6c <vprintfmt+0x36c>
+  800a13:	83 fa 01             	cmp    $0x1,%edx
+  800a16:	74 7b                	je     800a93 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800a18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1e:	0f 87 96 00 00 00    	ja     800aba <vprintfmt+0x3ba>
+  800a24:	89 c2                	mov    %eax,%edx
+  800a26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2a:	83 c0 08             	add    $0x8,%eax
+  800a2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a30:	4c 8b 22             	mov    (%rdx),%r12
+  800a33:	eb 17                	jmp    800a4c <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800a35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a38:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3b:	77 21                	ja     800a5e <vprintfmt+0x35e>
+  800a3d:	89 c2                	mov    %eax,%edx
+  800a3f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a43:	83 c0 08             	add    $0x8,%eax
+  800a46:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a49:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a4c:	4d 85 e4             	test   %r12,%r12
+  800a4f:	78 7a                	js     800acb <vprintfmt+0x3cb>
+            num = i;
+  800a51:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a54:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a59:	e9 b5 02 00 00       	jmp    800d13 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6a:	eb dd                	jmp    800a49 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800a6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a72:	77 11                	ja     800a85 <vprintfmt+0x385>
+  800a74:	89 c2                	mov    %eax,%edx
+  800a76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7a:	83 c0 08             	add    $0x8,%eax
+  800a7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a80:	4c 63 22             	movslq (%rdx),%r12
+  800a83:	eb c7                	jmp    800a4c <vprintfmt+0x34c>
+  800a85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a91:	eb ed                	jmp    800a80 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800a93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a96:	83 f8 2f             	cmp    $0x2f,%eax
+  800a99:	77 11                	ja     800aac <vprintfmt+0x3ac>
+  800a9b:	89 c2                	mov    %eax,%edx
+  800a9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa1:	83 c0 08             	add    $0x8,%eax
+  800aa4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa7:	4c 8b 22             	mov    (%rdx),%r12
+  800aaa:	eb a0                	jmp    800a4c <vprintfmt+0x34c>
+  800aac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab8:	eb ed                	jmp    800aa7 <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800aba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac6:	e9 65 ff ff ff       	jmp    800a30 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800acb:	4c 89 ee             	mov    %r13,%rsi
+  800ace:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ad3:	41 ff d6             	call   *%r14
+                i = -i;
+  800ad6:	49 f7 dc             	neg    %r12
+  800ad9:	e9 73 ff ff ff       	jmp    800a51 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800ade:	40 84 f6             	test   %sil,%sil
+  800ae1:	75 32                	jne    800b15 <vprintfmt+0x415>
+    switch (lflag) {
+  800ae3:	85 d2                	test   %edx,%edx
+  800ae5:	74 5d                	je     800b44 <vprintfmt+0x444>
+  800ae7:	83 fa 01             	cmp    $0x1,%edx
+  800aea:	0f 84 82 00 00 00    	je     800b72 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800af0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af3:	83 f8 2f             	cmp    $0x2f,%eax
+  800af6:	0f 87 a5 00 00 00    	ja     800ba1 <vprintfmt+0x4a1>
+  800afc:	89 c2                	mov    %eax,%edx
+  800afe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b02:	83 c0 08             	add    $0x8,%eax
+  800b05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b08:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b0b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b10:	e9 fe 01 00 00       	jmp    800d13 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800b15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b18:	83 f8 2f             	cmp    $0x2f,%eax
+  800b1b:	77 19                	ja     800b36 <vprintfmt+0x436>
+  800b1d:	89 c2                	mov    %eax,%edx
+  800b1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b23:	83 c0 08             	add    $0x8,%eax
+  800b26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b29:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b2c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b31:	e9 dd 01 00 00       	jmp    800d13 <vprintfmt+0x613>
+  800b36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b42:	eb e5                	jmp    800b29 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800b44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b47:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4a:	77 18                	ja     800b64 <vprintfmt+0x464>
+  800b4c:	89 c2                	mov    %eax,%edx
+  800b4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b52:	83 c0 08             	add    $0x8,%eax
+  800b55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b58:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b5a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b5f:	e9 af 01 00 00       	jmp    800d13 <vprintfmt+0x613>
+  800b64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b70:	eb e6                	jmp    800b58 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800b72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b75:	83 f8 2f             	cmp    $0x2f,%eax
+  800b78:	77 19                	ja     800b93 <vprintfmt+0x493>
+  800b7a:	89 c2                	mov    %eax,%edx
+  800b7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b80:	83 c0 08             	add    $0x8,%eax
+  800b83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b86:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b89:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b8e:	e9 80 01 00 00       	jmp    800d13 <vprintfmt+0x613>
+  800b93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9f:	eb e5                	jmp    800b86 <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800ba1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bad:	e9 56 ff ff ff       	jmp    800b08 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800bb2:	40 84 f6             	test   %sil,%sil
+  800bb5:	75 2e                	jne    800be5 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800bb7:	85 d2                	test   %edx,%edx
+  800bb9:	0f 84 b3 00 00 00    	je     800c72 <vprintfmt+0x572>
+  800bbf:	83 fa 01             	cmp    $0x1,%edx
+  800bc2:	0f 84 d3 00 00 00    	je     800c9b <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800bc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bcb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bce:	0f 87 f1 00 00 00    	ja     800cc5 <vprintfmt+0x5c5>
+  800bd4:	89 c2                	mov    %eax,%edx
+  800bd6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bda:	83 c0 08             	add    $0x8,%eax
+  800bdd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be0:	48 8b 02             	mov    (%rdx),%rax
+  800be3:	eb 17                	jmp    800bfc <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800be5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be8:	83 f8 2f             	cmp    $0x2f,%eax
+  800beb:	77 77                	ja     800c64 <vprintfmt+0x564>
+  800bed:	89 c2                	mov    %eax,%edx
+  800bef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf3:	83 c0 08             	add    $0x8,%eax
+  800bf6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf9:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800bfc:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800bfe:	83 f8 07             	cmp    $0x7,%eax
+  800c01:	0f 8e cf 00 00 00    	jle    800cd6 <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800c07:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800c0d:	44 89 e7             	mov    %r12d,%edi
+  800c10:	41 c1 e4 03          	shl    $0x3,%r12d
+  800c14:	89 d1                	mov    %edx,%ecx
+  800c16:	8d 72 07             	lea    0x7(%rdx),%esi
+  800c19:	85 d2                	test   %edx,%edx
+  800c1b:	0f 48 d6             	cmovs  %esi,%edx
+  800c1e:	c1 fa 03             	sar    $0x3,%edx
+  800c21:	83 f9 3f             	cmp    $0x3f,%ecx
+  800c24:	7f e7                	jg     800c0d <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800c26:	85 ff                	test   %edi,%edi
+  800c28:	0f 84 03 fb ff ff    	je     800731 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800c2e:	49 63 f4             	movslq %r12d,%rsi
+  800c31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c36:	48 f7 f6             	div    %rsi
+  800c39:	49 89 d7             	mov    %rdx,%r15
+  800c3c:	83 c0 30             	add    $0x30,%eax
+  800c3f:	0f be f8             	movsbl %al,%edi
+  800c42:	4c 89 ee             	mov    %r13,%rsi
+  800c45:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800c48:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800c4b:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800c50:	45 85 e4             	test   %r12d,%r12d
+  800c53:	41 0f 49 d4          	cmovns %r12d,%edx
+  800c57:	c1 fa 03             	sar    $0x3,%edx
+  800c5a:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800c5d:	75 cf                	jne    800c2e <vprintfmt+0x52e>
+  800c5f:	e9 cd fa ff ff       	jmp    800731 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800c64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c70:	eb 87                	jmp    800bf9 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800c72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c75:	83 f8 2f             	cmp    $0x2f,%eax
+  800c78:	77 13                	ja     800c8d <vprintfmt+0x58d>
+  800c7a:	89 c2                	mov    %eax,%edx
+  800c7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c80:	83 c0 08             	add    $0x8,%eax
+  800c83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c86:	8b 02                	mov    (%rdx),%eax
+  800c88:	e9 6f ff ff ff       	jmp    800bfc <vprintfmt+0x4fc>
+  800c8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c99:	eb eb                	jmp    800c86 <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800c9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9e:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca1:	77 14                	ja     800cb7 <vprintfmt+0x5b7>
+  800ca3:	89 c2                	mov    %eax,%edx
+  800ca5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca9:	83 c0 08             	add    $0x8,%eax
+  800cac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800caf:	48 8b 02             	mov    (%rdx),%rax
+  800cb2:	e9 45 ff ff ff       	jmp    800bfc <vprintfmt+0x4fc>
+  800cb7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cbb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc3:	eb ea                	jmp    800caf <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800cc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ccd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd1:	e9 0a ff ff ff       	jmp    800be0 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800cd6:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800cdc:	e9 4d ff ff ff       	jmp    800c2e <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800ce1:	4c 89 ee             	mov    %r13,%rsi
+  800ce4:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ce9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800cec:	4c 89 ee             	mov    %r13,%rsi
+  800cef:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cf4:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cf7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfa:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfd:	77 47                	ja     800d46 <vprintfmt+0x646>
+  800cff:	89 c2                	mov    %eax,%edx
+  800d01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d05:	83 c0 08             	add    $0x8,%eax
+  800d08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d0e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d13:	48 83 ec 08          	sub    $0x8,%rsp
+  800d17:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d1b:	0f 94 c0             	sete   %al
+  800d1e:	0f b6 c0             	movzbl %al,%eax
+  800d21:	50                   	push   %rax
+  800d22:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d27:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d2b:	4c 89 ee             	mov    %r13,%rsi
+  800d2e:	4c 89 f7             	mov    %r14,%rdi
+  800d31:	48 b8 f5 05 80 00 00 	movabs $0x8005f5,%rax
+  800d38:	00 00 00 
+  800d3b:	ff d0                	call   *%rax
+            break;
+  800d3d:	48 83 c4 10          	add    $0x10,%rsp
+  800d41:	e9 eb f9 ff ff       	jmp    800731 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d52:	eb b7                	jmp    800d0b <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800d54:	40 84 f6             	test   %sil,%sil
+  800d57:	75 2b                	jne    800d84 <vprintfmt+0x684>
+    switch (lflag) {
+  800d59:	85 d2                	test   %edx,%edx
+  800d5b:	74 56                	je     800db3 <vprintfmt+0x6b3>
+  800d5d:	83 fa 01             	cmp    $0x1,%edx
+  800d60:	74 7f                	je     800de1 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800d62:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d65:	83 f8 2f             	cmp    $0x2f,%eax
+  800d68:	0f 87 a2 00 00 00    	ja     800e10 <vprintfmt+0x710>
+  800d6e:	89 c2                	mov    %eax,%edx
+  800d70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d74:	83 c0 08             	add    $0x8,%eax
+  800d77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d7a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d7d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d82:	eb 8f                	jmp    800d13 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800d84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d87:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8a:	77 19                	ja     800da5 <vprintfmt+0x6a5>
+  800d8c:	89 c2                	mov    %eax,%edx
+  800d8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d92:	83 c0 08             	add    $0x8,%eax
+  800d95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d98:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d9b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800da0:	e9 6e ff ff ff       	jmp    800d13 <vprintfmt+0x613>
+  800da5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db1:	eb e5                	jmp    800d98 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800db3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db6:	83 f8 2f             	cmp    $0x2f,%eax
+  800db9:	77 18                	ja     800dd3 <vprintfmt+0x6d3>
+  800dbb:	89 c2                	mov    %eax,%edx
+  800dbd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc1:	83 c0 08             	add    $0x8,%eax
+  800dc4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800dc9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800dce:	e9 40 ff ff ff       	jmp    800d13 <vprintfmt+0x613>
+  800dd3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ddb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ddf:	eb e6                	jmp    800dc7 <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800de1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de4:	83 f8 2f             	cmp    $0x2f,%eax
+  800de7:	77 19                	ja     800e02 <vprintfmt+0x702>
+  800de9:	89 c2                	mov    %eax,%edx
+  800deb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800def:	83 c0 08             	add    $0x8,%eax
+  800df2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800df8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800dfd:	e9 11 ff ff ff       	jmp    800d13 <vprintfmt+0x613>
+  800e02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e0e:	eb e5                	jmp    800df5 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800e10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e1c:	e9 59 ff ff ff       	jmp    800d7a <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800e21:	4c 89 ee             	mov    %r13,%rsi
+  800e24:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e29:	41 ff d6             	call   *%r14
+            break;
+  800e2c:	e9 00 f9 ff ff       	jmp    800731 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e31:	4c 89 ee             	mov    %r13,%rsi
+  800e34:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e39:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e3c:	48 83 eb 01          	sub    $0x1,%rbx
+  800e40:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e44:	75 f6                	jne    800e3c <vprintfmt+0x73c>
+  800e46:	e9 e6 f8 ff ff       	jmp    800731 <vprintfmt+0x31>
+}
+  800e4b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e4f:	5b                   	pop    %rbx
+  800e50:	41 5c                	pop    %r12
+  800e52:	41 5d                	pop    %r13
+  800e54:	41 5e                	pop    %r14
+  800e56:	41 5f                	pop    %r15
+  800e58:	5d                   	pop    %rbp
+  800e59:	c3                   	ret
+
+0000000000800e5a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e5a:	55                   	push   %rbp
+  800e5b:	48 89 e5             	mov    %rsp,%rbp
+  800e5e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e62:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e66:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e6b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e6f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e76:	48 85 ff             	test   %rdi,%rdi
+  800e79:	74 2b                	je     800ea6 <vsnprintf+0x4c>
+  800e7b:	48 85 f6             	test   %rsi,%rsi
+  800e7e:	74 26                	je     800ea6 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e80:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e84:	48 bf ab 06 80 00 00 	movabs $0x8006ab,%rdi
+  800e8b:	00 00 00 
+  800e8e:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  800e95:	00 00 00 
+  800e98:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e9e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ea1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ea4:	c9                   	leave
+  800ea5:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ea6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800eab:	eb f7                	jmp    800ea4 <vsnprintf+0x4a>
+
+0000000000800ead <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ead:	55                   	push   %rbp
+  800eae:	48 89 e5             	mov    %rsp,%rbp
+  800eb1:	48 83 ec 50          	sub    $0x50,%rsp
+  800eb5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800eb9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ebd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ec1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ec8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ecc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ed0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ed4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ed8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800edc:	48 b8 5a 0e 80 00 00 	movabs $0x800e5a,%rax
+  800ee3:	00 00 00 
+  800ee6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ee8:	c9                   	leave
+  800ee9:	c3                   	ret
+
+0000000000800eea <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800eea:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800eed:	74 10                	je     800eff <strlen+0x15>
+    size_t n = 0;
+  800eef:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ef4:	48 83 c0 01          	add    $0x1,%rax
+  800ef8:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800efc:	75 f6                	jne    800ef4 <strlen+0xa>
+  800efe:	c3                   	ret
+    size_t n = 0;
+  800eff:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f04:	c3                   	ret
+
+0000000000800f05 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f05:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f08:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f0d:	48 85 f6             	test   %rsi,%rsi
+  800f10:	74 11                	je     800f23 <strnlen+0x1e>
+  800f12:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f16:	74 0c                	je     800f24 <strnlen+0x1f>
+  800f18:	48 83 c2 01          	add    $0x1,%rdx
+  800f1c:	48 39 d0             	cmp    %rdx,%rax
+  800f1f:	75 f1                	jne    800f12 <strnlen+0xd>
+  800f21:	eb 04                	jmp    800f27 <strnlen+0x22>
+  800f23:	c3                   	ret
+  800f24:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f27:	c3                   	ret
+
+0000000000800f28 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f28:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f30:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f34:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f37:	48 83 c2 01          	add    $0x1,%rdx
+  800f3b:	84 c9                	test   %cl,%cl
+  800f3d:	75 f1                	jne    800f30 <strcpy+0x8>
+        ;
+    return res;
+}
+  800f3f:	c3                   	ret
+
+0000000000800f40 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f40:	55                   	push   %rbp
+  800f41:	48 89 e5             	mov    %rsp,%rbp
+  800f44:	41 54                	push   %r12
+  800f46:	53                   	push   %rbx
+  800f47:	48 89 fb             	mov    %rdi,%rbx
+  800f4a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f4d:	48 b8 ea 0e 80 00 00 	movabs $0x800eea,%rax
+  800f54:	00 00 00 
+  800f57:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f59:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f5d:	4c 89 e6             	mov    %r12,%rsi
+  800f60:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  800f67:	00 00 00 
+  800f6a:	ff d0                	call   *%rax
+    return dst;
+}
+  800f6c:	48 89 d8             	mov    %rbx,%rax
+  800f6f:	5b                   	pop    %rbx
+  800f70:	41 5c                	pop    %r12
+  800f72:	5d                   	pop    %rbp
+  800f73:	c3                   	ret
+
+0000000000800f74 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f74:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f77:	48 85 d2             	test   %rdx,%rdx
+  800f7a:	74 1f                	je     800f9b <strncpy+0x27>
+  800f7c:	48 01 fa             	add    %rdi,%rdx
+  800f7f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f82:	48 83 c1 01          	add    $0x1,%rcx
+  800f86:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f8a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f8e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f92:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f96:	48 39 ca             	cmp    %rcx,%rdx
+  800f99:	75 e7                	jne    800f82 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f9b:	c3                   	ret
+
+0000000000800f9c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f9c:	48 89 f8             	mov    %rdi,%rax
+  800f9f:	48 85 d2             	test   %rdx,%rdx
+  800fa2:	74 24                	je     800fc8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800fa4:	48 83 ea 01          	sub    $0x1,%rdx
+  800fa8:	74 1b                	je     800fc5 <strlcpy+0x29>
+  800faa:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800fae:	0f b6 16             	movzbl (%rsi),%edx
+  800fb1:	84 d2                	test   %dl,%dl
+  800fb3:	74 10                	je     800fc5 <strlcpy+0x29>
+            *dst++ = *src++;
+  800fb5:	48 83 c6 01          	add    $0x1,%rsi
+  800fb9:	48 83 c0 01          	add    $0x1,%rax
+  800fbd:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800fc0:	48 39 c8             	cmp    %rcx,%rax
+  800fc3:	75 e9                	jne    800fae <strlcpy+0x12>
+        *dst = '\0';
+  800fc5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800fc8:	48 29 f8             	sub    %rdi,%rax
+}
+  800fcb:	c3                   	ret
+
+0000000000800fcc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800fcc:	0f b6 07             	movzbl (%rdi),%eax
+  800fcf:	84 c0                	test   %al,%al
+  800fd1:	74 13                	je     800fe6 <strcmp+0x1a>
+  800fd3:	38 06                	cmp    %al,(%rsi)
+  800fd5:	75 0f                	jne    800fe6 <strcmp+0x1a>
+  800fd7:	48 83 c7 01          	add    $0x1,%rdi
+  800fdb:	48 83 c6 01          	add    $0x1,%rsi
+  800fdf:	0f b6 07             	movzbl (%rdi),%eax
+  800fe2:	84 c0                	test   %al,%al
+  800fe4:	75 ed                	jne    800fd3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fe6:	0f b6 c0             	movzbl %al,%eax
+  800fe9:	0f b6 16             	movzbl (%rsi),%edx
+  800fec:	29 d0                	sub    %edx,%eax
+}
+  800fee:	c3                   	ret
+
+0000000000800fef <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fef:	48 85 d2             	test   %rdx,%rdx
+  800ff2:	74 1f                	je     801013 <strncmp+0x24>
+  800ff4:	0f b6 07             	movzbl (%rdi),%eax
+  800ff7:	84 c0                	test   %al,%al
+  800ff9:	74 1e                	je     801019 <strncmp+0x2a>
+  800ffb:	3a 06                	cmp    (%rsi),%al
+  800ffd:	75 1a                	jne    801019 <strncmp+0x2a>
+  800fff:	48 83 c7 01          	add    $0x1,%rdi
+  801003:	48 83 c6 01          	add    $0x1,%rsi
+  801007:	48 83 ea 01          	sub    $0x1,%rdx
+  80100b:	75 e7                	jne    800ff4 <strncmp+0x5>
+
+    if (!n) return 0;
+  80100d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801012:	c3                   	ret
+  801013:	b8 00 00 00 00       	mov    $0x0,%eax
+  801018:	c3                   	ret
+  801019:	48 85 d2             	test   %rdx,%rdx
+  80101c:	74 09                	je     801027 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80101e:	0f b6 07             	movzbl (%rdi),%eax
+  801021:	0f b6 16             	movzbl (%rsi),%edx
+  801024:	29 d0                	sub    %edx,%eax
+  801026:	c3                   	ret
+    if (!n) return 0;
+  801027:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80102c:	c3                   	ret
+
+000000000080102d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80102d:	0f b6 17             	movzbl (%rdi),%edx
+  801030:	84 d2                	test   %dl,%dl
+  801032:	74 18                	je     80104c <strchr+0x1f>
+        if (*str == c) {
+  801034:	0f be d2             	movsbl %dl,%edx
+  801037:	39 f2                	cmp    %esi,%edx
+  801039:	74 17                	je     801052 <strchr+0x25>
+    for (; *str; str++) {
+  80103b:	48 83 c7 01          	add    $0x1,%rdi
+  80103f:	0f b6 17             	movzbl (%rdi),%edx
+  801042:	84 d2                	test   %dl,%dl
+  801044:	75 ee                	jne    801034 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104b:	c3                   	ret
+  80104c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801051:	c3                   	ret
+  801052:	48 89 f8             	mov    %rdi,%rax
+}
+  801055:	c3                   	ret
+
+0000000000801056 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801056:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801059:	0f b6 17             	movzbl (%rdi),%edx
+  80105c:	84 d2                	test   %dl,%dl
+  80105e:	74 13                	je     801073 <strfind+0x1d>
+  801060:	0f be d2             	movsbl %dl,%edx
+  801063:	39 f2                	cmp    %esi,%edx
+  801065:	74 0b                	je     801072 <strfind+0x1c>
+  801067:	48 83 c0 01          	add    $0x1,%rax
+  80106b:	0f b6 10             	movzbl (%rax),%edx
+  80106e:	84 d2                	test   %dl,%dl
+  801070:	75 ee                	jne    801060 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801072:	c3                   	ret
+  801073:	c3                   	ret
+
+0000000000801074 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  801074:	55                   	push   %rbp
+  801075:	48 89 e5             	mov    %rsp,%rbp
+  801078:	41 57                	push   %r15
+  80107a:	41 56                	push   %r14
+  80107c:	41 55                	push   %r13
+  80107e:	41 54                	push   %r12
+  801080:	53                   	push   %rbx
+  801081:	48 83 ec 08          	sub    $0x8,%rsp
+  801085:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  801088:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  80108c:	45 84 ed             	test   %r13b,%r13b
+  80108f:	75 12                	jne    8010a3 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  801091:	4c 89 f8             	mov    %r15,%rax
+  801094:	48 83 c4 08          	add    $0x8,%rsp
+  801098:	5b                   	pop    %rbx
+  801099:	41 5c                	pop    %r12
+  80109b:	41 5d                	pop    %r13
+  80109d:	41 5e                	pop    %r14
+  80109f:	41 5f                	pop    %r15
+  8010a1:	5d                   	pop    %rbp
+  8010a2:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  8010a3:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  8010a7:	4c 89 e7             	mov    %r12,%rdi
+  8010aa:	48 b8 ea 0e 80 00 00 	movabs $0x800eea,%rax
+  8010b1:	00 00 00 
+  8010b4:	ff d0                	call   *%rax
+  8010b6:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  8010b9:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  8010bd:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  8010c1:	49 bf ef 0f 80 00 00 	movabs $0x800fef,%r15
+  8010c8:	00 00 00 
+				if ((sc = *s++) == 0)
+  8010cb:	84 c0                	test   %al,%al
+  8010cd:	75 14                	jne    8010e3 <strstr+0x6f>
+					return NULL;
+  8010cf:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8010d5:	eb ba                	jmp    801091 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  8010d7:	48 83 c3 01          	add    $0x1,%rbx
+  8010db:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010df:	84 c0                	test   %al,%al
+  8010e1:	74 1b                	je     8010fe <strstr+0x8a>
+			} while (sc != c);
+  8010e3:	41 38 c5             	cmp    %al,%r13b
+  8010e6:	75 ef                	jne    8010d7 <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  8010e8:	4c 89 f2             	mov    %r14,%rdx
+  8010eb:	4c 89 e6             	mov    %r12,%rsi
+  8010ee:	48 89 df             	mov    %rbx,%rdi
+  8010f1:	41 ff d7             	call   *%r15
+  8010f4:	85 c0                	test   %eax,%eax
+  8010f6:	75 df                	jne    8010d7 <strstr+0x63>
+  8010f8:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  8010fc:	eb 93                	jmp    801091 <strstr+0x1d>
+					return NULL;
+  8010fe:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801104:	eb 8b                	jmp    801091 <strstr+0x1d>
+
+0000000000801106 <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  801106:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  801108:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  80110b:	8d 57 20             	lea    0x20(%rdi),%edx
+  80110e:	83 f9 1a             	cmp    $0x1a,%ecx
+  801111:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801114:	c3                   	ret
+
+0000000000801115 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  801115:	55                   	push   %rbp
+  801116:	48 89 e5             	mov    %rsp,%rbp
+  801119:	41 57                	push   %r15
+  80111b:	41 56                	push   %r14
+  80111d:	41 55                	push   %r13
+  80111f:	41 54                	push   %r12
+  801121:	53                   	push   %rbx
+  801122:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  801126:	48 39 f7             	cmp    %rsi,%rdi
+  801129:	74 49                	je     801174 <strcasecmp+0x5f>
+  80112b:	49 89 fd             	mov    %rdi,%r13
+  80112e:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  801131:	49 bf 06 11 80 00 00 	movabs $0x801106,%r15
+  801138:	00 00 00 
+  80113b:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801140:	41 0f b6 fe          	movzbl %r14b,%edi
+  801144:	41 ff d7             	call   *%r15
+  801147:	89 c3                	mov    %eax,%ebx
+  801149:	49 83 c4 01          	add    $0x1,%r12
+  80114d:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801153:	41 ff d7             	call   *%r15
+  801156:	29 c3                	sub    %eax,%ebx
+  801158:	75 09                	jne    801163 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  80115a:	49 83 c5 01          	add    $0x1,%r13
+  80115e:	45 84 f6             	test   %r14b,%r14b
+  801161:	75 d8                	jne    80113b <strcasecmp+0x26>
+}
+  801163:	89 d8                	mov    %ebx,%eax
+  801165:	48 83 c4 08          	add    $0x8,%rsp
+  801169:	5b                   	pop    %rbx
+  80116a:	41 5c                	pop    %r12
+  80116c:	41 5d                	pop    %r13
+  80116e:	41 5e                	pop    %r14
+  801170:	41 5f                	pop    %r15
+  801172:	5d                   	pop    %rbp
+  801173:	c3                   	ret
+        return 0;
+  801174:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801179:	eb e8                	jmp    801163 <strcasecmp+0x4e>
+
+000000000080117b <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80117b:	55                   	push   %rbp
+  80117c:	48 89 e5             	mov    %rsp,%rbp
+  80117f:	41 57                	push   %r15
+  801181:	41 56                	push   %r14
+  801183:	41 55                	push   %r13
+  801185:	41 54                	push   %r12
+  801187:	53                   	push   %rbx
+  801188:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  80118c:	48 85 d2             	test   %rdx,%rdx
+  80118f:	74 4f                	je     8011e0 <strncasecmp+0x65>
+  801191:	49 89 fc             	mov    %rdi,%r12
+  801194:	49 89 f5             	mov    %rsi,%r13
+  801197:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  80119b:	49 be 06 11 80 00 00 	movabs $0x801106,%r14
+  8011a2:	00 00 00 
+  8011a5:	49 83 c4 01          	add    $0x1,%r12
+  8011a9:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8011af:	41 ff d6             	call   *%r14
+  8011b2:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  8011b4:	49 83 c5 01          	add    $0x1,%r13
+  8011b8:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  8011bd:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  8011c0:	29 c3                	sub    %eax,%ebx
+  8011c2:	85 c0                	test   %eax,%eax
+  8011c4:	74 09                	je     8011cf <strncasecmp+0x54>
+  8011c6:	85 db                	test   %ebx,%ebx
+  8011c8:	75 05                	jne    8011cf <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8011ca:	4d 39 fc             	cmp    %r15,%r12
+  8011cd:	75 d6                	jne    8011a5 <strncasecmp+0x2a>
+}
+  8011cf:	89 d8                	mov    %ebx,%eax
+  8011d1:	48 83 c4 08          	add    $0x8,%rsp
+  8011d5:	5b                   	pop    %rbx
+  8011d6:	41 5c                	pop    %r12
+  8011d8:	41 5d                	pop    %r13
+  8011da:	41 5e                	pop    %r14
+  8011dc:	41 5f                	pop    %r15
+  8011de:	5d                   	pop    %rbp
+  8011df:	c3                   	ret
+    int d = 0;
+  8011e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  8011e5:	eb e8                	jmp    8011cf <strncasecmp+0x54>
+
+00000000008011e7 <toupper>:
+
+int toupper(int c) {
+  8011e7:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  8011e9:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  8011ec:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8011ef:	83 f9 1a             	cmp    $0x1a,%ecx
+  8011f2:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8011f5:	c3                   	ret
+
+00000000008011f6 <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  8011f6:	83 ff 20             	cmp    $0x20,%edi
+  8011f9:	0f 94 c0             	sete   %al
+  8011fc:	0f b6 c0             	movzbl %al,%eax
+}
+  8011ff:	c3                   	ret
+
+0000000000801200 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  801200:	89 f8                	mov    %edi,%eax
+  801202:	f7 d8                	neg    %eax
+  801204:	0f 48 c7             	cmovs  %edi,%eax
+}
+  801207:	c3                   	ret
+
+0000000000801208 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801208:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80120b:	48 89 f8             	mov    %rdi,%rax
+  80120e:	48 f7 d8             	neg    %rax
+  801211:	83 e0 07             	and    $0x7,%eax
+  801214:	49 89 d1             	mov    %rdx,%r9
+  801217:	49 29 c1             	sub    %rax,%r9
+  80121a:	78 36                	js     801252 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80121c:	40 0f b6 c6          	movzbl %sil,%eax
+  801220:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801227:	01 01 01 
+  80122a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80122e:	40 f6 c7 07          	test   $0x7,%dil
+  801232:	75 38                	jne    80126c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801234:	4c 89 c9             	mov    %r9,%rcx
+  801237:	48 c1 f9 03          	sar    $0x3,%rcx
+  80123b:	74 0c                	je     801249 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80123d:	fc                   	cld
+  80123e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801241:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801245:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801249:	4d 85 c9             	test   %r9,%r9
+  80124c:	75 45                	jne    801293 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80124e:	4c 89 c0             	mov    %r8,%rax
+  801251:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801252:	48 85 d2             	test   %rdx,%rdx
+  801255:	74 f7                	je     80124e <memset+0x46>
+  801257:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80125a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80125d:	48 83 c0 01          	add    $0x1,%rax
+  801261:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801265:	48 39 c2             	cmp    %rax,%rdx
+  801268:	75 f3                	jne    80125d <memset+0x55>
+  80126a:	eb e2                	jmp    80124e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80126c:	40 f6 c7 01          	test   $0x1,%dil
+  801270:	74 06                	je     801278 <memset+0x70>
+  801272:	88 07                	mov    %al,(%rdi)
+  801274:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801278:	40 f6 c7 02          	test   $0x2,%dil
+  80127c:	74 07                	je     801285 <memset+0x7d>
+  80127e:	66 89 07             	mov    %ax,(%rdi)
+  801281:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801285:	40 f6 c7 04          	test   $0x4,%dil
+  801289:	74 a9                	je     801234 <memset+0x2c>
+  80128b:	89 07                	mov    %eax,(%rdi)
+  80128d:	48 83 c7 04          	add    $0x4,%rdi
+  801291:	eb a1                	jmp    801234 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801293:	41 f6 c1 04          	test   $0x4,%r9b
+  801297:	74 06                	je     80129f <memset+0x97>
+  801299:	89 07                	mov    %eax,(%rdi)
+  80129b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80129f:	41 f6 c1 02          	test   $0x2,%r9b
+  8012a3:	74 07                	je     8012ac <memset+0xa4>
+  8012a5:	66 89 07             	mov    %ax,(%rdi)
+  8012a8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8012ac:	41 f6 c1 01          	test   $0x1,%r9b
+  8012b0:	74 9c                	je     80124e <memset+0x46>
+  8012b2:	88 07                	mov    %al,(%rdi)
+  8012b4:	eb 98                	jmp    80124e <memset+0x46>
+
+00000000008012b6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8012b6:	48 89 f8             	mov    %rdi,%rax
+  8012b9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8012bc:	48 39 fe             	cmp    %rdi,%rsi
+  8012bf:	73 3b                	jae    8012fc <memmove+0x46>
+  8012c1:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8012c5:	48 39 d7             	cmp    %rdx,%rdi
+  8012c8:	73 32                	jae    8012fc <memmove+0x46>
+        s += n;
+        d += n;
+  8012ca:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012ce:	48 89 d6             	mov    %rdx,%rsi
+  8012d1:	48 09 fe             	or     %rdi,%rsi
+  8012d4:	48 09 ce             	or     %rcx,%rsi
+  8012d7:	40 f6 c6 07          	test   $0x7,%sil
+  8012db:	75 12                	jne    8012ef <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8012dd:	48 83 ef 08          	sub    $0x8,%rdi
+  8012e1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8012e5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012e9:	fd                   	std
+  8012ea:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012ed:	fc                   	cld
+  8012ee:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012ef:	48 83 ef 01          	sub    $0x1,%rdi
+  8012f3:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8012f7:	fd                   	std
+  8012f8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8012fa:	eb f1                	jmp    8012ed <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012fc:	48 89 f2             	mov    %rsi,%rdx
+  8012ff:	48 09 c2             	or     %rax,%rdx
+  801302:	48 09 ca             	or     %rcx,%rdx
+  801305:	f6 c2 07             	test   $0x7,%dl
+  801308:	75 0c                	jne    801316 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80130a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80130e:	48 89 c7             	mov    %rax,%rdi
+  801311:	fc                   	cld
+  801312:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801315:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801316:	48 89 c7             	mov    %rax,%rdi
+  801319:	fc                   	cld
+  80131a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80131c:	c3                   	ret
+
+000000000080131d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80131d:	55                   	push   %rbp
+  80131e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801321:	48 b8 b6 12 80 00 00 	movabs $0x8012b6,%rax
+  801328:	00 00 00 
+  80132b:	ff d0                	call   *%rax
+}
+  80132d:	5d                   	pop    %rbp
+  80132e:	c3                   	ret
+
+000000000080132f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80132f:	55                   	push   %rbp
+  801330:	48 89 e5             	mov    %rsp,%rbp
+  801333:	41 57                	push   %r15
+  801335:	41 56                	push   %r14
+  801337:	41 55                	push   %r13
+  801339:	41 54                	push   %r12
+  80133b:	53                   	push   %rbx
+  80133c:	48 83 ec 08          	sub    $0x8,%rsp
+  801340:	49 89 fe             	mov    %rdi,%r14
+  801343:	49 89 f7             	mov    %rsi,%r15
+  801346:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801349:	48 89 f7             	mov    %rsi,%rdi
+  80134c:	48 b8 ea 0e 80 00 00 	movabs $0x800eea,%rax
+  801353:	00 00 00 
+  801356:	ff d0                	call   *%rax
+  801358:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80135b:	48 89 de             	mov    %rbx,%rsi
+  80135e:	4c 89 f7             	mov    %r14,%rdi
+  801361:	48 b8 05 0f 80 00 00 	movabs $0x800f05,%rax
+  801368:	00 00 00 
+  80136b:	ff d0                	call   *%rax
+  80136d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801370:	48 39 c3             	cmp    %rax,%rbx
+  801373:	74 36                	je     8013ab <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801375:	48 89 d8             	mov    %rbx,%rax
+  801378:	4c 29 e8             	sub    %r13,%rax
+  80137b:	49 39 c4             	cmp    %rax,%r12
+  80137e:	73 31                	jae    8013b1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801380:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801385:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801389:	4c 89 fe             	mov    %r15,%rsi
+  80138c:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  801393:	00 00 00 
+  801396:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801398:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80139c:	48 83 c4 08          	add    $0x8,%rsp
+  8013a0:	5b                   	pop    %rbx
+  8013a1:	41 5c                	pop    %r12
+  8013a3:	41 5d                	pop    %r13
+  8013a5:	41 5e                	pop    %r14
+  8013a7:	41 5f                	pop    %r15
+  8013a9:	5d                   	pop    %rbp
+  8013aa:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8013ab:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013af:	eb eb                	jmp    80139c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8013b1:	48 83 eb 01          	sub    $0x1,%rbx
+  8013b5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013b9:	48 89 da             	mov    %rbx,%rdx
+  8013bc:	4c 89 fe             	mov    %r15,%rsi
+  8013bf:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  8013c6:	00 00 00 
+  8013c9:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8013cb:	49 01 de             	add    %rbx,%r14
+  8013ce:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8013d3:	eb c3                	jmp    801398 <strlcat+0x69>
+
+00000000008013d5 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8013d5:	48 85 d2             	test   %rdx,%rdx
+  8013d8:	74 2d                	je     801407 <memcmp+0x32>
+  8013da:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8013df:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8013e3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013e8:	44 38 c1             	cmp    %r8b,%cl
+  8013eb:	75 0f                	jne    8013fc <memcmp+0x27>
+    while (n-- > 0) {
+  8013ed:	48 83 c0 01          	add    $0x1,%rax
+  8013f1:	48 39 c2             	cmp    %rax,%rdx
+  8013f4:	75 e9                	jne    8013df <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8013f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fb:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8013fc:	0f b6 c1             	movzbl %cl,%eax
+  8013ff:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801403:	44 29 c0             	sub    %r8d,%eax
+  801406:	c3                   	ret
+    return 0;
+  801407:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80140c:	c3                   	ret
+
+000000000080140d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80140d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801411:	48 39 c7             	cmp    %rax,%rdi
+  801414:	73 0f                	jae    801425 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801416:	40 38 37             	cmp    %sil,(%rdi)
+  801419:	74 0e                	je     801429 <memfind+0x1c>
+    for (; src < end; src++) {
+  80141b:	48 83 c7 01          	add    $0x1,%rdi
+  80141f:	48 39 f8             	cmp    %rdi,%rax
+  801422:	75 f2                	jne    801416 <memfind+0x9>
+  801424:	c3                   	ret
+  801425:	48 89 f8             	mov    %rdi,%rax
+  801428:	c3                   	ret
+  801429:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80142c:	c3                   	ret
+
+000000000080142d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80142d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801430:	0f b6 37             	movzbl (%rdi),%esi
+  801433:	40 80 fe 20          	cmp    $0x20,%sil
+  801437:	74 06                	je     80143f <strtol+0x12>
+  801439:	40 80 fe 09          	cmp    $0x9,%sil
+  80143d:	75 13                	jne    801452 <strtol+0x25>
+  80143f:	48 83 c7 01          	add    $0x1,%rdi
+  801443:	0f b6 37             	movzbl (%rdi),%esi
+  801446:	40 80 fe 20          	cmp    $0x20,%sil
+  80144a:	74 f3                	je     80143f <strtol+0x12>
+  80144c:	40 80 fe 09          	cmp    $0x9,%sil
+  801450:	74 ed                	je     80143f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801452:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801455:	83 e0 fd             	and    $0xfffffffd,%eax
+  801458:	3c 01                	cmp    $0x1,%al
+  80145a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80145e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801464:	75 0f                	jne    801475 <strtol+0x48>
+  801466:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801469:	74 14                	je     80147f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80146b:	85 d2                	test   %edx,%edx
+  80146d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801472:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801475:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80147a:	4c 63 ca             	movslq %edx,%r9
+  80147d:	eb 36                	jmp    8014b5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80147f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801483:	74 0f                	je     801494 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801485:	85 d2                	test   %edx,%edx
+  801487:	75 ec                	jne    801475 <strtol+0x48>
+        s++;
+  801489:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80148d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801492:	eb e1                	jmp    801475 <strtol+0x48>
+        s += 2;
+  801494:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801498:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80149d:	eb d6                	jmp    801475 <strtol+0x48>
+            dig -= '0';
+  80149f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8014a2:	44 0f b6 c1          	movzbl %cl,%r8d
+  8014a6:	41 39 d0             	cmp    %edx,%r8d
+  8014a9:	7d 21                	jge    8014cc <strtol+0x9f>
+        val = val * base + dig;
+  8014ab:	49 0f af c1          	imul   %r9,%rax
+  8014af:	0f b6 c9             	movzbl %cl,%ecx
+  8014b2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8014b5:	48 83 c7 01          	add    $0x1,%rdi
+  8014b9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8014bd:	80 f9 39             	cmp    $0x39,%cl
+  8014c0:	76 dd                	jbe    80149f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8014c2:	80 f9 7b             	cmp    $0x7b,%cl
+  8014c5:	77 05                	ja     8014cc <strtol+0x9f>
+            dig -= 'a' - 10;
+  8014c7:	83 e9 57             	sub    $0x57,%ecx
+  8014ca:	eb d6                	jmp    8014a2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8014cc:	4d 85 d2             	test   %r10,%r10
+  8014cf:	74 03                	je     8014d4 <strtol+0xa7>
+  8014d1:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8014d4:	48 89 c2             	mov    %rax,%rdx
+  8014d7:	48 f7 da             	neg    %rdx
+  8014da:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8014de:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8014e2:	c3                   	ret
+
+00000000008014e3 <atoi>:
+int atoi(const char *str) {
+  8014e3:	55                   	push   %rbp
+  8014e4:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8014e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f1:	48 b8 2d 14 80 00 00 	movabs $0x80142d,%rax
+  8014f8:	00 00 00 
+  8014fb:	ff d0                	call   *%rax
+}
+  8014fd:	5d                   	pop    %rbp
+  8014fe:	c3                   	ret
+
+00000000008014ff <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  8014ff:	55                   	push   %rbp
+  801500:	48 89 e5             	mov    %rsp,%rbp
+  801503:	41 57                	push   %r15
+  801505:	41 56                	push   %r14
+  801507:	41 55                	push   %r13
+  801509:	41 54                	push   %r12
+  80150b:	53                   	push   %rbx
+  80150c:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  801510:	48 85 ff             	test   %rdi,%rdi
+  801513:	74 23                	je     801538 <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  801515:	48 89 fa             	mov    %rdi,%rdx
+  801518:	48 be 39 57 80 00 00 	movabs $0x805739,%rsi
+  80151f:	00 00 00 
+  801522:	bf 01 00 00 00       	mov    $0x1,%edi
+  801527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152c:	48 b9 16 3b 80 00 00 	movabs $0x803b16,%rcx
+  801533:	00 00 00 
+  801536:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  801538:	bf 00 00 00 00       	mov    $0x0,%edi
+  80153d:	48 b8 f7 02 80 00 00 	movabs $0x8002f7,%rax
+  801544:	00 00 00 
+  801547:	ff d0                	call   *%rax
+  801549:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  80154c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  801552:	49 bd be 02 80 00 00 	movabs $0x8002be,%r13
+  801559:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  80155c:	49 bf 9b 02 80 00 00 	movabs $0x80029b,%r15
+  801563:	00 00 00 
+  801566:	eb 46                	jmp    8015ae <readline+0xaf>
+            return NULL;
+  801568:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  80156d:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  801570:	75 0f                	jne    801581 <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  801572:	48 83 c4 08          	add    $0x8,%rsp
+  801576:	5b                   	pop    %rbx
+  801577:	41 5c                	pop    %r12
+  801579:	41 5d                	pop    %r13
+  80157b:	41 5e                	pop    %r14
+  80157d:	41 5f                	pop    %r15
+  80157f:	5d                   	pop    %rbp
+  801580:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  801581:	89 de                	mov    %ebx,%esi
+  801583:	48 bf bf 55 80 00 00 	movabs $0x8055bf,%rdi
+  80158a:	00 00 00 
+  80158d:	48 ba b0 05 80 00 00 	movabs $0x8005b0,%rdx
+  801594:	00 00 00 
+  801597:	ff d2                	call   *%rdx
+            return NULL;
+  801599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159e:	eb d2                	jmp    801572 <readline+0x73>
+            if (i) {
+  8015a0:	4d 85 e4             	test   %r12,%r12
+  8015a3:	74 09                	je     8015ae <readline+0xaf>
+                if (echo) {
+  8015a5:	45 85 f6             	test   %r14d,%r14d
+  8015a8:	75 3f                	jne    8015e9 <readline+0xea>
+                i--;
+  8015aa:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  8015ae:	41 ff d5             	call   *%r13
+  8015b1:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  8015b3:	85 c0                	test   %eax,%eax
+  8015b5:	78 b1                	js     801568 <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  8015b7:	83 f8 08             	cmp    $0x8,%eax
+  8015ba:	74 e4                	je     8015a0 <readline+0xa1>
+  8015bc:	83 f8 7f             	cmp    $0x7f,%eax
+  8015bf:	74 df                	je     8015a0 <readline+0xa1>
+        } else if (c >= ' ') {
+  8015c1:	83 f8 1f             	cmp    $0x1f,%eax
+  8015c4:	7e 4d                	jle    801613 <readline+0x114>
+            if (i < BUFLEN - 1) {
+  8015c6:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  8015cd:	77 df                	ja     8015ae <readline+0xaf>
+                if (echo) {
+  8015cf:	45 85 f6             	test   %r14d,%r14d
+  8015d2:	75 2f                	jne    801603 <readline+0x104>
+                buf[i++] = (char)c;
+  8015d4:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8015db:	00 00 00 
+  8015de:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  8015e2:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  8015e7:	eb c5                	jmp    8015ae <readline+0xaf>
+                    cputchar('\b');
+  8015e9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8015ee:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  8015f1:	bf 20 00 00 00       	mov    $0x20,%edi
+  8015f6:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  8015f9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8015fe:	41 ff d7             	call   *%r15
+  801601:	eb a7                	jmp    8015aa <readline+0xab>
+                    cputchar(c);
+  801603:	89 c7                	mov    %eax,%edi
+  801605:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  80160c:	00 00 00 
+  80160f:	ff d0                	call   *%rax
+  801611:	eb c1                	jmp    8015d4 <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  801613:	83 f8 0a             	cmp    $0xa,%eax
+  801616:	74 05                	je     80161d <readline+0x11e>
+  801618:	83 f8 0d             	cmp    $0xd,%eax
+  80161b:	75 91                	jne    8015ae <readline+0xaf>
+            if (echo) {
+  80161d:	45 85 f6             	test   %r14d,%r14d
+  801620:	75 14                	jne    801636 <readline+0x137>
+            buf[i] = 0;
+  801622:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  801629:	00 00 00 
+  80162c:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  801631:	e9 3c ff ff ff       	jmp    801572 <readline+0x73>
+                cputchar('\n');
+  801636:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80163b:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  801642:	00 00 00 
+  801645:	ff d0                	call   *%rax
+  801647:	eb d9                	jmp    801622 <readline+0x123>
+
+0000000000801649 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801649:	55                   	push   %rbp
+  80164a:	48 89 e5             	mov    %rsp,%rbp
+  80164d:	53                   	push   %rbx
+  80164e:	48 89 fa             	mov    %rdi,%rdx
+  801651:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801654:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801659:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801663:	be 00 00 00 00       	mov    $0x0,%esi
+  801668:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80166e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801670:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801674:	c9                   	leave
+  801675:	c3                   	ret
+
+0000000000801676 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801676:	55                   	push   %rbp
+  801677:	48 89 e5             	mov    %rsp,%rbp
+  80167a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80167b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801680:	ba 00 00 00 00       	mov    $0x0,%edx
+  801685:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80168a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801694:	be 00 00 00 00       	mov    $0x0,%esi
+  801699:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a5:	c9                   	leave
+  8016a6:	c3                   	ret
+
+00000000008016a7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8016a7:	55                   	push   %rbp
+  8016a8:	48 89 e5             	mov    %rsp,%rbp
+  8016ab:	53                   	push   %rbx
+  8016ac:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8016b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b3:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d4:	48 85 c0             	test   %rax,%rax
+  8016d7:	7f 06                	jg     8016df <sys_env_destroy+0x38>
+}
+  8016d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016dd:	c9                   	leave
+  8016de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016df:	49 89 c0             	mov    %rax,%r8
+  8016e2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8016e7:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  8016ee:	00 00 00 
+  8016f1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016f6:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  8016fd:	00 00 00 
+  801700:	b8 00 00 00 00       	mov    $0x0,%eax
+  801705:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  80170c:	00 00 00 
+  80170f:	41 ff d1             	call   *%r9
+
+0000000000801712 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801712:	55                   	push   %rbp
+  801713:	48 89 e5             	mov    %rsp,%rbp
+  801716:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801717:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80171c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801721:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801726:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801730:	be 00 00 00 00       	mov    $0x0,%esi
+  801735:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80173b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80173d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801741:	c9                   	leave
+  801742:	c3                   	ret
+
+0000000000801743 <sys_yield>:
+
+void
+sys_yield(void) {
+  801743:	55                   	push   %rbp
+  801744:	48 89 e5             	mov    %rsp,%rbp
+  801747:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801748:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80174d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801752:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801757:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801761:	be 00 00 00 00       	mov    $0x0,%esi
+  801766:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80176c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80176e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801772:	c9                   	leave
+  801773:	c3                   	ret
+
+0000000000801774 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801774:	55                   	push   %rbp
+  801775:	48 89 e5             	mov    %rsp,%rbp
+  801778:	53                   	push   %rbx
+  801779:	48 89 fa             	mov    %rdi,%rdx
+  80177c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80177f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801784:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80178b:	00 00 00 
+  80178e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801793:	be 00 00 00 00       	mov    $0x0,%esi
+  801798:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80179e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8017a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017a4:	c9                   	leave
+  8017a5:	c3                   	ret
+
+00000000008017a6 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8017a6:	55                   	push   %rbp
+  8017a7:	48 89 e5             	mov    %rsp,%rbp
+  8017aa:	53                   	push   %rbx
+  8017ab:	49 89 f8             	mov    %rdi,%r8
+  8017ae:	48 89 d3             	mov    %rdx,%rbx
+  8017b1:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017b9:	4c 89 c2             	mov    %r8,%rdx
+  8017bc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ca:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8017cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d0:	c9                   	leave
+  8017d1:	c3                   	ret
+
+00000000008017d2 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8017d2:	55                   	push   %rbp
+  8017d3:	48 89 e5             	mov    %rsp,%rbp
+  8017d6:	53                   	push   %rbx
+  8017d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017db:	89 f8                	mov    %edi,%eax
+  8017dd:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8017e0:	48 63 f9             	movslq %ecx,%rdi
+  8017e3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e6:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017eb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017fb:	48 85 c0             	test   %rax,%rax
+  8017fe:	7f 06                	jg     801806 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801800:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801804:	c9                   	leave
+  801805:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801806:	49 89 c0             	mov    %rax,%r8
+  801809:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80180e:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  801815:	00 00 00 
+  801818:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80181d:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801824:	00 00 00 
+  801827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182c:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801833:	00 00 00 
+  801836:	41 ff d1             	call   *%r9
+
+0000000000801839 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801839:	55                   	push   %rbp
+  80183a:	48 89 e5             	mov    %rsp,%rbp
+  80183d:	53                   	push   %rbx
+  80183e:	48 83 ec 08          	sub    $0x8,%rsp
+  801842:	89 f8                	mov    %edi,%eax
+  801844:	49 89 f2             	mov    %rsi,%r10
+  801847:	48 89 cf             	mov    %rcx,%rdi
+  80184a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80184d:	48 63 da             	movslq %edx,%rbx
+  801850:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801853:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801858:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80185b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80185e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801860:	48 85 c0             	test   %rax,%rax
+  801863:	7f 06                	jg     80186b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801865:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801869:	c9                   	leave
+  80186a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80186b:	49 89 c0             	mov    %rax,%r8
+  80186e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801873:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  80187a:	00 00 00 
+  80187d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801882:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801889:	00 00 00 
+  80188c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801891:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801898:	00 00 00 
+  80189b:	41 ff d1             	call   *%r9
+
+000000000080189e <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80189e:	55                   	push   %rbp
+  80189f:	48 89 e5             	mov    %rsp,%rbp
+  8018a2:	53                   	push   %rbx
+  8018a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8018a7:	49 89 f9             	mov    %rdi,%r9
+  8018aa:	89 f0                	mov    %esi,%eax
+  8018ac:	48 89 d3             	mov    %rdx,%rbx
+  8018af:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8018b2:	49 63 f0             	movslq %r8d,%rsi
+  8018b5:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b8:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018bd:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018c8:	48 85 c0             	test   %rax,%rax
+  8018cb:	7f 06                	jg     8018d3 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8018cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d1:	c9                   	leave
+  8018d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d3:	49 89 c0             	mov    %rax,%r8
+  8018d6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018db:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  8018e2:	00 00 00 
+  8018e5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018ea:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  8018f1:	00 00 00 
+  8018f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f9:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801900:	00 00 00 
+  801903:	41 ff d1             	call   *%r9
+
+0000000000801906 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801906:	55                   	push   %rbp
+  801907:	48 89 e5             	mov    %rsp,%rbp
+  80190a:	53                   	push   %rbx
+  80190b:	89 f8                	mov    %edi,%eax
+  80190d:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  801910:	48 63 f9             	movslq %ecx,%rdi
+  801913:	48 63 da             	movslq %edx,%rbx
+  801916:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801919:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80191e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801921:	be 00 00 00 00       	mov    $0x0,%esi
+  801926:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80192c:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80192e:	89 c2                	mov    %eax,%edx
+  801930:	48 85 c0             	test   %rax,%rax
+  801933:	78 0d                	js     801942 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  801935:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  80193a:	4d 85 c9             	test   %r9,%r9
+  80193d:	74 03                	je     801942 <sys_alloc_dma_region+0x3c>
+  80193f:	49 89 01             	mov    %rax,(%r9)
+}
+  801942:	89 d0                	mov    %edx,%eax
+  801944:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801948:	c9                   	leave
+  801949:	c3                   	ret
+
+000000000080194a <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  80194a:	55                   	push   %rbp
+  80194b:	48 89 e5             	mov    %rsp,%rbp
+  80194e:	53                   	push   %rbx
+  80194f:	48 83 ec 08          	sub    $0x8,%rsp
+  801953:	48 89 f1             	mov    %rsi,%rcx
+  801956:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801959:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80195c:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801961:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801966:	be 00 00 00 00       	mov    $0x0,%esi
+  80196b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801971:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801973:	48 85 c0             	test   %rax,%rax
+  801976:	7f 06                	jg     80197e <sys_set_cache_region+0x34>
+}
+  801978:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80197c:	c9                   	leave
+  80197d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80197e:	49 89 c0             	mov    %rax,%r8
+  801981:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801986:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  80198d:	00 00 00 
+  801990:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801995:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  80199c:	00 00 00 
+  80199f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a4:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  8019ab:	00 00 00 
+  8019ae:	41 ff d1             	call   *%r9
+
+00000000008019b1 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8019b1:	55                   	push   %rbp
+  8019b2:	48 89 e5             	mov    %rsp,%rbp
+  8019b5:	53                   	push   %rbx
+  8019b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8019ba:	48 89 f1             	mov    %rsi,%rcx
+  8019bd:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8019c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019c3:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8019d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019da:	48 85 c0             	test   %rax,%rax
+  8019dd:	7f 06                	jg     8019e5 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8019df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019e3:	c9                   	leave
+  8019e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019e5:	49 89 c0             	mov    %rax,%r8
+  8019e8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8019ed:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  8019f4:	00 00 00 
+  8019f7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019fc:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801a03:	00 00 00 
+  801a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0b:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801a12:	00 00 00 
+  801a15:	41 ff d1             	call   *%r9
+
+0000000000801a18 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801a18:	55                   	push   %rbp
+  801a19:	48 89 e5             	mov    %rsp,%rbp
+  801a1c:	53                   	push   %rbx
+  801a1d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801a21:	48 63 ce             	movslq %esi,%rcx
+  801a24:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a27:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a31:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a36:	be 00 00 00 00       	mov    $0x0,%esi
+  801a3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a41:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a43:	48 85 c0             	test   %rax,%rax
+  801a46:	7f 06                	jg     801a4e <sys_env_set_status+0x36>
+}
+  801a48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a4c:	c9                   	leave
+  801a4d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a4e:	49 89 c0             	mov    %rax,%r8
+  801a51:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801a56:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  801a5d:	00 00 00 
+  801a60:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a65:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801a6c:	00 00 00 
+  801a6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a74:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801a7b:	00 00 00 
+  801a7e:	41 ff d1             	call   *%r9
+
+0000000000801a81 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801a81:	55                   	push   %rbp
+  801a82:	48 89 e5             	mov    %rsp,%rbp
+  801a85:	53                   	push   %rbx
+  801a86:	48 83 ec 08          	sub    $0x8,%rsp
+  801a8a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801a8d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a90:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a9a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a9f:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aaa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801aac:	48 85 c0             	test   %rax,%rax
+  801aaf:	7f 06                	jg     801ab7 <sys_env_set_trapframe+0x36>
+}
+  801ab1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ab5:	c9                   	leave
+  801ab6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ab7:	49 89 c0             	mov    %rax,%r8
+  801aba:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801abf:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  801ac6:	00 00 00 
+  801ac9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801ace:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801ad5:	00 00 00 
+  801ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801add:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801ae4:	00 00 00 
+  801ae7:	41 ff d1             	call   *%r9
+
+0000000000801aea <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801aea:	55                   	push   %rbp
+  801aeb:	48 89 e5             	mov    %rsp,%rbp
+  801aee:	53                   	push   %rbx
+  801aef:	48 83 ec 08          	sub    $0x8,%rsp
+  801af3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801af6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801af9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801afe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b03:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b08:	be 00 00 00 00       	mov    $0x0,%esi
+  801b0d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b13:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b15:	48 85 c0             	test   %rax,%rax
+  801b18:	7f 06                	jg     801b20 <sys_env_set_pgfault_upcall+0x36>
+}
+  801b1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b1e:	c9                   	leave
+  801b1f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b20:	49 89 c0             	mov    %rax,%r8
+  801b23:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801b28:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  801b2f:	00 00 00 
+  801b32:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801b37:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801b3e:	00 00 00 
+  801b41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b46:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801b4d:	00 00 00 
+  801b50:	41 ff d1             	call   *%r9
+
+0000000000801b53 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801b53:	55                   	push   %rbp
+  801b54:	48 89 e5             	mov    %rsp,%rbp
+  801b57:	53                   	push   %rbx
+  801b58:	89 f8                	mov    %edi,%eax
+  801b5a:	49 89 f1             	mov    %rsi,%r9
+  801b5d:	48 89 d3             	mov    %rdx,%rbx
+  801b60:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801b63:	49 63 f0             	movslq %r8d,%rsi
+  801b66:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b69:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b6e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b71:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b77:	cd 30                	int    $0x30
+}
+  801b79:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b7d:	c9                   	leave
+  801b7e:	c3                   	ret
+
+0000000000801b7f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801b7f:	55                   	push   %rbp
+  801b80:	48 89 e5             	mov    %rsp,%rbp
+  801b83:	53                   	push   %rbx
+  801b84:	48 83 ec 08          	sub    $0x8,%rsp
+  801b88:	48 89 fa             	mov    %rdi,%rdx
+  801b8b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b8e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b98:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b9d:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ba8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801baa:	48 85 c0             	test   %rax,%rax
+  801bad:	7f 06                	jg     801bb5 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801baf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bb3:	c9                   	leave
+  801bb4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bb5:	49 89 c0             	mov    %rax,%r8
+  801bb8:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801bbd:	48 ba d0 55 80 00 00 	movabs $0x8055d0,%rdx
+  801bc4:	00 00 00 
+  801bc7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801bcc:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801bd3:	00 00 00 
+  801bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdb:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801be2:	00 00 00 
+  801be5:	41 ff d1             	call   *%r9
+
+0000000000801be8 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801be8:	55                   	push   %rbp
+  801be9:	48 89 e5             	mov    %rsp,%rbp
+  801bec:	53                   	push   %rbx
+  801bed:	48 89 fa             	mov    %rdi,%rdx
+  801bf0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801bf3:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bf8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bfd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c02:	be 00 00 00 00       	mov    $0x0,%esi
+  801c07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c0d:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801c0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c13:	c9                   	leave
+  801c14:	c3                   	ret
+
+0000000000801c15 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801c15:	55                   	push   %rbp
+  801c16:	48 89 e5             	mov    %rsp,%rbp
+  801c19:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c1a:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c24:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c2e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c33:	be 00 00 00 00       	mov    $0x0,%esi
+  801c38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c3e:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c44:	c9                   	leave
+  801c45:	c3                   	ret
+
+0000000000801c46 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801c46:	48 85 ff             	test   %rdi,%rdi
+  801c49:	0f 84 b6 01 00 00    	je     801e05 <malloc+0x1bf>
+malloc(size_t size) {
+  801c4f:	55                   	push   %rbp
+  801c50:	48 89 e5             	mov    %rsp,%rbp
+  801c53:	41 56                	push   %r14
+  801c55:	41 55                	push   %r13
+  801c57:	41 54                	push   %r12
+  801c59:	53                   	push   %rbx
+  801c5a:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801c5d:	48 b8 28 74 80 00 00 	movabs $0x807428,%rax
+  801c64:	00 00 00 
+  801c67:	4c 8b 20             	mov    (%rax),%r12
+  801c6a:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801c71:	0f 87 94 01 00 00    	ja     801e0b <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801c77:	48 a1 20 74 80 00 00 	movabs 0x807420,%rax
+  801c7e:	00 00 00 
+  801c81:	48 85 c0             	test   %rax,%rax
+  801c84:	74 6b                	je     801cf1 <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801c86:	4d 85 e4             	test   %r12,%r12
+  801c89:	74 66                	je     801cf1 <malloc+0xab>
+  801c8b:	48 ba 48 74 80 00 00 	movabs $0x807448,%rdx
+  801c92:	00 00 00 
+  801c95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c9a:	eb 0d                	jmp    801ca9 <malloc+0x63>
+  801c9c:	48 83 c1 01          	add    $0x1,%rcx
+  801ca0:	48 83 c2 18          	add    $0x18,%rdx
+  801ca4:	49 39 cc             	cmp    %rcx,%r12
+  801ca7:	74 48                	je     801cf1 <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801ca9:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801cae:	74 ec                	je     801c9c <malloc+0x56>
+  801cb0:	48 39 1a             	cmp    %rbx,(%rdx)
+  801cb3:	72 e7                	jb     801c9c <malloc+0x56>
+                real_freep_size--;
+  801cb5:	48 83 e8 01          	sub    $0x1,%rax
+  801cb9:	48 a3 20 74 80 00 00 	movabs %rax,0x807420
+  801cc0:	00 00 00 
+                freep[i].is_free = false;
+  801cc3:	48 ba 40 74 80 00 00 	movabs $0x807440,%rdx
+  801cca:	00 00 00 
+  801ccd:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801cd1:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801cd5:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801cd9:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801ce0:	00 
+                freep[i].size = size;
+  801ce1:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801ce5:	48 01 c8             	add    %rcx,%rax
+  801ce8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801cec:	e9 0b 01 00 00       	jmp    801dfc <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801cf1:	48 a1 40 60 80 00 00 	movabs 0x806040,%rax
+  801cf8:	00 00 00 
+  801cfb:	48 01 d8             	add    %rbx,%rax
+  801cfe:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801d04:	76 7c                	jbe    801d82 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801d06:	48 b8 48 60 80 00 00 	movabs $0x806048,%rax
+  801d0d:	00 00 00 
+  801d10:	4c 8b 30             	mov    (%rax),%r14
+  801d13:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801d1a:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801d1d:	48 b8 40 60 80 00 00 	movabs $0x806040,%rax
+  801d24:	00 00 00 
+  801d27:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801d2e:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801d35:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801d3b:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801d3f:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  801d46:	00 00 00 
+  801d49:	ff d0                	call   *%rax
+  801d4b:	89 c7                	mov    %eax,%edi
+  801d4d:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801d54:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801d5b:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801d62:	00 00 00 
+  801d65:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801d69:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801d6e:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  801d75:	00 00 00 
+  801d78:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	0f 88 90 00 00 00    	js     801e12 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801d82:	48 b9 48 60 80 00 00 	movabs $0x806048,%rcx
+  801d89:	00 00 00 
+  801d8c:	48 8b 31             	mov    (%rcx),%rsi
+  801d8f:	48 bf 40 60 80 00 00 	movabs $0x806040,%rdi
+  801d96:	00 00 00 
+  801d99:	4c 8b 07             	mov    (%rdi),%r8
+  801d9c:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801da0:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801da7:	00 00 00 
+  801daa:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801dae:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801db2:	48 b8 40 74 80 00 00 	movabs $0x807440,%rax
+  801db9:	00 00 00 
+  801dbc:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801dc0:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801dc3:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801dc7:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801dce:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801dcf:	48 89 d8             	mov    %rbx,%rax
+  801dd2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801dd7:	4c 01 c0             	add    %r8,%rax
+  801dda:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801ddd:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801de4:	48 01 f3             	add    %rsi,%rbx
+  801de7:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801dea:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801def:	48 a3 28 74 80 00 00 	movabs %rax,0x807428
+  801df6:	00 00 00 
+  801df9:	48 89 d0             	mov    %rdx,%rax
+}
+  801dfc:	5b                   	pop    %rbx
+  801dfd:	41 5c                	pop    %r12
+  801dff:	41 5d                	pop    %r13
+  801e01:	41 5e                	pop    %r14
+  801e03:	5d                   	pop    %rbp
+  801e04:	c3                   	ret
+        return NULL;
+  801e05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e0a:	c3                   	ret
+        return NULL;
+  801e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e10:	eb ea                	jmp    801dfc <malloc+0x1b6>
+            return NULL;
+  801e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e17:	eb e3                	jmp    801dfc <malloc+0x1b6>
+
+0000000000801e19 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801e19:	55                   	push   %rbp
+  801e1a:	48 89 e5             	mov    %rsp,%rbp
+  801e1d:	53                   	push   %rbx
+  801e1e:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801e22:	48 89 fb             	mov    %rdi,%rbx
+  801e25:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801e29:	48 89 df             	mov    %rbx,%rdi
+  801e2c:	48 b8 46 1c 80 00 00 	movabs $0x801c46,%rax
+  801e33:	00 00 00 
+  801e36:	ff d0                	call   *%rax
+  801e38:	48 89 c7             	mov    %rax,%rdi
+  801e3b:	48 89 da             	mov    %rbx,%rdx
+  801e3e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e43:	48 b8 08 12 80 00 00 	movabs $0x801208,%rax
+  801e4a:	00 00 00 
+  801e4d:	ff d0                	call   *%rax
+}
+  801e4f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e53:	c9                   	leave
+  801e54:	c3                   	ret
+
+0000000000801e55 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801e55:	48 a1 28 74 80 00 00 	movabs 0x807428,%rax
+  801e5c:	00 00 00 
+  801e5f:	48 ba 20 74 80 00 00 	movabs $0x807420,%rdx
+  801e66:	00 00 00 
+  801e69:	48 3b 02             	cmp    (%rdx),%rax
+  801e6c:	74 4d                	je     801ebb <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801e6e:	48 85 c0             	test   %rax,%rax
+  801e71:	74 4d                	je     801ec0 <get_allocsize+0x6b>
+  801e73:	48 b9 40 74 80 00 00 	movabs $0x807440,%rcx
+  801e7a:	00 00 00 
+  801e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801e82:	48 3b 39             	cmp    (%rcx),%rdi
+  801e85:	74 13                	je     801e9a <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801e87:	48 83 c2 01          	add    $0x1,%rdx
+  801e8b:	48 83 c1 18          	add    $0x18,%rcx
+  801e8f:	48 39 d0             	cmp    %rdx,%rax
+  801e92:	75 ee                	jne    801e82 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801e94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e99:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801e9a:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea3:	48 be 40 74 80 00 00 	movabs $0x807440,%rsi
+  801eaa:	00 00 00 
+  801ead:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801eb3:	75 0b                	jne    801ec0 <get_allocsize+0x6b>
+  801eb5:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801eba:	c3                   	ret
+        return 0;
+  801ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ec0:	c3                   	ret
+
+0000000000801ec1 <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801ec1:	48 85 ff             	test   %rdi,%rdi
+  801ec4:	0f 84 01 01 00 00    	je     801fcb <free+0x10a>
+free(void *ptr) {
+  801eca:	55                   	push   %rbp
+  801ecb:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801ece:	48 b8 28 74 80 00 00 	movabs $0x807428,%rax
+  801ed5:	00 00 00 
+  801ed8:	48 8b 30             	mov    (%rax),%rsi
+  801edb:	48 a1 20 74 80 00 00 	movabs 0x807420,%rax
+  801ee2:	00 00 00 
+  801ee5:	48 39 c6             	cmp    %rax,%rsi
+  801ee8:	74 50                	je     801f3a <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801eea:	48 85 f6             	test   %rsi,%rsi
+  801eed:	74 21                	je     801f10 <free+0x4f>
+  801eef:	48 b9 40 74 80 00 00 	movabs $0x807440,%rcx
+  801ef6:	00 00 00 
+  801ef9:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801efe:	48 3b 39             	cmp    (%rcx),%rdi
+  801f01:	74 61                	je     801f64 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801f03:	48 83 c2 01          	add    $0x1,%rdx
+  801f07:	48 83 c1 18          	add    $0x18,%rcx
+  801f0b:	48 39 d6             	cmp    %rdx,%rsi
+  801f0e:	75 ee                	jne    801efe <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801f10:	48 ba 40 56 80 00 00 	movabs $0x805640,%rdx
+  801f17:	00 00 00 
+  801f1a:	be 12 01 00 00       	mov    $0x112,%esi
+  801f1f:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801f26:	00 00 00 
+  801f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2e:	48 b9 60 04 80 00 00 	movabs $0x800460,%rcx
+  801f35:	00 00 00 
+  801f38:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801f3a:	48 ba f0 55 80 00 00 	movabs $0x8055f0,%rdx
+  801f41:	00 00 00 
+  801f44:	be 06 01 00 00       	mov    $0x106,%esi
+  801f49:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801f50:	00 00 00 
+  801f53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f58:	48 b9 60 04 80 00 00 	movabs $0x800460,%rcx
+  801f5f:	00 00 00 
+  801f62:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801f64:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801f68:	48 be 40 74 80 00 00 	movabs $0x807440,%rsi
+  801f6f:	00 00 00 
+  801f72:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801f78:	75 27                	jne    801fa1 <free+0xe0>
+            freep[i].is_free = true;
+  801f7a:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801f7e:	48 ba 40 74 80 00 00 	movabs $0x807440,%rdx
+  801f85:	00 00 00 
+  801f88:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801f8f:	00 00 
+            real_freep_size++;
+  801f91:	48 83 c0 01          	add    $0x1,%rax
+  801f95:	48 a3 20 74 80 00 00 	movabs %rax,0x807420
+  801f9c:	00 00 00 
+}
+  801f9f:	5d                   	pop    %rbp
+  801fa0:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801fa1:	48 ba 18 56 80 00 00 	movabs $0x805618,%rdx
+  801fa8:	00 00 00 
+  801fab:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801fb0:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  801fb7:	00 00 00 
+  801fba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbf:	48 b9 60 04 80 00 00 	movabs $0x800460,%rcx
+  801fc6:	00 00 00 
+  801fc9:	ff d1                	call   *%rcx
+  801fcb:	c3                   	ret
+
+0000000000801fcc <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801fcc:	55                   	push   %rbp
+  801fcd:	48 89 e5             	mov    %rsp,%rbp
+  801fd0:	41 55                	push   %r13
+  801fd2:	41 54                	push   %r12
+  801fd4:	53                   	push   %rbx
+  801fd5:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd9:	48 89 fb             	mov    %rdi,%rbx
+  801fdc:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801fdf:	48 b8 55 1e 80 00 00 	movabs $0x801e55,%rax
+  801fe6:	00 00 00 
+  801fe9:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801feb:	49 39 c5             	cmp    %rax,%r13
+  801fee:	73 0e                	jae    801ffe <realloc+0x32>
+}
+  801ff0:	48 89 d8             	mov    %rbx,%rax
+  801ff3:	48 83 c4 08          	add    $0x8,%rsp
+  801ff7:	5b                   	pop    %rbx
+  801ff8:	41 5c                	pop    %r12
+  801ffa:	41 5d                	pop    %r13
+  801ffc:	5d                   	pop    %rbp
+  801ffd:	c3                   	ret
+  801ffe:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  802001:	4c 89 ef             	mov    %r13,%rdi
+  802004:	48 b8 46 1c 80 00 00 	movabs $0x801c46,%rax
+  80200b:	00 00 00 
+  80200e:	ff d0                	call   *%rax
+  802010:	48 89 c7             	mov    %rax,%rdi
+  802013:	4c 89 e2             	mov    %r12,%rdx
+  802016:	48 89 de             	mov    %rbx,%rsi
+  802019:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  802020:	00 00 00 
+  802023:	ff d0                	call   *%rax
+  802025:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  802028:	48 89 df             	mov    %rbx,%rdi
+  80202b:	48 b8 c1 1e 80 00 00 	movabs $0x801ec1,%rax
+  802032:	00 00 00 
+  802035:	ff d0                	call   *%rax
+    return newptr;
+  802037:	4c 89 e3             	mov    %r12,%rbx
+  80203a:	eb b4                	jmp    801ff0 <realloc+0x24>
+
+000000000080203c <strdup>:
+
+char*
+strdup (const char *src) {
+  80203c:	55                   	push   %rbp
+  80203d:	48 89 e5             	mov    %rsp,%rbp
+  802040:	41 54                	push   %r12
+  802042:	53                   	push   %rbx
+  802043:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  802046:	48 b8 ea 0e 80 00 00 	movabs $0x800eea,%rax
+  80204d:	00 00 00 
+  802050:	ff d0                	call   *%rax
+  802052:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  802056:	4c 89 e7             	mov    %r12,%rdi
+  802059:	48 b8 46 1c 80 00 00 	movabs $0x801c46,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+  802065:	48 89 c7             	mov    %rax,%rdi
+  802068:	4c 89 e2             	mov    %r12,%rdx
+  80206b:	48 89 de             	mov    %rbx,%rsi
+  80206e:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  802075:	00 00 00 
+  802078:	ff d0                	call   *%rax
+}
+  80207a:	5b                   	pop    %rbx
+  80207b:	41 5c                	pop    %r12
+  80207d:	5d                   	pop    %rbp
+  80207e:	c3                   	ret
+
+000000000080207f <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  80207f:	55                   	push   %rbp
+  802080:	48 89 e5             	mov    %rsp,%rbp
+  802083:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802084:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802089:	ba 00 00 00 00       	mov    $0x0,%edx
+  80208e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802093:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802098:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80209d:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020a8:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  8020aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020ae:	c9                   	leave
+  8020af:	c3                   	ret
+
+00000000008020b0 <get_ticks>:
+
+uint64_t
+get_ticks() {
+  8020b0:	55                   	push   %rbp
+  8020b1:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  8020b4:	48 b8 40 74 98 00 00 	movabs $0x987440,%rax
+  8020bb:	00 00 00 
+  8020be:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8020c2:	74 26                	je     8020ea <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8020c4:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8020c6:	48 c1 e2 20          	shl    $0x20,%rdx
+  8020ca:	89 c0                	mov    %eax,%eax
+  8020cc:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  8020cf:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  8020d6:	48 b9 40 74 98 00 00 	movabs $0x987440,%rcx
+  8020dd:	00 00 00 
+  8020e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e5:	48 f7 31             	divq   (%rcx)
+}
+  8020e8:	5d                   	pop    %rbp
+  8020e9:	c3                   	ret
+        freq = get_cpufreq();
+  8020ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ef:	48 ba 7f 20 80 00 00 	movabs $0x80207f,%rdx
+  8020f6:	00 00 00 
+  8020f9:	ff d2                	call   *%rdx
+  8020fb:	48 a3 40 74 98 00 00 	movabs %rax,0x987440
+  802102:	00 00 00 
+  802105:	eb bd                	jmp    8020c4 <get_ticks+0x14>
+
+0000000000802107 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  802107:	55                   	push   %rbp
+  802108:	48 89 e5             	mov    %rsp,%rbp
+  80210b:	53                   	push   %rbx
+  80210c:	48 83 ec 08          	sub    $0x8,%rsp
+  802110:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  802113:	48 b8 40 74 98 00 00 	movabs $0x987440,%rax
+  80211a:	00 00 00 
+  80211d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802121:	74 50                	je     802173 <sleep+0x6c>
+    asm volatile("rdtsc"
+  802123:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802125:	48 c1 e2 20          	shl    $0x20,%rdx
+  802129:	89 c0                	mov    %eax,%eax
+  80212b:	48 89 d6             	mov    %rdx,%rsi
+  80212e:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  802131:	48 b8 40 74 98 00 00 	movabs $0x987440,%rax
+  802138:	00 00 00 
+  80213b:	48 0f af 18          	imul   (%rax),%rbx
+  80213f:	48 c1 eb 03          	shr    $0x3,%rbx
+  802143:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  80214a:	9b c4 20 
+  80214d:	48 89 d8             	mov    %rbx,%rax
+  802150:	48 f7 e2             	mul    %rdx
+  802153:	48 89 d1             	mov    %rdx,%rcx
+  802156:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  80215a:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80215c:	48 c1 e2 20          	shl    $0x20,%rdx
+  802160:	89 c0                	mov    %eax,%eax
+  802162:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  802165:	48 29 f2             	sub    %rsi,%rdx
+  802168:	48 39 ca             	cmp    %rcx,%rdx
+  80216b:	72 ed                	jb     80215a <sleep+0x53>
+}
+  80216d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802171:	c9                   	leave
+  802172:	c3                   	ret
+        freq = get_cpufreq();
+  802173:	b8 00 00 00 00       	mov    $0x0,%eax
+  802178:	48 ba 7f 20 80 00 00 	movabs $0x80207f,%rdx
+  80217f:	00 00 00 
+  802182:	ff d2                	call   *%rdx
+  802184:	48 a3 40 74 98 00 00 	movabs %rax,0x987440
+  80218b:	00 00 00 
+  80218e:	eb 93                	jmp    802123 <sleep+0x1c>
+
+0000000000802190 <poll_kbd>:
+
+int poll_kbd() {
+  802190:	55                   	push   %rbp
+  802191:	48 89 e5             	mov    %rsp,%rbp
+  802194:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802195:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80219a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021b9:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  8021bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021bf:	c9                   	leave
+  8021c0:	c3                   	ret
+
+00000000008021c1 <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  8021c1:	55                   	push   %rbp
+  8021c2:	48 89 e5             	mov    %rsp,%rbp
+  8021c5:	53                   	push   %rbx
+  8021c6:	49 89 fa             	mov    %rdi,%r10
+  8021c9:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  8021cb:	44 89 c6             	mov    %r8d,%esi
+  8021ce:	89 cf                	mov    %ecx,%edi
+  8021d0:	89 d3                	mov    %edx,%ebx
+  8021d2:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  8021d4:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8021d9:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021dc:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  8021e0:	cd 30                	int    $0x30
+  8021e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021e6:	c9                   	leave
+  8021e7:	c3                   	ret
+
+00000000008021e8 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8021e8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8021ef:	ff ff ff 
+  8021f2:	48 01 f8             	add    %rdi,%rax
+  8021f5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8021f9:	c3                   	ret
+
+00000000008021fa <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8021fa:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802201:	ff ff ff 
+  802204:	48 01 f8             	add    %rdi,%rax
+  802207:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80220b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802211:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802215:	c3                   	ret
+
+0000000000802216 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802216:	55                   	push   %rbp
+  802217:	48 89 e5             	mov    %rsp,%rbp
+  80221a:	41 57                	push   %r15
+  80221c:	41 56                	push   %r14
+  80221e:	41 55                	push   %r13
+  802220:	41 54                	push   %r12
+  802222:	53                   	push   %rbx
+  802223:	48 83 ec 08          	sub    $0x8,%rsp
+  802227:	49 89 ff             	mov    %rdi,%r15
+  80222a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80222f:	49 bd 92 42 80 00 00 	movabs $0x804292,%r13
+  802236:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802239:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80223f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802242:	48 89 df             	mov    %rbx,%rdi
+  802245:	41 ff d5             	call   *%r13
+  802248:	83 e0 04             	and    $0x4,%eax
+  80224b:	74 17                	je     802264 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80224d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802254:	4c 39 f3             	cmp    %r14,%rbx
+  802257:	75 e6                	jne    80223f <fd_alloc+0x29>
+  802259:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80225f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802264:	4d 89 27             	mov    %r12,(%r15)
+}
+  802267:	48 83 c4 08          	add    $0x8,%rsp
+  80226b:	5b                   	pop    %rbx
+  80226c:	41 5c                	pop    %r12
+  80226e:	41 5d                	pop    %r13
+  802270:	41 5e                	pop    %r14
+  802272:	41 5f                	pop    %r15
+  802274:	5d                   	pop    %rbp
+  802275:	c3                   	ret
+
+0000000000802276 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802276:	83 ff 1f             	cmp    $0x1f,%edi
+  802279:	77 39                	ja     8022b4 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80227b:	55                   	push   %rbp
+  80227c:	48 89 e5             	mov    %rsp,%rbp
+  80227f:	41 54                	push   %r12
+  802281:	53                   	push   %rbx
+  802282:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802285:	48 63 df             	movslq %edi,%rbx
+  802288:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80228f:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802293:	48 89 df             	mov    %rbx,%rdi
+  802296:	48 b8 92 42 80 00 00 	movabs $0x804292,%rax
+  80229d:	00 00 00 
+  8022a0:	ff d0                	call   *%rax
+  8022a2:	a8 04                	test   $0x4,%al
+  8022a4:	74 14                	je     8022ba <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8022a6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8022aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022af:	5b                   	pop    %rbx
+  8022b0:	41 5c                	pop    %r12
+  8022b2:	5d                   	pop    %rbp
+  8022b3:	c3                   	ret
+        return -E_INVAL;
+  8022b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8022b9:	c3                   	ret
+        return -E_INVAL;
+  8022ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022bf:	eb ee                	jmp    8022af <fd_lookup+0x39>
+
+00000000008022c1 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8022c1:	55                   	push   %rbp
+  8022c2:	48 89 e5             	mov    %rsp,%rbp
+  8022c5:	41 54                	push   %r12
+  8022c7:	53                   	push   %rbx
+  8022c8:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8022cb:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  8022d2:	00 00 00 
+  8022d5:	48 bb 60 60 80 00 00 	movabs $0x806060,%rbx
+  8022dc:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8022df:	39 3b                	cmp    %edi,(%rbx)
+  8022e1:	74 47                	je     80232a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8022e3:	48 83 c0 08          	add    $0x8,%rax
+  8022e7:	48 8b 18             	mov    (%rax),%rbx
+  8022ea:	48 85 db             	test   %rbx,%rbx
+  8022ed:	75 f0                	jne    8022df <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8022ef:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022f6:	00 00 00 
+  8022f9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022ff:	89 fa                	mov    %edi,%edx
+  802301:	48 bf 78 56 80 00 00 	movabs $0x805678,%rdi
+  802308:	00 00 00 
+  80230b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802310:	48 b9 b0 05 80 00 00 	movabs $0x8005b0,%rcx
+  802317:	00 00 00 
+  80231a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80231c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802321:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802325:	5b                   	pop    %rbx
+  802326:	41 5c                	pop    %r12
+  802328:	5d                   	pop    %rbp
+  802329:	c3                   	ret
+            return 0;
+  80232a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232f:	eb f0                	jmp    802321 <dev_lookup+0x60>
+
+0000000000802331 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802331:	55                   	push   %rbp
+  802332:	48 89 e5             	mov    %rsp,%rbp
+  802335:	41 55                	push   %r13
+  802337:	41 54                	push   %r12
+  802339:	53                   	push   %rbx
+  80233a:	48 83 ec 18          	sub    $0x18,%rsp
+  80233e:	48 89 fb             	mov    %rdi,%rbx
+  802341:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802344:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80234b:	ff ff ff 
+  80234e:	48 01 df             	add    %rbx,%rdi
+  802351:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802355:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802359:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  802360:	00 00 00 
+  802363:	ff d0                	call   *%rax
+  802365:	41 89 c5             	mov    %eax,%r13d
+  802368:	85 c0                	test   %eax,%eax
+  80236a:	78 06                	js     802372 <fd_close+0x41>
+  80236c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802370:	74 1a                	je     80238c <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802372:	45 84 e4             	test   %r12b,%r12b
+  802375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80237e:	44 89 e8             	mov    %r13d,%eax
+  802381:	48 83 c4 18          	add    $0x18,%rsp
+  802385:	5b                   	pop    %rbx
+  802386:	41 5c                	pop    %r12
+  802388:	41 5d                	pop    %r13
+  80238a:	5d                   	pop    %rbp
+  80238b:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80238c:	8b 3b                	mov    (%rbx),%edi
+  80238e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802392:	48 b8 c1 22 80 00 00 	movabs $0x8022c1,%rax
+  802399:	00 00 00 
+  80239c:	ff d0                	call   *%rax
+  80239e:	41 89 c5             	mov    %eax,%r13d
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	78 1b                	js     8023c0 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8023a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023a9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8023ad:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8023b3:	48 85 c0             	test   %rax,%rax
+  8023b6:	74 08                	je     8023c0 <fd_close+0x8f>
+  8023b8:	48 89 df             	mov    %rbx,%rdi
+  8023bb:	ff d0                	call   *%rax
+  8023bd:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8023c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023c5:	48 89 de             	mov    %rbx,%rsi
+  8023c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023cd:	48 b8 b1 19 80 00 00 	movabs $0x8019b1,%rax
+  8023d4:	00 00 00 
+  8023d7:	ff d0                	call   *%rax
+    return res;
+  8023d9:	eb a3                	jmp    80237e <fd_close+0x4d>
+
+00000000008023db <close>:
+
+int
+close(int fdnum) {
+  8023db:	55                   	push   %rbp
+  8023dc:	48 89 e5             	mov    %rsp,%rbp
+  8023df:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8023e3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023e7:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  8023ee:	00 00 00 
+  8023f1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	78 15                	js     80240c <close+0x31>
+
+    return fd_close(fd, 1);
+  8023f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8023fc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802400:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  802407:	00 00 00 
+  80240a:	ff d0                	call   *%rax
+}
+  80240c:	c9                   	leave
+  80240d:	c3                   	ret
+
+000000000080240e <close_all>:
+
+void
+close_all(void) {
+  80240e:	55                   	push   %rbp
+  80240f:	48 89 e5             	mov    %rsp,%rbp
+  802412:	41 54                	push   %r12
+  802414:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802415:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80241a:	49 bc db 23 80 00 00 	movabs $0x8023db,%r12
+  802421:	00 00 00 
+  802424:	89 df                	mov    %ebx,%edi
+  802426:	41 ff d4             	call   *%r12
+  802429:	83 c3 01             	add    $0x1,%ebx
+  80242c:	83 fb 20             	cmp    $0x20,%ebx
+  80242f:	75 f3                	jne    802424 <close_all+0x16>
+}
+  802431:	5b                   	pop    %rbx
+  802432:	41 5c                	pop    %r12
+  802434:	5d                   	pop    %rbp
+  802435:	c3                   	ret
+
+0000000000802436 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802436:	55                   	push   %rbp
+  802437:	48 89 e5             	mov    %rsp,%rbp
+  80243a:	41 57                	push   %r15
+  80243c:	41 56                	push   %r14
+  80243e:	41 55                	push   %r13
+  802440:	41 54                	push   %r12
+  802442:	53                   	push   %rbx
+  802443:	48 83 ec 18          	sub    $0x18,%rsp
+  802447:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80244a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80244e:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  802455:	00 00 00 
+  802458:	ff d0                	call   *%rax
+  80245a:	89 c3                	mov    %eax,%ebx
+  80245c:	85 c0                	test   %eax,%eax
+  80245e:	0f 88 b8 00 00 00    	js     80251c <dup+0xe6>
+    close(newfdnum);
+  802464:	44 89 e7             	mov    %r12d,%edi
+  802467:	48 b8 db 23 80 00 00 	movabs $0x8023db,%rax
+  80246e:	00 00 00 
+  802471:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802473:	4d 63 ec             	movslq %r12d,%r13
+  802476:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80247d:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802481:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802485:	4c 89 ff             	mov    %r15,%rdi
+  802488:	49 be fa 21 80 00 00 	movabs $0x8021fa,%r14
+  80248f:	00 00 00 
+  802492:	41 ff d6             	call   *%r14
+  802495:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802498:	4c 89 ef             	mov    %r13,%rdi
+  80249b:	41 ff d6             	call   *%r14
+  80249e:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8024a1:	48 89 df             	mov    %rbx,%rdi
+  8024a4:	48 b8 92 42 80 00 00 	movabs $0x804292,%rax
+  8024ab:	00 00 00 
+  8024ae:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8024b0:	a8 04                	test   $0x4,%al
+  8024b2:	74 2b                	je     8024df <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8024b4:	41 89 c1             	mov    %eax,%r9d
+  8024b7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024bd:	4c 89 f1             	mov    %r14,%rcx
+  8024c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c5:	48 89 de             	mov    %rbx,%rsi
+  8024c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024cd:	48 b8 39 18 80 00 00 	movabs $0x801839,%rax
+  8024d4:	00 00 00 
+  8024d7:	ff d0                	call   *%rax
+  8024d9:	89 c3                	mov    %eax,%ebx
+  8024db:	85 c0                	test   %eax,%eax
+  8024dd:	78 4e                	js     80252d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8024df:	4c 89 ff             	mov    %r15,%rdi
+  8024e2:	48 b8 92 42 80 00 00 	movabs $0x804292,%rax
+  8024e9:	00 00 00 
+  8024ec:	ff d0                	call   *%rax
+  8024ee:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8024f1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024f7:	4c 89 e9             	mov    %r13,%rcx
+  8024fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ff:	4c 89 fe             	mov    %r15,%rsi
+  802502:	bf 00 00 00 00       	mov    $0x0,%edi
+  802507:	48 b8 39 18 80 00 00 	movabs $0x801839,%rax
+  80250e:	00 00 00 
+  802511:	ff d0                	call   *%rax
+  802513:	89 c3                	mov    %eax,%ebx
+  802515:	85 c0                	test   %eax,%eax
+  802517:	78 14                	js     80252d <dup+0xf7>
+
+    return newfdnum;
+  802519:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80251c:	89 d8                	mov    %ebx,%eax
+  80251e:	48 83 c4 18          	add    $0x18,%rsp
+  802522:	5b                   	pop    %rbx
+  802523:	41 5c                	pop    %r12
+  802525:	41 5d                	pop    %r13
+  802527:	41 5e                	pop    %r14
+  802529:	41 5f                	pop    %r15
+  80252b:	5d                   	pop    %rbp
+  80252c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80252d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802532:	4c 89 ee             	mov    %r13,%rsi
+  802535:	bf 00 00 00 00       	mov    $0x0,%edi
+  80253a:	49 bc b1 19 80 00 00 	movabs $0x8019b1,%r12
+  802541:	00 00 00 
+  802544:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802547:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80254c:	4c 89 f6             	mov    %r14,%rsi
+  80254f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802554:	41 ff d4             	call   *%r12
+    return res;
+  802557:	eb c3                	jmp    80251c <dup+0xe6>
+
+0000000000802559 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802559:	55                   	push   %rbp
+  80255a:	48 89 e5             	mov    %rsp,%rbp
+  80255d:	41 56                	push   %r14
+  80255f:	41 55                	push   %r13
+  802561:	41 54                	push   %r12
+  802563:	53                   	push   %rbx
+  802564:	48 83 ec 10          	sub    $0x10,%rsp
+  802568:	89 fb                	mov    %edi,%ebx
+  80256a:	49 89 f4             	mov    %rsi,%r12
+  80256d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802570:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802574:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  80257b:	00 00 00 
+  80257e:	ff d0                	call   *%rax
+  802580:	85 c0                	test   %eax,%eax
+  802582:	78 4c                	js     8025d0 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802584:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802588:	41 8b 3e             	mov    (%r14),%edi
+  80258b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80258f:	48 b8 c1 22 80 00 00 	movabs $0x8022c1,%rax
+  802596:	00 00 00 
+  802599:	ff d0                	call   *%rax
+  80259b:	85 c0                	test   %eax,%eax
+  80259d:	78 35                	js     8025d4 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80259f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8025a3:	83 e0 03             	and    $0x3,%eax
+  8025a6:	83 f8 01             	cmp    $0x1,%eax
+  8025a9:	74 2d                	je     8025d8 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8025ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025af:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8025b3:	48 85 c0             	test   %rax,%rax
+  8025b6:	74 56                	je     80260e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8025b8:	4c 89 ea             	mov    %r13,%rdx
+  8025bb:	4c 89 e6             	mov    %r12,%rsi
+  8025be:	4c 89 f7             	mov    %r14,%rdi
+  8025c1:	ff d0                	call   *%rax
+}
+  8025c3:	48 83 c4 10          	add    $0x10,%rsp
+  8025c7:	5b                   	pop    %rbx
+  8025c8:	41 5c                	pop    %r12
+  8025ca:	41 5d                	pop    %r13
+  8025cc:	41 5e                	pop    %r14
+  8025ce:	5d                   	pop    %rbp
+  8025cf:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025d0:	48 98                	cltq
+  8025d2:	eb ef                	jmp    8025c3 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025d4:	48 98                	cltq
+  8025d6:	eb eb                	jmp    8025c3 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8025d8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8025df:	00 00 00 
+  8025e2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8025e8:	89 da                	mov    %ebx,%edx
+  8025ea:	48 bf b9 56 80 00 00 	movabs $0x8056b9,%rdi
+  8025f1:	00 00 00 
+  8025f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f9:	48 b9 b0 05 80 00 00 	movabs $0x8005b0,%rcx
+  802600:	00 00 00 
+  802603:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802605:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80260c:	eb b5                	jmp    8025c3 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80260e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802615:	eb ac                	jmp    8025c3 <read+0x6a>
+
+0000000000802617 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802617:	55                   	push   %rbp
+  802618:	48 89 e5             	mov    %rsp,%rbp
+  80261b:	41 57                	push   %r15
+  80261d:	41 56                	push   %r14
+  80261f:	41 55                	push   %r13
+  802621:	41 54                	push   %r12
+  802623:	53                   	push   %rbx
+  802624:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802628:	48 85 d2             	test   %rdx,%rdx
+  80262b:	74 54                	je     802681 <readn+0x6a>
+  80262d:	41 89 fd             	mov    %edi,%r13d
+  802630:	49 89 f6             	mov    %rsi,%r14
+  802633:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802636:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80263b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802640:	49 bf 59 25 80 00 00 	movabs $0x802559,%r15
+  802647:	00 00 00 
+  80264a:	4c 89 e2             	mov    %r12,%rdx
+  80264d:	48 29 f2             	sub    %rsi,%rdx
+  802650:	4c 01 f6             	add    %r14,%rsi
+  802653:	44 89 ef             	mov    %r13d,%edi
+  802656:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802659:	85 c0                	test   %eax,%eax
+  80265b:	78 20                	js     80267d <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80265d:	01 c3                	add    %eax,%ebx
+  80265f:	85 c0                	test   %eax,%eax
+  802661:	74 08                	je     80266b <readn+0x54>
+  802663:	48 63 f3             	movslq %ebx,%rsi
+  802666:	4c 39 e6             	cmp    %r12,%rsi
+  802669:	72 df                	jb     80264a <readn+0x33>
+    }
+    return res;
+  80266b:	48 63 c3             	movslq %ebx,%rax
+}
+  80266e:	48 83 c4 08          	add    $0x8,%rsp
+  802672:	5b                   	pop    %rbx
+  802673:	41 5c                	pop    %r12
+  802675:	41 5d                	pop    %r13
+  802677:	41 5e                	pop    %r14
+  802679:	41 5f                	pop    %r15
+  80267b:	5d                   	pop    %rbp
+  80267c:	c3                   	ret
+        if (inc < 0) return inc;
+  80267d:	48 98                	cltq
+  80267f:	eb ed                	jmp    80266e <readn+0x57>
+    int inc = 1, res = 0;
+  802681:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802686:	eb e3                	jmp    80266b <readn+0x54>
+
+0000000000802688 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802688:	55                   	push   %rbp
+  802689:	48 89 e5             	mov    %rsp,%rbp
+  80268c:	41 56                	push   %r14
+  80268e:	41 55                	push   %r13
+  802690:	41 54                	push   %r12
+  802692:	53                   	push   %rbx
+  802693:	48 83 ec 10          	sub    $0x10,%rsp
+  802697:	89 fb                	mov    %edi,%ebx
+  802699:	49 89 f4             	mov    %rsi,%r12
+  80269c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80269f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8026a3:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  8026aa:	00 00 00 
+  8026ad:	ff d0                	call   *%rax
+  8026af:	85 c0                	test   %eax,%eax
+  8026b1:	78 47                	js     8026fa <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026b3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8026b7:	41 8b 3e             	mov    (%r14),%edi
+  8026ba:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026be:	48 b8 c1 22 80 00 00 	movabs $0x8022c1,%rax
+  8026c5:	00 00 00 
+  8026c8:	ff d0                	call   *%rax
+  8026ca:	85 c0                	test   %eax,%eax
+  8026cc:	78 30                	js     8026fe <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026ce:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8026d3:	74 2d                	je     802702 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8026d5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026d9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8026dd:	48 85 c0             	test   %rax,%rax
+  8026e0:	74 56                	je     802738 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8026e2:	4c 89 ea             	mov    %r13,%rdx
+  8026e5:	4c 89 e6             	mov    %r12,%rsi
+  8026e8:	4c 89 f7             	mov    %r14,%rdi
+  8026eb:	ff d0                	call   *%rax
+}
+  8026ed:	48 83 c4 10          	add    $0x10,%rsp
+  8026f1:	5b                   	pop    %rbx
+  8026f2:	41 5c                	pop    %r12
+  8026f4:	41 5d                	pop    %r13
+  8026f6:	41 5e                	pop    %r14
+  8026f8:	5d                   	pop    %rbp
+  8026f9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026fa:	48 98                	cltq
+  8026fc:	eb ef                	jmp    8026ed <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026fe:	48 98                	cltq
+  802700:	eb eb                	jmp    8026ed <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802702:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802709:	00 00 00 
+  80270c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802712:	89 da                	mov    %ebx,%edx
+  802714:	48 bf d5 56 80 00 00 	movabs $0x8056d5,%rdi
+  80271b:	00 00 00 
+  80271e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802723:	48 b9 b0 05 80 00 00 	movabs $0x8005b0,%rcx
+  80272a:	00 00 00 
+  80272d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80272f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802736:	eb b5                	jmp    8026ed <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802738:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80273f:	eb ac                	jmp    8026ed <write+0x65>
+
+0000000000802741 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802741:	55                   	push   %rbp
+  802742:	48 89 e5             	mov    %rsp,%rbp
+  802745:	53                   	push   %rbx
+  802746:	48 83 ec 18          	sub    $0x18,%rsp
+  80274a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80274c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802750:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  802757:	00 00 00 
+  80275a:	ff d0                	call   *%rax
+  80275c:	85 c0                	test   %eax,%eax
+  80275e:	78 0c                	js     80276c <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802760:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802764:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802767:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80276c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802770:	c9                   	leave
+  802771:	c3                   	ret
+
+0000000000802772 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802772:	55                   	push   %rbp
+  802773:	48 89 e5             	mov    %rsp,%rbp
+  802776:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80277a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80277e:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  802785:	00 00 00 
+  802788:	ff d0                	call   *%rax
+  80278a:	85 c0                	test   %eax,%eax
+  80278c:	78 07                	js     802795 <tell+0x23>
+    return fdes->fd_offset;
+  80278e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802792:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  802795:	c9                   	leave
+  802796:	c3                   	ret
+
+0000000000802797 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802797:	55                   	push   %rbp
+  802798:	48 89 e5             	mov    %rsp,%rbp
+  80279b:	41 55                	push   %r13
+  80279d:	41 54                	push   %r12
+  80279f:	53                   	push   %rbx
+  8027a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8027a4:	89 fb                	mov    %edi,%ebx
+  8027a6:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027a9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8027ad:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+  8027b9:	85 c0                	test   %eax,%eax
+  8027bb:	78 38                	js     8027f5 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027bd:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8027c1:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8027c5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027c9:	48 b8 c1 22 80 00 00 	movabs $0x8022c1,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+  8027d5:	85 c0                	test   %eax,%eax
+  8027d7:	78 1c                	js     8027f5 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027d9:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8027de:	74 20                	je     802800 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8027e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027e4:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8027e8:	48 85 c0             	test   %rax,%rax
+  8027eb:	74 47                	je     802834 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8027ed:	44 89 e6             	mov    %r12d,%esi
+  8027f0:	4c 89 ef             	mov    %r13,%rdi
+  8027f3:	ff d0                	call   *%rax
+}
+  8027f5:	48 83 c4 18          	add    $0x18,%rsp
+  8027f9:	5b                   	pop    %rbx
+  8027fa:	41 5c                	pop    %r12
+  8027fc:	41 5d                	pop    %r13
+  8027fe:	5d                   	pop    %rbp
+  8027ff:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802800:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802807:	00 00 00 
+  80280a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802810:	89 da                	mov    %ebx,%edx
+  802812:	48 bf 98 56 80 00 00 	movabs $0x805698,%rdi
+  802819:	00 00 00 
+  80281c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802821:	48 b9 b0 05 80 00 00 	movabs $0x8005b0,%rcx
+  802828:	00 00 00 
+  80282b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80282d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802832:	eb c1                	jmp    8027f5 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802834:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802839:	eb ba                	jmp    8027f5 <ftruncate+0x5e>
+
+000000000080283b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80283b:	55                   	push   %rbp
+  80283c:	48 89 e5             	mov    %rsp,%rbp
+  80283f:	41 54                	push   %r12
+  802841:	53                   	push   %rbx
+  802842:	48 83 ec 10          	sub    $0x10,%rsp
+  802846:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802849:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80284d:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  802854:	00 00 00 
+  802857:	ff d0                	call   *%rax
+  802859:	85 c0                	test   %eax,%eax
+  80285b:	78 4e                	js     8028ab <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80285d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802861:	41 8b 3c 24          	mov    (%r12),%edi
+  802865:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802869:	48 b8 c1 22 80 00 00 	movabs $0x8022c1,%rax
+  802870:	00 00 00 
+  802873:	ff d0                	call   *%rax
+  802875:	85 c0                	test   %eax,%eax
+  802877:	78 32                	js     8028ab <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802879:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80287d:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802882:	74 30                	je     8028b4 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802884:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802887:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80288e:	00 00 00 
+    stat->st_isdir = 0;
+  802891:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802898:	00 00 00 
+    stat->st_dev = dev;
+  80289b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8028a2:	48 89 de             	mov    %rbx,%rsi
+  8028a5:	4c 89 e7             	mov    %r12,%rdi
+  8028a8:	ff 50 28             	call   *0x28(%rax)
+}
+  8028ab:	48 83 c4 10          	add    $0x10,%rsp
+  8028af:	5b                   	pop    %rbx
+  8028b0:	41 5c                	pop    %r12
+  8028b2:	5d                   	pop    %rbp
+  8028b3:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8028b4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8028b9:	eb f0                	jmp    8028ab <fstat+0x70>
+
+00000000008028bb <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  8028bb:	55                   	push   %rbp
+  8028bc:	48 89 e5             	mov    %rsp,%rbp
+  8028bf:	41 54                	push   %r12
+  8028c1:	53                   	push   %rbx
+  8028c2:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8028c9:	41 89 fc             	mov    %edi,%r12d
+  8028cc:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028ce:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8028d2:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  8028d9:	00 00 00 
+  8028dc:	ff d0                	call   *%rax
+  8028de:	85 c0                	test   %eax,%eax
+  8028e0:	78 31                	js     802913 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8028e2:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8028e9:	44 89 e7             	mov    %r12d,%edi
+  8028ec:	48 b8 3b 28 80 00 00 	movabs $0x80283b,%rax
+  8028f3:	00 00 00 
+  8028f6:	ff d0                	call   *%rax
+  8028f8:	85 c0                	test   %eax,%eax
+  8028fa:	78 17                	js     802913 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8028fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802900:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802903:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802906:	39 d3                	cmp    %edx,%ebx
+  802908:	0f 4f da             	cmovg  %edx,%ebx
+  80290b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80290e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802913:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  80291a:	5b                   	pop    %rbx
+  80291b:	41 5c                	pop    %r12
+  80291d:	5d                   	pop    %rbp
+  80291e:	c3                   	ret
+
+000000000080291f <seektoend>:
+{
+  80291f:	55                   	push   %rbp
+  802920:	48 89 e5             	mov    %rsp,%rbp
+  802923:	53                   	push   %rbx
+  802924:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  80292b:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  80292d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802931:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+  80293d:	85 c0                	test   %eax,%eax
+  80293f:	78 28                	js     802969 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802941:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802948:	89 df                	mov    %ebx,%edi
+  80294a:	48 b8 3b 28 80 00 00 	movabs $0x80283b,%rax
+  802951:	00 00 00 
+  802954:	ff d0                	call   *%rax
+  802956:	85 c0                	test   %eax,%eax
+  802958:	78 0f                	js     802969 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  80295a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80295d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802961:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802964:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802969:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80296d:	c9                   	leave
+  80296e:	c3                   	ret
+
+000000000080296f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80296f:	55                   	push   %rbp
+  802970:	48 89 e5             	mov    %rsp,%rbp
+  802973:	41 54                	push   %r12
+  802975:	53                   	push   %rbx
+  802976:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802979:	be 00 00 00 00       	mov    $0x0,%esi
+  80297e:	48 b8 62 35 80 00 00 	movabs $0x803562,%rax
+  802985:	00 00 00 
+  802988:	ff d0                	call   *%rax
+  80298a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80298c:	85 c0                	test   %eax,%eax
+  80298e:	78 25                	js     8029b5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802990:	4c 89 e6             	mov    %r12,%rsi
+  802993:	89 c7                	mov    %eax,%edi
+  802995:	48 b8 3b 28 80 00 00 	movabs $0x80283b,%rax
+  80299c:	00 00 00 
+  80299f:	ff d0                	call   *%rax
+  8029a1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8029a4:	89 df                	mov    %ebx,%edi
+  8029a6:	48 b8 db 23 80 00 00 	movabs $0x8023db,%rax
+  8029ad:	00 00 00 
+  8029b0:	ff d0                	call   *%rax
+
+    return res;
+  8029b2:	44 89 e3             	mov    %r12d,%ebx
+}
+  8029b5:	89 d8                	mov    %ebx,%eax
+  8029b7:	5b                   	pop    %rbx
+  8029b8:	41 5c                	pop    %r12
+  8029ba:	5d                   	pop    %rbp
+  8029bb:	c3                   	ret
+
+00000000008029bc <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  8029bc:	55                   	push   %rbp
+  8029bd:	48 89 e5             	mov    %rsp,%rbp
+  8029c0:	53                   	push   %rbx
+  8029c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c5:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  8029c8:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  8029cf:	00 00 00 
+  8029d2:	ff d0                	call   *%rax
+  8029d4:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8029d8:	0f 87 ea 00 00 00    	ja     802ac8 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  8029de:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  8029e5:	00 00 00 
+  8029e8:	80 38 00             	cmpb   $0x0,(%rax)
+  8029eb:	75 35                	jne    802a22 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  8029ed:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029f2:	ba 00 00 22 00       	mov    $0x220000,%edx
+  8029f7:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  8029fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a01:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  802a08:	00 00 00 
+  802a0b:	ff d0                	call   *%rax
+  802a0d:	85 c0                	test   %eax,%eax
+  802a0f:	0f 88 ba 00 00 00    	js     802acf <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802a15:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802a1c:	00 00 00 
+  802a1f:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802a22:	48 89 df             	mov    %rbx,%rdi
+  802a25:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  802a2c:	00 00 00 
+  802a2f:	ff d0                	call   *%rax
+  802a31:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802a35:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802a3c:	00 00 00 
+  802a3f:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802a43:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802a46:	39 39                	cmp    %edi,(%rcx)
+  802a48:	74 46                	je     802a90 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802a4a:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802a4e:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802a55:	00 
+  802a56:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802a5d:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802a64:	00 
+  802a65:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802a6c:	00 
+  802a6d:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802a74:	00 
+  802a75:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802a7c:	00 
+  802a7d:	89 39                	mov    %edi,(%rcx)
+  802a7f:	48 01 c6             	add    %rax,%rsi
+  802a82:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802a87:	48 89 c8             	mov    %rcx,%rax
+  802a8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a8e:	c9                   	leave
+  802a8f:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802a90:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802a94:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802a9b:	00 00 00 
+  802a9e:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802aa1:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802aa5:	74 e0                	je     802a87 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802aa7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802aae:	00 
+  802aaf:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802ab3:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802aba:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802abc:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802abf:	48 01 c2             	add    %rax,%rdx
+  802ac2:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802ac6:	eb bf                	jmp    802a87 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802ac8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802acd:	eb b8                	jmp    802a87 <fbuf_get+0xcb>
+            return NULL;
+  802acf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ad4:	eb b1                	jmp    802a87 <fbuf_get+0xcb>
+
+0000000000802ad6 <fsipc_bulk>:
+fsipc_bulk(void) {
+  802ad6:	55                   	push   %rbp
+  802ad7:	48 89 e5             	mov    %rsp,%rbp
+  802ada:	53                   	push   %rbx
+  802adb:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802adf:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802ae6:	00 00 00 
+  802ae9:	48 8b 18             	mov    (%rax),%rbx
+  802aec:	48 85 db             	test   %rbx,%rbx
+  802aef:	74 16                	je     802b07 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802af1:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802af8:	00 00 00 
+  802afb:	48 8b 18             	mov    (%rax),%rbx
+}
+  802afe:	48 89 d8             	mov    %rbx,%rax
+  802b01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b05:	c9                   	leave
+  802b06:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802b07:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b0c:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802b11:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802b16:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b1b:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  802b22:	00 00 00 
+  802b25:	ff d0                	call   *%rax
+  802b27:	85 c0                	test   %eax,%eax
+  802b29:	78 d3                	js     802afe <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802b2b:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802b30:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802b37:	00 00 00 
+  802b3a:	eb b5                	jmp    802af1 <fsipc_bulk+0x1b>
+
+0000000000802b3c <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802b3c:	55                   	push   %rbp
+  802b3d:	48 89 e5             	mov    %rsp,%rbp
+  802b40:	41 57                	push   %r15
+  802b42:	41 56                	push   %r14
+  802b44:	41 55                	push   %r13
+  802b46:	41 54                	push   %r12
+  802b48:	53                   	push   %rbx
+  802b49:	48 83 ec 08          	sub    $0x8,%rsp
+  802b4d:	41 89 fd             	mov    %edi,%r13d
+  802b50:	49 89 f6             	mov    %rsi,%r14
+  802b53:	49 89 d7             	mov    %rdx,%r15
+  802b56:	48 89 cb             	mov    %rcx,%rbx
+  802b59:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b5c:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802b63:	00 00 00 
+  802b66:	83 38 00             	cmpl   $0x0,(%rax)
+  802b69:	74 52                	je     802bbd <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802b6b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b71:	4c 89 f9             	mov    %r15,%rcx
+  802b74:	4c 89 f2             	mov    %r14,%rdx
+  802b77:	44 89 ee             	mov    %r13d,%esi
+  802b7a:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802b81:	00 00 00 
+  802b84:	8b 38                	mov    (%rax),%edi
+  802b86:	48 b8 be 45 80 00 00 	movabs $0x8045be,%rax
+  802b8d:	00 00 00 
+  802b90:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802b92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b97:	4c 89 e2             	mov    %r12,%rdx
+  802b9a:	48 89 de             	mov    %rbx,%rsi
+  802b9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba2:	48 b8 0e 44 80 00 00 	movabs $0x80440e,%rax
+  802ba9:	00 00 00 
+  802bac:	ff d0                	call   *%rax
+}
+  802bae:	48 83 c4 08          	add    $0x8,%rsp
+  802bb2:	5b                   	pop    %rbx
+  802bb3:	41 5c                	pop    %r12
+  802bb5:	41 5d                	pop    %r13
+  802bb7:	41 5e                	pop    %r14
+  802bb9:	41 5f                	pop    %r15
+  802bbb:	5d                   	pop    %rbp
+  802bbc:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802bbd:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bc2:	48 b8 61 46 80 00 00 	movabs $0x804661,%rax
+  802bc9:	00 00 00 
+  802bcc:	ff d0                	call   *%rax
+  802bce:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802bd5:	00 00 
+  802bd7:	eb 92                	jmp    802b6b <fsipc_region+0x2f>
+
+0000000000802bd9 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802bd9:	55                   	push   %rbp
+  802bda:	48 89 e5             	mov    %rsp,%rbp
+  802bdd:	41 57                	push   %r15
+  802bdf:	41 56                	push   %r14
+  802be1:	41 55                	push   %r13
+  802be3:	41 54                	push   %r12
+  802be5:	53                   	push   %rbx
+  802be6:	48 83 ec 28          	sub    $0x28,%rsp
+  802bea:	49 89 ff             	mov    %rdi,%r15
+  802bed:	49 89 f6             	mov    %rsi,%r14
+  802bf0:	48 89 d3             	mov    %rdx,%rbx
+  802bf3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802bf7:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802bfa:	48 b8 d6 2a 80 00 00 	movabs $0x802ad6,%rax
+  802c01:	00 00 00 
+  802c04:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802c06:	48 85 c0             	test   %rax,%rax
+  802c09:	0f 84 cc 00 00 00    	je     802cdb <devfile_write_direct+0x102>
+  802c0f:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802c12:	48 85 db             	test   %rbx,%rbx
+  802c15:	0f 84 ba 00 00 00    	je     802cd5 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802c1b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802c21:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802c28:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802c2c:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802c30:	4c 29 e3             	sub    %r12,%rbx
+  802c33:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802c38:	48 39 c3             	cmp    %rax,%rbx
+  802c3b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802c3f:	48 89 da             	mov    %rbx,%rdx
+  802c42:	4c 89 f6             	mov    %r14,%rsi
+  802c45:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802c49:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  802c50:	00 00 00 
+  802c53:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802c55:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802c59:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802c5d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802c60:	44 01 e0             	add    %r12d,%eax
+  802c63:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802c67:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802c6b:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802c72:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802c79:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802c80:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c8b:	4c 89 ee             	mov    %r13,%rsi
+  802c8e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802c93:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  802c9a:	00 00 00 
+  802c9d:	ff d0                	call   *%rax
+        if (res < 0)
+  802c9f:	85 c0                	test   %eax,%eax
+  802ca1:	78 29                	js     802ccc <devfile_write_direct+0xf3>
+        if (res == 0)
+  802ca3:	74 2b                	je     802cd0 <devfile_write_direct+0xf7>
+        i += res;
+  802ca5:	48 98                	cltq
+  802ca7:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802caa:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802cad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cb1:	49 39 c4             	cmp    %rax,%r12
+  802cb4:	0f 82 72 ff ff ff    	jb     802c2c <devfile_write_direct+0x53>
+    return i;
+  802cba:	4c 89 e0             	mov    %r12,%rax
+}
+  802cbd:	48 83 c4 28          	add    $0x28,%rsp
+  802cc1:	5b                   	pop    %rbx
+  802cc2:	41 5c                	pop    %r12
+  802cc4:	41 5d                	pop    %r13
+  802cc6:	41 5e                	pop    %r14
+  802cc8:	41 5f                	pop    %r15
+  802cca:	5d                   	pop    %rbp
+  802ccb:	c3                   	ret
+            return res;
+  802ccc:	48 98                	cltq
+  802cce:	eb ed                	jmp    802cbd <devfile_write_direct+0xe4>
+            return i;
+  802cd0:	4c 89 e0             	mov    %r12,%rax
+  802cd3:	eb e8                	jmp    802cbd <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802cd5:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802cd9:	eb df                	jmp    802cba <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802cdb:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802ce2:	eb d9                	jmp    802cbd <devfile_write_direct+0xe4>
+
+0000000000802ce4 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802ce4:	55                   	push   %rbp
+  802ce5:	48 89 e5             	mov    %rsp,%rbp
+  802ce8:	41 56                	push   %r14
+  802cea:	41 55                	push   %r13
+  802cec:	41 54                	push   %r12
+  802cee:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802cef:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802cf3:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfc:	4d 39 ee             	cmp    %r13,%r14
+  802cff:	0f 84 99 00 00 00    	je     802d9e <fbuf_flush+0xba>
+  802d05:	49 89 fc             	mov    %rdi,%r12
+  802d08:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802d0b:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802d0e:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802d12:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  802d19:	00 00 00 
+  802d1c:	ff d0                	call   *%rax
+  802d1e:	48 89 c2             	mov    %rax,%rdx
+  802d21:	48 c1 e2 04          	shl    $0x4,%rdx
+  802d25:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802d29:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d2d:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802d32:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802d35:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802d39:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802d40:	00 
+  802d41:	44 89 f1             	mov    %r14d,%ecx
+  802d44:	4c 89 ea             	mov    %r13,%rdx
+  802d47:	4c 89 e7             	mov    %r12,%rdi
+  802d4a:	48 b8 d9 2b 80 00 00 	movabs $0x802bd9,%rax
+  802d51:	00 00 00 
+  802d54:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d56:	48 85 c0             	test   %rax,%rax
+  802d59:	78 43                	js     802d9e <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802d5b:	4c 39 e8             	cmp    %r13,%rax
+  802d5e:	72 47                	jb     802da7 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802d60:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802d65:	83 c0 01             	add    $0x1,%eax
+  802d68:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802d6d:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802d70:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802d74:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802d78:	72 0f                	jb     802d89 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802d7a:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802d7e:	48 39 c2             	cmp    %rax,%rdx
+  802d81:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802d85:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802d89:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802d90:	00 
+  802d91:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802d98:	00 
+    return 0;
+  802d99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d9e:	5b                   	pop    %rbx
+  802d9f:	41 5c                	pop    %r12
+  802da1:	41 5d                	pop    %r13
+  802da3:	41 5e                	pop    %r14
+  802da5:	5d                   	pop    %rbp
+  802da6:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802da7:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802dac:	eb f0                	jmp    802d9e <fbuf_flush+0xba>
+
+0000000000802dae <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802dae:	55                   	push   %rbp
+  802daf:	48 89 e5             	mov    %rsp,%rbp
+  802db2:	53                   	push   %rbx
+  802db3:	48 83 ec 08          	sub    $0x8,%rsp
+  802db7:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802dba:	48 b8 bc 29 80 00 00 	movabs $0x8029bc,%rax
+  802dc1:	00 00 00 
+  802dc4:	ff d0                	call   *%rax
+  802dc6:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dce:	48 85 f6             	test   %rsi,%rsi
+  802dd1:	74 0f                	je     802de2 <devfile_sync+0x34>
+  802dd3:	48 89 df             	mov    %rbx,%rdi
+  802dd6:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  802ddd:	00 00 00 
+  802de0:	ff d0                	call   *%rax
+}
+  802de2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802de6:	c9                   	leave
+  802de7:	c3                   	ret
+
+0000000000802de8 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802de8:	55                   	push   %rbp
+  802de9:	48 89 e5             	mov    %rsp,%rbp
+  802dec:	48 83 ec 10          	sub    $0x10,%rsp
+  802df0:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802df3:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802dfa:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802dfb:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802dff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e04:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802e0b:	00 00 00 
+  802e0e:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  802e15:	00 00 00 
+  802e18:	ff d0                	call   *%rax
+}
+  802e1a:	c9                   	leave
+  802e1b:	c3                   	ret
+
+0000000000802e1c <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e1c:	55                   	push   %rbp
+  802e1d:	48 89 e5             	mov    %rsp,%rbp
+  802e20:	41 54                	push   %r12
+  802e22:	53                   	push   %rbx
+  802e23:	48 89 fb             	mov    %rdi,%rbx
+  802e26:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802e29:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  802e30:	00 00 00 
+  802e33:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e35:	85 c0                	test   %eax,%eax
+  802e37:	78 63                	js     802e9c <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e39:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e3c:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802e43:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802e45:	be 00 00 00 00       	mov    $0x0,%esi
+  802e4a:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e4f:	48 b8 e8 2d 80 00 00 	movabs $0x802de8,%rax
+  802e56:	00 00 00 
+  802e59:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e5b:	85 c0                	test   %eax,%eax
+  802e5d:	78 3d                	js     802e9c <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e5f:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802e66:	00 00 00 
+  802e69:	48 89 de             	mov    %rbx,%rsi
+  802e6c:	4c 89 e7             	mov    %r12,%rdi
+  802e6f:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  802e76:	00 00 00 
+  802e79:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802e7b:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802e81:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802e88:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802e89:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802e8f:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802e96:	00 
+
+    return 0;
+  802e97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e9c:	5b                   	pop    %rbx
+  802e9d:	41 5c                	pop    %r12
+  802e9f:	5d                   	pop    %rbp
+  802ea0:	c3                   	ret
+
+0000000000802ea1 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802ea1:	55                   	push   %rbp
+  802ea2:	48 89 e5             	mov    %rsp,%rbp
+  802ea5:	41 54                	push   %r12
+  802ea7:	53                   	push   %rbx
+  802ea8:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802eab:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  802eb2:	00 00 00 
+  802eb5:	ff d0                	call   *%rax
+  802eb7:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802eba:	48 89 df             	mov    %rbx,%rdi
+  802ebd:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  802ec4:	00 00 00 
+  802ec7:	ff d0                	call   *%rax
+  802ec9:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802ecd:	76 2e                	jbe    802efd <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802ecf:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ed2:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802ed9:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802edb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ee0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ee5:	48 b8 e8 2d 80 00 00 	movabs $0x802de8,%rax
+  802eec:	00 00 00 
+  802eef:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802ef1:	45 85 e4             	test   %r12d,%r12d
+  802ef4:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802ef8:	5b                   	pop    %rbx
+  802ef9:	41 5c                	pop    %r12
+  802efb:	5d                   	pop    %rbp
+  802efc:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802efd:	48 89 df             	mov    %rbx,%rdi
+  802f00:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  802f07:	00 00 00 
+  802f0a:	ff d0                	call   *%rax
+  802f0c:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802f10:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802f17:	00 00 00 
+  802f1a:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802f21:	48 89 df             	mov    %rbx,%rdi
+  802f24:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  802f2b:	00 00 00 
+  802f2e:	ff d0                	call   *%rax
+  802f30:	48 89 c6             	mov    %rax,%rsi
+  802f33:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f3d:	48 b8 b1 19 80 00 00 	movabs $0x8019b1,%rax
+  802f44:	00 00 00 
+  802f47:	ff d0                	call   *%rax
+  802f49:	eb 84                	jmp    802ecf <devfile_flush+0x2e>
+
+0000000000802f4b <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802f4b:	55                   	push   %rbp
+  802f4c:	48 89 e5             	mov    %rsp,%rbp
+  802f4f:	41 55                	push   %r13
+  802f51:	41 54                	push   %r12
+  802f53:	53                   	push   %rbx
+  802f54:	48 83 ec 08          	sub    $0x8,%rsp
+  802f58:	48 89 fb             	mov    %rdi,%rbx
+  802f5b:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  802f5e:	48 b8 bc 29 80 00 00 	movabs $0x8029bc,%rax
+  802f65:	00 00 00 
+  802f68:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  802f6a:	48 85 c0             	test   %rax,%rax
+  802f6d:	74 51                	je     802fc0 <devfile_trunc+0x75>
+  802f6f:	49 89 c4             	mov    %rax,%r12
+  802f72:	48 89 c6             	mov    %rax,%rsi
+  802f75:	48 89 df             	mov    %rbx,%rdi
+  802f78:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  802f7f:	00 00 00 
+  802f82:	ff d0                	call   *%rax
+  802f84:	85 c0                	test   %eax,%eax
+  802f86:	78 2d                	js     802fb5 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f88:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802f8f:	00 00 00 
+  802f92:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f95:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802f97:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802f9b:	be 00 00 00 00       	mov    $0x0,%esi
+  802fa0:	bf 02 00 00 00       	mov    $0x2,%edi
+  802fa5:	48 b8 e8 2d 80 00 00 	movabs $0x802de8,%rax
+  802fac:	00 00 00 
+  802faf:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802fb1:	85 c0                	test   %eax,%eax
+  802fb3:	79 3e                	jns    802ff3 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  802fb5:	48 83 c4 08          	add    $0x8,%rsp
+  802fb9:	5b                   	pop    %rbx
+  802fba:	41 5c                	pop    %r12
+  802fbc:	41 5d                	pop    %r13
+  802fbe:	5d                   	pop    %rbp
+  802fbf:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802fc0:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  802fc7:	00 00 00 
+  802fca:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802fcd:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802fcf:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  802fd3:	be 00 00 00 00       	mov    $0x0,%esi
+  802fd8:	bf 02 00 00 00       	mov    $0x2,%edi
+  802fdd:	48 b8 e8 2d 80 00 00 	movabs $0x802de8,%rax
+  802fe4:	00 00 00 
+  802fe7:	ff d0                	call   *%rax
+    if (res >= 0) {
+  802fe9:	85 c0                	test   %eax,%eax
+  802feb:	78 c8                	js     802fb5 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802fed:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ff1:	eb c2                	jmp    802fb5 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  802ff3:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  802ff6:	8d 51 01             	lea    0x1(%rcx),%edx
+  802ff9:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802ffc:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  803001:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803008:	00 00 
+  80300a:	eb a9                	jmp    802fb5 <devfile_trunc+0x6a>
+
+000000000080300c <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80300c:	55                   	push   %rbp
+  80300d:	48 89 e5             	mov    %rsp,%rbp
+  803010:	41 57                	push   %r15
+  803012:	41 56                	push   %r14
+  803014:	41 55                	push   %r13
+  803016:	41 54                	push   %r12
+  803018:	53                   	push   %rbx
+  803019:	48 83 ec 28          	sub    $0x28,%rsp
+  80301d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803021:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803025:	49 89 d7             	mov    %rdx,%r15
+  803028:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  80302c:	48 b8 bc 29 80 00 00 	movabs $0x8029bc,%rax
+  803033:	00 00 00 
+  803036:	ff d0                	call   *%rax
+  803038:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  80303b:	48 85 c0             	test   %rax,%rax
+  80303e:	74 31                	je     803071 <devfile_write+0x65>
+  803040:	4c 89 f8             	mov    %r15,%rax
+  803043:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  80304a:	77 25                	ja     803071 <devfile_write+0x65>
+    size_t i = 0;
+  80304c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  803052:	48 85 c0             	test   %rax,%rax
+  803055:	0f 85 64 01 00 00    	jne    8031bf <devfile_write+0x1b3>
+    size_t i = 0;
+  80305b:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  80305f:	4c 89 f8             	mov    %r15,%rax
+}
+  803062:	48 83 c4 28          	add    $0x28,%rsp
+  803066:	5b                   	pop    %rbx
+  803067:	41 5c                	pop    %r12
+  803069:	41 5d                	pop    %r13
+  80306b:	41 5e                	pop    %r14
+  80306d:	41 5f                	pop    %r15
+  80306f:	5d                   	pop    %rbp
+  803070:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803071:	48 85 db             	test   %rbx,%rbx
+  803074:	74 5b                	je     8030d1 <devfile_write+0xc5>
+  803076:	48 89 de             	mov    %rbx,%rsi
+  803079:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80307d:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  803084:	00 00 00 
+  803087:	ff d0                	call   *%rax
+  803089:	85 c0                	test   %eax,%eax
+  80308b:	78 40                	js     8030cd <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  80308d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803091:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  803094:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803098:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  80309c:	48 b8 d9 2b 80 00 00 	movabs $0x802bd9,%rax
+  8030a3:	00 00 00 
+  8030a6:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8030a8:	48 85 c0             	test   %rax,%rax
+  8030ab:	7e b5                	jle    803062 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8030ad:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8030b1:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  8030b4:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  8030b7:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  8030ba:	8d 51 01             	lea    0x1(%rcx),%edx
+  8030bd:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8030c0:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  8030c3:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8030ca:	00 
+  8030cb:	eb 95                	jmp    803062 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8030cd:	48 98                	cltq
+  8030cf:	eb 91                	jmp    803062 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  8030d1:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8030d5:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  8030d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8030dc:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8030e0:	48 89 df             	mov    %rbx,%rdi
+  8030e3:	48 b8 d9 2b 80 00 00 	movabs $0x802bd9,%rax
+  8030ea:	00 00 00 
+  8030ed:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8030ef:	48 85 c0             	test   %rax,%rax
+  8030f2:	0f 8e 6a ff ff ff    	jle    803062 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8030f8:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  8030fb:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8030ff:	e9 5e ff ff ff       	jmp    803062 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803104:	48 98                	cltq
+  803106:	4d 85 ff             	test   %r15,%r15
+  803109:	49 0f 45 c7          	cmovne %r15,%rax
+  80310d:	e9 50 ff ff ff       	jmp    803062 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803112:	48 89 de             	mov    %rbx,%rsi
+  803115:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803119:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  803120:	00 00 00 
+  803123:	ff d0                	call   *%rax
+  803125:	85 c0                	test   %eax,%eax
+  803127:	0f 88 2b 01 00 00    	js     803258 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80312d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803131:	4c 01 f8             	add    %r15,%rax
+  803134:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803138:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80313c:	48 b9 e8 21 80 00 00 	movabs $0x8021e8,%rcx
+  803143:	00 00 00 
+  803146:	ff d1                	call   *%rcx
+  803148:	48 89 c2             	mov    %rax,%rdx
+  80314b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80314f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803153:	48 c1 e0 0c          	shl    $0xc,%rax
+  803157:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  80315c:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80315f:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803166:	00 
+  803167:	4c 89 ea             	mov    %r13,%rdx
+  80316a:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80316e:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  803175:	00 00 00 
+  803178:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  80317a:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80317e:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803182:	48 39 c2             	cmp    %rax,%rdx
+  803185:	0f 84 db 00 00 00    	je     803266 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  80318b:	4c 39 e2             	cmp    %r12,%rdx
+  80318e:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  803192:	4d 01 ec             	add    %r13,%r12
+  803195:	49 39 c4             	cmp    %rax,%r12
+  803198:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  80319c:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  8031a0:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  8031a4:	45 01 ee             	add    %r13d,%r14d
+  8031a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031ab:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  8031af:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  8031b2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8031b6:	49 39 c7             	cmp    %rax,%r15
+  8031b9:	0f 83 a0 fe ff ff    	jae    80305f <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  8031bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031c3:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  8031c7:	8b 43 08             	mov    0x8(%rbx),%eax
+  8031ca:	44 39 f0             	cmp    %r14d,%eax
+  8031cd:	7f 10                	jg     8031df <devfile_write+0x1d3>
+  8031cf:	48 98                	cltq
+  8031d1:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  8031d7:	49 63 d6             	movslq %r14d,%rdx
+  8031da:	48 39 d0             	cmp    %rdx,%rax
+  8031dd:	7d 2d                	jge    80320c <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8031df:	48 89 de             	mov    %rbx,%rsi
+  8031e2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031e6:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  8031ed:	00 00 00 
+  8031f0:	ff d0                	call   *%rax
+  8031f2:	85 c0                	test   %eax,%eax
+  8031f4:	0f 88 0a ff ff ff    	js     803104 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8031fa:	44 89 f0             	mov    %r14d,%eax
+  8031fd:	66 b8 00 00          	mov    $0x0,%ax
+  803201:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803204:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80320b:	00 
+        size_t off = pos - fb->fb_base;
+  80320c:	45 89 f4             	mov    %r14d,%r12d
+  80320f:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803213:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803216:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  80321a:	4d 29 fd             	sub    %r15,%r13
+  80321d:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803222:	4c 29 e0             	sub    %r12,%rax
+  803225:	49 39 c5             	cmp    %rax,%r13
+  803228:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  80322c:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803230:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803234:	48 39 c2             	cmp    %rax,%rdx
+  803237:	0f 84 f0 fe ff ff    	je     80312d <devfile_write+0x121>
+  80323d:	4c 39 e0             	cmp    %r12,%rax
+  803240:	0f 82 cc fe ff ff    	jb     803112 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803246:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80324a:	48 39 d0             	cmp    %rdx,%rax
+  80324d:	0f 83 da fe ff ff    	jae    80312d <devfile_write+0x121>
+  803253:	e9 ba fe ff ff       	jmp    803112 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803258:	48 98                	cltq
+  80325a:	4d 85 ff             	test   %r15,%r15
+  80325d:	49 0f 45 c7          	cmovne %r15,%rax
+  803261:	e9 fc fd ff ff       	jmp    803062 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803266:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  80326a:	4c 89 e2             	mov    %r12,%rdx
+  80326d:	e9 2a ff ff ff       	jmp    80319c <devfile_write+0x190>
+
+0000000000803272 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803272:	55                   	push   %rbp
+  803273:	48 89 e5             	mov    %rsp,%rbp
+  803276:	41 57                	push   %r15
+  803278:	41 56                	push   %r14
+  80327a:	41 55                	push   %r13
+  80327c:	41 54                	push   %r12
+  80327e:	53                   	push   %rbx
+  80327f:	48 83 ec 28          	sub    $0x28,%rsp
+  803283:	49 89 ff             	mov    %rdi,%r15
+  803286:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  80328a:	48 89 d3             	mov    %rdx,%rbx
+  80328d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803291:	48 b8 bc 29 80 00 00 	movabs $0x8029bc,%rax
+  803298:	00 00 00 
+  80329b:	ff d0                	call   *%rax
+  80329d:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8032a0:	48 85 c0             	test   %rax,%rax
+  8032a3:	74 0d                	je     8032b2 <devfile_read+0x40>
+  8032a5:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8032ac:	0f 86 1a 01 00 00    	jbe    8033cc <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8032b2:	4d 85 e4             	test   %r12,%r12
+  8032b5:	74 1a                	je     8032d1 <devfile_read+0x5f>
+  8032b7:	4c 89 e6             	mov    %r12,%rsi
+  8032ba:	4c 89 ff             	mov    %r15,%rdi
+  8032bd:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  8032c4:	00 00 00 
+  8032c7:	ff d0                	call   *%rax
+  8032c9:	85 c0                	test   %eax,%eax
+  8032cb:	0f 88 e8 00 00 00    	js     8033b9 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8032d1:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8032d5:	48 b8 d6 2a 80 00 00 	movabs $0x802ad6,%rax
+  8032dc:	00 00 00 
+  8032df:	ff d0                	call   *%rax
+  8032e1:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  8032e4:	48 85 c0             	test   %rax,%rax
+  8032e7:	0f 84 69 02 00 00    	je     803556 <devfile_read+0x2e4>
+    while (i < n) {
+  8032ed:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8032f2:	0f 84 ce 00 00 00    	je     8033c6 <devfile_read+0x154>
+    size_t i = 0;
+  8032f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8032fd:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803304:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803308:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80330c:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  803310:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803314:	48 29 da             	sub    %rbx,%rdx
+  803317:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80331c:	48 39 c2             	cmp    %rax,%rdx
+  80331f:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803323:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803327:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  80332b:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80332e:	01 d8                	add    %ebx,%eax
+  803330:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803334:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803338:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  80333f:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803346:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80334d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803353:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803358:	4c 89 ee             	mov    %r13,%rsi
+  80335b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803360:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  803367:	00 00 00 
+  80336a:	ff d0                	call   *%rax
+        if (res < 0)
+  80336c:	85 c0                	test   %eax,%eax
+  80336e:	78 4d                	js     8033bd <devfile_read+0x14b>
+        if (res == 0)
+  803370:	74 4f                	je     8033c1 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803372:	4c 63 e0             	movslq %eax,%r12
+  803375:	4c 89 e2             	mov    %r12,%rdx
+  803378:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80337c:	4c 89 f7             	mov    %r14,%rdi
+  80337f:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  803386:	00 00 00 
+  803389:	ff d0                	call   *%rax
+        i += res;
+  80338b:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  80338e:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803391:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803395:	48 39 c3             	cmp    %rax,%rbx
+  803398:	0f 82 72 ff ff ff    	jb     803310 <devfile_read+0x9e>
+    return i;
+  80339e:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8033a1:	48 85 c0             	test   %rax,%rax
+  8033a4:	7e 04                	jle    8033aa <devfile_read+0x138>
+  8033a6:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8033aa:	48 83 c4 28          	add    $0x28,%rsp
+  8033ae:	5b                   	pop    %rbx
+  8033af:	41 5c                	pop    %r12
+  8033b1:	41 5d                	pop    %r13
+  8033b3:	41 5e                	pop    %r14
+  8033b5:	41 5f                	pop    %r15
+  8033b7:	5d                   	pop    %rbp
+  8033b8:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8033b9:	48 98                	cltq
+  8033bb:	eb ed                	jmp    8033aa <devfile_read+0x138>
+            return res;
+  8033bd:	48 98                	cltq
+  8033bf:	eb e9                	jmp    8033aa <devfile_read+0x138>
+            return i;
+  8033c1:	48 89 d8             	mov    %rbx,%rax
+  8033c4:	eb db                	jmp    8033a1 <devfile_read+0x12f>
+    size_t i = 0;
+  8033c6:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8033ca:	eb d2                	jmp    80339e <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8033cc:	48 89 c6             	mov    %rax,%rsi
+  8033cf:	4c 89 ff             	mov    %r15,%rdi
+  8033d2:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  8033d9:	00 00 00 
+  8033dc:	ff d0                	call   *%rax
+  8033de:	85 c0                	test   %eax,%eax
+  8033e0:	78 40                	js     803422 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8033e2:	4c 89 ff             	mov    %r15,%rdi
+  8033e5:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  8033ec:	00 00 00 
+  8033ef:	ff d0                	call   *%rax
+  8033f1:	48 89 c2             	mov    %rax,%rdx
+  8033f4:	48 c1 e2 04          	shl    $0x4,%rdx
+  8033f8:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8033fc:	48 c1 e0 0c          	shl    $0xc,%rax
+  803400:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803405:	48 01 d0             	add    %rdx,%rax
+  803408:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80340c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803411:	0f 84 33 01 00 00    	je     80354a <devfile_read+0x2d8>
+    size_t i = 0;
+  803417:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80341d:	e9 f5 00 00 00       	jmp    803517 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803422:	48 98                	cltq
+  803424:	eb 84                	jmp    8033aa <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803426:	44 89 e8             	mov    %r13d,%eax
+  803429:	66 b8 00 00          	mov    $0x0,%ax
+  80342d:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803432:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803439:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  80343b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80343f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803443:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803445:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80344a:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80344d:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803454:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803455:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80345b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803460:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803465:	bf 03 00 00 00       	mov    $0x3,%edi
+  80346a:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  803471:	00 00 00 
+  803474:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803476:	85 c0                	test   %eax,%eax
+  803478:	0f 88 be 00 00 00    	js     80353c <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80347e:	48 63 d0             	movslq %eax,%rdx
+  803481:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  803486:	41 03 44 24 08       	add    0x8(%r12),%eax
+  80348b:	44 39 e8             	cmp    %r13d,%eax
+  80348e:	0f 8e ba 00 00 00    	jle    80354e <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  803494:	49 63 c5             	movslq %r13d,%rax
+  803497:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  80349c:	48 29 c3             	sub    %rax,%rbx
+  80349f:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8034a4:	48 01 c3             	add    %rax,%rbx
+  8034a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034ab:	4c 29 f0             	sub    %r14,%rax
+  8034ae:	48 39 c3             	cmp    %rax,%rbx
+  8034b1:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8034b5:	4c 89 ff             	mov    %r15,%rdi
+  8034b8:	48 b9 e8 21 80 00 00 	movabs $0x8021e8,%rcx
+  8034bf:	00 00 00 
+  8034c2:	ff d1                	call   *%rcx
+  8034c4:	48 89 c2             	mov    %rax,%rdx
+  8034c7:	48 c1 e2 04          	shl    $0x4,%rdx
+  8034cb:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8034cf:	48 c1 e0 0c          	shl    $0xc,%rax
+  8034d3:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8034d8:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8034db:	44 89 ea             	mov    %r13d,%edx
+  8034de:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8034e3:	48 63 d2             	movslq %edx,%rdx
+  8034e6:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8034ed:	00 
+  8034ee:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8034f2:	4c 01 f7             	add    %r14,%rdi
+  8034f5:	48 89 da             	mov    %rbx,%rdx
+  8034f8:	48 b9 1d 13 80 00 00 	movabs $0x80131d,%rcx
+  8034ff:	00 00 00 
+  803502:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803504:	41 01 dd             	add    %ebx,%r13d
+  803507:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  80350b:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80350e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803512:	49 39 c6             	cmp    %rax,%r14
+  803515:	73 37                	jae    80354e <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803517:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  80351b:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803520:	44 39 e8             	cmp    %r13d,%eax
+  803523:	0f 8f fd fe ff ff    	jg     803426 <devfile_read+0x1b4>
+  803529:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80352e:	44 39 e8             	cmp    %r13d,%eax
+  803531:	0f 8f 5d ff ff ff    	jg     803494 <devfile_read+0x222>
+  803537:	e9 ea fe ff ff       	jmp    803426 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80353c:	48 98                	cltq
+  80353e:	4d 85 f6             	test   %r14,%r14
+  803541:	49 0f 45 c6          	cmovne %r14,%rax
+  803545:	e9 60 fe ff ff       	jmp    8033aa <devfile_read+0x138>
+    size_t i = 0;
+  80354a:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80354e:	4c 89 f0             	mov    %r14,%rax
+  803551:	e9 54 fe ff ff       	jmp    8033aa <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803556:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80355d:	e9 48 fe ff ff       	jmp    8033aa <devfile_read+0x138>
+
+0000000000803562 <open>:
+open(const char *path, int mode) {
+  803562:	55                   	push   %rbp
+  803563:	48 89 e5             	mov    %rsp,%rbp
+  803566:	41 55                	push   %r13
+  803568:	41 54                	push   %r12
+  80356a:	53                   	push   %rbx
+  80356b:	48 83 ec 18          	sub    $0x18,%rsp
+  80356f:	49 89 fc             	mov    %rdi,%r12
+  803572:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803575:	48 b8 ea 0e 80 00 00 	movabs $0x800eea,%rax
+  80357c:	00 00 00 
+  80357f:	ff d0                	call   *%rax
+  803581:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803587:	0f 87 8a 00 00 00    	ja     803617 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80358d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803591:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  803598:	00 00 00 
+  80359b:	ff d0                	call   *%rax
+  80359d:	89 c3                	mov    %eax,%ebx
+  80359f:	85 c0                	test   %eax,%eax
+  8035a1:	78 50                	js     8035f3 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8035a3:	4c 89 e6             	mov    %r12,%rsi
+  8035a6:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8035ad:	00 00 00 
+  8035b0:	48 89 df             	mov    %rbx,%rdi
+  8035b3:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  8035ba:	00 00 00 
+  8035bd:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8035bf:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8035c6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8035ca:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035cf:	48 b8 e8 2d 80 00 00 	movabs $0x802de8,%rax
+  8035d6:	00 00 00 
+  8035d9:	ff d0                	call   *%rax
+  8035db:	89 c3                	mov    %eax,%ebx
+  8035dd:	85 c0                	test   %eax,%eax
+  8035df:	78 1f                	js     803600 <open+0x9e>
+    return fd2num(fd);
+  8035e1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035e5:	48 b8 e8 21 80 00 00 	movabs $0x8021e8,%rax
+  8035ec:	00 00 00 
+  8035ef:	ff d0                	call   *%rax
+  8035f1:	89 c3                	mov    %eax,%ebx
+}
+  8035f3:	89 d8                	mov    %ebx,%eax
+  8035f5:	48 83 c4 18          	add    $0x18,%rsp
+  8035f9:	5b                   	pop    %rbx
+  8035fa:	41 5c                	pop    %r12
+  8035fc:	41 5d                	pop    %r13
+  8035fe:	5d                   	pop    %rbp
+  8035ff:	c3                   	ret
+        fd_close(fd, 0);
+  803600:	be 00 00 00 00       	mov    $0x0,%esi
+  803605:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803609:	48 b8 31 23 80 00 00 	movabs $0x802331,%rax
+  803610:	00 00 00 
+  803613:	ff d0                	call   *%rax
+        return res;
+  803615:	eb dc                	jmp    8035f3 <open+0x91>
+        return -E_BAD_PATH;
+  803617:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80361c:	eb d5                	jmp    8035f3 <open+0x91>
+
+000000000080361e <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80361e:	55                   	push   %rbp
+  80361f:	48 89 e5             	mov    %rsp,%rbp
+  803622:	41 57                	push   %r15
+  803624:	41 56                	push   %r14
+  803626:	41 55                	push   %r13
+  803628:	41 54                	push   %r12
+  80362a:	53                   	push   %rbx
+  80362b:	48 83 ec 18          	sub    $0x18,%rsp
+  80362f:	41 89 f6             	mov    %esi,%r14d
+  803632:	49 89 d7             	mov    %rdx,%r15
+  803635:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803638:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80363c:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  803643:	00 00 00 
+  803646:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803648:	85 c0                	test   %eax,%eax
+  80364a:	0f 88 db 00 00 00    	js     80372b <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803650:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803654:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80365b:	00 00 00 
+  80365e:	8b 00                	mov    (%rax),%eax
+  803660:	39 07                	cmp    %eax,(%rdi)
+  803662:	0f 85 db 00 00 00    	jne    803743 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803668:	45 85 f6             	test   %r14d,%r14d
+  80366b:	0f 88 db 00 00 00    	js     80374c <fmap+0x12e>
+  803671:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803678:	0f 85 d7 00 00 00    	jne    803755 <fmap+0x137>
+  80367e:	4c 89 fb             	mov    %r15,%rbx
+  803681:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803687:	0f 85 d1 00 00 00    	jne    80375e <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80368d:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803694:	00 00 00 
+  803697:	ff d0                	call   *%rax
+  803699:	85 c0                	test   %eax,%eax
+  80369b:	0f 88 8e 00 00 00    	js     80372f <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8036a1:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8036a8:	00 00 00 
+    while (i < n) {
+  8036ab:	4d 85 ed             	test   %r13,%r13
+  8036ae:	0f 84 8a 00 00 00    	je     80373e <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8036b4:	4c 89 ea             	mov    %r13,%rdx
+  8036b7:	48 29 da             	sub    %rbx,%rdx
+  8036ba:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8036c1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8036c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8036cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036cf:	8b 40 0c             	mov    0xc(%rax),%eax
+  8036d2:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8036d6:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8036da:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8036df:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8036e4:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8036e8:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8036ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036f1:	4c 89 e6             	mov    %r12,%rsi
+  8036f4:	bf 09 00 00 00       	mov    $0x9,%edi
+  8036f9:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  803700:	00 00 00 
+  803703:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803705:	85 c0                	test   %eax,%eax
+  803707:	78 2a                	js     803733 <fmap+0x115>
+        i += res;
+  803709:	48 98                	cltq
+  80370b:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80370e:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803712:	72 05                	jb     803719 <fmap+0xfb>
+    while (i < n) {
+  803714:	4c 39 eb             	cmp    %r13,%rbx
+  803717:	72 9b                	jb     8036b4 <fmap+0x96>
+    }
+    return i;
+  803719:	48 89 d8             	mov    %rbx,%rax
+}
+  80371c:	48 83 c4 18          	add    $0x18,%rsp
+  803720:	5b                   	pop    %rbx
+  803721:	41 5c                	pop    %r12
+  803723:	41 5d                	pop    %r13
+  803725:	41 5e                	pop    %r14
+  803727:	41 5f                	pop    %r15
+  803729:	5d                   	pop    %rbp
+  80372a:	c3                   	ret
+    if (res < 0) return res;
+  80372b:	48 98                	cltq
+  80372d:	eb ed                	jmp    80371c <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80372f:	48 98                	cltq
+  803731:	eb e9                	jmp    80371c <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803733:	48 98                	cltq
+  803735:	48 85 db             	test   %rbx,%rbx
+  803738:	48 0f 45 c3          	cmovne %rbx,%rax
+  80373c:	eb de                	jmp    80371c <fmap+0xfe>
+    size_t i = 0;
+  80373e:	4c 89 eb             	mov    %r13,%rbx
+  803741:	eb d6                	jmp    803719 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803743:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80374a:	eb d0                	jmp    80371c <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80374c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803753:	eb c7                	jmp    80371c <fmap+0xfe>
+  803755:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80375c:	eb be                	jmp    80371c <fmap+0xfe>
+  80375e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803765:	eb b5                	jmp    80371c <fmap+0xfe>
+
+0000000000803767 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803767:	55                   	push   %rbp
+  803768:	48 89 e5             	mov    %rsp,%rbp
+  80376b:	41 56                	push   %r14
+  80376d:	41 55                	push   %r13
+  80376f:	41 54                	push   %r12
+  803771:	53                   	push   %rbx
+  803772:	48 83 ec 10          	sub    $0x10,%rsp
+  803776:	89 fb                	mov    %edi,%ebx
+  803778:	41 89 f4             	mov    %esi,%r12d
+  80377b:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80377e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803782:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  803789:	00 00 00 
+  80378c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80378e:	85 c0                	test   %eax,%eax
+  803790:	78 63                	js     8037f5 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  803792:	45 85 e4             	test   %r12d,%r12d
+  803795:	0f 88 80 00 00 00    	js     80381b <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  80379b:	45 89 e6             	mov    %r12d,%r14d
+  80379e:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8037a5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8037a9:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  8037b0:	00 00 00 
+  8037b3:	ff d0                	call   *%rax
+  8037b5:	48 89 c2             	mov    %rax,%rdx
+  8037b8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8037bd:	44 89 f6             	mov    %r14d,%esi
+  8037c0:	89 df                	mov    %ebx,%edi
+  8037c2:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  8037c9:	00 00 00 
+  8037cc:	ff d0                	call   *%rax
+  8037ce:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8037d1:	45 29 f4             	sub    %r14d,%r12d
+  8037d4:	4d 63 f4             	movslq %r12d,%r14
+  8037d7:	49 39 c6             	cmp    %rax,%r14
+  8037da:	7c 1d                	jl     8037f9 <read_map+0x92>
+  8037dc:	48 85 c0             	test   %rax,%rax
+  8037df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e4:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8037e8:	48 83 c4 10          	add    $0x10,%rsp
+  8037ec:	5b                   	pop    %rbx
+  8037ed:	41 5c                	pop    %r12
+  8037ef:	41 5d                	pop    %r13
+  8037f1:	41 5e                	pop    %r14
+  8037f3:	5d                   	pop    %rbp
+  8037f4:	c3                   	ret
+    if (res < 0) return res;
+  8037f5:	48 98                	cltq
+  8037f7:	eb ef                	jmp    8037e8 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8037f9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8037fd:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  803804:	00 00 00 
+  803807:	ff d0                	call   *%rax
+  803809:	4d 63 e4             	movslq %r12d,%r12
+  80380c:	4c 01 e0             	add    %r12,%rax
+  80380f:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803813:	48 89 d8             	mov    %rbx,%rax
+  803816:	4c 29 f0             	sub    %r14,%rax
+  803819:	eb cd                	jmp    8037e8 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  80381b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803822:	eb c4                	jmp    8037e8 <read_map+0x81>
+
+0000000000803824 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803824:	55                   	push   %rbp
+  803825:	48 89 e5             	mov    %rsp,%rbp
+  803828:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80382c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803830:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  803837:	00 00 00 
+  80383a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80383c:	85 c0                	test   %eax,%eax
+  80383e:	78 4a                	js     80388a <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803840:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803844:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80384b:	00 00 00 
+  80384e:	8b 00                	mov    (%rax),%eax
+  803850:	39 07                	cmp    %eax,(%rdi)
+  803852:	75 38                	jne    80388c <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803854:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  80385b:	00 00 00 
+  80385e:	ff d0                	call   *%rax
+  803860:	85 c0                	test   %eax,%eax
+  803862:	78 26                	js     80388a <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803864:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803868:	8b 40 0c             	mov    0xc(%rax),%eax
+  80386b:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803872:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803874:	be 00 00 00 00       	mov    $0x0,%esi
+  803879:	bf 06 00 00 00       	mov    $0x6,%edi
+  80387e:	48 b8 e8 2d 80 00 00 	movabs $0x802de8,%rax
+  803885:	00 00 00 
+  803888:	ff d0                	call   *%rax
+}
+  80388a:	c9                   	leave
+  80388b:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80388c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803891:	eb f7                	jmp    80388a <fsync+0x66>
+
+0000000000803893 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803893:	55                   	push   %rbp
+  803894:	48 89 e5             	mov    %rsp,%rbp
+  803897:	41 57                	push   %r15
+  803899:	41 56                	push   %r14
+  80389b:	41 55                	push   %r13
+  80389d:	41 54                	push   %r12
+  80389f:	53                   	push   %rbx
+  8038a0:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  8038a4:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  8038ab:	00 00 00 
+  8038ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  8038b3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8038b9:	49 bd 76 22 80 00 00 	movabs $0x802276,%r13
+  8038c0:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8038c3:	49 be 60 60 80 00 00 	movabs $0x806060,%r14
+  8038ca:	00 00 00 
+  8038cd:	eb 0c                	jmp    8038db <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8038cf:	83 c3 01             	add    $0x1,%ebx
+  8038d2:	49 83 c4 28          	add    $0x28,%r12
+  8038d6:	83 fb 20             	cmp    $0x20,%ebx
+  8038d9:	74 33                	je     80390e <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8038db:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8038e0:	74 ed                	je     8038cf <flushall+0x3c>
+  8038e2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8038e6:	89 df                	mov    %ebx,%edi
+  8038e8:	41 ff d5             	call   *%r13
+  8038eb:	85 c0                	test   %eax,%eax
+  8038ed:	78 e0                	js     8038cf <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8038ef:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8038f3:	41 8b 06             	mov    (%r14),%eax
+  8038f6:	39 07                	cmp    %eax,(%rdi)
+  8038f8:	75 d5                	jne    8038cf <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8038fa:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803901:	00 00 00 
+  803904:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803906:	85 c0                	test   %eax,%eax
+  803908:	44 0f 48 f8          	cmovs  %eax,%r15d
+  80390c:	eb c1                	jmp    8038cf <flushall+0x3c>
+    }
+    return res;
+}
+  80390e:	44 89 f8             	mov    %r15d,%eax
+  803911:	48 83 c4 18          	add    $0x18,%rsp
+  803915:	5b                   	pop    %rbx
+  803916:	41 5c                	pop    %r12
+  803918:	41 5d                	pop    %r13
+  80391a:	41 5e                	pop    %r14
+  80391c:	41 5f                	pop    %r15
+  80391e:	5d                   	pop    %rbp
+  80391f:	c3                   	ret
+
+0000000000803920 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803920:	55                   	push   %rbp
+  803921:	48 89 e5             	mov    %rsp,%rbp
+  803924:	53                   	push   %rbx
+  803925:	48 83 ec 08          	sub    $0x8,%rsp
+  803929:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  80392c:	40 0f b6 c6          	movzbl %sil,%eax
+  803930:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803937:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803939:	be 00 00 00 00       	mov    $0x0,%esi
+  80393e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803943:	48 b8 e8 2d 80 00 00 	movabs $0x802de8,%rax
+  80394a:	00 00 00 
+  80394d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80394f:	85 c0                	test   %eax,%eax
+  803951:	78 23                	js     803976 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803953:	ba 58 06 00 00       	mov    $0x658,%edx
+  803958:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80395f:	00 00 00 
+  803962:	48 89 df             	mov    %rbx,%rdi
+  803965:	48 b8 1d 13 80 00 00 	movabs $0x80131d,%rax
+  80396c:	00 00 00 
+  80396f:	ff d0                	call   *%rax
+    return 0;
+  803971:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803976:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80397a:	c9                   	leave
+  80397b:	c3                   	ret
+
+000000000080397c <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  80397c:	55                   	push   %rbp
+  80397d:	48 89 e5             	mov    %rsp,%rbp
+  803980:	53                   	push   %rbx
+  803981:	48 83 ec 08          	sub    $0x8,%rsp
+  803985:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803988:	48 b8 ea 0e 80 00 00 	movabs $0x800eea,%rax
+  80398f:	00 00 00 
+  803992:	ff d0                	call   *%rax
+  803994:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80399a:	77 35                	ja     8039d1 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  80399c:	48 89 de             	mov    %rbx,%rsi
+  80399f:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  8039a6:	00 00 00 
+  8039a9:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  8039b0:	00 00 00 
+  8039b3:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  8039b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ba:	bf 07 00 00 00       	mov    $0x7,%edi
+  8039bf:	48 b8 e8 2d 80 00 00 	movabs $0x802de8,%rax
+  8039c6:	00 00 00 
+  8039c9:	ff d0                	call   *%rax
+}
+  8039cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039cf:	c9                   	leave
+  8039d0:	c3                   	ret
+        return -E_BAD_PATH;
+  8039d1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8039d6:	eb f3                	jmp    8039cb <remove+0x4f>
+
+00000000008039d8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8039d8:	55                   	push   %rbp
+  8039d9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  8039dc:	48 b8 93 38 80 00 00 	movabs $0x803893,%rax
+  8039e3:	00 00 00 
+  8039e6:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8039e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ed:	bf 08 00 00 00       	mov    $0x8,%edi
+  8039f2:	48 b8 e8 2d 80 00 00 	movabs $0x802de8,%rax
+  8039f9:	00 00 00 
+  8039fc:	ff d0                	call   *%rax
+}
+  8039fe:	5d                   	pop    %rbp
+  8039ff:	c3                   	ret
+
+0000000000803a00 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803a00:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803a04:	7f 01                	jg     803a07 <writebuf+0x7>
+  803a06:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803a07:	55                   	push   %rbp
+  803a08:	48 89 e5             	mov    %rsp,%rbp
+  803a0b:	53                   	push   %rbx
+  803a0c:	48 83 ec 08          	sub    $0x8,%rsp
+  803a10:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803a13:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803a17:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803a1b:	8b 3f                	mov    (%rdi),%edi
+  803a1d:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  803a24:	00 00 00 
+  803a27:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803a29:	48 85 c0             	test   %rax,%rax
+  803a2c:	7e 04                	jle    803a32 <writebuf+0x32>
+  803a2e:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803a32:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803a36:	48 39 c2             	cmp    %rax,%rdx
+  803a39:	74 0f                	je     803a4a <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803a3b:	48 85 c0             	test   %rax,%rax
+  803a3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a43:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803a47:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803a4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a4e:	c9                   	leave
+  803a4f:	c3                   	ret
+
+0000000000803a50 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803a50:	8b 46 04             	mov    0x4(%rsi),%eax
+  803a53:	8d 50 01             	lea    0x1(%rax),%edx
+  803a56:	89 56 04             	mov    %edx,0x4(%rsi)
+  803a59:	48 98                	cltq
+  803a5b:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803a60:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803a66:	74 01                	je     803a69 <putch+0x19>
+  803a68:	c3                   	ret
+putch(int ch, void *arg) {
+  803a69:	55                   	push   %rbp
+  803a6a:	48 89 e5             	mov    %rsp,%rbp
+  803a6d:	53                   	push   %rbx
+  803a6e:	48 83 ec 08          	sub    $0x8,%rsp
+  803a72:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803a75:	48 89 f7             	mov    %rsi,%rdi
+  803a78:	48 b8 00 3a 80 00 00 	movabs $0x803a00,%rax
+  803a7f:	00 00 00 
+  803a82:	ff d0                	call   *%rax
+        state->offset = 0;
+  803a84:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803a8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a8f:	c9                   	leave
+  803a90:	c3                   	ret
+
+0000000000803a91 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803a91:	55                   	push   %rbp
+  803a92:	48 89 e5             	mov    %rsp,%rbp
+  803a95:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803a9c:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803a9f:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803aa5:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803aac:	00 00 00 
+    state.result = 0;
+  803aaf:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803ab6:	00 00 00 00 
+    state.error = 1;
+  803aba:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803ac1:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803ac4:	48 89 f2             	mov    %rsi,%rdx
+  803ac7:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803ace:	48 bf 50 3a 80 00 00 	movabs $0x803a50,%rdi
+  803ad5:	00 00 00 
+  803ad8:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  803adf:	00 00 00 
+  803ae2:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803ae4:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803aeb:	7f 14                	jg     803b01 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803aed:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803af4:	48 85 c0             	test   %rax,%rax
+  803af7:	75 06                	jne    803aff <vfprintf+0x6e>
+  803af9:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803aff:	c9                   	leave
+  803b00:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803b01:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803b08:	48 b8 00 3a 80 00 00 	movabs $0x803a00,%rax
+  803b0f:	00 00 00 
+  803b12:	ff d0                	call   *%rax
+  803b14:	eb d7                	jmp    803aed <vfprintf+0x5c>
+
+0000000000803b16 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803b16:	55                   	push   %rbp
+  803b17:	48 89 e5             	mov    %rsp,%rbp
+  803b1a:	48 83 ec 50          	sub    $0x50,%rsp
+  803b1e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803b22:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803b26:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803b2a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803b2e:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803b35:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803b39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b3d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803b41:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803b45:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803b49:	48 b8 91 3a 80 00 00 	movabs $0x803a91,%rax
+  803b50:	00 00 00 
+  803b53:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803b55:	c9                   	leave
+  803b56:	c3                   	ret
+
+0000000000803b57 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803b57:	55                   	push   %rbp
+  803b58:	48 89 e5             	mov    %rsp,%rbp
+  803b5b:	48 83 ec 50          	sub    $0x50,%rsp
+  803b5f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803b63:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803b67:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803b6b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803b6f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803b73:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803b7a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803b7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b82:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803b86:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803b8a:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803b8e:	48 89 fe             	mov    %rdi,%rsi
+  803b91:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b96:	48 b8 91 3a 80 00 00 	movabs $0x803a91,%rax
+  803b9d:	00 00 00 
+  803ba0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803ba2:	c9                   	leave
+  803ba3:	c3                   	ret
+
+0000000000803ba4 <puts>:
+
+int
+puts(const char *str) {
+  803ba4:	55                   	push   %rbp
+  803ba5:	48 89 e5             	mov    %rsp,%rbp
+  803ba8:	48 89 fe             	mov    %rdi,%rsi
+    return printf("%s\n", str);
+  803bab:	48 bf 4c 50 80 00 00 	movabs $0x80504c,%rdi
+  803bb2:	00 00 00 
+  803bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bba:	48 ba 57 3b 80 00 00 	movabs $0x803b57,%rdx
+  803bc1:	00 00 00 
+  803bc4:	ff d2                	call   *%rdx
+}
+  803bc6:	5d                   	pop    %rbp
+  803bc7:	c3                   	ret
+
+0000000000803bc8 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803bc8:	55                   	push   %rbp
+  803bc9:	48 89 e5             	mov    %rsp,%rbp
+  803bcc:	41 54                	push   %r12
+  803bce:	53                   	push   %rbx
+  803bcf:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803bd2:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  803bd9:	00 00 00 
+  803bdc:	ff d0                	call   *%rax
+  803bde:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803be1:	48 be 20 57 80 00 00 	movabs $0x805720,%rsi
+  803be8:	00 00 00 
+  803beb:	48 89 df             	mov    %rbx,%rdi
+  803bee:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  803bf5:	00 00 00 
+  803bf8:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803bfa:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803bff:	41 2b 04 24          	sub    (%r12),%eax
+  803c03:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803c09:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803c10:	00 00 00 
+    stat->st_dev = &devpipe;
+  803c13:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803c1a:	00 00 00 
+  803c1d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c29:	5b                   	pop    %rbx
+  803c2a:	41 5c                	pop    %r12
+  803c2c:	5d                   	pop    %rbp
+  803c2d:	c3                   	ret
+
+0000000000803c2e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803c2e:	55                   	push   %rbp
+  803c2f:	48 89 e5             	mov    %rsp,%rbp
+  803c32:	41 54                	push   %r12
+  803c34:	53                   	push   %rbx
+  803c35:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803c38:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c3d:	48 89 fe             	mov    %rdi,%rsi
+  803c40:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c45:	49 bc b1 19 80 00 00 	movabs $0x8019b1,%r12
+  803c4c:	00 00 00 
+  803c4f:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803c52:	48 89 df             	mov    %rbx,%rdi
+  803c55:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  803c5c:	00 00 00 
+  803c5f:	ff d0                	call   *%rax
+  803c61:	48 89 c6             	mov    %rax,%rsi
+  803c64:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c69:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c6e:	41 ff d4             	call   *%r12
+}
+  803c71:	5b                   	pop    %rbx
+  803c72:	41 5c                	pop    %r12
+  803c74:	5d                   	pop    %rbp
+  803c75:	c3                   	ret
+
+0000000000803c76 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803c76:	55                   	push   %rbp
+  803c77:	48 89 e5             	mov    %rsp,%rbp
+  803c7a:	41 57                	push   %r15
+  803c7c:	41 56                	push   %r14
+  803c7e:	41 55                	push   %r13
+  803c80:	41 54                	push   %r12
+  803c82:	53                   	push   %rbx
+  803c83:	48 83 ec 18          	sub    $0x18,%rsp
+  803c87:	49 89 fc             	mov    %rdi,%r12
+  803c8a:	49 89 f5             	mov    %rsi,%r13
+  803c8d:	49 89 d7             	mov    %rdx,%r15
+  803c90:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c94:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  803c9b:	00 00 00 
+  803c9e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803ca0:	4d 85 ff             	test   %r15,%r15
+  803ca3:	0f 84 af 00 00 00    	je     803d58 <devpipe_write+0xe2>
+  803ca9:	48 89 c3             	mov    %rax,%rbx
+  803cac:	4c 89 f8             	mov    %r15,%rax
+  803caf:	4d 89 ef             	mov    %r13,%r15
+  803cb2:	4c 01 e8             	add    %r13,%rax
+  803cb5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803cb9:	49 bd a6 17 80 00 00 	movabs $0x8017a6,%r13
+  803cc0:	00 00 00 
+            sys_yield();
+  803cc3:	49 be 43 17 80 00 00 	movabs $0x801743,%r14
+  803cca:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ccd:	8b 73 04             	mov    0x4(%rbx),%esi
+  803cd0:	48 63 ce             	movslq %esi,%rcx
+  803cd3:	48 63 03             	movslq (%rbx),%rax
+  803cd6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803cdc:	48 39 c1             	cmp    %rax,%rcx
+  803cdf:	72 2e                	jb     803d0f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ce1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ce6:	48 89 da             	mov    %rbx,%rdx
+  803ce9:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cee:	4c 89 e7             	mov    %r12,%rdi
+  803cf1:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803cf4:	85 c0                	test   %eax,%eax
+  803cf6:	74 66                	je     803d5e <devpipe_write+0xe8>
+            sys_yield();
+  803cf8:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803cfb:	8b 73 04             	mov    0x4(%rbx),%esi
+  803cfe:	48 63 ce             	movslq %esi,%rcx
+  803d01:	48 63 03             	movslq (%rbx),%rax
+  803d04:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803d0a:	48 39 c1             	cmp    %rax,%rcx
+  803d0d:	73 d2                	jae    803ce1 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803d0f:	41 0f b6 3f          	movzbl (%r15),%edi
+  803d13:	48 89 ca             	mov    %rcx,%rdx
+  803d16:	48 c1 ea 03          	shr    $0x3,%rdx
+  803d1a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803d21:	08 10 20 
+  803d24:	48 f7 e2             	mul    %rdx
+  803d27:	48 c1 ea 06          	shr    $0x6,%rdx
+  803d2b:	48 89 d0             	mov    %rdx,%rax
+  803d2e:	48 c1 e0 09          	shl    $0x9,%rax
+  803d32:	48 29 d0             	sub    %rdx,%rax
+  803d35:	48 c1 e0 03          	shl    $0x3,%rax
+  803d39:	48 29 c1             	sub    %rax,%rcx
+  803d3c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803d41:	83 c6 01             	add    $0x1,%esi
+  803d44:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d47:	49 83 c7 01          	add    $0x1,%r15
+  803d4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d4f:	49 39 c7             	cmp    %rax,%r15
+  803d52:	0f 85 75 ff ff ff    	jne    803ccd <devpipe_write+0x57>
+    return n;
+  803d58:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d5c:	eb 05                	jmp    803d63 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d63:	48 83 c4 18          	add    $0x18,%rsp
+  803d67:	5b                   	pop    %rbx
+  803d68:	41 5c                	pop    %r12
+  803d6a:	41 5d                	pop    %r13
+  803d6c:	41 5e                	pop    %r14
+  803d6e:	41 5f                	pop    %r15
+  803d70:	5d                   	pop    %rbp
+  803d71:	c3                   	ret
+
+0000000000803d72 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803d72:	55                   	push   %rbp
+  803d73:	48 89 e5             	mov    %rsp,%rbp
+  803d76:	41 57                	push   %r15
+  803d78:	41 56                	push   %r14
+  803d7a:	41 55                	push   %r13
+  803d7c:	41 54                	push   %r12
+  803d7e:	53                   	push   %rbx
+  803d7f:	48 83 ec 18          	sub    $0x18,%rsp
+  803d83:	49 89 fc             	mov    %rdi,%r12
+  803d86:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d8a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d8e:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  803d95:	00 00 00 
+  803d98:	ff d0                	call   *%rax
+  803d9a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803d9d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803da3:	49 bd a6 17 80 00 00 	movabs $0x8017a6,%r13
+  803daa:	00 00 00 
+            sys_yield();
+  803dad:	49 be 43 17 80 00 00 	movabs $0x801743,%r14
+  803db4:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803db7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803dbc:	74 7d                	je     803e3b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803dbe:	8b 03                	mov    (%rbx),%eax
+  803dc0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803dc3:	75 26                	jne    803deb <devpipe_read+0x79>
+            if (i > 0) return i;
+  803dc5:	4d 85 ff             	test   %r15,%r15
+  803dc8:	75 77                	jne    803e41 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803dca:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803dcf:	48 89 da             	mov    %rbx,%rdx
+  803dd2:	be 00 10 00 00       	mov    $0x1000,%esi
+  803dd7:	4c 89 e7             	mov    %r12,%rdi
+  803dda:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803ddd:	85 c0                	test   %eax,%eax
+  803ddf:	74 72                	je     803e53 <devpipe_read+0xe1>
+            sys_yield();
+  803de1:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803de4:	8b 03                	mov    (%rbx),%eax
+  803de6:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803de9:	74 df                	je     803dca <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803deb:	48 63 c8             	movslq %eax,%rcx
+  803dee:	48 89 ca             	mov    %rcx,%rdx
+  803df1:	48 c1 ea 03          	shr    $0x3,%rdx
+  803df5:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803dfc:	08 10 20 
+  803dff:	48 89 d0             	mov    %rdx,%rax
+  803e02:	48 f7 e6             	mul    %rsi
+  803e05:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e09:	48 89 d0             	mov    %rdx,%rax
+  803e0c:	48 c1 e0 09          	shl    $0x9,%rax
+  803e10:	48 29 d0             	sub    %rdx,%rax
+  803e13:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803e1a:	00 
+  803e1b:	48 89 c8             	mov    %rcx,%rax
+  803e1e:	48 29 d0             	sub    %rdx,%rax
+  803e21:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803e26:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e2a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803e2e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e31:	49 83 c7 01          	add    $0x1,%r15
+  803e35:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803e39:	75 83                	jne    803dbe <devpipe_read+0x4c>
+    return n;
+  803e3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e3f:	eb 03                	jmp    803e44 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803e41:	4c 89 f8             	mov    %r15,%rax
+}
+  803e44:	48 83 c4 18          	add    $0x18,%rsp
+  803e48:	5b                   	pop    %rbx
+  803e49:	41 5c                	pop    %r12
+  803e4b:	41 5d                	pop    %r13
+  803e4d:	41 5e                	pop    %r14
+  803e4f:	41 5f                	pop    %r15
+  803e51:	5d                   	pop    %rbp
+  803e52:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803e53:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e58:	eb ea                	jmp    803e44 <devpipe_read+0xd2>
+
+0000000000803e5a <pipe>:
+pipe(int pfd[2]) {
+  803e5a:	55                   	push   %rbp
+  803e5b:	48 89 e5             	mov    %rsp,%rbp
+  803e5e:	41 55                	push   %r13
+  803e60:	41 54                	push   %r12
+  803e62:	53                   	push   %rbx
+  803e63:	48 83 ec 18          	sub    $0x18,%rsp
+  803e67:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803e6a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803e6e:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  803e75:	00 00 00 
+  803e78:	ff d0                	call   *%rax
+  803e7a:	89 c3                	mov    %eax,%ebx
+  803e7c:	85 c0                	test   %eax,%eax
+  803e7e:	0f 88 a0 01 00 00    	js     804024 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803e84:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e89:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e8e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e92:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e97:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  803e9e:	00 00 00 
+  803ea1:	ff d0                	call   *%rax
+  803ea3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ea5:	85 c0                	test   %eax,%eax
+  803ea7:	0f 88 77 01 00 00    	js     804024 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ead:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803eb1:	48 b8 16 22 80 00 00 	movabs $0x802216,%rax
+  803eb8:	00 00 00 
+  803ebb:	ff d0                	call   *%rax
+  803ebd:	89 c3                	mov    %eax,%ebx
+  803ebf:	85 c0                	test   %eax,%eax
+  803ec1:	0f 88 43 01 00 00    	js     80400a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803ec7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ecc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ed1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ed5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eda:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  803ee1:	00 00 00 
+  803ee4:	ff d0                	call   *%rax
+  803ee6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ee8:	85 c0                	test   %eax,%eax
+  803eea:	0f 88 1a 01 00 00    	js     80400a <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ef0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ef4:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  803efb:	00 00 00 
+  803efe:	ff d0                	call   *%rax
+  803f00:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803f03:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f08:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f0d:	48 89 c6             	mov    %rax,%rsi
+  803f10:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f15:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  803f1c:	00 00 00 
+  803f1f:	ff d0                	call   *%rax
+  803f21:	89 c3                	mov    %eax,%ebx
+  803f23:	85 c0                	test   %eax,%eax
+  803f25:	0f 88 c5 00 00 00    	js     803ff0 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803f2b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f2f:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  803f36:	00 00 00 
+  803f39:	ff d0                	call   *%rax
+  803f3b:	48 89 c1             	mov    %rax,%rcx
+  803f3e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803f44:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f4f:	4c 89 ee             	mov    %r13,%rsi
+  803f52:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f57:	48 b8 39 18 80 00 00 	movabs $0x801839,%rax
+  803f5e:	00 00 00 
+  803f61:	ff d0                	call   *%rax
+  803f63:	89 c3                	mov    %eax,%ebx
+  803f65:	85 c0                	test   %eax,%eax
+  803f67:	78 6e                	js     803fd7 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f69:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f6e:	4c 89 ef             	mov    %r13,%rdi
+  803f71:	48 b8 74 17 80 00 00 	movabs $0x801774,%rax
+  803f78:	00 00 00 
+  803f7b:	ff d0                	call   *%rax
+  803f7d:	83 f8 02             	cmp    $0x2,%eax
+  803f80:	0f 85 ab 00 00 00    	jne    804031 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803f86:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  803f8d:	00 00 
+  803f8f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f93:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803f95:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f99:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803fa0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803fa4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803fa6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803faa:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803fb1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fb5:	48 bb e8 21 80 00 00 	movabs $0x8021e8,%rbx
+  803fbc:	00 00 00 
+  803fbf:	ff d3                	call   *%rbx
+  803fc1:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803fc5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803fc9:	ff d3                	call   *%rbx
+  803fcb:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803fd0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803fd5:	eb 4d                	jmp    804024 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803fd7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fdc:	4c 89 ee             	mov    %r13,%rsi
+  803fdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fe4:	48 b8 b1 19 80 00 00 	movabs $0x8019b1,%rax
+  803feb:	00 00 00 
+  803fee:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803ff0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ff5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ff9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ffe:	48 b8 b1 19 80 00 00 	movabs $0x8019b1,%rax
+  804005:	00 00 00 
+  804008:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80400a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80400f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804013:	bf 00 00 00 00       	mov    $0x0,%edi
+  804018:	48 b8 b1 19 80 00 00 	movabs $0x8019b1,%rax
+  80401f:	00 00 00 
+  804022:	ff d0                	call   *%rax
+}
+  804024:	89 d8                	mov    %ebx,%eax
+  804026:	48 83 c4 18          	add    $0x18,%rsp
+  80402a:	5b                   	pop    %rbx
+  80402b:	41 5c                	pop    %r12
+  80402d:	41 5d                	pop    %r13
+  80402f:	5d                   	pop    %rbp
+  804030:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804031:	48 b9 50 57 80 00 00 	movabs $0x805750,%rcx
+  804038:	00 00 00 
+  80403b:	48 ba 27 57 80 00 00 	movabs $0x805727,%rdx
+  804042:	00 00 00 
+  804045:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80404a:	48 bf 3c 57 80 00 00 	movabs $0x80573c,%rdi
+  804051:	00 00 00 
+  804054:	b8 00 00 00 00       	mov    $0x0,%eax
+  804059:	49 b8 60 04 80 00 00 	movabs $0x800460,%r8
+  804060:	00 00 00 
+  804063:	41 ff d0             	call   *%r8
+
+0000000000804066 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804066:	55                   	push   %rbp
+  804067:	48 89 e5             	mov    %rsp,%rbp
+  80406a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80406e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804072:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  804079:	00 00 00 
+  80407c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80407e:	85 c0                	test   %eax,%eax
+  804080:	78 35                	js     8040b7 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804082:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804086:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  80408d:	00 00 00 
+  804090:	ff d0                	call   *%rax
+  804092:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804095:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80409a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80409f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040a3:	48 b8 a6 17 80 00 00 	movabs $0x8017a6,%rax
+  8040aa:	00 00 00 
+  8040ad:	ff d0                	call   *%rax
+  8040af:	85 c0                	test   %eax,%eax
+  8040b1:	0f 94 c0             	sete   %al
+  8040b4:	0f b6 c0             	movzbl %al,%eax
+}
+  8040b7:	c9                   	leave
+  8040b8:	c3                   	ret
+
+00000000008040b9 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8040b9:	48 89 f8             	mov    %rdi,%rax
+  8040bc:	48 c1 e8 27          	shr    $0x27,%rax
+  8040c0:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  8040c7:	7f 00 00 
+  8040ca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040ce:	f6 c2 01             	test   $0x1,%dl
+  8040d1:	74 6d                	je     804140 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8040d3:	48 89 f8             	mov    %rdi,%rax
+  8040d6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8040da:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8040e1:	7f 00 00 
+  8040e4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040e8:	f6 c2 01             	test   $0x1,%dl
+  8040eb:	74 62                	je     80414f <get_uvpt_entry+0x96>
+  8040ed:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8040f4:	7f 00 00 
+  8040f7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040fb:	f6 c2 80             	test   $0x80,%dl
+  8040fe:	75 4f                	jne    80414f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804100:	48 89 f8             	mov    %rdi,%rax
+  804103:	48 c1 e8 15          	shr    $0x15,%rax
+  804107:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80410e:	7f 00 00 
+  804111:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804115:	f6 c2 01             	test   $0x1,%dl
+  804118:	74 44                	je     80415e <get_uvpt_entry+0xa5>
+  80411a:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804121:	7f 00 00 
+  804124:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804128:	f6 c2 80             	test   $0x80,%dl
+  80412b:	75 31                	jne    80415e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80412d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804131:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804138:	7f 00 00 
+  80413b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80413f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804140:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804147:	7f 00 00 
+  80414a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80414e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80414f:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804156:	7f 00 00 
+  804159:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80415d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80415e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804165:	7f 00 00 
+  804168:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80416c:	c3                   	ret
+
+000000000080416d <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  80416d:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804170:	48 89 f9             	mov    %rdi,%rcx
+  804173:	48 c1 e9 27          	shr    $0x27,%rcx
+  804177:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  80417e:	7f 00 00 
+  804181:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  804185:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  80418c:	f6 c1 01             	test   $0x1,%cl
+  80418f:	0f 84 b2 00 00 00    	je     804247 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804195:	48 89 f9             	mov    %rdi,%rcx
+  804198:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  80419c:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8041a3:	7f 00 00 
+  8041a6:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8041aa:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8041b1:	40 f6 c6 01          	test   $0x1,%sil
+  8041b5:	0f 84 8c 00 00 00    	je     804247 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  8041bb:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8041c2:	7f 00 00 
+  8041c5:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8041c9:	a8 80                	test   $0x80,%al
+  8041cb:	75 7b                	jne    804248 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8041cd:	48 89 f9             	mov    %rdi,%rcx
+  8041d0:	48 c1 e9 15          	shr    $0x15,%rcx
+  8041d4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8041db:	7f 00 00 
+  8041de:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8041e2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8041e9:	40 f6 c6 01          	test   $0x1,%sil
+  8041ed:	74 58                	je     804247 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8041ef:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8041f6:	7f 00 00 
+  8041f9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8041fd:	a8 80                	test   $0x80,%al
+  8041ff:	75 6c                	jne    80426d <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804201:	48 89 f9             	mov    %rdi,%rcx
+  804204:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804208:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80420f:	7f 00 00 
+  804212:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804216:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  80421d:	40 f6 c6 01          	test   $0x1,%sil
+  804221:	74 24                	je     804247 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  804223:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80422a:	7f 00 00 
+  80422d:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804231:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804238:	ff ff 7f 
+  80423b:	48 21 c8             	and    %rcx,%rax
+  80423e:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804244:	48 09 d0             	or     %rdx,%rax
+}
+  804247:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804248:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80424f:	7f 00 00 
+  804252:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804256:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80425d:	ff ff 7f 
+  804260:	48 21 c8             	and    %rcx,%rax
+  804263:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804269:	48 01 d0             	add    %rdx,%rax
+  80426c:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  80426d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804274:	7f 00 00 
+  804277:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80427b:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804282:	ff ff 7f 
+  804285:	48 21 c8             	and    %rcx,%rax
+  804288:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  80428e:	48 01 d0             	add    %rdx,%rax
+  804291:	c3                   	ret
+
+0000000000804292 <get_prot>:
+
+int
+get_prot(void *va) {
+  804292:	55                   	push   %rbp
+  804293:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804296:	48 b8 b9 40 80 00 00 	movabs $0x8040b9,%rax
+  80429d:	00 00 00 
+  8042a0:	ff d0                	call   *%rax
+  8042a2:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042a5:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042aa:	89 c1                	mov    %eax,%ecx
+  8042ac:	83 c9 04             	or     $0x4,%ecx
+  8042af:	f6 c2 01             	test   $0x1,%dl
+  8042b2:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042b5:	89 c1                	mov    %eax,%ecx
+  8042b7:	83 c9 02             	or     $0x2,%ecx
+  8042ba:	f6 c2 02             	test   $0x2,%dl
+  8042bd:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042c0:	89 c1                	mov    %eax,%ecx
+  8042c2:	83 c9 01             	or     $0x1,%ecx
+  8042c5:	48 85 d2             	test   %rdx,%rdx
+  8042c8:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8042cb:	89 c1                	mov    %eax,%ecx
+  8042cd:	83 c9 40             	or     $0x40,%ecx
+  8042d0:	f6 c6 04             	test   $0x4,%dh
+  8042d3:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8042d6:	5d                   	pop    %rbp
+  8042d7:	c3                   	ret
+
+00000000008042d8 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8042d8:	55                   	push   %rbp
+  8042d9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042dc:	48 b8 b9 40 80 00 00 	movabs $0x8040b9,%rax
+  8042e3:	00 00 00 
+  8042e6:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8042e8:	48 c1 e8 06          	shr    $0x6,%rax
+  8042ec:	83 e0 01             	and    $0x1,%eax
+}
+  8042ef:	5d                   	pop    %rbp
+  8042f0:	c3                   	ret
+
+00000000008042f1 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8042f1:	55                   	push   %rbp
+  8042f2:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8042f5:	48 b8 b9 40 80 00 00 	movabs $0x8040b9,%rax
+  8042fc:	00 00 00 
+  8042ff:	ff d0                	call   *%rax
+  804301:	83 e0 01             	and    $0x1,%eax
+}
+  804304:	5d                   	pop    %rbp
+  804305:	c3                   	ret
+
+0000000000804306 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  804306:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  80430d:	7f 00 00 
+  804310:	a8 01                	test   $0x1,%al
+  804312:	75 06                	jne    80431a <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  804314:	b8 00 00 00 00       	mov    $0x0,%eax
+  804319:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80431a:	55                   	push   %rbp
+  80431b:	48 89 e5             	mov    %rsp,%rbp
+  80431e:	41 57                	push   %r15
+  804320:	41 56                	push   %r14
+  804322:	41 55                	push   %r13
+  804324:	41 54                	push   %r12
+  804326:	53                   	push   %rbx
+  804327:	48 83 ec 18          	sub    $0x18,%rsp
+  80432b:	49 89 fe             	mov    %rdi,%r14
+  80432e:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804331:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804338:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804339:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804340:	7f 00 00 
+  804343:	e9 81 00 00 00       	jmp    8043c9 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804348:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80434f:	49 39 dd             	cmp    %rbx,%r13
+  804352:	74 2b                	je     80437f <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804354:	48 89 d8             	mov    %rbx,%rax
+  804357:	48 c1 e8 0c          	shr    $0xc,%rax
+  80435b:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  80435f:	f6 c2 01             	test   $0x1,%dl
+  804362:	74 e4                	je     804348 <foreach_shared_region+0x42>
+  804364:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804368:	f6 c4 04             	test   $0x4,%ah
+  80436b:	74 db                	je     804348 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  80436d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804374:	4c 89 fa             	mov    %r15,%rdx
+  804377:	48 89 df             	mov    %rbx,%rdi
+  80437a:	41 ff d6             	call   *%r14
+  80437d:	eb c9                	jmp    804348 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  80437f:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  804386:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  80438a:	74 22                	je     8043ae <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  80438c:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  804393:	48 89 d8             	mov    %rbx,%rax
+  804396:	48 c1 e8 15          	shr    $0x15,%rax
+  80439a:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  8043a1:	7f 00 00 
+  8043a4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8043a8:	a8 01                	test   $0x1,%al
+  8043aa:	74 d3                	je     80437f <foreach_shared_region+0x79>
+  8043ac:	eb a6                	jmp    804354 <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8043ae:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  8043b5:	40 
+  8043b6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8043ba:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8043c1:	00 00 00 
+  8043c4:	48 39 c1             	cmp    %rax,%rcx
+  8043c7:	74 31                	je     8043fa <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  8043c9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043cd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8043d1:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8043d8:	7f 00 00 
+  8043db:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8043df:	a8 01                	test   $0x1,%al
+  8043e1:	74 cb                	je     8043ae <foreach_shared_region+0xa8>
+  8043e3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043e7:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8043ee:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8043f4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8043f8:	eb 92                	jmp    80438c <foreach_shared_region+0x86>
+}
+  8043fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ff:	48 83 c4 18          	add    $0x18,%rsp
+  804403:	5b                   	pop    %rbx
+  804404:	41 5c                	pop    %r12
+  804406:	41 5d                	pop    %r13
+  804408:	41 5e                	pop    %r14
+  80440a:	41 5f                	pop    %r15
+  80440c:	5d                   	pop    %rbp
+  80440d:	c3                   	ret
+
+000000000080440e <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80440e:	55                   	push   %rbp
+  80440f:	48 89 e5             	mov    %rsp,%rbp
+  804412:	41 55                	push   %r13
+  804414:	41 54                	push   %r12
+  804416:	53                   	push   %rbx
+  804417:	48 83 ec 08          	sub    $0x8,%rsp
+  80441b:	49 89 fc             	mov    %rdi,%r12
+  80441e:	48 89 f7             	mov    %rsi,%rdi
+  804421:	48 89 d3             	mov    %rdx,%rbx
+  804424:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  804427:	48 85 f6             	test   %rsi,%rsi
+  80442a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804431:	00 00 00 
+  804434:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  804438:	be 00 10 00 00       	mov    $0x1000,%esi
+  80443d:	48 85 d2             	test   %rdx,%rdx
+  804440:	74 03                	je     804445 <ipc_recv+0x37>
+  804442:	48 8b 32             	mov    (%rdx),%rsi
+  804445:	48 b8 7f 1b 80 00 00 	movabs $0x801b7f,%rax
+  80444c:	00 00 00 
+  80444f:	ff d0                	call   *%rax
+    if (errno) {
+  804451:	85 c0                	test   %eax,%eax
+  804453:	74 1c                	je     804471 <ipc_recv+0x63>
+        if (from_env_store)
+  804455:	4d 85 e4             	test   %r12,%r12
+  804458:	74 08                	je     804462 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80445a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804461:	00 
+
+        if (perm_store)
+  804462:	4d 85 ed             	test   %r13,%r13
+  804465:	74 74                	je     8044db <ipc_recv+0xcd>
+            *perm_store = 0;
+  804467:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80446e:	00 
+  80446f:	eb 6a                	jmp    8044db <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804471:	4d 85 e4             	test   %r12,%r12
+  804474:	74 14                	je     80448a <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  804476:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80447d:	00 00 00 
+  804480:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804486:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80448a:	48 85 db             	test   %rbx,%rbx
+  80448d:	74 23                	je     8044b2 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80448f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804496:	00 00 00 
+  804499:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80449f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044a4:	85 c9                	test   %ecx,%ecx
+  8044a6:	74 07                	je     8044af <ipc_recv+0xa1>
+  8044a8:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8044af:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8044b2:	4d 85 ed             	test   %r13,%r13
+  8044b5:	74 14                	je     8044cb <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8044b7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044be:	00 00 00 
+  8044c1:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8044c7:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8044cb:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8044d2:	00 00 00 
+  8044d5:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8044db:	48 83 c4 08          	add    $0x8,%rsp
+  8044df:	5b                   	pop    %rbx
+  8044e0:	41 5c                	pop    %r12
+  8044e2:	41 5d                	pop    %r13
+  8044e4:	5d                   	pop    %rbp
+  8044e5:	c3                   	ret
+
+00000000008044e6 <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8044e6:	55                   	push   %rbp
+  8044e7:	48 89 e5             	mov    %rsp,%rbp
+  8044ea:	41 55                	push   %r13
+  8044ec:	41 54                	push   %r12
+  8044ee:	53                   	push   %rbx
+  8044ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8044f3:	49 89 fc             	mov    %rdi,%r12
+  8044f6:	48 89 f7             	mov    %rsi,%rdi
+  8044f9:	48 89 d3             	mov    %rdx,%rbx
+  8044fc:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8044ff:	48 85 f6             	test   %rsi,%rsi
+  804502:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804509:	00 00 00 
+  80450c:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804510:	be 00 10 00 00       	mov    $0x1000,%esi
+  804515:	48 85 d2             	test   %rdx,%rdx
+  804518:	74 03                	je     80451d <ipc_try_recv+0x37>
+  80451a:	48 8b 32             	mov    (%rdx),%rsi
+  80451d:	48 b8 e8 1b 80 00 00 	movabs $0x801be8,%rax
+  804524:	00 00 00 
+  804527:	ff d0                	call   *%rax
+    if (errno) {
+  804529:	85 c0                	test   %eax,%eax
+  80452b:	75 75                	jne    8045a2 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  80452d:	4d 85 e4             	test   %r12,%r12
+  804530:	74 14                	je     804546 <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804532:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804539:	00 00 00 
+  80453c:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804542:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  804546:	48 85 db             	test   %rbx,%rbx
+  804549:	74 23                	je     80456e <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80454b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804552:	00 00 00 
+  804555:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80455b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804560:	85 c9                	test   %ecx,%ecx
+  804562:	74 07                	je     80456b <ipc_try_recv+0x85>
+  804564:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80456b:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  80456e:	4d 85 ed             	test   %r13,%r13
+  804571:	74 14                	je     804587 <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804573:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80457a:	00 00 00 
+  80457d:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804583:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  804587:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80458e:	00 00 00 
+  804591:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  804597:	48 83 c4 08          	add    $0x8,%rsp
+  80459b:	5b                   	pop    %rbx
+  80459c:	41 5c                	pop    %r12
+  80459e:	41 5d                	pop    %r13
+  8045a0:	5d                   	pop    %rbp
+  8045a1:	c3                   	ret
+        if (from_env_store)
+  8045a2:	4d 85 e4             	test   %r12,%r12
+  8045a5:	74 08                	je     8045af <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8045a7:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045ae:	00 
+        if (perm_store)
+  8045af:	4d 85 ed             	test   %r13,%r13
+  8045b2:	74 e3                	je     804597 <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8045b4:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045bb:	00 
+  8045bc:	eb d9                	jmp    804597 <ipc_try_recv+0xb1>
+
+00000000008045be <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045be:	55                   	push   %rbp
+  8045bf:	48 89 e5             	mov    %rsp,%rbp
+  8045c2:	41 57                	push   %r15
+  8045c4:	41 56                	push   %r14
+  8045c6:	41 55                	push   %r13
+  8045c8:	41 54                	push   %r12
+  8045ca:	53                   	push   %rbx
+  8045cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8045cf:	41 89 fd             	mov    %edi,%r13d
+  8045d2:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8045d5:	48 89 d3             	mov    %rdx,%rbx
+  8045d8:	49 89 cc             	mov    %rcx,%r12
+  8045db:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8045df:	48 85 d2             	test   %rdx,%rdx
+  8045e2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045e9:	00 00 00 
+  8045ec:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8045f0:	49 be 53 1b 80 00 00 	movabs $0x801b53,%r14
+  8045f7:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8045fa:	49 bf 43 17 80 00 00 	movabs $0x801743,%r15
+  804601:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  804604:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804607:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80460b:	4c 89 e1             	mov    %r12,%rcx
+  80460e:	48 89 da             	mov    %rbx,%rdx
+  804611:	44 89 ef             	mov    %r13d,%edi
+  804614:	41 ff d6             	call   *%r14
+  804617:	85 c0                	test   %eax,%eax
+  804619:	74 37                	je     804652 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  80461b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80461e:	75 05                	jne    804625 <ipc_send+0x67>
+        sys_yield();
+  804620:	41 ff d7             	call   *%r15
+  804623:	eb df                	jmp    804604 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804625:	89 c1                	mov    %eax,%ecx
+  804627:	48 ba 74 57 80 00 00 	movabs $0x805774,%rdx
+  80462e:	00 00 00 
+  804631:	be 65 00 00 00       	mov    $0x65,%esi
+  804636:	48 bf 8f 57 80 00 00 	movabs $0x80578f,%rdi
+  80463d:	00 00 00 
+  804640:	b8 00 00 00 00       	mov    $0x0,%eax
+  804645:	49 b8 60 04 80 00 00 	movabs $0x800460,%r8
+  80464c:	00 00 00 
+  80464f:	41 ff d0             	call   *%r8
+    }
+}
+  804652:	48 83 c4 18          	add    $0x18,%rsp
+  804656:	5b                   	pop    %rbx
+  804657:	41 5c                	pop    %r12
+  804659:	41 5d                	pop    %r13
+  80465b:	41 5e                	pop    %r14
+  80465d:	41 5f                	pop    %r15
+  80465f:	5d                   	pop    %rbp
+  804660:	c3                   	ret
+
+0000000000804661 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804661:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  804666:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80466d:	00 00 00 
+  804670:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  804677:	48 01 ca             	add    %rcx,%rdx
+  80467a:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804680:	39 fa                	cmp    %edi,%edx
+  804682:	74 12                	je     804696 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804684:	48 83 c0 01          	add    $0x1,%rax
+  804688:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80468e:	75 e0                	jne    804670 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804690:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804695:	c3                   	ret
+            return envs[i].env_id;
+  804696:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80469d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046a4:	00 00 00 
+  8046a7:	48 01 d0             	add    %rdx,%rax
+  8046aa:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046b0:	c3                   	ret
+
+00000000008046b1 <__text_end>:
+  8046b1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b8:	00 00 00 
+  8046bb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c2:	00 00 00 
+  8046c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046cc:	00 00 00 
+  8046cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d6:	00 00 00 
+  8046d9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e0:	00 00 00 
+  8046e3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ea:	00 00 00 
+  8046ed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f4:	00 00 00 
+  8046f7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fe:	00 00 00 
+  804701:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804708:	00 00 00 
+  80470b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804712:	00 00 00 
+  804715:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80471c:	00 00 00 
+  80471f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804726:	00 00 00 
+  804729:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804730:	00 00 00 
+  804733:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80473a:	00 00 00 
+  80473d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804744:	00 00 00 
+  804747:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474e:	00 00 00 
+  804751:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804758:	00 00 00 
+  80475b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804762:	00 00 00 
+  804765:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80476c:	00 00 00 
+  80476f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804776:	00 00 00 
+  804779:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804780:	00 00 00 
+  804783:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80478a:	00 00 00 
+  80478d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804794:	00 00 00 
+  804797:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479e:	00 00 00 
+  8047a1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a8:	00 00 00 
+  8047ab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b2:	00 00 00 
+  8047b5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047bc:	00 00 00 
+  8047bf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c6:	00 00 00 
+  8047c9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d0:	00 00 00 
+  8047d3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047da:	00 00 00 
+  8047dd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e4:	00 00 00 
+  8047e7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ee:	00 00 00 
+  8047f1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f8:	00 00 00 
+  8047fb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804802:	00 00 00 
+  804805:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80480c:	00 00 00 
+  80480f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804816:	00 00 00 
+  804819:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804820:	00 00 00 
+  804823:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80482a:	00 00 00 
+  80482d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804834:	00 00 00 
+  804837:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483e:	00 00 00 
+  804841:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804848:	00 00 00 
+  80484b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804852:	00 00 00 
+  804855:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80485c:	00 00 00 
+  80485f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804866:	00 00 00 
+  804869:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804870:	00 00 00 
+  804873:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80487a:	00 00 00 
+  80487d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804884:	00 00 00 
+  804887:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488e:	00 00 00 
+  804891:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804898:	00 00 00 
+  80489b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a2:	00 00 00 
+  8048a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ac:	00 00 00 
+  8048af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b6:	00 00 00 
+  8048b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c0:	00 00 00 
+  8048c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ca:	00 00 00 
+  8048cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d4:	00 00 00 
+  8048d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048de:	00 00 00 
+  8048e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e8:	00 00 00 
+  8048eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f2:	00 00 00 
+  8048f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fc:	00 00 00 
+  8048ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804906:	00 00 00 
+  804909:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804910:	00 00 00 
+  804913:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491a:	00 00 00 
+  80491d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804924:	00 00 00 
+  804927:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492e:	00 00 00 
+  804931:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804938:	00 00 00 
+  80493b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804942:	00 00 00 
+  804945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494c:	00 00 00 
+  80494f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804956:	00 00 00 
+  804959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804960:	00 00 00 
+  804963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496a:	00 00 00 
+  80496d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804974:	00 00 00 
+  804977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497e:	00 00 00 
+  804981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804988:	00 00 00 
+  80498b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804992:	00 00 00 
+  804995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499c:	00 00 00 
+  80499f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a6:	00 00 00 
+  8049a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b0:	00 00 00 
+  8049b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ba:	00 00 00 
+  8049bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c4:	00 00 00 
+  8049c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ce:	00 00 00 
+  8049d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d8:	00 00 00 
+  8049db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e2:	00 00 00 
+  8049e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ec:	00 00 00 
+  8049ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f6:	00 00 00 
+  8049f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a00:	00 00 00 
+  804a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0a:	00 00 00 
+  804a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a14:	00 00 00 
+  804a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1e:	00 00 00 
+  804a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a28:	00 00 00 
+  804a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a32:	00 00 00 
+  804a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3c:	00 00 00 
+  804a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a46:	00 00 00 
+  804a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a50:	00 00 00 
+  804a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5a:	00 00 00 
+  804a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a64:	00 00 00 
+  804a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6e:	00 00 00 
+  804a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a78:	00 00 00 
+  804a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a82:	00 00 00 
+  804a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8c:	00 00 00 
+  804a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a96:	00 00 00 
+  804a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa0:	00 00 00 
+  804aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaa:	00 00 00 
+  804aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab4:	00 00 00 
+  804ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abe:	00 00 00 
+  804ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac8:	00 00 00 
+  804acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad2:	00 00 00 
+  804ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adc:	00 00 00 
+  804adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae6:	00 00 00 
+  804ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af0:	00 00 00 
+  804af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afa:	00 00 00 
+  804afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b04:	00 00 00 
+  804b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0e:	00 00 00 
+  804b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b18:	00 00 00 
+  804b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b22:	00 00 00 
+  804b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2c:	00 00 00 
+  804b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b36:	00 00 00 
+  804b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b40:	00 00 00 
+  804b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4a:	00 00 00 
+  804b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b54:	00 00 00 
+  804b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5e:	00 00 00 
+  804b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b68:	00 00 00 
+  804b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b72:	00 00 00 
+  804b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7c:	00 00 00 
+  804b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b86:	00 00 00 
+  804b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b90:	00 00 00 
+  804b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9a:	00 00 00 
+  804b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba4:	00 00 00 
+  804ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bae:	00 00 00 
+  804bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb8:	00 00 00 
+  804bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc2:	00 00 00 
+  804bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcc:	00 00 00 
+  804bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd6:	00 00 00 
+  804bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be0:	00 00 00 
+  804be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bea:	00 00 00 
+  804bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf4:	00 00 00 
+  804bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfe:	00 00 00 
+  804c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c08:	00 00 00 
+  804c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c12:	00 00 00 
+  804c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1c:	00 00 00 
+  804c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c26:	00 00 00 
+  804c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c30:	00 00 00 
+  804c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3a:	00 00 00 
+  804c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c44:	00 00 00 
+  804c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4e:	00 00 00 
+  804c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c58:	00 00 00 
+  804c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c62:	00 00 00 
+  804c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6c:	00 00 00 
+  804c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c76:	00 00 00 
+  804c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c80:	00 00 00 
+  804c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8a:	00 00 00 
+  804c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c94:	00 00 00 
+  804c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9e:	00 00 00 
+  804ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca8:	00 00 00 
+  804cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb2:	00 00 00 
+  804cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbc:	00 00 00 
+  804cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc6:	00 00 00 
+  804cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd0:	00 00 00 
+  804cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cda:	00 00 00 
+  804cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce4:	00 00 00 
+  804ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cee:	00 00 00 
+  804cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf8:	00 00 00 
+  804cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d02:	00 00 00 
+  804d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0c:	00 00 00 
+  804d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d16:	00 00 00 
+  804d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d20:	00 00 00 
+  804d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2a:	00 00 00 
+  804d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d34:	00 00 00 
+  804d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3e:	00 00 00 
+  804d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d48:	00 00 00 
+  804d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d52:	00 00 00 
+  804d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5c:	00 00 00 
+  804d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d66:	00 00 00 
+  804d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d70:	00 00 00 
+  804d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7a:	00 00 00 
+  804d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d84:	00 00 00 
+  804d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8e:	00 00 00 
+  804d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d98:	00 00 00 
+  804d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da2:	00 00 00 
+  804da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dac:	00 00 00 
+  804daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db6:	00 00 00 
+  804db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc0:	00 00 00 
+  804dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dca:	00 00 00 
+  804dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd4:	00 00 00 
+  804dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dde:	00 00 00 
+  804de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de8:	00 00 00 
+  804deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df2:	00 00 00 
+  804df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfc:	00 00 00 
+  804dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e06:	00 00 00 
+  804e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e10:	00 00 00 
+  804e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1a:	00 00 00 
+  804e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e24:	00 00 00 
+  804e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2e:	00 00 00 
+  804e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e38:	00 00 00 
+  804e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e42:	00 00 00 
+  804e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4c:	00 00 00 
+  804e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e56:	00 00 00 
+  804e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e60:	00 00 00 
+  804e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6a:	00 00 00 
+  804e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e74:	00 00 00 
+  804e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7e:	00 00 00 
+  804e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e88:	00 00 00 
+  804e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e92:	00 00 00 
+  804e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9c:	00 00 00 
+  804e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea6:	00 00 00 
+  804ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb0:	00 00 00 
+  804eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eba:	00 00 00 
+  804ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec4:	00 00 00 
+  804ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ece:	00 00 00 
+  804ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed8:	00 00 00 
+  804edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee2:	00 00 00 
+  804ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eec:	00 00 00 
+  804eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef6:	00 00 00 
+  804ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f00:	00 00 00 
+  804f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0a:	00 00 00 
+  804f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f14:	00 00 00 
+  804f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1e:	00 00 00 
+  804f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f28:	00 00 00 
+  804f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f32:	00 00 00 
+  804f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3c:	00 00 00 
+  804f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f46:	00 00 00 
+  804f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f50:	00 00 00 
+  804f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5a:	00 00 00 
+  804f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f64:	00 00 00 
+  804f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6e:	00 00 00 
+  804f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f78:	00 00 00 
+  804f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f82:	00 00 00 
+  804f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8c:	00 00 00 
+  804f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f96:	00 00 00 
+  804f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa0:	00 00 00 
+  804fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faa:	00 00 00 
+  804fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb4:	00 00 00 
+  804fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbe:	00 00 00 
+  804fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc8:	00 00 00 
+  804fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd2:	00 00 00 
+  804fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdc:	00 00 00 
+  804fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe6:	00 00 00 
+  804fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff0:	00 00 00 
+  804ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffa:	00 00 00 
+  804ffd:	0f 1f 00             	nopl   (%rax)
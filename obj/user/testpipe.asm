@@ -0,0 +1,8295 @@
+
+obj/user/testpipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 85 04 00 00       	call   8004a8 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 78          	sub    $0x78,%rsp
+    char buf[100];
+    int i, pid, p[2];
+
+    binaryname = "pipereadeof";
+  800036:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80003d:	00 00 00 
+  800040:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800047:	00 00 00 
+
+    if ((i = pipe(p)) < 0)
+  80004a:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  800051:	48 b8 6a 3d 80 00 00 	movabs $0x803d6a,%rax
+  800058:	00 00 00 
+  80005b:	ff d0                	call   *%rax
+  80005d:	41 89 c4             	mov    %eax,%r12d
+  800060:	85 c0                	test   %eax,%eax
+  800062:	0f 88 b3 01 00 00    	js     80021b <umain+0x1f6>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  800068:	48 b8 b2 21 80 00 00 	movabs $0x8021b2,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	89 c3                	mov    %eax,%ebx
+  800076:	85 c0                	test   %eax,%eax
+  800078:	0f 88 ca 01 00 00    	js     800248 <umain+0x223>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  80007e:	0f 85 49 02 00 00    	jne    8002cd <umain+0x2a8>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800084:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  80008b:	00 00 00 
+  80008e:	49 8b 45 00          	mov    0x0(%r13),%rax
+  800092:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800098:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  80009e:	48 bf 2e 50 80 00 00 	movabs $0x80502e,%rdi
+  8000a5:	00 00 00 
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	49 bc c4 06 80 00 00 	movabs $0x8006c4,%r12
+  8000b4:	00 00 00 
+  8000b7:	41 ff d4             	call   *%r12
+        close(p[1]);
+  8000ba:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8000c0:	48 b8 b3 24 80 00 00 	movabs $0x8024b3,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8000cc:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8000d0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000d6:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8000dc:	48 bf 4b 50 80 00 00 	movabs $0x80504b,%rdi
+  8000e3:	00 00 00 
+  8000e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000eb:	41 ff d4             	call   *%r12
+        i = readn(p[0], buf, sizeof buf - 1);
+  8000ee:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000f3:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000fa:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800100:	48 b8 ef 26 80 00 00 	movabs $0x8026ef,%rax
+  800107:	00 00 00 
+  80010a:	ff d0                	call   *%rax
+  80010c:	41 89 c4             	mov    %eax,%r12d
+        if (i < 0)
+  80010f:	85 c0                	test   %eax,%eax
+  800111:	0f 88 5f 01 00 00    	js     800276 <umain+0x251>
+            panic("read: %i", i);
+        buf[i] = 0;
+  800117:	48 98                	cltq
+  800119:	c6 84 05 6c ff ff ff 	movb   $0x0,-0x94(%rbp,%rax,1)
+  800120:	00 
+        if (strcmp(buf, msg) == 0)
+  800121:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800128:	00 00 00 
+  80012b:	48 8b 30             	mov    (%rax),%rsi
+  80012e:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800135:	48 b8 e0 10 80 00 00 	movabs $0x8010e0,%rax
+  80013c:	00 00 00 
+  80013f:	ff d0                	call   *%rax
+  800141:	85 c0                	test   %eax,%eax
+  800143:	0f 85 5a 01 00 00    	jne    8002a3 <umain+0x27e>
+            cprintf("\npipe read closed properly\n");
+  800149:	48 bf 71 50 80 00 00 	movabs $0x805071,%rdi
+  800150:	00 00 00 
+  800153:	48 ba c4 06 80 00 00 	movabs $0x8006c4,%rdx
+  80015a:	00 00 00 
+  80015d:	ff d2                	call   *%rdx
+        else
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+        exit();
+  80015f:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+            panic("write: %i", i);
+        close(p[1]);
+    }
+    wait(pid);
+  80016b:	89 df                	mov    %ebx,%edi
+  80016d:	48 b8 c9 3f 80 00 00 	movabs $0x803fc9,%rax
+  800174:	00 00 00 
+  800177:	ff d0                	call   *%rax
+
+    binaryname = "pipewriteeof";
+  800179:	48 b8 c7 50 80 00 00 	movabs $0x8050c7,%rax
+  800180:	00 00 00 
+  800183:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  80018a:	00 00 00 
+    if ((i = pipe(p)) < 0)
+  80018d:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  800194:	48 b8 6a 3d 80 00 00 	movabs $0x803d6a,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+  8001a0:	41 89 c4             	mov    %eax,%r12d
+  8001a3:	85 c0                	test   %eax,%eax
+  8001a5:	0f 88 1a 02 00 00    	js     8003c5 <umain+0x3a0>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  8001ab:	48 b8 b2 21 80 00 00 	movabs $0x8021b2,%rax
+  8001b2:	00 00 00 
+  8001b5:	ff d0                	call   *%rax
+  8001b7:	89 c3                	mov    %eax,%ebx
+  8001b9:	85 c0                	test   %eax,%eax
+  8001bb:	0f 88 31 02 00 00    	js     8003f2 <umain+0x3cd>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  8001c1:	0f 84 59 02 00 00    	je     800420 <umain+0x3fb>
+                break;
+        }
+        cprintf("\npipe write closed properly\n");
+        exit();
+    }
+    close(p[0]);
+  8001c7:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8001cd:	49 bc b3 24 80 00 00 	movabs $0x8024b3,%r12
+  8001d4:	00 00 00 
+  8001d7:	41 ff d4             	call   *%r12
+    close(p[1]);
+  8001da:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8001e0:	41 ff d4             	call   *%r12
+    wait(pid);
+  8001e3:	89 df                	mov    %ebx,%edi
+  8001e5:	48 b8 c9 3f 80 00 00 	movabs $0x803fc9,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+
+    cprintf("pipe tests passed\n");
+  8001f1:	48 bf f5 50 80 00 00 	movabs $0x8050f5,%rdi
+  8001f8:	00 00 00 
+  8001fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800200:	48 ba c4 06 80 00 00 	movabs $0x8006c4,%rdx
+  800207:	00 00 00 
+  80020a:	ff d2                	call   *%rdx
+}
+  80020c:	48 83 c4 78          	add    $0x78,%rsp
+  800210:	5b                   	pop    %rbx
+  800211:	41 5c                	pop    %r12
+  800213:	41 5d                	pop    %r13
+  800215:	41 5e                	pop    %r14
+  800217:	41 5f                	pop    %r15
+  800219:	5d                   	pop    %rbp
+  80021a:	c3                   	ret
+        panic("pipe: %i", i);
+  80021b:	89 c1                	mov    %eax,%ecx
+  80021d:	48 ba 0c 50 80 00 00 	movabs $0x80500c,%rdx
+  800224:	00 00 00 
+  800227:	be 0d 00 00 00       	mov    $0xd,%esi
+  80022c:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  800233:	00 00 00 
+  800236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023b:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  800242:	00 00 00 
+  800245:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  800248:	44 89 e1             	mov    %r12d,%ecx
+  80024b:	48 ba 25 50 80 00 00 	movabs $0x805025,%rdx
+  800252:	00 00 00 
+  800255:	be 10 00 00 00       	mov    $0x10,%esi
+  80025a:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  800261:	00 00 00 
+  800264:	b8 00 00 00 00       	mov    $0x0,%eax
+  800269:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  800270:	00 00 00 
+  800273:	41 ff d0             	call   *%r8
+            panic("read: %i", i);
+  800276:	89 c1                	mov    %eax,%ecx
+  800278:	48 ba 68 50 80 00 00 	movabs $0x805068,%rdx
+  80027f:	00 00 00 
+  800282:	be 18 00 00 00       	mov    $0x18,%esi
+  800287:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  80028e:	00 00 00 
+  800291:	b8 00 00 00 00       	mov    $0x0,%eax
+  800296:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  80029d:	00 00 00 
+  8002a0:	41 ff d0             	call   *%r8
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+  8002a3:	48 8d 95 6c ff ff ff 	lea    -0x94(%rbp),%rdx
+  8002aa:	44 89 e6             	mov    %r12d,%esi
+  8002ad:	48 bf 8d 50 80 00 00 	movabs $0x80508d,%rdi
+  8002b4:	00 00 00 
+  8002b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bc:	48 b9 c4 06 80 00 00 	movabs $0x8006c4,%rcx
+  8002c3:	00 00 00 
+  8002c6:	ff d1                	call   *%rcx
+  8002c8:	e9 92 fe ff ff       	jmp    80015f <umain+0x13a>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8002cd:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  8002d4:	00 00 00 
+  8002d7:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8002db:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8002e1:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8002e7:	48 bf 2e 50 80 00 00 	movabs $0x80502e,%rdi
+  8002ee:	00 00 00 
+  8002f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f6:	49 bc c4 06 80 00 00 	movabs $0x8006c4,%r12
+  8002fd:	00 00 00 
+  800300:	41 ff d4             	call   *%r12
+        close(p[0]);
+  800303:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800309:	48 b8 b3 24 80 00 00 	movabs $0x8024b3,%rax
+  800310:	00 00 00 
+  800313:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  800315:	49 8b 45 00          	mov    0x0(%r13),%rax
+  800319:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80031f:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  800325:	48 bf a0 50 80 00 00 	movabs $0x8050a0,%rdi
+  80032c:	00 00 00 
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	41 ff d4             	call   *%r12
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800337:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  80033e:	00 00 00 
+  800341:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  800345:	49 bf fe 0f 80 00 00 	movabs $0x800ffe,%r15
+  80034c:	00 00 00 
+  80034f:	41 ff d7             	call   *%r15
+  800352:	48 89 c2             	mov    %rax,%rdx
+  800355:	49 8b 75 00          	mov    0x0(%r13),%rsi
+  800359:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  80035f:	48 b8 60 27 80 00 00 	movabs $0x802760,%rax
+  800366:	00 00 00 
+  800369:	ff d0                	call   *%rax
+  80036b:	49 89 c4             	mov    %rax,%r12
+  80036e:	41 89 c6             	mov    %eax,%r14d
+  800371:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  800375:	41 ff d7             	call   *%r15
+  800378:	4d 63 e4             	movslq %r12d,%r12
+  80037b:	49 39 c4             	cmp    %rax,%r12
+  80037e:	75 17                	jne    800397 <umain+0x372>
+        close(p[1]);
+  800380:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800386:	48 b8 b3 24 80 00 00 	movabs $0x8024b3,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+  800392:	e9 d4 fd ff ff       	jmp    80016b <umain+0x146>
+            panic("write: %i", i);
+  800397:	44 89 f1             	mov    %r14d,%ecx
+  80039a:	48 ba bd 50 80 00 00 	movabs $0x8050bd,%rdx
+  8003a1:	00 00 00 
+  8003a4:	be 24 00 00 00       	mov    $0x24,%esi
+  8003a9:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  8003b0:	00 00 00 
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  8003bf:	00 00 00 
+  8003c2:	41 ff d0             	call   *%r8
+        panic("pipe: %i", i);
+  8003c5:	89 c1                	mov    %eax,%ecx
+  8003c7:	48 ba 0c 50 80 00 00 	movabs $0x80500c,%rdx
+  8003ce:	00 00 00 
+  8003d1:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003d6:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  8003dd:	00 00 00 
+  8003e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e5:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  8003ec:	00 00 00 
+  8003ef:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  8003f2:	44 89 e1             	mov    %r12d,%ecx
+  8003f5:	48 ba 25 50 80 00 00 	movabs $0x805025,%rdx
+  8003fc:	00 00 00 
+  8003ff:	be 2e 00 00 00       	mov    $0x2e,%esi
+  800404:	48 bf 15 50 80 00 00 	movabs $0x805015,%rdi
+  80040b:	00 00 00 
+  80040e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800413:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  80041a:	00 00 00 
+  80041d:	41 ff d0             	call   *%r8
+        close(p[0]);
+  800420:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800426:	48 b8 b3 24 80 00 00 	movabs $0x8024b3,%rax
+  80042d:	00 00 00 
+  800430:	ff d0                	call   *%rax
+            cprintf(".");
+  800432:	49 bf d4 50 80 00 00 	movabs $0x8050d4,%r15
+  800439:	00 00 00 
+  80043c:	49 be c4 06 80 00 00 	movabs $0x8006c4,%r14
+  800443:	00 00 00 
+            if (write(p[1], "x", 1) != 1)
+  800446:	49 bd d6 50 80 00 00 	movabs $0x8050d6,%r13
+  80044d:	00 00 00 
+  800450:	49 bc 60 27 80 00 00 	movabs $0x802760,%r12
+  800457:	00 00 00 
+            cprintf(".");
+  80045a:	4c 89 ff             	mov    %r15,%rdi
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	41 ff d6             	call   *%r14
+            if (write(p[1], "x", 1) != 1)
+  800465:	ba 01 00 00 00       	mov    $0x1,%edx
+  80046a:	4c 89 ee             	mov    %r13,%rsi
+  80046d:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800473:	41 ff d4             	call   *%r12
+  800476:	48 83 f8 01          	cmp    $0x1,%rax
+  80047a:	74 de                	je     80045a <umain+0x435>
+        cprintf("\npipe write closed properly\n");
+  80047c:	48 bf d8 50 80 00 00 	movabs $0x8050d8,%rdi
+  800483:	00 00 00 
+  800486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048b:	48 ba c4 06 80 00 00 	movabs $0x8006c4,%rdx
+  800492:	00 00 00 
+  800495:	ff d2                	call   *%rdx
+        exit();
+  800497:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  80049e:	00 00 00 
+  8004a1:	ff d0                	call   *%rax
+  8004a3:	e9 1f fd ff ff       	jmp    8001c7 <umain+0x1a2>
+
+00000000008004a8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8004a8:	55                   	push   %rbp
+  8004a9:	48 89 e5             	mov    %rsp,%rbp
+  8004ac:	41 56                	push   %r14
+  8004ae:	41 55                	push   %r13
+  8004b0:	41 54                	push   %r12
+  8004b2:	53                   	push   %rbx
+  8004b3:	41 89 fd             	mov    %edi,%r13d
+  8004b6:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004b9:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  8004c0:	00 00 00 
+  8004c3:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8004ca:	00 00 00 
+  8004cd:	48 39 c2             	cmp    %rax,%rdx
+  8004d0:	73 17                	jae    8004e9 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8004d2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004d5:	49 89 c4             	mov    %rax,%r12
+  8004d8:	48 83 c3 08          	add    $0x8,%rbx
+  8004dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e1:	ff 53 f8             	call   *-0x8(%rbx)
+  8004e4:	4c 39 e3             	cmp    %r12,%rbx
+  8004e7:	72 ef                	jb     8004d8 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8004e9:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+  8004f5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004fa:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  800501:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800508:	00 00 00 
+  80050b:	48 01 d0             	add    %rdx,%rax
+  80050e:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800515:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800518:	45 85 ed             	test   %r13d,%r13d
+  80051b:	7e 0d                	jle    80052a <libmain+0x82>
+  80051d:	49 8b 06             	mov    (%r14),%rax
+  800520:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800527:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80052a:	4c 89 f6             	mov    %r14,%rsi
+  80052d:	44 89 ef             	mov    %r13d,%edi
+  800530:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800537:	00 00 00 
+  80053a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80053c:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  800543:	00 00 00 
+  800546:	ff d0                	call   *%rax
+#endif
+}
+  800548:	5b                   	pop    %rbx
+  800549:	41 5c                	pop    %r12
+  80054b:	41 5d                	pop    %r13
+  80054d:	41 5e                	pop    %r14
+  80054f:	5d                   	pop    %rbp
+  800550:	c3                   	ret
+
+0000000000800551 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800551:	55                   	push   %rbp
+  800552:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800555:	48 b8 e6 24 80 00 00 	movabs $0x8024e6,%rax
+  80055c:	00 00 00 
+  80055f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800561:	bf 00 00 00 00       	mov    $0x0,%edi
+  800566:	48 b8 71 16 80 00 00 	movabs $0x801671,%rax
+  80056d:	00 00 00 
+  800570:	ff d0                	call   *%rax
+}
+  800572:	5d                   	pop    %rbp
+  800573:	c3                   	ret
+
+0000000000800574 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800574:	55                   	push   %rbp
+  800575:	48 89 e5             	mov    %rsp,%rbp
+  800578:	41 56                	push   %r14
+  80057a:	41 55                	push   %r13
+  80057c:	41 54                	push   %r12
+  80057e:	53                   	push   %rbx
+  80057f:	48 83 ec 50          	sub    $0x50,%rsp
+  800583:	49 89 fc             	mov    %rdi,%r12
+  800586:	41 89 f5             	mov    %esi,%r13d
+  800589:	48 89 d3             	mov    %rdx,%rbx
+  80058c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800590:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800594:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800598:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80059f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8005a7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8005ab:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005af:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8005b6:	00 00 00 
+  8005b9:	4c 8b 30             	mov    (%rax),%r14
+  8005bc:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  8005c3:	00 00 00 
+  8005c6:	ff d0                	call   *%rax
+  8005c8:	89 c6                	mov    %eax,%esi
+  8005ca:	45 89 e8             	mov    %r13d,%r8d
+  8005cd:	4c 89 e1             	mov    %r12,%rcx
+  8005d0:	4c 89 f2             	mov    %r14,%rdx
+  8005d3:	48 bf 58 51 80 00 00 	movabs $0x805158,%rdi
+  8005da:	00 00 00 
+  8005dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e2:	49 bc c4 06 80 00 00 	movabs $0x8006c4,%r12
+  8005e9:	00 00 00 
+  8005ec:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8005ef:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8005f3:	48 89 df             	mov    %rbx,%rdi
+  8005f6:	48 b8 60 06 80 00 00 	movabs $0x800660,%rax
+  8005fd:	00 00 00 
+  800600:	ff d0                	call   *%rax
+    cprintf("\n");
+  800602:	48 bf 49 50 80 00 00 	movabs $0x805049,%rdi
+  800609:	00 00 00 
+  80060c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800611:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800614:	cc                   	int3
+  800615:	eb fd                	jmp    800614 <_panic+0xa0>
+
+0000000000800617 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800617:	55                   	push   %rbp
+  800618:	48 89 e5             	mov    %rsp,%rbp
+  80061b:	53                   	push   %rbx
+  80061c:	48 83 ec 08          	sub    $0x8,%rsp
+  800620:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800623:	8b 06                	mov    (%rsi),%eax
+  800625:	8d 50 01             	lea    0x1(%rax),%edx
+  800628:	89 16                	mov    %edx,(%rsi)
+  80062a:	48 98                	cltq
+  80062c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800631:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800637:	74 0a                	je     800643 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800639:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80063d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800641:	c9                   	leave
+  800642:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800643:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800647:	be ff 00 00 00       	mov    $0xff,%esi
+  80064c:	48 b8 13 16 80 00 00 	movabs $0x801613,%rax
+  800653:	00 00 00 
+  800656:	ff d0                	call   *%rax
+        state->offset = 0;
+  800658:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80065e:	eb d9                	jmp    800639 <putch+0x22>
+
+0000000000800660 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800660:	55                   	push   %rbp
+  800661:	48 89 e5             	mov    %rsp,%rbp
+  800664:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80066b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80066e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800675:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80067a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800682:	48 89 f1             	mov    %rsi,%rcx
+  800685:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80068c:	48 bf 17 06 80 00 00 	movabs $0x800617,%rdi
+  800693:	00 00 00 
+  800696:	48 b8 14 08 80 00 00 	movabs $0x800814,%rax
+  80069d:	00 00 00 
+  8006a0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8006a2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8006a9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8006b0:	48 b8 13 16 80 00 00 	movabs $0x801613,%rax
+  8006b7:	00 00 00 
+  8006ba:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8006bc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8006c2:	c9                   	leave
+  8006c3:	c3                   	ret
+
+00000000008006c4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8006c4:	55                   	push   %rbp
+  8006c5:	48 89 e5             	mov    %rsp,%rbp
+  8006c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8006cc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8006d0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8006d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006d8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006dc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8006e0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8006e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8006f7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8006fb:	48 b8 60 06 80 00 00 	movabs $0x800660,%rax
+  800702:	00 00 00 
+  800705:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800707:	c9                   	leave
+  800708:	c3                   	ret
+
+0000000000800709 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800709:	55                   	push   %rbp
+  80070a:	48 89 e5             	mov    %rsp,%rbp
+  80070d:	41 57                	push   %r15
+  80070f:	41 56                	push   %r14
+  800711:	41 55                	push   %r13
+  800713:	41 54                	push   %r12
+  800715:	53                   	push   %rbx
+  800716:	48 83 ec 18          	sub    $0x18,%rsp
+  80071a:	49 89 fc             	mov    %rdi,%r12
+  80071d:	49 89 f5             	mov    %rsi,%r13
+  800720:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800724:	8b 45 10             	mov    0x10(%rbp),%eax
+  800727:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80072a:	41 89 cf             	mov    %ecx,%r15d
+  80072d:	4c 39 fa             	cmp    %r15,%rdx
+  800730:	73 5b                	jae    80078d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800732:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800736:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80073a:	85 db                	test   %ebx,%ebx
+  80073c:	7e 0e                	jle    80074c <print_num+0x43>
+            putch(padc, put_arg);
+  80073e:	4c 89 ee             	mov    %r13,%rsi
+  800741:	44 89 f7             	mov    %r14d,%edi
+  800744:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800747:	83 eb 01             	sub    $0x1,%ebx
+  80074a:	75 f2                	jne    80073e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80074c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800750:	48 b9 8c 51 80 00 00 	movabs $0x80518c,%rcx
+  800757:	00 00 00 
+  80075a:	48 b8 7b 51 80 00 00 	movabs $0x80517b,%rax
+  800761:	00 00 00 
+  800764:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800768:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80076c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800771:	49 f7 f7             	div    %r15
+  800774:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800778:	4c 89 ee             	mov    %r13,%rsi
+  80077b:	41 ff d4             	call   *%r12
+}
+  80077e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800782:	5b                   	pop    %rbx
+  800783:	41 5c                	pop    %r12
+  800785:	41 5d                	pop    %r13
+  800787:	41 5e                	pop    %r14
+  800789:	41 5f                	pop    %r15
+  80078b:	5d                   	pop    %rbp
+  80078c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80078d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800791:	ba 00 00 00 00       	mov    $0x0,%edx
+  800796:	49 f7 f7             	div    %r15
+  800799:	48 83 ec 08          	sub    $0x8,%rsp
+  80079d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8007a1:	52                   	push   %rdx
+  8007a2:	45 0f be c9          	movsbl %r9b,%r9d
+  8007a6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007aa:	48 89 c2             	mov    %rax,%rdx
+  8007ad:	48 b8 09 07 80 00 00 	movabs $0x800709,%rax
+  8007b4:	00 00 00 
+  8007b7:	ff d0                	call   *%rax
+  8007b9:	48 83 c4 10          	add    $0x10,%rsp
+  8007bd:	eb 8d                	jmp    80074c <print_num+0x43>
+
+00000000008007bf <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8007bf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8007c3:	48 8b 06             	mov    (%rsi),%rax
+  8007c6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007ca:	73 0a                	jae    8007d6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8007cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007d0:	48 89 16             	mov    %rdx,(%rsi)
+  8007d3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8007d6:	c3                   	ret
+
+00000000008007d7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8007d7:	55                   	push   %rbp
+  8007d8:	48 89 e5             	mov    %rsp,%rbp
+  8007db:	48 83 ec 50          	sub    $0x50,%rsp
+  8007df:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007e3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007e7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8007eb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8007f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800802:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800806:	48 b8 14 08 80 00 00 	movabs $0x800814,%rax
+  80080d:	00 00 00 
+  800810:	ff d0                	call   *%rax
+}
+  800812:	c9                   	leave
+  800813:	c3                   	ret
+
+0000000000800814 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800814:	55                   	push   %rbp
+  800815:	48 89 e5             	mov    %rsp,%rbp
+  800818:	41 57                	push   %r15
+  80081a:	41 56                	push   %r14
+  80081c:	41 55                	push   %r13
+  80081e:	41 54                	push   %r12
+  800820:	53                   	push   %rbx
+  800821:	48 83 ec 38          	sub    $0x38,%rsp
+  800825:	49 89 fe             	mov    %rdi,%r14
+  800828:	49 89 f5             	mov    %rsi,%r13
+  80082b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80082e:	48 8b 01             	mov    (%rcx),%rax
+  800831:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800835:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800839:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800841:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800845:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800849:	0f b6 3b             	movzbl (%rbx),%edi
+  80084c:	40 80 ff 25          	cmp    $0x25,%dil
+  800850:	74 18                	je     80086a <vprintfmt+0x56>
+            if (!ch) return;
+  800852:	40 84 ff             	test   %dil,%dil
+  800855:	0f 84 04 07 00 00    	je     800f5f <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  80085b:	40 0f b6 ff          	movzbl %dil,%edi
+  80085f:	4c 89 ee             	mov    %r13,%rsi
+  800862:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800865:	4c 89 e3             	mov    %r12,%rbx
+  800868:	eb db                	jmp    800845 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80086a:	be 00 00 00 00       	mov    $0x0,%esi
+  80086f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800873:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800878:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80087e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800885:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800889:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80088e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800893:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800896:	83 e8 23             	sub    $0x23,%eax
+  800899:	3c 57                	cmp    $0x57,%al
+  80089b:	0f 87 a4 06 00 00    	ja     800f45 <vprintfmt+0x731>
+  8008a1:	0f b6 c0             	movzbl %al,%eax
+  8008a4:	48 b9 20 53 80 00 00 	movabs $0x805320,%rcx
+  8008ab:	00 00 00 
+  8008ae:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8008b1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8008b4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8008b8:	eb cf                	jmp    800889 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8008ba:	49 89 dc             	mov    %rbx,%r12
+  8008bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8008c2:	eb c5                	jmp    800889 <vprintfmt+0x75>
+            padc = ch;
+  8008c4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8008c8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8008cb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008ce:	eb b9                	jmp    800889 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d6:	77 24                	ja     8008fc <vprintfmt+0xe8>
+  8008d8:	89 c1                	mov    %eax,%ecx
+  8008da:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8008de:	83 c0 08             	add    $0x8,%eax
+  8008e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8008e7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8008ea:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008ee:	79 99                	jns    800889 <vprintfmt+0x75>
+                width = precision;
+  8008f0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8008f4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8008fa:	eb 8d                	jmp    800889 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008fc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800900:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800904:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800908:	eb da                	jmp    8008e4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80090a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80090f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800913:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800919:	3c 39                	cmp    $0x39,%al
+  80091b:	77 1c                	ja     800939 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80091d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800921:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800925:	0f b6 c0             	movzbl %al,%eax
+  800928:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80092d:	0f b6 03             	movzbl (%rbx),%eax
+  800930:	3c 39                	cmp    $0x39,%al
+  800932:	76 e9                	jbe    80091d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800934:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800937:	eb b1                	jmp    8008ea <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800939:	49 89 dc             	mov    %rbx,%r12
+  80093c:	eb ac                	jmp    8008ea <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80093e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800941:	85 c9                	test   %ecx,%ecx
+  800943:	b8 00 00 00 00       	mov    $0x0,%eax
+  800948:	0f 49 c1             	cmovns %ecx,%eax
+  80094b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80094e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800951:	e9 33 ff ff ff       	jmp    800889 <vprintfmt+0x75>
+            lflag++;
+  800956:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800959:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80095c:	e9 28 ff ff ff       	jmp    800889 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800961:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800964:	83 f8 2f             	cmp    $0x2f,%eax
+  800967:	77 19                	ja     800982 <vprintfmt+0x16e>
+  800969:	89 c2                	mov    %eax,%edx
+  80096b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096f:	83 c0 08             	add    $0x8,%eax
+  800972:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800975:	8b 3a                	mov    (%rdx),%edi
+  800977:	4c 89 ee             	mov    %r13,%rsi
+  80097a:	41 ff d6             	call   *%r14
+            break;
+  80097d:	e9 c3 fe ff ff       	jmp    800845 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800982:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800986:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098e:	eb e5                	jmp    800975 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800990:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800993:	83 f8 2f             	cmp    $0x2f,%eax
+  800996:	77 5a                	ja     8009f2 <vprintfmt+0x1de>
+  800998:	89 c2                	mov    %eax,%edx
+  80099a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099e:	83 c0 08             	add    $0x8,%eax
+  8009a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8009a4:	8b 02                	mov    (%rdx),%eax
+  8009a6:	89 c1                	mov    %eax,%ecx
+  8009a8:	f7 d9                	neg    %ecx
+  8009aa:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8009ad:	83 f9 13             	cmp    $0x13,%ecx
+  8009b0:	7f 4e                	jg     800a00 <vprintfmt+0x1ec>
+  8009b2:	48 63 c1             	movslq %ecx,%rax
+  8009b5:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  8009bc:	00 00 00 
+  8009bf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8009c3:	48 85 c0             	test   %rax,%rax
+  8009c6:	74 38                	je     800a00 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8009c8:	48 89 c1             	mov    %rax,%rcx
+  8009cb:	48 ba 39 58 80 00 00 	movabs $0x805839,%rdx
+  8009d2:	00 00 00 
+  8009d5:	4c 89 ee             	mov    %r13,%rsi
+  8009d8:	4c 89 f7             	mov    %r14,%rdi
+  8009db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e0:	49 b8 d7 07 80 00 00 	movabs $0x8007d7,%r8
+  8009e7:	00 00 00 
+  8009ea:	41 ff d0             	call   *%r8
+  8009ed:	e9 53 fe ff ff       	jmp    800845 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8009f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fe:	eb a4                	jmp    8009a4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800a00:	48 ba a4 51 80 00 00 	movabs $0x8051a4,%rdx
+  800a07:	00 00 00 
+  800a0a:	4c 89 ee             	mov    %r13,%rsi
+  800a0d:	4c 89 f7             	mov    %r14,%rdi
+  800a10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a15:	49 b8 d7 07 80 00 00 	movabs $0x8007d7,%r8
+  800a1c:	00 00 00 
+  800a1f:	41 ff d0             	call   *%r8
+  800a22:	e9 1e fe ff ff       	jmp    800845 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2d:	77 36                	ja     800a65 <vprintfmt+0x251>
+  800a2f:	89 c2                	mov    %eax,%edx
+  800a31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a35:	83 c0 08             	add    $0x8,%eax
+  800a38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3b:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  800a3e:	48 85 f6             	test   %rsi,%rsi
+  800a41:	48 b8 9d 51 80 00 00 	movabs $0x80519d,%rax
+  800a48:	00 00 00 
+  800a4b:	48 0f 45 c6          	cmovne %rsi,%rax
+  800a4f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800a53:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a57:	7e 06                	jle    800a5f <vprintfmt+0x24b>
+  800a59:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800a5d:	75 14                	jne    800a73 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a5f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a63:	eb 5b                	jmp    800ac0 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800a65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a71:	eb c8                	jmp    800a3b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a73:	49 63 f7             	movslq %r15d,%rsi
+  800a76:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a7a:	48 b8 19 10 80 00 00 	movabs $0x801019,%rax
+  800a81:	00 00 00 
+  800a84:	ff d0                	call   *%rax
+  800a86:	48 89 c2             	mov    %rax,%rdx
+  800a89:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a8c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a8e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a91:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a94:	85 c0                	test   %eax,%eax
+  800a96:	7e c7                	jle    800a5f <vprintfmt+0x24b>
+  800a98:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a9d:	4c 89 ee             	mov    %r13,%rsi
+  800aa0:	44 89 e7             	mov    %r12d,%edi
+  800aa3:	41 ff d6             	call   *%r14
+  800aa6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800aaa:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800aad:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800ab0:	75 eb                	jne    800a9d <vprintfmt+0x289>
+  800ab2:	eb ab                	jmp    800a5f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800ab4:	0f b6 f8             	movzbl %al,%edi
+  800ab7:	4c 89 ee             	mov    %r13,%rsi
+  800aba:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800abd:	4c 89 e2             	mov    %r12,%rdx
+  800ac0:	45 85 ff             	test   %r15d,%r15d
+  800ac3:	78 06                	js     800acb <vprintfmt+0x2b7>
+  800ac5:	41 83 ef 01          	sub    $0x1,%r15d
+  800ac9:	78 23                	js     800aee <vprintfmt+0x2da>
+  800acb:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800acf:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800ad5:	84 c0                	test   %al,%al
+  800ad7:	74 15                	je     800aee <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800ad9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800add:	74 d5                	je     800ab4 <vprintfmt+0x2a0>
+  800adf:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800ae2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ae7:	80 fa 5e             	cmp    $0x5e,%dl
+  800aea:	77 cb                	ja     800ab7 <vprintfmt+0x2a3>
+  800aec:	eb c6                	jmp    800ab4 <vprintfmt+0x2a0>
+  800aee:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800af1:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800af4:	01 f0                	add    %esi,%eax
+  800af6:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  800af8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800afc:	85 c0                	test   %eax,%eax
+  800afe:	0f 8e 41 fd ff ff    	jle    800845 <vprintfmt+0x31>
+  800b04:	4c 89 ee             	mov    %r13,%rsi
+  800b07:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b0c:	41 ff d6             	call   *%r14
+  800b0f:	41 83 ec 01          	sub    $0x1,%r12d
+  800b13:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800b17:	75 eb                	jne    800b04 <vprintfmt+0x2f0>
+  800b19:	e9 27 fd ff ff       	jmp    800845 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800b1e:	40 84 f6             	test   %sil,%sil
+  800b21:	75 26                	jne    800b49 <vprintfmt+0x335>
+    switch (lflag) {
+  800b23:	85 d2                	test   %edx,%edx
+  800b25:	74 59                	je     800b80 <vprintfmt+0x36c>
+  800b27:	83 fa 01             	cmp    $0x1,%edx
+  800b2a:	74 7b                	je     800ba7 <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  800b2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b32:	0f 87 96 00 00 00    	ja     800bce <vprintfmt+0x3ba>
+  800b38:	89 c2                	mov    %eax,%edx
+  800b3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3e:	83 c0 08             	add    $0x8,%eax
+  800b41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b44:	4c 8b 22             	mov    (%rdx),%r12
+  800b47:	eb 17                	jmp    800b60 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  800b49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4f:	77 21                	ja     800b72 <vprintfmt+0x35e>
+  800b51:	89 c2                	mov    %eax,%edx
+  800b53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b57:	83 c0 08             	add    $0x8,%eax
+  800b5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b60:	4d 85 e4             	test   %r12,%r12
+  800b63:	78 7a                	js     800bdf <vprintfmt+0x3cb>
+            num = i;
+  800b65:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b68:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b6d:	e9 b5 02 00 00       	jmp    800e27 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800b72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7e:	eb dd                	jmp    800b5d <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800b80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b83:	83 f8 2f             	cmp    $0x2f,%eax
+  800b86:	77 11                	ja     800b99 <vprintfmt+0x385>
+  800b88:	89 c2                	mov    %eax,%edx
+  800b8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8e:	83 c0 08             	add    $0x8,%eax
+  800b91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b94:	4c 63 22             	movslq (%rdx),%r12
+  800b97:	eb c7                	jmp    800b60 <vprintfmt+0x34c>
+  800b99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba5:	eb ed                	jmp    800b94 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800ba7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800baa:	83 f8 2f             	cmp    $0x2f,%eax
+  800bad:	77 11                	ja     800bc0 <vprintfmt+0x3ac>
+  800baf:	89 c2                	mov    %eax,%edx
+  800bb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb5:	83 c0 08             	add    $0x8,%eax
+  800bb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbb:	4c 8b 22             	mov    (%rdx),%r12
+  800bbe:	eb a0                	jmp    800b60 <vprintfmt+0x34c>
+  800bc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcc:	eb ed                	jmp    800bbb <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800bce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bda:	e9 65 ff ff ff       	jmp    800b44 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800bdf:	4c 89 ee             	mov    %r13,%rsi
+  800be2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800be7:	41 ff d6             	call   *%r14
+                i = -i;
+  800bea:	49 f7 dc             	neg    %r12
+  800bed:	e9 73 ff ff ff       	jmp    800b65 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800bf2:	40 84 f6             	test   %sil,%sil
+  800bf5:	75 32                	jne    800c29 <vprintfmt+0x415>
+    switch (lflag) {
+  800bf7:	85 d2                	test   %edx,%edx
+  800bf9:	74 5d                	je     800c58 <vprintfmt+0x444>
+  800bfb:	83 fa 01             	cmp    $0x1,%edx
+  800bfe:	0f 84 82 00 00 00    	je     800c86 <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800c04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c07:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0a:	0f 87 a5 00 00 00    	ja     800cb5 <vprintfmt+0x4a1>
+  800c10:	89 c2                	mov    %eax,%edx
+  800c12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c16:	83 c0 08             	add    $0x8,%eax
+  800c19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c1f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c24:	e9 fe 01 00 00       	jmp    800e27 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800c29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c2f:	77 19                	ja     800c4a <vprintfmt+0x436>
+  800c31:	89 c2                	mov    %eax,%edx
+  800c33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c37:	83 c0 08             	add    $0x8,%eax
+  800c3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c40:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c45:	e9 dd 01 00 00       	jmp    800e27 <vprintfmt+0x613>
+  800c4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c56:	eb e5                	jmp    800c3d <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800c58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5e:	77 18                	ja     800c78 <vprintfmt+0x464>
+  800c60:	89 c2                	mov    %eax,%edx
+  800c62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c66:	83 c0 08             	add    $0x8,%eax
+  800c69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c6e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c73:	e9 af 01 00 00       	jmp    800e27 <vprintfmt+0x613>
+  800c78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c84:	eb e6                	jmp    800c6c <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800c86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c89:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8c:	77 19                	ja     800ca7 <vprintfmt+0x493>
+  800c8e:	89 c2                	mov    %eax,%edx
+  800c90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c94:	83 c0 08             	add    $0x8,%eax
+  800c97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c9d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ca2:	e9 80 01 00 00       	jmp    800e27 <vprintfmt+0x613>
+  800ca7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800caf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb3:	eb e5                	jmp    800c9a <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800cb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc1:	e9 56 ff ff ff       	jmp    800c1c <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800cc6:	40 84 f6             	test   %sil,%sil
+  800cc9:	75 2e                	jne    800cf9 <vprintfmt+0x4e5>
+    switch (lflag) {
+  800ccb:	85 d2                	test   %edx,%edx
+  800ccd:	0f 84 b3 00 00 00    	je     800d86 <vprintfmt+0x572>
+  800cd3:	83 fa 01             	cmp    $0x1,%edx
+  800cd6:	0f 84 d3 00 00 00    	je     800daf <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800cdc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cdf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce2:	0f 87 f1 00 00 00    	ja     800dd9 <vprintfmt+0x5c5>
+  800ce8:	89 c2                	mov    %eax,%edx
+  800cea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cee:	83 c0 08             	add    $0x8,%eax
+  800cf1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf4:	48 8b 02             	mov    (%rdx),%rax
+  800cf7:	eb 17                	jmp    800d10 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800cf9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfc:	83 f8 2f             	cmp    $0x2f,%eax
+  800cff:	77 77                	ja     800d78 <vprintfmt+0x564>
+  800d01:	89 c2                	mov    %eax,%edx
+  800d03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d07:	83 c0 08             	add    $0x8,%eax
+  800d0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0d:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800d10:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800d12:	83 f8 07             	cmp    $0x7,%eax
+  800d15:	0f 8e cf 00 00 00    	jle    800dea <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800d1b:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800d21:	44 89 e7             	mov    %r12d,%edi
+  800d24:	41 c1 e4 03          	shl    $0x3,%r12d
+  800d28:	89 d1                	mov    %edx,%ecx
+  800d2a:	8d 72 07             	lea    0x7(%rdx),%esi
+  800d2d:	85 d2                	test   %edx,%edx
+  800d2f:	0f 48 d6             	cmovs  %esi,%edx
+  800d32:	c1 fa 03             	sar    $0x3,%edx
+  800d35:	83 f9 3f             	cmp    $0x3f,%ecx
+  800d38:	7f e7                	jg     800d21 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800d3a:	85 ff                	test   %edi,%edi
+  800d3c:	0f 84 03 fb ff ff    	je     800845 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800d42:	49 63 f4             	movslq %r12d,%rsi
+  800d45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4a:	48 f7 f6             	div    %rsi
+  800d4d:	49 89 d7             	mov    %rdx,%r15
+  800d50:	83 c0 30             	add    $0x30,%eax
+  800d53:	0f be f8             	movsbl %al,%edi
+  800d56:	4c 89 ee             	mov    %r13,%rsi
+  800d59:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800d5c:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800d5f:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800d64:	45 85 e4             	test   %r12d,%r12d
+  800d67:	41 0f 49 d4          	cmovns %r12d,%edx
+  800d6b:	c1 fa 03             	sar    $0x3,%edx
+  800d6e:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800d71:	75 cf                	jne    800d42 <vprintfmt+0x52e>
+  800d73:	e9 cd fa ff ff       	jmp    800845 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800d78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d84:	eb 87                	jmp    800d0d <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800d86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d89:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8c:	77 13                	ja     800da1 <vprintfmt+0x58d>
+  800d8e:	89 c2                	mov    %eax,%edx
+  800d90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d94:	83 c0 08             	add    $0x8,%eax
+  800d97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d9a:	8b 02                	mov    (%rdx),%eax
+  800d9c:	e9 6f ff ff ff       	jmp    800d10 <vprintfmt+0x4fc>
+  800da1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dad:	eb eb                	jmp    800d9a <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800daf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db2:	83 f8 2f             	cmp    $0x2f,%eax
+  800db5:	77 14                	ja     800dcb <vprintfmt+0x5b7>
+  800db7:	89 c2                	mov    %eax,%edx
+  800db9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dbd:	83 c0 08             	add    $0x8,%eax
+  800dc0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc3:	48 8b 02             	mov    (%rdx),%rax
+  800dc6:	e9 45 ff ff ff       	jmp    800d10 <vprintfmt+0x4fc>
+  800dcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd7:	eb ea                	jmp    800dc3 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800dd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ddd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800de1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de5:	e9 0a ff ff ff       	jmp    800cf4 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800dea:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800df0:	e9 4d ff ff ff       	jmp    800d42 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800df5:	4c 89 ee             	mov    %r13,%rsi
+  800df8:	bf 30 00 00 00       	mov    $0x30,%edi
+  800dfd:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800e00:	4c 89 ee             	mov    %r13,%rsi
+  800e03:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e08:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800e0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800e11:	77 47                	ja     800e5a <vprintfmt+0x646>
+  800e13:	89 c2                	mov    %eax,%edx
+  800e15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e19:	83 c0 08             	add    $0x8,%eax
+  800e1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e1f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e22:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800e27:	48 83 ec 08          	sub    $0x8,%rsp
+  800e2b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800e2f:	0f 94 c0             	sete   %al
+  800e32:	0f b6 c0             	movzbl %al,%eax
+  800e35:	50                   	push   %rax
+  800e36:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800e3b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800e3f:	4c 89 ee             	mov    %r13,%rsi
+  800e42:	4c 89 f7             	mov    %r14,%rdi
+  800e45:	48 b8 09 07 80 00 00 	movabs $0x800709,%rax
+  800e4c:	00 00 00 
+  800e4f:	ff d0                	call   *%rax
+            break;
+  800e51:	48 83 c4 10          	add    $0x10,%rsp
+  800e55:	e9 eb f9 ff ff       	jmp    800845 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800e5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e66:	eb b7                	jmp    800e1f <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800e68:	40 84 f6             	test   %sil,%sil
+  800e6b:	75 2b                	jne    800e98 <vprintfmt+0x684>
+    switch (lflag) {
+  800e6d:	85 d2                	test   %edx,%edx
+  800e6f:	74 56                	je     800ec7 <vprintfmt+0x6b3>
+  800e71:	83 fa 01             	cmp    $0x1,%edx
+  800e74:	74 7f                	je     800ef5 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800e76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e79:	83 f8 2f             	cmp    $0x2f,%eax
+  800e7c:	0f 87 a2 00 00 00    	ja     800f24 <vprintfmt+0x710>
+  800e82:	89 c2                	mov    %eax,%edx
+  800e84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e88:	83 c0 08             	add    $0x8,%eax
+  800e8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e8e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e91:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e96:	eb 8f                	jmp    800e27 <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800e98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800e9e:	77 19                	ja     800eb9 <vprintfmt+0x6a5>
+  800ea0:	89 c2                	mov    %eax,%edx
+  800ea2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ea6:	83 c0 08             	add    $0x8,%eax
+  800ea9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eac:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800eaf:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800eb4:	e9 6e ff ff ff       	jmp    800e27 <vprintfmt+0x613>
+  800eb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ebd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ec1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ec5:	eb e5                	jmp    800eac <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800ec7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eca:	83 f8 2f             	cmp    $0x2f,%eax
+  800ecd:	77 18                	ja     800ee7 <vprintfmt+0x6d3>
+  800ecf:	89 c2                	mov    %eax,%edx
+  800ed1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed5:	83 c0 08             	add    $0x8,%eax
+  800ed8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800edb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800edd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ee2:	e9 40 ff ff ff       	jmp    800e27 <vprintfmt+0x613>
+  800ee7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eeb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ef3:	eb e6                	jmp    800edb <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800ef5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ef8:	83 f8 2f             	cmp    $0x2f,%eax
+  800efb:	77 19                	ja     800f16 <vprintfmt+0x702>
+  800efd:	89 c2                	mov    %eax,%edx
+  800eff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f03:	83 c0 08             	add    $0x8,%eax
+  800f06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f09:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f0c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800f11:	e9 11 ff ff ff       	jmp    800e27 <vprintfmt+0x613>
+  800f16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f22:	eb e5                	jmp    800f09 <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800f24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f30:	e9 59 ff ff ff       	jmp    800e8e <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800f35:	4c 89 ee             	mov    %r13,%rsi
+  800f38:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f3d:	41 ff d6             	call   *%r14
+            break;
+  800f40:	e9 00 f9 ff ff       	jmp    800845 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800f45:	4c 89 ee             	mov    %r13,%rsi
+  800f48:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f4d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800f50:	48 83 eb 01          	sub    $0x1,%rbx
+  800f54:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800f58:	75 f6                	jne    800f50 <vprintfmt+0x73c>
+  800f5a:	e9 e6 f8 ff ff       	jmp    800845 <vprintfmt+0x31>
+}
+  800f5f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800f63:	5b                   	pop    %rbx
+  800f64:	41 5c                	pop    %r12
+  800f66:	41 5d                	pop    %r13
+  800f68:	41 5e                	pop    %r14
+  800f6a:	41 5f                	pop    %r15
+  800f6c:	5d                   	pop    %rbp
+  800f6d:	c3                   	ret
+
+0000000000800f6e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800f6e:	55                   	push   %rbp
+  800f6f:	48 89 e5             	mov    %rsp,%rbp
+  800f72:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800f76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f7a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800f7f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800f83:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800f8a:	48 85 ff             	test   %rdi,%rdi
+  800f8d:	74 2b                	je     800fba <vsnprintf+0x4c>
+  800f8f:	48 85 f6             	test   %rsi,%rsi
+  800f92:	74 26                	je     800fba <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800f94:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f98:	48 bf bf 07 80 00 00 	movabs $0x8007bf,%rdi
+  800f9f:	00 00 00 
+  800fa2:	48 b8 14 08 80 00 00 	movabs $0x800814,%rax
+  800fa9:	00 00 00 
+  800fac:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800fae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fb2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800fb5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800fb8:	c9                   	leave
+  800fb9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800fba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fbf:	eb f7                	jmp    800fb8 <vsnprintf+0x4a>
+
+0000000000800fc1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800fc1:	55                   	push   %rbp
+  800fc2:	48 89 e5             	mov    %rsp,%rbp
+  800fc5:	48 83 ec 50          	sub    $0x50,%rsp
+  800fc9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800fcd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800fd1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800fd5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800fdc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fe0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fe4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800fe8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800fec:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ff0:	48 b8 6e 0f 80 00 00 	movabs $0x800f6e,%rax
+  800ff7:	00 00 00 
+  800ffa:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ffc:	c9                   	leave
+  800ffd:	c3                   	ret
+
+0000000000800ffe <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ffe:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801001:	74 10                	je     801013 <strlen+0x15>
+    size_t n = 0;
+  801003:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801008:	48 83 c0 01          	add    $0x1,%rax
+  80100c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801010:	75 f6                	jne    801008 <strlen+0xa>
+  801012:	c3                   	ret
+    size_t n = 0;
+  801013:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801018:	c3                   	ret
+
+0000000000801019 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801019:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80101c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801021:	48 85 f6             	test   %rsi,%rsi
+  801024:	74 11                	je     801037 <strnlen+0x1e>
+  801026:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80102a:	74 0c                	je     801038 <strnlen+0x1f>
+  80102c:	48 83 c2 01          	add    $0x1,%rdx
+  801030:	48 39 d0             	cmp    %rdx,%rax
+  801033:	75 f1                	jne    801026 <strnlen+0xd>
+  801035:	eb 04                	jmp    80103b <strnlen+0x22>
+  801037:	c3                   	ret
+  801038:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80103b:	c3                   	ret
+
+000000000080103c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80103c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80103f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801044:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801048:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80104b:	48 83 c2 01          	add    $0x1,%rdx
+  80104f:	84 c9                	test   %cl,%cl
+  801051:	75 f1                	jne    801044 <strcpy+0x8>
+        ;
+    return res;
+}
+  801053:	c3                   	ret
+
+0000000000801054 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801054:	55                   	push   %rbp
+  801055:	48 89 e5             	mov    %rsp,%rbp
+  801058:	41 54                	push   %r12
+  80105a:	53                   	push   %rbx
+  80105b:	48 89 fb             	mov    %rdi,%rbx
+  80105e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801061:	48 b8 fe 0f 80 00 00 	movabs $0x800ffe,%rax
+  801068:	00 00 00 
+  80106b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80106d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801071:	4c 89 e6             	mov    %r12,%rsi
+  801074:	48 b8 3c 10 80 00 00 	movabs $0x80103c,%rax
+  80107b:	00 00 00 
+  80107e:	ff d0                	call   *%rax
+    return dst;
+}
+  801080:	48 89 d8             	mov    %rbx,%rax
+  801083:	5b                   	pop    %rbx
+  801084:	41 5c                	pop    %r12
+  801086:	5d                   	pop    %rbp
+  801087:	c3                   	ret
+
+0000000000801088 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801088:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80108b:	48 85 d2             	test   %rdx,%rdx
+  80108e:	74 1f                	je     8010af <strncpy+0x27>
+  801090:	48 01 fa             	add    %rdi,%rdx
+  801093:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801096:	48 83 c1 01          	add    $0x1,%rcx
+  80109a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80109e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8010a2:	41 80 f8 01          	cmp    $0x1,%r8b
+  8010a6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8010aa:	48 39 ca             	cmp    %rcx,%rdx
+  8010ad:	75 e7                	jne    801096 <strncpy+0xe>
+    }
+    return ret;
+}
+  8010af:	c3                   	ret
+
+00000000008010b0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8010b0:	48 89 f8             	mov    %rdi,%rax
+  8010b3:	48 85 d2             	test   %rdx,%rdx
+  8010b6:	74 24                	je     8010dc <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8010b8:	48 83 ea 01          	sub    $0x1,%rdx
+  8010bc:	74 1b                	je     8010d9 <strlcpy+0x29>
+  8010be:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8010c2:	0f b6 16             	movzbl (%rsi),%edx
+  8010c5:	84 d2                	test   %dl,%dl
+  8010c7:	74 10                	je     8010d9 <strlcpy+0x29>
+            *dst++ = *src++;
+  8010c9:	48 83 c6 01          	add    $0x1,%rsi
+  8010cd:	48 83 c0 01          	add    $0x1,%rax
+  8010d1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8010d4:	48 39 c8             	cmp    %rcx,%rax
+  8010d7:	75 e9                	jne    8010c2 <strlcpy+0x12>
+        *dst = '\0';
+  8010d9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8010dc:	48 29 f8             	sub    %rdi,%rax
+}
+  8010df:	c3                   	ret
+
+00000000008010e0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8010e0:	0f b6 07             	movzbl (%rdi),%eax
+  8010e3:	84 c0                	test   %al,%al
+  8010e5:	74 13                	je     8010fa <strcmp+0x1a>
+  8010e7:	38 06                	cmp    %al,(%rsi)
+  8010e9:	75 0f                	jne    8010fa <strcmp+0x1a>
+  8010eb:	48 83 c7 01          	add    $0x1,%rdi
+  8010ef:	48 83 c6 01          	add    $0x1,%rsi
+  8010f3:	0f b6 07             	movzbl (%rdi),%eax
+  8010f6:	84 c0                	test   %al,%al
+  8010f8:	75 ed                	jne    8010e7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010fa:	0f b6 c0             	movzbl %al,%eax
+  8010fd:	0f b6 16             	movzbl (%rsi),%edx
+  801100:	29 d0                	sub    %edx,%eax
+}
+  801102:	c3                   	ret
+
+0000000000801103 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801103:	48 85 d2             	test   %rdx,%rdx
+  801106:	74 1f                	je     801127 <strncmp+0x24>
+  801108:	0f b6 07             	movzbl (%rdi),%eax
+  80110b:	84 c0                	test   %al,%al
+  80110d:	74 1e                	je     80112d <strncmp+0x2a>
+  80110f:	3a 06                	cmp    (%rsi),%al
+  801111:	75 1a                	jne    80112d <strncmp+0x2a>
+  801113:	48 83 c7 01          	add    $0x1,%rdi
+  801117:	48 83 c6 01          	add    $0x1,%rsi
+  80111b:	48 83 ea 01          	sub    $0x1,%rdx
+  80111f:	75 e7                	jne    801108 <strncmp+0x5>
+
+    if (!n) return 0;
+  801121:	b8 00 00 00 00       	mov    $0x0,%eax
+  801126:	c3                   	ret
+  801127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112c:	c3                   	ret
+  80112d:	48 85 d2             	test   %rdx,%rdx
+  801130:	74 09                	je     80113b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801132:	0f b6 07             	movzbl (%rdi),%eax
+  801135:	0f b6 16             	movzbl (%rsi),%edx
+  801138:	29 d0                	sub    %edx,%eax
+  80113a:	c3                   	ret
+    if (!n) return 0;
+  80113b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801140:	c3                   	ret
+
+0000000000801141 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801141:	0f b6 17             	movzbl (%rdi),%edx
+  801144:	84 d2                	test   %dl,%dl
+  801146:	74 18                	je     801160 <strchr+0x1f>
+        if (*str == c) {
+  801148:	0f be d2             	movsbl %dl,%edx
+  80114b:	39 f2                	cmp    %esi,%edx
+  80114d:	74 17                	je     801166 <strchr+0x25>
+    for (; *str; str++) {
+  80114f:	48 83 c7 01          	add    $0x1,%rdi
+  801153:	0f b6 17             	movzbl (%rdi),%edx
+  801156:	84 d2                	test   %dl,%dl
+  801158:	75 ee                	jne    801148 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80115a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115f:	c3                   	ret
+  801160:	b8 00 00 00 00       	mov    $0x0,%eax
+  801165:	c3                   	ret
+  801166:	48 89 f8             	mov    %rdi,%rax
+}
+  801169:	c3                   	ret
+
+000000000080116a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80116a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80116d:	0f b6 17             	movzbl (%rdi),%edx
+  801170:	84 d2                	test   %dl,%dl
+  801172:	74 13                	je     801187 <strfind+0x1d>
+  801174:	0f be d2             	movsbl %dl,%edx
+  801177:	39 f2                	cmp    %esi,%edx
+  801179:	74 0b                	je     801186 <strfind+0x1c>
+  80117b:	48 83 c0 01          	add    $0x1,%rax
+  80117f:	0f b6 10             	movzbl (%rax),%edx
+  801182:	84 d2                	test   %dl,%dl
+  801184:	75 ee                	jne    801174 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801186:	c3                   	ret
+  801187:	c3                   	ret
+
+0000000000801188 <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  801188:	55                   	push   %rbp
+  801189:	48 89 e5             	mov    %rsp,%rbp
+  80118c:	41 57                	push   %r15
+  80118e:	41 56                	push   %r14
+  801190:	41 55                	push   %r13
+  801192:	41 54                	push   %r12
+  801194:	53                   	push   %rbx
+  801195:	48 83 ec 08          	sub    $0x8,%rsp
+  801199:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  80119c:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  8011a0:	45 84 ed             	test   %r13b,%r13b
+  8011a3:	75 12                	jne    8011b7 <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  8011a5:	4c 89 f8             	mov    %r15,%rax
+  8011a8:	48 83 c4 08          	add    $0x8,%rsp
+  8011ac:	5b                   	pop    %rbx
+  8011ad:	41 5c                	pop    %r12
+  8011af:	41 5d                	pop    %r13
+  8011b1:	41 5e                	pop    %r14
+  8011b3:	41 5f                	pop    %r15
+  8011b5:	5d                   	pop    %rbp
+  8011b6:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  8011b7:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  8011bb:	4c 89 e7             	mov    %r12,%rdi
+  8011be:	48 b8 fe 0f 80 00 00 	movabs $0x800ffe,%rax
+  8011c5:	00 00 00 
+  8011c8:	ff d0                	call   *%rax
+  8011ca:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  8011cd:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  8011d1:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  8011d5:	49 bf 03 11 80 00 00 	movabs $0x801103,%r15
+  8011dc:	00 00 00 
+				if ((sc = *s++) == 0)
+  8011df:	84 c0                	test   %al,%al
+  8011e1:	75 14                	jne    8011f7 <strstr+0x6f>
+					return NULL;
+  8011e3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8011e9:	eb ba                	jmp    8011a5 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  8011eb:	48 83 c3 01          	add    $0x1,%rbx
+  8011ef:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8011f3:	84 c0                	test   %al,%al
+  8011f5:	74 1b                	je     801212 <strstr+0x8a>
+			} while (sc != c);
+  8011f7:	41 38 c5             	cmp    %al,%r13b
+  8011fa:	75 ef                	jne    8011eb <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  8011fc:	4c 89 f2             	mov    %r14,%rdx
+  8011ff:	4c 89 e6             	mov    %r12,%rsi
+  801202:	48 89 df             	mov    %rbx,%rdi
+  801205:	41 ff d7             	call   *%r15
+  801208:	85 c0                	test   %eax,%eax
+  80120a:	75 df                	jne    8011eb <strstr+0x63>
+  80120c:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  801210:	eb 93                	jmp    8011a5 <strstr+0x1d>
+					return NULL;
+  801212:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  801218:	eb 8b                	jmp    8011a5 <strstr+0x1d>
+
+000000000080121a <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  80121a:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  80121c:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  80121f:	8d 57 20             	lea    0x20(%rdi),%edx
+  801222:	83 f9 1a             	cmp    $0x1a,%ecx
+  801225:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801228:	c3                   	ret
+
+0000000000801229 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  801229:	55                   	push   %rbp
+  80122a:	48 89 e5             	mov    %rsp,%rbp
+  80122d:	41 57                	push   %r15
+  80122f:	41 56                	push   %r14
+  801231:	41 55                	push   %r13
+  801233:	41 54                	push   %r12
+  801235:	53                   	push   %rbx
+  801236:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  80123a:	48 39 f7             	cmp    %rsi,%rdi
+  80123d:	74 49                	je     801288 <strcasecmp+0x5f>
+  80123f:	49 89 fd             	mov    %rdi,%r13
+  801242:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  801245:	49 bf 1a 12 80 00 00 	movabs $0x80121a,%r15
+  80124c:	00 00 00 
+  80124f:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  801254:	41 0f b6 fe          	movzbl %r14b,%edi
+  801258:	41 ff d7             	call   *%r15
+  80125b:	89 c3                	mov    %eax,%ebx
+  80125d:	49 83 c4 01          	add    $0x1,%r12
+  801261:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801267:	41 ff d7             	call   *%r15
+  80126a:	29 c3                	sub    %eax,%ebx
+  80126c:	75 09                	jne    801277 <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  80126e:	49 83 c5 01          	add    $0x1,%r13
+  801272:	45 84 f6             	test   %r14b,%r14b
+  801275:	75 d8                	jne    80124f <strcasecmp+0x26>
+}
+  801277:	89 d8                	mov    %ebx,%eax
+  801279:	48 83 c4 08          	add    $0x8,%rsp
+  80127d:	5b                   	pop    %rbx
+  80127e:	41 5c                	pop    %r12
+  801280:	41 5d                	pop    %r13
+  801282:	41 5e                	pop    %r14
+  801284:	41 5f                	pop    %r15
+  801286:	5d                   	pop    %rbp
+  801287:	c3                   	ret
+        return 0;
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128d:	eb e8                	jmp    801277 <strcasecmp+0x4e>
+
+000000000080128f <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80128f:	55                   	push   %rbp
+  801290:	48 89 e5             	mov    %rsp,%rbp
+  801293:	41 57                	push   %r15
+  801295:	41 56                	push   %r14
+  801297:	41 55                	push   %r13
+  801299:	41 54                	push   %r12
+  80129b:	53                   	push   %rbx
+  80129c:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  8012a0:	48 85 d2             	test   %rdx,%rdx
+  8012a3:	74 4f                	je     8012f4 <strncasecmp+0x65>
+  8012a5:	49 89 fc             	mov    %rdi,%r12
+  8012a8:	49 89 f5             	mov    %rsi,%r13
+  8012ab:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  8012af:	49 be 1a 12 80 00 00 	movabs $0x80121a,%r14
+  8012b6:	00 00 00 
+  8012b9:	49 83 c4 01          	add    $0x1,%r12
+  8012bd:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  8012c3:	41 ff d6             	call   *%r14
+  8012c6:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  8012c8:	49 83 c5 01          	add    $0x1,%r13
+  8012cc:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  8012d1:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  8012d4:	29 c3                	sub    %eax,%ebx
+  8012d6:	85 c0                	test   %eax,%eax
+  8012d8:	74 09                	je     8012e3 <strncasecmp+0x54>
+  8012da:	85 db                	test   %ebx,%ebx
+  8012dc:	75 05                	jne    8012e3 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  8012de:	4d 39 fc             	cmp    %r15,%r12
+  8012e1:	75 d6                	jne    8012b9 <strncasecmp+0x2a>
+}
+  8012e3:	89 d8                	mov    %ebx,%eax
+  8012e5:	48 83 c4 08          	add    $0x8,%rsp
+  8012e9:	5b                   	pop    %rbx
+  8012ea:	41 5c                	pop    %r12
+  8012ec:	41 5d                	pop    %r13
+  8012ee:	41 5e                	pop    %r14
+  8012f0:	41 5f                	pop    %r15
+  8012f2:	5d                   	pop    %rbp
+  8012f3:	c3                   	ret
+    int d = 0;
+  8012f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  8012f9:	eb e8                	jmp    8012e3 <strncasecmp+0x54>
+
+00000000008012fb <toupper>:
+
+int toupper(int c) {
+  8012fb:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  8012fd:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  801300:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  801303:	83 f9 1a             	cmp    $0x1a,%ecx
+  801306:	0f 42 c2             	cmovb  %edx,%eax
+}
+  801309:	c3                   	ret
+
+000000000080130a <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  80130a:	83 ff 20             	cmp    $0x20,%edi
+  80130d:	0f 94 c0             	sete   %al
+  801310:	0f b6 c0             	movzbl %al,%eax
+}
+  801313:	c3                   	ret
+
+0000000000801314 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  801314:	89 f8                	mov    %edi,%eax
+  801316:	f7 d8                	neg    %eax
+  801318:	0f 48 c7             	cmovs  %edi,%eax
+}
+  80131b:	c3                   	ret
+
+000000000080131c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80131c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80131f:	48 89 f8             	mov    %rdi,%rax
+  801322:	48 f7 d8             	neg    %rax
+  801325:	83 e0 07             	and    $0x7,%eax
+  801328:	49 89 d1             	mov    %rdx,%r9
+  80132b:	49 29 c1             	sub    %rax,%r9
+  80132e:	78 36                	js     801366 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801330:	40 0f b6 c6          	movzbl %sil,%eax
+  801334:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80133b:	01 01 01 
+  80133e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801342:	40 f6 c7 07          	test   $0x7,%dil
+  801346:	75 38                	jne    801380 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801348:	4c 89 c9             	mov    %r9,%rcx
+  80134b:	48 c1 f9 03          	sar    $0x3,%rcx
+  80134f:	74 0c                	je     80135d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801351:	fc                   	cld
+  801352:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801355:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801359:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80135d:	4d 85 c9             	test   %r9,%r9
+  801360:	75 45                	jne    8013a7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801362:	4c 89 c0             	mov    %r8,%rax
+  801365:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801366:	48 85 d2             	test   %rdx,%rdx
+  801369:	74 f7                	je     801362 <memset+0x46>
+  80136b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80136e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801371:	48 83 c0 01          	add    $0x1,%rax
+  801375:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801379:	48 39 c2             	cmp    %rax,%rdx
+  80137c:	75 f3                	jne    801371 <memset+0x55>
+  80137e:	eb e2                	jmp    801362 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801380:	40 f6 c7 01          	test   $0x1,%dil
+  801384:	74 06                	je     80138c <memset+0x70>
+  801386:	88 07                	mov    %al,(%rdi)
+  801388:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80138c:	40 f6 c7 02          	test   $0x2,%dil
+  801390:	74 07                	je     801399 <memset+0x7d>
+  801392:	66 89 07             	mov    %ax,(%rdi)
+  801395:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801399:	40 f6 c7 04          	test   $0x4,%dil
+  80139d:	74 a9                	je     801348 <memset+0x2c>
+  80139f:	89 07                	mov    %eax,(%rdi)
+  8013a1:	48 83 c7 04          	add    $0x4,%rdi
+  8013a5:	eb a1                	jmp    801348 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8013a7:	41 f6 c1 04          	test   $0x4,%r9b
+  8013ab:	74 06                	je     8013b3 <memset+0x97>
+  8013ad:	89 07                	mov    %eax,(%rdi)
+  8013af:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8013b3:	41 f6 c1 02          	test   $0x2,%r9b
+  8013b7:	74 07                	je     8013c0 <memset+0xa4>
+  8013b9:	66 89 07             	mov    %ax,(%rdi)
+  8013bc:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8013c0:	41 f6 c1 01          	test   $0x1,%r9b
+  8013c4:	74 9c                	je     801362 <memset+0x46>
+  8013c6:	88 07                	mov    %al,(%rdi)
+  8013c8:	eb 98                	jmp    801362 <memset+0x46>
+
+00000000008013ca <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8013ca:	48 89 f8             	mov    %rdi,%rax
+  8013cd:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8013d0:	48 39 fe             	cmp    %rdi,%rsi
+  8013d3:	73 3b                	jae    801410 <memmove+0x46>
+  8013d5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8013d9:	48 39 d7             	cmp    %rdx,%rdi
+  8013dc:	73 32                	jae    801410 <memmove+0x46>
+        s += n;
+        d += n;
+  8013de:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8013e2:	48 89 d6             	mov    %rdx,%rsi
+  8013e5:	48 09 fe             	or     %rdi,%rsi
+  8013e8:	48 09 ce             	or     %rcx,%rsi
+  8013eb:	40 f6 c6 07          	test   $0x7,%sil
+  8013ef:	75 12                	jne    801403 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8013f1:	48 83 ef 08          	sub    $0x8,%rdi
+  8013f5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8013f9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8013fd:	fd                   	std
+  8013fe:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801401:	fc                   	cld
+  801402:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801403:	48 83 ef 01          	sub    $0x1,%rdi
+  801407:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80140b:	fd                   	std
+  80140c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80140e:	eb f1                	jmp    801401 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801410:	48 89 f2             	mov    %rsi,%rdx
+  801413:	48 09 c2             	or     %rax,%rdx
+  801416:	48 09 ca             	or     %rcx,%rdx
+  801419:	f6 c2 07             	test   $0x7,%dl
+  80141c:	75 0c                	jne    80142a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80141e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801422:	48 89 c7             	mov    %rax,%rdi
+  801425:	fc                   	cld
+  801426:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801429:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80142a:	48 89 c7             	mov    %rax,%rdi
+  80142d:	fc                   	cld
+  80142e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801430:	c3                   	ret
+
+0000000000801431 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801431:	55                   	push   %rbp
+  801432:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801435:	48 b8 ca 13 80 00 00 	movabs $0x8013ca,%rax
+  80143c:	00 00 00 
+  80143f:	ff d0                	call   *%rax
+}
+  801441:	5d                   	pop    %rbp
+  801442:	c3                   	ret
+
+0000000000801443 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801443:	55                   	push   %rbp
+  801444:	48 89 e5             	mov    %rsp,%rbp
+  801447:	41 57                	push   %r15
+  801449:	41 56                	push   %r14
+  80144b:	41 55                	push   %r13
+  80144d:	41 54                	push   %r12
+  80144f:	53                   	push   %rbx
+  801450:	48 83 ec 08          	sub    $0x8,%rsp
+  801454:	49 89 fe             	mov    %rdi,%r14
+  801457:	49 89 f7             	mov    %rsi,%r15
+  80145a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80145d:	48 89 f7             	mov    %rsi,%rdi
+  801460:	48 b8 fe 0f 80 00 00 	movabs $0x800ffe,%rax
+  801467:	00 00 00 
+  80146a:	ff d0                	call   *%rax
+  80146c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80146f:	48 89 de             	mov    %rbx,%rsi
+  801472:	4c 89 f7             	mov    %r14,%rdi
+  801475:	48 b8 19 10 80 00 00 	movabs $0x801019,%rax
+  80147c:	00 00 00 
+  80147f:	ff d0                	call   *%rax
+  801481:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801484:	48 39 c3             	cmp    %rax,%rbx
+  801487:	74 36                	je     8014bf <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801489:	48 89 d8             	mov    %rbx,%rax
+  80148c:	4c 29 e8             	sub    %r13,%rax
+  80148f:	49 39 c4             	cmp    %rax,%r12
+  801492:	73 31                	jae    8014c5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801494:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801499:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80149d:	4c 89 fe             	mov    %r15,%rsi
+  8014a0:	48 b8 31 14 80 00 00 	movabs $0x801431,%rax
+  8014a7:	00 00 00 
+  8014aa:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8014ac:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8014b0:	48 83 c4 08          	add    $0x8,%rsp
+  8014b4:	5b                   	pop    %rbx
+  8014b5:	41 5c                	pop    %r12
+  8014b7:	41 5d                	pop    %r13
+  8014b9:	41 5e                	pop    %r14
+  8014bb:	41 5f                	pop    %r15
+  8014bd:	5d                   	pop    %rbp
+  8014be:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8014bf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8014c3:	eb eb                	jmp    8014b0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8014c5:	48 83 eb 01          	sub    $0x1,%rbx
+  8014c9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8014cd:	48 89 da             	mov    %rbx,%rdx
+  8014d0:	4c 89 fe             	mov    %r15,%rsi
+  8014d3:	48 b8 31 14 80 00 00 	movabs $0x801431,%rax
+  8014da:	00 00 00 
+  8014dd:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8014df:	49 01 de             	add    %rbx,%r14
+  8014e2:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8014e7:	eb c3                	jmp    8014ac <strlcat+0x69>
+
+00000000008014e9 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8014e9:	48 85 d2             	test   %rdx,%rdx
+  8014ec:	74 2d                	je     80151b <memcmp+0x32>
+  8014ee:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8014f3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8014f7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8014fc:	44 38 c1             	cmp    %r8b,%cl
+  8014ff:	75 0f                	jne    801510 <memcmp+0x27>
+    while (n-- > 0) {
+  801501:	48 83 c0 01          	add    $0x1,%rax
+  801505:	48 39 c2             	cmp    %rax,%rdx
+  801508:	75 e9                	jne    8014f3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80150a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801510:	0f b6 c1             	movzbl %cl,%eax
+  801513:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801517:	44 29 c0             	sub    %r8d,%eax
+  80151a:	c3                   	ret
+    return 0;
+  80151b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801520:	c3                   	ret
+
+0000000000801521 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801521:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801525:	48 39 c7             	cmp    %rax,%rdi
+  801528:	73 0f                	jae    801539 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80152a:	40 38 37             	cmp    %sil,(%rdi)
+  80152d:	74 0e                	je     80153d <memfind+0x1c>
+    for (; src < end; src++) {
+  80152f:	48 83 c7 01          	add    $0x1,%rdi
+  801533:	48 39 f8             	cmp    %rdi,%rax
+  801536:	75 f2                	jne    80152a <memfind+0x9>
+  801538:	c3                   	ret
+  801539:	48 89 f8             	mov    %rdi,%rax
+  80153c:	c3                   	ret
+  80153d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801540:	c3                   	ret
+
+0000000000801541 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801541:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801544:	0f b6 37             	movzbl (%rdi),%esi
+  801547:	40 80 fe 20          	cmp    $0x20,%sil
+  80154b:	74 06                	je     801553 <strtol+0x12>
+  80154d:	40 80 fe 09          	cmp    $0x9,%sil
+  801551:	75 13                	jne    801566 <strtol+0x25>
+  801553:	48 83 c7 01          	add    $0x1,%rdi
+  801557:	0f b6 37             	movzbl (%rdi),%esi
+  80155a:	40 80 fe 20          	cmp    $0x20,%sil
+  80155e:	74 f3                	je     801553 <strtol+0x12>
+  801560:	40 80 fe 09          	cmp    $0x9,%sil
+  801564:	74 ed                	je     801553 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801566:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801569:	83 e0 fd             	and    $0xfffffffd,%eax
+  80156c:	3c 01                	cmp    $0x1,%al
+  80156e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801572:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801578:	75 0f                	jne    801589 <strtol+0x48>
+  80157a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80157d:	74 14                	je     801593 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80157f:	85 d2                	test   %edx,%edx
+  801581:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801586:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801589:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80158e:	4c 63 ca             	movslq %edx,%r9
+  801591:	eb 36                	jmp    8015c9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801593:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801597:	74 0f                	je     8015a8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801599:	85 d2                	test   %edx,%edx
+  80159b:	75 ec                	jne    801589 <strtol+0x48>
+        s++;
+  80159d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8015a1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8015a6:	eb e1                	jmp    801589 <strtol+0x48>
+        s += 2;
+  8015a8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8015ac:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8015b1:	eb d6                	jmp    801589 <strtol+0x48>
+            dig -= '0';
+  8015b3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8015b6:	44 0f b6 c1          	movzbl %cl,%r8d
+  8015ba:	41 39 d0             	cmp    %edx,%r8d
+  8015bd:	7d 21                	jge    8015e0 <strtol+0x9f>
+        val = val * base + dig;
+  8015bf:	49 0f af c1          	imul   %r9,%rax
+  8015c3:	0f b6 c9             	movzbl %cl,%ecx
+  8015c6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8015c9:	48 83 c7 01          	add    $0x1,%rdi
+  8015cd:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8015d1:	80 f9 39             	cmp    $0x39,%cl
+  8015d4:	76 dd                	jbe    8015b3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8015d6:	80 f9 7b             	cmp    $0x7b,%cl
+  8015d9:	77 05                	ja     8015e0 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8015db:	83 e9 57             	sub    $0x57,%ecx
+  8015de:	eb d6                	jmp    8015b6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8015e0:	4d 85 d2             	test   %r10,%r10
+  8015e3:	74 03                	je     8015e8 <strtol+0xa7>
+  8015e5:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8015e8:	48 89 c2             	mov    %rax,%rdx
+  8015eb:	48 f7 da             	neg    %rdx
+  8015ee:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8015f2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8015f6:	c3                   	ret
+
+00000000008015f7 <atoi>:
+int atoi(const char *str) {
+  8015f7:	55                   	push   %rbp
+  8015f8:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  8015fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801600:	be 00 00 00 00       	mov    $0x0,%esi
+  801605:	48 b8 41 15 80 00 00 	movabs $0x801541,%rax
+  80160c:	00 00 00 
+  80160f:	ff d0                	call   *%rax
+}
+  801611:	5d                   	pop    %rbp
+  801612:	c3                   	ret
+
+0000000000801613 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801613:	55                   	push   %rbp
+  801614:	48 89 e5             	mov    %rsp,%rbp
+  801617:	53                   	push   %rbx
+  801618:	48 89 fa             	mov    %rdi,%rdx
+  80161b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80161e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801623:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801628:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162d:	be 00 00 00 00       	mov    $0x0,%esi
+  801632:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801638:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80163a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80163e:	c9                   	leave
+  80163f:	c3                   	ret
+
+0000000000801640 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801640:	55                   	push   %rbp
+  801641:	48 89 e5             	mov    %rsp,%rbp
+  801644:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801645:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80164f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801654:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801659:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165e:	be 00 00 00 00       	mov    $0x0,%esi
+  801663:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801669:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80166b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166f:	c9                   	leave
+  801670:	c3                   	ret
+
+0000000000801671 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801671:	55                   	push   %rbp
+  801672:	48 89 e5             	mov    %rsp,%rbp
+  801675:	53                   	push   %rbx
+  801676:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80167a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80167d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801682:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801687:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801691:	be 00 00 00 00       	mov    $0x0,%esi
+  801696:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80169e:	48 85 c0             	test   %rax,%rax
+  8016a1:	7f 06                	jg     8016a9 <sys_env_destroy+0x38>
+}
+  8016a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a7:	c9                   	leave
+  8016a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a9:	49 89 c0             	mov    %rax,%r8
+  8016ac:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8016b1:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  8016b8:	00 00 00 
+  8016bb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016c0:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  8016c7:	00 00 00 
+  8016ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cf:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  8016d6:	00 00 00 
+  8016d9:	41 ff d1             	call   *%r9
+
+00000000008016dc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8016dc:	55                   	push   %rbp
+  8016dd:	48 89 e5             	mov    %rsp,%rbp
+  8016e0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801705:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801707:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170b:	c9                   	leave
+  80170c:	c3                   	ret
+
+000000000080170d <sys_yield>:
+
+void
+sys_yield(void) {
+  80170d:	55                   	push   %rbp
+  80170e:	48 89 e5             	mov    %rsp,%rbp
+  801711:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801712:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801717:	ba 00 00 00 00       	mov    $0x0,%edx
+  80171c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801721:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801726:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172b:	be 00 00 00 00       	mov    $0x0,%esi
+  801730:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801736:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801738:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80173c:	c9                   	leave
+  80173d:	c3                   	ret
+
+000000000080173e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80173e:	55                   	push   %rbp
+  80173f:	48 89 e5             	mov    %rsp,%rbp
+  801742:	53                   	push   %rbx
+  801743:	48 89 fa             	mov    %rdi,%rdx
+  801746:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801749:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801755:	00 00 00 
+  801758:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80175d:	be 00 00 00 00       	mov    $0x0,%esi
+  801762:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801768:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80176a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176e:	c9                   	leave
+  80176f:	c3                   	ret
+
+0000000000801770 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801770:	55                   	push   %rbp
+  801771:	48 89 e5             	mov    %rsp,%rbp
+  801774:	53                   	push   %rbx
+  801775:	49 89 f8             	mov    %rdi,%r8
+  801778:	48 89 d3             	mov    %rdx,%rbx
+  80177b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80177e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801783:	4c 89 c2             	mov    %r8,%rdx
+  801786:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801789:	be 00 00 00 00       	mov    $0x0,%esi
+  80178e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801794:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801796:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+
+000000000080179c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80179c:	55                   	push   %rbp
+  80179d:	48 89 e5             	mov    %rsp,%rbp
+  8017a0:	53                   	push   %rbx
+  8017a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a5:	89 f8                	mov    %edi,%eax
+  8017a7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8017aa:	48 63 f9             	movslq %ecx,%rdi
+  8017ad:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b0:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017b5:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c5:	48 85 c0             	test   %rax,%rax
+  8017c8:	7f 06                	jg     8017d0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8017ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ce:	c9                   	leave
+  8017cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d0:	49 89 c0             	mov    %rax,%r8
+  8017d3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8017d8:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  8017df:	00 00 00 
+  8017e2:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017e7:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  8017ee:	00 00 00 
+  8017f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f6:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  8017fd:	00 00 00 
+  801800:	41 ff d1             	call   *%r9
+
+0000000000801803 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801803:	55                   	push   %rbp
+  801804:	48 89 e5             	mov    %rsp,%rbp
+  801807:	53                   	push   %rbx
+  801808:	48 83 ec 08          	sub    $0x8,%rsp
+  80180c:	89 f8                	mov    %edi,%eax
+  80180e:	49 89 f2             	mov    %rsi,%r10
+  801811:	48 89 cf             	mov    %rcx,%rdi
+  801814:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801817:	48 63 da             	movslq %edx,%rbx
+  80181a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80181d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801822:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801825:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801828:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80182a:	48 85 c0             	test   %rax,%rax
+  80182d:	7f 06                	jg     801835 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80182f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801833:	c9                   	leave
+  801834:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801835:	49 89 c0             	mov    %rax,%r8
+  801838:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80183d:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801844:	00 00 00 
+  801847:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80184c:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801853:	00 00 00 
+  801856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185b:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  801862:	00 00 00 
+  801865:	41 ff d1             	call   *%r9
+
+0000000000801868 <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801868:	55                   	push   %rbp
+  801869:	48 89 e5             	mov    %rsp,%rbp
+  80186c:	53                   	push   %rbx
+  80186d:	48 83 ec 08          	sub    $0x8,%rsp
+  801871:	49 89 f9             	mov    %rdi,%r9
+  801874:	89 f0                	mov    %esi,%eax
+  801876:	48 89 d3             	mov    %rdx,%rbx
+  801879:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80187c:	49 63 f0             	movslq %r8d,%rsi
+  80187f:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801882:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801887:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80188a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801890:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801892:	48 85 c0             	test   %rax,%rax
+  801895:	7f 06                	jg     80189d <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801897:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80189b:	c9                   	leave
+  80189c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80189d:	49 89 c0             	mov    %rax,%r8
+  8018a0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018a5:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  8018ac:	00 00 00 
+  8018af:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018b4:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  8018bb:	00 00 00 
+  8018be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c3:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  8018ca:	00 00 00 
+  8018cd:	41 ff d1             	call   *%r9
+
+00000000008018d0 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  8018d0:	55                   	push   %rbp
+  8018d1:	48 89 e5             	mov    %rsp,%rbp
+  8018d4:	53                   	push   %rbx
+  8018d5:	89 f8                	mov    %edi,%eax
+  8018d7:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  8018da:	48 63 f9             	movslq %ecx,%rdi
+  8018dd:	48 63 da             	movslq %edx,%rbx
+  8018e0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018e3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8018e8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018f6:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  8018f8:	89 c2                	mov    %eax,%edx
+  8018fa:	48 85 c0             	test   %rax,%rax
+  8018fd:	78 0d                	js     80190c <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8018ff:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  801904:	4d 85 c9             	test   %r9,%r9
+  801907:	74 03                	je     80190c <sys_alloc_dma_region+0x3c>
+  801909:	49 89 01             	mov    %rax,(%r9)
+}
+  80190c:	89 d0                	mov    %edx,%eax
+  80190e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801912:	c9                   	leave
+  801913:	c3                   	ret
+
+0000000000801914 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  801914:	55                   	push   %rbp
+  801915:	48 89 e5             	mov    %rsp,%rbp
+  801918:	53                   	push   %rbx
+  801919:	48 83 ec 08          	sub    $0x8,%rsp
+  80191d:	48 89 f1             	mov    %rsi,%rcx
+  801920:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801923:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801926:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80192b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801930:	be 00 00 00 00       	mov    $0x0,%esi
+  801935:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80193b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80193d:	48 85 c0             	test   %rax,%rax
+  801940:	7f 06                	jg     801948 <sys_set_cache_region+0x34>
+}
+  801942:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801946:	c9                   	leave
+  801947:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801948:	49 89 c0             	mov    %rax,%r8
+  80194b:	b9 08 00 00 00       	mov    $0x8,%ecx
+  801950:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801957:	00 00 00 
+  80195a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80195f:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801966:	00 00 00 
+  801969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196e:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  801975:	00 00 00 
+  801978:	41 ff d1             	call   *%r9
+
+000000000080197b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80197b:	55                   	push   %rbp
+  80197c:	48 89 e5             	mov    %rsp,%rbp
+  80197f:	53                   	push   %rbx
+  801980:	48 83 ec 08          	sub    $0x8,%rsp
+  801984:	48 89 f1             	mov    %rsi,%rcx
+  801987:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80198a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80198d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801992:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801997:	be 00 00 00 00       	mov    $0x0,%esi
+  80199c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019a4:	48 85 c0             	test   %rax,%rax
+  8019a7:	7f 06                	jg     8019af <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8019a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019ad:	c9                   	leave
+  8019ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019af:	49 89 c0             	mov    %rax,%r8
+  8019b2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8019b7:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  8019be:	00 00 00 
+  8019c1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019c6:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  8019cd:	00 00 00 
+  8019d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d5:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  8019dc:	00 00 00 
+  8019df:	41 ff d1             	call   *%r9
+
+00000000008019e2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8019e2:	55                   	push   %rbp
+  8019e3:	48 89 e5             	mov    %rsp,%rbp
+  8019e6:	53                   	push   %rbx
+  8019e7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8019eb:	48 63 ce             	movslq %esi,%rcx
+  8019ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a00:	be 00 00 00 00       	mov    $0x0,%esi
+  801a05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a0b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a0d:	48 85 c0             	test   %rax,%rax
+  801a10:	7f 06                	jg     801a18 <sys_env_set_status+0x36>
+}
+  801a12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a16:	c9                   	leave
+  801a17:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a18:	49 89 c0             	mov    %rax,%r8
+  801a1b:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  801a20:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801a27:	00 00 00 
+  801a2a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a2f:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801a36:	00 00 00 
+  801a39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3e:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  801a45:	00 00 00 
+  801a48:	41 ff d1             	call   *%r9
+
+0000000000801a4b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801a4b:	55                   	push   %rbp
+  801a4c:	48 89 e5             	mov    %rsp,%rbp
+  801a4f:	53                   	push   %rbx
+  801a50:	48 83 ec 08          	sub    $0x8,%rsp
+  801a54:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801a57:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a5a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a64:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a69:	be 00 00 00 00       	mov    $0x0,%esi
+  801a6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a74:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a76:	48 85 c0             	test   %rax,%rax
+  801a79:	7f 06                	jg     801a81 <sys_env_set_trapframe+0x36>
+}
+  801a7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a7f:	c9                   	leave
+  801a80:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a81:	49 89 c0             	mov    %rax,%r8
+  801a84:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  801a89:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801a90:	00 00 00 
+  801a93:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a98:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801a9f:	00 00 00 
+  801aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa7:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  801aae:	00 00 00 
+  801ab1:	41 ff d1             	call   *%r9
+
+0000000000801ab4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801ab4:	55                   	push   %rbp
+  801ab5:	48 89 e5             	mov    %rsp,%rbp
+  801ab8:	53                   	push   %rbx
+  801ab9:	48 83 ec 08          	sub    $0x8,%rsp
+  801abd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801ac0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801ac3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ac8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801acd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ad2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ad7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801add:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801adf:	48 85 c0             	test   %rax,%rax
+  801ae2:	7f 06                	jg     801aea <sys_env_set_pgfault_upcall+0x36>
+}
+  801ae4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ae8:	c9                   	leave
+  801ae9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801aea:	49 89 c0             	mov    %rax,%r8
+  801aed:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801af2:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801af9:	00 00 00 
+  801afc:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801b01:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801b08:	00 00 00 
+  801b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b10:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  801b17:	00 00 00 
+  801b1a:	41 ff d1             	call   *%r9
+
+0000000000801b1d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801b1d:	55                   	push   %rbp
+  801b1e:	48 89 e5             	mov    %rsp,%rbp
+  801b21:	53                   	push   %rbx
+  801b22:	89 f8                	mov    %edi,%eax
+  801b24:	49 89 f1             	mov    %rsi,%r9
+  801b27:	48 89 d3             	mov    %rdx,%rbx
+  801b2a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801b2d:	49 63 f0             	movslq %r8d,%rsi
+  801b30:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b33:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b38:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b41:	cd 30                	int    $0x30
+}
+  801b43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b47:	c9                   	leave
+  801b48:	c3                   	ret
+
+0000000000801b49 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801b49:	55                   	push   %rbp
+  801b4a:	48 89 e5             	mov    %rsp,%rbp
+  801b4d:	53                   	push   %rbx
+  801b4e:	48 83 ec 08          	sub    $0x8,%rsp
+  801b52:	48 89 fa             	mov    %rdi,%rdx
+  801b55:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b58:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b62:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b67:	be 00 00 00 00       	mov    $0x0,%esi
+  801b6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b72:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b74:	48 85 c0             	test   %rax,%rax
+  801b77:	7f 06                	jg     801b7f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b79:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b7d:	c9                   	leave
+  801b7e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b7f:	49 89 c0             	mov    %rax,%r8
+  801b82:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801b87:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  801b8e:	00 00 00 
+  801b91:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801b96:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801b9d:	00 00 00 
+  801ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba5:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  801bac:	00 00 00 
+  801baf:	41 ff d1             	call   *%r9
+
+0000000000801bb2 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801bb2:	55                   	push   %rbp
+  801bb3:	48 89 e5             	mov    %rsp,%rbp
+  801bb6:	53                   	push   %rbx
+  801bb7:	48 89 fa             	mov    %rdi,%rdx
+  801bba:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801bbd:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bcc:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bd7:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801bd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bdd:	c9                   	leave
+  801bde:	c3                   	ret
+
+0000000000801bdf <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801bdf:	55                   	push   %rbp
+  801be0:	48 89 e5             	mov    %rsp,%rbp
+  801be3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801be4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801be9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bee:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bf8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bfd:	be 00 00 00 00       	mov    $0x0,%esi
+  801c02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c08:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c0e:	c9                   	leave
+  801c0f:	c3                   	ret
+
+0000000000801c10 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801c10:	48 85 ff             	test   %rdi,%rdi
+  801c13:	0f 84 b6 01 00 00    	je     801dcf <malloc+0x1bf>
+malloc(size_t size) {
+  801c19:	55                   	push   %rbp
+  801c1a:	48 89 e5             	mov    %rsp,%rbp
+  801c1d:	41 56                	push   %r14
+  801c1f:	41 55                	push   %r13
+  801c21:	41 54                	push   %r12
+  801c23:	53                   	push   %rbx
+  801c24:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801c27:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801c2e:	00 00 00 
+  801c31:	4c 8b 20             	mov    (%rax),%r12
+  801c34:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801c3b:	0f 87 94 01 00 00    	ja     801dd5 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801c41:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801c48:	00 00 00 
+  801c4b:	48 85 c0             	test   %rax,%rax
+  801c4e:	74 6b                	je     801cbb <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801c50:	4d 85 e4             	test   %r12,%r12
+  801c53:	74 66                	je     801cbb <malloc+0xab>
+  801c55:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801c5c:	00 00 00 
+  801c5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c64:	eb 0d                	jmp    801c73 <malloc+0x63>
+  801c66:	48 83 c1 01          	add    $0x1,%rcx
+  801c6a:	48 83 c2 18          	add    $0x18,%rdx
+  801c6e:	49 39 cc             	cmp    %rcx,%r12
+  801c71:	74 48                	je     801cbb <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801c73:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801c78:	74 ec                	je     801c66 <malloc+0x56>
+  801c7a:	48 39 1a             	cmp    %rbx,(%rdx)
+  801c7d:	72 e7                	jb     801c66 <malloc+0x56>
+                real_freep_size--;
+  801c7f:	48 83 e8 01          	sub    $0x1,%rax
+  801c83:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801c8a:	00 00 00 
+                freep[i].is_free = false;
+  801c8d:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801c94:	00 00 00 
+  801c97:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801c9b:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801c9f:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801ca3:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801caa:	00 
+                freep[i].size = size;
+  801cab:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801caf:	48 01 c8             	add    %rcx,%rax
+  801cb2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801cb6:	e9 0b 01 00 00       	jmp    801dc6 <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801cbb:	48 a1 10 60 80 00 00 	movabs 0x806010,%rax
+  801cc2:	00 00 00 
+  801cc5:	48 01 d8             	add    %rbx,%rax
+  801cc8:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801cce:	76 7c                	jbe    801d4c <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801cd0:	48 b8 18 60 80 00 00 	movabs $0x806018,%rax
+  801cd7:	00 00 00 
+  801cda:	4c 8b 30             	mov    (%rax),%r14
+  801cdd:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801ce4:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801ce7:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801cee:	00 00 00 
+  801cf1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801cf8:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801cff:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801d05:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801d09:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  801d10:	00 00 00 
+  801d13:	ff d0                	call   *%rax
+  801d15:	89 c7                	mov    %eax,%edi
+  801d17:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801d1e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801d25:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801d2c:	00 00 00 
+  801d2f:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801d33:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801d38:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  801d3f:	00 00 00 
+  801d42:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	0f 88 90 00 00 00    	js     801ddc <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801d4c:	48 b9 18 60 80 00 00 	movabs $0x806018,%rcx
+  801d53:	00 00 00 
+  801d56:	48 8b 31             	mov    (%rcx),%rsi
+  801d59:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801d60:	00 00 00 
+  801d63:	4c 8b 07             	mov    (%rdi),%r8
+  801d66:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801d6a:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801d71:	00 00 00 
+  801d74:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801d78:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801d7c:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801d83:	00 00 00 
+  801d86:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801d8a:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801d8d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801d91:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801d98:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801d99:	48 89 d8             	mov    %rbx,%rax
+  801d9c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801da1:	4c 01 c0             	add    %r8,%rax
+  801da4:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801da7:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801dae:	48 01 f3             	add    %rsi,%rbx
+  801db1:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801db4:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801db9:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801dc0:	00 00 00 
+  801dc3:	48 89 d0             	mov    %rdx,%rax
+}
+  801dc6:	5b                   	pop    %rbx
+  801dc7:	41 5c                	pop    %r12
+  801dc9:	41 5d                	pop    %r13
+  801dcb:	41 5e                	pop    %r14
+  801dcd:	5d                   	pop    %rbp
+  801dce:	c3                   	ret
+        return NULL;
+  801dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dd4:	c3                   	ret
+        return NULL;
+  801dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dda:	eb ea                	jmp    801dc6 <malloc+0x1b6>
+            return NULL;
+  801ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de1:	eb e3                	jmp    801dc6 <malloc+0x1b6>
+
+0000000000801de3 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801de3:	55                   	push   %rbp
+  801de4:	48 89 e5             	mov    %rsp,%rbp
+  801de7:	53                   	push   %rbx
+  801de8:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801dec:	48 89 fb             	mov    %rdi,%rbx
+  801def:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801df3:	48 89 df             	mov    %rbx,%rdi
+  801df6:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  801dfd:	00 00 00 
+  801e00:	ff d0                	call   *%rax
+  801e02:	48 89 c7             	mov    %rax,%rdi
+  801e05:	48 89 da             	mov    %rbx,%rdx
+  801e08:	be 00 00 00 00       	mov    $0x0,%esi
+  801e0d:	48 b8 1c 13 80 00 00 	movabs $0x80131c,%rax
+  801e14:	00 00 00 
+  801e17:	ff d0                	call   *%rax
+}
+  801e19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e1d:	c9                   	leave
+  801e1e:	c3                   	ret
+
+0000000000801e1f <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801e1f:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801e26:	00 00 00 
+  801e29:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801e30:	00 00 00 
+  801e33:	48 3b 02             	cmp    (%rdx),%rax
+  801e36:	74 4d                	je     801e85 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801e38:	48 85 c0             	test   %rax,%rax
+  801e3b:	74 4d                	je     801e8a <get_allocsize+0x6b>
+  801e3d:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801e44:	00 00 00 
+  801e47:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801e4c:	48 3b 39             	cmp    (%rcx),%rdi
+  801e4f:	74 13                	je     801e64 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801e51:	48 83 c2 01          	add    $0x1,%rdx
+  801e55:	48 83 c1 18          	add    $0x18,%rcx
+  801e59:	48 39 d0             	cmp    %rdx,%rax
+  801e5c:	75 ee                	jne    801e4c <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e63:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801e64:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801e68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6d:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801e74:	00 00 00 
+  801e77:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801e7d:	75 0b                	jne    801e8a <get_allocsize+0x6b>
+  801e7f:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801e84:	c3                   	ret
+        return 0;
+  801e85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e8a:	c3                   	ret
+
+0000000000801e8b <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801e8b:	48 85 ff             	test   %rdi,%rdi
+  801e8e:	0f 84 01 01 00 00    	je     801f95 <free+0x10a>
+free(void *ptr) {
+  801e94:	55                   	push   %rbp
+  801e95:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801e98:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801e9f:	00 00 00 
+  801ea2:	48 8b 30             	mov    (%rax),%rsi
+  801ea5:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801eac:	00 00 00 
+  801eaf:	48 39 c6             	cmp    %rax,%rsi
+  801eb2:	74 50                	je     801f04 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801eb4:	48 85 f6             	test   %rsi,%rsi
+  801eb7:	74 21                	je     801eda <free+0x4f>
+  801eb9:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801ec0:	00 00 00 
+  801ec3:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801ec8:	48 3b 39             	cmp    (%rcx),%rdi
+  801ecb:	74 61                	je     801f2e <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801ecd:	48 83 c2 01          	add    $0x1,%rdx
+  801ed1:	48 83 c1 18          	add    $0x18,%rcx
+  801ed5:	48 39 d6             	cmp    %rdx,%rsi
+  801ed8:	75 ee                	jne    801ec8 <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801eda:	48 ba 10 57 80 00 00 	movabs $0x805710,%rdx
+  801ee1:	00 00 00 
+  801ee4:	be 12 01 00 00       	mov    $0x112,%esi
+  801ee9:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801ef0:	00 00 00 
+  801ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef8:	48 b9 74 05 80 00 00 	movabs $0x800574,%rcx
+  801eff:	00 00 00 
+  801f02:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801f04:	48 ba c0 56 80 00 00 	movabs $0x8056c0,%rdx
+  801f0b:	00 00 00 
+  801f0e:	be 06 01 00 00       	mov    $0x106,%esi
+  801f13:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801f1a:	00 00 00 
+  801f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f22:	48 b9 74 05 80 00 00 	movabs $0x800574,%rcx
+  801f29:	00 00 00 
+  801f2c:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801f2e:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801f32:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801f39:	00 00 00 
+  801f3c:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801f42:	75 27                	jne    801f6b <free+0xe0>
+            freep[i].is_free = true;
+  801f44:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801f48:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801f4f:	00 00 00 
+  801f52:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801f59:	00 00 
+            real_freep_size++;
+  801f5b:	48 83 c0 01          	add    $0x1,%rax
+  801f5f:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801f66:	00 00 00 
+}
+  801f69:	5d                   	pop    %rbp
+  801f6a:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801f6b:	48 ba e8 56 80 00 00 	movabs $0x8056e8,%rdx
+  801f72:	00 00 00 
+  801f75:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801f7a:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  801f81:	00 00 00 
+  801f84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f89:	48 b9 74 05 80 00 00 	movabs $0x800574,%rcx
+  801f90:	00 00 00 
+  801f93:	ff d1                	call   *%rcx
+  801f95:	c3                   	ret
+
+0000000000801f96 <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801f96:	55                   	push   %rbp
+  801f97:	48 89 e5             	mov    %rsp,%rbp
+  801f9a:	41 55                	push   %r13
+  801f9c:	41 54                	push   %r12
+  801f9e:	53                   	push   %rbx
+  801f9f:	48 83 ec 08          	sub    $0x8,%rsp
+  801fa3:	48 89 fb             	mov    %rdi,%rbx
+  801fa6:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801fa9:	48 b8 1f 1e 80 00 00 	movabs $0x801e1f,%rax
+  801fb0:	00 00 00 
+  801fb3:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801fb5:	49 39 c5             	cmp    %rax,%r13
+  801fb8:	73 0e                	jae    801fc8 <realloc+0x32>
+}
+  801fba:	48 89 d8             	mov    %rbx,%rax
+  801fbd:	48 83 c4 08          	add    $0x8,%rsp
+  801fc1:	5b                   	pop    %rbx
+  801fc2:	41 5c                	pop    %r12
+  801fc4:	41 5d                	pop    %r13
+  801fc6:	5d                   	pop    %rbp
+  801fc7:	c3                   	ret
+  801fc8:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801fcb:	4c 89 ef             	mov    %r13,%rdi
+  801fce:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  801fd5:	00 00 00 
+  801fd8:	ff d0                	call   *%rax
+  801fda:	48 89 c7             	mov    %rax,%rdi
+  801fdd:	4c 89 e2             	mov    %r12,%rdx
+  801fe0:	48 89 de             	mov    %rbx,%rsi
+  801fe3:	48 b8 31 14 80 00 00 	movabs $0x801431,%rax
+  801fea:	00 00 00 
+  801fed:	ff d0                	call   *%rax
+  801fef:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801ff2:	48 89 df             	mov    %rbx,%rdi
+  801ff5:	48 b8 8b 1e 80 00 00 	movabs $0x801e8b,%rax
+  801ffc:	00 00 00 
+  801fff:	ff d0                	call   *%rax
+    return newptr;
+  802001:	4c 89 e3             	mov    %r12,%rbx
+  802004:	eb b4                	jmp    801fba <realloc+0x24>
+
+0000000000802006 <strdup>:
+
+char*
+strdup (const char *src) {
+  802006:	55                   	push   %rbp
+  802007:	48 89 e5             	mov    %rsp,%rbp
+  80200a:	41 54                	push   %r12
+  80200c:	53                   	push   %rbx
+  80200d:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  802010:	48 b8 fe 0f 80 00 00 	movabs $0x800ffe,%rax
+  802017:	00 00 00 
+  80201a:	ff d0                	call   *%rax
+  80201c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  802020:	4c 89 e7             	mov    %r12,%rdi
+  802023:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  80202a:	00 00 00 
+  80202d:	ff d0                	call   *%rax
+  80202f:	48 89 c7             	mov    %rax,%rdi
+  802032:	4c 89 e2             	mov    %r12,%rdx
+  802035:	48 89 de             	mov    %rbx,%rsi
+  802038:	48 b8 31 14 80 00 00 	movabs $0x801431,%rax
+  80203f:	00 00 00 
+  802042:	ff d0                	call   *%rax
+}
+  802044:	5b                   	pop    %rbx
+  802045:	41 5c                	pop    %r12
+  802047:	5d                   	pop    %rbp
+  802048:	c3                   	ret
+
+0000000000802049 <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  802049:	55                   	push   %rbp
+  80204a:	48 89 e5             	mov    %rsp,%rbp
+  80204d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80204e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802053:	ba 00 00 00 00       	mov    $0x0,%edx
+  802058:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80205d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802062:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802067:	be 00 00 00 00       	mov    $0x0,%esi
+  80206c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802072:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  802074:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802078:	c9                   	leave
+  802079:	c3                   	ret
+
+000000000080207a <get_ticks>:
+
+uint64_t
+get_ticks() {
+  80207a:	55                   	push   %rbp
+  80207b:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  80207e:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  802085:	00 00 00 
+  802088:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80208c:	74 26                	je     8020b4 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80208e:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802090:	48 c1 e2 20          	shl    $0x20,%rdx
+  802094:	89 c0                	mov    %eax,%eax
+  802096:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  802099:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  8020a0:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  8020a7:	00 00 00 
+  8020aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020af:	48 f7 31             	divq   (%rcx)
+}
+  8020b2:	5d                   	pop    %rbp
+  8020b3:	c3                   	ret
+        freq = get_cpufreq();
+  8020b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b9:	48 ba 49 20 80 00 00 	movabs $0x802049,%rdx
+  8020c0:	00 00 00 
+  8020c3:	ff d2                	call   *%rdx
+  8020c5:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  8020cc:	00 00 00 
+  8020cf:	eb bd                	jmp    80208e <get_ticks+0x14>
+
+00000000008020d1 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  8020d1:	55                   	push   %rbp
+  8020d2:	48 89 e5             	mov    %rsp,%rbp
+  8020d5:	53                   	push   %rbx
+  8020d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8020da:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  8020dd:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  8020e4:	00 00 00 
+  8020e7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8020eb:	74 50                	je     80213d <sleep+0x6c>
+    asm volatile("rdtsc"
+  8020ed:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8020ef:	48 c1 e2 20          	shl    $0x20,%rdx
+  8020f3:	89 c0                	mov    %eax,%eax
+  8020f5:	48 89 d6             	mov    %rdx,%rsi
+  8020f8:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  8020fb:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  802102:	00 00 00 
+  802105:	48 0f af 18          	imul   (%rax),%rbx
+  802109:	48 c1 eb 03          	shr    $0x3,%rbx
+  80210d:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  802114:	9b c4 20 
+  802117:	48 89 d8             	mov    %rbx,%rax
+  80211a:	48 f7 e2             	mul    %rdx
+  80211d:	48 89 d1             	mov    %rdx,%rcx
+  802120:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  802124:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  802126:	48 c1 e2 20          	shl    $0x20,%rdx
+  80212a:	89 c0                	mov    %eax,%eax
+  80212c:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  80212f:	48 29 f2             	sub    %rsi,%rdx
+  802132:	48 39 ca             	cmp    %rcx,%rdx
+  802135:	72 ed                	jb     802124 <sleep+0x53>
+}
+  802137:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80213b:	c9                   	leave
+  80213c:	c3                   	ret
+        freq = get_cpufreq();
+  80213d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802142:	48 ba 49 20 80 00 00 	movabs $0x802049,%rdx
+  802149:	00 00 00 
+  80214c:	ff d2                	call   *%rdx
+  80214e:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  802155:	00 00 00 
+  802158:	eb 93                	jmp    8020ed <sleep+0x1c>
+
+000000000080215a <poll_kbd>:
+
+int poll_kbd() {
+  80215a:	55                   	push   %rbp
+  80215b:	48 89 e5             	mov    %rsp,%rbp
+  80215e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80215f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802164:	ba 00 00 00 00       	mov    $0x0,%edx
+  802169:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80216e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802173:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802178:	be 00 00 00 00       	mov    $0x0,%esi
+  80217d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802183:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  802185:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802189:	c9                   	leave
+  80218a:	c3                   	ret
+
+000000000080218b <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  80218b:	55                   	push   %rbp
+  80218c:	48 89 e5             	mov    %rsp,%rbp
+  80218f:	53                   	push   %rbx
+  802190:	49 89 fa             	mov    %rdi,%r10
+  802193:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  802195:	44 89 c6             	mov    %r8d,%esi
+  802198:	89 cf                	mov    %ecx,%edi
+  80219a:	89 d3                	mov    %edx,%ebx
+  80219c:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  80219e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8021a3:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021a6:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  8021aa:	cd 30                	int    $0x30
+  8021ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021b0:	c9                   	leave
+  8021b1:	c3                   	ret
+
+00000000008021b2 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8021b2:	55                   	push   %rbp
+  8021b3:	48 89 e5             	mov    %rsp,%rbp
+  8021b6:	41 54                	push   %r12
+  8021b8:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  8021b9:	48 b8 6b 39 80 00 00 	movabs $0x80396b,%rax
+  8021c0:	00 00 00 
+  8021c3:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8021c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8021ca:	cd 30                	int    $0x30
+  8021cc:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  8021cf:	85 c0                	test   %eax,%eax
+  8021d1:	78 76                	js     802249 <fork+0x97>
+        return envid;
+    if (!envid) {
+  8021d3:	74 7c                	je     802251 <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  8021d5:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8021db:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8021e2:	00 00 00 
+  8021e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021ea:	89 c2                	mov    %eax,%edx
+  8021ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021f6:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  8021fd:	00 00 00 
+  802200:	ff d0                	call   *%rax
+  802202:	85 c0                	test   %eax,%eax
+  802204:	75 7c                	jne    802282 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  802206:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80220d:	00 00 00 
+  802210:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  802217:	44 89 e7             	mov    %r12d,%edi
+  80221a:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  802221:	00 00 00 
+  802224:	ff d0                	call   *%rax
+  802226:	85 c0                	test   %eax,%eax
+  802228:	75 60                	jne    80228a <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  80222a:	be 02 00 00 00       	mov    $0x2,%esi
+  80222f:	44 89 e7             	mov    %r12d,%edi
+  802232:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  802239:	00 00 00 
+  80223c:	ff d0                	call   *%rax
+        return -1;
+  80223e:	85 c0                	test   %eax,%eax
+  802240:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802245:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  802249:	44 89 e0             	mov    %r12d,%eax
+  80224c:	5b                   	pop    %rbx
+  80224d:	41 5c                	pop    %r12
+  80224f:	5d                   	pop    %rbp
+  802250:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802251:	48 b8 dc 16 80 00 00 	movabs $0x8016dc,%rax
+  802258:	00 00 00 
+  80225b:	ff d0                	call   *%rax
+  80225d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802262:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  802269:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802270:	00 00 00 
+  802273:	48 01 d0             	add    %rdx,%rax
+  802276:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  80227d:	00 00 00 
+        return 0;
+  802280:	eb c7                	jmp    802249 <fork+0x97>
+        return -1;
+  802282:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802288:	eb bf                	jmp    802249 <fork+0x97>
+  80228a:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802290:	eb b7                	jmp    802249 <fork+0x97>
+
+0000000000802292 <sfork>:
+
+envid_t
+sfork() {
+  802292:	55                   	push   %rbp
+  802293:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  802296:	48 ba 46 57 80 00 00 	movabs $0x805746,%rdx
+  80229d:	00 00 00 
+  8022a0:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8022a5:	48 bf 61 57 80 00 00 	movabs $0x805761,%rdi
+  8022ac:	00 00 00 
+  8022af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b4:	48 b9 74 05 80 00 00 	movabs $0x800574,%rcx
+  8022bb:	00 00 00 
+  8022be:	ff d1                	call   *%rcx
+
+00000000008022c0 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022c0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022c7:	ff ff ff 
+  8022ca:	48 01 f8             	add    %rdi,%rax
+  8022cd:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8022d1:	c3                   	ret
+
+00000000008022d2 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8022d2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8022d9:	ff ff ff 
+  8022dc:	48 01 f8             	add    %rdi,%rax
+  8022df:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8022e3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8022e9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8022ed:	c3                   	ret
+
+00000000008022ee <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8022ee:	55                   	push   %rbp
+  8022ef:	48 89 e5             	mov    %rsp,%rbp
+  8022f2:	41 57                	push   %r15
+  8022f4:	41 56                	push   %r14
+  8022f6:	41 55                	push   %r13
+  8022f8:	41 54                	push   %r12
+  8022fa:	53                   	push   %rbx
+  8022fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ff:	49 89 ff             	mov    %rdi,%r15
+  802302:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802307:	49 bd 5b 42 80 00 00 	movabs $0x80425b,%r13
+  80230e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802311:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802317:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80231a:	48 89 df             	mov    %rbx,%rdi
+  80231d:	41 ff d5             	call   *%r13
+  802320:	83 e0 04             	and    $0x4,%eax
+  802323:	74 17                	je     80233c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802325:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80232c:	4c 39 f3             	cmp    %r14,%rbx
+  80232f:	75 e6                	jne    802317 <fd_alloc+0x29>
+  802331:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802337:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80233c:	4d 89 27             	mov    %r12,(%r15)
+}
+  80233f:	48 83 c4 08          	add    $0x8,%rsp
+  802343:	5b                   	pop    %rbx
+  802344:	41 5c                	pop    %r12
+  802346:	41 5d                	pop    %r13
+  802348:	41 5e                	pop    %r14
+  80234a:	41 5f                	pop    %r15
+  80234c:	5d                   	pop    %rbp
+  80234d:	c3                   	ret
+
+000000000080234e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80234e:	83 ff 1f             	cmp    $0x1f,%edi
+  802351:	77 39                	ja     80238c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802353:	55                   	push   %rbp
+  802354:	48 89 e5             	mov    %rsp,%rbp
+  802357:	41 54                	push   %r12
+  802359:	53                   	push   %rbx
+  80235a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80235d:	48 63 df             	movslq %edi,%rbx
+  802360:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802367:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80236b:	48 89 df             	mov    %rbx,%rdi
+  80236e:	48 b8 5b 42 80 00 00 	movabs $0x80425b,%rax
+  802375:	00 00 00 
+  802378:	ff d0                	call   *%rax
+  80237a:	a8 04                	test   $0x4,%al
+  80237c:	74 14                	je     802392 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80237e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802382:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802387:	5b                   	pop    %rbx
+  802388:	41 5c                	pop    %r12
+  80238a:	5d                   	pop    %rbp
+  80238b:	c3                   	ret
+        return -E_INVAL;
+  80238c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802391:	c3                   	ret
+        return -E_INVAL;
+  802392:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802397:	eb ee                	jmp    802387 <fd_lookup+0x39>
+
+0000000000802399 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802399:	55                   	push   %rbp
+  80239a:	48 89 e5             	mov    %rsp,%rbp
+  80239d:	41 54                	push   %r12
+  80239f:	53                   	push   %rbx
+  8023a0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8023a3:	48 b8 00 58 80 00 00 	movabs $0x805800,%rax
+  8023aa:	00 00 00 
+  8023ad:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8023b4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8023b7:	39 3b                	cmp    %edi,(%rbx)
+  8023b9:	74 47                	je     802402 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8023bb:	48 83 c0 08          	add    $0x8,%rax
+  8023bf:	48 8b 18             	mov    (%rax),%rbx
+  8023c2:	48 85 db             	test   %rbx,%rbx
+  8023c5:	75 f0                	jne    8023b7 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023c7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8023ce:	00 00 00 
+  8023d1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8023d7:	89 fa                	mov    %edi,%edx
+  8023d9:	48 bf 70 57 80 00 00 	movabs $0x805770,%rdi
+  8023e0:	00 00 00 
+  8023e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e8:	48 b9 c4 06 80 00 00 	movabs $0x8006c4,%rcx
+  8023ef:	00 00 00 
+  8023f2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8023f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8023f9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8023fd:	5b                   	pop    %rbx
+  8023fe:	41 5c                	pop    %r12
+  802400:	5d                   	pop    %rbp
+  802401:	c3                   	ret
+            return 0;
+  802402:	b8 00 00 00 00       	mov    $0x0,%eax
+  802407:	eb f0                	jmp    8023f9 <dev_lookup+0x60>
+
+0000000000802409 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802409:	55                   	push   %rbp
+  80240a:	48 89 e5             	mov    %rsp,%rbp
+  80240d:	41 55                	push   %r13
+  80240f:	41 54                	push   %r12
+  802411:	53                   	push   %rbx
+  802412:	48 83 ec 18          	sub    $0x18,%rsp
+  802416:	48 89 fb             	mov    %rdi,%rbx
+  802419:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80241c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802423:	ff ff ff 
+  802426:	48 01 df             	add    %rbx,%rdi
+  802429:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80242d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802431:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  802438:	00 00 00 
+  80243b:	ff d0                	call   *%rax
+  80243d:	41 89 c5             	mov    %eax,%r13d
+  802440:	85 c0                	test   %eax,%eax
+  802442:	78 06                	js     80244a <fd_close+0x41>
+  802444:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802448:	74 1a                	je     802464 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80244a:	45 84 e4             	test   %r12b,%r12b
+  80244d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802452:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802456:	44 89 e8             	mov    %r13d,%eax
+  802459:	48 83 c4 18          	add    $0x18,%rsp
+  80245d:	5b                   	pop    %rbx
+  80245e:	41 5c                	pop    %r12
+  802460:	41 5d                	pop    %r13
+  802462:	5d                   	pop    %rbp
+  802463:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802464:	8b 3b                	mov    (%rbx),%edi
+  802466:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80246a:	48 b8 99 23 80 00 00 	movabs $0x802399,%rax
+  802471:	00 00 00 
+  802474:	ff d0                	call   *%rax
+  802476:	41 89 c5             	mov    %eax,%r13d
+  802479:	85 c0                	test   %eax,%eax
+  80247b:	78 1b                	js     802498 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80247d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802481:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802485:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80248b:	48 85 c0             	test   %rax,%rax
+  80248e:	74 08                	je     802498 <fd_close+0x8f>
+  802490:	48 89 df             	mov    %rbx,%rdi
+  802493:	ff d0                	call   *%rax
+  802495:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802498:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80249d:	48 89 de             	mov    %rbx,%rsi
+  8024a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a5:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+    return res;
+  8024b1:	eb a3                	jmp    802456 <fd_close+0x4d>
+
+00000000008024b3 <close>:
+
+int
+close(int fdnum) {
+  8024b3:	55                   	push   %rbp
+  8024b4:	48 89 e5             	mov    %rsp,%rbp
+  8024b7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8024bb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8024bf:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  8024c6:	00 00 00 
+  8024c9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8024cb:	85 c0                	test   %eax,%eax
+  8024cd:	78 15                	js     8024e4 <close+0x31>
+
+    return fd_close(fd, 1);
+  8024cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8024d4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8024d8:	48 b8 09 24 80 00 00 	movabs $0x802409,%rax
+  8024df:	00 00 00 
+  8024e2:	ff d0                	call   *%rax
+}
+  8024e4:	c9                   	leave
+  8024e5:	c3                   	ret
+
+00000000008024e6 <close_all>:
+
+void
+close_all(void) {
+  8024e6:	55                   	push   %rbp
+  8024e7:	48 89 e5             	mov    %rsp,%rbp
+  8024ea:	41 54                	push   %r12
+  8024ec:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8024ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024f2:	49 bc b3 24 80 00 00 	movabs $0x8024b3,%r12
+  8024f9:	00 00 00 
+  8024fc:	89 df                	mov    %ebx,%edi
+  8024fe:	41 ff d4             	call   *%r12
+  802501:	83 c3 01             	add    $0x1,%ebx
+  802504:	83 fb 20             	cmp    $0x20,%ebx
+  802507:	75 f3                	jne    8024fc <close_all+0x16>
+}
+  802509:	5b                   	pop    %rbx
+  80250a:	41 5c                	pop    %r12
+  80250c:	5d                   	pop    %rbp
+  80250d:	c3                   	ret
+
+000000000080250e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80250e:	55                   	push   %rbp
+  80250f:	48 89 e5             	mov    %rsp,%rbp
+  802512:	41 57                	push   %r15
+  802514:	41 56                	push   %r14
+  802516:	41 55                	push   %r13
+  802518:	41 54                	push   %r12
+  80251a:	53                   	push   %rbx
+  80251b:	48 83 ec 18          	sub    $0x18,%rsp
+  80251f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802522:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802526:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  80252d:	00 00 00 
+  802530:	ff d0                	call   *%rax
+  802532:	89 c3                	mov    %eax,%ebx
+  802534:	85 c0                	test   %eax,%eax
+  802536:	0f 88 b8 00 00 00    	js     8025f4 <dup+0xe6>
+    close(newfdnum);
+  80253c:	44 89 e7             	mov    %r12d,%edi
+  80253f:	48 b8 b3 24 80 00 00 	movabs $0x8024b3,%rax
+  802546:	00 00 00 
+  802549:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80254b:	4d 63 ec             	movslq %r12d,%r13
+  80254e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802555:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802559:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80255d:	4c 89 ff             	mov    %r15,%rdi
+  802560:	49 be d2 22 80 00 00 	movabs $0x8022d2,%r14
+  802567:	00 00 00 
+  80256a:	41 ff d6             	call   *%r14
+  80256d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802570:	4c 89 ef             	mov    %r13,%rdi
+  802573:	41 ff d6             	call   *%r14
+  802576:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802579:	48 89 df             	mov    %rbx,%rdi
+  80257c:	48 b8 5b 42 80 00 00 	movabs $0x80425b,%rax
+  802583:	00 00 00 
+  802586:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802588:	a8 04                	test   $0x4,%al
+  80258a:	74 2b                	je     8025b7 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80258c:	41 89 c1             	mov    %eax,%r9d
+  80258f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802595:	4c 89 f1             	mov    %r14,%rcx
+  802598:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259d:	48 89 de             	mov    %rbx,%rsi
+  8025a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a5:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  8025ac:	00 00 00 
+  8025af:	ff d0                	call   *%rax
+  8025b1:	89 c3                	mov    %eax,%ebx
+  8025b3:	85 c0                	test   %eax,%eax
+  8025b5:	78 4e                	js     802605 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8025b7:	4c 89 ff             	mov    %r15,%rdi
+  8025ba:	48 b8 5b 42 80 00 00 	movabs $0x80425b,%rax
+  8025c1:	00 00 00 
+  8025c4:	ff d0                	call   *%rax
+  8025c6:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8025c9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8025cf:	4c 89 e9             	mov    %r13,%rcx
+  8025d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d7:	4c 89 fe             	mov    %r15,%rsi
+  8025da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025df:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  8025e6:	00 00 00 
+  8025e9:	ff d0                	call   *%rax
+  8025eb:	89 c3                	mov    %eax,%ebx
+  8025ed:	85 c0                	test   %eax,%eax
+  8025ef:	78 14                	js     802605 <dup+0xf7>
+
+    return newfdnum;
+  8025f1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8025f4:	89 d8                	mov    %ebx,%eax
+  8025f6:	48 83 c4 18          	add    $0x18,%rsp
+  8025fa:	5b                   	pop    %rbx
+  8025fb:	41 5c                	pop    %r12
+  8025fd:	41 5d                	pop    %r13
+  8025ff:	41 5e                	pop    %r14
+  802601:	41 5f                	pop    %r15
+  802603:	5d                   	pop    %rbp
+  802604:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802605:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80260a:	4c 89 ee             	mov    %r13,%rsi
+  80260d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802612:	49 bc 7b 19 80 00 00 	movabs $0x80197b,%r12
+  802619:	00 00 00 
+  80261c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80261f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802624:	4c 89 f6             	mov    %r14,%rsi
+  802627:	bf 00 00 00 00       	mov    $0x0,%edi
+  80262c:	41 ff d4             	call   *%r12
+    return res;
+  80262f:	eb c3                	jmp    8025f4 <dup+0xe6>
+
+0000000000802631 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802631:	55                   	push   %rbp
+  802632:	48 89 e5             	mov    %rsp,%rbp
+  802635:	41 56                	push   %r14
+  802637:	41 55                	push   %r13
+  802639:	41 54                	push   %r12
+  80263b:	53                   	push   %rbx
+  80263c:	48 83 ec 10          	sub    $0x10,%rsp
+  802640:	89 fb                	mov    %edi,%ebx
+  802642:	49 89 f4             	mov    %rsi,%r12
+  802645:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802648:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80264c:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  802653:	00 00 00 
+  802656:	ff d0                	call   *%rax
+  802658:	85 c0                	test   %eax,%eax
+  80265a:	78 4c                	js     8026a8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80265c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802660:	41 8b 3e             	mov    (%r14),%edi
+  802663:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802667:	48 b8 99 23 80 00 00 	movabs $0x802399,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+  802673:	85 c0                	test   %eax,%eax
+  802675:	78 35                	js     8026ac <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802677:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80267b:	83 e0 03             	and    $0x3,%eax
+  80267e:	83 f8 01             	cmp    $0x1,%eax
+  802681:	74 2d                	je     8026b0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802683:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802687:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80268b:	48 85 c0             	test   %rax,%rax
+  80268e:	74 56                	je     8026e6 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802690:	4c 89 ea             	mov    %r13,%rdx
+  802693:	4c 89 e6             	mov    %r12,%rsi
+  802696:	4c 89 f7             	mov    %r14,%rdi
+  802699:	ff d0                	call   *%rax
+}
+  80269b:	48 83 c4 10          	add    $0x10,%rsp
+  80269f:	5b                   	pop    %rbx
+  8026a0:	41 5c                	pop    %r12
+  8026a2:	41 5d                	pop    %r13
+  8026a4:	41 5e                	pop    %r14
+  8026a6:	5d                   	pop    %rbp
+  8026a7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026a8:	48 98                	cltq
+  8026aa:	eb ef                	jmp    80269b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026ac:	48 98                	cltq
+  8026ae:	eb eb                	jmp    80269b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026b0:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8026b7:	00 00 00 
+  8026ba:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8026c0:	89 da                	mov    %ebx,%edx
+  8026c2:	48 bf b1 57 80 00 00 	movabs $0x8057b1,%rdi
+  8026c9:	00 00 00 
+  8026cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d1:	48 b9 c4 06 80 00 00 	movabs $0x8006c4,%rcx
+  8026d8:	00 00 00 
+  8026db:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8026dd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8026e4:	eb b5                	jmp    80269b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8026e6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8026ed:	eb ac                	jmp    80269b <read+0x6a>
+
+00000000008026ef <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8026ef:	55                   	push   %rbp
+  8026f0:	48 89 e5             	mov    %rsp,%rbp
+  8026f3:	41 57                	push   %r15
+  8026f5:	41 56                	push   %r14
+  8026f7:	41 55                	push   %r13
+  8026f9:	41 54                	push   %r12
+  8026fb:	53                   	push   %rbx
+  8026fc:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802700:	48 85 d2             	test   %rdx,%rdx
+  802703:	74 54                	je     802759 <readn+0x6a>
+  802705:	41 89 fd             	mov    %edi,%r13d
+  802708:	49 89 f6             	mov    %rsi,%r14
+  80270b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80270e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802713:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802718:	49 bf 31 26 80 00 00 	movabs $0x802631,%r15
+  80271f:	00 00 00 
+  802722:	4c 89 e2             	mov    %r12,%rdx
+  802725:	48 29 f2             	sub    %rsi,%rdx
+  802728:	4c 01 f6             	add    %r14,%rsi
+  80272b:	44 89 ef             	mov    %r13d,%edi
+  80272e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802731:	85 c0                	test   %eax,%eax
+  802733:	78 20                	js     802755 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802735:	01 c3                	add    %eax,%ebx
+  802737:	85 c0                	test   %eax,%eax
+  802739:	74 08                	je     802743 <readn+0x54>
+  80273b:	48 63 f3             	movslq %ebx,%rsi
+  80273e:	4c 39 e6             	cmp    %r12,%rsi
+  802741:	72 df                	jb     802722 <readn+0x33>
+    }
+    return res;
+  802743:	48 63 c3             	movslq %ebx,%rax
+}
+  802746:	48 83 c4 08          	add    $0x8,%rsp
+  80274a:	5b                   	pop    %rbx
+  80274b:	41 5c                	pop    %r12
+  80274d:	41 5d                	pop    %r13
+  80274f:	41 5e                	pop    %r14
+  802751:	41 5f                	pop    %r15
+  802753:	5d                   	pop    %rbp
+  802754:	c3                   	ret
+        if (inc < 0) return inc;
+  802755:	48 98                	cltq
+  802757:	eb ed                	jmp    802746 <readn+0x57>
+    int inc = 1, res = 0;
+  802759:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80275e:	eb e3                	jmp    802743 <readn+0x54>
+
+0000000000802760 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802760:	55                   	push   %rbp
+  802761:	48 89 e5             	mov    %rsp,%rbp
+  802764:	41 56                	push   %r14
+  802766:	41 55                	push   %r13
+  802768:	41 54                	push   %r12
+  80276a:	53                   	push   %rbx
+  80276b:	48 83 ec 10          	sub    $0x10,%rsp
+  80276f:	89 fb                	mov    %edi,%ebx
+  802771:	49 89 f4             	mov    %rsi,%r12
+  802774:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802777:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80277b:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  802782:	00 00 00 
+  802785:	ff d0                	call   *%rax
+  802787:	85 c0                	test   %eax,%eax
+  802789:	78 47                	js     8027d2 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80278b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80278f:	41 8b 3e             	mov    (%r14),%edi
+  802792:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802796:	48 b8 99 23 80 00 00 	movabs $0x802399,%rax
+  80279d:	00 00 00 
+  8027a0:	ff d0                	call   *%rax
+  8027a2:	85 c0                	test   %eax,%eax
+  8027a4:	78 30                	js     8027d6 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027a6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8027ab:	74 2d                	je     8027da <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8027ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027b1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8027b5:	48 85 c0             	test   %rax,%rax
+  8027b8:	74 56                	je     802810 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8027ba:	4c 89 ea             	mov    %r13,%rdx
+  8027bd:	4c 89 e6             	mov    %r12,%rsi
+  8027c0:	4c 89 f7             	mov    %r14,%rdi
+  8027c3:	ff d0                	call   *%rax
+}
+  8027c5:	48 83 c4 10          	add    $0x10,%rsp
+  8027c9:	5b                   	pop    %rbx
+  8027ca:	41 5c                	pop    %r12
+  8027cc:	41 5d                	pop    %r13
+  8027ce:	41 5e                	pop    %r14
+  8027d0:	5d                   	pop    %rbp
+  8027d1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027d2:	48 98                	cltq
+  8027d4:	eb ef                	jmp    8027c5 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027d6:	48 98                	cltq
+  8027d8:	eb eb                	jmp    8027c5 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8027da:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8027e1:	00 00 00 
+  8027e4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8027ea:	89 da                	mov    %ebx,%edx
+  8027ec:	48 bf cd 57 80 00 00 	movabs $0x8057cd,%rdi
+  8027f3:	00 00 00 
+  8027f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fb:	48 b9 c4 06 80 00 00 	movabs $0x8006c4,%rcx
+  802802:	00 00 00 
+  802805:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802807:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80280e:	eb b5                	jmp    8027c5 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802810:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802817:	eb ac                	jmp    8027c5 <write+0x65>
+
+0000000000802819 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802819:	55                   	push   %rbp
+  80281a:	48 89 e5             	mov    %rsp,%rbp
+  80281d:	53                   	push   %rbx
+  80281e:	48 83 ec 18          	sub    $0x18,%rsp
+  802822:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802824:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802828:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  80282f:	00 00 00 
+  802832:	ff d0                	call   *%rax
+  802834:	85 c0                	test   %eax,%eax
+  802836:	78 0c                	js     802844 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802838:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80283c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80283f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802844:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802848:	c9                   	leave
+  802849:	c3                   	ret
+
+000000000080284a <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  80284a:	55                   	push   %rbp
+  80284b:	48 89 e5             	mov    %rsp,%rbp
+  80284e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802852:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802856:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+  802862:	85 c0                	test   %eax,%eax
+  802864:	78 07                	js     80286d <tell+0x23>
+    return fdes->fd_offset;
+  802866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80286a:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80286d:	c9                   	leave
+  80286e:	c3                   	ret
+
+000000000080286f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80286f:	55                   	push   %rbp
+  802870:	48 89 e5             	mov    %rsp,%rbp
+  802873:	41 55                	push   %r13
+  802875:	41 54                	push   %r12
+  802877:	53                   	push   %rbx
+  802878:	48 83 ec 18          	sub    $0x18,%rsp
+  80287c:	89 fb                	mov    %edi,%ebx
+  80287e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802881:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802885:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  80288c:	00 00 00 
+  80288f:	ff d0                	call   *%rax
+  802891:	85 c0                	test   %eax,%eax
+  802893:	78 38                	js     8028cd <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802895:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802899:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80289d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028a1:	48 b8 99 23 80 00 00 	movabs $0x802399,%rax
+  8028a8:	00 00 00 
+  8028ab:	ff d0                	call   *%rax
+  8028ad:	85 c0                	test   %eax,%eax
+  8028af:	78 1c                	js     8028cd <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8028b1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8028b6:	74 20                	je     8028d8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8028b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028bc:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8028c0:	48 85 c0             	test   %rax,%rax
+  8028c3:	74 47                	je     80290c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8028c5:	44 89 e6             	mov    %r12d,%esi
+  8028c8:	4c 89 ef             	mov    %r13,%rdi
+  8028cb:	ff d0                	call   *%rax
+}
+  8028cd:	48 83 c4 18          	add    $0x18,%rsp
+  8028d1:	5b                   	pop    %rbx
+  8028d2:	41 5c                	pop    %r12
+  8028d4:	41 5d                	pop    %r13
+  8028d6:	5d                   	pop    %rbp
+  8028d7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8028d8:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8028df:	00 00 00 
+  8028e2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8028e8:	89 da                	mov    %ebx,%edx
+  8028ea:	48 bf 90 57 80 00 00 	movabs $0x805790,%rdi
+  8028f1:	00 00 00 
+  8028f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f9:	48 b9 c4 06 80 00 00 	movabs $0x8006c4,%rcx
+  802900:	00 00 00 
+  802903:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802905:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80290a:	eb c1                	jmp    8028cd <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80290c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802911:	eb ba                	jmp    8028cd <ftruncate+0x5e>
+
+0000000000802913 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802913:	55                   	push   %rbp
+  802914:	48 89 e5             	mov    %rsp,%rbp
+  802917:	41 54                	push   %r12
+  802919:	53                   	push   %rbx
+  80291a:	48 83 ec 10          	sub    $0x10,%rsp
+  80291e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802921:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802925:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  80292c:	00 00 00 
+  80292f:	ff d0                	call   *%rax
+  802931:	85 c0                	test   %eax,%eax
+  802933:	78 4e                	js     802983 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802935:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802939:	41 8b 3c 24          	mov    (%r12),%edi
+  80293d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802941:	48 b8 99 23 80 00 00 	movabs $0x802399,%rax
+  802948:	00 00 00 
+  80294b:	ff d0                	call   *%rax
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	78 32                	js     802983 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802951:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802955:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80295a:	74 30                	je     80298c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80295c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80295f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802966:	00 00 00 
+    stat->st_isdir = 0;
+  802969:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802970:	00 00 00 
+    stat->st_dev = dev;
+  802973:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80297a:	48 89 de             	mov    %rbx,%rsi
+  80297d:	4c 89 e7             	mov    %r12,%rdi
+  802980:	ff 50 28             	call   *0x28(%rax)
+}
+  802983:	48 83 c4 10          	add    $0x10,%rsp
+  802987:	5b                   	pop    %rbx
+  802988:	41 5c                	pop    %r12
+  80298a:	5d                   	pop    %rbp
+  80298b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80298c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802991:	eb f0                	jmp    802983 <fstat+0x70>
+
+0000000000802993 <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802993:	55                   	push   %rbp
+  802994:	48 89 e5             	mov    %rsp,%rbp
+  802997:	41 54                	push   %r12
+  802999:	53                   	push   %rbx
+  80299a:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  8029a1:	41 89 fc             	mov    %edi,%r12d
+  8029a4:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029a6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8029aa:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+  8029b6:	85 c0                	test   %eax,%eax
+  8029b8:	78 31                	js     8029eb <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  8029ba:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8029c1:	44 89 e7             	mov    %r12d,%edi
+  8029c4:	48 b8 13 29 80 00 00 	movabs $0x802913,%rax
+  8029cb:	00 00 00 
+  8029ce:	ff d0                	call   *%rax
+  8029d0:	85 c0                	test   %eax,%eax
+  8029d2:	78 17                	js     8029eb <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  8029d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029d8:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  8029db:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8029de:	39 d3                	cmp    %edx,%ebx
+  8029e0:	0f 4f da             	cmovg  %edx,%ebx
+  8029e3:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8029e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029eb:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8029f2:	5b                   	pop    %rbx
+  8029f3:	41 5c                	pop    %r12
+  8029f5:	5d                   	pop    %rbp
+  8029f6:	c3                   	ret
+
+00000000008029f7 <seektoend>:
+{
+  8029f7:	55                   	push   %rbp
+  8029f8:	48 89 e5             	mov    %rsp,%rbp
+  8029fb:	53                   	push   %rbx
+  8029fc:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802a03:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802a05:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802a09:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  802a10:	00 00 00 
+  802a13:	ff d0                	call   *%rax
+  802a15:	85 c0                	test   %eax,%eax
+  802a17:	78 28                	js     802a41 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802a19:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802a20:	89 df                	mov    %ebx,%edi
+  802a22:	48 b8 13 29 80 00 00 	movabs $0x802913,%rax
+  802a29:	00 00 00 
+  802a2c:	ff d0                	call   *%rax
+  802a2e:	85 c0                	test   %eax,%eax
+  802a30:	78 0f                	js     802a41 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802a32:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802a35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a39:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a45:	c9                   	leave
+  802a46:	c3                   	ret
+
+0000000000802a47 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802a47:	55                   	push   %rbp
+  802a48:	48 89 e5             	mov    %rsp,%rbp
+  802a4b:	41 54                	push   %r12
+  802a4d:	53                   	push   %rbx
+  802a4e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802a51:	be 00 00 00 00       	mov    $0x0,%esi
+  802a56:	48 b8 3a 36 80 00 00 	movabs $0x80363a,%rax
+  802a5d:	00 00 00 
+  802a60:	ff d0                	call   *%rax
+  802a62:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802a64:	85 c0                	test   %eax,%eax
+  802a66:	78 25                	js     802a8d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802a68:	4c 89 e6             	mov    %r12,%rsi
+  802a6b:	89 c7                	mov    %eax,%edi
+  802a6d:	48 b8 13 29 80 00 00 	movabs $0x802913,%rax
+  802a74:	00 00 00 
+  802a77:	ff d0                	call   *%rax
+  802a79:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802a7c:	89 df                	mov    %ebx,%edi
+  802a7e:	48 b8 b3 24 80 00 00 	movabs $0x8024b3,%rax
+  802a85:	00 00 00 
+  802a88:	ff d0                	call   *%rax
+
+    return res;
+  802a8a:	44 89 e3             	mov    %r12d,%ebx
+}
+  802a8d:	89 d8                	mov    %ebx,%eax
+  802a8f:	5b                   	pop    %rbx
+  802a90:	41 5c                	pop    %r12
+  802a92:	5d                   	pop    %rbp
+  802a93:	c3                   	ret
+
+0000000000802a94 <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802a94:	55                   	push   %rbp
+  802a95:	48 89 e5             	mov    %rsp,%rbp
+  802a98:	53                   	push   %rbx
+  802a99:	48 83 ec 08          	sub    $0x8,%rsp
+  802a9d:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802aa0:	48 b8 c0 22 80 00 00 	movabs $0x8022c0,%rax
+  802aa7:	00 00 00 
+  802aaa:	ff d0                	call   *%rax
+  802aac:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802ab0:	0f 87 ea 00 00 00    	ja     802ba0 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802ab6:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802abd:	00 00 00 
+  802ac0:	80 38 00             	cmpb   $0x0,(%rax)
+  802ac3:	75 35                	jne    802afa <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802ac5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802aca:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802acf:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802ad4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ad9:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  802ae0:	00 00 00 
+  802ae3:	ff d0                	call   *%rax
+  802ae5:	85 c0                	test   %eax,%eax
+  802ae7:	0f 88 ba 00 00 00    	js     802ba7 <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802aed:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802af4:	00 00 00 
+  802af7:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802afa:	48 89 df             	mov    %rbx,%rdi
+  802afd:	48 b8 c0 22 80 00 00 	movabs $0x8022c0,%rax
+  802b04:	00 00 00 
+  802b07:	ff d0                	call   *%rax
+  802b09:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802b0d:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802b14:	00 00 00 
+  802b17:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802b1b:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802b1e:	39 39                	cmp    %edi,(%rcx)
+  802b20:	74 46                	je     802b68 <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802b22:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802b26:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802b2d:	00 
+  802b2e:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802b35:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802b3c:	00 
+  802b3d:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802b44:	00 
+  802b45:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802b4c:	00 
+  802b4d:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802b54:	00 
+  802b55:	89 39                	mov    %edi,(%rcx)
+  802b57:	48 01 c6             	add    %rax,%rsi
+  802b5a:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802b5f:	48 89 c8             	mov    %rcx,%rax
+  802b62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b66:	c9                   	leave
+  802b67:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802b68:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802b6c:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802b73:	00 00 00 
+  802b76:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802b79:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802b7d:	74 e0                	je     802b5f <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802b7f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802b86:	00 
+  802b87:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802b8b:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802b92:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802b94:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802b97:	48 01 c2             	add    %rax,%rdx
+  802b9a:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802b9e:	eb bf                	jmp    802b5f <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802ba0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ba5:	eb b8                	jmp    802b5f <fbuf_get+0xcb>
+            return NULL;
+  802ba7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bac:	eb b1                	jmp    802b5f <fbuf_get+0xcb>
+
+0000000000802bae <fsipc_bulk>:
+fsipc_bulk(void) {
+  802bae:	55                   	push   %rbp
+  802baf:	48 89 e5             	mov    %rsp,%rbp
+  802bb2:	53                   	push   %rbx
+  802bb3:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802bb7:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802bbe:	00 00 00 
+  802bc1:	48 8b 18             	mov    (%rax),%rbx
+  802bc4:	48 85 db             	test   %rbx,%rbx
+  802bc7:	74 16                	je     802bdf <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802bc9:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802bd0:	00 00 00 
+  802bd3:	48 8b 18             	mov    (%rax),%rbx
+}
+  802bd6:	48 89 d8             	mov    %rbx,%rax
+  802bd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bdd:	c9                   	leave
+  802bde:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802bdf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802be4:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802be9:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802bee:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf3:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  802bfa:	00 00 00 
+  802bfd:	ff d0                	call   *%rax
+  802bff:	85 c0                	test   %eax,%eax
+  802c01:	78 d3                	js     802bd6 <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802c03:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802c08:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802c0f:	00 00 00 
+  802c12:	eb b5                	jmp    802bc9 <fsipc_bulk+0x1b>
+
+0000000000802c14 <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802c14:	55                   	push   %rbp
+  802c15:	48 89 e5             	mov    %rsp,%rbp
+  802c18:	41 57                	push   %r15
+  802c1a:	41 56                	push   %r14
+  802c1c:	41 55                	push   %r13
+  802c1e:	41 54                	push   %r12
+  802c20:	53                   	push   %rbx
+  802c21:	48 83 ec 08          	sub    $0x8,%rsp
+  802c25:	41 89 fd             	mov    %edi,%r13d
+  802c28:	49 89 f6             	mov    %rsi,%r14
+  802c2b:	49 89 d7             	mov    %rdx,%r15
+  802c2e:	48 89 cb             	mov    %rcx,%rbx
+  802c31:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c34:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802c3b:	00 00 00 
+  802c3e:	83 38 00             	cmpl   $0x0,(%rax)
+  802c41:	74 52                	je     802c95 <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802c43:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c49:	4c 89 f9             	mov    %r15,%rcx
+  802c4c:	4c 89 f2             	mov    %r14,%rdx
+  802c4f:	44 89 ee             	mov    %r13d,%esi
+  802c52:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802c59:	00 00 00 
+  802c5c:	8b 38                	mov    (%rax),%edi
+  802c5e:	48 b8 b2 47 80 00 00 	movabs $0x8047b2,%rax
+  802c65:	00 00 00 
+  802c68:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802c6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c6f:	4c 89 e2             	mov    %r12,%rdx
+  802c72:	48 89 de             	mov    %rbx,%rsi
+  802c75:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c7a:	48 b8 02 46 80 00 00 	movabs $0x804602,%rax
+  802c81:	00 00 00 
+  802c84:	ff d0                	call   *%rax
+}
+  802c86:	48 83 c4 08          	add    $0x8,%rsp
+  802c8a:	5b                   	pop    %rbx
+  802c8b:	41 5c                	pop    %r12
+  802c8d:	41 5d                	pop    %r13
+  802c8f:	41 5e                	pop    %r14
+  802c91:	41 5f                	pop    %r15
+  802c93:	5d                   	pop    %rbp
+  802c94:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c95:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c9a:	48 b8 55 48 80 00 00 	movabs $0x804855,%rax
+  802ca1:	00 00 00 
+  802ca4:	ff d0                	call   *%rax
+  802ca6:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802cad:	00 00 
+  802caf:	eb 92                	jmp    802c43 <fsipc_region+0x2f>
+
+0000000000802cb1 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802cb1:	55                   	push   %rbp
+  802cb2:	48 89 e5             	mov    %rsp,%rbp
+  802cb5:	41 57                	push   %r15
+  802cb7:	41 56                	push   %r14
+  802cb9:	41 55                	push   %r13
+  802cbb:	41 54                	push   %r12
+  802cbd:	53                   	push   %rbx
+  802cbe:	48 83 ec 28          	sub    $0x28,%rsp
+  802cc2:	49 89 ff             	mov    %rdi,%r15
+  802cc5:	49 89 f6             	mov    %rsi,%r14
+  802cc8:	48 89 d3             	mov    %rdx,%rbx
+  802ccb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802ccf:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802cd2:	48 b8 ae 2b 80 00 00 	movabs $0x802bae,%rax
+  802cd9:	00 00 00 
+  802cdc:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802cde:	48 85 c0             	test   %rax,%rax
+  802ce1:	0f 84 cc 00 00 00    	je     802db3 <devfile_write_direct+0x102>
+  802ce7:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802cea:	48 85 db             	test   %rbx,%rbx
+  802ced:	0f 84 ba 00 00 00    	je     802dad <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802cf3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802cf9:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802d00:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802d04:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802d08:	4c 29 e3             	sub    %r12,%rbx
+  802d0b:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802d10:	48 39 c3             	cmp    %rax,%rbx
+  802d13:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802d17:	48 89 da             	mov    %rbx,%rdx
+  802d1a:	4c 89 f6             	mov    %r14,%rsi
+  802d1d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802d21:	48 b8 31 14 80 00 00 	movabs $0x801431,%rax
+  802d28:	00 00 00 
+  802d2b:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802d2d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802d31:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802d35:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802d38:	44 01 e0             	add    %r12d,%eax
+  802d3b:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802d3f:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802d43:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802d4a:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802d51:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802d58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d63:	4c 89 ee             	mov    %r13,%rsi
+  802d66:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d6b:	48 b8 14 2c 80 00 00 	movabs $0x802c14,%rax
+  802d72:	00 00 00 
+  802d75:	ff d0                	call   *%rax
+        if (res < 0)
+  802d77:	85 c0                	test   %eax,%eax
+  802d79:	78 29                	js     802da4 <devfile_write_direct+0xf3>
+        if (res == 0)
+  802d7b:	74 2b                	je     802da8 <devfile_write_direct+0xf7>
+        i += res;
+  802d7d:	48 98                	cltq
+  802d7f:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802d82:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802d85:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d89:	49 39 c4             	cmp    %rax,%r12
+  802d8c:	0f 82 72 ff ff ff    	jb     802d04 <devfile_write_direct+0x53>
+    return i;
+  802d92:	4c 89 e0             	mov    %r12,%rax
+}
+  802d95:	48 83 c4 28          	add    $0x28,%rsp
+  802d99:	5b                   	pop    %rbx
+  802d9a:	41 5c                	pop    %r12
+  802d9c:	41 5d                	pop    %r13
+  802d9e:	41 5e                	pop    %r14
+  802da0:	41 5f                	pop    %r15
+  802da2:	5d                   	pop    %rbp
+  802da3:	c3                   	ret
+            return res;
+  802da4:	48 98                	cltq
+  802da6:	eb ed                	jmp    802d95 <devfile_write_direct+0xe4>
+            return i;
+  802da8:	4c 89 e0             	mov    %r12,%rax
+  802dab:	eb e8                	jmp    802d95 <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802dad:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802db1:	eb df                	jmp    802d92 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802db3:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802dba:	eb d9                	jmp    802d95 <devfile_write_direct+0xe4>
+
+0000000000802dbc <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802dbc:	55                   	push   %rbp
+  802dbd:	48 89 e5             	mov    %rsp,%rbp
+  802dc0:	41 56                	push   %r14
+  802dc2:	41 55                	push   %r13
+  802dc4:	41 54                	push   %r12
+  802dc6:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802dc7:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802dcb:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd4:	4d 39 ee             	cmp    %r13,%r14
+  802dd7:	0f 84 99 00 00 00    	je     802e76 <fbuf_flush+0xba>
+  802ddd:	49 89 fc             	mov    %rdi,%r12
+  802de0:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802de3:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802de6:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802dea:	48 b8 c0 22 80 00 00 	movabs $0x8022c0,%rax
+  802df1:	00 00 00 
+  802df4:	ff d0                	call   *%rax
+  802df6:	48 89 c2             	mov    %rax,%rdx
+  802df9:	48 c1 e2 04          	shl    $0x4,%rdx
+  802dfd:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802e01:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e05:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802e0a:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802e0d:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802e11:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802e18:	00 
+  802e19:	44 89 f1             	mov    %r14d,%ecx
+  802e1c:	4c 89 ea             	mov    %r13,%rdx
+  802e1f:	4c 89 e7             	mov    %r12,%rdi
+  802e22:	48 b8 b1 2c 80 00 00 	movabs $0x802cb1,%rax
+  802e29:	00 00 00 
+  802e2c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e2e:	48 85 c0             	test   %rax,%rax
+  802e31:	78 43                	js     802e76 <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802e33:	4c 39 e8             	cmp    %r13,%rax
+  802e36:	72 47                	jb     802e7f <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802e38:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802e3d:	83 c0 01             	add    $0x1,%eax
+  802e40:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802e45:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802e48:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802e4c:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802e50:	72 0f                	jb     802e61 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802e52:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802e56:	48 39 c2             	cmp    %rax,%rdx
+  802e59:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802e5d:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802e61:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802e68:	00 
+  802e69:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802e70:	00 
+    return 0;
+  802e71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e76:	5b                   	pop    %rbx
+  802e77:	41 5c                	pop    %r12
+  802e79:	41 5d                	pop    %r13
+  802e7b:	41 5e                	pop    %r14
+  802e7d:	5d                   	pop    %rbp
+  802e7e:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802e7f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802e84:	eb f0                	jmp    802e76 <fbuf_flush+0xba>
+
+0000000000802e86 <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802e86:	55                   	push   %rbp
+  802e87:	48 89 e5             	mov    %rsp,%rbp
+  802e8a:	53                   	push   %rbx
+  802e8b:	48 83 ec 08          	sub    $0x8,%rsp
+  802e8f:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802e92:	48 b8 94 2a 80 00 00 	movabs $0x802a94,%rax
+  802e99:	00 00 00 
+  802e9c:	ff d0                	call   *%rax
+  802e9e:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea6:	48 85 f6             	test   %rsi,%rsi
+  802ea9:	74 0f                	je     802eba <devfile_sync+0x34>
+  802eab:	48 89 df             	mov    %rbx,%rdi
+  802eae:	48 b8 bc 2d 80 00 00 	movabs $0x802dbc,%rax
+  802eb5:	00 00 00 
+  802eb8:	ff d0                	call   *%rax
+}
+  802eba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ebe:	c9                   	leave
+  802ebf:	c3                   	ret
+
+0000000000802ec0 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  802ec0:	55                   	push   %rbp
+  802ec1:	48 89 e5             	mov    %rsp,%rbp
+  802ec4:	48 83 ec 10          	sub    $0x10,%rsp
+  802ec8:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  802ecb:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  802ed2:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  802ed3:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  802ed7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802edc:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  802ee3:	00 00 00 
+  802ee6:	48 b8 14 2c 80 00 00 	movabs $0x802c14,%rax
+  802eed:	00 00 00 
+  802ef0:	ff d0                	call   *%rax
+}
+  802ef2:	c9                   	leave
+  802ef3:	c3                   	ret
+
+0000000000802ef4 <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ef4:	55                   	push   %rbp
+  802ef5:	48 89 e5             	mov    %rsp,%rbp
+  802ef8:	41 54                	push   %r12
+  802efa:	53                   	push   %rbx
+  802efb:	48 89 fb             	mov    %rdi,%rbx
+  802efe:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  802f01:	48 b8 86 2e 80 00 00 	movabs $0x802e86,%rax
+  802f08:	00 00 00 
+  802f0b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f0d:	85 c0                	test   %eax,%eax
+  802f0f:	78 63                	js     802f74 <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802f11:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f14:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802f1b:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  802f1d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f22:	bf 05 00 00 00       	mov    $0x5,%edi
+  802f27:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  802f2e:	00 00 00 
+  802f31:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f33:	85 c0                	test   %eax,%eax
+  802f35:	78 3d                	js     802f74 <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802f37:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  802f3e:	00 00 00 
+  802f41:	48 89 de             	mov    %rbx,%rsi
+  802f44:	4c 89 e7             	mov    %r12,%rdi
+  802f47:	48 b8 3c 10 80 00 00 	movabs $0x80103c,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802f53:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  802f59:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  802f60:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802f61:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  802f67:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  802f6e:	00 
+
+    return 0;
+  802f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f74:	5b                   	pop    %rbx
+  802f75:	41 5c                	pop    %r12
+  802f77:	5d                   	pop    %rbp
+  802f78:	c3                   	ret
+
+0000000000802f79 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802f79:	55                   	push   %rbp
+  802f7a:	48 89 e5             	mov    %rsp,%rbp
+  802f7d:	41 54                	push   %r12
+  802f7f:	53                   	push   %rbx
+  802f80:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  802f83:	48 b8 86 2e 80 00 00 	movabs $0x802e86,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+  802f8f:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  802f92:	48 89 df             	mov    %rbx,%rdi
+  802f95:	48 b8 c0 22 80 00 00 	movabs $0x8022c0,%rax
+  802f9c:	00 00 00 
+  802f9f:	ff d0                	call   *%rax
+  802fa1:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802fa5:	76 2e                	jbe    802fd5 <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  802fa7:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802faa:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  802fb1:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  802fb3:	be 00 00 00 00       	mov    $0x0,%esi
+  802fb8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802fbd:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  802fc4:	00 00 00 
+  802fc7:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802fc9:	45 85 e4             	test   %r12d,%r12d
+  802fcc:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802fd0:	5b                   	pop    %rbx
+  802fd1:	41 5c                	pop    %r12
+  802fd3:	5d                   	pop    %rbp
+  802fd4:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  802fd5:	48 89 df             	mov    %rbx,%rdi
+  802fd8:	48 b8 c0 22 80 00 00 	movabs $0x8022c0,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+  802fe4:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802fe8:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  802fef:	00 00 00 
+  802ff2:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  802ff9:	48 89 df             	mov    %rbx,%rdi
+  802ffc:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  803003:	00 00 00 
+  803006:	ff d0                	call   *%rax
+  803008:	48 89 c6             	mov    %rax,%rsi
+  80300b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803010:	bf 00 00 00 00       	mov    $0x0,%edi
+  803015:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  80301c:	00 00 00 
+  80301f:	ff d0                	call   *%rax
+  803021:	eb 84                	jmp    802fa7 <devfile_flush+0x2e>
+
+0000000000803023 <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803023:	55                   	push   %rbp
+  803024:	48 89 e5             	mov    %rsp,%rbp
+  803027:	41 55                	push   %r13
+  803029:	41 54                	push   %r12
+  80302b:	53                   	push   %rbx
+  80302c:	48 83 ec 08          	sub    $0x8,%rsp
+  803030:	48 89 fb             	mov    %rdi,%rbx
+  803033:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  803036:	48 b8 94 2a 80 00 00 	movabs $0x802a94,%rax
+  80303d:	00 00 00 
+  803040:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803042:	48 85 c0             	test   %rax,%rax
+  803045:	74 51                	je     803098 <devfile_trunc+0x75>
+  803047:	49 89 c4             	mov    %rax,%r12
+  80304a:	48 89 c6             	mov    %rax,%rsi
+  80304d:	48 89 df             	mov    %rbx,%rdi
+  803050:	48 b8 bc 2d 80 00 00 	movabs $0x802dbc,%rax
+  803057:	00 00 00 
+  80305a:	ff d0                	call   *%rax
+  80305c:	85 c0                	test   %eax,%eax
+  80305e:	78 2d                	js     80308d <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803060:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  803067:	00 00 00 
+  80306a:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80306d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80306f:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  803073:	be 00 00 00 00       	mov    $0x0,%esi
+  803078:	bf 02 00 00 00       	mov    $0x2,%edi
+  80307d:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  803084:	00 00 00 
+  803087:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803089:	85 c0                	test   %eax,%eax
+  80308b:	79 3e                	jns    8030cb <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  80308d:	48 83 c4 08          	add    $0x8,%rsp
+  803091:	5b                   	pop    %rbx
+  803092:	41 5c                	pop    %r12
+  803094:	41 5d                	pop    %r13
+  803096:	5d                   	pop    %rbp
+  803097:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803098:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  80309f:	00 00 00 
+  8030a2:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8030a5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8030a7:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  8030ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8030b5:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  8030bc:	00 00 00 
+  8030bf:	ff d0                	call   *%rax
+    if (res >= 0) {
+  8030c1:	85 c0                	test   %eax,%eax
+  8030c3:	78 c8                	js     80308d <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  8030c5:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8030c9:	eb c2                	jmp    80308d <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  8030cb:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  8030ce:	8d 51 01             	lea    0x1(%rcx),%edx
+  8030d1:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8030d4:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  8030d9:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  8030e0:	00 00 
+  8030e2:	eb a9                	jmp    80308d <devfile_trunc+0x6a>
+
+00000000008030e4 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8030e4:	55                   	push   %rbp
+  8030e5:	48 89 e5             	mov    %rsp,%rbp
+  8030e8:	41 57                	push   %r15
+  8030ea:	41 56                	push   %r14
+  8030ec:	41 55                	push   %r13
+  8030ee:	41 54                	push   %r12
+  8030f0:	53                   	push   %rbx
+  8030f1:	48 83 ec 28          	sub    $0x28,%rsp
+  8030f5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8030f9:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8030fd:	49 89 d7             	mov    %rdx,%r15
+  803100:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803104:	48 b8 94 2a 80 00 00 	movabs $0x802a94,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+  803110:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  803113:	48 85 c0             	test   %rax,%rax
+  803116:	74 31                	je     803149 <devfile_write+0x65>
+  803118:	4c 89 f8             	mov    %r15,%rax
+  80311b:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  803122:	77 25                	ja     803149 <devfile_write+0x65>
+    size_t i = 0;
+  803124:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  80312a:	48 85 c0             	test   %rax,%rax
+  80312d:	0f 85 64 01 00 00    	jne    803297 <devfile_write+0x1b3>
+    size_t i = 0;
+  803133:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  803137:	4c 89 f8             	mov    %r15,%rax
+}
+  80313a:	48 83 c4 28          	add    $0x28,%rsp
+  80313e:	5b                   	pop    %rbx
+  80313f:	41 5c                	pop    %r12
+  803141:	41 5d                	pop    %r13
+  803143:	41 5e                	pop    %r14
+  803145:	41 5f                	pop    %r15
+  803147:	5d                   	pop    %rbp
+  803148:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803149:	48 85 db             	test   %rbx,%rbx
+  80314c:	74 5b                	je     8031a9 <devfile_write+0xc5>
+  80314e:	48 89 de             	mov    %rbx,%rsi
+  803151:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803155:	48 b8 bc 2d 80 00 00 	movabs $0x802dbc,%rax
+  80315c:	00 00 00 
+  80315f:	ff d0                	call   *%rax
+  803161:	85 c0                	test   %eax,%eax
+  803163:	78 40                	js     8031a5 <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  803165:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803169:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  80316c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803170:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  803174:	48 b8 b1 2c 80 00 00 	movabs $0x802cb1,%rax
+  80317b:	00 00 00 
+  80317e:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  803180:	48 85 c0             	test   %rax,%rax
+  803183:	7e b5                	jle    80313a <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803185:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  803189:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  80318c:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  80318f:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  803192:	8d 51 01             	lea    0x1(%rcx),%edx
+  803195:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803198:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  80319b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8031a2:	00 
+  8031a3:	eb 95                	jmp    80313a <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8031a5:	48 98                	cltq
+  8031a7:	eb 91                	jmp    80313a <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  8031a9:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8031ad:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  8031b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8031b4:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8031b8:	48 89 df             	mov    %rbx,%rdi
+  8031bb:	48 b8 b1 2c 80 00 00 	movabs $0x802cb1,%rax
+  8031c2:	00 00 00 
+  8031c5:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8031c7:	48 85 c0             	test   %rax,%rax
+  8031ca:	0f 8e 6a ff ff ff    	jle    80313a <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8031d0:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  8031d3:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8031d7:	e9 5e ff ff ff       	jmp    80313a <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8031dc:	48 98                	cltq
+  8031de:	4d 85 ff             	test   %r15,%r15
+  8031e1:	49 0f 45 c7          	cmovne %r15,%rax
+  8031e5:	e9 50 ff ff ff       	jmp    80313a <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8031ea:	48 89 de             	mov    %rbx,%rsi
+  8031ed:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8031f1:	48 b8 bc 2d 80 00 00 	movabs $0x802dbc,%rax
+  8031f8:	00 00 00 
+  8031fb:	ff d0                	call   *%rax
+  8031fd:	85 c0                	test   %eax,%eax
+  8031ff:	0f 88 2b 01 00 00    	js     803330 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803205:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803209:	4c 01 f8             	add    %r15,%rax
+  80320c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803210:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803214:	48 b9 c0 22 80 00 00 	movabs $0x8022c0,%rcx
+  80321b:	00 00 00 
+  80321e:	ff d1                	call   *%rcx
+  803220:	48 89 c2             	mov    %rax,%rdx
+  803223:	48 c1 e2 04          	shl    $0x4,%rdx
+  803227:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80322b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80322f:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  803234:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  803237:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  80323e:	00 
+  80323f:	4c 89 ea             	mov    %r13,%rdx
+  803242:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803246:	48 b8 31 14 80 00 00 	movabs $0x801431,%rax
+  80324d:	00 00 00 
+  803250:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803252:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803256:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80325a:	48 39 c2             	cmp    %rax,%rdx
+  80325d:	0f 84 db 00 00 00    	je     80333e <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  803263:	4c 39 e2             	cmp    %r12,%rdx
+  803266:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  80326a:	4d 01 ec             	add    %r13,%r12
+  80326d:	49 39 c4             	cmp    %rax,%r12
+  803270:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  803274:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  803278:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  80327c:	45 01 ee             	add    %r13d,%r14d
+  80327f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803283:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  803287:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  80328a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80328e:	49 39 c7             	cmp    %rax,%r15
+  803291:	0f 83 a0 fe ff ff    	jae    803137 <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  803297:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80329b:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  80329f:	8b 43 08             	mov    0x8(%rbx),%eax
+  8032a2:	44 39 f0             	cmp    %r14d,%eax
+  8032a5:	7f 10                	jg     8032b7 <devfile_write+0x1d3>
+  8032a7:	48 98                	cltq
+  8032a9:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  8032af:	49 63 d6             	movslq %r14d,%rdx
+  8032b2:	48 39 d0             	cmp    %rdx,%rax
+  8032b5:	7d 2d                	jge    8032e4 <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8032b7:	48 89 de             	mov    %rbx,%rsi
+  8032ba:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8032be:	48 b8 bc 2d 80 00 00 	movabs $0x802dbc,%rax
+  8032c5:	00 00 00 
+  8032c8:	ff d0                	call   *%rax
+  8032ca:	85 c0                	test   %eax,%eax
+  8032cc:	0f 88 0a ff ff ff    	js     8031dc <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8032d2:	44 89 f0             	mov    %r14d,%eax
+  8032d5:	66 b8 00 00          	mov    $0x0,%ax
+  8032d9:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  8032dc:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8032e3:	00 
+        size_t off = pos - fb->fb_base;
+  8032e4:	45 89 f4             	mov    %r14d,%r12d
+  8032e7:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  8032eb:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  8032ee:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  8032f2:	4d 29 fd             	sub    %r15,%r13
+  8032f5:	b8 00 00 01 00       	mov    $0x10000,%eax
+  8032fa:	4c 29 e0             	sub    %r12,%rax
+  8032fd:	49 39 c5             	cmp    %rax,%r13
+  803300:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  803304:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  803308:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  80330c:	48 39 c2             	cmp    %rax,%rdx
+  80330f:	0f 84 f0 fe ff ff    	je     803205 <devfile_write+0x121>
+  803315:	4c 39 e0             	cmp    %r12,%rax
+  803318:	0f 82 cc fe ff ff    	jb     8031ea <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  80331e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803322:	48 39 d0             	cmp    %rdx,%rax
+  803325:	0f 83 da fe ff ff    	jae    803205 <devfile_write+0x121>
+  80332b:	e9 ba fe ff ff       	jmp    8031ea <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803330:	48 98                	cltq
+  803332:	4d 85 ff             	test   %r15,%r15
+  803335:	49 0f 45 c7          	cmovne %r15,%rax
+  803339:	e9 fc fd ff ff       	jmp    80313a <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  80333e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803342:	4c 89 e2             	mov    %r12,%rdx
+  803345:	e9 2a ff ff ff       	jmp    803274 <devfile_write+0x190>
+
+000000000080334a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80334a:	55                   	push   %rbp
+  80334b:	48 89 e5             	mov    %rsp,%rbp
+  80334e:	41 57                	push   %r15
+  803350:	41 56                	push   %r14
+  803352:	41 55                	push   %r13
+  803354:	41 54                	push   %r12
+  803356:	53                   	push   %rbx
+  803357:	48 83 ec 28          	sub    $0x28,%rsp
+  80335b:	49 89 ff             	mov    %rdi,%r15
+  80335e:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803362:	48 89 d3             	mov    %rdx,%rbx
+  803365:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  803369:	48 b8 94 2a 80 00 00 	movabs $0x802a94,%rax
+  803370:	00 00 00 
+  803373:	ff d0                	call   *%rax
+  803375:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  803378:	48 85 c0             	test   %rax,%rax
+  80337b:	74 0d                	je     80338a <devfile_read+0x40>
+  80337d:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  803384:	0f 86 1a 01 00 00    	jbe    8034a4 <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  80338a:	4d 85 e4             	test   %r12,%r12
+  80338d:	74 1a                	je     8033a9 <devfile_read+0x5f>
+  80338f:	4c 89 e6             	mov    %r12,%rsi
+  803392:	4c 89 ff             	mov    %r15,%rdi
+  803395:	48 b8 bc 2d 80 00 00 	movabs $0x802dbc,%rax
+  80339c:	00 00 00 
+  80339f:	ff d0                	call   *%rax
+  8033a1:	85 c0                	test   %eax,%eax
+  8033a3:	0f 88 e8 00 00 00    	js     803491 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8033a9:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8033ad:	48 b8 ae 2b 80 00 00 	movabs $0x802bae,%rax
+  8033b4:	00 00 00 
+  8033b7:	ff d0                	call   *%rax
+  8033b9:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  8033bc:	48 85 c0             	test   %rax,%rax
+  8033bf:	0f 84 69 02 00 00    	je     80362e <devfile_read+0x2e4>
+    while (i < n) {
+  8033c5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8033ca:	0f 84 ce 00 00 00    	je     80349e <devfile_read+0x154>
+    size_t i = 0;
+  8033d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  8033d5:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  8033dc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8033e0:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  8033e4:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  8033e8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8033ec:	48 29 da             	sub    %rbx,%rdx
+  8033ef:	b8 00 00 04 00       	mov    $0x40000,%eax
+  8033f4:	48 39 c2             	cmp    %rax,%rdx
+  8033f7:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  8033fb:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8033ff:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  803403:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803406:	01 d8                	add    %ebx,%eax
+  803408:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  80340c:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803410:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  803417:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  80341e:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  803425:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80342b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803430:	4c 89 ee             	mov    %r13,%rsi
+  803433:	bf 03 00 00 00       	mov    $0x3,%edi
+  803438:	48 b8 14 2c 80 00 00 	movabs $0x802c14,%rax
+  80343f:	00 00 00 
+  803442:	ff d0                	call   *%rax
+        if (res < 0)
+  803444:	85 c0                	test   %eax,%eax
+  803446:	78 4d                	js     803495 <devfile_read+0x14b>
+        if (res == 0)
+  803448:	74 4f                	je     803499 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80344a:	4c 63 e0             	movslq %eax,%r12
+  80344d:	4c 89 e2             	mov    %r12,%rdx
+  803450:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803454:	4c 89 f7             	mov    %r14,%rdi
+  803457:	48 b8 31 14 80 00 00 	movabs $0x801431,%rax
+  80345e:	00 00 00 
+  803461:	ff d0                	call   *%rax
+        i += res;
+  803463:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  803466:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  803469:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80346d:	48 39 c3             	cmp    %rax,%rbx
+  803470:	0f 82 72 ff ff ff    	jb     8033e8 <devfile_read+0x9e>
+    return i;
+  803476:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803479:	48 85 c0             	test   %rax,%rax
+  80347c:	7e 04                	jle    803482 <devfile_read+0x138>
+  80347e:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  803482:	48 83 c4 28          	add    $0x28,%rsp
+  803486:	5b                   	pop    %rbx
+  803487:	41 5c                	pop    %r12
+  803489:	41 5d                	pop    %r13
+  80348b:	41 5e                	pop    %r14
+  80348d:	41 5f                	pop    %r15
+  80348f:	5d                   	pop    %rbp
+  803490:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803491:	48 98                	cltq
+  803493:	eb ed                	jmp    803482 <devfile_read+0x138>
+            return res;
+  803495:	48 98                	cltq
+  803497:	eb e9                	jmp    803482 <devfile_read+0x138>
+            return i;
+  803499:	48 89 d8             	mov    %rbx,%rax
+  80349c:	eb db                	jmp    803479 <devfile_read+0x12f>
+    size_t i = 0;
+  80349e:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8034a2:	eb d2                	jmp    803476 <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8034a4:	48 89 c6             	mov    %rax,%rsi
+  8034a7:	4c 89 ff             	mov    %r15,%rdi
+  8034aa:	48 b8 bc 2d 80 00 00 	movabs $0x802dbc,%rax
+  8034b1:	00 00 00 
+  8034b4:	ff d0                	call   *%rax
+  8034b6:	85 c0                	test   %eax,%eax
+  8034b8:	78 40                	js     8034fa <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8034ba:	4c 89 ff             	mov    %r15,%rdi
+  8034bd:	48 b8 c0 22 80 00 00 	movabs $0x8022c0,%rax
+  8034c4:	00 00 00 
+  8034c7:	ff d0                	call   *%rax
+  8034c9:	48 89 c2             	mov    %rax,%rdx
+  8034cc:	48 c1 e2 04          	shl    $0x4,%rdx
+  8034d0:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8034d4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8034d8:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  8034dd:	48 01 d0             	add    %rdx,%rax
+  8034e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  8034e4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8034e9:	0f 84 33 01 00 00    	je     803622 <devfile_read+0x2d8>
+    size_t i = 0;
+  8034ef:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8034f5:	e9 f5 00 00 00       	jmp    8035ef <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8034fa:	48 98                	cltq
+  8034fc:	eb 84                	jmp    803482 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  8034fe:	44 89 e8             	mov    %r13d,%eax
+  803501:	66 b8 00 00          	mov    $0x0,%ax
+  803505:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  80350a:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803511:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  803513:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803517:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80351b:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  80351d:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803522:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  803525:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  80352c:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  80352d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803533:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803538:	ba 00 10 01 00       	mov    $0x11000,%edx
+  80353d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803542:	48 b8 14 2c 80 00 00 	movabs $0x802c14,%rax
+  803549:	00 00 00 
+  80354c:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  80354e:	85 c0                	test   %eax,%eax
+  803550:	0f 88 be 00 00 00    	js     803614 <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  803556:	48 63 d0             	movslq %eax,%rdx
+  803559:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  80355e:	41 03 44 24 08       	add    0x8(%r12),%eax
+  803563:	44 39 e8             	cmp    %r13d,%eax
+  803566:	0f 8e ba 00 00 00    	jle    803626 <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  80356c:	49 63 c5             	movslq %r13d,%rax
+  80356f:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  803574:	48 29 c3             	sub    %rax,%rbx
+  803577:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  80357c:	48 01 c3             	add    %rax,%rbx
+  80357f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803583:	4c 29 f0             	sub    %r14,%rax
+  803586:	48 39 c3             	cmp    %rax,%rbx
+  803589:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  80358d:	4c 89 ff             	mov    %r15,%rdi
+  803590:	48 b9 c0 22 80 00 00 	movabs $0x8022c0,%rcx
+  803597:	00 00 00 
+  80359a:	ff d1                	call   *%rcx
+  80359c:	48 89 c2             	mov    %rax,%rdx
+  80359f:	48 c1 e2 04          	shl    $0x4,%rdx
+  8035a3:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8035a7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8035ab:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8035b0:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8035b3:	44 89 ea             	mov    %r13d,%edx
+  8035b6:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  8035bb:	48 63 d2             	movslq %edx,%rdx
+  8035be:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  8035c5:	00 
+  8035c6:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8035ca:	4c 01 f7             	add    %r14,%rdi
+  8035cd:	48 89 da             	mov    %rbx,%rdx
+  8035d0:	48 b9 31 14 80 00 00 	movabs $0x801431,%rcx
+  8035d7:	00 00 00 
+  8035da:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  8035dc:	41 01 dd             	add    %ebx,%r13d
+  8035df:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  8035e3:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  8035e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035ea:	49 39 c6             	cmp    %rax,%r14
+  8035ed:	73 37                	jae    803626 <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  8035ef:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  8035f3:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  8035f8:	44 39 e8             	cmp    %r13d,%eax
+  8035fb:	0f 8f fd fe ff ff    	jg     8034fe <devfile_read+0x1b4>
+  803601:	41 03 44 24 10       	add    0x10(%r12),%eax
+  803606:	44 39 e8             	cmp    %r13d,%eax
+  803609:	0f 8f 5d ff ff ff    	jg     80356c <devfile_read+0x222>
+  80360f:	e9 ea fe ff ff       	jmp    8034fe <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  803614:	48 98                	cltq
+  803616:	4d 85 f6             	test   %r14,%r14
+  803619:	49 0f 45 c6          	cmovne %r14,%rax
+  80361d:	e9 60 fe ff ff       	jmp    803482 <devfile_read+0x138>
+    size_t i = 0;
+  803622:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  803626:	4c 89 f0             	mov    %r14,%rax
+  803629:	e9 54 fe ff ff       	jmp    803482 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  80362e:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  803635:	e9 48 fe ff ff       	jmp    803482 <devfile_read+0x138>
+
+000000000080363a <open>:
+open(const char *path, int mode) {
+  80363a:	55                   	push   %rbp
+  80363b:	48 89 e5             	mov    %rsp,%rbp
+  80363e:	41 55                	push   %r13
+  803640:	41 54                	push   %r12
+  803642:	53                   	push   %rbx
+  803643:	48 83 ec 18          	sub    $0x18,%rsp
+  803647:	49 89 fc             	mov    %rdi,%r12
+  80364a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80364d:	48 b8 fe 0f 80 00 00 	movabs $0x800ffe,%rax
+  803654:	00 00 00 
+  803657:	ff d0                	call   *%rax
+  803659:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80365f:	0f 87 8a 00 00 00    	ja     8036ef <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803665:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803669:	48 b8 ee 22 80 00 00 	movabs $0x8022ee,%rax
+  803670:	00 00 00 
+  803673:	ff d0                	call   *%rax
+  803675:	89 c3                	mov    %eax,%ebx
+  803677:	85 c0                	test   %eax,%eax
+  803679:	78 50                	js     8036cb <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80367b:	4c 89 e6             	mov    %r12,%rsi
+  80367e:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803685:	00 00 00 
+  803688:	48 89 df             	mov    %rbx,%rdi
+  80368b:	48 b8 3c 10 80 00 00 	movabs $0x80103c,%rax
+  803692:	00 00 00 
+  803695:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803697:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80369e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8036a2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8036a7:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  8036ae:	00 00 00 
+  8036b1:	ff d0                	call   *%rax
+  8036b3:	89 c3                	mov    %eax,%ebx
+  8036b5:	85 c0                	test   %eax,%eax
+  8036b7:	78 1f                	js     8036d8 <open+0x9e>
+    return fd2num(fd);
+  8036b9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036bd:	48 b8 c0 22 80 00 00 	movabs $0x8022c0,%rax
+  8036c4:	00 00 00 
+  8036c7:	ff d0                	call   *%rax
+  8036c9:	89 c3                	mov    %eax,%ebx
+}
+  8036cb:	89 d8                	mov    %ebx,%eax
+  8036cd:	48 83 c4 18          	add    $0x18,%rsp
+  8036d1:	5b                   	pop    %rbx
+  8036d2:	41 5c                	pop    %r12
+  8036d4:	41 5d                	pop    %r13
+  8036d6:	5d                   	pop    %rbp
+  8036d7:	c3                   	ret
+        fd_close(fd, 0);
+  8036d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8036dd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036e1:	48 b8 09 24 80 00 00 	movabs $0x802409,%rax
+  8036e8:	00 00 00 
+  8036eb:	ff d0                	call   *%rax
+        return res;
+  8036ed:	eb dc                	jmp    8036cb <open+0x91>
+        return -E_BAD_PATH;
+  8036ef:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8036f4:	eb d5                	jmp    8036cb <open+0x91>
+
+00000000008036f6 <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  8036f6:	55                   	push   %rbp
+  8036f7:	48 89 e5             	mov    %rsp,%rbp
+  8036fa:	41 57                	push   %r15
+  8036fc:	41 56                	push   %r14
+  8036fe:	41 55                	push   %r13
+  803700:	41 54                	push   %r12
+  803702:	53                   	push   %rbx
+  803703:	48 83 ec 18          	sub    $0x18,%rsp
+  803707:	41 89 f6             	mov    %esi,%r14d
+  80370a:	49 89 d7             	mov    %rdx,%r15
+  80370d:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803710:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803714:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  80371b:	00 00 00 
+  80371e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803720:	85 c0                	test   %eax,%eax
+  803722:	0f 88 db 00 00 00    	js     803803 <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803728:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80372c:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803733:	00 00 00 
+  803736:	8b 00                	mov    (%rax),%eax
+  803738:	39 07                	cmp    %eax,(%rdi)
+  80373a:	0f 85 db 00 00 00    	jne    80381b <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803740:	45 85 f6             	test   %r14d,%r14d
+  803743:	0f 88 db 00 00 00    	js     803824 <fmap+0x12e>
+  803749:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803750:	0f 85 d7 00 00 00    	jne    80382d <fmap+0x137>
+  803756:	4c 89 fb             	mov    %r15,%rbx
+  803759:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80375f:	0f 85 d1 00 00 00    	jne    803836 <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803765:	48 b8 86 2e 80 00 00 	movabs $0x802e86,%rax
+  80376c:	00 00 00 
+  80376f:	ff d0                	call   *%rax
+  803771:	85 c0                	test   %eax,%eax
+  803773:	0f 88 8e 00 00 00    	js     803807 <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803779:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  803780:	00 00 00 
+    while (i < n) {
+  803783:	4d 85 ed             	test   %r13,%r13
+  803786:	0f 84 8a 00 00 00    	je     803816 <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  80378c:	4c 89 ea             	mov    %r13,%rdx
+  80378f:	48 29 da             	sub    %rbx,%rdx
+  803792:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  803799:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80379f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8037a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037a7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037aa:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8037ae:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8037b2:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8037b7:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  8037bc:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8037c0:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  8037c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037c9:	4c 89 e6             	mov    %r12,%rsi
+  8037cc:	bf 09 00 00 00       	mov    $0x9,%edi
+  8037d1:	48 b8 14 2c 80 00 00 	movabs $0x802c14,%rax
+  8037d8:	00 00 00 
+  8037db:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  8037dd:	85 c0                	test   %eax,%eax
+  8037df:	78 2a                	js     80380b <fmap+0x115>
+        i += res;
+  8037e1:	48 98                	cltq
+  8037e3:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  8037e6:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8037ea:	72 05                	jb     8037f1 <fmap+0xfb>
+    while (i < n) {
+  8037ec:	4c 39 eb             	cmp    %r13,%rbx
+  8037ef:	72 9b                	jb     80378c <fmap+0x96>
+    }
+    return i;
+  8037f1:	48 89 d8             	mov    %rbx,%rax
+}
+  8037f4:	48 83 c4 18          	add    $0x18,%rsp
+  8037f8:	5b                   	pop    %rbx
+  8037f9:	41 5c                	pop    %r12
+  8037fb:	41 5d                	pop    %r13
+  8037fd:	41 5e                	pop    %r14
+  8037ff:	41 5f                	pop    %r15
+  803801:	5d                   	pop    %rbp
+  803802:	c3                   	ret
+    if (res < 0) return res;
+  803803:	48 98                	cltq
+  803805:	eb ed                	jmp    8037f4 <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803807:	48 98                	cltq
+  803809:	eb e9                	jmp    8037f4 <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  80380b:	48 98                	cltq
+  80380d:	48 85 db             	test   %rbx,%rbx
+  803810:	48 0f 45 c3          	cmovne %rbx,%rax
+  803814:	eb de                	jmp    8037f4 <fmap+0xfe>
+    size_t i = 0;
+  803816:	4c 89 eb             	mov    %r13,%rbx
+  803819:	eb d6                	jmp    8037f1 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80381b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803822:	eb d0                	jmp    8037f4 <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803824:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80382b:	eb c7                	jmp    8037f4 <fmap+0xfe>
+  80382d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803834:	eb be                	jmp    8037f4 <fmap+0xfe>
+  803836:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80383d:	eb b5                	jmp    8037f4 <fmap+0xfe>
+
+000000000080383f <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  80383f:	55                   	push   %rbp
+  803840:	48 89 e5             	mov    %rsp,%rbp
+  803843:	41 56                	push   %r14
+  803845:	41 55                	push   %r13
+  803847:	41 54                	push   %r12
+  803849:	53                   	push   %rbx
+  80384a:	48 83 ec 10          	sub    $0x10,%rsp
+  80384e:	89 fb                	mov    %edi,%ebx
+  803850:	41 89 f4             	mov    %esi,%r12d
+  803853:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803856:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80385a:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  803861:	00 00 00 
+  803864:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803866:	85 c0                	test   %eax,%eax
+  803868:	78 63                	js     8038cd <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  80386a:	45 85 e4             	test   %r12d,%r12d
+  80386d:	0f 88 80 00 00 00    	js     8038f3 <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  803873:	45 89 e6             	mov    %r12d,%r14d
+  803876:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  80387d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803881:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  803888:	00 00 00 
+  80388b:	ff d0                	call   *%rax
+  80388d:	48 89 c2             	mov    %rax,%rdx
+  803890:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803895:	44 89 f6             	mov    %r14d,%esi
+  803898:	89 df                	mov    %ebx,%edi
+  80389a:	48 b8 f6 36 80 00 00 	movabs $0x8036f6,%rax
+  8038a1:	00 00 00 
+  8038a4:	ff d0                	call   *%rax
+  8038a6:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8038a9:	45 29 f4             	sub    %r14d,%r12d
+  8038ac:	4d 63 f4             	movslq %r12d,%r14
+  8038af:	49 39 c6             	cmp    %rax,%r14
+  8038b2:	7c 1d                	jl     8038d1 <read_map+0x92>
+  8038b4:	48 85 c0             	test   %rax,%rax
+  8038b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038bc:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  8038c0:	48 83 c4 10          	add    $0x10,%rsp
+  8038c4:	5b                   	pop    %rbx
+  8038c5:	41 5c                	pop    %r12
+  8038c7:	41 5d                	pop    %r13
+  8038c9:	41 5e                	pop    %r14
+  8038cb:	5d                   	pop    %rbp
+  8038cc:	c3                   	ret
+    if (res < 0) return res;
+  8038cd:	48 98                	cltq
+  8038cf:	eb ef                	jmp    8038c0 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  8038d1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8038d5:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8038dc:	00 00 00 
+  8038df:	ff d0                	call   *%rax
+  8038e1:	4d 63 e4             	movslq %r12d,%r12
+  8038e4:	4c 01 e0             	add    %r12,%rax
+  8038e7:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  8038eb:	48 89 d8             	mov    %rbx,%rax
+  8038ee:	4c 29 f0             	sub    %r14,%rax
+  8038f1:	eb cd                	jmp    8038c0 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  8038f3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8038fa:	eb c4                	jmp    8038c0 <read_map+0x81>
+
+00000000008038fc <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  8038fc:	55                   	push   %rbp
+  8038fd:	48 89 e5             	mov    %rsp,%rbp
+  803900:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803904:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803908:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  80390f:	00 00 00 
+  803912:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803914:	85 c0                	test   %eax,%eax
+  803916:	78 4a                	js     803962 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803918:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80391c:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803923:	00 00 00 
+  803926:	8b 00                	mov    (%rax),%eax
+  803928:	39 07                	cmp    %eax,(%rdi)
+  80392a:	75 38                	jne    803964 <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80392c:	48 b8 86 2e 80 00 00 	movabs $0x802e86,%rax
+  803933:	00 00 00 
+  803936:	ff d0                	call   *%rax
+  803938:	85 c0                	test   %eax,%eax
+  80393a:	78 26                	js     803962 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80393c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803940:	8b 40 0c             	mov    0xc(%rax),%eax
+  803943:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  80394a:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80394c:	be 00 00 00 00       	mov    $0x0,%esi
+  803951:	bf 06 00 00 00       	mov    $0x6,%edi
+  803956:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  80395d:	00 00 00 
+  803960:	ff d0                	call   *%rax
+}
+  803962:	c9                   	leave
+  803963:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803964:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803969:	eb f7                	jmp    803962 <fsync+0x66>
+
+000000000080396b <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  80396b:	55                   	push   %rbp
+  80396c:	48 89 e5             	mov    %rsp,%rbp
+  80396f:	41 57                	push   %r15
+  803971:	41 56                	push   %r14
+  803973:	41 55                	push   %r13
+  803975:	41 54                	push   %r12
+  803977:	53                   	push   %rbx
+  803978:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  80397c:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803983:	00 00 00 
+  803986:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  80398b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803991:	49 bd 4e 23 80 00 00 	movabs $0x80234e,%r13
+  803998:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  80399b:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  8039a2:	00 00 00 
+  8039a5:	eb 0c                	jmp    8039b3 <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  8039a7:	83 c3 01             	add    $0x1,%ebx
+  8039aa:	49 83 c4 28          	add    $0x28,%r12
+  8039ae:	83 fb 20             	cmp    $0x20,%ebx
+  8039b1:	74 33                	je     8039e6 <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8039b3:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8039b8:	74 ed                	je     8039a7 <flushall+0x3c>
+  8039ba:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8039be:	89 df                	mov    %ebx,%edi
+  8039c0:	41 ff d5             	call   *%r13
+  8039c3:	85 c0                	test   %eax,%eax
+  8039c5:	78 e0                	js     8039a7 <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  8039c7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  8039cb:	41 8b 06             	mov    (%r14),%eax
+  8039ce:	39 07                	cmp    %eax,(%rdi)
+  8039d0:	75 d5                	jne    8039a7 <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  8039d2:	48 b8 86 2e 80 00 00 	movabs $0x802e86,%rax
+  8039d9:	00 00 00 
+  8039dc:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  8039de:	85 c0                	test   %eax,%eax
+  8039e0:	44 0f 48 f8          	cmovs  %eax,%r15d
+  8039e4:	eb c1                	jmp    8039a7 <flushall+0x3c>
+    }
+    return res;
+}
+  8039e6:	44 89 f8             	mov    %r15d,%eax
+  8039e9:	48 83 c4 18          	add    $0x18,%rsp
+  8039ed:	5b                   	pop    %rbx
+  8039ee:	41 5c                	pop    %r12
+  8039f0:	41 5d                	pop    %r13
+  8039f2:	41 5e                	pop    %r14
+  8039f4:	41 5f                	pop    %r15
+  8039f6:	5d                   	pop    %rbp
+  8039f7:	c3                   	ret
+
+00000000008039f8 <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  8039f8:	55                   	push   %rbp
+  8039f9:	48 89 e5             	mov    %rsp,%rbp
+  8039fc:	53                   	push   %rbx
+  8039fd:	48 83 ec 08          	sub    $0x8,%rsp
+  803a01:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803a04:	40 0f b6 c6          	movzbl %sil,%eax
+  803a08:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803a0f:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803a11:	be 00 00 00 00       	mov    $0x0,%esi
+  803a16:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803a1b:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  803a22:	00 00 00 
+  803a25:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a27:	85 c0                	test   %eax,%eax
+  803a29:	78 23                	js     803a4e <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803a2b:	ba 58 06 00 00       	mov    $0x658,%edx
+  803a30:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803a37:	00 00 00 
+  803a3a:	48 89 df             	mov    %rbx,%rdi
+  803a3d:	48 b8 31 14 80 00 00 	movabs $0x801431,%rax
+  803a44:	00 00 00 
+  803a47:	ff d0                	call   *%rax
+    return 0;
+  803a49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a4e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a52:	c9                   	leave
+  803a53:	c3                   	ret
+
+0000000000803a54 <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803a54:	55                   	push   %rbp
+  803a55:	48 89 e5             	mov    %rsp,%rbp
+  803a58:	53                   	push   %rbx
+  803a59:	48 83 ec 08          	sub    $0x8,%rsp
+  803a5d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803a60:	48 b8 fe 0f 80 00 00 	movabs $0x800ffe,%rax
+  803a67:	00 00 00 
+  803a6a:	ff d0                	call   *%rax
+  803a6c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803a72:	77 35                	ja     803aa9 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803a74:	48 89 de             	mov    %rbx,%rsi
+  803a77:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803a7e:	00 00 00 
+  803a81:	48 b8 3c 10 80 00 00 	movabs $0x80103c,%rax
+  803a88:	00 00 00 
+  803a8b:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803a8d:	be 00 00 00 00       	mov    $0x0,%esi
+  803a92:	bf 07 00 00 00       	mov    $0x7,%edi
+  803a97:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  803a9e:	00 00 00 
+  803aa1:	ff d0                	call   *%rax
+}
+  803aa3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803aa7:	c9                   	leave
+  803aa8:	c3                   	ret
+        return -E_BAD_PATH;
+  803aa9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803aae:	eb f3                	jmp    803aa3 <remove+0x4f>
+
+0000000000803ab0 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803ab0:	55                   	push   %rbp
+  803ab1:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803ab4:	48 b8 6b 39 80 00 00 	movabs $0x80396b,%rax
+  803abb:	00 00 00 
+  803abe:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803ac0:	be 00 00 00 00       	mov    $0x0,%esi
+  803ac5:	bf 08 00 00 00       	mov    $0x8,%edi
+  803aca:	48 b8 c0 2e 80 00 00 	movabs $0x802ec0,%rax
+  803ad1:	00 00 00 
+  803ad4:	ff d0                	call   *%rax
+}
+  803ad6:	5d                   	pop    %rbp
+  803ad7:	c3                   	ret
+
+0000000000803ad8 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803ad8:	55                   	push   %rbp
+  803ad9:	48 89 e5             	mov    %rsp,%rbp
+  803adc:	41 54                	push   %r12
+  803ade:	53                   	push   %rbx
+  803adf:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ae2:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  803ae9:	00 00 00 
+  803aec:	ff d0                	call   *%rax
+  803aee:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803af1:	48 be 20 58 80 00 00 	movabs $0x805820,%rsi
+  803af8:	00 00 00 
+  803afb:	48 89 df             	mov    %rbx,%rdi
+  803afe:	48 b8 3c 10 80 00 00 	movabs $0x80103c,%rax
+  803b05:	00 00 00 
+  803b08:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803b0a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803b0f:	41 2b 04 24          	sub    (%r12),%eax
+  803b13:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803b19:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803b20:	00 00 00 
+    stat->st_dev = &devpipe;
+  803b23:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803b2a:	00 00 00 
+  803b2d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803b34:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b39:	5b                   	pop    %rbx
+  803b3a:	41 5c                	pop    %r12
+  803b3c:	5d                   	pop    %rbp
+  803b3d:	c3                   	ret
+
+0000000000803b3e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803b3e:	55                   	push   %rbp
+  803b3f:	48 89 e5             	mov    %rsp,%rbp
+  803b42:	41 54                	push   %r12
+  803b44:	53                   	push   %rbx
+  803b45:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803b48:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b4d:	48 89 fe             	mov    %rdi,%rsi
+  803b50:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b55:	49 bc 7b 19 80 00 00 	movabs $0x80197b,%r12
+  803b5c:	00 00 00 
+  803b5f:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803b62:	48 89 df             	mov    %rbx,%rdi
+  803b65:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  803b6c:	00 00 00 
+  803b6f:	ff d0                	call   *%rax
+  803b71:	48 89 c6             	mov    %rax,%rsi
+  803b74:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b79:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b7e:	41 ff d4             	call   *%r12
+}
+  803b81:	5b                   	pop    %rbx
+  803b82:	41 5c                	pop    %r12
+  803b84:	5d                   	pop    %rbp
+  803b85:	c3                   	ret
+
+0000000000803b86 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b86:	55                   	push   %rbp
+  803b87:	48 89 e5             	mov    %rsp,%rbp
+  803b8a:	41 57                	push   %r15
+  803b8c:	41 56                	push   %r14
+  803b8e:	41 55                	push   %r13
+  803b90:	41 54                	push   %r12
+  803b92:	53                   	push   %rbx
+  803b93:	48 83 ec 18          	sub    $0x18,%rsp
+  803b97:	49 89 fc             	mov    %rdi,%r12
+  803b9a:	49 89 f5             	mov    %rsi,%r13
+  803b9d:	49 89 d7             	mov    %rdx,%r15
+  803ba0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ba4:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  803bab:	00 00 00 
+  803bae:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803bb0:	4d 85 ff             	test   %r15,%r15
+  803bb3:	0f 84 af 00 00 00    	je     803c68 <devpipe_write+0xe2>
+  803bb9:	48 89 c3             	mov    %rax,%rbx
+  803bbc:	4c 89 f8             	mov    %r15,%rax
+  803bbf:	4d 89 ef             	mov    %r13,%r15
+  803bc2:	4c 01 e8             	add    %r13,%rax
+  803bc5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803bc9:	49 bd 70 17 80 00 00 	movabs $0x801770,%r13
+  803bd0:	00 00 00 
+            sys_yield();
+  803bd3:	49 be 0d 17 80 00 00 	movabs $0x80170d,%r14
+  803bda:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803bdd:	8b 73 04             	mov    0x4(%rbx),%esi
+  803be0:	48 63 ce             	movslq %esi,%rcx
+  803be3:	48 63 03             	movslq (%rbx),%rax
+  803be6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803bec:	48 39 c1             	cmp    %rax,%rcx
+  803bef:	72 2e                	jb     803c1f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803bf1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803bf6:	48 89 da             	mov    %rbx,%rdx
+  803bf9:	be 00 10 00 00       	mov    $0x1000,%esi
+  803bfe:	4c 89 e7             	mov    %r12,%rdi
+  803c01:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803c04:	85 c0                	test   %eax,%eax
+  803c06:	74 66                	je     803c6e <devpipe_write+0xe8>
+            sys_yield();
+  803c08:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803c0b:	8b 73 04             	mov    0x4(%rbx),%esi
+  803c0e:	48 63 ce             	movslq %esi,%rcx
+  803c11:	48 63 03             	movslq (%rbx),%rax
+  803c14:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803c1a:	48 39 c1             	cmp    %rax,%rcx
+  803c1d:	73 d2                	jae    803bf1 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803c1f:	41 0f b6 3f          	movzbl (%r15),%edi
+  803c23:	48 89 ca             	mov    %rcx,%rdx
+  803c26:	48 c1 ea 03          	shr    $0x3,%rdx
+  803c2a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803c31:	08 10 20 
+  803c34:	48 f7 e2             	mul    %rdx
+  803c37:	48 c1 ea 06          	shr    $0x6,%rdx
+  803c3b:	48 89 d0             	mov    %rdx,%rax
+  803c3e:	48 c1 e0 09          	shl    $0x9,%rax
+  803c42:	48 29 d0             	sub    %rdx,%rax
+  803c45:	48 c1 e0 03          	shl    $0x3,%rax
+  803c49:	48 29 c1             	sub    %rax,%rcx
+  803c4c:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803c51:	83 c6 01             	add    $0x1,%esi
+  803c54:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c57:	49 83 c7 01          	add    $0x1,%r15
+  803c5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c5f:	49 39 c7             	cmp    %rax,%r15
+  803c62:	0f 85 75 ff ff ff    	jne    803bdd <devpipe_write+0x57>
+    return n;
+  803c68:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c6c:	eb 05                	jmp    803c73 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c73:	48 83 c4 18          	add    $0x18,%rsp
+  803c77:	5b                   	pop    %rbx
+  803c78:	41 5c                	pop    %r12
+  803c7a:	41 5d                	pop    %r13
+  803c7c:	41 5e                	pop    %r14
+  803c7e:	41 5f                	pop    %r15
+  803c80:	5d                   	pop    %rbp
+  803c81:	c3                   	ret
+
+0000000000803c82 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c82:	55                   	push   %rbp
+  803c83:	48 89 e5             	mov    %rsp,%rbp
+  803c86:	41 57                	push   %r15
+  803c88:	41 56                	push   %r14
+  803c8a:	41 55                	push   %r13
+  803c8c:	41 54                	push   %r12
+  803c8e:	53                   	push   %rbx
+  803c8f:	48 83 ec 18          	sub    $0x18,%rsp
+  803c93:	49 89 fc             	mov    %rdi,%r12
+  803c96:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803c9a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c9e:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  803ca5:	00 00 00 
+  803ca8:	ff d0                	call   *%rax
+  803caa:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803cad:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803cb3:	49 bd 70 17 80 00 00 	movabs $0x801770,%r13
+  803cba:	00 00 00 
+            sys_yield();
+  803cbd:	49 be 0d 17 80 00 00 	movabs $0x80170d,%r14
+  803cc4:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803cc7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803ccc:	74 7d                	je     803d4b <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803cce:	8b 03                	mov    (%rbx),%eax
+  803cd0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803cd3:	75 26                	jne    803cfb <devpipe_read+0x79>
+            if (i > 0) return i;
+  803cd5:	4d 85 ff             	test   %r15,%r15
+  803cd8:	75 77                	jne    803d51 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803cda:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803cdf:	48 89 da             	mov    %rbx,%rdx
+  803ce2:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ce7:	4c 89 e7             	mov    %r12,%rdi
+  803cea:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803ced:	85 c0                	test   %eax,%eax
+  803cef:	74 72                	je     803d63 <devpipe_read+0xe1>
+            sys_yield();
+  803cf1:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803cf4:	8b 03                	mov    (%rbx),%eax
+  803cf6:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803cf9:	74 df                	je     803cda <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803cfb:	48 63 c8             	movslq %eax,%rcx
+  803cfe:	48 89 ca             	mov    %rcx,%rdx
+  803d01:	48 c1 ea 03          	shr    $0x3,%rdx
+  803d05:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803d0c:	08 10 20 
+  803d0f:	48 89 d0             	mov    %rdx,%rax
+  803d12:	48 f7 e6             	mul    %rsi
+  803d15:	48 c1 ea 06          	shr    $0x6,%rdx
+  803d19:	48 89 d0             	mov    %rdx,%rax
+  803d1c:	48 c1 e0 09          	shl    $0x9,%rax
+  803d20:	48 29 d0             	sub    %rdx,%rax
+  803d23:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803d2a:	00 
+  803d2b:	48 89 c8             	mov    %rcx,%rax
+  803d2e:	48 29 d0             	sub    %rdx,%rax
+  803d31:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803d36:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803d3a:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803d3e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d41:	49 83 c7 01          	add    $0x1,%r15
+  803d45:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803d49:	75 83                	jne    803cce <devpipe_read+0x4c>
+    return n;
+  803d4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d4f:	eb 03                	jmp    803d54 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803d51:	4c 89 f8             	mov    %r15,%rax
+}
+  803d54:	48 83 c4 18          	add    $0x18,%rsp
+  803d58:	5b                   	pop    %rbx
+  803d59:	41 5c                	pop    %r12
+  803d5b:	41 5d                	pop    %r13
+  803d5d:	41 5e                	pop    %r14
+  803d5f:	41 5f                	pop    %r15
+  803d61:	5d                   	pop    %rbp
+  803d62:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803d63:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d68:	eb ea                	jmp    803d54 <devpipe_read+0xd2>
+
+0000000000803d6a <pipe>:
+pipe(int pfd[2]) {
+  803d6a:	55                   	push   %rbp
+  803d6b:	48 89 e5             	mov    %rsp,%rbp
+  803d6e:	41 55                	push   %r13
+  803d70:	41 54                	push   %r12
+  803d72:	53                   	push   %rbx
+  803d73:	48 83 ec 18          	sub    $0x18,%rsp
+  803d77:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d7a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d7e:	48 b8 ee 22 80 00 00 	movabs $0x8022ee,%rax
+  803d85:	00 00 00 
+  803d88:	ff d0                	call   *%rax
+  803d8a:	89 c3                	mov    %eax,%ebx
+  803d8c:	85 c0                	test   %eax,%eax
+  803d8e:	0f 88 a0 01 00 00    	js     803f34 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803d94:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d9e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803da2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803da7:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  803dae:	00 00 00 
+  803db1:	ff d0                	call   *%rax
+  803db3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803db5:	85 c0                	test   %eax,%eax
+  803db7:	0f 88 77 01 00 00    	js     803f34 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803dbd:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803dc1:	48 b8 ee 22 80 00 00 	movabs $0x8022ee,%rax
+  803dc8:	00 00 00 
+  803dcb:	ff d0                	call   *%rax
+  803dcd:	89 c3                	mov    %eax,%ebx
+  803dcf:	85 c0                	test   %eax,%eax
+  803dd1:	0f 88 43 01 00 00    	js     803f1a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803dd7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ddc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803de1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803de5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dea:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  803df1:	00 00 00 
+  803df4:	ff d0                	call   *%rax
+  803df6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803df8:	85 c0                	test   %eax,%eax
+  803dfa:	0f 88 1a 01 00 00    	js     803f1a <pipe+0x1b0>
+    va = fd2data(fd0);
+  803e00:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e04:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  803e0b:	00 00 00 
+  803e0e:	ff d0                	call   *%rax
+  803e10:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803e13:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e1d:	48 89 c6             	mov    %rax,%rsi
+  803e20:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e25:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  803e2c:	00 00 00 
+  803e2f:	ff d0                	call   *%rax
+  803e31:	89 c3                	mov    %eax,%ebx
+  803e33:	85 c0                	test   %eax,%eax
+  803e35:	0f 88 c5 00 00 00    	js     803f00 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803e3b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e3f:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  803e46:	00 00 00 
+  803e49:	ff d0                	call   *%rax
+  803e4b:	48 89 c1             	mov    %rax,%rcx
+  803e4e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e54:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e5f:	4c 89 ee             	mov    %r13,%rsi
+  803e62:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e67:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  803e6e:	00 00 00 
+  803e71:	ff d0                	call   *%rax
+  803e73:	89 c3                	mov    %eax,%ebx
+  803e75:	85 c0                	test   %eax,%eax
+  803e77:	78 6e                	js     803ee7 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e79:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e7e:	4c 89 ef             	mov    %r13,%rdi
+  803e81:	48 b8 3e 17 80 00 00 	movabs $0x80173e,%rax
+  803e88:	00 00 00 
+  803e8b:	ff d0                	call   *%rax
+  803e8d:	83 f8 02             	cmp    $0x2,%eax
+  803e90:	0f 85 ab 00 00 00    	jne    803f41 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803e96:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803e9d:	00 00 
+  803e9f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ea3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803ea5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ea9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803eb0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803eb4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803eb6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803eba:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803ec1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ec5:	48 bb c0 22 80 00 00 	movabs $0x8022c0,%rbx
+  803ecc:	00 00 00 
+  803ecf:	ff d3                	call   *%rbx
+  803ed1:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ed5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ed9:	ff d3                	call   *%rbx
+  803edb:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803ee0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ee5:	eb 4d                	jmp    803f34 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803ee7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803eec:	4c 89 ee             	mov    %r13,%rsi
+  803eef:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ef4:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  803efb:	00 00 00 
+  803efe:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803f00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f05:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f09:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f0e:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  803f15:	00 00 00 
+  803f18:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803f1a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f1f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f23:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f28:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  803f2f:	00 00 00 
+  803f32:	ff d0                	call   *%rax
+}
+  803f34:	89 d8                	mov    %ebx,%eax
+  803f36:	48 83 c4 18          	add    $0x18,%rsp
+  803f3a:	5b                   	pop    %rbx
+  803f3b:	41 5c                	pop    %r12
+  803f3d:	41 5d                	pop    %r13
+  803f3f:	5d                   	pop    %rbp
+  803f40:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f41:	48 b9 50 58 80 00 00 	movabs $0x805850,%rcx
+  803f48:	00 00 00 
+  803f4b:	48 ba 27 58 80 00 00 	movabs $0x805827,%rdx
+  803f52:	00 00 00 
+  803f55:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803f5a:	48 bf 3c 58 80 00 00 	movabs $0x80583c,%rdi
+  803f61:	00 00 00 
+  803f64:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f69:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  803f70:	00 00 00 
+  803f73:	41 ff d0             	call   *%r8
+
+0000000000803f76 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803f76:	55                   	push   %rbp
+  803f77:	48 89 e5             	mov    %rsp,%rbp
+  803f7a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f7e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f82:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  803f89:	00 00 00 
+  803f8c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f8e:	85 c0                	test   %eax,%eax
+  803f90:	78 35                	js     803fc7 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803f92:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f96:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  803f9d:	00 00 00 
+  803fa0:	ff d0                	call   *%rax
+  803fa2:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803fa5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803faa:	be 00 10 00 00       	mov    $0x1000,%esi
+  803faf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fb3:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  803fba:	00 00 00 
+  803fbd:	ff d0                	call   *%rax
+  803fbf:	85 c0                	test   %eax,%eax
+  803fc1:	0f 94 c0             	sete   %al
+  803fc4:	0f b6 c0             	movzbl %al,%eax
+}
+  803fc7:	c9                   	leave
+  803fc8:	c3                   	ret
+
+0000000000803fc9 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803fc9:	55                   	push   %rbp
+  803fca:	48 89 e5             	mov    %rsp,%rbp
+  803fcd:	41 55                	push   %r13
+  803fcf:	41 54                	push   %r12
+  803fd1:	53                   	push   %rbx
+  803fd2:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  803fd6:	85 ff                	test   %edi,%edi
+  803fd8:	74 73                	je     80404d <wait+0x84>
+  803fda:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803fdd:	89 f8                	mov    %edi,%eax
+  803fdf:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  803fe4:	89 f9                	mov    %edi,%ecx
+  803fe6:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803fec:	48 69 c9 68 01 00 00 	imul   $0x168,%rcx,%rcx
+  803ff3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803ffa:	00 00 00 
+  803ffd:	48 01 ca             	add    %rcx,%rdx
+  804000:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804006:	39 d7                	cmp    %edx,%edi
+  804008:	75 38                	jne    804042 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  80400a:	48 98                	cltq
+  80400c:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804013:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80401a:	00 00 00 
+  80401d:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  804020:	49 bd 0d 17 80 00 00 	movabs $0x80170d,%r13
+  804027:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80402a:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+    while (env->env_id == envid &&
+  804030:	85 c0                	test   %eax,%eax
+  804032:	74 0e                	je     804042 <wait+0x79>
+        sys_yield();
+  804034:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804037:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80403d:	44 39 e0             	cmp    %r12d,%eax
+  804040:	74 e8                	je     80402a <wait+0x61>
+    }
+}
+  804042:	48 83 c4 08          	add    $0x8,%rsp
+  804046:	5b                   	pop    %rbx
+  804047:	41 5c                	pop    %r12
+  804049:	41 5d                	pop    %r13
+  80404b:	5d                   	pop    %rbp
+  80404c:	c3                   	ret
+    assert(envid != 0);
+  80404d:	48 b9 74 58 80 00 00 	movabs $0x805874,%rcx
+  804054:	00 00 00 
+  804057:	48 ba 27 58 80 00 00 	movabs $0x805827,%rdx
+  80405e:	00 00 00 
+  804061:	be 06 00 00 00       	mov    $0x6,%esi
+  804066:	48 bf 7f 58 80 00 00 	movabs $0x80587f,%rdi
+  80406d:	00 00 00 
+  804070:	b8 00 00 00 00       	mov    $0x0,%eax
+  804075:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  80407c:	00 00 00 
+  80407f:	41 ff d0             	call   *%r8
+
+0000000000804082 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804082:	48 89 f8             	mov    %rdi,%rax
+  804085:	48 c1 e8 27          	shr    $0x27,%rax
+  804089:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804090:	7f 00 00 
+  804093:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804097:	f6 c2 01             	test   $0x1,%dl
+  80409a:	74 6d                	je     804109 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80409c:	48 89 f8             	mov    %rdi,%rax
+  80409f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8040a3:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8040aa:	7f 00 00 
+  8040ad:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040b1:	f6 c2 01             	test   $0x1,%dl
+  8040b4:	74 62                	je     804118 <get_uvpt_entry+0x96>
+  8040b6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8040bd:	7f 00 00 
+  8040c0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040c4:	f6 c2 80             	test   $0x80,%dl
+  8040c7:	75 4f                	jne    804118 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8040c9:	48 89 f8             	mov    %rdi,%rax
+  8040cc:	48 c1 e8 15          	shr    $0x15,%rax
+  8040d0:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8040d7:	7f 00 00 
+  8040da:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040de:	f6 c2 01             	test   $0x1,%dl
+  8040e1:	74 44                	je     804127 <get_uvpt_entry+0xa5>
+  8040e3:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8040ea:	7f 00 00 
+  8040ed:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040f1:	f6 c2 80             	test   $0x80,%dl
+  8040f4:	75 31                	jne    804127 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8040f6:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8040fa:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804101:	7f 00 00 
+  804104:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804108:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804109:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  804110:	7f 00 00 
+  804113:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804117:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804118:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80411f:	7f 00 00 
+  804122:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804126:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804127:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  80412e:	7f 00 00 
+  804131:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804135:	c3                   	ret
+
+0000000000804136 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  804136:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804139:	48 89 f9             	mov    %rdi,%rcx
+  80413c:	48 c1 e9 27          	shr    $0x27,%rcx
+  804140:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  804147:	7f 00 00 
+  80414a:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  80414e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  804155:	f6 c1 01             	test   $0x1,%cl
+  804158:	0f 84 b2 00 00 00    	je     804210 <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80415e:	48 89 f9             	mov    %rdi,%rcx
+  804161:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  804165:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80416c:	7f 00 00 
+  80416f:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804173:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  80417a:	40 f6 c6 01          	test   $0x1,%sil
+  80417e:	0f 84 8c 00 00 00    	je     804210 <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804184:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  80418b:	7f 00 00 
+  80418e:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804192:	a8 80                	test   $0x80,%al
+  804194:	75 7b                	jne    804211 <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804196:	48 89 f9             	mov    %rdi,%rcx
+  804199:	48 c1 e9 15          	shr    $0x15,%rcx
+  80419d:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8041a4:	7f 00 00 
+  8041a7:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8041ab:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  8041b2:	40 f6 c6 01          	test   $0x1,%sil
+  8041b6:	74 58                	je     804210 <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  8041b8:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8041bf:	7f 00 00 
+  8041c2:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8041c6:	a8 80                	test   $0x80,%al
+  8041c8:	75 6c                	jne    804236 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8041ca:	48 89 f9             	mov    %rdi,%rcx
+  8041cd:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8041d1:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8041d8:	7f 00 00 
+  8041db:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  8041df:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  8041e6:	40 f6 c6 01          	test   $0x1,%sil
+  8041ea:	74 24                	je     804210 <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  8041ec:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  8041f3:	7f 00 00 
+  8041f6:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8041fa:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804201:	ff ff 7f 
+  804204:	48 21 c8             	and    %rcx,%rax
+  804207:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80420d:	48 09 d0             	or     %rdx,%rax
+}
+  804210:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  804211:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804218:	7f 00 00 
+  80421b:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  80421f:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  804226:	ff ff 7f 
+  804229:	48 21 c8             	and    %rcx,%rax
+  80422c:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  804232:	48 01 d0             	add    %rdx,%rax
+  804235:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  804236:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80423d:	7f 00 00 
+  804240:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804244:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80424b:	ff ff 7f 
+  80424e:	48 21 c8             	and    %rcx,%rax
+  804251:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  804257:	48 01 d0             	add    %rdx,%rax
+  80425a:	c3                   	ret
+
+000000000080425b <get_prot>:
+
+int
+get_prot(void *va) {
+  80425b:	55                   	push   %rbp
+  80425c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80425f:	48 b8 82 40 80 00 00 	movabs $0x804082,%rax
+  804266:	00 00 00 
+  804269:	ff d0                	call   *%rax
+  80426b:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80426e:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804273:	89 c1                	mov    %eax,%ecx
+  804275:	83 c9 04             	or     $0x4,%ecx
+  804278:	f6 c2 01             	test   $0x1,%dl
+  80427b:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80427e:	89 c1                	mov    %eax,%ecx
+  804280:	83 c9 02             	or     $0x2,%ecx
+  804283:	f6 c2 02             	test   $0x2,%dl
+  804286:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804289:	89 c1                	mov    %eax,%ecx
+  80428b:	83 c9 01             	or     $0x1,%ecx
+  80428e:	48 85 d2             	test   %rdx,%rdx
+  804291:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804294:	89 c1                	mov    %eax,%ecx
+  804296:	83 c9 40             	or     $0x40,%ecx
+  804299:	f6 c6 04             	test   $0x4,%dh
+  80429c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80429f:	5d                   	pop    %rbp
+  8042a0:	c3                   	ret
+
+00000000008042a1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8042a1:	55                   	push   %rbp
+  8042a2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042a5:	48 b8 82 40 80 00 00 	movabs $0x804082,%rax
+  8042ac:	00 00 00 
+  8042af:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8042b1:	48 c1 e8 06          	shr    $0x6,%rax
+  8042b5:	83 e0 01             	and    $0x1,%eax
+}
+  8042b8:	5d                   	pop    %rbp
+  8042b9:	c3                   	ret
+
+00000000008042ba <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8042ba:	55                   	push   %rbp
+  8042bb:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8042be:	48 b8 82 40 80 00 00 	movabs $0x804082,%rax
+  8042c5:	00 00 00 
+  8042c8:	ff d0                	call   *%rax
+  8042ca:	83 e0 01             	and    $0x1,%eax
+}
+  8042cd:	5d                   	pop    %rbp
+  8042ce:	c3                   	ret
+
+00000000008042cf <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  8042cf:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  8042d6:	7f 00 00 
+  8042d9:	a8 01                	test   $0x1,%al
+  8042db:	75 06                	jne    8042e3 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  8042dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e2:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8042e3:	55                   	push   %rbp
+  8042e4:	48 89 e5             	mov    %rsp,%rbp
+  8042e7:	41 57                	push   %r15
+  8042e9:	41 56                	push   %r14
+  8042eb:	41 55                	push   %r13
+  8042ed:	41 54                	push   %r12
+  8042ef:	53                   	push   %rbx
+  8042f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8042f4:	49 89 fe             	mov    %rdi,%r14
+  8042f7:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  8042fa:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804301:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804302:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804309:	7f 00 00 
+  80430c:	e9 81 00 00 00       	jmp    804392 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  804311:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804318:	49 39 dd             	cmp    %rbx,%r13
+  80431b:	74 2b                	je     804348 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  80431d:	48 89 d8             	mov    %rbx,%rax
+  804320:	48 c1 e8 0c          	shr    $0xc,%rax
+  804324:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  804328:	f6 c2 01             	test   $0x1,%dl
+  80432b:	74 e4                	je     804311 <foreach_shared_region+0x42>
+  80432d:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  804331:	f6 c4 04             	test   $0x4,%ah
+  804334:	74 db                	je     804311 <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  804336:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80433d:	4c 89 fa             	mov    %r15,%rdx
+  804340:	48 89 df             	mov    %rbx,%rdi
+  804343:	41 ff d6             	call   *%r14
+  804346:	eb c9                	jmp    804311 <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804348:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  80434f:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  804353:	74 22                	je     804377 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  804355:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  80435c:	48 89 d8             	mov    %rbx,%rax
+  80435f:	48 c1 e8 15          	shr    $0x15,%rax
+  804363:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  80436a:	7f 00 00 
+  80436d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804371:	a8 01                	test   $0x1,%al
+  804373:	74 d3                	je     804348 <foreach_shared_region+0x79>
+  804375:	eb a6                	jmp    80431d <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804377:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  80437e:	40 
+  80437f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804383:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80438a:	00 00 00 
+  80438d:	48 39 c1             	cmp    %rax,%rcx
+  804390:	74 31                	je     8043c3 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804392:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804396:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80439a:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  8043a1:	7f 00 00 
+  8043a4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8043a8:	a8 01                	test   $0x1,%al
+  8043aa:	74 cb                	je     804377 <foreach_shared_region+0xa8>
+  8043ac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043b0:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8043b7:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  8043bd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8043c1:	eb 92                	jmp    804355 <foreach_shared_region+0x86>
+}
+  8043c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c8:	48 83 c4 18          	add    $0x18,%rsp
+  8043cc:	5b                   	pop    %rbx
+  8043cd:	41 5c                	pop    %r12
+  8043cf:	41 5d                	pop    %r13
+  8043d1:	41 5e                	pop    %r14
+  8043d3:	41 5f                	pop    %r15
+  8043d5:	5d                   	pop    %rbp
+  8043d6:	c3                   	ret
+
+00000000008043d7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8043d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043dc:	c3                   	ret
+
+00000000008043dd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8043dd:	55                   	push   %rbp
+  8043de:	48 89 e5             	mov    %rsp,%rbp
+  8043e1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8043e4:	48 be 8a 58 80 00 00 	movabs $0x80588a,%rsi
+  8043eb:	00 00 00 
+  8043ee:	48 b8 3c 10 80 00 00 	movabs $0x80103c,%rax
+  8043f5:	00 00 00 
+  8043f8:	ff d0                	call   *%rax
+    return 0;
+}
+  8043fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ff:	5d                   	pop    %rbp
+  804400:	c3                   	ret
+
+0000000000804401 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804401:	55                   	push   %rbp
+  804402:	48 89 e5             	mov    %rsp,%rbp
+  804405:	41 57                	push   %r15
+  804407:	41 56                	push   %r14
+  804409:	41 55                	push   %r13
+  80440b:	41 54                	push   %r12
+  80440d:	53                   	push   %rbx
+  80440e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804415:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80441c:	48 85 d2             	test   %rdx,%rdx
+  80441f:	74 7a                	je     80449b <devcons_write+0x9a>
+  804421:	49 89 d6             	mov    %rdx,%r14
+  804424:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80442a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80442f:	49 bf ca 13 80 00 00 	movabs $0x8013ca,%r15
+  804436:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804439:	4c 89 f3             	mov    %r14,%rbx
+  80443c:	48 29 f3             	sub    %rsi,%rbx
+  80443f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804444:	48 39 c3             	cmp    %rax,%rbx
+  804447:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80444b:	4c 63 eb             	movslq %ebx,%r13
+  80444e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804455:	48 01 c6             	add    %rax,%rsi
+  804458:	4c 89 ea             	mov    %r13,%rdx
+  80445b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804462:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804465:	4c 89 ee             	mov    %r13,%rsi
+  804468:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80446f:	48 b8 13 16 80 00 00 	movabs $0x801613,%rax
+  804476:	00 00 00 
+  804479:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80447b:	41 01 dc             	add    %ebx,%r12d
+  80447e:	49 63 f4             	movslq %r12d,%rsi
+  804481:	4c 39 f6             	cmp    %r14,%rsi
+  804484:	72 b3                	jb     804439 <devcons_write+0x38>
+    return res;
+  804486:	49 63 c4             	movslq %r12d,%rax
+}
+  804489:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804490:	5b                   	pop    %rbx
+  804491:	41 5c                	pop    %r12
+  804493:	41 5d                	pop    %r13
+  804495:	41 5e                	pop    %r14
+  804497:	41 5f                	pop    %r15
+  804499:	5d                   	pop    %rbp
+  80449a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80449b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8044a1:	eb e3                	jmp    804486 <devcons_write+0x85>
+
+00000000008044a3 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044a3:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8044a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044ab:	48 85 c0             	test   %rax,%rax
+  8044ae:	74 55                	je     804505 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044b0:	55                   	push   %rbp
+  8044b1:	48 89 e5             	mov    %rsp,%rbp
+  8044b4:	41 55                	push   %r13
+  8044b6:	41 54                	push   %r12
+  8044b8:	53                   	push   %rbx
+  8044b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8044bd:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8044c0:	48 bb 40 16 80 00 00 	movabs $0x801640,%rbx
+  8044c7:	00 00 00 
+  8044ca:	49 bc 0d 17 80 00 00 	movabs $0x80170d,%r12
+  8044d1:	00 00 00 
+  8044d4:	eb 03                	jmp    8044d9 <devcons_read+0x36>
+  8044d6:	41 ff d4             	call   *%r12
+  8044d9:	ff d3                	call   *%rbx
+  8044db:	85 c0                	test   %eax,%eax
+  8044dd:	74 f7                	je     8044d6 <devcons_read+0x33>
+    if (c < 0) return c;
+  8044df:	48 63 d0             	movslq %eax,%rdx
+  8044e2:	78 13                	js     8044f7 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8044e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044e9:	83 f8 04             	cmp    $0x4,%eax
+  8044ec:	74 09                	je     8044f7 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8044ee:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8044f2:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8044f7:	48 89 d0             	mov    %rdx,%rax
+  8044fa:	48 83 c4 08          	add    $0x8,%rsp
+  8044fe:	5b                   	pop    %rbx
+  8044ff:	41 5c                	pop    %r12
+  804501:	41 5d                	pop    %r13
+  804503:	5d                   	pop    %rbp
+  804504:	c3                   	ret
+  804505:	48 89 d0             	mov    %rdx,%rax
+  804508:	c3                   	ret
+
+0000000000804509 <cputchar>:
+cputchar(int ch) {
+  804509:	55                   	push   %rbp
+  80450a:	48 89 e5             	mov    %rsp,%rbp
+  80450d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804511:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804515:	be 01 00 00 00       	mov    $0x1,%esi
+  80451a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80451e:	48 b8 13 16 80 00 00 	movabs $0x801613,%rax
+  804525:	00 00 00 
+  804528:	ff d0                	call   *%rax
+}
+  80452a:	c9                   	leave
+  80452b:	c3                   	ret
+
+000000000080452c <getchar>:
+getchar(void) {
+  80452c:	55                   	push   %rbp
+  80452d:	48 89 e5             	mov    %rsp,%rbp
+  804530:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804534:	ba 01 00 00 00       	mov    $0x1,%edx
+  804539:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80453d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804542:	48 b8 31 26 80 00 00 	movabs $0x802631,%rax
+  804549:	00 00 00 
+  80454c:	ff d0                	call   *%rax
+  80454e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804550:	85 c0                	test   %eax,%eax
+  804552:	78 06                	js     80455a <getchar+0x2e>
+  804554:	74 08                	je     80455e <getchar+0x32>
+  804556:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80455a:	89 d0                	mov    %edx,%eax
+  80455c:	c9                   	leave
+  80455d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80455e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804563:	eb f5                	jmp    80455a <getchar+0x2e>
+
+0000000000804565 <iscons>:
+iscons(int fdnum) {
+  804565:	55                   	push   %rbp
+  804566:	48 89 e5             	mov    %rsp,%rbp
+  804569:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80456d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804571:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  804578:	00 00 00 
+  80457b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80457d:	85 c0                	test   %eax,%eax
+  80457f:	78 18                	js     804599 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804581:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804585:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80458c:	00 00 00 
+  80458f:	8b 00                	mov    (%rax),%eax
+  804591:	39 02                	cmp    %eax,(%rdx)
+  804593:	0f 94 c0             	sete   %al
+  804596:	0f b6 c0             	movzbl %al,%eax
+}
+  804599:	c9                   	leave
+  80459a:	c3                   	ret
+
+000000000080459b <opencons>:
+opencons(void) {
+  80459b:	55                   	push   %rbp
+  80459c:	48 89 e5             	mov    %rsp,%rbp
+  80459f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8045a3:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8045a7:	48 b8 ee 22 80 00 00 	movabs $0x8022ee,%rax
+  8045ae:	00 00 00 
+  8045b1:	ff d0                	call   *%rax
+  8045b3:	85 c0                	test   %eax,%eax
+  8045b5:	78 49                	js     804600 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8045b7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045c1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8045c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ca:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  8045d1:	00 00 00 
+  8045d4:	ff d0                	call   *%rax
+  8045d6:	85 c0                	test   %eax,%eax
+  8045d8:	78 26                	js     804600 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8045da:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045de:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8045e5:	00 00 
+  8045e7:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8045e9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045ed:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8045f4:	48 b8 c0 22 80 00 00 	movabs $0x8022c0,%rax
+  8045fb:	00 00 00 
+  8045fe:	ff d0                	call   *%rax
+}
+  804600:	c9                   	leave
+  804601:	c3                   	ret
+
+0000000000804602 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804602:	55                   	push   %rbp
+  804603:	48 89 e5             	mov    %rsp,%rbp
+  804606:	41 55                	push   %r13
+  804608:	41 54                	push   %r12
+  80460a:	53                   	push   %rbx
+  80460b:	48 83 ec 08          	sub    $0x8,%rsp
+  80460f:	49 89 fc             	mov    %rdi,%r12
+  804612:	48 89 f7             	mov    %rsi,%rdi
+  804615:	48 89 d3             	mov    %rdx,%rbx
+  804618:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80461b:	48 85 f6             	test   %rsi,%rsi
+  80461e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804625:	00 00 00 
+  804628:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80462c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804631:	48 85 d2             	test   %rdx,%rdx
+  804634:	74 03                	je     804639 <ipc_recv+0x37>
+  804636:	48 8b 32             	mov    (%rdx),%rsi
+  804639:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  804640:	00 00 00 
+  804643:	ff d0                	call   *%rax
+    if (errno) {
+  804645:	85 c0                	test   %eax,%eax
+  804647:	74 1c                	je     804665 <ipc_recv+0x63>
+        if (from_env_store)
+  804649:	4d 85 e4             	test   %r12,%r12
+  80464c:	74 08                	je     804656 <ipc_recv+0x54>
+            *from_env_store = 0;
+  80464e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804655:	00 
+
+        if (perm_store)
+  804656:	4d 85 ed             	test   %r13,%r13
+  804659:	74 74                	je     8046cf <ipc_recv+0xcd>
+            *perm_store = 0;
+  80465b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804662:	00 
+  804663:	eb 6a                	jmp    8046cf <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  804665:	4d 85 e4             	test   %r12,%r12
+  804668:	74 14                	je     80467e <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  80466a:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804671:	00 00 00 
+  804674:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  80467a:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  80467e:	48 85 db             	test   %rbx,%rbx
+  804681:	74 23                	je     8046a6 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804683:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80468a:	00 00 00 
+  80468d:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  804693:	ba 00 00 00 00       	mov    $0x0,%edx
+  804698:	85 c9                	test   %ecx,%ecx
+  80469a:	74 07                	je     8046a3 <ipc_recv+0xa1>
+  80469c:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8046a3:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  8046a6:	4d 85 ed             	test   %r13,%r13
+  8046a9:	74 14                	je     8046bf <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  8046ab:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8046b2:	00 00 00 
+  8046b5:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8046bb:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  8046bf:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8046c6:	00 00 00 
+  8046c9:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  8046cf:	48 83 c4 08          	add    $0x8,%rsp
+  8046d3:	5b                   	pop    %rbx
+  8046d4:	41 5c                	pop    %r12
+  8046d6:	41 5d                	pop    %r13
+  8046d8:	5d                   	pop    %rbp
+  8046d9:	c3                   	ret
+
+00000000008046da <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8046da:	55                   	push   %rbp
+  8046db:	48 89 e5             	mov    %rsp,%rbp
+  8046de:	41 55                	push   %r13
+  8046e0:	41 54                	push   %r12
+  8046e2:	53                   	push   %rbx
+  8046e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8046e7:	49 89 fc             	mov    %rdi,%r12
+  8046ea:	48 89 f7             	mov    %rsi,%rdi
+  8046ed:	48 89 d3             	mov    %rdx,%rbx
+  8046f0:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8046f3:	48 85 f6             	test   %rsi,%rsi
+  8046f6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046fd:	00 00 00 
+  804700:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  804704:	be 00 10 00 00       	mov    $0x1000,%esi
+  804709:	48 85 d2             	test   %rdx,%rdx
+  80470c:	74 03                	je     804711 <ipc_try_recv+0x37>
+  80470e:	48 8b 32             	mov    (%rdx),%rsi
+  804711:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  804718:	00 00 00 
+  80471b:	ff d0                	call   *%rax
+    if (errno) {
+  80471d:	85 c0                	test   %eax,%eax
+  80471f:	75 75                	jne    804796 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  804721:	4d 85 e4             	test   %r12,%r12
+  804724:	74 14                	je     80473a <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  804726:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80472d:	00 00 00 
+  804730:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  804736:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80473a:	48 85 db             	test   %rbx,%rbx
+  80473d:	74 23                	je     804762 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80473f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804746:	00 00 00 
+  804749:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  80474f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804754:	85 c9                	test   %ecx,%ecx
+  804756:	74 07                	je     80475f <ipc_try_recv+0x85>
+  804758:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  80475f:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  804762:	4d 85 ed             	test   %r13,%r13
+  804765:	74 14                	je     80477b <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  804767:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80476e:	00 00 00 
+  804771:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  804777:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  80477b:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  804782:	00 00 00 
+  804785:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  80478b:	48 83 c4 08          	add    $0x8,%rsp
+  80478f:	5b                   	pop    %rbx
+  804790:	41 5c                	pop    %r12
+  804792:	41 5d                	pop    %r13
+  804794:	5d                   	pop    %rbp
+  804795:	c3                   	ret
+        if (from_env_store)
+  804796:	4d 85 e4             	test   %r12,%r12
+  804799:	74 08                	je     8047a3 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  80479b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8047a2:	00 
+        if (perm_store)
+  8047a3:	4d 85 ed             	test   %r13,%r13
+  8047a6:	74 e3                	je     80478b <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  8047a8:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8047af:	00 
+  8047b0:	eb d9                	jmp    80478b <ipc_try_recv+0xb1>
+
+00000000008047b2 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8047b2:	55                   	push   %rbp
+  8047b3:	48 89 e5             	mov    %rsp,%rbp
+  8047b6:	41 57                	push   %r15
+  8047b8:	41 56                	push   %r14
+  8047ba:	41 55                	push   %r13
+  8047bc:	41 54                	push   %r12
+  8047be:	53                   	push   %rbx
+  8047bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8047c3:	41 89 fd             	mov    %edi,%r13d
+  8047c6:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8047c9:	48 89 d3             	mov    %rdx,%rbx
+  8047cc:	49 89 cc             	mov    %rcx,%r12
+  8047cf:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  8047d3:	48 85 d2             	test   %rdx,%rdx
+  8047d6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8047dd:	00 00 00 
+  8047e0:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8047e4:	49 be 1d 1b 80 00 00 	movabs $0x801b1d,%r14
+  8047eb:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  8047ee:	49 bf 0d 17 80 00 00 	movabs $0x80170d,%r15
+  8047f5:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  8047f8:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8047fb:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8047ff:	4c 89 e1             	mov    %r12,%rcx
+  804802:	48 89 da             	mov    %rbx,%rdx
+  804805:	44 89 ef             	mov    %r13d,%edi
+  804808:	41 ff d6             	call   *%r14
+  80480b:	85 c0                	test   %eax,%eax
+  80480d:	74 37                	je     804846 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  80480f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804812:	75 05                	jne    804819 <ipc_send+0x67>
+        sys_yield();
+  804814:	41 ff d7             	call   *%r15
+  804817:	eb df                	jmp    8047f8 <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  804819:	89 c1                	mov    %eax,%ecx
+  80481b:	48 ba 96 58 80 00 00 	movabs $0x805896,%rdx
+  804822:	00 00 00 
+  804825:	be 65 00 00 00       	mov    $0x65,%esi
+  80482a:	48 bf b1 58 80 00 00 	movabs $0x8058b1,%rdi
+  804831:	00 00 00 
+  804834:	b8 00 00 00 00       	mov    $0x0,%eax
+  804839:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  804840:	00 00 00 
+  804843:	41 ff d0             	call   *%r8
+    }
+}
+  804846:	48 83 c4 18          	add    $0x18,%rsp
+  80484a:	5b                   	pop    %rbx
+  80484b:	41 5c                	pop    %r12
+  80484d:	41 5d                	pop    %r13
+  80484f:	41 5e                	pop    %r14
+  804851:	41 5f                	pop    %r15
+  804853:	5d                   	pop    %rbp
+  804854:	c3                   	ret
+
+0000000000804855 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804855:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80485a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804861:	00 00 00 
+  804864:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  80486b:	48 01 ca             	add    %rcx,%rdx
+  80486e:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  804874:	39 fa                	cmp    %edi,%edx
+  804876:	74 12                	je     80488a <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  804878:	48 83 c0 01          	add    $0x1,%rax
+  80487c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  804882:	75 e0                	jne    804864 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804884:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804889:	c3                   	ret
+            return envs[i].env_id;
+  80488a:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  804891:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804898:	00 00 00 
+  80489b:	48 01 d0             	add    %rdx,%rax
+  80489e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8048a4:	c3                   	ret
+
+00000000008048a5 <__text_end>:
+  8048a5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ac:	00 00 00 
+  8048af:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b6:	00 00 00 
+  8048b9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c0:	00 00 00 
+  8048c3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ca:	00 00 00 
+  8048cd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d4:	00 00 00 
+  8048d7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048de:	00 00 00 
+  8048e1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e8:	00 00 00 
+  8048eb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f2:	00 00 00 
+  8048f5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048fc:	00 00 00 
+  8048ff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804906:	00 00 00 
+  804909:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804910:	00 00 00 
+  804913:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80491a:	00 00 00 
+  80491d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804924:	00 00 00 
+  804927:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492e:	00 00 00 
+  804931:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804938:	00 00 00 
+  80493b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804942:	00 00 00 
+  804945:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80494c:	00 00 00 
+  80494f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804956:	00 00 00 
+  804959:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804960:	00 00 00 
+  804963:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80496a:	00 00 00 
+  80496d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804974:	00 00 00 
+  804977:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497e:	00 00 00 
+  804981:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804988:	00 00 00 
+  80498b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804992:	00 00 00 
+  804995:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80499c:	00 00 00 
+  80499f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a6:	00 00 00 
+  8049a9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b0:	00 00 00 
+  8049b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ba:	00 00 00 
+  8049bd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c4:	00 00 00 
+  8049c7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ce:	00 00 00 
+  8049d1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d8:	00 00 00 
+  8049db:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e2:	00 00 00 
+  8049e5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ec:	00 00 00 
+  8049ef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f6:	00 00 00 
+  8049f9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a00:	00 00 00 
+  804a03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a0a:	00 00 00 
+  804a0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a14:	00 00 00 
+  804a17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1e:	00 00 00 
+  804a21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a28:	00 00 00 
+  804a2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a32:	00 00 00 
+  804a35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a3c:	00 00 00 
+  804a3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a46:	00 00 00 
+  804a49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a50:	00 00 00 
+  804a53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a5a:	00 00 00 
+  804a5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a64:	00 00 00 
+  804a67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6e:	00 00 00 
+  804a71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a78:	00 00 00 
+  804a7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a82:	00 00 00 
+  804a85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a8c:	00 00 00 
+  804a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a96:	00 00 00 
+  804a99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa0:	00 00 00 
+  804aa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aaa:	00 00 00 
+  804aad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab4:	00 00 00 
+  804ab7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abe:	00 00 00 
+  804ac1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac8:	00 00 00 
+  804acb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad2:	00 00 00 
+  804ad5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804adc:	00 00 00 
+  804adf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae6:	00 00 00 
+  804ae9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af0:	00 00 00 
+  804af3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804afa:	00 00 00 
+  804afd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b04:	00 00 00 
+  804b07:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0e:	00 00 00 
+  804b11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b18:	00 00 00 
+  804b1b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b22:	00 00 00 
+  804b25:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b2c:	00 00 00 
+  804b2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b36:	00 00 00 
+  804b39:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b40:	00 00 00 
+  804b43:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b4a:	00 00 00 
+  804b4d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b54:	00 00 00 
+  804b57:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5e:	00 00 00 
+  804b61:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b68:	00 00 00 
+  804b6b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b72:	00 00 00 
+  804b75:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b7c:	00 00 00 
+  804b7f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b86:	00 00 00 
+  804b89:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b90:	00 00 00 
+  804b93:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b9a:	00 00 00 
+  804b9d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba4:	00 00 00 
+  804ba7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bae:	00 00 00 
+  804bb1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb8:	00 00 00 
+  804bbb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc2:	00 00 00 
+  804bc5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bcc:	00 00 00 
+  804bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd6:	00 00 00 
+  804bd9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be0:	00 00 00 
+  804be3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bea:	00 00 00 
+  804bed:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf4:	00 00 00 
+  804bf7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfe:	00 00 00 
+  804c01:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c08:	00 00 00 
+  804c0b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c12:	00 00 00 
+  804c15:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c1c:	00 00 00 
+  804c1f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c26:	00 00 00 
+  804c29:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c30:	00 00 00 
+  804c33:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c3a:	00 00 00 
+  804c3d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c44:	00 00 00 
+  804c47:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4e:	00 00 00 
+  804c51:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c58:	00 00 00 
+  804c5b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c62:	00 00 00 
+  804c65:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c6c:	00 00 00 
+  804c6f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c76:	00 00 00 
+  804c79:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c80:	00 00 00 
+  804c83:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c8a:	00 00 00 
+  804c8d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c94:	00 00 00 
+  804c97:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9e:	00 00 00 
+  804ca1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca8:	00 00 00 
+  804cab:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb2:	00 00 00 
+  804cb5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cbc:	00 00 00 
+  804cbf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc6:	00 00 00 
+  804cc9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd0:	00 00 00 
+  804cd3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cda:	00 00 00 
+  804cdd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce4:	00 00 00 
+  804ce7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cee:	00 00 00 
+  804cf1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf8:	00 00 00 
+  804cfb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d02:	00 00 00 
+  804d05:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d0c:	00 00 00 
+  804d0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d16:	00 00 00 
+  804d19:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d20:	00 00 00 
+  804d23:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d2a:	00 00 00 
+  804d2d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d34:	00 00 00 
+  804d37:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3e:	00 00 00 
+  804d41:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d48:	00 00 00 
+  804d4b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d52:	00 00 00 
+  804d55:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d5c:	00 00 00 
+  804d5f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d66:	00 00 00 
+  804d69:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d70:	00 00 00 
+  804d73:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d7a:	00 00 00 
+  804d7d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d84:	00 00 00 
+  804d87:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8e:	00 00 00 
+  804d91:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d98:	00 00 00 
+  804d9b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da2:	00 00 00 
+  804da5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dac:	00 00 00 
+  804daf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db6:	00 00 00 
+  804db9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc0:	00 00 00 
+  804dc3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dca:	00 00 00 
+  804dcd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd4:	00 00 00 
+  804dd7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dde:	00 00 00 
+  804de1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de8:	00 00 00 
+  804deb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df2:	00 00 00 
+  804df5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dfc:	00 00 00 
+  804dff:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e06:	00 00 00 
+  804e09:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e10:	00 00 00 
+  804e13:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e1a:	00 00 00 
+  804e1d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e24:	00 00 00 
+  804e27:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2e:	00 00 00 
+  804e31:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e38:	00 00 00 
+  804e3b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e42:	00 00 00 
+  804e45:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e4c:	00 00 00 
+  804e4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e56:	00 00 00 
+  804e59:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e60:	00 00 00 
+  804e63:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e6a:	00 00 00 
+  804e6d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e74:	00 00 00 
+  804e77:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7e:	00 00 00 
+  804e81:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e88:	00 00 00 
+  804e8b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e92:	00 00 00 
+  804e95:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e9c:	00 00 00 
+  804e9f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea6:	00 00 00 
+  804ea9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb0:	00 00 00 
+  804eb3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eba:	00 00 00 
+  804ebd:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec4:	00 00 00 
+  804ec7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ece:	00 00 00 
+  804ed1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed8:	00 00 00 
+  804edb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee2:	00 00 00 
+  804ee5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eec:	00 00 00 
+  804eef:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef6:	00 00 00 
+  804ef9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f00:	00 00 00 
+  804f03:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f0a:	00 00 00 
+  804f0d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f14:	00 00 00 
+  804f17:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1e:	00 00 00 
+  804f21:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f28:	00 00 00 
+  804f2b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f32:	00 00 00 
+  804f35:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f3c:	00 00 00 
+  804f3f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f46:	00 00 00 
+  804f49:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f50:	00 00 00 
+  804f53:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f5a:	00 00 00 
+  804f5d:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f64:	00 00 00 
+  804f67:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6e:	00 00 00 
+  804f71:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f78:	00 00 00 
+  804f7b:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f82:	00 00 00 
+  804f85:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f8c:	00 00 00 
+  804f8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f96:	00 00 00 
+  804f99:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa0:	00 00 00 
+  804fa3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804faa:	00 00 00 
+  804fad:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb4:	00 00 00 
+  804fb7:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbe:	00 00 00 
+  804fc1:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc8:	00 00 00 
+  804fcb:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd2:	00 00 00 
+  804fd5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fdc:	00 00 00 
+  804fdf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe6:	00 00 00 
+  804fe9:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff0:	00 00 00 
+  804ff3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ffa:	00 00 00 
+  804ffd:	0f 1f 00             	nopl   (%rax)
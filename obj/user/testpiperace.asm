@@ -0,0 +1,8242 @@
+
+obj/user/testpiperace:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 29 03 00 00       	call   80034c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, pid, i, max;
+    void *va;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for dup race...\n");
+  800036:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba 68 05 80 00 00 	movabs $0x800568,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 b1 3e 80 00 00 	movabs $0x803eb1,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 7f 01 00 00    	js     8001e8 <umain+0x1c3>
+        panic("pipe: %i", r);
+    max = 200;
+    if ((r = fork()) < 0)
+  800069:	48 b8 56 20 80 00 00 	movabs $0x802056,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 95 01 00 00    	js     800215 <umain+0x1f0>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 b8 01 00 00    	je     800242 <umain+0x21d>
+        }
+        /* do something to be not runnable besides exiting */
+        ipc_recv(0, 0, 0, 0);
+    }
+    pid = r;
+    cprintf("pid is %d\n", pid);
+  80008a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+  80008d:	89 de                	mov    %ebx,%esi
+  80008f:	48 bf 5a 50 80 00 00 	movabs $0x80505a,%rdi
+  800096:	00 00 00 
+  800099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009e:	49 bc 68 05 80 00 00 	movabs $0x800568,%r12
+  8000a5:	00 00 00 
+  8000a8:	41 ff d4             	call   *%r12
+    va = 0;
+    kid = &envs[ENVX(pid)];
+  8000ab:	41 89 dd             	mov    %ebx,%r13d
+  8000ae:	41 81 e5 ff 03 00 00 	and    $0x3ff,%r13d
+    cprintf("kid is %d\n", (int32_t)(kid - envs));
+  8000b5:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8000bb:	48 69 db 68 01 00 00 	imul   $0x168,%rbx,%rbx
+  8000c2:	48 89 de             	mov    %rbx,%rsi
+  8000c5:	48 c1 fe 03          	sar    $0x3,%rsi
+  8000c9:	69 f6 a5 4f fa a4    	imul   $0xa4fa4fa5,%esi,%esi
+  8000cf:	48 bf 65 50 80 00 00 	movabs $0x805065,%rdi
+  8000d6:	00 00 00 
+  8000d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000de:	41 ff d4             	call   *%r12
+    dup(p[0], 10);
+  8000e1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8000e6:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000e9:	48 b8 55 26 80 00 00 	movabs $0x802655,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+    while (kid->env_status == ENV_RUNNABLE)
+  8000f5:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8000fc:	00 00 00 
+  8000ff:	48 01 d8             	add    %rbx,%rax
+  800102:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  800108:	83 f8 02             	cmp    $0x2,%eax
+  80010b:	75 37                	jne    800144 <umain+0x11f>
+        dup(p[0], 10);
+  80010d:	49 bc 55 26 80 00 00 	movabs $0x802655,%r12
+  800114:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE)
+  800117:	4d 63 ed             	movslq %r13d,%r13
+  80011a:	4d 69 ed 68 01 00 00 	imul   $0x168,%r13,%r13
+  800121:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  800128:	00 00 00 
+  80012b:	4c 01 eb             	add    %r13,%rbx
+        dup(p[0], 10);
+  80012e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800133:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800136:	41 ff d4             	call   *%r12
+    while (kid->env_status == ENV_RUNNABLE)
+  800139:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  80013f:	83 f8 02             	cmp    $0x2,%eax
+  800142:	74 ea                	je     80012e <umain+0x109>
+
+    cprintf("child done with loop\n");
+  800144:	48 bf 70 50 80 00 00 	movabs $0x805070,%rdi
+  80014b:	00 00 00 
+  80014e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800153:	48 ba 68 05 80 00 00 	movabs $0x800568,%rdx
+  80015a:	00 00 00 
+  80015d:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  80015f:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800162:	48 b8 bd 40 80 00 00 	movabs $0x8040bd,%rax
+  800169:	00 00 00 
+  80016c:	ff d0                	call   *%rax
+  80016e:	85 c0                	test   %eax,%eax
+  800170:	0f 85 5a 01 00 00    	jne    8002d0 <umain+0x2ab>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  800176:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80017a:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80017d:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  800184:	00 00 00 
+  800187:	ff d0                	call   *%rax
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 88 69 01 00 00    	js     8002fa <umain+0x2d5>
+        panic("cannot look up p[0]: %i", r);
+    va = fd2data(fd);
+  800191:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  800195:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  80019c:	00 00 00 
+  80019f:	ff d0                	call   *%rax
+  8001a1:	48 89 c7             	mov    %rax,%rdi
+    if (sys_region_refs(va, PAGE_SIZE) != 3 + 1)
+  8001a4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8001a9:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  8001b0:	00 00 00 
+  8001b3:	ff d0                	call   *%rax
+  8001b5:	83 f8 04             	cmp    $0x4,%eax
+  8001b8:	0f 84 69 01 00 00    	je     800327 <umain+0x302>
+        cprintf("\nchild detected race\n");
+  8001be:	48 bf 9e 50 80 00 00 	movabs $0x80509e,%rdi
+  8001c5:	00 00 00 
+  8001c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001cd:	48 ba 68 05 80 00 00 	movabs $0x800568,%rdx
+  8001d4:	00 00 00 
+  8001d7:	ff d2                	call   *%rdx
+    else
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+}
+  8001d9:	48 83 c4 28          	add    $0x28,%rsp
+  8001dd:	5b                   	pop    %rbx
+  8001de:	41 5c                	pop    %r12
+  8001e0:	41 5d                	pop    %r13
+  8001e2:	41 5e                	pop    %r14
+  8001e4:	41 5f                	pop    %r15
+  8001e6:	5d                   	pop    %rbp
+  8001e7:	c3                   	ret
+        panic("pipe: %i", r);
+  8001e8:	89 c1                	mov    %eax,%ecx
+  8001ea:	48 ba 19 50 80 00 00 	movabs $0x805019,%rdx
+  8001f1:	00 00 00 
+  8001f4:	be 0c 00 00 00       	mov    $0xc,%esi
+  8001f9:	48 bf 22 50 80 00 00 	movabs $0x805022,%rdi
+  800200:	00 00 00 
+  800203:	b8 00 00 00 00       	mov    $0x0,%eax
+  800208:	49 b8 18 04 80 00 00 	movabs $0x800418,%r8
+  80020f:	00 00 00 
+  800212:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800215:	89 c1                	mov    %eax,%ecx
+  800217:	48 ba 36 50 80 00 00 	movabs $0x805036,%rdx
+  80021e:	00 00 00 
+  800221:	be 0f 00 00 00       	mov    $0xf,%esi
+  800226:	48 bf 22 50 80 00 00 	movabs $0x805022,%rdi
+  80022d:	00 00 00 
+  800230:	b8 00 00 00 00       	mov    $0x0,%eax
+  800235:	49 b8 18 04 80 00 00 	movabs $0x800418,%r8
+  80023c:	00 00 00 
+  80023f:	41 ff d0             	call   *%r8
+        close(p[1]);
+  800242:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800245:	48 b8 fa 25 80 00 00 	movabs $0x8025fa,%rax
+  80024c:	00 00 00 
+  80024f:	ff d0                	call   *%rax
+  800251:	bb c8 00 00 00       	mov    $0xc8,%ebx
+            if (pipeisclosed(p[0])) {
+  800256:	49 bc bd 40 80 00 00 	movabs $0x8040bd,%r12
+  80025d:	00 00 00 
+                cprintf("RACE: pipe appears closed\n");
+  800260:	49 bf 3f 50 80 00 00 	movabs $0x80503f,%r15
+  800267:	00 00 00 
+  80026a:	49 be 68 05 80 00 00 	movabs $0x800568,%r14
+  800271:	00 00 00 
+                exit();
+  800274:	49 bd f5 03 80 00 00 	movabs $0x8003f5,%r13
+  80027b:	00 00 00 
+  80027e:	eb 11                	jmp    800291 <umain+0x26c>
+            sys_yield();
+  800280:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  800287:	00 00 00 
+  80028a:	ff d0                	call   *%rax
+        for (i = 0; i < max; i++) {
+  80028c:	83 eb 01             	sub    $0x1,%ebx
+  80028f:	74 1a                	je     8002ab <umain+0x286>
+            if (pipeisclosed(p[0])) {
+  800291:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800294:	41 ff d4             	call   *%r12
+  800297:	85 c0                	test   %eax,%eax
+  800299:	74 e5                	je     800280 <umain+0x25b>
+                cprintf("RACE: pipe appears closed\n");
+  80029b:	4c 89 ff             	mov    %r15,%rdi
+  80029e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a3:	41 ff d6             	call   *%r14
+                exit();
+  8002a6:	41 ff d5             	call   *%r13
+  8002a9:	eb d5                	jmp    800280 <umain+0x25b>
+        ipc_recv(0, 0, 0, 0);
+  8002ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8002ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002bf:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  8002c6:	00 00 00 
+  8002c9:	ff d0                	call   *%rax
+  8002cb:	e9 ba fd ff ff       	jmp    80008a <umain+0x65>
+        panic("somehow the other end of p[0] got closed!");
+  8002d0:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  8002d7:	00 00 00 
+  8002da:	be 38 00 00 00       	mov    $0x38,%esi
+  8002df:	48 bf 22 50 80 00 00 	movabs $0x805022,%rdi
+  8002e6:	00 00 00 
+  8002e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ee:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  8002f5:	00 00 00 
+  8002f8:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8002fa:	89 c1                	mov    %eax,%ecx
+  8002fc:	48 ba 86 50 80 00 00 	movabs $0x805086,%rdx
+  800303:	00 00 00 
+  800306:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80030b:	48 bf 22 50 80 00 00 	movabs $0x805022,%rdi
+  800312:	00 00 00 
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	49 b8 18 04 80 00 00 	movabs $0x800418,%r8
+  800321:	00 00 00 
+  800324:	41 ff d0             	call   *%r8
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+  800327:	be c8 00 00 00       	mov    $0xc8,%esi
+  80032c:	48 bf e8 50 80 00 00 	movabs $0x8050e8,%rdi
+  800333:	00 00 00 
+  800336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033b:	48 ba 68 05 80 00 00 	movabs $0x800568,%rdx
+  800342:	00 00 00 
+  800345:	ff d2                	call   *%rdx
+}
+  800347:	e9 8d fe ff ff       	jmp    8001d9 <umain+0x1b4>
+
+000000000080034c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80034c:	55                   	push   %rbp
+  80034d:	48 89 e5             	mov    %rsp,%rbp
+  800350:	41 56                	push   %r14
+  800352:	41 55                	push   %r13
+  800354:	41 54                	push   %r12
+  800356:	53                   	push   %rbx
+  800357:	41 89 fd             	mov    %edi,%r13d
+  80035a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+     * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80035d:	48 ba d8 60 80 00 00 	movabs $0x8060d8,%rdx
+  800364:	00 00 00 
+  800367:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  80036e:	00 00 00 
+  800371:	48 39 c2             	cmp    %rax,%rdx
+  800374:	73 17                	jae    80038d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800376:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800379:	49 89 c4             	mov    %rax,%r12
+  80037c:	48 83 c3 08          	add    $0x8,%rbx
+  800380:	b8 00 00 00 00       	mov    $0x0,%eax
+  800385:	ff 53 f8             	call   *-0x8(%rbx)
+  800388:	4c 39 e3             	cmp    %r12,%rbx
+  80038b:	72 ef                	jb     80037c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80038d:	48 b8 80 15 80 00 00 	movabs $0x801580,%rax
+  800394:	00 00 00 
+  800397:	ff d0                	call   *%rax
+  800399:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80039e:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8003a5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003ac:	00 00 00 
+  8003af:	48 01 d0             	add    %rdx,%rax
+  8003b2:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  8003b9:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003bc:	45 85 ed             	test   %r13d,%r13d
+  8003bf:	7e 0d                	jle    8003ce <libmain+0x82>
+  8003c1:	49 8b 06             	mov    (%r14),%rax
+  8003c4:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003cb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003ce:	4c 89 f6             	mov    %r14,%rsi
+  8003d1:	44 89 ef             	mov    %r13d,%edi
+  8003d4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003db:	00 00 00 
+  8003de:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003e0:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  8003e7:	00 00 00 
+  8003ea:	ff d0                	call   *%rax
+#endif
+}
+  8003ec:	5b                   	pop    %rbx
+  8003ed:	41 5c                	pop    %r12
+  8003ef:	41 5d                	pop    %r13
+  8003f1:	41 5e                	pop    %r14
+  8003f3:	5d                   	pop    %rbp
+  8003f4:	c3                   	ret
+
+00000000008003f5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003f5:	55                   	push   %rbp
+  8003f6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003f9:	48 b8 2d 26 80 00 00 	movabs $0x80262d,%rax
+  800400:	00 00 00 
+  800403:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800405:	bf 00 00 00 00       	mov    $0x0,%edi
+  80040a:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  800411:	00 00 00 
+  800414:	ff d0                	call   *%rax
+}
+  800416:	5d                   	pop    %rbp
+  800417:	c3                   	ret
+
+0000000000800418 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800418:	55                   	push   %rbp
+  800419:	48 89 e5             	mov    %rsp,%rbp
+  80041c:	41 56                	push   %r14
+  80041e:	41 55                	push   %r13
+  800420:	41 54                	push   %r12
+  800422:	53                   	push   %rbx
+  800423:	48 83 ec 50          	sub    $0x50,%rsp
+  800427:	49 89 fc             	mov    %rdi,%r12
+  80042a:	41 89 f5             	mov    %esi,%r13d
+  80042d:	48 89 d3             	mov    %rdx,%rbx
+  800430:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800434:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800438:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80043c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800443:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800447:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80044b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80044f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800453:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80045a:	00 00 00 
+  80045d:	4c 8b 30             	mov    (%rax),%r14
+  800460:	48 b8 80 15 80 00 00 	movabs $0x801580,%rax
+  800467:	00 00 00 
+  80046a:	ff d0                	call   *%rax
+  80046c:	89 c6                	mov    %eax,%esi
+  80046e:	45 89 e8             	mov    %r13d,%r8d
+  800471:	4c 89 e1             	mov    %r12,%rcx
+  800474:	4c 89 f2             	mov    %r14,%rdx
+  800477:	48 bf 20 51 80 00 00 	movabs $0x805120,%rdi
+  80047e:	00 00 00 
+  800481:	b8 00 00 00 00       	mov    $0x0,%eax
+  800486:	49 bc 68 05 80 00 00 	movabs $0x800568,%r12
+  80048d:	00 00 00 
+  800490:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800493:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800497:	48 89 df             	mov    %rbx,%rdi
+  80049a:	48 b8 04 05 80 00 00 	movabs $0x800504,%rax
+  8004a1:	00 00 00 
+  8004a4:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004a6:	48 bf 17 50 80 00 00 	movabs $0x805017,%rdi
+  8004ad:	00 00 00 
+  8004b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b5:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004b8:	cc                   	int3
+  8004b9:	eb fd                	jmp    8004b8 <_panic+0xa0>
+
+00000000008004bb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004bb:	55                   	push   %rbp
+  8004bc:	48 89 e5             	mov    %rsp,%rbp
+  8004bf:	53                   	push   %rbx
+  8004c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8004c4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004c7:	8b 06                	mov    (%rsi),%eax
+  8004c9:	8d 50 01             	lea    0x1(%rax),%edx
+  8004cc:	89 16                	mov    %edx,(%rsi)
+  8004ce:	48 98                	cltq
+  8004d0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004d5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004db:	74 0a                	je     8004e7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004dd:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e5:	c9                   	leave
+  8004e6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004e7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004eb:	be ff 00 00 00       	mov    $0xff,%esi
+  8004f0:	48 b8 b7 14 80 00 00 	movabs $0x8014b7,%rax
+  8004f7:	00 00 00 
+  8004fa:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004fc:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800502:	eb d9                	jmp    8004dd <putch+0x22>
+
+0000000000800504 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800504:	55                   	push   %rbp
+  800505:	48 89 e5             	mov    %rsp,%rbp
+  800508:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80050f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800512:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800519:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80051e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800523:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800526:	48 89 f1             	mov    %rsi,%rcx
+  800529:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800530:	48 bf bb 04 80 00 00 	movabs $0x8004bb,%rdi
+  800537:	00 00 00 
+  80053a:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  800541:	00 00 00 
+  800544:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800546:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80054d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800554:	48 b8 b7 14 80 00 00 	movabs $0x8014b7,%rax
+  80055b:	00 00 00 
+  80055e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800560:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800566:	c9                   	leave
+  800567:	c3                   	ret
+
+0000000000800568 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800568:	55                   	push   %rbp
+  800569:	48 89 e5             	mov    %rsp,%rbp
+  80056c:	48 83 ec 50          	sub    $0x50,%rsp
+  800570:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800574:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800578:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80057c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800580:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800584:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80058b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800593:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800597:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80059b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80059f:	48 b8 04 05 80 00 00 	movabs $0x800504,%rax
+  8005a6:	00 00 00 
+  8005a9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005ab:	c9                   	leave
+  8005ac:	c3                   	ret
+
+00000000008005ad <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005ad:	55                   	push   %rbp
+  8005ae:	48 89 e5             	mov    %rsp,%rbp
+  8005b1:	41 57                	push   %r15
+  8005b3:	41 56                	push   %r14
+  8005b5:	41 55                	push   %r13
+  8005b7:	41 54                	push   %r12
+  8005b9:	53                   	push   %rbx
+  8005ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8005be:	49 89 fc             	mov    %rdi,%r12
+  8005c1:	49 89 f5             	mov    %rsi,%r13
+  8005c4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005c8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005cb:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005ce:	41 89 cf             	mov    %ecx,%r15d
+  8005d1:	4c 39 fa             	cmp    %r15,%rdx
+  8005d4:	73 5b                	jae    800631 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005d6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005da:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005de:	85 db                	test   %ebx,%ebx
+  8005e0:	7e 0e                	jle    8005f0 <print_num+0x43>
+            putch(padc, put_arg);
+  8005e2:	4c 89 ee             	mov    %r13,%rsi
+  8005e5:	44 89 f7             	mov    %r14d,%edi
+  8005e8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005eb:	83 eb 01             	sub    $0x1,%ebx
+  8005ee:	75 f2                	jne    8005e2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005f0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005f4:	48 b9 54 51 80 00 00 	movabs $0x805154,%rcx
+  8005fb:	00 00 00 
+  8005fe:	48 b8 43 51 80 00 00 	movabs $0x805143,%rax
+  800605:	00 00 00 
+  800608:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80060c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800610:	ba 00 00 00 00       	mov    $0x0,%edx
+  800615:	49 f7 f7             	div    %r15
+  800618:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80061c:	4c 89 ee             	mov    %r13,%rsi
+  80061f:	41 ff d4             	call   *%r12
+}
+  800622:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800626:	5b                   	pop    %rbx
+  800627:	41 5c                	pop    %r12
+  800629:	41 5d                	pop    %r13
+  80062b:	41 5e                	pop    %r14
+  80062d:	41 5f                	pop    %r15
+  80062f:	5d                   	pop    %rbp
+  800630:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800631:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800635:	ba 00 00 00 00       	mov    $0x0,%edx
+  80063a:	49 f7 f7             	div    %r15
+  80063d:	48 83 ec 08          	sub    $0x8,%rsp
+  800641:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800645:	52                   	push   %rdx
+  800646:	45 0f be c9          	movsbl %r9b,%r9d
+  80064a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80064e:	48 89 c2             	mov    %rax,%rdx
+  800651:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  800658:	00 00 00 
+  80065b:	ff d0                	call   *%rax
+  80065d:	48 83 c4 10          	add    $0x10,%rsp
+  800661:	eb 8d                	jmp    8005f0 <print_num+0x43>
+
+0000000000800663 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800663:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800667:	48 8b 06             	mov    (%rsi),%rax
+  80066a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80066e:	73 0a                	jae    80067a <sprintputch+0x17>
+        *state->start++ = ch;
+  800670:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800674:	48 89 16             	mov    %rdx,(%rsi)
+  800677:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80067a:	c3                   	ret
+
+000000000080067b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80067b:	55                   	push   %rbp
+  80067c:	48 89 e5             	mov    %rsp,%rbp
+  80067f:	48 83 ec 50          	sub    $0x50,%rsp
+  800683:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800687:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80068b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80068f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800696:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80069a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006a6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006aa:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  8006b1:	00 00 00 
+  8006b4:	ff d0                	call   *%rax
+}
+  8006b6:	c9                   	leave
+  8006b7:	c3                   	ret
+
+00000000008006b8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006b8:	55                   	push   %rbp
+  8006b9:	48 89 e5             	mov    %rsp,%rbp
+  8006bc:	41 57                	push   %r15
+  8006be:	41 56                	push   %r14
+  8006c0:	41 55                	push   %r13
+  8006c2:	41 54                	push   %r12
+  8006c4:	53                   	push   %rbx
+  8006c5:	48 83 ec 38          	sub    $0x38,%rsp
+  8006c9:	49 89 fe             	mov    %rdi,%r14
+  8006cc:	49 89 f5             	mov    %rsi,%r13
+  8006cf:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006d2:	48 8b 01             	mov    (%rcx),%rax
+  8006d5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006d9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006e5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006e9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006ed:	0f b6 3b             	movzbl (%rbx),%edi
+  8006f0:	40 80 ff 25          	cmp    $0x25,%dil
+  8006f4:	74 18                	je     80070e <vprintfmt+0x56>
+            if (!ch) return;
+  8006f6:	40 84 ff             	test   %dil,%dil
+  8006f9:	0f 84 04 07 00 00    	je     800e03 <vprintfmt+0x74b>
+            putch(ch, put_arg);
+  8006ff:	40 0f b6 ff          	movzbl %dil,%edi
+  800703:	4c 89 ee             	mov    %r13,%rsi
+  800706:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800709:	4c 89 e3             	mov    %r12,%rbx
+  80070c:	eb db                	jmp    8006e9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80070e:	be 00 00 00 00       	mov    $0x0,%esi
+  800713:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800717:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80071c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800722:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800729:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80072d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800732:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800737:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80073a:	83 e8 23             	sub    $0x23,%eax
+  80073d:	3c 57                	cmp    $0x57,%al
+  80073f:	0f 87 a4 06 00 00    	ja     800de9 <vprintfmt+0x731>
+  800745:	0f b6 c0             	movzbl %al,%eax
+  800748:	48 b9 e0 52 80 00 00 	movabs $0x8052e0,%rcx
+  80074f:	00 00 00 
+  800752:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800755:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800758:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80075c:	eb cf                	jmp    80072d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80075e:	49 89 dc             	mov    %rbx,%r12
+  800761:	be 01 00 00 00       	mov    $0x1,%esi
+  800766:	eb c5                	jmp    80072d <vprintfmt+0x75>
+            padc = ch;
+  800768:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80076c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80076f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800772:	eb b9                	jmp    80072d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800774:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800777:	83 f8 2f             	cmp    $0x2f,%eax
+  80077a:	77 24                	ja     8007a0 <vprintfmt+0xe8>
+  80077c:	89 c1                	mov    %eax,%ecx
+  80077e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800782:	83 c0 08             	add    $0x8,%eax
+  800785:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800788:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80078b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80078e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800792:	79 99                	jns    80072d <vprintfmt+0x75>
+                width = precision;
+  800794:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800798:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80079e:	eb 8d                	jmp    80072d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007a0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007a4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ac:	eb da                	jmp    800788 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007ae:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007b3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007b7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007bd:	3c 39                	cmp    $0x39,%al
+  8007bf:	77 1c                	ja     8007dd <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007c1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007c5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007c9:	0f b6 c0             	movzbl %al,%eax
+  8007cc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007d1:	0f b6 03             	movzbl (%rbx),%eax
+  8007d4:	3c 39                	cmp    $0x39,%al
+  8007d6:	76 e9                	jbe    8007c1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007d8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007db:	eb b1                	jmp    80078e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007dd:	49 89 dc             	mov    %rbx,%r12
+  8007e0:	eb ac                	jmp    80078e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007e2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007e5:	85 c9                	test   %ecx,%ecx
+  8007e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ec:	0f 49 c1             	cmovns %ecx,%eax
+  8007ef:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007f2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007f5:	e9 33 ff ff ff       	jmp    80072d <vprintfmt+0x75>
+            lflag++;
+  8007fa:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007fd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800800:	e9 28 ff ff ff       	jmp    80072d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800805:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800808:	83 f8 2f             	cmp    $0x2f,%eax
+  80080b:	77 19                	ja     800826 <vprintfmt+0x16e>
+  80080d:	89 c2                	mov    %eax,%edx
+  80080f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800813:	83 c0 08             	add    $0x8,%eax
+  800816:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800819:	8b 3a                	mov    (%rdx),%edi
+  80081b:	4c 89 ee             	mov    %r13,%rsi
+  80081e:	41 ff d6             	call   *%r14
+            break;
+  800821:	e9 c3 fe ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800826:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800832:	eb e5                	jmp    800819 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800834:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800837:	83 f8 2f             	cmp    $0x2f,%eax
+  80083a:	77 5a                	ja     800896 <vprintfmt+0x1de>
+  80083c:	89 c2                	mov    %eax,%edx
+  80083e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800842:	83 c0 08             	add    $0x8,%eax
+  800845:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800848:	8b 02                	mov    (%rdx),%eax
+  80084a:	89 c1                	mov    %eax,%ecx
+  80084c:	f7 d9                	neg    %ecx
+  80084e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800851:	83 f9 13             	cmp    $0x13,%ecx
+  800854:	7f 4e                	jg     8008a4 <vprintfmt+0x1ec>
+  800856:	48 63 c1             	movslq %ecx,%rax
+  800859:	48 ba a0 55 80 00 00 	movabs $0x8055a0,%rdx
+  800860:	00 00 00 
+  800863:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800867:	48 85 c0             	test   %rax,%rax
+  80086a:	74 38                	je     8008a4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80086c:	48 89 c1             	mov    %rax,%rcx
+  80086f:	48 ba 19 58 80 00 00 	movabs $0x805819,%rdx
+  800876:	00 00 00 
+  800879:	4c 89 ee             	mov    %r13,%rsi
+  80087c:	4c 89 f7             	mov    %r14,%rdi
+  80087f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800884:	49 b8 7b 06 80 00 00 	movabs $0x80067b,%r8
+  80088b:	00 00 00 
+  80088e:	41 ff d0             	call   *%r8
+  800891:	e9 53 fe ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800896:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a2:	eb a4                	jmp    800848 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008a4:	48 ba 6c 51 80 00 00 	movabs $0x80516c,%rdx
+  8008ab:	00 00 00 
+  8008ae:	4c 89 ee             	mov    %r13,%rsi
+  8008b1:	4c 89 f7             	mov    %r14,%rdi
+  8008b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b9:	49 b8 7b 06 80 00 00 	movabs $0x80067b,%r8
+  8008c0:	00 00 00 
+  8008c3:	41 ff d0             	call   *%r8
+  8008c6:	e9 1e fe ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d1:	77 36                	ja     800909 <vprintfmt+0x251>
+  8008d3:	89 c2                	mov    %eax,%edx
+  8008d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d9:	83 c0 08             	add    $0x8,%eax
+  8008dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008df:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8008e2:	48 85 f6             	test   %rsi,%rsi
+  8008e5:	48 b8 65 51 80 00 00 	movabs $0x805165,%rax
+  8008ec:	00 00 00 
+  8008ef:	48 0f 45 c6          	cmovne %rsi,%rax
+  8008f3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008f7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008fb:	7e 06                	jle    800903 <vprintfmt+0x24b>
+  8008fd:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800901:	75 14                	jne    800917 <vprintfmt+0x25f>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800903:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800907:	eb 5b                	jmp    800964 <vprintfmt+0x2ac>
+            const char *ptr = va_arg(aq, char *);
+  800909:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800911:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800915:	eb c8                	jmp    8008df <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800917:	49 63 f7             	movslq %r15d,%rsi
+  80091a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80091e:	48 b8 bd 0e 80 00 00 	movabs $0x800ebd,%rax
+  800925:	00 00 00 
+  800928:	ff d0                	call   *%rax
+  80092a:	48 89 c2             	mov    %rax,%rdx
+  80092d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800930:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800932:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800935:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800938:	85 c0                	test   %eax,%eax
+  80093a:	7e c7                	jle    800903 <vprintfmt+0x24b>
+  80093c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800941:	4c 89 ee             	mov    %r13,%rsi
+  800944:	44 89 e7             	mov    %r12d,%edi
+  800947:	41 ff d6             	call   *%r14
+  80094a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80094e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800951:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800954:	75 eb                	jne    800941 <vprintfmt+0x289>
+  800956:	eb ab                	jmp    800903 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800958:	0f b6 f8             	movzbl %al,%edi
+  80095b:	4c 89 ee             	mov    %r13,%rsi
+  80095e:	41 ff d6             	call   *%r14
+            for (;(precision < 0 || --precision >= 0) && (ch = *ptr++) ; width--) {
+  800961:	4c 89 e2             	mov    %r12,%rdx
+  800964:	45 85 ff             	test   %r15d,%r15d
+  800967:	78 06                	js     80096f <vprintfmt+0x2b7>
+  800969:	41 83 ef 01          	sub    $0x1,%r15d
+  80096d:	78 23                	js     800992 <vprintfmt+0x2da>
+  80096f:	4c 8d 62 01          	lea    0x1(%rdx),%r12
+  800973:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800979:	84 c0                	test   %al,%al
+  80097b:	74 15                	je     800992 <vprintfmt+0x2da>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80097d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800981:	74 d5                	je     800958 <vprintfmt+0x2a0>
+  800983:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800986:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80098b:	80 fa 5e             	cmp    $0x5e,%dl
+  80098e:	77 cb                	ja     80095b <vprintfmt+0x2a3>
+  800990:	eb c6                	jmp    800958 <vprintfmt+0x2a0>
+  800992:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800995:	8b 75 a0             	mov    -0x60(%rbp),%esi
+  800998:	01 f0                	add    %esi,%eax
+  80099a:	29 d0                	sub    %edx,%eax
+            while (width-- > 0) putch(' ', put_arg);
+  80099c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009a0:	85 c0                	test   %eax,%eax
+  8009a2:	0f 8e 41 fd ff ff    	jle    8006e9 <vprintfmt+0x31>
+  8009a8:	4c 89 ee             	mov    %r13,%rsi
+  8009ab:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009b0:	41 ff d6             	call   *%r14
+  8009b3:	41 83 ec 01          	sub    $0x1,%r12d
+  8009b7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009bb:	75 eb                	jne    8009a8 <vprintfmt+0x2f0>
+  8009bd:	e9 27 fd ff ff       	jmp    8006e9 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c2:	40 84 f6             	test   %sil,%sil
+  8009c5:	75 26                	jne    8009ed <vprintfmt+0x335>
+    switch (lflag) {
+  8009c7:	85 d2                	test   %edx,%edx
+  8009c9:	74 59                	je     800a24 <vprintfmt+0x36c>
+  8009cb:	83 fa 01             	cmp    $0x1,%edx
+  8009ce:	74 7b                	je     800a4b <vprintfmt+0x393>
+        return va_arg(*ap, long long);
+  8009d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d6:	0f 87 96 00 00 00    	ja     800a72 <vprintfmt+0x3ba>
+  8009dc:	89 c2                	mov    %eax,%edx
+  8009de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e2:	83 c0 08             	add    $0x8,%eax
+  8009e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e8:	4c 8b 22             	mov    (%rdx),%r12
+  8009eb:	eb 17                	jmp    800a04 <vprintfmt+0x34c>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f3:	77 21                	ja     800a16 <vprintfmt+0x35e>
+  8009f5:	89 c2                	mov    %eax,%edx
+  8009f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fb:	83 c0 08             	add    $0x8,%eax
+  8009fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a01:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a04:	4d 85 e4             	test   %r12,%r12
+  800a07:	78 7a                	js     800a83 <vprintfmt+0x3cb>
+            num = i;
+  800a09:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a0c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a11:	e9 b5 02 00 00       	jmp    800ccb <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800a16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a22:	eb dd                	jmp    800a01 <vprintfmt+0x349>
+        return va_arg(*ap, int);
+  800a24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a27:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2a:	77 11                	ja     800a3d <vprintfmt+0x385>
+  800a2c:	89 c2                	mov    %eax,%edx
+  800a2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a32:	83 c0 08             	add    $0x8,%eax
+  800a35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a38:	4c 63 22             	movslq (%rdx),%r12
+  800a3b:	eb c7                	jmp    800a04 <vprintfmt+0x34c>
+  800a3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a49:	eb ed                	jmp    800a38 <vprintfmt+0x380>
+        return va_arg(*ap, long);
+  800a4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a51:	77 11                	ja     800a64 <vprintfmt+0x3ac>
+  800a53:	89 c2                	mov    %eax,%edx
+  800a55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a59:	83 c0 08             	add    $0x8,%eax
+  800a5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5f:	4c 8b 22             	mov    (%rdx),%r12
+  800a62:	eb a0                	jmp    800a04 <vprintfmt+0x34c>
+  800a64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a70:	eb ed                	jmp    800a5f <vprintfmt+0x3a7>
+        return va_arg(*ap, long long);
+  800a72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7e:	e9 65 ff ff ff       	jmp    8009e8 <vprintfmt+0x330>
+                putch('-', put_arg);
+  800a83:	4c 89 ee             	mov    %r13,%rsi
+  800a86:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a8b:	41 ff d6             	call   *%r14
+                i = -i;
+  800a8e:	49 f7 dc             	neg    %r12
+  800a91:	e9 73 ff ff ff       	jmp    800a09 <vprintfmt+0x351>
+    if (zflag) return va_arg(*ap, size_t);
+  800a96:	40 84 f6             	test   %sil,%sil
+  800a99:	75 32                	jne    800acd <vprintfmt+0x415>
+    switch (lflag) {
+  800a9b:	85 d2                	test   %edx,%edx
+  800a9d:	74 5d                	je     800afc <vprintfmt+0x444>
+  800a9f:	83 fa 01             	cmp    $0x1,%edx
+  800aa2:	0f 84 82 00 00 00    	je     800b2a <vprintfmt+0x472>
+        return va_arg(*ap, unsigned long long);
+  800aa8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aab:	83 f8 2f             	cmp    $0x2f,%eax
+  800aae:	0f 87 a5 00 00 00    	ja     800b59 <vprintfmt+0x4a1>
+  800ab4:	89 c2                	mov    %eax,%edx
+  800ab6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aba:	83 c0 08             	add    $0x8,%eax
+  800abd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ac3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ac8:	e9 fe 01 00 00       	jmp    800ccb <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800acd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad3:	77 19                	ja     800aee <vprintfmt+0x436>
+  800ad5:	89 c2                	mov    %eax,%edx
+  800ad7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800adb:	83 c0 08             	add    $0x8,%eax
+  800ade:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ae9:	e9 dd 01 00 00       	jmp    800ccb <vprintfmt+0x613>
+  800aee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afa:	eb e5                	jmp    800ae1 <vprintfmt+0x429>
+        return va_arg(*ap, unsigned int);
+  800afc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aff:	83 f8 2f             	cmp    $0x2f,%eax
+  800b02:	77 18                	ja     800b1c <vprintfmt+0x464>
+  800b04:	89 c2                	mov    %eax,%edx
+  800b06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0a:	83 c0 08             	add    $0x8,%eax
+  800b0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b10:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b12:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b17:	e9 af 01 00 00       	jmp    800ccb <vprintfmt+0x613>
+  800b1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b28:	eb e6                	jmp    800b10 <vprintfmt+0x458>
+        return va_arg(*ap, unsigned long);
+  800b2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b30:	77 19                	ja     800b4b <vprintfmt+0x493>
+  800b32:	89 c2                	mov    %eax,%edx
+  800b34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b38:	83 c0 08             	add    $0x8,%eax
+  800b3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b41:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b46:	e9 80 01 00 00       	jmp    800ccb <vprintfmt+0x613>
+  800b4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b57:	eb e5                	jmp    800b3e <vprintfmt+0x486>
+        return va_arg(*ap, unsigned long long);
+  800b59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b65:	e9 56 ff ff ff       	jmp    800ac0 <vprintfmt+0x408>
+    if (zflag) return va_arg(*ap, size_t);
+  800b6a:	40 84 f6             	test   %sil,%sil
+  800b6d:	75 2e                	jne    800b9d <vprintfmt+0x4e5>
+    switch (lflag) {
+  800b6f:	85 d2                	test   %edx,%edx
+  800b71:	0f 84 b3 00 00 00    	je     800c2a <vprintfmt+0x572>
+  800b77:	83 fa 01             	cmp    $0x1,%edx
+  800b7a:	0f 84 d3 00 00 00    	je     800c53 <vprintfmt+0x59b>
+        return va_arg(*ap, unsigned long long);
+  800b80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b83:	83 f8 2f             	cmp    $0x2f,%eax
+  800b86:	0f 87 f1 00 00 00    	ja     800c7d <vprintfmt+0x5c5>
+  800b8c:	89 c2                	mov    %eax,%edx
+  800b8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b92:	83 c0 08             	add    $0x8,%eax
+  800b95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b98:	48 8b 02             	mov    (%rdx),%rax
+  800b9b:	eb 17                	jmp    800bb4 <vprintfmt+0x4fc>
+    if (zflag) return va_arg(*ap, size_t);
+  800b9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba3:	77 77                	ja     800c1c <vprintfmt+0x564>
+  800ba5:	89 c2                	mov    %eax,%edx
+  800ba7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bab:	83 c0 08             	add    $0x8,%eax
+  800bae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb1:	48 8b 02             	mov    (%rdx),%rax
+            int max_oct_deg = 1, buf = num;
+  800bb4:	89 c2                	mov    %eax,%edx
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800bb6:	83 f8 07             	cmp    $0x7,%eax
+  800bb9:	0f 8e cf 00 00 00    	jle    800c8e <vprintfmt+0x5d6>
+            int max_oct_deg = 1, buf = num;
+  800bbf:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            while (buf > 7) max_oct_deg *= 8, buf /= 8;
+  800bc5:	44 89 e7             	mov    %r12d,%edi
+  800bc8:	41 c1 e4 03          	shl    $0x3,%r12d
+  800bcc:	89 d1                	mov    %edx,%ecx
+  800bce:	8d 72 07             	lea    0x7(%rdx),%esi
+  800bd1:	85 d2                	test   %edx,%edx
+  800bd3:	0f 48 d6             	cmovs  %esi,%edx
+  800bd6:	c1 fa 03             	sar    $0x3,%edx
+  800bd9:	83 f9 3f             	cmp    $0x3f,%ecx
+  800bdc:	7f e7                	jg     800bc5 <vprintfmt+0x50d>
+            while (max_oct_deg) {
+  800bde:	85 ff                	test   %edi,%edi
+  800be0:	0f 84 03 fb ff ff    	je     8006e9 <vprintfmt+0x31>
+                putch((char)(num / max_oct_deg + '0'), put_arg);
+  800be6:	49 63 f4             	movslq %r12d,%rsi
+  800be9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bee:	48 f7 f6             	div    %rsi
+  800bf1:	49 89 d7             	mov    %rdx,%r15
+  800bf4:	83 c0 30             	add    $0x30,%eax
+  800bf7:	0f be f8             	movsbl %al,%edi
+  800bfa:	4c 89 ee             	mov    %r13,%rsi
+  800bfd:	41 ff d6             	call   *%r14
+                num %= max_oct_deg;
+  800c00:	4c 89 f8             	mov    %r15,%rax
+                max_oct_deg /= 8;
+  800c03:	41 8d 54 24 07       	lea    0x7(%r12),%edx
+  800c08:	45 85 e4             	test   %r12d,%r12d
+  800c0b:	41 0f 49 d4          	cmovns %r12d,%edx
+  800c0f:	c1 fa 03             	sar    $0x3,%edx
+  800c12:	41 89 d4             	mov    %edx,%r12d
+            while (max_oct_deg) {
+  800c15:	75 cf                	jne    800be6 <vprintfmt+0x52e>
+  800c17:	e9 cd fa ff ff       	jmp    8006e9 <vprintfmt+0x31>
+    if (zflag) return va_arg(*ap, size_t);
+  800c1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c28:	eb 87                	jmp    800bb1 <vprintfmt+0x4f9>
+        return va_arg(*ap, unsigned int);
+  800c2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c30:	77 13                	ja     800c45 <vprintfmt+0x58d>
+  800c32:	89 c2                	mov    %eax,%edx
+  800c34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c38:	83 c0 08             	add    $0x8,%eax
+  800c3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3e:	8b 02                	mov    (%rdx),%eax
+  800c40:	e9 6f ff ff ff       	jmp    800bb4 <vprintfmt+0x4fc>
+  800c45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c51:	eb eb                	jmp    800c3e <vprintfmt+0x586>
+        return va_arg(*ap, unsigned long);
+  800c53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c56:	83 f8 2f             	cmp    $0x2f,%eax
+  800c59:	77 14                	ja     800c6f <vprintfmt+0x5b7>
+  800c5b:	89 c2                	mov    %eax,%edx
+  800c5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c61:	83 c0 08             	add    $0x8,%eax
+  800c64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c67:	48 8b 02             	mov    (%rdx),%rax
+  800c6a:	e9 45 ff ff ff       	jmp    800bb4 <vprintfmt+0x4fc>
+  800c6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c7b:	eb ea                	jmp    800c67 <vprintfmt+0x5af>
+        return va_arg(*ap, unsigned long long);
+  800c7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c89:	e9 0a ff ff ff       	jmp    800b98 <vprintfmt+0x4e0>
+            int max_oct_deg = 1, buf = num;
+  800c8e:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  800c94:	e9 4d ff ff ff       	jmp    800be6 <vprintfmt+0x52e>
+            putch('0', put_arg);
+  800c99:	4c 89 ee             	mov    %r13,%rsi
+  800c9c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ca1:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ca4:	4c 89 ee             	mov    %r13,%rsi
+  800ca7:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cac:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800caf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb2:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb5:	77 47                	ja     800cfe <vprintfmt+0x646>
+  800cb7:	89 c2                	mov    %eax,%edx
+  800cb9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cbd:	83 c0 08             	add    $0x8,%eax
+  800cc0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ccb:	48 83 ec 08          	sub    $0x8,%rsp
+  800ccf:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cd3:	0f 94 c0             	sete   %al
+  800cd6:	0f b6 c0             	movzbl %al,%eax
+  800cd9:	50                   	push   %rax
+  800cda:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cdf:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ce3:	4c 89 ee             	mov    %r13,%rsi
+  800ce6:	4c 89 f7             	mov    %r14,%rdi
+  800ce9:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  800cf0:	00 00 00 
+  800cf3:	ff d0                	call   *%rax
+            break;
+  800cf5:	48 83 c4 10          	add    $0x10,%rsp
+  800cf9:	e9 eb f9 ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cfe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d0a:	eb b7                	jmp    800cc3 <vprintfmt+0x60b>
+    if (zflag) return va_arg(*ap, size_t);
+  800d0c:	40 84 f6             	test   %sil,%sil
+  800d0f:	75 2b                	jne    800d3c <vprintfmt+0x684>
+    switch (lflag) {
+  800d11:	85 d2                	test   %edx,%edx
+  800d13:	74 56                	je     800d6b <vprintfmt+0x6b3>
+  800d15:	83 fa 01             	cmp    $0x1,%edx
+  800d18:	74 7f                	je     800d99 <vprintfmt+0x6e1>
+        return va_arg(*ap, unsigned long long);
+  800d1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d20:	0f 87 a2 00 00 00    	ja     800dc8 <vprintfmt+0x710>
+  800d26:	89 c2                	mov    %eax,%edx
+  800d28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2c:	83 c0 08             	add    $0x8,%eax
+  800d2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d32:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d35:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d3a:	eb 8f                	jmp    800ccb <vprintfmt+0x613>
+    if (zflag) return va_arg(*ap, size_t);
+  800d3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d42:	77 19                	ja     800d5d <vprintfmt+0x6a5>
+  800d44:	89 c2                	mov    %eax,%edx
+  800d46:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4a:	83 c0 08             	add    $0x8,%eax
+  800d4d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d50:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d53:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d58:	e9 6e ff ff ff       	jmp    800ccb <vprintfmt+0x613>
+  800d5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d69:	eb e5                	jmp    800d50 <vprintfmt+0x698>
+        return va_arg(*ap, unsigned int);
+  800d6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d6e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d71:	77 18                	ja     800d8b <vprintfmt+0x6d3>
+  800d73:	89 c2                	mov    %eax,%edx
+  800d75:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d79:	83 c0 08             	add    $0x8,%eax
+  800d7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d7f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d81:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d86:	e9 40 ff ff ff       	jmp    800ccb <vprintfmt+0x613>
+  800d8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d97:	eb e6                	jmp    800d7f <vprintfmt+0x6c7>
+        return va_arg(*ap, unsigned long);
+  800d99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d9f:	77 19                	ja     800dba <vprintfmt+0x702>
+  800da1:	89 c2                	mov    %eax,%edx
+  800da3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800da7:	83 c0 08             	add    $0x8,%eax
+  800daa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800db0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800db5:	e9 11 ff ff ff       	jmp    800ccb <vprintfmt+0x613>
+  800dba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc6:	eb e5                	jmp    800dad <vprintfmt+0x6f5>
+        return va_arg(*ap, unsigned long long);
+  800dc8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dcc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd4:	e9 59 ff ff ff       	jmp    800d32 <vprintfmt+0x67a>
+            putch(ch, put_arg);
+  800dd9:	4c 89 ee             	mov    %r13,%rsi
+  800ddc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800de1:	41 ff d6             	call   *%r14
+            break;
+  800de4:	e9 00 f9 ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800de9:	4c 89 ee             	mov    %r13,%rsi
+  800dec:	bf 25 00 00 00       	mov    $0x25,%edi
+  800df1:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800df4:	48 83 eb 01          	sub    $0x1,%rbx
+  800df8:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dfc:	75 f6                	jne    800df4 <vprintfmt+0x73c>
+  800dfe:	e9 e6 f8 ff ff       	jmp    8006e9 <vprintfmt+0x31>
+}
+  800e03:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e07:	5b                   	pop    %rbx
+  800e08:	41 5c                	pop    %r12
+  800e0a:	41 5d                	pop    %r13
+  800e0c:	41 5e                	pop    %r14
+  800e0e:	41 5f                	pop    %r15
+  800e10:	5d                   	pop    %rbp
+  800e11:	c3                   	ret
+
+0000000000800e12 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e12:	55                   	push   %rbp
+  800e13:	48 89 e5             	mov    %rsp,%rbp
+  800e16:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e1a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e1e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e23:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e27:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e2e:	48 85 ff             	test   %rdi,%rdi
+  800e31:	74 2b                	je     800e5e <vsnprintf+0x4c>
+  800e33:	48 85 f6             	test   %rsi,%rsi
+  800e36:	74 26                	je     800e5e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e38:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e3c:	48 bf 63 06 80 00 00 	movabs $0x800663,%rdi
+  800e43:	00 00 00 
+  800e46:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  800e4d:	00 00 00 
+  800e50:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e56:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e59:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e5c:	c9                   	leave
+  800e5d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e63:	eb f7                	jmp    800e5c <vsnprintf+0x4a>
+
+0000000000800e65 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e65:	55                   	push   %rbp
+  800e66:	48 89 e5             	mov    %rsp,%rbp
+  800e69:	48 83 ec 50          	sub    $0x50,%rsp
+  800e6d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e71:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e75:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e79:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e80:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e88:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e8c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e90:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e94:	48 b8 12 0e 80 00 00 	movabs $0x800e12,%rax
+  800e9b:	00 00 00 
+  800e9e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ea0:	c9                   	leave
+  800ea1:	c3                   	ret
+
+0000000000800ea2 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ea2:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ea5:	74 10                	je     800eb7 <strlen+0x15>
+    size_t n = 0;
+  800ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800eac:	48 83 c0 01          	add    $0x1,%rax
+  800eb0:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800eb4:	75 f6                	jne    800eac <strlen+0xa>
+  800eb6:	c3                   	ret
+    size_t n = 0;
+  800eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ebc:	c3                   	ret
+
+0000000000800ebd <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ebd:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ec0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ec5:	48 85 f6             	test   %rsi,%rsi
+  800ec8:	74 11                	je     800edb <strnlen+0x1e>
+  800eca:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ece:	74 0c                	je     800edc <strnlen+0x1f>
+  800ed0:	48 83 c2 01          	add    $0x1,%rdx
+  800ed4:	48 39 d0             	cmp    %rdx,%rax
+  800ed7:	75 f1                	jne    800eca <strnlen+0xd>
+  800ed9:	eb 04                	jmp    800edf <strnlen+0x22>
+  800edb:	c3                   	ret
+  800edc:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800edf:	c3                   	ret
+
+0000000000800ee0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ee0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ee3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800eec:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800eef:	48 83 c2 01          	add    $0x1,%rdx
+  800ef3:	84 c9                	test   %cl,%cl
+  800ef5:	75 f1                	jne    800ee8 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ef7:	c3                   	ret
+
+0000000000800ef8 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ef8:	55                   	push   %rbp
+  800ef9:	48 89 e5             	mov    %rsp,%rbp
+  800efc:	41 54                	push   %r12
+  800efe:	53                   	push   %rbx
+  800eff:	48 89 fb             	mov    %rdi,%rbx
+  800f02:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f05:	48 b8 a2 0e 80 00 00 	movabs $0x800ea2,%rax
+  800f0c:	00 00 00 
+  800f0f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f11:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f15:	4c 89 e6             	mov    %r12,%rsi
+  800f18:	48 b8 e0 0e 80 00 00 	movabs $0x800ee0,%rax
+  800f1f:	00 00 00 
+  800f22:	ff d0                	call   *%rax
+    return dst;
+}
+  800f24:	48 89 d8             	mov    %rbx,%rax
+  800f27:	5b                   	pop    %rbx
+  800f28:	41 5c                	pop    %r12
+  800f2a:	5d                   	pop    %rbp
+  800f2b:	c3                   	ret
+
+0000000000800f2c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f2c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f2f:	48 85 d2             	test   %rdx,%rdx
+  800f32:	74 1f                	je     800f53 <strncpy+0x27>
+  800f34:	48 01 fa             	add    %rdi,%rdx
+  800f37:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f3a:	48 83 c1 01          	add    $0x1,%rcx
+  800f3e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f42:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f46:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f4a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f4e:	48 39 ca             	cmp    %rcx,%rdx
+  800f51:	75 e7                	jne    800f3a <strncpy+0xe>
+    }
+    return ret;
+}
+  800f53:	c3                   	ret
+
+0000000000800f54 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f54:	48 89 f8             	mov    %rdi,%rax
+  800f57:	48 85 d2             	test   %rdx,%rdx
+  800f5a:	74 24                	je     800f80 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f5c:	48 83 ea 01          	sub    $0x1,%rdx
+  800f60:	74 1b                	je     800f7d <strlcpy+0x29>
+  800f62:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f66:	0f b6 16             	movzbl (%rsi),%edx
+  800f69:	84 d2                	test   %dl,%dl
+  800f6b:	74 10                	je     800f7d <strlcpy+0x29>
+            *dst++ = *src++;
+  800f6d:	48 83 c6 01          	add    $0x1,%rsi
+  800f71:	48 83 c0 01          	add    $0x1,%rax
+  800f75:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f78:	48 39 c8             	cmp    %rcx,%rax
+  800f7b:	75 e9                	jne    800f66 <strlcpy+0x12>
+        *dst = '\0';
+  800f7d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f80:	48 29 f8             	sub    %rdi,%rax
+}
+  800f83:	c3                   	ret
+
+0000000000800f84 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f84:	0f b6 07             	movzbl (%rdi),%eax
+  800f87:	84 c0                	test   %al,%al
+  800f89:	74 13                	je     800f9e <strcmp+0x1a>
+  800f8b:	38 06                	cmp    %al,(%rsi)
+  800f8d:	75 0f                	jne    800f9e <strcmp+0x1a>
+  800f8f:	48 83 c7 01          	add    $0x1,%rdi
+  800f93:	48 83 c6 01          	add    $0x1,%rsi
+  800f97:	0f b6 07             	movzbl (%rdi),%eax
+  800f9a:	84 c0                	test   %al,%al
+  800f9c:	75 ed                	jne    800f8b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f9e:	0f b6 c0             	movzbl %al,%eax
+  800fa1:	0f b6 16             	movzbl (%rsi),%edx
+  800fa4:	29 d0                	sub    %edx,%eax
+}
+  800fa6:	c3                   	ret
+
+0000000000800fa7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fa7:	48 85 d2             	test   %rdx,%rdx
+  800faa:	74 1f                	je     800fcb <strncmp+0x24>
+  800fac:	0f b6 07             	movzbl (%rdi),%eax
+  800faf:	84 c0                	test   %al,%al
+  800fb1:	74 1e                	je     800fd1 <strncmp+0x2a>
+  800fb3:	3a 06                	cmp    (%rsi),%al
+  800fb5:	75 1a                	jne    800fd1 <strncmp+0x2a>
+  800fb7:	48 83 c7 01          	add    $0x1,%rdi
+  800fbb:	48 83 c6 01          	add    $0x1,%rsi
+  800fbf:	48 83 ea 01          	sub    $0x1,%rdx
+  800fc3:	75 e7                	jne    800fac <strncmp+0x5>
+
+    if (!n) return 0;
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fca:	c3                   	ret
+  800fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd0:	c3                   	ret
+  800fd1:	48 85 d2             	test   %rdx,%rdx
+  800fd4:	74 09                	je     800fdf <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fd6:	0f b6 07             	movzbl (%rdi),%eax
+  800fd9:	0f b6 16             	movzbl (%rsi),%edx
+  800fdc:	29 d0                	sub    %edx,%eax
+  800fde:	c3                   	ret
+    if (!n) return 0;
+  800fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe4:	c3                   	ret
+
+0000000000800fe5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fe5:	0f b6 17             	movzbl (%rdi),%edx
+  800fe8:	84 d2                	test   %dl,%dl
+  800fea:	74 18                	je     801004 <strchr+0x1f>
+        if (*str == c) {
+  800fec:	0f be d2             	movsbl %dl,%edx
+  800fef:	39 f2                	cmp    %esi,%edx
+  800ff1:	74 17                	je     80100a <strchr+0x25>
+    for (; *str; str++) {
+  800ff3:	48 83 c7 01          	add    $0x1,%rdi
+  800ff7:	0f b6 17             	movzbl (%rdi),%edx
+  800ffa:	84 d2                	test   %dl,%dl
+  800ffc:	75 ee                	jne    800fec <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801003:	c3                   	ret
+  801004:	b8 00 00 00 00       	mov    $0x0,%eax
+  801009:	c3                   	ret
+  80100a:	48 89 f8             	mov    %rdi,%rax
+}
+  80100d:	c3                   	ret
+
+000000000080100e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80100e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801011:	0f b6 17             	movzbl (%rdi),%edx
+  801014:	84 d2                	test   %dl,%dl
+  801016:	74 13                	je     80102b <strfind+0x1d>
+  801018:	0f be d2             	movsbl %dl,%edx
+  80101b:	39 f2                	cmp    %esi,%edx
+  80101d:	74 0b                	je     80102a <strfind+0x1c>
+  80101f:	48 83 c0 01          	add    $0x1,%rax
+  801023:	0f b6 10             	movzbl (%rax),%edx
+  801026:	84 d2                	test   %dl,%dl
+  801028:	75 ee                	jne    801018 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80102a:	c3                   	ret
+  80102b:	c3                   	ret
+
+000000000080102c <strstr>:
+
+char *
+strstr(const char *s, const char *sbs) {
+  80102c:	55                   	push   %rbp
+  80102d:	48 89 e5             	mov    %rsp,%rbp
+  801030:	41 57                	push   %r15
+  801032:	41 56                	push   %r14
+  801034:	41 55                	push   %r13
+  801036:	41 54                	push   %r12
+  801038:	53                   	push   %rbx
+  801039:	48 83 ec 08          	sub    $0x8,%rsp
+  80103d:	49 89 ff             	mov    %rdi,%r15
+    char c, sc;
+	size_t len;
+	if ((c = *sbs++) != 0) {
+  801040:	44 0f b6 2e          	movzbl (%rsi),%r13d
+  801044:	45 84 ed             	test   %r13b,%r13b
+  801047:	75 12                	jne    80105b <strstr+0x2f>
+			} while (sc != c);
+		} while (strncmp(s, sbs, len) != 0);
+		s--;
+	}
+	return (char *)s;
+}
+  801049:	4c 89 f8             	mov    %r15,%rax
+  80104c:	48 83 c4 08          	add    $0x8,%rsp
+  801050:	5b                   	pop    %rbx
+  801051:	41 5c                	pop    %r12
+  801053:	41 5d                	pop    %r13
+  801055:	41 5e                	pop    %r14
+  801057:	41 5f                	pop    %r15
+  801059:	5d                   	pop    %rbp
+  80105a:	c3                   	ret
+	if ((c = *sbs++) != 0) {
+  80105b:	4c 8d 66 01          	lea    0x1(%rsi),%r12
+		len = strlen(sbs);
+  80105f:	4c 89 e7             	mov    %r12,%rdi
+  801062:	48 b8 a2 0e 80 00 00 	movabs $0x800ea2,%rax
+  801069:	00 00 00 
+  80106c:	ff d0                	call   *%rax
+  80106e:	49 89 c6             	mov    %rax,%r14
+				if ((sc = *s++) == 0)
+  801071:	49 8d 5f 01          	lea    0x1(%r15),%rbx
+  801075:	41 0f b6 07          	movzbl (%r15),%eax
+		} while (strncmp(s, sbs, len) != 0);
+  801079:	49 bf a7 0f 80 00 00 	movabs $0x800fa7,%r15
+  801080:	00 00 00 
+				if ((sc = *s++) == 0)
+  801083:	84 c0                	test   %al,%al
+  801085:	75 14                	jne    80109b <strstr+0x6f>
+					return NULL;
+  801087:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80108d:	eb ba                	jmp    801049 <strstr+0x1d>
+				if ((sc = *s++) == 0)
+  80108f:	48 83 c3 01          	add    $0x1,%rbx
+  801093:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  801097:	84 c0                	test   %al,%al
+  801099:	74 1b                	je     8010b6 <strstr+0x8a>
+			} while (sc != c);
+  80109b:	41 38 c5             	cmp    %al,%r13b
+  80109e:	75 ef                	jne    80108f <strstr+0x63>
+		} while (strncmp(s, sbs, len) != 0);
+  8010a0:	4c 89 f2             	mov    %r14,%rdx
+  8010a3:	4c 89 e6             	mov    %r12,%rsi
+  8010a6:	48 89 df             	mov    %rbx,%rdi
+  8010a9:	41 ff d7             	call   *%r15
+  8010ac:	85 c0                	test   %eax,%eax
+  8010ae:	75 df                	jne    80108f <strstr+0x63>
+  8010b0:	4c 8d 7b ff          	lea    -0x1(%rbx),%r15
+  8010b4:	eb 93                	jmp    801049 <strstr+0x1d>
+					return NULL;
+  8010b6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8010bc:	eb 8b                	jmp    801049 <strstr+0x1d>
+
+00000000008010be <tolower>:
+    }
+    return d;
+}
+
+int
+tolower(int c) {
+  8010be:	89 f8                	mov    %edi,%eax
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+  8010c0:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+  8010c3:	8d 57 20             	lea    0x20(%rdi),%edx
+  8010c6:	83 f9 1a             	cmp    $0x1a,%ecx
+  8010c9:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8010cc:	c3                   	ret
+
+00000000008010cd <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+  8010cd:	55                   	push   %rbp
+  8010ce:	48 89 e5             	mov    %rsp,%rbp
+  8010d1:	41 57                	push   %r15
+  8010d3:	41 56                	push   %r14
+  8010d5:	41 55                	push   %r13
+  8010d7:	41 54                	push   %r12
+  8010d9:	53                   	push   %rbx
+  8010da:	48 83 ec 08          	sub    $0x8,%rsp
+    if (p1 == p2)
+  8010de:	48 39 f7             	cmp    %rsi,%rdi
+  8010e1:	74 49                	je     80112c <strcasecmp+0x5f>
+  8010e3:	49 89 fd             	mov    %rdi,%r13
+  8010e6:	49 89 f4             	mov    %rsi,%r12
+    while ((result = tolower(*p1) - tolower(*p2++)) == 0)
+  8010e9:	49 bf be 10 80 00 00 	movabs $0x8010be,%r15
+  8010f0:	00 00 00 
+  8010f3:	45 0f b6 75 00       	movzbl 0x0(%r13),%r14d
+  8010f8:	41 0f b6 fe          	movzbl %r14b,%edi
+  8010fc:	41 ff d7             	call   *%r15
+  8010ff:	89 c3                	mov    %eax,%ebx
+  801101:	49 83 c4 01          	add    $0x1,%r12
+  801105:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  80110b:	41 ff d7             	call   *%r15
+  80110e:	29 c3                	sub    %eax,%ebx
+  801110:	75 09                	jne    80111b <strcasecmp+0x4e>
+        if (*p1++ == '\0')
+  801112:	49 83 c5 01          	add    $0x1,%r13
+  801116:	45 84 f6             	test   %r14b,%r14b
+  801119:	75 d8                	jne    8010f3 <strcasecmp+0x26>
+}
+  80111b:	89 d8                	mov    %ebx,%eax
+  80111d:	48 83 c4 08          	add    $0x8,%rsp
+  801121:	5b                   	pop    %rbx
+  801122:	41 5c                	pop    %r12
+  801124:	41 5d                	pop    %r13
+  801126:	41 5e                	pop    %r14
+  801128:	41 5f                	pop    %r15
+  80112a:	5d                   	pop    %rbp
+  80112b:	c3                   	ret
+        return 0;
+  80112c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801131:	eb e8                	jmp    80111b <strcasecmp+0x4e>
+
+0000000000801133 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  801133:	55                   	push   %rbp
+  801134:	48 89 e5             	mov    %rsp,%rbp
+  801137:	41 57                	push   %r15
+  801139:	41 56                	push   %r14
+  80113b:	41 55                	push   %r13
+  80113d:	41 54                	push   %r12
+  80113f:	53                   	push   %rbx
+  801140:	48 83 ec 08          	sub    $0x8,%rsp
+    for ( ; n != 0; n--)
+  801144:	48 85 d2             	test   %rdx,%rdx
+  801147:	74 4f                	je     801198 <strncasecmp+0x65>
+  801149:	49 89 fc             	mov    %rdi,%r12
+  80114c:	49 89 f5             	mov    %rsi,%r13
+  80114f:	4c 8d 3c 17          	lea    (%rdi,%rdx,1),%r15
+        int c1 = tolower(*p1++);
+  801153:	49 be be 10 80 00 00 	movabs $0x8010be,%r14
+  80115a:	00 00 00 
+  80115d:	49 83 c4 01          	add    $0x1,%r12
+  801161:	41 0f b6 7c 24 ff    	movzbl -0x1(%r12),%edi
+  801167:	41 ff d6             	call   *%r14
+  80116a:	89 c3                	mov    %eax,%ebx
+        int c2 = tolower(*p2++);
+  80116c:	49 83 c5 01          	add    $0x1,%r13
+  801170:	41 0f b6 7d ff       	movzbl -0x1(%r13),%edi
+  801175:	41 ff d6             	call   *%r14
+        if (((d = c1 - c2) != 0) || (c2 == '\0'))
+  801178:	29 c3                	sub    %eax,%ebx
+  80117a:	85 c0                	test   %eax,%eax
+  80117c:	74 09                	je     801187 <strncasecmp+0x54>
+  80117e:	85 db                	test   %ebx,%ebx
+  801180:	75 05                	jne    801187 <strncasecmp+0x54>
+    for ( ; n != 0; n--)
+  801182:	4d 39 fc             	cmp    %r15,%r12
+  801185:	75 d6                	jne    80115d <strncasecmp+0x2a>
+}
+  801187:	89 d8                	mov    %ebx,%eax
+  801189:	48 83 c4 08          	add    $0x8,%rsp
+  80118d:	5b                   	pop    %rbx
+  80118e:	41 5c                	pop    %r12
+  801190:	41 5d                	pop    %r13
+  801192:	41 5e                	pop    %r14
+  801194:	41 5f                	pop    %r15
+  801196:	5d                   	pop    %rbp
+  801197:	c3                   	ret
+    int d = 0;
+  801198:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return d;
+  80119d:	eb e8                	jmp    801187 <strncasecmp+0x54>
+
+000000000080119f <toupper>:
+
+int toupper(int c) {
+  80119f:	89 f8                	mov    %edi,%eax
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+  8011a1:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  8011a4:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8011a7:	83 f9 1a             	cmp    $0x1a,%ecx
+  8011aa:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8011ad:	c3                   	ret
+
+00000000008011ae <isspace>:
+
+int isspace(int c) {
+    return c == ' ';
+  8011ae:	83 ff 20             	cmp    $0x20,%edi
+  8011b1:	0f 94 c0             	sete   %al
+  8011b4:	0f b6 c0             	movzbl %al,%eax
+}
+  8011b7:	c3                   	ret
+
+00000000008011b8 <abs>:
+int atoi(const char *str) {
+    return strtol(str, 0, 0);
+}
+
+int abs(int n) {
+    return n > 0 ? n : -n; 
+  8011b8:	89 f8                	mov    %edi,%eax
+  8011ba:	f7 d8                	neg    %eax
+  8011bc:	0f 48 c7             	cmovs  %edi,%eax
+}
+  8011bf:	c3                   	ret
+
+00000000008011c0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8011c0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8011c3:	48 89 f8             	mov    %rdi,%rax
+  8011c6:	48 f7 d8             	neg    %rax
+  8011c9:	83 e0 07             	and    $0x7,%eax
+  8011cc:	49 89 d1             	mov    %rdx,%r9
+  8011cf:	49 29 c1             	sub    %rax,%r9
+  8011d2:	78 36                	js     80120a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8011d4:	40 0f b6 c6          	movzbl %sil,%eax
+  8011d8:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8011df:	01 01 01 
+  8011e2:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8011e6:	40 f6 c7 07          	test   $0x7,%dil
+  8011ea:	75 38                	jne    801224 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8011ec:	4c 89 c9             	mov    %r9,%rcx
+  8011ef:	48 c1 f9 03          	sar    $0x3,%rcx
+  8011f3:	74 0c                	je     801201 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8011f5:	fc                   	cld
+  8011f6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8011f9:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8011fd:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801201:	4d 85 c9             	test   %r9,%r9
+  801204:	75 45                	jne    80124b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801206:	4c 89 c0             	mov    %r8,%rax
+  801209:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80120a:	48 85 d2             	test   %rdx,%rdx
+  80120d:	74 f7                	je     801206 <memset+0x46>
+  80120f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801212:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801215:	48 83 c0 01          	add    $0x1,%rax
+  801219:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80121d:	48 39 c2             	cmp    %rax,%rdx
+  801220:	75 f3                	jne    801215 <memset+0x55>
+  801222:	eb e2                	jmp    801206 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801224:	40 f6 c7 01          	test   $0x1,%dil
+  801228:	74 06                	je     801230 <memset+0x70>
+  80122a:	88 07                	mov    %al,(%rdi)
+  80122c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801230:	40 f6 c7 02          	test   $0x2,%dil
+  801234:	74 07                	je     80123d <memset+0x7d>
+  801236:	66 89 07             	mov    %ax,(%rdi)
+  801239:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80123d:	40 f6 c7 04          	test   $0x4,%dil
+  801241:	74 a9                	je     8011ec <memset+0x2c>
+  801243:	89 07                	mov    %eax,(%rdi)
+  801245:	48 83 c7 04          	add    $0x4,%rdi
+  801249:	eb a1                	jmp    8011ec <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80124b:	41 f6 c1 04          	test   $0x4,%r9b
+  80124f:	74 06                	je     801257 <memset+0x97>
+  801251:	89 07                	mov    %eax,(%rdi)
+  801253:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801257:	41 f6 c1 02          	test   $0x2,%r9b
+  80125b:	74 07                	je     801264 <memset+0xa4>
+  80125d:	66 89 07             	mov    %ax,(%rdi)
+  801260:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801264:	41 f6 c1 01          	test   $0x1,%r9b
+  801268:	74 9c                	je     801206 <memset+0x46>
+  80126a:	88 07                	mov    %al,(%rdi)
+  80126c:	eb 98                	jmp    801206 <memset+0x46>
+
+000000000080126e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80126e:	48 89 f8             	mov    %rdi,%rax
+  801271:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801274:	48 39 fe             	cmp    %rdi,%rsi
+  801277:	73 3b                	jae    8012b4 <memmove+0x46>
+  801279:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80127d:	48 39 d7             	cmp    %rdx,%rdi
+  801280:	73 32                	jae    8012b4 <memmove+0x46>
+        s += n;
+        d += n;
+  801282:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801286:	48 89 d6             	mov    %rdx,%rsi
+  801289:	48 09 fe             	or     %rdi,%rsi
+  80128c:	48 09 ce             	or     %rcx,%rsi
+  80128f:	40 f6 c6 07          	test   $0x7,%sil
+  801293:	75 12                	jne    8012a7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801295:	48 83 ef 08          	sub    $0x8,%rdi
+  801299:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80129d:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012a1:	fd                   	std
+  8012a2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012a5:	fc                   	cld
+  8012a6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012a7:	48 83 ef 01          	sub    $0x1,%rdi
+  8012ab:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8012af:	fd                   	std
+  8012b0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8012b2:	eb f1                	jmp    8012a5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012b4:	48 89 f2             	mov    %rsi,%rdx
+  8012b7:	48 09 c2             	or     %rax,%rdx
+  8012ba:	48 09 ca             	or     %rcx,%rdx
+  8012bd:	f6 c2 07             	test   $0x7,%dl
+  8012c0:	75 0c                	jne    8012ce <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8012c2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012c6:	48 89 c7             	mov    %rax,%rdi
+  8012c9:	fc                   	cld
+  8012ca:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8012cd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8012ce:	48 89 c7             	mov    %rax,%rdi
+  8012d1:	fc                   	cld
+  8012d2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8012d4:	c3                   	ret
+
+00000000008012d5 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8012d5:	55                   	push   %rbp
+  8012d6:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8012d9:	48 b8 6e 12 80 00 00 	movabs $0x80126e,%rax
+  8012e0:	00 00 00 
+  8012e3:	ff d0                	call   *%rax
+}
+  8012e5:	5d                   	pop    %rbp
+  8012e6:	c3                   	ret
+
+00000000008012e7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8012e7:	55                   	push   %rbp
+  8012e8:	48 89 e5             	mov    %rsp,%rbp
+  8012eb:	41 57                	push   %r15
+  8012ed:	41 56                	push   %r14
+  8012ef:	41 55                	push   %r13
+  8012f1:	41 54                	push   %r12
+  8012f3:	53                   	push   %rbx
+  8012f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8012f8:	49 89 fe             	mov    %rdi,%r14
+  8012fb:	49 89 f7             	mov    %rsi,%r15
+  8012fe:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801301:	48 89 f7             	mov    %rsi,%rdi
+  801304:	48 b8 a2 0e 80 00 00 	movabs $0x800ea2,%rax
+  80130b:	00 00 00 
+  80130e:	ff d0                	call   *%rax
+  801310:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801313:	48 89 de             	mov    %rbx,%rsi
+  801316:	4c 89 f7             	mov    %r14,%rdi
+  801319:	48 b8 bd 0e 80 00 00 	movabs $0x800ebd,%rax
+  801320:	00 00 00 
+  801323:	ff d0                	call   *%rax
+  801325:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801328:	48 39 c3             	cmp    %rax,%rbx
+  80132b:	74 36                	je     801363 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80132d:	48 89 d8             	mov    %rbx,%rax
+  801330:	4c 29 e8             	sub    %r13,%rax
+  801333:	49 39 c4             	cmp    %rax,%r12
+  801336:	73 31                	jae    801369 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801338:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80133d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801341:	4c 89 fe             	mov    %r15,%rsi
+  801344:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  80134b:	00 00 00 
+  80134e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801350:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801354:	48 83 c4 08          	add    $0x8,%rsp
+  801358:	5b                   	pop    %rbx
+  801359:	41 5c                	pop    %r12
+  80135b:	41 5d                	pop    %r13
+  80135d:	41 5e                	pop    %r14
+  80135f:	41 5f                	pop    %r15
+  801361:	5d                   	pop    %rbp
+  801362:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801363:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801367:	eb eb                	jmp    801354 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801369:	48 83 eb 01          	sub    $0x1,%rbx
+  80136d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801371:	48 89 da             	mov    %rbx,%rdx
+  801374:	4c 89 fe             	mov    %r15,%rsi
+  801377:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  80137e:	00 00 00 
+  801381:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801383:	49 01 de             	add    %rbx,%r14
+  801386:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80138b:	eb c3                	jmp    801350 <strlcat+0x69>
+
+000000000080138d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80138d:	48 85 d2             	test   %rdx,%rdx
+  801390:	74 2d                	je     8013bf <memcmp+0x32>
+  801392:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801397:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80139b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013a0:	44 38 c1             	cmp    %r8b,%cl
+  8013a3:	75 0f                	jne    8013b4 <memcmp+0x27>
+    while (n-- > 0) {
+  8013a5:	48 83 c0 01          	add    $0x1,%rax
+  8013a9:	48 39 c2             	cmp    %rax,%rdx
+  8013ac:	75 e9                	jne    801397 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8013ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8013b4:	0f b6 c1             	movzbl %cl,%eax
+  8013b7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8013bb:	44 29 c0             	sub    %r8d,%eax
+  8013be:	c3                   	ret
+    return 0;
+  8013bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013c4:	c3                   	ret
+
+00000000008013c5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8013c5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8013c9:	48 39 c7             	cmp    %rax,%rdi
+  8013cc:	73 0f                	jae    8013dd <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8013ce:	40 38 37             	cmp    %sil,(%rdi)
+  8013d1:	74 0e                	je     8013e1 <memfind+0x1c>
+    for (; src < end; src++) {
+  8013d3:	48 83 c7 01          	add    $0x1,%rdi
+  8013d7:	48 39 f8             	cmp    %rdi,%rax
+  8013da:	75 f2                	jne    8013ce <memfind+0x9>
+  8013dc:	c3                   	ret
+  8013dd:	48 89 f8             	mov    %rdi,%rax
+  8013e0:	c3                   	ret
+  8013e1:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8013e4:	c3                   	ret
+
+00000000008013e5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8013e5:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8013e8:	0f b6 37             	movzbl (%rdi),%esi
+  8013eb:	40 80 fe 20          	cmp    $0x20,%sil
+  8013ef:	74 06                	je     8013f7 <strtol+0x12>
+  8013f1:	40 80 fe 09          	cmp    $0x9,%sil
+  8013f5:	75 13                	jne    80140a <strtol+0x25>
+  8013f7:	48 83 c7 01          	add    $0x1,%rdi
+  8013fb:	0f b6 37             	movzbl (%rdi),%esi
+  8013fe:	40 80 fe 20          	cmp    $0x20,%sil
+  801402:	74 f3                	je     8013f7 <strtol+0x12>
+  801404:	40 80 fe 09          	cmp    $0x9,%sil
+  801408:	74 ed                	je     8013f7 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80140a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80140d:	83 e0 fd             	and    $0xfffffffd,%eax
+  801410:	3c 01                	cmp    $0x1,%al
+  801412:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801416:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80141c:	75 0f                	jne    80142d <strtol+0x48>
+  80141e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801421:	74 14                	je     801437 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801423:	85 d2                	test   %edx,%edx
+  801425:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80142a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80142d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801432:	4c 63 ca             	movslq %edx,%r9
+  801435:	eb 36                	jmp    80146d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801437:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80143b:	74 0f                	je     80144c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80143d:	85 d2                	test   %edx,%edx
+  80143f:	75 ec                	jne    80142d <strtol+0x48>
+        s++;
+  801441:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801445:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80144a:	eb e1                	jmp    80142d <strtol+0x48>
+        s += 2;
+  80144c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801450:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801455:	eb d6                	jmp    80142d <strtol+0x48>
+            dig -= '0';
+  801457:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80145a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80145e:	41 39 d0             	cmp    %edx,%r8d
+  801461:	7d 21                	jge    801484 <strtol+0x9f>
+        val = val * base + dig;
+  801463:	49 0f af c1          	imul   %r9,%rax
+  801467:	0f b6 c9             	movzbl %cl,%ecx
+  80146a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80146d:	48 83 c7 01          	add    $0x1,%rdi
+  801471:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801475:	80 f9 39             	cmp    $0x39,%cl
+  801478:	76 dd                	jbe    801457 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80147a:	80 f9 7b             	cmp    $0x7b,%cl
+  80147d:	77 05                	ja     801484 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80147f:	83 e9 57             	sub    $0x57,%ecx
+  801482:	eb d6                	jmp    80145a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801484:	4d 85 d2             	test   %r10,%r10
+  801487:	74 03                	je     80148c <strtol+0xa7>
+  801489:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80148c:	48 89 c2             	mov    %rax,%rdx
+  80148f:	48 f7 da             	neg    %rdx
+  801492:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801496:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80149a:	c3                   	ret
+
+000000000080149b <atoi>:
+int atoi(const char *str) {
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+    return strtol(str, 0, 0);
+  80149f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a9:	48 b8 e5 13 80 00 00 	movabs $0x8013e5,%rax
+  8014b0:	00 00 00 
+  8014b3:	ff d0                	call   *%rax
+}
+  8014b5:	5d                   	pop    %rbp
+  8014b6:	c3                   	ret
+
+00000000008014b7 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8014b7:	55                   	push   %rbp
+  8014b8:	48 89 e5             	mov    %rsp,%rbp
+  8014bb:	53                   	push   %rbx
+  8014bc:	48 89 fa             	mov    %rdi,%rdx
+  8014bf:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c2:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014cc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014dc:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8014de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e2:	c9                   	leave
+  8014e3:	c3                   	ret
+
+00000000008014e4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8014e4:	55                   	push   %rbp
+  8014e5:	48 89 e5             	mov    %rsp,%rbp
+  8014e8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801502:	be 00 00 00 00       	mov    $0x0,%esi
+  801507:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80150f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801513:	c9                   	leave
+  801514:	c3                   	ret
+
+0000000000801515 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801515:	55                   	push   %rbp
+  801516:	48 89 e5             	mov    %rsp,%rbp
+  801519:	53                   	push   %rbx
+  80151a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80151e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801521:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801526:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801530:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801535:	be 00 00 00 00       	mov    $0x0,%esi
+  80153a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801540:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801542:	48 85 c0             	test   %rax,%rax
+  801545:	7f 06                	jg     80154d <sys_env_destroy+0x38>
+}
+  801547:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154b:	c9                   	leave
+  80154c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154d:	49 89 c0             	mov    %rax,%r8
+  801550:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801555:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  80155c:	00 00 00 
+  80155f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801564:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  80156b:	00 00 00 
+  80156e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801573:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  80157a:	00 00 00 
+  80157d:	41 ff d1             	call   *%r9
+
+0000000000801580 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+  801584:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801585:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80158a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801594:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801599:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159e:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a9:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+
+00000000008015b1 <sys_yield>:
+
+void
+sys_yield(void) {
+  8015b1:	55                   	push   %rbp
+  8015b2:	48 89 e5             	mov    %rsp,%rbp
+  8015b5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b6:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015da:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e0:	c9                   	leave
+  8015e1:	c3                   	ret
+
+00000000008015e2 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8015e2:	55                   	push   %rbp
+  8015e3:	48 89 e5             	mov    %rsp,%rbp
+  8015e6:	53                   	push   %rbx
+  8015e7:	48 89 fa             	mov    %rdi,%rdx
+  8015ea:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015f2:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8015f9:	00 00 00 
+  8015fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801601:	be 00 00 00 00       	mov    $0x0,%esi
+  801606:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80160e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801612:	c9                   	leave
+  801613:	c3                   	ret
+
+0000000000801614 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801614:	55                   	push   %rbp
+  801615:	48 89 e5             	mov    %rsp,%rbp
+  801618:	53                   	push   %rbx
+  801619:	49 89 f8             	mov    %rdi,%r8
+  80161c:	48 89 d3             	mov    %rdx,%rbx
+  80161f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801622:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801627:	4c 89 c2             	mov    %r8,%rdx
+  80162a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80162d:	be 00 00 00 00       	mov    $0x0,%esi
+  801632:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801638:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80163a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80163e:	c9                   	leave
+  80163f:	c3                   	ret
+
+0000000000801640 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801640:	55                   	push   %rbp
+  801641:	48 89 e5             	mov    %rsp,%rbp
+  801644:	53                   	push   %rbx
+  801645:	48 83 ec 08          	sub    $0x8,%rsp
+  801649:	89 f8                	mov    %edi,%eax
+  80164b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80164e:	48 63 f9             	movslq %ecx,%rdi
+  801651:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801654:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801659:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165c:	be 00 00 00 00       	mov    $0x0,%esi
+  801661:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801667:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801669:	48 85 c0             	test   %rax,%rax
+  80166c:	7f 06                	jg     801674 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80166e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801672:	c9                   	leave
+  801673:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801674:	49 89 c0             	mov    %rax,%r8
+  801677:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80167c:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  801683:	00 00 00 
+  801686:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80168b:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801692:	00 00 00 
+  801695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169a:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  8016a1:	00 00 00 
+  8016a4:	41 ff d1             	call   *%r9
+
+00000000008016a7 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016a7:	55                   	push   %rbp
+  8016a8:	48 89 e5             	mov    %rsp,%rbp
+  8016ab:	53                   	push   %rbx
+  8016ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b0:	89 f8                	mov    %edi,%eax
+  8016b2:	49 89 f2             	mov    %rsi,%r10
+  8016b5:	48 89 cf             	mov    %rcx,%rdi
+  8016b8:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8016bb:	48 63 da             	movslq %edx,%rbx
+  8016be:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016c6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c9:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8016cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ce:	48 85 c0             	test   %rax,%rax
+  8016d1:	7f 06                	jg     8016d9 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d9:	49 89 c0             	mov    %rax,%r8
+  8016dc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8016e1:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  8016e8:	00 00 00 
+  8016eb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016f0:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  8016f7:	00 00 00 
+  8016fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ff:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  801706:	00 00 00 
+  801709:	41 ff d1             	call   *%r9
+
+000000000080170c <sys_map_physical_region>:
+
+int
+sys_map_physical_region(uintptr_t pa, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80170c:	55                   	push   %rbp
+  80170d:	48 89 e5             	mov    %rsp,%rbp
+  801710:	53                   	push   %rbx
+  801711:	48 83 ec 08          	sub    $0x8,%rsp
+  801715:	49 89 f9             	mov    %rdi,%r9
+  801718:	89 f0                	mov    %esi,%eax
+  80171a:	48 89 d3             	mov    %rdx,%rbx
+  80171d:	48 89 cf             	mov    %rcx,%rdi
+    int res = syscall(SYS_map_physical_region, 1, pa, dstenv, (uintptr_t)dstva, size, perm, 0);
+  801720:	49 63 f0             	movslq %r8d,%rsi
+  801723:	48 63 c8             	movslq %eax,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801726:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80172b:	4c 89 ca             	mov    %r9,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801734:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801736:	48 85 c0             	test   %rax,%rax
+  801739:	7f 06                	jg     801741 <sys_map_physical_region+0x35>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80173b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80173f:	c9                   	leave
+  801740:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801741:	49 89 c0             	mov    %rax,%r8
+  801744:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801749:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  801750:	00 00 00 
+  801753:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801758:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  80175f:	00 00 00 
+  801762:	b8 00 00 00 00       	mov    $0x0,%eax
+  801767:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  80176e:	00 00 00 
+  801771:	41 ff d1             	call   *%r9
+
+0000000000801774 <sys_alloc_dma_region>:
+
+int
+sys_alloc_dma_region(envid_t envid, void *va, int class, int perm, physaddr_t *pa) {
+  801774:	55                   	push   %rbp
+  801775:	48 89 e5             	mov    %rsp,%rbp
+  801778:	53                   	push   %rbx
+  801779:	89 f8                	mov    %edi,%eax
+  80177b:	4d 89 c1             	mov    %r8,%r9
+    int64_t res = syscall(SYS_alloc_dma_region, 0, envid, (uintptr_t)va, class, perm, 0, 0);
+  80177e:	48 63 f9             	movslq %ecx,%rdi
+  801781:	48 63 da             	movslq %edx,%rbx
+  801784:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801787:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80178c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80178f:	be 00 00 00 00       	mov    $0x0,%esi
+  801794:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80179a:	cd 30                	int    $0x30
+    if (res < 0) return res;
+  80179c:	89 c2                	mov    %eax,%edx
+  80179e:	48 85 c0             	test   %rax,%rax
+  8017a1:	78 0d                	js     8017b0 <sys_alloc_dma_region+0x3c>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (envid == CURENVID)
+        platform_asan_unpoison(va, PAGE_SIZE << class);
+#endif
+    if (pa) *pa = res;
+    return 0;
+  8017a3:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (pa) *pa = res;
+  8017a8:	4d 85 c9             	test   %r9,%r9
+  8017ab:	74 03                	je     8017b0 <sys_alloc_dma_region+0x3c>
+  8017ad:	49 89 01             	mov    %rax,(%r9)
+}
+  8017b0:	89 d0                	mov    %edx,%eax
+  8017b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b6:	c9                   	leave
+  8017b7:	c3                   	ret
+
+00000000008017b8 <sys_set_cache_region>:
+
+int
+sys_set_cache_region(envid_t envid, void *va, size_t size) {
+  8017b8:	55                   	push   %rbp
+  8017b9:	48 89 e5             	mov    %rsp,%rbp
+  8017bc:	53                   	push   %rbx
+  8017bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8017c1:	48 89 f1             	mov    %rsi,%rcx
+  8017c4:	48 89 d3             	mov    %rdx,%rbx
+    return syscall(SYS_set_cache_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8017c7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ca:	b8 08 00 00 00       	mov    $0x8,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017e1:	48 85 c0             	test   %rax,%rax
+  8017e4:	7f 06                	jg     8017ec <sys_set_cache_region+0x34>
+}
+  8017e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ea:	c9                   	leave
+  8017eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017ec:	49 89 c0             	mov    %rax,%r8
+  8017ef:	b9 08 00 00 00       	mov    $0x8,%ecx
+  8017f4:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  8017fb:	00 00 00 
+  8017fe:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801803:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  80180a:	00 00 00 
+  80180d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801812:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  801819:	00 00 00 
+  80181c:	41 ff d1             	call   *%r9
+
+000000000080181f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80181f:	55                   	push   %rbp
+  801820:	48 89 e5             	mov    %rsp,%rbp
+  801823:	53                   	push   %rbx
+  801824:	48 83 ec 08          	sub    $0x8,%rsp
+  801828:	48 89 f1             	mov    %rsi,%rcx
+  80182b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80182e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801831:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801836:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80183b:	be 00 00 00 00       	mov    $0x0,%esi
+  801840:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801846:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801848:	48 85 c0             	test   %rax,%rax
+  80184b:	7f 06                	jg     801853 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80184d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801851:	c9                   	leave
+  801852:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801853:	49 89 c0             	mov    %rax,%r8
+  801856:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80185b:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  801862:	00 00 00 
+  801865:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80186a:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801871:	00 00 00 
+  801874:	b8 00 00 00 00       	mov    $0x0,%eax
+  801879:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  801880:	00 00 00 
+  801883:	41 ff d1             	call   *%r9
+
+0000000000801886 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801886:	55                   	push   %rbp
+  801887:	48 89 e5             	mov    %rsp,%rbp
+  80188a:	53                   	push   %rbx
+  80188b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80188f:	48 63 ce             	movslq %esi,%rcx
+  801892:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801895:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80189a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8018a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018af:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018b1:	48 85 c0             	test   %rax,%rax
+  8018b4:	7f 06                	jg     8018bc <sys_env_set_status+0x36>
+}
+  8018b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ba:	c9                   	leave
+  8018bb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018bc:	49 89 c0             	mov    %rax,%r8
+  8018bf:	b9 0c 00 00 00       	mov    $0xc,%ecx
+  8018c4:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  8018cb:	00 00 00 
+  8018ce:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018d3:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  8018da:	00 00 00 
+  8018dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e2:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  8018e9:	00 00 00 
+  8018ec:	41 ff d1             	call   *%r9
+
+00000000008018ef <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8018ef:	55                   	push   %rbp
+  8018f0:	48 89 e5             	mov    %rsp,%rbp
+  8018f3:	53                   	push   %rbx
+  8018f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8018f8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8018fb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018fe:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801903:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801908:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80190d:	be 00 00 00 00       	mov    $0x0,%esi
+  801912:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801918:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80191a:	48 85 c0             	test   %rax,%rax
+  80191d:	7f 06                	jg     801925 <sys_env_set_trapframe+0x36>
+}
+  80191f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801923:	c9                   	leave
+  801924:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801925:	49 89 c0             	mov    %rax,%r8
+  801928:	b9 0d 00 00 00       	mov    $0xd,%ecx
+  80192d:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  801934:	00 00 00 
+  801937:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80193c:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801943:	00 00 00 
+  801946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194b:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  801952:	00 00 00 
+  801955:	41 ff d1             	call   *%r9
+
+0000000000801958 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801958:	55                   	push   %rbp
+  801959:	48 89 e5             	mov    %rsp,%rbp
+  80195c:	53                   	push   %rbx
+  80195d:	48 83 ec 08          	sub    $0x8,%rsp
+  801961:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801964:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801967:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80196c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801971:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801976:	be 00 00 00 00       	mov    $0x0,%esi
+  80197b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801981:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801983:	48 85 c0             	test   %rax,%rax
+  801986:	7f 06                	jg     80198e <sys_env_set_pgfault_upcall+0x36>
+}
+  801988:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80198c:	c9                   	leave
+  80198d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80198e:	49 89 c0             	mov    %rax,%r8
+  801991:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801996:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  80199d:	00 00 00 
+  8019a0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019a5:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  8019ac:	00 00 00 
+  8019af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b4:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  8019bb:	00 00 00 
+  8019be:	41 ff d1             	call   *%r9
+
+00000000008019c1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019c1:	55                   	push   %rbp
+  8019c2:	48 89 e5             	mov    %rsp,%rbp
+  8019c5:	53                   	push   %rbx
+  8019c6:	89 f8                	mov    %edi,%eax
+  8019c8:	49 89 f1             	mov    %rsi,%r9
+  8019cb:	48 89 d3             	mov    %rdx,%rbx
+  8019ce:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019d1:	49 63 f0             	movslq %r8d,%rsi
+  8019d4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019d7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8019dc:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019e5:	cd 30                	int    $0x30
+}
+  8019e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019eb:	c9                   	leave
+  8019ec:	c3                   	ret
+
+00000000008019ed <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8019ed:	55                   	push   %rbp
+  8019ee:	48 89 e5             	mov    %rsp,%rbp
+  8019f1:	53                   	push   %rbx
+  8019f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8019f6:	48 89 fa             	mov    %rdi,%rdx
+  8019f9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019fc:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a06:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a0b:	be 00 00 00 00       	mov    $0x0,%esi
+  801a10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a16:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a18:	48 85 c0             	test   %rax,%rax
+  801a1b:	7f 06                	jg     801a23 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a21:	c9                   	leave
+  801a22:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a23:	49 89 c0             	mov    %rax,%r8
+  801a26:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801a2b:	48 ba 60 56 80 00 00 	movabs $0x805660,%rdx
+  801a32:	00 00 00 
+  801a35:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801a3a:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801a41:	00 00 00 
+  801a44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a49:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  801a50:	00 00 00 
+  801a53:	41 ff d1             	call   *%r9
+
+0000000000801a56 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva, size_t size) {
+  801a56:	55                   	push   %rbp
+  801a57:	48 89 e5             	mov    %rsp,%rbp
+  801a5a:	53                   	push   %rbx
+  801a5b:	48 89 fa             	mov    %rdi,%rdx
+  801a5e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a61:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a6b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a70:	be 00 00 00 00       	mov    $0x0,%esi
+  801a75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a7b:	cd 30                	int    $0x30
+    int res = syscall(SYS_ipc_try_recv, 0, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a81:	c9                   	leave
+  801a82:	c3                   	ret
+
+0000000000801a83 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801a83:	55                   	push   %rbp
+  801a84:	48 89 e5             	mov    %rsp,%rbp
+  801a87:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a88:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a92:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aa1:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801aac:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801aae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ab2:	c9                   	leave
+  801ab3:	c3                   	ret
+
+0000000000801ab4 <malloc>:
+
+void *
+malloc(size_t size) {
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801ab4:	48 85 ff             	test   %rdi,%rdi
+  801ab7:	0f 84 b6 01 00 00    	je     801c73 <malloc+0x1bf>
+malloc(size_t size) {
+  801abd:	55                   	push   %rbp
+  801abe:	48 89 e5             	mov    %rsp,%rbp
+  801ac1:	41 56                	push   %r14
+  801ac3:	41 55                	push   %r13
+  801ac5:	41 54                	push   %r12
+  801ac7:	53                   	push   %rbx
+  801ac8:	48 89 fb             	mov    %rdi,%rbx
+    if (!size || freep_size >= MAX_FREE_HEAPBLOCKS)
+  801acb:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801ad2:	00 00 00 
+  801ad5:	4c 8b 20             	mov    (%rax),%r12
+  801ad8:	49 81 fc ff ff 00 00 	cmp    $0xffff,%r12
+  801adf:	0f 87 94 01 00 00    	ja     801c79 <malloc+0x1c5>
+        return NULL;
+
+    if (real_freep_size) {
+  801ae5:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801aec:	00 00 00 
+  801aef:	48 85 c0             	test   %rax,%rax
+  801af2:	74 6b                	je     801b5f <malloc+0xab>
+        for (size_t i = 0; i < freep_size; i++)
+  801af4:	4d 85 e4             	test   %r12,%r12
+  801af7:	74 66                	je     801b5f <malloc+0xab>
+  801af9:	48 ba 48 70 80 00 00 	movabs $0x807048,%rdx
+  801b00:	00 00 00 
+  801b03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b08:	eb 0d                	jmp    801b17 <malloc+0x63>
+  801b0a:	48 83 c1 01          	add    $0x1,%rcx
+  801b0e:	48 83 c2 18          	add    $0x18,%rdx
+  801b12:	49 39 cc             	cmp    %rcx,%r12
+  801b15:	74 48                	je     801b5f <malloc+0xab>
+            if (freep[i].is_free && freep[i].size >= size) {
+  801b17:	48 83 7a 08 00       	cmpq   $0x0,0x8(%rdx)
+  801b1c:	74 ec                	je     801b0a <malloc+0x56>
+  801b1e:	48 39 1a             	cmp    %rbx,(%rdx)
+  801b21:	72 e7                	jb     801b0a <malloc+0x56>
+                real_freep_size--;
+  801b23:	48 83 e8 01          	sub    $0x1,%rax
+  801b27:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801b2e:	00 00 00 
+                freep[i].is_free = false;
+  801b31:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801b38:	00 00 00 
+  801b3b:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+  801b3f:	48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+  801b43:	48 8d 34 f2          	lea    (%rdx,%rsi,8),%rsi
+  801b47:	48 c7 46 10 00 00 00 	movq   $0x0,0x10(%rsi)
+  801b4e:	00 
+                freep[i].size = size;
+  801b4f:	48 89 5e 08          	mov    %rbx,0x8(%rsi)
+                return (void *)(freep[i].heap_addr);
+  801b53:	48 01 c8             	add    %rcx,%rax
+  801b56:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b5a:	e9 0b 01 00 00       	jmp    801c6a <malloc+0x1b6>
+            }
+    }
+
+    if (size + heap_inpage_offset > PAGE_SIZE) {
+  801b5f:	48 a1 08 60 80 00 00 	movabs 0x806008,%rax
+  801b66:	00 00 00 
+  801b69:	48 01 d8             	add    %rbx,%rax
+  801b6c:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801b72:	76 7c                	jbe    801bf0 <malloc+0x13c>
+        heap_page_ptr += PAGE_SIZE;
+  801b74:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  801b7b:	00 00 00 
+  801b7e:	4c 8b 30             	mov    (%rax),%r14
+  801b81:	49 8d 96 00 10 00 00 	lea    0x1000(%r14),%rdx
+  801b88:	48 89 10             	mov    %rdx,(%rax)
+        heap_inpage_offset = 0;
+  801b8b:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801b92:	00 00 00 
+  801b95:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        int res = sys_alloc_region(sys_getenvid(), (void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE),
+  801b9c:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+  801ba3:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801ba9:	4c 0f 45 eb          	cmovne %rbx,%r13
+  801bad:	48 b8 80 15 80 00 00 	movabs $0x801580,%rax
+  801bb4:	00 00 00 
+  801bb7:	ff d0                	call   *%rax
+  801bb9:	89 c7                	mov    %eax,%edi
+  801bbb:	49 8d 95 ff 0f 00 00 	lea    0xfff(%r13),%rdx
+  801bc2:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  801bc9:	48 b8 00 10 00 00 50 	movabs $0x5000001000,%rax
+  801bd0:	00 00 00 
+  801bd3:	49 8d 34 06          	lea    (%r14,%rax,1),%rsi
+  801bd7:	b9 26 00 00 00       	mov    $0x26,%ecx
+  801bdc:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  801be3:	00 00 00 
+  801be6:	ff d0                	call   *%rax
+                                   PROT_USER_ | PROT_R | PROT_W);
+        if (res < 0)
+  801be8:	85 c0                	test   %eax,%eax
+  801bea:	0f 88 90 00 00 00    	js     801c80 <malloc+0x1cc>
+        if (!res)
+            platform_asan_unpoison((void *)heap_ptr + heap_page_ptr, ROUNDUP(size % PAGE_SIZE ? size : size + PAGE_SIZE, PAGE_SIZE));
+#endif
+    }
+
+    freep[freep_size].heap_addr = heap_ptr + heap_page_ptr + heap_inpage_offset;
+  801bf0:	48 b9 10 60 80 00 00 	movabs $0x806010,%rcx
+  801bf7:	00 00 00 
+  801bfa:	48 8b 31             	mov    (%rcx),%rsi
+  801bfd:	48 bf 08 60 80 00 00 	movabs $0x806008,%rdi
+  801c04:	00 00 00 
+  801c07:	4c 8b 07             	mov    (%rdi),%r8
+  801c0a:	4a 8d 04 06          	lea    (%rsi,%r8,1),%rax
+  801c0e:	49 b9 00 00 00 00 50 	movabs $0x5000000000,%r9
+  801c15:	00 00 00 
+  801c18:	4a 8d 14 08          	lea    (%rax,%r9,1),%rdx
+  801c1c:	4f 8d 0c 64          	lea    (%r12,%r12,2),%r9
+  801c20:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801c27:	00 00 00 
+  801c2a:	4a 8d 04 c8          	lea    (%rax,%r9,8),%rax
+  801c2e:	48 89 10             	mov    %rdx,(%rax)
+    freep[freep_size].size = size;
+  801c31:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    freep[freep_size].is_free = false;
+  801c35:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801c3c:	00 
+    heap_inpage_offset += size % PAGE_SIZE;
+  801c3d:	48 89 d8             	mov    %rbx,%rax
+  801c40:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c45:	4c 01 c0             	add    %r8,%rax
+  801c48:	48 89 07             	mov    %rax,(%rdi)
+    heap_page_ptr += size - size % PAGE_SIZE;
+  801c4b:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  801c52:	48 01 f3             	add    %rsi,%rbx
+  801c55:	48 89 19             	mov    %rbx,(%rcx)
+
+    return (void*)(freep[freep_size++].heap_addr);
+  801c58:	49 8d 44 24 01       	lea    0x1(%r12),%rax
+  801c5d:	48 a3 28 70 80 00 00 	movabs %rax,0x807028
+  801c64:	00 00 00 
+  801c67:	48 89 d0             	mov    %rdx,%rax
+}
+  801c6a:	5b                   	pop    %rbx
+  801c6b:	41 5c                	pop    %r12
+  801c6d:	41 5d                	pop    %r13
+  801c6f:	41 5e                	pop    %r14
+  801c71:	5d                   	pop    %rbp
+  801c72:	c3                   	ret
+        return NULL;
+  801c73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c78:	c3                   	ret
+        return NULL;
+  801c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7e:	eb ea                	jmp    801c6a <malloc+0x1b6>
+            return NULL;
+  801c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c85:	eb e3                	jmp    801c6a <malloc+0x1b6>
+
+0000000000801c87 <calloc>:
+
+void *
+calloc(size_t num, size_t size) {
+  801c87:	55                   	push   %rbp
+  801c88:	48 89 e5             	mov    %rsp,%rbp
+  801c8b:	53                   	push   %rbx
+  801c8c:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t dim = num * size;
+  801c90:	48 89 fb             	mov    %rdi,%rbx
+  801c93:	48 0f af de          	imul   %rsi,%rbx
+    return memset(malloc(dim), 0, dim);
+  801c97:	48 89 df             	mov    %rbx,%rdi
+  801c9a:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+  801ca6:	48 89 c7             	mov    %rax,%rdi
+  801ca9:	48 89 da             	mov    %rbx,%rdx
+  801cac:	be 00 00 00 00       	mov    $0x0,%esi
+  801cb1:	48 b8 c0 11 80 00 00 	movabs $0x8011c0,%rax
+  801cb8:	00 00 00 
+  801cbb:	ff d0                	call   *%rax
+}
+  801cbd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cc1:	c9                   	leave
+  801cc2:	c3                   	ret
+
+0000000000801cc3 <get_allocsize>:
+
+size_t get_allocsize(void* ptr) {
+    if (freep_size == real_freep_size)
+  801cc3:	48 a1 28 70 80 00 00 	movabs 0x807028,%rax
+  801cca:	00 00 00 
+  801ccd:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801cd4:	00 00 00 
+  801cd7:	48 3b 02             	cmp    (%rdx),%rax
+  801cda:	74 4d                	je     801d29 <get_allocsize+0x66>
+        return 0;
+    for (size_t i = 0; i < freep_size; i++)
+  801cdc:	48 85 c0             	test   %rax,%rax
+  801cdf:	74 4d                	je     801d2e <get_allocsize+0x6b>
+  801ce1:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801ce8:	00 00 00 
+  801ceb:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr)
+  801cf0:	48 3b 39             	cmp    (%rcx),%rdi
+  801cf3:	74 13                	je     801d08 <get_allocsize+0x45>
+    for (size_t i = 0; i < freep_size; i++)
+  801cf5:	48 83 c2 01          	add    $0x1,%rdx
+  801cf9:	48 83 c1 18          	add    $0x18,%rcx
+  801cfd:	48 39 d0             	cmp    %rdx,%rax
+  801d00:	75 ee                	jne    801cf0 <get_allocsize+0x2d>
+            return freep[i].is_free ? 0 : freep[i].size;
+    return 0;
+  801d02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d07:	c3                   	ret
+            return freep[i].is_free ? 0 : freep[i].size;
+  801d08:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d11:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801d18:	00 00 00 
+  801d1b:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801d21:	75 0b                	jne    801d2e <get_allocsize+0x6b>
+  801d23:	48 8b 44 ce 08       	mov    0x8(%rsi,%rcx,8),%rax
+  801d28:	c3                   	ret
+        return 0;
+  801d29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d2e:	c3                   	ret
+
+0000000000801d2f <free>:
+    return newptr;
+}
+
+void
+free(void *ptr) {
+    if (!ptr)
+  801d2f:	48 85 ff             	test   %rdi,%rdi
+  801d32:	0f 84 01 01 00 00    	je     801e39 <free+0x10a>
+free(void *ptr) {
+  801d38:	55                   	push   %rbp
+  801d39:	48 89 e5             	mov    %rsp,%rbp
+        return;
+
+    if (freep_size == real_freep_size)
+  801d3c:	48 b8 28 70 80 00 00 	movabs $0x807028,%rax
+  801d43:	00 00 00 
+  801d46:	48 8b 30             	mov    (%rax),%rsi
+  801d49:	48 a1 20 70 80 00 00 	movabs 0x807020,%rax
+  801d50:	00 00 00 
+  801d53:	48 39 c6             	cmp    %rax,%rsi
+  801d56:	74 50                	je     801da8 <free+0x79>
+        panic("trying to free unallocated memory.\n");
+
+    for (size_t i = 0; i < freep_size; i++) {
+  801d58:	48 85 f6             	test   %rsi,%rsi
+  801d5b:	74 21                	je     801d7e <free+0x4f>
+  801d5d:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  801d64:	00 00 00 
+  801d67:	ba 00 00 00 00       	mov    $0x0,%edx
+        if ((uintptr_t)ptr == freep[i].heap_addr) {
+  801d6c:	48 3b 39             	cmp    (%rcx),%rdi
+  801d6f:	74 61                	je     801dd2 <free+0xa3>
+    for (size_t i = 0; i < freep_size; i++) {
+  801d71:	48 83 c2 01          	add    $0x1,%rdx
+  801d75:	48 83 c1 18          	add    $0x18,%rcx
+  801d79:	48 39 d6             	cmp    %rdx,%rsi
+  801d7c:	75 ee                	jne    801d6c <free+0x3d>
+            real_freep_size++;
+            return;
+        }
+    }
+
+    panic("trying to free invalid memory pointer.\n");
+  801d7e:	48 ba d0 56 80 00 00 	movabs $0x8056d0,%rdx
+  801d85:	00 00 00 
+  801d88:	be 12 01 00 00       	mov    $0x112,%esi
+  801d8d:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801d94:	00 00 00 
+  801d97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9c:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  801da3:	00 00 00 
+  801da6:	ff d1                	call   *%rcx
+        panic("trying to free unallocated memory.\n");
+  801da8:	48 ba 80 56 80 00 00 	movabs $0x805680,%rdx
+  801daf:	00 00 00 
+  801db2:	be 06 01 00 00       	mov    $0x106,%esi
+  801db7:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801dbe:	00 00 00 
+  801dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc6:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  801dcd:	00 00 00 
+  801dd0:	ff d1                	call   *%rcx
+            if (freep[i].is_free)
+  801dd2:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801dd6:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  801ddd:	00 00 00 
+  801de0:	48 83 7c ce 10 00    	cmpq   $0x0,0x10(%rsi,%rcx,8)
+  801de6:	75 27                	jne    801e0f <free+0xe0>
+            freep[i].is_free = true;
+  801de8:	48 8d 0c 52          	lea    (%rdx,%rdx,2),%rcx
+  801dec:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  801df3:	00 00 00 
+  801df6:	48 c7 44 ca 10 01 00 	movq   $0x1,0x10(%rdx,%rcx,8)
+  801dfd:	00 00 
+            real_freep_size++;
+  801dff:	48 83 c0 01          	add    $0x1,%rax
+  801e03:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  801e0a:	00 00 00 
+}
+  801e0d:	5d                   	pop    %rbp
+  801e0e:	c3                   	ret
+                panic("trying to free already freed memory.\n");
+  801e0f:	48 ba a8 56 80 00 00 	movabs $0x8056a8,%rdx
+  801e16:	00 00 00 
+  801e19:	be 0b 01 00 00       	mov    $0x10b,%esi
+  801e1e:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  801e25:	00 00 00 
+  801e28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2d:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  801e34:	00 00 00 
+  801e37:	ff d1                	call   *%rcx
+  801e39:	c3                   	ret
+
+0000000000801e3a <realloc>:
+realloc(void *ptr, size_t newsize) {
+  801e3a:	55                   	push   %rbp
+  801e3b:	48 89 e5             	mov    %rsp,%rbp
+  801e3e:	41 55                	push   %r13
+  801e40:	41 54                	push   %r12
+  801e42:	53                   	push   %rbx
+  801e43:	48 83 ec 08          	sub    $0x8,%rsp
+  801e47:	48 89 fb             	mov    %rdi,%rbx
+  801e4a:	49 89 f5             	mov    %rsi,%r13
+    size_t oldsize = get_allocsize(ptr);
+  801e4d:	48 b8 c3 1c 80 00 00 	movabs $0x801cc3,%rax
+  801e54:	00 00 00 
+  801e57:	ff d0                	call   *%rax
+    if (oldsize > newsize)
+  801e59:	49 39 c5             	cmp    %rax,%r13
+  801e5c:	73 0e                	jae    801e6c <realloc+0x32>
+}
+  801e5e:	48 89 d8             	mov    %rbx,%rax
+  801e61:	48 83 c4 08          	add    $0x8,%rsp
+  801e65:	5b                   	pop    %rbx
+  801e66:	41 5c                	pop    %r12
+  801e68:	41 5d                	pop    %r13
+  801e6a:	5d                   	pop    %rbp
+  801e6b:	c3                   	ret
+  801e6c:	49 89 c4             	mov    %rax,%r12
+    void *newptr = memcpy(malloc(newsize), ptr, oldsize);
+  801e6f:	4c 89 ef             	mov    %r13,%rdi
+  801e72:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  801e79:	00 00 00 
+  801e7c:	ff d0                	call   *%rax
+  801e7e:	48 89 c7             	mov    %rax,%rdi
+  801e81:	4c 89 e2             	mov    %r12,%rdx
+  801e84:	48 89 de             	mov    %rbx,%rsi
+  801e87:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  801e8e:	00 00 00 
+  801e91:	ff d0                	call   *%rax
+  801e93:	49 89 c4             	mov    %rax,%r12
+    free(ptr);
+  801e96:	48 89 df             	mov    %rbx,%rdi
+  801e99:	48 b8 2f 1d 80 00 00 	movabs $0x801d2f,%rax
+  801ea0:	00 00 00 
+  801ea3:	ff d0                	call   *%rax
+    return newptr;
+  801ea5:	4c 89 e3             	mov    %r12,%rbx
+  801ea8:	eb b4                	jmp    801e5e <realloc+0x24>
+
+0000000000801eaa <strdup>:
+
+char*
+strdup (const char *src) {
+  801eaa:	55                   	push   %rbp
+  801eab:	48 89 e5             	mov    %rsp,%rbp
+  801eae:	41 54                	push   %r12
+  801eb0:	53                   	push   %rbx
+  801eb1:	48 89 fb             	mov    %rdi,%rbx
+    size_t n = strlen(src) + 1;
+  801eb4:	48 b8 a2 0e 80 00 00 	movabs $0x800ea2,%rax
+  801ebb:	00 00 00 
+  801ebe:	ff d0                	call   *%rax
+  801ec0:	4c 8d 60 01          	lea    0x1(%rax),%r12
+    return memcpy(malloc(n), src, n);
+  801ec4:	4c 89 e7             	mov    %r12,%rdi
+  801ec7:	48 b8 b4 1a 80 00 00 	movabs $0x801ab4,%rax
+  801ece:	00 00 00 
+  801ed1:	ff d0                	call   *%rax
+  801ed3:	48 89 c7             	mov    %rax,%rdi
+  801ed6:	4c 89 e2             	mov    %r12,%rdx
+  801ed9:	48 89 de             	mov    %rbx,%rsi
+  801edc:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  801ee3:	00 00 00 
+  801ee6:	ff d0                	call   *%rax
+}
+  801ee8:	5b                   	pop    %rbx
+  801ee9:	41 5c                	pop    %r12
+  801eeb:	5d                   	pop    %rbp
+  801eec:	c3                   	ret
+
+0000000000801eed <get_cpufreq>:
+
+uint64_t
+get_cpufreq() {
+  801eed:	55                   	push   %rbp
+  801eee:	48 89 e5             	mov    %rsp,%rbp
+  801ef1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ef2:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ef7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801efc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f06:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f0b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f10:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f16:	cd 30                	int    $0x30
+    return syscall(SYS_get_cpufreq, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f1c:	c9                   	leave
+  801f1d:	c3                   	ret
+
+0000000000801f1e <get_ticks>:
+
+uint64_t
+get_ticks() {
+  801f1e:	55                   	push   %rbp
+  801f1f:	48 89 e5             	mov    %rsp,%rbp
+    if (!freq)
+  801f22:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801f29:	00 00 00 
+  801f2c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801f30:	74 26                	je     801f58 <get_ticks+0x3a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  801f32:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f34:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f38:	89 c0                	mov    %eax,%eax
+  801f3a:	48 09 c2             	or     %rax,%rdx
+        freq = get_cpufreq();
+    return read_tsc() * 1000 / freq;
+  801f3d:	48 69 c2 e8 03 00 00 	imul   $0x3e8,%rdx,%rax
+  801f44:	48 b9 40 70 98 00 00 	movabs $0x987040,%rcx
+  801f4b:	00 00 00 
+  801f4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f53:	48 f7 31             	divq   (%rcx)
+}
+  801f56:	5d                   	pop    %rbp
+  801f57:	c3                   	ret
+        freq = get_cpufreq();
+  801f58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5d:	48 ba ed 1e 80 00 00 	movabs $0x801eed,%rdx
+  801f64:	00 00 00 
+  801f67:	ff d2                	call   *%rdx
+  801f69:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801f70:	00 00 00 
+  801f73:	eb bd                	jmp    801f32 <get_ticks+0x14>
+
+0000000000801f75 <sleep>:
+
+void
+sleep(uint64_t ms) {
+  801f75:	55                   	push   %rbp
+  801f76:	48 89 e5             	mov    %rsp,%rbp
+  801f79:	53                   	push   %rbx
+  801f7a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f7e:	48 89 fb             	mov    %rdi,%rbx
+    if (!freq)
+  801f81:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801f88:	00 00 00 
+  801f8b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801f8f:	74 50                	je     801fe1 <sleep+0x6c>
+    asm volatile("rdtsc"
+  801f91:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801f93:	48 c1 e2 20          	shl    $0x20,%rdx
+  801f97:	89 c0                	mov    %eax,%eax
+  801f99:	48 89 d6             	mov    %rdx,%rsi
+  801f9c:	48 09 c6             	or     %rax,%rsi
+        freq = get_cpufreq();
+    uint64_t tick_start = read_tsc(), tick_cnt = ms * freq / 1000, g;
+  801f9f:	48 b8 40 70 98 00 00 	movabs $0x987040,%rax
+  801fa6:	00 00 00 
+  801fa9:	48 0f af 18          	imul   (%rax),%rbx
+  801fad:	48 c1 eb 03          	shr    $0x3,%rbx
+  801fb1:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  801fb8:	9b c4 20 
+  801fbb:	48 89 d8             	mov    %rbx,%rax
+  801fbe:	48 f7 e2             	mul    %rdx
+  801fc1:	48 89 d1             	mov    %rdx,%rcx
+  801fc4:	48 c1 e9 04          	shr    $0x4,%rcx
+    asm volatile("rdtsc"
+  801fc8:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  801fca:	48 c1 e2 20          	shl    $0x20,%rdx
+  801fce:	89 c0                	mov    %eax,%eax
+  801fd0:	48 09 c2             	or     %rax,%rdx
+    while((g = read_tsc() - tick_start) < tick_cnt);
+  801fd3:	48 29 f2             	sub    %rsi,%rdx
+  801fd6:	48 39 ca             	cmp    %rcx,%rdx
+  801fd9:	72 ed                	jb     801fc8 <sleep+0x53>
+}
+  801fdb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fdf:	c9                   	leave
+  801fe0:	c3                   	ret
+        freq = get_cpufreq();
+  801fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe6:	48 ba ed 1e 80 00 00 	movabs $0x801eed,%rdx
+  801fed:	00 00 00 
+  801ff0:	ff d2                	call   *%rdx
+  801ff2:	48 a3 40 70 98 00 00 	movabs %rax,0x987040
+  801ff9:	00 00 00 
+  801ffc:	eb 93                	jmp    801f91 <sleep+0x1c>
+
+0000000000801ffe <poll_kbd>:
+
+int poll_kbd() {
+  801ffe:	55                   	push   %rbp
+  801fff:	48 89 e5             	mov    %rsp,%rbp
+  802002:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802003:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802008:	ba 00 00 00 00       	mov    $0x0,%edx
+  80200d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802012:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802017:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80201c:	be 00 00 00 00       	mov    $0x0,%esi
+  802021:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802027:	cd 30                	int    $0x30
+    return syscall(SYS_poll_kbd, 0, 0, 0, 0, 0, 0, 0);
+}
+  802029:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80202d:	c9                   	leave
+  80202e:	c3                   	ret
+
+000000000080202f <draw_char>:
+
+void draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, uint32_t stride, uint8_t charcode) {
+  80202f:	55                   	push   %rbp
+  802030:	48 89 e5             	mov    %rsp,%rbp
+  802033:	53                   	push   %rbx
+  802034:	49 89 fa             	mov    %rdi,%r10
+  802037:	89 f0                	mov    %esi,%eax
+    syscall(SYS_drawchar, 0, (uintptr_t)buffer, (uint32_t)x, (uint32_t)y, (uint32_t)color, (uint32_t)stride, (uint8_t)charcode);
+  802039:	44 89 c6             	mov    %r8d,%esi
+  80203c:	89 cf                	mov    %ecx,%edi
+  80203e:	89 d3                	mov    %edx,%ebx
+  802040:	89 c1                	mov    %eax,%ecx
+    register uintptr_t _a0 asm("rax") = num,
+  802042:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802047:	4c 89 d2             	mov    %r10,%rdx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80204a:	45 0f b6 c1          	movzbl %r9b,%r8d
+    asm volatile("int %1\n"
+  80204e:	cd 30                	int    $0x30
+  802050:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802054:	c9                   	leave
+  802055:	c3                   	ret
+
+0000000000802056 <fork>:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Don't forget to set page fault handler in the child (using sys_env_set_pgfault_upcall()).
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802056:	55                   	push   %rbp
+  802057:	48 89 e5             	mov    %rsp,%rbp
+  80205a:	41 54                	push   %r12
+  80205c:	53                   	push   %rbx
+    /* Child would inherit unwritten file changes otherwise */
+    flushall();
+  80205d:	48 b8 b2 3a 80 00 00 	movabs $0x803ab2,%rax
+  802064:	00 00 00 
+  802067:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802069:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80206e:	cd 30                	int    $0x30
+  802070:	41 89 c4             	mov    %eax,%r12d
+
+    envid_t envid = sys_exofork();
+    if (envid < 0)
+  802073:	85 c0                	test   %eax,%eax
+  802075:	78 76                	js     8020ed <fork+0x97>
+        return envid;
+    if (!envid) {
+  802077:	74 7c                	je     8020f5 <fork+0x9f>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE)
+  802079:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80207f:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802086:	00 00 00 
+  802089:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80208e:	89 c2                	mov    %eax,%edx
+  802090:	be 00 00 00 00       	mov    $0x0,%esi
+  802095:	bf 00 00 00 00       	mov    $0x0,%edi
+  80209a:	48 b8 a7 16 80 00 00 	movabs $0x8016a7,%rax
+  8020a1:	00 00 00 
+  8020a4:	ff d0                	call   *%rax
+  8020a6:	85 c0                	test   %eax,%eax
+  8020a8:	75 7c                	jne    802126 <fork+0xd0>
+        || sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)
+  8020aa:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8020b1:	00 00 00 
+  8020b4:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8020bb:	44 89 e7             	mov    %r12d,%edi
+  8020be:	48 b8 58 19 80 00 00 	movabs $0x801958,%rax
+  8020c5:	00 00 00 
+  8020c8:	ff d0                	call   *%rax
+  8020ca:	85 c0                	test   %eax,%eax
+  8020cc:	75 60                	jne    80212e <fork+0xd8>
+        || sys_env_set_status(envid, ENV_RUNNABLE))
+  8020ce:	be 02 00 00 00       	mov    $0x2,%esi
+  8020d3:	44 89 e7             	mov    %r12d,%edi
+  8020d6:	48 b8 86 18 80 00 00 	movabs $0x801886,%rax
+  8020dd:	00 00 00 
+  8020e0:	ff d0                	call   *%rax
+        return -1;
+  8020e2:	85 c0                	test   %eax,%eax
+  8020e4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8020e9:	44 0f 45 e0          	cmovne %eax,%r12d
+
+    return envid;
+}
+  8020ed:	44 89 e0             	mov    %r12d,%eax
+  8020f0:	5b                   	pop    %rbx
+  8020f1:	41 5c                	pop    %r12
+  8020f3:	5d                   	pop    %rbp
+  8020f4:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8020f5:	48 b8 80 15 80 00 00 	movabs $0x801580,%rax
+  8020fc:	00 00 00 
+  8020ff:	ff d0                	call   *%rax
+  802101:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802106:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  80210d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802114:	00 00 00 
+  802117:	48 01 d0             	add    %rdx,%rax
+  80211a:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  802121:	00 00 00 
+        return 0;
+  802124:	eb c7                	jmp    8020ed <fork+0x97>
+        return -1;
+  802126:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80212c:	eb bf                	jmp    8020ed <fork+0x97>
+  80212e:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  802134:	eb b7                	jmp    8020ed <fork+0x97>
+
+0000000000802136 <sfork>:
+
+envid_t
+sfork() {
+  802136:	55                   	push   %rbp
+  802137:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80213a:	48 ba 06 57 80 00 00 	movabs $0x805706,%rdx
+  802141:	00 00 00 
+  802144:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802149:	48 bf 21 57 80 00 00 	movabs $0x805721,%rdi
+  802150:	00 00 00 
+  802153:	b8 00 00 00 00       	mov    $0x0,%eax
+  802158:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  80215f:	00 00 00 
+  802162:	ff d1                	call   *%rcx
+
+0000000000802164 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802164:	55                   	push   %rbp
+  802165:	48 89 e5             	mov    %rsp,%rbp
+  802168:	41 55                	push   %r13
+  80216a:	41 54                	push   %r12
+  80216c:	53                   	push   %rbx
+  80216d:	48 83 ec 08          	sub    $0x8,%rsp
+  802171:	49 89 fc             	mov    %rdi,%r12
+  802174:	48 89 f7             	mov    %rsi,%rdi
+  802177:	48 89 d3             	mov    %rdx,%rbx
+  80217a:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  80217d:	48 85 f6             	test   %rsi,%rsi
+  802180:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802187:	00 00 00 
+  80218a:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_recv(pg, size ? *size : PAGE_SIZE);
+  80218e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802193:	48 85 d2             	test   %rdx,%rdx
+  802196:	74 03                	je     80219b <ipc_recv+0x37>
+  802198:	48 8b 32             	mov    (%rdx),%rsi
+  80219b:	48 b8 ed 19 80 00 00 	movabs $0x8019ed,%rax
+  8021a2:	00 00 00 
+  8021a5:	ff d0                	call   *%rax
+    if (errno) {
+  8021a7:	85 c0                	test   %eax,%eax
+  8021a9:	74 1c                	je     8021c7 <ipc_recv+0x63>
+        if (from_env_store)
+  8021ab:	4d 85 e4             	test   %r12,%r12
+  8021ae:	74 08                	je     8021b8 <ipc_recv+0x54>
+            *from_env_store = 0;
+  8021b0:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8021b7:	00 
+
+        if (perm_store)
+  8021b8:	4d 85 ed             	test   %r13,%r13
+  8021bb:	74 74                	je     802231 <ipc_recv+0xcd>
+            *perm_store = 0;
+  8021bd:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8021c4:	00 
+  8021c5:	eb 6a                	jmp    802231 <ipc_recv+0xcd>
+
+        return errno;
+    } else {
+        if (from_env_store)
+  8021c7:	4d 85 e4             	test   %r12,%r12
+  8021ca:	74 14                	je     8021e0 <ipc_recv+0x7c>
+            *from_env_store = thisenv->env_ipc_from;
+  8021cc:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021d3:	00 00 00 
+  8021d6:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  8021dc:	41 89 04 24          	mov    %eax,(%r12)
+
+        if (size)
+  8021e0:	48 85 db             	test   %rbx,%rbx
+  8021e3:	74 23                	je     802208 <ipc_recv+0xa4>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8021e5:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8021ec:	00 00 00 
+  8021ef:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8021f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021fa:	85 c9                	test   %ecx,%ecx
+  8021fc:	74 07                	je     802205 <ipc_recv+0xa1>
+  8021fe:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  802205:	48 89 13             	mov    %rdx,(%rbx)
+
+        if (perm_store)
+  802208:	4d 85 ed             	test   %r13,%r13
+  80220b:	74 14                	je     802221 <ipc_recv+0xbd>
+            *perm_store = thisenv->env_ipc_perm;
+  80220d:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802214:	00 00 00 
+  802217:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  80221d:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+        return thisenv->env_ipc_value;
+  802221:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802228:	00 00 00 
+  80222b:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+    }
+    return -1;
+}
+  802231:	48 83 c4 08          	add    $0x8,%rsp
+  802235:	5b                   	pop    %rbx
+  802236:	41 5c                	pop    %r12
+  802238:	41 5d                	pop    %r13
+  80223a:	5d                   	pop    %rbp
+  80223b:	c3                   	ret
+
+000000000080223c <ipc_try_recv>:
+
+/* Like ipc_recv(), but return -E_IPC_NOT_RECV instead of
+ * blocking if nobody sends a message while other environments
+ * run for one scheduling round. */
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80223c:	55                   	push   %rbp
+  80223d:	48 89 e5             	mov    %rsp,%rbp
+  802240:	41 55                	push   %r13
+  802242:	41 54                	push   %r12
+  802244:	53                   	push   %rbx
+  802245:	48 83 ec 08          	sub    $0x8,%rsp
+  802249:	49 89 fc             	mov    %rdi,%r12
+  80224c:	48 89 f7             	mov    %rsi,%rdi
+  80224f:	48 89 d3             	mov    %rdx,%rbx
+  802252:	49 89 cd             	mov    %rcx,%r13
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  802255:	48 85 f6             	test   %rsi,%rsi
+  802258:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80225f:	00 00 00 
+  802262:	48 0f 44 f8          	cmove  %rax,%rdi
+
+    int errno = sys_ipc_try_recv(pg, size ? *size : PAGE_SIZE);
+  802266:	be 00 10 00 00       	mov    $0x1000,%esi
+  80226b:	48 85 d2             	test   %rdx,%rdx
+  80226e:	74 03                	je     802273 <ipc_try_recv+0x37>
+  802270:	48 8b 32             	mov    (%rdx),%rsi
+  802273:	48 b8 56 1a 80 00 00 	movabs $0x801a56,%rax
+  80227a:	00 00 00 
+  80227d:	ff d0                	call   *%rax
+    if (errno) {
+  80227f:	85 c0                	test   %eax,%eax
+  802281:	75 75                	jne    8022f8 <ipc_try_recv+0xbc>
+            *perm_store = 0;
+
+        return errno;
+    }
+
+    if (from_env_store)
+  802283:	4d 85 e4             	test   %r12,%r12
+  802286:	74 14                	je     80229c <ipc_try_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802288:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80228f:	00 00 00 
+  802292:	8b 80 5c 01 00 00    	mov    0x15c(%rax),%eax
+  802298:	41 89 04 24          	mov    %eax,(%r12)
+
+    if (size)
+  80229c:	48 85 db             	test   %rbx,%rbx
+  80229f:	74 23                	je     8022c4 <ipc_try_recv+0x88>
+        *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8022a1:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022a8:	00 00 00 
+  8022ab:	8b 88 60 01 00 00    	mov    0x160(%rax),%ecx
+  8022b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b6:	85 c9                	test   %ecx,%ecx
+  8022b8:	74 07                	je     8022c1 <ipc_try_recv+0x85>
+  8022ba:	48 8b 90 50 01 00 00 	mov    0x150(%rax),%rdx
+  8022c1:	48 89 13             	mov    %rdx,(%rbx)
+
+    if (perm_store)
+  8022c4:	4d 85 ed             	test   %r13,%r13
+  8022c7:	74 14                	je     8022dd <ipc_try_recv+0xa1>
+        *perm_store = thisenv->env_ipc_perm;
+  8022c9:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022d0:	00 00 00 
+  8022d3:	8b 80 60 01 00 00    	mov    0x160(%rax),%eax
+  8022d9:	41 89 45 00          	mov    %eax,0x0(%r13)
+
+    return thisenv->env_ipc_value;
+  8022dd:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8022e4:	00 00 00 
+  8022e7:	8b 80 58 01 00 00    	mov    0x158(%rax),%eax
+}
+  8022ed:	48 83 c4 08          	add    $0x8,%rsp
+  8022f1:	5b                   	pop    %rbx
+  8022f2:	41 5c                	pop    %r12
+  8022f4:	41 5d                	pop    %r13
+  8022f6:	5d                   	pop    %rbp
+  8022f7:	c3                   	ret
+        if (from_env_store)
+  8022f8:	4d 85 e4             	test   %r12,%r12
+  8022fb:	74 08                	je     802305 <ipc_try_recv+0xc9>
+            *from_env_store = 0;
+  8022fd:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802304:	00 
+        if (perm_store)
+  802305:	4d 85 ed             	test   %r13,%r13
+  802308:	74 e3                	je     8022ed <ipc_try_recv+0xb1>
+            *perm_store = 0;
+  80230a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802311:	00 
+  802312:	eb d9                	jmp    8022ed <ipc_try_recv+0xb1>
+
+0000000000802314 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802314:	55                   	push   %rbp
+  802315:	48 89 e5             	mov    %rsp,%rbp
+  802318:	41 57                	push   %r15
+  80231a:	41 56                	push   %r14
+  80231c:	41 55                	push   %r13
+  80231e:	41 54                	push   %r12
+  802320:	53                   	push   %rbx
+  802321:	48 83 ec 18          	sub    $0x18,%rsp
+  802325:	41 89 fd             	mov    %edi,%r13d
+  802328:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80232b:	48 89 d3             	mov    %rdx,%rbx
+  80232e:	49 89 cc             	mov    %rcx,%r12
+  802331:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    if (!pg)
+        pg = (void *)MAX_USER_ADDRESS;
+  802335:	48 85 d2             	test   %rdx,%rdx
+  802338:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80233f:	00 00 00 
+  802342:	48 0f 44 d8          	cmove  %rax,%rbx
+
+    int errno;
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  802346:	49 be c1 19 80 00 00 	movabs $0x8019c1,%r14
+  80234d:	00 00 00 
+        if (errno != -E_IPC_NOT_RECV)
+            panic("Ipc send error. Errno: %i\n", errno);
+        sys_yield();
+  802350:	49 bf b1 15 80 00 00 	movabs $0x8015b1,%r15
+  802357:	00 00 00 
+    while ((errno = sys_ipc_try_send(to_env, val, pg, size, perm))) {
+  80235a:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80235d:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802361:	4c 89 e1             	mov    %r12,%rcx
+  802364:	48 89 da             	mov    %rbx,%rdx
+  802367:	44 89 ef             	mov    %r13d,%edi
+  80236a:	41 ff d6             	call   *%r14
+  80236d:	85 c0                	test   %eax,%eax
+  80236f:	74 37                	je     8023a8 <ipc_send+0x94>
+        if (errno != -E_IPC_NOT_RECV)
+  802371:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802374:	75 05                	jne    80237b <ipc_send+0x67>
+        sys_yield();
+  802376:	41 ff d7             	call   *%r15
+  802379:	eb df                	jmp    80235a <ipc_send+0x46>
+            panic("Ipc send error. Errno: %i\n", errno);
+  80237b:	89 c1                	mov    %eax,%ecx
+  80237d:	48 ba 2c 57 80 00 00 	movabs $0x80572c,%rdx
+  802384:	00 00 00 
+  802387:	be 65 00 00 00       	mov    $0x65,%esi
+  80238c:	48 bf 47 57 80 00 00 	movabs $0x805747,%rdi
+  802393:	00 00 00 
+  802396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239b:	49 b8 18 04 80 00 00 	movabs $0x800418,%r8
+  8023a2:	00 00 00 
+  8023a5:	41 ff d0             	call   *%r8
+    }
+}
+  8023a8:	48 83 c4 18          	add    $0x18,%rsp
+  8023ac:	5b                   	pop    %rbx
+  8023ad:	41 5c                	pop    %r12
+  8023af:	41 5d                	pop    %r13
+  8023b1:	41 5e                	pop    %r14
+  8023b3:	41 5f                	pop    %r15
+  8023b5:	5d                   	pop    %rbp
+  8023b6:	c3                   	ret
+
+00000000008023b7 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8023b7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8023bc:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8023c3:	00 00 00 
+  8023c6:	48 69 d0 68 01 00 00 	imul   $0x168,%rax,%rdx
+  8023cd:	48 01 ca             	add    %rcx,%rdx
+  8023d0:	8b 92 d0 00 00 00    	mov    0xd0(%rdx),%edx
+  8023d6:	39 fa                	cmp    %edi,%edx
+  8023d8:	74 12                	je     8023ec <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8023da:	48 83 c0 01          	add    $0x1,%rax
+  8023de:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8023e4:	75 e0                	jne    8023c6 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8023e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023eb:	c3                   	ret
+            return envs[i].env_id;
+  8023ec:	48 69 c0 68 01 00 00 	imul   $0x168,%rax,%rax
+  8023f3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8023fa:	00 00 00 
+  8023fd:	48 01 d0             	add    %rdx,%rax
+  802400:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802406:	c3                   	ret
+
+0000000000802407 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802407:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80240e:	ff ff ff 
+  802411:	48 01 f8             	add    %rdi,%rax
+  802414:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802418:	c3                   	ret
+
+0000000000802419 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802419:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802420:	ff ff ff 
+  802423:	48 01 f8             	add    %rdi,%rax
+  802426:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80242a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802430:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802434:	c3                   	ret
+
+0000000000802435 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802435:	55                   	push   %rbp
+  802436:	48 89 e5             	mov    %rsp,%rbp
+  802439:	41 57                	push   %r15
+  80243b:	41 56                	push   %r14
+  80243d:	41 55                	push   %r13
+  80243f:	41 54                	push   %r12
+  802441:	53                   	push   %rbx
+  802442:	48 83 ec 08          	sub    $0x8,%rsp
+  802446:	49 89 ff             	mov    %rdi,%r15
+  802449:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80244e:	49 bd e9 42 80 00 00 	movabs $0x8042e9,%r13
+  802455:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802458:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80245e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802461:	48 89 df             	mov    %rbx,%rdi
+  802464:	41 ff d5             	call   *%r13
+  802467:	83 e0 04             	and    $0x4,%eax
+  80246a:	74 17                	je     802483 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80246c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802473:	4c 39 f3             	cmp    %r14,%rbx
+  802476:	75 e6                	jne    80245e <fd_alloc+0x29>
+  802478:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80247e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802483:	4d 89 27             	mov    %r12,(%r15)
+}
+  802486:	48 83 c4 08          	add    $0x8,%rsp
+  80248a:	5b                   	pop    %rbx
+  80248b:	41 5c                	pop    %r12
+  80248d:	41 5d                	pop    %r13
+  80248f:	41 5e                	pop    %r14
+  802491:	41 5f                	pop    %r15
+  802493:	5d                   	pop    %rbp
+  802494:	c3                   	ret
+
+0000000000802495 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802495:	83 ff 1f             	cmp    $0x1f,%edi
+  802498:	77 39                	ja     8024d3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80249a:	55                   	push   %rbp
+  80249b:	48 89 e5             	mov    %rsp,%rbp
+  80249e:	41 54                	push   %r12
+  8024a0:	53                   	push   %rbx
+  8024a1:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8024a4:	48 63 df             	movslq %edi,%rbx
+  8024a7:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8024ae:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8024b2:	48 89 df             	mov    %rbx,%rdi
+  8024b5:	48 b8 e9 42 80 00 00 	movabs $0x8042e9,%rax
+  8024bc:	00 00 00 
+  8024bf:	ff d0                	call   *%rax
+  8024c1:	a8 04                	test   $0x4,%al
+  8024c3:	74 14                	je     8024d9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8024c5:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8024c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ce:	5b                   	pop    %rbx
+  8024cf:	41 5c                	pop    %r12
+  8024d1:	5d                   	pop    %rbp
+  8024d2:	c3                   	ret
+        return -E_INVAL;
+  8024d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8024d8:	c3                   	ret
+        return -E_INVAL;
+  8024d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024de:	eb ee                	jmp    8024ce <fd_lookup+0x39>
+
+00000000008024e0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8024e0:	55                   	push   %rbp
+  8024e1:	48 89 e5             	mov    %rsp,%rbp
+  8024e4:	41 54                	push   %r12
+  8024e6:	53                   	push   %rbx
+  8024e7:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8024ea:	48 b8 e0 57 80 00 00 	movabs $0x8057e0,%rax
+  8024f1:	00 00 00 
+  8024f4:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8024fb:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8024fe:	39 3b                	cmp    %edi,(%rbx)
+  802500:	74 47                	je     802549 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802502:	48 83 c0 08          	add    $0x8,%rax
+  802506:	48 8b 18             	mov    (%rax),%rbx
+  802509:	48 85 db             	test   %rbx,%rbx
+  80250c:	75 f0                	jne    8024fe <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80250e:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802515:	00 00 00 
+  802518:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80251e:	89 fa                	mov    %edi,%edx
+  802520:	48 bf 58 57 80 00 00 	movabs $0x805758,%rdi
+  802527:	00 00 00 
+  80252a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80252f:	48 b9 68 05 80 00 00 	movabs $0x800568,%rcx
+  802536:	00 00 00 
+  802539:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80253b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802540:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802544:	5b                   	pop    %rbx
+  802545:	41 5c                	pop    %r12
+  802547:	5d                   	pop    %rbp
+  802548:	c3                   	ret
+            return 0;
+  802549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80254e:	eb f0                	jmp    802540 <dev_lookup+0x60>
+
+0000000000802550 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802550:	55                   	push   %rbp
+  802551:	48 89 e5             	mov    %rsp,%rbp
+  802554:	41 55                	push   %r13
+  802556:	41 54                	push   %r12
+  802558:	53                   	push   %rbx
+  802559:	48 83 ec 18          	sub    $0x18,%rsp
+  80255d:	48 89 fb             	mov    %rdi,%rbx
+  802560:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802563:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80256a:	ff ff ff 
+  80256d:	48 01 df             	add    %rbx,%rdi
+  802570:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802574:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802578:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  80257f:	00 00 00 
+  802582:	ff d0                	call   *%rax
+  802584:	41 89 c5             	mov    %eax,%r13d
+  802587:	85 c0                	test   %eax,%eax
+  802589:	78 06                	js     802591 <fd_close+0x41>
+  80258b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80258f:	74 1a                	je     8025ab <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802591:	45 84 e4             	test   %r12b,%r12b
+  802594:	b8 00 00 00 00       	mov    $0x0,%eax
+  802599:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80259d:	44 89 e8             	mov    %r13d,%eax
+  8025a0:	48 83 c4 18          	add    $0x18,%rsp
+  8025a4:	5b                   	pop    %rbx
+  8025a5:	41 5c                	pop    %r12
+  8025a7:	41 5d                	pop    %r13
+  8025a9:	5d                   	pop    %rbp
+  8025aa:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8025ab:	8b 3b                	mov    (%rbx),%edi
+  8025ad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025b1:	48 b8 e0 24 80 00 00 	movabs $0x8024e0,%rax
+  8025b8:	00 00 00 
+  8025bb:	ff d0                	call   *%rax
+  8025bd:	41 89 c5             	mov    %eax,%r13d
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	78 1b                	js     8025df <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8025c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025c8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8025cc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8025d2:	48 85 c0             	test   %rax,%rax
+  8025d5:	74 08                	je     8025df <fd_close+0x8f>
+  8025d7:	48 89 df             	mov    %rbx,%rdi
+  8025da:	ff d0                	call   *%rax
+  8025dc:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8025df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025e4:	48 89 de             	mov    %rbx,%rsi
+  8025e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ec:	48 b8 1f 18 80 00 00 	movabs $0x80181f,%rax
+  8025f3:	00 00 00 
+  8025f6:	ff d0                	call   *%rax
+    return res;
+  8025f8:	eb a3                	jmp    80259d <fd_close+0x4d>
+
+00000000008025fa <close>:
+
+int
+close(int fdnum) {
+  8025fa:	55                   	push   %rbp
+  8025fb:	48 89 e5             	mov    %rsp,%rbp
+  8025fe:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802602:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802606:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  80260d:	00 00 00 
+  802610:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802612:	85 c0                	test   %eax,%eax
+  802614:	78 15                	js     80262b <close+0x31>
+
+    return fd_close(fd, 1);
+  802616:	be 01 00 00 00       	mov    $0x1,%esi
+  80261b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80261f:	48 b8 50 25 80 00 00 	movabs $0x802550,%rax
+  802626:	00 00 00 
+  802629:	ff d0                	call   *%rax
+}
+  80262b:	c9                   	leave
+  80262c:	c3                   	ret
+
+000000000080262d <close_all>:
+
+void
+close_all(void) {
+  80262d:	55                   	push   %rbp
+  80262e:	48 89 e5             	mov    %rsp,%rbp
+  802631:	41 54                	push   %r12
+  802633:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802634:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802639:	49 bc fa 25 80 00 00 	movabs $0x8025fa,%r12
+  802640:	00 00 00 
+  802643:	89 df                	mov    %ebx,%edi
+  802645:	41 ff d4             	call   *%r12
+  802648:	83 c3 01             	add    $0x1,%ebx
+  80264b:	83 fb 20             	cmp    $0x20,%ebx
+  80264e:	75 f3                	jne    802643 <close_all+0x16>
+}
+  802650:	5b                   	pop    %rbx
+  802651:	41 5c                	pop    %r12
+  802653:	5d                   	pop    %rbp
+  802654:	c3                   	ret
+
+0000000000802655 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802655:	55                   	push   %rbp
+  802656:	48 89 e5             	mov    %rsp,%rbp
+  802659:	41 57                	push   %r15
+  80265b:	41 56                	push   %r14
+  80265d:	41 55                	push   %r13
+  80265f:	41 54                	push   %r12
+  802661:	53                   	push   %rbx
+  802662:	48 83 ec 18          	sub    $0x18,%rsp
+  802666:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802669:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80266d:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  802674:	00 00 00 
+  802677:	ff d0                	call   *%rax
+  802679:	89 c3                	mov    %eax,%ebx
+  80267b:	85 c0                	test   %eax,%eax
+  80267d:	0f 88 b8 00 00 00    	js     80273b <dup+0xe6>
+    close(newfdnum);
+  802683:	44 89 e7             	mov    %r12d,%edi
+  802686:	48 b8 fa 25 80 00 00 	movabs $0x8025fa,%rax
+  80268d:	00 00 00 
+  802690:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802692:	4d 63 ec             	movslq %r12d,%r13
+  802695:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80269c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8026a0:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8026a4:	4c 89 ff             	mov    %r15,%rdi
+  8026a7:	49 be 19 24 80 00 00 	movabs $0x802419,%r14
+  8026ae:	00 00 00 
+  8026b1:	41 ff d6             	call   *%r14
+  8026b4:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8026b7:	4c 89 ef             	mov    %r13,%rdi
+  8026ba:	41 ff d6             	call   *%r14
+  8026bd:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8026c0:	48 89 df             	mov    %rbx,%rdi
+  8026c3:	48 b8 e9 42 80 00 00 	movabs $0x8042e9,%rax
+  8026ca:	00 00 00 
+  8026cd:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8026cf:	a8 04                	test   $0x4,%al
+  8026d1:	74 2b                	je     8026fe <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8026d3:	41 89 c1             	mov    %eax,%r9d
+  8026d6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8026dc:	4c 89 f1             	mov    %r14,%rcx
+  8026df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e4:	48 89 de             	mov    %rbx,%rsi
+  8026e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ec:	48 b8 a7 16 80 00 00 	movabs $0x8016a7,%rax
+  8026f3:	00 00 00 
+  8026f6:	ff d0                	call   *%rax
+  8026f8:	89 c3                	mov    %eax,%ebx
+  8026fa:	85 c0                	test   %eax,%eax
+  8026fc:	78 4e                	js     80274c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8026fe:	4c 89 ff             	mov    %r15,%rdi
+  802701:	48 b8 e9 42 80 00 00 	movabs $0x8042e9,%rax
+  802708:	00 00 00 
+  80270b:	ff d0                	call   *%rax
+  80270d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802710:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802716:	4c 89 e9             	mov    %r13,%rcx
+  802719:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271e:	4c 89 fe             	mov    %r15,%rsi
+  802721:	bf 00 00 00 00       	mov    $0x0,%edi
+  802726:	48 b8 a7 16 80 00 00 	movabs $0x8016a7,%rax
+  80272d:	00 00 00 
+  802730:	ff d0                	call   *%rax
+  802732:	89 c3                	mov    %eax,%ebx
+  802734:	85 c0                	test   %eax,%eax
+  802736:	78 14                	js     80274c <dup+0xf7>
+
+    return newfdnum;
+  802738:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80273b:	89 d8                	mov    %ebx,%eax
+  80273d:	48 83 c4 18          	add    $0x18,%rsp
+  802741:	5b                   	pop    %rbx
+  802742:	41 5c                	pop    %r12
+  802744:	41 5d                	pop    %r13
+  802746:	41 5e                	pop    %r14
+  802748:	41 5f                	pop    %r15
+  80274a:	5d                   	pop    %rbp
+  80274b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80274c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802751:	4c 89 ee             	mov    %r13,%rsi
+  802754:	bf 00 00 00 00       	mov    $0x0,%edi
+  802759:	49 bc 1f 18 80 00 00 	movabs $0x80181f,%r12
+  802760:	00 00 00 
+  802763:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802766:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80276b:	4c 89 f6             	mov    %r14,%rsi
+  80276e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802773:	41 ff d4             	call   *%r12
+    return res;
+  802776:	eb c3                	jmp    80273b <dup+0xe6>
+
+0000000000802778 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802778:	55                   	push   %rbp
+  802779:	48 89 e5             	mov    %rsp,%rbp
+  80277c:	41 56                	push   %r14
+  80277e:	41 55                	push   %r13
+  802780:	41 54                	push   %r12
+  802782:	53                   	push   %rbx
+  802783:	48 83 ec 10          	sub    $0x10,%rsp
+  802787:	89 fb                	mov    %edi,%ebx
+  802789:	49 89 f4             	mov    %rsi,%r12
+  80278c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80278f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802793:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+  80279f:	85 c0                	test   %eax,%eax
+  8027a1:	78 4c                	js     8027ef <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027a3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8027a7:	41 8b 3e             	mov    (%r14),%edi
+  8027aa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027ae:	48 b8 e0 24 80 00 00 	movabs $0x8024e0,%rax
+  8027b5:	00 00 00 
+  8027b8:	ff d0                	call   *%rax
+  8027ba:	85 c0                	test   %eax,%eax
+  8027bc:	78 35                	js     8027f3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8027be:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8027c2:	83 e0 03             	and    $0x3,%eax
+  8027c5:	83 f8 01             	cmp    $0x1,%eax
+  8027c8:	74 2d                	je     8027f7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8027ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027ce:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027d2:	48 85 c0             	test   %rax,%rax
+  8027d5:	74 56                	je     80282d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8027d7:	4c 89 ea             	mov    %r13,%rdx
+  8027da:	4c 89 e6             	mov    %r12,%rsi
+  8027dd:	4c 89 f7             	mov    %r14,%rdi
+  8027e0:	ff d0                	call   *%rax
+}
+  8027e2:	48 83 c4 10          	add    $0x10,%rsp
+  8027e6:	5b                   	pop    %rbx
+  8027e7:	41 5c                	pop    %r12
+  8027e9:	41 5d                	pop    %r13
+  8027eb:	41 5e                	pop    %r14
+  8027ed:	5d                   	pop    %rbp
+  8027ee:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8027ef:	48 98                	cltq
+  8027f1:	eb ef                	jmp    8027e2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8027f3:	48 98                	cltq
+  8027f5:	eb eb                	jmp    8027e2 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8027f7:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8027fe:	00 00 00 
+  802801:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802807:	89 da                	mov    %ebx,%edx
+  802809:	48 bf 99 57 80 00 00 	movabs $0x805799,%rdi
+  802810:	00 00 00 
+  802813:	b8 00 00 00 00       	mov    $0x0,%eax
+  802818:	48 b9 68 05 80 00 00 	movabs $0x800568,%rcx
+  80281f:	00 00 00 
+  802822:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802824:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80282b:	eb b5                	jmp    8027e2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80282d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802834:	eb ac                	jmp    8027e2 <read+0x6a>
+
+0000000000802836 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802836:	55                   	push   %rbp
+  802837:	48 89 e5             	mov    %rsp,%rbp
+  80283a:	41 57                	push   %r15
+  80283c:	41 56                	push   %r14
+  80283e:	41 55                	push   %r13
+  802840:	41 54                	push   %r12
+  802842:	53                   	push   %rbx
+  802843:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802847:	48 85 d2             	test   %rdx,%rdx
+  80284a:	74 54                	je     8028a0 <readn+0x6a>
+  80284c:	41 89 fd             	mov    %edi,%r13d
+  80284f:	49 89 f6             	mov    %rsi,%r14
+  802852:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802855:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80285a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80285f:	49 bf 78 27 80 00 00 	movabs $0x802778,%r15
+  802866:	00 00 00 
+  802869:	4c 89 e2             	mov    %r12,%rdx
+  80286c:	48 29 f2             	sub    %rsi,%rdx
+  80286f:	4c 01 f6             	add    %r14,%rsi
+  802872:	44 89 ef             	mov    %r13d,%edi
+  802875:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802878:	85 c0                	test   %eax,%eax
+  80287a:	78 20                	js     80289c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80287c:	01 c3                	add    %eax,%ebx
+  80287e:	85 c0                	test   %eax,%eax
+  802880:	74 08                	je     80288a <readn+0x54>
+  802882:	48 63 f3             	movslq %ebx,%rsi
+  802885:	4c 39 e6             	cmp    %r12,%rsi
+  802888:	72 df                	jb     802869 <readn+0x33>
+    }
+    return res;
+  80288a:	48 63 c3             	movslq %ebx,%rax
+}
+  80288d:	48 83 c4 08          	add    $0x8,%rsp
+  802891:	5b                   	pop    %rbx
+  802892:	41 5c                	pop    %r12
+  802894:	41 5d                	pop    %r13
+  802896:	41 5e                	pop    %r14
+  802898:	41 5f                	pop    %r15
+  80289a:	5d                   	pop    %rbp
+  80289b:	c3                   	ret
+        if (inc < 0) return inc;
+  80289c:	48 98                	cltq
+  80289e:	eb ed                	jmp    80288d <readn+0x57>
+    int inc = 1, res = 0;
+  8028a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a5:	eb e3                	jmp    80288a <readn+0x54>
+
+00000000008028a7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8028a7:	55                   	push   %rbp
+  8028a8:	48 89 e5             	mov    %rsp,%rbp
+  8028ab:	41 56                	push   %r14
+  8028ad:	41 55                	push   %r13
+  8028af:	41 54                	push   %r12
+  8028b1:	53                   	push   %rbx
+  8028b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8028b6:	89 fb                	mov    %edi,%ebx
+  8028b8:	49 89 f4             	mov    %rsi,%r12
+  8028bb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028be:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8028c2:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  8028c9:	00 00 00 
+  8028cc:	ff d0                	call   *%rax
+  8028ce:	85 c0                	test   %eax,%eax
+  8028d0:	78 47                	js     802919 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028d2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8028d6:	41 8b 3e             	mov    (%r14),%edi
+  8028d9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028dd:	48 b8 e0 24 80 00 00 	movabs $0x8024e0,%rax
+  8028e4:	00 00 00 
+  8028e7:	ff d0                	call   *%rax
+  8028e9:	85 c0                	test   %eax,%eax
+  8028eb:	78 30                	js     80291d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8028ed:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8028f2:	74 2d                	je     802921 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8028f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028f8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8028fc:	48 85 c0             	test   %rax,%rax
+  8028ff:	74 56                	je     802957 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802901:	4c 89 ea             	mov    %r13,%rdx
+  802904:	4c 89 e6             	mov    %r12,%rsi
+  802907:	4c 89 f7             	mov    %r14,%rdi
+  80290a:	ff d0                	call   *%rax
+}
+  80290c:	48 83 c4 10          	add    $0x10,%rsp
+  802910:	5b                   	pop    %rbx
+  802911:	41 5c                	pop    %r12
+  802913:	41 5d                	pop    %r13
+  802915:	41 5e                	pop    %r14
+  802917:	5d                   	pop    %rbp
+  802918:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802919:	48 98                	cltq
+  80291b:	eb ef                	jmp    80290c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80291d:	48 98                	cltq
+  80291f:	eb eb                	jmp    80290c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802921:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802928:	00 00 00 
+  80292b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802931:	89 da                	mov    %ebx,%edx
+  802933:	48 bf b5 57 80 00 00 	movabs $0x8057b5,%rdi
+  80293a:	00 00 00 
+  80293d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802942:	48 b9 68 05 80 00 00 	movabs $0x800568,%rcx
+  802949:	00 00 00 
+  80294c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80294e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802955:	eb b5                	jmp    80290c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802957:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80295e:	eb ac                	jmp    80290c <write+0x65>
+
+0000000000802960 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802960:	55                   	push   %rbp
+  802961:	48 89 e5             	mov    %rsp,%rbp
+  802964:	53                   	push   %rbx
+  802965:	48 83 ec 18          	sub    $0x18,%rsp
+  802969:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80296b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80296f:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  802976:	00 00 00 
+  802979:	ff d0                	call   *%rax
+  80297b:	85 c0                	test   %eax,%eax
+  80297d:	78 0c                	js     80298b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80297f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802983:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802986:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80298b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80298f:	c9                   	leave
+  802990:	c3                   	ret
+
+0000000000802991 <tell>:
+    return 0;
+}
+
+int
+tell(int fd)
+{
+  802991:	55                   	push   %rbp
+  802992:	48 89 e5             	mov    %rsp,%rbp
+  802995:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fdes;
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802999:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80299d:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  8029a4:	00 00 00 
+  8029a7:	ff d0                	call   *%rax
+  8029a9:	85 c0                	test   %eax,%eax
+  8029ab:	78 07                	js     8029b4 <tell+0x23>
+    return fdes->fd_offset;
+  8029ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029b1:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8029b4:	c9                   	leave
+  8029b5:	c3                   	ret
+
+00000000008029b6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8029b6:	55                   	push   %rbp
+  8029b7:	48 89 e5             	mov    %rsp,%rbp
+  8029ba:	41 55                	push   %r13
+  8029bc:	41 54                	push   %r12
+  8029be:	53                   	push   %rbx
+  8029bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8029c3:	89 fb                	mov    %edi,%ebx
+  8029c5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029c8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8029cc:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  8029d3:	00 00 00 
+  8029d6:	ff d0                	call   *%rax
+  8029d8:	85 c0                	test   %eax,%eax
+  8029da:	78 38                	js     802a14 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8029dc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8029e0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8029e4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8029e8:	48 b8 e0 24 80 00 00 	movabs $0x8024e0,%rax
+  8029ef:	00 00 00 
+  8029f2:	ff d0                	call   *%rax
+  8029f4:	85 c0                	test   %eax,%eax
+  8029f6:	78 1c                	js     802a14 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8029f8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8029fd:	74 20                	je     802a1f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8029ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a03:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802a07:	48 85 c0             	test   %rax,%rax
+  802a0a:	74 47                	je     802a53 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802a0c:	44 89 e6             	mov    %r12d,%esi
+  802a0f:	4c 89 ef             	mov    %r13,%rdi
+  802a12:	ff d0                	call   *%rax
+}
+  802a14:	48 83 c4 18          	add    $0x18,%rsp
+  802a18:	5b                   	pop    %rbx
+  802a19:	41 5c                	pop    %r12
+  802a1b:	41 5d                	pop    %r13
+  802a1d:	5d                   	pop    %rbp
+  802a1e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802a1f:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802a26:	00 00 00 
+  802a29:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802a2f:	89 da                	mov    %ebx,%edx
+  802a31:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  802a38:	00 00 00 
+  802a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a40:	48 b9 68 05 80 00 00 	movabs $0x800568,%rcx
+  802a47:	00 00 00 
+  802a4a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802a4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a51:	eb c1                	jmp    802a14 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802a53:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802a58:	eb ba                	jmp    802a14 <ftruncate+0x5e>
+
+0000000000802a5a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802a5a:	55                   	push   %rbp
+  802a5b:	48 89 e5             	mov    %rsp,%rbp
+  802a5e:	41 54                	push   %r12
+  802a60:	53                   	push   %rbx
+  802a61:	48 83 ec 10          	sub    $0x10,%rsp
+  802a65:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a68:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802a6c:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  802a73:	00 00 00 
+  802a76:	ff d0                	call   *%rax
+  802a78:	85 c0                	test   %eax,%eax
+  802a7a:	78 4e                	js     802aca <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a7c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802a80:	41 8b 3c 24          	mov    (%r12),%edi
+  802a84:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802a88:	48 b8 e0 24 80 00 00 	movabs $0x8024e0,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+  802a94:	85 c0                	test   %eax,%eax
+  802a96:	78 32                	js     802aca <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802a98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a9c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802aa1:	74 30                	je     802ad3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802aa3:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802aa6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802aad:	00 00 00 
+    stat->st_isdir = 0;
+  802ab0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ab7:	00 00 00 
+    stat->st_dev = dev;
+  802aba:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802ac1:	48 89 de             	mov    %rbx,%rsi
+  802ac4:	4c 89 e7             	mov    %r12,%rdi
+  802ac7:	ff 50 28             	call   *0x28(%rax)
+}
+  802aca:	48 83 c4 10          	add    $0x10,%rsp
+  802ace:	5b                   	pop    %rbx
+  802acf:	41 5c                	pop    %r12
+  802ad1:	5d                   	pop    %rbp
+  802ad2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802ad3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802ad8:	eb f0                	jmp    802aca <fstat+0x70>
+
+0000000000802ada <seekfromcur>:
+seekfromcur(int fdnum, off_t offset) {
+  802ada:	55                   	push   %rbp
+  802adb:	48 89 e5             	mov    %rsp,%rbp
+  802ade:	41 54                	push   %r12
+  802ae0:	53                   	push   %rbx
+  802ae1:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  802ae8:	41 89 fc             	mov    %edi,%r12d
+  802aeb:	89 f3                	mov    %esi,%ebx
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802aed:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802af1:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  802af8:	00 00 00 
+  802afb:	ff d0                	call   *%rax
+  802afd:	85 c0                	test   %eax,%eax
+  802aff:	78 31                	js     802b32 <seekfromcur+0x58>
+    if ((res = fstat(fdnum, &st)) < 0) return res;
+  802b01:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802b08:	44 89 e7             	mov    %r12d,%edi
+  802b0b:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802b12:	00 00 00 
+  802b15:	ff d0                	call   *%rax
+  802b17:	85 c0                	test   %eax,%eax
+  802b19:	78 17                	js     802b32 <seekfromcur+0x58>
+    off_t pos = fd->fd_offset + offset;
+  802b1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b1f:	03 58 04             	add    0x4(%rax),%ebx
+    fd->fd_offset = pos < st.st_size ? pos : st.st_size;
+  802b22:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802b25:	39 d3                	cmp    %edx,%ebx
+  802b27:	0f 4f da             	cmovg  %edx,%ebx
+  802b2a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b32:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  802b39:	5b                   	pop    %rbx
+  802b3a:	41 5c                	pop    %r12
+  802b3c:	5d                   	pop    %rbp
+  802b3d:	c3                   	ret
+
+0000000000802b3e <seektoend>:
+{
+  802b3e:	55                   	push   %rbp
+  802b3f:	48 89 e5             	mov    %rsp,%rbp
+  802b42:	53                   	push   %rbx
+  802b43:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  802b4a:	89 fb                	mov    %edi,%ebx
+    if ((res = fd_lookup(fd, &fdes)) < 0) return res;
+  802b4c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802b50:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  802b57:	00 00 00 
+  802b5a:	ff d0                	call   *%rax
+  802b5c:	85 c0                	test   %eax,%eax
+  802b5e:	78 28                	js     802b88 <seektoend+0x4a>
+    if ((res = fstat(fd, &st)) < 0) return res;
+  802b60:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  802b67:	89 df                	mov    %ebx,%edi
+  802b69:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802b70:	00 00 00 
+  802b73:	ff d0                	call   *%rax
+  802b75:	85 c0                	test   %eax,%eax
+  802b77:	78 0f                	js     802b88 <seektoend+0x4a>
+    fdes->fd_offset = st.st_size;
+  802b79:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802b7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b80:	89 50 04             	mov    %edx,0x4(%rax)
+    return 0;
+  802b83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b8c:	c9                   	leave
+  802b8d:	c3                   	ret
+
+0000000000802b8e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802b8e:	55                   	push   %rbp
+  802b8f:	48 89 e5             	mov    %rsp,%rbp
+  802b92:	41 54                	push   %r12
+  802b94:	53                   	push   %rbx
+  802b95:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802b98:	be 00 00 00 00       	mov    $0x0,%esi
+  802b9d:	48 b8 81 37 80 00 00 	movabs $0x803781,%rax
+  802ba4:	00 00 00 
+  802ba7:	ff d0                	call   *%rax
+  802ba9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802bab:	85 c0                	test   %eax,%eax
+  802bad:	78 25                	js     802bd4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802baf:	4c 89 e6             	mov    %r12,%rsi
+  802bb2:	89 c7                	mov    %eax,%edi
+  802bb4:	48 b8 5a 2a 80 00 00 	movabs $0x802a5a,%rax
+  802bbb:	00 00 00 
+  802bbe:	ff d0                	call   *%rax
+  802bc0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802bc3:	89 df                	mov    %ebx,%edi
+  802bc5:	48 b8 fa 25 80 00 00 	movabs $0x8025fa,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+
+    return res;
+  802bd1:	44 89 e3             	mov    %r12d,%ebx
+}
+  802bd4:	89 d8                	mov    %ebx,%eax
+  802bd6:	5b                   	pop    %rbx
+  802bd7:	41 5c                	pop    %r12
+  802bd9:	5d                   	pop    %rbp
+  802bda:	c3                   	ret
+
+0000000000802bdb <fbuf_get>:
+}
+
+/* Returns cache of fd, dropping data made stale by other environments,
+ * or NULL if fd is not in file descriptor table or there is no memory */
+static struct FileBuf *
+fbuf_get(struct Fd *fd) {
+  802bdb:	55                   	push   %rbp
+  802bdc:	48 89 e5             	mov    %rsp,%rbp
+  802bdf:	53                   	push   %rbx
+  802be0:	48 83 ec 08          	sub    $0x8,%rsp
+  802be4:	48 89 fb             	mov    %rdi,%rbx
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802be7:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802bee:	00 00 00 
+  802bf1:	ff d0                	call   *%rax
+  802bf3:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802bf7:	0f 87 ea 00 00 00    	ja     802ce7 <fbuf_get+0x10c>
+    if (!fbuf_mapped) {
+  802bfd:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802c04:	00 00 00 
+  802c07:	80 38 00             	cmpb   $0x0,(%rax)
+  802c0a:	75 35                	jne    802c41 <fbuf_get+0x66>
+        /* Pages are allocated lazily, only windows in use cost memory */
+        if (sys_alloc_region(0, (void *)FBUF_BASE, MAXFD * FBUF_STRIDE, PROT_RW) < 0)
+  802c0c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c11:	ba 00 00 22 00       	mov    $0x220000,%edx
+  802c16:	be 00 00 20 d0       	mov    $0xd0200000,%esi
+  802c1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c20:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  802c27:	00 00 00 
+  802c2a:	ff d0                	call   *%rax
+  802c2c:	85 c0                	test   %eax,%eax
+  802c2e:	0f 88 ba 00 00 00    	js     802cee <fbuf_get+0x113>
+            return NULL;
+        fbuf_mapped = 1;
+  802c34:	48 b8 04 90 98 00 00 	movabs $0x989004,%rax
+  802c3b:	00 00 00 
+  802c3e:	c6 00 01             	movb   $0x1,(%rax)
+    }
+
+    struct FileBuf *fb = &filebufs[fd2num(fd)];
+  802c41:	48 89 df             	mov    %rbx,%rdi
+  802c44:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802c4b:	00 00 00 
+  802c4e:	ff d0                	call   *%rax
+  802c50:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  802c54:	48 ba 20 90 98 00 00 	movabs $0x989020,%rdx
+  802c5b:	00 00 00 
+  802c5e:	48 8d 0c ca          	lea    (%rdx,%rcx,8),%rcx
+    if (fb->fb_fileid != fd->fd_file.id) {
+  802c62:	8b 7b 0c             	mov    0xc(%rbx),%edi
+  802c65:	39 39                	cmp    %edi,(%rcx)
+  802c67:	74 46                	je     802caf <fbuf_get+0xd4>
+        *fb = (struct FileBuf){.fb_fileid = fd->fd_file.id, .fb_gen = fd->fd_file.gen};
+  802c69:	44 8b 4b 10          	mov    0x10(%rbx),%r9d
+  802c6d:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+  802c74:	00 
+  802c75:	48 c7 01 00 00 00 00 	movq   $0x0,(%rcx)
+  802c7c:	48 c7 41 08 00 00 00 	movq   $0x0,0x8(%rcx)
+  802c83:	00 
+  802c84:	48 c7 41 10 00 00 00 	movq   $0x0,0x10(%rcx)
+  802c8b:	00 
+  802c8c:	48 c7 41 18 00 00 00 	movq   $0x0,0x18(%rcx)
+  802c93:	00 
+  802c94:	48 c7 41 20 00 00 00 	movq   $0x0,0x20(%rcx)
+  802c9b:	00 
+  802c9c:	89 39                	mov    %edi,(%rcx)
+  802c9e:	48 01 c6             	add    %rax,%rsi
+  802ca1:	44 89 4c f2 04       	mov    %r9d,0x4(%rdx,%rsi,8)
+        /* Only unwritten changes of our own are still valid */
+        fb->fb_valid = 0;
+        fb->fb_gen = fd->fd_file.gen;
+    }
+    return fb;
+}
+  802ca6:	48 89 c8             	mov    %rcx,%rax
+  802ca9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cad:	c9                   	leave
+  802cae:	c3                   	ret
+    } else if (fb->fb_gen != fd->fd_file.gen) {
+  802caf:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  802cb3:	48 be 20 90 98 00 00 	movabs $0x989020,%rsi
+  802cba:	00 00 00 
+  802cbd:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802cc0:	39 7c d6 04          	cmp    %edi,0x4(%rsi,%rdx,8)
+  802cc4:	74 e0                	je     802ca6 <fbuf_get+0xcb>
+        fb->fb_valid = 0;
+  802cc6:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  802ccd:	00 
+  802cce:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802cd2:	48 c7 44 fe 10 00 00 	movq   $0x0,0x10(%rsi,%rdi,8)
+  802cd9:	00 00 
+        fb->fb_gen = fd->fd_file.gen;
+  802cdb:	8b 7b 10             	mov    0x10(%rbx),%edi
+  802cde:	48 01 c2             	add    %rax,%rdx
+  802ce1:	89 7c d6 04          	mov    %edi,0x4(%rsi,%rdx,8)
+  802ce5:	eb bf                	jmp    802ca6 <fbuf_get+0xcb>
+    if (fd2num(fd) >= MAXFD) return NULL;
+  802ce7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cec:	eb b8                	jmp    802ca6 <fbuf_get+0xcb>
+            return NULL;
+  802cee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cf3:	eb b1                	jmp    802ca6 <fbuf_get+0xcb>
+
+0000000000802cf5 <fsipc_bulk>:
+fsipc_bulk(void) {
+  802cf5:	55                   	push   %rbp
+  802cf6:	48 89 e5             	mov    %rsp,%rbp
+  802cf9:	53                   	push   %rbx
+  802cfa:	48 83 ec 08          	sub    $0x8,%rsp
+    if (!fsipcbulk) {
+  802cfe:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802d05:	00 00 00 
+  802d08:	48 8b 18             	mov    (%rax),%rbx
+  802d0b:	48 85 db             	test   %rbx,%rbx
+  802d0e:	74 16                	je     802d26 <fsipc_bulk+0x31>
+    return fsipcbulk;
+  802d10:	48 b8 20 95 98 00 00 	movabs $0x989520,%rax
+  802d17:	00 00 00 
+  802d1a:	48 8b 18             	mov    (%rax),%rbx
+}
+  802d1d:	48 89 d8             	mov    %rbx,%rax
+  802d20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d24:	c9                   	leave
+  802d25:	c3                   	ret
+        if (sys_alloc_region(0, (void *)FSIPC_BULK, PAGE_SIZE + FSIPC_MAXDATA, PROT_RW) < 0)
+  802d26:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d2b:	ba 00 10 04 00       	mov    $0x41000,%edx
+  802d30:	be 00 00 10 d0       	mov    $0xd0100000,%esi
+  802d35:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d3a:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  802d41:	00 00 00 
+  802d44:	ff d0                	call   *%rax
+  802d46:	85 c0                	test   %eax,%eax
+  802d48:	78 d3                	js     802d1d <fsipc_bulk+0x28>
+        fsipcbulk = (union Fsipc *)FSIPC_BULK;
+  802d4a:	b8 00 00 10 d0       	mov    $0xd0100000,%eax
+  802d4f:	48 a3 20 95 98 00 00 	movabs %rax,0x989520
+  802d56:	00 00 00 
+  802d59:	eb b5                	jmp    802d10 <fsipc_bulk+0x1b>
+
+0000000000802d5b <fsipc_region>:
+fsipc_region(unsigned type, union Fsipc *ipc, size_t ipcsize, void *dstva, size_t *size) {
+  802d5b:	55                   	push   %rbp
+  802d5c:	48 89 e5             	mov    %rsp,%rbp
+  802d5f:	41 57                	push   %r15
+  802d61:	41 56                	push   %r14
+  802d63:	41 55                	push   %r13
+  802d65:	41 54                	push   %r12
+  802d67:	53                   	push   %rbx
+  802d68:	48 83 ec 08          	sub    $0x8,%rsp
+  802d6c:	41 89 fd             	mov    %edi,%r13d
+  802d6f:	49 89 f6             	mov    %rsi,%r14
+  802d72:	49 89 d7             	mov    %rdx,%r15
+  802d75:	48 89 cb             	mov    %rcx,%rbx
+  802d78:	4d 89 c4             	mov    %r8,%r12
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802d7b:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802d82:	00 00 00 
+  802d85:	83 38 00             	cmpl   $0x0,(%rax)
+  802d88:	74 52                	je     802ddc <fsipc_region+0x81>
+    ipc_send(fsenv, type, ipc, ipcsize, PROT_RW);
+  802d8a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802d90:	4c 89 f9             	mov    %r15,%rcx
+  802d93:	4c 89 f2             	mov    %r14,%rdx
+  802d96:	44 89 ee             	mov    %r13d,%esi
+  802d99:	48 b8 00 90 98 00 00 	movabs $0x989000,%rax
+  802da0:	00 00 00 
+  802da3:	8b 38                	mov    (%rax),%edi
+  802da5:	48 b8 14 23 80 00 00 	movabs $0x802314,%rax
+  802dac:	00 00 00 
+  802daf:	ff d0                	call   *%rax
+    return ipc_recv(NULL, dstva, size, NULL);
+  802db1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802db6:	4c 89 e2             	mov    %r12,%rdx
+  802db9:	48 89 de             	mov    %rbx,%rsi
+  802dbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc1:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  802dc8:	00 00 00 
+  802dcb:	ff d0                	call   *%rax
+}
+  802dcd:	48 83 c4 08          	add    $0x8,%rsp
+  802dd1:	5b                   	pop    %rbx
+  802dd2:	41 5c                	pop    %r12
+  802dd4:	41 5d                	pop    %r13
+  802dd6:	41 5e                	pop    %r14
+  802dd8:	41 5f                	pop    %r15
+  802dda:	5d                   	pop    %rbp
+  802ddb:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802ddc:	bf 03 00 00 00       	mov    $0x3,%edi
+  802de1:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  802de8:	00 00 00 
+  802deb:	ff d0                	call   *%rax
+  802ded:	a3 00 90 98 00 00 00 	movabs %eax,0x989000
+  802df4:	00 00 
+  802df6:	eb 92                	jmp    802d8a <fsipc_region+0x2f>
+
+0000000000802df8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802df8:	55                   	push   %rbp
+  802df9:	48 89 e5             	mov    %rsp,%rbp
+  802dfc:	41 57                	push   %r15
+  802dfe:	41 56                	push   %r14
+  802e00:	41 55                	push   %r13
+  802e02:	41 54                	push   %r12
+  802e04:	53                   	push   %rbx
+  802e05:	48 83 ec 28          	sub    $0x28,%rsp
+  802e09:	49 89 ff             	mov    %rdi,%r15
+  802e0c:	49 89 f6             	mov    %rsi,%r14
+  802e0f:	48 89 d3             	mov    %rdx,%rbx
+  802e12:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802e16:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+    union Fsipc *ipc = fsipc_bulk();
+  802e19:	48 b8 f5 2c 80 00 00 	movabs $0x802cf5,%rax
+  802e20:	00 00 00 
+  802e23:	ff d0                	call   *%rax
+    if (!ipc) return -E_NO_MEM;
+  802e25:	48 85 c0             	test   %rax,%rax
+  802e28:	0f 84 cc 00 00 00    	je     802efa <devfile_write_direct+0x102>
+  802e2e:	49 89 c5             	mov    %rax,%r13
+    while (i < n) {
+  802e31:	48 85 db             	test   %rbx,%rbx
+  802e34:	0f 84 ba 00 00 00    	je     802ef4 <devfile_write_direct+0xfc>
+    size_t i = 0;
+  802e3a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802e40:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  802e47:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        size_t write_now = MIN(n - i, FSIPC_MAXDATA);
+  802e4b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802e4f:	4c 29 e3             	sub    %r12,%rbx
+  802e52:	b8 00 00 04 00       	mov    $0x40000,%eax
+  802e57:	48 39 c3             	cmp    %rax,%rbx
+  802e5a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memcpy((char *)ipc + PAGE_SIZE, buf, write_now);
+  802e5e:	48 89 da             	mov    %rbx,%rdx
+  802e61:	4c 89 f6             	mov    %r14,%rsi
+  802e64:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802e68:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  802e6f:	00 00 00 
+  802e72:	ff d0                	call   *%rax
+        ipc->write.req_fileid = fd->fd_file.id;
+  802e74:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  802e78:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->write.req_offset = offset + i;
+  802e7c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802e7f:	44 01 e0             	add    %r12d,%eax
+  802e82:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->write.req_n = write_now;
+  802e86:	49 89 5d 08          	mov    %rbx,0x8(%r13)
+        int res = fsipc_region(FSREQ_WRITE, ipc, PAGE_SIZE + ROUNDUP(write_now, PAGE_SIZE), NULL, NULL);
+  802e8a:	48 8d 93 ff 0f 00 00 	lea    0xfff(%rbx),%rdx
+  802e91:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  802e98:	48 8d 92 00 10 00 00 	lea    0x1000(%rdx),%rdx
+  802e9f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ea5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802eaa:	4c 89 ee             	mov    %r13,%rsi
+  802ead:	bf 04 00 00 00       	mov    $0x4,%edi
+  802eb2:	48 b8 5b 2d 80 00 00 	movabs $0x802d5b,%rax
+  802eb9:	00 00 00 
+  802ebc:	ff d0                	call   *%rax
+        if (res < 0)
+  802ebe:	85 c0                	test   %eax,%eax
+  802ec0:	78 29                	js     802eeb <devfile_write_direct+0xf3>
+        if (res == 0)
+  802ec2:	74 2b                	je     802eef <devfile_write_direct+0xf7>
+        i += res;
+  802ec4:	48 98                	cltq
+  802ec6:	49 01 c4             	add    %rax,%r12
+        buf += res;
+  802ec9:	49 01 c6             	add    %rax,%r14
+    while (i < n) {
+  802ecc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ed0:	49 39 c4             	cmp    %rax,%r12
+  802ed3:	0f 82 72 ff ff ff    	jb     802e4b <devfile_write_direct+0x53>
+    return i;
+  802ed9:	4c 89 e0             	mov    %r12,%rax
+}
+  802edc:	48 83 c4 28          	add    $0x28,%rsp
+  802ee0:	5b                   	pop    %rbx
+  802ee1:	41 5c                	pop    %r12
+  802ee3:	41 5d                	pop    %r13
+  802ee5:	41 5e                	pop    %r14
+  802ee7:	41 5f                	pop    %r15
+  802ee9:	5d                   	pop    %rbp
+  802eea:	c3                   	ret
+            return res;
+  802eeb:	48 98                	cltq
+  802eed:	eb ed                	jmp    802edc <devfile_write_direct+0xe4>
+            return i;
+  802eef:	4c 89 e0             	mov    %r12,%rax
+  802ef2:	eb e8                	jmp    802edc <devfile_write_direct+0xe4>
+    size_t i = 0;
+  802ef4:	4c 8b 65 c8          	mov    -0x38(%rbp),%r12
+  802ef8:	eb df                	jmp    802ed9 <devfile_write_direct+0xe1>
+    if (!ipc) return -E_NO_MEM;
+  802efa:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+  802f01:	eb d9                	jmp    802edc <devfile_write_direct+0xe4>
+
+0000000000802f03 <fbuf_flush>:
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+}
+
+/* Write dirty part of window to the server */
+static int
+fbuf_flush(struct Fd *fd, struct FileBuf *fb) {
+  802f03:	55                   	push   %rbp
+  802f04:	48 89 e5             	mov    %rsp,%rbp
+  802f07:	41 56                	push   %r14
+  802f09:	41 55                	push   %r13
+  802f0b:	41 54                	push   %r12
+  802f0d:	53                   	push   %rbx
+    if (fb->fb_dstart == fb->fb_dend) return 0;
+  802f0e:	4c 8b 76 18          	mov    0x18(%rsi),%r14
+  802f12:	4c 8b 6e 20          	mov    0x20(%rsi),%r13
+  802f16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1b:	4d 39 ee             	cmp    %r13,%r14
+  802f1e:	0f 84 99 00 00 00    	je     802fbd <fbuf_flush+0xba>
+  802f24:	49 89 fc             	mov    %rdi,%r12
+  802f27:	48 89 f3             	mov    %rsi,%rbx
+
+    size_t n = fb->fb_dend - fb->fb_dstart;
+  802f2a:	4d 29 f5             	sub    %r14,%r13
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802f2d:	44 03 76 08          	add    0x8(%rsi),%r14d
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  802f31:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802f38:	00 00 00 
+  802f3b:	ff d0                	call   *%rax
+  802f3d:	48 89 c2             	mov    %rax,%rdx
+  802f40:	48 c1 e2 04          	shl    $0x4,%rdx
+  802f44:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  802f48:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f4c:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  802f51:	48 01 d0             	add    %rdx,%rax
+    ssize_t res = devfile_write_direct(fd, fbuf_data(fd) + fb->fb_dstart, n, fb->fb_base + fb->fb_dstart);
+  802f54:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  802f58:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  802f5f:	00 
+  802f60:	44 89 f1             	mov    %r14d,%ecx
+  802f63:	4c 89 ea             	mov    %r13,%rdx
+  802f66:	4c 89 e7             	mov    %r12,%rdi
+  802f69:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  802f70:	00 00 00 
+  802f73:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f75:	48 85 c0             	test   %rax,%rax
+  802f78:	78 43                	js     802fbd <fbuf_flush+0xba>
+    if ((size_t)res < n) return -E_NO_DISK;
+  802f7a:	4c 39 e8             	cmp    %r13,%rax
+  802f7d:	72 47                	jb     802fc6 <fbuf_flush+0xc3>
+    fd->fd_file.gen++;
+  802f7f:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  802f84:	83 c0 01             	add    $0x1,%eax
+  802f87:	41 89 44 24 10       	mov    %eax,0x10(%r12)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  802f8c:	89 43 04             	mov    %eax,0x4(%rbx)
+
+    fbuf_changed(fd, fb);
+    if (fb->fb_dstart <= fb->fb_valid)
+  802f8f:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  802f93:	48 3b 43 18          	cmp    0x18(%rbx),%rax
+  802f97:	72 0f                	jb     802fa8 <fbuf_flush+0xa5>
+        fb->fb_valid = MAX(fb->fb_valid, fb->fb_dend);
+  802f99:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  802f9d:	48 39 c2             	cmp    %rax,%rdx
+  802fa0:	48 0f 42 d0          	cmovb  %rax,%rdx
+  802fa4:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+    fb->fb_dstart = fb->fb_dend = 0;
+  802fa8:	48 c7 43 20 00 00 00 	movq   $0x0,0x20(%rbx)
+  802faf:	00 
+  802fb0:	48 c7 43 18 00 00 00 	movq   $0x0,0x18(%rbx)
+  802fb7:	00 
+    return 0;
+  802fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fbd:	5b                   	pop    %rbx
+  802fbe:	41 5c                	pop    %r12
+  802fc0:	41 5d                	pop    %r13
+  802fc2:	41 5e                	pop    %r14
+  802fc4:	5d                   	pop    %rbp
+  802fc5:	c3                   	ret
+    if ((size_t)res < n) return -E_NO_DISK;
+  802fc6:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802fcb:	eb f0                	jmp    802fbd <fbuf_flush+0xba>
+
+0000000000802fcd <devfile_sync>:
+
+/* Write unwritten changes of fd to the server */
+static int
+devfile_sync(struct Fd *fd) {
+  802fcd:	55                   	push   %rbp
+  802fce:	48 89 e5             	mov    %rsp,%rbp
+  802fd1:	53                   	push   %rbx
+  802fd2:	48 83 ec 08          	sub    $0x8,%rsp
+  802fd6:	48 89 fb             	mov    %rdi,%rbx
+    struct FileBuf *fb = fbuf_get(fd);
+  802fd9:	48 b8 db 2b 80 00 00 	movabs $0x802bdb,%rax
+  802fe0:	00 00 00 
+  802fe3:	ff d0                	call   *%rax
+  802fe5:	48 89 c6             	mov    %rax,%rsi
+    return fb ? fbuf_flush(fd, fb) : 0;
+  802fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fed:	48 85 f6             	test   %rsi,%rsi
+  802ff0:	74 0f                	je     803001 <devfile_sync+0x34>
+  802ff2:	48 89 df             	mov    %rbx,%rdi
+  802ff5:	48 b8 03 2f 80 00 00 	movabs $0x802f03,%rax
+  802ffc:	00 00 00 
+  802fff:	ff d0                	call   *%rax
+}
+  803001:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803005:	c9                   	leave
+  803006:	c3                   	ret
+
+0000000000803007 <fsipc>:
+fsipc(unsigned type, void *dstva) {
+  803007:	55                   	push   %rbp
+  803008:	48 89 e5             	mov    %rsp,%rbp
+  80300b:	48 83 ec 10          	sub    $0x10,%rsp
+  80300f:	48 89 f1             	mov    %rsi,%rcx
+    size_t maxsz = PAGE_SIZE;
+  803012:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  803019:	00 
+    return fsipc_region(type, &fsipcbuf, PAGE_SIZE, dstva, &maxsz);
+  80301a:	4c 8d 45 f8          	lea    -0x8(%rbp),%r8
+  80301e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803023:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  80302a:	00 00 00 
+  80302d:	48 b8 5b 2d 80 00 00 	movabs $0x802d5b,%rax
+  803034:	00 00 00 
+  803037:	ff d0                	call   *%rax
+}
+  803039:	c9                   	leave
+  80303a:	c3                   	ret
+
+000000000080303b <devfile_stat>:
+    return i;
+}
+
+/* Get file information */
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80303b:	55                   	push   %rbp
+  80303c:	48 89 e5             	mov    %rsp,%rbp
+  80303f:	41 54                	push   %r12
+  803041:	53                   	push   %rbx
+  803042:	48 89 fb             	mov    %rdi,%rbx
+  803045:	49 89 f4             	mov    %rsi,%r12
+    /* Size has to include pending writes */
+    int res = devfile_sync(fd);
+  803048:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  80304f:	00 00 00 
+  803052:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803054:	85 c0                	test   %eax,%eax
+  803056:	78 63                	js     8030bb <devfile_stat+0x80>
+
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803058:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80305b:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803062:	00 00 
+    res = fsipc(FSREQ_STAT, NULL);
+  803064:	be 00 00 00 00       	mov    $0x0,%esi
+  803069:	bf 05 00 00 00       	mov    $0x5,%edi
+  80306e:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  803075:	00 00 00 
+  803078:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80307a:	85 c0                	test   %eax,%eax
+  80307c:	78 3d                	js     8030bb <devfile_stat+0x80>
+
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80307e:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  803085:	00 00 00 
+  803088:	48 89 de             	mov    %rbx,%rsi
+  80308b:	4c 89 e7             	mov    %r12,%rdi
+  80308e:	48 b8 e0 0e 80 00 00 	movabs $0x800ee0,%rax
+  803095:	00 00 00 
+  803098:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80309a:	8b 83 80 00 00 00    	mov    0x80(%rbx),%eax
+  8030a0:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  8030a7:	00 
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8030a8:	8b 83 84 00 00 00    	mov    0x84(%rbx),%eax
+  8030ae:	41 89 84 24 84 00 00 	mov    %eax,0x84(%r12)
+  8030b5:	00 
+
+    return 0;
+  8030b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030bb:	5b                   	pop    %rbx
+  8030bc:	41 5c                	pop    %r12
+  8030be:	5d                   	pop    %rbp
+  8030bf:	c3                   	ret
+
+00000000008030c0 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8030c0:	55                   	push   %rbp
+  8030c1:	48 89 e5             	mov    %rsp,%rbp
+  8030c4:	41 54                	push   %r12
+  8030c6:	53                   	push   %rbx
+  8030c7:	48 89 fb             	mov    %rdi,%rbx
+    int res = devfile_sync(fd);
+  8030ca:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  8030d1:	00 00 00 
+  8030d4:	ff d0                	call   *%rax
+  8030d6:	41 89 c4             	mov    %eax,%r12d
+    if (fd2num(fd) < MAXFD) {
+  8030d9:	48 89 df             	mov    %rbx,%rdi
+  8030dc:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  8030e3:	00 00 00 
+  8030e6:	ff d0                	call   *%rax
+  8030e8:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8030ec:	76 2e                	jbe    80311c <devfile_flush+0x5c>
+    fsipcbuf.close.req_fileid = fd->fd_file.id;
+  8030ee:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8030f1:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  8030f8:	00 00 
+    int res2 = fsipc(FSREQ_CLOSE, NULL);
+  8030fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ff:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803104:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  803110:	45 85 e4             	test   %r12d,%r12d
+  803113:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  803117:	5b                   	pop    %rbx
+  803118:	41 5c                	pop    %r12
+  80311a:	5d                   	pop    %rbp
+  80311b:	c3                   	ret
+        filebufs[fd2num(fd)].fb_fileid = 0;
+  80311c:	48 89 df             	mov    %rbx,%rdi
+  80311f:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  803126:	00 00 00 
+  803129:	ff d0                	call   *%rax
+  80312b:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+  80312f:	48 b8 20 90 98 00 00 	movabs $0x989020,%rax
+  803136:	00 00 00 
+  803139:	c7 04 d0 00 00 00 00 	movl   $0x0,(%rax,%rdx,8)
+        USED(sys_unmap_region(0, fd2data(fd), PAGE_SIZE));
+  803140:	48 89 df             	mov    %rbx,%rdi
+  803143:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  80314a:	00 00 00 
+  80314d:	ff d0                	call   *%rax
+  80314f:	48 89 c6             	mov    %rax,%rsi
+  803152:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803157:	bf 00 00 00 00       	mov    $0x0,%edi
+  80315c:	48 b8 1f 18 80 00 00 	movabs $0x80181f,%rax
+  803163:	00 00 00 
+  803166:	ff d0                	call   *%rax
+  803168:	eb 84                	jmp    8030ee <devfile_flush+0x2e>
+
+000000000080316a <devfile_trunc>:
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80316a:	55                   	push   %rbp
+  80316b:	48 89 e5             	mov    %rsp,%rbp
+  80316e:	41 55                	push   %r13
+  803170:	41 54                	push   %r12
+  803172:	53                   	push   %rbx
+  803173:	48 83 ec 08          	sub    $0x8,%rsp
+  803177:	48 89 fb             	mov    %rdi,%rbx
+  80317a:	41 89 f5             	mov    %esi,%r13d
+    struct FileBuf *fb = fbuf_get(fd);
+  80317d:	48 b8 db 2b 80 00 00 	movabs $0x802bdb,%rax
+  803184:	00 00 00 
+  803187:	ff d0                	call   *%rax
+    int res;
+    if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803189:	48 85 c0             	test   %rax,%rax
+  80318c:	74 51                	je     8031df <devfile_trunc+0x75>
+  80318e:	49 89 c4             	mov    %rax,%r12
+  803191:	48 89 c6             	mov    %rax,%rsi
+  803194:	48 89 df             	mov    %rbx,%rdi
+  803197:	48 b8 03 2f 80 00 00 	movabs $0x802f03,%rax
+  80319e:	00 00 00 
+  8031a1:	ff d0                	call   *%rax
+  8031a3:	85 c0                	test   %eax,%eax
+  8031a5:	78 2d                	js     8031d4 <devfile_trunc+0x6a>
+
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8031a7:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  8031ae:	00 00 00 
+  8031b1:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8031b4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8031b6:	44 89 68 04          	mov    %r13d,0x4(%rax)
+
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  8031ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8031bf:	bf 02 00 00 00       	mov    $0x2,%edi
+  8031c4:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  8031cb:	00 00 00 
+  8031ce:	ff d0                	call   *%rax
+    if (res >= 0) {
+  8031d0:	85 c0                	test   %eax,%eax
+  8031d2:	79 3e                	jns    803212 <devfile_trunc+0xa8>
+        fbuf_changed(fd, fb);
+        if (fb) fb->fb_valid = 0;
+    }
+    return res;
+}
+  8031d4:	48 83 c4 08          	add    $0x8,%rsp
+  8031d8:	5b                   	pop    %rbx
+  8031d9:	41 5c                	pop    %r12
+  8031db:	41 5d                	pop    %r13
+  8031dd:	5d                   	pop    %rbp
+  8031de:	c3                   	ret
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8031df:	48 b8 00 80 98 00 00 	movabs $0x988000,%rax
+  8031e6:	00 00 00 
+  8031e9:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8031ec:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8031ee:	44 89 68 04          	mov    %r13d,0x4(%rax)
+    res = fsipc(FSREQ_SET_SIZE, NULL);
+  8031f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8031f7:	bf 02 00 00 00       	mov    $0x2,%edi
+  8031fc:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  803203:	00 00 00 
+  803206:	ff d0                	call   *%rax
+    if (res >= 0) {
+  803208:	85 c0                	test   %eax,%eax
+  80320a:	78 c8                	js     8031d4 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  80320c:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  803210:	eb c2                	jmp    8031d4 <devfile_trunc+0x6a>
+    fd->fd_file.gen++;
+  803212:	8b 4b 10             	mov    0x10(%rbx),%ecx
+  803215:	8d 51 01             	lea    0x1(%rcx),%edx
+  803218:	89 53 10             	mov    %edx,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80321b:	41 89 54 24 04       	mov    %edx,0x4(%r12)
+        if (fb) fb->fb_valid = 0;
+  803220:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803227:	00 00 
+  803229:	eb a9                	jmp    8031d4 <devfile_trunc+0x6a>
+
+000000000080322b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80322b:	55                   	push   %rbp
+  80322c:	48 89 e5             	mov    %rsp,%rbp
+  80322f:	41 57                	push   %r15
+  803231:	41 56                	push   %r14
+  803233:	41 55                	push   %r13
+  803235:	41 54                	push   %r12
+  803237:	53                   	push   %rbx
+  803238:	48 83 ec 28          	sub    $0x28,%rsp
+  80323c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803240:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  803244:	49 89 d7             	mov    %rdx,%r15
+  803247:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  80324b:	48 b8 db 2b 80 00 00 	movabs $0x802bdb,%rax
+  803252:	00 00 00 
+  803255:	ff d0                	call   *%rax
+  803257:	48 89 c3             	mov    %rax,%rbx
+    if (!fb || n >= FBUF_SIZE) {
+  80325a:	48 85 c0             	test   %rax,%rax
+  80325d:	74 31                	je     803290 <devfile_write+0x65>
+  80325f:	4c 89 f8             	mov    %r15,%rax
+  803262:	49 81 ff ff ff 00 00 	cmp    $0xffff,%r15
+  803269:	77 25                	ja     803290 <devfile_write+0x65>
+    size_t i = 0;
+  80326b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    while (i < n) {
+  803271:	48 85 c0             	test   %rax,%rax
+  803274:	0f 85 64 01 00 00    	jne    8033de <devfile_write+0x1b3>
+    size_t i = 0;
+  80327a:	4c 8b 7d c0          	mov    -0x40(%rbp),%r15
+    return i;
+  80327e:	4c 89 f8             	mov    %r15,%rax
+}
+  803281:	48 83 c4 28          	add    $0x28,%rsp
+  803285:	5b                   	pop    %rbx
+  803286:	41 5c                	pop    %r12
+  803288:	41 5d                	pop    %r13
+  80328a:	41 5e                	pop    %r14
+  80328c:	41 5f                	pop    %r15
+  80328e:	5d                   	pop    %rbp
+  80328f:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  803290:	48 85 db             	test   %rbx,%rbx
+  803293:	74 5b                	je     8032f0 <devfile_write+0xc5>
+  803295:	48 89 de             	mov    %rbx,%rsi
+  803298:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80329c:	48 b8 03 2f 80 00 00 	movabs $0x802f03,%rax
+  8032a3:	00 00 00 
+  8032a6:	ff d0                	call   *%rax
+  8032a8:	85 c0                	test   %eax,%eax
+  8032aa:	78 40                	js     8032ec <devfile_write+0xc1>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  8032ac:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8032b0:	8b 4f 04             	mov    0x4(%rdi),%ecx
+  8032b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032b7:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8032bb:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  8032c2:	00 00 00 
+  8032c5:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  8032c7:	48 85 c0             	test   %rax,%rax
+  8032ca:	7e b5                	jle    803281 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  8032cc:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8032d0:	01 46 04             	add    %eax,0x4(%rsi)
+    fd->fd_file.gen++;
+  8032d3:	8b 4e 10             	mov    0x10(%rsi),%ecx
+  8032d6:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  8032d9:	8d 51 01             	lea    0x1(%rcx),%edx
+  8032dc:	89 56 10             	mov    %edx,0x10(%rsi)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  8032df:	89 53 04             	mov    %edx,0x4(%rbx)
+            if (fb) fb->fb_valid = 0;
+  8032e2:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8032e9:	00 
+  8032ea:	eb 95                	jmp    803281 <devfile_write+0x56>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8032ec:	48 98                	cltq
+  8032ee:	eb 91                	jmp    803281 <devfile_write+0x56>
+        ssize_t cnt = devfile_write_direct(fd, buf, n, fd->fd_offset);
+  8032f0:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8032f4:	8b 4b 04             	mov    0x4(%rbx),%ecx
+  8032f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032fb:	48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+  8032ff:	48 89 df             	mov    %rbx,%rdi
+  803302:	48 b8 f8 2d 80 00 00 	movabs $0x802df8,%rax
+  803309:	00 00 00 
+  80330c:	ff d0                	call   *%rax
+        if (cnt > 0) {
+  80330e:	48 85 c0             	test   %rax,%rax
+  803311:	0f 8e 6a ff ff ff    	jle    803281 <devfile_write+0x56>
+            fd->fd_offset += cnt;
+  803317:	01 43 04             	add    %eax,0x4(%rbx)
+    fd->fd_file.gen++;
+  80331a:	83 43 10 01          	addl   $0x1,0x10(%rbx)
+    if (fb) fb->fb_gen = fd->fd_file.gen;
+  80331e:	e9 5e ff ff ff       	jmp    803281 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803323:	48 98                	cltq
+  803325:	4d 85 ff             	test   %r15,%r15
+  803328:	49 0f 45 c7          	cmovne %r15,%rax
+  80332c:	e9 50 ff ff ff       	jmp    803281 <devfile_write+0x56>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803331:	48 89 de             	mov    %rbx,%rsi
+  803334:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803338:	48 b8 03 2f 80 00 00 	movabs $0x802f03,%rax
+  80333f:	00 00 00 
+  803342:	ff d0                	call   *%rax
+  803344:	85 c0                	test   %eax,%eax
+  803346:	0f 88 2b 01 00 00    	js     803477 <devfile_write+0x24c>
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80334c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803350:	4c 01 f8             	add    %r15,%rax
+  803353:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803357:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80335b:	48 b9 07 24 80 00 00 	movabs $0x802407,%rcx
+  803362:	00 00 00 
+  803365:	ff d1                	call   *%rcx
+  803367:	48 89 c2             	mov    %rax,%rdx
+  80336a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80336e:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  803372:	48 c1 e0 0c          	shl    $0xc,%rax
+  803376:	b9 00 00 20 d0       	mov    $0xd0200000,%ecx
+  80337b:	48 01 c8             	add    %rcx,%rax
+        memcpy(fbuf_data(fd) + off, buf + i, cnt);
+  80337e:	49 8d bc 04 00 10 00 	lea    0x1000(%r12,%rax,1),%rdi
+  803385:	00 
+  803386:	4c 89 ea             	mov    %r13,%rdx
+  803389:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80338d:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  803394:	00 00 00 
+  803397:	ff d0                	call   *%rax
+        if (fb->fb_dstart == fb->fb_dend) {
+  803399:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80339d:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8033a1:	48 39 c2             	cmp    %rax,%rdx
+  8033a4:	0f 84 db 00 00 00    	je     803485 <devfile_write+0x25a>
+            fb->fb_dstart = MIN(fb->fb_dstart, off);
+  8033aa:	4c 39 e2             	cmp    %r12,%rdx
+  8033ad:	49 0f 47 d4          	cmova  %r12,%rdx
+            fb->fb_dend = MAX(fb->fb_dend, off + cnt);
+  8033b1:	4d 01 ec             	add    %r13,%r12
+  8033b4:	49 39 c4             	cmp    %rax,%r12
+  8033b7:	49 0f 43 c4          	cmovae %r12,%rax
+            fb->fb_dstart = off;
+  8033bb:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+            fb->fb_dend = off + cnt;
+  8033bf:	48 89 43 20          	mov    %rax,0x20(%rbx)
+        fd->fd_offset = pos + cnt;
+  8033c3:	45 01 ee             	add    %r13d,%r14d
+  8033c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033ca:	44 89 70 04          	mov    %r14d,0x4(%rax)
+        i += cnt;
+  8033ce:	4d 01 ef             	add    %r13,%r15
+    while (i < n) {
+  8033d1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033d5:	49 39 c7             	cmp    %rax,%r15
+  8033d8:	0f 83 a0 fe ff ff    	jae    80327e <devfile_write+0x53>
+        off_t pos = fd->fd_offset;
+  8033de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033e2:	44 8b 70 04          	mov    0x4(%rax),%r14d
+        if (pos < fb->fb_base || pos >= fb->fb_base + FBUF_SIZE) {
+  8033e6:	8b 43 08             	mov    0x8(%rbx),%eax
+  8033e9:	44 39 f0             	cmp    %r14d,%eax
+  8033ec:	7f 10                	jg     8033fe <devfile_write+0x1d3>
+  8033ee:	48 98                	cltq
+  8033f0:	48 05 ff ff 00 00    	add    $0xffff,%rax
+  8033f6:	49 63 d6             	movslq %r14d,%rdx
+  8033f9:	48 39 d0             	cmp    %rdx,%rax
+  8033fc:	7d 2d                	jge    80342b <devfile_write+0x200>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  8033fe:	48 89 de             	mov    %rbx,%rsi
+  803401:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803405:	48 b8 03 2f 80 00 00 	movabs $0x802f03,%rax
+  80340c:	00 00 00 
+  80340f:	ff d0                	call   *%rax
+  803411:	85 c0                	test   %eax,%eax
+  803413:	0f 88 0a ff ff ff    	js     803323 <devfile_write+0xf8>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803419:	44 89 f0             	mov    %r14d,%eax
+  80341c:	66 b8 00 00          	mov    $0x0,%ax
+  803420:	89 43 08             	mov    %eax,0x8(%rbx)
+            fb->fb_valid = 0;
+  803423:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80342a:	00 
+        size_t off = pos - fb->fb_base;
+  80342b:	45 89 f4             	mov    %r14d,%r12d
+  80342e:	44 2b 63 08          	sub    0x8(%rbx),%r12d
+  803432:	4d 63 e4             	movslq %r12d,%r12
+        size_t cnt = MIN(n - i, FBUF_SIZE - off);
+  803435:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  803439:	4d 29 fd             	sub    %r15,%r13
+  80343c:	b8 00 00 01 00       	mov    $0x10000,%eax
+  803441:	4c 29 e0             	sub    %r12,%rax
+  803444:	49 39 c5             	cmp    %rax,%r13
+  803447:	4c 0f 47 e8          	cmova  %rax,%r13
+        if (fb->fb_dstart != fb->fb_dend &&
+  80344b:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+  80344f:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  803453:	48 39 c2             	cmp    %rax,%rdx
+  803456:	0f 84 f0 fe ff ff    	je     80334c <devfile_write+0x121>
+  80345c:	4c 39 e0             	cmp    %r12,%rax
+  80345f:	0f 82 cc fe ff ff    	jb     803331 <devfile_write+0x106>
+            (off > fb->fb_dend || off + cnt < fb->fb_dstart)) {
+  803465:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803469:	48 39 d0             	cmp    %rdx,%rax
+  80346c:	0f 83 da fe ff ff    	jae    80334c <devfile_write+0x121>
+  803472:	e9 ba fe ff ff       	jmp    803331 <devfile_write+0x106>
+            if ((res = fbuf_flush(fd, fb)) < 0) return i ? (ssize_t)i : res;
+  803477:	48 98                	cltq
+  803479:	4d 85 ff             	test   %r15,%r15
+  80347c:	49 0f 45 c7          	cmovne %r15,%rax
+  803480:	e9 fc fd ff ff       	jmp    803281 <devfile_write+0x56>
+            fb->fb_dend = off + cnt;
+  803485:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+  803489:	4c 89 e2             	mov    %r12,%rdx
+  80348c:	e9 2a ff ff ff       	jmp    8033bb <devfile_write+0x190>
+
+0000000000803491 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803491:	55                   	push   %rbp
+  803492:	48 89 e5             	mov    %rsp,%rbp
+  803495:	41 57                	push   %r15
+  803497:	41 56                	push   %r14
+  803499:	41 55                	push   %r13
+  80349b:	41 54                	push   %r12
+  80349d:	53                   	push   %rbx
+  80349e:	48 83 ec 28          	sub    $0x28,%rsp
+  8034a2:	49 89 ff             	mov    %rdi,%r15
+  8034a5:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8034a9:	48 89 d3             	mov    %rdx,%rbx
+  8034ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct FileBuf *fb = fbuf_get(fd);
+  8034b0:	48 b8 db 2b 80 00 00 	movabs $0x802bdb,%rax
+  8034b7:	00 00 00 
+  8034ba:	ff d0                	call   *%rax
+  8034bc:	49 89 c4             	mov    %rax,%r12
+    if (!fb || n >= FBUF_SIZE) {
+  8034bf:	48 85 c0             	test   %rax,%rax
+  8034c2:	74 0d                	je     8034d1 <devfile_read+0x40>
+  8034c4:	48 81 fb ff ff 00 00 	cmp    $0xffff,%rbx
+  8034cb:	0f 86 1a 01 00 00    	jbe    8035eb <devfile_read+0x15a>
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8034d1:	4d 85 e4             	test   %r12,%r12
+  8034d4:	74 1a                	je     8034f0 <devfile_read+0x5f>
+  8034d6:	4c 89 e6             	mov    %r12,%rsi
+  8034d9:	4c 89 ff             	mov    %r15,%rdi
+  8034dc:	48 b8 03 2f 80 00 00 	movabs $0x802f03,%rax
+  8034e3:	00 00 00 
+  8034e6:	ff d0                	call   *%rax
+  8034e8:	85 c0                	test   %eax,%eax
+  8034ea:	0f 88 e8 00 00 00    	js     8035d8 <devfile_read+0x147>
+        ssize_t cnt = devfile_read_direct(fd, buf, n, fd->fd_offset);
+  8034f0:	45 8b 77 04          	mov    0x4(%r15),%r14d
+    union Fsipc *ipc = fsipc_bulk();
+  8034f4:	48 b8 f5 2c 80 00 00 	movabs $0x802cf5,%rax
+  8034fb:	00 00 00 
+  8034fe:	ff d0                	call   *%rax
+  803500:	49 89 c5             	mov    %rax,%r13
+    if (!ipc) return -E_NO_MEM;
+  803503:	48 85 c0             	test   %rax,%rax
+  803506:	0f 84 69 02 00 00    	je     803775 <devfile_read+0x2e4>
+    while (i < n) {
+  80350c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803511:	0f 84 ce 00 00 00    	je     8035e5 <devfile_read+0x154>
+    size_t i = 0;
+  803517:	bb 00 00 00 00       	mov    $0x0,%ebx
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  80351c:	48 8d 80 00 10 00 00 	lea    0x1000(%rax),%rax
+  803523:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803527:	44 89 75 c0          	mov    %r14d,-0x40(%rbp)
+  80352b:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+        size_t read_now = MIN(n - i, FSIPC_MAXDATA);
+  80352f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803533:	48 29 da             	sub    %rbx,%rdx
+  803536:	b8 00 00 04 00       	mov    $0x40000,%eax
+  80353b:	48 39 c2             	cmp    %rax,%rdx
+  80353e:	48 0f 47 d0          	cmova  %rax,%rdx
+        ipc->read.req_fileid = fd->fd_file.id;
+  803542:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803546:	41 89 45 00          	mov    %eax,0x0(%r13)
+        ipc->read.req_offset = offset + i;
+  80354a:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80354d:	01 d8                	add    %ebx,%eax
+  80354f:	41 89 45 04          	mov    %eax,0x4(%r13)
+        ipc->read.req_n = read_now;
+  803553:	49 89 55 08          	mov    %rdx,0x8(%r13)
+        int res = fsipc_region(FSREQ_READ, ipc, PAGE_SIZE + ROUNDUP(read_now, PAGE_SIZE), NULL, NULL);
+  803557:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  80355e:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  803565:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+  80356c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803572:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803577:	4c 89 ee             	mov    %r13,%rsi
+  80357a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80357f:	48 b8 5b 2d 80 00 00 	movabs $0x802d5b,%rax
+  803586:	00 00 00 
+  803589:	ff d0                	call   *%rax
+        if (res < 0)
+  80358b:	85 c0                	test   %eax,%eax
+  80358d:	78 4d                	js     8035dc <devfile_read+0x14b>
+        if (res == 0)
+  80358f:	74 4f                	je     8035e0 <devfile_read+0x14f>
+        memcpy(buf, (char *)ipc + PAGE_SIZE, res);
+  803591:	4c 63 e0             	movslq %eax,%r12
+  803594:	4c 89 e2             	mov    %r12,%rdx
+  803597:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80359b:	4c 89 f7             	mov    %r14,%rdi
+  80359e:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  8035a5:	00 00 00 
+  8035a8:	ff d0                	call   *%rax
+        i += res;
+  8035aa:	4c 01 e3             	add    %r12,%rbx
+        buf += res;
+  8035ad:	4d 01 e6             	add    %r12,%r14
+    while (i < n) {
+  8035b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035b4:	48 39 c3             	cmp    %rax,%rbx
+  8035b7:	0f 82 72 ff ff ff    	jb     80352f <devfile_read+0x9e>
+    return i;
+  8035bd:	48 89 d8             	mov    %rbx,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  8035c0:	48 85 c0             	test   %rax,%rax
+  8035c3:	7e 04                	jle    8035c9 <devfile_read+0x138>
+  8035c5:	41 01 47 04          	add    %eax,0x4(%r15)
+}
+  8035c9:	48 83 c4 28          	add    $0x28,%rsp
+  8035cd:	5b                   	pop    %rbx
+  8035ce:	41 5c                	pop    %r12
+  8035d0:	41 5d                	pop    %r13
+  8035d2:	41 5e                	pop    %r14
+  8035d4:	41 5f                	pop    %r15
+  8035d6:	5d                   	pop    %rbp
+  8035d7:	c3                   	ret
+        if (fb && (res = fbuf_flush(fd, fb)) < 0) return res;
+  8035d8:	48 98                	cltq
+  8035da:	eb ed                	jmp    8035c9 <devfile_read+0x138>
+            return res;
+  8035dc:	48 98                	cltq
+  8035de:	eb e9                	jmp    8035c9 <devfile_read+0x138>
+            return i;
+  8035e0:	48 89 d8             	mov    %rbx,%rax
+  8035e3:	eb db                	jmp    8035c0 <devfile_read+0x12f>
+    size_t i = 0;
+  8035e5:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8035e9:	eb d2                	jmp    8035bd <devfile_read+0x12c>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  8035eb:	48 89 c6             	mov    %rax,%rsi
+  8035ee:	4c 89 ff             	mov    %r15,%rdi
+  8035f1:	48 b8 03 2f 80 00 00 	movabs $0x802f03,%rax
+  8035f8:	00 00 00 
+  8035fb:	ff d0                	call   *%rax
+  8035fd:	85 c0                	test   %eax,%eax
+  8035ff:	78 40                	js     803641 <devfile_read+0x1b0>
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  803601:	4c 89 ff             	mov    %r15,%rdi
+  803604:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  80360b:	00 00 00 
+  80360e:	ff d0                	call   *%rax
+  803610:	48 89 c2             	mov    %rax,%rdx
+  803613:	48 c1 e2 04          	shl    $0x4,%rdx
+  803617:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80361b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80361f:	ba 00 00 20 d0       	mov    $0xd0200000,%edx
+  803624:	48 01 d0             	add    %rdx,%rax
+  803627:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (i < n) {
+  80362b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803630:	0f 84 33 01 00 00    	je     803769 <devfile_read+0x2d8>
+    size_t i = 0;
+  803636:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80363c:	e9 f5 00 00 00       	jmp    803736 <devfile_read+0x2a5>
+    if ((res = fbuf_flush(fd, fb)) < 0) return res;
+  803641:	48 98                	cltq
+  803643:	eb 84                	jmp    8035c9 <devfile_read+0x138>
+            fb->fb_base = ROUNDDOWN(pos, FBUF_SIZE);
+  803645:	44 89 e8             	mov    %r13d,%eax
+  803648:	66 b8 00 00          	mov    $0x0,%ax
+  80364c:	41 89 44 24 08       	mov    %eax,0x8(%r12)
+            fb->fb_valid = 0;
+  803651:	49 c7 44 24 10 00 00 	movq   $0x0,0x10(%r12)
+  803658:	00 00 
+            ipc->read.req_fileid = fd->fd_file.id;
+  80365a:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80365e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803662:	89 06                	mov    %eax,(%rsi)
+            ipc->read.req_offset = fb->fb_base;
+  803664:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  803669:	89 46 04             	mov    %eax,0x4(%rsi)
+            ipc->read.req_n = FBUF_SIZE;
+  80366c:	48 c7 46 08 00 00 01 	movq   $0x10000,0x8(%rsi)
+  803673:	00 
+            res = fsipc_region(FSREQ_READ, ipc, FBUF_STRIDE, NULL, NULL);
+  803674:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80367a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80367f:	ba 00 10 01 00       	mov    $0x11000,%edx
+  803684:	bf 03 00 00 00       	mov    $0x3,%edi
+  803689:	48 b8 5b 2d 80 00 00 	movabs $0x802d5b,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+            if (res < 0) return i ? (ssize_t)i : res;
+  803695:	85 c0                	test   %eax,%eax
+  803697:	0f 88 be 00 00 00    	js     80375b <devfile_read+0x2ca>
+            fb->fb_valid = res;
+  80369d:	48 63 d0             	movslq %eax,%rdx
+  8036a0:	49 89 54 24 10       	mov    %rdx,0x10(%r12)
+            if (pos >= fb->fb_base + res) break;
+  8036a5:	41 03 44 24 08       	add    0x8(%r12),%eax
+  8036aa:	44 39 e8             	cmp    %r13d,%eax
+  8036ad:	0f 8e ba 00 00 00    	jle    80376d <devfile_read+0x2dc>
+        size_t cnt = MIN(n - i, fb->fb_base + fb->fb_valid - pos);
+  8036b3:	49 63 c5             	movslq %r13d,%rax
+  8036b6:	49 8b 5c 24 10       	mov    0x10(%r12),%rbx
+  8036bb:	48 29 c3             	sub    %rax,%rbx
+  8036be:	49 63 44 24 08       	movslq 0x8(%r12),%rax
+  8036c3:	48 01 c3             	add    %rax,%rbx
+  8036c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036ca:	4c 29 f0             	sub    %r14,%rax
+  8036cd:	48 39 c3             	cmp    %rax,%rbx
+  8036d0:	48 0f 47 d8          	cmova  %rax,%rbx
+    return (union Fsipc *)(FBUF_BASE + fd2num(fd) * FBUF_STRIDE);
+  8036d4:	4c 89 ff             	mov    %r15,%rdi
+  8036d7:	48 b9 07 24 80 00 00 	movabs $0x802407,%rcx
+  8036de:	00 00 00 
+  8036e1:	ff d1                	call   *%rcx
+  8036e3:	48 89 c2             	mov    %rax,%rdx
+  8036e6:	48 c1 e2 04          	shl    $0x4,%rdx
+  8036ea:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8036ee:	48 c1 e0 0c          	shl    $0xc,%rax
+  8036f2:	bf 00 00 20 d0       	mov    $0xd0200000,%edi
+  8036f7:	48 01 f8             	add    %rdi,%rax
+        memcpy(buf + i, fbuf_data(fd) + (pos - fb->fb_base), cnt);
+  8036fa:	44 89 ea             	mov    %r13d,%edx
+  8036fd:	41 2b 54 24 08       	sub    0x8(%r12),%edx
+  803702:	48 63 d2             	movslq %edx,%rdx
+  803705:	48 8d b4 10 00 10 00 	lea    0x1000(%rax,%rdx,1),%rsi
+  80370c:	00 
+  80370d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  803711:	4c 01 f7             	add    %r14,%rdi
+  803714:	48 89 da             	mov    %rbx,%rdx
+  803717:	48 b9 d5 12 80 00 00 	movabs $0x8012d5,%rcx
+  80371e:	00 00 00 
+  803721:	ff d1                	call   *%rcx
+        fd->fd_offset = pos + cnt;
+  803723:	41 01 dd             	add    %ebx,%r13d
+  803726:	45 89 6f 04          	mov    %r13d,0x4(%r15)
+        i += cnt;
+  80372a:	49 01 de             	add    %rbx,%r14
+    while (i < n) {
+  80372d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803731:	49 39 c6             	cmp    %rax,%r14
+  803734:	73 37                	jae    80376d <devfile_read+0x2dc>
+        off_t pos = fd->fd_offset;
+  803736:	45 8b 6f 04          	mov    0x4(%r15),%r13d
+        if (pos < fb->fb_base || pos >= fb->fb_base + (off_t)fb->fb_valid) {
+  80373a:	41 8b 44 24 08       	mov    0x8(%r12),%eax
+  80373f:	44 39 e8             	cmp    %r13d,%eax
+  803742:	0f 8f fd fe ff ff    	jg     803645 <devfile_read+0x1b4>
+  803748:	41 03 44 24 10       	add    0x10(%r12),%eax
+  80374d:	44 39 e8             	cmp    %r13d,%eax
+  803750:	0f 8f 5d ff ff ff    	jg     8036b3 <devfile_read+0x222>
+  803756:	e9 ea fe ff ff       	jmp    803645 <devfile_read+0x1b4>
+            if (res < 0) return i ? (ssize_t)i : res;
+  80375b:	48 98                	cltq
+  80375d:	4d 85 f6             	test   %r14,%r14
+  803760:	49 0f 45 c6          	cmovne %r14,%rax
+  803764:	e9 60 fe ff ff       	jmp    8035c9 <devfile_read+0x138>
+    size_t i = 0;
+  803769:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+    return i;
+  80376d:	4c 89 f0             	mov    %r14,%rax
+  803770:	e9 54 fe ff ff       	jmp    8035c9 <devfile_read+0x138>
+    if (!ipc) return -E_NO_MEM;
+  803775:	48 c7 c0 fc ff ff ff 	mov    $0xfffffffffffffffc,%rax
+        if (cnt > 0) fd->fd_offset += cnt;
+  80377c:	e9 48 fe ff ff       	jmp    8035c9 <devfile_read+0x138>
+
+0000000000803781 <open>:
+open(const char *path, int mode) {
+  803781:	55                   	push   %rbp
+  803782:	48 89 e5             	mov    %rsp,%rbp
+  803785:	41 55                	push   %r13
+  803787:	41 54                	push   %r12
+  803789:	53                   	push   %rbx
+  80378a:	48 83 ec 18          	sub    $0x18,%rsp
+  80378e:	49 89 fc             	mov    %rdi,%r12
+  803791:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803794:	48 b8 a2 0e 80 00 00 	movabs $0x800ea2,%rax
+  80379b:	00 00 00 
+  80379e:	ff d0                	call   *%rax
+  8037a0:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8037a6:	0f 87 8a 00 00 00    	ja     803836 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8037ac:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8037b0:	48 b8 35 24 80 00 00 	movabs $0x802435,%rax
+  8037b7:	00 00 00 
+  8037ba:	ff d0                	call   *%rax
+  8037bc:	89 c3                	mov    %eax,%ebx
+  8037be:	85 c0                	test   %eax,%eax
+  8037c0:	78 50                	js     803812 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8037c2:	4c 89 e6             	mov    %r12,%rsi
+  8037c5:	48 bb 00 80 98 00 00 	movabs $0x988000,%rbx
+  8037cc:	00 00 00 
+  8037cf:	48 89 df             	mov    %rbx,%rdi
+  8037d2:	48 b8 e0 0e 80 00 00 	movabs $0x800ee0,%rax
+  8037d9:	00 00 00 
+  8037dc:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8037de:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8037e5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8037e9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8037ee:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  8037f5:	00 00 00 
+  8037f8:	ff d0                	call   *%rax
+  8037fa:	89 c3                	mov    %eax,%ebx
+  8037fc:	85 c0                	test   %eax,%eax
+  8037fe:	78 1f                	js     80381f <open+0x9e>
+    return fd2num(fd);
+  803800:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803804:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  80380b:	00 00 00 
+  80380e:	ff d0                	call   *%rax
+  803810:	89 c3                	mov    %eax,%ebx
+}
+  803812:	89 d8                	mov    %ebx,%eax
+  803814:	48 83 c4 18          	add    $0x18,%rsp
+  803818:	5b                   	pop    %rbx
+  803819:	41 5c                	pop    %r12
+  80381b:	41 5d                	pop    %r13
+  80381d:	5d                   	pop    %rbp
+  80381e:	c3                   	ret
+        fd_close(fd, 0);
+  80381f:	be 00 00 00 00       	mov    $0x0,%esi
+  803824:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803828:	48 b8 50 25 80 00 00 	movabs $0x802550,%rax
+  80382f:	00 00 00 
+  803832:	ff d0                	call   *%rax
+        return res;
+  803834:	eb dc                	jmp    803812 <open+0x91>
+        return -E_BAD_PATH;
+  803836:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80383b:	eb d5                	jmp    803812 <open+0x91>
+
+000000000080383d <fmap>:
+ *   n only at end of file.  Tail of the last page past that is
+ *   unspecified.
+ *   -E_NOT_SUPP for small files stored inline, which must be read.
+ *   < 0 on error. */
+ssize_t
+fmap(int fdnum, off_t offset, void *dstva, size_t n) {
+  80383d:	55                   	push   %rbp
+  80383e:	48 89 e5             	mov    %rsp,%rbp
+  803841:	41 57                	push   %r15
+  803843:	41 56                	push   %r14
+  803845:	41 55                	push   %r13
+  803847:	41 54                	push   %r12
+  803849:	53                   	push   %rbx
+  80384a:	48 83 ec 18          	sub    $0x18,%rsp
+  80384e:	41 89 f6             	mov    %esi,%r14d
+  803851:	49 89 d7             	mov    %rdx,%r15
+  803854:	49 89 cd             	mov    %rcx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803857:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80385b:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803867:	85 c0                	test   %eax,%eax
+  803869:	0f 88 db 00 00 00    	js     80394a <fmap+0x10d>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80386f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803873:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80387a:	00 00 00 
+  80387d:	8b 00                	mov    (%rax),%eax
+  80387f:	39 07                	cmp    %eax,(%rdi)
+  803881:	0f 85 db 00 00 00    	jne    803962 <fmap+0x125>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  803887:	45 85 f6             	test   %r14d,%r14d
+  80388a:	0f 88 db 00 00 00    	js     80396b <fmap+0x12e>
+  803890:	41 f7 c6 ff 0f 00 00 	test   $0xfff,%r14d
+  803897:	0f 85 d7 00 00 00    	jne    803974 <fmap+0x137>
+  80389d:	4c 89 fb             	mov    %r15,%rbx
+  8038a0:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8038a6:	0f 85 d1 00 00 00    	jne    80397d <fmap+0x140>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  8038ac:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  8038b3:	00 00 00 
+  8038b6:	ff d0                	call   *%rax
+  8038b8:	85 c0                	test   %eax,%eax
+  8038ba:	0f 88 8e 00 00 00    	js     80394e <fmap+0x111>
+
+    size_t i = 0;
+    while (i < n) {
+        /* Server maps one extent contiguous on disk at a time */
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8038c0:	49 bc 00 80 98 00 00 	movabs $0x988000,%r12
+  8038c7:	00 00 00 
+    while (i < n) {
+  8038ca:	4d 85 ed             	test   %r13,%r13
+  8038cd:	0f 84 8a 00 00 00    	je     80395d <fmap+0x120>
+        size_t size = ROUNDUP(n - i, PAGE_SIZE);
+  8038d3:	4c 89 ea             	mov    %r13,%rdx
+  8038d6:	48 29 da             	sub    %rbx,%rdx
+  8038d9:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8038e0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8038e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8038ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ee:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038f1:	41 89 04 24          	mov    %eax,(%r12)
+        fsipcbuf.map.req_offset = offset + i;
+  8038f5:	41 8d 04 1e          	lea    (%r14,%rbx,1),%eax
+  8038f9:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+        fsipcbuf.map.req_n = n - i;
+  8038fe:	49 89 54 24 08       	mov    %rdx,0x8(%r12)
+
+        res = fsipc_region(FSREQ_MAP, &fsipcbuf, PAGE_SIZE, dstva + i, &size);
+  803903:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  803907:	4c 8d 45 c0          	lea    -0x40(%rbp),%r8
+  80390b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803910:	4c 89 e6             	mov    %r12,%rsi
+  803913:	bf 09 00 00 00       	mov    $0x9,%edi
+  803918:	48 b8 5b 2d 80 00 00 	movabs $0x802d5b,%rax
+  80391f:	00 00 00 
+  803922:	ff d0                	call   *%rax
+        if (res < 0) return i ? (ssize_t)i : res;
+  803924:	85 c0                	test   %eax,%eax
+  803926:	78 2a                	js     803952 <fmap+0x115>
+        i += res;
+  803928:	48 98                	cltq
+  80392a:	48 01 c3             	add    %rax,%rbx
+        if ((size_t)res < size) break;
+  80392d:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  803931:	72 05                	jb     803938 <fmap+0xfb>
+    while (i < n) {
+  803933:	4c 39 eb             	cmp    %r13,%rbx
+  803936:	72 9b                	jb     8038d3 <fmap+0x96>
+    }
+    return i;
+  803938:	48 89 d8             	mov    %rbx,%rax
+}
+  80393b:	48 83 c4 18          	add    $0x18,%rsp
+  80393f:	5b                   	pop    %rbx
+  803940:	41 5c                	pop    %r12
+  803942:	41 5d                	pop    %r13
+  803944:	41 5e                	pop    %r14
+  803946:	41 5f                	pop    %r15
+  803948:	5d                   	pop    %rbp
+  803949:	c3                   	ret
+    if (res < 0) return res;
+  80394a:	48 98                	cltq
+  80394c:	eb ed                	jmp    80393b <fmap+0xfe>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  80394e:	48 98                	cltq
+  803950:	eb e9                	jmp    80393b <fmap+0xfe>
+        if (res < 0) return i ? (ssize_t)i : res;
+  803952:	48 98                	cltq
+  803954:	48 85 db             	test   %rbx,%rbx
+  803957:	48 0f 45 c3          	cmovne %rbx,%rax
+  80395b:	eb de                	jmp    80393b <fmap+0xfe>
+    size_t i = 0;
+  80395d:	4c 89 eb             	mov    %r13,%rbx
+  803960:	eb d6                	jmp    803938 <fmap+0xfb>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803962:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803969:	eb d0                	jmp    80393b <fmap+0xfe>
+    if (offset < 0 || offset % PAGE_SIZE || PAGE_OFFSET(dstva)) return -E_INVAL;
+  80396b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803972:	eb c7                	jmp    80393b <fmap+0xfe>
+  803974:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80397b:	eb be                	jmp    80393b <fmap+0xfe>
+  80397d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803984:	eb b5                	jmp    80393b <fmap+0xfe>
+
+0000000000803986 <read_map>:
+ * Returns:
+ *   The number of bytes of file data available at *blk,
+ *   0 at end of file.
+ *   < 0 on error. */
+ssize_t
+read_map(int fdnum, off_t offset, void **blk) {
+  803986:	55                   	push   %rbp
+  803987:	48 89 e5             	mov    %rsp,%rbp
+  80398a:	41 56                	push   %r14
+  80398c:	41 55                	push   %r13
+  80398e:	41 54                	push   %r12
+  803990:	53                   	push   %rbx
+  803991:	48 83 ec 10          	sub    $0x10,%rsp
+  803995:	89 fb                	mov    %edi,%ebx
+  803997:	41 89 f4             	mov    %esi,%r12d
+  80399a:	49 89 d5             	mov    %rdx,%r13
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80399d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8039a1:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  8039a8:	00 00 00 
+  8039ab:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039ad:	85 c0                	test   %eax,%eax
+  8039af:	78 63                	js     803a14 <read_map+0x8e>
+    if (offset < 0) return -E_INVAL;
+  8039b1:	45 85 e4             	test   %r12d,%r12d
+  8039b4:	0f 88 80 00 00 00    	js     803a3a <read_map+0xb4>
+
+    off_t base = ROUNDDOWN(offset, PAGE_SIZE);
+  8039ba:	45 89 e6             	mov    %r12d,%r14d
+  8039bd:	41 81 e6 00 f0 ff ff 	and    $0xfffff000,%r14d
+    ssize_t n = fmap(fdnum, base, fd2data(fd), PAGE_SIZE);
+  8039c4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8039c8:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  8039cf:	00 00 00 
+  8039d2:	ff d0                	call   *%rax
+  8039d4:	48 89 c2             	mov    %rax,%rdx
+  8039d7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039dc:	44 89 f6             	mov    %r14d,%esi
+  8039df:	89 df                	mov    %ebx,%edi
+  8039e1:	48 b8 3d 38 80 00 00 	movabs $0x80383d,%rax
+  8039e8:	00 00 00 
+  8039eb:	ff d0                	call   *%rax
+  8039ed:	48 89 c3             	mov    %rax,%rbx
+    if (n <= offset - base) return n < 0 ? n : 0;
+  8039f0:	45 29 f4             	sub    %r14d,%r12d
+  8039f3:	4d 63 f4             	movslq %r12d,%r14
+  8039f6:	49 39 c6             	cmp    %rax,%r14
+  8039f9:	7c 1d                	jl     803a18 <read_map+0x92>
+  8039fb:	48 85 c0             	test   %rax,%rax
+  8039fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a03:	48 0f 4e c3          	cmovle %rbx,%rax
+
+    *blk = fd2data(fd) + (offset - base);
+    return n - (offset - base);
+}
+  803a07:	48 83 c4 10          	add    $0x10,%rsp
+  803a0b:	5b                   	pop    %rbx
+  803a0c:	41 5c                	pop    %r12
+  803a0e:	41 5d                	pop    %r13
+  803a10:	41 5e                	pop    %r14
+  803a12:	5d                   	pop    %rbp
+  803a13:	c3                   	ret
+    if (res < 0) return res;
+  803a14:	48 98                	cltq
+  803a16:	eb ef                	jmp    803a07 <read_map+0x81>
+    *blk = fd2data(fd) + (offset - base);
+  803a18:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a1c:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  803a23:	00 00 00 
+  803a26:	ff d0                	call   *%rax
+  803a28:	4d 63 e4             	movslq %r12d,%r12
+  803a2b:	4c 01 e0             	add    %r12,%rax
+  803a2e:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return n - (offset - base);
+  803a32:	48 89 d8             	mov    %rbx,%rax
+  803a35:	4c 29 f0             	sub    %r14,%rax
+  803a38:	eb cd                	jmp    803a07 <read_map+0x81>
+    if (offset < 0) return -E_INVAL;
+  803a3a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a41:	eb c4                	jmp    803a07 <read_map+0x81>
+
+0000000000803a43 <fsync>:
+
+/* Write unwritten changes of file 'fdnum' cached by
+ * this environment and flush the file to disk */
+int
+fsync(int fdnum) {
+  803a43:	55                   	push   %rbp
+  803a44:	48 89 e5             	mov    %rsp,%rbp
+  803a47:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803a4b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803a4f:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  803a56:	00 00 00 
+  803a59:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a5b:	85 c0                	test   %eax,%eax
+  803a5d:	78 4a                	js     803aa9 <fsync+0x66>
+
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803a5f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803a63:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803a6a:	00 00 00 
+  803a6d:	8b 00                	mov    (%rax),%eax
+  803a6f:	39 07                	cmp    %eax,(%rdi)
+  803a71:	75 38                	jne    803aab <fsync+0x68>
+    if ((res = devfile_sync(fd)) < 0) return res;
+  803a73:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  803a7a:	00 00 00 
+  803a7d:	ff d0                	call   *%rax
+  803a7f:	85 c0                	test   %eax,%eax
+  803a81:	78 26                	js     803aa9 <fsync+0x66>
+
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803a83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a87:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a8a:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803a91:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  803a93:	be 00 00 00 00       	mov    $0x0,%esi
+  803a98:	bf 06 00 00 00       	mov    $0x6,%edi
+  803a9d:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  803aa4:	00 00 00 
+  803aa7:	ff d0                	call   *%rax
+}
+  803aa9:	c9                   	leave
+  803aaa:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803aab:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ab0:	eb f7                	jmp    803aa9 <fsync+0x66>
+
+0000000000803ab2 <flushall>:
+
+/* Write unwritten changes of all files cached by this environment
+ * to the file server.  Called before fork() and spawn() so that
+ * the changes are neither lost to nor duplicated by the child. */
+int
+flushall(void) {
+  803ab2:	55                   	push   %rbp
+  803ab3:	48 89 e5             	mov    %rsp,%rbp
+  803ab6:	41 57                	push   %r15
+  803ab8:	41 56                	push   %r14
+  803aba:	41 55                	push   %r13
+  803abc:	41 54                	push   %r12
+  803abe:	53                   	push   %rbx
+  803abf:	48 83 ec 18          	sub    $0x18,%rsp
+    int res = 0;
+    for (int i = 0; i < MAXFD; i++) {
+  803ac3:	49 bc 20 90 98 00 00 	movabs $0x989020,%r12
+  803aca:	00 00 00 
+  803acd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    int res = 0;
+  803ad2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        struct Fd *fd;
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803ad8:	49 bd 95 24 80 00 00 	movabs $0x802495,%r13
+  803adf:	00 00 00 
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803ae2:	49 be 20 60 80 00 00 	movabs $0x806020,%r14
+  803ae9:	00 00 00 
+  803aec:	eb 0c                	jmp    803afa <flushall+0x48>
+    for (int i = 0; i < MAXFD; i++) {
+  803aee:	83 c3 01             	add    $0x1,%ebx
+  803af1:	49 83 c4 28          	add    $0x28,%r12
+  803af5:	83 fb 20             	cmp    $0x20,%ebx
+  803af8:	74 33                	je     803b2d <flushall+0x7b>
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803afa:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  803aff:	74 ed                	je     803aee <flushall+0x3c>
+  803b01:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803b05:	89 df                	mov    %ebx,%edi
+  803b07:	41 ff d5             	call   *%r13
+  803b0a:	85 c0                	test   %eax,%eax
+  803b0c:	78 e0                	js     803aee <flushall+0x3c>
+            fd->fd_dev_id != devfile.dev_id) continue;
+  803b0e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+        if (!filebufs[i].fb_fileid || fd_lookup(i, &fd) < 0 ||
+  803b12:	41 8b 06             	mov    (%r14),%eax
+  803b15:	39 07                	cmp    %eax,(%rdi)
+  803b17:	75 d5                	jne    803aee <flushall+0x3c>
+
+        int res2 = devfile_sync(fd);
+  803b19:	48 b8 cd 2f 80 00 00 	movabs $0x802fcd,%rax
+  803b20:	00 00 00 
+  803b23:	ff d0                	call   *%rax
+        if (res2 < 0) res = res2;
+  803b25:	85 c0                	test   %eax,%eax
+  803b27:	44 0f 48 f8          	cmovs  %eax,%r15d
+  803b2b:	eb c1                	jmp    803aee <flushall+0x3c>
+    }
+    return res;
+}
+  803b2d:	44 89 f8             	mov    %r15d,%eax
+  803b30:	48 83 c4 18          	add    $0x18,%rsp
+  803b34:	5b                   	pop    %rbx
+  803b35:	41 5c                	pop    %r12
+  803b37:	41 5d                	pop    %r13
+  803b39:	41 5e                	pop    %r14
+  803b3b:	41 5f                	pop    %r15
+  803b3d:	5d                   	pop    %rbp
+  803b3e:	c3                   	ret
+
+0000000000803b3f <fsstats>:
+
+/* Fetch file server counters into *stats, zeroing them afterwards if reset */
+int
+fsstats(struct Fsret_stats *stats, bool reset) {
+  803b3f:	55                   	push   %rbp
+  803b40:	48 89 e5             	mov    %rsp,%rbp
+  803b43:	53                   	push   %rbx
+  803b44:	48 83 ec 08          	sub    $0x8,%rsp
+  803b48:	48 89 fb             	mov    %rdi,%rbx
+    fsipcbuf.stats.req_reset = reset;
+  803b4b:	40 0f b6 c6          	movzbl %sil,%eax
+  803b4f:	a3 00 80 98 00 00 00 	movabs %eax,0x988000
+  803b56:	00 00 
+    int res = fsipc(FSREQ_STATS, NULL);
+  803b58:	be 00 00 00 00       	mov    $0x0,%esi
+  803b5d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803b62:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  803b69:	00 00 00 
+  803b6c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b6e:	85 c0                	test   %eax,%eax
+  803b70:	78 23                	js     803b95 <fsstats+0x56>
+
+    memcpy(stats, &fsipcbuf.statsRet, sizeof(*stats));
+  803b72:	ba 58 06 00 00       	mov    $0x658,%edx
+  803b77:	48 be 00 80 98 00 00 	movabs $0x988000,%rsi
+  803b7e:	00 00 00 
+  803b81:	48 89 df             	mov    %rbx,%rdi
+  803b84:	48 b8 d5 12 80 00 00 	movabs $0x8012d5,%rax
+  803b8b:	00 00 00 
+  803b8e:	ff d0                	call   *%rax
+    return 0;
+  803b90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b99:	c9                   	leave
+  803b9a:	c3                   	ret
+
+0000000000803b9b <remove>:
+
+/* Delete a file */
+int
+remove(const char *path) {
+  803b9b:	55                   	push   %rbp
+  803b9c:	48 89 e5             	mov    %rsp,%rbp
+  803b9f:	53                   	push   %rbx
+  803ba0:	48 83 ec 08          	sub    $0x8,%rsp
+  803ba4:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN)
+  803ba7:	48 b8 a2 0e 80 00 00 	movabs $0x800ea2,%rax
+  803bae:	00 00 00 
+  803bb1:	ff d0                	call   *%rax
+  803bb3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803bb9:	77 35                	ja     803bf0 <remove+0x55>
+        return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+  803bbb:	48 89 de             	mov    %rbx,%rsi
+  803bbe:	48 bf 00 80 98 00 00 	movabs $0x988000,%rdi
+  803bc5:	00 00 00 
+  803bc8:	48 b8 e0 0e 80 00 00 	movabs $0x800ee0,%rax
+  803bcf:	00 00 00 
+  803bd2:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL);
+  803bd4:	be 00 00 00 00       	mov    $0x0,%esi
+  803bd9:	bf 07 00 00 00       	mov    $0x7,%edi
+  803bde:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  803be5:	00 00 00 
+  803be8:	ff d0                	call   *%rax
+}
+  803bea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bee:	c9                   	leave
+  803bef:	c3                   	ret
+        return -E_BAD_PATH;
+  803bf0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803bf5:	eb f3                	jmp    803bea <remove+0x4f>
+
+0000000000803bf7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803bf7:	55                   	push   %rbp
+  803bf8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+    flushall();
+  803bfb:	48 b8 b2 3a 80 00 00 	movabs $0x803ab2,%rax
+  803c02:	00 00 00 
+  803c05:	ff d0                	call   *%rax
+
+    return fsipc(FSREQ_SYNC, NULL);
+  803c07:	be 00 00 00 00       	mov    $0x0,%esi
+  803c0c:	bf 08 00 00 00       	mov    $0x8,%edi
+  803c11:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  803c18:	00 00 00 
+  803c1b:	ff d0                	call   *%rax
+}
+  803c1d:	5d                   	pop    %rbp
+  803c1e:	c3                   	ret
+
+0000000000803c1f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803c1f:	55                   	push   %rbp
+  803c20:	48 89 e5             	mov    %rsp,%rbp
+  803c23:	41 54                	push   %r12
+  803c25:	53                   	push   %rbx
+  803c26:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c29:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  803c30:	00 00 00 
+  803c33:	ff d0                	call   *%rax
+  803c35:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803c38:	48 be 00 58 80 00 00 	movabs $0x805800,%rsi
+  803c3f:	00 00 00 
+  803c42:	48 89 df             	mov    %rbx,%rdi
+  803c45:	48 b8 e0 0e 80 00 00 	movabs $0x800ee0,%rax
+  803c4c:	00 00 00 
+  803c4f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803c51:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803c56:	41 2b 04 24          	sub    (%r12),%eax
+  803c5a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803c60:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803c67:	00 00 00 
+    stat->st_dev = &devpipe;
+  803c6a:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803c71:	00 00 00 
+  803c74:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c80:	5b                   	pop    %rbx
+  803c81:	41 5c                	pop    %r12
+  803c83:	5d                   	pop    %rbp
+  803c84:	c3                   	ret
+
+0000000000803c85 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803c85:	55                   	push   %rbp
+  803c86:	48 89 e5             	mov    %rsp,%rbp
+  803c89:	41 54                	push   %r12
+  803c8b:	53                   	push   %rbx
+  803c8c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803c8f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c94:	48 89 fe             	mov    %rdi,%rsi
+  803c97:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c9c:	49 bc 1f 18 80 00 00 	movabs $0x80181f,%r12
+  803ca3:	00 00 00 
+  803ca6:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803ca9:	48 89 df             	mov    %rbx,%rdi
+  803cac:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  803cb3:	00 00 00 
+  803cb6:	ff d0                	call   *%rax
+  803cb8:	48 89 c6             	mov    %rax,%rsi
+  803cbb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cc5:	41 ff d4             	call   *%r12
+}
+  803cc8:	5b                   	pop    %rbx
+  803cc9:	41 5c                	pop    %r12
+  803ccb:	5d                   	pop    %rbp
+  803ccc:	c3                   	ret
+
+0000000000803ccd <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803ccd:	55                   	push   %rbp
+  803cce:	48 89 e5             	mov    %rsp,%rbp
+  803cd1:	41 57                	push   %r15
+  803cd3:	41 56                	push   %r14
+  803cd5:	41 55                	push   %r13
+  803cd7:	41 54                	push   %r12
+  803cd9:	53                   	push   %rbx
+  803cda:	48 83 ec 18          	sub    $0x18,%rsp
+  803cde:	49 89 fc             	mov    %rdi,%r12
+  803ce1:	49 89 f5             	mov    %rsi,%r13
+  803ce4:	49 89 d7             	mov    %rdx,%r15
+  803ce7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ceb:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  803cf2:	00 00 00 
+  803cf5:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803cf7:	4d 85 ff             	test   %r15,%r15
+  803cfa:	0f 84 af 00 00 00    	je     803daf <devpipe_write+0xe2>
+  803d00:	48 89 c3             	mov    %rax,%rbx
+  803d03:	4c 89 f8             	mov    %r15,%rax
+  803d06:	4d 89 ef             	mov    %r13,%r15
+  803d09:	4c 01 e8             	add    %r13,%rax
+  803d0c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803d10:	49 bd 14 16 80 00 00 	movabs $0x801614,%r13
+  803d17:	00 00 00 
+            sys_yield();
+  803d1a:	49 be b1 15 80 00 00 	movabs $0x8015b1,%r14
+  803d21:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803d24:	8b 73 04             	mov    0x4(%rbx),%esi
+  803d27:	48 63 ce             	movslq %esi,%rcx
+  803d2a:	48 63 03             	movslq (%rbx),%rax
+  803d2d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803d33:	48 39 c1             	cmp    %rax,%rcx
+  803d36:	72 2e                	jb     803d66 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803d38:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803d3d:	48 89 da             	mov    %rbx,%rdx
+  803d40:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d45:	4c 89 e7             	mov    %r12,%rdi
+  803d48:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803d4b:	85 c0                	test   %eax,%eax
+  803d4d:	74 66                	je     803db5 <devpipe_write+0xe8>
+            sys_yield();
+  803d4f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803d52:	8b 73 04             	mov    0x4(%rbx),%esi
+  803d55:	48 63 ce             	movslq %esi,%rcx
+  803d58:	48 63 03             	movslq (%rbx),%rax
+  803d5b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803d61:	48 39 c1             	cmp    %rax,%rcx
+  803d64:	73 d2                	jae    803d38 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803d66:	41 0f b6 3f          	movzbl (%r15),%edi
+  803d6a:	48 89 ca             	mov    %rcx,%rdx
+  803d6d:	48 c1 ea 03          	shr    $0x3,%rdx
+  803d71:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803d78:	08 10 20 
+  803d7b:	48 f7 e2             	mul    %rdx
+  803d7e:	48 c1 ea 06          	shr    $0x6,%rdx
+  803d82:	48 89 d0             	mov    %rdx,%rax
+  803d85:	48 c1 e0 09          	shl    $0x9,%rax
+  803d89:	48 29 d0             	sub    %rdx,%rax
+  803d8c:	48 c1 e0 03          	shl    $0x3,%rax
+  803d90:	48 29 c1             	sub    %rax,%rcx
+  803d93:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803d98:	83 c6 01             	add    $0x1,%esi
+  803d9b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d9e:	49 83 c7 01          	add    $0x1,%r15
+  803da2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803da6:	49 39 c7             	cmp    %rax,%r15
+  803da9:	0f 85 75 ff ff ff    	jne    803d24 <devpipe_write+0x57>
+    return n;
+  803daf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803db3:	eb 05                	jmp    803dba <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803db5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dba:	48 83 c4 18          	add    $0x18,%rsp
+  803dbe:	5b                   	pop    %rbx
+  803dbf:	41 5c                	pop    %r12
+  803dc1:	41 5d                	pop    %r13
+  803dc3:	41 5e                	pop    %r14
+  803dc5:	41 5f                	pop    %r15
+  803dc7:	5d                   	pop    %rbp
+  803dc8:	c3                   	ret
+
+0000000000803dc9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803dc9:	55                   	push   %rbp
+  803dca:	48 89 e5             	mov    %rsp,%rbp
+  803dcd:	41 57                	push   %r15
+  803dcf:	41 56                	push   %r14
+  803dd1:	41 55                	push   %r13
+  803dd3:	41 54                	push   %r12
+  803dd5:	53                   	push   %rbx
+  803dd6:	48 83 ec 18          	sub    $0x18,%rsp
+  803dda:	49 89 fc             	mov    %rdi,%r12
+  803ddd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803de1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803de5:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  803dec:	00 00 00 
+  803def:	ff d0                	call   *%rax
+  803df1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803df4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803dfa:	49 bd 14 16 80 00 00 	movabs $0x801614,%r13
+  803e01:	00 00 00 
+            sys_yield();
+  803e04:	49 be b1 15 80 00 00 	movabs $0x8015b1,%r14
+  803e0b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803e0e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803e13:	74 7d                	je     803e92 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803e15:	8b 03                	mov    (%rbx),%eax
+  803e17:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803e1a:	75 26                	jne    803e42 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803e1c:	4d 85 ff             	test   %r15,%r15
+  803e1f:	75 77                	jne    803e98 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e21:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e26:	48 89 da             	mov    %rbx,%rdx
+  803e29:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e2e:	4c 89 e7             	mov    %r12,%rdi
+  803e31:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e34:	85 c0                	test   %eax,%eax
+  803e36:	74 72                	je     803eaa <devpipe_read+0xe1>
+            sys_yield();
+  803e38:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803e3b:	8b 03                	mov    (%rbx),%eax
+  803e3d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803e40:	74 df                	je     803e21 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803e42:	48 63 c8             	movslq %eax,%rcx
+  803e45:	48 89 ca             	mov    %rcx,%rdx
+  803e48:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e4c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803e53:	08 10 20 
+  803e56:	48 89 d0             	mov    %rdx,%rax
+  803e59:	48 f7 e6             	mul    %rsi
+  803e5c:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e60:	48 89 d0             	mov    %rdx,%rax
+  803e63:	48 c1 e0 09          	shl    $0x9,%rax
+  803e67:	48 29 d0             	sub    %rdx,%rax
+  803e6a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803e71:	00 
+  803e72:	48 89 c8             	mov    %rcx,%rax
+  803e75:	48 29 d0             	sub    %rdx,%rax
+  803e78:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803e7d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e81:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803e85:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e88:	49 83 c7 01          	add    $0x1,%r15
+  803e8c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803e90:	75 83                	jne    803e15 <devpipe_read+0x4c>
+    return n;
+  803e92:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e96:	eb 03                	jmp    803e9b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803e98:	4c 89 f8             	mov    %r15,%rax
+}
+  803e9b:	48 83 c4 18          	add    $0x18,%rsp
+  803e9f:	5b                   	pop    %rbx
+  803ea0:	41 5c                	pop    %r12
+  803ea2:	41 5d                	pop    %r13
+  803ea4:	41 5e                	pop    %r14
+  803ea6:	41 5f                	pop    %r15
+  803ea8:	5d                   	pop    %rbp
+  803ea9:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eaf:	eb ea                	jmp    803e9b <devpipe_read+0xd2>
+
+0000000000803eb1 <pipe>:
+pipe(int pfd[2]) {
+  803eb1:	55                   	push   %rbp
+  803eb2:	48 89 e5             	mov    %rsp,%rbp
+  803eb5:	41 55                	push   %r13
+  803eb7:	41 54                	push   %r12
+  803eb9:	53                   	push   %rbx
+  803eba:	48 83 ec 18          	sub    $0x18,%rsp
+  803ebe:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ec1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ec5:	48 b8 35 24 80 00 00 	movabs $0x802435,%rax
+  803ecc:	00 00 00 
+  803ecf:	ff d0                	call   *%rax
+  803ed1:	89 c3                	mov    %eax,%ebx
+  803ed3:	85 c0                	test   %eax,%eax
+  803ed5:	0f 88 a0 01 00 00    	js     80407b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803edb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ee0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ee5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ee9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eee:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  803ef5:	00 00 00 
+  803ef8:	ff d0                	call   *%rax
+  803efa:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803efc:	85 c0                	test   %eax,%eax
+  803efe:	0f 88 77 01 00 00    	js     80407b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f04:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803f08:	48 b8 35 24 80 00 00 	movabs $0x802435,%rax
+  803f0f:	00 00 00 
+  803f12:	ff d0                	call   *%rax
+  803f14:	89 c3                	mov    %eax,%ebx
+  803f16:	85 c0                	test   %eax,%eax
+  803f18:	0f 88 43 01 00 00    	js     804061 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803f1e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f28:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f31:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  803f38:	00 00 00 
+  803f3b:	ff d0                	call   *%rax
+  803f3d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f3f:	85 c0                	test   %eax,%eax
+  803f41:	0f 88 1a 01 00 00    	js     804061 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803f47:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f4b:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  803f52:	00 00 00 
+  803f55:	ff d0                	call   *%rax
+  803f57:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803f5a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f5f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f64:	48 89 c6             	mov    %rax,%rsi
+  803f67:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f6c:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  803f73:	00 00 00 
+  803f76:	ff d0                	call   *%rax
+  803f78:	89 c3                	mov    %eax,%ebx
+  803f7a:	85 c0                	test   %eax,%eax
+  803f7c:	0f 88 c5 00 00 00    	js     804047 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803f82:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f86:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  803f8d:	00 00 00 
+  803f90:	ff d0                	call   *%rax
+  803f92:	48 89 c1             	mov    %rax,%rcx
+  803f95:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803f9b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fa6:	4c 89 ee             	mov    %r13,%rsi
+  803fa9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fae:	48 b8 a7 16 80 00 00 	movabs $0x8016a7,%rax
+  803fb5:	00 00 00 
+  803fb8:	ff d0                	call   *%rax
+  803fba:	89 c3                	mov    %eax,%ebx
+  803fbc:	85 c0                	test   %eax,%eax
+  803fbe:	78 6e                	js     80402e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803fc0:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fc5:	4c 89 ef             	mov    %r13,%rdi
+  803fc8:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  803fcf:	00 00 00 
+  803fd2:	ff d0                	call   *%rax
+  803fd4:	83 f8 02             	cmp    $0x2,%eax
+  803fd7:	0f 85 ab 00 00 00    	jne    804088 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803fdd:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803fe4:	00 00 
+  803fe6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803fea:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803fec:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ff0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803ff7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ffb:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ffd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804001:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804008:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80400c:	48 bb 07 24 80 00 00 	movabs $0x802407,%rbx
+  804013:	00 00 00 
+  804016:	ff d3                	call   *%rbx
+  804018:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80401c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804020:	ff d3                	call   *%rbx
+  804022:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804027:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80402c:	eb 4d                	jmp    80407b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80402e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804033:	4c 89 ee             	mov    %r13,%rsi
+  804036:	bf 00 00 00 00       	mov    $0x0,%edi
+  80403b:	48 b8 1f 18 80 00 00 	movabs $0x80181f,%rax
+  804042:	00 00 00 
+  804045:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804047:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80404c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804050:	bf 00 00 00 00       	mov    $0x0,%edi
+  804055:	48 b8 1f 18 80 00 00 	movabs $0x80181f,%rax
+  80405c:	00 00 00 
+  80405f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804061:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804066:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80406a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80406f:	48 b8 1f 18 80 00 00 	movabs $0x80181f,%rax
+  804076:	00 00 00 
+  804079:	ff d0                	call   *%rax
+}
+  80407b:	89 d8                	mov    %ebx,%eax
+  80407d:	48 83 c4 18          	add    $0x18,%rsp
+  804081:	5b                   	pop    %rbx
+  804082:	41 5c                	pop    %r12
+  804084:	41 5d                	pop    %r13
+  804086:	5d                   	pop    %rbp
+  804087:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804088:	48 b9 30 58 80 00 00 	movabs $0x805830,%rcx
+  80408f:	00 00 00 
+  804092:	48 ba 07 58 80 00 00 	movabs $0x805807,%rdx
+  804099:	00 00 00 
+  80409c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8040a1:	48 bf 1c 58 80 00 00 	movabs $0x80581c,%rdi
+  8040a8:	00 00 00 
+  8040ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b0:	49 b8 18 04 80 00 00 	movabs $0x800418,%r8
+  8040b7:	00 00 00 
+  8040ba:	41 ff d0             	call   *%r8
+
+00000000008040bd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8040bd:	55                   	push   %rbp
+  8040be:	48 89 e5             	mov    %rsp,%rbp
+  8040c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040c5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040c9:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  8040d0:	00 00 00 
+  8040d3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040d5:	85 c0                	test   %eax,%eax
+  8040d7:	78 35                	js     80410e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8040d9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040dd:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  8040e4:	00 00 00 
+  8040e7:	ff d0                	call   *%rax
+  8040e9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040ec:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8040f1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040f6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040fa:	48 b8 14 16 80 00 00 	movabs $0x801614,%rax
+  804101:	00 00 00 
+  804104:	ff d0                	call   *%rax
+  804106:	85 c0                	test   %eax,%eax
+  804108:	0f 94 c0             	sete   %al
+  80410b:	0f b6 c0             	movzbl %al,%eax
+}
+  80410e:	c9                   	leave
+  80410f:	c3                   	ret
+
+0000000000804110 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804110:	48 89 f8             	mov    %rdi,%rax
+  804113:	48 c1 e8 27          	shr    $0x27,%rax
+  804117:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80411e:	7f 00 00 
+  804121:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804125:	f6 c2 01             	test   $0x1,%dl
+  804128:	74 6d                	je     804197 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80412a:	48 89 f8             	mov    %rdi,%rax
+  80412d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804131:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  804138:	7f 00 00 
+  80413b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80413f:	f6 c2 01             	test   $0x1,%dl
+  804142:	74 62                	je     8041a6 <get_uvpt_entry+0x96>
+  804144:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  80414b:	7f 00 00 
+  80414e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804152:	f6 c2 80             	test   $0x80,%dl
+  804155:	75 4f                	jne    8041a6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804157:	48 89 f8             	mov    %rdi,%rax
+  80415a:	48 c1 e8 15          	shr    $0x15,%rax
+  80415e:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804165:	7f 00 00 
+  804168:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80416c:	f6 c2 01             	test   $0x1,%dl
+  80416f:	74 44                	je     8041b5 <get_uvpt_entry+0xa5>
+  804171:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  804178:	7f 00 00 
+  80417b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80417f:	f6 c2 80             	test   $0x80,%dl
+  804182:	75 31                	jne    8041b5 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804184:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804188:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  80418f:	7f 00 00 
+  804192:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804196:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804197:	48 ba 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rdx
+  80419e:	7f 00 00 
+  8041a1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041a5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8041a6:	48 ba 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rdx
+  8041ad:	7f 00 00 
+  8041b0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041b4:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8041b5:	48 ba 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rdx
+  8041bc:	7f 00 00 
+  8041bf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041c3:	c3                   	ret
+
+00000000008041c4 <get_phys_addr>:
+
+uintptr_t
+get_phys_addr(void *va) {
+  8041c4:	48 89 fa             	mov    %rdi,%rdx
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8041c7:	48 89 f9             	mov    %rdi,%rcx
+  8041ca:	48 c1 e9 27          	shr    $0x27,%rcx
+  8041ce:	48 b8 00 f0 ef df bf 	movabs $0x7fbfdfeff000,%rax
+  8041d5:	7f 00 00 
+  8041d8:	48 8b 0c c8          	mov    (%rax,%rcx,8),%rcx
+        return -1;
+  8041dc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpml4[VPML4(va)] & PTE_P))
+  8041e3:	f6 c1 01             	test   $0x1,%cl
+  8041e6:	0f 84 b2 00 00 00    	je     80429e <get_phys_addr+0xda>
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  8041ec:	48 89 f9             	mov    %rdi,%rcx
+  8041ef:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8041f3:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8041fa:	7f 00 00 
+  8041fd:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804201:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpdp[VPDP(va)] & PTE_P))
+  804208:	40 f6 c6 01          	test   $0x1,%sil
+  80420c:	0f 84 8c 00 00 00    	je     80429e <get_phys_addr+0xda>
+    if (uvpdp[VPDP(va)] & PTE_PS)
+  804212:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  804219:	7f 00 00 
+  80421c:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804220:	a8 80                	test   $0x80,%al
+  804222:	75 7b                	jne    80429f <get_phys_addr+0xdb>
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804224:	48 89 f9             	mov    %rdi,%rcx
+  804227:	48 c1 e9 15          	shr    $0x15,%rcx
+  80422b:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  804232:	7f 00 00 
+  804235:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  804239:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpd[VPD(va)] & PTE_P))
+  804240:	40 f6 c6 01          	test   $0x1,%sil
+  804244:	74 58                	je     80429e <get_phys_addr+0xda>
+    if ((uvpd[VPD(va)] & PTE_PS))
+  804246:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  80424d:	7f 00 00 
+  804250:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804254:	a8 80                	test   $0x80,%al
+  804256:	75 6c                	jne    8042c4 <get_phys_addr+0x100>
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804258:	48 89 f9             	mov    %rdi,%rcx
+  80425b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80425f:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804266:	7f 00 00 
+  804269:	48 8b 34 c8          	mov    (%rax,%rcx,8),%rsi
+        return -1;
+  80426d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    if (!(uvpt[VPT(va)] & PTE_P))
+  804274:	40 f6 c6 01          	test   $0x1,%sil
+  804278:	74 24                	je     80429e <get_phys_addr+0xda>
+    return PTE_ADDR(uvpt[VPT(va)]) + PAGE_OFFSET(va);
+  80427a:	48 b8 00 00 00 00 80 	movabs $0x7f8000000000,%rax
+  804281:	7f 00 00 
+  804284:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  804288:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  80428f:	ff ff 7f 
+  804292:	48 21 c8             	and    %rcx,%rax
+  804295:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80429b:	48 09 d0             	or     %rdx,%rax
+}
+  80429e:	c3                   	ret
+        return PTE_ADDR(uvpdp[VPDP(va)]) + ((uintptr_t)va & ((1ULL << PDP_SHIFT) - 1));
+  80429f:	48 b8 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rax
+  8042a6:	7f 00 00 
+  8042a9:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8042ad:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8042b4:	ff ff 7f 
+  8042b7:	48 21 c8             	and    %rcx,%rax
+  8042ba:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+  8042c0:	48 01 d0             	add    %rdx,%rax
+  8042c3:	c3                   	ret
+        return PTE_ADDR(uvpd[VPD(va)]) + ((uintptr_t)va & ((1ULL << PD_SHIFT) - 1));
+  8042c4:	48 b8 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rax
+  8042cb:	7f 00 00 
+  8042ce:	48 8b 04 c8          	mov    (%rax,%rcx,8),%rax
+  8042d2:	48 b9 00 f0 ff ff ff 	movabs $0x7ffffffffffff000,%rcx
+  8042d9:	ff ff 7f 
+  8042dc:	48 21 c8             	and    %rcx,%rax
+  8042df:	81 e2 ff ff 1f 00    	and    $0x1fffff,%edx
+  8042e5:	48 01 d0             	add    %rdx,%rax
+  8042e8:	c3                   	ret
+
+00000000008042e9 <get_prot>:
+
+int
+get_prot(void *va) {
+  8042e9:	55                   	push   %rbp
+  8042ea:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042ed:	48 b8 10 41 80 00 00 	movabs $0x804110,%rax
+  8042f4:	00 00 00 
+  8042f7:	ff d0                	call   *%rax
+  8042f9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042fc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804301:	89 c1                	mov    %eax,%ecx
+  804303:	83 c9 04             	or     $0x4,%ecx
+  804306:	f6 c2 01             	test   $0x1,%dl
+  804309:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80430c:	89 c1                	mov    %eax,%ecx
+  80430e:	83 c9 02             	or     $0x2,%ecx
+  804311:	f6 c2 02             	test   $0x2,%dl
+  804314:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804317:	89 c1                	mov    %eax,%ecx
+  804319:	83 c9 01             	or     $0x1,%ecx
+  80431c:	48 85 d2             	test   %rdx,%rdx
+  80431f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804322:	89 c1                	mov    %eax,%ecx
+  804324:	83 c9 40             	or     $0x40,%ecx
+  804327:	f6 c6 04             	test   $0x4,%dh
+  80432a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80432d:	5d                   	pop    %rbp
+  80432e:	c3                   	ret
+
+000000000080432f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80432f:	55                   	push   %rbp
+  804330:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804333:	48 b8 10 41 80 00 00 	movabs $0x804110,%rax
+  80433a:	00 00 00 
+  80433d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80433f:	48 c1 e8 06          	shr    $0x6,%rax
+  804343:	83 e0 01             	and    $0x1,%eax
+}
+  804346:	5d                   	pop    %rbp
+  804347:	c3                   	ret
+
+0000000000804348 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804348:	55                   	push   %rbp
+  804349:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80434c:	48 b8 10 41 80 00 00 	movabs $0x804110,%rax
+  804353:	00 00 00 
+  804356:	ff d0                	call   *%rax
+  804358:	83 e0 01             	and    $0x1,%eax
+}
+  80435b:	5d                   	pop    %rbp
+  80435c:	c3                   	ret
+
+000000000080435d <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region.
+     * NOTE: Skip over larger pages/page directories for efficiency */
+    for (uintptr_t addr_4 = 0; addr_4 < MAX_USER_ADDRESS; addr_4 += 1ULL << PML4_SHIFT)
+        if (uvpml4[VPML4(addr_4)] & PTE_P)
+  80435d:	48 a1 00 f0 ef df bf 	movabs 0x7fbfdfeff000,%rax
+  804364:	7f 00 00 
+  804367:	a8 01                	test   $0x1,%al
+  804369:	75 06                	jne    804371 <foreach_shared_region+0x14>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+
+    return 0;
+}
+  80436b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804370:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804371:	55                   	push   %rbp
+  804372:	48 89 e5             	mov    %rsp,%rbp
+  804375:	41 57                	push   %r15
+  804377:	41 56                	push   %r14
+  804379:	41 55                	push   %r13
+  80437b:	41 54                	push   %r12
+  80437d:	53                   	push   %rbx
+  80437e:	48 83 ec 18          	sub    $0x18,%rsp
+  804382:	49 89 fe             	mov    %rdi,%r14
+  804385:	49 89 f7             	mov    %rsi,%r15
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804388:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80438f:	00 
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  804390:	49 bc 00 00 00 00 80 	movabs $0x7f8000000000,%r12
+  804397:	7f 00 00 
+  80439a:	e9 81 00 00 00       	jmp    804420 <foreach_shared_region+0xc3>
+                            for (uintptr_t addr_1 = 0; addr_1 < 1ULL << PD_SHIFT; addr_1 += 1ULL << PT_SHIFT)
+  80439f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8043a6:	49 39 dd             	cmp    %rbx,%r13
+  8043a9:	74 2b                	je     8043d6 <foreach_shared_region+0x79>
+                                if (uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_P && uvpt[VPT(addr_4 + addr_3 + addr_2 + addr_1)] & PTE_SHARE)
+  8043ab:	48 89 d8             	mov    %rbx,%rax
+  8043ae:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043b2:	49 8b 14 c4          	mov    (%r12,%rax,8),%rdx
+  8043b6:	f6 c2 01             	test   $0x1,%dl
+  8043b9:	74 e4                	je     80439f <foreach_shared_region+0x42>
+  8043bb:	49 8b 04 c4          	mov    (%r12,%rax,8),%rax
+  8043bf:	f6 c4 04             	test   $0x4,%ah
+  8043c2:	74 db                	je     80439f <foreach_shared_region+0x42>
+                                    fun((void *)(addr_4 + addr_3 + addr_2 + addr_1), (void *)(addr_4 + addr_3 + addr_2 + addr_1 + PAGE_SIZE), arg);
+  8043c4:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8043cb:	4c 89 fa             	mov    %r15,%rdx
+  8043ce:	48 89 df             	mov    %rbx,%rdi
+  8043d1:	41 ff d6             	call   *%r14
+  8043d4:	eb c9                	jmp    80439f <foreach_shared_region+0x42>
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  8043d6:	49 81 c5 00 00 20 00 	add    $0x200000,%r13
+  8043dd:	4c 39 6d c8          	cmp    %r13,-0x38(%rbp)
+  8043e1:	74 22                	je     804405 <foreach_shared_region+0xa8>
+                        if (uvpd[VPD(addr_4 + addr_3 + addr_2)] & PTE_P)
+  8043e3:	49 8d 9d 00 00 e0 ff 	lea    -0x200000(%r13),%rbx
+  8043ea:	48 89 d8             	mov    %rbx,%rax
+  8043ed:	48 c1 e8 15          	shr    $0x15,%rax
+  8043f1:	48 b9 00 00 00 c0 bf 	movabs $0x7fbfc0000000,%rcx
+  8043f8:	7f 00 00 
+  8043fb:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8043ff:	a8 01                	test   $0x1,%al
+  804401:	74 d3                	je     8043d6 <foreach_shared_region+0x79>
+  804403:	eb a6                	jmp    8043ab <foreach_shared_region+0x4e>
+            for (uintptr_t addr_3 = 0; addr_3 < 1ULL << PML4_SHIFT; addr_3 += 1ULL << PDP_SHIFT)
+  804405:	48 81 45 c0 00 00 00 	addq   $0x40000000,-0x40(%rbp)
+  80440c:	40 
+  80440d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804411:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804418:	00 00 00 
+  80441b:	48 39 c1             	cmp    %rax,%rcx
+  80441e:	74 31                	je     804451 <foreach_shared_region+0xf4>
+                if (uvpdp[VPDP(addr_4 + addr_3)] & PTE_P)
+  804420:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804424:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804428:	48 b9 00 00 e0 df bf 	movabs $0x7fbfdfe00000,%rcx
+  80442f:	7f 00 00 
+  804432:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804436:	a8 01                	test   $0x1,%al
+  804438:	74 cb                	je     804405 <foreach_shared_region+0xa8>
+  80443a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80443e:	4c 8d a8 00 00 20 00 	lea    0x200000(%rax),%r13
+                    for (uintptr_t addr_2 = 0; addr_2 < 1ULL << PDP_SHIFT; addr_2 += 1ULL << PD_SHIFT)
+  804445:	48 05 00 00 20 40    	add    $0x40200000,%rax
+  80444b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80444f:	eb 92                	jmp    8043e3 <foreach_shared_region+0x86>
+}
+  804451:	b8 00 00 00 00       	mov    $0x0,%eax
+  804456:	48 83 c4 18          	add    $0x18,%rsp
+  80445a:	5b                   	pop    %rbx
+  80445b:	41 5c                	pop    %r12
+  80445d:	41 5d                	pop    %r13
+  80445f:	41 5e                	pop    %r14
+  804461:	41 5f                	pop    %r15
+  804463:	5d                   	pop    %rbp
+  804464:	c3                   	ret
+
+0000000000804465 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80446a:	c3                   	ret
+
+000000000080446b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80446b:	55                   	push   %rbp
+  80446c:	48 89 e5             	mov    %rsp,%rbp
+  80446f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804472:	48 be 54 58 80 00 00 	movabs $0x805854,%rsi
+  804479:	00 00 00 
+  80447c:	48 b8 e0 0e 80 00 00 	movabs $0x800ee0,%rax
+  804483:	00 00 00 
+  804486:	ff d0                	call   *%rax
+    return 0;
+}
+  804488:	b8 00 00 00 00       	mov    $0x0,%eax
+  80448d:	5d                   	pop    %rbp
+  80448e:	c3                   	ret
+
+000000000080448f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80448f:	55                   	push   %rbp
+  804490:	48 89 e5             	mov    %rsp,%rbp
+  804493:	41 57                	push   %r15
+  804495:	41 56                	push   %r14
+  804497:	41 55                	push   %r13
+  804499:	41 54                	push   %r12
+  80449b:	53                   	push   %rbx
+  80449c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8044a3:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8044aa:	48 85 d2             	test   %rdx,%rdx
+  8044ad:	74 7a                	je     804529 <devcons_write+0x9a>
+  8044af:	49 89 d6             	mov    %rdx,%r14
+  8044b2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8044b8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8044bd:	49 bf 6e 12 80 00 00 	movabs $0x80126e,%r15
+  8044c4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8044c7:	4c 89 f3             	mov    %r14,%rbx
+  8044ca:	48 29 f3             	sub    %rsi,%rbx
+  8044cd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8044d2:	48 39 c3             	cmp    %rax,%rbx
+  8044d5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8044d9:	4c 63 eb             	movslq %ebx,%r13
+  8044dc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8044e3:	48 01 c6             	add    %rax,%rsi
+  8044e6:	4c 89 ea             	mov    %r13,%rdx
+  8044e9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8044f0:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8044f3:	4c 89 ee             	mov    %r13,%rsi
+  8044f6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8044fd:	48 b8 b7 14 80 00 00 	movabs $0x8014b7,%rax
+  804504:	00 00 00 
+  804507:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804509:	41 01 dc             	add    %ebx,%r12d
+  80450c:	49 63 f4             	movslq %r12d,%rsi
+  80450f:	4c 39 f6             	cmp    %r14,%rsi
+  804512:	72 b3                	jb     8044c7 <devcons_write+0x38>
+    return res;
+  804514:	49 63 c4             	movslq %r12d,%rax
+}
+  804517:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80451e:	5b                   	pop    %rbx
+  80451f:	41 5c                	pop    %r12
+  804521:	41 5d                	pop    %r13
+  804523:	41 5e                	pop    %r14
+  804525:	41 5f                	pop    %r15
+  804527:	5d                   	pop    %rbp
+  804528:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804529:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80452f:	eb e3                	jmp    804514 <devcons_write+0x85>
+
+0000000000804531 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804531:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804534:	ba 00 00 00 00       	mov    $0x0,%edx
+  804539:	48 85 c0             	test   %rax,%rax
+  80453c:	74 55                	je     804593 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80453e:	55                   	push   %rbp
+  80453f:	48 89 e5             	mov    %rsp,%rbp
+  804542:	41 55                	push   %r13
+  804544:	41 54                	push   %r12
+  804546:	53                   	push   %rbx
+  804547:	48 83 ec 08          	sub    $0x8,%rsp
+  80454b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80454e:	48 bb e4 14 80 00 00 	movabs $0x8014e4,%rbx
+  804555:	00 00 00 
+  804558:	49 bc b1 15 80 00 00 	movabs $0x8015b1,%r12
+  80455f:	00 00 00 
+  804562:	eb 03                	jmp    804567 <devcons_read+0x36>
+  804564:	41 ff d4             	call   *%r12
+  804567:	ff d3                	call   *%rbx
+  804569:	85 c0                	test   %eax,%eax
+  80456b:	74 f7                	je     804564 <devcons_read+0x33>
+    if (c < 0) return c;
+  80456d:	48 63 d0             	movslq %eax,%rdx
+  804570:	78 13                	js     804585 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804572:	ba 00 00 00 00       	mov    $0x0,%edx
+  804577:	83 f8 04             	cmp    $0x4,%eax
+  80457a:	74 09                	je     804585 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80457c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804580:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804585:	48 89 d0             	mov    %rdx,%rax
+  804588:	48 83 c4 08          	add    $0x8,%rsp
+  80458c:	5b                   	pop    %rbx
+  80458d:	41 5c                	pop    %r12
+  80458f:	41 5d                	pop    %r13
+  804591:	5d                   	pop    %rbp
+  804592:	c3                   	ret
+  804593:	48 89 d0             	mov    %rdx,%rax
+  804596:	c3                   	ret
+
+0000000000804597 <cputchar>:
+cputchar(int ch) {
+  804597:	55                   	push   %rbp
+  804598:	48 89 e5             	mov    %rsp,%rbp
+  80459b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80459f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8045a3:	be 01 00 00 00       	mov    $0x1,%esi
+  8045a8:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8045ac:	48 b8 b7 14 80 00 00 	movabs $0x8014b7,%rax
+  8045b3:	00 00 00 
+  8045b6:	ff d0                	call   *%rax
+}
+  8045b8:	c9                   	leave
+  8045b9:	c3                   	ret
+
+00000000008045ba <getchar>:
+getchar(void) {
+  8045ba:	55                   	push   %rbp
+  8045bb:	48 89 e5             	mov    %rsp,%rbp
+  8045be:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8045c2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8045c7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8045cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045d0:	48 b8 78 27 80 00 00 	movabs $0x802778,%rax
+  8045d7:	00 00 00 
+  8045da:	ff d0                	call   *%rax
+  8045dc:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8045de:	85 c0                	test   %eax,%eax
+  8045e0:	78 06                	js     8045e8 <getchar+0x2e>
+  8045e2:	74 08                	je     8045ec <getchar+0x32>
+  8045e4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8045e8:	89 d0                	mov    %edx,%eax
+  8045ea:	c9                   	leave
+  8045eb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8045ec:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8045f1:	eb f5                	jmp    8045e8 <getchar+0x2e>
+
+00000000008045f3 <iscons>:
+iscons(int fdnum) {
+  8045f3:	55                   	push   %rbp
+  8045f4:	48 89 e5             	mov    %rsp,%rbp
+  8045f7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8045fb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8045ff:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  804606:	00 00 00 
+  804609:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80460b:	85 c0                	test   %eax,%eax
+  80460d:	78 18                	js     804627 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80460f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804613:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80461a:	00 00 00 
+  80461d:	8b 00                	mov    (%rax),%eax
+  80461f:	39 02                	cmp    %eax,(%rdx)
+  804621:	0f 94 c0             	sete   %al
+  804624:	0f b6 c0             	movzbl %al,%eax
+}
+  804627:	c9                   	leave
+  804628:	c3                   	ret
+
+0000000000804629 <opencons>:
+opencons(void) {
+  804629:	55                   	push   %rbp
+  80462a:	48 89 e5             	mov    %rsp,%rbp
+  80462d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804631:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804635:	48 b8 35 24 80 00 00 	movabs $0x802435,%rax
+  80463c:	00 00 00 
+  80463f:	ff d0                	call   *%rax
+  804641:	85 c0                	test   %eax,%eax
+  804643:	78 49                	js     80468e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804645:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80464a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80464f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804653:	bf 00 00 00 00       	mov    $0x0,%edi
+  804658:	48 b8 40 16 80 00 00 	movabs $0x801640,%rax
+  80465f:	00 00 00 
+  804662:	ff d0                	call   *%rax
+  804664:	85 c0                	test   %eax,%eax
+  804666:	78 26                	js     80468e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804668:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80466c:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804673:	00 00 
+  804675:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804677:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80467b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804682:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  804689:	00 00 00 
+  80468c:	ff d0                	call   *%rax
+}
+  80468e:	c9                   	leave
+  80468f:	c3                   	ret
+
+0000000000804690 <__text_end>:
+  804690:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804697:	00 00 00 
+  80469a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046a1:	00 00 00 
+  8046a4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046ab:	00 00 00 
+  8046ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046b5:	00 00 00 
+  8046b8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046bf:	00 00 00 
+  8046c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046c9:	00 00 00 
+  8046cc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046d3:	00 00 00 
+  8046d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046dd:	00 00 00 
+  8046e0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046e7:	00 00 00 
+  8046ea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046f1:	00 00 00 
+  8046f4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8046fb:	00 00 00 
+  8046fe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804705:	00 00 00 
+  804708:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80470f:	00 00 00 
+  804712:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804719:	00 00 00 
+  80471c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804723:	00 00 00 
+  804726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80472d:	00 00 00 
+  804730:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804737:	00 00 00 
+  80473a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804741:	00 00 00 
+  804744:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80474b:	00 00 00 
+  80474e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804755:	00 00 00 
+  804758:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475f:	00 00 00 
+  804762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804769:	00 00 00 
+  80476c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804773:	00 00 00 
+  804776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477d:	00 00 00 
+  804780:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804787:	00 00 00 
+  80478a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804791:	00 00 00 
+  804794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479b:	00 00 00 
+  80479e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047a5:	00 00 00 
+  8047a8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047af:	00 00 00 
+  8047b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047b9:	00 00 00 
+  8047bc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047c3:	00 00 00 
+  8047c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047cd:	00 00 00 
+  8047d0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047d7:	00 00 00 
+  8047da:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047e1:	00 00 00 
+  8047e4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047eb:	00 00 00 
+  8047ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047f5:	00 00 00 
+  8047f8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8047ff:	00 00 00 
+  804802:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804809:	00 00 00 
+  80480c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804813:	00 00 00 
+  804816:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80481d:	00 00 00 
+  804820:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804827:	00 00 00 
+  80482a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804831:	00 00 00 
+  804834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483b:	00 00 00 
+  80483e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804845:	00 00 00 
+  804848:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80484f:	00 00 00 
+  804852:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804859:	00 00 00 
+  80485c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804863:	00 00 00 
+  804866:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80486d:	00 00 00 
+  804870:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804877:	00 00 00 
+  80487a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804881:	00 00 00 
+  804884:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80488b:	00 00 00 
+  80488e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804895:	00 00 00 
+  804898:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489f:	00 00 00 
+  8048a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048a9:	00 00 00 
+  8048ac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048b3:	00 00 00 
+  8048b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048bd:	00 00 00 
+  8048c0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048c7:	00 00 00 
+  8048ca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048d1:	00 00 00 
+  8048d4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048db:	00 00 00 
+  8048de:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048e5:	00 00 00 
+  8048e8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048ef:	00 00 00 
+  8048f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8048f9:	00 00 00 
+  8048fc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804903:	00 00 00 
+  804906:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80490d:	00 00 00 
+  804910:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804917:	00 00 00 
+  80491a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804921:	00 00 00 
+  804924:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80492b:	00 00 00 
+  80492e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804935:	00 00 00 
+  804938:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80493f:	00 00 00 
+  804942:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804949:	00 00 00 
+  80494c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804953:	00 00 00 
+  804956:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80495d:	00 00 00 
+  804960:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804967:	00 00 00 
+  80496a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804971:	00 00 00 
+  804974:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80497b:	00 00 00 
+  80497e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804985:	00 00 00 
+  804988:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80498f:	00 00 00 
+  804992:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804999:	00 00 00 
+  80499c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049a3:	00 00 00 
+  8049a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049ad:	00 00 00 
+  8049b0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049b7:	00 00 00 
+  8049ba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049c1:	00 00 00 
+  8049c4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049cb:	00 00 00 
+  8049ce:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d5:	00 00 00 
+  8049d8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049df:	00 00 00 
+  8049e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049e9:	00 00 00 
+  8049ec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049f3:	00 00 00 
+  8049f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049fd:	00 00 00 
+  804a00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a07:	00 00 00 
+  804a0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a11:	00 00 00 
+  804a14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a1b:	00 00 00 
+  804a1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a25:	00 00 00 
+  804a28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a2f:	00 00 00 
+  804a32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a39:	00 00 00 
+  804a3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a43:	00 00 00 
+  804a46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a4d:	00 00 00 
+  804a50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a57:	00 00 00 
+  804a5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a61:	00 00 00 
+  804a64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a6b:	00 00 00 
+  804a6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a75:	00 00 00 
+  804a78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a7f:	00 00 00 
+  804a82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a89:	00 00 00 
+  804a8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a93:	00 00 00 
+  804a96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a9d:	00 00 00 
+  804aa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aa7:	00 00 00 
+  804aaa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ab1:	00 00 00 
+  804ab4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804abb:	00 00 00 
+  804abe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ac5:	00 00 00 
+  804ac8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804acf:	00 00 00 
+  804ad2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ad9:	00 00 00 
+  804adc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ae3:	00 00 00 
+  804ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804aed:	00 00 00 
+  804af0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804af7:	00 00 00 
+  804afa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b01:	00 00 00 
+  804b04:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b0b:	00 00 00 
+  804b0e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b15:	00 00 00 
+  804b18:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b1f:	00 00 00 
+  804b22:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b29:	00 00 00 
+  804b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b33:	00 00 00 
+  804b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3d:	00 00 00 
+  804b40:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b47:	00 00 00 
+  804b4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b51:	00 00 00 
+  804b54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b5b:	00 00 00 
+  804b5e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b65:	00 00 00 
+  804b68:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b6f:	00 00 00 
+  804b72:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b79:	00 00 00 
+  804b7c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b83:	00 00 00 
+  804b86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b8d:	00 00 00 
+  804b90:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b97:	00 00 00 
+  804b9a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ba1:	00 00 00 
+  804ba4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bab:	00 00 00 
+  804bae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bb5:	00 00 00 
+  804bb8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bbf:	00 00 00 
+  804bc2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bc9:	00 00 00 
+  804bcc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd3:	00 00 00 
+  804bd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bdd:	00 00 00 
+  804be0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804be7:	00 00 00 
+  804bea:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bf1:	00 00 00 
+  804bf4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bfb:	00 00 00 
+  804bfe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c05:	00 00 00 
+  804c08:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c0f:	00 00 00 
+  804c12:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c19:	00 00 00 
+  804c1c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c23:	00 00 00 
+  804c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c2d:	00 00 00 
+  804c30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c37:	00 00 00 
+  804c3a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c41:	00 00 00 
+  804c44:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c4b:	00 00 00 
+  804c4e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c55:	00 00 00 
+  804c58:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c5f:	00 00 00 
+  804c62:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c69:	00 00 00 
+  804c6c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c73:	00 00 00 
+  804c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c7d:	00 00 00 
+  804c80:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c87:	00 00 00 
+  804c8a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c91:	00 00 00 
+  804c94:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c9b:	00 00 00 
+  804c9e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ca5:	00 00 00 
+  804ca8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804caf:	00 00 00 
+  804cb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cb9:	00 00 00 
+  804cbc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cc3:	00 00 00 
+  804cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ccd:	00 00 00 
+  804cd0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cd7:	00 00 00 
+  804cda:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ce1:	00 00 00 
+  804ce4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ceb:	00 00 00 
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cff:	00 00 00 
+  804d02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d09:	00 00 00 
+  804d0c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d13:	00 00 00 
+  804d16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d1d:	00 00 00 
+  804d20:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d27:	00 00 00 
+  804d2a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d31:	00 00 00 
+  804d34:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d3b:	00 00 00 
+  804d3e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d45:	00 00 00 
+  804d48:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d4f:	00 00 00 
+  804d52:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d59:	00 00 00 
+  804d5c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d63:	00 00 00 
+  804d66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d6d:	00 00 00 
+  804d70:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d77:	00 00 00 
+  804d7a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d81:	00 00 00 
+  804d84:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d8b:	00 00 00 
+  804d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d95:	00 00 00 
+  804d98:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804d9f:	00 00 00 
+  804da2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804da9:	00 00 00 
+  804dac:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804db3:	00 00 00 
+  804db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dbd:	00 00 00 
+  804dc0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dc7:	00 00 00 
+  804dca:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804dd1:	00 00 00 
+  804dd4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ddb:	00 00 00 
+  804dde:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804de5:	00 00 00 
+  804de8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804def:	00 00 00 
+  804df2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df9:	00 00 00 
+  804dfc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e03:	00 00 00 
+  804e06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e0d:	00 00 00 
+  804e10:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e17:	00 00 00 
+  804e1a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e21:	00 00 00 
+  804e24:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e2b:	00 00 00 
+  804e2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e35:	00 00 00 
+  804e38:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e3f:	00 00 00 
+  804e42:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e49:	00 00 00 
+  804e4c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e53:	00 00 00 
+  804e56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e5d:	00 00 00 
+  804e60:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e67:	00 00 00 
+  804e6a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e71:	00 00 00 
+  804e74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e7b:	00 00 00 
+  804e7e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e85:	00 00 00 
+  804e88:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e8f:	00 00 00 
+  804e92:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804e99:	00 00 00 
+  804e9c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ea3:	00 00 00 
+  804ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ead:	00 00 00 
+  804eb0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804eb7:	00 00 00 
+  804eba:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ec1:	00 00 00 
+  804ec4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ecb:	00 00 00 
+  804ece:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ed5:	00 00 00 
+  804ed8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804edf:	00 00 00 
+  804ee2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ee9:	00 00 00 
+  804eec:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ef3:	00 00 00 
+  804ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804efd:	00 00 00 
+  804f00:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f07:	00 00 00 
+  804f0a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f11:	00 00 00 
+  804f14:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f1b:	00 00 00 
+  804f1e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f25:	00 00 00 
+  804f28:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f2f:	00 00 00 
+  804f32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f39:	00 00 00 
+  804f3c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f43:	00 00 00 
+  804f46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f4d:	00 00 00 
+  804f50:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f57:	00 00 00 
+  804f5a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f61:	00 00 00 
+  804f64:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f6b:	00 00 00 
+  804f6e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f75:	00 00 00 
+  804f78:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f7f:	00 00 00 
+  804f82:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f89:	00 00 00 
+  804f8c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f93:	00 00 00 
+  804f96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804f9d:	00 00 00 
+  804fa0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fa7:	00 00 00 
+  804faa:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fb1:	00 00 00 
+  804fb4:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fbb:	00 00 00 
+  804fbe:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fc5:	00 00 00 
+  804fc8:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fcf:	00 00 00 
+  804fd2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fd9:	00 00 00 
+  804fdc:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fe3:	00 00 00 
+  804fe6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804fed:	00 00 00 
+  804ff0:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804ff7:	00 00 00 
+  804ffa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)